@@ -0,0 +1,308 @@
+#include "BookCacheKey.h"
+
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <algorithm>
+
+namespace {
+constexpr uint8_t JOURNAL_VERSION = 1;
+constexpr char JOURNAL_FILE[] = "/.crosspoint/cachekeys.bin";
+// Size of one journal record on disk
+constexpr uint32_t RECORD_SIZE = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t);
+// Rewrite the journal once it holds this many superseded records
+constexpr uint32_t COMPACT_SLACK = 64;
+
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+uint64_t fnv1a(uint64_t hash, const uint8_t* data, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+uint32_t packModifyTime(FsFile& file) {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  file.getModifyDateTime(&date, &time);
+  return static_cast<uint32_t>(date) << 16 | time;
+}
+
+bool comparePathHash(const BookCacheKey::Alias& a, const uint64_t pathHash) { return a.pathHash < pathHash; }
+
+// Held by every public entry point. Recursive, getCachePath resolves the key under its own lock.
+class AliasLock {
+ public:
+  AliasLock() { xSemaphoreTakeRecursive(mutex(), portMAX_DELAY); }
+  ~AliasLock() { xSemaphoreGiveRecursive(mutex()); }
+  AliasLock(const AliasLock&) = delete;
+  AliasLock& operator=(const AliasLock&) = delete;
+
+ private:
+  static SemaphoreHandle_t mutex() {
+    static SemaphoreHandle_t handle = xSemaphoreCreateRecursiveMutex();
+    return handle;
+  }
+};
+}  // namespace
+
+std::vector<BookCacheKey::Alias> BookCacheKey::aliases;
+bool BookCacheKey::loaded = false;
+uint32_t BookCacheKey::journalRecords = 0;
+
+uint64_t BookCacheKey::hashPath(const std::string& filePath) {
+  return fnv1a(FNV_OFFSET_BASIS, reinterpret_cast<const uint8_t*>(filePath.data()), filePath.size());
+}
+
+uint64_t BookCacheKey::fingerprint(FsFile& file, const uint32_t size) {
+  uint64_t hash = fnv1a(FNV_OFFSET_BASIS, reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+
+  // Same sample offsets as KOReaderDocumentId: 0, then 1024 << (2 * i)
+  uint8_t buffer[256];
+  for (int i = -1; i < OFFSET_COUNT - 1; i++) {
+    const uint32_t offset = i < 0 ? 0 : CHUNK_SIZE << (2 * i);
+    if (offset >= size || !file.seekSet(offset)) {
+      break;
+    }
+
+    size_t remaining = std::min<size_t>(CHUNK_SIZE, size - offset);
+    while (remaining > 0) {
+      const int bytesRead = file.read(buffer, std::min(remaining, sizeof(buffer)));
+      if (bytesRead <= 0) {
+        break;
+      }
+      hash = fnv1a(hash, buffer, bytesRead);
+      remaining -= bytesRead;
+    }
+  }
+
+  // 0 marks a tombstone in the journal
+  return hash == 0 ? 1 : hash;
+}
+
+std::string BookCacheKey::formatKey(const uint64_t key) {
+  char out[17];
+  snprintf(out, sizeof(out), "%08lx%08lx", static_cast<unsigned long>(key >> 32),
+           static_cast<unsigned long>(key & 0xffffffff));
+  return out;
+}
+
+std::string BookCacheKey::legacyCachePath(const std::string& cacheDir, const char* prefix,
+                                          const std::string& filePath) {
+  return cacheDir + "/" + prefix + std::to_string(std::hash<std::string>{}(filePath));
+}
+
+BookCacheKey::Alias* BookCacheKey::find(const uint64_t pathHash) {
+  const auto it = std::lower_bound(aliases.begin(), aliases.end(), pathHash, comparePathHash);
+  if (it == aliases.end() || it->pathHash != pathHash) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+void BookCacheKey::put(const Alias& alias) {
+  const auto it = std::lower_bound(aliases.begin(), aliases.end(), alias.pathHash, comparePathHash);
+  if (it != aliases.end() && it->pathHash == alias.pathHash) {
+    *it = alias;
+  } else {
+    aliases.insert(it, alias);
+  }
+}
+
+void BookCacheKey::erase(const uint64_t pathHash) {
+  const auto it = std::lower_bound(aliases.begin(), aliases.end(), pathHash, comparePathHash);
+  if (it != aliases.end() && it->pathHash == pathHash) {
+    aliases.erase(it);
+  }
+}
+
+std::string BookCacheKey::resolve(const std::string& filePath) {
+  AliasLock lock;
+  ensureLoaded();
+
+  FsFile file;
+  if (!SdMan.openFileForRead("BCK", filePath, file)) {
+    return "";
+  }
+  const auto size = static_cast<uint32_t>(file.size());
+  const uint32_t mtime = packModifyTime(file);
+
+  const uint64_t pathHash = hashPath(filePath);
+  if (const Alias* alias = find(pathHash)) {
+    if (alias->size == size && alias->mtime == mtime) {
+      file.close();
+      return formatKey(alias->key);
+    }
+  }
+
+  const unsigned long start = millis();
+  const Alias alias{pathHash, size, mtime, fingerprint(file, size)};
+  file.close();
+  LOG_INF("BCK", "Fingerprinted %s in %lu ms\n", filePath.c_str(), millis() - start);
+
+  put(alias);
+  appendToJournal(alias);
+  return formatKey(alias.key);
+}
+
+std::string BookCacheKey::getCachePath(const std::string& cacheDir, const char* prefix, const std::string& filePath) {
+  AliasLock lock;
+  const std::string key = resolve(filePath);
+  if (key.empty()) {
+    return legacyCachePath(cacheDir, prefix, filePath);
+  }
+
+  std::string cachePath = cacheDir + "/" + prefix + key;
+  if (!SdMan.exists(cachePath.c_str())) {
+    // Adopt a cache built before content keys instead of re-indexing the book
+    const std::string legacyPath = legacyCachePath(cacheDir, prefix, filePath);
+    if (SdMan.exists(legacyPath.c_str())) {
+      auto dir = SdMan.open(legacyPath.c_str());
+      const bool renamed = dir && dir.rename(cachePath.c_str());
+      if (dir) dir.close();
+      LOG_INF("BCK", "Migrating %s -> %s %s\n", legacyPath.c_str(), cachePath.c_str(), renamed ? "done" : "failed");
+    }
+  }
+  return cachePath;
+}
+
+void BookCacheKey::forget(const std::string& filePath) {
+  AliasLock lock;
+  ensureLoaded();
+  const uint64_t pathHash = hashPath(filePath);
+  if (!find(pathHash)) {
+    return;
+  }
+  erase(pathHash);
+  appendToJournal({pathHash, 0, 0, 0});
+}
+
+std::string BookCacheKey::progressPathFor(const std::string& cachePath, const uint64_t pathHash) {
+  return cachePath + "/progress_" + formatKey(pathHash) + ".bin";
+}
+
+std::string BookCacheKey::getProgressPath(const std::string& cachePath, const std::string& filePath) {
+  return progressPathFor(cachePath, hashPath(filePath));
+}
+
+std::string BookCacheKey::findProgressPath(const std::string& cachePath, const std::string& filePath) {
+  AliasLock lock;
+  ensureLoaded();
+  const uint64_t pathHash = hashPath(filePath);
+  std::string progressPath = progressPathFor(cachePath, pathHash);
+  if (SdMan.exists(progressPath.c_str())) {
+    return progressPath;
+  }
+
+  // A book moved or renamed on the card still has the alias of the path it was read at, and that path's position is
+  // in the same cache directory. With several earlier paths the first position found wins.
+  if (const Alias* alias = find(pathHash)) {
+    for (const auto& other : aliases) {
+      if (other.key != alias->key || other.pathHash == pathHash) {
+        continue;
+      }
+      const std::string otherPath = progressPathFor(cachePath, other.pathHash);
+      if (SdMan.exists(otherPath.c_str())) {
+        LOG_INF("BCK", "Resuming %s from the position kept at %s\n", filePath.c_str(), otherPath.c_str());
+        return otherPath;
+      }
+    }
+  }
+
+  const std::string sharedPath = cachePath + "/progress.bin";
+  if (SdMan.exists(sharedPath.c_str())) {
+    return sharedPath;
+  }
+  return progressPath;
+}
+
+void BookCacheKey::ensureLoaded() {
+  if (loaded) {
+    return;
+  }
+  loaded = true;
+
+  FsFile inputFile;
+  if (!SdMan.openFileForRead("BCK", JOURNAL_FILE, inputFile)) {
+    return;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != JOURNAL_VERSION) {
+    LOG_ERR("BCK", "Deserialization failed: Unknown version %u\n", version);
+    inputFile.close();
+    return;
+  }
+
+  // Later records supersede earlier ones for the same path
+  while (inputFile.available() >= static_cast<int>(RECORD_SIZE)) {
+    Alias alias{};
+    serialization::readPod(inputFile, alias.pathHash);
+    serialization::readPod(inputFile, alias.size);
+    serialization::readPod(inputFile, alias.mtime);
+    serialization::readPod(inputFile, alias.key);
+    journalRecords++;
+    if (alias.key == 0) {
+      erase(alias.pathHash);
+    } else {
+      put(alias);
+    }
+  }
+  inputFile.close();
+
+  LOG_INF("BCK", "Loaded %zu cache key aliases (%u journal records)\n", aliases.size(), journalRecords);
+}
+
+void BookCacheKey::appendToJournal(const Alias& alias) {
+  if (journalRecords >= aliases.size() + COMPACT_SLACK) {
+    compactJournal();
+    return;
+  }
+
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  auto outputFile = SdMan.open(JOURNAL_FILE, O_WRONLY | O_CREAT | O_APPEND);
+  if (!outputFile) {
+    LOG_ERR("BCK", "Could not open journal for append\n");
+    return;
+  }
+  if (outputFile.size() == 0) {
+    serialization::writePod(outputFile, JOURNAL_VERSION);
+  }
+  serialization::writePod(outputFile, alias.pathHash);
+  serialization::writePod(outputFile, alias.size);
+  serialization::writePod(outputFile, alias.mtime);
+  serialization::writePod(outputFile, alias.key);
+  outputFile.close();
+  journalRecords++;
+}
+
+void BookCacheKey::compactJournal() {
+  // Make sure the directory exists
+  SdMan.mkdir("/.crosspoint");
+
+  FsFile outputFile;
+  if (!SdMan.openFileForWrite("BCK", JOURNAL_FILE, outputFile)) {
+    return;
+  }
+
+  serialization::writePod(outputFile, JOURNAL_VERSION);
+  for (const auto& alias : aliases) {
+    serialization::writePod(outputFile, alias.pathHash);
+    serialization::writePod(outputFile, alias.size);
+    serialization::writePod(outputFile, alias.mtime);
+    serialization::writePod(outputFile, alias.key);
+  }
+  outputFile.close();
+
+  journalRecords = aliases.size();
+  LOG_INF("BCK", "Journal compacted (%u aliases)\n", journalRecords);
+}
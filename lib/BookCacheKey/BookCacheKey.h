@@ -0,0 +1,83 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Content-addressed cache identity for books.
+ *
+ * A book's cache directory is named after a fingerprint of its content (file size plus a hash of 1KB blocks sampled
+ * at the same offsets as KOReaderDocumentId), so moving or renaming a book keeps book.bin, sections, covers and the
+ * reading position. Positions are kept per path so copies of a book are read separately. Fingerprinting costs a
+ * dozen small reads, so results are remembered in a path -> key alias table that is validated against the file's
+ * size and modify time and persisted as an append-only journal.
+ *
+ * Caches created before content keys (named after the path hash) are renamed in place the first time they are seen.
+ *
+ * Books are opened from the render task, the ingest loop and the web server, every entry point takes a lock around
+ * the alias table and its journal.
+ */
+class BookCacheKey {
+ public:
+  struct Alias {
+    uint64_t pathHash;  // FNV-1a of the full path
+    uint32_t size;
+    uint32_t mtime;  // FAT modify date << 16 | FAT modify time
+    uint64_t key;    // 0 = tombstone in the journal
+  };
+
+  /**
+   * Cache directory for a book, e.g. "/.crosspoint/epub_0123456789abcdef".
+   * Falls back to the legacy path-hash name if the book cannot be read.
+   */
+  static std::string getCachePath(const std::string& cacheDir, const char* prefix, const std::string& filePath);
+
+  /**
+   * Content key for a book (16 lowercase hex characters), empty if the file cannot be read.
+   */
+  static std::string resolve(const std::string& filePath);
+
+  /**
+   * Drop the alias for a path whose content was replaced (e.g. overwritten by an upload). File timestamps are not
+   * reliable without an RTC, so writers must call this rather than rely on the modify time check.
+   * The caches stay with the content they were built from, the cache budget reclaims them when nothing reads them.
+   */
+  static void forget(const std::string& filePath);
+
+  /**
+   * Reading position file for a book inside its cache directory. Copies of a book at different paths share the
+   * cache but each keeps its own position.
+   */
+  static std::string getProgressPath(const std::string& cachePath, const std::string& filePath);
+
+  /**
+   * Position to resume from: getProgressPath if it exists, else the position of another path with the same content
+   * key (the book before it was moved or renamed), else the shared progress.bin of caches written before positions
+   * were kept per path. Reading from another path's file and saving to getProgressPath copies the position over.
+   */
+  static std::string findProgressPath(const std::string& cachePath, const std::string& filePath);
+
+ private:
+  static constexpr size_t CHUNK_SIZE = 1024;
+  static constexpr int OFFSET_COUNT = 12;
+
+  static std::vector<Alias> aliases;  // Sorted by pathHash
+  static bool loaded;
+  static uint32_t journalRecords;
+
+  static uint64_t hashPath(const std::string& filePath);
+  static uint64_t fingerprint(FsFile& file, uint32_t size);
+  static std::string formatKey(uint64_t key);
+  static std::string progressPathFor(const std::string& cachePath, uint64_t pathHash);
+  static std::string legacyCachePath(const std::string& cacheDir, const char* prefix, const std::string& filePath);
+
+  static Alias* find(uint64_t pathHash);
+  static void put(const Alias& alias);
+  static void erase(uint64_t pathHash);
+
+  static void ensureLoaded();
+  static void appendToJournal(const Alias& alias);
+  static void compactJournal();
+};
@@ -4,6 +4,10 @@
 
 #include <algorithm>
 
+#include "EpdFontPack.h"
+
+EpdFont::EpdFont(EpdFontPack* pack) : pack(pack), data(nullptr) {}
+
 void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
                             int* maxY) const {
   *minX = startX;
@@ -15,6 +19,7 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
     return;
   }
 
+  const EpdFontPack::Lock packLock(isPack());
   int cursorX = startX;
   const int cursorY = startY;
   uint32_t cp;
@@ -47,6 +52,60 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
   *h = maxY - minY;
 }
 
+size_t EpdFont::getFittingLength(const char* string, const char* suffix, const int maxWidth) const {
+  const EpdFontPack::Lock packLock(isPack());
+  const auto glyphFor = [this](const uint32_t cp) {
+    const EpdGlyph* glyph = getGlyph(cp);
+    return glyph ? glyph : getGlyph(REPLACEMENT_GLYPH);
+  };
+
+  // Horizontal extent of the suffix relative to where it starts
+  bool suffixInked = false;
+  int suffixMinX = 0, suffixMaxX = 0, suffixCursorX = 0;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&suffix)))) {
+    const EpdGlyph* glyph = glyphFor(cp);
+    if (!glyph) {
+      continue;
+    }
+    const int glyphMinX = suffixCursorX + glyph->left;
+    const int glyphMaxX = glyphMinX + glyph->width;
+    suffixMinX = suffixInked ? std::min(suffixMinX, glyphMinX) : glyphMinX;
+    suffixMaxX = suffixInked ? std::max(suffixMaxX, glyphMaxX) : glyphMaxX;
+    suffixInked = true;
+    suffixCursorX += glyph->advanceX;
+  }
+
+  // Same bounds as getTextBounds, which starts them at the origin
+  const char* const start = string;
+  int minX = 0, maxX = 0, cursorX = 0;
+  size_t fitting = 0;
+  const char* next = string;
+  while (true) {
+    const int withSuffixMin = suffixInked ? std::min(minX, cursorX + suffixMinX) : minX;
+    const int withSuffixMax = suffixInked ? std::max(maxX, cursorX + suffixMaxX) : maxX;
+    if (withSuffixMax - withSuffixMin <= maxWidth) {
+      fitting = string - start;
+    }
+
+    cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&next));
+    if (!cp) {
+      // The whole string was measured without overflowing
+      return string - start;
+    }
+    if (const EpdGlyph* glyph = glyphFor(cp)) {
+      minX = std::min(minX, cursorX + glyph->left);
+      maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+      cursorX += glyph->advanceX;
+    }
+    string = next;
+    // Bounds only grow, neither a longer prefix nor the whole string can fit anymore
+    if (maxX - minX > maxWidth) {
+      return fitting;
+    }
+  }
+}
+
 bool EpdFont::hasPrintableChars(const char* string) const {
   int w = 0, h = 0;
 
@@ -55,7 +114,12 @@ bool EpdFont::hasPrintableChars(const char* string) const {
   return w > 0 || h > 0;
 }
 
+const EpdFontData* EpdFont::getData() const { return pack ? pack->getData() : data; }
+
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  // Keeps the glyph table resident between loading it and indexing it
+  const EpdFontPack::Lock packLock(isPack());
+  const EpdFontData* data = getData();
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -82,3 +146,10 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+const uint8_t* EpdFont::getGlyphBitmap(const EpdGlyph* glyph) const {
+  if (pack) {
+    return pack->getGlyphBitmap(glyph);
+  }
+  return &data->bitmap[glyph->dataOffset];
+}
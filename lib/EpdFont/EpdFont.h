@@ -1,15 +1,35 @@
 #pragma once
+#include <cstddef>
+
 #include "EpdFontData.h"
 
+class EpdFontPack;
+
 class EpdFont {
+  // Set for fonts read from the SD card, data then belongs to the pack and is loaded on demand
+  EpdFontPack* pack = nullptr;
+
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
  public:
+  // Null for pack fonts, use getData()
   const EpdFontData* data;
   explicit EpdFont(const EpdFontData* data) : data(data) {}
+  explicit EpdFont(EpdFontPack* pack);
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
+  // Bytes of string that fit in maxWidth with suffix drawn right after them, measured as getTextDimensions would
+  // measure the joined text. All of string if it fits on its own. Walks string once and stops where it overflows,
+  // cuts only fall between UTF-8 sequences.
+  size_t getFittingLength(const char* string, const char* suffix, int maxWidth) const;
   bool hasPrintableChars(const char* string) const;
+  // Pack fonts share the bitmap cache with other tasks, see EpdFontPack::Lock
+  bool isPack() const { return pack != nullptr; }
 
+  // Loads the metrics of a pack font
+  const EpdFontData* getData() const;
   const EpdGlyph* getGlyph(uint32_t cp) const;
+  // Bitmap of a glyph returned by getGlyph, nullptr if it could not be read. For pack fonts glyph and bitmap are only
+  // valid while an EpdFontPack::Lock is held.
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph) const;
 };
@@ -32,4 +32,5 @@ typedef struct {
   int ascender;                         ///< Maximal height of a glyph above the base line
   int descender;                        ///< Maximal height of a glyph below the base line
   bool is2Bit;
+  bool isRle = false;  ///< Glyph bitmaps are run-length encoded, see EpdGlyphRle.h
 } EpdFontData;
@@ -26,12 +26,23 @@ void EpdFontFamily::getTextDimensions(const char* string, int* w, int* h, const
   getFont(style)->getTextDimensions(string, w, h);
 }
 
+size_t EpdFontFamily::getFittingLength(const char* string, const char* suffix, const int maxWidth,
+                                       const Style style) const {
+  return getFont(style)->getFittingLength(string, suffix, maxWidth);
+}
+
 bool EpdFontFamily::hasPrintableChars(const char* string, const Style style) const {
   return getFont(style)->hasPrintableChars(string);
 }
 
-const EpdFontData* EpdFontFamily::getData(const Style style) const { return getFont(style)->data; }
+const EpdFontData* EpdFontFamily::getData(const Style style) const { return getFont(style)->getData(); }
 
 const EpdGlyph* EpdFontFamily::getGlyph(const uint32_t cp, const Style style) const {
   return getFont(style)->getGlyph(cp);
 };
+
+const uint8_t* EpdFontFamily::getGlyphBitmap(const EpdGlyph* glyph, const Style style) const {
+  return getFont(style)->getGlyphBitmap(glyph);
+}
+
+bool EpdFontFamily::isPack(const Style style) const { return getFont(style)->isPack(); }
@@ -10,9 +10,12 @@ class EpdFontFamily {
       : regular(regular), bold(bold), italic(italic), boldItalic(boldItalic) {}
   ~EpdFontFamily() = default;
   void getTextDimensions(const char* string, int* w, int* h, Style style = REGULAR) const;
+  size_t getFittingLength(const char* string, const char* suffix, int maxWidth, Style style = REGULAR) const;
   bool hasPrintableChars(const char* string, Style style = REGULAR) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph, Style style = REGULAR) const;
+  bool isPack(Style style = REGULAR) const;
 
  private:
   const EpdFont* regular;
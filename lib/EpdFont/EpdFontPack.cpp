@@ -0,0 +1,331 @@
+#include "EpdFontPack.h"
+
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace {
+constexpr uint32_t HEADER_SIZE = 28;
+constexpr uint32_t INTERVAL_RECORD_SIZE = 12;
+constexpr uint32_t GLYPH_RECORD_SIZE = 14;
+
+struct CachePage {
+  const EpdFontPack* pack;
+  uint32_t page;
+  uint32_t lastUsed;
+};
+
+EpdFontPack* residentPacks[EpdFontPack::MAX_RESIDENT_PACKS] = {};
+CachePage cachePages[EpdFontPack::CACHE_PAGE_COUNT] = {};
+// CACHE_PAGE_COUNT pages of CACHE_PAGE_SIZE, allocated on the first bitmap read
+uint8_t* cacheMemory = nullptr;
+// Glyphs crossing a page boundary are assembled here
+uint8_t* spanBuffer = nullptr;
+size_t spanBufferSize = 0;
+// The file of the pack that missed last stays open, misses come in bursts from one pack
+FsFile openFile;
+const EpdFontPack* openFilePack = nullptr;
+uint32_t useCounter = 0;
+EpdFontPack::CacheStats stats = {};
+
+SemaphoreHandle_t packMutex() {
+  static SemaphoreHandle_t handle = xSemaphoreCreateRecursiveMutex();
+  return handle;
+}
+
+void closeOpenFile() {
+  if (openFilePack) {
+    openFile.close();
+    openFilePack = nullptr;
+  }
+}
+}  // namespace
+
+uint8_t EpdFontPack::CacheStats::getHitPercent() const {
+  const uint32_t lookups = hits + misses;
+  return lookups == 0 ? 0 : static_cast<uint8_t>(static_cast<uint64_t>(hits) * 100 / lookups);
+}
+
+EpdFontPack::Lock::Lock(const bool engaged) : engaged(engaged) {
+  if (engaged) {
+    xSemaphoreTakeRecursive(packMutex(), portMAX_DELAY);
+  }
+}
+
+EpdFontPack::Lock::~Lock() {
+  if (engaged) {
+    xSemaphoreGiveRecursive(packMutex());
+  }
+}
+
+EpdFontPack::~EpdFontPack() {
+  Lock lock;
+  unload();
+}
+
+bool EpdFontPack::begin() {
+  FsFile file;
+  if (!SdMan.openFileForRead("EFP", path, file)) {
+    return false;
+  }
+
+  char magic[sizeof(MAGIC)];
+  uint8_t version, is2Bit, advanceY, isRle;
+  int16_t ascender, descender;
+  uint16_t reserved16;
+  file.read(magic, sizeof(magic));
+  serialization::readPod(file, version);
+  serialization::readPod(file, is2Bit);
+  serialization::readPod(file, advanceY);
+  serialization::readPod(file, isRle);
+  serialization::readPod(file, ascender);
+  serialization::readPod(file, descender);
+  serialization::readPod(file, intervalCount);
+  serialization::readPod(file, glyphCount);
+  serialization::readPod(file, bitmapSize);
+  serialization::readPod(file, maxGlyphBytes);
+  serialization::readPod(file, reserved16);
+  const uint32_t fileSize = file.size();
+  file.close();
+
+  if (memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION) {
+    LOG_ERR("EFP", "%s is not a version %u font pack\n", path.c_str(), VERSION);
+    return false;
+  }
+  bitmapStart = HEADER_SIZE + intervalCount * INTERVAL_RECORD_SIZE + glyphCount * GLYPH_RECORD_SIZE;
+  if (fileSize != bitmapStart + bitmapSize) {
+    LOG_ERR("EFP", "%s is truncated: %u bytes, expected %u\n", path.c_str(), fileSize, bitmapStart + bitmapSize);
+    return false;
+  }
+
+  data = {};
+  data.advanceY = advanceY;
+  data.ascender = ascender;
+  data.descender = descender;
+  data.is2Bit = is2Bit != 0;
+  data.isRle = isRle != 0;
+  valid = true;
+  return true;
+}
+
+const EpdFontData* EpdFontPack::getData() {
+  Lock lock;
+  load();
+  return &data;
+}
+
+bool EpdFontPack::load() {
+  lastUsed = ++useCounter;
+  if (isLoaded()) {
+    return true;
+  }
+  if (!valid) {
+    return false;
+  }
+
+  size_t slot = 0;
+  for (size_t i = 0; i < MAX_RESIDENT_PACKS; i++) {
+    if (!residentPacks[i]) {
+      slot = i;
+      break;
+    }
+    if (residentPacks[i]->lastUsed < residentPacks[slot]->lastUsed) {
+      slot = i;
+    }
+  }
+  if (residentPacks[slot]) {
+    LOG_DBG("EFP", "Unloading %s for %s\n", residentPacks[slot]->path.c_str(), path.c_str());
+    residentPacks[slot]->unload();
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("EFP", path, file) || !file.seekSet(HEADER_SIZE)) {
+    return false;
+  }
+  intervals = new (std::nothrow) EpdUnicodeInterval[intervalCount];
+  glyphs = new (std::nothrow) EpdGlyph[glyphCount];
+  if (!intervals || !glyphs) {
+    LOG_ERR("EFP", "Not enough memory for the metrics of %s\n", path.c_str());
+    file.close();
+    unload();
+    return false;
+  }
+
+  bool ok = true;
+  for (uint32_t i = 0; i < intervalCount; i++) {
+    EpdUnicodeInterval& interval = intervals[i];
+    serialization::readPod(file, interval.first);
+    serialization::readPod(file, interval.last);
+    serialization::readPod(file, interval.offset);
+    // getGlyph indexes the glyph table without further checks
+    ok = ok && interval.first <= interval.last && interval.offset + (interval.last - interval.first) < glyphCount;
+  }
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    EpdGlyph& glyph = glyphs[i];
+    uint8_t reserved;
+    serialization::readPod(file, glyph.width);
+    serialization::readPod(file, glyph.height);
+    serialization::readPod(file, glyph.advanceX);
+    serialization::readPod(file, reserved);
+    serialization::readPod(file, glyph.left);
+    serialization::readPod(file, glyph.top);
+    serialization::readPod(file, glyph.dataLength);
+    serialization::readPod(file, glyph.dataOffset);
+    ok = ok && glyph.dataOffset + glyph.dataLength <= bitmapSize && glyph.dataLength <= maxGlyphBytes;
+  }
+  ok = ok && file.position() == bitmapStart;
+  file.close();
+  if (!ok) {
+    LOG_ERR("EFP", "Corrupt metrics in %s\n", path.c_str());
+    unload();
+    return false;
+  }
+
+  residentPacks[slot] = this;
+  data.glyph = glyphs;
+  data.intervals = intervals;
+  data.intervalCount = intervalCount;
+  stats.metricLoads++;
+  LOG_DBG("EFP", "Loaded %s: %u glyphs, %u intervals\n", path.c_str(), glyphCount, intervalCount);
+  return true;
+}
+
+void EpdFontPack::unload() {
+  for (auto& pack : residentPacks) {
+    if (pack == this) {
+      pack = nullptr;
+    }
+  }
+  for (auto& page : cachePages) {
+    if (page.pack == this) {
+      page.pack = nullptr;
+    }
+  }
+  if (openFilePack == this) {
+    closeOpenFile();
+  }
+  delete[] glyphs;
+  delete[] intervals;
+  glyphs = nullptr;
+  intervals = nullptr;
+  data.glyph = nullptr;
+  data.intervals = nullptr;
+  data.intervalCount = 0;
+}
+
+bool EpdFontPack::readPage(const uint32_t page, uint8_t* out) {
+  if (openFilePack != this) {
+    closeOpenFile();
+    if (!SdMan.openFileForRead("EFP", path, openFile)) {
+      return false;
+    }
+    openFilePack = this;
+  }
+  const uint32_t offset = page * CACHE_PAGE_SIZE;
+  const uint32_t length = std::min<uint32_t>(CACHE_PAGE_SIZE, bitmapSize - offset);
+  return openFile.seekSet(bitmapStart + offset) && openFile.read(out, length) == static_cast<int>(length);
+}
+
+const uint8_t* EpdFontPack::getGlyphBitmap(const EpdGlyph* glyph) {
+  Lock lock;
+  if (!glyph || glyph->dataLength == 0 || !load()) {
+    return nullptr;
+  }
+  if (!cacheMemory) {
+    cacheMemory = new (std::nothrow) uint8_t[CACHE_PAGE_COUNT * CACHE_PAGE_SIZE];
+    if (!cacheMemory) {
+      LOG_ERR("EFP", "Not enough memory for the glyph cache\n");
+      return nullptr;
+    }
+  }
+
+  // Finds a page of this pack's bitmaps in the cache, reading it over the least recently used one on a miss
+  const auto getPage = [this](const uint32_t page) -> const uint8_t* {
+    size_t victim = 0;
+    for (size_t i = 0; i < CACHE_PAGE_COUNT; i++) {
+      if (cachePages[i].pack == this && cachePages[i].page == page) {
+        cachePages[i].lastUsed = ++useCounter;
+        stats.hits++;
+        return cacheMemory + i * CACHE_PAGE_SIZE;
+      }
+      if (!cachePages[i].pack) {
+        if (cachePages[victim].pack) {
+          victim = i;
+        }
+      } else if (cachePages[victim].pack && cachePages[i].lastUsed < cachePages[victim].lastUsed) {
+        victim = i;
+      }
+    }
+
+    stats.misses++;
+    uint8_t* memory = cacheMemory + victim * CACHE_PAGE_SIZE;
+    if (!readPage(page, memory)) {
+      LOG_ERR("EFP", "Failed to read bitmap page %u of %s\n", page, path.c_str());
+      stats.readErrors++;
+      cachePages[victim].pack = nullptr;
+      return nullptr;
+    }
+    cachePages[victim] = {this, page, ++useCounter};
+    return memory;
+  };
+
+  const uint32_t start = glyph->dataOffset;
+  const uint32_t end = start + glyph->dataLength;
+  const uint32_t firstPage = start / CACHE_PAGE_SIZE;
+  if ((end - 1) / CACHE_PAGE_SIZE == firstPage) {
+    const uint8_t* page = getPage(firstPage);
+    return page ? page + start % CACHE_PAGE_SIZE : nullptr;
+  }
+
+  if (spanBufferSize < glyph->dataLength) {
+    delete[] spanBuffer;
+    spanBufferSize = 0;
+    spanBuffer = new (std::nothrow) uint8_t[maxGlyphBytes];
+    if (!spanBuffer) {
+      return nullptr;
+    }
+    spanBufferSize = maxGlyphBytes;
+  }
+  for (uint32_t offset = start; offset < end;) {
+    const uint8_t* page = getPage(offset / CACHE_PAGE_SIZE);
+    if (!page) {
+      return nullptr;
+    }
+    const uint32_t inPage = offset % CACHE_PAGE_SIZE;
+    const uint32_t length = std::min<uint32_t>(CACHE_PAGE_SIZE - inPage, end - offset);
+    memcpy(spanBuffer + (offset - start), page + inPage, length);
+    offset += length;
+  }
+  return spanBuffer;
+}
+
+EpdFontPack::CacheStats EpdFontPack::getCacheStats() {
+  Lock lock;
+  return stats;
+}
+
+void EpdFontPack::resetCacheStats() {
+  Lock lock;
+  stats = {};
+}
+
+void EpdFontPack::releaseAll() {
+  Lock lock;
+  for (auto* pack : residentPacks) {
+    if (pack) {
+      pack->unload();
+    }
+  }
+  closeOpenFile();
+  delete[] cacheMemory;
+  delete[] spanBuffer;
+  cacheMemory = nullptr;
+  spanBuffer = nullptr;
+  spanBufferSize = 0;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "EpdFontData.h"
+
+// A font read from a pack file on the SD card instead of being compiled into flash, written by
+// `fontconvert.py --pack`. The header is read by begin() and stays resident, the interval table and glyph metrics are
+// loaded on first use and the glyph bitmaps are paged in through a small LRU cache shared by all packs.
+//
+// File layout, little endian:
+//   Header        magic "EPFP", version, is2Bit, advanceY, isRle, ascender (i16), descender (i16),
+//                 intervalCount, glyphCount, bitmapSize (u32), maxGlyphBytes (u16), reserved (u16)
+//   Intervals     intervalCount x {first, last, offset} (u32)
+//   Glyphs        glyphCount x {width, height, advanceX, reserved (u8), left, top (i16), dataLength (u16),
+//                 dataOffset (u32)}
+//   Bitmaps       bitmapSize bytes, dataOffset is relative to the start of this section. Run-length encoded if isRle,
+//                 see EpdGlyphRle.h
+//
+// Only the metrics of MAX_RESIDENT_PACKS packs are kept, the least recently used pack is unloaded to make room. Glyph
+// and bitmap pointers are therefore only valid until the next call into another pack. The cache is shared by every
+// task measuring or drawing text, e.g. section builds on the render task and book ingest on the main loop, so callers
+// holding glyph pointers across calls do so under a Lock.
+class EpdFontPack {
+ public:
+  static constexpr char MAGIC[4] = {'E', 'P', 'F', 'P'};
+  static constexpr uint8_t VERSION = 1;
+  // One reader font family, all four styles
+  static constexpr size_t MAX_RESIDENT_PACKS = 4;
+  // Bitmap pages shared by all packs. A page of body text in one family touches roughly 10-20 pages after warm-up.
+  static constexpr size_t CACHE_PAGE_SIZE = 512;
+  static constexpr size_t CACHE_PAGE_COUNT = 32;
+
+  struct CacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t readErrors;
+    // Interval table and glyph metrics loads, a steady reader session loads each pack once
+    uint32_t metricLoads;
+
+    // Share of bitmap page lookups served from RAM, 0-100
+    uint8_t getHitPercent() const;
+  };
+
+  // Keeps other tasks out of the packs and the bitmap cache, glyph and bitmap pointers stay valid while it is held.
+  // Recursive, the pack functions take it themselves. Does nothing when not engaged, so built-in fonts skip the mutex.
+  class Lock {
+   public:
+    explicit Lock(bool engaged = true);
+    ~Lock();
+    Lock(const Lock&) = delete;
+    Lock& operator=(const Lock&) = delete;
+
+   private:
+    bool engaged;
+  };
+
+  explicit EpdFontPack(std::string path) : path(std::move(path)) {}
+  ~EpdFontPack();
+
+  EpdFontPack(const EpdFontPack&) = delete;
+  EpdFontPack& operator=(const EpdFontPack&) = delete;
+
+  // Reads and validates the header, false if the file is missing or not a supported pack
+  bool begin();
+  const std::string& getPath() const { return path; }
+
+  // Font data with the glyph metrics loaded, bitmap is always null. Line metrics are valid even if loading fails, the
+  // glyph table is then empty.
+  const EpdFontData* getData();
+  // Bitmap of one of this pack's glyphs, nullptr if it could not be read. Valid until the next call into any pack.
+  const uint8_t* getGlyphBitmap(const EpdGlyph* glyph);
+
+  // Totals over all packs since boot
+  static CacheStats getCacheStats();
+  static void resetCacheStats();
+  // Frees every pack's metrics and the bitmap cache, e.g. before a memory hungry activity
+  static void releaseAll();
+
+ private:
+  std::string path;
+  bool valid = false;
+  uint32_t bitmapStart = 0;
+  uint32_t bitmapSize = 0;
+  uint16_t maxGlyphBytes = 0;
+  uint32_t glyphCount = 0;
+  uint32_t intervalCount = 0;
+  EpdFontData data = {};
+  EpdUnicodeInterval* intervals = nullptr;
+  EpdGlyph* glyphs = nullptr;
+  uint32_t lastUsed = 0;
+
+  bool isLoaded() const { return glyphs != nullptr; }
+  bool load();
+  void unload();
+  bool readPage(uint32_t page, uint8_t* out);
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+// Run-length encoded 2-bit glyph bitmaps, written by `fontconvert.py --2bit --rle` and flagged by EpdFontData::isRle.
+// The pixels of a glyph are read row by row as one stream, runs continue across row ends. Each nibble is one run,
+// high nibble first:
+//   0LLL  L + 1 white pixels (1-8)
+//   10VV  one pixel of value VV, 1 light gray or 2 dark gray
+//   11LL  L + 1 black pixels (1-4)
+// Values are the font's 2-bit values, 0 white to 3 black. An odd number of runs is padded with a white nibble.
+namespace glyphrle {
+
+// Calls onRun(value, x, y, length) for every run of non-white pixels, split at row ends so each call is one horizontal
+// span of the glyph. White runs only move the position.
+template <typename OnRun>
+void forEachRun(const uint8_t* data, const uint16_t dataLength, const uint8_t width, const uint8_t height,
+                OnRun&& onRun) {
+  int x = 0;
+  int y = 0;
+  for (uint32_t i = 0; i < dataLength * 2u && y < height; i++) {
+    const uint8_t nibble = i % 2 == 0 ? data[i / 2] >> 4 : data[i / 2] & 0xF;
+    uint8_t value;
+    int length;
+    if ((nibble & 0x8) == 0) {
+      value = 0;
+      length = (nibble & 0x7) + 1;
+    } else if (nibble & 0x4) {
+      value = 3;
+      length = (nibble & 0x3) + 1;
+    } else {
+      value = nibble & 0x3;
+      length = 1;
+    }
+
+    while (length > 0 && y < height) {
+      const int span = length < width - x ? length : width - x;
+      if (value != 0) {
+        onRun(value, x, y, span);
+      }
+      length -= span;
+      x += span;
+      if (x == width) {
+        x = 0;
+        y++;
+      }
+    }
+  }
+}
+
+}  // namespace glyphrle
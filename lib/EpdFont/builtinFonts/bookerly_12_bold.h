@@ -2,3615 +2,2742 @@
  * generated by fontconvert.py
  * name: bookerly_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_boldBitmaps[46764] = {
-    0x0A, 0x83, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x43, 0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
-    0x03, 0xF0, 0x2F, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0, 0x50, 0x7E, 0x1F,
-    0x7F, 0x8F, 0xDF, 0xD3, 0xF3, 0xF4, 0xFC, 0xFD, 0x3F, 0x2F, 0x0F, 0xCB, 0xC3, 0xF2, 0xE0, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xD0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x05, 0xBE, 0x5F, 0xD4, 0x1F, 0xFF, 0xFF, 0xFC, 0x1A, 0xFE, 0xBF, 0xE8, 0x00,
-    0xF8, 0x2F, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xD0, 0xFC, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x0F,
-    0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x7E, 0x40, 0x01, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0xFC, 0xF1, 0xF8, 0x7D, 0x3C,
-    0x3D, 0x1F, 0x8F, 0x05, 0x07, 0xFB, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x80, 0xF3, 0xFC, 0xF4, 0x3C, 0x7F, 0x3E, 0x0E, 0x1F, 0x8F, 0xE7,
-    0x9F, 0xC2, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x1E, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xDB, 0xE0, 0x07, 0xD0, 0x00,
-    0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x3F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x0F, 0x80,
-    0x00, 0x3F, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0xFC, 0x0F, 0xC3, 0xD0, 0x00, 0x02, 0xF4, 0x7E, 0x2F,
-    0x0B, 0xFD, 0x03, 0xFF, 0xF0, 0xF4, 0xFE, 0xFD, 0x02, 0xFE, 0x0F, 0x87, 0xD0, 0xFC, 0x00, 0x00,
-    0x7C, 0x2F, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0xFC, 0x0B, 0xC0, 0x00, 0x2F, 0x03, 0xF0, 0x2F, 0x00,
-    0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xC0, 0x2F, 0x43, 0xE0, 0x00, 0x7D, 0x00, 0x3F, 0xBF,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x3D, 0x00, 0x00, 0x00, 0xFE, 0x20, 0x00, 0x00, 0x02,
-    0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0xC1, 0xFF, 0xF0, 0x2F, 0xCF, 0xE0, 0x3F, 0x00, 0x3F, 0x47,
-    0xF8, 0x2F, 0x00, 0x3F, 0x02, 0xFE, 0x2F, 0x00, 0x3F, 0x40, 0xBF, 0xFF, 0x00, 0x3F, 0x80, 0x2F,
-    0xFE, 0x00, 0x2F, 0xE0, 0x0F, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x5F,
-    0xFC, 0x00, 0x05, 0x50, 0x00, 0x50, 0x7E, 0xFE, 0xFD, 0xFD, 0xFD, 0xBC, 0xBC, 0xB8, 0x00, 0x00,
-    0x28, 0x00, 0xBD, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x7E,
-    0x00, 0xBE, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x3F, 0x40, 0x2F, 0x80, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3C, 0x00,
-    0x00, 0x1C, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F,
-    0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x0F, 0xD0, 0x07, 0xF0,
-    0x03, 0xF4, 0x03, 0xF4, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x47, 0xC0, 0x3D,
-    0x7C, 0x03, 0xFB, 0x44, 0x0B, 0xFF, 0xC1, 0xBF, 0xFC, 0x3F, 0xB4, 0x42, 0xC7, 0xC0, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x6A,
-    0xFE, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xFE, 0xA8, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3F, 0xC0, 0xBF, 0x01, 0xFC, 0x0B, 0xD0,
-    0x3F, 0x02, 0xF4, 0x0F, 0x40, 0x24, 0x00, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x19, 0x1F,
-    0xEB, 0xFD, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xF8, 0x01, 0xFF, 0x6F, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x7F, 0x40, 0x2F, 0xD3, 0xFC, 0x00, 0x7F,
-    0x8F, 0xF0, 0x01, 0xFE, 0x3F, 0xC0, 0x03, 0xFC, 0xFE, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x3F, 0x8F,
-    0xF0, 0x01, 0xFE, 0x3F, 0xC0, 0x07, 0xF4, 0xFF, 0x00, 0x3F, 0xC1, 0xFE, 0x01, 0xFE, 0x03, 0xFE,
-    0x6F, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xA4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x1F, 0xFF, 0xFD, 0x03, 0xFE,
-    0x6F, 0xF0, 0x7F, 0x40, 0xFF, 0x47, 0xF0, 0x0B, 0xF4, 0x3F, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x00, 0x01, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC,
-    0x3E, 0x00, 0xBF, 0x07, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xBF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x40, 0x1E, 0x6F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x05, 0xBF, 0xF4, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x03, 0xF4, 0xBF, 0x00, 0x0B, 0xE0, 0xBF, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x3F, 0xAA, 0xFF,
-    0xA8, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0xBF, 0x54, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x01, 0x5B, 0xFF, 0x80, 0x00, 0x1F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x05, 0xBF,
-    0xF0, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFE, 0x40, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFE, 0xBF, 0xF0, 0xBF, 0x40,
-    0xBF, 0x8B, 0xF4, 0x03, 0xFC, 0x7F, 0x40, 0x3F, 0xC7, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x82,
-    0xFF, 0x9F, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x3F, 0x43,
-    0xD0, 0x0F, 0xE0, 0x18, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x01, 0xFE, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF8, 0x2F, 0xD0, 0xBF, 0x00, 0xFF, 0xAF, 0xD0, 0x07, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xEB, 0xFF, 0x03, 0xF8, 0x0F, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0,
-    0x03, 0xFC, 0xBF, 0x40, 0x3F, 0xC3, 0xFD, 0x5F, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x02, 0xFE,
-    0x6F, 0xF0, 0x3F, 0x80, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0x7F, 0x40, 0x3F, 0xC7, 0xF8, 0x03, 0xFC,
-    0x3F, 0xC0, 0x2F, 0xC2, 0xFF, 0x9B, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x03,
-    0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0x6F, 0xFB, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x47, 0xFA, 0xFF, 0x7F, 0x81, 0x40, 0x0B, 0xD0, 0x7F, 0xC1, 0xFF, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x02, 0xFC, 0x07, 0xF0,
-    0x2F, 0x40, 0xFC, 0x0B, 0xD0, 0x3D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC,
-    0x00, 0xBF, 0xD0, 0x1F, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x24, 0x1F, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xF0, 0x2F, 0xFF, 0x40, 0xFF, 0xF4, 0x03, 0xFD, 0x00,
-    0x0B, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xF9, 0x55, 0xBF, 0xD0, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0x0B, 0xE0,
-    0x3F, 0xFF, 0x00, 0xBD, 0x3F, 0x02, 0xF0, 0xBD, 0x01, 0xF5, 0xFC, 0x07, 0x81, 0xF8, 0x07, 0xEB,
-    0xE0, 0x00, 0x07, 0xE0, 0x1F, 0xAF, 0x40, 0x0B, 0xFF, 0x80, 0xBD, 0xFD, 0x01, 0xFD, 0xBE, 0x03,
-    0xF2, 0xF4, 0x0F, 0xC1, 0xF8, 0x0F, 0x8B, 0xE0, 0x3F, 0x4B, 0xF5, 0xFC, 0x1F, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0xBF, 0x4B, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xEA, 0xAF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x05, 0x6A, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x07,
-    0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1B,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFD, 0x6F, 0xF8, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC,
-    0x2F, 0xD0, 0x03, 0xF0, 0xFF, 0x00, 0x0B, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x01, 0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF, 0xF0, 0x03, 0xFC, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8,
-    0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC,
-    0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x53,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0x03, 0xFC, 0x02, 0xF0, 0x3F, 0xC0,
-    0x1D, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xAA, 0x80, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF4, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0xBD,
-    0x0F, 0xF0, 0x00, 0x1F, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x01, 0x55, 0x4F, 0xF0, 0x03, 0xFF, 0xF7, 0xFD, 0x00, 0x7F, 0xFC, 0xBF, 0x80,
-    0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x3F, 0xC3, 0xFF, 0x40, 0x0F, 0xF0, 0x7F, 0xFE, 0xAF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x15, 0x40, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE0, 0x15, 0x55, 0x43, 0xFF, 0xFD,
-    0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x01, 0x55, 0x54, 0x07, 0xFF, 0xFD, 0x03, 0xFF,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF,
-    0x00, 0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x00, 0xFF, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x2F, 0xFF, 0xC0, 0x7F,
-    0xF8, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x55, 0x40, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03,
-    0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x01, 0x55, 0x40, 0x01, 0x55, 0x50, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07,
-    0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF,
-    0x00, 0x01, 0xFB, 0xF4, 0x1F, 0xBF, 0x40, 0x01, 0xF7, 0xF8, 0x2F, 0x3F, 0x40, 0x02, 0xF6, 0xFC,
-    0x3E, 0x3F, 0x40, 0x02, 0xF1, 0xFC, 0x3D, 0x3F, 0x80, 0x02, 0xF0, 0xFD, 0x7C, 0x3F, 0x80, 0x03,
-    0xF0, 0xBF, 0xF8, 0x3F, 0xC0, 0x03, 0xF0, 0x7F, 0xF4, 0x3F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x2F,
-    0xC0, 0x03, 0xF0, 0x2F, 0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x07, 0xE0, 0x0F,
-    0xC0, 0x2F, 0xD0, 0x3F, 0xFE, 0x06, 0x40, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x15,
-    0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x0F,
-    0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x3F,
-    0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF, 0xF4, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07, 0xF0, 0x00, 0xFC,
-    0x3F, 0xF1, 0xFC, 0x00, 0x3F, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF, 0xC0, 0x03, 0xF0,
-    0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xC0,
-    0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80,
-    0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD,
-    0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00,
-    0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xF4, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFE, 0x01, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x02, 0xFF, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF,
-    0x4F, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF,
-    0x40, 0x02, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x96, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x6F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x6F,
-    0xA4, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0xFC, 0x7F, 0x40, 0x3F, 0x1F, 0xE0,
-    0x0B, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x28, 0x00, 0xFF, 0x6F, 0x00, 0x1F, 0xDB, 0xD0, 0x0B, 0xF2, 0xFE,
-    0x07, 0xF8, 0xBF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x15, 0x50, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03,
-    0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x40,
-    0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x54, 0xBF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0xFF, 0x40, 0xBF, 0xF4, 0x0F, 0xFC, 0x00, 0x1F, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0x3F,
-    0xC3, 0xF4, 0x00, 0x00, 0x2F, 0xD3, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x55, 0x54, 0x7F, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x7F, 0xF8,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFD,
-    0x02, 0xFF, 0xC0, 0x2F, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x01, 0xFF, 0x03, 0xFF,
-    0xE0, 0x3F, 0x00, 0x00, 0xFF, 0x07, 0xEF, 0xF0, 0x7E, 0x00, 0x00, 0xBF, 0x4B, 0xCB, 0xF0, 0xBD,
-    0x00, 0x00, 0x7F, 0x8F, 0xC7, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0x83, 0xFC, 0xF8, 0x00, 0x00,
-    0x2F, 0xDF, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0xFF,
-    0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF8, 0x00, 0x03, 0xF8,
-    0x1F, 0xF4, 0x00, 0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x07, 0xFF,
-    0xFE, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x15, 0x55, 0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F,
-    0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0, 0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F,
-    0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x05, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xD0, 0x0F, 0xF8, 0x3E, 0x00, 0xBF, 0xC0, 0x74, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x70, 0x3F, 0xE0, 0x03, 0xE2, 0xFF, 0x00, 0x1F, 0x8F,
-    0xFA, 0xAA, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xA1, 0xFF, 0xD7, 0xFA, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8,
-    0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
-    0x1F, 0x80, 0x7E, 0x01, 0xFD, 0x47, 0xFF, 0x5F, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0xAF, 0xFF, 0x6B, 0xF0, 0x7F,
-    0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
-    0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF1, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0xFC,
-    0x7D, 0x00, 0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0, 0x0F, 0xC0, 0x7E, 0x07, 0xD0, 0x0F, 0xC3, 0xF0,
-    0x02, 0xF4, 0xA4, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x18,
-    0x03, 0xD0, 0x3F, 0x41, 0xFC, 0x07, 0xE0, 0x08, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x15, 0x00, 0x03, 0xFD, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xAF, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02,
-    0xFE, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x03, 0xFD, 0x1F, 0xF4, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F, 0xD0,
-    0x7F, 0x0F, 0xF0, 0x0E, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xFA, 0xAC, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x05, 0x6F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x2F, 0xD0, 0x1F, 0xD0, 0x2F, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x3F, 0xE0, 0x2F, 0xD0, 0x2F, 0xFA, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x8F, 0xFD, 0x00, 0x14, 0x01, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE,
-    0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF,
-    0x40, 0xBF, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFC, 0x07, 0xF8, 0x7E, 0x02, 0xFC, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xF4, 0x16, 0xFF, 0x54, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x40, 0x50, 0x07, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x83, 0xF8, 0x1F, 0xC4, 0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFE, 0x00, 0xFD,
-    0x03, 0xF4, 0x02, 0xFE, 0xBF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF5, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAA, 0xFF,
-    0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0x40, 0x1F, 0xE0, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x01, 0x50,
-    0x00, 0x2F, 0xDB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEF, 0xFC, 0x00, 0xBF, 0x80,
-    0xBF, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xBF,
-    0x40, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x02,
-    0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0, 0x2F,
-    0xE0, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F,
-    0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
-    0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x04, 0x00, 0x2F, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0xFC, 0x0F, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x7F, 0xE0, 0x7F, 0xF0, 0x0B, 0x90, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xF8,
-    0x0B, 0xF0, 0x7F, 0xF4, 0x0B, 0xF0, 0x3F, 0x80, 0x0B, 0xF0, 0xFE, 0x00, 0x0B, 0xF2, 0xF8, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x0B, 0xF2, 0xFD, 0x00, 0x0B, 0xF0, 0xFF, 0x00,
-    0x0B, 0xF0, 0x7F, 0xC0, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xFD, 0x0F, 0xFC, 0x7F, 0xFE, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x1B, 0xFD, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x0B, 0xF4, 0x02,
-    0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B,
-    0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xF2, 0xFF,
-    0xFC, 0x00, 0x50, 0x15, 0x00, 0x15, 0x00, 0x0B, 0xFC, 0xBF, 0xF4, 0x7F, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xFE, 0xBF, 0xD0, 0x07, 0xF8, 0x0B, 0xFC, 0x0B, 0xF8,
-    0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x1F, 0xE0, 0x1F,
-    0xE0, 0x1F, 0xE0, 0x07, 0xF8, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE, 0x00,
-    0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x1F, 0xE0, 0x1F, 0xE0, 0x1F, 0xE0, 0x2F, 0xFE, 0x1F, 0xFE,
-    0x1F, 0xFF, 0x0F, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0xD0, 0x00, 0x50, 0x15, 0x00, 0x0B, 0xFC, 0xBF,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xE0, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFE,
-    0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01,
-    0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x2F, 0xFE, 0x0F, 0xFF,
-    0x4F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC,
-    0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F,
-    0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE,
-    0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x40,
-    0x14, 0x01, 0xFF, 0x9F, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAF, 0xFC, 0x0B, 0xF4, 0x0F,
-    0xF4, 0x2F, 0xC0, 0x2F, 0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC, 0x01, 0xFE, 0x0B, 0xF0, 0x07, 0xF8,
-    0x2F, 0xC0, 0x1F, 0xD0, 0xBF, 0x00, 0xFF, 0x02, 0xFE, 0x5B, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xF4, 0x00, 0xBF, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x1A, 0xAA, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43,
-    0xFC, 0x02, 0xFD, 0x0F, 0xF0, 0x0B, 0xF4, 0x3F, 0xC0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xFE,
-    0x03, 0xFD, 0x07, 0xFF, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFE, 0xBF, 0x40, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0xAA, 0xA9, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF, 0xF7, 0xFD, 0x1B, 0xFF, 0xFC,
-    0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07,
-    0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x00, 0x55,
-    0x00, 0x1F, 0xFF, 0x82, 0xFE, 0xFF, 0x0F, 0xC0, 0x7D, 0x7F, 0x00, 0xF1, 0xFF, 0x80, 0x03, 0xFF,
-    0xF4, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x40, 0x7F, 0xEB, 0x80, 0x3F, 0xBF, 0x40, 0xFD, 0xBF,
-    0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0, 0x01, 0x50, 0x14, 0x00, 0x7F, 0xFF,
-    0x0F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xF0, 0x0F, 0xC0, 0x03,
-    0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x07, 0xD0, 0xBF, 0xF0,
-    0xFF, 0xF4, 0x2F, 0x81, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC, 0x07, 0xFC, 0x07,
-    0xD0, 0x03, 0xF8, 0x2F, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0xFC, 0x00, 0x2F, 0xC3, 0xDF,
-    0xC7, 0xD0, 0x00, 0x3F, 0x6E, 0x3F, 0x2F, 0x00, 0x00, 0xFE, 0xF4, 0xBD, 0xF8, 0x00, 0x01, 0xFF,
-    0xC1, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x0B, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x3F,
-    0xF8, 0x1F, 0xF4, 0x07, 0xFC, 0x1F, 0xC0, 0x02, 0xFE, 0x3F, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBE, 0xFE, 0x00, 0x02,
-    0xF8, 0xBF, 0x40, 0x0B, 0xF0, 0x3F, 0xD0, 0x3F, 0xF4, 0x7F, 0xFC, 0xBF, 0xF8, 0xFF, 0xFC, 0x7F,
-    0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0,
-    0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD,
-    0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xF5, 0x7F, 0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03,
-    0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0xFF, 0xD0, 0xBF, 0x50, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0x80,
-    0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00,
-    0x3F, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x3F, 0x80,
-    0x1F, 0xFC, 0x01, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0x40, 0x2F, 0x40,
-    0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFE, 0x07,
-    0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x01, 0x07, 0xFF, 0x42, 0xE3, 0xFF, 0xFE,
-    0xF8, 0xF4, 0x7F, 0xFC, 0x1C, 0x02, 0xF8, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xD2, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0xFE,
-    0x1F, 0xE1, 0xFD, 0x2F, 0xC1, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE,
-    0x1F, 0xD7, 0x4F, 0xCF, 0xD2, 0xD2, 0xD3, 0xF0, 0xB4, 0x11, 0xFC, 0x2C, 0x00, 0x7F, 0x0B, 0x00,
-    0x1F, 0xC2, 0xC0, 0x07, 0xF0, 0xB0, 0x00, 0xFE, 0x3C, 0x00, 0x3F, 0xEF, 0x5B, 0x83, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0xBF, 0x00, 0x3F, 0x40, 0xFC, 0x01, 0xFC, 0x03, 0xC0, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x05, 0xFF, 0x55, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xAF, 0xFA,
-    0x90, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0A, 0xFE, 0xAA, 0xBD, 0x3F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x90, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x50, 0x38, 0xBE, 0xBF, 0xEF, 0xC1, 0xFF, 0xFF, 0xF0, 0x0B, 0xE1,
-    0xFD, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0xD0, 0xFD, 0x01,
-    0xFF, 0xFF, 0xF0, 0xBE, 0xFF, 0xEF, 0xC3, 0x81, 0x50, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC1, 0xFF, 0xF3, 0xFF, 0xE0, 0x7F, 0xF4, 0x2F, 0xE0, 0x03, 0xF0, 0x03,
-    0xFC, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0F, 0xF0, 0x7D, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x03, 0xFF, 0xDF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xAF, 0xFA,
-    0xE0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0x69, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x1F, 0x40,
-    0x7C, 0x2F, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x3D, 0xFF, 0x00, 0x3C, 0x7F, 0xE0, 0x3E, 0x0B, 0xF8,
-    0x1F, 0x80, 0xFD, 0x0B, 0xF4, 0x2E, 0x02, 0xFF, 0x0F, 0x00, 0x7F, 0xCF, 0x00, 0x0B, 0xFF, 0x09,
-    0x00, 0xFE, 0x3F, 0x00, 0xBC, 0x3F, 0x40, 0xF8, 0x2F, 0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x3F, 0x8F, 0xF3, 0xF4, 0xBE, 0x04, 0x01, 0x40, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01,
-    0xE0, 0x0F, 0x00, 0xAA, 0x41, 0xD0, 0x74, 0x1F, 0xFF, 0x02, 0xC3, 0xC0, 0xF4, 0x3C, 0x07, 0x4E,
-    0x0B, 0xC0, 0x90, 0x0E, 0x34, 0x3E, 0x00, 0x00, 0x38, 0xD0, 0xF8, 0x00, 0x00, 0xF3, 0x43, 0xE0,
-    0x00, 0x03, 0x8E, 0x0B, 0xC0, 0x00, 0x0E, 0x2C, 0x1F, 0xEA, 0xC0, 0x74, 0x74, 0x1F, 0xFE, 0x03,
-    0xC0, 0xF0, 0x05, 0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0xE0, 0x0F, 0xFF, 0x07, 0xC3, 0xC0,
-    0x00, 0xF4, 0x1B, 0xFD, 0x1F, 0x5F, 0x4B, 0x83, 0xD2, 0xFF, 0xFF, 0x2F, 0x8F, 0x40, 0x00, 0x02,
-    0xAA, 0xB6, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3D, 0x02, 0xF8,
-    0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0x3F, 0xC2, 0xFD, 0x03, 0xF4, 0x3F, 0x80, 0x3F, 0xC2, 0xFC, 0x00,
-    0xFE, 0x0B, 0xF0, 0x03, 0xF8, 0x2F, 0xC0, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0xA8, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x14, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x07, 0x80, 0x1F, 0x00, 0xD5, 0x50, 0x38, 0x28, 0xBE, 0xD0, 0xC3, 0x43, 0x8F, 0x0E, 0x30,
-    0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x3A, 0xD0, 0xA3, 0x87, 0xDF, 0x4D, 0x1C, 0x54, 0x26,
-    0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFF, 0xAF, 0xFF, 0xE1,
-    0x55, 0x50, 0x00, 0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xD0, 0xFC, 0xFC, 0x0B, 0xCF, 0x80,
-    0xBC, 0xBD, 0x0F, 0xC7, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x15, 0x00, 0x00, 0x68, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x55, 0xBD, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x14, 0x00, 0x15,
-    0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x94, 0x02, 0xFF, 0xF0,
-    0x7F, 0xBF, 0x8B, 0xC1, 0xF8, 0x28, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F,
-    0xC0, 0x07, 0xFA, 0xA8, 0xBF, 0xFF, 0xC2, 0xAA, 0xA4, 0x01, 0x94, 0x0B, 0xFF, 0xC7, 0xE7, 0xF4,
-    0xD0, 0xBD, 0x00, 0x7F, 0x01, 0xFF, 0x00, 0xBF, 0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x80, 0x6F, 0xDB,
-    0xFF, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xE2, 0xF5, 0xFC, 0xBC, 0x08, 0x00, 0x00,
-    0x40, 0x00, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xF6, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xEB, 0xFE, 0x7F, 0xFF, 0x83, 0xFC, 0x7F, 0x14, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x0B, 0xFF, 0xD7, 0xC0, 0x3F, 0xFF,
-    0x5F, 0x01, 0xFF, 0xFD, 0x7C, 0x0B, 0xFF, 0xF5, 0xF0, 0x2F, 0xFF, 0xD7, 0xC0, 0x7F, 0xFF, 0x5F,
-    0x00, 0xFF, 0xFD, 0x7C, 0x01, 0xFF, 0xF5, 0xF0, 0x01, 0xFB, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xE0, 0x00, 0x03, 0xC6, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x2F, 0x2F, 0xFB, 0xFC, 0xFD, 0x00, 0x00, 0x2E, 0x2F, 0xE0, 0xFC, 0x3D, 0x7E, 0x09,
-    0x00, 0x00, 0x10, 0x01, 0xFD, 0x03, 0xFF, 0x40, 0x6F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F,
-    0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x03, 0xFF, 0xF4, 0xAA, 0xA8, 0x06, 0xF8, 0x0B, 0xFF,
-    0xC7, 0xC1, 0xFB, 0xE0, 0x3F, 0xF8, 0x0B, 0xFF, 0x02, 0xFB, 0xC0, 0xF4, 0xFF, 0xFC, 0x0B, 0xF8,
-    0x00, 0x00, 0x01, 0xAA, 0xB0, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xF0,
-    0x07, 0xF0, 0x3F, 0x40, 0xBF, 0x07, 0xF4, 0x0B, 0xF4, 0x7F, 0x80, 0xFE, 0x0B, 0xF0, 0xBF, 0x47,
-    0xF8, 0x7F, 0x43, 0xF8, 0x3F, 0x03, 0xF4, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF4,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x07, 0xC0, 0x1F, 0xD0, 0x02,
-    0xF4, 0x00, 0xF8, 0x03, 0xFD, 0x02, 0xFF, 0xF4, 0x1F, 0x00, 0xFB, 0xD0, 0x3F, 0xFF, 0x43, 0xE0,
-    0x2F, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x3D, 0x00,
-    0x00, 0x03, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0xFD, 0x00,
-    0xBD, 0x00, 0x3D, 0x1F, 0xFF, 0xC0, 0x2F, 0x40, 0x2F, 0x0F, 0xC3, 0xF4, 0xBF, 0xFD, 0x0F, 0x42,
-    0xE0, 0xBD, 0x3F, 0xFF, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x7F,
-    0x55, 0x40, 0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB,
-    0xF4, 0x00, 0x1F, 0x40, 0x00, 0x74, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x01,
-    0x2F, 0x80, 0x3E, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0xF4,
-    0x03, 0xFD, 0x07, 0xFF, 0xE0, 0x2F, 0x00, 0xFB, 0xD0, 0x7F, 0xF4, 0x07, 0xD0, 0x2F, 0x3D, 0x00,
-    0x50, 0x00, 0xF8, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0xFF, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0xF0, 0x01, 0xBF, 0x00, 0xFF, 0xF0, 0x3F, 0xFE, 0x0B,
-    0xF9, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x18, 0x1F, 0xFF, 0xD0, 0xBF,
-    0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0,
-    0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07,
-    0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F,
-    0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0,
-    0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00,
-    0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0,
-    0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x40,
-    0x40, 0x00, 0x00, 0x1F, 0xF2, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2C, 0x3F, 0xC0,
-    0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00,
-    0x7F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0,
-    0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00,
-    0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0,
-    0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x0F, 0x07, 0x80,
-    0x00, 0x00, 0x0F, 0x8B, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0x05, 0xFC, 0x00, 0x00, 0x3F, 0x7F, 0xC0, 0x2F, 0x00, 0x00, 0x1F, 0x8F, 0xF0, 0x02, 0x00,
-    0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0xFF, 0xF4, 0x00, 0x02, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFE, 0xAA, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x05, 0x00, 0x3F, 0x00, 0x0F, 0xF0,
-    0x03, 0xD0, 0x2F, 0x80, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xD0, 0x01, 0xFF, 0xAA, 0xFD, 0x2F, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFE, 0x40, 0x02,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0x00, 0xFC, 0x2F, 0xD0, 0x03, 0xF0, 0xFF, 0x00,
-    0x0B, 0x87, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x80, 0x01, 0x47, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA,
-    0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00,
-    0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00,
-    0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x02, 0xFD, 0x3F,
-    0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00,
-    0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x03, 0xFE,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x00, 0xBD, 0xFC, 0x2F, 0x03, 0xE2,
-    0x80, 0x08, 0x00, 0x00, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x7D, 0x7F, 0x4F, 0xF7, 0xF4, 0xFE, 0x14, 0x01, 0x40, 0x00,
-    0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x05, 0x6A,
-    0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF,
-    0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x03, 0xFD, 0x6B, 0xFE, 0xA4, 0x0F, 0xF5, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x3C, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x38, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x51, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFC, 0x2F, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0xFD,
-    0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFF, 0xF8, 0x07, 0xF0, 0x00, 0xFD, 0xFF,
-    0x41, 0xFC, 0x00, 0x3F, 0x2F, 0xF0, 0x7F, 0x00, 0x0F, 0xC3, 0xFF, 0x1F, 0xC0, 0x03, 0xF0, 0x3F,
-    0xE7, 0xF0, 0x00, 0xFC, 0x0B, 0xFD, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x03, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xF0, 0x03,
-    0xFF, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80,
-    0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03,
-    0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF,
-    0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFA, 0xF8, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x07, 0x80,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00,
-    0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF,
-    0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03,
-    0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
-    0x00, 0x03, 0xFD, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0x8B, 0xF4, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00,
-    0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF,
-    0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00,
-    0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00,
-    0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC,
-    0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0,
-    0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0xB8, 0x03, 0xD3, 0xF8, 0x3F, 0x83, 0xFB, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F,
-    0xF8, 0x03, 0xFB, 0xF8, 0x3F, 0x83, 0xF8, 0xF8, 0x03, 0xD0, 0x80, 0x05, 0x00, 0x00, 0x01, 0xBF,
-    0x90, 0x20, 0x00, 0x2F, 0xFF, 0xFD, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x01, 0xFF,
-    0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0xBF, 0xF0, 0x1F, 0xE0, 0x02, 0xFF, 0xF4,
-    0x2F, 0xD0, 0x0B, 0xCF, 0xF4, 0x3F, 0xD0, 0x2F, 0x0F, 0xF4, 0x3F, 0xD0, 0xBC, 0x0F, 0xF4, 0x3F,
-    0xD2, 0xF0, 0x0F, 0xF4, 0x3F, 0xEB, 0xC0, 0x0F, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x2F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0x96, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7C, 0x2F, 0xFF, 0xE0, 0x00, 0x10, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x2F, 0xC3, 0xF8,
-    0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F,
-    0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x50, 0x15, 0x54, 0xBF, 0xFF, 0x87, 0xFF, 0xE7, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0xFE,
-    0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x3F,
-    0xCF, 0xC0, 0x00, 0x02, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1F, 0xFC, 0x03, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8,
-    0x03, 0xFD, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x94, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFD, 0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF4, 0x03, 0xF4,
-    0x0B, 0xF0, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x0B, 0xF0, 0xBD, 0x00, 0x0B, 0xF0, 0xFC, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x0B, 0xF0, 0xFF, 0xC0, 0x0B, 0xF0, 0x7F, 0xF0, 0x0B, 0xF0, 0x1F, 0xFC,
-    0x0B, 0xF0, 0x03, 0xFE, 0x0B, 0xF0, 0x00, 0xFF, 0x0B, 0xF1, 0xC0, 0xFE, 0x0B, 0xF3, 0xE0, 0xFD,
-    0x7F, 0xF3, 0xFF, 0xFC, 0xBF, 0xF1, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F,
-    0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC,
-    0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07,
-    0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF,
-    0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3E, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0,
-    0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40,
-    0x14, 0x01, 0x40, 0x02, 0x80, 0x40, 0x00, 0xFF, 0x4F, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xE1, 0xFD,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x3F, 0x00, 0x2F, 0xC7, 0xF4, 0x02, 0xFC, 0x7F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0,
-    0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB,
-    0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0x83,
-    0xC0, 0x00, 0x78, 0x3C, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F,
-    0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF,
-    0x40, 0x14, 0x01, 0x40, 0x00, 0x15, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xD1, 0xFF, 0x82, 0xFD, 0x7F, 0x03, 0xFC, 0x03, 0xF8, 0x54, 0x0F, 0xE0, 0x1F,
-    0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xA9, 0x3F, 0xE7, 0xF8, 0x00, 0x02, 0xFC,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD5, 0xFF, 0xF9, 0xAE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0xBF, 0xF8, 0x2F, 0xFF, 0x40, 0x14, 0x00, 0x05, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xD3, 0xFC, 0x1F, 0xD0, 0x7F, 0x0F, 0xF0, 0x0E, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x7F, 0xFA, 0xAC, 0x0B, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE,
-    0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0xF4,
-    0x7C, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40,
-    0x7F, 0x4F, 0xE0, 0x0F, 0xC3, 0xF4, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE,
-    0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x08, 0x00,
-    0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x24,
-    0x00, 0x0F, 0x40, 0x0F, 0xD0, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0xC0, 0x3D, 0xFC, 0x3E, 0x0F, 0x8F, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x1F, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0xBF, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xD1, 0xF8, 0xFF, 0x2F, 0xCF, 0xE2, 0xFC, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x7F, 0xF8, 0x00, 0xBF, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F,
-    0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x43, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x70, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x03, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0x47, 0xFE, 0x07, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0,
-    0xBF, 0x80, 0x7F, 0x41, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x0F, 0xF5, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x50,
-    0x00, 0xBF, 0xCB, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xEB, 0xFE, 0x00, 0x7F, 0x80,
-    0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F,
-    0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x02,
-    0xFF, 0xE0, 0xFF, 0xF4, 0xFF, 0xFC, 0x7F, 0xFD, 0x00, 0x20, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47,
-    0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF,
-    0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0xF8, 0x3E,
-    0x00, 0x03, 0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80,
-    0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x28, 0x04, 0x00, 0x03, 0xFC, 0x78, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x74, 0xBF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFF, 0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F,
-    0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD1, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x2F, 0xC0, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xD1, 0xFF, 0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0,
-    0x7F, 0xE1, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x6A, 0xAA,
-    0xA8, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xFA, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x03, 0xFC, 0x1F, 0xF4, 0x1F, 0xD0, 0x2F, 0xF0, 0xFF, 0x02, 0xFF, 0xC3, 0xFC, 0x2F, 0xFF,
-    0x0F, 0xF2, 0xF2, 0xFC, 0x3F, 0xEF, 0x0F, 0xF0, 0xFF, 0xF0, 0x3F, 0xC2, 0xFF, 0x00, 0xFE, 0x07,
-    0xFD, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0xF7, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x7D, 0x2F, 0x00,
-    0x00, 0x2D, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2F,
-    0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xD0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07,
-    0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40,
-    0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F,
-    0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x01, 0x40,
-    0x02, 0xFD, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0xFF, 0xC0, 0xBF, 0x40, 0xFF, 0x42,
-    0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x07, 0xF8, 0x2F, 0xC0, 0x1F, 0xE0, 0xBF, 0x00, 0x7F, 0x82, 0xFC,
-    0x01, 0xFD, 0x0B, 0xF0, 0x0F, 0xF0, 0x2F, 0xE5, 0xBF, 0x80, 0xBF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x01, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFE, 0x0B, 0xFE, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x7F, 0x80, 0x3F, 0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0x00,
-    0x3F, 0x83, 0xF0, 0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x08, 0x00,
-    0x40, 0x00, 0x00, 0x3E, 0x01, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x1F, 0xD6, 0xE0, 0x00,
-    0xBF, 0xFC, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00,
-    0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC,
-    0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F,
-    0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC,
-    0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF,
-    0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00,
-    0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F, 0x0B, 0xF4, 0x00, 0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51,
-    0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80,
-    0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC, 0x3F, 0xC0, 0x38, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0xBD, 0x0F, 0xC0, 0x01, 0xD0, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F,
-    0x0B, 0xF4, 0x00, 0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xF7, 0xD0, 0x01, 0xF4, 0xBC, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC,
-    0x3F, 0xC0, 0x38, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x0F, 0xC2, 0xFD, 0x00, 0x3F, 0x0F, 0xF0, 0x00, 0xB8, 0x7F, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x14,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x03, 0xFD, 0x3F, 0xC1,
-    0xFD, 0x07, 0xF0, 0xFF, 0x00, 0xE0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFF, 0xAA, 0xC0, 0xBF, 0xFF, 0xF0, 0x07, 0xFF, 0xF4,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x1F, 0xEF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x3F, 0x0B, 0xF4, 0x00,
-    0xFC, 0x3F, 0xC0, 0x02, 0xE1, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x51, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x40, 0x14, 0x00, 0xF4, 0x2F, 0x00, 0x3F, 0x1F, 0x40,
-    0x03, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0x4F, 0xF0, 0x7F, 0x41, 0xFC, 0x3F, 0xC0, 0x38,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xFF, 0xEA, 0xB0, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x1F, 0x00, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0,
-    0x6F, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF4, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xE6, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
-    0x1B, 0xFD, 0x2F, 0x00, 0x03, 0xFF, 0xD2, 0xF0, 0x00, 0x07, 0xFD, 0x3E, 0x00, 0x00, 0x2F, 0xD3,
-    0xC0, 0x00, 0x02, 0xFD, 0x38, 0x00, 0x05, 0x6F, 0xD1, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0x42, 0xFD, 0x00, 0x1F, 0xD0, 0x2F, 0xD0, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x02,
-    0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xD0, 0x02, 0xFF, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xF8, 0xFF, 0xD0, 0x00, 0x14, 0x01, 0x00, 0x00, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x01, 0xBF, 0xF0, 0x03, 0xFC, 0x00, 0x7F,
-    0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x6B,
-    0xFE, 0xA4, 0x0F, 0xF5, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8,
-    0x00, 0xFF, 0x9A, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0xD0, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x2B, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x1F, 0xE0, 0x2F, 0xD0,
-    0x2F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x3F, 0xE0, 0x2F, 0xD0, 0x2F, 0xFA, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0x8F, 0xFD, 0x00, 0x14, 0x01, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0,
-    0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00,
-    0x54, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0xF4, 0x0B, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC,
-    0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x03, 0x40, 0x3F, 0x9B, 0xC0, 0x07, 0xFF, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03,
-    0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03,
-    0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE,
-    0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x5F, 0x40, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x0B, 0x40, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xBE, 0xBC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00,
-    0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x40, 0x14, 0x00, 0xF4, 0x2F, 0x00, 0x2F, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F,
-    0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x0A,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xD0, 0x0F, 0xD0, 0xBF, 0x80, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7C,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x05,
-    0x55, 0x3F, 0xC0, 0x0F, 0xFF, 0xDF, 0xF4, 0x01, 0xFF, 0xF2, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xD0,
-    0x00, 0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC1, 0xFF, 0xFA, 0xBF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x14, 0x01, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0xFE, 0x07,
-    0xF1, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xBF, 0xAF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x00, 0x07, 0xEA, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x50, 0x03,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xAA, 0xBF, 0xC7, 0xF4, 0x00, 0xBF, 0x1F, 0xD0,
-    0x07, 0xF8, 0x3F, 0xFA, 0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x0F, 0x40, 0xB4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x3F, 0x42, 0xFE, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01,
-    0xF0, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x15, 0x54, 0xFF, 0x00, 0x3F, 0xFF, 0x7F, 0xD0, 0x07, 0xFF, 0xCB, 0xF8, 0x00, 0x0F, 0xF1, 0xFF,
-    0x40, 0x03, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0x07, 0xFF, 0xEA, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x30,
-    0x00, 0x3F, 0x9B, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x05, 0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x40, 0xFD,
-    0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x2F, 0xEB, 0xFC, 0x00, 0x3F, 0xFF,
-    0xC0, 0x01, 0xFA, 0xA4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xEA, 0xAF, 0xF1, 0xFD, 0x00, 0x2F, 0xC7, 0xF4, 0x01, 0xFE, 0x0F,
-    0xFE, 0xBF, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0x40, 0x3F, 0x42, 0xFE, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01, 0xF0, 0x7F, 0x80,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x15, 0x54, 0xFF,
-    0x00, 0x3F, 0xFF, 0x7F, 0xD0, 0x07, 0xFF, 0xCB, 0xF8, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x03, 0xFC,
-    0x3F, 0xF4, 0x00, 0xFF, 0x07, 0xFF, 0xEA, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05,
-    0x00, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x40, 0xFD, 0x03, 0xF4, 0x03,
-    0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x2F, 0xEB, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFA,
-    0xA4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xEA, 0xAF, 0xF1, 0xFD, 0x00, 0x2F, 0xC7, 0xF4, 0x01, 0xFE, 0x0F, 0xFE, 0xBF, 0xF0,
-    0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x06, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF4, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0xBD, 0x0F, 0xF0, 0x00,
-    0x1F, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0x55, 0x4F, 0xF0, 0x03, 0xFF, 0xF7, 0xFD, 0x00, 0x7F, 0xFC, 0xBF, 0x80, 0x00, 0xFF, 0x1F,
-    0xF4, 0x00, 0x3F, 0xC3, 0xFF, 0x40, 0x0F, 0xF0, 0x7F, 0xFE, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x50, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x83, 0xF8, 0x1F, 0xC4,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x02, 0xFE, 0xBF, 0xC0, 0x03,
-    0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0x55, 0x40, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAA, 0xFF, 0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0x40, 0x1F,
-    0xE0, 0xFF, 0xEB, 0xFF, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x00, 0x01, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x01, 0x55, 0x54, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x8B, 0xFF, 0xE0, 0x2F, 0xFF,
-    0x80, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xAA, 0xAB, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xBF, 0xFF, 0x42, 0xFF, 0xFE, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0xFC,
-    0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x05, 0x40, 0x00, 0x2F, 0xDB, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFE, 0xFF, 0xC0, 0x02, 0xFE, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x1F,
-    0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F,
-    0xD0, 0x1F, 0xD0, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xFF, 0x47, 0xFF,
-    0xC1, 0xFF, 0xF8, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x55, 0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x17, 0xFE, 0x55, 0x5F, 0xF9, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F,
-    0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x6F, 0xFA, 0x80, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xB9, 0x00, 0x0B, 0xFB, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xD1, 0xFF, 0x40, 0x2F, 0xD0, 0x2F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD, 0x00,
-    0xBF, 0x40, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xD0, 0x0B, 0xF4, 0x07, 0xF4, 0x02, 0xFD, 0x01, 0xFD,
-    0x03, 0xFF, 0xD1, 0xFF, 0xF1, 0xFF, 0xF8, 0xFF, 0xFC, 0x06, 0x40, 0x42, 0xFE, 0x2C, 0x3F, 0xFF,
-    0xD3, 0xC7, 0xFC, 0x04, 0x05, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0,
-    0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x0A, 0x01, 0x0F, 0xF1, 0xEB, 0xFF, 0xF9, 0xD2, 0xFC, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x02, 0xFF, 0xF4,
-    0xFF, 0xFD, 0x05, 0x55, 0x43, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x54, 0x3F, 0xFF, 0xD2, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x02, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0xAF, 0xFF,
-    0xE1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xF8,
-    0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x08, 0x00, 0x43, 0xE0, 0x1D, 0x3F, 0xFF, 0xC0, 0xFF, 0xF4, 0x01,
-    0xA4, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF,
-    0xFD, 0x00, 0x00, 0x1E, 0x00, 0xAB, 0xF5, 0xF4, 0xFF, 0xF8, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE,
-    0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x15, 0x55,
-    0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFF, 0x90, 0x0B, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x7F, 0x40, 0x0B,
-    0xFC, 0x00, 0xBF, 0x80, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xF8,
-    0x00, 0xBF, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x00,
-    0x7F, 0x80, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0x43, 0xFF, 0xF4, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x01, 0xF4, 0x00, 0x1F, 0xE8, 0x00, 0xBF, 0xC0, 0x00, 0x50, 0x00, 0x64, 0x00, 0x2F, 0xC0,
-    0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F,
-    0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x80, 0x2F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x15, 0x55, 0x41, 0x55, 0x55, 0x3F, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x2F, 0xFF, 0x82, 0xFF, 0xF9, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0,
-    0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03,
-    0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC,
-    0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x2F, 0xFF, 0xD0, 0x2F, 0xD0, 0x3F, 0xFF, 0xD0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x10, 0x07, 0xF4, 0x02, 0xFC, 0x0B, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x03, 0xFC, 0x01,
-    0x90, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2F, 0xF8, 0x1F, 0xFC, 0x7F,
-    0xF8, 0x3F, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07,
-    0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x07,
-    0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x2F, 0xFF, 0x43, 0xFC, 0x3F, 0xFF, 0x43, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x7E, 0x02, 0x80, 0x18, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x07,
-    0xFF, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7D, 0xF8, 0x03,
-    0xD1, 0xF0, 0x1E, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x40, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x02, 0xE4, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x50, 0xFF, 0xFF, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0x00,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xF4, 0x00,
-    0x00, 0xFF, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xDF, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x2F, 0xFF, 0xC0, 0x7F, 0xF8,
-    0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xF8, 0x0B, 0xF0, 0x7F, 0xF4, 0x0B, 0xF0, 0x3F, 0x80, 0x0B, 0xF0,
-    0xFE, 0x00, 0x0B, 0xF2, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x0B, 0xF2,
-    0xFD, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xFD,
-    0x0F, 0xFC, 0x7F, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x90, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x2F,
-    0xE0, 0xBF, 0x00, 0x07, 0xF8, 0x7F, 0x00, 0x01, 0xFE, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xF5, 0xFE, 0x00, 0x01, 0xFD, 0x3F, 0xD0, 0x00, 0x7F, 0x43, 0xFC,
-    0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x2F, 0xFE, 0x0F, 0xFD, 0x0F, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x1F, 0x80, 0x2F, 0xE0, 0x7F, 0xF0, 0x2E,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBF, 0xD0, 0xFF, 0xF4, 0x07, 0xFD, 0x00, 0xBF, 0x40, 0x2F,
-    0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF,
-    0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x7F, 0xFF, 0x2F, 0xFF,
-    0xC0, 0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x1B, 0xFD, 0x0F, 0xFF, 0x40, 0x7F, 0xD0, 0x0B, 0xF4,
-    0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x0B, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xF2,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xF4, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x15, 0x55, 0x43, 0xF0, 0x3F, 0xFF,
-    0xD3, 0xE0, 0x2F, 0xFF, 0x83, 0xC0, 0x03, 0xFC, 0x03, 0x80, 0x03, 0xFC, 0x01, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC,
-    0x00, 0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x10, 0x11, 0xBF, 0xD2, 0xFF, 0xFF, 0x4B, 0xC7, 0xFD, 0x3E, 0x0B, 0xF4, 0xF0,
-    0x2F, 0xD3, 0xC0, 0xBF, 0x44, 0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x40,
-    0x02, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xF4,
-    0x00, 0x2F, 0xD0, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0x15, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x01, 0xF4, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x02,
-    0xF4, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x10, 0x00, 0x06, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0xBF, 0x42, 0xF8, 0x0B, 0xF4, 0x3F, 0xC0, 0xBF, 0x43, 0xFC, 0x0B, 0xF4, 0x0A, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0xB0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x3F,
-    0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x02, 0xF4, 0x03, 0xFE, 0xAA, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x01, 0xBF, 0xD0, 0x3F, 0xFD, 0x00, 0x7F, 0xD0, 0x02, 0xFD,
-    0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xDC, 0x02, 0xFF, 0xD0, 0x2F, 0xF4, 0x02, 0xFD, 0x00,
-    0xBF, 0xD0, 0x3F, 0xFD, 0x01, 0x6F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x2F,
-    0xD0, 0x1F, 0xFF, 0xC2, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x55, 0x54,
-    0x7F, 0xFD, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x7F, 0x00,
-    0x0F, 0xFF, 0x40, 0x1F, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0xFF, 0xFE, 0x01, 0xFC, 0x00,
-    0x3F, 0x7F, 0xD0, 0x7F, 0x00, 0x0F, 0xCB, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFF, 0xC7, 0xF0, 0x00,
-    0xFC, 0x0F, 0xF9, 0xFC, 0x00, 0x3F, 0x02, 0xFF, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xC0, 0x03,
-    0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00, 0xFF,
-    0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x54,
-    0x00, 0x2F, 0xF2, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFA, 0xFF, 0x80, 0x1F, 0xE0,
-    0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F,
-    0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80,
-    0xBF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFF, 0x1F, 0xFF, 0x40, 0x15, 0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF,
-    0x40, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF,
-    0xF4, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07, 0xF0, 0x00, 0xFC, 0x3F, 0xF1, 0xFC, 0x00, 0x3F, 0x03,
-    0xFE, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x00,
-    0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x3F, 0xFF, 0x00,
-    0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15,
-    0x00, 0x0B, 0xFC, 0xBF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0xBF, 0xE0, 0x07, 0xF8,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0, 0x07,
-    0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x1F, 0xE0, 0x0F, 0xE0,
-    0x2F, 0xFE, 0x0F, 0xFF, 0x4F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x3C,
-    0x00, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x55,
-    0x54, 0x7F, 0xFD, 0x00, 0xBF, 0xFF, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x7F,
-    0x00, 0x0F, 0xFF, 0x40, 0x1F, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xF0, 0x00, 0xFF, 0xFE, 0x01, 0xFC,
-    0x00, 0x3F, 0x7F, 0xD0, 0x7F, 0x00, 0x0F, 0xCB, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0xFF, 0xC7, 0xF0,
-    0x00, 0xFC, 0x0F, 0xF9, 0xFC, 0x00, 0x3F, 0x02, 0xFF, 0x7F, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0xC0,
-    0x03, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0x00,
-    0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x54, 0x00, 0x2F, 0xF2, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFA, 0xFF, 0x80, 0x1F,
-    0xE0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0x80,
-    0x1F, 0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x80, 0x3F,
-    0x80, 0xBF, 0xF8, 0x3F, 0xFD, 0x3F, 0xFF, 0x1F, 0xFF, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x05, 0x01, 0x50, 0x00, 0x7D, 0x0B, 0xFC, 0xBF, 0xF0, 0x03, 0xE0, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0A, 0x00, 0x6F, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x40, 0x00, 0x02,
-    0xFD, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00,
-    0x00, 0xBF, 0x40, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xF8,
-    0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x8B,
-    0xFF, 0xC0, 0x15, 0x54, 0x00, 0x15, 0x55, 0x1F, 0xFF, 0x00, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07,
-    0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0x00, 0x0F, 0xDF, 0xF0, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07,
-    0xF0, 0x00, 0xFC, 0x3F, 0xD1, 0xFC, 0x00, 0x3F, 0x03, 0xFC, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF,
-    0xC0, 0x03, 0xF0, 0x0F, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF,
-    0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xFF, 0xC0, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x50, 0x15, 0x00, 0xBF,
-    0xCB, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xEB, 0xFE, 0x07, 0xF8, 0x07, 0xF8, 0x1F, 0xE0,
-    0x0F, 0xE0, 0x7F, 0x80, 0x3F, 0x81, 0xFE, 0x00, 0xFE, 0x07, 0xF8, 0x03, 0xF8, 0x1F, 0xE0, 0x0F,
-    0xE0, 0x7F, 0x80, 0x3F, 0x81, 0xFE, 0x00, 0xFE, 0x2F, 0xFE, 0x03, 0xF8, 0xFF, 0xFC, 0x0F, 0xE0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80,
-    0x00, 0x3F, 0xCB, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0,
-    0x1F, 0xFE, 0x5B, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xF4,
-    0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x07,
-    0xC0, 0x3C, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC,
-    0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00,
-    0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7,
-    0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x28, 0x00, 0x2F, 0xD7, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFF,
-    0x41, 0xFD, 0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00,
-    0x1F, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x3F, 0x07, 0xE0,
-    0x00, 0x02, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8,
-    0x3F, 0xC0, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00,
-    0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB,
-    0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x09, 0x0A, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x7C,
-    0x3C, 0x00, 0x00, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0,
-    0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF,
-    0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFD, 0x02, 0xFD, 0x05, 0xF8, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0xF4,
-    0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x60, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0x40, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0x10,
-    0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x3C, 0x3F, 0xF0, 0x02, 0xFD, 0x00, 0xBC, 0x0F, 0xFE, 0x57, 0xFE,
-    0xAA, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x0B, 0xFF, 0xC2, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x47, 0xFF, 0x82, 0xFD, 0x1F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF3,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0xF3, 0xFC, 0x00, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF4, 0x00,
-    0x01, 0xFF, 0x87, 0xFF, 0xF9, 0x6E, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0x42, 0xFF,
-    0xF8, 0x00, 0x05, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0xFF,
-    0x1B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF, 0xF7,
-    0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x7F,
-    0xFF, 0xC0, 0x05, 0x6A, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xC0, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF,
-    0xF7, 0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x02,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x3C,
-    0x00, 0x00, 0x2F, 0x43, 0xE0, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0xAA, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00,
-    0xFF, 0x1B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xCF,
-    0xF0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xF8, 0x3F, 0xFF, 0xC0, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x01, 0x00, 0x10, 0x07, 0xC0, 0xF8, 0x03, 0xE2, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0x40, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x2F, 0xF1, 0xFD, 0xBF,
-    0xF7, 0xFD, 0x1B, 0xFF, 0xFC, 0x07, 0xFD, 0x04, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xFF, 0x80,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F, 0xF4, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x09, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x00, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x07, 0xFF,
-    0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x0B,
-    0xDF, 0xD0, 0x0B, 0xD0, 0xBC, 0x01, 0xD0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F,
-    0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xF0, 0x01, 0xF7, 0xF0, 0x0F, 0x83, 0xD0, 0x78, 0x07, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x07, 0xFF, 0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD,
-    0x00, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF,
-    0xF8, 0x7F, 0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x6F, 0xA4, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xF0, 0xFF, 0x00, 0xFC, 0x7F, 0x40, 0x3F, 0x1F, 0xE0, 0x0B, 0x47, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x28, 0x00,
-    0xFF, 0x6F, 0x00, 0x1F, 0xDB, 0xD0, 0x0B, 0xF2, 0xFE, 0x07, 0xF8, 0xBF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xF8, 0x00, 0x15, 0x50, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x55, 0x00, 0x1F, 0xFF, 0x82, 0xFE,
-    0xFF, 0x0F, 0xC0, 0x7D, 0x7F, 0x00, 0xF1, 0xFF, 0x80, 0x03, 0xFF, 0xF4, 0x03, 0xFF, 0xF8, 0x02,
-    0xFF, 0xF4, 0x40, 0x7F, 0xEB, 0x80, 0x3F, 0xBF, 0x40, 0xFD, 0xBF, 0xFF, 0xE1, 0xFF, 0xFE, 0x00,
-    0x05, 0x00, 0x00, 0x6E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x7E, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x1F, 0x00, 0xFC, 0x1F, 0x40, 0x1F, 0xEF, 0x40,
-    0x01, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x90, 0x07, 0xFF, 0xFF,
-    0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x03, 0xF1, 0xFD, 0x00, 0xFC, 0x7F, 0x80, 0x2D, 0x1F, 0xF4, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0xA0, 0x03, 0xFD, 0xBC, 0x00, 0x7F, 0x6F, 0x40, 0x2F, 0xCB, 0xF8, 0x1F, 0xE2, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0x55, 0x40, 0x00, 0x04, 0x01, 0x40, 0xB8, 0x1F, 0x41, 0xF4, 0xF8,
-    0x02, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x07, 0xFF,
-    0xE0, 0xBF, 0xBF, 0xC3, 0xF0, 0x1F, 0x5F, 0xC0, 0x3C, 0x7F, 0xE0, 0x00, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFD, 0x10, 0x1F, 0xFA, 0xE0, 0x0F, 0xEF, 0xD0, 0x3F, 0x6F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0x80, 0x01, 0x40, 0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8,
-    0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x3D, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x03, 0xFB, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x47, 0xFC, 0x1F, 0xC3,
-    0xE0, 0x3F, 0xC0, 0xFC, 0x3D, 0x03, 0xFC, 0x0F, 0x80, 0x40, 0x3F, 0xC0, 0x50, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x14, 0xB8, 0x00, 0xFC, 0xB0, 0x02, 0xFC,
-    0x60, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x15, 0x55,
-    0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC,
-    0x3E, 0x03, 0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xAB, 0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x17, 0xFD, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xF8, 0x17, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x17, 0xFD, 0x50, 0x3F, 0xFF, 0xF0,
-    0x07, 0xFD, 0x50, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x01, 0x90, 0x40, 0x00, 0x00, 0x0B, 0xF8, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x2F, 0xE3, 0xC0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x03,
-    0xC3, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F,
-    0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0,
-    0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B,
-    0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF,
-    0xC0, 0x01, 0x50, 0x14, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x40, 0xB0, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40,
-    0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0x0F, 0xE6, 0xF0, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xBF, 0xC0, 0xBF, 0xF0, 0xBF, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00,
-    0x3D, 0x3C, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x04, 0x02,
-    0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x7F, 0x40,
-    0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0x06, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06,
-    0x03, 0x40, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0x3D, 0x2E, 0x00, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFC, 0x2F, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xEA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF,
-    0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0,
-    0x01, 0x50, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFE,
-    0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xEB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x55,
-    0x54, 0x7F, 0xFF, 0xC0, 0x7F, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x7F, 0xF8, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xC0, 0x03, 0xFD, 0x02,
-    0xFF, 0xC0, 0x2F, 0x80, 0x02, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x01, 0xFF, 0x03, 0xFF, 0xE0,
-    0x3F, 0x00, 0x00, 0xFF, 0x07, 0xEF, 0xF0, 0x7E, 0x00, 0x00, 0xBF, 0x4B, 0xCB, 0xF0, 0xBD, 0x00,
-    0x00, 0x7F, 0x8F, 0xC7, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0xCF, 0x83, 0xFC, 0xF8, 0x00, 0x00, 0x2F,
-    0xDF, 0x02, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x07,
-    0xD0, 0xBF, 0xF0, 0xFF, 0xF4, 0x2F, 0x81, 0xFF, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0xFC, 0x02, 0xFC,
-    0x07, 0xFC, 0x07, 0xD0, 0x03, 0xF8, 0x2F, 0xF4, 0x3F, 0x00, 0x0F, 0xF0, 0xFF, 0xE0, 0xFC, 0x00,
-    0x2F, 0xC3, 0xDF, 0xC7, 0xD0, 0x00, 0x3F, 0x6E, 0x3F, 0x2F, 0x00, 0x00, 0xFE, 0xF4, 0xBD, 0xF8,
-    0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFA, 0xF8, 0x00,
-    0x00, 0x3E, 0x07, 0xD0, 0x00, 0x03, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50,
-    0x15, 0x54, 0xBF, 0xFF, 0x87, 0xFF, 0xE7, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0xFE, 0x00,
-    0x3F, 0xD0, 0x1F, 0xC0, 0x01, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xCF,
-    0xC0, 0x00, 0x02, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFA, 0xF0, 0x00,
-    0x00, 0xBC, 0x3E, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0,
-    0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02,
-    0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00,
-    0x0B, 0xF0, 0xFD, 0x00, 0x00, 0x14, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0, 0x03,
-    0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC, 0xFC,
-    0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xC3, 0xF4, 0x03, 0xFE, 0x0F, 0x80, 0x2F, 0xF0, 0x1D, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x1C, 0x0F, 0xF8, 0x00, 0xF8, 0xBF, 0xC0, 0x07,
-    0xE3, 0xFE, 0xAA, 0xBF, 0x4F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xC3, 0xF5, 0x7F, 0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03, 0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x54, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFD, 0x00, 0xFF, 0x83, 0xE0, 0x0B,
-    0xFC, 0x07, 0x40, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x07, 0x03,
-    0xFE, 0x00, 0x3E, 0x2F, 0xF0, 0x01, 0xF8, 0xFF, 0xAA, 0xAF, 0xD3, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xFF, 0x0F, 0xD5, 0xFF, 0x83, 0xD0, 0x7F, 0x80, 0x60, 0x7F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF0, 0x2C, 0x1F, 0xF0, 0x0F, 0x4F, 0xF9, 0x5B,
-    0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x7C, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC3, 0xF4, 0x03, 0xFE, 0x0F, 0x80, 0x2F, 0xF0, 0x1D, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xFF, 0x40, 0x1C, 0x0F, 0xF8, 0x00, 0xF8, 0xBF, 0xC0, 0x07, 0xE3, 0xFE, 0xAA,
-    0xBF, 0x4F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50,
-    0x03, 0xE0, 0x7C, 0x00, 0xBD, 0x3D, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xF5, 0x7F,
-    0xE0, 0xF4, 0x1F, 0xE0, 0x18, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x0B, 0x07, 0xFC, 0x03, 0xD3, 0xFE, 0x56, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF4, 0x0F,
-    0xF0, 0xBD, 0x07, 0xF4, 0x09, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xBF, 0x90, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0xBF,
-    0xC1, 0xFE, 0x00, 0x00, 0xFF, 0x4B, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF,
-    0x40, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0xFF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x51, 0xFC, 0x00,
-    0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x7F, 0xD0, 0x1F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x5A, 0xAA, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x4F, 0xE2, 0xFD, 0x0F, 0xFC, 0xFD, 0x2F, 0xD0, 0x3F, 0xC7, 0xD2, 0xFD,
-    0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0x94, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0x07, 0xD0, 0x07, 0xF4, 0x05, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x01, 0x40, 0x02, 0xFD, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0xFF, 0xC0, 0xBF, 0x40,
-    0xFF, 0x42, 0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x07, 0xF8, 0x2F, 0xC0, 0x1F, 0xE0, 0xBF, 0x00, 0x7F,
-    0x82, 0xFC, 0x01, 0xFD, 0x0B, 0xF0, 0x0F, 0xF0, 0x2F, 0xE5, 0xBF, 0x80, 0xBF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x17, 0xFD, 0x50, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x05, 0xBC,
-    0x00, 0x00, 0x7C, 0x01, 0xD0, 0xF8, 0x03, 0xFB, 0xF0, 0x02, 0xFF, 0xD0, 0x00, 0x6A, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xF4, 0x7F, 0xC1,
-    0xFC, 0xBE, 0x03, 0xFC, 0x0F, 0xC7, 0xF0, 0x3F, 0xC0, 0xF8, 0x2F, 0x43, 0xFC, 0x05, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xE0, 0xB8, 0x02, 0xFC,
-    0x02, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x01,
-    0x7F, 0xD5, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xFA, 0xC0, 0x02,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03, 0xFC, 0x0F,
-    0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC3, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x55, 0x55, 0x01, 0x56, 0xFD, 0xBF, 0xFF, 0xC1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD0, 0x2F,
-    0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
-    0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xF0,
-    0x00, 0x2F, 0xF9, 0x6F, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xF0, 0x2F, 0xFE, 0x2F, 0xFC, 0x2F, 0xFD, 0x01,
-    0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03,
-    0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05,
-    0x40, 0x50, 0x00, 0x14, 0x07, 0xD0, 0x7F, 0x02, 0xFC, 0x07, 0xD0, 0x08, 0x02, 0x03, 0xF1, 0xFC,
-    0xFC, 0x7D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0xBD, 0xF4, 0x1F, 0x0B,
-    0xC2, 0xD0, 0x38, 0x00, 0x00, 0x00, 0x06, 0x41, 0x03, 0xFE, 0x3C, 0x3F, 0xFF, 0xC3, 0xC7, 0xF8,
-    0x00, 0x04, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x1C,
-    0x3F, 0x9B, 0xC2, 0xFF, 0xF4, 0x06, 0xF8, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xF8, 0x04, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0xBC, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x04, 0x01, 0x00, 0x0B, 0xE0, 0x3F,
-    0xFC, 0x7C, 0x3D, 0x24, 0x3C, 0x01, 0xF4, 0x07, 0xC0, 0x03, 0x40, 0x06, 0xE0, 0x2F, 0xFC, 0x3C,
-    0x3C, 0x78, 0x2D, 0x3D, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x06, 0x03, 0x40, 0xFC, 0xBC, 0x0F, 0x8F,
-    0xC2, 0xF1, 0xF4, 0x3D, 0x2E, 0x02, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x01, 0x43, 0xC0, 0xBC,
-    0x3F, 0x1F, 0x00, 0xFF, 0xD0, 0x07, 0xF8, 0x00, 0x1A, 0x00, 0x1C, 0x09, 0x03, 0xE3, 0xF0, 0x3F,
-    0x2F, 0x01, 0xF4, 0xF8, 0x0B, 0x87, 0xC0, 0x34, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0xFF,
-    0xF4, 0x3E, 0xAF, 0xC3, 0x40, 0x7C, 0x10, 0x01, 0x00, 0x01, 0x02, 0xF1, 0xF0, 0xFC, 0x3F, 0x0F,
-    0xC2, 0xF8, 0x10, 0x2F, 0x0F, 0xE1, 0xFC, 0x7E, 0x2F, 0x1F, 0x46, 0x40, 0x3E, 0x2F, 0xCF, 0xD2,
-    0xF4, 0x3E, 0x07, 0xD0, 0x60, 0x14, 0x3E, 0x3E, 0x3C, 0x3C, 0x34, 0x10, 0x1F, 0x43, 0xE0, 0xF8,
-    0xFC, 0x3C, 0x04, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC3, 0xFC, 0x1E, 0x40, 0x19, 0x06, 0x87, 0xF0,
-    0xFD, 0x7F, 0x0F, 0xD2, 0x90, 0x64, 0x1A, 0x47, 0xFD, 0xF0, 0xFF, 0x0E, 0x7F, 0xC1, 0x90, 0x0A,
-    0x0B, 0xF0, 0xFC, 0x3E, 0x3F, 0x05, 0x00, 0x2E, 0x43, 0xFC, 0x07, 0xD0, 0xBC, 0x2F, 0x02, 0x40,
-    0x00, 0x01, 0xF4, 0x7D, 0x0B, 0xC0, 0xBF, 0x93, 0xFD, 0x01, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x07, 0xFF, 0x00, 0xF9, 0xFC, 0x3E, 0x03, 0xD1, 0x40, 0x04,
-    0x00, 0x00, 0x02, 0xC0, 0x0C, 0x3F, 0x47, 0xC2, 0xFF, 0xF4, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0x82, 0x43, 0xFE, 0x7C, 0x3E, 0xFF, 0xC2, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x55, 0x43, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x01, 0xA8, 0x00, 0xFF, 0xF4, 0x3E, 0xAF, 0xC3, 0x40, 0x7C, 0x10, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0xFD, 0x7F, 0x0F, 0xD3, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x1F, 0x0B,
-    0xC1, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07,
-    0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0,
-    0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x05,
-    0x6A, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x0F, 0xF0, 0x03,
-    0xFC, 0x07, 0xF4, 0x03, 0xFC, 0x03, 0xF0, 0x03, 0xFC, 0x07, 0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x1B, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x6F, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF,
-    0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x55, 0xBD, 0x03, 0xFC, 0x01, 0xF4, 0x0F, 0xF0,
-    0x07, 0xC0, 0x3F, 0xC0, 0x0E, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xAF, 0xD0, 0x00, 0x07, 0xD3, 0xFC, 0x00, 0x03, 0xF0, 0xFF,
-    0x00, 0x00, 0xF8, 0x1F, 0xE0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80,
-    0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0xFF, 0x42, 0xF4, 0x00, 0x1F, 0xF0, 0xFD,
-    0x00, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x05, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xD0, 0x0F, 0xF8, 0x3E, 0x00, 0xBF, 0xC0, 0x74, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x03, 0xFD, 0x00, 0x70, 0x3F, 0xE0, 0x03, 0xE2, 0xFF, 0x00, 0x1F, 0x8F, 0xFA, 0xAA, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x55, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE2, 0xFF, 0xF8, 0x0B, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xEA, 0xAA, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFF, 0xF4, 0x3F, 0xFF, 0xE0, 0x00, 0x06, 0xFA, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x40, 0x7F, 0xF0, 0x2F, 0xD0, 0x00,
-    0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x40, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF,
-    0x0F, 0xFE, 0x2F, 0xDF, 0xF0, 0xFF, 0xE2, 0xFD, 0xFF, 0x06, 0xA8, 0x2F, 0xDF, 0xF4, 0x00, 0x03,
-    0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x07, 0xF4, 0x3F, 0xF0, 0x00, 0xFF, 0x01, 0xFF,
-    0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x15, 0x55, 0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x15, 0x55,
-    0x40, 0x55, 0x50, 0xFF, 0xFF, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0x00, 0x7F,
-    0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x00,
-    0xFF, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xDF,
-    0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xF4, 0x2F, 0xFF, 0xC0, 0x7F, 0xF8, 0xFF,
-    0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x01, 0xF5, 0xFE, 0x00, 0x00, 0x0B, 0xC3, 0xFC, 0x00, 0x00,
-    0x3E, 0x0F, 0xF0, 0x00, 0x01, 0xF4, 0x1F, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x7E, 0x00,
-    0xFF, 0x40, 0x02, 0xF4, 0x02, 0xFE, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x0F, 0xF4,
-    0x03, 0xF4, 0x00, 0x2F, 0xE0, 0xBF, 0xFC, 0x07, 0xFF, 0xFB, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x01,
-    0x55, 0x40, 0x01, 0x55, 0x50, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD0, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x01, 0xFB, 0xF4,
-    0x1F, 0xBF, 0x40, 0x01, 0xF7, 0xF8, 0x2F, 0x3F, 0x40, 0x02, 0xF6, 0xFC, 0x3E, 0x3F, 0x40, 0x02,
-    0xF1, 0xFC, 0x3D, 0x3F, 0x80, 0x02, 0xF0, 0xFD, 0x7C, 0x3F, 0x80, 0x03, 0xF0, 0xBF, 0xF8, 0x3F,
-    0xC0, 0x03, 0xF0, 0x7F, 0xF4, 0x3F, 0xC0, 0x03, 0xF0, 0x3F, 0xF0, 0x2F, 0xC0, 0x03, 0xF0, 0x2F,
-    0xE0, 0x2F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x07, 0xE0, 0x0F, 0xC0, 0x2F, 0xD0, 0x3F,
-    0xFE, 0x06, 0x40, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x15, 0x54, 0x00, 0x15, 0x55,
-    0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xC2, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x1F, 0xC0,
-    0x03, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0x00,
-    0x0F, 0xDF, 0xF4, 0x1F, 0xC0, 0x03, 0xF2, 0xFF, 0x07, 0xF0, 0x00, 0xFC, 0x3F, 0xF1, 0xFC, 0x00,
-    0x3F, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xC0, 0xBF, 0xDF, 0xC0, 0x03, 0xF0, 0x0F, 0xFF, 0xF0, 0x00,
-    0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x3F,
-    0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0x55, 0x55, 0xFC, 0x2F,
-    0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xB8, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x28, 0x3E, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0xAA, 0xAA, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00,
-    0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF,
-    0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00,
-    0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00,
-    0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F,
-    0xC0, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x05, 0x6A, 0xA9, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x1F, 0xF8, 0x03, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x1F, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x90, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x05, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x4B,
-    0xFC, 0x00, 0x7D, 0x0B, 0xFC, 0x00, 0xF4, 0x0F, 0xF8, 0x02, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0xB8, 0x2F, 0xC0, 0x03, 0xE2, 0xFC, 0x00, 0x1F, 0x9F, 0xFA, 0xAF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF4, 0x7F, 0xC1, 0xFC, 0x3E, 0x03,
-    0xFC, 0x0F, 0xC3, 0xD0, 0x3F, 0xC0, 0xF8, 0x04, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x06, 0xD0, 0x00,
-    0x1A, 0x03, 0xFF, 0x40, 0x07, 0xFC, 0xBF, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xD0, 0x02,
-    0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x03, 0xF5, 0xF8,
-    0x00, 0x00, 0x2F, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFE, 0xFF, 0x7F, 0xF0, 0x1F, 0xE0, 0xBF, 0x0B,
-    0xF8, 0x3F, 0xC0, 0xBF, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x02, 0xFD,
-    0x3F, 0xC0, 0xBF, 0x03, 0xFC, 0x2F, 0xE0, 0xBF, 0x07, 0xF8, 0x0F, 0xF9, 0xFF, 0x6F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x15, 0x55, 0x40,
-    0x55, 0x50, 0xFF, 0xFF, 0x4B, 0xFF, 0xD2, 0xFF, 0xF8, 0x1B, 0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xC0,
-    0x00, 0xFF, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF8, 0x00, 0x03, 0xF8, 0x1F, 0xF4, 0x00,
-    0x2F, 0xC0, 0x2F, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xF0, 0x69, 0x01, 0x55, 0x54, 0x0A, 0x87, 0xF4, 0x7F, 0xFF, 0xC3, 0xF8, 0x3F, 0xC2,
-    0xFF, 0xE0, 0x7F, 0x42, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x2F, 0xC0, 0x3F, 0x80, 0xBF, 0x01, 0xFD,
-    0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0xFE, 0x00, 0xFE, 0x03, 0xF8, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x3F, 0x81, 0xFC, 0x00, 0x7F, 0x43, 0xF8, 0x3F, 0xC0, 0x03, 0xFE, 0x7F, 0x9F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x07, 0xF8, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40,
-    0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x0F, 0x0F, 0xD0, 0x0F, 0xD2, 0xD3,
-    0xC0, 0xFD, 0x0F, 0xD0, 0xF8, 0xFE, 0xAF, 0x83, 0xEA, 0xBE, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x14, 0x00, 0x7F, 0xF0, 0xFE, 0x00, 0x7F, 0xFF,
-    0x7F, 0x40, 0x3F, 0xD7, 0xFF, 0xC0, 0x1F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF0, 0x07, 0xFC, 0x03, 0xFC,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03,
-    0xFD, 0x07, 0xFF, 0x00, 0xBF, 0xDB, 0xFF, 0xD0, 0x0F, 0xFF, 0xE7, 0xFF, 0x80, 0xFF, 0xE0, 0xFF,
-    0x80, 0x01, 0x40, 0x05, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x02,
-    0xFD, 0x0F, 0xF4, 0x3F, 0x80, 0x7F, 0x43, 0xF4, 0x03, 0xF4, 0x3F, 0x40, 0x7F, 0x47, 0xF4, 0x07,
-    0xF0, 0x7F, 0x40, 0xFD, 0x07, 0xF4, 0xFF, 0x80, 0x7F, 0x5F, 0xFE, 0x07, 0xF4, 0x5F, 0xF8, 0x7F,
-    0x40, 0x3F, 0xC7, 0xF4, 0x01, 0xFD, 0x7F, 0x40, 0x1F, 0xD7, 0xF4, 0x02, 0xFD, 0x7F, 0x40, 0x3F,
-    0xC7, 0xF8, 0x1F, 0xF4, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x40, 0x7F, 0x44, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x40, 0xBF, 0xD0, 0x0F, 0xD7, 0xFF, 0x80, 0x3F, 0x82, 0xFF, 0x00, 0xFE, 0x03,
-    0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0xD0, 0x0F, 0xF0, 0x7F, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x3F,
-    0x8F, 0xC0, 0x00, 0xBF, 0x7E, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFD, 0x06, 0xF0, 0x07, 0xF0, 0x00, 0x40, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xEB, 0xFF,
-    0x00, 0xFF, 0x0B, 0xFD, 0x0B, 0xF4, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x2F, 0xE0, 0x1F, 0xD0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFD, 0x1F, 0xD0, 0x2C, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x07,
-    0xFF, 0xC0, 0x1F, 0xF5, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x01, 0x3F, 0xE5, 0x6F, 0x2F, 0xFF,
-    0xFE, 0x07, 0xFF, 0xF4, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x45, 0xBE,
-    0x2F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x0A, 0x97, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFE, 0x40,
-    0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0x90, 0x01, 0x50, 0x05, 0x00, 0x2F, 0xF4, 0xFF, 0xE0, 0x3F, 0xFB, 0xFF,
-    0xF4, 0x07, 0xFF, 0xDB, 0xFC, 0x02, 0xFF, 0x03, 0xFC, 0x02, 0xFE, 0x03, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x06, 0x50, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4,
-    0x02, 0xFC, 0x1F, 0xF0, 0x0F, 0xD0, 0x2F, 0xD0, 0xBF, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0xFF, 0x0F,
-    0xE0, 0x02, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xE5,
-    0x56, 0xFC, 0x3F, 0x80, 0x07, 0xF0, 0xFF, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0xBF, 0x0B, 0xF4, 0x03,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xE5, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80,
-    0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF, 0x1F, 0xFC,
-    0x01, 0x40, 0x00, 0x40, 0x05, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0x80, 0xFF, 0xC7, 0xF8, 0x3F, 0xE4,
-    0x7F, 0x8F, 0xE0, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xCF,
-    0xD0, 0x07, 0xF8, 0xBE, 0x00, 0x7F, 0x87, 0xF4, 0x07, 0xF8, 0x3F, 0xE5, 0x7F, 0x81, 0xFF, 0xF7,
-    0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x01, 0x64, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x15, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBD, 0xFF, 0x00, 0x00, 0x3F,
-    0x2F, 0xD0, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x03,
-    0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0x40, 0x1F, 0xF8, 0x01, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xF6, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xEB, 0xFE, 0x7F, 0xFF, 0x83, 0xFC, 0x7F, 0x14, 0x00, 0x50, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0xBF, 0xD0, 0x0F, 0xD7, 0xFF, 0x80, 0x3F, 0x82, 0xFF, 0x00, 0xFE,
-    0x03, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x1F, 0xD3, 0xF8, 0x00,
-    0x3F, 0x8F, 0xC0, 0x00, 0xBF, 0x7D, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3F, 0x01, 0xB8, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x90, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xE0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xF9, 0x40, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x90, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xF4, 0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01,
-    0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x4F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xBC, 0x3E, 0x0B, 0xC0, 0x0D, 0x1F, 0x82, 0xF0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x02,
-    0xF4, 0x3F, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x1F, 0xD0, 0xFD, 0x00,
-    0x0B, 0xF0, 0x3F, 0xD4, 0x03, 0xFC, 0x0B, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x02, 0xFF, 0x5F, 0xF8, 0x3F,
-    0xC0, 0x3F, 0xC3, 0xF8, 0x03, 0xFC, 0x3F, 0x80, 0x3F, 0xC7, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0x3F,
-    0xC7, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0xBF, 0x47, 0xFD, 0x1F, 0xF0, 0x7F, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFE, 0x00, 0x7F, 0x84, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFE,
-    0x0F, 0xF4, 0xFF, 0x1F, 0xD0, 0x7F, 0x2F, 0xC0, 0x38, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x50, 0x0B, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0x00, 0x06, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x6F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFE, 0xBF, 0xF8,
-    0x1F, 0xE0, 0x2F, 0x80, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x2F, 0xE0, 0x2F, 0xD0, 0x1F, 0xF4, 0xBF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0xBC, 0x2F, 0x80, 0x03, 0x43, 0xF8,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x03, 0xFD, 0x54, 0x00, 0x3F, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x04, 0x01, 0x40, 0x2F, 0xFC, 0x0B, 0xF0, 0x3F, 0xFC, 0x07, 0xF4, 0x07, 0xFC, 0x03,
-    0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xFC, 0x03,
-    0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF4, 0x02, 0xFF, 0x5F,
-    0xF0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xF9, 0xFF, 0x7F, 0xF0, 0x1F, 0xE0, 0xFF, 0x0B, 0xF8, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFC, 0x3F, 0x80, 0xFF, 0x02, 0xFC, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x2F, 0xF0, 0xFF, 0x0B, 0xF4, 0x0F, 0xFE, 0xFF, 0x7F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xF8, 0x07, 0xF8, 0x3F, 0xFC, 0x0F,
-    0xF0, 0x07, 0xFD, 0x1F, 0xD0, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBD, 0xFF, 0x00, 0x01, 0xFC, 0x7F,
-    0x40, 0x03, 0xF8, 0x3F, 0xC0, 0x0B, 0xF0, 0x2F, 0xD0, 0x1F, 0xF0, 0x0F, 0xFD, 0x3F, 0xD0, 0x0F,
-    0xFE, 0x1B, 0x80, 0x06, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x10, 0x1F, 0xC0, 0x50, 0x0B,
-    0xFF, 0x07, 0xF0, 0xBF, 0x03, 0xFF, 0xC1, 0xFC, 0x1F, 0xD0, 0x0F, 0xE0, 0x7F, 0x03, 0xF8, 0x03,
-    0xF8, 0x1F, 0xC0, 0xFF, 0x00, 0xFE, 0x07, 0xF0, 0x3F, 0xC0, 0x3F, 0x81, 0xFC, 0x0B, 0xF0, 0x1F,
-    0xE0, 0x7F, 0x03, 0xFC, 0x03, 0xFC, 0x1F, 0xC0, 0xFF, 0x00, 0xFF, 0x07, 0xF0, 0x7F, 0x80, 0x2F,
-    0xE1, 0xFC, 0x3F, 0xC0, 0x03, 0xFE, 0xBF, 0xBF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x03,
-    0xFC, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0xB9, 0x0F, 0xF0, 0xBF, 0x03, 0xF8, 0x1F, 0xD3,
-    0xFC, 0x0F, 0xD0, 0x7F, 0x4F, 0xE0, 0x3F, 0x40, 0xFE, 0x3F, 0x80, 0xFD, 0x03, 0xF4, 0xFF, 0x03,
-    0xF4, 0x0F, 0xD3, 0xFC, 0x0F, 0xE0, 0x7F, 0x07, 0xF8, 0xBF, 0xD3, 0xF8, 0x0F, 0xFF, 0xDF, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F,
-    0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x80, 0x00, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00,
-    0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E,
-    0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F,
-    0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x01, 0xBE, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x24, 0x7C, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00,
-    0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x14, 0x3E, 0x00,
-    0x00, 0x01, 0xFD, 0x34, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00,
-    0x19, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF,
-    0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8,
-    0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F,
-    0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x05, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xC7, 0xE0, 0x01, 0xF4, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F,
-    0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC,
-    0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x14, 0xBC, 0x00, 0x00, 0x01, 0xFD,
-    0x1C, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x19, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00,
-    0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E,
-    0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F,
-    0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x05, 0x82, 0xC0,
-    0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xC7, 0xE0, 0x01, 0xF4, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07,
-    0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF,
-    0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x40,
-    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x00, 0x00, 0x01, 0xFD, 0x34, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x19, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0,
-    0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00,
-    0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC,
-    0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xE7, 0xC0, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x1F, 0x40, 0x05, 0x83, 0xC0, 0x01, 0xFF, 0x14,
-    0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xC7, 0xE0, 0x01, 0xF4, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0,
-    0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40,
-    0x14, 0x01, 0x40, 0x00, 0x0B, 0xD1, 0xC0, 0x00, 0x00, 0x3F, 0xFB, 0xD0, 0x00, 0x00, 0x2C, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0x19, 0x01, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x07, 0xD0, 0x80, 0x00, 0xFF, 0x9E, 0x00, 0x1F, 0x7F, 0xE0, 0x00,
-    0x90, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBD, 0x7F,
-    0x00, 0x1F, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF4, 0x07, 0xF4, 0x7F, 0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5,
-    0xBF, 0xD0, 0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F,
-    0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3E, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0,
-    0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0,
-    0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8,
-    0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x18, 0xB4, 0x80, 0x00, 0x00, 0x3D, 0x01, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F,
-    0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC,
-    0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF,
-    0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0E, 0x00,
-    0x70, 0x01, 0xF9, 0x6F, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F,
-    0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF,
-    0x40, 0x14, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x18, 0x78, 0x80, 0x00, 0x00, 0x3D, 0x01, 0xD0, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00,
-    0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD,
-    0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00,
-    0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF,
-    0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x70, 0x01, 0xF9,
-    0x6F, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x05, 0x03,
-    0xFC, 0x00, 0x01, 0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40, 0x14, 0x01,
-    0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1C, 0x70, 0xC0, 0x00, 0x00, 0x2F, 0x47, 0xC0, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0,
-    0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07,
-    0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFC, 0x00, 0x19, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x04, 0x7C,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0D, 0x10, 0x70, 0x01, 0xF4, 0x1F, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0x40, 0x7F, 0x47, 0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x05, 0x03, 0xFC, 0x00, 0x01,
-    0x7F, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xBF, 0xC0, 0xBF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0,
-    0xFF, 0x5B, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x2F, 0xF8, 0xFF, 0x40, 0x14, 0x01, 0x40, 0x00, 0x0F,
-    0x81, 0x80, 0x00, 0x00, 0x3F, 0xFB, 0xC0, 0x00, 0x00, 0x2C, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x2C, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F,
-    0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC,
-    0x01, 0x80, 0x40, 0x00, 0xFF, 0x4F, 0x00, 0x1F, 0xBF, 0xF0, 0x00, 0xE1, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x03, 0x00, 0x1F, 0x81, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F,
-    0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x01,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x0F, 0x8F, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xF0, 0x00, 0x00, 0x3F,
-    0x07, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x57, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x7F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0xFF, 0xFD, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x07, 0x00, 0x1F, 0xD6, 0xE0, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xB9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF4, 0x07, 0xF4, 0x7F,
-    0xC0, 0x7F, 0x03, 0xFC, 0x00, 0x50, 0x3F, 0xC0, 0x00, 0x17, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xFB, 0xFC, 0x0B, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0xBF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0x8F, 0xF4, 0x01, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00,
-    0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFE, 0x00,
-    0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE9, 0x6D,
-    0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC,
-    0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC,
-    0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0x90, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0x0F, 0x80, 0x01, 0x83, 0xD0, 0x00,
-    0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x82, 0xFD, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x7F, 0xE9, 0x6D, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0xBF, 0x8F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA,
-    0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x64, 0x14,
-    0x00, 0xBF, 0x8F, 0x00, 0x3F, 0xFF, 0xC0, 0x0B, 0x0F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8, 0x2F, 0xD1, 0xFC, 0x03,
-    0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01,
-    0x40, 0xF4, 0x00, 0x0B, 0xF4, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x64,
-    0x09, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE,
-    0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x64, 0xA0, 0x00,
-    0x3F, 0xD0, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xF4, 0xFC, 0x00, 0x3E, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xE0, 0xBF, 0x41, 0xFC,
-    0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x83, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x83, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFA, 0x5B, 0x40, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0x42, 0xE0, 0x00, 0x0B, 0xF4, 0xA0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7D, 0x2F,
-    0x00, 0x00, 0x64, 0x09, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA,
-    0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00,
-    0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x01, 0x90,
-    0xC0, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xF4, 0xFC, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00,
-    0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x09, 0x3C, 0x00, 0x01,
-    0x41, 0xF4, 0x00, 0x0B, 0xF4, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x64,
-    0x09, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE,
-    0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xDF, 0x40, 0x00, 0x09, 0x3D, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x19, 0x2D,
-    0x00, 0x03, 0xFD, 0x20, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x0F, 0x80, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFE,
-    0x0B, 0xF4, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x80, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xA5, 0xB4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0x00,
-    0x00, 0xFF, 0xEF, 0x40, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBE, 0x2F, 0x00, 0x00, 0xA4, 0x0A, 0x00, 0x15, 0x55, 0x55, 0x54,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C,
-    0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE, 0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xB8, 0x14, 0x00, 0xBF, 0xDF, 0x00, 0x3D, 0xFF, 0xC0, 0x06, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xE3, 0xF4, 0x03, 0xE0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF8,
-    0x2F, 0xD1, 0xFC, 0x03, 0xF8, 0xFE, 0x00, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE3, 0xF8,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x96, 0xD0, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFD,
-    0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFE, 0xAA, 0x40, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x10, 0x03, 0xFC, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xBC, 0x03, 0xFE,
-    0xAA, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF7, 0xE0, 0x00,
-    0xF4, 0x7C, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFE, 0x0B, 0xF4, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x3F, 0x8F, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xA5, 0xB4,
-    0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0F,
-    0xAF, 0x80, 0xF0, 0xF8, 0x00, 0x1F, 0x40, 0x1F, 0xD0, 0x00, 0xF0, 0x00, 0x04, 0x00, 0x15, 0x55,
-    0x43, 0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x07, 0xF8, 0x0B, 0xFF, 0x83,
-    0xD2, 0xF0, 0x20, 0xBC, 0x01, 0xBC, 0x00, 0xF4, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x07, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07,
-    0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x2F, 0xFF, 0x4F, 0xFF, 0xD0, 0x15, 0x55, 0x43,
-    0xFF, 0xFD, 0x2F, 0xFF, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0xD3, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0x40, 0x00, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0,
-    0x2F, 0xE0, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x02, 0xFE, 0x00,
-    0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x01,
-    0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xE0, 0x07,
-    0xF8, 0x00, 0xB8, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03,
-    0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC,
-    0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xF4, 0x1F,
-    0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F,
-    0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4,
-    0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0,
-    0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0x08, 0x2F, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFD,
-    0x1F, 0xF4, 0x1F, 0xD0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFE, 0x01, 0xFE, 0x07, 0xFE, 0x1F, 0xF0,
-    0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x07, 0xC0, 0x00, 0x03,
-    0xFC, 0x70, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x02, 0x80, 0x20, 0x00,
-    0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB,
-    0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00,
-    0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F,
-    0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1A, 0x1C, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x0B, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4,
-    0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x05, 0x0F, 0x40, 0x00, 0x03, 0xFC, 0x34, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x06, 0xFA, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD,
-    0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00,
-    0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01,
-    0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x1A, 0x0A, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0xFC, 0xBD, 0x00, 0x0B, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7A, 0xF0, 0x00, 0x00, 0x02,
-    0x1E, 0x00, 0x00, 0x05, 0x0B, 0xC0, 0x00, 0x03, 0xFC, 0xB0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x2F, 0x0F, 0x80, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC,
-    0x00, 0x0B, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0,
-    0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x06, 0x1F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x1A, 0x1E, 0x00, 0x02, 0xFE, 0x24, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x0B, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F,
-    0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x1F, 0x83, 0x80, 0x00, 0x07, 0xFF, 0xBC, 0x00, 0x00, 0x78, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x02, 0x80, 0x24, 0x00, 0x00, 0x06, 0xFA, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x0B, 0xFC, 0x7F,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03,
-    0xFD, 0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xC7, 0xFC,
-    0x00, 0x0B, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x08, 0x00, 0x07, 0xFD,
-    0xB4, 0x00, 0x2E, 0xBF, 0xD0, 0x00, 0x30, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x2F, 0x80, 0x02, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFF, 0x41, 0xFD,
-    0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFA, 0xF8, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x07,
-    0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xF8, 0x3F, 0xC0,
-    0x00, 0xBF, 0xC7, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD,
-    0xFF, 0x40, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFC, 0x00,
-    0x03, 0xFC, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x5B, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0x7F, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x03, 0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x47, 0xFD, 0x07, 0xF4, 0x07,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC,
-    0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x80, 0x7F, 0x81, 0xFF, 0x87, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFD,
-    0x01, 0xA0, 0x00, 0x09, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xBF, 0x90, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x0B, 0xF4,
-    0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0xBF, 0xC1, 0xFE, 0x00, 0x00, 0xFF, 0x4B, 0xF4, 0x00, 0x03,
-    0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF, 0x4F,
-    0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0xFF, 0xC0,
-    0x07, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x06, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x05, 0x51, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4,
-    0x7F, 0xD0, 0x1F, 0xD0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF8,
-    0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x01, 0xA0, 0x00, 0x00, 0x60, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x01, 0xBF, 0x90, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80,
-    0x7F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0xBF, 0xC1, 0xFE, 0x00, 0x00, 0xFF,
-    0x4B, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFD,
-    0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00,
-    0xBF, 0x40, 0xFF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01,
-    0x81, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x51, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xF4, 0x7F, 0xD0, 0x1F, 0xD0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0,
-    0x1F, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x06, 0x80, 0x00,
-    0x2D, 0x00, 0x3F, 0x80, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x06, 0xFE, 0x43, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFE, 0x01, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0xFF, 0x80,
-    0xFF, 0x00, 0x02, 0xFF, 0x07, 0xF8, 0x00, 0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40,
-    0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x02, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x07,
-    0xFF, 0x96, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00,
-    0x20, 0xBC, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x05, 0x51, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xF4, 0x7F, 0xD0, 0x1F, 0xD0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F,
-    0xF8, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x05, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x0E, 0x2F,
-    0xD0, 0x68, 0x00, 0x00, 0x14, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x6F, 0xE4, 0x3F,
-    0x40, 0x2F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xE0, 0x1F, 0xFC, 0x02, 0xFD,
-    0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0x80, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x00,
-    0xFF, 0x4F, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3,
-    0xFE, 0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x3F, 0xF0,
-    0x01, 0xFF, 0x00, 0x7F, 0xF9, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0xFF, 0x1E, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x01, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x11, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05,
-    0x51, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x7F, 0xD0, 0x1F, 0xD0,
-    0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x1F, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xBF, 0x90, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x00, 0xBF, 0xC1, 0xFE, 0x00, 0x00, 0xFF, 0x4B, 0xF4, 0x00, 0x03, 0xFD, 0x3F, 0xD0,
-    0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03,
-    0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0xFF, 0xC0, 0x07, 0xFC, 0x01,
-    0xFF, 0xE5, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x51, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x7F, 0xD0, 0x1F, 0xD0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xE0, 0x1F, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x15, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0xC1, 0xFF,
-    0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFD, 0x00,
-    0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0, 0x01, 0x50, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xEB, 0xD0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x15, 0x55, 0x40, 0x55,
-    0x54, 0xBF, 0xFF, 0xC1, 0xFF, 0xFE, 0x7F, 0xFF, 0x40, 0xBF, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xD0,
-    0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xF8,
-    0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x60, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0, 0x01, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x1A, 0x00, 0x00, 0x24, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x55, 0x55, 0x01, 0x56, 0xFD, 0xBF, 0xFF, 0xC1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD0, 0x2F,
-    0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F,
-    0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
-    0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xF0,
-    0x00, 0x2F, 0xF9, 0x6F, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xF0, 0x2F, 0xFE, 0x2F, 0xFC, 0x2F, 0xFD,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00,
-    0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x1A, 0x00, 0x00,
-    0x01, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x55, 0x55, 0x01, 0x56, 0xFD, 0xBF, 0xFF,
-    0xC1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80,
-    0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xF9, 0x6F, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2F,
-    0xF0, 0x2F, 0xFE, 0x2F, 0xFC, 0x2F, 0xFD, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x06, 0x80, 0x00, 0x07, 0x80, 0x03, 0xF8,
-    0x00, 0x00, 0x40, 0x00, 0xFE, 0x15, 0x55, 0x40, 0x55, 0xBF, 0x6F, 0xFF, 0xF0, 0x7F, 0xFF, 0x47,
-    0xFF, 0xF4, 0x0B, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01,
-    0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0x40, 0x07, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xFE, 0x5B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x00, 0x92, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x70, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x4B,
-    0xFC, 0x0B, 0xFF, 0x8B, 0xFF, 0x0B, 0xFF, 0x40, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xF8, 0xFF, 0xC0, 0x01, 0x50, 0x14, 0x00, 0x00, 0x01, 0x90, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x7F, 0x80, 0x68,
-    0x00, 0x00, 0x01, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0x55, 0x54, 0x05, 0x5B, 0xF6,
-    0xFF, 0xFF, 0x07, 0xFF, 0xF4, 0x7F, 0xFF, 0x40, 0xBF, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00,
-    0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01,
-    0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07,
-    0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xC0, 0x01, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xE5, 0xBF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x04, 0x00, 0x00, 0x3F, 0xD7, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0x4B, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0xBF, 0xC0, 0xBF,
-    0xF8, 0xBF, 0xF0, 0xBF, 0xF4, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0x8F, 0xFC, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x55, 0x55, 0x01, 0x56, 0xFD, 0xBF, 0xFF,
-    0xC1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x80,
-    0x00, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xF9, 0x6F, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xF0, 0x2F, 0xFE, 0x2F, 0xFC, 0x2F, 0xFD,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0xBF, 0xEB, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xE3, 0xFF, 0x00,
-    0x05, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0xBF, 0xFF, 0x87,
-    0xFF, 0xE7, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x1F, 0xC0, 0x01,
-    0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xCF, 0xC0, 0x00, 0x02, 0xFE, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFF,
-    0x1F, 0xFF, 0x82, 0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07,
-    0xE0, 0x00, 0xBF, 0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F,
-    0x7F, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0, 0x03,
-    0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC, 0xFC,
-    0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x82,
-    0xFF, 0x80, 0xFF, 0x40, 0x2F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xE0, 0x00, 0xBF,
-    0x43, 0xF4, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x2A, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0xBF, 0xFE, 0x0B,
-    0xF4, 0x2F, 0xFE, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x01, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x15, 0x55,
-    0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xE0,
-    0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0, 0x00, 0x03, 0xFC,
-    0xFC, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x1B, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x00, 0x91, 0xF0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xE0, 0xBF, 0xE0, 0x3F, 0xD0,
-    0x0B, 0xE0, 0x07, 0xF8, 0x03, 0xF0, 0x00, 0xFF, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0xFD, 0x00, 0x03,
-    0xF8, 0x3F, 0x00, 0x00, 0xBF, 0x2F, 0x40, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x03, 0xFD, 0x3C, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x03, 0x8B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x01, 0x55, 0x4B, 0xFF, 0xF8, 0x7F, 0xFE, 0x7F, 0xFE, 0x02, 0xFF, 0x80, 0xBF,
-    0xC0, 0x0F, 0xE0, 0x03, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0xFF, 0x47, 0xE0,
-    0x00, 0x03, 0xFC, 0xFC, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x3F, 0xD3, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03,
-    0x87, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x3F, 0xFC, 0x7F, 0xFE, 0x0B, 0xFE, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x7F, 0x80, 0x3F,
-    0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x02, 0xFD, 0x0F, 0xD0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x0B, 0xF2,
-    0xF4, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x03, 0x0C, 0x2F,
-    0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00,
-    0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x2F,
-    0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x2F, 0xFF, 0x4F, 0xFF, 0xE3, 0xFF, 0xF4, 0x15, 0x55, 0x55,
-    0x4F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xF4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x54, 0x05, 0x3F, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE,
-    0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB,
-    0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF,
-    0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xBF, 0x0B, 0xEF, 0xC2, 0xFB, 0xF0, 0xBE, 0xFC, 0x2F, 0xAA,
-    0x06, 0x90, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x01, 0x40, 0x7C, 0x0F, 0x82, 0xF0, 0x3F,
-    0x03, 0xF0, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x05, 0x02, 0xFC, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8,
-    0x2F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8, 0x1F, 0x03,
-    0xD0, 0x14, 0x00, 0x05, 0x02, 0xFC, 0x3F, 0x83, 0xF0, 0x3F, 0x01, 0xF4, 0x0F, 0x80, 0x3C, 0x00,
-    0x00, 0x01, 0x40, 0x50, 0x1F, 0x07, 0xC0, 0xF8, 0x3E, 0x0B, 0xC2, 0xF0, 0x3F, 0x0F, 0xC0, 0xFC,
-    0x3F, 0x03, 0xF8, 0xFE, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0xBF, 0x2F, 0xC1,
-    0xFC, 0x7F, 0x03, 0xF0, 0xFC, 0x0F, 0xC3, 0xF0, 0x3E, 0x0F, 0x82, 0xF0, 0xBC, 0x0F, 0x43, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x2F, 0x82, 0xFC, 0xBF, 0x03, 0xF0, 0xFC, 0x0F, 0xC3,
-    0xF0, 0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x0F, 0x43, 0xD0, 0x14, 0x05, 0x00, 0x05, 0x01, 0x40, 0xBF,
-    0x2F, 0xC3, 0xF8, 0xFE, 0x0F, 0xC3, 0xF0, 0x3F, 0x0F, 0xC0, 0x7D, 0x1F, 0x40, 0xF8, 0x3E, 0x00,
-    0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E,
-    0x00, 0x24, 0x3D, 0x19, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x29, 0x3D, 0x19, 0x00, 0x3D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x3E, 0x00, 0x24, 0x3D, 0x19, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x24, 0x3D, 0x19,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x3E, 0x7E, 0x6E, 0x3F,
-    0xFF, 0xFE, 0x3F, 0xBE, 0xBE, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xDF, 0xFD, 0xFF, 0xD3, 0xF8, 0x00, 0x00, 0x24,
-    0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F, 0xFF, 0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8,
-    0x00, 0x10, 0x00, 0x00, 0x19, 0x1F, 0xEB, 0xFD, 0xFE, 0x04, 0x00, 0x06, 0x40, 0x64, 0x3F, 0xC2,
-    0xFD, 0x3F, 0xD3, 0xFE, 0x3F, 0xC2, 0xFD, 0x05, 0x00, 0x50, 0x06, 0x40, 0x06, 0x40, 0x01, 0x40,
-    0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC3, 0xFD, 0x02, 0xFE, 0x01, 0xFF, 0x0F, 0xF0, 0x07, 0xF4, 0x03,
-    0xFC, 0x05, 0x00, 0x05, 0x00, 0x01, 0x40, 0x2F, 0x5F, 0xFB, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00,
-    0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x04,
-    0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C,
-    0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-    0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40,
-    0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x2F, 0x47, 0xE2, 0xF0,
-    0xBF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0xF0, 0xF4, 0xFE, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xE0, 0xF8,
-    0x7D, 0x0F, 0xC3, 0xF0, 0xBD, 0x00, 0x00, 0x7C, 0x2F, 0x03, 0xF0, 0xF8, 0x1F, 0x80, 0x00, 0x3E,
-    0x0F, 0xC0, 0xBC, 0x7D, 0x03, 0xE0, 0x00, 0x2F, 0x03, 0xF0, 0x2F, 0x1F, 0x40, 0xF8, 0x00, 0x0F,
-    0x80, 0xFC, 0x0F, 0xC7, 0xE0, 0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x43, 0xE0, 0xFC, 0x2F, 0x00, 0x07,
-    0xD0, 0x03, 0xFB, 0xF0, 0x2F, 0xEF, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x00,
-    0x74, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x3F, 0x02, 0xFC, 0x0F, 0xD0, 0xBF, 0x03, 0xF0, 0x0F, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x03, 0xF0, 0xFE, 0x0B, 0xF0, 0xFD, 0x0F, 0xD2, 0xFC, 0x2F,
-    0xC3, 0xF4, 0x3F, 0x0B, 0xE0, 0x3D, 0x0B, 0xC0, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x07, 0xC0, 0xF4, 0x03, 0xF0, 0xFE, 0x1F, 0xC0, 0xBF, 0x0F, 0xD3, 0xFC, 0x0F, 0xD2, 0xFC,
-    0x3F, 0x42, 0xFC, 0x3F, 0x4B, 0xE0, 0x3F, 0x0B, 0xE0, 0xFC, 0x03, 0xD0, 0xBC, 0x0F, 0x40, 0x14,
-    0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0x7F,
-    0x00, 0xBC, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x3F, 0x4B, 0xF0, 0x3F, 0xC7, 0xF0,
-    0x1F, 0xC3, 0xF8, 0x0B, 0xE1, 0xFC, 0x03, 0xF0, 0xBE, 0x01, 0xF0, 0x3E, 0x00, 0x50, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x3F, 0x4B, 0xF0, 0xFC, 0x03, 0xFC, 0x7F, 0x0F,
-    0xE0, 0x1F, 0xC3, 0xF8, 0x7F, 0x00, 0xBE, 0x1F, 0xC3, 0xF8, 0x03, 0xF0, 0xBE, 0x0F, 0xC0, 0x1F,
-    0x03, 0xE0, 0x7C, 0x00, 0x50, 0x08, 0x01, 0x40, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0,
-    0x07, 0xE3, 0xE0, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8, 0x0B,
-    0xF0, 0x3F, 0xC0, 0x3F, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x07, 0xF0, 0x0B, 0xF0, 0x0B, 0xF4, 0x0F, 0xE0, 0xBF, 0x47, 0xF4, 0x3F, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x2C, 0x7C, 0x07, 0xC0, 0x7C, 0x2F,
-    0x0B, 0xD1, 0xF0, 0x0B, 0xC3, 0x87, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x08,
-    0x3E, 0xF4, 0x50, 0x3F, 0x0F, 0xD1, 0xF8, 0x3F, 0x0F, 0xD1, 0xF8, 0x04, 0x3E, 0xF4, 0x50, 0x00,
-    0xF8, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xC7, 0x87, 0xC0, 0x2F, 0x0B, 0xD1, 0xF0, 0x7C,
-    0x07, 0xC0, 0x7C, 0x70, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x2A, 0x0F, 0xF0,
-    0x2F, 0xC3, 0xF8, 0x0F, 0xF1, 0xFD, 0x03, 0xF8, 0x7F, 0x40, 0xFE, 0x0F, 0xD0, 0x3F, 0x83, 0xF0,
-    0x0F, 0xD0, 0xFC, 0x03, 0xF4, 0x3F, 0x00, 0xFD, 0x0F, 0xC0, 0x2F, 0x43, 0xF0, 0x0B, 0xD0, 0xFC,
-    0x02, 0xF4, 0x2F, 0x00, 0x7D, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x2F,
-    0xC0, 0x7F, 0x4F, 0xF0, 0x3F, 0xD3, 0xFC, 0x0B, 0xF0, 0x14, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x2F, 0xF4, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFE,
-    0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x24, 0x1F, 0xD0, 0x50,
-    0x7F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0x6F, 0xF0, 0x01, 0xBF, 0xC0, 0xBF, 0xFD, 0x01, 0xFF, 0xF4, 0x0F, 0xFF, 0x40,
-    0x3F, 0xFD, 0x00, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x14,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x0A, 0x82, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0x00,
-    0x3F, 0x83, 0xFF, 0xFC, 0x03, 0xF8, 0x24, 0x1F, 0xD0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF4, 0x00,
-    0x02, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x6F, 0xF0, 0x3F, 0x00, 0xBF, 0xFD, 0x03,
-    0xF0, 0x0F, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0x40, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x78,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x2F,
-    0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x50, 0x0A, 0x80,
-    0x04, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x3F, 0x81, 0xFF, 0xFC, 0x07, 0xF4, 0x0F, 0xFF, 0xF0,
-    0x7F, 0x40, 0x90, 0x7F, 0x43, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0x00, 0xBC, 0x3F, 0x00, 0x01, 0xBF, 0xC3, 0xF0, 0x02, 0xFF, 0xF4, 0x3F, 0x00, 0x3F, 0xFD, 0x03,
-    0xF0, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xD3,
-    0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x3D, 0x07, 0xC0, 0x3F, 0x0F, 0xE1, 0xFC, 0x3F,
-    0x82, 0xFC, 0x3F, 0x4F, 0xF1, 0xFD, 0x0F, 0xD2, 0xFC, 0x3F, 0x4F, 0xF0, 0xBF, 0x0F, 0xD2, 0xF8,
-    0x3F, 0x03, 0xF0, 0xBE, 0x0F, 0xC2, 0xF4, 0x0F, 0x42, 0xF0, 0x3D, 0x0F, 0x80, 0x14, 0x02, 0x00,
-    0x50, 0x08, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x01, 0xFE, 0xFF, 0x0F, 0xD0, 0xFD, 0x3F, 0x02,
-    0xF9, 0xF8, 0x07, 0xE7, 0xE0, 0x1F, 0x9F, 0x80, 0xBD, 0x3F, 0x03, 0xF0, 0xFE, 0x2F, 0xC1, 0xFF,
-    0xFC, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBE, 0x00, 0x07, 0xF8, 0x00,
-    0x3F, 0xE0, 0x03, 0xEF, 0x80, 0x2F, 0x3E, 0x01, 0xF0, 0xF8, 0x0F, 0x97, 0xF4, 0x3F, 0xFF, 0xF8,
-    0x6A, 0xBF, 0x90, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x55, 0x03, 0xFF, 0xD0,
-    0xFF, 0xF4, 0x7C, 0x00, 0x1F, 0x90, 0x0B, 0xFF, 0x40, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x40,
-    0x2F, 0xC7, 0xFF, 0xD0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1F, 0xFC, 0x0B, 0xF9,
-    0x01, 0xFC, 0x00, 0x3F, 0x94, 0x07, 0xFF, 0xF0, 0xBD, 0x6F, 0xCB, 0xC0, 0xFC, 0xBD, 0x0B, 0xC7,
-    0xF0, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x07, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xC7, 0xC0, 0xF4, 0x24, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x07, 0xFF, 0xC3,
-    0xE1, 0xF9, 0xF4, 0x3E, 0x3F, 0x1F, 0x47, 0xFF, 0x41, 0xFF, 0xE1, 0xF8, 0xBE, 0xFC, 0x0F, 0xFF,
-    0x03, 0xF7, 0xFF, 0xF4, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0xFF, 0xE0, 0x7F, 0xBF,
-    0x4B, 0xC0, 0xFC, 0xBC, 0x0F, 0xCB, 0xE0, 0xFC, 0x3F, 0xFF, 0xC0, 0xBF, 0xF8, 0x00, 0x3F, 0x00,
-    0x1F, 0xD0, 0x7F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x3F, 0xBF, 0xD0,
-    0x1F, 0xFB, 0xF0, 0x0B, 0xC1, 0xF0, 0x0B, 0xC1, 0xF0, 0x0B, 0xC1, 0xF0, 0x0B, 0xC1, 0xF0, 0x1F,
-    0xD3, 0xF8, 0x3F, 0xE7, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xFF, 0x42, 0xFD, 0x7F, 0x0F, 0xC0, 0xBD,
-    0x7E, 0x02, 0xF9, 0xF8, 0x07, 0xE7, 0xE0, 0x2F, 0x9F, 0x80, 0xBD, 0x3F, 0x03, 0xF0, 0xBF, 0xBF,
-    0x80, 0xFF, 0xF8, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x02,
-    0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x01, 0xBF, 0xE0, 0xFF,
-    0xFD, 0x15, 0x55, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xF4, 0xBE, 0x2F, 0x8B, 0xC1, 0xF8, 0x14, 0x2F,
-    0x40, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x80, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0,
-    0x55, 0x40, 0x0B, 0xF8, 0x0F, 0xFF, 0xC7, 0x82, 0xF4, 0x80, 0xBC, 0x00, 0xBD, 0x03, 0xFF, 0x40,
-    0x6B, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0x9A, 0xBF, 0xCB, 0xFF, 0xC0, 0x69, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xDF, 0x80, 0x3D, 0x3E, 0x02, 0xE0, 0xF8,
-    0x1F, 0xEB, 0xF9, 0x3F, 0xFF, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x02, 0x90, 0x0A, 0xAA,
-    0x43, 0xFF, 0xD1, 0xFA, 0xA0, 0x7C, 0x00, 0x1F, 0xF4, 0x07, 0xFF, 0xC0, 0x07, 0xF4, 0x00, 0x7E,
-    0x00, 0x2F, 0x4A, 0xBF, 0xC7, 0xFF, 0xC0, 0x69, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF8, 0x0F, 0xF4,
-    0x03, 0xF8, 0x00, 0x7F, 0xF9, 0x0B, 0xFF, 0xF4, 0xBC, 0x0F, 0xCB, 0xC0, 0xBC, 0xBD, 0x0F, 0xC3,
-    0xFA, 0xF8, 0x1F, 0xFF, 0x00, 0x1A, 0x40, 0x2A, 0xAA, 0x87, 0xFF, 0xFC, 0x7E, 0xAF, 0xC7, 0x82,
-    0xF0, 0x10, 0x3D, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0x28, 0x00, 0x07, 0xFD, 0x0B, 0xFF, 0xD3, 0xD0, 0xF9, 0xF8, 0x3E, 0x3F, 0xBF,
-    0x03, 0xFF, 0x02, 0xFF, 0xF6, 0xF0, 0x7F, 0xFC, 0x0F, 0xEF, 0x47, 0xE3, 0xFF, 0xE0, 0x1A, 0x80,
-    0x0B, 0xF8, 0x03, 0xFF, 0xF0, 0xBE, 0x2F, 0x8B, 0xC0, 0xFC, 0xBC, 0x0F, 0xC7, 0xF5, 0xFC, 0x2F,
-    0xFF, 0xC0, 0x1B, 0xF4, 0x00, 0xBF, 0x01, 0xBF, 0xC0, 0x7F, 0xF0, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0x95, 0xBE, 0x07, 0xF4, 0x03, 0xE0,
-    0x7F, 0x40, 0x2D, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xF0, 0x07, 0xF9, 0x54, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xF0, 0xBF, 0x00, 0x3F, 0x40, 0xFC,
-    0x00, 0xFC, 0x03, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x6F, 0xD5, 0x50, 0x0F, 0xFF, 0xFF, 0x40, 0x17,
-    0xFD, 0x54, 0x00, 0x0F, 0xE5, 0x50, 0x07, 0xFF, 0xFF, 0xC0, 0x1A, 0xFE, 0xA9, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0A, 0xFE, 0xAA, 0xBE, 0x3F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x50, 0x00, 0x54, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x82, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x7F, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xBF, 0x07, 0xFA, 0x90, 0x2F, 0xE0, 0x03, 0xF8, 0x2F, 0xE3, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x2B, 0xFA, 0x83, 0xF0, 0x7C, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x40,
-    0x3F, 0x43, 0x40, 0x3F, 0xD4, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x18, 0x1F, 0xC0, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x13, 0xC0, 0xFC, 0x2F, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0x3F, 0xAF, 0x87, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xD0, 0xBC, 0x00, 0xFF, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0xB4, 0x03,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x6F,
-    0xFA, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0xBC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xAA, 0xAA, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xC0, 0x1F, 0xBF, 0xFD, 0x0B, 0xCF, 0xCF, 0x80, 0xD3, 0xF1, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAB, 0xF8,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0xD3, 0xF2, 0xC0, 0xFC, 0xFD, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x3E, 0x02,
-    0xF0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD2, 0xFA, 0xAA, 0xAF, 0xE0, 0x2F, 0x40, 0x07, 0xE0, 0x03, 0xF8, 0x0B, 0xF0, 0x00,
-    0x3D, 0x01, 0xF0, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x74, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0xF4,
-    0x07, 0xFF, 0xF4, 0x7E, 0xFE, 0xF4, 0xF3, 0xF3, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x01, 0x4F, 0xC5, 0x1F, 0x3F, 0x3D, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x07, 0xCF, 0xCF, 0x40, 0x53, 0xF1, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0x4F, 0xC5, 0x01, 0xF3, 0xF3, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x38, 0x3E, 0x02, 0xF8, 0xF8, 0x2F, 0x83, 0xE2, 0xF4, 0x0F,
-    0xAF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xAA, 0x90, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x0B, 0x00, 0xBC, 0xBE, 0x02, 0xF0, 0xBE, 0x0B,
-    0xC0, 0x7E, 0x2F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0xAA, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x7D, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x2F, 0x40, 0x1C, 0x00, 0xBD, 0x01, 0xFC, 0x01, 0xF4, 0x1F, 0xC0, 0x07, 0xC1, 0xF8, 0x00, 0x1F,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA, 0xAA, 0x80, 0xBD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xAF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xAA, 0xA0, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x45, 0x55, 0x60, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x3F, 0xE2,
-    0xFF, 0x03, 0xF7, 0x8B, 0x7F, 0x07, 0x1E, 0x2D, 0x34, 0x00, 0x78, 0xB4, 0x00, 0x01, 0xE2, 0xD0,
-    0x00, 0x0B, 0x8B, 0x40, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00,
-    0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0xAA, 0xAB, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x02, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0x55, 0x54, 0x7E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x02,
-    0xE2, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2,
-    0xE0, 0x00, 0x07, 0x8B, 0x40, 0x00, 0x1E, 0x2D, 0x00, 0x00, 0x78, 0xB4, 0x00, 0xB1, 0xE2, 0xD3,
-    0x83, 0xFB, 0x8B, 0xBF, 0x03, 0xFE, 0x2F, 0xF0, 0x02, 0xF8, 0xBE, 0x00, 0x02, 0xF7, 0xE0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
-    0x0F, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x0F, 0xD5, 0x5F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xAA, 0xAA, 0xAB, 0xC7, 0xC0, 0x00, 0x00, 0xF4, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x52, 0xFE, 0x00, 0x00, 0xBE, 0x1F, 0xF0, 0x00, 0x0F,
-    0xC0, 0xFF, 0x40, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xEA, 0xAB, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0x40,
-    0x00, 0x7F, 0x83, 0xF0, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x01, 0xFE,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x3F, 0xFE, 0x00,
-    0x3F, 0xFF, 0xE0, 0x0D, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC,
-    0x00, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1, 0xFE, 0x6F, 0xF0, 0xFD, 0x02, 0xF8, 0xBE, 0x00, 0xFE,
-    0x3F, 0x40, 0x3F, 0x5F, 0xC0, 0x0F, 0xC7, 0xF0, 0x07, 0xE1, 0xFC, 0x03, 0xF4, 0x7F, 0x02, 0xFC,
-    0x0F, 0xE6, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x95, 0x56, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE2, 0xAA,
-    0x9B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF9, 0xFE,
-    0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xF9, 0x01, 0xD0, 0x03, 0xFF, 0xFF, 0x9F, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0xBF,
-    0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x41, 0xFD, 0x00, 0x0F, 0xFE, 0x0B, 0xF0, 0x00, 0xFA, 0xFC, 0x3F,
-    0x40, 0x0F, 0x87, 0xF0, 0xFD, 0x00, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0x80, 0x7F, 0x0F, 0xD0, 0xF8,
-    0x01, 0xFC, 0x3F, 0x4F, 0x80, 0x0B, 0xF0, 0xFE, 0xFC, 0x00, 0x3F, 0x82, 0xFF, 0xC0, 0x01, 0xFC,
-    0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xFE, 0x57, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xC7,
-    0xFF, 0xFD, 0x00, 0x0C, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x0F, 0xAF, 0xD0, 0x00, 0x07, 0xD3, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00,
-    0xF8, 0x1F, 0xE0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0,
-    0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0xFF, 0x42, 0xF4, 0x00, 0x1F, 0xF0, 0xFD, 0x00, 0x07,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x55, 0x55, 0x55, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x40, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0xFD, 0x03,
-    0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xE0,
-    0x00, 0xBF, 0x42, 0xF4, 0x00, 0x1F, 0xE0, 0xFC, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00, 0xBF, 0x6F,
-    0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40,
-    0x1B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x05, 0x6F, 0xD4, 0x01, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAB,
-    0xFE, 0x92, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x2F, 0xC0,
-    0x0F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xFE, 0xAA, 0xAF,
-    0xC0, 0x7E, 0x00, 0x07, 0xF4, 0x2F, 0x40, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x1F, 0xFB, 0xE0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0xBF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xAA, 0xAA,
-    0x9F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x55, 0x55, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x56, 0xAA, 0xA4, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x01, 0xAA, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05,
-    0xFE, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1A, 0xFF, 0xAB, 0xFE,
-    0x00, 0x1F, 0xC0, 0x2F, 0xE0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0,
-    0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xEA, 0xBF, 0x80, 0x02,
-    0xF4, 0x0F, 0xE0, 0x00, 0x7E, 0x07, 0xF4, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x02, 0xFB, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xBF, 0x80,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0xBF, 0xD0, 0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x05, 0x55, 0x55,
-    0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0xBD, 0x0B, 0xF8, 0x00,
-    0x3D, 0x03, 0xFD, 0x00, 0x3C, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x03, 0xF8, 0x00,
-    0x1F, 0x0B, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xBF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x3C, 0x7C, 0x78,
-    0xBF, 0xBE, 0xFC, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0xBF, 0xBF, 0xFC, 0x3C,
-    0x7C, 0x78, 0x10, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x14, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF0,
-    0x3F, 0xBF, 0xCB, 0xC0, 0xBC, 0xBC, 0x07, 0xCB, 0xC0, 0x7C, 0x7E, 0x5F, 0xC3, 0xFF, 0xF4, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xAA, 0x00, 0x3D, 0x01, 0xFF, 0xC0, 0x1F, 0x00, 0x7F,
-    0xF0, 0x0B, 0xC0, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x2F, 0x81, 0xF0, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0xFC, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0x40, 0x00, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x42, 0xFF, 0x01, 0xF1, 0xFF, 0xF2, 0xF8, 0xFC, 0x3F, 0xF4, 0x3D,
-    0x03, 0xF4, 0x0F, 0x40, 0xFD, 0x03, 0xF0, 0xFF, 0xD0, 0xBF, 0xFC, 0xFE, 0x0F, 0xFC, 0x0F, 0xC0,
-    0x54, 0x00, 0x60, 0x01, 0x40, 0x01, 0x40, 0x1F, 0xF4, 0x1F, 0xF0, 0x3F, 0xFD, 0x7F, 0xFC, 0x7D,
-    0x3F, 0xF4, 0xBC, 0xBC, 0x0F, 0xD0, 0x3C, 0xBC, 0x0F, 0xE0, 0x3C, 0xBC, 0x2F, 0xF4, 0xBC, 0x7F,
-    0xFC, 0xBF, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x05, 0x40, 0x05, 0x40, 0x15, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x15, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2A, 0x54, 0x05, 0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0,
-    0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2,
-    0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B,
-    0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F,
-    0x6A, 0x06, 0x80, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x3F,
-    0x3F, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0xBE, 0x00,
-    0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xFD, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x4B,
-    0xF0, 0x00, 0x02, 0xFC, 0x14, 0x00, 0x00, 0x05, 0x47, 0xF0, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00,
-    0x3F, 0x42, 0xF8, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD,
-    0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xF4, 0x07, 0xF8, 0x3F, 0x40, 0x07, 0xF1, 0xFC, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x2F, 0x5F,
-    0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80,
-    0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00,
-    0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD0, 0x14, 0x00, 0x00, 0x51, 0xF8, 0x00, 0x0B,
-    0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7,
-    0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0,
-    0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x0F, 0xC3, 0xF8, 0x00,
-    0xBF, 0x0B, 0xFE, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x7C,
-    0x00, 0x0F, 0xF0, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0xE1, 0xFD, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50,
-    0x00, 0x01, 0x40, 0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0xC3, 0xFC, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x43, 0xFC, 0x7F, 0xC3, 0xF8, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0,
-    0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00,
-    0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xF8,
-    0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x01, 0x82, 0xFF, 0xF9, 0x1F, 0x5F, 0xDB, 0xFF, 0xFC,
-    0x78, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xA8, 0x7F,
-    0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFE, 0x02,
-    0xD3, 0xFF, 0xF9, 0xF8, 0xF9, 0xBF, 0xFD, 0x3C, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x74, 0xBF, 0xFD, 0x7E, 0x3F, 0x7F, 0xFF, 0x4F, 0x01, 0xFF, 0x80, 0x40, 0x05, 0x00, 0x10, 0x00,
-    0x00, 0x10, 0xFE, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0x01, 0xAF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA4, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAB, 0xF0,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x03, 0xD0, 0xBF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFD, 0x6A, 0xBF, 0xA8, 0x00, 0x7C, 0x00, 0x15, 0xF9, 0x54, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFD, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA,
-    0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x24, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x1B,
-    0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x80, 0x6F, 0xF4, 0x07, 0xFE,
-    0x01, 0xFF, 0x90, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xE0,
-    0x1B, 0xFD, 0x00, 0x01, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x2F,
-    0xD0, 0x07, 0xF8, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x01,
-    0xFF, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA,
-    0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0x90, 0x3F, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xC0, 0x0B, 0xF0, 0x03,
-    0xF0, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x7E, 0x00, 0x03, 0xFC,
-    0x2F, 0x40, 0x00, 0xBF, 0xEF, 0xD5, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFE, 0xAA, 0xA4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xF8, 0x00, 0x07, 0xE0, 0xBF, 0x00, 0x03, 0xF4, 0x0F, 0xE0,
-    0x00, 0xFC, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x0F, 0xF1, 0x57, 0xF5, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x06, 0xBF, 0xA9, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFA, 0xAA, 0xA8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x95, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0x5A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0xAA, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC1, 0x55,
-    0x55, 0xBF, 0xD1, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0A, 0xAA, 0x95, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xDB, 0x9F, 0xD0, 0x01,
-    0xF4, 0x2E, 0x07, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0xC0, 0xB8, 0x02, 0xE0, 0x0B, 0x83, 0xC0, 0x0B,
-    0x80, 0x0F, 0x1E, 0x00, 0x2E, 0x00, 0x3D, 0x7E, 0xAA, 0xFE, 0xAA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xD5, 0x5B, 0x95, 0x5F, 0x5F, 0x00, 0x2E, 0x00, 0x3D, 0x3C, 0x00, 0xB8, 0x00, 0xF0, 0xB8,
-    0x02, 0xE0, 0x0B, 0x80, 0xF4, 0x0B, 0x80, 0x7C, 0x01, 0xF8, 0x2E, 0x0B, 0xD0, 0x01, 0xFE, 0xBA,
-    0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00,
-    0x00, 0x3D, 0x7E, 0xAA, 0xAA, 0xAA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x55, 0x55, 0x5F,
-    0x5F, 0x00, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0xF4,
-    0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xBB,
-    0xF0, 0x03, 0xEB, 0x83, 0xC3, 0xF0, 0x3E, 0x0F, 0x1E, 0x03, 0xF3, 0xE0, 0x3D, 0x78, 0x03, 0xFE,
-    0x00, 0xB6, 0xE0, 0x03, 0xF0, 0x02, 0xE7, 0x80, 0x3F, 0xF0, 0x0B, 0x5F, 0x03, 0xE3, 0xF0, 0x3D,
-    0x3C, 0x3E, 0x03, 0xF0, 0xF0, 0xBB, 0xE0, 0x03, 0xFB, 0x80, 0xFE, 0x00, 0x03, 0xFC, 0x01, 0xF8,
-    0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0,
-    0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x3F, 0xC0, 0xB8, 0x00, 0x03, 0xEB, 0x83, 0xC0,
-    0x00, 0x3E, 0x0F, 0x1F, 0x00, 0x03, 0xE0, 0x3D, 0x78, 0x00, 0x3E, 0x00, 0xB6, 0xE0, 0x03, 0xE0,
-    0x02, 0xE7, 0x80, 0x3E, 0x00, 0x0B, 0x5F, 0x03, 0xE0, 0x00, 0x3D, 0x3C, 0x3E, 0x00, 0x00, 0xF0,
-    0xBB, 0xE0, 0x00, 0x0B, 0x80, 0xFE, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE,
-    0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x0B, 0xD0, 0xFF,
-    0x40, 0xBF, 0x80, 0x7F, 0xC3, 0xFD, 0x02, 0xFE, 0x01, 0xFF, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7D, 0x04, 0x0B,
-    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x2F, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF,
-    0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFF,
-    0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0xBF, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_boldBitmaps[32787] = {
+    0x1A, 0xAA, 0x1F, 0x1E, 0xA0, 0x9E, 0x90, 0x9E, 0x91, 0xE9, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2A, 0xD2, 0x9D, 0x72, 0x92, 0xAE, 0x1F, 0x1F, 0x29, 0x91, 0x9D, 0xA0, 0x9D, 0x9E, 0xA0, 0xE9,
+    0xE9, 0x0E, 0x0E, 0x90, 0xE0, 0xE9, 0x0E, 0x0A, 0xD1, 0xE0, 0xAD, 0x1E, 0x0A, 0xCA, 0x1D, 0xA7,
+    0x10, 0x77, 0x4A, 0xD2, 0xDA, 0x6E, 0x19, 0xD9, 0x6D, 0xA1, 0xAD, 0x49, 0x9A, 0xDA, 0x99, 0xE9,
+    0x91, 0x9F, 0xFF, 0xC1, 0x9A, 0xAE, 0xAA, 0xFA, 0xA4, 0xDA, 0x1A, 0xD6, 0x9D, 0x91, 0xE6, 0xAD,
+    0x2D, 0xA3, 0x9F, 0xFF, 0xC1, 0xFF, 0xFD, 0x3A, 0xD9, 0x1E, 0x6A, 0xD2, 0xDA, 0x6E, 0x19, 0xD9,
+    0x6D, 0xA1, 0xAD, 0x77, 0x50, 0x59, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x70, 0x9D, 0xA9, 0x59,
+    0xFE, 0xA2, 0xAF, 0xFC, 0x91, 0xE0, 0xD0, 0x9D, 0xA0, 0x9D, 0x90, 0xD1, 0xD9, 0x09, 0xDA, 0x0D,
+    0x19, 0x91, 0x9E, 0xAD, 0x6F, 0xD9, 0x6F, 0xEA, 0x59, 0xFE, 0x6F, 0xD9, 0x1A, 0x2D, 0x0F, 0x0D,
+    0x91, 0xD0, 0x9E, 0x0D, 0xA1, 0xCA, 0x09, 0xDA, 0x0E, 0xA9, 0xCA, 0x9E, 0x1A, 0xFF, 0xC9, 0x29,
+    0xFD, 0xA7, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAA, 0x94, 0x77, 0x71,
+    0x9A, 0xA9, 0x69, 0xCA, 0x69, 0xFD, 0x5E, 0x6E, 0x9A, 0xDA, 0x39, 0xD9, 0x5A, 0xD9, 0x1E, 0x3E,
+    0x6E, 0x2E, 0x29, 0xD7, 0xE2, 0xAD, 0x2D, 0xA7, 0xE2, 0xE1, 0xAD, 0x70, 0xE2, 0xE1, 0xD9, 0x70,
+    0xAD, 0x90, 0x9D, 0xA0, 0xAD, 0x1A, 0xF9, 0x2F, 0xE1, 0xD9, 0x0E, 0xAE, 0x92, 0xAE, 0xA1, 0xDA,
+    0x09, 0xD9, 0x1E, 0x70, 0x9D, 0x1A, 0xD2, 0xE7, 0x0D, 0xA1, 0xE2, 0xAD, 0x7A, 0xD2, 0xE2, 0xAD,
+    0x7D, 0xA2, 0xE2, 0xE6, 0xAD, 0x3A, 0xD9, 0x1D, 0xA5, 0x9D, 0x94, 0xEA, 0xE6, 0xE5, 0x9F, 0xC7,
+    0x9C, 0x97, 0x99, 0x77, 0x73, 0x77, 0x71, 0xAF, 0xA7, 0x4F, 0xEA, 0x72, 0xEA, 0x1E, 0x72, 0xE2,
+    0xAD, 0x71, 0x9E, 0x2E, 0x71, 0x9E, 0x19, 0xD9, 0x72, 0xE9, 0x0D, 0x97, 0x3E, 0xA0, 0xA7, 0x4A,
+    0xF2, 0x9F, 0xD3, 0xFE, 0x19, 0xFD, 0x2A, 0xE0, 0xEA, 0x2E, 0x4E, 0x90, 0x9E, 0xA1, 0xAD, 0x4E,
+    0x2A, 0xEA, 0x0A, 0xD4, 0xE9, 0x2A, 0xFE, 0x4E, 0xA3, 0xAF, 0xCA, 0x4A, 0xEA, 0x3F, 0xDA, 0x93,
+    0xFF, 0xFF, 0xC9, 0x2A, 0xFF, 0x99, 0xFC, 0x69, 0x99, 0x95, 0x99, 0x10, 0x9D, 0xAE, 0xAE, 0x9E,
+    0x9E, 0x9A, 0xD0, 0xAD, 0x0A, 0xCA, 0x40, 0x4A, 0xA4, 0xAD, 0x92, 0xAE, 0x29, 0xE3, 0xE9, 0x29,
+    0xE3, 0xE9, 0x3E, 0x39, 0xDA, 0x3A, 0xDA, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xAD,
+    0xA3, 0x9E, 0x4E, 0x93, 0xAD, 0xA4, 0xE9, 0x3A, 0xE4, 0xEA, 0x4E, 0xA4, 0xD7, 0x00, 0x09, 0xC6,
+    0xE5, 0xAE, 0x5A, 0xE5, 0xE9, 0x49, 0xE5, 0xE9, 0x4A, 0xDA, 0x49, 0xE5, 0xE5, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE5, 0xE4, 0x9D, 0xA4, 0xE9, 0x4E, 0x4E, 0x93, 0x9E, 0x4E, 0x93, 0xE9, 0x4A,
+    0xC9, 0x75, 0x49, 0x59, 0x09, 0xD3, 0xD9, 0x9D, 0x3E, 0xAC, 0x90, 0x92, 0xAF, 0xD1, 0x9A, 0xFD,
+    0x1E, 0xAC, 0x90, 0x91, 0xAC, 0x09, 0xD6, 0xAD, 0x74, 0x3A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xD4, 0x9A, 0xAA, 0xEA, 0xAA, 0xA0, 0xAF, 0xFD, 0x9A, 0xAA, 0xAE, 0xAA, 0xAA, 0x4A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x70, 0x29, 0x93, 0xF2, 0xAE, 0x29, 0xE2, 0xAD, 0x92, 0xE2, 0xAD,
+    0x92, 0xD9, 0x3A, 0x93, 0x0A, 0xFD, 0x90, 0xFE, 0xA0, 0xFE, 0x90, 0x09, 0xA9, 0x09, 0xEA, 0xAF,
+    0x9E, 0xA1, 0x99, 0x00, 0x70, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE7, 0x0E, 0x97, 0x9E, 0x70,
+    0xAD, 0xA7, 0x0E, 0x70, 0xAD, 0xA7, 0x0E, 0x70, 0x9E, 0x70, 0xE9, 0x79, 0xE7, 0x0E, 0xA7, 0x0E,
+    0x70, 0xAD, 0xA7, 0x0E, 0x70, 0xAE, 0x70, 0xE9, 0x77, 0x40, 0x69, 0x97, 0x19, 0xFD, 0xA5, 0xAF,
+    0xFA, 0x39, 0xF9, 0xAF, 0xA2, 0xF3, 0xF1, 0x9E, 0x93, 0xAE, 0x90, 0xF4, 0x9E, 0xA0, 0xF4, 0x9E,
+    0xA0, 0xF5, 0xF0, 0xEA, 0x5F, 0x0E, 0xA5, 0xEA, 0x0F, 0x49, 0xEA, 0x0F, 0x49, 0xE9, 0x0F, 0x4F,
+    0x19, 0xEA, 0x29, 0xEA, 0x2F, 0xA9, 0xAF, 0x39, 0xFF, 0xC9, 0x5F, 0xDA, 0x71, 0x99, 0x95, 0x77,
+    0x0A, 0xD4, 0x9A, 0xFC, 0x92, 0x9F, 0xE4, 0xFE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7,
+    0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x69, 0xFA, 0xA9, 0x1F, 0xFD, 0x1F, 0xFD, 0x00, 0x59,
+    0x97, 0x0A, 0xFD, 0x93, 0x9F, 0xFC, 0x92, 0xFA, 0x9A, 0xF1, 0x9E, 0x92, 0xF9, 0x09, 0xE3, 0xAE,
+    0x91, 0xE3, 0xAE, 0x97, 0x0F, 0x70, 0xAE, 0x97, 0xAE, 0xA7, 0x9F, 0x79, 0xEA, 0x79, 0xEA, 0x7A,
+    0xEA, 0x7A, 0xE9, 0x79, 0xFF, 0xF0, 0x9F, 0xFF, 0x1F, 0xFE, 0xA0, 0x59, 0x96, 0x9A, 0xFD, 0x92,
+    0xAF, 0xFC, 0x91, 0xF9, 0x9A, 0xF1, 0xDA, 0x3A, 0xE1, 0x9C, 0x4A, 0xE7, 0x0E, 0xA6, 0x9E, 0xA4,
+    0x9A, 0xFC, 0x5F, 0xF9, 0x39, 0xCA, 0x9A, 0xF7, 0x09, 0xEA, 0x79, 0xEA, 0x7A, 0xE9, 0x6A, 0xF3,
+    0x99, 0xAF, 0xC9, 0x1F, 0xFC, 0x92, 0xAF, 0xDA, 0x69, 0x99, 0x60, 0x72, 0x97, 0x3A, 0xE7, 0x2A,
+    0xF7, 0x19, 0xFC, 0x71, 0xFD, 0x70, 0xFE, 0x7A, 0xEA, 0xE7, 0xE0, 0xAE, 0x6E, 0x90, 0xAE, 0x5A,
+    0xDA, 0x1A, 0xE4, 0x9E, 0x2A, 0xE4, 0xEA, 0xAA, 0xAF, 0xAA, 0xA0, 0x9F, 0xFF, 0xD1, 0xFF, 0xFD,
+    0x29, 0x99, 0x99, 0x9A, 0xE9, 0x99, 0x70, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x74, 0x99, 0x93, 0x76,
+    0x9F, 0xFC, 0x91, 0xAF, 0xFC, 0x2A, 0xFF, 0xC2, 0xAD, 0xA7, 0x0E, 0xA7, 0x0F, 0x97, 0xFE, 0xA4,
+    0xFF, 0xC3, 0x99, 0x9A, 0xFC, 0xA7, 0x9F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0xFA, 0x39, 0x9A, 0xFC,
+    0x19, 0xFF, 0xC3, 0xFE, 0x96, 0x99, 0x96, 0x70, 0x99, 0x70, 0x9F, 0xC9, 0x49, 0xFF, 0x39, 0xFC,
+    0xA9, 0x5F, 0xA7, 0xF9, 0x79, 0xEA, 0x70, 0xFE, 0xA9, 0x4F, 0xFD, 0x91, 0x9F, 0xAA, 0xFC, 0x1A,
+    0xE9, 0x2A, 0xEA, 0x0A, 0xE9, 0x3F, 0x09, 0xE9, 0x3F, 0x09, 0xEA, 0x3F, 0x1F, 0x3E, 0xA1, 0xAF,
+    0xA9, 0xF9, 0x2F, 0xFC, 0xA4, 0xAF, 0xD9, 0x70, 0x99, 0x50, 0x76, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF,
+    0xF1, 0xDA, 0x4E, 0x91, 0xD9, 0x3E, 0xA2, 0x9A, 0x39, 0xE7, 0x1E, 0x97, 0x0F, 0x70, 0x9E, 0x97,
+    0x0F, 0x70, 0x9E, 0x97, 0x0F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF7, 0x1F, 0x71, 0xAD, 0xA7,
+    0x29, 0x97, 0x59, 0x97, 0x09, 0xFD, 0xA4, 0xAF, 0xFC, 0x29, 0xEA, 0x1A, 0xE9, 0x1F, 0x3E, 0xA1,
+    0xEA, 0x3E, 0xA1, 0xAE, 0x91, 0xAE, 0x3F, 0xAA, 0xE9, 0x39, 0xFE, 0x95, 0xAF, 0xDA, 0x4E, 0xAA,
+    0xFC, 0x2E, 0xA2, 0xFA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xF0, 0xAE, 0x93, 0xF1, 0xF9, 0x99, 0xF9,
+    0x1A, 0xFF, 0xCA, 0x39, 0xFE, 0x97, 0x99, 0x95, 0x59, 0x97, 0x0A, 0xFD, 0x5F, 0xFC, 0x92, 0xAE,
+    0xA9, 0xAF, 0x2E, 0xA2, 0xAE, 0xA0, 0x9E, 0x93, 0xF0, 0x9E, 0x93, 0xF0, 0x9E, 0xA3, 0xF1, 0xF3,
+    0xAE, 0x1A, 0xFA, 0x9A, 0xF2, 0xFF, 0xE3, 0x9A, 0xFE, 0x97, 0x0F, 0x70, 0xF9, 0x7F, 0xC5, 0x9F,
+    0xD3, 0x9F, 0xEA, 0x5F, 0xD9, 0x79, 0x99, 0x70, 0x0A, 0xD9, 0xAF, 0xAF, 0x0E, 0x77, 0x72, 0x9A,
+    0x90, 0x9E, 0xAA, 0xF9, 0xEA, 0x19, 0x90, 0x1A, 0xD9, 0x19, 0xF1, 0x9F, 0x2A, 0xD9, 0x77, 0x77,
+    0x69, 0x93, 0xF2, 0xAE, 0x29, 0xE2, 0xAD, 0x92, 0xE2, 0xAD, 0x92, 0xD9, 0x3A, 0x93, 0x77, 0x39,
+    0xCA, 0x69, 0xF4, 0x9F, 0xA3, 0x9F, 0xA3, 0x9F, 0xA5, 0xAE, 0x97, 0xFC, 0x96, 0x9F, 0xC9, 0x69,
+    0xFC, 0x96, 0x9F, 0x70, 0x9C, 0xA7, 0x40, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x59, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x73, 0x74, 0xCA,
+    0x70, 0x9E, 0xA7, 0xAF, 0xA7, 0xAF, 0x97, 0xAF, 0x97, 0xAE, 0x95, 0xAF, 0x4A, 0xF9, 0x29, 0xFC,
+    0x93, 0x9E, 0xA7, 0xCA, 0x77, 0x40, 0x29, 0x7A, 0xFA, 0x39, 0xFE, 0x3F, 0xF2, 0xA9, 0x19, 0xE9,
+    0x7E, 0x7A, 0xD7, 0xAD, 0x49, 0xAF, 0x2A, 0xFD, 0x92, 0xFD, 0x93, 0xF9, 0x5A, 0xD7, 0x9C, 0xA7,
+    0x74, 0x97, 0xAE, 0x6F, 0x95, 0xAE, 0x79, 0x95, 0x73, 0x99, 0x77, 0x9A, 0xFE, 0xA9, 0x71, 0x9F,
+    0xFF, 0xC7, 0xAF, 0xA9, 0x99, 0x99, 0xAF, 0x94, 0xAE, 0xA7, 0x0F, 0x3A, 0xE7, 0x3E, 0xA2, 0xE3,
+    0x9F, 0x4E, 0x1A, 0xDA, 0x2F, 0xE3, 0xAD, 0x90, 0xE2, 0xAD, 0x1A, 0xD9, 0x29, 0xD9, 0x9E, 0x29,
+    0xCA, 0x19, 0xDA, 0x29, 0xDA, 0xAD, 0xA7, 0x9D, 0xA2, 0x9D, 0xAA, 0xD9, 0x4A, 0xFC, 0xA2, 0xAD,
+    0x9E, 0x92, 0x9E, 0x9A, 0xDA, 0x2E, 0x0A, 0xD9, 0x2E, 0x19, 0xDA, 0x2D, 0xA0, 0xAD, 0xA2, 0xE9,
+    0x0A, 0xE9, 0x9E, 0x19, 0xE2, 0xAF, 0xFF, 0x92, 0xE3, 0xAE, 0x90, 0xAE, 0xA4, 0xF7, 0x73, 0xEA,
+    0x77, 0x29, 0xF9, 0x79, 0xD6, 0x9F, 0xCA, 0xAA, 0xAA, 0xFA, 0x70, 0xAF, 0xFE, 0xA7, 0x39, 0xAF,
+    0xAA, 0x96, 0x70, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9,
+    0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99,
+    0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9,
+    0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x19, 0x99, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0xA3,
+    0xAF, 0xFE, 0xA4, 0xF2, 0xF4, 0xF2, 0x9E, 0x93, 0xF3, 0xE4, 0xF2, 0x9E, 0x4F, 0x2E, 0x94, 0xFF,
+    0xD5, 0xFF, 0xE4, 0xF1, 0x9A, 0xF3, 0xF3, 0xF3, 0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0x3F, 0x3F, 0x3F,
+    0x99, 0xAF, 0xA1, 0xAF, 0xFE, 0xA2, 0xFF, 0xDA, 0x77, 0x30, 0x59, 0xAE, 0xA9, 0x5A, 0xFF, 0xC3,
+    0xFF, 0xE2, 0xF9, 0x3E, 0x1A, 0xE9, 0x4E, 0x1F, 0x5A, 0xCA, 0x09, 0xE9, 0x71, 0xAE, 0x97, 0x1F,
+    0x72, 0xF7, 0x2F, 0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x19, 0xF9, 0x71, 0xFC, 0xA5, 0x99, 0x09, 0xFF,
+    0xF9, 0x19, 0xFF, 0xE4, 0xAF, 0xEA, 0x70, 0x99, 0x94, 0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x97, 0xFF,
+    0xFC, 0x94, 0xAF, 0xFF, 0xD5, 0xF2, 0x9A, 0xFC, 0x4F, 0x49, 0xF9, 0x3F, 0x5A, 0xF3, 0xF6, 0xF3,
+    0xF6, 0xF9, 0x2F, 0x6F, 0x92, 0xF6, 0xF9, 0x2F, 0x6F, 0x3F, 0x6F, 0x3F, 0x59, 0xEA, 0x3F, 0x5F,
+    0x4F, 0x4A, 0xEA, 0x4F, 0xA9, 0xAA, 0xFA, 0x3A, 0xFF, 0xF9, 0x4F, 0xFD, 0xA9, 0x77, 0x70, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E, 0x3F,
+    0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9, 0x5F,
+    0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xCA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC0, 0xAF, 0xFF, 0x2F, 0x91,
+    0x9E, 0x2F, 0x3A, 0xD2, 0xF3, 0x9C, 0x92, 0xF7, 0x1F, 0x71, 0xFA, 0xAA, 0xAA, 0xA3, 0xFF, 0xD3,
+    0xFF, 0xCA, 0x3F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x96, 0xAF, 0xEA, 0x4F, 0xFA, 0x30, 0x59,
+    0xAA, 0xEA, 0x96, 0xAF, 0xFD, 0x4F, 0xFF, 0x92, 0xFC, 0x93, 0xE9, 0x1A, 0xEA, 0x5A, 0xD9, 0x1F,
+    0x69, 0xD1, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x4F, 0x59, 0x99, 0x99, 0x90, 0xF4, 0xFE, 0x9F,
+    0x93, 0x9F, 0xD0, 0xAE, 0xA6, 0xF0, 0x9F, 0x95, 0xF1, 0xFC, 0x94, 0xF1, 0x9F, 0xDA, 0xAA, 0xFC,
+    0x29, 0xFF, 0xFC, 0x4A, 0xFF, 0xA9, 0x70, 0x99, 0x99, 0x50, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xF9, 0x1F, 0xFA, 0x0A, 0xFD, 0xA2, 0xAF, 0xDA, 0x3F, 0x6A, 0xE9, 0x4F,
+    0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF,
+    0xE9, 0x4F, 0xAA, 0xAA, 0xAA, 0xAF, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94,
+    0xF6, 0xAE, 0x94, 0xF9, 0x5F, 0xA2, 0xAF, 0xE9, 0x1A, 0xFE, 0xA0, 0xFF, 0x91, 0xFF, 0xA0, 0x09,
+    0x99, 0x99, 0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x29, 0x99, 0x99, 0x99, 0x92, 0x9F,
+    0xF9, 0x2F, 0xEA, 0x5F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7E, 0xA6, 0xAE, 0xA6, 0xF5, 0x9F, 0xA4, 0xFC, 0xA5, 0x9E, 0x97, 0x71, 0x09, 0x99, 0x99,
+    0x99, 0x92, 0x99, 0x99, 0x99, 0x1F, 0xF1, 0xFE, 0x90, 0xAF, 0xD9, 0x2F, 0xC9, 0x3F, 0x39, 0xEA,
+    0x5F, 0x29, 0xEA, 0x6F, 0x19, 0xEA, 0x7F, 0x1E, 0x97, 0x0F, 0x9E, 0x97, 0x1F, 0xEA, 0x72, 0xFF,
+    0x97, 0x1F, 0x9F, 0x71, 0xF0, 0xAF, 0x70, 0xF1, 0xFC, 0x7F, 0x2F, 0xC6, 0xF2, 0x9F, 0xC5, 0xF9,
+    0x29, 0xFC, 0x91, 0xAF, 0xE2, 0x9F, 0xCA, 0x0F, 0xF3, 0x9F, 0x97, 0x69, 0x91, 0x09, 0x99, 0x99,
+    0x99, 0x97, 0xFF, 0x96, 0xAF, 0xDA, 0x71, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73,
+    0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x5D, 0x3F, 0x49, 0xD9, 0x2F, 0x4A, 0xD9, 0x2F, 0xAA, 0xAA, 0xAE,
+    0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x29, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x93, 0xFE,
+    0x5F, 0xE3, 0x9F, 0xD9, 0x39, 0xFD, 0x95, 0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xD6, 0x9D, 0xAE,
+    0x91, 0x9D, 0xAE, 0x95, 0x9D, 0x9E, 0xA1, 0xAD, 0x0E, 0x95, 0xAD, 0x9A, 0xE1, 0xDA, 0x0E, 0x95,
+    0xAD, 0x09, 0xE1, 0xD9, 0x0E, 0xA5, 0xAD, 0x1E, 0x99, 0xD1, 0xEA, 0x5E, 0x1A, 0xFC, 0xA1, 0xF5,
+    0xE1, 0x9F, 0xC9, 0x1F, 0x5E, 0x2F, 0xC2, 0xAE, 0x5E, 0x2A, 0xEA, 0x2A, 0xE4, 0x9E, 0x3E, 0x92,
+    0xAE, 0x49, 0xDA, 0x3E, 0x3A, 0xE9, 0x2F, 0xDA, 0x19, 0xA9, 0x2F, 0xE0, 0x9F, 0xE6, 0x9F, 0xE0,
+    0x09, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x3A, 0xFE, 0x1A, 0xFD, 0x39, 0xFD,
+    0x93, 0xFC, 0xA4, 0x9E, 0x5F, 0xD9, 0x39, 0xE5, 0xFE, 0x39, 0xE5, 0xFE, 0xA2, 0x9E, 0x5E, 0x9F,
+    0x91, 0x9E, 0x5E, 0x0A, 0xF1, 0x9E, 0x5E, 0x1F, 0xC0, 0x9E, 0x5E, 0x2F, 0xA9, 0xE5, 0xE2, 0xAF,
+    0x9E, 0x5E, 0x3F, 0xF5, 0xE4, 0xFE, 0x5E, 0x49, 0xFD, 0x49, 0xE5, 0xFD, 0x3F, 0xE4, 0xFC, 0x29,
+    0xFE, 0x49, 0xF7, 0x70, 0x99, 0x40, 0x59, 0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93,
+    0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F,
+    0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F,
+    0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x19,
+    0x99, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xF9, 0x2A, 0xFF, 0xF9, 0x3F, 0x19, 0xFA, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x29, 0xEA, 0x3F, 0x19, 0xF9, 0x3F, 0xFD, 0x94, 0xFF, 0xC9, 0x5F, 0xAA,
+    0x97, 0x0F, 0x73, 0xF7, 0x3F, 0x73, 0xF9, 0x70, 0xAF, 0xE9, 0x6F, 0xF9, 0x50, 0x59, 0xAD, 0xAA,
+    0x97, 0x1A, 0xFF, 0xC9, 0x6F, 0xFF, 0x94, 0xFA, 0x29, 0xFC, 0x3A, 0xE9, 0x5F, 0xA2, 0xF6, 0xAF,
+    0x19, 0xEA, 0x7F, 0x90, 0xAE, 0x97, 0xF9, 0x0F, 0x97, 0xF9, 0x0F, 0x97, 0xF9, 0x0F, 0x97, 0xF9,
+    0x0F, 0xA7, 0xF1, 0xAF, 0x7F, 0x19, 0xF9, 0x5A, 0xE9, 0x2F, 0xC4, 0x9F, 0x39, 0xFC, 0xA9, 0x9A,
+    0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xE9, 0x73, 0xAE, 0xA7, 0x69, 0xF9, 0x75, 0x9F, 0xDA, 0xAA, 0x97,
+    0x1A, 0xFE, 0xA7, 0x3A, 0xFC, 0x77, 0x99, 0x10, 0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xF9,
+    0x5A, 0xFF, 0xF9, 0x6F, 0x2A, 0xF6, 0xF3, 0xF6, 0xF3, 0xF6, 0xF3, 0xF6, 0xF2, 0x9E, 0xA6, 0xF0,
+    0x9A, 0xF7, 0xFF, 0xCA, 0x70, 0xFF, 0xA7, 0x1F, 0x0F, 0x71, 0xF1, 0xF7, 0x0F, 0x1A, 0xF7, 0xF2,
+    0xFC, 0x6F, 0x3F, 0xC3, 0xAF, 0xE2, 0xFC, 0xA1, 0xFF, 0x3F, 0xA7, 0x69, 0x99, 0x10, 0x39, 0xAD,
+    0xAA, 0x93, 0x9F, 0xFC, 0x19, 0xFF, 0xD1, 0xF3, 0xE0, 0x9E, 0x93, 0xE0, 0x9E, 0xA3, 0xAC, 0x90,
+    0x9F, 0x97, 0xFD, 0x95, 0x9F, 0xE9, 0x49, 0xFF, 0x5A, 0xFE, 0x6A, 0xFC, 0x1A, 0xA4, 0xF9, 0xAD,
+    0x49, 0xE9, 0xAD, 0x93, 0xAE, 0x0A, 0xEA, 0x19, 0xEA, 0x0A, 0xFF, 0xD1, 0x9F, 0xFA, 0x59, 0x99,
+    0x99, 0x40, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1,
+    0xE9, 0x09, 0xF1, 0x9E, 0x1D, 0xA2, 0xF2, 0xE1, 0xD9, 0x2F, 0x2D, 0xA2, 0x93, 0xF2, 0x99, 0x70,
+    0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x97, 0x19, 0xFF,
+    0x97, 0xAF, 0xF9, 0x30, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F,
+    0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9,
+    0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA,
+    0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5, 0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9,
+    0x9A, 0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99, 0x97, 0x09, 0x99, 0x99, 0x99, 0x92,
+    0x99, 0x99, 0x99, 0x90, 0xAF, 0xF2, 0xFE, 0x09, 0xFE, 0x92, 0xAF, 0xC9, 0x2F, 0xC5, 0x9E, 0x49,
+    0xF5, 0xF5, 0xF9, 0x4E, 0x95, 0xAF, 0x39, 0xE7, 0xF3, 0xEA, 0x7F, 0x92, 0xE7, 0x09, 0xF1, 0xAE,
+    0x71, 0xF1, 0xE9, 0x71, 0xAE, 0x90, 0xE7, 0x3E, 0xAA, 0xDA, 0x73, 0xFE, 0x74, 0x9F, 0xCA, 0x75,
+    0xFC, 0x97, 0x5A, 0xF7, 0x7E, 0xA7, 0x77, 0x30, 0x09, 0x99, 0x99, 0x99, 0x97, 0x29, 0x99, 0x99,
+    0x99, 0x09, 0xFF, 0x29, 0xE3, 0xFE, 0x1F, 0xE9, 0x2A, 0xE3, 0x9F, 0xCA, 0x2A, 0xF4, 0xF9, 0x4E,
+    0x93, 0x9F, 0x39, 0xFC, 0x39, 0xE5, 0xF9, 0x2A, 0xFC, 0x3A, 0xDA, 0x5A, 0xEA, 0x2F, 0xD9, 0x2E,
+    0x95, 0x9F, 0x2F, 0xDA, 0x2E, 0x7F, 0x19, 0xDA, 0xF1, 0x9D, 0xA7, 0xAE, 0x90, 0xAD, 0x0A, 0xE1,
+    0xAD, 0x97, 0x9E, 0xA0, 0xE0, 0x9E, 0x90, 0xE7, 0x1F, 0x0D, 0xA1, 0xF0, 0xDA, 0x71, 0xAE, 0x9D,
+    0x2A, 0xE9, 0xD9, 0x71, 0x9F, 0xD2, 0x9F, 0xD7, 0x3F, 0xCA, 0x3F, 0xCA, 0x73, 0xAF, 0x93, 0xAF,
+    0x97, 0x39, 0xF4, 0x9F, 0x75, 0xEA, 0x5F, 0x77, 0x77, 0x20, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x1F, 0xF9, 0x0A, 0xFD, 0x90, 0xAF, 0xDA, 0x19, 0xAF, 0xA3, 0xFC, 0x3A, 0xE6, 0xFA,
+    0x19, 0xE7, 0x9F, 0x1E, 0x97, 0x0A, 0xFE, 0xA7, 0x2A, 0xFC, 0xA7, 0x4F, 0xC7, 0x5A, 0xF9, 0x73,
+    0xAF, 0xD7, 0x29, 0xEA, 0xF7, 0x1E, 0x90, 0xFA, 0x7E, 0xA1, 0x9F, 0x95, 0xAE, 0x3A, 0xF4, 0xAE,
+    0x94, 0xFC, 0x19, 0xFE, 0x19, 0xFF, 0xAF, 0xE1, 0xAF, 0xF0, 0x09, 0x99, 0x99, 0x99, 0x29, 0x99,
+    0x99, 0x90, 0xAF, 0xEA, 0x09, 0xFD, 0xA9, 0xFD, 0xA2, 0xAF, 0xA2, 0xAF, 0x4E, 0xA4, 0xF9, 0x29,
+    0xE5, 0x9F, 0x2E, 0x96, 0xF9, 0x09, 0xDA, 0x70, 0xF0, 0xE7, 0x1A, 0xEA, 0xDA, 0x72, 0xFD, 0x73,
+    0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x2F, 0xFA, 0x79, 0xFF, 0xA3, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xF1, 0xAF, 0xFF, 0x1E, 0x93, 0xFA, 0x1D, 0xA3, 0xAF,
+    0x29, 0xC9, 0x3F, 0x71, 0xFA, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xF9, 0x70, 0xFA, 0x70, 0x9F, 0x71,
+    0xF9, 0x39, 0xC2, 0xFA, 0x4D, 0xA0, 0xAF, 0x49, 0xDA, 0x0F, 0xAA, 0xAA, 0xAA, 0xE9, 0x0F, 0xFF,
+    0xC1, 0xAF, 0xFF, 0x77, 0x9A, 0xAA, 0xAA, 0x09, 0xFC, 0x99, 0xEA, 0xA0, 0x9D, 0xA2, 0x9D, 0xA2,
+    0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2,
+    0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2,
+    0x9E, 0x99, 0x09, 0xFC, 0x99, 0xFC, 0x00, 0x0E, 0x97, 0x0A, 0xDA, 0x71, 0xE7, 0x1A, 0xDA, 0x70,
+    0x9E, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0xAE, 0x71, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x1E,
+    0xA7, 0x09, 0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x75, 0x9A, 0xAA, 0xAA,
+    0xFD, 0x9A, 0xAE, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19,
+    0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x09, 0x9F,
+    0xFF, 0xE0, 0x4E, 0x97, 0x0E, 0xA7, 0xAF, 0x7D, 0xAD, 0xA5, 0x9D, 0x0E, 0x5E, 0x09, 0xD9, 0x4D,
+    0xA1, 0xE3, 0xAD, 0x2A, 0xD3, 0xE2, 0x9D, 0xA1, 0x9D, 0x93, 0xE1, 0xE4, 0xAD, 0x90, 0xAA, 0x95,
+    0xAA, 0x90, 0xFF, 0xF9, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x09, 0xA3, 0xD9,
+    0x2E, 0x91, 0x9E, 0x29, 0xDA, 0x3A, 0x00, 0x49, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9,
+    0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2,
+    0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x59,
+    0x71, 0x9F, 0xC7, 0x1F, 0xD7, 0x29, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x19, 0x99, 0x6F, 0x9F, 0xCA,
+    0x4F, 0xFE, 0xA3, 0xFC, 0xAA, 0xFC, 0x3F, 0x3F, 0x92, 0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0xA2, 0xF3,
+    0x9E, 0xA2, 0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0x3F, 0x3F, 0x3F, 0x90, 0x9F, 0x93, 0xFF, 0xDA, 0x4A,
+    0xFF, 0x97, 0x09, 0x99, 0x95, 0x59, 0x99, 0x7A, 0xFD, 0x4F, 0xFA, 0x2F, 0x90, 0xF1, 0x9E, 0x91,
+    0x9E, 0x1F, 0x3C, 0xA2, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x97, 0xAF, 0x79, 0xFC, 0xAA, 0xAA, 0xC2,
+    0xAF, 0xFC, 0x39, 0xFE, 0x96, 0x99, 0x93, 0x73, 0x97, 0x19, 0xAF, 0x97, 0x0F, 0xD9, 0x71, 0x9F,
+    0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x99, 0x9A, 0xE9, 0x5A, 0xFF, 0x94, 0xFF, 0xD9, 0x3F, 0x91,
+    0xAE, 0x92, 0x9E, 0x92, 0xAE, 0x92, 0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0x92, 0xF3,
+    0xAE, 0x92, 0xF3, 0xAE, 0x92, 0xFA, 0x2A, 0xE9, 0x2A, 0xFA, 0xAF, 0xC9, 0x3F, 0xFF, 0xC9, 0x2F,
+    0xCA, 0x0F, 0xC9, 0x49, 0x93, 0x93, 0x59, 0x99, 0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xEA, 0x1A, 0xE9,
+    0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0xA7, 0x0F, 0x70, 0xF9,
+    0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD, 0x92, 0xAF, 0xE9, 0x69, 0x99, 0x30, 0x69, 0xAA, 0x96,
+    0xAF, 0xD9, 0x3A, 0xFF, 0x29, 0xEA, 0x09, 0xDA, 0x2A, 0xE3, 0xA3, 0xEA, 0x70, 0xEA, 0x6A, 0xFF,
+    0x91, 0xAF, 0xFC, 0x91, 0x99, 0xAF, 0x99, 0x94, 0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7,
+    0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA7, 0x9E, 0xA6, 0xAF, 0xE4, 0xFF, 0x30, 0x59, 0x99, 0x29, 0x93,
+    0x9F, 0xFE, 0x19, 0xFF, 0xEA, 0x1E, 0xA1, 0x9E, 0x09, 0x2E, 0x92, 0xE9, 0x3E, 0x3E, 0xA3, 0xE9,
+    0x2E, 0x93, 0xAE, 0xAA, 0xF5, 0xFF, 0x59, 0xDA, 0xAA, 0xA9, 0x6E, 0x73, 0xE9, 0x99, 0x99, 0x99,
+    0x4F, 0xFE, 0x92, 0xAF, 0xFE, 0x1A, 0xEA, 0xAA, 0xAA, 0xF0, 0x9E, 0x94, 0xAE, 0x09, 0xE9, 0x39,
+    0xEA, 0x1F, 0xCA, 0xAF, 0xC2, 0xAF, 0xFC, 0xA5, 0xAF, 0xA9, 0x40, 0x49, 0x72, 0x9A, 0xF9, 0x71,
+    0xFD, 0x97, 0x29, 0xF9, 0x73, 0xAE, 0x97, 0x3A, 0xE9, 0x73, 0xAE, 0x29, 0x99, 0x6A, 0xE9, 0xAF,
+    0xC5, 0xAF, 0xFE, 0x4A, 0xFC, 0xAF, 0xC4, 0xAE, 0xA2, 0xAE, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE,
+    0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE,
+    0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x92, 0xAF, 0xC9, 0x09, 0xFD, 0x09, 0xFD, 0xA0, 0xFE, 0x00,
+    0x39, 0x59, 0xE9, 0x3A, 0xF3, 0xAE, 0xA4, 0x9A, 0x97, 0x75, 0xAF, 0xA1, 0x9F, 0xCA, 0x3A, 0xEA,
+    0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA,
+    0x2A, 0xFD, 0x90, 0xFE, 0x90, 0x59, 0x5A, 0xE4, 0xF9, 0x3F, 0x94, 0xAA, 0x97, 0x70, 0x92, 0x9F,
+    0xC2, 0xFD, 0x39, 0xF4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4,
+    0xAE, 0x4A, 0xE4, 0xF4, 0xEA, 0x3F, 0x91, 0x9F, 0xA1, 0x9F, 0xC3, 0xAC, 0xA9, 0x30, 0x49, 0x71,
+    0x9A, 0xF7, 0x1F, 0xD7, 0x29, 0xF7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE1, 0xFD, 0xA2,
+    0xAE, 0x19, 0xFC, 0x92, 0xAE, 0x2E, 0xA4, 0xAE, 0x1E, 0xA5, 0xAE, 0x0A, 0xDA, 0x6A, 0xFE, 0x7A,
+    0xEA, 0xEA, 0x6A, 0xE0, 0xAE, 0x95, 0xAE, 0x1F, 0x5A, 0xE1, 0x9F, 0x4A, 0xE2, 0xAF, 0x2A, 0xFC,
+    0x91, 0xFC, 0x09, 0xFD, 0xA2, 0xF9, 0x73, 0x99, 0x10, 0x49, 0x29, 0xAF, 0x91, 0xFD, 0x92, 0x9F,
+    0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE,
+    0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x91, 0x9F, 0xE0, 0xAF,
+    0xE0, 0x39, 0x92, 0x99, 0x94, 0x99, 0x95, 0xAF, 0x0A, 0xFC, 0x90, 0x9F, 0xC9, 0x29, 0xFF, 0xFC,
+    0xAF, 0xE3, 0x9A, 0xFC, 0xAA, 0xFD, 0xAA, 0xF9, 0x39, 0xEA, 0x2A, 0xF2, 0xAE, 0xA3, 0x9E, 0xA2,
+    0x9E, 0xA2, 0x9E, 0xA3, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA3, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA3,
+    0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA3, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA3, 0x9E, 0xA2, 0x9E, 0xA2,
+    0x9E, 0xA3, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0xAF, 0xCA, 0x09, 0xFC, 0xA0, 0x9F, 0xD1, 0xFD,
+    0xA0, 0xAF, 0xCA, 0x0A, 0xFD, 0x90, 0x39, 0x92, 0x99, 0x95, 0xAF, 0x0A, 0xFC, 0x92, 0x9F, 0xFF,
+    0xC3, 0x9A, 0xFC, 0xAA, 0xFA, 0x39, 0xEA, 0x29, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA,
+    0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA,
+    0x3E, 0xA2, 0xAF, 0xCA, 0x1F, 0xD9, 0x0F, 0xE0, 0x9F, 0xD9, 0x59, 0x99, 0x97, 0x0A, 0xFD, 0xA5,
+    0xFF, 0xD3, 0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4,
+    0xF1, 0xF4, 0xF1, 0xFA, 0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19,
+    0x99, 0x50, 0x39, 0x39, 0x93, 0x9F, 0xA9, 0xFC, 0xA1, 0xAF, 0xFF, 0xA1, 0x9F, 0xCA, 0xAF, 0xC2,
+    0xAE, 0x92, 0xF9, 0x1A, 0xE3, 0xAE, 0xA1, 0xAE, 0x39, 0xEA, 0x1A, 0xE3, 0x9E, 0xA1, 0xAE, 0x39,
+    0xEA, 0x1A, 0xE3, 0x9E, 0x91, 0xAE, 0x3F, 0x2A, 0xEA, 0x99, 0xAE, 0xA2, 0xAF, 0xFC, 0xA3, 0xAF,
+    0xF9, 0x4A, 0xE9, 0x99, 0x7A, 0xE7, 0x2A, 0xE7, 0x2F, 0xA7, 0x9F, 0xE9, 0x59, 0xAA, 0xAA, 0xAA,
+    0xA6, 0x59, 0x99, 0x97, 0x0A, 0xFF, 0x4F, 0xFD, 0x92, 0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x2A, 0xE9,
+    0x1F, 0x3A, 0xE9, 0x1F, 0x3A, 0xE9, 0x1F, 0x3A, 0xE9, 0x1F, 0x3A, 0xE9, 0x1F, 0x3A, 0xE9, 0x1F,
+    0xA2, 0xF9, 0x19, 0xFC, 0xAF, 0xC9, 0x2F, 0xFE, 0x93, 0xAF, 0xAA, 0xE9, 0x71, 0xAE, 0x97, 0x1A,
+    0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xA7, 0xAF, 0xE6, 0xAA, 0xAA, 0xAA, 0xA9, 0x39, 0x92, 0x99, 0x1A,
+    0xF0, 0x9E, 0x9A, 0xFC, 0x9F, 0x90, 0x9A, 0xFF, 0x29, 0xF9, 0x19, 0x29, 0xEA, 0x69, 0xEA, 0x69,
+    0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x5A, 0xFD, 0xA2, 0x9F, 0xF2, 0x39, 0x99,
+    0x94, 0x9F, 0xDA, 0x1A, 0xEA, 0xF1, 0xE2, 0x9D, 0x99, 0xE3, 0xD0, 0x9F, 0xA5, 0xFE, 0x93, 0xFE,
+    0xA3, 0xAF, 0xD9, 0x09, 0x29, 0xFA, 0xAC, 0xA3, 0xEA, 0xE9, 0x2E, 0x9A, 0xFF, 0xA0, 0x9F, 0xEA,
+    0x59, 0x94, 0x49, 0x97, 0x0E, 0x7A, 0xE7, 0xAE, 0x59, 0xFF, 0xC1, 0xFF, 0xCA, 0x19, 0x9F, 0x99,
+    0x94, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xAA, 0xC3, 0xAF, 0xE4, 0xFD, 0x96, 0x99,
+    0x30, 0x77, 0x1A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF,
+    0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x9F, 0xE1, 0xFD, 0x1F, 0xDA, 0x1A, 0xFA,
+    0x2F, 0x93, 0xAD, 0xA3, 0x9F, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A,
+    0xE0, 0xAD, 0x97, 0x9E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0xAE, 0x77, 0x70,
+    0x9F, 0xDA, 0x19, 0xD9, 0x1A, 0xFC, 0x1F, 0xD9, 0x1A, 0xDA, 0x19, 0xFC, 0x2F, 0x3F, 0x3E, 0x3A,
+    0xE2, 0x9F, 0x29, 0xD9, 0x4E, 0xA1, 0xAF, 0x91, 0xE5, 0xF1, 0xFC, 0xA1, 0xE5, 0xAE, 0x1D, 0x9E,
+    0x09, 0xD9, 0x6E, 0x9A, 0xCA, 0x0E, 0x0A, 0xD7, 0xEA, 0xD9, 0x0A, 0xD9, 0xDA, 0x79, 0xFC, 0x19,
+    0xFC, 0x97, 0x0F, 0xC2, 0xFC, 0x71, 0xAE, 0x92, 0xAE, 0xA7, 0x19, 0xE3, 0x9E, 0x77, 0x74, 0x0F,
+    0xD9, 0x0F, 0xD1, 0xFC, 0xA1, 0x9F, 0x92, 0x9F, 0x19, 0xE5, 0xAE, 0xA0, 0xE7, 0xAF, 0xD7, 0x1A,
+    0xF9, 0x72, 0xF7, 0x2F, 0xCA, 0x70, 0xAD, 0xAE, 0xA6, 0xAD, 0xA0, 0xAE, 0x94, 0xAE, 0x2F, 0x92,
+    0xFC, 0x90, 0x9F, 0xD0, 0xAF, 0xCA, 0x0F, 0xE0, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF, 0xA2,
+    0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A,
+    0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74, 0x9D,
+    0xA7, 0x4E, 0x73, 0xAE, 0xA7, 0xAF, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x0A, 0xFF,
+    0xCA, 0x1A, 0xFF, 0xD1, 0xE9, 0x99, 0xFA, 0x1D, 0x91, 0x9E, 0xA2, 0x9A, 0x19, 0xF7, 0xF7, 0xF9,
+    0x6A, 0xEA, 0x69, 0xF2, 0xAC, 0x19, 0xF3, 0xD9, 0x0F, 0xA9, 0x99, 0xAD, 0x1F, 0xFE, 0x1F, 0xFD,
+    0xA7, 0x50, 0x39, 0xE3, 0xFC, 0x91, 0xAE, 0x99, 0x2E, 0x94, 0xE5, 0xE5, 0xAD, 0x94, 0xAD, 0xA4,
+    0x9D, 0xA4, 0x9E, 0x4E, 0xA3, 0xF3, 0x9E, 0xA4, 0x9E, 0x94, 0x9D, 0xA4, 0x9D, 0xA4, 0xAD, 0xA4,
+    0xAD, 0x94, 0xE9, 0x4E, 0x5E, 0x5A, 0xDA, 0x5F, 0xC9, 0x29, 0xF9, 0x70, 0x3A, 0xD9, 0xAD, 0x9A,
+    0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9,
+    0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x90, 0x0E, 0xA3,
+    0x9F, 0xC3, 0x99, 0xEA, 0x49, 0xE5, 0xE5, 0xE4, 0x9E, 0x4A, 0xDA, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A,
+    0xE5, 0xF9, 0x3A, 0xE9, 0x29, 0xE9, 0x3A, 0xD9, 0x4A, 0xD9, 0x4A, 0xDA, 0x49, 0xDA, 0x49, 0xE5,
+    0xE5, 0xE4, 0xEA, 0x19, 0xFC, 0x29, 0xEA, 0x74, 0x2A, 0xA9, 0x49, 0x19, 0xFC, 0x91, 0xAC, 0xA0,
+    0xFF, 0xAD, 0xA0, 0xD9, 0x09, 0xFD, 0x19, 0xC3, 0xAD, 0xA1, 0x19, 0x92, 0xF1, 0xF9, 0x0A, 0xE7,
+    0x6D, 0xA2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xEA, 0x09, 0xEA, 0x09,
+    0xE9, 0x0A, 0xE1, 0x9A, 0xA9, 0x00, 0x77, 0x29, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x19, 0xCA, 0x71,
+    0xAD, 0x95, 0x9F, 0xEA, 0x29, 0xFF, 0xCA, 0x09, 0xE9, 0x9C, 0x90, 0xE0, 0xE9, 0x0A, 0xC9, 0x0A,
+    0xC9, 0x0E, 0x1A, 0xC9, 0x19, 0x09, 0xE1, 0xAC, 0x49, 0xE1, 0xAC, 0x49, 0xE1, 0xAC, 0x49, 0xE1,
+    0xAC, 0x5E, 0xA0, 0xD5, 0xFA, 0xD9, 0x9A, 0xCA, 0x1F, 0xFD, 0xA2, 0xFF, 0xA5, 0x9D, 0x97, 0x1D,
+    0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2A, 0xA4, 0x71, 0x97, 0x2A, 0xFC, 0x96, 0xFF, 0x94, 0xAE, 0x1A,
+    0xE4, 0xE9, 0x2E, 0x39, 0xE3, 0xD4, 0xAE, 0x72, 0xAE, 0x70, 0x99, 0xF9, 0x99, 0x93, 0xAF, 0xFD,
+    0x39, 0xAA, 0xFA, 0xAA, 0x96, 0xE9, 0x71, 0x9E, 0x72, 0x9E, 0x72, 0xE9, 0x70, 0xAA, 0xEA, 0xAA,
+    0xAA, 0xAD, 0x90, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x2A, 0x96, 0x99, 0x10, 0x76, 0xCA, 0x29, 0x92,
+    0xCA, 0x0A, 0xDA, 0xAF, 0xAE, 0x19, 0xFF, 0xD3, 0xAD, 0xA0, 0x9E, 0x93, 0xE3, 0xDA, 0x3D, 0xA3,
+    0xDA, 0x3E, 0x3D, 0xA3, 0xE9, 0x1E, 0x92, 0x9F, 0xFD, 0x1A, 0xDA, 0xFC, 0xAE, 0x1C, 0xA1, 0x99,
+    0x92, 0xCA, 0x76, 0x77, 0x09, 0xFE, 0x19, 0xFD, 0x0F, 0xDA, 0x19, 0xFC, 0x91, 0xAE, 0xA4, 0xE4,
+    0xF3, 0xAD, 0x94, 0x9E, 0x92, 0xE6, 0xF1, 0x9D, 0x97, 0xE9, 0x0E, 0x6F, 0xD9, 0xFC, 0x4F, 0xFF,
+    0x79, 0xF7, 0x0A, 0xCA, 0xAF, 0xAA, 0xCA, 0x4A, 0xFF, 0xD9, 0x70, 0xF7, 0x4F, 0x74, 0xF7, 0x19,
+    0xFF, 0x96, 0xAF, 0xF3, 0x3A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD,
+    0x99, 0xAA, 0x97, 0x79, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A,
+    0xD9, 0x77, 0x9F, 0xA4, 0xAF, 0xE2, 0xAC, 0xA2, 0xE1, 0x9D, 0x92, 0x9D, 0x1A, 0xE7, 0xFC, 0x95,
+    0xD9, 0xF4, 0xD0, 0x9F, 0xA2, 0xDA, 0x1A, 0xEA, 0x19, 0xDA, 0x2E, 0x91, 0xAE, 0x91, 0xAC, 0xA2,
+    0xAF, 0x1D, 0x39, 0xF0, 0xD5, 0xAF, 0xC1, 0xA9, 0x3E, 0xA0, 0xE3, 0xAD, 0x1E, 0x92, 0xDA, 0x1A,
+    0xFE, 0xA3, 0xAF, 0xC9, 0x79, 0x50, 0x72, 0xAD, 0x90, 0x9D, 0xA0, 0xEA, 0x0F, 0x0E, 0x90, 0xAD,
+    0xA1, 0x93, 0x99, 0x00, 0x69, 0xAA, 0xA9, 0x73, 0xAF, 0xF9, 0x69, 0xD9, 0x5A, 0xCA, 0x5D, 0x70,
+    0x9C, 0xA3, 0xD3, 0xAA, 0xAA, 0x91, 0x9C, 0x91, 0x9C, 0x91, 0x9F, 0xD2, 0xAC, 0x1D, 0x2D, 0x91,
+    0xD2, 0x9C, 0x90, 0xCA, 0x1A, 0xD2, 0xA9, 0x3C, 0xA0, 0xC9, 0x1D, 0xA7, 0x0C, 0xA0, 0xC9, 0x1D,
+    0xA7, 0x0D, 0x0C, 0x91, 0xDA, 0x70, 0xCA, 0x0C, 0xA1, 0xAD, 0x70, 0xCA, 0x0A, 0xC1, 0x9E, 0xAA,
+    0xAC, 0x29, 0xC9, 0x09, 0xC9, 0x19, 0xFC, 0xA2, 0xD2, 0xD3, 0x99, 0x93, 0xAC, 0x93, 0xD7, 0x0A,
+    0xCA, 0x5D, 0xA9, 0x39, 0xD9, 0x79, 0xFE, 0xA7, 0x49, 0x99, 0x96, 0x1A, 0xAC, 0xA3, 0xFD, 0x19,
+    0xD1, 0xD6, 0xD9, 0x19, 0xAF, 0x90, 0x9D, 0x99, 0xD9, 0x0A, 0xCA, 0x1D, 0x90, 0xAF, 0xF0, 0xAD,
+    0xA0, 0xD9, 0x71, 0xAA, 0xAA, 0xAA, 0xC9, 0xAF, 0xE7, 0x10, 0x77, 0x19, 0xD3, 0xD9, 0x2A, 0xDA,
+    0x19, 0xE2, 0xAE, 0x19, 0xE2, 0xF1, 0xAE, 0x92, 0xE9, 0x1E, 0xA3, 0xF1, 0xAE, 0x4E, 0xA1, 0xAE,
+    0x4E, 0xA1, 0xAE, 0x4A, 0xD2, 0x9D, 0x97, 0x50, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFD,
+    0x9A, 0xFF, 0xD9, 0x79, 0xD9, 0x79, 0xD9, 0x79, 0xD9, 0x70, 0x99, 0x00, 0x0A, 0xFD, 0x90, 0xFE,
+    0xA0, 0xFE, 0x90, 0x59, 0x97, 0x1A, 0xFC, 0xA4, 0x9C, 0xA3, 0x9D, 0x3C, 0x99, 0x99, 0x92, 0xCA,
+    0x1A, 0xA0, 0xAD, 0xAC, 0x91, 0xC1, 0xC9, 0x1C, 0xA0, 0xD1, 0xCA, 0x0C, 0x2C, 0xA9, 0xC9, 0x1A,
+    0xA0, 0xC2, 0xEA, 0x2A, 0xC0, 0xC2, 0xCA, 0xAC, 0x91, 0xAA, 0x0C, 0xA0, 0x9D, 0x9D, 0x90, 0xC9,
+    0x09, 0xC0, 0x99, 0x91, 0xA9, 0xAC, 0x2A, 0xC5, 0x9C, 0x93, 0xAC, 0xA9, 0x9A, 0xD9, 0x69, 0xAA,
+    0xA9, 0x30, 0x9F, 0xEA, 0xAF, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x00, 0x39, 0x95, 0xFC, 0xA2, 0xFE,
+    0x90, 0xAD, 0x91, 0xE0, 0xE2, 0xAD, 0x0D, 0xA2, 0xAD, 0x0A, 0xD9, 0x1E, 0x09, 0xFE, 0x91, 0x9F,
+    0xC9, 0x49, 0x99, 0x30, 0x39, 0xAA, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x49, 0x99, 0x9A, 0xD9,
+    0x99, 0x90, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x3A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x19,
+    0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xD9, 0xAF, 0xFD, 0x97, 0x30, 0x29, 0xA9, 0x93,
+    0xAF, 0xD1, 0x9E, 0xAE, 0xA0, 0xAD, 0x19, 0xDA, 0x1A, 0xA1, 0x9D, 0xA5, 0xE5, 0xE9, 0x4E, 0x94,
+    0xE4, 0x9E, 0xAA, 0xAA, 0xA0, 0xAF, 0xF1, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x29, 0xA9, 0x92, 0xAF,
+    0xD0, 0x9D, 0xA9, 0xE9, 0x0C, 0x91, 0xAD, 0x93, 0x9E, 0x29, 0xF3, 0xAF, 0xC5, 0xAD, 0xA4, 0x9D,
+    0xA2, 0x9A, 0xE9, 0xAF, 0xDA, 0x1F, 0xA7, 0x30, 0x1A, 0xA2, 0xDA, 0x0A, 0xD9, 0x9E, 0x0A, 0xD2,
+    0xA2, 0x39, 0x69, 0x3F, 0x3F, 0x3F, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA,
+    0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA,
+    0x29, 0xEA, 0x29, 0xEA, 0x29, 0xF2, 0xAE, 0xA2, 0x9F, 0xC9, 0xAF, 0xC9, 0x19, 0xFF, 0xAA, 0xFA,
+    0x9F, 0xEA, 0x1F, 0x09, 0xE0, 0x99, 0x49, 0x91, 0x9E, 0x73, 0x9E, 0x97, 0x29, 0xE9, 0x72, 0xAE,
+    0x97, 0x29, 0xAA, 0x97, 0x30, 0x69, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xD2, 0xAF, 0xFC, 0xA9, 0x1A,
+    0xFD, 0x99, 0xD3, 0xFE, 0x99, 0xD2, 0x9F, 0xE9, 0x9D, 0x2A, 0xFE, 0x99, 0xD2, 0xAF, 0xE9, 0x9D,
+    0x29, 0xFE, 0x99, 0xD3, 0xFE, 0x99, 0xD3, 0x9F, 0xD9, 0x9D, 0x49, 0xDA, 0xD9, 0x9D, 0x70, 0xD9,
+    0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D,
+    0x70, 0xD9, 0x9C, 0xA7, 0x0D, 0x09, 0xA7, 0x1D, 0x74, 0xA7, 0x0A, 0xD0, 0xAF, 0xAF, 0x0E, 0x94,
+    0x0A, 0xCA, 0x0A, 0xEA, 0x1E, 0x1D, 0x99, 0xDA, 0x1A, 0x91, 0x49, 0x49, 0xE9, 0x2F, 0xC9, 0x29,
+    0xAE, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0xA2, 0xFE, 0x90,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x19, 0xAD, 0xA2, 0xAF, 0xD0, 0x9D, 0x19, 0xDA, 0xDA, 0x2F, 0xCA, 0x2A,
+    0xFC, 0x2A, 0xDA, 0xD2, 0xD9, 0x0F, 0xE2, 0xAE, 0xA7, 0x39, 0xAA, 0xAA, 0xAC, 0x1F, 0xE7, 0x10,
+    0x74, 0xAC, 0xA2, 0x9D, 0x39, 0xE2, 0xE9, 0x2A, 0xE1, 0x9E, 0x92, 0xAE, 0x90, 0x9E, 0xA2, 0xEA,
+    0x1A, 0xE1, 0xAE, 0x90, 0x9E, 0xA0, 0x9E, 0x91, 0xEA, 0x1E, 0x2E, 0x91, 0xAD, 0x29, 0xD9, 0x77,
+    0x77, 0x77, 0x72, 0xCA, 0x71, 0x9D, 0x97, 0x0A, 0xD7, 0xFC, 0x97, 0x0D, 0xA7, 0xFC, 0x97, 0xAD,
+    0x72, 0xAD, 0x96, 0x9D, 0x97, 0x2A, 0xD9, 0x6E, 0x73, 0xAD, 0x95, 0x9D, 0x97, 0x3A, 0xD9, 0x5E,
+    0x39, 0xD9, 0x4A, 0xD9, 0x49, 0xD3, 0x9E, 0x94, 0xAD, 0x94, 0xDA, 0x3F, 0x92, 0xAF, 0xD9, 0x19,
+    0xD3, 0xDA, 0xD9, 0x2F, 0xE9, 0x1D, 0xA2, 0xAD, 0x0D, 0x97, 0x3A, 0xD2, 0x9D, 0x1D, 0x97, 0x3D,
+    0x92, 0xD9, 0x1D, 0x97, 0x2E, 0x2A, 0xFF, 0xC9, 0x79, 0xD9, 0x3F, 0xFC, 0x97, 0xE7, 0x1D, 0x97,
+    0x0A, 0xD9, 0x71, 0xD9, 0x70, 0xE7, 0x29, 0x97, 0x29, 0x77, 0x00, 0x77, 0x77, 0x70, 0xD7, 0x19,
+    0xD9, 0x79, 0xD9, 0x6F, 0xC9, 0x7E, 0x7F, 0xC9, 0x69, 0xD9, 0x71, 0xAD, 0x96, 0xDA, 0x72, 0xAD,
+    0x95, 0xAD, 0x73, 0xAD, 0x95, 0xDA, 0x73, 0xAD, 0x94, 0xAD, 0x19, 0xFC, 0x93, 0xAD, 0x94, 0xD9,
+    0x09, 0xFE, 0x3A, 0xD9, 0x3A, 0xD1, 0xE1, 0xE9, 0x0A, 0xFD, 0x91, 0xD9, 0x1A, 0xCA, 0x1A, 0xD9,
+    0x0F, 0xE9, 0x0E, 0x7E, 0x71, 0x9D, 0x7E, 0x97, 0x1D, 0xA6, 0xE9, 0x71, 0xAD, 0x6E, 0x97, 0x2D,
+    0xA4, 0x9E, 0x99, 0x99, 0x96, 0xAD, 0x5F, 0xFC, 0x59, 0xDA, 0x5A, 0xFE, 0xA5, 0xAD, 0x77, 0x79,
+    0x77, 0x77, 0x75, 0x97, 0x29, 0xCA, 0x79, 0xFC, 0xA7, 0xE6, 0x9E, 0xAE, 0x95, 0x9D, 0x96, 0x9C,
+    0x91, 0xAD, 0x95, 0xE7, 0x4E, 0x5A, 0xD7, 0x29, 0xAE, 0x6D, 0xA7, 0x2F, 0xCA, 0x4A, 0xD7, 0x49,
+    0x0A, 0xDA, 0x3D, 0xA3, 0x9D, 0x96, 0x9D, 0xA2, 0xAD, 0x39, 0xE9, 0x59, 0xE9, 0x2D, 0x93, 0xF9,
+    0x19, 0xFD, 0xA2, 0xAD, 0x3D, 0xAD, 0x91, 0x9F, 0xC9, 0x29, 0xD9, 0x2A, 0xD0, 0xD9, 0x39, 0x95,
+    0xDA, 0x29, 0xD1, 0xD9, 0x72, 0x9D, 0x3D, 0x91, 0xD9, 0x72, 0xDA, 0x2A, 0xFF, 0xC9, 0x7A, 0xD4,
+    0xFF, 0xC9, 0x7D, 0xA7, 0x1D, 0x97, 0x0E, 0x72, 0xD9, 0x70, 0xDA, 0x72, 0x99, 0x72, 0xA7, 0x70,
+    0x49, 0x96, 0xF5, 0xF5, 0xF7, 0x77, 0x29, 0xCA, 0x6A, 0xD4, 0x9A, 0xE3, 0xFD, 0x2F, 0xDA, 0x1A,
+    0xEA, 0x93, 0xAD, 0x6A, 0xD6, 0x9D, 0x7E, 0x91, 0x9A, 0x19, 0xFE, 0x91, 0xAF, 0xDA, 0x29, 0xFC,
+    0x72, 0x77, 0x71, 0xCA, 0x77, 0x09, 0xE7, 0x79, 0xFA, 0x76, 0x9F, 0x97, 0x70, 0x9A, 0x97, 0x77,
+    0x74, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA,
+    0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9,
+    0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD,
+    0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x77, 0x76, 0xCA, 0x77, 0xAE, 0x76, 0xFC, 0x75, 0xFA, 0x76,
+    0xA9, 0x77, 0x77, 0x79, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E,
+    0x97, 0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9,
+    0x99, 0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F,
+    0x91, 0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00, 0x77, 0x73, 0xE7, 0x7F, 0xC9, 0x74, 0xAD,
+    0x9E, 0x73, 0xAD, 0x91, 0xE7, 0x2A, 0xC4, 0xA9, 0x77, 0x77, 0x29, 0xAA, 0x77, 0xF7, 0x69, 0xF9,
+    0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1,
+    0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5,
+    0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00,
+    0x59, 0x99, 0x29, 0x73, 0x9F, 0x0A, 0xC9, 0x72, 0xFF, 0x97, 0x2A, 0xC1, 0xF7, 0x49, 0x29, 0x97,
+    0x77, 0x74, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73,
+    0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99,
+    0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A,
+    0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x77, 0x70, 0xE1, 0x9D, 0xA7, 0x19, 0xE9, 0x0F, 0x72,
+    0xE9, 0x0F, 0x72, 0x99, 0x92, 0x99, 0x77, 0x77, 0x39, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD,
+    0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7,
+    0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49,
+    0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00, 0x79, 0xA9,
+    0x77, 0xFC, 0x75, 0xD9, 0x0D, 0x97, 0x4D, 0x19, 0xCA, 0x74, 0xDA, 0x0A, 0xC9, 0x74, 0x9F, 0xA7,
+    0x79, 0x97, 0x72, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9,
+    0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99,
+    0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9,
+    0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x71, 0xFF, 0xFF, 0x70, 0x9A, 0xFF, 0xFD, 0x72, 0xFE, 0x19, 0x9E, 0x71, 0xE9, 0xF3, 0xAD, 0x70,
+    0x9D, 0xA0, 0xF4, 0xA7, 0x1E, 0x1F, 0x76, 0xAD, 0xA1, 0xF7, 0x6E, 0x2F, 0xFC, 0x97, 0xAD, 0x92,
+    0xFF, 0xC7, 0x0E, 0x99, 0x99, 0xFA, 0xAA, 0xAA, 0x7F, 0xFF, 0x73, 0x9F, 0xFF, 0x49, 0x94, 0xE5,
+    0xF4, 0xD9, 0x2A, 0xDA, 0x5F, 0x39, 0xD9, 0x2E, 0x94, 0x9F, 0xAA, 0xAA, 0xE9, 0x0A, 0xFD, 0x2F,
+    0xFF, 0xC1, 0xFE, 0x19, 0xFF, 0xFC, 0x00, 0x59, 0xAE, 0xA9, 0x5A, 0xFF, 0xC3, 0xFF, 0xE2, 0xF9,
+    0x3E, 0x1A, 0xE9, 0x4E, 0x1F, 0x5A, 0xCA, 0x09, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x2F,
+    0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x19, 0xF9, 0x71, 0xFC, 0xA5, 0x99, 0x09, 0xFF, 0xF9, 0x19, 0xFF,
+    0xE4, 0xAF, 0xEA, 0x70, 0x99, 0x97, 0x29, 0xDA, 0x72, 0xAE, 0xA7, 0x3D, 0xA7, 0x29, 0xD9, 0x71,
+    0xAD, 0xA7, 0x29, 0xA6, 0x77, 0x4C, 0x97, 0x4A, 0xE7, 0x3A, 0xF9, 0x72, 0x9F, 0x97, 0x49, 0xA7,
+    0x76, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29,
+    0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA,
+    0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1,
+    0xFF, 0xFC, 0xA0, 0x77, 0x70, 0x9C, 0x97, 0x3A, 0xE7, 0x19, 0xFC, 0x71, 0xFA, 0x72, 0xA9, 0x77,
+    0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29,
+    0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA,
+    0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1,
+    0xFF, 0xFC, 0xA0, 0x77, 0x6E, 0x73, 0xFC, 0x71, 0xE9, 0xE7, 0xE2, 0xDA, 0x6A, 0xA4, 0xA7, 0x74,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29, 0xE3,
+    0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA, 0x95,
+    0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1, 0xFF,
+    0xFC, 0xA0, 0x77, 0x3E, 0x1A, 0xD9, 0x5A, 0xE9, 0x0F, 0x59, 0xE1, 0xEA, 0x69, 0x93, 0x99, 0x77,
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E,
+    0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9,
+    0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xCA, 0x00, 0x73, 0xCA, 0x6A, 0xE5, 0x9F, 0x94, 0x9F, 0x96, 0x9A, 0x75, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xF9, 0x0A, 0xFD, 0xA3, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF9, 0x2A, 0xFE, 0x90, 0xFF, 0x90, 0x77, 0x0C, 0x95, 0xAE, 0x4F, 0xC3, 0xFA, 0x4A,
+    0x97, 0x79, 0x99, 0x99, 0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x75, 0xE5, 0xFC, 0x3A,
+    0xD9, 0xE1, 0xAD, 0x2D, 0xA0, 0xAA, 0x4A, 0x73, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xF9, 0x0A, 0xFD,
+    0xA3, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF9, 0x2A, 0xFE,
+    0x90, 0xFF, 0x90, 0x72, 0xE1, 0x9D, 0x99, 0xE9, 0x0F, 0x9E, 0x90, 0xEA, 0x09, 0x93, 0x99, 0x73,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xF9, 0x0A, 0xFD, 0xA3, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF9, 0x2A, 0xFE, 0x90, 0xFF, 0x90, 0x19, 0x99, 0xAA, 0xAA, 0xAA,
+    0x97, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xD5, 0xF2, 0x9A, 0xFC, 0x4F, 0x49, 0xF9, 0x3F, 0x5A, 0xF3,
+    0xF6, 0xF3, 0xF6, 0xF9, 0x9A, 0xAF, 0xAA, 0xA9, 0x2F, 0x99, 0xFF, 0xCA, 0x2F, 0x92, 0xF9, 0x5F,
+    0x3F, 0x6F, 0x3F, 0x59, 0xEA, 0x3F, 0x5F, 0x4F, 0x4A, 0xEA, 0x4F, 0xA9, 0xAA, 0xFA, 0x3A, 0xFF,
+    0xF9, 0x4F, 0xFD, 0xA9, 0x77, 0x70, 0x69, 0x92, 0x97, 0x5F, 0x90, 0xD7, 0x39, 0xFF, 0x74, 0xCA,
+    0x0A, 0xE9, 0x77, 0x09, 0x97, 0x77, 0x69, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xD9,
+    0x3A, 0xFE, 0x1A, 0xFD, 0x39, 0xFD, 0x93, 0xFC, 0xA4, 0x9E, 0x5F, 0xD9, 0x39, 0xE5, 0xFE, 0x39,
+    0xE5, 0xFE, 0xA2, 0x9E, 0x5E, 0x9F, 0x91, 0x9E, 0x5E, 0x0A, 0xF1, 0x9E, 0x5E, 0x1F, 0xC0, 0x9E,
+    0x5E, 0x2F, 0xA9, 0xE5, 0xE2, 0xAF, 0x9E, 0x5E, 0x3F, 0xF5, 0xE4, 0xFE, 0x5E, 0x49, 0xFD, 0x49,
+    0xE5, 0xFD, 0x3F, 0xE4, 0xFC, 0x29, 0xFE, 0x49, 0xF7, 0x70, 0x99, 0x40, 0x77, 0x6A, 0xC7, 0x7E,
+    0xA7, 0x5F, 0xC7, 0x5A, 0xF7, 0x79, 0xA7, 0x77, 0x69, 0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F,
+    0xFF, 0x93, 0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9,
+    0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A,
+    0xE9, 0x1F, 0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99,
+    0x97, 0x77, 0x73, 0xAC, 0x76, 0xEA, 0x73, 0xAF, 0x97, 0x29, 0xF9, 0x74, 0xA9, 0x77, 0x77, 0x09,
+    0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1,
+    0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9,
+    0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F, 0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4,
+    0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x77, 0x70, 0xAD, 0xA7, 0x49, 0xFA, 0x72, 0x9D,
+    0xAA, 0xDA, 0x70, 0x9D, 0xA1, 0xAD, 0x70, 0x9C, 0xA3, 0xAA, 0x77, 0x74, 0x9A, 0xDA, 0xA9, 0x70,
+    0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E,
+    0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF,
+    0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF,
+    0xEA, 0x72, 0x99, 0x99, 0x70, 0x59, 0x92, 0x97, 0x2F, 0x90, 0xD7, 0x09, 0xFF, 0x71, 0xCA, 0x0A,
+    0xE9, 0x75, 0x99, 0x77, 0x76, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2,
+    0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F,
+    0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49,
+    0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x77, 0x59,
+    0xDA, 0x1E, 0x70, 0xF0, 0x9E, 0x97, 0xF0, 0x9E, 0x71, 0x99, 0x29, 0x97, 0x77, 0x59, 0xAD, 0xAA,
+    0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF,
+    0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F,
+    0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F, 0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE,
+    0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x19, 0x59, 0x1A, 0xCA, 0x3D, 0x90, 0xEA, 0x1E, 0xA1, 0xEA,
+    0xEA, 0x3F, 0xCA, 0x49, 0xF5, 0xFC, 0xA3, 0xEA, 0xEA, 0x1E, 0xA1, 0xEA, 0x0D, 0xA3, 0xD9, 0x1A,
+    0x49, 0x90, 0x69, 0xAE, 0xA9, 0x2A, 0x6A, 0xFF, 0xC9, 0xAD, 0x4F, 0xFF, 0xD4, 0xFA, 0x29, 0xFC,
+    0x93, 0xAE, 0x95, 0xFA, 0x3F, 0x5A, 0xFC, 0x29, 0xEA, 0x4A, 0xFD, 0x91, 0xAE, 0x93, 0xAD, 0x0F,
+    0x91, 0xF9, 0x2A, 0xD1, 0xF9, 0x1F, 0x91, 0xAD, 0x2F, 0x91, 0xF9, 0x0A, 0xD3, 0xF9, 0x1F, 0xAA,
+    0xD4, 0xF2, 0xAF, 0xD5, 0xF2, 0x9F, 0xC5, 0xAE, 0x93, 0xFC, 0x5F, 0x4F, 0xDA, 0x99, 0xAF, 0x4A,
+    0xFF, 0xFC, 0x49, 0xD1, 0xAF, 0xEA, 0x69, 0x49, 0x99, 0x97, 0x00, 0x77, 0x71, 0x9C, 0x97, 0x70,
+    0xAD, 0xA7, 0x7A, 0xF9, 0x76, 0x9F, 0x77, 0x19, 0xA7, 0x77, 0x49, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39,
+    0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E,
+    0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5,
+    0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9, 0x9A, 0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99,
+    0x97, 0x77, 0x76, 0x9C, 0x97, 0x7A, 0xE7, 0x59, 0xFA, 0x75, 0xFA, 0x76, 0xA9, 0x77, 0x76, 0x99,
+    0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0x19, 0xFE, 0xA9, 0xFE, 0x92, 0xAF, 0xCA,
+    0x29, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA,
+    0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93,
+    0x9F, 0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xF9, 0x4F, 0x5A, 0xFA, 0x99, 0xAF, 0x96, 0xFF, 0xEA, 0x70,
+    0xAF, 0xF9, 0x74, 0x99, 0x99, 0x70, 0x77, 0x73, 0x9E, 0x77, 0xFC, 0x75, 0xE9, 0xE7, 0x3E, 0x19,
+    0xDA, 0x72, 0xAA, 0x39, 0xA7, 0x77, 0x29, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF,
+    0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E,
+    0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9,
+    0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5, 0xAE, 0x5F, 0x94, 0xF5,
+    0xAF, 0xA9, 0x9A, 0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99, 0x97, 0x77, 0x71, 0xE1,
+    0xAD, 0x97, 0x1A, 0xE1, 0xEA, 0x71, 0x9E, 0x1E, 0xA7, 0x29, 0x93, 0x99, 0x77, 0x72, 0x99, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0x19, 0xFE, 0xA9, 0xFE, 0x92, 0xAF, 0xCA, 0x29,
+    0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E,
+    0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9F,
+    0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xF9, 0x4F, 0x5A, 0xFA, 0x99, 0xAF, 0x96, 0xFF, 0xEA, 0x70, 0xAF,
+    0xF9, 0x74, 0x99, 0x99, 0x70, 0x77, 0x73, 0x9C, 0x76, 0xEA, 0x73, 0x9F, 0x97, 0x29, 0xF9, 0x74,
+    0xA9, 0x77, 0x73, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0xA0, 0x9F, 0xDA, 0x9F,
+    0xDA, 0x2A, 0xFA, 0x2A, 0xF4, 0xEA, 0x4F, 0x92, 0x9E, 0x59, 0xF2, 0xE9, 0x6F, 0x90, 0x9D, 0xA7,
+    0x0F, 0x0E, 0x71, 0xAE, 0xAD, 0xA7, 0x2F, 0xD7, 0x39, 0xF9, 0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+    0x75, 0xF9, 0x72, 0xFF, 0xA7, 0x9F, 0xFA, 0x30, 0x09, 0x99, 0x99, 0x99, 0x97, 0xFF, 0x96, 0x9A,
+    0xFA, 0x72, 0xF7, 0x3F, 0xFA, 0x95, 0xFF, 0xE4, 0xF1, 0x9F, 0xC3, 0xF3, 0xF3, 0xF3, 0xAE, 0x92,
+    0xF3, 0xAE, 0x92, 0xF3, 0xF3, 0xF2, 0x9E, 0xA3, 0xF9, 0xAF, 0xC4, 0xFF, 0xCA, 0x5F, 0xAA, 0x99,
+    0x7F, 0x71, 0x9F, 0xE7, 0xFF, 0x95, 0x69, 0x9A, 0xA9, 0x70, 0xAF, 0xE9, 0x5A, 0xFF, 0xC4, 0xAE,
+    0x91, 0xAE, 0x93, 0xEA, 0x3E, 0x92, 0x9E, 0x93, 0xE9, 0x2A, 0xE3, 0x9E, 0x3A, 0xE2, 0xAD, 0xA4,
+    0xAE, 0x1A, 0xD9, 0x5A, 0xE1, 0xE6, 0xAE, 0x1E, 0xA5, 0xAE, 0x1F, 0xC4, 0xAE, 0x19, 0xFC, 0x3A,
+    0xE2, 0x9F, 0xC2, 0xAE, 0x4F, 0xA1, 0xAE, 0x5F, 0x1A, 0xE0, 0x9C, 0x2E, 0xA1, 0xAE, 0x0D, 0xA1,
+    0xE9, 0x9F, 0xC0, 0xFF, 0x0A, 0xFC, 0x09, 0xFC, 0xA7, 0x29, 0x99, 0x30, 0x2A, 0x97, 0x2A, 0xD7,
+    0x2A, 0xE7, 0x2E, 0xA7, 0x2A, 0xD7, 0x4A, 0x77, 0x71, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92,
+    0x9E, 0x90, 0x9F, 0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE,
+    0x2F, 0x2F, 0x2F, 0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92,
+    0x59, 0xA7, 0x3D, 0xA7, 0x1A, 0xDA, 0x71, 0xE7, 0x1A, 0xD7, 0x3A, 0x77, 0x72, 0x99, 0x97, 0x9F,
+    0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F, 0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF,
+    0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F, 0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F,
+    0x93, 0x99, 0x39, 0x92, 0x59, 0x72, 0xAD, 0xA7, 0x1F, 0x97, 0xDA, 0xAD, 0x6A, 0xD1, 0xE5, 0xD3,
+    0xCA, 0x77, 0x69, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49,
+    0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9,
+    0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x2A, 0xA2, 0x96, 0xF9, 0x0D, 0x49,
+    0xFF, 0x5C, 0xA0, 0x9E, 0x97, 0x29, 0x77, 0x70, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E,
+    0x90, 0x9F, 0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F,
+    0x2F, 0x2F, 0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92, 0x76,
+    0x9D, 0xA1, 0xE4, 0xAE, 0x09, 0xE9, 0x3A, 0xE0, 0x9E, 0x69, 0x39, 0x77, 0x79, 0x99, 0x79, 0xFD,
+    0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3,
+    0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9,
+    0x39, 0x93, 0x99, 0x20, 0x3A, 0xD9, 0x70, 0xFC, 0xA6, 0x9C, 0xA1, 0xD6, 0x9C, 0xA1, 0xD6, 0x9D,
+    0x09, 0xD7, 0xAF, 0x72, 0x99, 0x73, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F,
+    0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92, 0x49, 0x99, 0x49,
+    0x95, 0x9F, 0xD0, 0x9F, 0xD2, 0xAF, 0xFF, 0xF0, 0x9E, 0x90, 0x9F, 0xA1, 0xAE, 0x99, 0xE2, 0xF3,
+    0xEA, 0x09, 0x99, 0x2E, 0xA2, 0x9F, 0x49, 0xAF, 0xFF, 0x1A, 0xFF, 0xFA, 0xAA, 0x90, 0xFA, 0x9E,
+    0xA7, 0xAE, 0x2A, 0xE7, 0xF2, 0x9E, 0xA6, 0xF9, 0x99, 0xFD, 0xA9, 0xAA, 0xCA, 0xAF, 0xFF, 0xFC,
+    0x90, 0xAF, 0xCA, 0x1A, 0xFD, 0x93, 0x99, 0x69, 0x99, 0x30, 0x59, 0x99, 0x7A, 0xFD, 0x4F, 0xFA,
+    0x2F, 0x90, 0xF1, 0x9E, 0x91, 0x9E, 0x1F, 0x3C, 0xA2, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x97, 0xAF,
+    0x79, 0xFC, 0xAA, 0xAA, 0xC2, 0xAF, 0xFC, 0x39, 0xFE, 0x96, 0x99, 0x97, 0x09, 0xD9, 0x70, 0xAE,
+    0x97, 0x1D, 0xA7, 0x09, 0xD7, 0x0A, 0xD9, 0x70, 0x9A, 0x50, 0x39, 0xA7, 0x2D, 0x97, 0x09, 0xE7,
+    0x19, 0xE7, 0x19, 0xDA, 0x72, 0xA7, 0x77, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE,
+    0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F,
+    0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x7C, 0x72, 0xAD,
+    0x71, 0xE7, 0x0E, 0x97, 0x0D, 0x97, 0x1A, 0x97, 0x77, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E,
+    0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70,
+    0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x77,
+    0x2E, 0x70, 0xFC, 0x6A, 0xD9, 0xDA, 0x5D, 0x90, 0x9D, 0x4A, 0xCA, 0x2A, 0xC7, 0x74, 0x99, 0x97,
+    0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA,
+    0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A,
+    0xFE, 0x96, 0x99, 0x93, 0x77, 0xE1, 0xAD, 0x92, 0x9E, 0x90, 0xEA, 0x3E, 0x1E, 0x94, 0x93, 0x97,
+    0x75, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E,
+    0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91,
+    0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x1A, 0x6E, 0x5E, 0xA5, 0xE9, 0x5A, 0xD6, 0x9A, 0x77,
+    0x5A, 0xFA, 0x19, 0xFC, 0xA3, 0xAE, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E,
+    0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA2, 0xAF, 0xD9, 0x0F, 0xE9, 0x4A, 0x96, 0xD9, 0x4E, 0x93,
+    0x9D, 0xA4, 0xDA, 0x59, 0xA7, 0x76, 0xAF, 0xA1, 0x9F, 0xCA, 0x3A, 0xEA, 0x39, 0xEA, 0x39, 0xEA,
+    0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x2A, 0xFD, 0x90, 0xFE,
+    0x90, 0x73, 0xE9, 0x39, 0xF3, 0xD9, 0xE1, 0xDA, 0x1D, 0xA0, 0xD2, 0x9C, 0x97, 0x72, 0xAF, 0xA1,
+    0x9F, 0xCA, 0x3A, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA,
+    0x39, 0xEA, 0x39, 0xEA, 0x2A, 0xFD, 0x90, 0xFE, 0x90, 0x71, 0x9D, 0x90, 0x9D, 0xA0, 0xF0, 0xAE,
+    0x0E, 0xA0, 0xAE, 0x19, 0x49, 0x77, 0x6A, 0xFA, 0x29, 0xFC, 0xA4, 0xAE, 0xA4, 0x9E, 0xA4, 0x9E,
+    0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA3, 0xAF, 0xD9, 0x1F,
+    0xE9, 0x00, 0x77, 0x39, 0xA1, 0x9C, 0x79, 0xFD, 0x79, 0xFA, 0x71, 0xFC, 0x97, 0xD9, 0xAE, 0x73,
+    0xF7, 0x3E, 0x95, 0xAF, 0xF3, 0x9F, 0xFD, 0x92, 0xF9, 0x09, 0xFA, 0x19, 0xE9, 0x2A, 0xF1, 0xF4,
+    0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xAE, 0xA2, 0x9E, 0x91, 0x9F, 0xA0, 0x9F,
+    0x3A, 0xFF, 0xC5, 0x9F, 0xDA, 0x71, 0x99, 0x95, 0x5A, 0xA2, 0x97, 0x1F, 0x99, 0xCA, 0x79, 0xFE,
+    0xA7, 0x0C, 0x90, 0xAE, 0x76, 0x97, 0x77, 0x29, 0x92, 0x99, 0x95, 0xAF, 0x0A, 0xFC, 0x92, 0x9F,
+    0xFF, 0xC3, 0x9A, 0xFC, 0xAA, 0xFA, 0x39, 0xEA, 0x29, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3,
+    0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39,
+    0xEA, 0x3E, 0xA2, 0xAF, 0xCA, 0x1F, 0xD9, 0x0F, 0xE0, 0x9F, 0xD9, 0x4A, 0x74, 0xE7, 0x3E, 0xA7,
+    0x3E, 0x97, 0x3A, 0xD7, 0x49, 0xA7, 0x77, 0x29, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9,
+    0x09, 0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1,
+    0xFA, 0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x7A,
+    0x97, 0x4D, 0x97, 0x2E, 0x97, 0x19, 0xDA, 0x72, 0xDA, 0x73, 0x9A, 0x77, 0x73, 0x99, 0x99, 0x70,
+    0xAF, 0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F, 0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F,
+    0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2, 0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF,
+    0xDA, 0x71, 0x99, 0x95, 0x77, 0x4E, 0x97, 0x19, 0xF7, 0x1D, 0x9E, 0x7D, 0xA1, 0xDA, 0x6D, 0x29,
+    0xC9, 0x77, 0x79, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x29,
+    0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA, 0x29, 0xEA, 0x19, 0xFA,
+    0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x4A, 0xA2, 0x97, 0xF0, 0x9C, 0xA5,
+    0xAF, 0xEA, 0x59, 0xC9, 0x0A, 0xE7, 0x49, 0x77, 0x71, 0x99, 0x99, 0x70, 0xAF, 0xDA, 0x5F, 0xFD,
+    0x3F, 0x90, 0x9F, 0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F,
+    0x4F, 0x1F, 0xA2, 0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF, 0xDA, 0x71, 0x99, 0x95,
+    0x77, 0x19, 0xD9, 0x09, 0xDA, 0x5F, 0x0A, 0xE5, 0xEA, 0x0A, 0xE6, 0x94, 0x97, 0x77, 0x09, 0x99,
+    0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4,
+    0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA, 0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC,
+    0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x77, 0xAD, 0x97, 0xEA, 0x7E, 0x97, 0x09, 0x59, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x0A, 0xFF, 0xD9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x70, 0xAD, 0x70, 0xEA,
+    0x7E, 0x97, 0x09, 0x50, 0x59, 0x99, 0x97, 0x0A, 0xFD, 0xAA, 0xC3, 0xFF, 0xE2, 0xF1, 0x9F, 0x91,
+    0x9E, 0x92, 0xAF, 0x1F, 0x2A, 0xFC, 0x1F, 0x1A, 0xFD, 0x1F, 0x0A, 0xD0, 0xAE, 0x1F, 0xAD, 0x1F,
+    0x1F, 0xD2, 0xF1, 0xAF, 0x3E, 0xA1, 0x9F, 0x91, 0xF2, 0xAF, 0xFD, 0x3D, 0x9F, 0xDA, 0x71, 0x99,
+    0x95, 0x49, 0xA7, 0x6D, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x59, 0xD9, 0x76, 0xA7, 0x77, 0x77, 0x2A,
+    0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9, 0x29, 0xFC,
+    0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x70, 0xA7, 0x6A, 0xD7, 0x49, 0xE7, 0x4E, 0x97, 0x4D, 0x97,
+    0x5A, 0x97, 0x77, 0x77, 0x2A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC,
+    0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x77, 0x69, 0xE7, 0x4F, 0xA7,
+    0x2A, 0xD9, 0xD9, 0x70, 0x9D, 0x90, 0xAD, 0x70, 0xAC, 0x92, 0xAC, 0x77, 0x77, 0x7A, 0xF2, 0xAF,
+    0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC,
+    0x59, 0x99, 0x29, 0x93, 0x77, 0x4E, 0x1A, 0xD9, 0x69, 0xE9, 0x0E, 0xA7, 0xE1, 0xE9, 0x70, 0x93,
+    0x97, 0x77, 0x77, 0x0A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F,
+    0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x79, 0xA7, 0x6D, 0xA7, 0x4A, 0xDA,
+    0x74, 0xE7, 0x4A, 0xD7, 0x6A, 0x77, 0x77, 0x72, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF, 0xA2,
+    0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A,
+    0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74, 0x9D,
+    0xA7, 0x4E, 0x73, 0xAE, 0xA7, 0xAF, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x49, 0x70,
+    0x9A, 0xF7, 0x0F, 0xD7, 0x19, 0xF7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE2, 0x99, 0x5A, 0xE9, 0xFC,
+    0xA3, 0xAF, 0xFD, 0xA2, 0xAF, 0xAA, 0xFC, 0x2A, 0xE9, 0x2F, 0x91, 0xAE, 0x3A, 0xEA, 0x1A, 0xE3,
+    0x9E, 0xA1, 0xAE, 0x39, 0xEA, 0x1A, 0xE3, 0x9E, 0xA1, 0xAE, 0x39, 0xE9, 0x1A, 0xE3, 0xF2, 0xAE,
+    0xA9, 0x9A, 0xEA, 0x2A, 0xFF, 0xCA, 0x3A, 0xFF, 0x94, 0xAE, 0x99, 0x97, 0xAE, 0x72, 0xAE, 0x72,
+    0xFA, 0x79, 0xFE, 0x95, 0x9A, 0xAA, 0xAA, 0xAA, 0x60, 0x77, 0x39, 0xDA, 0x1E, 0x7A, 0xE0, 0x9E,
+    0x7A, 0xDA, 0x09, 0xE7, 0x09, 0x93, 0x97, 0x77, 0x77, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF,
+    0xA2, 0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E,
+    0x7A, 0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74,
+    0x9D, 0xA7, 0x4E, 0x73, 0xAE, 0xA7, 0xAF, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x59,
+    0x99, 0x99, 0x99, 0x73, 0xAF, 0xE9, 0x72, 0xFF, 0x77, 0x77, 0x77, 0x79, 0xAA, 0x77, 0xF7, 0x69,
+    0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72,
+    0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6,
+    0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF,
+    0x00, 0x1F, 0xF4, 0x9F, 0xF5, 0x99, 0x99, 0x99, 0x99, 0x77, 0x69, 0x99, 0x79, 0xFD, 0xA4, 0xAF,
+    0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF,
+    0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93,
+    0x99, 0x20, 0x5A, 0x49, 0x73, 0xDA, 0x29, 0xC9, 0x72, 0xAF, 0xE7, 0x4F, 0xD9, 0x75, 0x9A, 0xA9,
+    0x77, 0x77, 0x59, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97,
+    0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99,
+    0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91,
+    0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00, 0x77, 0xD3, 0x9C, 0x49, 0xE9, 0x9A, 0xCA, 0x5A,
+    0xFD, 0x79, 0xAC, 0xA9, 0x77, 0x70, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F,
+    0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F,
+    0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92, 0x70, 0x9A, 0xA7,
+    0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD,
+    0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6,
+    0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F,
+    0xE9, 0x2F, 0xF7, 0x5A, 0xD9, 0x76, 0xAD, 0x77, 0x0E, 0x77, 0x0F, 0xA9, 0x75, 0xAF, 0x97, 0x79,
+    0x93, 0x49, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92,
+    0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A,
+    0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x92, 0x9D, 0x72, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xEA, 0xA7,
+    0x0A, 0xF7, 0x29, 0x91, 0x77, 0x70, 0xAA, 0x72, 0x9E, 0x71, 0xAF, 0x70, 0xAE, 0xA7, 0x19, 0xA9,
+    0x77, 0x72, 0x9A, 0xEA, 0x95, 0xAF, 0xFC, 0x3F, 0xFE, 0x2F, 0x93, 0xE1, 0xAE, 0x94, 0xE1, 0xF5,
+    0xAC, 0xA0, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0xAF, 0x71,
+    0x9F, 0x97, 0x1F, 0xCA, 0x59, 0x90, 0x9F, 0xFF, 0x91, 0x9F, 0xFE, 0x4A, 0xFE, 0xA7, 0x09, 0x99,
+    0x40, 0x7A, 0x72, 0xAD, 0x70, 0x9E, 0x70, 0xE9, 0x70, 0xD9, 0x71, 0xA9, 0x77, 0x79, 0x99, 0x7A,
+    0xFD, 0x4F, 0xFA, 0x2F, 0x90, 0xF1, 0x9E, 0x91, 0x9E, 0x1F, 0x3C, 0xA2, 0xF7, 0x0F, 0x70, 0xF7,
+    0x0F, 0x97, 0xAF, 0x79, 0xFC, 0xAA, 0xAA, 0xC2, 0xAF, 0xFC, 0x39, 0xFE, 0x96, 0x99, 0x93, 0x77,
+    0x5E, 0x97, 0x1A, 0xF9, 0x7A, 0xD9, 0xE9, 0x5A, 0xD9, 0x1E, 0x59, 0xC9, 0x3A, 0x97, 0x76, 0x9A,
+    0xEA, 0x95, 0xAF, 0xFC, 0x3F, 0xFE, 0x2F, 0x93, 0xE1, 0xAE, 0x94, 0xE1, 0xF5, 0xAC, 0xA0, 0x9E,
+    0x97, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0xAF, 0x71, 0x9F, 0x97, 0x1F,
+    0xCA, 0x59, 0x90, 0x9F, 0xFF, 0x91, 0x9F, 0xFE, 0x4A, 0xFE, 0xA7, 0x09, 0x99, 0x40, 0x77, 0x19,
+    0xE7, 0x0F, 0xA6, 0xAD, 0x9D, 0x94, 0x9D, 0x90, 0xAD, 0x4A, 0xC9, 0x2A, 0xC7, 0x74, 0x99, 0x97,
+    0xAF, 0xD4, 0xFF, 0xA2, 0xF9, 0x0F, 0x19, 0xE9, 0x19, 0xE1, 0xF3, 0xCA, 0x2F, 0x70, 0xF7, 0x0F,
+    0x70, 0xF9, 0x7A, 0xF7, 0x9F, 0xCA, 0xAA, 0xAC, 0x2A, 0xFF, 0xC3, 0x9F, 0xE9, 0x69, 0x99, 0x30,
+    0x69, 0xA9, 0x72, 0x9E, 0x97, 0x1A, 0xEA, 0x71, 0x9E, 0x97, 0x29, 0x97, 0x77, 0x29, 0xAE, 0xA9,
+    0x5A, 0xFF, 0xC3, 0xFF, 0xE2, 0xF9, 0x3E, 0x1A, 0xE9, 0x4E, 0x1F, 0x5A, 0xCA, 0x09, 0xE9, 0x71,
+    0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x2F, 0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x19, 0xF9, 0x71, 0xFC, 0xA5,
+    0x99, 0x09, 0xFF, 0xF9, 0x19, 0xFF, 0xE4, 0xAF, 0xEA, 0x70, 0x99, 0x94, 0x59, 0x97, 0x1A, 0xE7,
+    0x0F, 0x70, 0xAE, 0x71, 0x99, 0x77, 0x79, 0x99, 0x7A, 0xFD, 0x4F, 0xFA, 0x2F, 0x90, 0xF1, 0x9E,
+    0x91, 0x9E, 0x1F, 0x3C, 0xA2, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x97, 0xAF, 0x79, 0xFC, 0xAA, 0xAA,
+    0xC2, 0xAF, 0xFC, 0x39, 0xFE, 0x96, 0x99, 0x93, 0x77, 0x2D, 0x39, 0xD5, 0xE1, 0xAD, 0x95, 0x9E,
+    0xAD, 0x97, 0x9F, 0xA7, 0x2D, 0xA7, 0x77, 0x19, 0xAE, 0xA9, 0x5A, 0xFF, 0xC3, 0xFF, 0xE2, 0xF9,
+    0x3E, 0x1A, 0xE9, 0x4E, 0x1F, 0x5A, 0xCA, 0x09, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x2F,
+    0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x19, 0xF9, 0x71, 0xFC, 0xA5, 0x99, 0x09, 0xFF, 0xF9, 0x19, 0xFF,
+    0xE4, 0xAF, 0xEA, 0x70, 0x99, 0x94, 0x39, 0x39, 0x94, 0xD9, 0x1A, 0xD4, 0xE0, 0x9D, 0x95, 0xFC,
+    0xA7, 0xF7, 0x1A, 0xA7, 0x77, 0x99, 0x97, 0xAF, 0xD4, 0xFF, 0xA2, 0xF9, 0x0F, 0x19, 0xE9, 0x19,
+    0xE1, 0xF3, 0xCA, 0x2F, 0x70, 0xF7, 0x0F, 0x70, 0xF9, 0x7A, 0xF7, 0x9F, 0xCA, 0xAA, 0xAC, 0x2A,
+    0xFF, 0xC3, 0x9F, 0xE9, 0x69, 0x99, 0x30, 0x77, 0x6A, 0xC3, 0x9D, 0x71, 0xAD, 0x19, 0xDA, 0x72,
+    0xEA, 0xDA, 0x74, 0xFC, 0x76, 0xE7, 0x77, 0x59, 0x99, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xFC, 0x94,
+    0xAF, 0xFF, 0xD5, 0xF2, 0x9A, 0xFC, 0x4F, 0x49, 0xF9, 0x3F, 0x5A, 0xF3, 0xF6, 0xF3, 0xF6, 0xF9,
+    0x2F, 0x6F, 0x92, 0xF6, 0xF9, 0x2F, 0x6F, 0x3F, 0x6F, 0x3F, 0x59, 0xEA, 0x3F, 0x5F, 0x4F, 0x4A,
+    0xEA, 0x4F, 0xA9, 0xAA, 0xFA, 0x3A, 0xFF, 0xF9, 0x4F, 0xFD, 0xA9, 0x77, 0x70, 0x73, 0x92, 0x97,
+    0x9A, 0xF9, 0x0A, 0xD6, 0xFD, 0x90, 0xAD, 0x79, 0xF9, 0x0D, 0xA7, 0x0A, 0xE9, 0x0D, 0x71, 0xAE,
+    0x90, 0xCA, 0x69, 0x99, 0xAE, 0x90, 0x95, 0xAF, 0xF9, 0x6F, 0xFD, 0x95, 0xF9, 0x1A, 0xE9, 0x49,
+    0xE9, 0x2A, 0xE9, 0x4F, 0x3A, 0xE9, 0x4F, 0x3A, 0xE9, 0x4F, 0x3A, 0xE9, 0x4F, 0x3A, 0xE9, 0x4F,
+    0x3A, 0xE9, 0x4F, 0xA2, 0xAE, 0x94, 0xAF, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x94, 0xFC, 0xA0, 0xFC,
+    0x96, 0x99, 0x39, 0x50, 0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xD5,
+    0xF2, 0x9A, 0xFC, 0x4F, 0x49, 0xF9, 0x3F, 0x5A, 0xF3, 0xF6, 0xF3, 0xF6, 0xF9, 0x9A, 0xAF, 0xAA,
+    0xA9, 0x2F, 0x99, 0xFF, 0xCA, 0x2F, 0x92, 0xF9, 0x5F, 0x3F, 0x6F, 0x3F, 0x59, 0xEA, 0x3F, 0x5F,
+    0x4F, 0x4A, 0xEA, 0x4F, 0xA9, 0xAA, 0xFA, 0x3A, 0xFF, 0xF9, 0x4F, 0xFD, 0xA9, 0x77, 0x70, 0x73,
+    0x97, 0x19, 0xAF, 0x97, 0x0F, 0xD9, 0x71, 0x9A, 0xE9, 0x79, 0xAA, 0xFA, 0xA9, 0x5F, 0xFC, 0xA7,
+    0x0A, 0xE9, 0x6A, 0xAC, 0xAF, 0x94, 0xAF, 0xFC, 0x93, 0xAF, 0xFD, 0x92, 0x9E, 0xA2, 0xAE, 0x92,
+    0xAE, 0x3A, 0xE9, 0x2F, 0x3A, 0xE9, 0x2F, 0x3A, 0xE9, 0x2F, 0x3A, 0xE9, 0x2F, 0x3A, 0xE9, 0x2F,
+    0xA2, 0xAE, 0x92, 0xAF, 0xAA, 0xFC, 0x93, 0xFF, 0xFC, 0x92, 0xFC, 0xA0, 0xFC, 0x94, 0x99, 0x39,
+    0x30, 0x39, 0x99, 0x99, 0x99, 0x97, 0xFF, 0x7F, 0xF7, 0x77, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29, 0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93,
+    0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA, 0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D,
+    0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1, 0xFF, 0xFC, 0xA0, 0x2A, 0xFE, 0x93,
+    0xFF, 0x93, 0x99, 0x99, 0x99, 0x99, 0x77, 0x49, 0x99, 0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xEA, 0x1A,
+    0xE9, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0xA7, 0x0F, 0x70,
+    0xF9, 0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD, 0x92, 0xAF, 0xE9, 0x69, 0x99, 0x30, 0x49, 0x49,
+    0x7D, 0x92, 0xAC, 0x96, 0xFF, 0x70, 0xFD, 0x97, 0x19, 0xAA, 0x97, 0x76, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29, 0xE3, 0xF4, 0x9D, 0x3F, 0x5C,
+    0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA, 0x95, 0xF7, 0x3F, 0x59, 0x4F,
+    0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1, 0xFF, 0xFC, 0xA0, 0x77, 0xAC,
+    0x93, 0xC9, 0x3E, 0xA9, 0xAD, 0x49, 0xFD, 0x96, 0xAD, 0xA7, 0x76, 0x99, 0x97, 0xAF, 0xCA, 0x4F,
+    0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0,
+    0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99,
+    0x93, 0x69, 0xA7, 0x4A, 0xE7, 0x3F, 0x73, 0xAE, 0x74, 0x99, 0x77, 0x79, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E, 0x3F, 0x49, 0xD3, 0xF5, 0xC9,
+    0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9, 0x5F, 0x73, 0xF5, 0x94, 0xF5,
+    0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x59, 0x97,
+    0x1A, 0xE7, 0x0F, 0x70, 0xAE, 0x72, 0x97, 0x77, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1,
+    0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7,
+    0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E, 0x3F, 0x49,
+    0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9, 0x5F, 0x73,
+    0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA,
+    0x72, 0xD9, 0x73, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xFA, 0x72, 0xFC, 0x73, 0x99, 0x92, 0x59, 0x99,
+    0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xEA, 0x1A, 0xE9, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F, 0xFE,
+    0xA0, 0xFF, 0xEA, 0x0E, 0xA7, 0x0F, 0x70, 0xF9, 0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD, 0x92,
+    0xAF, 0xE9, 0x69, 0x9D, 0x97, 0x0A, 0xCA, 0x71, 0xDA, 0x71, 0xEA, 0xA7, 0x9F, 0x71, 0x99, 0x10,
+    0x77, 0x3C, 0xA3, 0xAC, 0x95, 0x9D, 0xA1, 0xE7, 0xAD, 0xAA, 0xD7, 0x1A, 0xF7, 0x39, 0xD9, 0x77,
+    0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E,
+    0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9,
+    0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xCA, 0x00, 0x39, 0x39, 0x94, 0xD9, 0x1A, 0xD4, 0xAD, 0x09, 0xD9, 0x5F, 0xCA, 0x7F, 0x71,
+    0xAA, 0x97, 0x76, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0,
+    0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99,
+    0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x77, 0x70, 0xE7, 0x4F, 0xC7, 0x2E, 0x9E,
+    0x70, 0xE2, 0xDA, 0x7A, 0xA4, 0xA7, 0x77, 0x29, 0xAA, 0xEA, 0x96, 0xAF, 0xFD, 0x4F, 0xFF, 0x92,
+    0xFC, 0x93, 0xE9, 0x1A, 0xEA, 0x5A, 0xD9, 0x1F, 0x69, 0xD1, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7,
+    0x4F, 0x59, 0x99, 0x99, 0x90, 0xF4, 0xFE, 0x9F, 0x93, 0x9F, 0xD0, 0xAE, 0xA6, 0xF0, 0x9F, 0x95,
+    0xF1, 0xFC, 0x94, 0xF1, 0x9F, 0xDA, 0xAA, 0xFC, 0x29, 0xFF, 0xFC, 0x4A, 0xFF, 0xA9, 0x70, 0x99,
+    0x99, 0x50, 0x77, 0x39, 0xE7, 0x2F, 0xC7, 0x0A, 0xD9, 0xDA, 0x69, 0xD9, 0x09, 0xD6, 0xAC, 0x92,
+    0xAC, 0x77, 0x70, 0x99, 0x92, 0x99, 0x39, 0xFF, 0xE1, 0x9F, 0xFE, 0xA1, 0xEA, 0x19, 0xE0, 0x92,
+    0xE9, 0x2E, 0x93, 0xE3, 0xEA, 0x3E, 0x92, 0xE9, 0x3A, 0xEA, 0xAF, 0x5F, 0xF5, 0x9D, 0xAA, 0xAA,
+    0x96, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xE9, 0x2A, 0xFF, 0xE1, 0xAE, 0xAA, 0xAA, 0xAF,
+    0x09, 0xE9, 0x4A, 0xE0, 0x9E, 0x93, 0x9E, 0xA1, 0xFC, 0xAA, 0xFC, 0x2A, 0xFF, 0xCA, 0x5A, 0xFA,
+    0x94, 0x59, 0x49, 0x70, 0xD9, 0x2A, 0xC9, 0x7F, 0xF7, 0x1F, 0xD9, 0x72, 0x9A, 0xA9, 0x77, 0x74,
+    0x9A, 0xAE, 0xA9, 0x6A, 0xFF, 0xD4, 0xFF, 0xF9, 0x2F, 0xC9, 0x3E, 0x91, 0xAE, 0xA5, 0xAD, 0x91,
+    0xF6, 0x9D, 0x19, 0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x74, 0xF5, 0x99, 0x99, 0x99, 0x0F, 0x4F, 0xE9,
+    0xF9, 0x39, 0xFD, 0x0A, 0xEA, 0x6F, 0x09, 0xF9, 0x5F, 0x1F, 0xC9, 0x4F, 0x19, 0xFD, 0xAA, 0xAF,
+    0xC2, 0x9F, 0xFF, 0xC4, 0xAF, 0xFA, 0x97, 0x09, 0x99, 0x95, 0x77, 0x1D, 0x93, 0xC6, 0xEA, 0x9A,
+    0xD6, 0x9F, 0xD9, 0x70, 0xAD, 0xA7, 0x77, 0x29, 0x99, 0x29, 0x93, 0x9F, 0xFE, 0x19, 0xFF, 0xEA,
+    0x1E, 0xA1, 0x9E, 0x09, 0x2E, 0x92, 0xE9, 0x3E, 0x3E, 0xA3, 0xE9, 0x2E, 0x93, 0xAE, 0xAA, 0xF5,
+    0xFF, 0x59, 0xDA, 0xAA, 0xA9, 0x6E, 0x73, 0xE9, 0x99, 0x99, 0x99, 0x4F, 0xFE, 0x92, 0xAF, 0xFE,
+    0x1A, 0xEA, 0xAA, 0xAA, 0xF0, 0x9E, 0x94, 0xAE, 0x09, 0xE9, 0x39, 0xEA, 0x1F, 0xCA, 0xAF, 0xC2,
+    0xAF, 0xFC, 0xA5, 0xAF, 0xA9, 0x40, 0x79, 0xA7, 0x5A, 0xE7, 0x4F, 0x74, 0xAE, 0x75, 0x99, 0x77,
+    0x75, 0x9A, 0xAE, 0xA9, 0x6A, 0xFF, 0xD4, 0xFF, 0xF9, 0x2F, 0xC9, 0x3E, 0x91, 0xAE, 0xA5, 0xAD,
+    0x91, 0xF6, 0x9D, 0x19, 0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x74, 0xF5, 0x99, 0x99, 0x99, 0x0F, 0x4F,
+    0xE9, 0xF9, 0x39, 0xFD, 0x0A, 0xEA, 0x6F, 0x09, 0xF9, 0x5F, 0x1F, 0xC9, 0x4F, 0x19, 0xFD, 0xAA,
+    0xAF, 0xC2, 0x9F, 0xFF, 0xC4, 0xAF, 0xFA, 0x97, 0x09, 0x99, 0x95, 0x59, 0x97, 0x3A, 0xE7, 0x2F,
+    0x72, 0xAE, 0x73, 0x99, 0x77, 0x73, 0x99, 0x92, 0x99, 0x39, 0xFF, 0xE1, 0x9F, 0xFE, 0xA1, 0xEA,
+    0x19, 0xE0, 0x92, 0xE9, 0x2E, 0x93, 0xE3, 0xEA, 0x3E, 0x92, 0xE9, 0x3A, 0xEA, 0xAF, 0x5F, 0xF5,
+    0x9D, 0xAA, 0xAA, 0x96, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xE9, 0x2A, 0xFF, 0xE1, 0xAE,
+    0xAA, 0xAA, 0xAF, 0x09, 0xE9, 0x4A, 0xE0, 0x9E, 0x93, 0x9E, 0xA1, 0xFC, 0xAA, 0xFC, 0x2A, 0xFF,
+    0xCA, 0x5A, 0xFA, 0x94, 0x59, 0xAA, 0xEA, 0x96, 0xAF, 0xFD, 0x4F, 0xFF, 0x92, 0xFC, 0x93, 0xE9,
+    0x1A, 0xEA, 0x5A, 0xD9, 0x1F, 0x69, 0xD1, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x4F, 0x59, 0x99,
+    0x99, 0x90, 0xF4, 0xFE, 0x9F, 0x93, 0x9F, 0xD0, 0xAE, 0xA6, 0xF0, 0x9F, 0x95, 0xF1, 0xFC, 0x94,
+    0xF1, 0x9F, 0xDA, 0xAA, 0xFC, 0x29, 0xFF, 0xFC, 0x4A, 0xFF, 0xA9, 0x70, 0x99, 0x99, 0x75, 0x9A,
+    0xA7, 0x5E, 0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0x97, 0x39, 0xDA, 0x75, 0x99, 0x60, 0x69, 0x74, 0x9D,
+    0x73, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xAD, 0xA7, 0x39, 0x75, 0x99, 0x92, 0x99, 0x39,
+    0xFF, 0xE1, 0x9F, 0xFE, 0xA1, 0xEA, 0x19, 0xE0, 0x92, 0xE9, 0x2E, 0x93, 0xE3, 0xEA, 0x3E, 0x92,
+    0xE9, 0x3A, 0xEA, 0xAF, 0x5F, 0xF5, 0x9D, 0xAA, 0xAA, 0x96, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x94,
+    0xFF, 0xE9, 0x2A, 0xFF, 0xE1, 0xAE, 0xAA, 0xAA, 0xAF, 0x09, 0xE9, 0x4A, 0xE0, 0x9E, 0x93, 0x9E,
+    0xA1, 0xFC, 0xAA, 0xFC, 0x2A, 0xFF, 0xCA, 0x5A, 0xFA, 0x94, 0x77, 0x75, 0xAD, 0xA7, 0x79, 0xFA,
+    0x75, 0x9D, 0xAA, 0xDA, 0x73, 0x9D, 0xA1, 0xAD, 0x73, 0x9C, 0xA3, 0xAA, 0x77, 0x73, 0x99, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x91, 0xFF, 0x91, 0xFF, 0xA0, 0xAF, 0xDA, 0x2A, 0xFD, 0xA3,
+    0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xFF,
+    0xFE, 0x94, 0xFF, 0xFE, 0x94, 0xFA, 0xAA, 0xAA, 0xAA, 0xF9, 0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9,
+    0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0x95, 0xFA, 0x2A, 0xFE, 0x91, 0xAF, 0xEA, 0x0F, 0xF9,
+    0x1F, 0xFA, 0x77, 0x49, 0xE9, 0x74, 0xFC, 0x97, 0x2E, 0x9E, 0x71, 0xAD, 0x2D, 0xA7, 0x09, 0xA4,
+    0xA7, 0x69, 0x73, 0x9A, 0xF9, 0x72, 0xFD, 0x97, 0x39, 0xF9, 0x74, 0xAE, 0x97, 0x4A, 0xE9, 0x74,
+    0xAE, 0x29, 0x99, 0x7A, 0xE9, 0xAF, 0xC6, 0xAF, 0xFE, 0x5A, 0xFC, 0xAF, 0xC5, 0xAE, 0xA2, 0xAE,
+    0x94, 0xAE, 0x92, 0x9E, 0x94, 0xAE, 0x92, 0x9E, 0x94, 0xAE, 0x92, 0x9E, 0x94, 0xAE, 0x92, 0x9E,
+    0x94, 0xAE, 0x92, 0x9E, 0x94, 0xAE, 0x92, 0x9E, 0x94, 0xAE, 0x92, 0x9E, 0x93, 0xAF, 0xC9, 0x09,
+    0xFD, 0x19, 0xFD, 0xA0, 0xFE, 0x00, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x1F,
+    0xF9, 0x1F, 0xFA, 0x0A, 0xFD, 0x92, 0xAF, 0xDA, 0x3F, 0x6A, 0xE9, 0x29, 0x9F, 0xA9, 0x99, 0x99,
+    0x9F, 0xA9, 0x99, 0xFF, 0xFF, 0xF2, 0xF9, 0x5A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0xFF, 0xE9, 0x4F,
+    0xFF, 0xE9, 0x4F, 0xAA, 0xAA, 0xAA, 0xAF, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE,
+    0x94, 0xF6, 0xAE, 0x94, 0xF9, 0x5F, 0xA2, 0xAF, 0xE9, 0x1A, 0xFE, 0xA0, 0xFF, 0x91, 0xFF, 0xA0,
+    0x49, 0x72, 0x9A, 0xF9, 0x71, 0xFD, 0x97, 0x3A, 0xE9, 0x71, 0x9A, 0xFA, 0xAA, 0x7A, 0xFF, 0x97,
+    0x0A, 0xE7, 0x4A, 0xE1, 0x9A, 0xCA, 0x95, 0xAE, 0xAF, 0xD9, 0x4A, 0xFF, 0xE4, 0xAF, 0x90, 0x9F,
+    0x93, 0xAE, 0x92, 0xAE, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E,
+    0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x92, 0xFD, 0x90, 0x9F,
+    0xD0, 0x9F, 0xDA, 0x0F, 0xE0, 0x19, 0xA9, 0x29, 0x1A, 0xEA, 0x0A, 0xC1, 0xFF, 0x90, 0xD0, 0x9F,
+    0x29, 0x29, 0x97, 0x49, 0x99, 0x99, 0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x1A, 0xA2,
+    0x91, 0xF0, 0x9C, 0xAA, 0xFE, 0xA9, 0xC9, 0x0A, 0xE6, 0x97, 0x74, 0xAF, 0xA1, 0x9F, 0xCA, 0x3A,
+    0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39,
+    0xEA, 0x2A, 0xFD, 0x90, 0xFE, 0x90, 0x19, 0x99, 0x99, 0x99, 0x1F, 0xF9, 0x0F, 0xF7, 0x75, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xF9, 0x0A, 0xFD, 0xA3, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF9, 0x2A, 0xFE, 0x90, 0xFF, 0x90, 0x9F, 0xEA, 0xAF, 0xEA, 0x09, 0x99,
+    0x99, 0x99, 0x77, 0x3A, 0xFA, 0x19, 0xFC, 0xA3, 0xAE, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3,
+    0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA2, 0xAF, 0xD9, 0x0F, 0xE9, 0x1A, 0x49,
+    0x1D, 0xA2, 0x9C, 0x90, 0xFF, 0x2F, 0xD9, 0x39, 0xAA, 0x97, 0x59, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x70, 0x9C, 0xA3, 0xAA, 0xAE, 0x99, 0xD9, 0x0F, 0xDA, 0x29, 0xAC,
+    0xA9, 0x77, 0x4A, 0xFA, 0x19, 0xFC, 0xA3, 0xAE, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E,
+    0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA2, 0xAF, 0xD9, 0x0F, 0xE9, 0x09, 0x99, 0x99,
+    0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x2A, 0xCA, 0x5E, 0x6E, 0x6F, 0xA9, 0x3A, 0xF9,
+    0x59, 0x93, 0x39, 0x69, 0xE9, 0x4A, 0xF4, 0xAE, 0xA5, 0x9A, 0x97, 0x77, 0x0A, 0xFA, 0x29, 0xFC,
+    0xA4, 0xAE, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E, 0xA4, 0x9E,
+    0xA4, 0x9E, 0xA3, 0xAF, 0xD9, 0x1F, 0xE9, 0x5D, 0xA5, 0xDA, 0x59, 0xD9, 0x59, 0xEA, 0xA4, 0xAF,
+    0x69, 0x91, 0x39, 0xA9, 0x5A, 0xE5, 0xF9, 0x4A, 0xE6, 0x99, 0x76, 0x99, 0x99, 0x99, 0x99, 0x1F,
+    0xF9, 0x0A, 0xFD, 0xA3, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5,
+    0xF9, 0x2A, 0xFE, 0x90, 0xFF, 0x90, 0x71, 0xAF, 0xA1, 0x9F, 0xCA, 0x3A, 0xEA, 0x39, 0xEA, 0x39,
+    0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x2A, 0xFD, 0x90,
+    0xFE, 0x90, 0x09, 0x99, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0x90, 0xFF, 0xC0,
+    0xAF, 0xDA, 0x1A, 0xFD, 0xA9, 0x2F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A,
+    0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA,
+    0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xEA, 0x4F, 0x5A, 0xE9, 0x4F, 0x94, 0xAE, 0x92, 0xAF, 0xE9, 0x2A,
+    0xE9, 0x2F, 0xF9, 0x2A, 0xE7, 0x7F, 0x76, 0xAE, 0xA7, 0x5F, 0xC7, 0x49, 0xFC, 0x76, 0xEA, 0x77,
+    0x71, 0x39, 0x79, 0x39, 0xE9, 0x3A, 0xE2, 0xAF, 0x3F, 0x91, 0xAE, 0xA3, 0xF3, 0x9A, 0x95, 0xAA,
+    0x97, 0x77, 0x69, 0x1A, 0xFA, 0x19, 0xFC, 0x09, 0xFC, 0xA1, 0xFD, 0x2A, 0xEA, 0x29, 0xF2, 0x9E,
+    0xA3, 0xF2, 0x9E, 0xA3, 0xF2, 0x9E, 0xA3, 0xF2, 0x9E, 0xA3, 0xF2, 0x9E, 0xA3, 0xF2, 0x9E, 0xA3,
+    0xF2, 0x9E, 0xA3, 0xF2, 0x9E, 0xA3, 0xF1, 0xAF, 0xD9, 0x1F, 0x1F, 0xE9, 0x1F, 0x73, 0xF7, 0x3E,
+    0xA7, 0x2F, 0x71, 0x9F, 0xA7, 0x09, 0xFA, 0x72, 0xAC, 0xA9, 0x30, 0x77, 0x09, 0xE7, 0xFC, 0x5E,
+    0x9E, 0x3E, 0x19, 0xDA, 0x2A, 0xA3, 0x9A, 0x77, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFF, 0x92, 0xFE,
+    0xA5, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xEA,
+    0x6A, 0xEA, 0x6F, 0x59, 0xFA, 0x4F, 0xCA, 0x59, 0xE9, 0x77, 0x10, 0x77, 0xE6, 0xFC, 0x49, 0xD9,
+    0xDA, 0x3D, 0x90, 0x9D, 0x29, 0xCA, 0x2A, 0xC7, 0x72, 0x94, 0x9F, 0xC4, 0xFD, 0x59, 0xF6, 0xAE,
+    0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xF6, 0xEA,
+    0x5F, 0x93, 0x9F, 0xA3, 0x9F, 0xC5, 0xAC, 0xA9, 0x50, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99,
+    0x99, 0x1F, 0xF1, 0xFE, 0x90, 0xAF, 0xD9, 0x2F, 0xC9, 0x3F, 0x39, 0xEA, 0x5F, 0x29, 0xEA, 0x6F,
+    0x19, 0xEA, 0x7F, 0x1E, 0x97, 0x0F, 0x9E, 0x97, 0x1F, 0xEA, 0x72, 0xFF, 0x97, 0x1F, 0x9F, 0x71,
+    0xF0, 0xAF, 0x70, 0xF1, 0xFC, 0x7F, 0x2F, 0xC6, 0xF2, 0x9F, 0xC5, 0xF9, 0x29, 0xFC, 0x91, 0xAF,
+    0xE2, 0x9F, 0xCA, 0x0F, 0xF3, 0x9F, 0x97, 0x69, 0x97, 0x2A, 0xA9, 0x76, 0x9E, 0x77, 0xE9, 0x76,
+    0xE7, 0x6A, 0xD7, 0x79, 0x97, 0x00, 0x49, 0x71, 0x9A, 0xF7, 0x1F, 0xD7, 0x29, 0xF7, 0x3A, 0xE7,
+    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE1, 0xFD, 0xA2, 0xAE, 0x19, 0xFC, 0x92, 0xAE, 0x2E, 0xA4, 0xAE,
+    0x1E, 0xA5, 0xAE, 0x0A, 0xDA, 0x6A, 0xFE, 0x7A, 0xEA, 0xEA, 0x6A, 0xE0, 0xAE, 0x95, 0xAE, 0x1F,
+    0x5A, 0xE1, 0x9F, 0x4A, 0xE2, 0xAF, 0x2A, 0xFC, 0x91, 0xFC, 0x09, 0xFD, 0xA2, 0xF9, 0x73, 0x99,
+    0x70, 0x9A, 0x97, 0x4E, 0x97, 0x3A, 0xDA, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x49, 0x70, 0x77, 0x1A,
+    0xFA, 0x0A, 0xFD, 0x19, 0xFC, 0xA0, 0x9F, 0xCA, 0x3A, 0xEA, 0x1A, 0xE5, 0x9E, 0xA0, 0x9E, 0x69,
+    0xEA, 0x9E, 0x79, 0xFE, 0x97, 0x9F, 0xF7, 0x9E, 0x99, 0xEA, 0x69, 0xE9, 0x0F, 0x95, 0x9E, 0x91,
+    0xF5, 0x9E, 0x91, 0xAF, 0x3A, 0xFC, 0xA1, 0xFC, 0x91, 0xFE, 0x2A, 0xEA, 0x75, 0x92, 0x77, 0x59,
+    0xC9, 0x73, 0xAE, 0x72, 0xFC, 0x71, 0xFA, 0x72, 0xA9, 0x77, 0x73, 0x99, 0x99, 0x99, 0x99, 0x7F,
+    0xF9, 0x6A, 0xFD, 0xA7, 0x1F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF5, 0xD3, 0xF4, 0x9D, 0x92, 0xF4, 0xAD, 0x92, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF,
+    0xC1, 0xFF, 0xFC, 0xA0, 0x59, 0x59, 0xDA, 0x3A, 0xEA, 0x19, 0xFC, 0x2A, 0xCA, 0x97, 0x71, 0x92,
+    0x9A, 0xF9, 0x1F, 0xD9, 0x29, 0xF9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9,
+    0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9, 0x3A, 0xE9,
+    0x3A, 0xE9, 0x19, 0xFE, 0x0A, 0xFE, 0x00, 0x09, 0x99, 0x99, 0x99, 0x97, 0xFF, 0x96, 0xAF, 0xDA,
+    0x71, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x5D,
+    0x3F, 0x49, 0xD9, 0x2F, 0x4A, 0xD9, 0x2F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA,
+    0x77, 0x69, 0xAA, 0x74, 0xEA, 0x73, 0xAD, 0xA7, 0x3A, 0xD9, 0x72, 0x9D, 0xA7, 0x49, 0x97, 0x49,
+    0x29, 0xAF, 0x91, 0xFD, 0x92, 0x9F, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE,
+    0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE, 0x93, 0xAE,
+    0x93, 0xAE, 0x91, 0x9F, 0xE0, 0xAF, 0xE7, 0x4A, 0xA9, 0x49, 0xE5, 0xE9, 0x4E, 0x49, 0xD9, 0x49,
+    0x94, 0x77, 0x72, 0xAC, 0xA2, 0x99, 0x99, 0x99, 0x99, 0x1E, 0x2F, 0xF9, 0x0D, 0xA2, 0xAF, 0xDA,
+    0x1D, 0x5F, 0x3C, 0xA5, 0xF3, 0x96, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x5D, 0x3F, 0x49, 0xD9, 0x2F, 0x4A, 0xD9, 0x2F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xCA, 0x00, 0x49, 0x29, 0x09, 0xAF, 0x90, 0xAF, 0xF9, 0x0A, 0xD0, 0x9F, 0x90, 0xDA, 0x1A,
+    0xE9, 0x0D, 0x2A, 0xE9, 0x0D, 0x2A, 0xE9, 0x09, 0x3A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9,
+    0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0x39, 0xFE,
+    0x2A, 0xFE, 0x20, 0x09, 0x99, 0x99, 0x99, 0x97, 0xFF, 0x96, 0xAF, 0xDA, 0x71, 0xF7, 0x3F, 0x73,
+    0xF7, 0x3F, 0x39, 0xD9, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3A, 0xD9, 0x3F, 0x73, 0xF7, 0x3F, 0x5D,
+    0x3F, 0x49, 0xD9, 0x2F, 0x4A, 0xD9, 0x2F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA,
+    0x00, 0x49, 0x79, 0xAF, 0x96, 0xFD, 0x97, 0x9F, 0x97, 0x0A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9,
+    0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x70, 0xAE, 0x91, 0xAD, 0xA2, 0xAE, 0x91, 0xF2, 0xAE, 0x91, 0xF2,
+    0xAE, 0x92, 0xAA, 0x3A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x69,
+    0xFE, 0x5A, 0xFE, 0x50, 0x19, 0x99, 0x99, 0x99, 0x97, 0x0F, 0xF9, 0x7A, 0xFD, 0xA7, 0x2F, 0x74,
+    0xF7, 0x4F, 0x74, 0xF1, 0xAC, 0x70, 0xFF, 0x70, 0xFD, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0xD7, 0x1D,
+    0x9F, 0x74, 0xF5, 0xD4, 0xF4, 0x9D, 0x93, 0xF4, 0xAD, 0x93, 0xFA, 0xAA, 0xAA, 0xE2, 0xAF, 0xFF,
+    0xC2, 0xFF, 0xFC, 0xA0, 0x59, 0x39, 0xAF, 0x92, 0xFD, 0x93, 0x9F, 0x94, 0xAE, 0x94, 0xAE, 0x94,
+    0xAE, 0x94, 0xAE, 0x9C, 0x3A, 0xFC, 0x92, 0xAF, 0x93, 0xAE, 0x93, 0xAF, 0x92, 0xFD, 0x92, 0x99,
+    0xAE, 0x94, 0xAE, 0x94, 0xAE, 0x94, 0xAE, 0x94, 0xAE, 0x92, 0x9F, 0xE1, 0xAF, 0xE0, 0x77, 0x77,
+    0xAC, 0x77, 0x1E, 0xA7, 0x69, 0xF9, 0x75, 0x9F, 0x97, 0x7A, 0x97, 0x77, 0x70, 0x99, 0x99, 0x99,
+    0x59, 0x99, 0x99, 0x99, 0x09, 0xFD, 0x93, 0xAF, 0xE1, 0xAF, 0xD3, 0x9F, 0xD9, 0x3F, 0xCA, 0x49,
+    0xE5, 0xFD, 0x93, 0x9E, 0x5F, 0xE3, 0x9E, 0x5F, 0xEA, 0x29, 0xE5, 0xE9, 0xF9, 0x19, 0xE5, 0xE0,
+    0xAF, 0x19, 0xE5, 0xE1, 0xFC, 0x09, 0xE5, 0xE2, 0xFA, 0x9E, 0x5E, 0x2A, 0xF9, 0xE5, 0xE3, 0xFF,
+    0x5E, 0x4F, 0xE5, 0xE4, 0x9F, 0xD4, 0x9E, 0x5F, 0xD3, 0xFE, 0x4F, 0xC2, 0x9F, 0xE4, 0x9F, 0x77,
+    0x09, 0x94, 0x70, 0xAA, 0x76, 0xDA, 0x74, 0xAD, 0x97, 0x39, 0xE7, 0x4A, 0xD7, 0x6A, 0x77, 0x74,
+    0x99, 0x29, 0x99, 0x5A, 0xF0, 0xAF, 0xC9, 0x29, 0xFF, 0xFC, 0x39, 0xAF, 0xCA, 0xAF, 0xA3, 0x9E,
+    0xA2, 0x9E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E,
+    0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x2A, 0xFC, 0xA1, 0xFD, 0x90,
+    0xFE, 0x09, 0xFD, 0x90, 0x09, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x3A, 0xFE,
+    0x1A, 0xFD, 0x39, 0xFD, 0x93, 0xFC, 0xA4, 0x9E, 0x5F, 0xD9, 0x39, 0xE5, 0xFE, 0x39, 0xE5, 0xFE,
+    0xA2, 0x9E, 0x5E, 0x9F, 0x91, 0x9E, 0x5E, 0x0A, 0xF1, 0x9E, 0x5E, 0x1F, 0xC0, 0x9E, 0x5E, 0x2F,
+    0xA9, 0xE5, 0xE2, 0xAF, 0x9E, 0x5E, 0x3F, 0xF5, 0xE4, 0xFE, 0x5E, 0x49, 0xFD, 0x49, 0xE5, 0xFD,
+    0x3F, 0xE4, 0xFC, 0x29, 0xFE, 0x49, 0xF7, 0x70, 0x99, 0x75, 0xAA, 0x97, 0x70, 0x9E, 0x97, 0x70,
+    0xE9, 0x77, 0x0E, 0x77, 0x0A, 0xD9, 0x77, 0x09, 0x97, 0x20, 0x39, 0x92, 0x99, 0x95, 0xAF, 0x0A,
+    0xFC, 0x92, 0x9F, 0xFF, 0xC3, 0x9A, 0xFC, 0xAA, 0xFA, 0x39, 0xEA, 0x29, 0xEA, 0x39, 0xEA, 0x3E,
+    0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E,
+    0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA2, 0xAF, 0xCA, 0x1F, 0xD9, 0x0F, 0xE0, 0x9F, 0xD9, 0x77, 0x79,
+    0xAA, 0x75, 0xE9, 0x74, 0x9D, 0xA7, 0x49, 0xD9, 0x74, 0xDA, 0x75, 0x99, 0x70, 0x77, 0x71, 0x9C,
+    0x93, 0xD7, 0x3A, 0xD9, 0x1D, 0xA7, 0x4E, 0xAD, 0xA7, 0x6F, 0xC7, 0x70, 0xAD, 0x77, 0x77, 0x99,
+    0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0x09, 0xFD, 0x93, 0xAF, 0xE1, 0xAF, 0xD3, 0x9F, 0xD9, 0x3F,
+    0xCA, 0x49, 0xE5, 0xFD, 0x93, 0x9E, 0x5F, 0xE3, 0x9E, 0x5F, 0xEA, 0x29, 0xE5, 0xE9, 0xF9, 0x19,
+    0xE5, 0xE0, 0xAF, 0x19, 0xE5, 0xE1, 0xFC, 0x09, 0xE5, 0xE2, 0xFA, 0x9E, 0x5E, 0x2A, 0xF9, 0xE5,
+    0xE3, 0xFF, 0x5E, 0x4F, 0xE5, 0xE4, 0x9F, 0xD4, 0x9E, 0x5F, 0xD3, 0xFE, 0x4F, 0xC2, 0x9F, 0xE4,
+    0x9F, 0x77, 0x09, 0x94, 0x49, 0x49, 0x70, 0x9D, 0x2D, 0xA7, 0x0D, 0xA0, 0xAD, 0x71, 0x9F, 0xC7,
+    0x3A, 0xE9, 0x74, 0xAA, 0xA7, 0x77, 0x39, 0x92, 0x99, 0x95, 0xAF, 0x0A, 0xFC, 0x92, 0x9F, 0xFF,
+    0xC3, 0x9A, 0xFC, 0xAA, 0xFA, 0x39, 0xEA, 0x29, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA,
+    0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA, 0x3E, 0xA3, 0x9E, 0xA3, 0xEA, 0x39, 0xEA,
+    0x3E, 0xA2, 0xAF, 0xCA, 0x1F, 0xD9, 0x0F, 0xE0, 0x9F, 0xD9, 0x1D, 0x97, 0x72, 0xAE, 0x77, 0x3E,
+    0x77, 0x3E, 0x77, 0x3E, 0x49, 0x92, 0x99, 0x95, 0x9D, 0x91, 0xAF, 0x0A, 0xFC, 0x4D, 0xA1, 0xAF,
+    0xFF, 0xC3, 0xAA, 0x39, 0xAF, 0xCA, 0xAF, 0x97, 0x1A, 0xEA, 0x2A, 0xE9, 0x71, 0xAE, 0x92, 0x9E,
+    0xA7, 0x1A, 0xE9, 0x29, 0xEA, 0x71, 0xAE, 0x92, 0x9E, 0xA7, 0x1A, 0xE9, 0x29, 0xEA, 0x71, 0xAE,
+    0x92, 0x9E, 0xA7, 0x1A, 0xE9, 0x29, 0xEA, 0x71, 0xAE, 0x92, 0x9E, 0xA7, 0x0A, 0xFC, 0xA0, 0x9F,
+    0xD7, 0xFD, 0xA0, 0xAF, 0xD0, 0x09, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xD4, 0xAF,
+    0xE1, 0xAF, 0xD3, 0x9F, 0xD9, 0x3F, 0xCA, 0x49, 0xE5, 0xFD, 0x49, 0xE5, 0xFE, 0x39, 0xE5, 0xFE,
+    0xA2, 0x9E, 0x5E, 0x9F, 0x29, 0xE5, 0xE0, 0xAF, 0x19, 0xE5, 0xE1, 0xF9, 0x09, 0xE5, 0xE2, 0xF0,
+    0x9E, 0x5E, 0x2A, 0xF9, 0xE5, 0xE3, 0xFA, 0xE5, 0xE4, 0xFE, 0x5E, 0x49, 0xFD, 0x49, 0xE5, 0xAF,
+    0xC3, 0xFE, 0x4F, 0xA2, 0x9F, 0xE4, 0x9E, 0xA7, 0x70, 0xE9, 0x74, 0xCA, 0x1E, 0x74, 0xAF, 0xDA,
+    0x74, 0xAF, 0xD7, 0x6A, 0xEA, 0x50, 0x39, 0x92, 0x99, 0x93, 0xAF, 0x0A, 0xFC, 0x90, 0x9F, 0xFF,
+    0xC1, 0x9A, 0xFC, 0xAA, 0xFA, 0x19, 0xEA, 0x29, 0xEA, 0x19, 0xEA, 0x3E, 0xA1, 0x9E, 0xA3, 0xEA,
+    0x19, 0xEA, 0x3E, 0xA1, 0x9E, 0xA3, 0xEA, 0x19, 0xEA, 0x3E, 0xA1, 0x9E, 0xA3, 0xEA, 0x19, 0xEA,
+    0x3E, 0xA0, 0xAF, 0xCA, 0x2E, 0xA0, 0xFE, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x71, 0x9F, 0x70,
+    0xAF, 0x70, 0xFC, 0x97, 0x1D, 0xA3, 0x49, 0x99, 0x99, 0x99, 0x72, 0xFF, 0x70, 0x9F, 0xEA, 0x77,
+    0x77, 0x76, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE,
+    0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9,
+    0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA,
+    0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x29, 0xFE, 0xA5, 0xAF, 0xEA,
+    0x69, 0x99, 0x99, 0x99, 0x77, 0x70, 0x99, 0x99, 0x70, 0xAF, 0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F,
+    0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2,
+    0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF, 0xDA, 0x71, 0x99, 0x95, 0x49, 0x59, 0x70,
+    0x9D, 0x3D, 0x70, 0x9F, 0xEA, 0x71, 0xAF, 0xCA, 0x74, 0x9A, 0xA9, 0x77, 0x76, 0x9A, 0xDA, 0xA9,
+    0x70, 0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0,
+    0x9E, 0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0,
+    0xAF, 0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7,
+    0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x77, 0x19, 0xCA, 0x3A, 0xA5, 0xAE, 0x99, 0xD9, 0x6F, 0xDA,
+    0x70, 0x9A, 0xCA, 0x97, 0x77, 0x19, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09, 0xF9,
+    0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA, 0x29,
+    0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x79, 0x93, 0xA7,
+    0x19, 0xD2, 0xDA, 0x79, 0xE1, 0xAE, 0x7E, 0xA0, 0xAE, 0x7E, 0x19, 0xDA, 0x70, 0xA9, 0x3C, 0x77,
+    0x75, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95,
+    0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9,
+    0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99,
+    0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x5A, 0x91, 0xAA, 0x70, 0xD9, 0x0D,
+    0xA6, 0xAD, 0x09, 0xD9, 0x6D, 0xA0, 0xE6, 0x9D, 0x1D, 0x70, 0xC2, 0xC9, 0x77, 0x70, 0x99, 0x99,
+    0x70, 0xAF, 0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F, 0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F,
+    0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2, 0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5,
+    0xAF, 0xDA, 0x71, 0x99, 0x95, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0xAF, 0xFF, 0xFA,
+    0x3A, 0xFF, 0xFF, 0xDA, 0x2A, 0xF9, 0x2A, 0xE9, 0x19, 0x9D, 0xA1, 0xAE, 0xA4, 0xAE, 0x93, 0xD9,
+    0x1F, 0x5A, 0xE9, 0x39, 0xA1, 0x9E, 0xA5, 0xAE, 0x97, 0xAE, 0x95, 0xAE, 0x97, 0xF6, 0xAF, 0xFC,
+    0x2F, 0x6A, 0xFF, 0xC2, 0xF6, 0xAE, 0xAA, 0xAA, 0xA9, 0x2F, 0x95, 0xAE, 0x97, 0xAE, 0xA5, 0xAE,
+    0x94, 0x91, 0x9F, 0x5A, 0xE9, 0x4D, 0x1F, 0xC4, 0xAE, 0x93, 0xAD, 0x2F, 0xCA, 0x99, 0x9F, 0xAA,
+    0xAA, 0xAE, 0x3F, 0xFF, 0xFF, 0x49, 0xAF, 0xFF, 0xFA, 0x71, 0x99, 0x74, 0x59, 0x99, 0x59, 0x99,
+    0x7A, 0xFD, 0x1A, 0xFD, 0x4F, 0xFF, 0xFD, 0x2F, 0x90, 0x9F, 0xCA, 0x1A, 0xE9, 0x09, 0xE9, 0x29,
+    0xF3, 0xF0, 0xF4, 0xF3, 0xF0, 0xF4, 0xFF, 0xF0, 0xF4, 0xFF, 0xEA, 0x0F, 0x4F, 0x70, 0xF4, 0xF7,
+    0x0F, 0xA2, 0x9F, 0x97, 0x9F, 0xA0, 0x9F, 0xEA, 0x99, 0xAC, 0xA1, 0xAF, 0xFA, 0xFF, 0xC9, 0x2A,
+    0xFD, 0x91, 0xAF, 0xDA, 0x69, 0x96, 0x99, 0x93, 0x77, 0x73, 0x9C, 0x77, 0xEA, 0x74, 0x9F, 0x97,
+    0x39, 0xF9, 0x75, 0xA9, 0x77, 0x77, 0x99, 0x9A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0x95, 0xAF, 0xFF,
+    0x96, 0xF2, 0xAF, 0x6F, 0x3F, 0x6F, 0x3F, 0x6F, 0x3F, 0x6F, 0x29, 0xEA, 0x6F, 0x09, 0xAF, 0x7F,
+    0xFC, 0xA7, 0x0F, 0xFA, 0x71, 0xF0, 0xF7, 0x1F, 0x1F, 0x70, 0xF1, 0xAF, 0x7F, 0x2F, 0xC6, 0xF3,
+    0xFC, 0x3A, 0xFE, 0x2F, 0xCA, 0x1F, 0xF3, 0xFA, 0x76, 0x99, 0x91, 0x69, 0xA7, 0x1D, 0xA7, 0xAD,
+    0xA7, 0xE7, 0xAD, 0x71, 0xA7, 0x74, 0x99, 0x29, 0x91, 0xAF, 0x09, 0xE9, 0xAF, 0xC9, 0xF9, 0x09,
+    0xAF, 0xF2, 0x9F, 0x91, 0x92, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E,
+    0xA6, 0x9E, 0xA5, 0xAF, 0xDA, 0x29, 0xFF, 0x20, 0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xF9,
+    0x5A, 0xFF, 0xF9, 0x6F, 0x2A, 0xF6, 0xF3, 0xF6, 0xF3, 0xF6, 0xF3, 0xF6, 0xF2, 0x9E, 0xA6, 0xF0,
+    0x9A, 0xF7, 0xFF, 0xCA, 0x70, 0xFF, 0xA7, 0x1F, 0x0F, 0x71, 0xF1, 0xF7, 0x0F, 0x1A, 0xF7, 0xF2,
+    0xFC, 0x6F, 0x3F, 0xC3, 0xAF, 0xE2, 0xFC, 0xA1, 0xFF, 0x3F, 0xA7, 0x69, 0x99, 0x71, 0x9A, 0xA7,
+    0x7E, 0xA7, 0x6A, 0xDA, 0x76, 0xAD, 0x97, 0x59, 0xDA, 0x77, 0x99, 0x70, 0x39, 0x92, 0x99, 0x1A,
+    0xF0, 0x9E, 0x9A, 0xFC, 0x9F, 0x90, 0x9A, 0xFF, 0x29, 0xF9, 0x19, 0x29, 0xEA, 0x69, 0xEA, 0x69,
+    0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x5A, 0xFD, 0xA2, 0x9F, 0xF7, 0x71, 0x9A,
+    0xA7, 0x0E, 0x97, 0xAD, 0xA7, 0xAD, 0x97, 0xDA, 0x70, 0x97, 0x77, 0x59, 0xC9, 0x3D, 0x71, 0xAD,
+    0x91, 0xDA, 0x72, 0xEA, 0xDA, 0x74, 0xFC, 0x76, 0xAD, 0x77, 0x76, 0x99, 0x9A, 0xAA, 0xAA, 0xA9,
+    0x7F, 0xFF, 0x95, 0xAF, 0xFF, 0x96, 0xF2, 0xAF, 0x6F, 0x3F, 0x6F, 0x3F, 0x6F, 0x3F, 0x6F, 0x29,
+    0xEA, 0x6F, 0x09, 0xAF, 0x7F, 0xFC, 0xA7, 0x0F, 0xFA, 0x71, 0xF0, 0xF7, 0x1F, 0x1F, 0x70, 0xF1,
+    0xAF, 0x7F, 0x2F, 0xC6, 0xF3, 0xFC, 0x3A, 0xFE, 0x2F, 0xCA, 0x1F, 0xF3, 0xFA, 0x76, 0x99, 0x91,
+    0x29, 0x49, 0x39, 0xD2, 0xDA, 0x3D, 0xA0, 0xAD, 0x49, 0xFC, 0x6A, 0xE9, 0x79, 0xAA, 0x77, 0x39,
+    0x92, 0x99, 0x1A, 0xF0, 0x9E, 0x9A, 0xFC, 0x9F, 0x90, 0x9A, 0xFF, 0x29, 0xF9, 0x19, 0x29, 0xEA,
+    0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x5A, 0xFD, 0xA2, 0x9F,
+    0xF2, 0x77, 0x4A, 0xC7, 0x09, 0xE9, 0x6A, 0xF6, 0xAE, 0xA7, 0x9A, 0x97, 0x76, 0x9A, 0xDA, 0xA9,
+    0x39, 0xFF, 0xC1, 0x9F, 0xFD, 0x1F, 0x3E, 0x09, 0xE9, 0x3E, 0x09, 0xEA, 0x3A, 0xC9, 0x09, 0xF9,
+    0x7F, 0xD9, 0x59, 0xFE, 0x94, 0x9F, 0xF5, 0xAF, 0xE6, 0xAF, 0xC1, 0xAA, 0x4F, 0x9A, 0xD4, 0x9E,
+    0x9A, 0xD9, 0x3A, 0xE0, 0xAE, 0xA1, 0x9E, 0xA0, 0xAF, 0xFD, 0x19, 0xFF, 0xA5, 0x99, 0x99, 0x94,
+    0x5A, 0x97, 0x9D, 0x96, 0xE6, 0xAD, 0xA6, 0xDA, 0x79, 0xA7, 0x73, 0x99, 0x99, 0x49, 0xFD, 0xA1,
+    0xAE, 0xAF, 0x1E, 0x29, 0xD9, 0x9E, 0x3D, 0x09, 0xFA, 0x5F, 0xE9, 0x3F, 0xEA, 0x3A, 0xFD, 0x90,
+    0x92, 0x9F, 0xAA, 0xCA, 0x3E, 0xAE, 0x92, 0xE9, 0xAF, 0xFA, 0x09, 0xFE, 0xA5, 0x99, 0x40, 0x77,
+    0x1E, 0x97, 0xAF, 0x95, 0xAD, 0x9E, 0x93, 0xAD, 0x91, 0xAD, 0x39, 0xC9, 0x3A, 0x97, 0x72, 0x9A,
+    0xDA, 0xA9, 0x39, 0xFF, 0xC1, 0x9F, 0xFD, 0x1F, 0x3E, 0x09, 0xE9, 0x3E, 0x09, 0xEA, 0x3A, 0xC9,
+    0x09, 0xF9, 0x7F, 0xD9, 0x59, 0xFE, 0x94, 0x9F, 0xF5, 0xAF, 0xE6, 0xAF, 0xC1, 0xAA, 0x4F, 0x9A,
+    0xD4, 0x9E, 0x9A, 0xD9, 0x3A, 0xE0, 0xAE, 0xA1, 0x9E, 0xA0, 0xAF, 0xFD, 0x19, 0xFF, 0xA5, 0x99,
+    0x99, 0x94, 0x76, 0xE9, 0x5A, 0xF4, 0x9D, 0x9E, 0x3D, 0xA1, 0xD9, 0x19, 0xCA, 0x29, 0xC9, 0x77,
+    0x99, 0x99, 0x49, 0xFD, 0xA1, 0xAE, 0xAF, 0x1E, 0x29, 0xD9, 0x9E, 0x3D, 0x09, 0xFA, 0x5F, 0xE9,
+    0x3F, 0xEA, 0x3A, 0xFD, 0x90, 0x92, 0x9F, 0xAA, 0xCA, 0x3E, 0xAE, 0x92, 0xE9, 0xAF, 0xFA, 0x09,
+    0xFE, 0xA5, 0x99, 0x40, 0x39, 0xAD, 0xAA, 0x93, 0x9F, 0xFC, 0x19, 0xFF, 0xD1, 0xF3, 0xE0, 0x9E,
+    0x93, 0xE0, 0x9E, 0xA3, 0xAC, 0x90, 0x9F, 0x97, 0xFD, 0x95, 0x9F, 0xE9, 0x49, 0xFF, 0x5A, 0xFE,
+    0x6A, 0xFC, 0x1A, 0xA4, 0xF9, 0xAD, 0x49, 0xE9, 0xAD, 0x93, 0xAE, 0x0A, 0xEA, 0x19, 0xEA, 0x0A,
+    0xFF, 0xD1, 0x9F, 0xFA, 0x59, 0x99, 0x99, 0x71, 0xAC, 0xA7, 0x0A, 0xEA, 0x71, 0xE7, 0x1D, 0xA7,
+    0x9D, 0xA7, 0x09, 0xA9, 0x50, 0x39, 0x99, 0x94, 0x9F, 0xDA, 0x1A, 0xEA, 0xF1, 0xE2, 0x9D, 0x99,
+    0xE3, 0xD0, 0x9F, 0xA5, 0xFE, 0x93, 0xFE, 0xA3, 0xAF, 0xD9, 0x09, 0x29, 0xFA, 0xAC, 0xA3, 0xEA,
+    0xE9, 0x2E, 0x9A, 0xFF, 0xA0, 0x9F, 0xEA, 0x59, 0x97, 0x9A, 0xCA, 0x6A, 0xEA, 0x7D, 0xA7, 0xD9,
+    0x59, 0xDA, 0x69, 0xA9, 0x40, 0x76, 0xAC, 0x39, 0xD3, 0xE1, 0x9D, 0x93, 0x9E, 0xAD, 0x95, 0x9F,
+    0xA7, 0x0D, 0xA7, 0x75, 0x9A, 0xDA, 0xA9, 0x39, 0xFF, 0xC1, 0x9F, 0xFD, 0x1F, 0x3E, 0x09, 0xE9,
+    0x3E, 0x09, 0xEA, 0x3A, 0xC9, 0x09, 0xF9, 0x7F, 0xD9, 0x59, 0xFE, 0x94, 0x9F, 0xF5, 0xAF, 0xE6,
+    0xAF, 0xC1, 0xAA, 0x4F, 0x9A, 0xD4, 0x9E, 0x9A, 0xD9, 0x3A, 0xE0, 0xAE, 0xA1, 0x9E, 0xA0, 0xAF,
+    0xFD, 0x19, 0xFF, 0xA5, 0x99, 0x99, 0x94, 0x19, 0x39, 0x92, 0xAC, 0xA1, 0x9D, 0x91, 0x9D, 0x90,
+    0xDA, 0x3A, 0xFC, 0x5F, 0x7A, 0xA9, 0x77, 0x29, 0x99, 0x94, 0x9F, 0xDA, 0x1A, 0xEA, 0xF1, 0xE2,
+    0x9D, 0x99, 0xE3, 0xD0, 0x9F, 0xA5, 0xFE, 0x93, 0xFE, 0xA3, 0xAF, 0xD9, 0x09, 0x29, 0xFA, 0xAC,
+    0xA3, 0xEA, 0xE9, 0x2E, 0x9A, 0xFF, 0xA0, 0x9F, 0xEA, 0x59, 0x94, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1, 0xE9, 0x09, 0xF1, 0x9E, 0x1D, 0xA2, 0xF2,
+    0xE1, 0xD9, 0x2F, 0x2D, 0xA2, 0x93, 0xF2, 0x99, 0x70, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7,
+    0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x97, 0x19, 0xFF, 0x97, 0xAF, 0xF9, 0x77, 0x74, 0xAC, 0xA9,
+    0x75, 0xF7, 0x6A, 0xD9, 0x75, 0xE7, 0x5E, 0x76, 0xA9, 0x70, 0x49, 0x97, 0x0E, 0x7A, 0xE7, 0xAE,
+    0x59, 0xFF, 0xC1, 0xFF, 0xCA, 0x19, 0x9F, 0x99, 0x94, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xFC, 0xAA, 0xC3, 0xAF, 0xE4, 0xFD, 0x96, 0x99, 0x70, 0x9D, 0x97, 0xF9, 0x70, 0xDA, 0x79, 0xD7,
+    0xAD, 0x97, 0x9A, 0x40, 0x77, 0x59, 0xC9, 0x3D, 0x97, 0x9D, 0x91, 0xE7, 0x1E, 0xAE, 0x73, 0xFC,
+    0x75, 0xAD, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xF1, 0xFF,
+    0xFF, 0x1E, 0x90, 0x9F, 0x19, 0xE1, 0xDA, 0x2F, 0x2E, 0x1D, 0x92, 0xF2, 0xDA, 0x29, 0x3F, 0x29,
+    0x97, 0x0F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49, 0xF9, 0x71,
+    0x9F, 0xF9, 0x7A, 0xFF, 0x93, 0x79, 0xCA, 0x70, 0x9D, 0x70, 0xAD, 0x59, 0x90, 0xAC, 0xA4, 0xE0,
+    0xAC, 0x4A, 0xE0, 0x9A, 0x4A, 0xE5, 0x9F, 0xFC, 0x1F, 0xFC, 0xA1, 0x99, 0xF9, 0x99, 0x4F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xCA, 0xAC, 0x3A, 0xFE, 0x4F, 0xD9, 0x69, 0x93, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1, 0xE9, 0x09, 0xF1, 0x9E,
+    0x1D, 0xA2, 0xF2, 0xE1, 0xD9, 0x2F, 0x2D, 0xA2, 0x93, 0xF2, 0x99, 0x70, 0xF7, 0x2A, 0xAA, 0xFA,
+    0xA9, 0x7F, 0xFC, 0xA7, 0x09, 0x9F, 0x99, 0x73, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x97,
+    0x19, 0xFF, 0x97, 0xAF, 0xF9, 0x30, 0x49, 0x97, 0x0E, 0x7A, 0xE7, 0xAE, 0x59, 0xFF, 0xC1, 0xFF,
+    0xCA, 0x19, 0x9F, 0x99, 0x94, 0xF7, 0xF5, 0x99, 0xF9, 0x99, 0x2F, 0xFC, 0x39, 0xF9, 0x99, 0x4F,
+    0x7F, 0x7F, 0xCA, 0xAC, 0x3A, 0xFE, 0x4F, 0xD9, 0x69, 0x93, 0x69, 0xA9, 0x19, 0x74, 0xAE, 0xA0,
+    0xD7, 0x3F, 0xF7, 0x3D, 0x09, 0xEA, 0x77, 0x09, 0x97, 0x77, 0x39, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39,
+    0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E,
+    0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5,
+    0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9, 0x9A, 0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99,
+    0x97, 0x49, 0xA9, 0x19, 0x97, 0x0A, 0xEA, 0x0D, 0x70, 0xFF, 0x70, 0xD1, 0xEA, 0x75, 0x97, 0x77,
+    0x77, 0x1A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9,
+    0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x59, 0x99, 0x99, 0x99, 0x97, 0x3F, 0xF7, 0x3F,
+    0xF7, 0x77, 0x77, 0x69, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA,
+    0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39,
+    0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E,
+    0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5, 0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9, 0x9A,
+    0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99, 0x97, 0x3F, 0xF7, 0x0F, 0xF7, 0x09, 0x99,
+    0x99, 0x99, 0x97, 0x77, 0x77, 0xAF, 0x2A, 0xF2, 0xAF, 0xC1, 0xAF, 0xC3, 0x9F, 0x29, 0xF4, 0xF3,
+    0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF9, 0x2F, 0x4A, 0xFA, 0xAF,
+    0xC5, 0xFF, 0xFC, 0x92, 0x9F, 0xCA, 0x0F, 0xC5, 0x99, 0x92, 0x99, 0x30, 0x69, 0x49, 0x73, 0xD9,
+    0x2A, 0xC7, 0x3F, 0xF7, 0x39, 0xFD, 0x76, 0x9A, 0xA9, 0x77, 0x74, 0x99, 0x99, 0x99, 0x99, 0x29,
+    0x99, 0x99, 0x99, 0x0A, 0xFF, 0x19, 0xFE, 0xA9, 0xFE, 0x92, 0xAF, 0xCA, 0x29, 0xEA, 0x6E, 0x93,
+    0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6,
+    0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9F, 0x59, 0xE9, 0x4F,
+    0x5A, 0xE5, 0xF9, 0x4F, 0x5A, 0xFA, 0x99, 0xAF, 0x96, 0xFF, 0xEA, 0x70, 0xAF, 0xF9, 0x74, 0x99,
+    0x99, 0x70, 0x77, 0x4D, 0x4C, 0x70, 0xEA, 0x9A, 0xD7, 0x09, 0xFD, 0x97, 0x19, 0xAD, 0xA7, 0x77,
+    0x77, 0x1A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9,
+    0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x70, 0x9A, 0x97, 0x69, 0xFA, 0x75, 0xD1, 0xD7,
+    0x5D, 0x1A, 0xC9, 0x74, 0xD9, 0x0D, 0x75, 0x9F, 0x97, 0x79, 0x97, 0x19, 0x99, 0x99, 0x99, 0x92,
+    0x99, 0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9,
+    0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA,
+    0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xF5, 0x9E, 0x94,
+    0xF5, 0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9, 0x9A, 0xF9, 0x6F, 0xFE, 0xA7, 0x0A, 0xFF, 0x97, 0x49,
+    0x99, 0x97, 0x59, 0xAC, 0xA7, 0x3A, 0xFC, 0x72, 0xD1, 0xD9, 0x71, 0xD1, 0xAC, 0x97, 0x1D, 0x90,
+    0xD7, 0x29, 0xF9, 0x74, 0x99, 0x77, 0x71, 0xAF, 0x2A, 0xF2, 0xAF, 0xC1, 0xAF, 0xC3, 0x9F, 0x29,
+    0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF9, 0x2F, 0x4A,
+    0xFA, 0xAF, 0xC5, 0xFF, 0xFC, 0x92, 0x9F, 0xCA, 0x0F, 0xC5, 0x99, 0x92, 0x99, 0x30, 0x71, 0x93,
+    0xA7, 0x4D, 0x91, 0xAD, 0x72, 0xEA, 0x09, 0xE7, 0x1E, 0xA0, 0x9E, 0x97, 0x0A, 0xD9, 0x1D, 0xA7,
+    0x29, 0xA3, 0xC9, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0x19,
+    0xFE, 0xA9, 0xFE, 0x92, 0xAF, 0xCA, 0x29, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E,
+    0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E,
+    0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9F, 0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xF9, 0x4F, 0x5A, 0xFA,
+    0x99, 0xAF, 0x96, 0xFF, 0xEA, 0x70, 0xAF, 0xF9, 0x74, 0x99, 0x99, 0x70, 0x59, 0xA2, 0xC9, 0x71,
+    0xAD, 0x09, 0xD7, 0x1D, 0xA0, 0xE7, 0x0A, 0xD0, 0x9D, 0x97, 0x0D, 0x90, 0xAC, 0xA7, 0x1A, 0xA1,
+    0x9C, 0x77, 0x77, 0x70, 0xAF, 0x2A, 0xF2, 0xAF, 0xC1, 0xAF, 0xC3, 0x9F, 0x29, 0xF4, 0xF3, 0xF4,
+    0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF9, 0x2F, 0x4A, 0xFA, 0xAF, 0xC5,
+    0xFF, 0xFC, 0x92, 0x9F, 0xCA, 0x0F, 0xC5, 0x99, 0x92, 0x99, 0x30, 0x09, 0x99, 0x99, 0x99, 0x92,
+    0x99, 0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A, 0xFC, 0xA2, 0x9E, 0xA6, 0xE9,
+    0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA,
+    0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x4F, 0x59, 0xE9, 0x4F,
+    0x5A, 0xE5, 0xFA, 0x4F, 0x5A, 0xFC, 0xAA, 0xAF, 0x96, 0xFF, 0xEA, 0x70, 0x9F, 0xF9, 0x74, 0x99,
+    0xE7, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xFA, 0xA7, 0x59, 0xFA, 0x77, 0x99, 0x95, 0x77, 0x1A, 0xF2,
+    0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0,
+    0xFC, 0x59, 0x99, 0x3D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x5E, 0xAA, 0x73, 0x9F, 0x75, 0x99, 0x10,
+    0x77, 0x77, 0x7A, 0xDA, 0x77, 0x69, 0xFA, 0x77, 0x49, 0xDA, 0xAD, 0xA7, 0x72, 0x9D, 0xA1, 0xAD,
+    0x77, 0x29, 0xC9, 0x3A, 0x97, 0x77, 0x76, 0x99, 0x99, 0x99, 0x99, 0x72, 0x99, 0x99, 0x99, 0x90,
+    0x9F, 0xF2, 0x9E, 0x3F, 0xE1, 0xFE, 0x92, 0xAE, 0x39, 0xFC, 0xA2, 0xAF, 0x4F, 0x94, 0xE9, 0x39,
+    0xF3, 0x9F, 0xC3, 0x9E, 0x5F, 0x92, 0xAF, 0xC3, 0xAD, 0xA5, 0xAE, 0xA2, 0xFD, 0x92, 0xE9, 0x59,
+    0xF2, 0xFD, 0xA2, 0xE7, 0xF1, 0x9D, 0xAF, 0x19, 0xDA, 0x7A, 0xE9, 0x0A, 0xD0, 0xAE, 0x1A, 0xD9,
+    0x79, 0xEA, 0x0E, 0x09, 0xE9, 0x0E, 0x71, 0xF0, 0xDA, 0x1F, 0x0D, 0xA7, 0x1A, 0xE9, 0xD2, 0xAE,
+    0x9D, 0x97, 0x19, 0xFD, 0x29, 0xFD, 0x73, 0xFC, 0xA3, 0xFC, 0xA7, 0x3A, 0xF9, 0x3A, 0xF9, 0x73,
+    0x9F, 0x49, 0xF7, 0x5E, 0xA5, 0xF7, 0x77, 0x72, 0x77, 0x77, 0x0E, 0x77, 0x2F, 0xC7, 0x70, 0x9D,
+    0x9D, 0xA7, 0x7D, 0x90, 0x9D, 0x76, 0xAC, 0xA2, 0xAC, 0x77, 0x77, 0x77, 0x59, 0xFD, 0xA1, 0x9D,
+    0x91, 0xAF, 0xC1, 0xFD, 0x91, 0xAD, 0xA1, 0x9F, 0xC2, 0xF3, 0xF3, 0xE3, 0xAE, 0x29, 0xF2, 0x9D,
+    0x94, 0xEA, 0x1A, 0xF9, 0x1E, 0x5F, 0x1F, 0xCA, 0x1E, 0x5A, 0xE1, 0xD9, 0xE0, 0x9D, 0x96, 0xE9,
+    0xAC, 0xA0, 0xE0, 0xAD, 0x7E, 0xAD, 0x90, 0xAD, 0x9D, 0xA7, 0x9F, 0xC1, 0x9F, 0xC9, 0x70, 0xFC,
+    0x2F, 0xC7, 0x1A, 0xE9, 0x2A, 0xEA, 0x71, 0x9E, 0x39, 0xE7, 0x77, 0x40, 0x77, 0x70, 0x9D, 0xA7,
+    0x49, 0xFC, 0x73, 0xDA, 0xAD, 0xA7, 0x1D, 0xA1, 0x9D, 0x97, 0x0C, 0xA3, 0x9A, 0x77, 0x79, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x90, 0xAF, 0xEA, 0x09, 0xFD, 0xA9, 0xFD, 0xA2, 0xAF, 0xA2, 0xAF,
+    0x4E, 0xA4, 0xF9, 0x29, 0xE5, 0x9F, 0x2E, 0x96, 0xF9, 0x09, 0xDA, 0x70, 0xF0, 0xE7, 0x1A, 0xEA,
+    0xDA, 0x72, 0xFD, 0x73, 0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x2F, 0xFA,
+    0x79, 0xFF, 0xA3, 0x79, 0x75, 0xAD, 0xA7, 0x39, 0xF9, 0x72, 0xDA, 0xAD, 0x71, 0xAD, 0x1D, 0xA7,
+    0x0D, 0x3C, 0xA7, 0x77, 0x76, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF, 0xA2, 0xF9, 0x3A, 0xDA,
+    0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A, 0xE0, 0xAD, 0x97,
+    0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74, 0x9D, 0xA7, 0x4E, 0x73,
+    0xAE, 0xA7, 0xAF, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x77, 0x59, 0xDA, 0x1E, 0x70,
+    0xF0, 0x9E, 0xA7, 0xAE, 0x1E, 0x97, 0x09, 0x92, 0x99, 0x97, 0x77, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x0A, 0xFE, 0xA0, 0x9F, 0xDA, 0x9F, 0xDA, 0x2A, 0xFA, 0x2A, 0xF4, 0xEA, 0x4F, 0x92,
+    0x9E, 0x59, 0xF2, 0xE9, 0x6F, 0x90, 0x9D, 0xA7, 0x0F, 0x0E, 0x71, 0xAE, 0xAD, 0xA7, 0x2F, 0xD7,
+    0x39, 0xF9, 0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF9, 0x72, 0xFF, 0xA7, 0x9F, 0xFA, 0x30,
+    0x77, 0x7A, 0xC7, 0x29, 0xE9, 0x70, 0xAF, 0x70, 0xAE, 0xA9, 0x70, 0x9A, 0x97, 0x77, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0x1A, 0xFF, 0xF1, 0xE9, 0x3F, 0xA1, 0xDA, 0x3A, 0xF2, 0x9C,
+    0x93, 0xF7, 0x1F, 0xA7, 0x0A, 0xF7, 0x09, 0xF7, 0x1F, 0x97, 0x0F, 0xA7, 0x09, 0xF7, 0x1F, 0x93,
+    0x9C, 0x2F, 0xA4, 0xDA, 0x0A, 0xF4, 0x9D, 0xA0, 0xFA, 0xAA, 0xAA, 0xAE, 0x90, 0xFF, 0xFC, 0x1A,
+    0xFF, 0xF7, 0x70, 0x6A, 0x97, 0x19, 0xD7, 0x1E, 0x70, 0xAD, 0xA7, 0x0D, 0xA7, 0x19, 0xA7, 0x77,
+    0x70, 0xAF, 0xFC, 0xA1, 0xAF, 0xFD, 0x1E, 0x99, 0x9F, 0xA1, 0xD9, 0x19, 0xEA, 0x29, 0xA1, 0x9F,
+    0x7F, 0x7F, 0x96, 0xAE, 0xA6, 0x9F, 0x2A, 0xC1, 0x9F, 0x3D, 0x90, 0xFA, 0x99, 0x9A, 0xD1, 0xFF,
+    0xE1, 0xFF, 0xDA, 0x75, 0x59, 0xA9, 0x72, 0x9E, 0x97, 0x1A, 0xEA, 0x71, 0x9E, 0x97, 0x39, 0x77,
+    0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xF1, 0xAF, 0xFF, 0x1E, 0x93, 0xFA, 0x1D, 0xA3,
+    0xAF, 0x29, 0xC9, 0x3F, 0x71, 0xFA, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xF9, 0x70, 0xFA, 0x70, 0x9F,
+    0x71, 0xF9, 0x39, 0xC2, 0xFA, 0x4D, 0xA0, 0xAF, 0x49, 0xDA, 0x0F, 0xAA, 0xAA, 0xAA, 0xE9, 0x0F,
+    0xFF, 0xC1, 0xAF, 0xFF, 0x77, 0x49, 0x99, 0x70, 0x9E, 0x70, 0xAE, 0x97, 0x9E, 0x72, 0x97, 0x77,
+    0x70, 0xAF, 0xFC, 0xA1, 0xAF, 0xFD, 0x1E, 0x99, 0x9F, 0xA1, 0xD9, 0x19, 0xEA, 0x29, 0xA1, 0x9F,
+    0x7F, 0x7F, 0x96, 0xAE, 0xA6, 0x9F, 0x2A, 0xC1, 0x9F, 0x3D, 0x90, 0xFA, 0x99, 0x9A, 0xD1, 0xFF,
+    0xE1, 0xFF, 0xDA, 0x75, 0x77, 0x1A, 0xC3, 0x9D, 0x5E, 0x19, 0xD9, 0x6E, 0xAD, 0x97, 0x9F, 0xA7,
+    0x2E, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xF1, 0xAF, 0xFF, 0x1E, 0x93, 0xFA,
+    0x1D, 0xA3, 0xAF, 0x29, 0xC9, 0x3F, 0x71, 0xFA, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xF9, 0x70, 0xFA,
+    0x70, 0x9F, 0x71, 0xF9, 0x39, 0xC2, 0xFA, 0x4D, 0xA0, 0xAF, 0x49, 0xDA, 0x0F, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x0F, 0xFF, 0xC1, 0xAF, 0xFF, 0x77, 0x29, 0x39, 0x94, 0xDA, 0x19, 0xD4, 0xAD, 0x90, 0xD9,
+    0x5F, 0xD7, 0xF7, 0x1A, 0xA9, 0x77, 0x77, 0xAF, 0xFC, 0xA1, 0xAF, 0xFD, 0x1E, 0x99, 0x9F, 0xA1,
+    0xD9, 0x19, 0xEA, 0x29, 0xA1, 0x9F, 0x7F, 0x7F, 0x96, 0xAE, 0xA6, 0x9F, 0x2A, 0xC1, 0x9F, 0x3D,
+    0x90, 0xFA, 0x99, 0x9A, 0xD1, 0xFF, 0xE1, 0xFF, 0xDA, 0x75, 0x59, 0xAA, 0x96, 0x9F, 0xE3, 0x9F,
+    0xF9, 0x2F, 0x1A, 0xD9, 0x19, 0xE9, 0x2A, 0x92, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70,
+    0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70,
+    0xAE, 0x69, 0xFE, 0xA3, 0xAF, 0xEA, 0x30, 0x76, 0x9A, 0xA7, 0x7E, 0xA7, 0x6E, 0xA5, 0x9A, 0xEA,
+    0x91, 0xE9, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x3F, 0xA2, 0x9F, 0xC3, 0xAE, 0x95, 0xFA, 0x2F,
+    0x6A, 0xF1, 0x9E, 0xA7, 0xF9, 0x0A, 0xE9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9,
+    0x7F, 0x90, 0xFA, 0x7F, 0x1A, 0xF7, 0xF1, 0x9F, 0x6A, 0xE9, 0x2F, 0xC4, 0x9F, 0x39, 0xFC, 0xA9,
+    0x9A, 0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x70, 0x77, 0x72, 0x9D, 0xA7, 0x4E,
+    0x69, 0x99, 0x90, 0x9E, 0x4A, 0xFF, 0xC9, 0x3F, 0xFD, 0x93, 0xF9, 0x09, 0xF9, 0x29, 0xE9, 0x29,
+    0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xFA, 0x29, 0xEA, 0x29, 0xFA,
+    0x09, 0xF4, 0xAF, 0xFC, 0x6A, 0xFD, 0xA7, 0x29, 0x99, 0x60, 0x39, 0x9A, 0xAA, 0xAA, 0xA9, 0x6A,
+    0xFF, 0xF9, 0x19, 0xFF, 0xFE, 0x90, 0xEA, 0x0A, 0xE9, 0x1F, 0xC0, 0xE9, 0x0A, 0xE9, 0x2F, 0x09,
+    0xD9, 0x0A, 0xE9, 0x2A, 0xE9, 0x4A, 0xE9, 0x2F, 0x5A, 0xE9, 0x2F, 0x5A, 0xE9, 0x1F, 0x95, 0xAF,
+    0xFC, 0xA6, 0xAF, 0xF9, 0x7A, 0xEA, 0xA9, 0x97, 0x1A, 0xE9, 0x74, 0xAE, 0x97, 0x4A, 0xE9, 0x74,
+    0xAE, 0x97, 0x2A, 0xFE, 0xA7, 0x0F, 0xFA, 0x50, 0x59, 0x9A, 0x99, 0x79, 0xFE, 0x59, 0xFF, 0xA4,
+    0xF1, 0x9D, 0x93, 0x9E, 0x92, 0x99, 0x4A, 0xE7, 0x2A, 0xE2, 0x99, 0x5A, 0xE9, 0xFC, 0xA3, 0xAF,
+    0xFD, 0xA2, 0xAF, 0xAA, 0xFC, 0x2A, 0xE9, 0x2F, 0x91, 0xAE, 0x3A, 0xEA, 0x1A, 0xE3, 0x9E, 0xA1,
+    0xAE, 0x39, 0xEA, 0x1A, 0xE3, 0x9E, 0xA1, 0xAE, 0x39, 0xE9, 0x1A, 0xE3, 0xF2, 0xAE, 0xA9, 0x9A,
+    0xEA, 0x2A, 0xFF, 0xCA, 0x3A, 0xFF, 0x94, 0xAE, 0x99, 0x97, 0xAE, 0x72, 0xAE, 0x72, 0xFA, 0x79,
+    0xFE, 0x95, 0x9A, 0xAA, 0xAA, 0xAA, 0x60, 0x49, 0x97, 0x0E, 0x7A, 0xE7, 0xAE, 0x59, 0xFF, 0xC1,
+    0xFF, 0xCA, 0x19, 0x9F, 0x99, 0x94, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xFC, 0xAA, 0xC3,
+    0xAF, 0xE4, 0xFE, 0x69, 0x9A, 0xD7, 0x09, 0xD3, 0x9C, 0x91, 0xDA, 0x3E, 0xAE, 0x4A, 0xFC, 0x95,
+    0x9A, 0xAA, 0x30, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0xD1, 0xFF, 0xFF, 0x09,
+    0xE9, 0x09, 0xF1, 0x9E, 0x0A, 0xDA, 0x2F, 0x2E, 0x09, 0xE2, 0xF2, 0xDA, 0x1A, 0xD9, 0x1F, 0x29,
+    0x97, 0x0F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x49, 0xF9, 0x71,
+    0x9F, 0xF9, 0x7A, 0xFF, 0x93, 0x69, 0xAA, 0x97, 0xAF, 0xD9, 0x4A, 0xFF, 0x4E, 0xA1, 0xAC, 0xA3,
+    0xAE, 0x3A, 0x4F, 0x71, 0xF7, 0x9F, 0xFC, 0x3F, 0xFC, 0xA3, 0x99, 0xF9, 0x99, 0x6F, 0x71, 0xF7,
+    0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xFC, 0xAA, 0xC5, 0xAF, 0xE6, 0xFD, 0x97, 0x09,
+    0x95, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1, 0xE9,
+    0x09, 0xF1, 0x9E, 0x1D, 0xA2, 0xF2, 0xE1, 0xD9, 0x2F, 0x2D, 0xA2, 0x93, 0xF2, 0x99, 0x70, 0xF7,
+    0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+    0x75, 0xAE, 0x1D, 0x72, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x29, 0xAE, 0x92, 0x77, 0x09, 0xAA, 0x77,
+    0x1E, 0xA7, 0x70, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0xAE, 0x9A, 0xFF, 0x19, 0xFE,
+    0x90, 0x9F, 0xE9, 0x2A, 0xFC, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94,
+    0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6,
+    0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9F, 0x59, 0xE9, 0x5F, 0x5A, 0xE6, 0xF9, 0x4F, 0x6A, 0xFA, 0x99,
+    0xAF, 0x97, 0xFF, 0xEA, 0x71, 0xAF, 0xF9, 0x75, 0x99, 0x99, 0x70, 0x77, 0x75, 0xE7, 0x5E, 0xA7,
+    0x4E, 0x90, 0xAF, 0x2A, 0xFC, 0xA0, 0xAF, 0xC1, 0xAF, 0xC9, 0x29, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F,
+    0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x09, 0x92, 0x9D, 0x91, 0x9E, 0x2A,
+    0xE2, 0x9D, 0x93, 0xA0, 0x2A, 0x2E, 0x09, 0xE0, 0xE0, 0x9D, 0x91, 0xA2, 0x74, 0x9E, 0x5F, 0xA3,
+    0xAD, 0x9D, 0x91, 0x9D, 0x1A, 0xD1, 0xAC, 0x92, 0xCA, 0x72, 0x19, 0xA9, 0x19, 0x2F, 0xA0, 0xD1,
+    0xFF, 0x1D, 0x09, 0xEA, 0x69, 0x20, 0x0F, 0xF1, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x90, 0x72, 0xD3,
+    0x9C, 0x1E, 0xA9, 0xAD, 0x1A, 0xFD, 0x92, 0x9A, 0xDA, 0x20, 0x19, 0x92, 0xF1, 0xF1, 0xEA, 0x29,
+    0x20, 0x72, 0xE1, 0xAD, 0x09, 0xE1, 0xE9, 0x9E, 0x1E, 0x91, 0x93, 0x91, 0x1A, 0xDA, 0x2F, 0xD0,
+    0x9D, 0x1D, 0x90, 0xA9, 0x1D, 0x39, 0xD9, 0x29, 0xD5, 0xC9, 0x20, 0x19, 0xAC, 0xA2, 0xAF, 0xC1,
+    0xD1, 0xD0, 0x9C, 0xA1, 0xAC, 0x90, 0xD9, 0x0D, 0x19, 0xF9, 0x39, 0x92, 0x19, 0xA2, 0xC9, 0x2E,
+    0x0A, 0xD2, 0xDA, 0x0E, 0x1A, 0xD0, 0x9D, 0x91, 0xD9, 0x0A, 0xCA, 0x2A, 0xA1, 0x9C, 0x74, 0x19,
+    0x39, 0x91, 0xD2, 0xAD, 0x1E, 0x09, 0xD3, 0xFC, 0x93, 0x9E, 0xA5, 0x9A, 0xA3, 0x09, 0xC2, 0xA9,
+    0x2D, 0xA0, 0xE2, 0xE0, 0xAD, 0x29, 0xD9, 0x0D, 0xA2, 0xAC, 0xA0, 0x9D, 0x3C, 0x91, 0xAA, 0x72,
+    0x29, 0xAA, 0xA4, 0xFD, 0x91, 0xDA, 0xAA, 0xE1, 0xC9, 0x29, 0xD1, 0x94, 0x91, 0x29, 0x2A, 0xD0,
+    0x9D, 0x1E, 0x1E, 0x1E, 0x1A, 0xDA, 0x19, 0x10, 0x0A, 0xD1, 0xEA, 0x09, 0xE0, 0x9D, 0xA0, 0xAD,
+    0x09, 0xD9, 0x09, 0xA9, 0x10, 0x0D, 0xA0, 0xAE, 0x0E, 0x90, 0xAD, 0x91, 0xDA, 0x19, 0xD9, 0x19,
+    0xA0, 0x09, 0x91, 0xDA, 0x0D, 0xA0, 0xD1, 0xD1, 0xC9, 0x19, 0x10, 0x09, 0xD9, 0x1D, 0xA1, 0xDA,
+    0x0E, 0x1D, 0x29, 0x20, 0x69, 0xDA, 0x1F, 0x1F, 0x19, 0xCA, 0x90, 0x09, 0xA9, 0x19, 0xAA, 0x09,
+    0xE1, 0xE9, 0x9E, 0x1E, 0x90, 0xAA, 0x91, 0x9A, 0x90, 0x09, 0xAA, 0x90, 0x9F, 0x9D, 0x1F, 0x1C,
+    0xA9, 0xF1, 0x9A, 0x91, 0x1A, 0xA1, 0xAE, 0x1E, 0x1D, 0xA0, 0xE1, 0x99, 0x10, 0x0A, 0xCA, 0x91,
+    0xF2, 0x9D, 0x91, 0xAD, 0x1A, 0xD2, 0xA9, 0x20, 0x69, 0xD9, 0x09, 0xD9, 0x1A, 0xD2, 0xAE, 0xA9,
+    0x0F, 0x92, 0x91, 0xAA, 0xAF, 0xFF, 0xE2, 0x49, 0x6A, 0xE4, 0x9F, 0xC3, 0xDA, 0x9E, 0x1D, 0xA2,
+    0xD9, 0x09, 0x94, 0x90, 0x72, 0xAC, 0x4C, 0x1E, 0x90, 0x9D, 0x1A, 0xFD, 0x92, 0xAE, 0xA9, 0x73,
+    0x1A, 0xCA, 0x1A, 0x91, 0xFA, 0x9D, 0x1D, 0xAF, 0xC1, 0xAA, 0x1E, 0x97, 0x20, 0x09, 0x99, 0x99,
+    0x99, 0x91, 0xFF, 0x1F, 0xF0, 0x29, 0xAA, 0xA4, 0xFD, 0x91, 0xDA, 0xAA, 0xE1, 0xC9, 0x29, 0xD1,
+    0x94, 0x91, 0x77, 0xD6, 0xAD, 0x94, 0x9E, 0x5E, 0x6D, 0x76, 0xE1, 0xE9, 0x9E, 0x1E, 0x90, 0xE1,
+    0xE7, 0x20, 0x09, 0x91, 0x9D, 0x1A, 0xD1, 0x9F, 0x0E, 0xA4, 0x70, 0x9A, 0xA7, 0x7F, 0x76, 0x9F,
+    0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E,
+    0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E,
+    0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0,
+    0x19, 0x99, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA4, 0xF2, 0xF4, 0xF2, 0x9E, 0x93,
+    0xF3, 0xE4, 0xF2, 0x9E, 0x4F, 0x2E, 0x94, 0xFF, 0xD5, 0xFF, 0xE4, 0xF1, 0x9A, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xAE, 0x92, 0xF3, 0xAE, 0x3F, 0x3F, 0x3F, 0x99, 0xAF, 0xA1, 0xAF, 0xFE, 0xA2, 0xFF, 0xDA,
+    0x77, 0x30, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xCA, 0x0A, 0xFF, 0xFA, 0x2F,
+    0x99, 0x99, 0xAD, 0x92, 0xF3, 0x9D, 0x92, 0xF3, 0x9D, 0x3F, 0x4C, 0xA3, 0xF7, 0x2F, 0x72, 0xF7,
+    0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF9, 0x7A, 0xFE, 0xA5, 0xFF, 0xA4, 0x7A, 0xCA,
+    0x74, 0xF7, 0x3A, 0xF9, 0x72, 0xFC, 0xA7, 0x19, 0xFD, 0x71, 0xDA, 0xAE, 0x97, 0x9D, 0x90, 0xF7,
+    0xE1, 0xF7, 0xDA, 0x19, 0xEA, 0x5A, 0xD3, 0xF5, 0xE3, 0xF9, 0x39, 0xDA, 0x39, 0xEA, 0x3E, 0x5F,
+    0x29, 0xE5, 0xF9, 0x1A, 0xD9, 0x59, 0xF1, 0xE9, 0x59, 0xF0, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E,
+    0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9,
+    0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xCA, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xF1, 0xAF, 0xFF, 0x1E, 0x93,
+    0xFA, 0x1D, 0xA3, 0xAF, 0x29, 0xC9, 0x3F, 0x71, 0xFA, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xF9, 0x70,
+    0xFA, 0x70, 0x9F, 0x71, 0xF9, 0x39, 0xC2, 0xFA, 0x4D, 0xA0, 0xAF, 0x49, 0xDA, 0x0F, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x0F, 0xFF, 0xC1, 0xAF, 0xFF, 0x77, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xF9, 0x1F, 0xFA, 0x0A, 0xFD, 0xA2, 0xAF, 0xDA, 0x3F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9,
+    0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0x6A, 0xE9, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF, 0xE9, 0x4F,
+    0xAA, 0xAA, 0xAA, 0xAF, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE, 0x94, 0xF6, 0xAE,
+    0x94, 0xF9, 0x5F, 0xA2, 0xAF, 0xE9, 0x1A, 0xFE, 0xA0, 0xFF, 0x91, 0xFF, 0xA0, 0x59, 0xAD, 0xAA,
+    0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xF9, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0x9F,
+    0x09, 0xE9, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x1F, 0xCA, 0x0A, 0xE9, 0xF1, 0xFC, 0xA0, 0xAE, 0x9F,
+    0x19, 0xAA, 0xAA, 0x1A, 0xE9, 0xF9, 0x7F, 0x0A, 0xEA, 0x7F, 0x09, 0xF6, 0x9E, 0x91, 0xFC, 0x5F,
+    0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x09, 0x99, 0x99,
+    0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99,
+    0x1F, 0xF1, 0xFE, 0x90, 0xAF, 0xD9, 0x2F, 0xC9, 0x3F, 0x39, 0xEA, 0x5F, 0x29, 0xEA, 0x6F, 0x19,
+    0xEA, 0x7F, 0x1E, 0x97, 0x0F, 0x9E, 0x97, 0x1F, 0xEA, 0x72, 0xFF, 0x97, 0x1F, 0x9F, 0x71, 0xF0,
+    0xAF, 0x70, 0xF1, 0xFC, 0x7F, 0x2F, 0xC6, 0xF2, 0x9F, 0xC5, 0xF9, 0x29, 0xFC, 0x91, 0xAF, 0xE2,
+    0x9F, 0xCA, 0x0F, 0xF3, 0x9F, 0x97, 0x69, 0x91, 0x70, 0xAC, 0x97, 0x6F, 0x75, 0xAF, 0x75, 0xFC,
+    0x97, 0x39, 0xFD, 0x73, 0xEA, 0xE7, 0x29, 0xD9, 0x9E, 0xA7, 0x1A, 0xD1, 0xF7, 0x1D, 0xA1, 0xF7,
+    0x09, 0xD9, 0x19, 0xEA, 0x7E, 0x3F, 0x69, 0xDA, 0x3F, 0x95, 0xAD, 0x93, 0xAE, 0xA5, 0xE5, 0xF4,
+    0x9D, 0xA5, 0xF9, 0x3E, 0x95, 0xAE, 0xA1, 0xAF, 0xD2, 0x9F, 0xEA, 0xFE, 0x91, 0xAF, 0xEA, 0x29,
+    0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x93, 0xFE, 0x5F, 0xE3, 0x9F, 0xD9, 0x39, 0xFD, 0x95, 0xFC,
+    0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xD6, 0x9D, 0xAE, 0x91, 0x9D, 0xAE, 0x95, 0x9D, 0x9E, 0xA1, 0xAD,
+    0x0E, 0x95, 0xAD, 0x9A, 0xE1, 0xDA, 0x0E, 0x95, 0xAD, 0x09, 0xE1, 0xD9, 0x0E, 0xA5, 0xAD, 0x1E,
+    0x99, 0xD1, 0xEA, 0x5E, 0x1A, 0xFC, 0xA1, 0xF5, 0xE1, 0x9F, 0xC9, 0x1F, 0x5E, 0x2F, 0xC2, 0xAE,
+    0x5E, 0x2A, 0xEA, 0x2A, 0xE4, 0x9E, 0x3E, 0x92, 0xAE, 0x49, 0xDA, 0x3E, 0x3A, 0xE9, 0x2F, 0xDA,
+    0x19, 0xA9, 0x2F, 0xE0, 0x9F, 0xE6, 0x9F, 0xE0, 0x09, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x90,
+    0x9F, 0xD9, 0x3A, 0xFE, 0x1A, 0xFD, 0x39, 0xFD, 0x93, 0xFC, 0xA4, 0x9E, 0x5F, 0xD9, 0x39, 0xE5,
+    0xFE, 0x39, 0xE5, 0xFE, 0xA2, 0x9E, 0x5E, 0x9F, 0x91, 0x9E, 0x5E, 0x0A, 0xF1, 0x9E, 0x5E, 0x1F,
+    0xC0, 0x9E, 0x5E, 0x2F, 0xA9, 0xE5, 0xE2, 0xAF, 0x9E, 0x5E, 0x3F, 0xF5, 0xE4, 0xFE, 0x5E, 0x49,
+    0xFD, 0x49, 0xE5, 0xFD, 0x3F, 0xE4, 0xFC, 0x29, 0xFE, 0x49, 0xF7, 0x70, 0x99, 0x40, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x1A, 0xD9, 0x99, 0x99, 0x99,
+    0x9E, 0x1A, 0xD7, 0xE1, 0x9D, 0x7A, 0xCA, 0x29, 0x97, 0x99, 0x77, 0x59, 0xFE, 0x79, 0xFE, 0x70,
+    0xAA, 0xAA, 0xAA, 0x97, 0x74, 0x9A, 0x97, 0x0A, 0xA1, 0xDA, 0x70, 0xD9, 0x0D, 0xA7, 0x9D, 0x90,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x90, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0x59, 0xAD, 0xAA, 0x97,
+    0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF, 0x09,
+    0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F, 0x0A,
+    0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F, 0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A,
+    0xFE, 0xA7, 0x29, 0x99, 0x97, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F,
+    0xFF, 0xFE, 0x1A, 0xFF, 0xFF, 0xC9, 0x3F, 0x94, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59,
+    0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5,
+    0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF9, 0x49, 0xF3, 0xAF, 0xE9, 0x1F, 0xF1, 0xFF, 0x90, 0x9F, 0xF0,
+    0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xF9, 0x2A, 0xFF, 0xF9, 0x3F, 0x19, 0xFA, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x29, 0xEA, 0x3F, 0x19, 0xF9, 0x3F, 0xFD, 0x94, 0xFF, 0xC9, 0x5F,
+    0xAA, 0x97, 0x0F, 0x73, 0xF7, 0x3F, 0x73, 0xF9, 0x70, 0xAF, 0xE9, 0x6F, 0xF9, 0x50, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFC, 0x1F, 0xFF, 0xC9, 0x0A, 0xF4, 0x9D, 0x91, 0xAF, 0x4D,
+    0x92, 0xFA, 0x3A, 0xC4, 0xF9, 0x71, 0x9F, 0x97, 0x19, 0xF7, 0x2E, 0xA7, 0x1F, 0x71, 0xF7, 0x1A,
+    0xE4, 0xAC, 0xA1, 0xAE, 0x5D, 0xA0, 0xAE, 0x59, 0xDA, 0x9F, 0xAA, 0xAA, 0xFC, 0x99, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC7, 0x70, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0x1F,
+    0xFF, 0xF1, 0xE9, 0x09, 0xF1, 0x9E, 0x1D, 0xA2, 0xF2, 0xE1, 0xD9, 0x2F, 0x2D, 0xA2, 0x93, 0xF2,
+    0x99, 0x70, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0x9F, 0x97,
+    0x19, 0xFF, 0x97, 0xAF, 0xF9, 0x30, 0x19, 0xAC, 0x96, 0x9A, 0xA2, 0xFC, 0x94, 0x9F, 0x0A, 0xFD,
+    0x4F, 0x92, 0x9F, 0x3A, 0xE9, 0x4A, 0xEA, 0x2E, 0xA6, 0xF1, 0x9E, 0x79, 0xE1, 0xE9, 0x70, 0xE9,
+    0x9D, 0xA7, 0x1A, 0xEA, 0xD7, 0x3F, 0xCA, 0x73, 0xFC, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0x9E,
+    0xA7, 0x49, 0xEA, 0x74, 0x9F, 0x97, 0x19, 0xFF, 0x70, 0xFF, 0xC4, 0x5F, 0xF7, 0x3F, 0xEA, 0x75,
+    0xF7, 0x59, 0xAF, 0xAA, 0x97, 0x9F, 0xFF, 0xA4, 0xAF, 0xAF, 0x9F, 0xC2, 0x9E, 0xA1, 0xAE, 0x1A,
+    0xEA, 0x1F, 0x2A, 0xE2, 0xF1, 0xF2, 0xAE, 0x2A, 0xE9, 0x0F, 0x2A, 0xE2, 0xAE, 0x90, 0xF2, 0xAE,
+    0x2F, 0x1A, 0xEA, 0x1A, 0xE1, 0x9E, 0xA2, 0xFA, 0x9F, 0x9A, 0xF4, 0xFF, 0xFC, 0xA7, 0xAF, 0xEA,
+    0x97, 0x4A, 0xE7, 0x6A, 0xFA, 0xA7, 0x3F, 0xF7, 0x39, 0x99, 0x99, 0x99, 0x95, 0x09, 0x99, 0x99,
+    0x99, 0x92, 0x99, 0x99, 0x99, 0x1F, 0xF9, 0x0A, 0xFD, 0x90, 0xAF, 0xDA, 0x19, 0xAF, 0xA3, 0xFC,
+    0x3A, 0xE6, 0xFA, 0x19, 0xE7, 0x9F, 0x1E, 0x97, 0x0A, 0xFE, 0xA7, 0x2A, 0xFC, 0xA7, 0x4F, 0xC7,
+    0x5A, 0xF9, 0x73, 0xAF, 0xD7, 0x29, 0xEA, 0xF7, 0x1E, 0x90, 0xFA, 0x7E, 0xA1, 0x9F, 0x95, 0xAE,
+    0x3A, 0xF4, 0xAE, 0x94, 0xFC, 0x19, 0xFE, 0x19, 0xFF, 0xAF, 0xE1, 0xAF, 0xF0, 0x9A, 0xA9, 0x29,
+    0x99, 0x99, 0x99, 0x92, 0xAA, 0xA0, 0x9E, 0x90, 0x9F, 0xF1, 0xEA, 0x1F, 0x1A, 0xFC, 0xA1, 0x9E,
+    0x91, 0xAE, 0x3E, 0xA2, 0xAE, 0x2A, 0xE3, 0xEA, 0x2A, 0xE2, 0x9E, 0x92, 0xEA, 0x2F, 0x3E, 0x92,
+    0xEA, 0x2E, 0xA3, 0xEA, 0x2E, 0xA2, 0xE9, 0x3F, 0x2E, 0xA1, 0x9E, 0x49, 0xE9, 0x1E, 0xA1, 0xF5,
+    0xFA, 0x9E, 0xA9, 0xF7, 0xFF, 0xFC, 0x97, 0x09, 0xAF, 0xEA, 0x97, 0x6E, 0xA7, 0x71, 0xEA, 0x77,
+    0x1E, 0xA7, 0x7A, 0xFE, 0x74, 0x9F, 0xF6, 0x7A, 0xAD, 0xAA, 0x74, 0xAF, 0xFA, 0x71, 0xFF, 0xF7,
+    0xFA, 0x29, 0xFC, 0x5A, 0xEA, 0x5F, 0x94, 0xF6, 0xAE, 0xA3, 0x9F, 0x69, 0xF3, 0x9E, 0xA7, 0xF3,
+    0x9E, 0xA7, 0xF3, 0x9F, 0x69, 0xEA, 0x4F, 0x69, 0xE9, 0x4A, 0xE9, 0x5F, 0x6E, 0xA4, 0x9E, 0x4D,
+    0x1E, 0x93, 0xE9, 0x0A, 0xC9, 0x0D, 0x2E, 0x91, 0xE9, 0x1D, 0xA0, 0xEA, 0xAA, 0xDA, 0x1D, 0xAA,
+    0xAA, 0xDA, 0x0F, 0xF9, 0x1F, 0xFA, 0x0F, 0xF2, 0xAF, 0xEA, 0x49, 0x99, 0x49, 0x94, 0x9F, 0xC1,
+    0xEA, 0x39, 0xFE, 0x9E, 0x93, 0xF9, 0x9F, 0xD3, 0x9E, 0x92, 0xFC, 0x3F, 0x39, 0xF3, 0xF4, 0xEA,
+    0x3F, 0x4E, 0xA3, 0xF3, 0x9E, 0xA3, 0xF3, 0xFA, 0x3F, 0x91, 0x9F, 0xC3, 0xAF, 0x9A, 0xFD, 0x93,
+    0xFE, 0xA9, 0xFC, 0xA2, 0xFC, 0xA1, 0xFA, 0x59, 0x94, 0x99, 0x20, 0x49, 0xAA, 0x97, 0xAF, 0xDA,
+    0x4F, 0xFC, 0xA2, 0xAE, 0x91, 0xF9, 0x1E, 0xA2, 0x9E, 0x91, 0xE9, 0x3E, 0x91, 0xE9, 0x29, 0xE9,
+    0x09, 0xE9, 0x29, 0xE1, 0x9E, 0x92, 0xE9, 0x19, 0xE9, 0x0F, 0xA2, 0x9E, 0x99, 0xFC, 0xA1, 0x9E,
+    0x90, 0x99, 0xFA, 0x09, 0xE9, 0x3F, 0x09, 0xE9, 0x39, 0xE9, 0x9E, 0x93, 0x9E, 0x99, 0xE9, 0x3A,
+    0xE9, 0x9E, 0x93, 0xF0, 0x9E, 0xA1, 0x9F, 0x90, 0x9F, 0xFD, 0xA1, 0x9F, 0xFC, 0x92, 0x9E, 0x90,
+    0x96, 0x9E, 0x97, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x0A, 0xEA, 0x70, 0x9A, 0xA9, 0x71, 0x49, 0x59,
+    0x2A, 0xF9, 0x3E, 0x99, 0xFC, 0xA3, 0xEA, 0x1A, 0xF3, 0xEA, 0x2F, 0x92, 0xEA, 0x3F, 0x19, 0xE9,
+    0x3F, 0x19, 0xE4, 0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xE6, 0xAE, 0x9D, 0xA7, 0xFD, 0x70, 0xFC, 0x97,
+    0x0A, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xE9, 0x71, 0xF9, 0x71, 0xAA, 0xA9,
+    0x40, 0x59, 0xAA, 0xA9, 0x7A, 0xFE, 0xA4, 0xAF, 0xFC, 0x93, 0xE9, 0x19, 0xAD, 0x39, 0xE5, 0x94,
+    0xF9, 0x71, 0xFD, 0x71, 0xFD, 0xA7, 0xAF, 0xE5, 0xEA, 0xAF, 0xC3, 0xF1, 0xAF, 0x91, 0xAE, 0x92,
+    0xAE, 0xA1, 0xF3, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1A, 0xEA, 0x29, 0xE9, 0x19, 0xFA,
+    0x09, 0xF3, 0xAF, 0xFC, 0x59, 0xFD, 0xA7, 0x19, 0x96, 0x59, 0x99, 0x5A, 0xFE, 0x2F, 0xFC, 0x90,
+    0x9E, 0x92, 0xAC, 0x1A, 0xE7, 0x9E, 0x70, 0xFE, 0x49, 0xFD, 0x39, 0xF9, 0x99, 0x3F, 0x7F, 0x59,
+    0x0F, 0xA9, 0x99, 0xAD, 0x0A, 0xFF, 0xCA, 0x19, 0xFE, 0x95, 0x99, 0x93, 0x19, 0x71, 0x9D, 0x70,
+    0xAD, 0x90, 0x99, 0xAD, 0xA0, 0xAF, 0xFC, 0xA0, 0xAF, 0xFC, 0x2A, 0xAA, 0x99, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0xA6, 0xAE, 0x7E, 0x7E, 0xA7, 0xE7, 0xAE, 0x7F, 0x7F, 0x7F, 0x7F, 0xA6, 0xAF, 0xCA,
+    0x94, 0xFF, 0xC3, 0xAF, 0xEA, 0x59, 0xAE, 0xA7, 0xE9, 0x69, 0xE7, 0xE9, 0x79, 0xA9, 0x10, 0x29,
+    0x99, 0x39, 0x94, 0xAF, 0x90, 0xFC, 0xA2, 0xFC, 0xAF, 0xE9, 0x29, 0xFD, 0x9A, 0xF3, 0xAF, 0x2F,
+    0x3A, 0xEA, 0x2F, 0x3A, 0xE9, 0x2A, 0xE3, 0xAE, 0x92, 0xAE, 0x3A, 0xE9, 0x2A, 0xE3, 0xAE, 0x92,
+    0xAE, 0x3A, 0xE9, 0x2A, 0xE3, 0xAE, 0x92, 0xAE, 0x3A, 0xE9, 0x2A, 0xE3, 0xAE, 0x3A, 0xE7, 0x3A,
+    0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3F, 0x73, 0xF7, 0x3A, 0xA9, 0x10, 0x59, 0xA9, 0x97, 0x0F, 0xE9,
+    0x5F, 0xFC, 0x93, 0xAE, 0x19, 0xF3, 0xE9, 0x2A, 0xE9, 0x1A, 0xE4, 0xEA, 0x1F, 0x4F, 0x1E, 0xA4,
+    0xAE, 0x1E, 0xA4, 0xAE, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x0E, 0xA9, 0x99, 0x99, 0xAE, 0x1E,
+    0xA4, 0x9E, 0x1F, 0x4A, 0xE1, 0xF4, 0xAE, 0x1A, 0xE9, 0x3E, 0xA2, 0xF2, 0x9E, 0x3A, 0xEA, 0x99,
+    0xEA, 0x4F, 0xFC, 0x6A, 0xFC, 0xA7, 0x19, 0x99, 0x50, 0x39, 0x3F, 0x3E, 0xA2, 0x9E, 0xA2, 0x9E,
+    0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2, 0x9F, 0x3F, 0x92, 0xFE, 0x09,
+    0xFC, 0x39, 0x92, 0x39, 0x49, 0x92, 0xF3, 0xF1, 0xEA, 0x2F, 0xC0, 0x9E, 0xA1, 0xFA, 0x90, 0x9E,
+    0xA0, 0xEA, 0x39, 0xEA, 0xAD, 0xA4, 0x9F, 0xEA, 0x49, 0xFF, 0x49, 0xF0, 0xE9, 0x39, 0xEA, 0x0A,
+    0xDA, 0x39, 0xEA, 0x09, 0xE9, 0x29, 0xEA, 0x1F, 0xA9, 0x99, 0xEA, 0x19, 0xFD, 0x9E, 0x92, 0xAF,
+    0x97, 0x19, 0x91, 0x29, 0x9A, 0x97, 0x3F, 0xD7, 0x19, 0xFE, 0x71, 0x99, 0x9F, 0x97, 0x4E, 0xA7,
+    0x4F, 0x74, 0x9E, 0x74, 0x9E, 0xA7, 0x3F, 0xC7, 0x3F, 0xC7, 0x2A, 0xFC, 0x97, 0x1F, 0xDA, 0x70,
+    0xAD, 0x9F, 0x70, 0xE0, 0xAE, 0x96, 0x9E, 0x1E, 0xA6, 0xEA, 0x1F, 0x59, 0xE9, 0x1A, 0xE5, 0xF2,
+    0x9F, 0x39, 0xF3, 0xFD, 0x1F, 0x93, 0x9F, 0xA3, 0x97, 0x93, 0x39, 0x69, 0x3F, 0x3F, 0x3F, 0x29,
+    0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29,
+    0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 0xF2, 0xAE,
+    0xA2, 0x9F, 0xC9, 0xAF, 0xC9, 0x19, 0xFF, 0xAA, 0xFA, 0x9F, 0xEA, 0x1F, 0x09, 0xE0, 0x99, 0x49,
+    0x91, 0x9E, 0x73, 0x9E, 0x97, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x29, 0xAA, 0x97, 0x30, 0x73, 0x92,
+    0xAF, 0x93, 0xE9, 0x9F, 0xCA, 0x3E, 0xA1, 0xAF, 0x3E, 0xA2, 0xF9, 0x2E, 0xA3, 0xF1, 0x9E, 0x93,
+    0xAE, 0x1A, 0xE4, 0x9E, 0x90, 0xEA, 0x5E, 0xA0, 0xE6, 0xAE, 0x9D, 0x96, 0x9F, 0xD7, 0x0F, 0xC9,
+    0x70, 0xAE, 0xA7, 0x19, 0xE7, 0x73, 0x19, 0x71, 0xAC, 0xA7, 0x0E, 0x29, 0xAC, 0xA1, 0xFF, 0xCA,
+    0x1F, 0xFA, 0x5A, 0xE6, 0xEA, 0x6A, 0xE7, 0xF7, 0xF7, 0x9F, 0xAA, 0x95, 0xFD, 0x4F, 0xDA, 0x3E,
+    0xA6, 0xAE, 0x7E, 0xA7, 0xEA, 0x7F, 0x96, 0xAF, 0xA9, 0x94, 0xFF, 0xC3, 0x9F, 0xE9, 0x59, 0xAE,
+    0x97, 0xE9, 0x69, 0xE7, 0xE7, 0x09, 0xA9, 0x10, 0x59, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3,
+    0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4,
+    0xF1, 0xFA, 0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50,
+    0x76, 0x99, 0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xE9, 0x9F, 0xFF, 0xDA, 0x0A, 0xD1, 0xDA, 0x1A, 0xD4,
+    0xC9, 0x09, 0xDA, 0x1A, 0xD7, 0x9D, 0xA1, 0xE7, 0xAD, 0x91, 0xE7, 0xE9, 0x1E, 0x7E, 0x91, 0xE6,
+    0x9E, 0x91, 0xE9, 0x5A, 0xE2, 0xF9, 0x93, 0xF2, 0xAF, 0xC9, 0x2E, 0xA3, 0xFA, 0x77, 0x10, 0x59,
+    0x99, 0x7A, 0xFD, 0xA4, 0xFF, 0xD2, 0xAF, 0x99, 0xFA, 0x1F, 0x3F, 0x1E, 0xA3, 0xF1, 0xEA, 0x3F,
+    0x09, 0xEA, 0x3F, 0x09, 0xEA, 0x3F, 0x09, 0xEA, 0x3F, 0x09, 0xEA, 0x2A, 0xE9, 0x09, 0xF9, 0x09,
+    0xF1, 0x9F, 0xFD, 0x29, 0xFF, 0xA3, 0x9E, 0xA0, 0x96, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7,
+    0x0A, 0xEA, 0x70, 0x9A, 0xA9, 0x71, 0x59, 0x99, 0x6A, 0xFD, 0x3F, 0xFA, 0x1F, 0x90, 0xF0, 0x9E,
+    0x91, 0x9E, 0x0A, 0xE3, 0xCA, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0xC6, 0x9F, 0xCA, 0x99, 0x3A, 0xFF,
+    0x92, 0x9F, 0xF5, 0x9A, 0xF7, 0xAD, 0xA7, 0xE7, 0x9D, 0xA7, 0x0A, 0xA1, 0x75, 0x94, 0x9A, 0xFF,
+    0xC9, 0x2A, 0xFF, 0xE9, 0x1A, 0xFA, 0xAF, 0xCA, 0x19, 0xEA, 0x2A, 0xDA, 0x3A, 0xE3, 0x9E, 0x92,
+    0xF4, 0xEA, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0x39, 0xEA, 0x2A, 0xEA, 0x2A, 0xE9, 0x29, 0xF9, 0x0A,
+    0xF4, 0xAF, 0xFC, 0x69, 0xFD, 0xA7, 0x29, 0x99, 0x60, 0x73, 0x91, 0xFF, 0xF9, 0x0F, 0xFF, 0x09,
+    0xFF, 0xEA, 0x0A, 0xD1, 0xAD, 0xA5, 0xC9, 0x1E, 0xA7, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x09,
+    0xE9, 0x70, 0x9E, 0xA7, 0x1F, 0x99, 0x99, 0x5F, 0xE9, 0x59, 0xFC, 0xA7, 0x09, 0x99, 0x30, 0x59,
+    0x39, 0x93, 0xAF, 0xC2, 0xAE, 0x2F, 0xD2, 0x9E, 0x92, 0x9F, 0x3E, 0xA3, 0xF3, 0xF3, 0xF3, 0xF3,
+    0xF3, 0xF2, 0x9F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x29, 0xE9, 0x3A, 0xF9, 0x9F, 0x5F, 0xFC,
+    0x96, 0xAF, 0xCA, 0x72, 0x99, 0x95, 0x70, 0x9A, 0xA7, 0x7A, 0xE7, 0x7F, 0x77, 0xF7, 0x69, 0xF9,
+    0x72, 0x9F, 0xFD, 0xA6, 0xFF, 0xFD, 0x93, 0xFA, 0x9F, 0x9F, 0xC2, 0x9E, 0xA1, 0xF1, 0xAE, 0xA1,
+    0xF2, 0xF2, 0xF1, 0xF2, 0xF2, 0xF1, 0xEA, 0x2F, 0x2A, 0xE1, 0xF2, 0xF2, 0xF1, 0xF2, 0xF2, 0xF1,
+    0xAF, 0x1F, 0x1A, 0xE9, 0x2F, 0xCA, 0xF9, 0xFC, 0x4F, 0xFF, 0xCA, 0x69, 0xAF, 0xFA, 0x97, 0x3F,
+    0x77, 0xF7, 0x7F, 0x77, 0xF7, 0x7E, 0xA7, 0x7A, 0xA9, 0x70, 0x72, 0x99, 0x39, 0xFA, 0x29, 0xEA,
+    0x1F, 0xD2, 0xF3, 0x9F, 0x90, 0x9E, 0x95, 0xEA, 0x0F, 0x6A, 0xE9, 0xE7, 0x0F, 0xD9, 0x70, 0xAF,
+    0xC7, 0x19, 0xF7, 0x3F, 0x73, 0xF9, 0x71, 0x9F, 0xC7, 0x1F, 0xD9, 0x7A, 0xD9, 0xF6, 0x9E, 0x09,
+    0xE9, 0x5E, 0xA1, 0xF4, 0xAE, 0x2A, 0xE9, 0x29, 0xF3, 0xFC, 0x90, 0xF9, 0x3F, 0xCA, 0x09, 0xAC,
+    0xA4, 0x9A, 0xA9, 0x10, 0x72, 0x9A, 0x97, 0x79, 0xE9, 0x77, 0x9E, 0x77, 0x09, 0xE7, 0x49, 0x29,
+    0xE2, 0x99, 0x3A, 0xFC, 0x19, 0xE1, 0xAE, 0x2F, 0xD1, 0x9E, 0x19, 0xE9, 0x3E, 0xA1, 0x9E, 0x2E,
+    0xA3, 0xEA, 0x19, 0xE2, 0xF3, 0xEA, 0x19, 0xE2, 0xF3, 0xEA, 0x19, 0xE2, 0xAE, 0x29, 0xEA, 0x19,
+    0xE2, 0xF3, 0xF1, 0x9E, 0x2F, 0x3F, 0x19, 0xE1, 0x9E, 0xA3, 0xAE, 0xA0, 0x9E, 0x1F, 0x5F, 0xAA,
+    0xEA, 0xF9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x75, 0xAE, 0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xA9, 0x70, 0x49, 0x69, 0x96, 0xAE, 0x49, 0xE9, 0x39, 0xE9,
+    0x5F, 0x3E, 0xA7, 0xEA, 0x19, 0xE9, 0x1A, 0xCA, 0x91, 0xF1, 0xAE, 0x2E, 0xA1, 0x9E, 0x90, 0xF2,
+    0xE9, 0x19, 0xE9, 0x0E, 0xA2, 0xE9, 0x2E, 0xA0, 0xEA, 0x2E, 0x92, 0xE9, 0x0F, 0x2E, 0x92, 0xE9,
+    0x0F, 0x2E, 0xA1, 0x9E, 0x19, 0xEA, 0x0A, 0xF9, 0x0E, 0xA2, 0xFE, 0x9F, 0xE4, 0xFC, 0x91, 0xFC,
+    0x79, 0x94, 0x99, 0x40, 0x70, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A,
+    0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7,
+    0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E,
+    0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF7, 0x77, 0x77, 0x79, 0xE7, 0x7F, 0x97,
+    0x6A, 0xE9, 0x77, 0xAC, 0x97, 0x00, 0x49, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09,
+    0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2,
+    0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x77, 0x49, 0xDA,
+    0x71, 0xF7, 0x1F, 0x72, 0xAC, 0x95, 0x77, 0x71, 0x9F, 0xC7, 0x5D, 0xAA, 0xDA, 0x74, 0xD1, 0xDA,
+    0x77, 0x9D, 0x97, 0x6E, 0x97, 0x7D, 0x77, 0x19, 0x97, 0x72, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97,
+    0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19,
+    0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F,
+    0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x29,
+    0xAD, 0xA7, 0x9F, 0xD6, 0xAC, 0xA0, 0x9D, 0x7A, 0x90, 0x9D, 0x71, 0xAD, 0x97, 0x0A, 0xCA, 0x73,
+    0xC7, 0x77, 0x29, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49,
+    0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9,
+    0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x76, 0xC7, 0x71, 0xAD, 0x77, 0x9D,
+    0xA7, 0x39, 0x91, 0xDA, 0x72, 0x9E, 0x90, 0xC9, 0x73, 0xFC, 0x97, 0x4D, 0xA0, 0xAD, 0x73, 0x9A,
+    0x92, 0x99, 0x77, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9,
+    0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99,
+    0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9,
+    0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x71, 0x97, 0x4D, 0x97, 0x19, 0xDA, 0x71, 0xE7,
+    0x2D, 0x69, 0x9A, 0x1C, 0x69, 0xF7, 0x0F, 0xD6, 0xAD, 0x09, 0xDA, 0x49, 0xD9, 0x19, 0xC9, 0x77,
+    0x69, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7,
+    0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF,
+    0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x73, 0xC7, 0x71, 0xDA, 0x77, 0x0A, 0xD9, 0x75,
+    0x99, 0x0A, 0xD7, 0x39, 0xE9, 0x09, 0xC7, 0x3F, 0xC9, 0x74, 0xDA, 0x0A, 0xD7, 0x39, 0xA9, 0x29,
+    0x97, 0x79, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D,
+    0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F,
+    0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF,
+    0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00, 0x79, 0x73, 0xAC, 0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x29,
+    0xD6, 0x99, 0xA1, 0xAC, 0x59, 0xF7, 0x0F, 0xD6, 0xAD, 0x09, 0xDA, 0x49, 0xD9, 0x19, 0xC9, 0x77,
+    0x69, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7,
+    0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF,
+    0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x73, 0xAD, 0xA7, 0x6D, 0xAD, 0x97, 0x59, 0xA0,
+    0xD7, 0x49, 0x91, 0xD9, 0x72, 0x9E, 0x90, 0xC9, 0x73, 0xFC, 0x97, 0x4D, 0xA0, 0xAD, 0x73, 0x9A,
+    0x92, 0x99, 0x77, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9,
+    0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99,
+    0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9,
+    0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x71, 0x97, 0x2F, 0xA7, 0xAC, 0xA9, 0xD7, 0x9A,
+    0x1D, 0x71, 0x9D, 0x94, 0x99, 0xA1, 0xD5, 0x9F, 0x09, 0x95, 0xFD, 0x6A, 0xD0, 0x9D, 0xA4, 0x9D,
+    0x91, 0x9C, 0x97, 0x76, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F, 0x29, 0xE2,
+    0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F, 0x2F, 0x99,
+    0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92, 0x5A, 0xD9, 0x09, 0xC7, 0x3F,
+    0xCA, 0xD9, 0x72, 0xAC, 0x1A, 0xE7, 0x77, 0x71, 0x9E, 0x97, 0x59, 0xFC, 0xA7, 0x39, 0xDA, 0x0A,
+    0xD9, 0x72, 0x9A, 0x92, 0x9A, 0x77, 0x9A, 0xA7, 0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7,
+    0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2,
+    0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F,
+    0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0, 0x19, 0xD9, 0x1A, 0x6F, 0xA9,
+    0xCA, 0x49, 0xD9, 0xFA, 0x5A, 0x91, 0xDA, 0x77, 0x6F, 0x70, 0xAF, 0xC6, 0xAD, 0x99, 0xE4, 0x9D,
+    0x92, 0xD7, 0x76, 0x99, 0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F, 0x29, 0xE2, 0xF4,
+    0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F, 0x2F, 0x99, 0xAF,
+    0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99, 0x39, 0x92, 0x77, 0x73, 0xE7, 0x7F, 0xC9, 0x74,
+    0xAD, 0x9E, 0x73, 0xAD, 0x91, 0xE7, 0x2A, 0xC4, 0xA9, 0x77, 0x77, 0x29, 0xAA, 0x77, 0xF7, 0x69,
+    0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D, 0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72,
+    0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F, 0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6,
+    0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF, 0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF,
+    0x77, 0x77, 0x77, 0x9E, 0x77, 0xF9, 0x76, 0xAE, 0x97, 0x7A, 0xC9, 0x70, 0x59, 0x72, 0xAD, 0xA7,
+    0x1F, 0x97, 0xDA, 0xAD, 0x6A, 0xD1, 0xE5, 0xD3, 0xCA, 0x77, 0x69, 0x99, 0x79, 0xFD, 0xA4, 0xAF,
+    0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF,
+    0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93,
+    0x99, 0x77, 0x49, 0xDA, 0x71, 0xF7, 0x1F, 0x72, 0xAC, 0x95, 0x71, 0xC9, 0x77, 0x0A, 0xD7, 0x70,
+    0xD9, 0x74, 0x9A, 0x0A, 0xC9, 0x0A, 0x73, 0xD9, 0x29, 0xC9, 0x72, 0xAF, 0xE7, 0x4A, 0xFA, 0x77,
+    0x77, 0x49, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D,
+    0xA0, 0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F,
+    0x97, 0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF,
+    0xD3, 0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x00, 0x77, 0x4C, 0x97, 0x2E, 0x71, 0x9D, 0xA7, 0x1D, 0xA7,
+    0x2A, 0x97, 0x0C, 0xA3, 0x9C, 0x49, 0xDA, 0x99, 0xAD, 0x5F, 0xE7, 0x9A, 0xCA, 0x97, 0x77, 0x09,
+    0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99,
+    0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1,
+    0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20, 0x7C, 0x77, 0x1A, 0xCA, 0x77, 0x09, 0xD7, 0x69, 0xA0,
+    0x9C, 0xA0, 0xA7, 0x3D, 0x92, 0x9C, 0x97, 0x2A, 0xFE, 0x74, 0xAF, 0xA7, 0x77, 0x74, 0x9A, 0xA7,
+    0x7F, 0x76, 0x9F, 0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD,
+    0x90, 0xF7, 0x2E, 0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6,
+    0xAF, 0xFF, 0x6E, 0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F,
+    0xE9, 0x2F, 0xF0, 0x77, 0x1C, 0x73, 0xE7, 0x29, 0xD9, 0x72, 0x9D, 0x73, 0x9C, 0x70, 0xCA, 0x39,
+    0xC4, 0x9D, 0xA9, 0x9A, 0xD5, 0xFE, 0x79, 0xAC, 0xA9, 0x77, 0x70, 0x99, 0x97, 0x9F, 0xDA, 0x4A,
+    0xFF, 0x92, 0x9E, 0x90, 0x9F, 0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F, 0x4A, 0xFF, 0x3F, 0xCA,
+    0xF2, 0xAE, 0x2F, 0x2F, 0x2F, 0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A, 0xFA, 0x0F, 0x93, 0x99,
+    0x39, 0x92, 0x7A, 0xD9, 0x76, 0xDA, 0xD7, 0x69, 0x90, 0xD7, 0x79, 0xD7, 0x59, 0xC0, 0x9C, 0x1C,
+    0x73, 0xAD, 0x90, 0x9D, 0x74, 0xFD, 0x97, 0x59, 0xAA, 0x97, 0x71, 0x9A, 0xA7, 0x7F, 0x76, 0x9F,
+    0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E,
+    0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E,
+    0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0,
+    0x49, 0xA9, 0x70, 0xAF, 0xA7, 0xD0, 0x9D, 0x70, 0x90, 0x9D, 0x71, 0xE7, 0x2D, 0x70, 0xC9, 0x09,
+    0x19, 0xC4, 0x9D, 0x91, 0x9D, 0x5F, 0xE7, 0x9A, 0xCA, 0x97, 0x77, 0x09, 0x99, 0x79, 0xFD, 0xA4,
+    0xAF, 0xF9, 0x29, 0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC,
+    0xAF, 0x2A, 0xE2, 0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39,
+    0x93, 0x99, 0x20, 0x5D, 0xA1, 0x9A, 0x73, 0xFC, 0xAD, 0x73, 0xAC, 0x09, 0xEA, 0x77, 0x29, 0x73,
+    0xAC, 0x39, 0xC9, 0x72, 0xEA, 0xAE, 0x74, 0xAF, 0xA7, 0x77, 0x74, 0x9A, 0xA7, 0x7F, 0x76, 0x9F,
+    0x97, 0x5F, 0xD7, 0x5F, 0xD7, 0x4A, 0xD9, 0xE9, 0x73, 0xDA, 0x0F, 0x72, 0xAD, 0x90, 0xF7, 0x2E,
+    0x19, 0xEA, 0x70, 0x9D, 0xA2, 0xF7, 0x0E, 0x99, 0x99, 0xF9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFF, 0x6E,
+    0x5F, 0x94, 0x9D, 0xA5, 0x9F, 0x4E, 0x96, 0xF9, 0x1A, 0xFD, 0x3A, 0xFE, 0x0F, 0xE9, 0x2F, 0xF0,
+    0x29, 0xA2, 0x96, 0xF9, 0x0D, 0x49, 0xDA, 0xFC, 0x5C, 0xA0, 0x9E, 0x97, 0x73, 0xC9, 0x4C, 0x49,
+    0xDA, 0x19, 0xD5, 0xFE, 0x96, 0xAE, 0xA7, 0x77, 0x09, 0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xF9, 0x29,
+    0xE9, 0x09, 0xF2, 0x9E, 0x2F, 0x49, 0x92, 0xF7, 0x99, 0xF4, 0xAF, 0xF3, 0xFC, 0xAF, 0x2A, 0xE2,
+    0xF2, 0xF2, 0xF2, 0xF9, 0x9A, 0xF9, 0x1A, 0xFF, 0xF1, 0xAF, 0xA0, 0xF9, 0x39, 0x93, 0x99, 0x20,
+    0x5A, 0x49, 0x73, 0xDA, 0x29, 0xC9, 0x72, 0xAF, 0xE7, 0x4F, 0xD9, 0x75, 0x9A, 0xA9, 0x77, 0x77,
+    0x59, 0xAA, 0x77, 0xF7, 0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFD, 0x74, 0xAD, 0x9E, 0x97, 0x3D, 0xA0,
+    0xF7, 0x2A, 0xD9, 0x0F, 0x72, 0xE1, 0x9E, 0xA7, 0x09, 0xDA, 0x2F, 0x70, 0xE9, 0x99, 0x9F, 0x97,
+    0xFF, 0xEA, 0x6A, 0xFF, 0xF6, 0xE5, 0xF9, 0x49, 0xDA, 0x59, 0xF4, 0xE9, 0x6F, 0x91, 0xAF, 0xD3,
+    0xAF, 0xE0, 0xFE, 0x92, 0xFF, 0x77, 0x77, 0x77, 0x9E, 0x77, 0xF9, 0x76, 0xAE, 0x97, 0x7A, 0xC9,
+    0x70, 0x77, 0xD3, 0x9C, 0x49, 0xE9, 0x9A, 0xCA, 0x5A, 0xFD, 0x79, 0xAC, 0xA9, 0x77, 0x70, 0x99,
+    0x97, 0x9F, 0xDA, 0x4A, 0xFF, 0x92, 0x9E, 0x90, 0x9F, 0x29, 0xE2, 0xF4, 0x99, 0x2F, 0x79, 0x9F,
+    0x4A, 0xFF, 0x3F, 0xCA, 0xF2, 0xAE, 0x2F, 0x2F, 0x2F, 0x2F, 0x99, 0xAF, 0x91, 0xAF, 0xFF, 0x1A,
+    0xFA, 0x0F, 0x93, 0x99, 0x39, 0x97, 0x74, 0x9D, 0xA7, 0x1F, 0x71, 0xF7, 0x2A, 0xC9, 0x50, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E, 0x3F,
+    0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9, 0x5F,
+    0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xCA, 0x77, 0x77, 0x69, 0xE7, 0x3F, 0x97, 0x2F, 0x74, 0xAC, 0x95, 0x59, 0x99, 0x7A, 0xFC, 0xA4,
+    0xFF, 0xC2, 0xEA, 0x1A, 0xE9, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA,
+    0x0E, 0xA7, 0x0F, 0x70, 0xF9, 0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD, 0x92, 0xAF, 0xE9, 0x69,
+    0x99, 0x77, 0x59, 0xDA, 0x70, 0xF7, 0x0F, 0x71, 0xAC, 0x93, 0x77, 0x49, 0xFA, 0x71, 0xDA, 0xAD,
+    0x97, 0x0D, 0x1D, 0xA7, 0x39, 0xD7, 0x29, 0xE7, 0x4C, 0xA7, 0x59, 0x70, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29, 0xE3, 0xF4, 0x9D, 0x3F, 0x5C,
+    0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA, 0x95, 0xF7, 0x3F, 0x59, 0x4F,
+    0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1, 0xFF, 0xFC, 0xA0, 0x4A, 0xDA,
+    0x96, 0xFD, 0x95, 0xD1, 0xDA, 0x59, 0xA1, 0xD9, 0x79, 0xDA, 0x79, 0xD9, 0x71, 0xCA, 0x77, 0x79,
+    0x99, 0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xEA, 0x1A, 0xE9, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F,
+    0xFE, 0xA0, 0xFF, 0xEA, 0x0E, 0xA7, 0x0F, 0x70, 0xF9, 0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD,
+    0x92, 0xAF, 0xE9, 0x69, 0x99, 0x30, 0x49, 0xA9, 0x73, 0xAE, 0xA0, 0xD7, 0xFF, 0x7D, 0x09, 0xEA,
+    0x74, 0x99, 0x77, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC,
+    0x3F, 0x92, 0x9E, 0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F,
+    0xAA, 0xAA, 0xA9, 0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x39, 0xA9, 0x19, 0x94, 0xAE, 0xA0, 0xD4, 0xFF, 0x4A, 0xC1,
+    0xEA, 0x71, 0x97, 0x76, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E,
+    0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA,
+    0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x75, 0xC7, 0x5A, 0xCA, 0x73, 0x9D,
+    0x96, 0x99, 0x2D, 0x96, 0xAE, 0x90, 0xC9, 0x69, 0xFC, 0x97, 0x9D, 0x90, 0xAD, 0x79, 0xA9, 0x2A,
+    0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9, 0x29,
+    0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA, 0xAA,
+    0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF, 0xC1,
+    0xFF, 0xFC, 0xA0, 0x73, 0x97, 0x39, 0xCA, 0x72, 0xE7, 0x19, 0xD9, 0x71, 0xDA, 0x69, 0xA9, 0x0A,
+    0xA6, 0xF9, 0x7A, 0xFC, 0x95, 0x9D, 0x90, 0xE5, 0xDA, 0x2C, 0xA7, 0x76, 0x99, 0x97, 0x0A, 0xFC,
+    0xA5, 0xFF, 0xC3, 0xEA, 0x1A, 0xE9, 0x19, 0xE3, 0xEA, 0x1E, 0xA3, 0xEA, 0x1F, 0xFE, 0xA1, 0xFF,
+    0xEA, 0x1E, 0xA7, 0x1F, 0x71, 0xF9, 0x70, 0x9F, 0xAA, 0x99, 0xAC, 0x92, 0xFF, 0xD9, 0x3A, 0xFE,
+    0x97, 0x99, 0x94, 0x71, 0x9A, 0x75, 0xD9, 0x74, 0xAD, 0x71, 0x99, 0x1A, 0xCA, 0x7A, 0xE9, 0x0A,
+    0xA6, 0x9F, 0xC9, 0x79, 0xD9, 0x0A, 0xD7, 0x9A, 0x92, 0xA9, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F, 0x92, 0x9E, 0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F,
+    0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA, 0xAA, 0xA9, 0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3,
+    0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x71, 0x97, 0x19,
+    0xD7, 0x19, 0xD9, 0x71, 0xE7, 0x2D, 0x95, 0x9A, 0x91, 0xC5, 0xF9, 0x6A, 0xFC, 0x94, 0x9D, 0x90,
+    0xE4, 0xDA, 0x2C, 0xA7, 0x74, 0x99, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E,
+    0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F,
+    0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0x96, 0x99, 0x93, 0x71, 0x9E, 0x97, 0x2D, 0xAD,
+    0x72, 0xA9, 0x0D, 0x79, 0x91, 0x9D, 0x96, 0xAE, 0x90, 0xC9, 0x69, 0xFC, 0x97, 0x9D, 0x90, 0xAD,
+    0x79, 0xA9, 0x2A, 0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF,
+    0xC3, 0xF9, 0x29, 0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5,
+    0xFA, 0xAA, 0xAA, 0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1,
+    0xAF, 0xFF, 0xC1, 0xFF, 0xFC, 0xA0, 0x72, 0x97, 0x3A, 0xF7, 0x09, 0xD9, 0xD9, 0x70, 0xA9, 0x0D,
+    0x97, 0x19, 0xAC, 0xA6, 0x9A, 0x90, 0xAC, 0x96, 0xF9, 0x0A, 0x6A, 0xFC, 0x96, 0x9D, 0x90, 0xE6,
+    0xDA, 0x2C, 0xA7, 0x77, 0x09, 0x99, 0x71, 0xAF, 0xCA, 0x6F, 0xFC, 0x4E, 0xA1, 0xAE, 0x92, 0x9E,
+    0x3E, 0xA2, 0xEA, 0x3E, 0xA2, 0xFF, 0xEA, 0x2F, 0xFE, 0xA2, 0xEA, 0x72, 0xF7, 0x2F, 0x97, 0x19,
+    0xFA, 0xA9, 0x9A, 0xC9, 0x3F, 0xFD, 0x94, 0xAF, 0xE9, 0x70, 0x99, 0x95, 0x4D, 0xA1, 0xAC, 0x7F,
+    0xCA, 0xD9, 0x6D, 0x1E, 0xA7, 0x77, 0x1A, 0xE9, 0x71, 0x9F, 0xC9, 0x7A, 0xDA, 0x0A, 0xD7, 0xAA,
+    0x92, 0xAA, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x1A, 0xFF, 0xFC, 0x3F,
+    0x92, 0x9E, 0x3F, 0x49, 0xD3, 0xF5, 0xC9, 0x3F, 0x73, 0xF7, 0x3F, 0xFD, 0x5F, 0xFD, 0x5F, 0xAA,
+    0xAA, 0xA9, 0x5F, 0x73, 0xF5, 0x94, 0xF5, 0xD3, 0xF4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAE, 0x1A, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x3A, 0xCA, 0x19, 0x94, 0xAF, 0x9D, 0x4D, 0x9F, 0xC4, 0x9A, 0x1A,
+    0xD7, 0x74, 0xAE, 0x96, 0x9F, 0xC9, 0x49, 0xDA, 0x0E, 0x93, 0xDA, 0x2A, 0xC9, 0x77, 0x39, 0x99,
+    0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xEA, 0x1A, 0xE9, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xEA, 0x0F, 0xFE,
+    0xA0, 0xFF, 0xEA, 0x0E, 0xA7, 0x0F, 0x70, 0xF9, 0x79, 0xFA, 0xA9, 0x9A, 0xC9, 0x1F, 0xFD, 0x92,
+    0xAF, 0xE9, 0x69, 0x99, 0x30, 0x77, 0x6E, 0x73, 0xFC, 0x71, 0xE9, 0xE7, 0xE2, 0xDA, 0x6A, 0xA4,
+    0xA7, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC3, 0xF9,
+    0x29, 0xE3, 0xF4, 0x9D, 0x3F, 0x5C, 0x93, 0xF7, 0x3F, 0x73, 0xFF, 0xD5, 0xFF, 0xD5, 0xFA, 0xAA,
+    0xAA, 0x95, 0xF7, 0x3F, 0x59, 0x4F, 0x5D, 0x3F, 0x4A, 0xD3, 0xFA, 0xAA, 0xAA, 0xE1, 0xAF, 0xFF,
+    0xC1, 0xFF, 0xFC, 0xA7, 0x77, 0x76, 0x9E, 0x73, 0xF9, 0x72, 0xF7, 0x4A, 0xC9, 0x50, 0x77, 0x2E,
+    0x70, 0xFC, 0x6A, 0xD9, 0xDA, 0x5D, 0x90, 0x9D, 0x4A, 0xCA, 0x2A, 0xC7, 0x74, 0x99, 0x97, 0xAF,
+    0xCA, 0x4F, 0xFC, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x3E, 0xA0, 0xEA, 0x3E, 0xA0, 0xFF, 0xEA, 0x0F,
+    0xFE, 0xA0, 0xEA, 0x70, 0xF7, 0x0F, 0x97, 0x9F, 0xAA, 0x99, 0xAC, 0x91, 0xFF, 0xD9, 0x2A, 0xFE,
+    0x96, 0x99, 0x97, 0x75, 0x9D, 0xA7, 0x0F, 0x70, 0xF7, 0x1A, 0xC9, 0x30, 0x73, 0x9F, 0xA3, 0xDA,
+    0xAD, 0xA2, 0xD1, 0xDA, 0x59, 0xD9, 0x39, 0xE9, 0x5D, 0x79, 0x59, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x19, 0xEA, 0x2A, 0xFC, 0xA1, 0xD9, 0x0A, 0xD2, 0xA1, 0xAD, 0x39,
+    0xAD, 0x4D, 0x95, 0x9C, 0x77, 0x6A, 0xFA, 0x19, 0xFC, 0xA3, 0xAE, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3,
+    0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA2, 0xAF, 0xD9, 0x0F, 0xE9,
+    0x09, 0x99, 0x99, 0x99, 0x91, 0xFF, 0x90, 0xAF, 0xDA, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x92, 0xAF, 0xE9, 0x0F, 0xF9, 0x77, 0x69, 0xE5, 0xF9, 0x4F,
+    0x6A, 0xC9, 0x20, 0x39, 0x59, 0xE9, 0x3A, 0xF3, 0xAE, 0xA4, 0x9A, 0x97, 0x75, 0xAF, 0xA1, 0x9F,
+    0xCA, 0x3A, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x39,
+    0xEA, 0x39, 0xEA, 0x2A, 0xFD, 0x90, 0xFE, 0x97, 0x74, 0xAD, 0x49, 0xEA, 0x39, 0xEA, 0x4A, 0xCA,
+    0x20, 0x59, 0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xFA, 0x29, 0xFC, 0x2A, 0xE9,
+    0x5F, 0xA1, 0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F,
+    0x97, 0xF9, 0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F, 0xC4, 0x9F, 0x29, 0xFC, 0xA9,
+    0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x77, 0x70, 0xE9, 0x74, 0x9F, 0x74,
+    0x9E, 0xA7, 0x5A, 0xCA, 0x70, 0x59, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09, 0xF9,
+    0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA, 0x29,
+    0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x77, 0x72, 0xE7, 0x29,
+    0xEA, 0x71, 0x9E, 0x97, 0x2A, 0xCA, 0x50, 0x77, 0x7A, 0xF9, 0x72, 0xAD, 0x9E, 0x72, 0xAC, 0x90,
+    0x9D, 0x76, 0xE7, 0x4A, 0xDA, 0x75, 0xAC, 0x97, 0x79, 0x76, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC,
+    0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9,
+    0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09,
+    0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72,
+    0x99, 0x99, 0x70, 0x49, 0xEA, 0x70, 0xAF, 0xCA, 0x7D, 0x90, 0xAD, 0x70, 0xA1, 0xAD, 0x71, 0x9A,
+    0xD7, 0x2D, 0x97, 0x39, 0xC7, 0x77, 0x39, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09,
+    0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA,
+    0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x75, 0x9A,
+    0x77, 0xD9, 0x75, 0xE7, 0x19, 0x91, 0x9D, 0x71, 0xF0, 0x9C, 0x71, 0xAF, 0xC7, 0x2A, 0xD1, 0xDA,
+    0x71, 0xAA, 0x3A, 0x73, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC, 0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F,
+    0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9, 0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F,
+    0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2,
+    0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x73, 0x97, 0x5D,
+    0x73, 0xAD, 0x97, 0x2E, 0x72, 0x9D, 0x79, 0xAA, 0x09, 0xC7, 0xAE, 0xA7, 0x1F, 0xCA, 0x7E, 0x0A,
+    0xD9, 0x5A, 0xD2, 0xAC, 0x97, 0x77, 0x99, 0x99, 0x70, 0xAF, 0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F,
+    0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2,
+    0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF, 0xDA, 0x71, 0x99, 0x95, 0x72, 0xA9, 0x76,
+    0x9D, 0x77, 0xDA, 0x73, 0x99, 0x1D, 0x97, 0x1F, 0x1C, 0x97, 0x0A, 0xFC, 0x72, 0xAD, 0x1D, 0xA7,
+    0x1A, 0xA3, 0xA7, 0x39, 0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93, 0xFA, 0x29, 0xFC,
+    0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9,
+    0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F, 0xC4, 0x9F, 0x29,
+    0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x71, 0x97, 0x4D, 0x97,
+    0x3E, 0x73, 0xAD, 0x74, 0xAC, 0xA7, 0x9A, 0xA1, 0xAA, 0x6A, 0xEA, 0x71, 0xFC, 0xA7, 0xE0, 0xAD,
+    0x95, 0xAD, 0x2A, 0xC9, 0x77, 0x79, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF, 0xD3, 0xF9, 0x09, 0xF9,
+    0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xFA, 0x29,
+    0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x50, 0x72, 0xAE, 0x74,
+    0x9C, 0xAA, 0xD7, 0x4A, 0x09, 0xCA, 0x71, 0x99, 0x1A, 0xD7, 0x1F, 0x0A, 0xC7, 0x1A, 0xFC, 0x72,
+    0xAD, 0x1D, 0xA7, 0x1A, 0xA3, 0xA7, 0x39, 0xAD, 0xAA, 0x97, 0x0A, 0xFF, 0xC9, 0x5F, 0xFF, 0x93,
+    0xFA, 0x29, 0xFC, 0x2A, 0xE9, 0x5F, 0xA1, 0xF6, 0xAF, 0x09, 0xEA, 0x7F, 0x9A, 0xE9, 0x7F, 0x9F,
+    0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xFA, 0x7F, 0x0A, 0xF7, 0xF0, 0x9F, 0x6A, 0xE9, 0x1F,
+    0xC4, 0x9F, 0x29, 0xFC, 0xA9, 0x9A, 0xF4, 0x9F, 0xFE, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x77,
+    0x79, 0xF9, 0x70, 0xD9, 0xAD, 0x70, 0x9A, 0x09, 0xD7, 0x2A, 0xD6, 0x9A, 0xA0, 0x9C, 0xA6, 0xAE,
+    0xA0, 0xA9, 0x6F, 0xCA, 0x7E, 0x0A, 0xD9, 0x5A, 0xD2, 0xAC, 0x97, 0x77, 0x99, 0x99, 0x70, 0xAF,
+    0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F, 0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F,
+    0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2, 0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF, 0xDA,
+    0x71, 0x99, 0x95, 0x49, 0xDA, 0x1C, 0xA7, 0x09, 0xFC, 0xAD, 0x70, 0x9C, 0xA0, 0x9E, 0x97, 0x77,
+    0x5F, 0x74, 0xFD, 0x72, 0xE1, 0xE7, 0x1A, 0xA3, 0xA9, 0x72, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC,
+    0x95, 0xFF, 0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9,
+    0xAE, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09,
+    0xF6, 0xAE, 0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72,
+    0x99, 0x99, 0x70, 0x3A, 0xCA, 0x2A, 0x69, 0xF9, 0xAC, 0x95, 0xAC, 0xAA, 0xF9, 0x6C, 0x19, 0xDA,
+    0x77, 0x70, 0xEA, 0x71, 0xFD, 0x7E, 0x0A, 0xDA, 0x5A, 0xD2, 0x9C, 0xA7, 0x77, 0x99, 0x99, 0x70,
+    0xAF, 0xDA, 0x5F, 0xFD, 0x3F, 0x90, 0x9F, 0x91, 0x9E, 0x92, 0x9F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F,
+    0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0xA2, 0x9E, 0xA1, 0x9F, 0xA0, 0x9F, 0x3A, 0xFF, 0xC5, 0xAF,
+    0xDA, 0x71, 0x99, 0x95, 0x77, 0x70, 0xAD, 0xA7, 0x49, 0xFA, 0x72, 0x9D, 0xAA, 0xDA, 0x70, 0x9D,
+    0xA1, 0xAD, 0x70, 0x9C, 0xA3, 0xAA, 0x77, 0x74, 0x9A, 0xDA, 0xA9, 0x70, 0xAF, 0xFC, 0x95, 0xFF,
+    0xF9, 0x3F, 0xA2, 0x9F, 0xC2, 0xAE, 0x95, 0xFA, 0x1F, 0x6A, 0xF0, 0x9E, 0xA7, 0xF9, 0xAE, 0x97,
+    0xF9, 0xF9, 0x7F, 0x9F, 0x97, 0xF9, 0xF9, 0x7F, 0x9F, 0xA7, 0xF0, 0xAF, 0x7F, 0x09, 0xF6, 0xAE,
+    0x91, 0xFC, 0x49, 0xF2, 0x9F, 0xCA, 0x99, 0xAF, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x72, 0x99, 0x99,
+    0x77, 0x77, 0x0E, 0x97, 0x49, 0xF7, 0x49, 0xEA, 0x75, 0xAC, 0xA7, 0x77, 0x4E, 0x97, 0x19, 0xF7,
+    0x1D, 0x9E, 0x7D, 0xA1, 0xDA, 0x6D, 0x29, 0xC9, 0x77, 0x79, 0x99, 0x97, 0x0A, 0xFD, 0xA5, 0xFF,
+    0xD3, 0xF9, 0x09, 0xF9, 0x19, 0xE9, 0x29, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1, 0xF4, 0xF1,
+    0xF4, 0xF1, 0xFA, 0x29, 0xEA, 0x19, 0xFA, 0x09, 0xF3, 0xAF, 0xFC, 0x5A, 0xFD, 0xA7, 0x19, 0x99,
+    0x77, 0x72, 0xE7, 0x29, 0xEA, 0x71, 0x9E, 0x97, 0x2A, 0xCA, 0x50, 0x77, 0x74, 0xAC, 0x77, 0xEA,
+    0x74, 0xAF, 0x97, 0x39, 0xF9, 0x29, 0xAA, 0x7A, 0x95, 0xEA, 0x76, 0xEA, 0x59, 0xAE, 0xA9, 0x1E,
+    0x93, 0xAF, 0xFF, 0xA3, 0xFF, 0xFC, 0xA3, 0xFA, 0x29, 0xFC, 0x3A, 0xE9, 0x5F, 0xA2, 0xF6, 0xAF,
+    0x19, 0xEA, 0x7F, 0x90, 0xAE, 0x97, 0xF9, 0x0F, 0x97, 0xF9, 0x0F, 0x97, 0xF9, 0x0F, 0x97, 0xF9,
+    0x0F, 0xA7, 0xF1, 0xAF, 0x7F, 0x19, 0xF6, 0xAE, 0x92, 0xFC, 0x49, 0xF3, 0x9F, 0xCA, 0x99, 0xAF,
+    0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x39, 0x99, 0x97, 0x00, 0x7A, 0x97, 0x5D, 0x97, 0x3E, 0x97,
+    0x29, 0xDA, 0x73, 0xDA, 0x74, 0x9A, 0x29, 0xDA, 0x74, 0xE6, 0x99, 0x99, 0x09, 0xE4, 0xAF, 0xFC,
+    0x93, 0xFF, 0xD9, 0x3F, 0x90, 0x9F, 0x92, 0x9E, 0x92, 0x9F, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0x4F,
+    0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0xA2, 0x9E, 0xA2, 0x9F, 0xA0, 0x9F, 0x4A, 0xFF, 0xC6, 0xAF, 0xDA,
+    0x72, 0x99, 0x96, 0x77, 0x7A, 0xC7, 0x70, 0xEA, 0x76, 0xFC, 0x76, 0xAF, 0x39, 0xAA, 0x71, 0x9A,
+    0x3E, 0xA7, 0x6E, 0xA5, 0x9A, 0xEA, 0x91, 0xE9, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x3F, 0xA2,
+    0x9F, 0xC3, 0xAE, 0x95, 0xFA, 0x2F, 0x6A, 0xF1, 0x9E, 0xA7, 0xF9, 0x0A, 0xE9, 0x7F, 0x90, 0xF9,
+    0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xFA, 0x7F, 0x1A, 0xF7, 0xF1, 0x9F, 0x6A, 0xE9,
+    0x2F, 0xC4, 0x9F, 0x39, 0xFC, 0xA9, 0x9A, 0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99,
+    0x70, 0x4A, 0x75, 0xE7, 0x4E, 0xA7, 0x4E, 0x97, 0x4A, 0xD7, 0x59, 0xA1, 0x9D, 0xA7, 0x4E, 0x69,
+    0x99, 0x90, 0x9E, 0x4A, 0xFF, 0xC9, 0x3F, 0xFD, 0x93, 0xF9, 0x09, 0xF9, 0x29, 0xE9, 0x29, 0xF2,
+    0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xFA, 0x29, 0xEA, 0x29, 0xFA, 0x09,
+    0xF4, 0xAF, 0xFC, 0x6A, 0xFD, 0xA7, 0x29, 0x99, 0x60, 0x77, 0x70, 0xAF, 0x97, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xC9, 0x09, 0xD7, 0x7E, 0x75, 0xAD, 0xA3, 0x9A, 0xA7, 0xAC, 0x94, 0xEA, 0x79, 0x5E, 0xA5,
+    0x9A, 0xEA, 0x91, 0xE9, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x3F, 0xA2, 0x9F, 0xC3, 0xAE, 0x95,
+    0xFA, 0x2F, 0x6A, 0xF1, 0x9E, 0xA7, 0xF9, 0x0A, 0xE9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9, 0x7F,
+    0x90, 0xF9, 0x7F, 0x90, 0xFA, 0x7F, 0x1A, 0xF7, 0xF1, 0x9F, 0x6A, 0xE9, 0x2F, 0xC4, 0x9F, 0x39,
+    0xFC, 0xA9, 0x9A, 0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x70, 0x49, 0xEA, 0x71,
+    0xAF, 0xCA, 0x70, 0xD9, 0x0A, 0xD7, 0x1A, 0x1A, 0xD7, 0x29, 0xAD, 0x73, 0xD9, 0x74, 0x9C, 0x29,
+    0xDA, 0x74, 0xE6, 0x99, 0x99, 0x09, 0xE4, 0xAF, 0xFC, 0x93, 0xFF, 0xD9, 0x3F, 0x90, 0x9F, 0x92,
+    0x9E, 0x92, 0x9F, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0x4F, 0x2F, 0xA2, 0x9E,
+    0xA2, 0x9F, 0xA0, 0x9F, 0x4A, 0xFF, 0xC6, 0xAF, 0xDA, 0x72, 0x99, 0x96, 0x59, 0x92, 0x97, 0x3F,
+    0x90, 0xD7, 0x19, 0xFF, 0x72, 0xCA, 0x0A, 0xE9, 0x19, 0xAA, 0x71, 0x99, 0x3E, 0xA7, 0x6E, 0xA5,
+    0x9A, 0xEA, 0x91, 0xE9, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x3F, 0xA2, 0x9F, 0xC3, 0xAE, 0x95,
+    0xFA, 0x2F, 0x6A, 0xF1, 0x9E, 0xA7, 0xF9, 0x0A, 0xE9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9, 0x7F,
+    0x90, 0xF9, 0x7F, 0x90, 0xFA, 0x7F, 0x1A, 0xF7, 0xF1, 0x9F, 0x6A, 0xE9, 0x2F, 0xC4, 0x9F, 0x39,
+    0xFC, 0xA9, 0x9A, 0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x70, 0x4A, 0xA2, 0x97,
+    0x0F, 0x09, 0xCA, 0x6A, 0xFE, 0xA6, 0x9C, 0x90, 0xAE, 0x75, 0x90, 0x9D, 0xA7, 0x4E, 0x69, 0x99,
+    0x90, 0x9E, 0x4A, 0xFF, 0xC9, 0x3F, 0xFD, 0x93, 0xF9, 0x09, 0xF9, 0x29, 0xE9, 0x29, 0xF2, 0xF4,
+    0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xFA, 0x29, 0xEA, 0x29, 0xFA, 0x09, 0xF4,
+    0xAF, 0xFC, 0x6A, 0xFD, 0xA7, 0x29, 0x99, 0x60, 0x76, 0x9A, 0xA7, 0x7E, 0xA7, 0x6E, 0xA5, 0x9A,
+    0xEA, 0x91, 0xE9, 0x3A, 0xFF, 0xFA, 0x3F, 0xFF, 0xCA, 0x3F, 0xA2, 0x9F, 0xC3, 0xAE, 0x95, 0xFA,
+    0x2F, 0x6A, 0xF1, 0x9E, 0xA7, 0xF9, 0x0A, 0xE9, 0x7F, 0x90, 0xF9, 0x7F, 0x90, 0xF9, 0x7F, 0x90,
+    0xF9, 0x7F, 0x90, 0xFA, 0x7F, 0x1A, 0xF7, 0xF1, 0x9F, 0x6A, 0xE9, 0x2F, 0xC4, 0x9F, 0x39, 0xFC,
+    0xA9, 0x9A, 0xF5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x77, 0x77, 0x2E, 0x97, 0x59,
+    0xF7, 0x59, 0xEA, 0x76, 0xAC, 0xA7, 0x00, 0x77, 0x72, 0x9D, 0xA7, 0x4E, 0x69, 0x99, 0x90, 0x9E,
+    0x4A, 0xFF, 0xC9, 0x3F, 0xFD, 0x93, 0xF9, 0x09, 0xF9, 0x29, 0xE9, 0x29, 0xF2, 0xF4, 0xF2, 0xF4,
+    0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xF4, 0xF2, 0xFA, 0x29, 0xEA, 0x29, 0xFA, 0x09, 0xF4, 0xAF, 0xFC,
+    0x6A, 0xFD, 0xA7, 0x29, 0x99, 0x77, 0x74, 0xE7, 0x39, 0xEA, 0x72, 0x9E, 0x97, 0x3A, 0xCA, 0x60,
+    0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xF1, 0x9F, 0xEA, 0x9F, 0xE9, 0x2A,
+    0xFC, 0xA2, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93,
+    0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6,
+    0xE9, 0x39, 0xF5, 0x9E, 0x94, 0xF5, 0xAE, 0x5F, 0x94, 0xF5, 0xAF, 0xA9, 0x9A, 0xF9, 0x6F, 0xFE,
+    0xA7, 0x0A, 0xFF, 0x97, 0x49, 0x99, 0x97, 0x77, 0x73, 0xAD, 0xA7, 0x7F, 0x77, 0xF7, 0x79, 0xCA,
+    0x97, 0x77, 0x1A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF,
+    0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x97, 0x77, 0x29, 0xDA, 0x74, 0xF7, 0x4F, 0x74,
+    0x9D, 0x96, 0x77, 0x72, 0x9F, 0xA7, 0x5D, 0xAA, 0xD9, 0x74, 0xD1, 0xD9, 0x77, 0xAD, 0x76, 0x9D,
+    0xA7, 0x79, 0xCA, 0x77, 0x19, 0x72, 0x99, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0x19, 0xFE, 0xA9, 0xFE, 0x92, 0xAF, 0xCA, 0x29, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA,
+    0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93,
+    0x9E, 0xA6, 0xE9, 0x39, 0xEA, 0x6E, 0x93, 0x9F, 0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xF9, 0x4F, 0x5A,
+    0xFA, 0x99, 0xAF, 0x96, 0xFF, 0xEA, 0x70, 0xAF, 0xF9, 0x74, 0x99, 0x99, 0x70, 0x5A, 0xDA, 0x97,
+    0x2F, 0xD7, 0x2D, 0x1D, 0x97, 0x19, 0xA1, 0xD9, 0x73, 0x9D, 0xA7, 0x39, 0xD7, 0x6C, 0x97, 0x77,
+    0x77, 0x2A, 0xF2, 0xAF, 0x2A, 0xFC, 0x1A, 0xFC, 0x39, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9,
+    0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x77, 0x77, 0x9C, 0x97, 0x70, 0xAE, 0x76, 0x9F,
+    0xA7, 0x6F, 0xA3, 0x9A, 0xA7, 0x0A, 0x96, 0xEA, 0x77, 0x0E, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x29,
+    0x99, 0x9A, 0xE9, 0xAF, 0xF1, 0x9F, 0xE9, 0x09, 0xFE, 0x92, 0xAF, 0xC4, 0x9E, 0xA6, 0xE9, 0x49,
+    0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E,
+    0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xF5, 0x9E, 0x95, 0xF5,
+    0xAE, 0x6F, 0x94, 0xF6, 0xAF, 0xA9, 0x9A, 0xF9, 0x7F, 0xFE, 0xA7, 0x1A, 0xFF, 0x97, 0x59, 0x99,
+    0x97, 0x00, 0x79, 0xA7, 0x6D, 0xA7, 0x4A, 0xDA, 0x73, 0x9E, 0x74, 0xAD, 0x76, 0xA4, 0xE7, 0x5E,
+    0xA7, 0x4E, 0x90, 0xAF, 0x2A, 0xFC, 0xA0, 0xAF, 0xC1, 0xAF, 0xC9, 0x29, 0xF2, 0x9F, 0x4F, 0x3F,
+    0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92, 0xF4, 0xAF, 0xAA, 0xFC,
+    0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x77, 0x72, 0x9C, 0x97, 0x71,
+    0xAD, 0xA7, 0x70, 0xAF, 0x97, 0x79, 0xF4, 0x9A, 0xA7, 0x29, 0xA4, 0xEA, 0x77, 0x0E, 0xA0, 0x99,
+    0x99, 0x99, 0x99, 0x29, 0x99, 0x9A, 0xE9, 0xAF, 0xF1, 0x9F, 0xE9, 0x09, 0xFE, 0x92, 0xAF, 0xC4,
+    0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6,
+    0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49,
+    0xF5, 0x9E, 0x95, 0xF5, 0xAE, 0x6F, 0x94, 0xF6, 0xAF, 0xA9, 0x9A, 0xF9, 0x7F, 0xFE, 0xA7, 0x1A,
+    0xFF, 0x97, 0x59, 0x99, 0x97, 0x00, 0x4A, 0x76, 0xAD, 0x75, 0xAD, 0xA7, 0x5E, 0xA7, 0x5A, 0xD7,
+    0x69, 0xA3, 0xE7, 0x5E, 0xA7, 0x4E, 0x90, 0xAF, 0x2A, 0xFC, 0xA0, 0xAF, 0xC1, 0xAF, 0xC9, 0x29,
+    0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x92,
+    0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x93, 0x77,
+    0x73, 0x9F, 0xA7, 0x6D, 0xAA, 0xD9, 0x75, 0xD1, 0xD9, 0x77, 0x0A, 0xD7, 0x79, 0xDA, 0x49, 0xAA,
+    0x70, 0x9C, 0xA5, 0xEA, 0x70, 0x96, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0xAE, 0x9A,
+    0xFF, 0x19, 0xFE, 0x90, 0x9F, 0xE9, 0x2A, 0xFC, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49,
+    0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E,
+    0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9F, 0x59, 0xE9, 0x5F, 0x5A, 0xE6, 0xF9, 0x4F,
+    0x6A, 0xFA, 0x99, 0xAF, 0x97, 0xFF, 0xEA, 0x71, 0xAF, 0xF9, 0x75, 0x99, 0x99, 0x70, 0x49, 0xAD,
+    0xA7, 0x29, 0xFD, 0x71, 0xAC, 0xA0, 0x9D, 0x72, 0xA9, 0x0A, 0xD7, 0x4A, 0xD9, 0x73, 0xDA, 0x75,
+    0x9C, 0x4E, 0x75, 0xEA, 0x74, 0xE9, 0x0A, 0xF2, 0xAF, 0xCA, 0x0A, 0xFC, 0x1A, 0xFC, 0x92, 0x9F,
+    0x29, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF9, 0x2F,
+    0x4A, 0xFA, 0xAF, 0xC5, 0xFF, 0xFC, 0x92, 0x9F, 0xCA, 0x0F, 0xC5, 0x99, 0x92, 0x99, 0x30, 0x69,
+    0xA9, 0x19, 0x75, 0xAE, 0xA0, 0xD7, 0x4F, 0xF7, 0x4D, 0x09, 0xEA, 0x29, 0xAA, 0x73, 0x99, 0x3E,
+    0xA7, 0x70, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0xAE, 0x9A, 0xFF, 0x19, 0xFE, 0x90,
+    0x9F, 0xE9, 0x2A, 0xFC, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E,
+    0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9,
+    0x49, 0xEA, 0x6E, 0x94, 0x9F, 0x59, 0xE9, 0x5F, 0x5A, 0xE6, 0xF9, 0x4F, 0x6A, 0xFA, 0x99, 0xAF,
+    0x97, 0xFF, 0xEA, 0x71, 0xAF, 0xF9, 0x75, 0x99, 0x99, 0x70, 0x4A, 0xA2, 0x97, 0x1F, 0x99, 0xCA,
+    0x79, 0xFE, 0xA7, 0x0C, 0x90, 0xAE, 0x97, 0x59, 0x2E, 0x75, 0xEA, 0x74, 0xE9, 0x0A, 0xF2, 0xAF,
+    0xCA, 0x0A, 0xFC, 0x1A, 0xFC, 0x92, 0x9F, 0x29, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF3,
+    0xF4, 0xF3, 0xF4, 0xF3, 0xF4, 0xF9, 0x2F, 0x4A, 0xFA, 0xAF, 0xC5, 0xFF, 0xFC, 0x92, 0x9F, 0xCA,
+    0x0F, 0xC5, 0x99, 0x92, 0x99, 0x30, 0x77, 0x09, 0xAA, 0x77, 0x1E, 0xA7, 0x70, 0xEA, 0x09, 0x99,
+    0x99, 0x99, 0x92, 0x99, 0x99, 0xAE, 0x9A, 0xFF, 0x19, 0xFE, 0x90, 0x9F, 0xE9, 0x2A, 0xFC, 0x49,
+    0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E,
+    0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9E, 0xA6, 0xE9, 0x49, 0xEA, 0x6E, 0x94, 0x9F,
+    0x59, 0xE9, 0x5F, 0x5A, 0xE6, 0xF9, 0x4F, 0x6A, 0xFA, 0x99, 0xAF, 0x97, 0xFF, 0xEA, 0x71, 0xAF,
+    0xF9, 0x75, 0x99, 0x99, 0x77, 0x77, 0x5A, 0xDA, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x09, 0xCA, 0x97,
+    0x00, 0x77, 0x75, 0xE7, 0x5E, 0xA7, 0x4E, 0x90, 0xAF, 0x2A, 0xFC, 0xA0, 0xAF, 0xC1, 0xAF, 0xC9,
+    0x29, 0xF2, 0x9F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F, 0x3F, 0x4F,
+    0x92, 0xF4, 0xAF, 0xAA, 0xFC, 0x5F, 0xFF, 0xC9, 0x29, 0xFC, 0xA0, 0xFC, 0x59, 0x99, 0x29, 0x97,
+    0x77, 0x29, 0xDA, 0x74, 0xF7, 0x4F, 0x74, 0x9D, 0x96, 0x77, 0x69, 0xC9, 0x76, 0xEA, 0x75, 0xFC,
+    0x75, 0xAF, 0x77, 0x9A, 0x77, 0x71, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0xA0,
+    0x9F, 0xDA, 0x9F, 0xDA, 0x2A, 0xFA, 0x2A, 0xF4, 0xEA, 0x4F, 0x92, 0x9E, 0x59, 0xF2, 0xE9, 0x6F,
+    0x90, 0x9D, 0xA7, 0x0F, 0x0E, 0x71, 0xAE, 0xAD, 0xA7, 0x2F, 0xD7, 0x39, 0xF9, 0x74, 0xF7, 0x5F,
+    0x75, 0xF7, 0x5F, 0x75, 0xF9, 0x72, 0xFF, 0xA7, 0x9F, 0xFA, 0x30, 0x4A, 0x76, 0xAD, 0x75, 0xAE,
+    0x75, 0xEA, 0x75, 0xAD, 0x76, 0x9A, 0x77, 0x77, 0x71, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF,
+    0xA2, 0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E,
+    0x7A, 0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74,
+    0x9D, 0xA7, 0x4E, 0x73, 0xAE, 0xA7, 0xAF, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x09,
+    0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x90, 0xAF, 0xEA, 0x09, 0xFD, 0xA9, 0xFD, 0xA2, 0xAF, 0xA2,
+    0xAF, 0x4E, 0xA4, 0xF9, 0x29, 0xE5, 0x9F, 0x2E, 0x96, 0xF9, 0x09, 0xDA, 0x70, 0xF0, 0xE7, 0x1A,
+    0xEA, 0xDA, 0x72, 0xFD, 0x73, 0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x2F,
+    0xFA, 0x79, 0xFF, 0xA7, 0x77, 0x77, 0x6A, 0xDA, 0x75, 0xF7, 0x5F, 0x75, 0x9C, 0xA7, 0x9F, 0xE1,
+    0xFD, 0x09, 0xFD, 0xA1, 0xAF, 0xA2, 0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xDA, 0x5A,
+    0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A, 0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71, 0xFD, 0x97, 0x19, 0xFC,
+    0x73, 0xFA, 0x73, 0x9E, 0x74, 0x9D, 0xA7, 0x4E, 0x1A, 0xAA, 0x6A, 0xEA, 0x0A, 0xE9, 0x1A, 0xFD,
+    0xA1, 0xAE, 0x91, 0xAF, 0xCA, 0x3E, 0x3A, 0xDA, 0x73, 0x77, 0x7A, 0xF9, 0x72, 0x9D, 0xAA, 0xD7,
+    0x29, 0xCA, 0x09, 0xD9, 0x75, 0xAD, 0x74, 0xAD, 0xA7, 0x5A, 0xC9, 0x77, 0x97, 0x19, 0x99, 0x99,
+    0x99, 0x29, 0x99, 0x99, 0x90, 0xAF, 0xEA, 0x09, 0xFD, 0xA9, 0xFD, 0xA2, 0xAF, 0xA2, 0xAF, 0x4E,
+    0xA4, 0xF9, 0x29, 0xE5, 0x9F, 0x2E, 0x96, 0xF9, 0x09, 0xDA, 0x70, 0xF0, 0xE7, 0x1A, 0xEA, 0xDA,
+    0x72, 0xFD, 0x73, 0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x2F, 0xFA, 0x79,
+    0xFF, 0xA3, 0x49, 0xAD, 0xA7, 0x29, 0xFD, 0x71, 0xAC, 0xA0, 0x9D, 0x72, 0xA9, 0x09, 0xD7, 0x4A,
+    0xD9, 0x73, 0xAC, 0xA7, 0x59, 0xC7, 0x77, 0x77, 0x29, 0xFE, 0x1F, 0xD0, 0x9F, 0xDA, 0x1A, 0xFA,
+    0x2F, 0x93, 0xAD, 0xA3, 0x9E, 0xA3, 0xE5, 0xF2, 0x9D, 0xA5, 0xAE, 0x91, 0xE9, 0x6E, 0xA1, 0xE7,
+    0xAE, 0x0A, 0xD9, 0x70, 0xE9, 0xE7, 0x1F, 0xD9, 0x71, 0x9F, 0xC7, 0x3F, 0xA7, 0x39, 0xE7, 0x49,
+    0xDA, 0x74, 0xE7, 0x3A, 0xEA, 0x7A, 0xFD, 0xA7, 0x0A, 0xFC, 0xA7, 0x2A, 0xDA, 0x73, 0x59, 0x92,
+    0x97, 0x2F, 0x90, 0xD7, 0x09, 0xFF, 0x71, 0xCA, 0x0A, 0xE9, 0x76, 0x97, 0x77, 0x19, 0x99, 0x99,
+    0x99, 0x29, 0x99, 0x99, 0x90, 0xAF, 0xEA, 0x09, 0xFD, 0xA9, 0xFD, 0xA2, 0xAF, 0xA2, 0xAF, 0x4E,
+    0xA4, 0xF9, 0x29, 0xE5, 0x9F, 0x2E, 0x96, 0xF9, 0x09, 0xDA, 0x70, 0xF0, 0xE7, 0x1A, 0xEA, 0xDA,
+    0x72, 0xFD, 0x73, 0x9F, 0x97, 0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x2F, 0xFA, 0x79,
+    0xFF, 0xA3, 0x4A, 0xA2, 0x97, 0x1F, 0x90, 0xD7, 0x9F, 0xF7, 0x0C, 0xA0, 0x9E, 0x97, 0x59, 0x77,
+    0x77, 0x70, 0x9F, 0xE1, 0xFD, 0x09, 0xFD, 0xA1, 0xAF, 0xA2, 0xF9, 0x3A, 0xDA, 0x39, 0xEA, 0x3E,
+    0x5F, 0x29, 0xDA, 0x5A, 0xE9, 0x1E, 0x96, 0xEA, 0x1E, 0x7A, 0xE0, 0xAD, 0x97, 0x0E, 0x9E, 0x71,
+    0xFD, 0x97, 0x19, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x74, 0x9D, 0xA7, 0x4E, 0x73, 0xAE, 0xA7, 0xAF,
+    0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x19, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA1, 0x6C, 0x1C, 0x1A, 0xDA,
+    0x2D, 0x2F, 0x19, 0xA9, 0x92, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A,
+    0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x97, 0x73, 0xC9, 0x6C,
+    0xA0, 0x99, 0x99, 0x99, 0xCA, 0xCA, 0xAA, 0xAA, 0xE3, 0x9C, 0x0C, 0x2A, 0xA1, 0xC1, 0x9A, 0x2C,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x69, 0x60,
+    0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x99, 0x99, 0xDA, 0xAA, 0xAA, 0xC0, 0xC9, 0x3C, 0x1A, 0xA2,
+    0xC2, 0xA9, 0x1C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x69, 0x0A, 0xFD, 0x90, 0xFE, 0xA0, 0xFE, 0x90, 0x0A, 0xFD, 0x90, 0xFE, 0xA0, 0xFE,
+    0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xF0, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFF, 0xAF, 0xFF, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x92, 0x99,
+    0x0E, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE,
+    0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A,
+    0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA,
+    0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAE, 0x1A, 0xDA, 0xE1, 0xAD, 0xAA, 0xAA, 0x19, 0xAA,
+    0x90, 0xFF, 0xF9, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x4F, 0xFF, 0x9F, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x29, 0x92, 0x9D, 0x2D, 0xA1, 0xAD, 0x2E, 0x2E, 0x2E,
+    0xA1, 0xAD, 0xA6, 0x19, 0x92, 0xAE, 0x19, 0xE2, 0xE2, 0xE2, 0xDA, 0x1A, 0xD2, 0xD9, 0x70, 0x6A,
+    0xDA, 0x1A, 0xE2, 0xE2, 0xE2, 0xDA, 0x19, 0xD2, 0xD9, 0x29, 0x92, 0x19, 0x92, 0xAE, 0x1E, 0xA1,
+    0xE2, 0xE2, 0x9D, 0x92, 0xDA, 0x3D, 0x60, 0x29, 0x92, 0x99, 0x29, 0xD1, 0x9D, 0x2D, 0xA1, 0xDA,
+    0x1A, 0xD1, 0xAD, 0x2E, 0x1E, 0x2E, 0x1E, 0x2E, 0xA0, 0xEA, 0x1A, 0xDA, 0x0A, 0xDA, 0x73, 0x19,
+    0x92, 0x99, 0x2A, 0xE0, 0xAE, 0x19, 0xE0, 0x9E, 0x2E, 0x1E, 0x2E, 0x1E, 0x2D, 0xA1, 0xDA, 0x1A,
+    0xD1, 0xAD, 0x2D, 0x91, 0xD9, 0x74, 0x73, 0xAD, 0xA0, 0xAD, 0xA1, 0xAE, 0x0A, 0xE2, 0xE1, 0xE2,
+    0xE1, 0xE2, 0xDA, 0x1D, 0xA1, 0x9D, 0x19, 0xD2, 0xD9, 0x1D, 0x92, 0x99, 0x29, 0x92, 0x19, 0x92,
+    0x99, 0x2A, 0xE0, 0xAE, 0x1E, 0xA0, 0xEA, 0x1E, 0x1E, 0x2E, 0x1E, 0x29, 0xD9, 0x09, 0xD9, 0x2D,
+    0xA1, 0xDA, 0x3D, 0x2D, 0x73, 0x39, 0xAA, 0x97, 0xAE, 0x79, 0xE7, 0x9D, 0xA4, 0xA9, 0x1D, 0x90,
+    0x9A, 0x90, 0xFF, 0xDA, 0x0F, 0xFD, 0xA0, 0xAA, 0x90, 0xD9, 0x09, 0xA9, 0x4D, 0x97, 0x0D, 0x97,
+    0x0D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0xA7, 0x9E, 0x79, 0xE7, 0x70, 0x4A, 0xA9, 0x79, 0xE7,
+    0x9E, 0x70, 0xDA, 0x4A, 0x91, 0xD9, 0x09, 0xA9, 0x0F, 0xFD, 0xA0, 0xFF, 0xDA, 0x0A, 0x91, 0xD9,
+    0x09, 0xA9, 0x4D, 0xA7, 0x9E, 0x70, 0xDA, 0x70, 0xD9, 0x4D, 0xA9, 0xDA, 0x9A, 0xCA, 0x0F, 0xFD,
+    0xA0, 0xEA, 0xDA, 0xAD, 0xA4, 0xDA, 0x70, 0xDA, 0x79, 0xE7, 0xAE, 0x71, 0x94, 0x6F, 0x0F, 0xC9,
+    0xFC, 0x9F, 0xC9, 0x0E, 0xA6, 0x0A, 0x95, 0x9E, 0x93, 0x9F, 0xC9, 0x19, 0xFE, 0x99, 0xFF, 0x9F,
+    0xDA, 0x09, 0xFA, 0x29, 0xDA, 0x59, 0x60, 0x09, 0xA9, 0x09, 0xEA, 0xAF, 0x9E, 0xA1, 0x91, 0x19,
+    0xA9, 0x29, 0xA9, 0x1F, 0x1A, 0xE9, 0x0F, 0x90, 0xFA, 0x0F, 0x1A, 0xE9, 0x19, 0x93, 0x99, 0x10,
+    0x19, 0xA9, 0x49, 0xA9, 0x59, 0x92, 0xF3, 0x9E, 0xA3, 0xF1, 0xF9, 0x2A, 0xEA, 0x29, 0xF1, 0xF3,
+    0x9E, 0x93, 0xF2, 0x99, 0x59, 0x96, 0x99, 0x10, 0x0A, 0xD9, 0x9F, 0xAF, 0x0E, 0x94, 0x73, 0xC9,
+    0x6C, 0xA0, 0x92, 0x99, 0xCA, 0xC9, 0x1A, 0xAE, 0x39, 0xC0, 0xC2, 0xAA, 0x1C, 0x19, 0xA2, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x96, 0x71,
+    0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x29, 0xDA, 0xA1, 0x9C, 0x0C, 0x93, 0xC1, 0xAA, 0x2C, 0x2A, 0x91,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0x90, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xA9, 0xAA, 0xA0, 0x9A, 0x09, 0xA0, 0xA9, 0x29, 0xA5, 0x9A,
+    0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59,
+    0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x72, 0x29, 0x19, 0x6A, 0xA0, 0xC9, 0x6A, 0xA0,
+    0xCA, 0x19, 0x99, 0x99, 0xCA, 0x0A, 0xA0, 0xCA, 0xAA, 0xAD, 0x09, 0xC0, 0xC2, 0x9C, 0x09, 0xC1,
+    0xC1, 0x9C, 0x09, 0xC2, 0xC1, 0xA0, 0x9A, 0x3C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0x97, 0x10,
+    0x59, 0x59, 0xC0, 0xAA, 0x4A, 0xC0, 0xAA, 0x4A, 0xC0, 0xAC, 0x99, 0x99, 0x90, 0xC9, 0x0D, 0xAA,
+    0xAA, 0xC1, 0xC9, 0x0C, 0x92, 0xC2, 0xAA, 0x0C, 0x91, 0xC3, 0xA9, 0x0A, 0x1C, 0x71, 0xC7, 0x1C,
+    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+    0xC7, 0x1C, 0x71, 0xC7, 0x19, 0x00, 0x77, 0x77, 0x39, 0xAA, 0x96, 0x9C, 0xA7, 0x70, 0x9F, 0xD5,
+    0xE7, 0x70, 0xE9, 0xAD, 0xA3, 0x9D, 0x97, 0x7A, 0xD9, 0x1E, 0x3E, 0x77, 0x0E, 0x2E, 0x29, 0xD7,
+    0x71, 0xE2, 0xAD, 0x2D, 0xA7, 0x71, 0xE2, 0xE1, 0xAD, 0x77, 0x2E, 0x2E, 0x1D, 0x97, 0x59, 0x3A,
+    0xD9, 0x09, 0xDA, 0x0A, 0xD1, 0xAF, 0x93, 0x9F, 0xC2, 0xFE, 0x1D, 0x90, 0xEA, 0xE9, 0x19, 0xFE,
+    0x2A, 0xEA, 0x1D, 0xA0, 0x9D, 0x91, 0xE1, 0xE1, 0xAD, 0x97, 0x9D, 0x1A, 0xD2, 0xE1, 0xDA, 0x19,
+    0xDA, 0x7D, 0xA1, 0xE2, 0xAD, 0x09, 0xD9, 0x2D, 0xA6, 0xAD, 0x2E, 0x2A, 0xD0, 0x9D, 0x92, 0xDA,
+    0x6D, 0xA2, 0xE2, 0xE0, 0x9D, 0xA1, 0x9D, 0x95, 0xAD, 0x3A, 0xD9, 0x1D, 0xA1, 0xE1, 0xAD, 0x59,
+    0xD9, 0x4E, 0xAE, 0x2A, 0xEA, 0xDA, 0x5E, 0x59, 0xFC, 0x4F, 0xCA, 0x69, 0xC9, 0x79, 0x97, 0x09,
+    0x97, 0x77, 0x74, 0x71, 0xDA, 0x3E, 0x2A, 0xE2, 0xE9, 0x1A, 0xE2, 0xE3, 0xD9, 0x39, 0x93, 0x76,
+    0xDA, 0x19, 0xD3, 0xE1, 0xEA, 0x1A, 0xE1, 0xE9, 0x1E, 0x90, 0xAE, 0x1A, 0xE1, 0xE9, 0x1E, 0x1A,
+    0xDA, 0x2D, 0x91, 0xAD, 0x39, 0x93, 0xA3, 0x77, 0x4D, 0xA1, 0x9D, 0x2D, 0x93, 0xE1, 0xEA, 0x09,
+    0xE2, 0xAE, 0x1E, 0x90, 0xF2, 0xE9, 0x0A, 0xE1, 0xE9, 0x1A, 0xE1, 0xE9, 0x0A, 0xDA, 0x2E, 0x1A,
+    0xDA, 0x1E, 0x3D, 0x91, 0xAD, 0x2D, 0x93, 0x99, 0x3A, 0x39, 0x93, 0x7A, 0xCA, 0x29, 0xE3, 0xEA,
+    0x2A, 0xE3, 0xE9, 0x29, 0xE3, 0xAD, 0x4A, 0x10, 0x74, 0xAD, 0x2D, 0x92, 0xE9, 0x0A, 0xE2, 0xF0,
+    0x9E, 0x29, 0xE1, 0xEA, 0x2A, 0xDA, 0x09, 0xE3, 0xE1, 0xAD, 0xA2, 0x9D, 0x2D, 0xA3, 0x99, 0x3A,
+    0x00, 0x77, 0x2A, 0xD2, 0xD9, 0x1A, 0xD3, 0xE9, 0x0A, 0xE1, 0xE3, 0xF0, 0x9E, 0x1E, 0xA2, 0x9E,
+    0x1E, 0xA0, 0x9E, 0x3A, 0xDA, 0x09, 0xE1, 0xEA, 0x3E, 0x1A, 0xDA, 0x1E, 0x39, 0xD2, 0xDA, 0x19,
+    0xD4, 0x99, 0x3A, 0x39, 0x90, 0x39, 0xA7, 0x9D, 0xA5, 0x9F, 0xA3, 0x9D, 0xA0, 0xDA, 0x19, 0xDA,
+    0x2D, 0xA7, 0x30, 0x73, 0x9D, 0x3A, 0xDA, 0x2A, 0xE2, 0xF3, 0xE9, 0x3F, 0x4E, 0xA4, 0xEA, 0x4A,
+    0xD7, 0x00, 0x6A, 0xCA, 0x39, 0xE3, 0xAE, 0x3A, 0xE9, 0x2E, 0xA1, 0xAE, 0x90, 0x9E, 0x91, 0xE2,
+    0xAD, 0x72, 0x77, 0x9C, 0x72, 0xAC, 0x09, 0xD2, 0x9D, 0x29, 0xD1, 0xAD, 0x1A, 0xD9, 0x09, 0xD3,
+    0xAD, 0x1C, 0xA0, 0x9D, 0x5A, 0xD2, 0x9D, 0x7A, 0xCA, 0x1D, 0x95, 0xA1, 0xDA, 0xD9, 0x09, 0x92,
+    0xE1, 0xE9, 0x09, 0xDA, 0x1E, 0x1E, 0x90, 0x9D, 0xA2, 0x91, 0xDA, 0xD9, 0x09, 0x95, 0xDA, 0x1D,
+    0x96, 0xAC, 0xA3, 0xD9, 0x4A, 0xD0, 0x9C, 0xA0, 0x9D, 0x3A, 0xD1, 0xAD, 0x90, 0x9D, 0x19, 0xD2,
+    0x9D, 0x29, 0xD0, 0x9C, 0x72, 0xAA, 0x77, 0x00, 0x1A, 0xAA, 0x3A, 0xAA, 0x1F, 0x2A, 0xE1, 0xEA,
+    0x2F, 0x09, 0xE9, 0x2E, 0xA0, 0x9E, 0x92, 0xEA, 0x1E, 0x92, 0xEA, 0x1E, 0x3E, 0x91, 0xE3, 0xE9,
+    0x1E, 0x3E, 0x91, 0xE3, 0xAD, 0x91, 0xE3, 0xAD, 0x91, 0xE3, 0xAD, 0x91, 0xAD, 0x39, 0xD9, 0x19,
+    0xD4, 0xD9, 0x77, 0x09, 0x59, 0x2A, 0xE2, 0x9E, 0x90, 0xF2, 0xF9, 0x0F, 0x2A, 0xE2, 0x99, 0x49,
+    0x91, 0xFF, 0xF9, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0A, 0xF9, 0x0F, 0xCA,
+    0x0F, 0xC9, 0x77, 0x70, 0xCA, 0x72, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x72,
+    0xD9, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1D, 0xA7, 0x19, 0xD7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7,
+    0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xAD, 0x73, 0x99, 0x71, 0x29, 0x71, 0x97,
+    0xAF, 0xA4, 0xAF, 0xA3, 0x9F, 0xE3, 0xFE, 0x3F, 0xF2, 0xFF, 0x2A, 0x91, 0x9E, 0x91, 0x99, 0x19,
+    0xEA, 0x7E, 0x7E, 0x7A, 0xD7, 0x9D, 0x7A, 0xD7, 0xAD, 0x49, 0xAF, 0x49, 0xAF, 0x2A, 0xFD, 0x92,
+    0x9F, 0xD9, 0x2F, 0xD9, 0x3F, 0xD9, 0x3F, 0x95, 0xAE, 0x95, 0xAD, 0x7A, 0xD7, 0x9C, 0xA7, 0x0D,
+    0x77, 0x77, 0x97, 0x19, 0x7A, 0xE6, 0x9E, 0x95, 0xF9, 0x5F, 0x95, 0xAE, 0x6A, 0xE7, 0x99, 0x70,
+    0x99, 0x50, 0x29, 0x71, 0xAA, 0xA1, 0xAF, 0xA5, 0xF0, 0x9F, 0xE4, 0xEA, 0x1F, 0xF3, 0xEA, 0x1A,
+    0x91, 0x9E, 0x92, 0xE9, 0x7E, 0x2E, 0x97, 0xAD, 0x2E, 0x70, 0xAD, 0x2E, 0x59, 0xAF, 0x2E, 0x3A,
+    0xFD, 0x92, 0xE3, 0xFD, 0x93, 0xE3, 0xF9, 0x5A, 0xD3, 0xAD, 0x7A, 0xD3, 0x9C, 0xA7, 0x9D, 0x77,
+    0x79, 0x71, 0x93, 0xAE, 0x6A, 0xE2, 0xF9, 0x5F, 0x91, 0xAE, 0x6F, 0x39, 0x97, 0x09, 0x91, 0x1A,
+    0xAA, 0x49, 0x7F, 0x2A, 0xFA, 0x4E, 0xA1, 0x9F, 0xE2, 0x9E, 0x92, 0xFF, 0x19, 0xE9, 0x2A, 0x91,
+    0x9E, 0x91, 0xE9, 0x70, 0xE1, 0xE7, 0x1A, 0xD1, 0xE7, 0x1A, 0xD1, 0xE6, 0x9A, 0xF1, 0xE4, 0xAF,
+    0xD9, 0x1E, 0x4F, 0xD9, 0x2E, 0x4F, 0x94, 0xAD, 0x4A, 0xD6, 0x9D, 0x49, 0xCA, 0x77, 0x72, 0x96,
+    0x96, 0xAE, 0x3A, 0xE5, 0xF3, 0xF9, 0x4F, 0x3A, 0xE6, 0x99, 0x59, 0x95, 0x39, 0x73, 0xFC, 0xA3,
+    0xAC, 0x90, 0xFF, 0xAA, 0xE9, 0xAD, 0x91, 0xAF, 0xDA, 0x1A, 0x94, 0xAD, 0xA9, 0x77, 0x00, 0x77,
+    0x71, 0xDA, 0x19, 0xD2, 0xD9, 0x19, 0xD3, 0xE1, 0xEA, 0x09, 0xE1, 0xEA, 0x1A, 0xE1, 0xE9, 0x0F,
+    0x09, 0xE9, 0x1E, 0x90, 0xAE, 0x1E, 0x90, 0xF1, 0xAE, 0x1E, 0x90, 0xAD, 0xA1, 0xE2, 0xE1, 0xAD,
+    0xA1, 0xE1, 0xAD, 0x92, 0xD9, 0x1A, 0xD2, 0xD9, 0x1D, 0xA3, 0x99, 0x3A, 0x39, 0x93, 0xA3, 0x39,
+    0xAA, 0x94, 0x9F, 0xD2, 0x9E, 0xAF, 0x1E, 0x91, 0xE9, 0x0E, 0x2A, 0xDA, 0x9D, 0xA2, 0x9D, 0xA9,
+    0xDA, 0x29, 0xDA, 0x9D, 0xA2, 0xAD, 0x90, 0xE2, 0xE1, 0xEA, 0x0A, 0xE1, 0x9F, 0xE3, 0x9A, 0xEA,
+    0x75, 0x69, 0x96, 0xAD, 0xA5, 0x9E, 0xA5, 0xFA, 0x4D, 0xAD, 0xA3, 0xAD, 0x0D, 0xA2, 0x9D, 0x1D,
+    0xA2, 0xDA, 0x99, 0xE9, 0x1F, 0xFC, 0xA0, 0x9A, 0xAA, 0xAE, 0xA9, 0x5D, 0xA7, 0xDA, 0x74, 0x19,
+    0x99, 0x99, 0x92, 0xFD, 0x91, 0xFD, 0x90, 0x9D, 0x59, 0xDA, 0x93, 0xAF, 0xC9, 0x29, 0x9A, 0xE5,
+    0xAD, 0xA4, 0x9D, 0x93, 0xAE, 0x09, 0xFD, 0x91, 0xFA, 0x73, 0x49, 0xA9, 0x49, 0xFC, 0x2A, 0xEA,
+    0x92, 0x9E, 0x5E, 0xA9, 0x92, 0x9F, 0xE1, 0xAD, 0x99, 0xAE, 0x0A, 0xD2, 0xE0, 0xAD, 0x91, 0xAD,
+    0x09, 0xE1, 0xE1, 0xFE, 0x92, 0xAF, 0x97, 0x30, 0x09, 0x99, 0x99, 0x99, 0x19, 0xFF, 0x09, 0xFF,
+    0x09, 0xD2, 0xD9, 0x1A, 0x91, 0xDA, 0x5A, 0xD6, 0xDA, 0x5E, 0x6D, 0xA5, 0xAD, 0x95, 0xAD, 0x69,
+    0xD7, 0x60, 0x29, 0xAA, 0x92, 0x9F, 0xD1, 0xDA, 0x09, 0xDA, 0x9D, 0x91, 0xDA, 0x0E, 0x09, 0xD9,
+    0x09, 0xFC, 0x91, 0x9F, 0xCA, 0x09, 0xDA, 0x0A, 0xDA, 0xE2, 0xFD, 0x2E, 0x9F, 0xE9, 0x09, 0xFA,
+    0x72, 0x29, 0xA9, 0x4A, 0xFC, 0xA1, 0x9E, 0xAE, 0x90, 0xAD, 0x2E, 0x0A, 0xD2, 0xE0, 0xAD, 0xA1,
+    0xE1, 0xFF, 0x2A, 0xFC, 0xA5, 0xE4, 0x9E, 0x91, 0x9F, 0xCA, 0x3E, 0xA7, 0x60, 0x29, 0x19, 0x94,
+    0xEA, 0xF9, 0x29, 0xFA, 0xE3, 0xAD, 0x19, 0xD3, 0xAD, 0x19, 0xD3, 0xAD, 0x19, 0xD3, 0xAD, 0x19,
+    0xD2, 0x9E, 0x90, 0xEA, 0x1F, 0xA9, 0xF0, 0x29, 0xF9, 0x3F, 0xE9, 0x1A, 0xE9, 0x9E, 0x1E, 0x2A,
+    0xD9, 0x9D, 0xA2, 0xAD, 0xA9, 0xDA, 0x29, 0xDA, 0x9D, 0xA2, 0xAD, 0xA9, 0xDA, 0x2A, 0xD9, 0x0E,
+    0x2E, 0x1A, 0xEA, 0xEA, 0x2F, 0xDA, 0x49, 0xAA, 0x93, 0x74, 0xAC, 0x3A, 0xF9, 0x2F, 0xC9, 0x4A,
+    0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x29, 0xAF, 0xA1, 0xFE, 0x90,
+    0x99, 0x99, 0x99, 0x90, 0x1A, 0xEA, 0x3F, 0xE9, 0x0A, 0xDA, 0x0A, 0xDA, 0x0A, 0xD1, 0x9D, 0xA1,
+    0x99, 0x1A, 0xD9, 0x49, 0xE4, 0x9E, 0x49, 0xDA, 0x4A, 0xDA, 0x4A, 0xFF, 0x0A, 0xFF, 0x29, 0x99,
+    0x99, 0x20, 0x1A, 0xEA, 0x2F, 0xE0, 0x9C, 0xA1, 0xAD, 0x90, 0xA2, 0xAD, 0x4A, 0xD9, 0x2F, 0xC9,
+    0x29, 0xAA, 0xE9, 0x49, 0xDA, 0x4A, 0xDA, 0x9A, 0xAA, 0xF0, 0xAF, 0xD2, 0x9A, 0xA9, 0x30, 0x5A,
+    0xCA, 0x6E, 0xA5, 0xAE, 0xA4, 0x9F, 0xA4, 0xD9, 0xDA, 0x3D, 0x90, 0xDA, 0x2A, 0xCA, 0x1D, 0xA1,
+    0x9E, 0xAA, 0xEA, 0x90, 0xFF, 0xCA, 0x5D, 0xA7, 0xDA, 0x7A, 0xA9, 0x10, 0x1A, 0xAA, 0xAA, 0xA9,
+    0x1F, 0xD9, 0x09, 0xDA, 0xAA, 0xA1, 0x9D, 0x59, 0xF9, 0x29, 0xFD, 0x49, 0xE9, 0x49, 0xDA, 0x4A,
+    0xD9, 0x0A, 0xAA, 0xF0, 0x9F, 0xD2, 0x9A, 0xA9, 0x30, 0x39, 0xE9, 0x3F, 0xCA, 0x2F, 0x93, 0xEA,
+    0x49, 0xFC, 0xA9, 0x1A, 0xFE, 0x90, 0xAD, 0x2E, 0x0A, 0xD2, 0xAD, 0x0A, 0xD9, 0x1E, 0x1E, 0xAA,
+    0xDA, 0x19, 0xFD, 0x49, 0xAA, 0x92, 0x0A, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xF0, 0x9D, 0xAA, 0xAE,
+    0x09, 0xCA, 0x1A, 0xD2, 0x92, 0xD9, 0x5E, 0x59, 0xD9, 0x5E, 0x59, 0xDA, 0x5A, 0xD6, 0xAD, 0x7A,
+    0xA4, 0x19, 0xF9, 0x1A, 0xFD, 0x90, 0xD9, 0x1D, 0xA9, 0xDA, 0x1D, 0xA0, 0xEA, 0xE2, 0xFC, 0x2A,
+    0xFD, 0x9A, 0xD1, 0x9F, 0xD2, 0xEA, 0xD9, 0x09, 0xDA, 0x0F, 0xDA, 0x29, 0xAA, 0xA2, 0x1A, 0xEA,
+    0x3F, 0xE1, 0xAD, 0xA0, 0xAD, 0xA0, 0xAD, 0x2E, 0x0A, 0xD2, 0xE0, 0x9E, 0x99, 0xE1, 0xAF, 0xE3,
+    0x9A, 0xE9, 0x4A, 0xE2, 0x9A, 0xF2, 0x9F, 0xC4, 0x9A, 0xA5, 0x75, 0xAF, 0xFF, 0x9A, 0xFF, 0xFA,
+    0x1A, 0xEA, 0x99, 0x9A, 0xDA, 0x19, 0xE9, 0x3D, 0xA1, 0x9E, 0x93, 0xAC, 0x91, 0x9E, 0x97, 0x09,
+    0xE9, 0x70, 0x9F, 0xFC, 0x39, 0xFF, 0xC3, 0x9E, 0xA9, 0x99, 0x94, 0x9E, 0x96, 0xAF, 0xF4, 0xAF,
+    0xF6, 0x9E, 0x97, 0x0A, 0xEA, 0x69, 0xFF, 0x4A, 0xFF, 0x40, 0x71, 0x97, 0x2A, 0xFC, 0xA6, 0xFF,
+    0xA4, 0x9E, 0x1A, 0xE4, 0xE9, 0x2E, 0x4E, 0x3D, 0x49, 0xE7, 0x19, 0xAE, 0x99, 0x99, 0x93, 0xFF,
+    0xD9, 0x39, 0x9F, 0x99, 0x99, 0x6E, 0xA9, 0x99, 0x93, 0x9F, 0xFD, 0x39, 0xAA, 0xEA, 0xAA, 0xA9,
+    0x59, 0xE7, 0x2A, 0xDA, 0x70, 0xAA, 0xEA, 0xAA, 0xAA, 0xAD, 0xA0, 0xFF, 0xFC, 0x90, 0xAF, 0xFF,
+    0x29, 0x95, 0x99, 0x91, 0x59, 0x99, 0x77, 0x71, 0xFF, 0xDA, 0x77, 0x6F, 0xFF, 0x97, 0x75, 0x9E,
+    0xA1, 0xAF, 0x77, 0x6E, 0xA2, 0xAE, 0x49, 0x77, 0x0E, 0xA2, 0x9E, 0x91, 0x9D, 0x97, 0x7E, 0xA2,
+    0x9E, 0x2A, 0xD9, 0x77, 0xEA, 0x2A, 0xE1, 0x9E, 0xAA, 0xA9, 0x2A, 0xEA, 0x4E, 0xA1, 0xAE, 0xA0,
+    0xFF, 0xC0, 0x9F, 0xE3, 0xFF, 0xCA, 0x1A, 0xAE, 0xAA, 0xA1, 0xE1, 0x9D, 0x3F, 0xF9, 0x4E, 0x93,
+    0xE9, 0x1C, 0x93, 0xF9, 0x97, 0xE9, 0x3A, 0xF9, 0x5E, 0xA7, 0x1E, 0x94, 0xFD, 0x4E, 0xA7, 0x1E,
+    0x95, 0x9F, 0xC3, 0xEA, 0x71, 0xE9, 0x39, 0xA1, 0x9E, 0x3F, 0x97, 0x0F, 0x19, 0x0D, 0x2E, 0x1A,
+    0xFE, 0x96, 0xFE, 0x0E, 0xAA, 0xDA, 0x09, 0xFF, 0x97, 0xFC, 0x90, 0xFD, 0xA7, 0x75, 0x96, 0x94,
+    0x71, 0x99, 0x72, 0xAF, 0xDA, 0x59, 0xFF, 0xC4, 0x9F, 0x91, 0xAD, 0x4F, 0x3A, 0xD3, 0xAE, 0x4A,
+    0xC9, 0x3E, 0xA7, 0x1A, 0xFF, 0xC5, 0xFF, 0xD6, 0xAE, 0x71, 0x9A, 0xFA, 0xAA, 0xC9, 0x4A, 0xFF,
+    0xC7, 0xAE, 0x97, 0x3E, 0xA7, 0x3F, 0xA7, 0x29, 0xFC, 0xA9, 0x9A, 0xD4, 0x9F, 0xFD, 0x6A, 0xFD,
+    0xA7, 0x19, 0x99, 0x93, 0x77, 0x5C, 0x97, 0x5E, 0x74, 0xE9, 0x73, 0xE7, 0x4F, 0xFF, 0xE1, 0xFF,
+    0xFE, 0x1A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x2A, 0xD9, 0x75, 0xAD, 0xA7, 0x5A, 0xD7, 0x6A, 0x72,
+    0x5A, 0x72, 0xE7, 0x0F, 0xC6, 0xFE, 0x39, 0xDA, 0xFD, 0x91, 0xAD, 0x0E, 0x0D, 0xA2, 0xC9, 0x0E,
+    0x09, 0xC6, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x71,
+    0x77, 0x72, 0x9C, 0x75, 0x9E, 0x75, 0x9E, 0x76, 0xE2, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x4D, 0xA7, 0x6A, 0x40, 0x49, 0xA9, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE6, 0xC9, 0x0E, 0x0A,
+    0xC2, 0xE0, 0xE9, 0xE2, 0xFF, 0xC4, 0xFE, 0x6F, 0xC7, 0x0D, 0xA7, 0x71, 0x4A, 0x4A, 0x70, 0xDA,
+    0x2A, 0xD6, 0xE9, 0x29, 0xE4, 0xDA, 0x6E, 0x2F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x0A, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA2, 0xAD, 0x94, 0x9D, 0xA4, 0xEA, 0x2A, 0xE6, 0xD9, 0x29, 0xD7, 0x09, 0x49,
+    0x40, 0x39, 0xC9, 0x69, 0xE9, 0x49, 0xFC, 0x92, 0x9F, 0xE9, 0x09, 0xDA, 0xEA, 0xD9, 0x0D, 0x0E,
+    0x0D, 0x4E, 0x7E, 0x7E, 0x7E, 0x49, 0x90, 0xE0, 0x99, 0x09, 0xD0, 0xE0, 0xD9, 0x0F, 0xFC, 0x2F,
+    0xE4, 0xFC, 0x6E, 0x70, 0x94, 0x77, 0x1A, 0xCA, 0x70, 0xFC, 0x6F, 0xE4, 0xFF, 0xC2, 0x9D, 0x0E,
+    0x0D, 0x92, 0x99, 0x0E, 0x09, 0x96, 0xE7, 0x1E, 0x69, 0x90, 0xE0, 0x99, 0x29, 0xD0, 0xE0, 0xD9,
+    0x2F, 0xFC, 0x4F, 0xE6, 0xFC, 0x70, 0xAC, 0xA5, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x77, 0x2E,
+    0x7E, 0x7E, 0x7D, 0xA7, 0xDA, 0x7D, 0xA3, 0xCA, 0x1D, 0xA2, 0xAD, 0xA0, 0xDA, 0x1A, 0xDA, 0x1D,
+    0xA0, 0xAD, 0x92, 0xDA, 0xAF, 0xFC, 0xAF, 0xFD, 0xA0, 0xEA, 0xAA, 0xAA, 0xA9, 0x1E, 0x79, 0xE9,
+    0x69, 0xD9, 0x79, 0x94, 0x72, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xAD, 0x7A, 0xD1, 0xAC, 0x3A, 0xD0,
+    0xAD, 0xA2, 0xAD, 0x1A, 0xDA, 0x1A, 0xD2, 0x9D, 0xA0, 0xAF, 0xFC, 0xAA, 0xFF, 0xD9, 0xAA, 0xAA,
+    0xAA, 0xE6, 0xE5, 0x9E, 0x69, 0xD9, 0x79, 0x93, 0x77, 0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x39, 0xC4,
+    0xAD, 0x92, 0x9E, 0x39, 0xD9, 0x19, 0xE4, 0x9D, 0x19, 0xDA, 0x59, 0xD1, 0xFF, 0xFC, 0x09, 0xFF,
+    0xFC, 0x1A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAD, 0x97, 0x3E, 0xA7, 0x3D, 0xA7, 0x4A, 0x70,
+    0x77, 0x6C, 0xA7, 0x5E, 0x74, 0xE7, 0x4E, 0xAA, 0xAA, 0xAA, 0xAA, 0xD2, 0xFF, 0xFD, 0x1E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1D, 0x76, 0xAF, 0xFF, 0xD2, 0xAF, 0xFF, 0xC3, 0xAD, 0x90, 0x99,
+    0x99, 0x99, 0x9A, 0x4A, 0xD7, 0x6E, 0x76, 0xC9, 0x77, 0x71, 0x69, 0x74, 0xE7, 0x2F, 0xC7, 0x0E,
+    0x0E, 0x6E, 0xA0, 0xAE, 0x4F, 0xA0, 0xAF, 0x2E, 0x9C, 0xA0, 0xAC, 0x9E, 0x19, 0xC0, 0x9C, 0xA0,
+    0xAC, 0x90, 0xC9, 0x49, 0xCA, 0x0A, 0xC9, 0x79, 0xCA, 0x0A, 0xC9, 0x7A, 0xCA, 0x0A, 0xC9, 0x7A,
+    0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A,
+    0xCA, 0x0A, 0xCA, 0x77, 0x20, 0x77, 0x71, 0xAC, 0x76, 0xE7, 0x6E, 0x4D, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE3, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x76, 0xD1, 0xFF, 0xFD, 0xA1, 0xFF,
+    0xFC, 0xA2, 0xA9, 0x99, 0x99, 0x99, 0x09, 0xDA, 0x74, 0xDA, 0x74, 0xE7, 0x59, 0xC7, 0x76, 0x49,
+    0x29, 0x70, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0,
+    0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0x9C, 0xA0, 0xAC, 0x97, 0x9C, 0xA0, 0xAC, 0x97, 0x9C, 0xA0,
+    0xAC, 0x94, 0xAC, 0x09, 0xCA, 0x0A, 0xC9, 0x0C, 0xA1, 0xEA, 0xCA, 0x0A, 0xCA, 0xE2, 0xFA, 0x0A,
+    0xF4, 0xAD, 0xA0, 0xAD, 0xA6, 0xAD, 0x9D, 0xA7, 0x0A, 0xEA, 0x72, 0xAC, 0xA7, 0x74, 0x49, 0x39,
+    0x72, 0xD2, 0xD7, 0x0D, 0xA2, 0xAD, 0x6E, 0x99, 0x99, 0x9E, 0x4F, 0xFF, 0xC2, 0xDA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xD0, 0x9D, 0x72, 0xD9, 0x0A, 0xFF, 0xFC, 0xA2, 0xFF, 0xFA, 0x4E, 0x39, 0xE6,
+    0xE2, 0xE7, 0x0D, 0x2D, 0x77, 0x50, 0x09, 0x99, 0x97, 0x19, 0x99, 0x0A, 0xEA, 0x7A, 0xDA, 0x09,
+    0xF7, 0xE2, 0xF9, 0x59, 0xE2, 0xAE, 0xA5, 0xE9, 0x3F, 0xAA, 0xAA, 0xAA, 0xE4, 0xFF, 0xFA, 0x4A,
+    0xFF, 0xE6, 0xF3, 0xDA, 0x6F, 0x91, 0xAD, 0x96, 0x9E, 0xA1, 0xE7, 0x0F, 0x09, 0xD9, 0x70, 0xAE,
+    0x9A, 0xD7, 0x19, 0xEA, 0xDA, 0x72, 0xFD, 0x73, 0xAF, 0xA7, 0x4F, 0x97, 0x4E, 0xA7, 0x69, 0x70,
+    0x59, 0xA9, 0x7F, 0xDA, 0x4F, 0xFA, 0x3C, 0x92, 0xAE, 0x71, 0xEA, 0x70, 0xEA, 0x70, 0xAE, 0x4A,
+    0xFE, 0x29, 0xFF, 0xC1, 0x9E, 0xA9, 0xAF, 0x1E, 0x92, 0xAD, 0xA0, 0xAD, 0xA3, 0xEA, 0x0E, 0x93,
+    0xE9, 0x9E, 0x4E, 0x09, 0xE3, 0x9D, 0xA0, 0x9E, 0x3E, 0x90, 0x9E, 0x2A, 0xE2, 0xEA, 0x9A, 0xE3,
+    0xAF, 0xE5, 0xAF, 0xA7, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xE9, 0x9F, 0xFE,
+    0xA0, 0xA9, 0x99, 0x99, 0x9A, 0xEA, 0x7A, 0xEA, 0x7A, 0xEA, 0x7A, 0xEA, 0x7A, 0xEA, 0x0F, 0xFE,
+    0xA0, 0xFF, 0xEA, 0x0A, 0xAA, 0xAA, 0xA9, 0xAE, 0xA7, 0xAE, 0xA7, 0xAE, 0xA7, 0xAE, 0xA7, 0xAE,
+    0xA9, 0xEA, 0xAA, 0xAF, 0xAA, 0xFF, 0xE9, 0xAF, 0xFE, 0x00, 0x77, 0x71, 0xAA, 0xDA, 0x92, 0x9C,
+    0x94, 0xFF, 0xCA, 0x9D, 0x92, 0x9F, 0xFF, 0xC9, 0x3F, 0x93, 0xAF, 0x3F, 0x6F, 0x91, 0x9E, 0x95,
+    0xFC, 0xA1, 0xAE, 0x5D, 0xAA, 0xE1, 0xE9, 0x4D, 0xA0, 0x9E, 0x1E, 0x93, 0xDA, 0x2E, 0x1E, 0x3D,
+    0xA2, 0x9E, 0x1E, 0x91, 0xDA, 0x39, 0xE1, 0xE9, 0x0D, 0xA4, 0xAE, 0x1E, 0xAE, 0x5E, 0xA1, 0xAF,
+    0xC5, 0x9E, 0x3F, 0x59, 0xEA, 0x3F, 0xCA, 0x99, 0x9F, 0xC3, 0xAF, 0xFF, 0xC3, 0xAD, 0x09, 0xFF,
+    0x95, 0xC4, 0x99, 0x99, 0x77, 0x72, 0x7A, 0xCA, 0x74, 0xF7, 0x3A, 0xF9, 0x72, 0xFC, 0xA7, 0x19,
+    0xFD, 0x71, 0xDA, 0xAE, 0x97, 0x9D, 0x90, 0xF7, 0xE1, 0xF7, 0xDA, 0x19, 0xEA, 0x5A, 0xD3, 0xF5,
+    0xE3, 0xF9, 0x39, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x29, 0xE5, 0xF9, 0x1A, 0xD9, 0x59, 0xF1, 0xE9,
+    0x59, 0xF0, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x1F, 0x95, 0xAE, 0x1A, 0xEA, 0x5E, 0x92, 0xF5, 0xE3, 0xF9, 0x39,
+    0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x3D, 0xA5, 0xAE, 0x91, 0xAD, 0x95, 0x9E, 0xA1, 0xE7, 0xF0, 0x9D,
+    0x97, 0xAE, 0x9A, 0xD7, 0x09, 0xEA, 0xDA, 0x71, 0xFD, 0x72, 0xAF, 0xC7, 0x3F, 0x97, 0x3E, 0xA7,
+    0x59, 0x70, 0x79, 0x99, 0x99, 0x99, 0x99, 0x39, 0xAF, 0xFE, 0x2A, 0xFF, 0xFC, 0x1F, 0xCA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x90, 0xAE, 0xA7, 0x3F, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xAF, 0xFF, 0xEA, 0xFF,
+    0xFF, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x74, 0x9E, 0x97, 0x4F, 0x74, 0x9F,
+    0x97, 0x39, 0xFF, 0xFC, 0xA2, 0x9F, 0xFF, 0xC4, 0x9A, 0xFF, 0xD0, 0x74, 0x99, 0x75, 0xE7, 0x19,
+    0x99, 0xAE, 0x99, 0x39, 0xAF, 0xFE, 0x2A, 0xFF, 0xFC, 0x1F, 0xCA, 0xAA, 0xFA, 0xA9, 0x0A, 0xEA,
+    0x3E, 0x93, 0xF4, 0xE3, 0x9E, 0x4A, 0xDA, 0x3A, 0xE4, 0xE9, 0x3A, 0xFF, 0xFE, 0xAF, 0xFF, 0xFA,
+    0xAE, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xE2, 0x9D, 0xA5, 0x9E, 0x91, 0xAD, 0x96, 0xF1, 0xE7,
+    0x9F, 0xAD, 0xA7, 0x0A, 0xFF, 0xFC, 0xA2, 0x9F, 0xFF, 0xC4, 0xAF, 0xFE, 0x4E, 0x74, 0x9E, 0x77,
+    0x71, 0x49, 0xAF, 0xFC, 0xA2, 0xAF, 0xFF, 0xC1, 0xFF, 0xFE, 0x0A, 0xEA, 0x97, 0x19, 0xEA, 0x73,
+    0xAE, 0x74, 0xAF, 0xFF, 0xEA, 0xFF, 0xFF, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9E,
+    0x75, 0xF7, 0x4A, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x59,
+    0x99, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x97, 0xFF, 0xEA, 0x4F, 0xFF, 0xCA, 0x29,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x4A, 0xEA, 0x74, 0xF7, 0x5E, 0x97, 0x4E, 0xAA, 0xFF, 0xFE,
+    0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x4E, 0xA7, 0x39, 0xE9, 0x73,
+    0xF7, 0x29, 0xF9, 0x0A, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x92, 0xFF, 0xDA, 0x94, 0x19, 0x97, 0x6E,
+    0x73, 0x99, 0xEA, 0x99, 0x97, 0xFF, 0xEA, 0x4F, 0xFF, 0xCA, 0x29, 0xAA, 0xFA, 0xAA, 0xFA, 0x49,
+    0xE3, 0xAE, 0xA4, 0xE4, 0xF4, 0xAD, 0xA4, 0xE9, 0x39, 0xE4, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF,
+    0xFA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xEA, 0x5A, 0xD9, 0x2E, 0xA5, 0x9D, 0xA1, 0x9E, 0x96, 0xE1,
+    0xF7, 0xAD, 0xAF, 0x90, 0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xC9, 0x2F, 0xFE, 0xA7, 0x5E, 0x75, 0xE9,
+    0x77, 0x40, 0xAF, 0xFC, 0xA9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE7, 0x39, 0xAE, 0xA7, 0x4A, 0xE7,
+    0x5E, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x4E,
+    0x97, 0x3F, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xFA, 0x0F, 0xFF, 0xDA, 0x1F, 0xFF, 0xC9, 0x29,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x1F, 0xFF, 0xFE, 0x1A, 0xFF, 0xFF, 0xC9, 0x3F, 0x94, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F,
+    0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59,
+    0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5,
+    0xFA, 0x4A, 0xF9, 0x2F, 0xF9, 0x09, 0xFF, 0x1F, 0xF9, 0x09, 0xFF, 0x00, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x19, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x19, 0xF5, 0xAD, 0x91, 0xAE, 0xA5, 0xD9,
+    0x2F, 0x94, 0xD3, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xE9, 0x73, 0xE9, 0x72,
+    0xF7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x59, 0x3E, 0xA5, 0x9D, 0x1A, 0xE6, 0xE0, 0x9E, 0x6A,
+    0xE0, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xC7, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA0, 0xAF, 0xFD, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x70, 0xE7, 0x0A, 0xDA, 0x70, 0xE9,
+    0x79, 0xE7, 0x0E, 0x97, 0x9E, 0x70, 0xAD, 0xA7, 0x0E, 0x70, 0xAD, 0xA7, 0x0E, 0x70, 0x9E, 0x70,
+    0xE9, 0x79, 0xE7, 0x0E, 0xA7, 0x0E, 0x70, 0xAD, 0xA7, 0x0E, 0x70, 0xAE, 0x70, 0xE9, 0x77, 0x40,
+    0x0E, 0x97, 0x0A, 0xDA, 0x71, 0xE7, 0x1A, 0xDA, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xE9,
+    0x70, 0xAE, 0x71, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x1E, 0xA7, 0x09, 0xE7, 0x1E, 0x97, 0x09, 0xE7,
+    0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x75, 0x49, 0x97, 0x09, 0xD7, 0x09, 0xD5, 0xD0, 0x9D, 0x09, 0xCA,
+    0x0A, 0xEA, 0xDA, 0xE1, 0x9F, 0xEA, 0x4F, 0xC9, 0x39, 0xFE, 0xA1, 0xAE, 0xAF, 0xD1, 0xD0, 0x9D,
+    0x09, 0xCA, 0x19, 0x19, 0xD7, 0x09, 0xD7, 0x19, 0x94, 0x29, 0xAA, 0x93, 0x9F, 0xD2, 0xEA, 0xF0,
+    0xAD, 0x2A, 0xD0, 0xAD, 0x29, 0xD0, 0xAD, 0x29, 0xD0, 0x9D, 0xA9, 0x9E, 0x1F, 0xE9, 0x2A, 0xEA,
+    0x74, 0x0A, 0xD9, 0x09, 0xF0, 0x9F, 0x1E, 0x96, 0x77, 0x75, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x74,
+    0x9D, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE3, 0xAA, 0xAA, 0xA4, 0xD9,
+    0x29, 0xFC, 0x39, 0xD3, 0x9F, 0xC3, 0xAD, 0x6E, 0x92, 0xDA, 0x6A, 0xDA, 0x19, 0xD7, 0x0E, 0x1A,
+    0xD7, 0x0E, 0x1D, 0xA7, 0x0A, 0xD9, 0x0D, 0x97, 0x09, 0xDA, 0xAD, 0x72, 0xFC, 0xA7, 0x2A, 0xF9,
+    0x72, 0x9F, 0x74, 0xEA, 0x74, 0xAD, 0x96, 0x39, 0x95, 0x91, 0xAF, 0x29, 0xD0, 0x9F, 0xD0, 0xAD,
+    0xA0, 0xE1, 0xFC, 0x91, 0xD9, 0x2E, 0x92, 0xD9, 0x2E, 0x92, 0xE1, 0xFC, 0x91, 0xAF, 0xD0, 0xEA,
+    0x1F, 0xC2, 0xE2, 0x99, 0x94, 0x9A, 0x29, 0x95, 0x99, 0x39, 0xF9, 0x19, 0xF2, 0xFD, 0x99, 0xFD,
+    0x09, 0xD9, 0x0F, 0xC9, 0x0A, 0xD0, 0xAD, 0x2E, 0x92, 0xD0, 0xAD, 0x2E, 0xA2, 0xD0, 0xAD, 0x1A,
+    0xF9, 0x0A, 0xD0, 0x9F, 0xD0, 0xAF, 0xCA, 0x1A, 0xF2, 0xAF, 0x39, 0x99, 0x49, 0x99, 0x20, 0x09,
+    0x99, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x77,
+    0x77, 0xAC, 0x97, 0x69, 0xE9, 0x75, 0xF7, 0x5F, 0x75, 0xAE, 0x75, 0xAE, 0x97, 0x49, 0xEA, 0x75,
+    0xEA, 0x75, 0xF7, 0x5A, 0xE7, 0x5A, 0xE9, 0x74, 0x9E, 0xA7, 0x5E, 0xA7, 0x5F, 0x75, 0xAF, 0xFF,
+    0xEA, 0x0A, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x9E, 0x0A, 0xAA, 0x99, 0x92, 0x99, 0x0E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1,
+    0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD,
+    0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E,
+    0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A,
+    0xD9, 0xE1, 0xAD, 0x9A, 0xAA, 0x19, 0xAA, 0x00, 0x69, 0x99, 0x76, 0xE9, 0x74, 0x9E, 0xA7, 0x4F,
+    0xC7, 0x39, 0xFC, 0xA7, 0x2A, 0xDA, 0xE7, 0x2E, 0x0E, 0x97, 0x0A, 0xDA, 0x09, 0xE7, 0x0E, 0x91,
+    0xE7, 0x9E, 0x2A, 0xDA, 0x6E, 0xA2, 0x9E, 0x6E, 0x4E, 0x94, 0xAE, 0x4A, 0xE4, 0xE9, 0x5E, 0x39,
+    0xE6, 0xEA, 0x2E, 0xA6, 0x9E, 0x2E, 0x70, 0xE9, 0x0A, 0xE7, 0x0A, 0xE0, 0x09, 0x97, 0x29, 0x99,
+    0x09, 0xE7, 0x0A, 0xDA, 0x1E, 0x97, 0xE9, 0x1A, 0xDA, 0x6A, 0xE2, 0x9E, 0x6E, 0x93, 0xEA, 0x49,
+    0xE4, 0x9E, 0x4A, 0xDA, 0x5E, 0x93, 0xE9, 0x5A, 0xDA, 0x29, 0xE7, 0xE2, 0xE9, 0x7E, 0x91, 0xE7,
+    0x09, 0xE0, 0xAD, 0xA7, 0x1E, 0x9E, 0x72, 0xAF, 0xD7, 0x3F, 0xC9, 0x73, 0xFC, 0x74, 0x9E, 0xA7,
+    0x5E, 0x70, 0x39, 0xAE, 0xA9, 0x6F, 0xFC, 0x4F, 0xFE, 0x2A, 0xE9, 0x29, 0xEA, 0x1E, 0x94, 0x9E,
+    0x09, 0xE6, 0xE9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A,
+    0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D,
+    0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x09, 0x97, 0x09,
+    0x90, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D,
+    0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD,
+    0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0E, 0x6E, 0x1E, 0xA4, 0xAE,
+    0x1A, 0xFA, 0x9A, 0xFA, 0x2A, 0xFF, 0xCA, 0x49, 0xFE, 0x97, 0x09, 0x99, 0x50, 0x70, 0x9A, 0xA9,
+    0x71, 0xFD, 0x7F, 0xEA, 0x5A, 0xE0, 0x9D, 0x6F, 0x19, 0x7E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA5, 0x9C, 0xA0, 0x9E, 0x95, 0xEA,
+    0xF6, 0xFE, 0x70, 0xAE, 0x97, 0x6A, 0xCA, 0x74, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0x97, 0x09, 0xA9, 0x1F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E, 0xA6,
+    0xAE, 0x29, 0x97, 0x09, 0x91, 0x09, 0xCA, 0x97, 0xAC, 0xA0, 0x9F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E,
+    0x96, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0x97, 0x49, 0xEA, 0x73, 0xAE, 0xA7,
+    0x39, 0xE9, 0x74, 0x99, 0x70, 0x6E, 0xA0, 0x9F, 0x1F, 0x19, 0xAA, 0x77, 0x77, 0x09, 0xAA, 0x91,
+    0xF0, 0x9F, 0x1E, 0xA6, 0x09, 0xCA, 0x97, 0xAC, 0xA0, 0x9F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E, 0x96,
+    0xAE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xA9, 0x70, 0x9A, 0x91, 0xF6, 0xF9, 0x9F, 0x6F,
+    0x90, 0xEA, 0x6A, 0xE2, 0x99, 0x70, 0x99, 0x10, 0x39, 0x73, 0xFC, 0xA3, 0xAC, 0x90, 0xFF, 0xAA,
+    0xE9, 0xAD, 0x91, 0xAF, 0xDA, 0x1A, 0x94, 0xAD, 0xA9, 0x77, 0x00, 0x77, 0x09, 0xAD, 0xA4, 0x9A,
+    0x1A, 0xFD, 0xA9, 0x09, 0xD9, 0x9E, 0x9A, 0xFF, 0x09, 0xCA, 0x3A, 0xFA, 0x77, 0x77, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x77, 0x76, 0x9F, 0xFF, 0xC9,
+    0x9F, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x39, 0x71, 0xFA, 0x2A, 0xC9,
+    0x0F, 0xEA, 0x9D, 0xA0, 0xDA, 0x9A, 0xFD, 0x90, 0xD3, 0xF9, 0x77, 0xAE, 0x92, 0x9C, 0x90, 0xAF,
+    0xD9, 0x9D, 0xA0, 0xE9, 0xFE, 0x90, 0xD2, 0x9F, 0xA2, 0x94, 0x99, 0x20, 0x09, 0x72, 0x91, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xE1, 0xFF, 0xFC, 0x29, 0xAA, 0xFC, 0xAA, 0x97, 0x77, 0x71, 0x9A, 0xAF, 0xCA,
+    0xA9, 0x2F, 0xFF, 0xC1, 0xEA, 0xAA, 0xAA, 0xAA, 0xE1, 0x97, 0x29, 0x00, 0x77, 0x29, 0xC9, 0x70,
+    0xD9, 0x1A, 0xFF, 0xD9, 0xAF, 0xFD, 0x99, 0xAA, 0xAA, 0xEA, 0xAA, 0x49, 0xD5, 0x99, 0x9D, 0xA9,
+    0x99, 0x90, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x1D, 0xA7, 0x0D, 0x72, 0x97, 0x76, 0x9F, 0xFF, 0xC9,
+    0x9F, 0xFF, 0xC9, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFC, 0x99,
+    0xFF, 0xFC, 0x77, 0x76, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x00, 0x70, 0xA9, 0x7A, 0xE5, 0xAF, 0x93, 0xAF, 0x93, 0xAE, 0xA5, 0xAE, 0x96, 0x9F, 0xA7,
+    0x9F, 0xA7, 0x9F, 0xA7, 0xAF, 0x70, 0xAC, 0xA7, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xD9, 0xAF, 0xFD, 0x90, 0x74, 0xD7, 0x09, 0xEA, 0x7A, 0xFA, 0x79, 0xFA, 0x79, 0xFA, 0x7A, 0xE9,
+    0x49, 0xAE, 0xA3, 0x9F, 0xA3, 0x9F, 0xA4, 0x9E, 0xA7, 0xCA, 0x77, 0x49, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x0A, 0xFF, 0xD9, 0xAF, 0xFD, 0x90, 0x77, 0x74, 0x9C, 0xA6, 0xAC, 0x69, 0xF4, 0xAE, 0x49,
+    0xFA, 0x29, 0xAF, 0x92, 0x9F, 0xA2, 0x9F, 0xA9, 0x29, 0xFA, 0x3F, 0xA5, 0xAE, 0x93, 0x9E, 0xA7,
+    0xAF, 0x92, 0xAF, 0x96, 0x9F, 0xC9, 0x2A, 0xF9, 0x69, 0xFC, 0x92, 0xAF, 0x96, 0x9F, 0x4F, 0x97,
+    0x9C, 0xA5, 0x9D, 0x77, 0x50, 0x77, 0x5C, 0xA6, 0xAC, 0x97, 0x0E, 0xA4, 0xF9, 0x69, 0xFA, 0x29,
+    0xAF, 0x96, 0x9A, 0xF9, 0x2A, 0xF9, 0x7A, 0xF3, 0xAF, 0x96, 0xAE, 0x93, 0x9E, 0xA4, 0x9F, 0xA2,
+    0x9F, 0xA3, 0x9F, 0xA2, 0x9F, 0xC3, 0x9F, 0xA2, 0x9F, 0xC9, 0x39, 0xEA, 0x4F, 0x96, 0xD9, 0x5A,
+    0xC9, 0x77, 0x74, 0xAF, 0xFC, 0xA9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE7, 0x39, 0xAE, 0xA7, 0x4A,
+    0xE7, 0x5E, 0xA7, 0x4E, 0xA7, 0x4A, 0xE7, 0x4E, 0xA7, 0x4E, 0x97, 0x3F, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x9A, 0xFA, 0x0F, 0xFF, 0xDA, 0x1F, 0xFF, 0xC9, 0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x50,
+    0x74, 0x99, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x96, 0x9A, 0xAF, 0xFA, 0x2A, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xE0, 0xAE, 0xA9, 0x2E, 0x4E, 0xA3, 0xAD, 0xA3, 0xAE, 0x4E, 0x4A, 0xE4, 0xE4, 0xEA, 0x3A,
+    0xD9, 0x4A, 0xE3, 0xE5, 0xAE, 0x29, 0xDA, 0x6F, 0x1A, 0xD9, 0x6A, 0xFA, 0xE9, 0x99, 0x99, 0x99,
+    0x1A, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x49, 0xEA, 0xAA, 0xAA, 0xAA, 0x94, 0xAD, 0xA7, 0x4E, 0x75,
+    0xE7, 0x77, 0x10, 0x71, 0x99, 0x75, 0xE7, 0x49, 0xE7, 0x4A, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFF,
+    0xCA, 0x2F, 0xFF, 0xE7, 0x0E, 0x9F, 0xA6, 0x9D, 0xA1, 0xAE, 0x6E, 0x92, 0xEA, 0x5E, 0x3E, 0xA4,
+    0xAD, 0xA3, 0xAE, 0x4E, 0x4E, 0xA3, 0x9E, 0x4E, 0x93, 0xAD, 0x93, 0xF0, 0x99, 0x99, 0xE9, 0x99,
+    0xAF, 0xA0, 0xFF, 0xFD, 0xA1, 0xFF, 0xFC, 0x92, 0x9A, 0xAE, 0xAA, 0xA9, 0x97, 0x9D, 0xA7, 0x4E,
+    0x75, 0xE7, 0x77, 0x40, 0x69, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xE9, 0x19, 0xFF, 0xFC, 0x90,
+    0x9F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0x97, 0x3E, 0x97, 0x39, 0xE7, 0x49, 0xE7, 0x49, 0xE9,
+    0x74, 0xF7, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0xC9, 0x29, 0xFF, 0xF9, 0x59,
+    0x99, 0xAA, 0xAA, 0xAA, 0xA7, 0x72, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xEA, 0x39, 0xFF, 0xFC, 0x92, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xC9, 0x73, 0x9F, 0x74, 0x9E, 0x75, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x3F, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0xAF, 0x90, 0x9F, 0xFF, 0xCA, 0x19, 0xFF, 0xF9, 0x3A, 0xAA, 0xAA, 0xAA, 0x99,
+    0x97, 0x76, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xDA, 0x00, 0x69, 0xAA, 0xA9,
+    0x73, 0xFF, 0xC7, 0x9E, 0x9A, 0xCA, 0x9E, 0x94, 0x9D, 0x91, 0xAC, 0xA1, 0x9D, 0x93, 0xD3, 0xAC,
+    0xA2, 0x9D, 0x2A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x1D, 0x4A, 0xCA, 0x4D, 0x09, 0xCA, 0x4A, 0xCA,
+    0x4D, 0x99, 0xDA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xD9, 0xAF, 0xFF, 0xFC, 0xA9, 0xD9, 0x99, 0x99,
+    0xAC, 0xA9, 0x99, 0x99, 0xD9, 0x9D, 0x4A, 0xCA, 0x4D, 0x90, 0xD4, 0xAC, 0xA4, 0xD1, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xAC, 0xA2, 0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0x9D, 0xA1, 0xAC, 0xA1, 0xAD, 0x94, 0x9E,
+    0xAA, 0xCA, 0xAE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E,
+    0x99, 0x09, 0x9E, 0x94, 0x9D, 0x96, 0x9D, 0x93, 0xD9, 0x70, 0x9D, 0x2A, 0xCA, 0x72, 0xAC, 0xA1,
+    0xD7, 0x4D, 0x09, 0xD7, 0x4D, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xD9, 0xAF, 0xFF,
+    0xFC, 0xA9, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xD9, 0x9D, 0x74, 0xD9, 0x0D, 0x74, 0xD1,
+    0xAC, 0xA7, 0x2A, 0xCA, 0x2D, 0x97, 0x09, 0xD3, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE,
+    0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E, 0x99, 0x09, 0x9E,
+    0x94, 0x9D, 0x96, 0x9D, 0x93, 0xF6, 0xF2, 0xAC, 0xAE, 0x4D, 0xAA, 0xCA, 0x1D, 0x1E, 0x2D, 0xA1,
+    0xD0, 0x9C, 0xA2, 0xE0, 0xDA, 0x2D, 0x99, 0xCA, 0x3F, 0xA3, 0xAC, 0x9A, 0xCA, 0x4E, 0x4A, 0xCA,
+    0x9C, 0xA3, 0xFC, 0x3A, 0xC9, 0x9D, 0x2D, 0xA0, 0xE2, 0xD9, 0x0D, 0x1D, 0xA2, 0xE1, 0xD1, 0xAC,
+    0xAD, 0xA4, 0xEA, 0xCA, 0x2E, 0xA6, 0xF3, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0x97,
+    0xAF, 0xEA, 0x74, 0x99, 0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E, 0x99, 0x09, 0x9E, 0x94,
+    0x9D, 0x96, 0x9D, 0x93, 0xD9, 0x7F, 0x2A, 0xCA, 0x7D, 0xAA, 0xCA, 0x1D, 0x7D, 0xA1, 0xD0, 0x9D,
+    0x6D, 0xA2, 0xD9, 0x9C, 0xA5, 0xDA, 0x3A, 0xC9, 0xAC, 0xA4, 0xDA, 0x4A, 0xCA, 0x9C, 0xA3, 0xDA,
+    0x5A, 0xC9, 0x9D, 0x2D, 0xA6, 0xD9, 0x0D, 0x1D, 0xA7, 0xD1, 0xAC, 0xAD, 0xA7, 0xAC, 0xA2, 0xEA,
+    0x79, 0xD3, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97,
+    0x59, 0x99, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x5A, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC,
+    0xA0, 0x0A, 0xD9, 0x09, 0xF0, 0x9F, 0x1E, 0x96, 0x09, 0xDA, 0x4A, 0xD4, 0xAD, 0x91, 0xF9, 0x2A,
+    0xEA, 0x29, 0xF1, 0xF9, 0x2A, 0xEA, 0x29, 0xF1, 0xAD, 0xA3, 0x9E, 0x4E, 0x97, 0x77, 0x73, 0x97,
+    0x76, 0x9C, 0xA7, 0x74, 0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x09, 0xC9, 0x19, 0xDA, 0x76, 0x9C,
+    0x94, 0x9C, 0xA7, 0x49, 0xD9, 0x19, 0x2A, 0xCA, 0x72, 0x9F, 0xFA, 0x1D, 0xA7, 0x09, 0xFF, 0xD9,
+    0x0A, 0xDA, 0x69, 0xFF, 0xEA, 0x09, 0xEA, 0x49, 0xFF, 0xFA, 0x09, 0xFA, 0x29, 0xFF, 0xEA, 0x2A,
+    0xFC, 0xA1, 0xAF, 0xFA, 0x5F, 0xDA, 0x2A, 0xFE, 0x4A, 0xFD, 0xA4, 0xAF, 0xD9, 0x1A, 0xFE, 0xA6,
+    0xAF, 0xCA, 0x0A, 0xFE, 0xA7, 0x0A, 0xFC, 0x0A, 0xFD, 0xA7, 0x2A, 0xFF, 0xEA, 0x74, 0xAE, 0x90,
+    0xAE, 0xA7, 0x6A, 0xD2, 0xDA, 0x77, 0x0A, 0xC9, 0x0A, 0xCA, 0x77, 0x2A, 0xEA, 0x77, 0x4A, 0xCA,
+    0x77, 0x69, 0x73,
 };
 
 static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 6, 20, 8, 1, 19, 30, 0 }, // !
-    { 9, 9, 11, 1, 18, 21, 30 }, // "
-    { 16, 17, 17, 0, 15, 68, 51 }, // #
-    { 13, 25, 16, 1, 20, 82, 119 }, // $
-    { 23, 21, 25, 1, 19, 121, 201 }, // %
-    { 20, 20, 21, 0, 19, 100, 322 }, // &
-    { 4, 9, 6, 1, 18, 9, 422 }, // '
-    { 8, 25, 10, 1, 20, 50, 431 }, // (
-    { 9, 25, 10, 0, 20, 57, 481 }, // )
-    { 10, 10, 11, 0, 19, 25, 538 }, // *
-    { 12, 12, 16, 2, 14, 36, 563 }, // +
-    { 7, 9, 8, 0, 4, 16, 599 }, // ,
-    { 9, 3, 10, 0, 8, 7, 615 }, // -
-    { 5, 5, 7, 1, 4, 7, 622 }, // .
-    { 13, 20, 14, 0, 18, 65, 629 }, // /
-    { 15, 19, 16, 0, 18, 72, 694 }, // 0
-    { 12, 18, 16, 2, 18, 54, 766 }, // 1
-    { 14, 18, 16, 1, 18, 63, 820 }, // 2
-    { 13, 19, 16, 1, 18, 62, 883 }, // 3
-    { 16, 19, 17, 0, 18, 76, 945 }, // 4
-    { 13, 19, 16, 1, 18, 62, 1021 }, // 5
-    { 14, 19, 16, 1, 18, 67, 1083 }, // 6
-    { 14, 19, 16, 1, 18, 67, 1150 }, // 7
-    { 14, 19, 16, 1, 18, 67, 1217 }, // 8
-    { 14, 19, 16, 1, 18, 67, 1284 }, // 9
-    { 5, 14, 7, 1, 13, 18, 1351 }, // :
-    { 7, 18, 8, 0, 13, 32, 1369 }, // ;
-    { 12, 13, 16, 2, 15, 39, 1401 }, // <
-    { 12, 8, 16, 2, 12, 24, 1440 }, // =
-    { 12, 13, 16, 2, 15, 39, 1464 }, // >
-    { 11, 20, 13, 1, 19, 55, 1503 }, // ?
-    { 23, 23, 25, 1, 18, 133, 1558 }, // @
-    { 20, 18, 21, 0, 18, 90, 1691 }, // A
-    { 16, 19, 17, 0, 18, 76, 1781 }, // B
-    { 15, 19, 17, 1, 18, 72, 1857 }, // C
-    { 19, 19, 20, 0, 18, 91, 1929 }, // D
-    { 16, 18, 17, 0, 18, 72, 2020 }, // E
-    { 14, 18, 15, 0, 18, 63, 2092 }, // F
-    { 17, 19, 19, 1, 18, 81, 2155 }, // G
-    { 21, 18, 22, 0, 18, 95, 2236 }, // H
-    { 10, 18, 11, 0, 18, 45, 2331 }, // I
-    { 12, 24, 11, -2, 18, 72, 2376 }, // J
-    { 19, 19, 20, 0, 18, 91, 2448 }, // K
-    { 16, 18, 17, 0, 18, 72, 2539 }, // L
-    { 24, 18, 25, 0, 18, 108, 2611 }, // M
-    { 21, 19, 22, 0, 18, 100, 2719 }, // N
-    { 18, 19, 20, 1, 18, 86, 2819 }, // O
-    { 16, 18, 17, 0, 18, 72, 2905 }, // P
-    { 19, 24, 21, 1, 18, 114, 2977 }, // Q
-    { 19, 19, 20, 0, 18, 91, 3091 }, // R
-    { 13, 19, 15, 1, 18, 62, 3182 }, // S
-    { 18, 18, 19, 0, 18, 81, 3244 }, // T
-    { 20, 19, 21, 0, 18, 95, 3325 }, // U
-    { 20, 19, 21, 0, 18, 95, 3420 }, // V
-    { 28, 19, 29, 0, 18, 133, 3515 }, // W
-    { 19, 18, 20, 0, 18, 86, 3648 }, // X
-    { 18, 18, 19, 0, 18, 81, 3734 }, // Y
-    { 15, 19, 16, 0, 18, 72, 3815 }, // Z
-    { 7, 24, 9, 1, 20, 42, 3887 }, // [
-    { 13, 20, 14, 0, 18, 65, 3929 }, // <backslash>
-    { 6, 24, 8, 1, 20, 36, 3994 }, // ]
-    { 13, 12, 16, 1, 16, 39, 4030 }, // ^
-    { 13, 3, 14, 0, -1, 10, 4069 }, // _
-    { 6, 6, 17, 5, 21, 9, 4079 }, // `
-    { 14, 15, 16, 1, 14, 53, 4088 }, // a
-    { 16, 21, 16, -1, 20, 84, 4141 }, // b
-    { 13, 15, 14, 0, 14, 49, 4225 }, // c
-    { 16, 21, 17, 0, 20, 84, 4274 }, // d
-    { 13, 15, 14, 0, 14, 49, 4358 }, // e
-    { 13, 20, 14, 0, 20, 65, 4407 }, // f
-    { 15, 20, 16, 0, 14, 75, 4472 }, // g
-    { 17, 20, 18, 0, 20, 85, 4547 }, // h
-    { 9, 20, 10, 0, 20, 45, 4632 }, // i
-    { 9, 26, 8, -2, 20, 59, 4677 }, // j
-    { 16, 21, 17, 0, 20, 84, 4736 }, // k
-    { 9, 20, 10, 0, 20, 45, 4820 }, // l
-    { 25, 14, 26, 0, 14, 88, 4865 }, // m
-    { 17, 14, 18, 0, 14, 60, 4953 }, // n
-    { 15, 15, 16, 0, 14, 57, 5013 }, // o
-    { 15, 20, 16, 0, 14, 75, 5070 }, // p
-    { 15, 20, 16, 0, 14, 75, 5145 }, // q
-    { 12, 14, 13, 0, 14, 42, 5220 }, // r
-    { 11, 15, 13, 1, 14, 42, 5262 }, // s
-    { 12, 18, 12, -1, 17, 54, 5304 }, // t
-    { 17, 15, 18, 0, 14, 64, 5358 }, // u
-    { 17, 14, 18, 0, 13, 60, 5422 }, // v
-    { 23, 14, 24, 0, 13, 81, 5482 }, // w
-    { 16, 13, 17, 0, 13, 52, 5563 }, // x
-    { 17, 19, 18, 0, 13, 81, 5615 }, // y
-    { 13, 14, 14, 0, 13, 46, 5696 }, // z
-    { 9, 25, 11, 1, 20, 57, 5742 }, // {
-    { 4, 23, 8, 2, 20, 23, 5799 }, // |
-    { 9, 25, 10, 0, 20, 57, 5822 }, // }
-    { 13, 5, 16, 1, 11, 17, 5879 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5896 }, //  
-    { 6, 20, 7, 0, 14, 30, 5896 }, // ¡
-    { 13, 25, 16, 1, 20, 82, 5926 }, // ¢
-    { 15, 19, 16, 0, 18, 72, 6008 }, // £
-    { 14, 13, 16, 1, 15, 46, 6080 }, // ¤
-    { 17, 18, 17, -1, 18, 77, 6126 }, // ¥
-    { 4, 23, 8, 2, 20, 23, 6203 }, // ¦
-    { 12, 21, 13, 0, 18, 63, 6226 }, // §
-    { 10, 5, 17, 3, 20, 13, 6289 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6302 }, // ©
-    { 9, 13, 11, 1, 18, 30, 6393 }, // ª
-    { 14, 11, 15, 0, 12, 39, 6423 }, // «
-    { 12, 7, 16, 2, 12, 21, 6462 }, // ¬
-    { 9, 3, 10, 0, 8, 7, 6483 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6490 }, // ®
-    { 9, 3, 17, 4, 18, 7, 6539 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 6546 }, // °
-    { 12, 16, 16, 2, 15, 48, 6571 }, // ±
-    { 10, 12, 12, 1, 21, 30, 6619 }, // ²
-    { 9, 13, 11, 1, 21, 30, 6649 }, // ³
-    { 5, 6, 17, 6, 21, 8, 6679 }, // ´
-    { 16, 20, 18, 1, 14, 80, 6687 }, // µ
-    { 15, 22, 16, 0, 18, 83, 6767 }, // ¶
-    { 5, 5, 7, 1, 9, 7, 6850 }, // ·
-    { 5, 6, 17, 6, -1, 8, 6857 }, // ¸
-    { 9, 12, 11, 1, 21, 27, 6865 }, // ¹
-    { 9, 13, 11, 1, 18, 30, 6892 }, // º
-    { 13, 11, 15, 1, 12, 36, 6922 }, // »
-    { 26, 21, 28, 1, 19, 137, 6958 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 7095 }, // ½
-    { 26, 21, 28, 1, 19, 137, 7227 }, // ¾
-    { 10, 20, 12, 1, 14, 50, 7364 }, // ¿
-    { 20, 25, 21, 0, 25, 125, 7414 }, // À
-    { 20, 25, 21, 0, 25, 125, 7539 }, // Á
-    { 20, 25, 21, 0, 25, 125, 7664 }, // Â
-    { 20, 24, 21, 0, 24, 120, 7789 }, // Ã
-    { 20, 24, 21, 0, 24, 120, 7909 }, // Ä
-    { 20, 25, 21, 0, 25, 125, 8029 }, // Å
-    { 25, 18, 25, -1, 18, 113, 8154 }, // Æ
-    { 15, 25, 17, 1, 18, 94, 8267 }, // Ç
-    { 16, 25, 17, 0, 25, 100, 8361 }, // È
-    { 16, 25, 17, 0, 25, 100, 8461 }, // É
-    { 16, 25, 17, 0, 25, 100, 8561 }, // Ê
-    { 16, 24, 17, 0, 24, 96, 8661 }, // Ë
-    { 10, 25, 11, 0, 25, 63, 8757 }, // Ì
-    { 10, 25, 11, 0, 25, 63, 8820 }, // Í
-    { 10, 25, 11, 0, 25, 63, 8883 }, // Î
-    { 10, 24, 11, 0, 24, 60, 8946 }, // Ï
-    { 19, 19, 20, 0, 18, 91, 9006 }, // Ð
-    { 21, 25, 22, 0, 24, 132, 9097 }, // Ñ
-    { 18, 26, 20, 1, 25, 117, 9229 }, // Ò
-    { 18, 26, 20, 1, 25, 117, 9346 }, // Ó
-    { 18, 26, 20, 1, 25, 117, 9463 }, // Ô
-    { 18, 25, 20, 1, 24, 113, 9580 }, // Õ
-    { 18, 25, 20, 1, 24, 113, 9693 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 9806 }, // ×
-    { 20, 19, 21, 0, 18, 95, 9837 }, // Ø
-    { 20, 26, 21, 0, 25, 130, 9932 }, // Ù
-    { 20, 26, 21, 0, 25, 130, 10062 }, // Ú
-    { 20, 26, 21, 0, 25, 130, 10192 }, // Û
-    { 20, 25, 21, 0, 24, 125, 10322 }, // Ü
-    { 18, 25, 19, 0, 25, 113, 10447 }, // Ý
-    { 16, 18, 17, 0, 18, 72, 10560 }, // Þ
-    { 16, 21, 17, 0, 20, 84, 10632 }, // ß
-    { 14, 22, 16, 1, 21, 77, 10716 }, // à
-    { 14, 22, 16, 1, 21, 77, 10793 }, // á
-    { 14, 22, 16, 1, 21, 77, 10870 }, // â
-    { 14, 21, 16, 1, 20, 74, 10947 }, // ã
-    { 14, 21, 16, 1, 20, 74, 11021 }, // ä
-    { 14, 22, 16, 1, 21, 77, 11095 }, // å
-    { 19, 15, 21, 1, 14, 72, 11172 }, // æ
-    { 13, 21, 14, 0, 14, 69, 11244 }, // ç
-    { 13, 22, 14, 0, 21, 72, 11313 }, // è
-    { 13, 22, 14, 0, 21, 72, 11385 }, // é
-    { 13, 22, 14, 0, 21, 72, 11457 }, // ê
-    { 13, 21, 14, 0, 20, 69, 11529 }, // ë
-    { 9, 21, 10, 0, 21, 48, 11598 }, // ì
-    { 9, 21, 10, 0, 21, 48, 11646 }, // í
-    { 9, 21, 10, 0, 21, 48, 11694 }, // î
-    { 10, 20, 11, 0, 20, 50, 11742 }, // ï
-    { 15, 22, 16, 0, 21, 83, 11792 }, // ð
-    { 17, 20, 18, 0, 20, 85, 11875 }, // ñ
-    { 15, 22, 16, 0, 21, 83, 11960 }, // ò
-    { 15, 22, 16, 0, 21, 83, 12043 }, // ó
-    { 15, 22, 16, 0, 21, 83, 12126 }, // ô
-    { 15, 21, 16, 0, 20, 79, 12209 }, // õ
-    { 15, 21, 16, 0, 20, 79, 12288 }, // ö
-    { 12, 13, 16, 2, 15, 39, 12367 }, // ÷
-    { 15, 15, 16, 0, 14, 57, 12406 }, // ø
-    { 17, 22, 18, 0, 21, 94, 12463 }, // ù
-    { 17, 22, 18, 0, 21, 94, 12557 }, // ú
-    { 17, 22, 18, 0, 21, 94, 12651 }, // û
-    { 17, 21, 18, 0, 20, 90, 12745 }, // ü
-    { 17, 27, 18, 0, 21, 115, 12835 }, // ý
-    { 15, 26, 16, 0, 20, 98, 12950 }, // þ
-    { 17, 26, 18, 0, 20, 111, 13048 }, // ÿ
-    { 20, 23, 21, 0, 23, 115, 13159 }, // Ā
-    { 14, 19, 16, 1, 18, 67, 13274 }, // ā
-    { 20, 24, 21, 0, 24, 120, 13341 }, // Ă
-    { 14, 21, 16, 1, 20, 74, 13461 }, // ă
-    { 20, 24, 21, 0, 18, 120, 13535 }, // Ą
-    { 14, 20, 16, 1, 14, 70, 13655 }, // ą
-    { 15, 26, 17, 1, 25, 98, 13725 }, // Ć
-    { 13, 22, 14, 0, 21, 72, 13823 }, // ć
-    { 15, 26, 17, 1, 25, 98, 13895 }, // Ĉ
-    { 13, 22, 14, 0, 21, 72, 13993 }, // ĉ
-    { 15, 25, 17, 1, 24, 94, 14065 }, // Ċ
-    { 13, 21, 14, 0, 20, 69, 14159 }, // ċ
-    { 15, 26, 17, 1, 25, 98, 14228 }, // Č
-    { 13, 22, 14, 0, 21, 72, 14326 }, // č
-    { 19, 26, 20, 0, 25, 124, 14398 }, // Ď
-    { 18, 21, 19, 0, 20, 95, 14522 }, // ď
-    { 19, 19, 20, 0, 18, 91, 14617 }, // Đ
-    { 16, 21, 17, 0, 20, 84, 14708 }, // đ
-    { 16, 23, 17, 0, 23, 92, 14792 }, // Ē
-    { 13, 19, 14, 0, 18, 62, 14884 }, // ē
-    { 16, 24, 17, 0, 24, 96, 14946 }, // Ĕ
-    { 13, 21, 14, 0, 20, 69, 15042 }, // ĕ
-    { 16, 24, 17, 0, 24, 96, 15111 }, // Ė
-    { 13, 21, 14, 0, 20, 69, 15207 }, // ė
-    { 16, 24, 17, 0, 18, 96, 15276 }, // Ę
-    { 13, 20, 14, 0, 14, 65, 15372 }, // ę
-    { 16, 25, 17, 0, 25, 100, 15437 }, // Ě
-    { 13, 22, 14, 0, 21, 72, 15537 }, // ě
-    { 17, 26, 19, 1, 25, 111, 15609 }, // Ĝ
-    { 15, 27, 16, 0, 21, 102, 15720 }, // ĝ
-    { 17, 25, 19, 1, 24, 107, 15822 }, // Ğ
-    { 15, 26, 16, 0, 20, 98, 15929 }, // ğ
-    { 17, 25, 19, 1, 24, 107, 16027 }, // Ġ
-    { 15, 26, 16, 0, 20, 98, 16134 }, // ġ
-    { 17, 25, 19, 1, 18, 107, 16232 }, // Ģ
-    { 15, 28, 16, 0, 22, 105, 16339 }, // ģ
-    { 21, 25, 22, 0, 25, 132, 16444 }, // Ĥ
-    { 18, 26, 18, -1, 26, 117, 16576 }, // ĥ
-    { 21, 18, 22, 0, 18, 95, 16693 }, // Ħ
-    { 17, 20, 18, 0, 20, 85, 16788 }, // ħ
-    { 10, 24, 11, 0, 24, 60, 16873 }, // Ĩ
-    { 9, 20, 10, 0, 20, 45, 16933 }, // ĩ
-    { 10, 23, 11, 0, 23, 58, 16978 }, // Ī
-    { 9, 18, 10, 0, 18, 41, 17036 }, // ī
-    { 10, 24, 11, 0, 24, 60, 17077 }, // Ĭ
-    { 9, 20, 10, 0, 20, 45, 17137 }, // ĭ
-    { 10, 24, 11, 0, 18, 60, 17182 }, // Į
-    { 10, 26, 11, 0, 20, 65, 17242 }, // į
-    { 10, 24, 11, 0, 24, 60, 17307 }, // İ
-    { 9, 14, 10, 0, 14, 32, 17367 }, // ı
-    { 20, 24, 21, 0, 18, 120, 17399 }, // Ĳ
-    { 16, 26, 17, 0, 20, 104, 17519 }, // ĳ
-    { 12, 31, 11, -2, 25, 93, 17623 }, // Ĵ
-    { 11, 27, 10, -2, 21, 75, 17716 }, // ĵ
-    { 19, 25, 20, 0, 18, 119, 17791 }, // Ķ
-    { 16, 27, 17, 0, 20, 108, 17910 }, // ķ
-    { 17, 15, 18, 0, 14, 64, 18018 }, // ĸ
-    { 16, 25, 17, 0, 25, 100, 18082 }, // Ĺ
-    { 9, 26, 10, 0, 26, 59, 18182 }, // ĺ
-    { 16, 25, 17, 0, 18, 100, 18241 }, // Ļ
-    { 9, 27, 10, 0, 20, 61, 18341 }, // ļ
-    { 16, 20, 17, 0, 20, 80, 18402 }, // Ľ
-    { 11, 20, 12, 0, 20, 55, 18482 }, // ľ
-    { 16, 18, 17, 0, 18, 72, 18537 }, // Ŀ
-    { 14, 20, 15, 0, 20, 70, 18609 }, // ŀ
-    { 17, 18, 17, -1, 18, 77, 18679 }, // Ł
-    { 10, 20, 10, -1, 20, 50, 18756 }, // ł
-    { 21, 26, 22, 0, 25, 137, 18806 }, // Ń
-    { 17, 21, 18, 0, 21, 90, 18943 }, // ń
-    { 21, 25, 22, 0, 18, 132, 19033 }, // Ņ
-    { 17, 21, 18, 0, 14, 90, 19165 }, // ņ
-    { 21, 26, 22, 0, 25, 137, 19255 }, // Ň
-    { 17, 21, 18, 0, 21, 90, 19392 }, // ň
-    { 23, 18, 24, 0, 18, 104, 19482 }, // ŉ
-    { 21, 23, 22, 0, 18, 121, 19586 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 19707 }, // ŋ
-    { 18, 24, 20, 1, 23, 108, 19782 }, // Ō
-    { 15, 19, 16, 0, 18, 72, 19890 }, // ō
-    { 18, 25, 20, 1, 24, 113, 19962 }, // Ŏ
-    { 15, 21, 16, 0, 20, 79, 20075 }, // ŏ
-    { 18, 26, 20, 1, 25, 117, 20154 }, // Ő
-    { 15, 22, 16, 0, 21, 83, 20271 }, // ő
-    { 24, 19, 26, 1, 18, 114, 20354 }, // Œ
-    { 22, 15, 23, 0, 14, 83, 20468 }, // œ
-    { 19, 26, 20, 0, 25, 124, 20551 }, // Ŕ
-    { 12, 21, 13, 0, 21, 63, 20675 }, // ŕ
-    { 19, 25, 20, 0, 18, 119, 20738 }, // Ŗ
-    { 12, 21, 13, 0, 14, 63, 20857 }, // ŗ
-    { 19, 26, 20, 0, 25, 124, 20920 }, // Ř
-    { 12, 21, 13, 0, 21, 63, 21044 }, // ř
-    { 13, 26, 15, 1, 25, 85, 21107 }, // Ś
-    { 11, 22, 13, 1, 21, 61, 21192 }, // ś
-    { 13, 26, 15, 1, 25, 85, 21253 }, // Ŝ
-    { 11, 22, 13, 1, 21, 61, 21338 }, // ŝ
-    { 13, 25, 15, 1, 18, 82, 21399 }, // Ş
-    { 11, 21, 13, 1, 14, 58, 21481 }, // ş
-    { 13, 26, 15, 1, 25, 85, 21539 }, // Š
-    { 11, 22, 13, 1, 21, 61, 21624 }, // š
-    { 18, 25, 19, 0, 18, 113, 21685 }, // Ţ
-    { 12, 24, 12, -1, 17, 72, 21798 }, // ţ
-    { 18, 25, 19, 0, 25, 113, 21870 }, // Ť
-    { 12, 21, 12, -1, 20, 63, 21983 }, // ť
-    { 18, 18, 19, 0, 18, 81, 22046 }, // Ŧ
-    { 12, 18, 12, -1, 17, 54, 22127 }, // ŧ
-    { 20, 25, 21, 0, 24, 125, 22181 }, // Ũ
-    { 17, 21, 18, 0, 20, 90, 22306 }, // ũ
-    { 20, 24, 21, 0, 23, 120, 22396 }, // Ū
-    { 17, 19, 18, 0, 18, 81, 22516 }, // ū
-    { 20, 25, 21, 0, 24, 125, 22597 }, // Ŭ
-    { 17, 21, 18, 0, 20, 90, 22722 }, // ŭ
-    { 20, 26, 21, 0, 25, 130, 22812 }, // Ů
-    { 17, 22, 18, 0, 21, 94, 22942 }, // ů
-    { 20, 26, 21, 0, 25, 130, 23036 }, // Ű
-    { 17, 22, 18, 0, 21, 94, 23166 }, // ű
-    { 20, 24, 21, 0, 18, 120, 23260 }, // Ų
-    { 17, 20, 18, 0, 14, 85, 23380 }, // ų
-    { 28, 26, 29, 0, 25, 182, 23465 }, // Ŵ
-    { 23, 22, 24, 0, 21, 127, 23647 }, // ŵ
-    { 18, 25, 19, 0, 25, 113, 23774 }, // Ŷ
-    { 17, 27, 18, 0, 21, 115, 23887 }, // ŷ
-    { 18, 24, 19, 0, 24, 108, 24002 }, // Ÿ
-    { 15, 26, 16, 0, 25, 98, 24110 }, // Ź
-    { 13, 22, 14, 0, 21, 72, 24208 }, // ź
-    { 15, 25, 16, 0, 24, 94, 24280 }, // Ż
-    { 13, 21, 14, 0, 20, 69, 24374 }, // ż
-    { 15, 26, 16, 0, 25, 98, 24443 }, // Ž
-    { 13, 22, 14, 0, 21, 72, 24541 }, // ž
-    { 13, 20, 14, 0, 20, 65, 24613 }, // ſ
-    { 19, 22, 21, 1, 21, 105, 24678 }, // Ơ
-    { 16, 18, 17, 0, 17, 72, 24783 }, // ơ
-    { 18, 18, 19, 0, 18, 81, 24855 }, // Ƥ
-    { 15, 26, 16, 0, 20, 98, 24936 }, // ƥ
-    { 12, 23, 12, -1, 17, 69, 25034 }, // ƫ
-    { 18, 18, 19, 0, 18, 81, 25103 }, // Ƭ
-    { 14, 21, 14, -1, 20, 74, 25184 }, // ƭ
-    { 18, 23, 19, 0, 18, 104, 25258 }, // Ʈ
-    { 21, 22, 22, 0, 21, 116, 25362 }, // Ư
-    { 17, 18, 18, 0, 17, 77, 25478 }, // ư
-    { 6, 6, 3, -4, 21, 9, 25555 }, // ̀
-    { 5, 6, 4, -2, 21, 8, 25564 }, // ́
-    { 10, 7, 6, -5, 21, 18, 25572 }, // ̂
-    { 10, 5, 6, -5, 20, 13, 25590 }, // ̃
-    { 10, 3, 6, -5, 18, 8, 25603 }, // ̄
-    { 10, 5, 6, -5, 20, 13, 25611 }, // ̆
-    { 6, 5, 4, -3, 20, 8, 25624 }, // ̇
-    { 10, 5, 6, -5, 20, 13, 25632 }, // ̈
-    { 8, 7, 5, -4, 22, 14, 25645 }, // ̉
-    { 8, 7, 5, -4, 21, 14, 25659 }, // ̊
-    { 10, 7, 7, -4, 21, 18, 25673 }, // ̋
-    { 10, 6, 6, -5, 21, 15, 25691 }, // ̌
-    { 10, 7, 5, -6, 21, 18, 25706 }, // ̏
-    { 10, 5, 6, -5, 20, 13, 25724 }, // ̑
-    { 5, 8, 3, -3, 22, 10, 25737 }, // ̒
-    { 5, 7, 4, -2, 22, 9, 25747 }, // ̓
-    { 5, 7, 3, -3, 22, 9, 25756 }, // ̔
-    { 4, 7, 3, -2, 22, 7, 25765 }, // ̕
-    { 5, 6, 3, -3, 16, 8, 25772 }, // ̛
-    { 6, 5, 4, -3, -1, 8, 25780 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 25788 }, // ̤
-    { 6, 6, 4, -3, -1, 9, 25798 }, // ̥
-    { 5, 6, 3, -3, -1, 8, 25807 }, // ̦
-    { 6, 6, 4, -3, -1, 9, 25815 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 25824 }, // ̨
-    { 3, 7, 7, 2, -1, 6, 25835 }, // ̩
-    { 10, 6, 6, -5, -1, 15, 25841 }, // ̭
-    { 10, 6, 6, -5, -1, 15, 25856 }, // ̮
-    { 10, 5, 6, -5, -2, 13, 25871 }, // ̰
-    { 10, 3, 6, -5, -2, 8, 25884 }, // ̱
-    { 10, 5, 6, -5, 20, 13, 25892 }, // ͂
-    { 10, 11, 6, -5, 26, 28, 25905 }, // ̈́
-    { 5, 6, 4, -2, -1, 8, 25933 }, // ͅ
-    { 20, 18, 21, 0, 18, 90, 25941 }, // Α
-    { 16, 19, 17, 0, 18, 76, 26031 }, // Β
-    { 15, 18, 16, 0, 18, 68, 26107 }, // Γ
-    { 17, 18, 18, 0, 18, 77, 26175 }, // Δ
-    { 16, 18, 17, 0, 18, 72, 26252 }, // Ε
-    { 15, 19, 16, 0, 18, 72, 26324 }, // Ζ
-    { 21, 18, 22, 0, 18, 95, 26396 }, // Η
-    { 18, 19, 20, 1, 18, 86, 26491 }, // Θ
-    { 10, 18, 11, 0, 18, 45, 26577 }, // Ι
-    { 19, 19, 20, 0, 18, 91, 26622 }, // Κ
-    { 19, 18, 20, 0, 18, 86, 26713 }, // Λ
-    { 24, 18, 25, 0, 18, 108, 26799 }, // Μ
-    { 21, 19, 22, 0, 18, 100, 26907 }, // Ν
-    { 16, 18, 17, 0, 18, 72, 27007 }, // Ξ
-    { 18, 19, 20, 1, 18, 86, 27079 }, // Ο
-    { 21, 18, 22, 0, 18, 95, 27165 }, // Π
-    { 16, 18, 17, 0, 18, 72, 27260 }, // Ρ
-    { 15, 19, 16, 0, 18, 72, 27332 }, // Σ
-    { 18, 18, 19, 0, 18, 81, 27404 }, // Τ
-    { 18, 18, 19, 0, 18, 81, 27485 }, // Υ
-    { 20, 19, 21, 0, 18, 95, 27566 }, // Φ
-    { 19, 18, 20, 0, 18, 86, 27661 }, // Χ
-    { 22, 18, 23, 0, 18, 99, 27747 }, // Ψ
-    { 21, 18, 22, 0, 18, 95, 27846 }, // Ω
-    { 17, 15, 18, 0, 14, 64, 27941 }, // α
-    { 14, 26, 16, 1, 20, 91, 28005 }, // β
-    { 15, 20, 15, -1, 14, 75, 28096 }, // γ
-    { 15, 21, 16, 0, 20, 79, 28171 }, // δ
-    { 12, 15, 13, 0, 14, 45, 28250 }, // ε
-    { 12, 26, 13, 0, 21, 78, 28295 }, // ζ
-    { 16, 20, 16, -1, 14, 80, 28373 }, // η
-    { 15, 21, 16, 0, 20, 79, 28453 }, // θ
-    { 8, 15, 10, 1, 14, 30, 28532 }, // ι
-    { 14, 15, 16, 1, 14, 53, 28562 }, // κ
-    { 17, 21, 17, -1, 20, 90, 28615 }, // λ
-    { 16, 20, 18, 1, 14, 80, 28705 }, // μ
-    { 15, 15, 15, -1, 14, 57, 28785 }, // ν
-    { 12, 26, 13, 0, 21, 78, 28842 }, // ξ
-    { 15, 15, 16, 0, 14, 57, 28920 }, // ο
-    { 17, 15, 18, 0, 14, 64, 28977 }, // π
-    { 14, 20, 16, 1, 14, 70, 29041 }, // ρ
-    { 12, 19, 13, 0, 14, 57, 29111 }, // ς
-    { 16, 15, 17, 0, 14, 60, 29168 }, // σ
-    { 14, 15, 15, 0, 14, 53, 29228 }, // τ
-    { 16, 15, 16, -1, 14, 60, 29281 }, // υ
-    { 20, 24, 21, 0, 18, 120, 29341 }, // φ
-    { 16, 20, 16, -1, 14, 80, 29461 }, // χ
-    { 21, 24, 21, -1, 18, 126, 29541 }, // ψ
-    { 19, 15, 20, 0, 14, 72, 29667 }, // ω
-    { 20, 24, 21, 0, 18, 120, 29739 }, // Ạ
-    { 14, 20, 16, 1, 14, 70, 29859 }, // ạ
-    { 20, 26, 21, 0, 26, 130, 29929 }, // Ả
-    { 14, 23, 16, 1, 22, 81, 30059 }, // ả
-    { 20, 26, 21, 0, 26, 130, 30140 }, // Ấ
-    { 14, 26, 16, 1, 25, 91, 30270 }, // ấ
-    { 20, 26, 21, 0, 26, 130, 30361 }, // Ầ
-    { 14, 26, 16, 1, 25, 91, 30491 }, // ầ
-    { 20, 26, 21, 0, 26, 130, 30582 }, // Ẩ
-    { 14, 26, 16, 1, 25, 91, 30712 }, // ẩ
-    { 20, 26, 21, 0, 26, 130, 30803 }, // Ẫ
-    { 14, 25, 16, 1, 24, 88, 30933 }, // ẫ
-    { 20, 31, 21, 0, 25, 155, 31021 }, // Ậ
-    { 14, 27, 16, 1, 21, 95, 31176 }, // ậ
-    { 20, 26, 21, 0, 26, 130, 31271 }, // Ắ
-    { 14, 26, 16, 1, 25, 91, 31401 }, // ắ
-    { 20, 26, 21, 0, 26, 130, 31492 }, // Ằ
-    { 14, 26, 16, 1, 25, 91, 31622 }, // ằ
-    { 20, 26, 21, 0, 26, 130, 31713 }, // Ẳ
-    { 14, 26, 16, 1, 25, 91, 31843 }, // ẳ
-    { 20, 26, 21, 0, 26, 130, 31934 }, // Ẵ
-    { 14, 25, 16, 1, 24, 88, 32064 }, // ẵ
-    { 20, 30, 21, 0, 24, 150, 32152 }, // Ặ
-    { 14, 26, 16, 1, 20, 91, 32302 }, // ặ
-    { 16, 24, 17, 0, 18, 96, 32393 }, // Ẹ
-    { 13, 20, 14, 0, 14, 65, 32489 }, // ẹ
-    { 16, 26, 17, 0, 26, 104, 32554 }, // Ẻ
-    { 13, 23, 14, 0, 22, 75, 32658 }, // ẻ
-    { 16, 24, 17, 0, 24, 96, 32733 }, // Ẽ
-    { 13, 21, 14, 0, 20, 69, 32829 }, // ẽ
-    { 16, 26, 17, 0, 26, 104, 32898 }, // Ế
-    { 14, 26, 15, 0, 25, 91, 33002 }, // ế
-    { 16, 26, 17, 0, 26, 104, 33093 }, // Ề
-    { 13, 26, 14, 0, 25, 85, 33197 }, // ề
-    { 16, 26, 17, 0, 26, 104, 33282 }, // Ể
-    { 15, 26, 16, 0, 25, 98, 33386 }, // ể
-    { 16, 26, 17, 0, 26, 104, 33484 }, // Ễ
-    { 13, 25, 14, 0, 24, 82, 33588 }, // ễ
-    { 16, 31, 17, 0, 25, 124, 33670 }, // Ệ
-    { 13, 27, 14, 0, 21, 88, 33794 }, // ệ
-    { 10, 26, 11, 0, 26, 65, 33882 }, // Ỉ
-    { 9, 22, 10, 0, 22, 50, 33947 }, // ỉ
-    { 10, 24, 11, 0, 18, 60, 33997 }, // Ị
-    { 9, 26, 10, 0, 20, 59, 34057 }, // ị
-    { 18, 24, 20, 1, 18, 108, 34116 }, // Ọ
-    { 15, 20, 16, 0, 14, 75, 34224 }, // ọ
-    { 18, 27, 20, 1, 26, 122, 34299 }, // Ỏ
-    { 15, 23, 16, 0, 22, 87, 34421 }, // ỏ
-    { 18, 27, 20, 1, 26, 122, 34508 }, // Ố
-    { 15, 26, 16, 0, 25, 98, 34630 }, // ố
-    { 18, 27, 20, 1, 26, 122, 34728 }, // Ồ
-    { 15, 26, 16, 0, 25, 98, 34850 }, // ồ
-    { 18, 27, 20, 1, 26, 122, 34948 }, // Ổ
-    { 15, 26, 16, 0, 25, 98, 35070 }, // ổ
-    { 18, 27, 20, 1, 26, 122, 35168 }, // Ỗ
-    { 15, 25, 16, 0, 24, 94, 35290 }, // ỗ
-    { 18, 31, 20, 1, 25, 140, 35384 }, // Ộ
-    { 15, 27, 16, 0, 21, 102, 35524 }, // ộ
-    { 19, 26, 21, 1, 25, 124, 35626 }, // Ớ
-    { 16, 22, 17, 0, 21, 88, 35750 }, // ớ
-    { 19, 26, 21, 1, 25, 124, 35838 }, // Ờ
-    { 16, 22, 17, 0, 21, 88, 35962 }, // ờ
-    { 19, 27, 21, 1, 26, 129, 36050 }, // Ở
-    { 16, 23, 17, 0, 22, 92, 36179 }, // ở
-    { 19, 25, 21, 1, 24, 119, 36271 }, // Ỡ
-    { 16, 21, 17, 0, 20, 84, 36390 }, // ỡ
-    { 19, 27, 21, 1, 21, 129, 36474 }, // Ợ
-    { 16, 23, 17, 0, 17, 92, 36603 }, // ợ
-    { 20, 24, 21, 0, 18, 120, 36695 }, // Ụ
-    { 17, 20, 18, 0, 14, 85, 36815 }, // ụ
-    { 20, 27, 21, 0, 26, 135, 36900 }, // Ủ
-    { 17, 23, 18, 0, 22, 98, 37035 }, // ủ
-    { 21, 26, 22, 0, 25, 137, 37133 }, // Ứ
-    { 17, 22, 18, 0, 21, 94, 37270 }, // ứ
-    { 21, 26, 22, 0, 25, 137, 37364 }, // Ừ
-    { 17, 22, 18, 0, 21, 94, 37501 }, // ừ
-    { 21, 27, 22, 0, 26, 142, 37595 }, // Ử
-    { 17, 23, 18, 0, 22, 98, 37737 }, // ử
-    { 21, 25, 22, 0, 24, 132, 37835 }, // Ữ
-    { 17, 21, 18, 0, 20, 90, 37967 }, // ữ
-    { 21, 27, 22, 0, 21, 142, 38057 }, // Ự
-    { 17, 23, 18, 0, 17, 98, 38199 }, // ự
-    { 18, 25, 19, 0, 25, 113, 38297 }, // Ỳ
-    { 17, 27, 18, 0, 21, 115, 38410 }, // ỳ
-    { 18, 24, 19, 0, 18, 108, 38525 }, // Ỵ
-    { 17, 19, 18, 0, 13, 81, 38633 }, // ỵ
-    { 18, 26, 19, 0, 26, 117, 38714 }, // Ỷ
-    { 17, 28, 18, 0, 22, 119, 38831 }, // ỷ
-    { 18, 24, 19, 0, 24, 108, 38950 }, // Ỹ
-    { 17, 26, 18, 0, 20, 111, 39058 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 39169 }, //  
-    { 0, 0, 25, 0, 0, 0, 39169 }, //  
-    { 0, 0, 13, 0, 0, 0, 39169 }, //  
-    { 0, 0, 25, 0, 0, 0, 39169 }, //  
-    { 0, 0, 8, 0, 0, 0, 39169 }, //  
-    { 0, 0, 6, 0, 0, 0, 39169 }, //  
-    { 0, 0, 4, 0, 0, 0, 39169 }, //  
-    { 0, 0, 16, 0, 0, 0, 39169 }, //  
-    { 0, 0, 7, 0, 0, 0, 39169 }, //  
-    { 0, 0, 5, 0, 0, 0, 39169 }, //  
-    { 0, 0, 1, 0, 0, 0, 39169 }, //  
-    { 0, 0, 1, 0, 0, 0, 39169 }, // ​
-    { 2, 21, 2, -1, 15, 11, 39169 }, // ‌
-    { 6, 23, 4, -3, 17, 35, 39180 }, // ‍
-    { 8, 24, 5, -4, 18, 48, 39215 }, // ‎
-    { 8, 24, 5, -4, 18, 48, 39263 }, // ‏
-    { 9, 3, 10, 0, 8, 7, 39311 }, // ‐
-    { 9, 3, 10, 0, 8, 7, 39318 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 39325 }, // ‒
-    { 13, 3, 14, 0, 8, 10, 39335 }, // –
-    { 25, 3, 26, 0, 8, 19, 39345 }, // —
-    { 25, 3, 26, 0, 8, 19, 39364 }, // ―
-    { 9, 26, 13, 2, 20, 59, 39383 }, // ‖
-    { 13, 7, 14, 0, -1, 23, 39442 }, // ‗
-    { 6, 9, 7, 0, 19, 14, 39465 }, // ‘
-    { 6, 9, 7, 0, 19, 14, 39479 }, // ’
-    { 6, 9, 7, 0, 4, 14, 39493 }, // ‚
-    { 6, 9, 7, 0, 19, 14, 39507 }, // ‛
-    { 11, 9, 12, 0, 19, 25, 39521 }, // “
-    { 11, 9, 12, 0, 19, 25, 39546 }, // ”
-    { 11, 9, 12, 0, 4, 25, 39571 }, // „
-    { 11, 9, 12, 0, 19, 25, 39596 }, // ‟
-    { 12, 17, 13, 0, 18, 51, 39621 }, // †
-    { 12, 20, 13, 0, 18, 60, 39672 }, // ‡
-    { 6, 7, 8, 1, 10, 11, 39732 }, // •
-    { 9, 9, 16, 3, 13, 21, 39743 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 39764 }, // ․
-    { 12, 5, 13, 0, 4, 15, 39771 }, // ‥
-    { 23, 5, 25, 1, 4, 29, 39786 }, // …
-    { 5, 5, 7, 1, 9, 7, 39815 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 39822 }, //  
-    { 0, 0, 1, 0, 0, 0, 39822 }, //  
-    { 8, 24, 5, -4, 18, 48, 39822 }, // ‪
-    { 8, 24, 5, -4, 18, 48, 39870 }, // ‫
-    { 8, 24, 5, -4, 18, 48, 39918 }, // ‬
-    { 11, 24, 7, -5, 18, 66, 39966 }, // ‭
-    { 11, 24, 7, -5, 18, 66, 40032 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 40098 }, //  
-    { 33, 21, 35, 1, 19, 174, 40098 }, // ‰
-    { 7, 9, 8, 0, 18, 16, 40272 }, // ′
-    { 12, 9, 13, 0, 18, 27, 40288 }, // ″
-    { 18, 9, 19, 0, 18, 41, 40315 }, // ‴
-    { 7, 9, 8, 0, 18, 16, 40356 }, // ‵
-    { 12, 9, 13, 0, 18, 27, 40372 }, // ‶
-    { 18, 9, 19, 0, 18, 41, 40399 }, // ‷
-    { 11, 6, 13, 1, 0, 17, 40440 }, // ‸
-    { 8, 11, 9, 0, 12, 22, 40457 }, // ‹
-    { 7, 11, 9, 1, 12, 20, 40479 }, // ›
-    { 16, 18, 17, 0, 17, 72, 40499 }, // ※
-    { 13, 20, 15, 1, 19, 65, 40571 }, // ‼
-    { 13, 3, 14, 0, 21, 10, 40636 }, // ‾
-    { 7, 3, 8, 0, 8, 6, 40646 }, // ⁃
-    { 14, 21, 10, -5, 19, 74, 40652 }, // ⁄
-    { 22, 20, 24, 1, 19, 110, 40726 }, // ⁇
-    { 18, 20, 20, 1, 19, 90, 40836 }, // ⁈
-    { 18, 20, 20, 1, 19, 90, 40926 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 41016 }, // ⁓
-    { 23, 9, 24, 0, 18, 52, 41039 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 41091 }, //  
-    { 0, 0, 1, 0, 0, 0, 41091 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 41091 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 41091 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 41091 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 41091 }, // ⁤
-    { 11, 13, 12, 0, 21, 36, 41091 }, // ⁰
-    { 11, 13, 12, 0, 21, 36, 41127 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 41163 }, // ⁵
-    { 10, 13, 12, 1, 21, 33, 41193 }, // ⁶
-    { 10, 13, 12, 1, 21, 33, 41226 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 41259 }, // ⁸
-    { 10, 13, 12, 1, 21, 33, 41289 }, // ⁹
-    { 12, 9, 14, 1, 18, 27, 41322 }, // ⁿ
-    { 11, 12, 12, 0, 8, 33, 41349 }, // ₀
-    { 9, 13, 11, 1, 9, 30, 41382 }, // ₁
-    { 10, 12, 12, 1, 8, 30, 41412 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 41442 }, // ₃
-    { 11, 12, 12, 0, 8, 33, 41469 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 41502 }, // ₅
-    { 10, 12, 12, 1, 8, 30, 41529 }, // ₆
-    { 10, 12, 12, 1, 8, 30, 41559 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 41589 }, // ₈
-    { 10, 12, 12, 1, 8, 30, 41616 }, // ₉
-    { 14, 18, 16, 1, 18, 63, 41646 }, // ₣
-    { 15, 19, 16, 0, 18, 72, 41709 }, // ₤
-    { 34, 19, 35, 0, 18, 162, 41781 }, // ₧
-    { 16, 19, 17, 0, 18, 76, 41943 }, // €
-    { 17, 12, 25, 4, 15, 51, 42019 }, // ←
-    { 13, 17, 25, 6, 17, 56, 42070 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 42126 }, // →
-    { 13, 17, 25, 6, 17, 56, 42177 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 42233 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 42280 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 42327 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 42386 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 42436 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 42486 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 42539 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 42603 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 42667 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 42731 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 42795 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 42851 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 42937 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 43006 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 43065 }, // ∅
-    { 17, 18, 18, 0, 18, 77, 43165 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 43242 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 43323 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 43400 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 43498 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 43562 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 43639 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 43737 }, // ∍
-    { 21, 22, 22, 0, 18, 116, 43801 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 43917 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 44009 }, // −
-    { 13, 20, 14, 0, 18, 65, 44018 }, // ∕
-    { 13, 20, 14, 0, 18, 65, 44083 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 44148 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 44187 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 44212 }, // ∙
-    { 17, 24, 17, -1, 21, 102, 44220 }, // √
-    { 13, 10, 16, 1, 13, 33, 44322 }, // ∝
-    { 16, 10, 17, 0, 13, 40, 44355 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 44395 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 44472 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 44558 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 44584 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 44643 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 44724 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 44805 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 44873 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 44945 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 45043 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 45107 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 45171 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 45194 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 45258 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 45281 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 45338 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 45374 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 45412 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 45451 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 45500 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 45545 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 45593 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 45662 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 45731 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 45795 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 45893 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 45991 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 46068 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 46145 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 46236 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 46327 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 46418 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 46509 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 46577 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 46585 }, // ⋯
-    { 25, 24, 26, 0, 21, 150, 46614 }, // �
+    { 6, 20, 8, 1, 19, 26, 0 }, // !
+    { 9, 9, 11, 1, 18, 23, 26 }, // "
+    { 16, 17, 17, 0, 15, 52, 49 }, // #
+    { 13, 25, 16, 1, 20, 73, 101 }, // $
+    { 23, 21, 25, 1, 19, 87, 174 }, // %
+    { 20, 20, 21, 0, 19, 71, 261 }, // &
+    { 4, 9, 6, 1, 18, 11, 332 }, // '
+    { 8, 25, 10, 1, 20, 39, 343 }, // (
+    { 9, 25, 10, 0, 20, 36, 382 }, // )
+    { 10, 10, 11, 0, 19, 23, 418 }, // *
+    { 12, 12, 16, 2, 14, 29, 441 }, // +
+    { 7, 9, 8, 0, 4, 14, 470 }, // ,
+    { 9, 3, 10, 0, 8, 7, 484 }, // -
+    { 5, 5, 7, 1, 4, 9, 491 }, // .
+    { 13, 20, 14, 0, 18, 38, 500 }, // /
+    { 15, 19, 16, 0, 18, 53, 538 }, // 0
+    { 12, 18, 16, 2, 18, 32, 591 }, // 1
+    { 14, 18, 16, 1, 18, 44, 623 }, // 2
+    { 13, 19, 16, 1, 18, 48, 667 }, // 3
+    { 16, 19, 17, 0, 18, 52, 715 }, // 4
+    { 13, 19, 16, 1, 18, 40, 767 }, // 5
+    { 14, 19, 16, 1, 18, 51, 807 }, // 6
+    { 14, 19, 16, 1, 18, 40, 858 }, // 7
+    { 14, 19, 16, 1, 18, 54, 898 }, // 8
+    { 14, 19, 16, 1, 18, 48, 952 }, // 9
+    { 5, 14, 7, 1, 13, 15, 1000 }, // :
+    { 7, 18, 8, 0, 13, 23, 1015 }, // ;
+    { 12, 13, 16, 2, 15, 25, 1038 }, // <
+    { 12, 8, 16, 2, 12, 23, 1063 }, // =
+    { 12, 13, 16, 2, 15, 24, 1086 }, // >
+    { 11, 20, 13, 1, 19, 34, 1110 }, // ?
+    { 23, 23, 25, 1, 18, 106, 1144 }, // @
+    { 20, 18, 21, 0, 18, 54, 1250 }, // A
+    { 16, 19, 17, 0, 18, 50, 1304 }, // B
+    { 15, 19, 17, 1, 18, 47, 1354 }, // C
+    { 19, 19, 20, 0, 18, 54, 1401 }, // D
+    { 16, 18, 17, 0, 18, 51, 1455 }, // E
+    { 14, 18, 15, 0, 18, 45, 1506 }, // F
+    { 17, 19, 19, 1, 18, 59, 1551 }, // G
+    { 21, 18, 22, 0, 18, 69, 1610 }, // H
+    { 10, 18, 11, 0, 18, 27, 1679 }, // I
+    { 12, 24, 11, -2, 18, 35, 1706 }, // J
+    { 19, 19, 20, 0, 18, 64, 1741 }, // K
+    { 16, 18, 17, 0, 18, 42, 1805 }, // L
+    { 24, 18, 25, 0, 18, 89, 1847 }, // M
+    { 21, 19, 22, 0, 18, 70, 1936 }, // N
+    { 18, 19, 20, 1, 18, 57, 2006 }, // O
+    { 16, 18, 17, 0, 18, 46, 2063 }, // P
+    { 19, 24, 21, 1, 18, 75, 2109 }, // Q
+    { 19, 19, 20, 0, 18, 54, 2184 }, // R
+    { 13, 19, 15, 1, 18, 52, 2238 }, // S
+    { 18, 18, 19, 0, 18, 50, 2290 }, // T
+    { 20, 19, 21, 0, 18, 71, 2340 }, // U
+    { 20, 19, 21, 0, 18, 61, 2411 }, // V
+    { 28, 19, 29, 0, 18, 98, 2472 }, // W
+    { 19, 18, 20, 0, 18, 64, 2570 }, // X
+    { 18, 18, 19, 0, 18, 53, 2634 }, // Y
+    { 15, 19, 16, 0, 18, 53, 2687 }, // Z
+    { 7, 24, 9, 1, 20, 51, 2740 }, // [
+    { 13, 20, 14, 0, 18, 38, 2791 }, // <backslash>
+    { 6, 24, 8, 1, 20, 37, 2829 }, // ]
+    { 13, 12, 16, 1, 16, 32, 2866 }, // ^
+    { 13, 3, 14, 0, -1, 11, 2898 }, // _
+    { 6, 6, 17, 5, 21, 10, 2909 }, // `
+    { 14, 15, 16, 1, 14, 40, 2919 }, // a
+    { 16, 21, 16, -1, 20, 54, 2959 }, // b
+    { 13, 15, 14, 0, 14, 34, 3013 }, // c
+    { 16, 21, 17, 0, 20, 63, 3047 }, // d
+    { 13, 15, 14, 0, 14, 39, 3110 }, // e
+    { 13, 20, 14, 0, 20, 47, 3149 }, // f
+    { 15, 20, 16, 0, 14, 63, 3196 }, // g
+    { 17, 20, 18, 0, 20, 69, 3259 }, // h
+    { 9, 20, 10, 0, 20, 37, 3328 }, // i
+    { 9, 26, 8, -2, 20, 41, 3365 }, // j
+    { 16, 21, 17, 0, 20, 59, 3406 }, // k
+    { 9, 20, 10, 0, 20, 40, 3465 }, // l
+    { 25, 14, 26, 0, 14, 85, 3505 }, // m
+    { 17, 14, 18, 0, 14, 52, 3590 }, // n
+    { 15, 15, 16, 0, 14, 40, 3642 }, // o
+    { 15, 20, 16, 0, 14, 63, 3682 }, // p
+    { 15, 20, 16, 0, 14, 59, 3745 }, // q
+    { 12, 14, 13, 0, 14, 34, 3804 }, // r
+    { 11, 15, 13, 1, 14, 36, 3838 }, // s
+    { 12, 18, 12, -1, 17, 31, 3874 }, // t
+    { 17, 15, 18, 0, 14, 40, 3905 }, // u
+    { 17, 14, 18, 0, 13, 39, 3945 }, // v
+    { 23, 14, 24, 0, 13, 63, 3984 }, // w
+    { 16, 13, 17, 0, 13, 41, 4047 }, // x
+    { 17, 19, 18, 0, 13, 54, 4088 }, // y
+    { 13, 14, 14, 0, 13, 36, 4142 }, // z
+    { 9, 25, 11, 1, 20, 42, 4178 }, // {
+    { 4, 23, 8, 2, 20, 34, 4220 }, // |
+    { 9, 25, 10, 0, 20, 42, 4254 }, // }
+    { 13, 5, 16, 1, 11, 18, 4296 }, // ~
+    { 0, 0, 5, 0, 0, 0, 4314 }, //  
+    { 6, 20, 7, 0, 14, 28, 4314 }, // ¡
+    { 13, 25, 16, 1, 20, 65, 4342 }, // ¢
+    { 15, 19, 16, 0, 18, 53, 4407 }, // £
+    { 14, 13, 16, 1, 15, 39, 4460 }, // ¤
+    { 17, 18, 17, -1, 18, 49, 4499 }, // ¥
+    { 4, 23, 8, 2, 20, 29, 4548 }, // ¦
+    { 12, 21, 13, 0, 18, 53, 4577 }, // §
+    { 10, 5, 17, 3, 20, 14, 4630 }, // ¨
+    { 19, 19, 20, 0, 18, 87, 4644 }, // ©
+    { 9, 13, 11, 1, 18, 31, 4731 }, // ª
+    { 14, 11, 15, 0, 12, 30, 4762 }, // «
+    { 12, 7, 16, 2, 12, 20, 4792 }, // ¬
+    { 9, 3, 10, 0, 8, 7, 4812 }, // ­
+    { 14, 14, 15, 0, 20, 63, 4819 }, // ®
+    { 9, 3, 17, 4, 18, 9, 4882 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 4891 }, // °
+    { 12, 16, 16, 2, 15, 41, 4916 }, // ±
+    { 10, 12, 12, 1, 21, 31, 4957 }, // ²
+    { 9, 13, 11, 1, 21, 28, 4988 }, // ³
+    { 5, 6, 17, 6, 21, 9, 5016 }, // ´
+    { 16, 20, 18, 1, 14, 68, 5025 }, // µ
+    { 15, 22, 16, 0, 18, 69, 5093 }, // ¶
+    { 5, 5, 7, 1, 9, 6, 5162 }, // ·
+    { 5, 6, 17, 6, -1, 10, 5168 }, // ¸
+    { 9, 12, 11, 1, 21, 26, 5178 }, // ¹
+    { 9, 13, 11, 1, 18, 28, 5204 }, // º
+    { 13, 11, 15, 1, 12, 32, 5232 }, // »
+    { 26, 21, 28, 1, 19, 91, 5264 }, // ¼
+    { 25, 21, 27, 1, 19, 86, 5355 }, // ½
+    { 26, 21, 28, 1, 19, 95, 5441 }, // ¾
+    { 10, 20, 12, 1, 14, 33, 5536 }, // ¿
+    { 20, 25, 21, 0, 25, 69, 5569 }, // À
+    { 20, 25, 21, 0, 25, 67, 5638 }, // Á
+    { 20, 25, 21, 0, 25, 71, 5705 }, // Â
+    { 20, 24, 21, 0, 24, 71, 5776 }, // Ã
+    { 20, 24, 21, 0, 24, 71, 5847 }, // Ä
+    { 20, 25, 21, 0, 25, 74, 5918 }, // Å
+    { 25, 18, 25, -1, 18, 79, 5992 }, // Æ
+    { 15, 25, 17, 1, 18, 61, 6071 }, // Ç
+    { 16, 25, 17, 0, 25, 63, 6132 }, // È
+    { 16, 25, 17, 0, 25, 64, 6195 }, // É
+    { 16, 25, 17, 0, 25, 63, 6259 }, // Ê
+    { 16, 24, 17, 0, 24, 65, 6322 }, // Ë
+    { 10, 25, 11, 0, 25, 37, 6387 }, // Ì
+    { 10, 25, 11, 0, 25, 36, 6424 }, // Í
+    { 10, 25, 11, 0, 25, 39, 6460 }, // Î
+    { 10, 24, 11, 0, 24, 40, 6499 }, // Ï
+    { 19, 19, 20, 0, 18, 59, 6539 }, // Ð
+    { 21, 25, 22, 0, 24, 86, 6598 }, // Ñ
+    { 18, 26, 20, 1, 25, 69, 6684 }, // Ò
+    { 18, 26, 20, 1, 25, 71, 6753 }, // Ó
+    { 18, 26, 20, 1, 25, 77, 6824 }, // Ô
+    { 18, 25, 20, 1, 24, 73, 6901 }, // Õ
+    { 18, 25, 20, 1, 24, 72, 6974 }, // Ö
+    { 11, 11, 16, 2, 14, 28, 7046 }, // ×
+    { 20, 19, 21, 0, 18, 73, 7074 }, // Ø
+    { 20, 26, 21, 0, 25, 86, 7147 }, // Ù
+    { 20, 26, 21, 0, 25, 85, 7233 }, // Ú
+    { 20, 26, 21, 0, 25, 87, 7318 }, // Û
+    { 20, 25, 21, 0, 24, 88, 7405 }, // Ü
+    { 18, 25, 19, 0, 25, 67, 7493 }, // Ý
+    { 16, 18, 17, 0, 18, 46, 7560 }, // Þ
+    { 16, 21, 17, 0, 20, 70, 7606 }, // ß
+    { 14, 22, 16, 1, 21, 52, 7676 }, // à
+    { 14, 22, 16, 1, 21, 52, 7728 }, // á
+    { 14, 22, 16, 1, 21, 54, 7780 }, // â
+    { 14, 21, 16, 1, 20, 53, 7834 }, // ã
+    { 14, 21, 16, 1, 20, 53, 7887 }, // ä
+    { 14, 22, 16, 1, 21, 57, 7940 }, // å
+    { 19, 15, 21, 1, 14, 61, 7997 }, // æ
+    { 13, 21, 14, 0, 14, 48, 8058 }, // ç
+    { 13, 22, 14, 0, 21, 51, 8106 }, // è
+    { 13, 22, 14, 0, 21, 50, 8157 }, // é
+    { 13, 22, 14, 0, 21, 53, 8207 }, // ê
+    { 13, 21, 14, 0, 20, 51, 8260 }, // ë
+    { 9, 21, 10, 0, 21, 36, 8311 }, // ì
+    { 9, 21, 10, 0, 21, 38, 8347 }, // í
+    { 9, 21, 10, 0, 21, 40, 8385 }, // î
+    { 10, 20, 11, 0, 20, 41, 8425 }, // ï
+    { 15, 22, 16, 0, 21, 54, 8466 }, // ð
+    { 17, 20, 18, 0, 20, 67, 8520 }, // ñ
+    { 15, 22, 16, 0, 21, 52, 8587 }, // ò
+    { 15, 22, 16, 0, 21, 53, 8639 }, // ó
+    { 15, 22, 16, 0, 21, 54, 8692 }, // ô
+    { 15, 21, 16, 0, 20, 54, 8746 }, // õ
+    { 15, 21, 16, 0, 20, 54, 8800 }, // ö
+    { 12, 13, 16, 2, 15, 30, 8854 }, // ÷
+    { 15, 15, 16, 0, 14, 45, 8884 }, // ø
+    { 17, 22, 18, 0, 21, 53, 8929 }, // ù
+    { 17, 22, 18, 0, 21, 53, 8982 }, // ú
+    { 17, 22, 18, 0, 21, 57, 9035 }, // û
+    { 17, 21, 18, 0, 20, 54, 9092 }, // ü
+    { 17, 27, 18, 0, 21, 68, 9146 }, // ý
+    { 15, 26, 16, 0, 20, 75, 9214 }, // þ
+    { 17, 26, 18, 0, 20, 70, 9289 }, // ÿ
+    { 20, 23, 21, 0, 23, 66, 9359 }, // Ā
+    { 14, 19, 16, 1, 18, 49, 9425 }, // ā
+    { 20, 24, 21, 0, 24, 70, 9474 }, // Ă
+    { 14, 21, 16, 1, 20, 53, 9544 }, // ă
+    { 20, 24, 21, 0, 18, 68, 9597 }, // Ą
+    { 14, 20, 16, 1, 14, 51, 9665 }, // ą
+    { 15, 26, 17, 1, 25, 61, 9716 }, // Ć
+    { 13, 22, 14, 0, 21, 46, 9777 }, // ć
+    { 15, 26, 17, 1, 25, 63, 9823 }, // Ĉ
+    { 13, 22, 14, 0, 21, 50, 9886 }, // ĉ
+    { 15, 25, 17, 1, 24, 60, 9936 }, // Ċ
+    { 13, 21, 14, 0, 20, 44, 9996 }, // ċ
+    { 15, 26, 17, 1, 25, 62, 10040 }, // Č
+    { 13, 22, 14, 0, 21, 49, 10102 }, // č
+    { 19, 26, 20, 0, 25, 70, 10151 }, // Ď
+    { 18, 21, 19, 0, 20, 71, 10221 }, // ď
+    { 19, 19, 20, 0, 18, 59, 10292 }, // Đ
+    { 16, 21, 17, 0, 20, 66, 10351 }, // đ
+    { 16, 23, 17, 0, 23, 60, 10417 }, // Ē
+    { 13, 19, 14, 0, 18, 49, 10477 }, // ē
+    { 16, 24, 17, 0, 24, 64, 10526 }, // Ĕ
+    { 13, 21, 14, 0, 20, 51, 10590 }, // ĕ
+    { 16, 24, 17, 0, 24, 61, 10641 }, // Ė
+    { 13, 21, 14, 0, 20, 48, 10702 }, // ė
+    { 16, 24, 17, 0, 18, 64, 10750 }, // Ę
+    { 13, 20, 14, 0, 14, 50, 10814 }, // ę
+    { 16, 25, 17, 0, 25, 67, 10864 }, // Ě
+    { 13, 22, 14, 0, 21, 54, 10931 }, // ě
+    { 17, 26, 19, 1, 25, 73, 10985 }, // Ĝ
+    { 15, 27, 16, 0, 21, 79, 11058 }, // ĝ
+    { 17, 25, 19, 1, 24, 73, 11137 }, // Ğ
+    { 15, 26, 16, 0, 20, 76, 11210 }, // ğ
+    { 17, 25, 19, 1, 24, 69, 11286 }, // Ġ
+    { 15, 26, 16, 0, 20, 73, 11355 }, // ġ
+    { 17, 25, 19, 1, 18, 73, 11428 }, // Ģ
+    { 15, 28, 16, 0, 22, 77, 11501 }, // ģ
+    { 21, 25, 22, 0, 25, 88, 11578 }, // Ĥ
+    { 18, 26, 18, -1, 26, 84, 11666 }, // ĥ
+    { 21, 18, 22, 0, 18, 74, 11750 }, // Ħ
+    { 17, 20, 18, 0, 20, 69, 11824 }, // ħ
+    { 10, 24, 11, 0, 24, 41, 11893 }, // Ĩ
+    { 9, 20, 10, 0, 20, 40, 11934 }, // ĩ
+    { 10, 23, 11, 0, 23, 36, 11974 }, // Ī
+    { 9, 18, 10, 0, 18, 36, 12010 }, // ī
+    { 10, 24, 11, 0, 24, 39, 12046 }, // Ĭ
+    { 9, 20, 10, 0, 20, 40, 12085 }, // ĭ
+    { 10, 24, 11, 0, 18, 37, 12125 }, // Į
+    { 10, 26, 11, 0, 20, 48, 12162 }, // į
+    { 10, 24, 11, 0, 24, 36, 12210 }, // İ
+    { 9, 14, 10, 0, 14, 28, 12246 }, // ı
+    { 20, 24, 21, 0, 18, 79, 12274 }, // Ĳ
+    { 16, 26, 17, 0, 20, 74, 12353 }, // ĳ
+    { 12, 31, 11, -2, 25, 48, 12427 }, // Ĵ
+    { 11, 27, 10, -2, 21, 46, 12475 }, // ĵ
+    { 19, 25, 20, 0, 18, 77, 12521 }, // Ķ
+    { 16, 27, 17, 0, 20, 72, 12598 }, // ķ
+    { 17, 15, 18, 0, 14, 48, 12670 }, // ĸ
+    { 16, 25, 17, 0, 25, 54, 12718 }, // Ĺ
+    { 9, 26, 10, 0, 26, 51, 12772 }, // ĺ
+    { 16, 25, 17, 0, 18, 56, 12823 }, // Ļ
+    { 9, 27, 10, 0, 20, 50, 12879 }, // ļ
+    { 16, 20, 17, 0, 20, 50, 12929 }, // Ľ
+    { 11, 20, 12, 0, 20, 48, 12979 }, // ľ
+    { 16, 18, 17, 0, 18, 46, 13027 }, // Ŀ
+    { 14, 20, 15, 0, 20, 51, 13073 }, // ŀ
+    { 17, 18, 17, -1, 18, 48, 13124 }, // Ł
+    { 10, 20, 10, -1, 20, 42, 13172 }, // ł
+    { 21, 26, 22, 0, 25, 84, 13214 }, // Ń
+    { 17, 21, 18, 0, 21, 66, 13298 }, // ń
+    { 21, 25, 22, 0, 18, 86, 13364 }, // Ņ
+    { 17, 21, 18, 0, 14, 67, 13450 }, // ņ
+    { 21, 26, 22, 0, 25, 87, 13517 }, // Ň
+    { 17, 21, 18, 0, 21, 70, 13604 }, // ň
+    { 23, 18, 24, 0, 18, 75, 13674 }, // ŉ
+    { 21, 23, 22, 0, 18, 81, 13749 }, // Ŋ
+    { 15, 20, 16, 0, 14, 64, 13830 }, // ŋ
+    { 18, 24, 20, 1, 23, 69, 13894 }, // Ō
+    { 15, 19, 16, 0, 18, 50, 13963 }, // ō
+    { 18, 25, 20, 1, 24, 73, 14013 }, // Ŏ
+    { 15, 21, 16, 0, 20, 55, 14086 }, // ŏ
+    { 18, 26, 20, 1, 25, 77, 14141 }, // Ő
+    { 15, 22, 16, 0, 21, 59, 14218 }, // ő
+    { 24, 19, 26, 1, 18, 87, 14277 }, // Œ
+    { 22, 15, 23, 0, 14, 60, 14364 }, // œ
+    { 19, 26, 20, 0, 25, 67, 14424 }, // Ŕ
+    { 12, 21, 13, 0, 21, 45, 14491 }, // ŕ
+    { 19, 25, 20, 0, 18, 68, 14536 }, // Ŗ
+    { 12, 21, 13, 0, 14, 46, 14604 }, // ŗ
+    { 19, 26, 20, 0, 25, 70, 14650 }, // Ř
+    { 12, 21, 13, 0, 21, 49, 14720 }, // ř
+    { 13, 26, 15, 1, 25, 63, 14769 }, // Ś
+    { 11, 22, 13, 1, 21, 47, 14832 }, // ś
+    { 13, 26, 15, 1, 25, 67, 14879 }, // Ŝ
+    { 11, 22, 13, 1, 21, 50, 14946 }, // ŝ
+    { 13, 25, 15, 1, 18, 65, 14996 }, // Ş
+    { 11, 21, 13, 1, 14, 48, 15061 }, // ş
+    { 13, 26, 15, 1, 25, 66, 15109 }, // Š
+    { 11, 22, 13, 1, 21, 52, 15175 }, // š
+    { 18, 25, 19, 0, 18, 63, 15227 }, // Ţ
+    { 12, 24, 12, -1, 17, 42, 15290 }, // ţ
+    { 18, 25, 19, 0, 25, 65, 15332 }, // Ť
+    { 12, 21, 12, -1, 20, 41, 15397 }, // ť
+    { 18, 18, 19, 0, 18, 56, 15438 }, // Ŧ
+    { 12, 18, 12, -1, 17, 36, 15494 }, // ŧ
+    { 20, 25, 21, 0, 24, 87, 15530 }, // Ũ
+    { 17, 21, 18, 0, 20, 55, 15617 }, // ũ
+    { 20, 24, 21, 0, 23, 82, 15672 }, // Ū
+    { 17, 19, 18, 0, 18, 50, 15754 }, // ū
+    { 20, 25, 21, 0, 24, 86, 15804 }, // Ŭ
+    { 17, 21, 18, 0, 20, 54, 15890 }, // ŭ
+    { 20, 26, 21, 0, 25, 90, 15944 }, // Ů
+    { 17, 22, 18, 0, 21, 60, 16034 }, // ů
+    { 20, 26, 21, 0, 25, 94, 16094 }, // Ű
+    { 17, 22, 18, 0, 21, 63, 16188 }, // ű
+    { 20, 24, 21, 0, 18, 82, 16251 }, // Ų
+    { 17, 20, 18, 0, 14, 51, 16333 }, // ų
+    { 28, 26, 29, 0, 25, 120, 16384 }, // Ŵ
+    { 23, 22, 24, 0, 21, 84, 16504 }, // ŵ
+    { 18, 25, 19, 0, 25, 71, 16588 }, // Ŷ
+    { 17, 27, 18, 0, 21, 72, 16659 }, // ŷ
+    { 18, 24, 19, 0, 24, 69, 16731 }, // Ÿ
+    { 15, 26, 16, 0, 25, 67, 16800 }, // Ź
+    { 13, 22, 14, 0, 21, 49, 16867 }, // ź
+    { 15, 25, 16, 0, 24, 65, 16916 }, // Ż
+    { 13, 21, 14, 0, 20, 47, 16981 }, // ż
+    { 15, 26, 16, 0, 25, 67, 17028 }, // Ž
+    { 13, 22, 14, 0, 21, 51, 17095 }, // ž
+    { 13, 20, 14, 0, 20, 45, 17146 }, // ſ
+    { 19, 22, 21, 1, 21, 68, 17191 }, // Ơ
+    { 16, 18, 17, 0, 17, 47, 17259 }, // ơ
+    { 18, 18, 19, 0, 18, 62, 17306 }, // Ƥ
+    { 15, 26, 16, 0, 20, 79, 17368 }, // ƥ
+    { 12, 23, 12, -1, 17, 44, 17447 }, // ƫ
+    { 18, 18, 19, 0, 18, 50, 17491 }, // Ƭ
+    { 14, 21, 14, -1, 20, 44, 17541 }, // ƭ
+    { 18, 23, 19, 0, 18, 59, 17585 }, // Ʈ
+    { 21, 22, 22, 0, 21, 79, 17644 }, // Ư
+    { 17, 18, 18, 0, 17, 47, 17723 }, // ư
+    { 6, 6, 3, -4, 21, 10, 17770 }, // ̀
+    { 5, 6, 4, -2, 21, 8, 17780 }, // ́
+    { 10, 7, 6, -5, 21, 14, 17788 }, // ̂
+    { 10, 5, 6, -5, 20, 12, 17802 }, // ̃
+    { 10, 3, 6, -5, 18, 8, 17814 }, // ̄
+    { 10, 5, 6, -5, 20, 12, 17822 }, // ̆
+    { 6, 5, 4, -3, 20, 7, 17834 }, // ̇
+    { 10, 5, 6, -5, 20, 11, 17841 }, // ̈
+    { 8, 7, 5, -4, 22, 15, 17852 }, // ̉
+    { 8, 7, 5, -4, 21, 17, 17867 }, // ̊
+    { 10, 7, 7, -4, 21, 19, 17884 }, // ̋
+    { 10, 6, 6, -5, 21, 14, 17903 }, // ̌
+    { 10, 7, 5, -6, 21, 19, 17917 }, // ̏
+    { 10, 5, 6, -5, 20, 13, 17936 }, // ̑
+    { 5, 8, 3, -3, 22, 11, 17949 }, // ̒
+    { 5, 7, 4, -2, 22, 13, 17960 }, // ̓
+    { 5, 7, 3, -3, 22, 12, 17973 }, // ̔
+    { 4, 7, 3, -2, 22, 10, 17985 }, // ̕
+    { 5, 6, 3, -3, 16, 9, 17995 }, // ̛
+    { 6, 5, 4, -3, -1, 7, 18004 }, // ̣
+    { 10, 4, 6, -5, -2, 14, 18011 }, // ̤
+    { 6, 6, 4, -3, -1, 11, 18025 }, // ̥
+    { 5, 6, 3, -3, -1, 9, 18036 }, // ̦
+    { 6, 6, 4, -3, -1, 11, 18045 }, // ̧
+    { 6, 7, 4, -3, 1, 11, 18056 }, // ̨
+    { 3, 7, 7, 2, -1, 4, 18067 }, // ̩
+    { 10, 6, 6, -5, -1, 13, 18071 }, // ̭
+    { 10, 6, 6, -5, -1, 12, 18084 }, // ̮
+    { 10, 5, 6, -5, -2, 13, 18096 }, // ̰
+    { 10, 3, 6, -5, -2, 8, 18109 }, // ̱
+    { 10, 5, 6, -5, 20, 13, 18117 }, // ͂
+    { 10, 11, 6, -5, 26, 16, 18130 }, // ̈́
+    { 5, 6, 4, -2, -1, 8, 18146 }, // ͅ
+    { 20, 18, 21, 0, 18, 54, 18154 }, // Α
+    { 16, 19, 17, 0, 18, 50, 18208 }, // Β
+    { 15, 18, 16, 0, 18, 44, 18258 }, // Γ
+    { 17, 18, 18, 0, 18, 50, 18302 }, // Δ
+    { 16, 18, 17, 0, 18, 51, 18352 }, // Ε
+    { 15, 19, 16, 0, 18, 53, 18403 }, // Ζ
+    { 21, 18, 22, 0, 18, 69, 18456 }, // Η
+    { 18, 19, 20, 1, 18, 64, 18525 }, // Θ
+    { 10, 18, 11, 0, 18, 27, 18589 }, // Ι
+    { 19, 19, 20, 0, 18, 64, 18616 }, // Κ
+    { 19, 18, 20, 0, 18, 55, 18680 }, // Λ
+    { 24, 18, 25, 0, 18, 89, 18735 }, // Μ
+    { 21, 19, 22, 0, 18, 70, 18824 }, // Ν
+    { 16, 18, 17, 0, 18, 62, 18894 }, // Ξ
+    { 18, 19, 20, 1, 18, 57, 18956 }, // Ο
+    { 21, 18, 22, 0, 18, 59, 19013 }, // Π
+    { 16, 18, 17, 0, 18, 46, 19072 }, // Ρ
+    { 15, 19, 16, 0, 18, 54, 19118 }, // Σ
+    { 18, 18, 19, 0, 18, 50, 19172 }, // Τ
+    { 18, 18, 19, 0, 18, 53, 19222 }, // Υ
+    { 20, 19, 21, 0, 18, 66, 19275 }, // Φ
+    { 19, 18, 20, 0, 18, 64, 19341 }, // Χ
+    { 22, 18, 23, 0, 18, 74, 19405 }, // Ψ
+    { 21, 18, 22, 0, 18, 67, 19479 }, // Ω
+    { 17, 15, 18, 0, 14, 49, 19546 }, // α
+    { 14, 26, 16, 1, 20, 83, 19595 }, // β
+    { 15, 20, 15, -1, 14, 51, 19678 }, // γ
+    { 15, 21, 16, 0, 20, 56, 19729 }, // δ
+    { 12, 15, 13, 0, 14, 35, 19785 }, // ε
+    { 12, 26, 13, 0, 21, 51, 19820 }, // ζ
+    { 16, 20, 16, -1, 14, 60, 19871 }, // η
+    { 15, 21, 16, 0, 20, 62, 19931 }, // θ
+    { 8, 15, 10, 1, 14, 26, 19993 }, // ι
+    { 14, 15, 16, 1, 14, 48, 20019 }, // κ
+    { 17, 21, 17, -1, 20, 55, 20067 }, // λ
+    { 16, 20, 18, 1, 14, 68, 20122 }, // μ
+    { 15, 15, 15, -1, 14, 40, 20190 }, // ν
+    { 12, 26, 13, 0, 21, 50, 20230 }, // ξ
+    { 15, 15, 16, 0, 14, 40, 20280 }, // ο
+    { 17, 15, 18, 0, 14, 47, 20320 }, // π
+    { 14, 20, 16, 1, 14, 55, 20367 }, // ρ
+    { 12, 19, 13, 0, 14, 38, 20422 }, // ς
+    { 16, 15, 17, 0, 14, 45, 20460 }, // σ
+    { 14, 15, 15, 0, 14, 38, 20505 }, // τ
+    { 16, 15, 16, -1, 14, 39, 20543 }, // υ
+    { 20, 24, 21, 0, 18, 68, 20582 }, // φ
+    { 16, 20, 16, -1, 14, 58, 20650 }, // χ
+    { 21, 24, 21, -1, 18, 84, 20708 }, // ψ
+    { 19, 15, 20, 0, 14, 60, 20792 }, // ω
+    { 20, 24, 21, 0, 18, 66, 20852 }, // Ạ
+    { 14, 20, 16, 1, 14, 48, 20918 }, // ạ
+    { 20, 26, 21, 0, 26, 73, 20966 }, // Ả
+    { 14, 23, 16, 1, 22, 59, 21039 }, // ả
+    { 20, 26, 21, 0, 26, 78, 21098 }, // Ấ
+    { 14, 26, 16, 1, 25, 64, 21176 }, // ấ
+    { 20, 26, 21, 0, 26, 79, 21240 }, // Ầ
+    { 14, 26, 16, 1, 25, 65, 21319 }, // ầ
+    { 20, 26, 21, 0, 26, 80, 21384 }, // Ẩ
+    { 14, 26, 16, 1, 25, 67, 21464 }, // ẩ
+    { 20, 26, 21, 0, 26, 80, 21531 }, // Ẫ
+    { 14, 25, 16, 1, 24, 63, 21611 }, // ẫ
+    { 20, 31, 21, 0, 25, 82, 21674 }, // Ậ
+    { 14, 27, 16, 1, 21, 62, 21756 }, // ậ
+    { 20, 26, 21, 0, 26, 77, 21818 }, // Ắ
+    { 14, 26, 16, 1, 25, 64, 21895 }, // ắ
+    { 20, 26, 21, 0, 26, 76, 21959 }, // Ằ
+    { 14, 26, 16, 1, 25, 63, 22035 }, // ằ
+    { 20, 26, 21, 0, 26, 78, 22098 }, // Ẳ
+    { 14, 26, 16, 1, 25, 67, 22176 }, // ẳ
+    { 20, 26, 21, 0, 26, 77, 22243 }, // Ẵ
+    { 14, 25, 16, 1, 24, 64, 22320 }, // ẵ
+    { 20, 30, 21, 0, 24, 81, 22384 }, // Ặ
+    { 14, 26, 16, 1, 20, 62, 22465 }, // ặ
+    { 16, 24, 17, 0, 18, 60, 22527 }, // Ẹ
+    { 13, 20, 14, 0, 14, 47, 22587 }, // ẹ
+    { 16, 26, 17, 0, 26, 68, 22634 }, // Ẻ
+    { 13, 23, 14, 0, 22, 56, 22702 }, // ẻ
+    { 16, 24, 17, 0, 24, 64, 22758 }, // Ẽ
+    { 13, 21, 14, 0, 20, 52, 22822 }, // ẽ
+    { 16, 26, 17, 0, 26, 73, 22874 }, // Ế
+    { 14, 26, 15, 0, 25, 64, 22947 }, // ế
+    { 16, 26, 17, 0, 26, 74, 23011 }, // Ề
+    { 13, 26, 14, 0, 25, 62, 23085 }, // ề
+    { 16, 26, 17, 0, 26, 75, 23147 }, // Ể
+    { 15, 26, 16, 0, 25, 70, 23222 }, // ể
+    { 16, 26, 17, 0, 26, 73, 23292 }, // Ễ
+    { 13, 25, 14, 0, 24, 64, 23365 }, // ễ
+    { 16, 31, 17, 0, 25, 73, 23429 }, // Ệ
+    { 13, 27, 14, 0, 21, 62, 23502 }, // ệ
+    { 10, 26, 11, 0, 26, 41, 23564 }, // Ỉ
+    { 9, 22, 10, 0, 22, 43, 23605 }, // ỉ
+    { 10, 24, 11, 0, 18, 35, 23648 }, // Ị
+    { 9, 26, 10, 0, 20, 46, 23683 }, // ị
+    { 18, 24, 20, 1, 18, 68, 23729 }, // Ọ
+    { 15, 20, 16, 0, 14, 50, 23797 }, // ọ
+    { 18, 27, 20, 1, 26, 76, 23847 }, // Ỏ
+    { 15, 23, 16, 0, 22, 59, 23923 }, // ỏ
+    { 18, 27, 20, 1, 26, 79, 23982 }, // Ố
+    { 15, 26, 16, 0, 25, 64, 24061 }, // ố
+    { 18, 27, 20, 1, 26, 79, 24125 }, // Ồ
+    { 15, 26, 16, 0, 25, 65, 24204 }, // ồ
+    { 18, 27, 20, 1, 26, 82, 24269 }, // Ổ
+    { 15, 26, 16, 0, 25, 68, 24351 }, // ổ
+    { 18, 27, 20, 1, 26, 80, 24419 }, // Ỗ
+    { 15, 25, 16, 0, 24, 65, 24499 }, // ỗ
+    { 18, 31, 20, 1, 25, 87, 24564 }, // Ộ
+    { 15, 27, 16, 0, 21, 64, 24651 }, // ộ
+    { 19, 26, 21, 1, 25, 79, 24715 }, // Ớ
+    { 16, 22, 17, 0, 21, 57, 24794 }, // ớ
+    { 19, 26, 21, 1, 25, 78, 24851 }, // Ờ
+    { 16, 22, 17, 0, 21, 56, 24929 }, // ờ
+    { 19, 27, 21, 1, 26, 84, 24985 }, // Ở
+    { 16, 23, 17, 0, 22, 63, 25069 }, // ở
+    { 19, 25, 21, 1, 24, 81, 25132 }, // Ỡ
+    { 16, 21, 17, 0, 20, 59, 25213 }, // ỡ
+    { 19, 27, 21, 1, 21, 79, 25272 }, // Ợ
+    { 16, 23, 17, 0, 17, 57, 25351 }, // ợ
+    { 20, 24, 21, 0, 18, 81, 25408 }, // Ụ
+    { 17, 20, 18, 0, 14, 49, 25489 }, // ụ
+    { 20, 27, 21, 0, 26, 91, 25538 }, // Ủ
+    { 17, 23, 18, 0, 22, 59, 25629 }, // ủ
+    { 21, 26, 22, 0, 25, 90, 25688 }, // Ứ
+    { 17, 22, 18, 0, 21, 57, 25778 }, // ứ
+    { 21, 26, 22, 0, 25, 91, 25835 }, // Ừ
+    { 17, 22, 18, 0, 21, 57, 25926 }, // ừ
+    { 21, 27, 22, 0, 26, 95, 25983 }, // Ử
+    { 17, 23, 18, 0, 22, 65, 26078 }, // ử
+    { 21, 25, 22, 0, 24, 91, 26143 }, // Ữ
+    { 17, 21, 18, 0, 20, 60, 26234 }, // ữ
+    { 21, 27, 22, 0, 21, 91, 26294 }, // Ự
+    { 17, 23, 18, 0, 17, 56, 26385 }, // ự
+    { 18, 25, 19, 0, 25, 66, 26441 }, // Ỳ
+    { 17, 27, 18, 0, 21, 68, 26507 }, // ỳ
+    { 18, 24, 19, 0, 18, 63, 26575 }, // Ỵ
+    { 17, 19, 18, 0, 13, 59, 26638 }, // ỵ
+    { 18, 26, 19, 0, 26, 73, 26697 }, // Ỷ
+    { 17, 28, 18, 0, 22, 76, 26770 }, // ỷ
+    { 18, 24, 19, 0, 24, 68, 26846 }, // Ỹ
+    { 17, 26, 18, 0, 20, 70, 26914 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 26984 }, //  
+    { 0, 0, 25, 0, 0, 0, 26984 }, //  
+    { 0, 0, 13, 0, 0, 0, 26984 }, //  
+    { 0, 0, 25, 0, 0, 0, 26984 }, //  
+    { 0, 0, 8, 0, 0, 0, 26984 }, //  
+    { 0, 0, 6, 0, 0, 0, 26984 }, //  
+    { 0, 0, 4, 0, 0, 0, 26984 }, //  
+    { 0, 0, 16, 0, 0, 0, 26984 }, //  
+    { 0, 0, 7, 0, 0, 0, 26984 }, //  
+    { 0, 0, 5, 0, 0, 0, 26984 }, //  
+    { 0, 0, 1, 0, 0, 0, 26984 }, //  
+    { 0, 0, 1, 0, 0, 0, 26984 }, // ​
+    { 2, 21, 2, -1, 15, 20, 26984 }, // ‌
+    { 6, 23, 4, -3, 17, 33, 27004 }, // ‍
+    { 8, 24, 5, -4, 18, 35, 27037 }, // ‎
+    { 8, 24, 5, -4, 18, 35, 27072 }, // ‏
+    { 9, 3, 10, 0, 8, 7, 27107 }, // ‐
+    { 9, 3, 10, 0, 8, 7, 27114 }, // ‑
+    { 13, 3, 16, 1, 10, 11, 27121 }, // ‒
+    { 13, 3, 14, 0, 8, 11, 27132 }, // –
+    { 25, 3, 26, 0, 8, 19, 27143 }, // —
+    { 25, 3, 26, 0, 8, 19, 27162 }, // ―
+    { 9, 26, 13, 2, 20, 68, 27181 }, // ‖
+    { 13, 7, 14, 0, -1, 22, 27249 }, // ‗
+    { 6, 9, 7, 0, 19, 12, 27271 }, // ‘
+    { 6, 9, 7, 0, 19, 12, 27283 }, // ’
+    { 6, 9, 7, 0, 4, 12, 27295 }, // ‚
+    { 6, 9, 7, 0, 19, 12, 27307 }, // ‛
+    { 11, 9, 12, 0, 19, 24, 27319 }, // “
+    { 11, 9, 12, 0, 19, 23, 27343 }, // ”
+    { 11, 9, 12, 0, 4, 24, 27366 }, // „
+    { 11, 9, 12, 0, 19, 23, 27390 }, // ‟
+    { 12, 17, 13, 0, 18, 39, 27413 }, // †
+    { 12, 20, 13, 0, 18, 49, 27452 }, // ‡
+    { 6, 7, 8, 1, 10, 8, 27501 }, // •
+    { 9, 9, 16, 3, 13, 18, 27509 }, // ‣
+    { 5, 5, 7, 1, 4, 8, 27527 }, // ․
+    { 12, 5, 13, 0, 4, 17, 27535 }, // ‥
+    { 23, 5, 25, 1, 4, 24, 27552 }, // …
+    { 5, 5, 7, 1, 9, 6, 27576 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 27582 }, //  
+    { 0, 0, 1, 0, 0, 0, 27582 }, //  
+    { 8, 24, 5, -4, 18, 33, 27582 }, // ‪
+    { 8, 24, 5, -4, 18, 34, 27615 }, // ‫
+    { 8, 24, 5, -4, 18, 40, 27649 }, // ‬
+    { 11, 24, 7, -5, 18, 55, 27689 }, // ‭
+    { 11, 24, 7, -5, 18, 54, 27744 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 27798 }, //  
+    { 33, 21, 35, 1, 19, 125, 27798 }, // ‰
+    { 7, 9, 8, 0, 18, 12, 27923 }, // ′
+    { 12, 9, 13, 0, 18, 24, 27935 }, // ″
+    { 18, 9, 19, 0, 18, 36, 27959 }, // ‴
+    { 7, 9, 8, 0, 18, 13, 27995 }, // ‵
+    { 12, 9, 13, 0, 18, 25, 28008 }, // ‶
+    { 18, 9, 19, 0, 18, 36, 28033 }, // ‷
+    { 11, 6, 13, 1, 0, 14, 28069 }, // ‸
+    { 8, 11, 9, 0, 12, 15, 28083 }, // ‹
+    { 7, 11, 9, 1, 12, 16, 28098 }, // ›
+    { 16, 18, 17, 0, 17, 70, 28114 }, // ※
+    { 13, 20, 15, 1, 19, 57, 28184 }, // ‼
+    { 13, 3, 14, 0, 21, 11, 28241 }, // ‾
+    { 7, 3, 8, 0, 8, 6, 28252 }, // ⁃
+    { 14, 21, 10, -5, 19, 43, 28258 }, // ⁄
+    { 22, 20, 24, 1, 19, 69, 28301 }, // ⁇
+    { 18, 20, 20, 1, 19, 61, 28370 }, // ⁈
+    { 18, 20, 20, 1, 19, 61, 28431 }, // ⁉
+    { 15, 6, 25, 5, 10, 19, 28492 }, // ⁓
+    { 23, 9, 24, 0, 18, 48, 28511 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 28559 }, //  
+    { 0, 0, 1, 0, 0, 0, 28559 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 28559 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 28559 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 28559 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 28559 }, // ⁤
+    { 11, 13, 12, 0, 21, 34, 28559 }, // ⁰
+    { 11, 13, 12, 0, 21, 30, 28593 }, // ⁴
+    { 9, 13, 11, 1, 21, 27, 28623 }, // ⁵
+    { 10, 13, 12, 1, 21, 30, 28650 }, // ⁶
+    { 10, 13, 12, 1, 21, 26, 28680 }, // ⁷
+    { 9, 13, 11, 1, 21, 31, 28706 }, // ⁸
+    { 10, 13, 12, 1, 21, 28, 28737 }, // ⁹
+    { 12, 9, 14, 1, 18, 26, 28765 }, // ⁿ
+    { 11, 12, 12, 0, 8, 34, 28791 }, // ₀
+    { 9, 13, 11, 1, 9, 27, 28825 }, // ₁
+    { 10, 12, 12, 1, 8, 30, 28852 }, // ₂
+    { 9, 12, 11, 1, 8, 29, 28882 }, // ₃
+    { 11, 12, 12, 0, 8, 29, 28911 }, // ₄
+    { 9, 12, 11, 1, 8, 29, 28940 }, // ₅
+    { 10, 12, 12, 1, 8, 29, 28969 }, // ₆
+    { 10, 12, 12, 1, 8, 27, 28998 }, // ₇
+    { 9, 12, 11, 1, 8, 29, 29025 }, // ₈
+    { 10, 12, 12, 1, 8, 28, 29054 }, // ₉
+    { 14, 18, 16, 1, 18, 48, 29082 }, // ₣
+    { 15, 19, 16, 0, 18, 58, 29130 }, // ₤
+    { 34, 19, 35, 0, 18, 108, 29188 }, // ₧
+    { 16, 19, 17, 0, 18, 52, 29296 }, // €
+    { 17, 12, 25, 4, 15, 28, 29348 }, // ←
+    { 13, 17, 25, 6, 17, 32, 29376 }, // ↑
+    { 17, 12, 25, 4, 15, 29, 29408 }, // →
+    { 13, 17, 25, 6, 17, 31, 29437 }, // ↓
+    { 17, 11, 25, 4, 14, 37, 29468 }, // ↔
+    { 11, 17, 25, 7, 17, 36, 29505 }, // ↕
+    { 13, 18, 25, 6, 18, 41, 29541 }, // ↨
+    { 11, 18, 25, 7, 18, 38, 29582 }, // ↲
+    { 11, 18, 25, 7, 18, 36, 29620 }, // ↳
+    { 15, 14, 25, 5, 16, 40, 29656 }, // ↵
+    { 17, 15, 25, 4, 16, 42, 29696 }, // ⇐
+    { 15, 17, 25, 5, 17, 59, 29738 }, // ⇑
+    { 17, 15, 25, 4, 16, 42, 29797 }, // ⇒
+    { 15, 17, 25, 5, 17, 63, 29839 }, // ⇓
+    { 17, 13, 25, 4, 15, 40, 29902 }, // ⇔
+    { 18, 19, 25, 3, 18, 58, 29942 }, // ∀
+    { 13, 21, 16, 1, 20, 53, 30000 }, // ∂
+    { 13, 18, 25, 6, 18, 53, 30053 }, // ∃
+    { 19, 21, 25, 3, 19, 76, 30106 }, // ∅
+    { 17, 18, 18, 0, 18, 50, 30182 }, // ∆
+    { 17, 19, 25, 4, 18, 58, 30232 }, // ∇
+    { 17, 18, 25, 4, 18, 57, 30290 }, // ∈
+    { 17, 23, 25, 4, 20, 70, 30347 }, // ∉
+    { 17, 15, 25, 4, 16, 52, 30417 }, // ∊
+    { 17, 18, 25, 4, 18, 56, 30469 }, // ∋
+    { 17, 23, 25, 4, 20, 69, 30525 }, // ∌
+    { 17, 15, 25, 4, 16, 52, 30594 }, // ∍
+    { 21, 22, 22, 0, 18, 70, 30646 }, // ∏
+    { 16, 23, 17, 0, 18, 63, 30716 }, // ∑
+    { 12, 3, 16, 2, 10, 15, 30779 }, // −
+    { 13, 20, 14, 0, 18, 38, 30794 }, // ∕
+    { 13, 20, 14, 0, 18, 38, 30832 }, // ∖
+    { 12, 13, 16, 2, 15, 35, 30870 }, // ∗
+    { 10, 10, 16, 3, 13, 24, 30905 }, // ∘
+    { 6, 5, 16, 5, 9, 7, 30929 }, // ∙
+    { 17, 24, 17, -1, 21, 63, 30936 }, // √
+    { 13, 10, 16, 1, 13, 31, 30999 }, // ∝
+    { 16, 10, 17, 0, 13, 41, 31030 }, // ∞
+    { 17, 18, 25, 4, 18, 32, 31071 }, // ∟
+    { 19, 18, 25, 3, 18, 41, 31103 }, // ∠
+    { 4, 26, 13, 4, 20, 28, 31144 }, // ∣
+    { 9, 26, 13, 2, 20, 68, 31172 }, // ∥
+    { 18, 18, 25, 4, 18, 52, 31240 }, // ∧
+    { 18, 18, 25, 4, 18, 54, 31292 }, // ∨
+    { 15, 18, 25, 5, 18, 59, 31346 }, // ∩
+    { 15, 19, 25, 5, 18, 64, 31405 }, // ∪
+    { 15, 26, 16, 0, 20, 56, 31469 }, // ∫
+    { 17, 15, 25, 4, 14, 32, 31525 }, // ∴
+    { 17, 15, 25, 4, 14, 32, 31557 }, // ∵
+    { 6, 15, 8, 1, 16, 15, 31589 }, // ∶
+    { 17, 15, 25, 4, 14, 36, 31604 }, // ∷
+    { 15, 6, 25, 5, 10, 19, 31640 }, // ∼
+    { 15, 15, 25, 5, 16, 48, 31659 }, // ≅
+    { 13, 11, 16, 1, 14, 33, 31707 }, // ≈
+    { 15, 10, 25, 5, 12, 32, 31740 }, // ≍
+    { 12, 13, 16, 2, 15, 32, 31772 }, // ≠
+    { 15, 13, 25, 5, 14, 38, 31804 }, // ≡
+    { 12, 15, 16, 2, 15, 34, 31842 }, // ≤
+    { 12, 16, 16, 2, 16, 35, 31876 }, // ≥
+    { 21, 13, 25, 2, 15, 46, 31911 }, // ≪
+    { 21, 13, 25, 2, 15, 46, 31957 }, // ≫
+    { 17, 15, 25, 4, 16, 45, 32003 }, // ⊃
+    { 17, 23, 25, 4, 20, 67, 32048 }, // ⊄
+    { 17, 23, 25, 4, 20, 65, 32115 }, // ⊅
+    { 17, 18, 25, 4, 18, 60, 32180 }, // ⊆
+    { 17, 18, 25, 4, 18, 61, 32240 }, // ⊇
+    { 19, 19, 25, 3, 18, 92, 32301 }, // ⊕
+    { 19, 19, 25, 3, 18, 77, 32393 }, // ⊖
+    { 19, 19, 25, 3, 18, 79, 32470 }, // ⊗
+    { 19, 19, 25, 3, 18, 75, 32549 }, // ⊘
+    { 15, 18, 25, 5, 18, 33, 32624 }, // ⊥
+    { 6, 5, 16, 5, 9, 7, 32657 }, // ⋅
+    { 23, 5, 25, 1, 9, 22, 32664 }, // ⋯
+    { 25, 24, 26, 0, 21, 101, 32686 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
@@ -3692,4 +2819,5 @@ static const EpdFontData bookerly_12_bold = {
     27,
     -7,
     true,
+    true,
 };
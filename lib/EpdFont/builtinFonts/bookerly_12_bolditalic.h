@@ -2,3695 +2,2772 @@
  * generated by fontconvert.py
  * name: bookerly_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_bolditalicBitmaps[48047] = {
-    0x00, 0x68, 0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0xBD, 0x00, 0x10, 0x00, 0x0B, 0x87, 0xC2, 0xF4, 0xFC, 0x3F, 0x2F, 0x83,
-    0xF2, 0xF4, 0x7E, 0x3F, 0x07, 0xD3, 0xF0, 0x7C, 0x3E, 0x0B, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x3E, 0x0B, 0xC0, 0x05,
-    0xBE, 0x5F, 0xD4, 0x1F, 0xFF, 0xFF, 0xFD, 0x1A, 0xFE, 0xBF, 0xE8, 0x00, 0xF8, 0x2F, 0x00, 0x01,
-    0xF4, 0x3F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xE0, 0xFC, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x6F,
-    0x80, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xEF, 0xFC, 0x03, 0xE1, 0xDB, 0xD0, 0x7D, 0x2C, 0x3C, 0x07,
-    0xF3, 0xC3, 0x40, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x01, 0xFF, 0xE0, 0x7C, 0x2C, 0xBF, 0x0F, 0xC3, 0xC3, 0xF0, 0xFD, 0x38, 0x7E, 0x0B, 0xFB,
-    0x5F, 0xC0, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xFB, 0xF4, 0x00,
-    0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x0B, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x7D, 0x00, 0x07, 0xD0, 0x3E,
-    0x03, 0xE0, 0x00, 0x2F, 0x41, 0xF4, 0x3F, 0x00, 0x00, 0xBC, 0x0F, 0xC1, 0xF0, 0x00, 0x02, 0xF4,
-    0x7E, 0x0F, 0x42, 0xFE, 0x07, 0xFB, 0xF0, 0xF8, 0x3F, 0xFE, 0x07, 0xFE, 0x0B, 0xC3, 0xF0, 0xFC,
-    0x00, 0x00, 0x7C, 0x1F, 0x42, 0xF4, 0x00, 0x03, 0xD0, 0xFC, 0x0B, 0xC0, 0x00, 0x3F, 0x03, 0xF0,
-    0x3F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x1F, 0x40, 0x3F, 0x0B, 0xD0, 0x00, 0xFC, 0x00,
-    0xFE, 0xBE, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x2D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0xF8, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x60, 0x01, 0xFB, 0xF4, 0x01, 0xBC, 0x00, 0x7F,
-    0xE0, 0x2F, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0xF9, 0x00, 0xFF, 0xF4, 0x3F, 0xF4, 0x00, 0xFD, 0x3F,
-    0x04, 0x7C, 0x00, 0x7F, 0x0F, 0xE0, 0x3F, 0x00, 0x2F, 0x81, 0xFD, 0x1F, 0x40, 0x0B, 0xE0, 0x2F,
-    0xDF, 0xC0, 0x02, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0x90, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x7F, 0xFE, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x8B, 0xD3, 0xF0, 0xFC, 0x7E, 0x1F, 0x47, 0xC2, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x18, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x40, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x47, 0xC0, 0x3C, 0xBC, 0x07, 0xFF, 0x04, 0x0B, 0xFF, 0xC1, 0xBF, 0xFC, 0x7F, 0xB0,
-    0x43, 0xCB, 0x80, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x6A, 0xFE, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xFE, 0xA8, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x2F, 0xC0,
-    0x7F, 0x40, 0xFC, 0x07, 0xE0, 0x3F, 0x07, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0xFF, 0xFE,
-    0xFF, 0xFD, 0x05, 0x0F, 0xCB, 0xF2, 0xF8, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0xFF, 0x9F, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF0, 0x02, 0xFC, 0x0F, 0xD0, 0x02, 0xFC,
-    0x2F, 0xC0, 0x02, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x7F, 0x00, 0x03, 0xF8,
-    0xBF, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x0F, 0xE0, 0xBF, 0x40, 0x2F, 0xC0, 0x7F, 0x80, 0x7F, 0x40,
-    0x3F, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x06, 0xFC, 0x01, 0xBF, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0x5B, 0xF4, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x40,
-    0x1F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0xFF, 0x97, 0xFC, 0x07, 0xF0, 0x07, 0xF4, 0x0F, 0x40, 0x1F, 0xD0, 0x04, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0x97, 0xFC, 0x03, 0xF0, 0x0B, 0xF0, 0x07, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1B, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x0B, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x1F, 0xF0, 0x05, 0x6B, 0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x1F, 0x8B, 0xD0,
-    0x01, 0xF8, 0x3F, 0x40, 0x1F, 0xC0, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xAA, 0xA0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x16, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFD, 0x01, 0xFE, 0xAF, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x1F, 0xD0, 0xFE,
-    0x00, 0x7F, 0x03, 0xF8, 0x02, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xF5, 0xFF, 0x00, 0x2F, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x00, 0x3F, 0x80, 0xF8, 0x03, 0xFC,
-    0x01, 0x80, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD0,
-    0xFE, 0x01, 0xFC, 0x02, 0xF8, 0x0B, 0xE0, 0x0F, 0xD0, 0x2F, 0xC0, 0xBF, 0x00, 0x3F, 0xEF, 0xF0,
-    0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x03, 0xF8, 0x0F, 0xF0, 0x2F,
-    0x80, 0x1F, 0xD0, 0xFD, 0x00, 0x3F, 0x43, 0xF8, 0x02, 0xFC, 0x0F, 0xF9, 0x6F, 0xD0, 0x1F, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0x97, 0xFC, 0x00, 0xFE, 0x01, 0xFD, 0x01, 0xFC,
-    0x00, 0xFE, 0x02, 0xFC, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0xFD, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0xFF,
-    0xEB, 0xFC, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x7F, 0x40, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0, 0x2F, 0xC0, 0xBE, 0x00, 0x50, 0x00, 0x00,
-    0x1F, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x07,
-    0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0xD0, 0x1F, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFE, 0x74, 0x3F, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0xFC, 0x03, 0xF0,
-    0x1F, 0xC0, 0x3E, 0x00, 0xBC, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x04, 0x00, 0x7E, 0x00,
-    0xFE, 0x00, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x40, 0x1B, 0xF8, 0x00, 0x7F, 0x80,
-    0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x7E, 0x2C, 0x0F, 0xC2, 0xF4,
-    0x0F, 0xFF, 0xF0, 0x3F, 0x0F, 0x80, 0xBD, 0x2F, 0x80, 0xFC, 0xBC, 0x07, 0xE0, 0x3D, 0x03, 0xF3,
-    0xF0, 0x3F, 0x01, 0xF0, 0x0F, 0x8F, 0x80, 0xF8, 0x0F, 0x80, 0x7D, 0x7D, 0x07, 0xE0, 0x7D, 0x03,
-    0xF1, 0xF4, 0x1F, 0x83, 0xF4, 0x2F, 0x47, 0xD0, 0x7F, 0xBF, 0xD2, 0xF8, 0x1F, 0x80, 0xFF, 0xCB,
-    0xFF, 0x80, 0x7F, 0x02, 0xFC, 0x1F, 0xE4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xA0, 0x00, 0x07, 0xFF, 0xAA, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6F, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0,
-    0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD,
-    0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x1A, 0xBA, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEF,
-    0xFC, 0x01, 0x2F, 0xC1, 0xFD, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x7F, 0x40,
-    0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x1B,
-    0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6B, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE,
-    0x00, 0xFC, 0x03, 0xFD, 0x00, 0x3E, 0x02, 0xFD, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F,
-    0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
-    0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xD0,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01, 0xFF, 0x6B, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F,
-    0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x55, 0x55, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x3F, 0xC0, 0x3D, 0x00, 0x3F,
-    0x80, 0x3C, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x5A, 0x80, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54, 0x3F,
-    0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00, 0x0F,
-    0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF,
-    0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00,
-    0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
-    0x7F, 0xFF, 0x43, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00, 0x55, 0x55, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x55, 0x55, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2C, 0x2F, 0xC0,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x05, 0x55, 0x01, 0xFF, 0xFD, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x1F, 0xF8, 0x00, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x00,
-    0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x01,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x0F, 0xF0, 0x03,
-    0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
-    0x03, 0xEF, 0xD0, 0x7E, 0xFC, 0x00, 0x00, 0xF7, 0xF4, 0x3E, 0x7F, 0x00, 0x00, 0xBC, 0xBE, 0x1F,
-    0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x8F, 0x8B, 0xE0, 0x00, 0x0F, 0x87, 0xF7, 0xC2, 0xF8, 0x00, 0x07,
-    0xC0, 0xFF, 0xD0, 0xFE, 0x00, 0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0xF8, 0x0F, 0xF4, 0x0F,
-    0xD0, 0x00, 0x7D, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x1E, 0x00, 0x7F, 0x40, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0,
-    0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F,
-    0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80,
-    0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0,
-    0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB,
-    0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x04, 0xBF, 0x0B,
-    0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC,
-    0x03, 0xF8, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07,
-    0xFE, 0x90, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0x1F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x03, 0xFC,
-    0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0xE6, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA,
-    0x80, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x16, 0xBA, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFD, 0x00, 0x12,
-    0xFC, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0xBF, 0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0xC2, 0xFD, 0x00,
-    0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0xBF, 0xD0, 0x7F, 0xFF, 0x02, 0xFF, 0x8B, 0xFF, 0xF0,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x40, 0x7F, 0x40, 0xBC, 0x02, 0xFC, 0x02, 0xF0, 0x0F, 0xF0, 0x0B, 0x40, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x00, 0x3F, 0xC0, 0xBC, 0x00, 0xBF, 0x03, 0xF4, 0x03, 0xFC, 0x0F,
-    0xF9, 0x7F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC,
-    0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55,
-    0x52, 0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x40,
-    0x2F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF8,
-    0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x54, 0xFF, 0xFE, 0x07, 0xFF,
-    0xE2, 0xFF, 0xD0, 0x0B, 0xFE, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x07, 0xF4, 0x00, 0x7F, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x0B,
-    0xE0, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x00, 0xFD, 0xBC, 0x00, 0x00, 0x02, 0xFB, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x01, 0x55, 0x43, 0xFF, 0xF8, 0x0F, 0x80, 0xBF, 0xFC, 0x2F,
-    0xFE, 0x01, 0xF8, 0x02, 0xFF, 0x40, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xC0, 0x07, 0xF4, 0x03, 0xFC,
-    0x02, 0xF8, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0xFC, 0x0B, 0xE0, 0x00,
-    0x3F, 0x42, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0xF4, 0x3D, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x8B, 0xCF,
-    0xC3, 0xF0, 0x00, 0x03, 0xF8, 0xF4, 0xFC, 0xBD, 0x00, 0x00, 0x2F, 0xAF, 0x0B, 0xCF, 0xC0, 0x00,
-    0x02, 0xFB, 0xE0, 0xBE, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x01,
-    0x55, 0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B,
-    0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0,
-    0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x0F, 0xF4, 0x03,
-    0xE0, 0x0F, 0xF8, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x74, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0xFF, 0x95,
-    0x5F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA9, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xE8, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x90,
-    0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x0F, 0xFD, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x05, 0xF8, 0x00,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xEF, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0xFC, 0x7D, 0x00, 0x3E, 0x0F, 0xC0, 0x2F, 0x02, 0xF0,
-    0x0F, 0xC0, 0x7E, 0x07, 0xD0, 0x0F, 0xC3, 0xF0, 0x02, 0xF4, 0xA4, 0x00, 0x29, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x24, 0x07, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xC0, 0x2C,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F,
-    0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F,
-    0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x02, 0xF8, 0x04, 0x00, 0x3F, 0x0F, 0xF4, 0x03, 0xF3, 0xFF, 0xC0, 0x3E, 0xFB, 0xFC, 0x07, 0xFD,
-    0x1F, 0xC0, 0xBF, 0x81, 0xFC, 0x0F, 0xF0, 0x1F, 0xC0, 0xFD, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0x82,
-    0xFC, 0x07, 0xF0, 0x3F, 0x80, 0xFE, 0x03, 0xFD, 0x7F, 0xC0, 0x7F, 0xFF, 0xF0, 0x0B, 0xEF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9,
-    0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x10, 0xBE, 0x00, 0x0F, 0xFB, 0xF4,
-    0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F,
-    0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xE0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B,
-    0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC,
-    0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F,
-    0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xF8,
-    0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x16, 0xFD, 0x50, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0xFF, 0xF4, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0xFD, 0x03, 0xF0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x03, 0xF4, 0x07, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0xBE, 0x00,
-    0x0F, 0xD0, 0x1F, 0xF5, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x40, 0x00, 0xFD, 0x2F, 0xE0, 0x03, 0xF3, 0xFF,
-    0xC0, 0x1F, 0xEE, 0xBF, 0x00, 0x7F, 0xE1, 0xFC, 0x02, 0xFE, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x3F, 0x80, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x80, 0xFD, 0x20, 0xFD,
-    0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00,
-    0x7F, 0x00, 0x2F, 0x88, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x74, 0x3F, 0x40, 0x0F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x80, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x40,
-    0x0F, 0xC2, 0xFC, 0x03, 0xF7, 0xFF, 0x80, 0xFB, 0xC7, 0xE0, 0x7F, 0x80, 0xF8, 0x2F, 0xC0, 0xBC,
-    0x0F, 0xD0, 0xBD, 0x03, 0xFB, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0xBE, 0xBD, 0x00, 0x3F, 0x4F, 0xC0,
-    0x0F, 0xC2, 0xFE, 0x47, 0xF0, 0x3F, 0xFA, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x0B, 0xFE, 0x1F, 0xFE, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0xF4,
-    0x07, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0x80, 0x3F, 0x48,
-    0x3F, 0xFC, 0x3F, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0xFF, 0x47,
-    0xF8, 0x1F, 0xE0, 0x3F, 0xF5, 0xFF, 0xCB, 0xFF, 0x00, 0x3F, 0xBE, 0xFE, 0xFB, 0xF0, 0x03, 0xFF,
-    0x0F, 0xF8, 0x7F, 0x00, 0x3F, 0xC1, 0xFF, 0x0B, 0xE0, 0x07, 0xF8, 0x2F, 0xD0, 0xFD, 0x00, 0xBF,
-    0x03, 0xFC, 0x0F, 0xC0, 0x0F, 0xE0, 0x3F, 0x41, 0xFC, 0x00, 0xFD, 0x07, 0xF0, 0x2F, 0x80, 0x1F,
-    0xC0, 0xBF, 0x03, 0xF4, 0x81, 0xFC, 0x0F, 0xE0, 0x3F, 0xFC, 0x2F, 0x80, 0xFD, 0x03, 0xFF, 0x83,
-    0xF4, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F,
-    0xD0, 0xFF, 0x03, 0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4,
-    0x3F, 0x40, 0x7F, 0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD,
-    0x01, 0xFC, 0x07, 0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1,
-    0xFE, 0x0F, 0xE0, 0x3F, 0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F, 0x40,
-    0x3F, 0x5F, 0xD0, 0x1F, 0xC3, 0xF4, 0x0F, 0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x02, 0xFF, 0x0B, 0xF8, 0x07, 0xFF, 0x6F,
-    0xFC, 0x00, 0x3F, 0xBE, 0xFD, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x7F, 0x40,
-    0xFD, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0xFC, 0x03, 0xF4, 0x01, 0xFC, 0x0B,
-    0xF0, 0x02, 0xFE, 0x6F, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xFE, 0x7E, 0x01, 0xFF, 0xFF, 0xD0,
-    0x3F, 0x87, 0xFC, 0x0B, 0xF0, 0x2F, 0x81, 0xFC, 0x03, 0xF4, 0x2F, 0xC0, 0x3F, 0x03, 0xF4, 0x0B,
-    0xF0, 0x3F, 0x40, 0xFE, 0x03, 0xF0, 0x2F, 0xE0, 0x7F, 0x4B, 0xFD, 0x03, 0xFE, 0xFB, 0xC0, 0x3F,
-    0xFC, 0xFC, 0x01, 0xFE, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x10, 0x04, 0x07, 0xFD,
-    0x1F, 0xC3, 0xFF, 0x9F, 0xF0, 0x0B, 0xDF, 0xFC, 0x02, 0xFB, 0x95, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xFC, 0x00,
-    0xFF, 0xFD, 0x03, 0xF4, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xE0, 0x00, 0x1F, 0xF4, 0x08, 0x03, 0xF8, 0x2F, 0x02, 0xF8, 0x3F, 0xD7, 0xF0, 0x3F, 0xFF, 0xD0,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7,
-    0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE,
-    0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F,
-    0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8, 0x6F, 0xC0, 0xFE, 0x03, 0xF4,
-    0x2F, 0x80, 0xFD, 0x0F, 0xC0, 0x2F, 0x83, 0xF0, 0x0B, 0xE1, 0xF4, 0x01, 0xF8, 0xF8, 0x00, 0x7E,
-    0xBC, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xBF, 0x02, 0xF8, 0x1F, 0xCB, 0xFE, 0x07, 0xF0, 0x3F,
-    0x82, 0xFC, 0x0F, 0xD0, 0xBE, 0x03, 0xF0, 0x3F, 0x42, 0xF4, 0x0F, 0xD0, 0xFE, 0x0B, 0xC0, 0x2F,
-    0x87, 0xFC, 0x3E, 0x00, 0x7E, 0x2F, 0xF1, 0xF4, 0x00, 0xF8, 0xFF, 0xCF, 0xC0, 0x03, 0xEB, 0xAF,
-    0x7D, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFD,
-    0x02, 0xFC, 0x0B, 0xFF, 0x0B, 0xFD, 0x05, 0x7F, 0x5F, 0xAC, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0xA4, 0x3F, 0xE0, 0xBF, 0xF4, 0x3F, 0x80,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B,
-    0xFF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D,
-    0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F,
-    0xF4, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0,
-    0x1F, 0x02, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xF9, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xFF, 0x80, 0x06,
-    0xBF, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
-    0x07, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x01, 0x07, 0xFF, 0x42, 0xE3, 0xFF, 0xFE, 0xF8, 0xF4, 0x7F, 0xFC, 0x1C, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01,
-    0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x0B, 0xFB, 0xDB, 0x80, 0xFD, 0x3C, 0x00, 0x2F,
-    0x83, 0x80, 0x03, 0xF0, 0x74, 0x00, 0x7F, 0x0B, 0x00, 0x07, 0xF0, 0xF0, 0x00, 0x7F, 0x0E, 0x00,
-    0x03, 0xF5, 0xE0, 0xB0, 0x3F, 0xFE, 0xBF, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x90, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x07, 0xE0, 0xFD, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x02, 0xF8, 0x07, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x6F, 0xD5, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x6F,
-    0xFA, 0xA4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xFA, 0xAB, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xE1, 0xBF, 0xFC,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x40, 0x38, 0x0F, 0xDF, 0xFE,
-    0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xE0, 0x0F, 0xC0, 0x03, 0xD0, 0x0F,
-    0x80, 0x07, 0xC0, 0x1F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xBE, 0xFF, 0xFF,
-    0xD0, 0x74, 0x15, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC7,
-    0xFF, 0xDF, 0xFF, 0xD1, 0xFF, 0xE0, 0x7F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x0F, 0xD0, 0x02, 0xFC,
-    0x0B, 0xD0, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x3F, 0xFE, 0xFF, 0xC0, 0x0A,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x07, 0xFF, 0xF4, 0x07, 0xE0, 0xBD, 0x03, 0xF0, 0x0F, 0x02, 0xFE, 0x00, 0x00, 0xE7, 0xD0,
-    0x00, 0x38, 0xBE, 0x00, 0x0F, 0x0B, 0xF0, 0x03, 0xE0, 0x7F, 0x00, 0x7E, 0x07, 0xE0, 0x0B, 0xE0,
-    0x7C, 0x00, 0xBF, 0x0F, 0x00, 0x0B, 0xF3, 0xC0, 0x00, 0x7D, 0xF0, 0x24, 0x0B, 0xF8, 0x3E, 0x01,
-    0xFC, 0x0F, 0xD0, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC2, 0xE7, 0xF2, 0xFD, 0xF8, 0xBD, 0x00, 0x04, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00,
-    0xAA, 0x41, 0xD0, 0x74, 0x1F, 0xFF, 0x02, 0xC3, 0xC0, 0xF4, 0x3C, 0x07, 0x4E, 0x0B, 0xC0, 0x90,
-    0x0E, 0x34, 0x3E, 0x00, 0x00, 0x38, 0xD0, 0xF8, 0x00, 0x00, 0xF3, 0x43, 0xE0, 0x00, 0x03, 0x8E,
-    0x0B, 0xC0, 0x00, 0x0E, 0x2C, 0x1F, 0xEA, 0xC0, 0x74, 0x74, 0x1F, 0xFE, 0x03, 0xC0, 0xF0, 0x05,
-    0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xA5, 0x90, 0x7F, 0xFC, 0x0F, 0x8B, 0xC2, 0xE0, 0xB4,
-    0x3C, 0x0F, 0x03, 0xC2, 0xF0, 0x7D, 0xBE, 0x63, 0xFE, 0xFE, 0x1F, 0x4F, 0x80, 0x00, 0x00, 0x2A,
-    0xAF, 0xCB, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x0F,
-    0xE0, 0xBF, 0x01, 0xFD, 0x0F, 0xE0, 0x1F, 0xD0, 0xFE, 0x00, 0xFE, 0x0B, 0xF0, 0x03, 0xFC, 0x2F,
-    0xC0, 0x03, 0xF4, 0x3F, 0x80, 0x07, 0xF0, 0x3F, 0x40, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x14, 0xBF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD5, 0x50, 0x38, 0x28, 0xBE, 0xD0, 0xC3, 0x43, 0x8F,
-    0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x3A, 0xD0, 0xA3, 0x87, 0xDF, 0x4D, 0x1C,
-    0x54, 0x26, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x5F,
-    0xFF, 0xD1, 0x55, 0x50, 0x00, 0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xD0, 0xFC, 0xFC, 0x0B,
-    0xCF, 0x80, 0xBC, 0xBD, 0x0F, 0xC7, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x15, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x55, 0xBD, 0x54, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFD, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x14,
-    0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x0B, 0xFF, 0x40, 0xBE, 0x7F, 0x03, 0xD0, 0xBC, 0x01, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBE, 0x55, 0x03, 0xFF, 0xFD, 0x0A, 0xAA, 0x90, 0x00, 0x64,
-    0x01, 0xFF, 0xD0, 0xF9, 0xF8, 0x34, 0x2E, 0x00, 0x1F, 0x00, 0xBF, 0x40, 0xBF, 0xE0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x2F, 0x8F, 0xFF, 0x82, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0F,
-    0xC2, 0xFC, 0x3F, 0x0B, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00,
-    0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0xBF, 0x0B, 0xFC, 0x10, 0x3F, 0xFF, 0xEF, 0xBC, 0x0F, 0xFF, 0xD7, 0xFE, 0x07, 0xEF,
-    0xD0, 0xFE, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xEF, 0x90, 0x02, 0xFF, 0xF3, 0xC0, 0x00, 0xFF, 0xF8,
-    0xF0, 0x00, 0xBF, 0xFE, 0x78, 0x00, 0x3F, 0xFF, 0x6D, 0x00, 0x0F, 0xFF, 0xCB, 0x40, 0x03, 0xFF,
-    0xF3, 0xC0, 0x00, 0xFF, 0xF8, 0xF0, 0x00, 0x1F, 0xFD, 0x78, 0x00, 0x01, 0xEF, 0x2E, 0x00, 0x00,
-    0x03, 0xCB, 0x40, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x2D, 0x78, 0x00,
-    0x00, 0x0F, 0x2D, 0x00, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xD6, 0xFF, 0x40,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xFC, 0xFE, 0x2E,
-    0x00, 0x0B, 0x81, 0xFD, 0x03, 0xC0, 0xB8, 0x7E, 0x06, 0x40, 0x00, 0x14, 0x06, 0xFD, 0x0F, 0xFC,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x3F, 0xFC,
-    0x6A, 0xA8, 0x00, 0x6A, 0x00, 0x2F, 0xFC, 0x0B, 0xC3, 0xD1, 0xF4, 0x3E, 0x2F, 0x03, 0xD2, 0xE0,
-    0x7C, 0x2E, 0x0F, 0x81, 0xFF, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0xAF, 0x4B, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0xFF, 0x0F, 0xF0, 0x02, 0xFC, 0x1F, 0xC0, 0x1F, 0xD0, 0xFE, 0x01, 0xFD, 0x0F,
-    0xE0, 0x1F, 0xC0, 0xFD, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x05, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xE0,
-    0x00, 0xBC, 0x00, 0xFF, 0x42, 0xFF, 0xC0, 0x1F, 0x00, 0x3D, 0xF0, 0x7F, 0xFC, 0x03, 0xD0, 0x0F,
-    0x5F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xD2, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x2F, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x05,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7C, 0x07, 0xFE, 0x00, 0xFC,
-    0x00, 0x3D, 0x0B, 0xFF, 0xE0, 0x3E, 0x00, 0x3E, 0x03, 0xD0, 0xFC, 0xBF, 0xF0, 0x2F, 0x00, 0x90,
-    0x3E, 0x7F, 0xFC, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0E, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xBD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x2F,
-    0x00, 0x2F, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0xF8, 0x00,
-    0xFF, 0x4A, 0xBF, 0xC0, 0x2E, 0x00, 0x3D, 0xF0, 0xFF, 0xE0, 0x0B, 0xC0, 0x0F, 0x5F, 0x00, 0x00,
-    0x01, 0xF4, 0x03, 0xD2, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x2F,
-    0xFF, 0xFC, 0x00, 0x02, 0xF4, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x0F, 0xFC, 0x01, 0x7F, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x2F, 0x40, 0x2F, 0x40,
-    0x1F, 0x40, 0x0B, 0xC0, 0x02, 0xF4, 0x24, 0xBF, 0xFE, 0x0F, 0xFF, 0x80, 0xFF, 0x80, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
-    0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00,
-    0x3F, 0x47, 0xD0, 0x00, 0x00, 0x78, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x40, 0x40, 0x00, 0x00, 0x1F, 0xE2,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3C, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0,
-    0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD,
-    0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0,
-    0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F,
-    0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0xF7, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x60, 0x00, 0x00, 0x0F, 0xCB, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0x82, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x95, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x01,
-    0xFC, 0x00, 0xBE, 0x00, 0x7D, 0x00, 0x7F, 0x00, 0x0F, 0xE5, 0x5F, 0xC0, 0x2F, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6B, 0xA0, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x3E, 0x02, 0xFD,
-    0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x0D, 0x02, 0xFF, 0x80, 0x1F, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00,
-    0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF,
-    0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x02, 0xF8, 0x3E, 0x00,
-    0x00, 0xB4, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C, 0x00, 0x3F, 0x80,
-    0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0x03,
-    0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x07, 0xC0,
-    0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8, 0x00, 0xF4, 0x01, 0xFE,
-    0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54,
-    0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80,
-    0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xBE, 0xFC, 0x00, 0xBD, 0x0F, 0x40, 0x3D, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47,
-    0xD0, 0x0F, 0xE3, 0xF8, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x1A, 0xFF,
-    0xA8, 0x07, 0xF4, 0xBF, 0xFF, 0xF0, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03,
-    0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01,
-    0xFF, 0x6B, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0x4B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00,
-    0xBF, 0xF0, 0x06, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00,
-    0x03, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00,
-    0x00, 0xBC, 0x7F, 0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0,
-    0x00, 0x1F, 0x80, 0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF,
-    0x40, 0x0B, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02,
-    0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF,
-    0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x3D,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00,
-    0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F,
-    0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFE, 0xBF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x04,
-    0x00, 0x00, 0x1F, 0xF2, 0xD0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3,
-    0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF,
-    0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0xB8, 0x03, 0xD3, 0xF8, 0x3F, 0x83, 0xFB, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F,
-    0xF8, 0x03, 0xFB, 0xF8, 0x3F, 0x83, 0xF8, 0xF8, 0x03, 0xD0, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x03, 0x80, 0x00, 0x3F, 0xFF, 0xF7, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xD0, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x80, 0x1F, 0xE0, 0x03, 0xEF, 0xE0, 0x0B, 0xF4, 0x03, 0xD7, 0xF8, 0x03, 0xFC, 0x07, 0xD1,
-    0xFE, 0x00, 0xFF, 0x07, 0xD0, 0x7F, 0x80, 0x3F, 0x87, 0xD0, 0x2F, 0xD0, 0x0F, 0xE7, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xF0, 0x07, 0xFD,
-    0x00, 0x0B, 0xFF, 0xAF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xC2, 0xFF, 0xF4, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F,
-    0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00,
-    0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00,
-    0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80,
-    0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC,
-    0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0xFC,
-    0x00, 0x00, 0x0B, 0xE0, 0xF4, 0x00, 0x00, 0x3D, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00,
-    0x07, 0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4,
-    0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F,
-    0xE0, 0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x47, 0xD0, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x01, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x7F, 0xFD, 0x02, 0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x50, 0x15, 0x54, 0x7F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF0,
-    0x03, 0xF4, 0x00, 0xBF, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x01, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x47, 0xFC, 0x00, 0xBF,
-    0x01, 0xFE, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFE, 0x02, 0xFC, 0x01, 0xFD,
-    0x0B, 0xF4, 0x02, 0xFE, 0xBF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x90, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x03,
-    0xF0, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0xBE, 0x6F, 0x80, 0x00, 0xBE, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-    0x43, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0x42, 0xF8,
-    0x00, 0x00, 0x01, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0,
-    0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F,
-    0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00,
-    0xFE, 0x1F, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0,
-    0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF,
-    0xFD, 0x3F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x2F, 0x0B, 0xC0,
-    0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07,
-    0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00,
-    0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8,
-    0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x40, 0x00, 0x3F, 0xC7, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0x0F, 0xE0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F,
-    0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20,
-    0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x04,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00,
-    0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF,
-    0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xB0, 0xB4, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x0F, 0x5F,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0,
-    0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF,
-    0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E,
-    0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x2F, 0xF9, 0x3F, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF8, 0x1F, 0xE0, 0xFC, 0x0B, 0xF0, 0x1F, 0xC0, 0xFC, 0x0F, 0xC0, 0x3F, 0x42, 0xF4, 0x2F,
-    0xC0, 0x3F, 0x0B, 0xE0, 0x3F, 0x80, 0xBF, 0xBF, 0x40, 0x3F, 0x40, 0xFF, 0xF8, 0x00, 0x3F, 0x03,
-    0xFF, 0x40, 0x10, 0x3F, 0x4B, 0xFF, 0x00, 0xF0, 0x3F, 0xEF, 0x7F, 0xAB, 0xF0, 0x3F, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0F, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F,
-    0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00,
-    0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFF,
-    0xC0, 0x0F, 0xC3, 0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x02, 0xF0, 0xBE, 0x00, 0xFE, 0xFE,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x04, 0x03, 0xF0, 0x0B, 0x40, 0xFF, 0xAF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0x7D, 0x00, 0xBC, 0x2F, 0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F,
-    0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB,
-    0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x47,
-    0xC0, 0x0F, 0xE3, 0xF4, 0x03, 0xF0, 0xFC, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07,
-    0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00,
-    0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x03, 0xD0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x10, 0x1F,
-    0xF8, 0x3F, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x2F, 0x88, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x80, 0x0F,
-    0xFF, 0x40, 0x3F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xF4,
-    0x00, 0xFF, 0xC0, 0x2F, 0x7D, 0x0B, 0xC2, 0xE0, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x80, 0x3F, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xC0, 0xFE, 0x3F, 0x43, 0xF0, 0xFC, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88,
-    0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x30, 0x00, 0x1F, 0xEF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x08, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x03,
-    0xFE, 0xBF, 0xC0, 0xFF, 0x02, 0xFC, 0x1F, 0xC0, 0x1F, 0xC3, 0xF8, 0x01, 0xFC, 0x3F, 0x40, 0x2F,
-    0x83, 0xF0, 0x03, 0xF4, 0x7F, 0x00, 0x7F, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0xEB, 0xF8, 0x01, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x40, 0x00, 0x7F, 0xCB,
-    0x40, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x07, 0xFD, 0x0F, 0xF0, 0x3F, 0xF9, 0xFF, 0xE0, 0x0F, 0xEF, 0xBF, 0x80, 0x3F,
-    0xF0, 0xBE, 0x00, 0xFF, 0x43, 0xF4, 0x07, 0xF8, 0x0F, 0xC0, 0x2F, 0xC0, 0x7F, 0x00, 0xFE, 0x03,
-    0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x1F, 0xC0, 0x7F, 0x14, 0x7F, 0x01, 0xFF, 0xE2, 0xFC, 0x0B, 0xFF,
-    0x4F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x87, 0xF8, 0x3F, 0x80, 0xFF, 0x1F,
-    0xC0, 0x2F, 0xCF, 0xE0, 0x0B, 0xF3, 0xF4, 0x03, 0xF8, 0xFD, 0x00, 0xFD, 0x7F, 0x40, 0x7F, 0x0F,
-    0xD0, 0x3F, 0x43, 0xFD, 0x7F, 0xC0, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02,
-    0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F,
-    0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x7D, 0x00, 0x1F,
-    0x07, 0xC0, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F,
-    0xFF, 0xC0, 0x7F, 0x87, 0xF8, 0x3F, 0x80, 0xFF, 0x1F, 0xC0, 0x2F, 0xCF, 0xE0, 0x0B, 0xF3, 0xF4,
-    0x03, 0xF8, 0xFD, 0x00, 0xFD, 0x7F, 0x40, 0x7F, 0x0F, 0xD0, 0x3F, 0x43, 0xFD, 0x7F, 0xC0, 0x7F,
-    0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0xFF, 0x1E,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xC3, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1,
-    0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07,
-    0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x7D, 0x00, 0x2F, 0x8F, 0xD0, 0x02, 0xF0,
-    0xFC, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F,
-    0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD,
-    0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x6A, 0xAA, 0xA8, 0xBF,
-    0xFF, 0xFD, 0x6A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xBF, 0xF2, 0xD0, 0x01, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFE, 0x1F, 0xE0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x03, 0xFF, 0x00, 0x3F, 0x43,
-    0xEF, 0xC0, 0x0F, 0xC7, 0xCB, 0xE0, 0x03, 0xFB, 0xC3, 0xF4, 0x01, 0xFF, 0x81, 0xFC, 0x00, 0x3F,
-    0x80, 0xFD, 0x00, 0x0F, 0xF1, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x1F, 0xFD, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x03,
-    0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0xC0,
-    0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF, 0xFF, 0x0F, 0xFC, 0x1F,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE,
-    0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03,
-    0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB,
-    0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x2F, 0x0B,
-    0x80, 0x01, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1,
-    0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F,
-    0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F,
-    0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x0F, 0xC3, 0xE0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F,
-    0xF8, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0,
-    0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF,
-    0x18, 0xFF, 0xBC, 0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B, 0xFF, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x2F, 0x83, 0xF0,
-    0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xEF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x01, 0x00, 0x00, 0x3F, 0x0F, 0xF4, 0x00, 0x0F, 0xCF, 0xFF, 0x00, 0x07, 0xEF,
-    0xBF, 0xC0, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0xFF, 0x41, 0xFC, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x0F,
-    0xD0, 0x2F, 0x80, 0x07, 0xF0, 0x0F, 0xD0, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0xFD, 0x03, 0xF4, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x0A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x0B, 0xD2, 0xF0, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F,
-    0xE0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E,
-    0x1F, 0x40, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F,
-    0xFF, 0xFD, 0x00, 0xFE, 0x1F, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03,
-    0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2,
-    0x0F, 0xFB, 0xDF, 0xFD, 0x3F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x2E, 0x01, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00,
-    0x02, 0xF9, 0xBC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02,
-    0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0,
-    0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00,
-    0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F, 0xF0, 0x0B, 0xF0,
-    0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0xFF,
-    0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F, 0xFC, 0x3F, 0xE0,
-    0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x01, 0xFA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0xF8, 0x0B, 0xF4, 0x00,
-    0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xE6, 0xF0,
-    0x0F, 0xE0, 0x10, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAE, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0xF8, 0x0B, 0xF4, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00,
-    0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x7D, 0x00,
-    0xBC, 0x2F, 0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF,
-    0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0, 0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xBA, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0x0F, 0xC0,
-    0x3F, 0xD0, 0x03, 0xE0, 0x2F, 0xD0, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xD0, 0x2F, 0xF8, 0x01, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF9, 0xBC, 0x0F, 0xE0,
-    0x10, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x80, 0xB0, 0x3F, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x07, 0xC0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x03, 0xFB, 0xD0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAE,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x03, 0xF0, 0x0F, 0xF4,
-    0x00, 0xF8, 0x0B, 0xF4, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x34, 0x0B, 0xFE, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x07, 0x40, 0x1F, 0x0B, 0xC0, 0x03, 0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
-    0x9B, 0xC0, 0x3F, 0x80, 0x40, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x2C, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAE, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x12, 0xFC, 0x0B, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00,
-    0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x0B, 0xF0, 0x00, 0x7F, 0x80, 0x2F, 0xC0,
-    0x01, 0xFD, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x00, 0xFF,
-    0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0x7F,
-    0xDA, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xE0, 0x00, 0x07, 0xFF, 0x4F,
-    0x80, 0x00, 0x00, 0xFD, 0x3C, 0x00, 0x00, 0x03, 0xF1, 0xE0, 0x00, 0x00, 0x1F, 0xCB, 0x00, 0x00,
-    0x10, 0xBE, 0x14, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xE1, 0xFF,
-    0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x0F, 0xC0, 0xBF, 0x80, 0x00, 0x3F, 0x4B,
-    0xBE, 0x20, 0x00, 0xFF, 0xBD, 0xFF, 0xD0, 0x03, 0xFF, 0xC3, 0xFE, 0x00, 0x07, 0xF8, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xBA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x4B, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x01, 0xFE, 0x1A, 0xFF, 0xA8, 0x07,
-    0xF4, 0xBF, 0xFF, 0xF0, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x02,
-    0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x01, 0xFF, 0x6B,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xAB, 0xFA, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0xBF, 0x02, 0xF8, 0x00,
-    0x3F, 0x40, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x03, 0xF4, 0x0F, 0xE0,
-    0x00, 0xFC, 0x0B, 0xF8, 0x00, 0x7F, 0x4B, 0xBE, 0x20, 0x0F, 0xFB, 0xDF, 0xFD, 0x03, 0xFF, 0xC3,
-    0xFE, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xC0,
-    0x1F, 0x00, 0x0F, 0xF0, 0x07, 0xC0, 0x03, 0xF8, 0x01, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xF9, 0x55, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x04, 0x00, 0x3F, 0xC0, 0x0B, 0x40, 0x0F, 0xE0, 0x03, 0xD0,
-    0x07, 0xF9, 0x57, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x3F, 0xFF, 0xC0, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xC3, 0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x02, 0xF0, 0xBE,
-    0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x04, 0x03, 0xF0, 0x0B, 0x40, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00,
-    0x00, 0x7C, 0x07, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xF0, 0x07, 0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0xFE, 0x55, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0,
-    0x03, 0xF8, 0x00, 0xF4, 0x01, 0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x0B, 0xE6, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC,
-    0x3F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF,
-    0x80, 0x01, 0xFD, 0x00, 0x40, 0x3F, 0x00, 0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x07,
-    0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8, 0x00, 0xF4, 0x01,
-    0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8,
-    0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F,
-    0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F,
-    0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC,
-    0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F,
-    0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xFA, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x07, 0xD0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x7C,
-    0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x95, 0x7F, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x24, 0x07, 0x40, 0x1F, 0x0B, 0xC0, 0x03,
-    0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0x0F, 0xD0, 0x3F, 0x03, 0xF0, 0x1F,
-    0x81, 0xF8, 0x0B, 0xC2, 0xF8, 0x03, 0xFB, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x10, 0x0F,
-    0xC0, 0x2D, 0x03, 0xFE, 0xBF, 0x40, 0xBF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFB, 0xD0, 0x00, 0x01, 0xFC, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xBA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80,
-    0x0F, 0x80, 0x3F, 0xD0, 0x00, 0xF4, 0x0B, 0xF4, 0x00, 0x0F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x55, 0x43, 0xFC, 0x00, 0xFF,
-    0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0xE0, 0x00, 0xFE, 0x02, 0xFF,
-    0x40, 0x0F, 0xD0, 0x0F, 0xFF, 0x9B, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFB, 0xFF, 0xD0,
-    0x07, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x03, 0xF8,
-    0x00, 0x0B, 0xE7, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFB, 0xFF, 0x80, 0x0F, 0xD0,
-    0x1F, 0xF4, 0x0B, 0xE0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0xD5, 0xBF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x0F, 0x40,
-    0xB0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00,
-    0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C,
-    0x02, 0x80, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xEF, 0xFF, 0x40,
-    0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x0F, 0xE0,
-    0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x3F, 0x40,
-    0x7F, 0xD0, 0x2F, 0x80, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x01, 0xFF, 0x56, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0x00, 0xF0, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x55, 0x54,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xFE, 0x00,
-    0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xEF, 0xFF, 0x40,
-    0x1F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0xFC, 0x0F, 0xE0,
-    0x00, 0x2F, 0x9F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x3F, 0x40,
-    0x7F, 0xD0, 0x2F, 0x80, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x01, 0xFF, 0x56, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xA4, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0x40, 0xBF,
-    0x40, 0x00, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x55, 0x54, 0x3F, 0xC0, 0x0F, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xF4, 0x3F, 0xC0,
-    0x00, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0xFD, 0x00, 0xFF, 0xF9, 0xBF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0xFF, 0xF4, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x02, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x03, 0xF4, 0x07, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x80, 0xBE,
-    0x00, 0x0F, 0xD0, 0x1F, 0xF5, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x02, 0xD0, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x55, 0x55, 0x01, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x40,
-    0x07, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xE5,
-    0x55, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xFF,
-    0xF4, 0x3F, 0xFF, 0x40, 0xBF, 0xFF, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x0B, 0xC0, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x04, 0x00, 0x0F, 0xD2, 0xFE, 0x00, 0x3F,
-    0x3F, 0xFC, 0x01, 0xFE, 0xEB, 0xF0, 0x07, 0xFE, 0x1F, 0xC0, 0x2F, 0xE0, 0xBF, 0x00, 0xFF, 0x03,
-    0xF8, 0x03, 0xF8, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF8, 0x0F, 0xD2,
-    0x0F, 0xD0, 0x3F, 0xFC, 0x7F, 0x00, 0xFF, 0xE2, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0xBF, 0xF4, 0x0B, 0xFF,
-    0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x01, 0x7F, 0xD5, 0x57, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0x80, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0, 0x00, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0,
-    0x7F, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1A, 0xFE, 0xA0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x1B,
-    0xD0, 0x03, 0xF2, 0xFF, 0xC0, 0x1F, 0xEF, 0xFF, 0x00, 0xBF, 0xE1, 0xFC, 0x02, 0xFF, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F,
-    0x80, 0xFD, 0x20, 0xFD, 0x03, 0xFF, 0xC7, 0xF0, 0x0F, 0xFE, 0x2F, 0xC0, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x1F, 0xF2, 0xD0, 0x0F, 0xFF, 0xF0, 0x03, 0xC3, 0xF4, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x90, 0x10, 0x1F, 0xF2, 0xD0, 0xFB, 0xFF, 0x03, 0xC3, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88, 0x00, 0xFF,
-    0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x2F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x1F, 0xFF,
-    0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x80, 0x0F, 0xFF,
-    0x40, 0x3F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x1F, 0x01,
-    0xC0, 0x07, 0xFB, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x07, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x2E, 0x00, 0xC0, 0xBE, 0x6F,
-    0x01, 0xFF, 0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x88, 0x00, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xFA, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xF0, 0x03, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0xFD,
-    0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x88,
-    0x0F, 0xFF, 0x43, 0xFF, 0x80, 0xBF, 0x40, 0x0B, 0x40, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xFE, 0x40,
-    0x2F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x10, 0x1F,
-    0xF8, 0x3F, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x2F, 0x88, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x55,
-    0x50, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80,
-    0x03, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x7F, 0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x0B, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x2F, 0xF0, 0x3F, 0xF8, 0x2F, 0xFC,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x0B, 0xE0, 0x0B, 0xE0, 0x03,
-    0xF4, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x88,
-    0x0F, 0xE0, 0x0F, 0xFF, 0x43, 0xF4, 0x03, 0xFF, 0xC1, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0D, 0x0F, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x7F, 0x0B, 0xC0, 0x00,
-    0x2E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xC2, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x02, 0xD0,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x74, 0x3F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x01, 0xFF, 0xFD, 0x3F, 0xFE, 0x00,
-    0xBF, 0xF4, 0x1F, 0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F,
-    0x83, 0xF8, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40,
-    0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00,
-    0x07, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x40, 0x0F, 0xC2, 0xFC, 0x03, 0xF7, 0xFF, 0x80,
-    0xFB, 0xC7, 0xE0, 0x7F, 0x80, 0xF8, 0x2F, 0xC0, 0xBC, 0x0F, 0xD0, 0xBD, 0x03, 0xFB, 0xFC, 0x01,
-    0xFF, 0xF0, 0x00, 0xBE, 0xBD, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xC2, 0xFE, 0x47, 0xF0, 0x3F, 0xFA,
-    0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x41, 0xFF, 0x40,
-    0xFE, 0x3F, 0xF4, 0x3F, 0xE0, 0x3F, 0x4F, 0xFC, 0x03, 0xF3, 0xE0, 0x40, 0x3F, 0xB8, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0xFC, 0xBC, 0x00, 0x1F, 0xC7, 0xF0,
-    0x81, 0xFC, 0x3F, 0xFD, 0x2F, 0x82, 0xFF, 0xC3, 0xF4, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x0D, 0x03, 0xFC, 0x00, 0xF8, 0x0F, 0xF0,
-    0x07, 0xD0, 0x7F, 0x95, 0x7F, 0x1F, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x1F, 0xE0, 0x1F, 0xFD, 0x03, 0xF9, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00, 0xBF,
-    0xE0, 0x1F, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F,
-    0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x48, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x34, 0x0F, 0xF0, 0x03, 0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0xBF, 0xE0, 0x7F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x03,
-    0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0x80, 0x0F, 0xD2, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x55, 0x54, 0x3D, 0x01, 0xFF, 0xFD, 0x7C, 0x00, 0xBF, 0xF4, 0xB8,
-    0x00, 0x2F, 0xC0, 0xF0, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x03, 0xFC, 0x00, 0xF8, 0x03, 0xFC, 0x01, 0xF4,
-    0x07, 0xF9, 0x57, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x04, 0x0B,
-    0xFE, 0x2F, 0x1F, 0xFE, 0x3E, 0x00, 0xFD, 0x3D, 0x00, 0xFC, 0x7C, 0x01, 0xFC, 0xB4, 0x02, 0xF8,
-    0x20, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x48, 0x00, 0x3F,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0xFF, 0x00, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x34, 0x03,
-    0xFC, 0x00, 0xF8, 0x03, 0xFC, 0x01, 0xF4, 0x07, 0xF9, 0x57, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0xBC, 0x0B, 0xF1, 0xFC, 0x0F, 0xE1, 0xFC, 0x0F, 0xD0, 0xA0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x48, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF5, 0xC0, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x34, 0x0F, 0xF0, 0x03, 0xE0, 0x3F, 0xC0, 0x1F, 0x41, 0xFE, 0x55, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0x80, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x02,
-    0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x01, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD2,
-    0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x15, 0x54, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x6F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0xFD,
-    0x01, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0x00, 0x7D, 0xFF, 0x02, 0xF0, 0x00, 0x0B, 0xC7,
-    0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xF0, 0x00, 0x0F, 0xC1, 0xFE, 0x7E, 0x00, 0x01, 0xF8,
-    0x0F, 0xFB, 0xD0, 0x00, 0x2F, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F,
-    0x00, 0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0xBF,
-    0xFD, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F, 0xD0, 0xFF, 0x03,
-    0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4, 0x3F, 0x40, 0x7F,
-    0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x01, 0xFC, 0x07,
-    0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06,
-    0xFF, 0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0,
-    0x1F, 0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F,
-    0x83, 0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80,
-    0xFF, 0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFF,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x7F,
-    0xD0, 0xFF, 0x03, 0xFF, 0x9F, 0xFE, 0x00, 0xFE, 0xFB, 0xF8, 0x03, 0xFF, 0x0B, 0xE0, 0x0F, 0xF4,
-    0x3F, 0x40, 0x7F, 0x80, 0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD,
-    0x01, 0xFC, 0x07, 0xF1, 0x47, 0xF0, 0x1F, 0xFE, 0x2F, 0xC0, 0xBF, 0xF4, 0xFD, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xFB, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x15, 0x54, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x6F,
-    0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0xFD, 0x01,
-    0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0x00, 0x7D, 0xFF, 0x02, 0xF0, 0x00, 0x0B, 0xC7, 0xF8,
-    0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xF0, 0x00, 0x0F, 0xC1, 0xFE, 0x7E, 0x00, 0x01, 0xF8, 0x0F,
-    0xFB, 0xD0, 0x00, 0x2F, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0x00,
-    0x2F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0xBF, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0xD0, 0x00, 0x7C, 0x2F,
-    0x00, 0x00, 0xF5, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x1F, 0xF4, 0x3F, 0xC0, 0xFF, 0xE7, 0xFF, 0x80, 0x3F,
-    0xBE, 0xFE, 0x00, 0xFF, 0xC2, 0xF8, 0x03, 0xFD, 0x0F, 0xD0, 0x1F, 0xE0, 0x3F, 0x00, 0xBF, 0x01,
-    0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0x7F, 0x01, 0xFC, 0x51, 0xFC, 0x07, 0xFF,
-    0x8B, 0xF0, 0x2F, 0xFD, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x01, 0x00, 0x3F, 0x1F, 0xFC, 0x2F, 0xD0, 0x3C,
-    0x3F, 0xFC, 0xFF, 0xF0, 0x00, 0x02, 0xFB, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0x47, 0xF0, 0x00, 0x03,
-    0xFE, 0x0B, 0xE0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x3F, 0x48, 0x00, 0x0F, 0xD0, 0x3F,
-    0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xF8, 0x00, 0x2F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x01, 0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06, 0xFF,
-    0x40, 0x02, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x1F,
-    0x80, 0x00, 0x7F, 0xFE, 0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F, 0x83,
-    0xF0, 0x00, 0x0F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80, 0xFF,
-    0xBD, 0x00, 0x02, 0xF4, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0, 0x02,
-    0xFF, 0x80, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0x40, 0x0B, 0xFF, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x10, 0x01, 0x01, 0xFF, 0x43, 0xFC, 0x3F, 0xF9, 0xFF, 0xE0, 0x3F, 0xBE, 0xFE, 0x03, 0xFF, 0x0B,
-    0xE0, 0x3F, 0xD0, 0xFD, 0x07, 0xF8, 0x0F, 0xC0, 0xBF, 0x01, 0xFC, 0x0F, 0xE0, 0x2F, 0x80, 0xFD,
-    0x03, 0xF8, 0x1F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x2F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x02, 0x83, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0,
-    0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3,
-    0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFE, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F,
-    0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4,
-    0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x1F, 0x01, 0xC0, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F,
-    0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD,
-    0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0,
-    0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xE0, 0x0C, 0x00, 0x2F, 0x9B, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F,
-    0x80, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD,
-    0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1E, 0x02, 0xD0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F,
-    0xD7, 0xFC, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x0D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F,
-    0xF4, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00,
-    0xBF, 0x82, 0xFD, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xE0,
-    0xFF, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x2F, 0xE0, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x50, 0x00,
-    0x07, 0xC3, 0xD0, 0x00, 0x3F, 0x2F, 0x40, 0x03, 0xF1, 0xF8, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0x70,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x7F, 0x87, 0xF8, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0xBF, 0x03,
-    0xF4, 0x03, 0xF8, 0x0F, 0xD0, 0x0F, 0xD0, 0x7F, 0x40, 0x7F, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xFD,
-    0x7F, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5A, 0x95, 0x55, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFE, 0x40, 0x7F, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x0F, 0x02, 0xFD, 0x00,
-    0x0F, 0xE0, 0x03, 0x80, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0x0F,
-    0xE5, 0x54, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x10, 0x0F,
-    0xF4, 0x00, 0xBF, 0x00, 0x1E, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0x80, 0x3F, 0xFA, 0xBF, 0xE5,
-    0x5B, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x2F, 0xF8, 0x1F, 0xFC, 0x01,
-    0xFF, 0xFE, 0x7F, 0xFE, 0x07, 0xF8, 0x7F, 0xF4, 0x7F, 0x0F, 0xE0, 0x3F, 0xE0, 0x7E, 0x1F, 0xC0,
-    0x2F, 0xC0, 0xFC, 0x3F, 0x80, 0x2F, 0x83, 0xF4, 0x3F, 0x40, 0x3F, 0xAF, 0xC0, 0x3F, 0x40, 0x3F,
-    0xFD, 0x00, 0x7F, 0x40, 0x7F, 0x90, 0x04, 0x3F, 0x40, 0xFF, 0x80, 0x3C, 0x3F, 0xD7, 0xFF, 0xEA,
-    0xFC, 0x1F, 0xFF, 0xDF, 0xFF, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x6B, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0xBF, 0xD0, 0x01, 0x2F, 0xC1,
-    0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00,
-    0xBF, 0x01, 0xFD, 0x00, 0x0B, 0xF1, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x3F,
-    0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0B, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xF8, 0xBF, 0xFF, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x04, 0x07, 0xFD, 0x1F, 0xC3, 0xFF, 0x9F, 0xF0, 0x0B, 0xDF, 0xFC, 0x02, 0xFB, 0x95, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x16, 0xBA,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFD, 0x00, 0x12, 0xFC, 0x1F, 0xF0, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x00, 0xBF, 0x1B, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xDB, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x03, 0xF8, 0x0F, 0xF0,
-    0x00, 0x7F, 0x80, 0xBF, 0xD0, 0x7F, 0xFF, 0x02, 0xFF, 0x8B, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x01, 0x00, 0x7F, 0xD1, 0xFC, 0x0F, 0xFE, 0x7F, 0xC0, 0x0B, 0xDF, 0xFC, 0x00, 0xBE, 0xE5, 0x40,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x07,
-    0xD0, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFE, 0xBF, 0xD0, 0x01, 0x2F, 0xC1, 0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F,
-    0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x0B, 0xF1, 0xBF, 0x80,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xC3,
-    0xF8, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x07, 0xF8, 0x0B, 0xFD, 0x07,
-    0xFF, 0xF0, 0x2F, 0xF8, 0xBF, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x07,
-    0x40, 0x1F, 0x0B, 0xC0, 0x03, 0xD7, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x1F, 0xF4, 0x7F, 0x0F, 0xFE, 0x7F, 0xC0, 0x2F, 0x7F,
-    0xF0, 0x0B, 0xEE, 0x54, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x90,
-    0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x2F, 0x00, 0xBF, 0x00, 0xBC, 0x03,
-    0xFC, 0x02, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xC0, 0x0F, 0xF0, 0x2F, 0x00, 0x2F,
-    0xC0, 0xFD, 0x00, 0xFF, 0x03, 0xFE, 0x5F, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xD1, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x02, 0x00, 0xFE, 0x02, 0xF0,
-    0x2F, 0x80, 0xFF, 0x5F, 0xC0, 0x3F, 0xFF, 0xD0, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x0F,
-    0xD1, 0xF0, 0x00, 0x78, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x90, 0x00, 0x2F, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x2F, 0x00, 0xBF, 0x00, 0xBC, 0x03, 0xFC, 0x02, 0xD0,
-    0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xC0, 0x0F, 0xF0, 0x2F, 0x00, 0x2F, 0xC0, 0xFD, 0x00,
-    0xFF, 0x03, 0xFE, 0x5F, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x7D, 0xFC, 0x00, 0x3D,
-    0x0F, 0x00, 0x2D, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F,
-    0xFF, 0x40, 0x3F, 0x47, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x08, 0x03, 0xF8, 0x0B, 0xC0, 0xBE, 0x03, 0xFD, 0x7F, 0x00, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0xBF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0x40, 0xBC, 0x02, 0xFC, 0x02, 0xF0, 0x0F, 0xF0, 0x0B, 0x40,
-    0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x00, 0x3F, 0xC0, 0xBC, 0x00, 0xBF, 0x03, 0xF4, 0x03,
-    0xFC, 0x0F, 0xF9, 0x7F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xFD,
-    0x03, 0xF4, 0x7C, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00,
-    0x1F, 0xF4, 0x08, 0x03, 0xF8, 0x2F, 0x02, 0xF8, 0x3F, 0xD7, 0xF0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00,
-    0x07, 0xE0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFD,
-    0x02, 0xF0, 0x02, 0xFC, 0x02, 0xF0, 0x03, 0xFC, 0x02, 0xD0, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xC0, 0x0F, 0x00, 0x3F, 0xC0, 0x2F, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0xC0, 0x3F, 0xE5,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x03, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xD0, 0x03, 0xF4, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x08, 0x03, 0xF8, 0x02, 0xF0, 0x2F, 0x80, 0x3F, 0xD7, 0xF0,
-    0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B, 0xF0, 0x2F,
-    0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07,
-    0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x01, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3D,
-    0x00, 0x01, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xE0, 0x7F, 0x42, 0xF1, 0xF4, 0x2F, 0xC0, 0xBC, 0x3C, 0x0F, 0xF0, 0x3D, 0x05,
-    0x03, 0xF8, 0x05, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x14, 0xF0,
-    0x00, 0x7E, 0x38, 0x00, 0x3F, 0x48, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0,
-    0x05, 0xFE, 0x50, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC1, 0xE0, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC,
-    0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xBF, 0xEA, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x17, 0xFD, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00,
-    0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0x81, 0xFF, 0xFE, 0x07, 0xFF,
-    0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x0F, 0xF2, 0xD0,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x7F, 0xFD, 0x02,
-    0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x40, 0x00, 0x7F, 0x8B, 0x40, 0x03, 0xEF, 0xFC, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x18, 0xFF, 0xBC,
-    0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x4B, 0xFF, 0xF0, 0x3F, 0xFF, 0x5F, 0xFF,
-    0x40, 0xBF, 0xE4, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03,
-    0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00,
-    0x1F, 0xC0, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x2F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00,
-    0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xD0,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x55, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x7F, 0xFD, 0x02,
-    0xFF, 0x90, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x80,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0xB4, 0x07, 0x00, 0x03, 0xF9, 0xB8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x06, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xF0, 0x7F, 0xC0, 0x2F, 0x87, 0xFF, 0x18, 0xFF, 0xBC,
-    0xFF, 0xF3, 0xFF, 0xC3, 0xFF, 0x07, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x74, 0x00,
-    0x00, 0x02, 0xD7, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x55,
-    0x40, 0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07,
-    0xF0, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03,
-    0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x02, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xF0, 0xB0, 0x00, 0x03, 0x82, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F,
-    0x40, 0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03,
-    0xF4, 0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF,
-    0xCF, 0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00,
-    0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x34, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x55, 0x54, 0xBF, 0xFF, 0x03, 0xFF, 0xF5, 0xFF, 0xF4, 0x0B, 0xFE, 0x40, 0xFF, 0x00, 0x07, 0xF0,
-    0x03, 0xF8, 0x00, 0x2F, 0x80, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x03, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x01, 0xFD, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x02,
-    0xFE, 0x00, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x0B, 0x83, 0xC0,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xA0, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xF1, 0xFF, 0xE0, 0x3F, 0x80, 0x3F, 0x40,
-    0xFD, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4,
-    0x03, 0xF0, 0x2F, 0xC0, 0x1F, 0xC1, 0xFF, 0x00, 0xBE, 0x1F, 0xFC, 0x63, 0xFE, 0xF3, 0xFF, 0xCF,
-    0xFF, 0x0F, 0xFC, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x52,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xE0,
-    0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F,
-    0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x2F,
-    0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF8, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F,
-    0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0,
-    0x7F, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xFE,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x15, 0x54, 0x3F, 0xFF, 0x80, 0xF8,
-    0x0B, 0xFF, 0xC2, 0xFF, 0xE0, 0x1F, 0x80, 0x2F, 0xF4, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x2F, 0x80, 0x07, 0xF4, 0x0B, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0xFF,
-    0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x2F, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x43, 0xDF, 0xC2, 0xF4, 0x00,
-    0x03, 0xF8, 0xBC, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x8F, 0x4F, 0xCB, 0xD0, 0x00, 0x02, 0xFA, 0xF0,
-    0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xBE, 0x0B, 0xEF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x7D, 0xF8, 0x00, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x00, 0x2D, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x2F, 0xC0, 0xBE, 0x07, 0xF2, 0xFF, 0x81, 0xFC, 0x0F,
-    0xE0, 0xBF, 0x03, 0xF4, 0x2F, 0x80, 0xFC, 0x0F, 0xD0, 0xBD, 0x03, 0xF4, 0x3F, 0x82, 0xF0, 0x0B,
-    0xE1, 0xFF, 0x0F, 0x80, 0x1F, 0x8B, 0xFC, 0x7D, 0x00, 0x3E, 0x3F, 0xF3, 0xF0, 0x00, 0xFA, 0xEB,
-    0xDF, 0x40, 0x03, 0xFF, 0x2F, 0xF8, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F, 0x42, 0xFC, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x1F, 0xC2, 0xF0,
-    0x00, 0x02, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0x7F, 0xFF,
-    0x0F, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x01, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xEF,
-    0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x01, 0xF4, 0x3C,
-    0x00, 0x00, 0xB4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xD0,
-    0x7F, 0x40, 0x2F, 0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x03,
-    0xF4, 0x3F, 0x40, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x07, 0xE2, 0xF0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x47, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x0B, 0xE0, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x00, 0xFE, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x3F, 0xD0, 0x0F, 0x80, 0x3F, 0xE0, 0x02, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x01, 0xD0, 0x07,
-    0xFC, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xFE, 0x55, 0x7F, 0x40, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F, 0xF4, 0xFC, 0x07, 0xFF, 0xFF, 0xC0,
-    0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0, 0x1F, 0x02, 0xFF, 0xFB, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFC, 0x00, 0xFF, 0x40, 0x3E, 0x00, 0xFF, 0x80, 0x0B, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0x40, 0x1F, 0xF0, 0x03, 0xF0, 0x0F,
-    0xF4, 0x01, 0xF8, 0x0F, 0xF9, 0x55, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2F, 0xF4,
-    0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xBE, 0xFF, 0xF0, 0x0B, 0x80, 0xFD, 0x00, 0x70, 0x3F, 0x40, 0x00,
-    0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0B, 0xE0, 0x1F,
-    0x02, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x1F, 0xBF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x50, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0x00, 0x3F, 0xD0, 0x0F, 0x80,
-    0x3F, 0xE0, 0x02, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x01, 0xD0, 0x07, 0xFC, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xFE, 0x55, 0x7F,
-    0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x07, 0x80, 0x03, 0xC1, 0xF4, 0x00, 0x3E, 0x7D, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFF, 0x4F, 0xC0, 0x7F, 0xFF,
-    0xFC, 0x0B, 0xEF, 0xFF, 0x00, 0xB8, 0x0F, 0xD0, 0x07, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x08, 0x00, 0xBE, 0x01, 0xF0, 0x2F, 0xFF, 0xBF,
-    0x03, 0xFF, 0xFF, 0xF0, 0x3E, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x02, 0xF8, 0x3C, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0x81, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xAA, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xFE,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x40, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFD, 0x00, 0x02, 0xFE,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x07,
-    0xF8, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F,
-    0x40, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x40, 0x7F, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x3F,
-    0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xBA, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x7F, 0x43, 0xFD,
-    0x3E, 0x1F, 0xC0, 0x7F, 0x81, 0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFE, 0x03,
-    0xFC, 0x00, 0x7F, 0x42, 0xFD, 0x00, 0x2F, 0xEB, 0xFE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFE,
-    0x90, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0x74, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x40, 0x00, 0x1F, 0x87, 0xF8, 0x00, 0x2F, 0x6F, 0xFC,
-    0x00, 0x3F, 0xBE, 0xFD, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x7F, 0x40, 0xFD,
-    0x00, 0xBF, 0x00, 0xFC, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0xFC, 0x03, 0xF4, 0x01, 0xFC, 0x0B, 0xF0,
-    0x02, 0xFE, 0x6F, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x6A, 0xAA, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x0B,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xC1, 0x7F, 0x94, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x40, 0x7F, 0x0B, 0x41, 0xFF, 0xFD, 0x07, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x02, 0x07, 0xC0, 0x2E, 0x7D, 0x00, 0xFF, 0xE0,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x41, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFE, 0x0F, 0xF0, 0x7E, 0x7F, 0x03, 0xF8, 0x1F, 0x4F, 0x81, 0xFD, 0x07, 0xC0, 0x50, 0xBF,
-    0x00, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x00, 0xFC, 0x1C, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x05, 0xFE,
-    0x50, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC1, 0xE0, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B, 0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41,
-    0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0xF0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x50, 0x15, 0x5B, 0xF8, 0xBF, 0xFF,
-    0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x2F, 0xF9, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFE,
-    0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x2F, 0xC2, 0xFF,
-    0x40, 0x7F, 0xE0, 0x7F, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0,
-    0xBF, 0x00, 0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0x87, 0xFF, 0x18, 0x03, 0xFE, 0xF3, 0xFF, 0xC0,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x07,
-    0xC0, 0x7F, 0x03, 0xF8, 0x0B, 0xC0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0B, 0xC1, 0xFC, 0x3F,
-    0x07, 0xC0, 0x20, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x00, 0x3F, 0xE0, 0x3E, 0x7C, 0x3F, 0x0F, 0x9F,
-    0x00, 0xD0, 0x00, 0x00, 0x06, 0x40, 0x41, 0xFE, 0x2C, 0x3E, 0xFF, 0xC3, 0x87, 0xF4, 0x00, 0x04,
-    0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xE1, 0x55, 0x50, 0x10, 0x00, 0xB4, 0x07, 0xFD, 0x6E, 0x7F, 0xFC,
-    0x1B, 0x90, 0x04, 0x7F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x3F, 0x5F, 0xC3, 0xF1,
-    0xF8, 0x04, 0x00, 0x00, 0x1B, 0xD2, 0xFF, 0xDF, 0x0F, 0x54, 0x3C, 0x0B, 0xD0, 0xB8, 0x01, 0xD0,
-    0x00, 0x00, 0x07, 0xE0, 0x1F, 0xFC, 0x3C, 0x3C, 0x38, 0x2C, 0x3D, 0x78, 0x2F, 0xF0, 0x01, 0x40,
-    0x00, 0x80, 0x40, 0x0B, 0x87, 0xC0, 0x7E, 0x3F, 0x03, 0xF2, 0xF0, 0x3E, 0x1F, 0x00, 0xE0, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x30, 0x0B, 0x6E, 0x0B, 0xC7, 0xDB, 0xC0, 0xFF, 0xC0, 0x1F, 0xD0, 0x02,
-    0x90, 0x00, 0x00, 0x10, 0x78, 0xB4, 0xBC, 0xF8, 0x3C, 0x7C, 0x2D, 0x3D, 0x0D, 0x1C, 0x00, 0x00,
-    0x00, 0x54, 0x01, 0xFF, 0xC2, 0xFF, 0xF8, 0xE0, 0x2E, 0x10, 0x02, 0x00, 0x00, 0x00, 0x3C, 0x0F,
-    0x02, 0xE0, 0x3D, 0x03, 0xE0, 0x3F, 0x00, 0x40, 0x07, 0xD0, 0xBF, 0x03, 0xF0, 0x3D, 0x0B, 0xC2,
-    0xF0, 0x28, 0x00, 0x2E, 0x2F, 0x8F, 0xC3, 0xE0, 0xBC, 0x0F, 0x01, 0x80, 0x14, 0x3E, 0x3D, 0x7C,
-    0xB8, 0xF0, 0x10, 0x07, 0x80, 0xBC, 0x0F, 0xC2, 0xF0, 0x3C, 0x01, 0x00, 0x00, 0x2E, 0xBF, 0xFE,
-    0x78, 0x0A, 0x02, 0x43, 0xF4, 0xFC, 0x3F, 0x1F, 0xC1, 0x80, 0xA0, 0x0A, 0x43, 0xFE, 0xB0, 0xEB,
-    0x0E, 0x7F, 0xC0, 0x50, 0x06, 0x43, 0xF0, 0xF8, 0x3C, 0x3D, 0x04, 0x00, 0x0B, 0x80, 0xFD, 0x03,
-    0xD0, 0xBC, 0x2F, 0x02, 0x40, 0x01, 0x00, 0xE0, 0x3C, 0x07, 0x80, 0xBE, 0x83, 0xFC, 0x04, 0x00,
-    0x1A, 0x0B, 0xC3, 0xF0, 0xF8, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x40, 0x3F, 0xF0,
-    0x7E, 0x7E, 0x7E, 0x07, 0xC4, 0x00, 0x40, 0x00, 0x00, 0xB0, 0x03, 0xFD, 0x1E, 0xBF, 0xFC, 0x2F,
-    0xE0, 0x00, 0x00, 0x0B, 0x81, 0x82, 0xFF, 0x3C, 0x3D, 0xFF, 0xC3, 0x43, 0xF0, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x0F, 0xFF, 0xF3, 0xFF, 0xF8, 0x00, 0x50, 0x1F, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0x80,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xBD, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x03, 0xE1, 0xF4, 0xBE, 0x3F, 0x8B, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x0F, 0x07,
-    0xC1, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0,
-    0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00,
-    0x1A, 0xBA, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEF, 0xFC, 0x01, 0x2F, 0xC1, 0xFD, 0x00,
-    0x3F, 0x80, 0xFE, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFD, 0x1B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x3E,
-    0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x07, 0xF4, 0x03, 0x80, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFB, 0xF4, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x7D, 0x2F, 0x80, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x0F,
-    0xC0, 0x7F, 0x40, 0x0B, 0xD0, 0x0F, 0xD0, 0x07, 0xF0, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xFF, 0x02,
-    0xF8, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x0B, 0xF4, 0xBF, 0x55, 0x56, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07,
-    0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D,
-    0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xC0, 0x0F, 0xF4, 0x03, 0xE0, 0x0F, 0xF8, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x74, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0xFF, 0x40,
-    0x1F, 0x80, 0xFF, 0x95, 0x5F, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x50, 0x1F, 0xFF, 0xD0, 0xFF, 0xFE, 0x00, 0xBF,
-    0xF4, 0x0B, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x55, 0x5F, 0xF0, 0x00,
-    0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x43, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xF0, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x02,
-    0xFE, 0x1F, 0xE0, 0x00, 0x1F, 0xE2, 0xFC, 0x00, 0x01, 0xFE, 0x3F, 0xC7, 0xFF, 0x9F, 0xE3, 0xFC,
-    0xFF, 0xF5, 0xFE, 0x3F, 0x85, 0x54, 0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0xE6, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01,
-    0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
-    0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0xBF,
-    0xFF, 0x40, 0x00, 0x55, 0x54, 0x05, 0x55, 0x01, 0xFF, 0xFD, 0x3F, 0xFE, 0x00, 0xBF, 0xF4, 0x1F,
-    0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00,
-    0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x40, 0x00, 0x02, 0xFC,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF8, 0x00, 0x07, 0xF8, 0x03,
-    0xFF, 0x00, 0x7F, 0xFF, 0x01, 0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0xBE, 0x00, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x0B,
-    0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x7F, 0x00,
-    0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x1F,
-    0xE0, 0x2F, 0xFD, 0x01, 0xFF, 0xFC, 0x7F, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x00, 0x05,
-    0x55, 0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xD0, 0x7E, 0xFC,
-    0x00, 0x00, 0xF7, 0xF4, 0x3E, 0x7F, 0x00, 0x00, 0xBC, 0xBE, 0x1F, 0x2F, 0x80, 0x00, 0x3F, 0x2F,
-    0x8F, 0x8B, 0xE0, 0x00, 0x0F, 0x87, 0xF7, 0xC2, 0xF8, 0x00, 0x07, 0xC0, 0xFF, 0xD0, 0xFE, 0x00,
-    0x03, 0xF0, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0xF8, 0x0F, 0xF4, 0x0F, 0xD0, 0x00, 0x7D, 0x02, 0xFC,
-    0x03, 0xF4, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x1E, 0x00, 0x7F, 0x40, 0x2F,
-    0xFD, 0x00, 0x01, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x40, 0x01,
-    0x55, 0x40, 0x1F, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF0, 0x06, 0xFF, 0x40, 0x02, 0xFF, 0x40,
-    0x0F, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x7F, 0xFE,
-    0x01, 0xF4, 0x00, 0x07, 0xDF, 0xF0, 0x2F, 0x00, 0x00, 0xBC, 0x7F, 0x83, 0xF0, 0x00, 0x0F, 0xC3,
-    0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x80, 0xFF, 0xBD, 0x00, 0x02, 0xF4,
-    0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0x94, 0x05, 0xFC, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x24, 0x01,
-    0xF0, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xFA, 0xAA, 0xBF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02,
-    0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC,
-    0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF,
-    0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x40, 0x02, 0xFC, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40,
-    0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0x80, 0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0x4B, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0x00,
-    0x1A, 0xBA, 0x40, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x04, 0xBF, 0x0B, 0xFC,
-    0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC, 0x03,
-    0xF8, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xFE,
-    0x90, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0xBC, 0x00, 0x7F, 0x80,
-    0x2E, 0x00, 0x0F, 0xF0, 0x0B, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0xFE, 0x00, 0x2F, 0x00, 0xFF, 0xAA, 0xBF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xF8, 0x1F, 0xD0, 0xBC, 0x7D, 0x0B,
-    0xF0, 0x2F, 0x0F, 0x03, 0xFC, 0x0F, 0x41, 0x40, 0xFE, 0x01, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0x80, 0x00, 0x19, 0x1F, 0xF8,
-    0x00, 0x2F, 0xCF, 0xFF, 0x00, 0x2F, 0xF0, 0x2F, 0xD0, 0x0F, 0xE0, 0x03, 0xF8, 0x0F, 0xF0, 0x00,
-    0xFF, 0x07, 0xF0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00, 0xFD, 0xF8, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE5, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFB, 0xFE, 0xFF, 0x40, 0xFF, 0x0F, 0xE0, 0xFF, 0x0B, 0xF0, 0x3F, 0x42, 0xFC, 0x3F, 0x40, 0xFC,
-    0x07, 0xF1, 0xFD, 0x07, 0xF0, 0x2F, 0xC7, 0xF4, 0x2F, 0xC0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0B, 0xF0,
-    0x2F, 0xE7, 0xF5, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0, 0x0B, 0xFE, 0x01,
-    0xFF, 0x80, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x3F,
-    0x40, 0x00, 0x00, 0x3F, 0xEF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0x4F, 0xE0, 0x00, 0x00, 0x2F, 0x82, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80,
-    0x00, 0x1F, 0xC0, 0x0B, 0xF4, 0x00, 0x7F, 0xFD, 0x0F, 0xFF, 0xC0, 0x3F, 0xFF, 0x4B, 0xFF, 0xF0,
-    0x00, 0x29, 0x01, 0x55, 0x50, 0x1A, 0x4F, 0xD0, 0xFF, 0xFC, 0x1F, 0xD2, 0xFC, 0x2F, 0xFD, 0x0F,
-    0xE0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xFE, 0x03, 0xF8, 0x0B, 0xE0, 0x3F, 0x40, 0xFC,
-    0x02, 0xF8, 0x1F, 0xC0, 0xBF, 0x00, 0xBE, 0x07, 0xF0, 0x3F, 0x40, 0x2F, 0xC2, 0xFC, 0x1F, 0xC0,
-    0x07, 0xF0, 0xFE, 0x1F, 0xD0, 0x00, 0xFF, 0x7F, 0xAF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xB9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0xFE,
-    0x00, 0x01, 0xFE, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x04, 0xBE, 0x00, 0x1F,
-    0xC0, 0x2C, 0x3F, 0x00, 0x7F, 0x0F, 0x3C, 0x1F, 0x41, 0xF8, 0x2F, 0x7E, 0xAF, 0xC3, 0xFA, 0xBE,
-    0x7F, 0xFF, 0x47, 0xFF, 0xFD, 0xBF, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF,
-    0x83, 0xD0, 0x1F, 0xFF, 0x5F, 0x81, 0xFE, 0x7E, 0xFC, 0x0F, 0xE0, 0x7F, 0xE0, 0x7F, 0x00, 0xFF,
-    0x03, 0xF8, 0x03, 0xF8, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x00, 0x7E, 0x01, 0xFC, 0x03, 0xF8, 0x03,
-    0xF4, 0x3F, 0xE0, 0x4F, 0xFB, 0xF7, 0xEF, 0x2F, 0xFF, 0x4F, 0xF8, 0x2F, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x0B,
-    0xE0, 0xBD, 0x00, 0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x0B, 0xD0, 0x0F, 0xD0, 0x3F, 0x00, 0x3F, 0x01,
-    0xF4, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xF1, 0xFC, 0x00, 0x2F, 0x8F, 0xFC, 0x00, 0xBD, 0x03, 0xF8,
-    0x03, 0xF4, 0x0B, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0x7F, 0x01, 0xF8, 0x02, 0xF8, 0x0B,
-    0xE0, 0x0F, 0xC0, 0x3F, 0xD1, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFB, 0xFE, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8, 0x6F,
-    0xC0, 0xFE, 0x03, 0xF4, 0x2F, 0x80, 0xFD, 0x0F, 0xC0, 0x2F, 0x83, 0xF0, 0x0B, 0xE1, 0xF4, 0x01,
-    0xF8, 0xF8, 0x00, 0x7E, 0xBC, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xE0, 0x02, 0xF0, 0x3E, 0x00, 0x3F, 0x00, 0xD0, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xF4, 0xBF, 0x00, 0xFD, 0x03, 0xF4,
-    0x2F, 0xC0, 0x3F, 0x83, 0xF4, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0x87, 0xF4, 0x03, 0xF4, 0x3F, 0x40,
-    0xBF, 0x03, 0xFD, 0x6F, 0xD0, 0x1F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xFD, 0x07, 0xF4, 0x6C, 0x0B, 0xE0, 0x00, 0x0B,
-    0xE0, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x1F, 0xE5, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00,
-    0x14, 0x3F, 0xE6, 0xF8, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x0B, 0xE0, 0x04, 0x0F, 0xC0, 0xBC, 0x0F, 0xE7, 0xFD, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0x90, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0xBF, 0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xE0, 0x00,
-    0x0B, 0xD0, 0x01, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x01, 0xFF,
-    0x47, 0xFC, 0x3F, 0xF9, 0xFF, 0xC0, 0x3F, 0xBE, 0xFD, 0x03, 0xFF, 0x0F, 0xD0, 0x3F, 0xC1, 0xFC,
-    0x07, 0xF8, 0x1F, 0xC0, 0xBF, 0x02, 0xF8, 0x0F, 0xF0, 0x3F, 0x80, 0xFD, 0x03, 0xF4, 0x1F, 0xC0,
-    0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x2F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xB9,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xC2, 0xFC, 0x03,
-    0xF0, 0x0F, 0xD0, 0xBE, 0x00, 0xFD, 0x0F, 0xC0, 0x0F, 0xD2, 0xF8, 0x00, 0xFE, 0x3F, 0x40, 0x0F,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xC7, 0xFA, 0x56, 0xFC, 0xBF, 0x00, 0x2F, 0x8B, 0xF0,
-    0x03, 0xF4, 0xBF, 0x00, 0x7F, 0x07, 0xF0, 0x0F, 0xD0, 0x7F, 0x02, 0xFC, 0x03, 0xFD, 0xBF, 0x00,
-    0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xFC, 0x03,
-    0xF8, 0x07, 0xF4, 0x07, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F,
-    0x84, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x7F, 0xE0, 0x1F,
-    0xD3, 0xFF, 0x81, 0xFF, 0x40, 0xFD, 0x1F, 0xE8, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x7E, 0xBF, 0x00, 0x02, 0xF7, 0xFC, 0x00, 0x0F, 0xFD, 0xF0, 0x00, 0x3F, 0xCB, 0xC0, 0x01, 0xFE,
-    0x2F, 0x01, 0x07, 0xF0, 0xBF, 0xB8, 0x2F, 0x41, 0xFF, 0xD0, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x2F, 0x7D, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0xFD, 0x1F, 0x80, 0x0B, 0xF0,
-    0x3E, 0x00, 0xBF, 0x40, 0xFF, 0xDB, 0xF8, 0x03, 0xFF, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x0B, 0xFC, 0x10,
-    0x3F, 0xFF, 0xEF, 0xBC, 0x0F, 0xFF, 0xD7, 0xFE, 0x07, 0xEF, 0xD0, 0xFE, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0xF4, 0x1F, 0xDB, 0xFF, 0x03, 0xF8,
-    0x6F, 0xC0, 0xFE, 0x03, 0xF4, 0x2F, 0x80, 0xFD, 0x0F, 0xC0, 0x2F, 0x83, 0xF0, 0x0B, 0xE1, 0xF4,
-    0x01, 0xF8, 0xF8, 0x00, 0x7E, 0xBC, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x19,
-    0x07, 0xF6, 0xFD, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x50, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0x90, 0x1F, 0xD0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xFF, 0x40,
-    0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x01, 0x6F, 0xD0, 0x03,
-    0xFF, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F,
-    0xE1, 0xFE, 0x0F, 0xE0, 0x3F, 0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F,
-    0x40, 0x3F, 0x5F, 0xD0, 0x1F, 0xC3, 0xF4, 0x0F, 0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7E, 0xFE, 0xBF, 0xA0, 0x08, 0x3E, 0x0F, 0x80, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x0B, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x2F, 0x80,
-    0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x7F, 0x43, 0xFF, 0xD0, 0x3F, 0xC0, 0xFF, 0xF0, 0x1F, 0xC0, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xE0, 0x1F, 0xC0, 0x3F, 0x40, 0x7F,
-    0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xE0, 0x1F, 0x80, 0x3F, 0x40, 0xBE, 0x02, 0xFC, 0x03,
-    0xFE, 0x6F, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1E, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0xC1, 0xFE, 0x7E, 0x0F, 0xD0, 0x10, 0xBF,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x07,
-    0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x01, 0xBF, 0xC0,
-    0x0F, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFE, 0xBF, 0xA0, 0x0F, 0xE0, 0x3F, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x3F, 0x80,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0xBF, 0x00, 0x3F, 0x40,
-    0xFD, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF4, 0xFE, 0xFE, 0xA4, 0x30,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x0F, 0xFB, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x14, 0x1F, 0xFC, 0x3F, 0x8F, 0xFF, 0x07, 0xF0, 0x2F, 0x80, 0xFD,
-    0x0F, 0xD0, 0x3F, 0x43, 0xF0, 0x0F, 0xD1, 0xF8, 0x03, 0xF0, 0xFD, 0x01, 0xFC, 0x3F, 0x00, 0xBE,
-    0x0F, 0xC0, 0x3F, 0x03, 0xF0, 0x3F, 0x40, 0xFF, 0xBF, 0x80, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x2F, 0x83, 0xFF, 0x00, 0x3F, 0x43, 0xFF,
-    0xF0, 0x3F, 0x82, 0xF4, 0xFD, 0x1F, 0xC0, 0xFC, 0x2F, 0x8F, 0xD0, 0x7E, 0x07, 0xE3, 0xF0, 0x3F,
-    0x42, 0xF8, 0xFC, 0x0F, 0xC0, 0xBD, 0x7F, 0x03, 0xF0, 0x3F, 0x0F, 0xC1, 0xF8, 0x2F, 0x83, 0xF8,
-    0xBE, 0x1F, 0xC0, 0x7F, 0xBF, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xBF, 0xD0,
-    0x1F, 0xC0, 0x3F, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x0B, 0xE0, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0xBE, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xBF, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x0B, 0xD2, 0xF8, 0x00, 0x03, 0xF0, 0xBF,
-    0x18, 0x03, 0xF4, 0x1F, 0xFF, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x40, 0x3F, 0x01, 0x07, 0xFE, 0x07, 0xF2, 0xF8, 0xFF, 0xE0, 0xBE, 0x0F, 0xC0, 0xBD, 0x0B,
-    0xD0, 0xFD, 0x0F, 0xC0, 0xFC, 0x0F, 0xD1, 0xFC, 0x0F, 0xC0, 0xFD, 0x2F, 0x81, 0xFC, 0x0F, 0xD3,
-    0xF4, 0x2F, 0x80, 0xFC, 0x3F, 0x03, 0xF4, 0x1F, 0x83, 0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0xC7, 0xF0,
-    0xFE, 0x01, 0xFF, 0xBF, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x6D, 0x0F,
-    0xD1, 0xFC, 0x0F, 0xC0, 0xBD, 0x2F, 0x80, 0xFC, 0x0B, 0xD3, 0xF4, 0x0F, 0x80, 0xFD, 0x3F, 0x01,
-    0xF4, 0x0F, 0xC3, 0xF0, 0x1F, 0x00, 0xFC, 0x7F, 0x03, 0xF0, 0x2F, 0x43, 0xFD, 0xFF, 0xDB, 0xF0,
-    0x2F, 0xFF, 0x7F, 0xFC, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF,
-    0xFD, 0x00, 0xFE, 0x1F, 0xF0, 0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F,
-    0xFB, 0xDF, 0xFD, 0x3F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x80,
-    0x00, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02,
-    0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xB4, 0xB8, 0x00, 0x00,
-    0x83, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0x80, 0x1F, 0xFF, 0xFD, 0x00, 0xFE, 0x1F, 0xF0,
-    0x0B, 0xF0, 0x2F, 0x80, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F,
-    0x40, 0xFF, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0xBB, 0xE2, 0x0F, 0xFB, 0xDF, 0xFD, 0x3F, 0xFC,
-    0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xE1, 0xF0, 0x00,
-    0x00, 0x02, 0xFE, 0x20, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0xBC, 0x00, 0x00,
-    0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xAF, 0x80, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xD1, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x2F, 0x80,
-    0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x1F, 0xFF, 0x80,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x4F, 0x40, 0x00, 0x1F, 0x41, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F,
-    0x87, 0xFC, 0x00, 0x2F, 0xC0, 0xBE, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xC0, 0x03,
-    0xF8, 0x0B, 0xF0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x02, 0xFE, 0x00, 0x0F, 0xD2, 0xEF, 0x88,
-    0x03, 0xFE, 0xF7, 0xFF, 0x40, 0xFF, 0xF0, 0xFF, 0x80, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xB4, 0xB4, 0x00, 0x00, 0x02, 0xFD, 0x10, 0x00, 0x00, 0x0B, 0xEF, 0x00,
-    0x00, 0x00, 0x2F, 0x4B, 0x80, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0,
-    0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F,
-    0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x42, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x2F, 0x4F, 0x40, 0x01, 0xF4, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0,
-    0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F,
-    0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBA,
-    0xE0, 0x00, 0x00, 0x00, 0x18, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0x00, 0x02, 0xFD, 0x74,
-    0x00, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0xB8, 0x00, 0x00, 0x00, 0xA0, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x80, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xD1, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x7F, 0x80, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x09, 0x2D,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x04, 0x3C, 0x00, 0x00, 0x2F, 0xCA, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x2F, 0x4F, 0x40, 0x00, 0x1F, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0x87, 0xFC, 0x00, 0x2F,
-    0xC0, 0xBE, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xC0, 0x03, 0xF8, 0x0B, 0xF0, 0x00,
-    0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x02, 0xFE, 0x00, 0x0F, 0xD2, 0xEF, 0x88, 0x03, 0xFE, 0xF7, 0xFF,
-    0x40, 0xFF, 0xF0, 0xFF, 0x80, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0D, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x0F,
-    0x80, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F,
-    0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD,
-    0x00, 0x07, 0xC0, 0x80, 0x00, 0x3F, 0xDB, 0x40, 0x01, 0xE7, 0xFC, 0x00, 0x02, 0x02, 0xD0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x7D,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00,
-    0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF,
-    0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xEF, 0xC0, 0x00, 0x00, 0x3F, 0x47, 0xD0, 0x00, 0x00, 0x78, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F,
-    0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F,
-    0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF,
-    0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x18, 0xB4, 0x40, 0x00, 0x00, 0x3D, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00,
-    0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x11, 0x80, 0x00, 0x03, 0xC0, 0x1C, 0x00, 0x0F, 0xD6, 0xE0, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F,
-    0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F,
-    0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00,
-    0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x18, 0x34, 0x40, 0x00, 0x00, 0x3D, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0,
-    0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F,
-    0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD,
-    0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0xE0, 0x00, 0x03, 0xC0, 0x1C, 0x00,
-    0x0F, 0xD6, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87, 0xFC, 0x02, 0xFC, 0x0B,
-    0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x3F, 0xC0,
-    0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F, 0xFF, 0x0F, 0xF8, 0x1F,
-    0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xDF,
-    0x00, 0x00, 0x00, 0x01, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xB0, 0x40,
-    0x00, 0x00, 0x3D, 0x07, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F,
-    0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F,
-    0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0x53, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x02, 0xC5, 0x1C, 0x00, 0x0F, 0x92, 0xE0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xE7, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x87,
-    0xFC, 0x02, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0x0B, 0xF0,
-    0x0F, 0xD0, 0x3F, 0xC0, 0x3F, 0x02, 0xFE, 0x00, 0xFD, 0x2E, 0xF8, 0x83, 0xFE, 0xF7, 0xFF, 0x4F,
-    0xFF, 0x0F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x1C, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x3C, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xAF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x40,
-    0x40, 0x00, 0x3F, 0xC7, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x07, 0x00, 0x03, 0xE4, 0xB8, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x06, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0F, 0xE1,
-    0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x3F, 0x00, 0xFE, 0x02, 0xFC,
-    0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE, 0x20, 0xFF, 0xBD, 0xFF, 0xD3,
-    0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40,
-    0x00, 0x00, 0x2E, 0x01, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x3E, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x7F,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x02,
-    0xF8, 0x00, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x2F, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0xFE,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x02, 0xF9, 0xBC, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xF9, 0xF8, 0x01,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xE1, 0xFF, 0x00, 0xBF, 0x02, 0xF8, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0,
-    0x3F, 0x00, 0xFE, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xF0, 0x0F, 0xC0, 0xBF, 0x80, 0x3F, 0x4B, 0xBE,
-    0x20, 0xFF, 0xBD, 0xFF, 0xD3, 0xFF, 0xC3, 0xFE, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5,
-    0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F,
-    0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8, 0x00,
-    0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F, 0xBF,
-    0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07,
-    0xDF, 0xC0, 0x00, 0x01, 0xD1, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07,
-    0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF,
-    0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x2D, 0x2E, 0x00, 0x08, 0x3D,
-    0x00, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F, 0x0B,
-    0xE0, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB, 0xF4,
-    0x2F, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x3F,
-    0xC7, 0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF0, 0x07, 0xC0, 0x03, 0xFC, 0x01, 0xF0, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x55,
-    0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x03, 0xF8,
-    0x00, 0xF4, 0x01, 0xFE, 0x55, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x05, 0x01, 0x00, 0x0F, 0xF1, 0xD0, 0x0F, 0xFF, 0xF0, 0x03, 0xC3, 0xF8, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40,
-    0xFC, 0x0F, 0xC0, 0x7E, 0x07, 0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01,
-    0xFD, 0x00, 0x40, 0x3F, 0x00, 0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0xFB, 0xE0,
-    0x00, 0x00, 0x1F, 0x87, 0xC0, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0xC0,
-    0x1F, 0x00, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x0F, 0xF0, 0x02, 0xD0, 0x00, 0x3F, 0x80, 0x0F,
-    0x40, 0x01, 0xFE, 0x55, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x42, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0xBD, 0x3D, 0x00, 0x01, 0xF4, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x1F, 0x81, 0xF8, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x10, 0x00, 0x3F, 0x00, 0xB4, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x0F, 0xE1, 0x00, 0x00, 0x0F,
-    0xBE, 0x00, 0x00, 0x1F, 0x87, 0xC0, 0x00, 0x06, 0x40, 0x50, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0x00,
-    0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x90, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0xBD, 0x3D, 0x00, 0x7D, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0x0F, 0xD0, 0x3F, 0x03, 0xF0, 0x1F, 0x81, 0xF8, 0x0B, 0xC2,
-    0xF8, 0x03, 0xFB, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x10, 0x0F, 0xC0, 0x2D, 0x03, 0xFE,
-    0xBF, 0x40, 0xBF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x01, 0xE0, 0xBC, 0x00,
-    0x00, 0x0F, 0xE3, 0x80, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x1F, 0x87, 0xC0, 0x00, 0x00, 0x64,
-    0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0B, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0x74, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x0F, 0xE5, 0x54, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00,
-    0x0F, 0xF0, 0x02, 0xD0, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x01, 0xFE, 0x55, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x09, 0x2D, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x43, 0xC0,
-    0x00, 0x0B, 0xF2, 0x80, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBD, 0x3D, 0x00, 0x01, 0xF4, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x03, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x2F, 0x0B, 0xE0, 0x00,
-    0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x10, 0x00, 0x3F, 0x00, 0xB4, 0x00,
-    0x3F, 0xEB, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x09, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x06, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0x87, 0xC0, 0x00, 0x06,
-    0x40, 0x50, 0x00, 0x55, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0x00, 0x7C, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xE0, 0x07, 0x40, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xE5, 0x54,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0xFF, 0x00, 0x2D, 0x00, 0x3F, 0x80,
-    0x0F, 0x40, 0x1F, 0xE5, 0x5F, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0x02, 0x00, 0x0F, 0xF6, 0xD0, 0x07, 0x9F, 0xF0, 0x00, 0x80, 0xB4, 0x00, 0x00, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xF4, 0xF8, 0x01, 0xF4, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0xFC, 0x3F, 0x40, 0xFC, 0x0F, 0xC0,
-    0x7E, 0x07, 0xE0, 0x2F, 0x0B, 0xE0, 0x0F, 0xEF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x40,
-    0x3F, 0x00, 0xB4, 0x0F, 0xFA, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01,
-    0xFB, 0xF0, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x00, 0xB4, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xF0,
-    0x00, 0xFF, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0x95, 0x50, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x40, 0x03, 0xFC, 0x00, 0xB4, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F,
-    0x95, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x2F,
-    0x7D, 0x00, 0xBC, 0x2F, 0x00, 0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0xF8,
-    0x00, 0xFF, 0xFC, 0x03, 0xF0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x81, 0xF8, 0x2F, 0x0B, 0xE0, 0x3F,
-    0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x7F, 0x40, 0x10, 0x3F, 0x00, 0xB4, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0x7E, 0x00,
-    0x2C, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x01, 0x00, 0x00, 0x55,
-    0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF,
-    0x40, 0xBF, 0xFF, 0x40, 0x00, 0x6F, 0x80, 0x1F, 0xFE, 0x02, 0xD3, 0xE0, 0x08, 0x3C, 0x00, 0x1F,
-    0x40, 0x07, 0x80, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
-    0x3F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x2F, 0x88, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xFF,
-    0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x1F,
-    0xC0, 0x0B, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x88, 0x0F, 0xFF, 0x43, 0xFF,
-    0xC0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F,
-    0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0,
-    0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1, 0xFE, 0x0F, 0xE0, 0x3F, 0xC7, 0xF0, 0x0B,
-    0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0x5F, 0xD0, 0x1F, 0xC3, 0xF4, 0x0F,
-    0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x0B, 0x0B, 0x80,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00,
-    0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F,
-    0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F,
-    0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0xB4, 0xB8, 0x00, 0x08, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xE1, 0xFE, 0x0F,
-    0xE0, 0x3F, 0xC7, 0xF0, 0x0B, 0xF3, 0xF8, 0x02, 0xFC, 0xFD, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0x5F,
-    0xD0, 0x1F, 0xC3, 0xF4, 0x0F, 0xD0, 0xFF, 0x5F, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x01, 0xE1, 0xF0, 0x00, 0x00, 0x1F, 0xE2, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00,
-    0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x64, 0x09, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xD0, 0x7F, 0xF0, 0x07, 0xFC, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x00, 0x0B, 0xF8, 0x3F,
-    0xC0, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x03, 0xFF, 0xAF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x04, 0x24, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0x4F, 0x80, 0x00, 0x1F, 0x41, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x7F, 0x87, 0xF8, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x03, 0xF4, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x0F, 0xD0, 0x3F,
-    0x40, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x78, 0xB4, 0x00, 0x00, 0x1F, 0xE1, 0x00, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x01,
-    0xF4, 0xBC, 0x00, 0x00, 0x19, 0x02, 0x40, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40,
-    0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3,
-    0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x01, 0x0A, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0x4F, 0x80, 0x07, 0xD0, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xF8,
-    0x7F, 0x80, 0xFE, 0x03, 0xFC, 0x1F, 0xC0, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x40, 0x3F, 0x83,
-    0xF4, 0x03, 0xF4, 0x7F, 0x40, 0x7F, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0xD7, 0xFC, 0x01, 0xFF, 0xFE,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBA, 0xE0, 0x00, 0x00, 0x01, 0x87, 0x80, 0x00, 0x01, 0xE0, 0xB8, 0x00, 0x00, 0x1F, 0xE3, 0x40,
-    0x00, 0x01, 0xFB, 0xD0, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x64, 0x09, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xD0, 0x7F,
-    0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x02, 0xFE, 0x0B,
-    0xF4, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x00,
-    0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xAF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x09, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x04, 0x3D, 0x00, 0x00, 0x1F, 0xCA, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0x4F, 0x80, 0x00,
-    0x1F, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0x87, 0xF8, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xC0, 0x2F,
-    0xC0, 0x0F, 0xE0, 0x0B, 0xF0, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x7F, 0x40,
-    0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0C, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0xA1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x02, 0xF4, 0xBC, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC,
-    0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x2F, 0xE2, 0xFD, 0x00, 0x02, 0xFE,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xD3, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x1F, 0xF0, 0x2F, 0xF0, 0x07, 0xFD, 0x00,
-    0xFF, 0xEB, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x80, 0x00, 0xFF, 0x9D, 0x00, 0x1E, 0x7F, 0xD0, 0x00, 0x80, 0xB4,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x7D,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00,
-    0x7F, 0x87, 0xF8, 0x0F, 0xE0, 0x3F, 0xC1, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF4, 0x03,
-    0xF8, 0x3F, 0x40, 0x3F, 0x47, 0xF4, 0x07, 0xF0, 0x3F, 0x40, 0xFD, 0x03, 0xFD, 0x7F, 0xC0, 0x1F,
-    0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x02, 0xF4, 0x3D,
-    0x00, 0x00, 0x3D, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFD,
-    0x0F, 0xF4, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x02, 0xFE, 0x2F, 0xD0, 0x00, 0x2F, 0xE3, 0xFC, 0x00,
-    0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x0F, 0xFE, 0xBF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xF0,
-    0x00, 0x2F, 0x7D, 0x00, 0x1F, 0x07, 0xC0, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x87, 0xF8, 0x3F, 0x80, 0xFF, 0x1F, 0xC0, 0x2F,
-    0xCF, 0xE0, 0x0B, 0xF3, 0xF4, 0x03, 0xF8, 0xFD, 0x00, 0xFD, 0x7F, 0x40, 0x7F, 0x0F, 0xD0, 0x3F,
-    0x43, 0xFD, 0x7F, 0xC0, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x06, 0x00, 0x00, 0x09, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xAA, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00,
-    0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x80, 0x78, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0xF0, 0x01,
-    0xFF, 0xFF, 0xC0, 0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F,
-    0x80, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x40, 0x7F, 0x00, 0x3F,
-    0x40, 0xFD, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x06, 0x00, 0x00, 0x00,
-    0x60, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xAA, 0x42, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFE, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFD, 0x00, 0x02,
-    0xFE, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x01, 0xFF,
-    0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xD0, 0x78, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0xF0,
-    0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0,
-    0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x40, 0x7F, 0x00,
-    0x3F, 0x40, 0xFD, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xDF, 0x80, 0x00, 0x00, 0x02, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x01, 0x80, 0x00, 0x01, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x10, 0x00, 0xFD, 0x00, 0x00,
-    0x6A, 0x90, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xBE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFD,
-    0x07, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFA, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x08,
-    0x3D, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x78, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xF8,
-    0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x40,
-    0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x40, 0x7F, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x3F, 0xD7,
-    0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xCB, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0x0F, 0xD0, 0x18, 0x00, 0x00, 0x00, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x06,
-    0xA9, 0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0xFB, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xD0,
-    0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x0B, 0xF4, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x0B,
-    0xF8, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0xAF, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x3F, 0xC7, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xB0,
-    0xFE, 0x00, 0x00, 0x00, 0x10, 0x78, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC, 0x00, 0x2F,
-    0xFE, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0, 0x1F, 0xC0,
-    0x2F, 0xC0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x40,
-    0x7F, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xAA, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x1F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40,
-    0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0B,
-    0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xEB, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0x40, 0xFC,
-    0x00, 0x2F, 0xFE, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xF8, 0x7F, 0x80, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40,
-    0x7F, 0x40, 0x7F, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55,
-    0x52, 0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x3F, 0x40,
-    0x2F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF8,
-    0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7, 0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00,
-    0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F, 0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xB0, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x15,
-    0x55, 0x01, 0x55, 0x52, 0xFF, 0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xD0, 0x2F, 0xF9, 0x03, 0xFC, 0x00,
-    0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x0B, 0xE0, 0x07, 0xF4,
-    0x00, 0x3F, 0x40, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x3F,
-    0x80, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x01, 0x43, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC7,
-    0xFF, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x7F, 0x00, 0xBE,
-    0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0xBF, 0x00, 0x7F, 0x07, 0xFC, 0x02, 0xF8, 0x7F,
-    0xF1, 0x8F, 0xFB, 0xCF, 0xFF, 0x3F, 0xFC, 0x3F, 0xF0, 0x7F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x40, 0x00, 0x0A, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x50, 0x15, 0x5B, 0xF8, 0xBF, 0xFF, 0x03,
-    0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x2F, 0xF9, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00,
-    0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x07, 0xF4,
-    0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x7F, 0xE0, 0x7F, 0xF8, 0x0F,
-    0xE0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0B,
-    0xE0, 0x3F, 0x80, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x01, 0xFC, 0x1F, 0xF0,
-    0x00, 0x2F, 0x87, 0xFF, 0x18, 0x03, 0xFE, 0xF3, 0xFF, 0xC0, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x01, 0x40, 0x00, 0x00, 0x60, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55,
-    0x50, 0x15, 0x5B, 0xF8, 0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x2F, 0xF9, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x02,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0x80, 0x02, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x04, 0x00, 0x02, 0xFC, 0x2F, 0xF4, 0x07, 0xFE, 0x07,
-    0xFF, 0x80, 0xFE, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x1F,
-    0xC0, 0x00, 0xBE, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xF0, 0x00, 0x1F,
-    0xC1, 0xFF, 0x00, 0x02, 0xF8, 0x7F, 0xF1, 0x80, 0x3F, 0xEF, 0x3F, 0xFC, 0x03, 0xFF, 0xC3, 0xFF,
-    0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x14, 0x00, 0x00, 0x74, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x15, 0x55, 0x01, 0x55, 0xBF, 0x8B, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xD0, 0x7F, 0xFD, 0x02, 0xFF, 0x90, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x40, 0x03,
-    0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x50, 0xF0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x7F, 0xE0, 0x7F, 0xF8, 0x0F, 0xE0,
-    0x00, 0x3F, 0x40, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE0,
-    0x3F, 0x80, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x01, 0xFC, 0x1F, 0xF0, 0x00,
-    0x2F, 0x87, 0xFF, 0x18, 0x03, 0xFE, 0xF3, 0xFF, 0xC0, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xCB,
-    0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xB0, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x15, 0x55, 0x01, 0x55, 0xBF, 0x8B, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xD0, 0x7F, 0xFD, 0x02, 0xFF, 0x90, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x7F,
-    0x40, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x40, 0x00, 0x01, 0xFE, 0x2D, 0x00, 0x00, 0x3E, 0xFF, 0xC0, 0x00, 0x03,
-    0x87, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x2F,
-    0xC2, 0xFF, 0x40, 0x7F, 0xE0, 0x7F, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0xFD, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0xBF, 0x00, 0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0x87, 0xFF, 0x18, 0x03, 0xFE, 0xF3,
-    0xFF, 0xC0, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC1, 0x55, 0x50, 0x15, 0x5B, 0xF8, 0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x2F, 0xF9,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x40,
-    0x00, 0x2F, 0xC2, 0xFF, 0x40, 0x7F, 0xE0, 0x7F, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0xFD, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0xBF, 0x00, 0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0x87, 0xFF, 0x18, 0x03,
-    0xFE, 0xF3, 0xFF, 0xC0, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x50, 0x15, 0x54, 0x7F, 0xFF, 0x0F, 0xFF,
-    0xC3, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xBE, 0x00, 0x03, 0xF4,
-    0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF0, 0x00, 0x01, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xD0, 0x7F, 0x40,
-    0x2F, 0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0x3F,
-    0x40, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0xFC,
-    0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55,
-    0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xF0,
-    0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0, 0x00,
-    0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F,
-    0xD0, 0x0B, 0xFF, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD,
-    0x0F, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00,
-    0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x2F,
-    0x1F, 0xFF, 0xC0, 0x1F, 0xC7, 0xFF, 0x80, 0x0B, 0xF0, 0xBE, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x15, 0x55, 0x01, 0x55, 0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF,
-    0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0x00,
-    0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00,
-    0x00, 0x42, 0xE0, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x0B, 0xFF, 0x03,
-    0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x2F,
-    0x83, 0xF0, 0x00, 0x07, 0xE1, 0xF4, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0x0F, 0xEF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x38, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x40, 0x00, 0x00, 0xBF,
-    0x4F, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x01, 0x55, 0x47, 0xFF, 0xF0, 0xFF, 0xFC, 0x3F, 0xF8, 0x07,
-    0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x03,
-    0xFC, 0x3F, 0x00, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x3F, 0xC3, 0x80, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x07, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F, 0xE0,
-    0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x1F,
-    0x40, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0x81, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00,
-    0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00,
-    0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0,
-    0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34, 0x03, 0x0A, 0x03,
-    0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x01, 0xBF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xBF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0x15, 0x55,
-    0x55, 0x4F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xF4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x54, 0x05, 0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0,
-    0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2,
-    0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B,
-    0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F,
-    0x6A, 0x06, 0x80, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0x00, 0x40, 0x7C, 0x0F, 0x83, 0xF0,
-    0x7E, 0x0B, 0xD0, 0xFE, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0x40, 0xBF, 0x07, 0xF0, 0x7F, 0x0B, 0xD0,
-    0xFC, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0xFC, 0x0F, 0xC2, 0xF4, 0x3E,
-    0x0B, 0xC0, 0x10, 0x00, 0x04, 0x03, 0xF4, 0xBF, 0x0B, 0xE0, 0x7F, 0x02, 0xF0, 0x0F, 0x80, 0x7C,
-    0x01, 0x80, 0x00, 0x40, 0x10, 0x1F, 0x03, 0xD0, 0xF8, 0x3F, 0x0F, 0xC2, 0xF0, 0x7E, 0x0F, 0xC2,
-    0xF4, 0x7E, 0x0F, 0xE2, 0xFC, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0xFC, 0x07, 0xF0, 0xFC, 0x03, 0xF0, 0xFC, 0x07, 0xD0, 0xF8, 0x0F, 0xC2, 0xF0, 0x1F, 0x43, 0xE0,
-    0x3D, 0x0F, 0x80, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0xFD, 0x3F, 0x43, 0xF0,
-    0xFC, 0x0F, 0xC3, 0xF0, 0xBD, 0x2F, 0x43, 0xE0, 0xF8, 0x2F, 0x0B, 0xC0, 0x10, 0x04, 0x00, 0x04,
-    0x01, 0x00, 0xFD, 0x3F, 0x4B, 0xF2, 0xFC, 0x2F, 0x8B, 0xE0, 0x7F, 0x1F, 0xC0, 0xBC, 0x2F, 0x00,
-    0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x01, 0x80, 0x60, 0x00, 0x19, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x00, 0x00, 0x7C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x3C, 0x04, 0x00, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x10, 0x3D,
-    0x04, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x29, 0x7D,
-    0x69, 0x0F, 0xFF, 0xFF, 0x47, 0xEB, 0xEB, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x4F, 0xFD, 0x3F,
-    0xF0, 0x7F, 0x40, 0x00, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x19, 0x1F, 0xEB, 0xFD, 0xFE, 0x04,
-    0x00, 0x19, 0x00, 0x51, 0xFC, 0x0F, 0xDF, 0xF0, 0xBF, 0x6F, 0x82, 0xFC, 0x10, 0x01, 0x40, 0x19,
-    0x00, 0x05, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xD0, 0x0F, 0xEF, 0xF0, 0x0B, 0xF4, 0x03, 0xFB, 0xF8,
-    0x01, 0xFC, 0x00, 0xFC, 0x10, 0x00, 0x14, 0x00, 0x04, 0x00, 0x2F, 0x5F, 0xFB, 0xFC, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1,
-    0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02,
-    0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00,
-    0x00, 0x01, 0x04, 0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01,
-    0xC7, 0x0C, 0x1C, 0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA,
-    0xB0, 0xD3, 0x40, 0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00,
-    0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-    0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xBF,
-    0x40, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xF8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x1F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x47, 0xE0, 0xF4, 0x2F, 0xE0, 0x00, 0xBF, 0x47, 0xFB, 0xF0, 0xF8, 0x3F, 0xFE, 0x01, 0xFF, 0xF4,
-    0x7F, 0xE0, 0xBC, 0x3F, 0x0F, 0xC1, 0xF8, 0x7F, 0x00, 0x00, 0x7C, 0x1F, 0x42, 0xF4, 0xFC, 0x0F,
-    0xC0, 0x00, 0x3D, 0x0F, 0xC0, 0xBC, 0x3E, 0x03, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x3F, 0x1F, 0x40,
-    0xF8, 0x00, 0x2F, 0x00, 0xF8, 0x0F, 0x8B, 0xD0, 0xBD, 0x00, 0x1F, 0x40, 0x3F, 0x0B, 0xD1, 0xF4,
-    0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xEB, 0xE0, 0x7F, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0xE0, 0x0B,
-    0xFF, 0x00, 0x02, 0xD0, 0x00, 0x06, 0x40, 0x00, 0x15, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0xBE, 0x0F, 0xC2, 0xF8, 0x3F, 0x03, 0xC0, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x7F, 0x1F, 0x82, 0xF8, 0xFD, 0x0F, 0xC7, 0xF0, 0xBE,
-    0x2F, 0x43, 0xF0, 0xFC, 0x0F, 0x07, 0xC0, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x1E, 0x03, 0xC0, 0x7F, 0x0F, 0xD1, 0xF8, 0x2F, 0x87, 0xF0, 0xFD, 0x0F, 0xC2, 0xF8, 0x7F, 0x0B,
-    0xE0, 0xFC, 0x2F, 0x43, 0xF0, 0xBD, 0x0F, 0xC0, 0xF0, 0x2E, 0x07, 0xC0, 0x14, 0x02, 0x00, 0x50,
-    0x00, 0x00, 0x02, 0xD0, 0x7E, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x2D, 0x07, 0x80, 0x7E, 0x0F, 0xC0, 0x3F, 0x0B, 0xE0, 0x2F, 0x87, 0xF0, 0x0F, 0xC2,
-    0xF4, 0x0B, 0xD0, 0xFC, 0x03, 0xE0, 0x7C, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41,
-    0xE0, 0x3C, 0x07, 0xE0, 0xFC, 0x2F, 0x80, 0xFC, 0x2F, 0x87, 0xF0, 0x2F, 0x87, 0xF0, 0xFD, 0x03,
-    0xF0, 0xBD, 0x1F, 0xC0, 0xBD, 0x0F, 0xC2, 0xF4, 0x0F, 0x81, 0xF0, 0x3D, 0x00, 0x80, 0x14, 0x01,
-    0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xE3, 0xE0, 0x7E, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xD0, 0x0F, 0xE0, 0x03,
-    0xFC, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0x01, 0xFD, 0x07, 0xF4, 0x1F, 0xC0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x2C, 0x7C, 0x07, 0xC0, 0x7C, 0x2F, 0x0B, 0xD1,
-    0xF0, 0x0B, 0xC3, 0x87, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x08, 0x3E, 0xF4,
-    0x50, 0x3F, 0x0F, 0xD1, 0xF8, 0x3F, 0x0F, 0xD1, 0xF8, 0x04, 0x3E, 0xF4, 0x50, 0x00, 0xF8, 0x3D,
-    0x00, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xC7, 0x87, 0xC0, 0x2F, 0x0B, 0xD1, 0xF0, 0x7C, 0x07, 0xC0,
-    0x7C, 0x70, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x01, 0xA0, 0x07, 0xF0, 0x2F,
-    0xC0, 0x3F, 0x80, 0xFE, 0x01, 0xFD, 0x07, 0xF0, 0x07, 0xF0, 0x2F, 0xC0, 0x2F, 0x80, 0xFE, 0x00,
-    0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x7E, 0x00, 0x3E, 0x01, 0xF4, 0x01, 0xF4,
-    0x07, 0xC0, 0x07, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x7F, 0x01, 0xF8, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xD0, 0x3F, 0x40,
-    0x04, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA4, 0xBF, 0xDF,
-    0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xFC, 0x0F, 0xFF, 0x8B, 0xFF, 0xE0, 0xFF, 0xFC, 0x74,
-    0x3F, 0x0E, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x3E, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x10, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x00,
-    0x1F, 0x80, 0x01, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x1F, 0xF0, 0x01, 0xFC, 0x7F,
-    0xFC, 0x03, 0xF8, 0xBF, 0xFE, 0x03, 0xF4, 0x74, 0x3F, 0x07, 0xF0, 0x00, 0x3F, 0x0B, 0xE0, 0x00,
-    0x3D, 0x0F, 0xD0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x3E,
-    0x00, 0x1F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0xFF, 0xC0, 0x1F, 0x00, 0x7F, 0x80, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0xFD,
-    0x00, 0xBD, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xFD, 0x00,
-    0x3F, 0x83, 0xFF, 0xD0, 0x1F, 0xD0, 0xFF, 0xFC, 0x07, 0xF0, 0x34, 0x3F, 0x02, 0xF8, 0x00, 0x0B,
-    0xC0, 0xFD, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x03,
-    0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x7F, 0xE0, 0x0B, 0x40,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x2F,
-    0xC0, 0x2F, 0xC0, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24, 0x00, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xE0, 0x3C, 0x0B, 0x80, 0x7F,
-    0x0F, 0xD1, 0xF8, 0x3F, 0x02, 0xF8, 0x7F, 0x0F, 0xD1, 0xFC, 0x0F, 0xC2, 0xF8, 0x7F, 0x0F, 0xD0,
-    0xBE, 0x0F, 0xC2, 0xF4, 0x3F, 0x03, 0xF0, 0xBD, 0x0F, 0xC2, 0xF4, 0x0F, 0x02, 0xE0, 0x7C, 0x0F,
-    0x80, 0x14, 0x02, 0x00, 0x50, 0x08, 0x00, 0x00, 0x19, 0x00, 0x07, 0xFF, 0x80, 0x7E, 0x7F, 0x03,
-    0xF0, 0xBD, 0x2F, 0x41, 0xF4, 0xFC, 0x07, 0xD3, 0xE0, 0x2F, 0x1F, 0x80, 0xFC, 0x7E, 0x07, 0xD0,
-    0xFC, 0x3F, 0x02, 0xFF, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0xF7, 0xD0, 0x0F, 0x4F, 0x00, 0xF4, 0x7C, 0x0F, 0xD7, 0xF4, 0x7F, 0xFF,
-    0xF0, 0x55, 0xBE, 0x40, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x15, 0x50, 0x03, 0xFF, 0xD0, 0x1F,
-    0xAA, 0x00, 0xB8, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x01, 0xFD, 0x03, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80,
-    0x0B, 0xFF, 0x03, 0xF9, 0x00, 0xFC, 0x00, 0x2F, 0x90, 0x07, 0xFF, 0xE0, 0xBD, 0x6F, 0x4F, 0x80,
-    0xF8, 0xF8, 0x0F, 0x8B, 0xC1, 0xF4, 0x7F, 0xFE, 0x00, 0xBF, 0x40, 0x15, 0x55, 0x0F, 0xFF, 0xFB,
-    0xEB, 0xFB, 0xC0, 0xFC, 0x50, 0xBC, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F,
-    0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x07, 0xFF, 0x80, 0x3E,
-    0x2F, 0x02, 0xF0, 0x7C, 0x07, 0xD3, 0xE0, 0x0B, 0xFD, 0x00, 0x7F, 0xF4, 0x07, 0xC3, 0xF0, 0x3E,
-    0x07, 0xD0, 0xF8, 0x2F, 0x02, 0xFF, 0xF4, 0x02, 0xFE, 0x00, 0x00, 0x19, 0x00, 0x0B, 0xFF, 0x00,
-    0xBD, 0x7F, 0x03, 0xE0, 0x7C, 0x0F, 0x41, 0xF0, 0x3E, 0x0B, 0xC0, 0xBF, 0xFF, 0x00, 0xBF, 0xF4,
-    0x00, 0x1F, 0x80, 0x02, 0xFC, 0x07, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x05, 0x01, 0x40, 0xFD, 0xBF,
-    0x00, 0xFB, 0xBC, 0x03, 0xF1, 0xF0, 0x0F, 0x8B, 0x80, 0x7C, 0x3D, 0x02, 0xE0, 0xF6, 0x0F, 0x47,
-    0xFC, 0x3C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xC0, 0xBD, 0x3F, 0x47,
-    0xE0, 0x7D, 0x2F, 0x01, 0xF4, 0xFC, 0x0B, 0xD3, 0xE0, 0x3F, 0x1F, 0x80, 0xF8, 0x3E, 0x0B, 0xC0,
-    0xFE, 0xBE, 0x01, 0xFF, 0xD0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xFC, 0x0A, 0xFC,
-    0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x1B, 0xF4, 0x7F, 0xFC,
-    0x15, 0x50, 0x00, 0xBF, 0x80, 0x0F, 0xFF, 0xC0, 0xFC, 0x2F, 0x02, 0xC0, 0xBC, 0x00, 0x07, 0xE0,
-    0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xFC,
-    0x00, 0x55, 0x00, 0x01, 0xFE, 0x03, 0xFF, 0xE0, 0xF0, 0xFC, 0x10, 0x3E, 0x00, 0x7F, 0x01, 0xFF,
-    0x40, 0x6B, 0xF0, 0x00, 0x7C, 0x00, 0x3F, 0x15, 0xBF, 0x4F, 0xFF, 0x41, 0xA4, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xF3, 0xC0, 0x1F, 0x1F, 0x01, 0xF0,
-    0xBC, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x01, 0x40, 0x00,
-    0xAA, 0xA4, 0x03, 0xFF, 0xC0, 0x2F, 0x55, 0x00, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x06, 0xFE, 0x00,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x57, 0xFC, 0x03, 0xFF, 0x80, 0x06, 0x90, 0x00,
-    0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x0B, 0xF4, 0x01, 0xF8, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xF0, 0xBC,
-    0x1F, 0x8F, 0x80, 0xF8, 0xFC, 0x0F, 0x4B, 0xD7, 0xF0, 0x3F, 0xFC, 0x00, 0x69, 0x00, 0x2A, 0xAA,
-    0x5F, 0xFF, 0xFB, 0x82, 0xF6, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x00, 0x90, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xEF, 0xC0, 0x7C,
-    0x1F, 0x02, 0xF0, 0xBC, 0x03, 0xFB, 0xC0, 0x0B, 0xFC, 0x00, 0xF9, 0xFC, 0x0B, 0xC2, 0xF4, 0x3E,
-    0x07, 0xD0, 0xFD, 0x7F, 0x01, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0x80,
-    0xFC, 0x2F, 0x03, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x3F, 0x5B, 0xC0, 0x7F, 0xFE, 0x00, 0x17, 0xF0,
-    0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x07, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD5, 0x7D, 0x00, 0x0F, 0xE0, 0x0F,
-    0x00, 0x03, 0xF4, 0x03, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x07, 0xF9, 0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0xFF,
-    0xA4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x02, 0xF8,
-    0x07, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x06, 0xBF, 0x5A, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x5F,
-    0xE5, 0x50, 0x00, 0x57, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x06, 0xFE, 0xA9, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xFA, 0xAB, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x1F, 0xE1, 0xBF, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x09, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xE0, 0xBC,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x07, 0xF4, 0x3F, 0x50, 0x02, 0xA0, 0x00, 0xFF, 0x03, 0xFC, 0xFF,
-    0xFE, 0x0B, 0xFF, 0x00, 0x3F, 0xDB, 0xFC, 0x2F, 0xFA, 0x07, 0xD6, 0xC0, 0x0F, 0xFF, 0xF8, 0x03,
-    0xF4, 0x02, 0xF0, 0x00, 0x07, 0xFF, 0x90, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x00,
-    0x0B, 0xE0, 0x44, 0x0B, 0xE0, 0x1F, 0xE0, 0x00, 0x03, 0xF9, 0xF3, 0xC1, 0xF4, 0x3F, 0xFF, 0x40,
-    0x00, 0xFF, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0xBC, 0x00, 0x1F, 0xE0, 0x0B, 0x80, 0x03, 0xF8, 0x00,
-    0xA0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x05, 0x00, 0x0B, 0xFF, 0xAB, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xAA, 0xAA, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xBF, 0xFD, 0x0B,
-    0xCF, 0xCF, 0x80, 0xD3, 0xF1, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xD3, 0xF2, 0xC0, 0xFC, 0xFD,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x3E,
-    0x00, 0x03, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFA, 0xAA, 0xAF, 0xE0,
-    0x2F, 0x40, 0x07, 0xE0, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x74, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0xF4, 0x07, 0xFF, 0xF4, 0x7E, 0xFE, 0xF4, 0xF3,
-    0xF3, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0x4F, 0xC5, 0x1F,
-    0x3F, 0x3D, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC,
-    0x07, 0xCF, 0xCF, 0x40, 0x53, 0xF1, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x4F, 0xC5,
-    0x01, 0xF3, 0xF3, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x38,
-    0x3E, 0x02, 0xF8, 0xF8, 0x2F, 0x83, 0xE2, 0xF4, 0x0F, 0xAF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE,
-    0xAA, 0x90, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x0B, 0x00, 0xBC, 0xBE, 0x02, 0xF0, 0xBE, 0x0B, 0xC0, 0x7E, 0x2F, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFD, 0xAA, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x1C, 0x00, 0xBD, 0x01, 0xFC,
-    0x01, 0xF4, 0x1F, 0xC0, 0x07, 0xC1, 0xF8, 0x00, 0x1F, 0x0F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xF0, 0xBE, 0xAA, 0xAA, 0x80, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xAF, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA,
-    0xAA, 0xA0, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0x45, 0x55, 0x60, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x3F, 0xE2, 0xFF, 0x03, 0xF7, 0x8B, 0x7F, 0x07, 0x1E,
-    0x2D, 0x34, 0x00, 0x78, 0xB4, 0x00, 0x01, 0xE2, 0xD0, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x2E, 0x2E,
-    0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x2E, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0xAA, 0xAB, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x02, 0xAA, 0xAA,
-    0xAB, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0x55,
-    0x54, 0x7E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0B, 0x8B, 0x80, 0x00,
-    0x2E, 0x2E, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x07, 0x8B, 0x40, 0x00, 0x1E,
-    0x2D, 0x00, 0x00, 0x78, 0xB4, 0x00, 0xB1, 0xE2, 0xD3, 0x83, 0xFB, 0x8B, 0xBF, 0x03, 0xFE, 0x2F,
-    0xF0, 0x02, 0xF8, 0xBE, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x0F, 0xD5, 0x5F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAB, 0xC7, 0xC0, 0x00,
-    0x00, 0xF4, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F,
-    0xC0, 0xFC, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01,
-    0x52, 0xFE, 0x00, 0x00, 0xBE, 0x1F, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0x40, 0x01, 0xFC, 0x0B, 0xF8,
-    0x00, 0x3F, 0x40, 0x3F, 0xEA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x2F, 0x40, 0x00, 0x7F, 0x83, 0xF0, 0x00, 0x03, 0xFC,
-    0x7D, 0x00, 0x00, 0x2F, 0xDB, 0xC0, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x0D, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1,
-    0xFE, 0x6F, 0xF0, 0xFD, 0x02, 0xF8, 0xBE, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0x5F, 0xC0, 0x0F, 0xC7,
-    0xF0, 0x07, 0xE1, 0xFC, 0x03, 0xF4, 0x7F, 0x02, 0xFC, 0x0F, 0xE6, 0xFC, 0x02, 0xFF, 0xFC, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xF8, 0x95, 0x56, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x02,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE2, 0xAA, 0x9B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF9, 0xFE, 0xAB, 0xFE, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x01, 0xD0, 0x03, 0xFF, 0xFF, 0x9F,
-    0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x41, 0xFD,
-    0x00, 0x0F, 0xFE, 0x0B, 0xF0, 0x00, 0xFA, 0xFC, 0x3F, 0x40, 0x0F, 0x87, 0xF0, 0xFD, 0x00, 0xF8,
-    0x0F, 0xC3, 0xF0, 0x0F, 0x80, 0x7F, 0x0F, 0xD0, 0xF8, 0x01, 0xFC, 0x3F, 0x4F, 0x80, 0x0B, 0xF0,
-    0xFE, 0xFC, 0x00, 0x3F, 0x82, 0xFF, 0xC0, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x0F, 0xFE,
-    0x57, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xC7, 0xFF, 0xFD, 0x00, 0x0C, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xAF, 0xD0, 0x00,
-    0x07, 0xD3, 0xFC, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0xE0, 0x00, 0xBC, 0x03, 0xFC,
-    0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F, 0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x07, 0xF0, 0x00,
-    0xFF, 0x42, 0xF4, 0x00, 0x1F, 0xF0, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x05, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0x40, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x1F,
-    0x80, 0x1F, 0xE0, 0x0F, 0xC0, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x1F, 0xE0,
-    0xFC, 0x00, 0x03, 0xFC, 0x7D, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x1B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFA,
-    0xAA, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x6F, 0xD4, 0x01, 0xBF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAB, 0xFE, 0x92, 0xFE, 0x00, 0xFD, 0x00, 0xFF,
-    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xFE, 0xAA, 0xAF, 0xC0, 0x7E, 0x00, 0x07, 0xF4, 0x2F, 0x40,
-    0x00, 0xFF, 0x0F, 0xC0, 0x00, 0x1F, 0xFB, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0x90, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAA, 0xAA, 0xAA, 0x9F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xE5, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x56, 0xAA, 0xA4, 0x55, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xAA, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA,
-    0xAB, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0xD2, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x40, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0xFE, 0x54, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1A, 0xFF, 0xAB, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xE0, 0x03, 0xF0,
-    0x03, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xEA, 0xBF, 0x80, 0x02, 0xF4, 0x0F, 0xE0, 0x00, 0x7E, 0x07, 0xF4,
-    0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x02, 0xFB, 0xFD, 0x2F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xAA, 0xA5,
-    0x40, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x3F, 0xFF, 0xD1, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xF4, 0x7F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xF0, 0x00, 0xBD, 0x0B, 0xF8, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x3C, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x03, 0xF8, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0xBF, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xA8, 0xBF, 0xFF, 0xFD, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x3C, 0x7C, 0x78, 0xBF, 0xBE, 0xFC, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0xBF,
-    0xBF, 0xFC, 0x3C, 0x7C, 0x78, 0x10, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x14, 0x00, 0x01, 0xA4,
-    0x01, 0xFF, 0xF0, 0x3F, 0xBF, 0xCB, 0xC0, 0xBC, 0xBC, 0x07, 0xCB, 0xC0, 0x7C, 0x7E, 0x5F, 0xC3,
-    0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xAA, 0x00, 0x3D, 0x01, 0xFF, 0xC0,
-    0x1F, 0x00, 0x7F, 0xF0, 0x0B, 0xC0, 0x00, 0xFD, 0x03, 0xE0, 0x00, 0x2F, 0x81, 0xF0, 0x00, 0x03,
-    0xF0, 0xBC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0x40, 0x00, 0x07, 0xEB, 0xC0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x42, 0xFF, 0x01, 0xF1, 0xFF, 0xF2, 0xF8, 0xFC,
-    0x3F, 0xF4, 0x3D, 0x03, 0xF4, 0x0F, 0x40, 0xFD, 0x03, 0xF0, 0xFF, 0xD0, 0xBF, 0xFC, 0xFE, 0x0F,
-    0xFC, 0x0F, 0xC0, 0x54, 0x00, 0x60, 0x01, 0x40, 0x01, 0x40, 0x1F, 0xF4, 0x1F, 0xF0, 0x3F, 0xFD,
-    0x7F, 0xFC, 0x7D, 0x3F, 0xF4, 0xBC, 0xBC, 0x0F, 0xD0, 0x3C, 0xBC, 0x0F, 0xE0, 0x3C, 0xBC, 0x2F,
-    0xF4, 0xBC, 0x7F, 0xFC, 0xBF, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x05, 0x40, 0x05, 0x40, 0x15, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x15, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2A, 0x54, 0x05, 0x3F, 0x0B, 0xDF,
-    0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F,
-    0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC,
-    0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0,
-    0xBD, 0xFC, 0x2F, 0x6A, 0x06, 0x80, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFB, 0xF0,
-    0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0xBE, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x02, 0xFC, 0x14, 0x00, 0x00, 0x05, 0x47, 0xF0, 0x00, 0x02, 0xF8,
-    0x3F, 0x40, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xFE, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x02, 0xF8, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xF4, 0x07, 0xF8, 0x3F, 0x40, 0x07, 0xF1, 0xFC, 0x00, 0x0F, 0xD7, 0xE0,
-    0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00,
-    0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F,
-    0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00, 0x0B, 0xD0, 0x14, 0x00, 0x00, 0x51,
-    0xF8, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8,
-    0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF5, 0xF8, 0x00,
-    0x0B, 0xD7, 0xE0, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0xBD, 0x7E, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x0F,
-    0xC3, 0xF8, 0x00, 0xBF, 0x0B, 0xFE, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x80,
-    0x02, 0xFC, 0x7C, 0x00, 0x0F, 0xF0, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xE1, 0xFD, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0xFF, 0x4F, 0xE0, 0x00,
-    0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40, 0x1E, 0x40, 0x00, 0x2E, 0x1F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC,
-    0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0F, 0xE1, 0xFD, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x07, 0xF0, 0xFF, 0x0B, 0xE0, 0x10, 0x00, 0x1E, 0x40, 0x00,
-    0x2E, 0x1F, 0xF0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0xFF, 0x00, 0x03, 0xFD,
-    0x7F, 0xC0, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x2F, 0xC0, 0x50, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00,
-    0x00, 0x3F, 0xF8, 0x02, 0xD3, 0xFF, 0xFE, 0xBF, 0x6F, 0x42, 0xFF, 0xF8, 0x24, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x01, 0x82, 0xFF, 0xF9, 0x1F, 0x5F,
-    0xDB, 0xFF, 0xFC, 0x78, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA,
-    0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x00,
-    0x03, 0xFE, 0x02, 0xD3, 0xFF, 0xF9, 0xF8, 0xF9, 0xBF, 0xFD, 0x3C, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x74, 0xBF, 0xFD, 0x7E, 0x3F, 0x7F, 0xFF, 0x4F, 0x01, 0xFF, 0x80, 0x40, 0x05,
-    0x00, 0x10, 0x00, 0x00, 0x10, 0xFE, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0x01, 0xAF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xA4, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xAA, 0xAB, 0xF0, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x03, 0xD0,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x6A, 0xBF, 0xA8, 0x00, 0x7C, 0x00, 0x15, 0xF9, 0x54, 0xBF,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x24, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0xBF, 0x40,
-    0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x02,
-    0xFD, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x80, 0x6F,
-    0xF4, 0x07, 0xFE, 0x01, 0xFF, 0x90, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00,
-    0x00, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40,
-    0x00, 0x7F, 0xE0, 0x1B, 0xFD, 0x00, 0x01, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0xBF,
-    0xD0, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF0,
-    0x07, 0xFE, 0x01, 0xFF, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF1, 0x55, 0x55, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x06, 0xAA, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1A, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0x90, 0x3F, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x2F, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x7E,
-    0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00, 0xBF, 0xEF, 0xD5, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0xAA, 0xA4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xF8, 0x00, 0x07, 0xE0, 0xBF, 0x00, 0x03,
-    0xF4, 0x0F, 0xE0, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x3F, 0x80,
-    0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xD0, 0x0F, 0xF1, 0x57, 0xF5, 0x6F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xBF, 0xA9, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7F, 0xFA, 0xAA, 0xA8, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x95, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x01, 0x5A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0xAA, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x3F, 0xC1, 0x55, 0x55, 0xBF, 0xD1, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x0A, 0xAA,
-    0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xDB,
-    0x9F, 0xD0, 0x01, 0xF4, 0x2E, 0x07, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0xC0, 0xB8, 0x02, 0xE0, 0x0B,
-    0x83, 0xC0, 0x0B, 0x80, 0x0F, 0x1E, 0x00, 0x2E, 0x00, 0x3D, 0x7E, 0xAA, 0xFE, 0xAA, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xD5, 0x5B, 0x95, 0x5F, 0x5F, 0x00, 0x2E, 0x00, 0x3D, 0x3C, 0x00, 0xB8,
-    0x00, 0xF0, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0xF4, 0x0B, 0x80, 0x7C, 0x01, 0xF8, 0x2E, 0x0B, 0xD0,
-    0x01, 0xFE, 0xBA, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00,
-    0x07, 0xD0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x0F,
-    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x7E, 0xAA, 0xAA, 0xAA, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xD5,
-    0x55, 0x55, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00,
-    0x0B, 0x80, 0xF4, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0xBB, 0xF0, 0x03, 0xEB, 0x83, 0xC3, 0xF0, 0x3E, 0x0F, 0x1E, 0x03, 0xF3, 0xE0, 0x3D,
-    0x78, 0x03, 0xFE, 0x00, 0xB6, 0xE0, 0x03, 0xF0, 0x02, 0xE7, 0x80, 0x3F, 0xF0, 0x0B, 0x5F, 0x03,
-    0xE3, 0xF0, 0x3D, 0x3C, 0x3E, 0x03, 0xF0, 0xF0, 0xBB, 0xE0, 0x03, 0xFB, 0x80, 0xFE, 0x00, 0x03,
-    0xFC, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xD4, 0x5F, 0xD0, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x3F, 0xC0, 0xB8, 0x00, 0x03,
-    0xEB, 0x83, 0xC0, 0x00, 0x3E, 0x0F, 0x1F, 0x00, 0x03, 0xE0, 0x3D, 0x78, 0x00, 0x3E, 0x00, 0xB6,
-    0xE0, 0x03, 0xE0, 0x02, 0xE7, 0x80, 0x3E, 0x00, 0x0B, 0x5F, 0x03, 0xE0, 0x00, 0x3D, 0x3C, 0x3E,
-    0x00, 0x00, 0xF0, 0xBB, 0xE0, 0x00, 0x0B, 0x80, 0xFE, 0x00, 0x00, 0x7C, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x01, 0xFE, 0x56, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0x47, 0xFC, 0x7F, 0xC3, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0,
-    0x0B, 0xD0, 0xFF, 0x40, 0xBF, 0x80, 0x7F, 0xC3, 0xFD, 0x02, 0xFE, 0x01, 0xFF, 0x0B, 0xE0, 0x07,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x2F,
-    0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFE,
-    0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFC,
-    0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_bolditalicBitmaps[33279] = {
+    0x39, 0xAA, 0x39, 0xE3, 0xEA, 0x29, 0xE9, 0x29, 0xE3, 0xAD, 0xA3, 0xE9, 0x3E, 0x4E, 0x4D, 0xA3,
+    0x9D, 0x93, 0x9D, 0x4A, 0xD4, 0xAC, 0x97, 0x59, 0x49, 0xE3, 0xAE, 0x3A, 0xD9, 0x49, 0x50, 0x1A,
+    0xCA, 0x09, 0xD1, 0xAD, 0x90, 0xE1, 0xE0, 0xAD, 0xA1, 0xE0, 0xAD, 0x90, 0x9D, 0xA0, 0xE1, 0x9D,
+    0x90, 0xE1, 0x9D, 0x1D, 0xA1, 0xAC, 0xA1, 0xCA, 0x74, 0x77, 0x4A, 0xD2, 0xDA, 0x6E, 0x19, 0xD9,
+    0x6D, 0xA1, 0xAD, 0x49, 0x9A, 0xDA, 0x99, 0xE9, 0x91, 0x9F, 0xFF, 0xC9, 0x09, 0xAA, 0xEA, 0xAF,
+    0xAA, 0x4D, 0xA1, 0xAD, 0x69, 0xD9, 0x1E, 0x6A, 0xD2, 0xDA, 0x39, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC,
+    0x39, 0xDA, 0x1E, 0x6A, 0xD2, 0xDA, 0x6E, 0x19, 0xD9, 0x6D, 0xA1, 0xAD, 0x77, 0x50, 0x70, 0xAC,
+    0x73, 0xCA, 0x72, 0x9C, 0x97, 0x09, 0xAD, 0xA6, 0x9F, 0xE9, 0x39, 0xEA, 0xFC, 0x3D, 0xA0, 0x9C,
+    0x9A, 0xD9, 0x19, 0xD9, 0x0A, 0xC1, 0xD2, 0x9E, 0x0D, 0x1C, 0x93, 0xFC, 0xA7, 0xAF, 0xC7, 0x0A,
+    0xFC, 0x70, 0xAF, 0xC7, 0x9F, 0xCA, 0x19, 0xD1, 0xAC, 0x0A, 0xE1, 0xE1, 0xD1, 0xE1, 0xE9, 0x0C,
+    0xA0, 0x9D, 0xA1, 0xAE, 0xAC, 0x99, 0xE3, 0xFF, 0xC9, 0x4A, 0xFC, 0xA7, 0x9C, 0xA7, 0x2A, 0xC9,
+    0x72, 0xD7, 0x3D, 0x72, 0x9A, 0x97, 0x00, 0x77, 0x74, 0x97, 0x0A, 0xC7, 0xAF, 0xA5, 0x9D, 0xA5,
+    0xEA, 0xE9, 0x4E, 0x5A, 0xD9, 0x09, 0xDA, 0x3A, 0xD6, 0xE2, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2D,
+    0xA2, 0xDA, 0x6A, 0xD9, 0x19, 0xD9, 0x1E, 0x7A, 0xD2, 0xE1, 0x9D, 0x70, 0xAD, 0x90, 0x9D, 0xA1,
+    0xD9, 0x1A, 0xEA, 0x19, 0xEA, 0xE1, 0xDA, 0x1F, 0xDA, 0x19, 0xFA, 0x1A, 0xD1, 0xE1, 0xE7, 0x09,
+    0xD1, 0x9D, 0x91, 0xAD, 0x97, 0xD9, 0x1E, 0x2A, 0xD7, 0xE2, 0xE2, 0xE6, 0xAD, 0x3D, 0xA2, 0xDA,
+    0x59, 0xD9, 0x3E, 0x1A, 0xD9, 0x5E, 0x4E, 0xAA, 0xDA, 0x5E, 0x59, 0xFC, 0xA6, 0xAC, 0x97, 0x9A,
+    0x97, 0x19, 0x77, 0x00, 0x77, 0x73, 0x9F, 0xC7, 0x5A, 0xFE, 0x73, 0x9E, 0x1E, 0x73, 0xE2, 0xAD,
+    0x73, 0xDA, 0x2D, 0xA7, 0x29, 0xDA, 0x09, 0xDA, 0x49, 0xA4, 0x9D, 0xAE, 0x93, 0x9A, 0xD4, 0x9F,
+    0xA2, 0xAF, 0xCA, 0x3A, 0xF2, 0xAF, 0xCA, 0x93, 0xFD, 0x91, 0xFC, 0x94, 0xE9, 0x0E, 0x19, 0x09,
+    0xD4, 0x9E, 0x1E, 0xA2, 0xE4, 0xAD, 0xA1, 0x9E, 0x90, 0x9D, 0x94, 0xAD, 0xA2, 0xAE, 0x9E, 0x5A,
+    0xE3, 0xFD, 0x69, 0xEA, 0x91, 0xAF, 0xA7, 0xAF, 0xFF, 0xCA, 0x95, 0x9F, 0xDA, 0x0A, 0xFE, 0x76,
+    0xAF, 0xA7, 0x76, 0x1A, 0xCA, 0x0A, 0xD9, 0x0E, 0x1E, 0x09, 0xDA, 0x09, 0xD9, 0x09, 0xD1, 0xAC,
+    0xA6, 0x70, 0x9C, 0x70, 0xE9, 0x59, 0xE6, 0x9E, 0x69, 0xE7, 0xE7, 0xAD, 0xA6, 0x9E, 0x7A, 0xD9,
+    0x7E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xAD, 0x97, 0x9E,
+    0x70, 0xE7, 0x0A, 0xDA, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xD9, 0x70, 0x9A, 0x40, 0x4A, 0x70, 0xE7,
+    0x9E, 0x7A, 0xDA, 0x7E, 0x7A, 0xDA, 0x69, 0xE7, 0xE7, 0xE9, 0x6A, 0xD9, 0x6A, 0xDA, 0x6A, 0xD9,
+    0x6A, 0xD9, 0x6E, 0x7E, 0x6A, 0xDA, 0x6E, 0x69, 0xDA, 0x6E, 0x6A, 0xD9, 0x5A, 0xDA, 0x5A, 0xE5,
+    0xAD, 0xA5, 0xEA, 0x69, 0xA7, 0x00, 0x49, 0x59, 0x09, 0xD3, 0xD0, 0xAD, 0x29, 0xFC, 0x19, 0x2A,
+    0xFD, 0x19, 0xAF, 0xD0, 0x9E, 0xAC, 0x19, 0x1D, 0x0A, 0xCA, 0x6A, 0xCA, 0x74, 0x3A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD4, 0x9A, 0xAA, 0xEA, 0xAA, 0xA0, 0xAF, 0xFD, 0x9A, 0xAA, 0xAE, 0xAA,
+    0xAA, 0x4A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x70, 0x29, 0xA9, 0x2A, 0xE2, 0x9E, 0x92,
+    0xE2, 0x9D, 0xA2, 0xE1, 0x9E, 0x2A, 0xCA, 0x72, 0xAF, 0xD9, 0xFE, 0xAF, 0xE9, 0x19, 0x91, 0xE0,
+    0xAE, 0x0A, 0xDA, 0x19, 0x91, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x72,
+    0xAD, 0x97, 0x19, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0xE7, 0x29,
+    0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x77, 0x10, 0x70, 0x99, 0x72,
+    0x9F, 0xD7, 0xFF, 0xC5, 0xFA, 0x9F, 0xA3, 0xF3, 0xF2, 0xAE, 0x4A, 0xE2, 0xE9, 0x4A, 0xE1, 0xAE,
+    0x5A, 0xE1, 0xEA, 0x5A, 0xE1, 0xE9, 0x5F, 0x09, 0xE6, 0xEA, 0x0A, 0xE5, 0x9E, 0x1A, 0xE5, 0xEA,
+    0x1A, 0xE9, 0x3A, 0xE2, 0x9E, 0xA2, 0x9E, 0x93, 0xFC, 0xAF, 0xA4, 0x9F, 0xF9, 0x69, 0xFC, 0xA7,
+    0x76, 0x70, 0x97, 0x9A, 0xE3, 0x9A, 0xFD, 0x3A, 0xFD, 0xA4, 0x99, 0xAE, 0x96, 0xAE, 0x96, 0xF7,
+    0xF6, 0x9E, 0xA6, 0xAE, 0x96, 0xF7, 0xF7, 0xF6, 0x9E, 0xA6, 0xAE, 0x96, 0xF9, 0x39, 0xFF, 0x91,
+    0xFF, 0xC9, 0x00, 0x79, 0x97, 0x19, 0xFD, 0xA5, 0xFF, 0xCA, 0x3F, 0xA9, 0x9F, 0x29, 0xE3, 0x9E,
+    0x92, 0xD9, 0x39, 0xE9, 0x39, 0x4F, 0x71, 0x9E, 0xA7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x0A,
+    0xEA, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x9E, 0xA7, 0x09, 0xFF, 0xF1, 0xFF, 0xFC, 0x1A, 0xFF, 0xE2,
+    0x79, 0x97, 0x19, 0xFD, 0x95, 0xFF, 0xC9, 0x3A, 0xEA, 0x99, 0xF3, 0xE3, 0xAE, 0x39, 0xC4, 0xAE,
+    0x71, 0x9E, 0x97, 0x0A, 0xE9, 0x69, 0xAF, 0x7A, 0xFE, 0x6A, 0xCA, 0xAF, 0xA7, 0x2F, 0x72, 0xAE,
+    0x72, 0xEA, 0x70, 0x9F, 0x39, 0x99, 0xAA, 0xFC, 0x92, 0xAF, 0xFC, 0x5F, 0xDA, 0x97, 0x74, 0x73,
+    0x97, 0x39, 0xE7, 0x19, 0xEA, 0x70, 0x9F, 0x97, 0x9F, 0xC7, 0x9F, 0xD6, 0x9D, 0xA9, 0xDA, 0x59,
+    0xDA, 0x0A, 0xD9, 0x49, 0xDA, 0x1E, 0x93, 0x9E, 0x2E, 0x39, 0xE2, 0x9E, 0x29, 0xFF, 0xFC, 0x9F,
+    0xFF, 0xD9, 0xAF, 0xFF, 0xC7, 0x9E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x93, 0x77, 0x4A, 0xFF,
+    0xC5, 0xFF, 0xCA, 0x5E, 0xAA, 0xAA, 0xAA, 0x5A, 0xDA, 0x73, 0xE9, 0x73, 0xF9, 0x71, 0x9F, 0xDA,
+    0x79, 0xFF, 0x72, 0x9F, 0x97, 0x29, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0xF7, 0x19, 0xFA, 0x49,
+    0x9A, 0xAF, 0xCA, 0x5F, 0xF9, 0x6F, 0xD9, 0x77, 0x70, 0x72, 0x99, 0x71, 0xAF, 0xC9, 0x5A, 0xFD,
+    0xA9, 0x4F, 0xCA, 0x7F, 0xA7, 0x0F, 0x97, 0x0F, 0x97, 0x09, 0xFE, 0xA5, 0xFF, 0xD9, 0x29, 0xEA,
+    0xAA, 0xFC, 0x2A, 0xE3, 0xAE, 0x2E, 0xA3, 0x9E, 0x91, 0xEA, 0x39, 0xE2, 0xEA, 0x3A, 0xE2, 0xF3,
+    0xEA, 0x29, 0xF9, 0x9F, 0x4A, 0xFF, 0x69, 0xFC, 0xA7, 0x74, 0x77, 0x0F, 0xFF, 0x19, 0xFF, 0xF1,
+    0xAF, 0xFE, 0xA1, 0xE4, 0xEA, 0x2D, 0xA3, 0xF3, 0x9A, 0x3A, 0xE7, 0x1A, 0xE7, 0x19, 0xE9, 0x71,
+    0xEA, 0x71, 0xF7, 0x1A, 0xE9, 0x70, 0x9E, 0xA7, 0x1F, 0x71, 0x9E, 0xA7, 0x1F, 0x72, 0xEA, 0x72,
+    0xE7, 0x49, 0x97, 0x20, 0x70, 0x99, 0x71, 0xAF, 0xCA, 0x6F, 0xFC, 0x4F, 0x91, 0xEA, 0x29, 0xE3,
+    0xAD, 0xA2, 0xAD, 0xA3, 0xE9, 0x2A, 0xE2, 0xAE, 0x4F, 0xAF, 0x59, 0xFD, 0xA6, 0xAF, 0xD9, 0x5F,
+    0xAF, 0x93, 0xEA, 0x2F, 0x2A, 0xDA, 0x39, 0xE9, 0x1E, 0x94, 0xE9, 0x1E, 0xA3, 0xAE, 0x2F, 0xA9,
+    0x9A, 0xE9, 0x29, 0xFF, 0xCA, 0x5F, 0xDA, 0x77, 0x30, 0x70, 0x99, 0x72, 0x9F, 0xD9, 0x6A, 0xFF,
+    0x94, 0xAE, 0xA9, 0x9F, 0x4E, 0xA2, 0x9E, 0x92, 0x9E, 0x4E, 0xA2, 0xAE, 0x4E, 0xA2, 0xAE, 0x4E,
+    0x92, 0x9E, 0xA2, 0x9E, 0x93, 0xFC, 0xAA, 0xF4, 0x9F, 0xFC, 0xA6, 0xAF, 0xE7, 0x2A, 0xE9, 0x71,
+    0xAE, 0xA7, 0x09, 0xFA, 0x7A, 0xFC, 0x95, 0xAF, 0xE7, 0xAF, 0xA9, 0x77, 0x70, 0x2A, 0xD2, 0x9E,
+    0x91, 0x9E, 0x92, 0xD9, 0x77, 0x77, 0x59, 0x93, 0xE2, 0xAE, 0x2A, 0xDA, 0x39, 0x93, 0x49, 0xD4,
+    0x9E, 0xA3, 0x9E, 0x94, 0xD9, 0x77, 0x77, 0x77, 0x09, 0xA9, 0x4A, 0xE4, 0x9E, 0x94, 0xE4, 0x9D,
+    0xA4, 0xE3, 0x9E, 0x4A, 0xCA, 0x76, 0x77, 0x39, 0xCA, 0x69, 0xF4, 0x9F, 0xA3, 0x9F, 0xA3, 0x9F,
+    0xA5, 0xAE, 0x97, 0xFC, 0x96, 0x9F, 0xC9, 0x69, 0xFC, 0x96, 0x9F, 0x70, 0x9C, 0xA7, 0x40, 0xAF,
+    0xFD, 0x9A, 0xFF, 0xD9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x59, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x73, 0x74, 0xCA, 0x70, 0x9E, 0xA7, 0xAF, 0xA7, 0xAF, 0x97, 0xAF,
+    0x97, 0xAE, 0x95, 0xAF, 0x4A, 0xF9, 0x29, 0xFC, 0x93, 0x9E, 0xA7, 0xCA, 0x77, 0x40, 0x70, 0x9F,
+    0x19, 0xFD, 0x0A, 0xFD, 0xA9, 0xC9, 0x1E, 0x4E, 0x4D, 0x93, 0xE3, 0xE2, 0x9E, 0x3D, 0xA3, 0xAD,
+    0x4F, 0xC2, 0x9E, 0xA7, 0x49, 0x49, 0xDA, 0x3E, 0xA3, 0xE9, 0x49, 0x50, 0x74, 0x99, 0x97, 0x7A,
+    0xFF, 0xA7, 0x2A, 0xFF, 0xFA, 0x69, 0xFA, 0x93, 0x9A, 0xEA, 0x49, 0xEA, 0x70, 0x9E, 0x39, 0xE7,
+    0x3A, 0xDA, 0x2E, 0x39, 0xDA, 0x0A, 0xC2, 0xE1, 0xAD, 0x92, 0xFF, 0x2E, 0x1D, 0xA2, 0xAD, 0x90,
+    0xAD, 0xA2, 0xE0, 0xAD, 0x29, 0xDA, 0x2D, 0x92, 0xE0, 0xE2, 0xE2, 0x9D, 0x3D, 0xA0, 0xDA, 0x2D,
+    0xA2, 0xDA, 0x29, 0xD9, 0x9D, 0x91, 0x9D, 0xA1, 0x9D, 0x92, 0xE0, 0x9D, 0x91, 0x9D, 0xA1, 0xE9,
+    0x1A, 0xD9, 0x09, 0xD9, 0x19, 0xEA, 0xF9, 0x0A, 0xDA, 0x19, 0xDA, 0x2F, 0xC0, 0xAF, 0xCA, 0x29,
+    0xE2, 0xAE, 0x19, 0xEA, 0x94, 0xE7, 0x73, 0xAE, 0x77, 0x3F, 0x96, 0x9A, 0xA7, 0x9F, 0xCA, 0xAA,
+    0xAF, 0xA7, 0x1F, 0xFE, 0x97, 0x49, 0xAD, 0xAA, 0xA9, 0x70, 0x73, 0x9A, 0xA7, 0x7A, 0xE7, 0x69,
+    0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7, 0x29, 0xD9, 0x09,
+    0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6, 0x9F, 0xFF, 0x6E,
+    0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE, 0x99, 0xFD, 0xA2,
+    0xAF, 0xE9, 0x49, 0xAA, 0xAC, 0xAA, 0x95, 0xAF, 0xFD, 0x39, 0xFD, 0xAF, 0xC3, 0x90, 0xAE, 0x19,
+    0xE9, 0x4E, 0xA2, 0xEA, 0x4E, 0x92, 0xE9, 0x39, 0xE9, 0x2E, 0x4A, 0xE2, 0xE9, 0x4A, 0xFF, 0x95,
+    0xFF, 0xD9, 0x4E, 0x90, 0x9A, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A, 0xE3, 0x9E, 0x92, 0xF3, 0xAE, 0x3E,
+    0xA3, 0xF2, 0x9E, 0xA1, 0x9F, 0x19, 0xFF, 0xF2, 0xAF, 0xFC, 0xA9, 0x77, 0x30, 0x79, 0xAA, 0xCA,
+    0xA7, 0x0A, 0xFF, 0xC5, 0xFF, 0xE4, 0xFA, 0x3E, 0x3F, 0x94, 0xDA, 0x2A, 0xE9, 0x5D, 0x3F, 0x73,
+    0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xFA, 0x6C, 0x92, 0xAF, 0xA3, 0x9D,
+    0xA3, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0xAF, 0xDA, 0x77, 0x50, 0x49, 0xAA, 0xAC, 0xAA, 0xA9, 0x7A,
+    0xFF, 0xE9, 0x49, 0xFF, 0xFC, 0xA4, 0x90, 0xAE, 0x2A, 0xF9, 0x5F, 0x3A, 0xF5, 0xEA, 0x4F, 0x49,
+    0xE9, 0x4A, 0xE9, 0x3A, 0xE5, 0x9E, 0xA3, 0xAE, 0x59, 0xE9, 0x3F, 0x5A, 0xE9, 0x3E, 0xA5, 0xAE,
+    0x39, 0xE9, 0x5F, 0x3A, 0xE5, 0x9E, 0x93, 0xF5, 0xF4, 0xEA, 0x39, 0xF4, 0x9F, 0x9A, 0xAF, 0xC9,
+    0x29, 0xFF, 0xFA, 0x4A, 0xFF, 0xCA, 0x97, 0x77, 0x10, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93,
+    0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E,
+    0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE,
+    0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF,
+    0xFF, 0x92, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFF, 0x3A, 0xFF, 0xE4, 0xAE, 0x3D,
+    0xA4, 0xF3, 0xD9, 0x4E, 0xA3, 0xD4, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x99, 0xAA, 0xA6, 0xFF,
+    0xC6, 0xFF, 0xA5, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0xA7, 0x09, 0xFF, 0x6A,
+    0xFE, 0xA6, 0x79, 0xAA, 0xCA, 0xA9, 0x70, 0x9F, 0xFC, 0xA5, 0xFF, 0xF4, 0xFA, 0x4D, 0xA3, 0xF9,
+    0x5D, 0x92, 0xAE, 0x96, 0xD3, 0xF7, 0x4A, 0xE9, 0x74, 0xF7, 0x5F, 0x49, 0x99, 0x99, 0x99, 0x1F,
+    0x4F, 0xE1, 0xF4, 0xAF, 0xC9, 0x1F, 0x6E, 0xA2, 0xFA, 0x5E, 0xA2, 0xAF, 0x94, 0xE9, 0x3F, 0xDA,
+    0x9A, 0xF5, 0xFF, 0xF6, 0x9F, 0xEA, 0x97, 0x75, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99,
+    0x92, 0x9F, 0xE9, 0x1F, 0xEA, 0x3A, 0xFC, 0x92, 0xAF, 0xCA, 0x5A, 0xE5, 0x9E, 0x96, 0xF5, 0xAE,
+    0x7E, 0xA5, 0xF6, 0x9E, 0x95, 0xEA, 0x6A, 0xE9, 0x49, 0xE9, 0x6A, 0xFF, 0xFC, 0x96, 0xFF, 0xFD,
+    0x7E, 0xA9, 0x99, 0x99, 0x9F, 0x69, 0xE9, 0x5E, 0xA6, 0xAE, 0x59, 0xE9, 0x6F, 0x5A, 0xE7, 0xF5,
+    0xF6, 0x9E, 0xA5, 0xF4, 0x9F, 0xE9, 0x1F, 0xE9, 0x2A, 0xFE, 0x19, 0xFE, 0x92, 0x39, 0x99, 0x99,
+    0x99, 0x92, 0x9F, 0xEA, 0x3A, 0xFC, 0xA5, 0xAE, 0x7F, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7,
+    0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA4, 0x9F, 0xE9, 0x2A, 0xFE, 0x92,
+    0x79, 0x99, 0x99, 0x99, 0x96, 0x9F, 0xEA, 0x7A, 0xFC, 0xA7, 0x19, 0xE9, 0x72, 0xAE, 0x73, 0xF7,
+    0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE,
+    0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xEA, 0x6A, 0xC1, 0xAE, 0x69, 0xFE, 0xA6,
+    0x9F, 0xDA, 0x70, 0xAE, 0xA7, 0x10, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x92, 0x9F, 0xE9,
+    0x0F, 0xDA, 0x3A, 0xFC, 0x91, 0x9F, 0xA5, 0xAE, 0x3A, 0xE7, 0xF2, 0xF7, 0x0E, 0xA1, 0xEA, 0x70,
+    0x9E, 0x90, 0xEA, 0x71, 0xAE, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xE7, 0x4F, 0xEA, 0x72, 0x9E,
+    0x9A, 0xE9, 0x71, 0xAE, 0x1F, 0x71, 0xF1, 0x9F, 0x70, 0xEA, 0x2F, 0xA6, 0x9E, 0xA3, 0xFC, 0x39,
+    0xFE, 0x29, 0xFC, 0x91, 0xAF, 0xE3, 0x9F, 0x77, 0x60, 0x39, 0x99, 0x99, 0x99, 0x69, 0xFE, 0x96,
+    0xAF, 0xC9, 0x70, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xAE, 0x72, 0xF7,
+    0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x5C, 0x92, 0xF4, 0xDA, 0x2F, 0x39, 0xD9, 0x19, 0xEA, 0x99,
+    0x99, 0xE0, 0x9F, 0xFF, 0xA0, 0xAF, 0xFF, 0x90, 0x59, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x5A,
+    0xFD, 0x5F, 0xD5, 0x9F, 0xD4, 0xAF, 0xA7, 0x9F, 0xC4, 0xFC, 0x70, 0xAF, 0xC3, 0xFD, 0x70, 0xDA,
+    0xE9, 0x19, 0xDA, 0xE7, 0x0D, 0x9E, 0x91, 0xDA, 0x9E, 0x7A, 0xD0, 0xAD, 0xA0, 0x9D, 0x0A, 0xDA,
+    0x7E, 0x0A, 0xDA, 0x0D, 0xA0, 0xAD, 0xA7, 0xDA, 0x09, 0xE9, 0xD1, 0xAD, 0xA6, 0x9D, 0x2F, 0xC9,
+    0x1E, 0xA6, 0xE2, 0xFC, 0x2E, 0xA6, 0xDA, 0x2F, 0x92, 0xE9, 0x59, 0xD9, 0x2A, 0xE3, 0xE9, 0x5A,
+    0xD3, 0x9D, 0x93, 0xE9, 0x5E, 0x39, 0xCA, 0x39, 0xE9, 0x3A, 0xFC, 0x96, 0x9F, 0xE1, 0x9F, 0xD9,
+    0x6F, 0xF1, 0x39, 0x99, 0x99, 0x59, 0x99, 0x99, 0x93, 0x9F, 0xCA, 0x3A, 0xFD, 0x93, 0xAF, 0xC3,
+    0x9A, 0xF9, 0x5A, 0xF9, 0x4E, 0x7F, 0xD4, 0xE7, 0xFD, 0x92, 0x9D, 0xA6, 0x9F, 0xDA, 0x29, 0xD9,
+    0x69, 0xD9, 0xF2, 0xAD, 0x7A, 0xD0, 0x9E, 0xA1, 0xE7, 0xE1, 0xF1, 0xE7, 0xE1, 0x9E, 0xA9, 0xDA,
+    0x69, 0xDA, 0x2F, 0xAD, 0x96, 0xAD, 0x92, 0xAF, 0xD7, 0xE4, 0xFD, 0x7E, 0x4A, 0xFA, 0x69, 0xE5,
+    0xFA, 0x5A, 0xFC, 0x93, 0xF9, 0x4A, 0xFD, 0x93, 0x9E, 0x77, 0x29, 0x70, 0x79, 0xAA, 0xAA, 0x97,
+    0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA,
+    0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9,
+    0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94,
+    0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x49, 0xAA, 0xAC, 0xAA, 0x96, 0xAF, 0xFD, 0xA3, 0x9F,
+    0xFF, 0x93, 0x90, 0xAE, 0x1A, 0xF5, 0xF2, 0xF5, 0xEA, 0x2A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E,
+    0xA4, 0xAE, 0x2F, 0x5F, 0xAF, 0xC6, 0xFF, 0xA6, 0x9F, 0xAA, 0x97, 0x0A, 0xE7, 0x4F, 0x74, 0xEA,
+    0x73, 0x9E, 0xA7, 0x19, 0xFF, 0x7A, 0xFE, 0xA7, 0x79, 0xAA, 0xAA, 0x97, 0x5A, 0xFF, 0x97, 0x19,
+    0xFF, 0xE7, 0x09, 0xF9, 0x19, 0xFC, 0x7F, 0x5F, 0x95, 0xF9, 0x5F, 0xA4, 0x9F, 0x6A, 0xEA, 0x4A,
+    0xE9, 0x6A, 0xEA, 0x4F, 0x7A, 0xEA, 0x4F, 0x7A, 0xEA, 0x4F, 0x7F, 0x94, 0xF7, 0xF5, 0xF6, 0xAE,
+    0xA5, 0xF9, 0x5F, 0x6A, 0xF4, 0xF9, 0x7F, 0xCA, 0x9A, 0xF9, 0x70, 0x9F, 0xFD, 0x73, 0x9F, 0xDA,
+    0x77, 0xFA, 0x77, 0x1A, 0xFC, 0xA7, 0x70, 0xAF, 0xEA, 0xAA, 0xAA, 0x71, 0x9A, 0xFF, 0xCA, 0x74,
+    0xAF, 0xE7, 0x70, 0x99, 0x99, 0x20, 0x49, 0x9A, 0xAC, 0xAA, 0x97, 0xAF, 0xFD, 0xA4, 0x9F, 0xDA,
+    0xAF, 0x94, 0x90, 0xAE, 0x19, 0xF6, 0xEA, 0x2F, 0x6E, 0xA2, 0xAE, 0x59, 0xE9, 0x2F, 0x5A, 0xE2,
+    0x9E, 0x95, 0xAE, 0x09, 0xAE, 0xA6, 0xFF, 0xC9, 0x7F, 0xEA, 0x70, 0x9E, 0x9A, 0xE7, 0x0A, 0xE1,
+    0xEA, 0x7F, 0x1A, 0xE9, 0x6E, 0xA2, 0xF5, 0x9E, 0xA2, 0xAF, 0x91, 0x9F, 0xE2, 0xAF, 0xA0, 0xAF,
+    0xE3, 0xAE, 0xA7, 0x72, 0x6A, 0xAC, 0xAA, 0x96, 0xAF, 0xF4, 0xAF, 0xFC, 0x92, 0x9E, 0x92, 0xAD,
+    0x3A, 0xE3, 0xAD, 0x3F, 0x3A, 0xC9, 0x3A, 0xF7, 0x19, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0A, 0xFD,
+    0x70, 0x9F, 0xCA, 0x71, 0xAF, 0x3D, 0x4F, 0x2A, 0xD4, 0xAE, 0x2E, 0x93, 0xF2, 0xFA, 0x99, 0xF9,
+    0x2F, 0xFD, 0x94, 0x9F, 0xDA, 0x77, 0x30, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF,
+    0xFF, 0xD9, 0x0F, 0xFF, 0xE9, 0x0D, 0xA1, 0x9E, 0x91, 0xAD, 0x09, 0xD9, 0x1A, 0xE2, 0xAD, 0x1D,
+    0x2F, 0x2D, 0x91, 0x99, 0x2E, 0xA2, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x97, 0x3A, 0xE7, 0x4F, 0x74,
+    0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xF7, 0x2F, 0xEA, 0x7A, 0xFE, 0x96, 0x09, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A, 0xFA, 0x92, 0xF5,
+    0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E, 0x4F, 0x59, 0xE4,
+    0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5, 0xEA, 0x4A, 0xEA,
+    0x3A, 0xE5, 0x9F, 0xFE, 0xA6, 0xFF, 0xDA, 0x70, 0xAF, 0xDA, 0x77, 0x73, 0x09, 0x99, 0x99, 0x99,
+    0x39, 0x99, 0x99, 0x99, 0x0F, 0xEA, 0x19, 0xFD, 0xA0, 0xAF, 0xC9, 0x3A, 0xFA, 0x2A, 0xE6, 0xE9,
+    0x39, 0xE9, 0x49, 0xE5, 0xE9, 0x4E, 0x95, 0xEA, 0x3A, 0xDA, 0x6E, 0xA3, 0xE7, 0xAE, 0x2A, 0xDA,
+    0x79, 0xE2, 0xE7, 0x09, 0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xE9, 0xAD, 0x73, 0xAD, 0xAD, 0xA7,
+    0x3A, 0xFC, 0x74, 0x9F, 0x97, 0x5F, 0x76, 0xE9, 0x77, 0x74, 0x09, 0x99, 0x99, 0x99, 0x97, 0x19,
+    0x99, 0x99, 0x91, 0xFE, 0xA2, 0xDA, 0x2A, 0xFD, 0x1A, 0xFC, 0xA2, 0x9D, 0xA3, 0xAF, 0x92, 0xAE,
+    0x93, 0xF4, 0xE4, 0x9E, 0x93, 0xF3, 0xAD, 0xA4, 0x9E, 0x92, 0xAF, 0x3E, 0x6E, 0x92, 0xFC, 0x2A,
+    0xDA, 0x6E, 0x91, 0xAF, 0xC2, 0xE7, 0xE9, 0x1D, 0x9E, 0x1A, 0xD9, 0x7E, 0xA0, 0xAD, 0x0E, 0x1E,
+    0x70, 0xEA, 0x0D, 0x90, 0xE0, 0xAD, 0x97, 0x0A, 0xDA, 0xAD, 0x1A, 0xD0, 0xE7, 0x1A, 0xDA, 0xDA,
+    0x1A, 0xDA, 0xD9, 0x71, 0xAF, 0xC2, 0xAF, 0xC7, 0x29, 0xFA, 0x29, 0xF9, 0x72, 0x9F, 0x39, 0xF7,
+    0x4E, 0xA3, 0x9E, 0x97, 0x4E, 0x5E, 0x77, 0x77, 0x30, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99,
+    0x93, 0x9F, 0xE1, 0xFE, 0x4A, 0xFA, 0x29, 0xFA, 0x69, 0xE9, 0x3E, 0x71, 0xF2, 0xE9, 0x71, 0x9E,
+    0x90, 0xE9, 0x73, 0xFA, 0xD9, 0x74, 0xAF, 0xCA, 0x76, 0xFA, 0x77, 0xF7, 0x7F, 0xCA, 0x75, 0xAF,
+    0xD7, 0x4A, 0xD9, 0x0E, 0xA7, 0x2A, 0xDA, 0x1A, 0xE7, 0x19, 0xE3, 0xEA, 0x79, 0xE4, 0xAE, 0x94,
+    0x9F, 0xD9, 0x1F, 0xE3, 0xFE, 0x90, 0xAF, 0xE3, 0x09, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x90,
+    0x9F, 0xE1, 0xFE, 0x1F, 0xCA, 0x29, 0xFA, 0x3F, 0x4E, 0x94, 0xAE, 0x3A, 0xDA, 0x6E, 0x92, 0xE7,
+    0xF1, 0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x1E, 0xAD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x75, 0xEA, 0x74,
+    0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xF7, 0x3F, 0xEA, 0x70, 0xAF, 0xE9, 0x70, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x49, 0xFF, 0xF3, 0xAF, 0xFF, 0x3E, 0x4F, 0x93, 0xDA, 0x3F, 0xA4, 0xAC, 0x3A,
+    0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xA7, 0x2A, 0xF7, 0x29, 0xF3, 0x9C,
+    0x93, 0x9F, 0x4E, 0x3F, 0x93, 0x9D, 0xA2, 0xFA, 0x99, 0x99, 0x9E, 0x92, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xA7, 0x73, 0x5A, 0xAA, 0xAA, 0x95, 0xFC, 0x95, 0xEA, 0xA5, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E,
+    0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE9, 0x7E, 0x79, 0xE7, 0x9D,
+    0xA7, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xDA, 0x96, 0xFC, 0xA5, 0xFC, 0x94, 0x9D, 0xA7,
+    0xE7, 0xAD, 0x96, 0x9D, 0xA7, 0xE7, 0xAD, 0x97, 0xE7, 0xE7, 0x9D, 0xA7, 0xE7, 0xAD, 0x96, 0x9D,
+    0xA7, 0xE7, 0xAD, 0x97, 0xE7, 0xE7, 0x9D, 0xA7, 0xE7, 0xAD, 0x73, 0x5A, 0xAA, 0xAA, 0x95, 0xFC,
+    0x95, 0xAA, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0xA7, 0xE9,
+    0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE6,
+    0x99, 0xDA, 0x5F, 0xC9, 0x5F, 0xC9, 0x40, 0x4E, 0x97, 0x0E, 0xA7, 0xAF, 0x7D, 0xAD, 0xA5, 0x9D,
+    0x0E, 0x5E, 0x09, 0xD9, 0x4D, 0xA1, 0xE3, 0xAD, 0x2A, 0xD3, 0xE2, 0x9D, 0xA1, 0x9D, 0x93, 0xE1,
+    0xE4, 0xAD, 0x90, 0xAA, 0x95, 0xAA, 0x90, 0xFF, 0xF9, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x90, 0x0A, 0x92, 0x9D, 0x2A, 0xDA, 0x2E, 0x92, 0xE3, 0xAC, 0x60, 0x69, 0x73, 0xFA, 0x9D,
+    0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E,
+    0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F,
+    0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x49, 0x97, 0x0A, 0xFA, 0x69, 0xFC, 0xA7,
+    0x1E, 0x97, 0x1E, 0x71, 0x9E, 0x71, 0xAD, 0xA2, 0x95, 0xE1, 0xF9, 0x3E, 0x0F, 0xD3, 0xDA, 0xDA,
+    0xF2, 0x9F, 0x90, 0x9E, 0x2A, 0xEA, 0x19, 0xE2, 0xF2, 0x9E, 0x2E, 0x92, 0xAE, 0x19, 0xE3, 0xEA,
+    0x1A, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2F, 0x99, 0xF2, 0x9F, 0xFC, 0x3A, 0xDA, 0xFA, 0x77, 0x20,
+    0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xEA, 0x9A, 0xD2, 0xEA, 0x29, 0x29, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E,
+    0x96, 0x9E, 0x97, 0xEA, 0x2A, 0xC2, 0xFF, 0xC2, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x73, 0x97, 0x2A,
+    0xF9, 0x79, 0xFC, 0x97, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x79, 0x1A, 0xDA, 0x5F, 0xAE, 0x93, 0x9F,
+    0xFC, 0x4E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3,
+    0xE9, 0x2E, 0xA3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F,
+    0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xE1, 0xE9, 0x1E, 0x2E,
+    0x19, 0xDA, 0x19, 0xDA, 0x1A, 0xD1, 0xAD, 0xA2, 0xEA, 0xEA, 0x3F, 0xCA, 0x49, 0xE9, 0x39, 0x2E,
+    0x3A, 0xC9, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE, 0x93, 0xAF, 0xA7, 0x70, 0x74, 0x99, 0xA9, 0x75, 0xFD,
+    0x73, 0xFE, 0x97, 0x1A, 0xDA, 0x1D, 0x72, 0xE7, 0x6A, 0xE7, 0x6E, 0xA7, 0x4A, 0xFF, 0x70, 0xFF,
+    0xCA, 0x70, 0x99, 0xAE, 0x99, 0x97, 0x3A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE7, 0x6A, 0xE7,
+    0x6A, 0xDA, 0x76, 0xEA, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xEA, 0x76, 0xE9, 0x71, 0xAA,
+    0x19, 0xE7, 0x19, 0xEA, 0xE9, 0x71, 0x9F, 0xD9, 0x73, 0xAE, 0xA7, 0x40, 0x70, 0x99, 0x73, 0x9F,
+    0xFC, 0xA4, 0xAE, 0xAF, 0xD9, 0x39, 0xE2, 0xE6, 0xE9, 0x2E, 0x6E, 0x29, 0xE6, 0xE2, 0xEA, 0x6A,
+    0xDA, 0x9F, 0x70, 0xAF, 0xC9, 0x71, 0x9E, 0x97, 0x29, 0xDA, 0x74, 0xAE, 0xA7, 0x3A, 0xFC, 0xA7,
+    0xFA, 0xFC, 0xA4, 0xE9, 0x29, 0xF9, 0x2A, 0xDA, 0x5E, 0xA2, 0xAD, 0xA5, 0xE9, 0x29, 0xF9, 0x99,
+    0xAE, 0xA4, 0xAF, 0xFC, 0xA7, 0xAF, 0xA9, 0x60, 0x49, 0x97, 0x1A, 0xFA, 0x79, 0xFC, 0xA7, 0x2E,
+    0xA7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x29, 0x6E, 0x90, 0xAE, 0xA4, 0xE0, 0xFD, 0x39, 0xEA,
+    0xCA, 0xAE, 0x39, 0xFA, 0x09, 0xE3, 0xAE, 0xA1, 0xAE, 0x3F, 0x2E, 0xA3, 0xEA, 0x2E, 0x39, 0xE2,
+    0x9E, 0x3A, 0xE2, 0xAD, 0xA3, 0xEA, 0x2E, 0x90, 0xA1, 0xE9, 0x2F, 0xD0, 0x9E, 0x3F, 0xCA, 0x0A,
+    0xE3, 0xAE, 0x97, 0x70, 0x75, 0xE4, 0xAE, 0x4F, 0x4A, 0xD9, 0x76, 0x93, 0x9F, 0xA2, 0xFC, 0xA4,
+    0xE9, 0x4E, 0x49, 0xE4, 0xAD, 0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xAD, 0xA0, 0xA2, 0xFD, 0x91, 0xFD,
+    0x2A, 0xEA, 0x73, 0x77, 0x7A, 0xD9, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x71, 0xDA, 0x77, 0x70, 0x97,
+    0x1A, 0xF7, 0xAF, 0xC7, 0x19, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x1E, 0x71, 0x9E, 0x71,
+    0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xE9, 0x70, 0x9E, 0x49, 0xC9, 0x1E,
+    0x94, 0xFF, 0x5F, 0xE7, 0xAD, 0xA9, 0x70, 0x49, 0x97, 0xAF, 0xA5, 0x9F, 0xCA, 0x70, 0xE9, 0x70,
+    0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x29, 0x4E, 0x1A, 0xE3, 0xE9, 0xFC, 0xA2, 0xDA, 0xD0, 0x9D, 0xA1,
+    0x9E, 0xA2, 0xDA, 0x1A, 0xE2, 0xAD, 0x2E, 0x91, 0xAD, 0x92, 0xEA, 0xF3, 0x9F, 0xD5, 0xAD, 0xAA,
+    0xD9, 0x4E, 0x90, 0xE4, 0xE1, 0xAE, 0xA9, 0x09, 0xE2, 0xFC, 0xAA, 0xDA, 0x3A, 0xE7, 0x50, 0x49,
+    0x92, 0xAF, 0xA0, 0x9F, 0xCA, 0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0xA3, 0xE9, 0x29, 0xE3,
+    0xAE, 0x3E, 0xA3, 0xE9, 0x3E, 0x39, 0xE3, 0xAD, 0xA3, 0xE9, 0x0A, 0x1F, 0xD1, 0xFC, 0xA1, 0xF9,
+    0x71, 0x72, 0x94, 0x94, 0x9F, 0x90, 0x9E, 0xA1, 0x9E, 0xA2, 0xFC, 0x99, 0xFC, 0x0A, 0xFC, 0x4E,
+    0xAD, 0xAE, 0xAD, 0xAE, 0x4F, 0xC1, 0xFA, 0x09, 0xE4, 0xF1, 0x9F, 0x1A, 0xDA, 0x39, 0xEA, 0x1A,
+    0xE9, 0x1E, 0x93, 0xAE, 0x2F, 0x2E, 0x4E, 0xA2, 0xE9, 0x19, 0xE4, 0xE9, 0x19, 0xE2, 0xAD, 0xA3,
+    0x9E, 0x2A, 0xE2, 0xE9, 0x0A, 0x19, 0xE2, 0xEA, 0x2F, 0xD1, 0xAD, 0xA2, 0xE9, 0x2F, 0xCA, 0x1E,
+    0x92, 0xE3, 0xF9, 0x77, 0x70, 0x49, 0x49, 0x39, 0xF9, 0x1F, 0x2F, 0xCA, 0x9F, 0xCA, 0x3E, 0xAD,
+    0xAE, 0xA3, 0xFC, 0x1A, 0xDA, 0x3F, 0x91, 0xE9, 0x29, 0xEA, 0x2E, 0x3A, 0xE2, 0x9E, 0x3E, 0xA2,
+    0xEA, 0x3E, 0x92, 0xE9, 0x29, 0xE2, 0x9E, 0x09, 0x90, 0x9E, 0x29, 0xFC, 0xA0, 0xAE, 0x2A, 0xFC,
+    0x90, 0xE9, 0x3E, 0xA7, 0x70, 0x69, 0x97, 0x0A, 0xFC, 0x93, 0x9F, 0xF2, 0x9E, 0xA0, 0x9E, 0xA1,
+    0xEA, 0x2F, 0x09, 0xE3, 0xAE, 0x0E, 0xA3, 0xAE, 0x0E, 0x93, 0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x92,
+    0x9E, 0x1E, 0x92, 0xE9, 0x1F, 0x99, 0xF2, 0x9F, 0xEA, 0x49, 0xFC, 0x97, 0x70, 0x59, 0x49, 0x5A,
+    0xF1, 0xAE, 0xA2, 0x9F, 0xC9, 0xAF, 0xC5, 0xEA, 0xDA, 0xE9, 0x4F, 0xA1, 0xEA, 0x4F, 0x2E, 0xA3,
+    0x9E, 0x92, 0xE9, 0x3A, 0xE3, 0xE4, 0xE9, 0x2A, 0xE4, 0xE3, 0xE9, 0x39, 0xE2, 0xAE, 0x4A, 0xEA,
+    0x9A, 0xE9, 0x4F, 0xFC, 0x95, 0xEA, 0xF6, 0x9E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x29, 0xF9, 0x70,
+    0x9F, 0xE7, 0x9A, 0xAA, 0xAA, 0xAA, 0x70, 0x69, 0x72, 0xFA, 0x9D, 0xA2, 0x9F, 0xFC, 0x92, 0xEA,
+    0x09, 0xF2, 0xAE, 0x2A, 0xDA, 0x19, 0xE3, 0xE9, 0x1A, 0xE3, 0xE2, 0xE9, 0x2A, 0xE2, 0xE9, 0x2E,
+    0xA2, 0xE2, 0xAE, 0xA1, 0x9E, 0x90, 0xAF, 0x92, 0xFA, 0xDA, 0xD3, 0xFD, 0x0E, 0x39, 0xEA, 0x1E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0xA6, 0x9F, 0xE5, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x10, 0x49, 0x39, 0x29, 0xF9, 0x09, 0xE1, 0xFC, 0xA9, 0xF3, 0xAD, 0x9F, 0xC3, 0xAD, 0xAC, 0xA9,
+    0x99, 0x3F, 0xA7, 0xF7, 0x9E, 0xA7, 0xAE, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0E,
+    0xA7, 0x79, 0x7A, 0xFC, 0x4F, 0xE9, 0x2E, 0x90, 0x9D, 0x3E, 0x70, 0xF9, 0x69, 0xFA, 0x6A, 0xFA,
+    0x69, 0xF9, 0x2A, 0x3E, 0xA1, 0xAD, 0x2A, 0xDA, 0x1F, 0x99, 0xE2, 0xFF, 0x93, 0xAF, 0xC7, 0x70,
+    0x59, 0x96, 0x9D, 0xA6, 0xE9, 0x6E, 0x5A, 0xFE, 0x90, 0xFF, 0xC1, 0x99, 0xEA, 0x99, 0x4E, 0x95,
+    0x9E, 0x6A, 0xE6, 0xAE, 0x6E, 0xA6, 0xE9, 0x59, 0xE1, 0x9C, 0xA1, 0x9F, 0xEA, 0x19, 0xFE, 0x3A,
+    0xF9, 0x75, 0x39, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x3E,
+    0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F, 0x3A,
+    0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD, 0xA7, 0x70,
+    0x71, 0x92, 0xAE, 0x91, 0x9E, 0x9A, 0xFC, 0x2E, 0xA0, 0x9A, 0xE2, 0xEA, 0x2E, 0x91, 0xAD, 0xA2,
+    0xE9, 0x1E, 0x3A, 0xDA, 0x1E, 0x3A, 0xDA, 0x09, 0xD9, 0x39, 0xDA, 0x0D, 0xA4, 0x9D, 0xAA, 0xD6,
+    0xFC, 0x96, 0xFA, 0x7E, 0xA7, 0x0D, 0xA7, 0x72, 0x71, 0x94, 0x92, 0xAE, 0x2A, 0xDA, 0x19, 0xE0,
+    0xAF, 0xA1, 0x9E, 0x2E, 0xA1, 0xAE, 0x2E, 0x91, 0xAD, 0xA2, 0xE2, 0xE9, 0x1A, 0xD9, 0x2E, 0x91,
+    0xEA, 0x1A, 0xD3, 0xAD, 0xA0, 0x9F, 0x1D, 0xA3, 0x9D, 0xA0, 0xAF, 0x09, 0xD9, 0x4D, 0xA0, 0xFC,
+    0x0E, 0x5D, 0xAA, 0xCA, 0xAD, 0x9D, 0x95, 0xFC, 0x0A, 0xFA, 0x6F, 0x90, 0xAF, 0x7E, 0x91, 0xAE,
+    0x70, 0xDA, 0x29, 0xD7, 0x77, 0x00, 0x74, 0x94, 0xAE, 0x92, 0xAE, 0x2A, 0xFC, 0x1A, 0xF9, 0x19,
+    0x99, 0xE9, 0x9D, 0xAA, 0xC5, 0xEA, 0xD9, 0x70, 0x9F, 0xA7, 0x2F, 0x73, 0xAE, 0x73, 0xF9, 0x71,
+    0xFD, 0x70, 0xAD, 0x9E, 0x5F, 0xC9, 0x0F, 0xAA, 0x91, 0xFA, 0x1A, 0xFC, 0x91, 0xEA, 0x3F, 0x97,
+    0x71, 0x75, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA, 0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD,
+    0xA6, 0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0,
+    0xD9, 0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E,
+    0x79, 0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x72, 0x94, 0xAF, 0x90, 0xE2, 0x9F, 0xFD,
+    0x2A, 0xDA, 0xFD, 0x3A, 0xCA, 0x2E, 0x93, 0x9C, 0x2E, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A,
+    0xD9, 0x70, 0xAD, 0x92, 0xA4, 0xAD, 0xA2, 0x9D, 0x2A, 0xFD, 0xAE, 0x2F, 0xFE, 0x2D, 0xA0, 0x9F,
+    0xC7, 0x70, 0x59, 0xE5, 0xFC, 0x93, 0xAE, 0xA9, 0x4E, 0x69, 0xD9, 0x6A, 0xD9, 0x6A, 0xD9, 0x6A,
+    0xD7, 0xE7, 0xE5, 0x9E, 0x95, 0xE9, 0x6E, 0xA7, 0xE7, 0xE7, 0xDA, 0x6A, 0xD7, 0xE7, 0xD9, 0x6A,
+    0xD7, 0xAD, 0x7A, 0xD9, 0x69, 0xFC, 0x5A, 0xEA, 0x77, 0x75, 0xAD, 0x5E, 0x5E, 0x5D, 0xA4, 0x9D,
+    0x94, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD,
+    0x94, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5E, 0x40, 0x4A, 0xDA, 0x5A, 0xFA, 0x49,
+    0xAA, 0xE7, 0xAD, 0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xDA, 0x69, 0xD9, 0x69, 0xD9, 0x69,
+    0xE7, 0xEA, 0x5A, 0xE5, 0x9D, 0xA6, 0xAD, 0x7E, 0x7E, 0x7E, 0x7E, 0x69, 0xDA, 0x59, 0xE4, 0xFC,
+    0xA4, 0xF9, 0x77, 0x00, 0x2A, 0xA9, 0x49, 0x19, 0xFC, 0x91, 0xAC, 0xA0, 0xFF, 0xAD, 0xA0, 0xD9,
+    0x09, 0xFD, 0x19, 0xC3, 0xAD, 0xA1, 0x75, 0xE4, 0xAE, 0x4A, 0xE5, 0x99, 0x77, 0xD5, 0x9D, 0x5A,
+    0xD5, 0xDA, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x94, 0xE4, 0x9E, 0x4A, 0xE4, 0xEA, 0x39, 0xE9, 0x3A,
+    0xE4, 0xAC, 0xA4, 0x77, 0x59, 0xD7, 0x2A, 0xCA, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0x9D, 0x97, 0xAF,
+    0xD9, 0x39, 0xFF, 0xC2, 0xAE, 0xAD, 0x9A, 0xCA, 0x2E, 0x90, 0xD5, 0xAD, 0xA1, 0xCA, 0x5E, 0x19,
+    0xC9, 0x49, 0xE1, 0xAC, 0x59, 0xE1, 0xD5, 0x9E, 0x1C, 0xA6, 0xE9, 0x9C, 0xA1, 0xAC, 0x2F, 0xDA,
+    0xAE, 0x3F, 0xFA, 0x5F, 0xCA, 0x97, 0x9C, 0xA7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7,
+    0x29, 0xA9, 0x70, 0x73, 0x97, 0x49, 0xFC, 0x97, 0x0A, 0xFE, 0x79, 0xDA, 0x1E, 0x96, 0xE2, 0x9D,
+    0x95, 0xAD, 0xA2, 0x9C, 0x96, 0xE7, 0x49, 0xE7, 0x29, 0x9A, 0xE9, 0x99, 0x96, 0xFF, 0xD5, 0x9A,
+    0xFA, 0xAA, 0xA9, 0x79, 0xE7, 0x4A, 0xDA, 0x74, 0xE7, 0x5E, 0x72, 0xFD, 0xAA, 0xAA, 0xAE, 0x19,
+    0xFF, 0xFC, 0xA1, 0x9E, 0xA0, 0x9A, 0xFD, 0x39, 0x97, 0x50, 0x77, 0x1A, 0xC3, 0x93, 0xCA, 0x2E,
+    0x9F, 0xCA, 0xE3, 0xFF, 0xDA, 0x49, 0xDA, 0x19, 0xDA, 0x5D, 0xA3, 0xE5, 0xD9, 0x3D, 0xA4, 0x9D,
+    0x39, 0xD9, 0x5D, 0xA2, 0xE4, 0x9F, 0xFD, 0x3A, 0xDA, 0xFF, 0xC9, 0x19, 0xC9, 0x19, 0x99, 0x2A,
+    0xC7, 0x72, 0x77, 0x0A, 0xFE, 0x09, 0xFD, 0x9F, 0xE9, 0x09, 0xFC, 0xA1, 0x9E, 0xA3, 0x9E, 0x4E,
+    0xA3, 0xE9, 0x4A, 0xE2, 0xAD, 0x96, 0xE9, 0x09, 0xDA, 0x7E, 0xA0, 0xE6, 0xFD, 0xAF, 0xC4, 0xAA,
+    0xAF, 0xF9, 0x7A, 0xEA, 0x70, 0xFF, 0xE5, 0xAF, 0xFC, 0xA7, 0x0E, 0xA7, 0x4E, 0x97, 0x39, 0xE9,
+    0x71, 0x9F, 0xE7, 0x0F, 0xF7, 0x75, 0xAD, 0x5E, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5D,
+    0xA5, 0xAA, 0x97, 0x77, 0x77, 0x0D, 0x94, 0xAD, 0x94, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD,
+    0x5E, 0x5E, 0x40, 0x77, 0x2A, 0xFA, 0x49, 0xFE, 0x92, 0x9D, 0xA1, 0xAD, 0x92, 0xE3, 0xD2, 0xAE,
+    0xA7, 0xCA, 0x9D, 0x96, 0xCA, 0x0A, 0xDA, 0x5D, 0x1A, 0xE4, 0xDA, 0x19, 0xE3, 0x9D, 0xA1, 0x9D,
+    0xA3, 0xAD, 0xA1, 0x9D, 0x4A, 0xE1, 0xD5, 0xAE, 0x0D, 0x69, 0xD9, 0xD2, 0xA9, 0x2A, 0xEA, 0x1D,
+    0xA2, 0x9E, 0x2E, 0x91, 0xAD, 0x92, 0xFF, 0x94, 0xAF, 0xA7, 0x71, 0x71, 0xAD, 0x1A, 0xCA, 0x9E,
+    0x0A, 0xE9, 0xDA, 0x0A, 0xD9, 0x59, 0x10, 0x69, 0xAA, 0xA9, 0x73, 0xAF, 0xF9, 0x69, 0xD9, 0x5A,
+    0xCA, 0x5D, 0x70, 0x9C, 0xA3, 0xD3, 0xAA, 0xAA, 0x91, 0x9C, 0x91, 0x9C, 0x91, 0x9F, 0xD2, 0xAC,
+    0x1D, 0x2D, 0x91, 0xD2, 0x9C, 0x90, 0xCA, 0x1A, 0xD2, 0xA9, 0x3C, 0xA0, 0xC9, 0x1D, 0xA7, 0x0C,
+    0xA0, 0xC9, 0x1D, 0xA7, 0x0D, 0x0C, 0x91, 0xDA, 0x70, 0xCA, 0x0C, 0xA1, 0xAD, 0x70, 0xCA, 0x0A,
+    0xC1, 0x9E, 0xAA, 0xAC, 0x29, 0xC9, 0x09, 0xC9, 0x19, 0xFC, 0xA2, 0xD2, 0xD3, 0x99, 0x93, 0xAC,
+    0x93, 0xD7, 0x0A, 0xCA, 0x5D, 0xA9, 0x39, 0xD9, 0x79, 0xFE, 0xA7, 0x49, 0x99, 0x96, 0x3A, 0xA9,
+    0x9A, 0x91, 0x9F, 0xD2, 0xDA, 0x0A, 0xD1, 0xAC, 0xA1, 0xAC, 0x91, 0xD2, 0xD2, 0xD1, 0xAD, 0x19,
+    0xD9, 0xAD, 0xA9, 0xA0, 0xFA, 0xEA, 0x09, 0xD9, 0x0D, 0xA7, 0x3A, 0xAA, 0xAA, 0xE0, 0xAF, 0xE9,
+    0x72, 0x77, 0x3A, 0xCA, 0x29, 0xD4, 0xEA, 0x1A, 0xE2, 0x9E, 0x91, 0xEA, 0x29, 0xE9, 0x1E, 0xA3,
+    0xEA, 0x1A, 0xE4, 0xF1, 0xAE, 0x5E, 0x91, 0xEA, 0x49, 0xE2, 0xE9, 0x5D, 0x92, 0xDA, 0x77, 0x00,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x79, 0xD9, 0x79, 0xD9, 0x79,
+    0xD9, 0x70, 0x99, 0x00, 0xAF, 0xD9, 0xFE, 0xAF, 0xE9, 0x59, 0x97, 0x1A, 0xFC, 0xA4, 0x9C, 0xA3,
+    0x9D, 0x3C, 0x99, 0x99, 0x92, 0xCA, 0x1A, 0xA0, 0xAD, 0xAC, 0x91, 0xC1, 0xC9, 0x1C, 0xA0, 0xD1,
+    0xCA, 0x0C, 0x2C, 0xA9, 0xC9, 0x1A, 0xA0, 0xC2, 0xEA, 0x2A, 0xC0, 0xC2, 0xCA, 0xAC, 0x91, 0xAA,
+    0x0C, 0xA0, 0x9D, 0x9D, 0x90, 0xC9, 0x09, 0xC0, 0x99, 0x91, 0xA9, 0xAC, 0x2A, 0xC5, 0x9C, 0x93,
+    0xAC, 0xA9, 0x9A, 0xD9, 0x69, 0xAA, 0xA9, 0x30, 0x0F, 0xE9, 0x9F, 0xE9, 0x09, 0x99, 0x99, 0x99,
+    0x00, 0x39, 0x95, 0xFC, 0xA2, 0xFE, 0x90, 0xAD, 0x91, 0xE0, 0xE2, 0xAD, 0x0D, 0xA2, 0xAD, 0x0A,
+    0xD9, 0x1E, 0x09, 0xFE, 0x91, 0x9F, 0xC9, 0x49, 0x99, 0x30, 0x39, 0xAA, 0x70, 0xAD, 0x70, 0xAD,
+    0x70, 0xAD, 0x49, 0x99, 0x9A, 0xD9, 0x99, 0x90, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x3A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x19, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xD9, 0xAF,
+    0xFD, 0x97, 0x30, 0x49, 0xA9, 0x5A, 0xFC, 0x92, 0xAD, 0xA9, 0xE2, 0xD9, 0x1A, 0xD3, 0x92, 0xE6,
+    0xAD, 0x6E, 0x6E, 0x59, 0xDA, 0x5A, 0xDA, 0x99, 0x99, 0x2F, 0xF9, 0x1A, 0xAA, 0xAA, 0xAA, 0x91,
+    0x39, 0xA9, 0x39, 0xFC, 0x91, 0xDA, 0x9D, 0xA1, 0xC9, 0x1A, 0xCA, 0x49, 0xD3, 0xAE, 0x92, 0xAF,
+    0xA5, 0xAD, 0x5A, 0xD4, 0xAD, 0xA0, 0xFD, 0xA1, 0xAE, 0xA9, 0x73, 0x70, 0xC9, 0x2E, 0x1A, 0xE1,
+    0xE1, 0xAD, 0x29, 0xA3, 0x77, 0x4E, 0x92, 0xEA, 0x49, 0xE3, 0xE5, 0xAE, 0x29, 0xE5, 0xAD, 0xA2,
+    0xAD, 0xA5, 0xE9, 0x2A, 0xDA, 0x5E, 0x3E, 0x95, 0xE3, 0xE5, 0x9E, 0x29, 0xE5, 0xAE, 0x2F, 0x5A,
+    0xE1, 0xAF, 0x19, 0x2F, 0xFA, 0xDA, 0xD2, 0xFE, 0x99, 0xFA, 0x19, 0xDA, 0xE9, 0x1E, 0xA2, 0xAD,
+    0x75, 0xE7, 0x5E, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4A, 0xCA, 0x75, 0x71, 0x99, 0x99, 0x99, 0x7A,
+    0xFF, 0x94, 0xAF, 0xCA, 0xDA, 0x94, 0xAF, 0xD0, 0xD6, 0xFD, 0xA0, 0xD5, 0xAF, 0xDA, 0x9C, 0xA5,
+    0xFE, 0x9A, 0xC9, 0x5F, 0xE0, 0xAC, 0x95, 0xFE, 0x0D, 0x6F, 0xDA, 0x0D, 0x69, 0xFC, 0x99, 0xCA,
+    0x79, 0xCA, 0xD0, 0xAC, 0xA7, 0x2D, 0x0A, 0xC9, 0x72, 0xD0, 0xD7, 0x29, 0xCA, 0x0D, 0x72, 0xAC,
+    0x99, 0xCA, 0x72, 0xD0, 0xAC, 0x97, 0x2D, 0x0D, 0x72, 0xAF, 0x95, 0x9C, 0x99, 0xAF, 0x96, 0x9F,
+    0xC7, 0x39, 0xAA, 0x97, 0x30, 0x59, 0xDA, 0x0F, 0x0E, 0xA0, 0xAC, 0xA0, 0x1A, 0xCA, 0x19, 0xE9,
+    0x2D, 0x2A, 0xCA, 0x09, 0xDA, 0x19, 0xA9, 0x20, 0x49, 0x92, 0x9A, 0xE9, 0x1F, 0xC4, 0xE4, 0xDA,
+    0x39, 0xD9, 0x3A, 0xD4, 0xAD, 0x4D, 0xA3, 0x9D, 0xA2, 0xFD, 0x09, 0xAA, 0xAA, 0xAA, 0x00, 0x39,
+    0xAA, 0xA4, 0xAF, 0xC2, 0xAD, 0x1D, 0x90, 0x9D, 0x91, 0xDA, 0x0A, 0xD2, 0xD9, 0x0A, 0xCA, 0x19,
+    0xD1, 0xAC, 0xA1, 0xDA, 0x19, 0xFD, 0x39, 0xE9, 0x75, 0xAA, 0xAA, 0xAD, 0x90, 0xAF, 0xDA, 0x73,
+    0x77, 0x09, 0xD3, 0xD5, 0x9E, 0x2E, 0x94, 0xAE, 0x19, 0xE5, 0xF1, 0xF4, 0xAE, 0x19, 0xE3, 0x9E,
+    0x91, 0xEA, 0x29, 0xE9, 0x1E, 0xA2, 0x9E, 0x2E, 0x93, 0xDA, 0x2A, 0xD7, 0x73, 0x77, 0x77, 0x73,
+    0xAC, 0x97, 0x9E, 0x97, 0x1E, 0x6F, 0xC7, 0x1E, 0x79, 0x9E, 0x70, 0xAD, 0x97, 0x1D, 0xA7, 0x0D,
+    0xA7, 0x19, 0xD9, 0x7E, 0x72, 0x9D, 0x7A, 0xD7, 0x3A, 0xD6, 0x9D, 0x94, 0xDA, 0x3E, 0x6D, 0xA4,
+    0xEA, 0x3D, 0xA5, 0xAD, 0x4F, 0x91, 0xAF, 0xC3, 0x9D, 0x4D, 0x9D, 0x19, 0xFD, 0x3D, 0x93, 0xD9,
+    0x9D, 0x73, 0xDA, 0x3D, 0x90, 0xAC, 0xA7, 0x2A, 0xD3, 0xDA, 0x1D, 0xA7, 0x1A, 0xD9, 0x2A, 0xFF,
+    0xC7, 0x9D, 0xA3, 0x9F, 0xFA, 0x7E, 0x71, 0xAD, 0x70, 0xE9, 0x71, 0xDA, 0x70, 0xAC, 0xA7, 0x77,
+    0x97, 0x71, 0x77, 0x77, 0x71, 0xAC, 0x97, 0x9E, 0x97, 0x9E, 0x6F, 0xC7, 0x0E, 0x79, 0x9E, 0x7A,
+    0xD9, 0x71, 0xDA, 0x69, 0xDA, 0x71, 0x9D, 0x96, 0xDA, 0x72, 0x9D, 0x6A, 0xD7, 0x3A, 0xD5, 0x9D,
+    0x29, 0xFA, 0x3E, 0x5D, 0x91, 0xAF, 0xDA, 0x2D, 0xA4, 0xDA, 0x2D, 0x91, 0xE0, 0xAF, 0xC2, 0xAD,
+    0x3A, 0x92, 0xDA, 0x9F, 0xD1, 0x9D, 0x97, 0xAD, 0x71, 0xDA, 0x7A, 0xD9, 0x70, 0xE7, 0xE7, 0x1A,
+    0xD6, 0x9D, 0xA7, 0x19, 0xDA, 0x59, 0xD9, 0x72, 0xE5, 0x9F, 0xF5, 0xE6, 0x9F, 0xEA, 0x5A, 0xC9,
+    0x77, 0x69, 0x77, 0x10, 0x77, 0x76, 0x97, 0x3D, 0x70, 0xFC, 0x70, 0x9D, 0xA6, 0xEA, 0xDA, 0x7E,
+    0x7C, 0xA1, 0xAC, 0xA6, 0xE7, 0x4D, 0x95, 0xAD, 0x97, 0x19, 0xAD, 0x96, 0xDA, 0x71, 0xAF, 0x95,
+    0xE7, 0x29, 0x90, 0xAD, 0x4A, 0xD5, 0xDA, 0x59, 0xD4, 0xD9, 0x4E, 0xA4, 0x9E, 0x3D, 0xA4, 0xF9,
+    0x0A, 0xAA, 0xF3, 0xAC, 0xA4, 0xD9, 0xD1, 0xFC, 0xA3, 0xAD, 0x4D, 0x99, 0xD7, 0x29, 0xD9, 0x3D,
+    0x90, 0xAC, 0xA7, 0x2D, 0xA3, 0xDA, 0x1D, 0xA7, 0x1E, 0x3A, 0xFF, 0xC7, 0xAD, 0x93, 0x9F, 0xFA,
+    0x69, 0xDA, 0x71, 0xAD, 0x70, 0xE7, 0x2D, 0xA7, 0x0D, 0x97, 0x77, 0x97, 0x71, 0x75, 0xE4, 0xAE,
+    0x4A, 0xE5, 0x99, 0x75, 0x9E, 0x93, 0xFC, 0x39, 0x9E, 0x49, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A,
+    0xD9, 0x39, 0xD9, 0x4A, 0xD5, 0xAD, 0x91, 0xA9, 0x0A, 0xFD, 0xA1, 0xFD, 0xA2, 0xFA, 0x59, 0x30,
+    0x77, 0x74, 0x9C, 0x97, 0x70, 0xAD, 0xA7, 0x7A, 0xF7, 0x79, 0xF7, 0x71, 0xAA, 0x77, 0x77, 0x49,
+    0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0,
+    0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF,
+    0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9,
+    0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x77, 0x77, 0x2C, 0xA7, 0x7A, 0xE7, 0x6F, 0xA7, 0x5F,
+    0x97, 0x6A, 0x97, 0x77, 0x76, 0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9,
+    0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7, 0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92,
+    0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6, 0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9,
+    0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE, 0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x77, 0x77, 0xAD, 0x77,
+    0xAF, 0x75, 0xAD, 0xAE, 0x73, 0xE9, 0x09, 0xD9, 0x71, 0x9C, 0xA3, 0x9A, 0x77, 0x77, 0x29, 0xAA,
+    0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E,
+    0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE,
+    0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F,
+    0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x72, 0xA9, 0x29, 0x73, 0x9E, 0xA0, 0xAC, 0x97, 0x2F, 0xF7,
+    0x3D, 0x09, 0xE9, 0x77, 0x09, 0x77, 0x77, 0x49, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97,
+    0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7,
+    0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD,
+    0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x77,
+    0x74, 0x9D, 0x90, 0x9D, 0x73, 0xE9, 0x0E, 0x97, 0x2E, 0x1E, 0x73, 0x99, 0x29, 0x97, 0x77, 0x73,
+    0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E,
+    0x09, 0xE7, 0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A,
+    0xFF, 0xE6, 0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC,
+    0x93, 0xFE, 0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x73, 0x9A, 0x97, 0x7F, 0xC7, 0x5D, 0x90, 0xD9, 0x74,
+    0xD1, 0xAC, 0x97, 0x4D, 0x99, 0xD7, 0x59, 0xF9, 0x77, 0x99, 0x77, 0x19, 0xAA, 0x77, 0xAE, 0x76,
+    0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90,
+    0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6,
+    0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA,
+    0x2A, 0xFE, 0x90, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x73, 0xFF, 0xFD, 0x97, 0x39,
+    0xFF, 0xF7, 0x49, 0xFC, 0x3A, 0xD7, 0x39, 0xD9, 0xE3, 0x9C, 0xA7, 0x3D, 0xA9, 0xDA, 0x39, 0xA7,
+    0x3E, 0x0A, 0xD9, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xAD, 0x91, 0xFF, 0x97, 0x19, 0xDA, 0x1A, 0xFF,
+    0x72, 0xE2, 0xEA, 0x99, 0x99, 0x97, 0x1F, 0xFD, 0x97, 0x5F, 0xFE, 0x59, 0x6A, 0xDA, 0x39, 0xE4,
+    0xD9, 0x49, 0xE4, 0xAD, 0xA3, 0x9D, 0x93, 0x9E, 0x5E, 0xA9, 0x99, 0x9E, 0x3A, 0xFA, 0x2F, 0xFF,
+    0xA2, 0xAF, 0xD1, 0x9F, 0xFF, 0x92, 0x79, 0xAA, 0xCA, 0xA7, 0x0A, 0xFF, 0xC5, 0xFF, 0xE4, 0xFA,
+    0x3E, 0x3F, 0x94, 0xDA, 0x2A, 0xE9, 0x5D, 0x3F, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x4F, 0x74,
+    0xF7, 0x4F, 0x74, 0xFA, 0x6C, 0x92, 0xAF, 0xA3, 0x9D, 0xA3, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0xAF,
+    0xDA, 0x77, 0x73, 0xAC, 0xA7, 0x5E, 0xA7, 0x5D, 0xA7, 0x49, 0xD7, 0x4A, 0xD9, 0x74, 0xA9, 0x71,
+    0x77, 0x70, 0xCA, 0x75, 0x9E, 0x75, 0xF9, 0x74, 0xAE, 0x97, 0x59, 0xA7, 0x77, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E,
+    0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99,
+    0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2,
+    0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x77, 0x75, 0xAC, 0x74, 0x9E, 0x73, 0xAF, 0x72, 0xFA, 0x73,
+    0xAA, 0x97, 0x77, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94,
+    0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6,
+    0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4,
+    0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x77, 0x72, 0x9D, 0x97,
+    0x39, 0xF9, 0x71, 0x9D, 0xAE, 0x70, 0xAD, 0xA1, 0xDA, 0x7A, 0xC9, 0x3C, 0x97, 0x75, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xF9, 0x3A, 0xFF, 0xE9, 0x4A, 0xE3, 0x9D, 0x5F, 0x39, 0xD5,
+    0xEA, 0x39, 0xC9, 0x49, 0xE9, 0x73, 0xAE, 0x74, 0xAF, 0xFA, 0x6F, 0xFC, 0x96, 0xEA, 0x99, 0x99,
+    0x96, 0x9E, 0x97, 0x3A, 0xE5, 0x95, 0xF4, 0xAC, 0x94, 0xEA, 0x4D, 0x93, 0x9E, 0xA9, 0x99, 0x9E,
+    0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xF9, 0x20, 0x77, 0x70, 0xDA, 0x1D, 0xA7, 0xAE, 0x0A, 0xE7, 0xAD,
+    0x90, 0xE9, 0x70, 0x93, 0x97, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xF9, 0x3A,
+    0xFF, 0xE9, 0x4A, 0xE3, 0x9D, 0x5F, 0x39, 0xD5, 0xEA, 0x39, 0xC9, 0x49, 0xE9, 0x73, 0xAE, 0x74,
+    0xAF, 0xFA, 0x6F, 0xFC, 0x96, 0xEA, 0x99, 0x99, 0x96, 0x9E, 0x97, 0x3A, 0xE5, 0x95, 0xF4, 0xAC,
+    0x94, 0xEA, 0x4D, 0x93, 0x9E, 0xA9, 0x99, 0x9E, 0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xF9, 0x20, 0x77,
+    0x0C, 0xA7, 0x0A, 0xDA, 0x79, 0xF7, 0x0A, 0xE7, 0x19, 0xA7, 0x71, 0x99, 0x99, 0x99, 0x99, 0x29,
+    0xFE, 0xA3, 0xAF, 0xCA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6,
+    0x9E, 0x96, 0xAE, 0x96, 0xAE, 0x7F, 0x69, 0xEA, 0x49, 0xFE, 0x92, 0xAF, 0xE9, 0x20, 0x77, 0x6A,
+    0xA7, 0x09, 0xE7, 0xFC, 0x6F, 0x97, 0xA9, 0x77, 0x59, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xEA, 0x4A,
+    0xFC, 0xA6, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7,
+    0x9E, 0x97, 0xAE, 0x97, 0xAE, 0x70, 0xF7, 0x9E, 0xA5, 0x9F, 0xE9, 0x3A, 0xFE, 0x93, 0x77, 0x3A,
+    0xD9, 0x7A, 0xF6, 0xAD, 0xAE, 0x4A, 0xD9, 0x1D, 0x93, 0xD9, 0x29, 0xA7, 0x71, 0x99, 0x99, 0x99,
+    0x99, 0x39, 0xFE, 0xA4, 0xAF, 0xCA, 0x6A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xEA, 0x79, 0xE9, 0x7A,
+    0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE9, 0x7A, 0xE7, 0x0F, 0x79, 0xEA, 0x59, 0xFE, 0x93,
+    0xAF, 0xE9, 0x30, 0x77, 0x09, 0xD9, 0x09, 0xD9, 0x3E, 0xA0, 0xEA, 0x3E, 0x1E, 0x59, 0x39, 0x77,
+    0x29, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xEA, 0x4A, 0xFC, 0xA6, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E,
+    0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x97, 0xAE, 0x70, 0xF7, 0x9E,
+    0xA5, 0x9F, 0xE9, 0x3A, 0xFE, 0x93, 0x49, 0xAA, 0xAC, 0xAA, 0xA9, 0x7A, 0xFF, 0xE9, 0x49, 0xFF,
+    0xFC, 0xA4, 0x90, 0xAE, 0x2A, 0xF9, 0x5F, 0x3A, 0xF5, 0xEA, 0x4F, 0x49, 0xE9, 0x4A, 0xE9, 0x3A,
+    0xE5, 0x9E, 0xA0, 0x9A, 0xAF, 0xAA, 0xA2, 0x9E, 0x90, 0xAF, 0xFC, 0x2A, 0xE9, 0x29, 0xEA, 0x5A,
+    0xE3, 0x9E, 0x95, 0xF3, 0xAE, 0x59, 0xE9, 0x3F, 0x5F, 0x4E, 0xA3, 0x9F, 0x49, 0xF9, 0xAA, 0xFC,
+    0x92, 0x9F, 0xFF, 0xA4, 0xAF, 0xFC, 0xA9, 0x77, 0x71, 0x71, 0x9A, 0x92, 0x97, 0x5A, 0xE9, 0x0D,
+    0x75, 0xFF, 0x75, 0xC9, 0x0A, 0xE7, 0x77, 0x77, 0x75, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x39,
+    0xFC, 0xA3, 0xAF, 0xD9, 0x3A, 0xFC, 0x39, 0xAF, 0x95, 0xAF, 0x94, 0xE7, 0xFD, 0x4E, 0x7F, 0xD9,
+    0x29, 0xDA, 0x69, 0xFD, 0xA2, 0x9D, 0x96, 0x9D, 0x9F, 0x2A, 0xD7, 0xAD, 0x09, 0xEA, 0x1E, 0x7E,
+    0x1F, 0x1E, 0x7E, 0x19, 0xEA, 0x9D, 0xA6, 0x9D, 0xA2, 0xFA, 0xD9, 0x6A, 0xD9, 0x2A, 0xFD, 0x7E,
+    0x4F, 0xD7, 0xE4, 0xAF, 0xA6, 0x9E, 0x5F, 0xA5, 0xAF, 0xC9, 0x3F, 0x94, 0xAF, 0xD9, 0x39, 0xE7,
+    0x72, 0x97, 0x77, 0x71, 0xCA, 0x76, 0xAD, 0xA7, 0x59, 0xF7, 0x6A, 0xE7, 0x79, 0xA7, 0x77, 0x69,
+    0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91,
+    0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE,
+    0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC,
+    0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x77, 0x76, 0xAA, 0x75, 0x9E, 0x74,
+    0xFC, 0x73, 0xF9, 0x74, 0xA9, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE,
+    0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE,
+    0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA,
+    0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9,
+    0x77, 0x70, 0x77, 0x73, 0xAD, 0x97, 0x4A, 0xF7, 0x3A, 0xDA, 0xE7, 0x1A, 0xD9, 0x1D, 0x97, 0x0D,
+    0x92, 0x9A, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x71, 0xFF, 0xC9, 0x59, 0xFF, 0xE9, 0x39, 0xF9, 0x19,
+    0xFC, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0xA0, 0x9F, 0x6A, 0xEA, 0x0A, 0xE9, 0x6A, 0xEA, 0x0F,
+    0x7A, 0xEA, 0x0F, 0x7A, 0xEA, 0x0F, 0x7F, 0x90, 0xF7, 0xF1, 0xF6, 0xAE, 0xA1, 0xF9, 0x49, 0xF2,
+    0xAF, 0x39, 0xF9, 0x3F, 0xCA, 0xAF, 0xC9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0x97, 0x77, 0x70, 0xA9,
+    0x29, 0x71, 0x9F, 0x0A, 0xC9, 0x70, 0xFF, 0x71, 0xD1, 0xE9, 0x76, 0x97, 0x77, 0x69, 0xAA, 0xAA,
+    0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A,
+    0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7,
+    0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC,
+    0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x77, 0x70, 0x9D, 0x90, 0x9D, 0x97, 0x0E, 0xA0,
+    0xEA, 0x70, 0xE1, 0xE7, 0x29, 0x39, 0x77, 0x75, 0x9A, 0xAA, 0xA9, 0x71, 0xFF, 0xC9, 0x59, 0xFF,
+    0xE9, 0x39, 0xF9, 0x19, 0xFC, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0xA0, 0x9F, 0x6A, 0xEA, 0x0A,
+    0xE9, 0x6A, 0xEA, 0x0F, 0x7A, 0xEA, 0x0F, 0x7A, 0xEA, 0x0F, 0x7F, 0x90, 0xF7, 0xF1, 0xF6, 0xAE,
+    0xA1, 0xF9, 0x49, 0xF2, 0xAF, 0x39, 0xF9, 0x3F, 0xCA, 0xAF, 0xC9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD,
+    0x97, 0x77, 0x19, 0x59, 0x1A, 0xCA, 0x3D, 0x90, 0xEA, 0x1E, 0xA1, 0xEA, 0xEA, 0x3F, 0xCA, 0x49,
+    0xF5, 0xFC, 0xA3, 0xEA, 0xEA, 0x1E, 0xA1, 0xEA, 0x0D, 0xA3, 0xD9, 0x1A, 0x49, 0x90, 0x77, 0x75,
+    0x9A, 0xAA, 0xA9, 0x2C, 0xA7, 0xFF, 0xC9, 0xDA, 0x59, 0xFF, 0xFA, 0x59, 0xF9, 0x19, 0xFC, 0x59,
+    0xF5, 0xF5, 0xF5, 0xFC, 0xA3, 0x9E, 0xA4, 0xDA, 0xEA, 0x3A, 0xE9, 0x3D, 0x99, 0xEA, 0x3F, 0x29,
+    0xD9, 0x09, 0xEA, 0x3F, 0x19, 0xD9, 0x19, 0xEA, 0x3E, 0xA0, 0x9D, 0x92, 0xAE, 0x93, 0xEA, 0x9D,
+    0x4F, 0x4F, 0xD4, 0x9E, 0xA4, 0xFC, 0x5F, 0x5A, 0xF3, 0x9F, 0x95, 0xAF, 0xCA, 0xAF, 0xC9, 0x5A,
+    0xFF, 0xF9, 0x59, 0xD1, 0xAF, 0xD9, 0x70, 0xA7, 0x72, 0x77, 0x71, 0xCA, 0x77, 0xAE, 0x76, 0x9F,
+    0x77, 0xAE, 0x77, 0x09, 0xA7, 0x77, 0x29, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE,
+    0x2F, 0xE9, 0x9F, 0xD9, 0x2A, 0xFA, 0x92, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA,
+    0x3A, 0xE6, 0xE9, 0x3F, 0x6E, 0x4F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE,
+    0x6E, 0x4F, 0x59, 0xE4, 0xF5, 0xEA, 0x4A, 0xEA, 0x3A, 0xE5, 0x9F, 0xFE, 0xA6, 0xFF, 0xDA, 0x70,
+    0xAF, 0xDA, 0x77, 0x73, 0x77, 0x76, 0xAC, 0x76, 0x9E, 0x75, 0xFC, 0x74, 0xFA, 0x75, 0xAA, 0x77,
+    0x74, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD, 0x92, 0xAF,
+    0xA9, 0x2F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93, 0xF6, 0xE4,
+    0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E, 0x4F, 0x5E,
+    0xA4, 0xAE, 0xA3, 0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77, 0x30, 0x77,
+    0x73, 0x9D, 0x97, 0x59, 0xF7, 0x4A, 0xDA, 0xE7, 0x2A, 0xDA, 0x1D, 0x97, 0x1D, 0x92, 0x9A, 0x77,
+    0x70, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD, 0x92, 0xAF,
+    0xA9, 0x2F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93, 0xF6, 0xE4,
+    0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E, 0x4F, 0x5E,
+    0xA4, 0xAE, 0xA3, 0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77, 0x30, 0x77,
+    0x71, 0xD9, 0x09, 0xD9, 0x71, 0xEA, 0x0E, 0xA7, 0x1E, 0x90, 0xE7, 0x39, 0x39, 0x77, 0x71, 0x99,
+    0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD, 0x92, 0xAF, 0xA9, 0x2F,
+    0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93, 0xF6, 0xE4, 0xF5, 0x9E,
+    0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E, 0x4F, 0x5E, 0xA4, 0xAE,
+    0xA3, 0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77, 0x30, 0x77, 0x74, 0x9C,
+    0x76, 0xE9, 0x73, 0x9F, 0x97, 0x2A, 0xEA, 0x74, 0xAA, 0x97, 0x77, 0x29, 0x99, 0x99, 0x99, 0x29,
+    0x99, 0x99, 0x90, 0x9F, 0xE1, 0xFE, 0x1F, 0xCA, 0x29, 0xFA, 0x3F, 0x4E, 0x94, 0xAE, 0x3A, 0xDA,
+    0x6E, 0x92, 0xE7, 0xF1, 0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x1E, 0xAD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F,
+    0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xF7, 0x3F, 0xEA, 0x70, 0xAF, 0xE9, 0x70,
+    0x39, 0x99, 0x99, 0x99, 0x79, 0xFE, 0xA7, 0xAF, 0xC9, 0x71, 0xAE, 0x73, 0xFE, 0xA7, 0xFF, 0xCA,
+    0x49, 0xE9, 0x09, 0xF4, 0xAE, 0x29, 0xEA, 0x3A, 0xE3, 0xEA, 0x3F, 0x3E, 0x93, 0xEA, 0x2A, 0xE3,
+    0x9E, 0x91, 0xAE, 0x93, 0xAE, 0xAA, 0xFA, 0x4F, 0xFA, 0x6F, 0xAA, 0x97, 0x9E, 0xA7, 0x09, 0xFE,
+    0x96, 0xAF, 0xE7, 0x75, 0x99, 0xA9, 0x76, 0xAF, 0xD9, 0x73, 0xFF, 0xC7, 0x2A, 0xDA, 0x2E, 0x72,
+    0xE3, 0xE7, 0x1A, 0xDA, 0x3E, 0x71, 0xE9, 0x2A, 0xD7, 0x2E, 0x29, 0xD9, 0x71, 0x9E, 0x2D, 0xA7,
+    0x2A, 0xDA, 0x1E, 0x73, 0xE9, 0x09, 0xE7, 0x3E, 0x19, 0xEA, 0x71, 0x9E, 0x2A, 0xEA, 0x70, 0x9E,
+    0x3A, 0xE9, 0x7A, 0xDA, 0x4F, 0x7E, 0x94, 0x9E, 0x7E, 0x1C, 0x3E, 0x69, 0xE0, 0xAD, 0xA9, 0xAD,
+    0xA6, 0xAD, 0xA0, 0xFE, 0xA7, 0xE9, 0x1F, 0xC9, 0x70, 0xE7, 0x70, 0x9E, 0x74, 0xA9, 0x1A, 0xDA,
+    0x73, 0x9D, 0xAA, 0xE7, 0x49, 0xFD, 0x97, 0x5A, 0xEA, 0x76, 0x59, 0xA7, 0x4D, 0x97, 0x3E, 0x73,
+    0xAE, 0x73, 0x9D, 0x97, 0x39, 0xC9, 0x77, 0x71, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E,
+    0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F,
+    0x3E, 0x2A, 0xEA, 0x3E, 0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1,
+    0x9E, 0xA2, 0xEA, 0x77, 0x00, 0x77, 0x71, 0xCA, 0x73, 0xAD, 0x72, 0x9E, 0x72, 0xE7, 0x29, 0xD7,
+    0x4A, 0x77, 0x72, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD,
+    0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E, 0x90,
+    0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77, 0x00,
+    0x70, 0x99, 0x73, 0xE9, 0x71, 0xFC, 0x70, 0xAD, 0x9D, 0x96, 0xAD, 0x1A, 0xD6, 0xD3, 0xC9, 0x77,
+    0x79, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E,
+    0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA,
+    0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x69, 0x92, 0x97,
+    0xF0, 0x9C, 0x95, 0xFF, 0x6D, 0x1E, 0xA7, 0x39, 0x77, 0x71, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF,
+    0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3,
+    0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E, 0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD,
+    0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77, 0x00, 0x77, 0x4D, 0x90, 0x9D, 0x6E, 0xA0, 0xE9, 0x5E, 0x1E,
+    0x79, 0x39, 0x77, 0x70, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2,
+    0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E,
+    0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77,
+    0x00, 0x7A, 0xD9, 0x71, 0xFC, 0x70, 0xAC, 0x1A, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x99, 0xD7, 0x09,
+    0xF9, 0x72, 0x99, 0x73, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2,
+    0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E,
+    0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77,
+    0x00, 0x69, 0x95, 0x99, 0x7A, 0xFA, 0x90, 0xFC, 0x94, 0xFF, 0xFE, 0x3E, 0xA1, 0x9E, 0xA1, 0xE2,
+    0xAE, 0x29, 0xE2, 0xE2, 0xE3, 0xE9, 0x1A, 0xD9, 0x1A, 0xE3, 0xE1, 0xAD, 0xA2, 0xEA, 0x2A, 0xEA,
+    0xE9, 0x3E, 0x92, 0xFD, 0xA5, 0xE2, 0xFC, 0x93, 0x92, 0xE9, 0x0A, 0xFC, 0x3D, 0x2F, 0xAD, 0x9E,
+    0xAA, 0xAE, 0x2F, 0xD1, 0xFF, 0x4E, 0xA3, 0xAF, 0x97, 0x77, 0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xEA,
+    0x9A, 0xD2, 0xEA, 0x29, 0x29, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x96, 0x9E, 0x97, 0xEA, 0x2A, 0xC2,
+    0xFF, 0xC2, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x2A, 0xCA, 0x70, 0xEA, 0x70, 0xAC, 0xA7, 0x9D, 0x7A,
+    0xD9, 0x7A, 0x97, 0x49, 0xA7, 0x1D, 0x97, 0x0E, 0x70, 0xAE, 0x70, 0x9D, 0x97, 0x09, 0xC9, 0x77,
+    0x59, 0x7A, 0xFA, 0x4F, 0xE3, 0xE1, 0xE9, 0x1E, 0x2E, 0x19, 0xDA, 0x19, 0xDA, 0x1A, 0xD1, 0xAD,
+    0xA2, 0xEA, 0xEA, 0x3F, 0xCA, 0x49, 0xE9, 0x39, 0x2E, 0x3A, 0xC9, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE,
+    0x93, 0xAF, 0xA7, 0x70, 0x77, 0x6C, 0xA7, 0x1A, 0xD7, 0x09, 0xE7, 0x0E, 0x70, 0x9D, 0x72, 0xA7,
+    0x77, 0x09, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0x9D, 0xA2, 0xAD,
+    0x1A, 0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5, 0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92, 0xFA, 0xAE, 0x92,
+    0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x79, 0x97, 0x0E, 0x96, 0xFC, 0x5A, 0xD9, 0xD9, 0x3A, 0xD1,
+    0xAD, 0x3D, 0x3C, 0x97, 0x73, 0x97, 0xAF, 0xA4, 0xFE, 0x3E, 0x1E, 0x91, 0xE2, 0xE1, 0x9D, 0xA1,
+    0x9D, 0xA1, 0xAD, 0x1A, 0xDA, 0x2E, 0xAE, 0xA3, 0xFC, 0xA4, 0x9E, 0x93, 0x92, 0xE3, 0xAC, 0x91,
+    0xFA, 0xAE, 0x91, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x77, 0x1D, 0x90, 0x9D, 0x4E, 0xA0, 0xE9, 0x3E,
+    0x1E, 0x59, 0x39, 0x77, 0x69, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1,
+    0x9D, 0xA2, 0xAD, 0x1A, 0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5, 0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92,
+    0xFA, 0xAE, 0x92, 0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x29, 0xA5, 0xD9, 0x39, 0xE4, 0xAD, 0xA4,
+    0xAD, 0x94, 0x9C, 0x97, 0x49, 0x29, 0xFA, 0x1F, 0xCA, 0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E,
+    0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x0A, 0x1F, 0xD9, 0x0F, 0xD1, 0xAE, 0xA7, 0x10, 0x77, 0x2C, 0xA7,
+    0xE6, 0x9E, 0x6E, 0x6A, 0xD7, 0x0A, 0x77, 0x39, 0x59, 0xFA, 0x4F, 0xCA, 0x6E, 0x96, 0xE6, 0x9E,
+    0x6A, 0xDA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x0A, 0x4F, 0xD9, 0x3F, 0xD4, 0xAE, 0xA7, 0x70,
+    0x59, 0x96, 0xE9, 0x4F, 0xC3, 0xAD, 0x9D, 0x91, 0xAD, 0x1A, 0xCA, 0x1D, 0x3C, 0x97, 0x69, 0x49,
+    0xFA, 0x3F, 0xCA, 0x5E, 0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x0A,
+    0x3F, 0xD9, 0x2F, 0xD3, 0xAE, 0xA7, 0x50, 0x74, 0x9D, 0x90, 0x9D, 0x2E, 0xA0, 0xE9, 0x1E, 0x1E,
+    0x39, 0x39, 0x77, 0x19, 0x59, 0xFA, 0x4F, 0xCA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0x96,
+    0xE6, 0x9E, 0x6A, 0xDA, 0x0A, 0x4F, 0xD9, 0x3F, 0xD4, 0xAE, 0xA7, 0x70, 0x77, 0x39, 0xC9, 0x1C,
+    0x69, 0xEA, 0xD9, 0x69, 0xF7, 0x09, 0xF7, 0x9F, 0xCA, 0x7A, 0x1E, 0x72, 0xAD, 0x95, 0xAF, 0xDA,
+    0x4F, 0xFC, 0x3F, 0xAA, 0xF2, 0xF2, 0xAE, 0x19, 0xE3, 0x9E, 0x1E, 0xA3, 0x9E, 0x1E, 0x93, 0xAD,
+    0xA1, 0xE4, 0xE9, 0x09, 0xE3, 0x9E, 0x2E, 0x92, 0xE9, 0x2F, 0xAA, 0xEA, 0x39, 0xFF, 0x59, 0xFC,
+    0xA7, 0x72, 0x6A, 0x92, 0x96, 0x9F, 0x0A, 0xC9, 0x5F, 0xF6, 0xD1, 0xE9, 0x73, 0x97, 0x77, 0x94,
+    0x93, 0x9F, 0x91, 0xF2, 0xFC, 0xA9, 0xFC, 0xA3, 0xEA, 0xDA, 0xEA, 0x3F, 0xC1, 0xAD, 0xA3, 0xF9,
+    0x1E, 0x92, 0x9E, 0xA2, 0xE3, 0xAE, 0x29, 0xE3, 0xEA, 0x2E, 0xA3, 0xE9, 0x2E, 0x92, 0x9E, 0x29,
+    0xE0, 0x99, 0x09, 0xE2, 0x9F, 0xCA, 0x0A, 0xE2, 0xAF, 0xC9, 0x0E, 0x93, 0xEA, 0x77, 0x00, 0x6A,
+    0x72, 0xD9, 0x71, 0xE7, 0x1A, 0xE7, 0x19, 0xDA, 0x72, 0xC9, 0x77, 0x59, 0x97, 0x0A, 0xFC, 0x93,
+    0x9F, 0xF2, 0x9E, 0xA0, 0x9E, 0xA1, 0xEA, 0x2F, 0x09, 0xE3, 0xAE, 0x0E, 0xA3, 0xAE, 0x0E, 0x93,
+    0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x92, 0x9E, 0x1E, 0x92, 0xE9, 0x1F, 0x99, 0xF2, 0x9F, 0xEA, 0x49,
+    0xFC, 0x97, 0x70, 0x77, 0x70, 0xCA, 0x72, 0xAD, 0x71, 0x9E, 0x71, 0xE7, 0x19, 0xD7, 0x3A, 0x77,
+    0x70, 0x99, 0x71, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xEA, 0x09, 0xEA, 0x2E, 0xA2, 0xF1, 0x9E, 0x3A,
+    0xE1, 0xEA, 0x3A, 0xE1, 0xE9, 0x3E, 0xA1, 0xE9, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x2E, 0x92, 0xE9,
+    0x2F, 0x99, 0xF3, 0x9F, 0xEA, 0x59, 0xFC, 0x97, 0x72, 0x70, 0x99, 0x71, 0xE9, 0x7A, 0xF6, 0xAD,
+    0x9D, 0x94, 0x9D, 0x19, 0xD4, 0xD9, 0x2C, 0xA7, 0x73, 0x99, 0x70, 0xAF, 0xC9, 0x39, 0xFF, 0x29,
+    0xEA, 0x09, 0xEA, 0x1E, 0xA2, 0xF0, 0x9E, 0x3A, 0xE0, 0xEA, 0x3A, 0xE0, 0xE9, 0x3E, 0xA0, 0xE9,
+    0x3E, 0x99, 0xE9, 0x29, 0xE1, 0xE9, 0x2E, 0x91, 0xF9, 0x9F, 0x29, 0xFE, 0xA4, 0x9F, 0xC9, 0x77,
+    0x00, 0x69, 0x92, 0x96, 0xF0, 0x9C, 0xA4, 0xAF, 0xE9, 0x4A, 0xC1, 0xEA, 0x72, 0x97, 0x77, 0x99,
+    0x71, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xEA, 0x09, 0xEA, 0x2E, 0xA2, 0xF1, 0x9E, 0x3A, 0xE1, 0xEA,
+    0x3A, 0xE1, 0xE9, 0x3E, 0xA1, 0xE9, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x2E, 0x92, 0xE9, 0x2F, 0x99,
+    0xF3, 0x9F, 0xEA, 0x59, 0xFC, 0x97, 0x72, 0x77, 0x3D, 0x90, 0x9D, 0x94, 0xAD, 0xA0, 0xE9, 0x4A,
+    0xD1, 0xE6, 0x93, 0x97, 0x76, 0x99, 0x71, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xEA, 0x09, 0xEA, 0x2E,
+    0xA2, 0xF1, 0x9E, 0x3A, 0xE1, 0xEA, 0x3A, 0xE1, 0xE9, 0x3E, 0xA1, 0xE9, 0x3E, 0x90, 0x9E, 0x92,
+    0x9E, 0x2E, 0x92, 0xE9, 0x2F, 0x99, 0xF3, 0x9F, 0xEA, 0x59, 0xFC, 0x97, 0x72, 0x77, 0xAD, 0x97,
+    0xEA, 0x7E, 0x97, 0x09, 0x59, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xFF, 0xD9, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA7, 0x70, 0xAD, 0x70, 0xEA, 0x7E, 0x97, 0x09, 0x50, 0x70, 0x99, 0x39, 0x7A, 0xFC,
+    0x0A, 0xC9, 0x49, 0xFF, 0xCA, 0x49, 0xEA, 0x09, 0xEA, 0x5E, 0x92, 0xF4, 0x9E, 0x2F, 0xC4, 0xE9,
+    0x1D, 0xAE, 0x4E, 0x09, 0xD0, 0xAD, 0xA4, 0xEA, 0xD1, 0xE9, 0x39, 0xFA, 0x19, 0xE5, 0xEA, 0x2E,
+    0x95, 0xF0, 0x9F, 0x5F, 0xFC, 0xA5, 0xD0, 0x9F, 0xC9, 0x69, 0x76, 0x59, 0x97, 0x4D, 0x73, 0x9E,
+    0x73, 0xEA, 0x73, 0xAD, 0x97, 0x39, 0xC7, 0x77, 0x97, 0x2A, 0xF9, 0x29, 0xE0, 0x9F, 0xCA, 0x2E,
+    0xA3, 0xE9, 0x2E, 0x93, 0xE3, 0xE3, 0x9E, 0x29, 0xE3, 0xAD, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E,
+    0x2A, 0xE3, 0x9E, 0x19, 0xF3, 0xAD, 0xA0, 0x9F, 0xC0, 0x9A, 0x0F, 0xAD, 0x0F, 0xD0, 0xFD, 0x1F,
+    0xC1, 0x9F, 0x2A, 0xDA, 0x77, 0x00, 0x77, 0x70, 0x9C, 0x97, 0x3E, 0x72, 0xAD, 0xA7, 0x2E, 0x72,
+    0xAD, 0x73, 0x9A, 0x77, 0x79, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9,
+    0x3E, 0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1,
+    0x9F, 0x3A, 0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD,
+    0xA7, 0x70, 0x70, 0x99, 0x73, 0xE7, 0x2F, 0xC7, 0x0E, 0x9D, 0x7A, 0xD1, 0xAC, 0xA5, 0x9D, 0x3C,
+    0x97, 0x74, 0x97, 0x2A, 0xF9, 0x29, 0xE0, 0x9F, 0xCA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE3, 0xE3,
+    0x9E, 0x29, 0xE3, 0xAD, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x2A, 0xE3, 0x9E, 0x19, 0xF3, 0xAD,
+    0xA0, 0x9F, 0xC0, 0x9A, 0x0F, 0xAD, 0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0x9F, 0x2A, 0xDA, 0x77, 0x00,
+    0x77, 0x39, 0xD1, 0xAD, 0x6E, 0x90, 0xE6, 0xE1, 0xDA, 0x79, 0x77, 0x72, 0x97, 0x2A, 0xF9, 0x29,
+    0xE0, 0x9F, 0xCA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE3, 0xE3, 0x9E, 0x29, 0xE3, 0xAD, 0xA2, 0xEA,
+    0x3E, 0x92, 0xE9, 0x3E, 0x2A, 0xE3, 0x9E, 0x19, 0xF3, 0xAD, 0xA0, 0x9F, 0xC0, 0x9A, 0x0F, 0xAD,
+    0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0x9F, 0x2A, 0xDA, 0x77, 0x00, 0x77, 0x75, 0xD7, 0x59, 0xD9, 0x74,
+    0xE7, 0x4A, 0xD9, 0x74, 0xD9, 0x75, 0xA7, 0x77, 0x73, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2,
+    0xEA, 0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD, 0xA6, 0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0,
+    0x9D, 0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0, 0xD9, 0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E,
+    0xA7, 0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E, 0x79, 0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30,
+    0x79, 0x97, 0x3A, 0xFA, 0x71, 0x9F, 0xCA, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xE7, 0x4A, 0xD9, 0x29,
+    0x70, 0xE1, 0xF9, 0x6E, 0x0F, 0xD5, 0x9D, 0xAD, 0xAF, 0x5A, 0xF9, 0x09, 0xE5, 0xF9, 0x19, 0xE5,
+    0xF2, 0x9E, 0x5E, 0x92, 0xAD, 0xA4, 0x9E, 0x3E, 0x94, 0xAD, 0xA2, 0x9E, 0x5E, 0x92, 0xE9, 0x5F,
+    0x99, 0xF5, 0x9F, 0xFC, 0x6A, 0xFE, 0xA7, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0xAE, 0xA9, 0x71,
+    0xFE, 0xA7, 0x0A, 0xAA, 0xAA, 0xAA, 0x70, 0x77, 0x70, 0xAC, 0xA1, 0xD9, 0x79, 0xE0, 0xAD, 0xA7,
+    0xAD, 0x90, 0xAD, 0x71, 0x93, 0x97, 0x77, 0x71, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA,
+    0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD, 0xA6, 0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D,
+    0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0, 0xD9, 0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7,
+    0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E, 0x79, 0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x71,
+    0x99, 0x99, 0x99, 0x97, 0x3A, 0xFE, 0x73, 0xFF, 0x77, 0x77, 0x77, 0x69, 0xAA, 0x77, 0xAE, 0x76,
+    0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90,
+    0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6,
+    0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA,
+    0x2A, 0xFE, 0x90, 0x49, 0xFE, 0x6F, 0xF7, 0x99, 0x99, 0x99, 0x97, 0x77, 0x97, 0x3F, 0xA9, 0xDA,
+    0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA,
+    0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E, 0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC,
+    0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77, 0x00, 0x71, 0xA4, 0x97, 0x3A, 0xCA, 0x29, 0xC7,
+    0x3A, 0xEA, 0xDA, 0x74, 0xFC, 0xA7, 0x69, 0x99, 0x77, 0x77, 0x59, 0xAA, 0x77, 0xAE, 0x76, 0x9F,
+    0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E,
+    0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9,
+    0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A,
+    0xFE, 0x90, 0x59, 0x74, 0x9C, 0xA3, 0xC6, 0xAD, 0xA9, 0xAD, 0x7F, 0xD7, 0x1A, 0xCA, 0xA7, 0x77,
+    0x19, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E,
+    0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA,
+    0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x73, 0x9A, 0xA7,
+    0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7,
+    0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6,
+    0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE,
+    0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x75, 0xAC, 0x97, 0x7D, 0x97, 0x7A, 0xD7, 0x70, 0xAE, 0xAA, 0x76,
+    0xF9, 0x77, 0x09, 0x30, 0x69, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE,
+    0x2A, 0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3,
+    0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7,
+    0x3C, 0xA7, 0x3D, 0x73, 0x9D, 0x73, 0x9D, 0xAA, 0x72, 0xF7, 0x70, 0x77, 0x75, 0xAC, 0x74, 0x9E,
+    0x73, 0xAF, 0x72, 0xFA, 0x73, 0xAA, 0x97, 0x77, 0x59, 0xAA, 0xCA, 0xA7, 0x0A, 0xFF, 0xC5, 0xFF,
+    0xE4, 0xFA, 0x3E, 0x3F, 0x94, 0xDA, 0x2A, 0xE9, 0x5D, 0x3F, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7,
+    0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xFA, 0x6C, 0x92, 0xAF, 0xA3, 0x9D, 0xA3, 0xFF, 0xF4, 0x9F, 0xFD,
+    0x96, 0xAF, 0xDA, 0x77, 0x50, 0x77, 0x6C, 0xA7, 0x1A, 0xD7, 0x09, 0xE7, 0x0E, 0x70, 0x9D, 0x72,
+    0xA7, 0x77, 0x09, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0xA9, 0xAD, 0x3E, 0xA2, 0x93, 0x9E, 0x70, 0xAD,
+    0xA7, 0x0E, 0x97, 0x0E, 0x97, 0x9E, 0x97, 0x0E, 0xA2, 0xAC, 0x3F, 0xFC, 0x3A, 0xFE, 0x94, 0xAF,
+    0xA7, 0x71, 0x77, 0x72, 0x9D, 0x97, 0x39, 0xF9, 0x71, 0x9D, 0xAE, 0x70, 0xAD, 0xA1, 0xDA, 0x7D,
+    0x93, 0xC7, 0x77, 0x29, 0xAA, 0xCA, 0xA7, 0x0A, 0xFF, 0xC5, 0xFF, 0xE4, 0xFA, 0x3E, 0x3F, 0x94,
+    0xDA, 0x2A, 0xE9, 0x5D, 0x3F, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74,
+    0xFA, 0x6C, 0x92, 0xAF, 0xA3, 0x9D, 0xA3, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0xAF, 0xDA, 0x77, 0x50,
+    0x79, 0x97, 0x0E, 0x96, 0xFC, 0x5A, 0xD9, 0xD9, 0x3A, 0xD1, 0xAD, 0x3D, 0x3C, 0x97, 0x73, 0x97,
+    0xAF, 0xA4, 0xFE, 0x3E, 0xA9, 0xAD, 0x2E, 0xA2, 0x92, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE9, 0x69,
+    0xE9, 0x7E, 0xA2, 0xAC, 0x2F, 0xFC, 0x2A, 0xFE, 0x93, 0xAF, 0xA7, 0x70, 0x72, 0x99, 0x75, 0xE7,
+    0x49, 0xE7, 0x49, 0xDA, 0x75, 0x99, 0x77, 0x75, 0x9A, 0xAC, 0xAA, 0x70, 0xAF, 0xFC, 0x5F, 0xFE,
+    0x4F, 0xA3, 0xE3, 0xF9, 0x4D, 0xA2, 0xAE, 0x95, 0xD3, 0xF7, 0x39, 0xE9, 0x73, 0xF7, 0x4F, 0x74,
+    0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0xA6, 0xC9, 0x2A, 0xFA, 0x39, 0xDA, 0x3F, 0xFF, 0x49, 0xFF, 0xD9,
+    0x6A, 0xFD, 0xA7, 0x75, 0x79, 0x97, 0x0E, 0x7A, 0xE7, 0xAD, 0x97, 0x09, 0x77, 0x79, 0x7A, 0xFA,
+    0x4F, 0xE3, 0xEA, 0x9A, 0xD2, 0xEA, 0x29, 0x29, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x96, 0x9E, 0x97,
+    0xEA, 0x2A, 0xC2, 0xFF, 0xC2, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x77, 0x7A, 0xC3, 0x9D, 0x7A, 0xD1,
+    0xAD, 0x97, 0x0E, 0xAD, 0x97, 0x19, 0xF7, 0x49, 0xD7, 0x77, 0x59, 0xAA, 0xCA, 0xA7, 0x0A, 0xFF,
+    0xC5, 0xFF, 0xE4, 0xFA, 0x3E, 0x3F, 0x94, 0xDA, 0x2A, 0xE9, 0x5D, 0x3F, 0x73, 0x9E, 0x97, 0x3F,
+    0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F, 0x74, 0xFA, 0x6C, 0x92, 0xAF, 0xA3, 0x9D, 0xA3, 0xFF, 0xF4,
+    0x9F, 0xFD, 0x96, 0xAF, 0xDA, 0x77, 0x50, 0x4A, 0x92, 0x9C, 0x93, 0x9D, 0x1A, 0xD5, 0xD9, 0x9D,
+    0x6A, 0xF9, 0x7E, 0xA7, 0x09, 0xAA, 0x77, 0x70, 0x97, 0x0A, 0xFA, 0x5F, 0xE4, 0xEA, 0x9A, 0xD3,
+    0xEA, 0x29, 0x39, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xE9, 0x70, 0xEA, 0x2A, 0xC3,
+    0xFF, 0xC3, 0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x77, 0x72, 0xD3, 0xAD, 0x71, 0xDA, 0x1E, 0x72,
+    0x9D, 0xAE, 0x74, 0xAF, 0x76, 0xAC, 0xA7, 0x77, 0x59, 0xAA, 0xAC, 0xAA, 0xA9, 0x7A, 0xFF, 0xE9,
+    0x49, 0xFF, 0xFC, 0xA4, 0x90, 0xAE, 0x2A, 0xF9, 0x5F, 0x3A, 0xF5, 0xEA, 0x4F, 0x49, 0xE9, 0x4A,
+    0xE9, 0x3A, 0xE5, 0x9E, 0xA3, 0xAE, 0x59, 0xE9, 0x3F, 0x5A, 0xE9, 0x3E, 0xA5, 0xAE, 0x39, 0xE9,
+    0x5F, 0x3A, 0xE5, 0x9E, 0x93, 0xF5, 0xF4, 0xEA, 0x39, 0xF4, 0x9F, 0x9A, 0xAF, 0xC9, 0x29, 0xFF,
+    0xFA, 0x4A, 0xFF, 0xCA, 0x97, 0x77, 0x10, 0x73, 0x97, 0x6A, 0xF9, 0x0A, 0xCA, 0x79, 0xFC, 0x90,
+    0xDA, 0x72, 0xE9, 0x0D, 0x73, 0xE0, 0x9C, 0xA7, 0x29, 0xE0, 0xAC, 0x70, 0x91, 0xAD, 0xA0, 0x99,
+    0x6F, 0xAE, 0x97, 0x9F, 0xFC, 0x70, 0xEA, 0x09, 0xF7, 0xAE, 0x2A, 0xDA, 0x7E, 0x3E, 0x96, 0xAE,
+    0x3E, 0x7E, 0xA2, 0xAE, 0x7E, 0x92, 0xEA, 0x7E, 0x2A, 0xEA, 0x7E, 0x90, 0xAC, 0xAD, 0xA0, 0xA5,
+    0xFA, 0xD9, 0xFC, 0x94, 0xFD, 0x1F, 0xA5, 0x9E, 0xA2, 0xEA, 0x77, 0x70, 0x49, 0xAA, 0xAC, 0xAA,
+    0xA9, 0x7A, 0xFF, 0xE9, 0x49, 0xFF, 0xFC, 0xA4, 0x90, 0xAE, 0x2A, 0xF9, 0x5F, 0x3A, 0xF5, 0xEA,
+    0x4F, 0x49, 0xE9, 0x4A, 0xE9, 0x3A, 0xE5, 0x9E, 0xA0, 0x9A, 0xAF, 0xAA, 0xA2, 0x9E, 0x90, 0xAF,
+    0xFC, 0x2A, 0xE9, 0x29, 0xEA, 0x5A, 0xE3, 0x9E, 0x95, 0xF3, 0xAE, 0x59, 0xE9, 0x3F, 0x5F, 0x4E,
+    0xA3, 0x9F, 0x49, 0xF9, 0xAA, 0xFC, 0x92, 0x9F, 0xFF, 0xA4, 0xAF, 0xFC, 0xA9, 0x77, 0x71, 0x73,
+    0x97, 0x4A, 0xF9, 0x71, 0x9F, 0xC9, 0x74, 0xE7, 0x2A, 0xAA, 0xEA, 0xA7, 0xAF, 0xF7, 0x2A, 0xDA,
+    0x79, 0xE9, 0xE9, 0x6A, 0xFF, 0x6F, 0x9A, 0xF5, 0xAE, 0x2A, 0xDA, 0x5E, 0x92, 0xE9, 0x4A, 0xE3,
+    0xE5, 0xEA, 0x2A, 0xE5, 0xE9, 0x2E, 0xA5, 0xE2, 0xAE, 0xA4, 0x9E, 0x90, 0xAC, 0xAD, 0xA0, 0xA3,
+    0xFA, 0xD9, 0xFC, 0x92, 0xFD, 0x1F, 0xA3, 0x9E, 0xA2, 0xEA, 0x77, 0x40, 0x79, 0x99, 0x99, 0x99,
+    0x70, 0x9F, 0xEA, 0x79, 0xFE, 0x97, 0x77, 0x76, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF,
+    0xF9, 0x3A, 0xFF, 0xE9, 0x4A, 0xE3, 0x9D, 0x5F, 0x39, 0xD5, 0xEA, 0x39, 0xC9, 0x49, 0xE9, 0x73,
+    0xAE, 0x74, 0xAF, 0xFA, 0x6F, 0xFC, 0x96, 0xEA, 0x99, 0x99, 0x96, 0x9E, 0x97, 0x3A, 0xE5, 0x95,
+    0xF4, 0xAC, 0x94, 0xEA, 0x4D, 0x93, 0x9E, 0xA9, 0x99, 0x9E, 0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xF9,
+    0x20, 0x39, 0xFE, 0x4F, 0xF5, 0x99, 0x99, 0x99, 0x97, 0x75, 0x97, 0x0A, 0xFA, 0x5F, 0xE4, 0xE1,
+    0xE9, 0x2E, 0x2E, 0x29, 0xDA, 0x19, 0xDA, 0x2A, 0xD1, 0xAD, 0xA3, 0xEA, 0xEA, 0x4F, 0xCA, 0x59,
+    0xE9, 0x39, 0x3E, 0x3A, 0xC9, 0x2F, 0xAA, 0xE9, 0x2A, 0xFE, 0x94, 0xAF, 0xA7, 0x71, 0x79, 0x94,
+    0x97, 0x9D, 0x29, 0xC9, 0x70, 0xFE, 0x71, 0xAF, 0xC7, 0x49, 0x99, 0x77, 0x70, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x39, 0xFF, 0xF9, 0x3A, 0xFF, 0xE9, 0x4A, 0xE3, 0x9D, 0x5F, 0x39, 0xD5, 0xEA,
+    0x39, 0xC9, 0x49, 0xE9, 0x73, 0xAE, 0x74, 0xAF, 0xFA, 0x6F, 0xFC, 0x96, 0xEA, 0x99, 0x99, 0x96,
+    0x9E, 0x97, 0x3A, 0xE5, 0x95, 0xF4, 0xAC, 0x94, 0xEA, 0x4D, 0x93, 0x9E, 0xA9, 0x99, 0x9E, 0x29,
+    0xFF, 0xFC, 0x2A, 0xFF, 0xF9, 0x20, 0x49, 0x72, 0x9C, 0xA3, 0xC4, 0xAD, 0xA9, 0xAD, 0x5F, 0xD7,
+    0xAC, 0xAA, 0x77, 0x79, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0x9D,
+    0xA2, 0xAD, 0x1A, 0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5, 0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92, 0xFA,
+    0xAE, 0x92, 0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x72, 0x99, 0x75, 0xE9, 0x73, 0x9E, 0x97, 0x39,
+    0xE7, 0x59, 0x97, 0x77, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE,
+    0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF,
+    0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E,
+    0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x79, 0x97, 0x0E,
+    0x7A, 0xE7, 0xAD, 0x97, 0x09, 0x77, 0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xE1, 0xE9, 0x1E, 0x2E, 0x19,
+    0xDA, 0x19, 0xDA, 0x1A, 0xD1, 0xAD, 0xA2, 0xEA, 0xEA, 0x3F, 0xCA, 0x49, 0xE9, 0x39, 0x2E, 0x3A,
+    0xC9, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE, 0x93, 0xAF, 0xA7, 0x70, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94,
+    0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73,
+    0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2,
+    0xAF, 0xFF, 0x97, 0x4A, 0xC9, 0x74, 0xD9, 0x74, 0x9D, 0x75, 0x9E, 0xAA, 0x73, 0xF9, 0x75, 0x94,
+    0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xE1, 0xE9, 0x1E, 0x2E, 0x19, 0xDA, 0x19, 0xDA, 0x1A, 0xD1, 0xAD,
+    0xA2, 0xEA, 0xEA, 0x3F, 0xCA, 0x49, 0xE9, 0x39, 0x2E, 0x3A, 0xC9, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE,
+    0x93, 0xAF, 0xC7, 0x0A, 0xC7, 0x09, 0xC9, 0x70, 0xD7, 0x1D, 0xAA, 0x96, 0xAE, 0x97, 0x09, 0x40,
+    0x77, 0x7A, 0xC9, 0x29, 0xD9, 0x6A, 0xD1, 0xAD, 0x97, 0x0E, 0xAD, 0x97, 0x19, 0xF9, 0x73, 0x9D,
+    0x97, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE,
+    0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF,
+    0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9,
+    0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x4A, 0x92, 0x9C, 0x93, 0x9D,
+    0x1A, 0xD5, 0xD9, 0x9D, 0x6A, 0xF9, 0x7E, 0xA7, 0x09, 0xAA, 0x77, 0x70, 0x97, 0x0A, 0xFA, 0x5F,
+    0xE4, 0xE1, 0xE9, 0x2E, 0x2E, 0x29, 0xDA, 0x19, 0xDA, 0x2A, 0xD1, 0xAD, 0xA3, 0xEA, 0xEA, 0x4F,
+    0xCA, 0x59, 0xE9, 0x39, 0x3E, 0x3A, 0xC9, 0x2F, 0xAA, 0xE9, 0x2A, 0xFE, 0x94, 0xAF, 0xA7, 0x71,
+    0x77, 0x74, 0xE7, 0x5F, 0xA7, 0x3E, 0xAD, 0x97, 0x09, 0xE1, 0xAD, 0x70, 0xAC, 0xA3, 0xAA, 0x77,
+    0x73, 0x9A, 0xAC, 0xAA, 0x97, 0x09, 0xFF, 0xCA, 0x5F, 0xFF, 0x4F, 0xA4, 0xDA, 0x3F, 0x95, 0xD9,
+    0x2A, 0xE9, 0x6D, 0x3F, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF4, 0x99, 0x99, 0x99, 0x91, 0xF4, 0xFE,
+    0x1F, 0x4A, 0xFC, 0x91, 0xF6, 0xEA, 0x2F, 0xA5, 0xEA, 0x2A, 0xF9, 0x4E, 0x93, 0xFD, 0xA9, 0xAF,
+    0x5F, 0xFF, 0x69, 0xFE, 0xA9, 0x77, 0x50, 0x72, 0x99, 0x75, 0xAE, 0x73, 0x9F, 0x97, 0x2D, 0xAA,
+    0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xCA, 0x29, 0xC7, 0x77, 0x39, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xEA,
+    0xFD, 0x93, 0x9E, 0x2E, 0x6E, 0x92, 0xE6, 0xE2, 0x9E, 0x6E, 0x2E, 0xA6, 0xAD, 0xA9, 0xF7, 0x0A,
+    0xFC, 0x97, 0x19, 0xE9, 0x72, 0x9D, 0xA7, 0x4A, 0xEA, 0x73, 0xAF, 0xCA, 0x7F, 0xAF, 0xCA, 0x4E,
+    0x92, 0x9F, 0x92, 0xAD, 0xA5, 0xEA, 0x2A, 0xDA, 0x5E, 0x92, 0x9F, 0x99, 0x9A, 0xEA, 0x4A, 0xFF,
+    0xCA, 0x7A, 0xFA, 0x96, 0x70, 0xA4, 0x97, 0x1D, 0x92, 0xAC, 0x71, 0xFE, 0x97, 0x19, 0xFC, 0x97,
+    0x49, 0xA9, 0x77, 0x76, 0x9A, 0xAC, 0xAA, 0x97, 0x09, 0xFF, 0xCA, 0x5F, 0xFF, 0x4F, 0xA4, 0xDA,
+    0x3F, 0x95, 0xD9, 0x2A, 0xE9, 0x6D, 0x3F, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF4, 0x99, 0x99, 0x99,
+    0x91, 0xF4, 0xFE, 0x1F, 0x4A, 0xFC, 0x91, 0xF6, 0xEA, 0x2F, 0xA5, 0xEA, 0x2A, 0xF9, 0x4E, 0x93,
+    0xFD, 0xA9, 0xAF, 0x5F, 0xFF, 0x69, 0xFE, 0xA9, 0x77, 0x50, 0x70, 0x97, 0x6D, 0x3A, 0xA7, 0x0E,
+    0x99, 0xD9, 0x70, 0xAF, 0xCA, 0x72, 0x9A, 0xCA, 0x97, 0x77, 0x49, 0x97, 0x39, 0xFF, 0xCA, 0x4A,
+    0xEA, 0xFD, 0x93, 0x9E, 0x2E, 0x6E, 0x92, 0xE6, 0xE2, 0x9E, 0x6E, 0x2E, 0xA6, 0xAD, 0xA9, 0xF7,
+    0x0A, 0xFC, 0x97, 0x19, 0xE9, 0x72, 0x9D, 0xA7, 0x4A, 0xEA, 0x73, 0xAF, 0xCA, 0x7F, 0xAF, 0xCA,
+    0x4E, 0x92, 0x9F, 0x92, 0xAD, 0xA5, 0xEA, 0x2A, 0xDA, 0x5E, 0x92, 0x9F, 0x99, 0x9A, 0xEA, 0x4A,
+    0xFF, 0xCA, 0x7A, 0xFA, 0x96, 0x72, 0x99, 0x76, 0xAD, 0xA7, 0x5E, 0xA7, 0x5E, 0x77, 0x97, 0x77,
+    0x79, 0xAA, 0xCA, 0xA9, 0x70, 0x9F, 0xFC, 0xA5, 0xFF, 0xF4, 0xFA, 0x4D, 0xA3, 0xF9, 0x5D, 0x92,
+    0xAE, 0x96, 0xD3, 0xF7, 0x4A, 0xE9, 0x74, 0xF7, 0x5F, 0x49, 0x99, 0x99, 0x99, 0x1F, 0x4F, 0xE1,
+    0xF4, 0xAF, 0xC9, 0x1F, 0x6E, 0xA2, 0xFA, 0x5E, 0xA2, 0xAF, 0x94, 0xE9, 0x3F, 0xDA, 0x9A, 0xF5,
+    0xFF, 0xF6, 0x9F, 0xEA, 0x97, 0x75, 0x72, 0x99, 0x75, 0xAD, 0xA7, 0x4E, 0xA7, 0x4E, 0x76, 0x97,
+    0x77, 0x69, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xEA, 0xFD, 0x93, 0x9E, 0x2E, 0x6E, 0x92, 0xE6, 0xE2,
+    0x9E, 0x6E, 0x2E, 0xA6, 0xAD, 0xA9, 0xF7, 0x0A, 0xFC, 0x97, 0x19, 0xE9, 0x72, 0x9D, 0xA7, 0x4A,
+    0xEA, 0x73, 0xAF, 0xCA, 0x7F, 0xAF, 0xCA, 0x4E, 0x92, 0x9F, 0x92, 0xAD, 0xA5, 0xEA, 0x2A, 0xDA,
+    0x5E, 0x92, 0x9F, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xCA, 0x7A, 0xFA, 0x96, 0x79, 0xAA, 0xCA, 0xA9,
+    0x70, 0x9F, 0xFC, 0xA5, 0xFF, 0xF4, 0xFA, 0x4D, 0xA3, 0xF9, 0x5D, 0x92, 0xAE, 0x96, 0xD3, 0xF7,
+    0x4A, 0xE9, 0x74, 0xF7, 0x5F, 0x49, 0x99, 0x99, 0x99, 0x1F, 0x4F, 0xE1, 0xF4, 0xAF, 0xC9, 0x1F,
+    0x6E, 0xA2, 0xFA, 0x5E, 0xA2, 0xAF, 0x94, 0xE9, 0x3F, 0xDA, 0x9A, 0xF5, 0xFF, 0xF6, 0x9F, 0xEA,
+    0x97, 0x77, 0x4A, 0xA9, 0x76, 0xE7, 0x6E, 0x76, 0xD9, 0x75, 0xDA, 0x76, 0xA9, 0x71, 0x77, 0x74,
+    0xD7, 0x5D, 0x75, 0xD9, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0x9E, 0x77, 0x75, 0x99, 0x73, 0x9F,
+    0xFC, 0xA4, 0xAE, 0xAF, 0xD9, 0x39, 0xE2, 0xE6, 0xE9, 0x2E, 0x6E, 0x29, 0xE6, 0xE2, 0xEA, 0x6A,
+    0xDA, 0x9F, 0x70, 0xAF, 0xC9, 0x71, 0x9E, 0x97, 0x29, 0xDA, 0x74, 0xAE, 0xA7, 0x3A, 0xFC, 0xA7,
+    0xFA, 0xFC, 0xA4, 0xE9, 0x29, 0xF9, 0x2A, 0xDA, 0x5E, 0xA2, 0xAD, 0xA5, 0xE9, 0x29, 0xF9, 0x99,
+    0xAE, 0xA4, 0xAF, 0xFC, 0xA7, 0xAF, 0xA9, 0x60, 0x77, 0x77, 0x19, 0xDA, 0x77, 0x09, 0xF9, 0x76,
+    0x9D, 0xAE, 0x75, 0x9D, 0xA1, 0xDA, 0x74, 0xAC, 0x93, 0xA9, 0x77, 0x75, 0x99, 0x99, 0x99, 0x92,
+    0x99, 0x99, 0x99, 0x99, 0x29, 0xFE, 0x91, 0xFE, 0xA3, 0xAF, 0xC9, 0x2A, 0xFC, 0xA5, 0xAE, 0x59,
+    0xE9, 0x6F, 0x5A, 0xE7, 0xEA, 0x5F, 0x69, 0xE9, 0x5E, 0xA6, 0xAE, 0x94, 0x9E, 0x96, 0xAF, 0xFF,
+    0xC9, 0x6F, 0xFF, 0xD7, 0xEA, 0x99, 0x99, 0x99, 0xF6, 0x9E, 0x95, 0xEA, 0x6A, 0xE5, 0x9E, 0x96,
+    0xF5, 0xAE, 0x7F, 0x5F, 0x69, 0xEA, 0x5F, 0x49, 0xFE, 0x91, 0xFE, 0x92, 0xAF, 0xE1, 0x9F, 0xE9,
+    0x20, 0x59, 0xA9, 0x72, 0xAE, 0x97, 0x0A, 0xFC, 0x7A, 0xD9, 0x0D, 0xA5, 0xAD, 0x29, 0xCA, 0x77,
+    0x79, 0x97, 0x1A, 0xFA, 0x79, 0xFC, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x29,
+    0x6E, 0x90, 0xAE, 0xA4, 0xE0, 0xFD, 0x39, 0xEA, 0xCA, 0xAE, 0x39, 0xFA, 0x09, 0xE3, 0xAE, 0xA1,
+    0xAE, 0x3F, 0x2E, 0xA3, 0xEA, 0x2E, 0x39, 0xE2, 0x9E, 0x3A, 0xE2, 0xAD, 0xA3, 0xEA, 0x2E, 0x90,
+    0xA1, 0xE9, 0x2F, 0xD0, 0x9E, 0x3F, 0xCA, 0x0A, 0xE3, 0xAE, 0x97, 0x70, 0x39, 0x99, 0x99, 0x99,
+    0x29, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xE9, 0x1F, 0xEA, 0x3A, 0xFC, 0x92, 0xAF, 0xCA, 0x5A, 0xE5,
+    0x9E, 0x94, 0x99, 0xF9, 0x99, 0x99, 0x9F, 0xA9, 0x2A, 0xFF, 0xFF, 0xD9, 0x39, 0xEA, 0x5E, 0xA6,
+    0xAE, 0x94, 0x9E, 0x96, 0xAF, 0xFF, 0xC9, 0x6F, 0xFF, 0xD7, 0xEA, 0x99, 0x99, 0x99, 0xF6, 0x9E,
+    0x95, 0xEA, 0x6A, 0xE5, 0x9E, 0x96, 0xF5, 0xAE, 0x7F, 0x5F, 0x69, 0xEA, 0x5F, 0x49, 0xFE, 0x91,
+    0xFE, 0x92, 0xAF, 0xE1, 0x9F, 0xE9, 0x20, 0x49, 0x97, 0x1A, 0xFA, 0x79, 0xFC, 0xA7, 0x2E, 0xA7,
+    0x9A, 0xAE, 0xAA, 0xA5, 0xFF, 0xC7, 0xAD, 0xA7, 0x2E, 0x90, 0x9A, 0xD9, 0x4E, 0x0A, 0xFC, 0x39,
+    0xEA, 0xFD, 0x3A, 0xFA, 0x09, 0xE3, 0xAF, 0x1A, 0xE3, 0xF2, 0xEA, 0x3E, 0xA2, 0xE9, 0x29, 0xE2,
+    0x9E, 0x3A, 0xE2, 0xAD, 0xA3, 0xEA, 0x2E, 0x90, 0xA1, 0xE9, 0x2F, 0xD0, 0x9E, 0x3F, 0xCA, 0x0A,
+    0xE3, 0xAE, 0x97, 0x70, 0x5A, 0x92, 0x94, 0x9F, 0x0A, 0xC9, 0x3F, 0xF4, 0xD1, 0xE9, 0x71, 0x97,
+    0x73, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFE, 0xA4, 0xAF, 0xCA, 0x6A, 0xE7, 0x0F, 0x70, 0xEA, 0x70,
+    0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE9, 0x7A, 0xE7, 0x0F, 0x79,
+    0xEA, 0x59, 0xFE, 0x93, 0xAF, 0xE9, 0x30, 0x3A, 0x92, 0x92, 0x9F, 0x0A, 0xC9, 0x1D, 0xAF, 0xC2,
+    0xD1, 0xE9, 0x79, 0x77, 0x29, 0x59, 0xFA, 0x4F, 0xCA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E,
+    0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x0A, 0x4F, 0xD9, 0x3F, 0xD4, 0xAE, 0xA7, 0x70, 0x49, 0x99, 0x99,
+    0x99, 0x4A, 0xFE, 0x93, 0xAF, 0xE7, 0x77, 0x69, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xEA, 0x4A, 0xFC,
+    0xA6, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x9E,
+    0x97, 0xAE, 0x97, 0xAE, 0x70, 0xF7, 0x9E, 0xA5, 0x9F, 0xE9, 0x3A, 0xFE, 0x93, 0x19, 0xFE, 0x2F,
+    0xF2, 0x99, 0x99, 0x99, 0x99, 0x77, 0x09, 0x59, 0xFA, 0x4F, 0xCA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A,
+    0xDA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x0A, 0x4F, 0xD9, 0x3F, 0xD4, 0xAE, 0xA7, 0x70, 0x4A,
+    0x93, 0x94, 0x9D, 0x29, 0xC4, 0x9E, 0xAE, 0x5F, 0xCA, 0x79, 0x99, 0x77, 0x49, 0x99, 0x99, 0x99,
+    0x93, 0x9F, 0xEA, 0x4A, 0xFC, 0xA6, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE,
+    0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x97, 0xAE, 0x70, 0xF7, 0x9E, 0xA5, 0x9F, 0xE9, 0x3A,
+    0xFE, 0x93, 0x29, 0x70, 0xAC, 0xA3, 0xC2, 0xAD, 0xA9, 0xAD, 0x29, 0xFD, 0x5A, 0xCA, 0x97, 0x72,
+    0x95, 0x9F, 0xA4, 0xFC, 0xA6, 0xE9, 0x6E, 0x69, 0xE6, 0xAD, 0xA6, 0xE9, 0x6E, 0x69, 0xE6, 0xAD,
+    0xA0, 0xA4, 0xFD, 0x93, 0xFD, 0x4A, 0xEA, 0x77, 0x39, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xEA, 0x3A,
+    0xFC, 0xA5, 0xAE, 0x7F, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A,
+    0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA4, 0x9F, 0xE9, 0x2A, 0xFE, 0x97, 0xD9, 0x7D, 0x70, 0xAD, 0x70,
+    0xAD, 0xAA, 0x96, 0xF7, 0x70, 0x75, 0xE4, 0xAE, 0x4F, 0x4A, 0xD9, 0x76, 0x93, 0x9F, 0xA2, 0xFC,
+    0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xAD, 0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xAD, 0xA0, 0xA2, 0xFD, 0x91,
+    0xFC, 0xA2, 0xAE, 0x94, 0xAC, 0x94, 0x9C, 0xA5, 0xD6, 0xEA, 0x93, 0xAE, 0x95, 0x94, 0x79, 0x97,
+    0x0E, 0x7A, 0xE7, 0xAD, 0xA7, 0x09, 0x97, 0x72, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFE, 0xA3, 0xAF,
+    0xCA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE,
+    0x96, 0xAE, 0x7F, 0x69, 0xEA, 0x49, 0xFE, 0x92, 0xAF, 0xE9, 0x20, 0x49, 0x29, 0xFA, 0x1F, 0xCA,
+    0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x0A, 0x1F, 0xD9, 0x0F,
+    0xD1, 0xAE, 0xA7, 0x10, 0x39, 0x99, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFE, 0xA0,
+    0x9F, 0xEA, 0x3A, 0xFC, 0xA2, 0xAF, 0xCA, 0x5A, 0xE5, 0x9E, 0x96, 0xF5, 0xAE, 0x7E, 0xA5, 0xF7,
+    0xEA, 0x5E, 0xA6, 0x9E, 0x94, 0x9E, 0x96, 0xAE, 0x5A, 0xE7, 0xF5, 0xF7, 0xEA, 0x5F, 0x69, 0xE9,
+    0x5E, 0xA6, 0xAE, 0x94, 0x9E, 0x96, 0xAE, 0x5A, 0xE7, 0xF5, 0xF6, 0x9E, 0xA5, 0xEA, 0x49, 0xFE,
+    0x92, 0x9E, 0x94, 0xAF, 0xE9, 0x2A, 0xE7, 0x71, 0xEA, 0x74, 0xD1, 0xAE, 0x74, 0x9F, 0xE9, 0x74,
+    0x9F, 0xD9, 0x76, 0xAE, 0xA7, 0x10, 0x77, 0x5E, 0x4A, 0xD9, 0x3A, 0xE3, 0x9E, 0xA3, 0xF3, 0x9E,
+    0x93, 0xAD, 0x94, 0xDA, 0x77, 0x69, 0x69, 0x39, 0xFA, 0x2A, 0xF2, 0xFC, 0xA1, 0xAF, 0xC4, 0xE9,
+    0x39, 0xE4, 0xE4, 0x9E, 0x39, 0xE4, 0xAD, 0xA3, 0xAD, 0xA4, 0xE9, 0x3E, 0x94, 0xE9, 0x3E, 0x49,
+    0xE3, 0x9E, 0x4A, 0xE3, 0xAD, 0xA0, 0xA2, 0xEA, 0x3F, 0xD9, 0x1E, 0x93, 0xFD, 0x19, 0xE4, 0xAE,
+    0xA2, 0xAE, 0x74, 0xE9, 0x74, 0xE7, 0x0C, 0x91, 0xEA, 0x7F, 0xF7, 0x0A, 0xFD, 0x72, 0xAD, 0xA9,
+    0x70, 0x77, 0x74, 0xDA, 0x74, 0xFA, 0x72, 0xEA, 0xD9, 0x79, 0xE1, 0xAD, 0x7A, 0xCA, 0x3A, 0x97,
+    0x77, 0x09, 0x99, 0x99, 0x99, 0x97, 0x9F, 0xEA, 0x70, 0xAF, 0xCA, 0x72, 0x9E, 0x97, 0x3A, 0xE7,
+    0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97,
+    0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4E, 0xA7, 0xAC, 0x1A, 0xE7, 0x9F,
+    0xEA, 0x79, 0xFD, 0xA7, 0x1A, 0xEA, 0x72, 0x72, 0x99, 0x74, 0xAD, 0xA7, 0x2A, 0xF9, 0x70, 0x9D,
+    0x9D, 0xA7, 0x9D, 0x91, 0xD7, 0xAC, 0x92, 0xAA, 0x77, 0x72, 0x97, 0x3A, 0xF7, 0x1A, 0xFC, 0x73,
+    0x9E, 0x73, 0xAE, 0x73, 0xEA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x3E,
+    0x97, 0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0x97, 0x29, 0xE6, 0x9C, 0x91, 0xE9, 0x6F, 0xF7, 0xFE, 0x71,
+    0xAD, 0xA9, 0x71, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x92, 0x9F, 0xE9, 0x0F, 0xDA, 0x3A,
+    0xFC, 0x91, 0x9F, 0xA5, 0xAE, 0x3A, 0xE7, 0xF2, 0xF7, 0x0E, 0xA1, 0xEA, 0x70, 0x9E, 0x90, 0xEA,
+    0x71, 0xAE, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xE7, 0x4F, 0xEA, 0x72, 0x9E, 0x9A, 0xE9, 0x71,
+    0xAE, 0x1F, 0x71, 0xF1, 0x9F, 0x70, 0xEA, 0x2F, 0xA6, 0x9E, 0xA3, 0xFC, 0x39, 0xFE, 0x29, 0xFC,
+    0x91, 0xAF, 0xE3, 0x9F, 0x77, 0x76, 0xAA, 0x77, 0x0A, 0xDA, 0x77, 0x9D, 0xA7, 0x7A, 0xD7, 0x79,
+    0xD9, 0x77, 0x99, 0x73, 0x49, 0x97, 0xAF, 0xA5, 0x9F, 0xCA, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7,
+    0x0A, 0xDA, 0x29, 0x4E, 0x1A, 0xE3, 0xE9, 0xFC, 0xA2, 0xDA, 0xD0, 0x9D, 0xA1, 0x9E, 0xA2, 0xDA,
+    0x1A, 0xE2, 0xAD, 0x2E, 0x91, 0xAD, 0x92, 0xEA, 0xF3, 0x9F, 0xD5, 0xAD, 0xAA, 0xD9, 0x4E, 0x90,
+    0xE4, 0xE1, 0xAE, 0xA9, 0x09, 0xE2, 0xFC, 0xAA, 0xDA, 0x3A, 0xE7, 0x72, 0xAA, 0x71, 0xAD, 0x97,
+    0x09, 0xD7, 0x1A, 0xCA, 0x70, 0x9C, 0xA7, 0x19, 0x97, 0x49, 0x59, 0x19, 0xF9, 0x2E, 0xA0, 0xFC,
+    0x91, 0xFA, 0x2E, 0x90, 0xFC, 0x3E, 0x0D, 0xA1, 0x93, 0xEA, 0xCA, 0x69, 0xFC, 0x7A, 0xFC, 0x7E,
+    0xAD, 0xA6, 0xE0, 0xAD, 0x59, 0xE0, 0x9E, 0x1A, 0x19, 0xE1, 0xFD, 0x90, 0xAD, 0xA1, 0xAF, 0xC1,
+    0xE9, 0x2A, 0xE7, 0x70, 0x77, 0x70, 0xAA, 0x72, 0x9E, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xA9, 0x77,
+    0x71, 0x99, 0x99, 0x99, 0x96, 0x9F, 0xE9, 0x6A, 0xFC, 0x97, 0x0A, 0xE7, 0x2F, 0x72, 0xEA, 0x71,
+    0x9E, 0x97, 0x1A, 0xE7, 0x2A, 0xE7, 0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE5, 0xC9, 0x2F,
+    0x4D, 0xA2, 0xF3, 0x9D, 0x91, 0x9E, 0xA9, 0x99, 0x9E, 0x09, 0xFF, 0xFA, 0x0A, 0xFF, 0xF9, 0x00,
+    0x77, 0x09, 0xC9, 0x49, 0xEA, 0x29, 0xFC, 0x92, 0xEA, 0x94, 0x97, 0x29, 0x94, 0xAF, 0xA2, 0x9F,
+    0xCA, 0x5E, 0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0xA5, 0xE9, 0x49, 0xE5, 0xAE, 0x5E, 0xA5, 0xE9,
+    0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x0A, 0x3F, 0xD3, 0xFC, 0xA3, 0xF9, 0x75, 0x39, 0x99, 0x99,
+    0x99, 0x69, 0xFE, 0x96, 0xAF, 0xC9, 0x70, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE,
+    0x72, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x5C, 0x92, 0xF4, 0xDA, 0x2F, 0x39,
+    0xD9, 0x19, 0xEA, 0x99, 0x99, 0xE0, 0x9F, 0xFF, 0xA0, 0xAF, 0xFF, 0x97, 0x75, 0xAC, 0x97, 0x29,
+    0xE7, 0x3E, 0x72, 0x9D, 0x97, 0x19, 0xD9, 0x72, 0x9A, 0x70, 0x59, 0x93, 0xAF, 0xA1, 0x9F, 0xCA,
+    0x4E, 0x94, 0xE4, 0x9E, 0x4A, 0xDA, 0x4E, 0xA4, 0xE9, 0x39, 0xE4, 0xAE, 0x4E, 0xA4, 0xE9, 0x4E,
+    0x49, 0xE4, 0xAD, 0xA4, 0xE9, 0x0A, 0x2F, 0xD2, 0xFC, 0xA2, 0xF9, 0x74, 0x9A, 0x6D, 0xA5, 0xDA,
+    0x5D, 0x5D, 0x95, 0x96, 0x77, 0x74, 0xDA, 0x39, 0x99, 0x99, 0x99, 0x1D, 0x92, 0x9F, 0xE9, 0x9D,
+    0x4A, 0xFC, 0x90, 0xAC, 0xA5, 0xAE, 0x2D, 0x6F, 0x29, 0x96, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7,
+    0x3A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE5, 0xC9, 0x3F, 0x4D, 0xA3, 0xF3, 0x9D,
+    0x92, 0x9E, 0xA9, 0x99, 0x9E, 0x19, 0xFF, 0xFA, 0x1A, 0xFF, 0xF9, 0x10, 0x49, 0x92, 0x92, 0xAF,
+    0xA0, 0xAD, 0x09, 0xFC, 0xA0, 0xDA, 0x3E, 0x90, 0xD9, 0x3E, 0x09, 0xD3, 0x9E, 0x0A, 0xC9, 0x3A,
+    0xDA, 0x1A, 0x4E, 0xA7, 0xE9, 0x69, 0xE7, 0xAE, 0x7E, 0xA7, 0xE9, 0x7E, 0x79, 0xE7, 0xAD, 0xA7,
+    0xE9, 0x0A, 0x5F, 0xD5, 0xFC, 0xA5, 0xF9, 0x77, 0x10, 0x39, 0x99, 0x99, 0x99, 0x79, 0xFE, 0x97,
+    0xAF, 0xC9, 0x71, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x29, 0xD4, 0xAE, 0x29, 0xE4, 0xAE,
+    0x2A, 0xE4, 0xF3, 0xD9, 0x4E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x5C, 0x93, 0xF4, 0xDA, 0x3F, 0x39,
+    0xD9, 0x29, 0xEA, 0x99, 0x99, 0xE1, 0x9F, 0xFF, 0xA1, 0xAF, 0xFF, 0x91, 0x49, 0x96, 0xAF, 0xA4,
+    0x9F, 0xCA, 0x7E, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0xA7, 0xE9, 0x69, 0xE1, 0xAD, 0x2A, 0xE0,
+    0x9E, 0x2E, 0xA0, 0x9E, 0x2E, 0x91, 0xAA, 0x3E, 0x79, 0xE7, 0xAD, 0xA7, 0xE9, 0x0A, 0x5F, 0xD5,
+    0xFC, 0xA5, 0xF9, 0x77, 0x10, 0x39, 0x99, 0x99, 0x99, 0x69, 0xFE, 0x96, 0xAF, 0xC9, 0x70, 0xAE,
+    0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x9C, 0x7A, 0xFD, 0x96, 0xFC, 0xA7, 0x9F, 0x7A, 0xFC, 0xA7,
+    0xDA, 0xE9, 0x71, 0xAE, 0x5C, 0x92, 0xF4, 0xDA, 0x2F, 0x39, 0xD9, 0x19, 0xEA, 0x99, 0x99, 0xE0,
+    0x9F, 0xFF, 0xA0, 0xAF, 0xFF, 0x90, 0x59, 0x94, 0xAF, 0xA2, 0x9F, 0xCA, 0x5E, 0x95, 0xE5, 0x9E,
+    0x5A, 0xDA, 0x5E, 0xA5, 0xFC, 0xA2, 0x9F, 0xA3, 0xAE, 0x39, 0xFA, 0x3F, 0xC9, 0x39, 0x0E, 0x59,
+    0xE5, 0xAD, 0xA5, 0xE9, 0x0A, 0x3F, 0xD3, 0xFC, 0xA3, 0xF9, 0x74, 0x77, 0x77, 0x39, 0xC9, 0x77,
+    0x1A, 0xDA, 0x77, 0x9F, 0x97, 0x6A, 0xF9, 0x77, 0x9A, 0x97, 0x77, 0x72, 0x99, 0x99, 0x95, 0x99,
+    0x99, 0x99, 0x39, 0xFC, 0xA3, 0xAF, 0xD9, 0x3A, 0xFC, 0x39, 0xAF, 0x95, 0xAF, 0x94, 0xE7, 0xFD,
+    0x4E, 0x7F, 0xD9, 0x29, 0xDA, 0x69, 0xFD, 0xA2, 0x9D, 0x96, 0x9D, 0x9F, 0x2A, 0xD7, 0xAD, 0x09,
+    0xEA, 0x1E, 0x7E, 0x1F, 0x1E, 0x7E, 0x19, 0xEA, 0x9D, 0xA6, 0x9D, 0xA2, 0xFA, 0xD9, 0x6A, 0xD9,
+    0x2A, 0xFD, 0x7E, 0x4F, 0xD7, 0xE4, 0xAF, 0xA6, 0x9E, 0x5F, 0xA5, 0xAF, 0xC9, 0x3F, 0x94, 0xAF,
+    0xD9, 0x39, 0xE7, 0x72, 0x97, 0x77, 0x71, 0xCA, 0x73, 0xE7, 0x29, 0xE7, 0x2E, 0x72, 0x9D, 0x74,
+    0xA7, 0x77, 0x09, 0x49, 0x39, 0xF9, 0x1F, 0x2F, 0xCA, 0x9F, 0xCA, 0x3E, 0xAD, 0xAE, 0xA3, 0xFC,
+    0x1A, 0xDA, 0x3F, 0x91, 0xE9, 0x29, 0xEA, 0x2E, 0x3A, 0xE2, 0x9E, 0x3E, 0xA2, 0xEA, 0x3E, 0x92,
+    0xE9, 0x29, 0xE2, 0x9E, 0x09, 0x90, 0x9E, 0x29, 0xFC, 0xA0, 0xAE, 0x2A, 0xFC, 0x90, 0xE9, 0x3E,
+    0xA7, 0x70, 0x39, 0x99, 0x99, 0x59, 0x99, 0x99, 0x93, 0x9F, 0xCA, 0x3A, 0xFD, 0x93, 0xAF, 0xC3,
+    0x9A, 0xF9, 0x5A, 0xF9, 0x4E, 0x7F, 0xD4, 0xE7, 0xFD, 0x92, 0x9D, 0xA6, 0x9F, 0xDA, 0x29, 0xD9,
+    0x69, 0xD9, 0xF2, 0xAD, 0x7A, 0xD0, 0x9E, 0xA1, 0xE7, 0xE1, 0xF1, 0xE7, 0xE1, 0x9E, 0xA9, 0xDA,
+    0x69, 0xDA, 0x2F, 0xAD, 0x96, 0xAD, 0x92, 0xAF, 0xD7, 0xE4, 0xFD, 0x7E, 0x4A, 0xFA, 0x69, 0xE5,
+    0xFA, 0x5A, 0xFC, 0x93, 0xF9, 0x4A, 0xFD, 0x93, 0x9E, 0x77, 0x29, 0x77, 0xAC, 0x97, 0x72, 0xE7,
+    0x72, 0xE7, 0x72, 0xD9, 0x77, 0x1D, 0x97, 0x71, 0x9A, 0x75, 0x49, 0x49, 0x39, 0xF9, 0x1F, 0x2F,
+    0xCA, 0x9F, 0xCA, 0x3E, 0xAD, 0xAE, 0xA3, 0xFC, 0x1A, 0xDA, 0x3F, 0x91, 0xE9, 0x29, 0xEA, 0x2E,
+    0x3A, 0xE2, 0x9E, 0x3E, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x29, 0xE2, 0x9E, 0x09, 0x90, 0x9E, 0x29,
+    0xFC, 0xA0, 0xAE, 0x2A, 0xFC, 0x90, 0xE9, 0x3E, 0xA7, 0x76, 0xAA, 0x73, 0xE7, 0x3A, 0xD7, 0x3D,
+    0x97, 0x2A, 0xCA, 0x73, 0x99, 0x70, 0x77, 0x76, 0xCA, 0x3D, 0xA7, 0x4D, 0xA1, 0xE7, 0x5A, 0xDA,
+    0xDA, 0x77, 0xFA, 0x77, 0x1D, 0xA7, 0x77, 0x71, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x39, 0xFC,
+    0xA3, 0xAF, 0xD9, 0x3A, 0xFC, 0x39, 0xAF, 0x95, 0xAF, 0x94, 0xE7, 0xFD, 0x4E, 0x7F, 0xD9, 0x29,
+    0xDA, 0x69, 0xFD, 0xA2, 0x9D, 0x96, 0x9D, 0x9F, 0x2A, 0xD7, 0xAD, 0x09, 0xEA, 0x1E, 0x7E, 0x1F,
+    0x1E, 0x7E, 0x19, 0xEA, 0x9D, 0xA6, 0x9D, 0xA2, 0xFA, 0xD9, 0x6A, 0xD9, 0x2A, 0xFD, 0x7E, 0x4F,
+    0xD7, 0xE4, 0xAF, 0xA6, 0x9E, 0x5F, 0xA5, 0xAF, 0xC9, 0x3F, 0x94, 0xAF, 0xD9, 0x39, 0xE7, 0x72,
+    0x97, 0x5A, 0x92, 0x9C, 0x95, 0x9D, 0x1A, 0xD7, 0xD9, 0x9D, 0x70, 0xAF, 0x97, 0x1E, 0x97, 0x29,
+    0xAA, 0x77, 0x70, 0x94, 0x93, 0x9F, 0x91, 0xF2, 0xFC, 0xA9, 0xFC, 0xA3, 0xEA, 0xDA, 0xEA, 0x3F,
+    0xC1, 0xAD, 0xA3, 0xF9, 0x1E, 0x92, 0x9E, 0xA2, 0xE3, 0xAE, 0x29, 0xE3, 0xEA, 0x2E, 0xA3, 0xE9,
+    0x2E, 0x92, 0x9E, 0x29, 0xE0, 0x99, 0x09, 0xE2, 0x9F, 0xCA, 0x0A, 0xE2, 0xAF, 0xC9, 0x0E, 0x93,
+    0xEA, 0x77, 0x00, 0x2A, 0xA9, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x7A, 0xD7, 0x70, 0xDA,
+    0x39, 0x49, 0x4E, 0x09, 0xFC, 0x1A, 0xE9, 0x2D, 0x1F, 0xD0, 0xFD, 0x70, 0xAD, 0xAD, 0xAA, 0xE7,
+    0x0A, 0xF9, 0x09, 0xE7, 0x0F, 0xA1, 0xAD, 0xA7, 0x0F, 0x2E, 0x97, 0x9E, 0x92, 0xE7, 0x0A, 0xE2,
+    0x9E, 0x70, 0xAD, 0xA2, 0xAD, 0xA7, 0x0E, 0x92, 0xE9, 0x0A, 0x6E, 0x92, 0xFD, 0x59, 0xE3, 0xFC,
+    0xA5, 0xAD, 0xA3, 0xF9, 0x77, 0x50, 0x39, 0x99, 0x99, 0x59, 0x99, 0x99, 0x93, 0x9F, 0xCA, 0x3A,
+    0xFD, 0x93, 0xAF, 0xC3, 0x9A, 0xF9, 0x5A, 0xF9, 0x4E, 0x7F, 0xD4, 0xE7, 0xFD, 0x92, 0x9D, 0xA6,
+    0x9F, 0xDA, 0x29, 0xD9, 0x69, 0xD9, 0xF2, 0xAD, 0x7A, 0xD0, 0x9E, 0xA1, 0xE7, 0xE1, 0xF1, 0xE7,
+    0xE1, 0x9E, 0xA9, 0xDA, 0x69, 0xDA, 0x2F, 0xAD, 0x96, 0xAD, 0x92, 0xAF, 0xD7, 0xE4, 0xFD, 0x7E,
+    0x4A, 0xFA, 0x69, 0xE5, 0xFA, 0x5A, 0xFC, 0x93, 0xAE, 0x94, 0xAF, 0xD9, 0x39, 0xE7, 0x72, 0xDA,
+    0x75, 0xC9, 0x1A, 0xD7, 0x5A, 0xFD, 0xA7, 0x5A, 0xFC, 0xA7, 0x7A, 0xDA, 0x97, 0x00, 0x49, 0x49,
+    0x29, 0xF9, 0x1F, 0x1F, 0xCA, 0x9F, 0xCA, 0x2E, 0xAD, 0xAE, 0xA2, 0xFC, 0x1A, 0xDA, 0x2F, 0x91,
+    0xE9, 0x19, 0xEA, 0x2E, 0x2A, 0xE2, 0x9E, 0x2E, 0xA2, 0xAD, 0xA2, 0xE9, 0x2E, 0xA1, 0x9E, 0x3E,
+    0x29, 0xE2, 0x9E, 0x2A, 0xE2, 0xAD, 0xA2, 0xE9, 0x2E, 0x97, 0x09, 0xE7, 0x1A, 0xDA, 0x5A, 0xA1,
+    0xE5, 0x9F, 0xD9, 0x59, 0xFC, 0xA7, 0x9D, 0xA9, 0x50, 0x79, 0x99, 0x99, 0x99, 0x71, 0xAF, 0xE9,
+    0x70, 0xAF, 0xE7, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F,
+    0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE,
+    0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94,
+    0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70,
+    0x49, 0xFE, 0x5A, 0xFE, 0x69, 0x99, 0x99, 0x99, 0x77, 0x59, 0x97, 0x1A, 0xFC, 0x94, 0x9F, 0xF3,
+    0x9E, 0xA0, 0x9E, 0xA2, 0xEA, 0x2F, 0x19, 0xE3, 0xAE, 0x1E, 0xA3, 0xAE, 0x1E, 0x93, 0xEA, 0x1E,
+    0x93, 0xE9, 0x09, 0xE9, 0x29, 0xE2, 0xE9, 0x2E, 0x92, 0xF9, 0x9F, 0x39, 0xFE, 0xA5, 0x9F, 0xC9,
+    0x77, 0x20, 0x7A, 0x93, 0x97, 0x19, 0xD2, 0x9C, 0x71, 0x9E, 0xAE, 0x72, 0xFC, 0xA7, 0x49, 0x99,
+    0x77, 0x77, 0x9A, 0xAA, 0xA9, 0x71, 0xFF, 0xC9, 0x59, 0xFF, 0xE9, 0x39, 0xF9, 0x19, 0xFC, 0x29,
+    0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0xA0, 0x9F, 0x6A, 0xEA, 0x0A, 0xE9, 0x6A, 0xEA, 0x0F, 0x7A, 0xEA,
+    0x0F, 0x7A, 0xEA, 0x0F, 0x7F, 0x90, 0xF7, 0xF1, 0xF6, 0xAE, 0xA1, 0xF9, 0x49, 0xF2, 0xAF, 0x39,
+    0xF9, 0x3F, 0xCA, 0xAF, 0xC9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0x97, 0x77, 0x59, 0x73, 0x9C, 0xA3,
+    0xC5, 0xAD, 0xA9, 0xAD, 0x6F, 0xD7, 0x0A, 0xDA, 0x77, 0x79, 0x97, 0x1A, 0xFC, 0x94, 0x9F, 0xF3,
+    0x9E, 0xA0, 0x9E, 0xA2, 0xEA, 0x2F, 0x19, 0xE3, 0xAE, 0x1E, 0xA3, 0xAE, 0x1E, 0x93, 0xEA, 0x1E,
+    0x93, 0xE9, 0x09, 0xE9, 0x29, 0xE2, 0xE9, 0x2E, 0x92, 0xF9, 0x9F, 0x39, 0xFE, 0xA5, 0x9F, 0xC9,
+    0x77, 0x20, 0x77, 0x09, 0x72, 0x9C, 0xA2, 0xAC, 0x97, 0x0A, 0xE1, 0xEA, 0x7F, 0x99, 0xF7, 0xEA,
+    0x09, 0xE9, 0x70, 0xC9, 0x29, 0xC9, 0x77, 0x76, 0x9A, 0xAA, 0xA9, 0x72, 0xFF, 0xC9, 0x69, 0xFF,
+    0xE9, 0x49, 0xF9, 0x19, 0xFC, 0x39, 0xF5, 0xF9, 0x2F, 0x95, 0xAE, 0xA1, 0x9F, 0x6A, 0xEA, 0x1A,
+    0xE9, 0x6A, 0xEA, 0x1F, 0x7A, 0xEA, 0x1F, 0x7A, 0xEA, 0x1F, 0x7F, 0x91, 0xF7, 0xF2, 0xF6, 0xAE,
+    0xA2, 0xF9, 0x49, 0xF3, 0xAF, 0x39, 0xF9, 0x4F, 0xCA, 0xAF, 0xC9, 0x59, 0xFF, 0xD9, 0x70, 0xAF,
+    0xD9, 0x77, 0x71, 0x79, 0x29, 0x97, 0x9D, 0x1D, 0x96, 0xE0, 0xAD, 0x95, 0xE0, 0x9D, 0xA5, 0x9D,
+    0x1D, 0x96, 0x9C, 0x2C, 0x97, 0x77, 0x09, 0x97, 0x2A, 0xFC, 0x95, 0x9F, 0xF4, 0x9E, 0xA0, 0x9E,
+    0xA3, 0xEA, 0x2F, 0x29, 0xE3, 0xAE, 0x2E, 0xA3, 0xAE, 0x2E, 0x93, 0xEA, 0x2E, 0x93, 0xE9, 0x19,
+    0xE9, 0x29, 0xE3, 0xE9, 0x2E, 0x93, 0xF9, 0x9F, 0x49, 0xFE, 0xA6, 0x9F, 0xC9, 0x77, 0x40, 0x79,
+    0x9A, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x9F, 0xFF, 0xFC, 0xA4, 0xFF, 0xFF, 0xEA, 0x3F,
+    0xA9, 0x29, 0xE4, 0xD9, 0x2F, 0x94, 0xAE, 0x4D, 0x2A, 0xE9, 0x5E, 0xA4, 0xCA, 0x2F, 0x6E, 0x97,
+    0x0A, 0xE9, 0x59, 0xE7, 0x1F, 0x6A, 0xFF, 0xA3, 0xF6, 0xAF, 0xF9, 0x3E, 0xA6, 0xEA, 0x99, 0x99,
+    0x94, 0xEA, 0x6E, 0x97, 0x1F, 0x59, 0xE5, 0x93, 0xF9, 0x4A, 0xE4, 0x9C, 0xA2, 0xAF, 0x4F, 0x4D,
+    0xA3, 0xFC, 0xAA, 0xAF, 0xA9, 0x99, 0x9A, 0xD9, 0x39, 0xFF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFA, 0x77,
+    0x73, 0x69, 0x96, 0x99, 0x6A, 0xFA, 0x19, 0xFC, 0x39, 0xFE, 0xA9, 0xFD, 0xA1, 0x9E, 0xA0, 0x9F,
+    0xC9, 0x09, 0xE1, 0xEA, 0x2F, 0xA1, 0x9D, 0xA0, 0x9E, 0x3A, 0xE2, 0xE1, 0xEA, 0x3A, 0xDA, 0x1E,
+    0x91, 0xE9, 0x3E, 0xAA, 0xE3, 0xE9, 0x3F, 0xD9, 0x39, 0xE9, 0x29, 0xEA, 0x93, 0x91, 0xE9, 0x2F,
+    0xA3, 0xD1, 0xF9, 0x9F, 0xDA, 0xAA, 0xE1, 0x9F, 0xE9, 0xFF, 0x39, 0xFC, 0x2F, 0xC9, 0x77, 0x60,
+    0x77, 0x75, 0xAC, 0x76, 0xE9, 0x73, 0xAF, 0x73, 0xFA, 0x74, 0xAA, 0x97, 0x77, 0x59, 0x9A, 0xAC,
+    0xAA, 0x97, 0xAF, 0xFD, 0xA4, 0x9F, 0xDA, 0xAF, 0x94, 0x90, 0xAE, 0x19, 0xF6, 0xEA, 0x2F, 0x6E,
+    0xA2, 0xAE, 0x59, 0xE9, 0x2F, 0x5A, 0xE2, 0x9E, 0x95, 0xAE, 0x09, 0xAE, 0xA6, 0xFF, 0xC9, 0x7F,
+    0xEA, 0x70, 0x9E, 0x9A, 0xE7, 0x0A, 0xE1, 0xEA, 0x7F, 0x1A, 0xE9, 0x6E, 0xA2, 0xF5, 0x9E, 0xA2,
+    0xAF, 0x91, 0x9F, 0xE2, 0xAF, 0xA0, 0xAF, 0xE3, 0xAE, 0xA7, 0x72, 0x77, 0x6C, 0xA7, 0x1E, 0x70,
+    0x9E, 0x70, 0xE7, 0x09, 0xD7, 0x2A, 0x77, 0x59, 0x39, 0x29, 0xF9, 0x09, 0xE1, 0xFC, 0xA9, 0xF3,
+    0xAD, 0x9F, 0xC3, 0xAD, 0xAC, 0xA9, 0x99, 0x3F, 0xA7, 0xF7, 0x9E, 0xA7, 0xAE, 0x70, 0xEA, 0x70,
+    0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0x49, 0x9A, 0xAC, 0xAA, 0x97, 0xAF, 0xFD, 0xA4, 0x9F,
+    0xDA, 0xAF, 0x94, 0x90, 0xAE, 0x19, 0xF6, 0xEA, 0x2F, 0x6E, 0xA2, 0xAE, 0x59, 0xE9, 0x2F, 0x5A,
+    0xE2, 0x9E, 0x95, 0xAE, 0x09, 0xAE, 0xA6, 0xFF, 0xC9, 0x7F, 0xEA, 0x70, 0x9E, 0x9A, 0xE7, 0x0A,
+    0xE1, 0xEA, 0x7F, 0x1A, 0xE9, 0x6E, 0xA2, 0xF5, 0x9E, 0xA2, 0xAF, 0x91, 0x9F, 0xE2, 0xAF, 0xA0,
+    0xAF, 0xE3, 0xAE, 0xA7, 0x77, 0x19, 0xAA, 0x76, 0xE7, 0x6A, 0xD7, 0x6D, 0xA7, 0x5D, 0xA7, 0x6A,
+    0x97, 0x10, 0x59, 0x39, 0x39, 0xF9, 0x09, 0xE2, 0xFC, 0xA9, 0xF4, 0xAD, 0x9F, 0xC4, 0xAD, 0xAC,
+    0xA9, 0x99, 0x4F, 0xA7, 0x0F, 0x70, 0x9E, 0xA7, 0x0A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7,
+    0x1A, 0xE7, 0x1E, 0xA7, 0x77, 0x9A, 0x97, 0x2E, 0x72, 0xDA, 0x72, 0xD7, 0x2D, 0x97, 0x29, 0x73,
+    0x77, 0x79, 0xC9, 0x29, 0xD9, 0x79, 0xD1, 0x9D, 0xA7, 0x1E, 0xAD, 0x97, 0x3F, 0x97, 0x49, 0xD9,
+    0x77, 0x74, 0x99, 0xAA, 0xCA, 0xA9, 0x7A, 0xFF, 0xDA, 0x49, 0xFD, 0xAA, 0xF9, 0x49, 0x0A, 0xE1,
+    0x9F, 0x6E, 0xA2, 0xF6, 0xEA, 0x2A, 0xE5, 0x9E, 0x92, 0xF5, 0xAE, 0x29, 0xE9, 0x5A, 0xE0, 0x9A,
+    0xEA, 0x6F, 0xFC, 0x97, 0xFE, 0xA7, 0x09, 0xE9, 0xAE, 0x70, 0xAE, 0x1E, 0xA7, 0xF1, 0xAE, 0x96,
+    0xEA, 0x2F, 0x59, 0xEA, 0x2A, 0xF9, 0x19, 0xFE, 0x2A, 0xFA, 0x0A, 0xFE, 0x3A, 0xEA, 0x77, 0x20,
+    0x4A, 0x92, 0x9C, 0x93, 0x9D, 0x1A, 0xD5, 0xD9, 0x9D, 0x6A, 0xF9, 0x7E, 0x97, 0x09, 0xAA, 0x77,
+    0x59, 0x39, 0x29, 0xF9, 0x09, 0xE1, 0xFC, 0xA9, 0xF3, 0xAD, 0x9F, 0xC3, 0xAD, 0xAC, 0xA9, 0x99,
+    0x3F, 0xA7, 0xF7, 0x9E, 0xA7, 0xAE, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7,
+    0x77, 0x72, 0xCA, 0x72, 0xAE, 0x70, 0x9F, 0xA7, 0x9F, 0x97, 0x09, 0xA9, 0x77, 0x72, 0xAA, 0xCA,
+    0xA9, 0x6A, 0xFF, 0x4A, 0xFF, 0xC9, 0x29, 0xE9, 0x2A, 0xD3, 0xAE, 0x3A, 0xD3, 0xF3, 0xAC, 0x93,
+    0xAF, 0x71, 0x9F, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xD7, 0x09, 0xFC, 0xA7, 0x1A, 0xF3, 0xD4,
+    0xF2, 0xAD, 0x4A, 0xE2, 0xE9, 0x3F, 0x2F, 0xA9, 0x9F, 0x92, 0xFF, 0xD9, 0x49, 0xFD, 0xA7, 0x73,
+    0x77, 0x6A, 0xC7, 0x19, 0xDA, 0x70, 0xE9, 0x7A, 0xD9, 0x70, 0xD9, 0x71, 0xA9, 0x77, 0x79, 0x70,
+    0xAF, 0xC5, 0xFE, 0x93, 0xE9, 0x09, 0xD4, 0xE7, 0x1F, 0x97, 0x9F, 0xA7, 0xAF, 0xA7, 0x9F, 0x93,
+    0xA3, 0xEA, 0x2A, 0xD2, 0xAD, 0xA2, 0xF9, 0x9E, 0x3F, 0xF9, 0x4A, 0xFC, 0x77, 0x10, 0x77, 0x7A,
+    0xD7, 0x2A, 0xF7, 0x0E, 0xAD, 0xA6, 0xE9, 0x09, 0xD5, 0x9C, 0xA3, 0xAA, 0x77, 0x6A, 0xAC, 0xAA,
+    0x96, 0xAF, 0xF4, 0xAF, 0xFC, 0x92, 0x9E, 0x92, 0xAD, 0x3A, 0xE3, 0xAD, 0x3F, 0x3A, 0xC9, 0x3A,
+    0xF7, 0x19, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0A, 0xFD, 0x70, 0x9F, 0xCA, 0x71, 0xAF, 0x3D, 0x4F,
+    0x2A, 0xD4, 0xAE, 0x2E, 0x93, 0xF2, 0xFA, 0x99, 0xF9, 0x2F, 0xFD, 0x94, 0x9F, 0xDA, 0x77, 0x30,
+    0x79, 0x97, 0x1A, 0xDA, 0x79, 0xF9, 0x59, 0xD9, 0xE5, 0xD9, 0x1D, 0x4A, 0xC9, 0x2A, 0xC7, 0x75,
+    0x97, 0x0A, 0xFC, 0x5F, 0xE9, 0x3E, 0x90, 0x9D, 0x4E, 0x71, 0xF9, 0x79, 0xFA, 0x7A, 0xFA, 0x79,
+    0xF9, 0x3A, 0x3E, 0xA2, 0xAD, 0x2A, 0xDA, 0x2F, 0x99, 0xE3, 0xFF, 0x94, 0xAF, 0xC7, 0x71, 0x6A,
+    0xAC, 0xAA, 0x96, 0xAF, 0xF4, 0xAF, 0xFC, 0x92, 0x9E, 0x92, 0xAD, 0x3A, 0xE3, 0xAD, 0x3F, 0x3A,
+    0xC9, 0x3A, 0xF7, 0x19, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0A, 0xFD, 0x70, 0x9F, 0xCA, 0x71, 0xAF,
+    0x3D, 0x4F, 0x2A, 0xD4, 0xAE, 0x2E, 0x93, 0xF2, 0xFA, 0x99, 0xF9, 0x2F, 0xFD, 0x94, 0x9F, 0xDA,
+    0x77, 0x70, 0xAC, 0xA7, 0x3E, 0xA7, 0x3D, 0xA7, 0x29, 0xD7, 0x2A, 0xD9, 0x72, 0xA9, 0x70, 0x79,
+    0x7A, 0xFC, 0x4F, 0xE9, 0x2E, 0x90, 0x9D, 0x3E, 0x70, 0xF9, 0x69, 0xFA, 0x6A, 0xFA, 0x69, 0xF9,
+    0x2A, 0x3E, 0xA1, 0xAD, 0x2A, 0xDA, 0x1F, 0x99, 0xE2, 0xFF, 0x93, 0xAF, 0xC7, 0x73, 0xAC, 0x97,
+    0x9E, 0x71, 0xD7, 0x0D, 0xA6, 0x9D, 0xA7, 0x9A, 0x70, 0x77, 0x5D, 0x3A, 0xD6, 0xDA, 0x1E, 0x79,
+    0xDA, 0xE7, 0x1A, 0xF7, 0x3A, 0xCA, 0x77, 0x73, 0xAA, 0xCA, 0xA9, 0x7A, 0xFF, 0x5A, 0xFF, 0xC9,
+    0x39, 0xE9, 0x2A, 0xD4, 0xAE, 0x3A, 0xD4, 0xF3, 0xAC, 0x94, 0xAF, 0x72, 0x9F, 0xC9, 0x71, 0xAF,
+    0xCA, 0x71, 0xAF, 0xD7, 0x19, 0xFC, 0xA7, 0x2A, 0xF4, 0xD4, 0xF3, 0xAD, 0x4A, 0xE3, 0xE9, 0x3F,
+    0x3F, 0xA9, 0x9F, 0x93, 0xFF, 0xD9, 0x59, 0xFD, 0xA7, 0x75, 0x49, 0xA3, 0xCA, 0x5D, 0x91, 0xD9,
+    0x5A, 0xD0, 0xDA, 0x7F, 0xA7, 0x0A, 0xE7, 0x2A, 0xA7, 0x77, 0x29, 0x71, 0xAF, 0xC6, 0xFE, 0x94,
+    0xE9, 0x09, 0xD5, 0xE7, 0x2F, 0x97, 0x09, 0xFA, 0x70, 0xAF, 0xA7, 0x09, 0xF9, 0x4A, 0x3E, 0xA3,
+    0xAD, 0x2A, 0xDA, 0x3F, 0x99, 0xE4, 0xFF, 0x95, 0xAF, 0xC7, 0x73, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD9, 0x0F, 0xFF, 0xE9, 0x0D, 0xA1, 0x9E, 0x91, 0xAD, 0x09, 0xD9,
+    0x1A, 0xE2, 0xAD, 0x1D, 0x2F, 0x2D, 0x91, 0x99, 0x2E, 0xA2, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x97,
+    0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xF7, 0x2F, 0xEA, 0x7A,
+    0xFE, 0x97, 0x77, 0x2A, 0xCA, 0x75, 0xEA, 0x75, 0xAC, 0xA7, 0x49, 0xD7, 0x4A, 0xD9, 0x74, 0xA9,
+    0x74, 0x59, 0x96, 0x9D, 0xA6, 0xE9, 0x6E, 0x5A, 0xFE, 0x90, 0xFF, 0xC1, 0x99, 0xEA, 0x99, 0x4E,
+    0x95, 0x9E, 0x6A, 0xE6, 0xAE, 0x6E, 0xA6, 0xE9, 0x59, 0xE1, 0x9C, 0xA1, 0x9F, 0xEA, 0x19, 0xFE,
+    0x3A, 0xF9, 0x77, 0x9C, 0xA9, 0x6A, 0xE7, 0x9D, 0x7D, 0x95, 0x9D, 0x96, 0x99, 0x70, 0x77, 0x59,
+    0xCA, 0x3D, 0x96, 0x9D, 0x90, 0x9D, 0xA7, 0x0E, 0xAD, 0xA7, 0x2F, 0x97, 0x4D, 0x97, 0x77, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD9, 0x0F, 0xFF, 0xE9, 0x0D, 0xA1, 0x9E,
+    0x91, 0xAD, 0x09, 0xD9, 0x1A, 0xE2, 0xAD, 0x1D, 0x2F, 0x2D, 0x91, 0x99, 0x2E, 0xA2, 0x99, 0x69,
+    0xE9, 0x73, 0xAE, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74,
+    0xF7, 0x2F, 0xEA, 0x7A, 0xFE, 0x96, 0x71, 0xCA, 0x71, 0x9D, 0x71, 0xAD, 0x69, 0x90, 0xD5, 0x9D,
+    0xA0, 0xCA, 0x5E, 0x90, 0xA6, 0xE7, 0xAF, 0xE9, 0x2F, 0xFC, 0x39, 0x9E, 0xA9, 0x96, 0xE9, 0x79,
+    0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x19, 0xCA, 0x39, 0xFE, 0xA3, 0x9F,
+    0xE5, 0xAF, 0x97, 0x71, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD9, 0x0F,
+    0xFF, 0xE9, 0x0D, 0xA1, 0x9E, 0x91, 0xAD, 0x09, 0xD9, 0x1A, 0xE2, 0xAD, 0x1D, 0x2F, 0x2D, 0x91,
+    0x99, 0x2E, 0xA2, 0x99, 0x69, 0xE9, 0x71, 0xAA, 0xFA, 0xAA, 0x69, 0xFF, 0xC7, 0x99, 0xF9, 0x97,
+    0x2E, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x4F, 0x72, 0xFE, 0xA7, 0xAF, 0xE9, 0x60, 0x59,
+    0x96, 0x9D, 0xA6, 0xE9, 0x6E, 0x5A, 0xFE, 0x90, 0xFF, 0xC1, 0x99, 0xEA, 0x99, 0x4E, 0x95, 0x9E,
+    0x4A, 0xFF, 0x1A, 0xFE, 0xA3, 0xEA, 0x6E, 0x95, 0x9E, 0x19, 0xCA, 0x19, 0xFE, 0xA1, 0x9F, 0xE3,
+    0xAF, 0x97, 0x50, 0x79, 0x92, 0x97, 0x3F, 0x0A, 0xC9, 0x71, 0xAF, 0xE9, 0x71, 0xAC, 0x1E, 0xA7,
+    0x79, 0x77, 0x72, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD,
+    0x92, 0xAF, 0xA9, 0x2F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93,
+    0xF6, 0xE4, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E,
+    0x4F, 0x5E, 0xA4, 0xAE, 0xA3, 0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77,
+    0x30, 0x6A, 0x92, 0x96, 0x9E, 0xA0, 0xAC, 0x95, 0xDA, 0xFC, 0x6C, 0xA0, 0x9E, 0x97, 0x39, 0x77,
+    0x69, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x3E, 0x39, 0xE2,
+    0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F, 0x3A, 0xDA, 0x09,
+    0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD, 0xA7, 0x70, 0x69, 0x99,
+    0x99, 0x99, 0x72, 0x9F, 0xE9, 0x71, 0xAF, 0xE7, 0x77, 0x77, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99,
+    0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A, 0xFA, 0x92, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD,
+    0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E, 0x4F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39,
+    0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5, 0xEA, 0x4A, 0xEA, 0x3A, 0xE5, 0x9F, 0xFE,
+    0xA6, 0xFF, 0xDA, 0x70, 0xAF, 0xDA, 0x77, 0x73, 0x4A, 0xFE, 0x6F, 0xF6, 0x99, 0x99, 0x99, 0x97,
+    0x75, 0x97, 0x2A, 0xF9, 0x29, 0xE0, 0x9F, 0xCA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE3, 0xE3, 0x9E,
+    0x29, 0xE3, 0xAD, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x2A, 0xE3, 0x9E, 0x19, 0xF3, 0xAD, 0xA0,
+    0x9F, 0xC0, 0x9A, 0x0F, 0xAD, 0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0x9F, 0x2A, 0xDA, 0x77, 0x00, 0x6A,
+    0x97, 0x79, 0xD2, 0x9C, 0x97, 0x19, 0xEA, 0xE7, 0x3F, 0xD7, 0x59, 0x99, 0x97, 0x77, 0x29, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A, 0xFA, 0x92, 0xF5,
+    0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E, 0x4F, 0x59, 0xE4,
+    0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5, 0xEA, 0x4A, 0xEA,
+    0x3A, 0xE5, 0x9F, 0xFE, 0xA6, 0xFF, 0xDA, 0x70, 0xAF, 0xDA, 0x77, 0x73, 0x59, 0x74, 0xAC, 0x92,
+    0x9C, 0x6E, 0xA9, 0xAC, 0xA6, 0x9F, 0xD7, 0x09, 0xAC, 0xA9, 0x77, 0x69, 0x72, 0xAF, 0x92, 0x9E,
+    0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3,
+    0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F, 0x3A, 0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0,
+    0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD, 0xA7, 0x70, 0x70, 0x9A, 0x97, 0x6F, 0xC7, 0x4A, 0xC9,
+    0x0A, 0xC9, 0x73, 0xD1, 0x9C, 0x97, 0x3A, 0xC9, 0x9D, 0x75, 0xF9, 0x76, 0x99, 0x70, 0x99, 0x99,
+    0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD, 0x92, 0xAF, 0xA9, 0x2F, 0x59,
+    0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93, 0xF6, 0xE4, 0xF5, 0x9E, 0x4E,
+    0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E, 0x4F, 0x5E, 0xA4, 0xAE, 0xA3,
+    0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77, 0x30, 0x69, 0xDA, 0x71, 0x9F,
+    0xC7, 0x0D, 0x1A, 0xC7, 0x0C, 0xA1, 0xAC, 0x70, 0xD9, 0x9D, 0x70, 0x9F, 0x73, 0x99, 0x70, 0x97,
+    0x2A, 0xF9, 0x29, 0xE0, 0x9F, 0xCA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE3, 0xE3, 0x9E, 0x29, 0xE3,
+    0xAD, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x2A, 0xE3, 0x9E, 0x19, 0xF3, 0xAD, 0xA0, 0x9F, 0xC0,
+    0x9A, 0x0F, 0xAD, 0x0F, 0xD0, 0xFD, 0x1F, 0xC1, 0x9F, 0x2A, 0xDA, 0x77, 0x00, 0x77, 0x97, 0x29,
+    0xCA, 0x2A, 0xC9, 0x70, 0xAE, 0x1F, 0x7F, 0x99, 0xF7, 0xEA, 0x09, 0xE9, 0x70, 0xC9, 0x29, 0xC9,
+    0x77, 0x70, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xE2, 0xFE, 0x99, 0xFD, 0x92,
+    0xAF, 0xA9, 0x2F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0xA3, 0xAE, 0x6E, 0x93, 0xF6,
+    0xE4, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xE9, 0x3A, 0xE6, 0xE4, 0xF5, 0x9E, 0x4F,
+    0x5E, 0xA4, 0xAE, 0xA3, 0xAE, 0x59, 0xFF, 0xEA, 0x6F, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7, 0x77, 0x30,
+    0x7A, 0x29, 0x70, 0xAC, 0xA1, 0xD6, 0x9D, 0xA0, 0xE6, 0xE0, 0xAD, 0x95, 0xAD, 0x09, 0xD9, 0x6A,
+    0xA1, 0x9C, 0x77, 0x69, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E,
+    0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F,
+    0x3A, 0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD, 0xA7,
+    0x70, 0x09, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A,
+    0xFA, 0x92, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E,
+    0x4F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5,
+    0xEA, 0x4A, 0xEA, 0x3A, 0xE5, 0x9F, 0xFE, 0x96, 0xFF, 0xD9, 0x70, 0xAF, 0xDA, 0x75, 0xAD, 0x76,
+    0x9D, 0x77, 0xDA, 0x77, 0xEA, 0xA9, 0x74, 0x9F, 0x77, 0x97, 0x30, 0x39, 0x72, 0xAF, 0x92, 0x9E,
+    0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3,
+    0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F, 0x3A, 0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0,
+    0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0x9E, 0x73, 0xAC, 0x73, 0x9C, 0x97, 0x3D, 0x74, 0xEA, 0x97,
+    0x1A, 0xE9, 0x73, 0x92, 0x77, 0x77, 0x69, 0xDA, 0x77, 0x49, 0xF9, 0x77, 0x29, 0xDA, 0xE7, 0x71,
+    0x9D, 0xA1, 0xDA, 0x77, 0x0A, 0xC9, 0x3A, 0x97, 0x77, 0x71, 0x99, 0x99, 0x99, 0x99, 0x71, 0x99,
+    0x99, 0x99, 0x1F, 0xEA, 0x2D, 0xA2, 0xAF, 0xD1, 0xAF, 0xCA, 0x29, 0xDA, 0x3A, 0xF9, 0x2A, 0xE9,
+    0x3F, 0x4E, 0x49, 0xE9, 0x3F, 0x3A, 0xDA, 0x49, 0xE9, 0x2A, 0xF3, 0xE6, 0xE9, 0x2F, 0xC2, 0xAD,
+    0xA6, 0xE9, 0x1A, 0xFC, 0x2E, 0x7E, 0x91, 0xD9, 0xE1, 0xAD, 0x97, 0xEA, 0x0A, 0xD0, 0xE1, 0xE7,
+    0x0E, 0xA0, 0xD9, 0x0E, 0x0A, 0xD9, 0x70, 0xAD, 0xAA, 0xD1, 0xAD, 0x0E, 0x71, 0xAD, 0xAD, 0xA1,
+    0xAD, 0xAD, 0x97, 0x1A, 0xFC, 0x2A, 0xFC, 0x72, 0x9F, 0xA2, 0x9F, 0x97, 0x29, 0xF3, 0x9F, 0x74,
+    0xEA, 0x39, 0xE9, 0x74, 0xE5, 0xE7, 0x77, 0x73, 0x71, 0x99, 0x77, 0xEA, 0x75, 0xAF, 0x74, 0x9D,
+    0x9D, 0xA7, 0x29, 0xD9, 0x09, 0xD7, 0x2A, 0xC9, 0x2A, 0xA7, 0x77, 0x71, 0x94, 0x92, 0xAE, 0x2A,
+    0xDA, 0x19, 0xE0, 0xAF, 0xA1, 0x9E, 0x2E, 0xA1, 0xAE, 0x2E, 0x91, 0xAD, 0xA2, 0xE2, 0xE9, 0x1A,
+    0xD9, 0x2E, 0x91, 0xEA, 0x1A, 0xD3, 0xAD, 0xA0, 0x9F, 0x1D, 0xA3, 0x9D, 0xA0, 0xAF, 0x09, 0xD9,
+    0x4D, 0xA0, 0xFC, 0x0E, 0x5D, 0xAA, 0xCA, 0xAD, 0x9D, 0x95, 0xFC, 0x0A, 0xFA, 0x6F, 0x90, 0xAF,
+    0x7E, 0x91, 0xAE, 0x70, 0xDA, 0x29, 0xD7, 0x77, 0x00, 0x77, 0x72, 0xDA, 0x75, 0xFA, 0x73, 0xEA,
+    0xD9, 0x70, 0x9E, 0x1A, 0xD7, 0x0A, 0xCA, 0x3A, 0x97, 0x76, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99,
+    0x99, 0x09, 0xFE, 0x1F, 0xE1, 0xFC, 0xA2, 0x9F, 0xA3, 0xF4, 0xE9, 0x4A, 0xE3, 0xAD, 0xA6, 0xE9,
+    0x2E, 0x7F, 0x1E, 0x70, 0x9E, 0x0A, 0xD9, 0x71, 0xEA, 0xDA, 0x72, 0xAF, 0xC7, 0x39, 0xF7, 0x5E,
+    0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5F, 0x73, 0xFE, 0xA7, 0x0A, 0xFE, 0x97, 0x72, 0x99,
+    0x75, 0xAD, 0xA7, 0x3A, 0xF7, 0x29, 0xD9, 0xDA, 0x70, 0x9D, 0x91, 0xD7, 0x0A, 0xC9, 0x2A, 0xA7,
+    0x77, 0x70, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA, 0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD,
+    0xA6, 0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0,
+    0xD9, 0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E,
+    0x79, 0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x77, 0x7A, 0xD1, 0xAD, 0x70, 0x9E, 0x09,
+    0xE7, 0x09, 0xDA, 0x0A, 0xDA, 0x71, 0x99, 0x29, 0x97, 0x77, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99,
+    0x99, 0x09, 0xFE, 0x1F, 0xE1, 0xFC, 0xA2, 0x9F, 0xA3, 0xF4, 0xE9, 0x4A, 0xE3, 0xAD, 0xA6, 0xE9,
+    0x2E, 0x7F, 0x1E, 0x70, 0x9E, 0x0A, 0xD9, 0x71, 0xEA, 0xDA, 0x72, 0xAF, 0xC7, 0x39, 0xF7, 0x5E,
+    0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5F, 0x73, 0xFE, 0xA7, 0x0A, 0xFE, 0x97, 0x77, 0x74,
+    0xCA, 0x74, 0x9E, 0x73, 0xFA, 0x72, 0xF9, 0x73, 0xA9, 0x77, 0x73, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x94, 0x9F, 0xFF, 0x3A, 0xFF, 0xF3, 0xE4, 0xF9, 0x3D, 0xA3, 0xFA, 0x4A, 0xC3, 0xAF, 0x72, 0x9F,
+    0x72, 0x9F, 0x73, 0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0x39, 0xC9, 0x39, 0xF4,
+    0xE3, 0xF9, 0x39, 0xDA, 0x2F, 0xA9, 0x99, 0x99, 0xE9, 0x2F, 0xFF, 0xC3, 0xFF, 0xFA, 0x77, 0x30,
+    0x77, 0x7C, 0xA7, 0x2A, 0xD9, 0x71, 0xE7, 0x1E, 0x97, 0x09, 0xD7, 0x3A, 0x77, 0x75, 0x94, 0xAF,
+    0x90, 0xE2, 0x9F, 0xFD, 0x2A, 0xDA, 0xFD, 0x3A, 0xCA, 0x2E, 0x93, 0x9C, 0x2E, 0x97, 0x0A, 0xD9,
+    0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x92, 0xA4, 0xAD, 0xA2, 0x9D, 0x2A, 0xFD, 0xAE, 0x2F,
+    0xFE, 0x2D, 0xA0, 0x9F, 0xC7, 0x70, 0x71, 0x99, 0x75, 0xE7, 0x4A, 0xE7, 0x4A, 0xDA, 0x75, 0x97,
+    0x77, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x49, 0xFF, 0xF3, 0xAF, 0xFF, 0x3E, 0x4F, 0x93, 0xDA,
+    0x3F, 0xA4, 0xAC, 0x3A, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xA7, 0x2A,
+    0xF7, 0x29, 0xF3, 0x9C, 0x93, 0x9F, 0x4E, 0x3F, 0x93, 0x9D, 0xA2, 0xFA, 0x99, 0x99, 0x9E, 0x92,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xA7, 0x73, 0x79, 0x97, 0x2E, 0x71, 0x9E, 0x71, 0x9D, 0xA7, 0x77, 0x77,
+    0x29, 0x4A, 0xF9, 0x0E, 0x29, 0xFF, 0xD2, 0xAD, 0xAF, 0xD3, 0xAC, 0xA2, 0xE9, 0x39, 0xC2, 0xE9,
+    0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x2A, 0x4A, 0xDA, 0x29, 0xD2, 0xAF,
+    0xDA, 0xE2, 0xFF, 0xE2, 0xDA, 0x09, 0xFC, 0x77, 0x00, 0x77, 0x6D, 0x3A, 0xD7, 0xE1, 0xAD, 0x97,
+    0x9D, 0xAE, 0x72, 0xAF, 0x74, 0xAD, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFF,
+    0x3A, 0xFF, 0xF3, 0xE4, 0xF9, 0x3D, 0xA3, 0xFA, 0x4A, 0xC3, 0xAF, 0x72, 0x9F, 0x72, 0x9F, 0x73,
+    0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0x39, 0xC9, 0x39, 0xF4, 0xE3, 0xF9, 0x39,
+    0xDA, 0x2F, 0xA9, 0x99, 0x99, 0xE9, 0x2F, 0xFF, 0xC3, 0xFF, 0xFA, 0x77, 0x30, 0x4A, 0xA2, 0x9C,
+    0xA5, 0xD1, 0x9D, 0x95, 0xDA, 0x9D, 0x96, 0x9F, 0x97, 0x0E, 0xA7, 0x19, 0xAA, 0x77, 0x75, 0x94,
+    0xAF, 0x90, 0xE2, 0x9F, 0xFD, 0x2A, 0xDA, 0xFD, 0x3A, 0xCA, 0x2E, 0x93, 0x9C, 0x2E, 0x97, 0x0A,
+    0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x92, 0xA4, 0xAD, 0xA2, 0x9D, 0x2A, 0xFD, 0xAE,
+    0x2F, 0xFE, 0x2D, 0xA0, 0x9F, 0xC7, 0x70, 0x74, 0x99, 0xA9, 0x75, 0xFD, 0x73, 0xFE, 0x97, 0x1A,
+    0xDA, 0x1D, 0x72, 0xE7, 0x6A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x6E, 0x76, 0x9E, 0x76, 0xAE, 0x76,
+    0xEA, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE7,
+    0x6A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x1A, 0xA1, 0x9E, 0x71, 0x9E, 0xAE, 0x97, 0x19, 0xFD, 0x97,
+    0x3A, 0xEA, 0x74, 0x77, 0x19, 0xA7, 0x71, 0xE9, 0x77, 0x0E, 0x97, 0x9A, 0xAA, 0xA9, 0x1A, 0xDA,
+    0x6F, 0xFC, 0xAD, 0xA5, 0x9F, 0xFF, 0x95, 0x9F, 0x91, 0x9F, 0xC5, 0x9F, 0x5F, 0x94, 0xF9, 0x5A,
+    0xEA, 0x39, 0xF6, 0xAE, 0xA3, 0xAE, 0x96, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7,
+    0xF9, 0x3F, 0x7F, 0x4F, 0x6A, 0xEA, 0x4F, 0x94, 0x9F, 0x5A, 0xF3, 0x9F, 0x96, 0xFC, 0xAA, 0xFC,
+    0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x77, 0x50, 0x73, 0x9C, 0xA7, 0x4A, 0xD7, 0x99, 0x2E,
+    0x5A, 0xFC, 0xAD, 0x49, 0xFF, 0xC4, 0x9E, 0xA0, 0x9E, 0xA4, 0xEA, 0x2F, 0x39, 0xE3, 0xAE, 0x3E,
+    0xA3, 0xAE, 0x3E, 0x93, 0xEA, 0x3E, 0x93, 0xE9, 0x29, 0xE9, 0x29, 0xE4, 0xE9, 0x2E, 0x94, 0xF9,
+    0x9F, 0x59, 0xFE, 0xA7, 0x9F, 0xC9, 0x77, 0x60, 0x49, 0xAA, 0xAC, 0xAA, 0x95, 0x9F, 0xFE, 0xA2,
+    0xAF, 0xFF, 0xD1, 0xE0, 0x9E, 0x91, 0xF9, 0x0D, 0xA0, 0x9E, 0x29, 0xEA, 0x19, 0x1A, 0xE2, 0x9E,
+    0xA4, 0xF2, 0x9E, 0x94, 0xEA, 0x2F, 0x49, 0xE9, 0x1A, 0xE9, 0x4A, 0xEA, 0xAF, 0xA5, 0xFF, 0xC9,
+    0x6F, 0xAA, 0x97, 0x1E, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x2A, 0xFE, 0x79, 0xFF, 0x70,
+    0x71, 0x9A, 0x99, 0x71, 0x9F, 0xCA, 0x70, 0xFE, 0x7E, 0x19, 0xC9, 0x69, 0xDA, 0x73, 0xAD, 0x74,
+    0xE2, 0x97, 0x9D, 0xA0, 0x9E, 0xA5, 0xAD, 0x9A, 0xFC, 0x5E, 0xAD, 0xAE, 0x94, 0xFA, 0x1E, 0xA4,
+    0xF2, 0xEA, 0x39, 0xE9, 0x2E, 0x93, 0xAE, 0x3E, 0x4E, 0x92, 0xAE, 0x4E, 0x3E, 0x93, 0x9E, 0x2A,
+    0xE4, 0xAE, 0xA9, 0xAE, 0x94, 0xFF, 0xC9, 0x5E, 0xAF, 0x69, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x72,
+    0x9F, 0x97, 0x09, 0xFE, 0x79, 0xAA, 0xAA, 0xAA, 0xA7, 0x59, 0x96, 0x9D, 0xA6, 0xE9, 0x6E, 0x5A,
+    0xFE, 0x90, 0xFF, 0xC1, 0x99, 0xEA, 0x99, 0x4E, 0x95, 0x9E, 0x6A, 0xE6, 0xAE, 0x6E, 0xA6, 0xE9,
+    0x19, 0x29, 0xE1, 0xAC, 0x91, 0x9F, 0xE9, 0x19, 0xFE, 0x92, 0xAF, 0xD7, 0xDA, 0x7D, 0x93, 0xA1,
+    0x9D, 0x3A, 0xCA, 0x9D, 0x93, 0xFC, 0xA4, 0x9E, 0x94, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0x9F, 0xFF, 0xD0, 0xAF, 0xFF, 0xDA, 0x0E, 0xA1, 0xF1, 0x9D, 0xA9, 0xE2, 0xEA, 0x19, 0xD9, 0x0D,
+    0xA1, 0x9E, 0x91, 0x9D, 0x29, 0x91, 0xAE, 0x39, 0x7F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x39, 0xE9,
+    0x73, 0xAE, 0x74, 0xF7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x97, 0x1A, 0xFE, 0x70, 0xFF, 0x60,
+    0x79, 0xA9, 0x96, 0x9F, 0xCA, 0x49, 0xFE, 0x4E, 0x19, 0xC4, 0x9D, 0xA7, 0x0E, 0x97, 0x0E, 0x7A,
+    0xFE, 0x92, 0xFF, 0xC3, 0x99, 0xEA, 0x99, 0x6E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xEA,
+    0x70, 0xE9, 0x79, 0xE1, 0x9C, 0xA3, 0x9F, 0xEA, 0x39, 0xFE, 0x5A, 0xF9, 0x77, 0x10, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD9, 0x0F, 0xFF, 0xE9, 0x0D, 0xA1, 0x9E, 0x91,
+    0xAD, 0x09, 0xD9, 0x1A, 0xE2, 0xAD, 0x1D, 0x2F, 0x2D, 0x91, 0x99, 0x2E, 0xA2, 0x99, 0x69, 0xE9,
+    0x73, 0xAE, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xF7,
+    0x4E, 0xA7, 0x39, 0xE9, 0x73, 0x9E, 0x74, 0x9E, 0x90, 0xD7, 0x1F, 0xE7, 0x1A, 0xFC, 0x97, 0x2A,
+    0xDA, 0x96, 0x77, 0x29, 0x97, 0x72, 0xE9, 0x77, 0x1E, 0x19, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99,
+    0xAE, 0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xD9, 0x2A, 0xFA, 0x95, 0xF5, 0x9E, 0x7E, 0xA5, 0xAE,
+    0x69, 0xE9, 0x5E, 0xA6, 0xAE, 0x6E, 0x96, 0xF6, 0xE7, 0xF5, 0x9E, 0x7E, 0xA5, 0xAD, 0xA6, 0x9E,
+    0x95, 0xE9, 0x6A, 0xE6, 0xE7, 0xF5, 0x9E, 0x7F, 0x5E, 0xA7, 0xAE, 0xA3, 0xAE, 0x70, 0x9F, 0xFE,
+    0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA7, 0x77, 0x71, 0x76, 0xAC, 0x76, 0x9D, 0x93, 0x97, 0xAE,
+    0x1A, 0xF9, 0x29, 0xFA, 0x19, 0xFC, 0xA2, 0xEA, 0x6E, 0x92, 0xE9, 0x6E, 0x3E, 0x69, 0xE2, 0x9E,
+    0x6A, 0xDA, 0x2E, 0xA6, 0xE9, 0x2E, 0x96, 0xE2, 0xAE, 0x69, 0xE1, 0x9F, 0x6A, 0xDA, 0x09, 0xFC,
+    0x09, 0xA3, 0xFA, 0xD0, 0xFD, 0x3F, 0xD1, 0xFC, 0x49, 0xF2, 0xAD, 0xA7, 0x76, 0x09, 0x92, 0x9D,
+    0x29, 0xE2, 0xEA, 0x2A, 0xD3, 0x9C, 0x60, 0x70, 0xCA, 0x2A, 0xD1, 0x9E, 0x1E, 0x19, 0xD3, 0xA3,
+    0x49, 0x94, 0x9E, 0x4F, 0xA2, 0xDA, 0x9D, 0x1E, 0x1D, 0xA9, 0xD3, 0xC9, 0x70, 0x19, 0xA9, 0x29,
+    0x19, 0xEA, 0x0A, 0xC1, 0xDA, 0xFC, 0x1C, 0xA0, 0x9E, 0x96, 0x92, 0x0A, 0xFE, 0x0F, 0xEA, 0x09,
+    0x99, 0x99, 0x99, 0x00, 0x09, 0x5A, 0xC9, 0x29, 0xF9, 0x9A, 0xCA, 0x9F, 0xD1, 0x9A, 0xCA, 0x91,
+    0x19, 0x09, 0xFF, 0xD9, 0x09, 0x10, 0x72, 0x9D, 0x1A, 0xD1, 0xE9, 0x9E, 0x1E, 0x09, 0xDA, 0x29,
+    0x60, 0x09, 0xAD, 0x90, 0xAF, 0xC9, 0xD1, 0xD9, 0x99, 0x1D, 0x2A, 0xD9, 0x1A, 0xCA, 0x39, 0xC9,
+    0x71, 0x19, 0xDA, 0x29, 0xFC, 0x1D, 0x1D, 0x1C, 0xA1, 0xAC, 0x1D, 0x99, 0xCA, 0x1A, 0xF4, 0x99,
+    0x20, 0x3A, 0x29, 0x4A, 0xCA, 0x09, 0xD2, 0x9D, 0xA0, 0xE2, 0xE0, 0xAD, 0x2D, 0xA0, 0x9D, 0x3C,
+    0xA1, 0x9C, 0x76, 0x0C, 0x3A, 0xC9, 0xAC, 0xA1, 0xAD, 0x09, 0xD9, 0xAD, 0x2F, 0xC3, 0x9E, 0x94,
+    0xAA, 0x93, 0x49, 0x19, 0xCA, 0x0A, 0xC9, 0x0A, 0xD0, 0xDA, 0x1D, 0x09, 0xD1, 0xAC, 0x90, 0xD9,
+    0x1C, 0x90, 0x9C, 0x70, 0x39, 0x99, 0x39, 0xFC, 0x1A, 0xFD, 0xA0, 0xCA, 0x2A, 0xCA, 0x09, 0x4A,
+    0x00, 0x70, 0xD2, 0xD2, 0xAC, 0xA2, 0xD9, 0x2D, 0xA2, 0xE3, 0x92, 0x19, 0xD9, 0x1A, 0xE2, 0xE2,
+    0xD9, 0x1A, 0xD1, 0xAD, 0x2A, 0xA2, 0x0A, 0xCA, 0x0A, 0xDA, 0x0E, 0x1D, 0xA1, 0xAD, 0x2D, 0x29,
+    0xA1, 0x09, 0x91, 0xDA, 0x0D, 0x99, 0xD0, 0xAC, 0xA0, 0xD2, 0x91, 0x19, 0xCA, 0x2A, 0xD2, 0xE1,
+    0xAD, 0x2D, 0x39, 0x30, 0x4A, 0xCA, 0xAF, 0xDA, 0x9C, 0xA0, 0x1A, 0xA2, 0xA9, 0x1E, 0x90, 0xE1,
+    0xE0, 0x9E, 0x19, 0xA2, 0xAA, 0x10, 0x1A, 0xA9, 0x1F, 0xAA, 0xC1, 0xCA, 0xAC, 0x1C, 0xA9, 0xF2,
+    0x99, 0x10, 0x19, 0xA9, 0x1E, 0x1D, 0xA1, 0xD1, 0xD9, 0x19, 0x20, 0x1A, 0xCA, 0x2E, 0x92, 0xD9,
+    0x1A, 0xD1, 0xAD, 0x2A, 0x92, 0x29, 0x3C, 0xA2, 0xD2, 0x9C, 0xA2, 0xAD, 0xAA, 0x1F, 0x29, 0x20,
+    0x09, 0xAA, 0x1A, 0xD1, 0xE1, 0xDA, 0x09, 0xD9, 0x0A, 0xD9, 0x50, 0x49, 0x94, 0x9E, 0x93, 0xFC,
+    0x19, 0xDA, 0x9D, 0xA9, 0xDA, 0x19, 0xD0, 0x94, 0x90, 0x7A, 0xC4, 0xF9, 0x09, 0xCA, 0xAF, 0xD1,
+    0xAE, 0xA7, 0x10, 0x1A, 0xCA, 0x19, 0xA1, 0xAF, 0x0D, 0x1D, 0x9F, 0xC1, 0xC9, 0x1E, 0x73, 0x19,
+    0x99, 0x99, 0x91, 0xFF, 0x0F, 0xEA, 0x39, 0x92, 0x9F, 0xC0, 0x9F, 0xFC, 0x2A, 0xDA, 0x4C, 0x90,
+    0x77, 0x9C, 0xA6, 0xE5, 0xE9, 0x4A, 0xD9, 0x5A, 0xC7, 0x6D, 0xA0, 0x9D, 0x90, 0xAD, 0xA0, 0xEA,
+    0x0A, 0xD1, 0xAD, 0x73, 0x19, 0x2D, 0x19, 0xD1, 0x9E, 0xA0, 0xE5, 0x73, 0x9A, 0xA7, 0x7A, 0xE7,
+    0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7, 0x29, 0xD9,
+    0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6, 0x9F, 0xFF,
+    0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE, 0x99, 0xFD,
+    0xA2, 0xAF, 0xE9, 0x49, 0xAA, 0xAC, 0xAA, 0x95, 0xAF, 0xFD, 0x39, 0xFD, 0xAF, 0xC3, 0x90, 0xAE,
+    0x19, 0xE9, 0x4E, 0xA2, 0xEA, 0x4E, 0x92, 0xE9, 0x39, 0xE9, 0x2E, 0x4A, 0xE2, 0xE9, 0x4A, 0xFF,
+    0x95, 0xFF, 0xD9, 0x4E, 0x90, 0x9A, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A, 0xE3, 0x9E, 0x92, 0xF3, 0xAE,
+    0x3E, 0xA3, 0xF2, 0x9E, 0xA1, 0x9F, 0x19, 0xFF, 0xF2, 0xAF, 0xFC, 0xA9, 0x77, 0x30, 0x39, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x4A, 0xFF, 0xE5, 0xAE, 0x3E, 0x5F, 0x3D, 0xA5, 0xEA,
+    0x3D, 0x94, 0x9E, 0x93, 0xCA, 0x5A, 0xE7, 0x4A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3A,
+    0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x19, 0xFF, 0x7A, 0xFE, 0xA7, 0x72, 0xAA, 0x97, 0x39,
+    0xEA, 0x73, 0xFC, 0x72, 0xAF, 0xC7, 0x2D, 0xAE, 0x97, 0x0E, 0x0E, 0x97, 0x9D, 0x90, 0xAD, 0xA7,
+    0xE1, 0xAE, 0x6A, 0xD9, 0x19, 0xE6, 0xE2, 0x9E, 0x94, 0xAD, 0x93, 0xE9, 0x39, 0xE4, 0xEA, 0x3E,
+    0x5F, 0x2A, 0xDA, 0x5A, 0xE2, 0xE6, 0xAE, 0x90, 0xAE, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0x0F, 0xFF,
+    0xEA, 0x0F, 0xFF, 0xE9, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE,
+    0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF,
+    0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E,
+    0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x49, 0xFF, 0xF3, 0xAF, 0xFF, 0x3E, 0x4F, 0x93, 0xDA, 0x3F, 0xA4, 0xAC, 0x3A,
+    0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xA7, 0x2A, 0xF7, 0x29, 0xF3, 0x9C,
+    0x93, 0x9F, 0x4E, 0x3F, 0x93, 0x9D, 0xA2, 0xFA, 0x99, 0x99, 0x9E, 0x92, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xA7, 0x73, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xE9, 0x1F, 0xEA, 0x3A,
+    0xFC, 0x92, 0xAF, 0xCA, 0x5A, 0xE5, 0x9E, 0x96, 0xF5, 0xAE, 0x7E, 0xA5, 0xF6, 0x9E, 0x95, 0xEA,
+    0x6A, 0xE9, 0x49, 0xE9, 0x6A, 0xFF, 0xFC, 0x96, 0xFF, 0xFD, 0x7E, 0xA9, 0x99, 0x99, 0x9F, 0x69,
+    0xE9, 0x5E, 0xA6, 0xAE, 0x59, 0xE9, 0x6F, 0x5A, 0xE7, 0xF5, 0xF6, 0x9E, 0xA5, 0xF4, 0x9F, 0xE9,
+    0x1F, 0xE9, 0x2A, 0xFE, 0x19, 0xFE, 0x92, 0x79, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE,
+    0x93, 0x9F, 0x92, 0xFC, 0x29, 0xF5, 0xF9, 0x1F, 0x6A, 0xEA, 0x09, 0xEA, 0x69, 0xEA, 0x0A, 0xE7,
+    0x9E, 0xA0, 0xF0, 0x9F, 0xCA, 0x9E, 0xA0, 0xF0, 0xFD, 0x99, 0xEA, 0x0E, 0xA0, 0x99, 0x99, 0x91,
+    0xAE, 0x90, 0xF7, 0xF1, 0xF6, 0x9E, 0xA1, 0xF6, 0xF2, 0xAF, 0x4F, 0x93, 0xFC, 0xA9, 0xAF, 0x94,
+    0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x39, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xEA, 0x3A, 0xFC,
+    0xA5, 0xAE, 0x7F, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE9,
+    0x6A, 0xE7, 0xF6, 0x9E, 0xA4, 0x9F, 0xE9, 0x2A, 0xFE, 0x92, 0x39, 0x99, 0x99, 0x99, 0x29, 0x99,
+    0x99, 0x92, 0x9F, 0xE9, 0x0F, 0xDA, 0x3A, 0xFC, 0x91, 0x9F, 0xA5, 0xAE, 0x3A, 0xE7, 0xF2, 0xF7,
+    0x0E, 0xA1, 0xEA, 0x70, 0x9E, 0x90, 0xEA, 0x71, 0xAE, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xE7,
+    0x4F, 0xEA, 0x72, 0x9E, 0x9A, 0xE9, 0x71, 0xAE, 0x1F, 0x71, 0xF1, 0x9F, 0x70, 0xEA, 0x2F, 0xA6,
+    0x9E, 0xA3, 0xFC, 0x39, 0xFE, 0x29, 0xFC, 0x91, 0xAF, 0xE3, 0x9F, 0x77, 0x60, 0x73, 0x9A, 0x97,
+    0x7F, 0x76, 0xAF, 0x76, 0xFC, 0x75, 0xAF, 0xC9, 0x73, 0x9D, 0x9A, 0xDA, 0x73, 0xE0, 0xAD, 0xA7,
+    0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x19, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0x97, 0xE9, 0x3E,
+    0xA6, 0x9E, 0x4F, 0x6E, 0x5A, 0xE5, 0xAD, 0xA5, 0xAE, 0x5E, 0x69, 0xEA, 0x2A, 0xFC, 0x92, 0x9F,
+    0xE0, 0x9F, 0xDA, 0x2F, 0xF0, 0x59, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x5A, 0xFD, 0x5F, 0xD5,
+    0x9F, 0xD4, 0xAF, 0xA7, 0x9F, 0xC4, 0xFC, 0x70, 0xAF, 0xC3, 0xFD, 0x70, 0xDA, 0xE9, 0x19, 0xDA,
+    0xE7, 0x0D, 0x9E, 0x91, 0xDA, 0x9E, 0x7A, 0xD0, 0xAD, 0xA0, 0x9D, 0x0A, 0xDA, 0x7E, 0x0A, 0xDA,
+    0x0D, 0xA0, 0xAD, 0xA7, 0xDA, 0x09, 0xE9, 0xD1, 0xAD, 0xA6, 0x9D, 0x2F, 0xC9, 0x1E, 0xA6, 0xE2,
+    0xFC, 0x2E, 0xA6, 0xDA, 0x2F, 0x92, 0xE9, 0x59, 0xD9, 0x2A, 0xE3, 0xE9, 0x5A, 0xD3, 0x9D, 0x93,
+    0xE9, 0x5E, 0x39, 0xCA, 0x39, 0xE9, 0x3A, 0xFC, 0x96, 0x9F, 0xE1, 0x9F, 0xD9, 0x6F, 0xF1, 0x39,
+    0x99, 0x99, 0x59, 0x99, 0x99, 0x93, 0x9F, 0xCA, 0x3A, 0xFD, 0x93, 0xAF, 0xC3, 0x9A, 0xF9, 0x5A,
+    0xF9, 0x4E, 0x7F, 0xD4, 0xE7, 0xFD, 0x92, 0x9D, 0xA6, 0x9F, 0xDA, 0x29, 0xD9, 0x69, 0xD9, 0xF2,
+    0xAD, 0x7A, 0xD0, 0x9E, 0xA1, 0xE7, 0xE1, 0xF1, 0xE7, 0xE1, 0x9E, 0xA9, 0xDA, 0x69, 0xDA, 0x2F,
+    0xAD, 0x96, 0xAD, 0x92, 0xAF, 0xD7, 0xE4, 0xFD, 0x7E, 0x4A, 0xFA, 0x69, 0xE5, 0xFA, 0x5A, 0xFC,
+    0x93, 0xF9, 0x4A, 0xFD, 0x93, 0x9E, 0x77, 0x29, 0x70, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94,
+    0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x9D, 0xA9, 0x92, 0x99, 0xE3, 0x9D, 0x7D, 0xA3, 0x9C, 0xA7, 0xD7,
+    0x77, 0x77, 0x29, 0xFE, 0x97, 0x0A, 0xFE, 0x71, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x70, 0x9A, 0x70,
+    0xA9, 0x39, 0xD7, 0x0D, 0x3A, 0xD7, 0xAD, 0x3E, 0xAA, 0xAA, 0xAA, 0xAF, 0x3F, 0xFF, 0xCA, 0x29,
+    0xFF, 0xFC, 0xA2, 0x79, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F,
+    0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7,
+    0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A,
+    0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x39, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xFF, 0xC4, 0xAF, 0xFF, 0xDA, 0x95, 0xAE,
+    0x49, 0xEA, 0x7F, 0x49, 0xE9, 0x7E, 0xA4, 0xAE, 0x79, 0xE9, 0x4A, 0xE7, 0xAE, 0x5F, 0x7A, 0xE5,
+    0xEA, 0x7F, 0x49, 0xE9, 0x7E, 0xA4, 0xAE, 0x79, 0xE9, 0x4F, 0x7A, 0xE5, 0xF7, 0xF5, 0xEA, 0x7F,
+    0x49, 0xE9, 0x69, 0xEA, 0x4A, 0xE9, 0x49, 0xFE, 0x90, 0xAF, 0xE3, 0xAF, 0xE1, 0xFE, 0xA3, 0x49,
+    0xAA, 0xAC, 0xAA, 0x96, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0x93, 0x90, 0xAE, 0x1A, 0xF5, 0xF2, 0xF5,
+    0xEA, 0x2A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xAE, 0x2F, 0x5F, 0xAF, 0xC6, 0xFF, 0xA6,
+    0x9F, 0xAA, 0x97, 0x0A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x19, 0xFF, 0x7A, 0xFE, 0xA7,
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0x39, 0xFF, 0xF4, 0xF4, 0xAD, 0x49, 0xEA, 0x3A,
+    0xCA, 0x5F, 0x3A, 0xC7, 0xEA, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0xE9, 0x73, 0xE9, 0x73, 0xEA, 0x73,
+    0xEA, 0x3A, 0xC9, 0x4E, 0xA4, 0xD9, 0x3E, 0xA4, 0xAD, 0x3F, 0xAA, 0xAA, 0xAF, 0x29, 0xFF, 0xFA,
+    0x3F, 0xFF, 0x77, 0x40, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD9, 0x0F,
+    0xFF, 0xE9, 0x0D, 0xA1, 0x9E, 0x91, 0xAD, 0x09, 0xD9, 0x1A, 0xE2, 0xAD, 0x1D, 0x2F, 0x2D, 0x91,
+    0x99, 0x2E, 0xA2, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E,
+    0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xF7, 0x2F, 0xEA, 0x7A, 0xFE, 0x96, 0x19, 0xAA, 0x79, 0xA9, 0x09,
+    0xFA, 0x5A, 0xE0, 0xFD, 0x4A, 0xF2, 0xAE, 0x93, 0xEA, 0x4E, 0xA2, 0xF5, 0xF1, 0x9E, 0x69, 0xE1,
+    0xE7, 0x0E, 0x0A, 0xD9, 0x70, 0xE9, 0xDA, 0x71, 0xAF, 0xC7, 0x29, 0xF9, 0x73, 0xF7, 0x4E, 0xA7,
+    0x39, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x2A, 0xFD, 0xA7, 0x9F, 0xEA, 0x60, 0x6A, 0xFE, 0x72, 0xAF,
+    0xD9, 0x74, 0xEA, 0x74, 0x9A, 0xEA, 0x99, 0x7A, 0xFF, 0xE9, 0x4F, 0xAF, 0xAF, 0x92, 0xF1, 0xEA,
+    0x1F, 0x1A, 0xE2, 0xE9, 0x1A, 0xE1, 0xE9, 0x2E, 0x29, 0xE0, 0x9E, 0x91, 0x9E, 0x2A, 0xE0, 0x9E,
+    0x91, 0xAE, 0x2E, 0xA1, 0xEA, 0x1E, 0xA1, 0xAE, 0x2A, 0xEA, 0x9E, 0x99, 0xF9, 0x3F, 0xFF, 0xC6,
+    0x9A, 0xFD, 0xA9, 0x73, 0xAD, 0xA7, 0x5A, 0xFA, 0x73, 0xFE, 0x97, 0x29, 0x99, 0x99, 0x99, 0x70,
+    0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x93, 0x9F, 0xE1, 0xFE, 0x4A, 0xFA, 0x29, 0xFA, 0x69,
+    0xE9, 0x3E, 0x71, 0xF2, 0xE9, 0x71, 0x9E, 0x90, 0xE9, 0x73, 0xFA, 0xD9, 0x74, 0xAF, 0xCA, 0x76,
+    0xFA, 0x77, 0xF7, 0x7F, 0xCA, 0x75, 0xAF, 0xD7, 0x4A, 0xD9, 0x0E, 0xA7, 0x2A, 0xDA, 0x1A, 0xE7,
+    0x19, 0xE3, 0xEA, 0x79, 0xE4, 0xAE, 0x94, 0x9F, 0xD9, 0x1F, 0xE3, 0xFE, 0x90, 0xAF, 0xE3, 0x0A,
+    0xA9, 0x29, 0x99, 0x99, 0x99, 0x29, 0xAA, 0x90, 0xE9, 0x1F, 0xE1, 0x9E, 0x90, 0xAE, 0x1A, 0xFC,
+    0x91, 0xEA, 0x1A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2E, 0xA2, 0xEA, 0x2A, 0xDA, 0x2E, 0x92, 0xE3,
+    0xAD, 0xA1, 0x9E, 0x2A, 0xE3, 0xAD, 0xA1, 0x9E, 0x2E, 0x93, 0xAE, 0x1A, 0xE1, 0x9E, 0x49, 0xE1,
+    0xEA, 0x09, 0xE9, 0x5F, 0x9E, 0xAA, 0xEA, 0x69, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0x97, 0x5F, 0x77,
+    0x0E, 0xA7, 0x79, 0xEA, 0x75, 0x9F, 0xE7, 0x4A, 0xFE, 0x71, 0x71, 0x9A, 0xAC, 0xA9, 0x72, 0x9F,
+    0xFC, 0x97, 0xAF, 0xFE, 0x95, 0xAF, 0x92, 0x9F, 0x49, 0xF5, 0xAE, 0x93, 0xF6, 0x9E, 0xA3, 0xEA,
+    0x69, 0xEA, 0x29, 0xE9, 0x69, 0xE9, 0x2A, 0xE9, 0x6A, 0xE9, 0x29, 0xE9, 0x6F, 0x39, 0xE9, 0x6E,
+    0x94, 0xE9, 0x5A, 0xDA, 0x39, 0x0A, 0xDA, 0x49, 0xE3, 0xAC, 0x1E, 0x39, 0xE1, 0xD0, 0xD1, 0x9D,
+    0x91, 0x9D, 0xA1, 0xAD, 0x9D, 0xAA, 0xAE, 0x1E, 0xAA, 0xAD, 0xA9, 0xFE, 0x90, 0x9F, 0xF9, 0xAF,
+    0xE2, 0xFF, 0x00, 0x69, 0x72, 0x9F, 0xA1, 0xD9, 0x29, 0xFD, 0x99, 0xDA, 0x19, 0xEA, 0x9D, 0xAE,
+    0x2E, 0xA1, 0x9F, 0xA1, 0x9E, 0x3F, 0x2E, 0xA3, 0xEA, 0x2E, 0x93, 0xE3, 0xE3, 0x9D, 0xA2, 0x9E,
+    0x3E, 0xA3, 0xE9, 0x1F, 0xA1, 0x90, 0xFA, 0xE9, 0xDA, 0xD0, 0xAF, 0xD9, 0x0F, 0xA1, 0xAE, 0xA2,
+    0xAD, 0xA7, 0x70, 0x70, 0x9A, 0x97, 0x1A, 0xFC, 0xA6, 0xAF, 0xE5, 0xAD, 0xA1, 0xAD, 0x94, 0xE2,
+    0xAD, 0x93, 0x9D, 0xA2, 0xAD, 0x93, 0xE9, 0x2E, 0x4E, 0x29, 0xD9, 0x4E, 0x19, 0xDA, 0x49, 0xE0,
+    0x9E, 0x5A, 0xDA, 0x0F, 0xC4, 0xAD, 0x92, 0xEA, 0x3E, 0x92, 0xAE, 0x3E, 0x39, 0xE2, 0x9E, 0x39,
+    0xE2, 0x9D, 0xA3, 0xAD, 0xA2, 0xAD, 0xA3, 0xE3, 0xF9, 0x09, 0xEA, 0x3F, 0xFD, 0x4E, 0xAF, 0xA4,
+    0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9C, 0xA9, 0x72, 0x71, 0x92, 0xAE,
+    0x91, 0x9E, 0x9A, 0xFC, 0x2E, 0xA0, 0x9A, 0xE2, 0xEA, 0x2E, 0x91, 0xAD, 0xA2, 0xE9, 0x1E, 0x3A,
+    0xDA, 0x1E, 0x3A, 0xDA, 0x09, 0xD9, 0x39, 0xDA, 0x0D, 0xA4, 0x9D, 0xAA, 0xD6, 0xFC, 0x96, 0xFA,
+    0x7F, 0x70, 0xE7, 0x1D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9E, 0x70, 0xAD, 0xA7, 0x0D, 0xA7, 0x70,
+    0x9A, 0x97, 0x0A, 0xFC, 0x6F, 0xEA, 0x4A, 0xD2, 0xDA, 0x4E, 0x3C, 0x94, 0xEA, 0x71, 0xAE, 0x97,
+    0x1F, 0x97, 0xFD, 0x5A, 0xFE, 0xA3, 0xAE, 0x90, 0xAE, 0x3E, 0x92, 0xE9, 0x1A, 0xE3, 0xEA, 0x1E,
+    0x93, 0xEA, 0x1E, 0x93, 0xEA, 0x09, 0xE9, 0x3E, 0x91, 0xE9, 0x2A, 0xE2, 0xF9, 0x9A, 0xE9, 0x29,
+    0xFF, 0x94, 0x9F, 0xCA, 0x77, 0x20, 0x69, 0x96, 0x9F, 0xD3, 0xAF, 0xE9, 0x19, 0xE9, 0x09, 0xAC,
+    0x2A, 0xDA, 0x7A, 0xDA, 0x70, 0xFC, 0x94, 0x9F, 0xC9, 0x39, 0xEA, 0x99, 0x4E, 0x97, 0xE4, 0x99,
+    0x1F, 0xA9, 0xAD, 0xA1, 0xFF, 0xC3, 0xAF, 0xCA, 0x76, 0x29, 0x97, 0x0A, 0xDA, 0x39, 0x2E, 0x2A,
+    0xD2, 0xEA, 0x9F, 0x91, 0x9F, 0xF4, 0x9E, 0xA9, 0x5E, 0x7A, 0xD9, 0x69, 0xDA, 0x7E, 0x7A, 0xDA,
+    0x7E, 0x96, 0x9E, 0x7A, 0xDA, 0x7E, 0xA7, 0xEA, 0x7F, 0x96, 0xAF, 0xA6, 0xFD, 0xA5, 0xAF, 0xD6,
+    0xAF, 0xA7, 0xAD, 0xA7, 0xAD, 0x94, 0x9A, 0xF4, 0x9F, 0xA6, 0xAC, 0xA9, 0x40, 0x49, 0x70, 0x9F,
+    0x90, 0x9F, 0x1F, 0xCA, 0x9F, 0xC3, 0xEA, 0xDA, 0xE9, 0x2F, 0xC1, 0xE9, 0x2F, 0x19, 0xE2, 0x9E,
+    0xA1, 0x9E, 0x2A, 0xE2, 0xAD, 0xA2, 0xF2, 0xEA, 0x2E, 0x92, 0xE9, 0x19, 0xE2, 0x9E, 0x29, 0xE2,
+    0x9E, 0x2A, 0xE2, 0xAD, 0xA2, 0xE9, 0x2E, 0x97, 0x1E, 0x71, 0x9E, 0x71, 0xEA, 0x71, 0xE9, 0x70,
+    0x9E, 0x71, 0xAC, 0xA9, 0x30, 0x69, 0xA9, 0x70, 0x9F, 0xCA, 0x59, 0xFE, 0x93, 0x9E, 0x1A, 0xE3,
+    0xE3, 0xE9, 0x1A, 0xDA, 0x3E, 0x91, 0xE4, 0xE9, 0x0A, 0xDA, 0x4E, 0xA0, 0xE9, 0x4E, 0x90, 0xFF,
+    0xF9, 0x9F, 0xFF, 0x09, 0xEA, 0xA9, 0x99, 0xAE, 0x0A, 0xE4, 0xAD, 0xA0, 0xAE, 0x4E, 0x90, 0xAE,
+    0x39, 0xE1, 0x9E, 0x3E, 0x91, 0x9E, 0x2A, 0xE3, 0xF9, 0xAE, 0x49, 0xFE, 0x69, 0xFA, 0x77, 0x30,
+    0x59, 0x39, 0xE3, 0xEA, 0x29, 0xE9, 0x29, 0xE3, 0xAE, 0x3E, 0xA3, 0xE9, 0x29, 0xE3, 0xAE, 0x3A,
+    0xDA, 0x09, 0x1F, 0xD9, 0x0F, 0xD1, 0xAE, 0x97, 0x10, 0x49, 0x69, 0x19, 0xFA, 0x29, 0xE9, 0x0F,
+    0xCA, 0x19, 0xF9, 0x2E, 0x90, 0x9E, 0xAA, 0x3E, 0x1E, 0x6E, 0x0E, 0x95, 0x9D, 0xAA, 0xE6, 0xAD,
+    0x9F, 0x6F, 0xC9, 0xD6, 0xF0, 0xAD, 0x59, 0xEA, 0x0A, 0xD2, 0x91, 0x9E, 0x1A, 0xEA, 0xCA, 0x1A,
+    0xD9, 0x19, 0xFC, 0x91, 0xE3, 0xF7, 0x71, 0x49, 0x99, 0x72, 0xAF, 0xA7, 0x9F, 0xD7, 0x29, 0xEA,
+    0x72, 0x9E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x29, 0xE7, 0x2F, 0x71, 0xAF, 0x71, 0xFC, 0x97, 0xAD,
+    0x9D, 0x96, 0x9D, 0x99, 0xD9, 0x6E, 0x09, 0xDA, 0x5E, 0x90, 0x9D, 0xA4, 0xAE, 0x2D, 0xA3, 0xAE,
+    0x92, 0xFC, 0x9A, 0xEA, 0x3F, 0xC1, 0xE4, 0xAD, 0xA7, 0x70, 0x77, 0x4E, 0x92, 0xEA, 0x49, 0xE3,
+    0xE5, 0xAE, 0x29, 0xE5, 0xAD, 0xA2, 0xAD, 0xA5, 0xE9, 0x2A, 0xDA, 0x5E, 0x3E, 0x95, 0xE3, 0xE5,
+    0x9E, 0x29, 0xE5, 0xAE, 0x2F, 0x5A, 0xE1, 0xAF, 0x19, 0x2F, 0xFA, 0xDA, 0xD2, 0xFE, 0x99, 0xFA,
+    0x19, 0xDA, 0xE9, 0x1E, 0xA2, 0xAD, 0x75, 0xE7, 0x5E, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4A, 0xCA,
+    0x75, 0x71, 0x92, 0xAE, 0x91, 0x9E, 0x9A, 0xFC, 0x2E, 0xA0, 0x9A, 0xE2, 0xEA, 0x2E, 0x91, 0xAD,
+    0xA2, 0xE9, 0x1E, 0x3A, 0xDA, 0x1E, 0x3A, 0xDA, 0x09, 0xD9, 0x39, 0xDA, 0x0D, 0xA4, 0x9D, 0xAA,
+    0xD6, 0xFC, 0x96, 0xFA, 0x7E, 0xA7, 0x0D, 0xA7, 0x72, 0x39, 0x97, 0x0E, 0x79, 0xD9, 0x29, 0xA9,
+    0x19, 0xE9, 0xAE, 0x92, 0x9F, 0xE4, 0xE9, 0x99, 0x4E, 0x97, 0xE7, 0x9E, 0x70, 0xEA, 0x79, 0xFC,
+    0x95, 0xAF, 0xA3, 0x9F, 0xCA, 0x92, 0x9E, 0x96, 0xEA, 0x7E, 0x97, 0xF7, 0xFC, 0x95, 0x9F, 0xD9,
+    0x5F, 0xDA, 0x59, 0xFC, 0x79, 0xE7, 0x0E, 0x49, 0x9A, 0xE9, 0x4F, 0xC9, 0x59, 0xDA, 0x40, 0x69,
+    0x97, 0x0A, 0xFC, 0x93, 0x9F, 0xF2, 0x9E, 0xA0, 0x9E, 0xA1, 0xEA, 0x2F, 0x09, 0xE3, 0xAE, 0x0E,
+    0xA3, 0xAE, 0x0E, 0x93, 0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x92, 0x9E, 0x1E, 0x92, 0xE9, 0x1F, 0x99,
+    0xF2, 0x9F, 0xEA, 0x49, 0xFC, 0x97, 0x70, 0x76, 0x93, 0xAF, 0xFF, 0x2F, 0xFF, 0xD1, 0x9D, 0xAE,
+    0xAA, 0xEA, 0xA3, 0xA1, 0xDA, 0x1D, 0xA7, 0x9D, 0x90, 0x9D, 0x97, 0xAD, 0x1E, 0x70, 0xDA, 0x1E,
+    0x7A, 0xD9, 0x09, 0xDA, 0x7E, 0x1A, 0xDA, 0x6A, 0xDA, 0x1A, 0xDA, 0x59, 0xE9, 0x1F, 0xD9, 0x2F,
+    0x2F, 0xD2, 0x9E, 0x39, 0xEA, 0x77, 0x40, 0x70, 0x99, 0x71, 0xAF, 0xC9, 0x6F, 0xF9, 0x4A, 0xE9,
+    0x0F, 0x4E, 0x2A, 0xE3, 0xAD, 0xA2, 0x9E, 0x3E, 0x92, 0x9E, 0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA,
+    0x29, 0xDA, 0x3E, 0x92, 0xAD, 0xA2, 0xAE, 0x3F, 0xA9, 0xAE, 0x93, 0xFF, 0xC9, 0x4F, 0xEA, 0x59,
+    0xE7, 0x2A, 0xDA, 0x72, 0xEA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xCA, 0x97, 0x20, 0x69, 0x96, 0xFC,
+    0x92, 0x9F, 0xE1, 0x9E, 0xA9, 0xDA, 0x1E, 0x92, 0x91, 0xAE, 0x6E, 0x96, 0xE9, 0x59, 0xE9, 0x6F,
+    0x6F, 0xC9, 0x49, 0xFD, 0x94, 0xFD, 0x94, 0x9F, 0xC6, 0x9E, 0x69, 0xDA, 0x39, 0xAF, 0x4F, 0xC5,
+    0xAD, 0x93, 0x77, 0x49, 0xAF, 0xF4, 0xFF, 0xE3, 0xFA, 0xAE, 0xAA, 0x3E, 0xA2, 0xE4, 0x9E, 0x3E,
+    0x93, 0xEA, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE4, 0xE9, 0x29, 0xE3, 0xAE, 0x4E, 0x92, 0xE9, 0x4F,
+    0x99, 0xF5, 0x9F, 0xF7, 0x9F, 0xC9, 0x77, 0x60, 0x73, 0x91, 0x9F, 0xFD, 0x0A, 0xFF, 0xD9, 0x0E,
+    0xAE, 0xAA, 0xA9, 0x1C, 0x2E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA,
+    0x70, 0xEA, 0x1A, 0x5F, 0xAD, 0x5F, 0xD9, 0x59, 0xF9, 0x77, 0x00, 0x39, 0x39, 0x91, 0x9F, 0xC1,
+    0xEA, 0x0F, 0xD1, 0x9E, 0x2A, 0xDA, 0x2E, 0x91, 0xE9, 0x2E, 0x91, 0xE3, 0xE9, 0x09, 0xDA, 0x3E,
+    0x1E, 0x92, 0x9E, 0x1E, 0x3A, 0xDA, 0x1E, 0x3E, 0x2E, 0x2E, 0x92, 0xFA, 0xEA, 0x3F, 0xEA, 0x5F,
+    0xC9, 0x77, 0x10, 0x59, 0x49, 0x7A, 0xDA, 0x1F, 0xC4, 0xE9, 0x1F, 0xE2, 0xEA, 0x1A, 0xD9, 0x0E,
+    0x90, 0x9E, 0x2E, 0x1A, 0xDA, 0x0E, 0x91, 0x9D, 0xA1, 0x9D, 0xA0, 0xE2, 0xE9, 0x1A, 0xDA, 0x0E,
+    0x2E, 0x2A, 0xD9, 0x9E, 0x2E, 0x2E, 0x1E, 0x19, 0xDA, 0x1A, 0xDA, 0x1E, 0xA0, 0xAD, 0xA0, 0x9E,
+    0x29, 0xEA, 0xEA, 0xAE, 0x93, 0xAF, 0xFD, 0x7A, 0xFC, 0xA9, 0x71, 0xAD, 0xA7, 0x4A, 0xDA, 0x74,
+    0xE9, 0x74, 0xE7, 0x4A, 0xE7, 0x4A, 0xCA, 0x71, 0x75, 0x94, 0xAF, 0x92, 0x9E, 0x3F, 0xCA, 0x2E,
+    0x95, 0xAE, 0x1A, 0xDA, 0x69, 0xE0, 0x9E, 0x70, 0xE0, 0xE7, 0x1A, 0xDA, 0xD9, 0x71, 0x9F, 0xA7,
+    0x3F, 0x74, 0xE7, 0x5E, 0x97, 0x3A, 0xEA, 0x72, 0x9F, 0xC7, 0x2D, 0xAE, 0x71, 0xE0, 0xE9, 0x7A,
+    0xD9, 0x0A, 0xDA, 0x7E, 0x1A, 0xE0, 0x9A, 0x3E, 0x91, 0x9F, 0xD2, 0xF3, 0xFC, 0x3A, 0xD4, 0x9D,
+    0x93, 0x71, 0xAA, 0xA7, 0x59, 0xE7, 0x5A, 0xDA, 0x75, 0xE9, 0x70, 0x93, 0xE2, 0x91, 0x9F, 0xA1,
+    0x9E, 0x0A, 0xDA, 0x0F, 0xCA, 0x1A, 0xDA, 0x1E, 0x2A, 0xD9, 0x1A, 0xD9, 0x1E, 0x91, 0xE2, 0xE2,
+    0xE9, 0x09, 0xE2, 0xE2, 0xE9, 0x0A, 0xDA, 0x19, 0xE2, 0xE9, 0x0E, 0x91, 0xAD, 0xA2, 0xE1, 0xE2,
+    0xE9, 0x19, 0xDA, 0x1E, 0x91, 0xE2, 0xE2, 0xF0, 0x9E, 0x1E, 0xA2, 0x9F, 0xAE, 0xAE, 0xA4, 0xAF,
+    0xFD, 0x97, 0xAF, 0xCA, 0x97, 0x3E, 0x75, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x5E, 0x75, 0x9C,
+    0xA9, 0x71, 0x69, 0x59, 0x7E, 0xA3, 0xE5, 0xE9, 0x4A, 0xE3, 0xE9, 0x6E, 0x2A, 0xDA, 0x19, 0xAC,
+    0x91, 0xE9, 0x09, 0xE2, 0xE2, 0xAD, 0x90, 0xAD, 0xA2, 0xE2, 0xAD, 0x90, 0xE9, 0x2D, 0xA2, 0xE9,
+    0x0E, 0x29, 0xD9, 0x2E, 0x1E, 0x29, 0xD3, 0xE0, 0x9E, 0x2E, 0x2A, 0xD9, 0x1F, 0x9F, 0xC9, 0xAE,
+    0x2A, 0xFD, 0x9F, 0xD4, 0xFA, 0x1A, 0xEA, 0x77, 0x50, 0x73, 0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xF7,
+    0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7, 0x29, 0xD9, 0x09, 0xE7,
+    0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6, 0x9F, 0xFF, 0x6E, 0x94,
+    0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE, 0x99, 0xFD, 0xA2, 0xAF,
+    0xE9, 0x77, 0x77, 0x77, 0xD9, 0x77, 0xEA, 0x77, 0xE9, 0x77, 0xAC, 0x97, 0x10, 0x69, 0x73, 0xFA,
+    0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E,
+    0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD,
+    0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x77, 0x73, 0x9D, 0x72, 0x9E, 0x72, 0x9E,
+    0x73, 0xCA, 0x70, 0x77, 0x76, 0xAF, 0x75, 0xAD, 0x9D, 0xA7, 0x4D, 0x1D, 0xA7, 0x7A, 0xD7, 0x69,
+    0xDA, 0x77, 0xAC, 0x77, 0x29, 0x77, 0x29, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A,
+    0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A,
+    0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5,
+    0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x7A, 0xDA,
+    0x70, 0x9F, 0xCA, 0x7A, 0xC9, 0x0A, 0xCA, 0x70, 0xA1, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD7, 0x4C,
+    0xA7, 0x77, 0x29, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA,
+    0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A,
+    0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x77,
+    0x2A, 0x77, 0x2D, 0x97, 0x70, 0xAD, 0x74, 0xAC, 0xA0, 0x9D, 0x74, 0xAE, 0xA0, 0xA7, 0x4A, 0xDA,
+    0xD9, 0x74, 0xAD, 0x90, 0xAD, 0x74, 0xAA, 0x3A, 0x97, 0x79, 0xAA, 0x77, 0x0A, 0xE7, 0x79, 0xF7,
+    0x7F, 0xC9, 0x75, 0xAF, 0xC9, 0x75, 0xDA, 0xAD, 0xA7, 0x4E, 0x09, 0xE7, 0x39, 0xD9, 0x09, 0xE7,
+    0x3E, 0x2E, 0x72, 0xAD, 0x92, 0xE9, 0x71, 0xE3, 0xEA, 0x70, 0xAF, 0xFE, 0x79, 0xFF, 0xF7, 0xE9,
+    0x4A, 0xE6, 0xAD, 0xA5, 0x9E, 0x95, 0xE6, 0x9E, 0xA3, 0xAF, 0xC9, 0x3F, 0xE9, 0x09, 0xFD, 0xA2,
+    0xAF, 0xE9, 0x00, 0x75, 0x97, 0x7D, 0x75, 0xE9, 0x73, 0xAD, 0xA7, 0x4D, 0x97, 0x29, 0x1A, 0x97,
+    0x1A, 0xE7, 0x3A, 0xFC, 0x71, 0xAD, 0x90, 0xD9, 0x79, 0xD9, 0x19, 0xC9, 0x77, 0x73, 0x97, 0x5F,
+    0xA9, 0xDA, 0x59, 0xFF, 0xC9, 0x5E, 0xA0, 0x9F, 0x5A, 0xE2, 0xAD, 0xA5, 0xE3, 0xE9, 0x4A, 0xE3,
+    0xE5, 0xEA, 0x2A, 0xE5, 0xE9, 0x2F, 0x5E, 0x2A, 0xEA, 0x5E, 0x90, 0xAC, 0xAD, 0xA0, 0xA3, 0xFA,
+    0xD9, 0xFC, 0x92, 0xFD, 0x1F, 0xA3, 0x9E, 0xA2, 0xEA, 0x77, 0x40, 0x76, 0x9A, 0x77, 0x1D, 0x77,
+    0x1A, 0xD7, 0x5A, 0xC9, 0x0A, 0xC9, 0x73, 0xAE, 0x90, 0x97, 0x3A, 0xDA, 0xD7, 0x4A, 0xD9, 0x0A,
+    0xCA, 0x73, 0xAA, 0x3A, 0x77, 0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9,
+    0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7, 0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92,
+    0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6, 0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9,
+    0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE, 0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x77, 0x70, 0xCA, 0x73,
+    0x9D, 0x97, 0x3E, 0x74, 0xDA, 0x71, 0x91, 0xA9, 0x7A, 0xE7, 0x1A, 0xFC, 0x7A, 0xD9, 0x0D, 0x95,
+    0x9D, 0x91, 0x9C, 0x97, 0x77, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A,
+    0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA,
+    0x3E, 0x90, 0xAC, 0xAD, 0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA,
+    0x77, 0x00, 0x77, 0xAE, 0x77, 0xAC, 0xAA, 0xCA, 0x76, 0x9A, 0x0A, 0xC9, 0x73, 0xAC, 0x91, 0xAC,
+    0xA7, 0x3A, 0xE9, 0x9C, 0x97, 0x3A, 0xDA, 0xD7, 0x5A, 0xD9, 0x0A, 0xCA, 0x74, 0xAA, 0x3A, 0x77,
+    0x09, 0xAA, 0x77, 0x0A, 0xE7, 0x79, 0xF7, 0x7F, 0xC9, 0x75, 0xAF, 0xC9, 0x75, 0xDA, 0xAD, 0xA7,
+    0x4E, 0x09, 0xE7, 0x39, 0xD9, 0x09, 0xE7, 0x3E, 0x2E, 0x72, 0xAD, 0x92, 0xE9, 0x71, 0xE3, 0xEA,
+    0x70, 0xAF, 0xFE, 0x79, 0xFF, 0xF7, 0xE9, 0x4A, 0xE6, 0xAD, 0xA5, 0x9E, 0x95, 0xE6, 0x9E, 0xA3,
+    0xAF, 0xC9, 0x3F, 0xE9, 0x09, 0xFD, 0xA2, 0xAF, 0xE9, 0x00, 0x75, 0x97, 0x49, 0xF9, 0x72, 0xD9,
+    0xAC, 0xA7, 0x2A, 0x90, 0xAC, 0x97, 0x4A, 0xCA, 0x71, 0x91, 0xD7, 0x1A, 0xE0, 0xAA, 0x70, 0xAF,
+    0xC7, 0x1A, 0xD9, 0x0D, 0x97, 0x9D, 0x91, 0x9C, 0x97, 0x77, 0x39, 0x75, 0xFA, 0x9D, 0xA5, 0x9F,
+    0xFC, 0x95, 0xEA, 0x09, 0xF5, 0xAE, 0x2A, 0xDA, 0x5E, 0x3E, 0x94, 0xAE, 0x3E, 0x5E, 0xA2, 0xAE,
+    0x5E, 0x92, 0xF5, 0xE2, 0xAE, 0xA5, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x3F, 0xAD, 0x9F, 0xC9, 0x2F,
+    0xD1, 0xFA, 0x39, 0xEA, 0x2E, 0xA7, 0x74, 0x71, 0x9D, 0xA1, 0xC7, 0x4F, 0xE7, 0x4C, 0x90, 0xAD,
+    0xA7, 0x77, 0x71, 0x9E, 0x76, 0x9F, 0xC7, 0x4A, 0xD1, 0xDA, 0x73, 0xAA, 0x3A, 0x77, 0x9A, 0xA7,
+    0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7,
+    0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6,
+    0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE,
+    0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x59, 0xD2, 0xA7, 0xF9, 0xAC, 0x95, 0x9C, 0xA9, 0xF7, 0xA2, 0xAC,
+    0x97, 0x29, 0x73, 0xAE, 0x71, 0xAF, 0xC7, 0xAD, 0x90, 0xDA, 0x59, 0xD9, 0x2C, 0x97, 0x77, 0x97,
+    0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3, 0xE9, 0x2A,
+    0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E, 0x90, 0xAC, 0xAD, 0xA0, 0xA1,
+    0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77, 0x00, 0x77, 0x77, 0xAD, 0x77,
+    0xAF, 0x75, 0xAD, 0xAE, 0x73, 0xE9, 0x09, 0xD9, 0x71, 0x9C, 0xA3, 0x9A, 0x77, 0x77, 0x29, 0xAA,
+    0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E,
+    0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE,
+    0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F,
+    0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x97, 0x77, 0x77, 0x7D, 0x97, 0x7E, 0xA7, 0x7E, 0x97, 0x7A, 0xC9,
+    0x71, 0x70, 0x99, 0x73, 0xE9, 0x71, 0xFC, 0x70, 0xAD, 0x9D, 0x96, 0xAD, 0x1A, 0xD6, 0xD3, 0xC9,
+    0x77, 0x79, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E,
+    0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA,
+    0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x77, 0x73, 0x9D,
+    0x72, 0x9E, 0x72, 0x9E, 0x73, 0xCA, 0x70, 0x75, 0xA9, 0x77, 0x09, 0xD7, 0x70, 0xD9, 0x74, 0x9A,
+    0x0A, 0xC9, 0x09, 0x73, 0xD9, 0x2A, 0xC7, 0x3F, 0xE9, 0x74, 0xFC, 0x97, 0x77, 0x73, 0x9A, 0xA7,
+    0x7A, 0xE7, 0x69, 0xF7, 0x6F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xDA, 0xAD, 0xA7, 0x3E, 0x09, 0xE7,
+    0x29, 0xD9, 0x09, 0xE7, 0x2E, 0x2E, 0x71, 0xAD, 0x92, 0xE9, 0x70, 0xE3, 0xEA, 0x7A, 0xFF, 0xE6,
+    0x9F, 0xFF, 0x6E, 0x94, 0xAE, 0x5A, 0xDA, 0x59, 0xE9, 0x4E, 0x69, 0xEA, 0x2A, 0xFC, 0x93, 0xFE,
+    0x99, 0xFD, 0xA2, 0xAF, 0xE9, 0x77, 0x70, 0x9C, 0x97, 0x3D, 0xA7, 0x2E, 0x72, 0xAD, 0x71, 0x90,
+    0x9A, 0x71, 0xD3, 0x9C, 0x6E, 0x99, 0xAC, 0xA6, 0x9F, 0xCA, 0x70, 0x9A, 0xCA, 0x97, 0x77, 0x19,
+    0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E, 0x92,
+    0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A,
+    0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70, 0x73, 0xA9, 0x77, 0x09,
+    0xCA, 0x77, 0x1D, 0x76, 0x9A, 0x1C, 0x90, 0x97, 0x3D, 0x92, 0xAC, 0x73, 0xFE, 0x97, 0x4F, 0xC9,
+    0x77, 0x77, 0x39, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA,
+    0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E,
+    0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E,
+    0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x77, 0x59, 0xC7, 0x4D, 0x97, 0x3E,
+    0x74, 0xD9, 0x71, 0x91, 0xCA, 0x70, 0xD3, 0x9C, 0x6E, 0x99, 0xAC, 0xA6, 0x9F, 0xCA, 0x70, 0x9A,
+    0xCA, 0x97, 0x77, 0x19, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09, 0xF3, 0xAE, 0x2A,
+    0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2, 0xAE, 0xA3, 0xE9,
+    0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA, 0x2E, 0xA7, 0x70,
+    0x73, 0xAD, 0xA7, 0x6D, 0x9D, 0x76, 0x99, 0x0D, 0x77, 0xAD, 0x75, 0x9A, 0x0A, 0xC1, 0x97, 0x3D,
+    0x91, 0x9C, 0x97, 0x39, 0xFC, 0xA7, 0x6A, 0xA9, 0x77, 0x19, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76,
+    0xFC, 0x97, 0x4A, 0xFC, 0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72,
+    0xE2, 0xE7, 0x1A, 0xD9, 0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A,
+    0xE5, 0xAD, 0xA5, 0x9E, 0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE,
+    0x90, 0x70, 0x99, 0x72, 0x9F, 0x97, 0x0D, 0x0A, 0xCA, 0x70, 0x99, 0x0D, 0x97, 0x19, 0xD9, 0x72,
+    0xD7, 0x1A, 0xC0, 0x99, 0x09, 0xC6, 0xDA, 0x90, 0xAC, 0xA6, 0xAF, 0xD7, 0x09, 0xAC, 0xA9, 0x77,
+    0x71, 0x97, 0x3F, 0xA9, 0xDA, 0x39, 0xFF, 0xC9, 0x3E, 0xA0, 0x9F, 0x3A, 0xE2, 0xAD, 0xA3, 0xE3,
+    0xE9, 0x2A, 0xE3, 0xE3, 0xEA, 0x2A, 0xE3, 0xE9, 0x2F, 0x3E, 0x2A, 0xEA, 0x3E, 0x90, 0xAC, 0xAD,
+    0xA0, 0xA1, 0xFA, 0xD9, 0xFC, 0x90, 0xFD, 0x1F, 0xA1, 0x9E, 0xA2, 0xEA, 0x77, 0x00, 0x71, 0xAD,
+    0x90, 0x9C, 0x73, 0x9F, 0xE7, 0x39, 0xC1, 0xE9, 0x77, 0x29, 0x73, 0xD3, 0xAC, 0x73, 0xEA, 0xAD,
+    0x97, 0x39, 0xFC, 0x77, 0x77, 0x49, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC,
+    0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9,
+    0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E,
+    0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x90, 0x69, 0x92, 0x97,
+    0xF0, 0x9C, 0x95, 0x9F, 0xE6, 0x9C, 0x1A, 0xD9, 0x77, 0x5A, 0xC3, 0x9C, 0x6D, 0xA9, 0x0A, 0xCA,
+    0x6A, 0xFD, 0x70, 0x9A, 0xCA, 0x97, 0x77, 0x19, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA,
+    0x09, 0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3,
+    0xE2, 0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19,
+    0xEA, 0x2E, 0xA7, 0x70, 0x71, 0xA4, 0x97, 0x3A, 0xCA, 0x29, 0xC7, 0x3A, 0xEA, 0xDA, 0x74, 0xFC,
+    0xA7, 0x69, 0x99, 0x77, 0x77, 0x59, 0xAA, 0x77, 0xAE, 0x76, 0x9F, 0x76, 0xFC, 0x97, 0x4A, 0xFC,
+    0x97, 0x4D, 0xAA, 0xDA, 0x73, 0xE0, 0x9E, 0x72, 0x9D, 0x90, 0x9E, 0x72, 0xE2, 0xE7, 0x1A, 0xD9,
+    0x2E, 0x97, 0x0E, 0x3E, 0xA7, 0xAF, 0xFE, 0x69, 0xFF, 0xF6, 0xE9, 0x4A, 0xE5, 0xAD, 0xA5, 0x9E,
+    0x94, 0xE6, 0x9E, 0xA2, 0xAF, 0xC9, 0x3F, 0xE9, 0x9F, 0xDA, 0x2A, 0xFE, 0x97, 0x77, 0x77, 0x7D,
+    0x97, 0x7E, 0xA7, 0x7E, 0x97, 0x7A, 0xC9, 0x71, 0x59, 0x74, 0x9C, 0xA3, 0xC6, 0xAD, 0xA9, 0xAD,
+    0x7F, 0xD7, 0x1A, 0xCA, 0xA7, 0x77, 0x19, 0x73, 0xFA, 0x9D, 0xA3, 0x9F, 0xFC, 0x93, 0xEA, 0x09,
+    0xF3, 0xAE, 0x2A, 0xDA, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x3E, 0xA2, 0xAE, 0x3E, 0x92, 0xF3, 0xE2,
+    0xAE, 0xA3, 0xE9, 0x0A, 0xCA, 0xDA, 0x0A, 0x1F, 0xAD, 0x9F, 0xC9, 0x0F, 0xD1, 0xFA, 0x19, 0xEA,
+    0x2E, 0xA7, 0x77, 0x73, 0x9D, 0x72, 0x9E, 0x72, 0x9E, 0x73, 0xCA, 0x70, 0x39, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3,
+    0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69,
+    0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F,
+    0xFF, 0xC2, 0xAF, 0xFF, 0x97, 0x77, 0x77, 0x19, 0xD9, 0x74, 0xEA, 0x74, 0xE7, 0x5A, 0xC9, 0x70,
+    0x79, 0x7A, 0xFA, 0x4F, 0xE3, 0xE1, 0xE9, 0x1E, 0x2E, 0x19, 0xDA, 0x19, 0xDA, 0x1A, 0xD1, 0xAD,
+    0xA2, 0xEA, 0xEA, 0x3F, 0xCA, 0x49, 0xE9, 0x39, 0x2E, 0x3A, 0xC9, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE,
+    0x93, 0xAF, 0xA7, 0x77, 0x6A, 0xD7, 0x9E, 0x7A, 0xE7, 0x0C, 0xA6, 0x77, 0x71, 0x9F, 0x97, 0x19,
+    0xD9, 0xE7, 0x19, 0xC9, 0x09, 0xD7, 0x49, 0xD9, 0x73, 0xDA, 0x75, 0xCA, 0x76, 0x97, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D,
+    0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99,
+    0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99,
+    0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0x92, 0x6A, 0xDA, 0x59, 0xFC, 0xA4, 0xAC, 0x90, 0xAC, 0xA5,
+    0xA1, 0xD9, 0x69, 0xD9, 0x69, 0xD7, 0x1C, 0xA7, 0x76, 0x97, 0xAF, 0xA4, 0xFE, 0x3E, 0x1E, 0x91,
+    0xE2, 0xE1, 0x9D, 0xA1, 0x9D, 0xA1, 0xAD, 0x1A, 0xDA, 0x2E, 0xAE, 0xA3, 0xFC, 0xA4, 0x9E, 0x93,
+    0x92, 0xE3, 0xAC, 0x91, 0xFA, 0xAE, 0x91, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x70, 0x9A, 0x29, 0x71,
+    0xF0, 0x9C, 0xA7, 0xAF, 0xE9, 0x7A, 0xC1, 0xEA, 0x75, 0x97, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x93, 0x9F, 0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C,
+    0x94, 0x9E, 0x97, 0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9,
+    0x73, 0xAE, 0x59, 0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF,
+    0xC2, 0xAF, 0xFF, 0x92, 0x59, 0x92, 0x95, 0xF0, 0x9C, 0x93, 0xFF, 0x4D, 0x1E, 0xA7, 0x19, 0x77,
+    0x79, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0x9D, 0xA2, 0xAD, 0x1A,
+    0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5, 0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92, 0xFA, 0xAE, 0x92, 0xAF,
+    0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x77, 0x0A, 0x77, 0x0A, 0xD7, 0x69, 0xD9, 0x71, 0x9D, 0x1D, 0x97,
+    0x2F, 0x0A, 0x73, 0xDA, 0xDA, 0x72, 0x9D, 0xA0, 0x9D, 0x72, 0x9A, 0x92, 0x99, 0x79, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0x95, 0xAF, 0xFE, 0x96, 0xAE, 0x39, 0xD7, 0xF3, 0x9D, 0x7E,
+    0xA3, 0x9C, 0x96, 0x9E, 0x97, 0x5A, 0xE7, 0x6A, 0xFF, 0xA7, 0x0F, 0xFC, 0x97, 0x0E, 0xA9, 0x99,
+    0x99, 0x70, 0x9E, 0x97, 0x5A, 0xE5, 0x97, 0xF4, 0xAC, 0x96, 0xEA, 0x4D, 0x95, 0x9E, 0xA9, 0x99,
+    0x9E, 0x49, 0xFF, 0xFC, 0x4A, 0xFF, 0xF9, 0x40, 0x74, 0x97, 0x6D, 0x74, 0xE9, 0x72, 0xAD, 0xA7,
+    0x3D, 0x97, 0x19, 0x1A, 0x97, 0x0A, 0xE7, 0x2A, 0xFC, 0x70, 0xAD, 0x90, 0xD9, 0x69, 0xD9, 0x19,
+    0xC9, 0x77, 0x73, 0x97, 0x3A, 0xFA, 0x70, 0xFE, 0x7E, 0x1E, 0x95, 0xE2, 0xE5, 0x9D, 0xA1, 0x9D,
+    0xA5, 0xAD, 0x1A, 0xDA, 0x6E, 0xAE, 0xA7, 0xFC, 0xA7, 0x09, 0xE9, 0x39, 0x6E, 0x3A, 0xC9, 0x5F,
+    0xAA, 0xE9, 0x5A, 0xFE, 0x97, 0xAF, 0xA7, 0x77, 0x74, 0x9C, 0x76, 0xDA, 0x75, 0x9D, 0x72, 0x9C,
+    0xA0, 0x9C, 0xA7, 0x1E, 0xA0, 0x97, 0x1D, 0xAD, 0xA7, 0x09, 0xDA, 0x09, 0xD7, 0x09, 0xA9, 0x29,
+    0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xF9, 0x3A, 0xFF, 0xE9, 0x4A, 0xE3, 0x9D,
+    0x5F, 0x39, 0xD5, 0xEA, 0x39, 0xC9, 0x49, 0xE9, 0x73, 0xAE, 0x74, 0xAF, 0xFA, 0x6F, 0xFC, 0x96,
+    0xEA, 0x99, 0x99, 0x96, 0x9E, 0x97, 0x3A, 0xE5, 0x95, 0xF4, 0xAC, 0x94, 0xEA, 0x4D, 0x93, 0x9E,
+    0xA9, 0x99, 0x9E, 0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xF9, 0x20, 0x77, 0x5C, 0xA7, 0x19, 0xD9, 0x71,
+    0xE7, 0x2D, 0xA7, 0x91, 0xA9, 0x5A, 0xE7, 0xAF, 0xC5, 0xAD, 0x90, 0xD9, 0x39, 0xD9, 0x19, 0xC9,
+    0x77, 0x59, 0x70, 0xAF, 0xA5, 0xFE, 0x4E, 0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0x9D, 0xA2, 0xAD,
+    0x1A, 0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5, 0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92, 0xFA, 0xAE, 0x92,
+    0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x75, 0x9E, 0x97, 0x49, 0xDA, 0xD7, 0x5A, 0x1D, 0x71, 0x9C,
+    0xA1, 0xAD, 0x72, 0xEA, 0x0C, 0xA7, 0x2D, 0xAD, 0xA7, 0x29, 0xDA, 0x09, 0xD7, 0x29, 0xA9, 0x29,
+    0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x59, 0xFF, 0xF9, 0x5A, 0xFF, 0xE9, 0x6A, 0xE3, 0x9D,
+    0x7F, 0x39, 0xD7, 0xEA, 0x39, 0xC9, 0x69, 0xE9, 0x75, 0xAE, 0x76, 0xAF, 0xFA, 0x70, 0xFF, 0xC9,
+    0x70, 0xEA, 0x99, 0x99, 0x97, 0x09, 0xE9, 0x75, 0xAE, 0x59, 0x7F, 0x4A, 0xC9, 0x6E, 0xA4, 0xD9,
+    0x59, 0xEA, 0x99, 0x99, 0xE4, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0x94, 0x74, 0x97, 0x39, 0xF9, 0x71,
+    0xD9, 0xAC, 0xA7, 0x1A, 0x90, 0xAC, 0x97, 0x3A, 0xCA, 0x70, 0x91, 0xD7, 0x0A, 0xE0, 0xAA, 0x7A,
+    0xFC, 0x70, 0xAD, 0x90, 0xD9, 0x69, 0xD9, 0x19, 0xC9, 0x77, 0x73, 0x97, 0x3A, 0xFA, 0x70, 0xFE,
+    0x7E, 0x1E, 0x95, 0xE2, 0xE5, 0x9D, 0xA1, 0x9D, 0xA5, 0xAD, 0x1A, 0xDA, 0x6E, 0xAE, 0xA7, 0xFC,
+    0xA7, 0x09, 0xE9, 0x39, 0x6E, 0x3A, 0xC9, 0x5F, 0xAA, 0xE9, 0x5A, 0xFE, 0x97, 0xAF, 0xA7, 0x77,
+    0x70, 0xAC, 0xA1, 0xA9, 0x70, 0xAF, 0xDA, 0x70, 0x9A, 0x09, 0xE7, 0x77, 0x4E, 0x97, 0x3F, 0xC9,
+    0x70, 0x9D, 0xA0, 0x9D, 0x70, 0x9A, 0x92, 0x99, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0x9F,
+    0xFF, 0x93, 0xAF, 0xFE, 0x94, 0xAE, 0x39, 0xD5, 0xF3, 0x9D, 0x5E, 0xA3, 0x9C, 0x94, 0x9E, 0x97,
+    0x3A, 0xE7, 0x4A, 0xFF, 0xA6, 0xFF, 0xC9, 0x6E, 0xA9, 0x99, 0x99, 0x69, 0xE9, 0x73, 0xAE, 0x59,
+    0x5F, 0x4A, 0xC9, 0x4E, 0xA4, 0xD9, 0x39, 0xEA, 0x99, 0x99, 0xE2, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF,
+    0x92, 0x49, 0xD2, 0xA5, 0xF9, 0xAC, 0x93, 0x9C, 0xA9, 0xF5, 0xA2, 0xAC, 0x97, 0x09, 0x71, 0xAE,
+    0x7A, 0xFC, 0x5A, 0xD9, 0x0D, 0xA3, 0x9D, 0x92, 0xC9, 0x77, 0x59, 0x70, 0xAF, 0xA5, 0xFE, 0x4E,
+    0x1E, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0x9D, 0xA2, 0xAD, 0x1A, 0xDA, 0x3E, 0xAE, 0xA4, 0xFC, 0xA5,
+    0x9E, 0x93, 0x93, 0xE3, 0xAC, 0x92, 0xFA, 0xAE, 0x92, 0xAF, 0xE9, 0x4A, 0xFA, 0x77, 0x10, 0x77,
+    0x72, 0x9D, 0x97, 0x39, 0xF9, 0x71, 0x9D, 0xAE, 0x70, 0xAD, 0xA1, 0xDA, 0x7A, 0xC9, 0x3C, 0x97,
+    0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xF9, 0x3A, 0xFF, 0xE9, 0x4A, 0xE3, 0x9D,
+    0x5F, 0x39, 0xD5, 0xEA, 0x39, 0xC9, 0x49, 0xE9, 0x73, 0xAE, 0x74, 0xAF, 0xFA, 0x6F, 0xFC, 0x96,
+    0xEA, 0x99, 0x99, 0x96, 0x9E, 0x97, 0x3A, 0xE5, 0x95, 0xF4, 0xAC, 0x94, 0xEA, 0x4D, 0x93, 0x9E,
+    0xA9, 0x99, 0x9E, 0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xF9, 0x77, 0x77, 0x71, 0x9D, 0x97, 0x4E, 0xA7,
+    0x4E, 0x75, 0xAC, 0x97, 0x00, 0x79, 0x97, 0x0E, 0x96, 0xFC, 0x5A, 0xD9, 0xD9, 0x3A, 0xD1, 0xAD,
+    0x3D, 0x3C, 0x97, 0x73, 0x97, 0xAF, 0xA4, 0xFE, 0x3E, 0x1E, 0x91, 0xE2, 0xE1, 0x9D, 0xA1, 0x9D,
+    0xA1, 0xAD, 0x1A, 0xDA, 0x2E, 0xAE, 0xA3, 0xFC, 0xA4, 0x9E, 0x93, 0x92, 0xE3, 0xAC, 0x91, 0xFA,
+    0xAE, 0x91, 0xAF, 0xE9, 0x3A, 0xFA, 0x77, 0x76, 0xAD, 0x79, 0xE7, 0xAE, 0x70, 0xCA, 0x60, 0x77,
+    0x1A, 0xF9, 0x4A, 0xD9, 0xDA, 0x4A, 0xC1, 0xAC, 0xA7, 0x9D, 0x69, 0xDA, 0x79, 0xC9, 0x71, 0x97,
+    0x99, 0x99, 0x99, 0x99, 0x29, 0xFE, 0xA3, 0xAF, 0xCA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0xA6, 0x9E,
+    0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x96, 0xAE, 0x7F, 0x69, 0xEA, 0x49, 0xFE, 0x92,
+    0xAF, 0xE9, 0x20, 0x39, 0xAD, 0xA3, 0x9F, 0xCA, 0x2A, 0xC9, 0x0D, 0xA3, 0xA1, 0xD5, 0x9D, 0x94,
+    0x9C, 0xA7, 0xC9, 0x77, 0x19, 0x49, 0xFA, 0x3F, 0xCA, 0x5E, 0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E,
+    0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x0A, 0x3F, 0xD9, 0x2F, 0xD3, 0xAE, 0xA7, 0x50, 0x39, 0x99, 0x99,
+    0x99, 0x92, 0x9F, 0xEA, 0x3A, 0xFC, 0xA5, 0xAE, 0x7F, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7,
+    0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA4, 0x9F, 0xE9, 0x2A, 0xFE, 0x97,
+    0x77, 0x4A, 0xD7, 0xAE, 0x7A, 0xDA, 0x79, 0xCA, 0x70, 0x75, 0xE4, 0xAE, 0x4F, 0x4A, 0xD9, 0x76,
+    0x93, 0x9F, 0xA2, 0xFC, 0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xAD, 0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xAD,
+    0xA0, 0xA2, 0xFD, 0x91, 0xFD, 0x2A, 0xEA, 0x77, 0x5A, 0xCA, 0x4A, 0xE4, 0xEA, 0x49, 0xCA, 0x50,
+    0x79, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F,
+    0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7,
+    0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93,
+    0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x77, 0x76, 0xAD, 0x75, 0x9E, 0x75,
+    0xAE, 0x76, 0xCA, 0x72, 0x69, 0x97, 0x0A, 0xFC, 0x93, 0x9F, 0xF2, 0x9E, 0xA0, 0x9E, 0xA1, 0xEA,
+    0x2F, 0x09, 0xE3, 0xAE, 0x0E, 0xA3, 0xAE, 0x0E, 0x93, 0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x92, 0x9E,
+    0x1E, 0x92, 0xE9, 0x1F, 0x99, 0xF2, 0x9F, 0xEA, 0x49, 0xFC, 0x97, 0x77, 0x70, 0xAD, 0x70, 0x9E,
+    0x70, 0xAE, 0x71, 0xCA, 0x70, 0x77, 0x72, 0xAF, 0x97, 0x2A, 0xD9, 0xDA, 0x72, 0xAC, 0x1A, 0xCA,
+    0x75, 0x9D, 0x74, 0x9D, 0xA7, 0x59, 0xC9, 0x77, 0x97, 0x69, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95,
+    0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE,
+    0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F,
+    0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97,
+    0xAF, 0xD9, 0x77, 0x70, 0x7A, 0xDA, 0x7F, 0xCA, 0x5A, 0xC9, 0x0A, 0xCA, 0x6A, 0x1D, 0x97, 0x9D,
+    0xA7, 0x9D, 0x72, 0xCA, 0x77, 0x69, 0x97, 0x0A, 0xFC, 0x93, 0x9F, 0xF2, 0x9E, 0xA0, 0x9E, 0xA1,
+    0xEA, 0x2F, 0x09, 0xE3, 0xAE, 0x0E, 0xA3, 0xAE, 0x0E, 0x93, 0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x92,
+    0x9E, 0x1E, 0x92, 0xE9, 0x1F, 0x99, 0xF2, 0x9F, 0xEA, 0x49, 0xFC, 0x97, 0x70, 0x77, 0x0C, 0x77,
+    0x0D, 0xA7, 0x6A, 0xD7, 0x29, 0xCA, 0x09, 0xD7, 0x29, 0xEA, 0x0A, 0x72, 0x9D, 0xAD, 0xA7, 0x29,
+    0xD9, 0x0A, 0xD7, 0x29, 0xA9, 0x2A, 0x97, 0x39, 0xAA, 0xAA, 0x97, 0x2F, 0xFC, 0x96, 0x9F, 0xFE,
+    0x94, 0x9F, 0x91, 0x9F, 0xC3, 0x9F, 0x5F, 0x92, 0xF9, 0x5A, 0xEA, 0x19, 0xF6, 0xAE, 0xA1, 0xAE,
+    0x96, 0xAE, 0xA1, 0xF7, 0xAE, 0xA1, 0xF7, 0xAE, 0xA1, 0xF7, 0xF9, 0x1F, 0x7F, 0x2F, 0x6A, 0xEA,
+    0x2F, 0x94, 0x9F, 0x3A, 0xF3, 0x9F, 0x94, 0xFC, 0xAA, 0xFC, 0x95, 0x9F, 0xFD, 0x97, 0x0A, 0xFD,
+    0x97, 0x77, 0x10, 0x75, 0x99, 0x76, 0xD9, 0x74, 0xAD, 0x97, 0x39, 0xDA, 0x74, 0xDA, 0x72, 0x91,
+    0xA9, 0x71, 0x9E, 0x73, 0x9F, 0xC7, 0x1A, 0xD9, 0x0D, 0xA7, 0x9D, 0x91, 0x9C, 0x97, 0x77, 0x39,
+    0x97, 0x4A, 0xFC, 0x97, 0x9F, 0xF6, 0x9E, 0xA0, 0x9E, 0xA5, 0xEA, 0x2F, 0x49, 0xE3, 0xAE, 0x4E,
+    0xA3, 0xAE, 0x4E, 0x93, 0xEA, 0x4E, 0x93, 0xE9, 0x39, 0xE9, 0x29, 0xE5, 0xE9, 0x2E, 0x95, 0xF9,
+    0x9F, 0x69, 0xFE, 0xA7, 0x09, 0xFC, 0x97, 0x77, 0x00, 0x74, 0x9A, 0x77, 0xD9, 0x76, 0xAD, 0x73,
+    0x9C, 0xA0, 0xAC, 0x97, 0x19, 0xEA, 0x09, 0x71, 0x9D, 0xAD, 0x97, 0x19, 0xD9, 0x0A, 0xD7, 0x19,
+    0xA9, 0x2A, 0x97, 0x29, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95, 0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F,
+    0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE, 0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7,
+    0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F, 0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A,
+    0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xD9, 0x77, 0x70, 0x77, 0x7D,
+    0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3A, 0xCA, 0x70, 0x91, 0xAA, 0x69, 0xE7, 0x09, 0xFC, 0x6A, 0xD9,
+    0x0D, 0xA4, 0x9D, 0x91, 0x9C, 0x97, 0x75, 0x99, 0x71, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xEA, 0x09,
+    0xEA, 0x2E, 0xA2, 0xF1, 0x9E, 0x3A, 0xE1, 0xEA, 0x3A, 0xE1, 0xE9, 0x3E, 0xA1, 0xE9, 0x3E, 0x90,
+    0x9E, 0x92, 0x9E, 0x2E, 0x92, 0xE9, 0x2F, 0x99, 0xF3, 0x9F, 0xEA, 0x59, 0xFC, 0x97, 0x72, 0x75,
+    0x9E, 0x75, 0xAC, 0xAA, 0xCA, 0x74, 0x9A, 0x09, 0xCA, 0x71, 0x9C, 0xA1, 0xAC, 0xA7, 0x19, 0xEA,
+    0x0C, 0x97, 0x19, 0xDA, 0xD9, 0x72, 0x9D, 0x90, 0xAD, 0x72, 0x9A, 0x92, 0xA9, 0x73, 0x9A, 0xAA,
+    0xA9, 0x72, 0xFF, 0xC9, 0x69, 0xFF, 0xE9, 0x49, 0xF9, 0x19, 0xFC, 0x39, 0xF5, 0xF9, 0x2F, 0x95,
+    0xAE, 0xA1, 0x9F, 0x6A, 0xEA, 0x1A, 0xE9, 0x6A, 0xEA, 0x1F, 0x7A, 0xEA, 0x1F, 0x7A, 0xEA, 0x1F,
+    0x7F, 0x91, 0xF7, 0xF2, 0xF6, 0xAE, 0xA2, 0xF9, 0x49, 0xF3, 0xAF, 0x39, 0xF9, 0x4F, 0xCA, 0xAF,
+    0xC9, 0x59, 0xFF, 0xD9, 0x70, 0xAF, 0xD9, 0x77, 0x71, 0x75, 0x97, 0x5F, 0x97, 0x2D, 0x9A, 0xD7,
+    0x2A, 0x90, 0xAC, 0xA7, 0x4A, 0xCA, 0x71, 0x91, 0xD9, 0x70, 0x9E, 0x0A, 0xA7, 0x09, 0xFC, 0x71,
+    0xAD, 0x90, 0xDA, 0x79, 0xD9, 0x19, 0xC9, 0x77, 0x73, 0x99, 0x74, 0xAF, 0xC9, 0x79, 0xFF, 0x69,
+    0xEA, 0x09, 0xEA, 0x5E, 0xA2, 0xF4, 0x9E, 0x3A, 0xE4, 0xEA, 0x3A, 0xE4, 0xE9, 0x3E, 0xA4, 0xE9,
+    0x3E, 0x93, 0x9E, 0x92, 0x9E, 0x5E, 0x92, 0xE9, 0x5F, 0x99, 0xF6, 0x9F, 0xEA, 0x70, 0x9F, 0xC9,
+    0x77, 0x70, 0x70, 0xDA, 0x1C, 0x72, 0xFE, 0x97, 0x1A, 0xA0, 0x9D, 0xA7, 0x77, 0x59, 0xE7, 0x49,
+    0xFC, 0x97, 0x1A, 0xD9, 0x0A, 0xD7, 0x19, 0xA3, 0xA7, 0x39, 0xAA, 0xAA, 0x97, 0x1F, 0xFC, 0x95,
+    0x9F, 0xFE, 0x93, 0x9F, 0x91, 0x9F, 0xC2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xEA, 0x09, 0xF6, 0xAE,
+    0xA0, 0xAE, 0x96, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xAE, 0xA0, 0xF7, 0xF9, 0x0F, 0x7F, 0x1F,
+    0x6A, 0xEA, 0x1F, 0x94, 0x9F, 0x2A, 0xF3, 0x9F, 0x93, 0xFC, 0xAA, 0xFC, 0x94, 0x9F, 0xFD, 0x97,
+    0xAF, 0xD9, 0x77, 0x70, 0x59, 0xD9, 0x1A, 0x6F, 0xA9, 0xC9, 0x49, 0xCA, 0x9F, 0x95, 0xA2, 0xAC,
+    0x97, 0x19, 0x72, 0x9E, 0x97, 0x9F, 0xC6, 0xAD, 0x90, 0xE4, 0x9D, 0x92, 0xC9, 0x77, 0x59, 0x97,
+    0x1A, 0xFC, 0x94, 0x9F, 0xF3, 0x9E, 0xA0, 0x9E, 0xA2, 0xEA, 0x2F, 0x19, 0xE3, 0xAE, 0x1E, 0xA3,
+    0xAE, 0x1E, 0x93, 0xEA, 0x1E, 0x93, 0xE9, 0x09, 0xE9, 0x29, 0xE2, 0xE9, 0x2E, 0x92, 0xF9, 0x9F,
+    0x39, 0xFE, 0xA5, 0x9F, 0xC9, 0x77, 0x20, 0x77, 0x73, 0xAD, 0x97, 0x4A, 0xF7, 0x3A, 0xDA, 0xE7,
+    0x1A, 0xD9, 0x1D, 0x97, 0x0D, 0x92, 0x9A, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x71, 0xFF, 0xC9, 0x59,
+    0xFF, 0xE9, 0x39, 0xF9, 0x19, 0xFC, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0xA0, 0x9F, 0x6A, 0xEA,
+    0x0A, 0xE9, 0x6A, 0xEA, 0x0F, 0x7A, 0xEA, 0x0F, 0x7A, 0xEA, 0x0F, 0x7F, 0x90, 0xF7, 0xF1, 0xF6,
+    0xAE, 0xA1, 0xF9, 0x49, 0xF2, 0xAF, 0x39, 0xF9, 0x3F, 0xCA, 0xAF, 0xC9, 0x49, 0xFF, 0xD9, 0x7A,
+    0xFD, 0x97, 0x77, 0x77, 0x6A, 0xD7, 0x59, 0xE7, 0x5A, 0xE7, 0x6C, 0xA7, 0x20, 0x70, 0x99, 0x71,
+    0xE9, 0x7A, 0xF6, 0xAD, 0x9D, 0x94, 0x9D, 0x19, 0xD4, 0xD9, 0x2C, 0xA7, 0x73, 0x99, 0x70, 0xAF,
+    0xC9, 0x39, 0xFF, 0x29, 0xEA, 0x09, 0xEA, 0x1E, 0xA2, 0xF0, 0x9E, 0x3A, 0xE0, 0xEA, 0x3A, 0xE0,
+    0xE9, 0x3E, 0xA0, 0xE9, 0x3E, 0x99, 0xE9, 0x29, 0xE1, 0xE9, 0x2E, 0x91, 0xF9, 0x9F, 0x29, 0xFE,
+    0xA4, 0x9F, 0xC9, 0x77, 0x77, 0x0A, 0xD7, 0x09, 0xE7, 0x0A, 0xE7, 0x1C, 0xA7, 0x77, 0x77, 0x1A,
+    0xA7, 0x70, 0x9E, 0x77, 0xFC, 0x76, 0xF9, 0x39, 0xA7, 0x1A, 0x95, 0xE9, 0x77, 0x0E, 0x97, 0x9A,
+    0xAA, 0xA9, 0x1A, 0xDA, 0x6F, 0xFC, 0xAD, 0xA5, 0x9F, 0xFF, 0x95, 0x9F, 0x91, 0x9F, 0xC5, 0x9F,
+    0x5F, 0x94, 0xF9, 0x5A, 0xEA, 0x39, 0xF6, 0xAE, 0xA3, 0xAE, 0x96, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3,
+    0xF7, 0xAE, 0xA3, 0xF7, 0xF9, 0x3F, 0x7F, 0x4F, 0x6A, 0xEA, 0x4F, 0x94, 0x9F, 0x5A, 0xF3, 0x9F,
+    0x96, 0xFC, 0xAA, 0xFC, 0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x77, 0x50, 0x77, 0x71, 0xCA,
+    0x74, 0xAD, 0x73, 0x9E, 0x73, 0xE7, 0x39, 0xD7, 0x5A, 0x29, 0xCA, 0x74, 0xAD, 0x79, 0x92, 0xE5,
+    0xAF, 0xCA, 0xD4, 0x9F, 0xFC, 0x49, 0xEA, 0x09, 0xEA, 0x4E, 0xA2, 0xF3, 0x9E, 0x3A, 0xE3, 0xEA,
+    0x3A, 0xE3, 0xE9, 0x3E, 0xA3, 0xE9, 0x3E, 0x92, 0x9E, 0x92, 0x9E, 0x4E, 0x92, 0xE9, 0x4F, 0x99,
+    0xF5, 0x9F, 0xEA, 0x79, 0xFC, 0x97, 0x76, 0x77, 0x74, 0xCA, 0x77, 0x1A, 0xDA, 0x77, 0x09, 0xF7,
+    0x71, 0xAE, 0x49, 0xA7, 0x39, 0xA3, 0xE9, 0x77, 0x0E, 0x97, 0x9A, 0xAA, 0xA9, 0x1A, 0xDA, 0x6F,
+    0xFC, 0xAD, 0xA5, 0x9F, 0xFF, 0x95, 0x9F, 0x91, 0x9F, 0xC5, 0x9F, 0x5F, 0x94, 0xF9, 0x5A, 0xEA,
+    0x39, 0xF6, 0xAE, 0xA3, 0xAE, 0x96, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xF9,
+    0x3F, 0x7F, 0x4F, 0x6A, 0xEA, 0x4F, 0x94, 0x9F, 0x5A, 0xF3, 0x9F, 0x96, 0xFC, 0xAA, 0xFC, 0x97,
+    0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x77, 0x50, 0x5A, 0x75, 0xD9, 0x74, 0xE7, 0x4A, 0xE7, 0x49,
+    0xDA, 0x75, 0xC9, 0x19, 0xCA, 0x74, 0xAD, 0x79, 0x92, 0xE5, 0xAF, 0xCA, 0xD4, 0x9F, 0xFC, 0x49,
+    0xEA, 0x09, 0xEA, 0x4E, 0xA2, 0xF3, 0x9E, 0x3A, 0xE3, 0xEA, 0x3A, 0xE3, 0xE9, 0x3E, 0xA3, 0xE9,
+    0x3E, 0x92, 0x9E, 0x92, 0x9E, 0x4E, 0x92, 0xE9, 0x4F, 0x99, 0xF5, 0x9F, 0xEA, 0x79, 0xFC, 0x97,
+    0x76, 0x77, 0x75, 0xAF, 0x97, 0x5A, 0xD9, 0xDA, 0x75, 0xAC, 0x1A, 0xCA, 0x77, 0x09, 0xD7, 0x79,
+    0xDA, 0x49, 0xA7, 0x19, 0xC9, 0x4E, 0x97, 0x19, 0x5E, 0x97, 0x9A, 0xAA, 0xA9, 0x1A, 0xDA, 0x6F,
+    0xFC, 0xAD, 0xA5, 0x9F, 0xFF, 0x95, 0x9F, 0x91, 0x9F, 0xC5, 0x9F, 0x5F, 0x94, 0xF9, 0x5A, 0xEA,
+    0x39, 0xF6, 0xAE, 0xA3, 0xAE, 0x96, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xF9,
+    0x3F, 0x7F, 0x4F, 0x6A, 0xEA, 0x4F, 0x94, 0x9F, 0x5A, 0xF3, 0x9F, 0x96, 0xFC, 0xAA, 0xFC, 0x97,
+    0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x77, 0x50, 0x6A, 0xDA, 0x72, 0xFC, 0xA7, 0x0A, 0xC9, 0x0A,
+    0xCA, 0x71, 0xA1, 0xD9, 0x72, 0x9D, 0xA7, 0x29, 0xD7, 0x5C, 0xA2, 0x9C, 0xA7, 0x4A, 0xD7, 0x99,
+    0x2E, 0x5A, 0xFC, 0xAD, 0x49, 0xFF, 0xC4, 0x9E, 0xA0, 0x9E, 0xA4, 0xEA, 0x2F, 0x39, 0xE3, 0xAE,
+    0x3E, 0xA3, 0xAE, 0x3E, 0x93, 0xEA, 0x3E, 0x93, 0xE9, 0x29, 0xE9, 0x29, 0xE4, 0xE9, 0x2E, 0x94,
+    0xF9, 0x9F, 0x59, 0xFE, 0xA7, 0x9F, 0xC9, 0x77, 0x60, 0x70, 0xA9, 0x29, 0x74, 0x9F, 0x0A, 0xC9,
+    0x73, 0xFF, 0x74, 0xD1, 0xE9, 0x29, 0xA7, 0x49, 0x3E, 0x97, 0x70, 0xE9, 0x79, 0xAA, 0xAA, 0x91,
+    0xAD, 0xA6, 0xFF, 0xCA, 0xDA, 0x59, 0xFF, 0xF9, 0x59, 0xF9, 0x19, 0xFC, 0x59, 0xF5, 0xF9, 0x4F,
+    0x95, 0xAE, 0xA3, 0x9F, 0x6A, 0xEA, 0x3A, 0xE9, 0x6A, 0xEA, 0x3F, 0x7A, 0xEA, 0x3F, 0x7A, 0xEA,
+    0x3F, 0x7F, 0x93, 0xF7, 0xF4, 0xF6, 0xAE, 0xA4, 0xF9, 0x49, 0xF5, 0xAF, 0x39, 0xF9, 0x6F, 0xCA,
+    0xAF, 0xC9, 0x79, 0xFF, 0xD9, 0x72, 0xAF, 0xD9, 0x77, 0x75, 0x59, 0x92, 0x97, 0x0F, 0x09, 0xCA,
+    0x6A, 0xFE, 0x96, 0xAC, 0x1E, 0xA7, 0x49, 0x19, 0xCA, 0x74, 0xAD, 0x79, 0x92, 0xE5, 0xAF, 0xCA,
+    0xD4, 0x9F, 0xFC, 0x49, 0xEA, 0x09, 0xEA, 0x4E, 0xA2, 0xF3, 0x9E, 0x3A, 0xE3, 0xEA, 0x3A, 0xE3,
+    0xE9, 0x3E, 0xA3, 0xE9, 0x3E, 0x92, 0x9E, 0x92, 0x9E, 0x4E, 0x92, 0xE9, 0x4F, 0x99, 0xF5, 0x9F,
+    0xEA, 0x79, 0xFC, 0x97, 0x76, 0x77, 0x19, 0xA7, 0x71, 0xE9, 0x77, 0x0E, 0x97, 0x9A, 0xAA, 0xA9,
+    0x1A, 0xDA, 0x6F, 0xFC, 0xAD, 0xA5, 0x9F, 0xFF, 0x95, 0x9F, 0x91, 0x9F, 0xC5, 0x9F, 0x5F, 0x94,
+    0xF9, 0x5A, 0xEA, 0x39, 0xF6, 0xAE, 0xA3, 0xAE, 0x96, 0xAE, 0xA3, 0xF7, 0xAE, 0xA3, 0xF7, 0xAE,
+    0xA3, 0xF7, 0xF9, 0x3F, 0x7F, 0x4F, 0x6A, 0xEA, 0x4F, 0x94, 0x9F, 0x5A, 0xF3, 0x9F, 0x96, 0xFC,
+    0xAA, 0xFC, 0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x77, 0x77, 0x77, 0xAD, 0x77, 0x09, 0xE7,
+    0x70, 0xAE, 0x77, 0x1C, 0xA7, 0x50, 0x73, 0x9C, 0xA7, 0x4A, 0xD7, 0x99, 0x2E, 0x5A, 0xFC, 0xAD,
+    0x49, 0xFF, 0xC4, 0x9E, 0xA0, 0x9E, 0xA4, 0xEA, 0x2F, 0x39, 0xE3, 0xAE, 0x3E, 0xA3, 0xAE, 0x3E,
+    0x93, 0xEA, 0x3E, 0x93, 0xE9, 0x29, 0xE9, 0x29, 0xE4, 0xE9, 0x2E, 0x94, 0xF9, 0x9F, 0x59, 0xFE,
+    0xA7, 0x9F, 0xC9, 0x77, 0x77, 0x71, 0xAD, 0x73, 0x9E, 0x73, 0xAE, 0x74, 0xCA, 0x72, 0x09, 0x99,
+    0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A, 0xFA, 0x92, 0xF5,
+    0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E, 0x4F, 0x59, 0xE4,
+    0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5, 0xEA, 0x4A, 0xEA,
+    0x3A, 0xE5, 0x9F, 0xFE, 0xA6, 0xFF, 0xDA, 0x70, 0xAF, 0xDA, 0x77, 0x77, 0x77, 0x29, 0xD7, 0x7E,
+    0x97, 0x59, 0xE7, 0x7A, 0xA9, 0x73, 0x39, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E,
+    0x92, 0xE9, 0x3E, 0x3E, 0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE,
+    0x39, 0xE1, 0x9F, 0x3A, 0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19,
+    0xF2, 0xAD, 0xA7, 0x77, 0x74, 0xD9, 0x72, 0xEA, 0x72, 0xE9, 0x72, 0xAC, 0x97, 0x77, 0x72, 0xAF,
+    0x97, 0x3A, 0xD9, 0xE7, 0x3A, 0xC1, 0xAC, 0xA7, 0x69, 0xD7, 0x59, 0xDA, 0x76, 0x9C, 0x97, 0x70,
+    0x97, 0x19, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0x2F, 0xE9, 0x9F, 0xD9, 0x2A,
+    0xFA, 0x92, 0xF5, 0x9E, 0x4E, 0xA5, 0xAD, 0xA3, 0x9E, 0x95, 0xEA, 0x3A, 0xE6, 0xE9, 0x3F, 0x6E,
+    0x4F, 0x59, 0xE4, 0xEA, 0x5A, 0xDA, 0x39, 0xE9, 0x5E, 0x93, 0xAE, 0x6E, 0x4F, 0x59, 0xE4, 0xF5,
+    0xEA, 0x4A, 0xEA, 0x3A, 0xE5, 0x9F, 0xFE, 0xA6, 0xFF, 0xDA, 0x70, 0xAF, 0xDA, 0x77, 0x73, 0x69,
+    0xAD, 0xA7, 0x09, 0xFC, 0x97, 0xD1, 0xD9, 0x79, 0x91, 0xD7, 0x29, 0xD9, 0x71, 0xAC, 0xA7, 0x39,
+    0xC9, 0x77, 0x79, 0x72, 0xAF, 0x92, 0x9E, 0x09, 0xFC, 0xA2, 0xEA, 0x3E, 0x92, 0xE9, 0x3E, 0x3E,
+    0x39, 0xE2, 0x9E, 0x3A, 0xDA, 0x2E, 0xA3, 0xE9, 0x2E, 0x93, 0xE2, 0xAE, 0x39, 0xE1, 0x9F, 0x3A,
+    0xDA, 0x09, 0xFC, 0x09, 0xA0, 0xFA, 0xD0, 0xFD, 0x0F, 0xD1, 0xFC, 0x19, 0xF2, 0xAD, 0xA7, 0x70,
+    0x77, 0x77, 0x1A, 0xC7, 0x71, 0x9E, 0x77, 0x0F, 0xC7, 0x7F, 0xA5, 0x99, 0x70, 0xAA, 0x7E, 0x97,
+    0x71, 0xE1, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x9A, 0xEA, 0x0A, 0xFE, 0x2F, 0xF9, 0x19, 0xFD,
+    0x92, 0xAF, 0xA9, 0x5F, 0x59, 0xE7, 0xEA, 0x5A, 0xE6, 0x9E, 0x95, 0xEA, 0x6A, 0xE6, 0xE9, 0x6F,
+    0x6E, 0x7F, 0x59, 0xE7, 0xEA, 0x5A, 0xDA, 0x69, 0xE9, 0x5E, 0x96, 0xAE, 0x6E, 0x7F, 0x59, 0xE7,
+    0xF5, 0xEA, 0x7A, 0xEA, 0x3A, 0xE7, 0x09, 0xFF, 0xEA, 0x71, 0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x77,
+    0x77, 0x10, 0x77, 0x73, 0x9C, 0x97, 0x6E, 0x75, 0xAD, 0xA7, 0x5E, 0x75, 0xAD, 0x76, 0x9A, 0x4A,
+    0xC7, 0x69, 0xD9, 0x39, 0x7A, 0xE1, 0xAF, 0x92, 0x9F, 0xA1, 0x9F, 0xCA, 0x2E, 0xA6, 0xE9, 0x2E,
+    0x96, 0xE3, 0xE6, 0x9E, 0x29, 0xE6, 0xAD, 0xA2, 0xEA, 0x6E, 0x92, 0xE9, 0x6E, 0x2A, 0xE6, 0x9E,
+    0x19, 0xF6, 0xAD, 0xA0, 0x9F, 0xC0, 0x9A, 0x3F, 0xAD, 0x0F, 0xD3, 0xFD, 0x1F, 0xC4, 0x9F, 0x2A,
+    0xDA, 0x77, 0x60, 0x77, 0x74, 0xCA, 0x77, 0x2A, 0xE7, 0x71, 0x9F, 0x77, 0x2A, 0xE6, 0x99, 0x72,
+    0x9A, 0x5E, 0x97, 0x71, 0xE1, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x9A, 0xEA, 0x0A, 0xFE, 0x2F,
+    0xF9, 0x19, 0xFD, 0x92, 0xAF, 0xA9, 0x5F, 0x59, 0xE7, 0xEA, 0x5A, 0xE6, 0x9E, 0x95, 0xEA, 0x6A,
+    0xE6, 0xE9, 0x6F, 0x6E, 0x7F, 0x59, 0xE7, 0xEA, 0x5A, 0xDA, 0x69, 0xE9, 0x5E, 0x96, 0xAE, 0x6E,
+    0x7F, 0x59, 0xE7, 0xF5, 0xEA, 0x7A, 0xEA, 0x3A, 0xE7, 0x09, 0xFF, 0xEA, 0x71, 0xFF, 0xDA, 0x73,
+    0xAF, 0xDA, 0x77, 0x77, 0x10, 0x59, 0x97, 0x7D, 0x76, 0x9E, 0x76, 0xEA, 0x76, 0xAD, 0x97, 0x69,
+    0xC4, 0xAC, 0x76, 0x9D, 0x93, 0x97, 0xAE, 0x1A, 0xF9, 0x29, 0xFA, 0x19, 0xFC, 0xA2, 0xEA, 0x6E,
+    0x92, 0xE9, 0x6E, 0x3E, 0x69, 0xE2, 0x9E, 0x6A, 0xDA, 0x2E, 0xA6, 0xE9, 0x2E, 0x96, 0xE2, 0xAE,
+    0x69, 0xE1, 0x9F, 0x6A, 0xDA, 0x09, 0xFC, 0x09, 0xA3, 0xFA, 0xD0, 0xFD, 0x3F, 0xD1, 0xFC, 0x49,
+    0xF2, 0xAD, 0xA7, 0x76, 0x77, 0x75, 0xAF, 0x97, 0x6A, 0xD9, 0xE7, 0x6A, 0xC1, 0xAC, 0xA7, 0x71,
+    0x9D, 0x77, 0x09, 0xDA, 0x69, 0x97, 0x09, 0xC9, 0x6E, 0x97, 0x09, 0x7E, 0x19, 0x99, 0x99, 0x99,
+    0x29, 0x99, 0x99, 0xAE, 0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xD9, 0x2A, 0xFA, 0x95, 0xF5, 0x9E,
+    0x7E, 0xA5, 0xAE, 0x69, 0xE9, 0x5E, 0xA6, 0xAE, 0x6E, 0x96, 0xF6, 0xE7, 0xF5, 0x9E, 0x7E, 0xA5,
+    0xAD, 0xA6, 0x9E, 0x95, 0xE9, 0x6A, 0xE6, 0xE7, 0xF5, 0x9E, 0x7F, 0x5E, 0xA7, 0xAE, 0xA3, 0xAE,
+    0x70, 0x9F, 0xFE, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA7, 0x77, 0x71, 0x69, 0xAD, 0xA7, 0x39,
+    0xFC, 0x97, 0x2D, 0x1D, 0x97, 0x29, 0x91, 0xD7, 0x59, 0xD9, 0x74, 0xAC, 0xA7, 0x69, 0xC9, 0x4A,
+    0xC7, 0x69, 0xD9, 0x39, 0x7A, 0xE1, 0xAF, 0x92, 0x9F, 0xA1, 0x9F, 0xCA, 0x2E, 0xA6, 0xE9, 0x2E,
+    0x96, 0xE3, 0xE6, 0x9E, 0x29, 0xE6, 0xAD, 0xA2, 0xEA, 0x6E, 0x92, 0xE9, 0x6E, 0x2A, 0xE6, 0x9E,
+    0x19, 0xF6, 0xAD, 0xA0, 0x9F, 0xC0, 0x9A, 0x3F, 0xAD, 0x0F, 0xD3, 0xFD, 0x1F, 0xC4, 0x9F, 0x2A,
+    0xDA, 0x77, 0x60, 0x79, 0x92, 0x97, 0x6F, 0x0A, 0xC9, 0x74, 0xAF, 0xE9, 0x74, 0xAC, 0x1E, 0xA4,
+    0x99, 0x73, 0x95, 0xE9, 0x77, 0x1E, 0x19, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0xAE, 0xA0, 0xAF,
+    0xE2, 0xFF, 0x91, 0x9F, 0xD9, 0x2A, 0xFA, 0x95, 0xF5, 0x9E, 0x7E, 0xA5, 0xAE, 0x69, 0xE9, 0x5E,
+    0xA6, 0xAE, 0x6E, 0x96, 0xF6, 0xE7, 0xF5, 0x9E, 0x7E, 0xA5, 0xAD, 0xA6, 0x9E, 0x95, 0xE9, 0x6A,
+    0xE6, 0xE7, 0xF5, 0x9E, 0x7F, 0x5E, 0xA7, 0xAE, 0xA3, 0xAE, 0x70, 0x9F, 0xFE, 0xA7, 0x1F, 0xFD,
+    0xA7, 0x3A, 0xFD, 0xA7, 0x77, 0x71, 0x6A, 0x92, 0x97, 0x19, 0xEA, 0x0A, 0xC9, 0x70, 0xDA, 0xFC,
+    0x71, 0xCA, 0x09, 0xE9, 0x76, 0x93, 0xAC, 0x76, 0x9D, 0x93, 0x97, 0xAE, 0x1A, 0xF9, 0x29, 0xFA,
+    0x19, 0xFC, 0xA2, 0xEA, 0x6E, 0x92, 0xE9, 0x6E, 0x3E, 0x69, 0xE2, 0x9E, 0x6A, 0xDA, 0x2E, 0xA6,
+    0xE9, 0x2E, 0x96, 0xE2, 0xAE, 0x69, 0xE1, 0x9F, 0x6A, 0xDA, 0x09, 0xFC, 0x09, 0xA3, 0xFA, 0xD0,
+    0xFD, 0x3F, 0xD1, 0xFC, 0x49, 0xF2, 0xAD, 0xA7, 0x76, 0x77, 0x29, 0x97, 0x72, 0xE9, 0x77, 0x1E,
+    0x19, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0xAE, 0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xD9, 0x2A,
+    0xFA, 0x95, 0xF5, 0x9E, 0x7E, 0xA5, 0xAE, 0x69, 0xE9, 0x5E, 0xA6, 0xAE, 0x6E, 0x96, 0xF6, 0xE7,
+    0xF5, 0x9E, 0x7E, 0xA5, 0xAD, 0xA6, 0x9E, 0x95, 0xE9, 0x6A, 0xE6, 0xE7, 0xF5, 0x9E, 0x7F, 0x5E,
+    0xA7, 0xAE, 0xA3, 0xAE, 0x70, 0x9F, 0xFE, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA7, 0x77, 0x77,
+    0x77, 0x39, 0xD7, 0x72, 0xE9, 0x77, 0x09, 0xE7, 0x72, 0xAA, 0x97, 0x60, 0x76, 0xAC, 0x76, 0x9D,
+    0x93, 0x97, 0xAE, 0x1A, 0xF9, 0x29, 0xFA, 0x19, 0xFC, 0xA2, 0xEA, 0x6E, 0x92, 0xE9, 0x6E, 0x3E,
+    0x69, 0xE2, 0x9E, 0x6A, 0xDA, 0x2E, 0xA6, 0xE9, 0x2E, 0x96, 0xE2, 0xAE, 0x69, 0xE1, 0x9F, 0x6A,
+    0xDA, 0x09, 0xFC, 0x09, 0xA3, 0xFA, 0xD0, 0xFD, 0x3F, 0xD1, 0xFC, 0x49, 0xF2, 0xAD, 0xA7, 0x77,
+    0x77, 0x5D, 0x97, 0x5E, 0xA7, 0x5E, 0x97, 0x5A, 0xC9, 0x72, 0x77, 0x7A, 0xC7, 0x7E, 0x97, 0x5F,
+    0xA7, 0x59, 0xEA, 0x76, 0x9A, 0x97, 0x77, 0x09, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x90, 0x9F,
+    0xE1, 0xFE, 0x1F, 0xCA, 0x29, 0xFA, 0x3F, 0x4E, 0x94, 0xAE, 0x3A, 0xDA, 0x6E, 0x92, 0xE7, 0xF1,
+    0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x1E, 0xAD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x75, 0xEA, 0x74, 0x9E,
+    0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xF7, 0x3F, 0xEA, 0x70, 0xAF, 0xE9, 0x70, 0x70, 0xA7, 0x6D, 0xA7,
+    0x5E, 0x97, 0x49, 0xE7, 0x59, 0xDA, 0x76, 0xCA, 0x77, 0x77, 0x29, 0x6A, 0xE9, 0x19, 0xE9, 0x3A,
+    0xFC, 0x2E, 0xA5, 0xAE, 0x2E, 0xA6, 0xE9, 0x1A, 0xDA, 0x6E, 0x91, 0xE9, 0x6A, 0xDA, 0x1E, 0x79,
+    0xDA, 0x09, 0xD9, 0x79, 0xDA, 0x0A, 0xD7, 0x1E, 0x0D, 0x97, 0x1E, 0xAD, 0x72, 0xFC, 0x73, 0xF9,
+    0x73, 0xEA, 0x73, 0x9E, 0x74, 0xE7, 0xCA, 0x19, 0xE7, 0x9F, 0xE7, 0x09, 0xFC, 0xA7, 0x2A, 0xDA,
+    0x73, 0x09, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x90, 0x9F, 0xE1, 0xFE, 0x1F, 0xCA, 0x29, 0xFA,
+    0x3F, 0x4E, 0x94, 0xAE, 0x3A, 0xDA, 0x6E, 0x92, 0xE7, 0xF1, 0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x1E,
+    0xAD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xF7,
+    0x3F, 0xEA, 0x70, 0xAF, 0xE9, 0x77, 0x77, 0x76, 0xAD, 0x75, 0x9E, 0x75, 0xAE, 0x76, 0xCA, 0x74,
+    0x75, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA, 0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD, 0xA6,
+    0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0, 0xD9,
+    0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E, 0x3A,
+    0xD0, 0x9F, 0xE3, 0x9E, 0x09, 0xFC, 0xA4, 0xAE, 0x1A, 0xDA, 0x7C, 0xA1, 0x77, 0x71, 0xFA, 0x73,
+    0xDA, 0xAD, 0x73, 0xCA, 0x1D, 0x76, 0xDA, 0x74, 0xE9, 0x75, 0xD7, 0x79, 0x97, 0x09, 0x99, 0x99,
+    0x99, 0x29, 0x99, 0x99, 0x90, 0x9F, 0xE1, 0xFE, 0x1F, 0xCA, 0x29, 0xFA, 0x3F, 0x4E, 0x94, 0xAE,
+    0x3A, 0xDA, 0x6E, 0x92, 0xE7, 0xF1, 0xE7, 0x09, 0xE0, 0xAD, 0x97, 0x1E, 0xAD, 0xA7, 0x2A, 0xFC,
+    0x73, 0x9F, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xF7, 0x3F, 0xEA, 0x70, 0xAF,
+    0xE9, 0x70, 0x71, 0xAD, 0xA7, 0x3F, 0xD7, 0x19, 0xCA, 0x09, 0xD7, 0x29, 0x1A, 0xCA, 0x73, 0x9A,
+    0xCA, 0x74, 0xD9, 0x75, 0xD7, 0x77, 0x73, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA, 0x5A,
+    0xE2, 0xEA, 0x6E, 0x91, 0xAD, 0xA6, 0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D, 0x97,
+    0x9D, 0xA0, 0xAD, 0x71, 0xE0, 0xD9, 0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x39,
+    0xE7, 0x4E, 0x7C, 0xA1, 0x9E, 0x79, 0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x69, 0xA2,
+    0x97, 0x2A, 0xE9, 0x0D, 0x70, 0x9F, 0xEA, 0x70, 0x9C, 0x90, 0xAE, 0x77, 0x77, 0x71, 0x99, 0x99,
+    0x99, 0x92, 0x99, 0x99, 0x99, 0x09, 0xFE, 0x1F, 0xE1, 0xFC, 0xA2, 0x9F, 0xA3, 0xF4, 0xE9, 0x4A,
+    0xE3, 0xAD, 0xA6, 0xE9, 0x2E, 0x7F, 0x1E, 0x70, 0x9E, 0x0A, 0xD9, 0x71, 0xEA, 0xDA, 0x72, 0xAF,
+    0xC7, 0x39, 0xF7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5F, 0x73, 0xFE, 0xA7, 0x0A,
+    0xFE, 0x97, 0x70, 0x9A, 0x29, 0x71, 0xF1, 0xCA, 0x79, 0xFE, 0xA7, 0x9C, 0x1E, 0xA7, 0x77, 0x77,
+    0x71, 0x96, 0xAE, 0x91, 0x9E, 0x93, 0xAF, 0xC2, 0xEA, 0x5A, 0xE2, 0xEA, 0x6E, 0x91, 0xAD, 0xA6,
+    0xE9, 0x1E, 0x96, 0xAD, 0xA1, 0xE7, 0x9D, 0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xAD, 0x71, 0xE0, 0xD9,
+    0x71, 0xEA, 0xD7, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x7C, 0xA1, 0x9E, 0x79,
+    0xFE, 0x70, 0x9F, 0xCA, 0x72, 0xAD, 0xA7, 0x30, 0x19, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA1, 0x6C, 0x1C, 0x1A, 0xDA,
+    0x2D, 0x2F, 0x19, 0xA9, 0x92, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A,
+    0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x97, 0x73, 0xC9, 0x6C,
+    0xA0, 0x99, 0x99, 0x99, 0xCA, 0xCA, 0xAA, 0xAA, 0xE3, 0x9C, 0x0C, 0x2A, 0xA1, 0xC1, 0x9A, 0x2C,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x69, 0x60,
+    0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x99, 0x99, 0xDA, 0xAA, 0xAA, 0xC0, 0xC9, 0x3C, 0x1A, 0xA2,
+    0xC2, 0xA9, 0x1C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x69, 0xAF, 0xD9, 0xFE, 0xAF, 0xE9, 0xAF, 0xD9, 0xFE, 0xAF, 0xE9, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0xFF, 0xF0, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xAF, 0xFF, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x92, 0x99, 0x0E, 0x1A, 0xD9, 0xE1,
+    0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD,
+    0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E,
+    0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A,
+    0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9A, 0xAA, 0x19, 0xAA, 0x00, 0xFF, 0xF9, 0xFF,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x4F, 0xFF, 0x9F, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x39, 0x29, 0xD2, 0xDA, 0x1E, 0x19, 0xDA, 0x1A, 0xD9, 0x1E, 0xA1, 0xAD, 0x97,
+    0x29, 0x92, 0xAE, 0x19, 0xE1, 0x9E, 0x1A, 0xD9, 0x1E, 0x1A, 0xD2, 0xD9, 0x70, 0x7E, 0x2E, 0x91,
+    0xE2, 0xE1, 0xAD, 0x91, 0xDA, 0x1A, 0xD3, 0x93, 0x19, 0x3E, 0x90, 0xAE, 0x1A, 0xDA, 0x19, 0xE2,
+    0xAD, 0x3D, 0xA2, 0x9D, 0x39, 0xA0, 0x39, 0x39, 0x29, 0xD2, 0xD9, 0x1D, 0xA1, 0xE1, 0xE1, 0xAD,
+    0x19, 0xDA, 0x1E, 0x1A, 0xD9, 0x09, 0xDA, 0x1E, 0xA0, 0xAE, 0x1A, 0xD9, 0x09, 0xDA, 0x74, 0x75,
+    0x9D, 0xA1, 0xE2, 0x9E, 0x1E, 0x3E, 0x1E, 0x29, 0xD9, 0x1D, 0xA2, 0xE1, 0xAD, 0x29, 0xD9, 0x1D,
+    0xA2, 0xD9, 0x1D, 0xA3, 0x93, 0x99, 0x30, 0x74, 0xE1, 0xE2, 0xE9, 0x0E, 0x91, 0xE1, 0xE2, 0xE1,
+    0xE1, 0xAD, 0x90, 0xAD, 0x91, 0xDA, 0x1D, 0xA1, 0xAD, 0x1A, 0xD3, 0x93, 0x93, 0x19, 0x39, 0x3E,
+    0x90, 0xE9, 0x0A, 0xE0, 0xAE, 0x1A, 0xDA, 0x0A, 0xDA, 0x19, 0xE0, 0x9E, 0x2A, 0xD1, 0xAD, 0x3D,
+    0xA1, 0xDA, 0x29, 0xD1, 0x9D, 0x39, 0xA2, 0x9A, 0x00, 0x49, 0xA9, 0x7E, 0x7D, 0xA7, 0xD7, 0x9D,
+    0x3A, 0xFF, 0xFF, 0xFA, 0x92, 0xD2, 0x94, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0xA7, 0xD9, 0x69, 0xD9,
+    0x6E, 0x7E, 0x77, 0x00, 0x69, 0xA9, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x71, 0x9D, 0x5A, 0xFF, 0xD1,
+    0xFF, 0xDA, 0x19, 0x2D, 0x91, 0x96, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA5, 0xAA, 0x99, 0xD9,
+    0x9A, 0xA9, 0x1F, 0xFD, 0x90, 0x9D, 0xAA, 0xDA, 0xAD, 0x5A, 0xCA, 0x71, 0xDA, 0x71, 0xDA, 0x70,
+    0xAD, 0xA7, 0x72, 0x70, 0xF1, 0xFC, 0x90, 0xFC, 0x90, 0xFC, 0x19, 0xE9, 0x70, 0x0A, 0x95, 0x9E,
+    0x93, 0x9F, 0xC9, 0x19, 0xFE, 0x99, 0xFF, 0x9F, 0xDA, 0x09, 0xFA, 0x29, 0xDA, 0x59, 0x60, 0x09,
+    0xA9, 0x09, 0xEA, 0xAF, 0x9E, 0xA1, 0x91, 0x09, 0xA9, 0x39, 0x90, 0x9E, 0x2E, 0x9F, 0x1A, 0xE9,
+    0xAD, 0xA1, 0xAE, 0x19, 0x49, 0x91, 0x09, 0xA9, 0x59, 0x95, 0x99, 0x09, 0xE4, 0xE9, 0x3E, 0xAF,
+    0x3A, 0xE9, 0x3E, 0xAE, 0xA3, 0x9E, 0x4E, 0x19, 0x69, 0x96, 0x91, 0x0A, 0xD9, 0x9F, 0xAF, 0x0E,
+    0x94, 0x73, 0xC9, 0x6C, 0xA0, 0x92, 0x99, 0xCA, 0xC9, 0x1A, 0xAE, 0x39, 0xC0, 0xC2, 0xAA, 0x1C,
+    0x19, 0xA2, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0x96, 0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x29, 0xDA, 0xA1, 0x9C, 0x0C, 0x93, 0xC1, 0xAA,
+    0x2C, 0x2A, 0x91, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0xC6, 0xC6, 0x90, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xA9, 0xAA, 0xA0, 0x9A, 0x09, 0xA0, 0xA9,
+    0x29, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59,
+    0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x72, 0x29, 0x19, 0x6A, 0xA0,
+    0xC9, 0x6A, 0xA0, 0xCA, 0x19, 0x99, 0x99, 0xCA, 0x0A, 0xA0, 0xCA, 0xAA, 0xAD, 0x09, 0xC0, 0xC2,
+    0x9C, 0x09, 0xC1, 0xC1, 0x9C, 0x09, 0xC2, 0xC1, 0xA0, 0x9A, 0x3C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+    0x71, 0x97, 0x10, 0x59, 0x59, 0xC0, 0xAA, 0x4A, 0xC0, 0xAA, 0x4A, 0xC0, 0xAC, 0x99, 0x99, 0x90,
+    0xC9, 0x0D, 0xAA, 0xAA, 0xC1, 0xC9, 0x0C, 0x92, 0xC2, 0xAA, 0x0C, 0x91, 0xC3, 0xA9, 0x0A, 0x1C,
+    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+    0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x19, 0x00, 0x77, 0x77, 0x69, 0x70, 0xAC, 0x77, 0x1A,
+    0xFA, 0x59, 0xDA, 0x77, 0xEA, 0xE9, 0x4E, 0x77, 0xAD, 0x90, 0x9D, 0xA3, 0xAD, 0x77, 0x0E, 0x2D,
+    0xA2, 0x9D, 0x97, 0x79, 0xD9, 0x2D, 0xA2, 0xDA, 0x77, 0x0A, 0xD9, 0x19, 0xD9, 0x1E, 0x77, 0x1A,
+    0xD2, 0xE1, 0x9D, 0x77, 0x2A, 0xD9, 0x09, 0xDA, 0x1D, 0x91, 0xAE, 0xA5, 0xAE, 0x90, 0x9E, 0xAE,
+    0x1D, 0xA1, 0xFD, 0xA2, 0x9F, 0xD9, 0x09, 0xFA, 0x1A, 0xD1, 0xE1, 0xE1, 0x9D, 0xA0, 0x9E, 0x79,
+    0xD1, 0x9D, 0x91, 0xAD, 0x90, 0xE2, 0xE7, 0xD9, 0x1E, 0x2A, 0xD1, 0xDA, 0x2E, 0x6E, 0x2E, 0x2E,
+    0x09, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0xA2, 0xDA, 0x0A, 0xD9, 0x1A, 0xD9, 0x49, 0xD9, 0x3E, 0x1A,
+    0xD9, 0x09, 0xD9, 0x1E, 0x5E, 0x4E, 0xAA, 0xDA, 0x19, 0xE9, 0xE5, 0xE5, 0x9F, 0xCA, 0x3A, 0xFC,
+    0x6A, 0xC9, 0x79, 0xA9, 0x79, 0x99, 0x70, 0x97, 0x77, 0x20, 0x70, 0xD9, 0x19, 0xE1, 0xAD, 0xA1,
+    0xE1, 0xAD, 0xA1, 0xE2, 0xD3, 0x99, 0x20, 0x75, 0xD9, 0x1D, 0x29, 0xE0, 0x9D, 0xA1, 0xAD, 0xA0,
+    0xE9, 0x1E, 0x09, 0xE1, 0xAD, 0xA0, 0xAD, 0x91, 0xE1, 0xE2, 0xD1, 0x9D, 0x39, 0x92, 0x99, 0x20,
+    0x77, 0x3D, 0x91, 0x9C, 0xA2, 0xD2, 0x9E, 0x1E, 0x90, 0x9D, 0xA1, 0xAD, 0xA0, 0x9E, 0x1E, 0x91,
+    0xE1, 0xAD, 0xA0, 0x9E, 0x1A, 0xDA, 0x1E, 0x1A, 0xD9, 0x1E, 0x1A, 0xD9, 0x1E, 0x2D, 0x2A, 0xCA,
+    0x19, 0xD3, 0x99, 0x3A, 0x39, 0x92, 0x6A, 0xC9, 0x19, 0xDA, 0x2E, 0x2A, 0xDA, 0x2E, 0x2A, 0xD9,
+    0x2D, 0xA3, 0xA0, 0x74, 0xAC, 0x91, 0x9C, 0xA2, 0x9D, 0xA1, 0xE3, 0xE1, 0xAD, 0xA2, 0xAD, 0xA0,
+    0x9E, 0x3E, 0x1A, 0xD9, 0x2A, 0xD9, 0x1E, 0x3D, 0xA1, 0x9D, 0x4A, 0x39, 0x90, 0x77, 0x1A, 0xC9,
+    0x19, 0xCA, 0x2D, 0x29, 0xDA, 0x1E, 0x1A, 0xDA, 0x2E, 0x1A, 0xDA, 0x09, 0xE2, 0xAD, 0xA0, 0x9E,
+    0x1E, 0x92, 0xE1, 0xAD, 0x90, 0x9E, 0x2A, 0xD9, 0x1E, 0x1A, 0xD9, 0x2D, 0xA1, 0x9D, 0x2D, 0x93,
+    0xA3, 0x99, 0x39, 0x00, 0x39, 0xA7, 0x9D, 0xA5, 0x9F, 0xA3, 0x9D, 0xA0, 0xDA, 0x19, 0xDA, 0x2D,
+    0xA7, 0x30, 0x75, 0xAC, 0xA4, 0xEA, 0x29, 0xE9, 0x29, 0xE9, 0x3E, 0xA4, 0xF5, 0xE9, 0x49, 0xE6,
+    0xD9, 0x72, 0x71, 0x9D, 0x49, 0xE4, 0xAE, 0x4F, 0x3A, 0xE2, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x3D,
+    0xA7, 0x30, 0x77, 0x9C, 0x72, 0xAC, 0x09, 0xD2, 0x9D, 0x29, 0xD1, 0xAD, 0x1A, 0xD9, 0x09, 0xD3,
+    0xAD, 0x1C, 0xA0, 0x9D, 0x5A, 0xD2, 0x9D, 0x7A, 0xCA, 0x1D, 0x95, 0xA1, 0xDA, 0xD9, 0x09, 0x92,
+    0xE1, 0xE9, 0x09, 0xDA, 0x1E, 0x1E, 0x90, 0x9D, 0xA2, 0x91, 0xDA, 0xD9, 0x09, 0x95, 0xDA, 0x1D,
+    0x96, 0xAC, 0xA3, 0xD9, 0x4A, 0xD0, 0x9C, 0xA0, 0x9D, 0x3A, 0xD1, 0xAD, 0x90, 0x9D, 0x19, 0xD2,
+    0x9D, 0x29, 0xD0, 0x9C, 0x72, 0xAA, 0x77, 0x00, 0x39, 0xAA, 0x39, 0xAA, 0x39, 0xE2, 0xAE, 0x3E,
+    0xA2, 0xEA, 0x29, 0xE9, 0x19, 0xE3, 0x9E, 0x2A, 0xE3, 0xAD, 0xA2, 0xEA, 0x3E, 0x92, 0xE4, 0xE3,
+    0xE4, 0xE2, 0x9D, 0xA4, 0xDA, 0x29, 0xD9, 0x39, 0xD9, 0x29, 0xD4, 0x9D, 0x3A, 0xD4, 0xAD, 0x3A,
+    0xCA, 0x4A, 0xC9, 0x3D, 0x97, 0x74, 0x95, 0x94, 0x9E, 0x29, 0xDA, 0x3A, 0xE2, 0xEA, 0x3A, 0xD9,
+    0x2E, 0x94, 0x95, 0x95, 0xFF, 0xF9, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF,
+    0x9F, 0xC9, 0xFC, 0x00, 0x77, 0x75, 0x9C, 0x97, 0x5E, 0x74, 0xAD, 0x97, 0x39, 0xD9, 0x74, 0xDA,
+    0x74, 0xE7, 0x49, 0xD7, 0x5D, 0x97, 0x4D, 0xA7, 0x4A, 0xD7, 0x49, 0xD7, 0x5D, 0x97, 0x4E, 0x74,
+    0xAD, 0x74, 0x9D, 0x97, 0x4D, 0xA7, 0x4E, 0x74, 0xAD, 0x97, 0x4A, 0xCA, 0x77, 0x75, 0x77, 0x29,
+    0xF4, 0xFA, 0x19, 0xFD, 0x2F, 0xDA, 0x0A, 0xFD, 0xA1, 0xFE, 0x09, 0xC9, 0x1E, 0x1C, 0xA1, 0xAD,
+    0x94, 0xE5, 0x9D, 0x94, 0xD9, 0x5E, 0x4E, 0x5A, 0xD9, 0x3E, 0x5A, 0xD9, 0x29, 0xE5, 0xAD, 0x93,
+    0xDA, 0x5A, 0xD4, 0xAD, 0x6D, 0xA4, 0xFC, 0x39, 0xFA, 0x29, 0xEA, 0x4F, 0x77, 0x79, 0x79, 0x59,
+    0xDA, 0x5E, 0x4E, 0xA4, 0x9E, 0x4E, 0x94, 0x9D, 0xA5, 0x97, 0x99, 0x50, 0x73, 0x9A, 0xA1, 0x9F,
+    0x49, 0xE0, 0x9F, 0xD3, 0xEA, 0x0A, 0xFD, 0xA2, 0xE9, 0x09, 0xC9, 0x1E, 0x19, 0xE6, 0xE1, 0xAD,
+    0xA6, 0xD9, 0x1E, 0x95, 0xE2, 0xE5, 0xE3, 0xE3, 0x9E, 0x4D, 0xA3, 0xDA, 0x49, 0xD9, 0x2A, 0xD5,
+    0x9D, 0x3F, 0xC3, 0x9D, 0x39, 0xEA, 0x3A, 0xCA, 0x77, 0x59, 0x69, 0x49, 0xDA, 0x39, 0xE3, 0xEA,
+    0x3A, 0xE3, 0xE9, 0x3A, 0xD9, 0x49, 0x69, 0x50, 0x39, 0xAA, 0x74, 0x9E, 0x19, 0xF9, 0x4E, 0xA1,
+    0xFD, 0x92, 0x9E, 0x91, 0xFE, 0x29, 0xE2, 0xC9, 0x1E, 0x2A, 0xDA, 0x6A, 0xD2, 0xE9, 0x6E, 0x2E,
+    0x6A, 0xD3, 0xE5, 0xE4, 0xDA, 0x4E, 0x49, 0xD9, 0x3E, 0x59, 0xD3, 0x9D, 0x95, 0xAD, 0x39, 0xFA,
+    0x3A, 0xC9, 0x4E, 0xA7, 0x76, 0x96, 0x95, 0x9E, 0x4E, 0x4A, 0xE3, 0xAE, 0x4A, 0xD9, 0x3A, 0xDA,
+    0x59, 0x69, 0x60, 0x39, 0x73, 0xFC, 0xA3, 0xAC, 0x90, 0xFF, 0xAA, 0xE9, 0xAD, 0x91, 0xAF, 0xDA,
+    0x1A, 0x94, 0xAD, 0xA9, 0x77, 0x00, 0x77, 0x71, 0xD9, 0x19, 0xCA, 0x2D, 0x2A, 0xCA, 0x29, 0xE1,
+    0xE9, 0x09, 0xDA, 0x1E, 0x2A, 0xDA, 0x09, 0xE1, 0xE9, 0x09, 0xE2, 0xE1, 0xAD, 0xA0, 0x9E, 0x1E,
+    0x91, 0xAD, 0xA1, 0xE1, 0xAD, 0x91, 0xE2, 0xE1, 0xAD, 0x91, 0xE1, 0xAD, 0x92, 0xD2, 0xAC, 0xA1,
+    0x9D, 0x2D, 0xA3, 0x99, 0x3A, 0x39, 0x93, 0xA3, 0x49, 0xA9, 0x59, 0xFC, 0xA2, 0x9D, 0xA9, 0xE2,
+    0xE1, 0xAD, 0x90, 0xAD, 0x91, 0x9D, 0x90, 0xE2, 0x9D, 0x90, 0xDA, 0x2A, 0xD0, 0x9D, 0xA2, 0xE0,
+    0x9D, 0xA1, 0x9D, 0x91, 0xE1, 0xE2, 0xAF, 0xD4, 0xAE, 0x93, 0x79, 0x97, 0xE6, 0xEA, 0x5F, 0xA4,
+    0xD9, 0xD9, 0x3D, 0x90, 0xD3, 0xD9, 0x09, 0xD2, 0xE9, 0x9E, 0x90, 0x9F, 0xFC, 0x19, 0x99, 0x9A,
+    0xDA, 0x95, 0x9D, 0x79, 0xCA, 0x20, 0x49, 0x99, 0x99, 0x4F, 0xD9, 0x29, 0xDA, 0xAA, 0xA3, 0xAC,
+    0xA7, 0xEA, 0x6F, 0xC9, 0x69, 0xE7, 0xAD, 0x7E, 0x59, 0xE9, 0x2F, 0xD9, 0x3F, 0xA7, 0x70, 0x59,
+    0x9A, 0x4A, 0xFC, 0x2E, 0xA9, 0x3E, 0x5A, 0xDA, 0x93, 0x9F, 0xDA, 0x1A, 0xD9, 0x9A, 0xD9, 0x0D,
+    0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0A, 0xD1, 0x9D, 0x90, 0x9F, 0xDA, 0x3A, 0xE9, 0x20, 0x09, 0x99,
+    0x99, 0x99, 0x1F, 0xFA, 0xDA, 0xAE, 0xAD, 0x2E, 0x09, 0x91, 0xAD, 0x49, 0xD9, 0x4D, 0xA4, 0xE4,
+    0xAD, 0x94, 0xE4, 0x9D, 0x94, 0x9D, 0x76, 0x49, 0xAA, 0x94, 0x9F, 0xCA, 0x3D, 0xA0, 0xAD, 0x2A,
+    0xD1, 0x9D, 0x29, 0xD9, 0x0D, 0xA3, 0xAF, 0x93, 0x9F, 0xC9, 0x29, 0xD1, 0xE2, 0xDA, 0x19, 0xD9,
+    0x1D, 0xA1, 0xAD, 0x2A, 0xFD, 0x93, 0xAE, 0xA3, 0x49, 0xA9, 0x5A, 0xFC, 0x3A, 0xD9, 0x9E, 0x2D,
+    0xA1, 0x9D, 0x2D, 0x91, 0x9D, 0x2D, 0xA1, 0xAD, 0x2A, 0xFE, 0x3A, 0xFC, 0x95, 0x9D, 0xA5, 0xAE,
+    0x29, 0xFC, 0xA4, 0xEA, 0x50, 0x19, 0x92, 0x99, 0x2E, 0x9A, 0xE3, 0xDA, 0xCA, 0xD3, 0xE0, 0x9D,
+    0x3D, 0xA0, 0xAC, 0xA2, 0x9D, 0x1D, 0x92, 0xAC, 0xA1, 0xD9, 0xA1, 0xD9, 0x09, 0xF1, 0xD2, 0xDA,
+    0x74, 0x39, 0xEA, 0x4F, 0xE2, 0xAD, 0x90, 0xE9, 0x09, 0xDA, 0x19, 0xD9, 0x0A, 0xD2, 0x9D, 0x90,
+    0xE2, 0xAD, 0x90, 0xDA, 0x2E, 0x09, 0xDA, 0x2D, 0xA1, 0xDA, 0x1A, 0xD2, 0xEA, 0xAD, 0xA2, 0x9F,
+    0xC9, 0x59, 0xA9, 0x40, 0x73, 0x9D, 0x2F, 0xC2, 0xAA, 0xE4, 0xDA, 0x4D, 0x93, 0x9D, 0x93, 0xAD,
+    0x4E, 0x4D, 0xA2, 0x9A, 0xE9, 0x09, 0xFD, 0x19, 0x99, 0x99, 0x10, 0x3A, 0xEA, 0x4F, 0xE2, 0xE1,
+    0xAD, 0x2A, 0xC2, 0xAD, 0x69, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x6F, 0xF9, 0x1F,
+    0xF4, 0x99, 0x99, 0x30, 0x29, 0xEA, 0x2F, 0xDA, 0x1D, 0x1E, 0x19, 0x2D, 0xA3, 0x9E, 0x29, 0xF9,
+    0x29, 0xAA, 0xE5, 0x9D, 0x5E, 0x09, 0x99, 0xAE, 0x90, 0xFD, 0x91, 0x9A, 0xA9, 0x40, 0x69, 0xD6,
+    0xAE, 0x5A, 0xEA, 0x4A, 0xF9, 0x39, 0xD0, 0xD3, 0x9D, 0x09, 0xD2, 0x9D, 0x1A, 0xD1, 0x9F, 0xFC,
+    0x90, 0xFF, 0xC5, 0x9D, 0x79, 0xD7, 0x09, 0x92, 0x3A, 0xAA, 0xAA, 0xA9, 0x3F, 0xD3, 0xAD, 0x99,
+    0x99, 0x3D, 0xA7, 0xFA, 0x59, 0xAE, 0xA7, 0xE7, 0xAD, 0x69, 0xDA, 0x29, 0x99, 0xF3, 0xFC, 0xA4,
+    0x9A, 0xA9, 0x50, 0x49, 0xEA, 0x29, 0xFC, 0xA1, 0xAE, 0x93, 0x9D, 0xA5, 0xFC, 0xA2, 0x9F, 0xE1,
+    0xAD, 0x19, 0xDA, 0x0D, 0xA2, 0xDA, 0x0E, 0x2D, 0x90, 0xAD, 0x99, 0xE2, 0xFD, 0x49, 0xAA, 0x93,
+    0x0A, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xAC, 0xA1, 0xAD, 0x9A, 0xC2, 0xDA, 0x4D, 0xA4, 0xAD, 0x49,
+    0xD9, 0x4D, 0xA4, 0xE4, 0x9D, 0xA4, 0xAD, 0x6A, 0x95, 0x39, 0xEA, 0x4A, 0xDA, 0xE2, 0x9D, 0x19,
+    0xD2, 0xAD, 0x1A, 0xD3, 0xEA, 0xD4, 0xAF, 0x4D, 0xA9, 0xE2, 0xAD, 0x1A, 0xD9, 0x1D, 0xA1, 0x9D,
+    0x91, 0xE9, 0x9E, 0x29, 0xFC, 0xA5, 0x99, 0x94, 0x3A, 0xE9, 0x4F, 0xDA, 0x2E, 0x1A, 0xD2, 0xD9,
+    0x19, 0xD2, 0xD9, 0x19, 0xD2, 0xE9, 0x9A, 0xD2, 0x9F, 0xDA, 0x49, 0x9E, 0x6A, 0xD9, 0x39, 0xAE,
+    0x92, 0x9F, 0xA5, 0x99, 0x96, 0x77, 0x49, 0xFF, 0xEA, 0x3A, 0xFF, 0xEA, 0x5F, 0x99, 0x99, 0xD9,
+    0x5E, 0xA3, 0xD6, 0xE9, 0x3C, 0xA5, 0x9E, 0x74, 0xAE, 0x74, 0xFF, 0xC7, 0xFF, 0xA6, 0x9E, 0xA9,
+    0x99, 0x97, 0xAE, 0x72, 0x9A, 0xFA, 0xA9, 0x7A, 0xFE, 0xA7, 0x1E, 0x97, 0x39, 0xE9, 0x71, 0x9F,
+    0xEA, 0x7F, 0xF9, 0x60, 0x73, 0x97, 0x49, 0xFC, 0x97, 0x0A, 0xFE, 0x79, 0xE1, 0xE9, 0x6E, 0x29,
+    0xD9, 0x5A, 0xDA, 0x29, 0xC9, 0x6E, 0x97, 0x19, 0xAA, 0xE9, 0x9A, 0xA9, 0x5F, 0xFD, 0x69, 0x9E,
+    0xA9, 0x99, 0x95, 0x99, 0x9E, 0x99, 0x99, 0x95, 0xFF, 0xD6, 0x9A, 0xEA, 0xAA, 0xA9, 0x70, 0xE7,
+    0x49, 0xE7, 0x2F, 0xDA, 0xAA, 0xAA, 0xE1, 0x9F, 0xFF, 0xCA, 0x19, 0xEA, 0x09, 0xAF, 0xD3, 0x99,
+    0x75, 0x79, 0x99, 0x77, 0x71, 0xAF, 0xF9, 0x77, 0x5F, 0xFE, 0xA7, 0x74, 0xA9, 0xF0, 0x9F, 0x97,
+    0x75, 0xEA, 0x19, 0xEA, 0x77, 0x5E, 0x92, 0xEA, 0x2D, 0x97, 0x69, 0xE3, 0xEA, 0x1A, 0xD7, 0x7A,
+    0xE2, 0x9E, 0x91, 0xE9, 0x94, 0xAA, 0xA5, 0xF2, 0xF0, 0xFE, 0xA1, 0xAF, 0xC4, 0xF9, 0xAF, 0x1A,
+    0xFA, 0xA1, 0x9D, 0x99, 0xAC, 0x4F, 0xFA, 0x3E, 0x93, 0xAD, 0x79, 0xFC, 0xA9, 0x5E, 0x4A, 0xE9,
+    0x5A, 0xE7, 0x1E, 0x5F, 0x94, 0xF7, 0x09, 0xE6, 0xAE, 0x93, 0xEA, 0x70, 0xAD, 0xA1, 0x90, 0x92,
+    0xAD, 0xA2, 0x9E, 0xA7, 0x0E, 0xA9, 0xD0, 0xD1, 0x9D, 0x91, 0xFE, 0x96, 0xFD, 0xA9, 0xFE, 0x1A,
+    0xFE, 0x96, 0x9F, 0x91, 0x9F, 0xA7, 0x77, 0x73, 0x73, 0x99, 0x74, 0xAF, 0xDA, 0x79, 0xFF, 0xC6,
+    0x9F, 0xA9, 0x0A, 0xD5, 0x9E, 0xA3, 0xAC, 0xA5, 0xEA, 0x4A, 0xA5, 0x9E, 0x73, 0xAF, 0xFD, 0x6F,
+    0xFD, 0xA7, 0x9E, 0x73, 0xAF, 0xFD, 0x6F, 0xFD, 0xA7, 0x09, 0xE7, 0x59, 0xE9, 0x75, 0xF9, 0x49,
+    0x95, 0xAF, 0xCA, 0xAA, 0xDA, 0x6A, 0xFF, 0xC7, 0x09, 0xFD, 0xA7, 0x75, 0x77, 0x5C, 0x97, 0x5E,
+    0x74, 0xE9, 0x73, 0xE7, 0x4F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x2A,
+    0xD9, 0x75, 0xAD, 0xA7, 0x5A, 0xD7, 0x6A, 0x72, 0x5A, 0x72, 0xE7, 0x0F, 0xC6, 0xFE, 0x39, 0xDA,
+    0xFD, 0x91, 0xAD, 0x0E, 0x0D, 0xA2, 0xC9, 0x0E, 0x09, 0xC6, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x71, 0x77, 0x72, 0x9C, 0x75, 0x9E, 0x75, 0x9E, 0x76,
+    0xE2, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x3A, 0xDA, 0x73, 0xAD,
+    0xA7, 0x4D, 0xA7, 0x6A, 0x40, 0x49, 0xA9, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0xE6, 0xC9, 0x0E, 0x0A, 0xC2, 0xE0, 0xE9, 0xE2, 0xFF, 0xC4, 0xFE, 0x6F,
+    0xC7, 0x0D, 0xA7, 0x71, 0x4A, 0x4A, 0x70, 0xDA, 0x2A, 0xD6, 0xE9, 0x29, 0xE4, 0xDA, 0x6E, 0x2F,
+    0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA2, 0xAD, 0x94, 0x9D, 0xA4,
+    0xEA, 0x2A, 0xE6, 0xD9, 0x29, 0xD7, 0x09, 0x49, 0x40, 0x39, 0xC9, 0x69, 0xE9, 0x49, 0xFC, 0x92,
+    0x9F, 0xE9, 0x09, 0xDA, 0xEA, 0xD9, 0x0D, 0x0E, 0x0D, 0x4E, 0x7E, 0x7E, 0x7E, 0x49, 0x90, 0xE0,
+    0x99, 0x09, 0xD0, 0xE0, 0xD9, 0x0F, 0xFC, 0x2F, 0xE4, 0xFC, 0x6E, 0x70, 0x94, 0x77, 0x1A, 0xCA,
+    0x70, 0xFC, 0x6F, 0xE4, 0xFF, 0xC2, 0x9D, 0x0E, 0x0D, 0x92, 0x99, 0x0E, 0x09, 0x96, 0xE7, 0x1E,
+    0x69, 0x90, 0xE0, 0x99, 0x29, 0xD0, 0xE0, 0xD9, 0x2F, 0xFC, 0x4F, 0xE6, 0xFC, 0x70, 0xAC, 0xA5,
+    0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x77, 0x2E, 0x7E, 0x7E, 0x7D, 0xA7, 0xDA, 0x7D, 0xA3, 0xCA,
+    0x1D, 0xA2, 0xAD, 0xA0, 0xDA, 0x1A, 0xDA, 0x1D, 0xA0, 0xAD, 0x92, 0xDA, 0xAF, 0xFC, 0xAF, 0xFD,
+    0xA0, 0xEA, 0xAA, 0xAA, 0xA9, 0x1E, 0x79, 0xE9, 0x69, 0xD9, 0x79, 0x94, 0x72, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xAD, 0x7A, 0xD1, 0xAC, 0x3A, 0xD0, 0xAD, 0xA2, 0xAD, 0x1A, 0xDA, 0x1A, 0xD2, 0x9D,
+    0xA0, 0xAF, 0xFC, 0xAA, 0xFF, 0xD9, 0xAA, 0xAA, 0xAA, 0xE6, 0xE5, 0x9E, 0x69, 0xD9, 0x79, 0x93,
+    0x77, 0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x39, 0xC4, 0xAD, 0x92, 0x9E, 0x39, 0xD9, 0x19, 0xE4, 0x9D,
+    0x19, 0xDA, 0x59, 0xD1, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x1A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2,
+    0xAD, 0x97, 0x3E, 0xA7, 0x3D, 0xA7, 0x4A, 0x70, 0x77, 0x6C, 0xA7, 0x5E, 0x74, 0xE7, 0x4E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xD2, 0xFF, 0xFD, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1D, 0x76, 0xAF,
+    0xFF, 0xD2, 0xAF, 0xFF, 0xC3, 0xAD, 0x90, 0x99, 0x99, 0x99, 0x9A, 0x4A, 0xD7, 0x6E, 0x76, 0xC9,
+    0x77, 0x71, 0x69, 0x74, 0xE7, 0x2F, 0xC7, 0x0E, 0x0E, 0x6E, 0xA0, 0xAE, 0x4F, 0xA0, 0xAF, 0x2E,
+    0x9C, 0xA0, 0xAC, 0x9E, 0x19, 0xC0, 0x9C, 0xA0, 0xAC, 0x90, 0xC9, 0x49, 0xCA, 0x0A, 0xC9, 0x79,
+    0xCA, 0x0A, 0xC9, 0x7A, 0xCA, 0x0A, 0xC9, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A,
+    0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x7A, 0xCA, 0x0A, 0xCA, 0x77, 0x20, 0x77, 0x71, 0xAC,
+    0x76, 0xE7, 0x6E, 0x4D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE3, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x76, 0xD1, 0xFF, 0xFD, 0xA1, 0xFF, 0xFC, 0xA2, 0xA9, 0x99, 0x99, 0x99, 0x09, 0xDA,
+    0x74, 0xDA, 0x74, 0xE7, 0x59, 0xC7, 0x76, 0x49, 0x29, 0x70, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0,
+    0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0xAC, 0xA0, 0xAC, 0xA7, 0x9C, 0xA0,
+    0xAC, 0x97, 0x9C, 0xA0, 0xAC, 0x97, 0x9C, 0xA0, 0xAC, 0x94, 0xAC, 0x09, 0xCA, 0x0A, 0xC9, 0x0C,
+    0xA1, 0xEA, 0xCA, 0x0A, 0xCA, 0xE2, 0xFA, 0x0A, 0xF4, 0xAD, 0xA0, 0xAD, 0xA6, 0xAD, 0x9D, 0xA7,
+    0x0A, 0xEA, 0x72, 0xAC, 0xA7, 0x74, 0x49, 0x39, 0x72, 0xD2, 0xD7, 0x0D, 0xA2, 0xAD, 0x6E, 0x99,
+    0x99, 0x9E, 0x4F, 0xFF, 0xC2, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xD0, 0x9D, 0x72, 0xD9, 0x0A,
+    0xFF, 0xFC, 0xA2, 0xFF, 0xFA, 0x4E, 0x39, 0xE6, 0xE2, 0xE7, 0x0D, 0x2D, 0x77, 0x50, 0x09, 0x99,
+    0x97, 0x19, 0x99, 0x0A, 0xEA, 0x7A, 0xDA, 0x09, 0xF7, 0xE2, 0xF9, 0x59, 0xE2, 0xAE, 0xA5, 0xE9,
+    0x3F, 0xAA, 0xAA, 0xAA, 0xE4, 0xFF, 0xFA, 0x4A, 0xFF, 0xE6, 0xF3, 0xDA, 0x6F, 0x91, 0xAD, 0x96,
+    0x9E, 0xA1, 0xE7, 0x0F, 0x09, 0xD9, 0x70, 0xAE, 0x9A, 0xD7, 0x19, 0xEA, 0xDA, 0x72, 0xFD, 0x73,
+    0xAF, 0xA7, 0x4F, 0x97, 0x4E, 0xA7, 0x69, 0x70, 0x59, 0xA9, 0x7F, 0xDA, 0x4F, 0xFA, 0x3C, 0x92,
+    0xAE, 0x71, 0xEA, 0x70, 0xEA, 0x70, 0xAE, 0x4A, 0xFE, 0x29, 0xFF, 0xC1, 0x9E, 0xA9, 0xAF, 0x1E,
+    0x92, 0xAD, 0xA0, 0xAD, 0xA3, 0xEA, 0x0E, 0x93, 0xE9, 0x9E, 0x4E, 0x09, 0xE3, 0x9D, 0xA0, 0x9E,
+    0x3E, 0x90, 0x9E, 0x2A, 0xE2, 0xEA, 0x9A, 0xE3, 0xAF, 0xE5, 0xAF, 0xA7, 0x71, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xE9, 0x9F, 0xFE, 0xA0, 0xA9, 0x99, 0x99, 0x9A, 0xEA, 0x7A, 0xEA,
+    0x7A, 0xEA, 0x7A, 0xEA, 0x7A, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x0A, 0xAA, 0xAA, 0xA9, 0xAE,
+    0xA7, 0xAE, 0xA7, 0xAE, 0xA7, 0xAE, 0xA7, 0xAE, 0xA9, 0xEA, 0xAA, 0xAF, 0xAA, 0xFF, 0xE9, 0xAF,
+    0xFE, 0x00, 0x77, 0x71, 0xAA, 0xDA, 0x92, 0x9C, 0x94, 0xFF, 0xCA, 0x9D, 0x92, 0x9F, 0xFF, 0xC9,
+    0x3F, 0x93, 0xAF, 0x3F, 0x6F, 0x91, 0x9E, 0x95, 0xFC, 0xA1, 0xAE, 0x5D, 0xAA, 0xE1, 0xE9, 0x4D,
+    0xA0, 0x9E, 0x1E, 0x93, 0xDA, 0x2E, 0x1E, 0x3D, 0xA2, 0x9E, 0x1E, 0x91, 0xDA, 0x39, 0xE1, 0xE9,
+    0x0D, 0xA4, 0xAE, 0x1E, 0xAE, 0x5E, 0xA1, 0xAF, 0xC5, 0x9E, 0x3F, 0x59, 0xEA, 0x3F, 0xCA, 0x99,
+    0x9F, 0xC3, 0xAF, 0xFF, 0xC3, 0xAD, 0x09, 0xFF, 0x95, 0xC4, 0x99, 0x99, 0x77, 0x72, 0x7A, 0xCA,
+    0x74, 0xF7, 0x3A, 0xF9, 0x72, 0xFC, 0xA7, 0x19, 0xFD, 0x71, 0xDA, 0xAE, 0x97, 0x9D, 0x90, 0xF7,
+    0xE1, 0xF7, 0xDA, 0x19, 0xEA, 0x5A, 0xD3, 0xF5, 0xE3, 0xF9, 0x39, 0xDA, 0x39, 0xEA, 0x3E, 0x5F,
+    0x29, 0xE5, 0xF9, 0x1A, 0xD9, 0x59, 0xF1, 0xE9, 0x59, 0xF0, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x1F, 0x95, 0xAE,
+    0x1A, 0xEA, 0x5E, 0x92, 0xF5, 0xE3, 0xF9, 0x39, 0xDA, 0x39, 0xEA, 0x3E, 0x5F, 0x3D, 0xA5, 0xAE,
+    0x91, 0xAD, 0x95, 0x9E, 0xA1, 0xE7, 0xF0, 0x9D, 0x97, 0xAE, 0x9A, 0xD7, 0x09, 0xEA, 0xDA, 0x71,
+    0xFD, 0x72, 0xAF, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x59, 0x70, 0x79, 0x99, 0x99, 0x99, 0x99, 0x39,
+    0xAF, 0xFE, 0x2A, 0xFF, 0xFC, 0x1F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAE, 0xA7, 0x3F, 0x73,
+    0x9E, 0x74, 0xAE, 0x74, 0xAF, 0xFF, 0xEA, 0xFF, 0xFF, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x74, 0x9E, 0x97, 0x4F, 0x74, 0x9F, 0x97, 0x39, 0xFF, 0xFC, 0xA2, 0x9F, 0xFF, 0xC4,
+    0x9A, 0xFF, 0xD0, 0x74, 0x99, 0x75, 0xE7, 0x19, 0x99, 0xAE, 0x99, 0x39, 0xAF, 0xFE, 0x2A, 0xFF,
+    0xFC, 0x1F, 0xCA, 0xAA, 0xFA, 0xA9, 0x0A, 0xEA, 0x3E, 0x93, 0xF4, 0xE3, 0x9E, 0x4A, 0xDA, 0x3A,
+    0xE4, 0xE9, 0x3A, 0xFF, 0xFE, 0xAF, 0xFF, 0xFA, 0xAE, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xE2,
+    0x9D, 0xA5, 0x9E, 0x91, 0xAD, 0x96, 0xF1, 0xE7, 0x9F, 0xAD, 0xA7, 0x0A, 0xFF, 0xFC, 0xA2, 0x9F,
+    0xFF, 0xC4, 0xAF, 0xFE, 0x4E, 0x74, 0x9E, 0x77, 0x71, 0x49, 0xAF, 0xFC, 0xA2, 0xAF, 0xFF, 0xC1,
+    0xFF, 0xFE, 0x0A, 0xEA, 0x97, 0x19, 0xEA, 0x73, 0xAE, 0x74, 0xAF, 0xFF, 0xEA, 0xFF, 0xFF, 0xAA,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9E, 0x75, 0xF7, 0x4A, 0xFA, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x1A, 0xFF, 0xFD, 0x29, 0xFF, 0xFC, 0x59, 0x99, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0xFF, 0xEA, 0x4F, 0xFF, 0xCA, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7, 0x4A, 0xEA,
+    0x74, 0xF7, 0x5E, 0x97, 0x4E, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0xA7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0xF7, 0x29, 0xF9, 0x0A, 0xFF, 0xFC, 0x91, 0xFF,
+    0xFC, 0x92, 0xFF, 0xDA, 0x94, 0x19, 0x97, 0x6E, 0x73, 0x99, 0xEA, 0x99, 0x97, 0xFF, 0xEA, 0x4F,
+    0xFF, 0xCA, 0x29, 0xAA, 0xFA, 0xAA, 0xFA, 0x49, 0xE3, 0xAE, 0xA4, 0xE4, 0xF4, 0xAD, 0xA4, 0xE9,
+    0x39, 0xE4, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xEA, 0x5A,
+    0xD9, 0x2E, 0xA5, 0x9D, 0xA1, 0x9E, 0x96, 0xE1, 0xF7, 0xAD, 0xAF, 0x90, 0xAF, 0xFF, 0xCA, 0x1F,
+    0xFF, 0xC9, 0x2F, 0xFE, 0xA7, 0x5E, 0x75, 0xE9, 0x77, 0x40, 0xAF, 0xFC, 0xA9, 0x4F, 0xFF, 0xCA,
+    0x2F, 0xFF, 0xE7, 0x39, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x4E, 0x97, 0x3F, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9A,
+    0xFA, 0x0F, 0xFF, 0xDA, 0x1F, 0xFF, 0xC9, 0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x50, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xFE, 0x1A, 0xFF, 0xFF, 0xC9, 0x3F,
+    0x94, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5,
+    0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xF5, 0x9F,
+    0x5F, 0x59, 0xF5, 0xF5, 0x9F, 0x5F, 0x59, 0xF5, 0xFA, 0x4A, 0xF9, 0x2F, 0xF9, 0x09, 0xFF, 0x1F,
+    0xF9, 0x09, 0xFF, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFC, 0x1A, 0xFF,
+    0xFC, 0x19, 0xF5, 0xAD, 0x91, 0xAE, 0xA5, 0xD9, 0x2F, 0x94, 0xD3, 0x9F, 0x73, 0xAE, 0xA7, 0x3F,
+    0x97, 0x29, 0xF7, 0x3A, 0xE9, 0x73, 0xE9, 0x72, 0xF7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x59,
+    0x3E, 0xA5, 0x9D, 0x1A, 0xE6, 0xE0, 0x9E, 0x6A, 0xE0, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD, 0x90, 0x9F,
+    0xFF, 0xC7, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFD, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x00, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x19,
+    0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xE7,
+    0x2A, 0xD9, 0x72, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x77, 0x10, 0x0E, 0x97, 0x0A, 0xDA, 0x71, 0xE7,
+    0x1A, 0xDA, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0xAE, 0x71, 0xE7, 0x1A, 0xDA,
+    0x71, 0xE7, 0x1E, 0xA7, 0x09, 0xE7, 0x1E, 0x97, 0x09, 0xE7, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x75,
+    0x49, 0x97, 0x09, 0xD7, 0x09, 0xD5, 0xD0, 0x9D, 0x09, 0xCA, 0x0A, 0xEA, 0xDA, 0xE1, 0x9F, 0xEA,
+    0x4F, 0xC9, 0x39, 0xFE, 0xA1, 0xAE, 0xAF, 0xD1, 0xD0, 0x9D, 0x09, 0xCA, 0x19, 0x19, 0xD7, 0x09,
+    0xD7, 0x19, 0x94, 0x29, 0xAA, 0x93, 0x9F, 0xD2, 0xEA, 0xF0, 0xAD, 0x2A, 0xD0, 0xAD, 0x29, 0xD0,
+    0xAD, 0x29, 0xD0, 0x9D, 0xA9, 0x9E, 0x1F, 0xE9, 0x2A, 0xEA, 0x74, 0x0A, 0xD9, 0x09, 0xF0, 0x9F,
+    0x1E, 0x96, 0x77, 0x75, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5D, 0xA7,
+    0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE3, 0xAA, 0xAA, 0xA4, 0xD9, 0x29, 0xFC, 0x39, 0xD3, 0x9F, 0xC3,
+    0xAD, 0x6E, 0x92, 0xDA, 0x6A, 0xDA, 0x19, 0xD7, 0x0E, 0x1A, 0xD7, 0x0E, 0x1D, 0xA7, 0x0A, 0xD9,
+    0x0D, 0x97, 0x09, 0xDA, 0xAD, 0x72, 0xFC, 0xA7, 0x2A, 0xF9, 0x72, 0x9F, 0x74, 0xEA, 0x74, 0xAD,
+    0x96, 0x39, 0x95, 0x91, 0xAF, 0x29, 0xD0, 0x9F, 0xD0, 0xAD, 0xA0, 0xE1, 0xFC, 0x91, 0xD9, 0x2E,
+    0x92, 0xD9, 0x2E, 0x92, 0xE1, 0xFC, 0x91, 0xAF, 0xD0, 0xEA, 0x1F, 0xC2, 0xE2, 0x99, 0x94, 0x9A,
+    0x29, 0x95, 0x99, 0x39, 0xF9, 0x19, 0xF2, 0xFD, 0x99, 0xFD, 0x09, 0xD9, 0x0F, 0xC9, 0x0A, 0xD0,
+    0xAD, 0x2E, 0x92, 0xD0, 0xAD, 0x2E, 0xA2, 0xD0, 0xAD, 0x1A, 0xF9, 0x0A, 0xD0, 0x9F, 0xD0, 0xAF,
+    0xCA, 0x1A, 0xF2, 0xAF, 0x39, 0x99, 0x49, 0x99, 0x20, 0x09, 0x99, 0x75, 0xE7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x77, 0x77, 0xAC, 0x97, 0x69, 0xE9, 0x75,
+    0xF7, 0x5F, 0x75, 0xAE, 0x75, 0xAE, 0x97, 0x49, 0xEA, 0x75, 0xEA, 0x75, 0xF7, 0x5A, 0xE7, 0x5A,
+    0xE9, 0x74, 0x9E, 0xA7, 0x5E, 0xA7, 0x5F, 0x75, 0xAF, 0xFF, 0xEA, 0x0A, 0xFF, 0xFF, 0xA9, 0xFF,
+    0xFF, 0xCA, 0x09, 0x99, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x0A, 0xAA, 0x99, 0x92,
+    0x99, 0x0E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD,
+    0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E,
+    0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A,
+    0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xAD, 0x9A, 0xAA, 0x19,
+    0xAA, 0x00, 0x69, 0x99, 0x76, 0xE9, 0x74, 0x9E, 0xA7, 0x4F, 0xC7, 0x39, 0xFC, 0xA7, 0x2A, 0xDA,
+    0xE7, 0x2E, 0x0E, 0x97, 0x0A, 0xDA, 0x09, 0xE7, 0x0E, 0x91, 0xE7, 0x9E, 0x2A, 0xDA, 0x6E, 0xA2,
+    0x9E, 0x6E, 0x4E, 0x94, 0xAE, 0x4A, 0xE4, 0xE9, 0x5E, 0x39, 0xE6, 0xEA, 0x2E, 0xA6, 0x9E, 0x2E,
+    0x70, 0xE9, 0x0A, 0xE7, 0x0A, 0xE0, 0x09, 0x97, 0x29, 0x99, 0x09, 0xE7, 0x0A, 0xDA, 0x1E, 0x97,
+    0xE9, 0x1A, 0xDA, 0x6A, 0xE2, 0x9E, 0x6E, 0x93, 0xEA, 0x49, 0xE4, 0x9E, 0x4A, 0xDA, 0x5E, 0x93,
+    0xE9, 0x5A, 0xDA, 0x29, 0xE7, 0xE2, 0xE9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0xAD, 0xA7, 0x1E, 0x9E,
+    0x72, 0xAF, 0xD7, 0x3F, 0xC9, 0x73, 0xFC, 0x74, 0x9E, 0xA7, 0x5E, 0x70, 0x39, 0xAE, 0xA9, 0x6F,
+    0xFC, 0x4F, 0xFE, 0x2A, 0xE9, 0x29, 0xEA, 0x1E, 0x94, 0x9E, 0x09, 0xE6, 0xE9, 0x9D, 0xA6, 0xAD,
+    0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA,
+    0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9,
+    0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x09, 0x97, 0x09, 0x90, 0x9D, 0xA6, 0xAD, 0x99, 0xDA,
+    0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9,
+    0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6, 0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x9D, 0xA6,
+    0xAD, 0x99, 0xDA, 0x6A, 0xD9, 0x0E, 0x6E, 0x1E, 0xA4, 0xAE, 0x1A, 0xFA, 0x9A, 0xFA, 0x2A, 0xFF,
+    0xCA, 0x49, 0xFE, 0x97, 0x09, 0x99, 0x50, 0x70, 0x9A, 0xA9, 0x71, 0xFD, 0x7F, 0xEA, 0x5A, 0xE0,
+    0x9D, 0x6F, 0x19, 0x7E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0xA5, 0x9C, 0xA0, 0x9E, 0x95, 0xEA, 0xF6, 0xFE, 0x70, 0xAE, 0x97, 0x6A,
+    0xCA, 0x74, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A,
+    0x97, 0x09, 0xA9, 0x1F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E, 0xA6, 0xAE, 0x29, 0x97, 0x09, 0x91, 0x09,
+    0xCA, 0x97, 0xAC, 0xA0, 0x9F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E, 0x96, 0xAE, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x9A, 0x97, 0x49, 0xEA, 0x73, 0xAE, 0xA7, 0x39, 0xE9, 0x74, 0x99, 0x70, 0x79,
+    0xD9, 0x1E, 0xA0, 0x9E, 0x91, 0xDA, 0x77, 0x77, 0x9A, 0x91, 0x9E, 0x1F, 0x1A, 0xDA, 0x29, 0x30,
+    0x09, 0xCA, 0x97, 0xAC, 0xA0, 0x9F, 0x6F, 0x99, 0xF6, 0xF9, 0x0E, 0x96, 0xAE, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xA9, 0x70, 0x9A, 0x91, 0xF6, 0xF9, 0x9F, 0x6F, 0x90, 0xEA, 0x6A, 0xE2,
+    0x99, 0x70, 0x99, 0x10, 0x39, 0x73, 0xFC, 0xA3, 0xAC, 0x90, 0xFF, 0xAA, 0xE9, 0xAD, 0x91, 0xAF,
+    0xDA, 0x1A, 0x94, 0xAD, 0xA9, 0x77, 0x00, 0x77, 0x09, 0xAD, 0xA4, 0x9A, 0x1A, 0xFD, 0xA9, 0x09,
+    0xD9, 0x9E, 0x9A, 0xFF, 0x09, 0xCA, 0x3A, 0xFA, 0x77, 0x77, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x09, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x77, 0x76, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x39, 0x71, 0xFA, 0x2A, 0xC9, 0x0F, 0xEA, 0x9D, 0xA0,
+    0xDA, 0x9A, 0xFD, 0x90, 0xD3, 0xF9, 0x77, 0xAE, 0x92, 0x9C, 0x90, 0xAF, 0xD9, 0x9D, 0xA0, 0xE9,
+    0xFE, 0x90, 0xD2, 0x9F, 0xA2, 0x94, 0x99, 0x20, 0x09, 0x72, 0x91, 0xEA, 0xAA, 0xAA, 0xAA, 0xE1,
+    0xFF, 0xFC, 0x29, 0xAA, 0xFC, 0xAA, 0x97, 0x77, 0x71, 0x9A, 0xAF, 0xCA, 0xA9, 0x2F, 0xFF, 0xC1,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xE1, 0x97, 0x29, 0x00, 0x77, 0x29, 0xC9, 0x70, 0xD9, 0x1A, 0xFF, 0xD9,
+    0xAF, 0xFD, 0x99, 0xAA, 0xAA, 0xEA, 0xAA, 0x49, 0xD5, 0x99, 0x9D, 0xA9, 0x99, 0x90, 0xAF, 0xFD,
+    0x9A, 0xFF, 0xD9, 0x1D, 0xA7, 0x0D, 0x72, 0x97, 0x76, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x77,
+    0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x77, 0x76,
+    0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x70, 0xA9,
+    0x7A, 0xE5, 0xAF, 0x93, 0xAF, 0x93, 0xAE, 0xA5, 0xAE, 0x96, 0x9F, 0xA7, 0x9F, 0xA7, 0x9F, 0xA7,
+    0xAF, 0x70, 0xAC, 0xA7, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xD9, 0xAF, 0xFD, 0x90,
+    0x74, 0xD7, 0x09, 0xEA, 0x7A, 0xFA, 0x79, 0xFA, 0x79, 0xFA, 0x7A, 0xE9, 0x49, 0xAE, 0xA3, 0x9F,
+    0xA3, 0x9F, 0xA4, 0x9E, 0xA7, 0xCA, 0x77, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xD9,
+    0xAF, 0xFD, 0x90, 0x77, 0x74, 0x9C, 0xA6, 0xAC, 0x69, 0xF4, 0xAE, 0x49, 0xFA, 0x29, 0xAF, 0x92,
+    0x9F, 0xA2, 0x9F, 0xA9, 0x29, 0xFA, 0x3F, 0xA5, 0xAE, 0x93, 0x9E, 0xA7, 0xAF, 0x92, 0xAF, 0x96,
+    0x9F, 0xC9, 0x2A, 0xF9, 0x69, 0xFC, 0x92, 0xAF, 0x96, 0x9F, 0x4F, 0x97, 0x9C, 0xA5, 0x9D, 0x77,
+    0x50, 0x77, 0x5C, 0xA6, 0xAC, 0x97, 0x0E, 0xA4, 0xF9, 0x69, 0xFA, 0x29, 0xAF, 0x96, 0x9A, 0xF9,
+    0x2A, 0xF9, 0x7A, 0xF3, 0xAF, 0x96, 0xAE, 0x93, 0x9E, 0xA4, 0x9F, 0xA2, 0x9F, 0xA3, 0x9F, 0xA2,
+    0x9F, 0xC3, 0x9F, 0xA2, 0x9F, 0xC9, 0x39, 0xEA, 0x4F, 0x96, 0xD9, 0x5A, 0xC9, 0x77, 0x74, 0xAF,
+    0xFC, 0xA9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE7, 0x39, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0xA7, 0x4E,
+    0xA7, 0x4A, 0xE7, 0x4E, 0xA7, 0x4E, 0x97, 0x3F, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xFA, 0x0F,
+    0xFF, 0xDA, 0x1F, 0xFF, 0xC9, 0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x50, 0x74, 0x99, 0x75, 0xE7,
+    0x49, 0xDA, 0x74, 0xAD, 0x96, 0x9A, 0xAF, 0xFA, 0x2A, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0xAE, 0xA9,
+    0x2E, 0x4E, 0xA3, 0xAD, 0xA3, 0xAE, 0x4E, 0x4A, 0xE4, 0xE4, 0xEA, 0x3A, 0xD9, 0x4A, 0xE3, 0xE5,
+    0xAE, 0x29, 0xDA, 0x6F, 0x1A, 0xD9, 0x6A, 0xFA, 0xE9, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFD, 0x29,
+    0xFF, 0xFC, 0x49, 0xEA, 0xAA, 0xAA, 0xAA, 0x94, 0xAD, 0xA7, 0x4E, 0x75, 0xE7, 0x77, 0x10, 0x71,
+    0x99, 0x75, 0xE7, 0x49, 0xE7, 0x4A, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE7,
+    0x0E, 0x9F, 0xA6, 0x9D, 0xA1, 0xAE, 0x6E, 0x92, 0xEA, 0x5E, 0x3E, 0xA4, 0xAD, 0xA3, 0xAE, 0x4E,
+    0x4E, 0xA3, 0x9E, 0x4E, 0x93, 0xAD, 0x93, 0xF0, 0x99, 0x99, 0xE9, 0x99, 0xAF, 0xA0, 0xFF, 0xFD,
+    0xA1, 0xFF, 0xFC, 0x92, 0x9A, 0xAE, 0xAA, 0xA9, 0x97, 0x9D, 0xA7, 0x4E, 0x75, 0xE7, 0x77, 0x40,
+    0x69, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xE9, 0x19, 0xFF, 0xFC, 0x90, 0x9F, 0xCA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0x97, 0x3E, 0x97, 0x39, 0xE7, 0x49, 0xE7, 0x49, 0xE9, 0x74, 0xF7, 0x49, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0xC9, 0x29, 0xFF, 0xF9, 0x59, 0x99, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x72, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x69, 0xFF, 0xEA, 0x39, 0xFF, 0xFC, 0x92, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x73, 0x9F,
+    0x74, 0x9E, 0x75, 0xE9, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x3F, 0x19, 0x99, 0x99, 0x99, 0x99, 0xAF,
+    0x90, 0x9F, 0xFF, 0xCA, 0x19, 0xFF, 0xF9, 0x3A, 0xAA, 0xAA, 0xAA, 0x99, 0x97, 0x76, 0x9F, 0xFF,
+    0xDA, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xDA, 0x00, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E,
+    0x9A, 0xCA, 0x9E, 0x94, 0x9D, 0x91, 0xAC, 0xA1, 0x9D, 0x93, 0xD3, 0xAC, 0xA2, 0x9D, 0x2A, 0xCA,
+    0x3A, 0xCA, 0x3A, 0xCA, 0x1D, 0x4A, 0xCA, 0x4D, 0x09, 0xCA, 0x4A, 0xCA, 0x4D, 0x99, 0xDA, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xAA, 0xD9, 0xAF, 0xFF, 0xFC, 0xA9, 0xD9, 0x99, 0x99, 0xAC, 0xA9, 0x99, 0x99,
+    0xD9, 0x9D, 0x4A, 0xCA, 0x4D, 0x90, 0xD4, 0xAC, 0xA4, 0xD1, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA2,
+    0xD9, 0x2A, 0xCA, 0x29, 0xD3, 0x9D, 0xA1, 0xAC, 0xA1, 0xAD, 0x94, 0x9E, 0xAA, 0xCA, 0xAE, 0x97,
+    0xAF, 0xEA, 0x74, 0x99, 0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E, 0x99, 0x09, 0x9E, 0x94,
+    0x9D, 0x96, 0x9D, 0x93, 0xD9, 0x70, 0x9D, 0x2A, 0xCA, 0x72, 0xAC, 0xA1, 0xD7, 0x4D, 0x09, 0xD7,
+    0x4D, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xD9, 0xAF, 0xFF, 0xFC, 0xA9, 0xD9, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xD9, 0x9D, 0x74, 0xD9, 0x0D, 0x74, 0xD1, 0xAC, 0xA7, 0x2A, 0xCA,
+    0x2D, 0x97, 0x09, 0xD3, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0x97, 0xAF, 0xEA, 0x74,
+    0x99, 0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E, 0x99, 0x09, 0x9E, 0x94, 0x9D, 0x96, 0x9D,
+    0x93, 0xF6, 0xF2, 0xAC, 0xAE, 0x4D, 0xAA, 0xCA, 0x1D, 0x1E, 0x2D, 0xA1, 0xD0, 0x9C, 0xA2, 0xE0,
+    0xDA, 0x2D, 0x99, 0xCA, 0x3F, 0xA3, 0xAC, 0x9A, 0xCA, 0x4E, 0x4A, 0xCA, 0x9C, 0xA3, 0xFC, 0x3A,
+    0xC9, 0x9D, 0x2D, 0xA0, 0xE2, 0xD9, 0x0D, 0x1D, 0xA2, 0xE1, 0xD1, 0xAC, 0xAD, 0xA4, 0xEA, 0xCA,
+    0x2E, 0xA6, 0xF3, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0x97, 0xAF, 0xEA, 0x74, 0x99,
+    0x97, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9E, 0x99, 0x09, 0x9E, 0x94, 0x9D, 0x96, 0x9D, 0x93,
+    0xD9, 0x7F, 0x2A, 0xCA, 0x7D, 0xAA, 0xCA, 0x1D, 0x7D, 0xA1, 0xD0, 0x9D, 0x6D, 0xA2, 0xD9, 0x9C,
+    0xA5, 0xDA, 0x3A, 0xC9, 0xAC, 0xA4, 0xDA, 0x4A, 0xCA, 0x9C, 0xA3, 0xDA, 0x5A, 0xC9, 0x9D, 0x2D,
+    0xA6, 0xD9, 0x0D, 0x1D, 0xA7, 0xD1, 0xAC, 0xAD, 0xA7, 0xAC, 0xA2, 0xEA, 0x79, 0xD3, 0x9D, 0xA6,
+    0xAD, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x59, 0x99, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x5A, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0xA0, 0x0A, 0xD9, 0x09,
+    0xF0, 0x9F, 0x1E, 0x96, 0x09, 0xDA, 0x4A, 0xD4, 0xAD, 0x91, 0xF9, 0x2A, 0xEA, 0x29, 0xF1, 0xF9,
+    0x2A, 0xEA, 0x29, 0xF1, 0xAD, 0xA3, 0x9E, 0x4E, 0x97, 0x77, 0x73, 0x97, 0x76, 0x9C, 0xA7, 0x74,
+    0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x09, 0xC9, 0x19, 0xDA, 0x76, 0x9C, 0x94, 0x9C, 0xA7, 0x49,
+    0xD9, 0x19, 0x2A, 0xCA, 0x72, 0x9F, 0xFA, 0x1D, 0xA7, 0x09, 0xFF, 0xD9, 0x0A, 0xDA, 0x69, 0xFF,
+    0xEA, 0x09, 0xEA, 0x49, 0xFF, 0xFA, 0x09, 0xFA, 0x29, 0xFF, 0xEA, 0x2A, 0xFC, 0xA1, 0xAF, 0xFA,
+    0x5F, 0xDA, 0x2A, 0xFE, 0x4A, 0xFD, 0xA4, 0xAF, 0xD9, 0x1A, 0xFE, 0xA6, 0xAF, 0xCA, 0x0A, 0xFE,
+    0xA7, 0x0A, 0xFC, 0x0A, 0xFD, 0xA7, 0x2A, 0xFF, 0xEA, 0x74, 0xAE, 0x90, 0xAE, 0xA7, 0x6A, 0xD2,
+    0xDA, 0x77, 0x0A, 0xC9, 0x0A, 0xCA, 0x77, 0x2A, 0xEA, 0x77, 0x4A, 0xCA, 0x77, 0x69, 0x73,
 };
 
 static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 8, 20, 10, 1, 19, 40, 0 }, // !
-    { 10, 9, 12, 1, 18, 23, 40 }, // "
-    { 16, 17, 17, 0, 15, 68, 63 }, // #
-    { 14, 25, 16, 1, 20, 88, 131 }, // $
-    { 23, 21, 25, 1, 19, 121, 219 }, // %
-    { 21, 21, 23, 1, 19, 111, 340 }, // &
-    { 5, 9, 7, 1, 18, 12, 451 }, // '
-    { 12, 25, 13, 0, 20, 75, 463 }, // (
-    { 11, 25, 11, -1, 20, 69, 538 }, // )
-    { 10, 10, 12, 1, 19, 25, 607 }, // *
-    { 12, 12, 16, 2, 14, 36, 632 }, // +
-    { 7, 9, 8, -1, 4, 16, 668 }, // ,
-    { 8, 3, 10, 1, 8, 6, 684 }, // -
-    { 5, 5, 8, 1, 4, 7, 690 }, // .
-    { 15, 20, 15, -1, 18, 75, 697 }, // /
-    { 16, 19, 17, 0, 18, 76, 772 }, // 0
-    { 12, 18, 16, 1, 18, 54, 848 }, // 1
-    { 15, 18, 16, 0, 18, 68, 902 }, // 2
-    { 15, 19, 16, 0, 18, 72, 970 }, // 3
-    { 15, 18, 16, 0, 18, 68, 1042 }, // 4
-    { 16, 19, 17, 0, 18, 76, 1110 }, // 5
-    { 15, 19, 17, 1, 18, 72, 1186 }, // 6
-    { 15, 19, 18, 2, 18, 72, 1258 }, // 7
-    { 15, 19, 16, 0, 18, 72, 1330 }, // 8
-    { 16, 19, 16, -1, 18, 76, 1402 }, // 9
-    { 7, 14, 9, 1, 13, 25, 1478 }, // :
-    { 9, 18, 9, -1, 13, 41, 1503 }, // ;
-    { 12, 13, 16, 2, 15, 39, 1544 }, // <
-    { 12, 8, 16, 2, 12, 24, 1583 }, // =
-    { 12, 13, 16, 2, 15, 39, 1607 }, // >
-    { 8, 20, 11, 2, 19, 40, 1646 }, // ?
-    { 23, 23, 25, 1, 18, 133, 1686 }, // @
-    { 20, 18, 19, -2, 18, 90, 1819 }, // A
-    { 16, 19, 16, -1, 18, 76, 1909 }, // B
-    { 17, 19, 18, 0, 18, 81, 1985 }, // C
-    { 19, 19, 19, -1, 18, 91, 2066 }, // D
-    { 17, 18, 17, -1, 18, 77, 2157 }, // E
-    { 16, 18, 16, -1, 18, 72, 2234 }, // F
-    { 18, 19, 19, 0, 18, 86, 2306 }, // G
-    { 22, 18, 22, -1, 18, 99, 2392 }, // H
-    { 12, 18, 12, -1, 18, 54, 2491 }, // I
-    { 16, 23, 12, -5, 18, 92, 2545 }, // J
-    { 20, 19, 20, -1, 18, 95, 2637 }, // K
-    { 15, 18, 15, -1, 18, 68, 2732 }, // L
-    { 25, 18, 24, -2, 18, 113, 2800 }, // M
-    { 22, 19, 22, -1, 18, 105, 2913 }, // N
-    { 18, 19, 19, 0, 18, 86, 3018 }, // O
-    { 17, 18, 17, -1, 18, 77, 3104 }, // P
-    { 22, 24, 23, 0, 18, 132, 3181 }, // Q
-    { 18, 19, 18, -1, 18, 86, 3313 }, // R
-    { 15, 19, 15, -1, 18, 72, 3399 }, // S
-    { 17, 18, 19, 1, 18, 77, 3471 }, // T
-    { 19, 19, 22, 2, 18, 91, 3548 }, // U
-    { 19, 19, 21, 1, 18, 91, 3639 }, // V
-    { 26, 19, 28, 1, 18, 124, 3730 }, // W
-    { 21, 18, 20, -2, 18, 95, 3854 }, // X
-    { 18, 18, 20, 1, 18, 81, 3949 }, // Y
-    { 17, 19, 17, -1, 18, 81, 4030 }, // Z
-    { 12, 24, 11, -2, 20, 72, 4111 }, // [
-    { 11, 20, 13, 1, 18, 55, 4183 }, // <backslash>
-    { 12, 24, 11, -2, 20, 72, 4238 }, // ]
-    { 13, 12, 16, 1, 16, 39, 4310 }, // ^
-    { 13, 3, 14, 0, -1, 10, 4349 }, // _
-    { 6, 7, 16, 5, 21, 11, 4359 }, // `
-    { 15, 15, 16, 0, 14, 57, 4370 }, // a
-    { 14, 21, 15, 0, 20, 74, 4427 }, // b
-    { 12, 15, 13, 0, 14, 45, 4501 }, // c
-    { 15, 21, 16, 0, 20, 79, 4546 }, // d
-    { 12, 15, 13, 0, 14, 45, 4625 }, // e
-    { 19, 26, 15, -5, 20, 124, 4670 }, // f
-    { 17, 20, 16, -2, 14, 85, 4794 }, // g
-    { 15, 21, 16, 0, 20, 79, 4879 }, // h
-    { 9, 21, 10, 0, 20, 48, 4958 }, // i
-    { 14, 26, 10, -5, 20, 91, 5006 }, // j
-    { 13, 21, 14, 0, 20, 69, 5097 }, // k
-    { 8, 21, 9, 0, 20, 42, 5166 }, // l
-    { 22, 15, 23, 0, 14, 83, 5208 }, // m
-    { 15, 15, 16, 0, 14, 57, 5291 }, // n
-    { 13, 15, 14, 0, 14, 49, 5348 }, // o
-    { 16, 20, 15, -2, 14, 80, 5397 }, // p
-    { 14, 20, 15, 0, 14, 70, 5477 }, // q
-    { 13, 14, 14, 0, 14, 46, 5547 }, // r
-    { 12, 15, 12, -1, 14, 45, 5593 }, // s
-    { 11, 18, 12, 0, 17, 50, 5638 }, // t
-    { 15, 15, 16, 0, 14, 57, 5688 }, // u
-    { 13, 15, 14, 0, 14, 49, 5745 }, // v
-    { 19, 15, 20, 0, 14, 72, 5794 }, // w
-    { 16, 15, 16, -1, 14, 60, 5866 }, // x
-    { 17, 20, 14, -4, 14, 85, 5926 }, // y
-    { 14, 15, 14, -1, 14, 53, 6011 }, // z
-    { 11, 25, 13, 1, 20, 69, 6064 }, // {
-    { 9, 23, 9, -1, 20, 52, 6133 }, // |
-    { 11, 25, 11, -1, 20, 69, 6185 }, // }
-    { 13, 5, 16, 1, 11, 17, 6254 }, // ~
-    { 0, 0, 5, 0, 0, 0, 6271 }, //  
-    { 9, 20, 9, -1, 14, 45, 6271 }, // ¡
-    { 14, 25, 16, 1, 20, 88, 6316 }, // ¢
-    { 17, 19, 17, -1, 18, 81, 6404 }, // £
-    { 16, 13, 17, 0, 15, 52, 6485 }, // ¤
-    { 17, 18, 19, 1, 18, 77, 6537 }, // ¥
-    { 9, 23, 9, -1, 20, 52, 6614 }, // ¦
-    { 13, 21, 13, -1, 18, 69, 6666 }, // §
-    { 9, 5, 16, 3, 20, 12, 6735 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6747 }, // ©
-    { 10, 13, 12, 1, 18, 33, 6838 }, // ª
-    { 15, 11, 16, 0, 12, 42, 6871 }, // «
-    { 12, 7, 16, 2, 12, 21, 6913 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 6934 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6940 }, // ®
-    { 9, 3, 16, 3, 18, 7, 6989 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 6996 }, // °
-    { 12, 16, 16, 2, 15, 48, 7021 }, // ±
-    { 11, 12, 12, 0, 21, 33, 7069 }, // ²
-    { 9, 13, 11, 1, 21, 30, 7102 }, // ³
-    { 6, 7, 16, 5, 22, 11, 7132 }, // ´
-    { 17, 20, 17, -1, 14, 85, 7143 }, // µ
-    { 17, 22, 17, -1, 18, 94, 7228 }, // ¶
-    { 5, 5, 8, 1, 10, 7, 7322 }, // ·
-    { 6, 6, 16, 5, -1, 9, 7329 }, // ¸
-    { 8, 12, 11, 1, 21, 24, 7338 }, // ¹
-    { 10, 13, 12, 1, 18, 33, 7362 }, // º
-    { 15, 11, 16, 0, 12, 42, 7395 }, // »
-    { 26, 21, 28, 1, 19, 137, 7437 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 7574 }, // ½
-    { 26, 21, 28, 1, 19, 137, 7706 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 7843 }, // ¿
-    { 20, 25, 19, -2, 25, 125, 7888 }, // À
-    { 20, 25, 19, -2, 25, 125, 8013 }, // Á
-    { 20, 25, 19, -2, 25, 125, 8138 }, // Â
-    { 20, 24, 19, -2, 24, 120, 8263 }, // Ã
-    { 20, 24, 19, -2, 24, 120, 8383 }, // Ä
-    { 20, 25, 19, -2, 25, 125, 8503 }, // Å
-    { 26, 18, 25, -2, 18, 117, 8628 }, // Æ
-    { 17, 25, 18, 0, 18, 107, 8745 }, // Ç
-    { 17, 25, 17, -1, 25, 107, 8852 }, // È
-    { 17, 25, 17, -1, 25, 107, 8959 }, // É
-    { 17, 25, 17, -1, 25, 107, 9066 }, // Ê
-    { 17, 24, 17, -1, 24, 102, 9173 }, // Ë
-    { 12, 25, 12, -1, 25, 75, 9275 }, // Ì
-    { 13, 25, 13, -1, 25, 82, 9350 }, // Í
-    { 13, 25, 13, -1, 25, 82, 9432 }, // Î
-    { 13, 24, 13, -1, 24, 78, 9514 }, // Ï
-    { 19, 19, 19, -1, 18, 91, 9592 }, // Ð
-    { 22, 25, 22, -1, 24, 138, 9683 }, // Ñ
-    { 18, 26, 19, 0, 25, 117, 9821 }, // Ò
-    { 18, 26, 19, 0, 25, 117, 9938 }, // Ó
-    { 18, 26, 19, 0, 25, 117, 10055 }, // Ô
-    { 18, 25, 19, 0, 24, 113, 10172 }, // Õ
-    { 18, 25, 19, 0, 24, 113, 10285 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 10398 }, // ×
-    { 21, 20, 21, -1, 19, 105, 10429 }, // Ø
-    { 19, 26, 22, 2, 25, 124, 10534 }, // Ù
-    { 19, 26, 22, 2, 25, 124, 10658 }, // Ú
-    { 19, 26, 22, 2, 25, 124, 10782 }, // Û
-    { 19, 25, 22, 2, 24, 119, 10906 }, // Ü
-    { 18, 25, 20, 1, 25, 113, 11025 }, // Ý
-    { 16, 18, 16, -1, 18, 72, 11138 }, // Þ
-    { 21, 26, 17, -5, 20, 137, 11210 }, // ß
-    { 15, 22, 16, 0, 21, 83, 11347 }, // à
-    { 15, 23, 16, 0, 22, 87, 11430 }, // á
-    { 15, 22, 16, 0, 21, 83, 11517 }, // â
-    { 15, 21, 16, 0, 20, 79, 11600 }, // ã
-    { 15, 21, 16, 0, 20, 79, 11679 }, // ä
-    { 15, 22, 16, 0, 21, 83, 11758 }, // å
-    { 20, 15, 21, 0, 14, 75, 11841 }, // æ
-    { 12, 21, 13, 0, 14, 63, 11916 }, // ç
-    { 12, 22, 13, 0, 21, 66, 11979 }, // è
-    { 13, 23, 14, 0, 22, 75, 12045 }, // é
-    { 12, 22, 13, 0, 21, 66, 12120 }, // ê
-    { 13, 21, 14, 0, 20, 69, 12186 }, // ë
-    { 8, 22, 9, 0, 21, 44, 12255 }, // ì
-    { 11, 23, 12, 0, 22, 64, 12299 }, // í
-    { 10, 22, 11, 0, 21, 55, 12363 }, // î
-    { 11, 21, 12, 0, 20, 58, 12418 }, // ï
-    { 14, 22, 15, 0, 21, 77, 12476 }, // ð
-    { 15, 21, 16, 0, 20, 79, 12553 }, // ñ
-    { 13, 22, 14, 0, 21, 72, 12632 }, // ò
-    { 14, 23, 15, 0, 22, 81, 12704 }, // ó
-    { 13, 22, 14, 0, 21, 72, 12785 }, // ô
-    { 14, 21, 15, 0, 20, 74, 12857 }, // õ
-    { 14, 21, 15, 0, 20, 74, 12931 }, // ö
-    { 12, 13, 16, 2, 15, 39, 13005 }, // ÷
-    { 17, 15, 16, -2, 14, 64, 13044 }, // ø
-    { 15, 22, 16, 0, 21, 83, 13108 }, // ù
-    { 15, 23, 16, 0, 22, 87, 13191 }, // ú
-    { 15, 22, 16, 0, 21, 83, 13278 }, // û
-    { 15, 21, 16, 0, 20, 79, 13361 }, // ü
-    { 17, 28, 14, -4, 22, 119, 13440 }, // ý
-    { 17, 26, 15, -3, 20, 111, 13559 }, // þ
-    { 17, 26, 14, -4, 20, 111, 13670 }, // ÿ
-    { 20, 23, 19, -2, 23, 115, 13781 }, // Ā
-    { 15, 19, 16, 0, 18, 72, 13896 }, // ā
-    { 20, 24, 19, -2, 24, 120, 13968 }, // Ă
-    { 15, 21, 16, 0, 20, 79, 14088 }, // ă
-    { 20, 24, 19, -2, 18, 120, 14167 }, // Ą
-    { 15, 20, 16, 0, 14, 75, 14287 }, // ą
-    { 17, 26, 18, 0, 25, 111, 14362 }, // Ć
-    { 13, 23, 14, 0, 22, 75, 14473 }, // ć
-    { 17, 26, 18, 0, 25, 111, 14548 }, // Ĉ
-    { 12, 22, 13, 0, 21, 66, 14659 }, // ĉ
-    { 17, 25, 18, 0, 24, 107, 14725 }, // Ċ
-    { 12, 21, 13, 0, 20, 63, 14832 }, // ċ
-    { 17, 26, 18, 0, 25, 111, 14895 }, // Č
-    { 13, 22, 14, 0, 21, 72, 15006 }, // č
-    { 19, 26, 19, -1, 25, 124, 15078 }, // Ď
-    { 19, 21, 20, 0, 20, 100, 15202 }, // ď
-    { 19, 19, 19, -1, 18, 91, 15302 }, // Đ
-    { 17, 21, 18, 0, 20, 90, 15393 }, // đ
-    { 17, 23, 17, -1, 23, 98, 15483 }, // Ē
-    { 13, 19, 14, 0, 18, 62, 15581 }, // ē
-    { 17, 24, 17, -1, 24, 102, 15643 }, // Ĕ
-    { 13, 21, 14, 0, 20, 69, 15745 }, // ĕ
-    { 17, 24, 17, -1, 24, 102, 15814 }, // Ė
-    { 12, 21, 13, 0, 20, 63, 15916 }, // ė
-    { 17, 24, 17, -1, 18, 102, 15979 }, // Ę
-    { 12, 20, 13, 0, 14, 60, 16081 }, // ę
-    { 17, 25, 17, -1, 25, 107, 16141 }, // Ě
-    { 13, 22, 14, 0, 21, 72, 16248 }, // ě
-    { 18, 26, 19, 0, 25, 117, 16320 }, // Ĝ
-    { 17, 27, 16, -2, 21, 115, 16437 }, // ĝ
-    { 18, 25, 19, 0, 24, 113, 16552 }, // Ğ
-    { 17, 26, 16, -2, 20, 111, 16665 }, // ğ
-    { 18, 25, 19, 0, 24, 113, 16776 }, // Ġ
-    { 17, 26, 16, -2, 20, 111, 16889 }, // ġ
-    { 18, 25, 19, 0, 18, 113, 17000 }, // Ģ
-    { 17, 28, 16, -2, 22, 119, 17113 }, // ģ
-    { 22, 25, 22, -1, 25, 138, 17232 }, // Ĥ
-    { 15, 27, 16, 0, 26, 102, 17370 }, // ĥ
-    { 22, 18, 22, -1, 18, 99, 17472 }, // Ħ
-    { 15, 21, 16, 0, 20, 79, 17571 }, // ħ
-    { 13, 24, 13, -1, 24, 78, 17650 }, // Ĩ
-    { 11, 21, 12, 0, 20, 58, 17728 }, // ĩ
-    { 13, 23, 13, -1, 23, 75, 17786 }, // Ī
-    { 11, 19, 12, 0, 18, 53, 17861 }, // ī
-    { 13, 24, 13, -1, 24, 78, 17914 }, // Ĭ
-    { 11, 21, 12, 0, 20, 58, 17992 }, // ĭ
-    { 12, 24, 12, -1, 18, 72, 18050 }, // Į
-    { 9, 26, 10, 0, 20, 59, 18122 }, // į
-    { 12, 24, 12, -1, 24, 72, 18181 }, // İ
-    { 8, 15, 9, 0, 14, 30, 18253 }, // ı
-    { 22, 23, 22, -1, 18, 127, 18283 }, // Ĳ
-    { 17, 26, 18, 0, 20, 111, 18410 }, // ĳ
-    { 17, 30, 13, -5, 25, 128, 18521 }, // Ĵ
-    { 16, 27, 12, -5, 21, 108, 18649 }, // ĵ
-    { 20, 25, 20, -1, 18, 125, 18757 }, // Ķ
-    { 13, 27, 14, 0, 20, 88, 18882 }, // ķ
-    { 14, 15, 15, 0, 14, 53, 18970 }, // ĸ
-    { 15, 25, 15, -1, 25, 94, 19023 }, // Ĺ
-    { 10, 27, 11, 0, 26, 68, 19117 }, // ĺ
-    { 15, 25, 15, -1, 18, 94, 19185 }, // Ļ
-    { 9, 27, 9, -1, 20, 61, 19279 }, // ļ
-    { 16, 20, 16, -1, 20, 80, 19340 }, // Ľ
-    { 12, 21, 13, 0, 20, 63, 19420 }, // ľ
-    { 16, 18, 16, -1, 18, 72, 19483 }, // Ŀ
-    { 12, 21, 13, 0, 20, 63, 19555 }, // ŀ
-    { 15, 18, 15, -1, 18, 68, 19618 }, // Ł
-    { 10, 21, 10, -1, 20, 53, 19686 }, // ł
-    { 22, 26, 22, -1, 25, 143, 19739 }, // Ń
-    { 15, 23, 16, 0, 22, 87, 19882 }, // ń
-    { 22, 25, 22, -1, 18, 138, 19969 }, // Ņ
-    { 15, 21, 16, 0, 14, 79, 20107 }, // ņ
-    { 22, 26, 22, -1, 25, 143, 20186 }, // Ň
-    { 15, 22, 16, 0, 21, 83, 20329 }, // ň
-    { 20, 20, 22, 1, 19, 100, 20412 }, // ŉ
-    { 22, 23, 22, -1, 18, 127, 20512 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 20639 }, // ŋ
-    { 18, 24, 19, 0, 23, 108, 20709 }, // Ō
-    { 14, 19, 15, 0, 18, 67, 20817 }, // ō
-    { 18, 25, 19, 0, 24, 113, 20884 }, // Ŏ
-    { 14, 21, 15, 0, 20, 74, 20997 }, // ŏ
-    { 19, 26, 20, 0, 25, 124, 21071 }, // Ő
-    { 15, 22, 16, 0, 21, 83, 21195 }, // ő
-    { 25, 19, 26, 0, 18, 119, 21278 }, // Œ
-    { 20, 15, 21, 0, 14, 75, 21397 }, // œ
-    { 18, 26, 18, -1, 25, 117, 21472 }, // Ŕ
-    { 13, 22, 14, 0, 22, 72, 21589 }, // ŕ
-    { 18, 25, 18, -1, 18, 113, 21661 }, // Ŗ
-    { 14, 21, 14, -1, 14, 74, 21774 }, // ŗ
-    { 18, 26, 18, -1, 25, 117, 21848 }, // Ř
-    { 13, 21, 14, 0, 21, 69, 21965 }, // ř
-    { 15, 26, 15, -1, 25, 98, 22034 }, // Ś
-    { 13, 23, 13, -1, 22, 75, 22132 }, // ś
-    { 15, 26, 15, -1, 25, 98, 22207 }, // Ŝ
-    { 13, 22, 13, -1, 21, 72, 22305 }, // ŝ
-    { 15, 25, 15, -1, 18, 94, 22377 }, // Ş
-    { 12, 21, 12, -1, 14, 63, 22471 }, // ş
-    { 16, 26, 16, -1, 25, 104, 22534 }, // Š
-    { 14, 22, 14, -1, 21, 77, 22638 }, // š
-    { 17, 25, 19, 1, 18, 107, 22715 }, // Ţ
-    { 11, 24, 12, 0, 17, 66, 22822 }, // ţ
-    { 17, 25, 19, 1, 25, 107, 22888 }, // Ť
-    { 13, 21, 14, 0, 20, 69, 22995 }, // ť
-    { 17, 18, 19, 1, 18, 77, 23064 }, // Ŧ
-    { 11, 18, 12, 0, 17, 50, 23141 }, // ŧ
-    { 19, 25, 22, 2, 24, 119, 23191 }, // Ũ
-    { 15, 21, 16, 0, 20, 79, 23310 }, // ũ
-    { 19, 24, 22, 2, 23, 114, 23389 }, // Ū
-    { 15, 19, 16, 0, 18, 72, 23503 }, // ū
-    { 19, 25, 22, 2, 24, 119, 23575 }, // Ŭ
-    { 15, 21, 16, 0, 20, 79, 23694 }, // ŭ
-    { 19, 26, 22, 2, 25, 124, 23773 }, // Ů
-    { 15, 22, 16, 0, 21, 83, 23897 }, // ů
-    { 19, 26, 22, 2, 25, 124, 23980 }, // Ű
-    { 15, 22, 16, 0, 21, 83, 24104 }, // ű
-    { 19, 24, 22, 2, 18, 114, 24187 }, // Ų
-    { 15, 20, 16, 0, 14, 75, 24301 }, // ų
-    { 26, 26, 28, 1, 25, 169, 24376 }, // Ŵ
-    { 19, 22, 20, 0, 21, 105, 24545 }, // ŵ
-    { 18, 25, 20, 1, 25, 113, 24650 }, // Ŷ
-    { 17, 27, 14, -4, 21, 115, 24763 }, // ŷ
-    { 18, 24, 20, 1, 24, 108, 24878 }, // Ÿ
-    { 17, 26, 17, -1, 25, 111, 24986 }, // Ź
-    { 14, 23, 14, -1, 22, 81, 25097 }, // ź
-    { 17, 25, 17, -1, 24, 107, 25178 }, // Ż
-    { 14, 21, 14, -1, 20, 74, 25285 }, // ż
-    { 17, 26, 17, -1, 25, 111, 25359 }, // Ž
-    { 14, 22, 14, -1, 21, 77, 25470 }, // ž
-    { 19, 26, 15, -5, 20, 124, 25547 }, // ſ
-    { 21, 22, 22, 0, 21, 116, 25671 }, // Ơ
-    { 16, 17, 17, 0, 16, 68, 25787 }, // ơ
-    { 17, 18, 18, 0, 18, 77, 25855 }, // Ƥ
-    { 16, 26, 15, -2, 20, 104, 25932 }, // ƥ
-    { 11, 23, 12, 0, 17, 64, 26036 }, // ƫ
-    { 17, 18, 19, 1, 18, 77, 26100 }, // Ƭ
-    { 13, 21, 14, 0, 20, 69, 26177 }, // ƭ
-    { 17, 23, 19, 1, 18, 98, 26246 }, // Ʈ
-    { 22, 22, 25, 2, 21, 121, 26344 }, // Ư
-    { 18, 17, 19, 0, 16, 77, 26465 }, // ư
-    { 6, 7, 3, -4, 21, 11, 26542 }, // ̀
-    { 6, 7, 5, -2, 22, 11, 26553 }, // ́
-    { 9, 7, 5, -5, 21, 16, 26564 }, // ̂
-    { 10, 5, 6, -5, 20, 13, 26580 }, // ̃
-    { 9, 3, 5, -5, 18, 7, 26593 }, // ̄
-    { 8, 5, 5, -4, 20, 10, 26600 }, // ̆
-    { 4, 5, 3, -2, 20, 5, 26610 }, // ̇
-    { 10, 5, 6, -5, 20, 13, 26615 }, // ̈
-    { 7, 8, 5, -3, 22, 14, 26628 }, // ̉
-    { 8, 7, 5, -4, 21, 14, 26642 }, // ̊
-    { 11, 7, 7, -5, 21, 20, 26656 }, // ̋
-    { 9, 6, 6, -4, 21, 14, 26676 }, // ̌
-    { 8, 7, 4, -5, 21, 14, 26690 }, // ̏
-    { 9, 5, 5, -5, 20, 12, 26704 }, // ̑
-    { 6, 8, 4, -3, 22, 12, 26716 }, // ̒
-    { 6, 7, 4, -3, 22, 11, 26728 }, // ̓
-    { 5, 7, 3, -3, 22, 9, 26739 }, // ̔
-    { 4, 7, 3, -2, 22, 7, 26748 }, // ̕
-    { 6, 6, 4, -3, 16, 9, 26755 }, // ̛
-    { 4, 5, 3, -2, -1, 5, 26764 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 26769 }, // ̤
-    { 6, 6, 4, -3, -1, 9, 26779 }, // ̥
-    { 5, 6, 3, -3, -1, 8, 26788 }, // ̦
-    { 6, 6, 4, -3, -1, 9, 26796 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 26805 }, // ̨
-    { 5, 7, 7, -1, -1, 9, 26816 }, // ̩
-    { 9, 6, 5, -5, -1, 14, 26825 }, // ̭
-    { 8, 6, 5, -4, -1, 12, 26839 }, // ̮
-    { 10, 5, 6, -5, -2, 13, 26851 }, // ̰
-    { 9, 3, 5, -5, -2, 7, 26864 }, // ̱
-    { 8, 5, 5, -4, 20, 10, 26871 }, // ͂
-    { 10, 11, 6, -5, 26, 28, 26881 }, // ̈́
-    { 5, 6, 4, -2, -1, 8, 26909 }, // ͅ
-    { 20, 18, 19, -2, 18, 90, 26917 }, // Α
-    { 16, 19, 16, -1, 18, 76, 27007 }, // Β
-    { 17, 18, 17, -1, 18, 77, 27083 }, // Γ
-    { 17, 18, 18, -1, 18, 77, 27160 }, // Δ
-    { 17, 18, 17, -1, 18, 77, 27237 }, // Ε
-    { 17, 19, 17, -1, 18, 81, 27314 }, // Ζ
-    { 22, 18, 22, -1, 18, 99, 27395 }, // Η
-    { 18, 19, 19, 0, 18, 86, 27494 }, // Θ
-    { 12, 18, 12, -1, 18, 54, 27580 }, // Ι
-    { 20, 19, 20, -1, 18, 95, 27634 }, // Κ
-    { 20, 18, 19, -2, 18, 90, 27729 }, // Λ
-    { 25, 18, 24, -2, 18, 113, 27819 }, // Μ
-    { 22, 19, 22, -1, 18, 105, 27932 }, // Ν
-    { 18, 18, 18, -1, 18, 81, 28037 }, // Ξ
-    { 18, 19, 19, 0, 18, 86, 28118 }, // Ο
-    { 22, 18, 22, -1, 18, 99, 28204 }, // Π
-    { 17, 18, 17, -1, 18, 77, 28303 }, // Ρ
-    { 17, 19, 17, -1, 18, 81, 28380 }, // Σ
-    { 17, 18, 19, 1, 18, 77, 28461 }, // Τ
-    { 17, 18, 19, 1, 18, 77, 28538 }, // Υ
-    { 19, 19, 20, 0, 18, 91, 28615 }, // Φ
-    { 21, 18, 20, -2, 18, 95, 28706 }, // Χ
-    { 21, 18, 23, 1, 18, 95, 28801 }, // Ψ
-    { 20, 18, 21, -1, 18, 90, 28896 }, // Ω
-    { 15, 15, 16, 0, 14, 57, 28986 }, // α
-    { 15, 26, 15, -1, 20, 98, 29043 }, // β
-    { 13, 20, 14, 0, 14, 65, 29141 }, // γ
-    { 14, 21, 15, 0, 20, 74, 29206 }, // δ
-    { 12, 15, 13, 0, 14, 45, 29280 }, // ε
-    { 12, 26, 14, 1, 21, 78, 29325 }, // ζ
-    { 14, 20, 15, 0, 14, 70, 29403 }, // η
-    { 14, 21, 16, 1, 20, 74, 29473 }, // θ
-    { 8, 15, 9, 0, 14, 30, 29547 }, // ι
-    { 15, 15, 16, 0, 14, 57, 29577 }, // κ
-    { 15, 21, 15, -1, 20, 79, 29634 }, // λ
-    { 17, 20, 17, -1, 14, 85, 29713 }, // μ
-    { 13, 15, 14, 0, 14, 49, 29798 }, // ν
-    { 12, 26, 13, 0, 21, 78, 29847 }, // ξ
-    { 13, 15, 14, 0, 14, 49, 29925 }, // ο
-    { 17, 15, 18, 0, 14, 64, 29974 }, // π
-    { 15, 20, 15, -1, 14, 75, 30038 }, // ρ
-    { 11, 19, 12, 0, 14, 53, 30113 }, // ς
-    { 16, 15, 17, 0, 14, 60, 30166 }, // σ
-    { 13, 15, 14, 0, 14, 49, 30226 }, // τ
-    { 13, 15, 15, 1, 14, 49, 30275 }, // υ
-    { 17, 20, 18, 0, 14, 85, 30324 }, // φ
-    { 17, 20, 16, -2, 14, 85, 30409 }, // χ
-    { 18, 24, 20, 1, 18, 108, 30494 }, // ψ
-    { 18, 15, 19, 0, 14, 68, 30602 }, // ω
-    { 20, 24, 19, -2, 18, 120, 30670 }, // Ạ
-    { 15, 20, 16, 0, 14, 75, 30790 }, // ạ
-    { 20, 26, 19, -2, 26, 130, 30865 }, // Ả
-    { 15, 23, 16, 0, 22, 87, 30995 }, // ả
-    { 21, 26, 20, -2, 26, 137, 31082 }, // Ấ
-    { 17, 26, 18, 0, 25, 111, 31219 }, // ấ
-    { 20, 26, 19, -2, 26, 130, 31330 }, // Ầ
-    { 15, 26, 16, 0, 25, 98, 31460 }, // ầ
-    { 21, 26, 20, -2, 26, 137, 31558 }, // Ẩ
-    { 17, 26, 18, 0, 25, 111, 31695 }, // ẩ
-    { 20, 26, 19, -2, 26, 130, 31806 }, // Ẫ
-    { 15, 25, 16, 0, 24, 94, 31936 }, // ẫ
-    { 20, 31, 19, -2, 25, 155, 32030 }, // Ậ
-    { 15, 27, 16, 0, 21, 102, 32185 }, // ậ
-    { 20, 26, 19, -2, 26, 130, 32287 }, // Ắ
-    { 15, 26, 16, 0, 25, 98, 32417 }, // ắ
-    { 20, 26, 19, -2, 26, 130, 32515 }, // Ằ
-    { 15, 26, 16, 0, 25, 98, 32645 }, // ằ
-    { 20, 26, 19, -2, 26, 130, 32743 }, // Ẳ
-    { 15, 26, 16, 0, 25, 98, 32873 }, // ẳ
-    { 20, 26, 19, -2, 26, 130, 32971 }, // Ẵ
-    { 15, 25, 16, 0, 24, 94, 33101 }, // ẵ
-    { 20, 30, 19, -2, 24, 150, 33195 }, // Ặ
-    { 15, 26, 16, 0, 20, 98, 33345 }, // ặ
-    { 17, 24, 17, -1, 18, 102, 33443 }, // Ẹ
-    { 12, 20, 13, 0, 14, 60, 33545 }, // ẹ
-    { 17, 26, 17, -1, 26, 111, 33605 }, // Ẻ
-    { 12, 23, 13, 0, 22, 69, 33716 }, // ẻ
-    { 17, 24, 17, -1, 24, 102, 33785 }, // Ẽ
-    { 13, 21, 14, 0, 20, 69, 33887 }, // ẽ
-    { 19, 26, 19, -1, 26, 124, 33956 }, // Ế
-    { 16, 26, 17, 0, 25, 104, 34080 }, // ế
-    { 17, 26, 17, -1, 26, 111, 34184 }, // Ề
-    { 13, 26, 14, 0, 25, 85, 34295 }, // ề
-    { 19, 26, 19, -1, 26, 124, 34380 }, // Ể
-    { 16, 26, 17, 0, 25, 104, 34504 }, // ể
-    { 17, 26, 17, -1, 26, 111, 34608 }, // Ễ
-    { 13, 25, 14, 0, 24, 82, 34719 }, // ễ
-    { 17, 31, 17, -1, 25, 132, 34801 }, // Ệ
-    { 12, 27, 13, 0, 21, 81, 34933 }, // ệ
-    { 12, 26, 12, -1, 26, 78, 35014 }, // Ỉ
-    { 10, 23, 11, 0, 22, 58, 35092 }, // ỉ
-    { 12, 24, 12, -1, 18, 72, 35150 }, // Ị
-    { 9, 26, 10, 0, 20, 59, 35222 }, // ị
-    { 18, 24, 19, 0, 18, 108, 35281 }, // Ọ
-    { 13, 20, 14, 0, 14, 65, 35389 }, // ọ
-    { 18, 27, 19, 0, 26, 122, 35454 }, // Ỏ
-    { 13, 23, 14, 0, 22, 75, 35576 }, // ỏ
-    { 19, 27, 20, 0, 26, 129, 35651 }, // Ố
-    { 17, 26, 18, 0, 25, 111, 35780 }, // ố
-    { 18, 27, 19, 0, 26, 122, 35891 }, // Ồ
-    { 14, 26, 15, 0, 25, 91, 36013 }, // ồ
-    { 19, 27, 20, 0, 26, 129, 36104 }, // Ổ
-    { 17, 26, 18, 0, 25, 111, 36233 }, // ổ
-    { 18, 27, 19, 0, 26, 122, 36344 }, // Ỗ
-    { 14, 25, 15, 0, 24, 88, 36466 }, // ỗ
-    { 18, 31, 19, 0, 25, 140, 36554 }, // Ộ
-    { 13, 27, 14, 0, 21, 88, 36694 }, // ộ
-    { 21, 26, 22, 0, 25, 137, 36782 }, // Ớ
-    { 16, 23, 17, 0, 22, 92, 36919 }, // ớ
-    { 21, 26, 22, 0, 25, 137, 37011 }, // Ờ
-    { 16, 22, 17, 0, 21, 88, 37148 }, // ờ
-    { 21, 27, 22, 0, 26, 142, 37236 }, // Ở
-    { 16, 23, 17, 0, 22, 92, 37378 }, // ở
-    { 21, 25, 22, 0, 24, 132, 37470 }, // Ỡ
-    { 16, 21, 17, 0, 20, 84, 37602 }, // ỡ
-    { 21, 27, 22, 0, 21, 142, 37686 }, // Ợ
-    { 16, 22, 17, 0, 16, 88, 37828 }, // ợ
-    { 19, 24, 22, 2, 18, 114, 37916 }, // Ụ
-    { 15, 20, 16, 0, 14, 75, 38030 }, // ụ
-    { 19, 27, 22, 2, 26, 129, 38105 }, // Ủ
-    { 15, 23, 16, 0, 22, 87, 38234 }, // ủ
-    { 22, 26, 25, 2, 25, 143, 38321 }, // Ứ
-    { 18, 23, 19, 0, 22, 104, 38464 }, // ứ
-    { 22, 26, 25, 2, 25, 143, 38568 }, // Ừ
-    { 18, 22, 19, 0, 21, 99, 38711 }, // ừ
-    { 22, 27, 25, 2, 26, 149, 38810 }, // Ử
-    { 18, 23, 19, 0, 22, 104, 38959 }, // ử
-    { 22, 25, 25, 2, 24, 138, 39063 }, // Ữ
-    { 18, 21, 19, 0, 20, 95, 39201 }, // ữ
-    { 22, 27, 25, 2, 21, 149, 39296 }, // Ự
-    { 18, 22, 19, 0, 16, 99, 39445 }, // ự
-    { 18, 25, 20, 1, 25, 113, 39544 }, // Ỳ
-    { 17, 27, 14, -4, 21, 115, 39657 }, // ỳ
-    { 18, 24, 20, 1, 18, 108, 39772 }, // Ỵ
-    { 17, 20, 14, -4, 14, 85, 39880 }, // ỵ
-    { 18, 26, 20, 1, 26, 117, 39965 }, // Ỷ
-    { 17, 28, 14, -4, 22, 119, 40082 }, // ỷ
-    { 18, 24, 20, 1, 24, 108, 40201 }, // Ỹ
-    { 17, 26, 14, -4, 20, 111, 40309 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 40420 }, //  
-    { 0, 0, 25, 0, 0, 0, 40420 }, //  
-    { 0, 0, 13, 0, 0, 0, 40420 }, //  
-    { 0, 0, 25, 0, 0, 0, 40420 }, //  
-    { 0, 0, 8, 0, 0, 0, 40420 }, //  
-    { 0, 0, 6, 0, 0, 0, 40420 }, //  
-    { 0, 0, 4, 0, 0, 0, 40420 }, //  
-    { 0, 0, 16, 0, 0, 0, 40420 }, //  
-    { 0, 0, 8, 0, 0, 0, 40420 }, //  
-    { 0, 0, 5, 0, 0, 0, 40420 }, //  
-    { 0, 0, 1, 0, 0, 0, 40420 }, //  
-    { 0, 0, 1, 0, 0, 0, 40420 }, // ​
-    { 2, 21, 2, -1, 15, 11, 40420 }, // ‌
-    { 6, 23, 4, -3, 17, 35, 40431 }, // ‍
-    { 8, 24, 5, -4, 18, 48, 40466 }, // ‎
-    { 8, 24, 5, -4, 18, 48, 40514 }, // ‏
-    { 8, 3, 10, 1, 8, 6, 40562 }, // ‐
-    { 8, 3, 10, 1, 8, 6, 40568 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 40574 }, // ‒
-    { 13, 3, 14, 0, 8, 10, 40584 }, // –
-    { 25, 3, 26, 0, 8, 19, 40594 }, // —
-    { 25, 3, 26, 0, 8, 19, 40613 }, // ―
-    { 9, 26, 13, 2, 20, 59, 40632 }, // ‖
-    { 13, 7, 14, 0, -1, 23, 40691 }, // ‗
-    { 6, 9, 9, 2, 19, 14, 40714 }, // ‘
-    { 6, 9, 8, 1, 19, 14, 40728 }, // ’
-    { 6, 9, 8, 0, 4, 14, 40742 }, // ‚
-    { 6, 9, 8, 1, 19, 14, 40756 }, // ‛
-    { 11, 9, 14, 2, 19, 25, 40770 }, // “
-    { 12, 9, 14, 1, 19, 27, 40795 }, // ”
-    { 11, 9, 13, 0, 4, 25, 40822 }, // „
-    { 11, 9, 13, 1, 19, 25, 40847 }, // ‟
-    { 11, 17, 13, 1, 18, 47, 40872 }, // †
-    { 13, 20, 13, -1, 18, 65, 40919 }, // ‡
-    { 7, 7, 8, 0, 10, 13, 40984 }, // •
-    { 9, 9, 16, 3, 13, 21, 40997 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 41018 }, // ․
-    { 11, 5, 13, 1, 4, 14, 41025 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 41039 }, // …
-    { 5, 5, 7, 1, 9, 7, 41066 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 41073 }, //  
-    { 0, 0, 1, 0, 0, 0, 41073 }, //  
-    { 8, 24, 5, -4, 18, 48, 41073 }, // ‪
-    { 8, 24, 5, -4, 18, 48, 41121 }, // ‫
-    { 8, 24, 5, -4, 18, 48, 41169 }, // ‬
-    { 11, 24, 7, -5, 18, 66, 41217 }, // ‭
-    { 11, 24, 7, -5, 18, 66, 41283 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 41349 }, //  
-    { 33, 21, 35, 1, 19, 174, 41349 }, // ‰
-    { 6, 9, 7, 0, 18, 14, 41523 }, // ′
-    { 11, 9, 12, 0, 18, 25, 41537 }, // ″
-    { 17, 9, 18, 0, 18, 39, 41562 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 41601 }, // ‵
-    { 12, 9, 13, 0, 18, 27, 41615 }, // ‶
-    { 17, 9, 18, 0, 18, 39, 41642 }, // ‷
-    { 11, 6, 13, 1, 0, 17, 41681 }, // ‸
-    { 9, 11, 10, 0, 12, 25, 41698 }, // ‹
-    { 8, 11, 9, 0, 12, 22, 41723 }, // ›
-    { 16, 18, 17, 0, 17, 72, 41745 }, // ※
-    { 15, 20, 17, 1, 19, 75, 41817 }, // ‼
-    { 13, 3, 14, 0, 21, 10, 41892 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 41902 }, // ⁃
-    { 17, 21, 13, -5, 19, 90, 41907 }, // ⁄
-    { 18, 20, 21, 2, 19, 90, 41997 }, // ⁇
-    { 16, 20, 19, 2, 19, 80, 42087 }, // ⁈
-    { 17, 20, 19, 1, 19, 85, 42167 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 42252 }, // ⁓
-    { 23, 9, 24, 0, 18, 52, 42275 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 42327 }, //  
-    { 0, 0, 1, 0, 0, 0, 42327 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 42327 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 42327 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 42327 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 42327 }, // ⁤
-    { 11, 12, 12, 0, 21, 33, 42327 }, // ⁰
-    { 11, 12, 12, 0, 21, 33, 42360 }, // ⁴
-    { 11, 13, 12, 0, 21, 36, 42393 }, // ⁵
-    { 10, 12, 12, 1, 21, 30, 42429 }, // ⁶
-    { 9, 13, 12, 2, 21, 30, 42459 }, // ⁷
-    { 11, 12, 12, 0, 21, 33, 42489 }, // ⁸
-    { 11, 12, 12, 0, 21, 33, 42522 }, // ⁹
-    { 11, 10, 14, 2, 18, 28, 42555 }, // ⁿ
-    { 11, 12, 12, 0, 8, 33, 42583 }, // ₀
-    { 8, 13, 11, 1, 9, 26, 42616 }, // ₁
-    { 11, 12, 12, 0, 8, 33, 42642 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 42675 }, // ₃
-    { 11, 12, 12, 0, 8, 33, 42702 }, // ₄
-    { 11, 12, 12, 0, 8, 33, 42735 }, // ₅
-    { 10, 12, 12, 1, 8, 30, 42768 }, // ₆
-    { 9, 12, 12, 2, 8, 27, 42798 }, // ₇
-    { 11, 12, 12, 0, 8, 33, 42825 }, // ₈
-    { 11, 12, 12, 0, 8, 33, 42858 }, // ₉
-    { 17, 18, 17, -1, 18, 77, 42891 }, // ₣
-    { 17, 19, 17, -1, 18, 81, 42968 }, // ₤
-    { 33, 19, 34, 0, 18, 157, 43049 }, // ₧
-    { 18, 19, 18, -1, 18, 86, 43206 }, // €
-    { 17, 12, 25, 4, 15, 51, 43292 }, // ←
-    { 13, 17, 25, 6, 17, 56, 43343 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 43399 }, // →
-    { 13, 17, 25, 6, 17, 56, 43450 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 43506 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 43553 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 43600 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 43659 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 43709 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 43759 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 43812 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 43876 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 43940 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 44004 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 44068 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 44124 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 44210 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 44279 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 44338 }, // ∅
-    { 17, 18, 18, 0, 18, 77, 44438 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 44515 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 44596 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 44673 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 44771 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 44835 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 44912 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 45010 }, // ∍
-    { 21, 22, 22, 0, 18, 116, 45074 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 45190 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 45282 }, // −
-    { 15, 20, 15, -1, 18, 75, 45291 }, // ∕
-    { 13, 20, 14, 0, 18, 65, 45366 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 45431 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 45470 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 45495 }, // ∙
-    { 17, 24, 17, -1, 21, 102, 45503 }, // √
-    { 13, 10, 16, 1, 13, 33, 45605 }, // ∝
-    { 16, 10, 17, 0, 13, 40, 45638 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 45678 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 45755 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 45841 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 45867 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 45926 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 46007 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 46088 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 46156 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 46228 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 46326 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 46390 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 46454 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 46477 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 46541 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 46564 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 46621 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 46657 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 46695 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 46734 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 46783 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 46828 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 46876 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 46945 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 47014 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 47078 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 47176 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 47274 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 47351 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 47428 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 47519 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 47610 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 47701 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 47792 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 47860 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 47868 }, // ⋯
-    { 25, 24, 26, 0, 21, 150, 47897 }, // �
+    { 8, 20, 10, 1, 19, 31, 0 }, // !
+    { 10, 9, 12, 1, 18, 26, 31 }, // "
+    { 16, 17, 17, 0, 15, 53, 57 }, // #
+    { 14, 25, 16, 1, 20, 73, 110 }, // $
+    { 23, 21, 25, 1, 19, 93, 183 }, // %
+    { 21, 21, 23, 1, 19, 79, 276 }, // &
+    { 5, 9, 7, 1, 18, 14, 355 }, // '
+    { 12, 25, 13, 0, 20, 44, 369 }, // (
+    { 11, 25, 11, -1, 20, 41, 413 }, // )
+    { 10, 10, 12, 1, 19, 23, 454 }, // *
+    { 12, 12, 16, 2, 14, 29, 477 }, // +
+    { 7, 9, 8, -1, 4, 14, 506 }, // ,
+    { 8, 3, 10, 1, 8, 5, 520 }, // -
+    { 5, 5, 8, 1, 4, 8, 525 }, // .
+    { 15, 20, 15, -1, 18, 40, 533 }, // /
+    { 16, 19, 17, 0, 18, 52, 573 }, // 0
+    { 12, 18, 16, 1, 18, 34, 625 }, // 1
+    { 15, 18, 16, 0, 18, 45, 659 }, // 2
+    { 15, 19, 16, 0, 18, 47, 704 }, // 3
+    { 15, 18, 16, 0, 18, 46, 751 }, // 4
+    { 16, 19, 17, 0, 18, 44, 797 }, // 5
+    { 15, 19, 17, 1, 18, 49, 841 }, // 6
+    { 15, 19, 18, 2, 18, 42, 890 }, // 7
+    { 15, 19, 16, 0, 18, 53, 932 }, // 8
+    { 16, 19, 16, -1, 18, 52, 985 }, // 9
+    { 7, 14, 9, 1, 13, 17, 1037 }, // :
+    { 9, 18, 9, -1, 13, 24, 1054 }, // ;
+    { 12, 13, 16, 2, 15, 25, 1078 }, // <
+    { 12, 8, 16, 2, 12, 23, 1103 }, // =
+    { 12, 13, 16, 2, 15, 24, 1126 }, // >
+    { 8, 20, 11, 2, 19, 30, 1150 }, // ?
+    { 23, 23, 25, 1, 18, 110, 1180 }, // @
+    { 20, 18, 19, -2, 18, 56, 1290 }, // A
+    { 16, 19, 16, -1, 18, 59, 1346 }, // B
+    { 17, 19, 18, 0, 18, 45, 1405 }, // C
+    { 19, 19, 19, -1, 18, 63, 1450 }, // D
+    { 17, 18, 17, -1, 18, 57, 1513 }, // E
+    { 16, 18, 16, -1, 18, 48, 1570 }, // F
+    { 18, 19, 19, 0, 18, 54, 1618 }, // G
+    { 22, 18, 22, -1, 18, 69, 1672 }, // H
+    { 12, 18, 12, -1, 18, 35, 1741 }, // I
+    { 16, 23, 12, -5, 18, 54, 1776 }, // J
+    { 20, 19, 20, -1, 18, 67, 1830 }, // K
+    { 15, 18, 15, -1, 18, 47, 1897 }, // L
+    { 25, 18, 24, -2, 18, 90, 1944 }, // M
+    { 22, 19, 22, -1, 18, 74, 2034 }, // N
+    { 18, 19, 19, 0, 18, 59, 2108 }, // O
+    { 17, 18, 17, -1, 18, 49, 2167 }, // P
+    { 22, 24, 23, 0, 18, 78, 2216 }, // Q
+    { 18, 19, 18, -1, 18, 62, 2294 }, // R
+    { 15, 19, 15, -1, 18, 51, 2356 }, // S
+    { 17, 18, 19, 1, 18, 55, 2407 }, // T
+    { 19, 19, 22, 2, 18, 62, 2462 }, // U
+    { 19, 19, 21, 1, 18, 62, 2524 }, // V
+    { 26, 19, 28, 1, 18, 95, 2586 }, // W
+    { 21, 18, 20, -2, 18, 63, 2681 }, // X
+    { 18, 18, 20, 1, 18, 53, 2744 }, // Y
+    { 17, 19, 17, -1, 18, 53, 2797 }, // Z
+    { 12, 24, 11, -2, 20, 44, 2850 }, // [
+    { 11, 20, 13, 1, 18, 29, 2894 }, // <backslash>
+    { 12, 24, 11, -2, 20, 44, 2923 }, // ]
+    { 13, 12, 16, 1, 16, 32, 2967 }, // ^
+    { 13, 3, 14, 0, -1, 11, 2999 }, // _
+    { 6, 7, 16, 5, 21, 10, 3010 }, // `
+    { 15, 15, 16, 0, 14, 45, 3020 }, // a
+    { 14, 21, 15, 0, 20, 55, 3065 }, // b
+    { 12, 15, 13, 0, 14, 29, 3120 }, // c
+    { 15, 21, 16, 0, 20, 58, 3149 }, // d
+    { 12, 15, 13, 0, 14, 36, 3207 }, // e
+    { 19, 26, 15, -5, 20, 65, 3243 }, // f
+    { 17, 20, 16, -2, 14, 60, 3308 }, // g
+    { 15, 21, 16, 0, 20, 60, 3368 }, // h
+    { 9, 21, 10, 0, 20, 31, 3428 }, // i
+    { 14, 26, 10, -5, 20, 52, 3459 }, // j
+    { 13, 21, 14, 0, 20, 56, 3511 }, // k
+    { 8, 21, 9, 0, 20, 34, 3567 }, // l
+    { 22, 15, 23, 0, 14, 68, 3601 }, // m
+    { 15, 15, 16, 0, 14, 48, 3669 }, // n
+    { 13, 15, 14, 0, 14, 40, 3717 }, // o
+    { 16, 20, 15, -2, 14, 58, 3757 }, // p
+    { 14, 20, 15, 0, 14, 58, 3815 }, // q
+    { 13, 14, 14, 0, 14, 32, 3873 }, // r
+    { 12, 15, 12, -1, 14, 31, 3905 }, // s
+    { 11, 18, 12, 0, 17, 34, 3936 }, // t
+    { 15, 15, 16, 0, 14, 46, 3970 }, // u
+    { 13, 15, 14, 0, 14, 40, 4016 }, // v
+    { 19, 15, 20, 0, 14, 62, 4056 }, // w
+    { 16, 15, 16, -1, 14, 43, 4118 }, // x
+    { 17, 20, 14, -4, 14, 56, 4161 }, // y
+    { 14, 15, 14, -1, 14, 41, 4217 }, // z
+    { 11, 25, 13, 1, 20, 39, 4258 }, // {
+    { 9, 23, 9, -1, 20, 34, 4297 }, // |
+    { 11, 25, 11, -1, 20, 41, 4331 }, // }
+    { 13, 5, 16, 1, 11, 18, 4372 }, // ~
+    { 0, 0, 5, 0, 0, 0, 4390 }, //  
+    { 9, 20, 9, -1, 14, 29, 4390 }, // ¡
+    { 14, 25, 16, 1, 20, 64, 4419 }, // ¢
+    { 17, 19, 17, -1, 18, 55, 4483 }, // £
+    { 16, 13, 17, 0, 15, 40, 4538 }, // ¤
+    { 17, 18, 19, 1, 18, 51, 4578 }, // ¥
+    { 9, 23, 9, -1, 20, 30, 4629 }, // ¦
+    { 13, 21, 13, -1, 18, 56, 4659 }, // §
+    { 9, 5, 16, 3, 20, 12, 4715 }, // ¨
+    { 19, 19, 20, 0, 18, 87, 4727 }, // ©
+    { 10, 13, 12, 1, 18, 35, 4814 }, // ª
+    { 15, 11, 16, 0, 12, 31, 4849 }, // «
+    { 12, 7, 16, 2, 12, 20, 4880 }, // ¬
+    { 8, 3, 10, 1, 8, 5, 4900 }, // ­
+    { 14, 14, 15, 0, 20, 63, 4905 }, // ®
+    { 9, 3, 16, 3, 18, 9, 4968 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 4977 }, // °
+    { 12, 16, 16, 2, 15, 41, 5002 }, // ±
+    { 11, 12, 12, 0, 21, 29, 5043 }, // ²
+    { 9, 13, 11, 1, 21, 27, 5072 }, // ³
+    { 6, 7, 16, 5, 22, 9, 5099 }, // ´
+    { 17, 20, 17, -1, 14, 55, 5108 }, // µ
+    { 17, 22, 17, -1, 18, 74, 5163 }, // ¶
+    { 5, 5, 8, 1, 10, 7, 5237 }, // ·
+    { 6, 6, 16, 5, -1, 12, 5244 }, // ¸
+    { 8, 12, 11, 1, 21, 23, 5256 }, // ¹
+    { 10, 13, 12, 1, 18, 33, 5279 }, // º
+    { 15, 11, 16, 0, 12, 29, 5312 }, // »
+    { 26, 21, 28, 1, 19, 85, 5341 }, // ¼
+    { 25, 21, 27, 1, 19, 82, 5426 }, // ½
+    { 26, 21, 28, 1, 19, 89, 5508 }, // ¾
+    { 9, 20, 10, 0, 14, 35, 5597 }, // ¿
+    { 20, 25, 19, -2, 25, 71, 5632 }, // À
+    { 20, 25, 19, -2, 25, 69, 5703 }, // Á
+    { 20, 25, 19, -2, 25, 74, 5772 }, // Â
+    { 20, 24, 19, -2, 24, 73, 5846 }, // Ã
+    { 20, 24, 19, -2, 24, 72, 5919 }, // Ä
+    { 20, 25, 19, -2, 25, 76, 5991 }, // Å
+    { 26, 18, 25, -2, 18, 83, 6067 }, // Æ
+    { 17, 25, 18, 0, 18, 58, 6150 }, // Ç
+    { 17, 25, 17, -1, 25, 70, 6208 }, // È
+    { 17, 25, 17, -1, 25, 70, 6278 }, // É
+    { 17, 25, 17, -1, 25, 75, 6348 }, // Ê
+    { 17, 24, 17, -1, 24, 72, 6423 }, // Ë
+    { 12, 25, 12, -1, 25, 47, 6495 }, // Ì
+    { 13, 25, 13, -1, 25, 48, 6542 }, // Í
+    { 13, 25, 13, -1, 25, 53, 6590 }, // Î
+    { 13, 24, 13, -1, 24, 51, 6643 }, // Ï
+    { 19, 19, 19, -1, 18, 67, 6694 }, // Ð
+    { 22, 25, 22, -1, 24, 89, 6761 }, // Ñ
+    { 18, 26, 19, 0, 25, 72, 6850 }, // Ò
+    { 18, 26, 19, 0, 25, 72, 6922 }, // Ó
+    { 18, 26, 19, 0, 25, 76, 6994 }, // Ô
+    { 18, 25, 19, 0, 24, 74, 7070 }, // Õ
+    { 18, 25, 19, 0, 24, 74, 7144 }, // Ö
+    { 11, 11, 16, 2, 14, 28, 7218 }, // ×
+    { 21, 20, 21, -1, 19, 75, 7246 }, // Ø
+    { 19, 26, 22, 2, 25, 75, 7321 }, // Ù
+    { 19, 26, 22, 2, 25, 75, 7396 }, // Ú
+    { 19, 26, 22, 2, 25, 80, 7471 }, // Û
+    { 19, 25, 22, 2, 24, 78, 7551 }, // Ü
+    { 18, 25, 20, 1, 25, 67, 7629 }, // Ý
+    { 16, 18, 16, -1, 18, 51, 7696 }, // Þ
+    { 21, 26, 17, -5, 20, 87, 7747 }, // ß
+    { 15, 22, 16, 0, 21, 59, 7834 }, // à
+    { 15, 23, 16, 0, 22, 59, 7893 }, // á
+    { 15, 22, 16, 0, 21, 61, 7952 }, // â
+    { 15, 21, 16, 0, 20, 58, 8013 }, // ã
+    { 15, 21, 16, 0, 20, 58, 8071 }, // ä
+    { 15, 22, 16, 0, 21, 64, 8129 }, // å
+    { 20, 15, 21, 0, 14, 57, 8193 }, // æ
+    { 12, 21, 13, 0, 14, 41, 8250 }, // ç
+    { 12, 22, 13, 0, 21, 49, 8291 }, // è
+    { 13, 23, 14, 0, 22, 50, 8340 }, // é
+    { 12, 22, 13, 0, 21, 50, 8390 }, // ê
+    { 13, 21, 14, 0, 20, 49, 8440 }, // ë
+    { 8, 22, 9, 0, 21, 36, 8489 }, // ì
+    { 11, 23, 12, 0, 22, 35, 8525 }, // í
+    { 10, 22, 11, 0, 21, 39, 8560 }, // î
+    { 11, 21, 12, 0, 20, 37, 8599 }, // ï
+    { 14, 22, 15, 0, 21, 54, 8636 }, // ð
+    { 15, 21, 16, 0, 20, 61, 8690 }, // ñ
+    { 13, 22, 14, 0, 21, 52, 8751 }, // ò
+    { 14, 23, 15, 0, 22, 54, 8803 }, // ó
+    { 13, 22, 14, 0, 21, 56, 8857 }, // ô
+    { 14, 21, 15, 0, 20, 54, 8913 }, // õ
+    { 14, 21, 15, 0, 20, 54, 8967 }, // ö
+    { 12, 13, 16, 2, 15, 30, 9021 }, // ÷
+    { 17, 15, 16, -2, 14, 48, 9051 }, // ø
+    { 15, 22, 16, 0, 21, 59, 9099 }, // ù
+    { 15, 23, 16, 0, 22, 60, 9158 }, // ú
+    { 15, 22, 16, 0, 21, 62, 9218 }, // û
+    { 15, 21, 16, 0, 20, 58, 9280 }, // ü
+    { 17, 28, 14, -4, 22, 70, 9338 }, // ý
+    { 17, 26, 15, -3, 20, 71, 9408 }, // þ
+    { 17, 26, 14, -4, 20, 72, 9479 }, // ÿ
+    { 20, 23, 19, -2, 23, 68, 9551 }, // Ā
+    { 15, 19, 16, 0, 18, 54, 9619 }, // ā
+    { 20, 24, 19, -2, 24, 73, 9673 }, // Ă
+    { 15, 21, 16, 0, 20, 59, 9746 }, // ă
+    { 20, 24, 19, -2, 18, 71, 9805 }, // Ą
+    { 15, 20, 16, 0, 14, 55, 9876 }, // ą
+    { 17, 26, 18, 0, 25, 58, 9931 }, // Ć
+    { 13, 23, 14, 0, 22, 45, 9989 }, // ć
+    { 17, 26, 18, 0, 25, 62, 10034 }, // Ĉ
+    { 12, 22, 13, 0, 21, 44, 10096 }, // ĉ
+    { 17, 25, 18, 0, 24, 56, 10140 }, // Ċ
+    { 12, 21, 13, 0, 20, 38, 10196 }, // ċ
+    { 17, 26, 18, 0, 25, 61, 10234 }, // Č
+    { 13, 22, 14, 0, 21, 49, 10295 }, // č
+    { 19, 26, 19, -1, 25, 79, 10344 }, // Ď
+    { 19, 21, 20, 0, 20, 69, 10423 }, // ď
+    { 19, 19, 19, -1, 18, 67, 10492 }, // Đ
+    { 17, 21, 18, 0, 20, 61, 10559 }, // đ
+    { 17, 23, 17, -1, 23, 69, 10620 }, // Ē
+    { 13, 19, 14, 0, 18, 45, 10689 }, // ē
+    { 17, 24, 17, -1, 24, 72, 10734 }, // Ĕ
+    { 13, 21, 14, 0, 20, 50, 10806 }, // ĕ
+    { 17, 24, 17, -1, 24, 69, 10856 }, // Ė
+    { 12, 21, 13, 0, 20, 45, 10925 }, // ė
+    { 17, 24, 17, -1, 18, 70, 10970 }, // Ę
+    { 12, 20, 13, 0, 14, 48, 11040 }, // ę
+    { 17, 25, 17, -1, 25, 75, 11088 }, // Ě
+    { 13, 22, 14, 0, 21, 53, 11163 }, // ě
+    { 18, 26, 19, 0, 25, 71, 11216 }, // Ĝ
+    { 17, 27, 16, -2, 21, 77, 11287 }, // ĝ
+    { 18, 25, 19, 0, 24, 70, 11364 }, // Ğ
+    { 17, 26, 16, -2, 20, 75, 11434 }, // ğ
+    { 18, 25, 19, 0, 24, 65, 11509 }, // Ġ
+    { 17, 26, 16, -2, 20, 70, 11574 }, // ġ
+    { 18, 25, 19, 0, 18, 66, 11644 }, // Ģ
+    { 17, 28, 16, -2, 22, 74, 11710 }, // ģ
+    { 22, 25, 22, -1, 25, 89, 11784 }, // Ĥ
+    { 15, 27, 16, 0, 26, 75, 11873 }, // ĥ
+    { 22, 18, 22, -1, 18, 75, 11948 }, // Ħ
+    { 15, 21, 16, 0, 20, 61, 12023 }, // ħ
+    { 13, 24, 13, -1, 24, 51, 12084 }, // Ĩ
+    { 11, 21, 12, 0, 20, 38, 12135 }, // ĩ
+    { 13, 23, 13, -1, 23, 48, 12173 }, // Ī
+    { 11, 19, 12, 0, 18, 34, 12221 }, // ī
+    { 13, 24, 13, -1, 24, 51, 12255 }, // Ĭ
+    { 11, 21, 12, 0, 20, 38, 12306 }, // ĭ
+    { 12, 24, 12, -1, 18, 45, 12344 }, // Į
+    { 9, 26, 10, 0, 20, 41, 12389 }, // į
+    { 12, 24, 12, -1, 24, 45, 12430 }, // İ
+    { 8, 15, 9, 0, 14, 25, 12475 }, // ı
+    { 22, 23, 22, -1, 18, 82, 12500 }, // Ĳ
+    { 17, 26, 18, 0, 20, 75, 12582 }, // ĳ
+    { 17, 30, 13, -5, 25, 70, 12657 }, // Ĵ
+    { 16, 27, 12, -5, 21, 60, 12727 }, // ĵ
+    { 20, 25, 20, -1, 18, 81, 12787 }, // Ķ
+    { 13, 27, 14, 0, 20, 69, 12868 }, // ķ
+    { 14, 15, 15, 0, 14, 43, 12937 }, // ĸ
+    { 15, 25, 15, -1, 25, 60, 12980 }, // Ĺ
+    { 10, 27, 11, 0, 26, 45, 13040 }, // ĺ
+    { 15, 25, 15, -1, 18, 61, 13085 }, // Ļ
+    { 9, 27, 9, -1, 20, 42, 13146 }, // ļ
+    { 16, 20, 16, -1, 20, 56, 13188 }, // Ľ
+    { 12, 21, 13, 0, 20, 45, 13244 }, // ľ
+    { 16, 18, 16, -1, 18, 51, 13289 }, // Ŀ
+    { 12, 21, 13, 0, 20, 41, 13340 }, // ŀ
+    { 15, 18, 15, -1, 18, 49, 13381 }, // Ł
+    { 10, 21, 10, -1, 20, 37, 13430 }, // ł
+    { 22, 26, 22, -1, 25, 90, 13467 }, // Ń
+    { 15, 23, 16, 0, 22, 61, 13557 }, // ń
+    { 22, 25, 22, -1, 18, 88, 13618 }, // Ņ
+    { 15, 21, 16, 0, 14, 60, 13706 }, // ņ
+    { 22, 26, 22, -1, 25, 91, 13766 }, // Ň
+    { 15, 22, 16, 0, 21, 66, 13857 }, // ň
+    { 20, 20, 22, 1, 19, 67, 13923 }, // ŉ
+    { 22, 23, 22, -1, 18, 88, 13990 }, // Ŋ
+    { 14, 20, 15, 0, 14, 59, 14078 }, // ŋ
+    { 18, 24, 19, 0, 23, 71, 14137 }, // Ō
+    { 14, 19, 15, 0, 18, 50, 14208 }, // ō
+    { 18, 25, 19, 0, 24, 74, 14258 }, // Ŏ
+    { 14, 21, 15, 0, 20, 54, 14332 }, // ŏ
+    { 19, 26, 20, 0, 25, 81, 14386 }, // Ő
+    { 15, 22, 16, 0, 21, 60, 14467 }, // ő
+    { 25, 19, 26, 0, 18, 82, 14527 }, // Œ
+    { 20, 15, 21, 0, 14, 63, 14609 }, // œ
+    { 18, 26, 18, -1, 25, 75, 14672 }, // Ŕ
+    { 13, 22, 14, 0, 22, 44, 14747 }, // ŕ
+    { 18, 25, 18, -1, 18, 75, 14791 }, // Ŗ
+    { 14, 21, 14, -1, 14, 46, 14866 }, // ŗ
+    { 18, 26, 18, -1, 25, 80, 14912 }, // Ř
+    { 13, 21, 14, 0, 21, 48, 14992 }, // ř
+    { 15, 26, 15, -1, 25, 64, 15040 }, // Ś
+    { 13, 23, 13, -1, 22, 46, 15104 }, // ś
+    { 15, 26, 15, -1, 25, 66, 15150 }, // Ŝ
+    { 13, 22, 13, -1, 21, 47, 15216 }, // ŝ
+    { 15, 25, 15, -1, 18, 64, 15263 }, // Ş
+    { 12, 21, 12, -1, 14, 42, 15327 }, // ş
+    { 16, 26, 16, -1, 25, 65, 15369 }, // Š
+    { 14, 22, 14, -1, 21, 49, 15434 }, // š
+    { 17, 25, 19, 1, 18, 70, 15483 }, // Ţ
+    { 11, 24, 12, 0, 17, 45, 15553 }, // ţ
+    { 17, 25, 19, 1, 25, 72, 15598 }, // Ť
+    { 13, 21, 14, 0, 20, 46, 15670 }, // ť
+    { 17, 18, 19, 1, 18, 59, 15716 }, // Ŧ
+    { 11, 18, 12, 0, 17, 36, 15775 }, // ŧ
+    { 19, 25, 22, 2, 24, 78, 15811 }, // Ũ
+    { 15, 21, 16, 0, 20, 61, 15889 }, // ũ
+    { 19, 24, 22, 2, 23, 74, 15950 }, // Ū
+    { 15, 19, 16, 0, 18, 55, 16024 }, // ū
+    { 19, 25, 22, 2, 24, 77, 16079 }, // Ŭ
+    { 15, 21, 16, 0, 20, 61, 16156 }, // ŭ
+    { 19, 26, 22, 2, 25, 83, 16217 }, // Ů
+    { 15, 22, 16, 0, 21, 65, 16300 }, // ů
+    { 19, 26, 22, 2, 25, 83, 16365 }, // Ű
+    { 15, 22, 16, 0, 21, 65, 16448 }, // ű
+    { 19, 24, 22, 2, 18, 74, 16513 }, // Ų
+    { 15, 20, 16, 0, 14, 57, 16587 }, // ų
+    { 26, 26, 28, 1, 25, 116, 16644 }, // Ŵ
+    { 19, 22, 20, 0, 21, 81, 16760 }, // ŵ
+    { 18, 25, 20, 1, 25, 69, 16841 }, // Ŷ
+    { 17, 27, 14, -4, 21, 75, 16910 }, // ŷ
+    { 18, 24, 20, 1, 24, 69, 16985 }, // Ÿ
+    { 17, 26, 17, -1, 25, 66, 17054 }, // Ź
+    { 14, 23, 14, -1, 22, 54, 17120 }, // ź
+    { 17, 25, 17, -1, 24, 64, 17174 }, // Ż
+    { 14, 21, 14, -1, 20, 51, 17238 }, // ż
+    { 17, 26, 17, -1, 25, 68, 17289 }, // Ž
+    { 14, 22, 14, -1, 21, 58, 17357 }, // ž
+    { 19, 26, 15, -5, 20, 60, 17415 }, // ſ
+    { 21, 22, 22, 0, 21, 70, 17475 }, // Ơ
+    { 16, 17, 17, 0, 16, 47, 17545 }, // ơ
+    { 17, 18, 18, 0, 18, 56, 17592 }, // Ƥ
+    { 16, 26, 15, -2, 20, 73, 17648 }, // ƥ
+    { 11, 23, 12, 0, 17, 48, 17721 }, // ƫ
+    { 17, 18, 19, 1, 18, 55, 17769 }, // Ƭ
+    { 13, 21, 14, 0, 20, 46, 17824 }, // ƭ
+    { 17, 23, 19, 1, 18, 68, 17870 }, // Ʈ
+    { 22, 22, 25, 2, 21, 71, 17938 }, // Ư
+    { 18, 17, 19, 0, 16, 52, 18009 }, // ư
+    { 6, 7, 3, -4, 21, 10, 18061 }, // ̀
+    { 6, 7, 5, -2, 22, 9, 18071 }, // ́
+    { 9, 7, 5, -5, 21, 13, 18080 }, // ̂
+    { 10, 5, 6, -5, 20, 14, 18093 }, // ̃
+    { 9, 3, 5, -5, 18, 9, 18107 }, // ̄
+    { 8, 5, 5, -4, 20, 12, 18116 }, // ̆
+    { 4, 5, 3, -2, 20, 6, 18128 }, // ̇
+    { 10, 5, 6, -5, 20, 11, 18134 }, // ̈
+    { 7, 8, 5, -3, 22, 16, 18145 }, // ̉
+    { 8, 7, 5, -4, 21, 16, 18161 }, // ̊
+    { 11, 7, 7, -5, 21, 18, 18177 }, // ̋
+    { 9, 6, 6, -4, 21, 15, 18195 }, // ̌
+    { 8, 7, 4, -5, 21, 18, 18210 }, // ̏
+    { 9, 5, 5, -5, 20, 13, 18228 }, // ̑
+    { 6, 8, 4, -3, 22, 10, 18241 }, // ̒
+    { 6, 7, 4, -3, 22, 11, 18251 }, // ̓
+    { 5, 7, 3, -3, 22, 11, 18262 }, // ̔
+    { 4, 7, 3, -2, 22, 10, 18273 }, // ̕
+    { 6, 6, 4, -3, 16, 9, 18283 }, // ̛
+    { 4, 5, 3, -2, -1, 6, 18292 }, // ̣
+    { 10, 4, 6, -5, -2, 12, 18298 }, // ̤
+    { 6, 6, 4, -3, -1, 12, 18310 }, // ̥
+    { 5, 6, 3, -3, -1, 9, 18322 }, // ̦
+    { 6, 6, 4, -3, -1, 10, 18331 }, // ̧
+    { 6, 7, 4, -3, 1, 11, 18341 }, // ̨
+    { 5, 7, 7, -1, -1, 11, 18352 }, // ̩
+    { 9, 6, 5, -5, -1, 14, 18363 }, // ̭
+    { 8, 6, 5, -4, -1, 10, 18377 }, // ̮
+    { 10, 5, 6, -5, -2, 12, 18387 }, // ̰
+    { 9, 3, 5, -5, -2, 7, 18399 }, // ̱
+    { 8, 5, 5, -4, 20, 10, 18406 }, // ͂
+    { 10, 11, 6, -5, 26, 20, 18416 }, // ̈́
+    { 5, 6, 4, -2, -1, 7, 18436 }, // ͅ
+    { 20, 18, 19, -2, 18, 56, 18443 }, // Α
+    { 16, 19, 16, -1, 18, 59, 18499 }, // Β
+    { 17, 18, 17, -1, 18, 46, 18558 }, // Γ
+    { 17, 18, 18, -1, 18, 56, 18604 }, // Δ
+    { 17, 18, 17, -1, 18, 57, 18660 }, // Ε
+    { 17, 19, 17, -1, 18, 53, 18717 }, // Ζ
+    { 22, 18, 22, -1, 18, 69, 18770 }, // Η
+    { 18, 19, 19, 0, 18, 64, 18839 }, // Θ
+    { 12, 18, 12, -1, 18, 35, 18903 }, // Ι
+    { 20, 19, 20, -1, 18, 67, 18938 }, // Κ
+    { 20, 18, 19, -2, 18, 56, 19005 }, // Λ
+    { 25, 18, 24, -2, 18, 90, 19061 }, // Μ
+    { 22, 19, 22, -1, 18, 74, 19151 }, // Ν
+    { 18, 18, 18, -1, 18, 58, 19225 }, // Ξ
+    { 18, 19, 19, 0, 18, 59, 19283 }, // Ο
+    { 22, 18, 22, -1, 18, 65, 19342 }, // Π
+    { 17, 18, 17, -1, 18, 49, 19407 }, // Ρ
+    { 17, 19, 17, -1, 18, 52, 19456 }, // Σ
+    { 17, 18, 19, 1, 18, 55, 19508 }, // Τ
+    { 17, 18, 19, 1, 18, 49, 19563 }, // Υ
+    { 19, 19, 20, 0, 18, 68, 19612 }, // Φ
+    { 21, 18, 20, -2, 18, 63, 19680 }, // Χ
+    { 21, 18, 23, 1, 18, 75, 19743 }, // Ψ
+    { 20, 18, 21, -1, 18, 73, 19818 }, // Ω
+    { 15, 15, 16, 0, 14, 48, 19891 }, // α
+    { 15, 26, 15, -1, 20, 74, 19939 }, // β
+    { 13, 20, 14, 0, 14, 50, 20013 }, // γ
+    { 14, 21, 15, 0, 20, 55, 20063 }, // δ
+    { 12, 15, 13, 0, 14, 35, 20118 }, // ε
+    { 12, 26, 14, 1, 21, 52, 20153 }, // ζ
+    { 14, 20, 15, 0, 14, 56, 20205 }, // η
+    { 14, 21, 16, 1, 20, 59, 20261 }, // θ
+    { 8, 15, 9, 0, 14, 25, 20320 }, // ι
+    { 15, 15, 16, 0, 14, 46, 20345 }, // κ
+    { 15, 21, 15, -1, 20, 51, 20391 }, // λ
+    { 17, 20, 17, -1, 14, 55, 20442 }, // μ
+    { 13, 15, 14, 0, 14, 40, 20497 }, // ν
+    { 12, 26, 13, 0, 21, 54, 20537 }, // ξ
+    { 13, 15, 14, 0, 14, 40, 20591 }, // ο
+    { 17, 15, 18, 0, 14, 48, 20631 }, // π
+    { 15, 20, 15, -1, 14, 54, 20679 }, // ρ
+    { 11, 19, 12, 0, 14, 37, 20733 }, // ς
+    { 16, 15, 17, 0, 14, 38, 20770 }, // σ
+    { 13, 15, 14, 0, 14, 35, 20808 }, // τ
+    { 13, 15, 15, 1, 14, 40, 20843 }, // υ
+    { 17, 20, 18, 0, 14, 69, 20883 }, // φ
+    { 17, 20, 16, -2, 14, 57, 20952 }, // χ
+    { 18, 24, 20, 1, 18, 81, 21009 }, // ψ
+    { 18, 15, 19, 0, 14, 55, 21090 }, // ω
+    { 20, 24, 19, -2, 18, 68, 21145 }, // Ạ
+    { 15, 20, 16, 0, 14, 54, 21213 }, // ạ
+    { 20, 26, 19, -2, 26, 75, 21267 }, // Ả
+    { 15, 23, 16, 0, 22, 65, 21342 }, // ả
+    { 21, 26, 20, -2, 26, 84, 21407 }, // Ấ
+    { 17, 26, 18, 0, 25, 72, 21491 }, // ấ
+    { 20, 26, 19, -2, 26, 81, 21563 }, // Ầ
+    { 15, 26, 16, 0, 25, 70, 21644 }, // ầ
+    { 21, 26, 20, -2, 26, 88, 21714 }, // Ẩ
+    { 17, 26, 18, 0, 25, 77, 21802 }, // ẩ
+    { 20, 26, 19, -2, 26, 78, 21879 }, // Ẫ
+    { 15, 25, 16, 0, 24, 71, 21957 }, // ẫ
+    { 20, 31, 19, -2, 25, 85, 22028 }, // Ậ
+    { 15, 27, 16, 0, 21, 70, 22113 }, // ậ
+    { 20, 26, 19, -2, 26, 78, 22183 }, // Ắ
+    { 15, 26, 16, 0, 25, 71, 22261 }, // ắ
+    { 20, 26, 19, -2, 26, 78, 22332 }, // Ằ
+    { 15, 26, 16, 0, 25, 70, 22410 }, // ằ
+    { 20, 26, 19, -2, 26, 81, 22480 }, // Ẳ
+    { 15, 26, 16, 0, 25, 77, 22561 }, // ẳ
+    { 20, 26, 19, -2, 26, 79, 22638 }, // Ẵ
+    { 15, 25, 16, 0, 24, 71, 22717 }, // ẵ
+    { 20, 30, 19, -2, 24, 84, 22788 }, // Ặ
+    { 15, 26, 16, 0, 20, 68, 22872 }, // ặ
+    { 17, 24, 17, -1, 18, 68, 22940 }, // Ẹ
+    { 12, 20, 13, 0, 14, 43, 23008 }, // ẹ
+    { 17, 26, 17, -1, 26, 76, 23051 }, // Ẻ
+    { 12, 23, 13, 0, 22, 53, 23127 }, // ẻ
+    { 17, 24, 17, -1, 24, 72, 23180 }, // Ẽ
+    { 13, 21, 14, 0, 20, 49, 23252 }, // ẽ
+    { 19, 26, 19, -1, 26, 83, 23301 }, // Ế
+    { 16, 26, 17, 0, 25, 64, 23384 }, // ế
+    { 17, 26, 17, -1, 26, 82, 23448 }, // Ề
+    { 13, 26, 14, 0, 25, 60, 23530 }, // ề
+    { 19, 26, 19, -1, 26, 85, 23590 }, // Ể
+    { 16, 26, 17, 0, 25, 69, 23675 }, // ể
+    { 17, 26, 17, -1, 26, 81, 23744 }, // Ễ
+    { 13, 25, 14, 0, 24, 62, 23825 }, // ễ
+    { 17, 31, 17, -1, 25, 86, 23887 }, // Ệ
+    { 12, 27, 13, 0, 21, 58, 23973 }, // ệ
+    { 12, 26, 12, -1, 26, 52, 24031 }, // Ỉ
+    { 10, 23, 11, 0, 22, 42, 24083 }, // ỉ
+    { 12, 24, 12, -1, 18, 44, 24125 }, // Ị
+    { 9, 26, 10, 0, 20, 39, 24169 }, // ị
+    { 18, 24, 19, 0, 18, 68, 24208 }, // Ọ
+    { 13, 20, 14, 0, 14, 49, 24276 }, // ọ
+    { 18, 27, 19, 0, 26, 79, 24325 }, // Ỏ
+    { 13, 23, 14, 0, 22, 57, 24404 }, // ỏ
+    { 19, 27, 20, 0, 26, 86, 24461 }, // Ố
+    { 17, 26, 18, 0, 25, 70, 24547 }, // ố
+    { 18, 27, 19, 0, 26, 85, 24617 }, // Ồ
+    { 14, 26, 15, 0, 25, 65, 24702 }, // ồ
+    { 19, 27, 20, 0, 26, 90, 24767 }, // Ổ
+    { 17, 26, 18, 0, 25, 73, 24857 }, // ổ
+    { 18, 27, 19, 0, 26, 82, 24930 }, // Ỗ
+    { 14, 25, 15, 0, 24, 67, 25012 }, // ỗ
+    { 18, 31, 19, 0, 25, 86, 25079 }, // Ộ
+    { 13, 27, 14, 0, 21, 64, 25165 }, // ộ
+    { 21, 26, 22, 0, 25, 80, 25229 }, // Ớ
+    { 16, 23, 17, 0, 22, 58, 25309 }, // ớ
+    { 21, 26, 22, 0, 25, 81, 25367 }, // Ờ
+    { 16, 22, 17, 0, 21, 57, 25448 }, // ờ
+    { 21, 27, 22, 0, 26, 87, 25505 }, // Ở
+    { 16, 23, 17, 0, 22, 65, 25592 }, // ở
+    { 21, 25, 22, 0, 24, 81, 25657 }, // Ỡ
+    { 16, 21, 17, 0, 20, 59, 25738 }, // ỡ
+    { 21, 27, 22, 0, 21, 81, 25797 }, // Ợ
+    { 16, 22, 17, 0, 16, 56, 25878 }, // ợ
+    { 19, 24, 22, 2, 18, 72, 25934 }, // Ụ
+    { 15, 20, 16, 0, 14, 55, 26006 }, // ụ
+    { 19, 27, 22, 2, 26, 82, 26061 }, // Ủ
+    { 15, 23, 16, 0, 22, 65, 26143 }, // ủ
+    { 22, 26, 25, 2, 25, 82, 26208 }, // Ứ
+    { 18, 23, 19, 0, 22, 65, 26290 }, // ứ
+    { 22, 26, 25, 2, 25, 82, 26355 }, // Ừ
+    { 18, 22, 19, 0, 21, 63, 26437 }, // ừ
+    { 22, 27, 25, 2, 26, 88, 26500 }, // Ử
+    { 18, 23, 19, 0, 22, 71, 26588 }, // ử
+    { 22, 25, 25, 2, 24, 83, 26659 }, // Ữ
+    { 18, 21, 19, 0, 20, 67, 26742 }, // ữ
+    { 22, 27, 25, 2, 21, 83, 26809 }, // Ự
+    { 18, 22, 19, 0, 16, 62, 26892 }, // ự
+    { 18, 25, 20, 1, 25, 66, 26954 }, // Ỳ
+    { 17, 27, 14, -4, 21, 69, 27020 }, // ỳ
+    { 18, 24, 20, 1, 18, 63, 27089 }, // Ỵ
+    { 17, 20, 14, -4, 14, 60, 27152 }, // ỵ
+    { 18, 26, 20, 1, 26, 70, 27212 }, // Ỷ
+    { 17, 28, 14, -4, 22, 76, 27282 }, // ỷ
+    { 18, 24, 20, 1, 24, 68, 27358 }, // Ỹ
+    { 17, 26, 14, -4, 20, 70, 27426 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 27496 }, //  
+    { 0, 0, 25, 0, 0, 0, 27496 }, //  
+    { 0, 0, 13, 0, 0, 0, 27496 }, //  
+    { 0, 0, 25, 0, 0, 0, 27496 }, //  
+    { 0, 0, 8, 0, 0, 0, 27496 }, //  
+    { 0, 0, 6, 0, 0, 0, 27496 }, //  
+    { 0, 0, 4, 0, 0, 0, 27496 }, //  
+    { 0, 0, 16, 0, 0, 0, 27496 }, //  
+    { 0, 0, 8, 0, 0, 0, 27496 }, //  
+    { 0, 0, 5, 0, 0, 0, 27496 }, //  
+    { 0, 0, 1, 0, 0, 0, 27496 }, //  
+    { 0, 0, 1, 0, 0, 0, 27496 }, // ​
+    { 2, 21, 2, -1, 15, 20, 27496 }, // ‌
+    { 6, 23, 4, -3, 17, 33, 27516 }, // ‍
+    { 8, 24, 5, -4, 18, 35, 27549 }, // ‎
+    { 8, 24, 5, -4, 18, 35, 27584 }, // ‏
+    { 8, 3, 10, 1, 8, 5, 27619 }, // ‐
+    { 8, 3, 10, 1, 8, 5, 27624 }, // ‑
+    { 13, 3, 16, 1, 10, 11, 27629 }, // ‒
+    { 13, 3, 14, 0, 8, 11, 27640 }, // –
+    { 25, 3, 26, 0, 8, 19, 27651 }, // —
+    { 25, 3, 26, 0, 8, 19, 27670 }, // ―
+    { 9, 26, 13, 2, 20, 68, 27689 }, // ‖
+    { 13, 7, 14, 0, -1, 22, 27757 }, // ‗
+    { 6, 9, 9, 2, 19, 13, 27779 }, // ‘
+    { 6, 9, 8, 1, 19, 13, 27792 }, // ’
+    { 6, 9, 8, 0, 4, 11, 27805 }, // ‚
+    { 6, 9, 8, 1, 19, 14, 27816 }, // ‛
+    { 11, 9, 14, 2, 19, 25, 27830 }, // “
+    { 12, 9, 14, 1, 19, 24, 27855 }, // ”
+    { 11, 9, 13, 0, 4, 22, 27879 }, // „
+    { 11, 9, 13, 1, 19, 28, 27901 }, // ‟
+    { 11, 17, 13, 1, 18, 27, 27929 }, // †
+    { 13, 20, 13, -1, 18, 47, 27956 }, // ‡
+    { 7, 7, 8, 0, 10, 10, 28003 }, // •
+    { 9, 9, 16, 3, 13, 18, 28013 }, // ‣
+    { 5, 5, 7, 1, 4, 8, 28031 }, // ․
+    { 11, 5, 13, 1, 4, 15, 28039 }, // ‥
+    { 21, 5, 25, 2, 4, 21, 28054 }, // …
+    { 5, 5, 7, 1, 9, 6, 28075 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 28081 }, //  
+    { 0, 0, 1, 0, 0, 0, 28081 }, //  
+    { 8, 24, 5, -4, 18, 33, 28081 }, // ‪
+    { 8, 24, 5, -4, 18, 34, 28114 }, // ‫
+    { 8, 24, 5, -4, 18, 40, 28148 }, // ‬
+    { 11, 24, 7, -5, 18, 55, 28188 }, // ‭
+    { 11, 24, 7, -5, 18, 54, 28243 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 28297 }, //  
+    { 33, 21, 35, 1, 19, 129, 28297 }, // ‰
+    { 6, 9, 7, 0, 18, 13, 28426 }, // ′
+    { 11, 9, 12, 0, 18, 25, 28439 }, // ″
+    { 17, 9, 18, 0, 18, 38, 28464 }, // ‴
+    { 6, 9, 7, 0, 18, 13, 28502 }, // ‵
+    { 12, 9, 13, 0, 18, 26, 28515 }, // ‶
+    { 17, 9, 18, 0, 18, 39, 28541 }, // ‷
+    { 11, 6, 13, 1, 0, 14, 28580 }, // ‸
+    { 9, 11, 10, 0, 12, 16, 28594 }, // ‹
+    { 8, 11, 9, 0, 12, 16, 28610 }, // ›
+    { 16, 18, 17, 0, 17, 70, 28626 }, // ※
+    { 15, 20, 17, 1, 19, 60, 28696 }, // ‼
+    { 13, 3, 14, 0, 21, 11, 28756 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 28767 }, // ⁃
+    { 17, 21, 13, -5, 19, 42, 28772 }, // ⁄
+    { 18, 20, 21, 2, 19, 62, 28814 }, // ⁇
+    { 16, 20, 19, 2, 19, 60, 28876 }, // ⁈
+    { 17, 20, 19, 1, 19, 59, 28936 }, // ⁉
+    { 15, 6, 25, 5, 10, 19, 28995 }, // ⁓
+    { 23, 9, 24, 0, 18, 50, 29014 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 29064 }, //  
+    { 0, 0, 1, 0, 0, 0, 29064 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 29064 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 29064 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 29064 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 29064 }, // ⁤
+    { 11, 12, 12, 0, 21, 34, 29064 }, // ⁰
+    { 11, 12, 12, 0, 21, 28, 29098 }, // ⁴
+    { 11, 13, 12, 0, 21, 25, 29126 }, // ⁵
+    { 10, 12, 12, 1, 21, 31, 29151 }, // ⁶
+    { 9, 13, 12, 2, 21, 25, 29182 }, // ⁷
+    { 11, 12, 12, 0, 21, 33, 29207 }, // ⁸
+    { 11, 12, 12, 0, 21, 29, 29240 }, // ⁹
+    { 11, 10, 14, 2, 18, 28, 29269 }, // ⁿ
+    { 11, 12, 12, 0, 8, 35, 29297 }, // ₀
+    { 8, 13, 11, 1, 9, 23, 29332 }, // ₁
+    { 11, 12, 12, 0, 8, 25, 29355 }, // ₂
+    { 9, 12, 11, 1, 8, 26, 29380 }, // ₃
+    { 11, 12, 12, 0, 8, 26, 29406 }, // ₄
+    { 11, 12, 12, 0, 8, 27, 29432 }, // ₅
+    { 10, 12, 12, 1, 8, 29, 29459 }, // ₆
+    { 9, 12, 12, 2, 8, 25, 29488 }, // ₇
+    { 11, 12, 12, 0, 8, 31, 29513 }, // ₈
+    { 11, 12, 12, 0, 8, 29, 29544 }, // ₉
+    { 17, 18, 17, -1, 18, 47, 29573 }, // ₣
+    { 17, 19, 17, -1, 18, 61, 29620 }, // ₤
+    { 33, 19, 34, 0, 18, 103, 29681 }, // ₧
+    { 18, 19, 18, -1, 18, 52, 29784 }, // €
+    { 17, 12, 25, 4, 15, 28, 29836 }, // ←
+    { 13, 17, 25, 6, 17, 32, 29864 }, // ↑
+    { 17, 12, 25, 4, 15, 29, 29896 }, // →
+    { 13, 17, 25, 6, 17, 31, 29925 }, // ↓
+    { 17, 11, 25, 4, 14, 37, 29956 }, // ↔
+    { 11, 17, 25, 7, 17, 36, 29993 }, // ↕
+    { 13, 18, 25, 6, 18, 41, 30029 }, // ↨
+    { 11, 18, 25, 7, 18, 38, 30070 }, // ↲
+    { 11, 18, 25, 7, 18, 36, 30108 }, // ↳
+    { 15, 14, 25, 5, 16, 40, 30144 }, // ↵
+    { 17, 15, 25, 4, 16, 42, 30184 }, // ⇐
+    { 15, 17, 25, 5, 17, 59, 30226 }, // ⇑
+    { 17, 15, 25, 4, 16, 42, 30285 }, // ⇒
+    { 15, 17, 25, 5, 17, 63, 30327 }, // ⇓
+    { 17, 13, 25, 4, 15, 40, 30390 }, // ⇔
+    { 18, 19, 25, 3, 18, 58, 30430 }, // ∀
+    { 13, 21, 16, 1, 20, 53, 30488 }, // ∂
+    { 13, 18, 25, 6, 18, 53, 30541 }, // ∃
+    { 19, 21, 25, 3, 19, 76, 30594 }, // ∅
+    { 17, 18, 18, 0, 18, 50, 30670 }, // ∆
+    { 17, 19, 25, 4, 18, 58, 30720 }, // ∇
+    { 17, 18, 25, 4, 18, 57, 30778 }, // ∈
+    { 17, 23, 25, 4, 20, 70, 30835 }, // ∉
+    { 17, 15, 25, 4, 16, 52, 30905 }, // ∊
+    { 17, 18, 25, 4, 18, 56, 30957 }, // ∋
+    { 17, 23, 25, 4, 20, 69, 31013 }, // ∌
+    { 17, 15, 25, 4, 16, 52, 31082 }, // ∍
+    { 21, 22, 22, 0, 18, 70, 31134 }, // ∏
+    { 16, 23, 17, 0, 18, 63, 31204 }, // ∑
+    { 12, 3, 16, 2, 10, 15, 31267 }, // −
+    { 15, 20, 15, -1, 18, 40, 31282 }, // ∕
+    { 13, 20, 14, 0, 18, 38, 31322 }, // ∖
+    { 12, 13, 16, 2, 15, 35, 31360 }, // ∗
+    { 10, 10, 16, 3, 13, 24, 31395 }, // ∘
+    { 6, 5, 16, 5, 9, 7, 31419 }, // ∙
+    { 17, 24, 17, -1, 21, 63, 31426 }, // √
+    { 13, 10, 16, 1, 13, 31, 31489 }, // ∝
+    { 16, 10, 17, 0, 13, 41, 31520 }, // ∞
+    { 17, 18, 25, 4, 18, 32, 31561 }, // ∟
+    { 19, 18, 25, 3, 18, 41, 31593 }, // ∠
+    { 4, 26, 13, 4, 20, 28, 31634 }, // ∣
+    { 9, 26, 13, 2, 20, 68, 31662 }, // ∥
+    { 18, 18, 25, 4, 18, 52, 31730 }, // ∧
+    { 18, 18, 25, 4, 18, 54, 31782 }, // ∨
+    { 15, 18, 25, 5, 18, 59, 31836 }, // ∩
+    { 15, 19, 25, 5, 18, 64, 31895 }, // ∪
+    { 15, 26, 16, 0, 20, 56, 31959 }, // ∫
+    { 17, 15, 25, 4, 14, 32, 32015 }, // ∴
+    { 17, 15, 25, 4, 14, 32, 32047 }, // ∵
+    { 6, 15, 8, 1, 16, 17, 32079 }, // ∶
+    { 17, 15, 25, 4, 14, 36, 32096 }, // ∷
+    { 15, 6, 25, 5, 10, 19, 32132 }, // ∼
+    { 15, 15, 25, 5, 16, 48, 32151 }, // ≅
+    { 13, 11, 16, 1, 14, 33, 32199 }, // ≈
+    { 15, 10, 25, 5, 12, 32, 32232 }, // ≍
+    { 12, 13, 16, 2, 15, 32, 32264 }, // ≠
+    { 15, 13, 25, 5, 14, 38, 32296 }, // ≡
+    { 12, 15, 16, 2, 15, 34, 32334 }, // ≤
+    { 12, 16, 16, 2, 16, 35, 32368 }, // ≥
+    { 21, 13, 25, 2, 15, 46, 32403 }, // ≪
+    { 21, 13, 25, 2, 15, 46, 32449 }, // ≫
+    { 17, 15, 25, 4, 16, 45, 32495 }, // ⊃
+    { 17, 23, 25, 4, 20, 67, 32540 }, // ⊄
+    { 17, 23, 25, 4, 20, 65, 32607 }, // ⊅
+    { 17, 18, 25, 4, 18, 60, 32672 }, // ⊆
+    { 17, 18, 25, 4, 18, 61, 32732 }, // ⊇
+    { 19, 19, 25, 3, 18, 92, 32793 }, // ⊕
+    { 19, 19, 25, 3, 18, 77, 32885 }, // ⊖
+    { 19, 19, 25, 3, 18, 79, 32962 }, // ⊗
+    { 19, 19, 25, 3, 18, 75, 33041 }, // ⊘
+    { 15, 18, 25, 5, 18, 33, 33116 }, // ⊥
+    { 6, 5, 16, 5, 9, 7, 33149 }, // ⋅
+    { 23, 5, 25, 1, 9, 22, 33156 }, // ⋯
+    { 25, 24, 26, 0, 21, 101, 33178 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
@@ -3772,4 +2849,5 @@ static const EpdFontData bookerly_12_bolditalic = {
     27,
     -7,
     true,
+    true,
 };
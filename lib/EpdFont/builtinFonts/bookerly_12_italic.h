@@ -2,3479 +2,2723 @@
  * generated by fontconvert.py
  * name: bookerly_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_italicBitmaps[44577] = {
-    0x00, 0x14, 0x03, 0xD0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x02, 0xD0, 0x0B, 0x00,
-    0x3C, 0x00, 0xE0, 0x03, 0x80, 0x1D, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xF8, 0x07,
-    0xC0, 0x04, 0x00, 0x0A, 0x07, 0x0B, 0x87, 0xC3, 0xD2, 0xE0, 0xF0, 0xB4, 0x38, 0x3C, 0x0D, 0x0E,
-    0x07, 0x03, 0x41, 0x40, 0x40, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0D, 0x03, 0x80, 0x00, 0x1D, 0x03,
-    0x40, 0x00, 0x2C, 0x0B, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x05, 0xB9, 0x5F, 0x54, 0x00, 0x74, 0x0D,
-    0x00, 0x00, 0xB0, 0x1C, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x15, 0xF5, 0x7D, 0x50, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xC0, 0x74, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x40, 0xE0,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x6F, 0x40,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xE1, 0xDF, 0xC0, 0x0F, 0x0B, 0x0F, 0x40, 0x7C, 0x38, 0x3C, 0x01,
-    0xF0, 0xD0, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1D, 0xFC, 0x00, 0x40, 0xB0, 0xF8, 0x0F, 0x03, 0x83, 0xE0, 0x3D, 0x0D, 0x0F,
-    0x80, 0xFC, 0x70, 0xBC, 0x01, 0xFF, 0xEF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xF0, 0x00,
-    0xB8, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x02, 0xC0, 0x0B, 0x80, 0x02, 0xC0, 0x2D, 0x01, 0xF0, 0x00,
-    0x3C, 0x02, 0xC0, 0x3C, 0x00, 0x03, 0x80, 0x3C, 0x0B, 0x40, 0x00, 0x78, 0x03, 0x81, 0xE0, 0x00,
-    0x03, 0xC0, 0xF0, 0x3C, 0x0B, 0xF4, 0x3E, 0x7D, 0x0F, 0x03, 0xD7, 0xC0, 0xFF, 0x42, 0xD0, 0xF0,
-    0x2D, 0x00, 0x00, 0x78, 0x1D, 0x01, 0xD0, 0x00, 0x0F, 0x03, 0xC0, 0x1D, 0x00, 0x03, 0xC0, 0x3C,
-    0x02, 0xC0, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00, 0x1F, 0x00, 0x3C, 0x0B, 0x40, 0x03, 0xC0, 0x03,
-    0xD1, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x0A, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3E,
-    0xBC, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x00, 0x07, 0x81,
-    0xE0, 0x00, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x10, 0x00, 0xBB, 0xE0, 0x00, 0x1C, 0x00, 0x3F, 0x80,
-    0x00, 0x6F, 0x00, 0x7F, 0x80, 0x1B, 0xFE, 0x00, 0x79, 0xF0, 0x3F, 0xF4, 0x00, 0x38, 0x3D, 0x1E,
-    0x74, 0x00, 0x3C, 0x07, 0xC0, 0x2C, 0x00, 0x0F, 0x00, 0xF8, 0x0F, 0x00, 0x03, 0x80, 0x0F, 0x8B,
-    0x40, 0x00, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFE, 0xFF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFE, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x2E, 0x3D, 0x3C, 0x38, 0x34, 0x70, 0x50, 0x00, 0x00, 0x20, 0x00, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00,
-    0x1E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00,
-    0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x20, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0x8B, 0x01, 0xFB, 0x80, 0x07, 0xEF, 0x42,
-    0xFA, 0xD7, 0xDE, 0x00, 0x92, 0xC0, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x15, 0x7D, 0x55, 0xFF, 0xFF, 0xF1, 0x57, 0xD5, 0x40, 0x0F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x2E, 0x03, 0xD0,
-    0x78, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x00, 0x2E, 0x7F, 0x7D,
-    0x10, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x02,
-    0xFE, 0xFF, 0x00, 0x3F, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xF0, 0xBC, 0x00,
-    0x0F, 0xC3, 0xD0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x1F,
-    0x0F, 0x40, 0x00, 0xFC, 0x3D, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x2F, 0x03, 0xE0, 0x01, 0xF0, 0x0F,
-    0xD0, 0x2F, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBC, 0x02, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x1F,
-    0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x1B, 0xFE, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x1F, 0x80, 0x7F, 0x03, 0xD0, 0x03, 0xF0, 0x18, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x02, 0xF9, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0xBF, 0xBF, 0xC0, 0x1F, 0x40, 0x7D, 0x02, 0xC0, 0x03, 0xD0, 0x04, 0x00, 0x7C,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x25,
-    0xBF, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0xC0, 0x6B, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF7,
-    0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0xF4, 0x0F, 0x00,
-    0x0F, 0x80, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0xBF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0x6F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0xAB, 0xFF, 0x00, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE4,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xFA, 0xA4, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xF8, 0x06, 0xF8, 0x03, 0xD0, 0x03, 0xF0, 0x1F, 0x00,
-    0x0B, 0xC0, 0x7C, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x03, 0xD0, 0x0F, 0xC0, 0x3F,
-    0x00, 0x1F, 0xEB, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0xBC, 0x78, 0x00, 0x7C, 0x1C, 0x00, 0x7C,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0xBE, 0x6F, 0xC0, 0x2F, 0x00, 0x7C, 0x03, 0xD0, 0x03, 0xC0, 0x3D, 0x00, 0x7C,
-    0x03, 0xE0, 0x0F, 0x40, 0x2F, 0x87, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xE3,
-    0xF8, 0x01, 0xF0, 0x0B, 0xD0, 0x3D, 0x00, 0x3F, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x3E, 0x0B,
-    0xD0, 0x0F, 0xC0, 0x3F, 0xEF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFA, 0xFC, 0x00, 0x7E, 0x01, 0xF8, 0x03, 0xE0, 0x02,
-    0xF0, 0x0F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x03, 0xE0,
-    0x0F, 0xE4, 0x5F, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x06, 0xAB, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x16, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0xC0, 0x7D, 0x00, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x78,
-    0x00, 0x7C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07,
-    0xF8, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xA9, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF8,
-    0x00, 0x3F, 0x80, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0xFC, 0x3E, 0xBE,
-    0x10, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x3C, 0x00,
-    0x7E, 0x40, 0x3F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xF9, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x3D, 0x00, 0xBE, 0x28, 0x0F, 0x02, 0xD0, 0x0F, 0xFF, 0xD0, 0x2D, 0x0F, 0x00,
-    0xF4, 0x1F, 0x00, 0xB4, 0xB4, 0x07, 0x80, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x01, 0xD0, 0x0F, 0x0F,
-    0x00, 0xF0, 0x0B, 0x00, 0x78, 0x78, 0x07, 0x80, 0x3C, 0x03, 0xC1, 0xE0, 0x2E, 0x03, 0xF0, 0x2E,
-    0x07, 0x80, 0x7C, 0x3B, 0xC2, 0xF0, 0x1E, 0x01, 0xFF, 0xCF, 0xFE, 0x00, 0x7C, 0x02, 0xF8, 0x1F,
-    0x90, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x80, 0x00, 0x03, 0xF9, 0x41, 0x6F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1,
-    0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D,
-    0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03,
-    0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x06, 0xA9, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x7C, 0x00,
-    0x2E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0xBE, 0xBF, 0xE0, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xB8, 0x01,
-    0xF0, 0x00, 0xF8, 0x02, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0x03, 0xE0, 0x1B, 0xFA, 0xBF, 0x80, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F,
-    0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0, 0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F,
-    0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4, 0x5F, 0xF4, 0x00, 0x07, 0xC0,
-    0x07, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x2F,
-    0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x1B, 0xFA, 0xBF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0x69, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFE, 0x5A, 0xFC, 0x03, 0xF0, 0x00, 0x3C, 0x0F,
-    0xC0, 0x00, 0x38, 0x1F, 0x00, 0x00, 0x30, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xFD, 0xF8, 0x00, 0x06, 0xF8, 0xFC,
-    0x00, 0x00, 0xF0, 0xBC, 0x00, 0x01, 0xF0, 0x7F, 0x00, 0x02, 0xE0, 0x3F, 0xC0, 0x03, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55,
-    0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00,
-    0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x55,
-    0x54, 0x03, 0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0xBE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x55, 0x50, 0x15,
-    0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x00,
-    0x3D, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x1F,
-    0x80, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0xFF,
-    0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0,
-    0x2F, 0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x01, 0x55, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xEE, 0x00, 0x3D, 0xF0, 0x00, 0x01,
-    0xEB, 0x80, 0x2D, 0xBC, 0x00, 0x00, 0xB5, 0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x7C, 0x0B, 0x0B,
-    0x80, 0x00, 0x1E, 0x0F, 0x03, 0x82, 0xE0, 0x00, 0x0B, 0x43, 0xD3, 0xC0, 0xF4, 0x00, 0x03, 0xC0,
-    0xF9, 0xE0, 0x3D, 0x00, 0x00, 0xF0, 0x2E, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x07, 0xF4, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0A,
-    0x00, 0x1F, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xE4, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0x80,
-    0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x00,
-    0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B, 0x40, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0x00,
-    0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C, 0x00, 0x03, 0xC0, 0x3E, 0x1E, 0x00, 0x01,
-    0xF0, 0x07, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0, 0x00, 0x2D, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
-    0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F,
-    0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00,
-    0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07,
-    0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42,
-    0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xBD, 0xAF, 0x80, 0x00, 0xFF, 0xF9,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x69,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x00, 0x0F, 0xC0, 0x01,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x01,
-    0xF4, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0xA9, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x19, 0xF4, 0x6F, 0x40, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x7C, 0x1F,
-    0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x1B,
-    0xF9, 0x02, 0xFC, 0x1F, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00,
-    0x2F, 0xFF, 0xD0, 0x2F, 0x45, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0xC0, 0x0B, 0x02, 0xF0, 0x01, 0x40,
-    0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF0, 0x20, 0x00, 0x7D, 0x1D, 0x00, 0x0F, 0x4B, 0x40, 0x07, 0xC2, 0xF0, 0x03, 0xE0,
-    0xBF, 0xAB, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF,
-    0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02,
-    0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0,
-    0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00,
-    0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x55, 0x50, 0xFF, 0xF8, 0x0B, 0xFF, 0xC0, 0xBE, 0x00,
-    0x07, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x80, 0x03, 0xC0,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x7C, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0xF0,
-    0x00, 0x00, 0x02, 0xD7, 0x80, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x00, 0x00, 0x01, 0x55, 0x4B, 0xFF, 0xC0, 0x1E, 0x00, 0x7F, 0xFC, 0x1F, 0xD0, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xF0, 0x01, 0xF0, 0x00,
-    0xF8, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x2E, 0xF0, 0x03, 0xC0, 0x00, 0xB8, 0x03, 0xCF,
-    0x00, 0xB4, 0x00, 0x0B, 0xC0, 0xB4, 0xF4, 0x0F, 0x00, 0x00, 0xBC, 0x0F, 0x0F, 0x42, 0xD0, 0x00,
-    0x07, 0xC2, 0xD0, 0xF4, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x0B, 0x87, 0x40, 0x00, 0x07, 0xCB, 0x40,
-    0xB8, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x07, 0x9D, 0x00, 0x00, 0x03, 0xED, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x05, 0x54,
-    0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00,
-    0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x02, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0xE4, 0x01, 0xFF, 0x80,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x15, 0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42, 0xFF, 0xD1, 0xFD, 0x00,
-    0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x1F,
-    0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0,
-    0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00,
-    0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x02, 0xFD, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78,
-    0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xBE, 0x40, 0x0B, 0xF4, 0x00, 0x3C, 0x00, 0x02, 0xC0, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
-    0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x02,
-    0xFD, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
-    0xB4, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x6B, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x02, 0xDF, 0x00, 0x03, 0xC7, 0x80, 0x07, 0x83, 0xC0, 0x0F, 0x02, 0xD0, 0x1F, 0x00, 0xF0,
-    0x2D, 0x00, 0xF4, 0x3C, 0x00, 0x78, 0xB8, 0x00, 0x3C, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0D, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03,
-    0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07,
-    0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x07, 0xC2, 0xF8, 0x02, 0xD3, 0xFF, 0x40, 0xB7, 0xC3, 0xE0, 0x3E, 0xC0,
-    0xBC, 0x0F, 0xC0, 0x2F, 0x07, 0xD0, 0x0B, 0x82, 0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF0, 0x3C, 0x00,
-    0x7C, 0x1F, 0x00, 0x3D, 0x0B, 0x80, 0x3E, 0x03, 0xFE, 0xBE, 0x01, 0xFB, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E, 0x00, 0x03, 0xC0,
-    0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x4B, 0xC0, 0x78,
-    0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x6B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x00, 0x02, 0xF9, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x7D, 0x0B, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0,
-    0x03, 0xC0, 0x3C, 0x00, 0x78, 0x07, 0x80, 0x0B, 0x80, 0xB4, 0x01, 0xF4, 0x0F, 0x40, 0x3F, 0x00,
-    0xF4, 0x0B, 0xF0, 0x4F, 0xC2, 0xCF, 0x3C, 0xBF, 0xF4, 0xFF, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0,
-    0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF, 0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04,
-    0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x3C, 0x08, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xC1, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0xD0, 0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x7C,
-    0x07, 0x80, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0xF4, 0x3D, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0xBE, 0xBF, 0xC0, 0x01, 0xF4, 0x02, 0xFC,
-    0x00, 0xF4, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x78, 0x1F, 0xD0, 0x02, 0xD2, 0xFF, 0x80, 0x0F, 0x2E, 0x2F, 0x00, 0x3D, 0xD0, 0xB8, 0x01,
-    0xFD, 0x03, 0xD0, 0x0B, 0xF0, 0x0F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0,
-    0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10, 0xB8, 0x00, 0xF3, 0xC3, 0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F,
-    0x40, 0x3C, 0x11, 0xF3, 0xCB, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xD0, 0x00, 0xE6, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x0F, 0xF4, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC2, 0xF8, 0x03, 0xDF, 0xBD, 0x07, 0xF4, 0x2D, 0x0B, 0xD0, 0x3D,
-    0x0F, 0x80, 0xB8, 0x0F, 0x07, 0xF0, 0x1F, 0xBF, 0x40, 0x2F, 0xF8, 0x00, 0x3D, 0x7C, 0x00, 0x3C,
-    0x3E, 0x00, 0x7C, 0x1F, 0x80, 0x78, 0x0B, 0xF9, 0xB4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x7F, 0xC1, 0xAF, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x2D, 0x00,
-    0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x12, 0xE7, 0x8F, 0xFC, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x40, 0xBE, 0x0B, 0xFC, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x1E, 0x3D, 0x7C, 0xF5, 0xF0, 0x0B, 0xBC, 0x1E, 0xF0, 0x3C, 0x03, 0xFC, 0x0B,
-    0xF0, 0x1F, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0x80, 0x3E, 0x00, 0xFC, 0x03, 0xD0, 0x1F, 0x00, 0x3D,
-    0x00, 0xF0, 0x0B, 0x80, 0x1F, 0x00, 0x78, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x10, 0xF0, 0x03, 0xC0,
-    0x0F, 0x6D, 0x7C, 0x00, 0xF0, 0x03, 0xFE, 0x2E, 0x00, 0x78, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF, 0xC3, 0xFF, 0x00, 0x78, 0xF4, 0xF4,
-    0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00,
-    0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0, 0x0F, 0x5D, 0x7C, 0x00, 0xFF, 0x8B,
-    0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8,
-    0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4,
-    0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x07, 0xF0, 0x02, 0xFE, 0x2F, 0xFC,
-    0x00, 0x1E, 0x78, 0xBC, 0x00, 0x2E, 0xD0, 0x3D, 0x00, 0x3F, 0x80, 0x3C, 0x00, 0x3F, 0x00, 0x3C,
-    0x00, 0x3D, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x02, 0xE0,
-    0x00, 0xF4, 0x07, 0xC0, 0x01, 0xFF, 0xBF, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x2F, 0x02,
-    0xF8, 0x1F, 0x00, 0x3D, 0x0F, 0x40, 0x0F, 0x03, 0xC0, 0x07, 0xC2, 0xE0, 0x02, 0xD0, 0xF4, 0x01,
-    0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x03, 0xF0, 0xB7, 0x80, 0xBF, 0xF5, 0xD0, 0x0F, 0xF0,
-    0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xCB, 0xFC, 0xBF, 0x01, 0xE7, 0xE8,
-    0x07, 0xB8, 0x00, 0x2E, 0xC0, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x02, 0xFF, 0xE0, 0x78, 0x09, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0,
-    0x00, 0x3F, 0x40, 0x00, 0xFC, 0x20, 0x07, 0xCB, 0x80, 0xB4, 0xBF, 0xAE, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF,
-    0xFD, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E,
-    0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0,
-    0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xCB, 0xFC, 0x02, 0xF0, 0x1F, 0x00, 0x7C, 0x03, 0xD0, 0x0F,
-    0x00, 0xB8, 0x07, 0x80, 0x2E, 0x03, 0xD0, 0x07, 0xC0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x78,
-    0x00, 0x0F, 0x3C, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xF0, 0x07, 0xDB, 0xFC, 0x03, 0xE0, 0x0F, 0x80,
-    0xF4, 0x0B, 0xC0, 0x3E, 0x03, 0xD0, 0x2F, 0x00, 0xF4, 0x0B, 0x80, 0xBD, 0x03, 0xC0, 0x1F, 0x03,
-    0xF4, 0x0F, 0x00, 0x3C, 0x1F, 0xE0, 0xB4, 0x00, 0xF0, 0xF7, 0x83, 0xC0, 0x03, 0xC7, 0x4F, 0x2D,
-    0x00, 0x0F, 0x3C, 0x3C, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x02,
-    0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00,
-    0xFC, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0x3E, 0x0F, 0x44, 0x00, 0x1F, 0x2D, 0x00, 0x00, 0x0F, 0xB8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1E, 0xF0,
-    0x00, 0x00, 0x78, 0xF4, 0x00, 0x10, 0xF0, 0xBC, 0x00, 0x3F, 0xC0, 0x3F, 0xF0, 0x3F, 0x40, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0,
-    0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3,
-    0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x2E, 0x40, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D, 0x5F, 0xF8, 0x2C, 0x02,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0E, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-    0xB4, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80,
-    0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x7E, 0x40, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x07, 0x40, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xD0, 0x0F, 0x00,
-    0x3C, 0x00, 0xE0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x74, 0x02, 0xC0, 0x0F,
-    0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x2E, 0x40, 0x03, 0xFC, 0x00, 0x03, 0xD0, 0x00,
-    0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-    0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0x0B, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x2B, 0xC0,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x3F, 0xF0, 0x1D, 0xBE, 0xFE, 0xBC, 0xF0,
-    0x2F, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xD0, 0x02, 0xD0, 0x03, 0xC0, 0x03,
-    0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3E, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00,
-    0x7F, 0xFD, 0x03, 0xFF, 0xFE, 0x0F, 0x8B, 0x08, 0x2E, 0x0E, 0x00, 0x3C, 0x0D, 0x00, 0xB8, 0x1C,
-    0x00, 0xF4, 0x1C, 0x00, 0xF4, 0x28, 0x00, 0xF4, 0x38, 0x00, 0xBC, 0x34, 0x08, 0x7E, 0xB0, 0xB8,
-    0x2F, 0xFF, 0xE0, 0x0B, 0xFE, 0x40, 0x00, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x07, 0xEB, 0xF0, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0,
-    0x01, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x40, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x17, 0xF5, 0x50, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x47, 0xC0, 0x01, 0x40, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xD6, 0xFF, 0xF8, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x2C, 0x07, 0x8B, 0xFD, 0xB4, 0x01, 0xFE, 0xBF, 0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x02, 0xD0, 0x07,
-    0x80, 0x03, 0xC0, 0x07, 0x40, 0x03, 0xC0, 0x0F, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x0B, 0xF5, 0xFE,
-    0x00, 0x3D, 0xBF, 0xE7, 0x80, 0x70, 0x04, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x03, 0xFF, 0xC7, 0xFE, 0x00, 0x7F, 0x80, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x0B, 0x80, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x3F,
-    0xF6, 0xFF, 0x40, 0x06, 0xBF, 0xFA, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x1A, 0xFE, 0xA8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x06, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x40,
-    0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x03, 0xC0, 0x1E, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFA, 0xFC, 0x07, 0xC0, 0x3C, 0x0F,
-    0x80, 0x38, 0x2E, 0xC0, 0x00, 0x38, 0xF0, 0x00, 0x38, 0x7C, 0x00, 0x38, 0x0F, 0x40, 0x3C, 0x03,
-    0xD0, 0x1F, 0x40, 0xF0, 0x07, 0xD0, 0x78, 0x01, 0xF8, 0x38, 0x00, 0x3D, 0x38, 0x00, 0x0F, 0x38,
-    0x10, 0x03, 0xF4, 0xB0, 0x03, 0xF0, 0xF8, 0x07, 0xC0, 0xBE, 0xAF, 0x40, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x0F, 0x83, 0xE7, 0xD1, 0xF4, 0x40, 0x10, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00,
-    0x6A, 0x01, 0xD0, 0x74, 0x0F, 0xFE, 0x02, 0xC3, 0xC0, 0xF0, 0x38, 0x07, 0x4E, 0x07, 0x40, 0x50,
-    0x0E, 0x34, 0x2C, 0x00, 0x00, 0x38, 0xD0, 0xB0, 0x00, 0x00, 0xF3, 0x42, 0xC0, 0x00, 0x03, 0x8E,
-    0x07, 0x80, 0x00, 0x0E, 0x2C, 0x0F, 0x95, 0x80, 0x74, 0x74, 0x0F, 0xFE, 0x03, 0xC0, 0xF0, 0x01,
-    0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x61, 0x40, 0x7F, 0xF4, 0x0F, 0x0F, 0x02, 0xC0, 0xF0,
-    0x3C, 0x0D, 0x03, 0x82, 0xC0, 0x78, 0x7C, 0x83, 0xFD, 0xFC, 0x2E, 0x0E, 0x00, 0x00, 0x00, 0x2A,
-    0xAB, 0x0F, 0xFF, 0xE0, 0x00, 0x2C, 0x0B, 0x00, 0x3D, 0x0F, 0x40, 0x3D, 0x0F, 0x40, 0x7E, 0x1F,
-    0x80, 0x3E, 0x0F, 0x80, 0x0F, 0xC3, 0xF0, 0x00, 0xF4, 0x3D, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xE0,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55, 0x57, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x00,
-    0x05, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD1, 0x50, 0x38, 0x28, 0x7E, 0xD0,
-    0xC3, 0x43, 0x8E, 0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30, 0x39, 0xD0, 0xA3, 0x83,
-    0xCB, 0x4D, 0x1C, 0x54, 0x16, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD, 0x00, 0x01, 0xA9, 0x00,
-    0x2A, 0xAA, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0x43, 0xE5, 0xF1, 0xE0, 0x1E,
-    0x74, 0x03, 0x9E, 0x01, 0xE3, 0xD0, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x01, 0xFF, 0xFF, 0xF2, 0xAB, 0xEA, 0x80,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC0, 0x00, 0x19, 0x00, 0x1F, 0xFD, 0x03, 0xD2, 0xF0, 0x70, 0x0F,
-    0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3F,
-    0xFF, 0xC2, 0xAA, 0xA4, 0x00, 0x64, 0x01, 0xFF, 0xC0, 0xE0, 0xF0, 0x10, 0x2C, 0x00, 0x1E, 0x00,
-    0xBE, 0x00, 0x7F, 0xC0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x1F, 0x06, 0xBF, 0x42, 0xFE, 0x00, 0x00,
-    0x00, 0x3C, 0x0F, 0xC2, 0xF0, 0x7C, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0xB0, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0xF0, 0x03, 0xD0, 0x01, 0xF0,
-    0x03, 0xC0, 0x02, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xC0, 0x0B, 0x80, 0x03, 0xC0,
-    0x0F, 0x40, 0x07, 0xC0, 0x2F, 0x40, 0x07, 0xE0, 0x7B, 0x85, 0x0B, 0xFF, 0xE3, 0xFD, 0x0F, 0xBF,
-    0x82, 0xF4, 0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFA, 0xE4, 0x00, 0xBF, 0xF5, 0xC0, 0x01, 0xFF,
-    0xF2, 0xC0, 0x03, 0xFF, 0xF3, 0x80, 0x03, 0xFF, 0xF3, 0x80, 0x03, 0xFF, 0xE3, 0x40, 0x03, 0xFF,
-    0xD7, 0x00, 0x03, 0xFF, 0xCB, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0x00, 0x6B, 0xCE, 0x00, 0x00, 0x03,
-    0x8D, 0x00, 0x00, 0x03, 0x5C, 0x00, 0x00, 0x07, 0x2C, 0x00, 0x00, 0x0B, 0x38, 0x00, 0x00, 0x0E,
-    0x34, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x2D, 0xD0, 0x00, 0x60, 0xBF, 0x40, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x18, 0xBD, 0xFC, 0xB4, 0x0A, 0x41, 0xFC, 0x03, 0xC0, 0xB4,
-    0x3E, 0x01, 0x00, 0x00, 0x20, 0x2F, 0xC1, 0xBF, 0x00, 0x78, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x00,
-    0xF0, 0x07, 0x80, 0x2D, 0x06, 0xFE, 0x2A, 0xA8, 0x00, 0x19, 0x00, 0x2F, 0xF4, 0x07, 0x83, 0xC0,
-    0xF0, 0x3C, 0x1E, 0x03, 0xC2, 0xD0, 0x78, 0x1D, 0x0F, 0x00, 0xFB, 0xD0, 0x07, 0xE4, 0x00, 0x00,
-    0x00, 0x2A, 0xAB, 0x47, 0xFF, 0xE0, 0x0A, 0x02, 0x80, 0x03, 0x80, 0xE0, 0x02, 0xE0, 0xB8, 0x00,
-    0xF8, 0x3E, 0x00, 0xFC, 0x3F, 0x02, 0xF4, 0xBD, 0x07, 0xC1, 0xF0, 0x1F, 0x07, 0xC0, 0x38, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x00,
-    0x06, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x3D, 0x07, 0x80, 0x00, 0xB0, 0x00, 0xFC,
-    0x07, 0x40, 0x01, 0xD0, 0x03, 0xFC, 0x1F, 0x90, 0x03, 0x80, 0x0F, 0x38, 0xBF, 0xF0, 0x0F, 0x00,
-    0x3C, 0x74, 0x00, 0x00, 0x2D, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x00, 0x00,
-    0xF0, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xC0, 0x01, 0x56, 0xE4, 0x00, 0x0B, 0x40, 0x00, 0x01, 0xD0,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x34, 0x00, 0x06, 0xF0,
-    0x00, 0x00, 0xB4, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x78,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x0F, 0xF8, 0x07, 0x80, 0x02, 0xC0, 0x7E, 0xBD, 0x07, 0x40,
-    0x07, 0x40, 0xB0, 0x1E, 0x1F, 0x90, 0x0E, 0x00, 0x10, 0x2D, 0xBF, 0xF0, 0x3C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xFA, 0xA8, 0x00, 0x7C,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x0B, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x0F, 0x00, 0x0F, 0xF1, 0x5B, 0xE0, 0x0B, 0x40, 0x0F, 0x38, 0xFF, 0xD0, 0x07, 0x80, 0x0F,
-    0x1D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x0F, 0x03, 0xC0, 0x00, 0x02,
-    0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x55, 0xB9, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x06, 0xF8, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x1F,
-    0x00, 0x0F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x7E, 0x6D, 0x0B, 0xFF, 0x40, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95,
-    0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C,
-    0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00,
-    0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00,
-    0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE,
-    0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3E, 0xF4, 0x00, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00,
-    0x74, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B,
-    0x80, 0x00, 0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00,
-    0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40,
-    0x01, 0xFE, 0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x8B,
-    0x00, 0x00, 0x02, 0xEF, 0xFC, 0x00, 0x00, 0x0A, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00,
-    0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00,
-    0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56,
-    0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00,
-    0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0A, 0x02, 0xC0, 0x00, 0x00,
-    0xFC, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x76, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x1D,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x3C, 0x02, 0xE0,
-    0x00, 0x03, 0xE5, 0x5B, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0x55, 0xBD, 0x00, 0x0B,
-    0x80, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x90, 0x00,
-    0x7F, 0x93, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x03, 0xC1, 0xC0, 0x00, 0x00, 0x0B, 0x0F, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x6E, 0x00,
-    0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x00,
-    0xB4, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0x3E, 0x55, 0xBC, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0x55, 0x5B, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0x3E, 0x00,
-    0x2E, 0x00, 0x00, 0xFC, 0x02, 0xF9, 0x00, 0x07, 0xF9, 0x3F, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xAA,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x38, 0x00, 0x00, 0x02, 0xDF, 0x40, 0x0D, 0x00, 0x00, 0x01,
-    0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x3F, 0xAB, 0xC0, 0x00, 0x00, 0x78, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3D, 0x57,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xF8, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x3E, 0x00, 0x0C, 0x00, 0x1E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0xC0,
-    0x07, 0x80, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xD0, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0x69, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xE5, 0xBF, 0x80, 0xFC, 0x00, 0x2D, 0x0F, 0xC0,
-    0x00, 0xB0, 0x7C, 0x00, 0x02, 0x83, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0C, 0x0F, 0xF4, 0x06, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0,
-    0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78,
-    0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x02, 0xD0, 0x0C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00,
-    0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0,
-    0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xB0, 0x2D, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA,
-    0xBC, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0B, 0xC0, 0x03, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0x00,
-    0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x06, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x40, 0x3F, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xBF, 0x80,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x1F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF4, 0x7C, 0x00, 0xF4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2C, 0x0B, 0x00, 0x3F, 0x4B, 0xD0,
-    0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x06, 0xFE, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4,
-    0x5F, 0xF4, 0x00, 0x07, 0xC0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F,
-    0xC0, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x05, 0xBD, 0x54, 0x02, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00,
-    0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00,
-    0x1B, 0xFA, 0xBF, 0xD0, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0xEF, 0xF4, 0x00, 0x00,
-    0x00, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x15, 0x54, 0x03, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0x80, 0x00, 0xB8, 0x00, 0x07,
-    0xF0, 0x00, 0x2D, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0xFB, 0xC0, 0x03, 0xC0, 0x00, 0x3C,
-    0xF8, 0x01, 0xE0, 0x00, 0x0F, 0x2F, 0x00, 0xB4, 0x00, 0x07, 0x83, 0xD0, 0x3D, 0x00, 0x02, 0xD0,
-    0xBC, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x00, 0x3C, 0x03, 0xE1, 0xE0, 0x00, 0x1F, 0x00,
-    0x7C, 0xB4, 0x00, 0x07, 0x80, 0x0F, 0xBC, 0x00, 0x02, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xBE, 0x40, 0x07, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0,
-    0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F,
-    0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0,
-    0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00,
-    0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00,
-    0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00,
-    0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x0F, 0x40, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00,
-    0xFC, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F,
-    0x5F, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00,
-    0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00,
-    0x02, 0xF0, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0xFE, 0x1C, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x2C, 0x3F, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0xB0, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x5B,
-    0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xF4, 0xF8, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x01, 0xF3, 0xE0,
-    0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0F, 0x81,
-    0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x1C, 0x7C, 0x07, 0xC1, 0xF1, 0xF0, 0x07,
-    0xFC, 0x00, 0x2F, 0x00, 0x07, 0xFC, 0x01, 0xF1, 0xF0, 0x7C, 0x07, 0xCB, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x04, 0x00, 0x01, 0xFF, 0xFE, 0x2D, 0x00, 0x0F, 0xE5, 0x6F, 0xF4,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xF0, 0x00, 0x3E, 0xF4, 0x03,
-    0xE0, 0x00, 0xF4, 0xF4, 0x07, 0xC0, 0x03, 0xC0, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xF4, 0x0F, 0x80,
-    0x3C, 0x01, 0xF0, 0x0F, 0x80, 0xF0, 0x02, 0xF0, 0x0F, 0x83, 0xC0, 0x03, 0xE0, 0x0F, 0x9F, 0x00,
-    0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF4, 0x01, 0xFC,
-    0x00, 0x1E, 0xFF, 0xAF, 0xE0, 0x00, 0x38, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55, 0x57,
-    0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00,
-    0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40, 0x2E,
-    0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E,
-    0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55,
-    0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80,
-    0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40,
-    0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00,
-    0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00,
-    0x00, 0x7D, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
-    0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F,
-    0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B,
-    0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0,
-    0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0xB0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0x83, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC,
-    0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0,
-    0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07,
-    0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F,
-    0xFD, 0x1F, 0xD0, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x3C, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBE, 0xBF, 0xC0, 0x03, 0xD0, 0x1F, 0x80,
-    0x0F, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0xBC, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x3D,
-    0x00, 0xFC, 0x00, 0xF0, 0x2F, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0x94, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xE5, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1F,
-    0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x74, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x02,
-    0xC0, 0x00, 0x00, 0xB8, 0x07, 0x40, 0x00, 0x00, 0xB4, 0x0E, 0x00, 0x00, 0x00, 0xF4, 0x1E, 0x00,
-    0x00, 0x00, 0xF0, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x0B, 0xD0, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0xCB, 0x00, 0xB4, 0x00, 0x0B, 0x8F, 0xEA, 0xE0, 0x00, 0x0F, 0x43, 0xFF, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x74, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C,
-    0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4,
-    0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87,
-    0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C, 0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F,
-    0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4, 0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF,
-    0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3D, 0xF0, 0x00, 0x3C, 0x2D, 0x00, 0x3D, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C,
-    0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4,
-    0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xC0, 0x07, 0xFE, 0xF0, 0x02, 0xC3, 0xF4,
-    0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF,
-    0x01, 0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E,
-    0x0B, 0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F,
-    0xF0, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x2F, 0x4B, 0xD0, 0x0B,
-    0xC2, 0xF0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x74, 0x0B,
-    0xFF, 0xFC, 0x07, 0xD0, 0xBE, 0x03, 0xC0, 0x0F, 0x43, 0xE0, 0x03, 0xC0, 0xF0, 0x01, 0xF0, 0x78,
-    0x00, 0xB8, 0x2D, 0x00, 0x7D, 0x0F, 0x40, 0x3F, 0x03, 0xD0, 0x2F, 0xC1, 0xFC, 0x2C, 0xF3, 0xEF,
-    0xFD, 0x3F, 0xC3, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x02, 0xFE, 0x00,
-    0x01, 0xD2, 0xC0, 0x00, 0xB0, 0x70, 0x00, 0x2C, 0x2C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C, 0x00, 0xF4,
-    0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4, 0x03, 0xF0,
-    0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0xEB, 0xD0, 0x7D,
-    0x02, 0xF0, 0x2E, 0x0F, 0x40, 0x3C, 0x03, 0xD2, 0xE0, 0x07, 0x80, 0xBC, 0x3C, 0x00, 0xF4, 0x3F,
-    0x07, 0x80, 0x1F, 0x7F, 0x80, 0xB4, 0x03, 0xFF, 0x40, 0x0F, 0x40, 0xBF, 0x00, 0x00, 0xF4, 0x0F,
-    0xF0, 0x00, 0x4F, 0x83, 0xCF, 0x40, 0xB8, 0xBF, 0xF0, 0xFF, 0xFE, 0x03, 0xF8, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xD0, 0xB8, 0x18, 0x1E,
-    0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00,
-    0x4B, 0xC0, 0x78, 0x7F, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xE0, 0x00,
-    0x1E, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xC0, 0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD,
-    0x0B, 0xAF, 0xC0, 0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF,
-    0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF, 0xC0,
-    0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x7C, 0x00,
-    0xF0, 0xB4, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x0B, 0xAF, 0xC0,
-    0xB4, 0x1F, 0x07, 0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF, 0xC0, 0x3F, 0xE4, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x14, 0x02, 0xF4, 0xBD, 0x02, 0xF0, 0xBC, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C,
-    0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFF, 0x00, 0x3C,
-    0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0xF0, 0x47, 0xCF, 0x2F, 0xF0,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x04, 0x07, 0xCF, 0x02, 0xFF,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0xE0, 0x0F, 0x7C, 0x0F,
-    0x0B, 0x4F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x0F, 0x04, 0x07, 0xCF,
-    0x02, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x42, 0xF4, 0xBD, 0x2F, 0x0B, 0xC0,
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC1, 0x00,
-    0x7C, 0xF0, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x03, 0xF2,
-    0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x7C, 0x00, 0x02, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x00, 0xBF, 0xAC, 0x01, 0xFE, 0xFF, 0x40, 0xF4, 0x0B, 0xE0, 0xF8, 0x00, 0xF8, 0x7C, 0x00,
-    0x3E, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3, 0xD0, 0x00, 0xF0, 0xF4, 0x00, 0xB8, 0x3D, 0x00,
-    0x3C, 0x0F, 0xC0, 0x3D, 0x01, 0xFE, 0xBE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x70, 0x00, 0x7F, 0xEF, 0x00, 0x0B, 0x1F, 0xD0, 0x00, 0x10, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF, 0xC3, 0xFF, 0x00, 0x78,
-    0xF4, 0xF4, 0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E, 0x00, 0xF8, 0x03, 0xD0,
-    0x1F, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0, 0x0F, 0x5D, 0x7C, 0x00,
-    0xFF, 0x8B, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E,
-    0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC,
-    0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D,
-    0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00,
-    0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x3D, 0x2D, 0x00, 0xF4, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00,
-    0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8,
-    0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE1, 0xC0, 0x07, 0xFE, 0xF0, 0x02, 0xC3, 0xF4, 0x00, 0x10, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F, 0x02,
-    0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3,
-    0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x2F, 0x4B, 0xD0, 0x0B, 0xC2, 0xF0, 0x00, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x0F, 0xC0,
-    0x7C, 0x0B, 0xC0, 0x0F, 0x43, 0xD0, 0x03, 0xE1, 0xF0, 0x00, 0xF4, 0xB8, 0x00, 0x3D, 0x3D, 0x00,
-    0x0F, 0x0F, 0x40, 0x0B, 0x83, 0xE0, 0x03, 0xC0, 0xBC, 0x03, 0xE0, 0x1F, 0xEB, 0xE0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x1C, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFC, 0x07, 0xE0, 0x02, 0xF0, 0x0B, 0xD0, 0x03, 0xD0, 0x3F,
-    0xE0, 0x07, 0xC0, 0xF3, 0xE0, 0x0B, 0x87, 0xC3, 0xD0, 0x0F, 0x5E, 0x03, 0xC0, 0x0F, 0xF8, 0x0B,
-    0x80, 0x0F, 0xD0, 0x0F, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x3F, 0xFA, 0xF8, 0x00, 0xB1, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B,
-    0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8,
-    0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00,
-    0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B,
-    0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x2D, 0x1E,
-    0x00, 0x0B, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC,
-    0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F,
-    0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x00,
-    0x07, 0xD1, 0xF4, 0x00, 0xBC, 0x2F, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B,
-    0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8,
-    0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B,
-    0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02,
-    0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01,
-    0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x82, 0xF8, 0x00, 0x2D, 0x3F, 0xF4,
-    0x00, 0xF7, 0xC3, 0xE0, 0x03, 0xEC, 0x0B, 0xC0, 0x0F, 0xC0, 0x2E, 0x00, 0x7D, 0x00, 0xB8, 0x02,
-    0xF0, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xB8, 0x01, 0xF0, 0x03, 0xC0, 0x0B, 0x80,
-    0x3E, 0x00, 0x3F, 0xEB, 0xE0, 0x00, 0xFB, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xAA, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x20, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x01, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0,
-    0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x76, 0xE0, 0x00, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x00, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x03, 0xE5, 0x5B, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xF5, 0x55, 0xBD, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x3C,
-    0x00, 0x03, 0xE0, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x90, 0x00, 0x7F, 0x93, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xC0, 0x00, 0x2A, 0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F,
-    0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F,
-    0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x01, 0xF9, 0xB8, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x03,
-    0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x95, 0x6F,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00,
-    0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE, 0x4F, 0xFF, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x07, 0xD1, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01,
-    0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B,
-    0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0,
-    0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00,
-    0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0,
-    0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8,
-    0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0,
-    0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1,
-    0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF,
-    0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x40, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xB9, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFE, 0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0,
-    0xFC, 0x00, 0x0B, 0x07, 0xC0, 0x00, 0x28, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x0B, 0xFF, 0x40, 0xB8, 0x18, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x01, 0x0B, 0xC0, 0x78, 0x1F, 0xFF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xBE,
-    0x00, 0x00, 0xF8, 0x3C, 0x00, 0x0B, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0xFE, 0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x07, 0xC0,
-    0x00, 0x28, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0xC0, 0xFF, 0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x7C, 0x00, 0xF0,
-    0xB4, 0x0F, 0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xFF, 0x40, 0xB8,
-    0x18, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xE0, 0x01, 0x0B, 0xC0, 0x78, 0x1F, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFE,
-    0x5B, 0xF8, 0x0F, 0xC0, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x07, 0xC0, 0x00, 0x28, 0x3E, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0xFF,
-    0x40, 0x6F, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x2F, 0xFD, 0x0B, 0x81, 0x81, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x80, 0x04, 0xBC, 0x07, 0x87, 0xFF, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3C, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x03, 0xF7, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xFE, 0x5B, 0xF8, 0x03, 0xF0, 0x00, 0xB4, 0x0F, 0xC0, 0x00, 0xB0,
-    0x1F, 0x00, 0x00, 0xA0, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xC0, 0x3F, 0xD0, 0x1B, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2D, 0x00, 0xF0,
-    0xB4, 0x00, 0xBA, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x02, 0xFF, 0xD0, 0x0B, 0x81, 0x80, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x40, 0xBC, 0x07,
-    0x80, 0x7F, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x2E, 0x00, 0x00, 0x0F, 0x82, 0xE0, 0x00, 0x00, 0x1F, 0x6E, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x50, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0x7D, 0x17, 0xFD, 0x00, 0x01, 0xF0, 0x01, 0xFC, 0x00, 0x0B,
-    0xC0, 0x01, 0xF8, 0x00, 0x2E, 0x00, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x06, 0xFE, 0xAF, 0xF4, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x01, 0x42, 0xD0, 0x00, 0x07, 0xFC, 0x3C, 0x00, 0x00, 0x6B, 0xC3, 0x80, 0x00, 0x00, 0x7C,
-    0x70, 0x00, 0x00, 0x0B, 0x81, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xF9, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-    0x02, 0xE0, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x07, 0x80, 0x0B, 0x80, 0x00, 0xB4, 0x01,
-    0xF4, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0xF4, 0x0B, 0xF0, 0x40, 0x0F, 0xC2, 0xCF, 0x3C, 0x00,
-    0xBF, 0xF4, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0xA9, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x19, 0xF4, 0x5F, 0xF4, 0x00, 0x07, 0xC0, 0x07,
-    0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x2F, 0x00,
-    0x0F, 0x00, 0x00, 0x7C, 0x05, 0xBD, 0x54, 0x02, 0xF0, 0x3F, 0xFF, 0xF0, 0x0B, 0xC0, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x7D,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xBE, 0x00, 0x1B, 0xFA, 0xBF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xAF, 0xE4, 0x00, 0x0A, 0xBF, 0x80,
-    0x00, 0x00, 0xF0, 0x00, 0x06, 0x93, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0xF4,
-    0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x02, 0xE0, 0x0B, 0x40, 0x1F,
-    0x40, 0x3D, 0x00, 0xFC, 0x00, 0xF4, 0x0B, 0xF0, 0x43, 0xF0, 0xB3, 0xCF, 0x0B, 0xFF, 0x4F, 0xF0,
-    0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA, 0xBC, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x0B,
-    0xC0, 0x03, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1F, 0xAA, 0xA0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x07, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x01,
-    0xE0, 0x06, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0xA8, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B,
-    0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x02, 0x40, 0x00, 0x0F, 0xDB, 0xC0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0,
-    0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07,
-    0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78,
-    0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x01,
-    0xF4, 0x7C, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40,
-    0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F,
-    0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07,
-    0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00,
-    0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFC, 0x00, 0xBA, 0xFC, 0x0B, 0x41, 0xF0, 0x78, 0x07, 0xC3, 0xC0, 0x3D, 0x1E, 0x0B, 0xD0, 0xBA,
-    0xFC, 0x03, 0xFE, 0x40, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x10, 0xFC, 0x07, 0xC1, 0xFF, 0xFD, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFA,
-    0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C,
-    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x2F, 0x90, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0, 0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF,
-    0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04, 0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF,
-    0xF0, 0x00, 0x0B, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x90, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x03, 0xC0, 0x00, 0x1F, 0x07, 0xD0, 0x00,
-    0x03, 0xF7, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xEA, 0xAB, 0xC0, 0x01, 0xF0, 0x00,
-    0xE0, 0x00, 0xBC, 0x00, 0x30, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xFA, 0xAA, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x70, 0x00, 0xBC, 0x00, 0x3C, 0x00,
-    0x3E, 0x00, 0x1E, 0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x2D, 0x00, 0xF0, 0xB4, 0x00, 0xBA, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01,
-    0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xC3, 0xD0,
-    0x00, 0x07, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00,
-    0x00, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F, 0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0xF8, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x00,
-    0x00, 0x3C, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB,
-    0x40, 0x01, 0xFA, 0xFF, 0xC0, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x01,
-    0xE0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x02,
-    0xFA, 0xFF, 0x00, 0x07, 0xD0, 0x0B, 0xF0, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x0F, 0x40,
-    0x3F, 0x40, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x04, 0x00, 0x00, 0xF0, 0x0A, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00, 0x00, 0xA0,
-    0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F, 0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0xF8, 0x00,
-    0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00,
-    0xC0, 0x00, 0x07, 0xD1, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x00, 0x07, 0xEB, 0xFF, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x3C, 0x03, 0xC0, 0x00,
-    0x0F, 0x43, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x0B, 0xEB, 0xFC, 0x00, 0x1F, 0x40, 0x2F,
-    0xC0, 0x0F, 0x40, 0x01, 0xF4, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0x96, 0xFE, 0x00, 0x7E, 0x00,
-    0x0B, 0x80, 0x7D, 0x00, 0x02, 0xD0, 0x3E, 0x00, 0x00, 0xA0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0x1F,
-    0x00, 0x01, 0x7F, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0xF4,
-    0x03, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB4,
-    0x00, 0x1F, 0xAF, 0xFC, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x1E,
-    0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x2F,
-    0xAF, 0xF0, 0x00, 0x7D, 0x00, 0xBF, 0x00, 0x3D, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0xF4, 0x03,
-    0xF4, 0x01, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0xF9, 0x6F, 0xE0, 0x07, 0xE0, 0x00, 0xB8, 0x07, 0xD0,
-    0x00, 0x2D, 0x03, 0xE0, 0x00, 0x0A, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xFF, 0xF1, 0xF0, 0x00, 0x17, 0xF0,
-    0x3D, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x3F, 0x80, 0x07,
-    0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xD0, 0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x7C, 0x07, 0x80, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x0F, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0xBE, 0xBF, 0xC0, 0x01, 0xF4, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x3D, 0x00,
-    0x03, 0xD0, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0,
-    0x2F, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7C,
-    0x3D, 0x00, 0x07, 0x80, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x06, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x07, 0x81, 0xFD, 0x00, 0x2D, 0x2F, 0xF8, 0x00, 0xF2, 0xE2, 0xF0, 0x03,
-    0xDD, 0x0B, 0x80, 0x1F, 0xD0, 0x3D, 0x00, 0xBF, 0x00, 0xF0, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x80,
-    0x2E, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xC1, 0x0B, 0x80, 0x0F, 0x3C, 0x3D, 0x00, 0x7F,
-    0xD0, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x01, 0x55, 0x40, 0x0F,
-    0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x02,
-    0xBF, 0xAA, 0xAA, 0xFE, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0A, 0xFE, 0x90, 0x00, 0x6B,
-    0xFA, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x0A, 0x80, 0x02, 0xD1, 0xFF, 0x80, 0x0F, 0x2F,
-    0x7E, 0x00, 0x3D, 0xE0, 0xB8, 0x01, 0xFE, 0x03, 0xD0, 0x0B, 0xF0, 0x0F, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x10, 0xB8, 0x00, 0xF3, 0xC3,
-    0xD0, 0x07, 0xFD, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x0F,
-    0xE1, 0xC0, 0x07, 0xFF, 0xF0, 0x02, 0xC3, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1C, 0x1F, 0xFB,
-    0xC2, 0xC3, 0xF4, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0,
-    0x00, 0x3C, 0x10, 0x07, 0xCF, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x06, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0A, 0xAA, 0x81, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x10, 0x07, 0xCF,
-    0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0E, 0x00, 0xC0,
-    0x03, 0xE6, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x03, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xBF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x1F, 0x47, 0xC0, 0xFF,
-    0xF0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x3C,
-    0x10, 0x07, 0xCF, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x03,
-    0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00, 0x0B, 0x40,
-    0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x94, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x1F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0x00,
-    0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x40, 0x3C, 0x11, 0xF3, 0xCB, 0xFC, 0x1F,
-    0xC0, 0x2C, 0x00, 0xD0, 0x0B, 0x00, 0x3E, 0x50, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x3F, 0xFE, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00,
-    0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xBF, 0x80, 0x1F, 0xFF, 0x40, 0x2F, 0xC7,
-    0xFC, 0x03, 0xC0, 0x7C, 0x0B, 0x80, 0xF4, 0x1F, 0x02, 0xF0, 0x3D, 0x03, 0xC1, 0x7C, 0xFB, 0xFC,
-    0x7E, 0x00, 0x00, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x3F, 0xFE, 0x0B, 0xFF, 0xC0, 0x01, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00,
-    0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1B, 0xF8, 0x00, 0xBC, 0x00, 0x1F, 0xFF, 0x40, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x9F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x1F, 0xC0, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x7F, 0xC0, 0x7F, 0xC0, 0x0F, 0x00,
-    0x0F, 0x00, 0x7C, 0x00, 0x7C, 0x02, 0xE0, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0x40, 0x7C, 0x00, 0x3D,
-    0x02, 0xF0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x10, 0x2E, 0x01, 0xF3, 0xC0, 0xF4, 0x0B,
-    0xFC, 0x03, 0xC0, 0x1F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0xE6, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0xF8, 0x3C, 0x00,
-    0x00, 0xB4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xEB, 0xE0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x0F, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x39, 0xBC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x50, 0x15, 0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00,
-    0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x07, 0xD0, 0x00, 0x00, 0x3D,
-    0x2F, 0x00, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-    0x00, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00,
-    0x1B, 0xF9, 0x00, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x0F, 0xF4, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xC2, 0xF8, 0x03, 0xDF, 0xBD, 0x07, 0xF4, 0x2D, 0x0B, 0xD0, 0x3D, 0x0F, 0x80,
-    0xB8, 0x0F, 0x07, 0xF0, 0x1F, 0xBF, 0x40, 0x2F, 0xF8, 0x00, 0x3D, 0x7C, 0x00, 0x3C, 0x3E, 0x00,
-    0x7C, 0x1F, 0x80, 0x78, 0x0B, 0xF9, 0xB4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x80, 0x7E, 0xBF, 0xC1, 0xFF, 0x07, 0x87, 0xD5, 0x0B, 0x5E, 0x00, 0x0F, 0x78, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xB4, 0x00, 0x2E, 0x7C, 0x00, 0x3C, 0x3D, 0x01, 0x3C,
-    0x1F, 0x4E, 0x7C, 0x0F, 0xFC, 0xB4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x0D, 0x02, 0xF0, 0x00, 0xB0, 0x0F, 0x80, 0x07, 0xC1, 0xBF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x07, 0xF4, 0x1F, 0xF8, 0x0E, 0x90,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x7F, 0xC0, 0x1A, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40,
-    0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2D, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC1, 0x02, 0xE7, 0x80, 0xFF, 0xC0, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0, 0x2F, 0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x7F, 0xC0, 0x1A, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0,
-    0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2D, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00,
-    0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC1, 0x02, 0xE7, 0x80, 0xFF, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x55, 0x54, 0x3C, 0x00, 0xFF, 0xF8, 0x78, 0x00, 0x1F, 0x80,
-    0xB0, 0x00, 0x1F, 0x00, 0xE0, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x34, 0x02, 0xF0, 0x00,
-    0xB0, 0x03, 0xE0, 0x01, 0xF0, 0x1B, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0xE0, 0x05, 0x0B, 0x47, 0xFC, 0x3C, 0x1A, 0xF0, 0xE0, 0x07, 0xC7, 0x00, 0x2E, 0x04,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC1,
-    0x00, 0x2E, 0x78, 0x00, 0xFF, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x68, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x7C, 0x01,
-    0xFC, 0x00, 0xBC, 0x00, 0x90, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x34, 0x02, 0xF0, 0x00, 0xB0, 0x03, 0xE0, 0x01, 0xF0, 0x1B, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x50, 0x01, 0xFF, 0x00, 0x1A, 0xF0, 0x00, 0x1F, 0x00, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xB4, 0x1D, 0x0F, 0x47,
-    0xF0, 0xF0, 0x7D, 0x1F, 0x01, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x10, 0x0B,
-    0x9E, 0x00, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x0A, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0xD0, 0x2F,
-    0x00, 0x0B, 0x00, 0xF8, 0x00, 0x7C, 0x1B, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x05,
-    0x00, 0x1F, 0xF0, 0x01, 0xAF, 0x00, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0xBE, 0xC0, 0x0B, 0xF4, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0x3E, 0xF0, 0x00, 0x2E,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xC1, 0x00, 0xB9, 0xE0, 0x0F, 0xFC, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x54, 0x03, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0x80,
-    0x00, 0xB8, 0x00, 0x07, 0xF0, 0x00, 0x2D, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0xFB, 0xC0,
-    0x03, 0xC0, 0x00, 0x3C, 0xF8, 0x01, 0xE0, 0x00, 0x0F, 0x2F, 0x00, 0xB4, 0x00, 0x07, 0x83, 0xD0,
-    0x3D, 0x00, 0x02, 0xD0, 0xBC, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0x43, 0xC0, 0x00, 0x3C, 0x03, 0xE1,
-    0xE0, 0x00, 0x1F, 0x00, 0x7C, 0xB4, 0x00, 0x07, 0x80, 0x0F, 0xBC, 0x00, 0x02, 0xD0, 0x01, 0xFF,
-    0x00, 0x00, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x40, 0x07, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x80, 0xBE, 0x0B, 0xFC, 0x3F, 0xF0, 0x07, 0x8F, 0x4F, 0x40, 0xBB, 0xC0,
-    0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0xFD, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x84, 0x3C, 0x00, 0xF5, 0xD7, 0xC0, 0x0F, 0xF8, 0xB8, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01, 0xFF, 0xE0, 0x02,
-    0xF8, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xF0, 0x00, 0x0F,
-    0xBC, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B, 0x40, 0x00, 0x78,
-    0x3D, 0x03, 0xD0, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C, 0x00, 0x03, 0xC0,
-    0x3E, 0x1E, 0x00, 0x01, 0xF0, 0x07, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0, 0x00, 0x2D, 0x00,
-    0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0B, 0xE0, 0xBF,
-    0xC3, 0xFF, 0x00, 0x78, 0xF4, 0xF4, 0x0B, 0xBC, 0x0F, 0x00, 0xFF, 0x01, 0xF0, 0x0F, 0xD0, 0x2E,
-    0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0x3C, 0x02, 0xE0, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x43, 0xC0,
-    0x0F, 0x5D, 0x7C, 0x00, 0xFF, 0x8B, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0xF4, 0x00, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x55, 0x00, 0xFF, 0x40, 0x07,
-    0xFF, 0x80, 0x0B, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x40, 0x00, 0xBF, 0x80, 0x03,
-    0xC0, 0x00, 0x3E, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x3E, 0x00, 0x78, 0x00, 0x03, 0xCB, 0xC0, 0x2D,
-    0x00, 0x01, 0xE0, 0xF4, 0x0F, 0x40, 0x00, 0xB4, 0x2F, 0x03, 0xC0, 0x00, 0x3C, 0x03, 0xD0, 0xF0,
-    0x00, 0x0F, 0x00, 0xF8, 0x78, 0x00, 0x07, 0xC0, 0x1F, 0x2D, 0x00, 0x01, 0xE0, 0x03, 0xEF, 0x00,
-    0x00, 0xB4, 0x00, 0x7F, 0xC0, 0x00, 0x3C, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x90, 0x01, 0xF8, 0x00,
-    0x7F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0xB4, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0xBE, 0x0B, 0xFC, 0x3F, 0xF0, 0x07, 0x8F,
-    0x4F, 0x40, 0xBB, 0xC0, 0xF0, 0x0F, 0xF0, 0x1F, 0x00, 0xFD, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x01,
-    0xF0, 0x03, 0xC0, 0x2E, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x84, 0x3C, 0x00, 0xF5, 0xD7, 0xC0, 0x0F,
-    0xF8, 0xB8, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xBF, 0x01, 0xFC, 0x0D, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0xF3, 0xD3, 0xE0, 0x00, 0x07, 0xAC, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x3C, 0x00, 0x00, 0xFE, 0x01,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0xF0, 0x00,
-    0x02, 0xE0, 0x07, 0xC1, 0x00, 0x0F, 0x40, 0x2E, 0x78, 0x00, 0x3C, 0x00, 0xBF, 0xC0, 0x01, 0xF0,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F, 0xD0, 0x01,
-    0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2, 0xF0, 0x0B,
-    0x40, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x3C,
-    0x00, 0x03, 0xC0, 0x2E, 0x1E, 0x00, 0x01, 0xF0, 0x03, 0xCB, 0x40, 0x00, 0x78, 0x00, 0xFB, 0xC0,
-    0x00, 0x2D, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00, 0x7D, 0x00,
-    0x1F, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x2F, 0x8B, 0xFC, 0x3F, 0xF0, 0x1E, 0x3D, 0x3D, 0x0B, 0xBC, 0x0F,
-    0x03, 0xFC, 0x07, 0xC0, 0xFD, 0x02, 0xE0, 0x3E, 0x00, 0xF4, 0x1F, 0x00, 0x3C, 0x0B, 0x80, 0x1F,
-    0x03, 0xD0, 0x0B, 0x80, 0xF0, 0x03, 0xD0, 0x7C, 0x00, 0xF0, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xDB, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03,
-    0xF9, 0x5B, 0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x01,
-    0xF3, 0xE0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x3F, 0x01,
-    0xF0, 0x2F, 0x00, 0x3D, 0x0F, 0x40, 0x0F, 0x87, 0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xF4, 0xF4, 0x00,
-    0x3C, 0x3D, 0x00, 0x2E, 0x0F, 0x80, 0x0F, 0x02, 0xF0, 0x0F, 0x80, 0x7F, 0xAF, 0x80, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0C, 0x00, 0x00, 0x3E,
-    0x6E, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03,
-    0xDB, 0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00,
-    0x0F, 0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0,
-    0x07, 0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x03, 0xD1, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F,
-    0x02, 0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03,
-    0xC3, 0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00,
-    0x7F, 0x0B, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x00, 0xD0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xE5,
-    0x6F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0x1F, 0x43,
-    0xE0, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00,
-    0x1F, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0xFF, 0xAF, 0xF0,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x2C, 0x00, 0x0F, 0xC7, 0xD0, 0x02, 0xF0, 0xF8, 0x00, 0x3D, 0x2E, 0x00, 0x0B, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x0F, 0xC0, 0x7C,
-    0x02, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xD0, 0xB8, 0x00, 0x3D, 0x0F, 0x40,
-    0x03, 0xC0, 0xF4, 0x00, 0xB8, 0x0F, 0x80, 0x0F, 0x00, 0xBC, 0x03, 0xE0, 0x07, 0xFA, 0xF8, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x54, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFA, 0x5B, 0xEA, 0xAF, 0x80, 0xBE, 0x00, 0x1F, 0x00, 0x1D, 0x0B, 0xD0,
-    0x00, 0xB8, 0x00, 0x70, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x1F,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFA, 0xA9, 0x03, 0xE0, 0x00, 0x0B, 0xFF, 0xF4,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x06, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x38, 0x0F, 0xD0, 0x03,
-    0xD0, 0x02, 0xD0, 0x0F, 0xFA, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0x80, 0x2F,
-    0xFF, 0x8F, 0xAF, 0x43, 0xF0, 0x1F, 0xF0, 0x2E, 0x2F, 0x00, 0x3F, 0x00, 0xF4, 0xF4, 0x00, 0xF8,
-    0x0B, 0xC7, 0xC0, 0x03, 0xD0, 0xBC, 0x2E, 0x00, 0x0F, 0xBF, 0x80, 0xF4, 0x00, 0x3F, 0xE0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0x2F, 0x00, 0xFF, 0x40, 0xB8, 0x7F, 0xAF,
-    0xBF, 0xFF, 0xC0, 0x7F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01,
-    0x9F, 0x46, 0xF4, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0xB8, 0x01, 0xF0,
-    0x00, 0x3D, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x07, 0xC1, 0xFD, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x07, 0xC0,
-    0xBC, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xBF, 0x90, 0x2F, 0xC1, 0xFF,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82,
-    0xF2, 0xFF, 0x2F, 0xC0, 0x79, 0xFA, 0x01, 0xEE, 0x00, 0x0B, 0xB0, 0x00, 0x3F, 0x40, 0x00, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x19, 0xF4, 0x6F, 0x40, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x03, 0xD0, 0x0F, 0x80,
-    0x00, 0xF0, 0x0B, 0xC0, 0x00, 0x7C, 0x1F, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0x40,
-    0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x2E, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x1B, 0xF9, 0x02, 0xFC, 0x1F, 0xFF, 0x80, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x0B, 0xC0, 0xBF, 0xCB, 0xF0, 0x01, 0xE7, 0xE8, 0x00, 0x7B, 0x80, 0x00, 0x2E, 0xC0,
-    0x00, 0x0F, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x1E, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00,
-    0x0F, 0xAF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x67, 0xD1, 0xBD, 0x00, 0x01, 0xF0, 0x0F,
-    0xC0, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x03, 0xC0,
-    0x2F, 0x00, 0x01, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x0F,
-    0x4B, 0xC0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0xB8, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x6F, 0xE4, 0x0B, 0xF0, 0x7F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3C, 0x01, 0xE0, 0xF0, 0x00, 0xF7, 0xD0, 0x00, 0x7F, 0x40,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF0, 0xBF, 0xCB, 0xF0, 0x07,
-    0x9F, 0xA0, 0x07, 0xB8, 0x00, 0x0B, 0xB0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40,
-    0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xF4, 0x5F, 0x41, 0xF0, 0x02,
-    0xD0, 0xBC, 0x00, 0xB0, 0x2F, 0x00, 0x14, 0x0B, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x07, 0xD1, 0xD0, 0x00,
-    0xF4, 0xB4, 0x00, 0x7C, 0x2F, 0x00, 0x3E, 0x0B, 0xFA, 0xBF, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0B, 0x80,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0B, 0xFF, 0x80, 0x78, 0x09,
-    0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0x80, 0x1F, 0x0B, 0x80, 0xB4, 0x2F, 0xEB, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0xBC, 0x2E, 0x00, 0x78, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x02, 0xFF, 0xFD, 0x02, 0xF4, 0x5F, 0x41, 0xF0, 0x02, 0xD0,
-    0xBC, 0x00, 0xB0, 0x2F, 0x00, 0x14, 0x0B, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x07, 0xD1, 0xD0, 0x00, 0xF4,
-    0xB4, 0x00, 0x7C, 0x2F, 0x00, 0x3E, 0x0B, 0xFA, 0xBF, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0x7C, 0x00, 0xF4, 0x78, 0x0B,
-    0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0B, 0xFF, 0x80, 0x78, 0x09, 0x03,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0,
-    0x80, 0x1F, 0x0B, 0x80, 0xB4, 0x2F, 0xEB, 0x80, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x94, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0x45, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0xC0, 0x0B, 0x02, 0xF0,
-    0x01, 0x40, 0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x03, 0xF0, 0x20, 0x00, 0x7D, 0x1D, 0x00, 0x0F, 0x4B, 0x40, 0x07, 0xC2, 0xF0,
-    0x03, 0xE0, 0xBF, 0xAB, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFD, 0x02, 0xFF, 0xE0, 0x78, 0x09, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x20, 0x07, 0xCB, 0x80, 0xB4, 0xBF, 0xAE,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0B, 0xF0, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x01,
-    0xF4, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x2D, 0x00, 0x3D, 0x0F, 0x80,
-    0x01, 0xF7, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x40, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0x45, 0xF4, 0x07, 0xC0, 0x0B, 0x40, 0xBC, 0x00, 0xB0, 0x0B,
-    0xC0, 0x05, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0x00, 0x07, 0xD0, 0x74, 0x00, 0x3D, 0x0B, 0x40,
-    0x07, 0xC0, 0xBC, 0x00, 0xF8, 0x0B, 0xFA, 0xBF, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x2D, 0x00, 0xF0, 0xB8, 0x00, 0x79, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xE0, 0x07, 0x80,
-    0x90, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xC0, 0x20, 0x07, 0xC0, 0xB8, 0x0B, 0x40, 0xBF, 0xAE, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0,
-    0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF, 0xFD, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xBD, 0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x0B, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFA, 0xEA, 0xBF,
-    0xAB, 0xDF, 0x00, 0xF4, 0x0B, 0x3C, 0x07, 0xC0, 0x2C, 0x90, 0x2F, 0x00, 0x90, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x01, 0xE0,
-    0x00, 0x0B, 0x40, 0x00, 0x3C, 0x00, 0x38, 0xD0, 0x02, 0xD2, 0x00, 0x0F, 0x00, 0x02, 0xBF, 0xF8,
-    0x3F, 0xFF, 0xD0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0xFF, 0xF0, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C,
-    0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00, 0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x05, 0x7E, 0x50, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00,
-    0x0F, 0x00, 0x0A, 0xFF, 0xE3, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x0B, 0xFF,
-    0xF8, 0x6F, 0xEA, 0x40, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x18, 0x0F, 0x0B, 0x80, 0xFF, 0xF0,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0x00, 0x00, 0x0B,
-    0xBF, 0xF0, 0x00, 0x00, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00,
-    0x03, 0xD0, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02,
-    0xF0, 0x00, 0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x30, 0x00, 0x3F, 0xEF,
-    0x00, 0x07, 0x0F, 0xE0, 0x00, 0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03,
-    0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC, 0x01, 0xFF, 0xE1,
-    0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x0F, 0x40, 0x00,
-    0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x00, 0x2D,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8,
-    0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x07, 0xE6, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x55, 0x57, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x3C,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00, 0x0B, 0x40, 0x2E, 0x00,
-    0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00,
-    0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x24, 0x00, 0x3D, 0x1B, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x06,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40,
-    0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03,
-    0xC0, 0x2E, 0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F,
-    0xFC, 0x7F, 0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x02, 0xC2, 0xC0, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x02, 0xC3, 0xC0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFC,
-    0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x03, 0xC0,
-    0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x07,
-    0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1E, 0x1D, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x2C, 0x2C,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC,
-    0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F,
-    0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x1C, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x0F,
-    0xD0, 0xFD, 0x00, 0x00, 0xD0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x05, 0x55,
-    0x7F, 0xFC, 0x01, 0xFF, 0xE1, 0xBD, 0x00, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF8, 0x00,
-    0x03, 0xC0, 0x0F, 0x40, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x2F, 0x00, 0x00, 0xB4, 0x02,
-    0xE0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x01,
-    0xE0, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x0B, 0xC3, 0xD0, 0x01, 0xF4, 0xFC, 0x00,
-    0x3D, 0x2F, 0x00, 0x07, 0x43, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07,
-    0x8B, 0xFC, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80,
-    0x3D, 0x0F, 0x79, 0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0,
-    0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00,
-    0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00,
-    0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79,
-    0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x55, 0x4B, 0xFF, 0xC0, 0x1E, 0x00, 0x7F,
-    0xFC, 0x1F, 0xD0, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x0F, 0x80,
-    0x0B, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x2E, 0xF0, 0x03,
-    0xC0, 0x00, 0xB8, 0x03, 0xCF, 0x00, 0xB4, 0x00, 0x0B, 0xC0, 0xB4, 0xF4, 0x0F, 0x00, 0x00, 0xBC,
-    0x0F, 0x0F, 0x42, 0xD0, 0x00, 0x07, 0xC2, 0xD0, 0xF4, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x0B, 0x87,
-    0x40, 0x00, 0x07, 0xCB, 0x40, 0xB8, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x07, 0x9D, 0x00, 0x00, 0x03,
-    0xED, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2D, 0xF4, 0x00, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x00, 0x1E, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x3C, 0x01, 0xF6, 0xFF, 0x00, 0xF8, 0x03, 0xE0,
-    0x3D, 0x02, 0xF0, 0x0F, 0x80, 0xF4, 0x0B, 0xC0, 0x3D, 0x02, 0xE0, 0x2F, 0x40, 0xF0, 0x07, 0xC0,
-    0xFD, 0x03, 0xC0, 0x0F, 0x07, 0xF8, 0x2D, 0x00, 0x3C, 0x3D, 0xE0, 0xF0, 0x00, 0xF1, 0xD3, 0xCB,
-    0x40, 0x03, 0xCF, 0x0F, 0x38, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00,
-    0xB4, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x1E, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F, 0xFD, 0x1F, 0xD0, 0x01, 0xF8, 0x02,
-    0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x01, 0xF0, 0x3D, 0x00,
-    0x00, 0x3E, 0x2E, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xE0, 0x00,
-    0x01, 0xE0, 0xF0, 0x00, 0x07, 0x80, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00,
-    0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25,
-    0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x55, 0x47, 0xFF, 0xD0, 0xBF, 0xF4, 0x7F, 0x40, 0x07, 0xE0, 0x0B, 0xC0, 0x02,
-    0xE0, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x00, 0xF8,
-    0xB8, 0x00, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA,
-    0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00,
-    0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D,
-    0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D,
-    0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xB4, 0x00, 0x0F, 0x42, 0xE0, 0x00,
-    0x07, 0xDF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0, 0x02, 0xF0, 0x03,
-    0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x2D, 0x00, 0xF0, 0xB8, 0x00, 0x79, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE4, 0x1C, 0x0F, 0xFF, 0x7D, 0x2D, 0x5F, 0xF8, 0x2C, 0x02, 0xE0, 0x00,
-    0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
-    0x10, 0x3F, 0x50, 0x38, 0xFF, 0xFF, 0xF8, 0xF0, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x3C, 0x09, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x1A, 0x40, 0x7C, 0x00, 0x1F, 0xFF, 0xE7, 0xD0, 0x03, 0xF9, 0x5B, 0xFC, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00,
-    0x3D, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x1F, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00,
-    0x00, 0xF8, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x06, 0xFE, 0xB8, 0x02, 0xFF, 0xFD, 0x00, 0xFC, 0x07, 0xC0,
-    0x2F, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xE0, 0x7C, 0x00, 0x3E, 0x0B, 0x80, 0x03, 0xD0, 0xF4, 0x00,
-    0x7C, 0x0F, 0x40, 0x0B, 0x80, 0xF8, 0x00, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0x7F, 0xAF, 0x80, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xDF, 0x81, 0xFC, 0x2F, 0x0F, 0x40, 0x3E, 0x1D, 0x0F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x3E, 0xAF, 0xC0, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x03, 0xD0, 0x50, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xF0, 0x00,
-    0x1F, 0x2F, 0xFC, 0x00, 0x2E, 0x78, 0xBC, 0x00, 0x2E, 0xD0, 0x3D, 0x00, 0x3F, 0x80, 0x3C, 0x00,
-    0x3F, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF0, 0x00,
-    0xF4, 0x02, 0xE0, 0x00, 0xF4, 0x07, 0xC0, 0x01, 0xFF, 0xBF, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x0F,
-    0x00, 0x0A, 0xFF, 0xE3, 0xFF, 0xFD, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x18, 0x0F, 0x0B, 0xC0, 0xFF, 0xF8, 0x0B,
-    0xFB, 0x40, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x3C, 0x7C, 0x03, 0xFF, 0x00, 0x1A, 0x80,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x0B, 0xFF, 0xFF, 0xFE, 0x3F, 0xAB, 0xFA, 0xBD, 0x3D, 0x03, 0xD0,
-    0x2C, 0x3C, 0x07, 0xC0, 0x2C, 0x14, 0x0B, 0xC0, 0x24, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x06, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xFA, 0xF0, 0x00, 0xB4, 0x14, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x2B, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x01, 0x80,
-    0x03, 0xC2, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00,
-    0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x20, 0x00, 0x03, 0xE6, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x1B, 0xD0,
-    0x00, 0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x00, 0xF0,
-    0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00,
-    0x7C, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F,
-    0xC0, 0x07, 0xF4, 0xBF, 0xC0, 0x0F, 0x80, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B,
-    0x80, 0x1E, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D,
-    0x01, 0xF8, 0x00, 0x3D, 0x03, 0xB8, 0x00, 0x3D, 0x0F, 0x79, 0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F,
-    0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x7C, 0x03, 0xF0, 0x0F, 0x80, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xC1, 0xF0, 0x3C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x1F, 0xD0, 0x1F, 0xBC, 0x0F, 0x0F, 0x0F, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x4A, 0xBF, 0xEE, 0xE1, 0xFC, 0x00, 0x50, 0x6A, 0xA9, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x03, 0xBD, 0x1E, 0x3F, 0xFC, 0x0B, 0x90, 0x2D, 0x7E, 0xBD, 0x10, 0x05, 0x01, 0x43, 0xF0, 0xFC,
-    0x3E, 0x0F, 0x80, 0x40, 0x10, 0x06, 0x80, 0xFF, 0xCB, 0x0F, 0x18, 0x3C, 0x03, 0xC0, 0x7C, 0x01,
-    0xC0, 0x00, 0x00, 0x01, 0x90, 0x0F, 0xF4, 0x2C, 0x3C, 0x38, 0x2C, 0x3C, 0x38, 0x2F, 0xF0, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x74, 0x38, 0x0F, 0x8B, 0xC3, 0xF1, 0xF4, 0xBC, 0x3D, 0x0E, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x03, 0xC7, 0x83, 0xD0, 0xF7, 0xD0, 0x1F, 0xD0, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x34, 0x70, 0xB8, 0xB4, 0x7C, 0x78, 0x3C, 0x3C, 0x0D, 0x1C, 0x00, 0x00, 0x00,
-    0x10, 0x01, 0xFF, 0x81, 0xFB, 0xF4, 0xE0, 0x2D, 0x10, 0x02, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x41,
-    0xE0, 0x3D, 0x03, 0xD0, 0x3F, 0x01, 0x80, 0x0A, 0x07, 0xE0, 0xF8, 0x3D, 0x1F, 0x0F, 0x0B, 0x00,
-    0x09, 0x0F, 0xCB, 0xC2, 0xD0, 0x74, 0x0E, 0x01, 0xC0, 0x04, 0x2D, 0x3C, 0x3C, 0x74, 0xB0, 0x00,
-    0x06, 0x80, 0x7C, 0x0F, 0x81, 0xF0, 0x38, 0x00, 0x00, 0x2D, 0x7E, 0xBD, 0x10, 0x09, 0x02, 0x43,
-    0xF0, 0xFC, 0x3E, 0x0F, 0x80, 0x40, 0x10, 0x0A, 0x43, 0xED, 0x70, 0xEB, 0x0D, 0x3F, 0xC0, 0x50,
-    0x06, 0x43, 0xE0, 0xB8, 0x3C, 0x2D, 0x04, 0x00, 0x0A, 0x80, 0xBD, 0x02, 0xD0, 0x78, 0x2E, 0x01,
-    0x40, 0x01, 0x00, 0xD0, 0x3C, 0x07, 0x40, 0x7D, 0x43, 0xFC, 0x00, 0x00, 0x0A, 0x03, 0xC1, 0xE0,
-    0xB4, 0x3C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xE0, 0x3E, 0x3D, 0x3D, 0x03, 0x84,
-    0x00, 0x00, 0x10, 0x00, 0xF0, 0x0A, 0xFD, 0x7C, 0x7F, 0xF4, 0x06, 0x40, 0x00, 0x00, 0x2F, 0x06,
-    0xBF, 0xDF, 0xF2, 0xFD, 0x50, 0xA4, 0x15, 0x54, 0xBF, 0xFE, 0x6A, 0xA9, 0x00, 0x10, 0x01, 0xFF,
-    0x81, 0xFB, 0xF4, 0xE0, 0x2D, 0x10, 0x02, 0x00, 0x00, 0x03, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00,
-    0xF4, 0x00, 0xB4, 0x00, 0x10, 0x02, 0x80, 0x62, 0xF4, 0xBD, 0xFC, 0x2F, 0x04, 0x01, 0x00, 0x04,
-    0x0F, 0x03, 0xC0, 0xF9, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00,
-    0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D,
-    0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00,
-    0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x06, 0xA9, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x2E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0xBE, 0xBF, 0xE0, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xB8,
-    0x01, 0xF0, 0x00, 0xF8, 0x02, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0x03, 0xE0, 0x1B, 0xFA, 0xBF, 0x80,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x1F, 0xAA, 0xBE, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2C,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7B, 0xC0, 0x00,
-    0x03, 0xCF, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x0B, 0x02, 0xE0, 0x00, 0x78,
-    0x07, 0xC0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0xF4, 0x0B, 0x80, 0x02,
-    0xE0, 0x3C, 0x00, 0x0B, 0xC2, 0xD0, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x3D, 0xFF, 0xFA, 0xBF, 0xF6,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFA, 0xAA,
-    0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C, 0x00,
-    0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x55, 0x55, 0x54, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFA, 0xAA, 0xFC, 0x03, 0xC0, 0x02,
-    0xF0, 0x03, 0xC0, 0x07, 0xD0, 0x01, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0xF0, 0x2F, 0x00, 0x02,
-    0xE0, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54,
-    0x01, 0x55, 0x40, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0x90, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00,
-    0x00, 0x3D, 0xBC, 0x1A, 0xAE, 0x0F, 0x7E, 0x0F, 0xFF, 0x47, 0xCF, 0x81, 0x00, 0x02, 0xF3, 0xE0,
-    0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00,
-    0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x54, 0x03, 0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x55, 0x50, 0x15, 0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x1F, 0x80,
-    0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x00, 0x2E, 0x07, 0xD0,
-    0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00,
-    0xF0, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00, 0x03, 0xE0,
-    0x03, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00,
-    0x07, 0x47, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00,
-    0xF8, 0x00, 0x00, 0xB4, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x1F, 0x00,
-    0x01, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x78, 0x00, 0x03, 0xE0, 0x07, 0xE4,
-    0x00, 0x1F, 0xE0, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x01, 0x55, 0x00, 0x07,
-    0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xEE, 0x00, 0x3D, 0xF0, 0x00, 0x01, 0xEB, 0x80, 0x2D, 0xBC, 0x00, 0x00, 0xB5,
-    0xF0, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x7C, 0x0B, 0x0B, 0x80, 0x00, 0x1E, 0x0F, 0x03, 0x82, 0xE0,
-    0x00, 0x0B, 0x43, 0xD3, 0xC0, 0xF4, 0x00, 0x03, 0xC0, 0xF9, 0xE0, 0x3D, 0x00, 0x00, 0xF0, 0x2E,
-    0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x07, 0xF4, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0A, 0x00, 0x1F, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x1F, 0xE4, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x55, 0x00, 0x01, 0x55, 0x40, 0x3F,
-    0xD0, 0x01, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0xF0, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x00, 0x03, 0xCF, 0x80, 0x1E, 0x00, 0x00, 0xF2,
-    0xF0, 0x0B, 0x40, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0x00, 0x2D, 0x0B, 0xC0, 0xF0, 0x00, 0x0F, 0x00,
-    0xF4, 0x3C, 0x00, 0x03, 0xC0, 0x3E, 0x1E, 0x00, 0x01, 0xF0, 0x07, 0xCB, 0x40, 0x00, 0x78, 0x00,
-    0xFB, 0xC0, 0x00, 0x2D, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xE4, 0x00,
-    0x7E, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0x80, 0x00, 0x3C, 0x01, 0xD0,
-    0x00, 0x0F, 0x00, 0x30, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x03,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07,
-    0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F,
-    0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00,
-    0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA,
-    0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0xAA, 0xBF, 0x40, 0x00, 0x7C, 0x00, 0x0B, 0x80,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00,
-    0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1B,
-    0xF8, 0x01, 0xFE, 0x40, 0x1F, 0xFF, 0x42, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x01, 0x9F, 0x42, 0xF8, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2E,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0xBD,
-    0xAF, 0x80, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0xAA, 0xBE, 0x00, 0x7D,
-    0x00, 0x2D, 0x00, 0x3F, 0x00, 0x1C, 0x00, 0x0F, 0x40, 0x14, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x10, 0x02, 0xF0, 0x00, 0x70, 0x0B, 0xC0, 0x00, 0xF0, 0x1F, 0x00,
-    0x02, 0xE0, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x51, 0xFF, 0xFF, 0xFF, 0xEB, 0xAA, 0xFE, 0xAF, 0x7C, 0x03, 0xD0, 0x2C, 0xF0, 0x1F, 0x00,
-    0xB2, 0x40, 0xBC, 0x02, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x18, 0x3F, 0xC0, 0x00, 0xBE, 0xBF, 0xD0, 0x02, 0xFC, 0x03, 0xE0,
-    0x07, 0xF0, 0x02, 0xF0, 0x0F, 0xC0, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xB8,
-    0xB8, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x3E, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x06, 0xFE, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x06, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xBE, 0xFF,
-    0x00, 0x7E, 0x03, 0xC0, 0xFC, 0x0F, 0x40, 0x78, 0x07, 0xD2, 0xF0, 0x0B, 0x80, 0x3D, 0x3D, 0x00,
-    0xF4, 0x03, 0xD3, 0xC0, 0x0F, 0x00, 0x3D, 0x3C, 0x01, 0xF0, 0x07, 0xC3, 0xD0, 0x1E, 0x00, 0xF8,
-    0x3F, 0x02, 0xD0, 0x7E, 0x00, 0xFE, 0xBE, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x15, 0x54, 0x05, 0x54, 0x00, 0xFF, 0xF8, 0x2F, 0xFD, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00,
-    0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x00,
-    0xF1, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x0F, 0x03, 0xD0,
-    0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0xBC, 0x00,
-    0x1F, 0xE4, 0x01, 0xFF, 0x80, 0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x28, 0x01, 0x55, 0x40, 0x28, 0x3E,
-    0x0B, 0xFF, 0xC0, 0xF8, 0x3E, 0x01, 0xFC, 0x02, 0xF0, 0x2E, 0x00, 0xF4, 0x03, 0xE0, 0x2E, 0x00,
-    0xF0, 0x07, 0xC0, 0x2E, 0x01, 0xF0, 0x0B, 0x80, 0x3E, 0x02, 0xF0, 0x0F, 0x40, 0x3D, 0x03, 0xE0,
-    0x1F, 0x00, 0x3E, 0x03, 0xD0, 0x3E, 0x00, 0x2F, 0x03, 0xC0, 0xBC, 0x00, 0x1F, 0x87, 0xC2, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x07,
-    0xF9, 0x5B, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0,
-    0x00, 0xB8, 0x00, 0x0B, 0x80, 0x04, 0x3C, 0x00, 0x2E, 0x04, 0x2C, 0x1E, 0x00, 0xB8, 0x3C, 0x3C,
-    0x0B, 0x43, 0xD0, 0x38, 0x3F, 0xFF, 0x07, 0xFF, 0xF4, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x3C, 0x03, 0xFF, 0xC3, 0xC0, 0xF8, 0x2D, 0xB8, 0x2E, 0x00, 0xEF, 0x03,
-    0xC0, 0x0B, 0xE0, 0x7C, 0x00, 0xBC, 0x0B, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF0, 0x0F, 0x40, 0x2F,
-    0x00, 0xF4, 0x07, 0xF0, 0x0F, 0xC2, 0xF7, 0x85, 0xBF, 0xFC, 0x3F, 0xD2, 0xFE, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xF5, 0xF8, 0x00, 0xF0, 0x2E,
-    0x00, 0xB4, 0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x01, 0xF0, 0x0B, 0x40, 0xF0, 0x03, 0xD0, 0xF4,
-    0x00, 0xF1, 0xFD, 0x00, 0x3C, 0x2B, 0xD0, 0x1F, 0x00, 0xBC, 0x07, 0x80, 0x0F, 0x02, 0xD0, 0x03,
-    0xD0, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x1F, 0x02, 0xFE, 0xAF,
-    0x00, 0xFF, 0xFE, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0x87, 0xFC,
-    0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xE0, 0x0F, 0x00, 0xB8, 0x07, 0x80, 0x1F, 0x03, 0xD0, 0x03,
-    0xC0, 0xF0, 0x00, 0xF0, 0xF4, 0x00, 0x3C, 0x78, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xFF, 0x80,
-    0x02, 0xE6, 0xF4, 0x01, 0xE0, 0x1E, 0x00, 0xB8, 0x02, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xF8, 0xBC, 0x00, 0xF4, 0x0F, 0x40, 0xB8, 0x02, 0xF0,
-    0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1F, 0x0F, 0x80, 0x07, 0xC3, 0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF4,
-    0x2F, 0x00, 0xB8, 0x03, 0xFA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x7F, 0xFF, 0x03, 0xD0, 0x18, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFA,
-    0x80, 0x02, 0xFF, 0x00, 0x3E, 0x40, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x24, 0x7F,
-    0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1E, 0x00, 0x00, 0xF4, 0x0B,
-    0x03, 0xE0, 0xFC, 0x03, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB4, 0x00, 0x03, 0x80,
-    0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x03, 0xFC, 0x00, 0x0E, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x81, 0xFC, 0xBF, 0xC7, 0xFE, 0x07, 0x9E, 0x2F, 0x0B, 0xB4, 0x1E, 0x0F,
-    0xE0, 0x2E, 0x0F, 0xC0, 0x2D, 0x0F, 0x40, 0x3D, 0x1F, 0x00, 0x3C, 0x2E, 0x00, 0x3C, 0x3D, 0x00,
-    0x78, 0x3C, 0x00, 0xB4, 0x7C, 0x00, 0xF0, 0xB8, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x7D, 0x7F, 0x00, 0x0F, 0x00, 0xF8, 0x03, 0xC0, 0x0B, 0xC0, 0x78, 0x00,
-    0x7C, 0x0F, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x3C, 0x2E, 0x00, 0x07, 0xC3, 0xFA, 0xAA, 0xBC, 0x3F,
-    0xFF, 0xFF, 0x83, 0xC0, 0x00, 0xB8, 0x7C, 0x00, 0x0F, 0x47, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x2E,
-    0x03, 0xC0, 0x03, 0xC0, 0x3D, 0x00, 0xB4, 0x02, 0xF0, 0x2E, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x40, 0xF0, 0x1F, 0x01, 0xE0, 0x2D,
-    0x03, 0xD0, 0x3C, 0x07, 0xC0, 0xB8, 0x0B, 0x48, 0xFF, 0xCB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xE0, 0x02, 0xFB, 0xFC, 0x07, 0xFC, 0x1E, 0x07, 0xE0, 0x0B, 0x47, 0xC0, 0x03, 0xC3, 0xC0,
-    0x00, 0xF3, 0xF0, 0x00, 0x79, 0xFC, 0x00, 0x1D, 0xEE, 0x00, 0x0B, 0xB3, 0xC0, 0x03, 0xF0, 0xF0,
-    0x00, 0xF8, 0x3E, 0x08, 0x7C, 0x0B, 0xFF, 0x2D, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x2D, 0x78, 0x00, 0x03, 0xC7, 0x80, 0x00,
-    0xF4, 0x7C, 0x00, 0x2F, 0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x00, 0xF8, 0x03, 0xC2, 0x3F, 0x00, 0x3F,
-    0xEB, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xB0,
-    0x00, 0xF4, 0x01, 0xF0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0xF0, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xC0,
-    0x02, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xC0, 0x0B, 0x80, 0x03, 0xC0, 0x0F, 0x40,
-    0x07, 0xC0, 0x2F, 0x40, 0x07, 0xE0, 0x7B, 0x85, 0x0B, 0xFF, 0xE3, 0xFD, 0x0F, 0xBF, 0x82, 0xF4,
-    0x0E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x0F, 0xCB, 0xFC, 0x02, 0xF0, 0x1F, 0x00, 0x7C, 0x03, 0xD0, 0x0F, 0x00, 0xB8, 0x07, 0x80,
-    0x2E, 0x03, 0xD0, 0x07, 0xC0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x3C, 0x78, 0x00, 0x0F, 0x3C, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2E, 0x00, 0x00, 0xF0, 0x01, 0x02, 0xF6, 0xFC, 0x01, 0xFF, 0xE0, 0x0B, 0x40, 0x00, 0x78, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x7F, 0xC0, 0x0B, 0xE9,
-    0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFE,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x03,
-    0xFC, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0,
-    0xBC, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3D, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3C, 0xF4, 0x00, 0x7C,
-    0xF4, 0x00, 0xF8, 0xF8, 0x01, 0xF0, 0xBC, 0x07, 0xD0, 0x7F, 0xBF, 0x40, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x47, 0x9F, 0x5B,
-    0x90, 0x10, 0x38, 0x2C, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x3C, 0x1D, 0x00,
-    0x01, 0xD0, 0xB0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x78, 0x0F, 0x00, 0x03, 0xD0, 0x3C, 0x20, 0x1F,
-    0x00, 0xFF, 0xC0, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xC0, 0x3E, 0x00, 0xF4, 0x02, 0xE0, 0x1F, 0x00, 0x2F,
-    0x02, 0xD0, 0x02, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x7C, 0x07, 0xC0,
-    0x0F, 0x80, 0xBC, 0x02, 0xF0, 0x0B, 0xFA, 0xFC, 0x00, 0xFB, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xC0, 0xF4, 0x18, 0x3D, 0x00, 0x07, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xFD, 0x00, 0x0B,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0xBD, 0x0F, 0x50, 0x2F,
-    0x00, 0x78, 0x03, 0xD0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0F, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0x7C,
-    0x0F, 0x40, 0x0F, 0x80, 0xF8, 0x01, 0xF0, 0x0B, 0xC0, 0x3D, 0x00, 0x3F, 0xAF, 0x40, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0xB9,
-    0xB9, 0x50, 0x40, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0,
-    0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC2, 0x80, 0x07, 0xFF, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3C, 0x7F, 0xC0, 0x3E, 0x03, 0xC0, 0x2F, 0x0B,
-    0x80, 0x2F, 0x0F, 0x40, 0x1F, 0x0F, 0x00, 0x2E, 0x2F, 0x00, 0x3D, 0x2E, 0x00, 0x3C, 0x3D, 0x00,
-    0x7C, 0x3D, 0x00, 0xF0, 0x3F, 0x03, 0xE0, 0x2F, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0xE0, 0x03, 0xD0, 0x7F, 0xF8, 0x0F, 0x00, 0xF0, 0x7C,
-    0x2E, 0x01, 0xD0, 0x3D, 0x3C, 0x02, 0xC0, 0x2E, 0x7C, 0x03, 0xC0, 0x2D, 0xB8, 0x03, 0x80, 0x3D,
-    0xB8, 0x07, 0x80, 0x3C, 0xBC, 0x0B, 0x40, 0xB4, 0x7C, 0x0F, 0x01, 0xF0, 0x3F, 0x0F, 0x0B, 0xC0,
-    0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x7C, 0x02, 0xFF, 0x00, 0xF4, 0x00, 0x0F, 0x02, 0xE0,
-    0x00, 0x0F, 0x47, 0xC0, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x07, 0x9D, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x1E, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0xB0, 0xF4, 0x00, 0x01, 0xE0, 0xF8, 0x00,
-    0x03, 0xC0, 0xBC, 0x00, 0x0F, 0x40, 0x7D, 0x70, 0x2F, 0x00, 0x3F, 0xD0, 0x2C, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xF0, 0x0F, 0x0B, 0x87, 0xFC, 0x03, 0xC0, 0xF0, 0x0F, 0x01,
-    0xE0, 0x3D, 0x07, 0x80, 0xB4, 0x0F, 0x43, 0xD0, 0x3C, 0x03, 0xD0, 0xF0, 0x0F, 0x00, 0xF4, 0x3C,
-    0x07, 0xC0, 0x3C, 0x1E, 0x02, 0xE0, 0x1F, 0x07, 0xC0, 0xB4, 0x0F, 0x41, 0xF0, 0x3C, 0x0B, 0xC0,
-    0x3E, 0x0F, 0x0B, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xB4, 0x02, 0xE0,
-    0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x1F, 0x00, 0x50, 0x2E, 0x3D, 0x02, 0xE0, 0x1F, 0x7C, 0x03,
-    0xC0, 0x1F, 0xB8, 0x03, 0xC0, 0x2E, 0xF4, 0x03, 0x80, 0x2D, 0xF4, 0x07, 0x40, 0x3C, 0xF4, 0x0F,
-    0x40, 0x3C, 0xF8, 0x1F, 0xC0, 0xF4, 0x7F, 0xBA, 0xFB, 0xD0, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00,
-    0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4,
-    0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42,
-    0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xC0, 0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01,
-    0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07, 0xF0, 0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x79, 0xF4, 0x00, 0x00, 0x01, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F,
-    0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF,
-    0xF0, 0x00, 0x01, 0xA0, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xD2, 0xD0, 0x00, 0x20, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE1, 0xD0, 0x2F, 0xFF, 0xF0, 0x1F, 0x42, 0xF8, 0x0F, 0x00, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xC0,
-    0x07, 0xC1, 0xE0, 0x02, 0xE0, 0xB4, 0x01, 0xF4, 0x3D, 0x00, 0xFC, 0x0F, 0x40, 0xBF, 0x07, 0xF0,
-    0xB3, 0xCF, 0xBF, 0xF4, 0xFF, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x41,
-    0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x78,
-    0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00,
-    0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00,
-    0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0x0F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x7D, 0x3D, 0x00, 0x01, 0xF4, 0x1D, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x87, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x07, 0xD0, 0xBE, 0x00, 0x0F, 0x00, 0x3D,
-    0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xB4, 0x01, 0xF4,
-    0x00, 0xF4, 0x03, 0xF0, 0x00, 0xF4, 0x0B, 0xF0, 0x40, 0xFC, 0x2C, 0xF3, 0xC0, 0xBF, 0xF4, 0xFF,
-    0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x3C, 0x00, 0x00, 0x01, 0xFC,
-    0x10, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0,
-    0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00,
-    0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00,
-    0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x03, 0x80, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF4, 0xF4, 0x00,
-    0xF4, 0x1D, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01,
-    0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B,
-    0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0,
-    0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x77, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x60, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x60, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x00,
-    0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0xD0, 0x3D, 0x00,
-    0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0x3D, 0x55, 0x6F, 0x40, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00,
-    0x0B, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x0A, 0x1D, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xA1, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E, 0x3D, 0x00,
-    0x00, 0xF4, 0x1D, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40,
-    0x02, 0xFF, 0xFF, 0x00, 0x07, 0xD0, 0xBE, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xB4, 0x01, 0xF4, 0x00, 0xF4, 0x03, 0xF0, 0x00,
-    0xF4, 0x0B, 0xF0, 0x40, 0xFC, 0x2C, 0xF3, 0xC0, 0xBF, 0xF4, 0xFF, 0x00, 0x3F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0xD1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0x09, 0x00, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1D,
-    0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x40,
-    0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x00,
-    0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x90, 0x03, 0xEF, 0xB8, 0x00, 0xD1, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF5, 0xF0, 0x01, 0xF4, 0x1D, 0x00, 0x10, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01, 0xF4, 0x2F, 0x80, 0xF0, 0x03,
-    0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B, 0x40, 0x1F, 0x43, 0xD0, 0x0F,
-    0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0, 0xFF, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF4,
-    0x00, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00,
-    0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x0F,
-    0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E, 0x00, 0x03,
-    0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01, 0xFE, 0x4F,
-    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3D, 0xF0, 0x00, 0x3C,
-    0x2D, 0x00, 0x3D, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF,
-    0xFF, 0xC0, 0x7D, 0x0B, 0xE0, 0x3C, 0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80,
-    0x0B, 0x82, 0xD0, 0x07, 0xD0, 0xF4, 0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF,
-    0xD3, 0xFC, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x1D, 0x10, 0x00, 0x00, 0x3C, 0x02,
-    0x80, 0x00, 0x00, 0xBF, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0,
-    0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00,
-    0xF9, 0x56, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00,
-    0x3D, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x80, 0x0B, 0x82, 0xD0, 0x01, 0xFF, 0xE0, 0x00,
-    0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01,
-    0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B,
-    0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0,
-    0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x10, 0x00, 0x00, 0x3C, 0x02, 0x80, 0x00,
-    0x00, 0xBF, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00,
-    0x3C, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00,
-    0x0F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x90, 0x00, 0x1C, 0x00, 0x80, 0x0B, 0x82, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x1B, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01, 0xF4, 0x2F,
-    0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B, 0x40, 0x1F,
-    0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0, 0xFF, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0x7C, 0x00, 0x00,
-    0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x00, 0x78,
-    0x1C, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C, 0x0F,
-    0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x00,
-    0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xB1, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x70, 0x00, 0x0A, 0x00, 0x20, 0x03, 0xD0, 0x74, 0x00, 0x7F, 0xF8, 0x00, 0x06,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x87, 0x40, 0xBF, 0xFF, 0xC0, 0x7D,
-    0x0B, 0xE0, 0x3C, 0x00, 0xF4, 0x3E, 0x00, 0x3C, 0x0F, 0x00, 0x1F, 0x07, 0x80, 0x0B, 0x82, 0xD0,
-    0x07, 0xD0, 0xF4, 0x03, 0xF0, 0x3D, 0x02, 0xFC, 0x1F, 0xC2, 0xCF, 0x3E, 0xFF, 0xD3, 0xFC, 0x3F,
-    0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x80, 0x00, 0x00, 0x7F, 0xEF, 0x00,
-    0x00, 0x01, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x02, 0x80, 0x00, 0x00,
-    0xFE, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x1D, 0xB8, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x3C,
-    0x0F, 0x40, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0xF9, 0x56, 0xF0,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x55, 0x6F, 0x40, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x0F,
-    0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0x03, 0xF0, 0x0B, 0xE4, 0x00, 0x1F, 0xE4, 0xFF, 0xF0, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xC0, 0x07, 0xFF, 0xF0, 0x01, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x0F, 0x41, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0x1B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF, 0x01, 0xF4, 0x2F, 0x80,
-    0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E, 0x0B, 0x40, 0x1F, 0x43,
-    0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F, 0xF0, 0xFF, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x00, 0x00, 0x01,
-    0xF9, 0xB8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x74,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x0B, 0x80,
-    0x00, 0x0F, 0x95, 0x6F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xD5, 0x56, 0xF4, 0x00, 0x2E,
-    0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x40, 0x01,
-    0xFE, 0x4F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x07, 0xD1, 0xF0, 0x00, 0xFF, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x1D, 0x02, 0xFF, 0xFF,
-    0x01, 0xF4, 0x2F, 0x80, 0xF0, 0x03, 0xD0, 0xF8, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x1E, 0x00, 0x2E,
-    0x0B, 0x40, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0xF4, 0x0B, 0xF0, 0x7F, 0x0B, 0x3C, 0xFB, 0xFF, 0x4F,
-    0xF0, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x00, 0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0, 0xF0, 0x0F, 0x47, 0x82,
-    0xF4, 0x2E, 0xBF, 0x00, 0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04, 0x3F, 0x01, 0xF0, 0x7F,
-    0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x3F, 0x00, 0x01,
-    0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xDB, 0x80, 0x00, 0x00, 0xD1, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0x80, 0x00, 0xBF, 0xC0, 0x07, 0x4B, 0x40, 0x08, 0x3C, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00,
-    0x2E, 0xBF, 0x02, 0xD0, 0x7C, 0x1E, 0x01, 0xF0, 0xF0, 0x0F, 0x47, 0x82, 0xF4, 0x2E, 0xBF, 0x00,
-    0xFF, 0x90, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x04, 0x3F, 0x01, 0xF0, 0x7F, 0xFF, 0x40, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x2F, 0xC3, 0x40, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x07, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02,
-    0xF0, 0x00, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x07, 0xEA, 0xA8, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00,
-    0x78, 0x01, 0xBF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1C,
-    0x01, 0xFF, 0xBC, 0x02, 0xC3, 0xF4, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F,
-    0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0,
-    0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x10, 0xE0, 0x00, 0x00, 0x0F, 0xD1,
-    0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x07, 0xC0,
-    0x03, 0x80, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01,
-    0xC0, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x1B, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7D, 0x3D, 0x00, 0x07, 0xD0, 0x74, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF0, 0x00, 0x02, 0xEB, 0xF0, 0x00, 0x2D, 0x07, 0xC0, 0x01, 0xE0, 0x1F, 0x00, 0x0F, 0x00, 0xF4,
-    0x00, 0x78, 0x2F, 0x40, 0x02, 0xEB, 0xF0, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x40, 0x03, 0xF0, 0x1F, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x01, 0x2C, 0x00, 0x00, 0x0F, 0xD1, 0x00, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x0F, 0x43,
-    0xC0, 0x00, 0x02, 0x00, 0x50, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFA,
-    0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C,
-    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x0E, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0xF4, 0xF4, 0x03, 0xD0, 0x74, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0, 0x1E, 0x01, 0xF0, 0x3C,
-    0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x3A, 0xD0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0xD3, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00,
-    0x24, 0x01, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFA, 0xAA,
-    0xF0, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x01, 0xC0, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x1B,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBB,
-    0xD0, 0x00, 0x02, 0x87, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2A, 0x18, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x03, 0xD0, 0x74, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x02, 0xEB, 0xF0, 0x00, 0x2D, 0x07, 0xC0, 0x01, 0xE0, 0x1F,
-    0x00, 0x0F, 0x00, 0xF4, 0x00, 0x78, 0x2F, 0x40, 0x02, 0xEB, 0xF0, 0x00, 0x0F, 0xF9, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x40, 0x03, 0xF0, 0x1F, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x09, 0x00, 0x00, 0x1E, 0xFB, 0x40,
-    0x00, 0x06, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x0F, 0x4B, 0x40, 0x00, 0x06, 0x00, 0x80, 0x00, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFA, 0xAA, 0xF0, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x2F, 0x00, 0x0C, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xAA, 0x80, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x1C, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x1B, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x09, 0x00, 0xFB, 0xEE, 0x00,
-    0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0xF5, 0xF0, 0x07, 0xD0,
-    0x74, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x02, 0xEB, 0xF0, 0x0B, 0x41, 0xF0,
-    0x1E, 0x01, 0xF0, 0x3C, 0x03, 0xD0, 0x78, 0x2F, 0x40, 0xBA, 0xFC, 0x00, 0xFF, 0x90, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x40, 0xFC, 0x07, 0xC0, 0x7F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x03,
-    0xE0, 0xF4, 0x00, 0x02, 0xD0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xAA, 0xAF, 0x00, 0x07, 0xC0, 0x03, 0x80, 0x02, 0xF0, 0x00, 0xC0,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xA8,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x01, 0xC0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x01, 0xBF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0x7C, 0x00, 0xF0, 0xB4, 0x0F,
-    0x40, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x0B, 0xAF, 0xC0, 0xB4, 0x1F, 0x07,
-    0x80, 0x7C, 0x3C, 0x03, 0xD1, 0xE0, 0xBD, 0x0B, 0xAF, 0xC0, 0x3F, 0xE4, 0x00, 0xF4, 0x00, 0x03,
-    0xD0, 0x01, 0x0F, 0xC0, 0x7C, 0x1F, 0xFF, 0xD0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x0F, 0x7D, 0x00, 0x0C, 0x2D, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x68, 0x00, 0xBF, 0xC0, 0x74,
-    0xB4, 0x08, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x07, 0xFC, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x03, 0xC1, 0x01, 0xF3, 0xC0, 0xBF, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x54, 0x03, 0xFF, 0xE0, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x1B, 0xF8, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x1F, 0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x40,
-    0x0F, 0x04, 0x1F, 0x3C, 0x2F, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x7E, 0x00,
-    0xBD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F,
-    0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00,
-    0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80,
-    0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07,
-    0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8,
-    0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF,
-    0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0x7D, 0x00, 0x00, 0x03, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00,
-    0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00,
-    0x00, 0x07, 0xCF, 0x80, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F,
-    0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x0B, 0xFC, 0x00,
-    0x1E, 0x2D, 0x00, 0x08, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02, 0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D,
-    0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8,
-    0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x41, 0xE0,
-    0x00, 0x00, 0x3F, 0x44, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x60,
-    0x04, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x56, 0xFC, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00,
-    0x0F, 0x47, 0xC0, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x0F, 0x4F, 0x80, 0x00, 0x01, 0xF0, 0xF8,
-    0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0xF4, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xC0, 0x7C, 0x00,
-    0x2F, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x7F, 0xAF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F,
-    0x44, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x7C, 0x1E, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x3D,
-    0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00,
-    0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF8, 0xF4, 0x00, 0xF4, 0x0E, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F, 0x02, 0xF0, 0x03, 0xD0,
-    0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3, 0xD0, 0x02, 0xE0,
-    0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0x6C, 0x00, 0x00, 0x00, 0x12, 0xC0, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x3F, 0x1C, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x03, 0xD1, 0xF0,
-    0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFE,
-    0x56, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x01, 0xF4,
-    0x3E, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x0F, 0x4F, 0x80, 0x00,
-    0x01, 0xF0, 0xF8, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0x7C, 0x0F,
-    0xC0, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x0F, 0xFA, 0xFF,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x0B, 0xBD, 0x00, 0x00, 0x0A, 0x1D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x02, 0xA1, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0xF4, 0x1E, 0x00, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x7C, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xBC,
-    0x03, 0xE0, 0x00, 0x7F, 0xAF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x30, 0x00, 0x00, 0xBF, 0xEC, 0x00, 0x00, 0x24, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x28, 0x01,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x6F, 0xC0, 0x0F, 0xC0,
-    0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0xF5, 0xF0,
-    0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x02, 0xF3,
-    0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0xFD, 0x00, 0x7F, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x90, 0x03, 0xEF, 0xB8, 0x00, 0xD1, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF5, 0xF0, 0x01, 0xF4, 0x1D, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xF8, 0x03, 0xF0, 0x1F, 0x02,
-    0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3,
-    0xD0, 0x02, 0xE0, 0xF8, 0x00, 0xF0, 0x2F, 0x00, 0xF8, 0x07, 0xFA, 0xF8, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xBD,
-    0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x0F, 0x40, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFE, 0x56, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x00, 0xF7, 0xE0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x7C,
-    0x00, 0x3D, 0x2D, 0x00, 0xF4, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x02,
-    0xFF, 0xF8, 0x0F, 0xC0, 0x7C, 0x2F, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x7C, 0x00, 0x3D, 0xB8, 0x00,
-    0x3D, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0xB8, 0xF8, 0x00, 0xF0, 0xBC, 0x03, 0xE0, 0x7F, 0xAF, 0x80,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x05, 0x00, 0x02, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x06, 0x90, 0x1F, 0x00, 0x07, 0xFF, 0xF9, 0xF4, 0x00, 0xFE, 0x56, 0xFF, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x3E, 0x00,
-    0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0xF8, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x3F,
-    0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xAF,
-    0xF0, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xD0,
-    0x19, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x6F, 0xEB, 0x80, 0x2F, 0xFF, 0xD0, 0x0F,
-    0xC0, 0x7C, 0x02, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xB8, 0x00, 0x3D,
-    0x0F, 0x40, 0x07, 0xC0, 0xF4, 0x00, 0xB8, 0x0F, 0x80, 0x0F, 0x00, 0xBC, 0x03, 0xE0, 0x07, 0xFA,
-    0xF8, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x05, 0x00, 0x00, 0x18, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x06, 0x90, 0x1F, 0x00, 0x07, 0xFF, 0xF9, 0xF4, 0x00,
-    0xFE, 0x56, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00,
-    0x07, 0xD0, 0x3E, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF4,
-    0x3E, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x74, 0x19, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x6F, 0xEB, 0x80,
-    0x2F, 0xFF, 0xD0, 0x0F, 0xC0, 0x7C, 0x02, 0xF0, 0x03, 0xD0, 0x3D, 0x00, 0x3E, 0x07, 0xC0, 0x03,
-    0xE0, 0xB8, 0x00, 0x3D, 0x0F, 0x40, 0x07, 0xC0, 0xF4, 0x00, 0xB8, 0x0F, 0x80, 0x0F, 0x00, 0xBC,
-    0x03, 0xE0, 0x07, 0xFA, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x00, 0xD1, 0xE0, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x50, 0x00, 0x0E, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x69, 0x01, 0xF0, 0x00, 0x7F, 0xFF, 0x9F, 0x40, 0x0F, 0xE5, 0x6F,
-    0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00,
-    0x00, 0x7C, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C,
-    0x03, 0xF0, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x0F,
-    0xFA, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x78, 0xB4, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0D, 0x01, 0x90, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x06, 0xFE,
-    0xB8, 0x02, 0xFF, 0xFD, 0x00, 0xFC, 0x07, 0xC0, 0x2F, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xE0, 0x7C,
-    0x00, 0x3E, 0x0B, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x7C, 0x0F, 0x40, 0x0B, 0x80, 0xF8, 0x00, 0xF0,
-    0x0B, 0xC0, 0x3E, 0x00, 0x7F, 0xAF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x40, 0x00, 0x00, 0x2F, 0xC3, 0x40, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x0F,
-    0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x06, 0x90, 0x1F,
-    0x00, 0x07, 0xFF, 0xF9, 0xF4, 0x00, 0xFE, 0x56, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00,
-    0x3D, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x2F, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00,
-    0x02, 0xF0, 0x00, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE1, 0xC0, 0x01, 0xFF, 0xBC,
-    0x00, 0x2C, 0x3F, 0x40, 0x00, 0x40, 0x41, 0x90, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x06,
-    0xFE, 0xB8, 0x02, 0xFF, 0xFD, 0x00, 0xFC, 0x07, 0xC0, 0x2F, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xE0,
-    0x7C, 0x00, 0x3E, 0x0B, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x7C, 0x0F, 0x40, 0x0B, 0x80, 0xF8, 0x00,
-    0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0x7F, 0xAF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x1A, 0x40, 0x7C, 0x00, 0x1F, 0xFF, 0xE7, 0xD0, 0x03, 0xF9, 0x5B, 0xFC, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x3D, 0x07,
-    0xC0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0xF8,
-    0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x06, 0xFE, 0xB8, 0x02,
-    0xFF, 0xFD, 0x00, 0xFC, 0x07, 0xC0, 0x2F, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xE0, 0x7C, 0x00, 0x3E,
-    0x0B, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x7C, 0x0F, 0x40, 0x0B, 0x80, 0xF8, 0x00, 0xF0, 0x0B, 0xC0,
-    0x3E, 0x00, 0x7F, 0xAF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8, 0x00, 0x03, 0xD0,
-    0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78, 0x02, 0xF0, 0x00,
-    0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0x8B, 0xFC, 0x00,
-    0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0x80, 0x1E, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x00, 0x3C, 0x02, 0xE0, 0x0B, 0xC0, 0x3D, 0x01, 0xF8, 0x03, 0xD0, 0x3B, 0x80, 0x3D, 0x0F, 0x79,
-    0xD3, 0xFF, 0xC7, 0xFC, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xE7, 0xD0, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xC0, 0x1F, 0xFE, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0xB8,
-    0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x78,
-    0x02, 0xF0, 0x00, 0x0B, 0x40, 0x2E, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x0B, 0xC0, 0x00, 0x3C, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0E,
-    0x2E, 0x00, 0x00, 0x82, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x78, 0xBF, 0xC0, 0x0F, 0x40, 0x3C, 0x00,
-    0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xB8, 0x01, 0xE0, 0x0F, 0x40, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0xBC, 0x03, 0xD0, 0x1F, 0x80, 0x3D, 0x03, 0xB8, 0x03, 0xD0, 0xF7, 0x9D, 0x3F, 0xFC, 0x7F,
-    0xC1, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x14, 0x00, 0x00, 0x90, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4, 0x7F, 0xFC, 0x01, 0xFF, 0xD0,
-    0x1B, 0xD0, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x0F,
-    0x40, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x00, 0xB4, 0x00, 0x2E, 0x00,
-    0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x01,
-    0xE0, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0x40, 0x19, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x07, 0xF4, 0xBF, 0xC0, 0x0F, 0x80, 0x03, 0xC0, 0x0F,
-    0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0F, 0x00, 0x3C,
-    0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x01, 0xF8, 0x00, 0x3D, 0x03, 0xB8, 0x00, 0x3D, 0x0F, 0x79,
-    0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x14, 0x00, 0x00, 0x05, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4,
-    0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F,
-    0x80, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00,
-    0x00, 0xB4, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0,
-    0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01,
-    0xD0, 0x19, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x07, 0xF4, 0xBF, 0xC0,
-    0x0F, 0x80, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x0F, 0x40,
-    0x3D, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x01, 0xF8, 0x00, 0x3D, 0x03,
-    0xB8, 0x00, 0x3D, 0x0F, 0x79, 0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xE7, 0xD0,
-    0x00, 0x00, 0x01, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x14,
-    0x00, 0x00, 0x34, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4, 0x7F,
-    0xFC, 0x01, 0xFF, 0xD0, 0x1B, 0xD0, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0x80,
-    0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x00,
-    0xB4, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0,
-    0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0E, 0x2E, 0x00, 0x00, 0x08, 0x2D, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0x80, 0x19, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x07,
-    0xF4, 0xBF, 0xC0, 0x0F, 0x80, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0x80, 0x1E,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x01, 0xF8,
-    0x00, 0x3D, 0x03, 0xB8, 0x00, 0x3D, 0x0F, 0x79, 0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xE0, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xB0, 0x00, 0x00,
-    0x0B, 0xBF, 0xF0, 0x00, 0x00, 0x0A, 0x0F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x1B, 0xD0, 0x00,
-    0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x7C,
-    0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0x00, 0x00, 0x3F, 0xEF, 0x00, 0x00, 0x70,
-    0xFE, 0x00, 0x00, 0x10, 0x14, 0x19, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0,
-    0x07, 0xF4, 0xBF, 0xC0, 0x0F, 0x80, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0x80,
-    0x1E, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x01,
-    0xF8, 0x00, 0x3D, 0x03, 0xB8, 0x00, 0x3D, 0x0F, 0x79, 0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xE0,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x15, 0x54, 0x00, 0x56, 0xF4, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x1B,
-    0xD0, 0x00, 0x7E, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x00, 0xB4, 0x00, 0x2E, 0x00, 0x00,
-    0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x01, 0xE0,
-    0x00, 0x7C, 0x00, 0x02, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0xC0, 0x07, 0xF4, 0xBF, 0xC0, 0x0F,
-    0x80, 0x03, 0xC0, 0x0F, 0x40, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x01, 0xF8, 0x00, 0x3D, 0x03, 0xB8,
-    0x00, 0x3D, 0x0F, 0x79, 0xD0, 0x3F, 0xFC, 0x7F, 0xC0, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F, 0xFD, 0x1F, 0xD0, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0xB8, 0x00,
-    0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x3E, 0x2E, 0x00,
-    0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01,
-    0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00,
-    0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00,
-    0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x15, 0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42, 0xFF, 0xD1,
-    0xFD, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xC0,
-    0x00, 0x1F, 0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0,
-    0x2D, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0,
-    0xF0, 0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00,
-    0x2C, 0x25, 0xBC, 0x00, 0xFD, 0x3F, 0xE0, 0x00, 0xFC, 0x2E, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2D, 0xBC, 0x00, 0x00, 0x0A, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x54, 0x01, 0x55, 0x1F, 0xFF, 0x42, 0xFF, 0xD1, 0xFD, 0x00, 0x1F, 0x80, 0x2F, 0x00, 0x0B, 0x80,
-    0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x03, 0xE2, 0xE0,
-    0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x91, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D,
-    0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0,
-    0x00, 0x01, 0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x25, 0xBC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0xFB, 0xFD, 0x00, 0x00, 0x34, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x51, 0xFF, 0xF4, 0x2F, 0xFD, 0x1F, 0xD0,
-    0x01, 0xF8, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x01,
-    0xF0, 0x3D, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xE8, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x34, 0x00, 0x03, 0xFF, 0xB4, 0x00, 0x03,
-    0x4F, 0xF0, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x7C, 0x01, 0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x0B, 0xC0, 0x2D, 0x00, 0x03,
-    0xC0, 0x3C, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x02, 0xD0, 0x74, 0x00, 0x02, 0xE0, 0xF0, 0x00, 0x01,
-    0xE1, 0xD0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x01, 0xED, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x25, 0xBC,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00,
-    0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E,
-    0xEA, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55,
-    0xFA, 0xAB, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x54,
-    0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
-    0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x14, 0x05, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x68,
-    0x0A, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38, 0x0F, 0x02, 0xD0, 0x3C, 0x0B, 0xC0, 0xBD, 0x07,
-    0xC0, 0x02, 0x80, 0xBD, 0x07, 0xD0, 0x7C, 0x0B, 0x80, 0xF0, 0x2C, 0x02, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xE0, 0x3D, 0x07, 0xC0, 0xB8, 0x0F, 0x03, 0xC0, 0x10, 0x00, 0x14, 0x1F, 0x4F, 0xC2, 0xE0,
-    0x7C, 0x0F, 0x01, 0xD0, 0x2C, 0x00, 0x40, 0x10, 0x0E, 0x03, 0x80, 0xF0, 0x3C, 0x0B, 0x42, 0xD0,
-    0x3C, 0x0F, 0x02, 0xF0, 0xBC, 0x0B, 0xD2, 0xF4, 0x1F, 0x07, 0xC0, 0x01, 0x40, 0x50, 0x2F, 0x4B,
-    0xD0, 0x7D, 0x1F, 0x41, 0xF0, 0x7C, 0x0B, 0x82, 0xE0, 0x3C, 0x0F, 0x02, 0xD0, 0xB4, 0x0D, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x7E, 0x1F, 0x80, 0xF4, 0x3D, 0x07, 0xC1, 0xF0, 0x2E,
-    0x0B, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x10, 0x04, 0x00, 0x14, 0x05, 0x07, 0xD1, 0xF4, 0xFC,
-    0x3F, 0x0B, 0x82, 0xE0, 0x7C, 0x1F, 0x03, 0xC0, 0xF0, 0x1D, 0x07, 0x40, 0xB0, 0x2C, 0x00, 0x19,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x38, 0x01, 0xFE, 0xFF, 0xDB, 0xFF,
-    0xBF, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x1F, 0xEF, 0xFD, 0x2F,
-    0xFE, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xB4,
-    0x00, 0x54, 0xB0, 0x60, 0xFF, 0xFF, 0xF0, 0xE9, 0xE6, 0xE0, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x47, 0xFC, 0xBF, 0xCB, 0xFC, 0x3F,
-    0x00, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F, 0xFF, 0xDF, 0xFF, 0x87,
-    0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x2E, 0x1F, 0xC3, 0xF0, 0x10, 0x00, 0x00, 0x03, 0xD0,
-    0x2E, 0xBE, 0x07, 0xFB, 0xC0, 0x7D, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x0B, 0xC0, 0x07, 0xCB, 0xE0, 0x03, 0xF0, 0x03, 0xF6, 0xF0, 0x00, 0xF4, 0x00, 0xFC, 0x10, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x40,
-    0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5,
-    0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
-    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x29,
-    0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x04, 0x00, 0x0A, 0x34, 0x00, 0x0A,
-    0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C, 0x70, 0x30, 0x86, 0x00, 0xC0,
-    0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00,
-    0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1C, 0xA0,
-    0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40, 0xC0, 0xA3, 0x43, 0x00, 0x92,
-    0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC0,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x02, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xC0,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0x81,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0x3E, 0x7D, 0x0F,
-    0x03, 0xD7, 0xC0, 0x7D, 0xBC, 0x0F, 0xF4, 0x2D, 0x0F, 0x02, 0xD0, 0xF0, 0x2C, 0x00, 0x00, 0x78,
-    0x1D, 0x01, 0xD2, 0xD0, 0x2D, 0x00, 0x00, 0xF0, 0x3C, 0x01, 0xD3, 0xC0, 0x2D, 0x00, 0x03, 0xC0,
-    0x3C, 0x02, 0xC3, 0xC0, 0x3C, 0x00, 0x0B, 0x80, 0x3C, 0x03, 0xC3, 0x80, 0x3C, 0x00, 0x1F, 0x00,
-    0x3C, 0x0B, 0x43, 0xC0, 0xB4, 0x00, 0x3C, 0x00, 0x3D, 0x1F, 0x03, 0xD2, 0xE0, 0x00, 0xF4, 0x00,
-    0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0B, 0x43, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0x0F, 0x83, 0xD1, 0xF0, 0xBC, 0x3E, 0x0F, 0x87, 0xC1, 0xF0,
-    0xB4, 0x3D, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x43, 0xC0,
-    0xF8, 0x3D, 0x1F, 0x47, 0xC2, 0xF0, 0xBC, 0x3E, 0x0F, 0x83, 0xD1, 0xF0, 0x7C, 0x2F, 0x0B, 0x43,
-    0xD0, 0xF0, 0x38, 0x0E, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3E, 0x02, 0xF0,
-    0x0F, 0x40, 0xBC, 0x03, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x03, 0xE0, 0xBC,
-    0x0B, 0xC0, 0xF4, 0x0F, 0x42, 0xF0, 0x2F, 0x03, 0xD0, 0x3D, 0x07, 0xC0, 0x34, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x03, 0xE0, 0xBC, 0x0F, 0x40, 0xBC, 0x0F,
-    0x43, 0xF0, 0x0F, 0x42, 0xF0, 0x7D, 0x02, 0xF0, 0x3D, 0x0B, 0xC0, 0x3D, 0x07, 0xC0, 0xF0, 0x03,
-    0x40, 0xB0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0xE0,
-    0x07, 0xC1, 0xE0, 0x7C, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xF4, 0x03, 0xD0, 0x1F,
-    0x80, 0x3E, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x0A, 0x00, 0x0E,
-    0x00, 0x2E, 0x00, 0x3E, 0x00, 0xFC, 0x0B, 0xD0, 0x7C, 0x07, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0C, 0x38, 0x02, 0x40, 0x38, 0x0E, 0x07, 0xC0, 0xE0, 0x03,
-    0x42, 0x43, 0x80, 0x01, 0xD0, 0x0F, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x04, 0x1D, 0xB0, 0x00, 0x1F,
-    0x07, 0xC1, 0xF0, 0x1F, 0x0B, 0xC0, 0xF0, 0x00, 0x1C, 0xB0, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x01,
-    0xD0, 0x0B, 0x00, 0x03, 0x43, 0x83, 0xC0, 0x0D, 0x07, 0xC0, 0xE0, 0x38, 0x02, 0x40, 0x38, 0xA0,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x0F, 0x40, 0x3D, 0x01, 0xF0,
-    0x0B, 0xC0, 0x3E, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x00, 0x3C, 0x01, 0xF0, 0x07, 0xC0, 0x2E, 0x00,
-    0xB4, 0x02, 0xD0, 0x0B, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x07,
-    0x40, 0x1D, 0x00, 0x70, 0x01, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0xB0, 0x07, 0xE0, 0x1F, 0x40, 0x7C, 0x02, 0xF0, 0x01, 0x00, 0x04, 0x00, 0x55, 0x55, 0x55,
-    0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x4F, 0xFD, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0xBD, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x3E, 0xBE, 0x03, 0xEB, 0xE1, 0x00, 0xF0,
-    0x10, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x1F, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x03,
-    0xC0, 0x07, 0xE4, 0x00, 0x7E, 0x40, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x28, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xF8,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0B, 0xE0, 0x00, 0x3D, 0x3F, 0xFC,
-    0x00, 0xBC, 0x3E, 0xBE, 0x00, 0xF8, 0x10, 0x0F, 0x00, 0xF4, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x1E,
-    0x02, 0xE0, 0x00, 0x7C, 0x02, 0xD0, 0x01, 0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x03, 0xC0, 0x1F, 0x00,
-    0x03, 0x80, 0x3C, 0x00, 0x07, 0x40, 0x7E, 0x40, 0x07, 0x00, 0x3F, 0x40, 0x07, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0B, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0xFC, 0x00,
-    0x2F, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3D, 0x01, 0xB9, 0x00, 0x1F,
-    0x00, 0xFF, 0xD0, 0x0F, 0x80, 0x7E, 0xFC, 0x03, 0xD0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0,
-    0x7C, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0xF8,
-    0x00, 0xE0, 0x00, 0xF8, 0x00, 0x38, 0x00, 0x78, 0x00, 0x1D, 0x00, 0x3E, 0x80, 0x07, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x1F, 0x80,
-    0x0F, 0x80, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0xF0, 0x3C, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B, 0xC2,
-    0xF0, 0xFC, 0x3E, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B, 0xC2, 0xE0, 0xB4, 0x3D, 0x0F, 0x03,
-    0xC0, 0xE0, 0x38, 0x0D, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x3F, 0xF4,
-    0x0F, 0x4B, 0xC2, 0xD0, 0x3C, 0x3C, 0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x07, 0x8F, 0x00, 0xB4, 0xF0,
-    0x0F, 0x0B, 0x42, 0xD0, 0x7F, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x80, 0x00,
-    0xFD, 0x00, 0x0F, 0xB0, 0x00, 0xF3, 0xC0, 0x0F, 0x0E, 0x00, 0xF0, 0x74, 0x0F, 0x96, 0xE4, 0x3F,
-    0xFF, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x02, 0x40, 0x00, 0x55, 0x40, 0x2F, 0xFC, 0x03,
-    0xD5, 0x40, 0x74, 0x00, 0x0B, 0xD0, 0x00, 0x6F, 0xC0, 0x00, 0x2E, 0x00, 0x01, 0xF0, 0x00, 0x1E,
-    0x00, 0x07, 0xC0, 0x6B, 0xF0, 0x07, 0xE4, 0x00, 0x00, 0x05, 0x80, 0x07, 0xFD, 0x02, 0xF4, 0x00,
-    0xB8, 0x00, 0x0F, 0x50, 0x02, 0xFF, 0xD0, 0x3C, 0x0F, 0x07, 0x80, 0xB4, 0x78, 0x0B, 0x43, 0xC0,
-    0xF0, 0x2F, 0xBD, 0x00, 0xBE, 0x00, 0x05, 0x55, 0x0B, 0xFF, 0xE3, 0x95, 0xF4, 0xC0, 0x78, 0x00,
-    0x38, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xA0,
-    0x00, 0x00, 0x68, 0x00, 0xFF, 0xD0, 0xF0, 0x3C, 0x38, 0x0E, 0x0F, 0x0F, 0x01, 0xFF, 0x00, 0xFB,
-    0xC0, 0xF0, 0x78, 0xB4, 0x0F, 0x2D, 0x07, 0xC7, 0xEB, 0xC0, 0x7F, 0x80, 0x00, 0x19, 0x00, 0x1F,
-    0xFC, 0x03, 0xC2, 0xE0, 0xB0, 0x0F, 0x0F, 0x00, 0xF0, 0xF4, 0x0E, 0x07, 0xEB, 0xD0, 0x0A, 0xBC,
-    0x00, 0x0F, 0x40, 0x07, 0xD0, 0x1B, 0xF4, 0x03, 0xE4, 0x00, 0x05, 0x01, 0x03, 0xF5, 0xFC, 0x07,
-    0xB7, 0xC0, 0xBC, 0x3C, 0x0F, 0x47, 0x80, 0xF0, 0xB0, 0x1D, 0x0F, 0x12, 0xC0, 0xFD, 0x2C, 0x0F,
-    0x40, 0x01, 0xFE, 0x00, 0x7F, 0xF8, 0x1F, 0x07, 0xC3, 0xC0, 0x3C, 0x7C, 0x03, 0xCB, 0x40, 0x3C,
-    0xF0, 0x07, 0x8F, 0x00, 0xB4, 0xF0, 0x1F, 0x0B, 0x87, 0xC0, 0x3F, 0xF4, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x06, 0xC1, 0xFF, 0x01, 0x7C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1E,
-    0x00, 0xB8, 0x2F, 0xFC, 0x15, 0x40, 0x00, 0x7F, 0x80, 0x2F, 0xBE, 0x07, 0x81, 0xF0, 0x20, 0x1E,
-    0x00, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x02, 0xF5, 0x54, 0x3F,
-    0xFF, 0xC0, 0x15, 0x40, 0x01, 0xFD, 0x02, 0xFB, 0xC0, 0xD0, 0xB0, 0x00, 0x3C, 0x00, 0x7D, 0x01,
-    0xFE, 0x00, 0x27, 0xD0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x6F, 0x0F, 0xFE, 0x01, 0xA4, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x1D, 0xF0, 0x01, 0xD3, 0xC0, 0x1E, 0x0E, 0x01,
-    0xE0, 0x74, 0x0F, 0xFF, 0xFC, 0x2A, 0xAF, 0x90, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x01, 0x00,
-    0x01, 0xAA, 0x80, 0x3F, 0xFC, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x1E, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x00, 0x1F, 0x80, 0xFF, 0xD0, 0x01, 0x50, 0x00, 0x00, 0x1B,
-    0xD0, 0x0F, 0xE4, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x1F, 0xA4, 0x03, 0xEB, 0xF0, 0x38, 0x0B, 0x47,
-    0x80, 0xB4, 0x38, 0x0B, 0x03, 0xD1, 0xE0, 0x1F, 0xF8, 0x00, 0x14, 0x00, 0x1A, 0xAA, 0x4F, 0xFF,
-    0xE3, 0x40, 0xF0, 0x80, 0xB0, 0x00, 0x74, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x0F, 0x00,
-    0x0B, 0x40, 0x03, 0xC0, 0x00, 0x50, 0x00, 0x01, 0xBE, 0x01, 0xE6, 0xE0, 0xF0, 0x3C, 0x38, 0x1E,
-    0x0B, 0x9E, 0x00, 0xFE, 0x01, 0xD3, 0xD1, 0xE0, 0x3C, 0xB0, 0x0F, 0x2E, 0x0B, 0x83, 0xFF, 0x80,
-    0x15, 0x00, 0x00, 0xBF, 0x40, 0x3E, 0xBC, 0x07, 0x81, 0xE0, 0xF0, 0x0F, 0x0F, 0x00, 0xF0, 0xB8,
-    0x1E, 0x02, 0xFF, 0xC0, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x1F, 0xC0, 0x3F, 0xE0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x10, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0A, 0xFA, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x07, 0xEB, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0,
-    0x01, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x6F,
-    0xEA, 0x90, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0xBD, 0x55, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x47, 0x80, 0x01, 0x40, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xD6, 0xFF, 0xF8, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x0B, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x1E, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0x02, 0xE5, 0x00, 0x69, 0x00, 0xB8, 0x03, 0xE3, 0xFF, 0xF0, 0x3F, 0xF0, 0x0F, 0x96, 0xF8,
-    0x17, 0xD4, 0x0F, 0x01, 0x00, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x3F, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x1E, 0x0E, 0x70,
-    0x2C, 0x1F, 0xE8, 0x00, 0x01, 0xFB, 0xCB, 0xDB, 0x8B, 0xFF, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xAF, 0xC0, 0x00, 0xBD, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x07, 0x40, 0x03,
-    0xD0, 0x00, 0x10, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x6F, 0xAA, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xBF, 0xAA, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x55, 0xAA,
-    0xA6, 0xFF, 0xFF, 0xFF, 0xE3, 0xD0, 0x00, 0x05, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0,
-    0x03, 0xDD, 0xF0, 0x3C, 0x70, 0xF0, 0x81, 0xD1, 0x80, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74,
-    0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07,
-    0x40, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x6A, 0xA9, 0x55, 0xF2, 0xFF, 0xFF, 0xFF, 0xE1, 0x40, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01,
-    0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x0D,
-    0x1D, 0x2C, 0x2D, 0x71, 0xE0, 0x2E, 0xEE, 0x00, 0x2F, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x74, 0x00, 0x78, 0x00, 0xB4, 0x07, 0x80, 0x00, 0xB4, 0x7D,
-    0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xF0, 0x03, 0xC0,
-    0x0F, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0xF4, 0x07, 0xDD, 0xF4, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40, 0x00, 0x1D, 0x00,
-    0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x09, 0x1D, 0x18, 0x3C, 0x74, 0xF0, 0x3D, 0xDF,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x41, 0xD0, 0x43, 0xC7, 0x4F, 0x03, 0xDD, 0xF0, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x01,
-    0x5B, 0x95, 0x2F, 0xFF, 0xFE, 0x15, 0x55, 0x50, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B,
-    0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x00, 0x3C, 0x2C, 0x03, 0xC0,
-    0xB0, 0x3C, 0x02, 0xC3, 0xE5, 0x5B, 0x1F, 0xFF, 0xFC, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
-    0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x0F, 0x00, 0x38, 0x0F, 0x00,
-    0xE0, 0x0F, 0x03, 0x95, 0x6F, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x1E, 0x00, 0x02, 0xE0,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x04, 0x00, 0x3C,
-    0x0F, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xCF, 0x40, 0x00, 0xFB, 0xEA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x15, 0x03, 0xFF, 0xFF, 0xFE, 0x3E, 0xAA, 0xAA, 0xA6,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0xF0, 0x07,
-    0xE2, 0xF4, 0x7B, 0x8B, 0xB5, 0xCE, 0x2C, 0xD0, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00,
-    0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x14, 0x50,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x50, 0x00, 0xF0, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x6A, 0xAA, 0xAA, 0xF0, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x8B, 0x00, 0x0E, 0x2C,
-    0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2,
-    0xC0, 0x03, 0x8B, 0x02, 0xCE, 0x2C, 0xE3, 0xF8, 0xBF, 0x03, 0xE2, 0xF0, 0x03, 0xDF, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x18, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0xB4, 0x00, 0xB8,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x7A, 0xAA, 0xAA, 0xB7, 0xC0, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x0B, 0x40, 0x07, 0x80, 0xB4, 0x00, 0x04, 0x00, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0x05, 0x1F, 0x80, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0xF4,
-    0x0F, 0x80, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x01, 0xF0,
-    0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2E, 0x5F, 0xD0, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x6E, 0x7E, 0x00, 0xBF, 0xFF, 0x80, 0xF8, 0x07,
-    0xE0, 0xB8, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x0F, 0x40, 0x07, 0xC3, 0xD0, 0x02,
-    0xE0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0xB8, 0x0F, 0xC0, 0x7C, 0x01, 0xFE, 0xFC, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x53, 0xFF, 0xFF, 0xFB, 0xAA, 0xAF, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x7A, 0xAA, 0xFD, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x01,
-    0xC0, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x3F, 0xE5, 0xBF, 0xF0, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x2F,
-    0x00, 0x00, 0xFF, 0x00, 0xF4, 0x00, 0x0F, 0x7D, 0x0B, 0xC0, 0x00, 0xF4, 0xB8, 0x3E, 0x00, 0x0F,
-    0x41, 0xF0, 0xF4, 0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x0F, 0x80, 0x1F, 0x0F, 0x40, 0xB8, 0x00, 0x7C,
-    0x3E, 0x0B, 0x80, 0x02, 0xF0, 0xBC, 0xB8, 0x00, 0x0F, 0x81, 0xFB, 0x80, 0x00, 0x7C, 0x03, 0xFC,
-    0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xFE, 0xBF, 0xE0, 0x07, 0xC2, 0xFF, 0xFD,
-    0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x3C,
-    0x2F, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0xB4, 0x0F, 0x80, 0x00, 0xF0, 0x0B, 0xC0, 0x02, 0xE0,
-    0x07, 0xD0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x40, 0x01, 0xF4, 0x0F, 0x00,
-    0x00, 0xF8, 0x2E, 0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x05, 0x55,
-    0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x6B, 0xF0, 0xBD, 0x00, 0x00, 0xF4, 0x0F,
-    0x80, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x07, 0xC0,
-    0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x01, 0xF4, 0x3C,
-    0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFA, 0xAA, 0xA0, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xD0, 0x55, 0x55, 0x50, 0xF4, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x05, 0x7D, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0xAF, 0xA8, 0x07, 0xF0, 0x03,
-    0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x1E, 0x00, 0x0F, 0xAA, 0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x16, 0xE5, 0x54, 0x3D,
-    0x00, 0xB4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x3F, 0x0B, 0x40, 0x00,
-    0x03, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xEA, 0xAA, 0xAF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xAA,
-    0xAB, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2A, 0xAA, 0xAA, 0xAF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0x55, 0x55, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0xF5, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0xAB, 0xEA, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x2D, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x03,
-    0xE0, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x0F, 0x0A, 0xAF, 0xEA, 0xAB, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x55, 0x6E, 0x50, 0x7C, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0xC0, 0x00,
-    0x2D, 0x03, 0xD0, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0xFB, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0xAA, 0xAA, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x55, 0x55,
-    0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xAB, 0xF4, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x6F, 0xF8, 0x01, 0xBF,
-    0xE3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xD2, 0xFE, 0xAA,
-    0xAF, 0x43, 0xF4, 0x00, 0x2E, 0x07, 0xF0, 0x00, 0x38, 0x0B, 0xE0, 0x00, 0x80, 0x0B, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x14, 0x1F, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x07, 0xCF, 0xD5, 0x55,
-    0xBE, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xC0,
-    0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00,
-    0x00, 0xF0, 0x00, 0x0B, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00,
-    0x0F, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x24, 0x38, 0x24, 0x7E, 0x39, 0xFC, 0x0B, 0xFF, 0xD0,
-    0x00, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0x39, 0xF8, 0x34, 0x38, 0x28, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xFF, 0x42, 0xE5, 0xF4, 0xF0, 0x1E, 0x78, 0x03,
-    0xCE, 0x00, 0xE3, 0xD0, 0xB4, 0x7F, 0xF8, 0x01, 0xA0, 0x00, 0x14, 0xFD, 0xFD, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0xAA, 0x80, 0x0B, 0x40, 0xFF, 0xC0, 0x0F, 0x00, 0x57, 0xD0,
-    0x1F, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF8,
-    0xB8, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x02, 0xD1, 0xFF, 0xE2, 0xE0, 0xF0, 0x2E, 0xD0, 0x38, 0x03, 0xE0, 0x0E, 0x00,
-    0xB8, 0x03, 0xC0, 0x7B, 0x40, 0xBE, 0xF8, 0xF8, 0x0B, 0xF4, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x38, 0x0F, 0xF0, 0x3C, 0x74, 0x07, 0xC0, 0x2C, 0x74,
-    0x07, 0xC0, 0x2C, 0x78, 0x0E, 0xF0, 0x3C, 0x3E, 0xBC, 0x7E, 0xF4, 0x0F, 0xE0, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3D,
-    0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD,
-    0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x53, 0xDF, 0x7D, 0xF7,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF6, 0x80,
-    0x14, 0x04, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E,
-    0x3C, 0x2E, 0x28, 0x19, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x02, 0xD1,
-    0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x78, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x3D, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x2E, 0x00,
-    0xF8, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x03,
-    0xC0, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x80, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02, 0xE0, 0x3D, 0x00,
-    0x00, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07,
-    0x80, 0x0B, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0xB8, 0x00,
-    0x00, 0xF0, 0x3C, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x03, 0xCF, 0x40, 0x00, 0x00, 0xF7, 0xC0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x6A,
-    0xA4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x56, 0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x3D, 0x00, 0x01,
-    0xF1, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5,
-    0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0,
-    0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00,
-    0x03, 0xD0, 0x14, 0x00, 0x00, 0x51, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D,
-    0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C,
-    0x00, 0x00, 0xF4, 0xF0, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2F, 0x0B, 0xD0, 0x01, 0xF8, 0x0B, 0xFA,
-    0xBF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xF4, 0x24, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x2E, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x7F, 0xF4,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x10, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x83, 0xF1,
-    0xF8, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0B, 0xD3, 0xF4, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00,
-    0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x3F, 0xF8, 0x02, 0xC3, 0xE5, 0xFF, 0xBD, 0x0D, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x0A, 0x40,
-    0x04, 0x3F, 0xF4, 0x2D, 0xB9, 0xBF, 0xFC, 0xB0, 0x1F, 0xF4, 0x00, 0x00, 0x40, 0x2F, 0xE0, 0x1D,
-    0x7F, 0xFE, 0x7C, 0xF0, 0x2F, 0xF8, 0x10, 0x02, 0x90, 0x24, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x03,
-    0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x07, 0x42, 0xAA, 0xBE, 0x9F,
-    0xFF, 0xFF, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00, 0x1F, 0xFF, 0xFF, 0x2B, 0xEA, 0xA8,
-    0x2C, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x20, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xD0, 0x06, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x02, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02,
-    0xFD, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F,
-    0x80, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-    0xE0, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00,
-    0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD,
-    0x00, 0xBF, 0x40, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x57, 0xD5, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA,
-    0xFA, 0xA0, 0x3F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0,
-    0x03, 0xC0, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x02,
-    0xF0, 0x1E, 0x00, 0x00, 0x3F, 0x4F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF,
-    0xD0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x55, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xAA, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0xF0, 0x07,
-    0xC0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80,
-    0x0B, 0xC0, 0x02, 0xD0, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0x90, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x4B, 0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x47, 0x47, 0xD0,
-    0x01, 0xE0, 0x1D, 0x02, 0xD0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0xB0, 0x01, 0xD0, 0x03, 0x83, 0x80,
-    0x07, 0x40, 0x0B, 0x1C, 0x00, 0x1D, 0x00, 0x1D, 0x75, 0x55, 0xB9, 0x55, 0x76, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE7, 0x40, 0x07, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x00, 0x1D, 0x38, 0x00, 0x74, 0x00, 0xB0,
-    0xB0, 0x01, 0xD0, 0x03, 0x80, 0xE0, 0x07, 0x40, 0x3C, 0x01, 0xE0, 0x1D, 0x03, 0xD0, 0x01, 0xF8,
-    0x74, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xE0, 0x00, 0x02, 0xD0,
-    0x0E, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x0B, 0x1C, 0x00,
-    0x00, 0x00, 0x1D, 0x75, 0x55, 0x55, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x40, 0x00, 0x00,
-    0x07, 0x5D, 0x00, 0x00, 0x00, 0x1D, 0x38, 0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x03, 0x80,
-    0xF0, 0x00, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0,
-    0xB2, 0xE0, 0x02, 0xD3, 0x83, 0x82, 0xE0, 0x2D, 0x0B, 0x1C, 0x02, 0xE2, 0xD0, 0x1D, 0x70, 0x02,
-    0xFD, 0x00, 0x36, 0xC0, 0x03, 0xF0, 0x00, 0xE7, 0x00, 0x2E, 0xE0, 0x03, 0x5D, 0x02, 0xD2, 0xE0,
-    0x1D, 0x38, 0x2D, 0x02, 0xE0, 0xB0, 0xB2, 0xD0, 0x02, 0xE3, 0x80, 0xFD, 0x00, 0x02, 0xFC, 0x01,
-    0xF0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x0E, 0x00, 0x00, 0x2F, 0xC0, 0xB0, 0x00, 0x02, 0xD3, 0x83,
-    0x80, 0x00, 0x2D, 0x0B, 0x1D, 0x00, 0x02, 0xD0, 0x1D, 0x70, 0x00, 0x2D, 0x00, 0x36, 0xC0, 0x02,
-    0xD0, 0x00, 0xE7, 0x00, 0x2D, 0x00, 0x03, 0x5D, 0x02, 0xD0, 0x00, 0x1D, 0x38, 0x2D, 0x00, 0x00,
-    0xB0, 0xB2, 0xD0, 0x00, 0x03, 0x80, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x01,
-    0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x10, 0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B,
-    0xDB, 0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80,
-    0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00,
+static const uint8_t bookerly_12_italicBitmaps[32482] = {
+    0x49, 0x93, 0xD9, 0x29, 0xD3, 0xDA, 0x3D, 0x93, 0xD3, 0x9D, 0x3A, 0xC9, 0x3A, 0xC4, 0xD4, 0xCA,
+    0x4C, 0xA3, 0x9C, 0x93, 0x9C, 0x77, 0x29, 0xC9, 0x29, 0xDA, 0x29, 0xD4, 0x94, 0x1A, 0xA1, 0x9C,
+    0x1A, 0xCA, 0x09, 0xD1, 0xD9, 0x0A, 0xCA, 0x1D, 0x1A, 0xC9, 0x1C, 0xA1, 0xD2, 0xC9, 0x1C, 0xA1,
+    0x9C, 0x2C, 0x91, 0x99, 0x29, 0x20, 0x5C, 0xA2, 0xAC, 0x70, 0xC9, 0x2C, 0xA7, 0x9C, 0x92, 0xC9,
+    0x7A, 0xC2, 0xAC, 0x5F, 0xFF, 0xC2, 0x99, 0xAC, 0xA9, 0x99, 0xD9, 0x99, 0x49, 0xC9, 0x2C, 0x97,
+    0xAC, 0x29, 0xC7, 0x0D, 0x2A, 0xC5, 0x99, 0x9D, 0x99, 0x9D, 0x99, 0x91, 0x9F, 0xFF, 0xA4, 0xAC,
+    0x29, 0xC9, 0x7D, 0x2A, 0xC7, 0x0C, 0xA2, 0xD7, 0x9C, 0x92, 0xCA, 0x50, 0x71, 0xC9, 0x73, 0x9C,
+    0x74, 0xAC, 0x72, 0x9A, 0xD9, 0x7A, 0xFE, 0x94, 0xAC, 0xA0, 0x9C, 0x9E, 0x4D, 0x1A, 0xC1, 0xD9,
+    0x29, 0xD1, 0xCA, 0x1D, 0x39, 0xD1, 0xC9, 0x70, 0xE9, 0xC7, 0x1A, 0xF7, 0x29, 0xF9, 0x72, 0xF9,
+    0x70, 0x9C, 0x9E, 0x49, 0x2A, 0xC1, 0xDA, 0x2D, 0x2C, 0xA1, 0xDA, 0x2D, 0x91, 0xC9, 0x1D, 0xA2,
+    0xE0, 0x9C, 0x1A, 0xD3, 0x9F, 0xCA, 0xE9, 0x5A, 0xFC, 0xA7, 0x1C, 0xA7, 0x39, 0xC7, 0x4D, 0x74,
+    0xD7, 0x4A, 0x97, 0x00, 0x77, 0x72, 0x97, 0x19, 0xC6, 0x9F, 0x96, 0xD5, 0xAC, 0xA0, 0x9D, 0x5D,
+    0x95, 0xD2, 0xAC, 0x4A, 0xCA, 0x5A, 0xC3, 0xAC, 0x92, 0x9D, 0x6D, 0x3A, 0xC3, 0xD7, 0xCA, 0x3D,
+    0x2A, 0xC9, 0x69, 0xCA, 0x3C, 0xA1, 0x9C, 0xA7, 0x0D, 0x2D, 0x2D, 0x2A, 0xE9, 0x1D, 0xA9, 0xD9,
+    0x1D, 0x2D, 0x99, 0xD2, 0xF9, 0x1A, 0xC9, 0x1D, 0x2A, 0xC9, 0x79, 0xCA, 0x19, 0xC9, 0x29, 0xC9,
+    0x7D, 0x2D, 0x39, 0xC9, 0x6D, 0x3D, 0x3A, 0xC6, 0xAC, 0xA3, 0xD3, 0xD5, 0x9D, 0x4D, 0x2A, 0xC9,
+    0x5D, 0x5D, 0x90, 0x9D, 0x5D, 0x96, 0xFA, 0x6A, 0xA7, 0x09, 0x97, 0x77, 0x20, 0x77, 0x74, 0xAE,
+    0xA7, 0x6D, 0xAA, 0xD7, 0x5A, 0xC9, 0x1A, 0xC9, 0x74, 0xD2, 0xAC, 0x74, 0x9C, 0xA1, 0x9C, 0xA7,
+    0x4A, 0xCA, 0x09, 0xD6, 0x95, 0xAC, 0xAD, 0xA6, 0x9C, 0x5E, 0xA6, 0x9A, 0xD3, 0x9E, 0xA3, 0x9A,
+    0xFA, 0x39, 0xCA, 0x9D, 0x2F, 0xC9, 0x5C, 0xA1, 0xD9, 0x09, 0xCA, 0x9C, 0x95, 0xD2, 0x9D, 0x3A,
+    0xC6, 0xD3, 0xDA, 0x2D, 0x6C, 0xA4, 0xDA, 0x0A, 0xC9, 0x6D, 0x49, 0xFA, 0x7D, 0xA4, 0xAE, 0x70,
+    0x9F, 0xAF, 0xEA, 0x79, 0xFD, 0xA1, 0xFA, 0x97, 0x79, 0xFA, 0x77, 0x60, 0x1A, 0xA0, 0xAC, 0xA0,
+    0xD9, 0x0D, 0x1C, 0xA1, 0xC9, 0x09, 0xC1, 0x99, 0x10, 0x70, 0xA7, 0xAD, 0x6D, 0xA6, 0xD9, 0x6D,
+    0x96, 0xAC, 0xA6, 0x9D, 0x7D, 0x79, 0xCA, 0x7D, 0x97, 0xD7, 0x9C, 0xA7, 0xAC, 0xA7, 0xAC, 0x97,
+    0xAC, 0x97, 0xAC, 0x97, 0xAC, 0xA7, 0x9D, 0x70, 0xD7, 0x0A, 0xC9, 0x70, 0xD7, 0x0A, 0xC9, 0x70,
+    0xD9, 0x70, 0xD7, 0x1A, 0x40, 0x4A, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x70, 0xAC,
+    0xA7, 0x0D, 0x70, 0xD7, 0x0A, 0xC9, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xC9, 0x7D, 0x70,
+    0xD7, 0x9C, 0xA7, 0xD7, 0x9C, 0xA7, 0xD7, 0xAC, 0x96, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xD9,
+    0x69, 0xA7, 0x00, 0x74, 0xAC, 0x92, 0xCA, 0x0A, 0xC2, 0x9D, 0xAC, 0xA4, 0x9D, 0xAD, 0x91, 0xAD,
+    0xAA, 0xC9, 0x9D, 0x9C, 0xA3, 0xA9, 0x0A, 0xC6, 0xAC, 0x20, 0x4C, 0xA7, 0x0D, 0x70, 0xD7, 0x0D,
+    0x49, 0x99, 0x9D, 0x99, 0x99, 0x9F, 0xFD, 0x09, 0x99, 0x9D, 0x99, 0x99, 0x4D, 0x70, 0xD7, 0x0D,
+    0x70, 0xCA, 0x30, 0x70, 0xDA, 0x2E, 0x2A, 0xCA, 0x2D, 0x91, 0x9C, 0xA1, 0x9D, 0x19, 0xCA, 0x70,
+    0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x4A, 0xCA, 0x9E, 0x9D, 0x90, 0x91,
+    0x72, 0x9C, 0xA7, 0x2D, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0xD9, 0x71, 0x9C, 0xA7, 0x2D, 0x72, 0xAC,
+    0x97, 0x2D, 0x72, 0xD9, 0x71, 0x9C, 0xA7, 0x2D, 0x72, 0xAC, 0xA7, 0x2D, 0x72, 0xAC, 0x97, 0x19,
+    0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD7, 0x77, 0x00, 0x70, 0x99, 0x71, 0x9F, 0xD6, 0xAE, 0xAF,
+    0x4E, 0x3A, 0xD9, 0x2A, 0xD5, 0xDA, 0x2D, 0x95, 0xE1, 0xAD, 0x6E, 0x1D, 0x96, 0xDA, 0x0A, 0xD7,
+    0xDA, 0x0E, 0x7D, 0x90, 0xDA, 0x69, 0xD1, 0xD9, 0x6E, 0x1D, 0x96, 0xD9, 0x1D, 0x95, 0xAD, 0x2D,
+    0xA4, 0x9D, 0x3E, 0x92, 0xAD, 0x93, 0x9F, 0xF9, 0x59, 0xFC, 0xA7, 0x74, 0x76, 0x9A, 0xD3, 0xAF,
+    0xC3, 0xFC, 0xA6, 0xD9, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xD6,
+    0xDA, 0x6D, 0x95, 0x9D, 0x49, 0xAF, 0xA1, 0xAF, 0xE9, 0x00, 0x70, 0x97, 0x1A, 0xFC, 0x94, 0xAE,
+    0xAF, 0x92, 0x9D, 0xA2, 0x9E, 0x2D, 0x94, 0xE2, 0x9A, 0x5E, 0x72, 0xDA, 0x71, 0xE7, 0x1A, 0xD9,
+    0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xAD,
+    0xA9, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xE9, 0x0A, 0xFF, 0xDA, 0x10, 0x79, 0x97, 0x09, 0xFD, 0x5A,
+    0xEA, 0xF3, 0x9D, 0x92, 0x9D, 0x92, 0xAC, 0x5D, 0x93, 0x94, 0x9D, 0x72, 0xDA, 0x70, 0x9D, 0xA7,
+    0x9E, 0x96, 0x9F, 0xD9, 0x6A, 0x99, 0xAE, 0x72, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x71, 0xAD,
+    0xA7, 0x9F, 0x29, 0xAA, 0xFD, 0xA4, 0xFD, 0xA7, 0x73, 0x73, 0x97, 0x39, 0xDA, 0x71, 0x9E, 0x97,
+    0x09, 0xF7, 0x1D, 0x9D, 0x70, 0xD9, 0x9D, 0x7D, 0x90, 0xAC, 0xA6, 0xD9, 0x1D, 0x95, 0xD9, 0x2D,
+    0x5D, 0xA2, 0x9D, 0x4D, 0xA3, 0xAC, 0xA3, 0xDA, 0x4D, 0xA2, 0xAF, 0xFF, 0xC0, 0x9F, 0xFF, 0xA7,
+    0x0A, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD4, 0x77, 0x19, 0xFF, 0x4A, 0xFF, 0x4D, 0x97, 0x19,
+    0xD7, 0x2A, 0xCA, 0x72, 0xE9, 0x71, 0xFC, 0xA7, 0x99, 0xAF, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0xDA, 0x71, 0xE7, 0x0A, 0xE4, 0xAA, 0xAF, 0xC5, 0xAF, 0xA9, 0x77, 0x40, 0x73,
+    0x97, 0x19, 0xFC, 0x69, 0xFA, 0x96, 0xAE, 0x97, 0x0A, 0xDA, 0x71, 0xAD, 0x97, 0x19, 0xDA, 0x72,
+    0xEA, 0xAA, 0xA9, 0x59, 0xFF, 0xA4, 0xDA, 0x29, 0xAD, 0xA3, 0xD9, 0x4E, 0x29, 0xD5, 0xAD, 0x29,
+    0xD5, 0xAD, 0x29, 0xD5, 0xAD, 0x29, 0xD9, 0x4D, 0x93, 0xE3, 0xE4, 0x9E, 0xAA, 0xE6, 0x9F, 0xCA,
+    0x77, 0x40, 0x75, 0x9F, 0xFD, 0xA0, 0xFF, 0xEA, 0x0D, 0x5A, 0xD0, 0x9C, 0xA4, 0x9D, 0x19, 0xC4,
+    0x9D, 0x71, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x1D,
+    0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xAD, 0x71, 0xAC, 0xA7, 0x29, 0x72, 0x79, 0x97, 0x09, 0xFC, 0xA5,
+    0xAD, 0xA9, 0xAE, 0x3A, 0xD3, 0x9D, 0x3D, 0x94, 0xD3, 0xD9, 0x39, 0xD3, 0xDA, 0x3D, 0x93, 0xAD,
+    0xA0, 0x9D, 0x95, 0xAF, 0xC7, 0xAF, 0xA5, 0x9D, 0xA0, 0xEA, 0x39, 0xD3, 0xAD, 0x92, 0xD9, 0x4E,
+    0x1A, 0xD5, 0xE1, 0xAD, 0x5D, 0xA1, 0xAD, 0x93, 0xE3, 0xFA, 0xF5, 0xAF, 0xCA, 0x77, 0x20, 0x79,
+    0x97, 0x19, 0xFD, 0x69, 0xEA, 0xAE, 0x49, 0xDA, 0x29, 0xDA, 0x3D, 0xA4, 0xAD, 0x3D, 0x94, 0xAD,
+    0x29, 0xD5, 0xAD, 0x29, 0xD5, 0xAD, 0x29, 0xDA, 0x4D, 0xA3, 0xEA, 0x90, 0x99, 0xD9, 0x4F, 0xFC,
+    0x69, 0xAA, 0xAA, 0xD9, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x1A, 0xE6, 0x99, 0xAE, 0xA6, 0x9F, 0xA7,
+    0x29, 0x73, 0x39, 0x93, 0xE3, 0xE3, 0xD7, 0x77, 0x77, 0x4A, 0xCA, 0x29, 0xE2, 0x9D, 0x93, 0x94,
+    0x59, 0x95, 0xE5, 0xE5, 0xD9, 0x77, 0x77, 0x77, 0x71, 0xDA, 0x5E, 0x5A, 0xCA, 0x5D, 0x94, 0x9C,
+    0xA4, 0x9D, 0x49, 0xCA, 0x76, 0x77, 0x39, 0xC9, 0x69, 0xEA, 0x49, 0xF9, 0x39, 0xF9, 0x4E, 0xA6,
+    0x9D, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x0A, 0xEA, 0x70, 0xAE, 0x71, 0xA9, 0x74, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xD7, 0x77, 0x70, 0x9F, 0xFD, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+    0x74, 0xC9, 0x70, 0x9E, 0x97, 0x9F, 0x97, 0x9F, 0x97, 0x9E, 0xA7, 0x09, 0xE6, 0x9E, 0xA4, 0x9E,
+    0xA4, 0xAE, 0xA5, 0xEA, 0x7A, 0xA7, 0x74, 0x1A, 0xDA, 0x2F, 0xD1, 0xDA, 0xAD, 0xA0, 0x93, 0xD5,
+    0xD4, 0x9C, 0xA3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD4, 0xD4, 0x9D, 0xA9, 0x3E, 0x94, 0x97, 0x5A,
+    0xA4, 0xAD, 0x4E, 0x59, 0x50, 0x77, 0x77, 0x0A, 0xFD, 0xA7, 0x39, 0xFF, 0xEA, 0x70, 0xEA, 0x95,
+    0x9E, 0x59, 0xDA, 0x72, 0xD9, 0x39, 0xD9, 0x73, 0x9D, 0x3D, 0x93, 0xAD, 0xA0, 0xAA, 0x2D, 0x2A,
+    0xC9, 0x3F, 0xE9, 0x2A, 0xC9, 0x1D, 0x3D, 0x91, 0x9D, 0x3A, 0xC9, 0x0A, 0xC9, 0x29, 0xCA, 0x3D,
+    0x3D, 0x1D, 0x3D, 0x39, 0xC9, 0x3D, 0x1D, 0x3D, 0x3A, 0xC3, 0x9C, 0xA0, 0x9C, 0xA2, 0x9C, 0xA3,
+    0xD3, 0xD1, 0x9C, 0xA2, 0xAC, 0xA2, 0xE2, 0xAC, 0xA1, 0x9C, 0xA2, 0x9D, 0x1C, 0xAD, 0x1A, 0xD2,
+    0x9C, 0xA2, 0x9F, 0xC0, 0xFC, 0xA3, 0x9D, 0x3A, 0xDA, 0x19, 0xDA, 0x95, 0xD9, 0x77, 0x3A, 0xD7,
+    0x74, 0xE7, 0x1A, 0x71, 0xEA, 0x99, 0x19, 0x9A, 0xD7, 0x2A, 0xFF, 0xCA, 0x75, 0x9A, 0xAA, 0xA9,
+    0x72, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D,
+    0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA,
+    0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7,
+    0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x59, 0xAA, 0xAA, 0x96,
+    0x9F, 0xFC, 0xA4, 0x9A, 0x9D, 0x91, 0xAD, 0xA5, 0x9D, 0x3A, 0xD5, 0xAD, 0x39, 0xD5, 0xAC, 0xA3,
+    0x9D, 0x5D, 0x93, 0xDA, 0x5D, 0x3A, 0xD5, 0x9F, 0xEA, 0x6A, 0xDA, 0xAF, 0xA5, 0xDA, 0x3A, 0xD9,
+    0x4D, 0x94, 0xDA, 0x4D, 0x5A, 0xCA, 0x39, 0xD5, 0xDA, 0x3A, 0xCA, 0x49, 0xD9, 0x3D, 0x94, 0xDA,
+    0x29, 0xAE, 0xAA, 0xAE, 0xA2, 0x9F, 0xFC, 0xA7, 0x74, 0x69, 0x9A, 0xA9, 0x96, 0xAF, 0xF9, 0x3E,
+    0xA9, 0x9A, 0xEA, 0x2E, 0x5A, 0xC9, 0x1E, 0x6A, 0xC1, 0x9D, 0x7A, 0xA1, 0xDA, 0x72, 0x9D, 0x73,
+    0xAD, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xDA, 0x7C, 0x2F, 0x92,
+    0x9A, 0xD3, 0xFF, 0xD5, 0xAF, 0xD9, 0x77, 0x20, 0x59, 0x9A, 0xAA, 0x99, 0x71, 0xFF, 0xDA, 0x69,
+    0xA9, 0xD9, 0x09, 0x9F, 0x96, 0x9D, 0x49, 0xE6, 0xAD, 0x59, 0xDA, 0x5A, 0xCA, 0x6E, 0x5D, 0x96,
+    0xAD, 0x5D, 0x79, 0xD4, 0x9D, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xDA, 0x7D, 0xA4, 0xD9, 0x7D, 0x94,
+    0xD7, 0xAD, 0x49, 0xD6, 0x9D, 0x94, 0xAD, 0x6D, 0xA5, 0xDA, 0x4A, 0xDA, 0x49, 0xAE, 0xAA, 0xAF,
+    0x94, 0x9F, 0xFC, 0xA9, 0x77, 0x71, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D,
+    0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59,
+    0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD,
+    0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x39, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x4F, 0xFE, 0x59, 0xDA, 0xAA, 0xAA, 0xD5, 0x9D, 0x4C, 0xA5, 0xAD, 0x4C, 0x95, 0xAC, 0xA7,
+    0x4D, 0x97, 0x4D, 0x97, 0x39, 0xDA, 0xAA, 0xAA, 0x96, 0xAF, 0xE9, 0x6D, 0xA7, 0x4D, 0x97, 0x4D,
+    0x74, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x72, 0x9A, 0xEA, 0x97, 0x9F, 0xE7, 0x69, 0x9A, 0xA9, 0x97,
+    0xAF, 0xFC, 0x4E, 0xA9, 0x9A, 0xAE, 0x3E, 0x6D, 0x2E, 0x7C, 0xA1, 0x9D, 0x70, 0xC2, 0xDA, 0x73,
+    0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x5F, 0xD9, 0xDA, 0x69, 0xAD, 0xA0, 0xE7, 0x0D, 0x1A,
+    0xD7, 0x9D, 0x19, 0xE6, 0xAC, 0xA2, 0xF5, 0xDA, 0x3F, 0xFE, 0x94, 0x9F, 0xEA, 0x77, 0x30, 0x39,
+    0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x94, 0xFD, 0x92, 0x9F, 0xD9, 0x49, 0xDA, 0x6A, 0xD9, 0x69,
+    0xD7, 0xAD, 0x7A, 0xD7, 0xDA, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7D, 0x70, 0xD9, 0x69, 0xD7, 0x9F,
+    0xFF, 0xC7, 0xAF, 0xFF, 0xA7, 0xDA, 0x7D, 0x97, 0xD9, 0x69, 0xD7, 0x0D, 0x7A, 0xD7, 0x9D, 0x7A,
+    0xCA, 0x7A, 0xD7, 0xD9, 0x7D, 0xA7, 0xD9, 0x59, 0xAE, 0xA4, 0x9E, 0xA9, 0x39, 0xFD, 0x92, 0xAF,
+    0xD3, 0x39, 0x99, 0x99, 0x99, 0x3F, 0xDA, 0x49, 0xDA, 0x69, 0xD7, 0xAD, 0x7A, 0xCA, 0x7D, 0x97,
+    0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAD, 0x7D, 0xA5, 0x9A, 0xEA, 0x39,
+    0xFD, 0x92, 0x79, 0x99, 0x99, 0x99, 0x70, 0xFD, 0xA7, 0x19, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74,
+    0xAD, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97,
+    0x4D, 0x74, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x4D, 0x97, 0xDA, 0xAD, 0xA7,
+    0x0F, 0xCA, 0x72, 0xAA, 0xA9, 0x71, 0x39, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x4F, 0xD9, 0x1F,
+    0xD5, 0x9D, 0xA4, 0xE9, 0x69, 0xD4, 0xDA, 0x70, 0xAD, 0x29, 0xD9, 0x71, 0xAC, 0xA1, 0x9D, 0x97,
+    0x2D, 0x90, 0xAD, 0x74, 0xD9, 0xAD, 0x74, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xDA, 0x9D, 0x97, 0x4D,
+    0x90, 0xAD, 0x74, 0xD2, 0xE7, 0x29, 0xD2, 0x9D, 0xA7, 0x1A, 0xD3, 0xAD, 0xA7, 0x0D, 0xA4, 0xEA,
+    0x59, 0xAE, 0xA9, 0x3F, 0x39, 0xFD, 0xA4, 0xF7, 0x76, 0x39, 0x99, 0x99, 0x99, 0x7F, 0xDA, 0x70,
+    0x9D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD,
+    0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD6, 0xC9, 0x2A, 0xD5, 0xAC, 0x3D, 0xA4, 0x9D, 0x19,
+    0xAF, 0xFD, 0x90, 0x9F, 0xFF, 0x10, 0x59, 0x99, 0x99, 0x79, 0x99, 0x99, 0x59, 0xFC, 0x69, 0xFC,
+    0x7A, 0xE9, 0x5F, 0x97, 0x0F, 0x94, 0xAF, 0x71, 0xDA, 0xCA, 0x4D, 0x9D, 0x70, 0x9C, 0xAA, 0xCA,
+    0x3A, 0xC9, 0xAD, 0x70, 0xAC, 0x99, 0xD3, 0xD0, 0xAC, 0xA7, 0x0D, 0x09, 0xD2, 0xAC, 0x1A, 0xCA,
+    0x79, 0xCA, 0x1D, 0x2C, 0xA1, 0xAC, 0xA7, 0xAC, 0x91, 0xD9, 0x0D, 0x2D, 0x97, 0xD2, 0xDA, 0x9C,
+    0xA2, 0xD9, 0x7D, 0x2A, 0xCA, 0xD3, 0xD9, 0x6A, 0xCA, 0x29, 0xE9, 0x3D, 0x96, 0xD9, 0x3E, 0x4D,
+    0x7D, 0x4D, 0x94, 0xD6, 0x9C, 0xA4, 0xAA, 0x49, 0xD5, 0x9E, 0x97, 0x19, 0xEA, 0x92, 0xFD, 0x70,
+    0xAF, 0xD1, 0x39, 0x99, 0x96, 0x99, 0x99, 0x99, 0x3F, 0x94, 0x9F, 0xCA, 0x4A, 0xDA, 0x6A, 0xCA,
+    0x69, 0xE6, 0xAC, 0x96, 0xAE, 0xA5, 0xD7, 0xDA, 0xD5, 0xD7, 0xD0, 0xDA, 0x39, 0xCA, 0x7D, 0x0A,
+    0xD3, 0xAC, 0x96, 0x9C, 0xA1, 0xD9, 0x2D, 0x96, 0xAC, 0x91, 0xAD, 0x2D, 0x7D, 0x3D, 0x91, 0xD7,
+    0xD3, 0xDA, 0x09, 0xCA, 0x69, 0xD3, 0x9D, 0x0A, 0xC9, 0x69, 0xCA, 0x4D, 0xAD, 0x7A, 0xC9, 0x49,
+    0xF7, 0xD6, 0xF6, 0xAD, 0xA9, 0x49, 0xDA, 0x49, 0xFD, 0x5D, 0x97, 0x77, 0x10, 0x79, 0xAA, 0x97,
+    0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90,
+    0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0,
+    0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E,
+    0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76, 0x59, 0x9A, 0xAA, 0x96, 0x9F, 0xFC, 0xA4, 0x9A, 0x9D,
+    0x91, 0xAD, 0xA5, 0x9D, 0x39, 0xD5, 0xAD, 0x4D, 0x94, 0xAC, 0xA4, 0xD9, 0x4D, 0x93, 0x9D, 0x5D,
+    0x4D, 0xA4, 0x9D, 0x3E, 0x5A, 0xD9, 0xAA, 0xDA, 0x6F, 0xDA, 0x97, 0xD9, 0x74, 0xD7, 0x49, 0xD7,
+    0x4A, 0xD7, 0x4D, 0xA7, 0x29, 0xAE, 0xA9, 0x79, 0xFE, 0x70, 0x69, 0x9A, 0xA9, 0x75, 0x9F, 0xEA,
+    0x72, 0xEA, 0x99, 0x9A, 0xE7, 0x0E, 0x59, 0xDA, 0x6E, 0x7E, 0x59, 0xD7, 0x09, 0xD5, 0xDA, 0x70,
+    0x9D, 0x93, 0x9D, 0x72, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA, 0x71, 0x9D, 0x4D, 0xA7, 0x1A, 0xD4,
+    0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x09, 0xD5, 0xAD, 0x70, 0xDA, 0x59, 0xD9, 0x6E, 0x7E, 0x93, 0x9E,
+    0x71, 0xFA, 0xAE, 0xA7, 0x3F, 0xDA, 0x76, 0xAE, 0x97, 0x71, 0xAE, 0x97, 0x70, 0x9F, 0xA9, 0x77,
+    0x9F, 0xFA, 0xC7, 0x4A, 0xFD, 0xA7, 0x79, 0x99, 0x20, 0x59, 0x9A, 0xAA, 0x97, 0x9F, 0xFC, 0xA5,
+    0x9A, 0x9D, 0x90, 0x9A, 0xD9, 0x69, 0xD3, 0xE6, 0xAD, 0x39, 0xD6, 0xAC, 0xA3, 0x9D, 0x6D, 0x93,
+    0xDA, 0x6D, 0x3A, 0xD6, 0x9D, 0x19, 0xE9, 0x6A, 0xFD, 0xA7, 0x0E, 0xAD, 0x97, 0x1D, 0x90, 0xAD,
+    0x71, 0xD2, 0xD9, 0x79, 0xD2, 0xAD, 0x7A, 0xCA, 0x3D, 0xA6, 0xDA, 0x39, 0xDA, 0x39, 0xAE, 0xA9,
+    0x2A, 0xE1, 0x9F, 0xDA, 0x39, 0xE7, 0x71, 0x59, 0xAA, 0x99, 0x5A, 0xFE, 0x92, 0xAD, 0x90, 0x99,
+    0xD9, 0x19, 0xD4, 0xAC, 0x91, 0xAD, 0x4A, 0xC2, 0xAD, 0x49, 0x92, 0xAD, 0x97, 0x1E, 0xA7, 0x09,
+    0xF9, 0x70, 0xFA, 0x70, 0x9E, 0xA7, 0x1E, 0x2A, 0x59, 0xD9, 0x09, 0xC9, 0x5D, 0x90, 0xAC, 0x94,
+    0x9D, 0x1A, 0xD4, 0xDA, 0x1A, 0xEA, 0xAA, 0xE3, 0x9F, 0xD9, 0x77, 0x00, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xFC, 0xAA, 0xCA, 0xAA, 0xAE, 0xAA, 0xAD, 0x9D, 0x3D, 0x92, 0xAC,
+    0x0D, 0x29, 0xD3, 0xAC, 0x0A, 0x92, 0xAD, 0x3A, 0x95, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D,
+    0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x19, 0xAE, 0xA9, 0x69,
+    0xFE, 0x60, 0x09, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95,
+    0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A,
+    0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9,
+    0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77, 0x71, 0x09,
+    0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x91, 0xFD, 0xA2, 0xAF, 0xD2, 0xAD, 0xA5, 0x9E, 0x93, 0x9D,
+    0x96, 0xD6, 0xD9, 0x5A, 0xCA, 0x6D, 0xA5, 0xD7, 0xDA, 0x4A, 0xCA, 0x7A, 0xD4, 0xD7, 0x0A, 0xD3,
+    0xD9, 0x70, 0x9D, 0x29, 0xD7, 0x2D, 0x2D, 0x97, 0x2D, 0x90, 0x9D, 0x73, 0xD9, 0x0D, 0x74, 0xAC,
+    0x99, 0xCA, 0x74, 0xAC, 0xAD, 0x75, 0x9E, 0xA7, 0x6E, 0x77, 0xD9, 0x77, 0x75, 0x09, 0x99, 0x99,
+    0x97, 0x39, 0x99, 0x99, 0x90, 0xAF, 0xD3, 0x9C, 0xA3, 0x9F, 0xD1, 0x9E, 0x94, 0xE5, 0xAD, 0x93,
+    0xDA, 0x49, 0xE5, 0xD9, 0x4D, 0xA4, 0xAE, 0x49, 0xD5, 0xDA, 0x4F, 0x4D, 0x95, 0xDA, 0x3A, 0xCA,
+    0xD4, 0xD6, 0xAC, 0xA3, 0xD0, 0xD3, 0xAC, 0x96, 0xAD, 0x2A, 0xC9, 0x0D, 0x92, 0xD7, 0xAD, 0x2D,
+    0x1D, 0x91, 0xAC, 0x97, 0x9D, 0x1A, 0xC9, 0x1D, 0x91, 0xD7, 0x09, 0xD1, 0xD2, 0xAC, 0xA0, 0x9C,
+    0x97, 0x09, 0xD0, 0xAC, 0x92, 0xAC, 0xA0, 0xD7, 0x2D, 0x0D, 0x39, 0xCA, 0x9C, 0x97, 0x2D, 0xAC,
+    0x93, 0x9F, 0x73, 0xF4, 0x9E, 0xA7, 0x3E, 0x95, 0xE7, 0x4E, 0x6D, 0xA7, 0x77, 0x73, 0x49, 0x99,
+    0x99, 0x92, 0x99, 0x99, 0x94, 0xFD, 0xA1, 0xAF, 0xC9, 0x4A, 0xDA, 0x49, 0xDA, 0x7E, 0x4D, 0xA7,
+    0x09, 0xD9, 0x2A, 0xCA, 0x72, 0xDA, 0x1A, 0xCA, 0x74, 0xD0, 0x9D, 0x75, 0xAF, 0x77, 0xE7, 0x79,
+    0xE7, 0x69, 0xF9, 0x75, 0xD0, 0xAD, 0x74, 0xD2, 0xD9, 0x72, 0xD9, 0x2A, 0xD7, 0x1D, 0x94, 0xD9,
+    0x7A, 0xCA, 0x5A, 0xD5, 0x9E, 0xA9, 0x39, 0xFA, 0x2F, 0xE2, 0xAF, 0xD9, 0x10, 0x09, 0x99, 0x99,
+    0x93, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD, 0x5A, 0xCA,
+    0x5D, 0x93, 0x9D, 0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A, 0xD0, 0xD7,
+    0x3F, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74, 0xAE, 0xAA,
+    0x71, 0xFE, 0x70, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xE3, 0xAD, 0xAA, 0xAA, 0xAA,
+    0xE3, 0xD5, 0xAD, 0x4D, 0x49, 0xD9, 0x49, 0x5D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0xAD,
+    0x73, 0x9D, 0x97, 0x29, 0xD9, 0x73, 0xDA, 0x73, 0xE5, 0xAC, 0x3E, 0x6D, 0x2A, 0xD6, 0xAC, 0xA1,
+    0x9F, 0xFF, 0x92, 0xFF, 0xF7, 0x72, 0x49, 0xAA, 0xA9, 0x4A, 0xE9, 0x4D, 0x7D, 0x69, 0xCA, 0x6A,
+    0xC9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D,
+    0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xDA, 0x94, 0xAE, 0x94, 0x0D, 0x7A, 0xC7,
+    0x9C, 0xA7, 0xD7, 0xAC, 0x97, 0xCA, 0x7D, 0x7A, 0xC9, 0x7D, 0x7D, 0x79, 0xCA, 0x7D, 0x7A, 0xC9,
+    0x69, 0xCA, 0x7D, 0x7A, 0xC9, 0x7D, 0x7D, 0x79, 0xCA, 0x71, 0x49, 0xAA, 0xA9, 0x4A, 0xE9, 0x6A,
+    0xC7, 0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7, 0xD6, 0x9C,
+    0xA6, 0xAC, 0x96, 0xAC, 0x7D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x49, 0xAA, 0xCA, 0x4A,
+    0xE9, 0x40, 0x39, 0xD7, 0x0E, 0x97, 0xF6, 0xAC, 0x9D, 0x6D, 0x09, 0xCA, 0x49, 0xCA, 0x1D, 0x4D,
+    0x2A, 0xC9, 0x29, 0xD3, 0xD2, 0xAC, 0x93, 0xD9, 0x1D, 0x49, 0xCA, 0x0A, 0xCA, 0x5D, 0x19, 0x79,
+    0x00, 0xFF, 0xF9, 0xFF, 0xF9, 0x5C, 0x91, 0xAD, 0x2D, 0xA2, 0xD9, 0x2D, 0x40, 0x77, 0x09, 0xAD,
+    0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2, 0xD4, 0x9D,
+    0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1, 0x9E, 0x1A,
+    0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x49, 0x70, 0xAF, 0x79, 0xAA, 0xD7, 0x19,
+    0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD1, 0xAD, 0xA3, 0xAC, 0x90, 0xFC, 0x92, 0xAC,
+    0x9D, 0x1D, 0xA2, 0xDA, 0xC2, 0xAD, 0x2E, 0x3A, 0xD1, 0x9D, 0x93, 0xAC, 0xA1, 0xAD, 0x4D, 0x91,
+    0xD9, 0x4D, 0x2D, 0x49, 0xD1, 0x9D, 0x4D, 0x91, 0xAC, 0xA3, 0xDA, 0x2F, 0xAA, 0xDA, 0x29, 0xDA,
+    0xF9, 0x77, 0x00, 0x75, 0x9F, 0x3A, 0xFC, 0x91, 0xAC, 0xA1, 0x9A, 0x19, 0xCA, 0x6D, 0x69, 0xD6,
+    0xAC, 0xA6, 0xD9, 0x6D, 0x96, 0xDA, 0x49, 0x0A, 0xD2, 0x9C, 0xA0, 0x9F, 0xE2, 0xAF, 0x97, 0x40,
+    0x72, 0x99, 0x70, 0x9F, 0x70, 0x9A, 0xAD, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x6A,
+    0xDA, 0x9D, 0x49, 0xFE, 0xA3, 0x9D, 0x91, 0xAD, 0x93, 0xD4, 0xD3, 0xAC, 0xA4, 0xD3, 0xD4, 0x9C,
+    0xA2, 0x9C, 0xA4, 0xAC, 0xA2, 0xAC, 0x93, 0x9D, 0x92, 0xD9, 0x3E, 0x3D, 0x92, 0xAE, 0x19, 0x0E,
+    0x1A, 0xC0, 0xD0, 0xD0, 0xAF, 0xC9, 0x0F, 0x2F, 0x2E, 0x77, 0x00, 0x76, 0x9A, 0xE4, 0xAC, 0xAA,
+    0xE2, 0xAC, 0x91, 0x9D, 0x19, 0xCA, 0x29, 0xD1, 0xD3, 0xD9, 0x09, 0xCA, 0x1A, 0xD9, 0x1A, 0xCA,
+    0xAE, 0x3F, 0xA9, 0x4D, 0x97, 0xD9, 0x49, 0x1E, 0x29, 0xD1, 0x9F, 0xE9, 0x2A, 0xFA, 0x76, 0x77,
+    0x75, 0x9F, 0x97, 0x29, 0xDA, 0xE7, 0x2D, 0x2A, 0x72, 0x9C, 0xA7, 0x6D, 0x97, 0x6D, 0x75, 0xAF,
+    0xD9, 0x70, 0xFF, 0x73, 0xD9, 0x76, 0xD7, 0x7D, 0x76, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x6D,
+    0x76, 0x9D, 0x76, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x6D, 0x76, 0x9D, 0x76, 0xD9, 0x71, 0xAC,
+    0x19, 0xD7, 0x2F, 0xD7, 0x39, 0xEA, 0x73, 0x77, 0x70, 0xAF, 0xCA, 0xC9, 0x59, 0xDA, 0xAF, 0xC5,
+    0x9D, 0x29, 0xCA, 0x7D, 0x92, 0x9D, 0x7D, 0x39, 0xCA, 0x7D, 0x3D, 0x70, 0xD9, 0x1D, 0x97, 0x09,
+    0xFC, 0x97, 0x29, 0xD9, 0x73, 0x9C, 0xA7, 0x5A, 0xD7, 0x5A, 0xEA, 0x97, 0x0A, 0xDA, 0xAF, 0x59,
+    0xD9, 0x3A, 0xE4, 0xD9, 0x59, 0xD9, 0x3D, 0x96, 0xD9, 0x3E, 0x93, 0x9D, 0xA5, 0xFF, 0xCA, 0x79,
+    0xAE, 0xA9, 0x60, 0x49, 0x72, 0xAF, 0x71, 0x9A, 0xAD, 0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x74,
+    0xD7, 0x39, 0xCA, 0x19, 0xE9, 0x4A, 0xC9, 0x0A, 0xFA, 0x4D, 0x0A, 0xCA, 0x0A, 0xD4, 0xD9, 0xC9,
+    0x1A, 0xCA, 0x39, 0xE9, 0x2D, 0x93, 0xAE, 0x3D, 0x4A, 0xD3, 0x9D, 0x4D, 0xA3, 0xAC, 0xA4, 0xD4,
+    0xD9, 0x39, 0xD4, 0xD1, 0x91, 0xAC, 0xA4, 0xD0, 0xD1, 0xD9, 0x39, 0xF9, 0x1D, 0x5E, 0x77, 0x10,
+    0x72, 0xAD, 0x29, 0xE2, 0x9D, 0x97, 0x75, 0xAE, 0x19, 0xF4, 0xD3, 0x9D, 0x3A, 0xCA, 0x3D, 0x92,
+    0x9D, 0x3A, 0xD3, 0xD9, 0x3D, 0x19, 0x09, 0xD0, 0xD0, 0xAF, 0x19, 0xDA, 0x71, 0x77, 0x6D, 0xA7,
+    0x09, 0xDA, 0x70, 0x9D, 0x77, 0x77, 0x76, 0xAE, 0x7A, 0xF7, 0x19, 0xD7, 0x19, 0xD7, 0x1A, 0xCA,
+    0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA,
+    0x71, 0xD9, 0x70, 0x9D, 0x71, 0xD9, 0x5C, 0xA9, 0xAD, 0x59, 0xFC, 0x7A, 0xD9, 0x70, 0x49, 0x7F,
+    0x95, 0x9A, 0xAD, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x1A, 0xDA, 0x3D,
+    0x9D, 0xAD, 0x91, 0x9E, 0x91, 0xAC, 0x91, 0xAD, 0x92, 0xD9, 0x1D, 0xA2, 0xAC, 0xA2, 0xD1, 0x9E,
+    0x29, 0xDA, 0xE9, 0x3A, 0xFA, 0x5D, 0x99, 0xD5, 0xD1, 0xDA, 0x39, 0xD1, 0x9D, 0xA2, 0x9C, 0xA2,
+    0xAE, 0xA9, 0xAC, 0x93, 0x9E, 0x97, 0x30, 0x39, 0x91, 0x9F, 0x19, 0xAA, 0xD3, 0x9D, 0x3A, 0xCA,
+    0x3D, 0x93, 0xD3, 0x9D, 0x3A, 0xCA, 0x3A, 0xC9, 0x3D, 0x93, 0xD3, 0x9D, 0x3A, 0xCA, 0x3D, 0x93,
+    0xD3, 0x9D, 0x19, 0x0A, 0xCA, 0x9C, 0xA0, 0xFC, 0x1A, 0xDA, 0x71, 0x77, 0x49, 0xAD, 0xA2, 0xAD,
+    0x92, 0xAD, 0xA1, 0xAF, 0x1F, 0xC1, 0xFC, 0x39, 0xCA, 0x0D, 0x99, 0xD0, 0xD9, 0x9D, 0x3A, 0xCA,
+    0xD1, 0x9C, 0xAD, 0x2D, 0x3F, 0x2A, 0xE2, 0x9D, 0x3E, 0x92, 0xE9, 0x2A, 0xCA, 0x3D, 0xA3, 0xE3,
+    0xD9, 0x29, 0xD4, 0xD9, 0x3D, 0x3A, 0xCA, 0x39, 0xD3, 0x9C, 0xA3, 0xD9, 0x3A, 0xC9, 0x3A, 0xC9,
+    0x09, 0x1D, 0x4D, 0x4D, 0x9A, 0xC9, 0x9D, 0x4D, 0x4F, 0xA0, 0xAC, 0xA3, 0x9C, 0xA4, 0xE9, 0x77,
+    0x60, 0x75, 0x9A, 0xDA, 0x2A, 0xDA, 0x1A, 0xF1, 0xFC, 0x39, 0xCA, 0x0D, 0x90, 0xD9, 0x2A, 0xCA,
+    0xD2, 0xD3, 0xF2, 0x9D, 0x3E, 0x92, 0xAC, 0xA3, 0xDA, 0x3D, 0x92, 0x9D, 0x4D, 0x3A, 0xCA, 0x39,
+    0xD3, 0xD9, 0x3A, 0xCA, 0x09, 0x1D, 0x4D, 0x99, 0xC9, 0x9D, 0x4F, 0xA0, 0xAC, 0xA4, 0xEA, 0x77,
+    0x77, 0x9A, 0xEA, 0x4A, 0xFD, 0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D,
+    0x9A, 0xCA, 0x5D, 0x9D, 0x95, 0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E,
+    0xAA, 0xDA, 0x39, 0xFC, 0x97, 0x70, 0x77, 0x29, 0xAD, 0xA1, 0x9E, 0x4A, 0xEA, 0x0A, 0xFC, 0x59,
+    0xCA, 0x9C, 0xA0, 0xAD, 0x5A, 0xCA, 0xC9, 0x2D, 0x94, 0xEA, 0x3D, 0x5E, 0x4D, 0x5D, 0x93, 0x9D,
+    0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0xD9, 0x4D, 0x93, 0xAC, 0xA5, 0xD9, 0x29, 0xD5, 0x9F, 0xAE,
+    0x6A, 0xCA, 0xFA, 0x7A, 0xC9, 0x74, 0xD7, 0x5D, 0x74, 0x9C, 0xA7, 0x3A, 0xFC, 0x97, 0x0A, 0xAA,
+    0xAA, 0xA9, 0x70, 0x77, 0x09, 0xEA, 0x09, 0xC9, 0x2A, 0xFF, 0x2A, 0xD2, 0xAD, 0xA1, 0x9D, 0x4D,
+    0x91, 0xD9, 0x4D, 0x2D, 0x49, 0xD1, 0xAC, 0xA4, 0xAC, 0x91, 0xD9, 0x39, 0xD9, 0x1D, 0x93, 0xE2,
+    0xD9, 0x2A, 0xE2, 0xE1, 0xAC, 0x9C, 0xA2, 0xAF, 0xC9, 0x9C, 0x93, 0xF1, 0xAC, 0x97, 0x1D, 0x72,
+    0xD7, 0x19, 0xD7, 0x19, 0xD7, 0xAF, 0xC6, 0xAA, 0xAA, 0xAA, 0x20, 0x73, 0xAD, 0xA1, 0xAD, 0x0A,
+    0xF0, 0xAE, 0x29, 0xCA, 0x9D, 0xAA, 0x29, 0xCA, 0xCA, 0x5A, 0xCA, 0xC6, 0xE9, 0x6D, 0xA6, 0x9D,
+    0x96, 0xAD, 0x7D, 0x97, 0xD7, 0x0D, 0x79, 0xCA, 0x70, 0x75, 0x9A, 0xE9, 0x2A, 0xFC, 0xA1, 0x9C,
+    0xA2, 0xA9, 0x1D, 0x96, 0xAD, 0x7E, 0x95, 0x9E, 0xA6, 0xE9, 0x6E, 0x1A, 0x39, 0xD0, 0xAC, 0xA2,
+    0xAC, 0x90, 0xAE, 0xAA, 0xCA, 0x2A, 0xF9, 0x74, 0x76, 0xCA, 0x6A, 0xC9, 0x6D, 0x5A, 0xAF, 0xCA,
+    0x0F, 0xF9, 0x2A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D, 0x96, 0xD2, 0x9A,
+    0x2D, 0x1A, 0xCA, 0x2F, 0xD3, 0xAE, 0x97, 0x40, 0x0A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93, 0xD4,
+    0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xAD,
+    0x3D, 0x92, 0x9D, 0xA3, 0xD9, 0x2C, 0xAC, 0xA3, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0, 0x9F,
+    0x19, 0xEA, 0x2D, 0xA7, 0x70, 0x75, 0xAD, 0x93, 0xE0, 0xAF, 0x3A, 0xD2, 0x9D, 0x39, 0xD3, 0xD9,
+    0x3D, 0x3A, 0xCA, 0x29, 0xCA, 0x3A, 0xCA, 0x2D, 0x93, 0x9D, 0x2D, 0x5D, 0x1D, 0x6D, 0x09, 0xCA,
+    0x6D, 0x0D, 0x7F, 0x70, 0xE7, 0x1A, 0xC7, 0x73, 0x77, 0x3A, 0xD9, 0x3D, 0x39, 0xD9, 0xAF, 0x3D,
+    0xA3, 0xDA, 0x2D, 0x92, 0xAD, 0x3D, 0xA2, 0xD9, 0x2A, 0xD3, 0xD9, 0x2A, 0xCA, 0x2A, 0xD9, 0x2D,
+    0x39, 0xD2, 0xE9, 0x2D, 0x4D, 0x19, 0xEA, 0x1A, 0xC9, 0x4D, 0x1D, 0x9C, 0xA1, 0xD5, 0xD0, 0x9C,
+    0x90, 0xD0, 0xAC, 0x95, 0xD0, 0xD1, 0xD0, 0xCA, 0x6A, 0xE2, 0xF7, 0xAD, 0x92, 0xE7, 0x0A, 0xC9,
+    0x3D, 0x77, 0x70, 0x77, 0x29, 0xAC, 0xA4, 0xE2, 0xAF, 0x3F, 0x5D, 0xA1, 0xD9, 0x09, 0x59, 0xD0,
+    0xAC, 0x97, 0x1D, 0xAC, 0xA7, 0x2A, 0xE7, 0x4D, 0x97, 0x3A, 0xDA, 0x72, 0x9C, 0xAD, 0x71, 0x9C,
+    0xA0, 0xD9, 0x59, 0x1D, 0x1A, 0xD5, 0xF3, 0xFC, 0x2E, 0x93, 0xEA, 0x77, 0x20, 0x77, 0x39, 0xDA,
+    0x39, 0xD3, 0x9F, 0x4D, 0xA5, 0xDA, 0x3A, 0xCA, 0x5A, 0xD3, 0xAC, 0x96, 0xD3, 0xD7, 0xD9, 0x2D,
+    0x7A, 0xC9, 0x19, 0xC9, 0x7A, 0xCA, 0x1D, 0x70, 0x9C, 0xA0, 0x9C, 0x97, 0x09, 0xCA, 0x0D, 0x72,
+    0xCA, 0xAC, 0x72, 0x9C, 0xAC, 0x97, 0x29, 0xDA, 0x73, 0xAD, 0x74, 0xD7, 0x39, 0xD7, 0x0A, 0x99,
+    0xAD, 0x71, 0xFA, 0x72, 0xAC, 0xA9, 0x72, 0x19, 0xDA, 0x91, 0x9C, 0x2F, 0xD9, 0xD9, 0x0A, 0xC9,
+    0x99, 0xFA, 0x1A, 0xC3, 0xAC, 0xA7, 0x9D, 0x79, 0xD7, 0x9D, 0x79, 0xD7, 0x0D, 0x70, 0xD4, 0x92,
+    0xE9, 0x92, 0xCA, 0x0F, 0xFD, 0xA0, 0xD1, 0xAF, 0xC7, 0x50, 0x59, 0xAC, 0x94, 0xAE, 0x49, 0xD6,
+    0xAC, 0x96, 0xD7, 0xD7, 0xD7, 0xCA, 0x69, 0xCA, 0x6A, 0xC9, 0x59, 0xD5, 0xAC, 0xA6, 0x9D, 0x7A,
+    0xC9, 0x6A, 0xC9, 0x6D, 0x69, 0xD6, 0xAC, 0x96, 0xD6, 0x9C, 0xA6, 0x9C, 0xA6, 0x9C, 0xA6, 0x9D,
+    0xA9, 0x5A, 0xDA, 0x76, 0x73, 0xCA, 0x39, 0xC9, 0x3A, 0xC9, 0x3D, 0x4D, 0x4C, 0xA3, 0x9C, 0x93,
+    0xAC, 0x93, 0xD4, 0xD4, 0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xD4, 0xD3, 0x9C, 0xA3, 0x9C, 0x93, 0xAC,
+    0x4D, 0x4D, 0x39, 0xCA, 0x3A, 0xC9, 0x30, 0x4A, 0xCA, 0x95, 0xF7, 0xD9, 0x6A, 0xC9, 0x6D, 0x7D,
+    0x69, 0xCA, 0x6D, 0x7D, 0x69, 0xCA, 0x69, 0xCA, 0x7D, 0xA6, 0xDA, 0x5D, 0x95, 0xAC, 0x96, 0xAC,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x6A, 0xC9, 0x4A, 0xAD, 0x4A, 0xDA, 0x77, 0x19, 0x95, 0x91, 0xFC,
+    0x29, 0xC9, 0xAD, 0xAE, 0xAA, 0xD0, 0xD2, 0xAF, 0x97, 0x99, 0x20, 0x73, 0x9D, 0x4E, 0x4D, 0x97,
+    0x74, 0x9C, 0x5A, 0xC5, 0xCA, 0x5C, 0xA4, 0x9C, 0x94, 0xAC, 0x94, 0xD5, 0xD4, 0x9D, 0x4D, 0xA4,
+    0xD9, 0x39, 0xD4, 0xDA, 0x4A, 0xA4, 0x77, 0x3C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x1D,
+    0x95, 0x9F, 0xD9, 0x2F, 0xFA, 0x1D, 0xA0, 0xAC, 0x1A, 0x1A, 0xCA, 0x1C, 0xA4, 0xD2, 0xC9, 0x3A,
+    0xCA, 0x19, 0xC4, 0xD9, 0x19, 0xC4, 0xD9, 0x1A, 0xA4, 0xD9, 0x1C, 0xA4, 0xAD, 0x1C, 0x92, 0xA0,
+    0x9D, 0xAA, 0xC1, 0xAC, 0xA1, 0xAF, 0xEA, 0x3A, 0xFA, 0x96, 0xC9, 0x70, 0x9C, 0x71, 0xAC, 0x71,
+    0xCA, 0x71, 0xCA, 0x71, 0xA7, 0x73, 0x97, 0x49, 0xFC, 0x97, 0x09, 0xDA, 0xAE, 0x70, 0xD2, 0x9D,
+    0x7D, 0x93, 0xD6, 0x9D, 0x49, 0x7A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x39, 0x6F, 0xFD, 0x69, 0x9E,
+    0x99, 0x99, 0x71, 0xD9, 0x74, 0x9D, 0x75, 0xAC, 0xA7, 0x5D, 0x97, 0x29, 0x09, 0xD5, 0x99, 0x3F,
+    0xFF, 0xC3, 0xE9, 0x9A, 0xFD, 0xA3, 0x99, 0x75, 0x77, 0x19, 0xA7, 0x0A, 0xC2, 0x9C, 0xA0, 0xAF,
+    0x9A, 0xC9, 0x39, 0xEA, 0xAF, 0x6D, 0x3A, 0xCA, 0x5A, 0xC9, 0x39, 0xCA, 0x5D, 0x49, 0xC9, 0x5D,
+    0x4D, 0x6D, 0x3A, 0xCA, 0x5A, 0xE9, 0x9E, 0xA4, 0xD9, 0xAF, 0xA9, 0xCA, 0x29, 0xC3, 0x93, 0xAA,
+    0x77, 0x20, 0x77, 0x0A, 0xFD, 0x2F, 0xD0, 0x9F, 0xA3, 0x9E, 0xA3, 0xDA, 0x5D, 0x94, 0xAD, 0x4A,
+    0xCA, 0x59, 0xD3, 0x9D, 0x7D, 0xA2, 0xD7, 0x09, 0xD1, 0xD9, 0x6F, 0xC9, 0xAF, 0x94, 0x9A, 0xAF,
+    0xCA, 0xAA, 0x71, 0xE7, 0x1A, 0xFF, 0xCA, 0x59, 0xAA, 0xEA, 0xAA, 0xA7, 0x19, 0xD7, 0x5A, 0xCA,
+    0x75, 0xDA, 0x73, 0x9A, 0xEA, 0x97, 0x0A, 0xFD, 0xA7, 0x73, 0xCA, 0x39, 0xC9, 0x3A, 0xC9, 0x3D,
+    0x4D, 0x4C, 0xA3, 0x9C, 0x93, 0xAC, 0x4A, 0xA7, 0x77, 0x7A, 0xA4, 0xD3, 0x9C, 0xA3, 0x9C, 0x93,
+    0xAC, 0x4D, 0x4D, 0x39, 0xCA, 0x3A, 0xC9, 0x30, 0x77, 0x0A, 0xF4, 0x9D, 0xAA, 0xE2, 0x9D, 0x3D,
+    0x2D, 0xA3, 0xCA, 0x1A, 0xCA, 0xC7, 0xCA, 0x0D, 0x6C, 0xA0, 0x9D, 0x5C, 0xA2, 0xD9, 0x3D, 0x3D,
+    0x92, 0x9D, 0x92, 0xD3, 0x9D, 0x91, 0x9C, 0xA3, 0x9D, 0xA1, 0xCA, 0x5D, 0x90, 0xCA, 0x6D, 0x0C,
+    0xA1, 0x94, 0xE9, 0x0A, 0xC4, 0xE1, 0xDA, 0x29, 0xD2, 0xAD, 0xAA, 0xAD, 0x93, 0xAF, 0xA7, 0x70,
+    0x1A, 0x3A, 0x1D, 0xA1, 0xDA, 0x9D, 0x90, 0x9D, 0x90, 0x93, 0x91, 0x69, 0xAA, 0xA9, 0x73, 0xAF,
+    0xF9, 0x69, 0xD9, 0x5A, 0xCA, 0x5D, 0x70, 0x9C, 0xA3, 0xD3, 0x9A, 0xAA, 0x29, 0xC9, 0x19, 0xC9,
+    0x2F, 0xCA, 0x2A, 0xC1, 0xD2, 0xD2, 0xCA, 0x29, 0xC9, 0x0C, 0xA1, 0x9C, 0x92, 0x99, 0x3C, 0xA0,
+    0xC9, 0x1A, 0xC7, 0x1C, 0xA0, 0xC9, 0x1A, 0xC7, 0x1D, 0x0C, 0x91, 0xAC, 0x71, 0xCA, 0x0C, 0xA1,
+    0x9C, 0xA7, 0x0C, 0xA0, 0xAC, 0x2D, 0xA9, 0x99, 0xA2, 0x9C, 0x90, 0x9C, 0x92, 0xFC, 0xA2, 0xD2,
+    0xD4, 0x99, 0x3A, 0xC9, 0x3D, 0x70, 0xAC, 0xA5, 0xDA, 0x93, 0x9D, 0x97, 0x9F, 0xEA, 0x74, 0x99,
+    0x99, 0x60, 0x39, 0xA0, 0x99, 0x29, 0xFC, 0x92, 0xD1, 0xD2, 0xAC, 0x2D, 0x2D, 0x2C, 0x92, 0xCA,
+    0x1A, 0xC2, 0x9C, 0xA0, 0x9D, 0x0A, 0x1F, 0x9E, 0x1A, 0xCA, 0x1C, 0xA7, 0x4A, 0xAA, 0xAA, 0xAC,
+    0x1F, 0xEA, 0x10, 0x4A, 0xC2, 0xAC, 0x4D, 0x91, 0xD9, 0x3D, 0x91, 0xD9, 0x29, 0xDA, 0x09, 0xDA,
+    0x3D, 0xA1, 0xDA, 0x4E, 0x1E, 0x5D, 0x91, 0xD9, 0x5D, 0x2D, 0x6C, 0xA2, 0xCA, 0x76, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0xFF, 0xD0, 0x99, 0x99, 0x99, 0x99, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x72,
+    0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x59, 0x97, 0x1A, 0xFC, 0xA4, 0x9C,
+    0xA3, 0x9D, 0x3C, 0x90, 0x99, 0x92, 0xCA, 0x1A, 0xA0, 0x9D, 0xAC, 0x91, 0xC1, 0xC9, 0x1C, 0xA0,
+    0xCA, 0x1C, 0xA0, 0xC2, 0xCA, 0x9C, 0x91, 0xAA, 0x0C, 0x2E, 0xA2, 0xAC, 0x0C, 0x2C, 0xA9, 0xC9,
+    0x1A, 0xA0, 0xCA, 0x1D, 0x0A, 0xC9, 0x0C, 0x90, 0x9C, 0x09, 0x99, 0x19, 0x9A, 0xC2, 0xAC, 0x59,
+    0xC9, 0x3A, 0xCA, 0x99, 0xAD, 0x96, 0x9A, 0xAA, 0x93, 0x0A, 0xAA, 0xAA, 0xAA, 0x1F, 0xE9, 0x70,
+    0x39, 0x94, 0xAF, 0x91, 0xDA, 0x99, 0xD0, 0x9C, 0xA2, 0x9C, 0xA9, 0xC9, 0x3C, 0xA9, 0xCA, 0x29,
+    0xCA, 0x0D, 0x91, 0xD1, 0x9F, 0xC9, 0x39, 0xA9, 0x20, 0x4A, 0x97, 0x0D, 0x70, 0xD7, 0x0D, 0x70,
+    0xD3, 0x9F, 0xFD, 0x0A, 0xAA, 0xAD, 0xAA, 0xAA, 0x4D, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x77, 0x19,
+    0xFF, 0xCA, 0x9F, 0xFD, 0x49, 0xA9, 0x49, 0xFC, 0x92, 0xD9, 0x0A, 0xD1, 0x9C, 0x3D, 0x6A, 0xC9,
+    0x59, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD9, 0x5F, 0xF1, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x39,
+    0xA9, 0x39, 0xFC, 0x2C, 0xA1, 0xD2, 0x92, 0xAC, 0x59, 0xCA, 0x3A, 0xDA, 0x39, 0xF6, 0xAC, 0xA5,
+    0xAC, 0xA4, 0x9D, 0x19, 0xAA, 0xE9, 0x1A, 0xEA, 0x30, 0x70, 0xD2, 0xE1, 0xAD, 0x19, 0xD2, 0xAA,
+    0x71, 0x77, 0x39, 0xCA, 0x4A, 0xC5, 0xD9, 0x39, 0xD5, 0xD4, 0xAC, 0xA5, 0xD4, 0xD9, 0x49, 0xD4,
+    0xD5, 0xAC, 0xA4, 0xD5, 0xD9, 0x39, 0xD5, 0xD4, 0xAC, 0xA5, 0xD4, 0xD9, 0x49, 0xD3, 0xAD, 0x94,
+    0x9D, 0xA1, 0x9C, 0xAC, 0xA0, 0x99, 0x1A, 0xFD, 0xA0, 0xF9, 0x1D, 0xAE, 0xA1, 0xAD, 0x92, 0xCA,
+    0x74, 0x9C, 0xA7, 0x4A, 0xCA, 0x74, 0xAC, 0x97, 0x4D, 0x97, 0x4C, 0xA7, 0x77, 0x40, 0x71, 0x99,
+    0x99, 0x96, 0x9F, 0xFA, 0x4A, 0xFA, 0xAC, 0xA9, 0x4A, 0xFC, 0x99, 0xC5, 0x9F, 0xD0, 0xAC, 0x5F,
+    0xE0, 0xCA, 0x5F, 0xE0, 0xCA, 0x5F, 0xDA, 0x0C, 0x95, 0xFD, 0x99, 0xC6, 0xFD, 0x0A, 0xC6, 0x9F,
+    0xC0, 0xCA, 0x79, 0xAA, 0xD0, 0xCA, 0x72, 0xCA, 0x0C, 0x97, 0x2C, 0x99, 0xC7, 0x29, 0xC0, 0xAC,
+    0x72, 0xAC, 0x0C, 0xA7, 0x2C, 0xA0, 0xC9, 0x72, 0xC9, 0xAC, 0x72, 0xAC, 0x9C, 0x95, 0x9A, 0x1A,
+    0xE9, 0x6A, 0xF9, 0x72, 0x9A, 0x97, 0x30, 0x09, 0xA0, 0xAD, 0x9E, 0x0A, 0xC9, 0x00, 0x1A, 0xA9,
+    0x19, 0xE3, 0xD2, 0xAC, 0x91, 0xDA, 0x29, 0x30, 0x4A, 0x2A, 0xE1, 0x9A, 0xE3, 0x9C, 0xA3, 0x9C,
+    0xA3, 0xAC, 0x93, 0xD4, 0xD3, 0x9C, 0xA3, 0xAC, 0x91, 0x9A, 0xEA, 0x0A, 0xAA, 0xAA, 0xA0, 0x49,
+    0xA9, 0x4A, 0xF9, 0x29, 0xCA, 0x1D, 0x2D, 0x2D, 0x19, 0xCA, 0x2D, 0x1A, 0xC9, 0x19, 0xCA, 0x19,
+    0xC9, 0x1D, 0x3D, 0xAD, 0x93, 0x9D, 0xA9, 0x75, 0xAA, 0xAA, 0xAA, 0xC9, 0x09, 0xFD, 0xA1, 0x1A,
+    0xA2, 0xAA, 0x5C, 0xA2, 0xCA, 0x4A, 0xCA, 0x1A, 0xCA, 0x4D, 0xA1, 0xDA, 0x3E, 0x1E, 0x2A, 0xD9,
+    0x0A, 0xD9, 0x19, 0xD1, 0x9D, 0x29, 0xD1, 0x9D, 0x3C, 0xA2, 0xCA, 0x77, 0x77, 0x74, 0x97, 0x3C,
+    0x95, 0x9A, 0xD7, 0x2D, 0x94, 0x9F, 0x71, 0x9C, 0xA7, 0x0D, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0xD7,
+    0x1A, 0xC9, 0x7A, 0xC9, 0x71, 0xD7, 0x9C, 0xA7, 0x2D, 0x7D, 0x5D, 0x91, 0x9C, 0xA6, 0xAC, 0x5E,
+    0x29, 0xC9, 0x59, 0xC9, 0x4F, 0x19, 0xDA, 0x94, 0xCA, 0x4D, 0x0C, 0xA0, 0xAF, 0xC3, 0xD4, 0xD0,
+    0x9C, 0x97, 0x1A, 0xC9, 0x3D, 0x1A, 0xC9, 0x70, 0x9C, 0xA3, 0xD2, 0xD7, 0x1D, 0x3A, 0xFF, 0xA6,
+    0xD5, 0x99, 0x99, 0xAC, 0xA9, 0x6A, 0xC9, 0x71, 0x9C, 0x96, 0x9D, 0x72, 0xAC, 0x79, 0xC7, 0x77,
+    0x77, 0x00, 0x77, 0x74, 0x97, 0x2C, 0x96, 0x9A, 0xD7, 0x1A, 0xC9, 0x59, 0xF7, 0x09, 0xCA, 0x71,
+    0xD7, 0x0D, 0x71, 0x9C, 0xA7, 0xD7, 0x2A, 0xC9, 0x6A, 0xC9, 0x72, 0xD6, 0x9C, 0xA7, 0x3D, 0x6D,
+    0x3F, 0xA2, 0x9C, 0xA5, 0xAC, 0x29, 0xDA, 0xAD, 0x91, 0x9C, 0x94, 0x9C, 0x92, 0xAC, 0x29, 0xCA,
+    0x09, 0xDA, 0x93, 0xCA, 0x49, 0x2A, 0xC9, 0xAF, 0xC2, 0xD7, 0x09, 0xD7, 0x0A, 0xC9, 0x79, 0xD7,
+    0x09, 0xCA, 0x7A, 0xD7, 0x1D, 0x7A, 0xCA, 0x71, 0xD7, 0xD9, 0x71, 0xAC, 0xA6, 0xEA, 0xAA, 0xAA,
+    0x49, 0xD7, 0xFE, 0x94, 0x9C, 0x77, 0x77, 0x71, 0x77, 0x75, 0x97, 0x39, 0xC7, 0xFA, 0x71, 0xD6,
+    0xD9, 0x9D, 0x70, 0xD9, 0x6A, 0x2A, 0xC7, 0xAC, 0xA7, 0x3D, 0x69, 0xD7, 0x19, 0xAD, 0x7D, 0x71,
+    0x9F, 0x6A, 0xC9, 0x74, 0xAC, 0xA4, 0x9C, 0xA5, 0xD9, 0x49, 0xCA, 0x4D, 0x5E, 0x5D, 0x93, 0xD5,
+    0xF0, 0x99, 0x9A, 0xDA, 0x3A, 0xC9, 0x4D, 0x0C, 0xA0, 0xFC, 0x93, 0x9C, 0xA4, 0xD0, 0x9C, 0x97,
+    0x2D, 0x4D, 0x1A, 0xC9, 0x71, 0xD4, 0xD2, 0xD7, 0x1A, 0xCA, 0x3A, 0xFF, 0xA6, 0x9D, 0x59, 0x99,
+    0x9A, 0xCA, 0x97, 0xD7, 0x29, 0xC9, 0x7D, 0x97, 0x2A, 0xC7, 0x0A, 0xA7, 0x77, 0x77, 0x10, 0x75,
+    0x9D, 0x5E, 0x5A, 0xC9, 0x77, 0x6E, 0x93, 0x9A, 0xDA, 0x59, 0xCA, 0x49, 0xD4, 0x9D, 0x4A, 0xD4,
+    0x9D, 0x5D, 0x59, 0xCA, 0x59, 0xCA, 0x59, 0xDA, 0x9A, 0xC9, 0x1A, 0xFC, 0x92, 0xAE, 0x97, 0x20,
+    0x71, 0x97, 0x71, 0xD9, 0x77, 0xE9, 0x77, 0xAD, 0x97, 0x70, 0x99, 0x77, 0x77, 0x29, 0xA7, 0x7A,
+    0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9, 0x1D, 0x73,
+    0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A, 0xD7, 0x9F,
+    0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC, 0xA7, 0xE3,
+    0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE0, 0x76, 0x99, 0x77, 0xAD, 0x75, 0xAE, 0xA7, 0x4F,
+    0x97, 0x5A, 0x97, 0x77, 0x74, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA,
+    0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A,
+    0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA,
+    0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x74,
+    0xA9, 0x77, 0xE9, 0x75, 0xDA, 0xD9, 0x72, 0x9D, 0x90, 0x9D, 0x72, 0xD3, 0x9C, 0x77, 0x77, 0x09,
+    0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9,
+    0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A,
+    0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC,
+    0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE0, 0x72, 0x99, 0x77, 0xEA, 0x0A, 0xC7,
+    0x2A, 0xCA, 0xFC, 0x72, 0xAA, 0x1E, 0x77, 0x77, 0x77, 0x49, 0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F,
+    0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9, 0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC,
+    0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A, 0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99,
+    0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC, 0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA,
+    0x90, 0xFD, 0x4F, 0xE0, 0x71, 0xAA, 0x2A, 0xC7, 0x2E, 0x1A, 0xD9, 0x71, 0xDA, 0x1E, 0x77, 0x77,
+    0x77, 0x39, 0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7,
+    0x39, 0xC9, 0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9,
+    0x99, 0x9A, 0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D,
+    0xA4, 0xAC, 0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE0, 0x73, 0x9A, 0x97, 0x6F,
+    0xA7, 0x4A, 0xC1, 0xAC, 0x74, 0xD1, 0x9C, 0x74, 0xAC, 0x1D, 0x75, 0xF7, 0x79, 0x97, 0x70, 0x9A,
+    0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91,
+    0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD,
+    0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA,
+    0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x73, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x73, 0xAF, 0xFF, 0x75, 0xFA, 0xAA, 0xAA, 0xD7, 0x4F, 0xA4, 0xCA, 0x73, 0xAC, 0x9D, 0x94, 0xC9,
+    0x72, 0x9C, 0xA0, 0xD7, 0x72, 0xD0, 0x9D, 0x77, 0x1D, 0x1A, 0xD7, 0x70, 0xAC, 0x91, 0xEA, 0xAA,
+    0xD7, 0x29, 0xCA, 0x2F, 0xEA, 0x72, 0xD9, 0x99, 0x9D, 0x77, 0xFF, 0xC7, 0x6D, 0x99, 0x99, 0x9D,
+    0xA7, 0x5A, 0xCA, 0x4D, 0xA5, 0xC5, 0x9C, 0xA5, 0xD9, 0x4D, 0x5D, 0x59, 0xD4, 0x9C, 0xA3, 0x9E,
+    0xA3, 0x9F, 0xFD, 0x92, 0xAF, 0xC2, 0xFF, 0xF3, 0x69, 0x9A, 0xA9, 0x96, 0xAF, 0xF9, 0x3E, 0xA9,
+    0x9A, 0xEA, 0x2E, 0x5A, 0xC9, 0x1E, 0x6A, 0xC1, 0x9D, 0x7A, 0xA1, 0xDA, 0x72, 0x9D, 0x73, 0xAD,
+    0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xDA, 0x7C, 0x2F, 0x92, 0x9A,
+    0xD3, 0xFF, 0xD5, 0xAF, 0xD9, 0x77, 0x79, 0xAA, 0x73, 0xEA, 0x73, 0xAC, 0x97, 0x3D, 0x72, 0xAD,
+    0x73, 0x99, 0x70, 0x70, 0x97, 0x6A, 0xCA, 0x75, 0xAD, 0xA7, 0x5A, 0xE7, 0x69, 0xA7, 0x77, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5,
+    0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D,
+    0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF,
+    0xD9, 0x29, 0xFF, 0xF3, 0x75, 0xA7, 0x5A, 0xD7, 0x39, 0xF7, 0x2A, 0xEA, 0x73, 0xA9, 0x77, 0x72,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0x59, 0xDA, 0xAA, 0xAA, 0xAD, 0x59, 0xD5, 0xCA,
+    0x5A, 0xD5, 0xC6, 0xAC, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0xAA, 0xAA, 0xAA, 0x7A, 0xFE, 0xA7,
+    0xDA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD5, 0x9C, 0x5A, 0xD5, 0xD5, 0xDA, 0x49, 0xCA, 0x39, 0xAF,
+    0xFD, 0x92, 0x9F, 0xFF, 0x30, 0x72, 0xAA, 0x75, 0xAE, 0x73, 0xAC, 0xAD, 0xA7, 0x1D, 0xA1, 0xD9,
+    0x7A, 0xC9, 0x3C, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA,
+    0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA,
+    0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D,
+    0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x7A, 0xC2, 0xAC, 0x97, 0xAD, 0x90, 0x9D,
+    0xA7, 0xAD, 0x19, 0xD9, 0x77, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D,
+    0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59,
+    0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD,
+    0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x49, 0x97, 0x0D, 0x97, 0xEA,
+    0x7A, 0xDA, 0x70, 0x9A, 0x77, 0x99, 0x99, 0x99, 0x93, 0xFD, 0xA4, 0x9D, 0xA6, 0x9D, 0x7A, 0xD7,
+    0xAC, 0xA7, 0xD9, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xD7, 0xDA,
+    0x59, 0xAE, 0xA3, 0x9F, 0xD9, 0x20, 0x71, 0x9A, 0x70, 0xAD, 0x69, 0xEA, 0x5A, 0xE9, 0x6A, 0x97,
+    0x73, 0x99, 0x99, 0x99, 0x94, 0xFD, 0xA5, 0x9D, 0xA7, 0x9D, 0x70, 0xAD, 0x70, 0xAC, 0xA7, 0x0D,
+    0x97, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xD7,
+    0x0D, 0xA6, 0x9A, 0xEA, 0x49, 0xFD, 0x93, 0x7A, 0xA7, 0x1E, 0xA7, 0xDA, 0xD9, 0x5D, 0x90, 0x9D,
+    0x4D, 0x92, 0x9C, 0x77, 0x19, 0x99, 0x99, 0x99, 0x5F, 0xDA, 0x69, 0xDA, 0x70, 0x9D, 0x71, 0xAD,
+    0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x1D,
+    0x71, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x79, 0xAE, 0xA5, 0x9F, 0xD9, 0x40, 0x4A, 0xC2, 0xAC, 0x4E,
+    0x90, 0xAD, 0x93, 0xE1, 0xAD, 0x77, 0x76, 0x99, 0x99, 0x99, 0x95, 0xFD, 0xA6, 0x9D, 0xA7, 0x09,
+    0xD7, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71,
+    0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x9A, 0xEA, 0x59, 0xFD, 0x94, 0x59, 0x9A,
+    0xAA, 0x99, 0x71, 0xFF, 0xDA, 0x69, 0xA9, 0xD9, 0x09, 0x9F, 0x96, 0x9D, 0x49, 0xE6, 0xAD, 0x59,
+    0xDA, 0x5A, 0xCA, 0x6E, 0x5D, 0x96, 0xAD, 0x5D, 0x79, 0xD2, 0x99, 0xAD, 0x99, 0x99, 0x3A, 0xD2,
+    0xFF, 0xC3, 0xAD, 0x4D, 0xA7, 0xDA, 0x4D, 0x97, 0xD9, 0x4D, 0x7A, 0xD4, 0x9D, 0x69, 0xD9, 0x4A,
+    0xD6, 0xDA, 0x5D, 0xA4, 0xAD, 0xA4, 0x9A, 0xEA, 0xAA, 0xF9, 0x49, 0xFF, 0xCA, 0x97, 0x77, 0x10,
+    0x72, 0x97, 0x71, 0x9E, 0x1C, 0xA7, 0x4D, 0xAF, 0x97, 0x4C, 0x90, 0xAD, 0xA7, 0x77, 0x77, 0x72,
+    0x99, 0x99, 0x69, 0x99, 0x99, 0x93, 0xF9, 0x49, 0xFC, 0xA4, 0xAD, 0xA6, 0xAC, 0xA6, 0x9E, 0x6A,
+    0xC9, 0x6A, 0xEA, 0x5D, 0x7D, 0xAD, 0x5D, 0x7D, 0x0D, 0xA3, 0x9C, 0xA7, 0xD0, 0xAD, 0x3A, 0xC9,
+    0x69, 0xCA, 0x1D, 0x92, 0xD9, 0x6A, 0xC9, 0x1A, 0xD2, 0xD7, 0xD3, 0xD9, 0x1D, 0x7D, 0x3D, 0xA0,
+    0x9C, 0xA6, 0x9D, 0x39, 0xD0, 0xAC, 0x96, 0x9C, 0xA4, 0xDA, 0xD7, 0xAC, 0x94, 0x9F, 0x7D, 0x6F,
+    0x6A, 0xDA, 0x94, 0x9D, 0xA4, 0x9F, 0xD5, 0xD9, 0x77, 0x71, 0x69, 0x97, 0x6D, 0x97, 0x5E, 0xA7,
+    0x5A, 0xDA, 0x76, 0x9A, 0x77, 0x75, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6E, 0xA9, 0x99, 0xAE, 0x4E,
+    0x59, 0xDA, 0x2E, 0x7E, 0x19, 0xD7, 0x09, 0xD9, 0x0D, 0xA7, 0x1D, 0x99, 0xD7, 0x2D, 0x9A, 0xD7,
+    0x2D, 0x9D, 0xA7, 0x19, 0xD0, 0xDA, 0x71, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0x9D, 0x1E,
+    0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5, 0xFA, 0xAF, 0x7A, 0xFC, 0xA9, 0x77, 0x60,
+    0x73, 0x9A, 0x75, 0xAD, 0x73, 0x9E, 0xA7, 0x2A, 0xE9, 0x73, 0xA9, 0x77, 0x77, 0x9A, 0xA9, 0x71,
+    0x9F, 0xEA, 0x6E, 0xA9, 0x99, 0xAE, 0x4E, 0x59, 0xDA, 0x2E, 0x7E, 0x19, 0xD7, 0x09, 0xD9, 0x0D,
+    0xA7, 0x1D, 0x99, 0xD7, 0x2D, 0x9A, 0xD7, 0x2D, 0x9D, 0xA7, 0x19, 0xD0, 0xDA, 0x71, 0xAD, 0x0D,
+    0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0x9D, 0x1E, 0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5,
+    0xFA, 0xAF, 0x7A, 0xFC, 0xA9, 0x77, 0x60, 0x71, 0xAA, 0x75, 0xEA, 0x73, 0xDA, 0xD9, 0x71, 0xD9,
+    0x09, 0xD7, 0x0D, 0x92, 0x9C, 0x77, 0x73, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6E, 0xA9, 0x99, 0xAE,
+    0x4E, 0x59, 0xDA, 0x2E, 0x7E, 0x19, 0xD7, 0x09, 0xD9, 0x0D, 0xA7, 0x1D, 0x99, 0xD7, 0x2D, 0x9A,
+    0xD7, 0x2D, 0x9D, 0xA7, 0x19, 0xD0, 0xDA, 0x71, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0x9D,
+    0x1E, 0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5, 0xFA, 0xAF, 0x7A, 0xFC, 0xA9, 0x77,
+    0x60, 0x79, 0x92, 0x97, 0x1E, 0xA0, 0x9C, 0x70, 0x9F, 0xE7, 0x0A, 0xC1, 0xE9, 0x75, 0x97, 0x77,
+    0x59, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D,
+    0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D,
+    0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD,
+    0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76, 0x6A, 0xC2, 0xAC, 0x70, 0xE9, 0x0A,
+    0xD9, 0x7E, 0x1A, 0xD7, 0x77, 0x77, 0x49, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4,
+    0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD,
+    0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1,
+    0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76,
+    0x71, 0xAC, 0x49, 0xC0, 0x9D, 0x29, 0xD1, 0x9D, 0x09, 0xD3, 0x9F, 0x5A, 0xD5, 0x9F, 0x39, 0xD0,
+    0x9D, 0x19, 0xD2, 0x9D, 0x0A, 0xC4, 0xAC, 0x97, 0x10, 0x71, 0x9A, 0xA9, 0x39, 0x79, 0xFE, 0xA0,
+    0xAC, 0x95, 0xEA, 0x99, 0x9A, 0xF9, 0x5E, 0x59, 0xDA, 0x5E, 0x6F, 0x49, 0xD6, 0xDA, 0xD9, 0x3D,
+    0xA5, 0xD9, 0x0D, 0x92, 0x9D, 0x5D, 0x2D, 0x92, 0xAD, 0x4D, 0x3D, 0x92, 0xDA, 0x3D, 0x39, 0xD3,
+    0xDA, 0x2D, 0x4A, 0xD3, 0xDA, 0x1D, 0x5D, 0xA3, 0xDA, 0x9D, 0x59, 0xD4, 0xFC, 0x6D, 0xA4, 0x9E,
+    0x6E, 0x59, 0xE9, 0x39, 0xE5, 0x9C, 0xAF, 0xAA, 0xEA, 0x6C, 0xA1, 0xAF, 0xCA, 0x97, 0x77, 0x20,
+    0x69, 0x77, 0x0D, 0x97, 0x6E, 0x97, 0x6A, 0xD9, 0x77, 0x99, 0x77, 0x70, 0x99, 0x99, 0x99, 0x49,
+    0x99, 0x99, 0x99, 0xFD, 0x39, 0xFC, 0xA0, 0x9A, 0xD9, 0x59, 0xDA, 0x3A, 0xCA, 0x7D, 0x93, 0xDA,
+    0x7D, 0x4D, 0x97, 0xD3, 0x9D, 0x79, 0xCA, 0x3A, 0xD7, 0xAC, 0x93, 0xAC, 0xA7, 0xD4, 0xD9, 0x7D,
+    0x4D, 0x97, 0xD3, 0x9D, 0x79, 0xCA, 0x39, 0xD7, 0xAC, 0x93, 0xAD, 0x7D, 0x49, 0xD6, 0xDA, 0x5E,
+    0x4E, 0x6A, 0xFF, 0xC7, 0x09, 0xFD, 0x97, 0x77, 0x10, 0x73, 0x99, 0x76, 0xAD, 0x74, 0xAE, 0xA7,
+    0x3F, 0x97, 0x4A, 0x97, 0x77, 0x29, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F, 0xCA,
+    0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C,
+    0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3,
+    0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F, 0xD9,
+    0x77, 0x71, 0x71, 0xA9, 0x76, 0xE9, 0x74, 0xDA, 0xD9, 0x71, 0x9D, 0x90, 0x9D, 0x71, 0xD3, 0x9C,
+    0x77, 0x69, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D,
+    0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9,
+    0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A,
+    0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77, 0x71, 0x6A, 0xA2,
+    0xAC, 0x71, 0xE1, 0xAD, 0x97, 0x0D, 0xA1, 0xE7, 0x77, 0x77, 0x09, 0x99, 0x99, 0x94, 0x99, 0x99,
+    0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4,
+    0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9,
+    0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6,
+    0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77, 0x71, 0x73, 0xA7, 0x59, 0xD9, 0x73, 0xF7, 0x29, 0xEA, 0x73,
+    0x9A, 0x97, 0x77, 0x09, 0x99, 0x99, 0x93, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E,
+    0x94, 0x9D, 0xA3, 0xAD, 0x5A, 0xCA, 0x5D, 0x93, 0x9D, 0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D,
+    0xA0, 0xAC, 0xA7, 0x1A, 0xD0, 0xD7, 0x3F, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97,
+    0x5D, 0x75, 0x9D, 0x74, 0xAE, 0xAA, 0x71, 0xFE, 0x70, 0x39, 0x99, 0x99, 0x97, 0x0F, 0xD9, 0x70,
+    0x9D, 0x97, 0x29, 0xD7, 0x3A, 0xFD, 0x96, 0xAD, 0xAA, 0xF5, 0xD9, 0x29, 0xDA, 0x4D, 0x4A, 0xD3,
+    0x9D, 0x4A, 0xD3, 0xAC, 0xA4, 0xAC, 0xA3, 0xDA, 0x4D, 0x93, 0xD9, 0x3E, 0x4D, 0x2A, 0xE4, 0x9F,
+    0xE9, 0x5A, 0xDA, 0x99, 0x70, 0xD9, 0x71, 0x9A, 0xDA, 0x97, 0x9F, 0xD7, 0x75, 0x9A, 0x97, 0x6F,
+    0xD7, 0x4D, 0xA9, 0x9E, 0x72, 0xD9, 0x29, 0xD7, 0x19, 0xD4, 0xD7, 0x1D, 0x93, 0x9C, 0x97, 0x1D,
+    0x4D, 0x71, 0x9D, 0x3A, 0xC7, 0x2A, 0xCA, 0x29, 0xC9, 0x72, 0xAC, 0x92, 0xCA, 0x73, 0xD9, 0x19,
+    0xCA, 0x73, 0xD2, 0x9D, 0x97, 0x19, 0xD3, 0xAD, 0x97, 0x0A, 0xCA, 0x4E, 0x70, 0xD9, 0x5D, 0xA7,
+    0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD0, 0xAC, 0x3A, 0xC9, 0x6A, 0xCA, 0x0E, 0xAA, 0xAC, 0xA7,
+    0xD9, 0x1F, 0xC9, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0x0D, 0x97, 0x39, 0xC9, 0x09, 0xD7, 0x4A, 0xFC,
+    0x76, 0xAD, 0xA7, 0x60, 0x77, 0x19, 0xC7, 0x2D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x29, 0xC9, 0x77,
+    0x77, 0x09, 0xAD, 0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4,
+    0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A,
+    0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x77, 0x5A, 0xC9, 0x70,
+    0x9D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x1C, 0x97, 0x77, 0x71, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF,
+    0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1,
+    0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9,
+    0x0F, 0x1F, 0x2E, 0x76, 0x77, 0x39, 0xD7, 0x09, 0xEA, 0x7D, 0x9D, 0x6D, 0x1A, 0xC9, 0x4D, 0x92,
+    0xCA, 0x77, 0x76, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91,
+    0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D,
+    0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x77, 0x1A, 0xD9,
+    0x09, 0xC4, 0x9F, 0xAD, 0x4A, 0xC1, 0xE9, 0x59, 0x29, 0x77, 0x77, 0x09, 0xAD, 0xA0, 0x9C, 0x92,
+    0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A,
+    0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA,
+    0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x49, 0x92, 0x99, 0x4A, 0xD9, 0x0A, 0xD9, 0x3A, 0xD1, 0xAD,
+    0x59, 0x39, 0x77, 0x77, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D,
+    0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E,
+    0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x69, 0xA9,
+    0x70, 0xAE, 0xA6, 0x9C, 0x90, 0xAC, 0x6A, 0xC1, 0x9C, 0x6A, 0xC1, 0xAC, 0x69, 0xF9, 0x79, 0xAA,
+    0x77, 0x49, 0xAD, 0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4,
+    0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A,
+    0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x77, 0x6A, 0xE9, 0x1A,
+    0xEA, 0x39, 0xFF, 0xCA, 0xAD, 0x91, 0x9D, 0x92, 0xAD, 0x2A, 0xCA, 0x1D, 0x93, 0xD3, 0xD9, 0x0A,
+    0xCA, 0x39, 0xCA, 0x2A, 0xD1, 0xD4, 0xD9, 0x1E, 0x19, 0xCA, 0x39, 0xD9, 0xEA, 0x2A, 0xC9, 0x3F,
+    0xC9, 0x4D, 0x92, 0xAE, 0x7D, 0x92, 0xF5, 0x90, 0xDA, 0x1D, 0x0D, 0x92, 0xAC, 0xA0, 0xAF, 0xC1,
+    0xFE, 0xA2, 0xEA, 0x3F, 0xC9, 0x77, 0x40, 0x75, 0x9F, 0x3A, 0xFC, 0x91, 0xAC, 0xA1, 0x9A, 0x19,
+    0xCA, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x96, 0xDA, 0x49, 0x0A, 0xD2, 0x9C, 0xA0, 0x9F,
+    0xE2, 0xAF, 0x97, 0x69, 0xAA, 0x6A, 0xDA, 0x69, 0xCA, 0x6D, 0x59, 0xD6, 0x99, 0x60, 0x76, 0x9C,
+    0x70, 0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x09, 0xC9, 0x77, 0x73, 0x9A, 0xE4, 0xAC, 0xAA, 0xE2, 0xAC,
+    0x91, 0x9D, 0x19, 0xCA, 0x29, 0xD1, 0xD3, 0xD9, 0x09, 0xCA, 0x1A, 0xD9, 0x1A, 0xCA, 0xAE, 0x3F,
+    0xA9, 0x4D, 0x97, 0xD9, 0x49, 0x1E, 0x29, 0xD1, 0x9F, 0xE9, 0x2A, 0xFA, 0x76, 0x77, 0x2A, 0xC9,
+    0x69, 0xD9, 0x6D, 0x96, 0xD9, 0x7C, 0x97, 0x77, 0x49, 0xAE, 0x4A, 0xCA, 0xAE, 0x2A, 0xC9, 0x19,
+    0xD1, 0x9C, 0xA2, 0x9D, 0x1D, 0x3D, 0x90, 0x9C, 0xA1, 0xAD, 0x91, 0xAC, 0xAA, 0xE3, 0xFA, 0x94,
+    0xD9, 0x7D, 0x94, 0x91, 0xE2, 0x9D, 0x19, 0xFE, 0x92, 0xAF, 0xA7, 0x60, 0x77, 0x09, 0xD6, 0x9E,
+    0xA5, 0xD9, 0xD4, 0xD1, 0xAC, 0x92, 0xD9, 0x2C, 0xA7, 0x77, 0x19, 0xAE, 0x4A, 0xCA, 0xAE, 0x2A,
+    0xC9, 0x19, 0xD1, 0x9C, 0xA2, 0x9D, 0x1D, 0x3D, 0x90, 0x9C, 0xA1, 0xAD, 0x91, 0xAC, 0xAA, 0xE3,
+    0xFA, 0x94, 0xD9, 0x7D, 0x94, 0x91, 0xE2, 0x9D, 0x19, 0xFE, 0x92, 0xAF, 0xA7, 0x60, 0x39, 0x92,
+    0x99, 0x3A, 0xD9, 0x0A, 0xD9, 0x2A, 0xD1, 0xAD, 0x49, 0x39, 0x77, 0x75, 0x9A, 0xE5, 0xAC, 0xAA,
+    0xE3, 0xAC, 0x91, 0x9D, 0x29, 0xCA, 0x29, 0xD2, 0xD3, 0xD9, 0x19, 0xCA, 0x1A, 0xD9, 0x2A, 0xCA,
+    0xAE, 0x4F, 0xA9, 0x5D, 0x97, 0x0D, 0x94, 0x92, 0xE2, 0x9D, 0x29, 0xFE, 0x93, 0xAF, 0xA7, 0x70,
+    0x70, 0x9C, 0x4D, 0x93, 0xAD, 0x4A, 0xD4, 0x9C, 0x97, 0x6A, 0xE1, 0x9F, 0x4D, 0x39, 0xD3, 0xAC,
+    0xA3, 0xD9, 0x29, 0xD3, 0xAD, 0x3D, 0x93, 0xD1, 0x90, 0x9D, 0x0D, 0x0A, 0xF1, 0x9D, 0xA7, 0x10,
+    0x76, 0xAC, 0x94, 0x9D, 0x94, 0xD9, 0x4D, 0x95, 0xC9, 0x77, 0x5A, 0xE3, 0x9F, 0x6D, 0x59, 0xD5,
+    0xAC, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0x95, 0xD1, 0x92, 0x9D, 0x0D, 0x2A, 0xF3, 0x9D, 0xA7,
+    0x50, 0x74, 0x9D, 0x49, 0xEA, 0x3D, 0x9D, 0x2D, 0x1A, 0xC9, 0x0D, 0x92, 0xCA, 0x77, 0x2A, 0xE3,
+    0x9F, 0x6D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0x95, 0xD1, 0x92, 0x9D, 0x0D,
+    0x2A, 0xF3, 0x9D, 0xA7, 0x50, 0x19, 0x92, 0x99, 0x1A, 0xD9, 0x0A, 0xD9, 0x0A, 0xD1, 0xAD, 0x29,
+    0x39, 0x77, 0x6A, 0xE4, 0x9F, 0x7D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0x96,
+    0xD1, 0x93, 0x9D, 0x0D, 0x3A, 0xF4, 0x9D, 0xA7, 0x70, 0x59, 0xA2, 0x96, 0xE0, 0xAC, 0x96, 0xF7,
+    0x0A, 0xD9, 0x7D, 0x9D, 0x7A, 0x1A, 0xCA, 0x72, 0xD5, 0xAE, 0xAA, 0xC3, 0x9E, 0xAF, 0x92, 0xD9,
+    0x2A, 0xDA, 0x1D, 0xA4, 0xDA, 0x09, 0xD5, 0xDA, 0x0A, 0xCA, 0x5D, 0x90, 0xD9, 0x5D, 0x1D, 0x95,
+    0xD1, 0xD9, 0x4A, 0xCA, 0x1D, 0x94, 0xD2, 0xE3, 0xD9, 0x29, 0xEA, 0xAD, 0xA4, 0x9F, 0xC9, 0x77,
+    0x00, 0x77, 0x2A, 0xD9, 0x09, 0xC5, 0x9F, 0xAD, 0x5A, 0xC0, 0x9E, 0x96, 0x91, 0x99, 0x77, 0x77,
+    0x9A, 0xDA, 0x2A, 0xDA, 0x1A, 0xF1, 0xFC, 0x39, 0xCA, 0x0D, 0x90, 0xD9, 0x2A, 0xCA, 0xD2, 0xD3,
+    0xF2, 0x9D, 0x3E, 0x92, 0xAC, 0xA3, 0xDA, 0x3D, 0x92, 0x9D, 0x4D, 0x3A, 0xCA, 0x39, 0xD3, 0xD9,
+    0x3A, 0xCA, 0x09, 0x1D, 0x4D, 0x99, 0xC9, 0x9D, 0x4F, 0xA0, 0xAC, 0xA4, 0xEA, 0x77, 0x77, 0x09,
+    0xC7, 0x1D, 0xA7, 0x0A, 0xD7, 0x1A, 0xD7, 0x19, 0xC9, 0x77, 0x75, 0x9A, 0xEA, 0x4A, 0xFD, 0xA2,
+    0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D, 0x9A, 0xCA, 0x5D, 0x9D, 0x95, 0xD0,
+    0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E, 0xAA, 0xDA, 0x39, 0xFC, 0x97, 0x70,
+    0x77, 0x4A, 0xC9, 0x79, 0xD9, 0x7D, 0x97, 0xD9, 0x70, 0xC9, 0x77, 0x76, 0x9A, 0xEA, 0x4A, 0xFD,
+    0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D, 0x9A, 0xCA, 0x5D, 0x9D, 0x95,
+    0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E, 0xAA, 0xDA, 0x39, 0xFC, 0x97,
+    0x70, 0x77, 0x29, 0xD7, 0x0E, 0xA6, 0xD9, 0xD5, 0xD9, 0x0A, 0xC9, 0x3D, 0x92, 0xCA, 0x77, 0x73,
+    0x9A, 0xEA, 0x4A, 0xFD, 0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D, 0x9A,
+    0xCA, 0x5D, 0x9D, 0x95, 0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E, 0xAA,
+    0xDA, 0x39, 0xFC, 0x97, 0x70, 0x77, 0x1A, 0xDA, 0x09, 0xC4, 0x9F, 0xAD, 0x4A, 0xC1, 0xE9, 0x59,
+    0x29, 0x77, 0x77, 0x09, 0xAE, 0xA5, 0xAF, 0xDA, 0x3E, 0x29, 0xD2, 0xAD, 0x4D, 0x91, 0xD9, 0x4D,
+    0xA0, 0x9D, 0x5D, 0x90, 0xAC, 0xA5, 0xD9, 0x0D, 0x95, 0xD1, 0xD9, 0x4A, 0xCA, 0x1D, 0xA4, 0xD2,
+    0xAD, 0x3D, 0xA2, 0x9E, 0xAA, 0xDA, 0x49, 0xFC, 0x97, 0x71, 0x49, 0x92, 0x99, 0x4A, 0xD9, 0x0A,
+    0xD9, 0x3A, 0xD1, 0xAD, 0x59, 0x39, 0x77, 0x77, 0x9A, 0xEA, 0x5A, 0xFD, 0xA3, 0xE2, 0x9D, 0x2A,
+    0xD4, 0xD9, 0x1D, 0x94, 0xDA, 0x09, 0xD5, 0xD9, 0x0A, 0xCA, 0x5D, 0x90, 0xD9, 0x5D, 0x1D, 0x94,
+    0xAC, 0xA1, 0xDA, 0x4D, 0x2A, 0xD3, 0xDA, 0x29, 0xEA, 0xAD, 0xA4, 0x9F, 0xC9, 0x77, 0x10, 0x76,
+    0x9D, 0x7A, 0xD9, 0x69, 0xCA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFD, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x7C, 0xA7, 0xAD, 0x96, 0xAD, 0x76, 0x77, 0x59, 0xAE, 0xA0, 0x9C, 0x5A, 0xFF,
+    0xA4, 0xE2, 0x9D, 0xA4, 0xAD, 0x3A, 0xD9, 0x4D, 0x92, 0xFA, 0x39, 0xD2, 0xD0, 0xDA, 0x3A, 0xCA,
+    0x09, 0xD1, 0xD9, 0x3D, 0x99, 0xCA, 0x2D, 0x4F, 0xA2, 0xAC, 0xA4, 0xE9, 0x3D, 0x5E, 0x3D, 0xA4,
+    0xFC, 0xAA, 0xDA, 0x4A, 0xC0, 0x9F, 0xC9, 0x77, 0x50, 0x77, 0x29, 0xC7, 0x3D, 0xA7, 0x29, 0xD9,
+    0x72, 0x9D, 0x73, 0x9C, 0x97, 0x77, 0x70, 0xAE, 0x49, 0xCA, 0x0A, 0xF4, 0xD9, 0x3D, 0x4D, 0x39,
+    0xD3, 0x9D, 0x3A, 0xCA, 0x39, 0xCA, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x3A, 0xCA, 0x3A, 0xD3, 0xD9,
+    0x29, 0xDA, 0x3D, 0x92, 0xCA, 0xCA, 0x3D, 0x91, 0xD9, 0xCA, 0x9C, 0x90, 0xFD, 0x09, 0xF1, 0x9E,
+    0xA2, 0xDA, 0x77, 0x77, 0x69, 0xC9, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x2C, 0x97, 0x77,
+    0x71, 0xAE, 0x49, 0xCA, 0x0A, 0xF4, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x3A, 0xCA, 0x39, 0xCA,
+    0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x3A, 0xCA, 0x3A, 0xD3, 0xD9, 0x29, 0xDA, 0x3D, 0x92, 0xCA, 0xCA,
+    0x3D, 0x91, 0xD9, 0xCA, 0x9C, 0x90, 0xFD, 0x09, 0xF1, 0x9E, 0xA2, 0xDA, 0x77, 0x77, 0x49, 0xD7,
+    0x2F, 0x70, 0xD9, 0xD9, 0x6A, 0xC9, 0x09, 0xCA, 0x5A, 0xC9, 0x2C, 0xA7, 0x77, 0x6A, 0xE4, 0x9C,
+    0xA0, 0xAF, 0x4D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93,
+    0xD4, 0xD3, 0xAC, 0xA3, 0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9, 0x2C, 0xAC, 0xA3, 0xD9, 0x1D, 0x9C,
+    0xA9, 0xC9, 0x0F, 0xD0, 0x9F, 0x19, 0xEA, 0x2D, 0xA7, 0x70, 0x49, 0xA2, 0x9A, 0x59, 0xD9, 0x09,
+    0xD9, 0x4A, 0xD1, 0xAD, 0x69, 0x39, 0x77, 0x77, 0xAE, 0x49, 0xCA, 0x0A, 0xF4, 0xD9, 0x3D, 0x4D,
+    0x39, 0xD3, 0x9D, 0x3A, 0xCA, 0x39, 0xCA, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x3A, 0xCA, 0x3A, 0xD3,
+    0xD9, 0x29, 0xDA, 0x3D, 0x92, 0xCA, 0xCA, 0x3D, 0x91, 0xD9, 0xCA, 0x9C, 0x90, 0xFD, 0x09, 0xF1,
+    0x9E, 0xA2, 0xDA, 0x77, 0x77, 0x73, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x39, 0xD7, 0x4A, 0xA7, 0x77,
+    0x77, 0x09, 0xDA, 0x39, 0xD3, 0x9F, 0x4D, 0xA5, 0xDA, 0x3A, 0xCA, 0x5A, 0xD3, 0xAC, 0x96, 0xD3,
+    0xD7, 0xD9, 0x2D, 0x7A, 0xC9, 0x19, 0xC9, 0x7A, 0xCA, 0x1D, 0x70, 0x9C, 0xA0, 0x9C, 0x97, 0x09,
+    0xCA, 0x0D, 0x72, 0xCA, 0xAC, 0x72, 0x9C, 0xAC, 0x97, 0x29, 0xDA, 0x73, 0xAD, 0x74, 0xD7, 0x39,
+    0xD7, 0x0A, 0x99, 0xAD, 0x71, 0xFA, 0x72, 0xAC, 0xA9, 0x72, 0x69, 0x72, 0xAF, 0x71, 0x9A, 0xAD,
+    0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9C, 0xA1, 0xAD, 0xA5, 0xAC, 0x90, 0xFC,
+    0x94, 0xD9, 0xD1, 0xDA, 0x4D, 0xAC, 0x2A, 0xD4, 0xE3, 0xAC, 0xA3, 0x9D, 0x93, 0xAC, 0xA3, 0xAD,
+    0x4D, 0x93, 0xD9, 0x4D, 0x4D, 0x4A, 0xCA, 0x39, 0xD4, 0xD4, 0xAC, 0xA3, 0xDA, 0x4F, 0xAA, 0xDA,
+    0x5D, 0xAF, 0x95, 0x9D, 0x73, 0x9C, 0xA7, 0x3A, 0xC9, 0x73, 0xD7, 0x29, 0xFC, 0xA7, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x7A, 0x3A, 0x70, 0xDA, 0x1D, 0xA6, 0x9D, 0x90, 0x9D, 0x97, 0x93, 0x97, 0x77, 0x76,
+    0x9D, 0xA3, 0x9D, 0x39, 0xF4, 0xDA, 0x5D, 0xA3, 0xAC, 0xA5, 0xAD, 0x3A, 0xC9, 0x6D, 0x3D, 0x7D,
+    0x92, 0xD7, 0xAC, 0x91, 0x9C, 0x97, 0xAC, 0xA1, 0xD7, 0x09, 0xCA, 0x09, 0xC9, 0x70, 0x9C, 0xA0,
+    0xD7, 0x2C, 0xAA, 0xC7, 0x29, 0xCA, 0xC9, 0x72, 0x9D, 0xA7, 0x3A, 0xD7, 0x4D, 0x73, 0x9D, 0x70,
+    0xA9, 0x9A, 0xD7, 0x1F, 0xA7, 0x2A, 0xCA, 0x97, 0x20, 0x77, 0x73, 0x9F, 0xE7, 0x29, 0xFD, 0xA7,
+    0x77, 0x77, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0,
+    0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70,
+    0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95,
+    0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x4A, 0xAA, 0xAA,
+    0xAA, 0x49, 0xFE, 0x77, 0x77, 0x73, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA,
+    0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91,
+    0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76,
+    0x71, 0x97, 0x70, 0x9C, 0xA2, 0x9C, 0x72, 0x9D, 0xA9, 0xAC, 0xA7, 0x3A, 0xFA, 0x75, 0x99, 0x97,
+    0x77, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D,
+    0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA,
+    0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7,
+    0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x77, 0x1C, 0x93, 0xA4,
+    0x9D, 0x90, 0x9D, 0x5F, 0xD7, 0xAD, 0xA7, 0x77, 0x70, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29,
+    0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC,
+    0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F,
+    0x1F, 0x2E, 0x76, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74,
+    0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA,
+    0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D,
+    0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x75, 0x9C,
+    0xA7, 0x69, 0xCA, 0x77, 0xAC, 0x97, 0x7A, 0xDA, 0x97, 0x59, 0xEA, 0x77, 0x30, 0x77, 0x09, 0xAD,
+    0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2, 0xD4, 0x9D,
+    0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1, 0x9E, 0x1A,
+    0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x19, 0xC7, 0x2C, 0x97, 0x1A, 0xC7, 0x2A, 0xCA,
+    0x99, 0x79, 0xEA, 0x75, 0x74, 0xA7, 0x3A, 0xD7, 0x19, 0xF7, 0x0A, 0xE9, 0x71, 0xA9, 0x77, 0x72,
+    0x99, 0xAA, 0x99, 0x6A, 0xFF, 0x93, 0xEA, 0x99, 0xAE, 0xA2, 0xE5, 0xAC, 0x91, 0xE6, 0xAC, 0x19,
+    0xD7, 0xAA, 0x1D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3E, 0x73,
+    0xAD, 0x73, 0x9D, 0xA7, 0xC2, 0xF9, 0x29, 0xAD, 0x3F, 0xFD, 0x5A, 0xFD, 0x97, 0x72, 0x77, 0x2A,
+    0xC9, 0x69, 0xD9, 0x6D, 0x96, 0xD9, 0x7C, 0x97, 0x77, 0x49, 0xF4, 0xAF, 0xC9, 0x2A, 0xCA, 0x19,
+    0xA2, 0x9C, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7D, 0xA4, 0x91, 0xAD, 0x29, 0xCA,
+    0x19, 0xFE, 0x3A, 0xF9, 0x76, 0x71, 0xAA, 0x73, 0xEA, 0x71, 0xDA, 0xDA, 0x7D, 0xA1, 0xD6, 0xAC,
+    0x93, 0xC7, 0x76, 0x99, 0xAA, 0x99, 0x6A, 0xFF, 0x93, 0xEA, 0x99, 0xAE, 0xA2, 0xE5, 0xAC, 0x91,
+    0xE6, 0xAC, 0x19, 0xD7, 0xAA, 0x1D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D,
+    0xA7, 0x3E, 0x73, 0xAD, 0x73, 0x9D, 0xA7, 0xC2, 0xF9, 0x29, 0xAD, 0x3F, 0xFD, 0x5A, 0xFD, 0x97,
+    0x72, 0x77, 0x09, 0xD6, 0x9E, 0xA5, 0xD9, 0xD4, 0xD1, 0xAC, 0x92, 0xD9, 0x2C, 0xA7, 0x77, 0x19,
+    0xF4, 0xAF, 0xC9, 0x2A, 0xCA, 0x19, 0xA2, 0x9C, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD9,
+    0x7D, 0xA4, 0x91, 0xAD, 0x29, 0xCA, 0x19, 0xFE, 0x3A, 0xF9, 0x76, 0x77, 0x7A, 0xD7, 0x3E, 0x73,
+    0xD9, 0x77, 0x77, 0x79, 0x9A, 0xA9, 0x96, 0xAF, 0xF9, 0x3E, 0xA9, 0x9A, 0xEA, 0x2E, 0x5A, 0xC9,
+    0x1E, 0x6A, 0xC1, 0x9D, 0x7A, 0xA1, 0xDA, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xDA, 0x73,
+    0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xDA, 0x7C, 0x2F, 0x92, 0x9A, 0xD3, 0xFF, 0xD5, 0xAF, 0xD9,
+    0x77, 0x20, 0x59, 0xC9, 0x6E, 0x59, 0xDA, 0x69, 0x97, 0x77, 0x19, 0xF3, 0xAF, 0xC9, 0x1A, 0xCA,
+    0x19, 0xA1, 0x9C, 0xA6, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD9, 0x6D, 0xA4, 0x90, 0xAD, 0x29,
+    0xCA, 0x09, 0xFE, 0x2A, 0xF9, 0x74, 0x77, 0x59, 0xC4, 0xD6, 0x9D, 0x19, 0xD7, 0x0E, 0x9D, 0x72,
+    0xF7, 0x39, 0xD7, 0x77, 0x39, 0x9A, 0xA9, 0x97, 0xAF, 0xF9, 0x4E, 0xA9, 0x9A, 0xEA, 0x3E, 0x5A,
+    0xC9, 0x2E, 0x6A, 0xC2, 0x9D, 0x7A, 0xA2, 0xDA, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA,
+    0x74, 0xDA, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xDA, 0x7C, 0x3F, 0x92, 0x9A, 0xD4, 0xFF, 0xD6, 0xAF,
+    0xD9, 0x77, 0x40, 0x77, 0xCA, 0x2A, 0xC9, 0x3D, 0x1A, 0xC9, 0x4A, 0xCA, 0xAC, 0xA6, 0xEA, 0x79,
+    0xD7, 0x77, 0x79, 0xF5, 0xAF, 0xC9, 0x3A, 0xCA, 0x19, 0xA3, 0x9C, 0xA7, 0x0D, 0x70, 0x9D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA4, 0x92, 0xAD, 0x29, 0xCA, 0x29, 0xFE, 0x4A, 0xF9,
+    0x77, 0x00, 0x77, 0x72, 0xAC, 0x3A, 0xCA, 0x71, 0xDA, 0x1A, 0xCA, 0x72, 0x9D, 0x9A, 0xCA, 0x74,
+    0xAE, 0xA7, 0x6A, 0xCA, 0x77, 0x76, 0x99, 0xAA, 0xA9, 0x97, 0x1F, 0xFD, 0xA6, 0x9A, 0x9D, 0x90,
+    0x99, 0xF9, 0x69, 0xD4, 0x9E, 0x6A, 0xD5, 0x9D, 0xA5, 0xAC, 0xA6, 0xE5, 0xD9, 0x6A, 0xD5, 0xD7,
+    0x9D, 0x49, 0xD7, 0xAD, 0x4A, 0xD7, 0xAD, 0x4D, 0xA7, 0xDA, 0x4D, 0x97, 0xD9, 0x4D, 0x7A, 0xD4,
+    0x9D, 0x69, 0xD9, 0x4A, 0xD6, 0xDA, 0x5D, 0xA4, 0xAD, 0xA4, 0x9A, 0xEA, 0xAA, 0xF9, 0x49, 0xFF,
+    0xCA, 0x97, 0x77, 0x10, 0x77, 0x97, 0x7A, 0xC9, 0x72, 0x99, 0x1A, 0xC9, 0x79, 0xF1, 0xD7, 0x09,
+    0xAA, 0xD1, 0xCA, 0x72, 0x9D, 0x09, 0xC7, 0x3A, 0xCA, 0x19, 0x73, 0xD9, 0x76, 0xD7, 0x2A, 0xDA,
+    0x9D, 0x70, 0x9F, 0xEA, 0x79, 0xD9, 0x1A, 0xD9, 0x7D, 0x4D, 0x7A, 0xCA, 0x4D, 0x7D, 0x49, 0xCA,
+    0x69, 0xCA, 0x4A, 0xCA, 0x6A, 0xC9, 0x39, 0xD9, 0x6D, 0x93, 0xE7, 0xD9, 0x2A, 0xE1, 0x94, 0xE1,
+    0xAC, 0x0D, 0x0D, 0x4A, 0xFC, 0x90, 0xF6, 0xF2, 0xE7, 0x77, 0x00, 0x59, 0x9A, 0xAA, 0x99, 0x71,
+    0xFF, 0xDA, 0x69, 0xA9, 0xD9, 0x09, 0x9F, 0x96, 0x9D, 0x49, 0xE6, 0xAD, 0x59, 0xDA, 0x5A, 0xCA,
+    0x6E, 0x5D, 0x96, 0xAD, 0x5D, 0x79, 0xD2, 0x99, 0xAD, 0x99, 0x99, 0x3A, 0xD2, 0xFF, 0xC3, 0xAD,
+    0x4D, 0xA7, 0xDA, 0x4D, 0x97, 0xD9, 0x4D, 0x7A, 0xD4, 0x9D, 0x69, 0xD9, 0x4A, 0xD6, 0xDA, 0x5D,
+    0xA4, 0xAD, 0xA4, 0x9A, 0xEA, 0xAA, 0xF9, 0x49, 0xFF, 0xCA, 0x97, 0x77, 0x10, 0x72, 0x99, 0x71,
+    0x9F, 0x71, 0x9A, 0xAD, 0x73, 0x9D, 0x70, 0xAA, 0xAE, 0xA9, 0x6A, 0xAA, 0xEA, 0x72, 0xD7, 0x9A,
+    0xA9, 0x0D, 0x6F, 0xEA, 0x5D, 0xA0, 0x9E, 0x94, 0xD9, 0x3D, 0x4A, 0xCA, 0x4D, 0x4D, 0x49, 0xCA,
+    0x39, 0xCA, 0x4A, 0xCA, 0x3A, 0xC9, 0x39, 0xD9, 0x3D, 0x93, 0xE4, 0xD9, 0x2A, 0xE1, 0x91, 0xE1,
+    0xAC, 0x0D, 0x0D, 0x1A, 0xFC, 0x90, 0xF3, 0xF2, 0xE7, 0x72, 0x77, 0x70, 0xFE, 0x71, 0xFE, 0x77,
+    0x77, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D,
+    0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF,
+    0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3,
+    0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x3A, 0xAA, 0xAA, 0xAA, 0x39, 0xFE, 0x77, 0x77, 0x70, 0x9A,
+    0xE5, 0xAC, 0xAA, 0xE3, 0xAC, 0x91, 0x9D, 0x29, 0xCA, 0x29, 0xD2, 0xD3, 0xD9, 0x19, 0xCA, 0x1A,
+    0xD9, 0x2A, 0xCA, 0xAE, 0x4F, 0xA9, 0x5D, 0x97, 0x0D, 0x94, 0x92, 0xE2, 0x9D, 0x29, 0xFE, 0x93,
+    0xAF, 0xA7, 0x70, 0x70, 0x97, 0x6D, 0x3A, 0x97, 0x0E, 0x9A, 0xD7, 0x19, 0xFC, 0x74, 0x99, 0x97,
+    0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D,
+    0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF,
+    0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3,
+    0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x77, 0xC9, 0x3A, 0x39, 0xD9, 0x09, 0xD4, 0xFD, 0x6A, 0xDA,
+    0x77, 0x76, 0x9A, 0xE5, 0xAC, 0xAA, 0xE3, 0xAC, 0x91, 0x9D, 0x29, 0xCA, 0x29, 0xD2, 0xD3, 0xD9,
+    0x19, 0xCA, 0x1A, 0xD9, 0x2A, 0xCA, 0xAE, 0x4F, 0xA9, 0x5D, 0x97, 0x0D, 0x94, 0x92, 0xE2, 0x9D,
+    0x29, 0xFE, 0x93, 0xAF, 0xA7, 0x70, 0x77, 0x72, 0xAD, 0x75, 0xE7, 0x5D, 0x97, 0x77, 0x77, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5,
+    0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D,
+    0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF,
+    0xD9, 0x29, 0xFF, 0xF3, 0x59, 0xC9, 0x7E, 0x69, 0xDA, 0x79, 0x97, 0x77, 0x49, 0xAE, 0x4A, 0xCA,
+    0xAE, 0x2A, 0xC9, 0x19, 0xD1, 0x9C, 0xA2, 0x9D, 0x1D, 0x3D, 0x90, 0x9C, 0xA1, 0xAD, 0x91, 0xAC,
+    0xAA, 0xE3, 0xFA, 0x94, 0xD9, 0x7D, 0x94, 0x91, 0xE2, 0x9D, 0x19, 0xFE, 0x92, 0xAF, 0xA7, 0x60,
+    0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C,
+    0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA,
+    0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A,
+    0xFF, 0xD9, 0x29, 0xFF, 0xF7, 0x5C, 0xA7, 0x5C, 0xA7, 0x5A, 0xC9, 0x75, 0xAD, 0xA9, 0x74, 0xF7,
+    0x74, 0x76, 0x9A, 0xE4, 0xAC, 0xAA, 0xE2, 0xAC, 0x91, 0x9D, 0x19, 0xCA, 0x29, 0xD1, 0xD3, 0xD9,
+    0x09, 0xCA, 0x1A, 0xD9, 0x1A, 0xCA, 0xAE, 0x3F, 0xA9, 0x4D, 0x97, 0xD9, 0x49, 0x1E, 0x29, 0xD1,
+    0x9F, 0xE9, 0x2A, 0xFC, 0x7A, 0xC7, 0x9C, 0x97, 0xD7, 0x0D, 0xA9, 0x6A, 0xE9, 0x75, 0x77, 0x79,
+    0xC9, 0x3D, 0x79, 0xD1, 0x9D, 0x97, 0x0E, 0x9D, 0x73, 0xF7, 0x5D, 0x77, 0x71, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x4F, 0xFF, 0x59, 0xDA, 0xAA, 0xAA, 0xAD, 0x59, 0xD5, 0xCA, 0x5A, 0xD5, 0xC6,
+    0xAC, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0xAA, 0xAA, 0xAA, 0x7A, 0xFE, 0xA7, 0xDA, 0x75, 0xD9,
+    0x75, 0xD7, 0x59, 0xD5, 0x9C, 0x5A, 0xD5, 0xD5, 0xDA, 0x49, 0xCA, 0x39, 0xAF, 0xFD, 0x92, 0x9F,
+    0xFF, 0x30, 0x77, 0xCA, 0x2A, 0xC9, 0x3D, 0x1A, 0xC9, 0x4A, 0xCA, 0xAC, 0xA6, 0xEA, 0x79, 0xD7,
+    0x77, 0x79, 0xAE, 0x5A, 0xCA, 0xAE, 0x3A, 0xC9, 0x19, 0xD2, 0x9C, 0xA2, 0x9D, 0x2D, 0x3D, 0x91,
+    0x9C, 0xA1, 0xAD, 0x92, 0xAC, 0xAA, 0xE4, 0xFA, 0x95, 0xD9, 0x70, 0xD9, 0x49, 0x2E, 0x29, 0xD2,
+    0x9F, 0xE9, 0x3A, 0xFA, 0x77, 0x00, 0x71, 0x9A, 0x75, 0xAE, 0x73, 0xAF, 0xC7, 0x1A, 0xD1, 0xD9,
+    0x79, 0xCA, 0x3C, 0x97, 0x77, 0x29, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x49, 0xEA, 0x99, 0xAE, 0xA3,
+    0x9D, 0xA5, 0xAC, 0xA2, 0x9D, 0x96, 0xAC, 0x92, 0xDA, 0x7A, 0xA2, 0x9D, 0x75, 0xAC, 0xA7, 0x5D,
+    0x97, 0x5D, 0x97, 0x49, 0xD5, 0x9F, 0xD0, 0x9D, 0x69, 0x9E, 0x2D, 0x97, 0xAC, 0xA2, 0xDA, 0x7D,
+    0xA2, 0xAD, 0x96, 0xD9, 0x3E, 0xA4, 0x9D, 0x49, 0xFF, 0xE6, 0xAF, 0xDA, 0x97, 0x74, 0x77, 0x73,
+    0xAD, 0x74, 0x9E, 0x97, 0x3D, 0x9D, 0x72, 0xD1, 0xD9, 0x70, 0xD3, 0xC9, 0x77, 0x77, 0x72, 0xAF,
+    0xCA, 0xC9, 0x59, 0xDA, 0xAF, 0xC5, 0x9D, 0x29, 0xCA, 0x7D, 0x92, 0x9D, 0x7D, 0x39, 0xCA, 0x7D,
+    0x3D, 0x70, 0xD9, 0x1D, 0x97, 0x09, 0xFC, 0x97, 0x29, 0xD9, 0x73, 0x9C, 0xA7, 0x5A, 0xD7, 0x5A,
+    0xEA, 0x97, 0x0A, 0xDA, 0xAF, 0x59, 0xD9, 0x3A, 0xE4, 0xD9, 0x59, 0xD9, 0x3D, 0x96, 0xD9, 0x3E,
+    0x93, 0x9D, 0xA5, 0xFF, 0xCA, 0x79, 0xAE, 0xA9, 0x60, 0x79, 0x49, 0x70, 0xD3, 0xAA, 0x70, 0xEA,
+    0xAD, 0x71, 0x9F, 0xC7, 0x49, 0x99, 0x77, 0x75, 0x9A, 0xAA, 0x97, 0x1A, 0xFF, 0xA4, 0x9E, 0xA9,
+    0x9A, 0xEA, 0x39, 0xDA, 0x5A, 0xCA, 0x29, 0xD9, 0x6A, 0xC9, 0x2D, 0xA7, 0xAA, 0x29, 0xD7, 0x5A,
+    0xCA, 0x75, 0xD9, 0x75, 0xD9, 0x74, 0x9D, 0x59, 0xFD, 0x09, 0xD6, 0x99, 0xE2, 0xD9, 0x7A, 0xCA,
+    0x2D, 0xA7, 0xDA, 0x2A, 0xD9, 0x6D, 0x93, 0xEA, 0x49, 0xD4, 0x9F, 0xFE, 0x6A, 0xFD, 0xA9, 0x77,
+    0x40, 0x77, 0x71, 0xC9, 0x3C, 0x70, 0x9D, 0x90, 0x9C, 0xA7, 0x1F, 0xD7, 0x3A, 0xCA, 0x97, 0x77,
+    0x77, 0x4A, 0xFC, 0xAC, 0x95, 0x9D, 0xAA, 0xFC, 0x59, 0xD2, 0x9C, 0xA7, 0xD9, 0x29, 0xD7, 0xD3,
+    0x9C, 0xA7, 0xD3, 0xD7, 0x0D, 0x91, 0xD9, 0x70, 0x9F, 0xC9, 0x72, 0x9D, 0x97, 0x39, 0xCA, 0x75,
+    0xAD, 0x75, 0xAE, 0xA9, 0x70, 0xAD, 0xAA, 0xF5, 0x9D, 0x93, 0xAE, 0x4D, 0x95, 0x9D, 0x93, 0xD9,
+    0x6D, 0x93, 0xE9, 0x39, 0xDA, 0x5F, 0xFC, 0xA7, 0x9A, 0xEA, 0x96, 0x77, 0x71, 0x9D, 0x97, 0x4E,
+    0x97, 0x4D, 0xA7, 0x77, 0x77, 0x69, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x49, 0xEA, 0x99, 0xAE, 0xA3,
+    0x9D, 0xA5, 0xAC, 0xA2, 0x9D, 0x96, 0xAC, 0x92, 0xDA, 0x7A, 0xA2, 0x9D, 0x75, 0xAC, 0xA7, 0x5D,
+    0x97, 0x5D, 0x97, 0x49, 0xD5, 0x9F, 0xD0, 0x9D, 0x69, 0x9E, 0x2D, 0x97, 0xAC, 0xA2, 0xDA, 0x7D,
+    0xA2, 0xAD, 0x96, 0xD9, 0x3E, 0xA4, 0x9D, 0x49, 0xFF, 0xE6, 0xAF, 0xDA, 0x97, 0x74, 0x72, 0xAC,
+    0x97, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x59, 0x77, 0x77, 0x76, 0xAF, 0xCA, 0xC9, 0x59, 0xDA, 0xAF,
+    0xC5, 0x9D, 0x29, 0xCA, 0x7D, 0x92, 0x9D, 0x7D, 0x39, 0xCA, 0x7D, 0x3D, 0x70, 0xD9, 0x1D, 0x97,
+    0x09, 0xFC, 0x97, 0x29, 0xD9, 0x73, 0x9C, 0xA7, 0x5A, 0xD7, 0x5A, 0xEA, 0x97, 0x0A, 0xDA, 0xAF,
+    0x59, 0xD9, 0x3A, 0xE4, 0xD9, 0x59, 0xD9, 0x3D, 0x96, 0xD9, 0x3E, 0x93, 0x9D, 0xA5, 0xFF, 0xCA,
+    0x79, 0xAE, 0xA9, 0x60, 0x79, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x49, 0xEA, 0x99, 0xAE, 0xA3, 0x9D,
+    0xA5, 0xAC, 0xA2, 0x9D, 0x96, 0xAC, 0x92, 0xDA, 0x7A, 0xA2, 0x9D, 0x75, 0xAC, 0xA7, 0x5D, 0x97,
+    0x5D, 0x97, 0x49, 0xD5, 0x9F, 0xD0, 0x9D, 0x69, 0x9E, 0x2D, 0x97, 0xAC, 0xA2, 0xDA, 0x7D, 0xA2,
+    0xAD, 0x96, 0xD9, 0x3E, 0xA4, 0x9D, 0x49, 0xFF, 0xE6, 0xAF, 0xDA, 0x97, 0x77, 0x2A, 0xA7, 0x6D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0x75, 0xD7, 0x69, 0x72, 0x77, 0x74, 0xAC, 0x75, 0xAC, 0x97, 0x5C, 0xA7,
+    0x5A, 0xC9, 0x75, 0xD9, 0x75, 0xE7, 0x59, 0xA7, 0x77, 0x5A, 0xFC, 0xAC, 0x95, 0x9D, 0xAA, 0xFC,
+    0x59, 0xD2, 0x9C, 0xA7, 0xD9, 0x29, 0xD7, 0xD3, 0x9C, 0xA7, 0xD3, 0xD7, 0x0D, 0x91, 0xD9, 0x70,
+    0x9F, 0xC9, 0x72, 0x9D, 0x97, 0x39, 0xCA, 0x75, 0xAD, 0x75, 0xAE, 0xA9, 0x70, 0xAD, 0xAA, 0xF5,
+    0x9D, 0x93, 0xAE, 0x4D, 0x95, 0x9D, 0x93, 0xD9, 0x6D, 0x93, 0xE9, 0x39, 0xDA, 0x5F, 0xFC, 0xA7,
+    0x9A, 0xEA, 0x96, 0x74, 0x9A, 0x77, 0x2A, 0xE7, 0x70, 0xAF, 0xC7, 0x6A, 0xCA, 0x1D, 0x97, 0x4A,
+    0xCA, 0x3C, 0x97, 0x77, 0x59, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x94, 0xFD, 0x92, 0x9F, 0xD9,
+    0x49, 0xDA, 0x6A, 0xD9, 0x69, 0xD7, 0xAD, 0x7A, 0xD7, 0xDA, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7D,
+    0x70, 0xD9, 0x69, 0xD7, 0x9F, 0xFF, 0xC7, 0xAF, 0xFF, 0xA7, 0xDA, 0x7D, 0x97, 0xD9, 0x69, 0xD7,
+    0x0D, 0x7A, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xD7, 0xD9, 0x7D, 0xA7, 0xD9, 0x59, 0xAE, 0xA4, 0x9E,
+    0xA9, 0x39, 0xFD, 0x92, 0xAF, 0xD3, 0x69, 0x73, 0x9E, 0x71, 0x9F, 0xA7, 0x9D, 0x1D, 0x95, 0x9C,
+    0xA3, 0xC9, 0x77, 0x79, 0x72, 0xAF, 0x71, 0x9A, 0xAD, 0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x74,
+    0xD7, 0x39, 0xCA, 0x19, 0xE9, 0x4A, 0xC9, 0x0A, 0xFA, 0x4D, 0x0A, 0xCA, 0x0A, 0xD4, 0xD9, 0xC9,
+    0x1A, 0xCA, 0x39, 0xE9, 0x2D, 0x93, 0xAE, 0x3D, 0x4A, 0xD3, 0x9D, 0x4D, 0xA3, 0xAC, 0xA4, 0xD4,
+    0xD9, 0x39, 0xD4, 0xD1, 0x91, 0xAC, 0xA4, 0xD0, 0xD1, 0xD9, 0x39, 0xF9, 0x1D, 0x5E, 0x77, 0x10,
+    0x39, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x94, 0xFD, 0x92, 0x9F, 0xD9, 0x49, 0xDA, 0x6A, 0xD9,
+    0x69, 0xD7, 0xAD, 0x5A, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xA3, 0xFF, 0xFF, 0xD5, 0xD9, 0x7D,
+    0x70, 0xD9, 0x69, 0xD7, 0x9F, 0xFF, 0xA7, 0xAF, 0xFF, 0xA7, 0xDA, 0x7D, 0x97, 0xD9, 0x69, 0xD7,
+    0x0D, 0x7A, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xD7, 0xD9, 0x7D, 0xA7, 0xD9, 0x59, 0xAE, 0xA4, 0x9E,
+    0xA9, 0x39, 0xFD, 0x92, 0xAF, 0xD3, 0x49, 0x72, 0xAF, 0x71, 0x9A, 0xAD, 0x73, 0x9D, 0x71, 0xAA,
+    0xEA, 0xA9, 0x59, 0xAA, 0xEA, 0xA9, 0x70, 0xD7, 0x39, 0xCA, 0x2A, 0xAA, 0x5A, 0xC9, 0x09, 0xFA,
+    0x4D, 0x0A, 0xD9, 0xDA, 0x4D, 0x9C, 0xA1, 0xAC, 0xA3, 0x9E, 0xA2, 0xD9, 0x3A, 0xE3, 0xD4, 0xAD,
+    0x39, 0xD4, 0xDA, 0x3A, 0xCA, 0x4D, 0x4D, 0x93, 0x9D, 0x4D, 0x19, 0x1A, 0xCA, 0x4D, 0x0D, 0x1D,
+    0x93, 0x9F, 0x91, 0xD5, 0xE7, 0x71, 0x59, 0x92, 0x95, 0xEA, 0x09, 0xC4, 0x9F, 0xE4, 0xAC, 0x1E,
+    0x97, 0x19, 0x77, 0x39, 0x99, 0x99, 0x99, 0x5F, 0xDA, 0x69, 0xDA, 0x70, 0x9D, 0x71, 0xAD, 0x71,
+    0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x1D, 0x71,
+    0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x79, 0xAE, 0xA5, 0x9F, 0xD9, 0x40, 0x73, 0xAD, 0x90, 0x9C, 0x19,
+    0xFA, 0xD1, 0xAC, 0x1E, 0x92, 0x92, 0x97, 0x77, 0xAE, 0x49, 0xF7, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D,
+    0x95, 0x9D, 0x6A, 0xD6, 0xD9, 0x6D, 0x19, 0x39, 0xD0, 0xD3, 0xAF, 0x49, 0xDA, 0x77, 0x77, 0x09,
+    0xFE, 0x49, 0xFD, 0xA7, 0x77, 0x69, 0x99, 0x99, 0x99, 0x5F, 0xDA, 0x69, 0xDA, 0x70, 0x9D, 0x71,
+    0xAD, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97,
+    0x1D, 0x71, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x79, 0xAE, 0xA5, 0x9F, 0xD9, 0x40, 0x1A, 0xAA, 0xAA,
+    0xAA, 0x19, 0xFE, 0x77, 0x77, 0xAE, 0x49, 0xF7, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6A,
+    0xD6, 0xD9, 0x6D, 0x19, 0x39, 0xD0, 0xD3, 0xAF, 0x49, 0xDA, 0x77, 0x49, 0x73, 0xCA, 0x3C, 0x5D,
+    0xA9, 0xAC, 0xA5, 0xAF, 0xA7, 0x09, 0x97, 0x74, 0x99, 0x99, 0x99, 0x95, 0xFD, 0xA6, 0x9D, 0xA7,
+    0x09, 0xD7, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA,
+    0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x9A, 0xEA, 0x59, 0xFD, 0x94, 0x73,
+    0xC9, 0x3A, 0x19, 0xD9, 0x09, 0xD2, 0xFD, 0x4A, 0xDA, 0x77, 0x7A, 0xE4, 0x9F, 0x7D, 0x69, 0xD6,
+    0xAC, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0x96, 0xD1, 0x93, 0x9D, 0x0D, 0x3A, 0xF4, 0x9D, 0xA7,
+    0x70, 0x39, 0x99, 0x99, 0x99, 0x3F, 0xDA, 0x49, 0xDA, 0x69, 0xD7, 0xAD, 0x7A, 0xCA, 0x7D, 0x97,
+    0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAD, 0x7D, 0xA5, 0x9A, 0xEA, 0x39,
+    0xFD, 0x96, 0xAC, 0x96, 0xAC, 0x70, 0xD7, 0x0D, 0xA9, 0x95, 0xAE, 0x97, 0x50, 0x72, 0xAD, 0x29,
+    0xE2, 0x9D, 0x97, 0x75, 0xAE, 0x19, 0xF4, 0xD3, 0x9D, 0x3A, 0xCA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3,
+    0xD9, 0x3D, 0x19, 0x09, 0xD0, 0xD0, 0xAF, 0x19, 0xE3, 0xAC, 0x4C, 0x93, 0xAC, 0x4D, 0xA9, 0x91,
+    0x9E, 0x97, 0x00, 0x79, 0x70, 0xE6, 0x9E, 0x7D, 0x97, 0x77, 0x29, 0x99, 0x99, 0x99, 0x3F, 0xDA,
+    0x49, 0xDA, 0x69, 0xD7, 0xAD, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9,
+    0x7D, 0x79, 0xD7, 0xAD, 0x7D, 0xA5, 0x9A, 0xEA, 0x39, 0xFD, 0x92, 0x0A, 0xE0, 0x9F, 0x3D, 0x29,
+    0xD2, 0xAC, 0xA2, 0xD9, 0x19, 0xD2, 0xAD, 0x2D, 0x92, 0xD1, 0x99, 0xD0, 0xDA, 0xF0, 0x9D, 0xA7,
+    0x39, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x94, 0xFD, 0xA1, 0xAF, 0xD5, 0x9D, 0xA4, 0x9E, 0x96,
+    0x9D, 0x6D, 0xA7, 0xAD, 0x6D, 0x97, 0xAC, 0xA6, 0xD7, 0x0D, 0x95, 0x9D, 0x70, 0xD9, 0x5A, 0xD7,
+    0x9D, 0x6D, 0xA7, 0xAD, 0x6D, 0x97, 0xDA, 0x59, 0xD7, 0x0D, 0x95, 0x9D, 0x70, 0xD6, 0xAD, 0x79,
+    0xD6, 0xDA, 0x7A, 0xD6, 0xD9, 0x7D, 0xA5, 0x9D, 0x69, 0xAE, 0xA4, 0xAD, 0x59, 0xFD, 0x93, 0xDA,
+    0x77, 0x1D, 0x75, 0x92, 0xAC, 0xA7, 0x4A, 0xCA, 0x9E, 0x75, 0xAF, 0xC7, 0x7A, 0xAA, 0x97, 0x10,
+    0x77, 0x2A, 0xD4, 0xAC, 0xA2, 0x9E, 0x39, 0xE2, 0x9D, 0x93, 0x9D, 0x97, 0x77, 0x77, 0x5A, 0xE3,
+    0xAE, 0x19, 0xF2, 0x9F, 0x4D, 0x5D, 0x39, 0xD4, 0x9D, 0x3A, 0xCA, 0x4A, 0xCA, 0x3D, 0x94, 0xAC,
+    0x92, 0x9D, 0x5D, 0x92, 0xAD, 0x5D, 0x3D, 0x94, 0x9D, 0x3D, 0x19, 0x2A, 0xCA, 0x29, 0xD0, 0xD2,
+    0xD9, 0x2A, 0xF3, 0xD3, 0x9D, 0xA3, 0xAD, 0x73, 0xD9, 0x73, 0xD7, 0x3A, 0xCA, 0x7C, 0xA9, 0xAD,
+    0x70, 0xFC, 0x71, 0xAD, 0xA7, 0x73, 0xAA, 0x75, 0xF7, 0x3D, 0xAD, 0xA7, 0x1D, 0xA1, 0xD7, 0x0A,
+    0xC9, 0x3C, 0x77, 0x71, 0x99, 0x99, 0x99, 0x97, 0x1F, 0xDA, 0x72, 0x9D, 0xA7, 0x5D, 0x97, 0x49,
+    0xD7, 0x5A, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75,
+    0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D, 0x75, 0x9D, 0x75, 0xD9, 0x70, 0xDA,
+    0xAD, 0xA7, 0x1F, 0xCA, 0x73, 0xAA, 0xA9, 0x72, 0x77, 0x70, 0xAD, 0x72, 0x9E, 0x97, 0x1D, 0x9D,
+    0x70, 0xD1, 0xD9, 0x6D, 0x3C, 0x97, 0x77, 0x74, 0xAE, 0x71, 0xAF, 0x73, 0x9D, 0x73, 0x9D, 0x73,
+    0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73,
+    0xAC, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3D, 0x97, 0xCA, 0x9A, 0xD7, 0x9F, 0xC7, 0x1A, 0xD9, 0x71,
+    0x39, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x4F, 0xD9, 0x1F, 0xD5, 0x9D, 0xA4, 0xE9, 0x69, 0xD4,
+    0xDA, 0x70, 0xAD, 0x29, 0xD9, 0x71, 0xAC, 0xA1, 0x9D, 0x97, 0x2D, 0x90, 0xAD, 0x74, 0xD9, 0xAD,
+    0x74, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xDA, 0x9D, 0x97, 0x4D, 0x90, 0xAD, 0x74, 0xD2, 0xE7, 0x29,
+    0xD2, 0x9D, 0xA7, 0x1A, 0xD3, 0xAD, 0xA7, 0x0D, 0xA4, 0xEA, 0x59, 0xAE, 0xA9, 0x3F, 0x39, 0xFD,
+    0xA4, 0xF7, 0x77, 0x6A, 0xA7, 0x70, 0x9D, 0x97, 0x70, 0xD9, 0x77, 0x9C, 0xA7, 0x70, 0xD7, 0x70,
+    0x99, 0x73, 0x49, 0x7F, 0x95, 0x9A, 0xAD, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97,
+    0x0D, 0x1A, 0xDA, 0x3D, 0x9D, 0xAD, 0x91, 0x9E, 0x91, 0xAC, 0x91, 0xAD, 0x92, 0xD9, 0x1D, 0xA2,
+    0xAC, 0xA2, 0xD1, 0x9E, 0x29, 0xDA, 0xE9, 0x3A, 0xFA, 0x5D, 0x99, 0xD5, 0xD1, 0xDA, 0x39, 0xD1,
+    0x9D, 0xA2, 0x9C, 0xA2, 0xAE, 0xA9, 0xAC, 0x93, 0x9E, 0x97, 0x7A, 0xA7, 0x1D, 0x97, 0x0D, 0x97,
+    0x0D, 0x70, 0xD7, 0x19, 0x70, 0x73, 0x9A, 0xDA, 0x29, 0xDA, 0xAF, 0x19, 0xF1, 0x9C, 0xA0, 0x9D,
+    0x99, 0x91, 0xAC, 0x99, 0xCA, 0x5D, 0x9C, 0xA6, 0xF7, 0xF6, 0x9D, 0xAC, 0x95, 0xAC, 0xA9, 0xD5,
+    0xD1, 0xD9, 0x29, 0x0D, 0x19, 0xD9, 0x0C, 0xA9, 0xD2, 0xFC, 0x0A, 0xC9, 0x3E, 0x97, 0x40, 0x71,
+    0x9A, 0x73, 0xAD, 0x71, 0x9E, 0xA7, 0x0A, 0xE9, 0x71, 0xA9, 0x77, 0x71, 0x99, 0x99, 0x99, 0x97,
+    0xFD, 0xA7, 0x09, 0xDA, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x97, 0x29,
+    0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x6C, 0x92, 0xAD, 0x5A, 0xC3, 0xDA,
+    0x49, 0xD1, 0x9A, 0xFF, 0xD9, 0x09, 0xFF, 0xF1, 0x76, 0x9C, 0x93, 0x9E, 0x91, 0x9F, 0xA2, 0xCA,
+    0xA9, 0x77, 0x99, 0x39, 0xF3, 0x9A, 0xAD, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC,
+    0xA5, 0xAC, 0x95, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD1, 0x92, 0xAC, 0xA9,
+    0xCA, 0x2F, 0xC3, 0xAD, 0xA7, 0x50, 0x39, 0x99, 0x99, 0x99, 0x7F, 0xDA, 0x70, 0x9D, 0xA7, 0x29,
+    0xD7, 0x3A, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73,
+    0xD9, 0x73, 0xD7, 0x39, 0xD6, 0xC9, 0x2A, 0xD5, 0xAC, 0x3D, 0xA4, 0x9D, 0x19, 0xAF, 0xFD, 0x90,
+    0x9F, 0xFF, 0x77, 0x6A, 0xA7, 0x4D, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0xD7, 0x49, 0x70, 0x59, 0x93,
+    0x9F, 0x39, 0xAA, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5A, 0xC9, 0x5D,
+    0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x19, 0x2A, 0xCA, 0x9C, 0xA2, 0xFC, 0x3A,
+    0xDA, 0x75, 0x9A, 0x6D, 0xA5, 0xD9, 0x5D, 0x5D, 0x69, 0x60, 0x77, 0x74, 0xD4, 0x99, 0x99, 0x99,
+    0x91, 0xD4, 0xFD, 0xA0, 0x9C, 0xA5, 0x9D, 0xA2, 0xAC, 0x69, 0xD3, 0xCA, 0x6A, 0xD3, 0x97, 0xAC,
+    0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x4D, 0x74, 0x9D,
+    0x6C, 0x93, 0xAD, 0x5A, 0xC4, 0xDA, 0x49, 0xD2, 0x9A, 0xFF, 0xD9, 0x19, 0xFF, 0xF2, 0x70, 0x97,
+    0x09, 0xCA, 0x39, 0x91, 0xAC, 0x90, 0x9F, 0x1D, 0x19, 0xAA, 0xD1, 0xCA, 0x39, 0xD0, 0x9C, 0x4A,
+    0xCA, 0x19, 0x4D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xC9, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7D, 0x97, 0xD7, 0x9D, 0x19, 0x4A, 0xCA, 0x9C, 0xA4, 0xFC, 0x5A, 0xDA, 0x77, 0x10, 0x39, 0x99,
+    0x99, 0x99, 0x70, 0xFD, 0xA7, 0x19, 0xDA, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xAC, 0xA7, 0x4D, 0x93,
+    0x9A, 0xA5, 0xD9, 0x3E, 0x49, 0xD3, 0x9E, 0x4A, 0xD4, 0xA9, 0x5D, 0xA7, 0x4D, 0x97, 0x4D, 0x74,
+    0x9D, 0x6C, 0x93, 0xAD, 0x5A, 0xC4, 0xDA, 0x49, 0xD2, 0x9A, 0xFF, 0xD9, 0x19, 0xFF, 0xF2, 0x39,
+    0x94, 0x9F, 0x49, 0xAA, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6A, 0xC9,
+    0x19, 0xC9, 0x1D, 0x90, 0x9E, 0x1D, 0x19, 0xD9, 0x09, 0xD2, 0x92, 0xAC, 0xA6, 0xD9, 0x6D, 0x69,
+    0xD1, 0x93, 0xAC, 0xA9, 0xCA, 0x3F, 0xC4, 0xAD, 0xA7, 0x70, 0x39, 0x99, 0x99, 0x99, 0x7F, 0xDA,
+    0x70, 0x9D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xDA, 0xDA, 0x79, 0xF9,
+    0x79, 0xE9, 0x79, 0xFA, 0x70, 0xAA, 0x0D, 0x97, 0x3D, 0x73, 0x9D, 0x6C, 0x92, 0xAD, 0x5A, 0xC3,
+    0xDA, 0x49, 0xD1, 0x9A, 0xFF, 0xD9, 0x09, 0xFF, 0xF1, 0x59, 0x94, 0x9F, 0x49, 0xAA, 0xD6, 0x9D,
+    0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xDA, 0xC4, 0xAE, 0x93, 0x9D, 0xA4, 0xAE, 0x4D, 0xAD,
+    0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x19, 0x3A, 0xCA, 0x9C, 0xA3, 0xFC, 0x4A, 0xDA, 0x75, 0x76,
+    0xA7, 0x71, 0x9D, 0x97, 0x7F, 0x76, 0x9E, 0xA7, 0x79, 0xA7, 0x77, 0x71, 0x99, 0x99, 0x69, 0x99,
+    0x99, 0x93, 0xF9, 0x49, 0xFC, 0xA4, 0xAD, 0xA6, 0xAC, 0xA6, 0x9E, 0x6A, 0xC9, 0x6A, 0xEA, 0x5D,
+    0x7D, 0xAD, 0x5D, 0x7D, 0x0D, 0xA3, 0x9C, 0xA7, 0xD0, 0xAD, 0x3A, 0xC9, 0x69, 0xCA, 0x1D, 0x92,
+    0xD9, 0x6A, 0xC9, 0x1A, 0xD2, 0xD7, 0xD3, 0xD9, 0x1D, 0x7D, 0x3D, 0xA0, 0x9C, 0xA6, 0x9D, 0x39,
+    0xD0, 0xAC, 0x96, 0x9C, 0xA4, 0xDA, 0xD7, 0xAC, 0x94, 0x9F, 0x7D, 0x6F, 0x6A, 0xDA, 0x94, 0x9D,
+    0xA4, 0x9F, 0xD5, 0xD9, 0x77, 0x71, 0x77, 0x6A, 0xC9, 0x71, 0x9D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x2C, 0x97, 0x77, 0x70, 0x9A, 0xDA, 0x2A, 0xDA, 0x1A, 0xF1, 0xFC, 0x39, 0xCA, 0x0D, 0x90, 0xD9,
+    0x2A, 0xCA, 0xD2, 0xD3, 0xF2, 0x9D, 0x3E, 0x92, 0xAC, 0xA3, 0xDA, 0x3D, 0x92, 0x9D, 0x4D, 0x3A,
+    0xCA, 0x39, 0xD3, 0xD9, 0x3A, 0xCA, 0x09, 0x1D, 0x4D, 0x99, 0xC9, 0x9D, 0x4F, 0xA0, 0xAC, 0xA4,
+    0xEA, 0x77, 0x39, 0x99, 0x96, 0x99, 0x99, 0x99, 0x3F, 0x94, 0x9F, 0xCA, 0x4A, 0xDA, 0x6A, 0xCA,
+    0x69, 0xE6, 0xAC, 0x96, 0xAE, 0xA5, 0xD7, 0xDA, 0xD5, 0xD7, 0xD0, 0xDA, 0x39, 0xCA, 0x7D, 0x0A,
+    0xD3, 0xAC, 0x96, 0x9C, 0xA1, 0xD9, 0x2D, 0x96, 0xAC, 0x91, 0xAD, 0x2D, 0x7D, 0x3D, 0x91, 0xD7,
+    0xD3, 0xDA, 0x09, 0xCA, 0x69, 0xD3, 0x9D, 0x0A, 0xC9, 0x69, 0xCA, 0x4D, 0xAD, 0x7A, 0xC9, 0x49,
+    0xF7, 0xD6, 0xF6, 0xAD, 0xA9, 0x49, 0xDA, 0x49, 0xFD, 0x5D, 0x97, 0x77, 0x71, 0xAA, 0x77, 0x2D,
+    0x97, 0x71, 0xD9, 0x77, 0x09, 0xD7, 0x71, 0xD7, 0x72, 0x97, 0x40, 0x75, 0x9A, 0xDA, 0x2A, 0xDA,
+    0x1A, 0xF1, 0xFC, 0x39, 0xCA, 0x0D, 0x90, 0xD9, 0x2A, 0xCA, 0xD2, 0xD3, 0xF2, 0x9D, 0x3E, 0x92,
+    0xAC, 0xA3, 0xDA, 0x3D, 0x92, 0x9D, 0x4D, 0x3A, 0xCA, 0x39, 0xD3, 0xD9, 0x3A, 0xCA, 0x09, 0x1D,
+    0x4D, 0x99, 0xC9, 0x9D, 0x4F, 0xA0, 0xAC, 0xA4, 0xEA, 0x77, 0x39, 0xA9, 0x72, 0xAD, 0x72, 0x9D,
+    0x72, 0xD9, 0x71, 0xAC, 0x97, 0x29, 0x71, 0x77, 0x75, 0xC9, 0x3D, 0x74, 0xD2, 0xD9, 0x74, 0xAD,
+    0x9D, 0x97, 0x6F, 0x97, 0x70, 0xD9, 0x77, 0x77, 0x99, 0x99, 0x69, 0x99, 0x99, 0x93, 0xF9, 0x49,
+    0xFC, 0xA4, 0xAD, 0xA6, 0xAC, 0xA6, 0x9E, 0x6A, 0xC9, 0x6A, 0xEA, 0x5D, 0x7D, 0xAD, 0x5D, 0x7D,
+    0x0D, 0xA3, 0x9C, 0xA7, 0xD0, 0xAD, 0x3A, 0xC9, 0x69, 0xCA, 0x1D, 0x92, 0xD9, 0x6A, 0xC9, 0x1A,
+    0xD2, 0xD7, 0xD3, 0xD9, 0x1D, 0x7D, 0x3D, 0xA0, 0x9C, 0xA6, 0x9D, 0x39, 0xD0, 0xAC, 0x96, 0x9C,
+    0xA4, 0xDA, 0xD7, 0xAC, 0x94, 0x9F, 0x7D, 0x6F, 0x6A, 0xDA, 0x94, 0x9D, 0xA4, 0x9F, 0xD5, 0xD9,
+    0x77, 0x71, 0x77, 0x2C, 0x92, 0xAC, 0x95, 0xD1, 0xAC, 0x96, 0xAC, 0xAA, 0xCA, 0x70, 0xEA, 0x71,
+    0x9D, 0x77, 0x77, 0x09, 0xAD, 0xA2, 0xAD, 0xA1, 0xAF, 0x1F, 0xC3, 0x9C, 0xA0, 0xD9, 0x0D, 0x92,
+    0xAC, 0xAD, 0x2D, 0x3F, 0x29, 0xD3, 0xE9, 0x2A, 0xCA, 0x3D, 0xA3, 0xD9, 0x29, 0xD4, 0xD3, 0xAC,
+    0xA3, 0x9D, 0x3D, 0x93, 0xAC, 0xA0, 0x91, 0xD4, 0xD9, 0x9C, 0x99, 0xD4, 0xFA, 0x0A, 0xCA, 0x4E,
+    0xA7, 0x70, 0x29, 0x97, 0x7A, 0xD9, 0x76, 0x9D, 0x97, 0x69, 0xD7, 0x7A, 0xCA, 0x77, 0xD7, 0x7A,
+    0xC9, 0x1A, 0xE2, 0x9E, 0x2C, 0x91, 0x9F, 0x1F, 0xC9, 0x70, 0xD0, 0xD9, 0x0D, 0xA7, 0x9C, 0xAA,
+    0xC2, 0xD9, 0x7A, 0xE3, 0xD7, 0x0E, 0xA2, 0x9D, 0x70, 0xE3, 0xAC, 0xA7, 0x0D, 0x93, 0xD9, 0x79,
+    0xD4, 0xD7, 0x0A, 0xCA, 0x39, 0xD1, 0x95, 0xD9, 0x3A, 0xCA, 0x9C, 0xA5, 0xD4, 0xAF, 0x59, 0xD4,
+    0xAD, 0xA7, 0x74, 0x39, 0x99, 0x96, 0x99, 0x99, 0x99, 0x3F, 0x94, 0x9F, 0xCA, 0x4A, 0xDA, 0x6A,
+    0xCA, 0x69, 0xE6, 0xAC, 0x96, 0xAE, 0xA5, 0xD7, 0xDA, 0xD5, 0xD7, 0xD0, 0xDA, 0x39, 0xCA, 0x7D,
+    0x0A, 0xD3, 0xAC, 0x96, 0x9C, 0xA1, 0xD9, 0x2D, 0x96, 0xAC, 0x91, 0xAD, 0x2D, 0x7D, 0x3D, 0x91,
+    0xD7, 0xD3, 0xAC, 0xA0, 0x9C, 0xA6, 0x9D, 0x4D, 0x0A, 0xC9, 0x69, 0xCA, 0x4D, 0xAD, 0x7A, 0xC9,
+    0x49, 0xF7, 0xD6, 0xF6, 0xAD, 0xA9, 0x49, 0xD9, 0x49, 0xFD, 0x5D, 0x77, 0x2D, 0x77, 0x1A, 0xC9,
+    0x75, 0xD9, 0xAC, 0xA7, 0x59, 0xFA, 0x77, 0x9A, 0xA9, 0x70, 0x74, 0x9A, 0xDA, 0x2A, 0xDA, 0x0A,
+    0xF1, 0xFC, 0x29, 0xCA, 0x0D, 0x90, 0xD9, 0x1A, 0xCA, 0xD2, 0xD2, 0xF2, 0x9D, 0x2E, 0x92, 0xAC,
+    0xA2, 0xDA, 0x3D, 0x91, 0x9D, 0x4D, 0x2A, 0xCA, 0x39, 0xD2, 0xD9, 0x3A, 0xCA, 0x2D, 0x4D, 0x91,
+    0x9D, 0x4D, 0x2A, 0xCA, 0x39, 0xD7, 0x1A, 0xCA, 0x71, 0xD7, 0x1A, 0xCA, 0x5D, 0x9A, 0xD6, 0xFC,
+    0x79, 0xDA, 0x60, 0x77, 0x69, 0xFE, 0x70, 0x9F, 0xDA, 0x77, 0x77, 0x74, 0x9A, 0xA9, 0x71, 0x9F,
+    0xEA, 0x6E, 0xA9, 0x99, 0xAE, 0x4E, 0x59, 0xDA, 0x2E, 0x7E, 0x19, 0xD7, 0x09, 0xD9, 0x0D, 0xA7,
+    0x1D, 0x99, 0xD7, 0x2D, 0x9A, 0xD7, 0x2D, 0x9D, 0xA7, 0x19, 0xD0, 0xDA, 0x71, 0xAD, 0x0D, 0xA7,
+    0x1D, 0xA0, 0xDA, 0x70, 0x9D, 0x1E, 0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5, 0xFA,
+    0xAF, 0x7A, 0xFC, 0xA9, 0x77, 0x60, 0x4A, 0xAA, 0xAA, 0xAA, 0x49, 0xFE, 0x77, 0x77, 0x73, 0x9A,
+    0xEA, 0x5A, 0xFD, 0xA3, 0xE2, 0x9D, 0x2A, 0xD4, 0xD9, 0x1D, 0x94, 0xDA, 0x09, 0xD5, 0xD9, 0x0A,
+    0xCA, 0x5D, 0x90, 0xD9, 0x5D, 0x1D, 0x94, 0xAC, 0xA1, 0xDA, 0x4D, 0x2A, 0xD3, 0xDA, 0x29, 0xEA,
+    0xAD, 0xA4, 0x9F, 0xC9, 0x77, 0x10, 0x69, 0x77, 0xCA, 0x3C, 0x71, 0xDA, 0x9A, 0xCA, 0x71, 0xAF,
+    0xA7, 0x49, 0x97, 0x77, 0x69, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D,
+    0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9,
+    0xDA, 0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D,
+    0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76, 0x77, 0x1C,
+    0x93, 0xA5, 0xD9, 0x09, 0xD5, 0xFD, 0x7A, 0xDA, 0x77, 0x77, 0x09, 0xAE, 0xA5, 0xAF, 0xDA, 0x3E,
+    0x29, 0xD2, 0xAD, 0x4D, 0x91, 0xD9, 0x4D, 0xA0, 0x9D, 0x5D, 0x90, 0xAC, 0xA5, 0xD9, 0x0D, 0x95,
+    0xD1, 0xD9, 0x4A, 0xCA, 0x1D, 0xA4, 0xD2, 0xAD, 0x3D, 0xA2, 0x9E, 0xAA, 0xDA, 0x49, 0xFC, 0x97,
+    0x71, 0x77, 0x73, 0xC9, 0x29, 0xC7, 0x09, 0xE1, 0xAD, 0xA6, 0xAE, 0x1F, 0x6E, 0x91, 0xE9, 0x7C,
+    0x93, 0xC9, 0x77, 0x75, 0x9A, 0xA9, 0x72, 0x9F, 0xEA, 0x7E, 0xA9, 0x99, 0xAE, 0x5E, 0x59, 0xDA,
+    0x3E, 0x7E, 0x29, 0xD7, 0x09, 0xD9, 0x1D, 0xA7, 0x1D, 0x90, 0x9D, 0x72, 0xD9, 0x0A, 0xD7, 0x2D,
+    0x90, 0xDA, 0x71, 0x9D, 0x1D, 0xA7, 0x1A, 0xD1, 0xDA, 0x71, 0xDA, 0x1D, 0xA7, 0x09, 0xD2, 0xE7,
+    0x0D, 0xA2, 0x9D, 0x96, 0xAD, 0x4E, 0x93, 0x9E, 0x6F, 0xAA, 0xF7, 0x0A, 0xFC, 0xA9, 0x77, 0x70,
+    0x77, 0x4C, 0x91, 0xAC, 0x6E, 0x09, 0xD9, 0x4A, 0xD1, 0xDA, 0x5D, 0x90, 0xAC, 0xA5, 0xAC, 0x2C,
+    0xA7, 0x77, 0x72, 0x9A, 0xEA, 0x6A, 0xFD, 0xA4, 0xE2, 0x9D, 0x3A, 0xD4, 0xD9, 0x2D, 0x94, 0xDA,
+    0x19, 0xD5, 0xD9, 0x1A, 0xCA, 0x5D, 0x91, 0xD9, 0x5D, 0x2D, 0x94, 0xAC, 0xA2, 0xDA, 0x4D, 0x3A,
+    0xD3, 0xDA, 0x39, 0xEA, 0xAD, 0xA5, 0x9F, 0xC9, 0x77, 0x30, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x5A, 0xFF, 0xFE, 0xA3, 0xAE, 0xAA, 0x99, 0xAD, 0xAA, 0xAA, 0xAD, 0xA2, 0xAD, 0xA4,
+    0x9D, 0x49, 0xC9, 0x1A, 0xD9, 0x5A, 0xCA, 0x49, 0xC1, 0x9D, 0x96, 0xD9, 0x70, 0xDA, 0x7D, 0x97,
+    0x9D, 0x79, 0xD7, 0x0A, 0xD7, 0xAD, 0xAA, 0xAA, 0xA9, 0x2D, 0xA7, 0xAF, 0xE9, 0x2D, 0xA7, 0xDA,
+    0x70, 0xDA, 0x7D, 0x97, 0x0D, 0xA6, 0x9D, 0x71, 0xE6, 0xAD, 0x59, 0xA1, 0x9D, 0x95, 0xDA, 0x5C,
+    0xA2, 0xE9, 0x4D, 0x94, 0xAC, 0x93, 0xFA, 0xAA, 0xFF, 0xE5, 0xAF, 0xFF, 0xEA, 0x77, 0x71, 0x77,
+    0x69, 0xAE, 0x92, 0x9E, 0xA3, 0xAF, 0xDA, 0x0D, 0xAA, 0xD9, 0x1E, 0x29, 0xF2, 0xAC, 0xA0, 0xAD,
+    0x4E, 0x3D, 0x90, 0xD9, 0x4D, 0xA2, 0xAD, 0x09, 0xD5, 0xD9, 0x1A, 0xD1, 0xAC, 0xA5, 0xDA, 0xEA,
+    0x2D, 0x95, 0xFA, 0x4D, 0x94, 0xAD, 0x7D, 0xA4, 0xE5, 0x90, 0xAD, 0x3F, 0x92, 0xAC, 0xA0, 0x9E,
+    0xAA, 0xDA, 0xFF, 0x29, 0xFC, 0x91, 0xFC, 0x97, 0x75, 0x73, 0x99, 0x75, 0xAD, 0x73, 0x9E, 0xA7,
+    0x2F, 0x97, 0x3A, 0x97, 0x77, 0x59, 0x9A, 0xAA, 0x97, 0x9F, 0xFC, 0xA5, 0x9A, 0x9D, 0x90, 0x9A,
+    0xD9, 0x69, 0xD3, 0xE6, 0xAD, 0x39, 0xD6, 0xAC, 0xA3, 0x9D, 0x6D, 0x93, 0xDA, 0x6D, 0x3A, 0xD6,
+    0x9D, 0x19, 0xE9, 0x6A, 0xFD, 0xA7, 0x0E, 0xAD, 0x97, 0x1D, 0x90, 0xAD, 0x71, 0xD2, 0xD9, 0x79,
+    0xD2, 0xAD, 0x7A, 0xCA, 0x3D, 0xA6, 0xDA, 0x39, 0xDA, 0x39, 0xAE, 0xA9, 0x2A, 0xE1, 0x9F, 0xDA,
+    0x39, 0xE7, 0x71, 0x77, 0x2D, 0x7A, 0xD6, 0x9D, 0x7D, 0x79, 0xC7, 0x77, 0x2A, 0xDA, 0x1A, 0xD0,
+    0xAF, 0x0A, 0xE2, 0x9C, 0xA9, 0xDA, 0xA2, 0x9C, 0xAC, 0xA5, 0xAC, 0xAC, 0x6E, 0x96, 0xDA, 0x69,
+    0xD9, 0x6A, 0xD7, 0xD9, 0x7D, 0x70, 0xD7, 0x9C, 0xA7, 0x59, 0x9A, 0xAA, 0x97, 0x9F, 0xFC, 0xA5,
+    0x9A, 0x9D, 0x90, 0x9A, 0xD9, 0x69, 0xD3, 0xE6, 0xAD, 0x39, 0xD6, 0xAC, 0xA3, 0x9D, 0x6D, 0x93,
+    0xDA, 0x6D, 0x3A, 0xD6, 0x9D, 0x19, 0xE9, 0x6A, 0xFD, 0xA7, 0x0E, 0xAD, 0x97, 0x1D, 0x90, 0xAD,
+    0x71, 0xD2, 0xD9, 0x79, 0xD2, 0xAD, 0x7A, 0xCA, 0x3D, 0xA6, 0xDA, 0x39, 0xDA, 0x39, 0xAE, 0xA9,
+    0x2A, 0xE1, 0x9F, 0xDA, 0x39, 0xE7, 0x77, 0x0A, 0xA7, 0x6D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0xD7,
+    0x69, 0x71, 0x77, 0xAD, 0xA1, 0xAD, 0x2A, 0xF0, 0xAE, 0x49, 0xCA, 0x9D, 0xAA, 0x49, 0xCA, 0xCA,
+    0x7A, 0xCA, 0xC7, 0x0E, 0x97, 0x0D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xD9, 0x71, 0xD7, 0x2D,
+    0x71, 0x9C, 0xA7, 0x76, 0xAA, 0x72, 0xD9, 0x71, 0xD9, 0x71, 0xD7, 0x1D, 0x72, 0x97, 0x20, 0x77,
+    0x6A, 0xC3, 0x9C, 0xA7, 0xAD, 0x19, 0xD7, 0x1D, 0xAA, 0xD7, 0x29, 0xF7, 0x49, 0xCA, 0x77, 0x74,
+    0x99, 0xAA, 0xA9, 0x79, 0xFF, 0xCA, 0x59, 0xA9, 0xD9, 0x09, 0xAD, 0x96, 0x9D, 0x3E, 0x6A, 0xD3,
+    0x9D, 0x6A, 0xCA, 0x39, 0xD6, 0xD9, 0x3D, 0xA6, 0xD3, 0xAD, 0x69, 0xD1, 0x9E, 0x96, 0xAF, 0xDA,
+    0x70, 0xEA, 0xD9, 0x71, 0xD9, 0x0A, 0xD7, 0x1D, 0x2D, 0x97, 0x9D, 0x2A, 0xD7, 0xAC, 0xA3, 0xDA,
+    0x6D, 0xA3, 0x9D, 0xA3, 0x9A, 0xEA, 0x92, 0xAE, 0x19, 0xFD, 0xA3, 0x9E, 0x77, 0x10, 0x76, 0x9C,
+    0x3D, 0x39, 0xCA, 0x1D, 0x5D, 0x9D, 0x95, 0x9E, 0x97, 0xAC, 0xA7, 0x77, 0x4A, 0xDA, 0x1A, 0xD1,
+    0xAF, 0x0A, 0xE3, 0x9C, 0xA9, 0xDA, 0xA3, 0x9C, 0xAC, 0xA6, 0xAC, 0xAC, 0x7E, 0x97, 0xDA, 0x79,
+    0xD9, 0x7A, 0xD7, 0x0D, 0x97, 0x0D, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0x72, 0xA7, 0x19, 0xD9, 0x7A,
+    0xE7, 0xEA, 0x79, 0xA9, 0x77, 0x69, 0xAA, 0x99, 0x5A, 0xFE, 0x92, 0xAD, 0x90, 0x99, 0xD9, 0x19,
+    0xD4, 0xAC, 0x91, 0xAD, 0x4A, 0xC2, 0xAD, 0x49, 0x92, 0xAD, 0x97, 0x1E, 0xA7, 0x09, 0xF9, 0x70,
+    0xFA, 0x70, 0x9E, 0xA7, 0x1E, 0x2A, 0x59, 0xD9, 0x09, 0xC9, 0x5D, 0x90, 0xAC, 0x94, 0x9D, 0x1A,
+    0xD4, 0xDA, 0x1A, 0xEA, 0xAA, 0xE3, 0x9F, 0xD9, 0x77, 0x00, 0x77, 0x29, 0xC9, 0x7D, 0x96, 0xDA,
+    0x6A, 0xCA, 0x7C, 0x97, 0x77, 0x49, 0xAE, 0x93, 0xAF, 0xCA, 0x29, 0xCA, 0x2A, 0x92, 0xD9, 0x7A,
+    0xD7, 0x0E, 0x96, 0x9E, 0xA7, 0xE9, 0x7E, 0x2A, 0x39, 0xD1, 0xAC, 0xA2, 0xAC, 0x91, 0xAE, 0xAA,
+    0xCA, 0x3A, 0xF9, 0x76, 0x79, 0xA7, 0x19, 0xE7, 0x9D, 0xAD, 0x5A, 0xD1, 0xAC, 0xA3, 0x9C, 0xA3,
+    0xA9, 0x77, 0x29, 0xAA, 0x99, 0x5A, 0xFE, 0x92, 0xAD, 0x90, 0x99, 0xD9, 0x19, 0xD4, 0xAC, 0x91,
+    0xAD, 0x4A, 0xC2, 0xAD, 0x49, 0x92, 0xAD, 0x97, 0x1E, 0xA7, 0x09, 0xF9, 0x70, 0xFA, 0x70, 0x9E,
+    0xA7, 0x1E, 0x2A, 0x59, 0xD9, 0x09, 0xC9, 0x5D, 0x90, 0xAC, 0x94, 0x9D, 0x1A, 0xD4, 0xDA, 0x1A,
+    0xEA, 0xAA, 0xE3, 0x9F, 0xD9, 0x77, 0x00, 0x77, 0x09, 0xD7, 0xEA, 0x5D, 0x9D, 0x4D, 0x90, 0x9C,
+    0xA2, 0xAC, 0x92, 0xCA, 0x77, 0x71, 0x9A, 0xE9, 0x3A, 0xFC, 0xA2, 0x9C, 0xA2, 0xA9, 0x2D, 0x97,
+    0xAD, 0x70, 0xE9, 0x69, 0xEA, 0x7E, 0x97, 0xE2, 0xA3, 0x9D, 0x1A, 0xCA, 0x2A, 0xC9, 0x1A, 0xEA,
+    0xAC, 0xA3, 0xAF, 0x97, 0x60, 0x59, 0xAA, 0x99, 0x5A, 0xFE, 0x92, 0xAD, 0x90, 0x99, 0xD9, 0x19,
+    0xD4, 0xAC, 0x91, 0xAD, 0x4A, 0xC2, 0xAD, 0x49, 0x92, 0xAD, 0x97, 0x1E, 0xA7, 0x09, 0xF9, 0x70,
+    0xFA, 0x70, 0x9E, 0xA7, 0x1E, 0x2A, 0x59, 0xD9, 0x09, 0xC9, 0x5D, 0x90, 0xAC, 0x94, 0x9D, 0x1A,
+    0xD4, 0xDA, 0x1A, 0xEA, 0xAA, 0xE3, 0x9F, 0xD9, 0x77, 0x4A, 0xA9, 0x70, 0x9E, 0x72, 0xD7, 0x19,
+    0xCA, 0x70, 0xAC, 0xA7, 0x19, 0x70, 0x75, 0x9A, 0xE9, 0x2A, 0xFC, 0xA1, 0x9C, 0xA2, 0xA9, 0x1D,
+    0x96, 0xAD, 0x7E, 0x95, 0x9E, 0xA6, 0xE9, 0x6E, 0x1A, 0x39, 0xD0, 0xAC, 0xA2, 0xAC, 0x90, 0xAE,
+    0xAA, 0xCA, 0x2A, 0xF9, 0x77, 0xAA, 0x6A, 0xE7, 0xCA, 0x6D, 0x59, 0xD9, 0x59, 0x96, 0x77, 0x2C,
+    0xA3, 0xAC, 0x94, 0xD9, 0x1D, 0xA5, 0x9D, 0x9D, 0x97, 0xAE, 0x97, 0x1D, 0x97, 0x77, 0x9A, 0xA9,
+    0x96, 0xAF, 0xE9, 0x3A, 0xD9, 0x09, 0x9D, 0x92, 0x9D, 0x4A, 0xC9, 0x2A, 0xD4, 0xAC, 0x3A, 0xD4,
+    0x99, 0x3A, 0xD9, 0x72, 0xEA, 0x71, 0x9F, 0x97, 0x1F, 0xA7, 0x19, 0xEA, 0x72, 0xE3, 0xA5, 0x9D,
+    0x91, 0x9C, 0x95, 0xD9, 0x1A, 0xC9, 0x49, 0xD2, 0xAD, 0x4D, 0xA2, 0xAE, 0xAA, 0xAE, 0x49, 0xFD,
+    0x97, 0x72, 0x77, 0xCA, 0x2A, 0xC9, 0x3D, 0x1A, 0xCA, 0x49, 0xCA, 0x9C, 0xA6, 0xF7, 0x9D, 0x77,
+    0x77, 0x9A, 0xE9, 0x4A, 0xFC, 0xA3, 0x9C, 0xA2, 0xA9, 0x3D, 0x97, 0x0A, 0xD7, 0x1E, 0x97, 0x9E,
+    0xA7, 0x0E, 0x97, 0x0E, 0x3A, 0x39, 0xD2, 0xAC, 0xA2, 0xAC, 0x92, 0xAE, 0xAA, 0xCA, 0x4A, 0xF9,
+    0x77, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFC, 0xAA, 0xCA, 0xAA, 0xAE,
+    0xAA, 0xAD, 0x9D, 0x3D, 0x92, 0xAC, 0x0D, 0x29, 0xD3, 0xAC, 0x0A, 0x92, 0xAD, 0x3A, 0x95, 0xAC,
+    0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7,
+    0x3A, 0xD7, 0x19, 0xAE, 0xA9, 0x69, 0xFE, 0x77, 0x79, 0xAA, 0x73, 0xEA, 0x73, 0xAC, 0x97, 0x3D,
+    0x72, 0xAD, 0x73, 0x99, 0x73, 0x76, 0xCA, 0x6A, 0xC9, 0x6D, 0x5A, 0xAF, 0xCA, 0x0F, 0xF9, 0x2A,
+    0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D, 0x96, 0xD2, 0x9A, 0x2D, 0x1A, 0xCA,
+    0x2F, 0xD3, 0xAE, 0x97, 0x69, 0xAA, 0x6A, 0xD9, 0x6A, 0xC9, 0x59, 0xD5, 0xAD, 0x69, 0x96, 0x77,
+    0x3C, 0x93, 0xAC, 0x6D, 0x2D, 0x96, 0xAD, 0x9D, 0x97, 0x0F, 0x97, 0x2D, 0x97, 0x74, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xCA, 0xAC, 0xAA, 0xAA, 0xEA, 0xAA, 0xD9, 0xD3, 0xD9,
+    0x2A, 0xC0, 0xD2, 0x9D, 0x3A, 0xC0, 0xA9, 0x2A, 0xD3, 0xA9, 0x5A, 0xCA, 0x73, 0xD9, 0x73, 0xD7,
+    0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAD, 0x71, 0x9A, 0xEA,
+    0x96, 0x9F, 0xE6, 0x70, 0xC9, 0x79, 0xCA, 0x7A, 0xC9, 0x7D, 0x5C, 0xA0, 0xC9, 0x4A, 0xC9, 0x0A,
+    0x5D, 0x6A, 0xAF, 0xCA, 0x1F, 0xF9, 0x3A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x79, 0xCA, 0x7A, 0xCA,
+    0x7D, 0x97, 0xD2, 0x9A, 0x3D, 0x1A, 0xCA, 0x3F, 0xD4, 0xAE, 0x97, 0x60, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xFC, 0xAA, 0xCA, 0xAA, 0xAE, 0xAA, 0xAD, 0x9D, 0x3D, 0x92, 0xAC,
+    0x0D, 0x29, 0xD3, 0xAC, 0x0A, 0x92, 0xAD, 0x3A, 0x95, 0xAC, 0xA7, 0x3D, 0x97, 0x09, 0x99, 0xDA,
+    0x99, 0x6F, 0xEA, 0x70, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x19,
+    0xAE, 0xA9, 0x69, 0xFE, 0x60, 0x76, 0xCA, 0x6A, 0xC9, 0x6D, 0x5A, 0xAF, 0xCA, 0x0F, 0xF9, 0x2A,
+    0xCA, 0x6D, 0x96, 0xD4, 0xAF, 0xEA, 0x09, 0xAE, 0xAA, 0xA9, 0x2A, 0xCA, 0x6D, 0x96, 0xD2, 0x9A,
+    0x2D, 0x1A, 0xCA, 0x2F, 0xD3, 0xAE, 0x97, 0x40, 0x79, 0x97, 0x6E, 0xA0, 0xAC, 0x71, 0xAC, 0xAF,
+    0xC7, 0x1A, 0xA1, 0xE7, 0x77, 0x77, 0x19, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F,
+    0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7,
+    0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C,
+    0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F,
+    0xD9, 0x77, 0x71, 0x77, 0x29, 0xDA, 0x1C, 0x6F, 0xAD, 0x59, 0xC1, 0xEA, 0x69, 0x29, 0x97, 0x77,
+    0x7A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0x9C, 0xA3,
+    0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9, 0x2C, 0xAC, 0xA3,
+    0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0, 0x9F, 0x19, 0xEA, 0x2D, 0xA7, 0x70, 0x77, 0x79, 0xFE,
+    0x71, 0x9F, 0xDA, 0x77, 0x77, 0x70, 0x99, 0x99, 0x99, 0x49, 0x99, 0x99, 0x99, 0xFD, 0x39, 0xFC,
+    0xA0, 0x9A, 0xD9, 0x59, 0xDA, 0x3A, 0xCA, 0x7D, 0x93, 0xDA, 0x7D, 0x4D, 0x97, 0xD3, 0x9D, 0x79,
+    0xCA, 0x3A, 0xD7, 0xAC, 0x93, 0xAC, 0xA7, 0xD4, 0xD9, 0x7D, 0x4D, 0x97, 0xD3, 0x9D, 0x79, 0xCA,
+    0x39, 0xD7, 0xAC, 0x93, 0xAD, 0x7D, 0x49, 0xD6, 0xDA, 0x5E, 0x4E, 0x6A, 0xFF, 0xC7, 0x09, 0xFD,
+    0x97, 0x77, 0x10, 0x4A, 0xAA, 0xAA, 0xAA, 0x59, 0xFE, 0x77, 0x77, 0x74, 0xAE, 0x49, 0xCA, 0x0A,
+    0xF4, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x3A, 0xCA, 0x39, 0xCA, 0x3D, 0x93, 0xD9, 0x3D, 0x4D,
+    0x3A, 0xCA, 0x3A, 0xD3, 0xD9, 0x29, 0xDA, 0x3D, 0x92, 0xCA, 0xCA, 0x3D, 0x91, 0xD9, 0xCA, 0x9C,
+    0x90, 0xFD, 0x09, 0xF1, 0x9E, 0xA2, 0xDA, 0x77, 0x69, 0x77, 0x9C, 0xA2, 0x9C, 0x71, 0x9D, 0xA9,
+    0xAC, 0xA7, 0x2A, 0xFA, 0x74, 0x99, 0x97, 0x77, 0x19, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F,
+    0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D,
+    0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39,
+    0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC,
+    0x70, 0x9F, 0xD9, 0x77, 0x71, 0x77, 0x2C, 0xA3, 0xA9, 0x5D, 0x90, 0x9A, 0xC6, 0xAF, 0xC9, 0x79,
+    0xAC, 0xA7, 0x77, 0x70, 0xAE, 0x49, 0xCA, 0x0A, 0xF4, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x3A,
+    0xCA, 0x39, 0xCA, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x3A, 0xCA, 0x3A, 0xD3, 0xD9, 0x29, 0xDA, 0x3D,
+    0x92, 0xCA, 0xCA, 0x3D, 0x91, 0xD9, 0xCA, 0x9C, 0x90, 0xFD, 0x09, 0xF1, 0x9E, 0xA2, 0xDA, 0x77,
+    0x70, 0x9A, 0x97, 0x5F, 0xA7, 0x3A, 0xC1, 0xAC, 0x73, 0xD1, 0x9C, 0x73, 0xAC, 0x1D, 0x74, 0xF7,
+    0x69, 0x97, 0x99, 0x99, 0x99, 0x49, 0x99, 0x99, 0x99, 0xFD, 0x39, 0xFC, 0xA0, 0x9A, 0xD9, 0x59,
+    0xDA, 0x3A, 0xCA, 0x7D, 0x93, 0xDA, 0x7D, 0x4D, 0x97, 0xD3, 0x9D, 0x79, 0xCA, 0x3A, 0xD7, 0xAC,
+    0x93, 0xAC, 0xA7, 0xD4, 0xD9, 0x7D, 0x4D, 0x97, 0xD3, 0x9D, 0x79, 0xCA, 0x39, 0xD7, 0xAC, 0x93,
+    0xAD, 0x7D, 0x49, 0xD6, 0xDA, 0x5E, 0x4E, 0x6A, 0xFF, 0xC7, 0x09, 0xFD, 0x97, 0x77, 0x10, 0x69,
+    0xA9, 0x71, 0xAF, 0x79, 0xCA, 0x09, 0xC9, 0x6A, 0xC1, 0x9C, 0x96, 0xAC, 0x1A, 0xC7, 0x0F, 0xA7,
+    0x1A, 0xA9, 0x77, 0x2A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC,
+    0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9,
+    0x2C, 0xAC, 0xA3, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0, 0x9F, 0x19, 0xEA, 0x2D, 0xA7, 0x70,
+    0x77, 0x72, 0x9C, 0x92, 0x9C, 0x70, 0x9D, 0xA1, 0xAD, 0x96, 0xAE, 0x1E, 0xA6, 0xE9, 0x1E, 0x97,
+    0xC9, 0x29, 0xA9, 0x77, 0x69, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09,
+    0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3,
+    0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D,
+    0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77,
+    0x71, 0x77, 0x4C, 0xA1, 0x9C, 0x6A, 0xD1, 0xD9, 0x49, 0xD9, 0x0E, 0x5D, 0x90, 0xAD, 0x59, 0xC9,
+    0x1C, 0xA7, 0x77, 0x7A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC,
+    0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9,
+    0x2C, 0xAC, 0xA3, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0, 0x9F, 0x19, 0xEA, 0x2D, 0xA7, 0x70,
+    0x09, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3,
+    0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A,
+    0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7,
+    0xD4, 0x9D, 0x6D, 0x95, 0xE4, 0xE6, 0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x74, 0xAC, 0xA7, 0x6C, 0xA7,
+    0x6A, 0xC9, 0x76, 0xAD, 0xA9, 0x75, 0xF7, 0x77, 0x20, 0x0A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93,
+    0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0x9C, 0xA3, 0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3,
+    0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9, 0x2C, 0xAC, 0xA3, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0,
+    0x9F, 0x19, 0xEA, 0x2E, 0x72, 0xAC, 0x72, 0xAC, 0x73, 0xD7, 0x3D, 0x99, 0x71, 0xAE, 0x77, 0x74,
+    0x9A, 0x77, 0x6A, 0xE7, 0x74, 0xAF, 0xA7, 0x72, 0xAC, 0xA1, 0xD9, 0x77, 0x0A, 0xCA, 0x3C, 0x97,
+    0x77, 0x72, 0x99, 0x99, 0x99, 0x73, 0x99, 0x99, 0x99, 0x0A, 0xFD, 0x39, 0xCA, 0x39, 0xFD, 0x19,
+    0xE9, 0x4E, 0x5A, 0xD9, 0x3D, 0xA4, 0x9E, 0x5D, 0x94, 0xDA, 0x4A, 0xE4, 0x9D, 0x5D, 0xA4, 0xF4,
+    0xD9, 0x5D, 0xA3, 0xAC, 0xAD, 0x4D, 0x6A, 0xCA, 0x3D, 0x0D, 0x3A, 0xC9, 0x6A, 0xD2, 0xAC, 0x90,
+    0xD9, 0x2D, 0x7A, 0xD2, 0xD1, 0xD9, 0x1A, 0xC9, 0x79, 0xD1, 0xAC, 0x91, 0xD9, 0x1D, 0x70, 0x9D,
+    0x1D, 0x2A, 0xCA, 0x09, 0xC9, 0x70, 0x9D, 0x0A, 0xC9, 0x2A, 0xCA, 0x0D, 0x72, 0xD0, 0xD3, 0x9C,
+    0xA9, 0xC9, 0x72, 0xDA, 0xC9, 0x39, 0xF7, 0x3F, 0x49, 0xEA, 0x73, 0xE9, 0x5E, 0x74, 0xE6, 0xDA,
+    0x77, 0x77, 0x30, 0x77, 0x74, 0xD9, 0x76, 0xF7, 0x5A, 0xC9, 0xD9, 0x73, 0xAC, 0xA0, 0x9D, 0x72,
+    0x9C, 0xA2, 0xAC, 0x77, 0x77, 0x73, 0xAD, 0x93, 0xD3, 0x9D, 0x9A, 0xF3, 0xDA, 0x3D, 0xA2, 0xD9,
+    0x2A, 0xD3, 0xDA, 0x2D, 0x92, 0xAD, 0x3D, 0x92, 0xAC, 0xA2, 0xAD, 0x92, 0xD3, 0x9D, 0x2E, 0x92,
+    0xD4, 0xD1, 0x9E, 0xA1, 0xAC, 0x94, 0xD1, 0xD9, 0xCA, 0x1D, 0x5D, 0x09, 0xC9, 0x0D, 0x0A, 0xC9,
+    0x5D, 0x0D, 0x1D, 0x0C, 0xA6, 0xAE, 0x2F, 0x7A, 0xD9, 0x2E, 0x70, 0xAC, 0x93, 0xD7, 0x77, 0x00,
+    0x70, 0x9A, 0x75, 0xAE, 0x73, 0xAF, 0xC7, 0x1A, 0xD1, 0xAC, 0xA7, 0x9C, 0xA3, 0xC9, 0x77, 0x49,
+    0x99, 0x99, 0x93, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD,
+    0x5A, 0xCA, 0x5D, 0x93, 0x9D, 0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A,
+    0xD0, 0xD7, 0x3F, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74,
+    0xAE, 0xAA, 0x71, 0xFE, 0x70, 0x77, 0x71, 0xD9, 0x73, 0xF7, 0x2A, 0xCA, 0xDA, 0x70, 0x9C, 0xA1,
+    0xD7, 0x9C, 0xA2, 0xAC, 0x77, 0x77, 0x59, 0xDA, 0x39, 0xD3, 0x9F, 0x4D, 0xA5, 0xDA, 0x3A, 0xCA,
+    0x5A, 0xD3, 0xAC, 0x96, 0xD3, 0xD7, 0xD9, 0x2D, 0x7A, 0xC9, 0x19, 0xC9, 0x7A, 0xCA, 0x1D, 0x70,
+    0x9C, 0xA0, 0x9C, 0x97, 0x09, 0xCA, 0x0D, 0x72, 0xCA, 0xAC, 0x72, 0x9C, 0xAC, 0x97, 0x29, 0xDA,
+    0x73, 0xAD, 0x74, 0xD7, 0x39, 0xD7, 0x0A, 0x99, 0xAD, 0x71, 0xFA, 0x72, 0xAC, 0xA9, 0x72, 0x5A,
+    0xC9, 0x19, 0xCA, 0x79, 0xDA, 0x1E, 0x79, 0xD9, 0x1D, 0x97, 0x77, 0x75, 0x99, 0x99, 0x99, 0x39,
+    0x99, 0x99, 0x09, 0xFD, 0x91, 0xAF, 0xC9, 0x09, 0xE9, 0x49, 0xDA, 0x3A, 0xD5, 0xAC, 0xA5, 0xD9,
+    0x39, 0xD6, 0xAD, 0x3D, 0x79, 0xD2, 0xD9, 0x70, 0xDA, 0x0A, 0xCA, 0x71, 0xAD, 0x0D, 0x73, 0xF7,
+    0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x4A, 0xEA, 0xA7, 0x1F,
+    0xE7, 0x73, 0x99, 0x73, 0x9D, 0xA7, 0x2A, 0xE9, 0x71, 0xEA, 0x73, 0xA9, 0x77, 0x71, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x93, 0x9F, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAE, 0x3D, 0x5A, 0xD4, 0xD4, 0x9D,
+    0x94, 0x95, 0xD9, 0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xD7, 0x39, 0xD9, 0x72, 0x9D, 0x97,
+    0x3D, 0xA7, 0x3E, 0x5A, 0xC3, 0xE6, 0xD2, 0xAD, 0x6A, 0xCA, 0x19, 0xFF, 0xF9, 0x2F, 0xFF, 0x77,
+    0x20, 0x77, 0x39, 0xC9, 0x70, 0xD9, 0x7D, 0xA7, 0xAC, 0xA7, 0x0C, 0x97, 0x77, 0x59, 0xDA, 0x91,
+    0x9C, 0x2F, 0xD9, 0xD9, 0x0A, 0xC9, 0x99, 0xFA, 0x1A, 0xC3, 0xAC, 0xA7, 0x9D, 0x79, 0xD7, 0x9D,
+    0x79, 0xD7, 0x0D, 0x70, 0xD4, 0x92, 0xE9, 0x92, 0xCA, 0x0F, 0xFD, 0xA0, 0xD1, 0xAF, 0xC7, 0x50,
+    0x71, 0x97, 0x5D, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0x77, 0x77, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x93, 0x9F, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAE, 0x3D, 0x5A, 0xD4, 0xD4, 0x9D, 0x94, 0x95, 0xD9,
+    0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xD7, 0x39, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x3E,
+    0x5A, 0xC3, 0xE6, 0xD2, 0xAD, 0x6A, 0xCA, 0x19, 0xFF, 0xF9, 0x2F, 0xFF, 0x77, 0x20, 0x59, 0xCA,
+    0x70, 0xE7, 0x0D, 0xA7, 0x09, 0x97, 0x77, 0x59, 0xDA, 0x91, 0x9C, 0x2F, 0xD9, 0xD9, 0x0A, 0xC9,
+    0x99, 0xFA, 0x1A, 0xC3, 0xAC, 0xA7, 0x9D, 0x79, 0xD7, 0x9D, 0x79, 0xD7, 0x0D, 0x70, 0xD4, 0x92,
+    0xE9, 0x92, 0xCA, 0x0F, 0xFD, 0xA0, 0xD1, 0xAF, 0xC7, 0x50, 0x77, 0x5C, 0xA3, 0xAC, 0x96, 0xD9,
+    0x1A, 0xCA, 0x79, 0xD9, 0xDA, 0x71, 0xAE, 0xA7, 0x3A, 0xCA, 0x77, 0x70, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x93, 0x9F, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAE, 0x3D, 0x5A, 0xD4, 0xD4, 0x9D, 0x94, 0x95,
+    0xD9, 0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xD7, 0x39, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7,
+    0x3E, 0x5A, 0xC3, 0xE6, 0xD2, 0xAD, 0x6A, 0xCA, 0x19, 0xFF, 0xF9, 0x2F, 0xFF, 0x77, 0x20, 0x77,
+    0xCA, 0x2A, 0xC9, 0x3D, 0x1A, 0xCA, 0x49, 0xCA, 0x9C, 0xA6, 0xF7, 0x9D, 0x77, 0x75, 0x9D, 0xA9,
+    0x19, 0xC2, 0xFD, 0x9D, 0x90, 0xAC, 0x99, 0x9F, 0xA1, 0xAC, 0x3A, 0xCA, 0x79, 0xD7, 0x9D, 0x79,
+    0xD7, 0x9D, 0x70, 0xD7, 0x0D, 0x49, 0x2E, 0x99, 0x2C, 0xA0, 0xFF, 0xDA, 0x0D, 0x1A, 0xFC, 0x75,
+    0x77, 0x76, 0xF9, 0x73, 0xDA, 0xE7, 0x2D, 0x2A, 0x97, 0x19, 0xCA, 0x76, 0xD9, 0x76, 0xD7, 0x69,
+    0xD7, 0x6A, 0xCA, 0x76, 0xAC, 0x97, 0x6D, 0x97, 0x6D, 0x76, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x97,
+    0x6D, 0x77, 0xD7, 0x69, 0xD7, 0x6A, 0xCA, 0x76, 0xD9, 0x76, 0xD7, 0x69, 0xD7, 0x6D, 0x97, 0x1A,
+    0xC9, 0x09, 0xD7, 0x2F, 0xD7, 0x39, 0xAD, 0xA7, 0x30, 0x77, 0x09, 0x97, 0x7A, 0xD7, 0x7D, 0xA7,
+    0x9A, 0xA9, 0x29, 0xD5, 0x9F, 0xEA, 0x9D, 0x94, 0xEA, 0x99, 0x9A, 0xF5, 0xE5, 0x9D, 0xA4, 0xE7,
+    0xE3, 0x9D, 0x70, 0x9D, 0x92, 0xDA, 0x71, 0xD9, 0x19, 0xD7, 0x2D, 0x91, 0xAD, 0x72, 0xD9, 0x1D,
+    0xA7, 0x19, 0xD2, 0xDA, 0x71, 0xAD, 0x2D, 0xA7, 0x1D, 0xA2, 0xDA, 0x70, 0x9D, 0x3E, 0x70, 0xDA,
+    0x39, 0xD9, 0x6A, 0xD5, 0xE9, 0x39, 0xE7, 0xFA, 0xAF, 0x71, 0xAF, 0xCA, 0x97, 0x77, 0x20, 0x72,
+    0x9A, 0x97, 0x2A, 0xCA, 0x72, 0xD9, 0x39, 0xAE, 0xAA, 0xCA, 0x3A, 0xFE, 0x93, 0xE2, 0x9D, 0x3A,
+    0xD4, 0xD9, 0x2D, 0x94, 0xDA, 0x19, 0xD5, 0xDA, 0x1A, 0xCA, 0x5D, 0x91, 0xD9, 0x49, 0xD2, 0xD9,
+    0x4A, 0xCA, 0x2D, 0xA4, 0xD3, 0xAD, 0x3D, 0xA3, 0x9E, 0xAA, 0xDA, 0x59, 0xFC, 0x97, 0x73, 0x59,
+    0x9A, 0xAA, 0x96, 0xAF, 0xFD, 0x3E, 0x9D, 0xA1, 0x9E, 0x1A, 0xD1, 0xD9, 0x3D, 0xA0, 0x9C, 0x91,
+    0xD4, 0xDA, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x92, 0xAD, 0x6D, 0xAA,
+    0xAE, 0x69, 0xFD, 0x97, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x73, 0xAE, 0xAA,
+    0x70, 0xFE, 0x70, 0x77, 0x70, 0xAE, 0xA7, 0x1D, 0xAA, 0xD7, 0x0D, 0x91, 0x99, 0x79, 0xD7, 0x4A,
+    0xC9, 0x74, 0xD7, 0x5D, 0x19, 0xE6, 0x9D, 0x0A, 0xFC, 0x5A, 0xCA, 0x9C, 0xA0, 0xAD, 0x5A, 0xCA,
+    0xC9, 0x2D, 0x94, 0xEA, 0x3D, 0x5E, 0x4D, 0x49, 0xD9, 0x39, 0xD4, 0xAD, 0x4A, 0xCA, 0x4D, 0xA4,
+    0xD5, 0xD9, 0x3A, 0xCA, 0x5D, 0x92, 0x9D, 0x59, 0xFA, 0xE6, 0xAC, 0xAF, 0xA7, 0xD9, 0x74, 0xD7,
+    0x5D, 0x74, 0x9C, 0xA7, 0x3A, 0xFC, 0x97, 0x0A, 0xAA, 0xAA, 0xA9, 0x70, 0x76, 0xCA, 0x6A, 0xC9,
+    0x6D, 0x5A, 0xAF, 0xCA, 0x0F, 0xF9, 0x2A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x69, 0xCA, 0x6A, 0xCA,
+    0x6D, 0x96, 0xD2, 0x9A, 0x2D, 0x1A, 0xD2, 0xFD, 0xA2, 0xAE, 0xAC, 0x96, 0xAC, 0x7D, 0x69, 0xC9,
+    0x2D, 0x09, 0xD3, 0xFC, 0x49, 0xAA, 0xA4, 0x49, 0x99, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xFF, 0xA0,
+    0xEA, 0xAA, 0xEA, 0xAA, 0xD9, 0x0D, 0x92, 0xD9, 0x2A, 0xC1, 0xD2, 0x9D, 0x3A, 0xC1, 0x99, 0x2A,
+    0xD3, 0xA9, 0x6A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97,
+    0x4D, 0x74, 0x9D, 0x74, 0xAD, 0x72, 0x9A, 0xEA, 0x97, 0x9F, 0xE6, 0x77, 0x3A, 0xEA, 0x6D, 0xAA,
+    0xD5, 0xAC, 0x91, 0x99, 0x5D, 0x71, 0xAC, 0x97, 0x1D, 0x70, 0xAA, 0xFC, 0xA3, 0xFF, 0x95, 0xAC,
+    0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0x9C, 0xA7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD2, 0x9A,
+    0x5D, 0x1A, 0xCA, 0x5F, 0xD6, 0xAE, 0xA7, 0x72, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09,
+    0xFF, 0xFC, 0xAA, 0xCA, 0xAA, 0xAE, 0xAA, 0xAD, 0x9D, 0x3D, 0x92, 0xAC, 0x0D, 0x29, 0xD3, 0xAC,
+    0x0A, 0x92, 0xAD, 0x3A, 0x95, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAD, 0x73, 0xDA,
+    0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x3D, 0x74, 0xD2, 0xA7,
+    0x0D, 0xA9, 0xAC, 0x70, 0x9F, 0xC7, 0x19, 0xDA, 0x60, 0x77, 0x09, 0x97, 0x70, 0x9D, 0x77, 0x09,
+    0xD1, 0x99, 0x99, 0x99, 0x49, 0x99, 0xAD, 0x90, 0x9F, 0xD3, 0x9F, 0xC9, 0x29, 0xAD, 0x95, 0x9D,
+    0xA5, 0xAC, 0xA7, 0xD9, 0x5D, 0xA7, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0xAD, 0x7A, 0xC9,
+    0x5A, 0xCA, 0x7D, 0x6D, 0x97, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0x9D, 0x7A, 0xC9, 0x5A,
+    0xD7, 0xD6, 0x9D, 0x6D, 0xA7, 0xE4, 0xE7, 0x0A, 0xFF, 0xC7, 0x29, 0xFD, 0x97, 0x77, 0x50, 0x74,
+    0x9A, 0x97, 0x4A, 0xCA, 0x73, 0x9D, 0x90, 0xAE, 0x49, 0xE9, 0x0A, 0xF4, 0xDA, 0x5D, 0x4D, 0x94,
+    0x9D, 0x39, 0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x95, 0xD4, 0xD5, 0xAC, 0xA3, 0xAD, 0x5D,
+    0x92, 0x9D, 0xA5, 0xD9, 0x2C, 0xAC, 0xA5, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x2F, 0xD0, 0x9F, 0x39,
+    0xEA, 0x2D, 0xA7, 0x73, 0x6A, 0xA2, 0x9D, 0x3E, 0x3D, 0xA3, 0xAC, 0x60, 0x70, 0xD2, 0xAD, 0x19,
+    0xD2, 0xD2, 0x9C, 0x71, 0x74, 0xAD, 0x49, 0xE9, 0x29, 0xDA, 0xD2, 0xD1, 0xD1, 0xD2, 0x9C, 0x97,
+    0x00, 0x70, 0xE9, 0x0A, 0xAA, 0xFA, 0xCA, 0xCA, 0x09, 0xE4, 0x99, 0x10, 0x9A, 0xAA, 0xAA, 0xA9,
+    0xAF, 0xDA, 0x70, 0x79, 0xC4, 0xCA, 0xD9, 0x09, 0xCA, 0x0F, 0xD2, 0xAC, 0xA9, 0x10, 0x0A, 0xC9,
+    0x9D, 0xAA, 0xD9, 0x09, 0x10, 0x19, 0x92, 0x99, 0x1E, 0x1E, 0x1D, 0xA1, 0xDA, 0x29, 0x39, 0x10,
+    0x19, 0xAA, 0x2F, 0xC0, 0xAC, 0x1D, 0x09, 0xA1, 0xD3, 0xD2, 0x9D, 0x39, 0xC7, 0x20, 0x29, 0xA9,
+    0x3F, 0x91, 0xAC, 0x1D, 0x1C, 0xA1, 0xAC, 0x1D, 0x1C, 0xA1, 0xAF, 0x39, 0xAA, 0x20, 0x73, 0x9C,
+    0x91, 0xCA, 0x2D, 0xA0, 0xAD, 0x1E, 0x09, 0xD9, 0x0A, 0xD1, 0xD9, 0x1C, 0xA1, 0x9C, 0x97, 0x40,
+    0x70, 0x9C, 0x92, 0xD0, 0x9C, 0xA1, 0xD9, 0x1D, 0x9D, 0x92, 0x9E, 0x94, 0xAC, 0xA3, 0x70, 0xC9,
+    0x09, 0xC1, 0xAC, 0xA0, 0xAC, 0x90, 0x9D, 0x09, 0xCA, 0x1D, 0x1D, 0x2C, 0x90, 0x9C, 0x70, 0x49,
+    0x49, 0xFA, 0x19, 0xDA, 0xE9, 0x0C, 0xA2, 0xAC, 0x90, 0x94, 0xA0, 0x70, 0xAC, 0x2A, 0xC9, 0x19,
+    0xCA, 0x2D, 0x92, 0xD9, 0x2E, 0x29, 0xA2, 0x1A, 0xA1, 0x9D, 0xA1, 0xDA, 0x1D, 0x90, 0x9D, 0x1D,
+    0x1A, 0xC2, 0x1A, 0x91, 0xE0, 0xAD, 0x1A, 0xC9, 0x19, 0xC9, 0x2C, 0xA2, 0x9C, 0x10, 0x19, 0x1A,
+    0xC9, 0x0D, 0x1D, 0x09, 0xC9, 0x0A, 0xC5, 0x19, 0xAA, 0x29, 0xD2, 0xDA, 0x19, 0xD2, 0xCA, 0x70,
+    0x0A, 0xC9, 0x9D, 0xAA, 0xD9, 0x09, 0x10, 0x1A, 0x92, 0xA9, 0x1E, 0x1E, 0x1D, 0xA1, 0xDA, 0x29,
+    0x39, 0x10, 0x1A, 0xA9, 0x1D, 0xAC, 0x99, 0xC1, 0xCA, 0xAC, 0x1C, 0x90, 0xF2, 0x99, 0x10, 0x19,
+    0xA9, 0x1D, 0xA1, 0xAC, 0xA1, 0xD1, 0xAC, 0x91, 0x92, 0x1A, 0xAA, 0x2A, 0xD9, 0x2A, 0xC9, 0x19,
+    0xCA, 0x1A, 0xCA, 0x29, 0x92, 0x29, 0x3C, 0x92, 0xD2, 0x9C, 0x92, 0x9D, 0x99, 0x1F, 0x60, 0x1A,
+    0xA2, 0xD1, 0x9C, 0xA1, 0xAC, 0x91, 0xD2, 0x99, 0x10, 0x74, 0xE4, 0xFA, 0x2D, 0xA0, 0xD9, 0x0D,
+    0x92, 0xCA, 0x09, 0x60, 0x09, 0x5D, 0x3A, 0xAE, 0x99, 0xD0, 0x9F, 0xC9, 0x29, 0xA9, 0x20, 0x70,
+    0xAD, 0x19, 0xAA, 0xF9, 0xF0, 0xAE, 0x99, 0x91, 0xAA, 0x90, 0x09, 0x99, 0x99, 0x90, 0xAF, 0xDA,
+    0x9A, 0xAA, 0xAA, 0xA9, 0x49, 0x49, 0xFA, 0x19, 0xDA, 0xE9, 0x0C, 0xA2, 0xAC, 0x90, 0x94, 0xA0,
+    0x6C, 0x6A, 0xCA, 0x49, 0xD5, 0xD9, 0x4A, 0xC9, 0x59, 0x4A, 0xA2, 0x9A, 0x0A, 0xD9, 0x0A, 0xD9,
+    0xE1, 0xAD, 0x19, 0x39, 0x10, 0x19, 0x2D, 0x2D, 0x2D, 0xA9, 0x0E, 0x00, 0x73, 0x9A, 0x77, 0xAD,
+    0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D,
+    0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF,
+    0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A,
+    0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x59, 0xAA, 0xAA, 0x96, 0x9F, 0xFC, 0xA4, 0x9A, 0x9D,
+    0x91, 0xAD, 0xA5, 0x9D, 0x3A, 0xD5, 0xAD, 0x39, 0xD5, 0xAC, 0xA3, 0x9D, 0x5D, 0x93, 0xDA, 0x5D,
+    0x3A, 0xD5, 0x9F, 0xEA, 0x6A, 0xDA, 0xAF, 0xA5, 0xDA, 0x3A, 0xD9, 0x4D, 0x94, 0xDA, 0x4D, 0x5A,
+    0xCA, 0x39, 0xD5, 0xDA, 0x3A, 0xCA, 0x49, 0xD9, 0x3D, 0x94, 0xDA, 0x29, 0xAE, 0xAA, 0xAE, 0xA2,
+    0x9F, 0xFC, 0xA7, 0x74, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xF4, 0x9D, 0xAA, 0xAA,
+    0xAD, 0xA4, 0x9D, 0x4A, 0xCA, 0x4A, 0xD4, 0xAC, 0x94, 0xAC, 0xA4, 0xAC, 0x5D, 0x97, 0x4D, 0x97,
+    0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x4D, 0x74, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x72,
+    0x9A, 0xEA, 0x97, 0x9F, 0xDA, 0x70, 0x71, 0xA9, 0x73, 0xDA, 0x72, 0xF7, 0x19, 0xCA, 0xD7, 0x1D,
+    0x0D, 0x70, 0xAC, 0x90, 0xD9, 0x7D, 0x1A, 0xCA, 0x6A, 0xC2, 0xAC, 0xA5, 0x9C, 0xA2, 0x9D, 0x5D,
+    0x4D, 0x49, 0xCA, 0x4D, 0x93, 0xD5, 0xD9, 0x2A, 0xCA, 0x5A, 0xCA, 0x2D, 0x6A, 0xD1, 0xAC, 0x96,
+    0x9D, 0x09, 0xD7, 0x0D, 0x9F, 0xDA, 0xAA, 0xFC, 0x9A, 0xFF, 0xFC, 0x00, 0x39, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A,
+    0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97,
+    0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF,
+    0xF3, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xE3, 0xAD, 0xAA, 0xAA, 0xAA, 0xE3, 0xD5,
+    0xAD, 0x4D, 0x49, 0xD9, 0x49, 0x5D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x9D,
+    0x97, 0x29, 0xD9, 0x73, 0xDA, 0x73, 0xE5, 0xAC, 0x3E, 0x6D, 0x2A, 0xD6, 0xAC, 0xA1, 0x9F, 0xFF,
+    0x92, 0xFF, 0xF7, 0x72, 0x39, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x94, 0xFD, 0x92, 0x9F, 0xD9,
+    0x49, 0xDA, 0x6A, 0xD9, 0x69, 0xD7, 0xAD, 0x7A, 0xD7, 0xDA, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7D,
+    0x70, 0xD9, 0x69, 0xD7, 0x9F, 0xFF, 0xC7, 0xAF, 0xFF, 0xA7, 0xDA, 0x7D, 0x97, 0xD9, 0x69, 0xD7,
+    0x0D, 0x7A, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xD7, 0xD9, 0x7D, 0xA7, 0xD9, 0x59, 0xAE, 0xA4, 0x9E,
+    0xA9, 0x39, 0xFD, 0x92, 0xAF, 0xD3, 0x79, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4,
+    0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD,
+    0x19, 0xAA, 0xAA, 0xCA, 0x1D, 0x9D, 0xA1, 0xFD, 0x90, 0x9D, 0x0D, 0xA1, 0x96, 0xAD, 0x0D, 0xA7,
+    0x1D, 0xA0, 0xDA, 0x70, 0x9D, 0x1E, 0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5, 0xFA,
+    0xAF, 0x7A, 0xFC, 0xA9, 0x77, 0x60, 0x39, 0x99, 0x99, 0x99, 0x3F, 0xDA, 0x49, 0xDA, 0x69, 0xD7,
+    0xAD, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAD,
+    0x7D, 0xA5, 0x9A, 0xEA, 0x39, 0xFD, 0x92, 0x39, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x4F, 0xD9,
+    0x1F, 0xD5, 0x9D, 0xA4, 0xE9, 0x69, 0xD4, 0xDA, 0x70, 0xAD, 0x29, 0xD9, 0x71, 0xAC, 0xA1, 0x9D,
+    0x97, 0x2D, 0x90, 0xAD, 0x74, 0xD9, 0xAD, 0x74, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xDA, 0x9D, 0x97,
+    0x4D, 0x90, 0xAD, 0x74, 0xD2, 0xE7, 0x29, 0xD2, 0x9D, 0xA7, 0x1A, 0xD3, 0xAD, 0xA7, 0x0D, 0xA4,
+    0xEA, 0x59, 0xAE, 0xA9, 0x3F, 0x39, 0xFD, 0xA4, 0xF7, 0x76, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE7,
+    0x6F, 0x97, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9, 0x09, 0xD7, 0x3D, 0x2D, 0x72,
+    0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xDA, 0x70, 0xAC, 0x93, 0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0xD9, 0x49,
+    0xD6, 0x9C, 0xA5, 0x9D, 0x95, 0xD7, 0xD9, 0x49, 0xCA, 0x7D, 0xA3, 0x9D, 0xA9, 0x59, 0xEA, 0x1F,
+    0xD4, 0xFD, 0xA0, 0x59, 0x99, 0x99, 0x79, 0x99, 0x99, 0x59, 0xFC, 0x69, 0xFC, 0x7A, 0xE9, 0x5F,
+    0x97, 0x0F, 0x94, 0xAF, 0x71, 0xDA, 0xCA, 0x4D, 0x9D, 0x70, 0x9C, 0xAA, 0xCA, 0x3A, 0xC9, 0xAD,
+    0x70, 0xAC, 0x99, 0xD3, 0xD0, 0xAC, 0xA7, 0x0D, 0x09, 0xD2, 0xAC, 0x1A, 0xCA, 0x79, 0xCA, 0x1D,
+    0x2C, 0xA1, 0xAC, 0xA7, 0xAC, 0x91, 0xD9, 0x0D, 0x2D, 0x97, 0xD2, 0xDA, 0x9C, 0xA2, 0xD9, 0x7D,
+    0x2A, 0xCA, 0xD3, 0xD9, 0x6A, 0xCA, 0x29, 0xE9, 0x3D, 0x96, 0xD9, 0x3E, 0x4D, 0x7D, 0x4D, 0x94,
+    0xD6, 0x9C, 0xA4, 0xAA, 0x49, 0xD5, 0x9E, 0x97, 0x19, 0xEA, 0x92, 0xFD, 0x70, 0xAF, 0xD1, 0x39,
+    0x99, 0x96, 0x99, 0x99, 0x99, 0x3F, 0x94, 0x9F, 0xCA, 0x4A, 0xDA, 0x6A, 0xCA, 0x69, 0xE6, 0xAC,
+    0x96, 0xAE, 0xA5, 0xD7, 0xDA, 0xD5, 0xD7, 0xD0, 0xDA, 0x39, 0xCA, 0x7D, 0x0A, 0xD3, 0xAC, 0x96,
+    0x9C, 0xA1, 0xD9, 0x2D, 0x96, 0xAC, 0x91, 0xAD, 0x2D, 0x7D, 0x3D, 0x91, 0xD7, 0xD3, 0xDA, 0x09,
+    0xCA, 0x69, 0xD3, 0x9D, 0x0A, 0xC9, 0x69, 0xCA, 0x4D, 0xAD, 0x7A, 0xC9, 0x49, 0xF7, 0xD6, 0xF6,
+    0xAD, 0xA9, 0x49, 0xDA, 0x49, 0xFD, 0x5D, 0x97, 0x77, 0x10, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x4F, 0xFF, 0x93, 0xFF, 0xF4, 0xCA, 0x7D, 0x39, 0xC9, 0x7D, 0x4C, 0x70, 0xC9, 0x77, 0x77, 0x79,
+    0xFD, 0xA7, 0x0F, 0xE9, 0x70, 0x97, 0x77, 0x77, 0x6C, 0xA7, 0x0C, 0x92, 0xAC, 0x97, 0xAC, 0x92,
+    0xD9, 0x7D, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x20, 0x79, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99,
+    0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72,
+    0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7,
+    0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA,
+    0x97, 0x76, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFF, 0x59, 0xEA, 0xAA,
+    0xAA, 0xAE, 0x96, 0x9D, 0x6A, 0xCA, 0x7A, 0xD6, 0xDA, 0x7A, 0xCA, 0x6D, 0x97, 0xD9, 0x59, 0xD7,
+    0x0D, 0x95, 0xAD, 0x79, 0xD6, 0xDA, 0x7A, 0xD6, 0xD9, 0x7D, 0xA6, 0xD7, 0x0D, 0x95, 0x9D, 0x70,
+    0xD6, 0xAD, 0x79, 0xD6, 0xDA, 0x7A, 0xD6, 0xD9, 0x7D, 0xA6, 0xD6, 0x9A, 0xEA, 0x39, 0xEA, 0x93,
+    0x9F, 0xD9, 0x1A, 0xFD, 0x30, 0x59, 0x9A, 0xAA, 0x96, 0x9F, 0xFC, 0xA4, 0x9A, 0x9D, 0x91, 0xAD,
+    0xA5, 0x9D, 0x39, 0xD5, 0xAD, 0x4D, 0x94, 0xAC, 0xA4, 0xD9, 0x4D, 0x93, 0x9D, 0x5D, 0x4D, 0xA4,
+    0x9D, 0x3E, 0x5A, 0xD9, 0xAA, 0xDA, 0x6F, 0xDA, 0x97, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xD7,
+    0x4D, 0xA7, 0x29, 0xAE, 0xA9, 0x79, 0xFE, 0x70, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xFF,
+    0x3E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xD9, 0x4A, 0xC9, 0x4E, 0x49, 0xC6, 0xD9, 0x39, 0x96, 0xAD,
+    0x75, 0xD9, 0x74, 0xAD, 0x74, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x59, 0x4A, 0xD5, 0x9C,
+    0x3A, 0xD6, 0xD2, 0x9D, 0x6A, 0xCA, 0x2F, 0xFF, 0x92, 0xFF, 0xF7, 0x72, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xFC, 0xAA, 0xCA, 0xAA, 0xAE, 0xAA, 0xAD, 0x9D, 0x3D, 0x92, 0xAC,
+    0x0D, 0x29, 0xD3, 0xAC, 0x0A, 0x92, 0xAD, 0x3A, 0x95, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D,
+    0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x19, 0xAE, 0xA9, 0x69,
+    0xFE, 0x60, 0x2A, 0x97, 0x9A, 0x1F, 0x6A, 0xDA, 0xAF, 0x94, 0xAE, 0x3D, 0xA3, 0x9E, 0x4A, 0xD3,
+    0xE5, 0x9D, 0x2A, 0xD7, 0xD9, 0x1D, 0x70, 0xAC, 0xA0, 0xAC, 0xA7, 0x09, 0xCA, 0x0D, 0x72, 0xDA,
+    0xC7, 0x3E, 0xA7, 0x3E, 0x74, 0xDA, 0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x29, 0xAE, 0xAA, 0x79,
+    0xFE, 0x60, 0x69, 0xFD, 0x73, 0x9A, 0xD9, 0x75, 0xAC, 0xA7, 0x29, 0xAF, 0xDA, 0x96, 0xFA, 0xDA,
+    0xF3, 0x9D, 0xA2, 0xD2, 0xE2, 0xD9, 0x29, 0xCA, 0x29, 0xD9, 0x0A, 0xD3, 0xAC, 0xA3, 0xD9, 0x0D,
+    0x93, 0xD9, 0x3D, 0x90, 0xD4, 0xD4, 0xD9, 0x0D, 0x39, 0xD3, 0x9D, 0x1D, 0x92, 0x9C, 0xA3, 0xDA,
+    0x1E, 0x2A, 0xC9, 0x19, 0xDA, 0x3E, 0xAA, 0xDA, 0xAE, 0xA5, 0xAF, 0xFA, 0x72, 0x9D, 0x76, 0xAC,
+    0xA7, 0x4A, 0xFC, 0x97, 0x29, 0x99, 0x99, 0x97, 0x49, 0x99, 0x99, 0x92, 0x99, 0x99, 0x94, 0xFD,
+    0xA1, 0xAF, 0xC9, 0x4A, 0xDA, 0x49, 0xDA, 0x7E, 0x4D, 0xA7, 0x09, 0xD9, 0x2A, 0xCA, 0x72, 0xDA,
+    0x1A, 0xCA, 0x74, 0xD0, 0x9D, 0x75, 0xAF, 0x77, 0xE7, 0x79, 0xE7, 0x69, 0xF9, 0x75, 0xD0, 0xAD,
+    0x74, 0xD2, 0xD9, 0x72, 0xD9, 0x2A, 0xD7, 0x1D, 0x94, 0xD9, 0x7A, 0xCA, 0x5A, 0xD5, 0x9E, 0xA9,
+    0x39, 0xFA, 0x2F, 0xE2, 0xAF, 0xD9, 0x10, 0x0A, 0xA3, 0x99, 0x99, 0x99, 0x3A, 0xA1, 0xDA, 0x1A,
+    0xFD, 0x2D, 0xA1, 0xDA, 0x29, 0xE3, 0xAD, 0x2A, 0xCA, 0x3D, 0x93, 0xDA, 0x2A, 0xCA, 0x3D, 0x39,
+    0xD3, 0xAC, 0xA2, 0x9D, 0x3A, 0xCA, 0x3D, 0xA2, 0xAD, 0x3D, 0x93, 0xD9, 0x2D, 0xA2, 0x9D, 0x4D,
+    0xA2, 0xD9, 0x2D, 0xA4, 0xAD, 0x2D, 0x2A, 0xD5, 0x9D, 0xA0, 0x9D, 0x1A, 0xD7, 0xAF, 0xFD, 0x72,
+    0xAF, 0xCA, 0x97, 0x5D, 0x97, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0xAE, 0xA9, 0x74, 0xFD, 0xA7, 0x10,
+    0x71, 0x99, 0xAA, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xEA, 0x99, 0x9A, 0xE6, 0x9D, 0xA5, 0x9D, 0xA5,
+    0xDA, 0x7E, 0x4A, 0xD7, 0x0A, 0xD4, 0xDA, 0x70, 0x9D, 0x4D, 0x97, 0x0A, 0xD4, 0xD9, 0x70, 0xAD,
+    0x4D, 0x97, 0x0D, 0xA4, 0xD9, 0x79, 0xD5, 0xD9, 0x7D, 0x95, 0xAC, 0xA6, 0xAC, 0xA4, 0x91, 0xD5,
+    0xAC, 0xA1, 0x91, 0xAC, 0x19, 0xCA, 0x3A, 0xCA, 0x1D, 0x1D, 0x2A, 0xC9, 0x1D, 0x92, 0xCA, 0x1F,
+    0xE1, 0x9F, 0xE9, 0x09, 0xFD, 0xA2, 0xFE, 0x10, 0x77, 0x19, 0xE2, 0xD3, 0xFD, 0x1D, 0x2D, 0xA1,
+    0xAC, 0x9A, 0xCA, 0x1A, 0xCA, 0x3C, 0xAD, 0x2D, 0x4A, 0xDA, 0x19, 0xD4, 0xAD, 0x2A, 0xCA, 0x4A,
+    0xCA, 0x2D, 0x94, 0xD3, 0xD9, 0x3A, 0xD3, 0xD9, 0x29, 0xE3, 0xE1, 0xAD, 0x9C, 0xA0, 0x99, 0xAF,
+    0xD1, 0xF9, 0x0A, 0xEA, 0x2A, 0xD9, 0x76, 0x79, 0x99, 0x79, 0xFC, 0x59, 0xD9, 0x9D, 0xA4, 0xD2,
+    0xAC, 0xA3, 0xAC, 0x92, 0xAC, 0xA3, 0xD3, 0xD3, 0x9C, 0xA2, 0x9D, 0x3A, 0xC9, 0x2D, 0x4D, 0x91,
+    0xD9, 0x4D, 0x09, 0xE9, 0x4D, 0x1A, 0xAD, 0x92, 0x9D, 0x3A, 0xD2, 0x9C, 0xA4, 0xD2, 0xAC, 0x94,
+    0xD9, 0x1D, 0x5D, 0x2D, 0x49, 0xD2, 0xD4, 0xAC, 0xA1, 0x9D, 0x39, 0xD2, 0xAE, 0xAA, 0xAD, 0x3F,
+    0xEA, 0x4D, 0x72, 0xD7, 0x19, 0xD7, 0x19, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xA7, 0x20, 0x75, 0xAD,
+    0x93, 0xDA, 0x09, 0xF3, 0xAD, 0x3D, 0x92, 0x9D, 0x3D, 0xA3, 0xD3, 0xAC, 0xA2, 0x9C, 0xA3, 0x9D,
+    0x2D, 0x94, 0xD2, 0xD5, 0xD1, 0xD9, 0x5D, 0x09, 0xCA, 0x6D, 0x0D, 0x7A, 0xE7, 0x0A, 0xD9, 0x70,
+    0xAC, 0x97, 0x1D, 0x72, 0xCA, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xA7, 0x00, 0x79,
+    0x97, 0x09, 0xFA, 0x5A, 0xCA, 0x9A, 0xD9, 0x39, 0xCA, 0x29, 0xCA, 0x3A, 0xCA, 0x3A, 0x4A, 0xD7,
+    0x2D, 0xA7, 0x19, 0xD9, 0x79, 0xF6, 0xDA, 0x0A, 0xD4, 0xD9, 0x2D, 0x92, 0xAC, 0xA3, 0xAD, 0x19,
+    0xD4, 0x9D, 0x1A, 0xCA, 0x49, 0xD1, 0xDA, 0x49, 0xD1, 0xD9, 0x4A, 0xCA, 0x1D, 0xA4, 0xD9, 0x1A,
+    0xD3, 0xAC, 0xA3, 0xEA, 0xAE, 0x49, 0xFC, 0xA7, 0x09, 0x70, 0x76, 0xAF, 0xA2, 0x9F, 0xE2, 0xD9,
+    0x29, 0xA1, 0x9D, 0x70, 0xD7, 0x0D, 0xAA, 0xA5, 0xAF, 0x4D, 0xA9, 0x59, 0xCA, 0x7D, 0x97, 0xE4,
+    0xA9, 0x09, 0xFF, 0x29, 0xFC, 0xA7, 0x50, 0x39, 0x79, 0xCA, 0x7D, 0x92, 0xAC, 0x2D, 0xA1, 0xE3,
+    0xFD, 0xA5, 0xD7, 0xD7, 0xAC, 0x97, 0xCA, 0x7D, 0x79, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xD7, 0x9E, 0x7A, 0xEA, 0x69, 0xFA, 0x69, 0xEA, 0x7A, 0xCA, 0x7A, 0xCA, 0x6A,
+    0xD5, 0xF6, 0xCA, 0x94, 0x73, 0x9A, 0xDA, 0x19, 0xE0, 0xAF, 0x09, 0xFA, 0x19, 0xCA, 0x9C, 0xA0,
+    0xAD, 0x1A, 0xCA, 0xC9, 0x19, 0xCA, 0x1E, 0xA2, 0xAC, 0xA1, 0xE3, 0xAC, 0x91, 0xD9, 0x3D, 0x90,
+    0x9D, 0x4D, 0x1A, 0xCA, 0x4D, 0x1D, 0x93, 0x9C, 0xA1, 0xD4, 0xAC, 0x90, 0x9D, 0x4D, 0x1A, 0xCA,
+    0x4D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0xAD, 0x70, 0xAA, 0x30, 0x69, 0x99,
+    0x70, 0x9F, 0xC9, 0x59, 0xD9, 0x9E, 0x5D, 0x3D, 0xA3, 0xD4, 0xAD, 0x29, 0xCA, 0x49, 0xD2, 0xD6,
+    0xD1, 0x9D, 0x6D, 0x1A, 0xCA, 0x59, 0xD1, 0xEA, 0xAA, 0xAA, 0xAA, 0xD1, 0xFF, 0xEA, 0x1D, 0x6A,
+    0xCA, 0x09, 0xD6, 0xD9, 0x09, 0xD5, 0x9D, 0x19, 0xD5, 0xAC, 0xA2, 0xD5, 0xD3, 0xD9, 0x3A, 0xC9,
+    0x3A, 0xD2, 0xAC, 0xA5, 0xEA, 0xDA, 0x69, 0xFA, 0x77, 0x30, 0x79, 0xCA, 0x2D, 0x92, 0xD2, 0x9D,
+    0x29, 0xCA, 0x2A, 0xC9, 0x2D, 0x92, 0xD2, 0x9D, 0x2A, 0xCA, 0x2A, 0xC9, 0x0A, 0x0F, 0xC0, 0xAD,
+    0xA7, 0x74, 0x9A, 0xDA, 0x4A, 0xDA, 0xF2, 0x9F, 0x19, 0xCA, 0x19, 0xDA, 0x3A, 0xC9, 0x09, 0xD5,
+    0xD1, 0xD6, 0xD0, 0xE5, 0x9C, 0xA9, 0xE5, 0x9C, 0x9C, 0xAC, 0xA5, 0xAC, 0xAC, 0x0D, 0x5E, 0x1D,
+    0x5D, 0xA1, 0xDA, 0x1A, 0x09, 0xD2, 0xAF, 0xC0, 0xAC, 0x93, 0xEA, 0x76, 0x49, 0x99, 0x71, 0xFC,
+    0x70, 0xAA, 0xE9, 0x72, 0xAD, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x72, 0x9D, 0x97, 0x1E, 0x97,
+    0x09, 0xE9, 0x70, 0xDA, 0xCA, 0x7A, 0xC9, 0x9C, 0xA7, 0xD0, 0x9C, 0xA6, 0xD9, 0x09, 0xD5, 0xAD,
+    0x19, 0xD4, 0x9D, 0x3D, 0x4D, 0xA3, 0xD1, 0xA0, 0xE4, 0xFA, 0xAD, 0x5A, 0xDA, 0x76, 0x77, 0x39,
+    0xCA, 0x4A, 0xC5, 0xD9, 0x39, 0xD5, 0xD4, 0xAC, 0xA5, 0xD4, 0xD9, 0x49, 0xD4, 0xD5, 0xAC, 0xA4,
+    0xD5, 0xD9, 0x39, 0xD5, 0xD4, 0xAC, 0xA5, 0xD4, 0xD9, 0x49, 0xD3, 0xAD, 0x94, 0x9D, 0xA1, 0x9C,
+    0xAC, 0xA0, 0x99, 0x1A, 0xFD, 0xA0, 0xF9, 0x1D, 0xAE, 0xA1, 0xAD, 0x92, 0xCA, 0x74, 0x9C, 0xA7,
+    0x4A, 0xCA, 0x74, 0xAC, 0x97, 0x4D, 0x97, 0x4C, 0xA7, 0x77, 0x40, 0x75, 0xAD, 0x93, 0xE0, 0xAF,
+    0x3A, 0xD2, 0x9D, 0x39, 0xD3, 0xD9, 0x3D, 0x3A, 0xCA, 0x29, 0xCA, 0x3A, 0xCA, 0x2D, 0x93, 0x9D,
+    0x2D, 0x5D, 0x1D, 0x6D, 0x09, 0xCA, 0x6D, 0x0D, 0x7F, 0x70, 0xE7, 0x1A, 0xC7, 0x73, 0x29, 0x97,
+    0xAC, 0xA7, 0xD4, 0x92, 0xAD, 0x9A, 0xE3, 0x9F, 0xCA, 0x3A, 0xC9, 0x69, 0xCA, 0x7D, 0x97, 0xD9,
+    0x7A, 0xCA, 0x70, 0xE9, 0x95, 0x9F, 0x4A, 0xDA, 0xA9, 0x3A, 0xCA, 0x69, 0xD7, 0xAC, 0xA7, 0xAD,
+    0x79, 0xE7, 0xAE, 0xA6, 0x9F, 0xA6, 0x9E, 0xA7, 0xAC, 0xA7, 0xAC, 0xA6, 0xAD, 0x5F, 0x6C, 0xA9,
+    0x40, 0x77, 0x9A, 0xE9, 0x4A, 0xFD, 0xA2, 0xE2, 0xAD, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xD9, 0x9D,
+    0x5D, 0x9A, 0xCA, 0x5D, 0x0D, 0x94, 0x9D, 0x0D, 0x94, 0xDA, 0x0D, 0xA3, 0x9D, 0x1A, 0xD2, 0x9D,
+    0x91, 0x9E, 0xAE, 0x93, 0x9F, 0xA7, 0x70, 0x77, 0x19, 0xAF, 0xFC, 0xA1, 0xFF, 0xF9, 0x09, 0xCA,
+    0x9D, 0x99, 0xAC, 0xA9, 0x29, 0x2C, 0xA1, 0xAC, 0x79, 0xC9, 0x1D, 0x7A, 0xC2, 0xCA, 0x7D, 0x19,
+    0xC9, 0x69, 0xC9, 0x1A, 0xC7, 0xD2, 0xD6, 0x9C, 0xA2, 0xD6, 0xD9, 0x2D, 0x1A, 0x29, 0xD3, 0xFC,
+    0x2D, 0x93, 0xEA, 0x77, 0x10, 0x77, 0x4A, 0xEA, 0x69, 0xFE, 0x5D, 0x3D, 0xA3, 0xD9, 0x3A, 0xCA,
+    0x29, 0xD4, 0xAD, 0x2A, 0xC9, 0x4A, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x5D, 0x92, 0xD4, 0x9D, 0x29,
+    0xD4, 0xDA, 0x2A, 0xD3, 0xAD, 0x3A, 0xEA, 0xAE, 0x4D, 0xAF, 0xA5, 0xD7, 0x3D, 0x72, 0x9C, 0xA7,
+    0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xCA, 0x72, 0x75, 0xAE, 0xA3, 0xFD, 0x2D, 0x91, 0x9A, 0x1D, 0x95,
+    0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD9, 0x6D, 0xA6, 0xAD, 0xA6, 0xF9, 0x5A, 0xF9, 0x5A, 0xE6, 0x9D,
+    0x7D, 0x59, 0xD9, 0x3A, 0xE9, 0x4A, 0xCA, 0x40, 0x77, 0x2A, 0xAF, 0xDA, 0x2A, 0xFF, 0xC9, 0x1A,
+    0xD9, 0x1D, 0x99, 0x2A, 0xD3, 0x9C, 0xA3, 0xD9, 0x4D, 0x29, 0xD5, 0xD2, 0xDA, 0x49, 0xD2, 0xD9,
+    0x49, 0xD2, 0xD9, 0x4D, 0xA2, 0xDA, 0x39, 0xD3, 0xAD, 0x3D, 0x94, 0xEA, 0xAD, 0x95, 0x9F, 0xC7,
+    0x74, 0x75, 0xAA, 0xFE, 0x99, 0xFF, 0xD0, 0xAC, 0xA9, 0xAC, 0xA9, 0x99, 0x19, 0x2A, 0xC7, 0x1D,
+    0x71, 0xCA, 0x70, 0xAC, 0x97, 0x0D, 0x71, 0xD7, 0x1D, 0x70, 0x9D, 0x1A, 0xA4, 0x9F, 0xC6, 0xEA,
+    0x77, 0x00, 0x74, 0xAE, 0x3D, 0x09, 0xF3, 0xDA, 0x2D, 0x3A, 0xD1, 0xAC, 0xA3, 0xAD, 0x1D, 0x93,
+    0x9D, 0x1D, 0x4A, 0xCA, 0x0A, 0xD4, 0xD9, 0x0A, 0xCA, 0x4D, 0x1D, 0x93, 0x9D, 0x1D, 0x93, 0xD2,
+    0xE2, 0xDA, 0x2A, 0xFD, 0xA4, 0xAF, 0x97, 0x70, 0x77, 0x3A, 0xCA, 0x19, 0xEA, 0x4D, 0x91, 0x9F,
+    0xCA, 0x2D, 0x3D, 0x19, 0xD1, 0xAC, 0xA2, 0x9C, 0x92, 0xD9, 0x0D, 0x3A, 0xC3, 0xAC, 0xA9, 0xD3,
+    0xD3, 0xAC, 0x9A, 0xCA, 0x3C, 0xA3, 0xD9, 0xAC, 0xA2, 0x9C, 0xA3, 0xD0, 0xAD, 0x2A, 0xC9, 0x2A,
+    0xC9, 0x09, 0xD2, 0xD2, 0x9D, 0x2E, 0x1D, 0x1A, 0xD3, 0x9F, 0xFC, 0xA6, 0xAF, 0xC9, 0x72, 0xD9,
+    0x74, 0xD7, 0x5D, 0x74, 0x9C, 0xA7, 0x4A, 0xC9, 0x74, 0xCA, 0x71, 0x77, 0x3A, 0xD9, 0x39, 0xD3,
+    0xAF, 0x3D, 0x96, 0xD2, 0xAC, 0xA7, 0xD9, 0x09, 0xD7, 0x0A, 0xCA, 0x0D, 0x71, 0x9C, 0xA9, 0xC9,
+    0x72, 0xEA, 0x73, 0xE7, 0x4D, 0x97, 0x4D, 0x97, 0x3A, 0xDA, 0x72, 0x9C, 0xAD, 0x72, 0xD0, 0xD7,
+    0x1A, 0xC1, 0xD9, 0x79, 0xCA, 0x1D, 0xA7, 0xD2, 0xAD, 0x6D, 0x92, 0x9D, 0x99, 0xC2, 0xAD, 0x4F,
+    0x92, 0xAC, 0x59, 0xCA, 0x30, 0x72, 0x97, 0x6D, 0x75, 0x9D, 0x75, 0xAC, 0xA7, 0x5D, 0x95, 0xAE,
+    0x3D, 0x1A, 0xCA, 0x09, 0xF3, 0xD2, 0xD3, 0xD2, 0x9C, 0xA2, 0xD9, 0x19, 0xCA, 0x2A, 0xC9, 0x2D,
+    0x91, 0xD9, 0x2D, 0x3D, 0x91, 0xD3, 0xD3, 0xD9, 0x1D, 0x29, 0xD3, 0xD1, 0x9C, 0xA2, 0xAC, 0xA2,
+    0x9D, 0x19, 0xD2, 0xAC, 0x92, 0xD9, 0x19, 0xD2, 0xD2, 0xAD, 0x3D, 0xA1, 0xD1, 0xAD, 0x4A, 0xFF,
+    0xCA, 0x69, 0xFD, 0xA7, 0x3D, 0x97, 0x5D, 0x76, 0xD7, 0x59, 0xCA, 0x75, 0xD9, 0x75, 0xCA, 0x71,
+    0x77, 0x39, 0xD4, 0xAC, 0x93, 0xAC, 0xA6, 0xD2, 0xAC, 0xA7, 0xD9, 0x09, 0xD3, 0x99, 0x2A, 0xCA,
+    0x0D, 0x92, 0xAC, 0xA2, 0x9D, 0x9D, 0x3D, 0x39, 0xDA, 0xCA, 0x3D, 0x3A, 0xCA, 0xD9, 0x3C, 0xA3,
+    0xAC, 0x9D, 0x92, 0x9C, 0x93, 0xD0, 0xD9, 0x2D, 0x93, 0xD0, 0xDA, 0x19, 0xE2, 0xD9, 0x09, 0xEA,
+    0xCA, 0xAD, 0xAD, 0x92, 0xAE, 0xA1, 0xF9, 0x77, 0x20, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75,
+    0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A,
+    0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99,
+    0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E,
+    0xA9, 0x0F, 0xD4, 0xFE, 0x77, 0x77, 0x75, 0xAC, 0x77, 0xAD, 0x97, 0x6E, 0x77, 0x0A, 0x71, 0x77,
+    0x09, 0xAD, 0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2,
+    0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1,
+    0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x77, 0x69, 0xCA, 0x71, 0xE7, 0x1D,
+    0xA7, 0x19, 0x97, 0x77, 0x75, 0x9E, 0xA7, 0x49, 0xCA, 0x9D, 0x97, 0x39, 0xC1, 0xD7, 0x7D, 0x97,
+    0x59, 0xD7, 0x70, 0xC9, 0x77, 0x77, 0x39, 0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9,
+    0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9, 0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71,
+    0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A, 0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95,
+    0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC, 0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F,
+    0xE0, 0x69, 0xAA, 0x70, 0xAF, 0x69, 0xC9, 0x0A, 0xC9, 0x6A, 0x1D, 0x71, 0xD9, 0x70, 0xD9, 0x71,
+    0xC9, 0x77, 0x77, 0x19, 0xAD, 0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9,
+    0x1D, 0xA4, 0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2,
+    0xD9, 0x2A, 0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x77, 0x2A,
+    0x77, 0x2D, 0x77, 0x1A, 0xCA, 0x75, 0x91, 0x9C, 0x97, 0x49, 0xE7, 0x79, 0xDA, 0xD7, 0x59, 0xD1,
+    0x9C, 0xA7, 0x49, 0xA3, 0x97, 0x70, 0x9A, 0x77, 0x1A, 0xD7, 0x71, 0xE9, 0x77, 0xFA, 0x76, 0x9C,
+    0x9A, 0xCA, 0x76, 0xD0, 0x9D, 0x75, 0x9C, 0x91, 0xD7, 0x5D, 0x2D, 0x97, 0x3A, 0xC9, 0x2D, 0x97,
+    0x3D, 0x3A, 0xCA, 0x72, 0xDA, 0x99, 0x99, 0xAD, 0x71, 0x9F, 0xFD, 0x71, 0xD9, 0x99, 0x99, 0x9A,
+    0xD9, 0x7A, 0xCA, 0x6D, 0x97, 0xD7, 0xDA, 0x6A, 0xCA, 0x7E, 0x5A, 0xDA, 0x95, 0x9E, 0xA9, 0x2F,
+    0xD4, 0xFE, 0x10, 0x74, 0x99, 0x74, 0x9D, 0x74, 0xDA, 0x73, 0xAC, 0xA7, 0x4C, 0x97, 0x1D, 0xA7,
+    0x3F, 0xA7, 0x09, 0xD9, 0x0D, 0x96, 0x9D, 0x91, 0x9C, 0x97, 0x97, 0x77, 0x69, 0xAD, 0xA0, 0x9C,
+    0x95, 0xAF, 0xF5, 0x9D, 0x91, 0xAD, 0xA5, 0xD4, 0xD9, 0x4D, 0xA4, 0xD5, 0xD4, 0x9D, 0x49, 0xCA,
+    0x4A, 0xCA, 0x4A, 0xC9, 0x39, 0xD9, 0x4D, 0x93, 0xE5, 0xD9, 0x2A, 0xE1, 0x92, 0xE1, 0xAC, 0x0D,
+    0x0D, 0x2A, 0xFC, 0x90, 0xF4, 0xF2, 0xE7, 0x74, 0x76, 0xA7, 0x70, 0x9C, 0xA7, 0x70, 0xD9, 0x75,
+    0x91, 0xD7, 0x39, 0xE1, 0x97, 0x29, 0xDA, 0xD7, 0x39, 0xD1, 0x9C, 0xA7, 0x29, 0xA3, 0x97, 0x69,
+    0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9,
+    0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A,
+    0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC,
+    0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE0, 0x70, 0xA7, 0x29, 0xD7, 0x2D, 0x97,
+    0x2D, 0x73, 0xCA, 0x6D, 0xA7, 0x0F, 0xA6, 0xD9, 0x0D, 0x94, 0xD9, 0x19, 0xC9, 0x49, 0x77, 0x70,
+    0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D,
+    0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19,
+    0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x77, 0xAD, 0xA7, 0x79, 0xC9, 0xD7,
+    0x70, 0x90, 0xD7, 0x70, 0x9C, 0xA7, 0x5E, 0x09, 0xA7, 0x5D, 0xAD, 0x75, 0x9D, 0x19, 0xCA, 0x74,
+    0x9A, 0x39, 0x77, 0x09, 0xA7, 0x71, 0xAD, 0x77, 0x1E, 0x97, 0x7F, 0xA7, 0x69, 0xC9, 0xAC, 0xA7,
+    0x6D, 0x09, 0xD7, 0x59, 0xC9, 0x1D, 0x75, 0xD2, 0xD9, 0x73, 0xAC, 0x92, 0xD9, 0x73, 0xD3, 0xAC,
+    0xA7, 0x2D, 0xA9, 0x99, 0x9A, 0xD7, 0x19, 0xFF, 0xD7, 0x1D, 0x99, 0x99, 0x99, 0xAD, 0x97, 0xAC,
+    0xA6, 0xD9, 0x7D, 0x7D, 0xA6, 0xAC, 0xA7, 0xE5, 0xAD, 0xA9, 0x59, 0xEA, 0x92, 0xFD, 0x4F, 0xE1,
+    0x72, 0x9D, 0xA7, 0x2A, 0xCA, 0xD9, 0x71, 0xAA, 0x09, 0xC9, 0x73, 0x9D, 0x73, 0xAC, 0x97, 0x0A,
+    0xAA, 0x09, 0xA7, 0x0F, 0xA7, 0x1D, 0xA0, 0xD9, 0x7D, 0x91, 0x9C, 0x97, 0x94, 0x97, 0x77, 0x09,
+    0xAD, 0xA0, 0x9C, 0x95, 0xAF, 0xF5, 0x9D, 0x91, 0xAD, 0xA5, 0xD4, 0xD9, 0x4D, 0xA4, 0xD5, 0xD4,
+    0x9D, 0x49, 0xCA, 0x4A, 0xCA, 0x4A, 0xC9, 0x39, 0xD9, 0x4D, 0x93, 0xE5, 0xD9, 0x2A, 0xE1, 0x92,
+    0xE1, 0xAC, 0x0D, 0x0D, 0x2A, 0xFC, 0x90, 0xF4, 0xF2, 0xE7, 0x74, 0x72, 0xDA, 0x1C, 0x73, 0xFE,
+    0x73, 0xC9, 0x09, 0xD9, 0x77, 0x77, 0x9D, 0x97, 0x59, 0xF9, 0x73, 0xAD, 0x1D, 0x73, 0xA9, 0x39,
+    0x76, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73,
+    0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99,
+    0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA,
+    0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x77, 0x19, 0xDA, 0x1A, 0x94,
+    0xDA, 0xDA, 0xCA, 0x4C, 0x90, 0x9E, 0x77, 0x4A, 0xA9, 0x70, 0xF9, 0x6D, 0x99, 0xD4, 0x9D, 0x91,
+    0x9C, 0x94, 0x94, 0x97, 0x72, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D,
+    0x4D, 0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9,
+    0x3E, 0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x74,
+    0xA9, 0x77, 0xE9, 0x75, 0xDA, 0xD9, 0x72, 0x9D, 0x90, 0x9D, 0x72, 0xD3, 0x9C, 0x77, 0x77, 0x09,
+    0xA7, 0x7A, 0xD7, 0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9,
+    0x1D, 0x73, 0xD2, 0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A,
+    0xD7, 0x9F, 0xFD, 0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC,
+    0xA7, 0xE3, 0xAD, 0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE7, 0x77, 0x77, 0x5A, 0xC7, 0x7A, 0xD9,
+    0x76, 0xE7, 0x70, 0xA7, 0x10, 0x77, 0x39, 0xD7, 0x09, 0xEA, 0x7D, 0x9D, 0x6D, 0x1A, 0xC9, 0x4D,
+    0x92, 0xCA, 0x77, 0x76, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D,
+    0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E,
+    0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x77, 0x76, 0x9C,
+    0xA7, 0x1E, 0x71, 0xDA, 0x71, 0x99, 0x70, 0x75, 0x99, 0x77, 0x0D, 0x77, 0xDA, 0x74, 0x90, 0x9C,
+    0x90, 0x97, 0x2D, 0x3A, 0xA7, 0x2A, 0xEA, 0xD7, 0x4A, 0xEA, 0x77, 0x77, 0x29, 0xA7, 0x7A, 0xD7,
+    0x7E, 0x97, 0x5F, 0xA7, 0x49, 0xC9, 0xAC, 0xA7, 0x4D, 0x09, 0xD7, 0x39, 0xC9, 0x1D, 0x73, 0xD2,
+    0xD9, 0x71, 0xAC, 0x92, 0xD9, 0x71, 0xD3, 0xAC, 0xA7, 0x0D, 0xA9, 0x99, 0x9A, 0xD7, 0x9F, 0xFD,
+    0x7D, 0x99, 0x99, 0x99, 0xAD, 0x95, 0xAC, 0xA6, 0xD9, 0x5D, 0x7D, 0xA4, 0xAC, 0xA7, 0xE3, 0xAD,
+    0xA9, 0x59, 0xEA, 0x90, 0xFD, 0x4F, 0xE0, 0x71, 0x97, 0x2A, 0xC9, 0x70, 0x9D, 0x97, 0x0D, 0x97,
+    0x09, 0xC7, 0x9C, 0x4A, 0x4A, 0xCA, 0x1A, 0xC9, 0x49, 0xFC, 0xA6, 0x9A, 0xCA, 0x97, 0x77, 0x70,
+    0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D,
+    0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19,
+    0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x73, 0x9A, 0x77, 0x0D, 0x77, 0x0D,
+    0x76, 0x91, 0xC9, 0x09, 0x72, 0xD3, 0xAA, 0x72, 0xAE, 0xAD, 0x74, 0xAE, 0xA7, 0x77, 0x72, 0x9A,
+    0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91,
+    0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD,
+    0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA,
+    0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x79, 0x72, 0xD7, 0x2D, 0x72, 0x9C, 0xA7,
+    0x2A, 0x96, 0x9C, 0x4A, 0x4A, 0xCA, 0x1A, 0xC9, 0x49, 0xFC, 0xA6, 0x9A, 0xCA, 0x97, 0x77, 0x70,
+    0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29, 0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D,
+    0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC, 0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19,
+    0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F, 0x1F, 0x2E, 0x76, 0x73, 0xAD, 0xA7, 0x59, 0xC9, 0xD7,
+    0x69, 0x0D, 0x76, 0x9C, 0xA7, 0x5A, 0x09, 0xA7, 0x59, 0xCA, 0x19, 0xC7, 0x4F, 0xC9, 0x75, 0x9A,
+    0x97, 0x70, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D,
+    0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA,
+    0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7,
+    0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4, 0xFE, 0x79, 0x99, 0x70, 0xF9,
+    0x6A, 0xC0, 0x9C, 0xA7, 0x1A, 0xC7, 0x09, 0xD7, 0x19, 0xC7, 0xAA, 0x4A, 0x4D, 0x91, 0x9C, 0x94,
+    0x9F, 0xCA, 0x69, 0xAC, 0xA9, 0x77, 0x77, 0x09, 0xAD, 0xA0, 0x9C, 0x92, 0xAF, 0xF2, 0x9D, 0x91,
+    0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA, 0x1A, 0xC9, 0x39,
+    0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC, 0x90, 0xF1, 0xF2,
+    0xE7, 0x60, 0x71, 0x9D, 0x91, 0xA7, 0x29, 0xFA, 0xD7, 0x29, 0xC1, 0xAD, 0x77, 0x29, 0x72, 0xCA,
+    0x3A, 0xA7, 0x2E, 0xAA, 0xD7, 0x4F, 0xA7, 0x77, 0x72, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA,
+    0x74, 0x9C, 0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9,
+    0x2D, 0x97, 0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99,
+    0x9A, 0xD9, 0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9,
+    0x0F, 0xD4, 0xFE, 0x77, 0x1A, 0xDA, 0x1C, 0x49, 0xFE, 0x49, 0xC1, 0xE9, 0x77, 0x1A, 0xA4, 0xA4,
+    0xD9, 0x19, 0xCA, 0x49, 0xFD, 0x69, 0xAC, 0xA9, 0x77, 0x77, 0x09, 0xAD, 0xA0, 0x9C, 0x92, 0xAF,
+    0xF2, 0x9D, 0x91, 0xAD, 0xA2, 0xD4, 0xD9, 0x1D, 0xA4, 0xD2, 0xD4, 0x9D, 0x19, 0xCA, 0x4A, 0xCA,
+    0x1A, 0xC9, 0x39, 0xD9, 0x1D, 0x93, 0xE2, 0xD9, 0x2A, 0xE1, 0x9E, 0x1A, 0xC0, 0xD0, 0xDA, 0xFC,
+    0x90, 0xF1, 0xF2, 0xE7, 0x60, 0x71, 0x97, 0x70, 0x9C, 0xA2, 0x9C, 0x72, 0x9D, 0xA9, 0xAC, 0xA7,
+    0x3A, 0xFA, 0x75, 0x99, 0x97, 0x77, 0x73, 0x9A, 0x77, 0xAD, 0x77, 0xE9, 0x75, 0xFA, 0x74, 0x9C,
+    0x9A, 0xCA, 0x74, 0xD0, 0x9D, 0x73, 0x9C, 0x91, 0xD7, 0x3D, 0x2D, 0x97, 0x1A, 0xC9, 0x2D, 0x97,
+    0x1D, 0x3A, 0xCA, 0x70, 0xDA, 0x99, 0x99, 0xAD, 0x79, 0xFF, 0xD7, 0xD9, 0x99, 0x99, 0x9A, 0xD9,
+    0x5A, 0xCA, 0x6D, 0x95, 0xD7, 0xDA, 0x4A, 0xCA, 0x7E, 0x3A, 0xDA, 0x95, 0x9E, 0xA9, 0x0F, 0xD4,
+    0xFE, 0x77, 0x77, 0x75, 0xAC, 0x77, 0xAD, 0x97, 0x6E, 0x77, 0x0A, 0x71, 0x77, 0x1C, 0x93, 0xA4,
+    0x9D, 0x90, 0x9D, 0x5F, 0xD7, 0xAD, 0xA7, 0x77, 0x70, 0x9A, 0xDA, 0x09, 0xC9, 0x2A, 0xFF, 0x29,
+    0xD9, 0x1A, 0xDA, 0x2D, 0x4D, 0x91, 0xDA, 0x4D, 0x2D, 0x49, 0xD1, 0x9C, 0xA4, 0xAC, 0xA1, 0xAC,
+    0x93, 0x9D, 0x91, 0xD9, 0x3E, 0x2D, 0x92, 0xAE, 0x19, 0xE1, 0xAC, 0x0D, 0x0D, 0xAF, 0xC9, 0x0F,
+    0x1F, 0x2E, 0x77, 0x76, 0x9C, 0xA7, 0x1E, 0x71, 0xDA, 0x71, 0x99, 0x70, 0x39, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A,
+    0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97,
+    0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF,
+    0xF7, 0x77, 0x77, 0x3A, 0xC7, 0x5E, 0x97, 0x4E, 0x75, 0x99, 0x71, 0x76, 0x9A, 0xE4, 0xAC, 0xAA,
+    0xE2, 0xAC, 0x91, 0x9D, 0x19, 0xCA, 0x29, 0xD1, 0xD3, 0xD9, 0x09, 0xCA, 0x1A, 0xD9, 0x1A, 0xCA,
+    0xAE, 0x3F, 0xA9, 0x4D, 0x97, 0xD9, 0x49, 0x1E, 0x29, 0xD1, 0x9F, 0xE9, 0x2A, 0xFA, 0x77, 0x73,
+    0x9C, 0x97, 0xE6, 0x9D, 0x97, 0x97, 0x77, 0x72, 0xF7, 0x3D, 0x9A, 0xCA, 0x72, 0xC9, 0x09, 0xCA,
+    0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x5C, 0xA7, 0x77, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF,
+    0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75,
+    0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59,
+    0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x59, 0xAA, 0x6A,
+    0xF4, 0x9C, 0x90, 0xAC, 0x94, 0xA1, 0xD7, 0xD9, 0x6D, 0x97, 0xC9, 0x77, 0x74, 0x9A, 0xE4, 0xAC,
+    0xAA, 0xE2, 0xAC, 0x91, 0x9D, 0x19, 0xCA, 0x29, 0xD1, 0xD3, 0xD9, 0x09, 0xCA, 0x1A, 0xD9, 0x1A,
+    0xCA, 0xAE, 0x3F, 0xA9, 0x4D, 0x97, 0xD9, 0x49, 0x1E, 0x29, 0xD1, 0x9F, 0xE9, 0x2A, 0xFA, 0x76,
+    0x70, 0x99, 0x29, 0x71, 0xAE, 0x1C, 0x97, 0x0F, 0xE7, 0x09, 0xC1, 0xE9, 0x75, 0x97, 0x77, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5,
+    0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D,
+    0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF,
+    0xD9, 0x29, 0xFF, 0xF3, 0x77, 0xAD, 0x90, 0x9C, 0x39, 0xFA, 0xD3, 0xAC, 0x1E, 0x94, 0x92, 0x97,
+    0x77, 0x69, 0xAE, 0x5A, 0xCA, 0xAE, 0x3A, 0xC9, 0x19, 0xD2, 0x9C, 0xA2, 0x9D, 0x2D, 0x3D, 0x91,
+    0x9C, 0xA1, 0xAD, 0x92, 0xAC, 0xAA, 0xE4, 0xFA, 0x95, 0xD9, 0x70, 0xD9, 0x49, 0x2E, 0x29, 0xD2,
+    0x9F, 0xE9, 0x3A, 0xFA, 0x77, 0x00, 0x77, 0x0A, 0x77, 0x0A, 0xCA, 0x76, 0x9D, 0x74, 0x91, 0xCA,
+    0x73, 0xE9, 0x09, 0x73, 0xDA, 0xD9, 0x73, 0xD9, 0x1D, 0x73, 0xA3, 0x99, 0x79, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x96, 0xFF, 0xF7, 0x9D, 0xAA, 0xAA, 0xAA, 0xD7, 0x9D, 0x5C, 0xA7, 0xAD, 0x5C, 0x70,
+    0xAC, 0xA7, 0x7D, 0x97, 0x7D, 0x77, 0x9D, 0xAA, 0xAA, 0xAA, 0x71, 0xAF, 0xEA, 0x71, 0xDA, 0x77,
+    0xD9, 0x77, 0xD7, 0x79, 0xD5, 0x9C, 0x7A, 0xD5, 0xD7, 0xDA, 0x49, 0xCA, 0x59, 0xAF, 0xFD, 0x94,
+    0x9F, 0xFF, 0x50, 0x73, 0x99, 0x73, 0x9D, 0x73, 0xDA, 0x72, 0xAC, 0xA7, 0x3C, 0x97, 0x0D, 0xA7,
+    0x2F, 0xA7, 0x9D, 0x90, 0xD9, 0x59, 0xD9, 0x19, 0xC9, 0x69, 0x77, 0x75, 0x9A, 0xE7, 0x0A, 0xCA,
+    0xAE, 0x6A, 0xC9, 0x19, 0xD5, 0x9C, 0xA2, 0x9D, 0x5D, 0x3D, 0x94, 0x9C, 0xA1, 0xAD, 0x95, 0xAC,
+    0xAA, 0xE7, 0xFA, 0x97, 0x0D, 0x97, 0x3D, 0x94, 0x95, 0xE2, 0x9D, 0x59, 0xFE, 0x96, 0xAF, 0xA7,
+    0x76, 0x74, 0xA9, 0x76, 0xD7, 0x6A, 0xCA, 0x74, 0x90, 0xAC, 0x72, 0xE9, 0x09, 0x71, 0xDA, 0xD9,
+    0x71, 0xD9, 0x1D, 0x71, 0xA3, 0x99, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D,
+    0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD, 0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59,
+    0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD,
+    0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9, 0x29, 0xFF, 0xF3, 0x7A, 0x71, 0x9D, 0x71, 0xD9,
+    0x71, 0xD7, 0x2C, 0xA5, 0xDA, 0x7F, 0xA5, 0xD9, 0x0D, 0x93, 0xD9, 0x19, 0xC9, 0x39, 0x77, 0x79,
+    0xAE, 0x5A, 0xCA, 0xAE, 0x3A, 0xC9, 0x19, 0xD2, 0x9C, 0xA2, 0x9D, 0x2D, 0x3D, 0x91, 0x9C, 0xA1,
+    0xAD, 0x92, 0xAC, 0xAA, 0xE4, 0xFA, 0x95, 0xD9, 0x70, 0xD9, 0x49, 0x2E, 0x29, 0xD2, 0x9F, 0xE9,
+    0x3A, 0xFA, 0x77, 0x00, 0x75, 0x9D, 0xA7, 0x6C, 0xAA, 0xC9, 0x75, 0x90, 0xAC, 0x77, 0xD7, 0x3A,
+    0xD9, 0x0C, 0x73, 0xAC, 0xAD, 0x97, 0x3D, 0x91, 0xD7, 0x3A, 0x93, 0x97, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x6F, 0xFF, 0x79, 0xDA, 0xAA, 0xAA, 0xAD, 0x79, 0xD5, 0xCA, 0x7A, 0xD5, 0xC7, 0x0A,
+    0xCA, 0x77, 0xD9, 0x77, 0xD7, 0x79, 0xDA, 0xAA, 0xAA, 0xA7, 0x1A, 0xFE, 0xA7, 0x1D, 0xA7, 0x7D,
+    0x97, 0x7D, 0x77, 0x9D, 0x59, 0xC7, 0xAD, 0x5D, 0x7D, 0xA4, 0x9C, 0xA5, 0x9A, 0xFF, 0xD9, 0x49,
+    0xFF, 0xF5, 0x71, 0x9D, 0xA7, 0x1A, 0xCA, 0xD9, 0x70, 0xAA, 0x09, 0xC9, 0x72, 0x9D, 0x72, 0xAC,
+    0x97, 0xAA, 0xA0, 0x9A, 0x7F, 0xA7, 0x0D, 0xA0, 0xD9, 0x6D, 0x91, 0x9C, 0x96, 0x94, 0x97, 0x77,
+    0x9A, 0xE7, 0x0A, 0xCA, 0xAE, 0x6A, 0xC9, 0x19, 0xD5, 0x9C, 0xA2, 0x9D, 0x5D, 0x3D, 0x94, 0x9C,
+    0xA1, 0xAD, 0x95, 0xAC, 0xAA, 0xE7, 0xFA, 0x97, 0x0D, 0x97, 0x3D, 0x94, 0x95, 0xE2, 0x9D, 0x59,
+    0xFE, 0x96, 0xAF, 0xA7, 0x76, 0x70, 0xAC, 0xA1, 0xA9, 0x70, 0x9C, 0xAD, 0xAC, 0x97, 0x09, 0xA1,
+    0xDA, 0x77, 0x74, 0xE7, 0x4F, 0xA7, 0x2D, 0x90, 0xAC, 0x97, 0x09, 0xA3, 0xA6, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x4F, 0xFF, 0x59, 0xDA, 0xAA, 0xAA, 0xAD, 0x59, 0xD5, 0xCA, 0x5A, 0xD5, 0xC6,
+    0xAC, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0xAA, 0xAA, 0xAA, 0x7A, 0xFE, 0xA7, 0xDA, 0x75, 0xD9,
+    0x75, 0xD7, 0x59, 0xD5, 0x9C, 0x5A, 0xD5, 0xD5, 0xDA, 0x49, 0xCA, 0x39, 0xAF, 0xFD, 0x92, 0x9F,
+    0xFF, 0x30, 0x77, 0x9D, 0xA1, 0xA9, 0x3D, 0xAD, 0xAC, 0xA3, 0xC9, 0x09, 0xE7, 0x72, 0xAA, 0x97,
+    0xF9, 0x5D, 0x99, 0xD3, 0x9D, 0x91, 0x9C, 0x93, 0x94, 0x97, 0x71, 0x9A, 0xE5, 0xAC, 0xAA, 0xE3,
+    0xAC, 0x91, 0x9D, 0x29, 0xCA, 0x29, 0xD2, 0xD3, 0xD9, 0x19, 0xCA, 0x1A, 0xD9, 0x2A, 0xCA, 0xAE,
+    0x4F, 0xA9, 0x5D, 0x97, 0x0D, 0x94, 0x92, 0xE2, 0x9D, 0x29, 0xFE, 0x93, 0xAF, 0xA7, 0x70, 0x72,
+    0xAA, 0x75, 0xAE, 0x73, 0xAC, 0xAD, 0xA7, 0x1D, 0xA1, 0xD9, 0x7A, 0xC9, 0x3C, 0x77, 0x69, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xF5, 0x9D, 0xAA, 0xAA, 0xAA, 0xD5, 0x9D, 0x5C, 0xA5, 0xAD,
+    0x5C, 0x6A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xDA, 0xAA, 0xAA, 0xA7, 0xAF, 0xEA, 0x7D, 0xA7,
+    0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x59, 0xC5, 0xAD, 0x5D, 0x5D, 0xA4, 0x9C, 0xA3, 0x9A, 0xFF, 0xD9,
+    0x29, 0xFF, 0xF7, 0x77, 0x77, 0x3A, 0xC7, 0x5E, 0x97, 0x4E, 0x75, 0x99, 0x71, 0x77, 0x09, 0xD6,
+    0x9E, 0xA5, 0xD9, 0xD4, 0xD1, 0xAC, 0x92, 0xD9, 0x2C, 0xA7, 0x77, 0x19, 0xAE, 0x4A, 0xCA, 0xAE,
+    0x2A, 0xC9, 0x19, 0xD1, 0x9C, 0xA2, 0x9D, 0x1D, 0x3D, 0x90, 0x9C, 0xA1, 0xAD, 0x91, 0xAC, 0xAA,
+    0xE3, 0xFA, 0x94, 0xD9, 0x7D, 0x94, 0x91, 0xE2, 0x9D, 0x19, 0xFE, 0x92, 0xAF, 0xA7, 0x77, 0x39,
+    0xC9, 0x7E, 0x69, 0xD9, 0x79, 0x70, 0x77, 0x19, 0xF6, 0xD9, 0xD9, 0x5C, 0x1A, 0xC9, 0x7A, 0xCA,
+    0x7D, 0x71, 0xC9, 0x77, 0x29, 0x99, 0x99, 0x99, 0x4F, 0xDA, 0x59, 0xDA, 0x79, 0xD7, 0x0A, 0xD7,
+    0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x69, 0xAE, 0xA4, 0x9F, 0xD9, 0x30, 0x39, 0xAA, 0x4A, 0xF2, 0x9C,
+    0x90, 0xAC, 0x92, 0xA1, 0xD5, 0xD9, 0x4D, 0x95, 0xC9, 0x77, 0x5A, 0xE3, 0x9F, 0x6D, 0x59, 0xD5,
+    0xAC, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0x95, 0xD1, 0x92, 0x9D, 0x0D, 0x2A, 0xF3, 0x9D, 0xA7,
+    0x50, 0x39, 0x99, 0x99, 0x99, 0x3F, 0xDA, 0x49, 0xDA, 0x69, 0xD7, 0xAD, 0x7A, 0xCA, 0x7D, 0x97,
+    0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAD, 0x7D, 0xA5, 0x9A, 0xEA, 0x39,
+    0xFD, 0x97, 0x77, 0x2A, 0xC9, 0x69, 0xDA, 0x6A, 0xD9, 0x7A, 0x96, 0x74, 0xAD, 0x39, 0xE3, 0x9D,
+    0x97, 0x77, 0x1A, 0xE2, 0x9F, 0x5D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x39, 0xD4, 0xAD, 0x4D, 0x94,
+    0xD1, 0x91, 0x9D, 0x0D, 0x1A, 0xF2, 0x9D, 0xA7, 0x73, 0xAC, 0x93, 0x9D, 0xA3, 0xAD, 0x94, 0x95,
+    0x79, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D,
+    0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D,
+    0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD,
+    0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x39, 0xCA, 0x75, 0xE7, 0x49,
+    0xDA, 0x75, 0x99, 0x72, 0x77, 0x9A, 0xEA, 0x4A, 0xFD, 0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D,
+    0x94, 0xDA, 0x9D, 0x5D, 0x9A, 0xCA, 0x5D, 0x9D, 0x95, 0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1,
+    0xAD, 0x3D, 0xA1, 0x9E, 0xAA, 0xDA, 0x39, 0xFC, 0x97, 0x77, 0x59, 0xC9, 0x70, 0xE7, 0x9D, 0x97,
+    0x09, 0x70, 0x77, 0x70, 0x9F, 0x73, 0xD9, 0xD9, 0x72, 0xC1, 0xAC, 0x97, 0x4A, 0xCA, 0x74, 0xD7,
+    0x6C, 0x97, 0x77, 0x69, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2,
+    0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA,
+    0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1,
+    0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76, 0x69, 0xAA, 0x96,
+    0xAF, 0x59, 0xCA, 0x0A, 0xC9, 0x5A, 0x1D, 0x70, 0xAC, 0x97, 0xD9, 0x70, 0xC9, 0x77, 0x76, 0x9A,
+    0xEA, 0x4A, 0xFD, 0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D, 0x9A, 0xCA,
+    0x5D, 0x9D, 0x95, 0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E, 0xAA, 0xDA,
+    0x39, 0xFC, 0x97, 0x70, 0x77, 0xA7, 0x7D, 0x97, 0x5A, 0xCA, 0x72, 0x91, 0x9C, 0xA7, 0x2E, 0x90,
+    0x97, 0x2D, 0xAD, 0x72, 0x9D, 0x19, 0xCA, 0x71, 0x9A, 0x39, 0x74, 0x9A, 0xA9, 0x72, 0x9F, 0xEA,
+    0x7E, 0xA9, 0x99, 0xAE, 0x5E, 0x59, 0xDA, 0x3E, 0x7E, 0x29, 0xD7, 0x09, 0xD9, 0x1D, 0xA7, 0x1D,
+    0x90, 0x9D, 0x72, 0xD9, 0x0A, 0xD7, 0x2D, 0x90, 0xDA, 0x71, 0x9D, 0x1D, 0xA7, 0x1A, 0xD1, 0xDA,
+    0x71, 0xDA, 0x1D, 0xA7, 0x09, 0xD2, 0xE7, 0x0D, 0xA2, 0x9D, 0x96, 0xAD, 0x4E, 0x93, 0x9E, 0x6F,
+    0xAA, 0xF7, 0x0A, 0xFC, 0xA9, 0x77, 0x70, 0x74, 0x99, 0x75, 0xD7, 0x4D, 0xA7, 0x3A, 0xCA, 0x74,
+    0xC9, 0x71, 0xDA, 0x73, 0xFA, 0x71, 0xDA, 0x0D, 0x97, 0xD9, 0x2C, 0xA7, 0x97, 0x77, 0x69, 0xAE,
+    0xA7, 0x0A, 0xFD, 0xA6, 0xE2, 0x9D, 0x5A, 0xD4, 0xD9, 0x4D, 0x94, 0xDA, 0x39, 0xD5, 0xD9, 0x3A,
+    0xCA, 0x5D, 0x93, 0xD9, 0x5D, 0x4D, 0x94, 0xAC, 0xA4, 0xDA, 0x4D, 0x5A, 0xD3, 0xDA, 0x59, 0xEA,
+    0xAD, 0xA7, 0x9F, 0xC9, 0x77, 0x70, 0x73, 0xA7, 0x69, 0xD7, 0x6D, 0x97, 0x6D, 0x72, 0xE9, 0x09,
+    0x71, 0xDA, 0xD7, 0x19, 0xD1, 0x9C, 0xA7, 0x09, 0xA3, 0x97, 0x39, 0xAA, 0x97, 0x19, 0xFE, 0xA6,
+    0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7, 0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9,
+    0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71, 0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA,
+    0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7,
+    0xAF, 0xCA, 0x97, 0x76, 0x70, 0xA7, 0x29, 0xD7, 0x2D, 0x97, 0x2D, 0x73, 0xCA, 0x6D, 0xA7, 0x0F,
+    0xA6, 0xDA, 0x0D, 0x94, 0xD9, 0x2C, 0xA4, 0x97, 0x77, 0x09, 0xAE, 0xA5, 0xAF, 0xDA, 0x3E, 0x29,
+    0xD2, 0xAD, 0x4D, 0x91, 0xD9, 0x4D, 0xA0, 0x9D, 0x5D, 0x90, 0xAC, 0xA5, 0xD9, 0x0D, 0x95, 0xD1,
+    0xD9, 0x4A, 0xCA, 0x1D, 0xA4, 0xD2, 0xAD, 0x3D, 0xA2, 0x9E, 0xAA, 0xDA, 0x49, 0xFC, 0x97, 0x71,
+    0x74, 0x9D, 0xA7, 0x49, 0xC9, 0xAC, 0x75, 0x90, 0xAC, 0x76, 0xCA, 0x72, 0xE0, 0x9C, 0x72, 0xDA,
+    0xD7, 0x3D, 0x90, 0x9D, 0x71, 0x9A, 0x39, 0x97, 0x39, 0xAA, 0x97, 0x29, 0xFE, 0xA7, 0xEA, 0x99,
+    0x9A, 0xE5, 0xE5, 0x9D, 0xA3, 0xE7, 0xE2, 0x9D, 0x70, 0x9D, 0x91, 0xDA, 0x71, 0xD9, 0x09, 0xD7,
+    0x2D, 0x90, 0xAD, 0x72, 0xD9, 0x0D, 0xA7, 0x19, 0xD1, 0xDA, 0x71, 0xAD, 0x1D, 0xA7, 0x1D, 0xA1,
+    0xDA, 0x70, 0x9D, 0x2E, 0x70, 0xDA, 0x29, 0xD9, 0x6A, 0xD4, 0xE9, 0x39, 0xE6, 0xFA, 0xAF, 0x70,
+    0xAF, 0xCA, 0x97, 0x77, 0x00, 0x72, 0x9D, 0xA7, 0x2A, 0xCA, 0xD9, 0x71, 0xAA, 0x09, 0xC9, 0x73,
+    0x9D, 0x73, 0xAC, 0x97, 0x0A, 0xAA, 0x09, 0xA7, 0x0F, 0xA7, 0x1D, 0xA0, 0xD9, 0x7D, 0x91, 0x9C,
+    0xA7, 0x94, 0x97, 0x77, 0x09, 0xAE, 0xA7, 0x0A, 0xFD, 0xA6, 0xE2, 0x9D, 0x5A, 0xD4, 0xD9, 0x4D,
+    0x94, 0xDA, 0x39, 0xD5, 0xD9, 0x3A, 0xCA, 0x5D, 0x93, 0xD9, 0x5D, 0x4D, 0x94, 0xAC, 0xA4, 0xDA,
+    0x4D, 0x5A, 0xD3, 0xDA, 0x59, 0xEA, 0xAD, 0xA7, 0x9F, 0xC9, 0x77, 0x70, 0x7A, 0xCA, 0x1C, 0x71,
+    0xAF, 0xAC, 0x71, 0xA9, 0x09, 0xDA, 0x77, 0x74, 0xDA, 0x73, 0x9F, 0xA7, 0x19, 0xD1, 0xD7, 0x1A,
+    0xA3, 0x97, 0x39, 0xAA, 0x97, 0x19, 0xFE, 0xA6, 0xEA, 0x99, 0x9A, 0xE4, 0xE5, 0x9D, 0xA2, 0xE7,
+    0xE1, 0x9D, 0x70, 0x9D, 0x90, 0xDA, 0x71, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xD9, 0xDA, 0x71,
+    0x9D, 0x0D, 0xA7, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0D, 0xA7, 0x09, 0xD1, 0xE7, 0x0D, 0xA1, 0x9D,
+    0x96, 0xAD, 0x3E, 0x93, 0x9E, 0x5F, 0xAA, 0xF7, 0xAF, 0xCA, 0x97, 0x76, 0x77, 0x19, 0xDA, 0x1A,
+    0x94, 0xDA, 0xDA, 0xCA, 0x4C, 0x90, 0x9E, 0x77, 0x4A, 0xA9, 0x70, 0xF9, 0x6D, 0x99, 0xD4, 0x9D,
+    0x91, 0x9C, 0x94, 0x94, 0x97, 0x72, 0x9A, 0xEA, 0x5A, 0xFD, 0xA3, 0xE2, 0x9D, 0x2A, 0xD4, 0xD9,
+    0x1D, 0x94, 0xDA, 0x09, 0xD5, 0xD9, 0x0A, 0xCA, 0x5D, 0x90, 0xD9, 0x5D, 0x1D, 0x94, 0xAC, 0xA1,
+    0xDA, 0x4D, 0x2A, 0xD3, 0xDA, 0x29, 0xEA, 0xAD, 0xA4, 0x9F, 0xC9, 0x77, 0x10, 0x71, 0xAA, 0x75,
+    0xEA, 0x73, 0xDA, 0xD9, 0x71, 0xD9, 0x09, 0xD7, 0x0D, 0x92, 0x9C, 0x77, 0x73, 0x9A, 0xA9, 0x71,
+    0x9F, 0xEA, 0x6E, 0xA9, 0x99, 0xAE, 0x4E, 0x59, 0xDA, 0x2E, 0x7E, 0x19, 0xD7, 0x09, 0xD9, 0x0D,
+    0xA7, 0x1D, 0x99, 0xD7, 0x2D, 0x9A, 0xD7, 0x2D, 0x9D, 0xA7, 0x19, 0xD0, 0xDA, 0x71, 0xAD, 0x0D,
+    0xA7, 0x1D, 0xA0, 0xDA, 0x70, 0x9D, 0x1E, 0x70, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE9, 0x39, 0xE5,
+    0xFA, 0xAF, 0x7A, 0xFC, 0xA9, 0x77, 0x77, 0x73, 0x9C, 0xA7, 0x5E, 0x74, 0x9D, 0xA7, 0x59, 0x97,
+    0x20, 0x77, 0x29, 0xD7, 0x0E, 0xA6, 0xD9, 0xD5, 0xD9, 0x0A, 0xC9, 0x3D, 0x92, 0xCA, 0x77, 0x73,
+    0x9A, 0xEA, 0x4A, 0xFD, 0xA2, 0xE2, 0x9D, 0x1A, 0xD4, 0xD9, 0x0D, 0x94, 0xDA, 0x9D, 0x5D, 0x9A,
+    0xCA, 0x5D, 0x9D, 0x95, 0xD0, 0xD9, 0x4A, 0xCA, 0x0D, 0xA4, 0xD1, 0xAD, 0x3D, 0xA1, 0x9E, 0xAA,
+    0xDA, 0x39, 0xFC, 0x97, 0x77, 0x59, 0xC9, 0x70, 0xE7, 0x9D, 0x97, 0x09, 0x70, 0x73, 0xA7, 0x7A,
+    0xD7, 0x59, 0xF7, 0x49, 0xEA, 0x49, 0x96, 0xA9, 0x6A, 0xD7, 0x7D, 0xA7, 0x9A, 0xA9, 0x29, 0xD5,
+    0x9F, 0xEA, 0x9D, 0x94, 0xEA, 0x99, 0x9A, 0xF5, 0xE5, 0x9D, 0xA4, 0xE7, 0xE3, 0x9D, 0x70, 0x9D,
+    0x92, 0xDA, 0x71, 0xD9, 0x19, 0xD7, 0x2D, 0x91, 0xAD, 0x72, 0xD9, 0x1D, 0xA7, 0x19, 0xD2, 0xDA,
+    0x71, 0xAD, 0x2D, 0xA7, 0x1D, 0xA2, 0xDA, 0x70, 0x9D, 0x3E, 0x70, 0xDA, 0x39, 0xD9, 0x6A, 0xD5,
+    0xE9, 0x39, 0xE7, 0xFA, 0xAF, 0x71, 0xAF, 0xCA, 0x97, 0x77, 0x20, 0x77, 0x5A, 0xC9, 0x71, 0x9D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x2C, 0x92, 0x9A, 0x97, 0x2A, 0xCA, 0x72, 0xD9, 0x39, 0xAE, 0xAA,
+    0xCA, 0x3A, 0xFE, 0x93, 0xE2, 0x9D, 0x3A, 0xD4, 0xD9, 0x2D, 0x94, 0xDA, 0x19, 0xD5, 0xDA, 0x1A,
+    0xCA, 0x5D, 0x91, 0xD9, 0x49, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0xA4, 0xD3, 0xAD, 0x3D, 0xA3, 0x9E,
+    0xAA, 0xDA, 0x59, 0xFC, 0x97, 0x73, 0x69, 0x77, 0x0A, 0xCA, 0x77, 0xAD, 0xA7, 0x7A, 0xE5, 0x99,
+    0x70, 0x9A, 0x4A, 0xD7, 0x7D, 0xA7, 0x9A, 0xA9, 0x29, 0xD5, 0x9F, 0xEA, 0x9D, 0x94, 0xEA, 0x99,
+    0x9A, 0xF5, 0xE5, 0x9D, 0xA4, 0xE7, 0xE3, 0x9D, 0x70, 0x9D, 0x92, 0xDA, 0x71, 0xD9, 0x19, 0xD7,
+    0x2D, 0x91, 0xAD, 0x72, 0xD9, 0x1D, 0xA7, 0x19, 0xD2, 0xDA, 0x71, 0xAD, 0x2D, 0xA7, 0x1D, 0xA2,
+    0xDA, 0x70, 0x9D, 0x3E, 0x70, 0xDA, 0x39, 0xD9, 0x6A, 0xD5, 0xE9, 0x39, 0xE7, 0xFA, 0xAF, 0x71,
+    0xAF, 0xCA, 0x97, 0x77, 0x20, 0x77, 0x19, 0xC7, 0x3D, 0xA7, 0x2A, 0xD7, 0x3A, 0xD7, 0x39, 0xC9,
+    0x19, 0xA9, 0x72, 0xAC, 0xA7, 0x2D, 0x93, 0x9A, 0xEA, 0xAC, 0xA3, 0xAF, 0xE9, 0x3E, 0x29, 0xD3,
+    0xAD, 0x4D, 0x92, 0xD9, 0x4D, 0xA1, 0x9D, 0x5D, 0xA1, 0xAC, 0xA5, 0xD9, 0x1D, 0x94, 0x9D, 0x2D,
+    0x94, 0xAC, 0xA2, 0xDA, 0x4D, 0x3A, 0xD3, 0xDA, 0x39, 0xEA, 0xAD, 0xA5, 0x9F, 0xC9, 0x77, 0x30,
+    0x77, 0x72, 0xF7, 0x5D, 0x9A, 0xCA, 0x74, 0xC9, 0x09, 0xCA, 0x76, 0xAC, 0xA7, 0x6D, 0x95, 0x99,
+    0x7C, 0xA5, 0xAD, 0x77, 0xDA, 0x79, 0xAA, 0x92, 0x9D, 0x59, 0xFE, 0xA9, 0xD9, 0x4E, 0xA9, 0x99,
+    0xAF, 0x5E, 0x59, 0xDA, 0x4E, 0x7E, 0x39, 0xD7, 0x09, 0xD9, 0x2D, 0xA7, 0x1D, 0x91, 0x9D, 0x72,
+    0xD9, 0x1A, 0xD7, 0x2D, 0x91, 0xDA, 0x71, 0x9D, 0x2D, 0xA7, 0x1A, 0xD2, 0xDA, 0x71, 0xDA, 0x2D,
+    0xA7, 0x09, 0xD3, 0xE7, 0x0D, 0xA3, 0x9D, 0x96, 0xAD, 0x5E, 0x93, 0x9E, 0x7F, 0xAA, 0xF7, 0x1A,
+    0xFC, 0xA9, 0x77, 0x72, 0x59, 0xAA, 0x97, 0x0A, 0xF7, 0x9C, 0xA0, 0xAC, 0x97, 0xA1, 0xD7, 0x2A,
+    0xC9, 0x71, 0xD9, 0x72, 0xC9, 0x29, 0xA9, 0x72, 0xAC, 0xA7, 0x2D, 0x93, 0x9A, 0xEA, 0xAC, 0xA3,
+    0xAF, 0xE9, 0x3E, 0x29, 0xD3, 0xAD, 0x4D, 0x92, 0xD9, 0x4D, 0xA1, 0x9D, 0x5D, 0xA1, 0xAC, 0xA5,
+    0xD9, 0x1D, 0x94, 0x9D, 0x2D, 0x94, 0xAC, 0xA2, 0xDA, 0x4D, 0x3A, 0xD3, 0xDA, 0x39, 0xEA, 0xAD,
+    0xA5, 0x9F, 0xC9, 0x77, 0x30, 0x69, 0x92, 0x97, 0x3A, 0xE1, 0xC9, 0x72, 0xFE, 0x72, 0x9C, 0x1E,
+    0x93, 0x99, 0x77, 0xAD, 0x77, 0xDA, 0x79, 0xAA, 0x92, 0x9D, 0x59, 0xFE, 0xA9, 0xD9, 0x4E, 0xA9,
+    0x99, 0xAF, 0x5E, 0x59, 0xDA, 0x4E, 0x7E, 0x39, 0xD7, 0x09, 0xD9, 0x2D, 0xA7, 0x1D, 0x91, 0x9D,
+    0x72, 0xD9, 0x1A, 0xD7, 0x2D, 0x91, 0xDA, 0x71, 0x9D, 0x2D, 0xA7, 0x1A, 0xD2, 0xDA, 0x71, 0xDA,
+    0x2D, 0xA7, 0x09, 0xD3, 0xE7, 0x0D, 0xA3, 0x9D, 0x96, 0xAD, 0x5E, 0x93, 0x9E, 0x7F, 0xAA, 0xF7,
+    0x1A, 0xFC, 0xA9, 0x77, 0x72, 0x77, 0x1A, 0xDA, 0x09, 0xC5, 0x9F, 0xAD, 0x5A, 0xC1, 0xE9, 0x69,
+    0x29, 0x19, 0xA9, 0x72, 0xAC, 0xA7, 0x2D, 0x93, 0x9A, 0xEA, 0xAC, 0xA3, 0xAF, 0xE9, 0x3E, 0x29,
+    0xD3, 0xAD, 0x4D, 0x92, 0xD9, 0x4D, 0xA1, 0x9D, 0x5D, 0xA1, 0xAC, 0xA5, 0xD9, 0x1D, 0x94, 0x9D,
+    0x2D, 0x94, 0xAC, 0xA2, 0xDA, 0x4D, 0x3A, 0xD3, 0xDA, 0x39, 0xEA, 0xAD, 0xA5, 0x9F, 0xC9, 0x77,
+    0x30, 0x77, 0x09, 0x97, 0x7A, 0xD7, 0x7D, 0xA7, 0x9A, 0xA9, 0x29, 0xD5, 0x9F, 0xEA, 0x9D, 0x94,
+    0xEA, 0x99, 0x9A, 0xF5, 0xE5, 0x9D, 0xA4, 0xE7, 0xE3, 0x9D, 0x70, 0x9D, 0x92, 0xDA, 0x71, 0xD9,
+    0x19, 0xD7, 0x2D, 0x91, 0xAD, 0x72, 0xD9, 0x1D, 0xA7, 0x19, 0xD2, 0xDA, 0x71, 0xAD, 0x2D, 0xA7,
+    0x1D, 0xA2, 0xDA, 0x70, 0x9D, 0x3E, 0x70, 0xDA, 0x39, 0xD9, 0x6A, 0xD5, 0xE9, 0x39, 0xE7, 0xFA,
+    0xAF, 0x71, 0xAF, 0xCA, 0x97, 0x77, 0x77, 0x71, 0x9C, 0xA7, 0x7E, 0x76, 0x9D, 0xA7, 0x79, 0x97,
+    0x40, 0x72, 0x9A, 0x97, 0x2A, 0xCA, 0x72, 0xD9, 0x39, 0xAE, 0xAA, 0xCA, 0x3A, 0xFE, 0x93, 0xE2,
+    0x9D, 0x3A, 0xD4, 0xD9, 0x2D, 0x94, 0xDA, 0x19, 0xD5, 0xDA, 0x1A, 0xCA, 0x5D, 0x91, 0xD9, 0x49,
+    0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0xA4, 0xD3, 0xAD, 0x3D, 0xA3, 0x9E, 0xAA, 0xDA, 0x59, 0xFC, 0x97,
+    0x77, 0x73, 0x9C, 0x97, 0x2E, 0x71, 0x9D, 0x97, 0x29, 0x72, 0x09, 0x99, 0x99, 0x94, 0x99, 0x99,
+    0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4,
+    0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9,
+    0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6,
+    0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77, 0x77, 0x77, 0x9C, 0xA7, 0x6E, 0x75, 0x9D, 0xA7, 0x69, 0x97,
+    0x30, 0x0A, 0xE4, 0x9C, 0xA0, 0xAF, 0x4D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0x9C,
+    0xA3, 0xD9, 0x3D, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xAD, 0x3D, 0x92, 0x9D, 0xA3, 0xD9, 0x2C, 0xAC,
+    0xA3, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x0F, 0xD0, 0x9F, 0x19, 0xEA, 0x2D, 0xA7, 0x77, 0x71, 0xAC,
+    0x97, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x29, 0x70, 0x77, 0x71, 0x9E, 0xA7, 0x39, 0xCA, 0x9D, 0x97,
+    0x29, 0xC1, 0xD7, 0x6D, 0x97, 0x49, 0xD7, 0x7C, 0x97, 0x77, 0x19, 0x99, 0x99, 0x94, 0x99, 0x99,
+    0x99, 0x9F, 0xD3, 0x9F, 0xCA, 0x09, 0xAD, 0x95, 0x9D, 0xA3, 0xAC, 0xA7, 0xD9, 0x3D, 0xA7, 0xD4,
+    0xD9, 0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0xAD, 0x7A, 0xC9, 0x3A, 0xCA, 0x7D, 0x4D, 0x97, 0xD4, 0xD9,
+    0x7D, 0x39, 0xD7, 0x9C, 0xA3, 0x9D, 0x7A, 0xC9, 0x3A, 0xD7, 0xD4, 0x9D, 0x6D, 0xA5, 0xE4, 0xE6,
+    0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x77, 0x71, 0x7A, 0xA9, 0x70, 0xAF, 0x97, 0xCA, 0x0A, 0xCA, 0x7A,
+    0x1A, 0xC9, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x2C, 0xA7, 0x77, 0x71, 0xAE, 0x49, 0xCA, 0x0A, 0xF4,
+    0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x3A, 0xCA, 0x39, 0xCA, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x3A,
+    0xCA, 0x3A, 0xD3, 0xD9, 0x29, 0xDA, 0x3D, 0x92, 0xCA, 0xCA, 0x3D, 0x91, 0xD9, 0xCA, 0x9C, 0x90,
+    0xFD, 0x09, 0xF1, 0x9E, 0xA2, 0xDA, 0x77, 0x73, 0x99, 0x77, 0x0A, 0xD7, 0x6A, 0xEA, 0x75, 0xF9,
+    0x39, 0x97, 0x0A, 0x95, 0x9D, 0x77, 0x09, 0xD1, 0x99, 0x99, 0x99, 0x49, 0x99, 0xAD, 0x90, 0x9F,
+    0xD3, 0x9F, 0xC9, 0x29, 0xAD, 0x95, 0x9D, 0xA5, 0xAC, 0xA7, 0xD9, 0x5D, 0xA7, 0xD6, 0xD9, 0x7D,
+    0x59, 0xD7, 0x9C, 0xA5, 0xAD, 0x7A, 0xC9, 0x5A, 0xCA, 0x7D, 0x6D, 0x97, 0xD6, 0xD9, 0x7D, 0x59,
+    0xD7, 0x9C, 0xA5, 0x9D, 0x7A, 0xC9, 0x5A, 0xD7, 0xD6, 0x9D, 0x6D, 0xA7, 0xE4, 0xE7, 0x0A, 0xFF,
+    0xC7, 0x29, 0xFD, 0x97, 0x77, 0x50, 0x77, 0x70, 0x9C, 0x97, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xCA,
+    0x74, 0xC9, 0x39, 0xA9, 0x74, 0xAC, 0xA7, 0x39, 0xD9, 0x0A, 0xE4, 0x9E, 0x90, 0xAF, 0x4D, 0xA5,
+    0xD4, 0xD9, 0x49, 0xD3, 0x9D, 0x5A, 0xCA, 0x39, 0xCA, 0x5D, 0x93, 0xD9, 0x5D, 0x4D, 0x5A, 0xCA,
+    0x3A, 0xD5, 0xD9, 0x29, 0xDA, 0x5D, 0x92, 0xCA, 0xCA, 0x5D, 0x91, 0xD9, 0xCA, 0x9C, 0x92, 0xFD,
+    0x09, 0xF3, 0x9E, 0xA2, 0xDA, 0x77, 0x30, 0x69, 0x77, 0x2D, 0x97, 0x70, 0xE9, 0x77, 0x0A, 0xD9,
+    0x49, 0x97, 0x29, 0x93, 0x9D, 0x77, 0x09, 0xD1, 0x99, 0x99, 0x99, 0x49, 0x99, 0xAD, 0x90, 0x9F,
+    0xD3, 0x9F, 0xC9, 0x29, 0xAD, 0x95, 0x9D, 0xA5, 0xAC, 0xA7, 0xD9, 0x5D, 0xA7, 0xD6, 0xD9, 0x7D,
+    0x59, 0xD7, 0x9C, 0xA5, 0xAD, 0x7A, 0xC9, 0x5A, 0xCA, 0x7D, 0x6D, 0x97, 0xD6, 0xD9, 0x7D, 0x59,
+    0xD7, 0x9C, 0xA5, 0x9D, 0x7A, 0xC9, 0x5A, 0xD7, 0xD6, 0x9D, 0x6D, 0xA7, 0xE4, 0xE7, 0x0A, 0xFF,
+    0xC7, 0x29, 0xFD, 0x97, 0x77, 0x50, 0x77, 0x49, 0xC7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x9D, 0x75,
+    0x9C, 0x92, 0x9A, 0x97, 0x4A, 0xCA, 0x73, 0x9D, 0x90, 0xAE, 0x49, 0xE9, 0x0A, 0xF4, 0xDA, 0x5D,
+    0x4D, 0x94, 0x9D, 0x39, 0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x95, 0xD4, 0xD5, 0xAC, 0xA3,
+    0xAD, 0x5D, 0x92, 0x9D, 0xA5, 0xD9, 0x2C, 0xAC, 0xA5, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x2F, 0xD0,
+    0x9F, 0x39, 0xEA, 0x2D, 0xA7, 0x73, 0x77, 0x73, 0x9E, 0xA7, 0x59, 0xCA, 0x9D, 0x97, 0x49, 0xC1,
+    0xD7, 0x70, 0xD9, 0x76, 0x9D, 0x59, 0x97, 0x1C, 0x94, 0x9D, 0x77, 0x09, 0xD1, 0x99, 0x99, 0x99,
+    0x49, 0x99, 0xAD, 0x90, 0x9F, 0xD3, 0x9F, 0xC9, 0x29, 0xAD, 0x95, 0x9D, 0xA5, 0xAC, 0xA7, 0xD9,
+    0x5D, 0xA7, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0xAD, 0x7A, 0xC9, 0x5A, 0xCA, 0x7D, 0x6D,
+    0x97, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0x9D, 0x7A, 0xC9, 0x5A, 0xD7, 0xD6, 0x9D, 0x6D,
+    0xA7, 0xE4, 0xE7, 0x0A, 0xFF, 0xC7, 0x29, 0xFD, 0x97, 0x77, 0x50, 0x7A, 0xA9, 0x72, 0xAF, 0x97,
+    0x1C, 0xA0, 0xAC, 0xA7, 0x1A, 0x1A, 0xC9, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x4C, 0xA3, 0x9A, 0x97,
+    0x4A, 0xCA, 0x73, 0x9D, 0x90, 0xAE, 0x49, 0xE9, 0x0A, 0xF4, 0xDA, 0x5D, 0x4D, 0x94, 0x9D, 0x39,
+    0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x95, 0xD4, 0xD5, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0x9D,
+    0xA5, 0xD9, 0x2C, 0xAC, 0xA5, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x2F, 0xD0, 0x9F, 0x39, 0xEA, 0x2D,
+    0xA7, 0x73, 0x79, 0x97, 0x70, 0xEA, 0x0A, 0xC7, 0x3A, 0xCA, 0xFC, 0x73, 0xAA, 0x1E, 0x39, 0x97,
+    0x70, 0x9D, 0x77, 0x09, 0xD1, 0x99, 0x99, 0x99, 0x49, 0x99, 0xAD, 0x90, 0x9F, 0xD3, 0x9F, 0xC9,
+    0x29, 0xAD, 0x95, 0x9D, 0xA5, 0xAC, 0xA7, 0xD9, 0x5D, 0xA7, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C,
+    0xA5, 0xAD, 0x7A, 0xC9, 0x5A, 0xCA, 0x7D, 0x6D, 0x97, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5,
+    0x9D, 0x7A, 0xC9, 0x5A, 0xD7, 0xD6, 0x9D, 0x6D, 0xA7, 0xE4, 0xE7, 0x0A, 0xFF, 0xC7, 0x29, 0xFD,
+    0x97, 0x77, 0x50, 0x77, 0x49, 0xDA, 0x1C, 0x70, 0xFA, 0xD7, 0x9C, 0x1E, 0xA7, 0x09, 0x29, 0x91,
+    0x9A, 0x97, 0x4A, 0xCA, 0x73, 0x9D, 0x90, 0xAE, 0x49, 0xE9, 0x0A, 0xF4, 0xDA, 0x5D, 0x4D, 0x94,
+    0x9D, 0x39, 0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x95, 0xD4, 0xD5, 0xAC, 0xA3, 0xAD, 0x5D,
+    0x92, 0x9D, 0xA5, 0xD9, 0x2C, 0xAC, 0xA5, 0xD9, 0x1D, 0x9C, 0xA9, 0xC9, 0x2F, 0xD0, 0x9F, 0x39,
+    0xEA, 0x2D, 0xA7, 0x73, 0x77, 0x09, 0x97, 0x70, 0x9D, 0x77, 0x09, 0xD1, 0x99, 0x99, 0x99, 0x49,
+    0x99, 0xAD, 0x90, 0x9F, 0xD3, 0x9F, 0xC9, 0x29, 0xAD, 0x95, 0x9D, 0xA5, 0xAC, 0xA7, 0xD9, 0x5D,
+    0xA7, 0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0xAD, 0x7A, 0xC9, 0x5A, 0xCA, 0x7D, 0x6D, 0x97,
+    0xD6, 0xD9, 0x7D, 0x59, 0xD7, 0x9C, 0xA5, 0x9D, 0x7A, 0xC9, 0x5A, 0xD7, 0xD6, 0x9D, 0x6D, 0xA7,
+    0xE4, 0xE7, 0x0A, 0xFF, 0xC7, 0x29, 0xFD, 0x97, 0x77, 0x77, 0x75, 0x9C, 0xA7, 0x70, 0xE7, 0x79,
+    0xDA, 0x77, 0x09, 0x97, 0x50, 0x74, 0x9A, 0x97, 0x4A, 0xCA, 0x73, 0x9D, 0x90, 0xAE, 0x49, 0xE9,
+    0x0A, 0xF4, 0xDA, 0x5D, 0x4D, 0x94, 0x9D, 0x39, 0xD5, 0xAC, 0xA3, 0x9C, 0xA5, 0xD9, 0x3D, 0x95,
+    0xD4, 0xD5, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0x9D, 0xA5, 0xD9, 0x2C, 0xAC, 0xA5, 0xD9, 0x1D, 0x9C,
+    0xA9, 0xC9, 0x2F, 0xD0, 0x9F, 0x39, 0xEA, 0x2D, 0xA7, 0x77, 0x77, 0xAC, 0x97, 0x39, 0xDA, 0x73,
+    0xAD, 0x97, 0x49, 0x72, 0x6A, 0x76, 0x9D, 0x75, 0x9E, 0x75, 0x9E, 0x76, 0x9A, 0x77, 0x79, 0x99,
+    0x99, 0x93, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD, 0x5A,
+    0xCA, 0x5D, 0x93, 0x9D, 0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A, 0xD0,
+    0xD7, 0x3F, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74, 0xAE,
+    0xAA, 0x71, 0xFE, 0x70, 0x77, 0x7C, 0x75, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x5C, 0xA7, 0x77,
+    0x77, 0x9D, 0xA3, 0x9D, 0x39, 0xF4, 0xDA, 0x5D, 0xA3, 0xAC, 0xA5, 0xAD, 0x3A, 0xC9, 0x6D, 0x3D,
+    0x7D, 0x92, 0xD7, 0xAC, 0x91, 0x9C, 0x97, 0xAC, 0xA1, 0xD7, 0x09, 0xCA, 0x09, 0xC9, 0x70, 0x9C,
+    0xA0, 0xD7, 0x2C, 0xAA, 0xC7, 0x29, 0xCA, 0xC9, 0x72, 0x9D, 0xA7, 0x3A, 0xD7, 0x4D, 0x73, 0x9D,
+    0x70, 0xA9, 0x9A, 0xD7, 0x1F, 0xA7, 0x2A, 0xCA, 0x97, 0x20, 0x09, 0x99, 0x99, 0x93, 0x99, 0x99,
+    0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD, 0x5A, 0xCA, 0x5D, 0x93, 0x9D,
+    0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A, 0xD0, 0xD7, 0x3F, 0x74, 0xAD,
+    0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74, 0xAE, 0xAA, 0x71, 0xFE, 0x77,
+    0x77, 0x74, 0x9C, 0xA7, 0x5E, 0x75, 0xE7, 0x59, 0x97, 0x30, 0x77, 0x39, 0xDA, 0x39, 0xD3, 0x9F,
+    0x4D, 0xA5, 0xDA, 0x3A, 0xCA, 0x5A, 0xD3, 0xAC, 0x96, 0xD3, 0xD7, 0xD9, 0x2D, 0x7A, 0xC9, 0x19,
+    0xC9, 0x7A, 0xCA, 0x1D, 0x70, 0x9C, 0xA0, 0x9C, 0x97, 0x09, 0xCA, 0x0D, 0x72, 0xCA, 0xAC, 0x72,
+    0x9C, 0xAC, 0x97, 0x29, 0xDA, 0x73, 0xAD, 0x74, 0xD7, 0x39, 0xD4, 0xAC, 0x1A, 0x99, 0xAD, 0x4E,
+    0x90, 0xFA, 0x5E, 0x1A, 0xCA, 0x97, 0x91, 0x77, 0x70, 0xAE, 0x97, 0x2A, 0xC9, 0xAD, 0x72, 0xAA,
+    0x1D, 0x74, 0x9D, 0x74, 0xAC, 0x97, 0x5A, 0xC7, 0x77, 0x09, 0x99, 0x99, 0x93, 0x99, 0x99, 0x90,
+    0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD, 0x5A, 0xCA, 0x5D, 0x93, 0x9D, 0x6A,
+    0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A, 0xD0, 0xD7, 0x3F, 0x74, 0xAD, 0x97,
+    0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74, 0xAE, 0xAA, 0x71, 0xFE, 0x70, 0x71,
+    0x9A, 0x97, 0x29, 0xFA, 0x71, 0xD1, 0xD7, 0x1A, 0x90, 0x9C, 0xA7, 0x39, 0xD7, 0x3A, 0xCA, 0x74,
+    0xAC, 0x77, 0x77, 0x70, 0x9D, 0xA3, 0x9D, 0x39, 0xF4, 0xDA, 0x5D, 0xA3, 0xAC, 0xA5, 0xAD, 0x3A,
+    0xC9, 0x6D, 0x3D, 0x7D, 0x92, 0xD7, 0xAC, 0x91, 0x9C, 0x97, 0xAC, 0xA1, 0xD7, 0x09, 0xCA, 0x09,
+    0xC9, 0x70, 0x9C, 0xA0, 0xD7, 0x2C, 0xAA, 0xC7, 0x29, 0xCA, 0xC9, 0x72, 0x9D, 0xA7, 0x3A, 0xD7,
+    0x4D, 0x73, 0x9D, 0x70, 0xA9, 0x9A, 0xD7, 0x1F, 0xA7, 0x2A, 0xCA, 0x97, 0x20, 0x79, 0x75, 0x9E,
+    0x90, 0xCA, 0x70, 0xDA, 0xF9, 0x70, 0xC9, 0x0A, 0xDA, 0x77, 0x77, 0x69, 0x99, 0x99, 0x93, 0x99,
+    0x99, 0x90, 0x9F, 0xD9, 0x1A, 0xFC, 0x90, 0x9E, 0x94, 0x9D, 0xA3, 0xAD, 0x5A, 0xCA, 0x5D, 0x93,
+    0x9D, 0x6A, 0xD3, 0xD7, 0x9D, 0x2D, 0x97, 0x0D, 0xA0, 0xAC, 0xA7, 0x1A, 0xD0, 0xD7, 0x3F, 0x74,
+    0xAD, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x5D, 0x75, 0x9D, 0x74, 0xAE, 0xAA, 0x71, 0xFE,
+    0x70, 0x77, 0x7E, 0x1C, 0x97, 0xFC, 0xAC, 0x97, 0xC9, 0x0F, 0x70, 0x92, 0x99, 0x77, 0x77, 0x69,
+    0xDA, 0x39, 0xD3, 0x9F, 0x4D, 0xA5, 0xDA, 0x3A, 0xCA, 0x5A, 0xD3, 0xAC, 0x96, 0xD3, 0xD7, 0xD9,
+    0x2D, 0x7A, 0xC9, 0x19, 0xC9, 0x7A, 0xCA, 0x1D, 0x70, 0x9C, 0xA0, 0x9C, 0x97, 0x09, 0xCA, 0x0D,
+    0x72, 0xCA, 0xAC, 0x72, 0x9C, 0xAC, 0x97, 0x29, 0xDA, 0x73, 0xAD, 0x74, 0xD7, 0x39, 0xD7, 0x0A,
+    0x99, 0xAD, 0x71, 0xFA, 0x72, 0xAC, 0xA9, 0x72, 0x19, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA1, 0x6C, 0x1C, 0x1A, 0xDA,
+    0x2D, 0x2F, 0x19, 0xA9, 0x92, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A,
+    0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x97, 0x73, 0xC9, 0x6C,
+    0xA0, 0x99, 0x99, 0x99, 0xCA, 0xCA, 0xAA, 0xAA, 0xE3, 0x9C, 0x0C, 0x2A, 0xA1, 0xC1, 0x9A, 0x2C,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x69, 0x60,
+    0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x99, 0x99, 0xDA, 0xAA, 0xAA, 0xC0, 0xC9, 0x3C, 0x1A, 0xA2,
+    0xC2, 0xA9, 0x1C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x69, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x99, 0x99,
+    0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xEA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xA9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9F, 0xFF, 0xFF, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF,
+    0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x09, 0x92,
+    0x99, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D,
+    0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D,
+    0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19,
+    0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9A, 0xA2, 0xAA,
+    0xFF, 0xF9, 0xFF, 0xF9, 0x74, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xA7, 0x40, 0x39,
+    0x3C, 0xA2, 0xD2, 0xAC, 0x92, 0xD2, 0xAD, 0x2A, 0xD9, 0x19, 0xD2, 0x2A, 0xA2, 0xAD, 0x91, 0x9D,
+    0x91, 0x9D, 0x2A, 0xCA, 0x2D, 0x2A, 0xC3, 0xA3, 0x79, 0xD9, 0x19, 0xDA, 0x2D, 0x91, 0x9D, 0x2A,
+    0xCA, 0x2D, 0x2D, 0x39, 0x30, 0x09, 0x91, 0x9D, 0x90, 0xE1, 0xAC, 0xA1, 0x9D, 0x2D, 0x29, 0xC9,
+    0x2A, 0xC0, 0x39, 0x39, 0x3C, 0xA2, 0xCA, 0x2D, 0x2D, 0x2A, 0xC9, 0x1A, 0xC9, 0x2D, 0x2D, 0x2A,
+    0xD1, 0xAD, 0x2A, 0xD9, 0x0A, 0xD9, 0x19, 0xD1, 0x9D, 0x20, 0x29, 0x92, 0x99, 0x2A, 0xD9, 0x0A,
+    0xD9, 0x19, 0xD9, 0x09, 0xD9, 0x19, 0xD1, 0x9D, 0x2A, 0xCA, 0x1A, 0xCA, 0x2D, 0x2D, 0x2A, 0xC9,
+    0x1A, 0xC9, 0x2C, 0x92, 0xC9, 0x20, 0x74, 0x9D, 0x90, 0x9D, 0x91, 0x9D, 0xA0, 0x9D, 0xA2, 0xD9,
+    0x1D, 0x91, 0x9D, 0x19, 0xD2, 0xAC, 0xA1, 0xAC, 0xA2, 0xD2, 0xD2, 0xD2, 0xD3, 0x93, 0x93, 0x09,
+    0x92, 0x99, 0x19, 0xD9, 0x09, 0xD9, 0x0E, 0x1E, 0x1A, 0xCA, 0x1A, 0xCA, 0x19, 0xD1, 0x9D, 0x2D,
+    0x2D, 0x29, 0xC9, 0x19, 0xC9, 0x2A, 0xC2, 0xAC, 0x00, 0x49, 0xA9, 0x7D, 0xA7, 0xD9, 0x7D, 0x70,
+    0xCA, 0x39, 0xEA, 0xFC, 0x9A, 0xFC, 0xAE, 0x4A, 0xC7, 0x0D, 0x70, 0xCA, 0x79, 0xCA, 0x7A, 0xC9,
+    0x7D, 0x70, 0xD7, 0x9D, 0x7A, 0xCA, 0x77, 0x00, 0x59, 0xA9, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD7,
+    0x1C, 0xA4, 0x9E, 0xAF, 0xC9, 0x0A, 0xFC, 0xAE, 0x5D, 0x71, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xC9, 0x49, 0x99, 0x0A, 0xC1, 0x9A, 0x1F, 0xFD, 0x1C, 0xAA, 0x9C, 0xA9, 0xAC, 0xA4, 0x9C, 0xA7,
+    0x0A, 0xC9, 0x70, 0xD9, 0x70, 0xD9, 0x77, 0x10, 0x09, 0xAC, 0x90, 0x9F, 0x0A, 0xF0, 0xAF, 0x1E,
+    0x70, 0x0A, 0x95, 0x9E, 0x93, 0x9F, 0xC9, 0x19, 0xFE, 0x99, 0xFF, 0x9F, 0xDA, 0x09, 0xFA, 0x29,
+    0xDA, 0x59, 0x60, 0x0A, 0xCA, 0x09, 0xE1, 0xE2, 0x91, 0x72, 0xD9, 0x2A, 0xCA, 0xAD, 0xA1, 0x9E,
+    0xAD, 0x29, 0xD9, 0x09, 0x49, 0x10, 0x77, 0x5D, 0xA4, 0xAD, 0x49, 0xD0, 0xAD, 0xA4, 0xE4, 0xE9,
+    0xAD, 0x5D, 0x94, 0xE1, 0x97, 0x79, 0x10, 0x09, 0xA9, 0x1E, 0x09, 0xE1, 0xAC, 0x90, 0x73, 0xC9,
+    0x6C, 0xA0, 0x92, 0x99, 0xCA, 0xC9, 0x1A, 0xAE, 0x39, 0xC0, 0xC2, 0xAA, 0x1C, 0x19, 0xA2, 0xC6,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x96, 0x71,
+    0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x29, 0xDA, 0xA1, 0x9C, 0x0C, 0x93, 0xC1, 0xAA, 0x2C, 0x2A, 0x91,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0x90, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xA9, 0xAA, 0xA0, 0x9A, 0x09, 0xA0, 0xA9, 0x29, 0xA5, 0x9A,
+    0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59,
+    0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x72, 0x29, 0x19, 0x6A, 0xA0, 0xC9, 0x6A, 0xA0,
+    0xCA, 0x19, 0x99, 0x99, 0xCA, 0x0A, 0xA0, 0xCA, 0xAA, 0xAD, 0x09, 0xC0, 0xC2, 0x9C, 0x09, 0xC1,
+    0xC1, 0x9C, 0x09, 0xC2, 0xC1, 0xA0, 0x9A, 0x3C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0x97, 0x10,
+    0x59, 0x59, 0xC0, 0xAA, 0x4A, 0xC0, 0xAA, 0x4A, 0xC0, 0xAC, 0x99, 0x99, 0x90, 0xC9, 0x0D, 0xAA,
+    0xAA, 0xC1, 0xC9, 0x0C, 0x92, 0xC2, 0xAA, 0x0C, 0x91, 0xC3, 0xA9, 0x0A, 0x1C, 0x71, 0xC7, 0x1C,
+    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+    0xC7, 0x1C, 0x71, 0xC7, 0x19, 0x00, 0x77, 0x77, 0x49, 0x71, 0x9C, 0x77, 0x09, 0xF9, 0x6D, 0x77,
+    0xAC, 0xA0, 0x9D, 0x5D, 0x97, 0x7D, 0x2A, 0xC4, 0xAC, 0xA7, 0x7A, 0xC3, 0xAC, 0x92, 0x9D, 0x77,
+    0x0D, 0x3A, 0xC3, 0xD7, 0x71, 0xCA, 0x3D, 0x2A, 0xC9, 0x77, 0x09, 0xCA, 0x3C, 0xA1, 0x9C, 0xA7,
+    0x72, 0xD2, 0xD2, 0xD2, 0xAE, 0x94, 0xF2, 0xDA, 0x9D, 0x91, 0xD2, 0xD9, 0x9D, 0x29, 0xD9, 0xAD,
+    0x2F, 0x91, 0xAC, 0x91, 0xD2, 0xAC, 0x91, 0xD2, 0xAC, 0x70, 0x9C, 0xA1, 0x9C, 0x92, 0x9C, 0x90,
+    0xAC, 0x92, 0xAC, 0x97, 0xD2, 0xD3, 0x9C, 0x90, 0xD3, 0xAC, 0x96, 0xD3, 0xD3, 0xAC, 0x1D, 0x3D,
+    0x6A, 0xCA, 0x3D, 0x3D, 0x1C, 0xA3, 0xD5, 0x9D, 0x4D, 0x2A, 0xC9, 0x1D, 0x2A, 0xC9, 0x5D, 0x5D,
+    0x90, 0x9D, 0x2D, 0x90, 0xAC, 0xA5, 0xD9, 0x6F, 0xA3, 0x9F, 0xA6, 0xAA, 0x70, 0x99, 0x79, 0x97,
+    0x77, 0x74, 0x6A, 0xC9, 0x1D, 0xA0, 0x9D, 0x1D, 0xA0, 0x9D, 0x1A, 0xC9, 0x1C, 0xA7, 0x73, 0xAC,
+    0x91, 0xAC, 0x91, 0xDA, 0x1D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1D, 0xA0, 0x9D, 0x19, 0xD1, 0xAC,
+    0x91, 0xD9, 0x1C, 0xA2, 0xCA, 0x74, 0x77, 0x0A, 0xC9, 0x1A, 0xC9, 0x1D, 0x2D, 0xA1, 0xD9, 0x09,
+    0xD9, 0x09, 0xD1, 0xAD, 0x1A, 0xD1, 0xDA, 0x1D, 0xA1, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xD1, 0xAC,
+    0x91, 0xD9, 0x1D, 0x2C, 0xA2, 0xCA, 0x2C, 0x97, 0x71, 0x6D, 0x3D, 0xA2, 0xAD, 0x3D, 0x92, 0xAD,
+    0x3D, 0x93, 0xC9, 0x50, 0x73, 0xD2, 0x9C, 0xA2, 0xDA, 0x1A, 0xD2, 0xAD, 0x2D, 0x92, 0xD9, 0x1A,
+    0xD2, 0xAD, 0x2D, 0x92, 0xD9, 0x19, 0xD3, 0xC9, 0x2A, 0xC7, 0x20, 0x77, 0x1D, 0x29, 0xCA, 0x2D,
+    0x3D, 0xA1, 0xAD, 0x2D, 0x92, 0xAD, 0x2D, 0x91, 0xE3, 0xD9, 0x1A, 0xD1, 0x9D, 0x92, 0xAD, 0x2D,
+    0x91, 0xAD, 0x3D, 0x91, 0x9D, 0x2D, 0x4C, 0x92, 0xAC, 0x3C, 0x97, 0x70, 0x39, 0xA7, 0x9D, 0xA5,
+    0x9D, 0x9C, 0xA3, 0x9D, 0x19, 0xCA, 0x19, 0xD3, 0x9C, 0xA7, 0x30, 0x4A, 0xC4, 0xD9, 0x3D, 0x92,
+    0x9D, 0xA3, 0xDA, 0x4E, 0x5D, 0x95, 0xD6, 0xCA, 0x71, 0x1A, 0xA5, 0xCA, 0x4A, 0xCA, 0x4D, 0xA3,
+    0xE2, 0xAD, 0x91, 0x9D, 0x29, 0xD3, 0xCA, 0x72, 0x77, 0xAA, 0x73, 0xC1, 0xCA, 0x3A, 0x93, 0xCA,
+    0x2C, 0xA1, 0x9D, 0x2C, 0xA4, 0xC9, 0x1A, 0x91, 0xCA, 0x59, 0xC9, 0x3D, 0x79, 0xC9, 0x1A, 0xC6,
+    0x91, 0x9C, 0x9A, 0xC6, 0x9D, 0x19, 0xD1, 0x9D, 0x29, 0xD1, 0xAD, 0x2D, 0x69, 0xC0, 0xAC, 0x71,
+    0x9C, 0x91, 0xAC, 0x79, 0xC9, 0x3A, 0xC6, 0xC9, 0x1C, 0xA1, 0xD4, 0xC9, 0x19, 0xD2, 0xCA, 0x2C,
+    0xA3, 0xA9, 0x3C, 0xA0, 0xAA, 0x73, 0xC7, 0x70, 0x49, 0x94, 0x99, 0x3D, 0x93, 0xD9, 0x29, 0xD3,
+    0xAD, 0x3D, 0xA3, 0xDA, 0x3D, 0x93, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAC, 0xA3, 0xAC, 0x93, 0xAC,
+    0x93, 0xAC, 0x4D, 0x4D, 0x4D, 0x4C, 0xA4, 0xCA, 0x4C, 0xA3, 0x9C, 0x93, 0x9C, 0x93, 0x9C, 0x49,
+    0xC4, 0xAC, 0x77, 0x77, 0x09, 0xC9, 0x3A, 0xC3, 0x9D, 0xA2, 0x9D, 0x92, 0x9D, 0x3A, 0xD4, 0x95,
+    0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x99, 0x99, 0x90, 0xFC, 0x9A, 0xAA, 0xAA, 0x00, 0x77, 0x74, 0xAA, 0x74, 0x9D, 0x74, 0xD7, 0x4A,
+    0xC9, 0x73, 0x9C, 0xA7, 0x4D, 0x74, 0xD7, 0x4A, 0xC9, 0x74, 0xCA, 0x74, 0xD7, 0x4A, 0xC7, 0x49,
+    0xC9, 0x74, 0xCA, 0x74, 0xD7, 0x4A, 0xC9, 0x73, 0x9C, 0xA7, 0x4D, 0x74, 0xD7, 0x5C, 0xA7, 0x77,
+    0x40, 0x1A, 0xDA, 0x5A, 0xD9, 0x2F, 0xD3, 0xFD, 0x1D, 0xAA, 0xDA, 0x2D, 0xAA, 0xDA, 0x09, 0x3D,
+    0x29, 0x29, 0xD5, 0xD7, 0xD4, 0x9C, 0xA6, 0xAC, 0x93, 0x9D, 0x69, 0xD3, 0x9D, 0x69, 0xD3, 0x9D,
+    0x69, 0xD3, 0x9D, 0x69, 0xD4, 0xD7, 0xD4, 0x9D, 0xA9, 0x49, 0xDA, 0x93, 0xE9, 0x5E, 0x94, 0x97,
+    0x09, 0x77, 0x7A, 0xA7, 0xAA, 0x4A, 0xD6, 0xAD, 0x4E, 0x6D, 0xA5, 0x97, 0x09, 0x50, 0x75, 0x99,
+    0x1A, 0xDA, 0x6D, 0x90, 0xFD, 0x4A, 0xD1, 0xDA, 0xAD, 0xA3, 0xDA, 0x19, 0x3D, 0x3D, 0x96, 0xD2,
+    0x9D, 0x69, 0xCA, 0x2A, 0xCA, 0x59, 0xD3, 0xAC, 0x94, 0x9D, 0x4D, 0x49, 0xD5, 0xD3, 0x9D, 0x6C,
+    0xA3, 0xD6, 0x9C, 0x92, 0x9D, 0xA9, 0x49, 0xC4, 0xE9, 0x49, 0xC5, 0x97, 0x77, 0x5A, 0xA6, 0xAC,
+    0x3A, 0xD5, 0x9D, 0x92, 0xE5, 0xAD, 0x49, 0x79, 0x40, 0x49, 0x97, 0x5D, 0x92, 0x9A, 0xCA, 0x94,
+    0x9D, 0x3F, 0xC9, 0x3D, 0xA2, 0x9D, 0xAE, 0x3D, 0x97, 0xAC, 0x92, 0xD7, 0x0A, 0xC9, 0x19, 0xD7,
+    0x0D, 0x2A, 0xC9, 0x7A, 0xC9, 0x2A, 0xC7, 0xAC, 0xA3, 0xD6, 0xDA, 0x4C, 0xA5, 0xDA, 0x5C, 0xA4,
+    0x9C, 0xA5, 0x9C, 0x94, 0xDA, 0xA4, 0x9C, 0x5A, 0xE7, 0x59, 0x97, 0x76, 0x9C, 0x94, 0x9C, 0x94,
+    0x9D, 0xA4, 0xDA, 0x49, 0xD5, 0xD9, 0x59, 0x69, 0x60, 0x77, 0x09, 0xEA, 0x49, 0xA1, 0x9D, 0xAF,
+    0x99, 0xAD, 0x1C, 0xA2, 0x9A, 0xFC, 0x29, 0x69, 0x99, 0x20, 0x77, 0x5A, 0xC9, 0x1A, 0xC9, 0x1D,
+    0x2D, 0x2D, 0xA1, 0xD9, 0x09, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xD1, 0xAD, 0x1E, 0x1D, 0xA1, 0xDA,
+    0x1D, 0x90, 0x9D, 0x90, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xCA, 0x1A, 0xC9, 0x1D, 0x91, 0xD2, 0xD2,
+    0xCA, 0x2C, 0xA2, 0xC9, 0x19, 0xC9, 0x77, 0x60, 0x39, 0xA9, 0x5F, 0xC9, 0x2D, 0x90, 0xAD, 0x1A,
+    0xC9, 0x2D, 0x1D, 0x3D, 0x09, 0xCA, 0x3D, 0x0A, 0xC9, 0x29, 0xCA, 0x0D, 0x3A, 0xC9, 0x0D, 0x3D,
+    0x1A, 0xC9, 0x1A, 0xC9, 0x19, 0xFC, 0xA3, 0x9E, 0x93, 0x79, 0x70, 0xDA, 0x6E, 0x95, 0xDA, 0xC5,
+    0xD0, 0xD4, 0xD1, 0xCA, 0x3D, 0x19, 0xC9, 0x2D, 0xA9, 0x9A, 0xCA, 0x91, 0xFF, 0xC6, 0xD7, 0x0C,
+    0xA7, 0x0A, 0x92, 0x39, 0x99, 0x99, 0x3A, 0xFC, 0x3D, 0x99, 0x99, 0x29, 0xC9, 0x6A, 0xD9, 0x59,
+    0xAE, 0x7A, 0xCA, 0x69, 0xD6, 0x9C, 0xA5, 0x9D, 0x29, 0xAA, 0xE3, 0x9D, 0xA9, 0x40, 0x59, 0x9A,
+    0x49, 0xF9, 0x2A, 0xD9, 0x4A, 0xCA, 0x6D, 0x99, 0x4A, 0xFC, 0x92, 0xD2, 0xD1, 0x9C, 0xA2, 0xAC,
+    0x90, 0x9C, 0xA2, 0xAC, 0x91, 0xD2, 0xD2, 0xAD, 0xAD, 0x93, 0xAD, 0xA3, 0x19, 0x99, 0x99, 0x91,
+    0xAF, 0xDA, 0x0C, 0xA9, 0x99, 0xD9, 0x0C, 0x29, 0xCA, 0x5C, 0xA5, 0xD5, 0xAC, 0x94, 0x9C, 0xA5,
+    0xD5, 0x9C, 0xA5, 0xD6, 0xAA, 0x50, 0x39, 0xAA, 0x4F, 0xC9, 0x1D, 0x2D, 0x1C, 0xA2, 0xCA, 0x1D,
+    0x1D, 0x29, 0xF3, 0xDA, 0xD2, 0xD1, 0x9C, 0xA0, 0xAC, 0x92, 0xD0, 0xAC, 0x91, 0x9D, 0x09, 0xDA,
+    0xAD, 0x29, 0xEA, 0x20, 0x49, 0xA9, 0x49, 0xFC, 0x3D, 0x1A, 0xCA, 0x1A, 0xC3, 0xD1, 0xD3, 0xD1,
+    0xD9, 0x2C, 0xA1, 0x9D, 0xAA, 0xD9, 0x3A, 0xAA, 0xD6, 0xD9, 0x49, 0xD9, 0x29, 0xAE, 0x93, 0xDA,
+    0x94, 0x19, 0x92, 0x92, 0xE9, 0x9E, 0x29, 0xCA, 0xC9, 0xD2, 0xAD, 0x1D, 0x2D, 0x90, 0x9C, 0xA2,
+    0xD1, 0xAC, 0x29, 0xC9, 0x1D, 0x09, 0x0A, 0xC2, 0xE9, 0x0A, 0xC2, 0xD9, 0x00, 0x29, 0xEA, 0x39,
+    0xFC, 0xA1, 0x9D, 0x19, 0xD1, 0xD3, 0xD0, 0x9D, 0x3D, 0x0A, 0xC9, 0x3D, 0x0D, 0x39, 0xCA, 0x0D,
+    0x3A, 0xC9, 0x0D, 0x29, 0xD1, 0xAC, 0xA0, 0x9D, 0x3F, 0xC9, 0x49, 0xA9, 0x40, 0x71, 0x9A, 0xC1,
+    0x9F, 0x29, 0x9D, 0x39, 0xCA, 0x3A, 0xC9, 0x3D, 0x4D, 0x4D, 0x39, 0xCA, 0x3A, 0xCA, 0x1A, 0xFC,
+    0x19, 0x99, 0x91, 0x39, 0xEA, 0x3A, 0xDA, 0xDA, 0x19, 0xCA, 0x19, 0xD2, 0xA2, 0x9C, 0xA6, 0xD9,
+    0x5A, 0xC9, 0x5D, 0x95, 0xD9, 0x49, 0xD5, 0xAD, 0x99, 0x99, 0x91, 0xFF, 0x39, 0x99, 0x92, 0x29,
+    0xE9, 0x2A, 0xDA, 0xD2, 0xC9, 0x1A, 0xC6, 0xD4, 0x9D, 0x92, 0x9E, 0xA4, 0xA9, 0xD9, 0x59, 0xCA,
+    0x5A, 0xC9, 0x39, 0xAD, 0x1F, 0xCA, 0x29, 0xAA, 0x94, 0x69, 0xC9, 0x6A, 0xD9, 0x59, 0xE5, 0x9C,
+    0x9D, 0x49, 0xC9, 0x0D, 0x39, 0xCA, 0x1C, 0xA2, 0x9C, 0xA1, 0x9C, 0x92, 0xFF, 0xC1, 0xAA, 0xAA,
+    0xAD, 0xA9, 0x6C, 0xA7, 0x9C, 0xA7, 0x09, 0x30, 0x29, 0xAA, 0xAA, 0xA3, 0xFD, 0x3C, 0xA6, 0x9C,
+    0x96, 0xAE, 0x96, 0xAD, 0x96, 0x9C, 0xA6, 0x9C, 0xA6, 0xAC, 0x94, 0x9D, 0xA2, 0xFC, 0x94, 0x99,
+    0x95, 0x49, 0xAD, 0x93, 0xEA, 0x93, 0xDA, 0x5D, 0x95, 0x9D, 0xAA, 0x93, 0xDA, 0xAE, 0x2C, 0xA2,
+    0xAC, 0x90, 0x9C, 0xA2, 0xAC, 0x91, 0xCA, 0x2A, 0xC2, 0xD9, 0x09, 0xCA, 0x29, 0xFA, 0x59, 0x94,
+    0x09, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0xA0, 0xC9, 0x2D, 0x1A, 0x2A, 0xC5, 0x9C, 0x95, 0xCA, 0x5D,
+    0x5A, 0xC9, 0x5D, 0x5A, 0xC9, 0x5D, 0x69, 0x95, 0x29, 0xAD, 0xA2, 0x9C, 0xA9, 0xAC, 0xA1, 0xD2,
+    0xD1, 0xCA, 0x19, 0xCA, 0x1A, 0xCA, 0x9C, 0xA3, 0xEA, 0x29, 0xC9, 0x0D, 0x90, 0x9C, 0xA2, 0xD0,
+    0xAC, 0x3D, 0x0A, 0xCA, 0x1A, 0xCA, 0x1F, 0xCA, 0x39, 0x99, 0x30, 0x3A, 0xE9, 0x3D, 0xAA, 0xD2,
+    0x9C, 0xA1, 0x9C, 0xA1, 0xD3, 0xD1, 0xD3, 0xD1, 0xAC, 0xA1, 0x9C, 0xA2, 0xAF, 0xC6, 0x9C, 0xA5,
+    0x9D, 0x49, 0xE3, 0xFA, 0x49, 0x99, 0x50, 0x77, 0x3F, 0xFE, 0x49, 0xAF, 0xFC, 0x6D, 0x4D, 0x59,
+    0xD4, 0xC9, 0x5A, 0xCA, 0x49, 0x6D, 0x97, 0x4D, 0x97, 0x39, 0xFE, 0xA6, 0xAF, 0xE9, 0x6A, 0xCA,
+    0x74, 0xD9, 0x72, 0xAA, 0xDA, 0xAA, 0x79, 0xFE, 0x71, 0xAD, 0x74, 0xDA, 0x72, 0x9A, 0xEA, 0x97,
+    0x9F, 0xE7, 0x73, 0x97, 0x49, 0xFC, 0x97, 0x09, 0xDA, 0xAE, 0x79, 0xD2, 0x9D, 0x7D, 0x93, 0xD6,
+    0x9D, 0x49, 0x7A, 0xCA, 0x75, 0xD9, 0x72, 0x9F, 0xFC, 0x69, 0xAE, 0xAA, 0xAA, 0x97, 0x0D, 0xA7,
+    0x29, 0xFF, 0xC9, 0x69, 0xAD, 0x99, 0x99, 0x97, 0x0A, 0xCA, 0x75, 0xD7, 0x39, 0x09, 0xCA, 0x59,
+    0x93, 0xFF, 0xFC, 0x3E, 0x99, 0xAF, 0xDA, 0x39, 0x97, 0x50, 0x69, 0x99, 0x77, 0x69, 0xFF, 0xA7,
+    0x73, 0xAA, 0xE9, 0x9A, 0xE7, 0x74, 0xAD, 0x3D, 0xA7, 0x73, 0xDA, 0x3A, 0xD7, 0x73, 0xD9, 0x3A,
+    0xD2, 0xAC, 0x76, 0xD4, 0xAC, 0xA1, 0x9C, 0xA7, 0x59, 0xD4, 0xD2, 0xAC, 0xA9, 0x93, 0x9A, 0xA9,
+    0x3A, 0xCA, 0x3D, 0xA0, 0xFE, 0x2F, 0xC3, 0xDA, 0x99, 0xAD, 0xA1, 0x99, 0xD9, 0x92, 0xD2, 0x93,
+    0xFD, 0xA4, 0x9C, 0xA4, 0xD6, 0x9D, 0x97, 0x09, 0xC9, 0x4D, 0xA5, 0x9D, 0x71, 0xAC, 0x95, 0xE4,
+    0xAC, 0xA7, 0x1D, 0x7E, 0x3D, 0x97, 0x1D, 0x70, 0xD9, 0x2D, 0x97, 0x09, 0xCA, 0x1C, 0xA9, 0xC2,
+    0xAC, 0x19, 0xEA, 0xA7, 0x9D, 0xAD, 0x0A, 0xD9, 0xAC, 0xA0, 0xAF, 0xD9, 0x7E, 0xA2, 0xF9, 0x77,
+    0x77, 0x73, 0x99, 0x74, 0xAF, 0xDA, 0x79, 0xFA, 0xAE, 0x6A, 0xD9, 0x39, 0xCA, 0x59, 0xD5, 0x9C,
+    0x95, 0xD9, 0x69, 0x5A, 0xCA, 0x74, 0x9A, 0xDA, 0xAA, 0xAA, 0xA9, 0x6F, 0xFD, 0x70, 0x9D, 0x74,
+    0xAF, 0xFC, 0xA6, 0xAA, 0xEA, 0xAA, 0xAA, 0x71, 0xAD, 0x76, 0x9D, 0x77, 0xDA, 0x76, 0xAD, 0xA4,
+    0x9C, 0x96, 0xAF, 0xFC, 0x70, 0x9F, 0xDA, 0x77, 0x50, 0x77, 0x19, 0xCA, 0x72, 0x9D, 0x73, 0xD7,
+    0x3D, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xCA, 0x0D, 0x97, 0x99, 0x2D, 0x97, 0x4D,
+    0x97, 0x4C, 0x97, 0x77, 0x49, 0x70, 0xE6, 0xFC, 0x4D, 0x9C, 0x9D, 0x2D, 0x09, 0xC1, 0xD1, 0xA1,
+    0x9C, 0x90, 0x9A, 0x49, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79,
+    0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x76, 0x77, 0x7A, 0xC9, 0x74, 0xD9, 0x74, 0xD1, 0x9A,
+    0xAA, 0xAA, 0xA9, 0x99, 0x99, 0xD0, 0xAF, 0xFF, 0xCA, 0x09, 0x97, 0x9D, 0x72, 0x9D, 0x72, 0x9D,
+    0x73, 0x9C, 0x77, 0x20, 0x4A, 0x70, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97,
+    0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x94, 0xC9, 0x09, 0xC9, 0x0A, 0xC1, 0xAC,
+    0x99, 0xC0, 0x9C, 0xA2, 0xAC, 0xAC, 0xAC, 0xA4, 0xAE, 0xA6, 0xAC, 0xA7, 0x60, 0x77, 0x1A, 0xC9,
+    0x29, 0xC9, 0x49, 0xCA, 0x4A, 0xC9, 0x29, 0xCA, 0x6A, 0xC9, 0x09, 0xD9, 0x99, 0x99, 0x99, 0x99,
+    0xD9, 0xFF, 0xFE, 0x0D, 0x70, 0xD2, 0xD6, 0xD4, 0xD4, 0xD5, 0x9C, 0x4C, 0x77, 0x20, 0x4A, 0x70,
+    0xE5, 0x9F, 0xC9, 0x29, 0xD9, 0xC9, 0xD9, 0x1D, 0x09, 0xC9, 0x0D, 0x19, 0x19, 0xC9, 0x19, 0x49,
+    0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x4A, 0x90, 0x9C, 0x90, 0x9A, 0x1D, 0x09,
+    0xC9, 0x0D, 0x2D, 0x9C, 0x9D, 0x4F, 0xC6, 0xE7, 0x09, 0x40, 0x4A, 0x70, 0xE6, 0xFC, 0x4D, 0x9C,
+    0x9D, 0x2D, 0x09, 0xC9, 0x0D, 0x19, 0x19, 0xC9, 0x19, 0x49, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x49,
+    0x19, 0xC9, 0x19, 0x1D, 0x09, 0xC9, 0x0D, 0x2D, 0x9C, 0x9D, 0x4F, 0xC6, 0xE4, 0x99, 0x9A, 0xCA,
+    0x99, 0x90, 0xAF, 0xFC, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x90, 0x79, 0x97, 0x0A, 0xC9, 0x7A, 0xC9,
+    0x7A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC7, 0x0A, 0xC4, 0xD1, 0xAC, 0x3D, 0x2A, 0xC2, 0xD3, 0xAC, 0x1D,
+    0xA9, 0x99, 0x9A, 0xC0, 0x9F, 0xFC, 0x1A, 0xCA, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xAA, 0x77,
+    0x09, 0x97, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA1,
+    0xD4, 0xCA, 0x2D, 0x3C, 0xA3, 0xD2, 0xCA, 0x99, 0x99, 0xAD, 0x1F, 0xFC, 0x96, 0xAC, 0xA6, 0x9C,
+    0xA6, 0xAC, 0xA7, 0xAA, 0x76, 0x72, 0x97, 0x3D, 0x39, 0x5D, 0x2D, 0x5D, 0x1D, 0x95, 0xD0, 0xD9,
+    0x6D, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFD, 0xA0, 0xD7, 0x3D, 0x73, 0xD7, 0x3A, 0x70, 0x39,
+    0xA7, 0x39, 0xD7, 0x3D, 0x59, 0x99, 0x2F, 0xFF, 0xA0, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A,
+    0xC9, 0x74, 0xFF, 0xFC, 0x91, 0xFF, 0xFA, 0x2D, 0x75, 0xD7, 0x59, 0x70, 0x4A, 0x70, 0xE6, 0xD0,
+    0xD3, 0x9D, 0xA0, 0xAD, 0x90, 0x9C, 0xAC, 0xA0, 0xAC, 0xAC, 0x99, 0xC0, 0xCA, 0x0A, 0xC0, 0xC9,
+    0x2C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C,
+    0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x59, 0x90, 0x99, 0x20, 0x70, 0xA9, 0x74, 0xD4,
+    0x99, 0x95, 0xD2, 0xAF, 0xFF, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x74, 0x9C, 0xA9, 0xFF,
+    0xFC, 0x0A, 0xFF, 0xF7, 0x3D, 0x73, 0xD7, 0x49, 0x40, 0x2C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C,
+    0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0,
+    0xAC, 0x5C, 0xA0, 0xAC, 0x2A, 0xC0, 0xCA, 0x0A, 0xC0, 0xCA, 0x0E, 0xA0, 0xAE, 0x2D, 0xA0, 0xAD,
+    0x4D, 0x9D, 0x6E, 0x70, 0x94, 0x3A, 0x92, 0x9A, 0x6A, 0xCA, 0x2A, 0xCA, 0x4A, 0xC9, 0x4A, 0xCA,
+    0x2A, 0xFF, 0xEA, 0x09, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC9, 0xD7, 0x2D, 0x0F, 0xFF, 0xC1,
+    0x9F, 0xFE, 0x92, 0x9C, 0xA4, 0xAC, 0x94, 0x9C, 0xA2, 0xAC, 0x96, 0x94, 0x93, 0x09, 0x97, 0x29,
+    0x90, 0x9D, 0xA7, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0x97, 0xD9, 0x2D, 0xA6, 0x9D, 0x3A, 0xD6,
+    0xAC, 0xA3, 0x9F, 0xFE, 0x5F, 0xFE, 0x5A, 0xD4, 0xD9, 0x6D, 0xA3, 0xD7, 0xE2, 0xAC, 0xA7, 0x9D,
+    0x2D, 0x71, 0xDA, 0x09, 0xCA, 0x71, 0xAD, 0x0A, 0xC9, 0x72, 0xD9, 0xD7, 0x3F, 0x97, 0x39, 0xE7,
+    0x5D, 0x97, 0x77, 0x69, 0x70, 0xAF, 0xC9, 0x4A, 0xCA, 0x99, 0xE9, 0x39, 0x4E, 0x71, 0x9D, 0x72,
+    0xD9, 0x71, 0xDA, 0x49, 0xAC, 0xA9, 0xDA, 0x3A, 0xFE, 0xA2, 0xDA, 0x29, 0xDA, 0x1A, 0xCA, 0x4D,
+    0xA1, 0xD5, 0xD9, 0x0A, 0xCA, 0x5D, 0x1D, 0x94, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0xD9, 0x4D, 0x2D,
+    0x93, 0xAC, 0xA2, 0xE2, 0x9D, 0x39, 0xEA, 0xE5, 0x9F, 0xA7, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFE, 0xAC, 0xAA, 0xAA, 0xAA, 0xE7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x9C, 0xAA,
+    0xAA, 0xAA, 0xE9, 0xFF, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xFF, 0xFF, 0xFE,
+    0xA0, 0x77, 0x71, 0x9A, 0xAA, 0x93, 0x9C, 0x5A, 0xFF, 0x90, 0xD4, 0xFA, 0x99, 0xAF, 0xC4, 0xE9,
+    0x5A, 0xDA, 0x3A, 0xD7, 0xF3, 0xD9, 0x6D, 0x9D, 0x91, 0xAD, 0x6D, 0x90, 0xAC, 0xA1, 0xDA, 0x5D,
+    0x91, 0x9D, 0x1D, 0x94, 0xD9, 0x29, 0xD1, 0xD9, 0x3D, 0xA3, 0x9D, 0x1D, 0x92, 0xAC, 0xA4, 0x9D,
+    0x1D, 0xA1, 0xAC, 0xA5, 0xAD, 0x1A, 0xD0, 0xAC, 0xA6, 0xDA, 0x19, 0xDA, 0xCA, 0x69, 0xD3, 0xF6,
+    0x9D, 0xA3, 0xAE, 0x59, 0xE3, 0x9F, 0xDA, 0xAF, 0xA3, 0x9D, 0x1A, 0xFE, 0x95, 0xA5, 0x99, 0x97,
+    0x79, 0x97, 0x4E, 0x73, 0x9E, 0x97, 0x2A, 0xF7, 0x2D, 0x9D, 0x71, 0xAC, 0x90, 0xD9, 0x70, 0xD1,
+    0xAD, 0x79, 0xCA, 0x19, 0xD7, 0xAC, 0x92, 0xDA, 0x6D, 0x3A, 0xD5, 0xAC, 0xA3, 0x9D, 0x94, 0xD5,
+    0xDA, 0x39, 0xD5, 0xAD, 0x3D, 0x95, 0x9D, 0x92, 0xD7, 0xDA, 0x1A, 0xCA, 0x7A, 0xD1, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFD, 0xA0, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xE1, 0xEA, 0xA9,
+    0x99, 0x99, 0xAA, 0xE1, 0xAD, 0x97, 0xD9, 0x2D, 0xA6, 0x9D, 0x3E, 0x6A, 0xCA, 0x39, 0xD9, 0x5D,
+    0x5E, 0x49, 0xD5, 0xAD, 0x4D, 0x96, 0xDA, 0x3D, 0x7E, 0x2A, 0xCA, 0x79, 0xD9, 0x1D, 0x71, 0xDA,
+    0x09, 0xCA, 0x71, 0xAD, 0x0A, 0xC9, 0x72, 0xD9, 0xD7, 0x3F, 0x97, 0x39, 0xE7, 0x5D, 0x97, 0x77,
+    0x70, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFD, 0x92, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xE7, 0x4D,
+    0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x76, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xFE, 0x1D, 0x91, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1D, 0x97, 0x5D, 0xA7, 0x59, 0xD7, 0x6E, 0x76,
+    0xEA, 0x75, 0xAF, 0xFE, 0x95, 0xAF, 0xFC, 0x90, 0x73, 0xD7, 0x39, 0x99, 0xD9, 0x95, 0x9F, 0xFD,
+    0x92, 0x9F, 0xAA, 0xAD, 0xAA, 0xA2, 0x9E, 0x4D, 0x5D, 0xA4, 0x9C, 0xA4, 0xAD, 0x5D, 0x94, 0xDA,
+    0x5D, 0x5D, 0x59, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xA0, 0x9F, 0xFF, 0xE1, 0xD9, 0x19,
+    0x9A, 0xCA, 0x99, 0x99, 0x91, 0xD9, 0x3A, 0xC9, 0x6D, 0xA3, 0xD7, 0x9D, 0x29, 0xCA, 0x70, 0xE1,
+    0xAC, 0x97, 0x1E, 0xAD, 0x73, 0xAF, 0xFE, 0x95, 0xFF, 0xD9, 0x5D, 0x75, 0x9C, 0xA7, 0x77, 0x10,
+    0x59, 0x99, 0x99, 0x99, 0x99, 0x94, 0xAF, 0xFE, 0x91, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x9D,
+    0xA7, 0x4E, 0x75, 0xD9, 0x75, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x09, 0xFF, 0xFD, 0xA1, 0xD9,
+    0x75, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0xA9, 0x74, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0x90, 0x09, 0x99,
+    0x99, 0x99, 0x70, 0x9F, 0xFD, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x75, 0xE9, 0x75, 0xAD, 0x76,
+    0xDA, 0x75, 0xAD, 0x76, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x1F, 0xFF, 0xE9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0x9D, 0x75, 0x9D, 0x75, 0xAD, 0x75, 0xD9, 0x74, 0xE7, 0x3A, 0xE2,
+    0x9F, 0xFE, 0xA3, 0x9F, 0xFC, 0xA5, 0x2D, 0x74, 0x99, 0xD9, 0x99, 0x70, 0x9F, 0xFD, 0x95, 0xAA,
+    0xAD, 0xAA, 0xAF, 0x96, 0xD4, 0xE9, 0x5A, 0xC9, 0x4A, 0xD5, 0x9D, 0x5D, 0xA5, 0xD5, 0xAD, 0x5A,
+    0xC9, 0x5D, 0x1A, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xD1, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x9A, 0xCA,
+    0x99, 0x19, 0xD6, 0x9C, 0xA3, 0x9D, 0x7D, 0x3A, 0xD7, 0xAC, 0x92, 0xD9, 0x79, 0xCA, 0x1E, 0x71,
+    0xDA, 0xE2, 0x9F, 0xFE, 0xA3, 0x9F, 0xFD, 0x76, 0xD7, 0x6A, 0xC9, 0x77, 0x50, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x95, 0x9F, 0xFE, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x97, 0x5A, 0xD7, 0x6E, 0x75,
+    0x9D, 0x19, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xD1, 0xAF, 0xFF, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x74,
+    0x9D, 0xA7, 0x29, 0xAE, 0x19, 0xFF, 0xFA, 0x29, 0xFF, 0xDA, 0x40, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD, 0x19, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x93, 0xAD, 0x7A,
+    0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4,
+    0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD,
+    0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A,
+    0xD2, 0x9A, 0xFA, 0x39, 0xAF, 0xA0, 0xFE, 0x3F, 0xE0, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0xAF, 0xFF, 0x90, 0xAE, 0xAA, 0xAA, 0xAA, 0xAD, 0x91, 0xE9, 0x5A, 0xCA, 0x19, 0xE6, 0xCA, 0x2A,
+    0xDA, 0x5A, 0x4A, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xD7,
+    0x29, 0xD7, 0x3D, 0x97, 0x2D, 0xA7, 0x2A, 0xD6, 0x99, 0x19, 0xD7, 0xD1, 0xD9, 0x69, 0xD0, 0xE9,
+    0x99, 0x99, 0x99, 0xAD, 0xA9, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xFF, 0xD0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x72, 0x9C, 0xA7, 0x2D, 0x72, 0xAC, 0x97, 0x2D,
+    0x72, 0xD9, 0x71, 0x9C, 0xA7, 0x2D, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0xD9, 0x71, 0x9C, 0xA7, 0x2D,
+    0x72, 0xAC, 0xA7, 0x2D, 0x72, 0xAC, 0x97, 0x19, 0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD7, 0x77,
+    0x00, 0x0D, 0x7A, 0xC7, 0x9C, 0xA7, 0xD7, 0xAC, 0x97, 0xCA, 0x7D, 0x79, 0xC9, 0x7D, 0x7A, 0xC7,
+    0x9C, 0xA7, 0xD7, 0xAC, 0x97, 0xCA, 0x7D, 0x7A, 0xC9, 0x7D, 0x7D, 0x79, 0xCA, 0x71, 0x77, 0x0C,
+    0xA7, 0x1C, 0xA5, 0xA9, 0x1C, 0xA1, 0xA9, 0x09, 0xDA, 0x0C, 0xA9, 0xE2, 0xAF, 0xD9, 0x5E, 0xA5,
+    0x9F, 0xD9, 0x2E, 0x0C, 0xA9, 0xDA, 0x1C, 0x91, 0xCA, 0x1A, 0xA5, 0xCA, 0x71, 0xCA, 0x77, 0x00,
+    0x39, 0x5A, 0xF9, 0x1A, 0xCA, 0x99, 0xD9, 0x0D, 0x29, 0xCA, 0x9C, 0xA3, 0xD0, 0xCA, 0x3C, 0xA0,
+    0xD9, 0x1A, 0xC9, 0x09, 0xFC, 0xA3, 0x9A, 0xA2, 0x09, 0x90, 0xE9, 0xE9, 0x9C, 0xA0, 0x77, 0x74,
+    0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x4D, 0x74,
+    0x9C, 0xA2, 0xAA, 0xAA, 0xA4, 0xAC, 0x92, 0xFC, 0x4D, 0x39, 0x99, 0xD9, 0x29, 0xD6, 0xDA, 0x2A,
+    0xC9, 0x69, 0xD2, 0xD7, 0x0D, 0x91, 0xD7, 0x0D, 0xA0, 0xAC, 0xA7, 0x0A, 0xD0, 0xD7, 0x2D, 0x0D,
+    0x72, 0xFA, 0x72, 0xAE, 0x97, 0x29, 0xE7, 0x4D, 0xA7, 0x4A, 0xC9, 0x60, 0x76, 0x9E, 0x92, 0xAC,
+    0x90, 0x9F, 0xCA, 0x0A, 0xCA, 0x1D, 0x2A, 0xCA, 0xC9, 0x2C, 0xA3, 0xDA, 0x3C, 0xA3, 0xAC, 0xA3,
+    0xD2, 0x9C, 0xAC, 0x92, 0xAD, 0xAD, 0xA0, 0xDA, 0x2A, 0xE9, 0x2A, 0xC9, 0x74, 0x1A, 0xDA, 0x3A,
+    0xDA, 0x2A, 0xFC, 0x1F, 0xCA, 0x1C, 0xA2, 0xF2, 0xD0, 0x9C, 0x92, 0x9D, 0x3A, 0xC0, 0x9C, 0x92,
+    0x9D, 0x3A, 0xC0, 0x9C, 0xA2, 0xCA, 0xD2, 0xD1, 0xDA, 0xAD, 0x09, 0xDA, 0xD9, 0x2E, 0xA2, 0x9E,
+    0xA7, 0x71, 0x09, 0x97, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7,
+    0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x1F, 0xFF, 0xE0, 0xFF, 0xFE, 0x77, 0x76, 0xCA, 0x76, 0xAD, 0x75, 0x9D, 0x97, 0x49, 0xDA, 0x75,
+    0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x75, 0x9D, 0x97, 0x5D,
+    0xA7, 0x5E, 0x75, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFE, 0x09, 0xFF, 0xFF,
+    0x00, 0x99, 0x0D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0xA0, 0x09, 0x92, 0x91, 0xD1,
+    0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC,
+    0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0,
+    0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1,
+    0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC,
+    0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xAA, 0x19, 0xA9, 0x79, 0x97, 0x5E, 0x75, 0xE9, 0x73,
+    0xAF, 0x73, 0xD0, 0xD7, 0x29, 0xD0, 0xAC, 0xA7, 0x1A, 0xC9, 0x09, 0xD7, 0x1D, 0x2D, 0x97, 0x9C,
+    0xA2, 0xAC, 0xA7, 0xD9, 0x3D, 0x7D, 0x4D, 0x95, 0xAC, 0xA4, 0x9D, 0x5D, 0x6D, 0x49, 0xD6, 0xAC,
+    0xA3, 0xDA, 0x69, 0xD3, 0xD7, 0x0D, 0x91, 0xAD, 0x70, 0xAD, 0x1D, 0x97, 0x1D, 0x00, 0x09, 0x97,
+    0x29, 0x91, 0xDA, 0x70, 0x9D, 0x19, 0xD7, 0x0A, 0xCA, 0x2D, 0x97, 0xD9, 0x2A, 0xCA, 0x69, 0xD3,
+    0x9D, 0x6D, 0x94, 0xD9, 0x5D, 0x59, 0xCA, 0x4A, 0xCA, 0x6D, 0x4D, 0x96, 0xAC, 0x92, 0x9D, 0x79,
+    0xD2, 0xAC, 0xA7, 0x0D, 0x2D, 0x71, 0xAC, 0xA0, 0x9D, 0x72, 0xD0, 0xD9, 0x72, 0xD9, 0xD7, 0x39,
+    0xEA, 0x74, 0xE9, 0x74, 0xAD, 0x60, 0x39, 0xAA, 0xAA, 0xA9, 0x6F, 0xFC, 0x4E, 0xA9, 0x99, 0xAE,
+    0x2A, 0xD6, 0xDA, 0x1D, 0x96, 0x9D, 0x09, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99,
+    0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7,
+    0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x90, 0x09, 0x97,
+    0x09, 0x90, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70,
+    0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9,
+    0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x0D, 0x70, 0xD1, 0xDA, 0x6A, 0xD1, 0xAD, 0x94, 0x9D, 0xA2,
+    0xAE, 0xAA, 0xAE, 0xA4, 0x9F, 0xE9, 0x70, 0x99, 0x95, 0x70, 0x99, 0x71, 0xAF, 0xA6, 0x9D, 0x9A,
+    0xD6, 0xD9, 0x1A, 0x95, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72,
+    0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72,
+    0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0xAD, 0x69, 0x2A, 0xCA, 0x59, 0xD0, 0x9D, 0x69, 0xFC, 0x97,
+    0x9A, 0xAA, 0x97, 0x77, 0x5E, 0x74, 0xE9, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0x9D, 0x70, 0xDA, 0x0E, 0xA6, 0x9E, 0x0E, 0x96, 0x9E, 0x19, 0x72, 0x91, 0x77, 0xAD, 0x97, 0xE0,
+    0xEA, 0x69, 0xE0, 0xAD, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xD7, 0x4E,
+    0x97, 0x3E, 0x75, 0x97, 0x19, 0xCA, 0x1E, 0x09, 0xDA, 0x19, 0x97, 0x77, 0x29, 0x91, 0xAD, 0x90,
+    0xE9, 0x0A, 0xCA, 0x10, 0x77, 0xAD, 0x97, 0xE0, 0xEA, 0x69, 0xE0, 0xAD, 0x70, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xD7, 0x0D, 0xA0, 0xEA, 0x69, 0xE0, 0xE9, 0x69, 0xE1, 0x97,
+    0x29, 0x10, 0x77, 0x09, 0xEA, 0x49, 0xA1, 0x9D, 0xAF, 0x99, 0xAD, 0x1C, 0xA2, 0x9A, 0xFC, 0x29,
+    0x69, 0x99, 0x20, 0x39, 0x97, 0x2F, 0xCA, 0x3A, 0xC1, 0xDA, 0x99, 0xFA, 0xD9, 0x1C, 0x93, 0x9A,
+    0xE9, 0x77, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x77, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x1A, 0xA9, 0x49, 0x1F, 0xC9,
+    0x1A, 0xC9, 0xAC, 0xA9, 0xAF, 0xD0, 0xAC, 0x29, 0xF9, 0x70, 0x93, 0xAE, 0xA2, 0x9C, 0x99, 0xFD,
+    0xA9, 0xD0, 0xD2, 0xAF, 0xA1, 0x94, 0xAA, 0x91, 0x0A, 0x97, 0x09, 0xA1, 0xFF, 0xFC, 0x29, 0xAA,
+    0xFC, 0xAA, 0x97, 0x77, 0x71, 0x9A, 0xAF, 0xCA, 0xA9, 0x2F, 0xFF, 0xC1, 0xA9, 0x70, 0x9A, 0x00,
+    0x79, 0x70, 0x9C, 0x91, 0xAA, 0xAA, 0xAA, 0xDA, 0xA9, 0xFF, 0xD4, 0xAC, 0x97, 0xCA, 0x7A, 0xC4,
+    0x9F, 0xFD, 0x0A, 0xAD, 0xAA, 0xAA, 0xAA, 0x1A, 0xC7, 0x09, 0x96, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0xFF, 0xC7, 0x77, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x70, 0xA7,
+    0x0A, 0xDA, 0x5A, 0xEA, 0x4A, 0xEA, 0x4A, 0xE9, 0x59, 0xDA, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x79,
+    0xF9, 0x79, 0xEA, 0x70, 0x9C, 0xA7, 0x77, 0x09, 0xFF, 0xCA, 0x09, 0xFF, 0xD0, 0x0A, 0x72, 0xDA,
+    0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0xAE, 0x5A, 0xE9, 0x39, 0xAE, 0x94,
+    0xF9, 0x6D, 0x97, 0x77, 0x79, 0xFF, 0xCA, 0x09, 0xFF, 0xD0, 0x77, 0x75, 0xA9, 0x6A, 0xA7, 0xAE,
+    0x4A, 0xE5, 0xAE, 0x93, 0xAE, 0x94, 0xAE, 0x93, 0xAE, 0x94, 0xAE, 0x93, 0xAE, 0x95, 0x9E, 0x5E,
+    0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x09, 0xEA, 0x39, 0xEA, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x0A, 0xE4,
+    0x9E, 0x71, 0xAA, 0x6A, 0xA7, 0x75, 0x77, 0x5A, 0xA6, 0x9A, 0x71, 0xEA, 0x4E, 0xA7, 0x09, 0xEA,
+    0x39, 0xEA, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x09, 0xEA, 0x39, 0xEA, 0x70, 0xE5, 0xE9, 0x5A, 0xE9,
+    0x3A, 0xE9, 0x4A, 0xE9, 0x3A, 0xE9, 0x4A, 0xE9, 0x3A, 0xE9, 0x5E, 0x94, 0xEA, 0x7A, 0xA6, 0xAA,
+    0x77, 0x75, 0x09, 0x99, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xEA, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9,
+    0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD7, 0x6D, 0x76, 0xD9, 0x75, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x39,
+    0xE1, 0x9F, 0xFF, 0xC2, 0x9F, 0xFD, 0xA9, 0x77, 0x40, 0x77, 0x73, 0x9D, 0x75, 0xAC, 0x97, 0x5D,
+    0x72, 0x99, 0x99, 0xD9, 0x99, 0x4A, 0xFF, 0xE9, 0x19, 0xFA, 0xAA, 0xDA, 0xAA, 0xA2, 0xE4, 0xD5,
+    0xAD, 0x4A, 0xCA, 0x5D, 0x94, 0xD6, 0xD5, 0xD5, 0x9D, 0x49, 0xCA, 0x6D, 0x4D, 0x96, 0xDA, 0x3D,
+    0x7A, 0xD2, 0x9C, 0xA7, 0x0E, 0x90, 0xD9, 0x71, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xD9, 0x5A, 0xC9,
+    0x75, 0xD7, 0x59, 0xCA, 0x75, 0xAC, 0x97, 0x77, 0x10, 0x77, 0x71, 0xAC, 0x97, 0x5D, 0x76, 0xD6,
+    0x99, 0x99, 0x99, 0x9A, 0xCA, 0x59, 0xFF, 0xEA, 0x4A, 0xAA, 0xAA, 0xAF, 0xE9, 0x70, 0x9C, 0xA1,
+    0xE7, 0x0D, 0x3D, 0xA7, 0xD3, 0x9D, 0x69, 0xCA, 0x4D, 0x6D, 0x94, 0xD9, 0x5D, 0x5D, 0x59, 0xCA,
+    0x4A, 0xD5, 0xAC, 0x94, 0xDA, 0x5D, 0x39, 0xE1, 0x9F, 0xFF, 0xC2, 0x9F, 0xFD, 0xA9, 0x7D, 0x75,
+    0x9C, 0xA7, 0x5A, 0xC9, 0x75, 0xD7, 0x77, 0x40, 0x69, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xE9,
+    0x19, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2E, 0x74, 0xAD, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x6D,
+    0x76, 0xDA, 0x75, 0xAD, 0x76, 0xE9, 0x75, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xD9, 0x77, 0x77, 0x2A,
+    0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xEA, 0x4A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xF9, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD7, 0x6D, 0x76, 0xD9, 0x75, 0xD7, 0x5A,
+    0xD7, 0x5D, 0xA7, 0x39, 0xE1, 0x9F, 0xFF, 0xC2, 0x9F, 0xFD, 0xA9, 0x77, 0x77, 0x59, 0xFF, 0xFD,
+    0xA0, 0x9F, 0xFF, 0xDA, 0x00, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x90, 0x9C, 0x90, 0x9D,
+    0x94, 0x9C, 0xA2, 0x9C, 0x92, 0xAC, 0x93, 0xCA, 0x39, 0xC9, 0x3A, 0xC2, 0xAC, 0x49, 0xC9, 0x4C,
+    0xA1, 0xCA, 0x49, 0xC9, 0x4A, 0xC0, 0x9C, 0x59, 0xC9, 0x49, 0xC9, 0x9C, 0x99, 0x99, 0x99, 0xAC,
+    0xA9, 0x99, 0x99, 0x9C, 0x9A, 0xFF, 0xFF, 0xCA, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49,
+    0xC9, 0x49, 0xC9, 0x0C, 0xA4, 0x9C, 0x94, 0xAC, 0x1A, 0xC4, 0x9C, 0x94, 0xCA, 0x2C, 0xA3, 0x9C,
+    0x93, 0xD3, 0x9C, 0xA2, 0x9C, 0x92, 0xD9, 0x49, 0xDA, 0x09, 0xC9, 0x0A, 0xD9, 0x7A, 0xFE, 0xA7,
+    0x49, 0x99, 0x70, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x94, 0x9D, 0x94, 0x9C, 0xA7, 0x0A,
+    0xC9, 0x3C, 0xA7, 0x2A, 0xC2, 0xAC, 0x74, 0xCA, 0x1C, 0xA7, 0x4A, 0xC0, 0x9C, 0x75, 0x9C, 0x99,
+    0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xC9, 0xAF, 0xFF, 0xFC, 0xA9, 0xC9, 0x74, 0x9C,
+    0x99, 0xC9, 0x74, 0x9C, 0x90, 0xCA, 0x74, 0xAC, 0x1A, 0xC7, 0x4C, 0xA2, 0xD7, 0x2D, 0x39, 0xCA,
+    0x70, 0xD9, 0x49, 0xDA, 0x4A, 0xD9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x69, 0xAA, 0xA9, 0x73,
+    0xFF, 0xC7, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x70, 0xD9, 0x3E, 0xA6, 0xAE, 0x2A, 0xC0, 0xAC, 0xA4,
+    0xAC, 0x90, 0xCA, 0x1C, 0xA1, 0xAC, 0xA2, 0xAC, 0x91, 0xAC, 0x09, 0xC3, 0xAC, 0xA0, 0xAC, 0x92,
+    0x9C, 0x99, 0xC4, 0xAE, 0x94, 0xC9, 0xAC, 0x5E, 0x5C, 0xA9, 0xC4, 0xAC, 0xAC, 0xA4, 0xC9, 0x9C,
+    0x92, 0xAC, 0x90, 0xAC, 0xA2, 0x9C, 0x90, 0xCA, 0x1A, 0xC9, 0x2A, 0xCA, 0x1A, 0xC1, 0xAC, 0x0A,
+    0xC9, 0x4A, 0xCA, 0x0C, 0xA2, 0xE9, 0x6A, 0xE3, 0x9D, 0x70, 0xD9, 0x49, 0xDA, 0x4A, 0xD9, 0x7A,
+    0xFE, 0xA7, 0x49, 0x99, 0x70, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x94, 0x9D, 0x94, 0x9C,
+    0xA7, 0x0D, 0x93, 0xCA, 0x70, 0xAE, 0x2A, 0xC7, 0x0A, 0xC9, 0x0C, 0xA1, 0xCA, 0x7A, 0xC9, 0x1A,
+    0xC0, 0x9C, 0x96, 0xAC, 0x92, 0x9C, 0x99, 0xC6, 0xAC, 0x94, 0xC9, 0xAC, 0x5A, 0xC9, 0x5C, 0xA9,
+    0xC4, 0xAC, 0x96, 0xC9, 0x9C, 0x92, 0xAC, 0x96, 0x9C, 0x90, 0xCA, 0x1A, 0xC9, 0x7A, 0xC1, 0xAC,
+    0x0A, 0xC9, 0x70, 0xCA, 0x2E, 0x97, 0x0D, 0x39, 0xD7, 0x0D, 0x94, 0x9D, 0xA4, 0xAD, 0x97, 0xAF,
+    0xEA, 0x74, 0x99, 0x97, 0x69, 0x74, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73,
+    0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC,
+    0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x69, 0x99, 0x99, 0xAC, 0xA9, 0x99, 0x99, 0x0A,
+    0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0xA0, 0x09, 0x1A, 0xD9, 0xEA, 0xAD, 0x00, 0x19, 0x69, 0x69, 0x90,
+    0x9E, 0x4E, 0x4A, 0xD9, 0xAE, 0x4E, 0x4E, 0xA0, 0xD9, 0x4D, 0xA4, 0x9D, 0x00, 0x73, 0x97, 0x76,
+    0x9C, 0xA7, 0x74, 0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x09, 0xC9, 0x19, 0xDA, 0x76, 0x9C, 0x94,
+    0x9C, 0xA7, 0x49, 0xD9, 0x19, 0x2A, 0xCA, 0x72, 0x9F, 0xFA, 0x1D, 0xA7, 0x09, 0xFF, 0xD9, 0x0A,
+    0xDA, 0x69, 0xFF, 0xEA, 0x09, 0xEA, 0x49, 0xFF, 0xFA, 0x09, 0xFA, 0x29, 0xFF, 0xEA, 0x2A, 0xFC,
+    0xA1, 0xAF, 0xFA, 0x5F, 0xDA, 0x2A, 0xFE, 0x4A, 0xFD, 0xA4, 0xAF, 0xD9, 0x1A, 0xFE, 0xA6, 0xAF,
+    0xCA, 0x0A, 0xFE, 0xA7, 0x0A, 0xFC, 0x0A, 0xFD, 0xA7, 0x2A, 0xFF, 0xEA, 0x74, 0xAE, 0x90, 0xAE,
+    0xA7, 0x6A, 0xD2, 0xDA, 0x77, 0x0A, 0xC9, 0x0A, 0xCA, 0x77, 0x2A, 0xEA, 0x77, 0x4A, 0xCA, 0x77,
+    0x69, 0x73,
 };
 
 static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 7, 20, 9, 1, 19, 35, 0 }, // !
-    { 9, 8, 11, 1, 18, 18, 35 }, // "
-    { 16, 15, 17, 0, 14, 60, 53 }, // #
-    { 15, 25, 16, 0, 20, 94, 113 }, // $
-    { 22, 21, 24, 1, 19, 116, 207 }, // %
-    { 21, 21, 23, 1, 19, 111, 323 }, // &
-    { 4, 8, 6, 1, 18, 8, 434 }, // '
-    { 11, 25, 13, 1, 20, 69, 442 }, // (
-    { 11, 25, 10, -2, 20, 69, 511 }, // )
-    { 9, 9, 11, 1, 19, 21, 580 }, // *
-    { 11, 11, 16, 2, 14, 31, 601 }, // +
-    { 6, 9, 8, -1, 4, 14, 632 }, // ,
-    { 8, 3, 10, 1, 8, 6, 646 }, // -
-    { 4, 5, 8, 1, 4, 5, 652 }, // .
-    { 14, 20, 14, -1, 18, 70, 657 }, // /
-    { 15, 19, 16, 0, 18, 72, 727 }, // 0
-    { 10, 18, 16, 2, 18, 45, 799 }, // 1
-    { 14, 18, 16, 0, 18, 63, 844 }, // 2
-    { 14, 19, 16, 0, 18, 67, 907 }, // 3
-    { 15, 18, 16, 0, 18, 68, 974 }, // 4
-    { 14, 19, 16, 1, 18, 67, 1042 }, // 5
-    { 15, 19, 17, 1, 18, 72, 1109 }, // 6
-    { 13, 19, 17, 3, 18, 62, 1181 }, // 7
-    { 14, 19, 16, 1, 18, 67, 1243 }, // 8
-    { 15, 19, 16, 0, 18, 72, 1310 }, // 9
-    { 7, 14, 9, 1, 13, 25, 1382 }, // :
-    { 9, 18, 9, -1, 13, 41, 1407 }, // ;
-    { 12, 13, 16, 2, 15, 39, 1448 }, // <
-    { 11, 7, 16, 2, 12, 20, 1487 }, // =
-    { 12, 13, 16, 2, 15, 39, 1507 }, // >
-    { 8, 19, 11, 2, 18, 38, 1546 }, // ?
-    { 23, 23, 25, 1, 18, 133, 1584 }, // @
-    { 19, 18, 18, -2, 18, 86, 1717 }, // A
-    { 16, 19, 16, -1, 18, 76, 1803 }, // B
-    { 15, 19, 17, 1, 18, 72, 1879 }, // C
-    { 19, 19, 19, -1, 18, 91, 1951 }, // D
-    { 17, 18, 17, -1, 18, 77, 2042 }, // E
-    { 16, 18, 16, -1, 18, 72, 2119 }, // F
-    { 16, 19, 18, 1, 18, 76, 2191 }, // G
-    { 22, 18, 22, -1, 18, 99, 2267 }, // H
-    { 11, 18, 11, -1, 18, 50, 2366 }, // I
-    { 16, 23, 12, -5, 18, 92, 2416 }, // J
-    { 20, 19, 20, -1, 18, 95, 2508 }, // K
-    { 15, 18, 15, -1, 18, 68, 2603 }, // L
-    { 25, 18, 24, -2, 18, 113, 2671 }, // M
-    { 21, 19, 21, -1, 18, 100, 2784 }, // N
-    { 17, 19, 19, 1, 18, 81, 2884 }, // O
-    { 16, 18, 16, -1, 18, 72, 2965 }, // P
-    { 21, 24, 23, 1, 18, 126, 3037 }, // Q
-    { 17, 19, 17, -1, 18, 81, 3163 }, // R
-    { 13, 19, 14, 0, 18, 62, 3244 }, // S
-    { 15, 18, 18, 2, 18, 68, 3306 }, // T
-    { 18, 19, 21, 2, 18, 86, 3374 }, // U
-    { 19, 19, 21, 1, 18, 91, 3460 }, // V
-    { 26, 19, 29, 2, 18, 124, 3551 }, // W
-    { 20, 18, 19, -2, 18, 90, 3675 }, // X
-    { 17, 18, 19, 1, 18, 77, 3765 }, // Y
-    { 16, 19, 16, -1, 18, 76, 3842 }, // Z
-    { 10, 24, 10, -1, 20, 60, 3918 }, // [
-    { 10, 20, 12, 1, 18, 50, 3978 }, // <backslash>
-    { 10, 24, 10, -1, 20, 60, 4028 }, // ]
-    { 12, 12, 16, 2, 16, 36, 4088 }, // ^
-    { 13, 2, 14, 0, -1, 7, 4124 }, // _
-    { 5, 7, 15, 5, 21, 9, 4131 }, // `
-    { 13, 15, 15, 1, 14, 49, 4140 }, // a
-    { 13, 21, 14, 0, 20, 69, 4189 }, // b
-    { 10, 15, 12, 1, 14, 38, 4258 }, // c
-    { 14, 21, 16, 1, 20, 74, 4296 }, // d
-    { 11, 15, 13, 1, 14, 42, 4370 }, // e
-    { 18, 26, 14, -5, 20, 117, 4412 }, // f
-    { 17, 20, 15, -3, 14, 85, 4529 }, // g
-    { 15, 21, 16, 0, 20, 79, 4614 }, // h
-    { 7, 21, 9, 1, 20, 37, 4693 }, // i
-    { 13, 26, 9, -5, 20, 85, 4730 }, // j
-    { 12, 21, 14, 1, 20, 63, 4815 }, // k
-    { 7, 21, 9, 1, 20, 37, 4878 }, // l
-    { 21, 15, 23, 1, 14, 79, 4915 }, // m
-    { 14, 15, 16, 1, 14, 53, 4994 }, // n
-    { 12, 15, 14, 1, 14, 45, 5047 }, // o
-    { 16, 20, 15, -2, 14, 80, 5092 }, // p
-    { 13, 20, 15, 1, 14, 65, 5172 }, // q
-    { 11, 14, 13, 1, 14, 39, 5237 }, // r
-    { 10, 15, 11, 0, 14, 38, 5276 }, // s
-    { 10, 18, 11, 0, 17, 45, 5314 }, // t
-    { 14, 14, 16, 1, 13, 49, 5359 }, // u
-    { 13, 15, 14, 0, 14, 49, 5408 }, // v
-    { 19, 15, 20, 0, 14, 72, 5457 }, // w
-    { 16, 15, 16, -1, 14, 60, 5529 }, // x
-    { 16, 20, 14, -3, 14, 80, 5589 }, // y
-    { 12, 14, 13, 0, 13, 42, 5669 }, // z
-    { 10, 25, 12, 1, 20, 63, 5711 }, // {
-    { 7, 23, 8, 0, 20, 41, 5774 }, // |
-    { 10, 25, 10, -1, 20, 63, 5815 }, // }
-    { 12, 5, 16, 2, 11, 15, 5878 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5893 }, //  
-    { 8, 20, 8, -1, 14, 40, 5893 }, // ¡
-    { 12, 25, 16, 2, 20, 75, 5933 }, // ¢
-    { 17, 19, 17, -1, 18, 81, 6008 }, // £
-    { 16, 13, 17, 0, 15, 52, 6089 }, // ¤
-    { 17, 18, 19, 1, 18, 77, 6141 }, // ¥
-    { 7, 23, 8, 0, 20, 41, 6218 }, // ¦
-    { 12, 21, 13, 0, 18, 63, 6259 }, // §
-    { 9, 4, 15, 3, 19, 9, 6322 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 6331 }, // ©
-    { 10, 12, 12, 1, 18, 30, 6422 }, // ª
-    { 13, 10, 14, 0, 11, 33, 6452 }, // «
-    { 11, 7, 16, 2, 12, 20, 6485 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 6505 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6511 }, // ®
-    { 9, 3, 15, 3, 18, 7, 6560 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 6567 }, // °
-    { 11, 15, 16, 2, 15, 42, 6588 }, // ±
-    { 10, 12, 11, 0, 21, 30, 6630 }, // ²
-    { 9, 12, 11, 1, 21, 27, 6660 }, // ³
-    { 6, 7, 15, 5, 21, 11, 6687 }, // ´
-    { 16, 21, 16, -1, 14, 84, 6698 }, // µ
-    { 16, 22, 16, -1, 18, 88, 6782 }, // ¶
-    { 4, 4, 8, 2, 9, 4, 6870 }, // ·
-    { 6, 6, 15, 5, -1, 9, 6874 }, // ¸
-    { 7, 12, 11, 2, 21, 21, 6883 }, // ¹
-    { 10, 12, 12, 1, 18, 30, 6904 }, // º
-    { 12, 10, 13, 0, 11, 30, 6934 }, // »
-    { 24, 21, 27, 2, 19, 126, 6964 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 7090 }, // ½
-    { 25, 21, 27, 1, 19, 132, 7216 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 7348 }, // ¿
-    { 19, 24, 18, -2, 24, 114, 7393 }, // À
-    { 19, 24, 18, -2, 24, 114, 7507 }, // Á
-    { 19, 24, 18, -2, 24, 114, 7621 }, // Â
-    { 19, 24, 18, -2, 24, 114, 7735 }, // Ã
-    { 19, 23, 18, -2, 23, 110, 7849 }, // Ä
-    { 19, 25, 18, -2, 25, 119, 7959 }, // Å
-    { 25, 18, 24, -2, 18, 113, 8078 }, // Æ
-    { 15, 25, 17, 1, 18, 94, 8191 }, // Ç
-    { 17, 24, 17, -1, 24, 102, 8285 }, // È
-    { 17, 24, 17, -1, 24, 102, 8387 }, // É
-    { 17, 24, 17, -1, 24, 102, 8489 }, // Ê
-    { 17, 23, 17, -1, 23, 98, 8591 }, // Ë
-    { 11, 24, 11, -1, 24, 66, 8689 }, // Ì
-    { 12, 24, 12, -1, 24, 72, 8755 }, // Í
-    { 13, 24, 13, -1, 24, 78, 8827 }, // Î
-    { 13, 23, 13, -1, 23, 75, 8905 }, // Ï
-    { 19, 19, 19, -1, 18, 91, 8980 }, // Ð
-    { 21, 25, 21, -1, 24, 132, 9071 }, // Ñ
-    { 17, 25, 19, 1, 24, 107, 9203 }, // Ò
-    { 17, 25, 19, 1, 24, 107, 9310 }, // Ó
-    { 17, 25, 19, 1, 24, 107, 9417 }, // Ô
-    { 17, 25, 19, 1, 24, 107, 9524 }, // Õ
-    { 17, 24, 19, 1, 23, 102, 9631 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 9733 }, // ×
-    { 20, 19, 20, -1, 18, 95, 9761 }, // Ø
-    { 18, 25, 21, 2, 24, 113, 9856 }, // Ù
-    { 18, 25, 21, 2, 24, 113, 9969 }, // Ú
-    { 18, 25, 21, 2, 24, 113, 10082 }, // Û
-    { 18, 24, 21, 2, 23, 108, 10195 }, // Ü
-    { 17, 24, 19, 1, 24, 102, 10303 }, // Ý
-    { 15, 18, 15, -1, 18, 68, 10405 }, // Þ
-    { 20, 26, 17, -4, 20, 130, 10473 }, // ß
-    { 13, 22, 15, 1, 21, 72, 10603 }, // à
-    { 13, 22, 15, 1, 21, 72, 10675 }, // á
-    { 13, 22, 15, 1, 21, 72, 10747 }, // â
-    { 13, 21, 15, 1, 20, 69, 10819 }, // ã
-    { 13, 20, 15, 1, 19, 65, 10888 }, // ä
-    { 13, 22, 15, 1, 21, 72, 10953 }, // å
-    { 18, 15, 20, 1, 14, 68, 11025 }, // æ
-    { 10, 21, 12, 1, 14, 53, 11093 }, // ç
-    { 11, 22, 13, 1, 21, 61, 11146 }, // è
-    { 11, 22, 13, 1, 21, 61, 11207 }, // é
-    { 11, 22, 13, 1, 21, 61, 11268 }, // ê
-    { 12, 20, 14, 1, 19, 60, 11329 }, // ë
-    { 7, 22, 9, 1, 21, 39, 11389 }, // ì
-    { 9, 22, 11, 1, 21, 50, 11428 }, // í
-    { 9, 22, 11, 1, 21, 50, 11478 }, // î
-    { 10, 20, 12, 1, 19, 50, 11528 }, // ï
-    { 13, 21, 14, 0, 20, 69, 11578 }, // ð
-    { 14, 21, 16, 1, 20, 74, 11647 }, // ñ
-    { 12, 22, 14, 1, 21, 66, 11721 }, // ò
-    { 12, 22, 14, 1, 21, 66, 11787 }, // ó
-    { 12, 22, 14, 1, 21, 66, 11853 }, // ô
-    { 13, 21, 15, 1, 20, 69, 11919 }, // õ
-    { 13, 20, 15, 1, 19, 65, 11988 }, // ö
-    { 11, 13, 16, 2, 15, 36, 12053 }, // ÷
-    { 16, 15, 16, -1, 14, 60, 12089 }, // ø
-    { 14, 22, 16, 1, 21, 77, 12149 }, // ù
-    { 14, 22, 16, 1, 21, 77, 12226 }, // ú
-    { 14, 22, 16, 1, 21, 77, 12303 }, // û
-    { 14, 20, 16, 1, 19, 70, 12380 }, // ü
-    { 16, 27, 14, -3, 21, 108, 12450 }, // ý
-    { 15, 26, 14, -2, 20, 98, 12558 }, // þ
-    { 16, 25, 14, -3, 19, 100, 12656 }, // ÿ
-    { 19, 23, 18, -2, 23, 110, 12756 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 12866 }, // ā
-    { 19, 24, 18, -2, 24, 114, 12928 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 13042 }, // ă
-    { 19, 24, 18, -2, 18, 114, 13111 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 13225 }, // ą
-    { 15, 25, 17, 1, 24, 94, 13290 }, // Ć
-    { 11, 22, 13, 1, 21, 61, 13384 }, // ć
-    { 15, 25, 17, 1, 24, 94, 13445 }, // Ĉ
-    { 11, 22, 13, 1, 21, 61, 13539 }, // ĉ
-    { 15, 25, 17, 1, 24, 94, 13600 }, // Ċ
-    { 10, 20, 12, 1, 19, 50, 13694 }, // ċ
-    { 16, 26, 18, 1, 25, 104, 13744 }, // Č
-    { 12, 22, 14, 1, 21, 66, 13848 }, // č
-    { 19, 26, 19, -1, 25, 124, 13914 }, // Ď
-    { 18, 23, 20, 1, 22, 104, 14038 }, // ď
-    { 19, 19, 19, -1, 18, 91, 14142 }, // Đ
-    { 15, 21, 17, 1, 20, 79, 14233 }, // đ
-    { 17, 23, 17, -1, 23, 98, 14312 }, // Ē
-    { 12, 19, 14, 1, 18, 57, 14410 }, // ē
-    { 17, 24, 17, -1, 24, 102, 14467 }, // Ĕ
-    { 12, 21, 14, 1, 20, 63, 14569 }, // ĕ
-    { 17, 24, 17, -1, 24, 102, 14632 }, // Ė
-    { 11, 20, 13, 1, 19, 55, 14734 }, // ė
-    { 17, 24, 17, -1, 18, 102, 14789 }, // Ę
-    { 11, 20, 13, 1, 14, 55, 14891 }, // ę
-    { 17, 25, 17, -1, 25, 107, 14946 }, // Ě
-    { 12, 22, 14, 1, 21, 66, 15053 }, // ě
-    { 17, 25, 19, 1, 24, 107, 15119 }, // Ĝ
-    { 17, 27, 15, -3, 21, 115, 15226 }, // ĝ
-    { 17, 25, 19, 1, 24, 107, 15341 }, // Ğ
-    { 17, 26, 15, -3, 20, 111, 15448 }, // ğ
-    { 17, 25, 19, 1, 24, 107, 15559 }, // Ġ
-    { 17, 25, 15, -3, 19, 107, 15666 }, // ġ
-    { 17, 25, 19, 1, 18, 107, 15773 }, // Ģ
-    { 17, 28, 15, -3, 22, 119, 15880 }, // ģ
-    { 22, 24, 22, -1, 24, 132, 15999 }, // Ĥ
-    { 15, 27, 16, 0, 26, 102, 16131 }, // ĥ
-    { 22, 18, 22, -1, 18, 99, 16233 }, // Ħ
-    { 15, 21, 16, 0, 20, 79, 16332 }, // ħ
-    { 13, 24, 13, -1, 24, 78, 16411 }, // Ĩ
-    { 10, 21, 12, 1, 20, 53, 16489 }, // ĩ
-    { 13, 23, 13, -1, 23, 75, 16542 }, // Ī
-    { 10, 19, 12, 1, 18, 48, 16617 }, // ī
-    { 13, 24, 13, -1, 24, 78, 16665 }, // Ĭ
-    { 10, 21, 12, 1, 20, 53, 16743 }, // ĭ
-    { 11, 24, 11, -1, 18, 66, 16796 }, // Į
-    { 7, 26, 9, 1, 20, 46, 16862 }, // į
-    { 11, 24, 11, -1, 24, 66, 16908 }, // İ
-    { 6, 14, 8, 1, 13, 21, 16974 }, // ı
-    { 21, 23, 21, -1, 18, 121, 16995 }, // Ĳ
-    { 15, 26, 17, 1, 20, 98, 17116 }, // ĳ
-    { 17, 29, 13, -5, 24, 124, 17214 }, // Ĵ
-    { 15, 27, 11, -5, 21, 102, 17338 }, // ĵ
-    { 20, 25, 20, -1, 18, 125, 17440 }, // Ķ
-    { 12, 27, 14, 1, 20, 81, 17565 }, // ķ
-    { 12, 15, 14, 1, 14, 45, 17646 }, // ĸ
-    { 15, 24, 15, -1, 24, 90, 17691 }, // Ĺ
-    { 9, 27, 11, 1, 26, 61, 17781 }, // ĺ
-    { 15, 25, 15, -1, 18, 94, 17842 }, // Ļ
-    { 9, 27, 9, -1, 20, 61, 17936 }, // ļ
-    { 16, 20, 16, -1, 20, 80, 17997 }, // Ľ
-    { 11, 23, 13, 1, 22, 64, 18077 }, // ľ
-    { 16, 18, 16, -1, 18, 72, 18141 }, // Ŀ
-    { 10, 21, 12, 1, 20, 53, 18213 }, // ŀ
-    { 15, 18, 15, -1, 18, 68, 18266 }, // Ł
-    { 10, 21, 10, -1, 20, 53, 18334 }, // ł
-    { 21, 25, 21, -1, 24, 132, 18387 }, // Ń
-    { 14, 22, 16, 1, 21, 77, 18519 }, // ń
-    { 21, 25, 21, -1, 18, 132, 18596 }, // Ņ
-    { 14, 21, 16, 1, 14, 74, 18728 }, // ņ
-    { 21, 26, 21, -1, 25, 137, 18802 }, // Ň
-    { 14, 22, 16, 1, 21, 77, 18939 }, // ň
-    { 19, 20, 21, 1, 19, 95, 19016 }, // ŉ
-    { 21, 23, 21, -1, 18, 121, 19111 }, // Ŋ
-    { 13, 20, 15, 1, 14, 65, 19232 }, // ŋ
-    { 17, 24, 19, 1, 23, 102, 19297 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 19399 }, // ō
-    { 17, 25, 19, 1, 24, 107, 19461 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 19568 }, // ŏ
-    { 18, 26, 20, 1, 25, 117, 19637 }, // Ő
-    { 14, 22, 16, 1, 21, 77, 19754 }, // ő
-    { 23, 19, 25, 1, 18, 110, 19831 }, // Œ
-    { 19, 15, 21, 1, 14, 72, 19941 }, // œ
-    { 17, 25, 17, -1, 24, 107, 20013 }, // Ŕ
-    { 11, 21, 13, 1, 21, 58, 20120 }, // ŕ
-    { 17, 25, 17, -1, 18, 107, 20178 }, // Ŗ
-    { 13, 21, 13, -1, 14, 69, 20285 }, // ŗ
-    { 17, 26, 17, -1, 25, 111, 20354 }, // Ř
-    { 12, 21, 14, 1, 21, 63, 20465 }, // ř
-    { 13, 25, 14, 0, 24, 82, 20528 }, // Ś
-    { 11, 22, 12, 0, 21, 61, 20610 }, // ś
-    { 13, 25, 14, 0, 24, 82, 20671 }, // Ŝ
-    { 11, 22, 12, 0, 21, 61, 20753 }, // ŝ
-    { 13, 25, 14, 0, 18, 82, 20814 }, // Ş
-    { 10, 21, 11, 0, 14, 53, 20896 }, // ş
-    { 14, 26, 15, 0, 25, 91, 20949 }, // Š
-    { 12, 22, 13, 0, 21, 66, 21040 }, // š
-    { 15, 25, 18, 2, 18, 94, 21106 }, // Ţ
-    { 10, 24, 11, 0, 17, 60, 21200 }, // ţ
-    { 15, 25, 18, 2, 25, 94, 21260 }, // Ť
-    { 11, 21, 12, 0, 20, 58, 21354 }, // ť
-    { 15, 18, 18, 2, 18, 68, 21412 }, // Ŧ
-    { 10, 18, 11, 0, 17, 45, 21480 }, // ŧ
-    { 18, 25, 21, 2, 24, 113, 21525 }, // Ũ
-    { 14, 21, 16, 1, 20, 74, 21638 }, // ũ
-    { 18, 24, 21, 2, 23, 108, 21712 }, // Ū
-    { 14, 19, 16, 1, 18, 67, 21820 }, // ū
-    { 18, 25, 21, 2, 24, 113, 21887 }, // Ŭ
-    { 14, 21, 16, 1, 20, 74, 22000 }, // ŭ
-    { 18, 26, 21, 2, 25, 117, 22074 }, // Ů
-    { 14, 22, 16, 1, 21, 77, 22191 }, // ů
-    { 18, 26, 21, 2, 25, 117, 22268 }, // Ű
-    { 14, 22, 16, 1, 21, 77, 22385 }, // ű
-    { 18, 24, 21, 2, 18, 108, 22462 }, // Ų
-    { 14, 19, 16, 1, 13, 67, 22570 }, // ų
-    { 26, 25, 29, 2, 24, 163, 22637 }, // Ŵ
-    { 19, 22, 20, 0, 21, 105, 22800 }, // ŵ
-    { 17, 24, 19, 1, 24, 102, 22905 }, // Ŷ
-    { 16, 27, 14, -3, 21, 108, 23007 }, // ŷ
-    { 17, 23, 19, 1, 23, 98, 23115 }, // Ÿ
-    { 16, 25, 16, -1, 24, 100, 23213 }, // Ź
-    { 12, 22, 13, 0, 21, 66, 23313 }, // ź
-    { 16, 25, 16, -1, 24, 100, 23379 }, // Ż
-    { 12, 20, 13, 0, 19, 60, 23479 }, // ż
-    { 16, 26, 16, -1, 25, 104, 23539 }, // Ž
-    { 12, 22, 13, 0, 21, 66, 23643 }, // ž
-    { 18, 26, 14, -5, 20, 117, 23709 }, // ſ
-    { 19, 22, 21, 1, 21, 105, 23826 }, // Ơ
-    { 14, 17, 16, 1, 16, 60, 23931 }, // ơ
-    { 16, 18, 17, 0, 18, 72, 23991 }, // Ƥ
-    { 16, 26, 15, -2, 20, 104, 24063 }, // ƥ
-    { 10, 23, 11, 0, 17, 58, 24167 }, // ƫ
-    { 16, 18, 18, 1, 18, 72, 24225 }, // Ƭ
-    { 13, 21, 14, 0, 20, 69, 24297 }, // ƭ
-    { 15, 23, 18, 2, 18, 87, 24366 }, // Ʈ
-    { 20, 22, 23, 2, 21, 110, 24453 }, // Ư
-    { 16, 17, 18, 1, 16, 68, 24563 }, // ư
-    { 6, 7, 3, -4, 21, 11, 24631 }, // ̀
-    { 6, 7, 5, -2, 21, 11, 24642 }, // ́
-    { 9, 7, 5, -5, 21, 16, 24653 }, // ̂
-    { 8, 5, 5, -4, 20, 10, 24669 }, // ̃
-    { 8, 3, 5, -4, 18, 6, 24679 }, // ̄
-    { 8, 5, 5, -4, 20, 10, 24685 }, // ̆
-    { 4, 4, 3, -2, 19, 4, 24695 }, // ̇
-    { 10, 4, 6, -5, 19, 10, 24699 }, // ̈
-    { 7, 8, 5, -3, 22, 14, 24709 }, // ̉
-    { 8, 7, 5, -4, 21, 14, 24723 }, // ̊
-    { 10, 7, 7, -4, 21, 18, 24737 }, // ̋
-    { 9, 6, 6, -4, 21, 14, 24755 }, // ̌
-    { 8, 7, 4, -5, 21, 14, 24769 }, // ̏
-    { 9, 5, 5, -5, 20, 12, 24783 }, // ̑
-    { 6, 8, 4, -3, 22, 12, 24795 }, // ̒
-    { 5, 7, 4, -2, 22, 9, 24807 }, // ̓
-    { 5, 7, 3, -3, 22, 9, 24816 }, // ̔
-    { 4, 7, 3, -2, 22, 7, 24825 }, // ̕
-    { 6, 6, 4, -3, 16, 9, 24832 }, // ̛
-    { 4, 4, 3, -2, -2, 4, 24841 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 24845 }, // ̤
-    { 6, 6, 4, -3, -1, 9, 24855 }, // ̥
-    { 5, 6, 3, -3, -1, 8, 24864 }, // ̦
-    { 6, 6, 4, -3, -1, 9, 24872 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 24881 }, // ̨
-    { 5, 6, 7, -1, -1, 8, 24892 }, // ̩
-    { 9, 6, 5, -5, -1, 14, 24900 }, // ̭
-    { 8, 5, 5, -4, -1, 10, 24914 }, // ̮
-    { 8, 5, 5, -4, -1, 10, 24924 }, // ̰
-    { 8, 3, 5, -4, -2, 6, 24934 }, // ̱
-    { 9, 5, 5, -5, 20, 12, 24940 }, // ͂
-    { 9, 10, 5, -5, 25, 23, 24952 }, // ̈́
-    { 5, 5, 4, -2, -1, 7, 24975 }, // ͅ
-    { 19, 18, 18, -2, 18, 86, 24982 }, // Α
-    { 16, 19, 16, -1, 18, 76, 25068 }, // Β
-    { 16, 18, 16, -1, 18, 72, 25144 }, // Γ
-    { 15, 18, 17, 0, 18, 68, 25216 }, // Δ
-    { 17, 18, 17, -1, 18, 77, 25284 }, // Ε
-    { 16, 19, 16, -1, 18, 76, 25361 }, // Ζ
-    { 22, 18, 22, -1, 18, 99, 25437 }, // Η
-    { 17, 19, 19, 1, 18, 81, 25536 }, // Θ
-    { 11, 18, 11, -1, 18, 50, 25617 }, // Ι
-    { 20, 19, 20, -1, 18, 95, 25667 }, // Κ
-    { 19, 18, 18, -2, 18, 86, 25762 }, // Λ
-    { 25, 18, 24, -2, 18, 113, 25848 }, // Μ
-    { 21, 19, 21, -1, 18, 100, 25961 }, // Ν
-    { 17, 18, 17, -1, 18, 77, 26061 }, // Ξ
-    { 17, 19, 19, 1, 18, 81, 26138 }, // Ο
-    { 21, 18, 21, -1, 18, 95, 26219 }, // Π
-    { 16, 18, 16, -1, 18, 72, 26314 }, // Ρ
-    { 16, 19, 16, -1, 18, 76, 26386 }, // Σ
-    { 15, 18, 18, 2, 18, 68, 26462 }, // Τ
-    { 16, 18, 18, 1, 18, 72, 26530 }, // Υ
-    { 18, 19, 19, 0, 18, 86, 26602 }, // Φ
-    { 20, 18, 19, -2, 18, 90, 26688 }, // Χ
-    { 20, 18, 22, 1, 18, 90, 26778 }, // Ψ
-    { 20, 18, 20, -1, 18, 90, 26868 }, // Ω
-    { 14, 15, 16, 1, 14, 53, 26958 }, // α
-    { 13, 26, 14, 0, 20, 85, 27011 }, // β
-    { 13, 20, 14, 0, 14, 65, 27096 }, // γ
-    { 13, 21, 15, 1, 20, 69, 27161 }, // δ
-    { 11, 15, 13, 1, 14, 42, 27230 }, // ε
-    { 11, 26, 13, 1, 21, 72, 27272 }, // ζ
-    { 12, 20, 14, 1, 14, 60, 27344 }, // η
-    { 14, 21, 16, 1, 20, 74, 27404 }, // θ
-    { 6, 15, 8, 1, 14, 23, 27478 }, // ι
-    { 13, 15, 15, 1, 14, 49, 27501 }, // κ
-    { 14, 21, 14, -1, 20, 74, 27550 }, // λ
-    { 16, 21, 16, -1, 14, 84, 27624 }, // μ
-    { 13, 15, 14, 0, 14, 49, 27708 }, // ν
-    { 11, 26, 13, 1, 21, 72, 27757 }, // ξ
-    { 12, 15, 14, 1, 14, 45, 27829 }, // ο
-    { 15, 15, 16, 0, 14, 57, 27874 }, // π
-    { 14, 20, 14, -1, 14, 70, 27931 }, // ρ
-    { 10, 19, 12, 1, 14, 48, 28001 }, // ς
-    { 14, 15, 16, 1, 14, 53, 28049 }, // σ
-    { 12, 15, 14, 1, 14, 45, 28102 }, // τ
-    { 12, 15, 14, 1, 14, 45, 28147 }, // υ
-    { 16, 20, 18, 1, 14, 80, 28192 }, // φ
-    { 16, 20, 15, -2, 14, 80, 28272 }, // χ
-    { 17, 24, 19, 1, 18, 102, 28352 }, // ψ
-    { 16, 15, 18, 1, 14, 60, 28454 }, // ω
-    { 19, 24, 18, -2, 18, 114, 28514 }, // Ạ
-    { 13, 20, 15, 1, 14, 65, 28628 }, // ạ
-    { 19, 26, 18, -2, 26, 124, 28693 }, // Ả
-    { 13, 23, 15, 1, 22, 75, 28817 }, // ả
-    { 21, 26, 20, -2, 26, 137, 28892 }, // Ấ
-    { 16, 25, 18, 1, 24, 100, 29029 }, // ấ
-    { 19, 26, 18, -2, 26, 124, 29129 }, // Ầ
-    { 13, 25, 15, 1, 24, 82, 29253 }, // ầ
-    { 21, 26, 20, -2, 26, 137, 29335 }, // Ẩ
-    { 16, 25, 18, 1, 24, 100, 29472 }, // ẩ
-    { 19, 26, 18, -2, 26, 124, 29572 }, // Ẫ
-    { 13, 25, 15, 1, 24, 82, 29696 }, // ẫ
-    { 19, 30, 18, -2, 24, 143, 29778 }, // Ậ
-    { 13, 27, 15, 1, 21, 88, 29921 }, // ậ
-    { 19, 26, 18, -2, 26, 124, 30009 }, // Ắ
-    { 13, 25, 15, 1, 24, 82, 30133 }, // ắ
-    { 19, 26, 18, -2, 26, 124, 30215 }, // Ằ
-    { 13, 25, 15, 1, 24, 82, 30339 }, // ằ
-    { 19, 26, 18, -2, 26, 124, 30421 }, // Ẳ
-    { 13, 26, 15, 1, 25, 85, 30545 }, // ẳ
-    { 19, 26, 18, -2, 26, 124, 30630 }, // Ẵ
-    { 13, 25, 15, 1, 24, 82, 30754 }, // ẵ
-    { 19, 30, 18, -2, 24, 143, 30836 }, // Ặ
-    { 13, 26, 15, 1, 20, 85, 30979 }, // ặ
-    { 17, 24, 17, -1, 18, 102, 31064 }, // Ẹ
-    { 11, 20, 13, 1, 14, 55, 31166 }, // ẹ
-    { 17, 26, 17, -1, 26, 111, 31221 }, // Ẻ
-    { 11, 23, 13, 1, 22, 64, 31332 }, // ẻ
-    { 17, 24, 17, -1, 24, 102, 31396 }, // Ẽ
-    { 12, 21, 14, 1, 20, 63, 31498 }, // ẽ
-    { 19, 26, 19, -1, 26, 124, 31561 }, // Ế
-    { 15, 25, 17, 1, 24, 94, 31685 }, // ế
-    { 17, 26, 17, -1, 26, 111, 31779 }, // Ề
-    { 12, 25, 14, 1, 24, 75, 31890 }, // ề
-    { 19, 26, 19, -1, 26, 124, 31965 }, // Ể
-    { 15, 25, 17, 1, 24, 94, 32089 }, // ể
-    { 17, 26, 17, -1, 26, 111, 32183 }, // Ễ
-    { 12, 25, 14, 1, 24, 75, 32294 }, // ễ
-    { 17, 30, 17, -1, 24, 128, 32369 }, // Ệ
-    { 11, 27, 13, 1, 21, 75, 32497 }, // ệ
-    { 12, 26, 12, -1, 26, 78, 32572 }, // Ỉ
-    { 9, 23, 11, 1, 22, 52, 32650 }, // ỉ
-    { 11, 24, 11, -1, 18, 66, 32702 }, // Ị
-    { 8, 26, 9, 0, 20, 52, 32768 }, // ị
-    { 17, 24, 19, 1, 18, 102, 32820 }, // Ọ
-    { 12, 20, 14, 1, 14, 60, 32922 }, // ọ
-    { 17, 27, 19, 1, 26, 115, 32982 }, // Ỏ
-    { 12, 23, 14, 1, 22, 69, 33097 }, // ỏ
-    { 18, 27, 20, 1, 26, 122, 33166 }, // Ố
-    { 16, 25, 18, 1, 24, 100, 33288 }, // ố
-    { 17, 27, 19, 1, 26, 115, 33388 }, // Ồ
-    { 13, 25, 15, 1, 24, 82, 33503 }, // ồ
-    { 18, 27, 20, 1, 26, 122, 33585 }, // Ổ
-    { 16, 25, 18, 1, 24, 100, 33707 }, // ổ
-    { 17, 27, 19, 1, 26, 115, 33807 }, // Ỗ
-    { 13, 25, 15, 1, 24, 82, 33922 }, // ỗ
-    { 17, 30, 19, 1, 24, 128, 34004 }, // Ộ
-    { 12, 27, 14, 1, 21, 81, 34132 }, // ộ
-    { 19, 25, 21, 1, 24, 119, 34213 }, // Ớ
-    { 14, 22, 16, 1, 21, 77, 34332 }, // ớ
-    { 19, 25, 21, 1, 24, 119, 34409 }, // Ờ
-    { 14, 22, 16, 1, 21, 77, 34528 }, // ờ
-    { 19, 27, 21, 1, 26, 129, 34605 }, // Ở
-    { 14, 23, 16, 1, 22, 81, 34734 }, // ở
-    { 19, 25, 21, 1, 24, 119, 34815 }, // Ỡ
-    { 14, 21, 16, 1, 20, 74, 34934 }, // ỡ
-    { 19, 27, 21, 1, 21, 129, 35008 }, // Ợ
-    { 14, 22, 16, 1, 16, 77, 35137 }, // ợ
-    { 18, 24, 21, 2, 18, 108, 35214 }, // Ụ
-    { 14, 19, 16, 1, 13, 67, 35322 }, // ụ
-    { 18, 27, 21, 2, 26, 122, 35389 }, // Ủ
-    { 14, 23, 16, 1, 22, 81, 35511 }, // ủ
-    { 20, 25, 23, 2, 24, 125, 35592 }, // Ứ
-    { 16, 22, 18, 1, 21, 88, 35717 }, // ứ
-    { 20, 25, 23, 2, 24, 125, 35805 }, // Ừ
-    { 16, 22, 18, 1, 21, 88, 35930 }, // ừ
-    { 20, 27, 23, 2, 26, 135, 36018 }, // Ử
-    { 16, 23, 18, 1, 22, 92, 36153 }, // ử
-    { 20, 25, 23, 2, 24, 125, 36245 }, // Ữ
-    { 16, 21, 18, 1, 20, 84, 36370 }, // ữ
-    { 20, 27, 23, 2, 21, 135, 36454 }, // Ự
-    { 16, 22, 18, 1, 16, 88, 36589 }, // ự
-    { 17, 24, 19, 1, 24, 102, 36677 }, // Ỳ
-    { 16, 27, 14, -3, 21, 108, 36779 }, // ỳ
-    { 17, 24, 19, 1, 18, 102, 36887 }, // Ỵ
-    { 16, 20, 14, -3, 14, 80, 36989 }, // ỵ
-    { 17, 26, 19, 1, 26, 111, 37069 }, // Ỷ
-    { 16, 28, 14, -3, 22, 112, 37180 }, // ỷ
-    { 17, 24, 19, 1, 24, 102, 37292 }, // Ỹ
-    { 16, 26, 14, -3, 20, 104, 37394 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 37498 }, //  
-    { 0, 0, 25, 0, 0, 0, 37498 }, //  
-    { 0, 0, 13, 0, 0, 0, 37498 }, //  
-    { 0, 0, 25, 0, 0, 0, 37498 }, //  
-    { 0, 0, 8, 0, 0, 0, 37498 }, //  
-    { 0, 0, 6, 0, 0, 0, 37498 }, //  
-    { 0, 0, 4, 0, 0, 0, 37498 }, //  
-    { 0, 0, 16, 0, 0, 0, 37498 }, //  
-    { 0, 0, 7, 0, 0, 0, 37498 }, //  
-    { 0, 0, 5, 0, 0, 0, 37498 }, //  
-    { 0, 0, 1, 0, 0, 0, 37498 }, //  
-    { 0, 0, 1, 0, 0, 0, 37498 }, // ​
-    { 2, 21, 2, -1, 15, 11, 37498 }, // ‌
-    { 6, 23, 4, -3, 17, 35, 37509 }, // ‍
-    { 8, 24, 5, -4, 18, 48, 37544 }, // ‎
-    { 8, 24, 5, -4, 18, 48, 37592 }, // ‏
-    { 8, 3, 10, 1, 8, 6, 37640 }, // ‐
-    { 8, 3, 10, 1, 8, 6, 37646 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 37652 }, // ‒
-    { 13, 3, 14, 0, 8, 10, 37661 }, // –
-    { 25, 3, 26, 0, 8, 19, 37671 }, // —
-    { 25, 3, 26, 0, 8, 19, 37690 }, // ―
-    { 8, 26, 13, 2, 20, 52, 37709 }, // ‖
-    { 13, 6, 14, 0, -1, 20, 37761 }, // ‗
-    { 6, 8, 9, 2, 19, 12, 37781 }, // ‘
-    { 6, 8, 8, 1, 19, 12, 37793 }, // ’
-    { 6, 9, 8, 0, 4, 14, 37805 }, // ‚
-    { 5, 8, 7, 1, 19, 10, 37819 }, // ‛
-    { 11, 8, 14, 2, 19, 22, 37829 }, // “
-    { 11, 8, 13, 1, 19, 22, 37851 }, // ”
-    { 11, 9, 13, 0, 4, 25, 37873 }, // „
-    { 10, 8, 12, 1, 19, 20, 37898 }, // ‟
-    { 11, 17, 13, 1, 18, 47, 37918 }, // †
-    { 12, 20, 13, 0, 18, 60, 37965 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 38025 }, // •
-    { 9, 9, 16, 3, 13, 21, 38034 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 38055 }, // ․
-    { 10, 5, 13, 1, 4, 13, 38060 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 38073 }, // …
-    { 5, 4, 7, 1, 9, 5, 38100 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 38105 }, //  
-    { 0, 0, 1, 0, 0, 0, 38105 }, //  
-    { 8, 24, 5, -4, 18, 48, 38105 }, // ‪
-    { 8, 24, 5, -4, 18, 48, 38153 }, // ‫
-    { 8, 24, 5, -4, 18, 48, 38201 }, // ‬
-    { 11, 24, 7, -5, 18, 66, 38249 }, // ‭
-    { 11, 24, 7, -5, 18, 66, 38315 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 38381 }, //  
-    { 32, 21, 34, 1, 19, 168, 38381 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 38549 }, // ′
-    { 10, 9, 12, 1, 18, 23, 38561 }, // ″
-    { 15, 9, 17, 1, 18, 34, 38584 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 38618 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 38632 }, // ‶
-    { 17, 9, 18, 0, 18, 39, 38657 }, // ‷
-    { 11, 6, 13, 1, 0, 17, 38696 }, // ‸
-    { 8, 10, 9, 0, 11, 20, 38713 }, // ‹
-    { 7, 10, 8, 0, 11, 18, 38733 }, // ›
-    { 16, 18, 17, 0, 17, 72, 38751 }, // ※
-    { 14, 20, 16, 1, 19, 70, 38823 }, // ‼
-    { 13, 3, 14, 0, 21, 10, 38893 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 38903 }, // ⁃
-    { 16, 21, 12, -5, 19, 84, 38908 }, // ⁄
-    { 18, 19, 21, 2, 18, 86, 38992 }, // ⁇
-    { 16, 20, 19, 2, 19, 80, 39078 }, // ⁈
-    { 17, 20, 19, 1, 19, 85, 39158 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 39243 }, // ⁓
-    { 20, 9, 22, 1, 18, 45, 39262 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 39307 }, //  
-    { 0, 0, 1, 0, 0, 0, 39307 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 39307 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 39307 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 39307 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 39307 }, // ⁤
-    { 10, 12, 12, 1, 21, 30, 39307 }, // ⁰
-    { 11, 12, 12, 0, 21, 33, 39337 }, // ⁴
-    { 10, 12, 12, 1, 21, 30, 39370 }, // ⁵
-    { 10, 12, 12, 1, 21, 30, 39400 }, // ⁶
-    { 9, 12, 12, 2, 21, 27, 39430 }, // ⁷
-    { 9, 12, 11, 1, 21, 27, 39457 }, // ⁸
-    { 10, 12, 11, 0, 21, 30, 39484 }, // ⁹
-    { 10, 9, 14, 2, 18, 23, 39514 }, // ⁿ
-    { 10, 12, 12, 1, 8, 30, 39537 }, // ₀
-    { 7, 13, 11, 2, 9, 23, 39567 }, // ₁
-    { 10, 12, 11, 0, 8, 30, 39590 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 39620 }, // ₃
-    { 11, 12, 12, 0, 8, 33, 39647 }, // ₄
-    { 10, 12, 12, 1, 8, 30, 39680 }, // ₅
-    { 10, 12, 12, 1, 8, 30, 39710 }, // ₆
-    { 9, 12, 12, 2, 8, 27, 39740 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 39767 }, // ₈
-    { 10, 12, 11, 0, 8, 30, 39794 }, // ₉
-    { 16, 18, 17, 0, 18, 72, 39824 }, // ₣
-    { 17, 19, 17, -1, 18, 81, 39896 }, // ₤
-    { 30, 19, 31, 0, 18, 143, 39977 }, // ₧
-    { 18, 19, 18, -1, 18, 86, 40120 }, // €
-    { 15, 11, 25, 5, 14, 42, 40206 }, // ←
-    { 11, 17, 25, 7, 17, 47, 40248 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 40295 }, // →
-    { 11, 17, 25, 7, 17, 47, 40337 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 40384 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 40426 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 40473 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 40520 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 40567 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 40614 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 40653 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 40695 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 40737 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 40779 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 40821 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 40863 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 40944 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 41013 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 41063 }, // ∅
-    { 16, 18, 17, 0, 18, 72, 41158 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 41230 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 41311 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 41388 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 41482 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 41542 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 41619 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 41713 }, // ∍
-    { 19, 22, 21, 1, 18, 105, 41773 }, // ∏
-    { 15, 23, 16, 0, 18, 87, 41878 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 41965 }, // −
-    { 14, 20, 14, -1, 18, 70, 41974 }, // ∕
-    { 10, 20, 12, 1, 18, 50, 42044 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 42094 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 42133 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 42154 }, // ∙
-    { 16, 24, 17, 0, 21, 96, 42158 }, // √
-    { 13, 10, 16, 1, 13, 33, 42254 }, // ∝
-    { 16, 9, 17, 0, 12, 36, 42287 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 42323 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 42395 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 42476 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 42496 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 42548 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 42625 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 42702 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 42770 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 42842 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 42933 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 42993 }, // ∵
-    { 5, 13, 8, 1, 15, 17, 43053 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 43070 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 43130 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 43149 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 43198 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 43225 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 43255 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 43286 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 43328 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 43373 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 43418 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 43487 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 43556 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 43620 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 43718 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 43816 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 43893 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 43970 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 44061 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 44152 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 44243 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 44334 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 44402 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 44406 }, // ⋯
-    { 25, 24, 26, 0, 21, 150, 44427 }, // �
+    { 7, 20, 9, 1, 19, 29, 0 }, // !
+    { 9, 8, 11, 1, 18, 25, 29 }, // "
+    { 16, 15, 17, 0, 14, 54, 54 }, // #
+    { 15, 25, 16, 0, 20, 72, 108 }, // $
+    { 22, 21, 24, 1, 19, 89, 180 }, // %
+    { 21, 21, 23, 1, 19, 79, 269 }, // &
+    { 4, 8, 6, 1, 18, 13, 348 }, // '
+    { 11, 25, 13, 1, 20, 44, 361 }, // (
+    { 11, 25, 10, -2, 20, 46, 405 }, // )
+    { 9, 9, 11, 1, 19, 23, 451 }, // *
+    { 11, 11, 16, 2, 14, 25, 474 }, // +
+    { 6, 9, 8, -1, 4, 13, 499 }, // ,
+    { 8, 3, 10, 1, 8, 10, 512 }, // -
+    { 4, 5, 8, 1, 4, 6, 522 }, // .
+    { 14, 20, 14, -1, 18, 41, 528 }, // /
+    { 15, 19, 16, 0, 18, 51, 569 }, // 0
+    { 10, 18, 16, 2, 18, 30, 620 }, // 1
+    { 14, 18, 16, 0, 18, 49, 650 }, // 2
+    { 14, 19, 16, 0, 18, 46, 699 }, // 3
+    { 15, 18, 16, 0, 18, 47, 745 }, // 4
+    { 14, 19, 16, 1, 18, 39, 792 }, // 5
+    { 15, 19, 17, 1, 18, 51, 831 }, // 6
+    { 13, 19, 17, 3, 18, 41, 882 }, // 7
+    { 14, 19, 16, 1, 18, 52, 923 }, // 8
+    { 15, 19, 16, 0, 18, 51, 975 }, // 9
+    { 7, 14, 9, 1, 13, 14, 1026 }, // :
+    { 9, 18, 9, -1, 13, 21, 1040 }, // ;
+    { 12, 13, 16, 2, 15, 25, 1061 }, // <
+    { 11, 7, 16, 2, 12, 18, 1086 }, // =
+    { 12, 13, 16, 2, 15, 23, 1104 }, // >
+    { 8, 19, 11, 2, 18, 30, 1127 }, // ?
+    { 23, 23, 25, 1, 18, 108, 1157 }, // @
+    { 19, 18, 18, -2, 18, 59, 1265 }, // A
+    { 16, 19, 16, -1, 18, 61, 1324 }, // B
+    { 15, 19, 17, 1, 18, 47, 1385 }, // C
+    { 19, 19, 19, -1, 18, 62, 1432 }, // D
+    { 17, 18, 17, -1, 18, 53, 1494 }, // E
+    { 16, 18, 16, -1, 18, 49, 1547 }, // F
+    { 16, 19, 18, 1, 18, 51, 1596 }, // G
+    { 22, 18, 22, -1, 18, 66, 1647 }, // H
+    { 11, 18, 11, -1, 18, 33, 1713 }, // I
+    { 16, 23, 12, -5, 18, 52, 1746 }, // J
+    { 20, 19, 20, -1, 18, 67, 1798 }, // K
+    { 15, 18, 15, -1, 18, 45, 1865 }, // L
+    { 25, 18, 24, -2, 18, 92, 1910 }, // M
+    { 21, 19, 21, -1, 18, 75, 2002 }, // N
+    { 17, 19, 19, 1, 18, 58, 2077 }, // O
+    { 16, 18, 16, -1, 18, 51, 2135 }, // P
+    { 21, 24, 23, 1, 18, 79, 2186 }, // Q
+    { 17, 19, 17, -1, 18, 62, 2265 }, // R
+    { 13, 19, 14, 0, 18, 53, 2327 }, // S
+    { 15, 18, 18, 2, 18, 54, 2380 }, // T
+    { 18, 19, 21, 2, 18, 61, 2434 }, // U
+    { 19, 19, 21, 1, 18, 62, 2495 }, // V
+    { 26, 19, 29, 2, 18, 97, 2557 }, // W
+    { 20, 18, 19, -2, 18, 63, 2654 }, // X
+    { 17, 18, 19, 1, 18, 54, 2717 }, // Y
+    { 16, 19, 16, -1, 18, 51, 2771 }, // Z
+    { 10, 24, 10, -1, 20, 39, 2822 }, // [
+    { 10, 20, 12, 1, 18, 29, 2861 }, // <backslash>
+    { 10, 24, 10, -1, 20, 40, 2890 }, // ]
+    { 12, 12, 16, 2, 16, 31, 2930 }, // ^
+    { 13, 2, 14, 0, -1, 4, 2961 }, // _
+    { 5, 7, 15, 5, 21, 8, 2965 }, // `
+    { 13, 15, 15, 1, 14, 44, 2973 }, // a
+    { 13, 21, 14, 0, 20, 58, 3017 }, // b
+    { 10, 15, 12, 1, 14, 29, 3075 }, // c
+    { 14, 21, 16, 1, 20, 59, 3104 }, // d
+    { 11, 15, 13, 1, 14, 36, 3163 }, // e
+    { 18, 26, 14, -5, 20, 56, 3199 }, // f
+    { 17, 20, 15, -3, 14, 60, 3255 }, // g
+    { 15, 21, 16, 0, 20, 61, 3315 }, // h
+    { 7, 21, 9, 1, 20, 29, 3376 }, // i
+    { 13, 26, 9, -5, 20, 49, 3405 }, // j
+    { 12, 21, 14, 1, 20, 57, 3454 }, // k
+    { 7, 21, 9, 1, 20, 36, 3511 }, // l
+    { 21, 15, 23, 1, 14, 70, 3547 }, // m
+    { 14, 15, 16, 1, 14, 47, 3617 }, // n
+    { 12, 15, 14, 1, 14, 38, 3664 }, // o
+    { 16, 20, 15, -2, 14, 61, 3702 }, // p
+    { 13, 20, 15, 1, 14, 56, 3763 }, // q
+    { 11, 14, 13, 1, 14, 30, 3819 }, // r
+    { 10, 15, 11, 0, 14, 31, 3849 }, // s
+    { 10, 18, 11, 0, 17, 32, 3880 }, // t
+    { 14, 14, 16, 1, 13, 45, 3912 }, // u
+    { 13, 15, 14, 0, 14, 35, 3957 }, // v
+    { 19, 15, 20, 0, 14, 59, 3992 }, // w
+    { 16, 15, 16, -1, 14, 42, 4051 }, // x
+    { 16, 20, 14, -3, 14, 58, 4093 }, // y
+    { 12, 14, 13, 0, 13, 35, 4151 }, // z
+    { 10, 25, 12, 1, 20, 42, 4186 }, // {
+    { 7, 23, 8, 0, 20, 35, 4228 }, // |
+    { 10, 25, 10, -1, 20, 37, 4263 }, // }
+    { 12, 5, 16, 2, 11, 15, 4300 }, // ~
+    { 0, 0, 5, 0, 0, 0, 4315 }, //  
+    { 8, 20, 8, -1, 14, 27, 4315 }, // ¡
+    { 12, 25, 16, 2, 20, 63, 4342 }, // ¢
+    { 17, 19, 17, -1, 18, 51, 4405 }, // £
+    { 16, 13, 17, 0, 15, 42, 4456 }, // ¤
+    { 17, 18, 19, 1, 18, 55, 4498 }, // ¥
+    { 7, 23, 8, 0, 20, 31, 4553 }, // ¦
+    { 12, 21, 13, 0, 18, 56, 4584 }, // §
+    { 9, 4, 15, 3, 19, 11, 4640 }, // ¨
+    { 19, 19, 20, 0, 18, 87, 4651 }, // ©
+    { 10, 12, 12, 1, 18, 33, 4738 }, // ª
+    { 13, 10, 14, 0, 11, 27, 4771 }, // «
+    { 11, 7, 16, 2, 12, 18, 4798 }, // ¬
+    { 8, 3, 10, 1, 8, 10, 4816 }, // ­
+    { 14, 14, 15, 0, 20, 63, 4826 }, // ®
+    { 9, 3, 15, 3, 18, 7, 4889 }, // ¯
+    { 9, 9, 13, 2, 18, 25, 4896 }, // °
+    { 11, 15, 16, 2, 15, 27, 4921 }, // ±
+    { 10, 12, 11, 0, 21, 27, 4948 }, // ²
+    { 9, 12, 11, 1, 21, 26, 4975 }, // ³
+    { 6, 7, 15, 5, 21, 8, 5001 }, // ´
+    { 16, 21, 16, -1, 14, 61, 5009 }, // µ
+    { 16, 22, 16, -1, 18, 73, 5070 }, // ¶
+    { 4, 4, 8, 2, 9, 7, 5143 }, // ·
+    { 6, 6, 15, 5, -1, 10, 5150 }, // ¸
+    { 7, 12, 11, 2, 21, 23, 5160 }, // ¹
+    { 10, 12, 12, 1, 18, 32, 5183 }, // º
+    { 12, 10, 13, 0, 11, 29, 5215 }, // »
+    { 24, 21, 27, 2, 19, 86, 5244 }, // ¼
+    { 24, 21, 27, 2, 19, 86, 5330 }, // ½
+    { 25, 21, 27, 1, 19, 87, 5416 }, // ¾
+    { 9, 20, 10, 0, 14, 33, 5503 }, // ¿
+    { 19, 24, 18, -2, 24, 72, 5536 }, // À
+    { 19, 24, 18, -2, 24, 71, 5608 }, // Á
+    { 19, 24, 18, -2, 24, 75, 5679 }, // Â
+    { 19, 24, 18, -2, 24, 74, 5754 }, // Ã
+    { 19, 23, 18, -2, 23, 72, 5828 }, // Ä
+    { 19, 25, 18, -2, 25, 77, 5900 }, // Å
+    { 25, 18, 24, -2, 18, 79, 5977 }, // Æ
+    { 15, 25, 17, 1, 18, 59, 6056 }, // Ç
+    { 17, 24, 17, -1, 24, 65, 6115 }, // È
+    { 17, 24, 17, -1, 24, 65, 6180 }, // É
+    { 17, 24, 17, -1, 24, 68, 6245 }, // Ê
+    { 17, 23, 17, -1, 23, 66, 6313 }, // Ë
+    { 11, 24, 11, -1, 24, 43, 6379 }, // Ì
+    { 12, 24, 12, -1, 24, 49, 6422 }, // Í
+    { 13, 24, 13, -1, 24, 53, 6471 }, // Î
+    { 13, 23, 13, -1, 23, 50, 6524 }, // Ï
+    { 19, 19, 19, -1, 18, 66, 6574 }, // Ð
+    { 21, 25, 21, -1, 24, 90, 6640 }, // Ñ
+    { 17, 25, 19, 1, 24, 70, 6730 }, // Ò
+    { 17, 25, 19, 1, 24, 71, 6800 }, // Ó
+    { 17, 25, 19, 1, 24, 74, 6871 }, // Ô
+    { 17, 25, 19, 1, 24, 73, 6945 }, // Õ
+    { 17, 24, 19, 1, 23, 70, 7018 }, // Ö
+    { 10, 11, 16, 3, 14, 25, 7088 }, // ×
+    { 20, 19, 20, -1, 18, 71, 7113 }, // Ø
+    { 18, 25, 21, 2, 24, 73, 7184 }, // Ù
+    { 18, 25, 21, 2, 24, 73, 7257 }, // Ú
+    { 18, 25, 21, 2, 24, 76, 7330 }, // Û
+    { 18, 24, 21, 2, 23, 73, 7406 }, // Ü
+    { 17, 24, 19, 1, 24, 66, 7479 }, // Ý
+    { 15, 18, 15, -1, 18, 51, 7545 }, // Þ
+    { 20, 26, 17, -4, 20, 88, 7596 }, // ß
+    { 13, 22, 15, 1, 21, 56, 7684 }, // à
+    { 13, 22, 15, 1, 21, 56, 7740 }, // á
+    { 13, 22, 15, 1, 21, 57, 7796 }, // â
+    { 13, 21, 15, 1, 20, 57, 7853 }, // ã
+    { 13, 20, 15, 1, 19, 56, 7910 }, // ä
+    { 13, 22, 15, 1, 21, 62, 7966 }, // å
+    { 18, 15, 20, 1, 14, 59, 8028 }, // æ
+    { 10, 21, 12, 1, 14, 39, 8087 }, // ç
+    { 11, 22, 13, 1, 21, 47, 8126 }, // è
+    { 11, 22, 13, 1, 21, 47, 8173 }, // é
+    { 11, 22, 13, 1, 21, 50, 8220 }, // ê
+    { 12, 20, 14, 1, 19, 50, 8270 }, // ë
+    { 7, 22, 9, 1, 21, 32, 8320 }, // ì
+    { 9, 22, 11, 1, 21, 33, 8352 }, // í
+    { 9, 22, 11, 1, 21, 36, 8385 }, // î
+    { 10, 20, 12, 1, 19, 36, 8421 }, // ï
+    { 13, 21, 14, 0, 20, 56, 8457 }, // ð
+    { 14, 21, 16, 1, 20, 61, 8513 }, // ñ
+    { 12, 22, 14, 1, 21, 50, 8574 }, // ò
+    { 12, 22, 14, 1, 21, 49, 8624 }, // ó
+    { 12, 22, 14, 1, 21, 52, 8673 }, // ô
+    { 13, 21, 15, 1, 20, 53, 8725 }, // õ
+    { 13, 20, 15, 1, 19, 53, 8778 }, // ö
+    { 11, 13, 16, 2, 15, 26, 8831 }, // ÷
+    { 16, 15, 16, -1, 14, 48, 8857 }, // ø
+    { 14, 22, 16, 1, 21, 58, 8905 }, // ù
+    { 14, 22, 16, 1, 21, 58, 8963 }, // ú
+    { 14, 22, 16, 1, 21, 61, 9021 }, // û
+    { 14, 20, 16, 1, 19, 58, 9082 }, // ü
+    { 16, 27, 14, -3, 21, 70, 9140 }, // ý
+    { 15, 26, 14, -2, 20, 72, 9210 }, // þ
+    { 16, 25, 14, -3, 19, 71, 9282 }, // ÿ
+    { 19, 23, 18, -2, 23, 68, 9353 }, // Ā
+    { 13, 19, 15, 1, 18, 51, 9421 }, // ā
+    { 19, 24, 18, -2, 24, 76, 9472 }, // Ă
+    { 13, 21, 15, 1, 20, 55, 9548 }, // ă
+    { 19, 24, 18, -2, 18, 74, 9603 }, // Ą
+    { 13, 20, 15, 1, 14, 55, 9677 }, // ą
+    { 15, 25, 17, 1, 24, 58, 9732 }, // Ć
+    { 11, 22, 13, 1, 21, 39, 9790 }, // ć
+    { 15, 25, 17, 1, 24, 60, 9829 }, // Ĉ
+    { 11, 22, 13, 1, 21, 42, 9889 }, // ĉ
+    { 15, 25, 17, 1, 24, 55, 9931 }, // Ċ
+    { 10, 20, 12, 1, 19, 36, 9986 }, // ċ
+    { 16, 26, 18, 1, 25, 61, 10022 }, // Č
+    { 12, 22, 14, 1, 21, 47, 10083 }, // č
+    { 19, 26, 19, -1, 25, 82, 10130 }, // Ď
+    { 18, 23, 20, 1, 22, 71, 10212 }, // ď
+    { 19, 19, 19, -1, 18, 66, 10283 }, // Đ
+    { 15, 21, 17, 1, 20, 61, 10349 }, // đ
+    { 17, 23, 17, -1, 23, 60, 10410 }, // Ē
+    { 12, 19, 14, 1, 18, 45, 10470 }, // ē
+    { 17, 24, 17, -1, 24, 67, 10515 }, // Ĕ
+    { 12, 21, 14, 1, 20, 48, 10582 }, // ĕ
+    { 17, 24, 17, -1, 24, 62, 10630 }, // Ė
+    { 11, 20, 13, 1, 19, 44, 10692 }, // ė
+    { 17, 24, 17, -1, 18, 65, 10736 }, // Ę
+    { 11, 20, 13, 1, 14, 45, 10801 }, // ę
+    { 17, 25, 17, -1, 25, 68, 10846 }, // Ě
+    { 12, 22, 14, 1, 21, 52, 10914 }, // ě
+    { 17, 25, 19, 1, 24, 72, 10966 }, // Ĝ
+    { 17, 27, 15, -3, 21, 75, 11038 }, // ĝ
+    { 17, 25, 19, 1, 24, 72, 11113 }, // Ğ
+    { 17, 26, 15, -3, 20, 74, 11185 }, // ğ
+    { 17, 25, 19, 1, 24, 67, 11259 }, // Ġ
+    { 17, 25, 15, -3, 19, 70, 11326 }, // ġ
+    { 17, 25, 19, 1, 18, 68, 11396 }, // Ģ
+    { 17, 28, 15, -3, 22, 75, 11464 }, // ģ
+    { 22, 24, 22, -1, 24, 83, 11539 }, // Ĥ
+    { 15, 27, 16, 0, 26, 74, 11622 }, // ĥ
+    { 22, 18, 22, -1, 18, 70, 11696 }, // Ħ
+    { 15, 21, 16, 0, 20, 64, 11766 }, // ħ
+    { 13, 24, 13, -1, 24, 53, 11830 }, // Ĩ
+    { 10, 21, 12, 1, 20, 35, 11883 }, // ĩ
+    { 13, 23, 13, -1, 23, 47, 11918 }, // Ī
+    { 10, 19, 12, 1, 18, 30, 11965 }, // ī
+    { 13, 24, 13, -1, 24, 52, 11995 }, // Ĭ
+    { 10, 21, 12, 1, 20, 34, 12047 }, // ĭ
+    { 11, 24, 11, -1, 18, 44, 12081 }, // Į
+    { 7, 26, 9, 1, 20, 38, 12125 }, // į
+    { 11, 24, 11, -1, 24, 40, 12163 }, // İ
+    { 6, 14, 8, 1, 13, 21, 12203 }, // ı
+    { 21, 23, 21, -1, 18, 80, 12224 }, // Ĳ
+    { 15, 26, 17, 1, 20, 69, 12304 }, // ĳ
+    { 17, 29, 13, -5, 24, 67, 12373 }, // Ĵ
+    { 15, 27, 11, -5, 21, 56, 12440 }, // ĵ
+    { 20, 25, 20, -1, 18, 82, 12496 }, // Ķ
+    { 12, 27, 14, 1, 20, 67, 12578 }, // ķ
+    { 12, 15, 14, 1, 14, 42, 12645 }, // ĸ
+    { 15, 24, 15, -1, 24, 57, 12687 }, // Ĺ
+    { 9, 27, 11, 1, 26, 46, 12744 }, // ĺ
+    { 15, 25, 15, -1, 18, 56, 12790 }, // Ļ
+    { 9, 27, 9, -1, 20, 44, 12846 }, // ļ
+    { 16, 20, 16, -1, 20, 52, 12890 }, // Ľ
+    { 11, 23, 13, 1, 22, 48, 12942 }, // ľ
+    { 16, 18, 16, -1, 18, 49, 12990 }, // Ŀ
+    { 10, 21, 12, 1, 20, 43, 13039 }, // ŀ
+    { 15, 18, 15, -1, 18, 47, 13082 }, // Ł
+    { 10, 21, 10, -1, 20, 38, 13129 }, // ł
+    { 21, 25, 21, -1, 24, 87, 13167 }, // Ń
+    { 14, 22, 16, 1, 21, 60, 13254 }, // ń
+    { 21, 25, 21, -1, 18, 89, 13314 }, // Ņ
+    { 14, 21, 16, 1, 14, 60, 13403 }, // ņ
+    { 21, 26, 21, -1, 25, 91, 13463 }, // Ň
+    { 14, 22, 16, 1, 21, 64, 13554 }, // ň
+    { 19, 20, 21, 1, 19, 65, 13618 }, // ŉ
+    { 21, 23, 21, -1, 18, 87, 13683 }, // Ŋ
+    { 13, 20, 15, 1, 14, 57, 13770 }, // ŋ
+    { 17, 24, 19, 1, 23, 67, 13827 }, // Ō
+    { 13, 19, 15, 1, 18, 48, 13894 }, // ō
+    { 17, 25, 19, 1, 24, 72, 13942 }, // Ŏ
+    { 13, 21, 15, 1, 20, 51, 14014 }, // ŏ
+    { 18, 26, 20, 1, 25, 79, 14065 }, // Ő
+    { 14, 22, 16, 1, 21, 58, 14144 }, // ő
+    { 23, 19, 25, 1, 18, 85, 14202 }, // Œ
+    { 19, 15, 21, 1, 14, 58, 14287 }, // œ
+    { 17, 25, 17, -1, 24, 74, 14345 }, // Ŕ
+    { 11, 21, 13, 1, 21, 38, 14419 }, // ŕ
+    { 17, 25, 17, -1, 18, 73, 14457 }, // Ŗ
+    { 13, 21, 13, -1, 14, 45, 14530 }, // ŗ
+    { 17, 26, 17, -1, 25, 79, 14575 }, // Ř
+    { 12, 21, 14, 1, 21, 45, 14654 }, // ř
+    { 13, 25, 14, 0, 24, 63, 14699 }, // Ś
+    { 11, 22, 12, 0, 21, 42, 14762 }, // ś
+    { 13, 25, 14, 0, 24, 67, 14804 }, // Ŝ
+    { 11, 22, 12, 0, 21, 46, 14871 }, // ŝ
+    { 13, 25, 14, 0, 18, 65, 14917 }, // Ş
+    { 10, 21, 11, 0, 14, 40, 14982 }, // ş
+    { 14, 26, 15, 0, 25, 68, 15022 }, // Š
+    { 12, 22, 13, 0, 21, 48, 15090 }, // š
+    { 15, 25, 18, 2, 18, 67, 15138 }, // Ţ
+    { 10, 24, 11, 0, 17, 42, 15205 }, // ţ
+    { 15, 25, 18, 2, 25, 68, 15247 }, // Ť
+    { 11, 21, 12, 0, 20, 41, 15315 }, // ť
+    { 15, 18, 18, 2, 18, 57, 15356 }, // Ŧ
+    { 10, 18, 11, 0, 17, 35, 15413 }, // ŧ
+    { 18, 25, 21, 2, 24, 75, 15448 }, // Ũ
+    { 14, 21, 16, 1, 20, 58, 15523 }, // ũ
+    { 18, 24, 21, 2, 23, 70, 15581 }, // Ū
+    { 14, 19, 16, 1, 18, 53, 15651 }, // ū
+    { 18, 25, 21, 2, 24, 77, 15704 }, // Ŭ
+    { 14, 21, 16, 1, 20, 59, 15781 }, // ŭ
+    { 18, 26, 21, 2, 25, 79, 15840 }, // Ů
+    { 14, 22, 16, 1, 21, 65, 15919 }, // ů
+    { 18, 26, 21, 2, 25, 81, 15984 }, // Ű
+    { 14, 22, 16, 1, 21, 63, 16065 }, // ű
+    { 18, 24, 21, 2, 18, 73, 16128 }, // Ų
+    { 14, 19, 16, 1, 13, 54, 16201 }, // ų
+    { 26, 25, 29, 2, 24, 116, 16255 }, // Ŵ
+    { 19, 22, 20, 0, 21, 77, 16371 }, // ŵ
+    { 17, 24, 19, 1, 24, 69, 16448 }, // Ŷ
+    { 16, 27, 14, -3, 21, 74, 16517 }, // ŷ
+    { 17, 23, 19, 1, 23, 66, 16591 }, // Ÿ
+    { 16, 25, 16, -1, 24, 64, 16657 }, // Ź
+    { 12, 22, 13, 0, 21, 47, 16721 }, // ź
+    { 16, 25, 16, -1, 24, 62, 16768 }, // Ż
+    { 12, 20, 13, 0, 19, 44, 16830 }, // ż
+    { 16, 26, 16, -1, 25, 69, 16874 }, // Ž
+    { 12, 22, 13, 0, 21, 49, 16943 }, // ž
+    { 18, 26, 14, -5, 20, 57, 16992 }, // ſ
+    { 19, 22, 21, 1, 21, 70, 17049 }, // Ơ
+    { 14, 17, 16, 1, 16, 48, 17119 }, // ơ
+    { 16, 18, 17, 0, 18, 52, 17167 }, // Ƥ
+    { 16, 26, 15, -2, 20, 73, 17219 }, // ƥ
+    { 10, 23, 11, 0, 17, 43, 17292 }, // ƫ
+    { 16, 18, 18, 1, 18, 52, 17335 }, // Ƭ
+    { 13, 21, 14, 0, 20, 45, 17387 }, // ƭ
+    { 15, 23, 18, 2, 18, 65, 17432 }, // Ʈ
+    { 20, 22, 23, 2, 21, 70, 17497 }, // Ư
+    { 16, 17, 18, 1, 16, 53, 17567 }, // ư
+    { 6, 7, 3, -4, 21, 8, 17620 }, // ̀
+    { 6, 7, 5, -2, 21, 8, 17628 }, // ́
+    { 9, 7, 5, -5, 21, 13, 17636 }, // ̂
+    { 8, 5, 5, -4, 20, 11, 17649 }, // ̃
+    { 8, 3, 5, -4, 18, 7, 17660 }, // ̄
+    { 8, 5, 5, -4, 20, 11, 17667 }, // ̆
+    { 4, 4, 3, -2, 19, 7, 17678 }, // ̇
+    { 10, 4, 6, -5, 19, 11, 17685 }, // ̈
+    { 7, 8, 5, -3, 22, 14, 17696 }, // ̉
+    { 8, 7, 5, -4, 21, 16, 17710 }, // ̊
+    { 10, 7, 7, -4, 21, 18, 17726 }, // ̋
+    { 9, 6, 6, -4, 21, 14, 17744 }, // ̌
+    { 8, 7, 4, -5, 21, 17, 17758 }, // ̏
+    { 9, 5, 5, -5, 20, 12, 17775 }, // ̑
+    { 6, 8, 4, -3, 22, 12, 17787 }, // ̒
+    { 5, 7, 4, -2, 22, 11, 17799 }, // ̓
+    { 5, 7, 3, -3, 22, 12, 17810 }, // ̔
+    { 4, 7, 3, -2, 22, 9, 17822 }, // ̕
+    { 6, 6, 4, -3, 16, 9, 17831 }, // ̛
+    { 4, 4, 3, -2, -2, 7, 17840 }, // ̣
+    { 10, 4, 6, -5, -2, 11, 17847 }, // ̤
+    { 6, 6, 4, -3, -1, 13, 17858 }, // ̥
+    { 5, 6, 3, -3, -1, 10, 17871 }, // ̦
+    { 6, 6, 4, -3, -1, 12, 17881 }, // ̧
+    { 6, 7, 4, -3, 1, 10, 17893 }, // ̨
+    { 5, 6, 7, -1, -1, 10, 17903 }, // ̩
+    { 9, 6, 5, -5, -1, 11, 17913 }, // ̭
+    { 8, 5, 5, -4, -1, 11, 17924 }, // ̮
+    { 8, 5, 5, -4, -1, 11, 17935 }, // ̰
+    { 8, 3, 5, -4, -2, 10, 17946 }, // ̱
+    { 9, 5, 5, -5, 20, 12, 17956 }, // ͂
+    { 9, 10, 5, -5, 25, 21, 17968 }, // ̈́
+    { 5, 5, 4, -2, -1, 7, 17989 }, // ͅ
+    { 19, 18, 18, -2, 18, 59, 17996 }, // Α
+    { 16, 19, 16, -1, 18, 61, 18055 }, // Β
+    { 16, 18, 16, -1, 18, 50, 18116 }, // Γ
+    { 15, 18, 17, 0, 18, 54, 18166 }, // Δ
+    { 17, 18, 17, -1, 18, 53, 18220 }, // Ε
+    { 16, 19, 16, -1, 18, 51, 18273 }, // Ζ
+    { 22, 18, 22, -1, 18, 66, 18324 }, // Η
+    { 17, 19, 19, 1, 18, 64, 18390 }, // Θ
+    { 11, 18, 11, -1, 18, 33, 18454 }, // Ι
+    { 20, 19, 20, -1, 18, 67, 18487 }, // Κ
+    { 19, 18, 18, -2, 18, 57, 18554 }, // Λ
+    { 25, 18, 24, -2, 18, 92, 18611 }, // Μ
+    { 21, 19, 21, -1, 18, 75, 18703 }, // Ν
+    { 17, 18, 17, -1, 18, 46, 18778 }, // Ξ
+    { 17, 19, 19, 1, 18, 58, 18824 }, // Ο
+    { 21, 18, 21, -1, 18, 67, 18882 }, // Π
+    { 16, 18, 16, -1, 18, 51, 18949 }, // Ρ
+    { 16, 19, 16, -1, 18, 52, 19000 }, // Σ
+    { 15, 18, 18, 2, 18, 54, 19052 }, // Τ
+    { 16, 18, 18, 1, 18, 48, 19106 }, // Υ
+    { 18, 19, 19, 0, 18, 70, 19154 }, // Φ
+    { 20, 18, 19, -2, 18, 63, 19224 }, // Χ
+    { 20, 18, 22, 1, 18, 73, 19287 }, // Ψ
+    { 20, 18, 20, -1, 18, 72, 19360 }, // Ω
+    { 14, 15, 16, 1, 14, 47, 19432 }, // α
+    { 13, 26, 14, 0, 20, 71, 19479 }, // β
+    { 13, 20, 14, 0, 14, 49, 19550 }, // γ
+    { 13, 21, 15, 1, 20, 59, 19599 }, // δ
+    { 11, 15, 13, 1, 14, 29, 19658 }, // ε
+    { 11, 26, 13, 1, 21, 45, 19687 }, // ζ
+    { 12, 20, 14, 1, 14, 58, 19732 }, // η
+    { 14, 21, 16, 1, 20, 60, 19790 }, // θ
+    { 6, 15, 8, 1, 14, 23, 19850 }, // ι
+    { 13, 15, 15, 1, 14, 43, 19873 }, // κ
+    { 14, 21, 14, -1, 20, 50, 19916 }, // λ
+    { 16, 21, 16, -1, 14, 61, 19966 }, // μ
+    { 13, 15, 14, 0, 14, 35, 20027 }, // ν
+    { 11, 26, 13, 1, 21, 51, 20062 }, // ξ
+    { 12, 15, 14, 1, 14, 38, 20113 }, // ο
+    { 15, 15, 16, 0, 14, 46, 20151 }, // π
+    { 14, 20, 14, -1, 14, 50, 20197 }, // ρ
+    { 10, 19, 12, 1, 14, 33, 20247 }, // ς
+    { 14, 15, 16, 1, 14, 41, 20280 }, // σ
+    { 12, 15, 14, 1, 14, 33, 20321 }, // τ
+    { 12, 15, 14, 1, 14, 38, 20354 }, // υ
+    { 16, 20, 18, 1, 14, 67, 20392 }, // φ
+    { 16, 20, 15, -2, 14, 58, 20459 }, // χ
+    { 17, 24, 19, 1, 18, 75, 20517 }, // ψ
+    { 16, 15, 18, 1, 14, 57, 20592 }, // ω
+    { 19, 24, 18, -2, 18, 70, 20649 }, // Ạ
+    { 13, 20, 15, 1, 14, 52, 20719 }, // ạ
+    { 19, 26, 18, -2, 26, 78, 20771 }, // Ả
+    { 13, 23, 15, 1, 22, 61, 20849 }, // ả
+    { 21, 26, 20, -2, 26, 85, 20910 }, // Ấ
+    { 16, 25, 18, 1, 24, 69, 20995 }, // ấ
+    { 19, 26, 18, -2, 26, 82, 21064 }, // Ầ
+    { 13, 25, 15, 1, 24, 64, 21146 }, // ầ
+    { 21, 26, 20, -2, 26, 86, 21210 }, // Ẩ
+    { 16, 25, 18, 1, 24, 75, 21296 }, // ẩ
+    { 19, 26, 18, -2, 26, 80, 21371 }, // Ẫ
+    { 13, 25, 15, 1, 24, 68, 21451 }, // ẫ
+    { 19, 30, 18, -2, 24, 86, 21519 }, // Ậ
+    { 13, 27, 15, 1, 21, 66, 21605 }, // ậ
+    { 19, 26, 18, -2, 26, 80, 21671 }, // Ắ
+    { 13, 25, 15, 1, 24, 67, 21751 }, // ắ
+    { 19, 26, 18, -2, 26, 79, 21818 }, // Ằ
+    { 13, 25, 15, 1, 24, 65, 21897 }, // ằ
+    { 19, 26, 18, -2, 26, 82, 21962 }, // Ẳ
+    { 13, 26, 15, 1, 25, 70, 22044 }, // ẳ
+    { 19, 26, 18, -2, 26, 81, 22114 }, // Ẵ
+    { 13, 25, 15, 1, 24, 66, 22195 }, // ẵ
+    { 19, 30, 18, -2, 24, 87, 22261 }, // Ặ
+    { 13, 26, 15, 1, 20, 64, 22348 }, // ặ
+    { 17, 24, 17, -1, 18, 63, 22412 }, // Ẹ
+    { 11, 20, 13, 1, 14, 43, 22475 }, // ẹ
+    { 17, 26, 17, -1, 26, 71, 22518 }, // Ẻ
+    { 11, 23, 13, 1, 22, 51, 22589 }, // ẻ
+    { 17, 24, 17, -1, 24, 68, 22640 }, // Ẽ
+    { 12, 21, 14, 1, 20, 50, 22708 }, // ẽ
+    { 19, 26, 19, -1, 26, 77, 22758 }, // Ế
+    { 15, 25, 17, 1, 24, 62, 22835 }, // ế
+    { 17, 26, 17, -1, 26, 74, 22897 }, // Ề
+    { 12, 25, 14, 1, 24, 57, 22971 }, // ề
+    { 19, 26, 19, -1, 26, 78, 23028 }, // Ể
+    { 15, 25, 17, 1, 24, 67, 23106 }, // ể
+    { 17, 26, 17, -1, 26, 77, 23173 }, // Ễ
+    { 12, 25, 14, 1, 24, 61, 23250 }, // ễ
+    { 17, 30, 17, -1, 24, 78, 23311 }, // Ệ
+    { 11, 27, 13, 1, 21, 57, 23389 }, // ệ
+    { 12, 26, 12, -1, 26, 53, 23446 }, // Ỉ
+    { 9, 23, 11, 1, 22, 38, 23499 }, // ỉ
+    { 11, 24, 11, -1, 18, 42, 23537 }, // Ị
+    { 8, 26, 9, 0, 20, 37, 23579 }, // ị
+    { 17, 24, 19, 1, 18, 68, 23616 }, // Ọ
+    { 12, 20, 14, 1, 14, 46, 23684 }, // ọ
+    { 17, 27, 19, 1, 26, 75, 23730 }, // Ỏ
+    { 12, 23, 14, 1, 22, 55, 23805 }, // ỏ
+    { 18, 27, 20, 1, 26, 83, 23860 }, // Ố
+    { 16, 25, 18, 1, 24, 63, 23943 }, // ố
+    { 17, 27, 19, 1, 26, 78, 24006 }, // Ồ
+    { 13, 25, 15, 1, 24, 60, 24084 }, // ồ
+    { 18, 27, 20, 1, 26, 85, 24144 }, // Ổ
+    { 16, 25, 18, 1, 24, 71, 24229 }, // ổ
+    { 17, 27, 19, 1, 26, 80, 24300 }, // Ỗ
+    { 13, 25, 15, 1, 24, 65, 24380 }, // ỗ
+    { 17, 30, 19, 1, 24, 84, 24445 }, // Ộ
+    { 12, 27, 14, 1, 21, 60, 24529 }, // ộ
+    { 19, 25, 21, 1, 24, 78, 24589 }, // Ớ
+    { 14, 22, 16, 1, 21, 59, 24667 }, // ớ
+    { 19, 25, 21, 1, 24, 79, 24726 }, // Ờ
+    { 14, 22, 16, 1, 21, 59, 24805 }, // ờ
+    { 19, 27, 21, 1, 26, 84, 24864 }, // Ở
+    { 14, 23, 16, 1, 22, 65, 24948 }, // ở
+    { 19, 25, 21, 1, 24, 80, 25013 }, // Ỡ
+    { 14, 21, 16, 1, 20, 60, 25093 }, // ỡ
+    { 19, 27, 21, 1, 21, 80, 25153 }, // Ợ
+    { 14, 22, 16, 1, 16, 57, 25233 }, // ợ
+    { 18, 24, 21, 2, 18, 71, 25290 }, // Ụ
+    { 14, 19, 16, 1, 13, 55, 25361 }, // ụ
+    { 18, 27, 21, 2, 26, 79, 25416 }, // Ủ
+    { 14, 23, 16, 1, 22, 64, 25495 }, // ủ
+    { 20, 25, 23, 2, 24, 79, 25559 }, // Ứ
+    { 16, 22, 18, 1, 21, 65, 25638 }, // ứ
+    { 20, 25, 23, 2, 24, 79, 25703 }, // Ừ
+    { 16, 22, 18, 1, 21, 64, 25782 }, // ừ
+    { 20, 27, 23, 2, 26, 85, 25846 }, // Ử
+    { 16, 23, 18, 1, 22, 71, 25931 }, // ử
+    { 20, 25, 23, 2, 24, 81, 26002 }, // Ữ
+    { 16, 21, 18, 1, 20, 65, 26083 }, // ữ
+    { 20, 27, 23, 2, 21, 81, 26148 }, // Ự
+    { 16, 22, 18, 1, 16, 63, 26229 }, // ự
+    { 17, 24, 19, 1, 24, 64, 26292 }, // Ỳ
+    { 16, 27, 14, -3, 21, 70, 26356 }, // ỳ
+    { 17, 24, 19, 1, 18, 64, 26426 }, // Ỵ
+    { 16, 20, 14, -3, 14, 61, 26490 }, // ỵ
+    { 17, 26, 19, 1, 26, 72, 26551 }, // Ỷ
+    { 16, 28, 14, -3, 22, 78, 26623 }, // ỷ
+    { 17, 24, 19, 1, 24, 68, 26701 }, // Ỹ
+    { 16, 26, 14, -3, 20, 71, 26769 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 26840 }, //  
+    { 0, 0, 25, 0, 0, 0, 26840 }, //  
+    { 0, 0, 13, 0, 0, 0, 26840 }, //  
+    { 0, 0, 25, 0, 0, 0, 26840 }, //  
+    { 0, 0, 8, 0, 0, 0, 26840 }, //  
+    { 0, 0, 6, 0, 0, 0, 26840 }, //  
+    { 0, 0, 4, 0, 0, 0, 26840 }, //  
+    { 0, 0, 16, 0, 0, 0, 26840 }, //  
+    { 0, 0, 7, 0, 0, 0, 26840 }, //  
+    { 0, 0, 5, 0, 0, 0, 26840 }, //  
+    { 0, 0, 1, 0, 0, 0, 26840 }, //  
+    { 0, 0, 1, 0, 0, 0, 26840 }, // ​
+    { 2, 21, 2, -1, 15, 20, 26840 }, // ‌
+    { 6, 23, 4, -3, 17, 33, 26860 }, // ‍
+    { 8, 24, 5, -4, 18, 35, 26893 }, // ‎
+    { 8, 24, 5, -4, 18, 35, 26928 }, // ‏
+    { 8, 3, 10, 1, 8, 10, 26963 }, // ‐
+    { 8, 3, 10, 1, 8, 10, 26973 }, // ‑
+    { 12, 3, 16, 2, 10, 14, 26983 }, // ‒
+    { 13, 3, 14, 0, 8, 15, 26997 }, // –
+    { 25, 3, 26, 0, 8, 29, 27012 }, // —
+    { 25, 3, 26, 0, 8, 29, 27041 }, // ―
+    { 8, 26, 13, 2, 20, 66, 27070 }, // ‖
+    { 13, 6, 14, 0, -1, 15, 27136 }, // ‗
+    { 6, 8, 9, 2, 19, 12, 27151 }, // ‘
+    { 6, 8, 8, 1, 19, 13, 27163 }, // ’
+    { 6, 9, 8, 0, 4, 13, 27176 }, // ‚
+    { 5, 8, 7, 1, 19, 13, 27189 }, // ‛
+    { 11, 8, 14, 2, 19, 24, 27202 }, // “
+    { 11, 8, 13, 1, 19, 28, 27226 }, // ”
+    { 11, 9, 13, 0, 4, 25, 27254 }, // „
+    { 10, 8, 12, 1, 19, 26, 27279 }, // ‟
+    { 11, 17, 13, 1, 18, 31, 27305 }, // †
+    { 12, 20, 13, 0, 18, 48, 27336 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 27384 }, // •
+    { 9, 9, 16, 3, 13, 18, 27393 }, // ‣
+    { 5, 4, 7, 1, 3, 6, 27411 }, // ․
+    { 10, 5, 13, 1, 4, 13, 27417 }, // ‥
+    { 21, 5, 25, 2, 4, 17, 27430 }, // …
+    { 5, 4, 7, 1, 9, 7, 27447 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 27454 }, //  
+    { 0, 0, 1, 0, 0, 0, 27454 }, //  
+    { 8, 24, 5, -4, 18, 33, 27454 }, // ‪
+    { 8, 24, 5, -4, 18, 34, 27487 }, // ‫
+    { 8, 24, 5, -4, 18, 40, 27521 }, // ‬
+    { 11, 24, 7, -5, 18, 55, 27561 }, // ‭
+    { 11, 24, 7, -5, 18, 54, 27616 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 27670 }, //  
+    { 32, 21, 34, 1, 19, 124, 27670 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 27794 }, // ′
+    { 10, 9, 12, 1, 18, 24, 27806 }, // ″
+    { 15, 9, 17, 1, 18, 35, 27830 }, // ‴
+    { 6, 9, 7, 0, 18, 11, 27865 }, // ‵
+    { 11, 9, 12, 0, 18, 23, 27876 }, // ‶
+    { 17, 9, 18, 0, 18, 33, 27899 }, // ‷
+    { 11, 6, 13, 1, 0, 15, 27932 }, // ‸
+    { 8, 10, 9, 0, 11, 14, 27947 }, // ‹
+    { 7, 10, 8, 0, 11, 15, 27961 }, // ›
+    { 16, 18, 17, 0, 17, 64, 27976 }, // ※
+    { 14, 20, 16, 1, 19, 57, 28040 }, // ‼
+    { 13, 3, 14, 0, 21, 15, 28097 }, // ‾
+    { 6, 3, 8, 1, 8, 8, 28112 }, // ⁃
+    { 16, 21, 12, -5, 19, 41, 28120 }, // ⁄
+    { 18, 19, 21, 2, 18, 61, 28161 }, // ⁇
+    { 16, 20, 19, 2, 19, 59, 28222 }, // ⁈
+    { 17, 20, 19, 1, 19, 64, 28281 }, // ⁉
+    { 15, 5, 25, 5, 10, 17, 28345 }, // ⁓
+    { 20, 9, 22, 1, 18, 46, 28362 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 28408 }, //  
+    { 0, 0, 1, 0, 0, 0, 28408 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 28408 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 28408 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 28408 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 28408 }, // ⁤
+    { 10, 12, 12, 1, 21, 33, 28408 }, // ⁰
+    { 11, 12, 12, 0, 21, 26, 28441 }, // ⁴
+    { 10, 12, 12, 1, 21, 27, 28467 }, // ⁵
+    { 10, 12, 12, 1, 21, 30, 28494 }, // ⁶
+    { 9, 12, 12, 2, 21, 26, 28524 }, // ⁷
+    { 9, 12, 11, 1, 21, 30, 28550 }, // ⁸
+    { 10, 12, 11, 0, 21, 29, 28580 }, // ⁹
+    { 10, 9, 14, 2, 18, 28, 28609 }, // ⁿ
+    { 10, 12, 12, 1, 8, 32, 28637 }, // ₀
+    { 7, 13, 11, 2, 9, 22, 28669 }, // ₁
+    { 10, 12, 11, 0, 8, 28, 28691 }, // ₂
+    { 9, 12, 11, 1, 8, 26, 28719 }, // ₃
+    { 11, 12, 12, 0, 8, 31, 28745 }, // ₄
+    { 10, 12, 12, 1, 8, 25, 28776 }, // ₅
+    { 10, 12, 12, 1, 8, 31, 28801 }, // ₆
+    { 9, 12, 12, 2, 8, 24, 28832 }, // ₇
+    { 9, 12, 11, 1, 8, 35, 28856 }, // ₈
+    { 10, 12, 11, 0, 8, 28, 28891 }, // ₉
+    { 16, 18, 17, 0, 18, 43, 28919 }, // ₣
+    { 17, 19, 17, -1, 18, 56, 28962 }, // ₤
+    { 30, 19, 31, 0, 18, 103, 29018 }, // ₧
+    { 18, 19, 18, -1, 18, 56, 29121 }, // €
+    { 15, 11, 25, 5, 14, 27, 29177 }, // ←
+    { 11, 17, 25, 7, 17, 36, 29204 }, // ↑
+    { 15, 11, 25, 5, 14, 28, 29240 }, // →
+    { 11, 17, 25, 7, 17, 41, 29268 }, // ↓
+    { 15, 11, 25, 5, 14, 33, 29309 }, // ↔
+    { 11, 17, 25, 7, 17, 44, 29342 }, // ↕
+    { 11, 17, 25, 7, 17, 48, 29386 }, // ↨
+    { 11, 17, 25, 7, 17, 38, 29434 }, // ↲
+    { 11, 17, 25, 7, 17, 37, 29472 }, // ↳
+    { 13, 12, 25, 6, 15, 26, 29509 }, // ↵
+    { 15, 11, 25, 5, 14, 29, 29535 }, // ⇐
+    { 11, 15, 25, 7, 16, 48, 29564 }, // ⇑
+    { 15, 11, 25, 5, 14, 29, 29612 }, // ⇒
+    { 11, 15, 25, 7, 16, 44, 29641 }, // ⇓
+    { 15, 11, 25, 5, 14, 40, 29685 }, // ⇔
+    { 17, 19, 25, 4, 18, 54, 29725 }, // ∀
+    { 13, 21, 16, 1, 20, 56, 29779 }, // ∂
+    { 11, 18, 25, 7, 18, 38, 29835 }, // ∃
+    { 19, 20, 25, 3, 19, 79, 29873 }, // ∅
+    { 16, 18, 17, 0, 18, 52, 29952 }, // ∆
+    { 17, 19, 25, 4, 18, 60, 30004 }, // ∇
+    { 17, 18, 25, 4, 18, 56, 30064 }, // ∈
+    { 17, 22, 25, 4, 19, 72, 30120 }, // ∉
+    { 17, 14, 25, 4, 16, 46, 30192 }, // ∊
+    { 17, 18, 25, 4, 18, 56, 30238 }, // ∋
+    { 17, 22, 25, 4, 19, 71, 30294 }, // ∌
+    { 17, 14, 25, 4, 16, 46, 30365 }, // ∍
+    { 19, 22, 21, 1, 18, 78, 30411 }, // ∏
+    { 15, 23, 16, 0, 18, 66, 30489 }, // ∑
+    { 11, 3, 16, 2, 10, 13, 30555 }, // −
+    { 14, 20, 14, -1, 18, 41, 30568 }, // ∕
+    { 10, 20, 12, 1, 18, 29, 30609 }, // ∖
+    { 12, 13, 16, 2, 15, 34, 30638 }, // ∗
+    { 9, 9, 16, 3, 13, 24, 30672 }, // ∘
+    { 4, 4, 16, 6, 9, 6, 30696 }, // ∙
+    { 16, 24, 17, 0, 21, 62, 30702 }, // √
+    { 13, 10, 16, 1, 13, 33, 30764 }, // ∝
+    { 16, 9, 17, 0, 12, 37, 30797 }, // ∞
+    { 16, 18, 25, 4, 18, 35, 30834 }, // ∟
+    { 18, 18, 25, 3, 18, 44, 30869 }, // ∠
+    { 3, 26, 13, 5, 20, 27, 30913 }, // ∣
+    { 8, 26, 13, 2, 20, 78, 30940 }, // ∥
+    { 17, 18, 25, 4, 18, 52, 31018 }, // ∧
+    { 17, 18, 25, 4, 18, 56, 31070 }, // ∨
+    { 15, 18, 25, 5, 18, 56, 31126 }, // ∩
+    { 15, 19, 25, 5, 18, 59, 31182 }, // ∪
+    { 14, 26, 16, 1, 20, 58, 31241 }, // ∫
+    { 16, 15, 25, 5, 14, 25, 31299 }, // ∴
+    { 16, 15, 25, 5, 14, 24, 31324 }, // ∵
+    { 5, 13, 8, 1, 15, 16, 31348 }, // ∶
+    { 16, 15, 25, 5, 14, 30, 31364 }, // ∷
+    { 15, 5, 25, 5, 10, 17, 31394 }, // ∼
+    { 15, 13, 25, 5, 15, 40, 31411 }, // ≅
+    { 12, 9, 16, 2, 13, 29, 31451 }, // ≈
+    { 15, 8, 25, 5, 11, 24, 31480 }, // ≍
+    { 11, 11, 16, 2, 14, 27, 31504 }, // ≠
+    { 15, 11, 25, 5, 13, 35, 31531 }, // ≡
+    { 12, 15, 16, 2, 15, 31, 31566 }, // ≤
+    { 12, 15, 16, 2, 15, 29, 31597 }, // ≥
+    { 21, 13, 25, 2, 15, 44, 31626 }, // ≪
+    { 21, 13, 25, 2, 15, 44, 31670 }, // ≫
+    { 17, 15, 25, 4, 16, 39, 31714 }, // ⊃
+    { 17, 23, 25, 4, 20, 64, 31753 }, // ⊄
+    { 17, 23, 25, 4, 20, 63, 31817 }, // ⊅
+    { 17, 18, 25, 4, 18, 46, 31880 }, // ⊆
+    { 17, 18, 25, 4, 18, 47, 31926 }, // ⊇
+    { 19, 19, 25, 3, 18, 94, 31973 }, // ⊕
+    { 19, 19, 25, 3, 18, 73, 32067 }, // ⊖
+    { 19, 19, 25, 3, 18, 89, 32140 }, // ⊗
+    { 19, 19, 25, 3, 18, 79, 32229 }, // ⊘
+    { 15, 18, 25, 5, 18, 50, 32308 }, // ⊥
+    { 4, 4, 16, 6, 9, 6, 32358 }, // ⋅
+    { 21, 4, 25, 2, 9, 17, 32364 }, // ⋯
+    { 25, 24, 26, 0, 21, 101, 32381 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
@@ -3556,4 +2800,5 @@ static const EpdFontData bookerly_12_italic = {
     27,
     -7,
     true,
+    true,
 };
@@ -2,3386 +2,2707 @@
  * generated by fontconvert.py
  * name: bookerly_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_regularBitmaps[43104] = {
-    0x28, 0xBC, 0xFC, 0xF8, 0xF8, 0xF8, 0xF4, 0xF4, 0xF4, 0xF4, 0xB4, 0xB4, 0x74, 0x74, 0x00, 0x00,
-    0x78, 0xFD, 0xFC, 0x10, 0x28, 0x2E, 0xE1, 0xFB, 0x47, 0xED, 0x1E, 0xB4, 0x7A, 0xD1, 0xEB, 0x03,
-    0x94, 0x04, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0D, 0x03, 0x80, 0x00, 0x1D, 0x03, 0x40, 0x00, 0x2C,
-    0x0B, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x05, 0xB9, 0x5F, 0x54, 0x00, 0x74, 0x0D, 0x00, 0x00, 0xB0,
-    0x1C, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x15, 0xF5, 0x7D, 0x50, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xC0,
-    0x74, 0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x40, 0xE0, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x2D, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xAD, 0xFC,
-    0x2E, 0x1C, 0x3D, 0x3D, 0x1C, 0x2C, 0x3D, 0x1C, 0x00, 0x2F, 0x1C, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x29, 0xFC, 0x10, 0x38, 0x3D, 0x74, 0x38, 0x3D, 0xB8, 0x38,
-    0x3C, 0xBD, 0x38, 0xBC, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x74, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x28, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x01, 0xF5, 0xF4, 0x00, 0xB0, 0x00, 0x3C,
-    0x07, 0xC0, 0x1E, 0x00, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x00, 0x78, 0x03, 0xC0, 0x74, 0x00, 0x07,
-    0x80, 0x3C, 0x0F, 0x00, 0x00, 0x78, 0x03, 0xC2, 0xC0, 0x10, 0x03, 0xC0, 0xB8, 0x38, 0x2F, 0xF0,
-    0x2F, 0x5F, 0x0B, 0x0F, 0x9B, 0xC0, 0xFF, 0xC1, 0xD1, 0xE0, 0x3D, 0x00, 0x40, 0x3C, 0x2D, 0x01,
-    0xE0, 0x00, 0x0B, 0x03, 0xD0, 0x1E, 0x00, 0x00, 0xE0, 0x3C, 0x01, 0xE0, 0x00, 0x2C, 0x03, 0xD0,
-    0x2E, 0x00, 0x07, 0x80, 0x2E, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0xF9, 0xB8, 0x00, 0x2D, 0x00, 0x07,
-    0xFE, 0x00, 0x02, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0x00, 0x7C, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x1E, 0x00, 0x00, 0x0F, 0x40, 0xB4, 0x00, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0xBC,
-    0x3C, 0x00, 0x00, 0x01, 0xF0, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFE, 0x01, 0xFB, 0xD0, 0x7F,
-    0xF4, 0x0F, 0x4B, 0xC0, 0x2D, 0x00, 0x7C, 0x0F, 0xC0, 0x74, 0x02, 0xF0, 0x0F, 0xC2, 0xD0, 0x0B,
-    0xC0, 0x0F, 0xDB, 0x00, 0x1F, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x96,
-    0xFF, 0xFE, 0x40, 0x7F, 0xFF, 0xD1, 0xFF, 0x40, 0x05, 0x50, 0x00, 0x10, 0x2A, 0xEB, 0x6D, 0xB6,
-    0xDB, 0x14, 0x00, 0x18, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xB8, 0x00,
-    0xBC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3C, 0x00, 0x00, 0x24, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x80,
-    0x2E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xCB, 0x40, 0xFA, 0xC0, 0x07,
-    0xFF, 0x42, 0xFA, 0xE3, 0xEB, 0x00, 0xA2, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0,
-    0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x15, 0x7D, 0x55, 0xFF, 0xFF, 0xF1, 0x57, 0xD5, 0x40, 0x0F,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xD0, 0x7D,
-    0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x10, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x2E, 0x1F,
-    0xC3, 0xF0, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07, 0xFA, 0xFE, 0x00, 0xF8, 0x03, 0xF4, 0x3F, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0xBC, 0x7C, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x7D, 0xFC, 0x00, 0x07, 0xDF, 0xC0,
-    0x00, 0x7D, 0xFC, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x7D, 0xBC, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0xFC,
-    0x3E, 0x00, 0x1F, 0x42, 0xF4, 0x03, 0xF0, 0x0F, 0xFA, 0xFC, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x6F, 0xF8, 0x0B, 0xFF, 0x80, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x1B, 0xFF, 0xC7, 0xFF, 0xFD, 0x00,
-    0x05, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFE, 0xBF, 0xC0, 0xBC, 0x02, 0xF8, 0x3D, 0x00, 0x3F, 0x0F,
-    0x00, 0x0F, 0xC0, 0x40, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBD, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xFF, 0x03,
-    0xFA, 0xFF, 0x2F, 0x00, 0xBC, 0x70, 0x01, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x01, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x10, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x5A, 0xFF, 0x82, 0xFF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x3E, 0x0F, 0x40, 0x02, 0xF0, 0x3D,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x40, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xD4, 0x00, 0x07, 0xFF, 0x80, 0x07,
-    0xFF, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF8, 0x16, 0xBF, 0xE0, 0x2F, 0xFE, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0xBF, 0xD0, 0x02, 0xFE, 0x50, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0xAA, 0x00, 0x2F, 0xFF, 0xF8, 0x0F, 0xD0, 0x7F,
-    0x83, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0x7D, 0x3E, 0x00, 0x0F, 0x8F, 0xC0, 0x03, 0xE2, 0xF4, 0x01,
-    0xF4, 0x3F, 0x00, 0xFC, 0x0B, 0xFA, 0xFD, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xF0, 0x01, 0xF8, 0x74, 0x00, 0xBC, 0x1C, 0x00,
-    0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x3F, 0xAF, 0xD0, 0x3E, 0x00, 0xFC, 0x0F, 0x40, 0x1F, 0x03, 0xD0, 0x07, 0xC0,
-    0xFC, 0x03, 0xE0, 0x1F, 0xD3, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x7D, 0x2F, 0xD0,
-    0x7D, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0x8F, 0x80, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0xBD, 0x00, 0xBC,
-    0x0F, 0xFA, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0xFF, 0xBF, 0xC0, 0xBC, 0x02, 0xF8, 0x3E, 0x00, 0x3F, 0x0F, 0x40, 0x0B, 0xC7, 0xD0, 0x01,
-    0xF4, 0xF8, 0x00, 0x3D, 0x3F, 0x00, 0x1F, 0x47, 0xF4, 0x0B, 0xC0, 0x7F, 0xFF, 0xF0, 0x01, 0xAA,
-    0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x06, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x0F, 0xC7, 0xF0, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xFC, 0x3F, 0x01, 0x00, 0x01, 0x40, 0xFD, 0x0F, 0xD0, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7D, 0x07, 0xD0, 0xBC, 0x0F,
-    0x81, 0xF0, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07, 0xF8, 0x00, 0x7F,
-    0xD0, 0x07, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA9, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x3F, 0x80,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFD, 0x03, 0xAB,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xD0, 0x00, 0x2D, 0x00, 0x1F, 0xC0, 0x7F, 0xF8,
-    0x0F, 0xFD, 0x00, 0xF9, 0x00, 0x0B, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0xBE, 0x00, 0x07, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xD0, 0x02,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x1B, 0xD0, 0x03, 0xC3,
-    0xE0, 0x1F, 0xBF, 0x40, 0x3D, 0x3C, 0x03, 0xC0, 0xB8, 0x02, 0xE7, 0xC0, 0x28, 0x07, 0x80, 0x2E,
-    0xB8, 0x00, 0x00, 0xB8, 0x02, 0xEB, 0x80, 0x06, 0xFF, 0x80, 0x2D, 0xF8, 0x02, 0xF5, 0xB8, 0x03,
-    0xCB, 0x80, 0x3C, 0x07, 0x80, 0x7C, 0xB8, 0x07, 0xC0, 0xBC, 0x1F, 0x47, 0xC0, 0x3F, 0xBF, 0xFF,
-    0xD0, 0x3D, 0x01, 0xFE, 0x1F, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x94, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00,
-    0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03,
-    0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x05, 0xAA,
-    0x50, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xC1, 0xBF, 0x00, 0xBC, 0x02, 0xF4, 0x0B, 0xC0, 0x0F, 0x40,
-    0xBC, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xBC, 0x02, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF4, 0x0B, 0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x3E, 0x0B,
-    0xC0, 0x07, 0xD0, 0xBC, 0x01, 0xFC, 0x2F, 0xFB, 0xFF, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0x50, 0x00, 0x05, 0xAA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0xFC, 0x56, 0xFF,
-    0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00,
-    0x02, 0xF4, 0x2F, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0x40,
-    0xBC, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0,
-    0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xD1, 0xFE, 0xAA, 0xF4, 0x2F, 0x00,
-    0x1D, 0x0B, 0xC0, 0x03, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD5,
-    0x68, 0x02, 0xFF, 0xFF, 0x00, 0xBD, 0x55, 0x40, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F,
-    0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD,
-    0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x55, 0x54, 0x00, 0x55, 0x57,
-    0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x05, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xF8, 0x00, 0x6F, 0xE7, 0xFF, 0xF0, 0x07, 0xFF,
-    0xE0, 0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x2F, 0xF8, 0xFF, 0xFD, 0x05, 0x55, 0x40, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x54, 0x05, 0x55, 0x0F, 0xFF, 0xC0, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0xBC,
-    0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x40, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00,
-    0x0B, 0xC0, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0xBF, 0x40, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xFF, 0xC0,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x05, 0x54, 0x00, 0x00, 0x55, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xEF, 0x40,
-    0x0F, 0x7C, 0x00, 0x07, 0x6F, 0x00, 0x39, 0xF0, 0x00, 0x2D, 0x7C, 0x02, 0xD7, 0xC0, 0x00, 0xB0,
-    0xF4, 0x0F, 0x0F, 0x00, 0x03, 0xC2, 0xE0, 0x38, 0x3C, 0x00, 0x0F, 0x07, 0xC2, 0xC0, 0xF4, 0x00,
-    0x3C, 0x0F, 0x4F, 0x03, 0xD0, 0x00, 0xF0, 0x2E, 0x78, 0x0F, 0x40, 0x03, 0xC0, 0x3E, 0xC0, 0x3E,
-    0x00, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x00, 0x78, 0x02, 0xF4, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
-    0x0B, 0xC0, 0x2F, 0xE4, 0x05, 0x00, 0xBF, 0xE3, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x55, 0x40,
-    0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00, 0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02,
-    0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D, 0x00, 0xB4, 0xFC, 0x00, 0xB4, 0x02,
-    0xD1, 0xF8, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D, 0x03, 0xF0, 0x2D, 0x00, 0xB4, 0x07,
-    0xE0, 0xB4, 0x02, 0xD0, 0x0B, 0xD2, 0xD0, 0x0B, 0x40, 0x0F, 0xCB, 0x40, 0x2D, 0x00, 0x0F, 0xAD,
-    0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0, 0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF,
-    0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05,
-    0xAA, 0x50, 0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xC1, 0xBF, 0x40, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x0B,
-    0xC0, 0xBC, 0x00, 0x7C, 0x0B, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x2F, 0x00, 0xBE,
-    0xBF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0xA9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xD5, 0xBF, 0xC0, 0x03, 0xF4, 0x00, 0x3F,
-    0x80, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x7E, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0xBD,
-    0x02, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0xAF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x1F,
-    0xF9, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x05, 0xAA, 0x50, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x1B, 0xF4, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x0B, 0xC0,
-    0xBE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x0B,
-    0xC1, 0xF8, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x00, 0xBC, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x3F, 0x80,
-    0x2F, 0xE8, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x69, 0x40,
-    0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02,
-    0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0,
-    0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA,
-    0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00, 0xF8, 0x02, 0x40,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x15, 0x54, 0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF, 0xE1, 0xBE, 0x00, 0x01,
-    0xFC, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00,
-    0xFF, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x55,
-    0x00, 0x55, 0x52, 0xFF, 0xF8, 0x0B, 0xFF, 0xC1, 0xFE, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00,
-    0x3F, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x03, 0xF0,
-    0x3C, 0x00, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x00, 0x2E, 0x3C, 0x00,
-    0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x7F, 0xFF, 0x00, 0x28, 0x00, 0xBF, 0xFC, 0x1B, 0xF4, 0x00, 0x3D, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0xFF,
-    0x00, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0xEF, 0x80, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xDB, 0xC0, 0x2E,
-    0x00, 0x00, 0x7C, 0x03, 0xC7, 0xC0, 0x3D, 0x00, 0x00, 0x3D, 0x07, 0x83, 0xD0, 0x3C, 0x00, 0x00,
-    0x3E, 0x0B, 0x42, 0xF0, 0xB8, 0x00, 0x00, 0x2F, 0x0F, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x0F, 0x0E,
-    0x00, 0xF4, 0xF0, 0x00, 0x00, 0x0F, 0x6D, 0x00, 0xB9, 0xE0, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x7E,
-    0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0F, 0x80,
-    0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x1F, 0xCF, 0x40, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80, 0x3F, 0x00, 0x01, 0xF0, 0x02,
-    0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xFF, 0x9F, 0xFF, 0xC0, 0xBF, 0xFF, 0x15,
-    0x54, 0x01, 0x55, 0x6F, 0xFF, 0x81, 0xFF, 0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xD0,
-    0x02, 0xF4, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x55, 0x40,
-    0x7F, 0xFF, 0xFF, 0x41, 0xFA, 0xAA, 0xFD, 0x0B, 0x80, 0x03, 0xE0, 0x2C, 0x00, 0x3F, 0x00, 0x20,
-    0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x02,
-    0xC0, 0xFC, 0x00, 0x0F, 0x0B, 0xD0, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x83, 0xFD, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
-    0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x83, 0xFD, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x6A, 0xAF, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1,
-    0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF6,
-    0xBE, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xDF, 0x00, 0x03, 0xC7,
-    0x80, 0x07, 0x83, 0xC0, 0x0F, 0x02, 0xD0, 0x1F, 0x00, 0xF0, 0x2D, 0x00, 0xF4, 0x3C, 0x00, 0x78,
-    0xB8, 0x00, 0x3C, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC0,
-    0x3F, 0x01, 0xF8, 0x07, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA,
-    0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B,
-    0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F,
-    0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4, 0x1F, 0xC0, 0x3F,
-    0x00, 0x1F, 0x80, 0xF8, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x80, 0x02, 0xF0, 0x3E, 0x00,
-    0x0F, 0xC0, 0xF8, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0xEA, 0xFC,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF,
-    0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0xFF, 0xC0,
-    0x0F, 0xFB, 0xFF, 0x00, 0xBC, 0x00, 0xFC, 0x03, 0xD0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xF0, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x2F, 0x01, 0xFC, 0x01, 0xFC, 0x02, 0xFE, 0xBF, 0xFA, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x50, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C, 0x00, 0xBE, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0x2F,
-    0xFE, 0x00, 0xBD, 0x7F, 0x00, 0xF0, 0x09, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x1B, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xAF, 0xEF, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0xF4, 0x02,
-    0xF0, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x2E, 0x69, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x41, 0xF0, 0x00, 0x7E, 0x0F,
-    0x00, 0x00, 0xB8, 0x7C, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0xBE, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x1F, 0xFD, 0x00, 0x03, 0xEF, 0xFF, 0xC0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x3F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xBF,
-    0x80, 0x7F, 0x91, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xFC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x07, 0xF0, 0x2F,
-    0xC0, 0x2E, 0x00, 0x00, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-    0xFD, 0x03, 0xC0, 0xBF, 0xE0, 0x0F, 0x00, 0xF8, 0x00, 0x3C, 0x1F, 0x80, 0x00, 0xF1, 0xF4, 0x00,
-    0x03, 0xEF, 0x00, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xF0, 0xBD, 0x00, 0x03,
-    0xC0, 0xFD, 0x00, 0x0F, 0x00, 0xFE, 0x01, 0xBE, 0x40, 0xFE, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF0, 0xBF, 0xD0, 0x7F, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x1F, 0xE0, 0x2F,
-    0xF4, 0x1F, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x7C, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0F,
-    0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x0B, 0xF8, 0x07, 0xF9, 0x02, 0xFE, 0x0F, 0xFF, 0x43, 0xFF, 0x83,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF0, 0xBF, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0x00, 0x1F,
-    0xE0, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-    0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
-    0x00, 0x0F, 0x80, 0x07, 0xC0, 0x0B, 0xF8, 0x03, 0xFA, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00,
-    0x03, 0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x1F, 0xF8, 0x0F, 0xFE, 0xFF, 0xFC, 0x02, 0xFD, 0x02, 0xF8, 0x07, 0xD0,
-    0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x01,
-    0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x3E, 0x01, 0xF0, 0x02, 0xF0, 0x07, 0xFE, 0xBF, 0x40,
-    0x1F, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x90, 0x0F, 0xFB, 0xFF, 0x02, 0xF0, 0x03, 0xF0, 0x7D, 0x00, 0x2F, 0x0B, 0xC0, 0x02, 0xF0, 0xF8,
-    0x00, 0x2F, 0x0F, 0x80, 0x02, 0xF0, 0xF8, 0x00, 0x2F, 0x0F, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x3F,
-    0x07, 0xF0, 0x0F, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xE2, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x6A, 0xA9,
-    0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F,
-    0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF,
-    0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E, 0x7E, 0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xFC, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF, 0x02, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0A, 0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x40,
-    0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xF8, 0x2F,
-    0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x40,
-    0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00, 0x00,
-    0xF7, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x07, 0x00, 0xBF, 0xE3, 0xFE, 0x40, 0xB4, 0x06, 0xFD, 0x0F, 0x80, 0x0F,
-    0xC0, 0x0F, 0x40, 0xBC, 0x01, 0xFC, 0x01, 0xF0, 0x03, 0xD0, 0x2F, 0xD0, 0x2E, 0x00, 0x3E, 0x03,
-    0xEF, 0x03, 0xC0, 0x02, 0xF0, 0x75, 0xF0, 0x3C, 0x00, 0x0F, 0x0B, 0x0F, 0x47, 0x40, 0x00, 0xF8,
-    0xF0, 0xBC, 0xF0, 0x00, 0x07, 0xDD, 0x03, 0xCE, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x02,
-    0xF8, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x3F, 0xF4, 0xFF, 0xD0, 0xBF, 0x80, 0x7E, 0x00, 0xF4, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0xBC,
-    0xB4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3C, 0xF8,
-    0x00, 0x03, 0xC1, 0xF4, 0x00, 0x3D, 0x02, 0xF0, 0x07, 0xF4, 0x07, 0xF8, 0xBF, 0xF4, 0xBF, 0xF4,
-    0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03,
-    0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C,
-    0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x5B, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00,
-    0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F, 0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x03, 0xFD, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x0B, 0x80, 0x0B, 0xC0,
-    0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x0B, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF9,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D,
-    0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x40, 0x3E, 0x40, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x7E,
-    0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0xF4, 0x1B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x04, 0x3F, 0xF0, 0x1D, 0xBE, 0xFE,
-    0xBC, 0xF0, 0x2F, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x7E, 0xBE, 0x7D, 0x00, 0x00, 0x1C, 0x2D, 0x2D,
-    0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x3F, 0x3F, 0x3F, 0x3E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x1F, 0xBD, 0xFC, 0x0F, 0x4B, 0x1F, 0x0B, 0x82, 0x83, 0x43, 0xD0, 0xA0, 0x00, 0xF0,
-    0x28, 0x00, 0x7C, 0x0E, 0x00, 0x1F, 0x03, 0x80, 0x03, 0xD0, 0xE0, 0x00, 0xFC, 0x34, 0x00, 0x2F,
-    0x8D, 0x02, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xAF, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0x7C, 0x02, 0xD0, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x04, 0x03, 0xFF, 0xFF, 0xC0,
-    0x17, 0xF5, 0x54, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xEF, 0xFF, 0xF8, 0x24, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x3D, 0xBF, 0xEB, 0x80, 0xFE, 0xAF, 0xD0, 0x0B, 0x80,
-    0x3C, 0x00, 0xF0, 0x02, 0xD0, 0x0F, 0x00, 0x1E, 0x00, 0xF0, 0x02, 0xD0, 0x0B, 0x80, 0x3C, 0x00,
-    0xFE, 0x6F, 0xD0, 0x3D, 0xFF, 0xDB, 0x87, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xD2, 0xFE, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x02, 0xE0, 0x03,
-    0xF0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0xF8, 0x2D, 0x00,
-    0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x6B, 0xEB, 0xA8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0xAB, 0xFA, 0x90, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x02, 0xDB, 0x6D, 0xB6, 0xDB,
-    0x6D, 0xB5, 0x90, 0x00, 0x00, 0x07, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0xB9, 0xBD, 0x0B, 0x80, 0x78, 0x3D, 0x00, 0x82, 0xF8, 0x00, 0x0F, 0xF8, 0x00,
-    0x3C, 0xFD, 0x00, 0xF0, 0xBF, 0x02, 0xD0, 0x7F, 0x03, 0xD0, 0x2F, 0x0B, 0xE0, 0x2D, 0x07, 0xF4,
-    0x38, 0x03, 0xF8, 0xE0, 0x01, 0xFB, 0x80, 0x00, 0xFD, 0x74, 0x02, 0xF2, 0xF0, 0x0F, 0x47, 0xF5,
-    0xF8, 0x0B, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x24, 0x06, 0x3F, 0x07, 0xEF, 0xC1, 0xF4, 0x40, 0x14,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x02, 0xE0, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x0F, 0x00, 0x6A, 0x01, 0xD0, 0x74, 0x0F, 0xFE, 0x02, 0xC3, 0xC0, 0xF0, 0x38,
-    0x07, 0x4E, 0x07, 0x40, 0x50, 0x0E, 0x34, 0x2C, 0x00, 0x00, 0x38, 0xD0, 0xB0, 0x00, 0x00, 0xF3,
-    0x42, 0xC0, 0x00, 0x03, 0x8E, 0x07, 0x80, 0x00, 0x0E, 0x2C, 0x0F, 0x95, 0x80, 0x74, 0x74, 0x0F,
-    0xFE, 0x03, 0xC0, 0xF0, 0x01, 0x40, 0x2D, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0xF9, 0x00, 0x7D,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0x90, 0x0B, 0xEE, 0x03,
-    0xC3, 0xC0, 0x50, 0xF0, 0x0B, 0xFC, 0x0F, 0x5F, 0x07, 0x83, 0xC0, 0xFA, 0xFE, 0x1F, 0x8E, 0x00,
-    0x00, 0x02, 0xAA, 0xB1, 0xFF, 0xF8, 0x00, 0x34, 0x02, 0x80, 0x1F, 0x00, 0xF4, 0x07, 0xC0, 0x7D,
-    0x02, 0xF4, 0x1F, 0x80, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0x40, 0x0B, 0xC0, 0x7C, 0x00, 0x2E,
-    0x01, 0xF0, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55,
-    0x57, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF,
-    0xFD, 0xAA, 0xA8, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x07, 0x80, 0x1F, 0x00, 0xD1, 0x50,
-    0x38, 0x28, 0x7E, 0xD0, 0xC3, 0x43, 0x8E, 0x0E, 0x30, 0x39, 0xD0, 0xA3, 0x03, 0xF8, 0x0B, 0x30,
-    0x39, 0xD0, 0xA3, 0x83, 0xCB, 0x4D, 0x1C, 0x54, 0x16, 0xC0, 0xB0, 0x00, 0x74, 0x02, 0xE5, 0xBD,
-    0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0x43,
-    0xE5, 0xF1, 0xE0, 0x1E, 0x74, 0x03, 0x9E, 0x01, 0xE3, 0xD0, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x01, 0xFF, 0xFF,
-    0xF2, 0xAB, 0xEA, 0x80, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC0, 0x01, 0x64, 0x03, 0xFF, 0x83, 0xD1,
-    0xF0, 0xF0, 0x3D, 0x14, 0x0F, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x03, 0xFF, 0xFC, 0xAA, 0xA9, 0x01, 0x90, 0x0B, 0xFF, 0x43, 0xC1, 0xF0, 0x40, 0x3C, 0x00, 0x3D,
-    0x01, 0xBE, 0x00, 0xBF, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0xC2, 0xBF, 0xC0, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xF8, 0xFC, 0x7C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-    0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0xBF, 0x80, 0x3F, 0xFB, 0xF3, 0xFA,
-    0x3D, 0xFF, 0xC2, 0xFD, 0x3C, 0x14, 0x00, 0x50, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00,
-    0xBF, 0xFF, 0xD0, 0xFF, 0xFB, 0x80, 0xBF, 0xF9, 0xD0, 0x3F, 0xFE, 0x74, 0x1F, 0xFF, 0x9D, 0x07,
-    0xFF, 0xE7, 0x41, 0xFF, 0xF9, 0xD0, 0x3F, 0xFE, 0x74, 0x0B, 0xFF, 0x9D, 0x00, 0xFF, 0xE7, 0x40,
-    0x07, 0xB9, 0xD0, 0x00, 0x0E, 0x74, 0x00, 0x03, 0x9D, 0x00, 0x00, 0xE7, 0x40, 0x00, 0x39, 0xD0,
-    0x00, 0x0E, 0x74, 0x00, 0x03, 0x9D, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x38, 0x40, 0x00, 0x0D, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x29, 0x1F, 0xD0, 0xF8, 0x3C, 0x7D, 0x04,
-    0x00, 0x00, 0x40, 0x1F, 0xC0, 0xBF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
-    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x2F, 0xF8, 0x6A, 0xA8, 0x01, 0xA4, 0x03, 0xFF, 0xC3, 0xC0, 0xF5,
-    0xE0, 0x1F, 0x78, 0x03, 0xDE, 0x00, 0xF3, 0xC0, 0xB4, 0xBE, 0xBC, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xAA, 0xB0, 0xBF, 0xF8, 0x70, 0x03, 0x40, 0x0F, 0x40, 0xB8, 0x00, 0xF4, 0x0F, 0x80, 0x1F, 0x80,
-    0xFC, 0x02, 0xF0, 0x1F, 0x40, 0xFC, 0x0F, 0xC0, 0xF8, 0x0B, 0xC0, 0xF8, 0x0B, 0xC0, 0x74, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x17, 0xC0, 0x00,
-    0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x38, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0xD0, 0x07,
-    0xF0, 0x03, 0xC0, 0x02, 0xC0, 0x0F, 0xF0, 0x1B, 0xE4, 0x07, 0x40, 0x2D, 0xF0, 0xBF, 0xFC, 0x0F,
-    0x00, 0xB8, 0xF0, 0x00, 0x00, 0x2C, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x38, 0x03, 0xC0, 0xF0, 0x00,
-    0x00, 0xB0, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xE0, 0x02, 0xAB, 0xF9, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x17, 0xC0, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0xB0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xE0, 0x2F, 0xF0, 0x03, 0xC0, 0x02, 0xC0, 0xF9, 0xFC, 0x03,
-    0xC0, 0x03, 0x41, 0xE0, 0x3C, 0x1B, 0xE4, 0x0F, 0x00, 0xD0, 0x3C, 0xBF, 0xFC, 0x1D, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x07, 0x80, 0x02, 0xFF, 0xFE, 0x00,
-    0x0F, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0D, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x07, 0x80, 0x00, 0xF5, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x20, 0x0F, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x0D, 0x00, 0x3F, 0x00,
-    0x01, 0xF0, 0x0B, 0x00, 0x2F, 0xC0, 0x5B, 0xF4, 0x07, 0x40, 0x2E, 0xF0, 0x3F, 0xF0, 0x03, 0xC0,
-    0x1F, 0x3C, 0x01, 0x00, 0x02, 0xC0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x0B, 0x43, 0xC0, 0x00,
-    0x00, 0xB0, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x78, 0x00, 0xAA, 0xBE, 0x80, 0x00, 0x3C, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x74, 0x00, 0x2E, 0x01, 0xFF, 0xC2, 0xFF, 0xD1, 0xFE, 0x40,
-    0xB8, 0x00, 0x2D, 0x00, 0x07, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x96, 0x82, 0xFF, 0xF0, 0x1F, 0xF4,
-    0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00,
-    0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9,
-    0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F,
-    0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F,
-    0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F,
-    0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4,
-    0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B,
-    0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x7E, 0xF0, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00,
-    0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0,
-    0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE,
-    0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x4F,
-    0x00, 0x00, 0x03, 0xEF, 0xFC, 0x00, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0,
-    0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00,
-    0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA,
-    0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x03,
-    0xC3, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F,
-    0x00, 0x00, 0x2E, 0x55, 0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xEA, 0xAB, 0xF0, 0x00,
-    0x3D, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80,
-    0x02, 0xFF, 0x8F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x03, 0x82, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xF7, 0xC0,
-    0x00, 0x00, 0x0B, 0x4F, 0x40, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x01, 0xE0, 0x7C, 0x00, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xE5, 0x5B, 0xD0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0xBE, 0xAA, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x0B, 0xF8, 0x00, 0x2F, 0xF8, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xF8, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x7C, 0x00, 0x38, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x7E, 0xAF, 0xC0, 0x00, 0x07, 0xC0, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0x55, 0xBD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x55, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x7C, 0x00, 0x0C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2D, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3C, 0x0B,
-    0xE4, 0x01, 0xFF, 0xFF, 0xFC, 0x3F, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0xA5, 0x00, 0x07,
-    0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E,
-    0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00,
-    0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x02,
-    0x90, 0x78, 0x00, 0x7F, 0x0F, 0xC0, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xBC, 0x0B, 0xC0, 0x02, 0xC0, 0xBC,
-    0x00, 0x1C, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBE, 0xAF, 0xE0,
-    0x0B, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xA0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x01, 0xE2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x50, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x00, 0x08, 0x00, 0x7D, 0x03, 0xFC, 0x0F, 0xE0, 0x19, 0x00, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x00, 0xA0, 0x00, 0xFF, 0x00, 0xBF, 0xF0, 0xBC, 0x3E, 0x38, 0x02, 0x80, 0x00, 0x01, 0x55, 0x50,
-    0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x28, 0x0B, 0x4B, 0xE0, 0xFC, 0x7D, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x50, 0x3F, 0xFF, 0x40, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0x40,
-    0x01, 0x6A, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF1, 0x5B, 0xFC, 0x00, 0x2F, 0x00,
-    0x0B, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xD0,
-    0x2F, 0x00, 0x00, 0x7D, 0x17, 0xF5, 0x50, 0x07, 0xE7, 0xFF, 0xFF, 0x00, 0x3D, 0x02, 0xF0, 0x00,
-    0x07, 0xD0, 0x2F, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x0E, 0x00, 0x00,
-    0x03, 0xEF, 0xFC, 0x00, 0x00, 0x0E, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F,
-    0x80, 0x2F, 0xE0, 0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B,
-    0x4F, 0xC0, 0x0B, 0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F,
-    0x02, 0xD0, 0x0B, 0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4,
-    0x02, 0xD0, 0x00, 0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE,
-    0x40, 0x03, 0xF4, 0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0,
-    0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
-    0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F,
-    0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0xB8,
-    0x00, 0x00, 0x38, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F,
-    0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC,
-    0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00,
-    0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x05, 0x01, 0x00, 0x00, 0x03, 0xFC, 0x38, 0x00, 0x00, 0x3E, 0xFF, 0x80, 0x00, 0x03, 0x47,
-    0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00,
-    0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x28, 0x07, 0x40, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x3F, 0x91, 0xBF, 0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC,
-    0xFC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00,
-    0x00, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-    0x7F, 0xEA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x1C, 0x7C, 0x07, 0xC1, 0xF1, 0xF0, 0x07, 0xFC, 0x00, 0x2F, 0x00, 0x07, 0xFC, 0x01, 0xF1,
-    0xF0, 0x7C, 0x07, 0xCB, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x10, 0x00, 0xBF,
-    0xFF, 0xE1, 0xE0, 0x0F, 0xE4, 0x6F, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x2F,
-    0xD0, 0x3F, 0x00, 0x02, 0xFF, 0xC1, 0xF4, 0x00, 0x2E, 0x3F, 0x0B, 0xC0, 0x02, 0xE0, 0xFC, 0x2F,
-    0x00, 0x2E, 0x02, 0xF4, 0xFC, 0x02, 0xE0, 0x0B, 0xC3, 0xF0, 0x2E, 0x00, 0x2F, 0x0B, 0xD2, 0xE0,
-    0x00, 0xFC, 0x2F, 0xAE, 0x00, 0x03, 0xE0, 0x3F, 0xE0, 0x00, 0x2F, 0x40, 0xFF, 0x00, 0x00, 0xFC,
-    0x02, 0xFE, 0x00, 0x1F, 0xC0, 0x2E, 0xFF, 0xAB, 0xFC, 0x00, 0xE0, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F,
-    0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8,
-    0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F,
-    0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E,
-    0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07,
-    0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xE0, 0x00, 0x00, 0x7E,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x50, 0x00, 0x55, 0x57, 0xFF, 0xD0, 0x0F, 0xFF, 0x86, 0xF8, 0x00, 0x07, 0xF0, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3E,
-    0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xBF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE, 0x1F, 0xE0, 0x00,
-    0xBD, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x7D,
-    0x0B, 0x80, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xFF, 0xE4, 0x00, 0xBE, 0xAF, 0xF0, 0x0B, 0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0xBC, 0x0B, 0xC0, 0x07,
-    0xD0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x07, 0xC0, 0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x7F, 0x00, 0xBF,
-    0xFF, 0x80, 0x0B, 0xE9, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x7E, 0x5F, 0xD0, 0x00, 0xF4, 0x03, 0xE0,
-    0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xD0, 0x1F, 0x00,
-    0x03, 0xD0, 0x3C, 0x00, 0x03, 0xD0, 0xB4, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x03, 0xD0, 0x7F, 0x00,
-    0x03, 0xD0, 0x2F, 0xD0, 0x03, 0xD0, 0x0B, 0xF4, 0x03, 0xD0, 0x01, 0xFC, 0x03, 0xD0, 0x00, 0x7C,
-    0x03, 0xD1, 0x00, 0x3C, 0x03, 0xD3, 0x80, 0x7C, 0x0B, 0xD3, 0xE5, 0xF4, 0x3F, 0xD2, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x80, 0x0B, 0xEA, 0xF8, 0x03, 0xD0, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x6F, 0xFF, 0x00, 0xBF, 0xAB, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0,
-    0x3F, 0x01, 0xFE, 0xBF, 0xFE, 0x2F, 0xF8, 0xBF, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xEA, 0xF8, 0x03, 0xD0, 0x3F, 0x00,
-    0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xFF, 0x00, 0xBF, 0xAB, 0xC0,
-    0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x3F, 0x01, 0xFE, 0xBF, 0xFE, 0x2F, 0xF8, 0xBF,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0xF4, 0x00, 0x2E, 0x1F,
-    0x00, 0x1E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x30, 0x01,
-    0xFF, 0xBD, 0x00, 0x70, 0xFF, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0,
-    0x2F, 0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x09, 0x01,
-    0x80, 0x0F, 0xC1, 0xF8, 0x02, 0xF0, 0x7E, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF8, 0x00, 0xBE, 0xAF, 0x80, 0x3D, 0x03, 0xF0, 0x0F, 0x00, 0x7C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x06, 0xFF, 0xF0, 0x0B, 0xFA, 0xBC, 0x0B, 0xC0, 0x1F, 0x02, 0xF0,
-    0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x1F, 0xEB, 0xFF, 0xE2, 0xFF, 0x8B, 0xF0, 0x05, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x74, 0xB4, 0x00, 0x2C, 0x1D, 0x00, 0x0B, 0x47, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xEA, 0xF8, 0x03,
-    0xD0, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xFF, 0x00,
-    0xBF, 0xAB, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x3F, 0x01, 0xFE, 0xBF, 0xFE,
-    0x2F, 0xF8, 0xBF, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x0B, 0xFD,
-    0x02, 0xFA, 0xBD, 0xFA, 0xFD, 0x0F, 0x40, 0xFF, 0x40, 0xFC, 0x3C, 0x01, 0xF8, 0x01, 0xF0, 0x00,
-    0x07, 0xD0, 0x07, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xEA, 0x54, 0x2F, 0x91, 0xF0,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80, 0x04,
-    0x7F, 0xAF, 0xBF, 0xFF, 0xF0, 0xBF, 0xF4, 0x2F, 0xFF, 0x40, 0x14, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF, 0x4B, 0xC0, 0x3E, 0x3C, 0x00, 0xB6, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x1A, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x3F, 0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F, 0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00, 0x07,
-    0xD0, 0x00, 0x3D, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x3F,
-    0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F, 0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD,
-    0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0,
-    0x00, 0x54, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xBC, 0x00, 0xF0, 0xF4, 0x0F, 0x40,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0,
-    0x0B, 0xEE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x06, 0x00, 0x90,
-    0x7E, 0x0F, 0xC0, 0xF8, 0x3F, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x03, 0xFA, 0xFC, 0x3E, 0x00, 0xF9, 0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF,
-    0xFE, 0x00, 0x05, 0x40, 0x10, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0xBD, 0x00, 0xF8, 0x03, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x03, 0xD0, 0x0B, 0xF4, 0x1F, 0xBC, 0x3D, 0x2E,
-    0xB4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3F, 0x0B, 0xC0, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF8, 0x01, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-    0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x2F, 0xE4, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x2F, 0x6E, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xF4, 0xF4, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0x7D, 0x03, 0xFF, 0xFF,
-    0xC2, 0xF4, 0x07, 0xF0, 0xF4, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xEF, 0x80, 0x00,
-    0xBB, 0xE0, 0x00, 0x2E, 0xFC, 0x00, 0x0F, 0x6F, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0, 0xBF, 0x9B,
-    0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xC0,
-    0x00, 0x07, 0xFE, 0xB4, 0x00, 0x01, 0xD3, 0xFC, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x0B, 0xFE, 0x00, 0x7F, 0xEF, 0xFF, 0xD0, 0x01, 0xFE,
-    0x01, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
-    0x00, 0xF8, 0x00, 0x7C, 0x00, 0xBF, 0x80, 0x3F, 0xA0, 0xFF, 0xF4, 0x3F, 0xFC, 0x00, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x42, 0xF0, 0x07,
-    0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
-    0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0, 0xBF, 0x9B, 0xF0, 0x07, 0xFF,
-    0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0x42, 0xF0, 0x07, 0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3,
-    0xF0, 0x03, 0xE0, 0xBF, 0x9B, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xBD, 0x00, 0x0B, 0x87, 0xC0, 0x07, 0xC0, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02,
-    0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00,
-    0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00, 0x7F, 0xEF, 0x40, 0x1C, 0x3F, 0xC0, 0x01,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B,
-    0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0,
-    0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x02, 0x40, 0x60, 0x02, 0xF4, 0x7E, 0x00, 0xBC, 0x1F,
-    0x80, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xEF,
-    0xF4, 0x2F, 0x00, 0x7F, 0x1F, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0xFA, 0xF4, 0x00, 0x3C, 0x3F, 0x00, 0x3E, 0x0B, 0xF9,
-    0xBF, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xD0,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE1, 0xC0, 0x3F, 0xAF, 0xFE, 0x02, 0xF0, 0x07, 0xF0, 0x1F, 0x00, 0x2F, 0xD0, 0xBC,
-    0x02, 0xEF, 0x83, 0xE0, 0x2E, 0x3F, 0x0F, 0x82, 0xE0, 0xBC, 0x3E, 0x2E, 0x02, 0xE0, 0xFE, 0xE0,
-    0x0F, 0x82, 0xFE, 0x00, 0x3C, 0x03, 0xF0, 0x02, 0xE0, 0x2F, 0xF9, 0xBF, 0x00, 0xE7, 0xFF, 0xE0,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00,
-    0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xBC, 0x00,
-    0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC,
-    0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x01, 0xF0,
-    0xF0, 0x00, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xAF, 0x80, 0xBF, 0xC0, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D,
-    0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF,
-    0xFF, 0x90, 0x03, 0xFF, 0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
-    0x7E, 0x0F, 0xC0, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xBE, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0B, 0xC0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x07,
-    0xD0, 0x0F, 0xD0, 0x00, 0xFF, 0xBF, 0xFE, 0x40, 0x0F, 0xFE, 0x2F, 0xF0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F,
-    0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00,
-    0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x5B, 0xF8, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF5, 0xFF, 0xC0, 0x03, 0xEF, 0xFF, 0xC0, 0x0F, 0xE0, 0x2F, 0xC0, 0x3D, 0x00, 0x3F, 0x00,
-    0xF4, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x40, 0xF4,
-    0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x40, 0x2F, 0x40, 0x3F, 0xEB, 0xF4, 0x00, 0xFF, 0xFE,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x90, 0x14, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x82, 0xFF, 0x8F, 0xF9, 0x06, 0xFD, 0x0F, 0x80, 0x03, 0xD0, 0x2F, 0x00, 0x1F, 0x00, 0x3D, 0x00,
-    0xF4, 0x00, 0xBC, 0x03, 0xC0, 0x01, 0xF0, 0x2E, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x07, 0xC7, 0x80,
-    0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00,
-    0x1E, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x2E, 0x55,
-    0xBD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xEA, 0xAB, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xD0,
-    0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x8F, 0xFF,
-    0x40, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00,
-    0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x03, 0xF9, 0xB8, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00,
-    0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xB9,
-    0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0, 0x00, 0xF4, 0x00, 0x1F,
-    0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x3F,
-    0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0x00, 0x30, 0x01, 0xF4, 0x2C, 0x00, 0x3F, 0xFE,
-    0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00,
-    0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0,
-    0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFA, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0,
-    0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x7E, 0x50, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F,
-    0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x2F, 0xAF, 0xD2,
-    0xF0, 0x0F, 0x8F, 0x00, 0x2D, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xBD, 0x00, 0x03, 0xD1, 0xF0, 0x00,
-    0xB4, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9, 0x5F,
-    0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFC, 0x00, 0x1F,
-    0xBC, 0x00, 0xF0, 0xB8, 0x0B, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x0B,
-    0xEB, 0xF4, 0xBC, 0x03, 0xE3, 0xC0, 0x0B, 0x6F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFC,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03,
-    0xF9, 0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06,
-    0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x02, 0xFA,
-    0xFD, 0x2F, 0x00, 0xF8, 0xF0, 0x02, 0xDB, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0x00,
-    0x05, 0x40, 0x00, 0x90, 0x07, 0x40, 0x0F, 0x41, 0xF0, 0x00, 0x7E, 0x7C, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x07, 0xFF, 0xFC, 0x03, 0xF9,
-    0x5F, 0xC0, 0xFC, 0x00, 0x3C, 0x1F, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2C, 0x7D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x06, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xC0,
-    0xB8, 0x3C, 0x00, 0xF6, 0xD0, 0x00, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x2F, 0xAF, 0xD2, 0xF0, 0x0F, 0x8F, 0x00, 0x2D, 0xBC, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x54, 0x00, 0x02, 0x40, 0x1E, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xC5, 0x6F, 0xF0, 0x02, 0xF0, 0x00,
-    0xBF, 0x00, 0xBC, 0x00, 0x0B, 0xE0, 0x2F, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x2F, 0x42, 0xF0,
-    0x00, 0x07, 0xD0, 0xBC, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x42,
-    0xF0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xFC,
-    0x02, 0xF0, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xC0, 0x00, 0x2F, 0xF0, 0xF4, 0x00,
-    0x00, 0xBC, 0x3C, 0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x02, 0xF0, 0x80,
-    0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x02, 0xFE,
-    0xBF, 0xFA, 0x00, 0x2F, 0xFD, 0x3F, 0xD0, 0x00, 0x50, 0x04, 0x00, 0x00, 0x01, 0x6A, 0xA4, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF1, 0x5B, 0xFC, 0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x02, 0xF0,
-    0x00, 0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x7D,
-    0x17, 0xF5, 0x50, 0x07, 0xE7, 0xFF, 0xFF, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x2F, 0x00,
-    0x00, 0x7C, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x0A, 0xBF, 0xA0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x1A, 0xAF, 0xC0,
-    0x07, 0xFF, 0xFF, 0x00, 0x7E, 0x46, 0xFC, 0x03, 0xE0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xF8,
-    0x00, 0x2F, 0x03, 0xE0, 0x00, 0xBC, 0x0F, 0x80, 0x02, 0xF0, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x2F, 0x01, 0xFC, 0x01, 0xFC, 0x03, 0xFE, 0xBF, 0xFA, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x50, 0x04,
-    0x00, 0x00, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xBC, 0x0B, 0xC0, 0x02,
-    0xC0, 0xBC, 0x00, 0x1C, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBE,
-    0xAF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0xA0, 0xBC, 0x00, 0x0F, 0x0B, 0xC0, 0x01, 0xE2, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C, 0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF,
-    0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x03, 0xF9,
-    0xB8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00,
-    0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x01,
-    0x80, 0xF8, 0x1E, 0x01, 0xFF, 0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0B, 0xEE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82,
-    0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC,
-    0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xFA, 0xFC, 0x3E,
-    0x00, 0xF9, 0xF0, 0x02, 0xFB, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xD0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF, 0xFE, 0x00, 0x05, 0x40,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0xE8, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C,
-    0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0, 0x01, 0xB8, 0x00, 0x03, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0x7E, 0x50, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x7C,
-    0x0F, 0x80, 0x02, 0xF7, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0,
-    0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x38, 0x07, 0xC0, 0xF4, 0x3C, 0x00, 0xF7, 0xD0, 0x01, 0xFE, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xAF, 0xC3, 0xE0, 0x0F, 0x9F, 0x00, 0x2F,
-    0xB8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x3C, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8,
-    0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF,
-    0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C,
-    0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xEF, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x02,
-    0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFA,
-    0xFE, 0xF0, 0x3E, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x07, 0xC0, 0x0F, 0x40, 0x2F,
-    0x00, 0x2F, 0x41, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xE6, 0x90, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x1F, 0x00, 0x07, 0xE0, 0xF0,
-    0x00, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x0F, 0xD0, 0x0B, 0xE0, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x3F, 0x9B, 0x80, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F,
-    0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00,
-    0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00,
-    0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFA, 0xFE, 0xF0, 0x3E, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0F, 0x40, 0x2F, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xE6,
-    0x90, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xF4, 0x1F, 0x00, 0x07, 0xE0, 0xF0, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8,
-    0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD,
-    0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0xFE, 0xBF, 0xBC, 0x0F, 0x80, 0x3E, 0x00, 0x3D, 0x00,
-    0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xB9, 0xA4, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFD, 0x07, 0xC0, 0x01, 0xF8, 0x3C, 0x00, 0x02, 0xE1, 0xF0, 0x00, 0x0F, 0x03, 0xF4,
-    0x02, 0xF8, 0x07, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x7F,
-    0xFF, 0xF8, 0x02, 0xFE, 0x56, 0xF8, 0x0B, 0xD0, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x78, 0x3E, 0x00,
-    0x00, 0x30, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xBC, 0x00, 0x1A, 0xFD, 0xBD, 0x00, 0x00, 0x7C, 0x7F, 0x00,
-    0x00, 0x7C, 0x3F, 0x80, 0x00, 0x7C, 0x1F, 0xE0, 0x00, 0x7C, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xAF, 0xEF, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x3D,
-    0x00, 0x7C, 0x00, 0xF4, 0x02, 0xF0, 0x02, 0xF4, 0x1F, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x2E, 0x69,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0x41, 0xF0, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0xB8, 0x7C, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0xBE, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x00, 0x1D, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x05, 0x55, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x1F, 0xD0, 0x00,
-    0x5F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x02,
-    0xFF, 0x80, 0x06, 0xFE, 0x7F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0xFD, 0x00, 0x00, 0xFB, 0xFF, 0xF0, 0x00, 0x0F, 0xE0, 0x2F,
-    0x80, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0xBC,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x06, 0xFE, 0x01, 0xFE, 0x41, 0xFF, 0xF0, 0x7F, 0xFC, 0x15, 0x55,
-    0x00, 0x15, 0x55, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x7E, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x2B, 0xFA, 0xAA, 0xAB, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x0B, 0xFE, 0x00, 0x1B, 0xF9, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6B, 0xFA,
-    0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x06, 0xA4, 0x00, 0x03,
-    0xDF, 0xFF, 0xC0, 0x00, 0xFF, 0x9B, 0xF4, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x01, 0xBF, 0x80, 0x7F, 0x91, 0xFF, 0xF0,
-    0x7F, 0xFC, 0x05, 0x01, 0x0F, 0xF0, 0xE7, 0xEF, 0xF8, 0xD1, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xC2, 0x8F, 0xFE, 0xF3, 0xC7,
-    0xF8, 0x10, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x7F, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-    0x00, 0xBF, 0x91, 0xFF, 0xF8, 0x05, 0x55, 0x0F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x43, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xFF, 0x83, 0xFF, 0xF4, 0xBF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x07, 0xFE, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x0B, 0xF9, 0x1F,
-    0xFF, 0x80, 0x10, 0x00, 0x1E, 0x00, 0xA3, 0xF5, 0xF4, 0x7F, 0xF8, 0x01, 0x50, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0xFF, 0xFD, 0x07, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0xBF, 0xE0, 0xFF, 0xFD, 0x00, 0x00, 0xB0, 0x03, 0xFD, 0x1F, 0x7F, 0xFC,
-    0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x2F, 0xF8, 0xFF, 0xFD, 0x07, 0x80, 0x1E, 0x00, 0x3E, 0x00, 0x2F, 0xA4, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x00, 0xF4, 0x03, 0xC0, 0x07, 0xC0, 0x03, 0xE5,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x2F, 0xF8, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE,
-    0x55, 0x54, 0x15, 0x55, 0x3F, 0xFF, 0x4F, 0xFF, 0xD1, 0xFD, 0x01, 0x7F, 0x40, 0x2F, 0x00, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x2F, 0xF8, 0x03, 0xF0, 0x3F, 0xFF, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBC, 0x0B, 0xF0, 0x0F,
-    0xD0, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x02, 0xFC, 0x7F, 0xE0, 0xBF, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C,
-    0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x03, 0xE0,
-    0x07, 0xC0, 0x3E, 0x00, 0x7C, 0x0B, 0xF9, 0x07, 0xC7, 0xFF, 0xE0, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x28, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0xC0, 0xB8, 0x3E, 0x0E, 0x00, 0xA0, 0x00, 0x00,
-    0x05, 0x55, 0x40, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-    0x1F, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0xF0, 0x02, 0xEF, 0x80, 0x7C, 0x3C, 0x0F, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x02, 0xE0, 0x00, 0x55, 0x54, 0x05,
-    0x55, 0x0F, 0xFF, 0xC0, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0B,
-    0xC0, 0x2F, 0x40, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xBC, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0xBC,
-    0x7F, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0xC0,
-    0x00, 0xBC, 0x00, 0xBF, 0x40, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFD, 0x03, 0xC0, 0xBF, 0xE0,
-    0x0F, 0x00, 0xF8, 0x00, 0x3C, 0x1F, 0x80, 0x00, 0xF1, 0xF4, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x0F,
-    0x7E, 0x00, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xF0, 0xBD, 0x00, 0x03, 0xC0, 0xFD, 0x00, 0x0F, 0x00,
-    0xFE, 0x01, 0xBE, 0x40, 0xFE, 0x1F, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0xBF, 0xF8, 0x7F, 0xD0, 0x6F, 0xF4,
-    0x03, 0xD0, 0x2F, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x03, 0xEF, 0xC0, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x03, 0xDB, 0xE0, 0x00, 0x03, 0xD3, 0xF4, 0x00, 0x03, 0xD0, 0xFE, 0x00,
-    0x03, 0xD0, 0x3F, 0x80, 0x0B, 0xF4, 0x0F, 0xF0, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x08, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x02, 0xFC, 0x2F, 0xF4, 0x3A, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E,
-    0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x40, 0x2F, 0xD0, 0x6F, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF9, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x03, 0xE0, 0x02, 0xE0,
-    0x03, 0xD0, 0x07, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x55, 0x54, 0x1F,
-    0x0F, 0xFF, 0xD2, 0xE0, 0x1F, 0xD0, 0x2C, 0x00, 0xBC, 0x02, 0x80, 0x0B, 0xC0, 0x10, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B, 0xC0,
-    0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x40, 0x42, 0xFD,
-    0x0F, 0x6F, 0xD0, 0xF0, 0x3D, 0x1E, 0x03, 0xD1, 0xD0, 0x3D, 0x2C, 0x03, 0xD0, 0x40, 0x3D, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1B, 0xF9, 0x0B, 0xFF, 0xE0, 0x55, 0x54,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x0A, 0x00, 0xBC, 0x02, 0xF8, 0x0B, 0xC0, 0x2F, 0x80, 0xBC, 0x00,
-    0xA0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0E, 0x0B,
-    0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFC, 0x00, 0x40, 0x00,
-    0x2F, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x38, 0x03, 0xD0, 0xBE, 0x03, 0xD0,
-    0xBD, 0x03, 0xD0, 0x14, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x1B, 0xF9, 0x00, 0xBF, 0xFE, 0x00, 0x05, 0x55, 0x40, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x14, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x28, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x0E, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0xBC, 0x00, 0x2E, 0x02, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x10, 0x00, 0xBF, 0x40, 0x1B, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40,
-    0x00, 0xF4, 0x00, 0x0F, 0x48, 0x00, 0xFB, 0xC0, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0x2F,
-    0xF4, 0x03, 0x4F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x06, 0xFE,
-    0x42, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0x80, 0x2F, 0xE0,
-    0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B, 0x4F, 0xC0, 0x0B,
-    0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F, 0x02, 0xD0, 0x0B,
-    0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4, 0x02, 0xD0, 0x00,
-    0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x40, 0x03, 0xF4,
-    0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFF, 0x80,
-    0x1F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xE0, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0,
-    0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0xE0, 0x0F, 0xE8, 0x3F,
-    0xFD, 0x0F, 0xFF, 0x00, 0x55, 0x40, 0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00,
-    0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D,
-    0x00, 0xB4, 0xFC, 0x00, 0xB4, 0x02, 0xD1, 0xF8, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D,
-    0x03, 0xF0, 0x2D, 0x00, 0xB4, 0x07, 0xE0, 0xB4, 0x02, 0xD0, 0x0B, 0xD2, 0xD0, 0x0B, 0x40, 0x0F,
-    0xCB, 0x40, 0x2D, 0x00, 0x0F, 0xAD, 0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0,
-    0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF0, 0xBF, 0xE0, 0x07, 0xFE, 0xFF, 0xFD, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x0B, 0xF8,
-    0x03, 0xFA, 0x0F, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x02,
-    0xF7, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x05, 0x55, 0x7F, 0xF4, 0x00, 0x3F, 0xFE, 0x1F, 0xF0, 0x00, 0x1F, 0x80,
-    0x2F, 0xE0, 0x00, 0x2D, 0x00, 0xBF, 0xD0, 0x00, 0xB4, 0x02, 0xDB, 0xC0, 0x02, 0xD0, 0x0B, 0x4F,
-    0xC0, 0x0B, 0x40, 0x2D, 0x1F, 0x80, 0x2D, 0x00, 0xB4, 0x2F, 0x00, 0xB4, 0x02, 0xD0, 0x3F, 0x02,
-    0xD0, 0x0B, 0x40, 0x7E, 0x0B, 0x40, 0x2D, 0x00, 0xBD, 0x2D, 0x00, 0xB4, 0x00, 0xFC, 0xB4, 0x02,
-    0xD0, 0x00, 0xFA, 0xD0, 0x0B, 0x40, 0x01, 0xFF, 0x40, 0x2D, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x40,
-    0x03, 0xF4, 0x3F, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x02, 0xD0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2,
-    0xFF, 0x80, 0x1F, 0xFB, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0,
-    0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0xE0, 0x0F,
-    0xE8, 0x3F, 0xFD, 0x0F, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x1B, 0xC7, 0xFF, 0x40, 0x0E, 0x02,
-    0xFF, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFE, 0x01, 0xFE, 0x40, 0x00, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x00, 0x55, 0x40, 0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00,
-    0x01, 0xF8, 0x02, 0xFE, 0x00, 0x02, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D,
-    0x00, 0xB4, 0xF8, 0x00, 0xB4, 0x02, 0xD1, 0xF4, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D,
-    0x03, 0xE0, 0x2D, 0x00, 0xB4, 0x07, 0xD0, 0xB4, 0x02, 0xD0, 0x0B, 0xC2, 0xD0, 0x0B, 0x40, 0x0F,
-    0x8B, 0x40, 0x2D, 0x00, 0x0F, 0x6D, 0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0,
-    0x2F, 0xE4, 0x00, 0x3F, 0x43, 0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x06, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x0B, 0xFE, 0x07, 0xFE, 0xFF, 0xFD, 0x01, 0xFE, 0x01,
-    0xFC, 0x03, 0xE0, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C,
-    0x03, 0xE0, 0x01, 0xF0, 0x0F, 0x80, 0x07, 0xC0, 0x3E, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x7C, 0x0B,
-    0xF8, 0x01, 0xF0, 0xFF, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0x91, 0xBF,
-    0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xD0,
-    0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00,
-    0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0,
-    0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00, 0x03, 0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
-    0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC,
-    0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x80, 0x28, 0x00,
-    0x00, 0x3F, 0x5F, 0x40, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00,
-    0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02,
-    0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x09, 0x00, 0x7D,
-    0x0B, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8,
-    0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F,
-    0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x01, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00,
-    0x3F, 0x07, 0xE0, 0x00, 0x03, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0x91, 0xBF, 0xC0, 0x0F, 0xD0, 0x00, 0xBF, 0x02, 0xF4,
-    0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x1F, 0xC7, 0xD0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0F,
-    0xCB, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xBD, 0x00,
-    0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF8, 0x00, 0x03, 0xF0,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x40, 0x03, 0xC3, 0xE0, 0x03, 0xE1, 0xF0, 0x01,
-    0xF0, 0xF4, 0x00, 0xB0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x03,
-    0xFE, 0xFF, 0x42, 0xF0, 0x07, 0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3E, 0xFC, 0x00, 0x0F, 0xAF, 0x40, 0x03, 0xC3, 0xF0, 0x03, 0xE0,
-    0xBF, 0x9B, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xE5, 0x7F, 0xAA, 0xBE, 0x02, 0xF8, 0x00, 0xF8, 0x00,
-    0x38, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xD0, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x3E,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFA, 0xFF, 0x03, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xC2, 0xF8, 0x00, 0x3E, 0x00, 0x0B,
-    0x03, 0xFD, 0x00, 0xF8, 0x00, 0x3C, 0x02, 0xFF, 0xAB, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x0F, 0xFE, 0x00, 0xFE, 0xBF, 0x5F, 0xEF, 0xE0, 0xF8, 0x02, 0xFF, 0x40, 0x7C, 0x7C, 0x00, 0x3F,
-    0xC0, 0x0F, 0xAF, 0x00, 0x07, 0xE0, 0x03, 0xEF, 0x80, 0x00, 0xFF, 0xFF, 0xFB, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFD, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x02, 0xFC,
-    0x00, 0x01, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xE6, 0xFB, 0xFF, 0xFF, 0x42, 0xFF, 0xF4, 0x2F,
-    0xFF, 0x80, 0x05, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA5, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xC1, 0xBF, 0x40, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0,
-    0x03, 0xD0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02,
-    0xF0, 0xFC, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x2F, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0x3F, 0x40,
-    0x02, 0xF0, 0x03, 0xF8, 0x02, 0xFE, 0x80, 0x7F, 0x83, 0xFF, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2, 0xFC, 0x7F, 0xCB, 0xFC,
-    0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFA, 0x40, 0x7F, 0xFF,
-    0x80, 0x05, 0xAA, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFC, 0x1B, 0xF4, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F,
-    0x00, 0x3D, 0x00, 0x0B, 0xC0, 0xBE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x00, 0xBC, 0x03, 0xF4,
-    0x00, 0x2F, 0x00, 0x3F, 0x80, 0x2F, 0xE8, 0x07, 0xF8, 0x3F, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xC2, 0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x1B, 0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x38, 0x00, 0x03,
-    0xE0, 0x7D, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA5, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xC1, 0xBF,
-    0x40, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x2F, 0x02, 0xF8, 0x00,
-    0x0B, 0xC0, 0x3F, 0x40, 0x02, 0xF0, 0x03, 0xF8, 0x02, 0xFE, 0x80, 0x7F, 0x83, 0xFF, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x01, 0xE0, 0x0F, 0x47, 0xC0, 0x07,
-    0xDF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC2,
-    0xFC, 0x7F, 0xCB, 0xFC, 0x07, 0xFE, 0x68, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B,
-    0xFA, 0x40, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0xFE,
-    0x40, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00,
-    0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x81, 0xF5, 0xBD, 0x3C, 0x02, 0xD3, 0xC0, 0x0C, 0x3F, 0x40,
-    0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x0B, 0xFC, 0x10, 0x0B, 0xE7, 0x00, 0x2E, 0x78, 0x02, 0xE7,
-    0xE5, 0xBC, 0x3F, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFB, 0xD0,
-    0x07, 0xC1, 0xF0, 0x0B, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F,
-    0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D,
-    0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01,
-    0x54, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x07, 0xEF, 0x00, 0xF4, 0xB8, 0x2D, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4, 0x00,
-    0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E, 0x7E,
-    0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F, 0xD5, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D, 0xF0, 0x00,
-    0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01, 0x54, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x1F, 0x5B, 0xD3, 0xC0, 0x2D, 0x3C, 0x00, 0xC3, 0xF4,
-    0x00, 0x2F, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xC1, 0x00, 0xBE, 0x70, 0x02, 0xE7, 0x80, 0x2E,
-    0x7E, 0x5B, 0xC3, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x1A, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xC0, 0x00,
-    0x7C, 0x00, 0x1F, 0x00, 0x01, 0x40, 0x00, 0x08, 0x00, 0x74, 0x0F, 0x42, 0xF0, 0x07, 0xDB, 0xC0,
-    0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x07, 0xFF, 0xFC, 0x1F,
-    0xD5, 0xBC, 0x3E, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x3D, 0x00, 0x34, 0x3F, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x20, 0x00, 0x7D,
-    0xF0, 0x00, 0x3D, 0xF4, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0xBF, 0xAB, 0xF0, 0x2F, 0xFF, 0xC0, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x2E, 0x0F, 0x40, 0xF6, 0xE0, 0x03, 0xFC, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x81, 0xF5, 0xBD, 0x3C, 0x02, 0xD3, 0xC0, 0x0C,
-    0x3F, 0x40, 0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x0B, 0xFC, 0x10, 0x0B, 0xE7, 0x00, 0x2E, 0x78,
-    0x02, 0xE7, 0xE5, 0xBC, 0x3F, 0xFF, 0x00, 0x15, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00,
-    0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFA,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x2F, 0xFF,
-    0xCF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF, 0x02, 0xFF, 0xD0, 0x01,
-    0x40, 0x00, 0x68, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x05, 0x00,
-    0x00, 0xA0, 0x03, 0x80, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x50, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3E, 0xAB, 0xFA, 0xAF, 0x0F, 0x00, 0xF8, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0xF0, 0x90,
-    0x0F, 0x80, 0x24, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xBF,
-    0xA0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0x40, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x74,
-    0x03, 0xC7, 0x00, 0x7C, 0x10, 0x07, 0xC0, 0x02, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x00, 0x07, 0xFA, 0xF0, 0x2F, 0xFD, 0x00, 0x14, 0x00, 0x15, 0x55, 0x55, 0x55, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F,
-    0x09, 0x00, 0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x17, 0xF5,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1B, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0xFF, 0xFF, 0x80, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xAF,
-    0x02, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x2F, 0xC3, 0x80, 0x00, 0x00,
-    0xFB, 0xFF, 0x00, 0x00, 0x03, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B, 0xE0, 0x00, 0x1F, 0xC0,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02,
-    0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0F, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x83, 0x40, 0x00, 0x0F, 0xFA, 0xE0, 0x00, 0x03, 0x4B, 0xF4, 0x00, 0x00, 0x40, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xAF, 0x80, 0xBF, 0xC0,
-    0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF, 0x90, 0x03, 0xFF, 0x8B,
-    0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50,
-    0x00, 0x55, 0x57, 0xFF, 0xD0, 0x0F, 0xFF, 0x86, 0xF8, 0x00, 0x07, 0xF0, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x00, 0xFC, 0x00, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xBF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A,
-    0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02,
-    0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9,
-    0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x01, 0xC0, 0x00, 0x00, 0xFE, 0x6E, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x01, 0x55, 0x5F, 0xFF, 0x40, 0x3F, 0xFE, 0x1B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00,
-    0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D,
-    0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xF0, 0x01,
-    0xF8, 0x00, 0x0F, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0x80, 0x00, 0x0F, 0x82, 0xD0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0xAF, 0x80, 0xBF, 0xC0, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF,
-    0x90, 0x03, 0xFF, 0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x03, 0xC3,
-    0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55,
-    0x7F, 0xFD, 0x00, 0xFF, 0xF8, 0x6F, 0x80, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00,
-    0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0xC0,
-    0x00, 0x7C, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03,
-    0x87, 0x80, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00, 0x78, 0x38, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x0D, 0x00, 0x00, 0x0B,
-    0xC0, 0xFC, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x34, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x05, 0x55, 0x7F, 0xFD, 0x00, 0xFF, 0xF8, 0x6F,
-    0x80, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0x02, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0xC0, 0x07,
-    0xE0, 0x00, 0x3F, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x1D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x2B, 0xE0, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF, 0xE1, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0xF4, 0x00, 0x02,
-    0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x00, 0x3D,
-    0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A, 0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F,
-    0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0x7F, 0xC0, 0x01, 0x50, 0x0F, 0x40,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFF, 0x00, 0x28, 0x00, 0xBF, 0xFC, 0x1B, 0xF4, 0x00,
-    0x3D, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0x80, 0x01, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x01, 0xEF, 0x80, 0x1F, 0x00,
-    0x00, 0xFC, 0x02, 0xDB, 0xC0, 0x2E, 0x00, 0x00, 0x7C, 0x03, 0xC7, 0xC0, 0x3D, 0x00, 0x00, 0x3D,
-    0x07, 0x83, 0xD0, 0x3C, 0x00, 0x00, 0x3E, 0x0B, 0x42, 0xF0, 0xB8, 0x00, 0x00, 0x2F, 0x0F, 0x01,
-    0xF0, 0xF4, 0x00, 0x00, 0x0F, 0x0E, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x0F, 0x6D, 0x00, 0xB9, 0xE0,
-    0x00, 0x00, 0x0B, 0xBC, 0x00, 0x7E, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x70, 0x0B, 0xFE,
-    0x3F, 0xE4, 0x0B, 0x40, 0x6F, 0xD0, 0xF8, 0x00, 0xFC, 0x00, 0xF4, 0x0B, 0xC0, 0x1F, 0xC0, 0x1F,
-    0x00, 0x3D, 0x02, 0xFD, 0x02, 0xE0, 0x03, 0xE0, 0x3E, 0xF0, 0x3C, 0x00, 0x2F, 0x07, 0x5F, 0x03,
-    0xC0, 0x00, 0xF0, 0xB0, 0xF4, 0x74, 0x00, 0x0F, 0x8F, 0x0B, 0xCF, 0x00, 0x00, 0x7D, 0xD0, 0x3C,
-    0xE0, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0x74, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE, 0x1F, 0xE0, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x7D, 0x0B, 0x80, 0x00,
-    0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x01, 0xE0, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x0B, 0xFE, 0x3F, 0xE4, 0x1B, 0xF4,
-    0x3E, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x00, 0xF4, 0x03, 0xD0, 0x02, 0xF0, 0x0F, 0x00, 0x07,
-    0xC0, 0xB8, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x16, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x0A, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x55, 0x5B, 0xFF, 0xE0, 0x7F, 0xF8, 0x7F, 0x80,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xBD, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x01,
-    0xF4, 0x2E, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00, 0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00,
-    0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00,
-    0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F, 0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00, 0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00,
-    0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00, 0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F,
-    0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0E, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0xAA, 0xAF, 0xD0, 0xB8, 0x00,
-    0x3E, 0x02, 0xC0, 0x03, 0xF0, 0x02, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x2C, 0x0F, 0xC0, 0x00, 0xF0, 0xBD, 0x00, 0x07, 0xC3, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xB4,
-    0x07, 0xC2, 0xE0, 0x02, 0xF7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x2C, 0x00, 0xF8, 0x2C, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x05, 0x0B, 0xC0, 0x0F,
-    0x1F, 0x40, 0x1E, 0x3F, 0xAA, 0xFE, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x2F, 0xFE, 0x00, 0xBD, 0x7F, 0x00, 0xF0, 0x09, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x0B, 0xFA, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xAA, 0x40, 0x7C, 0x00, 0xBF, 0xFF, 0xE7, 0xD0,
-    0x0F, 0xE4, 0x6F, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0x00,
-    0x00, 0x1F, 0xC1, 0xF4, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x1F,
-    0x80, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-    0x1F, 0xC0, 0x01, 0xFF, 0xAB, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x7F, 0xF9, 0xF4,
-    0x0F, 0xFB, 0xFF, 0x40, 0xBC, 0x01, 0xFC, 0x07, 0xC0, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xE0, 0xF8,
-    0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xF8, 0x3F, 0x00, 0x03, 0xE0, 0xBD, 0x00,
-    0x0F, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xFE, 0x6F, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x5A, 0xA5, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x7E, 0x7E, 0x07, 0xFC, 0xF8, 0x3D, 0x00,
-    0xBD, 0xB8, 0x3D, 0x00, 0x3E, 0x14, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00,
-    0x7C, 0x00, 0x3D, 0x01, 0xF8, 0x00, 0x3F, 0xAF, 0xF0, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x01, 0xBF, 0xA0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x0B, 0xD7, 0xF0, 0x00, 0x3C, 0x02, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF4, 0xBF, 0xD0, 0x03, 0xEF, 0xFF, 0xD0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3E,
-    0x00, 0x2F, 0x40, 0xF8, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xE0, 0x3E, 0x00,
-    0x0F, 0x80, 0xF8, 0x00, 0x3D, 0x03, 0xE0, 0x02, 0xF0, 0x0F, 0x80, 0x1F, 0x40, 0x3F, 0xEB, 0xF8,
-    0x00, 0xFF, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x07, 0xC0, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0xCF, 0xFF, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0,
-    0x00, 0x7F, 0xBF, 0x02, 0xFF, 0xF0, 0x01, 0x5E, 0x00, 0x01, 0xE0, 0x00, 0x2D, 0x03, 0xC7, 0xC0,
-    0x3F, 0xF4, 0x00, 0xA8, 0x00, 0x00, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xBF, 0xAB, 0xFA,
-    0xBF, 0xFC, 0x03, 0xE0, 0x1F, 0xFC, 0x03, 0xE0, 0x0E, 0x7E, 0x03, 0xE0, 0x0C, 0x04, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x3F, 0xFC, 0x00, 0xF9, 0xBD, 0x03, 0xE0, 0x18, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x07, 0xC0, 0x00, 0x07, 0xFA, 0xF0, 0x02, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x03, 0xE0,
-    0x0F, 0x09, 0x00, 0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x80, 0x00, 0x00, 0xF9, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x15, 0x54, 0x00,
-    0x15, 0xBD, 0x7F, 0xFD, 0x00, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xEF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0xBF, 0x00, 0xAF, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0,
-    0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B,
-    0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF, 0x90, 0x03, 0xFF, 0x8B, 0xFC,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 0x07, 0x80, 0x7E, 0x02, 0xF4, 0x0B, 0xC0, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xD0, 0xF8, 0x3E, 0x03, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0xF0, 0x1F,
-    0xBC, 0x3C, 0x2E, 0xB4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0A, 0xFF, 0xEF, 0xF1, 0xFE, 0x10,
-    0x24, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x03, 0xF8, 0x1F, 0x7F,
-    0xFC, 0x0B, 0xA0, 0x3C, 0xBE, 0xBD, 0x14, 0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0xC0, 0x40,
-    0x10, 0x06, 0x90, 0x2F, 0xFC, 0x3C, 0x3C, 0x34, 0x3C, 0x00, 0xB8, 0x07, 0xD0, 0x03, 0x40, 0x00,
-    0x00, 0x01, 0x90, 0x1F, 0xF4, 0x3C, 0x3C, 0x38, 0x2C, 0x3C, 0x3C, 0x2F, 0xF4, 0x06, 0x90, 0x00,
-    0x00, 0x00, 0x34, 0x38, 0x0B, 0xC7, 0xC0, 0xF4, 0xF8, 0x2E, 0x1F, 0x03, 0x82, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x3C, 0x2E, 0x0F, 0x00, 0xF6, 0xD0, 0x03, 0xF8, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x02, 0xC1, 0xC0, 0x3D, 0x3E, 0x02, 0xF1, 0xF0, 0x0F, 0x4B, 0x80, 0x38, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xFE, 0xE0, 0x1F, 0x80, 0x05, 0x00, 0x0E, 0x3C, 0xB8,
-    0xF4, 0xF8, 0xBD, 0x14, 0x19, 0x0F, 0xC1, 0xF4, 0x3D, 0x0F, 0x0B, 0x43, 0x40, 0x19, 0x0F, 0xC7,
-    0xD1, 0xF0, 0x3C, 0x07, 0x80, 0x70, 0x00, 0x2D, 0x3D, 0x3C, 0x38, 0x30, 0x10, 0x28, 0x3E, 0x3E,
-    0x7C, 0xB0, 0x00, 0x3C, 0xBE, 0xBD, 0x14, 0x18, 0x02, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0xC0, 0x40,
-    0x10, 0x0A, 0x47, 0xBD, 0xB0, 0xEB, 0x0E, 0x7F, 0xC0, 0x50, 0x0A, 0x07, 0xE0, 0xF8, 0x3D, 0x1E,
-    0x05, 0x00, 0x1A, 0x03, 0xFC, 0x03, 0xC0, 0x7C, 0x2F, 0x01, 0x40, 0x00, 0x01, 0xE0, 0x3C, 0x0B,
-    0x80, 0x7E, 0x52, 0xFD, 0x00, 0x00, 0x66, 0xDB, 0x6D, 0xB5, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x0F,
-    0xF8, 0x2E, 0x3D, 0xB8, 0x0F, 0x10, 0x00, 0x00, 0x00, 0xF0, 0x07, 0xFD, 0x1F, 0x3F, 0xFC, 0x06,
-    0x90, 0x00, 0x00, 0x3E, 0x0A, 0xFF, 0xDF, 0xF2, 0xFE, 0x50, 0x68, 0x05, 0x55, 0x43, 0xFF, 0xFC,
-    0x2A, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xFE, 0xE0, 0x1F, 0x80, 0x05, 0x00, 0x09, 0x00,
-    0x00, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x01, 0x00, 0x18, 0x02, 0x47, 0xF0,
-    0xFD, 0x3E, 0x0F, 0xC0, 0x40, 0x10, 0x10, 0x0F, 0x03, 0xC0, 0xFA, 0x2F, 0x40, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07,
-    0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F,
-    0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00,
-    0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xD0, 0x05, 0xAA, 0x50, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xC1, 0xBF, 0x00, 0xBC, 0x02,
-    0xF4, 0x0B, 0xC0, 0x0F, 0x40, 0xBC, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0xBC, 0x02, 0xE0, 0x0B,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x0B, 0xC0, 0x1F, 0xC0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x03,
-    0xE0, 0xBC, 0x00, 0x3E, 0x0B, 0xC0, 0x07, 0xD0, 0xBC, 0x01, 0xFC, 0x2F, 0xFB, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE1, 0xFE, 0xAA, 0xF4,
-    0x2F, 0x00, 0x3D, 0x0B, 0xC0, 0x0B, 0x42, 0xF0, 0x02, 0xC0, 0xBC, 0x00, 0x10, 0x2F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x78, 0x1F,
-    0x00, 0x00, 0xB4, 0x0F, 0x80, 0x00, 0xF0, 0x0B, 0xC0, 0x02, 0xE0, 0x07, 0xD0, 0x03, 0xC0, 0x03,
-    0xE0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x40, 0x01, 0xF4, 0x0F, 0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00,
-    0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00,
-    0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x05, 0x55, 0x55, 0x40, 0x7F, 0xFF, 0xFF, 0x41,
-    0xFA, 0xAA, 0xFD, 0x0B, 0x80, 0x03, 0xE0, 0x2C, 0x00, 0x3F, 0x00, 0x20, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xC0, 0xFC, 0x00, 0x0F,
-    0x0B, 0xD0, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x54, 0x00, 0x55, 0x57, 0xFF, 0xF0, 0x07, 0xFF, 0xE1, 0xFD, 0x00, 0x05, 0xF8, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xF8, 0x00, 0x6F,
-    0xE7, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03,
-    0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01,
-    0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x1F, 0xFF, 0x0B, 0xCF, 0xC2,
-    0xFF, 0xF0, 0xBC, 0xFC, 0x05, 0x54, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE,
-    0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x55, 0x54, 0xFF, 0xFD,
-    0x1F, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD,
-    0x55, 0x54, 0x05, 0x55, 0x0F, 0xFF, 0xC0, 0xFF, 0xF4, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x0B, 0xC0, 0x2F, 0x40, 0x00, 0xBC, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00,
-    0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x0B, 0xC2, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x0B,
-    0xC0, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0xBF, 0x40, 0x2F, 0xF8, 0x02, 0xFE, 0x0F, 0xFF, 0xC0, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xAF, 0x00, 0x00, 0x00, 0xF1, 0xF0,
-    0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x02, 0xD0, 0xFC, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x07,
-    0xC0, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0xF8,
-    0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x2F, 0xE0,
-    0x01, 0xBF, 0x9F, 0xFF, 0x40, 0x7F, 0xFF, 0x05, 0x54, 0x00, 0x00, 0x55, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xEF,
-    0x40, 0x0F, 0x7C, 0x00, 0x07, 0x6F, 0x00, 0x39, 0xF0, 0x00, 0x2D, 0x7C, 0x02, 0xD7, 0xC0, 0x00,
-    0xB0, 0xF4, 0x0F, 0x0F, 0x00, 0x03, 0xC2, 0xE0, 0x38, 0x3C, 0x00, 0x0F, 0x07, 0xC2, 0xC0, 0xF4,
-    0x00, 0x3C, 0x0F, 0x4F, 0x03, 0xD0, 0x00, 0xF0, 0x2E, 0x78, 0x0F, 0x40, 0x03, 0xC0, 0x3E, 0xC0,
-    0x3E, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0xB8, 0x00, 0x78, 0x02, 0xF4, 0x02, 0xF0, 0x01, 0xE0, 0x03,
-    0xC0, 0x0B, 0xC0, 0x2F, 0xE4, 0x05, 0x00, 0xBF, 0xE3, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x55,
-    0x40, 0x00, 0x55, 0x57, 0xFF, 0x40, 0x03, 0xFF, 0xE1, 0xFF, 0x00, 0x01, 0xF8, 0x02, 0xFE, 0x00,
-    0x02, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0x40, 0x2D, 0xBC, 0x00, 0x2D, 0x00, 0xB4, 0xFC, 0x00, 0xB4,
-    0x02, 0xD1, 0xF8, 0x02, 0xD0, 0x0B, 0x42, 0xF0, 0x0B, 0x40, 0x2D, 0x03, 0xF0, 0x2D, 0x00, 0xB4,
-    0x07, 0xE0, 0xB4, 0x02, 0xD0, 0x0B, 0xD2, 0xD0, 0x0B, 0x40, 0x0F, 0xCB, 0x40, 0x2D, 0x00, 0x0F,
-    0xAD, 0x00, 0xB4, 0x00, 0x1F, 0xF4, 0x02, 0xD0, 0x00, 0x3F, 0xD0, 0x2F, 0xE4, 0x00, 0x3F, 0x43,
-    0xFF, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x15, 0x55, 0x55, 0x41, 0xFF, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x1E, 0x00, 0x00, 0x78, 0x78, 0x00, 0x01, 0xD0, 0x90, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xCF, 0x00,
-    0x00, 0x0F, 0x3D, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
-    0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB,
-    0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00,
-    0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA,
-    0xAB, 0xF4, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x2F, 0xF8, 0x00, 0xBF, 0xA3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0xAA, 0x50, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xC1, 0xBF, 0x40, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0x7C, 0x0B,
-    0xC0, 0x0B, 0xC0, 0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x2F, 0x00, 0xBE, 0xBF, 0xD0, 0x0B, 0xFF, 0xE0,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x2F, 0xF9, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF,
-    0x81, 0xFE, 0xAA, 0xBF, 0x02, 0xF4, 0x00, 0x3C, 0x03, 0xF4, 0x00, 0xF0, 0x03, 0xF0, 0x01, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x10, 0x0B, 0xC0, 0x00, 0xD0, 0xBC, 0x00,
-    0x0B, 0x4B, 0xD0, 0x00, 0x3D, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA, 0xBF, 0xAA, 0xF0, 0xF0, 0x0F,
-    0x80, 0x3C, 0x3C, 0x03, 0xE0, 0x0F, 0x09, 0x00, 0xF8, 0x02, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0x40,
-    0x00, 0x09, 0x0F, 0xF0, 0x00, 0x0F, 0xCB, 0xFE, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x0B, 0xD0, 0x00,
-    0xF8, 0x03, 0xE0, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0xB8, 0x7C, 0x00,
-    0x00, 0x1F, 0x3D, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1B, 0xFA, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x07, 0xFF, 0xFF,
-    0xFD, 0x02, 0xF8, 0x1F, 0x07, 0xF8, 0x7E, 0x01, 0xF0, 0x0B, 0xDB, 0xC0, 0x1F, 0x00, 0x3E, 0xFC,
-    0x01, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xFC, 0x01, 0xF0, 0x03, 0xEB, 0xD0, 0x1F, 0x00,
-    0xBC, 0x3F, 0x41, 0xF0, 0x2F, 0x80, 0xFF, 0xAF, 0xAF, 0xD0, 0x01, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x00,
-    0x00, 0x15, 0x55, 0x00, 0x55, 0x43, 0xFF, 0xF0, 0x2F, 0xFD, 0x07, 0xF4, 0x00, 0x7E, 0x00, 0x1F,
-    0xC0, 0x0F, 0x80, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x1F, 0xCF, 0x40,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xF2, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0B, 0x80, 0x3F, 0x00,
-    0x01, 0xF0, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0xD0, 0x2F, 0xE4, 0x01, 0xFF, 0x9F, 0xFF, 0xC0,
-    0xBF, 0xFF, 0x24, 0x01, 0x55, 0x50, 0x09, 0x3E, 0x07, 0xFF, 0xE0, 0x3E, 0x2F, 0x00, 0x7E, 0x00,
-    0x7D, 0x1F, 0x40, 0x3E, 0x00, 0xBC, 0x0F, 0x40, 0x3E, 0x00, 0xFC, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-    0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x0F, 0xC0, 0x3E, 0x00, 0xF4, 0x0B, 0xC0, 0x3E, 0x02, 0xF0, 0x03,
-    0xE0, 0x3E, 0x03, 0xE0, 0x02, 0xF8, 0x3E, 0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xD4, 0x6F, 0xD0, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0xF8,
-    0x03, 0xF0, 0x00, 0x07, 0xC0, 0x07, 0xD0, 0x00, 0x3E, 0x01, 0x4B, 0xC0, 0x02, 0xF0, 0x4E, 0x0B,
-    0xC0, 0x2F, 0x07, 0x3C, 0x0B, 0x81, 0xF0, 0x2D, 0xFF, 0xFF, 0x0B, 0xFF, 0xF3, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xC0, 0x0F, 0xEF, 0xCB, 0xC0, 0x2F, 0x02,
-    0xEB, 0x80, 0x3D, 0x00, 0xBF, 0x40, 0x7C, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x1F, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xBF, 0x00, 0x3F, 0x01,
-    0xEF, 0x40, 0x1F, 0xEF, 0xCF, 0xE8, 0x07, 0xFE, 0x07, 0xF8, 0x00, 0x50, 0x00, 0x40, 0x00, 0x15,
-    0x40, 0x00, 0x7F, 0xFC, 0x00, 0x7E, 0x6F, 0xC0, 0x3D, 0x02, 0xF4, 0x1F, 0x00, 0x3D, 0x0B, 0x80,
-    0x0F, 0x43, 0xE0, 0x03, 0xC0, 0xF8, 0x01, 0xF0, 0x3E, 0x00, 0xF0, 0x0F, 0x87, 0xFC, 0x03, 0xE1,
-    0xFF, 0xC0, 0xF8, 0x01, 0xFC, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0xBC, 0xF8,
-    0x00, 0x3F, 0x3E, 0x00, 0x0F, 0x8F, 0x80, 0x0F, 0xC3, 0xFE, 0xBF, 0xD0, 0xFB, 0xFF, 0x80, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x02, 0xEF, 0xF8, 0x00, 0xBC, 0x3F, 0x00, 0x3F,
-    0x03, 0xE0, 0x0F, 0x80, 0xBC, 0x03, 0xD0, 0x1F, 0x41, 0xF0, 0x03, 0xE0, 0xB8, 0x00, 0xBC, 0x3D,
-    0x00, 0x0F, 0x0F, 0x00, 0x03, 0xDB, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x15, 0x40, 0x00, 0x7F, 0xFF, 0x40, 0x7E, 0x6F, 0xF0, 0x3D, 0x00,
-    0x28, 0x0F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFB,
-    0xF4, 0x03, 0xD0, 0x7F, 0x03, 0xE0, 0x07, 0xF1, 0xF0, 0x00, 0xBD, 0xBC, 0x00, 0x0F, 0xBF, 0x00,
-    0x03, 0xEF, 0xC0, 0x00, 0xFA, 0xF0, 0x00, 0x3D, 0x7D, 0x00, 0x2F, 0x0F, 0xC0, 0x0F, 0x81, 0xFE,
-    0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x01, 0xFE,
-    0xBE, 0x0F, 0x40, 0x14, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xFA, 0x90, 0x03, 0xFF, 0x40, 0x3E,
-    0x40, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x05, 0x7F, 0xEB, 0xF0, 0x7F, 0xFF, 0x40,
-    0x05, 0x40, 0x00, 0x70, 0x00, 0x02, 0xE0, 0x06, 0xCB, 0xFF, 0xFF, 0x1F, 0xFA, 0xF4, 0x00, 0x1F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBD,
-    0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0xE8, 0x02, 0xFF, 0xFC, 0x00, 0x17, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x7F, 0xE0, 0xFF,
-    0x5F, 0xFF, 0x80, 0xBB, 0xC0, 0xFC, 0x03, 0xF4, 0x03, 0xD0, 0x3F, 0x00, 0x3D, 0x03, 0xE0, 0x03,
-    0xE0, 0x3D, 0x00, 0x3E, 0x03, 0xD0, 0x03, 0xE0, 0x3D, 0x00, 0x3E, 0x03, 0xD0, 0x03, 0xE0, 0x3D,
-    0x00, 0x3E, 0x03, 0xD0, 0x03, 0xE0, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x15,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFE, 0x7F, 0x80, 0x7C, 0x02, 0xF4, 0x3D, 0x00, 0x3E, 0x0F, 0x00,
-    0x0B, 0xC7, 0xC0, 0x01, 0xF2, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFB, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF0, 0xF4,
-    0x00, 0x7C, 0x3F, 0x00, 0x2E, 0x07, 0xD0, 0x1F, 0x00, 0xFF, 0xAF, 0x40, 0x0B, 0xFF, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D,
-    0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0xFF, 0xA1, 0xFF, 0x80, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x2F, 0x0F, 0x80, 0x3F, 0xC3, 0xE0, 0x3F, 0x40, 0xF8, 0x3F, 0x00, 0x3E, 0x2F,
-    0x00, 0x0F, 0x9F, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0xFF, 0x7C, 0x00, 0x3F, 0x4F, 0x40, 0x0F, 0x82,
-    0xF0, 0x03, 0xE0, 0x3E, 0x00, 0xF8, 0x0B, 0xFA, 0x7D, 0x00, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0x7E, 0x00, 0x00, 0x3C, 0xBC, 0x00, 0x01, 0xF1, 0xF0, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0x3C, 0x0B, 0x80, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0xBC,
-    0x00, 0xFC, 0x03, 0xF0, 0x02, 0xFF, 0xAF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0xBF, 0x80, 0x3F, 0xFB,
-    0xF3, 0xFA, 0x3D, 0xFF, 0xC2, 0xFD, 0x3C, 0x14, 0x00, 0x50, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x02, 0xEF, 0xF8, 0x00, 0xBC, 0x3F, 0x00, 0x3F, 0x03, 0xE0, 0x0F, 0x80, 0xBC,
-    0x03, 0xD0, 0x1F, 0x41, 0xF0, 0x03, 0xE0, 0xB8, 0x00, 0xBC, 0x3D, 0x00, 0x0F, 0x0F, 0x00, 0x03,
-    0xDB, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x02, 0xE0, 0x06, 0x8B, 0xFF, 0xFE, 0x1A, 0xAF, 0xD0, 0x02, 0xF4, 0x00, 0x2E, 0x00, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x94, 0x00, 0x1F, 0xF4, 0x03, 0xFE, 0x80,
-    0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFF, 0xE4, 0x00, 0xBF, 0xFC, 0x00, 0x17, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0xF0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xBF, 0xC0, 0xBC, 0x02,
-    0xF8, 0x3D, 0x00, 0x3F, 0x1F, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xF7, 0xF0, 0x00, 0x3E, 0xFC, 0x00,
-    0x0F, 0x6F, 0x00, 0x03, 0xC7, 0xD0, 0x02, 0xF0, 0xFC, 0x00, 0xF4, 0x1F, 0xE6, 0xF8, 0x01, 0xFF,
-    0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x39, 0x7D, 0x5B, 0x94, 0x30, 0x38, 0x0B, 0x40, 0x00, 0x78, 0x0B, 0x00, 0x00, 0x78, 0x0F,
-    0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xF4, 0x0F,
-    0x40, 0x01, 0xF0, 0x0F, 0xC0, 0x01, 0xF0, 0x0B, 0xFF, 0x02, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xBF, 0xC0, 0x7D, 0x01, 0xFC, 0x2F, 0x00,
-    0x2F, 0x0F, 0x80, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x3D, 0x3D, 0x00, 0x0F, 0x4F, 0x40,
-    0x07, 0xC3, 0xD0, 0x03, 0xE0, 0xF4, 0x02, 0xF0, 0x3F, 0xEB, 0xF4, 0x0F, 0xBF, 0xE0, 0x03, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0xBE, 0xBF, 0x47, 0xC0, 0x3F, 0x3D, 0x00, 0xB5,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xFE, 0x40, 0x1F, 0xFF, 0xC0, 0x01, 0xBF, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xE1, 0xF8, 0x0F, 0x44, 0x3E, 0x00, 0x7C, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x2F, 0x0F,
-    0xC0, 0x01, 0xF0, 0xFC, 0x00, 0x1F, 0x0B, 0xC0, 0x02, 0xF0, 0x7D, 0x00, 0x3F, 0x03, 0xF0, 0x07,
-    0xD0, 0x1F, 0xE6, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF5, 0xE5, 0xB9, 0x54, 0x70, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3F, 0xE9, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0xF0, 0x7F, 0xC0, 0x0B, 0xC0, 0x7C, 0x00, 0x7C, 0x07, 0xC0, 0x07, 0xD0, 0xBC,
-    0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xD0, 0xBC, 0x00, 0x3D, 0x0B, 0xC0, 0x03, 0xD0, 0xBC, 0x00, 0x7C,
-    0x07, 0xD0, 0x0B, 0xC0, 0x3E, 0x00, 0xF8, 0x01, 0xFD, 0xBF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x7F,
-    0xEF, 0xFF, 0xF0, 0x07, 0xE0, 0x3D, 0x0B, 0xF0, 0x3E, 0x00, 0xF4, 0x07, 0xE1, 0xF0, 0x03, 0xD0,
-    0x0F, 0xCB, 0xC0, 0x0F, 0x40, 0x2F, 0x3E, 0x00, 0x3D, 0x00, 0x7C, 0xBC, 0x00, 0xF4, 0x02, 0xF2,
-    0xF0, 0x03, 0xD0, 0x0F, 0xC7, 0xE0, 0x0F, 0x40, 0x3D, 0x0F, 0xE0, 0x3D, 0x07, 0xF0, 0x0F, 0xFA,
-    0xFA, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2E, 0x07, 0xFC, 0x01, 0xF4, 0x00,
-    0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x7C, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x1F,
-    0xB4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xB7, 0xE0, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x01, 0xF0, 0x2F, 0x00,
-    0x0F, 0x80, 0x3D, 0x00, 0xBC, 0x00, 0xBC, 0x07, 0xE0, 0x01, 0xFF, 0x1F, 0x00, 0x03, 0xE4, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xBF, 0x00, 0xBC, 0x07, 0x87, 0xFC, 0x02, 0xF0, 0x0F,
-    0x41, 0xF0, 0x0B, 0xC0, 0x3E, 0x07, 0xC0, 0x2F, 0x00, 0xFC, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0xC0, 0x2F, 0x0B, 0xC0, 0x2F, 0x00, 0xFC, 0x1F, 0x40, 0xBC,
-    0x03, 0xD0, 0x3E, 0x02, 0xF0, 0x2F, 0x00, 0xBE, 0x0B, 0xC2, 0xF4, 0x00, 0xFF, 0xBF, 0xBF, 0x40,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0x02, 0xF0, 0x3D, 0x00, 0x50, 0x0F, 0x87, 0xC0, 0x2F, 0x00, 0xFC, 0xBC, 0x02, 0xF0, 0x0B,
-    0xCB, 0xC0, 0x2F, 0x00, 0xBC, 0xBC, 0x01, 0xF0, 0x07, 0xCB, 0xC0, 0x1F, 0x00, 0xBC, 0x7D, 0x02,
-    0xF0, 0x0B, 0x83, 0xE0, 0x3F, 0x80, 0xF4, 0x2F, 0xAF, 0x7E, 0x7F, 0x00, 0xBF, 0xE0, 0xFF, 0xC0,
-    0x00, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D,
-    0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00,
-    0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA,
-    0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA, 0xBE,
-    0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF,
-    0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0xAF,
-    0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0x43, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00,
-    0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95,
-    0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4,
-    0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x64, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB4, 0xB8, 0x00, 0x1C, 0x1E,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFA, 0xBE, 0x00, 0xF4, 0x0F, 0xC0, 0x3C, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xEA, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0,
-    0x1F, 0x02, 0xF0, 0x0F, 0xC0, 0x7F, 0xAF, 0xFF, 0x8B, 0xFE, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x04,
-    0x3C, 0x00, 0x00, 0x02, 0xFC, 0x40, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00,
-    0x00, 0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D,
-    0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00,
-    0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA,
-    0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x2E, 0x2F, 0x00, 0x2E, 0x02, 0xD0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F,
-    0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x38, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x06,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00,
-    0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0,
-    0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC,
-    0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F,
-    0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x06, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x2E, 0x2F, 0x00, 0x2E, 0x02, 0xD0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00,
-    0x2F, 0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0,
-    0x01, 0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC,
-    0x07, 0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xF8, 0x30, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x06, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F,
-    0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00,
-    0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x01, 0xBD, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x34,
-    0xB4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x2A, 0x08, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x2F,
-    0x00, 0x2F, 0x02, 0xD0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x81, 0x40, 0x00, 0x00, 0xBF,
-    0xDE, 0x00, 0x00, 0x01, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00,
-    0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B,
-    0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x30, 0x01, 0xFF, 0xAC, 0x00, 0x70,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0x2F, 0x40, 0x2F,
-    0x01, 0xE0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F,
-    0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02,
-    0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8,
-    0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00,
-    0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F,
-    0x00, 0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF,
-    0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02,
-    0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0xF4, 0x00,
-    0x2E, 0x1F, 0x00, 0x1E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00,
-    0x2F, 0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0,
-    0x01, 0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC,
-    0x07, 0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x05, 0x2C, 0x10, 0x00, 0x00, 0x3C,
-    0x02, 0xC0, 0x00, 0x00, 0xBF, 0xBD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0xFC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0x0B, 0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F,
-    0x40, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00,
-    0xBF, 0xE3, 0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x30, 0x00, 0x07, 0x00, 0x20, 0x01, 0xF4, 0x2C, 0x00, 0x3F, 0xFE,
-    0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB,
-    0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF,
-    0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA,
-    0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x05, 0x1D, 0x10, 0x00, 0x00, 0x3C, 0x02, 0xC0,
-    0x00, 0x00, 0xBF, 0xBD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00,
-    0x00, 0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B,
-    0x95, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01,
-    0xF4, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x40, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x18, 0x00, 0x07, 0x00, 0x20, 0x01, 0xF4, 0x2C, 0x00, 0x3F, 0xFE, 0x00, 0x01,
-    0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F,
-    0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02,
-    0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8,
-    0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0xB8, 0x00,
-    0x00, 0x00, 0x11, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0xA0, 0x80, 0x00, 0x00,
-    0xB8, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00, 0x07,
-    0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95, 0x6F,
-    0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00,
-    0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x38, 0xB4, 0x00, 0x04, 0x2D, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x08, 0x00, 0x7D, 0x0B, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x0B, 0xEA, 0xF8,
-    0x03, 0xD0, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x6F, 0xFF,
-    0x00, 0xBF, 0xAB, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x3F, 0x01, 0xFE, 0xBF,
-    0xFE, 0x2F, 0xF8, 0xBF, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x80, 0x00, 0x00, 0x7F, 0xDB,
-    0x00, 0x00, 0x00, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xD0, 0x00,
-    0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0x00, 0x00,
-    0x07, 0x81, 0xF0, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0x95,
-    0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFA, 0xAA, 0xFC, 0x00, 0x0F, 0x40, 0x01, 0xF4,
-    0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0xE3, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x60, 0x01, 0xFF, 0x6C, 0x00, 0x71, 0xFE,
-    0x00, 0x00, 0x09, 0x00, 0x06, 0x00, 0x20, 0x03, 0xE0, 0x3C, 0x00, 0x7F, 0xFD, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xAB, 0xE0, 0x0F, 0x40,
-    0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01, 0xBF, 0xFC, 0x02, 0xFE,
-    0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07, 0xFA, 0xFF, 0xF8, 0xBF,
-    0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00,
-    0x03, 0xF9, 0xB8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0x02, 0xD3, 0xD0, 0x00, 0x00,
-    0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x00, 0xB9, 0x56, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xAA, 0xAF, 0xC0,
-    0x00, 0xF4, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x02, 0xFE,
-    0x00, 0x0B, 0xFE, 0x3F, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x30, 0x01, 0xF4, 0x2C, 0x00, 0x3F,
-    0xFE, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F,
-    0xAB, 0xE0, 0x0F, 0x40, 0xFC, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x01,
-    0xBF, 0xFC, 0x02, 0xFE, 0xAF, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x01, 0xF0, 0x2F, 0x00, 0xFC, 0x07,
-    0xFA, 0xFF, 0xF8, 0xBF, 0xE2, 0xFC, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC,
-    0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80, 0x3E, 0x7C, 0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF8, 0x00,
-    0x0B, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xF6, 0xF0, 0x00,
-    0x1D, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B,
-    0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE,
-    0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x69, 0x00, 0x0B, 0xFE, 0x00, 0x3C, 0x3C, 0x00, 0xD0, 0xF0, 0x00, 0x0B, 0x80, 0x01, 0xF4,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0xBF, 0x0F, 0x80,
-    0x3E, 0x7C, 0x00, 0xBE, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF4, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x01, 0x50, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x2F, 0xD3, 0xC0, 0x03, 0xEF, 0xFC, 0x00, 0x38, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0,
-    0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0x80, 0xFF, 0xEF, 0x03, 0x87, 0xF8, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7,
-    0xC0, 0x0B, 0xEE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00,
-    0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x10, 0xF0, 0x00, 0x2F, 0xC4, 0x00,
-    0x07, 0xEF, 0x00, 0x01, 0xF0, 0xB8, 0x00, 0x18, 0x01, 0x40, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC,
-    0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0xF8, 0x00,
-    0x1F, 0x5F, 0x40, 0x0F, 0x40, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x0F, 0xEB, 0xF0, 0x0F, 0x80, 0x3E, 0x07, 0xC0, 0x0B, 0xC2, 0xE0, 0x01, 0xF0, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFE, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x10, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xEF, 0x00,
-    0x01, 0xF0, 0xB8, 0x00, 0x18, 0x01, 0x40, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA,
-    0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB0, 0x02, 0xF4, 0x40, 0x1F, 0xF4, 0x00, 0xF5, 0xF4, 0x0F, 0x40, 0xF0, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0B, 0xEE,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xDF, 0x00, 0x00, 0x10, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x83, 0x00, 0x07, 0xEF, 0x00,
-    0x01, 0xF0, 0xB8, 0x00, 0x28, 0x01, 0x40, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA,
-    0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBA, 0xF0, 0x00, 0x1C, 0x3C,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x1B, 0x45, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x4F, 0x80,
-    0x0F, 0x40, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xEB, 0xF0,
-    0x0F, 0x80, 0x3E, 0x07, 0xC0, 0x0B, 0xC2, 0xE0, 0x01, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE,
-    0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0xF8, 0x14, 0x00, 0x2F, 0xF7, 0x80, 0x01,
-    0x87, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF0, 0xB8,
-    0x00, 0x28, 0x01, 0x40, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC,
-    0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0, 0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x82, 0x40, 0xFF, 0xDE, 0x03, 0x4B, 0xF0, 0x00, 0x05,
-    0x00, 0x00, 0xA4, 0x00, 0x0F, 0xF8, 0x00, 0xF4, 0xFC, 0x0F, 0x40, 0xF0, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0B, 0xEE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x7E, 0xF0, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xEA, 0xAB, 0xC0, 0xBC, 0x00, 0x2C, 0x0B, 0xC0, 0x01, 0xC0, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xEA, 0xFE, 0x00, 0xBF, 0xFF, 0xE0,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0A, 0x0B, 0xC0,
-    0x00, 0xF0, 0xBC, 0x00, 0x1E, 0x2F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xBC, 0x00, 0xF0, 0xF4, 0x0F, 0x40, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xEB, 0xF0, 0xF8, 0x03, 0xE7, 0xC0, 0x0B, 0xEE,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x7D, 0xBC, 0x70,
-    0x3C, 0x00, 0xB8, 0x07, 0xD0, 0x07, 0x00, 0x01, 0x00, 0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD, 0x06, 0x90, 0x2F,
-    0xFC, 0x3C, 0x3D, 0x24, 0x3C, 0x00, 0xB8, 0x03, 0xD0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F, 0xFE, 0x55, 0x54, 0xFF, 0xFD, 0x1F, 0xD0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x2F, 0xF8, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x0F, 0xD0, 0x0F, 0xD0, 0x02, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03,
-    0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x0B, 0xF9, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x07, 0xF0, 0x07, 0xE0, 0x01, 0x40, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F,
-    0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00,
-    0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F,
-    0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00, 0x03, 0xEF, 0x80, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0xF0, 0xFC, 0x00, 0xF8,
-    0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
-    0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB,
-    0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00,
-    0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x2D, 0x2E, 0x00, 0x07, 0x07,
-    0x80, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xBF, 0xD0, 0xBC, 0x01, 0xFC, 0x7C, 0x00, 0x2F, 0x6F, 0x00,
-    0x03, 0xEF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0xF0, 0xFC, 0x00, 0xF8, 0x2F, 0xE6, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0x0E,
-    0x00, 0x00, 0x03, 0xF8, 0x40, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x00, 0x02,
-    0x80, 0x20, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC,
-    0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00,
-    0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC,
-    0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00,
-    0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x0B, 0xCB, 0xC0, 0x0B, 0x80, 0xB4, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F,
-    0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0x1D, 0x00, 0x00, 0x03, 0xF8,
-    0x40, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B,
-    0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0,
-    0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B,
-    0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80,
-    0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0x8B, 0xC0, 0x0B,
-    0x80, 0xB4, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B,
-    0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0,
-    0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x39, 0xE0,
-    0x00, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF8, 0x70, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x40, 0x00, 0x02, 0x40, 0x20, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00,
-    0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0xD2, 0xD0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x1E, 0x00, 0x02, 0xB0, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x0B, 0xC0, 0xB8,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFB, 0xFD, 0x02, 0xF0,
-    0x07, 0xF0, 0x7C, 0x00, 0x2F, 0x4B, 0xC0, 0x00, 0xF8, 0xF8, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0xFC,
-    0xF8, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0xF8, 0xBD, 0x00, 0x0F, 0x03, 0xF0, 0x03, 0xE0, 0x2F, 0xE6,
-    0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0x82, 0x00, 0x00, 0x03, 0xFE,
-    0x74, 0x00, 0x00, 0x24, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x40, 0x00, 0x02, 0x40, 0x20, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x2F,
-    0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00,
-    0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x0B, 0xCB, 0xD0,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F, 0x80, 0x00, 0x3F,
-    0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0C, 0x00, 0x7F, 0xEB, 0x00, 0x1C, 0x3F, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x06, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xCB, 0xD0, 0x0B, 0xC0, 0x78,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F,
-    0xC7, 0xC0, 0x02, 0xF6, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xFB, 0xF0, 0x00, 0x3E, 0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF,
-    0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x00, 0x38, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xFC, 0x00, 0xFD, 0x00,
-    0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01, 0xFC, 0x7D, 0x00, 0x00, 0x0F, 0xCB,
-    0xC0, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00,
-    0x0B, 0xCB, 0xD0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x02, 0xF4, 0x3F,
-    0x80, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xBD, 0x00, 0x0B, 0x87, 0xC0, 0x07, 0xC0, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFB, 0xFD, 0x0B, 0xC0, 0x1F, 0xC7, 0xC0, 0x02, 0xF6,
-    0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFB, 0xF0, 0x00, 0x3E,
-    0xBD, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x82, 0xFE, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x14, 0x00, 0x02, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x6A,
-    0x90, 0x1F, 0x00, 0x2F, 0xFF, 0xF9, 0xF4, 0x03, 0xF9, 0x1B, 0xFF, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x02, 0xF4, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00, 0x0F, 0xC2, 0xF0,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00,
-    0x0B, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xD0,
-    0x3F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB0, 0x06, 0x40, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xFF, 0xE7, 0xD0, 0x3F, 0xEF, 0xFD, 0x02, 0xF0, 0x07,
-    0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC,
-    0x3E, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x3C, 0x03, 0xF0, 0x03, 0xE0, 0x0B,
-    0xF9, 0xBF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x14, 0x00, 0x00,
-    0x18, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x6A, 0x90, 0x1F, 0x00, 0x2F, 0xFF, 0xF9,
-    0xF4, 0x03, 0xF9, 0x1B, 0xFF, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x02, 0xF4, 0x00, 0x03, 0xF4, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC2, 0xF4, 0x00, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x3F,
-    0x80, 0x07, 0xF0, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x28, 0x06, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x01, 0xFF, 0xE7, 0xD0, 0x3F, 0xEF, 0xFD, 0x02, 0xF0, 0x07, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0xBC,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xFC, 0x3E, 0x00, 0x03, 0xE0, 0xFC, 0x00,
-    0x0F, 0x82, 0xF4, 0x00, 0x3C, 0x03, 0xF0, 0x03, 0xE0, 0x0B, 0xF9, 0xBF, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01,
-    0xF6, 0xF0, 0x00, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x01, 0x40, 0x00, 0x1C, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x06, 0xA9, 0x01, 0xF0,
-    0x02, 0xFF, 0xFF, 0x9F, 0x40, 0x3F, 0x91, 0xBF, 0xF0, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x2F, 0x40,
-    0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x7F, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x03,
-    0xF0, 0xBC, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0x00,
-    0x03, 0xF0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x07, 0xFE, 0xAF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2D, 0x2E,
-    0x00, 0x00, 0x70, 0x78, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xC0, 0x19,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xFF, 0x9F, 0x40, 0xFF, 0xBF, 0xF4, 0x0B,
-    0xC0, 0x1F, 0xC0, 0x7C, 0x00, 0x2F, 0x42, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xFC, 0x3E, 0x00,
-    0x03, 0xF0, 0xF8, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0xF0, 0x0F, 0xC0, 0x0F,
-    0x80, 0x2F, 0xE6, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x05, 0x01,
-    0x00, 0x00, 0x00, 0xFF, 0x0E, 0x00, 0x00, 0x03, 0xEF, 0xF8, 0x00, 0x00, 0x0D, 0x1F, 0xC0, 0x14,
-    0x00, 0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x6A, 0x90, 0x1F, 0x00, 0x2F,
-    0xFF, 0xF9, 0xF4, 0x03, 0xF9, 0x1B, 0xFF, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x02, 0xF4, 0x00, 0x03,
-    0xF4, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC2, 0xF4, 0x00,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x3F, 0x80, 0x00, 0x3F,
-    0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x7F, 0xEA, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xC0, 0x00, 0x7F, 0xEF, 0x40, 0x01,
-    0xC3, 0xFC, 0x00, 0x01, 0x01, 0x81, 0x90, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x7F,
-    0xF9, 0xF4, 0x0F, 0xFB, 0xFF, 0x40, 0xBC, 0x01, 0xFC, 0x07, 0xC0, 0x02, 0xF4, 0x2F, 0x00, 0x03,
-    0xE0, 0xF8, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xF8, 0x3F, 0x00, 0x03, 0xE0,
-    0xBD, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xFE, 0x6F, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x01, 0xAA, 0x40, 0x7C, 0x00, 0xBF, 0xFF, 0xE7, 0xD0, 0x0F, 0xE4, 0x6F, 0xFC, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x1F, 0xC1, 0xF4, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x0B,
-    0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x00, 0x2F, 0x40, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xAB,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x7F, 0xF9, 0xF4, 0x0F, 0xFB, 0xFF, 0x40, 0xBC, 0x01, 0xFC, 0x07, 0xC0, 0x02, 0xF4, 0x2F, 0x00,
-    0x03, 0xE0, 0xF8, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0xF8, 0x3F, 0x00, 0x03,
-    0xE0, 0xBD, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xFE, 0x6F, 0xC0, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x15, 0x54, 0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF,
-    0xE1, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F,
-    0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F,
-    0x00, 0x1F, 0x80, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A,
-    0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02,
-    0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9,
-    0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x00, 0x01, 0xD0, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x15, 0x54, 0x00, 0x15, 0x55, 0xFF, 0xF4, 0x03, 0xFF, 0xE1, 0xBE, 0x00,
-    0x01, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0x2E,
-    0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x0F,
-    0x40, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0x80,
-    0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x00, 0xC0, 0xF0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0A, 0xF8, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x1F, 0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x90, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x15,
-    0x54, 0x00, 0x15, 0xBD, 0x7F, 0xFD, 0x00, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x03, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00,
-    0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x01, 0xC0, 0x06, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x2F, 0xC0, 0x2B, 0xFC, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F,
-    0xFB, 0xFF, 0xE4, 0x00, 0xFF, 0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x14,
-    0x00, 0x00, 0x06, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x15, 0x54, 0x00, 0x15, 0xBD, 0x7F,
-    0xFD, 0x00, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xE0, 0x00, 0x0F, 0x40,
-    0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x70, 0x06, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0xC0, 0x2B, 0xFC, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0,
-    0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03,
-    0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0xFD, 0x00, 0x0F, 0xFB, 0xFF, 0xE4, 0x00, 0xFF,
-    0xE2, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0x07, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x14, 0x00, 0x00, 0x34, 0x00, 0x3E, 0x00, 0x00, 0x10, 0x00, 0x3E, 0x15,
-    0x54, 0x00, 0x15, 0xBD, 0x7F, 0xFD, 0x00, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x03, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00,
-    0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x00, 0xC0, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x01, 0x90, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x2F, 0x0B, 0xF0, 0x0A, 0xFF, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x1F,
-    0x40, 0x3F, 0x40, 0x03, 0xFE, 0xFF, 0xF9, 0x00, 0x3F, 0xF8, 0xBF, 0xC0, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xF0, 0x00, 0x00, 0x0F, 0xBF, 0xF0, 0x00, 0x00,
-    0x0E, 0x1F, 0xD0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x15, 0x54,
-    0x00, 0x15, 0xBD, 0x7F, 0xFD, 0x00, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03,
-    0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFF,
-    0xEF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x83, 0x40, 0x00, 0x0F, 0xFA, 0xE0, 0x00, 0x03, 0x4B, 0xF4, 0x00, 0x00, 0x40,
-    0x64, 0x19, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0xBF, 0x00, 0xAF, 0xF0, 0xBF,
-    0xC0, 0x3F, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF, 0x90, 0x03, 0xFF,
-    0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x15, 0x54, 0x00, 0x15, 0xBD, 0x7F, 0xFD, 0x00, 0xFF, 0xF4,
-    0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03,
-    0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x1F,
-    0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0xBF, 0x00, 0xAF, 0xF0, 0xBF,
-    0xC0, 0x3F, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x40,
-    0x0B, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F,
-    0x40, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF4, 0x03, 0xF4, 0x00, 0x3F, 0xEF, 0xFF, 0x90, 0x03, 0xFF,
-    0x8B, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE, 0x1F, 0xE0,
-    0x00, 0xBD, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00,
-    0x7D, 0x0B, 0x80, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03,
-    0xD0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C,
-    0x78, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x5B, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x54, 0x01, 0x55, 0x6F, 0xFF, 0x81, 0xFF,
-    0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0xF4, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1B, 0xFE, 0x40,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0xF8,
-    0x2F, 0xF8, 0xFF, 0x90, 0x6F, 0xD0, 0xF8, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0x0F,
-    0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x7C, 0x78, 0x00,
-    0x00, 0xF7, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x41, 0xE0, 0x5B, 0xF8, 0x0F, 0xD2, 0xFF, 0xC0,
-    0x3F, 0x07, 0xE4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xE7, 0xE0, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x01, 0x55, 0x6F, 0xFF, 0x81, 0xFF,
-    0xE1, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0xF4, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1B, 0xFE, 0x40,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0x0F, 0x40,
-    0x00, 0x28, 0x2D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xBF, 0xE3, 0xFE, 0x41, 0xBF, 0x43, 0xE0,
-    0x00, 0xF4, 0x0B, 0xC0, 0x07, 0xC0, 0x0F, 0x40, 0x3D, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x7C, 0x0B,
-    0x80, 0x00, 0xF8, 0x3C, 0x00, 0x01, 0xF1, 0xE0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0x01, 0x6F, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x0F, 0xE1, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xC2, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x40, 0x15, 0x56, 0xFF, 0xF8, 0x1F, 0xFE,
-    0x1F, 0xE0, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0x0F,
-    0x40, 0x00, 0x7D, 0x0B, 0x80, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x70, 0x00, 0x2F, 0xFB, 0xC0, 0x00,
-    0xB0, 0xFF, 0x00, 0x00, 0x40, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x0B, 0xFE, 0x3F, 0xE4, 0x1B, 0xF4, 0x3E, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x00, 0xF4, 0x03,
-    0xD0, 0x02, 0xF0, 0x0F, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x1F, 0x1E, 0x00,
-    0x00, 0x3D, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x16, 0xFE, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x00, 0x00, 0x03, 0x0C, 0x2F, 0x80, 0xF0, 0x3F, 0xC1, 0x94, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
-    0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x38, 0x55, 0x5E, 0xEA, 0xAF, 0xC0, 0x1C,
-    0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0xB5, 0x55, 0xFA, 0xAB, 0x34, 0x03,
-    0x0A, 0x03, 0x02, 0x43, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x01, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8, 0x55, 0x54, 0xFF, 0xFD, 0xAA, 0xA8,
-    0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5,
-    0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x14, 0x05, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C,
-    0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x7C, 0x1F, 0x68, 0x0A, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0x03, 0xC3, 0xC0, 0xF0, 0xB8, 0x3F, 0x0B, 0xD0, 0xF4, 0x05, 0x0B, 0xD0, 0xF8, 0x3E,
-    0x0F, 0x43, 0xC2, 0xD0, 0xE0, 0x00, 0x07, 0xC1, 0xF8, 0x3E, 0x0F, 0x83, 0xC1, 0xE0, 0xF0, 0x10,
-    0x00, 0x14, 0x1F, 0x4F, 0xC2, 0xE0, 0x7C, 0x0F, 0x01, 0xD0, 0x2C, 0x01, 0x00, 0x40, 0xF0, 0x3C,
-    0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0xB8, 0x2E, 0x0F, 0xC3, 0xF0, 0xBD, 0x2F, 0x43, 0xD0, 0xF4, 0x05,
-    0x01, 0x42, 0xF4, 0xBD, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x43, 0xD0, 0xF0, 0x3C, 0x2D, 0x0B,
-    0x43, 0x80, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x1F, 0x87, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
-    0xF0, 0x3C, 0x1E, 0x07, 0x83, 0xC0, 0xF0, 0x10, 0x04, 0x00, 0x14, 0x05, 0x07, 0xD1, 0xF4, 0xFC,
-    0x3F, 0x0B, 0x82, 0xE0, 0x7C, 0x1F, 0x03, 0xC0, 0xF0, 0x1D, 0x07, 0x40, 0xB0, 0x2C, 0x00, 0x29,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xBE, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x10, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x3F, 0xBE, 0xFE, 0x3F, 0xFF, 0xFE, 0x10, 0x3C, 0x04, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x25, 0x3D, 0x19, 0x3F, 0xFF, 0xFE, 0x3E, 0x7D, 0x6D, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x4B, 0xFC,
-    0xFF, 0xDB, 0xFC, 0x3F, 0x40, 0x00, 0x24, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0x41, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xDF, 0xFF, 0x87, 0xFE, 0x01, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x2E, 0x1F, 0xC3, 0xF0, 0x10,
-    0x00, 0x00, 0x00, 0xF4, 0x0B, 0x8B, 0xF0, 0x7F, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x07, 0xCB, 0xF0, 0x03, 0xF0, 0x03, 0xF9, 0xF8, 0x00,
-    0xFC, 0x00, 0xBD, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x19, 0x0F, 0xC7, 0xF0, 0xB4, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x38, 0x40, 0x5E, 0xD0, 0xAF, 0xC0, 0x1C, 0xC0, 0xA0, 0xC1, 0x80, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,
-    0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x1C, 0x00, 0xB5, 0x01, 0xFA, 0x07, 0x34, 0x03, 0x0A, 0x03, 0x02, 0x43, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00,
-    0x02, 0x80, 0x0B, 0xE0, 0x29, 0xA8, 0x61, 0x89, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-    0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x01, 0x04,
-    0x00, 0x0A, 0x34, 0x00, 0x0A, 0x38, 0x15, 0x5E, 0x28, 0xEA, 0xBC, 0x73, 0x01, 0xC7, 0x0C, 0x1C,
-    0x70, 0x30, 0x86, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0,
-    0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x1C, 0xA0, 0x02, 0xCA, 0x00, 0x2C, 0xB5, 0x54, 0xD3, 0xEA, 0xB0, 0xD3, 0x40,
-    0xC0, 0xA3, 0x43, 0x00, 0x92, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00,
-    0x00, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC0, 0x00, 0x03, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x5F, 0x40, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x03, 0xC0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x03, 0xC2, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0x83, 0x82, 0xFF, 0x00,
-    0x2F, 0xF4, 0x2F, 0x5F, 0x0B, 0x0F, 0x9B, 0xC0, 0xB9, 0xBC, 0x0F, 0xFC, 0x1D, 0x1E, 0x03, 0xD0,
-    0xF0, 0x2E, 0x00, 0x40, 0x3C, 0x2D, 0x01, 0xE1, 0xE0, 0x1F, 0x00, 0x00, 0xB0, 0x3D, 0x01, 0xE2,
-    0xD0, 0x0F, 0x00, 0x00, 0xE0, 0x3C, 0x01, 0xE2, 0xD0, 0x0F, 0x00, 0x02, 0xC0, 0x3D, 0x02, 0xE2,
-    0xE0, 0x1E, 0x00, 0x07, 0x80, 0x2E, 0x03, 0xC1, 0xF0, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0x9B, 0x80,
-    0xF9, 0xBC, 0x00, 0x2D, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x2C, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF8, 0x7C, 0x3E,
-    0x1F, 0x0B, 0x43, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x2D, 0x0F, 0x83, 0xD1, 0xF0, 0xBC,
-    0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0xB4, 0x3D, 0x0E, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x0B, 0x43, 0xC0, 0xF8, 0x3D, 0x1F, 0x47, 0xC2, 0xF0, 0xBC, 0x3E, 0x0F, 0x83, 0xD1,
-    0xF0, 0x7C, 0x2F, 0x0B, 0x43, 0xD0, 0xF0, 0x38, 0x0E, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x3E, 0x02, 0xF0, 0x0F, 0x40, 0xBC, 0x03, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x1E, 0x03, 0xE0, 0xBC, 0x0B, 0xC0, 0xF4, 0x0F, 0x42, 0xF0, 0x2F, 0x03, 0xD0, 0x3D, 0x07,
-    0xC0, 0x34, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x03, 0xE0,
-    0xBC, 0x0F, 0x40, 0xBC, 0x0F, 0x43, 0xF0, 0x0F, 0x42, 0xF0, 0x3D, 0x02, 0xF0, 0x3D, 0x0B, 0xC0,
-    0x3D, 0x07, 0xC0, 0xF0, 0x03, 0x40, 0xB0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x07, 0xE0, 0x00, 0x7D, 0xE0, 0x07, 0xC1, 0xE0, 0x7C, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x07, 0xC0, 0x7C, 0x0B, 0xD0, 0x3E, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0xB8, 0x00, 0x78, 0x00, 0x00,
-    0x70, 0x00, 0xF4, 0x00, 0xF4, 0x01, 0xF8, 0x02, 0xF0, 0x0F, 0xC0, 0xF8, 0x0F, 0x80, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0C, 0x38, 0x02, 0x40, 0x38, 0x0E, 0x07,
-    0xC0, 0xE0, 0x03, 0x42, 0x43, 0x80, 0x01, 0xD0, 0x0F, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x1D,
-    0xB0, 0x00, 0x1F, 0x07, 0xC0, 0xF0, 0x1F, 0x0B, 0xC0, 0xF0, 0x00, 0x1C, 0xB0, 0x00, 0x00, 0x74,
-    0x2C, 0x00, 0x01, 0xD0, 0x0B, 0x00, 0x03, 0x43, 0x83, 0xC0, 0x0D, 0x07, 0xC0, 0xE0, 0x38, 0x02,
-    0x40, 0x38, 0xA0, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xA2, 0xF0, 0x0F, 0xCF,
-    0xC0, 0x3E, 0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xD3, 0xE0, 0x0F, 0x4F, 0x40, 0x3D, 0x3D, 0x00, 0xF0,
-    0xF4, 0x03, 0xC3, 0xD0, 0x0F, 0x0B, 0x40, 0x3C, 0x2D, 0x00, 0xF0, 0x74, 0x02, 0xC1, 0xD0, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xE3, 0xF4, 0x0F, 0xCF, 0xC0, 0x3F, 0x04, 0x00,
-    0x10, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x50, 0x55, 0x4F, 0xFD, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x3F,
-    0xFD, 0x02, 0xFF, 0xE0, 0x3A, 0xBF, 0x41, 0xE6, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x03,
-    0xC0, 0x00, 0x1E, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x1F, 0xC0,
-    0x01, 0xBE, 0x07, 0xFF, 0x80, 0x2F, 0xFC, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x0F, 0x90, 0x00, 0x7D,
-    0x00, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1E, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x07, 0xF8, 0x00,
-    0x0F, 0xC3, 0xFF, 0xD0, 0x03, 0xE0, 0xEA, 0xFD, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0x1D, 0x03, 0xD0, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x1F, 0xC0, 0x3D, 0x01,
-    0xFF, 0xE0, 0x0F, 0x40, 0xFF, 0xD0, 0x03, 0xD0, 0x3E, 0x40, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x2D,
-    0x01, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x1E, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x7D, 0x00, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x10, 0x28, 0x00,
-    0x00, 0x00, 0xBC, 0x02, 0xFE, 0x00, 0xFC, 0x03, 0xFF, 0xC0, 0xF8, 0x03, 0xAB, 0xF0, 0xF8, 0x00,
-    0x00, 0xB8, 0xF8, 0x00, 0x00, 0x3C, 0xF4, 0x00, 0x00, 0x2C, 0xF4, 0x00, 0x00, 0x3C, 0xF4, 0x00,
-    0x01, 0xFC, 0xF4, 0x00, 0xBF, 0xF4, 0xB4, 0x00, 0xFF, 0xD0, 0xB4, 0x00, 0xF8, 0x00, 0x74, 0x00,
-    0xF0, 0x00, 0x74, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x38, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x01, 0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x42, 0xD0, 0xF0, 0x3C, 0x0F, 0x83, 0xD1, 0xF4, 0x7C,
-    0x1F, 0x0B, 0xC2, 0xF0, 0xFC, 0x3E, 0x0F, 0x83, 0xD1, 0xF4, 0x7C, 0x1F, 0x0B, 0xC2, 0xE0, 0xB4,
-    0x3D, 0x0F, 0x03, 0xC0, 0xE0, 0x38, 0x0D, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x1F, 0xFF, 0x00, 0xF8, 0x7E, 0x0B, 0x80, 0x7C, 0x3D, 0x00, 0xF0, 0xF0, 0x03, 0xD3, 0xC0,
-    0x0F, 0x4F, 0x00, 0x3C, 0x3D, 0x01, 0xF0, 0xBC, 0x0F, 0x80, 0xFE, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x01, 0xEB, 0x40,
-    0x0F, 0x2D, 0x00, 0xF0, 0xB4, 0x0B, 0x96, 0xD4, 0x3F, 0xFF, 0xF0, 0x15, 0x7E, 0x40, 0x00, 0xB4,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x03, 0xFF, 0xC0, 0xF5, 0x50, 0x38, 0x00, 0x0F,
-    0x90, 0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0x82, 0xBF, 0xC0, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3F, 0xD0, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x50, 0x0F,
-    0xFF, 0x87, 0xC1, 0xF5, 0xE0, 0x1F, 0x7C, 0x07, 0xCF, 0x42, 0xE2, 0xFF, 0xF0, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0xBF, 0xFF, 0xF5, 0x6F, 0xE0, 0x3C, 0x00, 0xB4, 0x01, 0xF0, 0x03, 0xC0,
-    0x07, 0xC0, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x94, 0x03, 0xFF,
-    0x82, 0xD0, 0xF0, 0xF0, 0x2D, 0x2E, 0x1F, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0xF4, 0x7D, 0x78, 0x07,
-    0x9E, 0x02, 0xE3, 0xE6, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x03, 0xFF, 0x43, 0xD1,
-    0xF1, 0xF0, 0x2E, 0x7C, 0x07, 0xCF, 0x41, 0xE1, 0xFF, 0xF8, 0x1F, 0xFD, 0x00, 0x1F, 0x00, 0x1F,
-    0x41, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x03, 0xFB, 0xFC, 0x06, 0xF4, 0xB8,
-    0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x0B, 0x81, 0xF4, 0xBF, 0x4F,
-    0xF0, 0x01, 0xFE, 0x00, 0x2F, 0xFF, 0x41, 0xF0, 0x2F, 0x0B, 0x40, 0x3C, 0x3C, 0x00, 0xF0, 0xF0,
-    0x03, 0xD3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3D, 0x01, 0xF0, 0x7D, 0x1F, 0x40, 0xBF, 0xF4, 0x00,
-    0x69, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xBF, 0xC0, 0x6B, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xD0, 0x7F, 0xFC, 0x15, 0x50, 0x06, 0xF8, 0x0B, 0xEF,
-    0xC3, 0xC0, 0xF4, 0xE0, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x40,
-    0x0F, 0xEA, 0xA3, 0xFF, 0xFC, 0x15, 0x50, 0x0B, 0xF8, 0x0F, 0xEF, 0x83, 0x40, 0xF0, 0x00, 0x78,
-    0x00, 0xBC, 0x02, 0xFF, 0x00, 0x56, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x1F, 0x83, 0xFF, 0x80,
-    0x69, 0x00, 0x00, 0x0B, 0x40, 0x00, 0xBD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xDB, 0x40,
-    0x2D, 0x2D, 0x01, 0xE0, 0xB4, 0x0F, 0xAB, 0xF8, 0x2F, 0xFF, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0xB4,
-    0x00, 0x01, 0x80, 0x0A, 0xAA, 0x03, 0xFF, 0xC0, 0xF0, 0x00, 0x38, 0x00, 0x0F, 0xF4, 0x02, 0xBF,
-    0x40, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x2F, 0x47, 0xFF, 0x40, 0x69, 0x00, 0x00, 0x6F,
-    0x40, 0xBE, 0x40, 0xBC, 0x00, 0xBC, 0x00, 0x3F, 0xF8, 0x1F, 0xFF, 0xC7, 0x80, 0xF9, 0xE0, 0x1F,
-    0x7C, 0x07, 0xCF, 0x83, 0xD1, 0xFF, 0xE0, 0x06, 0x90, 0x6A, 0xAA, 0xFF, 0xFF, 0xE0, 0x2D, 0x90,
-    0x7C, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x09,
-    0x00, 0x07, 0xF8, 0x07, 0xEB, 0xC3, 0xC0, 0xB4, 0xF0, 0x3C, 0x1F, 0x6E, 0x02, 0xFF, 0x01, 0xF7,
-    0xF0, 0xF0, 0x3E, 0x78, 0x07, 0x9F, 0x03, 0xD2, 0xFF, 0xE0, 0x1A, 0x40, 0x07, 0xF8, 0x0B, 0xEF,
-    0xC3, 0xC0, 0xF5, 0xF0, 0x1E, 0x7C, 0x07, 0xCF, 0x92, 0xE0, 0xFF, 0xF8, 0x06, 0xBC, 0x00, 0x2E,
-    0x00, 0x7F, 0x02, 0xFE, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x40, 0x0E, 0x03, 0xD0, 0x03, 0x80, 0xF4, 0x00, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x6B, 0xFA,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x1B, 0xFA, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xAF, 0xC0, 0x03, 0xD0, 0x3D,
-    0x00, 0x7C, 0x02, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x01, 0xAF, 0x55, 0x40, 0x01, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x17, 0xE5, 0x50, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xEF, 0xFF,
-    0xF8, 0x24, 0x00, 0x15, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x3D,
-    0x00, 0x05, 0x50, 0x03, 0xE0, 0x1F, 0x8F, 0xFF, 0xF0, 0xFF, 0xF0, 0x0F, 0xEF, 0xF8, 0x17, 0xD5,
-    0x0B, 0x42, 0xC0, 0x3F, 0xFE, 0x40, 0x0F, 0x00, 0x3C, 0x05, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00,
-    0xBD, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x7F, 0xC0, 0x3E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0xE0,
-    0x3C, 0x1B, 0xFA, 0x00, 0x00, 0xFD, 0x63, 0xC2, 0xF0, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x8F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0xFF, 0xAF, 0xC0, 0x0F, 0xC0, 0x1E, 0x00, 0xBC, 0x00, 0x34, 0x07, 0xD0, 0x00, 0x40,
-    0x2F, 0x00, 0x00, 0x0A, 0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x1A, 0xFE, 0xA8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x3F, 0x80, 0x01, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3D, 0x55, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xE3, 0xD0, 0x00, 0x05, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x70, 0xF0, 0x81, 0xD1, 0x80, 0x07, 0x40, 0x00, 0x1D,
-    0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01,
-    0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x6A, 0xA9, 0x55, 0xF2, 0xFF, 0xFF, 0xFF,
-    0xE1, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00,
-    0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00,
-    0x07, 0x40, 0x0D, 0x1D, 0x2C, 0x2D, 0x71, 0xE0, 0x2E, 0xEE, 0x00, 0x2F, 0xE0, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x74, 0x00, 0x78, 0x00, 0xB4, 0x07, 0x80,
-    0x00, 0xB4, 0x7D, 0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xF3, 0xC0, 0x00, 0x0F, 0x03, 0xC0, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0xF4, 0x07, 0xDD, 0xF4, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40,
-    0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40, 0x09, 0x1D, 0x18, 0x3C, 0x74,
-    0xF0, 0x3D, 0xDF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xDD, 0xF0, 0x3C, 0x74, 0xF0, 0x41, 0xD0, 0x40, 0x07, 0x40, 0x00,
-    0x1D, 0x00, 0x00, 0x74, 0x00, 0x41, 0xD0, 0x43, 0xC7, 0x4F, 0x03, 0xDD, 0xF0, 0x03, 0xFF, 0x00,
-    0x03, 0xF0, 0x01, 0x5B, 0x95, 0x2F, 0xFF, 0xFE, 0x15, 0x55, 0x50, 0x00, 0x00, 0x50, 0x00, 0x02,
-    0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x00, 0x3C,
-    0x2C, 0x03, 0xC0, 0xB0, 0x3C, 0x02, 0xC3, 0xE5, 0x5B, 0x1F, 0xFF, 0xFC, 0x2E, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xE0, 0x00, 0x07,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x0F, 0x00,
-    0x38, 0x0F, 0x00, 0xE0, 0x0F, 0x03, 0x95, 0x6F, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x1E,
-    0x00, 0x02, 0xE0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0,
-    0x04, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xCF, 0x40, 0x00, 0xFB, 0xEA, 0xAA, 0xBF,
-    0xFF, 0xFF, 0xFE, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x15, 0x03, 0xFF, 0xFF, 0xFE, 0x3E,
-    0xAA, 0xAA, 0xA6, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFE, 0x03, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0xF0, 0x00,
-    0x3C, 0xF0, 0x07, 0xE2, 0xF4, 0x7B, 0x8B, 0xB5, 0xCE, 0x2C, 0xD0, 0x38, 0xB0, 0x00, 0xE2, 0xC0,
-    0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C,
-    0x00, 0x14, 0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x50, 0x00, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0xF0, 0x00, 0x00, 0x01, 0xE7, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x8B,
-    0x00, 0x0E, 0x2C, 0x00, 0x38, 0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x00, 0x0E, 0x2C, 0x00, 0x38,
-    0xB0, 0x00, 0xE2, 0xC0, 0x03, 0x8B, 0x02, 0xCE, 0x2C, 0xE3, 0xF8, 0xBF, 0x03, 0xE2, 0xF0, 0x03,
-    0xDF, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x18, 0x00, 0x0B, 0x80, 0xB8, 0x00,
-    0xB4, 0x00, 0xB8, 0x0B, 0xFF, 0xFF, 0xF8, 0x7A, 0xAA, 0xAA, 0xB7, 0xC0, 0x00, 0x00, 0xF3, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x0B, 0x40, 0x07, 0x80, 0xB4, 0x00, 0x04, 0x00,
-    0x40, 0x00, 0x14, 0x00, 0x00, 0x05, 0x1F, 0x80, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBD,
-    0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8,
-    0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x2E, 0x5F, 0xD0, 0x04, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x6E, 0x7E, 0x00, 0xBF, 0xFF,
-    0x80, 0xF8, 0x07, 0xE0, 0xB8, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x2E, 0x00, 0x0F, 0x0F, 0x40, 0x07,
-    0xC3, 0xD0, 0x02, 0xE0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0xB8, 0x0F, 0xC0, 0x7C, 0x01, 0xFE, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x53, 0xFF, 0xFF, 0xFB, 0xAA, 0xAF,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x7A, 0xAA,
-    0xFD, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA4, 0x01, 0xC0, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x3F, 0xE5, 0xBF, 0xF0, 0x03, 0xF4, 0x00,
-    0x2F, 0x80, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0xF4, 0x00, 0x0F, 0x7D, 0x0B, 0xC0, 0x00, 0xF4, 0xB8,
-    0x3E, 0x00, 0x0F, 0x41, 0xF0, 0xF4, 0x00, 0xF4, 0x07, 0xC3, 0xD0, 0x0F, 0x80, 0x1F, 0x0F, 0x40,
-    0xB8, 0x00, 0x7C, 0x3E, 0x0B, 0x80, 0x02, 0xF0, 0xBC, 0xB8, 0x00, 0x0F, 0x81, 0xFB, 0x80, 0x00,
-    0x7C, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xFE, 0xBF, 0xE0, 0x07,
-    0xC2, 0xFF, 0xFD, 0x00, 0x08, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x2D, 0x3D,
-    0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0xB4, 0x0F, 0x80, 0x00, 0xF0, 0x0B,
-    0xC0, 0x02, 0xE0, 0x07, 0xD0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x02, 0xF0, 0x0F, 0x40, 0x01,
-    0xF4, 0x0F, 0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x05, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0x55, 0x6B, 0xF0, 0xBD, 0x00,
-    0x00, 0xF4, 0x0F, 0x80, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x7D, 0x00, 0x0F, 0x00, 0x0F,
-    0xC0, 0x07, 0xC0, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xB8, 0x00,
-    0x01, 0xF4, 0x3C, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x0B, 0xCB, 0x40, 0x00, 0x00, 0xF7, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFA, 0xAA, 0xA0, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xD0, 0x55, 0x55,
-    0x50, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0x7D, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0xAF, 0xA8,
-    0x07, 0xF0, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0xAA, 0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x16,
-    0xE5, 0x54, 0x3D, 0x00, 0xB4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x3F,
-    0x0B, 0x40, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xAA, 0xA0, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xEA, 0xAA, 0xAF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x02, 0xAA, 0xAB, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2A, 0xAA, 0xAA, 0xAF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0xF5, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0xAB, 0xEA, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xF4, 0x00, 0x2D, 0x00, 0x2F, 0x00,
-    0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x0F, 0x0A, 0xAF, 0xEA, 0xAB,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x6E, 0x50, 0x7C, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00, 0xF0,
-    0x0B, 0xC0, 0x00, 0x2D, 0x03, 0xD0, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0xFB, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xFE, 0xAA,
-    0xAA, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x55, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0xAA, 0xAB, 0xF4, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x6F,
-    0xF8, 0x01, 0xBF, 0xE3, 0xFF, 0xF0, 0x0F, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF,
-    0xD2, 0xFE, 0xAA, 0xAF, 0x43, 0xF4, 0x00, 0x2E, 0x07, 0xF0, 0x00, 0x38, 0x0B, 0xE0, 0x00, 0x80,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x14, 0x1F, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x07,
-    0xCF, 0xD5, 0x55, 0xBE, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00,
-    0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x03, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x24, 0x38, 0x24, 0x7E, 0x39, 0xFC,
-    0x0B, 0xFF, 0xD0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x3F, 0x39, 0xF8, 0x34, 0x38, 0x28, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xFF, 0x42, 0xE5, 0xF4, 0xF0,
-    0x1E, 0x78, 0x03, 0xCE, 0x00, 0xE3, 0xD0, 0xB4, 0x7F, 0xF8, 0x01, 0xA0, 0x00, 0x14, 0xFD, 0xFD,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0xAA, 0x80, 0x0B, 0x40, 0xFF, 0xC0, 0x0F,
-    0x00, 0x57, 0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xF8, 0xB8, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xD1, 0xFF, 0xE2, 0xE0, 0xF0, 0x2E, 0xD0, 0x38, 0x03,
-    0xE0, 0x0E, 0x00, 0xB8, 0x03, 0xC0, 0x7B, 0x40, 0xBE, 0xF8, 0xF8, 0x0B, 0xF4, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0xFC, 0x3F, 0xF8, 0x38, 0x0F, 0xF0, 0x3C, 0x74, 0x07,
-    0xC0, 0x2C, 0x74, 0x07, 0xC0, 0x2C, 0x78, 0x0E, 0xF0, 0x3C, 0x3E, 0xBC, 0x7E, 0xF4, 0x0F, 0xE0,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3D, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0x53,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF,
-    0x7D, 0xF6, 0x80, 0x14, 0x04, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x3C,
-    0x2E, 0x3C, 0x2E, 0x3C, 0x2E, 0x28, 0x19, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x07, 0xCB, 0x80,
-    0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x78, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0xF0,
-    0x00, 0x2E, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x2F, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x80, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x02,
-    0xE0, 0x3D, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x0F, 0x00, 0x07, 0x80, 0x0B, 0x80, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x07,
-    0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x03, 0xCF, 0x40, 0x00,
-    0x00, 0xF7, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x6A, 0xA4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFE, 0x56, 0xFC, 0x0B, 0xC0, 0x00, 0xF8,
-    0x3D, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C,
-    0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00,
-    0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x03, 0xD0, 0x14, 0x00, 0x00, 0x51, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F,
-    0x5F, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F,
-    0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x0F, 0x5F, 0x00,
-    0x00, 0x3D, 0x7C, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x03, 0xC3, 0xE0, 0x00, 0x2F, 0x0B, 0xD0, 0x01,
-    0xF8, 0x0B, 0xFA, 0xBF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xF4, 0x24, 0x00, 0x1F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x2E, 0x00, 0x07, 0xC7, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC,
-    0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x7C, 0xFE, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0xFE, 0x00, 0x01,
-    0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01,
-    0x81, 0xFB, 0xFD, 0x6F, 0x0E, 0x01, 0xBF, 0xF0, 0x10, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x3F, 0xF8, 0x02, 0xC3, 0xE5, 0xFF, 0xBD, 0x0D, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x06, 0x40, 0x04,
-    0x3F, 0xF4, 0x2D, 0xB9, 0xBF, 0xFC, 0xB0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1D, 0xBF,
-    0xFE, 0x7D, 0xF0, 0x2F, 0xF8, 0x10, 0x02, 0x90, 0x24, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE9, 0x03, 0xFF,
-    0xFF, 0xFF, 0x09, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x07, 0x42, 0xAA, 0xBE, 0x9F, 0xFF,
-    0xFF, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x00, 0x1F, 0xFF, 0xFF, 0x2B, 0xEA, 0xA8, 0x2C,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xE0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x2F, 0xD0, 0x06, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x02, 0x80, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD,
-    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x2F,
-    0xC0, 0x07, 0xF0, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0x80, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x0F,
-    0xC0, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFD, 0x00,
-    0xBF, 0x40, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x57, 0xD5, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x7F, 0xEA, 0xFA,
-    0xA0, 0x3F, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0, 0x03,
-    0xC0, 0x01, 0xF0, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x02, 0xF0,
-    0x1E, 0x00, 0x00, 0x3F, 0x4F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF, 0xD0,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x55, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA,
-    0xBF, 0xFF, 0x40, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00, 0xF0, 0x07, 0xC0,
-    0x00, 0x78, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x0B,
-    0xC0, 0x02, 0xD0, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0x90, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xEA, 0xAA, 0xA0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x4B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x47, 0x47, 0xD0, 0x01,
-    0xE0, 0x1D, 0x02, 0xD0, 0x0E, 0x00, 0x74, 0x02, 0xC0, 0xB0, 0x01, 0xD0, 0x03, 0x83, 0x80, 0x07,
-    0x40, 0x0B, 0x1C, 0x00, 0x1D, 0x00, 0x1D, 0x75, 0x55, 0xB9, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0x40, 0x07, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x00, 0x1D, 0x38, 0x00, 0x74, 0x00, 0xB0, 0xB0,
-    0x01, 0xD0, 0x03, 0x80, 0xE0, 0x07, 0x40, 0x3C, 0x01, 0xE0, 0x1D, 0x03, 0xD0, 0x01, 0xF8, 0x74,
-    0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x0E,
-    0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x0B, 0x1C, 0x00, 0x00,
-    0x00, 0x1D, 0x75, 0x55, 0x55, 0x55, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x40, 0x00, 0x00, 0x07,
-    0x5D, 0x00, 0x00, 0x00, 0x1D, 0x38, 0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x03, 0x80, 0xF0,
-    0x00, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xB2,
-    0xE0, 0x02, 0xD3, 0x83, 0x82, 0xE0, 0x2D, 0x0B, 0x1C, 0x02, 0xE2, 0xD0, 0x1D, 0x70, 0x02, 0xFD,
-    0x00, 0x36, 0xC0, 0x03, 0xF0, 0x00, 0xE7, 0x00, 0x2E, 0xE0, 0x03, 0x5D, 0x02, 0xD2, 0xE0, 0x1D,
-    0x38, 0x2D, 0x02, 0xE0, 0xB0, 0xB2, 0xD0, 0x02, 0xE3, 0x80, 0xFD, 0x00, 0x02, 0xFC, 0x01, 0xF0,
-    0x00, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0xD0,
-    0x01, 0xE0, 0x00, 0x03, 0xD0, 0x0E, 0x00, 0x00, 0x2F, 0xC0, 0xB0, 0x00, 0x02, 0xD3, 0x83, 0x80,
-    0x00, 0x2D, 0x0B, 0x1D, 0x00, 0x02, 0xD0, 0x1D, 0x70, 0x00, 0x2D, 0x00, 0x36, 0xC0, 0x02, 0xD0,
-    0x00, 0xE7, 0x00, 0x2D, 0x00, 0x03, 0x5D, 0x02, 0xD0, 0x00, 0x1D, 0x38, 0x2D, 0x00, 0x00, 0xB0,
-    0xB2, 0xD0, 0x00, 0x03, 0x80, 0xFD, 0x00, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xF8,
-    0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x56, 0xE5, 0x54, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x10, 0xBD, 0xFE, 0xBC, 0x04, 0x00, 0x04, 0x00, 0x05, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xDB,
-    0xF0, 0x03, 0xF0, 0x03, 0xF8, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x7D, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x2F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFE, 0x00, 0x2F, 0xFF, 0x42, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x2F,
-    0xFC, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_12_regularBitmaps[32238] = {
+    0x0A, 0xA0, 0xAD, 0x0E, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xAC,
+    0x90, 0xAC, 0x90, 0x9C, 0x90, 0x9C, 0x97, 0x09, 0xCA, 0x0E, 0x9E, 0x19, 0x10, 0x0A, 0xA1, 0xAC,
+    0xAC, 0xA0, 0x9D, 0xAC, 0x90, 0x9D, 0xAC, 0x90, 0x9C, 0xAA, 0xC9, 0x09, 0xCA, 0xAC, 0x90, 0x9C,
+    0xAA, 0xC2, 0xCA, 0x99, 0x29, 0x00, 0x5C, 0xA2, 0xAC, 0x70, 0xC9, 0x2C, 0xA7, 0x9C, 0x92, 0xC9,
+    0x7A, 0xC2, 0xAC, 0x5F, 0xFF, 0xC2, 0x99, 0xAC, 0xA9, 0x99, 0xD9, 0x99, 0x49, 0xC9, 0x2C, 0x97,
+    0xAC, 0x29, 0xC7, 0x0D, 0x2A, 0xC5, 0x99, 0x9D, 0x99, 0x9D, 0x99, 0x91, 0x9F, 0xFF, 0xA4, 0xAC,
+    0x29, 0xC9, 0x7D, 0x2A, 0xC7, 0x0C, 0xA2, 0xD7, 0x9C, 0x92, 0xCA, 0x50, 0x5A, 0x97, 0x09, 0xC9,
+    0x70, 0x9C, 0x71, 0xAC, 0x96, 0xAF, 0xD9, 0x2D, 0xAA, 0xC9, 0xE1, 0xAC, 0xA0, 0x9C, 0x1D, 0x90,
+    0xD9, 0x09, 0xC1, 0xAC, 0x1D, 0x90, 0x9C, 0x5A, 0xD0, 0x9C, 0x6F, 0xC7, 0xFC, 0x96, 0x9F, 0xC6,
+    0xAA, 0x9E, 0x19, 0x2C, 0xA1, 0xD9, 0x9C, 0x91, 0xCA, 0x1D, 0x9A, 0xCA, 0x1C, 0xA1, 0xD0, 0xAD,
+    0x90, 0xCA, 0x0A, 0xD1, 0xFF, 0xC3, 0xAF, 0xCA, 0x7C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x09, 0xC9,
+    0x70, 0x9A, 0x50, 0x77, 0x71, 0x99, 0x70, 0xAA, 0x69, 0xF9, 0x6D, 0x59, 0xD9, 0x9D, 0x94, 0xAC,
+    0x6D, 0x29, 0xD3, 0x9C, 0xA5, 0x9D, 0x3D, 0x3D, 0x69, 0xCA, 0x3D, 0x29, 0xC9, 0x69, 0xCA, 0x3D,
+    0x2D, 0x79, 0xCA, 0x3D, 0x1A, 0xC3, 0x94, 0xD2, 0xAC, 0xA1, 0xCA, 0x1A, 0xF2, 0xAD, 0x99, 0xD1,
+    0xAC, 0x1D, 0xA9, 0xAD, 0x2F, 0xC1, 0x9C, 0x90, 0x9C, 0xA2, 0xD9, 0x39, 0x3D, 0x1A, 0xC9, 0x29,
+    0xCA, 0x7A, 0xC2, 0xD9, 0x29, 0xCA, 0x7C, 0xA2, 0xD3, 0x9C, 0xA6, 0xAC, 0x3D, 0x92, 0xAC, 0xA5,
+    0x9C, 0xA3, 0xAC, 0xA2, 0xD6, 0xD5, 0xDA, 0x9A, 0xCA, 0x5A, 0xC9, 0x59, 0xFA, 0x6A, 0xC7, 0x09,
+    0x97, 0x77, 0x10, 0x77, 0x79, 0xF9, 0x73, 0xAD, 0xAA, 0xD9, 0x71, 0x9D, 0x2A, 0xCA, 0x71, 0xAC,
+    0xA2, 0x9C, 0xA7, 0x1D, 0x92, 0xAC, 0x97, 0x1D, 0xA2, 0xD7, 0x2A, 0xD1, 0xD7, 0x39, 0xD1, 0x97,
+    0x39, 0xEA, 0x29, 0xFC, 0xA2, 0x9D, 0xAD, 0x91, 0x9F, 0xC9, 0x2D, 0x90, 0xAD, 0x3A, 0xC9, 0x39,
+    0xD2, 0xE2, 0x9C, 0x93, 0xAD, 0x3E, 0x1A, 0xC9, 0x3A, 0xD4, 0xE9, 0xAC, 0x49, 0xD5, 0xFC, 0x5E,
+    0x5F, 0xA4, 0x9E, 0xA9, 0x9A, 0xFE, 0xA9, 0x29, 0xFF, 0x90, 0x9F, 0x94, 0x99, 0x99, 0x69, 0x10,
+    0x0A, 0xAA, 0xCA, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x09, 0x90, 0x49, 0xA4, 0x9D, 0x4D,
+    0x4D, 0x93, 0xAC, 0xA4, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xDA, 0x4D, 0xA4,
+    0xDA, 0x4A, 0xCA, 0x4A, 0xD4, 0x9D, 0x5D, 0xA4, 0xAD, 0x5D, 0xA4, 0x9D, 0x5E, 0x5E, 0x5D, 0x70,
+    0x0A, 0x95, 0xDA, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xDA, 0x4A, 0xD4,
+    0xAD, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xD9, 0x39, 0xD4, 0xD9,
+    0x3A, 0xCA, 0x3A, 0xCA, 0x4C, 0xA7, 0x40, 0x74, 0x9C, 0xA2, 0xD0, 0xAC, 0x92, 0xDA, 0xAC, 0x49,
+    0xFC, 0x91, 0xAD, 0xAA, 0xCA, 0x0D, 0xAA, 0xC3, 0xAA, 0x0A, 0xC9, 0x5A, 0xC9, 0x10, 0x4C, 0xA7,
+    0x0D, 0x70, 0xD7, 0x0D, 0x49, 0x99, 0x9D, 0x99, 0x99, 0x9F, 0xFD, 0x09, 0x99, 0x9D, 0x99, 0x99,
+    0x4D, 0x70, 0xD7, 0x0D, 0x70, 0xCA, 0x30, 0x79, 0xD2, 0x9D, 0x91, 0x9D, 0x91, 0xAD, 0x2D, 0xA1,
+    0x9D, 0x2D, 0x39, 0x30, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x0A, 0xCA,
+    0x09, 0xE1, 0xE2, 0x91, 0x70, 0xD7, 0x09, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xC9, 0x70, 0xD7,
+    0x0A, 0xCA, 0x70, 0xD7, 0x09, 0xCA, 0x70, 0xD7, 0x09, 0xD7, 0x0D, 0x97, 0x0D, 0x70, 0xAC, 0x97,
+    0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x97, 0x73, 0x59, 0x97, 0x1F, 0xD9, 0x49,
+    0xEA, 0xAE, 0xA3, 0xDA, 0x3E, 0x91, 0xE5, 0xDA, 0x1D, 0x95, 0xAD, 0x09, 0xD6, 0x9D, 0x0A, 0xD6,
+    0x9D, 0x9E, 0x69, 0xD9, 0xE6, 0x9D, 0x9E, 0x69, 0xD9, 0xE6, 0x9D, 0x9A, 0xD6, 0xAD, 0x09, 0xD9,
+    0x5E, 0x1D, 0xA4, 0x9D, 0x91, 0xAD, 0x93, 0xE3, 0xFA, 0xAE, 0x5A, 0xFC, 0xA7, 0x09, 0x99, 0x50,
+    0x75, 0xAC, 0xA2, 0x9A, 0xFA, 0x2A, 0xFC, 0xA5, 0x9D, 0xA6, 0xDA, 0x6D, 0xA6, 0xDA, 0x6D, 0xA6,
+    0xDA, 0x6D, 0xA6, 0xDA, 0x6D, 0xA6, 0xDA, 0x6D, 0xA6, 0xDA, 0x39, 0xAF, 0xD0, 0x9F, 0xF9, 0x59,
+    0x97, 0xAF, 0xD4, 0xEA, 0xAF, 0x2A, 0xD3, 0xAD, 0xA1, 0xD9, 0x4E, 0x1D, 0x5E, 0x29, 0x5D, 0xA7,
+    0x09, 0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x0A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD7,
+    0x0A, 0xD9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x0A, 0xFF, 0xD9, 0x49, 0x95, 0xAF, 0xD2, 0xEA,
+    0xAF, 0x0A, 0xD3, 0xAD, 0x09, 0xC4, 0x9D, 0x96, 0x9D, 0x7E, 0x59, 0xE4, 0x9F, 0x93, 0x9F, 0xDA,
+    0x39, 0x2E, 0x97, 0xE7, 0xE7, 0xDA, 0x6A, 0xD9, 0x5E, 0xA0, 0x99, 0xAA, 0xFA, 0x1A, 0xFD, 0x94,
+    0x99, 0x95, 0x77, 0x6A, 0xD9, 0x71, 0x9E, 0x97, 0x1F, 0x97, 0x0F, 0xC9, 0x7A, 0xD0, 0xD9, 0x7D,
+    0x90, 0xD9, 0x6D, 0xA1, 0xD9, 0x5A, 0xD2, 0xD9, 0x49, 0xD3, 0xD9, 0x4D, 0x93, 0xD9, 0x3A, 0xCA,
+    0x4D, 0x93, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0x97, 0x0D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97,
+    0x39, 0x93, 0x76, 0xFF, 0xC2, 0xFF, 0xC2, 0xD9, 0x70, 0xD7, 0x1D, 0x71, 0xD9, 0x96, 0x9F, 0xCA,
+    0x49, 0xFE, 0x96, 0x9F, 0x70, 0xAD, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0xE6, 0x9E, 0xA1,
+    0x99, 0xAA, 0xFA, 0x2A, 0xFC, 0xA5, 0x99, 0x96, 0x71, 0x97, 0x9A, 0xF9, 0x4A, 0xEA, 0x99, 0x4E,
+    0xA7, 0xE9, 0x79, 0xD9, 0x70, 0xDA, 0x70, 0x9D, 0xAA, 0xAA, 0xA4, 0xAF, 0xFA, 0x2E, 0x91, 0x9E,
+    0xA1, 0xDA, 0x4E, 0x1D, 0xA4, 0x9D, 0x90, 0xDA, 0x5D, 0xA0, 0xE5, 0xDA, 0x0A, 0xD9, 0x39, 0xD9,
+    0x1E, 0x3E, 0x2A, 0xEA, 0xAE, 0x93, 0x9F, 0xD7, 0x09, 0x94, 0x75, 0xFF, 0xE0, 0x9F, 0xFE, 0x09,
+    0xD4, 0x9D, 0xA0, 0x9C, 0x94, 0xAD, 0x19, 0xC5, 0xD9, 0x70, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x70,
+    0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x71,
+    0xD9, 0x72, 0x97, 0x59, 0x97, 0x0A, 0xFC, 0x94, 0xEA, 0xAE, 0x92, 0xDA, 0x3E, 0x2D, 0x93, 0x9D,
+    0x2D, 0x93, 0x9D, 0x2E, 0x3D, 0xA2, 0x9E, 0x90, 0xDA, 0x49, 0xFC, 0x96, 0xFD, 0x49, 0xD9, 0x0A,
+    0xE9, 0x19, 0xD9, 0x3E, 0x1E, 0x49, 0xDA, 0x0D, 0xA5, 0xDA, 0x0D, 0xA5, 0xD9, 0x0A, 0xD9, 0x3A,
+    0xD2, 0xFA, 0xAE, 0x93, 0xFE, 0x96, 0x99, 0x94, 0x59, 0x70, 0xAF, 0xCA, 0x4F, 0xAF, 0x2A, 0xD3,
+    0xAD, 0xA1, 0xDA, 0x4E, 0x1D, 0x94, 0xAD, 0x09, 0xD9, 0x49, 0xD9, 0x0D, 0xA5, 0xD9, 0x0E, 0x49,
+    0xD9, 0x09, 0xE9, 0x2A, 0xD2, 0x9F, 0xFC, 0x49, 0xAA, 0xAA, 0xDA, 0x70, 0x9D, 0x97, 0x0E, 0x70,
+    0xE7, 0x9E, 0x94, 0x9A, 0xF5, 0xFC, 0x97, 0x99, 0x70, 0x19, 0x2E, 0x09, 0xE1, 0xAC, 0xA7, 0x77,
+    0x7A, 0xCA, 0x09, 0xE1, 0xE2, 0x91, 0x29, 0x92, 0xE9, 0x1E, 0x91, 0xAC, 0xA7, 0x77, 0x76, 0x9D,
+    0x29, 0xD9, 0x19, 0xD9, 0x1A, 0xD2, 0xDA, 0x19, 0xD2, 0xD3, 0x93, 0x77, 0x39, 0xC9, 0x69, 0xEA,
+    0x49, 0xF9, 0x39, 0xF9, 0x4E, 0xA6, 0x9D, 0xA7, 0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x0A, 0xEA, 0x70,
+    0xAE, 0x71, 0xA9, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xD7, 0x77, 0x70, 0x9F, 0xFD,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x74, 0xC9, 0x70, 0x9E, 0x97, 0x9F, 0x97, 0x9F, 0x97, 0x9E,
+    0xA7, 0x09, 0xE6, 0x9E, 0xA4, 0x9E, 0xA4, 0xAE, 0xA5, 0xEA, 0x7A, 0xA7, 0x74, 0x72, 0x9E, 0xA4,
+    0xFD, 0x92, 0xCA, 0xAA, 0xE9, 0x6A, 0xD7, 0xD7, 0x9C, 0x96, 0xAC, 0x94, 0x9E, 0x29, 0xFC, 0xA2,
+    0xFC, 0x93, 0xDA, 0x95, 0xAC, 0x79, 0xC7, 0x77, 0x4A, 0xC6, 0xAD, 0xA5, 0x9D, 0x96, 0x99, 0x40,
+    0x77, 0x75, 0xAF, 0xDA, 0x72, 0x9F, 0xFF, 0x7A, 0xE9, 0x59, 0xE9, 0x4A, 0xD9, 0x71, 0xAD, 0x3A,
+    0xD7, 0x4D, 0xA2, 0xD9, 0x39, 0xAD, 0x94, 0xD1, 0xDA, 0x29, 0xDA, 0xE9, 0x3D, 0x90, 0xD3, 0xD2,
+    0xAC, 0xA3, 0xAC, 0xA9, 0xD3, 0xAA, 0x29, 0xCA, 0x3A, 0xCA, 0xAC, 0xA7, 0x0A, 0xCA, 0x3A, 0xCA,
+    0xAC, 0xA4, 0x9A, 0xFA, 0x3A, 0xC9, 0xDA, 0x3A, 0xD9, 0x9A, 0xCA, 0x3D, 0x0A, 0xCA, 0x3D, 0x29,
+    0xCA, 0x29, 0xD0, 0xAC, 0xA2, 0x9D, 0x2A, 0xD1, 0x9D, 0x90, 0x9D, 0x3E, 0xAF, 0xF9, 0x2D, 0x92,
+    0x9E, 0xA0, 0x9E, 0xA4, 0xAD, 0x77, 0x3D, 0xA7, 0x72, 0x9E, 0x97, 0x1A, 0x7F, 0xA9, 0x90, 0x99,
+    0xAE, 0x70, 0x9F, 0xFD, 0xA7, 0x49, 0xAA, 0xAA, 0x97, 0x70, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75,
+    0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D,
+    0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA,
+    0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA,
+    0x0F, 0xD9, 0x3F, 0xE9, 0x19, 0x9A, 0xAA, 0xA9, 0x93, 0xFF, 0xE3, 0x9E, 0x19, 0xAE, 0x3A, 0xD3,
+    0xAD, 0x92, 0xAD, 0x4D, 0x92, 0xAD, 0x4D, 0x92, 0xAD, 0x4D, 0x3A, 0xD3, 0xAC, 0xA3, 0xAF, 0xF4,
+    0xAF, 0xFC, 0x92, 0xAD, 0x39, 0xE2, 0xAD, 0x5D, 0x91, 0xAD, 0x5D, 0xA1, 0xAD, 0x5D, 0xA1, 0xAD,
+    0x49, 0xD9, 0x1A, 0xD3, 0x9E, 0x1A, 0xFA, 0xFC, 0x1F, 0xFD, 0x97, 0x70, 0x59, 0x9A, 0xA9, 0x95,
+    0x9F, 0xF3, 0xEA, 0x99, 0x9E, 0x2E, 0x5D, 0x19, 0xD6, 0xD1, 0xDA, 0x6A, 0xC0, 0x9D, 0x97, 0x1A,
+    0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x2A, 0xD9, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9F,
+    0x94, 0x9A, 0x19, 0xFF, 0xDA, 0x3A, 0xFE, 0xA7, 0x99, 0x93, 0x19, 0x9A, 0xAA, 0xAA, 0x96, 0xFF,
+    0xF9, 0x49, 0xE0, 0x99, 0x9A, 0xF4, 0xAD, 0x5A, 0xE3, 0xAD, 0x6A, 0xDA, 0x2A, 0xD7, 0xE2, 0xAD,
+    0x7A, 0xD9, 0x1A, 0xD7, 0x9D, 0x91, 0xAD, 0x79, 0xDA, 0x1A, 0xD7, 0x0D, 0x91, 0xAD, 0x79, 0xD9,
+    0x1A, 0xD7, 0x9D, 0x2A, 0xD7, 0xE2, 0xAD, 0x7D, 0x92, 0xAD, 0x6E, 0x3A, 0xD4, 0x9E, 0x3A, 0xFF,
+    0xDA, 0x3F, 0xFD, 0xA7, 0x76, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA,
+    0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD,
+    0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFF, 0x90, 0x9E, 0xAA, 0xAA, 0xAD, 0x91, 0xAD, 0x49, 0xC9, 0x1A, 0xD5, 0xC2, 0xAD, 0x71,
+    0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x99, 0x99, 0xAA, 0x3A, 0xFF, 0x3A, 0xD9, 0x99, 0x99, 0x93, 0xAD,
+    0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x70, 0xAF, 0xA9, 0x4F, 0xEA, 0x40, 0x69, 0xAA,
+    0xA9, 0x96, 0x9F, 0xFC, 0xA3, 0xAE, 0xA9, 0x99, 0xAD, 0xA2, 0xAD, 0x95, 0xAC, 0xA1, 0x9D, 0x96,
+    0x9C, 0xA1, 0xDA, 0x70, 0xC1, 0x9D, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE5, 0xFE, 0xAD,
+    0x59, 0xAA, 0xE9, 0xAD, 0x97, 0x9D, 0x09, 0xE7, 0x9D, 0x1E, 0xA6, 0x9D, 0x19, 0xEA, 0x59, 0xD2,
+    0x9F, 0xFF, 0x4A, 0xFF, 0xC9, 0x79, 0x99, 0x94, 0x99, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F,
+    0xE3, 0x9F, 0xDA, 0x09, 0xE9, 0x59, 0x9D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD,
+    0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0xCA,
+    0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7,
+    0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x2A, 0xFA, 0x49, 0xAE, 0xA9, 0xFE, 0x39, 0xFD, 0xA0, 0x99, 0x99,
+    0x99, 0x90, 0xFE, 0x90, 0x9E, 0x93, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x3A, 0xFA, 0x0F, 0xE9, 0x19, 0x99, 0x99,
+    0x99, 0x2F, 0xE9, 0x29, 0xE9, 0x5A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6,
+    0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x59, 0xDA,
+    0x4A, 0xE4, 0xAD, 0xA7, 0x70, 0x99, 0x99, 0x99, 0x92, 0x99, 0x99, 0x99, 0x1F, 0xE2, 0xFD, 0x91,
+    0x9E, 0x94, 0xAD, 0xA4, 0xAD, 0x49, 0xD9, 0x5A, 0xD3, 0xAD, 0x96, 0xAD, 0x2A, 0xD9, 0x7A, 0xD1,
+    0xAD, 0x71, 0xAD, 0x0E, 0x72, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0xAD, 0x9E, 0x72, 0xAD, 0x09, 0xE7,
+    0x1A, 0xD1, 0xAE, 0x70, 0xAD, 0x2A, 0xE7, 0xAD, 0x3A, 0xE6, 0xAD, 0x4A, 0xE9, 0x3A, 0xFA, 0x3A,
+    0xEA, 0x1F, 0xE4, 0x9F, 0x76, 0x99, 0x10, 0x99, 0x99, 0x99, 0x96, 0xFE, 0x96, 0x9E, 0x97, 0x1A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xCA, 0x1A, 0xD6, 0xD1, 0xAD, 0x5A, 0xCA, 0x0A, 0xFF, 0xE9, 0xFF,
+    0xFC, 0x00, 0x19, 0x99, 0x99, 0x70, 0x99, 0x99, 0x4F, 0xCA, 0x6F, 0xCA, 0x4A, 0xF6, 0xF9, 0x59,
+    0xF5, 0xAE, 0xA6, 0x9C, 0xAD, 0x94, 0xD9, 0xD6, 0x9C, 0x9A, 0xD4, 0xCA, 0x9D, 0x6A, 0xC9, 0x9D,
+    0x3A, 0xC9, 0x9D, 0x6A, 0xC1, 0xD9, 0x2D, 0x1D, 0x6D, 0x1A, 0xCA, 0x2C, 0xA1, 0xD6, 0xD1, 0x9D,
+    0x1A, 0xC2, 0xD9, 0x5D, 0x2D, 0x90, 0xD2, 0xD9, 0x5D, 0x2A, 0xCA, 0x9C, 0xA2, 0xD9, 0x5D, 0x3D,
+    0xAC, 0x3D, 0xA4, 0x9D, 0x3F, 0x3A, 0xCA, 0x49, 0xCA, 0x3A, 0xD9, 0x3A, 0xD4, 0x9C, 0xA4, 0xD4,
+    0xAD, 0x3A, 0xEA, 0x92, 0x99, 0x3A, 0xFA, 0x0F, 0xE7, 0xFE, 0x00, 0x99, 0x99, 0x96, 0x99, 0x99,
+    0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3, 0xAE, 0xA6, 0xAC, 0x93, 0xAF, 0x95, 0xAC,
+    0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xE4, 0xAC, 0x93, 0xAC, 0x90, 0x9D, 0xA3, 0xAC,
+    0x93, 0xAC, 0x91, 0xAD, 0x3A, 0xC9, 0x3A, 0xC9, 0x2E, 0x2A, 0xC9, 0x3A, 0xC9, 0x29, 0xDA, 0x1A,
+    0xC9, 0x3A, 0xC9, 0x3A, 0xD9, 0x0A, 0xC9, 0x3A, 0xC9, 0x4E, 0x0A, 0xC9, 0x3A, 0xC9, 0x5D, 0xAA,
+    0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F, 0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE, 0x59, 0xD9,
+    0x77, 0x93, 0x59, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2,
+    0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD,
+    0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A,
+    0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97,
+    0x19, 0x9A, 0xAA, 0xA9, 0x93, 0xFF, 0xE9, 0x29, 0xE1, 0x9A, 0xE9, 0x2A, 0xD4, 0xE2, 0xAD, 0x4A,
+    0xD2, 0xAD, 0x49, 0xD2, 0xAD, 0x4A, 0xD2, 0xAD, 0x4E, 0x2A, 0xD3, 0xAD, 0x3A, 0xDA, 0xAF, 0x93,
+    0xAF, 0xDA, 0x5A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x1A, 0xFA, 0x95, 0xFE,
+    0xA5, 0x59, 0x9A, 0xAA, 0x97, 0x29, 0xFF, 0xA7, 0xF9, 0x99, 0xAF, 0x5E, 0x95, 0xEA, 0x3A, 0xD9,
+    0x7E, 0x92, 0xE7, 0x09, 0xDA, 0x19, 0xD9, 0x71, 0xE1, 0xAD, 0x72, 0xE1, 0xAD, 0x72, 0xAD, 0x1E,
+    0x72, 0xAD, 0x1E, 0x72, 0xAD, 0x1A, 0xD9, 0x71, 0xE1, 0xAD, 0xA7, 0x1D, 0xA2, 0xE7, 0x0A, 0xD9,
+    0x2A, 0xDA, 0x7D, 0xA4, 0xEA, 0x49, 0xE6, 0xFA, 0xAA, 0xEA, 0x70, 0x9F, 0xE9, 0x74, 0xE9, 0x77,
+    0xAD, 0xA9, 0x76, 0x9F, 0xA9, 0x97, 0x4A, 0xFD, 0xA7, 0x49, 0xAD, 0xA0, 0x19, 0x9A, 0xAA, 0xA9,
+    0x96, 0xFF, 0xE9, 0x59, 0xE1, 0x9A, 0xE9, 0x5A, 0xD4, 0xE5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5,
+    0xAD, 0x4A, 0xD5, 0xAD, 0x4D, 0x95, 0xAD, 0x2A, 0xDA, 0x6A, 0xFE, 0x97, 0xAF, 0xD7, 0x1A, 0xD1,
+    0xE7, 0x0A, 0xD1, 0x9D, 0xA7, 0xAD, 0x2A, 0xDA, 0x6A, 0xD3, 0xE9, 0x5A, 0xD4, 0xEA, 0x3A, 0xEA,
+    0xA2, 0x9E, 0xA1, 0xFE, 0x93, 0xF7, 0x59, 0x91, 0x39, 0xAA, 0x99, 0x49, 0xFF, 0x19, 0xE9, 0x99,
+    0xAD, 0x1D, 0xA4, 0xD1, 0xD9, 0x4D, 0x1D, 0x94, 0xC9, 0x1E, 0x97, 0xAE, 0xA7, 0xAF, 0xA6, 0x9F,
+    0xC9, 0x69, 0xF9, 0x7A, 0xE1, 0xA5, 0x9D, 0x9D, 0x6D, 0x9D, 0x94, 0x9D, 0x9E, 0x4E, 0x0A, 0xEA,
+    0xAA, 0xE2, 0xAF, 0xE5, 0x99, 0x99, 0x40, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F,
+    0xFF, 0xE1, 0xDA, 0xAA, 0xAE, 0xAA, 0xAA, 0xD1, 0xD3, 0xDA, 0x3D, 0x1D, 0x3D, 0xA3, 0xD1, 0xA9,
+    0x3D, 0xA3, 0xA9, 0x7D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x39, 0xAE, 0xAA, 0x70, 0xFF, 0x93, 0x09, 0x99, 0x99,
+    0x95, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x3F, 0xDA, 0x09, 0xAD, 0xA6, 0x9E, 0x4D, 0x97, 0xAC, 0xA4,
+    0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A,
+    0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D,
+    0xA7, 0xD9, 0x4E, 0x69, 0xD5, 0x9E, 0x49, 0xDA, 0x6F, 0xCA, 0xFC, 0x70, 0xAF, 0xEA, 0x74, 0x99,
+    0x97, 0x09, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x90, 0xAF, 0xDA, 0x2A, 0xFD, 0x19, 0xEA, 0x6A,
+    0xD9, 0x39, 0xDA, 0x6D, 0xA5, 0xE6, 0xD9, 0x5A, 0xD5, 0x9D, 0x69, 0xD9, 0x4D, 0xA7, 0xE4, 0xD7,
+    0x0A, 0xD3, 0x9D, 0x71, 0xD9, 0x2D, 0x97, 0x1E, 0x2D, 0x72, 0x9D, 0x19, 0xCA, 0x73, 0xD9, 0x0D,
+    0x97, 0x3A, 0xCA, 0x0D, 0x74, 0x9D, 0xAC, 0xA7, 0x5F, 0x76, 0xAE, 0x77, 0xD9, 0x77, 0x72, 0x09,
+    0x99, 0x99, 0x99, 0x74, 0x99, 0x99, 0x99, 0x09, 0xFE, 0x4A, 0xA4, 0xAF, 0xD1, 0x9A, 0xE9, 0x5D,
+    0x95, 0xAD, 0x94, 0xE5, 0x9D, 0xA5, 0xAD, 0x5A, 0xD5, 0xF5, 0xDA, 0x59, 0xD9, 0x4F, 0x5D, 0x7D,
+    0xA3, 0x9C, 0xAD, 0xA3, 0x9D, 0x7E, 0x3A, 0xC9, 0xAD, 0x3A, 0xCA, 0x79, 0xD3, 0xD0, 0x9D, 0x3D,
+    0x97, 0x0D, 0x91, 0x9C, 0xA1, 0xD9, 0x2D, 0x71, 0xDA, 0x1A, 0xC9, 0x1A, 0xD1, 0xAC, 0xA7, 0x1A,
+    0xD1, 0xD2, 0x9D, 0x1D, 0x97, 0x2D, 0x1C, 0xA3, 0xD9, 0x0D, 0x73, 0xD9, 0xAC, 0x93, 0xAC, 0xA9,
+    0xCA, 0x73, 0xAC, 0xAD, 0x49, 0xDA, 0xC9, 0x74, 0xF5, 0xF7, 0x5E, 0x95, 0xAD, 0xA7, 0x5A, 0xD6,
+    0x9D, 0x97, 0x77, 0x72, 0x09, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x1F, 0xE2, 0xAF, 0xC9, 0x19,
+    0xE9, 0x49, 0xDA, 0x49, 0xE4, 0xDA, 0x6A, 0xD9, 0x2A, 0xD7, 0x0E, 0x19, 0xD7, 0x19, 0xE0, 0xD9,
+    0x72, 0xAF, 0xA7, 0x4F, 0x75, 0xAE, 0x74, 0x9F, 0xA7, 0x3D, 0x0A, 0xD9, 0x71, 0xD9, 0x1E, 0x70,
+    0xAC, 0xA3, 0xE6, 0x9D, 0x4A, 0xDA, 0x5D, 0x95, 0xE9, 0x2A, 0xEA, 0x93, 0x9F, 0xA9, 0xFE, 0x2A,
+    0xFE, 0x09, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E, 0xA5, 0xAD,
+    0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3, 0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70, 0xE1, 0xD7,
+    0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75,
+    0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x30, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFF,
+    0xE9, 0x19, 0xDA, 0xAA, 0xAA, 0xAE, 0x91, 0xAC, 0xA5, 0xDA, 0x2A, 0xC5, 0xE4, 0xA4, 0xAD, 0x97,
+    0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2D,
+    0xA5, 0xAC, 0x2E, 0x6D, 0x1A, 0xD9, 0x59, 0xD1, 0xFF, 0xFA, 0x1F, 0xFF, 0x97, 0x70, 0x0A, 0xAA,
+    0xA1, 0xF9, 0x0D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0xAA, 0x1F, 0x90, 0x0D, 0x71, 0x9C, 0xA7, 0x1D, 0x71,
+    0xAC, 0xA7, 0x1D, 0x71, 0xAC, 0x97, 0x09, 0xD7, 0x1D, 0x97, 0x09, 0xCA, 0x71, 0xD7, 0x1A, 0xCA,
+    0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0x71, 0x9C, 0xA7, 0x1D, 0x74,
+    0x9A, 0xAA, 0xAA, 0xF1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1,
+    0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D,
+    0x19, 0xD9, 0xAA, 0xDA, 0xF0, 0x39, 0xD7, 0x0E, 0x97, 0xF6, 0xAC, 0x9D, 0x6D, 0x09, 0xCA, 0x49,
+    0xCA, 0x1D, 0x4D, 0x2A, 0xC9, 0x29, 0xD3, 0xD2, 0xAC, 0x93, 0xD9, 0x1D, 0x49, 0xCA, 0x0A, 0xCA,
+    0x5D, 0x19, 0x79, 0x00, 0xFF, 0xF9, 0xFF, 0xF9, 0x6D, 0x3E, 0x29, 0xDA, 0x29, 0xD9, 0x3A, 0xA5,
+    0x76, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD,
+    0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E,
+    0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77, 0xAE, 0xA7, 0x1A, 0xEA, 0x73, 0xDA, 0x73,
+    0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x0A, 0xF9, 0x4F, 0xFD, 0xA3, 0xF9, 0x19, 0xE3, 0xE4,
+    0x9D, 0xA2, 0xDA, 0x5E, 0x2D, 0xA5, 0xE2, 0xDA, 0x5A, 0xD2, 0xDA, 0x5E, 0x2D, 0xA5, 0xDA, 0x2D,
+    0xA4, 0x9D, 0x3D, 0xA4, 0xDA, 0x3F, 0xAA, 0xAE, 0x4A, 0xFE, 0xA7, 0x09, 0x99, 0x50, 0x75, 0x9F,
+    0xC9, 0x2A, 0xDA, 0xAE, 0x90, 0xAD, 0x3D, 0xA0, 0xD4, 0xAC, 0x9A, 0xD7, 0xDA, 0x7D, 0xA7, 0xDA,
+    0x7E, 0x7A, 0xD9, 0x69, 0xE9, 0x6A, 0xFF, 0xC1, 0x9F, 0xE5, 0x99, 0x92, 0x77, 0x5A, 0xF7, 0x1A,
+    0xF7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD5, 0x9F, 0xF4, 0xFA, 0xFC, 0x3A, 0xD4, 0xE3,
+    0xD9, 0x4A, 0xD2, 0xAD, 0x5A, 0xD2, 0xDA, 0x5A, 0xD2, 0xDA, 0x5A, 0xD2, 0xDA, 0x5A, 0xD2, 0xE5,
+    0xAD, 0x2A, 0xD5, 0xAD, 0x29, 0xE3, 0x9E, 0x3A, 0xEA, 0xAF, 0xCA, 0xA2, 0xAF, 0xC9, 0x0F, 0x93,
+    0x99, 0x39, 0x30, 0x75, 0xAF, 0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49,
+    0xFF, 0xFF, 0xFE, 0xAD, 0x97, 0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99,
+    0x20, 0x69, 0x99, 0x6A, 0xFC, 0xA3, 0xAD, 0x99, 0xE3, 0xD3, 0xA9, 0x2A, 0xD7, 0x0D, 0xA7, 0x0D,
+    0xA6, 0x9A, 0xFD, 0xA1, 0x9F, 0xFA, 0x4D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0xAE, 0xAA, 0x4F, 0xE9, 0x20, 0x77, 0x2F, 0xFD,
+    0x3E, 0xAA, 0xEA, 0xD2, 0xDA, 0x3D, 0xA4, 0xD9, 0x39, 0xD4, 0xD9, 0x39, 0xD4, 0xD9, 0x3A, 0xD4,
+    0xAD, 0x91, 0x9D, 0xA5, 0xFE, 0xA5, 0xAC, 0xA9, 0xAA, 0x97, 0xD7, 0x4D, 0x97, 0x3F, 0xFD, 0x93,
+    0xAF, 0xFD, 0x91, 0x9D, 0x59, 0xDA, 0x1D, 0x7A, 0xCA, 0x09, 0xD7, 0xD2, 0xE9, 0x3A, 0xDA, 0x29,
+    0xFF, 0xC9, 0x5A, 0xFA, 0x94, 0x39, 0x74, 0xF9, 0x72, 0x9F, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D,
+    0x97, 0x5D, 0x97, 0x5D, 0x09, 0xFC, 0x96, 0xDA, 0xFE, 0x6E, 0xA2, 0xAD, 0xA5, 0xD9, 0x4E, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94,
+    0xAD, 0x5D, 0x94, 0xAD, 0x39, 0xAE, 0xA2, 0x9E, 0xA9, 0x09, 0xFD, 0x19, 0xFD, 0x00, 0x71, 0x9D,
+    0xA3, 0xAE, 0x39, 0xDA, 0x77, 0x72, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA,
+    0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA, 0x73, 0xAD, 0x4E, 0x93,
+    0xE7, 0x77, 0x3A, 0xE2, 0xAF, 0x4A, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4,
+    0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x4A, 0xD4, 0xDA, 0x29, 0xE2, 0xAE, 0x3A, 0xCA, 0x30,
+    0x39, 0x72, 0xF7, 0x19, 0xF7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x2F, 0xD9, 0x2D, 0x2A,
+    0xFA, 0x3D, 0x3D, 0xA5, 0xD1, 0x9D, 0xA6, 0xD0, 0x9D, 0x97, 0xDA, 0xD7, 0x1D, 0x9D, 0xA7, 0x0D,
+    0x09, 0xD9, 0x7D, 0x1A, 0xD9, 0x6D, 0x2E, 0x95, 0xD3, 0xEA, 0x29, 0xAD, 0xA9, 0x2E, 0xA0, 0x9F,
+    0xD3, 0xF7, 0x39, 0x90, 0x39, 0x3A, 0xE9, 0x19, 0xAE, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x29, 0xAE, 0xA9, 0xAF, 0xDA, 0x77, 0x71, 0x9A, 0xD1, 0xAF, 0x91, 0x9F, 0xA3, 0x9F, 0xAF, 0xE9,
+    0xFE, 0xA4, 0x9E, 0xA2, 0xAF, 0x91, 0x9E, 0x5D, 0xA4, 0xE4, 0x9D, 0x5D, 0xA4, 0xAD, 0x49, 0xD5,
+    0xDA, 0x4A, 0xD5, 0xD9, 0x4D, 0xA4, 0xAD, 0x5D, 0x94, 0xDA, 0x4A, 0xD5, 0xD9, 0x4D, 0xA4, 0xAD,
+    0x5D, 0x94, 0xDA, 0x4A, 0xD5, 0xD9, 0x4D, 0xA4, 0xAD, 0x5D, 0x93, 0xAE, 0xA2, 0x9E, 0xA9, 0x2A,
+    0xEA, 0x1F, 0xD9, 0x1F, 0xCA, 0x1F, 0xD9, 0x77, 0x19, 0xAD, 0x1A, 0xFA, 0x39, 0xFA, 0xFE, 0x94,
+    0x9E, 0xA2, 0x9E, 0x5D, 0xA4, 0xAD, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D,
+    0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x4A, 0xEA, 0x3E, 0xAA, 0x1F,
+    0xD9, 0x1F, 0xD0, 0x77, 0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD,
+    0x6D, 0xAD, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A,
+    0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69, 0x99, 0x94, 0x77, 0xAD, 0xA0, 0x9F, 0xA2, 0xFC, 0xAF, 0xE3,
+    0xAE, 0x92, 0xAD, 0xA2, 0x9D, 0x94, 0xE2, 0x9D, 0x5A, 0xD2, 0x9D, 0x59, 0xD9, 0x19, 0xD5, 0x9D,
+    0x91, 0x9D, 0x59, 0xD2, 0x9D, 0x5A, 0xD2, 0x9D, 0x5D, 0xA2, 0x9D, 0x4A, 0xD3, 0x9F, 0xAA, 0xE9,
+    0x39, 0xFE, 0xA5, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x72, 0xAF, 0xC9, 0x69, 0xAA, 0xAA,
+    0xAA, 0x96, 0x77, 0x09, 0xFD, 0xA9, 0x3F, 0xAF, 0xC2, 0xAD, 0x4E, 0x19, 0xD9, 0x4A, 0xD1, 0xAD,
+    0x5A, 0xD1, 0xDA, 0x5A, 0xD1, 0xDA, 0x5A, 0xD1, 0xDA, 0x5A, 0xD1, 0xE5, 0xAD, 0x1A, 0xD5, 0xE1,
+    0x9E, 0x3F, 0x2A, 0xFF, 0xD3, 0x9F, 0xA0, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0x70, 0xAF, 0xCA, 0x59, 0xAA, 0xAA, 0xAA, 0x90, 0x74, 0x9A, 0xD1, 0xAE, 0x09, 0xF0, 0xAF, 0x29,
+    0xFA, 0x9A, 0xA3, 0xE9, 0x7D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x0D, 0xA6, 0x9A, 0xEA, 0xA9, 0x29, 0xFE, 0xA2, 0x73, 0x9F, 0xCA, 0x19, 0xD9, 0x9A, 0xD9, 0x0D,
+    0x3A, 0xC9, 0x0D, 0x4C, 0x1E, 0x95, 0xAF, 0x94, 0xAF, 0xC9, 0x4A, 0xF1, 0x93, 0xAD, 0xA9, 0xC4,
+    0xAC, 0xA9, 0xCA, 0x3A, 0xCA, 0x9D, 0xA9, 0x9A, 0xD1, 0xFE, 0x49, 0x99, 0x30, 0x74, 0xD6, 0x9D,
+    0x69, 0xD5, 0xAF, 0xE0, 0xFF, 0xC2, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0x9D, 0x69, 0xEA, 0xAD, 0x2A, 0xFC, 0x94, 0x99, 0x20, 0x77, 0x1A, 0xE3, 0xAA, 0xDA,
+    0x2A, 0xF3, 0xF9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A,
+    0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA,
+    0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x00, 0x9F, 0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19,
+    0xAE, 0x91, 0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4, 0xD9, 0x3D, 0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC,
+    0xA6, 0xDA, 0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D, 0x9D, 0x71, 0xAF, 0x72, 0xE9, 0x72, 0xE7, 0x74,
+    0x9F, 0xCA, 0x29, 0xC3, 0xAF, 0xA0, 0xFA, 0x92, 0xAC, 0x92, 0x9A, 0xE9, 0x1D, 0xA4, 0xE4, 0xD9,
+    0x2A, 0xD3, 0x9E, 0x39, 0xD4, 0xD9, 0x2A, 0xE9, 0x2A, 0xCA, 0x4D, 0xA2, 0xDA, 0xD2, 0xD5, 0xAD,
+    0x19, 0xC9, 0x9D, 0x2D, 0x6D, 0x1A, 0xC1, 0xD9, 0x09, 0xC9, 0x6D, 0xA0, 0xD1, 0xAD, 0x0D, 0x79,
+    0xD9, 0xC9, 0x2D, 0x0C, 0xA7, 0x0F, 0x3F, 0x97, 0x0A, 0xDA, 0x39, 0xE7, 0x19, 0xD9, 0x4D, 0xA7,
+    0x77, 0x20, 0x0F, 0xCA, 0x1F, 0xC9, 0x0F, 0xC9, 0x1A, 0xEA, 0x29, 0xDA, 0x3D, 0x94, 0x9D, 0x91,
+    0xD9, 0x6A, 0xD0, 0xAC, 0x97, 0x0A, 0xEA, 0x72, 0xE7, 0x29, 0xEA, 0x71, 0xD0, 0xDA, 0x7D, 0x19,
+    0xD9, 0x5D, 0x92, 0xAD, 0x39, 0xE9, 0x29, 0xEA, 0x0A, 0xFC, 0x90, 0xAF, 0xC9, 0x9F, 0xCA, 0x1A,
+    0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91, 0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4, 0xD9, 0x3D, 0x94, 0xAD,
+    0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA, 0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D, 0x9D, 0x71, 0xAE, 0xA7,
+    0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x2A, 0xD9, 0x69, 0x9A, 0xEA, 0x7A, 0xFC, 0x70,
+    0x9D, 0xA9, 0x71, 0x09, 0xFF, 0xC1, 0xAF, 0xFC, 0x90, 0xAC, 0x4D, 0xA1, 0xAC, 0x3E, 0x7A, 0xD7,
+    0x9D, 0x97, 0xDA, 0x7D, 0xA7, 0xE3, 0x99, 0x1A, 0xD4, 0xD0, 0x9D, 0x93, 0x9C, 0xA0, 0xEA, 0xAA,
+    0xAE, 0xA0, 0xFF, 0xD7, 0x40, 0x39, 0xD9, 0x2F, 0x91, 0xAD, 0x4D, 0xA4, 0xD9, 0x4A, 0xCA, 0x4A,
+    0xD4, 0x9D, 0x5D, 0x5D, 0x4A, 0xD3, 0xE9, 0x3E, 0x5E, 0x5D, 0x5D, 0x49, 0xD4, 0xAD, 0x4A, 0xCA,
+    0x4D, 0x94, 0xDA, 0x4A, 0xD5, 0xEA, 0x93, 0xF7, 0x2A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9,
+    0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC,
+    0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x90, 0x0D, 0xA9, 0x29, 0xF9, 0x49, 0xD5,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x49, 0xD4, 0xAD, 0x4A, 0xD4, 0x9D, 0x5A, 0xD9, 0x39, 0xDA, 0x3D,
+    0x93, 0xAD, 0x4A, 0xD4, 0x9D, 0x5D, 0x5D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x19, 0xAD, 0xA2, 0xEA,
+    0x72, 0x19, 0x95, 0x91, 0xFC, 0x29, 0xC9, 0xAD, 0xAE, 0xAA, 0xD0, 0xD2, 0xAF, 0x97, 0x99, 0x20,
+    0x39, 0xDA, 0xAD, 0xA9, 0xD9, 0x70, 0x9C, 0x1A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xCA, 0x0A,
+    0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xD0, 0xE0, 0xE0, 0xE0, 0xDA, 0x0C, 0xA0, 0x77, 0x29, 0xC7,
+    0x2A, 0xC7, 0x2A, 0xC7, 0x2A, 0xC7, 0x2A, 0xC9, 0x69, 0xFE, 0x92, 0x9D, 0xAD, 0x9E, 0x2D, 0x90,
+    0xAC, 0x09, 0xD1, 0xAC, 0xA1, 0xAA, 0x1C, 0x91, 0xD9, 0x1A, 0xA5, 0xD2, 0xAA, 0x49, 0xD2, 0xCA,
+    0x49, 0xD2, 0xCA, 0x5D, 0x91, 0xCA, 0x5E, 0x1C, 0x95, 0xAD, 0xA0, 0xC9, 0x2A, 0x2F, 0xFD, 0x3A,
+    0xFD, 0xA6, 0x9C, 0xA7, 0x2C, 0x97, 0x2C, 0x97, 0x2C, 0x97, 0x19, 0xC9, 0x72, 0xA5, 0x70, 0x97,
+    0x19, 0xFC, 0x95, 0x9D, 0xAA, 0xE5, 0xD9, 0x2D, 0x93, 0x9D, 0x3A, 0xC9, 0x3D, 0xA7, 0x2D, 0x97,
+    0x2D, 0x72, 0x9D, 0x39, 0x3F, 0xFD, 0x39, 0x9E, 0x99, 0x99, 0x95, 0xAC, 0xA7, 0x2D, 0x97, 0x2D,
+    0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x0A, 0xFF, 0xF0, 0xAD, 0xAF, 0xFA, 0x1A, 0x95, 0x99, 0x91, 0x75,
+    0x9C, 0x70, 0xAC, 0x1D, 0x9A, 0xFA, 0xAC, 0xA2, 0xEA, 0xAA, 0xE9, 0x3A, 0xCA, 0x3D, 0x4D, 0x4A,
+    0xC9, 0x3D, 0x49, 0xCA, 0x3D, 0x4A, 0xC9, 0x3A, 0xCA, 0x3D, 0x4E, 0xA9, 0xAE, 0x92, 0xD9, 0xFC,
+    0x9A, 0xCA, 0x09, 0xC7, 0x0A, 0xC7, 0x60, 0x77, 0x09, 0xFD, 0x3A, 0xF9, 0x0A, 0xEA, 0x5A, 0xD9,
+    0x29, 0xDA, 0x5A, 0xCA, 0x4E, 0x5D, 0x6D, 0xA3, 0xAC, 0xA6, 0xAD, 0x3D, 0x70, 0xDA, 0x1A, 0xC9,
+    0x6A, 0xF1, 0xF9, 0x49, 0xAA, 0xDA, 0xAC, 0xAA, 0xA7, 0x1E, 0xA7, 0x09, 0xFF, 0xCA, 0x6A, 0xAA,
+    0xEA, 0xAA, 0x97, 0x19, 0xD7, 0x59, 0xD7, 0x59, 0xD7, 0x39, 0xAE, 0xAA, 0x70, 0x9F, 0xEA, 0x30,
+    0x2A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x99, 0xA9, 0x73, 0x9C,
+    0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x90, 0x75, 0x9F, 0xA3,
+    0xAC, 0xA9, 0xAD, 0x91, 0xAC, 0xA2, 0x9C, 0xA1, 0xD9, 0x3A, 0x1A, 0xDA, 0x6F, 0xA5, 0xD0, 0xE9,
+    0x3D, 0x1A, 0xE2, 0xAC, 0x91, 0x9E, 0x2D, 0x92, 0xAD, 0x1A, 0xDA, 0x2A, 0xC9, 0x19, 0xE9, 0x1C,
+    0xA3, 0xEA, 0x0C, 0xA4, 0x9D, 0xAC, 0xA6, 0xE9, 0x9C, 0x93, 0xAD, 0x0A, 0xD3, 0xD9, 0x09, 0xE9,
+    0x9D, 0xA2, 0xAF, 0xC9, 0x69, 0x50, 0x0A, 0x92, 0x9A, 0x0E, 0x19, 0xDA, 0xE1, 0x9D, 0x90, 0x93,
+    0x99, 0x00, 0x69, 0xAA, 0xA9, 0x73, 0xAF, 0xF9, 0x69, 0xD9, 0x5A, 0xCA, 0x5D, 0x70, 0x9C, 0xA3,
+    0xD3, 0x9A, 0xAA, 0x29, 0xC9, 0x19, 0xC9, 0x2F, 0xCA, 0x2A, 0xC1, 0xD2, 0xD2, 0xCA, 0x29, 0xC9,
+    0x0C, 0xA1, 0x9C, 0x92, 0x99, 0x3C, 0xA0, 0xC9, 0x1A, 0xC7, 0x1C, 0xA0, 0xC9, 0x1A, 0xC7, 0x1D,
+    0x0C, 0x91, 0xAC, 0x71, 0xCA, 0x0C, 0xA1, 0x9C, 0xA7, 0x0C, 0xA0, 0xAC, 0x2D, 0xA9, 0x99, 0xA2,
+    0x9C, 0x90, 0x9C, 0x92, 0xFC, 0xA2, 0xD2, 0xD4, 0x99, 0x3A, 0xC9, 0x3D, 0x70, 0xAC, 0xA5, 0xDA,
+    0x93, 0x9D, 0x97, 0x9F, 0xEA, 0x74, 0x99, 0x99, 0x60, 0x29, 0xA9, 0x3A, 0xDA, 0xCA, 0x2D, 0x1D,
+    0x29, 0x91, 0xD3, 0xAF, 0x2D, 0x99, 0xD1, 0x9C, 0xA1, 0xD2, 0xDA, 0xAE, 0xA0, 0x9D, 0xA0, 0xCA,
+    0x72, 0xAA, 0xAA, 0xAA, 0xC0, 0x9F, 0xDA, 0x00, 0x4C, 0x93, 0xAA, 0x39, 0xD3, 0xD9, 0x29, 0xD2,
+    0x9D, 0x92, 0xAD, 0x91, 0x9D, 0xA3, 0xDA, 0x2E, 0x4E, 0x2A, 0xD9, 0x4A, 0xD2, 0x9D, 0x5A, 0xCA,
+    0x29, 0xD5, 0x9C, 0xA3, 0xD7, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xD0, 0x99, 0x99,
+    0x99, 0x99, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x72, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA,
+    0xAA, 0x00, 0x59, 0x97, 0x1A, 0xFC, 0xA4, 0x9C, 0xA3, 0x9D, 0x3C, 0x90, 0x99, 0x92, 0xCA, 0x1A,
+    0xA0, 0x9D, 0xAC, 0x91, 0xC1, 0xC9, 0x1C, 0xA0, 0xCA, 0x1C, 0xA0, 0xC2, 0xCA, 0x9C, 0x91, 0xAA,
+    0x0C, 0x2E, 0xA2, 0xAC, 0x0C, 0x2C, 0xA9, 0xC9, 0x1A, 0xA0, 0xCA, 0x1D, 0x0A, 0xC9, 0x0C, 0x90,
+    0x9C, 0x09, 0x99, 0x19, 0x9A, 0xC2, 0xAC, 0x59, 0xC9, 0x3A, 0xCA, 0x99, 0xAD, 0x96, 0x9A, 0xAA,
+    0x93, 0x0F, 0xE9, 0xAF, 0xE7, 0x10, 0x39, 0x94, 0xAF, 0x91, 0xDA, 0x99, 0xD0, 0x9C, 0xA2, 0x9C,
+    0xA9, 0xC9, 0x3C, 0xA9, 0xCA, 0x29, 0xCA, 0x0D, 0x91, 0xD1, 0x9F, 0xC9, 0x39, 0xA9, 0x20, 0x4A,
+    0x97, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD3, 0x9F, 0xFD, 0x0A, 0xAA, 0xAD, 0xAA, 0xAA, 0x4D, 0x70,
+    0xD7, 0x0D, 0x70, 0xD7, 0x77, 0x19, 0xFF, 0xCA, 0x9F, 0xFD, 0x29, 0x9A, 0x93, 0xFC, 0xA1, 0xD9,
+    0x09, 0xD1, 0xD2, 0xD9, 0x09, 0x92, 0xD5, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0xAD, 0x4A, 0xD5, 0xFF,
+    0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0x29, 0xA9, 0x3A, 0xFC, 0x91, 0xD1, 0x9D, 0x19, 0x3D, 0x5D, 0x92,
+    0x9A, 0xDA, 0x3A, 0xFA, 0x6D, 0x6D, 0x5A, 0xD1, 0xAA, 0xF2, 0xFA, 0x73, 0x69, 0xC9, 0x1D, 0xA0,
+    0xE0, 0x9D, 0x1A, 0xC7, 0x77, 0x0A, 0xD5, 0xD4, 0xE4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D,
+    0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4E, 0x4A, 0xD4, 0xE4,
+    0xE9, 0x3E, 0xA2, 0xAE, 0xA3, 0xFC, 0xAE, 0x0E, 0xAA, 0x0D, 0x9F, 0xC1, 0xAE, 0x90, 0xD1, 0x99,
+    0x49, 0x92, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xAA, 0x74, 0x59, 0x99, 0x99, 0x93,
+    0xAF, 0xF9, 0x1F, 0xDA, 0xCA, 0x2A, 0xFC, 0xA9, 0xC9, 0x2F, 0xDA, 0x9C, 0x91, 0x9F, 0xDA, 0x9C,
+    0x91, 0x9F, 0xDA, 0x9C, 0x91, 0x9F, 0xDA, 0x9C, 0x92, 0xFD, 0xA9, 0xC9, 0x2A, 0xFC, 0xA9, 0xC9,
+    0x3F, 0xCA, 0x9C, 0x94, 0x9C, 0xAC, 0xA9, 0xC9, 0x7C, 0xA9, 0xC9, 0x7C, 0xA9, 0xC9, 0x7C, 0xA9,
+    0xC9, 0x7C, 0xA9, 0xC9, 0x7C, 0xA9, 0xC9, 0x7C, 0xA9, 0xC9, 0x7C, 0xA9, 0xC7, 0x0C, 0xA0, 0x97,
+    0x0C, 0x97, 0x2A, 0x50, 0x09, 0xA9, 0x1E, 0x09, 0xE1, 0xAC, 0x90, 0x0A, 0xA9, 0x09, 0xE9, 0x1D,
+    0xA1, 0xD0, 0x9D, 0x91, 0x92, 0x39, 0x39, 0xE2, 0xAF, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x3A, 0xFA, 0x09, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0xAA, 0x93, 0xFD, 0x1D, 0x2D, 0x99, 0xCA, 0x29,
+    0xD9, 0xCA, 0x3D, 0x9C, 0xA3, 0xD0, 0xD2, 0xAC, 0x90, 0xAD, 0xAA, 0xD2, 0xAE, 0xA7, 0x4A, 0xAA,
+    0xAA, 0xC1, 0xAF, 0xCA, 0x00, 0x9C, 0x4C, 0x94, 0xD9, 0x2A, 0xCA, 0x4D, 0x92, 0xDA, 0x39, 0xDA,
+    0x2E, 0x3A, 0xD2, 0x9D, 0x92, 0xE2, 0xE2, 0xDA, 0x2A, 0xD2, 0xDA, 0x2A, 0xD2, 0x9C, 0x93, 0xCA,
+    0x77, 0x00, 0x77, 0x77, 0x7C, 0x97, 0xAD, 0x71, 0x9C, 0xA5, 0xAF, 0x71, 0xD7, 0x99, 0xD7, 0x0A,
+    0xC9, 0x71, 0xD7, 0x0D, 0x72, 0xD7, 0xAC, 0x73, 0xD7, 0xCA, 0x73, 0xD6, 0xAC, 0x49, 0xD4, 0xD6,
+    0xC9, 0x39, 0xE4, 0xD5, 0xAC, 0x4F, 0x29, 0xAD, 0xA9, 0x29, 0xC9, 0x3A, 0xC9, 0xD1, 0xAF, 0xD2,
+    0xD3, 0xAC, 0xA0, 0xD7, 0x2A, 0xC3, 0x9C, 0xA1, 0xD7, 0x2C, 0xA3, 0xD2, 0xD7, 0x1A, 0xC3, 0x9F,
+    0xFA, 0x69, 0xCA, 0x4A, 0xAA, 0xAE, 0xA9, 0x6D, 0x72, 0xD7, 0x9C, 0xA7, 0x2D, 0x7D, 0x73, 0x99,
+    0x70, 0x97, 0x70, 0x77, 0x77, 0x69, 0xC7, 0x0A, 0xD7, 0x1D, 0x6A, 0xF7, 0x09, 0xC9, 0x79, 0x9D,
+    0x70, 0xD7, 0x2D, 0x7A, 0xC9, 0x72, 0xD7, 0xD7, 0x3D, 0x6A, 0xC7, 0x4D, 0x6C, 0xA2, 0xAF, 0x4D,
+    0x5A, 0xC2, 0xDA, 0x9E, 0x3D, 0x5C, 0x91, 0x9C, 0xA2, 0xD1, 0x9A, 0xDA, 0x92, 0xD3, 0xC9, 0x2D,
+    0x0A, 0xFD, 0x19, 0xC9, 0x7A, 0xCA, 0x71, 0xD7, 0x9D, 0x71, 0xAC, 0x79, 0xD7, 0x2C, 0xA6, 0x9D,
+    0x72, 0xAC, 0x6A, 0xCA, 0x72, 0x9C, 0xA5, 0xAF, 0xEA, 0x5D, 0x69, 0xFE, 0x94, 0x9C, 0xA7, 0x75,
+    0x97, 0x70, 0x77, 0x74, 0x97, 0x3C, 0x96, 0x9F, 0xC7, 0x09, 0xCA, 0x6D, 0x99, 0xAD, 0x7D, 0x7A,
+    0x3D, 0x6A, 0xC9, 0x73, 0xAC, 0xA6, 0xD7, 0x29, 0xDA, 0x6A, 0xC7, 0x2A, 0xF9, 0x5C, 0xA7, 0x59,
+    0xD4, 0xAC, 0x5D, 0x7D, 0x4C, 0x94, 0xE6, 0x9D, 0x3A, 0xC4, 0xAE, 0x29, 0x9A, 0xE9, 0x29, 0xC9,
+    0x3A, 0xCA, 0xD2, 0xFC, 0x4D, 0x39, 0xD0, 0xD3, 0x96, 0xAC, 0x4D, 0x1D, 0x73, 0xCA, 0x3A, 0xC9,
+    0x1D, 0x72, 0xAC, 0x4F, 0xFC, 0x79, 0xCA, 0x4A, 0xAA, 0xAA, 0xDA, 0xA7, 0xD7, 0x2D, 0x70, 0x9C,
+    0xA7, 0x2D, 0x70, 0xD7, 0x39, 0x97, 0x19, 0x77, 0x74, 0xAD, 0x94, 0xE9, 0x49, 0xD7, 0x77, 0x09,
+    0xC6, 0x9C, 0x95, 0xAC, 0xA2, 0x9F, 0xC1, 0xAF, 0xC9, 0x09, 0xEA, 0x92, 0xAC, 0xA5, 0xAC, 0x95,
+    0x9C, 0xA6, 0xD9, 0x59, 0xDA, 0x99, 0xAA, 0x1A, 0xFD, 0x29, 0xF9, 0x59, 0x10, 0x5A, 0x77, 0x0A,
+    0xD9, 0x76, 0x9E, 0xA7, 0x69, 0xAE, 0x77, 0x09, 0xA7, 0x77, 0x73, 0x99, 0x77, 0xE7, 0x69, 0xE9,
+    0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7,
+    0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A,
+    0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A,
+    0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x72, 0xA7, 0x79, 0xDA, 0x75, 0xAE, 0x97, 0x4E, 0xA7, 0x6A, 0x97,
+    0x77, 0x75, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9,
+    0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA,
+    0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D,
+    0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x79, 0xA7, 0x7A, 0xE7,
+    0x59, 0xDA, 0xD7, 0x39, 0xD1, 0xAD, 0x72, 0xD3, 0x9C, 0x77, 0x77, 0x19, 0x97, 0x7E, 0x76, 0x9E,
+    0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D,
+    0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5,
+    0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x59, 0x97, 0x7A, 0xE9, 0x0D, 0x72, 0xDA, 0xFC, 0x72, 0xCA,
+    0x09, 0xE9, 0x77, 0x77, 0x77, 0x49, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7,
+    0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3,
+    0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9,
+    0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90,
+    0x4A, 0xC9, 0x19, 0xCA, 0x71, 0x9E, 0x1E, 0x97, 0x1D, 0xA1, 0xE7, 0x77, 0x77, 0x74, 0x99, 0x77,
+    0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29,
+    0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97,
+    0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD,
+    0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x79, 0xA9, 0x75, 0x9F, 0x97, 0x4D, 0x1D, 0x74,
+    0xCA, 0x1A, 0xC7, 0x4D, 0x1D, 0x74, 0x9F, 0x77, 0x99, 0x77, 0x19, 0x97, 0x7E, 0x76, 0x9E, 0x97,
+    0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72,
+    0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD,
+    0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF,
+    0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x2F, 0xFF, 0xCA,
+    0x72, 0x9F, 0xAA, 0xAA, 0xAD, 0xA7, 0x2D, 0x9D, 0x5C, 0xA7, 0x19, 0xCA, 0x9D, 0x5C, 0xA7, 0x1D,
+    0x09, 0xD7, 0x70, 0xAC, 0x90, 0x9D, 0x77, 0x0D, 0x19, 0xD7, 0x7A, 0xC9, 0x19, 0xDA, 0xAA, 0xE7,
+    0x09, 0xD2, 0x9F, 0xF7, 0x0D, 0x99, 0x99, 0xAD, 0x97, 0x49, 0xFF, 0xC7, 0x5D, 0x99, 0x99, 0x9A,
+    0xD7, 0x4A, 0xCA, 0x49, 0xD6, 0xC4, 0xD5, 0x9D, 0x5A, 0xC9, 0x2D, 0xA5, 0x9D, 0x5D, 0x2A, 0xDA,
+    0x93, 0x9F, 0xFE, 0x1F, 0xD9, 0x1A, 0xFF, 0xF0, 0x59, 0x9A, 0xA9, 0x95, 0x9F, 0xF3, 0xEA, 0x99,
+    0x9E, 0x2E, 0x5D, 0x19, 0xD6, 0xD1, 0xDA, 0x6A, 0xC0, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2A, 0xD7, 0x2A, 0xD9, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9F, 0x94, 0x9A, 0x19, 0xFF,
+    0xDA, 0x3A, 0xFE, 0xA7, 0x99, 0x97, 0x19, 0xAA, 0x97, 0x1A, 0xE7, 0x3D, 0x97, 0x19, 0xD7, 0x1A,
+    0xD7, 0x29, 0x95, 0x3A, 0x73, 0xAD, 0x72, 0x9E, 0xA7, 0x19, 0xAE, 0x73, 0x9A, 0x77, 0x29, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC1, 0x9E, 0xAA, 0xAA, 0xAA, 0xD2, 0xAD, 0x5A, 0xC2,
+    0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0xAA, 0xAE, 0xA3, 0xAF, 0xFA, 0x3A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xAA, 0x1A, 0xD6, 0xD1, 0xAD, 0x59, 0xCA, 0x0A, 0xFF,
+    0xEA, 0xFF, 0xFC, 0x90, 0x70, 0xA7, 0x29, 0xD9, 0x70, 0xAE, 0x97, 0xEA, 0x71, 0xA9, 0x77, 0x49,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC1, 0x9E, 0xAA, 0xAA, 0xAA, 0xD2, 0xAD, 0x5A,
+    0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0xAA, 0xAE, 0xA3, 0xAF, 0xFA,
+    0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xAA, 0x1A, 0xD6, 0xD1, 0xAD, 0x59, 0xCA, 0x0A,
+    0xFF, 0xEA, 0xFF, 0xFC, 0x90, 0x59, 0xA7, 0x2A, 0xE7, 0x09, 0xDA, 0xD6, 0x9D, 0x1A, 0xD5, 0xD3,
+    0xAC, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC1, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xD2, 0xAD, 0x5A, 0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0xAA, 0xAE,
+    0xA3, 0xAF, 0xFA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xAA, 0x1A, 0xD6, 0xD1, 0xAD,
+    0x59, 0xCA, 0x0A, 0xFF, 0xEA, 0xFF, 0xFC, 0x90, 0x2A, 0xA9, 0x19, 0xCA, 0x49, 0xE1, 0xE4, 0x9D,
+    0xA1, 0xE7, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC1, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xD2, 0xAD, 0x5A, 0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0xAA,
+    0xAE, 0xA3, 0xAF, 0xFA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xAA, 0x1A, 0xD6, 0xD1,
+    0xAD, 0x59, 0xCA, 0x0A, 0xFF, 0xEA, 0xFF, 0xFC, 0x90, 0x99, 0x5E, 0x4A, 0xE9, 0x39, 0xEA, 0x59,
+    0xA7, 0x19, 0x99, 0x99, 0x99, 0x0F, 0xE9, 0x09, 0xE9, 0x3A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD3, 0xAF, 0xA0, 0xFE,
+    0x90, 0x5A, 0x49, 0xD9, 0x2F, 0x2E, 0xA2, 0x9A, 0x97, 0x39, 0x99, 0x99, 0x99, 0x0F, 0xE9, 0x09,
+    0xE9, 0x3A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD3, 0xAF, 0xA0, 0xFE, 0x90, 0x3A, 0xA5, 0xF3, 0xAF, 0xC1, 0xAD, 0x1D,
+    0xA0, 0xCA, 0x3A, 0xA7, 0x19, 0x99, 0x99, 0x99, 0x1F, 0xE9, 0x19, 0xE9, 0x4A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD4,
+    0xAF, 0xA1, 0xFE, 0x90, 0x0A, 0xA2, 0xAC, 0x90, 0xAD, 0xA1, 0xE0, 0x9D, 0x91, 0xE7, 0x75, 0x99,
+    0x99, 0x99, 0x92, 0xFE, 0x92, 0x9E, 0x95, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6,
+    0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x5A, 0xFA, 0x2F, 0xE9, 0x00, 0x29,
+    0x9A, 0xAA, 0xAA, 0x97, 0xFF, 0xF9, 0x59, 0xE0, 0x99, 0x9A, 0xF5, 0xAD, 0x5A, 0xE4, 0xAD, 0x6A,
+    0xDA, 0x3A, 0xD7, 0xE3, 0xAD, 0x7A, 0xD9, 0x2A, 0xD7, 0x9D, 0x90, 0x99, 0xE9, 0x99, 0x93, 0x9D,
+    0xA9, 0xFF, 0xC4, 0xD9, 0x2A, 0xD7, 0x9D, 0x92, 0xAD, 0x79, 0xD3, 0xAD, 0x7E, 0x3A, 0xD7, 0xD9,
+    0x3A, 0xD6, 0xE4, 0xAD, 0x49, 0xE4, 0xAF, 0xFD, 0xA4, 0xFF, 0xDA, 0x77, 0x70, 0x59, 0x92, 0x97,
+    0x3A, 0xE1, 0xCA, 0x72, 0xDA, 0xFC, 0x72, 0xCA, 0x09, 0xE9, 0x77, 0x77, 0x73, 0x99, 0x99, 0x96,
+    0x99, 0x99, 0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3, 0xAE, 0xA6, 0xAC, 0x93, 0xAF,
+    0x95, 0xAC, 0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xE4, 0xAC, 0x93, 0xAC, 0x90, 0x9D,
+    0xA3, 0xAC, 0x93, 0xAC, 0x91, 0xAD, 0x3A, 0xC9, 0x3A, 0xC9, 0x2E, 0x2A, 0xC9, 0x3A, 0xC9, 0x29,
+    0xDA, 0x1A, 0xC9, 0x3A, 0xC9, 0x3A, 0xD9, 0x0A, 0xC9, 0x3A, 0xC9, 0x4E, 0x0A, 0xC9, 0x3A, 0xC9,
+    0x5D, 0xAA, 0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F, 0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE,
+    0x59, 0xD9, 0x77, 0x93, 0x49, 0x97, 0x7E, 0x76, 0xAE, 0x97, 0x59, 0xEA, 0x77, 0x9A, 0x77, 0x76,
+    0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09, 0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E,
+    0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7, 0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A,
+    0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA,
+    0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x72, 0xA7,
+    0x69, 0xD9, 0x74, 0xF7, 0x4E, 0xA7, 0x5A, 0x97, 0x77, 0x70, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA,
+    0x6E, 0xA9, 0x09, 0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97,
+    0x1E, 0x0A, 0xD7, 0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97,
+    0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA,
+    0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x7A, 0xA7, 0x6F, 0x74, 0xAF, 0xC7, 0x2A, 0xD1,
+    0xAC, 0xA7, 0x1C, 0xA3, 0xAA, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09,
+    0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7,
+    0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA,
+    0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF,
+    0xEA, 0x72, 0x99, 0x99, 0x70, 0x59, 0x92, 0x97, 0x2F, 0x1C, 0xA7, 0x1D, 0xAF, 0xA7, 0x1C, 0x90,
+    0x9E, 0x77, 0x97, 0x77, 0x69, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9,
+    0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD,
+    0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1,
+    0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29,
+    0x99, 0x97, 0x4A, 0xA2, 0x9C, 0x97, 0x0A, 0xDA, 0x1E, 0x70, 0x9D, 0x91, 0xE7, 0x77, 0x77, 0x69,
+    0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9,
+    0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD,
+    0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7,
+    0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x71, 0xAC, 0x49,
+    0xC0, 0x9D, 0x29, 0xD1, 0x9D, 0x09, 0xD3, 0x9F, 0x5A, 0xD5, 0x9F, 0x39, 0xD0, 0x9D, 0x19, 0xD2,
+    0x9D, 0x0A, 0xC4, 0xAC, 0x97, 0x10, 0x69, 0xAA, 0xAA, 0x93, 0x95, 0xAF, 0xFA, 0x09, 0xCA, 0x3E,
+    0xA9, 0x09, 0xAF, 0xCA, 0x3E, 0x95, 0xF3, 0xAD, 0x96, 0xAE, 0x92, 0xE6, 0xAF, 0xC1, 0x9D, 0x95,
+    0xAC, 0xA0, 0xE1, 0xAD, 0x5A, 0xCA, 0x1E, 0x1A, 0xD4, 0xAC, 0xA2, 0xAD, 0x90, 0xE3, 0xAC, 0xA3,
+    0xAD, 0x1E, 0x2A, 0xCA, 0x4A, 0xD1, 0xAD, 0x90, 0xAC, 0xA5, 0xE1, 0xAD, 0xAA, 0xCA, 0x6D, 0xA2,
+    0xFA, 0x6A, 0xD9, 0x2F, 0x7E, 0x3A, 0xEA, 0x49, 0xE3, 0xAC, 0xAF, 0xAA, 0xAF, 0x4C, 0xA1, 0xAF,
+    0xEA, 0x73, 0x99, 0x99, 0x70, 0x59, 0xA7, 0x70, 0xAD, 0x77, 0xAE, 0xA7, 0x69, 0xF7, 0x70, 0x9A,
+    0x77, 0x72, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0, 0x9A, 0xDA, 0x69,
+    0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9,
+    0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6, 0xFC, 0xAF, 0xC7,
+    0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x73, 0xA7, 0x79, 0xD9, 0x75, 0xAE, 0x75, 0xEA, 0x76, 0xA9,
+    0x77, 0x74, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0, 0x9A, 0xDA, 0x69,
+    0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9,
+    0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6, 0xFC, 0xAF, 0xC7,
+    0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x70, 0xAA, 0x77, 0xAE, 0x75, 0xAF, 0xC7, 0x39, 0xD1, 0xAD,
+    0x72, 0xD3, 0xAC, 0x77, 0x70, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0,
+    0x9A, 0xDA, 0x69, 0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4,
+    0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6,
+    0xFC, 0xAF, 0xC7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x5A, 0xA2, 0x9C, 0xA7, 0x19, 0xDA, 0x1E,
+    0x71, 0x9D, 0xA1, 0xE7, 0x77, 0x77, 0x39, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x3F,
+    0xDA, 0x09, 0xAD, 0xA6, 0x9E, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4,
+    0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A,
+    0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0xA7, 0xD9, 0x4E, 0x69, 0xD5, 0x9E, 0x49,
+    0xDA, 0x6F, 0xCA, 0xFC, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x71, 0x99, 0x75, 0xAD, 0x73, 0x9E,
+    0xA7, 0x2A, 0xE9, 0x73, 0x99, 0x77, 0x72, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x9A, 0xFD, 0xA1,
+    0x9F, 0xCA, 0x09, 0xEA, 0x5A, 0xD9, 0x3E, 0x5D, 0x94, 0xAD, 0x93, 0x9D, 0x6E, 0x3D, 0x96, 0x9D,
+    0x91, 0xAC, 0xA7, 0x0E, 0x1D, 0x72, 0xD9, 0xAC, 0xA7, 0x2A, 0xF7, 0x4E, 0x97, 0x4A, 0xD7, 0x5A,
+    0xD7, 0x5A, 0xD7, 0x5A, 0xD7, 0x5A, 0xD7, 0x39, 0xAF, 0xA9, 0x79, 0xFE, 0xA3, 0x99, 0x99, 0x99,
+    0x96, 0xFE, 0x79, 0xE7, 0x2A, 0xD7, 0x2A, 0xFD, 0xA9, 0x4A, 0xDA, 0xAA, 0xF3, 0xAD, 0x39, 0xE2,
+    0xAD, 0x4A, 0xD2, 0xAD, 0x49, 0xD9, 0x1A, 0xD5, 0xD9, 0x1A, 0xD4, 0x9D, 0x2A, 0xD4, 0xDA, 0x2A,
+    0xD2, 0x9E, 0x3A, 0xFE, 0xA4, 0xAD, 0xAA, 0x99, 0x6A, 0xD7, 0x19, 0xEA, 0x96, 0xFE, 0x60, 0x79,
+    0x99, 0x71, 0x9F, 0xD9, 0x69, 0xDA, 0x99, 0xE9, 0x5D, 0x93, 0xDA, 0x4A, 0xD4, 0xAD, 0x4D, 0xA4,
+    0xAC, 0xA4, 0xD9, 0x39, 0xD5, 0xD9, 0x29, 0xD6, 0xD9, 0x2D, 0x7D, 0x91, 0xAC, 0x97, 0xD9, 0x1A,
+    0xD7, 0xD9, 0x19, 0xE6, 0xD9, 0x2A, 0xE9, 0x4D, 0x93, 0xAE, 0x93, 0xD9, 0x49, 0xE3, 0xD9, 0x59,
+    0xD3, 0xD9, 0x09, 0x4D, 0x3D, 0x90, 0xCA, 0x29, 0xD2, 0xAD, 0x90, 0xDA, 0x99, 0xD9, 0x1F, 0x90,
+    0xAF, 0xC9, 0x72, 0x99, 0x40, 0x29, 0x72, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x72, 0xAA,
+    0x77, 0x77, 0x19, 0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7,
+    0x1A, 0xD4, 0x9A, 0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E,
+    0x29, 0xEA, 0xAF, 0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x77, 0x29, 0xC9, 0x71, 0xDA, 0x70,
+    0xE7, 0x09, 0xD7, 0x1A, 0xC7, 0x77, 0x72, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3,
+    0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A,
+    0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x3A, 0xCA,
+    0x70, 0x9E, 0xA7, 0xDA, 0xD9, 0x5A, 0xCA, 0x09, 0xD4, 0x9C, 0xA2, 0xAC, 0x97, 0x77, 0x69, 0xAF,
+    0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD,
+    0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA,
+    0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x76, 0xE9, 0x1C, 0x49, 0xFA, 0xD9, 0x39, 0xC1, 0xF5, 0x92,
+    0x9A, 0x77, 0x77, 0x09, 0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19,
+    0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD,
+    0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x1A, 0x92, 0x9A, 0x4E, 0x19,
+    0xDA, 0x3A, 0xD1, 0x9D, 0xA4, 0x93, 0x99, 0x77, 0x77, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D,
+    0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3,
+    0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97,
+    0x39, 0xA9, 0x70, 0xFC, 0x69, 0xC9, 0x0A, 0xC9, 0x5A, 0xC1, 0x9C, 0x95, 0xAC, 0x90, 0x9C, 0x96,
+    0xFC, 0x70, 0xAA, 0x97, 0x74, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D,
+    0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D,
+    0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77, 0x49, 0xAF, 0x91,
+    0xAF, 0x92, 0xAD, 0xAA, 0xAD, 0x9D, 0xAA, 0xE9, 0x1D, 0x92, 0xF9, 0x2E, 0x1D, 0x39, 0xDA, 0x39,
+    0xD7, 0x9D, 0x93, 0x9D, 0x95, 0x9A, 0xFF, 0xD2, 0x9F, 0xFC, 0xAA, 0xA9, 0x99, 0x1A, 0xDA, 0x90,
+    0x9D, 0x70, 0xAD, 0x39, 0xD7, 0x0E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x49, 0x09, 0xEA, 0xAD, 0xAF,
+    0xFC, 0x1A, 0xFC, 0x91, 0xAF, 0xD9, 0x39, 0x96, 0x99, 0x93, 0x75, 0x9F, 0xC9, 0x2A, 0xDA, 0xAE,
+    0x90, 0xAD, 0x3D, 0xA0, 0xD4, 0xAC, 0x9A, 0xD7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7E, 0x7A, 0xD9, 0x69,
+    0xE9, 0x6A, 0xFF, 0xC1, 0x9F, 0xE5, 0x99, 0x96, 0x9A, 0xA9, 0x6A, 0xE7, 0x0D, 0x96, 0x9D, 0x69,
+    0xD7, 0x99, 0x40, 0x29, 0x70, 0x9C, 0xA7, 0xAD, 0x97, 0xE9, 0x7A, 0xD7, 0x09, 0xC7, 0x77, 0x4A,
+    0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D, 0xA9, 0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9,
+    0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF, 0xFA, 0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x77, 0x1D, 0x7A, 0xD6,
+    0x9D, 0x96, 0xD9, 0x7C, 0x97, 0x77, 0x4A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D, 0xA9, 0xD4, 0xAD,
+    0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF, 0xFA, 0x1A, 0xFD,
+    0xA5, 0x99, 0x92, 0x4D, 0x96, 0xF5, 0x9D, 0xAD, 0x4D, 0x1D, 0x92, 0xD9, 0x2D, 0x77, 0x71, 0xAF,
+    0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF, 0xFF, 0xFE, 0xAD, 0x97,
+    0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99, 0x20, 0x19, 0xA3, 0xA9, 0x19,
+    0xDA, 0x1E, 0x2D, 0xA1, 0xE3, 0x93, 0x97, 0x77, 0x2A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D, 0xA9,
+    0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF, 0xFA,
+    0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x09, 0x6D, 0x49, 0xDA, 0x4A, 0xD9, 0x4A, 0xD6, 0xC9, 0x77, 0x29,
+    0xAD, 0xA1, 0x9F, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4,
+    0xDA, 0x3A, 0xEA, 0x99, 0xFD, 0xA0, 0x74, 0xD4, 0xAD, 0x93, 0xDA, 0x3D, 0xA4, 0xC9, 0x77, 0x39,
+    0xAD, 0xA1, 0x9F, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4,
+    0xDA, 0x3A, 0xEA, 0x99, 0xFD, 0xA0, 0x2D, 0x93, 0xAE, 0x91, 0x9D, 0xAD, 0x1D, 0x90, 0xAC, 0xAA,
+    0xC9, 0x2D, 0x77, 0x09, 0xAD, 0xA1, 0x9F, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D,
+    0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x3A, 0xEA, 0x99, 0xFD, 0xA0, 0x09, 0xA3, 0xA9, 0x1E, 0x1E, 0x1E,
+    0x1A, 0xD2, 0x93, 0x97, 0x77, 0x9A, 0xDA, 0x39, 0xFA, 0x6D, 0xA6, 0xDA, 0x6D, 0xA6, 0xDA, 0x6D,
+    0xA6, 0xDA, 0x6D, 0xA6, 0xDA, 0x6D, 0xA5, 0xAE, 0xA9, 0x19, 0xFD, 0xA0, 0x77, 0x9A, 0x29, 0xC5,
+    0xAD, 0x9A, 0xCA, 0x69, 0xE9, 0x7A, 0xEA, 0x6D, 0x90, 0xD9, 0x59, 0x3D, 0x72, 0x9D, 0x49, 0xF9,
+    0xD9, 0x2F, 0xFD, 0x1A, 0xD9, 0x29, 0xE1, 0xD9, 0x4A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xDA, 0xDA,
+    0x6A, 0xCA, 0xDA, 0x6A, 0xCA, 0xE6, 0xD9, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3,
+    0x9F, 0xDA, 0x69, 0x99, 0x94, 0x77, 0x5A, 0xD9, 0x1C, 0x70, 0x9F, 0xAA, 0xC9, 0x79, 0xC9, 0x0F,
+    0x71, 0x92, 0x9A, 0x77, 0x77, 0x70, 0x9A, 0xD1, 0xAF, 0xA3, 0x9F, 0xAF, 0xE9, 0x49, 0xEA, 0x29,
+    0xE5, 0xDA, 0x4A, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5,
+    0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD4, 0xAE, 0xA3, 0xEA, 0xA1, 0xFD, 0x91, 0xFD,
+    0x00, 0x39, 0x72, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x72, 0xAA, 0x77, 0x77, 0x19, 0xFC,
+    0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A, 0xD6, 0xDA, 0xDA, 0x6F, 0xCA, 0x6F,
+    0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1, 0xAE, 0xA9, 0xAE, 0x39, 0xFD, 0xA6,
+    0x99, 0x99, 0x40, 0x77, 0x39, 0xC9, 0x71, 0xDA, 0x70, 0xE7, 0x09, 0xD7, 0x1A, 0xC7, 0x77, 0x72,
+    0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC,
+    0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F,
+    0xDA, 0x69, 0x99, 0x94, 0x4A, 0xCA, 0x70, 0x9E, 0xA7, 0xDA, 0xD9, 0x5A, 0xCA, 0x09, 0xD4, 0x9D,
+    0x2A, 0xC9, 0x77, 0x76, 0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD,
+    0x6D, 0xAD, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A,
+    0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69, 0x99, 0x94, 0x77, 0xE9, 0x1C, 0x49, 0xFA, 0xD9, 0x39, 0xC1,
+    0xF5, 0x92, 0x9A, 0x77, 0x77, 0x09, 0xFC, 0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD,
+    0x9A, 0xD6, 0xDA, 0xDA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D,
+    0xA1, 0xAE, 0xA9, 0xAE, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x2A, 0x92, 0x9A, 0x4A, 0xD9, 0x09,
+    0xDA, 0x3A, 0xD1, 0x9D, 0xA4, 0x93, 0x99, 0x77, 0x77, 0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39,
+    0xE0, 0x9D, 0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD,
+    0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69, 0x99, 0x94, 0x76, 0x9D, 0x7A,
+    0xD9, 0x69, 0xCA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFD, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x7C, 0xA7, 0xAD, 0x96, 0x9D, 0x76, 0x77, 0x29, 0xFC, 0xA0, 0x9C, 0x3E, 0xAA, 0xFC, 0xA2,
+    0xAD, 0x39, 0xE2, 0x9D, 0x4A, 0xE9, 0x1A, 0xD3, 0xAC, 0xAD, 0xA1, 0xDA, 0x2A, 0xCA, 0x0E, 0x1D,
+    0xA1, 0xAC, 0xA1, 0xAD, 0x1D, 0xA0, 0xAC, 0xA2, 0xAC, 0xA1, 0xEA, 0xCA, 0x3D, 0xA1, 0xAE, 0xA4,
+    0xD3, 0xE4, 0xAC, 0xA2, 0xAF, 0xA9, 0xAE, 0x3C, 0xA9, 0xFD, 0xA7, 0x09, 0x99, 0x95, 0x49, 0x76,
+    0xAC, 0x97, 0x5E, 0x76, 0xE7, 0x6E, 0x76, 0x9C, 0x77, 0x77, 0x72, 0xAE, 0x3A, 0xAD, 0xA2, 0xAF,
+    0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9, 0x5F, 0xAF, 0xDA,
+    0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70, 0x77, 0x71, 0xD7, 0x5E, 0x74, 0xAD, 0x97, 0x4D, 0x97,
+    0x49, 0xC7, 0x77, 0x77, 0x3A, 0xE3, 0xAA, 0xDA, 0x2A, 0xF3, 0xF9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5,
+    0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97,
+    0x00, 0x59, 0xD7, 0x5F, 0x73, 0xAC, 0xAD, 0xA7, 0x19, 0xD1, 0xD7, 0x1D, 0x3C, 0xA7, 0x77, 0x77,
+    0xAE, 0x3A, 0xAD, 0xA2, 0xAF, 0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94,
+    0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D,
+    0x93, 0xE9, 0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70, 0x39, 0x92, 0x9A, 0x70,
+    0x9D, 0xA1, 0xE7, 0x9D, 0x91, 0xE7, 0x09, 0x93, 0x97, 0x77, 0x77, 0x0A, 0xE3, 0xAA, 0xDA, 0x2A,
+    0xF3, 0xF9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5,
+    0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD,
+    0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x00, 0x77, 0x6A, 0xC9, 0x72, 0x9D, 0x97, 0x2E, 0x72,
+    0xAC, 0xA7, 0x3C, 0xA7, 0x77, 0x74, 0x9F, 0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91, 0xDA,
+    0x5D, 0x92, 0xAD, 0x49, 0xD4, 0xD9, 0x3D, 0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA, 0x1D,
+    0x79, 0xD0, 0x9C, 0xA7, 0x0D, 0x9D, 0x71, 0xAE, 0xA7, 0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x2A,
+    0xD7, 0x2A, 0xD9, 0x69, 0x9A, 0xEA, 0x7A, 0xFC, 0x70, 0x9D, 0xA9, 0x71, 0x39, 0x72, 0xAE, 0x97,
+    0x09, 0xAE, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x99, 0xFC, 0x5D, 0xAF,
+    0xE4, 0xEA, 0x2A, 0xE3, 0xD9, 0x4E, 0x3D, 0x94, 0x9D, 0x92, 0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92,
+    0xD9, 0x5D, 0x92, 0xD9, 0x49, 0xD3, 0xD9, 0x4A, 0xD3, 0xD9, 0x3A, 0xD9, 0x3F, 0xAA, 0xE9, 0x4F,
+    0xEA, 0x6D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x1A, 0xFC, 0xA6, 0x9A, 0xAA, 0xAA, 0xA9,
+    0x60, 0x3A, 0x92, 0x99, 0x6E, 0x1A, 0xD9, 0x5E, 0x1A, 0xD9, 0x69, 0x39, 0x97, 0x77, 0x71, 0x9F,
+    0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91, 0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4, 0xD9, 0x3D,
+    0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA, 0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D, 0x9D, 0x71,
+    0xAE, 0xA7, 0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x2A, 0xD9, 0x69, 0x9A, 0xEA, 0x7A,
+    0xFC, 0x70, 0x9D, 0xA9, 0x71, 0x59, 0x99, 0x99, 0x97, 0x3F, 0xF7, 0x2F, 0xEA, 0x77, 0x77, 0x77,
+    0x49, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D,
+    0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99,
+    0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4,
+    0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x1F, 0xE9, 0x3A, 0xFE, 0x77,
+    0x77, 0x74, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71,
+    0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2,
+    0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77, 0x7D, 0x39, 0xC7, 0x2E, 0xA9, 0xAC,
+    0xA7, 0x3F, 0xCA, 0x75, 0x99, 0x97, 0x77, 0x74, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7,
+    0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA,
+    0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA,
+    0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9,
+    0x3F, 0xE9, 0x75, 0x9C, 0x4C, 0x49, 0xD9, 0x1A, 0xC5, 0xFD, 0xA6, 0x9A, 0xCA, 0x97, 0x77, 0x70,
+    0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49,
+    0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA,
+    0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x70, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7,
+    0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA,
+    0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA,
+    0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9,
+    0x3F, 0xE9, 0x74, 0xAC, 0xA7, 0x6A, 0xCA, 0x77, 0xD9, 0x77, 0xEA, 0xA7, 0x59, 0xF7, 0x74, 0x76,
+    0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49,
+    0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA,
+    0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x92, 0x9C, 0xA7, 0x1D, 0x71, 0x9D, 0x71, 0x9D, 0xA9, 0x97,
+    0xAE, 0x97, 0x40, 0x71, 0x99, 0x72, 0xE7, 0x09, 0xEA, 0x7A, 0xE9, 0x70, 0xA9, 0x77, 0x71, 0x99,
+    0xAA, 0x99, 0x59, 0xFF, 0x3E, 0xA9, 0x99, 0xE2, 0xE5, 0xD1, 0x9D, 0x6D, 0x1D, 0xA6, 0xAC, 0x09,
+    0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E,
+    0xA7, 0x19, 0xF9, 0x49, 0xA1, 0x9F, 0xFD, 0xA3, 0xAF, 0xEA, 0x79, 0x99, 0x30, 0x77, 0x1D, 0x7A,
+    0xD9, 0x6D, 0xA6, 0xDA, 0x7C, 0x97, 0x77, 0x49, 0xFC, 0x92, 0xAD, 0xAA, 0xE9, 0x0A, 0xD3, 0xDA,
+    0x0D, 0x4A, 0xC9, 0xAD, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xE7, 0xAD, 0x96, 0x9E, 0x96, 0xAF, 0xFC,
+    0x19, 0xFE, 0x59, 0x99, 0x20, 0x69, 0xA9, 0x71, 0x9E, 0x97, 0x0D, 0xAD, 0x96, 0xD9, 0x09, 0xD5,
+    0xAC, 0x93, 0xC9, 0x77, 0x49, 0x9A, 0xA9, 0x95, 0x9F, 0xF3, 0xEA, 0x99, 0x9E, 0x2E, 0x5D, 0x19,
+    0xD6, 0xD1, 0xDA, 0x6A, 0xC0, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7,
+    0x2A, 0xD9, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9F, 0x94, 0x9A, 0x19, 0xFF, 0xDA, 0x3A, 0xFE, 0xA7,
+    0x99, 0x93, 0x4D, 0x96, 0xAE, 0x59, 0xDA, 0xD4, 0xD1, 0xAC, 0xA2, 0xAC, 0x92, 0xD7, 0x77, 0x19,
+    0xFC, 0x92, 0xAD, 0xAA, 0xE9, 0x0A, 0xD3, 0xDA, 0x0D, 0x4A, 0xC9, 0xAD, 0x7D, 0xA7, 0xDA, 0x7D,
+    0xA7, 0xE7, 0xAD, 0x96, 0x9E, 0x96, 0xAF, 0xFC, 0x19, 0xFE, 0x59, 0x99, 0x20, 0x79, 0x73, 0xE7,
+    0x19, 0xE7, 0x2D, 0xA7, 0x77, 0x75, 0x99, 0xAA, 0x99, 0x59, 0xFF, 0x3E, 0xA9, 0x99, 0xE2, 0xE5,
+    0xD1, 0x9D, 0x6D, 0x1D, 0xA6, 0xAC, 0x09, 0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xE7, 0x2E, 0x72,
+    0xAD, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xF9, 0x49, 0xA1, 0x9F, 0xFD, 0xA3, 0xAF,
+    0xEA, 0x79, 0x99, 0x30, 0x4D, 0x7A, 0xDA, 0x6A, 0xD9, 0x79, 0x97, 0x77, 0x49, 0xFC, 0x92, 0xAD,
+    0xAA, 0xE9, 0x0A, 0xD3, 0xDA, 0x0D, 0x4A, 0xC9, 0xAD, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xE7, 0xAD,
+    0x96, 0x9E, 0x96, 0xAF, 0xFC, 0x19, 0xFE, 0x59, 0x99, 0x20, 0x3A, 0x93, 0x9C, 0x94, 0xD9, 0x19,
+    0xD5, 0x9D, 0xA9, 0xD7, 0x9F, 0x72, 0xD9, 0x77, 0x79, 0x9A, 0xA9, 0x95, 0x9F, 0xF3, 0xEA, 0x99,
+    0x9E, 0x2E, 0x5D, 0x19, 0xD6, 0xD1, 0xDA, 0x6A, 0xC0, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2A, 0xD7, 0x2A, 0xD9, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9F, 0x94, 0x9A, 0x19, 0xFF,
+    0xDA, 0x3A, 0xFE, 0xA7, 0x99, 0x93, 0x74, 0xCA, 0x3D, 0x2A, 0xCA, 0x1D, 0x4D, 0x9A, 0xC9, 0x5E,
+    0xA6, 0x9D, 0x77, 0x74, 0x9F, 0xC9, 0x2A, 0xDA, 0xAE, 0x90, 0xAD, 0x3D, 0xA0, 0xD4, 0xAC, 0x9A,
+    0xD7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7E, 0x7A, 0xD9, 0x69, 0xE9, 0x6A, 0xFF, 0xC1, 0x9F, 0xE5, 0x99,
+    0x92, 0x2A, 0x93, 0x9C, 0xA7, 0xDA, 0x19, 0xD9, 0x70, 0xDA, 0x9D, 0x97, 0x2F, 0x97, 0x4D, 0x97,
+    0x77, 0x29, 0x9A, 0xAA, 0xAA, 0x96, 0xFF, 0xF9, 0x49, 0xE0, 0x99, 0x9A, 0xF4, 0xAD, 0x5A, 0xE3,
+    0xAD, 0x6A, 0xDA, 0x2A, 0xD7, 0xE2, 0xAD, 0x7A, 0xD9, 0x1A, 0xD7, 0x9D, 0x91, 0xAD, 0x79, 0xDA,
+    0x1A, 0xD7, 0x0D, 0x91, 0xAD, 0x79, 0xD9, 0x1A, 0xD7, 0x9D, 0x2A, 0xD7, 0xE2, 0xAD, 0x7D, 0x92,
+    0xAD, 0x6E, 0x3A, 0xD4, 0x9E, 0x3A, 0xFF, 0xDA, 0x3F, 0xFD, 0xA7, 0x76, 0x77, 0x7A, 0xF1, 0xAC,
+    0x7A, 0xF1, 0xD9, 0x70, 0xAD, 0x1D, 0x71, 0xAD, 0x1C, 0xA7, 0x1A, 0xD1, 0xC9, 0x71, 0xAD, 0x1A,
+    0x49, 0xFF, 0x6F, 0xAF, 0xC5, 0xAD, 0x4E, 0x5D, 0x94, 0xAD, 0x4A, 0xD5, 0xAD, 0x4D, 0xA5, 0xAD,
+    0x4D, 0xA5, 0xAD, 0x4D, 0xA5, 0xAD, 0x4E, 0x5A, 0xD4, 0xAD, 0x5A, 0xD4, 0x9E, 0x39, 0xE5, 0xAE,
+    0xAA, 0xFC, 0xAA, 0x4A, 0xFC, 0x90, 0xF9, 0x59, 0x93, 0x95, 0x29, 0x9A, 0xAA, 0xAA, 0x97, 0xFF,
+    0xF9, 0x59, 0xE0, 0x99, 0x9A, 0xF5, 0xAD, 0x5A, 0xE4, 0xAD, 0x6A, 0xDA, 0x3A, 0xD7, 0xE3, 0xAD,
+    0x7A, 0xD9, 0x2A, 0xD7, 0x9D, 0x90, 0x99, 0xE9, 0x99, 0x93, 0x9D, 0xA9, 0xFF, 0xC4, 0xD9, 0x2A,
+    0xD7, 0x9D, 0x92, 0xAD, 0x79, 0xD3, 0xAD, 0x7E, 0x3A, 0xD7, 0xD9, 0x3A, 0xD6, 0xE4, 0xAD, 0x49,
+    0xE4, 0xAF, 0xFD, 0xA4, 0xFF, 0xDA, 0x77, 0x70, 0x77, 0x5A, 0xF7, 0x1A, 0xAE, 0x73, 0xAD, 0x70,
+    0xAA, 0xAE, 0xAA, 0x6A, 0xFD, 0xA7, 0x1A, 0xD6, 0x9A, 0xAA, 0xAE, 0x49, 0xFF, 0xC3, 0x9D, 0xA9,
+    0x09, 0xAE, 0x3D, 0xA4, 0xAD, 0x2A, 0xD5, 0xAD, 0x2D, 0xA5, 0xAD, 0x2D, 0xA5, 0xAD, 0x2D, 0xA5,
+    0xAD, 0x2E, 0x5A, 0xD2, 0xAD, 0x5A, 0xD2, 0x9E, 0x39, 0xE3, 0xFA, 0xAF, 0xCA, 0xA2, 0xAF, 0xC9,
+    0x0F, 0x93, 0x99, 0x39, 0x30, 0x39, 0x99, 0x99, 0x96, 0xFF, 0x5F, 0xE9, 0x77, 0x76, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A,
+    0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE,
+    0xAF, 0xFF, 0xC9, 0x1A, 0xFD, 0xA2, 0xFE, 0xA7, 0x77, 0x74, 0xAF, 0xA3, 0xEA, 0xAE, 0x1D, 0xA3,
+    0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF, 0xFF, 0xFE, 0xAD, 0x97, 0xDA, 0x7A, 0xD7, 0x9E, 0x7A,
+    0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99, 0x20, 0x77, 0x0D, 0x39, 0xC5, 0xEA, 0x9A, 0xCA, 0x6F, 0xCA,
+    0x70, 0x99, 0x97, 0x73, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA,
+    0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA,
+    0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D,
+    0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x74, 0xCA, 0x39, 0xA2, 0xDA, 0x19, 0xCA,
+    0x29, 0xFD, 0x5A, 0xCA, 0x97, 0x77, 0x3A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D, 0xA9, 0xD4, 0xAD,
+    0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF, 0xFA, 0x1A, 0xFD,
+    0xA5, 0x99, 0x92, 0x77, 0x2A, 0xD9, 0x71, 0xEA, 0x71, 0x9D, 0x97, 0x77, 0x70, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5,
+    0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72,
+    0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF,
+    0xFF, 0xC9, 0x4D, 0x7A, 0xDA, 0x6A, 0xD9, 0x79, 0x97, 0x77, 0x4A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA,
+    0x3D, 0xA9, 0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7,
+    0xAF, 0xFA, 0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC,
+    0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A,
+    0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x70, 0xD9, 0x71, 0xD7,
+    0x29, 0xD7, 0x29, 0xEA, 0xA7, 0x0A, 0xEA, 0x76, 0x75, 0xAF, 0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA,
+    0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF, 0xFF, 0xFE, 0xAD, 0x97, 0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF,
+    0xA1, 0xAF, 0xE5, 0x9A, 0xCA, 0x7D, 0x79, 0xD7, 0x9D, 0xA9, 0x95, 0xAE, 0x97, 0x20, 0x19, 0xA4,
+    0xAC, 0x49, 0xD2, 0xDA, 0x5A, 0xD9, 0xDA, 0x7A, 0xF7, 0x19, 0xD7, 0x73, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C,
+    0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF,
+    0xC9, 0x74, 0xCA, 0x29, 0xD2, 0xD9, 0x1D, 0x4D, 0x9D, 0x94, 0x9E, 0xA6, 0x9D, 0x77, 0x74, 0xAF,
+    0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF, 0xFF, 0xFE, 0xAD, 0x97,
+    0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99, 0x20, 0x7A, 0xA7, 0x4A, 0xE7,
+    0x2A, 0xFC, 0x70, 0x9D, 0x1A, 0xD7, 0xD3, 0xAC, 0x77, 0x71, 0x9A, 0xAA, 0x99, 0x69, 0xFF, 0xCA,
+    0x3A, 0xEA, 0x99, 0x9A, 0xDA, 0x2A, 0xD9, 0x5A, 0xCA, 0x19, 0xD9, 0x69, 0xCA, 0x1D, 0xA7, 0x0C,
+    0x19, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xE7, 0x4E, 0x5F, 0xEA, 0xD5, 0x9A, 0xAE, 0x9A, 0xD9,
+    0x79, 0xD0, 0x9E, 0x79, 0xD1, 0xEA, 0x69, 0xD1, 0x9E, 0xA5, 0x9D, 0x29, 0xFF, 0xF4, 0xAF, 0xFC,
+    0x97, 0x99, 0x99, 0x40, 0x5D, 0x97, 0x2F, 0x71, 0x9D, 0xAD, 0x70, 0xD1, 0xDA, 0x6A, 0xC9, 0x2D,
+    0x77, 0x77, 0x5F, 0xFD, 0x3E, 0xAA, 0xEA, 0xD2, 0xDA, 0x3D, 0xA4, 0xD9, 0x39, 0xD4, 0xD9, 0x39,
+    0xD4, 0xD9, 0x3A, 0xD4, 0xAD, 0x91, 0x9D, 0xA5, 0xFE, 0xA5, 0xAC, 0xA9, 0xAA, 0x97, 0xD7, 0x4D,
+    0x97, 0x3F, 0xFD, 0x93, 0xAF, 0xFD, 0x91, 0x9D, 0x59, 0xDA, 0x1D, 0x7A, 0xCA, 0x09, 0xD7, 0xD2,
+    0xE9, 0x3A, 0xDA, 0x29, 0xFF, 0xC9, 0x5A, 0xFA, 0x94, 0x77, 0x4D, 0x39, 0xC7, 0xEA, 0x9A, 0xCA,
+    0x70, 0xFC, 0xA7, 0x29, 0x99, 0x77, 0x74, 0x9A, 0xAA, 0x99, 0x69, 0xFF, 0xCA, 0x3A, 0xEA, 0x99,
+    0x9A, 0xDA, 0x2A, 0xD9, 0x5A, 0xCA, 0x19, 0xD9, 0x69, 0xCA, 0x1D, 0xA7, 0x0C, 0x19, 0xD9, 0x73,
+    0xAD, 0x74, 0xAD, 0x74, 0xE7, 0x4E, 0x5F, 0xEA, 0xD5, 0x9A, 0xAE, 0x9A, 0xD9, 0x79, 0xD0, 0x9E,
+    0x79, 0xD1, 0xEA, 0x69, 0xD1, 0x9E, 0xA5, 0x9D, 0x29, 0xFF, 0xF4, 0xAF, 0xFC, 0x97, 0x99, 0x99,
+    0x40, 0x77, 0x1A, 0xA4, 0xC6, 0xDA, 0x19, 0xD6, 0x9F, 0xD7, 0x1A, 0xCA, 0xA7, 0x77, 0x77, 0xFF,
+    0xD3, 0xEA, 0xAE, 0xAD, 0x2D, 0xA3, 0xDA, 0x4D, 0x93, 0x9D, 0x4D, 0x93, 0x9D, 0x4D, 0x93, 0xAD,
+    0x4A, 0xD9, 0x19, 0xDA, 0x5F, 0xEA, 0x5A, 0xCA, 0x9A, 0xA9, 0x7D, 0x74, 0xD9, 0x73, 0xFF, 0xD9,
+    0x3A, 0xFF, 0xD9, 0x19, 0xD5, 0x9D, 0xA1, 0xD7, 0xAC, 0xA0, 0x9D, 0x7D, 0x2E, 0x93, 0xAD, 0xA2,
+    0x9F, 0xFC, 0x95, 0xAF, 0xA9, 0x40, 0x79, 0x75, 0xAD, 0x97, 0x3E, 0xA7, 0x39, 0xD7, 0x77, 0x77,
+    0x49, 0xAA, 0xA9, 0x96, 0x9F, 0xFC, 0xA3, 0xAE, 0xA9, 0x99, 0xAD, 0xA2, 0xAD, 0x95, 0xAC, 0xA1,
+    0x9D, 0x96, 0x9C, 0xA1, 0xDA, 0x70, 0xC1, 0x9D, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE5,
+    0xFE, 0xAD, 0x59, 0xAA, 0xE9, 0xAD, 0x97, 0x9D, 0x09, 0xE7, 0x9D, 0x1E, 0xA6, 0x9D, 0x19, 0xEA,
+    0x59, 0xD2, 0x9F, 0xFF, 0x4A, 0xFF, 0xC9, 0x79, 0x99, 0x94, 0x5D, 0x73, 0xAD, 0xA7, 0x2A, 0xD9,
+    0x73, 0x99, 0x77, 0x77, 0x70, 0xFF, 0xD3, 0xEA, 0xAE, 0xAD, 0x2D, 0xA3, 0xDA, 0x4D, 0x93, 0x9D,
+    0x4D, 0x93, 0x9D, 0x4D, 0x93, 0xAD, 0x4A, 0xD9, 0x19, 0xDA, 0x5F, 0xEA, 0x5A, 0xCA, 0x9A, 0xA9,
+    0x7D, 0x74, 0xD9, 0x73, 0xFF, 0xD9, 0x3A, 0xFF, 0xD9, 0x19, 0xD5, 0x9D, 0xA1, 0xD7, 0xAC, 0xA0,
+    0x9D, 0x7D, 0x2E, 0x93, 0xAD, 0xA2, 0x9F, 0xFC, 0x95, 0xAF, 0xA9, 0x40, 0x69, 0xAA, 0xA9, 0x96,
+    0x9F, 0xFC, 0xA3, 0xAE, 0xA9, 0x99, 0xAD, 0xA2, 0xAD, 0x95, 0xAC, 0xA1, 0x9D, 0x96, 0x9C, 0xA1,
+    0xDA, 0x70, 0xC1, 0x9D, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE5, 0xFE, 0xAD, 0x59, 0xAA,
+    0xE9, 0xAD, 0x97, 0x9D, 0x09, 0xE7, 0x9D, 0x1E, 0xA6, 0x9D, 0x19, 0xEA, 0x59, 0xD2, 0x9F, 0xFF,
+    0x4A, 0xFF, 0xC9, 0x79, 0x99, 0x97, 0x49, 0xA9, 0x74, 0xE7, 0x4A, 0xD7, 0x4A, 0xCA, 0x74, 0xD7,
+    0x59, 0x60, 0x77, 0x5C, 0xA7, 0x3D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0xA7, 0x3A, 0xD9, 0x73,
+    0x99, 0x77, 0x71, 0xFF, 0xD3, 0xEA, 0xAE, 0xAD, 0x2D, 0xA3, 0xDA, 0x4D, 0x93, 0x9D, 0x4D, 0x93,
+    0x9D, 0x4D, 0x93, 0xAD, 0x4A, 0xD9, 0x19, 0xDA, 0x5F, 0xEA, 0x5A, 0xCA, 0x9A, 0xA9, 0x7D, 0x74,
+    0xD9, 0x73, 0xFF, 0xD9, 0x3A, 0xFF, 0xD9, 0x19, 0xD5, 0x9D, 0xA1, 0xD7, 0xAC, 0xA0, 0x9D, 0x7D,
+    0x2E, 0x93, 0xAD, 0xA2, 0x9F, 0xFC, 0x95, 0xAF, 0xA9, 0x40, 0x79, 0xA9, 0x77, 0xEA, 0x75, 0xDA,
+    0xDA, 0x73, 0xDA, 0x1D, 0x97, 0x19, 0xC9, 0x3C, 0x97, 0x77, 0x99, 0x99, 0x99, 0x94, 0x99, 0x99,
+    0x99, 0x9F, 0xE3, 0x9F, 0xDA, 0x09, 0xE9, 0x59, 0x9D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D,
+    0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xFF, 0xFC, 0xA3, 0xAF,
+    0xFF, 0xCA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA,
+    0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x2A, 0xFA, 0x49, 0xAE, 0xA9, 0xFE, 0x39, 0xFD, 0xA0,
+    0x39, 0x97, 0x6A, 0xDA, 0x74, 0x9F, 0xA7, 0x3D, 0x1D, 0x97, 0x1D, 0x3C, 0xA7, 0x77, 0x79, 0x75,
+    0xF9, 0x73, 0x9F, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x09, 0xFC, 0x97,
+    0xDA, 0xFE, 0x7E, 0xA2, 0xAD, 0xA6, 0xD9, 0x4E, 0x6D, 0x94, 0xAD, 0x6D, 0x94, 0xAD, 0x6D, 0x94,
+    0xAD, 0x6D, 0x94, 0xAD, 0x6D, 0x94, 0xAD, 0x6D, 0x94, 0xAD, 0x6D, 0x94, 0xAD, 0x49, 0xAE, 0xA2,
+    0x9E, 0xA9, 0x19, 0xFD, 0x19, 0xFD, 0x00, 0x09, 0x99, 0x99, 0x99, 0x49, 0x99, 0x99, 0x99, 0x1F,
+    0xE3, 0x9F, 0xDA, 0x29, 0xE9, 0x59, 0x9D, 0xA5, 0xAD, 0x70, 0xDA, 0x3A, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0xAA, 0x09, 0xFF, 0xFF, 0xE3, 0xAD, 0x70, 0xDA, 0x5A, 0xD7, 0x0D, 0xA5, 0xAF, 0xFF,
+    0xCA, 0x5A, 0xFF, 0xFC, 0xA5, 0xAD, 0x70, 0xDA, 0x5A, 0xD7, 0x0D, 0xA5, 0xAD, 0x70, 0xDA, 0x5A,
+    0xD7, 0x0D, 0xA5, 0xAD, 0x70, 0xDA, 0x5A, 0xD7, 0x0D, 0xA4, 0xAF, 0xA4, 0x9A, 0xEA, 0x91, 0xFE,
+    0x39, 0xFD, 0xA0, 0x39, 0x74, 0xF9, 0x72, 0x9A, 0xE9, 0x75, 0xD9, 0x72, 0x9A, 0xAE, 0xAA, 0x97,
+    0x9F, 0xE9, 0x72, 0xD9, 0x75, 0xD1, 0x9A, 0xAA, 0x97, 0xD9, 0xFE, 0x6F, 0xA9, 0xAE, 0x95, 0xE4,
+    0xDA, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD,
+    0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x39, 0xAE, 0xA2, 0x9E, 0xA9, 0x09, 0xFD, 0x19, 0xFD, 0x00,
+    0x19, 0x92, 0x91, 0xF1, 0xCA, 0x9D, 0xAF, 0xA0, 0xC9, 0x09, 0xE6, 0x97, 0x39, 0x99, 0x99, 0x99,
+    0x1F, 0xE9, 0x19, 0xE9, 0x4A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD4, 0xAF, 0xA1, 0xFE, 0x90, 0x70, 0x9E, 0x1A, 0xA0,
+    0xFC, 0xAD, 0x0D, 0x09, 0xEA, 0x19, 0x2A, 0x97, 0x74, 0x9A, 0xDA, 0x29, 0xFA, 0x5D, 0xA5, 0xDA,
+    0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA4, 0xAE, 0xA9, 0x09, 0xFD, 0xA0,
+    0x19, 0x99, 0x99, 0x91, 0xFE, 0xA0, 0xFE, 0x97, 0x72, 0x99, 0x99, 0x99, 0x91, 0xFE, 0x91, 0x9E,
+    0x94, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5,
+    0xAD, 0x5A, 0xD5, 0xAD, 0x4A, 0xFA, 0x1F, 0xE9, 0xAF, 0xE0, 0xFF, 0x77, 0x74, 0x9A, 0xDA, 0x29,
+    0xFA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xA4, 0xAE,
+    0xA9, 0x09, 0xFD, 0xA0, 0x09, 0x69, 0xCA, 0x3A, 0xA0, 0xE9, 0x9D, 0x90, 0x9F, 0xCA, 0x39, 0x99,
+    0x74, 0x99, 0x99, 0x99, 0x91, 0xFE, 0x91, 0x9E, 0x94, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x4A, 0xFA, 0x1F, 0xE9,
+    0x7A, 0xC4, 0xF9, 0x09, 0xD9, 0xFD, 0x2A, 0xCA, 0xA7, 0x72, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4,
+    0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA,
+    0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0x9E, 0x93, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x3A, 0xFA, 0x0F, 0xE9, 0x19,
+    0xCA, 0x39, 0xCA, 0x4D, 0xA4, 0xAD, 0xAA, 0x92, 0xF9, 0x70, 0x71, 0x9D, 0xA3, 0xAE, 0x39, 0xDA,
+    0x77, 0x72, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D,
+    0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA, 0x3D, 0x93, 0xD4, 0x9D, 0x5D, 0xA9, 0x92, 0x9E,
+    0xA7, 0x29, 0x5E, 0x93, 0xE9, 0x3A, 0xD7, 0x72, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0x9E, 0x93,
+    0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x3A, 0xFA, 0x0F, 0xE9, 0x70, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4, 0xDA, 0x4D,
+    0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA, 0x99, 0x99,
+    0x99, 0x91, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0xFE, 0x90, 0x9E, 0x92, 0x99, 0xE9, 0x3A, 0xD5,
+    0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD,
+    0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A,
+    0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x3A, 0xFA, 0x3E, 0x2F, 0xE9, 0x2D, 0xA7, 0x5D, 0x97, 0x4A, 0xD7,
+    0x49, 0xDA, 0x72, 0x9A, 0xE7, 0x3A, 0xDA, 0x77, 0x60, 0x77, 0x9D, 0xA3, 0xAD, 0x2A, 0xE3, 0xE9,
+    0x19, 0xDA, 0x3E, 0x77, 0x77, 0x73, 0x9A, 0xDA, 0x2A, 0xE0, 0x9F, 0xA1, 0xAF, 0x3D, 0xA3, 0x9D,
+    0x3D, 0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x3D,
+    0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x3D, 0xA3, 0x9D, 0x2A, 0xEA, 0x91, 0x9D, 0x09, 0xFD, 0xA1, 0x9D,
+    0x72, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x70, 0x9E, 0x70, 0xAE, 0x71, 0xAC, 0xA3, 0x4A, 0xA6, 0xEA,
+    0x4A, 0xFC, 0x2A, 0xCA, 0x1D, 0xA1, 0xCA, 0x3A, 0xA7, 0x39, 0x99, 0x99, 0x99, 0x2F, 0xE9, 0x29,
+    0xE9, 0x5A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x59, 0xDA, 0x4A, 0xE4, 0xAD, 0xA7,
+    0x70, 0x39, 0xD6, 0xF4, 0xAC, 0xAD, 0xA2, 0x9D, 0x1D, 0x2D, 0x29, 0xCA, 0x77, 0x6A, 0xE4, 0xAF,
+    0x6A, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69,
+    0xD6, 0x9D, 0x6A, 0xD6, 0xDA, 0x49, 0xE4, 0xAE, 0x5A, 0xCA, 0x50, 0x99, 0x99, 0x99, 0x92, 0x99,
+    0x99, 0x99, 0x1F, 0xE2, 0xFD, 0x91, 0x9E, 0x94, 0xAD, 0xA4, 0xAD, 0x49, 0xD9, 0x5A, 0xD3, 0xAD,
+    0x96, 0xAD, 0x2A, 0xD9, 0x7A, 0xD1, 0xAD, 0x71, 0xAD, 0x0E, 0x72, 0xAF, 0xC7, 0x3A, 0xFC, 0x73,
+    0xAD, 0x9E, 0x72, 0xAD, 0x09, 0xE7, 0x1A, 0xD1, 0xAE, 0x70, 0xAD, 0x2A, 0xE7, 0xAD, 0x3A, 0xE6,
+    0xAD, 0x4A, 0xE9, 0x3A, 0xFA, 0x3A, 0xEA, 0x1F, 0xE4, 0x9F, 0x76, 0x99, 0x71, 0xAA, 0x76, 0x9D,
+    0x97, 0x6D, 0x97, 0x6D, 0x76, 0xAC, 0xA7, 0x69, 0x97, 0x00, 0x39, 0x72, 0xF7, 0x19, 0xF7, 0x4D,
+    0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x2F, 0xD9, 0x2D, 0x2A, 0xFA, 0x3D, 0x3D, 0xA5, 0xD1, 0x9D,
+    0xA6, 0xD0, 0x9D, 0x97, 0xDA, 0xD7, 0x1D, 0x9D, 0xA7, 0x0D, 0x09, 0xD9, 0x7D, 0x1A, 0xD9, 0x6D,
+    0x2E, 0x95, 0xD3, 0xEA, 0x29, 0xAD, 0xA9, 0x2E, 0xA0, 0x9F, 0xD3, 0xF7, 0x39, 0x97, 0x9A, 0x74,
+    0xE7, 0x39, 0xD7, 0x3A, 0xCA, 0x73, 0xD7, 0x49, 0x60, 0x77, 0x09, 0xAD, 0x91, 0xAF, 0xCA, 0x09,
+    0xF9, 0x19, 0xAF, 0x93, 0xD9, 0x2A, 0xD6, 0xD9, 0x1A, 0xD7, 0xD9, 0x0A, 0xD7, 0x0D, 0xAE, 0x71,
+    0xFC, 0xA7, 0x1D, 0x9A, 0xDA, 0x70, 0xD9, 0x0E, 0x97, 0xD9, 0x1E, 0xA6, 0xD9, 0x2E, 0xA4, 0xAE,
+    0x92, 0xF2, 0xFD, 0x3A, 0xE7, 0x59, 0x10, 0x5A, 0x72, 0xAD, 0x71, 0xF7, 0x9E, 0xA7, 0x09, 0xA7,
+    0x77, 0x09, 0x99, 0x99, 0x99, 0x6F, 0xE9, 0x69, 0xE9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72,
+    0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6C,
+    0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0xAC, 0xA0, 0xAF, 0xFE, 0x9F, 0xFF, 0xC0, 0x74, 0xAC, 0x3A, 0xE1,
+    0xAF, 0x91, 0xCA, 0xA9, 0x76, 0x93, 0xAE, 0x91, 0x9A, 0xE9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D,
+    0x92, 0x9A, 0xEA, 0x9A, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x96, 0xFE, 0x96, 0x9E, 0x97, 0x1A, 0xD7,
+    0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x2A, 0xD6, 0xCA, 0x1A, 0xD6, 0xD1, 0xAD, 0x5A, 0xCA, 0x0A, 0xFF, 0xE9, 0xFF, 0xFC,
+    0x77, 0x39, 0xA9, 0x72, 0xE7, 0x29, 0xD7, 0x29, 0xD7, 0x2D, 0x73, 0x97, 0x39, 0x3A, 0xE9, 0x19,
+    0xAE, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x29, 0xAE, 0xA9, 0xAF, 0xDA, 0x72, 0xAA, 0x5D,
+    0xA4, 0xAC, 0xA4, 0xD9, 0x39, 0xCA, 0x49, 0x93, 0x77, 0x69, 0xCA, 0x19, 0x99, 0x99, 0x99, 0x19,
+    0xD1, 0xFE, 0x90, 0xAC, 0xA2, 0x9E, 0x92, 0xAC, 0x4A, 0xD3, 0xAA, 0x4A, 0xD3, 0x95, 0xAD, 0x72,
+    0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6C,
+    0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0xAC, 0xA0, 0xAF, 0xFE, 0x9F, 0xFF, 0xC0, 0x39, 0x29, 0x1A, 0xE9,
+    0x1D, 0x9A, 0xE9, 0x1D, 0x2D, 0x90, 0x9C, 0xA2, 0xD9, 0x09, 0xC9, 0x2D, 0x90, 0xAC, 0x3D, 0x91,
+    0x93, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96,
+    0xD9, 0x49, 0xAE, 0xA9, 0x1A, 0xFD, 0xA1, 0x99, 0x99, 0x99, 0x96, 0xFE, 0x96, 0x9E, 0x97, 0x1A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD4, 0xAA, 0x3A, 0xD3, 0xAD, 0xA2, 0xAD, 0x3A, 0xDA, 0x2A,
+    0xD4, 0xAA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xCA, 0x1A, 0xD6, 0xD1, 0xAD, 0x5A,
+    0xCA, 0x0A, 0xFF, 0xE9, 0xFF, 0xFC, 0x00, 0x39, 0x7A, 0xE9, 0x59, 0xAE, 0x97, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x92, 0xCA, 0x3D, 0x91, 0xAD, 0xA2,
+    0xD9, 0x1A, 0xD9, 0x2D, 0x92, 0x99, 0x3D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x96,
+    0x9A, 0xEA, 0x93, 0xAF, 0xDA, 0x30, 0x19, 0x99, 0x99, 0x99, 0x70, 0xFE, 0x97, 0x09, 0xE9, 0x73,
+    0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x19, 0x97, 0x0A, 0xD9, 0xDA, 0x70, 0xAF, 0x97, 0x09,
+    0xE9, 0x70, 0xAF, 0xC7, 0x1A, 0xA0, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x6C, 0xA3, 0xAD, 0x6D, 0x3A,
+    0xD5, 0xAC, 0xA2, 0xAF, 0xFE, 0x91, 0xFF, 0xFC, 0x00, 0x49, 0x5A, 0xE9, 0x39, 0xAE, 0x96, 0xD9,
+    0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x0A, 0x4D, 0xAD, 0x4E, 0xA4, 0x9D, 0xA4, 0x9E, 0x93, 0xAF,
+    0x93, 0xC9, 0x0D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x94, 0x9A, 0xEA, 0x91, 0xAF, 0xDA, 0x00,
+    0x72, 0xA7, 0x79, 0xD9, 0x75, 0xAE, 0x75, 0xEA, 0x76, 0xA9, 0x77, 0x74, 0x99, 0x99, 0x96, 0x99,
+    0x99, 0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3, 0xAE, 0xA6, 0xAC, 0x93, 0xAF, 0x95,
+    0xAC, 0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xE4, 0xAC, 0x93, 0xAC, 0x90, 0x9D, 0xA3,
+    0xAC, 0x93, 0xAC, 0x91, 0xAD, 0x3A, 0xC9, 0x3A, 0xC9, 0x2E, 0x2A, 0xC9, 0x3A, 0xC9, 0x29, 0xDA,
+    0x1A, 0xC9, 0x3A, 0xC9, 0x3A, 0xD9, 0x0A, 0xC9, 0x3A, 0xC9, 0x4E, 0x0A, 0xC9, 0x3A, 0xC9, 0x5D,
+    0xAA, 0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F, 0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE, 0x59,
+    0xD9, 0x77, 0x93, 0x77, 0x71, 0x9C, 0xA7, 0x5E, 0x74, 0xAD, 0x74, 0x9D, 0x75, 0x9C, 0x77, 0x77,
+    0x72, 0x9A, 0xD1, 0xAF, 0xA3, 0x9F, 0xAF, 0xE9, 0x49, 0xEA, 0x29, 0xE5, 0xDA, 0x4A, 0xD5, 0xDA,
+    0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49, 0xD5, 0xDA, 0x49,
+    0xD5, 0xDA, 0x49, 0xD4, 0xAE, 0xA3, 0xEA, 0xA1, 0xFD, 0x91, 0xFD, 0x00, 0x99, 0x99, 0x96, 0x99,
+    0x99, 0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3, 0xAE, 0xA6, 0xAC, 0x93, 0xAF, 0x95,
+    0xAC, 0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xE4, 0xAC, 0x93, 0xAC, 0x90, 0x9D, 0xA3,
+    0xAC, 0x93, 0xAC, 0x91, 0xAD, 0x3A, 0xC9, 0x3A, 0xC9, 0x2E, 0x2A, 0xC9, 0x3A, 0xC9, 0x29, 0xDA,
+    0x1A, 0xC9, 0x3A, 0xC9, 0x3A, 0xD9, 0x0A, 0xC9, 0x3A, 0xC9, 0x4E, 0x0A, 0xC9, 0x3A, 0xC9, 0x5D,
+    0xAA, 0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F, 0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE, 0x59,
+    0xD9, 0x77, 0x97, 0x39, 0xA9, 0x77, 0xE7, 0x79, 0xD7, 0x7A, 0xCA, 0x77, 0xD7, 0x70, 0x97, 0x10,
+    0x77, 0x19, 0xAD, 0x1A, 0xFA, 0x39, 0xFA, 0xFE, 0x94, 0x9E, 0xA2, 0x9E, 0x5D, 0xA4, 0xAD, 0x5D,
+    0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4,
+    0x9D, 0x5D, 0xA4, 0x9D, 0x4A, 0xEA, 0x3E, 0xAA, 0x1F, 0xD9, 0x1F, 0xD7, 0x77, 0x09, 0xA9, 0x75,
+    0xAD, 0x75, 0x9D, 0x75, 0x9D, 0x75, 0xD7, 0x69, 0x70, 0x39, 0xA4, 0xAC, 0x71, 0x9D, 0x2D, 0xA7,
+    0x2A, 0xD9, 0xDA, 0x74, 0xAE, 0xA7, 0x6A, 0xD7, 0x77, 0x39, 0x99, 0x99, 0x69, 0x99, 0x99, 0x99,
+    0xFC, 0x95, 0xFD, 0xA0, 0x9F, 0x69, 0xDA, 0x3A, 0xEA, 0x6A, 0xC9, 0x3A, 0xF9, 0x5A, 0xC9, 0x3A,
+    0xC9, 0xAD, 0x5A, 0xC9, 0x3A, 0xC9, 0x0E, 0x4A, 0xC9, 0x3A, 0xC9, 0x09, 0xDA, 0x3A, 0xC9, 0x3A,
+    0xC9, 0x1A, 0xD3, 0xAC, 0x93, 0xAC, 0x92, 0xE2, 0xAC, 0x93, 0xAC, 0x92, 0x9D, 0xA1, 0xAC, 0x93,
+    0xAC, 0x93, 0xAD, 0x90, 0xAC, 0x93, 0xAC, 0x94, 0xE0, 0xAC, 0x93, 0xAC, 0x95, 0xDA, 0xAC, 0x93,
+    0xAC, 0x95, 0x9F, 0x93, 0xAC, 0x96, 0xF9, 0x2A, 0xEA, 0x95, 0xE9, 0x1F, 0xE5, 0x9D, 0x97, 0x79,
+    0x30, 0x77, 0x49, 0xC9, 0x2A, 0xC9, 0x70, 0xD1, 0x9C, 0xA7, 0x1A, 0xD9, 0xD7, 0x3A, 0xE9, 0x74,
+    0xAC, 0xA7, 0x77, 0x77, 0x19, 0xAD, 0x1A, 0xFA, 0x39, 0xFA, 0xFE, 0x94, 0x9E, 0xA2, 0x9E, 0x5D,
+    0xA4, 0xAD, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4,
+    0x9D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0x9D, 0x4A, 0xEA, 0x3E, 0xAA, 0x1F, 0xD9, 0x1F, 0xD0, 0x19,
+    0x97, 0x73, 0xAD, 0x97, 0x73, 0xDA, 0x77, 0x3D, 0xA7, 0x73, 0xD9, 0x77, 0x3D, 0x77, 0x3A, 0xC9,
+    0x29, 0xAD, 0x09, 0xFC, 0x94, 0xCA, 0x2A, 0xF9, 0xFE, 0x97, 0x29, 0xEA, 0x29, 0xDA, 0x73, 0xDA,
+    0x4E, 0x73, 0xD9, 0x4A, 0xD7, 0x3D, 0x94, 0xAD, 0x73, 0xD9, 0x4A, 0xD7, 0x3D, 0x94, 0xAD, 0x73,
+    0xD9, 0x4A, 0xD7, 0x3D, 0x94, 0xAD, 0x73, 0xD9, 0x4A, 0xD7, 0x2A, 0xEA, 0x29, 0xEA, 0x97, 0xFD,
+    0x2F, 0xD0, 0x99, 0x99, 0x96, 0x99, 0x99, 0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3,
+    0xAE, 0xA6, 0xAC, 0x93, 0xAF, 0x95, 0xAC, 0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xDA,
+    0x4A, 0xC9, 0x3A, 0xC9, 0x09, 0xD9, 0x3A, 0xC9, 0x3A, 0xC9, 0x1A, 0xD3, 0xAC, 0x93, 0xAC, 0x92,
+    0xDA, 0x2A, 0xC9, 0x3A, 0xC9, 0x29, 0xD9, 0x1A, 0xC9, 0x3A, 0xC9, 0x3A, 0xD1, 0xAC, 0x93, 0xAC,
+    0x94, 0xDA, 0x0A, 0xC9, 0x3A, 0xC9, 0x5D, 0x9A, 0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F,
+    0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE, 0x59, 0xD9, 0x77, 0xD7, 0x39, 0xA1, 0x9D, 0x73, 0xDA, 0x9D,
+    0xA7, 0x3F, 0xD7, 0x5A, 0xDA, 0x40, 0x77, 0x9A, 0xD1, 0xAF, 0xA1, 0x9F, 0xAF, 0xE9, 0x29, 0xEA,
+    0x29, 0xE3, 0xDA, 0x4A, 0xD3, 0xDA, 0x49, 0xD3, 0xDA, 0x49, 0xD3, 0xDA, 0x49, 0xD3, 0xDA, 0x49,
+    0xD3, 0xDA, 0x49, 0xD3, 0xDA, 0x49, 0xD3, 0xDA, 0x49, 0xD2, 0xAE, 0xA3, 0x9D, 0x1F, 0xD9, 0x29,
+    0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x19, 0xE7, 0x1A, 0xE7, 0x2A, 0xCA, 0x30, 0x59, 0x99,
+    0x99, 0x97, 0x2F, 0xEA, 0x71, 0xFE, 0x97, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6,
+    0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71,
+    0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71,
+    0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA,
+    0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x2F, 0xE9, 0x3A, 0xFE, 0x77, 0x77, 0x74, 0x9F, 0xCA,
+    0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC, 0xA6, 0xFC,
+    0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69,
+    0x99, 0x94, 0x49, 0x77, 0x9C, 0xA3, 0xAA, 0x71, 0xE9, 0x9D, 0x97, 0x19, 0xFC, 0xA7, 0x49, 0x99,
+    0x77, 0x77, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09, 0xAF, 0x4E, 0x95, 0xAE, 0x2A,
+    0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7, 0x2E, 0x0A, 0xD7, 0x2A, 0xD0,
+    0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD,
+    0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70,
+    0x76, 0x9C, 0x4A, 0x93, 0x9D, 0x91, 0xAC, 0x5F, 0xDA, 0x69, 0xAC, 0xA9, 0x77, 0x77, 0x09, 0xFC,
+    0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A, 0xD6, 0xDA, 0xDA, 0x6F, 0xCA, 0x6F,
+    0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1, 0xAE, 0xA9, 0xAE, 0x39, 0xFD, 0xA6,
+    0x99, 0x99, 0x40, 0x77, 0x71, 0xAA, 0x29, 0xC9, 0x70, 0xE1, 0x9D, 0xA7, 0xE9, 0x09, 0xE7, 0xE1,
+    0x9D, 0xA7, 0x0C, 0x92, 0xAA, 0x77, 0x75, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09,
+    0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7,
+    0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA,
+    0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF,
+    0xEA, 0x72, 0x99, 0x99, 0x70, 0x77, 0x1A, 0xC1, 0x9C, 0x95, 0xD1, 0xDA, 0x4D, 0xA0, 0x9D, 0x49,
+    0xD1, 0xD9, 0x4A, 0xC2, 0xC9, 0x77, 0x77, 0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D,
+    0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1,
+    0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69, 0x99, 0x94, 0x79, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x6A, 0xFF, 0xFE, 0xA3, 0xAE, 0xA9, 0x99, 0xEA, 0xAA, 0xAA, 0xDA, 0x2A, 0xDA, 0x4D,
+    0xA5, 0xCA, 0x19, 0xD9, 0x5D, 0xA5, 0xC9, 0x1E, 0x6D, 0xA7, 0x09, 0xD9, 0x6D, 0xA7, 0x0A, 0xD7,
+    0xDA, 0x70, 0xAD, 0x7E, 0xAA, 0xF2, 0xE7, 0xFF, 0xC2, 0xE7, 0xDA, 0x70, 0xAD, 0x7D, 0xA7, 0x09,
+    0xD9, 0x6D, 0xA7, 0x1E, 0x6D, 0xA6, 0xC1, 0xAD, 0xA5, 0xDA, 0x5A, 0xC2, 0xF9, 0x3D, 0xA5, 0xD3,
+    0xAF, 0xAA, 0xAF, 0xFE, 0x5A, 0xFF, 0xFE, 0xA7, 0x19, 0x97, 0x30, 0x77, 0x7A, 0xFC, 0x92, 0xFC,
+    0xA3, 0xEA, 0xAE, 0x99, 0xEA, 0xEA, 0x1D, 0xA3, 0xAF, 0x92, 0x9D, 0x09, 0xD5, 0xF4, 0xDA, 0xAD,
+    0x59, 0xDA, 0x4D, 0xAD, 0xA6, 0xFF, 0xDA, 0xDA, 0x6F, 0xFD, 0x9D, 0xA6, 0xD9, 0x7E, 0x59, 0xD9,
+    0x7A, 0xD5, 0xAE, 0x79, 0xE3, 0x9F, 0xC7, 0xAE, 0xA9, 0xAD, 0xAF, 0xFC, 0x91, 0xAF, 0xD9, 0x1A,
+    0xFD, 0xA4, 0x99, 0x97, 0x99, 0x30, 0x79, 0x97, 0x5A, 0xD7, 0x39, 0xF7, 0x29, 0xE9, 0x73, 0x99,
+    0x77, 0x75, 0x99, 0xAA, 0xAA, 0x99, 0x6F, 0xFE, 0x95, 0x9E, 0x19, 0xAE, 0x95, 0xAD, 0x4E, 0x5A,
+    0xD4, 0xAD, 0x5A, 0xD4, 0xAD, 0x5A, 0xD4, 0xAD, 0x5A, 0xD4, 0xD9, 0x5A, 0xD2, 0xAD, 0xA6, 0xAF,
+    0xE9, 0x7A, 0xFD, 0x71, 0xAD, 0x1E, 0x70, 0xAD, 0x19, 0xDA, 0x7A, 0xD2, 0xAD, 0xA6, 0xAD, 0x3E,
+    0x95, 0xAD, 0x4E, 0xA3, 0xAE, 0xAA, 0x29, 0xEA, 0x1F, 0xE9, 0x3F, 0x75, 0x99, 0x10, 0x77, 0x2D,
+    0x70, 0xE7, 0xAD, 0x97, 0xD9, 0x79, 0xC7, 0x77, 0x69, 0xAD, 0x1A, 0xE0, 0x9F, 0x0A, 0xF2, 0x9F,
+    0xA9, 0xAA, 0x3E, 0x97, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70,
+    0xDA, 0x69, 0xAE, 0xAA, 0x92, 0x9F, 0xEA, 0x20, 0x19, 0x9A, 0xAA, 0xA9, 0x96, 0xFF, 0xE9, 0x59,
+    0xE1, 0x9A, 0xE9, 0x5A, 0xD4, 0xE5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD, 0x4A, 0xD5, 0xAD,
+    0x4D, 0x95, 0xAD, 0x2A, 0xDA, 0x6A, 0xFE, 0x97, 0xAF, 0xD7, 0x1A, 0xD1, 0xE7, 0x0A, 0xD1, 0x9D,
+    0xA7, 0xAD, 0x2A, 0xDA, 0x6A, 0xD3, 0xE9, 0x5A, 0xD4, 0xEA, 0x3A, 0xEA, 0xA2, 0x9E, 0xA1, 0xFE,
+    0x93, 0xF7, 0x59, 0x97, 0x0A, 0xA7, 0x6E, 0x75, 0xAD, 0x75, 0xAC, 0xA7, 0x5D, 0x76, 0x97, 0x00,
+    0x74, 0x9A, 0xD1, 0xAE, 0x09, 0xF0, 0xAF, 0x29, 0xFA, 0x9A, 0xA3, 0xE9, 0x7D, 0xA7, 0x0D, 0xA7,
+    0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA6, 0x9A, 0xEA, 0xA9, 0x29, 0xFE, 0xA7,
+    0x71, 0xAA, 0x71, 0xE7, 0x0A, 0xD7, 0x0A, 0xCA, 0x79, 0xD7, 0x09, 0x97, 0x1A, 0xA4, 0xCA, 0x7D,
+    0xA1, 0x9D, 0x97, 0x0D, 0xA9, 0xD9, 0x72, 0xF9, 0x74, 0xD9, 0x77, 0x73, 0x99, 0xAA, 0xAA, 0x99,
+    0x6F, 0xFE, 0x95, 0x9E, 0x19, 0xAE, 0x95, 0xAD, 0x4E, 0x5A, 0xD4, 0xAD, 0x5A, 0xD4, 0xAD, 0x5A,
+    0xD4, 0xAD, 0x5A, 0xD4, 0xD9, 0x5A, 0xD2, 0xAD, 0xA6, 0xAF, 0xE9, 0x7A, 0xFD, 0x71, 0xAD, 0x1E,
+    0x70, 0xAD, 0x19, 0xDA, 0x7A, 0xD2, 0xAD, 0xA6, 0xAD, 0x3E, 0x95, 0xAD, 0x4E, 0xA3, 0xAE, 0xAA,
+    0x29, 0xEA, 0x1F, 0xE9, 0x3F, 0x75, 0x99, 0x10, 0x74, 0x9C, 0x92, 0x9C, 0xA3, 0xD9, 0x09, 0xD4,
+    0x9D, 0x9D, 0x69, 0xE9, 0x7A, 0xD7, 0x77, 0x59, 0xAD, 0x1A, 0xE0, 0x9F, 0x0A, 0xF2, 0x9F, 0xA9,
+    0xAA, 0x3E, 0x97, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA,
+    0x69, 0xAE, 0xAA, 0x92, 0x9F, 0xEA, 0x20, 0x7A, 0x71, 0xDA, 0x6A, 0xE9, 0x5E, 0xA9, 0x6A, 0x97,
+    0x75, 0x9A, 0xA9, 0x94, 0x9F, 0xF1, 0x9E, 0x99, 0x9A, 0xD1, 0xDA, 0x4D, 0x1D, 0x94, 0xD1, 0xD9,
+    0x4C, 0x91, 0xE9, 0x7A, 0xEA, 0x7A, 0xFA, 0x69, 0xFC, 0x96, 0x9F, 0x97, 0xAE, 0x1A, 0x59, 0xD9,
+    0xD6, 0xD9, 0xD9, 0x49, 0xD9, 0xE4, 0xE0, 0xAE, 0xAA, 0xAE, 0x2A, 0xFE, 0x59, 0x99, 0x94, 0x77,
+    0xD6, 0x9D, 0x95, 0xDA, 0x5D, 0xA6, 0xCA, 0x77, 0x71, 0x9F, 0xCA, 0x19, 0xD9, 0x9A, 0xD9, 0x0D,
+    0x3A, 0xC9, 0x0D, 0x4C, 0x1E, 0x95, 0xAF, 0x94, 0xAF, 0xC9, 0x4A, 0xF1, 0x93, 0xAD, 0xA9, 0xC4,
+    0xAC, 0xA9, 0xCA, 0x3A, 0xCA, 0x9D, 0xA9, 0x9A, 0xD1, 0xFE, 0x49, 0x99, 0x30, 0x49, 0xA7, 0x09,
+    0xE9, 0x59, 0xDA, 0xD9, 0x39, 0xD1, 0x9D, 0x3A, 0xC3, 0x9C, 0x77, 0x19, 0xAA, 0x99, 0x49, 0xFF,
+    0x19, 0xE9, 0x99, 0xAD, 0x1D, 0xA4, 0xD1, 0xD9, 0x4D, 0x1D, 0x94, 0xC9, 0x1E, 0x97, 0xAE, 0xA7,
+    0xAF, 0xA6, 0x9F, 0xC9, 0x69, 0xF9, 0x7A, 0xE1, 0xA5, 0x9D, 0x9D, 0x6D, 0x9D, 0x94, 0x9D, 0x9E,
+    0x4E, 0x0A, 0xEA, 0xAA, 0xE2, 0xAF, 0xE5, 0x99, 0x99, 0x40, 0x3D, 0x95, 0xAE, 0x93, 0x9D, 0xAD,
+    0x3D, 0x90, 0xAC, 0xA1, 0xAC, 0x92, 0xD7, 0x76, 0x9F, 0xCA, 0x19, 0xD9, 0x9A, 0xD9, 0x0D, 0x3A,
+    0xC9, 0x0D, 0x4C, 0x1E, 0x95, 0xAF, 0x94, 0xAF, 0xC9, 0x4A, 0xF1, 0x93, 0xAD, 0xA9, 0xC4, 0xAC,
+    0xA9, 0xCA, 0x3A, 0xCA, 0x9D, 0xA9, 0x9A, 0xD1, 0xFE, 0x49, 0x99, 0x30, 0x39, 0xAA, 0x99, 0x49,
+    0xFF, 0x19, 0xE9, 0x99, 0xAD, 0x1D, 0xA4, 0xD1, 0xD9, 0x4D, 0x1D, 0x94, 0xC9, 0x1E, 0x97, 0xAE,
+    0xA7, 0xAF, 0xA6, 0x9F, 0xC9, 0x69, 0xF9, 0x7A, 0xE1, 0xA5, 0x9D, 0x9D, 0x6D, 0x9D, 0x94, 0x9D,
+    0x9E, 0x4E, 0x0A, 0xEA, 0xAA, 0xE2, 0xAF, 0xE5, 0x99, 0x99, 0x70, 0x9A, 0xA9, 0x7A, 0xE7, 0x1D,
+    0x97, 0xAD, 0x7A, 0xD7, 0x09, 0x95, 0x73, 0x9F, 0xCA, 0x19, 0xD9, 0x9A, 0xD9, 0x0D, 0x3A, 0xC9,
+    0x0D, 0x4C, 0x1E, 0x95, 0xAF, 0x94, 0xAF, 0xC9, 0x4A, 0xF1, 0x93, 0xAD, 0xA9, 0xC4, 0xAC, 0xA9,
+    0xCA, 0x3A, 0xCA, 0x9D, 0xA9, 0x9A, 0xD1, 0xFE, 0x49, 0x99, 0x69, 0xAA, 0x6A, 0xE7, 0xD6, 0x9D,
+    0x59, 0xD6, 0x99, 0x40, 0x1A, 0x49, 0xC9, 0x2D, 0x91, 0xAD, 0x39, 0xD9, 0xAD, 0x59, 0xF7, 0x9D,
+    0x77, 0x49, 0xAA, 0x99, 0x49, 0xFF, 0x19, 0xE9, 0x99, 0xAD, 0x1D, 0xA4, 0xD1, 0xD9, 0x4D, 0x1D,
+    0x94, 0xC9, 0x1E, 0x97, 0xAE, 0xA7, 0xAF, 0xA6, 0x9F, 0xC9, 0x69, 0xF9, 0x7A, 0xE1, 0xA5, 0x9D,
+    0x9D, 0x6D, 0x9D, 0x94, 0x9D, 0x9E, 0x4E, 0x0A, 0xEA, 0xAA, 0xE2, 0xAF, 0xE5, 0x99, 0x99, 0x40,
+    0x72, 0xD3, 0xD1, 0xAC, 0xA1, 0xD9, 0x2D, 0x9A, 0xCA, 0x4F, 0x59, 0xD7, 0x77, 0x19, 0xFC, 0xA1,
+    0x9D, 0x99, 0xAD, 0x90, 0xD3, 0xAC, 0x90, 0xD4, 0xC1, 0xE9, 0x5A, 0xF9, 0x4A, 0xFC, 0x94, 0xAF,
+    0x19, 0x3A, 0xDA, 0x9C, 0x4A, 0xCA, 0x9C, 0xA3, 0xAC, 0xA9, 0xDA, 0x99, 0xAD, 0x1F, 0xE4, 0x99,
+    0x93, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xE1, 0xDA, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xD1, 0xD3, 0xDA, 0x3D, 0x1D, 0x3D, 0xA3, 0xD1, 0xA9, 0x3D, 0xA3, 0xA9, 0x7D, 0xA7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D,
+    0xA7, 0x39, 0xAE, 0xAA, 0x70, 0xFF, 0x97, 0x77, 0x3A, 0xA9, 0x74, 0x9E, 0x97, 0x5D, 0xA7, 0x5D,
+    0x97, 0x39, 0xD9, 0x75, 0x97, 0x00, 0x74, 0xD6, 0x9D, 0x69, 0xD5, 0xAF, 0xE0, 0xFF, 0xC2, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0x9D, 0x69, 0xEA, 0xAD, 0x2A,
+    0xFC, 0x94, 0x99, 0x69, 0xAA, 0x6A, 0xE7, 0xD6, 0x9D, 0x5A, 0xD6, 0x99, 0x30, 0x3A, 0xA4, 0xCA,
+    0x7D, 0xA1, 0x9D, 0x97, 0x0D, 0xA9, 0xD9, 0x72, 0xF9, 0x74, 0xD9, 0x77, 0x70, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFE, 0x1D, 0xAA, 0xAA, 0xEA, 0xAA, 0xAD, 0x1D, 0x3D, 0xA3,
+    0xD1, 0xD3, 0xDA, 0x3D, 0x1A, 0x93, 0xDA, 0x3A, 0x97, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA,
+    0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x73, 0x9A, 0xEA, 0xA7,
+    0x0F, 0xF9, 0x30, 0x6C, 0x97, 0xD6, 0x9C, 0xA6, 0x9C, 0x93, 0xD0, 0x9C, 0x39, 0xD1, 0x93, 0x9D,
+    0x5A, 0xFE, 0x0F, 0xFC, 0x2A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x69, 0xD6, 0x9E, 0xAA, 0xD2, 0xAF, 0xC9, 0x49, 0x92, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xFF, 0xE1, 0xDA, 0xAA, 0xAE, 0xAA, 0xAA, 0xD1, 0xD3, 0xDA, 0x3D, 0x1D, 0x3D, 0xA3,
+    0xD1, 0xA9, 0x3D, 0xA3, 0xA9, 0x7D, 0xA7, 0x5D, 0xA7, 0x39, 0x9E, 0x99, 0x70, 0xAF, 0xE9, 0x72,
+    0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x73, 0x9A, 0xEA, 0xA7, 0x0F,
+    0xF9, 0x30, 0x74, 0xD6, 0x9D, 0x69, 0xD5, 0xAF, 0xE0, 0xFF, 0xC2, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A,
+    0xD4, 0xFF, 0xA2, 0xAD, 0x6A, 0xD6, 0xAD, 0x69, 0xD6, 0x9E, 0xAA, 0xD2, 0xAF, 0xC9, 0x49, 0x92,
+    0x69, 0x92, 0x97, 0x3A, 0xE1, 0xCA, 0x72, 0xDA, 0xFC, 0x72, 0xCA, 0x09, 0xE9, 0x77, 0x77, 0x73,
+    0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0, 0x9A, 0xDA, 0x69, 0xE4, 0xD9,
+    0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6, 0xFC, 0xAF, 0xC7, 0x0A, 0xFE,
+    0xA7, 0x49, 0x99, 0x70, 0x77, 0x4A, 0xDA, 0x1C, 0x97, 0x0F, 0xAA, 0xCA, 0x70, 0xC9, 0x0A, 0xE9,
+    0x70, 0x92, 0x9A, 0x97, 0x77, 0x77, 0x0A, 0xE3, 0xAA, 0xDA, 0x2A, 0xF3, 0xF9, 0x4A, 0xD5, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A,
+    0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5,
+    0x99, 0x97, 0x00, 0x69, 0x99, 0x99, 0x97, 0x3F, 0xF7, 0x2F, 0xE9, 0x77, 0x77, 0x73, 0x99, 0x99,
+    0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0, 0x9A, 0xDA, 0x69, 0xE4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4,
+    0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6, 0xFC, 0xAF, 0xC7, 0x0A, 0xFE, 0xA7, 0x49,
+    0x99, 0x70, 0x3F, 0xEA, 0x79, 0xFE, 0x97, 0x77, 0x77, 0x77, 0x0A, 0xE3, 0xAA, 0xDA, 0x2A, 0xF3,
+    0xF9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9,
+    0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x00, 0x77, 0x70, 0xCA, 0x39, 0xC7, 0x2E, 0xA9, 0xAC, 0xA7,
+    0x29, 0xFC, 0xA7, 0x59, 0x99, 0x77, 0x73, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93,
+    0xFD, 0xA0, 0x9A, 0xDA, 0x69, 0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4,
+    0x9D, 0xA6, 0xFC, 0xAF, 0xC7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x4C, 0x93, 0x9A, 0x70,
+    0xDA, 0x1A, 0xC9, 0x70, 0xAF, 0xD7, 0x29, 0xAC, 0xA9, 0x77, 0x77, 0x71, 0xAE, 0x3A, 0xAD, 0xA2,
+    0xAF, 0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD,
+    0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9, 0x5F, 0xAF,
+    0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70, 0x70, 0xAA, 0x76, 0x9F, 0x97, 0x4C, 0xA1, 0xD7,
+    0x4C, 0xA1, 0xD7, 0x4D, 0x1C, 0xA7, 0x4A, 0xF7, 0x79, 0x97, 0x09, 0x99, 0x99, 0x95, 0x99, 0x99,
+    0x99, 0x9F, 0xD9, 0x3F, 0xDA, 0x09, 0xAD, 0xA6, 0x9E, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0xA7, 0xD9, 0x4E,
+    0x69, 0xD5, 0x9E, 0x49, 0xDA, 0x6F, 0xCA, 0xFC, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x59, 0xA9,
+    0x74, 0xAF, 0x73, 0xCA, 0x09, 0xCA, 0x71, 0x9C, 0x91, 0xD7, 0x19, 0xCA, 0x1C, 0xA7, 0x2F, 0xC7,
+    0x4A, 0xAA, 0x77, 0x71, 0xAE, 0x3A, 0xAD, 0xA2, 0xAF, 0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94,
+    0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9, 0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70,
+    0x77, 0x73, 0xAC, 0x3C, 0x97, 0x1A, 0xD2, 0xE7, 0x0E, 0x90, 0x9E, 0x70, 0xE1, 0x9D, 0xA7, 0x1C,
+    0x92, 0x9A, 0x77, 0x71, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD, 0x93, 0xFD, 0xA0, 0x9A,
+    0xDA, 0x69, 0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC,
+    0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9,
+    0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59, 0xE4, 0x9D, 0xA6, 0xFC,
+    0xAF, 0xC7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x69, 0xC9, 0x1C, 0x97, 0x1D, 0xA0, 0xAD,
+    0x70, 0x9D, 0x1D, 0x97, 0x0D, 0x1A, 0xCA, 0x70, 0x9C, 0x91, 0xCA, 0x77, 0x77, 0x70, 0xAE, 0x3A,
+    0xAD, 0xA2, 0xAF, 0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9,
+    0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70, 0x09, 0x99, 0x99, 0x95, 0x99, 0x99,
+    0x99, 0x9F, 0xD9, 0x3F, 0xDA, 0x09, 0xAD, 0xA6, 0x9E, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA,
+    0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97,
+    0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0xA7, 0xD9, 0x4E,
+    0x69, 0xD5, 0x9E, 0x49, 0xDA, 0x6F, 0xCA, 0xFC, 0x70, 0xAF, 0xEA, 0x74, 0x9A, 0xD7, 0x7D, 0x77,
+    0x9D, 0x77, 0x9E, 0xA9, 0x75, 0xAE, 0xA7, 0x77, 0x77, 0x1A, 0xE3, 0xAA, 0xDA, 0x2A, 0xF3, 0xF9,
+    0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A,
+    0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F,
+    0xCA, 0x09, 0xF5, 0x99, 0x93, 0xD9, 0x74, 0xAC, 0x97, 0x5D, 0x76, 0xE9, 0x97, 0x39, 0xF7, 0x71,
+    0x74, 0xAA, 0x77, 0x70, 0xEA, 0x77, 0x6A, 0xFC, 0x77, 0x4A, 0xCA, 0x1D, 0xA7, 0x73, 0xCA, 0x3A,
+    0xA7, 0x77, 0x76, 0x99, 0x99, 0x99, 0x97, 0x49, 0x99, 0x99, 0x90, 0x9F, 0xE4, 0xAA, 0x4A, 0xFD,
+    0x19, 0xAE, 0x95, 0xD9, 0x5A, 0xD9, 0x4E, 0x59, 0xDA, 0x5A, 0xD5, 0xAD, 0x5F, 0x5D, 0xA5, 0x9D,
+    0x94, 0xF5, 0xD7, 0xDA, 0x39, 0xCA, 0xDA, 0x39, 0xD7, 0xE3, 0xAC, 0x9A, 0xD3, 0xAC, 0xA7, 0x9D,
+    0x3D, 0x09, 0xD3, 0xD9, 0x70, 0xD9, 0x19, 0xCA, 0x1D, 0x92, 0xD7, 0x1D, 0xA1, 0xAC, 0x91, 0xAD,
+    0x1A, 0xCA, 0x71, 0xAD, 0x1D, 0x29, 0xD1, 0xD9, 0x72, 0xD1, 0xCA, 0x3D, 0x90, 0xD7, 0x3D, 0x9A,
+    0xC9, 0x3A, 0xCA, 0x9C, 0xA7, 0x3A, 0xCA, 0xD4, 0x9D, 0xAC, 0x97, 0x4F, 0x5F, 0x75, 0xE9, 0x5A,
+    0xDA, 0x75, 0xAD, 0x69, 0xD9, 0x77, 0x77, 0x20, 0x71, 0xD7, 0x72, 0xF7, 0x70, 0xAF, 0xC7, 0x7D,
+    0x1D, 0x97, 0x5D, 0x92, 0xCA, 0x77, 0x77, 0x77, 0x29, 0xFC, 0xA2, 0x9C, 0x3A, 0xFA, 0x0F, 0xA9,
+    0x2A, 0xC9, 0x29, 0xAE, 0x91, 0xDA, 0x4E, 0x4D, 0x92, 0xAD, 0x39, 0xE3, 0x9D, 0x4D, 0x92, 0xAE,
+    0x92, 0xAC, 0xA4, 0xDA, 0x2D, 0xAD, 0x2D, 0x5A, 0xD1, 0x9C, 0x99, 0xD2, 0xD6, 0xD1, 0xAC, 0x1D,
+    0x90, 0x9C, 0x96, 0xDA, 0x0D, 0x1A, 0xD0, 0xD7, 0x9D, 0x9C, 0x92, 0xD0, 0xCA, 0x70, 0xF3, 0xF9,
+    0x70, 0xAD, 0xA3, 0x9E, 0x71, 0x9D, 0x94, 0xDA, 0x77, 0x72, 0x69, 0xA9, 0x75, 0xEA, 0x73, 0xDA,
+    0xDA, 0x71, 0xDA, 0x1D, 0x97, 0x9C, 0x93, 0xC9, 0x77, 0x59, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99,
+    0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E, 0xA5, 0xAD, 0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3,
+    0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70, 0xE1, 0xD7, 0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74,
+    0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x30,
+    0x5A, 0xCA, 0x72, 0xAE, 0x97, 0x1D, 0xAD, 0x70, 0xD9, 0x0A, 0xCA, 0x69, 0xCA, 0x2A, 0xC7, 0x77,
+    0x71, 0x9F, 0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91, 0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4,
+    0xD9, 0x3D, 0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA, 0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D,
+    0x9D, 0x71, 0xAE, 0xA7, 0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x2A, 0xD9, 0x69, 0x9A,
+    0xEA, 0x7A, 0xFC, 0x70, 0x9D, 0xA9, 0x71, 0x39, 0xCA, 0x2A, 0xA7, 0x0E, 0x19, 0xDA, 0x7E, 0x19,
+    0xD9, 0x77, 0x77, 0x69, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E,
+    0xA5, 0xAD, 0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3, 0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70,
+    0xE1, 0xD7, 0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75,
+    0xAD, 0x75, 0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x30, 0x70, 0x99, 0x73, 0xAD, 0x71, 0x9F,
+    0x70, 0xAE, 0x97, 0x19, 0x97, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFF, 0xE9, 0x19,
+    0xDA, 0xAA, 0xAA, 0xAE, 0x91, 0xAC, 0xA5, 0xDA, 0x2A, 0xC5, 0xE4, 0xA4, 0xAD, 0x97, 0x19, 0xDA,
+    0x72, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA5, 0xAC,
+    0x2E, 0x6D, 0x1A, 0xD9, 0x59, 0xD1, 0xFF, 0xFA, 0x1F, 0xFF, 0x97, 0x70, 0x77, 0x29, 0xC9, 0x70,
+    0xDA, 0x7E, 0x79, 0xD7, 0x0A, 0xC7, 0x77, 0x59, 0xFF, 0xC1, 0xAF, 0xFC, 0x90, 0xAC, 0x4D, 0xA1,
+    0xAC, 0x3E, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7D, 0xA7, 0xE3, 0x99, 0x1A, 0xD4, 0xD0, 0x9D, 0x93,
+    0x9C, 0xA0, 0xEA, 0xAA, 0xAE, 0xA0, 0xFF, 0xD7, 0x40, 0x69, 0x74, 0xE7, 0x29, 0xE7, 0x3D, 0xA7,
+    0x77, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFE, 0x91, 0x9D, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x1A, 0xCA, 0x5D, 0xA2, 0xAC, 0x5E, 0x4A, 0x4A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97,
+    0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x5A, 0xC2, 0xE6, 0xD1, 0xAD, 0x95,
+    0x9D, 0x1F, 0xFF, 0xA1, 0xFF, 0xF9, 0x77, 0x4A, 0xCA, 0x70, 0xE7, 0x0E, 0x71, 0x97, 0x77, 0x59,
+    0xFF, 0xC1, 0xAF, 0xFC, 0x90, 0xAC, 0x4D, 0xA1, 0xAC, 0x3E, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7D,
+    0xA7, 0xE3, 0x99, 0x1A, 0xD4, 0xD0, 0x9D, 0x93, 0x9C, 0xA0, 0xEA, 0xAA, 0xAE, 0xA0, 0xFF, 0xD7,
+    0x40, 0x2A, 0xA4, 0xCA, 0x5D, 0xA1, 0x9D, 0x96, 0xDA, 0x9D, 0x97, 0x0F, 0x97, 0x2D, 0x97, 0x76,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFE, 0x91, 0x9D, 0xAA, 0xAA, 0xAA, 0xE9, 0x1A, 0xCA,
+    0x5D, 0xA2, 0xAC, 0x5E, 0x4A, 0x4A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x19, 0xDA,
+    0x72, 0xE7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x5A, 0xC2, 0xE6, 0xD1, 0xAD, 0x95, 0x9D, 0x1F,
+    0xFF, 0xA1, 0xFF, 0xF9, 0x77, 0x75, 0xAC, 0x3A, 0xC9, 0x29, 0xD1, 0xAC, 0xA4, 0xAD, 0x9D, 0x6F,
+    0x70, 0xD9, 0x77, 0x74, 0x9F, 0xFC, 0x1A, 0xFF, 0xC9, 0x0A, 0xC4, 0xDA, 0x1A, 0xC3, 0xE7, 0xAD,
+    0x79, 0xD9, 0x7D, 0xA7, 0xDA, 0x7E, 0x39, 0x91, 0xAD, 0x4D, 0x09, 0xD9, 0x39, 0xCA, 0x0E, 0xAA,
+    0xAA, 0xEA, 0x0F, 0xFD, 0x74, 0x69, 0x99, 0x6A, 0xFC, 0xA3, 0xAD, 0x99, 0xE3, 0xD3, 0xA9, 0x2A,
+    0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D,
+    0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0xAE, 0xAA, 0x4F, 0xE9, 0x20,
+    0x77, 0x99, 0x77, 0x0D, 0xA7, 0x7D, 0xA5, 0x9A, 0xAA, 0xA9, 0x29, 0xD4, 0xAF, 0xFA, 0x9D, 0x93,
+    0xEA, 0x90, 0x9A, 0xFC, 0x4E, 0x95, 0xAE, 0x3A, 0xD9, 0x7E, 0x92, 0xE7, 0x09, 0xE1, 0x9D, 0x97,
+    0x1E, 0x1A, 0xD7, 0x2E, 0x1A, 0xD7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x97,
+    0x1E, 0x19, 0xDA, 0x71, 0xDA, 0x2E, 0x70, 0xAD, 0x92, 0xEA, 0x7E, 0x4E, 0xA4, 0x9E, 0x59, 0xFA,
+    0xAA, 0xF7, 0x0A, 0xFE, 0xA7, 0x39, 0x99, 0x97, 0x00, 0x72, 0x9A, 0x97, 0x39, 0xD7, 0x3A, 0xD3,
+    0x9F, 0xCA, 0x9D, 0x92, 0xFA, 0xFC, 0x92, 0xAD, 0x39, 0xE2, 0x9D, 0x5A, 0xD9, 0x1A, 0xD6, 0xDA,
+    0x1D, 0xA6, 0xE1, 0xDA, 0x6E, 0x1D, 0xA6, 0xDA, 0x1E, 0x6D, 0xA1, 0xAD, 0x95, 0xD3, 0xE4, 0xDA,
+    0x3A, 0xEA, 0x9A, 0xE5, 0x9F, 0xDA, 0x70, 0x99, 0x99, 0x60, 0x39, 0x9A, 0xAA, 0xA9, 0x94, 0x9F,
+    0xFE, 0xA1, 0x9D, 0xA9, 0xDA, 0x19, 0xF0, 0xDA, 0x1D, 0x93, 0xAD, 0x9A, 0xCA, 0x1D, 0x94, 0xDA,
+    0x09, 0x91, 0xD9, 0x4D, 0xA4, 0xD9, 0x4D, 0xA4, 0xD9, 0x39, 0xD5, 0xD9, 0x29, 0xDA, 0x5E, 0xAA,
+    0xF6, 0xFD, 0xA9, 0x7D, 0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x29, 0xAE, 0xAA,
+    0x79, 0xFE, 0x50, 0x69, 0x99, 0x71, 0xAF, 0xCA, 0x6A, 0xD9, 0x9E, 0x6D, 0x3A, 0x95, 0xAD, 0x73,
+    0xDA, 0x73, 0xDA, 0x73, 0xD9, 0x0A, 0xF9, 0x4D, 0xAF, 0xE9, 0x3E, 0xA2, 0x9E, 0x3D, 0xA4, 0xAD,
+    0x92, 0xDA, 0x5D, 0xA2, 0xDA, 0x5D, 0xA2, 0xDA, 0x5D, 0xA2, 0xDA, 0x5D, 0xA2, 0xDA, 0x5D, 0x92,
+    0xDA, 0x4A, 0xD3, 0xDA, 0x39, 0xD9, 0x3F, 0xAA, 0xEA, 0x4F, 0xF9, 0x5D, 0x97, 0x3D, 0x97, 0x3D,
+    0xA7, 0x3D, 0xA7, 0x1A, 0xFD, 0x7A, 0xAA, 0xAA, 0xAA, 0x60, 0x74, 0xD6, 0x9D, 0x69, 0xD5, 0xAF,
+    0xE0, 0xFF, 0xC2, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0x9D,
+    0x69, 0xEA, 0xE2, 0xAF, 0xD4, 0x99, 0x9C, 0xA6, 0x9C, 0xA6, 0xAC, 0x92, 0xD0, 0x9D, 0x3F, 0xC9,
+    0x4A, 0xAA, 0x20, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xDA, 0xEA, 0xAA, 0xEA,
+    0xAA, 0xFD, 0x3D, 0xA2, 0x9F, 0xC3, 0xDA, 0x3C, 0xA9, 0xDA, 0x2D, 0xA3, 0xC2, 0x93, 0xDA, 0x74,
+    0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74,
+    0xDA, 0x72, 0x9F, 0xAA, 0x7F, 0xF3, 0x59, 0x99, 0x96, 0xFD, 0x4D, 0xA9, 0xAD, 0x92, 0xDA, 0x29,
+    0xA3, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0xAF, 0xE2, 0xFF, 0xC4, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0x9D, 0x70, 0x9E, 0xAA, 0xD4, 0xAF,
+    0xC9, 0x69, 0x94, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xE1, 0xDA, 0xAA,
+    0xAE, 0xAA, 0xAA, 0xD1, 0xD3, 0xDA, 0x3D, 0x1D, 0x3D, 0xA3, 0xD1, 0xA9, 0x3D, 0xA3, 0xA9, 0x7D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5A, 0xD7, 0x59, 0xD2, 0xA7, 0x2D, 0xA9, 0xDA, 0x71,
+    0x9F, 0xC9, 0x73, 0xAD, 0x92, 0x77, 0x09, 0x97, 0x71, 0xDA, 0x77, 0x0D, 0xA0, 0x99, 0x99, 0x99,
+    0x59, 0x99, 0xAD, 0x99, 0xFD, 0x93, 0xFD, 0x91, 0x9A, 0xDA, 0x69, 0xDA, 0x5D, 0x97, 0xAC, 0xA5,
+    0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A,
+    0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D,
+    0xA7, 0xD9, 0x5E, 0x69, 0xD6, 0x9E, 0x49, 0xDA, 0x7F, 0xCA, 0xFC, 0x71, 0xAF, 0xEA, 0x75, 0x99,
+    0x97, 0x00, 0x74, 0x9A, 0x97, 0x59, 0xD7, 0x5A, 0xD1, 0xAE, 0x3A, 0xAF, 0x1A, 0xF3, 0xFA, 0x4A,
+    0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5,
+    0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F, 0xCA,
+    0x0A, 0xF5, 0x99, 0x97, 0x00, 0x09, 0x39, 0xCA, 0x29, 0xDA, 0x2A, 0xD9, 0x2A, 0xD3, 0x9C, 0x95,
+    0x70, 0xD2, 0xAD, 0x91, 0xDA, 0x1D, 0xA2, 0xC9, 0x70, 0x2D, 0x93, 0xAE, 0x29, 0xDA, 0xD1, 0xD1,
+    0xAC, 0xAA, 0xC9, 0x2D, 0x70, 0x79, 0xE1, 0xAA, 0xFC, 0xAF, 0x09, 0xEA, 0x09, 0x2A, 0x90, 0x0A,
+    0xFE, 0x1F, 0xF7, 0x20, 0x7A, 0xA4, 0xEA, 0x19, 0xD9, 0xFD, 0x2A, 0xCA, 0xA1, 0x0D, 0x0A, 0xDA,
+    0xAD, 0x90, 0x99, 0x00, 0x09, 0xA3, 0xA9, 0x1E, 0x1E, 0x1D, 0xA1, 0xE2, 0x93, 0x91, 0x19, 0xAA,
+    0x92, 0xAF, 0xC1, 0xD1, 0xD1, 0xC9, 0x1D, 0x4A, 0xCA, 0x29, 0xD9, 0x4C, 0x97, 0x20, 0x29, 0xA9,
+    0x29, 0xF9, 0x1D, 0x1D, 0x1C, 0xA1, 0xAC, 0x1D, 0x1D, 0x1A, 0xF9, 0x29, 0xAA, 0x91, 0x74, 0xC9,
+    0x1C, 0xA2, 0xAD, 0x09, 0xD2, 0xD9, 0x0D, 0xA1, 0xAC, 0xA0, 0x9D, 0x2C, 0xA1, 0xAC, 0x74, 0x72,
+    0xCA, 0x3D, 0x1A, 0xCA, 0x1D, 0x3D, 0x9A, 0xC9, 0x4E, 0xA5, 0x9D, 0x30, 0x72, 0xAC, 0x19, 0xC3,
+    0xD9, 0x0D, 0xA2, 0xAD, 0x09, 0xD3, 0xD9, 0x0A, 0xCA, 0x3C, 0xA1, 0xAC, 0x72, 0x70, 0x9F, 0xA0,
+    0x9F, 0xDA, 0xCA, 0x29, 0xDA, 0x49, 0x90, 0x5C, 0xA0, 0xD0, 0xAC, 0xA0, 0xD9, 0x0D, 0xA0, 0xAD,
+    0x90, 0x99, 0x00, 0x09, 0xA9, 0x1E, 0x19, 0xD9, 0x1D, 0x91, 0xD1, 0xAC, 0x91, 0xC9, 0x10, 0x09,
+    0xA9, 0x1E, 0x09, 0xD9, 0x09, 0xD2, 0xD2, 0x9C, 0xA2, 0x9C, 0x00, 0x4A, 0xC9, 0x0D, 0x90, 0xD1,
+    0xCA, 0x1C, 0x29, 0x10, 0x0A, 0xA1, 0xDA, 0x0D, 0xA9, 0xD0, 0xAC, 0x50, 0x0D, 0x0A, 0xDA, 0xAD,
+    0x90, 0x99, 0x00, 0x09, 0xA3, 0xA9, 0x1E, 0x1E, 0x1D, 0xA1, 0xE2, 0x93, 0x91, 0x1A, 0xA9, 0x09,
+    0xCA, 0xD9, 0xAC, 0x1C, 0xAA, 0xC1, 0xCA, 0x9F, 0x29, 0x91, 0x1A, 0xA1, 0x9D, 0xA1, 0xDA, 0x1D,
+    0x90, 0x9C, 0xA1, 0x99, 0x10, 0x09, 0xAA, 0x2F, 0x3D, 0x29, 0xD1, 0xAD, 0x29, 0x92, 0x69, 0xCA,
+    0x2D, 0x2A, 0xCA, 0x29, 0xDA, 0x99, 0x0A, 0xE9, 0x50, 0x9A, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC,
+    0x99, 0xA0, 0x72, 0xDA, 0x3F, 0xA1, 0xAC, 0xA0, 0xD9, 0xAC, 0xA2, 0xD0, 0x95, 0x7D, 0x39, 0xF9,
+    0x09, 0xD0, 0xFD, 0x29, 0xAA, 0x91, 0x70, 0xDA, 0x1A, 0xAF, 0xC9, 0xF0, 0xAE, 0xA9, 0x91, 0x9A,
+    0xA0, 0x19, 0x99, 0x99, 0x99, 0x1F, 0xF1, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x70, 0x9F, 0xA0, 0x9F,
+    0xDA, 0xCA, 0x29, 0xDA, 0x49, 0x90, 0x5A, 0x97, 0xD6, 0xAD, 0x6D, 0x6A, 0xC9, 0x79, 0x49, 0xA3,
+    0xA9, 0x09, 0xE1, 0xE9, 0x0D, 0xA1, 0xE2, 0x93, 0x91, 0x09, 0x3D, 0x2D, 0x2D, 0xAA, 0x0A, 0xD9,
+    0x70, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73,
+    0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99,
+    0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E,
+    0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x19, 0x9A, 0xAA, 0xA9, 0x93,
+    0xFF, 0xE3, 0x9E, 0x19, 0xAE, 0x3A, 0xD3, 0xAD, 0x92, 0xAD, 0x4D, 0x92, 0xAD, 0x4D, 0x92, 0xAD,
+    0x4D, 0x3A, 0xD3, 0xAC, 0xA3, 0xAF, 0xF4, 0xAF, 0xFC, 0x92, 0xAD, 0x39, 0xE2, 0xAD, 0x5D, 0x91,
+    0xAD, 0x5D, 0xA1, 0xAD, 0x5D, 0xA1, 0xAD, 0x49, 0xD9, 0x1A, 0xD3, 0x9E, 0x1A, 0xFA, 0xFC, 0x1F,
+    0xFD, 0x97, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xA0, 0x9E, 0xAA, 0xAA, 0xAD,
+    0x91, 0xAD, 0x4D, 0x91, 0xAD, 0x4A, 0xC9, 0x1A, 0xD4, 0xAC, 0x2A, 0xD5, 0x92, 0xAD, 0x71, 0xAD,
+    0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x70, 0xAF,
+    0xA9, 0x4F, 0xEA, 0x40, 0x79, 0x97, 0x4E, 0x73, 0x9E, 0x97, 0x2A, 0xF7, 0x2D, 0x9D, 0x71, 0xAC,
+    0x90, 0xD9, 0x70, 0xD1, 0xAD, 0x79, 0xCA, 0x19, 0xD7, 0xAC, 0x92, 0xDA, 0x6D, 0x3A, 0xD5, 0xAC,
+    0xA3, 0x9D, 0x94, 0xD5, 0xDA, 0x39, 0xD5, 0xAD, 0x3D, 0x95, 0x9D, 0x92, 0xD7, 0xDA, 0x1A, 0xCA,
+    0x7A, 0xD1, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF,
+    0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x29, 0xFF, 0xE9, 0x19, 0xDA, 0xAA, 0xAA, 0xAE, 0x91, 0xAC, 0xA5, 0xDA, 0x2A,
+    0xC5, 0xE4, 0xA4, 0xAD, 0x97, 0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72,
+    0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA5, 0xAC, 0x2E, 0x6D, 0x1A, 0xD9, 0x59, 0xD1, 0xFF, 0xFA, 0x1F,
+    0xFF, 0x97, 0x70, 0x99, 0x99, 0x99, 0x94, 0x99, 0x99, 0x99, 0x9F, 0xE3, 0x9F, 0xDA, 0x09, 0xE9,
+    0x59, 0x9D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D,
+    0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0xCA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD,
+    0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x70, 0xDA,
+    0x2A, 0xFA, 0x49, 0xAE, 0xA9, 0xFE, 0x39, 0xFD, 0xA0, 0x59, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6,
+    0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71,
+    0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x19, 0xFD, 0x1A, 0xD0, 0xE1, 0xAF, 0xD1, 0xAD, 0x0E, 0x29, 0x99,
+    0x99, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA, 0x7E,
+    0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x99, 0x99, 0x99,
+    0x90, 0xFE, 0x90, 0x9E, 0x93, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x3A, 0xFA, 0x0F, 0xE9, 0x99, 0x99, 0x99, 0x92,
+    0x99, 0x99, 0x99, 0x1F, 0xE2, 0xFD, 0x91, 0x9E, 0x94, 0xAD, 0xA4, 0xAD, 0x49, 0xD9, 0x5A, 0xD3,
+    0xAD, 0x96, 0xAD, 0x2A, 0xD9, 0x7A, 0xD1, 0xAD, 0x71, 0xAD, 0x0E, 0x72, 0xAF, 0xC7, 0x3A, 0xFC,
+    0x73, 0xAD, 0x9E, 0x72, 0xAD, 0x09, 0xE7, 0x1A, 0xD1, 0xAE, 0x70, 0xAD, 0x2A, 0xE7, 0xAD, 0x3A,
+    0xE6, 0xAD, 0x4A, 0xE9, 0x3A, 0xFA, 0x3A, 0xEA, 0x1F, 0xE4, 0x9F, 0x76, 0x99, 0x10, 0x70, 0x99,
+    0x76, 0xDA, 0x75, 0xAE, 0x75, 0xF9, 0x73, 0x9C, 0xAA, 0xD7, 0x3D, 0x09, 0xD7, 0x3D, 0x1D, 0x97,
+    0x1A, 0xC9, 0x1E, 0x71, 0xD2, 0x9D, 0x70, 0x9D, 0x3D, 0xA7, 0xD9, 0x3E, 0x7D, 0x49, 0xD6, 0xAC,
+    0xA5, 0xDA, 0x5D, 0x95, 0xE4, 0x9D, 0x69, 0xD9, 0x3D, 0xA7, 0xDA, 0x2A, 0xEA, 0x49, 0xAE, 0xA9,
+    0xFD, 0x92, 0x9F, 0xE0, 0x19, 0x99, 0x99, 0x70, 0x99, 0x99, 0x4F, 0xCA, 0x6F, 0xCA, 0x4A, 0xF6,
+    0xF9, 0x59, 0xF5, 0xAE, 0xA6, 0x9C, 0xAD, 0x94, 0xD9, 0xD6, 0x9C, 0x9A, 0xD4, 0xCA, 0x9D, 0x6A,
+    0xC9, 0x9D, 0x3A, 0xC9, 0x9D, 0x6A, 0xC1, 0xD9, 0x2D, 0x1D, 0x6D, 0x1A, 0xCA, 0x2C, 0xA1, 0xD6,
+    0xD1, 0x9D, 0x1A, 0xC2, 0xD9, 0x5D, 0x2D, 0x90, 0xD2, 0xD9, 0x5D, 0x2A, 0xCA, 0x9C, 0xA2, 0xD9,
+    0x5D, 0x3D, 0xAC, 0x3D, 0xA4, 0x9D, 0x3F, 0x3A, 0xCA, 0x49, 0xCA, 0x3A, 0xD9, 0x3A, 0xD4, 0x9C,
+    0xA4, 0xD4, 0xAD, 0x3A, 0xEA, 0x92, 0x99, 0x3A, 0xFA, 0x0F, 0xE7, 0xFE, 0x00, 0x99, 0x99, 0x96,
+    0x99, 0x99, 0x99, 0x9F, 0xC9, 0x5F, 0xDA, 0x09, 0xF6, 0x9D, 0xA3, 0xAE, 0xA6, 0xAC, 0x93, 0xAF,
+    0x95, 0xAC, 0x93, 0xAC, 0x9A, 0xD5, 0xAC, 0x93, 0xAC, 0x90, 0xE4, 0xAC, 0x93, 0xAC, 0x90, 0x9D,
+    0xA3, 0xAC, 0x93, 0xAC, 0x91, 0xAD, 0x3A, 0xC9, 0x3A, 0xC9, 0x2E, 0x2A, 0xC9, 0x3A, 0xC9, 0x29,
+    0xDA, 0x1A, 0xC9, 0x3A, 0xC9, 0x3A, 0xD9, 0x0A, 0xC9, 0x3A, 0xC9, 0x4E, 0x0A, 0xC9, 0x3A, 0xC9,
+    0x5D, 0xAA, 0xC9, 0x3A, 0xC9, 0x59, 0xF9, 0x3A, 0xC9, 0x6F, 0x92, 0xAE, 0xA9, 0x5E, 0x91, 0xFE,
+    0x59, 0xD9, 0x77, 0x93, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x9F, 0xFF, 0xA0, 0x9F, 0xFF,
+    0xA0, 0x9C, 0xA7, 0x9C, 0xA0, 0x9C, 0xA7, 0x9C, 0x91, 0xA9, 0x70, 0xC7, 0x77, 0x72, 0x9F, 0xE6,
+    0xAF, 0xE7, 0x99, 0x99, 0x99, 0x77, 0x77, 0x2A, 0xC7, 0x1A, 0xC0, 0xD7, 0x1D, 0x0D, 0x97, 0x0D,
+    0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x00, 0x59, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A,
+    0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72,
+    0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7,
+    0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE,
+    0xA7, 0x29, 0x99, 0x97, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFD,
+    0x19, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x93, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4,
+    0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD,
+    0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD3, 0xAF, 0xA4,
+    0xAE, 0xAA, 0x0F, 0xE3, 0xFE, 0x00, 0x19, 0x9A, 0xAA, 0xA9, 0x93, 0xFF, 0xE9, 0x29, 0xE1, 0x9A,
+    0xE9, 0x2A, 0xD4, 0xE2, 0xAD, 0x4A, 0xD2, 0xAD, 0x49, 0xD2, 0xAD, 0x4A, 0xD2, 0xAD, 0x4E, 0x2A,
+    0xD3, 0xAD, 0x3A, 0xDA, 0xAF, 0x93, 0xAF, 0xDA, 0x5A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x1A, 0xFA, 0x95, 0xFE, 0xA5, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xEA,
+    0x19, 0xEA, 0xAA, 0xAA, 0xAE, 0x2A, 0xD9, 0x5D, 0x3E, 0x94, 0xD4, 0xE4, 0x99, 0x5E, 0x73, 0x9D,
+    0xA7, 0x3A, 0xDA, 0x73, 0xDA, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x59, 0x3A, 0xD6, 0xC9, 0x1A, 0xD6,
+    0xAC, 0x90, 0xAD, 0x96, 0xD9, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFF, 0xE1, 0xDA, 0xAA, 0xAE, 0xAA, 0xAA, 0xD1, 0xD3, 0xDA, 0x3D, 0x1D,
+    0x3D, 0xA3, 0xD1, 0xA9, 0x3D, 0xA3, 0xA9, 0x7D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x39, 0xAE, 0xAA, 0x70, 0xFF,
+    0x93, 0x19, 0xA9, 0x70, 0xA9, 0x1F, 0x7E, 0x0A, 0xFA, 0x5E, 0x93, 0xE4, 0xAD, 0x95, 0xDA, 0x3D,
+    0xA6, 0xAD, 0x2A, 0xD7, 0x0D, 0x2D, 0x97, 0x0A, 0xCA, 0x09, 0xD7, 0x19, 0xD0, 0xD9, 0x72, 0xD9,
+    0xD7, 0x3A, 0xE9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x39, 0xAE, 0xAA, 0x70, 0xAF,
+    0xE9, 0x30, 0x49, 0xFD, 0x97, 0x2A, 0xEA, 0x97, 0x49, 0xD7, 0x39, 0xAA, 0xFA, 0xA9, 0x59, 0xFF,
+    0xF9, 0x2A, 0xDA, 0x19, 0xD1, 0x9E, 0xA0, 0x9D, 0xA2, 0x9D, 0x3A, 0xD9, 0xAD, 0x39, 0xD4, 0xDA,
+    0xE3, 0x9D, 0x4F, 0xCA, 0x39, 0xD4, 0xFD, 0x39, 0xD4, 0xDA, 0xAD, 0x92, 0x9D, 0x3A, 0xD1, 0xE9,
+    0x19, 0xD2, 0xAD, 0xA2, 0xFA, 0xAD, 0xAA, 0xE9, 0x49, 0xAF, 0xF9, 0x72, 0x9D, 0x76, 0x9D, 0x97,
+    0x39, 0xFD, 0x97, 0x19, 0x99, 0x99, 0x99, 0x50, 0x09, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x1F,
+    0xE2, 0xAF, 0xC9, 0x19, 0xE9, 0x49, 0xDA, 0x49, 0xE4, 0xDA, 0x6A, 0xD9, 0x2A, 0xD7, 0x0E, 0x19,
+    0xD7, 0x19, 0xE0, 0xD9, 0x72, 0xAF, 0xA7, 0x4F, 0x75, 0xAE, 0x74, 0x9F, 0xA7, 0x3D, 0x0A, 0xD9,
+    0x71, 0xD9, 0x1E, 0x70, 0xAC, 0xA3, 0xE6, 0x9D, 0x4A, 0xDA, 0x5D, 0x95, 0xE9, 0x2A, 0xEA, 0x93,
+    0x9F, 0xA9, 0xFE, 0x2A, 0xFE, 0x0A, 0x93, 0x99, 0x99, 0x99, 0x93, 0xA9, 0x0D, 0xA1, 0x9F, 0xDA,
+    0x2D, 0xA0, 0xAD, 0x39, 0xDA, 0x39, 0xD9, 0x09, 0xD9, 0x3D, 0xA3, 0xAD, 0x2D, 0x93, 0xDA, 0x3E,
+    0x2D, 0xA3, 0xDA, 0x3D, 0xA2, 0xDA, 0x3D, 0xA3, 0xDA, 0x2E, 0x3D, 0xA3, 0xD9, 0x2A, 0xD3, 0xDA,
+    0x2A, 0xD4, 0xDA, 0x2D, 0xA2, 0xDA, 0x4A, 0xDA, 0x1D, 0xA0, 0x9E, 0x6A, 0xFF, 0xE7, 0x09, 0xAF,
+    0xDA, 0x97, 0x5D, 0xA7, 0x70, 0xDA, 0x77, 0x0D, 0xA7, 0x7A, 0xEA, 0x97, 0x4F, 0xE5, 0x59, 0xAA,
+    0xAA, 0x97, 0x2A, 0xFF, 0xC7, 0xF9, 0x90, 0x9A, 0xE9, 0x4E, 0xA5, 0x9E, 0x39, 0xE7, 0x9D, 0xA2,
+    0xAD, 0x97, 0x0E, 0x2E, 0x71, 0xE2, 0xE7, 0x1A, 0xD2, 0xE7, 0x1E, 0x2A, 0xD7, 0x1E, 0x29, 0xD9,
+    0x70, 0xDA, 0x3E, 0x79, 0xD4, 0x9D, 0x96, 0xDA, 0x29, 0x90, 0xAD, 0x5A, 0xD1, 0x90, 0xCA, 0x1A,
+    0xD3, 0xAD, 0x19, 0xC0, 0xD2, 0xAC, 0xA1, 0x9D, 0x2A, 0xC9, 0xFF, 0x1A, 0xFE, 0x0F, 0xEA, 0x19,
+    0xFE, 0x00, 0x77, 0x2A, 0xEA, 0x2D, 0x4E, 0xAE, 0x0A, 0xD3, 0xAD, 0x2A, 0xCA, 0xAC, 0xA3, 0xD9,
+    0x3A, 0xE9, 0x29, 0xD5, 0xE3, 0xAD, 0x5A, 0xD3, 0xE5, 0x9D, 0x3E, 0x5A, 0xD3, 0xAD, 0x5E, 0x39,
+    0xD9, 0x3A, 0xE4, 0xE2, 0x9C, 0xAD, 0x93, 0x9E, 0xAE, 0x0E, 0xAA, 0x29, 0xFA, 0x19, 0xEA, 0x49,
+    0x95, 0x92, 0x49, 0x99, 0x96, 0x9F, 0xD4, 0x9D, 0xA9, 0xAE, 0x3D, 0x92, 0xAD, 0x91, 0x9D, 0x4D,
+    0x91, 0xAC, 0xA4, 0xD9, 0x1D, 0xA4, 0xD2, 0xDA, 0x39, 0xD2, 0xDA, 0x3D, 0x3D, 0xA0, 0x9F, 0x3D,
+    0xA0, 0x9F, 0xC2, 0xDA, 0x39, 0xE1, 0xDA, 0x5D, 0xA0, 0xDA, 0x5A, 0xD0, 0xDA, 0x5A, 0xD0, 0xDA,
+    0x5E, 0x0D, 0xA5, 0xDA, 0x0D, 0xA4, 0xE1, 0xFA, 0xAF, 0x91, 0xDA, 0xFC, 0xA3, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xAA, 0x71, 0x74, 0xAE, 0x94, 0xAC, 0xAF, 0xA4, 0xAD,
+    0x1E, 0x4E, 0x2D, 0xA3, 0xDA, 0x2A, 0xD3, 0xD9, 0x29, 0xD9, 0x19, 0xD4, 0xDA, 0x1A, 0xCA, 0x4A,
+    0xD1, 0xD9, 0x5D, 0x1D, 0x6D, 0x9A, 0xC9, 0x6A, 0xEA, 0x70, 0xE7, 0x1D, 0xA7, 0x1A, 0xC7, 0x2D,
+    0x97, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xA9, 0x40, 0x49, 0x99, 0x96, 0x9F, 0xE9,
+    0x29, 0xDA, 0x9A, 0xF2, 0xD9, 0x4A, 0xA2, 0xD9, 0x71, 0xAD, 0xA7, 0x1F, 0x97, 0x0F, 0xA6, 0xEA,
+    0xE9, 0x3D, 0x91, 0x9E, 0x2D, 0xA3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A, 0xD6, 0xDA, 0xE6, 0xDA, 0xE6,
+    0xDA, 0xAD, 0x6D, 0x99, 0xD9, 0x4A, 0xD1, 0xE4, 0xDA, 0x19, 0xEA, 0x9A, 0xE3, 0x9F, 0xDA, 0x69,
+    0x99, 0x94, 0x75, 0xAF, 0xC2, 0x9E, 0xAA, 0xDA, 0x1D, 0x93, 0x99, 0x09, 0xD7, 0x0D, 0x70, 0xEA,
+    0xAA, 0x94, 0xFC, 0x93, 0xDA, 0x95, 0xAD, 0x7D, 0xA7, 0xAD, 0x59, 0x99, 0xFA, 0xAE, 0x19, 0xFE,
+    0x94, 0x99, 0x93, 0x9C, 0x70, 0xAC, 0xA3, 0x9A, 0xC0, 0xAF, 0xFC, 0x09, 0xFA, 0xAD, 0x95, 0x9D,
+    0x96, 0xD9, 0x6D, 0xA6, 0xAC, 0xA6, 0x9D, 0x7D, 0x96, 0xAD, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xAD,
+    0x7A, 0xD7, 0xAD, 0x96, 0x9E, 0x96, 0xAF, 0xCA, 0xA3, 0xAF, 0xE5, 0x99, 0xE9, 0x69, 0xD7, 0x9D,
+    0x7D, 0x70, 0xA9, 0x10, 0x75, 0x9A, 0xD1, 0x9F, 0xA1, 0xF9, 0x9F, 0xDA, 0x2A, 0xCA, 0xD2, 0xE3,
+    0xE9, 0x3D, 0x92, 0xE4, 0xD9, 0x2D, 0xA4, 0xDA, 0x2D, 0x94, 0xDA, 0x2D, 0x94, 0xDA, 0x2D, 0x94,
+    0xDA, 0x2D, 0x94, 0xDA, 0x2D, 0x94, 0xDA, 0x2D, 0x94, 0xDA, 0x2D, 0x94, 0xDA, 0x72, 0xDA, 0x72,
+    0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xD9, 0x72, 0xAA, 0x00, 0x49, 0x99, 0x7A, 0xFC, 0xA4, 0xEA,
+    0x9E, 0xA2, 0x9D, 0x3A, 0xD9, 0x1D, 0x94, 0xDA, 0x1D, 0x5A, 0xD0, 0x9D, 0x59, 0xD0, 0xAC, 0xA6,
+    0xD9, 0xAC, 0xA6, 0xD9, 0xFF, 0xFA, 0xFF, 0xFA, 0xDA, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xD6, 0xD9,
+    0x9D, 0x6D, 0x1D, 0x94, 0x9D, 0x1E, 0x4A, 0xCA, 0x19, 0xD9, 0x29, 0xD3, 0xFA, 0xAD, 0x94, 0xAF,
+    0xC9, 0x79, 0x95, 0x6A, 0xCA, 0x3D, 0xA3, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0xA3, 0xE3, 0xFA, 0xA0, 0x9F, 0xA2, 0x99, 0x20, 0x74, 0xAC, 0xA4, 0xAD, 0x1D, 0xA3,
+    0xF1, 0xDA, 0x2E, 0x92, 0xDA, 0x1E, 0x4D, 0xA0, 0xAD, 0x5D, 0xA9, 0xD6, 0xDA, 0xE9, 0x5F, 0x9D,
+    0x5E, 0x90, 0xD9, 0x4D, 0xA1, 0xAD, 0x4D, 0xA2, 0xDA, 0x3D, 0xA2, 0xAE, 0xAA, 0x9D, 0x93, 0xFC,
+    0x70, 0x99, 0x20, 0x19, 0x99, 0x72, 0xFC, 0x71, 0xAA, 0xF7, 0x3A, 0xD9, 0x73, 0xDA, 0x73, 0x9D,
+    0x74, 0xD9, 0x73, 0xDA, 0x72, 0xAE, 0x72, 0xF7, 0x19, 0xC9, 0xDA, 0x70, 0xD0, 0xAD, 0x79, 0xD0,
+    0x9D, 0x7D, 0xA1, 0xD9, 0x6D, 0x2A, 0xCA, 0x5A, 0xD2, 0x9D, 0x5D, 0xA3, 0xD9, 0x3A, 0xD4, 0xE3,
+    0xE4, 0xAF, 0xAA, 0xD9, 0x5F, 0x73, 0x92, 0x77, 0x0A, 0xD5, 0xD4, 0xE4, 0x9D, 0x4D, 0xA4, 0x9D,
+    0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4E,
+    0x4A, 0xD4, 0xE4, 0xE9, 0x3E, 0xA2, 0xAE, 0xA3, 0xFC, 0xAE, 0x0E, 0xAA, 0x0D, 0x9F, 0xC1, 0xAE,
+    0x90, 0xD1, 0x99, 0x49, 0x92, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xAA, 0x74, 0x74,
+    0xAE, 0x94, 0xAC, 0xAF, 0xA4, 0xAD, 0x1E, 0x4E, 0x2D, 0xA3, 0xDA, 0x2A, 0xD3, 0xD9, 0x29, 0xD9,
+    0x19, 0xD4, 0xDA, 0x1A, 0xCA, 0x4A, 0xD1, 0xD9, 0x5D, 0x1D, 0x6D, 0x9A, 0xC9, 0x6A, 0xEA, 0x70,
+    0xE7, 0x1D, 0xA7, 0x70, 0x9C, 0x70, 0xAC, 0xA3, 0x9A, 0xA0, 0xAF, 0xFA, 0x09, 0xAA, 0xAA, 0xE9,
+    0x4A, 0xD9, 0x5A, 0xCA, 0x69, 0xD7, 0x9D, 0x70, 0xD9, 0x7A, 0xDA, 0x99, 0x59, 0xF9, 0x3F, 0xAA,
+    0x3D, 0xA6, 0x9D, 0x7A, 0xCA, 0x7E, 0x7A, 0xD7, 0x9E, 0x96, 0x9F, 0xCA, 0x94, 0xAF, 0xD5, 0x99,
+    0xE7, 0x9D, 0x7A, 0xCA, 0x7D, 0x70, 0xA2, 0x77, 0x9F, 0xCA, 0x4A, 0xEA, 0xF2, 0xAD, 0x3A, 0xDA,
+    0x1D, 0x94, 0xE0, 0x9D, 0x59, 0xD9, 0xAD, 0x6D, 0x9E, 0x6D, 0xAE, 0x6D, 0x9A, 0xD6, 0xD0, 0x9D,
+    0x94, 0xAD, 0x1E, 0x4D, 0x91, 0x9E, 0xA9, 0xAD, 0xA3, 0x9F, 0xD9, 0x69, 0x99, 0x94, 0x77, 0x09,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xDA, 0x0C, 0xA9, 0x9D, 0x99, 0x9A, 0xCA, 0x99, 0x1C, 0x2C, 0xA2, 0xAC,
+    0x96, 0x9C, 0xA2, 0xAC, 0x79, 0xCA, 0x2D, 0x7A, 0xCA, 0x2D, 0x7D, 0x92, 0xD7, 0xD9, 0x2D, 0x96,
+    0xD9, 0x2D, 0x95, 0x9D, 0x3E, 0x59, 0xD3, 0xAF, 0xC2, 0xAD, 0x4F, 0x97, 0x70, 0x77, 0x9F, 0xCA,
+    0x4A, 0xEA, 0xF2, 0x9D, 0x92, 0x9E, 0x1A, 0xD4, 0xAD, 0x1D, 0xA4, 0x9D, 0x90, 0xD9, 0x5D, 0x90,
+    0xD9, 0x5D, 0x90, 0xD9, 0x5D, 0x90, 0xD9, 0x49, 0xD1, 0xD9, 0x4D, 0xA1, 0xD9, 0x3A, 0xD2, 0xFA,
+    0xAE, 0x92, 0xDA, 0xFA, 0x4D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9A,
+    0x97, 0x10, 0x75, 0x9F, 0xC9, 0x2A, 0xDA, 0xAE, 0x90, 0x9D, 0x3E, 0x0D, 0x93, 0xAC, 0x99, 0xD7,
+    0xAD, 0x7D, 0xA7, 0xE7, 0xAD, 0x79, 0xDA, 0x7E, 0xA6, 0x9F, 0xCA, 0x93, 0x9F, 0xE5, 0x9A, 0xE7,
+    0xAD, 0x7A, 0xC9, 0x7D, 0x79, 0xA2, 0x77, 0x19, 0xAF, 0xF1, 0x9F, 0xFD, 0xA0, 0x9D, 0xA2, 0xD9,
+    0x09, 0x1D, 0xA3, 0x9D, 0x29, 0xD5, 0xDA, 0x1A, 0xD5, 0xAD, 0x1E, 0x59, 0xD1, 0xE5, 0x9D, 0x1A,
+    0xD5, 0xAD, 0x19, 0xD9, 0x4E, 0x2E, 0x39, 0xD9, 0x29, 0xEA, 0x9A, 0xDA, 0x49, 0xFD, 0x97, 0x99,
+    0x99, 0x50, 0x75, 0xAF, 0xFD, 0x90, 0xFF, 0xE9, 0x9C, 0xA9, 0x9A, 0xCA, 0x99, 0x99, 0x09, 0xC2,
+    0xAC, 0x97, 0x1D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x19, 0xD7, 0x19, 0xD9, 0x71, 0xDA, 0x71, 0xFA,
+    0xA9, 0x59, 0xFC, 0x70, 0x99, 0x30, 0x76, 0xAE, 0x4D, 0x19, 0xF4, 0xAD, 0x29, 0xD4, 0x9D, 0x29,
+    0xD4, 0x9D, 0x91, 0xAD, 0x5D, 0x91, 0xAD, 0x5D, 0x91, 0xAD, 0x5D, 0x91, 0xAD, 0x5D, 0x91, 0xAD,
+    0x49, 0xD2, 0x9D, 0x93, 0xAD, 0x3D, 0xA3, 0xDA, 0x39, 0xE9, 0xAE, 0x5A, 0xFC, 0xA7, 0x09, 0x99,
+    0x40, 0x70, 0x99, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xD9, 0x73, 0xAF, 0xFA, 0x95, 0x9F,
+    0xAF, 0xF3, 0x9D, 0xA2, 0xD9, 0x1A, 0xE2, 0xDA, 0x3D, 0x92, 0x9D, 0xA0, 0x9D, 0x4D, 0x93, 0xE0,
+    0xAD, 0x4D, 0x93, 0xAD, 0x0D, 0xA4, 0xD9, 0x39, 0xD0, 0xAD, 0x4D, 0x93, 0xAD, 0x0A, 0xD4, 0xD9,
+    0x3E, 0x09, 0xDA, 0x3D, 0x93, 0xD9, 0x1E, 0xA2, 0xD9, 0x19, 0xE3, 0xFA, 0xAD, 0xAA, 0xF5, 0x9F,
+    0xFD, 0x97, 0x29, 0xDA, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xA9, 0x70, 0x77,
+    0xAD, 0xA4, 0xAC, 0xA1, 0x9F, 0x39, 0xD9, 0x4D, 0x92, 0xE5, 0xAD, 0x19, 0xD7, 0xD9, 0x0D, 0x97,
+    0xAC, 0xA0, 0xD7, 0x09, 0xDA, 0xC9, 0x71, 0xEA, 0x72, 0x9D, 0x97, 0x29, 0xDA, 0x72, 0xF7, 0x1A,
+    0xC9, 0xDA, 0x70, 0xD0, 0x9D, 0x7A, 0xCA, 0x1D, 0xA5, 0x9D, 0x2A, 0xD5, 0xDA, 0x3D, 0x93, 0xAD,
+    0x4A, 0xD2, 0x9D, 0xA4, 0x9F, 0x09, 0xD6, 0xDA, 0x90, 0x71, 0x99, 0x77, 0xAD, 0x77, 0xAD, 0x77,
+    0xAD, 0x77, 0xAD, 0x69, 0xAE, 0x3A, 0xD2, 0x9C, 0xA0, 0x9F, 0x3A, 0xD3, 0xD9, 0x19, 0xD3, 0xAD,
+    0x3D, 0xA1, 0x9D, 0x3A, 0xD3, 0xE1, 0xAD, 0x3A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x3A, 0xD1, 0xAD,
+    0x3A, 0xD3, 0xAD, 0x1A, 0xD3, 0xAD, 0x3E, 0x19, 0xD9, 0x2A, 0xD3, 0xD9, 0x2D, 0xA2, 0xAD, 0x2A,
+    0xD3, 0xAD, 0xA1, 0xAD, 0x1A, 0xD9, 0x4F, 0xAE, 0xAE, 0x96, 0x9F, 0xFA, 0x73, 0x9A, 0xD9, 0x76,
+    0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAC, 0xA7, 0x7A, 0xA7, 0x77, 0x4D, 0x6A, 0xCA, 0x4D, 0x97,
+    0xDA, 0x29, 0xD7, 0x0A, 0xD2, 0xD9, 0x39, 0x93, 0xDA, 0x09, 0xD3, 0xAD, 0x3E, 0x0A, 0xD3, 0xAD,
+    0x3A, 0xD0, 0xAD, 0x3A, 0xD3, 0xAD, 0x0A, 0xD3, 0x9D, 0x39, 0xD0, 0xAD, 0x39, 0xD3, 0xAD, 0x09,
+    0xD9, 0x2A, 0xD3, 0xAC, 0xA1, 0xDA, 0x2E, 0xA2, 0xD9, 0x1A, 0xDA, 0xAD, 0x9D, 0xA9, 0xE3, 0xAF,
+    0xA1, 0xFC, 0x69, 0x94, 0x99, 0x93, 0x70, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D,
+    0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70,
+    0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE,
+    0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F,
+    0xE9, 0x77, 0x77, 0x75, 0xD7, 0x7A, 0xDA, 0x76, 0xAD, 0xA7, 0x79, 0x97, 0x00, 0x76, 0x9A, 0xFA,
+    0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3,
+    0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0,
+    0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77, 0x09, 0xCA, 0x71, 0xE9, 0x70, 0xAD, 0x72, 0x96, 0x77, 0x70,
+    0x9F, 0x97, 0x4D, 0x9A, 0xD7, 0x4C, 0x91, 0xD9, 0x76, 0xAD, 0x75, 0x9D, 0xA7, 0x7C, 0x97, 0x77,
+    0x74, 0x99, 0x77, 0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73,
+    0xD1, 0xE7, 0x29, 0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99,
+    0x99, 0xAD, 0x97, 0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E,
+    0x4D, 0xA7, 0xAD, 0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x39, 0xA9, 0x79, 0xFC, 0x6A,
+    0xC9, 0x0A, 0xCA, 0x59, 0xC1, 0x9C, 0xA7, 0x09, 0xD7, 0x0D, 0xA7, 0x1A, 0xC7, 0x77, 0x72, 0x9A,
+    0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF,
+    0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD,
+    0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x75, 0xA7, 0x70, 0xD9, 0x76, 0x9D, 0x74, 0x91, 0xD7, 0x3A,
+    0xE0, 0x97, 0x39, 0xDA, 0xD7, 0x39, 0xD1, 0xAC, 0xA7, 0x29, 0xA3, 0x99, 0x76, 0x99, 0x77, 0xE7,
+    0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29, 0xCA,
+    0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97, 0xFF,
+    0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD, 0x3A,
+    0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x71, 0xA7, 0x29, 0xCA, 0x71, 0xD9, 0x70, 0x9C, 0xA7,
+    0x1C, 0xA6, 0xE7, 0x0F, 0xC6, 0xAC, 0xA0, 0xAD, 0x4A, 0xCA, 0x2A, 0xC9, 0x49, 0x49, 0x77, 0x29,
+    0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A,
+    0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF,
+    0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x72, 0xA7, 0x70, 0xAC, 0x97, 0x70, 0xD7, 0x69, 0x1C,
+    0xA7, 0x3A, 0xE7, 0x59, 0xDA, 0xD7, 0x39, 0xD1, 0xAC, 0xA7, 0x29, 0xA3, 0x99, 0x76, 0x99, 0x77,
+    0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29,
+    0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97,
+    0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD,
+    0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x59, 0xA7, 0x2D, 0x72, 0xDA, 0x72, 0xD7, 0x3C,
+    0x96, 0xE7, 0x0F, 0xC6, 0xAC, 0xA0, 0xAD, 0x4A, 0xCA, 0x2A, 0xC9, 0x49, 0x49, 0x77, 0x29, 0xAF,
+    0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD,
+    0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA,
+    0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x73, 0xE9, 0x75, 0xD9, 0xD7, 0x59, 0x1D, 0x77, 0xD7, 0x29,
+    0xDA, 0x1C, 0x72, 0x9D, 0xAD, 0x73, 0x9D, 0x1A, 0xCA, 0x72, 0x9A, 0x39, 0x97, 0x69, 0x97, 0x7E,
+    0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C,
+    0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F,
+    0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3,
+    0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x69, 0xAD, 0x97, 0xD9, 0xD9, 0x6C, 0x90, 0xAC,
+    0x97, 0x09, 0xD7, 0x09, 0xCA, 0x5A, 0xAA, 0x1A, 0x5A, 0xF6, 0xAD, 0x0A, 0xD4, 0xAD, 0x2A, 0xC9,
+    0x49, 0x49, 0x77, 0x29, 0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19,
+    0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD,
+    0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x5D, 0xA1, 0x99, 0x72, 0xAF,
+    0x9C, 0xA7, 0x29, 0xA0, 0x9E, 0x97, 0x77, 0x79, 0xDA, 0x75, 0x9D, 0xAD, 0x73, 0x9D, 0x1A, 0xCA,
+    0x72, 0x9A, 0x39, 0x97, 0x69, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A,
+    0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD,
+    0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59,
+    0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x76,
+    0xE9, 0x1C, 0x49, 0xFA, 0xAC, 0x49, 0xC1, 0xEA, 0x71, 0x99, 0x70, 0x9A, 0xA7, 0x0A, 0xF9, 0x5A,
+    0xD0, 0xAD, 0x93, 0xAD, 0x29, 0xCA, 0x49, 0x49, 0x77, 0x29, 0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3,
+    0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD,
+    0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99,
+    0x70, 0x79, 0xA7, 0x7A, 0xE7, 0x59, 0xDA, 0xD7, 0x39, 0xD1, 0xAD, 0x72, 0xD3, 0x9C, 0x77, 0x77,
+    0x19, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D,
+    0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99,
+    0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4,
+    0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x97, 0x77, 0x77, 0x5D, 0x77, 0xAD,
+    0xA7, 0x6A, 0xDA, 0x77, 0x99, 0x70, 0x3A, 0xCA, 0x70, 0x9E, 0xA7, 0xDA, 0xD9, 0x5A, 0xCA, 0x09,
+    0xD4, 0x9C, 0xA2, 0xAC, 0x97, 0x77, 0x69, 0xAF, 0xA4, 0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D,
+    0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A, 0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD,
+    0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A, 0xFA, 0x0A, 0xE3, 0x99, 0x77, 0x70, 0x9C,
+    0xA7, 0x1E, 0x97, 0x0A, 0xD7, 0x29, 0x60, 0x71, 0xA7, 0x70, 0xAC, 0x97, 0x69, 0xD7, 0x49, 0x90,
+    0xAC, 0x19, 0x72, 0xD3, 0xAC, 0x72, 0xAE, 0xAD, 0x97, 0x3A, 0xF9, 0x77, 0x77, 0x29, 0x97, 0x7E,
+    0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C,
+    0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F,
+    0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3,
+    0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x59, 0x97, 0x2D, 0x71, 0xAD, 0x71, 0xD9, 0x71,
+    0xC7, 0x9C, 0x4A, 0x49, 0xD9, 0x1A, 0xC5, 0xFD, 0xA6, 0x9A, 0xCA, 0x77, 0x77, 0x19, 0xAF, 0xA4,
+    0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A,
+    0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A,
+    0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x7A, 0x77, 0x0A, 0xC9, 0x77, 0x9D, 0x75, 0x99, 0x09, 0xC9, 0x09,
+    0x72, 0xD3, 0xAC, 0x72, 0xAE, 0xAD, 0x97, 0x3A, 0xF9, 0x77, 0x77, 0x29, 0x97, 0x7E, 0x76, 0x9E,
+    0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D,
+    0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5,
+    0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x39, 0x72, 0xAC, 0x97, 0x1A, 0xD7, 0x2A, 0xCA, 0x72, 0x9A,
+    0x69, 0xC4, 0xA4, 0x9D, 0x91, 0xAC, 0x5F, 0xDA, 0x69, 0xAC, 0xA9, 0x77, 0x77, 0x09, 0xAF, 0xA4,
+    0xAD, 0xAA, 0xAD, 0xA3, 0xD9, 0x2E, 0x3D, 0x39, 0xD7, 0x19, 0xD7, 0x1A, 0xD4, 0x9A, 0xFD, 0x3A,
+    0xEA, 0xAA, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x29, 0xEA, 0xAF, 0xDA, 0x0A,
+    0xFA, 0x0A, 0xE3, 0x99, 0x70, 0x69, 0xDA, 0x75, 0x9C, 0xAA, 0xCA, 0x75, 0x90, 0x9C, 0x97, 0x6A,
+    0xCA, 0x74, 0x99, 0x0A, 0xA1, 0xA7, 0x2A, 0xCA, 0x19, 0xCA, 0x73, 0xFD, 0x75, 0x9A, 0xA9, 0x77,
+    0x09, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7, 0x4A, 0xC9, 0x0D, 0x97, 0x3D,
+    0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x70, 0xAC, 0xA9, 0x99,
+    0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9, 0x59, 0xD9, 0x49, 0xD7, 0xE4,
+    0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90, 0x39, 0x99, 0x70, 0xFC, 0x7C,
+    0xA0, 0xAC, 0x96, 0x91, 0xAC, 0x97, 0x9D, 0x97, 0x1C, 0x96, 0x9C, 0x4A, 0x49, 0xD9, 0x1A, 0xC5,
+    0xFD, 0xA6, 0x9A, 0xCA, 0x97, 0x77, 0x70, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3,
+    0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A,
+    0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x5A, 0xD2,
+    0xA7, 0x29, 0xF9, 0xAC, 0x73, 0xC1, 0xEA, 0x77, 0x75, 0x9C, 0x4C, 0x97, 0x1A, 0xDA, 0x9A, 0xD7,
+    0x3A, 0xFC, 0x76, 0x99, 0x77, 0x19, 0x97, 0x7E, 0x76, 0x9E, 0x97, 0x5A, 0xEA, 0x75, 0xD9, 0xD7,
+    0x4A, 0xC9, 0x0D, 0x97, 0x3D, 0x1E, 0x72, 0x9C, 0xA1, 0x9D, 0x72, 0xD9, 0x2D, 0xA7, 0x09, 0xD3,
+    0xAD, 0x70, 0xAC, 0xA9, 0x99, 0x9A, 0xD9, 0x7F, 0xFD, 0xA6, 0xAD, 0xAA, 0xAA, 0xAA, 0xE6, 0xD9,
+    0x59, 0xD9, 0x49, 0xD7, 0xE4, 0xDA, 0x7A, 0xD3, 0xAE, 0xA5, 0xAF, 0xA0, 0xFD, 0x93, 0xFE, 0x90,
+    0x76, 0xAD, 0x19, 0xA4, 0x9F, 0x9A, 0xC4, 0x9C, 0x09, 0xEA, 0x71, 0xA9, 0x59, 0xA4, 0xA4, 0xDA,
+    0x2D, 0x49, 0xFD, 0x96, 0xAD, 0xA7, 0x77, 0x71, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92,
+    0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71, 0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D,
+    0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2, 0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77,
+    0x7D, 0x39, 0xC7, 0x2E, 0xA9, 0xAC, 0xA7, 0x3F, 0xCA, 0x75, 0x99, 0x97, 0x77, 0x74, 0x99, 0x77,
+    0xE7, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5D, 0x9D, 0x74, 0xAC, 0x90, 0xD9, 0x73, 0xD1, 0xE7, 0x29,
+    0xCA, 0x19, 0xD7, 0x2D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xCA, 0x99, 0x99, 0xAD, 0x97,
+    0xFF, 0xDA, 0x6A, 0xDA, 0xAA, 0xAA, 0xAE, 0x6D, 0x95, 0x9D, 0x94, 0x9D, 0x7E, 0x4D, 0xA7, 0xAD,
+    0x3A, 0xEA, 0x5A, 0xFA, 0x0F, 0xD9, 0x3F, 0xE9, 0x77, 0x77, 0x75, 0xD7, 0x7A, 0xDA, 0x76, 0xAD,
+    0xA7, 0x79, 0x97, 0x00, 0x75, 0x9C, 0x4C, 0x49, 0xD9, 0x1A, 0xC5, 0xFD, 0xA6, 0x9A, 0xCA, 0x97,
+    0x77, 0x70, 0x9A, 0xFA, 0x4A, 0xDA, 0xAA, 0xDA, 0x3D, 0x92, 0xE3, 0xD3, 0x9D, 0x71, 0x9D, 0x71,
+    0xAD, 0x49, 0xAF, 0xD3, 0xAE, 0xAA, 0xAD, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0x9D, 0x2A, 0xD3, 0xE2,
+    0x9E, 0xAA, 0xFD, 0xA0, 0xAF, 0xA0, 0xAE, 0x39, 0x97, 0x77, 0x09, 0xCA, 0x71, 0xE9, 0x70, 0xAD,
+    0x72, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD,
+    0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA,
+    0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5,
+    0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x77, 0x77, 0x1D, 0x97, 0x1A, 0xDA, 0x71, 0xAD, 0xA7,
+    0x29, 0x95, 0x75, 0xAF, 0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF,
+    0xFF, 0xFE, 0xAD, 0x97, 0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99, 0x77,
+    0x2D, 0x7A, 0xDA, 0x6A, 0xD9, 0x79, 0x93, 0x77, 0x19, 0xF9, 0x7D, 0x9A, 0xD6, 0x9C, 0x91, 0xD7,
+    0x2A, 0xD7, 0x09, 0xD9, 0x72, 0xC9, 0x77, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0xC1, 0x9E, 0xAA, 0xAA, 0xAA, 0xD2, 0xAD, 0x5A, 0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72,
+    0xAD, 0x72, 0xAD, 0xAA, 0xAE, 0xA3, 0xAF, 0xFA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6,
+    0xAA, 0x1A, 0xD6, 0xD1, 0xAD, 0x59, 0xCA, 0x0A, 0xFF, 0xEA, 0xFF, 0xFC, 0x90, 0x39, 0xAA, 0x95,
+    0xAF, 0xA4, 0xD1, 0xD4, 0xC9, 0x1D, 0x7A, 0xCA, 0x59, 0xD9, 0x7C, 0x97, 0x77, 0x4A, 0xFA, 0x3E,
+    0xAA, 0xE1, 0xDA, 0x3D, 0xA9, 0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7,
+    0xAD, 0x79, 0xE7, 0xAF, 0xFA, 0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x39, 0x97, 0x2A, 0xE9, 0x0D, 0x5D,
+    0xAF, 0xC5, 0xCA, 0x09, 0xE9, 0x77, 0x76, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC,
+    0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A,
+    0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x74, 0x9E, 0x1A, 0xA2,
+    0xFC, 0xAD, 0x2C, 0xA0, 0x9E, 0xA6, 0x9A, 0x97, 0x77, 0x2A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D,
+    0xA9, 0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF,
+    0xFA, 0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x72, 0x9A, 0x73, 0xD9, 0x71, 0x9D, 0x79, 0x1D, 0x6A, 0xE0,
+    0x96, 0x9D, 0xAD, 0x69, 0xD1, 0xAC, 0xA5, 0x9A, 0x39, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9A, 0x72, 0xD7, 0x19, 0xD7, 0x1D, 0x71, 0x9C, 0x6A, 0xD9, 0x79, 0xFA, 0x59, 0xD9, 0x9D, 0x94,
+    0xD9, 0x2D, 0x49, 0x77, 0x71, 0xAF, 0xA5, 0xEA, 0xAE, 0x3D, 0xA3, 0xDA, 0x19, 0xD4, 0xAD, 0x1A,
+    0xCA, 0x49, 0xD1, 0xFF, 0xE1, 0xFF, 0xDA, 0x1D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x19, 0xE7, 0x1A,
+    0xFF, 0xA3, 0xAF, 0xDA, 0x79, 0x99, 0x40, 0x70, 0xA7, 0x3A, 0xC9, 0x73, 0xD7, 0x19, 0x1C, 0xA6,
+    0xAE, 0x70, 0x9D, 0xAD, 0x69, 0xD1, 0xAC, 0xA5, 0x9A, 0x39, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC, 0x2A, 0xD5, 0x9C, 0x2A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3, 0xAD, 0x72, 0xAD, 0x72,
+    0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF, 0xFE, 0xAF, 0xFF, 0xC9,
+    0x6A, 0x70, 0xAC, 0xA7, 0x9D, 0x70, 0xAC, 0xA7, 0x0A, 0xC4, 0xAD, 0x90, 0x93, 0x9F, 0x94, 0xD9,
+    0x9D, 0x92, 0xD9, 0x2D, 0x29, 0x77, 0x5A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA, 0x3D, 0xA9, 0xD4, 0xAD,
+    0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7, 0xAF, 0xFA, 0x1A, 0xFD,
+    0xA5, 0x99, 0x92, 0x71, 0xE9, 0x70, 0xD9, 0xD7, 0x09, 0x1D, 0x71, 0x9D, 0x59, 0xDA, 0x1C, 0x59,
+    0xDA, 0xD6, 0x9D, 0x1A, 0xCA, 0x5A, 0xA3, 0x99, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFF, 0xC1, 0x9E, 0xAA, 0xAA, 0xAA, 0xD2, 0xAD, 0x5A, 0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0xAA, 0xAE, 0xA3, 0xAF, 0xFA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD6, 0xAA, 0x1A, 0xD6, 0xD1, 0xAD, 0x59, 0xCA, 0x0A, 0xFF, 0xEA, 0xFF, 0xFC, 0x90, 0x7A, 0xDA,
+    0x7A, 0xCA, 0xAD, 0x69, 0xC1, 0xD7, 0x1A, 0xC9, 0x70, 0xD5, 0x9A, 0xC9, 0x09, 0x95, 0xFA, 0x6D,
+    0x90, 0xDA, 0x4D, 0x92, 0xD4, 0x97, 0x77, 0x1A, 0xFA, 0x5E, 0xAA, 0xE3, 0xDA, 0x3D, 0xA1, 0x9D,
+    0x4A, 0xD1, 0xAC, 0xA4, 0x9D, 0x1F, 0xFE, 0x1F, 0xFD, 0xA1, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x71,
+    0x9E, 0x71, 0xAF, 0xFA, 0x3A, 0xFD, 0xA7, 0x99, 0x94, 0x3D, 0xA1, 0x99, 0x5A, 0xF9, 0xCA, 0x59,
+    0xA0, 0x9E, 0x97, 0x75, 0x9D, 0xA7, 0x09, 0xFA, 0x69, 0xD1, 0xAC, 0xA5, 0xAA, 0x39, 0x92, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0xAA, 0xAA, 0xAD, 0x2A, 0xD5, 0xAC,
+    0x2A, 0xD5, 0x9C, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xDA, 0xAA, 0xEA, 0x3A, 0xFF, 0xA3,
+    0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x6A, 0xA1, 0xAD, 0x6D, 0x1A, 0xD5, 0x9C, 0xA0, 0xAF,
+    0xFE, 0xAF, 0xFF, 0xC9, 0x74, 0x9D, 0xA1, 0xA9, 0x2F, 0xC9, 0xCA, 0x2C, 0x90, 0xAE, 0x79, 0x97,
+    0xAA, 0x96, 0xFA, 0x4D, 0x90, 0xE2, 0xD9, 0x2D, 0x29, 0x77, 0x5A, 0xFA, 0x3E, 0xAA, 0xE1, 0xDA,
+    0x3D, 0xA9, 0xD4, 0xAD, 0xAC, 0xA4, 0x9F, 0xFF, 0xFF, 0xEA, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xE7,
+    0xAF, 0xFA, 0x1A, 0xFD, 0xA5, 0x99, 0x92, 0x59, 0xA7, 0x2A, 0xE7, 0x09, 0xDA, 0xD6, 0x9D, 0x1A,
+    0xD5, 0xD3, 0xAC, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC1, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xD2, 0xAD, 0x5A, 0xC2, 0xAD, 0x59, 0xC2, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0xAA, 0xAE, 0xA3, 0xAF, 0xFA, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD6, 0xAA, 0x1A, 0xD6,
+    0xD1, 0xAD, 0x59, 0xCA, 0x0A, 0xFF, 0xEA, 0xFF, 0xFC, 0x97, 0x77, 0x71, 0xD9, 0x71, 0xAD, 0xA7,
+    0x1A, 0xDA, 0x72, 0x99, 0x50, 0x4D, 0x96, 0xF5, 0x9D, 0xAD, 0x4D, 0x1D, 0x92, 0xD9, 0x2D, 0x77,
+    0x71, 0xAF, 0xA3, 0xEA, 0xAE, 0x1D, 0xA3, 0xDA, 0x9D, 0x4A, 0xDA, 0xCA, 0x49, 0xFF, 0xFF, 0xFE,
+    0xAD, 0x97, 0xDA, 0x7A, 0xD7, 0x9E, 0x7A, 0xFF, 0xA1, 0xAF, 0xDA, 0x59, 0x99, 0x77, 0x2D, 0x7A,
+    0xDA, 0x6A, 0xD9, 0x79, 0x93, 0x70, 0xAF, 0x90, 0x9D, 0x9A, 0xD0, 0x9C, 0x2D, 0x4A, 0xCA, 0x29,
+    0xD9, 0x39, 0xC6, 0x93, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0x9E, 0x93, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x3A,
+    0xFA, 0x0F, 0xE9, 0x19, 0xAA, 0x92, 0xAF, 0xC1, 0xD1, 0xD9, 0x0A, 0x91, 0xD4, 0xAC, 0xA3, 0xD9,
+    0x4C, 0x97, 0x73, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA,
+    0x4D, 0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0x9E,
+    0x93, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4,
+    0xAD, 0x4A, 0xD4, 0xAD, 0x3A, 0xFA, 0x0F, 0xE9, 0x77, 0x19, 0xCA, 0x4E, 0x93, 0xE9, 0x4A, 0x92,
+    0x71, 0x9D, 0xA3, 0xAE, 0x39, 0xDA, 0x77, 0x72, 0x9A, 0xDA, 0x19, 0xFA, 0x4D, 0xA4, 0xDA, 0x4D,
+    0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA3, 0xAE, 0xA9, 0x9F, 0xDA, 0x77, 0x2A,
+    0xC9, 0x39, 0xE3, 0x9D, 0xA4, 0x99, 0x20, 0x59, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90,
+    0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD,
+    0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D,
+    0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A,
+    0xFE, 0xA7, 0x29, 0x99, 0x97, 0x77, 0x70, 0x9C, 0xA7, 0x6E, 0x97, 0x5E, 0x97, 0x6A, 0x97, 0x77,
+    0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC,
+    0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F,
+    0xDA, 0x69, 0x99, 0x97, 0x77, 0xD7, 0x1A, 0xDA, 0x70, 0xAD, 0x97, 0x19, 0x94, 0x77, 0x7A, 0xF9,
+    0x72, 0x9D, 0x9A, 0xD7, 0x29, 0xC2, 0xD7, 0x6A, 0xCA, 0x74, 0x9D, 0x97, 0x59, 0xC7, 0x70, 0x97,
+    0x69, 0xAA, 0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97,
+    0xE9, 0x1E, 0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72,
+    0xAD, 0x0E, 0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E,
+    0xA7, 0xE3, 0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x49, 0xA9,
+    0x79, 0xFC, 0x95, 0xAC, 0x90, 0xAC, 0xA5, 0x9C, 0x19, 0xCA, 0x70, 0x9D, 0x70, 0xDA, 0x71, 0xAC,
+    0x77, 0x77, 0x29, 0xFC, 0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A, 0xD6, 0xDA,
+    0xDA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1, 0xAE, 0xA9,
+    0xAE, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x74, 0x9A, 0x77, 0xD7, 0x6A, 0xCA, 0x73, 0x91, 0xCA,
+    0x72, 0xEA, 0x09, 0x72, 0xAC, 0xAD, 0xA7, 0x29, 0xD1, 0xAC, 0x97, 0x1A, 0xA3, 0xA7, 0x39, 0xAA,
+    0xAA, 0x97, 0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E,
+    0x70, 0x9E, 0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E,
+    0x72, 0xAD, 0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3,
+    0xEA, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x72, 0xA7, 0x29, 0xD7,
+    0x1D, 0x97, 0x09, 0xCA, 0x71, 0xCA, 0x6E, 0x70, 0xFC, 0x6A, 0xD0, 0xAD, 0x4A, 0xCA, 0x2A, 0xC9,
+    0x49, 0x49, 0x77, 0x29, 0xFC, 0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A, 0xD6,
+    0xDA, 0xDA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1, 0xAE,
+    0xA9, 0xAE, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x71, 0x9A, 0x77, 0xD9, 0x76, 0x9D, 0x75, 0x90,
+    0x9C, 0x97, 0x2E, 0xA0, 0x97, 0x2A, 0xCA, 0xDA, 0x72, 0x9D, 0x1A, 0xC9, 0x71, 0xAA, 0x3A, 0x73,
+    0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09, 0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E,
+    0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7, 0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A,
+    0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA,
+    0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99, 0x70, 0x69, 0xA7,
+    0x2D, 0x72, 0xDA, 0x72, 0xD7, 0x3C, 0x96, 0xE7, 0x0F, 0xC6, 0xAC, 0xA0, 0xAD, 0x4A, 0xCA, 0x2A,
+    0xC9, 0x49, 0x49, 0x77, 0x29, 0xFC, 0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A,
+    0xD6, 0xDA, 0xDA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1,
+    0xAE, 0xA9, 0xAE, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x72, 0x9E, 0x75, 0xCA, 0x9C, 0xA7, 0x49,
+    0x1C, 0xA7, 0x59, 0xCA, 0x71, 0xAD, 0xA0, 0x9C, 0x71, 0xAF, 0xA7, 0x2A, 0xCA, 0x1A, 0xC9, 0x71,
+    0xA9, 0x3A, 0x73, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9, 0x09, 0xAF, 0x4E, 0x95, 0xAE,
+    0x2A, 0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A, 0xD7, 0x2E, 0x0A, 0xD7, 0x2A,
+    0xD0, 0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70,
+    0xAD, 0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7, 0xAF, 0xEA, 0x72, 0x99, 0x99,
+    0x70, 0x70, 0xAD, 0x97, 0x0D, 0x9D, 0x97, 0xC9, 0x0A, 0xC9, 0x71, 0x9D, 0x71, 0x9C, 0xA6, 0xAA,
+    0xC1, 0xA6, 0xAF, 0x7A, 0xD0, 0xAD, 0x5A, 0xD2, 0xAC, 0xA5, 0x94, 0x97, 0x74, 0x9F, 0xCA, 0x5F,
+    0xAF, 0x92, 0xAD, 0x39, 0xE1, 0x9D, 0x5A, 0xD9, 0x0A, 0xD6, 0xDA, 0x0D, 0xA6, 0xE0, 0xDA, 0x6E,
+    0x0D, 0xA6, 0xDA, 0x0E, 0x6D, 0xA0, 0xAD, 0x95, 0xD2, 0xE4, 0xDA, 0x2A, 0xEA, 0x9A, 0xE4, 0x9F,
+    0xDA, 0x79, 0x99, 0x95, 0x49, 0xDA, 0x1A, 0x72, 0xFA, 0x9C, 0x97, 0x1A, 0x90, 0x9E, 0x77, 0x76,
+    0xAD, 0x97, 0x4A, 0xFA, 0x72, 0xAC, 0xA1, 0xAC, 0x97, 0x1A, 0x93, 0xA7, 0x39, 0xAA, 0xAA, 0x97,
+    0x1A, 0xFF, 0xA6, 0xEA, 0x90, 0x9A, 0xF4, 0xE9, 0x5A, 0xE2, 0xAD, 0x97, 0xE9, 0x1E, 0x70, 0x9E,
+    0x09, 0xD9, 0x71, 0xE0, 0xAD, 0x72, 0xE0, 0xAD, 0x72, 0xAD, 0x0E, 0x72, 0xAD, 0x0E, 0x72, 0xAD,
+    0x0A, 0xD9, 0x71, 0xE0, 0x9D, 0xA7, 0x1D, 0xA1, 0xE7, 0x0A, 0xD9, 0x1E, 0xA7, 0xE3, 0xEA, 0x49,
+    0xE4, 0x9F, 0xAA, 0xAF, 0x7A, 0xFE, 0xA7, 0x29, 0x99, 0x97, 0x77, 0xE9, 0x1C, 0x49, 0xFA, 0xAC,
+    0x49, 0xC1, 0xEA, 0x71, 0x99, 0x70, 0x9A, 0xA7, 0x0A, 0xF9, 0x5A, 0xD0, 0xAD, 0x93, 0xAD, 0x29,
+    0xCA, 0x49, 0x49, 0x77, 0x29, 0xFC, 0xA4, 0xFA, 0xF9, 0x1A, 0xD3, 0x9E, 0x09, 0xD5, 0xAD, 0x9A,
+    0xD6, 0xDA, 0xDA, 0x6F, 0xCA, 0x6F, 0xCA, 0x6D, 0xAE, 0x6D, 0xAA, 0xD9, 0x5D, 0x1E, 0x4D, 0xA1,
+    0xAE, 0xA9, 0xAE, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x7A, 0xA7, 0x6F, 0x74, 0xAF, 0xC7, 0x2A,
+    0xD1, 0xAC, 0xA7, 0x1C, 0xA3, 0xAA, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFA, 0x6E, 0xA9,
+    0x09, 0xAF, 0x4E, 0x95, 0xAE, 0x2A, 0xD9, 0x7E, 0x91, 0xE7, 0x09, 0xE0, 0x9D, 0x97, 0x1E, 0x0A,
+    0xD7, 0x2E, 0x0A, 0xD7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xE7, 0x2A, 0xD0, 0xAD, 0x97, 0x1E, 0x09,
+    0xDA, 0x71, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xEA, 0x7E, 0x3E, 0xA4, 0x9E, 0x49, 0xFA, 0xAA, 0xF7,
+    0xAF, 0xEA, 0x72, 0x99, 0x99, 0x77, 0x77, 0x09, 0xCA, 0x76, 0xE9, 0x75, 0xE9, 0x76, 0xA9, 0x70,
+    0x4A, 0xCA, 0x70, 0x9E, 0xA7, 0xDA, 0xD9, 0x5A, 0xCA, 0x09, 0xD4, 0x9D, 0x2A, 0xC9, 0x77, 0x76,
+    0x9F, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x39, 0xE0, 0x9D, 0x5A, 0xD9, 0xAD, 0x6D, 0xAD, 0xA6, 0xFC,
+    0xA6, 0xFC, 0xA6, 0xDA, 0xE6, 0xDA, 0xAD, 0x95, 0xD1, 0xE4, 0xDA, 0x1A, 0xEA, 0x9A, 0xE3, 0x9F,
+    0xDA, 0x69, 0x99, 0x97, 0x77, 0xD7, 0x1A, 0xDA, 0x70, 0xAD, 0x97, 0x19, 0x94, 0x72, 0xA7, 0x79,
+    0xD9, 0x75, 0xF7, 0x5E, 0xA4, 0x99, 0x7A, 0x96, 0xDA, 0x77, 0xDA, 0x59, 0xAA, 0xAA, 0x92, 0x9D,
+    0x4A, 0xFF, 0xA9, 0xD9, 0x3E, 0xA9, 0x09, 0xAF, 0xC4, 0xE9, 0x5A, 0xE3, 0xAD, 0x97, 0xE9, 0x2E,
+    0x70, 0x9E, 0x19, 0xD9, 0x71, 0xE1, 0xAD, 0x72, 0xE1, 0xAD, 0x72, 0xAD, 0x1E, 0x72, 0xAD, 0x1E,
+    0x72, 0xAD, 0x1A, 0xD9, 0x71, 0xE1, 0x9D, 0xA7, 0x1D, 0xA2, 0xE7, 0x0A, 0xD9, 0x2E, 0xA7, 0xE4,
+    0xEA, 0x49, 0xE5, 0x9F, 0xAA, 0xAF, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x70, 0x77, 0x59, 0xC9,
+    0x73, 0xDA, 0x72, 0xE7, 0x29, 0xD7, 0x3A, 0xC3, 0x9A, 0x97, 0x39, 0xD7, 0x3A, 0xD3, 0x9F, 0xCA,
+    0x9D, 0x92, 0xFA, 0xFC, 0x92, 0xAD, 0x39, 0xE2, 0x9D, 0x5A, 0xD9, 0x1A, 0xD6, 0xDA, 0x1D, 0xA6,
+    0xE1, 0xDA, 0x6E, 0x1D, 0xA6, 0xDA, 0x1E, 0x6D, 0xA1, 0xAD, 0x95, 0xD3, 0xE4, 0xDA, 0x3A, 0xEA,
+    0x9A, 0xE5, 0x9F, 0xDA, 0x70, 0x99, 0x99, 0x60, 0x49, 0x97, 0x70, 0xE7, 0x7A, 0xE9, 0x76, 0x9E,
+    0xA4, 0x99, 0x71, 0x9A, 0x4D, 0xA7, 0x7D, 0xA5, 0x9A, 0xAA, 0xA9, 0x29, 0xD4, 0xAF, 0xFA, 0x9D,
+    0x93, 0xEA, 0x90, 0x9A, 0xFC, 0x4E, 0x95, 0xAE, 0x3A, 0xD9, 0x7E, 0x92, 0xE7, 0x09, 0xE1, 0x9D,
+    0x97, 0x1E, 0x1A, 0xD7, 0x2E, 0x1A, 0xD7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD,
+    0x97, 0x1E, 0x19, 0xDA, 0x71, 0xDA, 0x2E, 0x70, 0xAD, 0x92, 0xEA, 0x7E, 0x4E, 0xA4, 0x9E, 0x59,
+    0xFA, 0xAA, 0xF7, 0x0A, 0xFE, 0xA7, 0x39, 0x99, 0x97, 0x00, 0x39, 0x74, 0xD7, 0x4E, 0x73, 0x9D,
+    0xA7, 0x39, 0xDA, 0x74, 0xAA, 0x29, 0xA9, 0x73, 0x9D, 0x73, 0xAD, 0x39, 0xFC, 0xA9, 0xD9, 0x2F,
+    0xAF, 0xC9, 0x2A, 0xD3, 0x9E, 0x29, 0xD5, 0xAD, 0x91, 0xAD, 0x6D, 0xA1, 0xDA, 0x6E, 0x1D, 0xA6,
+    0xE1, 0xDA, 0x6D, 0xA1, 0xE6, 0xDA, 0x1A, 0xD9, 0x5D, 0x3E, 0x4D, 0xA3, 0xAE, 0xA9, 0xAE, 0x59,
+    0xFD, 0xA7, 0x09, 0x99, 0x96, 0x77, 0x70, 0xAF, 0x97, 0x39, 0xD9, 0xAD, 0x73, 0x9C, 0x2D, 0x77,
+    0xAC, 0xA7, 0x59, 0xD9, 0x49, 0x97, 0x9C, 0x6D, 0xA7, 0x96, 0xDA, 0x59, 0xAA, 0xAA, 0x92, 0x9D,
+    0x4A, 0xFF, 0xA9, 0xD9, 0x3E, 0xA9, 0x09, 0xAF, 0xC4, 0xE9, 0x5A, 0xE3, 0xAD, 0x97, 0xE9, 0x2E,
+    0x70, 0x9E, 0x19, 0xD9, 0x71, 0xE1, 0xAD, 0x72, 0xE1, 0xAD, 0x72, 0xAD, 0x1E, 0x72, 0xAD, 0x1E,
+    0x72, 0xAD, 0x1A, 0xD9, 0x71, 0xE1, 0x9D, 0xA7, 0x1D, 0xA2, 0xE7, 0x0A, 0xD9, 0x2E, 0xA7, 0xE4,
+    0xEA, 0x49, 0xE5, 0x9F, 0xAA, 0xAF, 0x70, 0xAF, 0xEA, 0x73, 0x99, 0x99, 0x70, 0x49, 0xA9, 0x71,
+    0x9F, 0xC9, 0x7A, 0xC9, 0x0A, 0xCA, 0x79, 0xC1, 0x9C, 0xA7, 0x29, 0xD7, 0x2D, 0xA7, 0x3A, 0xC3,
+    0x9A, 0x97, 0x39, 0xD7, 0x3A, 0xD3, 0x9F, 0xCA, 0x9D, 0x92, 0xFA, 0xFC, 0x92, 0xAD, 0x39, 0xE2,
+    0x9D, 0x5A, 0xD9, 0x1A, 0xD6, 0xDA, 0x1D, 0xA6, 0xE1, 0xDA, 0x6E, 0x1D, 0xA6, 0xDA, 0x1E, 0x6D,
+    0xA1, 0xAD, 0x95, 0xD3, 0xE4, 0xDA, 0x3A, 0xEA, 0x9A, 0xE5, 0x9F, 0xDA, 0x70, 0x99, 0x99, 0x60,
+    0x59, 0x92, 0x97, 0x3F, 0x1C, 0xA7, 0x2D, 0xAF, 0xA7, 0x2C, 0x90, 0x9E, 0x39, 0x97, 0x29, 0x4D,
+    0xA7, 0x7D, 0xA5, 0x9A, 0xAA, 0xA9, 0x29, 0xD4, 0xAF, 0xFA, 0x9D, 0x93, 0xEA, 0x90, 0x9A, 0xFC,
+    0x4E, 0x95, 0xAE, 0x3A, 0xD9, 0x7E, 0x92, 0xE7, 0x09, 0xE1, 0x9D, 0x97, 0x1E, 0x1A, 0xD7, 0x2E,
+    0x1A, 0xD7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x97, 0x1E, 0x19, 0xDA, 0x71,
+    0xDA, 0x2E, 0x70, 0xAD, 0x92, 0xEA, 0x7E, 0x4E, 0xA4, 0x9E, 0x59, 0xFA, 0xAA, 0xF7, 0x0A, 0xFE,
+    0xA7, 0x39, 0x99, 0x97, 0x00, 0x77, 0x1E, 0x91, 0xC6, 0x9F, 0xAD, 0x95, 0x9C, 0x1F, 0x79, 0x29,
+    0xA1, 0x9A, 0x97, 0x39, 0xD7, 0x3A, 0xD3, 0x9F, 0xCA, 0x9D, 0x92, 0xFA, 0xFC, 0x92, 0xAD, 0x39,
+    0xE2, 0x9D, 0x5A, 0xD9, 0x1A, 0xD6, 0xDA, 0x1D, 0xA6, 0xE1, 0xDA, 0x6E, 0x1D, 0xA6, 0xDA, 0x1E,
+    0x6D, 0xA1, 0xAD, 0x95, 0xD3, 0xE4, 0xDA, 0x3A, 0xEA, 0x9A, 0xE5, 0x9F, 0xDA, 0x70, 0x99, 0x99,
+    0x60, 0x77, 0x99, 0x77, 0x0D, 0xA7, 0x7D, 0xA5, 0x9A, 0xAA, 0xA9, 0x29, 0xD4, 0xAF, 0xFA, 0x9D,
+    0x93, 0xEA, 0x90, 0x9A, 0xFC, 0x4E, 0x95, 0xAE, 0x3A, 0xD9, 0x7E, 0x92, 0xE7, 0x09, 0xE1, 0x9D,
+    0x97, 0x1E, 0x1A, 0xD7, 0x2E, 0x1A, 0xD7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD,
+    0x97, 0x1E, 0x19, 0xDA, 0x71, 0xDA, 0x2E, 0x70, 0xAD, 0x92, 0xEA, 0x7E, 0x4E, 0xA4, 0x9E, 0x59,
+    0xFA, 0xAA, 0xF7, 0x0A, 0xFE, 0xA7, 0x39, 0x99, 0x97, 0x77, 0x72, 0x9C, 0xA7, 0x7E, 0x97, 0x6E,
+    0x97, 0x7A, 0x97, 0x00, 0x72, 0x9A, 0x97, 0x39, 0xD7, 0x3A, 0xD3, 0x9F, 0xCA, 0x9D, 0x92, 0xFA,
+    0xFC, 0x92, 0xAD, 0x39, 0xE2, 0x9D, 0x5A, 0xD9, 0x1A, 0xD6, 0xDA, 0x1D, 0xA6, 0xE1, 0xDA, 0x6E,
+    0x1D, 0xA6, 0xDA, 0x1E, 0x6D, 0xA1, 0xAD, 0x95, 0xD3, 0xE4, 0xDA, 0x3A, 0xEA, 0x9A, 0xE5, 0x9F,
+    0xDA, 0x70, 0x99, 0x99, 0x77, 0x72, 0xAC, 0xA7, 0x3E, 0x73, 0xE7, 0x49, 0x70, 0x09, 0x99, 0x99,
+    0x95, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x3F, 0xDA, 0x09, 0xAD, 0xA6, 0x9E, 0x4D, 0x97, 0xAC, 0xA4,
+    0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A,
+    0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D,
+    0xA7, 0xD9, 0x4E, 0x69, 0xD5, 0x9E, 0x49, 0xDA, 0x6F, 0xCA, 0xFC, 0x70, 0xAF, 0xEA, 0x74, 0x99,
+    0x97, 0x77, 0x72, 0x9D, 0x77, 0xEA, 0x76, 0xE9, 0x77, 0x99, 0x70, 0x77, 0x1A, 0xE3, 0xAA, 0xDA,
+    0x2A, 0xF3, 0xF9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A,
+    0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA,
+    0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x77, 0x70, 0xAC, 0x97, 0x4A, 0xDA, 0x74, 0x9D,
+    0xA7, 0x59, 0x97, 0x77, 0x71, 0x9F, 0x97, 0x39, 0xD9, 0xAD, 0x73, 0x9C, 0x91, 0xD7, 0x7A, 0xCA,
+    0x75, 0x9D, 0x97, 0x69, 0xC9, 0x77, 0x09, 0x71, 0x99, 0x99, 0x99, 0x59, 0x99, 0x99, 0x99, 0xFD,
+    0x93, 0xFD, 0xA0, 0x9A, 0xDA, 0x69, 0xE4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A,
+    0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D,
+    0x97, 0xAC, 0xA4, 0xD9, 0x7A, 0xCA, 0x4D, 0x97, 0xAC, 0xA4, 0xDA, 0x7D, 0x94, 0xE6, 0x9D, 0x59,
+    0xE4, 0x9D, 0xA6, 0xFC, 0xAF, 0xC7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x59, 0xAA, 0x97, 0x3F,
+    0xCA, 0x71, 0x9C, 0xA0, 0x9D, 0x72, 0xC2, 0xD7, 0x5D, 0x97, 0x3A, 0xCA, 0x75, 0x9C, 0x77, 0x77,
+    0x73, 0xAE, 0x3A, 0xAD, 0xA2, 0xAF, 0x3F, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94,
+    0x9D, 0x93, 0xE9, 0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59, 0x99, 0x70, 0x73, 0xA7, 0x70,
+    0x9D, 0x97, 0x6A, 0xE9, 0x75, 0xEA, 0x49, 0x97, 0x0A, 0x96, 0xDA, 0x77, 0x0D, 0xA0, 0x99, 0x99,
+    0x99, 0x59, 0x99, 0xAD, 0x99, 0xFD, 0x93, 0xFD, 0x91, 0x9A, 0xDA, 0x69, 0xDA, 0x5D, 0x97, 0xAC,
+    0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9,
+    0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA,
+    0x5D, 0xA7, 0xD9, 0x5E, 0x69, 0xD6, 0x9E, 0x49, 0xDA, 0x7F, 0xCA, 0xFC, 0x71, 0xAF, 0xEA, 0x75,
+    0x99, 0x97, 0x00, 0x77, 0x71, 0xD7, 0x5E, 0x74, 0xAD, 0x97, 0x4D, 0x97, 0x49, 0xC4, 0x9A, 0x97,
+    0x59, 0xD7, 0x5A, 0xD1, 0xAE, 0x3A, 0xAF, 0x1A, 0xF3, 0xFA, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A,
+    0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x00,
+    0x6A, 0x77, 0x1A, 0xD7, 0x70, 0x9E, 0xA7, 0x79, 0xAE, 0x49, 0x97, 0x29, 0xA4, 0xDA, 0x77, 0x0D,
+    0xA0, 0x99, 0x99, 0x99, 0x59, 0x99, 0xAD, 0x99, 0xFD, 0x93, 0xFD, 0x91, 0x9A, 0xDA, 0x69, 0xDA,
+    0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97,
+    0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5,
+    0xD9, 0x7A, 0xCA, 0x5D, 0xA7, 0xD9, 0x5E, 0x69, 0xD6, 0x9E, 0x49, 0xDA, 0x7F, 0xCA, 0xFC, 0x71,
+    0xAF, 0xEA, 0x75, 0x99, 0x97, 0x00, 0x49, 0x76, 0xAC, 0x97, 0x5E, 0x76, 0xE7, 0x6E, 0x76, 0x9C,
+    0x39, 0xA9, 0x75, 0x9D, 0x75, 0xAD, 0x1A, 0xE3, 0xAA, 0xF1, 0xAF, 0x3F, 0xA4, 0xAD, 0x5D, 0x94,
+    0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD,
+    0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9, 0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF, 0x59,
+    0x99, 0x70, 0x77, 0x72, 0x9F, 0x97, 0x49, 0xD9, 0xAD, 0x74, 0x9C, 0x91, 0xD7, 0x70, 0xAC, 0xA7,
+    0x69, 0xD9, 0x49, 0x97, 0x1C, 0x95, 0xDA, 0x70, 0x96, 0xDA, 0x09, 0x99, 0x99, 0x95, 0x99, 0x9A,
+    0xD9, 0x9F, 0xD9, 0x3F, 0xD9, 0x19, 0xAD, 0xA6, 0x9D, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC,
+    0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9,
+    0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xDA, 0x7D, 0x95,
+    0xE6, 0x9D, 0x69, 0xE4, 0x9D, 0xA7, 0xFC, 0xAF, 0xC7, 0x1A, 0xFE, 0xA7, 0x59, 0x99, 0x70, 0x59,
+    0xAA, 0x97, 0x3F, 0xCA, 0x71, 0x9C, 0xA0, 0x9D, 0x72, 0xC2, 0xD7, 0x5D, 0x97, 0x3A, 0xCA, 0x75,
+    0x9C, 0x49, 0xA9, 0x75, 0x9D, 0x75, 0xAD, 0x1A, 0xE3, 0xAA, 0xF1, 0xAF, 0x3F, 0xA4, 0xAD, 0x5D,
+    0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94,
+    0xAD, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0x9D, 0x93, 0xE9, 0x5F, 0xAF, 0xDA, 0x94, 0xFC, 0xA0, 0xAF,
+    0x59, 0x99, 0x70, 0x69, 0x97, 0x70, 0xAE, 0x90, 0xD7, 0x3D, 0xAF, 0xC7, 0x3C, 0xA0, 0x9E, 0x92,
+    0x99, 0x77, 0x1D, 0xA7, 0x70, 0xDA, 0x09, 0x99, 0x99, 0x95, 0x99, 0x9A, 0xD9, 0x9F, 0xD9, 0x3F,
+    0xD9, 0x19, 0xAD, 0xA6, 0x9D, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA,
+    0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97,
+    0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xDA, 0x7D, 0x95, 0xE6, 0x9D, 0x69, 0xE4,
+    0x9D, 0xA7, 0xFC, 0xAF, 0xC7, 0x1A, 0xFE, 0xA7, 0x59, 0x99, 0x70, 0x77, 0x4A, 0xDA, 0x1C, 0x97,
+    0x0F, 0xAA, 0xCA, 0x70, 0xC9, 0x0A, 0xE9, 0x70, 0x92, 0x9A, 0x91, 0x9A, 0x97, 0x59, 0xD7, 0x5A,
+    0xD1, 0xAE, 0x3A, 0xAF, 0x1A, 0xF3, 0xFA, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49,
+    0xD9, 0x3E, 0x95, 0xFA, 0xFD, 0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x00, 0x77, 0x09, 0x97,
+    0x71, 0xDA, 0x77, 0x0D, 0xA0, 0x99, 0x99, 0x99, 0x59, 0x99, 0xAD, 0x99, 0xFD, 0x93, 0xFD, 0x91,
+    0x9A, 0xDA, 0x69, 0xDA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9,
+    0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA,
+    0x5D, 0x97, 0xAC, 0xA5, 0xD9, 0x7A, 0xCA, 0x5D, 0xA7, 0xD9, 0x5E, 0x69, 0xD6, 0x9E, 0x49, 0xDA,
+    0x7F, 0xCA, 0xFC, 0x71, 0xAF, 0xEA, 0x75, 0x99, 0x97, 0x77, 0x74, 0x9D, 0x77, 0x0E, 0xA7, 0x7A,
+    0xD9, 0x77, 0x09, 0x97, 0x00, 0x74, 0x9A, 0x97, 0x59, 0xD7, 0x5A, 0xD1, 0xAE, 0x3A, 0xAF, 0x1A,
+    0xF3, 0xFA, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5,
+    0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x49, 0xD9, 0x3E, 0x95, 0xFA, 0xFD,
+    0xA9, 0x4F, 0xCA, 0x0A, 0xF5, 0x99, 0x97, 0x77, 0x70, 0xAC, 0x97, 0x4A, 0xDA, 0x74, 0x9D, 0xA7,
+    0x59, 0x97, 0x4A, 0x77, 0xDA, 0x75, 0xF7, 0x5A, 0xE9, 0x76, 0xA9, 0x77, 0x79, 0x99, 0x99, 0x93,
+    0x99, 0x99, 0x99, 0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E, 0xA5, 0xAD, 0x93, 0xE5, 0xD9, 0x4A, 0xD9,
+    0x39, 0xD6, 0xE3, 0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70, 0xE1, 0xD7, 0x2D, 0x9A, 0xCA, 0x72, 0xAF,
+    0x74, 0xE9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x73, 0x9A, 0xFA, 0x97,
+    0x9F, 0xEA, 0x30, 0x77, 0x2D, 0x73, 0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0x9D, 0x97, 0x4C, 0xA7, 0x77,
+    0x73, 0x9F, 0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91, 0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4,
+    0xD9, 0x3D, 0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA, 0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D,
+    0x9D, 0x71, 0xAE, 0xA7, 0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x2A, 0xD9, 0x69, 0x9A,
+    0xEA, 0x7A, 0xFC, 0x70, 0x9D, 0xA9, 0x71, 0x09, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0xAF, 0xDA,
+    0x19, 0xFC, 0xA0, 0x9E, 0xA5, 0xAD, 0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3, 0xD9, 0x69,
+    0xD9, 0x1A, 0xCA, 0x70, 0xE1, 0xD7, 0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74, 0xAD, 0x75,
+    0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x77, 0x77, 0x74,
+    0xAC, 0xA7, 0x5E, 0x75, 0xE7, 0x59, 0xA7, 0x9F, 0xCA, 0x1A, 0xFA, 0x0F, 0xA9, 0x19, 0xAE, 0x91,
+    0xDA, 0x5D, 0x92, 0xAD, 0x49, 0xD4, 0xD9, 0x3D, 0x94, 0xAD, 0x3D, 0x59, 0xD2, 0xAC, 0xA6, 0xDA,
+    0x1D, 0x79, 0xD0, 0x9C, 0xA7, 0x0D, 0x9D, 0x71, 0xAE, 0xA7, 0x2E, 0x97, 0x2A, 0xD7, 0x3D, 0x97,
+    0x2A, 0xD7, 0x2A, 0xD9, 0x19, 0xCA, 0x19, 0x9A, 0xEA, 0x2E, 0x90, 0xAF, 0xC3, 0xE1, 0x9D, 0xA9,
+    0x59, 0x20, 0x77, 0x6F, 0xC7, 0x2D, 0xA9, 0xDA, 0x71, 0xD1, 0xAC, 0xA7, 0x5D, 0x97, 0x3D, 0xA7,
+    0x5A, 0xC7, 0x77, 0x19, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E,
+    0xA5, 0xAD, 0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3, 0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70,
+    0xE1, 0xD7, 0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75,
+    0xAD, 0x75, 0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x30, 0x5A, 0xA9, 0x71, 0x9F, 0xC7, 0x0D,
+    0x1D, 0x97, 0xAA, 0x1A, 0xC9, 0x72, 0x9D, 0x72, 0xD9, 0x73, 0xCA, 0x77, 0x77, 0x49, 0xFC, 0xA1,
+    0xAF, 0xA0, 0xFA, 0x91, 0x9A, 0xE9, 0x1D, 0xA5, 0xD9, 0x2A, 0xD4, 0x9D, 0x4D, 0x93, 0xD9, 0x4A,
+    0xD3, 0xD5, 0x9D, 0x2A, 0xCA, 0x6D, 0xA1, 0xD7, 0x9D, 0x09, 0xCA, 0x70, 0xD9, 0xD7, 0x1A, 0xEA,
+    0x72, 0xE9, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xAD, 0x72, 0xAD, 0x96, 0x99, 0xAE, 0xA7, 0xAF, 0xC7,
+    0x09, 0xDA, 0x97, 0x10, 0x59, 0x97, 0x5E, 0xA0, 0x9C, 0x97, 0xAF, 0xE9, 0x79, 0xC1, 0xAE, 0x77,
+    0x77, 0x79, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0xAF, 0xDA, 0x19, 0xFC, 0xA0, 0x9E, 0xA5, 0xAD,
+    0x93, 0xE5, 0xD9, 0x4A, 0xD9, 0x39, 0xD6, 0xE3, 0xD9, 0x69, 0xD9, 0x1A, 0xCA, 0x70, 0xE1, 0xD7,
+    0x2D, 0x9A, 0xCA, 0x72, 0xAF, 0x74, 0xE9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75,
+    0xAD, 0x73, 0x9A, 0xFA, 0x97, 0x9F, 0xEA, 0x30, 0x77, 0x2E, 0x19, 0xC6, 0xAF, 0xAD, 0x6A, 0xC1,
+    0xF7, 0x92, 0xA9, 0x77, 0x77, 0x29, 0xFC, 0xA1, 0xAF, 0xA0, 0xFA, 0x91, 0x9A, 0xE9, 0x1D, 0xA5,
+    0xD9, 0x2A, 0xD4, 0x9D, 0x4D, 0x93, 0xD9, 0x4A, 0xD3, 0xD5, 0x9D, 0x2A, 0xCA, 0x6D, 0xA1, 0xD7,
+    0x9D, 0x09, 0xCA, 0x70, 0xD9, 0xD7, 0x1A, 0xEA, 0x72, 0xE9, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xAD,
+    0x72, 0xAD, 0x96, 0x99, 0xAE, 0xA7, 0xAF, 0xC7, 0x09, 0xDA, 0x97, 0x10, 0x19, 0xA9, 0xA9, 0xA9,
+    0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA1,
+    0x6C, 0x1C, 0x1A, 0xDA, 0x2D, 0x2F, 0x19, 0xA9, 0x92, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9,
+    0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xA9, 0x3A,
+    0x97, 0x73, 0xC9, 0x6C, 0xA0, 0x99, 0x99, 0x99, 0xCA, 0xCA, 0xAA, 0xAA, 0xE3, 0x9C, 0x0C, 0x2A,
+    0xA1, 0xC1, 0x9A, 0x2C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x69, 0x60, 0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x99, 0x99, 0xDA, 0xAA, 0xAA, 0xC0,
+    0xC9, 0x3C, 0x1A, 0xA2, 0xC2, 0xA9, 0x1C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x69, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA,
+    0x00, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x9F, 0xFF, 0xFF, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x09, 0x92, 0x99, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D,
+    0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19,
+    0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9,
+    0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1, 0x9D, 0x9D, 0x19, 0xD9, 0xD1,
+    0x9D, 0x9A, 0xA2, 0xAA, 0xFF, 0xF9, 0xFF, 0xF9, 0x74, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F,
+    0xFF, 0xA7, 0x40, 0x29, 0x2D, 0x1D, 0x2D, 0x1A, 0xCA, 0x1E, 0x1A, 0xD9, 0x1D, 0x90, 0x19, 0x91,
+    0xAD, 0x91, 0xDA, 0x1D, 0xA1, 0xD9, 0x1D, 0x1A, 0xC9, 0x1C, 0xA1, 0x59, 0xD1, 0x9D, 0xA1, 0xDA,
+    0x1D, 0xA1, 0xD1, 0x9C, 0xA1, 0xD2, 0x92, 0x09, 0x91, 0x9D, 0x90, 0xE1, 0xAC, 0xA1, 0x9D, 0x2D,
+    0x29, 0xC9, 0x2A, 0xC0, 0x29, 0x39, 0x2D, 0x2D, 0x1D, 0x2D, 0x2D, 0x2D, 0x1A, 0xCA, 0x1A, 0xCA,
+    0x1E, 0x1E, 0x1A, 0xD9, 0x0A, 0xD9, 0x1D, 0x91, 0xD9, 0x00, 0x19, 0x92, 0x99, 0x1A, 0xD9, 0x0A,
+    0xD9, 0x1D, 0xA1, 0xDA, 0x1D, 0xA1, 0xDA, 0x1D, 0x91, 0xD9, 0x1D, 0x2D, 0x1A, 0xC9, 0x1A, 0xC9,
+    0x1C, 0xA2, 0xCA, 0x10, 0x72, 0x9D, 0x19, 0xD1, 0x9D, 0xA0, 0x9D, 0xA1, 0xDA, 0x1D, 0xA1, 0xDA,
+    0x1D, 0xA1, 0xD2, 0xD1, 0x9C, 0xA1, 0x9C, 0xA1, 0xD2, 0xD2, 0x93, 0x92, 0x09, 0x92, 0x99, 0x19,
+    0xD9, 0x09, 0xD9, 0x0E, 0x1E, 0x1A, 0xCA, 0x1A, 0xCA, 0x19, 0xD1, 0x9D, 0x2D, 0x2D, 0x29, 0xC9,
+    0x19, 0xC9, 0x2A, 0xC2, 0xAC, 0x00, 0x4A, 0xA9, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD5,
+    0xEA, 0xDA, 0xEA, 0x0F, 0xFD, 0xA0, 0x92, 0xAC, 0x71, 0xAC, 0x71, 0xAC, 0x71, 0xD7, 0x1D, 0x97,
+    0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x70, 0x4A, 0xA9, 0x70, 0xDA, 0x70, 0xD9, 0x70,
+    0xD9, 0x70, 0xD5, 0xEA, 0xDA, 0xEA, 0x0F, 0xFD, 0xA0, 0x92, 0xD2, 0x95, 0xD9, 0x70, 0xDA, 0x70,
+    0xD9, 0x70, 0xD9, 0x4A, 0x99, 0x0D, 0x90, 0x9A, 0x90, 0xFF, 0xDA, 0x0D, 0xA9, 0xD9, 0x9A, 0xC9,
+    0x4D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x70, 0x0A, 0xCA, 0x90, 0xAF, 0x0F, 0xC9, 0xAF,
+    0x1E, 0x96, 0x0A, 0x95, 0x9E, 0x93, 0x9F, 0xC9, 0x19, 0xFE, 0x99, 0xFF, 0x9F, 0xDA, 0x09, 0xFA,
+    0x29, 0xDA, 0x59, 0x60, 0x0A, 0xCA, 0x09, 0xE1, 0xE2, 0x91, 0x73, 0xD9, 0x2A, 0xCA, 0x0A, 0xE1,
+    0x9E, 0x09, 0xDA, 0x2E, 0x70, 0x91, 0x77, 0x5D, 0xA4, 0xAD, 0x49, 0xD0, 0xAE, 0x4E, 0x4E, 0xA9,
+    0xDA, 0x4E, 0x4A, 0xD9, 0x19, 0x69, 0x69, 0x10, 0x09, 0xA9, 0x1E, 0x09, 0xE1, 0xAC, 0x90, 0x73,
+    0xC9, 0x6C, 0xA0, 0x92, 0x99, 0xCA, 0xC9, 0x1A, 0xAE, 0x39, 0xC0, 0xC2, 0xAA, 0x1C, 0x19, 0xA2,
+    0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x96,
+    0x71, 0x9C, 0x49, 0xC4, 0xAC, 0x99, 0x29, 0xDA, 0xA1, 0x9C, 0x0C, 0x93, 0xC1, 0xAA, 0x2C, 0x2A,
+    0x91, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+    0xC6, 0x90, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xA9, 0xAA, 0xA0, 0x9A, 0x09, 0xA0, 0xA9, 0x29, 0xA5,
+    0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A,
+    0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x59, 0xA5, 0x9A, 0x72, 0x29, 0x19, 0x6A, 0xA0, 0xC9, 0x6A,
+    0xA0, 0xCA, 0x19, 0x99, 0x99, 0xCA, 0x0A, 0xA0, 0xCA, 0xAA, 0xAD, 0x09, 0xC0, 0xC2, 0x9C, 0x09,
+    0xC1, 0xC1, 0x9C, 0x09, 0xC2, 0xC1, 0xA0, 0x9A, 0x3C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71,
+    0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0x97,
+    0x10, 0x59, 0x59, 0xC0, 0xAA, 0x4A, 0xC0, 0xAA, 0x4A, 0xC0, 0xAC, 0x99, 0x99, 0x90, 0xC9, 0x0D,
+    0xAA, 0xAA, 0xC1, 0xC9, 0x0C, 0x92, 0xC2, 0xAA, 0x0C, 0x91, 0xC3, 0xA9, 0x0A, 0x1C, 0x71, 0xC7,
+    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x19, 0x00, 0x77, 0x77, 0x39, 0x97, 0x0A, 0xA7, 0x70, 0x9F, 0x96,
+    0xD7, 0x79, 0xD9, 0x9D, 0x94, 0xAC, 0x77, 0x0D, 0x29, 0xD3, 0x9C, 0xA7, 0x79, 0xD3, 0xD3, 0xD7,
+    0x70, 0x9C, 0xA3, 0xD2, 0x9C, 0x97, 0x70, 0x9C, 0xA3, 0xD2, 0xD7, 0x71, 0x9C, 0xA3, 0xD1, 0xAC,
+    0x39, 0x76, 0xD2, 0xAC, 0xA1, 0xCA, 0x1A, 0xF4, 0xAF, 0x91, 0xAD, 0x99, 0xD1, 0xAC, 0x1D, 0xA9,
+    0xAD, 0x2A, 0xCA, 0x9A, 0xD2, 0xFC, 0x19, 0xC9, 0x09, 0xCA, 0x2D, 0x91, 0xD2, 0xAC, 0xA3, 0x93,
+    0xD1, 0xAC, 0x92, 0x9C, 0xA0, 0x9C, 0xA2, 0x9D, 0x7A, 0xC2, 0xD9, 0x29, 0xCA, 0x0A, 0xC9, 0x3D,
+    0x7C, 0xA2, 0xD3, 0x9C, 0xA0, 0xAC, 0x93, 0xD6, 0xAC, 0x3D, 0x92, 0xAC, 0xA0, 0xAC, 0xA2, 0x9C,
+    0xA5, 0x9C, 0xA3, 0xAC, 0xA2, 0xD1, 0x9D, 0x2A, 0xC9, 0x5D, 0x5D, 0xA9, 0xAC, 0xA2, 0xDA, 0x9A,
+    0xD5, 0xAC, 0x95, 0x9F, 0xA4, 0xFC, 0x6A, 0xC7, 0x09, 0x97, 0x99, 0x77, 0x77, 0x30, 0x6A, 0xC9,
+    0x1D, 0xA0, 0x9D, 0x1D, 0xA0, 0x9D, 0x1A, 0xC9, 0x1C, 0xA7, 0x73, 0xAC, 0x91, 0xAC, 0x91, 0xDA,
+    0x1D, 0x90, 0x9D, 0x1A, 0xD1, 0xDA, 0x1D, 0xA0, 0x9D, 0x19, 0xD1, 0xAC, 0x91, 0xD9, 0x1C, 0xA2,
+    0xCA, 0x74, 0x77, 0x0A, 0xC9, 0x1A, 0xC9, 0x1D, 0x2D, 0xA1, 0xD9, 0x09, 0xD9, 0x09, 0xD1, 0xAD,
+    0x1A, 0xD1, 0xDA, 0x1D, 0xA1, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xD1, 0xAC, 0x91, 0xD9, 0x1D, 0x2C,
+    0xA2, 0xCA, 0x2C, 0x97, 0x71, 0x6D, 0x3D, 0xA2, 0xAD, 0x3D, 0x92, 0xAD, 0x3D, 0x93, 0xC9, 0x50,
+    0x73, 0xD2, 0x9C, 0xA2, 0xDA, 0x1A, 0xD2, 0xAD, 0x2D, 0x92, 0xD9, 0x1A, 0xD2, 0xAD, 0x2D, 0x92,
+    0xD9, 0x19, 0xD3, 0xC9, 0x2A, 0xC7, 0x20, 0x77, 0x1D, 0x29, 0xCA, 0x2D, 0x3D, 0xA1, 0xAD, 0x2D,
+    0x92, 0xAD, 0x2D, 0x91, 0xE3, 0xD9, 0x1A, 0xD2, 0xD9, 0x2A, 0xD2, 0xD9, 0x1A, 0xD3, 0xD9, 0x19,
+    0xD2, 0xD4, 0xC9, 0x2A, 0xC3, 0xC9, 0x77, 0x00, 0x39, 0xA7, 0x9D, 0xA5, 0x9D, 0x9C, 0xA3, 0x9D,
+    0x19, 0xCA, 0x19, 0xD3, 0x9C, 0xA7, 0x30, 0x4C, 0x92, 0x9D, 0x29, 0xD2, 0xAD, 0x92, 0xDA, 0x3E,
+    0x4A, 0xD4, 0xAC, 0xA4, 0x9C, 0xA6, 0x9C, 0x5D, 0x94, 0xD9, 0x39, 0xDA, 0x3A, 0xD3, 0xE2, 0xDA,
+    0x2D, 0xA2, 0x9C, 0x97, 0x20, 0x77, 0xAA, 0x73, 0xC1, 0xCA, 0x3A, 0x93, 0xCA, 0x2C, 0xA1, 0x9D,
+    0x2C, 0xA4, 0xC9, 0x1A, 0x91, 0xCA, 0x59, 0xC9, 0x3D, 0x79, 0xC9, 0x1A, 0xC7, 0x19, 0xC9, 0xAC,
+    0x69, 0xD1, 0x9D, 0x2D, 0x29, 0xD1, 0xAD, 0x2D, 0x69, 0xC0, 0xAC, 0x71, 0x9C, 0x91, 0xAC, 0x79,
+    0xC9, 0x3A, 0xC6, 0xC9, 0x1C, 0xA1, 0xD4, 0xC9, 0x19, 0xD2, 0xCA, 0x2C, 0xA3, 0xA9, 0x3C, 0xA0,
+    0xAA, 0x73, 0xC7, 0x70, 0x0A, 0xA4, 0xAA, 0x0A, 0xD3, 0xE0, 0xE3, 0xDA, 0x0D, 0xA3, 0xDA, 0x0D,
+    0xA3, 0xD9, 0x0D, 0xA3, 0xD9, 0x0D, 0x93, 0xD9, 0x0D, 0x93, 0xD1, 0xD9, 0x3D, 0x1D, 0x93, 0xD1,
+    0xAC, 0x93, 0xD1, 0xAC, 0x93, 0xD1, 0x9C, 0x93, 0xAC, 0x19, 0xC9, 0x3A, 0xC7, 0x77, 0x9C, 0xA3,
+    0x9C, 0xA0, 0xE9, 0x2E, 0x0E, 0x3E, 0x19, 0x59, 0x10, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x90, 0xFC, 0x9A, 0xAA, 0xAA, 0x00,
+    0x77, 0x6A, 0xA7, 0x2D, 0x71, 0xAC, 0x97, 0x1C, 0xA7, 0x1A, 0xC7, 0x2C, 0xA7, 0x1D, 0x71, 0x9C,
+    0x97, 0x1D, 0x71, 0x9C, 0x72, 0xCA, 0x71, 0xAC, 0x72, 0xCA, 0x71, 0xAC, 0x71, 0x9C, 0x97, 0x1D,
+    0x71, 0xAC, 0x97, 0x1D, 0x71, 0xAC, 0x97, 0x29, 0x72, 0x77, 0x49, 0xEA, 0x5F, 0x93, 0xFD, 0x92,
+    0xAF, 0xCA, 0x2C, 0xAA, 0xAE, 0x91, 0x9C, 0xA9, 0xAD, 0xA6, 0xAD, 0x7D, 0x96, 0xD7, 0x9C, 0xA6,
+    0x9C, 0x97, 0xD6, 0xAC, 0x97, 0xD4, 0x9E, 0x59, 0xAD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFC, 0x2F, 0xC9,
+    0x39, 0xFA, 0x3D, 0xA9, 0x59, 0xD9, 0x5A, 0xC7, 0x0C, 0xA6, 0x9C, 0x70, 0xCA, 0x77, 0x77, 0x77,
+    0xAC, 0x79, 0xCA, 0x5A, 0xDA, 0x6E, 0x59, 0xD9, 0x6E, 0x69, 0x97, 0x09, 0x40, 0x75, 0xAA, 0x19,
+    0xEA, 0x6E, 0x1F, 0xD9, 0x4D, 0xA1, 0xCA, 0xAA, 0xE9, 0x3D, 0xA6, 0xAD, 0x3D, 0x97, 0xD3, 0xD9,
+    0x79, 0xC9, 0x2D, 0x97, 0xAC, 0x92, 0xD9, 0x59, 0xE3, 0xD9, 0x29, 0xFC, 0xA3, 0xD9, 0x2F, 0xC9,
+    0x4D, 0x92, 0xDA, 0x96, 0xAC, 0x92, 0xAC, 0x70, 0xAC, 0x92, 0x9C, 0x70, 0xAC, 0x77, 0x77, 0x6A,
+    0xC7, 0x9C, 0xA2, 0xAD, 0xA6, 0xE9, 0x19, 0xD9, 0x6E, 0x39, 0x97, 0x09, 0x10, 0x0A, 0xA7, 0x4A,
+    0xD3, 0xAE, 0xA3, 0xE3, 0xFD, 0x2D, 0xA3, 0xCA, 0xAA, 0xE1, 0xDA, 0x70, 0xAC, 0xA0, 0xDA, 0x71,
+    0xD0, 0xD9, 0x71, 0xAC, 0x0D, 0x97, 0x1D, 0x0D, 0x97, 0x9E, 0x0D, 0x94, 0xAF, 0xC9, 0x0A, 0xC9,
+    0x4F, 0xC9, 0x1A, 0xC9, 0x4D, 0xA4, 0x9C, 0x94, 0xD5, 0x9C, 0x94, 0x9C, 0x77, 0x77, 0x59, 0xCA,
+    0x5C, 0xA4, 0xE9, 0x3A, 0xD9, 0x3E, 0x4A, 0xD9, 0x49, 0x69, 0x50, 0x77, 0x09, 0xEA, 0x49, 0xA1,
+    0x9D, 0xAF, 0x99, 0xAD, 0x1C, 0xA2, 0x9A, 0xFC, 0x29, 0x69, 0x99, 0x20, 0x77, 0x5A, 0xC9, 0x1A,
+    0xC9, 0x1D, 0x2D, 0x2D, 0xA1, 0xD9, 0x09, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xD1, 0xAD, 0x1E, 0x1D,
+    0xA1, 0xDA, 0x1D, 0x90, 0x9D, 0x90, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xCA, 0x1A, 0xC9, 0x1D, 0x91,
+    0xD2, 0xD2, 0xCA, 0x2C, 0xA2, 0xC9, 0x19, 0xC9, 0x77, 0x60, 0x39, 0xAA, 0x94, 0x9F, 0xD3, 0xDA,
+    0x09, 0xDA, 0x1A, 0xCA, 0x29, 0xD1, 0xD9, 0x3D, 0x1D, 0x4D, 0x90, 0xD4, 0xD9, 0x0D, 0x4D, 0x1D,
+    0x92, 0x9D, 0x1A, 0xD2, 0xDA, 0x2E, 0xAE, 0x4A, 0xEA, 0x75, 0x69, 0x70, 0xD9, 0x6E, 0x95, 0xAE,
+    0x94, 0x9C, 0xAA, 0xC9, 0x4D, 0x0A, 0xC9, 0x3D, 0x1A, 0xC9, 0x2A, 0xCA, 0x99, 0xAC, 0x99, 0x1F,
+    0xFC, 0x29, 0x99, 0x9D, 0xA9, 0x6A, 0xC9, 0x7A, 0xC9, 0x74, 0x29, 0x99, 0x93, 0xFD, 0x2D, 0x99,
+    0x99, 0x2C, 0xA6, 0xDA, 0x93, 0x9F, 0xC5, 0x9E, 0x6D, 0x6D, 0x5A, 0xCA, 0x1A, 0xAF, 0x2F, 0x97,
+    0x30, 0x49, 0xA9, 0x4F, 0x91, 0x9D, 0xA4, 0xD9, 0x4E, 0x99, 0x3F, 0xDA, 0x09, 0xD1, 0x9D, 0x99,
+    0xCA, 0x29, 0xD9, 0xD2, 0x9D, 0x0D, 0x91, 0xAC, 0xA0, 0xAF, 0xD2, 0xAE, 0xA7, 0x20, 0x09, 0x99,
+    0x99, 0x90, 0xAF, 0xFC, 0x99, 0x9A, 0xEA, 0x2D, 0x4A, 0xC9, 0x39, 0xD4, 0xD4, 0x9D, 0x4A, 0xC9,
+    0x4D, 0x5D, 0x5C, 0xA7, 0x30, 0x29, 0xA9, 0x93, 0xFC, 0xA1, 0xAC, 0x91, 0xD1, 0xD2, 0xAC, 0x90,
+    0xAC, 0xA0, 0x9D, 0x2A, 0xF3, 0xFC, 0x91, 0xD9, 0x09, 0xD9, 0x9C, 0xA2, 0x9C, 0xA9, 0xCA, 0x2A,
+    0xCA, 0x0D, 0xA9, 0xAD, 0x2A, 0xEA, 0x72, 0x29, 0xA9, 0x4F, 0xC9, 0x1D, 0x90, 0x9D, 0x09, 0xD2,
+    0xAC, 0xA9, 0xD2, 0x9D, 0x0D, 0x91, 0x9C, 0xA0, 0x9F, 0xDA, 0x19, 0xFC, 0x94, 0x9D, 0x49, 0xD9,
+    0x19, 0xAE, 0x92, 0xEA, 0x74, 0x19, 0x19, 0x93, 0xEA, 0xF2, 0x9A, 0xD9, 0x0A, 0xCA, 0x29, 0xCA,
+    0x2D, 0x29, 0xCA, 0x2D, 0x29, 0xCA, 0x2D, 0x29, 0xCA, 0x2D, 0x2A, 0xCA, 0x19, 0xD9, 0x0A, 0xE9,
+    0x0F, 0x00, 0x29, 0xEA, 0x4A, 0xFD, 0x91, 0x9D, 0x2A, 0xD1, 0xAC, 0x93, 0xD1, 0xD4, 0xD1, 0xD4,
+    0xD9, 0x0D, 0x4D, 0x1D, 0x4D, 0x1D, 0x92, 0x9D, 0x19, 0xD9, 0x09, 0xD9, 0x2A, 0xFC, 0x94, 0x9A,
+    0xA9, 0x30, 0x72, 0xAC, 0x2A, 0xF2, 0x9A, 0xAD, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x49, 0xD9,
+    0x19, 0xFD, 0x19, 0x99, 0x99, 0x10, 0x19, 0xAD, 0xA2, 0xAD, 0xAE, 0x1D, 0x2D, 0x90, 0xCA, 0x2D,
+    0x95, 0xD5, 0xD9, 0x4D, 0xA4, 0xDA, 0x4D, 0x94, 0xEA, 0xAA, 0xAA, 0x0F, 0xF1, 0x99, 0x99, 0x91,
+    0x1A, 0xEA, 0x2E, 0xAD, 0xA1, 0xC9, 0x2D, 0x59, 0xCA, 0x4A, 0xD3, 0xAF, 0x39, 0x99, 0xAD, 0x6D,
+    0x6D, 0x49, 0xDA, 0x1F, 0xCA, 0x29, 0xAA, 0x93, 0x5A, 0xC9, 0x6A, 0xD9, 0x59, 0xE9, 0x5F, 0x94,
+    0xD9, 0xAC, 0x93, 0xAC, 0x90, 0xAC, 0x92, 0x9C, 0xA1, 0xAC, 0x92, 0xDA, 0xAA, 0xEA, 0x1A, 0xFF,
+    0x6A, 0xC9, 0x7A, 0xC9, 0x79, 0xA2, 0x1A, 0xAA, 0xAA, 0xA2, 0xFD, 0x2D, 0x6C, 0xA6, 0xF9, 0x3A,
+    0xAE, 0x95, 0x9D, 0x6D, 0x59, 0xD4, 0xAD, 0x90, 0x9F, 0xC9, 0x29, 0xAA, 0x93, 0x39, 0xAD, 0x92,
+    0xAD, 0xA9, 0x2A, 0xD4, 0xAD, 0x5F, 0xCA, 0x19, 0xFE, 0x09, 0xCA, 0x2D, 0xA9, 0xCA, 0x29, 0xD9,
+    0xD2, 0x9D, 0x0D, 0xA1, 0xD9, 0x09, 0xFC, 0xA3, 0x9A, 0xA9, 0x10, 0x9A, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xCA, 0x2A, 0xC9, 0xA9, 0x19, 0xD4, 0xD4, 0x9C, 0xA4, 0xD4, 0x9C, 0xA4, 0xD5, 0xD5, 0xCA, 0x5A,
+    0x93, 0x19, 0xEA, 0x29, 0xDA, 0xAD, 0x1D, 0x2A, 0xC9, 0x0D, 0x2D, 0x19, 0xD9, 0xAC, 0xA2, 0xAF,
+    0x29, 0xD9, 0xE1, 0xD2, 0xDA, 0x9C, 0xA2, 0x9C, 0xA9, 0xD2, 0xD9, 0x0A, 0xFC, 0xA2, 0x9A, 0xA9,
+    0x20, 0x19, 0xEA, 0x2A, 0xDA, 0xE1, 0xD2, 0xD9, 0x9D, 0x29, 0xCA, 0x9D, 0x29, 0xD0, 0xDA, 0x90,
+    0xAC, 0xA1, 0xFD, 0xA2, 0x9A, 0xAD, 0x5A, 0xCA, 0x39, 0xE2, 0xAE, 0xA3, 0x9A, 0xA4, 0x74, 0x9F,
+    0xFE, 0xA0, 0xAF, 0xFD, 0xA2, 0xD9, 0x4C, 0xA2, 0xD9, 0x4C, 0xA2, 0xD9, 0x49, 0x3D, 0x97, 0x1D,
+    0x97, 0x1F, 0xF9, 0x3F, 0xF9, 0x3D, 0x97, 0x1D, 0x96, 0x9A, 0xAE, 0xAA, 0x49, 0xFE, 0x96, 0xD9,
+    0x71, 0xD9, 0x79, 0xAE, 0xAA, 0x49, 0xFE, 0x40, 0x70, 0x97, 0x19, 0xFC, 0x95, 0x9D, 0xAA, 0xE5,
+    0xD9, 0x2D, 0x93, 0x9D, 0x3A, 0xC9, 0x3A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x0A, 0xFF, 0xC3, 0x9A,
+    0xAD, 0x99, 0x99, 0x95, 0x9D, 0x79, 0xFF, 0xC4, 0x99, 0xDA, 0x99, 0x99, 0x6D, 0x73, 0xD7, 0x2A,
+    0xCA, 0x70, 0xAF, 0xFF, 0x0A, 0xDA, 0xFF, 0xA1, 0xA9, 0x59, 0x99, 0x10, 0x49, 0x99, 0x97, 0x76,
+    0xFF, 0xD9, 0x77, 0x3A, 0xF9, 0x9A, 0xEA, 0x77, 0x4D, 0xA3, 0xAD, 0x77, 0x4D, 0xA4, 0xD9, 0x77,
+    0x3D, 0xA4, 0xDA, 0x2C, 0x77, 0xDA, 0x4D, 0x91, 0xAC, 0x77, 0xDA, 0x39, 0xD2, 0xD9, 0x59, 0x99,
+    0x94, 0xDA, 0x29, 0xDA, 0x0F, 0xF1, 0xFD, 0x3E, 0xAF, 0xA1, 0x99, 0xD9, 0x99, 0x1A, 0xC9, 0x1A,
+    0xC3, 0xFD, 0xA9, 0x4D, 0x4D, 0x29, 0x93, 0xDA, 0x71, 0xD4, 0xAD, 0x96, 0xDA, 0x71, 0xD5, 0xFA,
+    0x4D, 0xA7, 0x1D, 0x69, 0xF3, 0xDA, 0x71, 0xD7, 0x1D, 0x3D, 0xA7, 0x1D, 0x93, 0xCA, 0x2D, 0x19,
+    0xAE, 0xAA, 0x7E, 0x99, 0xA0, 0xD1, 0xAD, 0x1F, 0xE9, 0x69, 0xFA, 0x0F, 0xCA, 0x77, 0x72, 0x99,
+    0x30, 0x71, 0x97, 0x2A, 0xFD, 0xA5, 0xFA, 0xAE, 0x4E, 0x39, 0xCA, 0x3A, 0xD5, 0xC9, 0x29, 0xD9,
+    0x59, 0x3A, 0xD7, 0x1A, 0xAE, 0xAA, 0xAA, 0xA4, 0xFF, 0xCA, 0x59, 0xD7, 0x19, 0xFF, 0xC4, 0x9A,
+    0xAE, 0xAA, 0xAA, 0x7D, 0xA7, 0x3E, 0x73, 0x9D, 0xA7, 0x3E, 0xA5, 0x94, 0xFF, 0xCA, 0x5A, 0xFD,
+    0xA7, 0x19, 0x93, 0x77, 0x19, 0xCA, 0x72, 0x9D, 0x73, 0xD7, 0x3D, 0x99, 0x99, 0x9A, 0xAA, 0xAA,
+    0xA9, 0xAF, 0xFF, 0xCA, 0x0D, 0x97, 0x99, 0x2D, 0x97, 0x4D, 0x97, 0x4C, 0x97, 0x77, 0x49, 0x70,
+    0xE6, 0xFC, 0x4D, 0x9C, 0x9D, 0x2D, 0x09, 0xC1, 0xD1, 0xA1, 0x9C, 0x90, 0x9A, 0x49, 0xC9, 0x79,
+    0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79,
+    0xC9, 0x76, 0x77, 0x7A, 0xC9, 0x74, 0xD9, 0x74, 0xD1, 0x9A, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0xD0,
+    0xAF, 0xFF, 0xCA, 0x09, 0x97, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x73, 0x9C, 0x77, 0x20, 0x4A, 0x70,
+    0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97, 0x9C, 0x97,
+    0x9C, 0x97, 0x9C, 0x94, 0xC9, 0x09, 0xC9, 0x0A, 0xC1, 0xAC, 0x99, 0xC0, 0x9C, 0xA2, 0xAC, 0xAC,
+    0xAC, 0xA4, 0xAE, 0xA6, 0xAC, 0xA7, 0x60, 0x77, 0x1A, 0xC9, 0x29, 0xC9, 0x49, 0xCA, 0x4A, 0xC9,
+    0x29, 0xCA, 0x6A, 0xC9, 0x09, 0xD9, 0x99, 0x99, 0x99, 0x99, 0xD9, 0xFF, 0xFE, 0x0D, 0x70, 0xD2,
+    0xD6, 0xD4, 0xD4, 0xD5, 0x9C, 0x4C, 0x77, 0x20, 0x4A, 0x70, 0xE5, 0x9F, 0xC9, 0x29, 0xD9, 0xC9,
+    0xD9, 0x1D, 0x09, 0xC9, 0x0D, 0x19, 0x19, 0xC9, 0x19, 0x49, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x79,
+    0xC9, 0x79, 0xC9, 0x4A, 0x90, 0x9C, 0x90, 0x9A, 0x1D, 0x09, 0xC9, 0x0D, 0x2D, 0x9C, 0x9D, 0x4F,
+    0xC6, 0xE7, 0x09, 0x40, 0x4A, 0x70, 0xE6, 0xFC, 0x4D, 0x9C, 0x9D, 0x2D, 0x09, 0xC9, 0x0D, 0x19,
+    0x19, 0xC9, 0x19, 0x49, 0xC9, 0x79, 0xC9, 0x79, 0xC9, 0x49, 0x19, 0xC9, 0x19, 0x1D, 0x09, 0xC9,
+    0x0D, 0x2D, 0x9C, 0x9D, 0x4F, 0xC6, 0xE4, 0x99, 0x9A, 0xCA, 0x99, 0x90, 0xAF, 0xFC, 0xA0, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x79, 0x97, 0x0A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC7,
+    0x0A, 0xC4, 0xD1, 0xAC, 0x3D, 0x2A, 0xC2, 0xD3, 0xAC, 0x1D, 0xA9, 0x99, 0x9A, 0xC0, 0x9F, 0xFC,
+    0x1A, 0xCA, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xAA, 0x77, 0x09, 0x97, 0x9C, 0xA7, 0x9C, 0xA7,
+    0x9C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA1, 0xD4, 0xCA, 0x2D, 0x3C, 0xA3, 0xD2,
+    0xCA, 0x99, 0x99, 0xAD, 0x1F, 0xFC, 0x96, 0xAC, 0xA6, 0x9C, 0xA6, 0xAC, 0xA7, 0xAA, 0x76, 0x72,
+    0x97, 0x3D, 0x39, 0x5D, 0x2D, 0x5D, 0x1D, 0x95, 0xD0, 0xD9, 0x6D, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xFD, 0xA0, 0xD7, 0x3D, 0x73, 0xD7, 0x3A, 0x70, 0x39, 0xA7, 0x39, 0xD7, 0x3D, 0x59, 0x99,
+    0x2F, 0xFF, 0xA0, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xC9, 0x74, 0xFF, 0xFC, 0x91, 0xFF,
+    0xFA, 0x2D, 0x75, 0xD7, 0x59, 0x70, 0x4A, 0x70, 0xE6, 0xD0, 0xD3, 0x9D, 0xA0, 0xAD, 0x90, 0x9C,
+    0xAC, 0xA0, 0xAC, 0xAC, 0x99, 0xC0, 0xCA, 0x0A, 0xC0, 0xC9, 0x2C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC,
+    0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C,
+    0xA0, 0xAC, 0x59, 0x90, 0x99, 0x20, 0x70, 0xA9, 0x74, 0xD4, 0x99, 0x95, 0xD2, 0xAF, 0xFF, 0x19,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x74, 0x9C, 0xA9, 0xFF, 0xFC, 0x0A, 0xFF, 0xF7, 0x3D, 0x73,
+    0xD7, 0x49, 0x40, 0x2C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C,
+    0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x5C, 0xA0, 0xAC, 0x2A, 0xC0,
+    0xCA, 0x0A, 0xC0, 0xCA, 0x0E, 0xA0, 0xAE, 0x2D, 0xA0, 0xAD, 0x4D, 0x9D, 0x6E, 0x70, 0x94, 0x3A,
+    0x92, 0x9A, 0x6A, 0xCA, 0x2A, 0xCA, 0x4A, 0xC9, 0x4A, 0xCA, 0x2A, 0xFF, 0xEA, 0x09, 0xCA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xC9, 0xD7, 0x2D, 0x0F, 0xFF, 0xC1, 0x9F, 0xFE, 0x92, 0x9C, 0xA4, 0xAC,
+    0x94, 0x9C, 0xA2, 0xAC, 0x96, 0x94, 0x93, 0x09, 0x97, 0x29, 0x90, 0x9D, 0xA7, 0x1D, 0x90, 0xE7,
+    0x0A, 0xD1, 0xAD, 0x97, 0xD9, 0x2D, 0xA6, 0x9D, 0x3A, 0xD6, 0xAC, 0xA3, 0x9F, 0xFE, 0x5F, 0xFE,
+    0x5A, 0xD4, 0xD9, 0x6D, 0xA3, 0xD7, 0xE2, 0xAC, 0xA7, 0x9D, 0x2D, 0x71, 0xDA, 0x09, 0xCA, 0x71,
+    0xAD, 0x0A, 0xC9, 0x72, 0xD9, 0xD7, 0x3F, 0x97, 0x39, 0xE7, 0x5D, 0x97, 0x77, 0x69, 0x70, 0xAF,
+    0xC9, 0x4A, 0xCA, 0x99, 0xE9, 0x39, 0x4E, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x49, 0xAC, 0xA9,
+    0xDA, 0x3A, 0xFE, 0xA2, 0xDA, 0x29, 0xDA, 0x1A, 0xCA, 0x4D, 0xA1, 0xD5, 0xD9, 0x0A, 0xCA, 0x5D,
+    0x1D, 0x94, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0xD9, 0x4D, 0x2D, 0x93, 0xAC, 0xA2, 0xE2, 0x9D, 0x39,
+    0xEA, 0xE5, 0x9F, 0xA7, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFE, 0xAC, 0xAA, 0xAA, 0xAA,
+    0xE7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x9C, 0xAA, 0xAA, 0xAA, 0xE9, 0xFF, 0xD7, 0xAD,
+    0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xFF, 0xFF, 0xFE, 0xA0, 0x77, 0x71, 0x9A, 0xAA, 0x93,
+    0x9C, 0x5A, 0xFF, 0x90, 0xD4, 0xFA, 0x99, 0xAF, 0xC4, 0xE9, 0x5A, 0xDA, 0x3A, 0xD7, 0xF3, 0xD9,
+    0x6D, 0x9D, 0x91, 0xAD, 0x6D, 0x90, 0xAC, 0xA1, 0xDA, 0x5D, 0x91, 0x9D, 0x1D, 0x94, 0xD9, 0x29,
+    0xD1, 0xD9, 0x3D, 0xA3, 0x9D, 0x1D, 0x92, 0xAC, 0xA4, 0x9D, 0x1D, 0xA1, 0xAC, 0xA5, 0xAD, 0x1A,
+    0xD0, 0xAC, 0xA6, 0xDA, 0x19, 0xDA, 0xCA, 0x69, 0xD3, 0xF6, 0x9D, 0xA3, 0xAE, 0x59, 0xE3, 0x9F,
+    0xDA, 0xAF, 0xA3, 0x9D, 0x1A, 0xFE, 0x95, 0xA5, 0x99, 0x97, 0x79, 0x97, 0x4E, 0x73, 0x9E, 0x97,
+    0x2A, 0xF7, 0x2D, 0x9D, 0x71, 0xAC, 0x90, 0xD9, 0x70, 0xD1, 0xAD, 0x79, 0xCA, 0x19, 0xD7, 0xAC,
+    0x92, 0xDA, 0x6D, 0x3A, 0xD5, 0xAC, 0xA3, 0x9D, 0x94, 0xD5, 0xDA, 0x39, 0xD5, 0xAD, 0x3D, 0x95,
+    0x9D, 0x92, 0xD7, 0xDA, 0x1A, 0xCA, 0x7A, 0xD1, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0xA0, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xE1, 0xEA, 0xA9, 0x99, 0x99, 0xAA, 0xE1, 0xAD, 0x97,
+    0xD9, 0x2D, 0xA6, 0x9D, 0x3E, 0x6A, 0xCA, 0x39, 0xD9, 0x5D, 0x5E, 0x49, 0xD5, 0xAD, 0x4D, 0x96,
+    0xDA, 0x3D, 0x7E, 0x2A, 0xCA, 0x79, 0xD9, 0x1D, 0x71, 0xDA, 0x09, 0xCA, 0x71, 0xAD, 0x0A, 0xC9,
+    0x72, 0xD9, 0xD7, 0x3F, 0x97, 0x39, 0xE7, 0x5D, 0x97, 0x77, 0x70, 0x99, 0x99, 0x99, 0x95, 0x9F,
+    0xFD, 0x92, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xE7, 0x4D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D,
+    0x76, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFE, 0x1D, 0x91, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x1D, 0x97, 0x5D, 0xA7, 0x59, 0xD7, 0x6E, 0x76, 0xEA, 0x75, 0xAF, 0xFE, 0x95, 0xAF,
+    0xFC, 0x90, 0x73, 0xD7, 0x39, 0x99, 0xD9, 0x95, 0x9F, 0xFD, 0x92, 0x9F, 0xAA, 0xAD, 0xAA, 0xA2,
+    0x9E, 0x4D, 0x5D, 0xA4, 0x9C, 0xA4, 0xAD, 0x5D, 0x94, 0xDA, 0x5D, 0x5D, 0x59, 0xCA, 0x5D, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xAA, 0xA0, 0x9F, 0xFF, 0xE1, 0xD9, 0x19, 0x9A, 0xCA, 0x99, 0x99, 0x91, 0xD9,
+    0x3A, 0xC9, 0x6D, 0xA3, 0xD7, 0x9D, 0x29, 0xCA, 0x70, 0xE1, 0xAC, 0x97, 0x1E, 0xAD, 0x73, 0xAF,
+    0xFE, 0x95, 0xFF, 0xD9, 0x5D, 0x75, 0x9C, 0xA7, 0x77, 0x10, 0x59, 0x99, 0x99, 0x99, 0x99, 0x94,
+    0xAF, 0xFE, 0x91, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x9D, 0xA7, 0x4E, 0x75, 0xD9, 0x75, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x09, 0xFF, 0xFD, 0xA1, 0xD9, 0x75, 0xDA, 0x75, 0xAD, 0x97, 0x5E,
+    0xA9, 0x74, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0x90, 0x09, 0x99, 0x99, 0x99, 0x70, 0x9F, 0xFD, 0x95,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x75, 0xE9, 0x75, 0xAD, 0x76, 0xDA, 0x75, 0xAD, 0x76, 0xD1, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x1F, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0x9D,
+    0x75, 0x9D, 0x75, 0xAD, 0x75, 0xD9, 0x74, 0xE7, 0x3A, 0xE2, 0x9F, 0xFE, 0xA3, 0x9F, 0xFC, 0xA5,
+    0x2D, 0x74, 0x99, 0xD9, 0x99, 0x70, 0x9F, 0xFD, 0x95, 0xAA, 0xAD, 0xAA, 0xAF, 0x96, 0xD4, 0xE9,
+    0x5A, 0xC9, 0x4A, 0xD5, 0x9D, 0x5D, 0xA5, 0xD5, 0xAD, 0x5A, 0xC9, 0x5D, 0x1A, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xD1, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x9A, 0xCA, 0x99, 0x19, 0xD6, 0x9C, 0xA3, 0x9D,
+    0x7D, 0x3A, 0xD7, 0xAC, 0x92, 0xD9, 0x79, 0xCA, 0x1E, 0x71, 0xDA, 0xE2, 0x9F, 0xFE, 0xA3, 0x9F,
+    0xFD, 0x76, 0xD7, 0x6A, 0xC9, 0x77, 0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFE, 0xA4,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x97, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x19, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xD1, 0xAF, 0xFF, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x74, 0x9D, 0xA7, 0x29, 0xAE, 0x19, 0xFF,
+    0xFA, 0x29, 0xFF, 0xDA, 0x40, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0xFD, 0x19, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x93, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A,
+    0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4,
+    0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD,
+    0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD4, 0xAD, 0x7A, 0xD2, 0x9A, 0xFA, 0x39, 0xAF, 0xA0,
+    0xFE, 0x3F, 0xE0, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0x90, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAD, 0x91, 0xE9, 0x5A, 0xCA, 0x19, 0xE6, 0xCA, 0x2A, 0xDA, 0x5A, 0x4A, 0xD9, 0x73, 0xE7,
+    0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xD7, 0x29, 0xD7, 0x3D, 0x97, 0x2D, 0xA7,
+    0x2A, 0xD6, 0x99, 0x19, 0xD7, 0xD1, 0xD9, 0x69, 0xD0, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0xFF,
+    0xFC, 0x90, 0xFF, 0xFC, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xD0, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x70, 0xD7, 0x09, 0xCA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xC9, 0x70, 0xD7, 0x0A, 0xCA,
+    0x70, 0xD7, 0x09, 0xCA, 0x70, 0xD7, 0x09, 0xD7, 0x0D, 0x97, 0x0D, 0x70, 0xAC, 0x97, 0x0D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x97, 0x73, 0x0D, 0x71, 0xAC, 0xA7, 0x1D, 0x71, 0xAC,
+    0x97, 0x1D, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xD7, 0x19, 0xCA, 0x71, 0xD7, 0x1A, 0xCA, 0x71, 0xD7,
+    0x1A, 0xC9, 0x70, 0x9D, 0x71, 0xD7, 0x19, 0xCA, 0x71, 0xD7, 0x1A, 0xCA, 0x71, 0xD7, 0x40, 0x77,
+    0x0C, 0xA7, 0x1C, 0xA5, 0xA9, 0x1C, 0xA1, 0xA9, 0x09, 0xDA, 0x0C, 0xA9, 0xE2, 0xAF, 0xD9, 0x5E,
+    0xA5, 0x9F, 0xD9, 0x2E, 0x0C, 0xA9, 0xDA, 0x1C, 0x91, 0xCA, 0x1A, 0xA5, 0xCA, 0x71, 0xCA, 0x77,
+    0x00, 0x39, 0x5A, 0xF9, 0x1A, 0xCA, 0x99, 0xD9, 0x0D, 0x29, 0xCA, 0x9C, 0xA3, 0xD0, 0xCA, 0x3C,
+    0xA0, 0xD9, 0x1A, 0xC9, 0x09, 0xFC, 0xA3, 0x9A, 0xA2, 0x09, 0x90, 0xE9, 0xE9, 0x9C, 0xA0, 0x77,
+    0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x4D,
+    0x74, 0x9C, 0xA2, 0xAA, 0xAA, 0xA4, 0xAC, 0x92, 0xFC, 0x4D, 0x39, 0x99, 0xD9, 0x29, 0xD6, 0xDA,
+    0x2A, 0xC9, 0x69, 0xD2, 0xD7, 0x0D, 0x91, 0xD7, 0x0D, 0xA0, 0xAC, 0xA7, 0x0A, 0xD0, 0xD7, 0x2D,
+    0x0D, 0x72, 0xFA, 0x72, 0xAE, 0x97, 0x29, 0xE7, 0x4D, 0xA7, 0x4A, 0xC9, 0x60, 0x76, 0x9E, 0x92,
+    0xAC, 0x90, 0x9F, 0xCA, 0x0A, 0xCA, 0x1D, 0x2A, 0xCA, 0xC9, 0x2C, 0xA3, 0xDA, 0x3C, 0xA3, 0xAC,
+    0xA3, 0xD2, 0x9C, 0xAC, 0x92, 0xAD, 0xAD, 0xA0, 0xDA, 0x2A, 0xE9, 0x2A, 0xC9, 0x74, 0x1A, 0xDA,
+    0x3A, 0xDA, 0x2A, 0xFC, 0x1F, 0xCA, 0x1C, 0xA2, 0xF2, 0xD0, 0x9C, 0x92, 0x9D, 0x3A, 0xC0, 0x9C,
+    0x92, 0x9D, 0x3A, 0xC0, 0x9C, 0xA2, 0xCA, 0xD2, 0xD1, 0xDA, 0xAD, 0x09, 0xDA, 0xD9, 0x2E, 0xA2,
+    0x9E, 0xA7, 0x71, 0x09, 0x97, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75,
+    0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xFF, 0xE0, 0xFF, 0xFE, 0x77, 0x76, 0xCA, 0x76, 0xAD, 0x75, 0x9D, 0x97, 0x49, 0xDA,
+    0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x75, 0x9D, 0x97,
+    0x5D, 0xA7, 0x5E, 0x75, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFE, 0x09, 0xFF,
+    0xFF, 0x00, 0x99, 0x0D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9A, 0xA0, 0x09, 0x92, 0x91,
+    0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1,
+    0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC,
+    0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0,
+    0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1,
+    0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC, 0xA0, 0xAA, 0x19, 0xA9, 0x79, 0x97, 0x5E, 0x75, 0xE9,
+    0x73, 0xAF, 0x73, 0xD0, 0xD7, 0x29, 0xD0, 0xAC, 0xA7, 0x1A, 0xC9, 0x09, 0xD7, 0x1D, 0x2D, 0x97,
+    0x9C, 0xA2, 0xAC, 0xA7, 0xD9, 0x3D, 0x7D, 0x4D, 0x95, 0xAC, 0xA4, 0x9D, 0x5D, 0x6D, 0x49, 0xD6,
+    0xAC, 0xA3, 0xDA, 0x69, 0xD3, 0xD7, 0x0D, 0x91, 0xAD, 0x70, 0xAD, 0x1D, 0x97, 0x1D, 0x00, 0x09,
+    0x97, 0x29, 0x91, 0xDA, 0x70, 0x9D, 0x19, 0xD7, 0x0A, 0xCA, 0x2D, 0x97, 0xD9, 0x2A, 0xCA, 0x69,
+    0xD3, 0x9D, 0x6D, 0x94, 0xD9, 0x5D, 0x59, 0xCA, 0x4A, 0xCA, 0x6D, 0x4D, 0x96, 0xAC, 0x92, 0x9D,
+    0x79, 0xD2, 0xAC, 0xA7, 0x0D, 0x2D, 0x71, 0xAC, 0xA0, 0x9D, 0x72, 0xD0, 0xD9, 0x72, 0xD9, 0xD7,
+    0x39, 0xEA, 0x74, 0xE9, 0x74, 0xAD, 0x60, 0x39, 0xAA, 0xAA, 0xA9, 0x6F, 0xFC, 0x4E, 0xA9, 0x99,
+    0xAE, 0x2A, 0xD6, 0xDA, 0x1D, 0x96, 0x9D, 0x09, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D,
+    0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99,
+    0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x99, 0xD7, 0x0D, 0x90, 0x09,
+    0x97, 0x09, 0x90, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D,
+    0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70,
+    0xD9, 0x9D, 0x70, 0xD9, 0x9D, 0x70, 0xD9, 0x0D, 0x70, 0xD1, 0xDA, 0x6A, 0xD1, 0xAD, 0x94, 0x9D,
+    0xA2, 0xAE, 0xAA, 0xAE, 0xA4, 0x9F, 0xE9, 0x70, 0x99, 0x95, 0x70, 0x99, 0x71, 0xAF, 0xA6, 0x9D,
+    0x9A, 0xD6, 0xD9, 0x1A, 0x95, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D,
+    0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D,
+    0x72, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0xAD, 0x69, 0x2A, 0xCA, 0x59, 0xD0, 0x9D, 0x69, 0xFC,
+    0x97, 0x9A, 0xAA, 0x97, 0x77, 0x5E, 0x74, 0xE9, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x76, 0x9D, 0x70, 0xDA, 0x0E, 0xA6, 0x9E, 0x0E, 0x96, 0x9E, 0x19, 0x72, 0x91, 0x77, 0xAD, 0x97,
+    0xE0, 0xEA, 0x69, 0xE0, 0xAD, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xD7,
+    0x4E, 0x97, 0x3E, 0x75, 0x97, 0x9D, 0x0E, 0xAE, 0x90, 0x99, 0x77, 0x59, 0x90, 0xAD, 0xAE, 0xA9,
+    0xD0, 0x77, 0xAD, 0x97, 0xE0, 0xEA, 0x69, 0xE0, 0xAD, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x09, 0xD7, 0x0D, 0xA0, 0xEA, 0x69, 0xE0, 0xE9, 0x69, 0xE1, 0x97, 0x29, 0x10, 0x77,
+    0x09, 0xEA, 0x49, 0xA1, 0x9D, 0xAF, 0x99, 0xAD, 0x1C, 0xA2, 0x9A, 0xFC, 0x29, 0x69, 0x99, 0x20,
+    0x39, 0x97, 0x2F, 0xCA, 0x3A, 0xC1, 0xDA, 0x99, 0xFA, 0xD9, 0x1C, 0x93, 0x9A, 0xE9, 0x77, 0x77,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x77, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x19, 0xA9, 0x49, 0x1F, 0xC9, 0x1A, 0xC9, 0xAC,
+    0xA9, 0xAF, 0xD0, 0xAC, 0x29, 0xF9, 0x75, 0xAE, 0xA2, 0x9C, 0x9A, 0xFD, 0xA9, 0xD9, 0xD2, 0xAF,
+    0xA1, 0x94, 0xAA, 0x91, 0x0A, 0x97, 0x09, 0xA1, 0xFF, 0xFC, 0x29, 0xAA, 0xFC, 0xAA, 0x97, 0x77,
+    0x71, 0x9A, 0xAF, 0xCA, 0xA9, 0x2F, 0xFF, 0xC1, 0xA9, 0x70, 0x9A, 0x00, 0x79, 0x70, 0x9C, 0x91,
+    0xAA, 0xAA, 0xAA, 0xDA, 0xA9, 0xFF, 0xD4, 0xAC, 0x97, 0xCA, 0x7A, 0xC4, 0x9F, 0xFD, 0x0A, 0xAD,
+    0xAA, 0xAA, 0xAA, 0x1A, 0xC7, 0x09, 0x96, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF,
+    0xC7, 0x77, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x77, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x70, 0xA7, 0x0A, 0xDA, 0x5A, 0xEA,
+    0x4A, 0xEA, 0x4A, 0xE9, 0x59, 0xDA, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x79, 0xF9, 0x79, 0xEA, 0x70,
+    0x9C, 0xA7, 0x77, 0x09, 0xFF, 0xCA, 0x09, 0xFF, 0xD0, 0x0A, 0x72, 0xDA, 0x70, 0xAE, 0xA7, 0x0A,
+    0xEA, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0xAE, 0x5A, 0xE9, 0x39, 0xAE, 0x94, 0xF9, 0x6D, 0x97, 0x77,
+    0x79, 0xFF, 0xCA, 0x09, 0xFF, 0xD0, 0x77, 0x75, 0xA9, 0x6A, 0xA7, 0xAE, 0x4A, 0xE5, 0xAE, 0x93,
+    0xAE, 0x94, 0xAE, 0x93, 0xAE, 0x94, 0xAE, 0x93, 0xAE, 0x95, 0x9E, 0x5E, 0x70, 0x9E, 0xA3, 0x9E,
+    0xA7, 0x09, 0xEA, 0x39, 0xEA, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x0A, 0xE4, 0x9E, 0x71, 0xAA, 0x6A,
+    0xA7, 0x75, 0x77, 0x5A, 0xA6, 0x9A, 0x71, 0xEA, 0x4E, 0xA7, 0x09, 0xEA, 0x39, 0xEA, 0x70, 0x9E,
+    0xA3, 0x9E, 0xA7, 0x09, 0xEA, 0x39, 0xEA, 0x70, 0xE5, 0xE9, 0x5A, 0xE9, 0x3A, 0xE9, 0x4A, 0xE9,
+    0x3A, 0xE9, 0x4A, 0xE9, 0x3A, 0xE9, 0x5E, 0x94, 0xEA, 0x7A, 0xA6, 0xAA, 0x77, 0x75, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x69, 0xFF, 0xEA, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x75, 0xE7, 0x6D, 0xA7,
+    0x59, 0xD7, 0x6D, 0x76, 0xD9, 0x75, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x39, 0xE1, 0x9F, 0xFF, 0xC2,
+    0x9F, 0xFD, 0xA9, 0x77, 0x40, 0x77, 0x73, 0x9D, 0x75, 0xAC, 0x97, 0x5D, 0x72, 0x99, 0x99, 0xD9,
+    0x99, 0x4A, 0xFF, 0xE9, 0x19, 0xFA, 0xAA, 0xDA, 0xAA, 0xA2, 0xE4, 0xD5, 0xAD, 0x4A, 0xCA, 0x5D,
+    0x94, 0xD6, 0xD5, 0xD5, 0x9D, 0x49, 0xCA, 0x6D, 0x4D, 0x96, 0xDA, 0x3D, 0x7A, 0xD2, 0x9C, 0xA7,
+    0x0E, 0x90, 0xD9, 0x71, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xD9, 0x5A, 0xC9, 0x75, 0xD7, 0x59, 0xCA,
+    0x75, 0xAC, 0x97, 0x77, 0x10, 0x77, 0x71, 0xAC, 0x97, 0x5D, 0x76, 0xD6, 0x99, 0x99, 0x99, 0x9A,
+    0xCA, 0x59, 0xFF, 0xEA, 0x4A, 0xAA, 0xAA, 0xAF, 0xE9, 0x70, 0x9C, 0xA1, 0xE7, 0x0D, 0x3D, 0xA7,
+    0xD3, 0x9D, 0x69, 0xCA, 0x4D, 0x6D, 0x94, 0xD9, 0x5D, 0x5D, 0x59, 0xCA, 0x4A, 0xD5, 0xAC, 0x94,
+    0xDA, 0x5D, 0x39, 0xE1, 0x9F, 0xFF, 0xC2, 0x9F, 0xFD, 0xA9, 0x7D, 0x75, 0x9C, 0xA7, 0x5A, 0xC9,
+    0x75, 0xD7, 0x77, 0x40, 0x69, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xE9, 0x19, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x2E, 0x74, 0xAD, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x6D, 0x76, 0xDA, 0x75, 0xAD,
+    0x76, 0xE9, 0x75, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xD9, 0x77, 0x77, 0x2A, 0xFF, 0xFD, 0x90, 0xAF,
+    0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xEA, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9,
+    0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD7, 0x6D, 0x76, 0xD9, 0x75, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x39,
+    0xE1, 0x9F, 0xFF, 0xC2, 0x9F, 0xFD, 0xA9, 0x77, 0x77, 0x59, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xDA,
+    0x00, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x90, 0x9C, 0x90, 0x9D, 0x94, 0x9C, 0xA2, 0x9C,
+    0x92, 0xAC, 0x93, 0xCA, 0x39, 0xC9, 0x3A, 0xC2, 0xAC, 0x49, 0xC9, 0x4C, 0xA1, 0xCA, 0x49, 0xC9,
+    0x4A, 0xC0, 0x9C, 0x59, 0xC9, 0x49, 0xC9, 0x9C, 0x99, 0x99, 0x99, 0xAC, 0xA9, 0x99, 0x99, 0x9C,
+    0x9A, 0xFF, 0xFF, 0xCA, 0x9C, 0x94, 0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49, 0xC9, 0x49, 0xC9, 0x0C,
+    0xA4, 0x9C, 0x94, 0xAC, 0x1A, 0xC4, 0x9C, 0x94, 0xCA, 0x2C, 0xA3, 0x9C, 0x93, 0xD3, 0x9C, 0xA2,
+    0x9C, 0x92, 0xD9, 0x49, 0xDA, 0x09, 0xC9, 0x0A, 0xD9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x69,
+    0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x94, 0x9D, 0x94, 0x9C, 0xA7, 0x0A, 0xC9, 0x3C, 0xA7, 0x2A,
+    0xC2, 0xAC, 0x74, 0xCA, 0x1C, 0xA7, 0x4A, 0xC0, 0x9C, 0x75, 0x9C, 0x99, 0xC9, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0xC9, 0xAF, 0xFF, 0xFC, 0xA9, 0xC9, 0x74, 0x9C, 0x99, 0xC9, 0x74, 0x9C,
+    0x90, 0xCA, 0x74, 0xAC, 0x1A, 0xC7, 0x4C, 0xA2, 0xD7, 0x2D, 0x39, 0xCA, 0x70, 0xD9, 0x49, 0xDA,
+    0x4A, 0xD9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x94,
+    0x9D, 0x94, 0x9D, 0x70, 0xD9, 0x3E, 0xA6, 0xAE, 0x2A, 0xC0, 0xAC, 0xA4, 0xAC, 0x90, 0xCA, 0x1C,
+    0xA1, 0xAC, 0xA2, 0xAC, 0x91, 0xAC, 0x09, 0xC3, 0xAC, 0xA0, 0xAC, 0x92, 0x9C, 0x99, 0xC4, 0xAE,
+    0x94, 0xC9, 0xAC, 0x5E, 0x5C, 0xA9, 0xC4, 0xAC, 0xAC, 0xA4, 0xC9, 0x9C, 0x92, 0xAC, 0x90, 0xAC,
+    0xA2, 0x9C, 0x90, 0xCA, 0x1A, 0xC9, 0x2A, 0xCA, 0x1A, 0xC1, 0xAC, 0x0A, 0xC9, 0x4A, 0xCA, 0x0C,
+    0xA2, 0xE9, 0x6A, 0xE3, 0x9D, 0x70, 0xD9, 0x49, 0xDA, 0x4A, 0xD9, 0x7A, 0xFE, 0xA7, 0x49, 0x99,
+    0x70, 0x69, 0xAA, 0xA9, 0x73, 0xFF, 0xC7, 0x9D, 0x94, 0x9D, 0x94, 0x9C, 0xA7, 0x0D, 0x93, 0xCA,
+    0x70, 0xAE, 0x2A, 0xC7, 0x0A, 0xC9, 0x0C, 0xA1, 0xCA, 0x7A, 0xC9, 0x1A, 0xC0, 0x9C, 0x96, 0xAC,
+    0x92, 0x9C, 0x99, 0xC6, 0xAC, 0x94, 0xC9, 0xAC, 0x5A, 0xC9, 0x5C, 0xA9, 0xC4, 0xAC, 0x96, 0xC9,
+    0x9C, 0x92, 0xAC, 0x96, 0x9C, 0x90, 0xCA, 0x1A, 0xC9, 0x7A, 0xC1, 0xAC, 0x0A, 0xC9, 0x70, 0xCA,
+    0x2E, 0x97, 0x0D, 0x39, 0xD7, 0x0D, 0x94, 0x9D, 0xA4, 0xAD, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97,
+    0x69, 0x74, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA,
+    0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73,
+    0xAC, 0xA7, 0x3A, 0xCA, 0x69, 0x99, 0x99, 0xAC, 0xA9, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0xAA, 0xFF,
+    0xFC, 0xA0, 0x09, 0x1A, 0xD9, 0xEA, 0xAD, 0x00, 0x19, 0x69, 0x69, 0x90, 0x9E, 0x4E, 0x4A, 0xD9,
+    0xAE, 0x4E, 0x4E, 0xA0, 0xD9, 0x4D, 0xA4, 0x9D, 0x00, 0x73, 0x97, 0x76, 0x9C, 0xA7, 0x74, 0x9E,
+    0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x09, 0xC9, 0x19, 0xDA, 0x76, 0x9C, 0x94, 0x9C, 0xA7, 0x49, 0xD9,
+    0x19, 0x2A, 0xCA, 0x72, 0x9F, 0xFA, 0x1D, 0xA7, 0x09, 0xFF, 0xD9, 0x0A, 0xDA, 0x69, 0xFF, 0xEA,
+    0x09, 0xEA, 0x49, 0xFF, 0xFA, 0x09, 0xFA, 0x29, 0xFF, 0xEA, 0x2A, 0xFC, 0xA1, 0xAF, 0xFA, 0x5F,
+    0xDA, 0x2A, 0xFE, 0x4A, 0xFD, 0xA4, 0xAF, 0xD9, 0x1A, 0xFE, 0xA6, 0xAF, 0xCA, 0x0A, 0xFE, 0xA7,
+    0x0A, 0xFC, 0x0A, 0xFD, 0xA7, 0x2A, 0xFF, 0xEA, 0x74, 0xAE, 0x90, 0xAE, 0xA7, 0x6A, 0xD2, 0xDA,
+    0x77, 0x0A, 0xC9, 0x0A, 0xCA, 0x77, 0x2A, 0xEA, 0x77, 0x4A, 0xCA, 0x77, 0x69, 0x73,
 };
 
 static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 4, 20, 7, 2, 19, 20, 0 }, // !
-    { 7, 8, 9, 1, 18, 14, 20 }, // "
-    { 16, 15, 17, 0, 14, 60, 34 }, // #
-    { 12, 25, 16, 2, 20, 75, 94 }, // $
-    { 22, 21, 24, 1, 19, 116, 169 }, // %
-    { 19, 20, 21, 1, 19, 95, 285 }, // &
-    { 3, 8, 5, 1, 18, 6, 380 }, // '
-    { 8, 25, 10, 1, 20, 50, 386 }, // (
-    { 8, 25, 9, 0, 20, 50, 436 }, // )
-    { 9, 9, 10, 0, 19, 21, 486 }, // *
-    { 11, 11, 16, 2, 14, 31, 507 }, // +
-    { 6, 9, 7, 0, 4, 14, 538 }, // ,
-    { 8, 3, 10, 1, 8, 6, 552 }, // -
-    { 5, 4, 7, 1, 3, 5, 558 }, // .
-    { 12, 20, 13, 0, 18, 60, 563 }, // /
-    { 14, 19, 16, 1, 18, 67, 623 }, // 0
-    { 10, 18, 16, 3, 18, 45, 690 }, // 1
-    { 13, 18, 16, 1, 18, 59, 735 }, // 2
-    { 11, 19, 16, 2, 18, 53, 794 }, // 3
-    { 15, 19, 16, 0, 18, 72, 847 }, // 4
-    { 12, 19, 16, 1, 18, 57, 919 }, // 5
-    { 13, 19, 16, 1, 18, 62, 976 }, // 6
-    { 13, 19, 16, 2, 18, 62, 1038 }, // 7
-    { 13, 19, 16, 1, 18, 62, 1100 }, // 8
-    { 13, 19, 16, 1, 18, 62, 1162 }, // 9
-    { 5, 14, 7, 1, 13, 18, 1224 }, // :
-    { 6, 18, 7, 0, 13, 27, 1242 }, // ;
-    { 12, 13, 16, 2, 15, 39, 1269 }, // <
-    { 11, 7, 16, 2, 12, 20, 1308 }, // =
-    { 12, 13, 16, 2, 15, 39, 1328 }, // >
-    { 10, 20, 12, 1, 19, 50, 1367 }, // ?
-    { 22, 23, 24, 1, 18, 127, 1417 }, // @
-    { 19, 18, 20, 0, 18, 86, 1544 }, // A
-    { 14, 19, 16, 1, 18, 67, 1630 }, // B
-    { 14, 19, 16, 1, 18, 67, 1697 }, // C
-    { 17, 19, 19, 1, 18, 81, 1764 }, // D
-    { 14, 18, 16, 1, 18, 63, 1845 }, // E
-    { 13, 18, 15, 1, 18, 59, 1908 }, // F
-    { 16, 19, 18, 1, 18, 76, 1967 }, // G
-    { 19, 18, 21, 1, 18, 86, 2043 }, // H
-    { 8, 18, 10, 1, 18, 36, 2129 }, // I
-    { 10, 24, 10, -1, 18, 60, 2165 }, // J
-    { 18, 19, 20, 1, 18, 86, 2225 }, // K
-    { 14, 18, 16, 1, 18, 63, 2311 }, // L
-    { 23, 18, 24, 0, 18, 104, 2374 }, // M
-    { 19, 19, 21, 1, 18, 91, 2478 }, // N
-    { 18, 19, 20, 1, 18, 86, 2569 }, // O
-    { 14, 18, 16, 1, 18, 63, 2655 }, // P
-    { 19, 23, 21, 1, 18, 110, 2718 }, // Q
-    { 17, 19, 19, 1, 18, 81, 2828 }, // R
-    { 12, 19, 14, 1, 18, 57, 2909 }, // S
-    { 17, 18, 18, 0, 18, 77, 2966 }, // T
-    { 19, 19, 20, 0, 18, 91, 3043 }, // U
-    { 19, 19, 20, 0, 18, 91, 3134 }, // V
-    { 28, 19, 29, 0, 18, 133, 3225 }, // W
-    { 18, 18, 19, 0, 18, 81, 3358 }, // X
-    { 17, 18, 18, 0, 18, 77, 3439 }, // Y
-    { 15, 19, 16, 0, 18, 72, 3516 }, // Z
-    { 6, 24, 8, 1, 20, 36, 3588 }, // [
-    { 12, 20, 13, 0, 18, 60, 3624 }, // <backslash>
-    { 5, 24, 8, 1, 20, 30, 3684 }, // ]
-    { 12, 12, 16, 2, 16, 36, 3714 }, // ^
-    { 13, 2, 14, 0, -1, 7, 3750 }, // _
-    { 6, 7, 17, 5, 21, 11, 3757 }, // `
-    { 13, 15, 15, 1, 14, 49, 3768 }, // a
-    { 15, 21, 15, -1, 20, 79, 3817 }, // b
-    { 11, 15, 13, 1, 14, 42, 3896 }, // c
-    { 15, 21, 17, 1, 20, 79, 3938 }, // d
-    { 11, 15, 13, 1, 14, 42, 4017 }, // e
-    { 12, 20, 13, 0, 20, 60, 4059 }, // f
-    { 15, 20, 16, 0, 14, 75, 4119 }, // g
-    { 17, 20, 18, 0, 20, 85, 4194 }, // h
-    { 8, 20, 9, 0, 20, 40, 4279 }, // i
-    { 8, 26, 7, -2, 20, 52, 4319 }, // j
-    { 15, 21, 16, 0, 20, 79, 4371 }, // k
-    { 8, 20, 9, 0, 20, 40, 4450 }, // l
-    { 25, 14, 26, 0, 14, 88, 4490 }, // m
-    { 17, 14, 18, 0, 14, 60, 4578 }, // n
-    { 13, 15, 15, 1, 14, 49, 4638 }, // o
-    { 15, 20, 16, 0, 14, 75, 4687 }, // p
-    { 14, 20, 16, 1, 14, 70, 4762 }, // q
-    { 12, 14, 13, 0, 14, 42, 4832 }, // r
-    { 10, 15, 12, 1, 14, 38, 4874 }, // s
-    { 10, 18, 11, 0, 17, 45, 4912 }, // t
-    { 17, 15, 18, 0, 14, 64, 4957 }, // u
-    { 15, 14, 16, 0, 13, 53, 5021 }, // v
-    { 22, 14, 23, 0, 13, 77, 5074 }, // w
-    { 15, 13, 16, 0, 13, 49, 5151 }, // x
-    { 15, 19, 16, 0, 13, 72, 5200 }, // y
-    { 12, 14, 13, 0, 13, 42, 5272 }, // z
-    { 8, 25, 10, 1, 20, 50, 5314 }, // {
-    { 3, 23, 7, 2, 20, 18, 5364 }, // |
-    { 8, 25, 10, 0, 20, 50, 5382 }, // }
-    { 12, 5, 16, 2, 11, 15, 5432 }, // ~
-    { 0, 0, 5, 0, 0, 0, 5447 }, //  
-    { 4, 20, 7, 1, 14, 20, 5447 }, // ¡
-    { 13, 25, 16, 1, 20, 82, 5467 }, // ¢
-    { 14, 19, 16, 1, 18, 67, 5549 }, // £
-    { 14, 13, 16, 1, 15, 46, 5616 }, // ¤
-    { 17, 18, 17, -1, 18, 77, 5662 }, // ¥
-    { 3, 23, 7, 2, 20, 18, 5739 }, // ¦
-    { 11, 21, 13, 1, 18, 58, 5757 }, // §
-    { 9, 4, 17, 4, 19, 9, 5815 }, // ¨
-    { 19, 19, 20, 0, 18, 91, 5824 }, // ©
-    { 9, 12, 11, 1, 18, 27, 5915 }, // ª
-    { 14, 10, 15, 0, 11, 35, 5942 }, // «
-    { 11, 7, 16, 2, 12, 20, 5977 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 5997 }, // ­
-    { 14, 14, 15, 0, 20, 49, 6003 }, // ®
-    { 9, 3, 17, 4, 18, 7, 6052 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 6059 }, // °
-    { 11, 15, 16, 2, 15, 42, 6080 }, // ±
-    { 9, 12, 11, 1, 21, 27, 6122 }, // ²
-    { 9, 13, 11, 1, 21, 30, 6149 }, // ³
-    { 5, 7, 17, 6, 21, 9, 6179 }, // ´
-    { 16, 20, 18, 1, 14, 80, 6188 }, // µ
-    { 13, 22, 14, 0, 18, 72, 6268 }, // ¶
-    { 5, 4, 7, 1, 9, 5, 6340 }, // ·
-    { 5, 6, 17, 6, -1, 8, 6345 }, // ¸
-    { 8, 12, 11, 2, 21, 24, 6353 }, // ¹
-    { 9, 12, 11, 1, 18, 27, 6377 }, // º
-    { 13, 10, 15, 1, 11, 33, 6404 }, // »
-    { 24, 21, 27, 2, 19, 126, 6437 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 6563 }, // ½
-    { 25, 21, 27, 1, 19, 132, 6689 }, // ¾
-    { 9, 20, 12, 1, 14, 45, 6821 }, // ¿
-    { 19, 24, 20, 0, 24, 114, 6866 }, // À
-    { 19, 24, 20, 0, 24, 114, 6980 }, // Á
-    { 19, 24, 20, 0, 24, 114, 7094 }, // Â
-    { 19, 24, 20, 0, 24, 114, 7208 }, // Ã
-    { 19, 23, 20, 0, 23, 110, 7322 }, // Ä
-    { 19, 25, 20, 0, 25, 119, 7432 }, // Å
-    { 24, 18, 24, -1, 18, 108, 7551 }, // Æ
-    { 14, 25, 16, 1, 18, 88, 7659 }, // Ç
-    { 14, 24, 16, 1, 24, 84, 7747 }, // È
-    { 14, 24, 16, 1, 24, 84, 7831 }, // É
-    { 14, 24, 16, 1, 24, 84, 7915 }, // Ê
-    { 14, 23, 16, 1, 23, 81, 7999 }, // Ë
-    { 8, 24, 10, 1, 24, 48, 8080 }, // Ì
-    { 8, 24, 10, 1, 24, 48, 8128 }, // Í
-    { 9, 24, 10, 0, 24, 54, 8176 }, // Î
-    { 10, 23, 11, 0, 23, 58, 8230 }, // Ï
-    { 18, 19, 19, 0, 18, 86, 8288 }, // Ð
-    { 19, 25, 21, 1, 24, 119, 8374 }, // Ñ
-    { 18, 25, 20, 1, 24, 113, 8493 }, // Ò
-    { 18, 25, 20, 1, 24, 113, 8606 }, // Ó
-    { 18, 25, 20, 1, 24, 113, 8719 }, // Ô
-    { 18, 25, 20, 1, 24, 113, 8832 }, // Õ
-    { 18, 24, 20, 1, 23, 108, 8945 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 9053 }, // ×
-    { 19, 19, 20, 0, 18, 91, 9081 }, // Ø
-    { 19, 25, 20, 0, 24, 119, 9172 }, // Ù
-    { 19, 25, 20, 0, 24, 119, 9291 }, // Ú
-    { 19, 25, 20, 0, 24, 119, 9410 }, // Û
-    { 19, 24, 20, 0, 23, 114, 9529 }, // Ü
-    { 17, 24, 18, 0, 24, 102, 9643 }, // Ý
-    { 14, 18, 16, 1, 18, 63, 9745 }, // Þ
-    { 16, 21, 17, 0, 20, 84, 9808 }, // ß
-    { 13, 22, 15, 1, 21, 72, 9892 }, // à
-    { 13, 22, 15, 1, 21, 72, 9964 }, // á
-    { 13, 21, 15, 1, 20, 69, 10036 }, // â
-    { 13, 21, 15, 1, 20, 69, 10105 }, // ã
-    { 13, 20, 15, 1, 19, 65, 10174 }, // ä
-    { 13, 22, 15, 1, 21, 72, 10239 }, // å
-    { 19, 15, 21, 1, 14, 72, 10311 }, // æ
-    { 11, 21, 13, 1, 14, 58, 10383 }, // ç
-    { 11, 22, 13, 1, 21, 61, 10441 }, // è
-    { 11, 22, 13, 1, 21, 61, 10502 }, // é
-    { 11, 21, 13, 1, 20, 58, 10563 }, // ê
-    { 11, 20, 13, 1, 19, 55, 10621 }, // ë
-    { 8, 21, 9, 0, 21, 42, 10676 }, // ì
-    { 8, 21, 9, 0, 21, 42, 10718 }, // í
-    { 8, 20, 9, 0, 20, 40, 10760 }, // î
-    { 10, 19, 10, -1, 19, 48, 10800 }, // ï
-    { 13, 22, 15, 1, 21, 72, 10848 }, // ð
-    { 17, 20, 18, 0, 20, 85, 10920 }, // ñ
-    { 13, 22, 15, 1, 21, 72, 11005 }, // ò
-    { 13, 22, 15, 1, 21, 72, 11077 }, // ó
-    { 13, 21, 15, 1, 20, 69, 11149 }, // ô
-    { 13, 21, 15, 1, 20, 69, 11218 }, // õ
-    { 13, 20, 15, 1, 19, 65, 11287 }, // ö
-    { 11, 13, 16, 2, 15, 36, 11352 }, // ÷
-    { 15, 15, 16, 0, 14, 57, 11388 }, // ø
-    { 17, 22, 18, 0, 21, 94, 11445 }, // ù
-    { 17, 22, 18, 0, 21, 94, 11539 }, // ú
-    { 17, 21, 18, 0, 20, 90, 11633 }, // û
-    { 17, 20, 18, 0, 19, 85, 11723 }, // ü
-    { 15, 27, 16, 0, 21, 102, 11808 }, // ý
-    { 15, 26, 16, 0, 20, 98, 11910 }, // þ
-    { 15, 25, 16, 0, 19, 94, 12008 }, // ÿ
-    { 19, 23, 20, 0, 23, 110, 12102 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 12212 }, // ā
-    { 19, 24, 20, 0, 24, 114, 12274 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 12388 }, // ă
-    { 19, 24, 20, 0, 18, 114, 12457 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 12571 }, // ą
-    { 14, 25, 16, 1, 24, 88, 12636 }, // Ć
-    { 11, 22, 13, 1, 21, 61, 12724 }, // ć
-    { 14, 25, 16, 1, 24, 88, 12785 }, // Ĉ
-    { 11, 21, 13, 1, 20, 58, 12873 }, // ĉ
-    { 14, 25, 16, 1, 24, 88, 12931 }, // Ċ
-    { 11, 20, 13, 1, 19, 55, 13019 }, // ċ
-    { 14, 25, 16, 1, 24, 88, 13074 }, // Č
-    { 11, 22, 13, 1, 21, 61, 13162 }, // č
-    { 17, 25, 19, 1, 24, 107, 13223 }, // Ď
-    { 17, 21, 19, 1, 20, 90, 13330 }, // ď
-    { 18, 19, 19, 0, 18, 86, 13420 }, // Đ
-    { 15, 21, 17, 1, 20, 79, 13506 }, // đ
-    { 14, 23, 16, 1, 23, 81, 13585 }, // Ē
-    { 11, 19, 13, 1, 18, 53, 13666 }, // ē
-    { 14, 24, 16, 1, 24, 84, 13719 }, // Ĕ
-    { 11, 21, 13, 1, 20, 58, 13803 }, // ĕ
-    { 14, 24, 16, 1, 24, 84, 13861 }, // Ė
-    { 11, 20, 13, 1, 19, 55, 13945 }, // ė
-    { 14, 24, 16, 1, 18, 84, 14000 }, // Ę
-    { 11, 20, 13, 1, 14, 55, 14084 }, // ę
-    { 14, 24, 16, 1, 24, 84, 14139 }, // Ě
-    { 11, 22, 13, 1, 21, 61, 14223 }, // ě
-    { 16, 25, 18, 1, 24, 100, 14284 }, // Ĝ
-    { 15, 26, 16, 0, 20, 98, 14384 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 14482 }, // Ğ
-    { 15, 26, 16, 0, 20, 98, 14582 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 14680 }, // Ġ
-    { 15, 25, 16, 0, 19, 94, 14780 }, // ġ
-    { 16, 25, 18, 1, 18, 100, 14874 }, // Ģ
-    { 15, 28, 16, 0, 22, 105, 14974 }, // ģ
-    { 19, 24, 21, 1, 24, 114, 15079 }, // Ĥ
-    { 18, 26, 18, -1, 26, 117, 15193 }, // ĥ
-    { 21, 18, 22, 0, 18, 95, 15310 }, // Ħ
-    { 17, 20, 18, 0, 20, 85, 15405 }, // ħ
-    { 9, 24, 10, 0, 24, 54, 15490 }, // Ĩ
-    { 9, 20, 10, 0, 20, 45, 15544 }, // ĩ
-    { 9, 23, 10, 0, 23, 52, 15589 }, // Ī
-    { 9, 18, 10, 0, 18, 41, 15641 }, // ī
-    { 9, 24, 10, 0, 24, 54, 15682 }, // Ĭ
-    { 8, 20, 9, 0, 20, 40, 15736 }, // ĭ
-    { 8, 24, 10, 1, 18, 48, 15776 }, // Į
-    { 8, 26, 9, 0, 20, 52, 15824 }, // į
-    { 8, 24, 10, 1, 24, 48, 15876 }, // İ
-    { 8, 14, 9, 0, 14, 28, 15924 }, // ı
-    { 17, 24, 19, 1, 18, 102, 15952 }, // Ĳ
-    { 14, 26, 15, 0, 20, 91, 16054 }, // ĳ
-    { 10, 30, 10, -1, 24, 75, 16145 }, // Ĵ
-    { 10, 26, 9, -2, 20, 65, 16220 }, // ĵ
-    { 18, 25, 20, 1, 18, 113, 16285 }, // Ķ
-    { 15, 27, 16, 0, 20, 102, 16398 }, // ķ
-    { 16, 15, 17, 0, 14, 60, 16500 }, // ĸ
-    { 14, 24, 16, 1, 24, 84, 16560 }, // Ĺ
-    { 8, 26, 9, 0, 26, 52, 16644 }, // ĺ
-    { 14, 25, 16, 1, 18, 88, 16696 }, // Ļ
-    { 8, 27, 9, 0, 20, 54, 16784 }, // ļ
-    { 14, 20, 16, 1, 20, 70, 16838 }, // Ľ
-    { 10, 20, 11, 0, 20, 50, 16908 }, // ľ
-    { 14, 18, 16, 1, 18, 63, 16958 }, // Ŀ
-    { 12, 20, 13, 0, 20, 60, 17021 }, // ŀ
-    { 16, 18, 16, -1, 18, 72, 17081 }, // Ł
-    { 10, 20, 10, -1, 20, 50, 17153 }, // ł
-    { 19, 25, 21, 1, 24, 119, 17203 }, // Ń
-    { 17, 21, 18, 0, 21, 90, 17322 }, // ń
-    { 19, 25, 21, 1, 18, 119, 17412 }, // Ņ
-    { 17, 21, 18, 0, 14, 90, 17531 }, // ņ
-    { 19, 25, 21, 1, 24, 119, 17621 }, // Ň
-    { 17, 21, 18, 0, 21, 90, 17740 }, // ň
-    { 23, 19, 24, 0, 19, 110, 17830 }, // ŉ
-    { 19, 23, 21, 1, 18, 110, 17940 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 18050 }, // ŋ
-    { 18, 24, 20, 1, 23, 108, 18125 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 18233 }, // ō
-    { 18, 25, 20, 1, 24, 113, 18295 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 18408 }, // ŏ
-    { 18, 26, 20, 1, 25, 117, 18477 }, // Ő
-    { 13, 22, 15, 1, 21, 72, 18594 }, // ő
-    { 23, 19, 25, 1, 18, 110, 18666 }, // Œ
-    { 21, 15, 23, 1, 14, 79, 18776 }, // œ
-    { 17, 25, 19, 1, 24, 107, 18855 }, // Ŕ
-    { 12, 21, 13, 0, 21, 63, 18962 }, // ŕ
-    { 17, 25, 19, 1, 18, 107, 19025 }, // Ŗ
-    { 12, 21, 13, 0, 14, 63, 19132 }, // ŗ
-    { 17, 25, 19, 1, 24, 107, 19195 }, // Ř
-    { 12, 21, 13, 0, 21, 63, 19302 }, // ř
-    { 12, 25, 14, 1, 24, 75, 19365 }, // Ś
-    { 10, 22, 12, 1, 21, 55, 19440 }, // ś
-    { 12, 25, 14, 1, 24, 75, 19495 }, // Ŝ
-    { 10, 21, 12, 1, 20, 53, 19570 }, // ŝ
-    { 12, 25, 14, 1, 18, 75, 19623 }, // Ş
-    { 10, 21, 12, 1, 14, 53, 19698 }, // ş
-    { 12, 25, 14, 1, 24, 75, 19751 }, // Š
-    { 10, 22, 12, 1, 21, 55, 19826 }, // š
-    { 17, 25, 18, 0, 18, 107, 19881 }, // Ţ
-    { 10, 24, 11, 0, 17, 60, 19988 }, // ţ
-    { 17, 24, 18, 0, 24, 102, 20048 }, // Ť
-    { 10, 21, 11, 0, 20, 53, 20150 }, // ť
-    { 17, 18, 18, 0, 18, 77, 20203 }, // Ŧ
-    { 10, 18, 11, 0, 17, 45, 20280 }, // ŧ
-    { 19, 25, 20, 0, 24, 119, 20325 }, // Ũ
-    { 17, 21, 18, 0, 20, 90, 20444 }, // ũ
-    { 19, 24, 20, 0, 23, 114, 20534 }, // Ū
-    { 17, 19, 18, 0, 18, 81, 20648 }, // ū
-    { 19, 25, 20, 0, 24, 119, 20729 }, // Ŭ
-    { 17, 21, 18, 0, 20, 90, 20848 }, // ŭ
-    { 19, 26, 20, 0, 25, 124, 20938 }, // Ů
-    { 17, 22, 18, 0, 21, 94, 21062 }, // ů
-    { 19, 26, 20, 0, 25, 124, 21156 }, // Ű
-    { 17, 22, 18, 0, 21, 94, 21280 }, // ű
-    { 19, 24, 20, 0, 18, 114, 21374 }, // Ų
-    { 17, 20, 18, 0, 14, 85, 21488 }, // ų
-    { 28, 25, 29, 0, 24, 175, 21573 }, // Ŵ
-    { 22, 21, 23, 0, 20, 116, 21748 }, // ŵ
-    { 17, 24, 18, 0, 24, 102, 21864 }, // Ŷ
-    { 15, 26, 16, 0, 20, 98, 21966 }, // ŷ
-    { 17, 23, 18, 0, 23, 98, 22064 }, // Ÿ
-    { 15, 25, 16, 0, 24, 94, 22162 }, // Ź
-    { 12, 22, 13, 0, 21, 66, 22256 }, // ź
-    { 15, 25, 16, 0, 24, 94, 22322 }, // Ż
-    { 12, 20, 13, 0, 19, 60, 22416 }, // ż
-    { 15, 25, 16, 0, 24, 94, 22476 }, // Ž
-    { 12, 22, 13, 0, 21, 66, 22570 }, // ž
-    { 12, 20, 13, 0, 20, 60, 22636 }, // ſ
-    { 19, 22, 21, 1, 21, 105, 22696 }, // Ơ
-    { 15, 17, 17, 1, 16, 64, 22801 }, // ơ
-    { 16, 18, 17, 0, 18, 72, 22865 }, // Ƥ
-    { 15, 26, 16, 0, 20, 98, 22937 }, // ƥ
-    { 10, 23, 11, 0, 17, 58, 23035 }, // ƫ
-    { 16, 18, 17, 0, 18, 72, 23093 }, // Ƭ
-    { 12, 21, 13, 0, 20, 63, 23165 }, // ƭ
-    { 17, 23, 18, 0, 18, 98, 23228 }, // Ʈ
-    { 20, 22, 21, 0, 21, 110, 23326 }, // Ư
-    { 17, 17, 18, 0, 16, 73, 23436 }, // ư
-    { 6, 7, 3, -4, 21, 11, 23509 }, // ̀
-    { 6, 7, 5, -2, 21, 11, 23520 }, // ́
-    { 8, 6, 5, -4, 20, 12, 23531 }, // ̂
-    { 8, 5, 5, -4, 20, 10, 23543 }, // ̃
-    { 10, 3, 6, -5, 18, 8, 23553 }, // ̄
-    { 8, 5, 5, -4, 20, 10, 23561 }, // ̆
-    { 4, 4, 3, -2, 19, 4, 23571 }, // ̇
-    { 10, 4, 6, -5, 19, 10, 23575 }, // ̈
-    { 8, 8, 5, -4, 22, 16, 23585 }, // ̉
-    { 8, 7, 5, -4, 21, 14, 23601 }, // ̊
-    { 10, 7, 7, -4, 21, 18, 23615 }, // ̋
-    { 10, 6, 6, -5, 21, 15, 23633 }, // ̌
-    { 10, 7, 5, -6, 21, 18, 23648 }, // ̏
-    { 8, 5, 5, -4, 20, 10, 23666 }, // ̑
-    { 4, 8, 3, -2, 22, 8, 23676 }, // ̒
-    { 5, 7, 4, -2, 22, 9, 23684 }, // ̓
-    { 5, 7, 3, -3, 22, 9, 23693 }, // ̔
-    { 4, 7, 3, -2, 22, 7, 23702 }, // ̕
-    { 4, 6, 3, -2, 16, 6, 23709 }, // ̛
-    { 4, 4, 3, -2, -2, 4, 23715 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 23719 }, // ̤
-    { 6, 6, 4, -3, -1, 9, 23729 }, // ̥
-    { 5, 6, 3, -3, -1, 8, 23738 }, // ̦
-    { 6, 6, 4, -3, -1, 9, 23746 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 23755 }, // ̨
-    { 3, 6, 7, 2, -1, 5, 23766 }, // ̩
-    { 8, 6, 5, -4, -1, 12, 23771 }, // ̭
-    { 8, 5, 5, -4, -1, 10, 23783 }, // ̮
-    { 8, 5, 5, -4, -1, 10, 23793 }, // ̰
-    { 10, 3, 6, -5, -2, 8, 23803 }, // ̱
-    { 8, 5, 5, -4, 20, 10, 23811 }, // ͂
-    { 10, 10, 6, -5, 25, 25, 23821 }, // ̈́
-    { 5, 5, 4, -2, -1, 7, 23846 }, // ͅ
-    { 19, 18, 20, 0, 18, 86, 23853 }, // Α
-    { 14, 19, 16, 1, 18, 67, 23939 }, // Β
-    { 13, 18, 15, 1, 18, 59, 24006 }, // Γ
-    { 16, 18, 17, 0, 18, 72, 24065 }, // Δ
-    { 14, 18, 16, 1, 18, 63, 24137 }, // Ε
-    { 15, 19, 16, 0, 18, 72, 24200 }, // Ζ
-    { 19, 18, 21, 1, 18, 86, 24272 }, // Η
-    { 18, 19, 20, 1, 18, 86, 24358 }, // Θ
-    { 8, 18, 10, 1, 18, 36, 24444 }, // Ι
-    { 18, 19, 20, 1, 18, 86, 24480 }, // Κ
-    { 18, 18, 19, 0, 18, 81, 24566 }, // Λ
-    { 23, 18, 24, 0, 18, 104, 24647 }, // Μ
-    { 19, 19, 21, 1, 18, 91, 24751 }, // Ν
-    { 15, 18, 17, 1, 18, 68, 24842 }, // Ξ
-    { 18, 19, 20, 1, 18, 86, 24910 }, // Ο
-    { 19, 18, 21, 1, 18, 86, 24996 }, // Π
-    { 14, 18, 16, 1, 18, 63, 25082 }, // Ρ
-    { 15, 19, 16, 0, 18, 72, 25145 }, // Σ
-    { 17, 18, 18, 0, 18, 77, 25217 }, // Τ
-    { 17, 18, 18, 0, 18, 77, 25294 }, // Υ
-    { 18, 19, 20, 1, 18, 86, 25371 }, // Φ
-    { 18, 18, 19, 0, 18, 81, 25457 }, // Χ
-    { 20, 18, 21, 0, 18, 90, 25538 }, // Ψ
-    { 19, 18, 21, 1, 18, 86, 25628 }, // Ω
-    { 16, 15, 18, 1, 14, 60, 25714 }, // α
-    { 13, 26, 15, 1, 20, 85, 25774 }, // β
-    { 13, 20, 14, 0, 14, 65, 25859 }, // γ
-    { 13, 21, 15, 1, 20, 69, 25924 }, // δ
-    { 11, 15, 13, 1, 14, 42, 25993 }, // ε
-    { 11, 25, 13, 1, 20, 69, 26035 }, // ζ
-    { 14, 20, 15, 0, 14, 70, 26104 }, // η
-    { 13, 21, 15, 1, 20, 69, 26174 }, // θ
-    { 7, 15, 10, 2, 14, 27, 26243 }, // ι
-    { 13, 15, 16, 2, 14, 49, 26270 }, // κ
-    { 15, 21, 16, 0, 20, 79, 26319 }, // λ
-    { 16, 20, 18, 1, 14, 80, 26398 }, // μ
-    { 13, 15, 14, 0, 14, 49, 26478 }, // ν
-    { 11, 25, 13, 1, 20, 69, 26527 }, // ξ
-    { 13, 15, 15, 1, 14, 49, 26596 }, // ο
-    { 16, 15, 17, 0, 14, 60, 26645 }, // π
-    { 13, 20, 15, 1, 14, 65, 26705 }, // ρ
-    { 11, 19, 13, 1, 14, 53, 26770 }, // ς
-    { 14, 15, 16, 1, 14, 53, 26823 }, // σ
-    { 13, 15, 14, 0, 14, 49, 26876 }, // τ
-    { 14, 15, 15, 0, 14, 53, 26925 }, // υ
-    { 19, 24, 21, 1, 18, 114, 26978 }, // φ
-    { 15, 20, 16, 0, 14, 75, 27092 }, // χ
-    { 19, 24, 20, 0, 18, 114, 27167 }, // ψ
-    { 18, 15, 20, 1, 14, 68, 27281 }, // ω
-    { 19, 24, 20, 0, 18, 114, 27349 }, // Ạ
-    { 13, 20, 15, 1, 14, 65, 27463 }, // ạ
-    { 19, 26, 20, 0, 26, 124, 27528 }, // Ả
-    { 13, 23, 15, 1, 22, 75, 27652 }, // ả
-    { 19, 26, 20, 0, 26, 124, 27727 }, // Ấ
-    { 13, 25, 15, 1, 24, 82, 27851 }, // ấ
-    { 19, 26, 20, 0, 26, 124, 27933 }, // Ầ
-    { 13, 25, 15, 1, 24, 82, 28057 }, // ầ
-    { 19, 26, 20, 0, 26, 124, 28139 }, // Ẩ
-    { 13, 25, 15, 1, 24, 82, 28263 }, // ẩ
-    { 19, 26, 20, 0, 26, 124, 28345 }, // Ẫ
-    { 13, 25, 15, 1, 24, 82, 28469 }, // ẫ
-    { 19, 30, 20, 0, 24, 143, 28551 }, // Ậ
-    { 13, 26, 15, 1, 20, 85, 28694 }, // ậ
-    { 19, 26, 20, 0, 26, 124, 28779 }, // Ắ
-    { 13, 25, 15, 1, 24, 82, 28903 }, // ắ
-    { 19, 26, 20, 0, 26, 124, 28985 }, // Ằ
-    { 13, 25, 15, 1, 24, 82, 29109 }, // ằ
-    { 19, 26, 20, 0, 26, 124, 29191 }, // Ẳ
-    { 13, 26, 15, 1, 25, 85, 29315 }, // ẳ
-    { 19, 26, 20, 0, 26, 124, 29400 }, // Ẵ
-    { 13, 25, 15, 1, 24, 82, 29524 }, // ẵ
-    { 19, 30, 20, 0, 24, 143, 29606 }, // Ặ
-    { 13, 26, 15, 1, 20, 85, 29749 }, // ặ
-    { 14, 24, 16, 1, 18, 84, 29834 }, // Ẹ
-    { 11, 20, 13, 1, 14, 55, 29918 }, // ẹ
-    { 14, 26, 16, 1, 26, 91, 29973 }, // Ẻ
-    { 11, 23, 13, 1, 22, 64, 30064 }, // ẻ
-    { 14, 24, 16, 1, 24, 84, 30128 }, // Ẽ
-    { 11, 21, 13, 1, 20, 58, 30212 }, // ẽ
-    { 14, 26, 16, 1, 26, 91, 30270 }, // Ế
-    { 13, 25, 15, 1, 24, 82, 30361 }, // ế
-    { 14, 26, 16, 1, 26, 91, 30443 }, // Ề
-    { 11, 25, 13, 1, 24, 69, 30534 }, // ề
-    { 14, 26, 16, 1, 26, 91, 30603 }, // Ể
-    { 13, 25, 15, 1, 24, 82, 30694 }, // ể
-    { 14, 26, 16, 1, 26, 91, 30776 }, // Ễ
-    { 11, 25, 13, 1, 24, 69, 30867 }, // ễ
-    { 14, 30, 16, 1, 24, 105, 30936 }, // Ệ
-    { 11, 26, 13, 1, 20, 72, 31041 }, // ệ
-    { 8, 26, 10, 1, 26, 52, 31113 }, // Ỉ
-    { 8, 22, 9, 0, 22, 44, 31165 }, // ỉ
-    { 8, 24, 10, 1, 18, 48, 31209 }, // Ị
-    { 8, 26, 9, 0, 20, 52, 31257 }, // ị
-    { 18, 24, 20, 1, 18, 108, 31309 }, // Ọ
-    { 13, 20, 15, 1, 14, 65, 31417 }, // ọ
-    { 18, 27, 20, 1, 26, 122, 31482 }, // Ỏ
-    { 13, 23, 15, 1, 22, 75, 31604 }, // ỏ
-    { 18, 27, 20, 1, 26, 122, 31679 }, // Ố
-    { 13, 25, 15, 1, 24, 82, 31801 }, // ố
-    { 18, 27, 20, 1, 26, 122, 31883 }, // Ồ
-    { 13, 25, 15, 1, 24, 82, 32005 }, // ồ
-    { 18, 27, 20, 1, 26, 122, 32087 }, // Ổ
-    { 14, 25, 16, 1, 24, 88, 32209 }, // ổ
-    { 18, 27, 20, 1, 26, 122, 32297 }, // Ỗ
-    { 13, 25, 15, 1, 24, 82, 32419 }, // ỗ
-    { 18, 30, 20, 1, 24, 135, 32501 }, // Ộ
-    { 13, 26, 15, 1, 20, 85, 32636 }, // ộ
-    { 19, 25, 21, 1, 24, 119, 32721 }, // Ớ
-    { 15, 22, 17, 1, 21, 83, 32840 }, // ớ
-    { 19, 25, 21, 1, 24, 119, 32923 }, // Ờ
-    { 15, 22, 17, 1, 21, 83, 33042 }, // ờ
-    { 19, 27, 21, 1, 26, 129, 33125 }, // Ở
-    { 15, 23, 17, 1, 22, 87, 33254 }, // ở
-    { 19, 25, 21, 1, 24, 119, 33341 }, // Ỡ
-    { 15, 21, 17, 1, 20, 79, 33460 }, // ỡ
-    { 19, 27, 21, 1, 21, 129, 33539 }, // Ợ
-    { 15, 22, 17, 1, 16, 83, 33668 }, // ợ
-    { 19, 24, 20, 0, 18, 114, 33751 }, // Ụ
-    { 17, 20, 18, 0, 14, 85, 33865 }, // ụ
-    { 19, 27, 20, 0, 26, 129, 33950 }, // Ủ
-    { 17, 23, 18, 0, 22, 98, 34079 }, // ủ
-    { 20, 25, 21, 0, 24, 125, 34177 }, // Ứ
-    { 17, 22, 18, 0, 21, 94, 34302 }, // ứ
-    { 20, 25, 21, 0, 24, 125, 34396 }, // Ừ
-    { 17, 22, 18, 0, 21, 94, 34521 }, // ừ
-    { 20, 27, 21, 0, 26, 135, 34615 }, // Ử
-    { 17, 23, 18, 0, 22, 98, 34750 }, // ử
-    { 20, 25, 21, 0, 24, 125, 34848 }, // Ữ
-    { 17, 21, 18, 0, 20, 90, 34973 }, // ữ
-    { 20, 27, 21, 0, 21, 135, 35063 }, // Ự
-    { 17, 22, 18, 0, 16, 94, 35198 }, // ự
-    { 17, 24, 18, 0, 24, 102, 35292 }, // Ỳ
-    { 15, 27, 16, 0, 21, 102, 35394 }, // ỳ
-    { 17, 24, 18, 0, 18, 102, 35496 }, // Ỵ
-    { 15, 19, 16, 0, 13, 72, 35598 }, // ỵ
-    { 17, 26, 18, 0, 26, 111, 35670 }, // Ỷ
-    { 15, 28, 16, 0, 22, 105, 35781 }, // ỷ
-    { 17, 24, 18, 0, 24, 102, 35886 }, // Ỹ
-    { 15, 26, 16, 0, 20, 98, 35988 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 36086 }, //  
-    { 0, 0, 25, 0, 0, 0, 36086 }, //  
-    { 0, 0, 13, 0, 0, 0, 36086 }, //  
-    { 0, 0, 25, 0, 0, 0, 36086 }, //  
-    { 0, 0, 8, 0, 0, 0, 36086 }, //  
-    { 0, 0, 6, 0, 0, 0, 36086 }, //  
-    { 0, 0, 4, 0, 0, 0, 36086 }, //  
-    { 0, 0, 16, 0, 0, 0, 36086 }, //  
-    { 0, 0, 7, 0, 0, 0, 36086 }, //  
-    { 0, 0, 5, 0, 0, 0, 36086 }, //  
-    { 0, 0, 1, 0, 0, 0, 36086 }, //  
-    { 0, 0, 1, 0, 0, 0, 36086 }, // ​
-    { 2, 21, 2, -1, 15, 11, 36086 }, // ‌
-    { 6, 23, 4, -3, 17, 35, 36097 }, // ‍
-    { 8, 24, 5, -4, 18, 48, 36132 }, // ‎
-    { 8, 24, 5, -4, 18, 48, 36180 }, // ‏
-    { 8, 3, 10, 1, 8, 6, 36228 }, // ‐
-    { 8, 3, 10, 1, 8, 6, 36234 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 36240 }, // ‒
-    { 13, 3, 14, 0, 8, 10, 36249 }, // –
-    { 25, 3, 26, 0, 8, 19, 36259 }, // —
-    { 25, 3, 26, 0, 8, 19, 36278 }, // ―
-    { 8, 26, 13, 2, 20, 52, 36297 }, // ‖
-    { 13, 6, 14, 0, -1, 20, 36349 }, // ‗
-    { 5, 8, 7, 1, 19, 10, 36369 }, // ‘
-    { 5, 8, 6, 0, 19, 10, 36379 }, // ’
-    { 5, 9, 6, 0, 4, 12, 36389 }, // ‚
-    { 5, 8, 7, 1, 19, 10, 36401 }, // ‛
-    { 10, 8, 12, 1, 19, 20, 36411 }, // “
-    { 10, 8, 11, 0, 19, 20, 36431 }, // ”
-    { 10, 9, 11, 0, 4, 23, 36451 }, // „
-    { 10, 8, 12, 1, 19, 20, 36474 }, // ‟
-    { 12, 17, 13, 0, 18, 51, 36494 }, // †
-    { 12, 20, 13, 0, 18, 60, 36545 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 36605 }, // •
-    { 9, 9, 16, 3, 13, 21, 36614 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 36635 }, // ․
-    { 11, 5, 13, 1, 4, 14, 36640 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 36654 }, // …
-    { 5, 4, 7, 1, 9, 5, 36681 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 36686 }, //  
-    { 0, 0, 1, 0, 0, 0, 36686 }, //  
-    { 8, 24, 5, -4, 18, 48, 36686 }, // ‪
-    { 8, 24, 5, -4, 18, 48, 36734 }, // ‫
-    { 8, 24, 5, -4, 18, 48, 36782 }, // ‬
-    { 11, 24, 7, -5, 18, 66, 36830 }, // ‭
-    { 11, 24, 7, -5, 18, 66, 36896 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 36962 }, //  
-    { 32, 21, 34, 1, 19, 168, 36962 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 37130 }, // ′
-    { 10, 9, 12, 1, 18, 23, 37142 }, // ″
-    { 15, 9, 17, 1, 18, 34, 37165 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 37199 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 37213 }, // ‶
-    { 17, 9, 18, 0, 18, 39, 37238 }, // ‷
-    { 11, 6, 13, 1, 0, 17, 37277 }, // ‸
-    { 7, 10, 8, 0, 11, 18, 37294 }, // ‹
-    { 7, 10, 9, 1, 11, 18, 37312 }, // ›
-    { 16, 18, 17, 0, 17, 72, 37330 }, // ※
-    { 11, 20, 14, 2, 19, 55, 37402 }, // ‼
-    { 13, 3, 14, 0, 21, 10, 37457 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 37467 }, // ⁃
-    { 13, 21, 10, -4, 19, 69, 37472 }, // ⁄
-    { 20, 20, 22, 1, 19, 100, 37541 }, // ⁇
-    { 17, 20, 19, 1, 19, 85, 37641 }, // ⁈
-    { 16, 20, 19, 2, 19, 80, 37726 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 37806 }, // ⁓
-    { 20, 9, 22, 1, 18, 45, 37825 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 37870 }, //  
-    { 0, 0, 1, 0, 0, 0, 37870 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 37870 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 37870 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 37870 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 37870 }, // ⁤
-    { 11, 13, 12, 0, 21, 36, 37870 }, // ⁰
-    { 11, 13, 12, 0, 21, 36, 37906 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 37942 }, // ⁵
-    { 9, 13, 11, 1, 21, 30, 37972 }, // ⁶
-    { 8, 13, 11, 2, 21, 26, 38002 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 38028 }, // ⁸
-    { 9, 13, 11, 1, 21, 30, 38058 }, // ⁹
-    { 11, 9, 14, 2, 18, 25, 38088 }, // ⁿ
-    { 11, 12, 12, 0, 8, 33, 38113 }, // ₀
-    { 8, 13, 11, 2, 9, 26, 38146 }, // ₁
-    { 9, 12, 11, 1, 8, 27, 38172 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 38199 }, // ₃
-    { 11, 12, 12, 0, 8, 33, 38226 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 38259 }, // ₅
-    { 9, 12, 11, 1, 8, 27, 38286 }, // ₆
-    { 8, 12, 11, 2, 8, 24, 38313 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 38337 }, // ₈
-    { 9, 12, 11, 1, 8, 27, 38364 }, // ₉
-    { 13, 18, 16, 1, 18, 59, 38391 }, // ₣
-    { 14, 19, 16, 1, 18, 67, 38450 }, // ₤
-    { 31, 19, 32, 0, 18, 148, 38517 }, // ₧
-    { 15, 19, 16, 0, 18, 72, 38665 }, // €
-    { 15, 11, 25, 5, 14, 42, 38737 }, // ←
-    { 11, 17, 25, 7, 17, 47, 38779 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 38826 }, // →
-    { 11, 17, 25, 7, 17, 47, 38868 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 38915 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 38957 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 39004 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 39051 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 39098 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 39145 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 39184 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 39226 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 39268 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 39310 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 39352 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 39394 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 39475 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 39544 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 39594 }, // ∅
-    { 16, 18, 17, 0, 18, 72, 39689 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 39761 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 39842 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 39919 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 40013 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 40073 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 40150 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 40244 }, // ∍
-    { 19, 22, 21, 1, 18, 105, 40304 }, // ∏
-    { 15, 23, 16, 0, 18, 87, 40409 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 40496 }, // −
-    { 12, 20, 13, 0, 18, 60, 40505 }, // ∕
-    { 12, 20, 14, 1, 18, 60, 40565 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 40625 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 40664 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 40685 }, // ∙
-    { 16, 24, 17, 0, 21, 96, 40689 }, // √
-    { 13, 10, 16, 1, 13, 33, 40785 }, // ∝
-    { 16, 9, 17, 0, 12, 36, 40818 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 40854 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 40926 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 41007 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 41027 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 41079 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 41156 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 41233 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 41301 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 41373 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 41464 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 41524 }, // ∵
-    { 4, 13, 8, 2, 15, 13, 41584 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 41597 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 41657 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 41676 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 41725 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 41752 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 41782 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 41813 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 41855 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 41900 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 41945 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 42014 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 42083 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 42147 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 42245 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 42343 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 42420 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 42497 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 42588 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 42679 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 42770 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 42861 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 42929 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 42933 }, // ⋯
-    { 25, 24, 26, 0, 21, 150, 42954 }, // �
+    { 4, 20, 7, 2, 19, 29, 0 }, // !
+    { 7, 8, 9, 1, 18, 25, 29 }, // "
+    { 16, 15, 17, 0, 14, 54, 54 }, // #
+    { 12, 25, 16, 2, 20, 71, 108 }, // $
+    { 22, 21, 24, 1, 19, 96, 179 }, // %
+    { 19, 20, 21, 1, 19, 77, 275 }, // &
+    { 3, 8, 5, 1, 18, 12, 352 }, // '
+    { 8, 25, 10, 1, 20, 36, 364 }, // (
+    { 8, 25, 9, 0, 20, 39, 400 }, // )
+    { 9, 9, 10, 0, 19, 23, 439 }, // *
+    { 11, 11, 16, 2, 14, 25, 462 }, // +
+    { 6, 9, 7, 0, 4, 13, 487 }, // ,
+    { 8, 3, 10, 1, 8, 10, 500 }, // -
+    { 5, 4, 7, 1, 3, 6, 510 }, // .
+    { 12, 20, 13, 0, 18, 39, 516 }, // /
+    { 14, 19, 16, 1, 18, 53, 555 }, // 0
+    { 10, 18, 16, 3, 18, 31, 608 }, // 1
+    { 13, 18, 16, 1, 18, 44, 639 }, // 2
+    { 11, 19, 16, 2, 18, 39, 683 }, // 3
+    { 15, 19, 16, 0, 18, 48, 722 }, // 4
+    { 12, 19, 16, 1, 18, 38, 770 }, // 5
+    { 13, 19, 16, 1, 18, 50, 808 }, // 6
+    { 13, 19, 16, 2, 18, 41, 858 }, // 7
+    { 13, 19, 16, 1, 18, 53, 899 }, // 8
+    { 13, 19, 16, 1, 18, 49, 952 }, // 9
+    { 5, 14, 7, 1, 13, 13, 1001 }, // :
+    { 6, 18, 7, 0, 13, 21, 1014 }, // ;
+    { 12, 13, 16, 2, 15, 25, 1035 }, // <
+    { 11, 7, 16, 2, 12, 18, 1060 }, // =
+    { 12, 13, 16, 2, 15, 23, 1078 }, // >
+    { 10, 20, 12, 1, 19, 35, 1101 }, // ?
+    { 22, 23, 24, 1, 18, 105, 1136 }, // @
+    { 19, 18, 20, 0, 18, 59, 1241 }, // A
+    { 14, 19, 16, 1, 18, 56, 1300 }, // B
+    { 14, 19, 16, 1, 18, 46, 1356 }, // C
+    { 17, 19, 19, 1, 18, 59, 1402 }, // D
+    { 14, 18, 16, 1, 18, 53, 1461 }, // E
+    { 13, 18, 15, 1, 18, 52, 1514 }, // F
+    { 16, 19, 18, 1, 18, 58, 1566 }, // G
+    { 19, 18, 21, 1, 18, 70, 1624 }, // H
+    { 8, 18, 10, 1, 18, 31, 1694 }, // I
+    { 10, 24, 10, -1, 18, 40, 1725 }, // J
+    { 18, 19, 20, 1, 18, 66, 1765 }, // K
+    { 14, 18, 16, 1, 18, 43, 1831 }, // L
+    { 23, 18, 24, 0, 18, 89, 1874 }, // M
+    { 19, 19, 21, 1, 18, 87, 1963 }, // N
+    { 18, 19, 20, 1, 18, 62, 2050 }, // O
+    { 14, 18, 16, 1, 18, 49, 2112 }, // P
+    { 19, 23, 21, 1, 18, 75, 2161 }, // Q
+    { 17, 19, 19, 1, 18, 60, 2236 }, // R
+    { 12, 19, 14, 1, 18, 47, 2296 }, // S
+    { 17, 18, 18, 0, 18, 54, 2343 }, // T
+    { 19, 19, 20, 0, 18, 68, 2397 }, // U
+    { 19, 19, 20, 0, 18, 62, 2465 }, // V
+    { 28, 19, 29, 0, 18, 101, 2527 }, // W
+    { 18, 18, 19, 0, 18, 61, 2628 }, // X
+    { 17, 18, 18, 0, 18, 55, 2689 }, // Y
+    { 15, 19, 16, 0, 18, 54, 2744 }, // Z
+    { 6, 24, 8, 1, 20, 28, 2798 }, // [
+    { 12, 20, 13, 0, 18, 38, 2826 }, // <backslash>
+    { 5, 24, 8, 1, 20, 37, 2864 }, // ]
+    { 12, 12, 16, 2, 16, 31, 2901 }, // ^
+    { 13, 2, 14, 0, -1, 4, 2932 }, // _
+    { 6, 7, 17, 5, 21, 8, 2936 }, // `
+    { 13, 15, 15, 1, 14, 40, 2944 }, // a
+    { 15, 21, 15, -1, 20, 54, 2984 }, // b
+    { 11, 15, 13, 1, 14, 30, 3038 }, // c
+    { 15, 21, 17, 1, 20, 55, 3068 }, // d
+    { 11, 15, 13, 1, 14, 30, 3123 }, // e
+    { 12, 20, 13, 0, 20, 44, 3153 }, // f
+    { 15, 20, 16, 0, 14, 56, 3197 }, // g
+    { 17, 20, 18, 0, 20, 57, 3253 }, // h
+    { 8, 20, 9, 0, 20, 30, 3310 }, // i
+    { 8, 26, 7, -2, 20, 36, 3340 }, // j
+    { 15, 21, 16, 0, 20, 52, 3376 }, // k
+    { 8, 20, 9, 0, 20, 33, 3428 }, // l
+    { 25, 14, 26, 0, 14, 66, 3461 }, // m
+    { 17, 14, 18, 0, 14, 44, 3527 }, // n
+    { 13, 15, 15, 1, 14, 37, 3571 }, // o
+    { 15, 20, 16, 0, 14, 58, 3608 }, // p
+    { 14, 20, 16, 1, 14, 54, 3666 }, // q
+    { 12, 14, 13, 0, 14, 32, 3720 }, // r
+    { 10, 15, 12, 1, 14, 37, 3752 }, // s
+    { 10, 18, 11, 0, 17, 30, 3789 }, // t
+    { 17, 15, 18, 0, 14, 46, 3819 }, // u
+    { 15, 14, 16, 0, 13, 39, 3865 }, // v
+    { 22, 14, 23, 0, 13, 66, 3904 }, // w
+    { 15, 13, 16, 0, 13, 43, 3970 }, // x
+    { 15, 19, 16, 0, 13, 54, 4013 }, // y
+    { 12, 14, 13, 0, 13, 34, 4067 }, // z
+    { 8, 25, 10, 1, 20, 35, 4101 }, // {
+    { 3, 23, 7, 2, 20, 34, 4136 }, // |
+    { 8, 25, 10, 0, 20, 39, 4170 }, // }
+    { 12, 5, 16, 2, 11, 15, 4209 }, // ~
+    { 0, 0, 5, 0, 0, 0, 4224 }, //  
+    { 4, 20, 7, 1, 14, 29, 4224 }, // ¡
+    { 13, 25, 16, 1, 20, 65, 4253 }, // ¢
+    { 14, 19, 16, 1, 18, 49, 4318 }, // £
+    { 14, 13, 16, 1, 15, 40, 4367 }, // ¤
+    { 17, 18, 17, -1, 18, 57, 4407 }, // ¥
+    { 3, 23, 7, 2, 20, 29, 4464 }, // ¦
+    { 11, 21, 13, 1, 18, 57, 4493 }, // §
+    { 9, 4, 17, 4, 19, 12, 4550 }, // ¨
+    { 19, 19, 20, 0, 18, 87, 4562 }, // ©
+    { 9, 12, 11, 1, 18, 31, 4649 }, // ª
+    { 14, 10, 15, 0, 11, 30, 4680 }, // «
+    { 11, 7, 16, 2, 12, 18, 4710 }, // ¬
+    { 8, 3, 10, 1, 8, 10, 4728 }, // ­
+    { 14, 14, 15, 0, 20, 63, 4738 }, // ®
+    { 9, 3, 17, 4, 18, 5, 4801 }, // ¯
+    { 9, 9, 13, 2, 18, 25, 4806 }, // °
+    { 11, 15, 16, 2, 15, 27, 4831 }, // ±
+    { 9, 12, 11, 1, 21, 27, 4858 }, // ²
+    { 9, 13, 11, 1, 21, 23, 4885 }, // ³
+    { 5, 7, 17, 6, 21, 8, 4908 }, // ´
+    { 16, 20, 18, 1, 14, 56, 4916 }, // µ
+    { 13, 22, 14, 0, 18, 72, 4972 }, // ¶
+    { 5, 4, 7, 1, 9, 7, 5044 }, // ·
+    { 5, 6, 17, 6, -1, 10, 5051 }, // ¸
+    { 8, 12, 11, 2, 21, 18, 5061 }, // ¹
+    { 9, 12, 11, 1, 18, 30, 5079 }, // º
+    { 13, 10, 15, 1, 11, 29, 5109 }, // »
+    { 24, 21, 27, 2, 19, 81, 5138 }, // ¼
+    { 24, 21, 27, 2, 19, 79, 5219 }, // ½
+    { 25, 21, 27, 1, 19, 86, 5298 }, // ¾
+    { 9, 20, 12, 1, 14, 37, 5384 }, // ¿
+    { 19, 24, 20, 0, 24, 72, 5421 }, // À
+    { 19, 24, 20, 0, 24, 71, 5493 }, // Á
+    { 19, 24, 20, 0, 24, 74, 5564 }, // Â
+    { 19, 24, 20, 0, 24, 74, 5638 }, // Ã
+    { 19, 23, 20, 0, 23, 72, 5712 }, // Ä
+    { 19, 25, 20, 0, 25, 77, 5784 }, // Å
+    { 24, 18, 24, -1, 18, 83, 5861 }, // Æ
+    { 14, 25, 16, 1, 18, 59, 5944 }, // Ç
+    { 14, 24, 16, 1, 24, 65, 6003 }, // È
+    { 14, 24, 16, 1, 24, 65, 6068 }, // É
+    { 14, 24, 16, 1, 24, 67, 6133 }, // Ê
+    { 14, 23, 16, 1, 23, 65, 6200 }, // Ë
+    { 8, 24, 10, 1, 24, 40, 6265 }, // Ì
+    { 8, 24, 10, 1, 24, 40, 6305 }, // Í
+    { 9, 24, 10, 0, 24, 43, 6345 }, // Î
+    { 10, 23, 11, 0, 23, 43, 6388 }, // Ï
+    { 18, 19, 19, 0, 18, 62, 6431 }, // Ð
+    { 19, 25, 21, 1, 24, 103, 6493 }, // Ñ
+    { 18, 25, 20, 1, 24, 74, 6596 }, // Ò
+    { 18, 25, 20, 1, 24, 74, 6670 }, // Ó
+    { 18, 25, 20, 1, 24, 77, 6744 }, // Ô
+    { 18, 25, 20, 1, 24, 77, 6821 }, // Õ
+    { 18, 24, 20, 1, 23, 75, 6898 }, // Ö
+    { 10, 11, 16, 3, 14, 25, 6973 }, // ×
+    { 19, 19, 20, 0, 18, 79, 6998 }, // Ø
+    { 19, 25, 20, 0, 24, 81, 7077 }, // Ù
+    { 19, 25, 20, 0, 24, 80, 7158 }, // Ú
+    { 19, 25, 20, 0, 24, 83, 7238 }, // Û
+    { 19, 24, 20, 0, 23, 81, 7321 }, // Ü
+    { 17, 24, 18, 0, 24, 67, 7402 }, // Ý
+    { 14, 18, 16, 1, 18, 50, 7469 }, // Þ
+    { 16, 21, 17, 0, 20, 70, 7519 }, // ß
+    { 13, 22, 15, 1, 21, 53, 7589 }, // à
+    { 13, 22, 15, 1, 21, 52, 7642 }, // á
+    { 13, 21, 15, 1, 20, 56, 7694 }, // â
+    { 13, 21, 15, 1, 20, 53, 7750 }, // ã
+    { 13, 20, 15, 1, 19, 53, 7803 }, // ä
+    { 13, 22, 15, 1, 21, 60, 7856 }, // å
+    { 19, 15, 21, 1, 14, 62, 7916 }, // æ
+    { 11, 21, 13, 1, 14, 41, 7978 }, // ç
+    { 11, 22, 13, 1, 21, 41, 8019 }, // è
+    { 11, 22, 13, 1, 21, 39, 8060 }, // é
+    { 11, 21, 13, 1, 20, 41, 8099 }, // ê
+    { 11, 20, 13, 1, 19, 41, 8140 }, // ë
+    { 8, 21, 9, 0, 21, 33, 8181 }, // ì
+    { 8, 21, 9, 0, 21, 32, 8214 }, // í
+    { 8, 20, 9, 0, 20, 36, 8246 }, // î
+    { 10, 19, 10, -1, 19, 34, 8282 }, // ï
+    { 13, 22, 15, 1, 21, 57, 8316 }, // ð
+    { 17, 20, 18, 0, 20, 60, 8373 }, // ñ
+    { 13, 22, 15, 1, 21, 50, 8433 }, // ò
+    { 13, 22, 15, 1, 21, 49, 8483 }, // ó
+    { 13, 21, 15, 1, 20, 52, 8532 }, // ô
+    { 13, 21, 15, 1, 20, 50, 8584 }, // õ
+    { 13, 20, 15, 1, 19, 51, 8634 }, // ö
+    { 11, 13, 16, 2, 15, 26, 8685 }, // ÷
+    { 15, 15, 16, 0, 14, 55, 8711 }, // ø
+    { 17, 22, 18, 0, 21, 57, 8766 }, // ù
+    { 17, 22, 18, 0, 21, 58, 8823 }, // ú
+    { 17, 21, 18, 0, 20, 59, 8881 }, // û
+    { 17, 20, 18, 0, 19, 60, 8940 }, // ü
+    { 15, 27, 16, 0, 21, 68, 9000 }, // ý
+    { 15, 26, 16, 0, 20, 69, 9068 }, // þ
+    { 15, 25, 16, 0, 19, 68, 9137 }, // ÿ
+    { 19, 23, 20, 0, 23, 70, 9205 }, // Ā
+    { 13, 19, 15, 1, 18, 46, 9275 }, // ā
+    { 19, 24, 20, 0, 24, 73, 9321 }, // Ă
+    { 13, 21, 15, 1, 20, 53, 9394 }, // ă
+    { 19, 24, 20, 0, 18, 72, 9447 }, // Ą
+    { 13, 20, 15, 1, 14, 52, 9519 }, // ą
+    { 14, 25, 16, 1, 24, 58, 9571 }, // Ć
+    { 11, 22, 13, 1, 21, 40, 9629 }, // ć
+    { 14, 25, 16, 1, 24, 61, 9669 }, // Ĉ
+    { 11, 21, 13, 1, 20, 43, 9730 }, // ĉ
+    { 14, 25, 16, 1, 24, 55, 9773 }, // Ċ
+    { 11, 20, 13, 1, 19, 38, 9828 }, // ċ
+    { 14, 25, 16, 1, 24, 60, 9866 }, // Č
+    { 11, 22, 13, 1, 21, 43, 9926 }, // č
+    { 17, 25, 19, 1, 24, 75, 9969 }, // Ď
+    { 17, 21, 19, 1, 20, 62, 10044 }, // ď
+    { 18, 19, 19, 0, 18, 62, 10106 }, // Đ
+    { 15, 21, 17, 1, 20, 61, 10168 }, // đ
+    { 14, 23, 16, 1, 23, 62, 10229 }, // Ē
+    { 11, 19, 13, 1, 18, 36, 10291 }, // ē
+    { 14, 24, 16, 1, 24, 66, 10327 }, // Ĕ
+    { 11, 21, 13, 1, 20, 42, 10393 }, // ĕ
+    { 14, 24, 16, 1, 24, 63, 10435 }, // Ė
+    { 11, 20, 13, 1, 19, 37, 10498 }, // ė
+    { 14, 24, 16, 1, 18, 65, 10535 }, // Ę
+    { 11, 20, 13, 1, 14, 38, 10600 }, // ę
+    { 14, 24, 16, 1, 24, 67, 10638 }, // Ě
+    { 11, 22, 13, 1, 21, 43, 10705 }, // ě
+    { 16, 25, 18, 1, 24, 72, 10748 }, // Ĝ
+    { 15, 26, 16, 0, 20, 69, 10820 }, // ĝ
+    { 16, 25, 18, 1, 24, 72, 10889 }, // Ğ
+    { 15, 26, 16, 0, 20, 69, 10961 }, // ğ
+    { 16, 25, 18, 1, 24, 68, 11030 }, // Ġ
+    { 15, 25, 16, 0, 19, 66, 11098 }, // ġ
+    { 16, 25, 18, 1, 18, 70, 11164 }, // Ģ
+    { 15, 28, 16, 0, 22, 72, 11234 }, // ģ
+    { 19, 24, 21, 1, 24, 86, 11306 }, // Ĥ
+    { 18, 26, 18, -1, 26, 71, 11392 }, // ĥ
+    { 21, 18, 22, 0, 18, 76, 11463 }, // Ħ
+    { 17, 20, 18, 0, 20, 61, 11539 }, // ħ
+    { 9, 24, 10, 0, 24, 44, 11600 }, // Ĩ
+    { 9, 20, 10, 0, 20, 36, 11644 }, // ĩ
+    { 9, 23, 10, 0, 23, 40, 11680 }, // Ī
+    { 9, 18, 10, 0, 18, 28, 11720 }, // ī
+    { 9, 24, 10, 0, 24, 44, 11748 }, // Ĭ
+    { 8, 20, 9, 0, 20, 32, 11792 }, // ĭ
+    { 8, 24, 10, 1, 18, 42, 11824 }, // Į
+    { 8, 26, 9, 0, 20, 39, 11866 }, // į
+    { 8, 24, 10, 1, 24, 38, 11905 }, // İ
+    { 8, 14, 9, 0, 14, 23, 11943 }, // ı
+    { 17, 24, 19, 1, 18, 75, 11966 }, // Ĳ
+    { 14, 26, 15, 0, 20, 68, 12041 }, // ĳ
+    { 10, 30, 10, -1, 24, 52, 12109 }, // Ĵ
+    { 10, 26, 9, -2, 20, 42, 12161 }, // ĵ
+    { 18, 25, 20, 1, 18, 79, 12203 }, // Ķ
+    { 15, 27, 16, 0, 20, 63, 12282 }, // ķ
+    { 16, 15, 17, 0, 14, 46, 12345 }, // ĸ
+    { 14, 24, 16, 1, 24, 53, 12391 }, // Ĺ
+    { 8, 26, 9, 0, 26, 42, 12444 }, // ĺ
+    { 14, 25, 16, 1, 18, 54, 12486 }, // Ļ
+    { 8, 27, 9, 0, 20, 44, 12540 }, // ļ
+    { 14, 20, 16, 1, 20, 52, 12584 }, // Ľ
+    { 10, 20, 11, 0, 20, 43, 12636 }, // ľ
+    { 14, 18, 16, 1, 18, 48, 12679 }, // Ŀ
+    { 12, 20, 13, 0, 20, 47, 12727 }, // ŀ
+    { 16, 18, 16, -1, 18, 51, 12774 }, // Ł
+    { 10, 20, 10, -1, 20, 39, 12825 }, // ł
+    { 19, 25, 21, 1, 24, 99, 12864 }, // Ń
+    { 17, 21, 18, 0, 21, 57, 12963 }, // ń
+    { 19, 25, 21, 1, 18, 100, 13020 }, // Ņ
+    { 17, 21, 18, 0, 14, 57, 13120 }, // ņ
+    { 19, 25, 21, 1, 24, 104, 13177 }, // Ň
+    { 17, 21, 18, 0, 21, 62, 13281 }, // ň
+    { 23, 19, 24, 0, 19, 67, 13343 }, // ŉ
+    { 19, 23, 21, 1, 18, 100, 13410 }, // Ŋ
+    { 15, 20, 16, 0, 14, 56, 13510 }, // ŋ
+    { 18, 24, 20, 1, 23, 73, 13566 }, // Ō
+    { 13, 19, 15, 1, 18, 43, 13639 }, // ō
+    { 18, 25, 20, 1, 24, 78, 13682 }, // Ŏ
+    { 13, 21, 15, 1, 20, 51, 13760 }, // ŏ
+    { 18, 26, 20, 1, 25, 82, 13811 }, // Ő
+    { 13, 22, 15, 1, 21, 54, 13893 }, // ő
+    { 23, 19, 25, 1, 18, 80, 13947 }, // Œ
+    { 21, 15, 23, 1, 14, 59, 14027 }, // œ
+    { 17, 25, 19, 1, 24, 72, 14086 }, // Ŕ
+    { 12, 21, 13, 0, 21, 42, 14158 }, // ŕ
+    { 17, 25, 19, 1, 18, 72, 14200 }, // Ŗ
+    { 12, 21, 13, 0, 14, 44, 14272 }, // ŗ
+    { 17, 25, 19, 1, 24, 76, 14316 }, // Ř
+    { 12, 21, 13, 0, 21, 47, 14392 }, // ř
+    { 12, 25, 14, 1, 24, 56, 14439 }, // Ś
+    { 10, 22, 12, 1, 21, 46, 14495 }, // ś
+    { 12, 25, 14, 1, 24, 61, 14541 }, // Ŝ
+    { 10, 21, 12, 1, 20, 50, 14602 }, // ŝ
+    { 12, 25, 14, 1, 18, 58, 14652 }, // Ş
+    { 10, 21, 12, 1, 14, 46, 14710 }, // ş
+    { 12, 25, 14, 1, 24, 60, 14756 }, // Š
+    { 10, 22, 12, 1, 21, 49, 14816 }, // š
+    { 17, 25, 18, 0, 18, 69, 14865 }, // Ţ
+    { 10, 24, 11, 0, 17, 39, 14934 }, // ţ
+    { 17, 24, 18, 0, 24, 70, 14973 }, // Ť
+    { 10, 21, 11, 0, 20, 38, 15043 }, // ť
+    { 17, 18, 18, 0, 18, 57, 15081 }, // Ŧ
+    { 10, 18, 11, 0, 17, 30, 15138 }, // ŧ
+    { 19, 25, 20, 0, 24, 84, 15168 }, // Ũ
+    { 17, 21, 18, 0, 20, 63, 15252 }, // ũ
+    { 19, 24, 20, 0, 23, 79, 15315 }, // Ū
+    { 17, 19, 18, 0, 18, 53, 15394 }, // ū
+    { 19, 25, 20, 0, 24, 84, 15447 }, // Ŭ
+    { 17, 21, 18, 0, 20, 61, 15531 }, // ŭ
+    { 19, 26, 20, 0, 25, 86, 15592 }, // Ů
+    { 17, 22, 18, 0, 21, 66, 15678 }, // ů
+    { 19, 26, 20, 0, 25, 88, 15744 }, // Ű
+    { 17, 22, 18, 0, 21, 66, 15832 }, // ű
+    { 19, 24, 20, 0, 18, 78, 15898 }, // Ų
+    { 17, 20, 18, 0, 14, 56, 15976 }, // ų
+    { 28, 25, 29, 0, 24, 120, 16032 }, // Ŵ
+    { 22, 21, 23, 0, 20, 82, 16152 }, // ŵ
+    { 17, 24, 18, 0, 24, 70, 16234 }, // Ŷ
+    { 15, 26, 16, 0, 20, 71, 16304 }, // ŷ
+    { 17, 23, 18, 0, 23, 67, 16375 }, // Ÿ
+    { 15, 25, 16, 0, 24, 66, 16442 }, // Ź
+    { 12, 22, 13, 0, 21, 45, 16508 }, // ź
+    { 15, 25, 16, 0, 24, 62, 16553 }, // Ż
+    { 12, 20, 13, 0, 19, 42, 16615 }, // ż
+    { 15, 25, 16, 0, 24, 68, 16657 }, // Ž
+    { 12, 22, 13, 0, 21, 48, 16725 }, // ž
+    { 12, 20, 13, 0, 20, 43, 16773 }, // ſ
+    { 19, 22, 21, 1, 21, 73, 16816 }, // Ơ
+    { 15, 17, 17, 1, 16, 49, 16889 }, // ơ
+    { 16, 18, 17, 0, 18, 57, 16938 }, // Ƥ
+    { 15, 26, 16, 0, 20, 71, 16995 }, // ƥ
+    { 10, 23, 11, 0, 17, 41, 17066 }, // ƫ
+    { 16, 18, 17, 0, 18, 51, 17107 }, // Ƭ
+    { 12, 21, 13, 0, 20, 45, 17158 }, // ƭ
+    { 17, 23, 18, 0, 18, 66, 17203 }, // Ʈ
+    { 20, 22, 21, 0, 21, 77, 17269 }, // Ư
+    { 17, 17, 18, 0, 16, 51, 17346 }, // ư
+    { 6, 7, 3, -4, 21, 11, 17397 }, // ̀
+    { 6, 7, 5, -2, 21, 9, 17408 }, // ́
+    { 8, 6, 5, -4, 20, 12, 17417 }, // ̂
+    { 8, 5, 5, -4, 20, 10, 17429 }, // ̃
+    { 10, 3, 6, -5, 18, 5, 17439 }, // ̄
+    { 8, 5, 5, -4, 20, 9, 17444 }, // ̆
+    { 4, 4, 3, -2, 19, 7, 17453 }, // ̇
+    { 10, 4, 6, -5, 19, 10, 17460 }, // ̈
+    { 8, 8, 5, -4, 22, 16, 17470 }, // ̉
+    { 8, 7, 5, -4, 21, 16, 17486 }, // ̊
+    { 10, 7, 7, -4, 21, 17, 17502 }, // ̋
+    { 10, 6, 6, -5, 21, 13, 17519 }, // ̌
+    { 10, 7, 5, -6, 21, 17, 17532 }, // ̏
+    { 8, 5, 5, -4, 20, 10, 17549 }, // ̑
+    { 4, 8, 3, -2, 22, 12, 17559 }, // ̒
+    { 5, 7, 4, -2, 22, 12, 17571 }, // ̓
+    { 5, 7, 3, -3, 22, 12, 17583 }, // ̔
+    { 4, 7, 3, -2, 22, 9, 17595 }, // ̕
+    { 4, 6, 3, -2, 16, 8, 17604 }, // ̛
+    { 4, 4, 3, -2, -2, 7, 17612 }, // ̣
+    { 10, 4, 6, -5, -2, 10, 17619 }, // ̤
+    { 6, 6, 4, -3, -1, 13, 17629 }, // ̥
+    { 5, 6, 3, -3, -1, 11, 17642 }, // ̦
+    { 6, 6, 4, -3, -1, 9, 17653 }, // ̧
+    { 6, 7, 4, -3, 1, 11, 17662 }, // ̨
+    { 3, 6, 7, 2, -1, 9, 17673 }, // ̩
+    { 8, 6, 5, -4, -1, 11, 17682 }, // ̭
+    { 8, 5, 5, -4, -1, 9, 17693 }, // ̮
+    { 8, 5, 5, -4, -1, 11, 17702 }, // ̰
+    { 10, 3, 6, -5, -2, 11, 17713 }, // ̱
+    { 8, 5, 5, -4, 20, 10, 17724 }, // ͂
+    { 10, 10, 6, -5, 25, 19, 17734 }, // ̈́
+    { 5, 5, 4, -2, -1, 7, 17753 }, // ͅ
+    { 19, 18, 20, 0, 18, 59, 17760 }, // Α
+    { 14, 19, 16, 1, 18, 56, 17819 }, // Β
+    { 13, 18, 15, 1, 18, 49, 17875 }, // Γ
+    { 16, 18, 17, 0, 18, 52, 17924 }, // Δ
+    { 14, 18, 16, 1, 18, 53, 17976 }, // Ε
+    { 15, 19, 16, 0, 18, 54, 18029 }, // Ζ
+    { 19, 18, 21, 1, 18, 70, 18083 }, // Η
+    { 18, 19, 20, 1, 18, 68, 18153 }, // Θ
+    { 8, 18, 10, 1, 18, 31, 18221 }, // Ι
+    { 18, 19, 20, 1, 18, 66, 18252 }, // Κ
+    { 18, 18, 19, 0, 18, 54, 18318 }, // Λ
+    { 23, 18, 24, 0, 18, 89, 18372 }, // Μ
+    { 19, 19, 21, 1, 18, 87, 18461 }, // Ν
+    { 15, 18, 17, 1, 18, 50, 18548 }, // Ξ
+    { 18, 19, 20, 1, 18, 62, 18598 }, // Ο
+    { 19, 18, 21, 1, 18, 66, 18660 }, // Π
+    { 14, 18, 16, 1, 18, 49, 18726 }, // Ρ
+    { 15, 19, 16, 0, 18, 52, 18775 }, // Σ
+    { 17, 18, 18, 0, 18, 54, 18827 }, // Τ
+    { 17, 18, 18, 0, 18, 49, 18881 }, // Υ
+    { 18, 19, 20, 1, 18, 70, 18930 }, // Φ
+    { 18, 18, 19, 0, 18, 61, 19000 }, // Χ
+    { 20, 18, 21, 0, 18, 73, 19061 }, // Ψ
+    { 19, 18, 21, 1, 18, 68, 19134 }, // Ω
+    { 16, 15, 18, 1, 14, 48, 19202 }, // α
+    { 13, 26, 15, 1, 20, 71, 19250 }, // β
+    { 13, 20, 14, 0, 14, 50, 19321 }, // γ
+    { 13, 21, 15, 1, 20, 55, 19371 }, // δ
+    { 11, 15, 13, 1, 14, 33, 19426 }, // ε
+    { 11, 25, 13, 1, 20, 49, 19459 }, // ζ
+    { 14, 20, 15, 0, 14, 54, 19508 }, // η
+    { 13, 21, 15, 1, 20, 57, 19562 }, // θ
+    { 7, 15, 10, 2, 14, 23, 19619 }, // ι
+    { 13, 15, 16, 2, 14, 41, 19642 }, // κ
+    { 15, 21, 16, 0, 20, 52, 19683 }, // λ
+    { 16, 20, 18, 1, 14, 56, 19735 }, // μ
+    { 13, 15, 14, 0, 14, 37, 19791 }, // ν
+    { 11, 25, 13, 1, 20, 51, 19828 }, // ξ
+    { 13, 15, 15, 1, 14, 39, 19879 }, // ο
+    { 16, 15, 17, 0, 14, 47, 19918 }, // π
+    { 13, 20, 15, 1, 14, 53, 19965 }, // ρ
+    { 11, 19, 13, 1, 14, 36, 20018 }, // ς
+    { 14, 15, 16, 1, 14, 44, 20054 }, // σ
+    { 13, 15, 14, 0, 14, 36, 20098 }, // τ
+    { 14, 15, 15, 0, 14, 43, 20134 }, // υ
+    { 19, 24, 21, 1, 18, 78, 20177 }, // φ
+    { 15, 20, 16, 0, 14, 58, 20255 }, // χ
+    { 19, 24, 20, 0, 18, 81, 20313 }, // ψ
+    { 18, 15, 20, 1, 14, 60, 20394 }, // ω
+    { 19, 24, 20, 0, 18, 71, 20454 }, // Ạ
+    { 13, 20, 15, 1, 14, 49, 20525 }, // ạ
+    { 19, 26, 20, 0, 26, 77, 20574 }, // Ả
+    { 13, 23, 15, 1, 22, 59, 20651 }, // ả
+    { 19, 26, 20, 0, 26, 81, 20710 }, // Ấ
+    { 13, 25, 15, 1, 24, 64, 20791 }, // ấ
+    { 19, 26, 20, 0, 26, 81, 20855 }, // Ầ
+    { 13, 25, 15, 1, 24, 62, 20936 }, // ầ
+    { 19, 26, 20, 0, 26, 82, 20998 }, // Ẩ
+    { 13, 25, 15, 1, 24, 67, 21080 }, // ẩ
+    { 19, 26, 20, 0, 26, 84, 21147 }, // Ẫ
+    { 13, 25, 15, 1, 24, 66, 21231 }, // ẫ
+    { 19, 30, 20, 0, 24, 85, 21297 }, // Ậ
+    { 13, 26, 15, 1, 20, 65, 21382 }, // ậ
+    { 19, 26, 20, 0, 26, 81, 21447 }, // Ắ
+    { 13, 25, 15, 1, 24, 61, 21528 }, // ắ
+    { 19, 26, 20, 0, 26, 81, 21589 }, // Ằ
+    { 13, 25, 15, 1, 24, 63, 21670 }, // ằ
+    { 19, 26, 20, 0, 26, 86, 21733 }, // Ẳ
+    { 13, 26, 15, 1, 25, 67, 21819 }, // ẳ
+    { 19, 26, 20, 0, 26, 82, 21886 }, // Ẵ
+    { 13, 25, 15, 1, 24, 63, 21968 }, // ẵ
+    { 19, 30, 20, 0, 24, 85, 22031 }, // Ặ
+    { 13, 26, 15, 1, 20, 62, 22116 }, // ặ
+    { 14, 24, 16, 1, 18, 64, 22178 }, // Ẹ
+    { 11, 20, 13, 1, 14, 37, 22242 }, // ẹ
+    { 14, 26, 16, 1, 26, 70, 22279 }, // Ẻ
+    { 11, 23, 13, 1, 22, 45, 22349 }, // ẻ
+    { 14, 24, 16, 1, 24, 66, 22394 }, // Ẽ
+    { 11, 21, 13, 1, 20, 42, 22460 }, // ẽ
+    { 14, 26, 16, 1, 26, 73, 22502 }, // Ế
+    { 13, 25, 15, 1, 24, 56, 22575 }, // ế
+    { 14, 26, 16, 1, 26, 73, 22631 }, // Ề
+    { 11, 25, 13, 1, 24, 51, 22704 }, // ề
+    { 14, 26, 16, 1, 26, 75, 22755 }, // Ể
+    { 13, 25, 15, 1, 24, 59, 22830 }, // ể
+    { 14, 26, 16, 1, 26, 75, 22889 }, // Ễ
+    { 11, 25, 13, 1, 24, 51, 22964 }, // ễ
+    { 14, 30, 16, 1, 24, 78, 23015 }, // Ệ
+    { 11, 26, 13, 1, 20, 48, 23093 }, // ệ
+    { 8, 26, 10, 1, 26, 46, 23141 }, // Ỉ
+    { 8, 22, 9, 0, 22, 38, 23187 }, // ỉ
+    { 8, 24, 10, 1, 18, 39, 23225 }, // Ị
+    { 8, 26, 9, 0, 20, 39, 23264 }, // ị
+    { 18, 24, 20, 1, 18, 72, 23303 }, // Ọ
+    { 13, 20, 15, 1, 14, 46, 23375 }, // ọ
+    { 18, 27, 20, 1, 26, 81, 23421 }, // Ỏ
+    { 13, 23, 15, 1, 22, 57, 23502 }, // ỏ
+    { 18, 27, 20, 1, 26, 85, 23559 }, // Ố
+    { 13, 25, 15, 1, 24, 60, 23644 }, // ố
+    { 18, 27, 20, 1, 26, 86, 23704 }, // Ồ
+    { 13, 25, 15, 1, 24, 59, 23790 }, // ồ
+    { 18, 27, 20, 1, 26, 88, 23849 }, // Ổ
+    { 14, 25, 16, 1, 24, 67, 23937 }, // ổ
+    { 18, 27, 20, 1, 26, 86, 24004 }, // Ỗ
+    { 13, 25, 15, 1, 24, 63, 24090 }, // ỗ
+    { 18, 30, 20, 1, 24, 87, 24153 }, // Ộ
+    { 13, 26, 15, 1, 20, 61, 24240 }, // ộ
+    { 19, 25, 21, 1, 24, 80, 24301 }, // Ớ
+    { 15, 22, 17, 1, 21, 59, 24381 }, // ớ
+    { 19, 25, 21, 1, 24, 82, 24440 }, // Ờ
+    { 15, 22, 17, 1, 21, 59, 24522 }, // ờ
+    { 19, 27, 21, 1, 26, 88, 24581 }, // Ở
+    { 15, 23, 17, 1, 22, 67, 24669 }, // ở
+    { 19, 25, 21, 1, 24, 85, 24736 }, // Ỡ
+    { 15, 21, 17, 1, 20, 60, 24821 }, // ỡ
+    { 19, 27, 21, 1, 21, 83, 24881 }, // Ợ
+    { 15, 22, 17, 1, 16, 57, 24964 }, // ợ
+    { 19, 24, 20, 0, 18, 78, 25021 }, // Ụ
+    { 17, 20, 18, 0, 14, 56, 25099 }, // ụ
+    { 19, 27, 20, 0, 26, 89, 25155 }, // Ủ
+    { 17, 23, 18, 0, 22, 65, 25244 }, // ủ
+    { 20, 25, 21, 0, 24, 86, 25309 }, // Ứ
+    { 17, 22, 18, 0, 21, 61, 25395 }, // ứ
+    { 20, 25, 21, 0, 24, 86, 25456 }, // Ừ
+    { 17, 22, 18, 0, 21, 60, 25542 }, // ừ
+    { 20, 27, 21, 0, 26, 93, 25602 }, // Ử
+    { 17, 23, 18, 0, 22, 68, 25695 }, // ử
+    { 20, 25, 21, 0, 24, 88, 25763 }, // Ữ
+    { 17, 21, 18, 0, 20, 66, 25851 }, // ữ
+    { 20, 27, 21, 0, 21, 88, 25917 }, // Ự
+    { 17, 22, 18, 0, 16, 61, 26005 }, // ự
+    { 17, 24, 18, 0, 24, 65, 26066 }, // Ỳ
+    { 15, 27, 16, 0, 21, 68, 26131 }, // ỳ
+    { 17, 24, 18, 0, 18, 64, 26199 }, // Ỵ
+    { 15, 19, 16, 0, 13, 59, 26263 }, // ỵ
+    { 17, 26, 18, 0, 26, 72, 26322 }, // Ỷ
+    { 15, 28, 16, 0, 22, 74, 26394 }, // ỷ
+    { 17, 24, 18, 0, 24, 68, 26468 }, // Ỹ
+    { 15, 26, 16, 0, 20, 68, 26536 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 26604 }, //  
+    { 0, 0, 25, 0, 0, 0, 26604 }, //  
+    { 0, 0, 13, 0, 0, 0, 26604 }, //  
+    { 0, 0, 25, 0, 0, 0, 26604 }, //  
+    { 0, 0, 8, 0, 0, 0, 26604 }, //  
+    { 0, 0, 6, 0, 0, 0, 26604 }, //  
+    { 0, 0, 4, 0, 0, 0, 26604 }, //  
+    { 0, 0, 16, 0, 0, 0, 26604 }, //  
+    { 0, 0, 7, 0, 0, 0, 26604 }, //  
+    { 0, 0, 5, 0, 0, 0, 26604 }, //  
+    { 0, 0, 1, 0, 0, 0, 26604 }, //  
+    { 0, 0, 1, 0, 0, 0, 26604 }, // ​
+    { 2, 21, 2, -1, 15, 20, 26604 }, // ‌
+    { 6, 23, 4, -3, 17, 33, 26624 }, // ‍
+    { 8, 24, 5, -4, 18, 35, 26657 }, // ‎
+    { 8, 24, 5, -4, 18, 35, 26692 }, // ‏
+    { 8, 3, 10, 1, 8, 10, 26727 }, // ‐
+    { 8, 3, 10, 1, 8, 10, 26737 }, // ‑
+    { 12, 3, 16, 2, 10, 14, 26747 }, // ‒
+    { 13, 3, 14, 0, 8, 15, 26761 }, // –
+    { 25, 3, 26, 0, 8, 29, 26776 }, // —
+    { 25, 3, 26, 0, 8, 29, 26805 }, // ―
+    { 8, 26, 13, 2, 20, 66, 26834 }, // ‖
+    { 13, 6, 14, 0, -1, 15, 26900 }, // ‗
+    { 5, 8, 7, 1, 19, 11, 26915 }, // ‘
+    { 5, 8, 6, 0, 19, 13, 26926 }, // ’
+    { 5, 9, 6, 0, 4, 12, 26939 }, // ‚
+    { 5, 8, 7, 1, 19, 13, 26951 }, // ‛
+    { 10, 8, 12, 1, 19, 22, 26964 }, // “
+    { 10, 8, 11, 0, 19, 26, 26986 }, // ”
+    { 10, 9, 11, 0, 4, 24, 27012 }, // „
+    { 10, 8, 12, 1, 19, 26, 27036 }, // ‟
+    { 12, 17, 13, 0, 18, 35, 27062 }, // †
+    { 12, 20, 13, 0, 18, 48, 27097 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 27145 }, // •
+    { 9, 9, 16, 3, 13, 18, 27154 }, // ‣
+    { 5, 4, 7, 1, 3, 6, 27172 }, // ․
+    { 11, 5, 13, 1, 4, 12, 27178 }, // ‥
+    { 21, 5, 25, 2, 4, 18, 27190 }, // …
+    { 5, 4, 7, 1, 9, 7, 27208 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 27215 }, //  
+    { 0, 0, 1, 0, 0, 0, 27215 }, //  
+    { 8, 24, 5, -4, 18, 33, 27215 }, // ‪
+    { 8, 24, 5, -4, 18, 34, 27248 }, // ‫
+    { 8, 24, 5, -4, 18, 40, 27282 }, // ‬
+    { 11, 24, 7, -5, 18, 55, 27322 }, // ‭
+    { 11, 24, 7, -5, 18, 54, 27377 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 27431 }, //  
+    { 32, 21, 34, 1, 19, 135, 27431 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 27566 }, // ′
+    { 10, 9, 12, 1, 18, 24, 27578 }, // ″
+    { 15, 9, 17, 1, 18, 35, 27602 }, // ‴
+    { 6, 9, 7, 0, 18, 11, 27637 }, // ‵
+    { 11, 9, 12, 0, 18, 23, 27648 }, // ‶
+    { 17, 9, 18, 0, 18, 33, 27671 }, // ‷
+    { 11, 6, 13, 1, 0, 15, 27704 }, // ‸
+    { 7, 10, 8, 0, 11, 15, 27719 }, // ‹
+    { 7, 10, 9, 1, 11, 15, 27734 }, // ›
+    { 16, 18, 17, 0, 17, 63, 27749 }, // ※
+    { 11, 20, 14, 2, 19, 53, 27812 }, // ‼
+    { 13, 3, 14, 0, 21, 15, 27865 }, // ‾
+    { 6, 3, 8, 1, 8, 8, 27880 }, // ⁃
+    { 13, 21, 10, -4, 19, 41, 27888 }, // ⁄
+    { 20, 20, 22, 1, 19, 68, 27929 }, // ⁇
+    { 17, 20, 19, 1, 19, 64, 27997 }, // ⁈
+    { 16, 20, 19, 2, 19, 62, 28061 }, // ⁉
+    { 15, 5, 25, 5, 10, 17, 28123 }, // ⁓
+    { 20, 9, 22, 1, 18, 46, 28140 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 28186 }, //  
+    { 0, 0, 1, 0, 0, 0, 28186 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 28186 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 28186 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 28186 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 28186 }, // ⁤
+    { 11, 13, 12, 0, 21, 32, 28186 }, // ⁰
+    { 11, 13, 12, 0, 21, 32, 28218 }, // ⁴
+    { 9, 13, 11, 1, 21, 23, 28250 }, // ⁵
+    { 9, 13, 11, 1, 21, 29, 28273 }, // ⁶
+    { 8, 13, 11, 2, 21, 23, 28302 }, // ⁷
+    { 9, 13, 11, 1, 21, 34, 28325 }, // ⁸
+    { 9, 13, 11, 1, 21, 30, 28359 }, // ⁹
+    { 11, 9, 14, 2, 18, 29, 28389 }, // ⁿ
+    { 11, 12, 12, 0, 8, 32, 28418 }, // ₀
+    { 8, 13, 11, 2, 9, 20, 28450 }, // ₁
+    { 9, 12, 11, 1, 8, 26, 28470 }, // ₂
+    { 9, 12, 11, 1, 8, 24, 28496 }, // ₃
+    { 11, 12, 12, 0, 8, 30, 28520 }, // ₄
+    { 9, 12, 11, 1, 8, 23, 28550 }, // ₅
+    { 9, 12, 11, 1, 8, 30, 28573 }, // ₆
+    { 8, 12, 11, 2, 8, 22, 28603 }, // ₇
+    { 9, 12, 11, 1, 8, 32, 28625 }, // ₈
+    { 9, 12, 11, 1, 8, 29, 28657 }, // ₉
+    { 13, 18, 16, 1, 18, 42, 28686 }, // ₣
+    { 14, 19, 16, 1, 18, 52, 28728 }, // ₤
+    { 31, 19, 32, 0, 18, 101, 28780 }, // ₧
+    { 15, 19, 16, 0, 18, 50, 28881 }, // €
+    { 15, 11, 25, 5, 14, 27, 28931 }, // ←
+    { 11, 17, 25, 7, 17, 36, 28958 }, // ↑
+    { 15, 11, 25, 5, 14, 28, 28994 }, // →
+    { 11, 17, 25, 7, 17, 41, 29022 }, // ↓
+    { 15, 11, 25, 5, 14, 33, 29063 }, // ↔
+    { 11, 17, 25, 7, 17, 44, 29096 }, // ↕
+    { 11, 17, 25, 7, 17, 48, 29140 }, // ↨
+    { 11, 17, 25, 7, 17, 38, 29188 }, // ↲
+    { 11, 17, 25, 7, 17, 37, 29226 }, // ↳
+    { 13, 12, 25, 6, 15, 26, 29263 }, // ↵
+    { 15, 11, 25, 5, 14, 29, 29289 }, // ⇐
+    { 11, 15, 25, 7, 16, 48, 29318 }, // ⇑
+    { 15, 11, 25, 5, 14, 29, 29366 }, // ⇒
+    { 11, 15, 25, 7, 16, 44, 29395 }, // ⇓
+    { 15, 11, 25, 5, 14, 40, 29439 }, // ⇔
+    { 17, 19, 25, 4, 18, 54, 29479 }, // ∀
+    { 13, 21, 16, 1, 20, 56, 29533 }, // ∂
+    { 11, 18, 25, 7, 18, 38, 29589 }, // ∃
+    { 19, 20, 25, 3, 19, 79, 29627 }, // ∅
+    { 16, 18, 17, 0, 18, 52, 29706 }, // ∆
+    { 17, 19, 25, 4, 18, 60, 29758 }, // ∇
+    { 17, 18, 25, 4, 18, 56, 29818 }, // ∈
+    { 17, 22, 25, 4, 19, 72, 29874 }, // ∉
+    { 17, 14, 25, 4, 16, 46, 29946 }, // ∊
+    { 17, 18, 25, 4, 18, 56, 29992 }, // ∋
+    { 17, 22, 25, 4, 19, 71, 30048 }, // ∌
+    { 17, 14, 25, 4, 16, 46, 30119 }, // ∍
+    { 19, 22, 21, 1, 18, 78, 30165 }, // ∏
+    { 15, 23, 16, 0, 18, 66, 30243 }, // ∑
+    { 11, 3, 16, 2, 10, 13, 30309 }, // −
+    { 12, 20, 13, 0, 18, 39, 30322 }, // ∕
+    { 12, 20, 14, 1, 18, 38, 30361 }, // ∖
+    { 12, 13, 16, 2, 15, 34, 30399 }, // ∗
+    { 9, 9, 16, 3, 13, 24, 30433 }, // ∘
+    { 4, 4, 16, 6, 9, 6, 30457 }, // ∙
+    { 16, 24, 17, 0, 21, 62, 30463 }, // √
+    { 13, 10, 16, 1, 13, 33, 30525 }, // ∝
+    { 16, 9, 17, 0, 12, 37, 30558 }, // ∞
+    { 16, 18, 25, 4, 18, 35, 30595 }, // ∟
+    { 18, 18, 25, 3, 18, 44, 30630 }, // ∠
+    { 3, 26, 13, 5, 20, 27, 30674 }, // ∣
+    { 8, 26, 13, 2, 20, 78, 30701 }, // ∥
+    { 17, 18, 25, 4, 18, 52, 30779 }, // ∧
+    { 17, 18, 25, 4, 18, 56, 30831 }, // ∨
+    { 15, 18, 25, 5, 18, 56, 30887 }, // ∩
+    { 15, 19, 25, 5, 18, 59, 30943 }, // ∪
+    { 14, 26, 16, 1, 20, 58, 31002 }, // ∫
+    { 16, 15, 25, 5, 14, 25, 31060 }, // ∴
+    { 16, 15, 25, 5, 14, 24, 31085 }, // ∵
+    { 4, 13, 8, 2, 15, 12, 31109 }, // ∶
+    { 16, 15, 25, 5, 14, 30, 31121 }, // ∷
+    { 15, 5, 25, 5, 10, 17, 31151 }, // ∼
+    { 15, 13, 25, 5, 15, 40, 31168 }, // ≅
+    { 12, 9, 16, 2, 13, 28, 31208 }, // ≈
+    { 15, 8, 25, 5, 11, 24, 31236 }, // ≍
+    { 11, 11, 16, 2, 14, 27, 31260 }, // ≠
+    { 15, 11, 25, 5, 13, 35, 31287 }, // ≡
+    { 12, 15, 16, 2, 15, 31, 31322 }, // ≤
+    { 12, 15, 16, 2, 15, 29, 31353 }, // ≥
+    { 21, 13, 25, 2, 15, 44, 31382 }, // ≪
+    { 21, 13, 25, 2, 15, 44, 31426 }, // ≫
+    { 17, 15, 25, 4, 16, 39, 31470 }, // ⊃
+    { 17, 23, 25, 4, 20, 64, 31509 }, // ⊄
+    { 17, 23, 25, 4, 20, 63, 31573 }, // ⊅
+    { 17, 18, 25, 4, 18, 46, 31636 }, // ⊆
+    { 17, 18, 25, 4, 18, 47, 31682 }, // ⊇
+    { 19, 19, 25, 3, 18, 94, 31729 }, // ⊕
+    { 19, 19, 25, 3, 18, 73, 31823 }, // ⊖
+    { 19, 19, 25, 3, 18, 89, 31896 }, // ⊗
+    { 19, 19, 25, 3, 18, 79, 31985 }, // ⊘
+    { 15, 18, 25, 5, 18, 50, 32064 }, // ⊥
+    { 4, 4, 16, 6, 9, 6, 32114 }, // ⋅
+    { 21, 4, 25, 2, 9, 17, 32120 }, // ⋯
+    { 25, 24, 26, 0, 21, 101, 32137 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
@@ -3463,4 +2784,5 @@ static const EpdFontData bookerly_12_regular = {
     27,
     -7,
     true,
+    true,
 };
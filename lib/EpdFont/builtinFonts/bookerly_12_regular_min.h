@@ -3463,4 +3463,5 @@ static const EpdFontData bookerly_12_regular_min = {
     27,
     -7,
     true,
+    false,
 };
@@ -2,4523 +2,3262 @@
  * generated by fontconvert.py
  * name: bookerly_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_boldBitmaps[61282] = {
-    0x1A, 0x4B, 0xF8, 0xFF, 0x8F, 0xF4, 0xFF, 0x4F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xBF,
-    0x0B, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF0, 0x10, 0x00, 0x00, 0x2F, 0x4B, 0xFC, 0xBF, 0xC7,
-    0xFC, 0x15, 0x00, 0x2F, 0x42, 0xE7, 0xF4, 0xFF, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB,
-    0xF0, 0xFE, 0xBF, 0x0F, 0xD7, 0xF0, 0xFD, 0x7E, 0x0F, 0xD1, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15,
-    0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x2F,
-    0x80, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x5B, 0xF5, 0x7F, 0x54,
-    0x00, 0xBE, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x02, 0xAF, 0xEA,
-    0xFE, 0xA4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF0, 0x2F, 0x40, 0x00,
-    0x7F, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFB, 0xFB, 0xFC,
-    0x3F, 0x8B, 0x8B, 0xF0, 0xFD, 0x2E, 0x0F, 0x83, 0xF4, 0xB8, 0x14, 0x0F, 0xF7, 0xE0, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x60, 0x3D, 0x7F, 0xC7, 0xC0, 0xF0, 0xBF, 0x3F, 0x43, 0xC2, 0xFC, 0xFF, 0x0F, 0x0F,
-    0xE2, 0xFF, 0xBE, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xD0, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x47, 0xF4,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x02, 0xF8, 0x07, 0xE0, 0x00,
-    0x0B, 0xE0, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x2F,
-    0x83, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0xBD, 0x07, 0xF9, 0x03, 0xF9, 0xBF, 0x0F, 0xC3, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xC2, 0xF0, 0xBF, 0x6F, 0xC0, 0x2F, 0xD0, 0x7E, 0x0F, 0xC0, 0xFE, 0x00, 0x00,
-    0x0F, 0xC1, 0xFC, 0x0B, 0xE0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0x02, 0xF8,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x0B, 0xD0, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x4B,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xAA, 0xA4, 0x00, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x7F, 0x8F, 0xF4, 0x0B, 0xE0, 0x03,
-    0xFC, 0x1F, 0xF4, 0x1F, 0x80, 0x0F, 0xF0, 0x2F, 0xF4, 0xBE, 0x00, 0x3F, 0xC0, 0x2F, 0xFA, 0xF4,
-    0x00, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x95, 0xBF,
-    0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x96, 0xFF, 0xC0, 0x00, 0x15,
-    0x50, 0x00, 0x54, 0x00, 0x2F, 0x5F, 0xDB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF1, 0xFC, 0x7E, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x02, 0xFC, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F,
-    0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x80, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xF4, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x2F, 0xE0, 0x02, 0xF8, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0x01, 0xD2, 0xF4, 0x0F, 0xDF, 0x80, 0x2F, 0xFD,
-    0xA4, 0x07, 0xFF, 0xE1, 0xBF, 0xEF, 0x4F, 0xEF, 0x44, 0x2E, 0x3F, 0x00, 0x10, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x2A, 0xBF,
-    0xEA, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF4, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x2F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x50, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x0B, 0xFF, 0x00, 0xFF, 0x80, 0x2F, 0xF4,
-    0x0F, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0xC3, 0xFE, 0x00,
-    0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0xC3,
-    0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F, 0xF4, 0x1F, 0xF4, 0x01,
-    0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x2F, 0x80,
-    0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0xD0, 0x2F, 0xF0, 0xBD, 0x00, 0x3F, 0xC0, 0xA0, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0xA5, 0x6F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0xC2, 0xAB, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xE4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0x4F,
-    0xF0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x1F,
-    0xD0, 0x0F, 0xF0, 0x03, 0xFE, 0xAA, 0xFF, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0A, 0xAA, 0xBF, 0xFA, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xAA, 0xA8, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0xAA, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFA, 0xA4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0xF8, 0x7F, 0xC0, 0x0F, 0xFC, 0x7F,
-    0xC0, 0x07, 0xFC, 0x7F, 0xD0, 0x03, 0xFD, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xF0, 0x07, 0xFC, 0x1F,
-    0xF8, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEA,
-    0xAB, 0xFC, 0xFD, 0x00, 0x2F, 0xD3, 0xF0, 0x01, 0xFF, 0x07, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xBF, 0xF0, 0x0F, 0xF4, 0x0F, 0xF8, 0x1F, 0xE0, 0x07, 0xFC, 0x1F, 0xE0, 0x07, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x0F, 0xFD, 0x2F, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xF9, 0xBF, 0xF4, 0x1F, 0xE0, 0x1F, 0xFC, 0x3F, 0xC0, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x3F, 0xE0, 0x0B, 0xFC, 0x3F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xF9, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x2F, 0xF4, 0x7F, 0xF4, 0x3F, 0xE0,
-    0x0F, 0xFC, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0xC0, 0x07, 0xFD, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xE0,
-    0x03, 0xFD, 0x2F, 0xF8, 0x03, 0xFD, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x6F,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x40, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xFE, 0x7F, 0xF3, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA8, 0x7F, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x06, 0xFF, 0x80, 0x07, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x2F, 0xEF, 0xF8, 0x04, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x01, 0xBF, 0xFD, 0x07, 0xFF, 0xF8, 0x07, 0xFF,
-    0xD0, 0x07, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x1B, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFD,
-    0x00, 0x6F, 0xD0, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0xFF, 0xE0, 0x0B, 0xF0, 0xBF, 0x00, 0xFD, 0x7F,
-    0xC0, 0x1F, 0xC3, 0xF8, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x4F, 0xD0, 0x0A, 0x00, 0xFD, 0x00, 0xFD,
-    0x7F, 0x40, 0x00, 0x17, 0xF4, 0x03, 0xF6, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0xCB, 0xF0, 0x03,
-    0xFE, 0xBF, 0x40, 0x7F, 0x2F, 0xC0, 0x1F, 0xC0, 0xFD, 0x03, 0xF8, 0xBF, 0x00, 0xBF, 0x03, 0xF4,
-    0x2F, 0xC1, 0xFD, 0x02, 0xFF, 0xBF, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFF, 0xDF, 0xFF, 0xD0, 0x0F,
-    0xF0, 0x03, 0xF8, 0x1B, 0xE4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1B, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00,
-    0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90,
-    0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00,
-    0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x6F, 0xF5, 0xBF, 0xF0,
-    0x07, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x2F, 0xD0, 0x1F, 0xF0, 0x0B,
-    0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0B, 0xFC, 0x1F,
-    0xF0, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xC1, 0xBF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xAB, 0xFD, 0x0B, 0xFD,
-    0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0, 0xFF, 0x40, 0x00, 0x10, 0x7F,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0,
-    0x07, 0xFD, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0xBF, 0xE0,
-    0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x7F, 0xD0, 0x00, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x02, 0xFF, 0x01,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x07,
-    0xFD, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x40, 0x6F, 0xF8, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xFC, 0x07, 0xFD, 0x00,
-    0xBC, 0x07, 0xFD, 0x00, 0x78, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x07, 0xFD, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6A,
-    0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF,
-    0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0,
-    0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0,
-    0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00,
-    0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x86, 0xFF, 0x80, 0x01,
-    0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F,
-    0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0x07, 0xFD, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0x90, 0x00, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xDF, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x6F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0xBF,
-    0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFC,
-    0x00, 0x07, 0xFC, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x02, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xEF, 0xF0, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x7F, 0xD0, 0x7E, 0xBF,
-    0x80, 0x00, 0xFD, 0x7F, 0x82, 0xF1, 0xFE, 0x00, 0x03, 0xF0, 0xFF, 0x0F, 0xC7, 0xFC, 0x00, 0x0F,
-    0xC3, 0xFC, 0x7E, 0x1F, 0xF0, 0x00, 0x3F, 0x0B, 0xF6, 0xF4, 0x3F, 0xC0, 0x01, 0xFC, 0x0F, 0xEF,
-    0xC0, 0xFF, 0x00, 0x07, 0xF0, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0xBF, 0xF4, 0x0F, 0xF4,
-    0x00, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x03, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xE0,
-    0x07, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xF0, 0x10, 0x03,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF,
-    0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE,
-    0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02,
-    0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F,
-    0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01,
-    0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02,
-    0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF,
-    0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB,
-    0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00,
-    0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F, 0xFA,
-    0xFF, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD6, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xA9, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xBF, 0xE9,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xAF, 0xFF,
-    0x40, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x07,
-    0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00,
-    0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x07,
-    0xFC, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF,
-    0x00, 0xBF, 0xF0, 0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC, 0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F, 0xC3,
-    0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80, 0x01,
-    0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB, 0xFE,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09,
-    0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xC7,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x01, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x01,
-    0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0xFF,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xF4,
-    0x02, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x2F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x00, 0x7F, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF,
-    0x80, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0xBD, 0xBF, 0xC0, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x3F,
-    0xC1, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFC, 0x3F, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x2F,
-    0xF3, 0xF4, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x07,
-    0xFF, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF4,
-    0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x40, 0x1F, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC,
-    0x00, 0x00, 0x2F, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0x80, 0x0B, 0xFE, 0x0B, 0xD0, 0x07, 0xFF, 0x01,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x64, 0x1F, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x00, 0x1F, 0xCB, 0xFE,
-    0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x3F, 0xFE, 0x3F, 0xFD, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40,
-    0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0xFD, 0x3F, 0xFE, 0x2A, 0xA8, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x15, 0x00, 0x7F, 0xFA, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0,
-    0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02,
-    0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFE, 0xFF,
-    0xFB, 0xFF, 0xDA, 0xAA, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x0B, 0xE0,
-    0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x2F, 0x80, 0x02, 0xF8, 0xAA, 0xAA, 0xAA, 0xA7,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xF0,
-    0x1F, 0xE0, 0x2F, 0xE0, 0x1F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF,
-    0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x02, 0xBF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x59,
-    0x00, 0x01, 0xFF, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xF8, 0x0F, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x03, 0xFE, 0x01, 0xFF,
-    0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0xAB, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80,
-    0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x65, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xF9, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F,
-    0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFF, 0x02, 0xFF, 0x40, 0x3F,
-    0xFF, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x05, 0x40, 0x14,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F,
-    0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xD7, 0xFC, 0x00, 0xFF, 0x00,
-    0xF4, 0x01, 0xFF, 0x00, 0x10, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x6B, 0xFF, 0xA9, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x94, 0x16, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD1, 0xFF, 0x28, 0x0F, 0xF0, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x07, 0xFF, 0xBF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x40, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xEA, 0xAB, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x01, 0xFF, 0x07, 0xFE,
-    0x41, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xAF, 0xA4, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1B,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x01, 0x64, 0x00, 0x07, 0xFC, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xD0, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x1F,
-    0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x00,
-    0x50, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x07, 0xFF, 0xC0,
-    0xBF, 0xFC, 0x02, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x07, 0xFF, 0x07, 0xFF, 0xC0, 0x7F,
-    0xF4, 0x02, 0xE4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x1F,
-    0xF0, 0x7F, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x7F, 0xD0, 0x00,
-    0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x01, 0xFF,
-    0x02, 0xFF, 0x80, 0x07, 0xFD, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x02, 0xFF, 0xD0, 0xBF, 0xFD, 0x06, 0xFF, 0xD0,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFE, 0x07, 0xFF, 0xFD, 0xBF, 0xFF, 0xD0,
-    0x00, 0x54, 0x05, 0x90, 0x00, 0x64, 0x00, 0x0B, 0xFF, 0x1F, 0xFF, 0x42, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF0, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF, 0x00,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0xFF,
-    0x80, 0x2F, 0xF0, 0x07, 0xFE, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0x0B, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE,
-    0xFF, 0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x54, 0x06, 0x40, 0x03, 0xFF, 0x8F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x02, 0xFF, 0x80, 0x7F,
-    0xC0, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x0F, 0xF4, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x7F, 0xFA, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x07, 0xFD, 0x54, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x06, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xF6, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0xFF, 0x43, 0xFE, 0x00,
-    0x3F, 0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0x42, 0xFF,
-    0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x7F, 0xF4, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFE, 0x3F, 0xD0, 0x00, 0x10, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0x54, 0x06, 0x42, 0xFF, 0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03,
-    0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2, 0xBF, 0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x43,
-    0xFF, 0xE3, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0xBF,
-    0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x0B, 0xD0, 0x3F, 0xFF, 0x3F, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xD0, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x0F, 0xE0,
-    0x02, 0xFE, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x1F, 0xF0, 0x7E, 0xFC, 0x1F, 0xC0, 0x00, 0xFF, 0x0F,
-    0x9F, 0xD2, 0xF4, 0x00, 0x0B, 0xF4, 0xF4, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x9F, 0x0B, 0xF3, 0xE0,
-    0x00, 0x03, 0xFE, 0xF0, 0x7F, 0xBD, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x7F,
-    0xFD, 0x3F, 0xFF, 0x42, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x01, 0xFF, 0x43, 0xF4, 0x00, 0x07,
-    0xFC, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x02, 0xFD,
-    0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0xEB, 0xFF, 0xE1, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF,
-    0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00,
-    0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xBF, 0xF8, 0x2F, 0x00, 0xFF,
-    0xC0, 0xB8, 0x0F, 0xFC, 0x00, 0x40, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0A, 0x02, 0xFF, 0x40, 0x7C, 0x1F, 0xF8, 0x03, 0xF0, 0xFF,
-    0xEA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0xF0, 0x3F, 0xE9, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0x7F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x03,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x1B, 0xD0, 0x00, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4,
-    0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD1, 0x50, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xFC,
-    0x02, 0xBF, 0xE0, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x3F, 0xFD, 0x07, 0xFF, 0x80, 0x2F,
-    0x80, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x2E, 0x3F, 0xFF, 0x47, 0xFF, 0xFB, 0xFF, 0xFE,
-    0xFC, 0x0B, 0xFF, 0xC2, 0x80, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xFC, 0xFF, 0xCB,
-    0xFC, 0x2A, 0x00, 0x00, 0x01, 0x02, 0xF8, 0x2F, 0x82, 0xFC, 0x2F, 0xC2, 0xFC, 0x2F, 0xC2, 0xFC,
-    0x2F, 0xD2, 0xFD, 0x2F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xC7, 0xFC, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xF5, 0xF2, 0xFC, 0x1F, 0xD1, 0xF0, 0xFC, 0x2F, 0xC1, 0xF0, 0xA0, 0x3F, 0xC1,
-    0xF0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0x81, 0xE0, 0x00, 0x3F, 0xC2,
-    0xE0, 0x00, 0x3F, 0xD2, 0xE0, 0x00, 0x2F, 0xF6, 0xE0, 0x18, 0x0F, 0xFF, 0xFB, 0xFC, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xD0,
-    0x0F, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x05, 0xBF, 0xD5, 0x50, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x14, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xEF, 0xFF, 0xFF,
-    0x40, 0x64, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x01, 0x50, 0x3C, 0x7F, 0xBF, 0xFE,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x7F, 0xD0, 0x07, 0xF0, 0x0F, 0xE0, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x07, 0xE0, 0x0B, 0xF0, 0x0B, 0xE0, 0x07, 0xF4, 0x1F, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFD, 0x3E, 0x1B, 0xE0, 0xBD, 0x18, 0x00, 0x00, 0x14, 0x3F, 0xFF, 0xD0,
-    0xBF, 0xFD, 0x7F, 0xFF, 0xC0, 0xFF, 0xFD, 0x1F, 0xFE, 0x00, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0x1F,
-    0xC0, 0x02, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x7F, 0xC0, 0xFD, 0x00,
-    0x00, 0x3F, 0xD1, 0xFC, 0x00, 0x01, 0x6F, 0xF3, 0xF9, 0x40, 0x03, 0xFF, 0xFB, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x55, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F,
-    0x4F, 0xD1, 0x50, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x6F, 0xF0, 0xBD, 0x01, 0xFC,
-    0x3F, 0x00, 0x3D, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x03, 0xDF, 0xF8, 0x00, 0xF4, 0xFF, 0xD0,
-    0x2E, 0x0B, 0xFE, 0x07, 0xD0, 0x3F, 0xE0, 0xFE, 0x01, 0xFD, 0x1F, 0xF4, 0x0F, 0x81, 0xFF, 0xC2,
-    0xF0, 0x0F, 0xFD, 0x7C, 0x00, 0x7F, 0xEF, 0x00, 0x02, 0xFF, 0x8F, 0x00, 0x2F, 0xDB, 0xD0, 0x07,
-    0xF3, 0xFD, 0x03, 0xF0, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x42, 0xF8, 0x7F, 0xC7, 0xFC, 0x7F, 0xC3, 0xFC, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E, 0x00, 0xB4, 0x02, 0xFF, 0x40, 0xB4, 0x0F, 0x01,
-    0xFF, 0xFC, 0x03, 0xC2, 0xD0, 0x3F, 0x07, 0xC0, 0x2C, 0x3C, 0x0B, 0xC0, 0x38, 0x01, 0xE3, 0xC0,
-    0xFC, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0xC0, 0x00, 0x00, 0xF3, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0x3C,
-    0x0F, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0xFE, 0x00, 0x00, 0x1E, 0x2D, 0x07, 0xFE, 0x6C, 0x02, 0xC0,
-    0xE0, 0x2F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x6F, 0xE0, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x03, 0xF6, 0xF4, 0x0B, 0x43,
-    0xE0, 0x00, 0x1F, 0x80, 0x7F, 0xFE, 0x03, 0xE5, 0xF8, 0x1F, 0x03, 0xE0, 0x7E, 0x7F, 0xF4, 0xFF,
-    0xEF, 0xC0, 0x64, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x41, 0x55, 0x40, 0x00,
-    0x00, 0x0E, 0x00, 0x2C, 0x00, 0x7F, 0x00, 0xFD, 0x02, 0xFD, 0x07, 0xF8, 0x0B, 0xF4, 0x1F, 0xF0,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x3F, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF4, 0x2F, 0xE0,
-    0x03, 0xFD, 0x0B, 0xF8, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0xFD, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x07, 0x8F,
-    0x03, 0x83, 0x80, 0xE2, 0xD0, 0xB0, 0xD0, 0x3D, 0xF0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03,
-    0xEE, 0x02, 0xC3, 0xC1, 0xF3, 0xE0, 0xE0, 0x70, 0xFE, 0x3D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00,
-    0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x2F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFE, 0x0F, 0xFB, 0xFD,
-    0x7F, 0x02, 0xF9, 0xF4, 0x03, 0xFB, 0xD0, 0x0F, 0xDF, 0xC0, 0xBE, 0x3F, 0xEF, 0xF0, 0x7F, 0xFF,
-    0x40, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB,
-    0xFE, 0xA9, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x43, 0xFE, 0xFF, 0x1F, 0xC1, 0xFD,
-    0x3E, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x02, 0xFD, 0x00, 0x2F, 0xC0,
-    0x03, 0xFE, 0xAA, 0x5F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xBF,
-    0xFF, 0x43, 0xF5, 0xFF, 0x0F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x7F, 0xF8, 0x00,
-    0xEB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xFE, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x00, 0x78, 0x0F, 0xC2, 0xFC, 0x3F, 0x8B, 0xE0, 0x78, 0x01, 0x00, 0x01,
-    0x50, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFB,
-    0xFE, 0x93, 0xFF, 0xFF, 0xCF, 0xFF, 0x4F, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0x85, 0x40, 0x05, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xEF, 0xD0, 0x2F, 0xFF,
-    0xE3, 0xF0, 0x0F, 0xFF, 0xF8, 0xFC, 0x07, 0xFF, 0xFE, 0x3F, 0x01, 0xFF, 0xFF, 0x8F, 0xC0, 0xBF,
-    0xFF, 0xE3, 0xF0, 0x1F, 0xFF, 0xF8, 0xFC, 0x03, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x8F, 0xC0,
-    0x0F, 0xFF, 0xE3, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8F,
-    0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFD, 0x7F,
-    0xE7, 0xFE, 0x3F, 0xD0, 0x00, 0x1A, 0x0B, 0xFC, 0x2F, 0xE0, 0xBD, 0x0F, 0xC7, 0xF0, 0x64, 0x00,
-    0x00, 0x1C, 0x00, 0x6F, 0xE0, 0x3F, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x01, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x03, 0xF9, 0xFF, 0x1F, 0x40, 0xFD, 0xBC, 0x02,
-    0xF6, 0xF0, 0x07, 0xDB, 0xD0, 0x2F, 0x5F, 0x80, 0xFC, 0x3F, 0xEF, 0xD0, 0x3F, 0xFE, 0x00, 0x16,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x40, 0x55, 0x40, 0x00, 0x38, 0x00, 0xB4,
-    0x00, 0xBF, 0x40, 0xFE, 0x00, 0x2F, 0xD0, 0x7F, 0x80, 0x0F, 0xF8, 0x2F, 0xF0, 0x03, 0xFE, 0x0B,
-    0xFC, 0x01, 0xFF, 0x03, 0xFC, 0x03, 0xFE, 0x0B, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0, 0x2F, 0xD0, 0x3F,
-    0x80, 0x7F, 0x40, 0xFE, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xAF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x0A, 0xD0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x02, 0xFD, 0x00,
-    0x0F, 0xE0, 0x00, 0x7D, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0F, 0xFD, 0x01, 0xFF,
-    0xFF, 0x02, 0xF4, 0x03, 0xFB, 0xD0, 0x2F, 0xFF, 0xF0, 0x3F, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x1F, 0x4B, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0xFE, 0xAF, 0xE9, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x2A, 0xAF, 0xE9, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xBF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xAF,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x3E, 0x02, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xF8,
-    0x3F, 0xEF, 0xF4, 0x00, 0xFE, 0x00, 0x3F, 0x03, 0xF0, 0x3F, 0x81, 0xFF, 0xFF, 0x07, 0xE0, 0x2F,
-    0x03, 0xF4, 0x2F, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xFA, 0xA8, 0x00,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7E, 0x4F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBF, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0x00, 0x2F, 0x40, 0x0A, 0xD0,
-    0x00, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0x7F, 0xD0, 0x00,
-    0x6F, 0xE0, 0x1F, 0x80, 0x0F, 0xFD, 0x07, 0xFF, 0xFC, 0x03, 0xF0, 0x03, 0xFB, 0xD0, 0x3F, 0xFE,
-    0x00, 0x7E, 0x00, 0xBC, 0xBD, 0x00, 0x54, 0x00, 0x0F, 0xC0, 0x1F, 0x4B, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x03, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0xAF, 0xE9, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x2A, 0xAF, 0xE9, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x6F, 0xE0, 0x07,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFE, 0x40, 0x7F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x14, 0x1F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F,
-    0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00,
-    0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF,
-    0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xF4,
-    0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xB0, 0x00,
-    0x00, 0x00, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07,
-    0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x06, 0x80, 0x69, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9,
-    0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80,
-    0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0x6F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFB, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x02,
-    0xFC, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0x00, 0xFD, 0x3F, 0xD0, 0x02, 0x40, 0x00, 0x00, 0xBF, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xAA,
-    0xA4, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xF9, 0x5B, 0xFE, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x01, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7C, 0x00, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x7F, 0xD0, 0x01, 0xBF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xAB, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0,
-    0xFF, 0x40, 0x00, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00,
-    0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3D,
-    0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x28, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40,
-    0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F,
-    0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xA4, 0x06,
-    0x80, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xD0, 0x02, 0xF4, 0x1F, 0xF4, 0x00, 0x7D,
-    0x07, 0xFD, 0x00, 0x0E, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFA, 0xAA,
-    0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0x55, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x7F, 0xD0, 0x01, 0xF8, 0x1F,
-    0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1B, 0xF8,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xFD, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0xC0, 0x2F, 0xF4,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x0F, 0xD2, 0xFC, 0x3F, 0x80, 0xBD, 0x19,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x06, 0xFF,
-    0x80, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x1A, 0x40, 0xA4, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFD, 0x3F, 0xC2, 0xFC,
-    0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x06,
-    0xFF, 0x80, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x06, 0xFF, 0xE4, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x2F, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x0F,
-    0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x7F, 0xFF, 0xFF, 0x40,
-    0xBF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40,
-    0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0x80, 0x06, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xAF, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0,
-    0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00,
-    0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC,
-    0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80,
-    0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
-    0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC,
-    0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD,
-    0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0,
-    0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00,
-    0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80,
-    0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x7E, 0x00, 0x00, 0x02, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0E, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xC0,
-    0x00, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0x00, 0x0E, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0,
-    0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1,
-    0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF,
-    0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F,
-    0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0xA8, 0x00, 0x00,
-    0x0F, 0xF4, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0,
-    0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x08, 0x00, 0x24,
-    0x1F, 0x80, 0x2F, 0x4B, 0xF8, 0x2F, 0xE0, 0xBF, 0xAF, 0xE0, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xF0,
-    0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1F, 0xF0, 0xFF, 0x4B, 0xF0, 0x0F,
-    0xE0, 0xB0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x40, 0x00, 0x1F,
-    0xFF, 0xFE, 0x0B, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xD0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFC,
-    0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0xBD, 0xFF, 0xD0, 0xBF, 0xC0, 0x0B, 0xD2,
-    0xFF, 0x42, 0xFF, 0x00, 0xBD, 0x0B, 0xFD, 0x0F, 0xFC, 0x0B, 0xD0, 0x1F, 0xF4, 0x3F, 0xF0, 0xBD,
-    0x00, 0xBF, 0xD0, 0xBF, 0xDB, 0xD0, 0x02, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD0, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xF4, 0x00,
-    0xBF, 0xFF, 0xEF, 0xFF, 0x40, 0x0B, 0xEF, 0xFF, 0xFF, 0xF4, 0x00, 0x3C, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0A,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF, 0xF4, 0x00, 0x5F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x1A, 0x00, 0x00, 0x00, 0x2F,
-    0xE1, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x6F, 0xFD, 0x00, 0x17,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF4, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0,
-    0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x07, 0xFD, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF4, 0x6F, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x1F, 0xF0, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0xBF, 0xC0, 0x7F, 0xD5,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xE0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0x7F, 0xC2, 0xFC, 0x00,
-    0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x1F, 0xF0, 0xBF, 0xF8, 0x00, 0x7F,
-    0xC0, 0xFF, 0xF8, 0x01, 0xFF, 0x00, 0xBF, 0xF8, 0x07, 0xFC, 0x00, 0xBF, 0xF0, 0x1F, 0xF0, 0x00,
-    0x7F, 0xD0, 0x7F, 0xC2, 0x40, 0xFF, 0x41, 0xFF, 0x2E, 0x03, 0xFC, 0x0B, 0xFC, 0xFE, 0x2F, 0xE1,
-    0xFF, 0xF3, 0xFF, 0xFF, 0x0B, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5,
-    0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE,
-    0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB,
-    0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x03, 0xF0,
-    0xFD, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x02, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x01, 0xA4, 0x18, 0x00, 0x07, 0xFD, 0x2E, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x4B,
-    0xFC, 0x00, 0x02, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x1F, 0xF0,
-    0xFF, 0x00, 0x0B, 0x80, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x03, 0xE0,
-    0xF8, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0,
-    0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x16, 0x40, 0x05, 0x90, 0x00,
-    0x2F, 0xFF, 0x87, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0x5F, 0xFF, 0x57, 0xFD,
-    0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0xF3, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x95, 0xAF,
-    0xF0, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFA, 0x92, 0xFF, 0xEB, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF4,
-    0x00, 0x5B, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xD1, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xF4, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80, 0x14,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F,
-    0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0xC0,
-    0x01, 0xF8, 0x7E, 0x00, 0x3F, 0x02, 0xF0, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7,
-    0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55,
-    0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07,
-    0xF0, 0x0F, 0xF4, 0xFF, 0x80, 0xFF, 0x4B, 0xF4, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF,
-    0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04,
-    0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x2F, 0x80, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x07,
-    0xF4, 0x00, 0x3F, 0xF4, 0x02, 0xFB, 0xF0, 0x1F, 0x87, 0xE0, 0xFC, 0x0B, 0xC1, 0x80, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xF8, 0x07, 0xFF, 0xE0, 0x06, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0xFC, 0x1F, 0xCF, 0xF4, 0xFF, 0x7F, 0xD3, 0xFD, 0x6D, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0xBF, 0xBE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x05,
-    0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0xBF, 0xFC, 0x3F, 0xE0,
-    0x1F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0,
-    0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xD0, 0x0B, 0xFC, 0x7F, 0xF0,
-    0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x06, 0xD0, 0x20, 0x00, 0x00, 0x1F, 0xF8, 0xB8, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x2E, 0x2F, 0xF4, 0x00, 0x00, 0x08, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F,
-    0xFE, 0xFF, 0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF,
-    0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x00, 0x90, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x69, 0x05, 0x00, 0x02, 0xFF, 0x4F,
-    0x40, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0x80, 0x07, 0xFC, 0x7F, 0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x1F,
-    0xFF, 0xF9, 0xD0, 0x1F, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x7F, 0xF8, 0x0F, 0xF4, 0x03, 0xFF, 0x07,
-    0xFC, 0x02, 0xFF, 0xC2, 0xFE, 0x02, 0xFF, 0xF4, 0xFF, 0x82, 0xF7, 0xFD, 0x3F, 0xE2, 0xF4, 0xFF,
-    0x4F, 0xFA, 0xF4, 0x3F, 0xD3, 0xFF, 0xF4, 0x0F, 0xF0, 0xBF, 0xF4, 0x07, 0xFC, 0x1F, 0xFC, 0x03,
-    0xFD, 0x03, 0xFF, 0xD7, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xF6, 0xFF, 0xFD, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F,
-    0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8,
-    0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF,
-    0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC,
-    0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x87, 0xF0, 0x00,
-    0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC,
-    0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00,
-    0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0xFF,
-    0x4B, 0xF8, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF,
-    0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x1F, 0xFF,
-    0x9F, 0xFF, 0xF0, 0x3F, 0xFD, 0x0F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
-    0xF0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xFF, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x6A, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x64, 0x00, 0x07, 0xFD, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xE0, 0x2F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xF0, 0x07, 0xFF,
-    0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xD5, 0x40, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x79,
-    0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD1, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0xFF, 0xD0, 0xFF, 0xE0, 0x03, 0xFC, 0x01,
-    0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFD, 0x03, 0xFC, 0x00, 0x0F, 0xF8,
-    0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x9F, 0xC0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xAF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xF2, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0xFE, 0x55, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFD, 0x55,
-    0x5F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x40, 0x01, 0xFF, 0xE4, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xF3, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0,
-    0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0xFE, 0x57, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x07, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0E,
-    0x00, 0x0F, 0xE4, 0x7E, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F,
-    0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43,
-    0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8,
-    0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40,
-    0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB,
-    0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xAB, 0xFD, 0x0B, 0xFD, 0x00, 0x3F, 0x47, 0xFD, 0x00,
-    0x0F, 0xD3, 0xFF, 0x00, 0x02, 0xF0, 0xFF, 0x40, 0x00, 0x10, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xF9, 0x5A, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8,
-    0x1F, 0xF9, 0xFF, 0xC3, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0x4B, 0xF8, 0x01, 0x40, 0xFF, 0x80,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07,
-    0xFF, 0x80, 0x08, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
-    0x4B, 0xF0, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x06, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFE, 0xAF, 0xF4,
-    0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B, 0xC3, 0xFD, 0x00, 0x00,
-    0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0xC0, 0x01, 0xF8, 0x7E, 0x00, 0x3F,
-    0x02, 0xF0, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x0F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC, 0x03, 0xF4, 0xBF, 0x80,
-    0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFE, 0xAF, 0xF4, 0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B,
-    0xC3, 0xFD, 0x00, 0x00, 0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xF8, 0x1F, 0xF9, 0xFF, 0xC3, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0x3F, 0x4B, 0xF8,
-    0x01, 0x40, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x08, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFE, 0x00, 0x01, 0x55, 0x00, 0x00, 0x28, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x03, 0xFC,
-    0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFE, 0xAF, 0xF4, 0x2F, 0xF4, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x3F, 0x4F, 0xFC, 0x00, 0x0B,
-    0xC3, 0xFD, 0x00, 0x00, 0x41, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE5, 0x6B, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x02, 0x40, 0x1D, 0x00, 0xBD, 0x07, 0xE0, 0x07, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90,
-    0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0x9F, 0xFC, 0x3F, 0xD0, 0x3F, 0xC7, 0xFC,
-    0x03, 0xF4, 0xBF, 0x80, 0x14, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x83, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0xB0, 0x01, 0xF0, 0x00, 0x00, 0x3F,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xE6,
-    0xBF, 0xFF, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0x40,
-    0x02, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00,
-    0x02, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x1F, 0xF4, 0x00,
-    0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xD0, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x7F, 0xE0, 0x07, 0xFD, 0x01, 0xBF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x02, 0xFF, 0xF4,
-    0x3E, 0x00, 0x01, 0xBF, 0xF4, 0x7D, 0x00, 0x00, 0x0F, 0xF4, 0x7C, 0x00, 0x00, 0x0F, 0xF4, 0xB8,
-    0x00, 0x00, 0x0F, 0xF4, 0xB4, 0x00, 0x06, 0x5F, 0xF4, 0x10, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xF9, 0x6F, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x0F,
-    0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x2F, 0xFF, 0xFB, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x54, 0x01, 0x40, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xF9, 0xAF, 0xFF, 0xC0,
-    0x01, 0xFF, 0x40, 0x2F, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0x40, 0x02, 0xFF,
-    0x80, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x7F, 0xFF, 0xFF, 0x40, 0xBF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0x00,
-    0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x00,
-    0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0x80, 0x06, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6B, 0xEF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x41, 0xFF, 0x40, 0x7F, 0xD0, 0x0F, 0xF4, 0x0B, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xF4, 0x0F,
-    0xFC, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFF, 0x02, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF9, 0x02, 0xFF, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xC3, 0xFF, 0xC0, 0x05, 0x40, 0x14, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x1B, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x40, 0x0B, 0xD0, 0x7F, 0xD0, 0x01, 0xF4, 0x1F, 0xF4,
-    0x00, 0x38, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x95, 0x54, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0x41, 0xFF, 0x40, 0x07, 0xE0, 0x7F, 0xD0, 0x03,
-    0xF8, 0x6F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03,
-    0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF,
-    0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x70, 0x00, 0x1F, 0xD1, 0xBC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD,
-    0x00, 0x1F, 0x41, 0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0xAA, 0xA0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40,
-    0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00,
-    0x7E, 0x07, 0xFD, 0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x07, 0xF4, 0x2F, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB,
-    0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40,
-    0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F,
-    0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8,
-    0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF,
-    0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x00, 0x05, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x03, 0xD0, 0x00, 0xFC, 0x03,
-    0xF4, 0x00, 0x1F, 0xD3, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F,
-    0x41, 0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA,
-    0xA0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07,
-    0xFD, 0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0x80, 0x1D, 0x00, 0x7D, 0x07, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0x1F, 0xEF, 0x40, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
-    0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02,
-    0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x3F,
-    0x00, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B,
-    0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0,
-    0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF,
-    0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x16, 0x40, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xD1, 0xFF, 0x28, 0x0F,
-    0xF0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0xFF,
-    0x40, 0x07, 0xFF, 0xBF, 0xF0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEA, 0x40, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xEA, 0xAB, 0xFF, 0x43, 0xFC, 0x00, 0x0F, 0xF4, 0x7F, 0xC0,
-    0x01, 0xFF, 0x07, 0xFE, 0x41, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x01, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0E, 0x00, 0x00,
-    0x0F, 0xE5, 0xBE, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B,
-    0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0,
-    0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40,
-    0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x1C, 0x00, 0x02,
-    0xFD, 0x0B, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2, 0x80, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA,
-    0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF0, 0x2F, 0xF0,
-    0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA, 0xA8, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-    0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2, 0x80,
-    0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4, 0x0F,
-    0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47, 0xFC,
-    0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xAF, 0xF0, 0x0B, 0xFE, 0x00, 0x0B, 0xF0, 0x1F, 0xF8,
-    0x00, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x03, 0xD0, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAA,
-    0xA8, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xD0, 0x02, 0xFF, 0xFC, 0xBF, 0xE0, 0x00, 0x0F, 0xF8,
-    0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x41, 0x64, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x1F, 0xF2,
-    0x80, 0xFF, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x0F, 0xF4,
-    0x0F, 0xF4, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xA4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xAA, 0xBF, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0x47,
-    0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xE4, 0x1B, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x1F, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE1,
-    0xBF, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00,
-    0x7F, 0xD0, 0x07, 0xFE, 0xAA, 0xAB, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x95, 0x55, 0xBF, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0,
-    0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x6F, 0xFE, 0x00, 0x1F, 0xFF, 0x8F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01,
-    0x64, 0x00, 0x01, 0xFF, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xD0, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01,
-    0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF,
-    0x40, 0x3F, 0xF4, 0x0F, 0xFF, 0xF0, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
-    0x1B, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x0A, 0xBF, 0xEA, 0xAA,
-    0xBF, 0xFA, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x5B, 0xFE, 0x55, 0x56, 0xFF, 0x54, 0x01,
-    0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xEA, 0xAA, 0xAF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x95, 0x55, 0xBF, 0xD0, 0x00, 0x7F,
-    0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x6F, 0xFE,
-    0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1A,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x1B, 0xE0, 0x00, 0x1F, 0xF7, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFA, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x1F,
-    0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFD, 0x00,
-    0xFF, 0x80, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0,
-    0x07, 0xFD, 0x00, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x01,
-    0x00, 0x00, 0xFF, 0x47, 0x4B, 0xFF, 0xBF, 0x3F, 0xBF, 0xF8, 0x74, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x0B, 0x80, 0x80, 0xFF,
-    0xC7, 0xC7, 0xFF, 0xFF, 0x1F, 0x1F, 0xF8, 0x14, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x3F,
-    0xFF, 0xFC, 0x1B, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x06, 0xFF, 0xE4, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x1B, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF4, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x10, 0x00,
-    0x01, 0xE0, 0x03, 0xCB, 0xF4, 0x7F, 0x1F, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x06, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x01,
-    0xCB, 0xF4, 0x2F, 0x0F, 0xFF, 0xF4, 0x0F, 0xFF, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x07, 0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x01, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xFE,
-    0x01, 0xFF, 0xF8, 0x01, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07,
-    0xFF, 0x40, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC1, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00,
-    0x6F, 0xFE, 0x4F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0x14, 0x02, 0xFF, 0xE0, 0x7F, 0xFE, 0x01,
-    0xBF, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xF4, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFF, 0x90, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD,
-    0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x00, 0x7F, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x07, 0xFE, 0x02, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14,
-    0x2F, 0xFE, 0x02, 0xFF, 0xE7, 0xFF, 0xE0, 0x7F, 0xFE, 0x1B, 0xFE, 0x01, 0xBF, 0xE0, 0x3F, 0xE0,
-    0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFE, 0x07, 0xFF, 0x40, 0x3F, 0xD3, 0xFF, 0xFE, 0x03, 0xFD, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x01, 0xE8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xD3,
-    0xF8, 0x03, 0xF4, 0x0F, 0xC0, 0x19, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x01, 0xBF, 0xF9, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0xF0, 0x00, 0xFE, 0xF8, 0x02, 0xF0, 0xFD, 0x07, 0xD0, 0x3E, 0x02, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x07, 0xFF, 0xC0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0x7F, 0xFC,
-    0x00, 0x7F, 0xF4, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xDF, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0, 0x6F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x80,
-    0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xC1, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0xC0,
-    0x01, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xFF, 0xD3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x1F, 0xF0, 0x7F, 0xFF, 0x00,
-    0x7F, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF7,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x7F, 0xD0, 0x00, 0x07, 0xFC, 0xBF, 0xC0,
-    0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x7F, 0xC1, 0xFF, 0x80, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x07,
-    0xFD, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x3F, 0xFF, 0x47, 0xFF, 0xE0,
-    0xFF, 0xFD, 0x06, 0xFF, 0x80, 0xFF, 0x80, 0x03, 0xFE, 0x0B, 0xF4, 0x00, 0x0F, 0xF8, 0x7F, 0x40,
-    0x00, 0x3F, 0xE7, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xF9, 0xFF, 0x40, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x03, 0xFE, 0x07,
-    0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFF, 0x02, 0xFF, 0xFD, 0x0F, 0xFF, 0x0F, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81,
-    0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x1F, 0xF9, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xFD, 0x0B, 0xFF, 0xD0, 0x6F, 0xFD, 0x00, 0x3F, 0xD0, 0x03,
-    0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00,
-    0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x7F, 0xE0, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E,
-    0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0xFF, 0xD0, 0xBF, 0xFD, 0x06,
-    0xFF, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F,
-    0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x07, 0xFE, 0x07, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xC3, 0xF0, 0xFF, 0xFF, 0xE0, 0xF4, 0x06, 0xFF, 0x80, 0x3C, 0x00,
-    0x7F, 0xD0, 0x0E, 0x00, 0x1F, 0xF4, 0x01, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0x01, 0xFF,
-    0x40, 0x03, 0xE0, 0x7F, 0xD0, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x14, 0x05, 0x0B, 0xFF, 0x43, 0xEB, 0xFF,
-    0xD1, 0xF9, 0xBF, 0xF4, 0x7D, 0x03, 0xFD, 0x2F, 0x00, 0xFF, 0x4B, 0x80, 0x3F, 0xD2, 0xC0, 0x0F,
-    0xF4, 0x10, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x01, 0xF8, 0x07, 0xFD, 0x01, 0xFF, 0x41, 0xFF, 0x40, 0x7F, 0xD0, 0x7F, 0xD0,
-    0x0F, 0xF0, 0x1F, 0xF4, 0x01, 0xA0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0xB0, 0x1F, 0xF4, 0x00, 0x3E, 0x07, 0xFD, 0x00, 0x2F, 0x81, 0xFF, 0x40, 0x0F, 0xE1,
-    0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x02, 0xF4, 0x03, 0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x0B,
-    0xFC, 0x03, 0xFD, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x50, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x68, 0x00, 0x00,
-    0x7F, 0xEF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xB9, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0B,
-    0x00, 0x1F, 0xF4, 0x00, 0x3E, 0x00, 0x7F, 0xD0, 0x02, 0xF8, 0x01, 0xFF, 0x40, 0x0F, 0xE0, 0x1B,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x00,
-    0x0B, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x64, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF,
-    0x80, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x3F, 0xFF, 0x40, 0x08, 0xFF, 0x40, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80,
-    0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40,
-    0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC,
-    0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80,
-    0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF,
-    0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE,
-    0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF,
-    0xFF, 0x40, 0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03,
-    0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F,
-    0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF,
-    0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02,
-    0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F,
-    0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07,
-    0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF, 0xFF, 0x40,
-    0x2B, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F,
-    0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF,
-    0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80, 0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02,
-    0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC, 0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F,
-    0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07,
-    0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x09, 0x00, 0xA4, 0x00, 0x00, 0x2F, 0x02, 0xF4,
-    0x00, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x05, 0x90, 0x00, 0x2F, 0xFC, 0x7F, 0xFD, 0x00, 0x7F, 0xFE, 0xFF, 0xFF, 0x40, 0x2B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00,
-    0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x15, 0x01, 0x64, 0x00, 0x0F, 0xC0, 0xBF, 0xE2, 0xFF, 0xF4, 0x02, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3E, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xD0, 0x01, 0xBF, 0xD0,
-    0x02, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFD, 0x00,
-    0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0x80, 0x3F, 0x80, 0x02, 0xFC,
-    0xBF, 0xD0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xF8, 0x3F, 0x80,
-    0x02, 0xFC, 0x0B, 0xFD, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x01, 0xFF,
-    0xBF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0x80,
-    0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x54, 0x05, 0x90, 0x02, 0xFF,
-    0xC7, 0xFF, 0xD0, 0x7F, 0xFE, 0xFF, 0xFF, 0x42, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC,
-    0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x2F, 0xFF, 0xC0, 0x7F, 0xC3, 0xFF, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2E,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xEA, 0xFF,
-    0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F,
-    0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0B, 0x00, 0x00, 0x01, 0xFD, 0x1B, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x03, 0x80, 0x03, 0xF8, 0x1F, 0x40, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F,
-    0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F,
-    0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x80, 0x00, 0x0B, 0xF8, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40,
-    0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0,
-    0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB,
-    0xFC, 0x00, 0x00, 0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F,
-    0xF4, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x3F, 0x8F, 0xD0, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0xBD, 0x2F, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF,
-    0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFA, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x01,
-    0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x90, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFA, 0xAA, 0x40, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x3F, 0xF5,
-    0x55, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x10,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x0F, 0xFE,
-    0x00, 0x3F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x90, 0x00, 0x59, 0x40, 0x00, 0x7F, 0xFF, 0x81, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xC0, 0x7F, 0xE6, 0xFF, 0xFE, 0x5F, 0xFC, 0x3F, 0xE0, 0x0F, 0xFE, 0x00, 0xFF,
-    0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0xF7, 0xFF, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xF0, 0x01, 0xFF, 0x55, 0x55, 0x4F,
-    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0x0F, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40,
-    0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0x07, 0xFC, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01,
-    0xFF, 0x00, 0xBF, 0xF0, 0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x64, 0x2F, 0xF8, 0x7F,
-    0xC7, 0xFF, 0xCF, 0xFC, 0x2B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xA8, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x6F, 0xFA, 0xBF, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x3F,
-    0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0x01, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xF0,
-    0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0x43, 0xFF, 0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x06, 0x42, 0xFF,
-    0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02,
-    0xC0, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xEA, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x0F, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x1F, 0xF0,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x3F, 0xFD, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xE3, 0xFF, 0xFF, 0x80,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x80, 0x0A, 0x00, 0x3F, 0x03, 0xF0, 0x02,
-    0xF8, 0xBD, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x06, 0x42, 0xFF, 0x87, 0xFC, 0x7F, 0xFC, 0xFF, 0xC2, 0xBF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xEA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC, 0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F,
-    0xC3, 0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80,
-    0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x3F, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFC, 0x3F, 0xC0, 0x7F, 0x0F, 0xF0, 0x0B, 0xC3, 0xFD, 0x01, 0x90, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x7C, 0x00,
-    0xFF, 0x6F, 0x80, 0x2F, 0xDB, 0xF8, 0x1F, 0xF1, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x0F,
-    0xE0, 0x07, 0xF0, 0x0F, 0xC0, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0x0F, 0xF8, 0x01, 0xFC, 0x3F,
-    0xD0, 0x03, 0xF0, 0xFF, 0x40, 0x0F, 0x43, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xF4, 0xA0, 0x00, 0x7F, 0xE7, 0xE0, 0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFD, 0x7F, 0x80, 0x1F, 0xF1,
-    0xFF, 0xEA, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE1, 0xFC, 0x03,
-    0xF0, 0x1F, 0x00, 0x60, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03, 0xFD,
-    0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x1A, 0xA9, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x07, 0xFF, 0x5B, 0xFC,
-    0x3F, 0xE0, 0x07, 0xF0, 0xFF, 0x40, 0x0F, 0xC3, 0xFD, 0x00, 0x3D, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD2, 0x80, 0x01, 0xFF, 0x9F, 0x80, 0x03, 0xFE, 0x7F, 0x00, 0x0F,
-    0xF5, 0xFE, 0x00, 0x7F, 0xC7, 0xFF, 0xAB, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1A,
-    0x50, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC, 0x3F, 0xC0, 0x2F, 0x0F, 0xF4,
-    0x06, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0xBF, 0xF5, 0xF0, 0x03, 0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F, 0xC7, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xBF, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0x90, 0x00, 0x03, 0x80, 0x0B, 0x80,
-    0x2F, 0x40, 0xBE, 0x00, 0x3F, 0x8B, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0x0F, 0xF8, 0x01, 0xFC, 0x3F, 0xD0, 0x03, 0xF0, 0xFF, 0x40, 0x0F,
-    0x43, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0xA0, 0x00, 0x7F, 0xE7, 0xE0,
-    0x00, 0xFF, 0x9F, 0xC0, 0x03, 0xFD, 0x7F, 0x80, 0x1F, 0xF1, 0xFF, 0xEA, 0xFF, 0x87, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x06, 0x00, 0x38, 0x07, 0xD0, 0x3F, 0x00,
-    0xFD, 0x3F, 0x00, 0x1F, 0xEF, 0x40, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xFC,
-    0x3F, 0xC0, 0x2F, 0x0F, 0xF4, 0x06, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF5, 0xF0, 0x03, 0xFD, 0xBE, 0x00, 0xBF, 0x6F, 0xE0, 0x7F,
-    0xC7, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-    0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00,
-    0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2,
-    0xBF, 0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01,
-    0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x06, 0x90,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x1C, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xD3, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x1F, 0xC7, 0xC0, 0x0F, 0xF1, 0xD0, 0x07, 0xFC, 0x10, 0x01, 0xFF, 0x00, 0x06, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xF4, 0xAF, 0xFE, 0xA8, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC,
-    0x00, 0x02, 0xFF, 0x40, 0x40, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2, 0xBF,
-    0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xBF, 0xFA, 0x90, 0xFF,
-    0xFF, 0xF8, 0x16, 0xFF, 0x54, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01, 0x01,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x2C, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xF4, 0x00, 0x00, 0x00, 0xFA,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF, 0xF4, 0x00, 0x5F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x7C, 0x7F, 0xE0, 0x00, 0x00, 0x14, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40,
-    0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0x41, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFD, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F,
-    0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8,
-    0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0D, 0x00,
-    0x00, 0x00, 0x3F, 0x96, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD1, 0xBF,
-    0xF4, 0x00, 0x5F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x7F, 0x42, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC,
-    0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00,
-    0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x3D, 0x00,
-    0x00, 0x00, 0x03, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00,
-    0x0F, 0xEF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00,
-    0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x40,
-    0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F,
-    0x03, 0xC0, 0x00, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x57, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x3F, 0xF8, 0x00, 0x05, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x07, 0xF4, 0x02, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xF0, 0x0B, 0xF8, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x80, 0x2F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0xBD, 0xBF, 0xC0, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x2F,
-    0xF1, 0xFC, 0x3F, 0xE2, 0xF8, 0x00, 0x00, 0x0F, 0xF6, 0xF8, 0x2F, 0xF3, 0xF4, 0x00, 0x00, 0x0F,
-    0xFB, 0xF0, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x0B, 0xD0, 0x3F, 0xFF, 0x3F,
-    0xFF, 0x80, 0xFE, 0x03, 0xFF, 0xD0, 0xFF, 0xC0, 0x0F, 0xF0, 0x07, 0xF4, 0x07, 0xFC, 0x02, 0xFF,
-    0x40, 0xBF, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x0F, 0xE0, 0x02, 0xFE, 0x03, 0xFF, 0xC0, 0xFC, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFC, 0x1F, 0xC0, 0x00, 0xFF, 0x0F, 0x9F, 0xD2, 0xF4, 0x00, 0x0B, 0xF4, 0xF4,
-    0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x9F, 0x0B, 0xF3, 0xE0, 0x00, 0x03, 0xFE, 0xF0, 0x7F, 0xBD, 0x00,
-    0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0x8B, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x7D, 0x00, 0x00, 0x02, 0x40, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xAF, 0xFF, 0xF8, 0x2F, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x07, 0xF0, 0x00,
-    0x00, 0xBF, 0xC3, 0xF4, 0x00, 0x00, 0x0F, 0xF9, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x01, 0xF8, 0x0F, 0x80,
-    0x00, 0x02, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F, 0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00,
-    0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40,
-    0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0xA8, 0x00, 0x00, 0x0F, 0xF0,
-    0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xE0, 0xBF, 0xFF, 0x47, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x0F, 0xF8, 0x1F,
-    0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xE7, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0x80, 0x0B, 0xFE, 0x0B, 0xD0, 0x07,
-    0xFF, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x64, 0x1F, 0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x00, 0x1F,
-    0xCB, 0xFE, 0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xEA, 0xFF, 0xE0, 0xBC, 0x03, 0xFF, 0x02, 0xE0, 0x3F, 0xF0, 0x01, 0x02,
-    0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x28, 0x0B, 0xFD, 0x01, 0xF0, 0x7F, 0xE0, 0x0F, 0xC3, 0xFF, 0xAA, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBE, 0x00, 0x2F, 0xF8, 0x2F, 0x40, 0x1F, 0xFC, 0x07,
-    0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xE0, 0x01, 0x90, 0x7F, 0xF0, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0x2F, 0xF8,
-    0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC2, 0xFE, 0xAF, 0xFE, 0x0B, 0xC0, 0x3F,
-    0xF0, 0x2E, 0x03, 0xFF, 0x00, 0x10, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x02, 0x80, 0xBF, 0xD0, 0x1F, 0x07, 0xFE, 0x00, 0xFC, 0x3F,
-    0xFA, 0xAF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x02, 0xE0, 0x00, 0x7E, 0x02, 0xF8, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xBE, 0x00, 0x2F,
-    0xF8, 0x2F, 0x40, 0x1F, 0xFC, 0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x01, 0x90, 0x7F, 0xF0, 0x00, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0x2F, 0xF8, 0x00, 0x3F, 0xCF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x1E, 0x00, 0x1F, 0x40,
-    0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xBD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFA, 0xBF, 0xF8, 0x2F, 0x00, 0xFF, 0xC0, 0xB8, 0x0F, 0xFC, 0x00, 0x40,
-    0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x0A, 0x02, 0xFF, 0x40, 0x7C, 0x1F, 0xF8, 0x03, 0xF0, 0xFF, 0xEA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0xE6, 0xFD, 0x03, 0xFE, 0x01, 0xF0, 0x0F, 0xF4, 0x01, 0x00, 0x7F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x06, 0xA9, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x2F,
-    0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x07, 0xFE, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x16, 0x51, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0x9B, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x7F, 0xC0, 0x0B, 0xFC, 0x2F,
-    0xF0, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0xC0, 0x07, 0xFD,
-    0x3F, 0xF0, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0xBF, 0xC1, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xFE, 0xBF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xBF,
-    0xFA, 0xFF, 0xF0, 0xFF, 0x0F, 0xFC, 0x0B, 0xFE, 0x3F, 0xC3, 0xFF, 0x00, 0xFF, 0xC7, 0xF0, 0xFF,
-    0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC6, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x02,
-    0xFE, 0x00, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x64,
-    0x00, 0x07, 0xFD, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F,
-    0xE0, 0x2F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xF8, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xF0, 0x07, 0xFF, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xD5, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x02,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x1B, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD2, 0xBF, 0xFA, 0xA0, 0x0B, 0xFC, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFD, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFC, 0x00, 0x15, 0x7F, 0x00, 0x00, 0x0F, 0x80, 0x18, 0x07, 0xD0, 0x1F, 0x87, 0xF0, 0x07,
-    0xFF, 0xF4, 0x00, 0xFF, 0xF4, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x40, 0xFF,
-    0x80, 0xBE, 0x7F, 0x00, 0xFF, 0x80, 0xBE, 0x7F, 0x80, 0xFF, 0x80, 0xBD, 0x2F, 0xC0, 0xFF, 0x80,
-    0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xF0,
-    0xBF, 0x00, 0xFF, 0x00, 0xB0, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFD, 0x02, 0xBF, 0xFA, 0xA0, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x10, 0x01, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09,
-    0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC2, 0xC0, 0x00,
-    0x00, 0x3F, 0xEB, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFC, 0x0B,
-    0xFF, 0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x34,
-    0x03, 0xF4, 0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x38, 0x0F, 0xD1,
-    0xFD, 0x3F, 0x8B, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xC0, 0x07, 0xFF, 0x00, 0xFE,
-    0xFC, 0x2F, 0x4B, 0xD7, 0xE0, 0x3E, 0x24, 0x00, 0x40, 0x1A, 0x40, 0x87, 0xFE, 0x2E, 0xBF, 0xFF,
-    0xEB, 0x8B, 0xFD, 0x20, 0x1A, 0x40, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0x10, 0x00,
-    0x0B, 0x80, 0x0A, 0xFF, 0x47, 0xE7, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x05, 0x00, 0x0A, 0x43, 0xFC,
-    0x7F, 0xD3, 0xFC, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x1E, 0x41, 0xE4, 0x01, 0x50, 0x3F, 0xFC, 0xFE, 0xBF, 0xF8, 0x3F, 0x64, 0x3E, 0x01, 0xFC,
-    0x0F, 0xE0, 0x07, 0x80, 0x02, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3E, 0xFD, 0xB8, 0x3E, 0xF8, 0x2F,
-    0xBC, 0x2E, 0x7F, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0F, 0x40, 0xFC, 0x3F,
-    0x0B, 0xF2, 0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x7D, 0x07, 0xC1, 0xE0, 0x04, 0x01, 0x00, 0x24, 0x02,
-    0x9F, 0xC0, 0xBD, 0xBF, 0x1F, 0x83, 0xFB, 0xF0, 0x0F, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x1E, 0x03, 0xF0, 0xFC, 0x0B, 0xE3, 0xF8, 0x0F, 0xC3, 0xF0, 0x1F, 0x4B,
-    0xD0, 0x2D, 0x0F, 0x40, 0x10, 0x04, 0x02, 0xF9, 0x02, 0xFF, 0xFC, 0x7F, 0xBF, 0xEF, 0x40, 0x7F,
-    0x90, 0x01, 0xC0, 0x00, 0x00, 0x02, 0x80, 0xFC, 0x2F, 0x43, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x82,
-    0xF4, 0x05, 0x07, 0xFC, 0x3F, 0xC1, 0xFC, 0x1F, 0xC2, 0xF4, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x05,
-    0x03, 0xFD, 0x3F, 0xC3, 0xF4, 0x3F, 0x42, 0xF8, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x3D, 0x3F, 0x3E,
-    0x7D, 0x7C, 0x78, 0x70, 0x00, 0x05, 0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x3F, 0x07, 0xD0, 0x60, 0x00,
-    0x00, 0x0A, 0x43, 0xFC, 0x7F, 0xD3, 0xFC, 0x1A, 0x40, 0x05, 0x00, 0x10, 0x3F, 0xC2, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x19, 0x00, 0xA0, 0x01, 0x90, 0x1F, 0xF8, 0x3C, 0x7C, 0x7C, 0x3D,
-    0x3C, 0x3C, 0x2F, 0xF4, 0x06, 0x80, 0x05, 0x03, 0xFC, 0x2F, 0xD0, 0xFC, 0x1F, 0xC3, 0xF0, 0x24,
-    0x00, 0x1A, 0x07, 0xFD, 0x2F, 0xE0, 0x7E, 0x0F, 0xC7, 0xF4, 0x28, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x14, 0xBE, 0xBE, 0xBE,
-    0xBE, 0xBE, 0xBE, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
-    0x0F, 0xD2, 0xF8, 0x2F, 0x40, 0xBC, 0x19, 0x00, 0x24, 0x24, 0x00, 0x1B, 0xC0, 0x0F, 0xBF, 0xAB,
-    0xE3, 0xFF, 0xF8, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x00, 0x43, 0xFD, 0x1D, 0xBF, 0xFB, 0xEB,
-    0xDF, 0xFD, 0x74, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xD0, 0x02,
-    0xF9, 0x02, 0xFF, 0xFC, 0x7F, 0xBF, 0xEF, 0x40, 0x7F, 0x90, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xC2, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x1A,
-    0x00, 0xA0, 0xBC, 0x0B, 0xC0, 0xBD, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00,
-    0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF,
-    0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x6F, 0xF5, 0xBF, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x7F, 0xC0,
-    0x2F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xE0,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x1F, 0xF0, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0xFF,
-    0xC1, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x6F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x00, 0xBF, 0x01, 0xFF, 0x40, 0x2F, 0x80, 0x7F, 0xD0, 0x07, 0xE0,
-    0x1F, 0xF4, 0x01, 0xF0, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xBF,
-    0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xF4, 0x00, 0x00,
-    0x2F, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x03, 0xFE, 0x00, 0x00, 0xFD,
-    0x03, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xF4, 0x00,
-    0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x3F,
-    0xF0, 0x2F, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xEA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F,
-    0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40,
-    0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x2F, 0x80, 0x0B, 0xFE, 0x0B, 0xD0, 0x07, 0xFF, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x64, 0x1F,
-    0xFC, 0x00, 0x3F, 0x0F, 0xFC, 0x00, 0x1F, 0xCB, 0xFE, 0x00, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x86, 0xFF,
-    0x80, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00,
-    0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF,
-    0x40, 0x1F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFE, 0x55, 0x56, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xD0,
-    0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x1F,
-    0xF4, 0x00, 0x07, 0xFD, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC,
-    0x07, 0xFC, 0x00, 0x03, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x6A, 0xA4, 0x7F, 0xDB, 0xFC, 0x3F, 0xFE, 0x1F, 0xF7,
-    0xFF, 0x0F, 0xFF, 0x47, 0xFD, 0xFF, 0xC0, 0x55, 0x41, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0B, 0xFC, 0x07,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40,
-    0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01, 0xBF, 0xF9, 0x3F, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xDF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xF0, 0x6F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF,
-    0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x00, 0x07, 0xFC,
-    0xBF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC1,
-    0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x00,
-    0x3F, 0xFD, 0x01, 0xBF, 0xE4, 0x03, 0xFF, 0xD3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0xFF, 0x80, 0x00, 0x03, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40,
-    0x03, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0xC0, 0x1F, 0xF9, 0x00, 0x1F, 0xFF,
-    0x4B, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x02, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xEF, 0xF0, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x7F, 0xD0, 0x7E,
-    0xBF, 0x80, 0x00, 0xFD, 0x7F, 0x82, 0xF1, 0xFE, 0x00, 0x03, 0xF0, 0xFF, 0x0F, 0xC7, 0xFC, 0x00,
-    0x0F, 0xC3, 0xFC, 0x7E, 0x1F, 0xF0, 0x00, 0x3F, 0x0B, 0xF6, 0xF4, 0x3F, 0xC0, 0x01, 0xFC, 0x0F,
-    0xEF, 0xC0, 0xFF, 0x00, 0x07, 0xF0, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0xBF, 0xF4, 0x0F,
-    0xF4, 0x00, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x03, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x0F,
-    0xE0, 0x07, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xF0, 0x10,
-    0x03, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xE0, 0x01,
-    0xBF, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFF,
-    0xFE, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0x80, 0x02, 0xFD, 0xFF, 0xC0, 0x3F, 0x80,
-    0x02, 0xFC, 0xFF, 0xE0, 0x3F, 0x80, 0x02, 0xFC, 0x3F, 0xF4, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xFC,
-    0x3F, 0x80, 0x02, 0xFC, 0x0B, 0xFF, 0x3F, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x02, 0xFC,
-    0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
-    0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x03,
-    0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0x00, 0x00, 0x3F, 0x5F, 0x80, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x02, 0xF0, 0x64, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xA2, 0xF0, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00,
-    0x3F, 0xFC, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00,
-    0x2F, 0xF7, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00,
-    0xBF, 0xC7, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFC, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFA,
-    0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00,
-    0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4,
-    0x00, 0x0F, 0xF8, 0x01, 0xBF, 0xF8, 0x00, 0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x6F, 0xFA, 0xFF, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x7F,
-    0xC0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0,
-    0x7F, 0xD6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xA9, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x01, 0xBF, 0xE9, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xEA, 0xAB,
-    0xF8, 0x0F, 0xFD, 0x00, 0x1F, 0x80, 0x7F, 0xF0, 0x00, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0x40, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x07, 0xC0, 0x3F, 0xD0, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x1F, 0xC3, 0xFE, 0x00, 0x07, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0x80, 0xBE, 0x3F, 0x00, 0xFF, 0x80, 0xBE,
-    0x3F, 0x00, 0xFF, 0x80, 0xBD, 0x09, 0x00, 0xFF, 0x80, 0x64, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xFF, 0xE4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x64,
-    0x07, 0xFF, 0x00, 0x00, 0xFF, 0x8B, 0xFF, 0xE0, 0x00, 0xBF, 0xE1, 0xFF, 0xFC, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x43, 0xF4, 0x00, 0x00, 0x1F, 0xE2, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0xBF, 0xDF, 0xFF,
-    0x03, 0xFE, 0x07, 0xFC, 0x1F, 0xF8, 0xBF, 0xC0, 0x7F, 0xC0, 0xBF, 0xCF, 0xF8, 0x07, 0xFC, 0x03,
-    0xFD, 0xFF, 0x40, 0x7F, 0xC0, 0x3F, 0xDF, 0xF8, 0x07, 0xFC, 0x03, 0xFD, 0xBF, 0xC0, 0x7F, 0xC0,
-    0x7F, 0xC7, 0xFD, 0x07, 0xFC, 0x0F, 0xF8, 0x3F, 0xF8, 0x7F, 0xC7, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x07,
-    0xFF, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xDF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF4,
-    0x00, 0x2F, 0xE0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x40, 0x1F, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1F, 0xF0, 0x7F,
-    0xFF, 0xF0, 0x3F, 0xC3, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F, 0xF0, 0xBF, 0x80, 0x7F, 0xF0, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF,
-    0x80, 0x7F, 0xC0, 0x3F, 0xD0, 0x2F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x07, 0xF8, 0x02,
-    0xFE, 0x02, 0xFE, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0xFF, 0x00, 0x0F, 0xF8, 0x2F, 0xE0,
-    0xBF, 0x80, 0x01, 0xFF, 0xEF, 0xFE, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFE,
-    0x6F, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x02,
-    0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x2D, 0x1F, 0xE0, 0x02, 0xFD, 0x2E, 0x3E, 0x07, 0xF4, 0x0B, 0xF4,
-    0x3F, 0x3F, 0x01, 0xFC, 0x0F, 0xC0, 0x3F, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x19, 0x00, 0x15, 0x00, 0x0B, 0xFF,
-    0x83, 0xFC, 0x00, 0xFF, 0xFF, 0x9F, 0xE0, 0x0B, 0xFE, 0x7F, 0xBF, 0x40, 0x3F, 0xD0, 0x3F, 0xFD,
-    0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0xFF,
-    0x80, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F,
-    0xFF, 0x00, 0x7F, 0xE0, 0xBF, 0xFC, 0x00, 0xFF, 0xFF, 0xEF, 0xFE, 0x81, 0xFF, 0xFF, 0x2F, 0xFF,
-    0x01, 0xFF, 0xE0, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x14, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF9, 0x7F, 0xF0, 0x1F, 0xE0, 0x0F, 0xF8, 0x2F, 0xD0,
-    0x0B, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x3F, 0xC3, 0xFF, 0x80, 0x3F, 0xC7, 0xFF, 0xD0, 0x3F, 0xC3, 0xFF, 0xF4, 0x3F, 0xC0,
-    0x1F, 0xFC, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x02, 0xFE, 0x3F, 0xC0, 0x02, 0xFF, 0x3F, 0xC0,
-    0x02, 0xFE, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x0F, 0xFC, 0x3F, 0xEA, 0xBF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xC1, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x19, 0x0B, 0xFF, 0x00, 0x1F, 0xE7, 0xFF, 0xE0, 0x07, 0xFC, 0xAF,
-    0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x3F, 0xE0, 0x2F, 0xE0, 0x0B, 0xFC, 0x0F, 0xF4,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x3F, 0xE1, 0xFD, 0x00, 0x07, 0xFC, 0xBF, 0x00, 0x00, 0xFF, 0x3F,
-    0x80, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x29, 0x40, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xF9, 0x6F, 0xF4, 0x0F, 0xF0, 0x00, 0xB0, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF0, 0xBF, 0xF4, 0x3F, 0xD0, 0x2F, 0xF8, 0x7F, 0xC0, 0x0F, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC,
-    0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x07, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC, 0xBF, 0xD0, 0x0F, 0xF8,
-    0x7F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFE, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x16, 0x94, 0x00, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF4, 0xFF, 0x95,
-    0xBC, 0x7F, 0xC0, 0x01, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x14, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF,
-    0xE0, 0x0F, 0xFE, 0x60, 0x0B, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xAF, 0xFF,
-    0xBF, 0xE3, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x47, 0xF0, 0x16, 0xF5, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x1F, 0xFE, 0xFF, 0x40,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF9, 0x02, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x00, 0x16, 0xFF, 0x40, 0x00, 0x2F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x01, 0x64,
-    0x01, 0x90, 0x02, 0xFF, 0xC2, 0xFF, 0xE0, 0x3F, 0xFD, 0xFF, 0xFF, 0x81, 0xBF, 0xFF, 0xBF, 0xFC,
-    0x01, 0xFF, 0xD0, 0xBF, 0xC0, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF4,
-    0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xF9, 0xBF, 0xF0, 0x0B, 0xF4, 0x07, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x81,
-    0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x3F,
-    0xD3, 0xFF, 0xAA, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x8F, 0xF4, 0x00,
-    0x3F, 0xE3, 0xFD, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0xFF, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x2F, 0xD0, 0x2F, 0xF0, 0x0F, 0xF0, 0x03, 0xFF, 0xAF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x00, 0x05, 0x40, 0x2F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80,
-    0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xFE, 0x8B, 0xFF, 0xF0, 0xFF, 0xF4,
-    0x05, 0x40, 0x00, 0x05, 0x40, 0x01, 0x80, 0xBF, 0xC0, 0x1F, 0xF0, 0xFF, 0x80, 0xBF, 0xF4, 0xFF,
-    0x81, 0xFF, 0xF0, 0xFF, 0x87, 0xFE, 0x00, 0xFF, 0x8F, 0xE0, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xDB, 0xF0, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0xFF,
-    0x83, 0xFC, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0xFF, 0x82, 0xFF, 0xFC, 0xFF, 0x80, 0xFF, 0xFC, 0xFF,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xAF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xF6, 0xFF, 0x00, 0x00, 0x2F,
-    0xC7, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x07, 0xF8, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x7F,
-    0xC0, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF, 0xA4, 0x7F, 0xD0, 0x07, 0xFF, 0xE3,
-    0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x50, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x14, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC,
-    0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F,
-    0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03,
-    0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFB, 0xFE, 0x93, 0xFF, 0xFF, 0xCF, 0xFF,
-    0x4F, 0xFF, 0xFC, 0x1F, 0xF8, 0x3F, 0x85, 0x40, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x19, 0x0B, 0xFF, 0x00, 0x1F, 0xE7,
-    0xFF, 0xE0, 0x07, 0xFC, 0xAF, 0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x3F, 0xE0, 0x2F,
-    0xE0, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x2F, 0xE1, 0xFE, 0x00, 0x07, 0xFC,
-    0xBF, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x16, 0xD3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC,
-    0x06, 0xAF, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xEA,
-    0x00, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFF, 0xE9, 0x01, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFD, 0x00, 0x06,
-    0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9,
-    0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0,
-    0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7E, 0x1F, 0xC0, 0xFE, 0x00, 0x7C,
-    0x1F, 0xC0, 0xFD, 0x00, 0x14, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x3F,
-    0x81, 0xFC, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x7F, 0x81, 0xFC, 0x00, 0x00, 0xBF, 0x42,
-    0xFD, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0xFF,
-    0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x7F, 0xF8, 0x1F, 0xF4, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x07, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F,
-    0xE0, 0x07, 0xFD, 0x3F, 0xE0, 0x07, 0xFC, 0x3F, 0xE0, 0x0F, 0xFC, 0x3F, 0xE0, 0x1F, 0xF4, 0x3F,
-    0xFA, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xD1, 0x40, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x2F, 0xFF, 0x80, 0x7F, 0xFF,
-    0xF8, 0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x3F, 0xDF, 0xF0, 0x0F, 0xDB, 0xF8, 0x01, 0x43, 0xFE, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFA, 0x41, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x06, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xF0, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0F, 0xFC,
-    0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7E, 0x0F, 0xF0, 0x00,
-    0x7C, 0x0F, 0xF0, 0x00, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFE, 0xB4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x55, 0x00, 0x64, 0x02, 0xFF, 0xF0, 0x0F, 0xF0, 0x3F, 0xFF, 0x00, 0xFF, 0x41, 0xBF, 0xF0,
-    0x0B, 0xFC, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xD0,
-    0x3F, 0xE0, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x40, 0xFF, 0x40, 0x0F, 0xFE, 0xBF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x40, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFE, 0xBF, 0xEF, 0xFF, 0x03, 0xFF,
-    0x07, 0xF8, 0x3F, 0xF4, 0x7F, 0xC0, 0x7F, 0x80, 0xFF, 0xCB, 0xF8, 0x07, 0xF8, 0x0B, 0xFC, 0xFF,
-    0x80, 0x7F, 0x80, 0x7F, 0xCF, 0xF4, 0x07, 0xF8, 0x07, 0xFC, 0xFF, 0x80, 0x7F, 0x80, 0x7F, 0xCF,
-    0xFC, 0x07, 0xF8, 0x0B, 0xFC, 0xBF, 0xD0, 0x7F, 0x80, 0xFF, 0x83, 0xFF, 0x47, 0xF8, 0x3F, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x01, 0xFF, 0xD0, 0x0F, 0xF8,
-    0x3F, 0xFF, 0x01, 0xFF, 0x41, 0xBF, 0xF4, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC,
-    0xBF, 0x40, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xF6, 0xFE, 0x00, 0x00,
-    0xFF, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0xFF, 0x80, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF4, 0x1F, 0xF4, 0x02, 0xFF, 0xF3, 0xFF, 0x00, 0x0F, 0xFE, 0x0A, 0x80, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x55, 0x03,
-    0xFC, 0x06, 0x40, 0x2F, 0xFF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0xFE, 0x03, 0xFC, 0x0F, 0xF4, 0x1B,
-    0xFE, 0x03, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x07,
-    0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x03,
-    0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x02,
-    0xFF, 0x43, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0xD3, 0xFC, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x40, 0x00, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x14, 0x02,
-    0xFF, 0x1F, 0xF0, 0x2F, 0xD0, 0x7F, 0xCB, 0xF8, 0x0F, 0xF4, 0x0F, 0xF7, 0xFE, 0x02, 0xFC, 0x03,
-    0xFD, 0xFF, 0x40, 0xBF, 0x00, 0xFF, 0x7F, 0xD0, 0x1F, 0xC0, 0x2F, 0xDF, 0xF8, 0x0B, 0xF0, 0x0F,
-    0xF6, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0x81, 0xFF, 0x0F, 0xFD, 0xFF, 0xF9, 0xFF,
-    0x41, 0xFF, 0xFE, 0x3F, 0xFF, 0x80, 0x1F, 0xFE, 0x07, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xC0, 0x00, 0x00,
-    0x07, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x43, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x95, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x55, 0x57, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0B, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x90, 0x00, 0x7F, 0xF9, 0x2F, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5,
-    0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE,
-    0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xF2, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0x83, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFD, 0x55, 0x5F, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x40, 0x01, 0xFF, 0xE4, 0xBF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xF3, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x01, 0x90, 0xF8, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF,
-    0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x10, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x1B, 0x47, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF5,
-    0xFC, 0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x06, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-    0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80,
-    0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xBE, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1B, 0x42,
-    0x80, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x0B, 0xE0, 0x7E,
-    0x00, 0x06, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF,
-    0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x24, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBD, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55,
-    0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9,
-    0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x78, 0x3D,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1B, 0x47, 0x80, 0x00, 0x7F, 0xD2, 0x40,
-    0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x06, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0,
-    0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0xB4, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xD2, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xA0, 0x14, 0x00, 0x07,
-    0xFD, 0x2D, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x0B, 0x4B, 0xFC, 0x00, 0x02, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xF9, 0xFE, 0x00, 0x0B,
-    0xE0, 0x7F, 0x00, 0x06, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F,
-    0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF,
-    0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5,
-    0x55, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F,
-    0xE4, 0x00, 0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x07, 0xD0, 0x3E,
-    0x00, 0x02, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF,
-    0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x3C, 0x34, 0x34, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0,
-    0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x0B, 0x40, 0x0E, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0,
-    0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0,
-    0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x1C,
-    0x34, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
-    0x40, 0x0E, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x3C, 0x10, 0x00, 0x00, 0x00, 0xB4,
-    0x51, 0xD0, 0x00, 0x00, 0x02, 0xF9, 0x6F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0xBF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07,
-    0xFF, 0x92, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFA, 0xF8, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x04, 0x0A, 0x00, 0x0F, 0xC0,
-    0x2E, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5,
-    0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE,
-    0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xA0,
-    0x00, 0x00, 0x00, 0xFF, 0xFB, 0xC0, 0x00, 0x00, 0x03, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x01,
-    0xA0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x34, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF5, 0x55, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xF9, 0x00, 0x07, 0xFF, 0x92, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xFC, 0x2D,
-    0x00, 0x0B, 0xFF, 0x7E, 0x00, 0x0F, 0x8F, 0xFD, 0x00, 0x07, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x07, 0x00, 0x0F, 0xD0, 0x2F, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF, 0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF,
-    0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x38, 0x00, 0x00, 0x00, 0xFE, 0x57, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE5, 0x5F, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xD5, 0x55, 0xFF,
-    0xC0, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE4, 0x00,
-    0x1F, 0xFE, 0x4B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0E, 0x00, 0x0F,
-    0xE4, 0x7E, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xE5, 0xFF, 0x80, 0x3F, 0x80, 0xBF, 0xC0, 0x2F, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1A, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x7F, 0xC0, 0xBF,
-    0x80, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xEB, 0xFF, 0xE8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFE, 0x1F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0xFF, 0xFD,
-    0x07, 0xFD, 0x00, 0x2F, 0x41, 0xFF, 0x40, 0x07, 0xD0, 0x7F, 0xD0, 0x00, 0xE0, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFE, 0x55, 0x50, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x3D, 0x07, 0xFD, 0x00, 0x1F, 0x81, 0xFF, 0x40, 0x0F, 0xE1, 0xBF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x28, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0x1B, 0xFF, 0xFF, 0xFF, 0x41, 0xFF,
-    0x40, 0x0B, 0xD0, 0x7F, 0xD0, 0x01, 0xF4, 0x1F, 0xF4, 0x00, 0x38, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0x95, 0x54, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x0F, 0x41, 0xFF, 0x40, 0x07, 0xE0, 0x7F, 0xD0, 0x03, 0xF8, 0x6F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFE,
-    0xFC, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0xA0, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x90, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF,
-    0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xF0, 0x00, 0x1F,
-    0xFE, 0xBC, 0x00, 0x07, 0xEF, 0xFF, 0x00, 0x00, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41, 0xFF, 0x40,
-    0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD, 0x00, 0x3F,
-    0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xB8, 0x08,
-    0x00, 0x3F, 0xF1, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7C, 0x7F, 0xE0, 0x01, 0x41, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF8,
-    0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x47, 0xC0, 0x00, 0x0F, 0xFD, 0x20,
-    0x00, 0x02, 0xFB, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x0B, 0x40, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFD, 0x00, 0x2F, 0x40, 0x7F, 0xD0, 0x01, 0xF4, 0x07, 0xFD, 0x00, 0x0E, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x55, 0x50, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x07, 0xFD, 0x00, 0x1F, 0x80, 0x7F, 0xD0, 0x03, 0xF8, 0x1B,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0A, 0x83, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x02, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x1F, 0xF5, 0xBF,
-    0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x7F, 0x80, 0x2F, 0xE0, 0xBF, 0x80, 0x2F, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x95, 0x55, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFD, 0x1F, 0x00, 0x00,
-    0xFF, 0xD0, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x2D, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xD0, 0x02, 0xF4, 0x1F, 0xF4, 0x00, 0x7D, 0x07, 0xFD, 0x00, 0x0E, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0x55, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x03, 0xD0, 0x7F, 0xD0, 0x01, 0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x0A,
-    0x81, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x1F, 0xCF, 0xE0, 0x07, 0xF0, 0x3F, 0x00,
-    0x28, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xF8, 0x1F, 0xF5, 0xBF, 0xC3, 0xFC, 0x03, 0xFE, 0x7F, 0x80, 0x2F, 0xEB, 0xF8, 0x02, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0x95, 0x55, 0x4F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xFE, 0x00, 0x04, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7E, 0xF8, 0x00,
-    0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x2E, 0x00, 0x00, 0xFF, 0xD2, 0x40,
-    0x00, 0xBE, 0xFD, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x2D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xD0,
-    0x02, 0xF4, 0x1F, 0xF4, 0x00, 0x7D, 0x07, 0xFD, 0x00, 0x0E, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xE5, 0x55, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03,
-    0xD0, 0x7F, 0xD0, 0x01, 0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xBE, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x04, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0A,
-    0x83, 0xC0, 0x00, 0x3F, 0xF1, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x02, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x1F, 0xF5, 0xBF, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x7F, 0x80,
-    0x2F, 0xE0, 0xBF, 0x80, 0x2F, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x95,
-    0x55, 0x40, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x40, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0xF0, 0x00, 0x0F, 0xFF, 0xBD, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00,
-    0x50, 0x19, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xD0, 0x02, 0xF4, 0x1F, 0xF4,
-    0x00, 0x7D, 0x07, 0xFD, 0x00, 0x0E, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F,
-    0xFA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE5, 0x55, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x7F, 0xD0, 0x01,
-    0xF8, 0x1F, 0xF4, 0x00, 0xFE, 0x1B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xA4, 0x08, 0x00, 0x3F, 0xE1, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x78, 0x7F, 0xD0,
-    0x01, 0x40, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0x01, 0xFD,
-    0xFF, 0x00, 0x7F, 0x43, 0xF4, 0x02, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
-    0x1F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02,
-    0xFE, 0xBF, 0x80, 0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF,
-    0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x28, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xBF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF4, 0x00, 0xBD, 0x07, 0xFD, 0x00, 0x1F, 0x41,
-    0xFF, 0x40, 0x03, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0x55, 0x40, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xF4, 0x1F, 0xF4, 0x00, 0x7E, 0x07, 0xFD,
-    0x00, 0x3F, 0x86, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xEF, 0xC0, 0x01, 0xF8, 0x7E, 0x00, 0x3F,
-    0x02, 0xF0, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x1F, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0x81, 0xFF, 0x5B, 0xFC, 0x3F, 0xC0, 0x3F, 0xE7, 0xF8, 0x02, 0xFE, 0xBF, 0x80,
-    0x2F, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xF9, 0x55, 0x54, 0xFF, 0x40, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x43, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xF4, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xFC, 0x02,
-    0xFF, 0xFC, 0x0F, 0x83, 0xF0, 0x19, 0x0F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x78, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x1B, 0xFE, 0x00, 0x1F, 0xF4,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF,
-    0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F,
-    0xF4, 0x00, 0x7F, 0xD0, 0x06, 0xFF, 0xE4, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC0, 0x00, 0x54, 0x00,
-    0xBF, 0xF4, 0x1F, 0xEF, 0xC2, 0xF0, 0xBC, 0x0A, 0x0F, 0xC0, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x0F,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0xFF, 0xE0, 0x7F, 0xFE, 0x01, 0xBF, 0xE0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x7F, 0xF4, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x06, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F,
-    0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07,
-    0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x01,
-    0xBF, 0xF9, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x69, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xE0,
-    0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F,
-    0xFE, 0x07, 0xFF, 0xE0, 0x1B, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x43,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFD, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC,
-    0x07, 0xFD, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF7,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xBF, 0xC7,
-    0xFE, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x07,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07,
-    0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0x83, 0xF0, 0x00, 0x00,
-    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xEA, 0xFF, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x1F, 0xF4,
-    0x00, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xE0,
-    0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xEF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0xFE, 0xFE, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x60, 0x7E, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4,
-    0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD,
-    0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xD1, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x20, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x0B,
-    0xD1, 0xFC, 0x00, 0x00, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x00,
-    0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00,
-    0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x06, 0xC2, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0xFD, 0xBF, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4,
-    0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD,
-    0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0F, 0xD1, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x04, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x0B,
-    0xD1, 0xFC, 0x00, 0x00, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x00,
-    0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00,
-    0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x06, 0xC0, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0xFD, 0xBF, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4,
-    0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD,
-    0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0x40, 0x00, 0x00, 0x01, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0xD2, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x20, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x0B,
-    0xD1, 0xFC, 0x00, 0x00, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF, 0xD0,
-    0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x00,
-    0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00,
-    0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x78, 0x7D, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6C, 0x2E, 0x00, 0x00, 0xBF, 0xD2, 0x40, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x06, 0x40, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x1F,
-    0xF4, 0xFF, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x1F, 0xF0, 0xBF, 0xC0, 0x0B, 0xFC, 0x1F, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xEB, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x0F, 0x00, 0x00, 0x01, 0xFF, 0xEB, 0xC0, 0x00, 0x00, 0x7C, 0x7F, 0xE0,
-    0x00, 0x00, 0x05, 0x01, 0x90, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x09, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xF8,
-    0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x00, 0x2F, 0xF6,
-    0xFF, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xDF,
-    0xFC, 0x00, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x02, 0xFF, 0x0F, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x03, 0xC3, 0xFF, 0x00, 0x00, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x03, 0xF8, 0x1F, 0xC0, 0x02, 0x90, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xBF, 0xF4, 0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD,
-    0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x7E, 0x00, 0x00, 0x02, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0xBF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFE, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4,
-    0x3F, 0xE0, 0x0F, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0xBF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFD,
-    0xFF, 0x80, 0x03, 0xFD, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x7F, 0xF0, 0x0F, 0xF4, 0x3F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x90,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x6A, 0x90, 0x2F, 0xE0, 0x01, 0xFF,
-    0xFF, 0xE7, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xC0, 0x0B, 0xFD,
-    0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xBF,
-    0xC0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x4B,
-    0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0xFB, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x06, 0x90, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0x65, 0x1F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xBF,
-    0xC2, 0xFF, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0xFF, 0x4F, 0xFC, 0x00,
-    0x7F, 0xD3, 0xFF, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x0B, 0xFC, 0x1F, 0xFC, 0x03, 0xFD, 0x03, 0xFF,
-    0xEB, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x6A, 0x90,
-    0x2F, 0xE0, 0x01, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0xAF,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00,
-    0x07, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFB, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x06, 0x90, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0x65, 0x1F, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF9, 0xBF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF,
-    0x07, 0xFC, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x00,
-    0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x0B, 0xFC, 0x1F, 0xFC,
-    0x03, 0xFD, 0x03, 0xFF, 0xEB, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x40, 0x00, 0x00, 0x02, 0x83, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x1F, 0xC0, 0x00, 0x03, 0xC0, 0x01, 0xFF,
-    0x00, 0x00, 0x14, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0xA9, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x7F,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFF,
-    0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xD0, 0x00, 0x03,
-    0xFF, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4B, 0xFC, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xBF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x03, 0xD0, 0xF8, 0x00,
-    0x00, 0x60, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2D, 0x01,
-    0xA4, 0x00, 0x01, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x59, 0x47, 0xF0, 0x07, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFE, 0x6F, 0xFD, 0x03, 0xFE, 0x00, 0xFF, 0xC1, 0xFF,
-    0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x07, 0xFD, 0x3F, 0xF0, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x3F, 0xD3,
-    0xFF, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x07, 0xFC, 0x2F, 0xF0, 0x02, 0xFF, 0x07, 0xFF, 0x00, 0xFF,
-    0x40, 0xFF, 0xFA, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x83, 0x80, 0x00, 0x00, 0x1F, 0xFE,
-    0xFC, 0x00, 0x00, 0x02, 0xFB, 0xFF, 0xC0, 0x00, 0x00, 0x0E, 0x0F, 0xF4, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0xA9, 0x02, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFE, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4B,
-    0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x2F, 0xF4,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xBF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x05, 0x00, 0x00, 0xBF, 0xD3, 0xD0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F,
-    0x4F, 0xFC, 0x00, 0x00, 0x80, 0xB8, 0x69, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x16, 0x51, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x9B, 0xFF,
-    0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x7F, 0xC0, 0x0B, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0x4F, 0xFC, 0x00,
-    0x7F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0xC0, 0x07, 0xFD, 0x3F, 0xF0, 0x01, 0xFF, 0x0B, 0xFC,
-    0x00, 0xBF, 0xC1, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0xA9, 0x02, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFE, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x4B,
-    0xFC, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x2F, 0xF4,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xBF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x16, 0x51, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x9B, 0xFF,
-    0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x7F, 0xC0, 0x0B, 0xFC, 0x2F, 0xF0, 0x01, 0xFF, 0x4F, 0xFC, 0x00,
-    0x7F, 0xD3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0xC0, 0x07, 0xFD, 0x3F, 0xF0, 0x01, 0xFF, 0x0B, 0xFC,
-    0x00, 0xBF, 0xC1, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x46, 0xFF, 0xD0, 0x01, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F,
-    0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xA0,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFD, 0x1B, 0xFF, 0x40, 0x05, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0xBF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x00, 0x0A, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x0B, 0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0x40, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE4, 0x01, 0xBD, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFC, 0x0B, 0xFF, 0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80,
-    0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F,
-    0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x60, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x01, 0xA4, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFC, 0x0B, 0xFF,
-    0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xBD, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xAF, 0x80, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x19, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xA4, 0x00, 0x00,
-    0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x2F, 0xFC, 0x0B,
-    0xFF, 0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80, 0x6F, 0xFC, 0x06, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0x40, 0x00, 0x00,
-    0x03, 0xEB, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xC2, 0xFE, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x10, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0,
-    0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x1A, 0x41, 0x80, 0x00,
-    0x00, 0x7F, 0xE2, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xB8, 0xBF, 0xD0, 0x00, 0x00,
-    0x20, 0x1A, 0x41, 0xA4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x2F, 0xFC, 0x0B, 0xFF, 0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80, 0x6F, 0xFC, 0x06,
-    0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xF0, 0x2F, 0xFF, 0xE0, 0x1B, 0xFF, 0x40, 0x05, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x2F, 0xFC, 0x0B, 0xFF, 0xF4, 0xBF, 0xFC, 0x1F, 0xFF, 0x80, 0x6F, 0xFC, 0x06, 0xFF, 0x40,
-    0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFC, 0x7F, 0xF8, 0x00, 0x05, 0x40, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xF4, 0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF,
-    0x81, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0x9F, 0xFF, 0xF0, 0x3F,
-    0xFD, 0x0F, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x07, 0xF0, 0x00,
-    0x7F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xFF, 0x0B, 0xF0, 0x00, 0x03, 0xFC,
-    0x3F, 0x40, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x6A, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB, 0xFF, 0xFE, 0x0B, 0xFF, 0xF4,
-    0x7F, 0xFD, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00,
-    0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0xFD, 0x00, 0x00,
-    0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x47, 0xFF, 0xE7, 0xFF, 0xFC, 0x0F,
-    0xFF, 0x43, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xFC, 0x01, 0xFC, 0x00,
-    0x1F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0x40, 0x00, 0x7F, 0xC2, 0xFC, 0x00, 0x00, 0xFF,
-    0x0F, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x64, 0x00, 0x01, 0xFF, 0x0B, 0xF8, 0x1A, 0xBF, 0xF4,
-    0x3F, 0xF0, 0xBF, 0xFF, 0x80, 0xFF, 0x81, 0xFF, 0xF4, 0x00, 0xF8, 0x02, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0xFF, 0xFA, 0xFF, 0xFF, 0x82, 0xFF, 0xFD,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0xFF, 0x9F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0x83,
-    0xF0, 0x00, 0x00, 0x19, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x7F, 0xFE, 0x7F, 0xFF, 0xC0, 0xFF, 0xF4, 0x3F, 0xF8, 0x00,
-    0xFF, 0x00, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x01, 0xFF, 0x40, 0xFF, 0x00,
-    0x03, 0xFE, 0x03, 0xF4, 0x00, 0x07, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x00, 0x2F,
-    0xE7, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xAB, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x0E, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0xBE, 0xFF, 0xF0,
-    0x00, 0x00, 0x0E, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xBF, 0xFF, 0xAF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xD1, 0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xF4, 0x00,
-    0x00, 0x0F, 0xF9, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
-    0x1A, 0x40, 0x80, 0x00, 0x01, 0xFF, 0x8B, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x2F,
-    0xF4, 0x00, 0x00, 0x20, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD1, 0xFF, 0xF9, 0xFF, 0xFF, 0x03, 0xFF, 0xD0, 0xFF,
-    0xE0, 0x03, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFD, 0x03,
-    0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x00,
-    0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x06, 0xAF, 0xFD, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x5A, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F, 0x40, 0xF0,
-    0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB, 0xAA, 0xBD,
-    0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0,
-    0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x01, 0x52, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F,
-    0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07,
-    0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0,
-    0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF,
-    0x07, 0xF2, 0xFC, 0x1F, 0xCB, 0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF2, 0xFC, 0x1F, 0xCB,
-    0xF0, 0x7F, 0x2F, 0xC1, 0xFC, 0xBF, 0x07, 0xF1, 0xA8, 0x0A, 0x80, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x7F,
-    0x0F, 0xE0, 0xFF, 0x0F, 0xF4, 0x7F, 0x81, 0x40, 0x01, 0x40, 0x7F, 0x41, 0xFF, 0x03, 0xFC, 0x0B,
-    0xF0, 0x2F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x00, 0x10, 0x00, 0x06, 0x80, 0xBF, 0x80, 0xFF, 0x02,
-    0xFC, 0x0B, 0xF0, 0x2F, 0x40, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x04, 0x07, 0xF4, 0xFF,
-    0x8F, 0xF0, 0xFF, 0x07, 0xF0, 0x3F, 0x02, 0xF8, 0x0F, 0xC0, 0x14, 0x01, 0x00, 0x10, 0x0F, 0xC0,
-    0xFC, 0x2F, 0x82, 0xF4, 0x3F, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0xFE, 0x0F, 0xE0, 0xFF, 0x0F, 0xF0,
-    0xFF, 0x4F, 0xF4, 0x7F, 0x8B, 0xF4, 0x14, 0x01, 0x40, 0x01, 0x40, 0x10, 0x1F, 0xD2, 0xFD, 0x1F,
-    0xF2, 0xFE, 0x0F, 0xF0, 0xFF, 0x0B, 0xF0, 0xFE, 0x0B, 0xE0, 0xFD, 0x0F, 0xC0, 0xFC, 0x1F, 0x82,
-    0xF4, 0x3F, 0x03, 0xE0, 0x04, 0x01, 0x40, 0x06, 0x80, 0x78, 0x2F, 0xE3, 0xFD, 0x0F, 0xF1, 0xFF,
-    0x0B, 0xF0, 0xFF, 0x0B, 0xF0, 0xFE, 0x0B, 0xD0, 0xFD, 0x0F, 0xC1, 0xFC, 0x2F, 0x42, 0xF4, 0x3E,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x01, 0x40, 0x7F, 0x4B, 0xF4, 0xFF, 0x8F, 0xF4, 0xFF, 0x0F,
-    0xF0, 0xFF, 0x0F, 0xE0, 0x7F, 0x0B, 0xE0, 0x3F, 0x07, 0xF0, 0x2F, 0x83, 0xF4, 0x0F, 0xC0, 0xFC,
-    0x01, 0x40, 0x10, 0x00, 0x05, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x02, 0x91, 0xF8, 0x6C, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F,
-    0x9F, 0x9B, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0x90, 0xF8, 0x6C, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFE, 0x3E, 0x5F, 0x9B, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x4F, 0x9A, 0xD3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xD2, 0x90, 0xF8, 0x6C, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0A, 0x80, 0xFF, 0xCB, 0xFF, 0x7F, 0xFE, 0xBF, 0xF4,
-    0xFF, 0x80, 0x54, 0x00, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFE, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x7F, 0xE7, 0xFF, 0x3F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xCF, 0xFC, 0x2F, 0xF7,
-    0xFF, 0x0B, 0xFD, 0xBF, 0xC1, 0xFF, 0x05, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40, 0x3F,
-    0xF0, 0x07, 0xFE, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x45, 0x40, 0x00, 0x54, 0x00, 0x05, 0x00,
-    0x01, 0x03, 0xFD, 0x7F, 0xF7, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D,
-    0x00, 0x00, 0x34, 0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00,
-    0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30,
-    0xA0, 0xC0, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00,
-    0x74, 0xE0, 0x00, 0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70,
-    0xD0, 0xD1, 0xC3, 0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xC7, 0x40, 0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C,
-    0x34, 0x07, 0x07, 0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x3F, 0x0B, 0xD0, 0x7F, 0x90, 0x00, 0x6F, 0x90, 0x0F, 0xE6, 0xFC, 0x3F,
-    0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x1F, 0xFF, 0xC2, 0xF0, 0xBF, 0x6F, 0xC0, 0x7F, 0x6F, 0xD0,
-    0x0B, 0xF4, 0x1F, 0x83, 0xF0, 0x3F, 0x83, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0xBE,
-    0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0xBE, 0x01, 0xFC, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0x02, 0xF8, 0x07, 0xF1, 0xFC, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x87, 0xF0, 0x1F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0xBD, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x43,
-    0xF0, 0x3F, 0x43, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0x3F,
-    0x40, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x15, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x02,
-    0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xF4, 0x02, 0xFC, 0x0F, 0xD0, 0x3F, 0xC2, 0xFD, 0x07,
-    0xF8, 0x3F, 0xC0, 0xFF, 0x0B, 0xF8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC, 0x1F, 0xC0, 0x3F, 0x02, 0xF4,
-    0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-    0x40, 0x78, 0x02, 0xFC, 0x0F, 0xD0, 0xFE, 0x03, 0xFC, 0x2F, 0xD1, 0xFE, 0x07, 0xF8, 0x3F, 0xC3,
-    0xFD, 0x0F, 0xF0, 0xBF, 0x87, 0xFC, 0x1F, 0xE0, 0xFF, 0x0B, 0xF0, 0x3F, 0xC1, 0xFC, 0x0F, 0xE0,
-    0x3F, 0x02, 0xF4, 0x1F, 0xC0, 0x2D, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x3F, 0xD0, 0x1F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8, 0x00,
-    0xFC, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x78, 0x0F, 0xF0, 0xBF, 0x03, 0xFC,
-    0x2F, 0xE0, 0xBF, 0x83, 0xFC, 0x0F, 0xF0, 0xBF, 0x41, 0xFE, 0x0F, 0xF0, 0x2F, 0xC1, 0xFD, 0x03,
-    0xF4, 0x2F, 0x80, 0x38, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x07,
-    0x80, 0x7C, 0x0F, 0xF0, 0xBF, 0x03, 0xF4, 0x3F, 0xC2, 0xFE, 0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x3F,
-    0xD0, 0xFF, 0x0B, 0xF4, 0x7F, 0xC1, 0xFE, 0x0F, 0xF0, 0xBF, 0x02, 0xFC, 0x1F, 0xD0, 0xFE, 0x03,
-    0xF4, 0x2F, 0x81, 0xFC, 0x03, 0x80, 0x3C, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xEF, 0x80, 0x1F, 0xC2, 0xF8, 0x0F, 0xC0,
-    0x2F, 0x80, 0x00, 0x0E, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x2F, 0xD0, 0x3F, 0xE0, 0x0F, 0xF0, 0x03,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x38, 0x00, 0xBF,
-    0x40, 0x2F, 0xD0, 0x0F, 0xF8, 0x03, 0xFE, 0x01, 0xFF, 0x03, 0xFE, 0x0B, 0xF8, 0x2F, 0xD0, 0x7F,
-    0x40, 0x7C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8B, 0xC0, 0x0A, 0x00, 0x3E, 0x3F, 0x02,
-    0xF8, 0x0F, 0xC0, 0xF8, 0x2F, 0x82, 0xF0, 0x03, 0xE0, 0xF0, 0xBD, 0x00, 0x1F, 0x80, 0x2F, 0x40,
-    0x00, 0x7E, 0x07, 0xD0, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x1F, 0x0B, 0xFE, 0x0F, 0x43, 0xF8, 0x2F,
-    0x82, 0xFC, 0x2F, 0x43, 0xFC, 0x1F, 0xC0, 0x50, 0xFA, 0xF0, 0x50, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x50, 0xFC, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x2F, 0x02, 0xFC,
-    0x0F, 0x8B, 0xD0, 0x1F, 0x40, 0x3E, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x1A, 0x8B, 0xF8, 0x03, 0xFC, 0xFF, 0x80, 0x7F, 0xCF, 0xF4, 0x0B, 0xFC, 0xFF, 0x40, 0xBF,
-    0x8F, 0xF0, 0x0B, 0xF8, 0xFF, 0x00, 0xBF, 0x8F, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0x7F, 0x4F, 0xF0,
-    0x07, 0xF4, 0xBF, 0x00, 0x7F, 0x4B, 0xF0, 0x03, 0xF4, 0x7F, 0x00, 0x3F, 0x47, 0xF0, 0x03, 0xF4,
-    0x3F, 0x00, 0x3F, 0x43, 0xF0, 0x02, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x1F, 0x8B, 0xFC, 0x03, 0xFE, 0xBF, 0xC0, 0x7F, 0xE7, 0xFC, 0x03, 0xFD, 0x15, 0x00, 0x05, 0x00,
-    0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA9, 0x00,
-    0x02, 0xFF, 0xEF, 0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x01,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x2F,
-    0xEF, 0xF8, 0x0F, 0xFB, 0xFE, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x01,
-    0xBF, 0x80, 0x00, 0x6F, 0xE0, 0x1B, 0xFF, 0xD0, 0x06, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x07, 0xFF,
-    0xF4, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4, 0x00,
-    0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x07, 0xFF, 0x40, 0x00, 0xBF,
-    0x83, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0xFF, 0xC0, 0x0F, 0xF4, 0x2F, 0xEF, 0xF8, 0x03, 0xFD,
-    0x01, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x01, 0xBF, 0x80, 0xFF, 0x00, 0x1B, 0xFF, 0xD0, 0x3F, 0xC0,
-    0x1F, 0xFF, 0xE0, 0x0B, 0xF0, 0x07, 0xFF, 0xD0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x07,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x05, 0x00, 0x00, 0x05, 0x40, 0x1A,
-    0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0xD0, 0x0F, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xD0, 0x3F,
-    0xFF, 0xF0, 0xFF, 0x40, 0xBF, 0xBF, 0xF3, 0xFC, 0x00, 0x40, 0x1F, 0xDF, 0xF0, 0x00, 0x00, 0x1F,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFB, 0xF0,
-    0x00, 0x6F, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xF8, 0x7F, 0x00, 0x1F, 0xFF, 0x41, 0xFC, 0x00, 0x3F,
-    0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAA, 0x40, 0x01, 0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02,
-    0xFF, 0xFE, 0x0E, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x3D, 0x01, 0xE0, 0x0E, 0x00, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0xBF, 0x00,
-    0xFF, 0x0B, 0xF4, 0x7F, 0x83, 0xFC, 0x07, 0xF8, 0x3F, 0xC3, 0xFD, 0x1F, 0xE0, 0x3F, 0xC2, 0xFE,
-    0x1F, 0xF0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0xBF, 0x07, 0xF8, 0x0F, 0xF0, 0x7F, 0x03, 0xF8, 0x3F,
-    0xC0, 0x3F, 0x02, 0xF4, 0x1F, 0xC0, 0xFC, 0x00, 0xB4, 0x07, 0x80, 0x3C, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xBF, 0xD0,
-    0xBF, 0x03, 0xFC, 0x3F, 0x80, 0x7F, 0x0F, 0xD0, 0x1F, 0xD7, 0xF0, 0x03, 0xF5, 0xFC, 0x01, 0xFD,
-    0x7F, 0x40, 0x7F, 0x0F, 0xD0, 0x2F, 0xC3, 0xFC, 0x1F, 0xD0, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0xFB, 0xF0, 0x00, 0xFC, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x7D, 0x0F, 0xC0, 0x3F, 0x57,
-    0xF5, 0x0F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xA8, 0x00, 0x06, 0xAA, 0x90, 0x2F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0xF8, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xFE,
-    0x0F, 0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0xD0, 0x3F,
-    0xF5, 0x03, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x1F, 0xC1, 0xFE, 0xBF,
-    0x02, 0xF9, 0xFC, 0x0B, 0xF3, 0xF4, 0x3F, 0x8B, 0xFF, 0xFC, 0x0B, 0xFF, 0xC0, 0x06, 0xA4, 0x00,
-    0x1A, 0xAA, 0x90, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0x80, 0xFC, 0x3C, 0x0B, 0xD0, 0x00, 0x7E,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82, 0xF8, 0x7F, 0x0F,
-    0xC0, 0xFC, 0x3F, 0x43, 0xF0, 0x7F, 0xBF, 0x40, 0x7F, 0xF4, 0x07, 0xFF, 0xF8, 0x3F, 0x0B, 0xF6,
-    0xF8, 0x0B, 0xEB, 0xE0, 0x3F, 0x5F, 0xE6, 0xFC, 0x2F, 0xFF, 0xC0, 0x06, 0x94, 0x00, 0x02, 0xFD,
-    0x00, 0x7F, 0xFF, 0x03, 0xFE, 0xFF, 0x1F, 0xC0, 0xFD, 0xBF, 0x03, 0xF9, 0xFC, 0x0B, 0xE3, 0xF9,
-    0x7F, 0x87, 0xFF, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x0B, 0xFC, 0x0A, 0xFF, 0xC0, 0x3F,
-    0xF8, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x3F,
-    0x47, 0xE0, 0x0F, 0x80, 0xFC, 0x03, 0xE0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x3E, 0x03, 0xF0, 0x1F,
-    0xC0, 0xFD, 0x2F, 0xF8, 0xFF, 0xC5, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0xBF, 0xFF, 0xC0, 0x7F, 0x9B, 0xF8, 0x3F, 0xC0, 0xBF, 0x0F, 0xD0, 0x1F, 0xC7, 0xF0, 0x07, 0xF5,
-    0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x7F, 0x0F, 0xD0, 0x1F, 0xC3, 0xF8, 0x0F, 0xE0, 0xBF, 0x9F, 0xF0,
-    0x0F, 0xFF, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F,
-    0xFE, 0x03, 0xFF, 0xE0, 0x05, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
-    0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xF4, 0x2F, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x10, 0x00,
-    0x1F, 0xFE, 0x02, 0xFF, 0xFF, 0x1F, 0xE6, 0xFC, 0x7F, 0x07, 0xF4, 0xA4, 0x1F, 0xC0, 0x00, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x00, 0x10, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xFE, 0x1F, 0x82, 0xFC, 0x28,
-    0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xF4, 0x02, 0x5F, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x05, 0x6F, 0xF8, 0x7F, 0xFF, 0x80, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x7D,
-    0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF4, 0x15, 0x5F, 0xD4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xC0, 0xFE, 0xA9, 0x03, 0xF0, 0x00, 0x0F, 0xE4, 0x00, 0x3F, 0xFE, 0x00,
-    0xAF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC1, 0x57, 0xFD, 0x0F, 0xFF, 0xE0,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0x41, 0xFF,
-    0x40, 0x1F, 0xE0, 0x00, 0xFF, 0xA4, 0x03, 0xFF, 0xFD, 0x1F, 0xEB, 0xFD, 0xBF, 0x03, 0xFA, 0xFC,
-    0x0B, 0xF7, 0xF0, 0x2F, 0x8F, 0xF5, 0xFD, 0x1F, 0xFF, 0xE0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xE3, 0xFA, 0xBF, 0x4F, 0x41, 0xF8, 0x2C, 0x0F, 0xC0, 0x00, 0xBD,
-    0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1F, 0xFE, 0x01, 0xFE, 0xFF, 0x0F,
-    0xC0, 0xFC, 0x3F, 0x03, 0xF0, 0xFF, 0x1F, 0x80, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x2F, 0xEF, 0xF1,
-    0xFC, 0x0F, 0xDB, 0xE0, 0x2F, 0xAF, 0xC0, 0xFD, 0x3F, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xFD, 0x0F, 0xD2, 0xFC, 0x7F, 0x03, 0xF6, 0xFC,
-    0x0F, 0xE7, 0xF0, 0x2F, 0x8F, 0xFA, 0xFD, 0x0F, 0xFF, 0xF4, 0x01, 0x7F, 0xC0, 0x02, 0xFD, 0x00,
-    0x7F, 0xE0, 0x7F, 0xFE, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0x03, 0xFE, 0x00, 0x3F, 0x03,
-    0xFE, 0x00, 0x2E, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xAB, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x17, 0xFE, 0x50, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x0B, 0xF4,
-    0x2F, 0xD0, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x05, 0xBF, 0xD6, 0xA0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0A, 0xFF, 0xEA, 0x90, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x14, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFB, 0xFF, 0xFF, 0x40, 0x64, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xEB, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x03, 0xFD, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xF8, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF,
-    0x40, 0xFE, 0x54, 0x00, 0x6A, 0x40, 0x0B, 0xFC, 0x0B, 0xFC, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xC0,
-    0x2F, 0xF5, 0xFF, 0xD2, 0xFF, 0xFF, 0xD2, 0xFE, 0x7F, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0x80,
-    0x0F, 0xD0, 0x7C, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x90, 0x0B, 0xFD, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xFC,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x0F, 0xD0, 0x7F, 0xFA,
-    0x40, 0x00, 0x1F, 0xF9, 0xA3, 0xE0, 0x3F, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xCF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xF4, 0x0B, 0xE0, 0x07, 0xFC, 0x00, 0xBD,
-    0x00, 0xFF, 0x00, 0x0B, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x17, 0xFE, 0xAA, 0x80, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2B, 0xFE, 0xAA, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x17, 0xFD, 0x54, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x05, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xD5,
-    0x6A, 0xAA, 0xA0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xDF, 0xEF, 0xCB, 0xE3,
-    0xF3, 0xF8, 0xF0, 0xFC, 0x3C, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0xAA, 0xAA, 0xAA, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2A, 0xAA, 0xA5, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x10, 0x3C, 0x3F, 0x0F, 0x2F, 0xCF, 0xCF, 0xE3, 0xFB, 0xFB, 0xF0,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x2F, 0x80, 0xBF, 0xAA, 0xAA, 0xBF, 0x8B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x00,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFD, 0x1F, 0xDF, 0xDF, 0xC3, 0xE3, 0xF2, 0xE0, 0x20, 0xFC, 0x20, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x3F, 0x08, 0x0F, 0x8F, 0xCB,
-    0xC3, 0xF7, 0xF7, 0xF0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xEF, 0xEF, 0xC0, 0x3F, 0x3F, 0x3F, 0x00, 0x30, 0xFC, 0x30, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x70, 0xFC, 0x34, 0x07, 0xF3, 0xF3,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00,
-    0x15, 0x5B, 0x95, 0x50, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x90, 0xBE, 0x00, 0xBD, 0x2F, 0x80, 0xBF, 0x4B, 0xE0,
-    0xBF, 0x02, 0xF4, 0xBF, 0x00, 0xBD, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4,
-    0x3F, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x40, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x18, 0x00, 0xBE, 0x1F, 0x80, 0x2F, 0x87, 0xF8,
-    0x0B, 0xE0, 0x3F, 0x81, 0xF8, 0x03, 0xF8, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF0,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x40, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0xBF,
-    0x55, 0x55, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFD, 0x55, 0x55, 0x50,
-    0x2F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x55, 0xAA, 0xA4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x55, 0x5A, 0xA9, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF8,
-    0xBE, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0x03, 0xFB, 0xE2, 0xFB, 0xF0, 0xB8,
-    0xF8, 0xBC, 0xB8, 0x04, 0x3E, 0x2F, 0x04, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x6A, 0xA9, 0x55, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x1A, 0xA9, 0x55, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00,
-    0x02, 0x0F, 0x8B, 0xC2, 0x03, 0xE3, 0xE2, 0xF2, 0xF0, 0xFE, 0xF8, 0xBE, 0xFC, 0x0B, 0xFE, 0x2F,
-    0xF8, 0x00, 0xBF, 0x8B, 0xF8, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00,
-    0x02, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x2F, 0x80,
-    0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x7F, 0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00,
-    0x00, 0xFD, 0x00, 0x7F, 0xEA, 0xAA, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF5, 0x5F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0x01,
-    0xFC, 0x00, 0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x2F,
-    0x80, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xE0, 0x02, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xAF, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xF8, 0x3F,
-    0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x0B, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x40, 0x3F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x50, 0x00, 0x3F, 0xD7, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x03, 0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA,
-    0xAF, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF8, 0x02, 0xFE,
-    0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x2F, 0x7F, 0xD0, 0x7F, 0xC0, 0x02, 0xF4, 0xBF, 0x81,
-    0xFE, 0x00, 0x2F, 0x41, 0xFE, 0x0B, 0xF4, 0x02, 0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x2F, 0x80, 0x1F,
-    0xE0, 0xBF, 0x41, 0xF8, 0x00, 0xBF, 0x41, 0xFE, 0x1F, 0x80, 0x03, 0xFC, 0x07, 0xFD, 0xF8, 0x00,
-    0x0F, 0xF0, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xFE, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC,
-    0x2F, 0xFF, 0xF8, 0x00, 0x02, 0xC0, 0x05, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xCF, 0xF4, 0x00, 0x00, 0x2F, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x03,
-    0xFE, 0x00, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0xFF,
-    0x80, 0x03, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x1F, 0xD0, 0x00, 0x3F, 0xF0, 0x2F, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xEA, 0xAA, 0xAF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0x41, 0xFF, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0,
-    0x7F, 0x00, 0x00, 0xFF, 0x83, 0xF8, 0x00, 0x02, 0xFF, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0xBE, 0x00,
-    0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x94, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xEA, 0xAA, 0xAA, 0xAA, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xF9, 0x47, 0xF4, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00,
-    0x0B, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xAA, 0xAF, 0xFA, 0xA8,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xFE, 0xAA, 0xA0,
-    0xFF, 0x40, 0x7F, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE,
-    0xAA, 0xAA, 0xAA, 0xA0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x05, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0xBF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x05, 0x55, 0x55, 0x6F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x5B, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0xAA, 0xBF, 0xEA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xAA, 0xAF, 0xEA, 0xAF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x02,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x80, 0x55, 0x55, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x06, 0xFF, 0xFA, 0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01,
-    0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03,
-    0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40,
-    0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF1,
-    0xAA, 0xAA, 0x41, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xFC,
-    0x00, 0x0F, 0x80, 0x2F, 0xF8, 0x00, 0x2D, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0A,
-    0x00, 0xBF, 0x80, 0x00, 0x7D, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x1F, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x16, 0xAA, 0xAA,
-    0xAA, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x02, 0xD1, 0xF4, 0x78, 0x3F, 0xDF, 0x7F, 0xC2,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x47, 0xFE, 0xFB,
-    0xFD, 0x3F, 0x1F, 0x4F, 0xC0, 0x41, 0xF4, 0x10, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0x82, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00,
-    0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0xD7, 0xF8, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x54, 0x00,
-    0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x05, 0x54, 0x00,
-    0x2F, 0x80, 0x7F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x03, 0xF0, 0x02, 0xBF, 0xC0, 0x1F, 0x80,
-    0x00, 0x7F, 0x40, 0xBD, 0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x0B,
-    0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0x7D,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x10, 0xBF, 0xD0, 0x1F, 0x3F, 0xFF, 0x4B, 0xF7, 0xFA, 0xFE, 0xFD, 0xBD, 0x07, 0xFE, 0x0F,
-    0xC0, 0x2F, 0xC0, 0xFC, 0x03, 0xFD, 0x0B, 0xE0, 0xBF, 0xF4, 0x7F, 0xFF, 0x5F, 0xE3, 0xFF, 0xD0,
-    0xBF, 0x0B, 0xE4, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F,
-    0xF4, 0x2F, 0xFF, 0x0B, 0xFF, 0xC3, 0xFA, 0xFE, 0xFE, 0xFD, 0xBD, 0x07, 0xFD, 0x07, 0xEB, 0xC0,
-    0x2F, 0xC0, 0x3E, 0xBD, 0x03, 0xFC, 0x03, 0xEB, 0xE0, 0xFF, 0xF0, 0xBE, 0x7F, 0xFF, 0x5F, 0xFF,
-    0xC2, 0xFF, 0xD0, 0xBF, 0xF8, 0x0B, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xAA, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0xAA, 0xAA, 0xAA, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2,
-    0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC,
-    0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x1A, 0x80, 0x15, 0x01, 0x52,
-    0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF,
-    0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B,
-    0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0,
-    0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF,
-    0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xCF, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF4, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A,
-    0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x3F,
-    0xD0, 0x02, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0xFD,
-    0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00,
-    0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00,
-    0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF,
-    0xC0, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0xBF,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x07, 0xFD, 0xBE, 0x00, 0x0F, 0xF4, 0x38, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1C, 0x1F, 0xF0, 0x00, 0xBE, 0x2F,
-    0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F,
-    0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x14,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00,
-    0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0x80, 0xFF, 0xC3, 0xFF, 0x0F,
-    0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x3F,
-    0xF0, 0xFF, 0xC3, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB,
-    0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00,
-    0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0x40, 0x01, 0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF,
-    0xFE, 0x0E, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x03, 0xC3, 0xFF, 0xFF, 0x47, 0xFA, 0xFE, 0xBF, 0xFF, 0xFC, 0xBC, 0x00, 0xBF, 0xFC, 0x04,
-    0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x6F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB, 0xFF,
-    0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x40, 0x0B, 0xD0, 0x01, 0x50, 0x00, 0x41, 0xFF, 0xC0, 0x2E, 0x7F,
-    0xFF, 0x87, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x94, 0x00, 0x5B, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x5A,
-    0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xEA, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0x90, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x15, 0x7F, 0x55, 0x47,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x7F, 0x55, 0x54, 0x07, 0xD0, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFD, 0x04, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xBF,
-    0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD,
-    0x00, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x2E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40,
-    0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x07,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x01, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFD,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFF,
-    0x40, 0x2F, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xD0, 0x00,
-    0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x06, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00,
-    0x00, 0xFF, 0x40, 0x7F, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x9F, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0x55, 0x55, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x15, 0x55, 0x5F, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x6F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x40,
-    0x00, 0x0F, 0xE0, 0x2F, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00,
-    0x0F, 0xD0, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x7F, 0x95, 0x40, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFD, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA,
-    0xAA, 0xA4, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFC, 0x6A, 0xAA, 0xAA, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0xB8, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x2E, 0x01, 0xFC, 0x07, 0xD0, 0x0B, 0x80, 0x1F, 0x43, 0xE0, 0x02, 0xE0, 0x02,
-    0xF1, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x2E, 0x00, 0x0F, 0xBE, 0x00, 0x0B, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x0B,
-    0xEE, 0x00, 0x0B, 0x80, 0x02, 0xE7, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0xF8, 0x00, 0xB8, 0x00, 0xBC,
-    0x2F, 0x00, 0x2E, 0x00, 0x3E, 0x03, 0xF0, 0x0B, 0x80, 0x3F, 0x00, 0x3F, 0x82, 0xE0, 0xBF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x43,
-    0xE0, 0x00, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xBE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xEE, 0x00, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x07, 0xFE,
-    0x00, 0x02, 0xFF, 0x43, 0xEB, 0xE0, 0x02, 0xFA, 0xF1, 0xF0, 0xBE, 0x02, 0xF8, 0x3D, 0xB8, 0x0B,
-    0xE2, 0xF8, 0x0F, 0xBE, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02,
-    0xFD, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xD0, 0x0B, 0xEE, 0x02, 0xF8, 0xBD, 0x02, 0xE7, 0xC2, 0xF8,
-    0x0B, 0xE0, 0xF4, 0xFA, 0xF8, 0x00, 0xBE, 0xBC, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x03, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x02, 0xFC, 0x07, 0xD0, 0x00, 0x02, 0xFF, 0x43, 0xE0, 0x00, 0x02, 0xFA, 0xF1, 0xF0, 0x00, 0x02,
-    0xF8, 0x3D, 0xBC, 0x00, 0x02, 0xF8, 0x0F, 0xBE, 0x00, 0x02, 0xF8, 0x02, 0xFF, 0x40, 0x02, 0xF8,
-    0x00, 0x7F, 0xD0, 0x02, 0xF8, 0x00, 0x1F, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xEE, 0x02, 0xF8, 0x00,
-    0x03, 0xE7, 0xC2, 0xF8, 0x00, 0x00, 0xF4, 0xFA, 0xF8, 0x00, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x00,
-    0x3E, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x1A, 0xAA, 0xFE, 0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x05,
-    0x00, 0x00, 0x40, 0x00, 0x04, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xDB, 0xFD, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFA, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFE, 0x7F, 0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE,
-    0x40, 0x0F, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00,
+static const uint8_t bookerly_14_boldBitmaps[41110] = {
+    0x09, 0xAA, 0x90, 0xAE, 0xA0, 0xFA, 0x0F, 0x90, 0xF9, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1A, 0xE1,
+    0xAE, 0x19, 0xE1, 0x9E, 0x2E, 0x2E, 0x29, 0x72, 0xAD, 0x90, 0xAF, 0x0A, 0xF0, 0x9F, 0x19, 0x99,
+    0x10, 0x0A, 0xD9, 0x1A, 0xCA, 0x9E, 0x90, 0xFA, 0xE1, 0xEA, 0xAE, 0x1E, 0xAA, 0xE1, 0xEA, 0xAE,
+    0x1E, 0xAA, 0xE1, 0xE9, 0x9E, 0x1E, 0x99, 0xDA, 0x1E, 0x90, 0x93, 0x99, 0x10, 0x59, 0x99, 0x39,
+    0x99, 0x7E, 0x91, 0x9D, 0xA7, 0xE2, 0xAD, 0x96, 0x9E, 0x2E, 0x7A, 0xDA, 0x2E, 0x4F, 0xFF, 0xF0,
+    0x9F, 0xFF, 0xEA, 0x19, 0x9A, 0xE9, 0x99, 0xE9, 0x99, 0x4A, 0xDA, 0x2E, 0x7E, 0x91, 0x9D, 0xA7,
+    0xE2, 0xAD, 0x94, 0xAA, 0xAE, 0xAA, 0xAE, 0xAA, 0xA9, 0x0A, 0xFF, 0xFE, 0x1A, 0xFF, 0xFD, 0xA4,
+    0xE2, 0xAD, 0x96, 0x9E, 0x2E, 0x7A, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x77, 0x70, 0x77, 0x49,
+    0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x1A, 0xFD, 0xA4, 0x9F, 0xFD, 0x29, 0xEA, 0xEA, 0xF1,
+    0xEA, 0x0A, 0xCA, 0x0A, 0xE1, 0xE9, 0x0A, 0xCA, 0x1D, 0xA1, 0xE9, 0x0A, 0xCA, 0x19, 0x92, 0xF9,
+    0xDA, 0x6A, 0xFD, 0x97, 0xFF, 0x96, 0xAF, 0xF7, 0xAF, 0xE7, 0xFE, 0xA1, 0x9A, 0x2D, 0x99, 0xF0,
+    0x9D, 0x2D, 0x1A, 0xE0, 0xE9, 0x1D, 0x1A, 0xE0, 0xF1, 0xD1, 0xEA, 0x0A, 0xFA, 0xDA, 0xF2, 0xFF,
+    0xE4, 0x9F, 0xEA, 0x70, 0xAD, 0x73, 0x9D, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x99, 0x96,
+    0x77, 0x75, 0x99, 0x97, 0x1A, 0xC9, 0x79, 0xFC, 0xA6, 0x9E, 0x69, 0xFE, 0xA5, 0xE9, 0x6E, 0x90,
+    0x9E, 0x93, 0x9E, 0x69, 0xE2, 0xEA, 0x3E, 0x96, 0xAD, 0xA2, 0xAD, 0xA2, 0x9D, 0xA7, 0xAD, 0xA2,
+    0xAE, 0x2E, 0x70, 0xEA, 0x2A, 0xDA, 0x1A, 0xDA, 0x70, 0xAD, 0xA2, 0xAD, 0xA1, 0xE7, 0x19, 0xE2,
+    0xE1, 0xAD, 0x91, 0x9E, 0xA9, 0x2E, 0xA9, 0xAE, 0x1E, 0x1F, 0xE9, 0x19, 0xFE, 0x1A, 0xD1, 0xAE,
+    0x9A, 0xE3, 0xAE, 0x91, 0x9D, 0xA1, 0xE2, 0xEA, 0x71, 0xE1, 0x9E, 0x2A, 0xDA, 0x70, 0x9D, 0xA1,
+    0xAD, 0xA2, 0x9E, 0x70, 0xE2, 0xAD, 0xA2, 0x9E, 0x7A, 0xDA, 0x2A, 0xDA, 0x2A, 0xDA, 0x7E, 0x3A,
+    0xE2, 0xAD, 0x96, 0xE9, 0x4E, 0x91, 0xE6, 0x9E, 0x5A, 0xFE, 0x96, 0xE9, 0x6A, 0xFC, 0x97, 0x9D,
+    0x71, 0x99, 0x97, 0x77, 0x50, 0x77, 0x75, 0xAF, 0xC9, 0x76, 0xFF, 0x97, 0x4F, 0xA9, 0xF7, 0x39,
+    0xE9, 0x2E, 0x73, 0xAE, 0x3E, 0x73, 0xAE, 0x29, 0xE7, 0x3A, 0xE2, 0xE9, 0x73, 0xAE, 0x90, 0xAD,
+    0x97, 0x5F, 0x09, 0xC9, 0x75, 0xAF, 0x4A, 0xAA, 0xAA, 0xA9, 0x4F, 0xE2, 0xAF, 0xE3, 0xFF, 0xA1,
+    0x9F, 0xE2, 0x9E, 0xA0, 0xF9, 0x2A, 0xDA, 0x4F, 0x19, 0xF9, 0x19, 0xDA, 0x4F, 0x2A, 0xF9, 0x0A,
+    0xDA, 0x4F, 0x3A, 0xFA, 0xAD, 0x94, 0xF4, 0xAF, 0xE5, 0xAF, 0x4A, 0xFD, 0x95, 0xFC, 0xA9, 0x99,
+    0xAF, 0xFA, 0x92, 0x9F, 0xFF, 0xFE, 0xA3, 0xAF, 0xFA, 0x99, 0xAF, 0xC7, 0x99, 0x99, 0x95, 0x99,
+    0x91, 0x0A, 0xD9, 0x9E, 0x9A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0x9E, 0x09, 0xDA, 0x19,
+    0x20, 0x77, 0xAC, 0x6F, 0x4A, 0xE9, 0x39, 0xEA, 0x4F, 0x4A, 0xE5, 0xEA, 0x4A, 0xE5, 0xF5, 0xE9,
+    0x49, 0xE9, 0x4A, 0xE5, 0xAE, 0x5F, 0x5F, 0x5A, 0xE5, 0xAE, 0x59, 0xE9, 0x5E, 0xA5, 0xF5, 0xAE,
+    0x95, 0xF5, 0xAE, 0x95, 0xF5, 0x9F, 0x5A, 0xEA, 0x5A, 0xE6, 0x9C, 0x10, 0x72, 0x9C, 0xA6, 0xEA,
+    0x5A, 0xEA, 0x5A, 0xEA, 0x5F, 0x6E, 0xA5, 0xAE, 0x6E, 0xA5, 0xF5, 0xAE, 0x94, 0x9E, 0x95, 0xEA,
+    0x5E, 0xA5, 0xF5, 0xEA, 0x5E, 0xA5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xE9, 0x4A, 0xE4, 0x9E,
+    0x94, 0xF4, 0xAE, 0x93, 0xAE, 0xA4, 0xAD, 0xA6, 0xAA, 0x50, 0x74, 0x91, 0xAD, 0x92, 0x9C, 0x90,
+    0xAD, 0x92, 0xE9, 0xDA, 0x3A, 0xFC, 0x9A, 0xA9, 0x29, 0xFD, 0xA0, 0x9A, 0xFA, 0xD9, 0x0E, 0xAD,
+    0x90, 0x91, 0xAC, 0xA0, 0xE4, 0x91, 0xE7, 0x99, 0x30, 0x77, 0x2A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A,
+    0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x49, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0xAA, 0xAA, 0xFA, 0xAA,
+    0xA5, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0x9A, 0xA9, 0x40, 0x71, 0x9E,
+    0x92, 0x9F, 0x3F, 0x3F, 0x3E, 0x92, 0xAE, 0x3E, 0x92, 0xAD, 0xA3, 0xDA, 0x73, 0x70, 0xAF, 0xFF,
+    0xFF, 0xFC, 0xA7, 0x00, 0x6A, 0xE0, 0x9F, 0xA9, 0xFC, 0x0F, 0x91, 0x99, 0x10, 0x71, 0xAE, 0x72,
+    0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x2E, 0xA7, 0x1A, 0xE7, 0x2E, 0xA7, 0x1A,
+    0xE9, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0xAE, 0x72,
+    0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x72, 0x99, 0x97, 0x20, 0x77, 0x7A, 0xFC,
+    0xA7, 0x09, 0xFF, 0xC9, 0x5A, 0xFF, 0xE4, 0x9F, 0xA1, 0xAF, 0xC3, 0xFA, 0x3A, 0xF9, 0x2F, 0x5F,
+    0xA1, 0xAF, 0x5F, 0xC1, 0xFA, 0x5A, 0xF1, 0xFA, 0x59, 0xF1, 0xFA, 0x59, 0xF1, 0xF9, 0x59, 0xF1,
+    0xFA, 0x5A, 0xF1, 0xFA, 0x5A, 0xF1, 0xFA, 0x5F, 0xA1, 0xAF, 0x5F, 0x91, 0x9F, 0x93, 0x9F, 0x3F,
+    0xC2, 0x9F, 0xA3, 0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xEA, 0x73, 0x99, 0x97, 0x77, 0x4A, 0xC9,
+    0x79, 0xFC, 0x4A, 0xFF, 0x4F, 0xFC, 0x4A, 0xFF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x59, 0xAF, 0xFA, 0x1A, 0xFF, 0xE1, 0xAF, 0xFE, 0x00, 0x77, 0x39, 0xFD, 0x95, 0x9F, 0xFD, 0x39,
+    0xFF, 0xF2, 0xFC, 0x2F, 0xC9, 0x1F, 0x39, 0xFA, 0x1F, 0x4F, 0xA1, 0xAD, 0xA4, 0xF9, 0x71, 0xAF,
+    0x72, 0xFA, 0x71, 0xFC, 0x71, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF,
+    0x71, 0xAF, 0x71, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x0A,
+    0xFF, 0xFA, 0x00, 0x77, 0x2A, 0xFD, 0xA4, 0xAF, 0xFD, 0x2A, 0xFF, 0xEA, 0x1F, 0x92, 0xAF, 0x1A,
+    0xD9, 0x4F, 0x2A, 0xA5, 0xF7, 0x1A, 0xEA, 0x70, 0xAF, 0x69, 0xAF, 0xA5, 0x9F, 0xFA, 0x5F, 0xFD,
+    0x4A, 0xA9, 0x99, 0xAF, 0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x1F, 0xA7, 0x0A, 0xF9, 0x69, 0xFD, 0x1A,
+    0xAA, 0xAF, 0xF2, 0xFF, 0xDA, 0x4F, 0xEA, 0x96, 0x99, 0x99, 0x70, 0x77, 0x72, 0x9A, 0xE7, 0x4F,
+    0xC7, 0x3F, 0xD7, 0x2A, 0xFD, 0x71, 0x9F, 0xE7, 0x1F, 0xF7, 0x0A, 0xE9, 0xF7, 0x9E, 0x90, 0xF7,
+    0xEA, 0x1F, 0x6F, 0x2F, 0x5A, 0xE3, 0xF4, 0x9E, 0x93, 0xF4, 0xFA, 0xAA, 0xAA, 0xFA, 0xAA, 0x1F,
+    0xFF, 0xF9, 0x0F, 0xFF, 0xF9, 0x1A, 0xAA, 0xAA, 0xAA, 0xFC, 0xAA, 0xA9, 0x71, 0xF7, 0x5F, 0x75,
+    0xF7, 0x5F, 0x75, 0x99, 0x99, 0x30, 0x2A, 0xFF, 0xD9, 0x2F, 0xFE, 0x92, 0xFF, 0xE3, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x3F, 0x71, 0x9E, 0xA7, 0x19, 0xF9, 0x70, 0x9F, 0xEA, 0x5A, 0xFF, 0xC9, 0x3A, 0xFF,
+    0xD9, 0x69, 0xAF, 0xD7, 0x1F, 0xC7, 0x19, 0xF9, 0x70, 0x9F, 0x97, 0x0A, 0xF7, 0x1F, 0xC7, 0xAF,
+    0xC9, 0x1A, 0xAA, 0xAF, 0xEA, 0x2F, 0xFD, 0x93, 0x9F, 0xEA, 0x79, 0x99, 0x97, 0x77, 0x79, 0xFC,
+    0x96, 0x9F, 0xF5, 0xFF, 0xA9, 0x4F, 0xD9, 0x7A, 0xFA, 0x70, 0x9F, 0xA7, 0x1F, 0xA7, 0x19, 0xFA,
+    0xAA, 0xA9, 0x5F, 0xFE, 0xA3, 0xFF, 0xFC, 0x2F, 0x91, 0x9F, 0xCA, 0x09, 0xF4, 0xFC, 0x09, 0xF4,
+    0x9F, 0x09, 0xF9, 0x4F, 0x90, 0xF9, 0x4F, 0x1F, 0xC3, 0x9F, 0x19, 0xFA, 0x2F, 0xA2, 0xFF, 0xF4,
+    0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x19, 0x99, 0x95, 0x9F, 0xFE, 0xAA, 0x0A, 0xFF, 0xFC, 0x9F, 0xFF,
+    0xDA, 0xFA, 0xAA, 0xAA, 0xAF, 0x0E, 0x94, 0xAE, 0x90, 0xE4, 0x9F, 0x19, 0xCA, 0x4F, 0x71, 0xAE,
+    0x97, 0x09, 0xF7, 0x1F, 0x97, 0x0A, 0xF7, 0x1F, 0x97, 0x0A, 0xF7, 0x1F, 0x97, 0x09, 0xF7, 0x1F,
+    0xC7, 0x1F, 0x97, 0x09, 0xF7, 0x2F, 0x72, 0xF7, 0x39, 0x99, 0x70, 0x77, 0x4A, 0xFC, 0xA6, 0xAF,
+    0xFC, 0x93, 0xAF, 0xCA, 0xFC, 0x3F, 0x92, 0xFA, 0x19, 0xEA, 0x39, 0xF1, 0x9E, 0xA3, 0x9E, 0xA1,
+    0x9F, 0x3F, 0x92, 0xFC, 0x90, 0xAE, 0xA4, 0xFF, 0xCA, 0x6F, 0xF6, 0x9F, 0xFC, 0x4A, 0xEA, 0x9A,
+    0xFC, 0x91, 0x9E, 0xA2, 0x9F, 0xC1, 0xF4, 0xAF, 0x1F, 0x5F, 0x99, 0xF5, 0xF1, 0xFA, 0x3A, 0xF1,
+    0xFD, 0xAA, 0xFC, 0x92, 0xFF, 0xE9, 0x4A, 0xFE, 0xA7, 0x19, 0x99, 0x95, 0x77, 0x39, 0xAF, 0xA9,
+    0x6F, 0xFC, 0xA4, 0xFF, 0xEA, 0x2A, 0xF9, 0x09, 0xFC, 0x91, 0xFA, 0x3F, 0xC1, 0xF9, 0x3A, 0xF1,
+    0xF4, 0x9F, 0x90, 0xF9, 0x4F, 0x90, 0xFA, 0x4F, 0x90, 0xAF, 0xA3, 0xF9, 0x1F, 0xFF, 0xC3, 0xFF,
+    0xF4, 0x9A, 0xFF, 0xA7, 0x19, 0xF7, 0x19, 0xFA, 0x70, 0x9F, 0xC7, 0x0A, 0xFC, 0x94, 0x9A, 0xFE,
+    0x94, 0xFF, 0xC6, 0x9F, 0xD9, 0x71, 0x99, 0x97, 0x10, 0x6A, 0xE0, 0x9F, 0xA9, 0xFC, 0x0F, 0x91,
+    0x99, 0x77, 0x77, 0x6A, 0xE0, 0x9F, 0xA9, 0xFC, 0x0F, 0x91, 0x99, 0x10, 0x71, 0x9E, 0x92, 0xFC,
+    0x2F, 0xC2, 0xFA, 0x39, 0x99, 0x77, 0x77, 0x77, 0x39, 0xE9, 0x2A, 0xF3, 0xF3, 0xEA, 0x29, 0xE9,
+    0x2A, 0xE3, 0xE3, 0xE9, 0x3D, 0x97, 0x30, 0x77, 0x7A, 0xCA, 0x70, 0xAF, 0x6A, 0xFC, 0x94, 0xAF,
+    0xA9, 0x4A, 0xFA, 0x59, 0xFA, 0x79, 0xFA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xCA,
+    0x70, 0x9F, 0xC7, 0x19, 0xDA, 0x73, 0xA1, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x9F, 0xFF, 0x97, 0x77,
+    0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0x76, 0x9C, 0xA7, 0x2F, 0xA7, 0x0A, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7, 0x0A, 0xFC,
+    0x97, 0x0A, 0xFC, 0x71, 0xF9, 0x6A, 0xFA, 0x49, 0xAF, 0xA4, 0x9F, 0xCA, 0x5F, 0xCA, 0x7A, 0xDA,
+    0x72, 0xA7, 0x20, 0x74, 0x9F, 0xC9, 0x4F, 0xF3, 0xFF, 0xC2, 0xAE, 0xAF, 0xA2, 0x93, 0x9E, 0x70,
+    0xAD, 0xA7, 0x0D, 0xA7, 0x9E, 0x59, 0xAE, 0xA2, 0x9A, 0xFD, 0x91, 0x9F, 0xEA, 0x29, 0xFD, 0x93,
+    0x9E, 0xA7, 0xDA, 0x70, 0xDA, 0x77, 0x77, 0x09, 0xDA, 0x69, 0xF9, 0x59, 0xFA, 0x6F, 0x70, 0x99,
+    0x50, 0x77, 0x77, 0x49, 0xAF, 0xDA, 0x97, 0x59, 0xFF, 0xFC, 0x97, 0x2F, 0xFF, 0xFC, 0x79, 0xFC,
+    0xA9, 0x49, 0xAF, 0xC6, 0xFA, 0x72, 0xAE, 0xA4, 0xF9, 0x74, 0xAE, 0x3A, 0xE9, 0x39, 0xAE, 0x94,
+    0xEA, 0x2E, 0xA2, 0x9F, 0xEA, 0x3A, 0xE1, 0xAE, 0x3E, 0x99, 0xF3, 0x9E, 0x1E, 0xA2, 0x9D, 0x92,
+    0xE4, 0xE9, 0x0E, 0x93, 0xAA, 0x3E, 0x93, 0xE9, 0x9E, 0x97, 0x99, 0xE9, 0x3E, 0x9A, 0xE5, 0x9F,
+    0xE9, 0x3E, 0x0A, 0xE4, 0xFA, 0xAE, 0x92, 0x9E, 0x0A, 0xE3, 0x9E, 0x2E, 0x92, 0xEA, 0x0A, 0xE3,
+    0xAE, 0x2E, 0x91, 0xAE, 0x19, 0xE9, 0x2A, 0xFA, 0xFF, 0xD9, 0x2E, 0xA3, 0xFD, 0x9F, 0xE9, 0x3F,
+    0x4E, 0xA1, 0x9A, 0xDA, 0x95, 0x9F, 0x77, 0x6F, 0xA7, 0x76, 0xFC, 0x73, 0xAC, 0x79, 0xFD, 0xA9,
+    0x39, 0xAF, 0x71, 0xAF, 0xFF, 0xE9, 0x72, 0x9A, 0xFF, 0xEA, 0x77, 0x9A, 0xAA, 0xAA, 0xA9, 0x97,
+    0x00, 0x72, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE,
+    0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29,
+    0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF,
+    0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA,
+    0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x39, 0x99,
+    0x99, 0x99, 0x5F, 0xFF, 0xC9, 0x2F, 0xFF, 0xD9, 0x29, 0xAF, 0x99, 0xAF, 0xC3, 0x9F, 0x3F, 0x92,
+    0x9F, 0x3A, 0xEA, 0x29, 0xF3, 0xAE, 0x92, 0x9F, 0x3A, 0xE3, 0x9F, 0x3F, 0x39, 0xFF, 0xE4, 0x9F,
+    0xFE, 0xA3, 0x9F, 0xFF, 0xA2, 0x9F, 0x3F, 0xC9, 0x19, 0xF4, 0xFA, 0x19, 0xF4, 0xAF, 0x19, 0xF4,
+    0xAE, 0xA1, 0x9F, 0x4F, 0xA1, 0x9F, 0x3F, 0xC1, 0x9A, 0xFF, 0xFA, 0x0F, 0xFF, 0xD9, 0x1F, 0xFF,
+    0x97, 0x74, 0x79, 0xAA, 0xAA, 0x97, 0x9F, 0xFD, 0x4F, 0xFF, 0x92, 0xFD, 0xAA, 0xAF, 0x91, 0xAF,
+    0x94, 0xE9, 0x09, 0xF9, 0x5E, 0x90, 0xFC, 0x6A, 0xD1, 0xF9, 0x79, 0x19, 0xF7, 0x3A, 0xF7, 0x3A,
+    0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7, 0x29, 0xFC, 0x97, 0x2F, 0xD9, 0x71,
+    0x9F, 0xEA, 0x99, 0x9A, 0xAD, 0x1A, 0xFF, 0xFD, 0x2A, 0xFF, 0xF9, 0x4A, 0xFF, 0xC9, 0x70, 0x99,
+    0x99, 0x93, 0x39, 0x99, 0x99, 0x99, 0x97, 0x0F, 0xFF, 0xDA, 0x5F, 0xFF, 0xFA, 0x49, 0xAF, 0xA9,
+    0xAA, 0xFE, 0x49, 0xF9, 0x3A, 0xFC, 0xA3, 0x9F, 0x94, 0x9F, 0xC9, 0x29, 0xF9, 0x5A, 0xFA, 0x29,
+    0xF9, 0x6F, 0xC2, 0x9F, 0x96, 0xFC, 0x29, 0xF9, 0x6A, 0xF9, 0x19, 0xF9, 0x6A, 0xF9, 0x19, 0xF9,
+    0x6A, 0xF2, 0x9F, 0x96, 0xAF, 0x29, 0xF9, 0x6F, 0xC2, 0x9F, 0x96, 0xFA, 0x29, 0xF9, 0x5A, 0xF3,
+    0x9F, 0x94, 0x9F, 0xA3, 0x9F, 0x92, 0x9A, 0xFA, 0x39, 0xAF, 0xFF, 0xCA, 0x3F, 0xFF, 0xE9, 0x4F,
+    0xFF, 0xA7, 0x77, 0x40, 0x77, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A, 0xFF, 0xFC, 0x91, 0x9F,
+    0x94, 0xAD, 0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29,
+    0xFA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9, 0x99, 0x99, 0x94, 0x9F,
+    0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A,
+    0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xFE, 0x0F, 0xFF, 0xE1, 0x9A, 0xFF,
+    0xF2, 0x9F, 0x93, 0xE2, 0x9F, 0x93, 0xAD, 0x29, 0xF9, 0x39, 0xCA, 0x29, 0xF9, 0x71, 0x9F, 0x97,
+    0x19, 0xF9, 0x39, 0x49, 0xFF, 0xE3, 0x9F, 0xFE, 0x39, 0xFF, 0xD9, 0x39, 0xF9, 0x71, 0x9F, 0x97,
+    0x19, 0xF9, 0x71, 0x9F, 0x97, 0x19, 0xF9, 0x70, 0x9A, 0xFC, 0xA9, 0x5F, 0xFD, 0x5F, 0xFD, 0x50,
+    0x79, 0xAA, 0xAA, 0xA9, 0x97, 0x1A, 0xFF, 0xDA, 0x5A, 0xFF, 0xFC, 0x4A, 0xFD, 0xAA, 0xAA, 0xF3,
+    0xAF, 0xA5, 0xAE, 0x29, 0xFA, 0x69, 0xE2, 0xAF, 0x70, 0xD9, 0x2F, 0x97, 0x09, 0x39, 0xF7, 0x6A,
+    0xF7, 0x6A, 0xF7, 0x6F, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC5, 0xFF, 0x0A, 0xF9, 0x4A, 0xFE,
+    0x0A, 0xFA, 0x7F, 0xA0, 0x9F, 0xC7, 0xFA, 0x1F, 0xD6, 0xFA, 0x19, 0xFD, 0x94, 0xFA, 0x2A, 0xFF,
+    0xFE, 0xA3, 0xAF, 0xFF, 0xD9, 0x5A, 0xFF, 0xD9, 0x72, 0x99, 0x99, 0x96, 0x77, 0x6F, 0xFD, 0x2F,
+    0xFF, 0xFE, 0xA2, 0xFF, 0xCA, 0x09, 0xAF, 0xA5, 0x9F, 0xCA, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9,
+    0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x39, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFF, 0xC9, 0x39, 0xFA, 0x99,
+    0x99, 0x99, 0x9A, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9,
+    0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x29, 0xAF, 0xCA, 0x49, 0xFD, 0xA0, 0xFF, 0xD2,
+    0xFF, 0xFF, 0xF2, 0xFF, 0xD0, 0x72, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF, 0xD0,
+    0x77, 0x0F, 0xFD, 0x29, 0xFF, 0xD3, 0x9A, 0xFC, 0xA9, 0x69, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0xAF, 0x7A, 0xFA,
+    0x59, 0xFD, 0x6F, 0xD7, 0x9E, 0x97, 0x77, 0x4F, 0xFC, 0xA1, 0xFF, 0x9F, 0xFC, 0x91, 0xFF, 0x19,
+    0xAF, 0x94, 0xFC, 0x49, 0xF4, 0xAF, 0x59, 0xF3, 0xAE, 0xA6, 0x9F, 0x2A, 0xEA, 0x79, 0xF1, 0xAE,
+    0xA7, 0x09, 0xF0, 0xAE, 0xA7, 0x19, 0xFF, 0x97, 0x29, 0xFF, 0xA7, 0x29, 0xFF, 0xC9, 0x71, 0x9F,
+    0x9F, 0xC9, 0x70, 0x9F, 0x09, 0xFC, 0x70, 0x9F, 0x19, 0xFC, 0x79, 0xF2, 0xAF, 0xC6, 0x9F, 0x3F,
+    0xD5, 0x9F, 0x4F, 0xD9, 0x29, 0xAF, 0xA9, 0x3F, 0xD9, 0x0F, 0xFD, 0x29, 0xFD, 0xAF, 0xFC, 0xA4,
+    0xFC, 0x97, 0x79, 0x99, 0x10, 0x77, 0x0F, 0xFD, 0x6F, 0xFC, 0xA7, 0x9A, 0xFA, 0x72, 0x9F, 0x97,
+    0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29,
+    0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xAC, 0x29, 0xF9, 0x5D, 0xA1, 0x9F, 0x94,
+    0xAD, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x77, 0x74,
+    0x9F, 0xEA, 0x5A, 0xFE, 0x92, 0x9F, 0xF5, 0xFF, 0x94, 0xAF, 0xD5, 0xFD, 0xA6, 0x9F, 0xD9, 0x3A,
+    0xFD, 0x96, 0xAF, 0xDA, 0x3F, 0xE9, 0x6A, 0xDA, 0xF3, 0xEA, 0xEA, 0x6E, 0x9F, 0x91, 0x9D, 0xAA,
+    0xEA, 0x6E, 0x99, 0xEA, 0x1A, 0xD0, 0x9E, 0xA6, 0xE1, 0xF1, 0xE0, 0x9F, 0x6E, 0x1F, 0x09, 0xDA,
+    0x09, 0xF6, 0xE1, 0xAE, 0x9A, 0xD9, 0x1F, 0x59, 0xE2, 0xEA, 0xE2, 0xF5, 0x9E, 0x2F, 0xDA, 0x2F,
+    0x5A, 0xE2, 0xAF, 0xC9, 0x2F, 0x94, 0xAE, 0x3F, 0xC3, 0xF9, 0x4E, 0xA3, 0xFA, 0x3F, 0x94, 0xEA,
+    0x39, 0xE9, 0x3F, 0xA3, 0x9F, 0x93, 0xE3, 0x9F, 0xCA, 0x1F, 0xF2, 0x94, 0xFF, 0xC9, 0xFF, 0x70,
+    0xFF, 0xC0, 0x77, 0x70, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF, 0xDA, 0x49, 0xAF, 0x94,
+    0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5, 0xEA, 0x5A, 0xFE, 0xA4, 0xEA, 0x5A, 0xFF, 0x93, 0xEA, 0x5A,
+    0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F, 0xCA, 0x2E, 0xA5, 0xAE, 0x1F, 0xC9, 0x1E, 0xA5, 0xAE, 0x19,
+    0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC, 0x0E, 0xA5, 0xAE, 0x3F, 0xC9, 0xEA, 0x5A, 0xE3, 0x9F, 0xFA,
+    0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49, 0xFA, 0x94, 0xAF, 0xCA,
+    0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0xA7, 0x72, 0x99, 0x94, 0x79, 0xAA, 0xAA, 0x97, 0x39,
+    0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96,
+    0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF,
+    0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F,
+    0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA,
+    0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x39, 0x99, 0x99, 0x99,
+    0x94, 0xFF, 0xFC, 0xA2, 0xFF, 0xFE, 0x29, 0xAF, 0xAA, 0xFE, 0x29, 0xF3, 0xFC, 0x29, 0xF3, 0x9F,
+    0x91, 0x9F, 0x4F, 0x91, 0x9F, 0x4F, 0x91, 0x9F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0x99, 0xAF,
+    0xC3, 0x9F, 0xFE, 0x93, 0x9F, 0xFC, 0xA5, 0x9F, 0xAA, 0xA9, 0x79, 0xF7, 0x39, 0xF7, 0x39, 0xF7,
+    0x39, 0xF7, 0x29, 0xAF, 0xAA, 0x96, 0xFF, 0xD6, 0xFF, 0xD6, 0x79, 0xAA, 0xAA, 0x97, 0x49, 0xFF,
+    0xCA, 0x71, 0xAF, 0xFF, 0x96, 0xFD, 0xAA, 0xAF, 0xD9, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC,
+    0xA2, 0xFC, 0x79, 0xFC, 0x2F, 0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9,
+    0x0A, 0xF7, 0x1A, 0xF9, 0x0F, 0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF,
+    0x1A, 0xFA, 0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFD, 0x4F, 0xC5, 0xAF,
+    0xFF, 0xD9, 0x6A, 0xFF, 0xF9, 0x71, 0xAF, 0xF9, 0x75, 0x9F, 0x97, 0x70, 0x9F, 0xA9, 0x77, 0x0F,
+    0xDA, 0x99, 0x97, 0x4A, 0xFF, 0xCA, 0x73, 0x9F, 0xF9, 0x75, 0x9A, 0xFC, 0x77, 0x60, 0x39, 0x99,
+    0x99, 0x99, 0x97, 0x0F, 0xFF, 0xCA, 0x6F, 0xFF, 0xE6, 0x9A, 0xFA, 0xAA, 0xFD, 0x69, 0xF3, 0xFC,
+    0x95, 0x9F, 0x4F, 0xA5, 0x9F, 0x4F, 0xA5, 0x9F, 0x4F, 0x95, 0x9F, 0x39, 0xF6, 0x9F, 0x2A, 0xFA,
+    0x69, 0xFA, 0xFD, 0xA7, 0x9F, 0xFD, 0x97, 0x09, 0xFF, 0xC9, 0x71, 0x9F, 0x0A, 0xF7, 0x19, 0xF1,
+    0xFC, 0x70, 0x9F, 0x2F, 0xC7, 0x9F, 0x2A, 0xFA, 0x69, 0xF3, 0xAF, 0xC4, 0x9A, 0xFA, 0x92, 0xFD,
+    0x91, 0xFF, 0xCA, 0x2F, 0xDA, 0x0F, 0xFC, 0xA3, 0xAF, 0x97, 0x70, 0x99, 0x91, 0x49, 0xAA, 0xAA,
+    0xA9, 0x59, 0xFF, 0xCA, 0x2A, 0xFF, 0xE1, 0x9F, 0xC9, 0x9A, 0xF1, 0xFA, 0x39, 0xE1, 0xF9, 0x4E,
+    0x1F, 0x94, 0xD9, 0x1F, 0xC9, 0x70, 0xFD, 0xA9, 0x69, 0xFF, 0x95, 0xAF, 0xFC, 0x59, 0xFF, 0xC9,
+    0x59, 0xFF, 0x79, 0xFD, 0x90, 0xAA, 0x59, 0xFA, 0x9D, 0xA5, 0xFA, 0x9E, 0x5F, 0x99, 0xEA, 0x39,
+    0xF0, 0x9F, 0xCA, 0xAA, 0xFA, 0x09, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x50, 0x77,
+    0x4F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0E, 0x92, 0xFA, 0x2A, 0xDA, 0x0E, 0x3F,
+    0xA2, 0xAD, 0xA0, 0xE3, 0xFA, 0x2A, 0xD9, 0x1A, 0x93, 0xFA, 0x29, 0xA9, 0x70, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x74, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xD9, 0x70, 0xFF, 0xD9, 0x30, 0x77, 0x69, 0xFF, 0xC9, 0x19,
+    0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7,
+    0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5,
+    0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC,
+    0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70, 0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x70,
+    0x77, 0x69, 0xFF, 0xC9, 0x19, 0xFF, 0x09, 0xFF, 0xC2, 0x9F, 0xF1, 0x9F, 0xD9, 0x59, 0xFA, 0x39,
+    0xFC, 0x69, 0xF5, 0xFC, 0x95, 0xAE, 0x95, 0xAF, 0xA5, 0xF7, 0xFC, 0x49, 0xEA, 0x7A, 0xF9, 0x3F,
+    0x70, 0x9F, 0xA3, 0xF7, 0x1F, 0xC2, 0x9E, 0x97, 0x1A, 0xF9, 0x1F, 0x73, 0xFA, 0x1E, 0xA7, 0x3A,
+    0xF0, 0x9E, 0x74, 0x9F, 0x0F, 0x75, 0xFA, 0xE9, 0x75, 0xAF, 0xE7, 0x7F, 0xDA, 0x77, 0xAF, 0xC7,
+    0x70, 0x9F, 0xA7, 0x71, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x0F, 0xFC, 0x92, 0x9E, 0x93, 0xAF, 0xEA,
+    0x0F, 0xFC, 0x3A, 0xEA, 0x3A, 0xFE, 0x90, 0x9F, 0xDA, 0x4F, 0xC4, 0x9F, 0xC4, 0xFC, 0x5F, 0xC5,
+    0xAE, 0x5F, 0xC9, 0x39, 0xFC, 0x94, 0xF5, 0x9F, 0xA3, 0xAF, 0xD4, 0xEA, 0x6F, 0xC3, 0xFE, 0x39,
+    0xE9, 0x6F, 0xC3, 0xFE, 0x92, 0xAE, 0x7A, 0xF9, 0x19, 0xFE, 0xA2, 0xEA, 0x70, 0xFA, 0x1A, 0xD9,
+    0xAF, 0x2E, 0x97, 0x0F, 0xC1, 0xE1, 0xF1, 0x9E, 0x71, 0xAF, 0x09, 0xE1, 0xFA, 0x0A, 0xDA, 0x72,
+    0xF9, 0xAD, 0xA1, 0xAF, 0x0E, 0x97, 0x2F, 0xAE, 0x3F, 0x9E, 0x73, 0xAF, 0xE3, 0xFE, 0xA7, 0x4F,
+    0xDA, 0x3A, 0xFD, 0x97, 0x4F, 0xD9, 0x4F, 0xD7, 0x5A, 0xFC, 0x5F, 0xCA, 0x76, 0xFA, 0x5A, 0xF9,
+    0x76, 0xF9, 0x6F, 0x77, 0x77, 0x70, 0x77, 0x6A, 0xFF, 0xC1, 0xFF, 0x90, 0xFF, 0xCA, 0x1F, 0xF2,
+    0x9F, 0xD4, 0x9F, 0x95, 0xFC, 0x93, 0xF9, 0x69, 0xFC, 0x2A, 0xE9, 0x70, 0xAF, 0xA0, 0x9E, 0xA7,
+    0x2A, 0xF9, 0xF7, 0x4F, 0xF7, 0x6F, 0xD7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x5A, 0xFE, 0x97, 0x39,
+    0xEA, 0xFC, 0x73, 0xEA, 0x09, 0xFA, 0x71, 0xF2, 0xAF, 0xA7, 0xF9, 0x3F, 0xC9, 0x5A, 0xEA, 0x49,
+    0xFC, 0x4A, 0xFA, 0x93, 0x9F, 0xDA, 0x09, 0xFF, 0xA1, 0xFF, 0xDA, 0xFF, 0x91, 0xFF, 0xD0, 0x77,
+    0x49, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA, 0x1A, 0xFE, 0x90, 0x9F, 0xD9, 0x4F, 0xA4, 0xFC, 0x5F,
+    0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7, 0x0F, 0xA1, 0x9E, 0x71, 0xAF, 0x1E, 0x97, 0x2F, 0xA9,
+    0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F, 0xFD, 0x71, 0xAF, 0xFC, 0xA4, 0x77, 0x19, 0xFF, 0xFD,
+    0x19, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x0A, 0xDA, 0x4A, 0xFA, 0x1A, 0xD9, 0x39, 0xFC, 0x29,
+    0xD4, 0xFC, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xFC,
+    0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x49, 0xA9, 0x19, 0xFC, 0x5E, 0x1F, 0xC5, 0x9E, 0x0A, 0xFA, 0x5F,
+    0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xE9, 0x09, 0xFF, 0xFD, 0x77, 0x10, 0x0F, 0xD9, 0x0F, 0xDA, 0x0F,
+    0xD9, 0x0E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9,
+    0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E,
+    0x93, 0xE9, 0x3F, 0xD9, 0x0F, 0xDA, 0x0A, 0xAA, 0xAA, 0xA0, 0x0F, 0x72, 0x9E, 0x97, 0x2F, 0x72,
+    0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72, 0xAE, 0x73,
+    0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72, 0xAE, 0x97, 0x2E, 0xA7,
+    0x2A, 0xE7, 0x3E, 0xA7, 0x2F, 0x73, 0x99, 0x90, 0x9F, 0xCA, 0xAF, 0xD9, 0xFD, 0x2A, 0xE2, 0xAE,
+    0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A,
+    0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE2, 0xAE, 0xAF, 0xDA,
+    0xFD, 0x9A, 0xAA, 0xAA, 0xA0, 0x59, 0xAA, 0x97, 0x3F, 0x72, 0x9F, 0x97, 0x1F, 0xD7, 0x1F, 0xD7,
+    0x0A, 0xD9, 0x9D, 0xA7, 0xE1, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x91, 0x9E, 0x49, 0xE3, 0xE9, 0x3A,
+    0xDA, 0x3A, 0xDA, 0x3E, 0x93, 0x9E, 0x2A, 0xE5, 0xEA, 0x1A, 0xDA, 0x5A, 0xDA, 0x00, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA7, 0x60, 0x79, 0xC4, 0xE2, 0x9E,
+    0xA2, 0xAE, 0xA2, 0x9E, 0x4D, 0x70, 0x49, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA,
+    0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD,
+    0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD,
+    0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x59, 0x97, 0x29,
+    0xAF, 0xC7, 0x2F, 0xE7, 0x2A, 0xAF, 0xC7, 0x49, 0xF7, 0x49, 0xF7, 0x49, 0xF7, 0x49, 0xF1, 0x99,
+    0xA9, 0x69, 0xF9, 0xFD, 0xA4, 0x9F, 0xFF, 0xA3, 0x9F, 0xFF, 0xC3, 0x9F, 0xA2, 0xFC, 0x92, 0x9F,
+    0x4F, 0xA2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4F, 0xA2, 0x9F, 0x4F,
+    0xA2, 0x9F, 0x4F, 0x92, 0x9F, 0x3A, 0xF3, 0xAF, 0xAA, 0xAF, 0xC9, 0x3A, 0xFF, 0xE9, 0x49, 0xFF,
+    0xCA, 0x72, 0x99, 0x99, 0x95, 0x59, 0x9A, 0x97, 0xFE, 0xA3, 0x9F, 0xFC, 0xA1, 0x9F, 0xA9, 0xFC,
+    0x1F, 0x92, 0xF0, 0x9F, 0x3E, 0x90, 0xAE, 0xA3, 0x99, 0x2F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xC7, 0x0A, 0xFA, 0x79, 0xFC, 0xA4, 0xA1, 0xFF, 0xF2, 0xFF, 0xE3, 0xAF, 0xEA, 0x69, 0x99, 0x99,
+    0x30, 0x73, 0x99, 0x73, 0xAF, 0xC9, 0x71, 0xAF, 0xD9, 0x71, 0x9A, 0xFC, 0x97, 0x4F, 0x97, 0x4F,
+    0x97, 0x4F, 0x97, 0x09, 0xA9, 0x9F, 0x95, 0x9F, 0xFD, 0x94, 0xAF, 0xFE, 0x93, 0x9F, 0xA9, 0x9A,
+    0xF9, 0x3F, 0xA3, 0xF9, 0x29, 0xF4, 0xF9, 0x2A, 0xF4, 0xF9, 0x2F, 0xA4, 0xF9, 0x2F, 0xA4, 0xF9,
+    0x2F, 0xA4, 0xF9, 0x2F, 0xC4, 0xF9, 0x2F, 0xC4, 0xF9, 0x2A, 0xFC, 0x2A, 0xF9, 0x3F, 0xFF, 0xCA,
+    0x92, 0xAF, 0xFA, 0xFD, 0x2A, 0xFD, 0x1F, 0xD4, 0x99, 0x93, 0x99, 0x40, 0x59, 0xA9, 0x96, 0x9F,
+    0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A,
+    0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09,
+    0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x30, 0x79, 0xAA, 0xA9,
+    0x70, 0xAF, 0xE9, 0x5F, 0xFD, 0x4A, 0xF9, 0x9F, 0x4F, 0x3D, 0x93, 0x9F, 0x49, 0x4A, 0xEA, 0x72,
+    0xAE, 0xA7, 0x0A, 0xFF, 0xD3, 0xAF, 0xFE, 0x39, 0xAA, 0xFC, 0xAA, 0xA9, 0x6F, 0xA7, 0x2F, 0xA7,
+    0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xC9,
+    0x7A, 0xFF, 0xA5, 0xFF, 0xCA, 0x40, 0x59, 0x9A, 0x99, 0x19, 0x9A, 0x94, 0xAF, 0xFF, 0x3A, 0xFF,
+    0xFC, 0x29, 0xF9, 0x09, 0xF0, 0xAA, 0x2F, 0x3A, 0xE9, 0x4F, 0x39, 0xEA, 0x4F, 0x39, 0xEA, 0x4F,
+    0x92, 0xF9, 0x49, 0xFC, 0xAF, 0xC6, 0xAF, 0xFC, 0x7A, 0xFE, 0x97, 0x9E, 0x75, 0xEA, 0x75, 0xFF,
+    0xCA, 0xAA, 0x94, 0xAF, 0xFF, 0xA3, 0x9F, 0xFF, 0xC2, 0x9E, 0xAA, 0xAA, 0xAA, 0xFC, 0x91, 0xF6,
+    0xF9, 0x09, 0xF5, 0x9F, 0x19, 0xFA, 0x91, 0x9A, 0xFA, 0x2F, 0xFF, 0xCA, 0x4F, 0xFE, 0x96, 0x9A,
+    0xAD, 0xAA, 0x96, 0x49, 0x97, 0x4A, 0xFC, 0x97, 0x2F, 0xE9, 0x72, 0x9A, 0xFC, 0x97, 0x49, 0xF9,
+    0x74, 0x9F, 0x97, 0x49, 0xF7, 0x59, 0xF2, 0x99, 0xA9, 0x69, 0xF0, 0xAF, 0xD5, 0x9F, 0xFF, 0xC4,
+    0x9F, 0xFF, 0xC9, 0x39, 0xFC, 0x91, 0x9F, 0xA3, 0x9F, 0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F,
+    0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFA,
+    0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFC, 0x91, 0xFF, 0x1F, 0xEA, 0x9F, 0xEA, 0x09, 0xFE, 0xA0,
+    0x39, 0x96, 0xFA, 0x39, 0xFC, 0x39, 0xFC, 0x4A, 0xE9, 0x77, 0x72, 0x99, 0x3A, 0xFC, 0xA1, 0x9F,
+    0xDA, 0x29, 0xAF, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4,
+    0xFA, 0x39, 0xFC, 0x91, 0xFF, 0xA0, 0xFF, 0xA0, 0x59, 0x96, 0xF4, 0xAF, 0xA3, 0xAF, 0x94, 0xF7,
+    0x77, 0x29, 0x99, 0x29, 0xFD, 0x2A, 0xFD, 0x3A, 0xFC, 0x49, 0xF4, 0x9F, 0x49, 0xF4, 0x9F, 0x49,
+    0xF4, 0x9F, 0x49, 0xF4, 0x9F, 0x49, 0xF4, 0x9F, 0x49, 0xF4, 0x9F, 0x49, 0xF4, 0xAE, 0xA3, 0x9F,
+    0x92, 0x9F, 0xC1, 0x9F, 0xD2, 0x9F, 0xC9, 0x3A, 0xCA, 0x94, 0x49, 0x97, 0x4A, 0xFC, 0x73, 0xFE,
+    0x73, 0x9A, 0xFC, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x1A, 0xFE, 0x39,
+    0xF1, 0x9F, 0xE3, 0x9F, 0x29, 0xF9, 0x49, 0xF2, 0xF6, 0x9F, 0x1F, 0x79, 0xF9, 0xF7, 0x09, 0xFF,
+    0xC7, 0x09, 0xF9, 0xF9, 0x79, 0xF0, 0xAF, 0x79, 0xF1, 0xFC, 0x69, 0xF1, 0x9F, 0xA5, 0x9F, 0x2A,
+    0xFA, 0x49, 0xF9, 0x2F, 0xCA, 0x2F, 0xF1, 0x9F, 0xCA, 0x09, 0xFF, 0x29, 0xFA, 0x76, 0x99, 0x20,
+    0x49, 0x93, 0xAF, 0xC9, 0x1A, 0xFD, 0x91, 0x9A, 0xFC, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94,
+    0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9,
+    0x4F, 0x93, 0x9F, 0xA1, 0x9F, 0xF9, 0xAF, 0xF9, 0x39, 0x99, 0x29, 0x9A, 0x95, 0x9A, 0x96, 0xAF,
+    0xC0, 0x9F, 0xD9, 0x1A, 0xFC, 0xA3, 0x9F, 0xFF, 0xE9, 0xFF, 0x93, 0xAA, 0xFF, 0xFF, 0xFE, 0x5F,
+    0xC9, 0x2F, 0xCA, 0x2F, 0xC5, 0xFA, 0x3A, 0xF3, 0x9F, 0x5F, 0xA3, 0xAF, 0x39, 0xF5, 0xFA, 0x3A,
+    0xF3, 0x9F, 0x5F, 0xA3, 0xAF, 0x39, 0xF5, 0xFA, 0x3A, 0xF3, 0x9F, 0x5F, 0xA3, 0xAF, 0x39, 0xF5,
+    0xFA, 0x3A, 0xF3, 0x9F, 0x5F, 0xA3, 0xAF, 0x39, 0xF5, 0xFA, 0x3A, 0xF3, 0x9F, 0xA2, 0xAF, 0xE1,
+    0xFE, 0x1A, 0xFE, 0x1F, 0xF1, 0xFE, 0x1F, 0xF0, 0x39, 0x99, 0x29, 0x9A, 0x96, 0xAF, 0xC0, 0x9F,
+    0xD9, 0x39, 0xFD, 0xAF, 0xF9, 0x3A, 0xAF, 0xFF, 0xCA, 0x5F, 0xC9, 0x2F, 0xC5, 0xFA, 0x3A, 0xF5,
+    0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA,
+    0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x3A, 0xF9, 0x2A, 0xFE, 0x1F, 0xF1, 0xFF, 0x1F, 0xF0, 0x59,
+    0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09,
+    0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49,
+    0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70,
+    0x99, 0x99, 0x60, 0x39, 0x99, 0x29, 0xA9, 0x5F, 0xCA, 0x0F, 0xE2, 0xAF, 0xFF, 0xE1, 0x9A, 0xFF,
+    0xFD, 0x92, 0x9F, 0xA2, 0xAF, 0xA2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F,
+    0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xEA, 0x29, 0xF4, 0xF9, 0x29, 0xF3, 0xAF, 0x39, 0xFC,
+    0xAA, 0xFC, 0x93, 0x9F, 0xFE, 0xA4, 0x9F, 0xFD, 0x95, 0x9F, 0x99, 0x99, 0x70, 0x9F, 0x74, 0x9F,
+    0x74, 0x9F, 0x73, 0x9F, 0xDA, 0x70, 0x9F, 0xFA, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x59, 0xA9,
+    0x99, 0x70, 0x9F, 0xFD, 0x93, 0xAF, 0xFE, 0x92, 0x9F, 0xC9, 0xAA, 0xF9, 0x2F, 0xA3, 0xF9, 0x19,
+    0xF4, 0xF9, 0x1A, 0xF4, 0xF9, 0x1F, 0xA4, 0xF9, 0x1F, 0xA4, 0xF9, 0x1F, 0xA4, 0xF9, 0x1F, 0xC4,
+    0xF9, 0x1A, 0xF4, 0xF9, 0x19, 0xFC, 0x19, 0xFC, 0x92, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0x93, 0x9F,
+    0xCA, 0x0F, 0x96, 0x93, 0xF9, 0x73, 0xF9, 0x73, 0xF9, 0x73, 0xF9, 0x71, 0x9F, 0xDA, 0x7A, 0xFF,
+    0x79, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x39, 0x99, 0x29, 0xA9, 0x1A, 0xFA, 0x09, 0xF0, 0x9F, 0xD0,
+    0xFC, 0x1A, 0xAF, 0xFD, 0x3F, 0xDA, 0xAA, 0xA3, 0xFC, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70,
+    0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x79, 0xFC, 0x95, 0xFF, 0xC9, 0x3F, 0xFC, 0x92, 0x49,
+    0xAA, 0x99, 0x5F, 0xFA, 0x2F, 0xFD, 0x1F, 0x29, 0xE1, 0xF3, 0xAD, 0x1F, 0x92, 0x9A, 0x91, 0xFD,
+    0xA5, 0xAF, 0xEA, 0x4A, 0xFF, 0x93, 0x9F, 0xF6, 0xAF, 0xC9, 0x9D, 0x4F, 0x9A, 0xDA, 0x3A, 0xE9,
+    0xAE, 0xA1, 0x9F, 0x09, 0xFF, 0xD9, 0x1A, 0xFE, 0xA6, 0x99, 0x99, 0x40, 0x39, 0xE7, 0x0F, 0x79,
+    0xF7, 0x9F, 0x59, 0xAF, 0xFC, 0x90, 0xFF, 0xE9, 0x0A, 0xAF, 0xCA, 0xAA, 0xA3, 0xAF, 0x7A, 0xF7,
+    0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x92, 0x92, 0x9F, 0xFC, 0x3F, 0xFA,
+    0x39, 0xFD, 0xA6, 0x99, 0x99, 0x20, 0x77, 0x4A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9,
+    0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A,
+    0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39, 0x94,
+    0x77, 0x29, 0xFF, 0x91, 0xFD, 0xA0, 0xFF, 0x2F, 0xD9, 0x1F, 0xCA, 0x4F, 0x4F, 0xA4, 0xEA, 0x4F,
+    0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x6A, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70, 0xAE,
+    0xA9, 0xE7, 0x2F, 0xAD, 0xA7, 0x2F, 0xE7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x77, 0x71,
+    0x77, 0x71, 0x9F, 0xF2, 0xAD, 0x92, 0xFE, 0x0F, 0xEA, 0x2E, 0xA2, 0xFD, 0x91, 0xFC, 0x4F, 0x39,
+    0xE9, 0x29, 0xF3, 0xAF, 0x92, 0xAE, 0x4F, 0x92, 0xFC, 0xA2, 0xEA, 0x4A, 0xEA, 0x2F, 0xD2, 0xE5,
+    0x9F, 0x19, 0xDA, 0xE1, 0x9E, 0x6F, 0x1D, 0xA9, 0xE9, 0x0A, 0xD9, 0x6A, 0xE9, 0x0D, 0x90, 0xEA,
+    0x0E, 0x70, 0xEA, 0x9D, 0x1A, 0xE0, 0xDA, 0x70, 0xFA, 0xD1, 0x9E, 0xAD, 0x97, 0x09, 0xFC, 0xA2,
+    0xFD, 0x72, 0xFC, 0x3F, 0xCA, 0x72, 0xFC, 0x39, 0xF7, 0x39, 0xEA, 0x4F, 0x77, 0x77, 0x77, 0x2F,
+    0xEA, 0x09, 0xFD, 0x90, 0xFE, 0x91, 0xAF, 0xA2, 0x9F, 0xA2, 0xAE, 0x94, 0x9F, 0x91, 0xE9, 0x69,
+    0xF0, 0xE9, 0x70, 0xAF, 0xDA, 0x72, 0xAF, 0xC7, 0x4F, 0x97, 0x3F, 0xD9, 0x71, 0xFF, 0x70, 0xAE,
+    0x09, 0xF6, 0xAE, 0x91, 0xFC, 0x4A, 0xEA, 0x3F, 0xC2, 0xFD, 0xA1, 0xFE, 0xAA, 0xFD, 0xA0, 0x9F,
+    0xEA, 0x77, 0x29, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4,
+    0xEA, 0x4F, 0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9,
+    0x70, 0xAE, 0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA,
+    0x75, 0x9E, 0x97, 0x5F, 0x74, 0x9F, 0x70, 0x9A, 0xAA, 0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19, 0xFD,
+    0x97, 0x3A, 0xDA, 0x97, 0x40, 0x77, 0x9F, 0xFE, 0xA1, 0x9F, 0xFF, 0x1A, 0xEA, 0xAA, 0xFC, 0xA1,
+    0xAD, 0x3F, 0xC2, 0xAC, 0xA2, 0xFC, 0x49, 0x2A, 0xF9, 0x79, 0xF9, 0x79, 0xFA, 0x70, 0xFC, 0x70,
+    0xFC, 0x3A, 0xA2, 0xAF, 0x92, 0x9D, 0x19, 0xFA, 0x3E, 0x1F, 0xCA, 0xAA, 0xAF, 0x1F, 0xFF, 0xC1,
+    0xAF, 0xFE, 0xA7, 0x70, 0x76, 0xAE, 0xA3, 0xFD, 0x2F, 0xAA, 0x91, 0x9E, 0xA4, 0x9E, 0x59, 0xE5,
+    0x9E, 0x95, 0xE9, 0x5E, 0xA5, 0xEA, 0x5F, 0x5F, 0x4F, 0x93, 0xF9, 0x4F, 0xA5, 0xAE, 0xA5, 0xF5,
+    0xF5, 0xEA, 0x5E, 0xA5, 0xE9, 0x49, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0xA5, 0xFD, 0xA3, 0xFD, 0x49,
+    0xAD, 0x90, 0x5E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90,
+    0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9,
+    0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0x99, 0x90, 0x72, 0xFA, 0x39, 0xFD, 0x3A, 0xAF,
+    0xA5, 0xF5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5F, 0x5E, 0xA5, 0xE9, 0x5E, 0x95, 0xEA, 0x5F, 0xA5, 0xFA,
+    0x4F, 0xA3, 0xF9, 0x4E, 0xA5, 0xE9, 0x5E, 0xA5, 0xEA, 0x5F, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xF2,
+    0xFD, 0x91, 0x9F, 0xCA, 0x3A, 0xDA, 0x40, 0x29, 0x97, 0x19, 0xFA, 0x3A, 0xCA, 0x0F, 0xE9, 0x09,
+    0xFE, 0xAF, 0xFA, 0xE2, 0xAF, 0xD1, 0xAA, 0x39, 0xAD, 0xA7, 0x70, 0x09, 0xAA, 0x1A, 0xF0, 0xFC,
+    0x0A, 0xF1, 0xAA, 0xA7, 0x29, 0x2A, 0xDA, 0x1A, 0xDA, 0x1A, 0xE1, 0xAE, 0x1A, 0xE1, 0xAE, 0x1A,
+    0xE1, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0xF9, 0x0F, 0x90, 0xF9, 0x0F, 0x09, 0xF1, 0xAA, 0x91,
+    0x77, 0x7D, 0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x73, 0xAF, 0xA9, 0x6A, 0xFF, 0xC4,
+    0xFF, 0xF2, 0xAE, 0x99, 0xD0, 0xAE, 0x19, 0xE9, 0x09, 0xD1, 0xE1, 0xAE, 0x19, 0xD1, 0xAA, 0x2F,
+    0x19, 0xD6, 0xEA, 0x19, 0xCA, 0x6E, 0xA1, 0x9C, 0xA6, 0xEA, 0x19, 0xCA, 0x6F, 0x1A, 0xCA, 0x6F,
+    0x90, 0xAC, 0xA6, 0xAF, 0x9A, 0xCA, 0x29, 0xA2, 0xFF, 0xAF, 0x29, 0xFF, 0xEA, 0x4A, 0xFF, 0x97,
+    0x0D, 0xA7, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x49, 0x96, 0x77, 0x72,
+    0xAF, 0xA7, 0x19, 0xFF, 0x97, 0xFA, 0xAF, 0x6F, 0x2A, 0xE6, 0xEA, 0x29, 0xE5, 0xAE, 0x93, 0xD9,
+    0x5F, 0x75, 0xF7, 0x5F, 0x72, 0xFF, 0xF4, 0x9F, 0xFF, 0x59, 0x9A, 0xF9, 0x99, 0x99, 0x7A, 0xE9,
+    0x74, 0xAE, 0x97, 0x4F, 0x75, 0xEA, 0x74, 0x9E, 0x96, 0x99, 0x1F, 0xFF, 0xF1, 0xFF, 0xFE, 0xA1,
+    0xAE, 0xAF, 0xFD, 0x92, 0x9A, 0x96, 0x99, 0x92, 0x77, 0x0D, 0x92, 0x99, 0x92, 0xD0, 0x9E, 0xAF,
+    0xDA, 0xE9, 0x09, 0xFF, 0xF9, 0x3F, 0x99, 0xF9, 0x39, 0xE3, 0xEA, 0x3A, 0xDA, 0x3A, 0xDA, 0x3A,
+    0xDA, 0x39, 0xDA, 0x3A, 0xE3, 0xAD, 0xA3, 0x9E, 0x91, 0x9E, 0x4A, 0xFF, 0xE2, 0xFF, 0xFD, 0x90,
+    0xDA, 0x09, 0xAD, 0xA1, 0xAD, 0x90, 0x9A, 0x71, 0x99, 0x00, 0x0F, 0xF9, 0x1A, 0xFD, 0x99, 0xFF,
+    0x2F, 0xE9, 0x09, 0xFC, 0xA3, 0x9A, 0xF9, 0x3F, 0xA4, 0x9E, 0x5A, 0xF4, 0xEA, 0x6F, 0xA2, 0x9E,
+    0x79, 0xF2, 0xE9, 0x70, 0xF9, 0x09, 0xE7, 0x99, 0xAF, 0x0E, 0xA9, 0x95, 0xFE, 0xAF, 0xD9, 0x49,
+    0xFF, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFF, 0xFC, 0x6F, 0xFF, 0xA6, 0x99, 0x99, 0xFA, 0x99, 0x97,
+    0x3F, 0x97, 0x6F, 0x97, 0x49, 0xAF, 0xCA, 0x97, 0x1F, 0xFD, 0x97, 0x0F, 0xFD, 0x40, 0x5E, 0x90,
+    0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x77, 0x71, 0xAA,
+    0xA1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x09, 0x99,
+    0x00, 0x4A, 0xEA, 0x5A, 0xFE, 0x92, 0xAD, 0xA9, 0xAF, 0x1A, 0xD9, 0x29, 0xE1, 0xE4, 0xD9, 0x09,
+    0xEA, 0x7A, 0xFA, 0x6D, 0x9F, 0xA4, 0xD9, 0x0F, 0xC9, 0x2A, 0xCA, 0x1A, 0xFA, 0x19, 0xD9, 0x2F,
+    0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xF9, 0x2D, 0xA1, 0x9F, 0xC1, 0xAD, 0x3F, 0xC9, 0x9D, 0x49, 0xFA,
+    0xD6, 0xAF, 0xA0, 0xD4, 0xAE, 0x9A, 0xD9, 0x39, 0xE0, 0xF9, 0x2E, 0x1A, 0xFF, 0xC9, 0x2A, 0xFE,
+    0x69, 0xAA, 0xA5, 0x74, 0xE9, 0x1A, 0xDA, 0x09, 0xF0, 0x9F, 0x09, 0xF1, 0xF1, 0xAC, 0xA2, 0xAC,
+    0xA1, 0x70, 0x99, 0x99, 0x76, 0x9F, 0xFA, 0x72, 0xEA, 0x91, 0x99, 0xAD, 0xA7, 0xDA, 0x70, 0xAC,
+    0xA5, 0xD9, 0x72, 0xAC, 0xA3, 0xAC, 0x93, 0xAF, 0x92, 0xAC, 0x92, 0xD2, 0x9F, 0xE3, 0xD1, 0xAC,
+    0x92, 0xE1, 0x9D, 0x3A, 0xC1, 0xD2, 0xAD, 0x3C, 0xA3, 0x9C, 0xA0, 0xD2, 0xE7, 0x2C, 0xA0, 0xCA,
+    0x2E, 0x72, 0xD0, 0xCA, 0x2E, 0x72, 0xD0, 0xD2, 0xE7, 0x2C, 0xA0, 0xD2, 0xEA, 0x70, 0x9C, 0xA0,
+    0xAC, 0x91, 0x9F, 0xA9, 0xAC, 0x3A, 0xC2, 0xCA, 0x2A, 0xFE, 0x3D, 0x2A, 0xC9, 0x29, 0xAE, 0xA3,
+    0xAC, 0x93, 0xD9, 0x72, 0xAC, 0xA5, 0xD9, 0x70, 0xAD, 0x7E, 0xA9, 0x29, 0xAD, 0xA7, 0x19, 0xFF,
+    0xA7, 0x69, 0x99, 0x99, 0x70, 0x29, 0xAA, 0x94, 0x9F, 0xD3, 0xE9, 0xAD, 0x92, 0xAC, 0x91, 0xDA,
+    0x69, 0xDA, 0x29, 0xFD, 0xA2, 0xDA, 0x99, 0xDA, 0x19, 0xD2, 0xDA, 0x19, 0xDA, 0x9F, 0xC9, 0x0F,
+    0xCA, 0xE2, 0x9A, 0x91, 0x99, 0x75, 0xFF, 0xC0, 0x9F, 0xF9, 0x19, 0x99, 0x99, 0x93, 0x5C, 0xA4,
+    0xAC, 0x49, 0xE3, 0xE9, 0x2A, 0xE9, 0x19, 0xEA, 0x2A, 0xE9, 0x19, 0xF2, 0xFA, 0x1A, 0xF3, 0xF2,
+    0xF9, 0x3F, 0xA1, 0xAF, 0x4F, 0x91, 0xAE, 0xA4, 0xF9, 0x1A, 0xEA, 0x4A, 0xE2, 0x9E, 0x94, 0x9D,
+    0x4D, 0x97, 0x70, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x19, 0xAA, 0x90,
+    0x70, 0xAF, 0xFF, 0xFF, 0xFC, 0xA7, 0x00, 0x69, 0x99, 0x72, 0x9F, 0xE9, 0x6A, 0xCA, 0x4A, 0xCA,
+    0x4A, 0xC9, 0x69, 0xC9, 0x3C, 0x90, 0xFC, 0x91, 0xAC, 0x2A, 0xC1, 0x9C, 0xA0, 0xD2, 0xCA, 0x1C,
+    0xA2, 0xCA, 0x0A, 0xC9, 0x1A, 0xC1, 0xC9, 0x2D, 0x9D, 0x2A, 0xC1, 0xC9, 0x2F, 0x3A, 0xC1, 0xCA,
+    0x2D, 0xAC, 0xA2, 0xAC, 0x1D, 0x19, 0xD0, 0xDA, 0x1C, 0xA1, 0x9C, 0x1E, 0xA0, 0xD9, 0x9C, 0x92,
+    0xD7, 0x0C, 0xA4, 0xD9, 0x49, 0xD6, 0xAD, 0xAA, 0xAD, 0xA7, 0x19, 0xAA, 0xA9, 0x50, 0x0A, 0xFF,
+    0x90, 0xFF, 0xCA, 0x0F, 0xFC, 0x90, 0x75, 0xAF, 0x93, 0xFE, 0xA1, 0xFA, 0xF9, 0x9E, 0x2A, 0xDA,
+    0x9D, 0x93, 0xEA, 0xD9, 0x3E, 0x9E, 0x2A, 0xDA, 0x0F, 0xAF, 0x19, 0xFE, 0x92, 0x9A, 0xEA, 0x97,
+    0x40, 0x4A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x49, 0xFF, 0xF9,
+    0x9F, 0xFF, 0x90, 0xAA, 0xAA, 0xFA, 0xAA, 0xA9, 0x4A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71,
+    0xAD, 0xA7, 0x19, 0xD9, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0x99, 0xFF,
+    0xF9, 0x75, 0x2A, 0xEA, 0x39, 0xFE, 0x91, 0xFA, 0xF0, 0x9E, 0x19, 0xE9, 0x0D, 0xA1, 0x9E, 0x6A,
+    0xE5, 0x9E, 0x94, 0x9E, 0x94, 0xAE, 0x94, 0xAE, 0x5F, 0xAA, 0xAA, 0xA9, 0x9F, 0xFD, 0x0F, 0xFC,
+    0xA7, 0x20, 0x2A, 0xEA, 0x3A, 0xFE, 0x91, 0xE9, 0x9F, 0x1D, 0x29, 0xE6, 0xEA, 0x49, 0xEA, 0x39,
+    0xFC, 0xA4, 0xCA, 0xAF, 0x69, 0xE6, 0x9E, 0x59, 0xF0, 0x9F, 0xF2, 0xFD, 0xA3, 0x9A, 0xAA, 0x94,
+    0x79, 0xCA, 0x2E, 0x1A, 0xE1, 0xEA, 0x0A, 0xDA, 0x19, 0xCA, 0x39, 0x30, 0x29, 0x99, 0x69, 0x94,
+    0xAF, 0x39, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA,
+    0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3F, 0xC4, 0xFC, 0x3F,
+    0xC4, 0xFC, 0x91, 0xAF, 0xC4, 0xFF, 0xDA, 0xFA, 0xA9, 0x0F, 0xFD, 0x0F, 0xD9, 0x0F, 0xFC, 0x19,
+    0xFA, 0x1E, 0xA0, 0x99, 0x94, 0x99, 0x3F, 0x76, 0xF7, 0x6F, 0x97, 0x49, 0xF9, 0x74, 0x9F, 0x76,
+    0xAA, 0x97, 0x60, 0x77, 0x5A, 0xFF, 0xD9, 0x2A, 0xFF, 0xF2, 0xFF, 0xAE, 0x92, 0xAF, 0xEA, 0x0E,
+    0x3F, 0xFA, 0x0E, 0x29, 0xFF, 0xA0, 0xE2, 0x9F, 0xFA, 0x0E, 0x2A, 0xFF, 0xA0, 0xE2, 0x9F, 0xFA,
+    0x0E, 0x3F, 0xFA, 0x0E, 0x3A, 0xFE, 0xA0, 0xE4, 0xFE, 0xA0, 0xE5, 0xEA, 0xDA, 0x0E, 0x71, 0xDA,
+    0x0E, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0E,
+    0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0D, 0xA7, 0x1D, 0xA0, 0xD7, 0x2D, 0x97, 0x5D, 0x77, 0x70, 0x29,
+    0x2F, 0x99, 0xFA, 0x9F, 0xA0, 0xF9, 0x50, 0x09, 0xAA, 0x1A, 0xF1, 0xAE, 0xA1, 0xAD, 0x91, 0xE0,
+    0x9E, 0x19, 0xA9, 0x20, 0x49, 0xC4, 0x9A, 0xEA, 0x2F, 0xDA, 0x29, 0xFC, 0xA5, 0xEA, 0x5E, 0xA5,
+    0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x29, 0xFF, 0x0A, 0xFF, 0x71, 0x29, 0xAA, 0xA9, 0x4F,
+    0xE2, 0xEA, 0x9F, 0x09, 0xD9, 0x2E, 0x9A, 0xD3, 0xAD, 0x9A, 0xD3, 0x9D, 0x9A, 0xD9, 0x2A, 0xD9,
+    0x9D, 0xA2, 0xE1, 0xFA, 0xE9, 0x2F, 0xDA, 0x49, 0x9A, 0x97, 0x79, 0xFE, 0xA1, 0xFF, 0x92, 0x99,
+    0x99, 0x93, 0x0C, 0xA4, 0xAC, 0x94, 0xAE, 0x92, 0xEA, 0x4A, 0xE9, 0x19, 0xEA, 0x4F, 0xA1, 0xAF,
+    0x4F, 0xA1, 0xAF, 0x39, 0xF2, 0xF3, 0xFA, 0x1A, 0xF2, 0xAE, 0xA1, 0x9F, 0x2A, 0xE9, 0x2E, 0xA2,
+    0x9E, 0x92, 0xEA, 0x39, 0xD4, 0xD9, 0x77, 0x40, 0x77, 0x77, 0x77, 0x1C, 0xA7, 0x4A, 0xC9, 0x72,
+    0xEA, 0x79, 0xAF, 0xA7, 0x19, 0xE7, 0x0F, 0xDA, 0x71, 0xE9, 0x70, 0x9A, 0xAE, 0xA7, 0x09, 0xE7,
+    0x4E, 0xA7, 0x0E, 0x97, 0x4E, 0xA7, 0x9D, 0xA7, 0x5E, 0xA7, 0xE7, 0x6E, 0xA6, 0x9D, 0xA4, 0xAA,
+    0xC9, 0x5E, 0xA6, 0xE4, 0xAE, 0x95, 0xEA, 0x59, 0xD9, 0x39, 0xF9, 0x5E, 0xA5, 0xE4, 0xFC, 0x92,
+    0x9F, 0xF2, 0xAD, 0x93, 0xEA, 0xD9, 0x2A, 0xFF, 0x2E, 0x3A, 0xD0, 0xAD, 0x97, 0x5A, 0xD9, 0x29,
+    0xD9, 0x0A, 0xD9, 0x74, 0x9E, 0x3D, 0xA1, 0xAD, 0x97, 0x4E, 0x3E, 0xAA, 0xAE, 0xAA, 0x97, 0x19,
+    0xDA, 0x3F, 0xFE, 0xA7, 0x1E, 0x5A, 0xAA, 0xAA, 0xEA, 0xA9, 0x70, 0xAD, 0xA7, 0x2A, 0xD9, 0x71,
+    0x9E, 0x73, 0xAD, 0x97, 0x1A, 0xDA, 0x73, 0x99, 0x97, 0x39, 0xC7, 0x77, 0x77, 0x70, 0x77, 0x77,
+    0x77, 0x0C, 0xA7, 0x5A, 0xC9, 0x71, 0xAD, 0xA7, 0x09, 0xAF, 0xA7, 0x1E, 0x71, 0xFD, 0xA7, 0x0A,
+    0xDA, 0x71, 0x9A, 0xAE, 0xA7, 0x0E, 0x75, 0xEA, 0x7A, 0xD9, 0x75, 0xEA, 0x7E, 0x76, 0xEA, 0x6A,
+    0xD9, 0x76, 0xEA, 0x6D, 0xA2, 0xAF, 0x96, 0xEA, 0x5E, 0x19, 0xFF, 0x5E, 0xA4, 0x9D, 0xA1, 0xFA,
+    0xF9, 0x4E, 0xA4, 0xE2, 0xE2, 0xEA, 0x19, 0xFF, 0x19, 0xDA, 0x2A, 0xD2, 0xE9, 0x1A, 0xFF, 0x1E,
+    0x70, 0xAE, 0x74, 0xAD, 0x97, 0x9E, 0x97, 0x4E, 0x79, 0xE9, 0x74, 0xE9, 0x6A, 0xE9, 0x74, 0x9E,
+    0x6A, 0xE7, 0x6E, 0x95, 0xFC, 0xAA, 0xAA, 0xA7, 0x0A, 0xE6, 0xFF, 0xD7, 0x0E, 0x7F, 0xFC, 0xA7,
+    0x9D, 0xA7, 0x77, 0x3C, 0x77, 0x77, 0x77, 0x10, 0x77, 0x77, 0x77, 0x0A, 0xC9, 0x71, 0x9F, 0xC9,
+    0x71, 0xE9, 0x7F, 0xFA, 0x7A, 0xE7, 0x9D, 0xA9, 0x0F, 0x7E, 0x71, 0xD2, 0xAE, 0x6A, 0xDA, 0x76,
+    0xE9, 0x6E, 0x74, 0x9A, 0xE9, 0x6A, 0xD9, 0x73, 0x9F, 0xD6, 0xE7, 0x5A, 0xAA, 0xF4, 0xAD, 0x94,
+    0xAA, 0xC9, 0x79, 0xE4, 0xE4, 0xAE, 0x97, 0xAE, 0x3A, 0xD4, 0x9F, 0x95, 0x9A, 0xEA, 0x29, 0xDA,
+    0x4F, 0xC9, 0x19, 0xFF, 0x3E, 0x4E, 0xAD, 0x92, 0xFD, 0xA3, 0x9D, 0xA3, 0xAD, 0x0A, 0xD9, 0x39,
+    0x99, 0x6E, 0x39, 0xD9, 0x0A, 0xD9, 0x74, 0xAD, 0x93, 0xDA, 0x1A, 0xD9, 0x74, 0xE3, 0xEA, 0xAA,
+    0xEA, 0xA9, 0x71, 0xE9, 0x3F, 0xFE, 0xA7, 0x09, 0xE5, 0xAA, 0xAA, 0xAE, 0xAA, 0x97, 0x0E, 0x97,
+    0x2A, 0xD9, 0x71, 0xAE, 0x73, 0xAD, 0x97, 0x1E, 0x97, 0x39, 0x99, 0x73, 0x9A, 0x77, 0x77, 0x77,
+    0x00, 0x5A, 0xA9, 0x7F, 0xA5, 0x9F, 0xA6, 0xF9, 0x69, 0xAA, 0x97, 0x76, 0x97, 0x09, 0xD7, 0x09,
+    0xD9, 0x59, 0xAE, 0xA3, 0x9F, 0xDA, 0x29, 0xFE, 0xA2, 0xFD, 0xA9, 0x29, 0xEA, 0x6A, 0xD9, 0x79,
+    0xD9, 0x79, 0xE7, 0x0F, 0x39, 0x91, 0x9F, 0xFC, 0x2A, 0xFF, 0x92, 0x9F, 0xE5, 0xAF, 0x97, 0x40,
+    0x77, 0x75, 0xCA, 0x77, 0x39, 0xE7, 0x72, 0xAF, 0x97, 0x71, 0xFD, 0x77, 0x19, 0xF9, 0x77, 0x39,
+    0xA7, 0x77, 0x77, 0x39, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7,
+    0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC,
+    0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7,
+    0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3,
+    0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x77,
+    0x77, 0x3C, 0x97, 0x72, 0x9E, 0x77, 0x1F, 0xC7, 0x79, 0xFC, 0xA7, 0x7F, 0xA9, 0x77, 0x09, 0x97,
+    0x77, 0x77, 0x69, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F,
+    0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72,
+    0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F,
+    0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F,
+    0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x70, 0x9D,
+    0xA7, 0x71, 0x9F, 0xA7, 0x70, 0xFE, 0x76, 0xE1, 0xEA, 0x74, 0xE9, 0x2E, 0x74, 0xAA, 0x5A, 0x77,
+    0x77, 0x71, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE,
+    0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29,
+    0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF,
+    0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA,
+    0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x77, 0x74,
+    0x9F, 0x1A, 0xC7, 0x5F, 0xDA, 0xDA, 0x74, 0xEA, 0xFC, 0x97, 0x4A, 0xC1, 0x9E, 0xA7, 0x73, 0x97,
+    0x77, 0x77, 0x39, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F,
+    0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72,
+    0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F,
+    0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F,
+    0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x59, 0xAA,
+    0x29, 0xAA, 0x97, 0x39, 0xEA, 0x1F, 0x73, 0xAF, 0x09, 0xF7, 0x39, 0xEA, 0x1F, 0x75, 0x94, 0x99,
+    0x77, 0x77, 0x71, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77,
+    0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7,
+    0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70,
+    0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39,
+    0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x70,
+    0x99, 0x97, 0x72, 0xAF, 0xA7, 0x7A, 0xD9, 0xAD, 0x97, 0x6D, 0x91, 0xDA, 0x76, 0xD9, 0x1D, 0xA7,
+    0x6E, 0x9A, 0xD7, 0x70, 0xFC, 0x97, 0x71, 0x99, 0x97, 0x75, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F,
+    0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74,
+    0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9,
+    0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6,
+    0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF,
+    0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x77, 0x77, 0x5F, 0xFF, 0xFD, 0x97, 0x1F, 0xFF, 0xFD, 0xA7,
+    0x3A, 0xFF, 0xFE, 0xA7, 0x3E, 0xAF, 0x93, 0xAD, 0xA7, 0x2A, 0xE0, 0xF9, 0x39, 0xD9, 0x72, 0xE9,
+    0x0F, 0x94, 0xA9, 0x72, 0xAE, 0x1F, 0x97, 0x70, 0x9E, 0x2F, 0x97, 0x70, 0xEA, 0x2F, 0xAA, 0xAA,
+    0xAA, 0x97, 0x19, 0xE3, 0xFF, 0xE7, 0x1E, 0xA3, 0xFF, 0xDA, 0x70, 0xAE, 0xA9, 0x99, 0xAF, 0xA9,
+    0x99, 0x99, 0x71, 0xFF, 0xFC, 0x97, 0x5A, 0xFF, 0xFC, 0x95, 0x95, 0x9E, 0x94, 0x9F, 0x94, 0x9D,
+    0x4F, 0x6F, 0x94, 0xE3, 0x9E, 0x96, 0xF9, 0x39, 0xE2, 0x9F, 0x94, 0x9A, 0xFF, 0xFC, 0x1F, 0xF2,
+    0xAF, 0xFF, 0xE1, 0xFF, 0x2F, 0xFF, 0xEA, 0x00, 0x79, 0xAA, 0xAA, 0x97, 0x9F, 0xFD, 0x4F, 0xFF,
+    0x92, 0xFD, 0xAA, 0xAF, 0x91, 0xAF, 0x94, 0xE9, 0x09, 0xF9, 0x5E, 0x90, 0xFC, 0x6A, 0xD1, 0xF9,
+    0x79, 0x19, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7,
+    0x29, 0xFC, 0x97, 0x2F, 0xD9, 0x71, 0x9F, 0xEA, 0x99, 0x9A, 0xAD, 0x1A, 0xFF, 0xFD, 0x2A, 0xFF,
+    0xF9, 0x4A, 0xFF, 0xC9, 0x70, 0x99, 0x99, 0x97, 0x39, 0xAA, 0x74, 0xAF, 0x74, 0xAE, 0xA7, 0x4A,
+    0xD9, 0x73, 0x9E, 0x73, 0xAE, 0x74, 0x9A, 0x96, 0x77, 0x5C, 0x97, 0x5E, 0xA7, 0x4F, 0xC7, 0x3A,
+    0xFC, 0x97, 0x3A, 0xF7, 0x69, 0x97, 0x77, 0x77, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF,
+    0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29,
+    0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99,
+    0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94,
+    0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x77, 0x72, 0x9C, 0x75, 0xAD, 0xA7,
+    0x29, 0xFC, 0x71, 0xAF, 0xC9, 0x71, 0xFA, 0x73, 0xA9, 0x77, 0x77, 0x72, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C,
+    0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE,
+    0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94,
+    0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x6A, 0xD9,
+    0x73, 0xAF, 0x97, 0x1A, 0xFD, 0x97, 0x9E, 0x09, 0xE9, 0x5A, 0xE2, 0x9D, 0xA6, 0xAA, 0x49, 0xA7,
+    0x77, 0x75, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19,
+    0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA,
+    0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97,
+    0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xF0, 0x3A, 0xA9, 0x29, 0xAA, 0x6F, 0x90, 0xAE, 0xA5, 0xF9, 0x0A, 0xF5, 0xAE,
+    0x19, 0xE9, 0x69, 0x94, 0x97, 0x77, 0x76, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9,
+    0x19, 0xF9, 0x4A, 0xD9, 0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9,
+    0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99,
+    0x49, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA,
+    0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x73, 0xAA, 0x70, 0xE9, 0x59, 0xFA, 0x5F,
+    0xD5, 0x9A, 0xEA, 0x79, 0xA9, 0x77, 0x70, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF,
+    0xD0, 0x77, 0x1A, 0xA6, 0x9E, 0x94, 0xAF, 0x93, 0xFD, 0x3A, 0xF9, 0x5A, 0x97, 0x77, 0x3F, 0xFD,
+    0x0F, 0xFD, 0x19, 0xAF, 0xA4, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F,
+    0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F,
+    0x93, 0x9A, 0xFC, 0xA9, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x39, 0xE7, 0xFC, 0x5F, 0xE3, 0xE9, 0x0A,
+    0xE1, 0xEA, 0x2A, 0xD9, 0x09, 0xA9, 0x4A, 0x97, 0x77, 0x1F, 0xFD, 0x1F, 0xFD, 0x29, 0xAF, 0xA5,
+    0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95,
+    0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x94, 0x9A, 0xFC, 0xA9, 0x1F,
+    0xFD, 0x1F, 0xFD, 0x00, 0x09, 0xAA, 0x92, 0xAA, 0x91, 0xF1, 0xF9, 0x9F, 0x1F, 0x90, 0xF1, 0xAE,
+    0x29, 0x49, 0x97, 0x77, 0x2F, 0xFD, 0x1F, 0xFD, 0x29, 0xAF, 0xA5, 0x9F, 0x95, 0x9F, 0x95, 0x9F,
+    0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F,
+    0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x94, 0x9A, 0xFC, 0xA9, 0x1F, 0xFD, 0x1F, 0xFD, 0x00, 0x49,
+    0x99, 0x99, 0x99, 0x97, 0x1F, 0xFF, 0xDA, 0x6F, 0xFF, 0xFA, 0x59, 0xAF, 0xA9, 0xAA, 0xFE, 0x59,
+    0xF9, 0x3A, 0xFC, 0xA4, 0x9F, 0x94, 0x9F, 0xC9, 0x39, 0xF9, 0x5A, 0xFA, 0x39, 0xF9, 0x6F, 0xC3,
+    0x9F, 0x96, 0xFC, 0x39, 0xF9, 0x6A, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0x99, 0xFF, 0xE9, 0x2A, 0xF3,
+    0x9F, 0x96, 0xAF, 0x39, 0xF9, 0x6F, 0xC3, 0x9F, 0x96, 0xFA, 0x39, 0xF9, 0x5A, 0xF4, 0x9F, 0x94,
+    0x9F, 0xA4, 0x9F, 0x92, 0x9A, 0xFA, 0x49, 0xAF, 0xFF, 0xCA, 0x4F, 0xFF, 0xE9, 0x5F, 0xFF, 0xA7,
+    0x77, 0x50, 0x70, 0x97, 0x74, 0xAE, 0xA1, 0xD7, 0x59, 0xFC, 0xAA, 0xD7, 0x59, 0xDA, 0xFD, 0x76,
+    0xCA, 0x1F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF,
+    0xDA, 0x49, 0xAF, 0x94, 0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5, 0xEA, 0x5A, 0xFE, 0xA4, 0xEA, 0x5A,
+    0xFF, 0x93, 0xEA, 0x5A, 0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F, 0xCA, 0x2E, 0xA5, 0xAE, 0x1F, 0xC9,
+    0x1E, 0xA5, 0xAE, 0x19, 0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC, 0x0E, 0xA5, 0xAE, 0x3F, 0xC9, 0xEA,
+    0x5A, 0xE3, 0x9F, 0xFA, 0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49,
+    0xFA, 0x94, 0xAF, 0xCA, 0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0xA7, 0x72, 0x99, 0x94, 0x77,
+    0x72, 0x9C, 0x77, 0x2E, 0xA7, 0x70, 0xFC, 0x77, 0xAF, 0xC9, 0x76, 0x9A, 0xF7, 0x72, 0x99, 0x77,
+    0x77, 0x49, 0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9,
+    0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F,
+    0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A,
+    0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2,
+    0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99,
+    0x99, 0x70, 0x77, 0x77, 0x09, 0xC7, 0x71, 0xEA, 0x76, 0x9F, 0xA7, 0x5A, 0xFC, 0x97, 0x49, 0xFA,
+    0x77, 0xA9, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD,
+    0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97,
+    0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F,
+    0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F,
+    0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF,
+    0xA7, 0x49, 0x99, 0x99, 0x70, 0x70, 0xE7, 0x70, 0xFC, 0x97, 0x5A, 0xFD, 0x97, 0x3A, 0xDA, 0x09,
+    0xE7, 0x2A, 0xDA, 0x29, 0xDA, 0x72, 0xAA, 0x49, 0x97, 0x77, 0x72, 0x9A, 0xAA, 0xA9, 0x73, 0x9F,
+    0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93, 0xAF, 0x94, 0xFD, 0x29, 0xF9, 0x6F,
+    0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9, 0x70, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9,
+    0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF, 0x9A, 0xF9, 0x70, 0xAF, 0x09, 0xFA,
+    0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29, 0xFC, 0xA4, 0xAF, 0x4A, 0xFE, 0xAF,
+    0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x79, 0x77, 0x1A, 0xEA,
+    0x1C, 0xA7, 0x29, 0xFC, 0xAE, 0x72, 0xAD, 0xAF, 0xD7, 0x3C, 0xA1, 0xF9, 0x77, 0x77, 0x77, 0x79,
+    0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9,
+    0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A,
+    0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF,
+    0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA,
+    0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70,
+    0x5A, 0xA9, 0x2A, 0xAA, 0x72, 0xF9, 0x0A, 0xEA, 0x71, 0xF9, 0x0F, 0xA7, 0x1F, 0x19, 0xE9, 0x72,
+    0x99, 0x49, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD,
+    0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97,
+    0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F,
+    0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F,
+    0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF,
+    0xA7, 0x49, 0x99, 0x99, 0x70, 0x1A, 0x5A, 0x91, 0x9D, 0xA3, 0xAD, 0x90, 0xAE, 0xA1, 0xAE, 0xA1,
+    0xAE, 0xAA, 0xEA, 0x3A, 0xFE, 0x5A, 0xFC, 0x69, 0xFA, 0x59, 0xFD, 0x93, 0x9F, 0xF9, 0x19, 0xF1,
+    0xF9, 0x0A, 0xE3, 0xEA, 0x1A, 0xC5, 0xCA, 0x76, 0x70, 0x9A, 0xAA, 0xA9, 0x49, 0x79, 0xFF, 0xCA,
+    0x1A, 0xD5, 0xAF, 0xFF, 0xE9, 0x4F, 0xDA, 0xAA, 0xFE, 0x94, 0xAF, 0x94, 0xFD, 0x49, 0xF9, 0x6F,
+    0xCA, 0x3F, 0xC6, 0xAF, 0xD3, 0xF9, 0x5A, 0xFE, 0x29, 0xF9, 0x4A, 0xD9, 0xFC, 0x91, 0xAF, 0x4A,
+    0xD9, 0x0A, 0xF9, 0x1A, 0xF3, 0xAD, 0x91, 0xAF, 0x91, 0xFC, 0x2A, 0xD9, 0x29, 0xF9, 0x1F, 0xC1,
+    0xAD, 0x93, 0xAF, 0x91, 0xAF, 0x9A, 0xD9, 0x4A, 0xF2, 0xAF, 0xE9, 0x5F, 0xC3, 0xFD, 0x96, 0xF9,
+    0x3F, 0xCA, 0x6F, 0xC4, 0x9F, 0xCA, 0x4A, 0xF9, 0x4A, 0xFF, 0xAF, 0xD9, 0x4A, 0xDA, 0xFF, 0xF9,
+    0x5D, 0x19, 0xAF, 0xFA, 0x76, 0x99, 0xA9, 0x97, 0x10, 0x77, 0x76, 0xC9, 0x77, 0x3A, 0xDA, 0x77,
+    0x2A, 0xF9, 0x77, 0x09, 0xFC, 0xA7, 0x71, 0xAF, 0x97, 0x73, 0x9A, 0x77, 0x77, 0x77, 0x69, 0xFF,
+    0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F,
+    0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F,
+    0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA,
+    0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70, 0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A,
+    0x99, 0x70, 0x77, 0x77, 0x4C, 0x97, 0x72, 0xAE, 0x77, 0x1F, 0xC7, 0x79, 0xFC, 0xA7, 0x7F, 0xA9,
+    0x77, 0x09, 0x97, 0x77, 0x77, 0x77, 0x19, 0xFF, 0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9,
+    0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5,
+    0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC,
+    0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70,
+    0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x70, 0x71, 0xAD, 0xA7, 0x71, 0x9F, 0xA7,
+    0x79, 0xFD, 0xA7, 0x59, 0xE1, 0xEA, 0x73, 0x9E, 0x3E, 0x74, 0xAA, 0x5A, 0x77, 0x77, 0x77, 0x49,
+    0xFF, 0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC,
+    0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F,
+    0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A,
+    0xEA, 0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70, 0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69,
+    0x9A, 0x99, 0x70, 0x6A, 0xAA, 0x29, 0xAA, 0x74, 0xAE, 0xA0, 0x9F, 0x73, 0xFA, 0x09, 0xF7, 0x39,
+    0xE9, 0x1E, 0xA7, 0x59, 0x49, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2,
+    0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F,
+    0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7,
+    0xF5, 0xFC, 0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF,
+    0xFE, 0x70, 0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x70, 0x77, 0x77, 0x09, 0xC7,
+    0x71, 0xEA, 0x76, 0x9F, 0xA7, 0x5A, 0xFC, 0x75, 0x9F, 0xA7, 0x7A, 0x97, 0x77, 0x77, 0x74, 0x9F,
+    0xFC, 0x1A, 0xFE, 0xAA, 0xFF, 0xA1, 0xAF, 0xE9, 0x09, 0xFD, 0x94, 0xFA, 0x4F, 0xC5, 0xF5, 0x9F,
+    0xA3, 0x9E, 0x7F, 0xC3, 0xEA, 0x70, 0xFA, 0x19, 0xE7, 0x1A, 0xF1, 0xE9, 0x72, 0xFA, 0x9E, 0x73,
+    0x9F, 0xE7, 0x5F, 0xDA, 0x76, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x76, 0xAF, 0xCA, 0x97, 0x29, 0xFF, 0xD7, 0x1A, 0xFF, 0xCA, 0x40, 0x77, 0x0F, 0xFD, 0x6F, 0xFC,
+    0x97, 0x0A, 0xF7, 0x39, 0xF9, 0x99, 0x70, 0x9F, 0xFD, 0xA4, 0x9F, 0xFF, 0x92, 0x9F, 0x90, 0x9A,
+    0xFC, 0x29, 0xF3, 0x9F, 0xA1, 0x9F, 0x4F, 0xA1, 0x9F, 0x4F, 0xC1, 0x9F, 0x4F, 0xA1, 0x9F, 0x4F,
+    0x91, 0x9F, 0x3A, 0xF2, 0x9F, 0x99, 0x9F, 0xC9, 0x29, 0xFF, 0xE9, 0x39, 0xFF, 0xA9, 0x59, 0xF7,
+    0x3A, 0xF9, 0x70, 0xAF, 0xFC, 0x6F, 0xFD, 0x60, 0x79, 0xAA, 0xAA, 0x97, 0x2A, 0xFF, 0x97, 0xFF,
+    0xE6, 0xAF, 0x90, 0x9F, 0xA4, 0x9F, 0x39, 0xF4, 0xF9, 0x4E, 0xA4, 0xF5, 0xEA, 0x4F, 0x4F, 0x49,
+    0xF2, 0x9E, 0xA5, 0x9F, 0x2E, 0x96, 0x9F, 0x1A, 0xE7, 0x9F, 0x1F, 0x79, 0xF1, 0xFC, 0x95, 0x9F,
+    0x1A, 0xFC, 0xA4, 0x9F, 0x2F, 0xDA, 0x39, 0xF3, 0xAF, 0xCA, 0x29, 0xF4, 0xAF, 0xC2, 0x9F, 0x59,
+    0xF9, 0x19, 0xF1, 0xA9, 0x2F, 0x91, 0x9F, 0x0A, 0xCA, 0x2F, 0x2A, 0xF0, 0xEA, 0x0A, 0xEA, 0x09,
+    0xFD, 0x0F, 0xFC, 0x1A, 0xFD, 0x1F, 0xDA, 0x74, 0x99, 0x99, 0x40, 0x77, 0x29, 0xC9, 0x74, 0xE7,
+    0x4F, 0x73, 0x9E, 0xA7, 0x39, 0xE9, 0x74, 0xAC, 0x97, 0x59, 0x77, 0x74, 0x99, 0xA9, 0x97, 0x0A,
+    0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F,
+    0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F,
+    0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99,
+    0x94, 0x99, 0x20, 0x77, 0x69, 0xCA, 0x74, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x2A, 0xDA, 0x73, 0x9C,
+    0xA7, 0x59, 0x77, 0x75, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3,
+    0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE,
+    0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F,
+    0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x20, 0x59, 0x97, 0x4F, 0x72, 0x9F,
+    0xC7, 0x1E, 0xAD, 0xA7, 0xE1, 0xE9, 0x59, 0xD9, 0x2D, 0xA6, 0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A,
+    0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29,
+    0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA,
+    0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09,
+    0xF9, 0x39, 0x99, 0x49, 0x92, 0x29, 0xAA, 0x91, 0x9A, 0x69, 0xF9, 0x0A, 0xCA, 0x5F, 0xFC, 0xA5,
+    0xD9, 0x0A, 0xF7, 0xA2, 0xAC, 0xA9, 0x77, 0x77, 0x71, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F,
+    0xFD, 0x4F, 0xA9, 0x9F, 0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC,
+    0x49, 0xFF, 0xD3, 0xAF, 0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A,
+    0xFA, 0xAF, 0xDA, 0xA0, 0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x20,
+    0x77, 0x1A, 0xDA, 0x1A, 0xDA, 0x49, 0xF1, 0xF4, 0x9F, 0x1F, 0x5A, 0xCA, 0x29, 0xCA, 0x97, 0x77,
+    0x77, 0x09, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF,
+    0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91,
+    0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90,
+    0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x77, 0x39, 0xF9, 0x71, 0xDA, 0xE7, 0x0D, 0xA1,
+    0xDA, 0x7D, 0x91, 0xAC, 0xA7, 0xDA, 0x1D, 0xA7, 0x9F, 0xD7, 0x19, 0xEA, 0x77, 0x73, 0x99, 0xA9,
+    0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F,
+    0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2,
+    0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F,
+    0x93, 0x99, 0x94, 0x99, 0x20, 0x49, 0x9A, 0x94, 0x99, 0xA9, 0x6A, 0xFD, 0xA0, 0x9F, 0xDA, 0x3F,
+    0xFF, 0xFE, 0x1F, 0xA9, 0x9F, 0xD9, 0x99, 0xF9, 0x0E, 0xA2, 0xAF, 0x3A, 0xF0, 0xE9, 0x2A, 0xEA,
+    0x39, 0xF7, 0x9E, 0xA9, 0x99, 0xAA, 0xF4, 0x9A, 0xAF, 0xFF, 0xD1, 0x9F, 0xFF, 0xEA, 0xAA, 0x90,
+    0xAF, 0xCA, 0xAE, 0xA7, 0x09, 0xF9, 0x19, 0xEA, 0x70, 0xAE, 0xA3, 0xF7, 0x0F, 0xA3, 0xFC, 0x94,
+    0x99, 0xAF, 0xCA, 0xFF, 0xFD, 0xA9, 0xFF, 0xCA, 0xFF, 0xD9, 0x09, 0xFD, 0xA2, 0xFF, 0x93, 0x99,
+    0x99, 0x69, 0x99, 0x93, 0x59, 0x9A, 0x97, 0xFE, 0xA3, 0x9F, 0xFC, 0xA1, 0x9F, 0xA9, 0xFC, 0x1F,
+    0x92, 0xF0, 0x9F, 0x3E, 0x90, 0xAE, 0xA3, 0x99, 0x2F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xC7,
+    0x0A, 0xFA, 0x79, 0xFC, 0xA4, 0xA1, 0xFF, 0xF2, 0xFF, 0xE3, 0xAF, 0xEA, 0x69, 0x99, 0x99, 0x71,
+    0xAA, 0x97, 0x1F, 0xC7, 0x09, 0xAE, 0x72, 0xE7, 0x1A, 0xDA, 0x70, 0xAD, 0xA7, 0x19, 0xA9, 0x50,
+    0x77, 0x1A, 0xC7, 0x2A, 0xDA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xAE, 0x72, 0x9D, 0x77, 0x77, 0x69,
+    0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE,
+    0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x0F, 0x97,
+    0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x30,
+    0x77, 0x5D, 0x72, 0xAD, 0xA7, 0x1E, 0xA7, 0x0A, 0xE7, 0x1E, 0x72, 0xD7, 0x77, 0x77, 0x9A, 0x99,
+    0x69, 0xFE, 0xA3, 0xAF, 0xFC, 0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9, 0xEA, 0x3A, 0xEA, 0xAE,
+    0xA3, 0xAE, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x90, 0xF9, 0x70, 0xAF,
+    0x70, 0x9F, 0xA5, 0x91, 0xFF, 0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x69, 0x97,
+    0x19, 0xEA, 0x70, 0xFC, 0x96, 0xAD, 0xAE, 0x59, 0xDA, 0x09, 0xDA, 0x4E, 0x2A, 0xD4, 0x9A, 0x4A,
+    0x77, 0x69, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E,
+    0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99,
+    0x99, 0x30, 0x77, 0x9E, 0x19, 0xE3, 0xF9, 0x0F, 0xA2, 0xF9, 0x0A, 0xE9, 0x3A, 0xC9, 0x2A, 0xCA,
+    0x77, 0x77, 0x39, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA,
+    0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99,
+    0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96,
+    0x99, 0x99, 0x30, 0x73, 0xCA, 0x6A, 0xDA, 0x5A, 0xE9, 0x5F, 0x6A, 0xE6, 0x9D, 0x77, 0x73, 0x99,
+    0x3A, 0xFC, 0xA1, 0x9F, 0xDA, 0x29, 0xAF, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F,
+    0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x39, 0xFC, 0x91, 0xFF, 0xA0, 0xFF, 0xA0, 0x77, 0xD6, 0xAD, 0xA5,
+    0xEA, 0x4A, 0xE5, 0xE6, 0xD7, 0x77, 0x49, 0x93, 0xAF, 0xCA, 0x19, 0xFD, 0xA2, 0x9A, 0xFA, 0x4F,
+    0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA3, 0x9F, 0xC9, 0x1F,
+    0xFA, 0x0F, 0xFA, 0x49, 0x96, 0x9E, 0x95, 0xFC, 0x93, 0xAD, 0xAE, 0x29, 0xDA, 0x09, 0xDA, 0x1E,
+    0x2A, 0xD1, 0x9A, 0x4A, 0x77, 0x19, 0x94, 0xAF, 0xCA, 0x29, 0xFD, 0xA3, 0x9A, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA4, 0x9F, 0xC9, 0x2F, 0xFA,
+    0x1F, 0xFA, 0x00, 0x72, 0x9E, 0x19, 0xE0, 0xF9, 0x0F, 0x9F, 0x90, 0xF9, 0x9A, 0xC9, 0x2A, 0xCA,
+    0x77, 0x73, 0x99, 0x4A, 0xFC, 0xA2, 0x9F, 0xDA, 0x39, 0xAF, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x49, 0xFC, 0x92, 0xFF, 0xA1, 0xFF, 0xA0, 0x77,
+    0x4A, 0xC2, 0xD7, 0xAE, 0xAD, 0xA7, 0xAF, 0xC9, 0x71, 0xAF, 0xA7, 0x0F, 0xEA, 0x7C, 0xA1, 0xF9,
+    0x73, 0xF7, 0x09, 0x90, 0x9E, 0xA4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE9, 0x19, 0xFA, 0x9A, 0xFD, 0x1F,
+    0xA2, 0x9F, 0xC0, 0x9F, 0x4A, 0xF0, 0xAF, 0x49, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x5F, 0x9F, 0xC4,
+    0x9F, 0x9F, 0xC4, 0x9F, 0x0A, 0xF9, 0x3A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xA3, 0xFF,
+    0xDA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x59, 0xAC, 0x92, 0xA7, 0x29, 0xFA, 0x0A, 0xCA, 0x71,
+    0xAF, 0xFC, 0x71, 0xAC, 0xA0, 0xAF, 0x97, 0x2A, 0x29, 0xAA, 0x97, 0x77, 0x77, 0x71, 0x99, 0x92,
+    0x99, 0xA9, 0x6A, 0xFC, 0x09, 0xFD, 0x93, 0x9F, 0xDA, 0xFF, 0x93, 0xAA, 0xFF, 0xFC, 0xA5, 0xFC,
+    0x92, 0xFC, 0x5F, 0xA3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3,
+    0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0xAF, 0x92, 0xAF, 0xE1,
+    0xFF, 0x1F, 0xF1, 0xFF, 0x00, 0x77, 0x39, 0xC7, 0x5E, 0x74, 0xF7, 0x3A, 0xEA, 0x73, 0x9E, 0x97,
+    0x4D, 0x97, 0x77, 0x77, 0x39, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF,
+    0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9,
+    0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3,
+    0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x79, 0xC9, 0x74, 0xE7, 0x3A, 0xE7, 0x3E,
+    0x97, 0x2A, 0xDA, 0x73, 0xAC, 0xA7, 0x77, 0x77, 0x49, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD,
+    0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4,
+    0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9,
+    0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x69, 0xA7, 0x4F, 0x72,
+    0xAF, 0xC7, 0x1F, 0xDA, 0x7E, 0x1E, 0x6A, 0xD9, 0x2D, 0xA6, 0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A,
+    0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4,
+    0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0,
+    0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99,
+    0x99, 0x60, 0x39, 0xAA, 0x91, 0x99, 0x6A, 0xF9, 0x0D, 0x95, 0xFF, 0xC9, 0x5D, 0x90, 0xFC, 0x7A,
+    0x2A, 0xCA, 0x77, 0x77, 0x72, 0x99, 0xA9, 0x97, 0x9F, 0xFA, 0x49, 0xFF, 0xDA, 0x29, 0xFA, 0x9A,
+    0xFC, 0x91, 0xFA, 0x3F, 0xC0, 0x9F, 0x4A, 0xF0, 0xAF, 0x49, 0xF9, 0xFC, 0x49, 0xF9, 0xFA, 0x5F,
+    0x9F, 0xC4, 0x9F, 0x9F, 0xC4, 0x9F, 0x0A, 0xF4, 0xAF, 0x09, 0xFC, 0x3F, 0x91, 0xFD, 0xAA, 0xFC,
+    0x3F, 0xFE, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x77, 0x2E, 0x91, 0xAD, 0xA4, 0x9F, 0x09, 0xF4,
+    0x9F, 0x09, 0xF5, 0xAC, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x19, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F,
+    0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F,
+    0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3,
+    0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x69, 0x72, 0xAE,
+    0x71, 0xF7, 0x1F, 0x72, 0xAA, 0x77, 0x39, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x77, 0x39, 0xDA, 0x71, 0xF7, 0x1F, 0x71, 0x9D, 0x94, 0x69, 0x9A, 0x99, 0x70, 0x9F,
+    0xFA, 0x9C, 0x92, 0x9F, 0xFF, 0x91, 0x9F, 0x90, 0x9F, 0xCA, 0x2F, 0x93, 0xFC, 0x19, 0xF3, 0xAF,
+    0xC1, 0xAE, 0xA2, 0xAF, 0xD9, 0x0F, 0xA1, 0xAD, 0x9F, 0x90, 0xFA, 0x0A, 0xD9, 0x0F, 0x90, 0xFA,
+    0xAD, 0x91, 0xF9, 0x0F, 0xE9, 0x2F, 0x1A, 0xFC, 0x92, 0x9F, 0x19, 0xFC, 0x3F, 0x92, 0xFD, 0x99,
+    0xFC, 0x2A, 0xFF, 0xF3, 0xD9, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x60, 0x77, 0x71, 0xAC, 0x77, 0x0A,
+    0xDA, 0x77, 0xAE, 0x97, 0x7F, 0x77, 0x0A, 0xE7, 0x70, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xFC,
+    0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF,
+    0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39, 0x94, 0x77, 0x75, 0xD7, 0x70, 0x9D, 0xA7, 0x7E, 0xA7, 0x6A,
+    0xE7, 0x7E, 0x77, 0x0D, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F,
+    0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA,
+    0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39,
+    0x94, 0x70, 0x99, 0x77, 0x9E, 0xA7, 0x6F, 0xC9, 0x74, 0xAD, 0xAE, 0x73, 0x9D, 0xA0, 0x9E, 0x72,
+    0xE2, 0xAD, 0x72, 0x9A, 0x4A, 0x97, 0x77, 0x77, 0x6A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F,
+    0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA,
+    0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39,
+    0x94, 0x77, 0x79, 0xE2, 0xE7, 0x1F, 0x90, 0xAE, 0xA7, 0x0F, 0x90, 0xAE, 0xA7, 0x1A, 0xCA, 0x2A,
+    0xCA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9, 0x29, 0xAF,
+    0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x5F,
+    0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39, 0x94, 0x77, 0x73,
+    0x9C, 0xA7, 0x7E, 0x97, 0x59, 0xE9, 0x75, 0xEA, 0x75, 0xAD, 0xA7, 0x69, 0xCA, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4, 0xEA,
+    0x4F, 0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70,
+    0xAE, 0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x75,
+    0x9E, 0x97, 0x5F, 0x74, 0x9F, 0x70, 0x9A, 0xAA, 0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19, 0xFD, 0x97,
+    0x3A, 0xDA, 0x97, 0x40, 0x49, 0x97, 0x3A, 0xFC, 0x72, 0xFE, 0x72, 0x9A, 0xFC, 0x74, 0x9F, 0x74,
+    0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x29, 0xA9, 0x69, 0xF9, 0xFE, 0x49, 0xFF, 0xFC, 0x39, 0xFF, 0xFC,
+    0x92, 0x9F, 0xA2, 0xAF, 0xA2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A,
+    0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xEA, 0x29, 0xF4, 0xF9, 0x29, 0xF3, 0xAF, 0x39, 0xFC, 0xAA,
+    0xFC, 0x93, 0x9F, 0xFE, 0xA4, 0x9F, 0xFD, 0x95, 0x9F, 0x99, 0x99, 0x70, 0x9F, 0x74, 0x9F, 0x74,
+    0x9F, 0x73, 0x9F, 0xDA, 0x70, 0x9F, 0xFA, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x6A, 0xDA,
+    0x1A, 0xDA, 0x70, 0xF1, 0xF7, 0x0F, 0x1F, 0x70, 0x9C, 0xA9, 0x19, 0xCA, 0x97, 0x77, 0x77, 0x77,
+    0x59, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4, 0xEA, 0x4F,
+    0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70, 0xAE,
+    0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x75, 0x9E,
+    0x97, 0x5F, 0x74, 0x9F, 0x70, 0x9A, 0xAA, 0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x3A,
+    0xDA, 0x97, 0x40, 0x5A, 0xFF, 0x97, 0x4F, 0xFC, 0x97, 0x4F, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x09,
+    0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD,
+    0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7,
+    0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69,
+    0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC,
+    0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x1A, 0xFF, 0xA5, 0xFF, 0xD5,
+    0xFF, 0xC9, 0x77, 0x77, 0x70, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F,
+    0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF,
+    0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0,
+    0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x20, 0x69, 0x77, 0x4D, 0x94,
+    0xCA, 0x74, 0xEA, 0x99, 0x9D, 0xA7, 0x4A, 0xFF, 0x76, 0xAF, 0xD7, 0x71, 0x9A, 0x97, 0x77, 0x77,
+    0x49, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75,
+    0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A,
+    0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA,
+    0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59,
+    0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x29, 0x75, 0xAC, 0xA4,
+    0xCA, 0x5E, 0xA9, 0x09, 0xDA, 0x5A, 0xFF, 0x7A, 0xFC, 0xA7, 0x29, 0x99, 0x77, 0x74, 0x99, 0xA9,
+    0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F,
+    0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2,
+    0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F,
+    0x93, 0x99, 0x94, 0x99, 0x20, 0x72, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA,
+    0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73,
+    0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A,
+    0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E,
+    0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F,
+    0xFC, 0x77, 0x9E, 0x77, 0x1A, 0xDA, 0x77, 0x2E, 0x97, 0x72, 0xEA, 0x77, 0x2F, 0xD9, 0x77, 0x9F,
+    0xC7, 0x73, 0x94, 0x49, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E,
+    0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2,
+    0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF,
+    0xFD, 0x19, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x93, 0xE7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0xA7, 0x3F,
+    0xD9, 0x71, 0xAF, 0x77, 0x00, 0x77, 0x74, 0xAA, 0x74, 0x9E, 0x73, 0xAF, 0x97, 0x1F, 0xD7, 0x1A,
+    0xEA, 0x97, 0x3A, 0x97, 0x77, 0x79, 0xAA, 0xAA, 0x97, 0x9F, 0xFD, 0x4F, 0xFF, 0x92, 0xFD, 0xAA,
+    0xAF, 0x91, 0xAF, 0x94, 0xE9, 0x09, 0xF9, 0x5E, 0x90, 0xFC, 0x6A, 0xD1, 0xF9, 0x79, 0x19, 0xF7,
+    0x3A, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7, 0x29, 0xFC, 0x97,
+    0x2F, 0xD9, 0x71, 0x9F, 0xEA, 0x99, 0x9A, 0xAD, 0x1A, 0xFF, 0xFD, 0x2A, 0xFF, 0xF9, 0x4A, 0xFF,
+    0xC9, 0x70, 0x99, 0x99, 0x93, 0x77, 0x5C, 0xA7, 0x2A, 0xDA, 0x71, 0xEA, 0x70, 0xF7, 0x09, 0xE7,
+    0x2D, 0x77, 0x77, 0x79, 0x9A, 0x97, 0xFE, 0xA3, 0x9F, 0xFC, 0xA1, 0x9F, 0xA9, 0xFC, 0x1F, 0x92,
+    0xF0, 0x9F, 0x3E, 0x90, 0xAE, 0xA3, 0x99, 0x2F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xC7, 0x0A,
+    0xFA, 0x79, 0xFC, 0xA4, 0xA1, 0xFF, 0xF2, 0xFF, 0xE3, 0xAF, 0xEA, 0x69, 0x99, 0x99, 0x30, 0x79,
+    0xE7, 0x4F, 0xC7, 0x2F, 0xE7, 0x0E, 0x90, 0xAE, 0x6E, 0x92, 0xAD, 0x69, 0xA9, 0x4A, 0x97, 0x77,
+    0x29, 0xAA, 0xAA, 0x97, 0x9F, 0xFD, 0x4F, 0xFF, 0x92, 0xFD, 0xAA, 0xAF, 0x91, 0xAF, 0x94, 0xE9,
+    0x09, 0xF9, 0x5E, 0x90, 0xFC, 0x6A, 0xD1, 0xF9, 0x79, 0x19, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3F,
+    0xC7, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7, 0x29, 0xFC, 0x97, 0x2F, 0xD9, 0x71, 0x9F, 0xEA,
+    0x99, 0x9A, 0xAD, 0x1A, 0xFF, 0xFD, 0x2A, 0xFF, 0xF9, 0x4A, 0xFF, 0xC9, 0x70, 0x99, 0x99, 0x93,
+    0x69, 0x97, 0x19, 0xE9, 0x70, 0xFC, 0x96, 0xAD, 0xAE, 0x59, 0xDA, 0x09, 0xDA, 0x4E, 0x2A, 0xD4,
+    0x9A, 0x4A, 0x77, 0x69, 0x9A, 0x97, 0xFE, 0xA3, 0x9F, 0xFC, 0xA1, 0x9F, 0xA9, 0xFC, 0x1F, 0x92,
+    0xF0, 0x9F, 0x3E, 0x90, 0xAE, 0xA3, 0x99, 0x2F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xC7, 0x0A,
+    0xFA, 0x79, 0xFC, 0xA4, 0xA1, 0xFF, 0xF2, 0xFF, 0xE3, 0xAF, 0xEA, 0x69, 0x99, 0x99, 0x30, 0x71,
+    0x97, 0x5F, 0x73, 0x9F, 0x97, 0x29, 0xF9, 0x73, 0xF7, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0x97, 0x9F,
+    0xFD, 0x4F, 0xFF, 0x92, 0xFD, 0xAA, 0xAF, 0x91, 0xAF, 0x94, 0xE9, 0x09, 0xF9, 0x5E, 0x90, 0xFC,
+    0x6A, 0xD1, 0xF9, 0x79, 0x19, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xF9,
+    0x72, 0xAF, 0xA7, 0x29, 0xFC, 0x97, 0x2F, 0xD9, 0x71, 0x9F, 0xEA, 0x99, 0x9A, 0xAD, 0x1A, 0xFF,
+    0xFD, 0x2A, 0xFF, 0xF9, 0x4A, 0xFF, 0xC9, 0x70, 0x99, 0x99, 0x93, 0x5A, 0xA9, 0x71, 0xF9, 0x70,
+    0xFA, 0x70, 0xF9, 0x70, 0x9A, 0xC9, 0x77, 0x77, 0x69, 0x9A, 0x97, 0xFE, 0xA3, 0x9F, 0xFC, 0xA1,
+    0x9F, 0xA9, 0xFC, 0x1F, 0x92, 0xF0, 0x9F, 0x3E, 0x90, 0xAE, 0xA3, 0x99, 0x2F, 0xA7, 0x0F, 0xA7,
+    0x0F, 0xA7, 0x0F, 0xC7, 0x0A, 0xFA, 0x79, 0xFC, 0xA4, 0xA1, 0xFF, 0xF2, 0xFF, 0xE3, 0xAF, 0xEA,
+    0x69, 0x99, 0x99, 0x30, 0x4A, 0xA4, 0x9C, 0xA6, 0xDA, 0x29, 0xE6, 0xF0, 0x9E, 0x70, 0xFE, 0x72,
+    0xFC, 0x74, 0xAD, 0x97, 0x77, 0x59, 0xAA, 0xAA, 0x97, 0x9F, 0xFD, 0x4F, 0xFF, 0x92, 0xFD, 0xAA,
+    0xAF, 0x91, 0xAF, 0x94, 0xE9, 0x09, 0xF9, 0x5E, 0x90, 0xFC, 0x6A, 0xD1, 0xF9, 0x79, 0x19, 0xF7,
+    0x3A, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7, 0x29, 0xFC, 0x97,
+    0x2F, 0xD9, 0x71, 0x9F, 0xEA, 0x99, 0x9A, 0xAD, 0x1A, 0xFF, 0xFD, 0x2A, 0xFF, 0xF9, 0x4A, 0xFF,
+    0xC9, 0x70, 0x99, 0x99, 0x93, 0x2A, 0x93, 0x9C, 0x93, 0xAD, 0x91, 0x9D, 0xA3, 0x9E, 0x1E, 0x5A,
+    0xFD, 0x7A, 0xFA, 0x70, 0xAE, 0x72, 0x99, 0x77, 0x71, 0x99, 0xA9, 0x7F, 0xEA, 0x39, 0xFF, 0xCA,
+    0x19, 0xFA, 0x9F, 0xC1, 0xF9, 0x2F, 0x09, 0xF3, 0xE9, 0x0A, 0xEA, 0x39, 0x92, 0xFA, 0x70, 0xFA,
+    0x70, 0xFA, 0x70, 0xFC, 0x70, 0xAF, 0xA7, 0x9F, 0xCA, 0x4A, 0x1F, 0xFF, 0x2F, 0xFE, 0x3A, 0xFE,
+    0xA6, 0x99, 0x99, 0x93, 0x3A, 0xC4, 0x9D, 0x72, 0xE2, 0x9E, 0x72, 0xAE, 0x09, 0xE7, 0x4F, 0xE7,
+    0x6F, 0xC9, 0x77, 0xAD, 0x97, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFD, 0xA5, 0xFF,
+    0xFF, 0xA4, 0x9A, 0xFA, 0x9A, 0xAF, 0xE4, 0x9F, 0x93, 0xAF, 0xCA, 0x39, 0xF9, 0x49, 0xFC, 0x92,
+    0x9F, 0x95, 0xAF, 0xA2, 0x9F, 0x96, 0xFC, 0x29, 0xF9, 0x6F, 0xC2, 0x9F, 0x96, 0xAF, 0x91, 0x9F,
+    0x96, 0xAF, 0x91, 0x9F, 0x96, 0xAF, 0x29, 0xF9, 0x6A, 0xF2, 0x9F, 0x96, 0xFC, 0x29, 0xF9, 0x6F,
+    0xA2, 0x9F, 0x95, 0xAF, 0x39, 0xF9, 0x49, 0xFA, 0x39, 0xF9, 0x29, 0xAF, 0xA3, 0x9A, 0xFF, 0xFC,
+    0xA3, 0xFF, 0xFE, 0x94, 0xFF, 0xFA, 0x77, 0x74, 0x73, 0x99, 0x29, 0x97, 0x0A, 0xFC, 0x91, 0xDA,
+    0x6A, 0xFD, 0x91, 0xDA, 0x69, 0xAF, 0xC9, 0x09, 0xD9, 0x71, 0xF9, 0x09, 0xD7, 0x2F, 0x90, 0xAC,
+    0xA7, 0x2F, 0x90, 0xAC, 0x96, 0x9A, 0x99, 0xF9, 0x19, 0x49, 0xFF, 0xD9, 0x6A, 0xFF, 0xE9, 0x59,
+    0xFA, 0x99, 0xAF, 0x95, 0xFA, 0x3F, 0x94, 0x9F, 0x4F, 0x94, 0xAF, 0x4F, 0x94, 0xFA, 0x4F, 0x94,
+    0xFA, 0x4F, 0x94, 0xFA, 0x4F, 0x94, 0xFC, 0x4F, 0x94, 0xFC, 0x4F, 0x94, 0xAF, 0xC2, 0xAF, 0x95,
+    0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xAF, 0xD4, 0xAF, 0xD1, 0xFD, 0x69, 0x99, 0x39, 0x96, 0x49, 0x99,
+    0x99, 0x99, 0x97, 0x1F, 0xFF, 0xDA, 0x6F, 0xFF, 0xFA, 0x59, 0xAF, 0xA9, 0xAA, 0xFE, 0x59, 0xF9,
+    0x3A, 0xFC, 0xA4, 0x9F, 0x94, 0x9F, 0xC9, 0x39, 0xF9, 0x5A, 0xFA, 0x39, 0xF9, 0x6F, 0xC3, 0x9F,
+    0x96, 0xFC, 0x39, 0xF9, 0x6A, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0x99, 0xFF, 0xE9, 0x2A, 0xF3, 0x9F,
+    0x96, 0xAF, 0x39, 0xF9, 0x6F, 0xC3, 0x9F, 0x96, 0xFA, 0x39, 0xF9, 0x5A, 0xF4, 0x9F, 0x94, 0x9F,
+    0xA4, 0x9F, 0x92, 0x9A, 0xFA, 0x49, 0xAF, 0xFF, 0xCA, 0x4F, 0xFF, 0xE9, 0x5F, 0xFF, 0xA7, 0x77,
+    0x50, 0x73, 0x99, 0x73, 0xAF, 0xC9, 0x71, 0xAF, 0xD9, 0x72, 0xAA, 0xF9, 0x74, 0xF9, 0x70, 0xFF,
+    0xE6, 0xAF, 0xFD, 0x72, 0xF9, 0x69, 0xAA, 0xDA, 0xF9, 0x5F, 0xFE, 0x94, 0xFF, 0xF9, 0x3F, 0xC9,
+    0x19, 0xF9, 0x29, 0xF9, 0x3F, 0x92, 0xAF, 0x4F, 0x92, 0xFA, 0x4F, 0x92, 0xFA, 0x4F, 0x92, 0xFA,
+    0x4F, 0x92, 0xFC, 0x4F, 0x92, 0xFC, 0x4F, 0x92, 0xAF, 0xC2, 0xAF, 0x93, 0xFF, 0xFC, 0xA9, 0x2A,
+    0xFF, 0xAF, 0xD2, 0xAF, 0xD1, 0xFD, 0x49, 0x99, 0x39, 0x94, 0x3F, 0xFC, 0x69, 0xFF, 0xC7, 0xFF,
+    0xC7, 0x77, 0x77, 0x76, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A,
+    0xD9, 0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA,
+    0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72,
+    0x9F, 0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF,
+    0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x2F, 0xFC, 0x39, 0xFF, 0xC3, 0x9F, 0xFC, 0x77, 0x77, 0x39,
+    0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE,
+    0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x0F, 0x97,
+    0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x30,
+    0x77, 0x4D, 0x49, 0xC6, 0x9E, 0x90, 0x9A, 0xD7, 0xFF, 0xA7, 0x0F, 0xDA, 0x72, 0x99, 0x99, 0x77,
+    0x77, 0x70, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19,
+    0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA,
+    0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97,
+    0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xF0, 0x39, 0x73, 0xD4, 0x9C, 0x39, 0xE9, 0x1A, 0xD4, 0xFF, 0x95, 0xFD, 0x97,
+    0x09, 0x97, 0x77, 0x19, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3,
+    0xFA, 0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99,
+    0x99, 0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF,
+    0x96, 0x99, 0x99, 0x30, 0x79, 0x75, 0x9E, 0x97, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xE9, 0x75, 0x97,
+    0x77, 0x77, 0x1F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A, 0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91,
+    0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA,
+    0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9, 0x99, 0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9,
+    0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F,
+    0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x59, 0xA9, 0x71, 0xF9, 0x70, 0xFA, 0x70, 0xFA, 0x71, 0xAC, 0xA7,
+    0x77, 0x76, 0x9A, 0x99, 0x69, 0xFE, 0xA3, 0xAF, 0xFC, 0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9,
+    0xEA, 0x3A, 0xEA, 0xAE, 0xA3, 0xAE, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99,
+    0x90, 0xF9, 0x70, 0xAF, 0x70, 0x9F, 0xA5, 0x91, 0xFF, 0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69,
+    0x99, 0x93, 0x77, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A, 0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD,
+    0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9, 0x99, 0x99, 0x94, 0x9F, 0x97, 0x29,
+    0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC,
+    0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x72, 0x9D, 0xA7, 0x39, 0xDA, 0x74, 0xE9, 0x74, 0xF7, 0x4F, 0xDA,
+    0x71, 0x9F, 0xC7, 0x59, 0x30, 0x59, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A,
+    0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE,
+    0x3A, 0xFF, 0x79, 0x9E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xEA, 0x71, 0xFD, 0x97, 0xAF, 0x76, 0x29,
+    0xC9, 0x4D, 0x95, 0xE3, 0xE9, 0x59, 0xE9, 0x0E, 0x97, 0xAF, 0xD9, 0x71, 0xAF, 0xA7, 0x39, 0xDA,
+    0x77, 0x77, 0x70, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9,
+    0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA,
+    0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F,
+    0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9,
+    0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x29, 0xA3, 0x9C, 0x93, 0x9D, 0x91, 0x9D, 0xA4, 0xE1, 0xE5, 0x9E,
+    0xAD, 0x96, 0xAF, 0xA7, 0x0A, 0xE7, 0x39, 0x77, 0x71, 0x9A, 0x99, 0x69, 0xFE, 0xA3, 0xAF, 0xFC,
+    0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9, 0xEA, 0x3A, 0xEA, 0xAE, 0xA3, 0xAE, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x90, 0xF9, 0x70, 0xAF, 0x70, 0x9F, 0xA5, 0x91, 0xFF,
+    0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x70, 0xAD, 0xA7, 0x69, 0xFA, 0x74, 0x9F,
+    0xDA, 0x73, 0xE1, 0xEA, 0x71, 0xE9, 0x2E, 0x71, 0xAA, 0x5A, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xA9,
+    0x97, 0x1A, 0xFF, 0xDA, 0x5A, 0xFF, 0xFC, 0x4A, 0xFD, 0xAA, 0xAA, 0xF3, 0xAF, 0xA5, 0xAE, 0x29,
+    0xFA, 0x69, 0xE2, 0xAF, 0x70, 0xD9, 0x2F, 0x97, 0x09, 0x39, 0xF7, 0x6A, 0xF7, 0x6A, 0xF7, 0x6F,
+    0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC5, 0xFF, 0x0A, 0xF9, 0x4A, 0xFE, 0x0A, 0xFA, 0x7F, 0xA0,
+    0x9F, 0xC7, 0xFA, 0x1F, 0xD6, 0xFA, 0x19, 0xFD, 0x94, 0xFA, 0x2A, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF,
+    0xD9, 0x5A, 0xFF, 0xD9, 0x72, 0x99, 0x99, 0x96, 0x79, 0x97, 0x59, 0xE9, 0x74, 0xFC, 0x97, 0x2A,
+    0xDA, 0xE7, 0x19, 0xDA, 0x09, 0xDA, 0x70, 0xE2, 0xAD, 0x70, 0x9A, 0x4A, 0x77, 0x75, 0x99, 0xA9,
+    0x91, 0x99, 0xA9, 0x4A, 0xFF, 0xF3, 0xAF, 0xFF, 0xC2, 0x9F, 0x90, 0x9F, 0x0A, 0xA2, 0xF3, 0xAE,
+    0x94, 0xF3, 0x9E, 0xA4, 0xF3, 0x9E, 0xA4, 0xF9, 0x2F, 0x94, 0x9F, 0xCA, 0xFC, 0x6A, 0xFF, 0xC7,
+    0xAF, 0xE9, 0x79, 0xE7, 0x5E, 0xA7, 0x5F, 0xFC, 0xAA, 0xA9, 0x4A, 0xFF, 0xFA, 0x39, 0xFF, 0xFC,
+    0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0xC9, 0x1F, 0x6F, 0x90, 0x9F, 0x59, 0xF1, 0x9F, 0xA9, 0x19, 0xAF,
+    0xA2, 0xFF, 0xFC, 0xA4, 0xFF, 0xE9, 0x69, 0xAA, 0xDA, 0xA9, 0x60, 0x69, 0x77, 0x1D, 0x94, 0xCA,
+    0x71, 0xEA, 0x99, 0xAD, 0xA7, 0x1A, 0xFF, 0x73, 0xAF, 0xD7, 0x69, 0xA9, 0x77, 0x77, 0x39, 0xAA,
+    0xAA, 0xA9, 0x97, 0x1A, 0xFF, 0xDA, 0x5A, 0xFF, 0xFC, 0x4A, 0xFD, 0xAA, 0xAA, 0xF3, 0xAF, 0xA5,
+    0xAE, 0x29, 0xFA, 0x69, 0xE2, 0xAF, 0x70, 0xD9, 0x2F, 0x97, 0x09, 0x39, 0xF7, 0x6A, 0xF7, 0x6A,
+    0xF7, 0x6F, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC5, 0xFF, 0x0A, 0xF9, 0x4A, 0xFE, 0x0A, 0xFA,
+    0x7F, 0xA0, 0x9F, 0xC7, 0xFA, 0x1F, 0xD6, 0xFA, 0x19, 0xFD, 0x94, 0xFA, 0x2A, 0xFF, 0xFE, 0xA3,
+    0xAF, 0xFF, 0xD9, 0x5A, 0xFF, 0xD9, 0x72, 0x99, 0x99, 0x96, 0x77, 0x49, 0xD4, 0x9C, 0x7A, 0xE9,
+    0x1A, 0xD7, 0x0F, 0xF9, 0x70, 0x9F, 0xD9, 0x74, 0x99, 0x77, 0x77, 0x09, 0x9A, 0x99, 0x19, 0x9A,
+    0x94, 0xAF, 0xFF, 0x3A, 0xFF, 0xFC, 0x29, 0xF9, 0x09, 0xF0, 0xAA, 0x2F, 0x3A, 0xE9, 0x4F, 0x39,
+    0xEA, 0x4F, 0x39, 0xEA, 0x4F, 0x92, 0xF9, 0x49, 0xFC, 0xAF, 0xC6, 0xAF, 0xFC, 0x7A, 0xFE, 0x97,
+    0x9E, 0x75, 0xEA, 0x75, 0xFF, 0xCA, 0xAA, 0x94, 0xAF, 0xFF, 0xA3, 0x9F, 0xFF, 0xC2, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xFC, 0x91, 0xF6, 0xF9, 0x09, 0xF5, 0x9F, 0x19, 0xFA, 0x91, 0x9A, 0xFA, 0x2F, 0xFF,
+    0xCA, 0x4F, 0xFE, 0x96, 0x9A, 0xAD, 0xAA, 0x96, 0x71, 0x97, 0x71, 0xEA, 0x76, 0xAF, 0x76, 0xAF,
+    0x76, 0x9E, 0xA7, 0x70, 0x97, 0x77, 0x74, 0x9A, 0xAA, 0xAA, 0x99, 0x71, 0xAF, 0xFD, 0xA5, 0xAF,
+    0xFF, 0xC4, 0xAF, 0xDA, 0xAA, 0xAF, 0x3A, 0xFA, 0x5A, 0xE2, 0x9F, 0xA6, 0x9E, 0x2A, 0xF7, 0x0D,
+    0x92, 0xF9, 0x70, 0x93, 0x9F, 0x76, 0xAF, 0x76, 0xAF, 0x76, 0xFC, 0x5A, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xFC, 0x5F, 0xF0, 0xAF, 0x94, 0xAF, 0xE0, 0xAF, 0xA7, 0xFA, 0x09, 0xFC, 0x7F, 0xA1, 0xFD, 0x6F,
+    0xA1, 0x9F, 0xD9, 0x4F, 0xA2, 0xAF, 0xFF, 0xEA, 0x3A, 0xFF, 0xFD, 0x95, 0xAF, 0xFD, 0x97, 0x29,
+    0x99, 0x99, 0x60, 0x6A, 0xA9, 0x75, 0xF9, 0x74, 0xFA, 0x74, 0xF9, 0x74, 0x9A, 0xC9, 0x77, 0x77,
+    0x77, 0x19, 0x9A, 0x99, 0x19, 0x9A, 0x94, 0xAF, 0xFF, 0x3A, 0xFF, 0xFC, 0x29, 0xF9, 0x09, 0xF0,
+    0xAA, 0x2F, 0x3A, 0xE9, 0x4F, 0x39, 0xEA, 0x4F, 0x39, 0xEA, 0x4F, 0x92, 0xF9, 0x49, 0xFC, 0xAF,
+    0xC6, 0xAF, 0xFC, 0x7A, 0xFE, 0x97, 0x9E, 0x75, 0xEA, 0x75, 0xFF, 0xCA, 0xAA, 0x94, 0xAF, 0xFF,
+    0xA3, 0x9F, 0xFF, 0xC2, 0x9E, 0xAA, 0xAA, 0xAA, 0xFC, 0x91, 0xF6, 0xF9, 0x09, 0xF5, 0x9F, 0x19,
+    0xFA, 0x91, 0x9A, 0xFA, 0x2F, 0xFF, 0xCA, 0x4F, 0xFE, 0x96, 0x9A, 0xAD, 0xAA, 0x96, 0x79, 0xAA,
+    0xAA, 0xA9, 0x97, 0x1A, 0xFF, 0xDA, 0x5A, 0xFF, 0xFC, 0x4A, 0xFD, 0xAA, 0xAA, 0xF3, 0xAF, 0xA5,
+    0xAE, 0x29, 0xFA, 0x69, 0xE2, 0xAF, 0x70, 0xD9, 0x2F, 0x97, 0x09, 0x39, 0xF7, 0x6A, 0xF7, 0x6A,
+    0xF7, 0x6F, 0xC5, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC5, 0xFF, 0x0A, 0xF9, 0x4A, 0xFE, 0x0A, 0xFA,
+    0x7F, 0xA0, 0x9F, 0xC7, 0xFA, 0x1F, 0xD6, 0xFA, 0x19, 0xFD, 0x94, 0xFA, 0x2A, 0xFF, 0xFE, 0xA3,
+    0xAF, 0xFF, 0xD9, 0x5A, 0xFF, 0xD9, 0x72, 0x99, 0x99, 0x97, 0x70, 0x9A, 0x97, 0x7F, 0x97, 0x7E,
+    0xA7, 0x7E, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x79, 0x97, 0x00, 0x7A, 0xC7, 0x6E, 0x75, 0x9D, 0xA7,
+    0x5E, 0x97, 0x5E, 0x76, 0xE9, 0x75, 0xF7, 0x59, 0xDA, 0x77, 0x77, 0x99, 0xA9, 0x91, 0x99, 0xA9,
+    0x4A, 0xFF, 0xF3, 0xAF, 0xFF, 0xC2, 0x9F, 0x90, 0x9F, 0x0A, 0xA2, 0xF3, 0xAE, 0x94, 0xF3, 0x9E,
+    0xA4, 0xF3, 0x9E, 0xA4, 0xF9, 0x2F, 0x94, 0x9F, 0xCA, 0xFC, 0x6A, 0xFF, 0xC7, 0xAF, 0xE9, 0x79,
+    0xE7, 0x5E, 0xA7, 0x5F, 0xFC, 0xAA, 0xA9, 0x4A, 0xFF, 0xFA, 0x39, 0xFF, 0xFC, 0x29, 0xEA, 0xAA,
+    0xAA, 0xAF, 0xC9, 0x1F, 0x6F, 0x90, 0x9F, 0x59, 0xF1, 0x9F, 0xA9, 0x19, 0xAF, 0xA2, 0xFF, 0xFC,
+    0xA4, 0xFF, 0xE9, 0x69, 0xAA, 0xDA, 0xA9, 0x60, 0x71, 0xAD, 0x97, 0x71, 0xAF, 0x97, 0x7A, 0xFD,
+    0x97, 0x59, 0xE0, 0x9E, 0x97, 0x39, 0xE2, 0x9D, 0xA7, 0x4A, 0xA4, 0x9A, 0x77, 0x77, 0x77, 0x4F,
+    0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xFF, 0xCA, 0x09, 0xAF, 0xA5, 0x9F, 0xCA, 0x39, 0xF9, 0x69, 0xF9,
+    0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9,
+    0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x39, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFF, 0xC9, 0x39,
+    0xFA, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9,
+    0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x29, 0xAF, 0xCA, 0x49, 0xFD, 0xA0,
+    0xFF, 0xD2, 0xFF, 0xFF, 0xF2, 0xFF, 0xD0, 0x59, 0x77, 0x0F, 0x76, 0xAF, 0xC7, 0x49, 0xEA, 0xE7,
+    0x3E, 0x1A, 0xE7, 0x1E, 0x3A, 0xD7, 0x29, 0x59, 0x77, 0x99, 0x75, 0xAF, 0xC9, 0x73, 0xFE, 0x97,
+    0x39, 0xAF, 0xC9, 0x75, 0x9F, 0x97, 0x59, 0xF9, 0x75, 0x9F, 0x76, 0x9F, 0x29, 0x9A, 0x97, 0x9F,
+    0x0A, 0xFD, 0x69, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x94, 0x9F, 0xC9, 0x19, 0xFA, 0x49, 0xF9, 0x3F,
+    0xA4, 0x9F, 0x93, 0xFA, 0x49, 0xF9, 0x3F, 0xA4, 0x9F, 0x93, 0xFA, 0x49, 0xF9, 0x3F, 0xA4, 0x9F,
+    0x93, 0xFA, 0x49, 0xF9, 0x3F, 0xA4, 0x9F, 0x93, 0xFA, 0x49, 0xF9, 0x3F, 0xC9, 0x2F, 0xF1, 0xFE,
+    0xA0, 0x9F, 0xEA, 0x09, 0xFE, 0xA0, 0x77, 0x71, 0xFF, 0xD2, 0xFF, 0xD1, 0xFF, 0xCA, 0x2F, 0xFC,
+    0xA2, 0x9A, 0xFA, 0x59, 0xAF, 0xA5, 0x9F, 0x96, 0x9F, 0x93, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFC, 0xAA, 0xA0, 0x9F, 0xFF, 0xFF, 0xE9, 0x09, 0x9A, 0xFA, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x99,
+    0x39, 0xF9, 0x69, 0xF9, 0x59, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x59, 0xFF, 0xFF, 0xC9, 0x59,
+    0xFF, 0xFF, 0xC9, 0x59, 0xFA, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x59, 0xF9, 0x69, 0xF9, 0x59, 0xF9,
+    0x69, 0xF9, 0x59, 0xF9, 0x69, 0xF9, 0x59, 0xF9, 0x69, 0xF9, 0x59, 0xF9, 0x69, 0xF9, 0x49, 0xAF,
+    0xCA, 0x49, 0xFD, 0xA2, 0xFF, 0xD2, 0xFF, 0xD1, 0xFF, 0xD2, 0xFF, 0xD0, 0x49, 0x97, 0x4A, 0xFC,
+    0x97, 0x2F, 0xE9, 0x72, 0x9A, 0xAF, 0x97, 0x49, 0xF9, 0x72, 0xAF, 0xFD, 0x7A, 0xFF, 0xCA, 0x71,
+    0x9F, 0x75, 0x9F, 0x19, 0xAD, 0xA6, 0x9F, 0x9F, 0xE9, 0x49, 0xFF, 0xFC, 0x49, 0xFD, 0xAA, 0xFC,
+    0x93, 0x9F, 0xA3, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F,
+    0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3, 0x9F, 0x93, 0xFC,
+    0x91, 0xFF, 0x1F, 0xEA, 0x9F, 0xEA, 0x09, 0xFE, 0xA0, 0x29, 0x7F, 0x90, 0x9C, 0x90, 0xAF, 0xCA,
+    0xE0, 0xEA, 0xFC, 0xA0, 0x9C, 0x91, 0xF7, 0x77, 0x72, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF,
+    0xD0, 0xFF, 0xD0, 0x1A, 0xCA, 0x2A, 0x2F, 0xC0, 0x9D, 0x09, 0xFF, 0xC0, 0x9D, 0x09, 0xFA, 0x19,
+    0x91, 0x9A, 0xC9, 0x77, 0x74, 0x99, 0x4A, 0xFC, 0xA2, 0x9F, 0xDA, 0x39, 0xAF, 0xA5, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x49, 0xFC, 0x92, 0xFF, 0xA1,
+    0xFF, 0xA0, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0xAF, 0xF9, 0x77, 0x77, 0x1F, 0xFD, 0x0F, 0xFD, 0x19,
+    0xAF, 0xA4, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94,
+    0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x93, 0x9A, 0xFC,
+    0xA9, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x0F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFC, 0x77, 0x73, 0x99,
+    0x4A, 0xFC, 0xA2, 0x9F, 0xDA, 0x39, 0xAF, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x49, 0xFC, 0x92, 0xFF, 0xA1, 0xFF, 0xA0, 0x09, 0x70, 0x9C, 0xA4,
+    0xD0, 0xAE, 0x90, 0x9E, 0x09, 0xFF, 0x91, 0x9F, 0xD9, 0x49, 0xA9, 0x97, 0x77, 0x1F, 0xFD, 0x0F,
+    0xFD, 0x19, 0xAF, 0xA4, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94,
+    0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x93,
+    0x9A, 0xFC, 0xA9, 0x0F, 0xFD, 0x0F, 0xFD, 0x00, 0x72, 0x9D, 0x49, 0xC0, 0xAE, 0x91, 0xAD, 0x1F,
+    0xF9, 0x2F, 0xD9, 0x59, 0x97, 0x74, 0x99, 0x4A, 0xFC, 0xA2, 0x9F, 0xDA, 0x39, 0xAF, 0xA5, 0xFA,
+    0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x49, 0xFC, 0x92, 0xFF,
+    0xA1, 0xFF, 0xA0, 0x72, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF, 0xD2, 0x9D, 0xA5,
+    0x9E, 0x6E, 0xA6, 0xF9, 0x5F, 0xDA, 0x4F, 0xC9, 0x69, 0x94, 0x39, 0x97, 0xFA, 0x49, 0xFC, 0x49,
+    0xFC, 0x5A, 0xE9, 0x77, 0x75, 0x99, 0x4A, 0xFC, 0xA2, 0x9F, 0xDA, 0x39, 0xAF, 0xA5, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x49, 0xFC, 0x92, 0xFF, 0xA1,
+    0xFF, 0xA6, 0xDA, 0x6E, 0x6A, 0xD9, 0x6E, 0xA6, 0xAF, 0xCA, 0x4A, 0xF7, 0x30, 0x49, 0x7F, 0x59,
+    0xF9, 0x49, 0xF9, 0x5F, 0x77, 0x77, 0x4F, 0xFD, 0x0F, 0xFD, 0x19, 0xAF, 0xA4, 0x9F, 0x94, 0x9F,
+    0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F,
+    0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x94, 0x9F, 0x93, 0x9A, 0xFC, 0xA9, 0x0F, 0xFD, 0x0F, 0xFD,
+    0x00, 0x49, 0x93, 0xAF, 0xCA, 0x19, 0xFD, 0xA2, 0x9A, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA,
+    0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA3, 0x9F, 0xC9, 0x1F, 0xFA, 0x0F, 0xFA, 0x77, 0x6F,
+    0xFD, 0x1F, 0xFD, 0x0F, 0xFD, 0x1F, 0xFD, 0x19, 0xAF, 0xA4, 0x9F, 0xCA, 0x93, 0x9F, 0x95, 0x9F,
+    0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F,
+    0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F,
+    0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F, 0x94, 0x9F, 0x95, 0x9F,
+    0x94, 0x9F, 0x95, 0x9F, 0x93, 0x9A, 0xFC, 0xA9, 0x39, 0xF3, 0xFF, 0xD3, 0x9F, 0x3F, 0xFD, 0x3A,
+    0xF7, 0x71, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x77, 0xFD, 0x77, 0x1E, 0xA7,
+    0x39, 0x97, 0x99, 0x4F, 0xA4, 0xF9, 0x19, 0xFC, 0x39, 0xFC, 0x19, 0xFC, 0x39, 0xFA, 0x2A, 0xE9,
+    0x4F, 0x77, 0x77, 0x71, 0x99, 0x79, 0x91, 0xAF, 0xCA, 0x2A, 0xFC, 0xA9, 0xFD, 0xA1, 0x9F, 0xDA,
+    0x09, 0xAF, 0xA2, 0x9A, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4,
+    0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA, 0x2F, 0xA4, 0xFA,
+    0x19, 0xFC, 0x93, 0xF9, 0x0F, 0xFA, 0x2F, 0x90, 0xFF, 0xA2, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4F,
+    0xA7, 0x3F, 0xC7, 0x2A, 0xFC, 0x97, 0x2F, 0xC9, 0x73, 0x9C, 0xAA, 0x40, 0x59, 0xDA, 0x70, 0x9F,
+    0xC7, 0xFE, 0x5E, 0x90, 0xEA, 0x3E, 0x92, 0xE3, 0x9A, 0x94, 0xA9, 0x77, 0x77, 0xFF, 0xD2, 0x9F,
+    0xFD, 0x39, 0xAF, 0xCA, 0x96, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F,
+    0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F,
+    0x70, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xFA, 0x7A, 0xF7, 0xAF, 0xA5, 0x9F, 0xD6, 0xFD, 0x79,
+    0xE9, 0x70, 0x59, 0x97, 0x0F, 0x69, 0xFC, 0x5E, 0xAD, 0xA3, 0xAD, 0x1E, 0x91, 0x9D, 0x92, 0xDA,
+    0x2A, 0x93, 0x99, 0x77, 0x29, 0x99, 0x49, 0xFD, 0x4A, 0xFD, 0x5A, 0xFC, 0x69, 0xF6, 0x9F, 0x69,
+    0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6,
+    0xAE, 0xA5, 0x9F, 0x94, 0x9F, 0xC3, 0x9F, 0xD4, 0x9F, 0xC9, 0x5A, 0xCA, 0x96, 0x77, 0x4F, 0xFC,
+    0xA1, 0xFF, 0x9F, 0xFC, 0x91, 0xFF, 0x19, 0xAF, 0x94, 0xFC, 0x49, 0xF4, 0xAF, 0x59, 0xF3, 0xAE,
+    0xA6, 0x9F, 0x2A, 0xEA, 0x79, 0xF1, 0xAE, 0xA7, 0x09, 0xF0, 0xAE, 0xA7, 0x19, 0xFF, 0x97, 0x29,
+    0xFF, 0xA7, 0x29, 0xFF, 0xC9, 0x71, 0x9F, 0x9F, 0xC9, 0x70, 0x9F, 0x09, 0xFC, 0x70, 0x9F, 0x19,
+    0xFC, 0x79, 0xF2, 0xAF, 0xC6, 0x9F, 0x3F, 0xD5, 0x9F, 0x4F, 0xD9, 0x29, 0xAF, 0xA9, 0x3F, 0xD9,
+    0x0F, 0xFD, 0x29, 0xFD, 0xAF, 0xFC, 0xA4, 0xFC, 0x97, 0x79, 0x99, 0x73, 0xAA, 0x77, 0x1F, 0x77,
+    0x0A, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x9E, 0x77, 0x1A, 0x97, 0x10, 0x49, 0x97, 0x4A,
+    0xFC, 0x73, 0xFE, 0x73, 0x9A, 0xFC, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F, 0x75, 0x9F,
+    0x1A, 0xFE, 0x39, 0xF1, 0x9F, 0xE3, 0x9F, 0x29, 0xF9, 0x49, 0xF2, 0xF6, 0x9F, 0x1F, 0x79, 0xF9,
+    0xF7, 0x09, 0xFF, 0xC7, 0x09, 0xF9, 0xF9, 0x79, 0xF0, 0xAF, 0x79, 0xF1, 0xFC, 0x69, 0xF1, 0x9F,
+    0xA5, 0x9F, 0x2A, 0xFA, 0x49, 0xF9, 0x2F, 0xCA, 0x2F, 0xF1, 0x9F, 0xCA, 0x09, 0xFF, 0x29, 0xFA,
+    0x76, 0x99, 0x73, 0x99, 0x77, 0xF7, 0x6A, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x75, 0x9E, 0x77, 0xA9,
+    0x70, 0x49, 0x97, 0x4A, 0xFC, 0xA1, 0xFE, 0x90, 0x9F, 0xDA, 0x1F, 0xE9, 0x19, 0xAF, 0xA2, 0xFA,
+    0x5F, 0xA1, 0xAE, 0x96, 0xFA, 0x09, 0xE9, 0x7F, 0xA9, 0xE9, 0x70, 0xFF, 0xC7, 0x1F, 0xFC, 0xA7,
+    0x0F, 0xA9, 0xF9, 0x7F, 0xA0, 0xFC, 0x7F, 0xA1, 0xFC, 0x6F, 0xA1, 0x9F, 0xC5, 0xFA, 0x2F, 0xD2,
+    0xAF, 0xE9, 0x1F, 0xD1, 0xFF, 0x92, 0xFC, 0x77, 0x99, 0x10, 0x77, 0x7A, 0xA7, 0x49, 0xE7, 0x3A,
+    0xF9, 0x71, 0xFD, 0x71, 0xAE, 0xA9, 0x73, 0xA9, 0x77, 0x77, 0x75, 0xFF, 0xD6, 0xFF, 0xCA, 0x79,
+    0xAF, 0xA7, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F,
+    0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5A, 0xC2, 0x9F,
+    0x95, 0xDA, 0x19, 0xF9, 0x4A, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9,
+    0xFF, 0xFF, 0x00, 0x69, 0x95, 0x9E, 0x4F, 0xC2, 0xAF, 0xCA, 0x19, 0xFA, 0x93, 0xA9, 0x77, 0x49,
+    0x93, 0xAF, 0xC9, 0x1A, 0xFD, 0x91, 0x9A, 0xFC, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9,
+    0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F,
+    0x93, 0x9F, 0xA1, 0x9F, 0xF9, 0xAF, 0xF9, 0x77, 0x0F, 0xFD, 0x6F, 0xFC, 0xA7, 0x9A, 0xFA, 0x72,
+    0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F,
+    0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xAC, 0x29, 0xF9, 0x5D, 0xA1,
+    0x9F, 0x94, 0xAD, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF7,
+    0x77, 0x0A, 0xA7, 0x49, 0xF7, 0x4A, 0xE7, 0x49, 0xE7, 0x4E, 0xA7, 0x3A, 0xDA, 0x75, 0xA9, 0x70,
+    0x49, 0x93, 0xAF, 0xC9, 0x1A, 0xFD, 0x91, 0x9A, 0xFC, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94,
+    0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9, 0x4F, 0x94, 0xF9,
+    0x4F, 0x93, 0x9F, 0xA1, 0x9F, 0xF9, 0xAF, 0xF9, 0x75, 0x99, 0x6F, 0x5A, 0xE9, 0x5E, 0x94, 0x9E,
+    0x5E, 0x6A, 0x94, 0x73, 0x99, 0x76, 0xE7, 0x5E, 0x1F, 0xFD, 0x1E, 0x1F, 0xFC, 0xA1, 0xD9, 0x29,
+    0xAF, 0xA3, 0xD4, 0x9F, 0x93, 0xCA, 0x49, 0xF9, 0x39, 0x59, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9,
+    0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5A,
+    0xC2, 0x9F, 0x95, 0xDA, 0x19, 0xF9, 0x4A, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F,
+    0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x49, 0x92, 0x99, 0x1A, 0xFC, 0x91, 0xDA, 0xAF, 0xD9, 0x09, 0xDA,
+    0x9A, 0xFC, 0x90, 0x9D, 0x92, 0xF9, 0x0A, 0xD3, 0xF9, 0x0A, 0xCA, 0x3F, 0x90, 0xAC, 0x4F, 0x91,
+    0x94, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97,
+    0xF9, 0x7F, 0x96, 0x9F, 0xA4, 0x9F, 0xF9, 0x2A, 0xFF, 0x92, 0x77, 0x0F, 0xFD, 0x6F, 0xFC, 0xA7,
+    0x9A, 0xFA, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x39, 0xDA, 0x29, 0xF9,
+    0x29, 0xF9, 0x19, 0xF9, 0x29, 0xF9, 0x19, 0xF9, 0x3F, 0x29, 0xF9, 0x39, 0xAA, 0x39, 0xF9, 0x72,
+    0x9F, 0x97, 0x29, 0xF9, 0x5A, 0xC2, 0x9F, 0x95, 0xDA, 0x19, 0xF9, 0x4A, 0xDA, 0x19, 0xF9, 0x4E,
+    0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x49, 0x97, 0x1A, 0xFC, 0x97, 0xAF,
+    0xD9, 0x79, 0xAF, 0xC9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x2A, 0xD9, 0x3F, 0x91, 0x9F, 0x3F, 0x91, 0xAF, 0x3F, 0x91, 0x9F, 0x3F, 0x93, 0x99,
+    0x4F, 0x97, 0x2F, 0x97, 0x2F, 0x97, 0x2F, 0x97, 0x2F, 0x97, 0x19, 0xFA, 0x79, 0xFF, 0x95, 0xAF,
+    0xF9, 0x50, 0x77, 0x4F, 0xFD, 0x70, 0xFF, 0xCA, 0x71, 0x9A, 0xFA, 0x74, 0x9F, 0x97, 0x49, 0xF9,
+    0x74, 0x9F, 0x97, 0x49, 0xF9, 0x09, 0xAA, 0x70, 0x9F, 0xAF, 0x70, 0x9F, 0xEA, 0x71, 0x9F, 0xC9,
+    0x71, 0x9A, 0xFC, 0x97, 0x1F, 0xF9, 0x71, 0xAC, 0xA9, 0xF9, 0x74, 0x9F, 0x95, 0xAC, 0x49, 0xF9,
+    0x5D, 0xA3, 0x9F, 0x94, 0xAD, 0xA3, 0x9F, 0x94, 0xEA, 0x29, 0xAF, 0xFF, 0xC9, 0x1F, 0xFF, 0xF9,
+    0x1F, 0xFF, 0xF0, 0x59, 0x95, 0xAF, 0xC9, 0x3A, 0xFD, 0x93, 0x9A, 0xFC, 0x96, 0xF9, 0x6F, 0x96,
+    0xF9, 0x6F, 0x96, 0xF9, 0xA9, 0x4F, 0xE4, 0xFD, 0x5F, 0xA5, 0xAF, 0x94, 0xFD, 0x93, 0xFE, 0x94,
+    0xA0, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x59, 0xFA, 0x39, 0xFF, 0x91, 0xAF, 0xF9, 0x00,
+    0x77, 0x77, 0x49, 0xC7, 0x74, 0xAD, 0xA7, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0xC9, 0x77, 0x9F, 0xA7,
+    0x72, 0xA9, 0x77, 0x77, 0x77, 0x75, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF, 0xDA, 0x49,
+    0xAF, 0x94, 0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5, 0xEA, 0x5A, 0xFE, 0xA4, 0xEA, 0x5A, 0xFF, 0x93,
+    0xEA, 0x5A, 0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F, 0xCA, 0x2E, 0xA5, 0xAE, 0x1F, 0xC9, 0x1E, 0xA5,
+    0xAE, 0x19, 0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC, 0x0E, 0xA5, 0xAE, 0x3F, 0xC9, 0xEA, 0x5A, 0xE3,
+    0x9F, 0xFA, 0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49, 0xFA, 0x94,
+    0xAF, 0xCA, 0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0xA7, 0x72, 0x99, 0x94, 0x77, 0x76, 0xCA,
+    0x77, 0x0E, 0x97, 0x69, 0xE9, 0x76, 0xF7, 0x69, 0xE7, 0x79, 0xD7, 0x77, 0x77, 0x74, 0x99, 0x92,
+    0x99, 0xA9, 0x6A, 0xFC, 0x09, 0xFD, 0x93, 0x9F, 0xDA, 0xFF, 0x93, 0xAA, 0xFF, 0xFC, 0xA5, 0xFC,
+    0x92, 0xFC, 0x5F, 0xA3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3,
+    0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0x9F, 0x5F, 0xA3, 0xAF, 0x92, 0xAF, 0xE1,
+    0xFF, 0x1F, 0xF1, 0xFF, 0x00, 0x77, 0x70, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF, 0xDA,
+    0x49, 0xAF, 0x94, 0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5, 0xEA, 0x5A, 0xFE, 0xA4, 0xEA, 0x5A, 0xFF,
+    0x93, 0xEA, 0x5A, 0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F, 0xCA, 0x2E, 0xA5, 0xAE, 0x1F, 0xC9, 0x1E,
+    0xA5, 0xAE, 0x19, 0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC, 0x0E, 0xA5, 0xAE, 0x3F, 0xC9, 0xEA, 0x5A,
+    0xE3, 0x9F, 0xFA, 0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49, 0xFA,
+    0x94, 0xAF, 0xCA, 0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0xA7, 0x72, 0x99, 0x97, 0x7A, 0xA7,
+    0x74, 0xF7, 0x73, 0xAE, 0x97, 0x72, 0x9E, 0x77, 0x3A, 0xE7, 0x72, 0x9E, 0x77, 0x4A, 0x97, 0x30,
+    0x39, 0x99, 0x29, 0x9A, 0x96, 0xAF, 0xC0, 0x9F, 0xD9, 0x39, 0xFD, 0xAF, 0xF9, 0x3A, 0xAF, 0xFF,
+    0xCA, 0x5F, 0xC9, 0x2F, 0xC5, 0xFA, 0x3A, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39,
+    0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x3A, 0xF9,
+    0x2A, 0xFE, 0x1F, 0xF1, 0xFF, 0x1F, 0xF7, 0x77, 0x59, 0x97, 0x70, 0xF7, 0x79, 0xE9, 0x77, 0xE9,
+    0x76, 0x9E, 0x77, 0xE7, 0x70, 0xA9, 0x71, 0x59, 0xC5, 0xD9, 0x74, 0xE3, 0xE9, 0x74, 0x9E, 0x90,
+    0xE9, 0x76, 0xAF, 0xD9, 0x77, 0x0A, 0xFA, 0x77, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x73, 0xFE, 0x59,
+    0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF, 0xDA, 0x49, 0xAF, 0x94, 0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5,
+    0xEA, 0x5A, 0xFE, 0xA4, 0xEA, 0x5A, 0xFF, 0x93, 0xEA, 0x5A, 0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F,
+    0xCA, 0x2E, 0xA5, 0xAE, 0x1F, 0xC9, 0x1E, 0xA5, 0xAE, 0x19, 0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC,
+    0x0E, 0xA5, 0xAE, 0x3F, 0xC9, 0xEA, 0x5A, 0xE3, 0x9F, 0xFA, 0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5,
+    0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49, 0xFA, 0x94, 0xAF, 0xCA, 0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9,
+    0x5F, 0xA7, 0x72, 0x99, 0x94, 0x5A, 0x93, 0xAA, 0x97, 0x1A, 0xD2, 0xAD, 0x97, 0x19, 0xE0, 0x9D,
+    0xA7, 0x3A, 0xFD, 0x75, 0xFC, 0x97, 0x6E, 0xA7, 0x70, 0x99, 0x77, 0x77, 0x09, 0x99, 0x29, 0x9A,
+    0x96, 0xAF, 0xC0, 0x9F, 0xD9, 0x39, 0xFD, 0xAF, 0xF9, 0x3A, 0xAF, 0xFF, 0xCA, 0x5F, 0xC9, 0x2F,
+    0xC5, 0xFA, 0x3A, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5,
+    0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x39, 0xF5, 0xFA, 0x3A, 0xF9, 0x2A, 0xFE, 0x1F, 0xF1,
+    0xFF, 0x1F, 0xF0, 0x19, 0xCA, 0x77, 0x5A, 0xEA, 0x77, 0x5F, 0x77, 0x5A, 0xE7, 0x75, 0xAE, 0x77,
+    0x5A, 0xD9, 0x49, 0x99, 0x29, 0x9A, 0x96, 0xE2, 0xAF, 0xA0, 0xAF, 0xD9, 0x3A, 0xD9, 0x1A, 0xFF,
+    0xFE, 0x3D, 0xA3, 0xAF, 0xFF, 0xD9, 0x73, 0xFC, 0x29, 0xFA, 0x73, 0xF9, 0x3F, 0xC7, 0x3F, 0x93,
+    0xAF, 0x73, 0xF9, 0x3A, 0xF7, 0x3F, 0x93, 0xAF, 0x73, 0xF9, 0x3A, 0xF7, 0x3F, 0x93, 0xAF, 0x73,
+    0xF9, 0x3A, 0xF7, 0x3F, 0x93, 0xAF, 0x72, 0x9F, 0xA3, 0xFC, 0x97, 0x0F, 0xF1, 0xFF, 0x7F, 0xF1,
+    0xFE, 0xA0, 0x77, 0x70, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF, 0xF2, 0xAF, 0xD9, 0x49, 0xAF, 0x94,
+    0xAF, 0xD6, 0xEA, 0x5A, 0xFE, 0x5E, 0xA5, 0xAF, 0xE9, 0x4E, 0xA5, 0xAF, 0xF4, 0xEA, 0x5A, 0xE9,
+    0xFA, 0x3E, 0xA5, 0xAE, 0x0A, 0xF9, 0x2E, 0xA5, 0xAE, 0x1F, 0xC2, 0xEA, 0x5A, 0xE1, 0x9F, 0xA1,
+    0xEA, 0x5A, 0xE2, 0xAF, 0x90, 0xEA, 0x5A, 0xE3, 0xFC, 0x0E, 0xA5, 0xAE, 0x39, 0xFA, 0xEA, 0x5A,
+    0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F, 0xDA, 0x49, 0xFA, 0x94, 0x9F, 0xCA, 0x3F,
+    0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0x97, 0x72, 0xAE, 0x76, 0x9C, 0x91, 0xAE, 0x76, 0xEA, 0xAE,
+    0xA7, 0x6F, 0xF7, 0x7F, 0xE7, 0x71, 0x9A, 0xCA, 0x96, 0x39, 0x99, 0x29, 0x9A, 0x94, 0xAF, 0xC0,
+    0x9F, 0xD9, 0x19, 0xFD, 0xAF, 0xF9, 0x1A, 0xAF, 0xFF, 0xCA, 0x3F, 0xC9, 0x2F, 0xC3, 0xFA, 0x3A,
+    0xF3, 0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF3,
+    0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF3, 0xFA, 0x39, 0xF1, 0xAF, 0xE2, 0x9F, 0x1F, 0xF2, 0xAF, 0x74,
+    0xAE, 0xA7, 0x4F, 0xA7, 0x39, 0xF7, 0x39, 0xFA, 0x71, 0x9F, 0xD7, 0x2A, 0xFC, 0x74, 0xAC, 0xA9,
+    0x40, 0x5F, 0xFC, 0x72, 0x9F, 0xFC, 0x72, 0x9F, 0xFA, 0x77, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0x97,
+    0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F,
+    0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71,
+    0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0,
+    0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF,
+    0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x2A, 0xFF, 0x95,
+    0xFF, 0xCA, 0x5F, 0xFC, 0x97, 0x77, 0x77, 0x09, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2,
+    0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F,
+    0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F,
+    0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x71, 0x9D, 0x4A, 0xC7,
+    0x29, 0xE9, 0x09, 0xAD, 0x73, 0xFF, 0xA7, 0x39, 0xFD, 0xA7, 0x69, 0x99, 0x97, 0x77, 0x75, 0x9A,
+    0xAA, 0xA9, 0x73, 0x9F, 0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93, 0xAF, 0x94,
+    0xFD, 0x29, 0xF9, 0x6F, 0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9, 0x70, 0xAF,
+    0x9A, 0xF7, 0x1A, 0xF9, 0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF, 0x9A, 0xF9,
+    0x70, 0xAF, 0x09, 0xFA, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29, 0xFC, 0xA4,
+    0xAF, 0x4A, 0xFE, 0xAF, 0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00,
+    0x39, 0x75, 0xDA, 0x4C, 0xA5, 0xEA, 0x19, 0xD9, 0x5A, 0xFF, 0x7A, 0xFC, 0xA7, 0x29, 0x99, 0x77,
+    0x74, 0x99, 0xA9, 0x97, 0x9F, 0xFA, 0x49, 0xFF, 0xDA, 0x29, 0xFA, 0x9A, 0xFC, 0x91, 0xFA, 0x3F,
+    0xC0, 0x9F, 0x4A, 0xF0, 0xAF, 0x49, 0xF9, 0xFC, 0x49, 0xF9, 0xFA, 0x5F, 0x9F, 0xC4, 0x9F, 0x9F,
+    0xC4, 0x9F, 0x0A, 0xF4, 0xAF, 0x09, 0xFC, 0x3F, 0x91, 0xFD, 0xAA, 0xFC, 0x3F, 0xFE, 0x5A, 0xFE,
+    0x97, 0x09, 0x99, 0x96, 0x71, 0xA4, 0x97, 0x4A, 0xCA, 0x29, 0xD7, 0x2A, 0xE1, 0x9E, 0xA7, 0x0A,
+    0xEA, 0x1F, 0x70, 0x9E, 0xA1, 0xF7, 0x1E, 0x2A, 0xD9, 0x72, 0xA9, 0x4A, 0x77, 0x77, 0x39, 0xAA,
+    0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F,
+    0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9,
+    0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97,
+    0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A,
+    0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x77,
+    0x5D, 0x91, 0xD7, 0x9E, 0x09, 0xDA, 0x6E, 0xA0, 0xE9, 0x6E, 0x09, 0xE6, 0xAD, 0x90, 0xAD, 0x7A,
+    0xCA, 0x1A, 0xCA, 0x70, 0x93, 0x97, 0x77, 0x29, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2,
+    0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F,
+    0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F,
+    0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x77, 0x19, 0xAF, 0xFF,
+    0xFD, 0x94, 0x9F, 0xFF, 0xFF, 0xC9, 0x3A, 0xFD, 0xAA, 0xAF, 0xFF, 0xC9, 0x2A, 0xFA, 0x4F, 0xC4,
+    0xAD, 0x92, 0xFA, 0x5F, 0xC4, 0x9D, 0x2F, 0xC6, 0xFC, 0x5A, 0x92, 0xF9, 0x6F, 0xC7, 0x19, 0xF7,
+    0xFC, 0x71, 0xAF, 0x7F, 0xCA, 0xAA, 0xAA, 0xA9, 0x2A, 0xF7, 0xFF, 0xEA, 0x2F, 0xC7, 0xFF, 0xE9,
+    0x2A, 0xF7, 0xFC, 0x99, 0x99, 0x99, 0x3A, 0xF7, 0xFC, 0x71, 0x9F, 0x96, 0xFC, 0x69, 0x2F, 0xC6,
+    0xFC, 0x5A, 0xD1, 0xAF, 0xA5, 0xFC, 0x5E, 0x2F, 0xCA, 0x4F, 0xC4, 0xAE, 0x3F, 0xEA, 0xAA, 0xFF,
+    0xFD, 0x4F, 0xFF, 0xFF, 0xDA, 0x59, 0xAF, 0xFF, 0xFE, 0x97, 0x29, 0x99, 0x97, 0x50, 0x59, 0x9A,
+    0x95, 0x99, 0xA9, 0x96, 0x9F, 0xEA, 0x19, 0xFE, 0x93, 0x9F, 0xFD, 0xAF, 0xFC, 0x29, 0xFA, 0x9A,
+    0xFE, 0xA9, 0x9F, 0xC1, 0xFA, 0x3F, 0xCA, 0x3F, 0x09, 0xF4, 0xAF, 0x4F, 0x9A, 0xF4, 0x9F, 0x4F,
+    0x9F, 0xC4, 0x9F, 0xFF, 0xC9, 0xFA, 0x5F, 0xFF, 0xC0, 0xFC, 0x49, 0xF9, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xC4, 0x9F, 0x71, 0xAF, 0x4A, 0xF9, 0x70, 0x9F, 0xC3, 0xFD, 0x95, 0x91, 0xFD, 0xAA, 0xFF,
+    0xFE, 0x2F, 0xFD, 0x9F, 0xFE, 0x3A, 0xFE, 0x2A, 0xFE, 0xA6, 0x99, 0x99, 0x69, 0x99, 0x94, 0x77,
+    0x76, 0xAA, 0x77, 0x1E, 0x97, 0x6A, 0xF9, 0x75, 0xFD, 0x75, 0x9F, 0x97, 0x7A, 0x97, 0x77, 0x75,
+    0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFC, 0xA6, 0xFF, 0xFE, 0x69, 0xAF, 0xAA, 0xAF, 0xD6, 0x9F,
+    0x3F, 0xC9, 0x59, 0xF4, 0xFA, 0x59, 0xF4, 0xFA, 0x59, 0xF4, 0xF9, 0x59, 0xF3, 0x9F, 0x69, 0xF2,
+    0xAF, 0xA6, 0x9F, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x70, 0x9F, 0xFC, 0x97, 0x19, 0xF0, 0xAF, 0x71,
+    0x9F, 0x1F, 0xC7, 0x09, 0xF2, 0xFC, 0x79, 0xF2, 0xAF, 0xA6, 0x9F, 0x3A, 0xFC, 0x49, 0xAF, 0xA9,
+    0x2F, 0xD9, 0x1F, 0xFC, 0xA2, 0xFD, 0xA0, 0xFF, 0xCA, 0x3A, 0xF9, 0x77, 0x09, 0x99, 0x10, 0x77,
+    0x59, 0xC9, 0x72, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x0A, 0xDA, 0x71, 0xAC, 0xA7, 0x39, 0x77, 0x79,
+    0x99, 0x29, 0xA9, 0x1A, 0xFA, 0x09, 0xF0, 0x9F, 0xD0, 0xFC, 0x1A, 0xAF, 0xFD, 0x3F, 0xDA, 0xAA,
+    0xA3, 0xFC, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA,
+    0x79, 0xFC, 0x95, 0xFF, 0xC9, 0x3F, 0xFC, 0x92, 0x39, 0x99, 0x99, 0x99, 0x97, 0x0F, 0xFF, 0xCA,
+    0x6F, 0xFF, 0xE6, 0x9A, 0xFA, 0xAA, 0xFD, 0x69, 0xF3, 0xFC, 0x95, 0x9F, 0x4F, 0xA5, 0x9F, 0x4F,
+    0xA5, 0x9F, 0x4F, 0x95, 0x9F, 0x39, 0xF6, 0x9F, 0x2A, 0xFA, 0x69, 0xFA, 0xFD, 0xA7, 0x9F, 0xFD,
+    0x97, 0x09, 0xFF, 0xC9, 0x71, 0x9F, 0x0A, 0xF7, 0x19, 0xF1, 0xFC, 0x70, 0x9F, 0x2F, 0xC7, 0x9F,
+    0x2A, 0xFA, 0x69, 0xF3, 0xAF, 0xC4, 0x9A, 0xFA, 0x92, 0xFD, 0x91, 0xFF, 0xCA, 0x2F, 0xDA, 0x0F,
+    0xFC, 0xA3, 0xAF, 0x97, 0x70, 0x99, 0x97, 0x29, 0xA9, 0x77, 0x0F, 0x97, 0x79, 0xEA, 0x77, 0x0E,
+    0x97, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0x09, 0x97, 0x20, 0x39, 0x99, 0x29, 0xA9, 0x1A, 0xFA, 0x09,
+    0xF0, 0x9F, 0xD0, 0xFC, 0x1A, 0xAF, 0xFD, 0x3F, 0xDA, 0xAA, 0xA3, 0xFC, 0x70, 0xFA, 0x70, 0xFA,
+    0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x79, 0xFC, 0x95, 0xFF, 0xC9, 0x3F,
+    0xFC, 0x97, 0x74, 0x9A, 0x72, 0xAE, 0x97, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0x71, 0xE9, 0x71, 0x99,
+    0x70, 0x2A, 0xC4, 0x9D, 0x72, 0xE2, 0x9E, 0x72, 0xAE, 0x09, 0xE7, 0x4F, 0xE7, 0x6F, 0xC9, 0x77,
+    0xAD, 0x97, 0x77, 0x73, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFC, 0xA6, 0xFF, 0xFE, 0x69, 0xAF,
+    0xAA, 0xAF, 0xD6, 0x9F, 0x3F, 0xC9, 0x59, 0xF4, 0xFA, 0x59, 0xF4, 0xFA, 0x59, 0xF4, 0xF9, 0x59,
+    0xF3, 0x9F, 0x69, 0xF2, 0xAF, 0xA6, 0x9F, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x70, 0x9F, 0xFC, 0x97,
+    0x19, 0xF0, 0xAF, 0x71, 0x9F, 0x1F, 0xC7, 0x09, 0xF2, 0xFC, 0x79, 0xF2, 0xAF, 0xA6, 0x9F, 0x3A,
+    0xFC, 0x49, 0xAF, 0xA9, 0x2F, 0xD9, 0x1F, 0xFC, 0xA2, 0xFD, 0xA0, 0xFF, 0xCA, 0x3A, 0xF9, 0x77,
+    0x09, 0x99, 0x10, 0x29, 0xA4, 0xAA, 0x4E, 0x2E, 0x4A, 0xDA, 0x0A, 0xD9, 0x5E, 0xAD, 0xA7, 0xFC,
+    0x71, 0xE9, 0x72, 0x97, 0x77, 0x99, 0x92, 0x9A, 0x91, 0xAF, 0xA0, 0x9F, 0x09, 0xFD, 0x0F, 0xC1,
+    0xAA, 0xFF, 0xD3, 0xFD, 0xAA, 0xAA, 0x3F, 0xC7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7,
+    0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x9F, 0xC9, 0x5F, 0xFC, 0x93, 0xFF, 0xC9, 0x20, 0x77, 0x70,
+    0xC9, 0x72, 0x9E, 0x71, 0xFC, 0x79, 0xFC, 0xA7, 0xFA, 0x97, 0x09, 0x97, 0x77, 0x39, 0xAA, 0xAA,
+    0xA9, 0x59, 0xFF, 0xCA, 0x2A, 0xFF, 0xE1, 0x9F, 0xC9, 0x9A, 0xF1, 0xFA, 0x39, 0xE1, 0xF9, 0x4E,
+    0x1F, 0x94, 0xD9, 0x1F, 0xC9, 0x70, 0xFD, 0xA9, 0x69, 0xFF, 0x95, 0xAF, 0xFC, 0x59, 0xFF, 0xC9,
+    0x59, 0xFF, 0x79, 0xFD, 0x90, 0xAA, 0x59, 0xFA, 0x9D, 0xA5, 0xFA, 0x9E, 0x5F, 0x99, 0xEA, 0x39,
+    0xF0, 0x9F, 0xCA, 0xAA, 0xFA, 0x09, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x50, 0x77,
+    0x3D, 0x71, 0x9E, 0x70, 0xF7, 0xAE, 0x70, 0xE9, 0x70, 0xD7, 0x77, 0x74, 0x9A, 0xA9, 0x95, 0xFF,
+    0xA2, 0xFF, 0xD1, 0xF2, 0x9E, 0x1F, 0x3A, 0xD1, 0xF9, 0x29, 0xA9, 0x1F, 0xDA, 0x5A, 0xFE, 0xA4,
+    0xAF, 0xF9, 0x39, 0xFF, 0x6A, 0xFC, 0x99, 0xD4, 0xF9, 0xAD, 0xA3, 0xAE, 0x9A, 0xEA, 0x19, 0xF0,
+    0x9F, 0xFD, 0x91, 0xAF, 0xEA, 0x69, 0x99, 0x94, 0x5A, 0xDA, 0x71, 0x9F, 0xA7, 0x9F, 0xDA, 0x6E,
+    0x1E, 0xA3, 0x9E, 0x3E, 0x4A, 0xA5, 0xA7, 0x76, 0x9A, 0xAA, 0xAA, 0x95, 0x9F, 0xFC, 0xA2, 0xAF,
+    0xFE, 0x19, 0xFC, 0x99, 0xAF, 0x1F, 0xA3, 0x9E, 0x1F, 0x94, 0xE1, 0xF9, 0x4D, 0x91, 0xFC, 0x97,
+    0x0F, 0xDA, 0x96, 0x9F, 0xF9, 0x5A, 0xFF, 0xC5, 0x9F, 0xFC, 0x95, 0x9F, 0xF7, 0x9F, 0xD9, 0x0A,
+    0xA5, 0x9F, 0xA9, 0xDA, 0x5F, 0xA9, 0xE5, 0xF9, 0x9E, 0xA3, 0x9F, 0x09, 0xFC, 0xAA, 0xAF, 0xA0,
+    0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x96, 0x99, 0x99, 0x95, 0x59, 0x97, 0x1E, 0xA7, 0xFC, 0x95, 0xAD,
+    0xAE, 0x94, 0xDA, 0x09, 0xE3, 0xE2, 0x9D, 0x39, 0xA4, 0x99, 0x77, 0x39, 0xAA, 0x99, 0x5F, 0xFA,
+    0x2F, 0xFD, 0x1F, 0x29, 0xE1, 0xF3, 0xAD, 0x1F, 0x92, 0x9A, 0x91, 0xFD, 0xA5, 0xAF, 0xEA, 0x4A,
+    0xFF, 0x93, 0x9F, 0xF6, 0xAF, 0xC9, 0x9D, 0x4F, 0x9A, 0xDA, 0x3A, 0xE9, 0xAE, 0xA1, 0x9F, 0x09,
+    0xFF, 0xD9, 0x1A, 0xFE, 0xA6, 0x99, 0x99, 0x40, 0x49, 0xAA, 0xAA, 0xA9, 0x59, 0xFF, 0xCA, 0x2A,
+    0xFF, 0xE1, 0x9F, 0xC9, 0x9A, 0xF1, 0xFA, 0x39, 0xE1, 0xF9, 0x4E, 0x1F, 0x94, 0xD9, 0x1F, 0xC9,
+    0x70, 0xFD, 0xA9, 0x69, 0xFF, 0x95, 0xAF, 0xFC, 0x59, 0xFF, 0xC9, 0x59, 0xFF, 0x79, 0xFD, 0x90,
+    0xAA, 0x59, 0xFA, 0x9D, 0xA5, 0xFA, 0x9E, 0x5F, 0x99, 0xEA, 0x39, 0xF0, 0x9F, 0xCA, 0xAA, 0xFA,
+    0x09, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x73, 0xAA, 0xA7, 0x2A, 0xF7, 0x19, 0xAE,
+    0x97, 0x2E, 0x97, 0x19, 0xE7, 0x1A, 0xE7, 0x29, 0xA9, 0x60, 0x49, 0xAA, 0x99, 0x5F, 0xFA, 0x2F,
+    0xFD, 0x1F, 0x29, 0xE1, 0xF3, 0xAD, 0x1F, 0x92, 0x9A, 0x91, 0xFD, 0xA5, 0xAF, 0xEA, 0x4A, 0xFF,
+    0x93, 0x9F, 0xF6, 0xAF, 0xC9, 0x9D, 0x4F, 0x9A, 0xDA, 0x3A, 0xE9, 0xAE, 0xA1, 0x9F, 0x09, 0xFF,
+    0xD9, 0x1A, 0xFE, 0xA6, 0x99, 0x99, 0x71, 0xAA, 0x97, 0x0F, 0xA7, 0x9A, 0xE7, 0x1E, 0x70, 0xAD,
+    0xA7, 0xAD, 0xA7, 0x0A, 0xA9, 0x50, 0x2C, 0xA4, 0xAC, 0xA3, 0xAD, 0x92, 0xAD, 0xA4, 0xEA, 0x0A,
+    0xDA, 0x59, 0xFD, 0xA7, 0x9F, 0xC7, 0x2E, 0x77, 0x71, 0x9A, 0xAA, 0xAA, 0x95, 0x9F, 0xFC, 0xA2,
+    0xAF, 0xFE, 0x19, 0xFC, 0x99, 0xAF, 0x1F, 0xA3, 0x9E, 0x1F, 0x94, 0xE1, 0xF9, 0x4D, 0x91, 0xFC,
+    0x97, 0x0F, 0xDA, 0x96, 0x9F, 0xF9, 0x5A, 0xFF, 0xC5, 0x9F, 0xFC, 0x95, 0x9F, 0xF7, 0x9F, 0xD9,
+    0x0A, 0xA5, 0x9F, 0xA9, 0xDA, 0x5F, 0xA9, 0xE5, 0xF9, 0x9E, 0xA3, 0x9F, 0x09, 0xFC, 0xAA, 0xAF,
+    0xA0, 0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x96, 0x99, 0x99, 0x95, 0x19, 0xA4, 0xCA, 0x29, 0xD9, 0x2E,
+    0x3E, 0x90, 0xE4, 0x9E, 0xAD, 0x95, 0xAF, 0xA7, 0xAE, 0x72, 0x97, 0x77, 0x9A, 0xA9, 0x95, 0xFF,
+    0xA2, 0xFF, 0xD1, 0xF2, 0x9E, 0x1F, 0x3A, 0xD1, 0xF9, 0x29, 0xA9, 0x1F, 0xDA, 0x5A, 0xFE, 0xA4,
+    0xAF, 0xF9, 0x39, 0xFF, 0x6A, 0xFC, 0x99, 0xD4, 0xF9, 0xAD, 0xA3, 0xAE, 0x9A, 0xEA, 0x19, 0xF0,
+    0x9F, 0xFD, 0x91, 0xAF, 0xEA, 0x69, 0x99, 0x94, 0x77, 0x4F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xFE, 0x0E, 0x92, 0xFA, 0x2A, 0xDA, 0x0E, 0x3F, 0xA2, 0xAD, 0xA0, 0xE3, 0xFA, 0x2A, 0xD9,
+    0x1A, 0x93, 0xFA, 0x29, 0xA9, 0x70, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76,
+    0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x74, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xD9,
+    0x70, 0xFF, 0xD9, 0x77, 0x77, 0x9A, 0xA9, 0x77, 0xFA, 0x76, 0x9F, 0x77, 0x0E, 0x77, 0xAD, 0xA7,
+    0x6E, 0xA7, 0x7A, 0xA9, 0x70, 0x39, 0xE7, 0x0F, 0x79, 0xF7, 0x9F, 0x59, 0xAF, 0xFC, 0x90, 0xFF,
+    0xE9, 0x0A, 0xAF, 0xCA, 0xAA, 0xA3, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF,
+    0x7A, 0xF7, 0xAF, 0x92, 0x92, 0x9F, 0xFC, 0x3F, 0xFA, 0x39, 0xFD, 0xA6, 0x99, 0x99, 0x70, 0x9A,
+    0xA9, 0x70, 0xFA, 0x79, 0xAE, 0x71, 0xE7, 0x0A, 0xD9, 0x7E, 0x97, 0x0A, 0xA4, 0x49, 0xC5, 0xD9,
+    0x70, 0xE3, 0xE9, 0x70, 0x9E, 0x90, 0xE9, 0x72, 0xAF, 0xD9, 0x74, 0xAF, 0xA7, 0x69, 0xDA, 0x77,
+    0x77, 0x77, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0E, 0x92, 0xFA, 0x2A, 0xDA,
+    0x0E, 0x3F, 0xA2, 0xAD, 0xA0, 0xE3, 0xFA, 0x2A, 0xD9, 0x1A, 0x93, 0xFA, 0x29, 0xA9, 0x70, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x74, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xD9, 0x70, 0xFF, 0xD9, 0x30, 0x77, 0x6D, 0x97,
+    0x1E, 0x70, 0x9D, 0xA7, 0x09, 0xD9, 0x39, 0xE0, 0x9D, 0x4F, 0x09, 0xC9, 0x39, 0xF1, 0x94, 0x9F,
+    0x59, 0xAF, 0xFC, 0x90, 0xFF, 0xE9, 0x0A, 0xAF, 0xCA, 0xAA, 0xA3, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A,
+    0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x92, 0x92, 0x9F, 0xFC, 0x3F, 0xFA, 0x39, 0xFD,
+    0xA6, 0x99, 0x99, 0x20, 0x77, 0x4F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0E, 0x92,
+    0xFA, 0x2A, 0xDA, 0x0E, 0x3F, 0xA2, 0xAD, 0xA0, 0xE3, 0xFA, 0x2A, 0xD9, 0x1A, 0x93, 0xFA, 0x29,
+    0xA9, 0x70, 0xFA, 0x76, 0xFA, 0x72, 0x9F, 0xFD, 0xA7, 0x9F, 0xFD, 0xA7, 0x3F, 0xA7, 0x6F, 0xA7,
+    0x6F, 0xA7, 0x6F, 0xA7, 0x6F, 0xA7, 0x6F, 0xA7, 0x49, 0xAF, 0xCA, 0x97, 0x1F, 0xFD, 0x97, 0x0F,
+    0xFD, 0x93, 0x39, 0xE7, 0x0F, 0x79, 0xF7, 0x9F, 0x59, 0xAF, 0xFC, 0x90, 0xFF, 0xE9, 0x0A, 0xAF,
+    0xCA, 0xAA, 0xA3, 0xAF, 0x7A, 0xF7, 0xAF, 0x5A, 0xAF, 0xCA, 0xAA, 0x91, 0xFF, 0xDA, 0x19, 0x9A,
+    0xF9, 0x99, 0x4A, 0xF7, 0xAF, 0x7A, 0xF9, 0x29, 0x29, 0xFF, 0xC3, 0xFF, 0xA3, 0x9F, 0xDA, 0x69,
+    0x99, 0x92, 0x70, 0x97, 0x73, 0x9F, 0x1A, 0xC7, 0x5F, 0xDA, 0xD9, 0x74, 0xDA, 0xAF, 0xC9, 0x74,
+    0xD1, 0xAE, 0xA7, 0x73, 0x97, 0x77, 0x77, 0x76, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x9F, 0xFC, 0x2A,
+    0xFF, 0x90, 0x9A, 0xFC, 0x94, 0x99, 0xFA, 0x4F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC,
+    0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F,
+    0x5F, 0xC7, 0xF5, 0xFC, 0x69, 0xF5, 0xAF, 0x95, 0xAE, 0xA5, 0x9F, 0xC9, 0x3A, 0xF9, 0x6F, 0xFF,
+    0xE7, 0x0F, 0xFF, 0xC7, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xA9, 0x97, 0x00, 0x5A, 0xCA, 0x2A, 0x73,
+    0xFC, 0x1D, 0x71, 0x9F, 0xFC, 0x71, 0x9D, 0x09, 0xFA, 0x72, 0x99, 0x2A, 0xCA, 0x77, 0x77, 0x77,
+    0x77, 0x3A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF,
+    0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39, 0x94, 0x6F, 0xFC, 0x97, 0x4F, 0xFC, 0x97,
+    0x4F, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x9F, 0xFC, 0x2A, 0xFF,
+    0x90, 0x9A, 0xFC, 0x94, 0x99, 0xFA, 0x4F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F,
+    0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F,
+    0xC7, 0xF5, 0xFC, 0x69, 0xF5, 0xAF, 0x95, 0xAE, 0xA5, 0x9F, 0xC9, 0x3A, 0xF9, 0x6F, 0xFF, 0xE7,
+    0x0F, 0xFF, 0xC7, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xA9, 0x97, 0x00, 0x4F, 0xFC, 0x71, 0x9F, 0xFC,
+    0x97, 0x09, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xC2, 0xAF, 0xC9, 0x2A, 0xFD, 0x19, 0xFD,
+    0x92, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F,
+    0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0xA2,
+    0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFD, 0x09, 0xFC, 0xA6, 0x99, 0x93, 0x99,
+    0x40, 0x79, 0x77, 0x4D, 0x94, 0xC9, 0x74, 0xEA, 0x99, 0xAD, 0x97, 0x4F, 0xFC, 0x76, 0xAF, 0xCA,
+    0x77, 0x19, 0xA9, 0x77, 0x77, 0x77, 0x79, 0xFF, 0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9,
+    0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5,
+    0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC,
+    0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70,
+    0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x70, 0x59, 0x77, 0x1D, 0x49, 0xC7, 0x19,
+    0xE9, 0x1A, 0xD7, 0x2F, 0xF9, 0x73, 0xFD, 0x97, 0x69, 0x97, 0x77, 0x77, 0x72, 0xAF, 0xC2, 0xAF,
+    0xC9, 0x2A, 0xFD, 0x19, 0xFD, 0x92, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F,
+    0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94,
+    0x9F, 0x4F, 0x94, 0x9F, 0xA2, 0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFD, 0x09,
+    0xFC, 0xA6, 0x99, 0x93, 0x99, 0x40, 0x71, 0x99, 0x97, 0x72, 0xFC, 0xA7, 0x7A, 0xCA, 0x9A, 0xD7,
+    0x7D, 0x2D, 0x97, 0x6D, 0x91, 0xD9, 0x76, 0xE9, 0xAD, 0x77, 0x0F, 0xC7, 0x72, 0x99, 0x97, 0x77,
+    0x70, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x9F, 0xFC, 0x2A, 0xFF, 0x90, 0x9A, 0xFC, 0x94, 0x99, 0xFA,
+    0x4F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F,
+    0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x69, 0xF5, 0xAF,
+    0x95, 0xAE, 0xA5, 0x9F, 0xC9, 0x3A, 0xF9, 0x6F, 0xFF, 0xE7, 0x0F, 0xFF, 0xC7, 0x2A, 0xFF, 0xCA,
+    0x76, 0x99, 0xA9, 0x97, 0x00, 0x77, 0x72, 0xAE, 0xA7, 0x5A, 0xDA, 0xDA, 0x73, 0x9D, 0x19, 0xD7,
+    0x39, 0xD2, 0xD7, 0x39, 0xD1, 0x9D, 0x74, 0xEA, 0xD9, 0x75, 0xAE, 0x97, 0x77, 0x77, 0x70, 0xAF,
+    0xC2, 0xAF, 0xC9, 0x2A, 0xFD, 0x19, 0xFD, 0x92, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94,
+    0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F,
+    0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0xA2, 0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A,
+    0xFD, 0x09, 0xFC, 0xA6, 0x99, 0x93, 0x99, 0x40, 0x72, 0x95, 0xA7, 0x59, 0xD3, 0xD9, 0x73, 0x9E,
+    0x91, 0xF7, 0x3F, 0x1F, 0x97, 0x2F, 0x1A, 0xE9, 0x72, 0xAD, 0x92, 0xDA, 0x74, 0x9A, 0x4A, 0x97,
+    0x77, 0x77, 0x74, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x9F, 0xFC, 0x2A, 0xFF, 0x90, 0x9A, 0xFC, 0x94,
+    0x99, 0xFA, 0x4F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC,
+    0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x69,
+    0xF5, 0xAF, 0x95, 0xAE, 0xA5, 0x9F, 0xC9, 0x3A, 0xF9, 0x6F, 0xFF, 0xE7, 0x0F, 0xFF, 0xC7, 0x2A,
+    0xFF, 0xCA, 0x76, 0x99, 0xA9, 0x97, 0x00, 0x77, 0x72, 0x9C, 0xA1, 0x9C, 0xA7, 0x3A, 0xD9, 0x0E,
+    0x97, 0x2E, 0x1E, 0x72, 0xAD, 0xA0, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xD2, 0xD7, 0x59, 0x29, 0x97,
+    0x77, 0x77, 0x7A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9,
+    0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94,
+    0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99, 0x39, 0x94, 0x77, 0x69, 0xFF, 0xC9, 0x19,
+    0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7,
+    0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5,
+    0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5A, 0xF6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x6F, 0xC9,
+    0x3A, 0xF9, 0x6A, 0xFF, 0xFC, 0xA7, 0x0F, 0xFF, 0xA7, 0x29, 0xFF, 0xC9, 0x76, 0x99, 0x9E, 0x77,
+    0x2E, 0x77, 0x29, 0xE7, 0x72, 0xAE, 0x97, 0x71, 0x9F, 0xD7, 0x70, 0xAF, 0xA7, 0x72, 0x99, 0x70,
+    0x77, 0x4A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49,
+    0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF,
+    0xFF, 0xE4, 0xAF, 0xD1, 0xFC, 0xA6, 0x99, 0x94, 0xE7, 0x7A, 0xD7, 0x70, 0xE7, 0x79, 0xE9, 0x77,
+    0xFD, 0x75, 0x9F, 0xA7, 0x74, 0x75, 0x9D, 0xA7, 0x77, 0x29, 0xFC, 0x77, 0x71, 0xFE, 0x77, 0x7E,
+    0x90, 0xEA, 0x77, 0x5E, 0x92, 0xE7, 0x75, 0x9A, 0x5A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x3F, 0xFC,
+    0x92, 0x9E, 0x93, 0xAF, 0xEA, 0x0F, 0xFC, 0x3A, 0xEA, 0x3A, 0xFE, 0x90, 0x9F, 0xDA, 0x4F, 0xC4,
+    0x9F, 0xC4, 0xFC, 0x5F, 0xC5, 0xAE, 0x5F, 0xC9, 0x39, 0xFC, 0x94, 0xF5, 0x9F, 0xA3, 0xAF, 0xD4,
+    0xEA, 0x6F, 0xC3, 0xFE, 0x39, 0xE9, 0x6F, 0xC3, 0xFE, 0x92, 0xAE, 0x7A, 0xF9, 0x19, 0xFE, 0xA2,
+    0xEA, 0x70, 0xFA, 0x1A, 0xD9, 0xAF, 0x2E, 0x97, 0x0F, 0xC1, 0xE1, 0xF1, 0x9E, 0x71, 0xAF, 0x09,
+    0xE1, 0xFA, 0x0A, 0xDA, 0x72, 0xF9, 0xAD, 0xA1, 0xAF, 0x0E, 0x97, 0x2F, 0xAE, 0x3F, 0x9E, 0x73,
+    0xAF, 0xE3, 0xFE, 0xA7, 0x4F, 0xDA, 0x3A, 0xFD, 0x97, 0x4F, 0xD9, 0x4F, 0xD7, 0x5A, 0xFC, 0x5F,
+    0xCA, 0x76, 0xFA, 0x5A, 0xF9, 0x76, 0xF9, 0x6F, 0x77, 0x77, 0x70, 0x73, 0x99, 0x97, 0x75, 0xAE,
+    0x77, 0x49, 0xFC, 0x77, 0x3E, 0xAE, 0x77, 0x1A, 0xD9, 0x0A, 0xD9, 0x77, 0x9D, 0xA2, 0xDA, 0x77,
+    0x0A, 0x94, 0x97, 0x77, 0x77, 0x77, 0x49, 0xFF, 0x2A, 0xD9, 0x2F, 0xE0, 0xFE, 0xA2, 0xEA, 0x2F,
+    0xD9, 0x1F, 0xC4, 0xF3, 0x9E, 0x92, 0x9F, 0x3A, 0xF9, 0x2A, 0xE4, 0xF9, 0x2F, 0xCA, 0x2E, 0xA4,
+    0xAE, 0xA2, 0xFD, 0x2E, 0x59, 0xF1, 0x9D, 0xAE, 0x19, 0xE6, 0xF1, 0xDA, 0x9E, 0x90, 0xAD, 0x96,
+    0xAE, 0x90, 0xD9, 0x0E, 0xA0, 0xE7, 0x0E, 0xA9, 0xD1, 0xAE, 0x0D, 0xA7, 0x0F, 0xAD, 0x19, 0xEA,
+    0xD9, 0x70, 0x9F, 0xCA, 0x2F, 0xD7, 0x2F, 0xC3, 0xFC, 0xA7, 0x2F, 0xC3, 0x9F, 0x73, 0x9E, 0xA4,
+    0xF7, 0x77, 0x70, 0x70, 0xE7, 0x70, 0xFC, 0x97, 0x5A, 0xFD, 0x97, 0x3A, 0xDA, 0x0A, 0xE7, 0x2A,
+    0xDA, 0x29, 0xD9, 0x72, 0xA9, 0x49, 0x97, 0x77, 0x77, 0x79, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA,
+    0x1A, 0xFE, 0x90, 0x9F, 0xD9, 0x4F, 0xA4, 0xFC, 0x5F, 0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7,
+    0x0F, 0xA1, 0x9E, 0x71, 0xAF, 0x1E, 0x97, 0x2F, 0xA9, 0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F,
+    0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F,
+    0xFD, 0x71, 0xAF, 0xFC, 0xA4, 0x79, 0x99, 0x76, 0xAE, 0x75, 0x9F, 0xC7, 0x4E, 0xAE, 0x72, 0xAD,
+    0x90, 0xAD, 0x97, 0x09, 0xDA, 0x2D, 0xA7, 0x1A, 0x94, 0x97, 0x77, 0x77, 0x39, 0xFF, 0x90, 0x9F,
+    0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4, 0xEA, 0x4F, 0xC3, 0x9E, 0x59, 0xF9,
+    0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70, 0xAE, 0xA9, 0xE7, 0x2F, 0xEA,
+    0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x75, 0x9E, 0x97, 0x5F, 0x74, 0x9F,
+    0x70, 0x9A, 0xAA, 0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x3A, 0xDA, 0x97, 0x40, 0x5A,
+    0xA9, 0x2A, 0xAA, 0x72, 0xF1, 0xAE, 0xA7, 0x1F, 0x90, 0xFA, 0x71, 0xF1, 0xAE, 0x97, 0x29, 0x94,
+    0x97, 0x77, 0x77, 0x70, 0x9F, 0xFC, 0x1A, 0xFE, 0xAA, 0xFF, 0xA1, 0xAF, 0xE9, 0x09, 0xFD, 0x94,
+    0xFA, 0x4F, 0xC5, 0xF5, 0x9F, 0xA3, 0x9E, 0x7F, 0xC3, 0xEA, 0x70, 0xFA, 0x19, 0xE7, 0x1A, 0xF1,
+    0xE9, 0x72, 0xFA, 0x9E, 0x73, 0x9F, 0xE7, 0x5F, 0xDA, 0x76, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77,
+    0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x76, 0xAF, 0xCA, 0x97, 0x29, 0xFF, 0xD7, 0x1A, 0xFF, 0xCA, 0x40,
+    0x77, 0x73, 0xC9, 0x74, 0x9E, 0x73, 0xFC, 0x71, 0x9F, 0xCA, 0x71, 0xFA, 0x97, 0x29, 0x97, 0x77,
+    0x77, 0x39, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x0A, 0xDA, 0x4A, 0xFA, 0x1A,
+    0xD9, 0x39, 0xFC, 0x29, 0xD4, 0xFC, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97,
+    0x1A, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x49, 0xA9, 0x19, 0xFC, 0x5E, 0x1F, 0xC5,
+    0x9E, 0x0A, 0xFA, 0x5F, 0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xE9, 0x09, 0xFF, 0xFD, 0x77, 0x10, 0x77,
+    0x6D, 0x73, 0x9D, 0xA7, 0x2E, 0xA7, 0x1A, 0xE7, 0x2E, 0x73, 0xD7, 0x77, 0x77, 0x74, 0x9F, 0xFE,
+    0xA1, 0x9F, 0xFF, 0x1A, 0xEA, 0xAA, 0xFC, 0xA1, 0xAD, 0x3F, 0xC2, 0xAC, 0xA2, 0xFC, 0x49, 0x2A,
+    0xF9, 0x79, 0xF9, 0x79, 0xFA, 0x70, 0xFC, 0x70, 0xFC, 0x3A, 0xA2, 0xAF, 0x92, 0x9D, 0x19, 0xFA,
+    0x3E, 0x1F, 0xCA, 0xAA, 0xAF, 0x1F, 0xFF, 0xC1, 0xAF, 0xFE, 0xA7, 0x70, 0x79, 0x76, 0xF7, 0x3A,
+    0xF7, 0x3A, 0xF7, 0x39, 0xEA, 0x75, 0x97, 0x77, 0x77, 0x29, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x90,
+    0xAF, 0xFF, 0xD9, 0x0A, 0xDA, 0x4A, 0xFA, 0x1A, 0xD9, 0x39, 0xFC, 0x29, 0xD4, 0xFC, 0x72, 0xAF,
+    0x97, 0x19, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A,
+    0xFA, 0x49, 0xA9, 0x19, 0xFC, 0x5E, 0x1F, 0xC5, 0x9E, 0x0A, 0xFA, 0x5F, 0x0F, 0xFF, 0xEA, 0x0F,
+    0xFF, 0xE9, 0x09, 0xFF, 0xFD, 0x77, 0x10, 0x59, 0xA9, 0x72, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7,
+    0x2A, 0xCA, 0x77, 0x77, 0x77, 0x39, 0xFF, 0xEA, 0x19, 0xFF, 0xF1, 0xAE, 0xAA, 0xAF, 0xCA, 0x1A,
+    0xD3, 0xFC, 0x2A, 0xCA, 0x2F, 0xC4, 0x92, 0xAF, 0x97, 0x9F, 0x97, 0x9F, 0xA7, 0x0F, 0xC7, 0x0F,
+    0xC3, 0xAA, 0x2A, 0xF9, 0x29, 0xD1, 0x9F, 0xA3, 0xE1, 0xFC, 0xAA, 0xAA, 0xF1, 0xFF, 0xFC, 0x1A,
+    0xFF, 0xEA, 0x77, 0x3A, 0xA4, 0xAC, 0xA5, 0x9D, 0xA2, 0xAD, 0xA6, 0xEA, 0x0A, 0xDA, 0x79, 0xFD,
+    0xA7, 0x19, 0xFC, 0x74, 0xE7, 0x77, 0x77, 0x19, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x90, 0xAF, 0xFF,
+    0xD9, 0x0A, 0xDA, 0x4A, 0xFA, 0x1A, 0xD9, 0x39, 0xFC, 0x29, 0xD4, 0xFC, 0x72, 0xAF, 0x97, 0x19,
+    0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x49,
+    0xA9, 0x19, 0xFC, 0x5E, 0x1F, 0xC5, 0x9E, 0x0A, 0xFA, 0x5F, 0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xE9,
+    0x09, 0xFF, 0xFD, 0x77, 0x10, 0x29, 0xA3, 0x9C, 0xA4, 0x9D, 0x92, 0xE5, 0xE1, 0xE6, 0x9E, 0xAD,
+    0x97, 0xAF, 0xA7, 0x1A, 0xE7, 0x49, 0x77, 0x77, 0x59, 0xFF, 0xEA, 0x19, 0xFF, 0xF1, 0xAE, 0xAA,
+    0xAF, 0xCA, 0x1A, 0xD3, 0xFC, 0x2A, 0xCA, 0x2F, 0xC4, 0x92, 0xAF, 0x97, 0x9F, 0x97, 0x9F, 0xA7,
+    0x0F, 0xC7, 0x0F, 0xC3, 0xAA, 0x2A, 0xF9, 0x29, 0xD1, 0x9F, 0xA3, 0xE1, 0xFC, 0xAA, 0xAA, 0xF1,
+    0xFF, 0xFC, 0x1A, 0xFF, 0xEA, 0x77, 0x69, 0xAA, 0xAA, 0x79, 0xFE, 0xA4, 0xAF, 0xFC, 0x92, 0x9F,
+    0xA9, 0xAE, 0x92, 0xFA, 0x29, 0xD3, 0xF9, 0x39, 0x39, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7,
+    0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7,
+    0x19, 0xF7, 0x19, 0xF7, 0x1A, 0xFA, 0x95, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0x77, 0x09, 0xE7, 0x71,
+    0x9F, 0x77, 0x09, 0xF7, 0x9A, 0xAA, 0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F, 0x4A, 0xFF, 0xFE,
+    0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC, 0x79, 0xFC, 0x2F,
+    0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0F,
+    0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA, 0x70, 0xFC, 0x2F,
+    0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF, 0xD9, 0x6A, 0xFF,
+    0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97, 0x10, 0x73, 0x9A, 0xA9, 0x74, 0xAE, 0x97, 0x39,
+    0xE9, 0x59, 0x9A, 0x99, 0x09, 0xE3, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9,
+    0x2F, 0xA3, 0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F, 0x90, 0xFC, 0x49, 0xF9, 0x0F, 0xA5, 0xF9,
+    0x0F, 0xC4, 0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A, 0xF1, 0x9F, 0xC3, 0xF9, 0x2F, 0xDA, 0xAF,
+    0xC4, 0xFF, 0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70, 0x69, 0x99, 0x99, 0x99, 0x71, 0xAF, 0xFF,
+    0xA4, 0xAF, 0xFF, 0xF9, 0x19, 0xFA, 0xFC, 0xAA, 0xFD, 0x1F, 0x1F, 0xC2, 0xAF, 0xA0, 0xF1, 0xFC,
+    0x3F, 0xC0, 0x9E, 0x1F, 0xC3, 0xAF, 0x6F, 0xC3, 0xAF, 0x6F, 0xC3, 0xFA, 0x6F, 0xC2, 0x9F, 0x96,
+    0xFC, 0x09, 0xAF, 0xA7, 0xFF, 0xF7, 0x0F, 0xFD, 0x97, 0x1F, 0xCA, 0xA9, 0x74, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x76, 0x9F, 0xCA, 0x97, 0x3F, 0xFC, 0xA7, 0x19, 0xFF, 0xCA, 0x60, 0x69,
+    0xAA, 0xAA, 0x72, 0x9F, 0xF7, 0xAF, 0xFC, 0x95, 0x9F, 0x90, 0x9E, 0x95, 0xAE, 0xA3, 0xCA, 0x6F,
+    0x97, 0x4F, 0x74, 0x9F, 0x29, 0xA9, 0x69, 0xF9, 0xFE, 0x49, 0xFF, 0xFC, 0x39, 0xFF, 0xFC, 0x92,
+    0x9F, 0xA2, 0xAF, 0xA2, 0x9F, 0x4F, 0xC2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2,
+    0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xEA, 0x29, 0xF4, 0xF9, 0x29, 0xF3, 0xAF, 0x39, 0xFC, 0xAA, 0xFC,
+    0x93, 0x9F, 0xFE, 0xA4, 0x9F, 0xFD, 0x95, 0x9F, 0x99, 0x99, 0x70, 0x9F, 0x74, 0x9F, 0x74, 0x9F,
+    0x73, 0x9F, 0xDA, 0x70, 0x9F, 0xFA, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x39, 0xE7, 0x0F, 0x79,
+    0xF7, 0x9F, 0x59, 0xAF, 0xFC, 0x90, 0xFF, 0xE9, 0x0A, 0xAF, 0xCA, 0xAA, 0xA3, 0xAF, 0x7A, 0xF7,
+    0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x92, 0x92, 0x9F, 0xFC, 0x3F, 0xFC,
+    0x39, 0xFF, 0x59, 0x99, 0x9E, 0x71, 0xDA, 0x39, 0xA2, 0x9D, 0x92, 0x9D, 0xA0, 0x9E, 0x39, 0xFE,
+    0x94, 0xFD, 0x96, 0x9A, 0xAA, 0x30, 0x77, 0x6A, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
+    0xE9, 0xE9, 0x2F, 0xA2, 0xAD, 0xA9, 0xE3, 0xFA, 0x2A, 0xDA, 0x9E, 0xA2, 0xFA, 0x2A, 0xD9, 0x0A,
+    0xE2, 0xFA, 0x29, 0xA9, 0x70, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x74, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xD9, 0x70,
+    0xFF, 0xD9, 0x30, 0x79, 0xAA, 0xA9, 0x7A, 0xFE, 0x94, 0xFF, 0xD3, 0xAF, 0x1A, 0xE3, 0xF3, 0xAC,
+    0x39, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x9F, 0xFD, 0x92, 0xFF, 0xE9, 0x2A, 0xAF, 0xCA, 0xAA, 0xA5,
+    0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0x92, 0x94, 0x9F, 0xFC, 0x5F, 0xFA, 0x59, 0xFD, 0xA7, 0x09, 0x99, 0x94, 0x77, 0x4F, 0xFF,
+    0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0E, 0x92, 0xFA, 0x2A, 0xDA, 0x0E, 0x3F, 0xA2, 0xAD,
+    0xA0, 0xE3, 0xFA, 0x2A, 0xD9, 0x1A, 0x93, 0xFA, 0x29, 0xA9, 0x70, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xAE, 0xA7, 0x69, 0xF1, 0xAC, 0x73, 0xFA, 0xAE, 0x72, 0x9F, 0xF7,
+    0x3A, 0xFD, 0xA7, 0x5A, 0xAC, 0xA9, 0x20, 0x77, 0x29, 0xAD, 0x97, 0x72, 0x9F, 0x77, 0x3F, 0x77,
+    0x2A, 0xEA, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x09, 0xFF, 0xC2, 0xAF, 0xEA, 0x29, 0xAF, 0xC9, 0x49,
+    0x9F, 0x95, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7,
+    0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC6, 0x9F,
+    0x6A, 0xF9, 0x5A, 0xEA, 0x69, 0xFC, 0x93, 0xAF, 0x97, 0xFF, 0xFE, 0x71, 0xFF, 0xFC, 0x73, 0xAF,
+    0xFC, 0xA7, 0x79, 0x9A, 0x99, 0x71, 0x76, 0x9A, 0xA9, 0x77, 0xF7, 0x7A, 0xE7, 0x69, 0xF1, 0xAF,
+    0xC2, 0xAF, 0xE9, 0x0A, 0xFD, 0x19, 0xFD, 0xA2, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94,
+    0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F,
+    0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0xA2, 0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A,
+    0xFD, 0x09, 0xFC, 0xA6, 0x99, 0x93, 0x99, 0x40, 0x70, 0xC9, 0x3E, 0x92, 0xF2, 0x9F, 0x3E, 0xA3,
+    0xAC, 0xA6, 0x70, 0xCA, 0x2E, 0x90, 0x9E, 0x90, 0xEA, 0x0A, 0xDA, 0x19, 0xCA, 0x70, 0x39, 0x99,
+    0x5A, 0xE4, 0x9F, 0xC3, 0xEA, 0xE1, 0xAD, 0x90, 0xAD, 0x99, 0xDA, 0x2D, 0xA0, 0xA9, 0x49, 0x00,
+    0x09, 0xAA, 0x92, 0xA0, 0x9F, 0xA0, 0xAC, 0xAA, 0xFF, 0xAA, 0xCA, 0x0A, 0xF9, 0x0A, 0x29, 0xAA,
+    0x90, 0x9F, 0xFA, 0xFF, 0xDA, 0xFF, 0xA0, 0x09, 0x7A, 0xCA, 0x4A, 0xAF, 0x90, 0x9D, 0xA9, 0xFF,
+    0x19, 0xFC, 0xA5, 0x99, 0x30, 0x1A, 0xA9, 0x1F, 0x09, 0xF9, 0x0F, 0x19, 0xCA, 0x90, 0x74, 0xAD,
+    0xA1, 0xAD, 0xA1, 0xF1, 0xF1, 0xF1, 0xF1, 0x9C, 0xA9, 0x19, 0xCA, 0x90, 0x29, 0x99, 0x2F, 0xD0,
+    0xEA, 0xAF, 0xCA, 0x1E, 0x9A, 0x91, 0xDA, 0x29, 0xE2, 0xEA, 0x39, 0xCA, 0x5A, 0x30, 0x71, 0xF9,
+    0x1D, 0xAE, 0x9A, 0xCA, 0x1D, 0xAD, 0xA1, 0xAD, 0xAD, 0x1A, 0xCA, 0x9F, 0xD1, 0x9F, 0x71, 0x74,
+    0xAC, 0x91, 0xD9, 0x2E, 0x1E, 0x1A, 0xE0, 0xAD, 0xA1, 0xE1, 0xE1, 0x9D, 0xA0, 0x9D, 0x91, 0x9D,
+    0x19, 0xCA, 0x39, 0x39, 0x30, 0x0A, 0x93, 0xAA, 0x9E, 0x2A, 0xD9, 0xAE, 0x09, 0xDA, 0x1E, 0xAE,
+    0x3F, 0xC9, 0x4E, 0xA6, 0x99, 0x30, 0x73, 0x9D, 0x19, 0xCA, 0x2E, 0x1E, 0x2A, 0xDA, 0x0E, 0xA2,
+    0xE1, 0xE2, 0x9D, 0x90, 0xAD, 0x92, 0xAC, 0x91, 0xD9, 0x39, 0x39, 0x00, 0x2A, 0xDA, 0x92, 0xAF,
+    0xE0, 0x9E, 0xAF, 0xAD, 0x92, 0x9E, 0xA9, 0x49, 0xC7, 0x20, 0x2A, 0xA2, 0xE1, 0xAD, 0x91, 0xE1,
+    0x9E, 0x19, 0xE1, 0x9E, 0xA1, 0xAD, 0x90, 0x19, 0x91, 0x9F, 0x1F, 0x19, 0xE1, 0x9E, 0x1A, 0xD9,
+    0x1E, 0x1A, 0xD7, 0x00, 0x19, 0x92, 0xF9, 0x0F, 0x1E, 0x91, 0xE9, 0x1A, 0xDA, 0x2E, 0x3D, 0xA5,
+    0x0D, 0x90, 0xE0, 0xDA, 0x9D, 0x99, 0xD0, 0x9C, 0xA0, 0x9C, 0x50, 0x19, 0x92, 0xAE, 0x19, 0xE1,
+    0x9E, 0x1E, 0x19, 0xD9, 0x19, 0xA7, 0x10, 0x1A, 0xA9, 0x1F, 0x09, 0xF9, 0x0F, 0x19, 0xAA, 0x90,
+    0x19, 0x94, 0x92, 0xF1, 0xAE, 0x1F, 0x1F, 0x1F, 0x1F, 0x19, 0xA9, 0x3A, 0xA1, 0x29, 0xA9, 0x29,
+    0xFA, 0x1D, 0x09, 0xD0, 0x9D, 0x1D, 0x90, 0xD1, 0xD1, 0xAF, 0x92, 0x9A, 0xA2, 0x19, 0x92, 0xF1,
+    0xAE, 0x91, 0xE1, 0x9E, 0x1E, 0x2A, 0x92, 0x09, 0xAA, 0x19, 0xF9, 0x0A, 0xEA, 0x19, 0xDA, 0x1E,
+    0x09, 0xE9, 0x1A, 0xA2, 0x71, 0x9D, 0x92, 0xAD, 0x93, 0xE4, 0xE9, 0x3F, 0xD2, 0xFA, 0x70, 0x09,
+    0x90, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0x09, 0x99, 0x77, 0xAE, 0x69, 0xFC,
+    0x5F, 0xE3, 0xE9, 0x0A, 0xDA, 0x1A, 0xD9, 0x2A, 0xD1, 0x9A, 0x94, 0xA9, 0x00, 0x0A, 0x95, 0x9A,
+    0xD4, 0xDA, 0xEA, 0xAA, 0xDA, 0x0F, 0xEA, 0x2A, 0xEA, 0x97, 0x30, 0x19, 0x93, 0x91, 0xF9, 0x09,
+    0xC9, 0xAF, 0xCA, 0xDA, 0xAD, 0x9F, 0xC9, 0x9C, 0x91, 0xAD, 0xA7, 0x20, 0x9F, 0xFA, 0xFF, 0xDA,
+    0xFF, 0x90, 0x2A, 0xDA, 0x92, 0xAF, 0xE0, 0x9E, 0xAF, 0xAD, 0x92, 0x9E, 0xA9, 0x49, 0xC7, 0x20,
+    0x77, 0x2D, 0x97, 0xAE, 0x7E, 0xA6, 0xAE, 0x7E, 0x70, 0xAC, 0x75, 0x92, 0xF1, 0xAE, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x19, 0xAA, 0x3A, 0xA1, 0xAD, 0x2A, 0xD2, 0xAD, 0x91, 0xAF, 0x90, 0xEA, 0x60, 0x72,
+    0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A,
+    0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF,
+    0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6,
+    0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F,
+    0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x39, 0x99, 0x99, 0x99,
+    0x5F, 0xFF, 0xC9, 0x2F, 0xFF, 0xD9, 0x29, 0xAF, 0x99, 0xAF, 0xC3, 0x9F, 0x3F, 0x92, 0x9F, 0x3A,
+    0xEA, 0x29, 0xF3, 0xAE, 0x92, 0x9F, 0x3A, 0xE3, 0x9F, 0x3F, 0x39, 0xFF, 0xE4, 0x9F, 0xFE, 0xA3,
+    0x9F, 0xFF, 0xA2, 0x9F, 0x3F, 0xC9, 0x19, 0xF4, 0xFA, 0x19, 0xF4, 0xAF, 0x19, 0xF4, 0xAE, 0xA1,
+    0x9F, 0x4F, 0xA1, 0x9F, 0x3F, 0xC1, 0x9A, 0xFF, 0xFA, 0x0F, 0xFF, 0xD9, 0x1F, 0xFF, 0x97, 0x74,
+    0x77, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x19, 0xAF, 0xFF, 0xC2, 0x9F, 0x93, 0xAE, 0x29, 0xF9, 0x3A,
+    0xDA, 0x29, 0xF9, 0x39, 0xDA, 0x29, 0xF9, 0x39, 0xD3, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97,
+    0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29,
+    0xF9, 0x71, 0x9A, 0xFC, 0xA9, 0x6F, 0xFD, 0x6F, 0xFD, 0x60, 0x71, 0xAA, 0x77, 0xAE, 0xA7, 0x59,
+    0xFC, 0x75, 0xFD, 0x97, 0x39, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xE0, 0xF9, 0x71, 0xAD, 0xA0, 0xFC,
+    0x71, 0xE1, 0x9F, 0x70, 0x9E, 0x2F, 0xA7, 0xE9, 0x2F, 0xC7, 0xE3, 0x9F, 0x95, 0xAD, 0xA4, 0xFA,
+    0x5E, 0x94, 0xFC, 0x49, 0xE5, 0x9F, 0x93, 0xEA, 0x6F, 0xA2, 0x9E, 0x96, 0xFC, 0x2A, 0xE7, 0x9F,
+    0x91, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x00, 0x77,
+    0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A, 0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91, 0x9F, 0x94,
+    0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x49,
+    0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9, 0x99, 0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F,
+    0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9,
+    0xFF, 0xFF, 0x00, 0x77, 0x19, 0xFF, 0xFD, 0x19, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x0A, 0xDA,
+    0x4A, 0xFA, 0x1A, 0xD9, 0x39, 0xFC, 0x29, 0xD4, 0xFC, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFC,
+    0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x49, 0xA9, 0x19, 0xFC,
+    0x5E, 0x1F, 0xC5, 0x9E, 0x0A, 0xFA, 0x5F, 0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xE9, 0x09, 0xFF, 0xFD,
+    0x77, 0x10, 0x77, 0x6F, 0xFD, 0x2F, 0xFF, 0xFE, 0xA2, 0xFF, 0xCA, 0x09, 0xAF, 0xA5, 0x9F, 0xCA,
+    0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9,
+    0x39, 0xF9, 0x69, 0xF9, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x39, 0xFF, 0xFF, 0xC9, 0x39,
+    0xFF, 0xFF, 0xC9, 0x39, 0xFA, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9,
+    0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x39, 0xF9, 0x69, 0xF9, 0x29, 0xAF,
+    0xCA, 0x49, 0xFD, 0xA0, 0xFF, 0xD2, 0xFF, 0xFF, 0xF2, 0xFF, 0xD0, 0x79, 0xAA, 0xAA, 0x97, 0x39,
+    0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x7F,
+    0xCA, 0x1F, 0xA7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF7, 0x1A, 0xF9, 0xAF, 0x19, 0xAA, 0xAA,
+    0xA9, 0x09, 0xF9, 0xAF, 0x1F, 0xDA, 0x09, 0xF9, 0xFC, 0x1F, 0xD9, 0x09, 0xF9, 0xFC, 0x29, 0x99,
+    0x99, 0x19, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA,
+    0x6A, 0xF2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7,
+    0x49, 0x99, 0x99, 0x70, 0x72, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49,
+    0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF, 0xD0, 0x77,
+    0x4F, 0xFC, 0xA1, 0xFF, 0x9F, 0xFC, 0x91, 0xFF, 0x19, 0xAF, 0x94, 0xFC, 0x49, 0xF4, 0xAF, 0x59,
+    0xF3, 0xAE, 0xA6, 0x9F, 0x2A, 0xEA, 0x79, 0xF1, 0xAE, 0xA7, 0x09, 0xF0, 0xAE, 0xA7, 0x19, 0xFF,
+    0x97, 0x29, 0xFF, 0xA7, 0x29, 0xFF, 0xC9, 0x71, 0x9F, 0x9F, 0xC9, 0x70, 0x9F, 0x09, 0xFC, 0x70,
+    0x9F, 0x19, 0xFC, 0x79, 0xF2, 0xAF, 0xC6, 0x9F, 0x3F, 0xD5, 0x9F, 0x4F, 0xD9, 0x29, 0xAF, 0xA9,
+    0x3F, 0xD9, 0x0F, 0xFD, 0x29, 0xFD, 0xAF, 0xFC, 0xA4, 0xFC, 0x97, 0x79, 0x99, 0x10, 0x72, 0xAA,
+    0x77, 0x1A, 0xEA, 0x77, 0x0F, 0xC7, 0x7A, 0xFC, 0x77, 0xFD, 0xA7, 0x59, 0xFE, 0x75, 0xE9, 0xF9,
+    0x73, 0x9E, 0x0F, 0xA7, 0x3A, 0xD9, 0x0A, 0xF7, 0x3E, 0x19, 0xF9, 0x71, 0x9E, 0x2F, 0xA7, 0x1E,
+    0x92, 0xAF, 0x70, 0x9E, 0x39, 0xF9, 0x7A, 0xE4, 0xFA, 0x7E, 0x94, 0xAF, 0x6A, 0xE5, 0x9F, 0x95,
+    0xEA, 0x6F, 0xC4, 0x9E, 0x96, 0xFC, 0x39, 0xFA, 0x94, 0x9F, 0xD9, 0x0A, 0xFE, 0x92, 0xFF, 0xCA,
+    0xFF, 0x92, 0xFF, 0xC9, 0x77, 0x74, 0x9F, 0xEA, 0x5A, 0xFE, 0x92, 0x9F, 0xF5, 0xFF, 0x94, 0xAF,
+    0xD5, 0xFD, 0xA6, 0x9F, 0xD9, 0x3A, 0xFD, 0x96, 0xAF, 0xDA, 0x3F, 0xE9, 0x6A, 0xDA, 0xF3, 0xEA,
+    0xEA, 0x6E, 0x9F, 0x91, 0x9D, 0xAA, 0xEA, 0x6E, 0x99, 0xEA, 0x1A, 0xD0, 0x9E, 0xA6, 0xE1, 0xF1,
+    0xE0, 0x9F, 0x6E, 0x1F, 0x09, 0xDA, 0x09, 0xF6, 0xE1, 0xAE, 0x9A, 0xD9, 0x1F, 0x59, 0xE2, 0xEA,
+    0xE2, 0xF5, 0x9E, 0x2F, 0xDA, 0x2F, 0x5A, 0xE2, 0xAF, 0xC9, 0x2F, 0x94, 0xAE, 0x3F, 0xC3, 0xF9,
+    0x4E, 0xA3, 0xFA, 0x3F, 0x94, 0xEA, 0x39, 0xE9, 0x3F, 0xA3, 0x9F, 0x93, 0xE3, 0x9F, 0xCA, 0x1F,
+    0xF2, 0x94, 0xFF, 0xC9, 0xFF, 0x70, 0xFF, 0xC0, 0x77, 0x70, 0xFE, 0x59, 0xFF, 0x1F, 0xF4, 0xAF,
+    0xF2, 0xAF, 0xDA, 0x49, 0xAF, 0x94, 0xAF, 0xD9, 0x5E, 0xA5, 0xAF, 0xE5, 0xEA, 0x5A, 0xFE, 0xA4,
+    0xEA, 0x5A, 0xFF, 0x93, 0xEA, 0x5A, 0xE9, 0xFC, 0x3E, 0xA5, 0xAE, 0x0F, 0xCA, 0x2E, 0xA5, 0xAE,
+    0x1F, 0xC9, 0x1E, 0xA5, 0xAE, 0x19, 0xFC, 0x1E, 0xA5, 0xAE, 0x2A, 0xFC, 0x0E, 0xA5, 0xAE, 0x3F,
+    0xC9, 0xEA, 0x5A, 0xE3, 0x9F, 0xFA, 0x5A, 0xE4, 0xAF, 0xEA, 0x5A, 0xE5, 0xFE, 0xA5, 0xAE, 0x6F,
+    0xDA, 0x49, 0xFA, 0x94, 0xAF, 0xCA, 0x3F, 0xFA, 0x4F, 0xCA, 0x3F, 0xF9, 0x5F, 0xA7, 0x72, 0x99,
+    0x94, 0x77, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x99, 0xE7, 0x0E, 0x99, 0xDA,
+    0x70, 0xE1, 0xDA, 0x70, 0xAD, 0x19, 0xA9, 0x70, 0x9A, 0x77, 0x69, 0xFD, 0xA9, 0x7A, 0xFE, 0xA7,
+    0xAF, 0xEA, 0x70, 0x99, 0x99, 0x99, 0x97, 0x76, 0xAA, 0x72, 0xAA, 0x0A, 0xD7, 0x2D, 0xAE, 0x72,
+    0xFD, 0x97, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x79, 0xAA, 0xAA, 0x97, 0x39, 0xFF,
+    0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96, 0xFC,
+    0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF, 0x9A,
+    0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7,
+    0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD,
+    0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x77, 0x6F, 0xFF, 0xFF, 0xD0,
+    0xFF, 0xFF, 0xFD, 0x19, 0xAF, 0xDA, 0xAA, 0xAF, 0xE9, 0x39, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA,
+    0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9,
+    0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4,
+    0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x39, 0xAF, 0xCA, 0x4A, 0xFC, 0xA9,
+    0x0F, 0xFD, 0x19, 0xFF, 0xC0, 0xFF, 0xD1, 0xAF, 0xFC, 0x00, 0x39, 0x99, 0x99, 0x99, 0x94, 0xFF,
+    0xFC, 0xA2, 0xFF, 0xFE, 0x29, 0xAF, 0xAA, 0xFE, 0x29, 0xF3, 0xFC, 0x29, 0xF3, 0x9F, 0x91, 0x9F,
+    0x4F, 0x91, 0x9F, 0x4F, 0x91, 0x9F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0x99, 0xAF, 0xC3, 0x9F,
+    0xFE, 0x93, 0x9F, 0xFC, 0xA5, 0x9F, 0xAA, 0xA9, 0x79, 0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x39, 0xF7,
+    0x29, 0xAF, 0xAA, 0x96, 0xFF, 0xD6, 0xFF, 0xD6, 0x77, 0x29, 0xFF, 0xFD, 0x91, 0xFF, 0xFE, 0xA1,
+    0xFD, 0xAA, 0xAA, 0xAA, 0xEA, 0x2F, 0xC9, 0x49, 0xDA, 0x29, 0xFC, 0x5D, 0xA3, 0x9F, 0xC4, 0xD9,
+    0x4A, 0xFA, 0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0x97, 0x39, 0xF7, 0x4F, 0x74, 0xF9, 0x73, 0xF9,
+    0x49, 0xD3, 0xF9, 0x5E, 0x2F, 0x95, 0x9E, 0x1F, 0xA5, 0x9F, 0x0A, 0xFF, 0xFE, 0xA0, 0x9F, 0xFF,
+    0xE9, 0x1F, 0xFF, 0xE7, 0x73, 0x77, 0x4F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0E,
+    0x92, 0xFA, 0x2A, 0xDA, 0x0E, 0x3F, 0xA2, 0xAD, 0xA0, 0xE3, 0xFA, 0x2A, 0xD9, 0x1A, 0x93, 0xFA,
+    0x29, 0xA9, 0x70, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA,
+    0x76, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x74, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xD9, 0x70, 0xFF, 0xD9,
+    0x30, 0x29, 0xAA, 0x71, 0x9A, 0x92, 0x9F, 0xC7, 0xFA, 0x0A, 0xFD, 0xA5, 0xAF, 0xA0, 0x9F, 0xE4,
+    0x9F, 0x94, 0x9F, 0x93, 0xFA, 0x6F, 0xC2, 0x9F, 0x79, 0xF2, 0xF7, 0x1F, 0x91, 0xE9, 0x71, 0x9E,
+    0xA0, 0xAE, 0x73, 0xF0, 0xE9, 0x73, 0xAE, 0xAE, 0x75, 0xFD, 0x97, 0x5A, 0xFC, 0x76, 0x9F, 0x97,
+    0x7F, 0x97, 0x7F, 0x97, 0x7F, 0x97, 0x7F, 0x97, 0x59, 0xAF, 0xCA, 0x97, 0x2F, 0xFD, 0x97, 0x1F,
+    0xFD, 0x50, 0x5F, 0xFC, 0x97, 0x3F, 0xFC, 0x97, 0x39, 0xAF, 0xCA, 0x77, 0x9F, 0x75, 0xAF, 0xFD,
+    0xA7, 0xAF, 0xFF, 0xDA, 0x39, 0xFC, 0xAA, 0xF9, 0xFD, 0x2F, 0xA1, 0x9F, 0x19, 0xFA, 0x0A, 0xF2,
+    0x9F, 0x2A, 0xF0, 0xFA, 0x29, 0xF3, 0xF9, 0xF9, 0x29, 0xF3, 0xF9, 0xFA, 0x29, 0xF3, 0xF9, 0xAF,
+    0x29, 0xF2, 0x9F, 0x09, 0xF9, 0x19, 0xF2, 0xFA, 0x1F, 0xCA, 0x09, 0xF0, 0x9F, 0xC3, 0xAF, 0xFF,
+    0xF5, 0x9F, 0xFF, 0xA9, 0x72, 0x9A, 0xF9, 0x77, 0x9F, 0x76, 0x9A, 0xFE, 0x97, 0x3F, 0xFC, 0xA7,
+    0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0x60, 0x77, 0x6A, 0xFF, 0xC1, 0xFF, 0x90, 0xFF, 0xCA, 0x1F, 0xF2,
+    0x9F, 0xD4, 0x9F, 0x95, 0xFC, 0x93, 0xF9, 0x69, 0xFC, 0x2A, 0xE9, 0x70, 0xAF, 0xA0, 0x9E, 0xA7,
+    0x2A, 0xF9, 0xF7, 0x4F, 0xF7, 0x6F, 0xD7, 0x7A, 0xFC, 0x77, 0xFD, 0x97, 0x5A, 0xFE, 0x97, 0x39,
+    0xEA, 0xFC, 0x73, 0xEA, 0x09, 0xFA, 0x71, 0xF2, 0xAF, 0xA7, 0xF9, 0x3F, 0xC9, 0x5A, 0xEA, 0x49,
+    0xFC, 0x4A, 0xFA, 0x93, 0x9F, 0xDA, 0x09, 0xFF, 0xA1, 0xFF, 0xDA, 0xFF, 0x91, 0xFF, 0xD0, 0x09,
+    0x99, 0x77, 0x09, 0xA9, 0x09, 0xF1, 0x9F, 0xFC, 0x2F, 0x1F, 0x90, 0x9F, 0xFC, 0x1A, 0xF1, 0xAE,
+    0xA2, 0x9F, 0xC3, 0xF9, 0x19, 0xF3, 0xAE, 0xA3, 0xF9, 0x2F, 0x3A, 0xEA, 0x3F, 0x3F, 0x3A, 0xEA,
+    0x29, 0xF3, 0xF9, 0x2A, 0xEA, 0x29, 0xF3, 0xF9, 0x2A, 0xEA, 0x29, 0xEA, 0x3A, 0xEA, 0x2A, 0xEA,
+    0x2A, 0xE9, 0x39, 0xF2, 0xAE, 0xA2, 0xF5, 0xFA, 0x1A, 0xEA, 0x1A, 0xEA, 0x59, 0xFC, 0xAF, 0xCA,
+    0xFC, 0x79, 0xFF, 0xFE, 0x72, 0x9F, 0xFD, 0xA9, 0x77, 0xAE, 0xA7, 0x73, 0xAE, 0xA7, 0x73, 0xAE,
+    0xA7, 0x72, 0x9F, 0xC9, 0x97, 0x7F, 0xFC, 0x97, 0x59, 0xFF, 0xC7, 0x71, 0x9A, 0xAA, 0xA9, 0x76,
+    0x9F, 0xFC, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFD, 0xA9, 0xAF, 0xD7, 0xAF, 0xA4, 0xAF, 0xC6, 0xFA,
+    0x6F, 0xC9, 0x4A, 0xF7, 0x9F, 0xA4, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xC4, 0xFA, 0x70, 0xFC,
+    0x4F, 0xC7, 0x0F, 0xC4, 0xFC, 0x70, 0xFA, 0x49, 0xF7, 0x0F, 0x6F, 0x96, 0xAE, 0xA6, 0x9F, 0x6F,
+    0x4A, 0xC9, 0x09, 0xEA, 0x4A, 0xE9, 0x0A, 0xCA, 0x0D, 0xA1, 0x9E, 0x92, 0xAE, 0x91, 0xE0, 0xE2,
+    0x9E, 0x2E, 0x3E, 0x0F, 0xFD, 0x2F, 0xFD, 0x0F, 0xFD, 0x2F, 0xFD, 0x0F, 0xFC, 0x92, 0xAF, 0xFC,
+    0x49, 0xA9, 0x49, 0x99, 0x5A, 0xFC, 0xA1, 0xF4, 0xFF, 0xA9, 0xEA, 0x3A, 0xFA, 0x9E, 0xAE, 0x93,
+    0xF9, 0x2F, 0xD9, 0x29, 0xF4, 0xFC, 0x3A, 0xEA, 0x4A, 0xF3, 0xFA, 0x49, 0xF3, 0xFA, 0x4A, 0xF3,
+    0xFA, 0x4F, 0xC3, 0xFC, 0x4F, 0xC3, 0xAF, 0x3F, 0xD3, 0x9F, 0xA1, 0xAF, 0xD4, 0xFF, 0xCA, 0xFC,
+    0xAA, 0x19, 0xFF, 0x0A, 0xFD, 0x29, 0xFC, 0xA2, 0xFC, 0x94, 0x99, 0x95, 0x99, 0x30, 0x5A, 0xAA,
+    0xA9, 0x70, 0xFF, 0xA5, 0xFF, 0xDA, 0x3F, 0xA9, 0x9F, 0xC2, 0x9E, 0xA3, 0xFA, 0x1A, 0xE9, 0x3A,
+    0xEA, 0x1F, 0x4A, 0xEA, 0x1F, 0x4A, 0xE9, 0x1F, 0x4F, 0x2F, 0x39, 0xE9, 0x2F, 0x1F, 0xCA, 0x3F,
+    0x09, 0xFD, 0x92, 0xF1, 0xFE, 0x91, 0xF3, 0x9F, 0xC1, 0xF5, 0xF9, 0x0F, 0x5A, 0xEA, 0x0F, 0x5A,
+    0xF0, 0xF5, 0xAE, 0xA0, 0xF5, 0xF9, 0x0F, 0x4F, 0xC1, 0xFA, 0xAA, 0xAF, 0xC9, 0x1F, 0xFF, 0x92,
+    0xFF, 0xDA, 0x4F, 0x19, 0x97, 0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xF9, 0x72,
+    0xAA, 0x97, 0x30, 0x39, 0x99, 0x59, 0xA9, 0x1A, 0xFC, 0x49, 0xEA, 0x9F, 0xDA, 0x39, 0xF0, 0xAA,
+    0xFC, 0x3A, 0xF2, 0xAF, 0x92, 0xAF, 0x3F, 0xA2, 0xAE, 0xA3, 0xAF, 0x2F, 0x94, 0xF9, 0x1F, 0x5F,
+    0xA0, 0x9E, 0x95, 0x9F, 0x0A, 0xE7, 0xF0, 0xEA, 0x7A, 0xEA, 0xE7, 0x09, 0xFD, 0x97, 0x1F, 0xCA,
+    0x72, 0xAF, 0x73, 0x9E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x39, 0xEA, 0x73, 0xAE, 0xA7, 0x3F, 0xC7,
+    0x3F, 0xA7, 0x3A, 0xA9, 0x95, 0x59, 0xAA, 0xAA, 0x97, 0xFF, 0xCA, 0x4F, 0xFE, 0x92, 0xAE, 0xA9,
+    0x9A, 0xF9, 0x2F, 0x5A, 0xC3, 0xF9, 0x72, 0xAF, 0xA7, 0x2F, 0xDA, 0x70, 0x9F, 0xE9, 0x7F, 0xFA,
+    0x49, 0xFF, 0xDA, 0x29, 0xF1, 0xAF, 0xC9, 0x1F, 0x92, 0xAF, 0xA0, 0x9F, 0x4F, 0xC0, 0xFC, 0x4A,
+    0xF0, 0xFC, 0x4A, 0xF0, 0xFC, 0x49, 0xF0, 0xFC, 0x4A, 0xF0, 0xAF, 0x93, 0xFA, 0x09, 0xFC, 0x29,
+    0xF9, 0x1F, 0xDA, 0xAF, 0xA3, 0xFF, 0xDA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x49, 0x9A, 0xA9,
+    0x94, 0xFF, 0xC1, 0x9F, 0xFD, 0x90, 0xFA, 0x99, 0x9A, 0xD0, 0x9F, 0x59, 0x09, 0xF7, 0x0F, 0x19,
+    0x94, 0x9F, 0xEA, 0x4F, 0xEA, 0x3F, 0xCA, 0x9A, 0x3A, 0xEA, 0x7F, 0x97, 0xFC, 0x5A, 0xAA, 0xFD,
+    0xAF, 0xA0, 0xFF, 0xE9, 0x1A, 0xFE, 0xA5, 0x99, 0x99, 0x40, 0x09, 0xA7, 0x2D, 0x96, 0x90, 0x9E,
+    0x29, 0x9A, 0xD9, 0x9F, 0xFE, 0x9A, 0xFF, 0xE0, 0x9F, 0xCA, 0xF9, 0x6A, 0xE9, 0x69, 0xEA, 0x69,
+    0xEA, 0x7F, 0x7F, 0x7A, 0xE9, 0x7F, 0x7A, 0xE9, 0x7F, 0x79, 0xEA, 0x7A, 0xEA, 0x7F, 0xA7, 0xFA,
+    0x7F, 0xC7, 0xAF, 0xC9, 0x6F, 0xFA, 0x92, 0xAF, 0xFD, 0x29, 0xFF, 0xC9, 0x49, 0x9A, 0xF9, 0x7A,
+    0xE7, 0x0F, 0x79, 0xE9, 0x7E, 0xA7, 0x19, 0x92, 0x29, 0x9A, 0x93, 0x9A, 0x94, 0xAF, 0xC1, 0xAF,
+    0xCA, 0x2F, 0xD9, 0xFF, 0xA1, 0x9A, 0xFE, 0xAF, 0xD3, 0x9F, 0xC9, 0x1A, 0xF4, 0xFA, 0x3F, 0x93,
+    0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9,
+    0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF9, 0x3F, 0x93, 0xF4, 0xF9, 0x74, 0xF9, 0x74,
+    0xF9, 0x74, 0xF9, 0x74, 0xF9, 0x74, 0xF9, 0x74, 0xF7, 0x5A, 0x99, 0x10, 0x59, 0xAA, 0xAA, 0x71,
+    0x9F, 0xF6, 0x9F, 0xFD, 0x5F, 0xA9, 0xAF, 0xC3, 0xAE, 0x92, 0x9F, 0x92, 0xF4, 0xFA, 0x19, 0xEA,
+    0x49, 0xF1, 0xAE, 0x95, 0xF1, 0xF9, 0x5F, 0x90, 0xF9, 0x5F, 0x90, 0xFC, 0xAA, 0xAA, 0xAA, 0xFA,
+    0x0F, 0xFF, 0xEA, 0x0F, 0xFF, 0xEA, 0x0F, 0x95, 0xFA, 0x0F, 0x95, 0xF9, 0x0F, 0xA5, 0xF9, 0x0A,
+    0xEA, 0x5F, 0x19, 0xF4, 0x9F, 0x2F, 0x93, 0xAE, 0x92, 0xAF, 0x3F, 0x4F, 0xCA, 0xAF, 0x94, 0x9F,
+    0xFC, 0xA7, 0xFE, 0x97, 0x29, 0x99, 0x60, 0x19, 0x99, 0x3A, 0xF3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F,
+    0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFC, 0x3F, 0xDA, 0xA0, 0xAF, 0xE1,
+    0xFD, 0x92, 0x99, 0x93, 0x19, 0x99, 0x59, 0xA2, 0xAF, 0x39, 0xF1, 0xFA, 0x2A, 0xFC, 0x90, 0xFA,
+    0x19, 0xFD, 0x1F, 0xA0, 0x9F, 0xA3, 0xFA, 0x0E, 0xA5, 0xFA, 0xF6, 0xFF, 0xC9, 0x5F, 0xFC, 0xA5,
+    0xFC, 0x9A, 0xE5, 0xFA, 0x09, 0xE9, 0x4F, 0xA1, 0xF4, 0xFA, 0x1F, 0xA3, 0xFA, 0x1A, 0xFE, 0x0F,
+    0xA2, 0xFE, 0x0F, 0x4F, 0xC9, 0x72, 0x99, 0x92, 0x3A, 0xAA, 0x97, 0x4A, 0xFD, 0x73, 0xFF, 0x72,
+    0xCA, 0xAF, 0xC9, 0x75, 0xAF, 0x76, 0xF7, 0x6F, 0x97, 0x5A, 0xEA, 0x75, 0x9F, 0x75, 0xFC, 0x97,
+    0x39, 0xFC, 0xA7, 0x3A, 0xFD, 0x73, 0xFE, 0x72, 0xAF, 0xEA, 0x71, 0xE9, 0xAF, 0x70, 0xAE, 0x09,
+    0xF7, 0x0F, 0x1F, 0x96, 0x9E, 0xA1, 0xAE, 0xA6, 0xF9, 0x19, 0xF5, 0x9F, 0x3F, 0x94, 0xFC, 0x3F,
+    0xCA, 0xA9, 0x09, 0xF9, 0x39, 0xFD, 0xA0, 0xFC, 0x5F, 0xCA, 0x39, 0x97, 0x99, 0x92, 0x29, 0x99,
+    0x69, 0x94, 0xAF, 0x39, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A,
+    0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3A, 0xF4, 0xFA, 0x3F, 0xC4,
+    0xFC, 0x3F, 0xC4, 0xFC, 0x91, 0xAF, 0xC4, 0xFF, 0xDA, 0xFA, 0xA9, 0x0F, 0xFD, 0x0F, 0xD9, 0x0F,
+    0xFC, 0x19, 0xFA, 0x1E, 0xA0, 0x99, 0x94, 0x99, 0x3F, 0x76, 0xF7, 0x6F, 0x97, 0x49, 0xF9, 0x74,
+    0x9F, 0x76, 0xAA, 0x97, 0x60, 0x39, 0x99, 0x59, 0xA9, 0x1A, 0xFC, 0x49, 0xEA, 0x9F, 0xDA, 0x39,
+    0xF0, 0xAA, 0xFC, 0x3A, 0xF2, 0xAF, 0x92, 0xAF, 0x3F, 0xA2, 0xAE, 0xA3, 0xAF, 0x2F, 0x94, 0xF9,
+    0x1F, 0x5A, 0xEA, 0x09, 0xEA, 0x59, 0xF0, 0xAE, 0x7F, 0x0E, 0xA7, 0xAE, 0xAE, 0x70, 0x9F, 0xD9,
+    0x71, 0xFD, 0x72, 0xAF, 0x73, 0x9E, 0xA7, 0x75, 0x0A, 0x97, 0x1A, 0xD7, 0x1A, 0xD9, 0x29, 0x9A,
+    0xC9, 0x0F, 0xFE, 0xA0, 0xFF, 0xE2, 0x9A, 0xAA, 0xF9, 0x5A, 0xE9, 0x6A, 0xE9, 0x69, 0xF7, 0xAE,
+    0xA7, 0xAF, 0x70, 0xFC, 0x97, 0xAF, 0xD9, 0x49, 0xFD, 0x93, 0xFC, 0xAA, 0xA3, 0xF9, 0x69, 0xEA,
+    0x7F, 0x97, 0xF9, 0x7F, 0xA7, 0xAF, 0xA6, 0x9F, 0xEA, 0xA9, 0x29, 0xFF, 0xD3, 0xAF, 0xF9, 0x59,
+    0xAF, 0x97, 0xAE, 0x70, 0xEA, 0x79, 0xE7, 0x0E, 0x97, 0x19, 0x92, 0x59, 0x9A, 0x99, 0x79, 0xFF,
+    0xA4, 0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4,
+    0x9F, 0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0,
+    0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77,
+    0x99, 0x91, 0xAF, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x09, 0xDA, 0x09, 0xE2,
+    0xEA, 0x39, 0xD1, 0x9E, 0x2E, 0x94, 0x99, 0x1A, 0xE2, 0xE7, 0x1A, 0xE1, 0x9E, 0x71, 0xEA, 0x19,
+    0xE7, 0x1E, 0xA1, 0x9E, 0x70, 0x9E, 0xA1, 0x9E, 0x70, 0xAE, 0x91, 0xAE, 0x97, 0xF9, 0x19, 0xF7,
+    0xF9, 0x19, 0xFE, 0x39, 0xF3, 0xFE, 0x3F, 0xA3, 0x9F, 0xA7, 0x75, 0x59, 0x9A, 0x99, 0x70, 0xAF,
+    0xEA, 0x5F, 0xFE, 0x3F, 0xCA, 0x9F, 0xCA, 0x19, 0xF9, 0x2F, 0xC1, 0xFC, 0x39, 0xF9, 0x0F, 0xA3,
+    0x9F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xA3, 0x9F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xA3, 0x9F, 0x1F,
+    0xA3, 0xFC, 0x1F, 0xA2, 0x9F, 0x91, 0xFC, 0xAA, 0xAF, 0xA2, 0xFF, 0xEA, 0x3F, 0xFD, 0x94, 0xF9,
+    0x09, 0x97, 0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xF9, 0x72, 0xAA, 0x97, 0x30,
+    0x59, 0x9A, 0x96, 0xAF, 0xDA, 0x29, 0xFF, 0xCA, 0x09, 0xFA, 0x9F, 0xC0, 0xF9, 0x2F, 0x9F, 0x3E,
+    0x9A, 0xEA, 0x39, 0x91, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xC7, 0xAF, 0x96, 0x9F, 0xCA, 0x6F, 0xFA,
+    0xA9, 0x19, 0xFF, 0xDA, 0x2A, 0xFF, 0xC5, 0x9A, 0xFC, 0x79, 0xEA, 0x79, 0xE7, 0x0E, 0xA7, 0x9E,
+    0x71, 0x99, 0x20, 0x75, 0x99, 0x94, 0x9A, 0xFF, 0xE3, 0xFF, 0xFD, 0x2F, 0xFF, 0xD9, 0x1F, 0xC2,
+    0xAE, 0xA3, 0x9F, 0x93, 0xF3, 0xAF, 0x4A, 0xEA, 0x2F, 0xC4, 0xAF, 0x2F, 0xA4, 0xAF, 0x2F, 0xC4,
+    0xAF, 0x2F, 0xC4, 0xAF, 0x2A, 0xF4, 0xFA, 0x29, 0xFA, 0x29, 0xF4, 0xFD, 0xAA, 0xFA, 0x5F, 0xFD,
+    0xA7, 0xAF, 0xE9, 0x72, 0x99, 0x99, 0x70, 0x74, 0x99, 0x90, 0xAF, 0xFF, 0xC9, 0x0F, 0xFF, 0xD9,
+    0x9F, 0xFF, 0xD0, 0x9D, 0xA1, 0xF5, 0x9D, 0x2F, 0x69, 0x92, 0xF7, 0x3F, 0x72, 0x9F, 0x72, 0x9F,
+    0x72, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0x72, 0x9F, 0xCA, 0xAC, 0x96, 0xFF, 0x96, 0x9F, 0xDA, 0x71,
+    0x99, 0x99, 0x30, 0x39, 0x99, 0x93, 0x9A, 0x93, 0xAF, 0xD3, 0xF2, 0xFE, 0x3F, 0x91, 0x9A, 0xFC,
+    0x3A, 0xF3, 0xAE, 0xA3, 0xAF, 0x3F, 0xA3, 0x9F, 0x3F, 0xA3, 0x9F, 0x92, 0xFA, 0x39, 0xF9, 0x2F,
+    0xA3, 0x9F, 0x92, 0xFC, 0x39, 0xF9, 0x2F, 0xC3, 0xAF, 0x3A, 0xF3, 0xAF, 0x39, 0xF9, 0x2F, 0x94,
+    0xFC, 0xAA, 0xFC, 0x6F, 0xFD, 0x70, 0xFE, 0xA7, 0x39, 0x99, 0x95, 0x72, 0x99, 0x77, 0x1F, 0x77,
+    0x09, 0xF7, 0x70, 0x9E, 0xA7, 0x70, 0x9E, 0xA7, 0x79, 0xAF, 0x99, 0x72, 0xAF, 0xFF, 0x95, 0x9F,
+    0xFF, 0xEA, 0x39, 0xFC, 0xAA, 0xFA, 0xFD, 0x2F, 0xC1, 0x9E, 0xA1, 0xFC, 0x90, 0x9F, 0x29, 0xEA,
+    0x2F, 0xC0, 0xAE, 0xA2, 0x9E, 0xA2, 0xAF, 0x0F, 0xA2, 0x9E, 0xA2, 0x9F, 0x0F, 0x92, 0x9E, 0xA2,
+    0x9F, 0x0F, 0xA2, 0x9E, 0xA2, 0x9F, 0x0F, 0xC2, 0x9E, 0xA2, 0xAF, 0x0A, 0xF9, 0x19, 0xEA, 0x2F,
+    0xA1, 0xFC, 0x90, 0x9E, 0xA1, 0xFC, 0x29, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFE, 0x79, 0xAF, 0xFC,
+    0xA9, 0x74, 0xAE, 0xA7, 0x70, 0x9E, 0xA7, 0x70, 0x9E, 0xA7, 0x70, 0x9E, 0xA7, 0x70, 0xAE, 0xA7,
+    0x70, 0xAE, 0x97, 0x70, 0x9A, 0x97, 0x20, 0x49, 0x95, 0x99, 0x39, 0xFC, 0x93, 0xFA, 0x1F, 0xE2,
+    0x9F, 0x91, 0x9A, 0xFC, 0x91, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x0A, 0xE9, 0x7F, 0x9E, 0xA7, 0x0A,
+    0xFE, 0x72, 0xFD, 0x97, 0x2A, 0xFC, 0x74, 0xF9, 0x74, 0xFC, 0x73, 0x9F, 0xC7, 0x3F, 0xDA, 0x71,
+    0xAF, 0xE7, 0x1E, 0x9A, 0xEA, 0x7F, 0x1F, 0x69, 0xEA, 0x1F, 0xA5, 0xF2, 0x9F, 0x4F, 0xC3, 0xFC,
+    0x91, 0x9F, 0x93, 0xAF, 0xD0, 0xFC, 0x5F, 0xCA, 0x1A, 0xAA, 0x6A, 0xAA, 0x91, 0x74, 0x99, 0x77,
+    0x3A, 0xE9, 0x77, 0x2F, 0x77, 0x3F, 0x77, 0x3F, 0x74, 0x99, 0x99, 0x2F, 0x29, 0xA9, 0x3A, 0xFD,
+    0x2F, 0x2E, 0xA2, 0xFD, 0xA2, 0xF2, 0xF9, 0x19, 0xAF, 0xA2, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2, 0xF2,
+    0xAF, 0x3F, 0xA2, 0xF2, 0x9F, 0x3F, 0xA2, 0xF2, 0x9F, 0x3F, 0xA2, 0xF2, 0x9F, 0x3F, 0xA2, 0xF2,
+    0x9F, 0x3F, 0xA2, 0xF2, 0x9F, 0x3F, 0xC2, 0xF2, 0xFA, 0x3A, 0xF9, 0x1F, 0x19, 0xF9, 0x4F, 0xC9,
+    0x0F, 0x09, 0xFA, 0x59, 0xFF, 0xFF, 0x79, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xCA, 0x77, 0x0F, 0x77,
+    0x3F, 0x77, 0x3F, 0x77, 0x3F, 0x77, 0x3F, 0x77, 0x29, 0xF7, 0x73, 0xA9, 0x97, 0x10, 0x39, 0x97,
+    0x9A, 0x96, 0xF5, 0x9F, 0x4F, 0x96, 0xAE, 0xA2, 0xAF, 0x70, 0xF9, 0x1F, 0x92, 0x99, 0x3A, 0xF0,
+    0x9F, 0x2A, 0xE9, 0x19, 0xF0, 0xAE, 0xA2, 0xF9, 0x2F, 0x9F, 0xA2, 0xAE, 0x3F, 0x9F, 0x92, 0xAE,
+    0x3F, 0x9F, 0x92, 0x9E, 0x3A, 0xE9, 0xFA, 0x2A, 0xE3, 0xF9, 0xAE, 0xA2, 0xAE, 0x92, 0xF0, 0x9F,
+    0x2F, 0xA1, 0x9F, 0x1F, 0xC9, 0xFD, 0xA9, 0xF9, 0x19, 0xFE, 0xA0, 0xFE, 0xA3, 0x9F, 0xCA, 0x19,
+    0xFC, 0x96, 0x99, 0x95, 0x99, 0x94, 0x72, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F,
+    0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9,
+    0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7,
+    0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94,
+    0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92,
+    0x9F, 0xFC, 0x77, 0x77, 0x77, 0x7A, 0xD9, 0x77, 0x19, 0xF7, 0x71, 0xAF, 0x77, 0x19, 0xF7, 0x72,
+    0xAA, 0xA7, 0x20, 0x49, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E,
+    0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2,
+    0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF,
+    0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x97, 0x77, 0x0A, 0xA9, 0x73, 0xFA, 0x72,
+    0xFA, 0x72, 0xF9, 0x73, 0xAA, 0x96, 0x71, 0x97, 0x73, 0xFC, 0xA7, 0x7E, 0xAE, 0xA7, 0x6D, 0x91,
+    0xE7, 0x69, 0xA1, 0x9D, 0xA7, 0x71, 0x9E, 0x77, 0x1E, 0x97, 0x72, 0xD9, 0x77, 0x49, 0x77, 0x69,
+    0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD,
+    0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7,
+    0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69,
+    0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC,
+    0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x59, 0x97, 0x3F, 0xD7, 0x0E,
+    0xAE, 0xA7, 0xDA, 0x1E, 0x79, 0xA9, 0x1D, 0xA7, 0x29, 0xE7, 0x2E, 0xA7, 0x3A, 0xC9, 0x75, 0xA7,
+    0x77, 0x59, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF,
+    0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91,
+    0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90,
+    0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x77, 0x77, 0x7A, 0xA7, 0x74, 0xDA, 0x77, 0x2E,
+    0x97, 0x71, 0xAD, 0x97, 0x4A, 0xDA, 0x1D, 0x97, 0x4A, 0xFA, 0x09, 0x75, 0x9F, 0xDA, 0x75, 0x9E,
+    0x1A, 0xD9, 0x74, 0x9C, 0xA3, 0xA9, 0x77, 0x29, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09,
+    0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F,
+    0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC,
+    0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9,
+    0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9,
+    0x29, 0xFF, 0xC0, 0x73, 0x97, 0x6D, 0x97, 0x39, 0xDA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAD, 0x79,
+    0xAC, 0x90, 0x9C, 0x79, 0xF9, 0x71, 0xFD, 0x97, 0xE9, 0x9E, 0x6A, 0xDA, 0x19, 0xDA, 0x59, 0xA9,
+    0x39, 0x97, 0x77, 0x19, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E,
+    0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2,
+    0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF,
+    0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x77, 0x77, 0x39, 0xC7, 0x74, 0xDA,
+    0x77, 0x3E, 0x97, 0x73, 0xE7, 0x6A, 0xDA, 0x1D, 0x97, 0x4A, 0xFA, 0x1A, 0x74, 0x9F, 0xDA, 0x75,
+    0x9E, 0x1A, 0xD9, 0x74, 0x9C, 0xA3, 0xA9, 0x77, 0x29, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77,
+    0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA,
+    0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99,
+    0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A,
+    0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F,
+    0xF9, 0x29, 0xFF, 0xC0, 0x71, 0x97, 0x5D, 0x74, 0xAD, 0xA7, 0x39, 0xE7, 0x4A, 0xDA, 0x74, 0xAD,
+    0x79, 0xAC, 0x91, 0xAA, 0x69, 0xF9, 0x71, 0xFD, 0x97, 0xE9, 0x9E, 0x6A, 0xDA, 0x19, 0xDA, 0x59,
+    0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA,
+    0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF,
+    0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09,
+    0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x77, 0x77, 0x39, 0xF9, 0x77,
+    0x0D, 0xAE, 0x77, 0x0D, 0x09, 0xD7, 0x72, 0x9D, 0x97, 0x4A, 0xDA, 0x1D, 0x75, 0xAF, 0xA0, 0xA9,
+    0x74, 0x9F, 0xDA, 0x75, 0x9E, 0x1A, 0xD9, 0x74, 0x9C, 0xA3, 0xA9, 0x77, 0x29, 0xA9, 0x77, 0x19,
+    0xF7, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E,
+    0x0A, 0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9,
+    0x71, 0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99,
+    0x99, 0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE,
+    0x92, 0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x77, 0x70, 0x9F, 0x97, 0x1D, 0xAE, 0x70, 0x9C,
+    0xA1, 0xD9, 0x73, 0xAD, 0x72, 0x9E, 0x95, 0x9A, 0xC9, 0x09, 0xCA, 0x69, 0xF9, 0x0A, 0x96, 0xFD,
+    0x97, 0xE9, 0x9E, 0x6A, 0xDA, 0x19, 0xDA, 0x59, 0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A, 0x99, 0x70,
+    0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29,
+    0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2,
+    0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39,
+    0x99, 0x49, 0x92, 0x77, 0x75, 0xEA, 0x1A, 0xC9, 0x74, 0xFD, 0xAD, 0xA7, 0x4D, 0x90, 0xAF, 0x76,
+    0xA2, 0x9A, 0x97, 0x71, 0x9A, 0xA9, 0x77, 0x1A, 0xFA, 0x77, 0xAF, 0xE7, 0x5A, 0xE1, 0xAD, 0xA7,
+    0x4A, 0xCA, 0x3A, 0xA7, 0x72, 0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77,
+    0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9,
+    0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF,
+    0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97,
+    0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC,
+    0x00, 0x29, 0xAA, 0x29, 0x96, 0x9F, 0x90, 0xAC, 0x95, 0xFF, 0xC9, 0x5A, 0xC9, 0x0A, 0xF7, 0xA2,
+    0x9C, 0xA7, 0x77, 0x2F, 0x97, 0x1F, 0xDA, 0x7A, 0xDA, 0x9E, 0xA5, 0xAD, 0xA1, 0x9E, 0x59, 0xAA,
+    0x39, 0xA9, 0x77, 0x70, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3,
+    0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE,
+    0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F,
+    0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x20, 0x70, 0x9D, 0xA7, 0x71, 0x9F,
+    0xA7, 0x70, 0xFE, 0x76, 0xE1, 0xEA, 0x74, 0xE9, 0x2E, 0x74, 0xAA, 0x5A, 0x77, 0x77, 0x71, 0x9A,
+    0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9,
+    0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72,
+    0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E,
+    0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA,
+    0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x77, 0x77, 0x77, 0x7A, 0xD9, 0x77,
+    0x19, 0xF7, 0x71, 0xAF, 0x77, 0x19, 0xF7, 0x72, 0xAA, 0xA7, 0x20, 0x59, 0x97, 0x4F, 0x72, 0x9F,
+    0xC7, 0x1E, 0xAD, 0xA7, 0xE1, 0xE9, 0x59, 0xD9, 0x2D, 0xA6, 0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A,
+    0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29,
+    0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA,
+    0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09,
+    0xF9, 0x39, 0x99, 0x49, 0x97, 0x77, 0x0A, 0xA9, 0x73, 0xFA, 0x72, 0xFA, 0x72, 0xF9, 0x73, 0xAA,
+    0x96, 0x77, 0x77, 0x19, 0xC7, 0x74, 0xDA, 0x77, 0x2A, 0xD9, 0x77, 0x91, 0xDA, 0x77, 0xD1, 0xC9,
+    0x1C, 0x97, 0x4E, 0x91, 0x9D, 0x97, 0x49, 0xFF, 0x76, 0x9F, 0xCA, 0x77, 0x77, 0x72, 0x9A, 0x97,
+    0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA,
+    0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA,
+    0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99,
+    0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90,
+    0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x77, 0x7A, 0x97, 0x49, 0xD9, 0x73,
+    0xE9, 0x72, 0xAD, 0xA7, 0x3D, 0xA7, 0x4A, 0x97, 0x1A, 0xC9, 0x4C, 0xA5, 0xE9, 0x2D, 0xA5, 0xAF,
+    0xF7, 0xAF, 0xCA, 0x72, 0x99, 0x97, 0x77, 0x49, 0x9A, 0x99, 0x70, 0xAF, 0xE9, 0x49, 0xFF, 0xD4,
+    0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A, 0xAF, 0xC4, 0x9F,
+    0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A, 0xF2, 0xAF, 0xAA,
+    0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49, 0x92, 0x77, 0x77,
+    0xC9, 0x77, 0x3A, 0xD7, 0x73, 0x9D, 0xA7, 0x71, 0x90, 0x9D, 0x97, 0x7D, 0x19, 0xC1, 0xC9, 0x74,
+    0xE9, 0x19, 0xD9, 0x74, 0x9F, 0xF7, 0x69, 0xFC, 0xA7, 0x77, 0x77, 0x29, 0xA9, 0x77, 0x19, 0xF7,
+    0x71, 0xFC, 0x77, 0x09, 0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A,
+    0xF7, 0x49, 0xDA, 0x1F, 0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71,
+    0xEA, 0x99, 0x99, 0xFC, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99,
+    0xFC, 0x6F, 0x6A, 0xF9, 0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92,
+    0x9F, 0xFC, 0x0F, 0xF9, 0x29, 0xFF, 0xC0, 0x77, 0x4C, 0x75, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x74,
+    0x9D, 0x97, 0x5C, 0x71, 0xAC, 0x94, 0xCA, 0x5E, 0x92, 0xDA, 0x5A, 0xFF, 0x7A, 0xFC, 0xA7, 0x29,
+    0x99, 0x77, 0x74, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F, 0xA3, 0xEA,
+    0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF, 0xFE, 0x29,
+    0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0, 0x9F, 0xFF,
+    0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x20, 0x77, 0x77, 0xAE, 0x97, 0x70, 0xDA,
+    0xAD, 0x77, 0x0A, 0xC1, 0xD7, 0x72, 0x9D, 0x97, 0x79, 0x1D, 0x19, 0x75, 0xAC, 0x90, 0x99, 0x09,
+    0xC9, 0x74, 0xAD, 0xA9, 0x9A, 0xD7, 0x6F, 0xE7, 0x70, 0x9A, 0xAA, 0x97, 0x74, 0x9A, 0x97, 0x71,
+    0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A, 0xD9, 0xFA, 0x75,
+    0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF, 0x72, 0xEA, 0x3F,
+    0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6, 0x9E, 0x99, 0x99,
+    0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F, 0xCA, 0x90, 0xAF,
+    0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x59, 0x99, 0x72, 0xAF, 0xC7, 0x09, 0xDA,
+    0xAD, 0xA7, 0x0D, 0x1D, 0xA7, 0x3A, 0xD7, 0x29, 0xE7, 0x4D, 0x71, 0xAC, 0x19, 0x2A, 0xA5, 0xE3,
+    0xAC, 0xA5, 0xAF, 0xF7, 0xAF, 0xCA, 0x72, 0x99, 0x97, 0x77, 0x49, 0x9A, 0x99, 0x70, 0xAF, 0xE9,
+    0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29, 0xF7, 0x9A,
+    0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2, 0xFA, 0x2A,
+    0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39, 0x99, 0x49,
+    0x92, 0x77, 0x74, 0x9E, 0x91, 0xAA, 0x75, 0xFD, 0xAD, 0x75, 0xD0, 0x9F, 0xC7, 0x69, 0x29, 0xAA,
+    0x76, 0x99, 0x5C, 0x97, 0x4D, 0xA2, 0x9D, 0x97, 0x4F, 0xFC, 0x76, 0xAF, 0xCA, 0x77, 0x77, 0x72,
+    0x9A, 0x97, 0x71, 0x9F, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xCA, 0x77, 0xFE, 0x77, 0xFE, 0x97, 0x5A,
+    0xD9, 0xFA, 0x75, 0xE0, 0xAF, 0x74, 0x9D, 0xA1, 0xF9, 0x73, 0xE9, 0x1F, 0xC7, 0x29, 0xE2, 0xAF,
+    0x72, 0xEA, 0x3F, 0x97, 0x1E, 0xA9, 0x99, 0x9F, 0xC7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0xA6,
+    0x9E, 0x99, 0x99, 0x99, 0x9F, 0xC6, 0xF6, 0xAF, 0x94, 0x9E, 0x97, 0xFA, 0x39, 0xFA, 0x95, 0x9F,
+    0xCA, 0x90, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0xFF, 0x92, 0x9F, 0xFC, 0x00, 0x39, 0x97, 0x4F, 0x1A,
+    0xC9, 0x5A, 0xFC, 0x9D, 0xA5, 0xDA, 0x0F, 0xC9, 0x59, 0xC2, 0xAD, 0xA7, 0x76, 0xAC, 0x59, 0xC5,
+    0xE9, 0x2A, 0xD5, 0xFF, 0xC9, 0x6A, 0xFD, 0x97, 0x19, 0xA9, 0x97, 0x77, 0x39, 0x9A, 0x99, 0x70,
+    0xAF, 0xE9, 0x49, 0xFF, 0xD4, 0xFA, 0x99, 0xFA, 0x3E, 0xA2, 0xAF, 0x3A, 0xD9, 0x29, 0xF7, 0x29,
+    0xF7, 0x9A, 0xAF, 0xC4, 0x9F, 0xFD, 0x3A, 0xFF, 0xE2, 0x9F, 0x91, 0x9F, 0x2A, 0xEA, 0x29, 0xF2,
+    0xFA, 0x2A, 0xF2, 0xAF, 0xAA, 0xFD, 0xAA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xCA, 0x09, 0xF9, 0x39,
+    0x99, 0x49, 0x92, 0x69, 0x77, 0x4D, 0x94, 0xCA, 0x74, 0xEA, 0x99, 0x9D, 0xA7, 0x4A, 0xFF, 0x76,
+    0xAF, 0xD7, 0x71, 0x9A, 0x97, 0x77, 0x77, 0x49, 0xA9, 0x77, 0x19, 0xF7, 0x71, 0xFC, 0x77, 0x09,
+    0xFC, 0xA7, 0x7F, 0xE7, 0x7F, 0xE9, 0x75, 0xAD, 0x9F, 0xA7, 0x5E, 0x0A, 0xF7, 0x49, 0xDA, 0x1F,
+    0x97, 0x3E, 0x91, 0xFC, 0x72, 0x9E, 0x2A, 0xF7, 0x2E, 0xA3, 0xF9, 0x71, 0xEA, 0x99, 0x99, 0xFC,
+    0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xDA, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xFC, 0x6F, 0x6A, 0xF9,
+    0x49, 0xE9, 0x7F, 0xA3, 0x9F, 0xA9, 0x59, 0xFC, 0xA9, 0x0A, 0xFE, 0x92, 0x9F, 0xFC, 0x0F, 0xF9,
+    0x29, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0xAD, 0x97, 0x71, 0x9F, 0x77, 0x1A, 0xF7, 0x71, 0x9F, 0x77,
+    0x2A, 0xAA, 0x72, 0x29, 0x75, 0xAC, 0xA4, 0xCA, 0x5E, 0xA9, 0x09, 0xDA, 0x5A, 0xFF, 0x7A, 0xFC,
+    0xA7, 0x29, 0x99, 0x77, 0x74, 0x99, 0xA9, 0x97, 0x0A, 0xFE, 0x94, 0x9F, 0xFD, 0x4F, 0xA9, 0x9F,
+    0xA3, 0xEA, 0x2A, 0xF3, 0xAD, 0x92, 0x9F, 0x72, 0x9F, 0x79, 0xAA, 0xFC, 0x49, 0xFF, 0xD3, 0xAF,
+    0xFE, 0x29, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0x9F, 0x2F, 0xA2, 0xAF, 0x2A, 0xFA, 0xAF, 0xDA, 0xA0,
+    0x9F, 0xFF, 0xD9, 0x09, 0xFC, 0xA0, 0x9F, 0x93, 0x99, 0x94, 0x99, 0x77, 0x70, 0xAA, 0x97, 0x3F,
+    0xA7, 0x2F, 0xA7, 0x2F, 0x97, 0x3A, 0xA9, 0x60, 0x77, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A,
+    0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9,
+    0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9,
+    0x99, 0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19,
+    0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x77, 0x77, 0x71, 0xAC, 0xA7,
+    0x4A, 0xF7, 0x3F, 0xC7, 0x3A, 0xEA, 0x74, 0xAA, 0xA6, 0x59, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF,
+    0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC,
+    0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F,
+    0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x77, 0x7A, 0xA9, 0x71, 0xFA, 0x70, 0xFA,
+    0x70, 0xF9, 0x71, 0xAA, 0x94, 0x79, 0x74, 0x9F, 0xC9, 0x70, 0x9E, 0xAE, 0x70, 0xAD, 0x1A, 0xD9,
+    0x70, 0xAA, 0x1A, 0xD9, 0x73, 0xAD, 0xA7, 0x29, 0xDA, 0x97, 0x4D, 0x76, 0x99, 0x77, 0x70, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19, 0xF9, 0x49, 0xD9,
+    0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE,
+    0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5D,
+    0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xF0, 0x59, 0x99, 0x70, 0xAF, 0xC9, 0x59, 0xEA, 0xE5, 0xAD, 0x1A, 0xD9, 0x5A, 0xA1, 0xE7, 0x1A,
+    0xD9, 0x79, 0xDA, 0x97, 0x1D, 0x73, 0x99, 0x77, 0x71, 0x9A, 0x99, 0x69, 0xFE, 0xA3, 0xAF, 0xFC,
+    0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9, 0xEA, 0x3A, 0xEA, 0xAE, 0xA3, 0xAE, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x90, 0xF9, 0x70, 0xAF, 0x70, 0x9F, 0xA5, 0x91, 0xFF,
+    0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x59, 0x75, 0xAE, 0xA1, 0xD6, 0x9F, 0xCA,
+    0xAD, 0x69, 0xDA, 0xFD, 0x7D, 0x1A, 0xE9, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90,
+    0x9A, 0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29,
+    0xF9, 0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F,
+    0xA9, 0x99, 0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA,
+    0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x3A, 0xCA, 0x2A,
+    0x5F, 0xC0, 0x9D, 0x39, 0xFF, 0xC3, 0x9D, 0x09, 0xFA, 0x49, 0x91, 0x9A, 0xCA, 0x77, 0x77, 0x49,
+    0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A, 0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE,
+    0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x0F, 0x97,
+    0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x30,
+    0x77, 0x77, 0x0C, 0x97, 0x6A, 0xD7, 0x59, 0xE7, 0x5E, 0x70, 0xE9, 0x09, 0xD7, 0x0F, 0xC9, 0x0A,
+    0x70, 0xAD, 0xAE, 0x97, 0x0A, 0xDA, 0x1E, 0x70, 0xAC, 0x93, 0xA9, 0x77, 0x6F, 0xFF, 0xF9, 0x0F,
+    0xFF, 0xF9, 0x19, 0xAF, 0xFF, 0xC9, 0x29, 0xF9, 0x4A, 0xD9, 0x29, 0xF9, 0x49, 0xD9, 0x29, 0xF9,
+    0x5C, 0xA3, 0x9F, 0x97, 0x39, 0xF9, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFE, 0x94, 0x9F,
+    0xFE, 0x59, 0xFA, 0x99, 0x99, 0x99, 0x59, 0xF9, 0x73, 0x9F, 0x97, 0x39, 0xF9, 0x5D, 0x92, 0x9F,
+    0x94, 0x9D, 0xA2, 0x9F, 0x94, 0xEA, 0x19, 0xAF, 0xFF, 0xC9, 0x0F, 0xFF, 0xF9, 0x0F, 0xFF, 0xF1,
+    0x74, 0x97, 0x5A, 0xCA, 0x74, 0xE7, 0x39, 0xE7, 0x3E, 0x97, 0x29, 0xD9, 0x7A, 0xAA, 0x1C, 0x97,
+    0xFC, 0x71, 0xAF, 0xD7, 0x9E, 0x0E, 0xA5, 0x9E, 0x2E, 0x6A, 0xA4, 0xA7, 0x77, 0x29, 0xA9, 0x97,
+    0x09, 0xFE, 0xA5, 0xAF, 0xFC, 0xA3, 0x9F, 0x99, 0xAF, 0x3F, 0x3F, 0xA1, 0x9E, 0xA3, 0xAE, 0xA1,
+    0xAE, 0xA3, 0xAE, 0xA1, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA1, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x2F,
+    0x97, 0x2A, 0xF7, 0x29, 0xFA, 0x59, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0x5A, 0xFF, 0x97, 0x09, 0x99,
+    0x95, 0x77, 0x73, 0xAA, 0x75, 0x9D, 0x97, 0x5E, 0x75, 0x9D, 0xA7, 0x0E, 0x90, 0x9D, 0x7F, 0xC9,
+    0x1A, 0x6A, 0xDA, 0xE9, 0x7A, 0xDA, 0x1E, 0x7A, 0xC9, 0x3A, 0x97, 0x74, 0xFF, 0xFF, 0x9F, 0xFF,
+    0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19, 0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C,
+    0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE,
+    0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94,
+    0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x77, 0x6A,
+    0xCA, 0x72, 0xE7, 0x2E, 0xA7, 0x2E, 0x72, 0x9D, 0x95, 0xAA, 0xA1, 0x9C, 0x5F, 0xC7, 0xAF, 0xD5,
+    0x9E, 0x0E, 0xA3, 0x9E, 0x2E, 0x4A, 0xA4, 0xA7, 0x76, 0x9A, 0x99, 0x69, 0xFE, 0xA3, 0xAF, 0xFC,
+    0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9, 0xEA, 0x3A, 0xEA, 0xAE, 0xA3, 0xAE, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x90, 0xF9, 0x70, 0xAF, 0x70, 0x9F, 0xA5, 0x91, 0xFF,
+    0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x77, 0x73, 0xAE, 0xA7, 0x29, 0xDA, 0xDA,
+    0x71, 0x9C, 0x90, 0xAC, 0xA7, 0x4A, 0xD7, 0xE9, 0x0A, 0xCA, 0x7F, 0xC9, 0x0A, 0x96, 0xAD, 0xAE,
+    0x97, 0xAD, 0xA1, 0xE7, 0xAC, 0x93, 0xA9, 0x77, 0x4F, 0xFF, 0xF9, 0xFF, 0xFF, 0x90, 0x9A, 0xFF,
+    0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA, 0x29, 0xF9, 0x72,
+    0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0x9F, 0xA9, 0x99,
+    0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49, 0xDA, 0x19, 0xF9,
+    0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x77, 0x71, 0xFA, 0x71, 0xEA,
+    0xDA, 0x70, 0xD1, 0xAD, 0x71, 0x91, 0xDA, 0x72, 0xAD, 0xA6, 0xAA, 0xA1, 0xD7, 0xFC, 0x09, 0xA6,
+    0xAF, 0xD7, 0x9E, 0x0E, 0xA5, 0x9E, 0x2E, 0x6A, 0xA4, 0xA7, 0x77, 0x29, 0xA9, 0x97, 0x09, 0xFE,
+    0xA5, 0xAF, 0xFC, 0xA3, 0x9F, 0x99, 0xAF, 0x3F, 0x3F, 0xA1, 0x9E, 0xA3, 0xAE, 0xA1, 0xAE, 0xA3,
+    0xAE, 0xA1, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0xA1, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x2F, 0x97, 0x2A,
+    0xF7, 0x29, 0xFA, 0x59, 0x3F, 0xFF, 0x92, 0x9F, 0xFE, 0x5A, 0xFF, 0x97, 0x09, 0x99, 0x95, 0x77,
+    0x49, 0xE9, 0x1D, 0x7F, 0xDA, 0xD9, 0x59, 0xD1, 0xFC, 0x79, 0x92, 0x9A, 0x97, 0x3A, 0xAA, 0x74,
+    0xFC, 0x97, 0x1F, 0xE9, 0x7E, 0xA1, 0xE7, 0xAC, 0x93, 0xA9, 0x77, 0x4F, 0xFF, 0xF9, 0xFF, 0xFF,
+    0x90, 0x9A, 0xFF, 0xFC, 0x91, 0x9F, 0x94, 0xAD, 0x91, 0x9F, 0x94, 0x9D, 0x91, 0x9F, 0x95, 0xCA,
+    0x29, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xE9, 0x39, 0xFF, 0xE4,
+    0x9F, 0xA9, 0x99, 0x99, 0x94, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0xD9, 0x19, 0xF9, 0x49,
+    0xDA, 0x19, 0xF9, 0x4E, 0xA0, 0x9A, 0xFF, 0xFC, 0x9F, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x3A, 0xA9,
+    0x2A, 0x5F, 0xA0, 0x9C, 0xA3, 0x9F, 0xFC, 0x39, 0xCA, 0x09, 0xF9, 0x49, 0x92, 0xAA, 0x97, 0x75,
+    0xAE, 0xA7, 0x9F, 0xD5, 0x9E, 0x9F, 0x39, 0xE9, 0x1E, 0x93, 0xAA, 0x4A, 0x97, 0x75, 0x9A, 0x99,
+    0x69, 0xFE, 0xA3, 0xAF, 0xFC, 0xA1, 0x9F, 0x99, 0xAF, 0x1F, 0x3F, 0xA9, 0xEA, 0x3A, 0xEA, 0xAE,
+    0xA3, 0xAE, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x90, 0xF9, 0x70, 0xAF,
+    0x70, 0x9F, 0xA5, 0x91, 0xFF, 0xF9, 0x09, 0xFF, 0xE3, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x6A, 0xD9,
+    0x73, 0xAF, 0x97, 0x1A, 0xFD, 0x97, 0x9E, 0x09, 0xE9, 0x5A, 0xE2, 0x9D, 0xA6, 0xAA, 0x49, 0xA7,
+    0x77, 0x75, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0x09, 0xAF, 0xFF, 0xC9, 0x19, 0xF9, 0x4A, 0xD9, 0x19,
+    0xF9, 0x49, 0xD9, 0x19, 0xF9, 0x5C, 0xA2, 0x9F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0xAA, 0xAA, 0xAA,
+    0xA4, 0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0x49, 0xFA, 0x99, 0x99, 0x99, 0x49, 0xF9, 0x72, 0x9F, 0x97,
+    0x29, 0xF9, 0x5D, 0x91, 0x9F, 0x94, 0x9D, 0xA1, 0x9F, 0x94, 0xEA, 0x09, 0xAF, 0xFF, 0xC9, 0xFF,
+    0xFF, 0x9F, 0xFF, 0xF7, 0x77, 0x77, 0x1A, 0xCA, 0x74, 0xAF, 0x73, 0xFC, 0x73, 0xAE, 0xA7, 0x4A,
+    0xAA, 0x60, 0x69, 0x97, 0x19, 0xEA, 0x70, 0xFC, 0x96, 0xAD, 0xAE, 0x59, 0xDA, 0x09, 0xDA, 0x4E,
+    0x2A, 0xD4, 0x9A, 0x4A, 0x77, 0x69, 0xA9, 0x96, 0x9F, 0xEA, 0x3A, 0xFF, 0xCA, 0x19, 0xF9, 0x9A,
+    0xF1, 0xF3, 0xFA, 0x9E, 0xA3, 0xAE, 0xAA, 0xEA, 0x3A, 0xEA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0x97, 0x0A, 0xF7, 0x09, 0xFA, 0x59, 0x1F, 0xFF, 0x90, 0x9F, 0xFE,
+    0x3A, 0xFF, 0x96, 0x99, 0x99, 0x77, 0x7A, 0xA9, 0x71, 0xFA, 0x70, 0xFA, 0x70, 0xF9, 0x71, 0xAA,
+    0x94, 0x49, 0x6A, 0xFC, 0x3A, 0xFE, 0x2D, 0xA1, 0xE2, 0x9A, 0x91, 0xE5, 0x9E, 0x94, 0xEA, 0x69,
+    0xCA, 0x70, 0x97, 0x70, 0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF, 0xD0, 0x39, 0x99,
+    0x4A, 0xFC, 0x91, 0x9E, 0xAE, 0x1A, 0xD1, 0xAD, 0x2A, 0xA1, 0xE5, 0xAD, 0x93, 0x9D, 0xA6, 0xD7,
+    0x99, 0x77, 0x29, 0x93, 0xAF, 0xCA, 0x19, 0xFD, 0xA2, 0x9A, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4,
+    0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA3, 0x9F, 0xC9, 0x1F, 0xFA, 0x0F, 0xFA, 0x72,
+    0xFF, 0xD0, 0xFF, 0xD1, 0x9A, 0xFA, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9, 0x49, 0xF9,
+    0x49, 0xF9, 0x39, 0xAF, 0xCA, 0x90, 0xFF, 0xD0, 0xFF, 0xD7, 0x77, 0x19, 0xDA, 0x6F, 0x94, 0x9F,
+    0x95, 0xF9, 0x59, 0xAA, 0x93, 0x39, 0x96, 0xFA, 0x39, 0xFC, 0x39, 0xFC, 0x4A, 0xE9, 0x77, 0x72,
+    0x99, 0x3A, 0xFC, 0xA1, 0x9F, 0xDA, 0x29, 0xAF, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA,
+    0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x39, 0xFC, 0x91, 0xFF, 0xA0, 0xFF, 0xA7, 0x77, 0xAA, 0x95,
+    0xFA, 0x4F, 0xA4, 0xF9, 0x5A, 0xA9, 0x20, 0x79, 0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF,
+    0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9, 0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79,
+    0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A, 0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9,
+    0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF, 0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC,
+    0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA, 0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF,
+    0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x77, 0x77, 0x6A, 0xCA, 0x77, 0x0F, 0xA7, 0x7F, 0xA7,
+    0x7F, 0xA7, 0x70, 0xAA, 0x97, 0x00, 0x59, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9F,
+    0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F, 0x9F,
+    0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA,
+    0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x77, 0x74, 0x9A, 0xA7, 0x39, 0xF7, 0x2A,
+    0xF7, 0x29, 0xF7, 0x3A, 0xAA, 0x60, 0x71, 0x97, 0x70, 0xAF, 0xC9, 0x74, 0x9E, 0xAE, 0x74, 0xAD,
+    0x1A, 0xD9, 0x74, 0xAA, 0x1E, 0x77, 0x9A, 0xDA, 0x76, 0xAD, 0xA9, 0x77, 0x0D, 0x77, 0x29, 0x97,
+    0x71, 0x9A, 0xAA, 0xA9, 0x73, 0x9F, 0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93,
+    0xAF, 0x94, 0xFD, 0x29, 0xF9, 0x6F, 0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9,
+    0x70, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF,
+    0x9A, 0xF9, 0x70, 0xAF, 0x09, 0xFA, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29,
+    0xFC, 0xA4, 0xAF, 0x4A, 0xFE, 0xAF, 0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99,
+    0x97, 0x00, 0x59, 0x99, 0x72, 0x9F, 0xCA, 0x70, 0xEA, 0xEA, 0x7D, 0x91, 0xDA, 0x79, 0xA1, 0x9D,
+    0xA7, 0x29, 0xE7, 0x2E, 0xA7, 0x3A, 0xC9, 0x75, 0x97, 0x77, 0x59, 0x9A, 0x99, 0x79, 0xFF, 0xA4,
+    0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F,
+    0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F,
+    0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x77,
+    0x5C, 0x97, 0x71, 0xAD, 0x77, 0x09, 0xE7, 0x70, 0xE7, 0x3E, 0x90, 0x9D, 0x73, 0xFC, 0x90, 0xA7,
+    0x3E, 0xAE, 0x97, 0x3A, 0xD9, 0x09, 0xE7, 0x3A, 0xC9, 0x3A, 0x76, 0x9A, 0xAA, 0xA9, 0x73, 0x9F,
+    0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93, 0xAF, 0x94, 0xFD, 0x29, 0xF9, 0x6F,
+    0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9, 0x70, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9,
+    0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF, 0x9A, 0xF9, 0x70, 0xAF, 0x09, 0xFA,
+    0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29, 0xFC, 0xA4, 0xAF, 0x4A, 0xFE, 0xAF,
+    0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x74, 0x97, 0x6D, 0x74,
+    0xAD, 0xA7, 0x3E, 0x97, 0x2A, 0xDA, 0x73, 0xDA, 0x79, 0xAC, 0x1A, 0xA7, 0xAF, 0x97, 0x09, 0xFD,
+    0x97, 0xE9, 0xAE, 0x6E, 0x91, 0xAD, 0x95, 0x9A, 0x93, 0xA9, 0x77, 0x71, 0x99, 0xA9, 0x97, 0x9F,
+    0xFA, 0x49, 0xFF, 0xDA, 0x29, 0xFA, 0x9A, 0xFC, 0x91, 0xFA, 0x3F, 0xC0, 0x9F, 0x4A, 0xF0, 0xAF,
+    0x49, 0xF9, 0xFC, 0x49, 0xF9, 0xFA, 0x5F, 0x9F, 0xC4, 0x9F, 0x9F, 0xC4, 0x9F, 0x0A, 0xF4, 0xAF,
+    0x09, 0xFC, 0x3F, 0x91, 0xFD, 0xAA, 0xFC, 0x3F, 0xFE, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x77,
+    0x77, 0x1A, 0xA7, 0x71, 0xAD, 0x77, 0x19, 0xE7, 0x71, 0x9D, 0xA7, 0x4E, 0x90, 0x9D, 0x73, 0xFC,
+    0x91, 0x97, 0x2E, 0xAE, 0x97, 0x3A, 0xD9, 0x09, 0xE7, 0x3A, 0xC9, 0x3A, 0x76, 0x9A, 0xAA, 0xA9,
+    0x73, 0x9F, 0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93, 0xAF, 0x94, 0xFD, 0x29,
+    0xF9, 0x6F, 0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9, 0x70, 0xAF, 0x9A, 0xF7,
+    0x1A, 0xF9, 0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF, 0x9A, 0xF9, 0x70, 0xAF,
+    0x09, 0xFA, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29, 0xFC, 0xA4, 0xAF, 0x4A,
+    0xFE, 0xAF, 0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x72, 0x97,
+    0x5D, 0x74, 0xAD, 0x97, 0x39, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x9A, 0xC2, 0xCA, 0x6A, 0xF9, 0x70,
+    0x9F, 0xD9, 0x7E, 0x9A, 0xE6, 0xE9, 0x1A, 0xD9, 0x59, 0xA9, 0x3A, 0x97, 0x77, 0x19, 0x9A, 0x99,
+    0x79, 0xFF, 0xA4, 0x9F, 0xFD, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF,
+    0x0A, 0xF4, 0x9F, 0x9F, 0xC4, 0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF,
+    0x4A, 0xF0, 0x9F, 0xC3, 0xF9, 0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99,
+    0x60, 0x77, 0x77, 0x1A, 0xEA, 0x76, 0x9D, 0xAD, 0x97, 0x59, 0xC9, 0x0D, 0x97, 0x70, 0xAD, 0x73,
+    0xE9, 0x0A, 0xCA, 0x73, 0xFC, 0x90, 0xA7, 0x3E, 0xAE, 0x97, 0x3A, 0xD9, 0x09, 0xE7, 0x3A, 0xC9,
+    0x3A, 0x76, 0x9A, 0xAA, 0xA9, 0x73, 0x9F, 0xFC, 0xA7, 0x0A, 0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD,
+    0x93, 0xAF, 0x94, 0xFD, 0x29, 0xF9, 0x6F, 0xCA, 0x1F, 0xC7, 0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09,
+    0xF9, 0x70, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xAF, 0x71, 0xAF, 0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71,
+    0xAF, 0x9A, 0xF9, 0x70, 0xAF, 0x09, 0xFA, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC,
+    0x29, 0xFC, 0xA4, 0xAF, 0x4A, 0xFE, 0xAF, 0xD9, 0x5A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99,
+    0x99, 0x97, 0x00, 0x77, 0x72, 0xAF, 0x97, 0x19, 0xDA, 0xE7, 0x19, 0xCA, 0x09, 0xD9, 0x74, 0xAD,
+    0x73, 0x9E, 0x79, 0xAC, 0x1A, 0xCA, 0x7A, 0xF9, 0x0A, 0x96, 0x9F, 0xD9, 0x70, 0xE9, 0xAE, 0x7E,
+    0x91, 0xAD, 0x96, 0x9A, 0x93, 0xA9, 0x77, 0x73, 0x99, 0xA9, 0x97, 0x09, 0xFF, 0xA5, 0x9F, 0xFD,
+    0xA3, 0x9F, 0xA9, 0xAF, 0xC9, 0x2F, 0xA3, 0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F, 0x90, 0xFC,
+    0x49, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xC4, 0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A, 0xF1, 0x9F,
+    0xC3, 0xF9, 0x2F, 0xDA, 0xAF, 0xC4, 0xFF, 0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70, 0x77, 0x72,
+    0xAE, 0x91, 0xD7, 0x29, 0xFC, 0xAA, 0xD7, 0x29, 0xD0, 0x9F, 0xA7, 0x39, 0x92, 0x9A, 0x97, 0x7A,
+    0xAA, 0x77, 0x0F, 0xC9, 0x75, 0xEA, 0xE9, 0x73, 0xEA, 0x09, 0xE7, 0x29, 0xD9, 0x3A, 0x97, 0x59,
+    0xAA, 0xAA, 0x97, 0x39, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0x95, 0xFD, 0xAA, 0xAF, 0xD9, 0x3A, 0xF9,
+    0x4F, 0xD2, 0x9F, 0x96, 0xFC, 0xA1, 0xFC, 0x79, 0xFC, 0x1F, 0x97, 0x0F, 0xC0, 0x9F, 0x97, 0x0A,
+    0xF9, 0xAF, 0x71, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xFC, 0x71, 0x9F, 0x9F, 0xC7, 0x1A, 0xF9, 0xAF,
+    0x97, 0x0A, 0xF0, 0x9F, 0xA7, 0x0F, 0xC1, 0xFC, 0x70, 0xF9, 0x1F, 0xCA, 0x6F, 0xC2, 0x9F, 0xCA,
+    0x4A, 0xF4, 0xAF, 0xEA, 0xFD, 0x95, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70,
+    0x39, 0xAA, 0x29, 0x96, 0xAF, 0x1D, 0x6F, 0xFC, 0x6D, 0x1F, 0xC7, 0xA2, 0xAC, 0xA7, 0x77, 0x19,
+    0xF9, 0x71, 0xFD, 0x97, 0xEA, 0xAE, 0x95, 0xEA, 0x19, 0xE5, 0xAA, 0x93, 0x9A, 0x77, 0x71, 0x99,
+    0xA9, 0x97, 0x9F, 0xFA, 0x49, 0xFF, 0xDA, 0x29, 0xFA, 0x9A, 0xFC, 0x91, 0xFA, 0x3F, 0xC0, 0x9F,
+    0x4A, 0xF0, 0xAF, 0x49, 0xF9, 0xFC, 0x49, 0xF9, 0xFA, 0x5F, 0x9F, 0xC4, 0x9F, 0x9F, 0xC4, 0x9F,
+    0x0A, 0xF4, 0xAF, 0x09, 0xFC, 0x3F, 0x91, 0xFD, 0xAA, 0xFC, 0x3F, 0xFE, 0x5A, 0xFE, 0x97, 0x09,
+    0x99, 0x96, 0x70, 0xE7, 0x70, 0xFC, 0x97, 0x5A, 0xFD, 0x97, 0x3A, 0xDA, 0x09, 0xE7, 0x2A, 0xDA,
+    0x29, 0xDA, 0x72, 0xAA, 0x49, 0x97, 0x77, 0x72, 0x9A, 0xAA, 0xA9, 0x73, 0x9F, 0xFC, 0xA7, 0x0A,
+    0xFF, 0xF9, 0x5F, 0xDA, 0xAA, 0xFD, 0x93, 0xAF, 0x94, 0xFD, 0x29, 0xF9, 0x6F, 0xCA, 0x1F, 0xC7,
+    0x9F, 0xC1, 0xF9, 0x70, 0xFC, 0x09, 0xF9, 0x70, 0xAF, 0x9A, 0xF7, 0x1A, 0xF9, 0xAF, 0x71, 0xAF,
+    0x9F, 0xC7, 0x19, 0xF9, 0xFC, 0x71, 0xAF, 0x9A, 0xF9, 0x70, 0xAF, 0x09, 0xFA, 0x70, 0xFC, 0x1F,
+    0xC7, 0x0F, 0x91, 0xFC, 0xA6, 0xFC, 0x29, 0xFC, 0xA4, 0xAF, 0x4A, 0xFE, 0xAF, 0xD9, 0x5A, 0xFF,
+    0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x77, 0x76, 0xAC, 0xA7, 0x70, 0xFA, 0x77, 0xFA,
+    0x77, 0xFA, 0x77, 0x0A, 0xA9, 0x70, 0x69, 0xA7, 0x4F, 0x72, 0xAF, 0xC7, 0x1F, 0xDA, 0x7E, 0x1E,
+    0x6A, 0xD9, 0x2D, 0xA6, 0xA9, 0x39, 0x97, 0x77, 0x19, 0x9A, 0x99, 0x79, 0xFF, 0xA4, 0x9F, 0xFD,
+    0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x1F, 0xA3, 0xFC, 0x09, 0xF4, 0xAF, 0x0A, 0xF4, 0x9F, 0x9F, 0xC4,
+    0x9F, 0x9F, 0xA5, 0xF9, 0xFC, 0x49, 0xF9, 0xFC, 0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0x9F, 0xC3, 0xF9,
+    0x1F, 0xDA, 0xAF, 0xC3, 0xFF, 0xE5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x77, 0x74, 0x9A, 0xA7, 0x39,
+    0xF7, 0x2A, 0xF7, 0x29, 0xF7, 0x3A, 0xAA, 0x60, 0x77, 0x77, 0x19, 0xC7, 0x72, 0xEA, 0x77, 0x9F,
+    0xA7, 0x6A, 0xFC, 0x97, 0x59, 0xFA, 0x39, 0xE7, 0x0A, 0x96, 0x9F, 0x77, 0x09, 0xF7, 0x9A, 0xAA,
+    0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F, 0x4A, 0xFF, 0xFE, 0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9,
+    0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC, 0x79, 0xFC, 0x2F, 0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A,
+    0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0F, 0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A,
+    0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA, 0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC,
+    0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF, 0xD9, 0x6A, 0xFF, 0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99,
+    0x99, 0x97, 0x10, 0x77, 0x70, 0x9C, 0x97, 0x5E, 0x74, 0xAE, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x4A,
+    0xCA, 0x29, 0xAA, 0x97, 0x4A, 0xE9, 0x73, 0x9E, 0x95, 0x99, 0xA9, 0x90, 0x9E, 0x39, 0xFF, 0xEA,
+    0x29, 0xFF, 0xEA, 0x29, 0xFA, 0x9A, 0xFC, 0x92, 0xFA, 0x3F, 0xC1, 0x9F, 0x4A, 0xF1, 0xAF, 0x49,
+    0xF9, 0x0F, 0xC4, 0x9F, 0x90, 0xFA, 0x5F, 0x90, 0xFC, 0x49, 0xF9, 0x0F, 0xC4, 0x9F, 0x1A, 0xF4,
+    0xAF, 0x19, 0xFC, 0x3F, 0x92, 0xFD, 0xAA, 0xFC, 0x4F, 0xFE, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x97,
+    0x77, 0x73, 0x9C, 0x77, 0x3E, 0xA7, 0x71, 0xFC, 0x77, 0x0A, 0xFC, 0x97, 0x79, 0xAF, 0x39, 0xE7,
+    0x39, 0x93, 0x9F, 0x77, 0x09, 0xF7, 0x9A, 0xAA, 0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F, 0x4A,
+    0xFF, 0xFE, 0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC, 0x79,
+    0xFC, 0x2F, 0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7, 0x1A,
+    0xF9, 0x0F, 0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA, 0x70,
+    0xFC, 0x2F, 0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF, 0xD9,
+    0x6A, 0xFF, 0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97, 0x10, 0x77, 0x49, 0xC7, 0x6E, 0x75,
+    0xF7, 0x4A, 0xEA, 0x74, 0x9E, 0x97, 0x5D, 0x91, 0x9A, 0xA9, 0x74, 0xAE, 0x97, 0x39, 0xE9, 0x59,
+    0x9A, 0x99, 0x09, 0xE3, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x2F, 0xA3,
+    0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F, 0x90, 0xFC, 0x49, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xC4,
+    0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A, 0xF1, 0x9F, 0xC3, 0xF9, 0x2F, 0xDA, 0xAF, 0xC4, 0xFF,
+    0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70, 0x71, 0x97, 0x71, 0xAF, 0xC9, 0x75, 0x9E, 0xAE, 0x75,
+    0xAD, 0x1A, 0xD9, 0x75, 0xAA, 0x1E, 0x77, 0x09, 0xAD, 0xA7, 0x7A, 0xDA, 0x93, 0x9E, 0x71, 0xD5,
+    0x9F, 0x70, 0x99, 0x59, 0xF7, 0x9A, 0xAA, 0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F, 0x4A, 0xFF,
+    0xFE, 0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC, 0x79, 0xFC,
+    0x2F, 0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9,
+    0x0F, 0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA, 0x70, 0xFC,
+    0x2F, 0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF, 0xD9, 0x6A,
+    0xFF, 0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97, 0x10, 0x59, 0x99, 0x73, 0x9F, 0xCA, 0x71,
+    0xEA, 0xEA, 0x70, 0xD9, 0x1D, 0xA7, 0x09, 0xA1, 0x9D, 0xA7, 0x39, 0xE7, 0x3E, 0xA7, 0x4A, 0xC9,
+    0x29, 0xAA, 0x97, 0x93, 0xAE, 0x97, 0x39, 0xE9, 0x59, 0x9A, 0x99, 0x09, 0xE3, 0x9F, 0xFE, 0xA2,
+    0x9F, 0xFE, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x2F, 0xA3, 0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F,
+    0x90, 0xFC, 0x49, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0xC4, 0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A,
+    0xF1, 0x9F, 0xC3, 0xF9, 0x2F, 0xDA, 0xAF, 0xC4, 0xFF, 0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70,
+    0x79, 0x77, 0x2A, 0xEA, 0x1C, 0xA7, 0x39, 0xFC, 0xAE, 0x73, 0xAD, 0xAF, 0xD7, 0x4C, 0xA1, 0xF9,
+    0x19, 0xE7, 0x71, 0x9F, 0x77, 0x09, 0xF7, 0x9A, 0xAA, 0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F,
+    0x4A, 0xFF, 0xFE, 0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC,
+    0x79, 0xFC, 0x2F, 0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7,
+    0x1A, 0xF9, 0x0F, 0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA,
+    0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF,
+    0xD9, 0x6A, 0xFF, 0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97, 0x10, 0x39, 0xAA, 0x91, 0x99,
+    0x7A, 0xF9, 0x0D, 0x96, 0xFF, 0xC9, 0x6D, 0x90, 0xFC, 0x70, 0xA2, 0xAC, 0xA0, 0x9A, 0xA9, 0x74,
+    0xAE, 0x97, 0x39, 0xE9, 0x59, 0x9A, 0x99, 0x09, 0xE3, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F,
+    0xA9, 0xAF, 0xC9, 0x2F, 0xA3, 0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F, 0x90, 0xFC, 0x49, 0xF9,
+    0x0F, 0xA5, 0xF9, 0x0F, 0xC4, 0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A, 0xF1, 0x9F, 0xC3, 0xF9,
+    0x2F, 0xDA, 0xAF, 0xC4, 0xFF, 0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70, 0x77, 0x09, 0xE7, 0x71,
+    0x9F, 0x77, 0x09, 0xF7, 0x9A, 0xAA, 0xA9, 0x2A, 0xEA, 0x49, 0xFF, 0xCA, 0x9F, 0x4A, 0xFF, 0xFE,
+    0x4F, 0xDA, 0xAA, 0xFE, 0x4A, 0xF9, 0x4F, 0xD3, 0x9F, 0x96, 0xFC, 0xA2, 0xFC, 0x79, 0xFC, 0x2F,
+    0x97, 0x0F, 0xC1, 0x9F, 0x97, 0x0A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0A, 0xF7, 0x1A, 0xF9, 0x0F,
+    0xC7, 0x19, 0xF9, 0x0F, 0xC7, 0x1A, 0xF9, 0x0A, 0xF9, 0x70, 0xAF, 0x19, 0xFA, 0x70, 0xFC, 0x2F,
+    0xC7, 0x0F, 0x92, 0xFC, 0xA6, 0xFC, 0x39, 0xFC, 0xA4, 0xAF, 0x5A, 0xFE, 0xAF, 0xD9, 0x6A, 0xFF,
+    0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97, 0x77, 0x77, 0x0A, 0xCA, 0x77, 0x1F, 0xA7, 0x70,
+    0xFA, 0x77, 0x0F, 0xA7, 0x71, 0xAA, 0x97, 0x10, 0x73, 0x9A, 0xA9, 0x74, 0xAE, 0x97, 0x39, 0xE9,
+    0x59, 0x9A, 0x99, 0x09, 0xE3, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F, 0xA9, 0xAF, 0xC9, 0x2F,
+    0xA3, 0xFC, 0x19, 0xF4, 0xAF, 0x1A, 0xF4, 0x9F, 0x90, 0xFC, 0x49, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F,
+    0xC4, 0x9F, 0x90, 0xFC, 0x49, 0xF1, 0xAF, 0x4A, 0xF1, 0x9F, 0xC3, 0xF9, 0x2F, 0xDA, 0xAF, 0xC4,
+    0xFF, 0xE6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x77, 0x76, 0x9A, 0xA7, 0x49, 0xF7, 0x3A, 0xF7, 0x39,
+    0xF7, 0x4A, 0xAA, 0x70, 0x77, 0x69, 0xFF, 0xC9, 0x19, 0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09,
+    0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC,
+    0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F,
+    0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC, 0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70, 0xFF,
+    0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x77, 0x77, 0x71, 0xAC, 0xA9, 0x77, 0x1A, 0xF7,
+    0x71, 0xFC, 0x77, 0x1A, 0xF7, 0x72, 0xAA, 0xA7, 0x10, 0x77, 0x4A, 0xFC, 0x2A, 0xFC, 0x92, 0xAF,
+    0xD1, 0x9F, 0xD9, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9,
+    0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69,
+    0x99, 0x39, 0x97, 0x77, 0x70, 0xAA, 0xA7, 0x7F, 0xA7, 0x6F, 0xA7, 0x6F, 0xA7, 0x7A, 0xA9, 0x70,
+    0x72, 0x97, 0x72, 0x9F, 0xCA, 0x77, 0xEA, 0xE9, 0x75, 0x9D, 0x90, 0x9D, 0xA7, 0x6A, 0xA1, 0x9D,
+    0x97, 0x71, 0xAE, 0x77, 0x1E, 0x97, 0x72, 0xD9, 0x77, 0x49, 0x77, 0x77, 0x19, 0xFF, 0xC9, 0x19,
+    0xFF, 0xC9, 0xFF, 0xC2, 0xAF, 0xF9, 0x09, 0xAF, 0xC9, 0x49, 0x9F, 0xA4, 0xFC, 0x7F, 0x5F, 0xC7,
+    0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC7, 0xF5,
+    0xFC, 0x7F, 0x5F, 0xC7, 0xF5, 0xFC, 0x7F, 0x5F, 0xC6, 0x9F, 0x5A, 0xF9, 0x5A, 0xEA, 0x59, 0xFC,
+    0x93, 0xAF, 0x96, 0xFF, 0xFE, 0x70, 0xFF, 0xFC, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0x99, 0x70,
+    0x79, 0x99, 0x76, 0xAF, 0xC9, 0x73, 0x9E, 0xAE, 0x73, 0x9D, 0x1A, 0xD9, 0x73, 0xAA, 0x1A, 0xD7,
+    0x7A, 0xD9, 0x75, 0x9E, 0x97, 0x7D, 0x77, 0x19, 0x97, 0x77, 0x77, 0x72, 0xAF, 0xC2, 0xAF, 0xC9,
+    0x2A, 0xFD, 0x19, 0xFD, 0x92, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94,
+    0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F,
+    0x4F, 0x94, 0x9F, 0xA2, 0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFD, 0x09, 0xFC,
+    0xA6, 0x99, 0x93, 0x99, 0x40, 0x77, 0x77, 0x5C, 0x97, 0x73, 0xAE, 0x77, 0x2F, 0xC7, 0x70, 0x9F,
+    0xCA, 0x77, 0x0F, 0xA9, 0x39, 0xAD, 0x97, 0x09, 0x97, 0x9F, 0x77, 0x3F, 0x77, 0x2A, 0xEA, 0x9F,
+    0xFC, 0x91, 0x9F, 0xFC, 0x09, 0xFF, 0xC2, 0xAF, 0xEA, 0x29, 0xAF, 0xC9, 0x49, 0x9F, 0x95, 0xFC,
+    0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F,
+    0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC6, 0x9F, 0x6A, 0xF9, 0x5A,
+    0xEA, 0x69, 0xFC, 0x93, 0xAF, 0x97, 0xFF, 0xFE, 0x71, 0xFF, 0xFC, 0x73, 0xAF, 0xFC, 0xA7, 0x79,
+    0x9A, 0x99, 0x71, 0x77, 0x74, 0x9C, 0xA7, 0x70, 0xE9, 0x76, 0x9E, 0x77, 0xEA, 0x76, 0xAD, 0xA7,
+    0x79, 0xCA, 0x49, 0xAA, 0x97, 0x7F, 0x77, 0xAE, 0x76, 0x9F, 0x1A, 0xFC, 0x2A, 0xFE, 0x90, 0xAF,
+    0xD1, 0x9F, 0xDA, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9,
+    0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69,
+    0x99, 0x39, 0x94, 0x77, 0x77, 0xC9, 0x77, 0x4A, 0xDA, 0x77, 0x3A, 0xF9, 0x77, 0x19, 0xFC, 0xA7,
+    0x72, 0xAF, 0x93, 0x9A, 0xD9, 0x73, 0x9A, 0x49, 0xF7, 0x73, 0xF7, 0x72, 0xAE, 0xA9, 0xFF, 0xC9,
+    0x19, 0xFF, 0xC0, 0x9F, 0xFC, 0x2A, 0xFE, 0xA2, 0x9A, 0xFC, 0x94, 0x99, 0xF9, 0x5F, 0xC7, 0xF6,
+    0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC,
+    0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x69, 0xF6, 0xAF, 0x95, 0xAE, 0xA6,
+    0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7, 0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xA9,
+    0x97, 0x10, 0x77, 0x71, 0xC9, 0x77, 0x0E, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x79, 0xE9, 0x77, 0x0A,
+    0xC9, 0x39, 0xAA, 0x97, 0x7F, 0x77, 0xAE, 0x76, 0x9F, 0x1A, 0xFC, 0x2A, 0xFE, 0x90, 0xAF, 0xD1,
+    0x9F, 0xDA, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9,
+    0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49,
+    0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69, 0x99,
+    0x39, 0x94, 0x72, 0x97, 0x73, 0x9F, 0xCA, 0x77, 0x0E, 0xAE, 0x97, 0x69, 0xD9, 0x09, 0xDA, 0x77,
+    0xAA, 0x19, 0xD9, 0x77, 0x2A, 0xE7, 0x72, 0xE9, 0x49, 0xAD, 0x97, 0x1D, 0x95, 0x9F, 0x72, 0x97,
+    0xF7, 0x72, 0xAE, 0xA9, 0xFF, 0xC9, 0x19, 0xFF, 0xC0, 0x9F, 0xFC, 0x2A, 0xFE, 0xA2, 0x9A, 0xFC,
+    0x94, 0x99, 0xF9, 0x5F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6,
+    0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC,
+    0x69, 0xF6, 0xAF, 0x95, 0xAE, 0xA6, 0x9F, 0xC9, 0x3A, 0xF9, 0x7F, 0xFF, 0xE7, 0x1F, 0xFF, 0xC7,
+    0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xA9, 0x97, 0x10, 0x79, 0x97, 0x7F, 0xD7, 0x4E, 0xAA, 0xDA, 0x73,
+    0xDA, 0x1E, 0x73, 0x9A, 0x91, 0xDA, 0x76, 0x9E, 0x76, 0xEA, 0x77, 0xAC, 0xA4, 0x9A, 0xA9, 0x70,
+    0xA5, 0xF7, 0x7A, 0xE7, 0x69, 0xF1, 0xAF, 0xC2, 0xAF, 0xE9, 0x0A, 0xFD, 0x19, 0xFD, 0xA2, 0x9A,
+    0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94,
+    0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0xA2, 0xAF, 0x95,
+    0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFD, 0x09, 0xFC, 0xA6, 0x99, 0x93, 0x99, 0x40, 0x70,
+    0x97, 0x74, 0x9F, 0x1A, 0xC7, 0x6F, 0xDA, 0xD9, 0x75, 0xDA, 0xAF, 0xC9, 0x75, 0xD1, 0xAE, 0xA2,
+    0x9A, 0xD9, 0x74, 0x94, 0x9F, 0x77, 0x3F, 0x77, 0x2A, 0xEA, 0x9F, 0xFC, 0x91, 0x9F, 0xFC, 0x09,
+    0xFF, 0xC2, 0xAF, 0xEA, 0x29, 0xAF, 0xC9, 0x49, 0x9F, 0x95, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC,
+    0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F,
+    0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC6, 0x9F, 0x6A, 0xF9, 0x5A, 0xEA, 0x69, 0xFC, 0x93, 0xAF,
+    0x97, 0xFF, 0xFE, 0x71, 0xFF, 0xFC, 0x73, 0xAF, 0xFC, 0xA7, 0x79, 0x9A, 0x99, 0x71, 0x49, 0xAA,
+    0x91, 0x9A, 0x72, 0x9F, 0xA0, 0xAC, 0xA7, 0x1F, 0xFC, 0xA7, 0x1A, 0xCA, 0x0A, 0xF9, 0x72, 0xA2,
+    0x9A, 0xA9, 0x19, 0xAA, 0x97, 0x7F, 0x77, 0xAE, 0x76, 0x9F, 0x1A, 0xFC, 0x2A, 0xFE, 0x90, 0xAF,
+    0xD1, 0x9F, 0xDA, 0x29, 0xAF, 0xC2, 0x9A, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4,
+    0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9, 0x49, 0xF4, 0xF9,
+    0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xFF, 0xCA, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xD0, 0x9F, 0xCA, 0x69,
+    0x99, 0x39, 0x94, 0x77, 0x29, 0xAD, 0x97, 0x72, 0x9F, 0x77, 0x3F, 0x77, 0x2A, 0xEA, 0x9F, 0xFC,
+    0x91, 0x9F, 0xFC, 0x09, 0xFF, 0xC2, 0xAF, 0xEA, 0x29, 0xAF, 0xC9, 0x49, 0x9F, 0x95, 0xFC, 0x7F,
+    0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F,
+    0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC7, 0xF6, 0xFC, 0x7F, 0x6F, 0xC6, 0x9F, 0x6A, 0xF9, 0x5A, 0xEA,
+    0x69, 0xFC, 0x93, 0xAF, 0x97, 0xFF, 0xFE, 0x71, 0xFF, 0xFC, 0x73, 0xAF, 0xFC, 0xA7, 0x79, 0x9A,
+    0x99, 0x77, 0x77, 0x73, 0xAC, 0xA9, 0x77, 0x2A, 0xF7, 0x72, 0xFC, 0x77, 0x2A, 0xF7, 0x73, 0xAA,
+    0xA7, 0x20, 0x76, 0x9A, 0xA9, 0x77, 0xF7, 0x7A, 0xE7, 0x69, 0xF1, 0xAF, 0xC2, 0xAF, 0xE9, 0x0A,
+    0xFD, 0x19, 0xFD, 0xA2, 0x9A, 0xFC, 0x29, 0xAF, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F,
+    0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F, 0x94, 0x9F, 0x4F,
+    0x94, 0x9F, 0xA2, 0xAF, 0x95, 0xFF, 0xFC, 0xA9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFD, 0x09, 0xFC, 0xA6,
+    0x99, 0x93, 0x99, 0x77, 0x77, 0x0A, 0xAA, 0x77, 0xFA, 0x76, 0xFA, 0x76, 0xFA, 0x77, 0xAA, 0x97,
+    0x00, 0x77, 0x72, 0x9C, 0x77, 0x2E, 0x97, 0x70, 0xFC, 0x77, 0xAF, 0xC9, 0x76, 0x9A, 0xF7, 0x72,
+    0x99, 0x77, 0x77, 0x77, 0x19, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA, 0x1A, 0xFE, 0x90, 0x9F, 0xD9,
+    0x4F, 0xA4, 0xFC, 0x5F, 0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7, 0x0F, 0xA1, 0x9E, 0x71, 0xAF,
+    0x1E, 0x97, 0x2F, 0xA9, 0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F, 0xFD, 0x71, 0xAF, 0xFC, 0xA4,
+    0x77, 0x70, 0xC9, 0x77, 0xE7, 0x7F, 0x76, 0x9F, 0x77, 0xEA, 0x77, 0xAC, 0xA7, 0x77, 0x77, 0x77,
+    0x70, 0x9F, 0xF9, 0x09, 0xFD, 0xA9, 0xFF, 0x2F, 0xD9, 0x1F, 0xCA, 0x4F, 0x39, 0xFA, 0x4E, 0xA4,
+    0xFC, 0x39, 0xE5, 0x9F, 0x92, 0xF6, 0xFA, 0x2E, 0x96, 0x9F, 0x1A, 0xE7, 0x0F, 0x1E, 0x97, 0x0A,
+    0xEA, 0x9E, 0x72, 0xFE, 0xA7, 0x2A, 0xFD, 0x73, 0x9F, 0xCA, 0x74, 0xFC, 0x75, 0x9E, 0xA7, 0x59,
+    0xE9, 0x75, 0xF7, 0x49, 0xF7, 0x09, 0xAA, 0xAF, 0xC9, 0x70, 0xAF, 0xEA, 0x71, 0x9F, 0xD9, 0x73,
+    0xAD, 0xA9, 0x74, 0x77, 0x49, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA, 0x1A, 0xFE, 0x90, 0x9F, 0xD9,
+    0x4F, 0xA4, 0xFC, 0x5F, 0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7, 0x0F, 0xA1, 0x9E, 0x71, 0xAF,
+    0x1E, 0x97, 0x2F, 0xA9, 0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F, 0xFD, 0x71, 0xAF, 0xFC, 0xA7,
+    0x77, 0x77, 0x77, 0xAC, 0xA7, 0x70, 0xFA, 0x77, 0xFA, 0x77, 0xF9, 0x77, 0x0A, 0xA9, 0x70, 0x77,
+    0x29, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4, 0xEA, 0x4F,
+    0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70, 0xAE,
+    0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x75, 0x9E,
+    0x97, 0x5F, 0x19, 0xA9, 0x79, 0xF1, 0xAE, 0xA1, 0x9A, 0xAA, 0xFC, 0x91, 0xFC, 0x1A, 0xFE, 0xA2,
+    0xFA, 0x19, 0xFD, 0x94, 0xDA, 0x3A, 0xDA, 0x97, 0x40, 0x71, 0x97, 0x70, 0xAF, 0xC9, 0x74, 0x9E,
+    0xAE, 0x74, 0xAD, 0x1A, 0xD9, 0x74, 0xAA, 0x1E, 0x77, 0x9A, 0xD9, 0x76, 0xAD, 0xA7, 0x70, 0x9D,
+    0x77, 0x29, 0x97, 0x77, 0x69, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA, 0x1A, 0xFE, 0x90, 0x9F, 0xD9,
+    0x4F, 0xA4, 0xFC, 0x5F, 0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7, 0x0F, 0xA1, 0x9E, 0x71, 0xAF,
+    0x1E, 0x97, 0x2F, 0xA9, 0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F, 0xFD, 0x71, 0xAF, 0xFC, 0xA4,
+    0x79, 0x99, 0x75, 0xFD, 0x73, 0xEA, 0xAE, 0x72, 0xDA, 0x1E, 0x72, 0x9A, 0x91, 0xDA, 0x75, 0x9E,
+    0x75, 0xEA, 0x76, 0x9C, 0xA7, 0x70, 0xA7, 0x77, 0x77, 0x79, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2,
+    0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F, 0xA4, 0xEA, 0x4F, 0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2,
+    0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1, 0xE9, 0x70, 0xAE, 0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7,
+    0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59, 0xEA, 0x75, 0x9E, 0x97, 0x5F, 0x74, 0x9F, 0x70, 0x9A, 0xAA,
+    0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19, 0xFD, 0x97, 0x3A, 0xDA, 0x97, 0x40, 0x79, 0x77, 0x1A, 0xE9,
+    0x1C, 0xA7, 0x29, 0xFC, 0xAE, 0x72, 0xAD, 0xAF, 0xD7, 0x3C, 0xA1, 0xF9, 0x77, 0x77, 0x77, 0x77,
+    0x49, 0xFF, 0xC1, 0xAF, 0xEA, 0xAF, 0xFA, 0x1A, 0xFE, 0x90, 0x9F, 0xD9, 0x4F, 0xA4, 0xFC, 0x5F,
+    0x59, 0xFA, 0x39, 0xE7, 0xFC, 0x3E, 0xA7, 0x0F, 0xA1, 0x9E, 0x71, 0xAF, 0x1E, 0x97, 0x2F, 0xA9,
+    0xE7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x6A, 0xFC, 0xA9, 0x72, 0x9F, 0xFD, 0x71, 0xAF, 0xFC, 0xA4, 0x49, 0xAA, 0x92, 0xA7,
+    0x19, 0xFA, 0x0A, 0xCA, 0x70, 0xAF, 0xFA, 0x70, 0xAC, 0xA0, 0xAF, 0x97, 0x1A, 0x29, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x69, 0xFF, 0x90, 0x9F, 0xDA, 0x9F, 0xF2, 0xFD, 0x91, 0xFC, 0xA4, 0xF3, 0x9F,
+    0xA4, 0xEA, 0x4F, 0xC3, 0x9E, 0x59, 0xF9, 0x2F, 0x6F, 0xA2, 0xE9, 0x69, 0xF1, 0xAE, 0x70, 0xF1,
+    0xE9, 0x70, 0xAE, 0xA9, 0xE7, 0x2F, 0xEA, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0xA7, 0x4F, 0xC7, 0x59,
+    0xEA, 0x75, 0x9E, 0x97, 0x5F, 0x74, 0x9F, 0x70, 0x9A, 0xAA, 0xFC, 0x97, 0x0A, 0xFE, 0xA7, 0x19,
+    0xFD, 0x97, 0x3A, 0xDA, 0x97, 0x40, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x99, 0x19,
+    0x99, 0xC9, 0x9C, 0x90, 0x9D, 0x92, 0xD2, 0xF0, 0x99, 0xAA, 0x99, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A,
+    0xAA, 0xAA, 0xAD, 0x9A, 0xCA, 0xAA, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA,
+    0x19, 0xC9, 0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74,
+    0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xAA, 0xAA, 0xA9, 0x9D, 0xAA, 0xAA, 0xAC, 0xA0, 0x9C,
+    0x93, 0x9A, 0x19, 0xC9, 0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A,
+    0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79,
+    0xA7, 0x9A, 0x79, 0xA7, 0x10, 0x70, 0xAF, 0xFF, 0xFF, 0xFC, 0xA7, 0x00, 0x70, 0xAF, 0xFF, 0xFF,
+    0xFC, 0xA7, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x09, 0x99, 0x29, 0x99, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1,
+    0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E,
+    0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A,
+    0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1,
+    0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E,
+    0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x0A, 0xE1, 0x9E, 0x09,
+    0xAA, 0xA2, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD,
+    0xA7, 0x77, 0x5F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAF, 0xFF, 0xD9, 0x29, 0x3E, 0x1A, 0xDA, 0x1E, 0x19,
+    0xE1, 0xEA, 0x1F, 0x1F, 0x90, 0x9E, 0xA1, 0x99, 0x20, 0x29, 0x92, 0x9E, 0x91, 0x9F, 0x2F, 0x2A,
+    0xE2, 0xAD, 0xA2, 0xE2, 0x9D, 0xA2, 0xE4, 0x93, 0x19, 0xAA, 0x2A, 0xEA, 0x2F, 0x2A, 0xE2, 0xAE,
+    0x2A, 0xD9, 0x2E, 0x2A, 0xD9, 0x2D, 0xA7, 0x10, 0x19, 0x29, 0xE9, 0x0F, 0xA0, 0xF1, 0xF1, 0x9E,
+    0x2E, 0x2A, 0xDA, 0x2E, 0x39, 0x90, 0x29, 0x49, 0x3E, 0x2E, 0x1A, 0xDA, 0x1A, 0xD9, 0x1E, 0x2E,
+    0x19, 0xE1, 0xAD, 0xA1, 0xEA, 0x1E, 0xA1, 0xF1, 0xF1, 0xF9, 0x0F, 0x90, 0x9E, 0xA0, 0xAE, 0x91,
+    0x99, 0x39, 0x92, 0x29, 0x93, 0x92, 0x9E, 0x90, 0xAE, 0x90, 0x9F, 0x0A, 0xEA, 0x1F, 0x1F, 0x1A,
+    0xE1, 0xEA, 0x1A, 0xDA, 0x1E, 0x91, 0xE2, 0xE1, 0x9D, 0xA1, 0xAD, 0x91, 0xE2, 0xDA, 0x39, 0x39,
+    0x92, 0x19, 0xAA, 0x29, 0xCA, 0x1A, 0xEA, 0x0F, 0x91, 0xF0, 0x9F, 0x1A, 0xE1, 0xF1, 0xAE, 0x1E,
+    0xA1, 0xAD, 0x91, 0xE9, 0x1E, 0x19, 0xE1, 0xAD, 0x91, 0xAD, 0x91, 0xDA, 0x2D, 0x97, 0x50, 0x19,
+    0x39, 0x92, 0x9E, 0x90, 0xAE, 0x90, 0xFA, 0x0F, 0x90, 0xF1, 0xF1, 0xF1, 0xEA, 0x19, 0xE1, 0xAD,
+    0xA2, 0xE1, 0x9E, 0x2A, 0xDA, 0x1E, 0x92, 0xE2, 0xE3, 0x99, 0x39, 0x10, 0x59, 0x99, 0x71, 0xF9,
+    0x70, 0xF7, 0x1A, 0xE7, 0x19, 0xE5, 0xAA, 0x90, 0x9D, 0xA0, 0x9A, 0xC1, 0xFF, 0xF9, 0x0F, 0xFF,
+    0x90, 0xEA, 0x9D, 0xA9, 0xAD, 0x95, 0xDA, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D,
+    0xA7, 0x19, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE4, 0x59, 0x99, 0x71, 0xF9, 0x70,
+    0xAE, 0x71, 0xAE, 0x71, 0x9E, 0x5A, 0xA9, 0x1D, 0xA0, 0x9A, 0xC1, 0xFF, 0xF9, 0x0F, 0xFF, 0xA0,
+    0xDA, 0x99, 0xDA, 0x9A, 0xD9, 0x5D, 0xA7, 0x19, 0xE7, 0x1A, 0xE7, 0x19, 0xE7, 0x2D, 0xA5, 0xDA,
+    0x90, 0xDA, 0x9A, 0xAC, 0x90, 0xFF, 0xFA, 0x0F, 0xFF, 0x90, 0xAA, 0x91, 0xDA, 0x09, 0xAC, 0x59,
+    0xE7, 0x19, 0xE7, 0x1A, 0xE7, 0x1F, 0x97, 0x19, 0x99, 0x40, 0x1A, 0xAA, 0x2F, 0xC0, 0xAF, 0xC9,
+    0xFD, 0xAA, 0xFC, 0x90, 0xFA, 0x29, 0x99, 0x10, 0x9C, 0x96, 0xF9, 0x4F, 0xD9, 0x2F, 0xF9, 0x0F,
+    0xFC, 0xAF, 0xFC, 0xAF, 0xEA, 0x1F, 0xCA, 0x3E, 0xA5, 0x9A, 0x70, 0x6A, 0xE9, 0x9F, 0xA9, 0xFC,
+    0x0F, 0x91, 0x99, 0x10, 0x75, 0xEA, 0x2F, 0x0F, 0xC1, 0xAF, 0x9F, 0xC1, 0xAF, 0x9A, 0xF1, 0x9F,
+    0x19, 0x99, 0x39, 0x99, 0x10, 0x77, 0x71, 0xEA, 0x49, 0xE9, 0x4A, 0xE0, 0xAF, 0x93, 0xFC, 0x39,
+    0xFA, 0xAF, 0x93, 0xFC, 0x39, 0xFA, 0x9F, 0x4F, 0xA4, 0xF9, 0x09, 0x99, 0x69, 0x99, 0x69, 0x91,
+    0x29, 0x2F, 0x99, 0xFC, 0x9F, 0xC0, 0xF9, 0x50, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A,
+    0x2A, 0xAD, 0x9A, 0xC2, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA, 0x19, 0xC9,
+    0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74, 0x9C, 0x95,
+    0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xA2, 0xA9, 0x9D, 0xAA, 0x2C, 0xA0, 0x9C, 0x93, 0x9A, 0x19, 0xC9,
+    0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79,
+    0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x10, 0x3A, 0x96, 0xAD, 0x94, 0x9C, 0xAA, 0xC9, 0x29, 0xC0, 0xAA, 0x0C, 0x91, 0xC1, 0xAA, 0x1C,
+    0x4A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0x50, 0x76, 0x9C, 0x90, 0xC9, 0x69, 0xC9, 0x0C, 0xA6, 0x9C, 0x90, 0xCA, 0x09, 0xAA, 0xAA, 0xAD,
+    0x90, 0xCA, 0xCA, 0xAA, 0xAA, 0xD9, 0x0C, 0x9C, 0x92, 0x9C, 0x90, 0xC9, 0x0C, 0x91, 0x9C, 0x1C,
+    0x91, 0xC9, 0x09, 0xC1, 0xC9, 0x2C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x75, 0x76, 0x9C, 0x09, 0xC9, 0x4A, 0xC0,
+    0x9C, 0x94, 0xAC, 0x09, 0xC9, 0x4A, 0xC0, 0x9D, 0xAA, 0xAA, 0xA9, 0x9C, 0x1D, 0xAA, 0xAA, 0xAC,
+    0x09, 0xC1, 0xC9, 0x29, 0xC1, 0x9C, 0x1C, 0x91, 0x9C, 0x29, 0xC1, 0xC9, 0x09, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x30, 0x77, 0x77, 0x72, 0x99, 0x97, 0x1A, 0xC9, 0x77, 0x49, 0xFC, 0xA6, 0x9E, 0x77,
+    0x39, 0xFE, 0xA5, 0xE9, 0x77, 0x3E, 0x90, 0x9E, 0x93, 0x9E, 0x77, 0x39, 0xE2, 0xEA, 0x3E, 0x97,
+    0x73, 0xAD, 0xA2, 0xAD, 0xA2, 0x9D, 0xA7, 0x74, 0xAD, 0xA2, 0xAE, 0x2E, 0x77, 0x5E, 0xA2, 0xAD,
+    0xA1, 0xAD, 0xA7, 0x75, 0xAD, 0xA2, 0xAD, 0xA1, 0xE7, 0x76, 0x9E, 0x2E, 0x1A, 0xD9, 0x19, 0xEA,
+    0x95, 0x9A, 0xDA, 0x93, 0xEA, 0x9A, 0xE1, 0xE1, 0xFE, 0x93, 0xAF, 0xDA, 0x29, 0xFE, 0x1A, 0xD1,
+    0xAE, 0x9A, 0xE2, 0x9E, 0x9A, 0xE9, 0x3A, 0xE9, 0x19, 0xDA, 0x1E, 0x2E, 0xA1, 0xE2, 0xAD, 0xA7,
+    0x2E, 0x19, 0xE2, 0xAD, 0xA0, 0x9E, 0x29, 0xE7, 0x19, 0xDA, 0x1A, 0xDA, 0x29, 0xE0, 0x9E, 0x29,
+    0xE7, 0x1E, 0x2A, 0xDA, 0x29, 0xE0, 0x9E, 0x29, 0xE7, 0x0A, 0xDA, 0x2A, 0xDA, 0x2A, 0xDA, 0x09,
+    0xE2, 0x9E, 0x70, 0xE3, 0xAE, 0x2A, 0xD9, 0x09, 0xE2, 0xAD, 0xA7, 0xE9, 0x4E, 0x91, 0xE2, 0xE9,
+    0x1E, 0x96, 0x9E, 0x5A, 0xFE, 0x92, 0xAF, 0xEA, 0x7E, 0x96, 0xAF, 0xC9, 0x4A, 0xFC, 0xA7, 0x09,
+    0xD7, 0x19, 0x99, 0x70, 0x99, 0x97, 0x77, 0x77, 0x30, 0x73, 0xCA, 0x4A, 0xE3, 0xF2, 0x9E, 0xA2,
+    0xF2, 0x9E, 0xA2, 0xF3, 0xE4, 0xAC, 0x97, 0x30, 0x77, 0x1C, 0xA3, 0xD9, 0x3A, 0xE2, 0xE9, 0x2F,
+    0x1A, 0xE9, 0x19, 0xEA, 0x1F, 0x2F, 0x1A, 0xEA, 0x19, 0xEA, 0x1F, 0x2F, 0x19, 0xE3, 0xE2, 0xAD,
+    0x93, 0xAC, 0x92, 0x9C, 0xA7, 0x71, 0x77, 0x7C, 0xA3, 0xD9, 0x29, 0xCA, 0x3A, 0xE2, 0xE9, 0x1E,
+    0xA2, 0xF1, 0xAE, 0x90, 0x9E, 0xA1, 0x9E, 0xA1, 0xF1, 0xF9, 0x1F, 0x1A, 0xEA, 0x09, 0xF1, 0x9E,
+    0xA1, 0xF1, 0xAE, 0x2F, 0x19, 0xE2, 0xEA, 0x2E, 0x2A, 0xD9, 0x19, 0xE3, 0xAC, 0x92, 0x9C, 0xA3,
+    0xD7, 0x77, 0x71, 0xAC, 0x4E, 0x93, 0xF3, 0xF9, 0x29, 0xF3, 0xAE, 0x93, 0xEA, 0x4E, 0x49, 0xC9,
+    0x70, 0x75, 0xAC, 0x92, 0x9C, 0xA2, 0xF1, 0xAE, 0x2F, 0x1A, 0xEA, 0x1A, 0xEA, 0x1F, 0x2F, 0x1A,
+    0xE9, 0x19, 0xEA, 0x1F, 0x2A, 0xE1, 0x9E, 0x92, 0xE9, 0x1A, 0xDA, 0x3C, 0xA3, 0xD7, 0x50, 0x77,
+    0x3A, 0xC9, 0x29, 0xCA, 0x29, 0xD2, 0xF1, 0xAE, 0x2E, 0x91, 0xF1, 0xAE, 0xA1, 0xF1, 0xAE, 0xA1,
+    0xF1, 0xF9, 0x1F, 0x1A, 0xE9, 0x09, 0xF1, 0x9E, 0xA1, 0xF1, 0xAE, 0x2A, 0xE1, 0x9E, 0x91, 0xEA,
+    0x2E, 0x91, 0xAD, 0xA1, 0x9E, 0x3C, 0xA3, 0xD3, 0x9C, 0x97, 0x72, 0x49, 0xA7, 0x19, 0xDA, 0x79,
+    0xFA, 0x59, 0xEA, 0xDA, 0x39, 0xE1, 0xAD, 0xA2, 0xE3, 0xAD, 0xA0, 0x5C, 0xA4, 0x9E, 0x3A, 0xE9,
+    0x2A, 0xE9, 0x2F, 0xA3, 0xF4, 0xFA, 0x4F, 0x94, 0xF9, 0x4A, 0xE5, 0x9D, 0x71, 0x0C, 0xA4, 0xAE,
+    0x93, 0xAE, 0x93, 0xFA, 0x3F, 0xA2, 0x9F, 0x2F, 0xA1, 0xAE, 0xA1, 0xAE, 0x91, 0x9E, 0x92, 0x9D,
+    0x74, 0x0A, 0x75, 0xA0, 0xAD, 0x4A, 0xA4, 0xDA, 0x0E, 0x2A, 0xDA, 0x2E, 0x2D, 0xA1, 0xAD, 0xA1,
+    0xAD, 0x4D, 0xA1, 0xD1, 0xAD, 0x94, 0x9D, 0xA3, 0xAD, 0x96, 0x9D, 0xA1, 0x9D, 0x97, 0x09, 0xD9,
+    0x9D, 0x95, 0x9D, 0x1A, 0xFA, 0x1D, 0x91, 0xEA, 0x1A, 0xDA, 0x1A, 0xE1, 0xAD, 0x91, 0xF1, 0x9E,
+    0x29, 0x91, 0xDA, 0xAD, 0x19, 0x96, 0xE1, 0xE7, 0x0E, 0x3E, 0x6E, 0x19, 0x91, 0xE4, 0xE1, 0xAD,
+    0xA1, 0xE2, 0xAD, 0x2A, 0xE2, 0xDA, 0x0A, 0xD9, 0x29, 0xD9, 0x3D, 0xA0, 0xC9, 0x73, 0x9C, 0x77,
+    0x20, 0x09, 0xAA, 0x93, 0x9A, 0xAA, 0x0A, 0xEA, 0x3F, 0x0F, 0xA2, 0x9F, 0x0F, 0x92, 0xAF, 0x0F,
+    0x92, 0xAE, 0xA0, 0xF3, 0xAE, 0xA0, 0xF3, 0xAE, 0xA0, 0xF3, 0xAE, 0x90, 0xF3, 0x9E, 0x90, 0xF3,
+    0x9E, 0x90, 0xAE, 0x39, 0xE9, 0x0A, 0xE4, 0xE9, 0x09, 0xE4, 0xE9, 0x09, 0xE4, 0xE9, 0x1E, 0x4E,
+    0x91, 0xE4, 0xAD, 0x91, 0x97, 0x77, 0x2A, 0xD9, 0x39, 0xDA, 0x0A, 0xF3, 0xFA, 0xAF, 0x29, 0xFA,
+    0x9F, 0x3F, 0x90, 0x99, 0x95, 0x99, 0x10, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x6A, 0xFC, 0xAF, 0xDA, 0xFD,
+    0x96, 0x77, 0x72, 0xCA, 0x73, 0xAD, 0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2E,
+    0x72, 0xAD, 0x97, 0x2E, 0x72, 0xAD, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xAD,
+    0x97, 0x2E, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0x97, 0x19, 0xDA, 0x74,
+    0xC7, 0x77, 0x20, 0x77, 0x71, 0x9F, 0xC9, 0x59, 0xFC, 0x94, 0xFF, 0x4F, 0xF3, 0xFF, 0xC3, 0xFF,
+    0xC2, 0xAE, 0xAF, 0xA2, 0xFA, 0xFA, 0x29, 0x39, 0xE7, 0x0A, 0xE7, 0x0A, 0xDA, 0x70, 0xAD, 0x97,
+    0x0D, 0xA7, 0x1D, 0xA7, 0x9E, 0x70, 0x9D, 0xA5, 0x9A, 0xEA, 0x69, 0xAE, 0xA2, 0x9A, 0xFD, 0x93,
+    0x9A, 0xFD, 0x29, 0xFE, 0xA3, 0x9F, 0xE9, 0x29, 0xFD, 0x94, 0xAF, 0xCA, 0x49, 0xEA, 0x79, 0xEA,
+    0x7D, 0xA7, 0x1D, 0xA7, 0x0D, 0xA7, 0x1D, 0xA7, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x70, 0x9D, 0xA6,
+    0x9F, 0x96, 0x9F, 0x95, 0x9F, 0xA6, 0xAF, 0x96, 0xF7, 0x9F, 0x70, 0x99, 0x72, 0x99, 0x50, 0x77,
+    0x9A, 0xA9, 0x19, 0xFC, 0x96, 0xAE, 0xA1, 0xFF, 0x5F, 0xA1, 0xFF, 0xC4, 0xF9, 0x1A, 0xEA, 0xFA,
+    0x3F, 0x92, 0x93, 0x9E, 0x3F, 0x71, 0xAD, 0xA2, 0xF7, 0x2D, 0xA2, 0xF7, 0x19, 0xE2, 0xF7, 0x9A,
+    0xEA, 0x2F, 0x49, 0xAF, 0xD9, 0x2F, 0x39, 0xFE, 0xA3, 0xAE, 0x39, 0xFD, 0x94, 0xAE, 0x39, 0xEA,
+    0x79, 0xE4, 0xDA, 0x70, 0x9E, 0x4D, 0xA7, 0x1E, 0x77, 0x19, 0x77, 0x73, 0x9D, 0xA7, 0x0A, 0xD9,
+    0x29, 0xF9, 0x6A, 0xF2, 0x9F, 0xA6, 0xFC, 0x3F, 0x7A, 0xF4, 0x99, 0x71, 0x99, 0x91, 0x09, 0xAA,
+    0x97, 0x5A, 0xEA, 0x3F, 0xC9, 0x3F, 0xA2, 0xFF, 0x2F, 0x92, 0xFF, 0xC1, 0xF9, 0x2A, 0xEA, 0xFC,
+    0x0F, 0x49, 0x39, 0xE9, 0xF7, 0x29, 0xDA, 0xF7, 0x3F, 0xE7, 0x3F, 0xE7, 0x09, 0xAF, 0xAE, 0x59,
+    0xAF, 0xD9, 0xAE, 0x49, 0xFE, 0xA0, 0x9E, 0x49, 0xFD, 0x91, 0x9E, 0x5E, 0xA5, 0xE5, 0xE6, 0xE5,
+    0xAD, 0x69, 0x77, 0x77, 0x4A, 0xD9, 0x49, 0xDA, 0x4A, 0xF4, 0xFA, 0x3A, 0xF3, 0x9F, 0xA3, 0x9F,
+    0x4F, 0x94, 0x99, 0x96, 0x99, 0x50, 0x77, 0x3A, 0xAA, 0xA9, 0x59, 0xA1, 0x9F, 0xE9, 0x29, 0xDA,
+    0x9F, 0xFF, 0xE9, 0xAD, 0x92, 0xAF, 0xEA, 0x1C, 0xA5, 0xAE, 0xA9, 0x77, 0x20, 0x77, 0x76, 0xCA,
+    0x3D, 0x92, 0x9C, 0xA3, 0xCA, 0x4A, 0xE2, 0xE9, 0x1E, 0xA1, 0xAE, 0x3F, 0x1A, 0xE9, 0x09, 0xEA,
+    0x1F, 0x29, 0xEA, 0x1F, 0x1F, 0x90, 0x9E, 0xA2, 0xF1, 0xAE, 0xA0, 0x9F, 0x1F, 0x29, 0xEA, 0x1F,
+    0x1A, 0xE1, 0x9E, 0xA2, 0xF1, 0x9E, 0x2E, 0xA1, 0xF3, 0xE2, 0xAD, 0x91, 0x9E, 0x2E, 0x4A, 0xC9,
+    0x29, 0xCA, 0x3D, 0x3A, 0xC9, 0x77, 0x76, 0x39, 0xAD, 0xA9, 0x5F, 0xEA, 0x3F, 0xAF, 0x91, 0xAE,
+    0x2F, 0x1E, 0xA2, 0x9E, 0x1E, 0x92, 0x9E, 0x99, 0xE4, 0xE9, 0x9E, 0x39, 0xE9, 0x9E, 0x92, 0x9E,
+    0x1E, 0x92, 0xAE, 0x1F, 0x19, 0xE9, 0x19, 0xFF, 0xC3, 0x9F, 0xDA, 0x69, 0xAA, 0x94, 0x69, 0xAC,
+    0x70, 0xAE, 0x79, 0xF6, 0x9F, 0xC6, 0xDA, 0xE5, 0xE0, 0xE4, 0xAD, 0x1E, 0x39, 0xD9, 0x1E, 0x3E,
+    0x99, 0x9E, 0x99, 0x1F, 0xFE, 0x90, 0x9F, 0xFD, 0x7E, 0x71, 0xE7, 0x1A, 0xAA, 0x20, 0x19, 0xAA,
+    0xAA, 0xAA, 0x92, 0xAF, 0xE2, 0xFF, 0x2E, 0x7E, 0x96, 0xFC, 0xA4, 0xFE, 0x95, 0x9F, 0x69, 0xE6,
+    0x9E, 0x59, 0xEA, 0x1F, 0xF2, 0xFD, 0xA4, 0xAA, 0xA9, 0x40, 0x5A, 0xDA, 0x4A, 0xFC, 0x92, 0xFC,
+    0x99, 0x2F, 0x94, 0xAE, 0x95, 0xFE, 0xA1, 0x9F, 0xFC, 0x09, 0xE1, 0x9E, 0xAA, 0xE2, 0xAD, 0xA9,
+    0xE2, 0xAE, 0x0E, 0x91, 0xEA, 0x0A, 0xFF, 0x2A, 0xFD, 0x49, 0xAA, 0xA9, 0x20, 0x09, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x1F, 0xFC, 0xA0, 0xFF, 0xCA, 0x0D, 0xA2, 0xE1, 0xD2, 0xAD, 0x95, 0x9D, 0xA6, 0xE6,
+    0xAD, 0xA6, 0xE6, 0xAD, 0xA6, 0xE9, 0x6E, 0x7E, 0x79, 0xA9, 0x40, 0x29, 0xAD, 0xA9, 0x3F, 0xEA,
+    0x1A, 0xDA, 0x09, 0xE1, 0xE2, 0xE1, 0xE9, 0x1E, 0x19, 0xEA, 0xE9, 0x29, 0xFC, 0x92, 0x9F, 0xEA,
+    0x1E, 0x1A, 0xE9, 0xAD, 0xA2, 0xAD, 0xAA, 0xDA, 0x2E, 0x99, 0xEA, 0x9A, 0xE1, 0xAF, 0xE4, 0x9A,
+    0xA9, 0x92, 0x2A, 0xE9, 0x39, 0xFE, 0x2F, 0xAF, 0x09, 0xE2, 0xE9, 0xAE, 0x2E, 0xA9, 0xE2, 0xAD,
+    0xA0, 0xEA, 0x99, 0xEA, 0x09, 0xFF, 0x92, 0xAF, 0xD6, 0xEA, 0x4A, 0xF2, 0xAA, 0xFC, 0x3F, 0xCA,
+    0x5A, 0xA9, 0x50, 0x74, 0x9E, 0x9A, 0xEA, 0x2F, 0xFD, 0x93, 0xE9, 0x09, 0xDA, 0x3D, 0xA2, 0xE3,
+    0xDA, 0x2E, 0x3D, 0xA2, 0xE3, 0xDA, 0x2E, 0x29, 0xE2, 0xE9, 0x0A, 0xFA, 0x0F, 0xC0, 0x99, 0x99,
+    0x91, 0x99, 0x99, 0x90, 0x77, 0x9F, 0xCA, 0x4A, 0xFF, 0x29, 0xEA, 0x9A, 0xEA, 0x1F, 0x2A, 0xE1,
+    0xE9, 0x29, 0xE0, 0x9E, 0x39, 0xE9, 0x9E, 0x4E, 0x99, 0xE3, 0x9E, 0x1E, 0x92, 0x9E, 0x1E, 0xA2,
+    0xEA, 0x1A, 0xEA, 0x9F, 0x3F, 0xF9, 0x4A, 0xFC, 0x97, 0x70, 0x75, 0x9D, 0x92, 0xAF, 0xCA, 0x2F,
+    0xDA, 0x39, 0x9E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA4, 0x9F, 0x91, 0xAF,
+    0xF0, 0xAF, 0xEA, 0x49, 0x69, 0xFC, 0xA2, 0xAF, 0xF0, 0x9E, 0xA9, 0xAE, 0x09, 0xE1, 0x9E, 0x90,
+    0xAA, 0x91, 0x9E, 0x6E, 0xA5, 0xF5, 0xF5, 0xEA, 0x49, 0xEA, 0x49, 0xFF, 0xD9, 0xFF, 0xD0, 0xAF,
+    0xEA, 0x00, 0x49, 0x6A, 0xFC, 0xA2, 0xFF, 0xA0, 0x9D, 0xA1, 0xAE, 0x1A, 0xA2, 0xAE, 0x59, 0xE9,
+    0x3A, 0xF9, 0x4F, 0xD9, 0x3A, 0x99, 0xF6, 0x9E, 0x6A, 0xE1, 0x99, 0x9A, 0xFA, 0x09, 0xFE, 0xA2,
+    0xFC, 0xA9, 0x75, 0x77, 0x29, 0xE7, 0x0F, 0x7F, 0xC6, 0xAF, 0xC5, 0x9D, 0x9E, 0x5D, 0xA0, 0xE4,
+    0xE1, 0xE3, 0xAD, 0x2E, 0x3F, 0xFE, 0x1F, 0xFE, 0x91, 0x99, 0x99, 0x9E, 0x99, 0x7E, 0x71, 0xE7,
+    0x70, 0x1A, 0xFE, 0x2A, 0xFE, 0x2E, 0xAA, 0xAA, 0x92, 0xE7, 0xEA, 0x95, 0xFD, 0xA3, 0xAA, 0xFC,
+    0xA6, 0xF6, 0x9E, 0x6A, 0xE1, 0x99, 0x99, 0xF9, 0x1F, 0xEA, 0x2A, 0xFC, 0x97, 0x50, 0x77, 0xAF,
+    0x39, 0xFD, 0x91, 0x9F, 0x93, 0x9E, 0xA5, 0xFA, 0xA9, 0x3F, 0xF9, 0x09, 0xEA, 0xAF, 0x9A, 0xE2,
+    0xEA, 0xAE, 0x2A, 0xE9, 0xE2, 0xAD, 0xA0, 0xF9, 0x9E, 0x90, 0x9F, 0xEA, 0x29, 0xFC, 0xA7, 0x40,
+    0x0F, 0xFC, 0x90, 0xFF, 0xCA, 0x0E, 0xAA, 0xAE, 0x90, 0xD9, 0x19, 0xDA, 0x1A, 0xC2, 0xE6, 0xAD,
+    0x95, 0x9E, 0x6E, 0x95, 0x9E, 0x6E, 0xA6, 0xE9, 0x6E, 0x7E, 0x77, 0x49, 0x69, 0xFC, 0xA2, 0x9E,
+    0xAF, 0x1E, 0x2E, 0x1E, 0x2E, 0x1F, 0x09, 0xDA, 0x2F, 0xDA, 0x39, 0xFC, 0xA2, 0xAE, 0xAF, 0x09,
+    0xE2, 0xE9, 0xAD, 0xA2, 0xAD, 0xAA, 0xE2, 0xE9, 0x0F, 0xFA, 0x2A, 0xFC, 0x97, 0x40, 0x49, 0x6A,
+    0xFC, 0x92, 0xAF, 0xE9, 0x1E, 0x90, 0xAE, 0x09, 0xE2, 0xE9, 0xAE, 0x2E, 0xA9, 0xE2, 0xAD, 0xA0,
+    0xFA, 0xAE, 0x91, 0xFF, 0x93, 0x99, 0xF5, 0xAE, 0x93, 0x9F, 0xA1, 0x9F, 0xDA, 0x3F, 0xA9, 0x76,
+    0x9F, 0xFF, 0xDA, 0xAF, 0xFF, 0xE0, 0xAF, 0xFF, 0xD2, 0xFA, 0x39, 0xE2, 0xFA, 0x4E, 0x2F, 0xA4,
+    0xAC, 0xA2, 0xFA, 0x72, 0xFA, 0x72, 0xFC, 0xAA, 0xAE, 0x4F, 0xFE, 0x93, 0xFF, 0xE4, 0xFA, 0x72,
+    0xFA, 0x79, 0xFF, 0xCA, 0x49, 0xFF, 0xD5, 0x99, 0xFA, 0x99, 0x70, 0xFA, 0x71, 0x9F, 0xCA, 0x95,
+    0x9F, 0xFC, 0xA4, 0x9F, 0xFC, 0xA4, 0x77, 0x72, 0xAF, 0xA9, 0x70, 0x9F, 0xF9, 0x7F, 0xAA, 0xF6,
+    0xAE, 0x91, 0xAE, 0x95, 0xF3, 0xE5, 0x9E, 0x93, 0xD9, 0x5A, 0xE9, 0x74, 0xF7, 0x29, 0xFF, 0xE9,
+    0x4A, 0xFF, 0xE7, 0x9F, 0x72, 0x99, 0xAF, 0x99, 0xAA, 0xA5, 0xFF, 0xEA, 0x5A, 0xAF, 0xCA, 0xAA,
+    0xA9, 0x7F, 0x75, 0xF7, 0x49, 0xE9, 0x69, 0x91, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1, 0x9F, 0xAF, 0xFC,
+    0x92, 0x9A, 0x95, 0x99, 0x99, 0x20, 0x77, 0x77, 0x79, 0xAA, 0xFF, 0xA9, 0x77, 0x71, 0xFF, 0xFC,
+    0xA7, 0x77, 0x0A, 0xFD, 0xAA, 0xFC, 0xA7, 0x77, 0x1A, 0xF2, 0xAF, 0x77, 0x71, 0xAF, 0x3F, 0x93,
+    0x9A, 0x97, 0x71, 0xAF, 0x3A, 0xEA, 0x2A, 0xDA, 0x77, 0x1A, 0xF3, 0xAE, 0xA2, 0xEA, 0x77, 0x1A,
+    0xF3, 0xF9, 0x2E, 0xA9, 0x99, 0x49, 0xAA, 0xA9, 0x4A, 0xF2, 0xAF, 0x0A, 0xFF, 0xCA, 0x1A, 0xFE,
+    0x3A, 0xF9, 0x9F, 0xC9, 0x0A, 0xFF, 0xC9, 0x0A, 0xEA, 0x9E, 0x3A, 0xFF, 0xD9, 0x39, 0xEA, 0x4E,
+    0x91, 0x9D, 0x3A, 0xFF, 0xA5, 0x9E, 0xA4, 0xF2, 0xA9, 0x3A, 0xF9, 0x71, 0x9E, 0xA4, 0xAF, 0xC9,
+    0x5A, 0xF7, 0x29, 0xEA, 0x5F, 0xE4, 0xAF, 0x72, 0x9E, 0xA6, 0xAF, 0xD3, 0xAF, 0x72, 0x9E, 0xA7,
+    0x09, 0xF9, 0x2A, 0xF7, 0x29, 0xF4, 0xDA, 0x2E, 0x91, 0x9F, 0xCA, 0xA9, 0x79, 0xFA, 0x9A, 0xA0,
+    0xDA, 0x2E, 0x90, 0xFF, 0xD7, 0x0F, 0xF0, 0xFF, 0xC1, 0xFF, 0xD7, 0x09, 0xFD, 0x90, 0xAF, 0xDA,
+    0x77, 0x70, 0x99, 0x69, 0x99, 0x30, 0x77, 0x72, 0xAF, 0xCA, 0x97, 0xAF, 0xFC, 0xA5, 0xFF, 0xEA,
+    0x4A, 0xF9, 0x2A, 0xDA, 0x39, 0xF4, 0xAD, 0x93, 0xF5, 0xAD, 0x39, 0xEA, 0x72, 0x99, 0xFA, 0xAA,
+    0xAA, 0xA5, 0xFF, 0xF5, 0xAA, 0xFA, 0xAA, 0xAA, 0x96, 0x9F, 0x72, 0x9F, 0xFE, 0x5A, 0xFF, 0xE6,
+    0x99, 0xF9, 0x99, 0x97, 0x1F, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0xA5, 0x99, 0x39, 0xFF, 0xF9, 0x49,
+    0xFF, 0xE7, 0xAF, 0xF9, 0x72, 0x99, 0x99, 0x30, 0x77, 0x7A, 0xC7, 0x7A, 0xE7, 0x5A, 0xE9, 0x74,
+    0xAE, 0x75, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0xFC, 0x90, 0xFF, 0xFF,
+    0xC9, 0x09, 0xE9, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xE7, 0x7A, 0xE9, 0x76, 0xAE, 0x77,
+    0xAC, 0x77, 0x76, 0x77, 0x1E, 0x70, 0xFC, 0x6F, 0xE4, 0xFF, 0xC2, 0xE9, 0xEA, 0xE0, 0xAD, 0xA0,
+    0xE0, 0xEA, 0x0D, 0x1E, 0x1D, 0x5E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x77, 0x10, 0x77, 0x75, 0x9C, 0xA7, 0x7E, 0xA7, 0x69, 0xEA, 0x77,
+    0xEA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFC,
+    0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0xE9, 0x75, 0xE9, 0x74, 0x9E, 0xA7, 0x5E, 0xA7, 0x7C,
+    0xA7, 0x77, 0x77, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x19, 0x2D, 0x1E, 0x1D, 0x0A, 0xE0, 0xE0, 0xEA, 0x0E, 0xAE, 0xAE, 0x2F, 0xFC,
+    0x4F, 0xE6, 0xFA, 0x70, 0xAC, 0xA7, 0x71, 0x77, 0x7C, 0x94, 0x9C, 0x70, 0xE9, 0x29, 0xE6, 0xF4,
+    0xF4, 0xEA, 0x6A, 0xDA, 0x2A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x0A, 0xFF, 0xFF, 0xC9, 0x9F,
+    0xFF, 0xFC, 0x90, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0xAD, 0xA6, 0xAD, 0xA4, 0xF3, 0x9E,
+    0xA6, 0xE4, 0xE7, 0x0C, 0x6A, 0x77, 0x70, 0x59, 0x72, 0xE7, 0x0F, 0xC5, 0x9F, 0xE3, 0x9F, 0xFC,
+    0x90, 0x9E, 0x9E, 0x9E, 0x1D, 0xA0, 0xE0, 0xAC, 0xA2, 0xA1, 0xE1, 0xA6, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x6A, 0x1E, 0x1A, 0x2D, 0xA0, 0xE0, 0xAD, 0x1E, 0x9E, 0x9E, 0x2F, 0xFC, 0x4F, 0xE6, 0xFC,
+    0x70, 0xE7, 0x29, 0x50, 0x5A, 0xCA, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xFF, 0xC4, 0xEA, 0xEA,
+    0xE3, 0xE0, 0xE0, 0xE4, 0xC1, 0xE1, 0xC7, 0x0E, 0x73, 0xE7, 0x3E, 0x79, 0xC1, 0xE1, 0xC9, 0x29,
+    0xE0, 0xE0, 0xE3, 0xAF, 0xFC, 0xA4, 0xAF, 0xEA, 0x6A, 0xFC, 0xA7, 0x09, 0xE9, 0x59, 0x99, 0x99,
+    0xAC, 0xA9, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA4, 0xA9, 0x1A,
+    0xDA, 0x3A, 0xD9, 0x0A, 0xDA, 0x2A, 0xE9, 0x0A, 0xDA, 0x1A, 0xE2, 0xAD, 0x90, 0xAE, 0x3A, 0xD9,
+    0x9F, 0xFE, 0x9A, 0xFF, 0xE9, 0x0F, 0xFE, 0x91, 0xE9, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70, 0x9D,
+    0x72, 0x96, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x19, 0xA4, 0xAD, 0xA0, 0x9D, 0xA3, 0xAD, 0xA0, 0x9E, 0xA2, 0xAD,
+    0xA2, 0xEA, 0x19, 0xDA, 0x3E, 0xA0, 0x9F, 0xFE, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0x79, 0xE7, 0xAE,
+    0x7A, 0xE9, 0x70, 0xD9, 0x72, 0x94, 0x74, 0x9A, 0xA7, 0x5E, 0x97, 0x4E, 0x94, 0xD5, 0xE9, 0x3A,
+    0xE4, 0xE9, 0x2A, 0xE9, 0x4E, 0x91, 0xAD, 0xA6, 0xE9, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x99,
+    0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x1A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xDA, 0x75, 0xAE,
+    0x75, 0xF7, 0x5D, 0x77, 0x72, 0x6A, 0x77, 0x0E, 0x76, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x99, 0x99,
+    0x9A, 0xAA, 0xAA, 0xA9, 0x1A, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xF9, 0x9D, 0xA7, 0x69, 0xDA, 0x77,
+    0xAF, 0xFF, 0xF9, 0x1A, 0xFF, 0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xA9, 0x3A, 0xDA,
+    0x77, 0xAD, 0xA7, 0x7D, 0xA7, 0x70, 0xA7, 0x20, 0x6A, 0xCA, 0x74, 0xAE, 0xA7, 0x2A, 0xFC, 0xA7,
+    0x0A, 0xDA, 0x0A, 0xDA, 0x6F, 0xA0, 0xAF, 0x4F, 0xCA, 0x0A, 0xFC, 0x2E, 0xAD, 0xA0, 0xAD, 0xAE,
+    0x1A, 0xCA, 0x0D, 0xA0, 0xAD, 0x0A, 0xCA, 0x29, 0x1D, 0xA0, 0xAD, 0x19, 0x6D, 0xA0, 0xAD, 0x71,
+    0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A,
+    0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0x90, 0x9D, 0x40, 0x72, 0xA7, 0x70, 0xE7,
+    0x7A, 0xE7, 0x7A, 0xE3, 0x9A, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0xEA, 0x29, 0xFF, 0xFE, 0xA1, 0x9F,
+    0xFF, 0xFA, 0x77, 0xAD, 0x97, 0x6A, 0xD9, 0x9F, 0xFF, 0xFA, 0x09, 0xFF, 0xFE, 0xA1, 0x9A, 0xAA,
+    0xAA, 0x99, 0x99, 0x99, 0xEA, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x76, 0xAD, 0x77, 0x0A, 0x60, 0x4D,
+    0x90, 0x9D, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD,
+    0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x6A, 0x1D,
+    0xA0, 0xAD, 0x1A, 0x2D, 0xA0, 0xDA, 0x0A, 0xD0, 0xAD, 0x1E, 0xAD, 0xA0, 0xAD, 0xAE, 0x2A, 0xFA,
+    0x0A, 0xFA, 0x4A, 0xEA, 0x0A, 0xEA, 0x6A, 0xDA, 0x0A, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAE, 0xA7,
+    0x4A, 0xCA, 0x60, 0x77, 0x70, 0xC4, 0xC7, 0x2E, 0x2E, 0x70, 0xE9, 0x2A, 0xE6, 0xEA, 0x4A, 0xE4,
+    0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0xA0, 0xAD, 0x97, 0x29, 0xD9, 0x9D, 0x97, 0x2A, 0xD9, 0x0A, 0xFF,
+    0xFE, 0xA2, 0xAF, 0xFF, 0xCA, 0x4E, 0xA4, 0xAD, 0xA6, 0xEA, 0x2A, 0xE7, 0x0E, 0x2E, 0x72, 0xC4,
+    0xC7, 0x77, 0x00, 0x77, 0x5F, 0xC7, 0x1F, 0x1F, 0xC7, 0x1E, 0xA1, 0x9F, 0xA7, 0xAE, 0x92, 0xFC,
+    0x7F, 0x3A, 0xF7, 0xE9, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0xDA, 0x5A, 0xFF, 0xFC,
+    0x7F, 0xC9, 0x99, 0x9E, 0xA7, 0xFC, 0x3E, 0x97, 0x9F, 0x29, 0xE7, 0x1F, 0xA1, 0xE9, 0x71, 0xAF,
+    0x1E, 0x72, 0x9F, 0x0A, 0xDA, 0x73, 0xFA, 0xE7, 0x4A, 0xFE, 0x74, 0x9F, 0xD9, 0x75, 0xFD, 0x76,
+    0xAF, 0xA7, 0x7E, 0xA7, 0x70, 0x99, 0x72, 0x59, 0xAA, 0xA9, 0x70, 0x9F, 0xEA, 0x59, 0xFF, 0xCA,
+    0x4A, 0xCA, 0x2A, 0xF7, 0x3F, 0xA7, 0x29, 0xF7, 0x3F, 0x73, 0xF6, 0xAE, 0xAF, 0x49, 0xFF, 0xD3,
+    0xAF, 0xAA, 0xFC, 0x29, 0xEA, 0x3F, 0x2F, 0x4F, 0x19, 0xE9, 0x4E, 0xA1, 0xF4, 0x9E, 0x91, 0xF4,
+    0xAE, 0x2F, 0x4F, 0x2F, 0x39, 0xE9, 0x2F, 0x3F, 0x3F, 0x2A, 0xE9, 0x3F, 0xCA, 0xFA, 0x5F, 0xF9,
+    0x7F, 0xCA, 0x73, 0x97, 0x10, 0x77, 0xFF, 0xFC, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x71, 0xF9,
+    0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x0F, 0xFF,
+    0xC9, 0x0F, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9,
+    0x71, 0xF9, 0x09, 0x96, 0xF9, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC0, 0x77, 0x77,
+    0x9A, 0xAA, 0xA9, 0x4C, 0xA6, 0x9F, 0xFC, 0xA1, 0xE5, 0xAF, 0xFF, 0xE5, 0xAF, 0xCA, 0xAA, 0xAF,
+    0xD5, 0xAF, 0x95, 0xAF, 0x5F, 0x96, 0xFC, 0xA3, 0xAE, 0xA6, 0xAF, 0xD3, 0xF6, 0xAD, 0x9F, 0x91,
+    0x9F, 0x5A, 0xD9, 0x0A, 0xEA, 0x19, 0xEA, 0x4A, 0xD9, 0x19, 0xEA, 0x1A, 0xE9, 0x3A, 0xD9, 0x29,
+    0xEA, 0x1A, 0xE9, 0x2A, 0xDA, 0x39, 0xEA, 0x1A, 0xE9, 0x19, 0xDA, 0x4A, 0xE9, 0x19, 0xEA, 0x09,
+    0xDA, 0x5F, 0x29, 0xF9, 0xDA, 0x6F, 0x3F, 0xDA, 0x6A, 0xEA, 0x3A, 0xFA, 0x69, 0xF5, 0xFC, 0x5A,
+    0xF9, 0x5F, 0xEA, 0xAF, 0xDA, 0x5F, 0xFF, 0xE9, 0x5E, 0x1A, 0xFF, 0xA7, 0xAC, 0x49, 0x9A, 0x99,
+    0x97, 0x77, 0x70, 0x71, 0xAA, 0x77, 0xAE, 0xA7, 0x59, 0xFC, 0x75, 0xFD, 0x97, 0x39, 0xFD, 0xA7,
+    0x3A, 0xFE, 0x73, 0xE0, 0xF9, 0x71, 0xAD, 0xA0, 0xFC, 0x71, 0xE1, 0x9F, 0x70, 0x9E, 0x2F, 0xA7,
+    0xE9, 0x2F, 0xC7, 0xE3, 0x9F, 0x95, 0xAD, 0xA4, 0xFA, 0x5E, 0x94, 0xFC, 0x49, 0xE5, 0x9F, 0x93,
+    0xEA, 0x6F, 0xA2, 0x9E, 0x96, 0xFC, 0x2A, 0xE7, 0x9F, 0x91, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC,
+    0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x00, 0x77, 0x29, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC,
+    0xA9, 0xFD, 0xAA, 0xAA, 0xAA, 0xFC, 0x90, 0xFC, 0x7F, 0x1A, 0xF7, 0xE9, 0x19, 0xFA, 0x5A, 0xE3,
+    0xFC, 0x5E, 0xA3, 0xAF, 0x49, 0xE5, 0xFA, 0x3A, 0xE5, 0xFC, 0x3E, 0x95, 0x9F, 0x29, 0xE7, 0xFA,
+    0x1E, 0xA7, 0xAF, 0x1E, 0x70, 0x9F, 0x0A, 0xDA, 0x71, 0xFA, 0xE7, 0x2A, 0xFE, 0x73, 0xFD, 0x97,
+    0x3F, 0xD7, 0x49, 0xFA, 0x75, 0xF7, 0x69, 0x97, 0x10, 0x77, 0x73, 0xAF, 0xFF, 0x5A, 0xFF, 0xFD,
+    0x4F, 0xFF, 0xF3, 0xFC, 0xA9, 0x97, 0x3A, 0xF7, 0x7F, 0x77, 0xAE, 0xA7, 0x7F, 0x77, 0x0F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x77, 0x0A, 0xF7, 0x70, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0xF5, 0xAF, 0xFF, 0xD7, 0x9A, 0xFF, 0xE0, 0x76,
+    0x99, 0x97, 0x70, 0x9E, 0x77, 0x0F, 0x71, 0xAF, 0xFF, 0x5A, 0xFF, 0xFD, 0x4F, 0xFF, 0xF3, 0xFC,
+    0xA9, 0x90, 0x9E, 0x95, 0xAF, 0x4A, 0xE6, 0xF5, 0xEA, 0x5A, 0xEA, 0x49, 0xE6, 0xF5, 0xAE, 0x6F,
+    0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xAA, 0xAA, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xF9, 0x29, 0xE7, 0x0A, 0xEA, 0x2E, 0xA7, 0x1F, 0x2E, 0x97, 0x1A, 0xF9,
+    0xAE, 0x73, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFF, 0x5A, 0xFF, 0xFD, 0x7F, 0xFF, 0xC6,
+    0x9E, 0x77, 0x0F, 0x77, 0x09, 0x99, 0x73, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF,
+    0xD4, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x2F, 0xCA, 0x75, 0x9F, 0x77, 0xF9, 0x77, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xAE, 0xA7, 0x79, 0xF7, 0x70, 0xFC, 0xA9, 0x76, 0xFF, 0xFF, 0xC4, 0xFF,
+    0xFF, 0x59, 0xAF, 0xFF, 0xC7, 0x29, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x5F, 0xFF, 0xA7, 0xFF,
+    0xFD, 0xA5, 0xFF, 0xFF, 0x75, 0x99, 0xAF, 0xC7, 0x70, 0xFA, 0x77, 0x0F, 0x77, 0x0A, 0xEA, 0x77,
+    0x0F, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x77, 0x0F, 0x77, 0xAE, 0xA7, 0x7F, 0x77, 0xFA,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0xFF, 0xFF, 0x4F, 0xFF, 0xDA, 0x5F, 0xFE, 0xA9,
+    0x60, 0x29, 0x99, 0x77, 0x1E, 0x97, 0x70, 0xF7, 0x6F, 0xFF, 0xA7, 0xFF, 0xFD, 0xA5, 0xFF, 0xFF,
+    0x79, 0xE9, 0x09, 0x9A, 0xFC, 0x7E, 0xA4, 0xFA, 0x6A, 0xE5, 0xF7, 0xE9, 0x4A, 0xEA, 0x6E, 0xA5,
+    0xF1, 0xAA, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA,
+    0xAA, 0xAE, 0xAA, 0xAA, 0xAF, 0x70, 0xE9, 0x29, 0xF7, 0x0A, 0xE2, 0xAE, 0xA7, 0x09, 0xE2, 0xF7,
+    0x2E, 0xA9, 0xFA, 0x29, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFD, 0xA5, 0xFF,
+    0xFC, 0x77, 0x1E, 0x97, 0x70, 0xF7, 0x71, 0x99, 0x95, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71,
+    0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x77, 0xAF, 0xC7, 0x70, 0xF9, 0x77, 0x9F, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x77, 0xAE, 0xA7, 0x69, 0xF9, 0x74, 0x9A, 0xFC, 0x2F, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99, 0x99, 0x99, 0x99, 0x97, 0x10, 0x77, 0x6F,
+    0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x19, 0xAF, 0xDA, 0xAA, 0xAF, 0xE9, 0x39, 0xF9, 0x6F, 0xA4,
+    0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96,
+    0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49,
+    0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F,
+    0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA2, 0x9F,
+    0xFA, 0x2A, 0xFF, 0x0F, 0xFD, 0x1A, 0xFF, 0xC0, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x19, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x77, 0x4F, 0xFF, 0xE9, 0x19, 0xFF, 0xFE, 0xA1, 0x9F, 0xCA, 0xAA, 0xAA, 0xFC,
+    0xA2, 0xFC, 0x95, 0x9E, 0x3F, 0xC6, 0xDA, 0x3A, 0xFA, 0x5A, 0xC9, 0x4F, 0xC7, 0x6F, 0xC7, 0x59,
+    0xF9, 0x75, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x76, 0xF7, 0x5F, 0x97, 0x4A, 0xEA, 0x74, 0x9F, 0x75,
+    0xF7, 0x5F, 0x96, 0xAA, 0x3A, 0xEA, 0x69, 0xD9, 0x19, 0xF7, 0xE9, 0x1F, 0x79, 0xE9, 0x0F, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xFC, 0x1A, 0xFF, 0xFE, 0xA2, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x00, 0x75, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x71, 0xAE,
+    0x72, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x2E, 0xA7, 0x1A, 0xE7, 0x2E, 0xA7,
+    0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x72, 0xEA, 0x71, 0xAE,
+    0x72, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x72, 0x99, 0x97, 0x20, 0x0F, 0x72,
+    0x9E, 0x97, 0x2F, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x97,
+    0x2F, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72,
+    0xAE, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x3E, 0xA7, 0x2F, 0x73, 0x99, 0x90, 0x5A, 0xA9, 0x71, 0x9D,
+    0x97, 0x19, 0xD9, 0x5A, 0xC9, 0x09, 0xD9, 0x09, 0xCA, 0x1F, 0x9D, 0x9F, 0x1A, 0xFF, 0xDA, 0x3A,
+    0xFD, 0xA5, 0x9F, 0xD9, 0x39, 0xFF, 0xD9, 0x09, 0xFA, 0xDA, 0xF9, 0x0E, 0x09, 0xD9, 0x0E, 0x29,
+    0x19, 0xD9, 0x19, 0x69, 0xD9, 0x71, 0x9D, 0x94, 0x39, 0xAA, 0xA9, 0x49, 0xFD, 0xA2, 0x9F, 0xFA,
+    0x1E, 0xA1, 0xAE, 0x1E, 0x3E, 0x1E, 0x3E, 0x1E, 0x3E, 0x1F, 0x99, 0xEA, 0x19, 0xFF, 0x39, 0xFD,
+    0x69, 0x99, 0x40, 0x29, 0x2F, 0x0A, 0xFA, 0xAF, 0xA0, 0xF6, 0x77, 0x99, 0x97, 0x6A, 0xDA, 0x76,
+    0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xD9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xE7, 0x7E,
+    0x39, 0x99, 0x99, 0x5A, 0xDA, 0x29, 0xFC, 0xA4, 0xE9, 0x29, 0xFD, 0x4E, 0x4A, 0xAF, 0x39, 0xDA,
+    0x69, 0xE9, 0x2A, 0xD9, 0x7E, 0xA2, 0xE7, 0x0F, 0x19, 0xDA, 0x70, 0xAE, 0x1A, 0xD9, 0x71, 0xE9,
+    0x0E, 0x72, 0xEA, 0x0E, 0x72, 0xAE, 0x9D, 0x97, 0x29, 0xFD, 0x74, 0xFD, 0x74, 0xAF, 0xA7, 0x49,
+    0xF7, 0x6F, 0x77, 0x99, 0x70, 0x39, 0x96, 0x91, 0xAF, 0x92, 0x9D, 0x0F, 0xE9, 0x0A, 0xE9, 0xEA,
+    0xAE, 0xAE, 0x9A, 0xD9, 0x19, 0xFA, 0x1E, 0x3A, 0xE2, 0xE3, 0xF9, 0x1A, 0xDA, 0x1A, 0xFC, 0x90,
+    0x9F, 0xE9, 0x9E, 0xA0, 0xFD, 0x91, 0xAE, 0x1A, 0xDA, 0x93, 0x9D, 0x75, 0x39, 0x79, 0x94, 0xAF,
+    0x39, 0xF9, 0x1A, 0xFD, 0x1A, 0xFD, 0x1E, 0xAA, 0xEA, 0xEA, 0xE9, 0xAD, 0x91, 0x9F, 0x91, 0x9D,
+    0xAA, 0xD3, 0xAE, 0x3D, 0xAA, 0xD9, 0x2F, 0x3D, 0xAA, 0xDA, 0x1F, 0xD1, 0xAD, 0xA9, 0xFE, 0x99,
+    0xFE, 0x1A, 0xFC, 0x91, 0xAF, 0xCA, 0x2A, 0xE9, 0x39, 0xE9, 0x10, 0x77, 0x3E, 0x97, 0x6E, 0x97,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x00, 0x77, 0x77,
+    0x6A, 0xA7, 0x73, 0x9E, 0x77, 0x2F, 0x97, 0x70, 0xFA, 0x77, 0x0F, 0xA7, 0x70, 0xAF, 0x77, 0x09,
+    0xF7, 0x71, 0xF9, 0x77, 0x0F, 0xA7, 0x70, 0xFA, 0x77, 0x0A, 0xF7, 0x70, 0x9F, 0x77, 0x1F, 0x97,
+    0x70, 0xF9, 0x77, 0x0F, 0xA7, 0x70, 0xAF, 0x77, 0x09, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA3, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x09, 0x99, 0x0A, 0xE0, 0xAE,
+    0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A,
+    0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0,
+    0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x09, 0xAA, 0xA0, 0x09, 0x99, 0x29, 0x99, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A,
+    0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A,
+    0xE1, 0xAE, 0x09, 0xAA, 0xA1, 0x9A, 0xAA, 0x00, 0x77, 0x75, 0xE9, 0x77, 0xAF, 0x77, 0xFC, 0x97,
+    0x59, 0xFC, 0xA7, 0x5F, 0xE7, 0x5E, 0xAE, 0xA7, 0x3A, 0xE0, 0xF7, 0x3E, 0xA0, 0x9E, 0x97, 0x19,
+    0xE9, 0x1E, 0xA7, 0x1F, 0x2A, 0xE7, 0x09, 0xEA, 0x29, 0xEA, 0x7A, 0xE4, 0xF7, 0xF4, 0x9E, 0x95,
+    0xAE, 0x95, 0xF5, 0xF6, 0xAE, 0x49, 0xEA, 0x69, 0xEA, 0x3A, 0xE7, 0x0F, 0x3F, 0x70, 0xAE, 0x91,
+    0xAE, 0x97, 0x1F, 0x1F, 0x72, 0xF0, 0x77, 0x5F, 0x72, 0xF1, 0xAE, 0x97, 0x1F, 0x2F, 0x70, 0xAE,
+    0x92, 0xAE, 0x70, 0xF3, 0x9E, 0xA6, 0x9E, 0xA4, 0xF6, 0xF5, 0x9E, 0x95, 0xEA, 0x6F, 0x4A, 0xE9,
+    0x6A, 0xE4, 0xF7, 0x0E, 0xA2, 0x9E, 0xA7, 0x0F, 0x2A, 0xE7, 0x19, 0xE9, 0x1E, 0xA7, 0x2F, 0x09,
+    0xE9, 0x72, 0xAE, 0x0F, 0x74, 0xFE, 0x97, 0x4F, 0xE7, 0x59, 0xFC, 0xA7, 0x6F, 0xC7, 0x7A, 0xF7,
+    0x70, 0xE9, 0x70, 0x49, 0xAA, 0xAA, 0xA9, 0x79, 0xFF, 0xC9, 0x4A, 0xFF, 0xEA, 0x29, 0xFC, 0xAA,
+    0xAF, 0xC9, 0x1F, 0x94, 0xAF, 0x1E, 0xA6, 0xAE, 0x09, 0xE7, 0x0E, 0x99, 0xE7, 0x0E, 0x9A, 0xE7,
+    0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E,
+    0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA,
+    0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xA0, 0x77, 0x0A, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E,
+    0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA,
+    0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xA9, 0xE7,
+    0x0E, 0x99, 0xE9, 0x69, 0xE9, 0x0E, 0xA6, 0xAE, 0x1F, 0xA4, 0xAF, 0x19, 0xFF, 0xFC, 0x39, 0xFF,
+    0xE9, 0x5A, 0xFE, 0xA7, 0x19, 0x99, 0x99, 0x50, 0x71, 0xAA, 0xA9, 0x71, 0xAF, 0xD9, 0x6F, 0xFC,
+    0x59, 0xF9, 0xAD, 0xA5, 0xF9, 0x1C, 0xA6, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF6, 0x9C, 0x19,
+    0xF5, 0xAD, 0xA0, 0xAE, 0xA5, 0xFF, 0xC6, 0x9F, 0xE7, 0x1A, 0xAC, 0xA9, 0x70, 0x77, 0x71, 0x9E,
+    0x97, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x69, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0xF7, 0x0A, 0xE0, 0xAF, 0x96, 0x9F, 0xAA, 0xF9, 0x69, 0xFA, 0x9F, 0x70, 0xF9, 0x19,
+    0x97, 0x29, 0x91, 0x77, 0x3A, 0xDA, 0x70, 0xAE, 0x0A, 0xF9, 0x69, 0xFA, 0xAF, 0x96, 0x9F, 0xA9,
+    0xF7, 0x0F, 0x90, 0x9A, 0x97, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0x9E, 0xA7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5A, 0xEA, 0x76, 0x99, 0x97, 0x19, 0xAA, 0x2F, 0xC1, 0xFC,
+    0x1F, 0xC1, 0x9E, 0x97, 0x77, 0x77, 0x49, 0xAA, 0x2F, 0xC1, 0xFC, 0x1F, 0xC1, 0x9E, 0x10, 0x77,
+    0x3A, 0xDA, 0x70, 0xAE, 0x0A, 0xF9, 0x69, 0xFA, 0xAF, 0x96, 0x9F, 0xA9, 0xF7, 0x0F, 0x90, 0x9A,
+    0x97, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x70, 0xAE, 0x0A, 0xF9,
+    0x69, 0xFA, 0xAF, 0x96, 0x9F, 0xA9, 0xF7, 0x0F, 0x91, 0x99, 0x72, 0x99, 0x10, 0x77, 0x3A, 0xAA,
+    0xA9, 0x59, 0xA1, 0x9F, 0xE9, 0x29, 0xDA, 0x9F, 0xFF, 0xE9, 0xAD, 0x92, 0xAF, 0xEA, 0x1C, 0xA5,
+    0xAE, 0xA9, 0x77, 0x20, 0x77, 0x2A, 0xFC, 0x94, 0xD1, 0xFF, 0xC9, 0x09, 0xEA, 0xAE, 0xAA, 0xFF,
+    0xD0, 0xAD, 0x4A, 0xFD, 0x29, 0x79, 0xA9, 0x97, 0x77, 0x74, 0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9,
+    0x9F, 0xFF, 0xE9, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF,
+    0xE9, 0xAF, 0xFF, 0xE9, 0x77, 0x00, 0x29, 0x97, 0x19, 0xFC, 0x3A, 0xCA, 0x9F, 0xEA, 0x09, 0xFE,
+    0xAF, 0xFA, 0xE2, 0xAF, 0xD1, 0xA9, 0x4A, 0xD9, 0x49, 0x99, 0x59, 0x19, 0xFC, 0x3A, 0xCA, 0x9F,
+    0xEA, 0x09, 0xFE, 0xAF, 0xFA, 0xE2, 0xAF, 0xD1, 0xA9, 0x4A, 0xD9, 0x10, 0x77, 0x1D, 0xA9, 0x94,
+    0x99, 0xAD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x49, 0x9A, 0xAA, 0xAA, 0x99, 0x77, 0x77, 0x70,
+    0x9A, 0xAA, 0xEA, 0xAA, 0x93, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xCA, 0x97, 0x09, 0xAC, 0x77, 0x10,
+    0x77, 0x6D, 0x97, 0x1A, 0xD9, 0x19, 0xFF, 0xF9, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x5E, 0x71, 0xAD,
+    0x95, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x09, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x99, 0xE9, 0x99, 0x99,
+    0x99, 0x29, 0xD9, 0x72, 0xAA, 0x77, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A,
+    0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x72,
+    0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x77, 0x00, 0x77, 0x7A, 0xCA, 0x70,
+    0xAF, 0x6A, 0xFC, 0x94, 0xAF, 0xC9, 0x4A, 0xFA, 0x59, 0xFA, 0x79, 0xFA, 0x70, 0x9F, 0xCA, 0x70,
+    0x9F, 0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xC7, 0x1A, 0xE7, 0x3A, 0x77, 0x9F, 0xFF, 0x99, 0xFF,
+    0xF9, 0x9F, 0xFF, 0x90, 0x19, 0x73, 0xAD, 0x97, 0x1F, 0xC9, 0x79, 0xAF, 0xC9, 0x70, 0xAF, 0xC9,
+    0x70, 0xAF, 0xC9, 0x70, 0xAF, 0x97, 0x9F, 0x95, 0xAF, 0xC9, 0x4A, 0xFC, 0x94, 0xAF, 0xC9, 0x5F,
+    0xC9, 0x7A, 0xCA, 0x97, 0x77, 0x74, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x77, 0x77,
+    0x2A, 0xCA, 0x7A, 0xC9, 0x70, 0xAF, 0x49, 0xFC, 0x6A, 0xFC, 0x92, 0x9F, 0xCA, 0x5A, 0xFC, 0x92,
+    0x9F, 0xCA, 0x5A, 0xFA, 0x39, 0xFC, 0xA6, 0xFA, 0x4A, 0xF9, 0x79, 0xFA, 0x4A, 0xF9, 0x70, 0x9F,
+    0xCA, 0x39, 0xFC, 0xA7, 0x09, 0xFC, 0xA3, 0x9F, 0xCA, 0x70, 0x9F, 0xCA, 0x3A, 0xFC, 0xA7, 0x09,
+    0xFC, 0x4A, 0xFC, 0x71, 0x9E, 0x6A, 0xD9, 0x73, 0x99, 0x70, 0xA1, 0x77, 0x71, 0x9C, 0xA7, 0xAC,
+    0xA7, 0x2F, 0xA9, 0x4F, 0xA7, 0x1A, 0xFC, 0x92, 0x9F, 0xCA, 0x71, 0xAF, 0xC9, 0x29, 0xFC, 0xA7,
+    0x1A, 0xFC, 0x93, 0xAF, 0xA7, 0x19, 0xFA, 0x4A, 0xF7, 0x09, 0xFA, 0x4A, 0xF6, 0xAF, 0xC9, 0x3A,
+    0xFC, 0x94, 0xAF, 0xC9, 0x3A, 0xFC, 0x94, 0xAF, 0xCA, 0x3A, 0xFC, 0x95, 0xFC, 0xA3, 0x9F, 0xC9,
+    0x7A, 0xDA, 0x6E, 0x97, 0x2A, 0x70, 0x99, 0x72, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71, 0xFF,
+    0xFD, 0x95, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x77, 0x9F, 0xC7, 0x70, 0xF9, 0x77, 0x9F, 0x77, 0x0F,
+    0x77, 0x0F, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7F, 0x97, 0x5A, 0xFC, 0x2F, 0xFF, 0xFC,
+    0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99, 0x99, 0x99, 0x99, 0x97, 0x10, 0x76, 0x99, 0x97,
+    0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xE9, 0x74, 0x99, 0x9A, 0xE9, 0x99, 0x59, 0xAF, 0xFF, 0xC4,
+    0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x2F, 0xCA, 0x3E, 0xA5, 0x9F, 0x49, 0xE6, 0xF9, 0x4A, 0xE6, 0xF5,
+    0xEA, 0x6F, 0x49, 0xE7, 0xF4, 0xF7, 0xF4, 0xE9, 0x7F, 0x92, 0x9E, 0x70, 0x9F, 0x2E, 0xA7, 0x1F,
+    0xCA, 0x9E, 0x97, 0x2F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF5, 0x9A, 0xFF, 0xFC, 0x7A, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x7E, 0xA7, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xAA, 0x97, 0x20, 0x73, 0x99, 0x97,
+    0x70, 0xF7, 0x70, 0xE9, 0x77, 0xAE, 0x79, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x7F, 0xFF, 0xCA, 0x95,
+    0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x72, 0x9E, 0x9A, 0xFC, 0x71, 0xAE, 0x2F, 0x97, 0x0E, 0xA2, 0xAF,
+    0x79, 0xE4, 0xF7, 0xF4, 0xF7, 0xE9, 0x4F, 0x6A, 0xE5, 0xF6, 0xEA, 0x49, 0xF6, 0xE9, 0x4F, 0x95,
+    0xAE, 0x39, 0xFC, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99, 0xEA, 0x99,
+    0x99, 0x73, 0x9E, 0x77, 0x0E, 0xA7, 0x70, 0xE9, 0x77, 0x09, 0x99, 0x76, 0x77, 0x79, 0xAF, 0xFE,
+    0xA2, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFA, 0x0A, 0xFC, 0x99, 0x72, 0xF9, 0x74, 0x9E, 0xA7, 0x5A,
+    0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xEA, 0x75, 0x9F, 0x76, 0xFA, 0x75, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x91, 0x9F, 0xFF, 0xEA, 0x3F, 0xFF, 0xDA, 0x59, 0xAA, 0xFF, 0xCA, 0x77, 0x39, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFC, 0xA0, 0x77, 0x2A, 0xFF, 0xEA, 0x94, 0xAF, 0xFF, 0xDA, 0x2A, 0xFF, 0xFF, 0x73, 0x99, 0xFC,
+    0xA7, 0x59, 0xF7, 0x6A, 0xE9, 0x75, 0x9E, 0xA7, 0x59, 0xEA, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x4A,
+    0xF0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x90, 0xAF, 0xFF, 0xE9, 0x1A, 0xFF, 0xFD, 0x3A,
+    0xFF, 0xCA, 0xA9, 0x77, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF,
+    0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x00, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A,
+    0xFF, 0xEA, 0x6E, 0xA1, 0xAC, 0xA1, 0xAE, 0x4E, 0x92, 0xAC, 0xA2, 0x9E, 0x29, 0xD9, 0x3A, 0xCA,
+    0x39, 0xD9, 0x1D, 0xA4, 0xAC, 0xA4, 0xAD, 0x09, 0xD5, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5, 0xAC, 0xA5,
+    0xDA, 0xDA, 0x5A, 0xCA, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0xAC, 0xA5, 0xAD, 0xAC,
+    0xA5, 0xAC, 0xA5, 0xAC, 0xA9, 0xD5, 0xAC, 0xA5, 0xD9, 0x0D, 0xA4, 0xAC, 0xA4, 0xAD, 0x1A, 0xD4,
+    0xAC, 0xA4, 0xDA, 0x2E, 0x3A, 0xCA, 0x3E, 0x4E, 0xA1, 0xAC, 0xA1, 0xAE, 0x6A, 0xFF, 0xEA, 0x70,
+    0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x70, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xFA, 0xAA,
+    0xFA, 0x6E, 0xA6, 0xAE, 0x4E, 0x97, 0x09, 0xE2, 0x9D, 0x97, 0x29, 0xD9, 0x1D, 0xA7, 0x4A, 0xD0,
+    0x9D, 0x76, 0xD9, 0xAC, 0xA7, 0x6A, 0xCA, 0xDA, 0x76, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA,
+    0x76, 0xAD, 0xAC, 0xA7, 0x6A, 0xCA, 0x9D, 0x76, 0xD9, 0x0D, 0xA7, 0x4A, 0xD1, 0xAD, 0x74, 0xDA,
+    0x2E, 0x72, 0xE4, 0xEA, 0x6A, 0xE6, 0xAF, 0xAA, 0xAF, 0xA7, 0x09, 0xFF, 0xC9, 0x74, 0x99, 0x99,
+    0x97, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xFA, 0xAA, 0xFA, 0x6E, 0xA6, 0xAE, 0x4E, 0xA7,
+    0x0A, 0xE2, 0x9F, 0xA6, 0xAF, 0x91, 0xDA, 0xAD, 0xA4, 0xAD, 0xAA, 0xD0, 0x9D, 0x1A, 0xDA, 0x2A,
+    0xDA, 0x1D, 0x9A, 0xCA, 0x2A, 0xDA, 0x0A, 0xDA, 0x2D, 0xAD, 0xA3, 0xAF, 0xCA, 0x3A, 0xF9, 0x4A,
+    0xEA, 0x49, 0xF9, 0x4A, 0xE9, 0x49, 0xFA, 0x3A, 0xFC, 0x93, 0xAD, 0xAC, 0xA2, 0xAD, 0xA0, 0xAD,
+    0x92, 0xAC, 0xA9, 0xD1, 0xAD, 0xA2, 0xAD, 0xA1, 0xD9, 0x0D, 0xAA, 0xDA, 0x4A, 0xDA, 0xAD, 0x1A,
+    0xFA, 0x6A, 0xFA, 0x2E, 0xA7, 0x0F, 0x4E, 0xA6, 0xAE, 0x6A, 0xFA, 0xAA, 0xFA, 0x70, 0x9F, 0xFC,
+    0x97, 0x49, 0x99, 0x99, 0x70, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xFA, 0xAA, 0xFA, 0x6E,
+    0xA6, 0xAE, 0x4E, 0x97, 0x0A, 0xE2, 0x9D, 0x97, 0x0A, 0xF9, 0x1D, 0xA7, 0x0A, 0xDA, 0xAD, 0x09,
+    0xD7, 0x0A, 0xDA, 0x1D, 0x9A, 0xD7, 0xAD, 0xA2, 0xDA, 0xDA, 0x6A, 0xDA, 0x3A, 0xF9, 0x5A, 0xDA,
+    0x49, 0xF9, 0x4A, 0xDA, 0x59, 0xFA, 0x3A, 0xDA, 0x6A, 0xDA, 0xCA, 0x2A, 0xDA, 0x7D, 0xA9, 0xD1,
+    0xAD, 0xA7, 0x0D, 0x90, 0xDA, 0xAD, 0xA7, 0x0A, 0xD1, 0xAF, 0xA7, 0x1D, 0xA2, 0xEA, 0x70, 0x9E,
+    0x4E, 0xA6, 0xAE, 0x6A, 0xFA, 0xAA, 0xFA, 0x70, 0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x70, 0x77,
+    0x69, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39,
+    0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9,
+    0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x95, 0x9A, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0x9A,
+    0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA0, 0x29, 0x2F, 0x0A, 0xFA, 0xAF, 0xA0, 0xF6,
+    0x19, 0x97, 0x97, 0x09, 0x2F, 0x4A, 0xEA, 0x4F, 0x9A, 0xF9, 0x3F, 0xC3, 0x9F, 0xAA, 0xF9, 0x3F,
+    0xC3, 0x9F, 0xA9, 0xF4, 0xAE, 0x94, 0xF7, 0x77, 0x10, 0x74, 0xA7, 0x77, 0x0A, 0xCA, 0x77, 0x6A,
+    0xEA, 0x77, 0x4A, 0xFC, 0xA7, 0x72, 0xAC, 0xA9, 0x9A, 0xDA, 0x77, 0x0A, 0xC5, 0xAC, 0xA7, 0x6A,
+    0xCA, 0x69, 0xCA, 0x74, 0xAE, 0x09, 0xAA, 0x92, 0xAC, 0xA7, 0x2A, 0xFF, 0xD2, 0xDA, 0x70, 0xAF,
+    0xFF, 0x1E, 0xA6, 0xAF, 0xFF, 0xC1, 0xAE, 0xA4, 0xAF, 0xFF, 0xD1, 0xAF, 0xA2, 0xAF, 0xFF, 0xD9,
+    0x1A, 0xFC, 0xA0, 0xAF, 0xFE, 0xA9, 0x4F, 0xEA, 0x0F, 0xFD, 0x6F, 0xF2, 0xFF, 0xC4, 0xAF, 0xF4,
+    0xFF, 0x2A, 0xFF, 0xC6, 0xFE, 0x1A, 0xFF, 0xC7, 0x0F, 0xD9, 0x09, 0xFF, 0x72, 0xFF, 0xFE, 0x74,
+    0xFD, 0xAF, 0xD7, 0x6F, 0x2F, 0x77, 0x0E, 0x2E, 0x77, 0x2D, 0x90, 0xAD, 0x77, 0x4F, 0xC7, 0x76,
+    0xE7, 0x77, 0x0C, 0x77, 0x77, 0x70,
 };
 
 static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 6, 23, 9, 2, 22, 35, 0 }, // !
-    { 10, 10, 12, 1, 21, 25, 35 }, // "
-    { 18, 19, 19, 0, 17, 86, 60 }, // #
-    { 15, 30, 18, 2, 24, 113, 146 }, // $
-    { 26, 24, 28, 1, 22, 156, 259 }, // %
-    { 23, 23, 24, 0, 22, 133, 415 }, // &
-    { 5, 10, 7, 1, 21, 13, 548 }, // '
-    { 10, 29, 12, 1, 24, 73, 561 }, // (
-    { 10, 29, 11, 0, 24, 73, 634 }, // )
-    { 11, 11, 12, 0, 22, 31, 707 }, // *
-    { 14, 14, 18, 2, 17, 49, 738 }, // +
-    { 8, 11, 9, 0, 5, 22, 787 }, // ,
-    { 9, 5, 11, 1, 10, 12, 809 }, // -
-    { 6, 6, 8, 1, 5, 9, 821 }, // .
-    { 15, 23, 16, 0, 21, 87, 830 }, // /
-    { 18, 22, 19, 0, 21, 99, 917 }, // 0
-    { 14, 21, 18, 2, 21, 74, 1016 }, // 1
-    { 16, 21, 18, 1, 21, 84, 1090 }, // 2
-    { 15, 22, 18, 1, 21, 83, 1174 }, // 3
-    { 18, 22, 19, 0, 21, 99, 1257 }, // 4
-    { 15, 21, 18, 1, 20, 79, 1356 }, // 5
-    { 16, 22, 18, 1, 21, 88, 1435 }, // 6
-    { 15, 21, 18, 2, 20, 79, 1523 }, // 7
-    { 16, 22, 18, 1, 21, 88, 1602 }, // 8
-    { 16, 22, 18, 1, 21, 88, 1690 }, // 9
-    { 6, 17, 8, 1, 16, 26, 1778 }, // :
-    { 8, 22, 9, 0, 16, 44, 1804 }, // ;
-    { 14, 14, 18, 2, 17, 49, 1848 }, // <
-    { 14, 9, 18, 2, 14, 32, 1897 }, // =
-    { 14, 14, 18, 2, 17, 49, 1929 }, // >
-    { 12, 23, 14, 1, 22, 69, 1978 }, // ?
-    { 27, 27, 29, 1, 21, 183, 2047 }, // @
-    { 23, 21, 24, 0, 21, 121, 2230 }, // A
-    { 17, 22, 19, 1, 21, 94, 2351 }, // B
-    { 17, 22, 19, 1, 21, 94, 2445 }, // C
-    { 21, 22, 23, 1, 21, 116, 2539 }, // D
-    { 17, 21, 19, 1, 21, 90, 2655 }, // E
-    { 16, 21, 18, 1, 21, 84, 2745 }, // F
-    { 20, 22, 22, 1, 21, 110, 2829 }, // G
-    { 23, 21, 25, 1, 21, 121, 2939 }, // H
-    { 11, 21, 13, 1, 21, 58, 3060 }, // I
-    { 14, 27, 13, -2, 21, 95, 3118 }, // J
-    { 21, 22, 23, 1, 21, 116, 3213 }, // K
-    { 17, 21, 19, 1, 21, 90, 3329 }, // L
-    { 27, 21, 28, 0, 21, 142, 3419 }, // M
-    { 24, 22, 25, 0, 21, 132, 3561 }, // N
-    { 21, 22, 23, 1, 21, 116, 3693 }, // O
-    { 17, 21, 19, 1, 21, 90, 3809 }, // P
-    { 22, 28, 24, 1, 21, 154, 3899 }, // Q
-    { 21, 22, 23, 1, 21, 116, 4053 }, // R
-    { 15, 22, 17, 1, 21, 83, 4169 }, // S
-    { 20, 21, 21, 0, 21, 105, 4252 }, // T
-    { 23, 22, 24, 0, 21, 127, 4357 }, // U
-    { 23, 22, 24, 0, 21, 127, 4484 }, // V
-    { 32, 22, 33, 0, 21, 176, 4611 }, // W
-    { 22, 21, 23, 0, 21, 116, 4787 }, // X
-    { 21, 21, 22, 0, 21, 111, 4903 }, // Y
-    { 17, 22, 18, 0, 21, 94, 5014 }, // Z
-    { 8, 28, 10, 1, 23, 56, 5108 }, // [
-    { 15, 23, 16, 0, 21, 87, 5164 }, // <backslash>
-    { 7, 28, 10, 1, 23, 49, 5251 }, // ]
-    { 16, 14, 18, 1, 19, 56, 5300 }, // ^
-    { 15, 4, 16, 0, -1, 15, 5356 }, // _
-    { 7, 8, 20, 6, 25, 14, 5371 }, // `
-    { 16, 17, 18, 1, 16, 68, 5385 }, // a
-    { 18, 24, 18, -1, 23, 108, 5453 }, // b
-    { 14, 17, 16, 1, 16, 60, 5561 }, // c
-    { 18, 24, 20, 1, 23, 108, 5621 }, // d
-    { 14, 17, 16, 1, 16, 60, 5729 }, // e
-    { 16, 23, 17, 0, 23, 92, 5789 }, // f
-    { 18, 23, 19, 0, 16, 104, 5881 }, // g
-    { 19, 23, 20, 0, 23, 110, 5985 }, // h
-    { 10, 23, 11, 0, 23, 58, 6095 }, // i
-    { 10, 30, 9, -2, 23, 75, 6153 }, // j
-    { 19, 24, 20, 0, 23, 114, 6228 }, // k
-    { 10, 23, 11, 0, 23, 58, 6342 }, // l
-    { 29, 16, 30, 0, 16, 116, 6400 }, // m
-    { 20, 16, 21, 0, 16, 80, 6516 }, // n
-    { 16, 17, 18, 1, 16, 68, 6596 }, // o
-    { 18, 23, 19, 0, 16, 104, 6664 }, // p
-    { 17, 23, 19, 1, 16, 98, 6768 }, // q
-    { 14, 16, 15, 0, 16, 56, 6866 }, // r
-    { 13, 17, 15, 1, 16, 56, 6922 }, // s
-    { 13, 20, 13, -1, 19, 65, 6978 }, // t
-    { 20, 17, 21, 0, 16, 85, 7043 }, // u
-    { 19, 17, 20, 0, 16, 81, 7128 }, // v
-    { 26, 17, 27, 0, 16, 111, 7209 }, // w
-    { 18, 16, 19, 0, 16, 72, 7320 }, // x
-    { 19, 23, 20, 0, 16, 110, 7392 }, // y
-    { 15, 17, 16, 0, 16, 64, 7502 }, // z
-    { 10, 29, 12, 1, 24, 73, 7566 }, // {
-    { 5, 27, 9, 2, 23, 34, 7639 }, // |
-    { 10, 29, 12, 0, 24, 73, 7673 }, // }
-    { 14, 7, 18, 2, 13, 25, 7746 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7771 }, //  
-    { 6, 23, 8, 1, 16, 35, 7771 }, // ¡
-    { 16, 29, 18, 1, 23, 116, 7806 }, // ¢
-    { 18, 22, 19, 0, 21, 99, 7922 }, // £
-    { 16, 14, 18, 1, 17, 56, 8021 }, // ¤
-    { 20, 20, 20, -1, 20, 100, 8077 }, // ¥
-    { 5, 27, 9, 2, 23, 34, 8177 }, // ¦
-    { 13, 23, 15, 1, 20, 75, 8211 }, // §
-    { 12, 5, 20, 4, 23, 15, 8286 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8301 }, // ©
-    { 11, 15, 13, 1, 21, 42, 8422 }, // ª
-    { 16, 12, 17, 0, 13, 48, 8464 }, // «
-    { 14, 8, 18, 2, 14, 28, 8512 }, // ¬
-    { 9, 5, 11, 1, 10, 12, 8540 }, // ­
-    { 17, 16, 18, 0, 23, 68, 8552 }, // ®
-    { 11, 3, 20, 4, 21, 9, 8620 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 8629 }, // °
-    { 14, 18, 18, 2, 17, 63, 8662 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8725 }, // ²
-    { 11, 14, 13, 1, 24, 39, 8764 }, // ³
-    { 6, 8, 20, 7, 25, 12, 8803 }, // ´
-    { 19, 23, 21, 1, 16, 110, 8815 }, // µ
-    { 17, 26, 18, 0, 21, 111, 8925 }, // ¶
-    { 6, 6, 8, 1, 11, 9, 9036 }, // ·
-    { 6, 7, 20, 7, -1, 11, 9045 }, // ¸
-    { 10, 14, 13, 1, 24, 35, 9056 }, // ¹
-    { 11, 15, 13, 1, 21, 42, 9091 }, // º
-    { 16, 12, 18, 1, 13, 48, 9133 }, // »
-    { 30, 25, 32, 1, 22, 188, 9181 }, // ¼
-    { 30, 25, 32, 1, 22, 188, 9369 }, // ½
-    { 30, 25, 32, 1, 22, 188, 9557 }, // ¾
-    { 12, 23, 14, 1, 16, 69, 9745 }, // ¿
-    { 23, 29, 24, 0, 29, 167, 9814 }, // À
-    { 23, 29, 24, 0, 29, 167, 9981 }, // Á
-    { 23, 28, 24, 0, 28, 161, 10148 }, // Â
-    { 23, 28, 24, 0, 28, 161, 10309 }, // Ã
-    { 23, 27, 24, 0, 27, 156, 10470 }, // Ä
-    { 23, 29, 24, 0, 29, 167, 10626 }, // Å
-    { 29, 21, 29, -1, 21, 153, 10793 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 10946 }, // Ç
-    { 17, 29, 19, 1, 29, 124, 11070 }, // È
-    { 17, 29, 19, 1, 29, 124, 11194 }, // É
-    { 17, 28, 19, 1, 28, 119, 11318 }, // Ê
-    { 17, 27, 19, 1, 27, 115, 11437 }, // Ë
-    { 11, 29, 13, 1, 29, 80, 11552 }, // Ì
-    { 11, 29, 13, 1, 29, 80, 11632 }, // Í
-    { 12, 28, 13, 0, 28, 84, 11712 }, // Î
-    { 12, 27, 13, 0, 27, 81, 11796 }, // Ï
-    { 22, 22, 23, 0, 21, 121, 11877 }, // Ð
-    { 24, 29, 25, 0, 28, 174, 11998 }, // Ñ
-    { 21, 30, 23, 1, 29, 158, 12172 }, // Ò
-    { 21, 30, 23, 1, 29, 158, 12330 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 12488 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 12641 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 12794 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 12941 }, // ×
-    { 23, 22, 24, 0, 21, 127, 12984 }, // Ø
-    { 23, 30, 24, 0, 29, 173, 13111 }, // Ù
-    { 23, 30, 24, 0, 29, 173, 13284 }, // Ú
-    { 23, 29, 24, 0, 28, 167, 13457 }, // Û
-    { 23, 28, 24, 0, 27, 161, 13624 }, // Ü
-    { 21, 29, 22, 0, 29, 153, 13785 }, // Ý
-    { 17, 21, 19, 1, 21, 90, 13938 }, // Þ
-    { 19, 24, 20, 0, 23, 114, 14028 }, // ß
-    { 16, 26, 18, 1, 25, 104, 14142 }, // à
-    { 16, 26, 18, 1, 25, 104, 14246 }, // á
-    { 16, 25, 18, 1, 24, 100, 14350 }, // â
-    { 16, 24, 18, 1, 23, 96, 14450 }, // ã
-    { 16, 24, 18, 1, 23, 96, 14546 }, // ä
-    { 16, 26, 18, 1, 25, 104, 14642 }, // å
-    { 22, 17, 24, 1, 16, 94, 14746 }, // æ
-    { 14, 24, 16, 1, 16, 84, 14840 }, // ç
-    { 14, 26, 16, 1, 25, 91, 14924 }, // è
-    { 14, 26, 16, 1, 25, 91, 15015 }, // é
-    { 14, 25, 16, 1, 24, 88, 15106 }, // ê
-    { 14, 24, 16, 1, 23, 84, 15194 }, // ë
-    { 10, 25, 11, 0, 25, 63, 15278 }, // ì
-    { 10, 25, 11, 0, 25, 63, 15341 }, // í
-    { 11, 24, 12, 0, 24, 66, 15404 }, // î
-    { 11, 23, 12, 0, 23, 64, 15470 }, // ï
-    { 16, 25, 18, 1, 24, 100, 15534 }, // ð
-    { 20, 23, 21, 0, 23, 115, 15634 }, // ñ
-    { 16, 26, 18, 1, 25, 104, 15749 }, // ò
-    { 16, 26, 18, 1, 25, 104, 15853 }, // ó
-    { 16, 25, 18, 1, 24, 100, 15957 }, // ô
-    { 16, 24, 18, 1, 23, 96, 16057 }, // õ
-    { 16, 24, 18, 1, 23, 96, 16153 }, // ö
-    { 14, 14, 18, 2, 17, 49, 16249 }, // ÷
-    { 17, 17, 18, 0, 16, 73, 16298 }, // ø
-    { 20, 26, 21, 0, 25, 130, 16371 }, // ù
-    { 20, 26, 21, 0, 25, 130, 16501 }, // ú
-    { 20, 25, 21, 0, 24, 125, 16631 }, // û
-    { 20, 24, 21, 0, 23, 120, 16756 }, // ü
-    { 19, 32, 20, 0, 25, 152, 16876 }, // ý
-    { 18, 30, 19, 0, 23, 135, 17028 }, // þ
-    { 19, 30, 20, 0, 23, 143, 17163 }, // ÿ
-    { 23, 26, 24, 0, 26, 150, 17306 }, // Ā
-    { 16, 22, 18, 1, 21, 88, 17456 }, // ā
-    { 23, 28, 24, 0, 28, 161, 17544 }, // Ă
-    { 16, 24, 18, 1, 23, 96, 17705 }, // ă
-    { 23, 28, 24, 0, 21, 161, 17801 }, // Ą
-    { 16, 23, 18, 1, 16, 92, 17962 }, // ą
-    { 17, 30, 19, 1, 29, 128, 18054 }, // Ć
-    { 14, 26, 16, 1, 25, 91, 18182 }, // ć
-    { 17, 29, 19, 1, 28, 124, 18273 }, // Ĉ
-    { 14, 25, 16, 1, 24, 88, 18397 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 18485 }, // Ċ
-    { 14, 24, 16, 1, 23, 84, 18609 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 18693 }, // Č
-    { 14, 25, 16, 1, 24, 88, 18817 }, // č
-    { 21, 29, 23, 1, 28, 153, 18905 }, // Ď
-    { 20, 24, 22, 1, 23, 120, 19058 }, // ď
-    { 22, 22, 23, 0, 21, 121, 19178 }, // Đ
-    { 18, 24, 20, 1, 23, 108, 19299 }, // đ
-    { 17, 26, 19, 1, 26, 111, 19407 }, // Ē
-    { 14, 22, 16, 1, 21, 77, 19518 }, // ē
-    { 17, 28, 19, 1, 28, 119, 19595 }, // Ĕ
-    { 14, 24, 16, 1, 23, 84, 19714 }, // ĕ
-    { 17, 28, 19, 1, 28, 119, 19798 }, // Ė
-    { 14, 24, 16, 1, 23, 84, 19917 }, // ė
-    { 17, 28, 19, 1, 21, 119, 20001 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 20120 }, // ę
-    { 17, 28, 19, 1, 28, 119, 20201 }, // Ě
-    { 14, 25, 16, 1, 24, 88, 20320 }, // ě
-    { 20, 29, 22, 1, 28, 145, 20408 }, // Ĝ
-    { 18, 31, 19, 0, 24, 140, 20553 }, // ĝ
-    { 20, 29, 22, 1, 28, 145, 20693 }, // Ğ
-    { 18, 30, 19, 0, 23, 135, 20838 }, // ğ
-    { 20, 29, 22, 1, 28, 145, 20973 }, // Ġ
-    { 18, 30, 19, 0, 23, 135, 21118 }, // ġ
-    { 20, 29, 22, 1, 21, 145, 21253 }, // Ģ
-    { 18, 32, 19, 0, 25, 144, 21398 }, // ģ
-    { 23, 28, 25, 1, 28, 161, 21542 }, // Ĥ
-    { 20, 30, 20, -1, 30, 150, 21703 }, // ĥ
-    { 25, 21, 26, 0, 21, 132, 21853 }, // Ħ
-    { 19, 23, 20, 0, 23, 110, 21985 }, // ħ
-    { 11, 28, 13, 1, 28, 77, 22095 }, // Ĩ
-    { 11, 23, 12, 0, 23, 64, 22172 }, // ĩ
-    { 11, 26, 13, 1, 26, 72, 22236 }, // Ī
-    { 11, 21, 12, 0, 21, 58, 22308 }, // ī
-    { 11, 28, 13, 1, 28, 77, 22366 }, // Ĭ
-    { 11, 23, 12, 0, 23, 64, 22443 }, // ĭ
-    { 11, 28, 13, 1, 21, 77, 22507 }, // Į
-    { 11, 30, 12, 0, 23, 83, 22584 }, // į
-    { 11, 28, 13, 1, 28, 77, 22667 }, // İ
-    { 10, 16, 11, 0, 16, 40, 22744 }, // ı
-    { 23, 27, 25, 1, 21, 156, 22784 }, // Ĳ
-    { 18, 30, 19, 0, 23, 135, 22940 }, // ĳ
-    { 14, 34, 13, -2, 28, 119, 23075 }, // Ĵ
-    { 12, 31, 11, -2, 24, 93, 23194 }, // ĵ
-    { 21, 29, 23, 1, 21, 153, 23287 }, // Ķ
-    { 19, 31, 20, 0, 23, 148, 23440 }, // ķ
-    { 19, 17, 20, 0, 16, 81, 23588 }, // ĸ
-    { 17, 29, 19, 1, 29, 124, 23669 }, // Ĺ
-    { 10, 30, 11, 0, 30, 75, 23793 }, // ĺ
-    { 17, 29, 19, 1, 21, 124, 23868 }, // Ļ
-    { 10, 31, 11, 0, 23, 78, 23992 }, // ļ
-    { 17, 23, 19, 1, 23, 98, 24070 }, // Ľ
-    { 13, 23, 14, 0, 23, 75, 24168 }, // ľ
-    { 17, 21, 19, 1, 21, 90, 24243 }, // Ŀ
-    { 16, 23, 17, 0, 23, 92, 24333 }, // ŀ
-    { 19, 21, 19, -1, 21, 100, 24425 }, // Ł
-    { 12, 23, 12, -1, 23, 69, 24525 }, // ł
-    { 24, 30, 25, 0, 29, 180, 24594 }, // Ń
-    { 20, 25, 21, 0, 25, 125, 24774 }, // ń
-    { 24, 29, 25, 0, 21, 174, 24899 }, // Ņ
-    { 20, 24, 21, 0, 16, 120, 25073 }, // ņ
-    { 24, 29, 25, 0, 28, 174, 25193 }, // Ň
-    { 20, 24, 21, 0, 24, 120, 25367 }, // ň
-    { 26, 21, 27, 0, 21, 137, 25487 }, // ŉ
-    { 24, 27, 25, 0, 21, 162, 25624 }, // Ŋ
-    { 18, 23, 19, 0, 16, 104, 25786 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 25890 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 26032 }, // ō
-    { 21, 29, 23, 1, 28, 153, 26120 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 26273 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 26369 }, // Ő
-    { 16, 26, 18, 1, 25, 104, 26527 }, // ő
-    { 28, 22, 30, 1, 21, 154, 26631 }, // Œ
-    { 25, 17, 27, 1, 16, 107, 26785 }, // œ
-    { 21, 30, 23, 1, 29, 158, 26892 }, // Ŕ
-    { 14, 25, 15, 0, 25, 88, 27050 }, // ŕ
-    { 21, 29, 23, 1, 21, 153, 27138 }, // Ŗ
-    { 14, 24, 15, 0, 16, 84, 27291 }, // ŗ
-    { 21, 29, 23, 1, 28, 153, 27375 }, // Ř
-    { 14, 24, 15, 0, 24, 84, 27528 }, // ř
-    { 15, 30, 17, 1, 29, 113, 27612 }, // Ś
-    { 13, 26, 15, 1, 25, 85, 27725 }, // ś
-    { 15, 29, 17, 1, 28, 109, 27810 }, // Ŝ
-    { 13, 25, 15, 1, 24, 82, 27919 }, // ŝ
-    { 15, 29, 17, 1, 21, 109, 28001 }, // Ş
-    { 13, 24, 15, 1, 16, 78, 28110 }, // ş
-    { 15, 29, 17, 1, 28, 109, 28188 }, // Š
-    { 13, 25, 15, 1, 24, 82, 28297 }, // š
-    { 20, 29, 21, 0, 21, 145, 28379 }, // Ţ
-    { 13, 27, 13, -1, 19, 88, 28524 }, // ţ
-    { 20, 28, 21, 0, 28, 140, 28612 }, // Ť
-    { 13, 25, 13, -1, 24, 82, 28752 }, // ť
-    { 20, 21, 21, 0, 21, 105, 28834 }, // Ŧ
-    { 13, 20, 13, -1, 19, 65, 28939 }, // ŧ
-    { 23, 29, 24, 0, 28, 167, 29004 }, // Ũ
-    { 20, 24, 21, 0, 23, 120, 29171 }, // ũ
-    { 23, 27, 24, 0, 26, 156, 29291 }, // Ū
-    { 20, 22, 21, 0, 21, 110, 29447 }, // ū
-    { 23, 29, 24, 0, 28, 167, 29557 }, // Ŭ
-    { 20, 24, 21, 0, 23, 120, 29724 }, // ŭ
-    { 23, 30, 24, 0, 29, 173, 29844 }, // Ů
-    { 20, 26, 21, 0, 25, 130, 30017 }, // ů
-    { 23, 30, 24, 0, 29, 173, 30147 }, // Ű
-    { 20, 26, 21, 0, 25, 130, 30320 }, // ű
-    { 23, 28, 24, 0, 21, 161, 30450 }, // Ų
-    { 20, 23, 21, 0, 16, 115, 30611 }, // ų
-    { 32, 29, 33, 0, 28, 232, 30726 }, // Ŵ
-    { 26, 25, 27, 0, 24, 163, 30958 }, // ŵ
-    { 21, 28, 22, 0, 28, 147, 31121 }, // Ŷ
-    { 19, 31, 20, 0, 24, 148, 31268 }, // ŷ
-    { 21, 27, 22, 0, 27, 142, 31416 }, // Ÿ
-    { 17, 30, 18, 0, 29, 128, 31558 }, // Ź
-    { 15, 26, 16, 0, 25, 98, 31686 }, // ź
-    { 17, 29, 18, 0, 28, 124, 31784 }, // Ż
-    { 15, 24, 16, 0, 23, 90, 31908 }, // ż
-    { 17, 29, 18, 0, 28, 124, 31998 }, // Ž
-    { 15, 25, 16, 0, 24, 94, 32122 }, // ž
-    { 15, 23, 16, 0, 23, 87, 32216 }, // ſ
-    { 22, 25, 24, 1, 24, 138, 32303 }, // Ơ
-    { 17, 20, 19, 1, 19, 85, 32441 }, // ơ
-    { 21, 21, 22, 0, 21, 111, 32526 }, // Ƥ
-    { 18, 30, 19, 0, 23, 135, 32637 }, // ƥ
-    { 13, 26, 13, -1, 19, 85, 32772 }, // ƫ
-    { 20, 21, 21, 0, 21, 105, 32857 }, // Ƭ
-    { 15, 24, 15, -1, 23, 90, 32962 }, // ƭ
-    { 20, 27, 21, 0, 21, 135, 33052 }, // Ʈ
-    { 24, 25, 25, 0, 24, 150, 33187 }, // Ư
-    { 20, 20, 21, 0, 19, 100, 33337 }, // ư
-    { 7, 8, 3, -5, 25, 14, 33437 }, // ̀
-    { 6, 8, 5, -2, 25, 12, 33451 }, // ́
-    { 10, 7, 6, -5, 24, 18, 33463 }, // ̂
-    { 10, 5, 6, -5, 23, 13, 33481 }, // ̃
-    { 10, 3, 6, -5, 21, 8, 33494 }, // ̄
-    { 10, 6, 6, -5, 23, 15, 33502 }, // ̆
-    { 6, 5, 4, -3, 23, 8, 33517 }, // ̇
-    { 12, 5, 7, -6, 23, 15, 33525 }, // ̈
-    { 8, 9, 5, -4, 26, 18, 33540 }, // ̉
-    { 8, 9, 5, -4, 25, 18, 33558 }, // ̊
-    { 11, 8, 8, -4, 25, 22, 33576 }, // ̋
-    { 10, 7, 6, -5, 24, 18, 33598 }, // ̌
-    { 11, 8, 5, -7, 25, 22, 33616 }, // ̏
-    { 10, 6, 6, -5, 23, 15, 33638 }, // ̑
-    { 6, 8, 4, -3, 25, 12, 33653 }, // ̒
-    { 6, 9, 5, -2, 26, 14, 33665 }, // ̓
-    { 6, 9, 3, -4, 26, 14, 33679 }, // ̔
-    { 4, 8, 3, -2, 25, 8, 33693 }, // ̕
-    { 6, 8, 4, -3, 19, 12, 33701 }, // ̛
-    { 6, 5, 4, -3, -2, 8, 33713 }, // ̣
-    { 12, 5, 7, -6, -2, 15, 33721 }, // ̤
-    { 8, 7, 5, -4, -1, 14, 33736 }, // ̥
-    { 6, 7, 4, -3, -1, 11, 33750 }, // ̦
-    { 6, 7, 4, -3, -1, 11, 33761 }, // ̧
-    { 8, 8, 5, -4, 1, 16, 33772 }, // ̨
-    { 4, 8, 8, 2, -1, 8, 33788 }, // ̩
-    { 12, 7, 7, -6, -1, 21, 33796 }, // ̭
-    { 10, 6, 6, -5, -2, 15, 33817 }, // ̮
-    { 10, 6, 6, -5, -2, 15, 33832 }, // ̰
-    { 10, 3, 6, -5, -3, 8, 33847 }, // ̱
-    { 10, 6, 6, -5, 23, 15, 33855 }, // ͂
-    { 12, 12, 7, -6, 30, 36, 33870 }, // ̈́
-    { 6, 6, 5, -2, -2, 9, 33906 }, // ͅ
-    { 23, 21, 24, 0, 21, 121, 33915 }, // Α
-    { 17, 22, 19, 1, 21, 94, 34036 }, // Β
-    { 17, 21, 19, 1, 21, 90, 34130 }, // Γ
-    { 20, 21, 21, 0, 21, 105, 34220 }, // Δ
-    { 17, 21, 19, 1, 21, 90, 34325 }, // Ε
-    { 17, 22, 18, 0, 21, 94, 34415 }, // Ζ
-    { 23, 21, 25, 1, 21, 121, 34509 }, // Η
-    { 21, 22, 23, 1, 21, 116, 34630 }, // Θ
-    { 11, 21, 13, 1, 21, 58, 34746 }, // Ι
-    { 21, 22, 23, 1, 21, 116, 34804 }, // Κ
-    { 22, 21, 23, 0, 21, 116, 34920 }, // Λ
-    { 27, 21, 28, 0, 21, 142, 35036 }, // Μ
-    { 24, 22, 25, 0, 21, 132, 35178 }, // Ν
-    { 17, 21, 19, 1, 21, 90, 35310 }, // Ξ
-    { 21, 22, 23, 1, 21, 116, 35400 }, // Ο
-    { 23, 21, 25, 1, 21, 121, 35516 }, // Π
-    { 17, 21, 19, 1, 21, 90, 35637 }, // Ρ
-    { 18, 22, 19, 0, 21, 99, 35727 }, // Σ
-    { 20, 21, 21, 0, 21, 105, 35826 }, // Τ
-    { 21, 21, 22, 0, 21, 111, 35931 }, // Υ
-    { 22, 22, 24, 1, 21, 121, 36042 }, // Φ
-    { 22, 21, 23, 0, 21, 116, 36163 }, // Χ
-    { 25, 21, 26, 0, 21, 132, 36279 }, // Ψ
-    { 24, 21, 25, 0, 21, 126, 36411 }, // Ω
-    { 19, 17, 21, 1, 16, 81, 36537 }, // α
-    { 16, 30, 18, 1, 23, 120, 36618 }, // β
-    { 17, 23, 17, -1, 16, 98, 36738 }, // γ
-    { 16, 24, 18, 1, 23, 96, 36836 }, // δ
-    { 13, 17, 15, 1, 16, 56, 36932 }, // ε
-    { 13, 30, 15, 1, 24, 98, 36988 }, // ζ
-    { 18, 23, 18, -1, 16, 104, 37086 }, // η
-    { 17, 24, 18, 0, 23, 102, 37190 }, // θ
-    { 9, 17, 12, 2, 16, 39, 37292 }, // ι
-    { 16, 17, 19, 2, 16, 68, 37331 }, // κ
-    { 19, 24, 19, -1, 23, 114, 37399 }, // λ
-    { 19, 23, 21, 1, 16, 110, 37513 }, // μ
-    { 17, 17, 17, -1, 16, 73, 37623 }, // ν
-    { 13, 30, 15, 1, 24, 98, 37696 }, // ξ
-    { 16, 17, 18, 1, 16, 68, 37794 }, // ο
-    { 20, 17, 21, 0, 16, 85, 37862 }, // π
-    { 16, 23, 18, 1, 16, 92, 37947 }, // ρ
-    { 13, 22, 15, 1, 16, 72, 38039 }, // ς
-    { 18, 17, 20, 1, 16, 77, 38111 }, // σ
-    { 16, 17, 17, 0, 16, 68, 38188 }, // τ
-    { 18, 17, 18, -1, 16, 77, 38256 }, // υ
-    { 22, 28, 24, 1, 21, 154, 38333 }, // φ
-    { 18, 23, 18, -1, 16, 104, 38487 }, // χ
-    { 24, 28, 24, -1, 21, 168, 38591 }, // ψ
-    { 21, 17, 23, 1, 16, 90, 38759 }, // ω
-    { 23, 28, 24, 0, 21, 161, 38849 }, // Ạ
-    { 16, 23, 18, 1, 16, 92, 39010 }, // ạ
-    { 23, 30, 24, 0, 30, 173, 39102 }, // Ả
-    { 16, 27, 18, 1, 26, 108, 39275 }, // ả
-    { 23, 31, 24, 0, 31, 179, 39383 }, // Ấ
-    { 16, 30, 18, 1, 29, 120, 39562 }, // ấ
-    { 23, 31, 24, 0, 31, 179, 39682 }, // Ầ
-    { 16, 30, 18, 1, 29, 120, 39861 }, // ầ
-    { 23, 31, 24, 0, 31, 179, 39981 }, // Ẩ
-    { 16, 30, 18, 1, 29, 120, 40160 }, // ẩ
-    { 23, 31, 24, 0, 31, 179, 40280 }, // Ẫ
-    { 16, 29, 18, 1, 28, 116, 40459 }, // ẫ
-    { 23, 35, 24, 0, 28, 202, 40575 }, // Ậ
-    { 16, 31, 18, 1, 24, 124, 40777 }, // ậ
-    { 23, 31, 24, 0, 31, 179, 40901 }, // Ắ
-    { 16, 30, 18, 1, 29, 120, 41080 }, // ắ
-    { 23, 31, 24, 0, 31, 179, 41200 }, // Ằ
-    { 16, 30, 18, 1, 29, 120, 41379 }, // ằ
-    { 23, 31, 24, 0, 31, 179, 41499 }, // Ẳ
-    { 16, 30, 18, 1, 29, 120, 41678 }, // ẳ
-    { 23, 31, 24, 0, 31, 179, 41798 }, // Ẵ
-    { 16, 29, 18, 1, 28, 116, 41977 }, // ẵ
-    { 23, 35, 24, 0, 28, 202, 42093 }, // Ặ
-    { 16, 30, 18, 1, 23, 120, 42295 }, // ặ
-    { 17, 28, 19, 1, 21, 119, 42415 }, // Ẹ
-    { 14, 23, 16, 1, 16, 81, 42534 }, // ẹ
-    { 17, 30, 19, 1, 30, 128, 42615 }, // Ẻ
-    { 14, 27, 16, 1, 26, 95, 42743 }, // ẻ
-    { 17, 28, 19, 1, 28, 119, 42838 }, // Ẽ
-    { 14, 24, 16, 1, 23, 84, 42957 }, // ẽ
-    { 18, 31, 20, 1, 31, 140, 43041 }, // Ế
-    { 16, 30, 18, 1, 29, 120, 43181 }, // ế
-    { 17, 31, 19, 1, 31, 132, 43301 }, // Ề
-    { 14, 30, 16, 1, 29, 105, 43433 }, // ề
-    { 17, 31, 19, 1, 31, 132, 43538 }, // Ể
-    { 16, 30, 18, 1, 29, 120, 43670 }, // ể
-    { 17, 31, 19, 1, 31, 132, 43790 }, // Ễ
-    { 14, 29, 16, 1, 28, 102, 43922 }, // ễ
-    { 17, 35, 19, 1, 28, 149, 44024 }, // Ệ
-    { 14, 31, 16, 1, 24, 109, 44173 }, // ệ
-    { 11, 30, 13, 1, 30, 83, 44282 }, // Ỉ
-    { 10, 26, 11, 0, 26, 65, 44365 }, // ỉ
-    { 11, 28, 13, 1, 21, 77, 44430 }, // Ị
-    { 10, 30, 11, 0, 23, 75, 44507 }, // ị
-    { 21, 28, 23, 1, 21, 147, 44582 }, // Ọ
-    { 16, 23, 18, 1, 16, 92, 44729 }, // ọ
-    { 21, 31, 23, 1, 30, 163, 44821 }, // Ỏ
-    { 16, 27, 18, 1, 26, 108, 44984 }, // ỏ
-    { 21, 32, 23, 1, 31, 168, 45092 }, // Ố
-    { 16, 30, 18, 1, 29, 120, 45260 }, // ố
-    { 21, 32, 23, 1, 31, 168, 45380 }, // Ồ
-    { 16, 30, 18, 1, 29, 120, 45548 }, // ồ
-    { 21, 32, 23, 1, 31, 168, 45668 }, // Ổ
-    { 17, 30, 19, 1, 29, 128, 45836 }, // ổ
-    { 21, 32, 23, 1, 31, 168, 45964 }, // Ỗ
-    { 16, 29, 18, 1, 28, 116, 46132 }, // ỗ
-    { 21, 35, 23, 1, 28, 184, 46248 }, // Ộ
-    { 16, 31, 18, 1, 24, 124, 46432 }, // ộ
-    { 22, 30, 24, 1, 29, 165, 46556 }, // Ớ
-    { 17, 26, 19, 1, 25, 111, 46721 }, // ớ
-    { 22, 30, 24, 1, 29, 165, 46832 }, // Ờ
-    { 17, 26, 19, 1, 25, 111, 46997 }, // ờ
-    { 22, 31, 24, 1, 30, 171, 47108 }, // Ở
-    { 17, 27, 19, 1, 26, 115, 47279 }, // ở
-    { 22, 29, 24, 1, 28, 160, 47394 }, // Ỡ
-    { 17, 24, 19, 1, 23, 102, 47554 }, // ỡ
-    { 22, 31, 24, 1, 24, 171, 47656 }, // Ợ
-    { 17, 26, 19, 1, 19, 111, 47827 }, // ợ
-    { 23, 28, 24, 0, 21, 161, 47938 }, // Ụ
-    { 20, 23, 21, 0, 16, 115, 48099 }, // ụ
-    { 23, 31, 24, 0, 30, 179, 48214 }, // Ủ
-    { 20, 27, 21, 0, 26, 135, 48393 }, // ủ
-    { 24, 30, 25, 0, 29, 180, 48528 }, // Ứ
-    { 20, 26, 21, 0, 25, 130, 48708 }, // ứ
-    { 24, 30, 25, 0, 29, 180, 48838 }, // Ừ
-    { 20, 26, 21, 0, 25, 130, 49018 }, // ừ
-    { 24, 31, 25, 0, 30, 186, 49148 }, // Ử
-    { 20, 27, 21, 0, 26, 135, 49334 }, // ử
-    { 24, 29, 25, 0, 28, 174, 49469 }, // Ữ
-    { 20, 24, 21, 0, 23, 120, 49643 }, // ữ
-    { 24, 31, 25, 0, 24, 186, 49763 }, // Ự
-    { 20, 26, 21, 0, 19, 130, 49949 }, // ự
-    { 21, 29, 22, 0, 29, 153, 50079 }, // Ỳ
-    { 19, 32, 20, 0, 25, 152, 50232 }, // ỳ
-    { 21, 28, 22, 0, 21, 147, 50384 }, // Ỵ
-    { 19, 23, 20, 0, 16, 110, 50531 }, // ỵ
-    { 21, 30, 22, 0, 30, 158, 50641 }, // Ỷ
-    { 19, 33, 20, 0, 26, 157, 50799 }, // ỷ
-    { 21, 28, 22, 0, 28, 147, 50956 }, // Ỹ
-    { 19, 30, 20, 0, 23, 143, 51103 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 51246 }, //  
-    { 0, 0, 29, 0, 0, 0, 51246 }, //  
-    { 0, 0, 15, 0, 0, 0, 51246 }, //  
-    { 0, 0, 29, 0, 0, 0, 51246 }, //  
-    { 0, 0, 10, 0, 0, 0, 51246 }, //  
-    { 0, 0, 7, 0, 0, 0, 51246 }, //  
-    { 0, 0, 5, 0, 0, 0, 51246 }, //  
-    { 0, 0, 18, 0, 0, 0, 51246 }, //  
-    { 0, 0, 8, 0, 0, 0, 51246 }, //  
-    { 0, 0, 6, 0, 0, 0, 51246 }, //  
-    { 0, 0, 1, 0, 0, 0, 51246 }, //  
-    { 0, 0, 1, 0, 0, 0, 51246 }, // ​
-    { 2, 24, 2, -1, 17, 12, 51246 }, // ‌
-    { 6, 26, 4, -3, 19, 39, 51258 }, // ‍
-    { 10, 28, 6, -5, 21, 70, 51297 }, // ‎
-    { 10, 28, 6, -5, 21, 70, 51367 }, // ‏
-    { 9, 5, 11, 1, 10, 12, 51437 }, // ‐
-    { 9, 5, 11, 1, 10, 12, 51449 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 51461 }, // ‒
-    { 15, 3, 16, 0, 9, 12, 51472 }, // –
-    { 29, 3, 30, 0, 9, 22, 51484 }, // —
-    { 29, 3, 30, 0, 9, 22, 51506 }, // ―
-    { 11, 30, 15, 2, 23, 83, 51528 }, // ‖
-    { 15, 8, 16, 0, -1, 30, 51611 }, // ‗
-    { 6, 10, 8, 1, 22, 15, 51641 }, // ‘
-    { 7, 10, 8, 0, 22, 18, 51656 }, // ’
-    { 7, 10, 8, 0, 4, 18, 51674 }, // ‚
-    { 6, 10, 8, 1, 22, 15, 51692 }, // ‛
-    { 12, 10, 14, 1, 22, 30, 51707 }, // “
-    { 12, 10, 13, 0, 22, 30, 51737 }, // ”
-    { 12, 10, 13, 0, 4, 30, 51767 }, // „
-    { 12, 10, 14, 1, 22, 30, 51797 }, // ‟
-    { 14, 19, 15, 0, 21, 67, 51827 }, // †
-    { 14, 23, 15, 0, 21, 81, 51894 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 51975 }, // •
-    { 10, 10, 18, 4, 15, 25, 51988 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 52013 }, // ․
-    { 13, 6, 15, 1, 5, 20, 52022 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 52042 }, // …
-    { 6, 6, 8, 1, 11, 9, 52080 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 52089 }, //  
-    { 0, 0, 1, 0, 0, 0, 52089 }, //  
-    { 10, 28, 6, -5, 21, 70, 52089 }, // ‪
-    { 10, 28, 6, -5, 21, 70, 52159 }, // ‫
-    { 10, 27, 6, -5, 20, 68, 52229 }, // ‬
-    { 12, 28, 7, -6, 21, 84, 52297 }, // ‭
-    { 12, 28, 7, -6, 21, 84, 52381 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 52465 }, //  
-    { 39, 24, 41, 1, 22, 234, 52465 }, // ‰
-    { 8, 11, 9, 0, 21, 22, 52699 }, // ′
-    { 14, 11, 15, 0, 21, 39, 52721 }, // ″
-    { 20, 11, 21, 0, 21, 55, 52760 }, // ‴
-    { 8, 11, 9, 0, 21, 22, 52815 }, // ‵
-    { 13, 11, 15, 1, 21, 36, 52837 }, // ‶
-    { 19, 11, 21, 1, 21, 53, 52873 }, // ‷
-    { 13, 6, 15, 1, 0, 20, 52926 }, // ‸
-    { 9, 12, 10, 0, 13, 27, 52946 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 52973 }, // ›
-    { 18, 20, 19, 0, 19, 90, 52997 }, // ※
-    { 14, 23, 17, 2, 22, 81, 53087 }, // ‼
-    { 15, 4, 16, 0, 25, 15, 53168 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 53183 }, // ⁃
-    { 15, 25, 11, -5, 22, 94, 53192 }, // ⁄
-    { 25, 23, 27, 1, 22, 144, 53286 }, // ⁇
-    { 21, 23, 23, 1, 22, 121, 53430 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 53551 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 53661 }, // ⁓
-    { 27, 11, 28, 0, 21, 75, 53691 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 53766 }, //  
-    { 0, 0, 1, 0, 0, 0, 53766 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 53766 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 53766 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 53766 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 53766 }, // ⁤
-    { 13, 14, 14, 0, 24, 46, 53766 }, // ⁰
-    { 13, 14, 14, 0, 24, 46, 53812 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 53858 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 53897 }, // ⁶
-    { 11, 14, 13, 1, 24, 39, 53936 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 53975 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 54014 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 54053 }, // ⁿ
-    { 13, 15, 14, 0, 10, 49, 54089 }, // ₀
-    { 10, 14, 13, 1, 10, 35, 54138 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 54173 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 54212 }, // ₃
-    { 13, 15, 14, 0, 10, 49, 54254 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 54303 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 54342 }, // ₆
-    { 11, 14, 13, 1, 9, 39, 54384 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 54423 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 54465 }, // ₉
-    { 16, 20, 18, 1, 20, 80, 54507 }, // ₣
-    { 18, 22, 19, 0, 21, 99, 54587 }, // ₤
-    { 39, 22, 40, 0, 21, 215, 54686 }, // ₧
-    { 18, 22, 19, 0, 21, 99, 54901 }, // €
-    { 19, 14, 29, 5, 17, 67, 55000 }, // ←
-    { 13, 20, 29, 8, 20, 65, 55067 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 55132 }, // →
-    { 13, 20, 29, 8, 20, 65, 55199 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 55264 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 55331 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 55396 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 55471 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 55536 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 55601 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 55669 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 55745 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 55822 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 55898 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 55975 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 56051 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 56167 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 56263 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 56342 }, // ∅
-    { 20, 21, 21, 0, 21, 105, 56480 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 56585 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 56690 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 56801 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 56938 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 57033 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 57144 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 57281 }, // ∍
-    { 23, 26, 25, 1, 21, 150, 57376 }, // ∏
-    { 19, 26, 20, 0, 21, 124, 57526 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 57650 }, // −
-    { 15, 23, 16, 0, 21, 87, 57664 }, // ∕
-    { 15, 23, 16, 0, 21, 87, 57751 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 57838 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 57887 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 57920 }, // ∙
-    { 19, 28, 19, -1, 24, 133, 57929 }, // √
-    { 14, 12, 18, 2, 15, 42, 58062 }, // ∝
-    { 18, 11, 19, 0, 15, 50, 58104 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 58154 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 58254 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 58375 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 58413 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 58496 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 58607 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 58718 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 58808 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 58902 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 59022 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 59108 }, // ∵
-    { 7, 16, 9, 1, 18, 28, 59194 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 59222 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 59308 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 59338 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 59411 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 59453 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 59504 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 59557 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 59621 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 59684 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 59747 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 59835 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 59923 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 60018 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 60155 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 60292 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 60392 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 60492 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 60608 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 60724 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 60840 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 60956 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 61046 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 61055 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 61093 }, // �
+    { 6, 23, 9, 2, 22, 33, 0 }, // !
+    { 10, 10, 12, 1, 21, 28, 33 }, // "
+    { 18, 19, 19, 0, 17, 65, 61 }, // #
+    { 15, 30, 18, 2, 24, 82, 126 }, // $
+    { 26, 24, 28, 1, 22, 117, 208 }, // %
+    { 23, 23, 24, 0, 22, 92, 325 }, // &
+    { 5, 10, 7, 1, 21, 16, 417 }, // '
+    { 10, 29, 12, 1, 24, 43, 433 }, // (
+    { 10, 29, 11, 0, 24, 46, 476 }, // )
+    { 11, 11, 12, 0, 22, 31, 522 }, // *
+    { 14, 14, 18, 2, 17, 37, 553 }, // +
+    { 8, 11, 9, 0, 5, 15, 590 }, // ,
+    { 9, 5, 11, 1, 10, 7, 605 }, // -
+    { 6, 6, 8, 1, 5, 9, 612 }, // .
+    { 15, 23, 16, 0, 21, 48, 621 }, // /
+    { 18, 22, 19, 0, 21, 64, 669 }, // 0
+    { 14, 21, 18, 2, 21, 44, 733 }, // 1
+    { 16, 21, 18, 1, 21, 58, 777 }, // 2
+    { 15, 22, 18, 1, 21, 56, 835 }, // 3
+    { 18, 22, 19, 0, 21, 59, 891 }, // 4
+    { 15, 21, 18, 1, 20, 55, 950 }, // 5
+    { 16, 22, 18, 1, 21, 59, 1005 }, // 6
+    { 15, 21, 18, 2, 20, 51, 1064 }, // 7
+    { 16, 22, 18, 1, 21, 65, 1115 }, // 8
+    { 16, 22, 18, 1, 21, 61, 1180 }, // 9
+    { 6, 17, 8, 1, 16, 19, 1241 }, // :
+    { 8, 22, 9, 0, 16, 27, 1260 }, // ;
+    { 14, 14, 18, 2, 17, 32, 1287 }, // <
+    { 14, 9, 18, 2, 14, 28, 1319 }, // =
+    { 14, 14, 18, 2, 17, 32, 1347 }, // >
+    { 12, 23, 14, 1, 22, 46, 1379 }, // ?
+    { 27, 27, 29, 1, 21, 128, 1425 }, // @
+    { 23, 21, 24, 0, 21, 77, 1553 }, // A
+    { 17, 22, 19, 1, 21, 68, 1630 }, // B
+    { 17, 22, 19, 1, 21, 64, 1698 }, // C
+    { 21, 22, 23, 1, 21, 82, 1762 }, // D
+    { 17, 21, 19, 1, 21, 68, 1844 }, // E
+    { 16, 21, 18, 1, 21, 56, 1912 }, // F
+    { 20, 22, 22, 1, 21, 76, 1968 }, // G
+    { 23, 21, 25, 1, 21, 89, 2044 }, // H
+    { 11, 21, 13, 1, 21, 43, 2133 }, // I
+    { 14, 27, 13, -2, 21, 54, 2176 }, // J
+    { 21, 22, 23, 1, 21, 79, 2230 }, // K
+    { 17, 21, 19, 1, 21, 57, 2309 }, // L
+    { 27, 21, 28, 0, 21, 100, 2366 }, // M
+    { 24, 22, 25, 0, 21, 89, 2466 }, // N
+    { 21, 22, 23, 1, 21, 81, 2555 }, // O
+    { 17, 21, 19, 1, 21, 62, 2636 }, // P
+    { 22, 28, 24, 1, 21, 100, 2698 }, // Q
+    { 21, 22, 23, 1, 21, 79, 2798 }, // R
+    { 15, 22, 17, 1, 21, 66, 2877 }, // S
+    { 20, 21, 21, 0, 21, 60, 2943 }, // T
+    { 23, 22, 24, 0, 21, 69, 3003 }, // U
+    { 23, 22, 24, 0, 21, 71, 3072 }, // V
+    { 32, 22, 33, 0, 21, 111, 3143 }, // W
+    { 22, 21, 23, 0, 21, 73, 3254 }, // X
+    { 21, 21, 22, 0, 21, 61, 3327 }, // Y
+    { 17, 22, 18, 0, 21, 63, 3388 }, // Z
+    { 8, 28, 10, 1, 23, 47, 3451 }, // [
+    { 15, 23, 16, 0, 21, 46, 3498 }, // <backslash>
+    { 7, 28, 10, 1, 23, 45, 3544 }, // ]
+    { 16, 14, 18, 1, 19, 41, 3589 }, // ^
+    { 15, 4, 16, 0, -1, 14, 3630 }, // _
+    { 7, 8, 20, 6, 25, 10, 3644 }, // `
+    { 16, 17, 18, 1, 16, 55, 3654 }, // a
+    { 18, 24, 18, -1, 23, 72, 3709 }, // b
+    { 14, 17, 16, 1, 16, 44, 3781 }, // c
+    { 18, 24, 20, 1, 23, 75, 3825 }, // d
+    { 14, 17, 16, 1, 16, 49, 3900 }, // e
+    { 16, 23, 17, 0, 23, 57, 3949 }, // f
+    { 18, 23, 19, 0, 16, 77, 4006 }, // g
+    { 19, 23, 20, 0, 23, 77, 4083 }, // h
+    { 10, 23, 11, 0, 23, 40, 4160 }, // i
+    { 10, 30, 9, -2, 23, 50, 4200 }, // j
+    { 19, 24, 20, 0, 23, 70, 4250 }, // k
+    { 10, 23, 11, 0, 23, 40, 4320 }, // l
+    { 29, 16, 30, 0, 16, 80, 4360 }, // m
+    { 20, 16, 21, 0, 16, 55, 4440 }, // n
+    { 16, 17, 18, 1, 16, 52, 4495 }, // o
+    { 18, 23, 19, 0, 16, 75, 4547 }, // p
+    { 17, 23, 19, 1, 16, 72, 4622 }, // q
+    { 14, 16, 15, 0, 16, 41, 4694 }, // r
+    { 13, 17, 15, 1, 16, 45, 4735 }, // s
+    { 13, 20, 13, -1, 19, 42, 4780 }, // t
+    { 20, 17, 21, 0, 16, 58, 4822 }, // u
+    { 19, 17, 20, 0, 16, 48, 4880 }, // v
+    { 26, 17, 27, 0, 16, 78, 4928 }, // w
+    { 18, 16, 19, 0, 16, 51, 5006 }, // x
+    { 19, 23, 20, 0, 16, 68, 5057 }, // y
+    { 15, 17, 16, 0, 16, 47, 5125 }, // z
+    { 10, 29, 12, 1, 24, 46, 5172 }, // {
+    { 5, 27, 9, 2, 23, 40, 5218 }, // |
+    { 10, 29, 12, 0, 24, 45, 5258 }, // }
+    { 14, 7, 18, 2, 13, 20, 5303 }, // ~
+    { 0, 0, 6, 0, 0, 0, 5323 }, //  
+    { 6, 23, 8, 1, 16, 37, 5323 }, // ¡
+    { 16, 29, 18, 1, 23, 78, 5360 }, // ¢
+    { 18, 22, 19, 0, 21, 58, 5438 }, // £
+    { 16, 14, 18, 1, 17, 50, 5496 }, // ¤
+    { 20, 20, 20, -1, 20, 68, 5546 }, // ¥
+    { 5, 27, 9, 2, 23, 35, 5614 }, // ¦
+    { 13, 23, 15, 1, 20, 66, 5649 }, // §
+    { 12, 5, 20, 4, 23, 14, 5715 }, // ¨
+    { 22, 22, 23, 0, 21, 100, 5729 }, // ©
+    { 11, 15, 13, 1, 21, 41, 5829 }, // ª
+    { 16, 12, 17, 0, 13, 37, 5870 }, // «
+    { 14, 8, 18, 2, 14, 29, 5907 }, // ¬
+    { 9, 5, 11, 1, 10, 7, 5936 }, // ­
+    { 17, 16, 18, 0, 23, 71, 5943 }, // ®
+    { 11, 3, 20, 4, 21, 8, 6014 }, // ¯
+    { 11, 12, 15, 2, 21, 27, 6022 }, // °
+    { 14, 18, 18, 2, 17, 49, 6049 }, // ±
+    { 11, 14, 13, 1, 24, 32, 6098 }, // ²
+    { 11, 14, 13, 1, 24, 30, 6130 }, // ³
+    { 6, 8, 20, 7, 25, 12, 6160 }, // ´
+    { 19, 23, 21, 1, 16, 71, 6172 }, // µ
+    { 17, 26, 18, 0, 21, 76, 6243 }, // ¶
+    { 6, 6, 8, 1, 11, 8, 6319 }, // ·
+    { 6, 7, 20, 7, -1, 13, 6327 }, // ¸
+    { 10, 14, 13, 1, 24, 24, 6340 }, // ¹
+    { 11, 15, 13, 1, 21, 38, 6364 }, // º
+    { 16, 12, 18, 1, 13, 38, 6402 }, // »
+    { 30, 25, 32, 1, 22, 118, 6440 }, // ¼
+    { 30, 25, 32, 1, 22, 106, 6558 }, // ½
+    { 30, 25, 32, 1, 22, 121, 6664 }, // ¾
+    { 12, 23, 14, 1, 16, 47, 6785 }, // ¿
+    { 23, 29, 24, 0, 29, 95, 6832 }, // À
+    { 23, 29, 24, 0, 29, 95, 6927 }, // Á
+    { 23, 28, 24, 0, 28, 96, 7022 }, // Â
+    { 23, 28, 24, 0, 28, 96, 7118 }, // Ã
+    { 23, 27, 24, 0, 27, 97, 7214 }, // Ä
+    { 23, 29, 24, 0, 29, 103, 7311 }, // Å
+    { 29, 21, 29, -1, 21, 98, 7414 }, // Æ
+    { 17, 29, 19, 1, 21, 80, 7512 }, // Ç
+    { 17, 29, 19, 1, 29, 82, 7592 }, // È
+    { 17, 29, 19, 1, 29, 84, 7674 }, // É
+    { 17, 28, 19, 1, 28, 86, 7758 }, // Ê
+    { 17, 27, 19, 1, 27, 85, 7844 }, // Ë
+    { 11, 29, 13, 1, 29, 56, 7929 }, // Ì
+    { 11, 29, 13, 1, 29, 56, 7985 }, // Í
+    { 12, 28, 13, 0, 28, 59, 8041 }, // Î
+    { 12, 27, 13, 0, 27, 59, 8100 }, // Ï
+    { 22, 22, 23, 0, 21, 83, 8159 }, // Ð
+    { 24, 29, 25, 0, 28, 109, 8242 }, // Ñ
+    { 21, 30, 23, 1, 29, 99, 8351 }, // Ò
+    { 21, 30, 23, 1, 29, 99, 8450 }, // Ó
+    { 21, 29, 23, 1, 28, 103, 8549 }, // Ô
+    { 21, 29, 23, 1, 28, 100, 8652 }, // Õ
+    { 21, 28, 23, 1, 27, 101, 8752 }, // Ö
+    { 13, 13, 18, 3, 16, 35, 8853 }, // ×
+    { 23, 22, 24, 0, 21, 97, 8888 }, // Ø
+    { 23, 30, 24, 0, 29, 89, 8985 }, // Ù
+    { 23, 30, 24, 0, 29, 88, 9074 }, // Ú
+    { 23, 29, 24, 0, 28, 89, 9162 }, // Û
+    { 23, 28, 24, 0, 27, 89, 9251 }, // Ü
+    { 21, 29, 22, 0, 29, 79, 9340 }, // Ý
+    { 17, 21, 19, 1, 21, 61, 9419 }, // Þ
+    { 19, 24, 20, 0, 23, 83, 9480 }, // ß
+    { 16, 26, 18, 1, 25, 72, 9563 }, // à
+    { 16, 26, 18, 1, 25, 72, 9635 }, // á
+    { 16, 25, 18, 1, 24, 74, 9707 }, // â
+    { 16, 24, 18, 1, 23, 75, 9781 }, // ã
+    { 16, 24, 18, 1, 23, 72, 9856 }, // ä
+    { 16, 26, 18, 1, 25, 77, 9928 }, // å
+    { 22, 17, 24, 1, 16, 79, 10005 }, // æ
+    { 14, 24, 16, 1, 16, 60, 10084 }, // ç
+    { 14, 26, 16, 1, 25, 64, 10144 }, // è
+    { 14, 26, 16, 1, 25, 62, 10208 }, // é
+    { 14, 25, 16, 1, 24, 68, 10270 }, // ê
+    { 14, 24, 16, 1, 23, 65, 10338 }, // ë
+    { 10, 25, 11, 0, 25, 41, 10403 }, // ì
+    { 10, 25, 11, 0, 25, 39, 10444 }, // í
+    { 11, 24, 12, 0, 24, 48, 10483 }, // î
+    { 11, 23, 12, 0, 23, 44, 10531 }, // ï
+    { 16, 25, 18, 1, 24, 72, 10575 }, // ð
+    { 20, 23, 21, 0, 23, 78, 10647 }, // ñ
+    { 16, 26, 18, 1, 25, 67, 10725 }, // ò
+    { 16, 26, 18, 1, 25, 68, 10792 }, // ó
+    { 16, 25, 18, 1, 24, 70, 10860 }, // ô
+    { 16, 24, 18, 1, 23, 70, 10930 }, // õ
+    { 16, 24, 18, 1, 23, 69, 11000 }, // ö
+    { 14, 14, 18, 2, 17, 30, 11069 }, // ÷
+    { 17, 17, 18, 0, 16, 64, 11099 }, // ø
+    { 20, 26, 21, 0, 25, 76, 11163 }, // ù
+    { 20, 26, 21, 0, 25, 74, 11239 }, // ú
+    { 20, 25, 21, 0, 24, 80, 11313 }, // û
+    { 20, 24, 21, 0, 23, 77, 11393 }, // ü
+    { 19, 32, 20, 0, 25, 86, 11470 }, // ý
+    { 18, 30, 19, 0, 23, 89, 11556 }, // þ
+    { 19, 30, 20, 0, 23, 86, 11645 }, // ÿ
+    { 23, 26, 24, 0, 26, 88, 11731 }, // Ā
+    { 16, 22, 18, 1, 21, 65, 11819 }, // ā
+    { 23, 28, 24, 0, 28, 96, 11884 }, // Ă
+    { 16, 24, 18, 1, 23, 73, 11980 }, // ă
+    { 23, 28, 24, 0, 21, 94, 12053 }, // Ą
+    { 16, 23, 18, 1, 16, 66, 12147 }, // ą
+    { 17, 30, 19, 1, 29, 80, 12213 }, // Ć
+    { 14, 26, 16, 1, 25, 58, 12293 }, // ć
+    { 17, 29, 19, 1, 28, 81, 12351 }, // Ĉ
+    { 14, 25, 16, 1, 24, 63, 12432 }, // ĉ
+    { 17, 29, 19, 1, 28, 76, 12495 }, // Ċ
+    { 14, 24, 16, 1, 23, 57, 12571 }, // ċ
+    { 17, 29, 19, 1, 28, 81, 12628 }, // Č
+    { 14, 25, 16, 1, 24, 63, 12709 }, // č
+    { 21, 29, 23, 1, 28, 100, 12772 }, // Ď
+    { 20, 24, 22, 1, 23, 86, 12872 }, // ď
+    { 22, 22, 23, 0, 21, 83, 12958 }, // Đ
+    { 18, 24, 20, 1, 23, 73, 13041 }, // đ
+    { 17, 26, 19, 1, 26, 76, 13114 }, // Ē
+    { 14, 22, 16, 1, 21, 58, 13190 }, // ē
+    { 17, 28, 19, 1, 28, 84, 13248 }, // Ĕ
+    { 14, 24, 16, 1, 23, 64, 13332 }, // ĕ
+    { 17, 28, 19, 1, 28, 81, 13396 }, // Ė
+    { 14, 24, 16, 1, 23, 61, 13477 }, // ė
+    { 17, 28, 19, 1, 21, 83, 13538 }, // Ę
+    { 14, 23, 16, 1, 16, 58, 13621 }, // ę
+    { 17, 28, 19, 1, 28, 86, 13679 }, // Ě
+    { 14, 25, 16, 1, 24, 68, 13765 }, // ě
+    { 20, 29, 22, 1, 28, 95, 13833 }, // Ĝ
+    { 18, 31, 19, 0, 24, 99, 13928 }, // ĝ
+    { 20, 29, 22, 1, 28, 95, 14027 }, // Ğ
+    { 18, 30, 19, 0, 23, 94, 14122 }, // ğ
+    { 20, 29, 22, 1, 28, 91, 14216 }, // Ġ
+    { 18, 30, 19, 0, 23, 91, 14307 }, // ġ
+    { 20, 29, 22, 1, 21, 92, 14398 }, // Ģ
+    { 18, 32, 19, 0, 25, 94, 14490 }, // ģ
+    { 23, 28, 25, 1, 28, 111, 14584 }, // Ĥ
+    { 20, 30, 20, -1, 30, 95, 14695 }, // ĥ
+    { 25, 21, 26, 0, 21, 102, 14790 }, // Ħ
+    { 19, 23, 20, 0, 23, 77, 14892 }, // ħ
+    { 11, 28, 13, 1, 28, 58, 14969 }, // Ĩ
+    { 11, 23, 12, 0, 23, 47, 15027 }, // ĩ
+    { 11, 26, 13, 1, 26, 52, 15074 }, // Ī
+    { 11, 21, 12, 0, 21, 38, 15126 }, // ī
+    { 11, 28, 13, 1, 28, 60, 15164 }, // Ĭ
+    { 11, 23, 12, 0, 23, 43, 15224 }, // ĭ
+    { 11, 28, 13, 1, 21, 55, 15267 }, // Į
+    { 11, 30, 12, 0, 23, 51, 15322 }, // į
+    { 11, 28, 13, 1, 28, 52, 15373 }, // İ
+    { 10, 16, 11, 0, 16, 29, 15425 }, // ı
+    { 23, 27, 25, 1, 21, 98, 15454 }, // Ĳ
+    { 18, 30, 19, 0, 23, 92, 15552 }, // ĳ
+    { 14, 34, 13, -2, 28, 70, 15644 }, // Ĵ
+    { 12, 31, 11, -2, 24, 59, 15714 }, // ĵ
+    { 21, 29, 23, 1, 21, 96, 15773 }, // Ķ
+    { 19, 31, 20, 0, 23, 84, 15869 }, // ķ
+    { 19, 17, 20, 0, 16, 57, 15953 }, // ĸ
+    { 17, 29, 19, 1, 29, 73, 16010 }, // Ĺ
+    { 10, 30, 11, 0, 30, 52, 16083 }, // ĺ
+    { 17, 29, 19, 1, 21, 73, 16135 }, // Ļ
+    { 10, 31, 11, 0, 23, 51, 16208 }, // ļ
+    { 17, 23, 19, 1, 23, 66, 16259 }, // Ľ
+    { 13, 23, 14, 0, 23, 53, 16325 }, // ľ
+    { 17, 21, 19, 1, 21, 64, 16378 }, // Ŀ
+    { 16, 23, 17, 0, 23, 56, 16442 }, // ŀ
+    { 19, 21, 19, -1, 21, 65, 16498 }, // Ł
+    { 12, 23, 12, -1, 23, 45, 16563 }, // ł
+    { 24, 30, 25, 0, 29, 109, 16608 }, // Ń
+    { 20, 25, 21, 0, 25, 72, 16717 }, // ń
+    { 24, 29, 25, 0, 21, 107, 16789 }, // Ņ
+    { 20, 24, 21, 0, 16, 71, 16896 }, // ņ
+    { 24, 29, 25, 0, 28, 110, 16967 }, // Ň
+    { 20, 24, 21, 0, 24, 78, 17077 }, // ň
+    { 26, 21, 27, 0, 21, 79, 17155 }, // ŉ
+    { 24, 27, 25, 0, 21, 103, 17234 }, // Ŋ
+    { 18, 23, 19, 0, 16, 72, 17337 }, // ŋ
+    { 21, 27, 23, 1, 26, 92, 17409 }, // Ō
+    { 16, 22, 18, 1, 21, 62, 17501 }, // ō
+    { 21, 29, 23, 1, 28, 101, 17563 }, // Ŏ
+    { 16, 24, 18, 1, 23, 68, 17664 }, // ŏ
+    { 21, 30, 23, 1, 29, 107, 17732 }, // Ő
+    { 16, 26, 18, 1, 25, 76, 17839 }, // ő
+    { 28, 22, 30, 1, 21, 99, 17915 }, // Œ
+    { 25, 17, 27, 1, 16, 81, 18014 }, // œ
+    { 21, 30, 23, 1, 29, 96, 18095 }, // Ŕ
+    { 14, 25, 15, 0, 25, 57, 18191 }, // ŕ
+    { 21, 29, 23, 1, 21, 97, 18248 }, // Ŗ
+    { 14, 24, 15, 0, 16, 56, 18345 }, // ŗ
+    { 21, 29, 23, 1, 28, 98, 18401 }, // Ř
+    { 14, 24, 15, 0, 24, 59, 18499 }, // ř
+    { 15, 30, 17, 1, 29, 81, 18558 }, // Ś
+    { 13, 26, 15, 1, 25, 57, 18639 }, // ś
+    { 15, 29, 17, 1, 28, 81, 18696 }, // Ŝ
+    { 13, 25, 15, 1, 24, 63, 18777 }, // ŝ
+    { 15, 29, 17, 1, 21, 82, 18840 }, // Ş
+    { 13, 24, 15, 1, 16, 60, 18922 }, // ş
+    { 15, 29, 17, 1, 28, 84, 18982 }, // Š
+    { 13, 25, 15, 1, 24, 62, 19066 }, // š
+    { 20, 29, 21, 0, 21, 77, 19128 }, // Ţ
+    { 13, 27, 13, -1, 19, 56, 19205 }, // ţ
+    { 20, 28, 21, 0, 28, 80, 19261 }, // Ť
+    { 13, 25, 13, -1, 24, 55, 19341 }, // ť
+    { 20, 21, 21, 0, 21, 62, 19396 }, // Ŧ
+    { 13, 20, 13, -1, 19, 48, 19458 }, // ŧ
+    { 23, 29, 24, 0, 28, 90, 19506 }, // Ũ
+    { 20, 24, 21, 0, 23, 78, 19596 }, // ũ
+    { 23, 27, 24, 0, 26, 81, 19674 }, // Ū
+    { 20, 22, 21, 0, 21, 70, 19755 }, // ū
+    { 23, 29, 24, 0, 28, 89, 19825 }, // Ŭ
+    { 20, 24, 21, 0, 23, 76, 19914 }, // ŭ
+    { 23, 30, 24, 0, 29, 95, 19990 }, // Ů
+    { 20, 26, 21, 0, 25, 83, 20085 }, // ů
+    { 23, 30, 24, 0, 29, 95, 20168 }, // Ű
+    { 20, 26, 21, 0, 25, 84, 20263 }, // ű
+    { 23, 28, 24, 0, 21, 85, 20347 }, // Ų
+    { 20, 23, 21, 0, 16, 69, 20432 }, // ų
+    { 32, 29, 33, 0, 28, 134, 20501 }, // Ŵ
+    { 26, 25, 27, 0, 24, 104, 20635 }, // ŵ
+    { 21, 28, 22, 0, 28, 82, 20739 }, // Ŷ
+    { 19, 31, 20, 0, 24, 90, 20821 }, // ŷ
+    { 21, 27, 22, 0, 27, 81, 20911 }, // Ÿ
+    { 17, 30, 18, 0, 29, 79, 20992 }, // Ź
+    { 15, 26, 16, 0, 25, 61, 21071 }, // ź
+    { 17, 29, 18, 0, 28, 75, 21132 }, // Ż
+    { 15, 24, 16, 0, 23, 60, 21207 }, // ż
+    { 17, 29, 18, 0, 28, 82, 21267 }, // Ž
+    { 15, 25, 16, 0, 24, 65, 21349 }, // ž
+    { 15, 23, 16, 0, 23, 54, 21414 }, // ſ
+    { 22, 25, 24, 1, 24, 93, 21468 }, // Ơ
+    { 17, 20, 19, 1, 19, 64, 21561 }, // ơ
+    { 21, 21, 22, 0, 21, 70, 21625 }, // Ƥ
+    { 18, 30, 19, 0, 23, 93, 21695 }, // ƥ
+    { 13, 26, 13, -1, 19, 58, 21788 }, // ƫ
+    { 20, 21, 21, 0, 21, 61, 21846 }, // Ƭ
+    { 15, 24, 15, -1, 23, 58, 21907 }, // ƭ
+    { 20, 27, 21, 0, 21, 74, 21965 }, // Ʈ
+    { 24, 25, 25, 0, 24, 79, 22039 }, // Ư
+    { 20, 20, 21, 0, 19, 66, 22118 }, // ư
+    { 7, 8, 3, -5, 25, 10, 22184 }, // ̀
+    { 6, 8, 5, -2, 25, 12, 22194 }, // ́
+    { 10, 7, 6, -5, 24, 18, 22206 }, // ̂
+    { 10, 5, 6, -5, 23, 17, 22224 }, // ̃
+    { 10, 3, 6, -5, 21, 6, 22241 }, // ̄
+    { 10, 6, 6, -5, 23, 14, 22247 }, // ̆
+    { 6, 5, 4, -3, 23, 9, 22261 }, // ̇
+    { 12, 5, 7, -6, 23, 14, 22270 }, // ̈
+    { 8, 9, 5, -4, 26, 18, 22284 }, // ̉
+    { 8, 9, 5, -4, 25, 17, 22302 }, // ̊
+    { 11, 8, 8, -4, 25, 22, 22319 }, // ̋
+    { 10, 7, 6, -5, 24, 17, 22341 }, // ̌
+    { 11, 8, 5, -7, 25, 22, 22358 }, // ̏
+    { 10, 6, 6, -5, 23, 14, 22380 }, // ̑
+    { 6, 8, 4, -3, 25, 13, 22394 }, // ̒
+    { 6, 9, 5, -2, 26, 13, 22407 }, // ̓
+    { 6, 9, 3, -4, 26, 12, 22420 }, // ̔
+    { 4, 8, 3, -2, 25, 11, 22432 }, // ̕
+    { 6, 8, 4, -3, 19, 12, 22443 }, // ̛
+    { 6, 5, 4, -3, -2, 9, 22455 }, // ̣
+    { 12, 5, 7, -6, -2, 13, 22464 }, // ̤
+    { 8, 7, 5, -4, -1, 16, 22477 }, // ̥
+    { 6, 7, 4, -3, -1, 10, 22493 }, // ̦
+    { 6, 7, 4, -3, -1, 13, 22503 }, // ̧
+    { 8, 8, 5, -4, 1, 11, 22516 }, // ̨
+    { 4, 8, 8, 2, -1, 13, 22527 }, // ̩
+    { 12, 7, 7, -6, -1, 17, 22540 }, // ̭
+    { 10, 6, 6, -5, -2, 14, 22557 }, // ̮
+    { 10, 6, 6, -5, -2, 17, 22571 }, // ̰
+    { 10, 3, 6, -5, -3, 6, 22588 }, // ̱
+    { 10, 6, 6, -5, 23, 14, 22594 }, // ͂
+    { 12, 12, 7, -6, 30, 22, 22608 }, // ̈́
+    { 6, 6, 5, -2, -2, 9, 22630 }, // ͅ
+    { 23, 21, 24, 0, 21, 77, 22639 }, // Α
+    { 17, 22, 19, 1, 21, 68, 22716 }, // Β
+    { 17, 21, 19, 1, 21, 58, 22784 }, // Γ
+    { 20, 21, 21, 0, 21, 69, 22842 }, // Δ
+    { 17, 21, 19, 1, 21, 68, 22911 }, // Ε
+    { 17, 22, 18, 0, 21, 63, 22979 }, // Ζ
+    { 23, 21, 25, 1, 21, 89, 23042 }, // Η
+    { 21, 22, 23, 1, 21, 89, 23131 }, // Θ
+    { 11, 21, 13, 1, 21, 43, 23220 }, // Ι
+    { 21, 22, 23, 1, 21, 79, 23263 }, // Κ
+    { 22, 21, 23, 0, 21, 70, 23342 }, // Λ
+    { 27, 21, 28, 0, 21, 100, 23412 }, // Μ
+    { 24, 22, 25, 0, 21, 89, 23512 }, // Ν
+    { 17, 21, 19, 1, 21, 57, 23601 }, // Ξ
+    { 21, 22, 23, 1, 21, 81, 23658 }, // Ο
+    { 23, 21, 25, 1, 21, 79, 23739 }, // Π
+    { 17, 21, 19, 1, 21, 62, 23818 }, // Ρ
+    { 18, 22, 19, 0, 21, 61, 23880 }, // Σ
+    { 20, 21, 21, 0, 21, 60, 23941 }, // Τ
+    { 21, 21, 22, 0, 21, 65, 24001 }, // Υ
+    { 22, 22, 24, 1, 21, 84, 24066 }, // Φ
+    { 22, 21, 23, 0, 21, 73, 24150 }, // Χ
+    { 25, 21, 26, 0, 21, 92, 24223 }, // Ψ
+    { 24, 21, 25, 0, 21, 85, 24315 }, // Ω
+    { 19, 17, 21, 1, 16, 62, 24400 }, // α
+    { 16, 30, 18, 1, 23, 85, 24462 }, // β
+    { 17, 23, 17, -1, 16, 66, 24547 }, // γ
+    { 16, 24, 18, 1, 23, 72, 24613 }, // δ
+    { 13, 17, 15, 1, 16, 45, 24685 }, // ε
+    { 13, 30, 15, 1, 24, 62, 24730 }, // ζ
+    { 18, 23, 18, -1, 16, 68, 24792 }, // η
+    { 17, 24, 18, 0, 23, 75, 24860 }, // θ
+    { 9, 17, 12, 2, 16, 29, 24935 }, // ι
+    { 16, 17, 19, 2, 16, 52, 24964 }, // κ
+    { 19, 24, 19, -1, 23, 70, 25016 }, // λ
+    { 19, 23, 21, 1, 16, 71, 25086 }, // μ
+    { 17, 17, 17, -1, 16, 51, 25157 }, // ν
+    { 13, 30, 15, 1, 24, 67, 25208 }, // ξ
+    { 16, 17, 18, 1, 16, 52, 25275 }, // ο
+    { 20, 17, 21, 0, 16, 60, 25327 }, // π
+    { 16, 23, 18, 1, 16, 69, 25387 }, // ρ
+    { 13, 22, 15, 1, 16, 51, 25456 }, // ς
+    { 18, 17, 20, 1, 16, 52, 25507 }, // σ
+    { 16, 17, 17, 0, 16, 44, 25559 }, // τ
+    { 18, 17, 18, -1, 16, 56, 25603 }, // υ
+    { 22, 28, 24, 1, 21, 108, 25659 }, // φ
+    { 18, 23, 18, -1, 16, 70, 25767 }, // χ
+    { 24, 28, 24, -1, 21, 97, 25837 }, // ψ
+    { 21, 17, 23, 1, 16, 72, 25934 }, // ω
+    { 23, 28, 24, 0, 21, 93, 26006 }, // Ạ
+    { 16, 23, 18, 1, 16, 67, 26099 }, // ạ
+    { 23, 30, 24, 0, 30, 101, 26166 }, // Ả
+    { 16, 27, 18, 1, 26, 77, 26267 }, // ả
+    { 23, 31, 24, 0, 31, 107, 26344 }, // Ấ
+    { 16, 30, 18, 1, 29, 87, 26451 }, // ấ
+    { 23, 31, 24, 0, 31, 106, 26538 }, // Ầ
+    { 16, 30, 18, 1, 29, 87, 26644 }, // ầ
+    { 23, 31, 24, 0, 31, 109, 26731 }, // Ẩ
+    { 16, 30, 18, 1, 29, 91, 26840 }, // ẩ
+    { 23, 31, 24, 0, 31, 110, 26931 }, // Ẫ
+    { 16, 29, 18, 1, 28, 90, 27041 }, // ẫ
+    { 23, 35, 24, 0, 28, 112, 27131 }, // Ậ
+    { 16, 31, 18, 1, 24, 86, 27243 }, // ậ
+    { 23, 31, 24, 0, 31, 105, 27329 }, // Ắ
+    { 16, 30, 18, 1, 29, 84, 27434 }, // ắ
+    { 23, 31, 24, 0, 31, 105, 27518 }, // Ằ
+    { 16, 30, 18, 1, 29, 83, 27623 }, // ằ
+    { 23, 31, 24, 0, 31, 111, 27706 }, // Ẳ
+    { 16, 30, 18, 1, 29, 88, 27817 }, // ẳ
+    { 23, 31, 24, 0, 31, 107, 27905 }, // Ẵ
+    { 16, 29, 18, 1, 28, 87, 28012 }, // ẵ
+    { 23, 35, 24, 0, 28, 112, 28099 }, // Ặ
+    { 16, 30, 18, 1, 23, 85, 28211 }, // ặ
+    { 17, 28, 19, 1, 21, 81, 28296 }, // Ẹ
+    { 14, 23, 16, 1, 16, 60, 28377 }, // ẹ
+    { 17, 30, 19, 1, 30, 92, 28437 }, // Ẻ
+    { 14, 27, 16, 1, 26, 72, 28529 }, // ẻ
+    { 17, 28, 19, 1, 28, 84, 28601 }, // Ẽ
+    { 14, 24, 16, 1, 23, 67, 28685 }, // ẽ
+    { 18, 31, 20, 1, 31, 96, 28752 }, // Ế
+    { 16, 30, 18, 1, 29, 81, 28848 }, // ế
+    { 17, 31, 19, 1, 31, 93, 28929 }, // Ề
+    { 14, 30, 16, 1, 29, 75, 29022 }, // ề
+    { 17, 31, 19, 1, 31, 98, 29097 }, // Ể
+    { 16, 30, 18, 1, 29, 84, 29195 }, // ể
+    { 17, 31, 19, 1, 31, 95, 29279 }, // Ễ
+    { 14, 29, 16, 1, 28, 80, 29374 }, // ễ
+    { 17, 35, 19, 1, 28, 100, 29454 }, // Ệ
+    { 14, 31, 16, 1, 24, 79, 29554 }, // ệ
+    { 11, 30, 13, 1, 30, 61, 29633 }, // Ỉ
+    { 10, 26, 11, 0, 26, 49, 29694 }, // ỉ
+    { 11, 28, 13, 1, 21, 54, 29743 }, // Ị
+    { 10, 30, 11, 0, 23, 50, 29797 }, // ị
+    { 21, 28, 23, 1, 21, 95, 29847 }, // Ọ
+    { 16, 23, 18, 1, 16, 64, 29942 }, // ọ
+    { 21, 31, 23, 1, 30, 108, 30006 }, // Ỏ
+    { 16, 27, 18, 1, 26, 76, 30114 }, // ỏ
+    { 21, 32, 23, 1, 31, 110, 30190 }, // Ố
+    { 16, 30, 18, 1, 29, 83, 30300 }, // ố
+    { 21, 32, 23, 1, 31, 111, 30383 }, // Ồ
+    { 16, 30, 18, 1, 29, 83, 30494 }, // ồ
+    { 21, 32, 23, 1, 31, 114, 30577 }, // Ổ
+    { 17, 30, 19, 1, 29, 91, 30691 }, // ổ
+    { 21, 32, 23, 1, 31, 114, 30782 }, // Ỗ
+    { 16, 29, 18, 1, 28, 82, 30896 }, // ỗ
+    { 21, 35, 23, 1, 28, 116, 30978 }, // Ộ
+    { 16, 31, 18, 1, 24, 82, 31094 }, // ộ
+    { 22, 30, 24, 1, 29, 107, 31176 }, // Ớ
+    { 17, 26, 19, 1, 25, 77, 31283 }, // ớ
+    { 22, 30, 24, 1, 29, 107, 31360 }, // Ờ
+    { 17, 26, 19, 1, 25, 76, 31467 }, // ờ
+    { 22, 31, 24, 1, 30, 115, 31543 }, // Ở
+    { 17, 27, 19, 1, 26, 86, 31658 }, // ở
+    { 22, 29, 24, 1, 28, 108, 31744 }, // Ỡ
+    { 17, 24, 19, 1, 23, 80, 31852 }, // ỡ
+    { 22, 31, 24, 1, 24, 108, 31932 }, // Ợ
+    { 17, 26, 19, 1, 19, 76, 32040 }, // ợ
+    { 23, 28, 24, 0, 21, 85, 32116 }, // Ụ
+    { 20, 23, 21, 0, 16, 71, 32201 }, // ụ
+    { 23, 31, 24, 0, 30, 96, 32272 }, // Ủ
+    { 20, 27, 21, 0, 26, 85, 32368 }, // ủ
+    { 24, 30, 25, 0, 29, 94, 32453 }, // Ứ
+    { 20, 26, 21, 0, 25, 80, 32547 }, // ứ
+    { 24, 30, 25, 0, 29, 95, 32627 }, // Ừ
+    { 20, 26, 21, 0, 25, 80, 32722 }, // ừ
+    { 24, 31, 25, 0, 30, 102, 32802 }, // Ử
+    { 20, 27, 21, 0, 26, 87, 32904 }, // ử
+    { 24, 29, 25, 0, 28, 95, 32991 }, // Ữ
+    { 20, 24, 21, 0, 23, 85, 33086 }, // ữ
+    { 24, 31, 25, 0, 24, 95, 33171 }, // Ự
+    { 20, 26, 21, 0, 19, 79, 33266 }, // ự
+    { 21, 29, 22, 0, 29, 79, 33345 }, // Ỳ
+    { 19, 32, 20, 0, 25, 83, 33424 }, // ỳ
+    { 21, 28, 22, 0, 21, 76, 33507 }, // Ỵ
+    { 19, 23, 20, 0, 16, 74, 33583 }, // ỵ
+    { 21, 30, 22, 0, 30, 87, 33657 }, // Ỷ
+    { 19, 33, 20, 0, 26, 92, 33744 }, // ỷ
+    { 21, 28, 22, 0, 28, 80, 33836 }, // Ỹ
+    { 19, 30, 20, 0, 23, 90, 33916 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 34006 }, //  
+    { 0, 0, 29, 0, 0, 0, 34006 }, //  
+    { 0, 0, 15, 0, 0, 0, 34006 }, //  
+    { 0, 0, 29, 0, 0, 0, 34006 }, //  
+    { 0, 0, 10, 0, 0, 0, 34006 }, //  
+    { 0, 0, 7, 0, 0, 0, 34006 }, //  
+    { 0, 0, 5, 0, 0, 0, 34006 }, //  
+    { 0, 0, 18, 0, 0, 0, 34006 }, //  
+    { 0, 0, 8, 0, 0, 0, 34006 }, //  
+    { 0, 0, 6, 0, 0, 0, 34006 }, //  
+    { 0, 0, 1, 0, 0, 0, 34006 }, //  
+    { 0, 0, 1, 0, 0, 0, 34006 }, // ​
+    { 2, 24, 2, -1, 17, 24, 34006 }, // ‌
+    { 6, 26, 4, -3, 19, 42, 34030 }, // ‍
+    { 10, 28, 6, -5, 21, 55, 34072 }, // ‎
+    { 10, 28, 6, -5, 21, 54, 34127 }, // ‏
+    { 9, 5, 11, 1, 10, 7, 34181 }, // ‐
+    { 9, 5, 11, 1, 10, 7, 34188 }, // ‑
+    { 14, 3, 18, 2, 11, 6, 34195 }, // ‒
+    { 15, 3, 16, 0, 9, 8, 34201 }, // –
+    { 29, 3, 30, 0, 9, 11, 34209 }, // —
+    { 29, 3, 30, 0, 9, 11, 34220 }, // ―
+    { 11, 30, 15, 2, 23, 93, 34231 }, // ‖
+    { 15, 8, 16, 0, -1, 22, 34324 }, // ‗
+    { 6, 10, 8, 1, 22, 15, 34346 }, // ‘
+    { 7, 10, 8, 0, 22, 15, 34361 }, // ’
+    { 7, 10, 8, 0, 4, 16, 34376 }, // ‚
+    { 6, 10, 8, 1, 22, 14, 34392 }, // ‛
+    { 12, 10, 14, 1, 22, 29, 34406 }, // “
+    { 12, 10, 13, 0, 22, 30, 34435 }, // ”
+    { 12, 10, 13, 0, 4, 30, 34465 }, // „
+    { 12, 10, 14, 1, 22, 29, 34495 }, // ‟
+    { 14, 19, 15, 0, 21, 47, 34524 }, // †
+    { 14, 23, 15, 0, 21, 63, 34571 }, // ‡
+    { 7, 7, 9, 1, 11, 14, 34634 }, // •
+    { 10, 10, 18, 4, 15, 19, 34648 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 34667 }, // ․
+    { 13, 6, 15, 1, 5, 17, 34676 }, // ‥
+    { 25, 6, 29, 2, 5, 27, 34693 }, // …
+    { 6, 6, 8, 1, 11, 8, 34720 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 34728 }, //  
+    { 0, 0, 1, 0, 0, 0, 34728 }, //  
+    { 10, 28, 6, -5, 21, 53, 34728 }, // ‪
+    { 10, 28, 6, -5, 21, 52, 34781 }, // ‫
+    { 10, 27, 6, -5, 20, 48, 34833 }, // ‬
+    { 12, 28, 7, -6, 21, 73, 34881 }, // ‭
+    { 12, 28, 7, -6, 21, 73, 34954 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 35027 }, //  
+    { 39, 24, 41, 1, 22, 166, 35027 }, // ‰
+    { 8, 11, 9, 0, 21, 15, 35193 }, // ′
+    { 14, 11, 15, 0, 21, 30, 35208 }, // ″
+    { 20, 11, 21, 0, 21, 44, 35238 }, // ‴
+    { 8, 11, 9, 0, 21, 15, 35282 }, // ‵
+    { 13, 11, 15, 1, 21, 30, 35297 }, // ‶
+    { 19, 11, 21, 1, 21, 44, 35327 }, // ‷
+    { 13, 6, 15, 1, 0, 16, 35371 }, // ‸
+    { 9, 12, 10, 0, 13, 18, 35387 }, // ‹
+    { 8, 12, 10, 1, 13, 20, 35405 }, // ›
+    { 18, 20, 19, 0, 19, 80, 35425 }, // ※
+    { 14, 23, 17, 2, 22, 70, 35505 }, // ‼
+    { 15, 4, 16, 0, 25, 20, 35575 }, // ‾
+    { 7, 5, 9, 1, 10, 6, 35595 }, // ⁃
+    { 15, 25, 11, -5, 22, 50, 35601 }, // ⁄
+    { 25, 23, 27, 1, 22, 92, 35651 }, // ⁇
+    { 21, 23, 23, 1, 22, 79, 35743 }, // ⁈
+    { 19, 23, 22, 2, 22, 72, 35822 }, // ⁉
+    { 17, 7, 29, 6, 12, 23, 35894 }, // ⁓
+    { 27, 11, 28, 0, 21, 58, 35917 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 35975 }, //  
+    { 0, 0, 1, 0, 0, 0, 35975 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 35975 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 35975 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 35975 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 35975 }, // ⁤
+    { 13, 14, 14, 0, 24, 39, 35975 }, // ⁰
+    { 13, 14, 14, 0, 24, 32, 36014 }, // ⁴
+    { 11, 14, 13, 1, 24, 28, 36046 }, // ⁵
+    { 11, 14, 13, 1, 24, 35, 36074 }, // ⁶
+    { 11, 14, 13, 1, 24, 30, 36109 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 36139 }, // ⁸
+    { 11, 14, 13, 1, 24, 33, 36178 }, // ⁹
+    { 13, 11, 16, 2, 21, 33, 36211 }, // ⁿ
+    { 13, 15, 14, 0, 10, 38, 36244 }, // ₀
+    { 10, 14, 13, 1, 10, 25, 36282 }, // ₁
+    { 11, 14, 13, 1, 10, 31, 36307 }, // ₂
+    { 11, 15, 13, 1, 10, 33, 36338 }, // ₃
+    { 13, 15, 14, 0, 10, 30, 36371 }, // ₄
+    { 11, 14, 13, 1, 9, 29, 36401 }, // ₅
+    { 11, 15, 13, 1, 10, 34, 36430 }, // ₆
+    { 11, 14, 13, 1, 9, 27, 36464 }, // ₇
+    { 11, 15, 13, 1, 10, 35, 36491 }, // ₈
+    { 11, 15, 13, 1, 10, 34, 36526 }, // ₉
+    { 16, 20, 18, 1, 20, 54, 36560 }, // ₣
+    { 18, 22, 19, 0, 21, 64, 36614 }, // ₤
+    { 39, 22, 40, 0, 21, 144, 36678 }, // ₧
+    { 18, 22, 19, 0, 21, 66, 36822 }, // €
+    { 19, 14, 29, 5, 17, 43, 36888 }, // ←
+    { 13, 20, 29, 8, 20, 36, 36931 }, // ↑
+    { 19, 14, 29, 5, 17, 43, 36967 }, // →
+    { 13, 20, 29, 8, 20, 37, 37010 }, // ↓
+    { 19, 14, 29, 5, 17, 48, 37047 }, // ↔
+    { 13, 20, 29, 8, 20, 45, 37095 }, // ↕
+    { 15, 20, 29, 7, 20, 56, 37140 }, // ↨
+    { 13, 20, 29, 8, 20, 54, 37196 }, // ↲
+    { 13, 20, 29, 8, 20, 52, 37250 }, // ↳
+    { 17, 16, 29, 6, 18, 47, 37302 }, // ↵
+    { 19, 16, 29, 5, 18, 51, 37349 }, // ⇐
+    { 17, 18, 29, 6, 19, 68, 37400 }, // ⇑
+    { 19, 16, 29, 5, 18, 51, 37468 }, // ⇒
+    { 17, 18, 29, 6, 19, 68, 37519 }, // ⇓
+    { 19, 16, 29, 5, 18, 48, 37587 }, // ⇔
+    { 21, 22, 29, 4, 21, 68, 37635 }, // ∀
+    { 16, 24, 18, 1, 23, 62, 37703 }, // ∂
+    { 15, 21, 29, 7, 21, 57, 37765 }, // ∃
+    { 23, 24, 29, 3, 22, 101, 37822 }, // ∅
+    { 20, 21, 21, 0, 21, 69, 37923 }, // ∆
+    { 19, 22, 29, 5, 21, 65, 37992 }, // ∇
+    { 21, 21, 29, 4, 21, 70, 38057 }, // ∈
+    { 21, 26, 29, 4, 23, 88, 38127 }, // ∉
+    { 21, 18, 29, 4, 19, 68, 38215 }, // ∊
+    { 21, 21, 29, 4, 21, 70, 38283 }, // ∋
+    { 21, 26, 29, 4, 23, 88, 38353 }, // ∌
+    { 21, 18, 29, 4, 19, 69, 38441 }, // ∍
+    { 23, 26, 25, 1, 21, 101, 38510 }, // ∏
+    { 19, 26, 20, 0, 21, 78, 38611 }, // ∑
+    { 14, 4, 18, 2, 12, 13, 38689 }, // −
+    { 15, 23, 16, 0, 21, 48, 38702 }, // ∕
+    { 15, 23, 16, 0, 21, 46, 38750 }, // ∖
+    { 14, 14, 18, 2, 17, 44, 38796 }, // ∗
+    { 12, 11, 18, 3, 15, 27, 38840 }, // ∘
+    { 6, 6, 18, 6, 11, 7, 38867 }, // ∙
+    { 19, 28, 19, -1, 24, 75, 38874 }, // √
+    { 14, 12, 18, 2, 15, 39, 38949 }, // ∝
+    { 18, 11, 19, 0, 15, 47, 38988 }, // ∞
+    { 19, 21, 29, 5, 21, 51, 39035 }, // ∟
+    { 23, 21, 29, 3, 21, 61, 39086 }, // ∠
+    { 5, 30, 15, 5, 23, 47, 39147 }, // ∣
+    { 11, 30, 15, 2, 23, 94, 39194 }, // ∥
+    { 21, 21, 29, 4, 21, 62, 39288 }, // ∧
+    { 21, 21, 29, 4, 21, 61, 39350 }, // ∨
+    { 17, 21, 29, 6, 21, 67, 39411 }, // ∩
+    { 17, 22, 29, 6, 21, 66, 39478 }, // ∪
+    { 16, 30, 18, 1, 23, 69, 39544 }, // ∫
+    { 19, 18, 29, 5, 17, 38, 39613 }, // ∴
+    { 19, 18, 29, 5, 17, 40, 39651 }, // ∵
+    { 7, 16, 9, 1, 18, 20, 39691 }, // ∶
+    { 19, 18, 29, 5, 17, 46, 39711 }, // ∷
+    { 17, 7, 29, 6, 12, 23, 39757 }, // ∼
+    { 17, 17, 29, 6, 18, 50, 39780 }, // ≅
+    { 14, 12, 18, 2, 16, 38, 39830 }, // ≈
+    { 17, 12, 29, 6, 14, 36, 39868 }, // ≍
+    { 14, 15, 18, 2, 17, 39, 39904 }, // ≠
+    { 17, 15, 29, 6, 16, 53, 39943 }, // ≡
+    { 14, 18, 18, 2, 18, 40, 39996 }, // ≤
+    { 14, 18, 18, 2, 18, 42, 40036 }, // ≥
+    { 25, 14, 29, 2, 17, 61, 40078 }, // ≪
+    { 25, 14, 29, 2, 17, 61, 40139 }, // ≫
+    { 21, 18, 29, 4, 19, 53, 40200 }, // ⊃
+    { 21, 26, 29, 4, 23, 80, 40253 }, // ⊄
+    { 21, 26, 29, 4, 23, 79, 40333 }, // ⊅
+    { 19, 21, 29, 5, 21, 70, 40412 }, // ⊆
+    { 19, 21, 29, 5, 21, 71, 40482 }, // ⊇
+    { 21, 22, 29, 4, 21, 94, 40553 }, // ⊕
+    { 21, 22, 29, 4, 21, 74, 40647 }, // ⊖
+    { 21, 22, 29, 4, 21, 100, 40721 }, // ⊗
+    { 21, 22, 29, 4, 21, 90, 40821 }, // ⊘
+    { 17, 21, 29, 6, 21, 58, 40911 }, // ⊥
+    { 6, 6, 18, 6, 11, 7, 40969 }, // ⋅
+    { 25, 6, 29, 2, 11, 25, 40976 }, // ⋯
+    { 27, 28, 29, 1, 24, 109, 41001 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
@@ -4600,4 +3339,5 @@ static const EpdFontData bookerly_14_bold = {
     31,
     -8,
     true,
+    true,
 };
@@ -2,4706 +2,3247 @@
  * generated by fontconvert.py
  * name: bookerly_14_bolditalic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_bolditalicBitmaps[64222] = {
-    0x00, 0x1A, 0x40, 0x2F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-    0x1F, 0xD0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xF8, 0x00, 0x3D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x1F,
-    0xC0, 0x01, 0x40, 0x00, 0x02, 0xD0, 0xB8, 0x3F, 0x4F, 0xD2, 0xFC, 0x7F, 0x0B, 0xF2, 0xFC, 0x3F,
-    0x8B, 0xE0, 0xFD, 0x3F, 0x43, 0xF0, 0xFC, 0x0F, 0x83, 0xF0, 0x7D, 0x0F, 0x80, 0x40, 0x10, 0x00,
-    0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x01, 0xFC,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x5B, 0xF5, 0x7F, 0x54, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x02, 0xAF, 0xEA, 0xFE, 0xA4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFE, 0x3E, 0xFD, 0x02, 0xF8, 0x3C, 0xBE, 0x03, 0xF4, 0x78, 0x3D, 0x03, 0xFC,
-    0xB4, 0x38, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x2D, 0x0B, 0x8F, 0xF0, 0xBE, 0x0F,
-    0x0B, 0xF0, 0xFF, 0x0F, 0x0B, 0xF0, 0xBF, 0x5E, 0x1F, 0xD0, 0x3F, 0xFE, 0xBF, 0xC0, 0x1F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xF5, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0xFC,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x3F, 0x00, 0xA9, 0x07, 0xF4, 0xBF, 0x0B, 0xD0, 0xBF, 0xFC, 0x3F, 0xFF, 0xC1, 0xF8,
-    0x3F, 0xEF, 0xE0, 0xBF, 0xE0, 0x3F, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x07, 0xF0,
-    0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x7E, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x40, 0xFE, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x3F, 0x83, 0xF8,
-    0x00, 0x1F, 0xC0, 0x02, 0xFE, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x7F,
-    0x40, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x0C, 0x00, 0x1F, 0xDF, 0xE0, 0x00, 0xBD,
-    0x00, 0x1F, 0xFE, 0x00, 0x6F, 0xFC, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xF4, 0x02, 0xFF, 0xE0, 0x3F,
-    0xFE, 0x00, 0x0B, 0xFB, 0xF0, 0x3E, 0xFC, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x82,
-    0xFC, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0xFF, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0xBF, 0xCF, 0xD0, 0x00,
-    0x7F, 0x40, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFD, 0x1F, 0xFF, 0xF4, 0x00, 0x05,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0xD0, 0xFD, 0x2F, 0xC2, 0xFC,
-    0x3F, 0x83, 0xF4, 0x3F, 0x03, 0xE0, 0x7D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xBD, 0x01, 0xE2, 0xF4, 0x0F, 0xDB, 0x80, 0x2F,
-    0xFD, 0xA4, 0x07, 0xFF, 0xE1, 0xBF, 0xEF, 0x8F, 0xEF, 0x40, 0x2E, 0x2F, 0x00, 0x10, 0xBC, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x2A,
-    0xBF, 0xEA, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0x3F, 0x40, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xC7, 0xFC, 0x7F, 0x41,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x07, 0xFC,
-    0x00, 0x3F, 0xE0, 0xFF, 0x40, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xC0, 0x00, 0x7F, 0xC7, 0xFC, 0x00,
-    0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0B, 0xFC, 0x03,
-    0xFF, 0x02, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x6F, 0xFE, 0x41, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x41, 0xFF,
-    0x80, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0x00, 0x0F, 0xF8, 0x01, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x41, 0xFF, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2E, 0xAF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF,
-    0xF8, 0x06, 0xAF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x1F, 0xDB, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x1F, 0xD0,
-    0x7F, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x7F, 0xD5, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x02, 0xFD, 0x55, 0x50, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x16, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0xA8, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0x0F,
-    0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0xBF,
-    0x80, 0x1F, 0xF0, 0x07, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xAA, 0xAF, 0xFC, 0x7F, 0x00, 0x1F, 0xF0, 0xBD, 0x00,
-    0x7F, 0xC0, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAF, 0xF8, 0x02,
-    0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x02, 0xFF, 0x4F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFD, 0xFF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x43, 0xFC, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x0B, 0xF4, 0x3F, 0xE0, 0x0B, 0xFC, 0x0B, 0xFF, 0xAF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xD0, 0x7F, 0xD0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x01, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0x40, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00,
-    0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x80, 0x06, 0xFF, 0x80, 0x07,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x2F, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xBF, 0xD2, 0x40, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF5, 0x00,
-    0x7F, 0xF4, 0x03, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xF8, 0x00, 0xBF,
-    0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xEF,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x1F, 0x86, 0x80, 0xFE, 0x03, 0xF8, 0x03,
-    0xFF, 0xFF, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0xEF, 0xF8, 0x07, 0xE0, 0xFD, 0x02, 0xFC, 0x0F, 0xC0,
-    0x2F, 0x87, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x2F, 0x80, 0xBF, 0x00, 0xF8, 0x03, 0xF4, 0xFD,
-    0x03, 0xF4, 0x0B, 0xD0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0x02,
-    0xFC, 0x07, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0xF0, 0x7F, 0x40, 0xFC, 0x03, 0xFF, 0xF7, 0xEF, 0xF8,
-    0x03, 0xF4, 0x0B, 0xFF, 0x1F, 0xFF, 0x40, 0x0F, 0xE0, 0x0B, 0xE0, 0x2F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0xFF, 0xE5, 0x05, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0xFF, 0x4B, 0xFE, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xD0, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xFA, 0xAF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00,
-    0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B,
-    0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00,
-    0x0F, 0xF0, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00,
-    0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04,
-    0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4,
-    0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xAA, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFA,
-    0xA9, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00,
-    0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xD0, 0x7F,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xEF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x3F,
-    0xF8, 0x00, 0x01, 0xFF, 0x90, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC,
-    0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xEF, 0xC0, 0x00, 0x0B, 0xDB, 0xF0, 0x2F, 0x7F,
-    0xC0, 0x00, 0x0F, 0xCB, 0xF0, 0x3E, 0x3F, 0xC0, 0x00, 0x0F, 0xC7, 0xF4, 0xFC, 0x3F, 0xC0, 0x00,
-    0x2F, 0x83, 0xF9, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xFB, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x03,
-    0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0xFD, 0x02, 0xFF, 0x40,
-    0x7F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xBF, 0x40,
-    0x02, 0xF8, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x50, 0x01, 0xFF, 0xD0, 0x3F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00,
-    0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x02,
-    0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x3F,
-    0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82, 0xF8,
-    0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x40,
-    0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90, 0x01,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD,
-    0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83,
-    0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFB, 0xFE, 0x6F, 0xFC, 0x00, 0x03,
-    0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xEA, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x00, 0x7F,
-    0xD0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF9, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4,
-    0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF,
-    0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0,
-    0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8,
-    0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xC3, 0xFF, 0xFE, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF4, 0x00,
-    0x00, 0x01, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x07,
-    0xC0, 0x1F, 0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xFF, 0xF0, 0x7F, 0xE0, 0x01, 0xFD, 0x00,
-    0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x07, 0xF0,
-    0x00, 0xBF, 0x80, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x1F, 0xFD, 0x01, 0xFC, 0x00, 0x0B,
-    0xF8, 0x0F, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xFE, 0x07, 0xEF, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x83,
-    0xF3, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xE1, 0xF8, 0xBE, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFC, 0x2F,
-    0x8F, 0xE0, 0x00, 0x00, 0xFF, 0x7E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0x41, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xF0,
-    0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x0B, 0xC0, 0x07, 0xFE, 0x00, 0x1F,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x64, 0x00, 0xBF, 0xD0, 0x03, 0xF0, 0x0B, 0xFE,
-    0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0xAA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0xAA, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x0B, 0xE0, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x2F, 0x80,
-    0x02, 0xF8, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0xBD, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x03, 0xF0, 0x08, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC,
-    0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40,
-    0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F,
-    0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0x40, 0x01, 0xFC, 0x2F, 0xF4, 0x01, 0xFC, 0xFF, 0xFC, 0x02, 0xFA,
-    0xFF, 0xFC, 0x03, 0xFB, 0xC3, 0xFD, 0x03, 0xFF, 0x02, 0xFD, 0x07, 0xFD, 0x03, 0xFC, 0x0B, 0xFC,
-    0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x1F, 0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xFA, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x7E, 0xBF,
-    0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFE, 0x03, 0xFC, 0x07, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F,
-    0x0F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x05, 0x43, 0xF8,
-    0x00, 0x1F, 0xFE, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x0B, 0xF4, 0x03, 0xF4, 0x03, 0xFC, 0x01, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00,
-    0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF,
-    0x0F, 0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F,
-    0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0,
-    0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0x02, 0x40, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xAF, 0xFA, 0x90, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x2F,
-    0x4B, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF,
-    0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x05, 0x40, 0x01, 0xFD, 0x1F, 0xF8, 0x00, 0xBF,
-    0x2F, 0xFF, 0x00, 0x2F, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0x4B, 0xF0, 0x03, 0xFF, 0x43, 0xFC, 0x01,
-    0xFF, 0x80, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0x40, 0x3F, 0xD0, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x07, 0xF8, 0x03, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x40, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F,
-    0xFF, 0x4F, 0xF0, 0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x2F, 0xF8, 0x3F, 0xFF, 0x05, 0xBF, 0x80, 0x1F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00,
-    0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFD, 0x74, 0xBF, 0xFD, 0x2F, 0xFE, 0x07,
-    0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x24, 0x0B, 0xF4, 0x00, 0x7E, 0x6F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x50, 0x01, 0xFC, 0x2F, 0xF0, 0x07, 0xF3,
-    0xFF, 0xE0, 0x2F, 0xBE, 0x7F, 0xC0, 0xFF, 0xD0, 0xBE, 0x03, 0xFD, 0x03, 0xF4, 0x1F, 0xE0, 0x2F,
-    0xC0, 0xBF, 0x02, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xBF, 0x40, 0x02,
-    0xFC, 0xBF, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x3F, 0xC1, 0xFF, 0xE4, 0xFE, 0x02, 0xFF, 0xE7, 0xF4,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x16, 0xFE, 0x00,
-    0x7F, 0x40, 0x2F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x02, 0xFD,
-    0x00, 0xFF, 0x6C, 0x3F, 0xFF, 0x0F, 0xFF, 0x82, 0xFF, 0x40, 0x04, 0x00, 0x00, 0x54, 0x00, 0x50,
-    0x00, 0x50, 0x07, 0xFF, 0x42, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0xC0, 0x5B,
-    0xF7, 0xFF, 0xF7, 0xFF, 0xF4, 0x01, 0xFF, 0xE1, 0xFF, 0xD2, 0xFC, 0x00, 0x7F, 0xF0, 0xBF, 0xE0,
-    0xFF, 0x00, 0x2F, 0xF0, 0x3F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x1F, 0xE0, 0x03, 0xFC,
-    0x07, 0xFC, 0x0B, 0xF4, 0x01, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x1F, 0xE0, 0x2F, 0xD7, 0x47, 0xF8, 0x0B,
-    0xF4, 0x0B, 0xFF, 0xD2, 0xFD, 0x02, 0xFC, 0x02, 0xFF, 0xF0, 0xFF, 0x00, 0xFE, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x01, 0xFF, 0xE0, 0xBF, 0xD0,
-    0x3F, 0xFE, 0x3F, 0xFF, 0x01, 0x6F, 0xEF, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xFC,
-    0x0F, 0xE0, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x7F, 0x80, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF2, 0xC1, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE, 0x00, 0x3F, 0xCB, 0xF4,
-    0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x07,
-    0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x40, 0x02, 0xFF, 0xC1, 0xFF, 0x80, 0x0F, 0xFF,
-    0x5F, 0xFF, 0x40, 0x16, 0xFE, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x47, 0xF8, 0x00, 0x2F, 0xF4, 0x1F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0x80,
-    0xBF, 0x80, 0x01, 0xFF, 0xEF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xF4, 0x00,
-    0x00, 0xFE, 0x04, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xAA, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x07,
-    0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD,
-    0x00, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xC3, 0xEF, 0xC0, 0x0F, 0xFF, 0xE7, 0xF0, 0x02, 0xFF, 0xF2,
-    0xF8, 0x00, 0x3F, 0xE0, 0xFE, 0x00, 0x00, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x02, 0xAA, 0xA8, 0x00, 0x00, 0x14, 0x01, 0x40, 0x7F, 0xF8, 0x3F, 0xC3, 0xFF, 0xE3, 0xFF, 0x05,
-    0x7F, 0x6F, 0xFC, 0x00, 0xFD, 0xFE, 0xD0, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD5, 0xFC, 0x02, 0xFC,
-    0x02, 0x40, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2,
-    0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4,
-    0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01,
-    0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F,
-    0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD,
-    0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF,
-    0x00, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0xBF, 0xD0,
-    0x3F, 0xD7, 0xFF, 0xC0, 0xFF, 0x9A, 0xFF, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x07, 0xF4, 0x1F,
-    0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x03, 0xFC, 0xBE, 0x00,
-    0x0B, 0xF3, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x05, 0x02,
-    0xFF, 0x01, 0xFD, 0x03, 0xFC, 0xBF, 0xF8, 0x0F, 0xF0, 0x2F, 0xD5, 0xBF, 0xC0, 0xBF, 0x01, 0xFE,
-    0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xD0, 0x1F, 0xD0, 0x7F, 0x80, 0xFC, 0x00, 0xFD, 0x0B, 0xF8, 0x1F,
-    0xC0, 0x0F, 0xE0, 0xFF, 0xC2, 0xF4, 0x00, 0xFE, 0x1F, 0xFC, 0x3F, 0x00, 0x0B, 0xE3, 0xFF, 0xC7,
-    0xE0, 0x00, 0xBF, 0x7D, 0xFC, 0xFC, 0x00, 0x07, 0xFF, 0x8F, 0xEF, 0x40, 0x00, 0x7F, 0xF0, 0xFF,
-    0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x03,
-    0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x25, 0xBE,
-    0x3F, 0xC0, 0x03, 0xFF, 0xC2, 0xFF, 0xF8, 0x7F, 0xF0, 0x1F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0xD0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00,
-    0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00,
-    0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F,
-    0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08,
-    0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x07, 0xFF, 0x47, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFD, 0x07, 0xD0, 0x7F, 0xD0, 0x1F, 0x00, 0xFD, 0x00, 0x14,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0xB4, 0x0F, 0xF9, 0x47, 0xF0, 0xFF, 0xFF, 0xFF, 0xC7, 0xFB, 0xFF, 0xFD,
-    0x0F, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0xBF, 0xE8, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x02,
-    0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x2E, 0x3F, 0xFF, 0x47, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x80, 0x1B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B,
-    0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x80,
-    0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02, 0xFD, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x7F, 0x90, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xBD, 0xFC, 0x0B, 0xF8, 0xB8, 0x14, 0x0F, 0xE0, 0xF4, 0x00, 0x2F, 0xC0, 0xF0,
-    0x00, 0x3F, 0xC1, 0xF0, 0x00, 0x3F, 0x82, 0xE0, 0x00, 0x3F, 0x83, 0xD0, 0x00, 0x3F, 0x83, 0xC0,
-    0x00, 0x3F, 0xC7, 0xC0, 0xB0, 0x2F, 0xFB, 0x87, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x2F,
-    0xC0, 0x1E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xBF, 0xEA, 0xA4, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x53, 0xF8, 0x00, 0x16, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xD1, 0xBF, 0xFF, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0xB8,
-    0x05, 0x50, 0x7C, 0x0B, 0xEB, 0xFF, 0xEF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x47, 0xFC,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x0B, 0xFF, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xBD, 0x1F, 0xE4, 0x7E, 0x02, 0x00, 0x00, 0x01, 0x80, 0x7F, 0xFF, 0xC1, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x6F, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xF8, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x01,
-    0xFD, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x1F, 0xC0,
-    0x00, 0x1A, 0xFF, 0x3F, 0xE8, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x7F, 0xF9, 0x54, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x07, 0xFA, 0xFF, 0x00, 0x3F, 0x00, 0xFC,
-    0x03, 0xFC, 0x02, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0xF3, 0xF4, 0x00, 0x03, 0xC7, 0xF4, 0x00, 0x0F,
-    0x07, 0xF8, 0x00, 0x3E, 0x03, 0xFC, 0x00, 0xBD, 0x03, 0xFC, 0x00, 0xFD, 0x03, 0xF4, 0x01, 0xFE,
-    0x03, 0xE0, 0x01, 0xFF, 0x0B, 0xC0, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0x78, 0x00, 0x00, 0xFE,
-    0xD0, 0x3C, 0x01, 0xFF, 0x03, 0xF0, 0x07, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7D, 0xBF, 0x0F, 0xFF,
-    0xF1, 0xFD, 0x78, 0x0B, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E,
-    0x00, 0xB4, 0x02, 0xFF, 0x40, 0xB4, 0x0F, 0x01, 0xFF, 0xFC, 0x03, 0xC2, 0xD0, 0x3F, 0x07, 0xC0,
-    0x2C, 0x3C, 0x0B, 0xC0, 0x38, 0x01, 0xE3, 0xC0, 0xFC, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0xC0, 0x00,
-    0x00, 0xF3, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0xFE, 0x00,
-    0x00, 0x1E, 0x2D, 0x07, 0xFE, 0x6C, 0x02, 0xC0, 0xE0, 0x2F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x6F,
-    0xE0, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9,
-    0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x19,
-    0x14, 0x01, 0xFF, 0xFC, 0x07, 0xFB, 0xF8, 0x0F, 0xC1, 0xF0, 0x1F, 0x42, 0xF0, 0x2F, 0x03, 0xE0,
-    0x3E, 0x0B, 0xD0, 0x3F, 0x1F, 0xC9, 0x3F, 0xFF, 0xFD, 0x1F, 0xF3, 0xF8, 0x05, 0x40, 0x50, 0x00,
-    0x00, 0x10, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x15, 0x54, 0x00, 0x00, 0x1E, 0x00, 0x38, 0x00,
-    0xBF, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x1F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0xFF, 0x40, 0xBF,
-    0x41, 0xFE, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x0F, 0xE0, 0x3F, 0xC0, 0x07,
-    0xF4, 0x0F, 0xE0, 0x00, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x47, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x2E,
-    0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x07, 0x8F, 0x03, 0x83, 0x80, 0xE2,
-    0xD0, 0xB0, 0xD0, 0x3D, 0xF0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0xEE, 0x02, 0xC3, 0xC1,
-    0xF3, 0xE0, 0xE0, 0x70, 0xFE, 0x3D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x3F, 0xFF, 0xDB, 0xFF, 0xFD, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFE, 0x0F, 0xFB, 0xFD, 0x7F, 0x02, 0xF9, 0xF4, 0x03,
-    0xFB, 0xD0, 0x0F, 0xDF, 0xC0, 0xBE, 0x3F, 0xEF, 0xF0, 0x7F, 0xFF, 0x40, 0x6F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB, 0xFE, 0xA9, 0x00, 0x2F, 0x80,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x01, 0xFF, 0xFC, 0x03, 0xFA, 0xFE, 0x07, 0xD0, 0x7E, 0x02, 0x40, 0xBE, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x0F, 0xFF, 0xC0,
-    0xBE, 0x7F, 0x42, 0xC0, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xF8, 0x00, 0xFB, 0xF4,
-    0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x2A, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x69, 0x00,
-    0x00, 0x01, 0x00, 0x3D, 0x0F, 0xE1, 0xFD, 0x3F, 0x8B, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x50, 0x00, 0x1F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x7F, 0x40,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x01,
-    0xFE, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x5F, 0xFF, 0x0D, 0x03, 0xFF,
-    0xFF, 0x7F, 0xFD, 0x03, 0xFF, 0xFD, 0x2F, 0xF8, 0x07, 0xEF, 0xF4, 0x0F, 0xE0, 0x0B, 0xE0, 0x40,
-    0x01, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0x9F, 0x40, 0x00, 0x7F, 0xFF, 0x4F, 0x00, 0x00, 0xFF, 0xFF, 0x5F, 0x00, 0x01, 0xFF,
-    0xFF, 0x2E, 0x00, 0x02, 0xFF, 0xFF, 0x3E, 0x00, 0x02, 0xFF, 0xFE, 0x3D, 0x00, 0x02, 0xFF, 0xFD,
-    0x3C, 0x00, 0x02, 0xFF, 0xFC, 0x7C, 0x00, 0x01, 0xFF, 0xFC, 0xB8, 0x00, 0x00, 0xFF, 0xFC, 0xF8,
-    0x00, 0x00, 0x2E, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0xF1, 0xF0, 0x00,
-    0x00, 0x01, 0xF2, 0xF0, 0x00, 0x00, 0x02, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00,
-    0x03, 0xC7, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x0F, 0xBF, 0x00, 0x00, 0x70, 0x3F,
-    0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x0F, 0xEB, 0xFF, 0xFD, 0x7E, 0x00, 0x00, 0x06, 0x80, 0x7F, 0xC0, 0x7F, 0x00,
-    0xF8, 0x0B, 0xC1, 0xFC, 0x06, 0x40, 0x00, 0x00, 0x1B, 0x41, 0xBF, 0xE0, 0xBF, 0xF4, 0x05, 0xFC,
-    0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0x80,
-    0x7F, 0xFD, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0xBF, 0xF4, 0x02, 0xF9, 0xFC,
-    0x07, 0xE0, 0xBC, 0x0F, 0xC0, 0xBC, 0x1F, 0x80, 0xFC, 0x1F, 0x41, 0xF8, 0x1F, 0x43, 0xF4, 0x0F,
-    0xDF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xD0, 0x15, 0x50, 0x00, 0x02, 0xD0, 0x07, 0x80, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x3F,
-    0x80, 0x03, 0xFD, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x0F, 0xF0, 0x2F, 0xD0, 0x0B, 0xF8,
-    0x1F, 0xF0, 0x0B, 0xF8, 0x1F, 0xF0, 0x0B, 0xF4, 0x1F, 0xE0, 0x0B, 0xF4, 0x1F, 0xE0, 0x01, 0xE0,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0,
-    0x00, 0xF8, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0F,
-    0xF4, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0x42, 0xFF, 0xF4, 0x02, 0xF4, 0x00, 0xFA, 0xF0,
-    0x3F, 0xFF, 0x00, 0x7E, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xE0, 0x00,
-    0x00, 0x03, 0xF4, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x15, 0x5F, 0xD4, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0xFF, 0x40, 0x1F, 0x80,
-    0x01, 0xF8, 0x0F, 0xE6, 0xFC, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0xF4, 0x0F, 0xC2, 0xFF, 0xF4, 0x0F,
-    0xC0, 0x05, 0x01, 0xF8, 0x3F, 0xFF, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x95,
-    0x50, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD3, 0xF4,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x70, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3A, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00,
-    0x3F, 0x80, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0F, 0xF4, 0x00, 0x6F, 0xC0, 0x0F, 0x80, 0x03, 0xFF,
-    0x4B, 0xFF, 0xF0, 0x03, 0xF0, 0x00, 0xFA, 0xF0, 0xBF, 0xF8, 0x00, 0xBD, 0x00, 0x3E, 0x3F, 0x01,
-    0x50, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x7D, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x15, 0x5F, 0xD4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x0F, 0xF8, 0x02, 0xFF, 0xC0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x07,
-    0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x14,
-    0xBF, 0xAF, 0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00,
-    0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE,
-    0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x78, 0x00, 0x00, 0x00,
-    0xBF, 0xFB, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00,
-    0x02, 0xFD, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x07, 0xF5, 0x55, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFE, 0x47, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x29, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00,
-    0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xEB,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2F,
-    0x8B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xFE, 0x5A, 0x90, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x40, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x00,
-    0x0B, 0x80, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x02,
-    0xF8, 0x00, 0x2F, 0xD0, 0x01, 0xBF, 0xEA, 0xFF, 0xD0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0, 0x02,
-    0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA,
-    0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0,
-    0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A,
-    0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B,
-    0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x2F, 0x00, 0x00, 0x02, 0xD0, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00,
-    0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF,
-    0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE,
-    0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x64, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x00,
-    0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xAA, 0xBF, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x01, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x78, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE5,
-    0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x40, 0x00, 0x1F, 0xF0, 0x00,
-    0xB8, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xEB, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x1E,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0x80, 0x68, 0x00, 0x0F,
-    0xE1, 0xFD, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x07,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFB,
-    0xE0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xE0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x0B, 0xE0,
-    0x00, 0x07, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0xFF,
-    0xC0, 0x7F, 0x00, 0x00, 0x3F, 0x5F, 0xF4, 0x2F, 0xC0, 0x00, 0x1F, 0xC3, 0xFE, 0x0B, 0xE0, 0x00,
-    0x0B, 0xF0, 0x7F, 0xC3, 0xF4, 0x00, 0x02, 0xF8, 0x0F, 0xF8, 0xFC, 0x00, 0x00, 0xFD, 0x02, 0xFF,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFE, 0x40, 0x07, 0xFF,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC,
-    0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00,
-    0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00,
-    0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xFC,
-    0x00, 0x00, 0x0B, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0,
-    0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x7F, 0xD3,
-    0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3C, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0x00, 0x00,
-    0x03, 0xF7, 0xFF, 0x40, 0x00, 0x00, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x7F, 0xD0,
-    0x00, 0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0x1F,
-    0xD3, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x10,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x24, 0x1F, 0x80,
-    0x2F, 0x4B, 0xF8, 0x2F, 0xE0, 0xBF, 0xAF, 0xE0, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x1F,
-    0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1F, 0xF0, 0xFF, 0x4B, 0xF0, 0x0F, 0xE0, 0xB0,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x34, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xAF, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFC, 0x00, 0x7E,
-    0x3F, 0xE0, 0x0B, 0xFC, 0x01, 0xF8, 0x3F, 0xD0, 0x0F, 0xF8, 0x07, 0xE0, 0x3F, 0xD0, 0x0F, 0xF8,
-    0x1F, 0x80, 0x7F, 0xD0, 0x0F, 0xF8, 0x7D, 0x00, 0xBF, 0xC0, 0x0F, 0xFA, 0xF4, 0x00, 0xFF, 0x80,
-    0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0xBC, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00,
-    0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00,
-    0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF,
-    0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00,
-    0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0,
-    0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F,
-    0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02,
-    0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41,
-    0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F,
-    0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x1B, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x3F, 0xC0,
-    0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0xFF, 0x80, 0x03, 0xFD, 0x6F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0x90, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x81, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFE, 0x00, 0x00, 0xBF, 0x04, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x1F, 0x01, 0xFC, 0x00, 0x00,
-    0xFE, 0x3F, 0xFB, 0xF8, 0x00, 0x01, 0xFD, 0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x0F, 0xFF, 0x40,
-    0x00, 0x03, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x2E, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F,
-    0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8,
-    0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0,
-    0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F,
-    0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x07, 0xF0,
-    0x1F, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07,
-    0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02,
-    0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF,
-    0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x01, 0xFF, 0x4B, 0x80, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3C, 0x3F, 0xF0, 0x00, 0x06, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD, 0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9,
-    0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE,
-    0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03,
-    0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF,
-    0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0x40, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x07, 0x80, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD, 0xBF, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8,
-    0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE, 0x3F, 0xFF,
-    0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0x43, 0xD0,
-    0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F,
-    0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00,
-    0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF,
-    0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x15, 0x00, 0x00, 0x3F, 0xFE, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xE6, 0xFF, 0xD3, 0xFC, 0x03, 0xFC, 0x01, 0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0x0F, 0xD0, 0x3F,
-    0x80, 0xFF, 0x00, 0x7F, 0x02, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xFB,
-    0xF8, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFC, 0x07, 0xFF, 0x90, 0x00, 0x0F, 0xF0, 0x3F,
-    0xF8, 0x00, 0xB0, 0x3F, 0xC3, 0xEF, 0xF0, 0x1F, 0xC0, 0xFF, 0xFF, 0x2F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFC, 0x07,
-    0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x28, 0x3F, 0xF0, 0x7F, 0x0F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x01, 0xFD, 0x2F, 0xC0, 0x3F, 0x01, 0xFC, 0x0F,
-    0xE0, 0x3F, 0x80, 0xFC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFC, 0x03, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0x40,
-    0x03, 0xFE, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0x03, 0xFC, 0x07, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE, 0x03,
-    0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xF4, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBD, 0xFC, 0x00, 0x1F, 0x83, 0xE0, 0x07, 0xE0, 0x2E,
-    0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xC0, 0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02,
-    0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00,
-    0xB0, 0x3F, 0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x03, 0xFC, 0xBF, 0x40, 0x0F,
-    0xE2, 0xFC, 0x00, 0x2D, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0xFC, 0x07, 0xF0,
-    0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x02, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x80, 0x0F, 0xD0, 0x0F, 0xF0, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x3E, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x50, 0x2F, 0xF8, 0xFF, 0xFC, 0x5B, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F,
-    0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x5D, 0xBF, 0xFD, 0xBF, 0xF8, 0x7F, 0xD0, 0x04,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0xBE, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFF, 0x80, 0x3F,
-    0xFF, 0x00, 0x5B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0x40, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x74, 0x0B, 0xFF, 0xD0,
-    0x2F, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFE, 0x00, 0x1F,
-    0xFC, 0x00, 0xFD, 0xF8, 0x0F, 0xC2, 0xF0, 0xFD, 0x03, 0xD1, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xC0, 0x16, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00,
-    0xBF, 0x5D, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0x80, 0x1F, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x03, 0xE1, 0xFD, 0x3F, 0xCB, 0xF0, 0xFE, 0x0A, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0xF0, 0x05, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x0B,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07,
-    0xF4, 0x00, 0x2F, 0xD7, 0x40, 0xBF, 0xFD, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x70, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0B, 0x8F, 0xE0, 0x00, 0x01, 0x07, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFD, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC,
-    0x3F, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xE0, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x00, 0x7F, 0xD2, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0xF0, 0xFF, 0xC0, 0x00, 0x05, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF,
-    0xF0, 0x16, 0xFE, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8,
-    0x00, 0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0,
-    0x0F, 0xFF, 0xC2, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x02, 0xFF, 0x6F,
-    0xF4, 0x1F, 0xE0, 0x2F, 0xF0, 0xFF, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0xFF, 0x2F, 0xD0, 0x03, 0xFC,
-    0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0xBF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF,
-    0x41, 0xFF, 0x02, 0xFF, 0xAF, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0,
-    0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x3F, 0x01,
-    0xF0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE,
-    0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00,
-    0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x00, 0x03, 0xFD, 0x2E,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0x4F, 0xFC, 0x00, 0x06, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7D,
-    0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x07, 0x80, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x40, 0x10, 0x00, 0x07,
-    0xFF, 0xF2, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x00, 0x7F, 0x80, 0x7F,
-    0xC0, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xFC, 0x00, 0xBF, 0x07, 0xDF, 0xF0, 0x03,
-    0xFC, 0x7C, 0x3F, 0x80, 0x0F, 0xFB, 0xC1, 0xFD, 0x00, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x80,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xFE, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0x4B, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF,
-    0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F,
-    0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x0B, 0xE1, 0xF8, 0x00, 0x01, 0xF8, 0x0B, 0x80, 0x00,
-    0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01, 0xFF, 0xD0, 0x0F,
-    0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF4,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x2F, 0xC2,
-    0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x0F,
-    0xF2, 0xFD, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0B, 0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F,
-    0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81,
-    0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0,
-    0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x05, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x40, 0x00, 0x07, 0xF0, 0xBF, 0xD0, 0x00, 0x2F, 0xCF, 0xFF,
-    0xC0, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x03, 0xFB, 0xC3, 0xFC, 0x00, 0x1F, 0xFC, 0x0F, 0xF0, 0x00,
-    0x7F, 0xD0, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0xFF, 0xEB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xEF, 0xF8, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00,
-    0x00, 0x3F, 0x87, 0xF4, 0x00, 0x00, 0x1E, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF,
-    0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41,
-    0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xD5, 0x5F, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0x55, 0x56, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE4,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40,
-    0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F,
-    0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x1F,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x55, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xF5, 0x55, 0x6F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFE, 0x47,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x03, 0x40, 0x00, 0xFE, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD,
-    0xBF, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE,
-    0x3F, 0xFF, 0xCF, 0xFF, 0x8B, 0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00,
-    0x02, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40,
-    0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD,
-    0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0,
-    0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x00, 0x40, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF, 0xE0,
-    0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00, 0x50,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x1C, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x0A, 0x00, 0xFF, 0xC1, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0x0B, 0xC0, 0x00, 0x0B, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xAA, 0xFE, 0x00, 0xFF,
-    0xE0, 0x02, 0xF4, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x00,
-    0x50, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x60, 0x2F, 0xFC, 0x00, 0x0B, 0xC0, 0x3F, 0xFE, 0x56, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xBD, 0xFC, 0x00, 0x1F, 0x83, 0xE0, 0x07, 0xE0, 0x2E, 0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03, 0xFC,
-    0x07, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xA0, 0x3F, 0xF0, 0x7F, 0x03, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xEA, 0xBF,
-    0x80, 0x3F, 0xF8, 0x00, 0xBD, 0x02, 0xFF, 0x00, 0x03, 0xF0, 0x0F, 0xF4, 0x00, 0x0F, 0x80, 0xBF,
-    0x80, 0x00, 0x14, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x18, 0x0B, 0xFF, 0x00, 0x02, 0xF0, 0x0F, 0xFF,
-    0x95, 0xBF, 0x80, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x0F, 0xF0, 0x1C, 0x0B, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0xA0, 0xFF, 0xC1, 0xFC, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xB8, 0x00, 0x00,
-    0xBD, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0xAB, 0xF8,
-    0x00, 0xFF, 0xE0, 0x02, 0xF4, 0x02, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xE0, 0x0B,
-    0xF8, 0x00, 0x01, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0x80, 0x2F, 0xFC, 0x00, 0x0B,
-    0xC0, 0x0F, 0xFF, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x03, 0xE0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x1C, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x0A, 0x00, 0xFF, 0xC1, 0xFC, 0x03, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8,
-    0xBE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F,
-    0xF0, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x02, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x3E, 0x00, 0x00, 0x0F, 0xFF,
-    0xC7, 0xE0, 0x00, 0x00, 0x5B, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x15, 0x0F, 0xE0, 0x40, 0x00, 0x1F, 0xFE,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x03, 0xFC,
-    0x07, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x3E, 0xFE, 0xB8, 0x00, 0x3F,
-    0xFF, 0xCF, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0xFF, 0xE0, 0x00, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3E, 0xFF, 0x9B, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x07, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xD0, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF9, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE,
-    0xFF, 0xC0, 0x00, 0xFF, 0x40, 0xFE, 0x00, 0x07, 0xF8, 0x03, 0xF4, 0x00, 0x3F, 0xC0, 0x1F, 0xC0,
-    0x01, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0xFF,
-    0x01, 0xFF, 0x40, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0x0F, 0xF0, 0xFB, 0xFA, 0xE0, 0x3F, 0xFF, 0xCF,
-    0xFF, 0x80, 0xBF, 0xFC, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0xAA, 0xFE, 0x00,
-    0x00, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x1F, 0xF0, 0x01, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x96, 0xA4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xE0, 0x00, 0x2F,
-    0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xAF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE,
-    0x03, 0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xF4,
-    0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7D,
-    0x00, 0x01, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF9, 0x6A, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00,
-    0x07, 0xFC, 0x00, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x00,
-    0x7F, 0xFA, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0xB8, 0x01, 0xC0, 0x03, 0xF8, 0x6F, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x01, 0xFF, 0xFF, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80,
-    0x3F, 0x02, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF,
-    0x90, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xEA, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7D, 0x00, 0x01, 0xFF,
-    0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0x6A, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00, 0x07, 0xFC, 0x00,
-    0x2E, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0xFA, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x07, 0xFF, 0xFC, 0x01,
-    0xFD, 0x2F, 0xC0, 0x3F, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFC,
-    0x03, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x03, 0xFE, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0x03, 0xFC,
-    0x07, 0xF0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40,
-    0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01,
-    0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F,
-    0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD2,
-    0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0, 0x7F,
-    0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0B, 0x80, 0x00,
-    0x02, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F,
-    0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00,
-    0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0F, 0xC0,
-    0x7F, 0x00, 0xFE, 0x03, 0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00, 0xFF, 0xBF, 0xC0,
-    0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF, 0x01, 0xFC, 0x02,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0xF8, 0x00, 0x00, 0x78,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC,
-    0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x47, 0xD0, 0x00, 0x00,
-    0xBD, 0x03, 0xD0, 0x00, 0x00, 0x24, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE,
-    0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F,
-    0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x34, 0x00, 0x00, 0x2F, 0x92, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F,
-    0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4,
-    0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x3D, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x46, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0xAB, 0xFD, 0x00, 0xFF,
-    0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xF4, 0x0B, 0xFC, 0x00,
-    0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F, 0xF0, 0x01, 0xBF, 0xFC,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50, 0x00,
-    0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC, 0x00,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE,
-    0xAB, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0xFC, 0x03, 0xFD, 0x00, 0x00,
-    0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xAA, 0xAA, 0x3F, 0xE0, 0x02, 0xFF, 0xFE, 0x3F,
-    0xF0, 0x01, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x40, 0x1F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0xFE, 0x50,
-    0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x9B, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFA, 0xFF, 0xF4, 0x00, 0x7F, 0x80, 0x2F, 0xFC,
-    0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x02, 0xFD, 0xFC, 0x00, 0x02, 0xF8, 0x1F, 0x40, 0x00, 0xF4, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x5B, 0xFC,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xE0, 0x15, 0x00, 0x07, 0xF4, 0x7F, 0xE0, 0x02, 0xFC, 0xBF, 0xFC, 0x00, 0xBF, 0xBF, 0xFF, 0x40,
-    0x3F, 0xFD, 0x2F, 0xC0, 0x0F, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x03, 0xF8, 0x02, 0xFF, 0x01, 0xFD,
-    0x00, 0xFF, 0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x0B, 0xF4, 0x07,
-    0xF4, 0x03, 0xFD, 0x02, 0xFD, 0x74, 0xFF, 0x00, 0xFF, 0xFD, 0x3F, 0xC0, 0x3F, 0xFE, 0x1F, 0xD0,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xAF, 0xFA, 0xAA, 0xAF, 0xFA, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x17, 0xFF, 0x55, 0x57, 0xFE, 0x50, 0x00, 0x0F, 0xF4,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00, 0xBF, 0x1F, 0xFF, 0x00,
-    0x3F, 0xDF, 0xFF, 0xD0, 0x0F, 0xEF, 0x8F, 0xF0, 0x03, 0xFF, 0x43, 0xFC, 0x01, 0xFF, 0x80, 0xFF,
-    0x00, 0xBF, 0xC0, 0x7F, 0x80, 0x3F, 0xE0, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x07, 0xFC, 0x03,
-    0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xBF, 0x5D, 0x3F, 0xC0, 0x3F, 0xFF, 0x4F, 0xF0,
-    0x0F, 0xFF, 0x87, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x07, 0xF8, 0x2C, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0x6F, 0xFC, 0x00, 0x0D, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xA0, 0x14, 0x0F, 0xFC,
-    0x3C, 0x1F, 0xFF, 0xFC, 0x2E, 0x2F, 0xF4, 0x08, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x5B, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x7F, 0x40, 0x00, 0xBF, 0x5D, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xE1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFF, 0x80, 0x3F, 0xFF,
-    0x00, 0x5B, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xBF,
-    0x40, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x74, 0x0B, 0xFF, 0xD0, 0x2F,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x1C,
-    0x00, 0x0F, 0xD1, 0xBC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x3C, 0x00, 0xA1, 0xFD, 0x1F,
-    0x43, 0xFF, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2F, 0xF8,
-    0x03, 0xFF, 0xF0, 0x05, 0xBF, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xD7, 0x40, 0xBF,
-    0xFD, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF8, 0x3F, 0xFF, 0x05, 0xBF, 0x80, 0x1F, 0xD0, 0x0B, 0xF0,
-    0x03, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFD, 0x74,
-    0xBF, 0xFD, 0x2F, 0xFE, 0x07, 0xFD, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2E, 0x00, 0x0F, 0xC0, 0x03,
-    0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00,
-    0x00, 0x50, 0x2F, 0xF8, 0xFF, 0xFC, 0x5B, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0,
-    0x2F, 0xD0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x5D, 0xBF, 0xFD, 0xBF, 0xF8, 0x7F, 0xD0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F,
-    0xE0, 0x01, 0x90, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x40, 0x2F,
-    0xF8, 0x07, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xFE, 0x05, 0xBF, 0x80, 0x5B, 0xF4, 0x01, 0xFD, 0x00,
-    0x2F, 0xD0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x07, 0xF4,
-    0x00, 0x3F, 0xC0, 0x2F, 0xD7, 0x41, 0xFE, 0x00, 0xBF, 0xFD, 0x0B, 0xF4, 0x02, 0xFF, 0xE0, 0x3F,
-    0xC0, 0x07, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xAF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x0B, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0D, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x07,
-    0xE0, 0x2E, 0x00, 0x00, 0x24, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x24, 0x0B, 0xF4, 0x00,
-    0x07, 0xE6, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x01,
-    0xFF, 0x90, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0x6F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x50, 0x01,
-    0xFC, 0x2F, 0xF0, 0x07, 0xF3, 0xFF, 0xE0, 0x2F, 0xBE, 0x7F, 0xC0, 0xFF, 0xD0, 0xBE, 0x03, 0xFD,
-    0x03, 0xF4, 0x1F, 0xE0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC, 0x03, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0xBF, 0x40, 0x02, 0xFC, 0xBF, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x3F, 0xC1, 0xFF, 0xE4,
-    0xFE, 0x02, 0xFF, 0xE7, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x1F, 0xFD, 0x01, 0xFE, 0x3F, 0xFE,
-    0x0B, 0xFF, 0x16, 0xFD, 0x1F, 0xFE, 0x01, 0xFC, 0x7F, 0x58, 0x01, 0xFC, 0xF8, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x0B, 0xF3,
-    0xF4, 0x00, 0x0F, 0xF1, 0xFC, 0x04, 0x0F, 0xE0, 0xFF, 0x5E, 0x1F, 0xD0, 0xBF, 0xFD, 0x2F, 0xD0,
-    0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0x90, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01,
-    0xFF, 0xEB, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x05, 0xBF, 0x80, 0x00, 0x7F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xDB, 0x00, 0x3F, 0xFF,
-    0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC,
-    0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x1F, 0xFE, 0x03, 0xFF, 0xF0, 0x16, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0x6C, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xD0,
-    0x00, 0xFC, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xFC, 0x7E, 0x00, 0x3F,
-    0xFF, 0xF2, 0xF0, 0x00, 0x1F, 0xF8, 0x0F, 0x80, 0x00, 0x3F, 0xD0, 0x3C, 0x00, 0x01, 0xFF, 0x00,
-    0x50, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x01, 0xFF, 0x00, 0x0F,
-    0x80, 0x0B, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0xE0, 0x03, 0xF4, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x01, 0x40, 0x7F, 0xF8, 0x3E,
-    0x0F, 0xFF, 0xC7, 0xE0, 0x5B, 0xF8, 0xBD, 0x00, 0x7F, 0x4F, 0xC0, 0x0B, 0xF0, 0xF4, 0x00, 0xFF,
-    0x0F, 0x00, 0x0F, 0xF0, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x7C, 0x00, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xA0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x19, 0x00, 0x1F, 0xF0, 0x00, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xE0, 0x03, 0xFE,
-    0x00, 0x3F, 0x40, 0x1F, 0xFE, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x5B, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x0F, 0x80, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x7F, 0xC0, 0x7F,
-    0x43, 0xF4, 0x0B, 0xF0, 0x14, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x03, 0xFD, 0xB0, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x86, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xF9, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0xFB, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x90, 0x07, 0xFC, 0x00, 0x3E, 0x00, 0xBF, 0xC0,
-    0x07, 0xE0, 0x0F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xEB, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0x6F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0xBC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF6, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF,
-    0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00,
-    0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF,
-    0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00,
-    0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF,
-    0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F,
-    0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF, 0xF0, 0x16, 0xFE,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F, 0xF0, 0x1F, 0xD0,
-    0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0, 0x0F, 0xFF, 0xC2,
-    0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4,
-    0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-    0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00,
-    0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82,
-    0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90,
-    0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x01, 0xFF, 0xE0, 0xBF, 0xD0, 0x3F, 0xFE, 0x3F, 0xFF,
-    0x01, 0x6F, 0xEF, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0xFF, 0x00, 0x1F, 0xFC, 0x0F, 0xE0, 0x02, 0xFF,
-    0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x7F, 0x80,
-    0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x0F, 0xF2, 0xC1, 0xFE, 0x00,
-    0xFF, 0xFC, 0x2F, 0xD0, 0x0F, 0xFF, 0x43, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x3F, 0x00, 0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00,
-    0x07, 0xF0, 0xFF, 0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE,
-    0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07,
-    0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x7F, 0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF,
-    0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x1F, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xE3, 0xFF,
-    0xF0, 0x16, 0xFE, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x2F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8,
-    0x00, 0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x2C, 0x1F, 0xE0,
-    0x0F, 0xFF, 0xC2, 0xFD, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x50, 0x01, 0x50, 0x07, 0xF0, 0xBF, 0xE0, 0xBF, 0xD0, 0x3E, 0x0F,
-    0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x15, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xFC, 0x00,
-    0x00, 0x1F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0x40, 0x00, 0x03, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFD, 0x01,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xCB, 0x00, 0x00, 0xFF,
-    0x00, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7,
-    0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82, 0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00,
-    0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F,
-    0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x50, 0x1F, 0xFE, 0x0B, 0xFD, 0x3F, 0xFE, 0x3F, 0xFF, 0x16, 0xFE, 0xFF, 0xFF, 0x01, 0xFF,
-    0xF0, 0xFF, 0x01, 0xFF, 0xC0, 0xFE, 0x02, 0xFF, 0x01, 0xFD, 0x03, 0xFE, 0x02, 0xFD, 0x03, 0xFC,
-    0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0B, 0xF4, 0x07, 0xF8, 0x0F, 0xF0, 0x0B, 0xF4, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x0F, 0xF0, 0x2F, 0xD0, 0x1F, 0xD0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x80, 0xFF, 0x00, 0x02, 0xF6, 0xFD, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xAE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFD,
-    0x00, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xE0,
-    0x1F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC,
-    0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8,
-    0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x00, 0x28, 0x00, 0x00, 0x07, 0xF4, 0x7D, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x7F,
-    0xD0, 0x00, 0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x0D, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B, 0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x2C, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xC7, 0xFD, 0x00,
-    0x00, 0x7F, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0xD0, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF4, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x01,
-    0xFF, 0x43, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x80, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03, 0xF8, 0xFE, 0x00,
-    0x02, 0xF8, 0xBF, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0xF8, 0x2E, 0x00, 0x00, 0x04, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0x6F, 0xF4, 0x01, 0xFE, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
-    0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x02, 0xFF, 0xAF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x6B, 0xFE, 0xAA, 0xFD, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x00,
-    0x2F, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x02, 0xD0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x01, 0xFF, 0x56, 0xA0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x03,
-    0xD0, 0x2F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x05, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xD7, 0xFF, 0xFC, 0x02,
-    0xFF, 0x6F, 0xFF, 0xD3, 0xFC, 0x07, 0xF8, 0x0B, 0xFF, 0x02, 0xFC, 0x0F, 0xF0, 0x07, 0xFD, 0x03,
-    0xF8, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0x03, 0xF8, 0x3F, 0xC0, 0x3F, 0xC0, 0x07,
-    0xFA, 0xFE, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF4, 0x00, 0xB0, 0x3F, 0xD0, 0x7F, 0xFC, 0x07, 0xF0, 0x2F, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xAF, 0xF4,
-    0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x80,
-    0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0x1F, 0xF9, 0x02, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0x0F, 0xFF, 0x8F, 0xFC, 0x15, 0xFD,
-    0xBF, 0xF0, 0x03, 0xF7, 0xFB, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00,
-    0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x03,
-    0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF,
-    0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC, 0x00, 0x1F, 0xF9,
-    0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x07, 0xFF, 0x83, 0xFC,
-    0x0F, 0xFF, 0x8F, 0xFC, 0x05, 0x7F, 0x6F, 0xFC, 0x00, 0x3F, 0x7F, 0xB4, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xAF, 0xF4, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0B,
-    0xFC, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF9, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x3F, 0xFD, 0x3F, 0xFF, 0xF0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0,
-    0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x01, 0xFF, 0xE0, 0xFF, 0x0F,
-    0xFF, 0x8F, 0xFC, 0x15, 0xFD, 0xBF, 0xF0, 0x03, 0xF7, 0xFB, 0x40, 0x1F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4,
-    0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF0, 0x01, 0xFD, 0x5F, 0xC0, 0x0B, 0xF0, 0x09, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x1F,
-    0x00, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFF, 0xAF, 0xD0, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x02, 0xFD, 0x07, 0xD0,
-    0x00, 0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0,
-    0x0F, 0xC0, 0x1F, 0xF0, 0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC,
-    0x0F, 0xF4, 0x03, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0xFC, 0x07, 0xC0, 0x01, 0x80, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0x57, 0xF0, 0x02, 0xFC, 0x02, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0xEB, 0xF4, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x1F, 0xF0,
-    0x03, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0xF4, 0x00, 0xBF, 0xC0, 0x7D, 0x00, 0x1F, 0xF0, 0x2F, 0x80, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFE,
-    0x03, 0xFF, 0xEF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD5, 0xFC, 0x02, 0xFC,
-    0x02, 0x40, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x01, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF, 0xAF,
-    0xD0, 0x2F, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xBC, 0x00, 0x07, 0xE0,
-    0x3F, 0x80, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x5B, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x1F,
-    0xF0, 0x03, 0xF0, 0x01, 0xFF, 0x00, 0x3D, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFC, 0x01, 0xF4, 0x00, 0x7F, 0xC0,
-    0x2F, 0x80, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0xBC, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x01, 0xFD, 0x5F, 0xC0, 0x02,
-    0xFC, 0x02, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x3F, 0xFA, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01,
-    0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x01, 0x90, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x0B, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF,
-    0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x2E, 0x00, 0x03, 0xF8, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1B,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0A, 0xBF, 0xEA, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x07, 0x00, 0x0F, 0xF5, 0xBD, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC, 0x3F,
-    0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18, 0x03,
-    0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x01, 0xC0, 0x3F, 0xD6, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x3C, 0x00,
-    0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xD0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x07,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00,
-    0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xC0,
-    0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x04, 0x00, 0x00, 0x7F, 0xC3, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x00, 0xF0, 0xFF, 0x80, 0x00, 0x05, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0,
-    0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F,
-    0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x07, 0xFE, 0x00,
-    0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F,
-    0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8,
-    0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0,
-    0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x0F, 0x40, 0x1C, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD,
-    0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xD0, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0xF8,
-    0x01, 0xC0, 0x00, 0x0F, 0xD1, 0xBC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00,
-    0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF,
-    0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC,
-    0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xEB, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF,
-    0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0xF0,
-    0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xB4, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
-    0x00, 0x02, 0x80, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F,
-    0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B,
-    0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0xA0, 0x00, 0x00, 0xBD,
-    0x1F, 0x40, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0xBD, 0x2F, 0x80, 0x00,
-    0x0F, 0x43, 0xD0, 0x00, 0x00, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x50, 0x1F, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0xE0, 0x0F, 0xF0, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x1F,
-    0xC0, 0x2F, 0xD0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF8,
-    0x00, 0xBF, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xD0,
-    0xBF, 0xF0, 0x42, 0xFC, 0x2F, 0x7F, 0x7C, 0x2F, 0xFF, 0xCB, 0xFF, 0xC2, 0xFF, 0xF0, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF,
-    0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC,
-    0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x40, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x07,
-    0xC0, 0x1F, 0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xF0, 0x07, 0xFF, 0xF0, 0x7F, 0xE0, 0x01, 0xFD, 0x00,
-    0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x07, 0xF0,
-    0x00, 0xBF, 0x80, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x1F, 0xFD, 0x01, 0xFC, 0x00, 0x0B,
-    0xF8, 0x0F, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xFE, 0x07, 0xEF, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x83,
-    0xF3, 0xF8, 0x3F, 0x80, 0x00, 0x0F, 0xE1, 0xF8, 0xBE, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0xFC, 0x2F,
-    0x8F, 0xE0, 0x00, 0x00, 0xFF, 0x7E, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0x41, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x01, 0x40, 0x05, 0x02, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0xBF, 0xF8, 0x0F, 0xF0,
-    0x2F, 0xD5, 0xBF, 0xC0, 0xBF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xD0, 0x1F, 0xD0, 0x7F,
-    0x80, 0xFC, 0x00, 0xFD, 0x0B, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0xFF, 0xC2, 0xF4, 0x00, 0xFE, 0x1F,
-    0xFC, 0x3F, 0x00, 0x0B, 0xE3, 0xFF, 0xC7, 0xE0, 0x00, 0xBF, 0x7D, 0xFC, 0xFC, 0x00, 0x07, 0xFF,
-    0x8F, 0xEF, 0x40, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
-    0x40, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xD0, 0x00, 0x00,
-    0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC,
-    0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xC3,
-    0xE0, 0x00, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00,
-    0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00,
-    0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1A, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x7F,
-    0x8F, 0xF4, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xF4, 0x03,
-    0xFC, 0x00, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x0B,
-    0xC0, 0x07, 0xFE, 0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x64, 0x00, 0xBF,
-    0xD0, 0x03, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0xAA, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x1F, 0xFD, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xF4, 0x1F, 0x41, 0xFF, 0x40, 0x7C, 0x03, 0xF4, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xD0, 0x3F,
-    0xE5, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x1F, 0xEF, 0xFF, 0xF4, 0x3F, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xEA, 0xAB, 0xFF, 0x40, 0xBE, 0x00, 0x2F, 0xF8, 0x02, 0xF0, 0x01, 0xFF, 0x80,
-    0x07, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x19, 0x00, 0x2F, 0xF4, 0x00, 0xFC, 0x02,
-    0xFF, 0x80, 0x07, 0xF0, 0x1F, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xEA, 0xBF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x01, 0xFF, 0xD1, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x41, 0xF4, 0x1F, 0xF4, 0x07, 0xC0, 0x3F, 0x40, 0x05, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x2D, 0x03, 0xFE, 0x51, 0xFC, 0x3F, 0xFF, 0xFF, 0xF1, 0xFE, 0xFF, 0xFF, 0x43, 0xF0,
-    0x7F, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x02, 0xF8, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02,
-    0xF8, 0x00, 0xBF, 0xE0, 0x0B, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x64, 0x00, 0xBF, 0xD0, 0x03, 0xF0, 0x0B, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00,
-    0xFF, 0x03, 0xFF, 0xAA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xE0, 0x02, 0xF0, 0x3F,
-    0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x1F, 0xFD, 0x1F, 0xC0, 0xFF,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF4, 0x1F, 0x41, 0xFF, 0x40, 0x7C, 0x03, 0xF4, 0x00, 0x50, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x02, 0xD0, 0x3F, 0xE5, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF, 0x1F, 0xEF, 0xFF, 0xF4, 0x3F,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x00,
-    0xFE, 0x02, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x4B, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x06, 0xA4, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4,
-    0x00, 0x01, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x40,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x05, 0x40, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x6F,
-    0xF4, 0x00, 0x7F, 0x80, 0xBF, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x2F,
-    0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x94,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xE7, 0xFD, 0xBF, 0xF8,
-    0x3F, 0x47, 0xFC, 0x0F, 0xFC, 0x2F, 0x0B, 0xF8, 0x07, 0xFC, 0x05, 0x0F, 0xF4, 0x07, 0xFC, 0x00,
-    0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F,
-    0xE0, 0xBF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xE9,
-    0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x40, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x01, 0x50, 0x00, 0x02, 0xF8, 0x7F, 0xE0,
-    0x00, 0x0F, 0xD7, 0xFF, 0xD0, 0x00, 0x3F, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xD1, 0xFE, 0x00, 0x0B,
-    0xFD, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x02,
-    0xFD, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x0F, 0xE0, 0x2F, 0xE0, 0x00, 0x7F, 0xFB, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFB,
-    0xFD, 0x00, 0x00, 0x3F, 0x81, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xAA,
-    0xAA, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0x06, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xAF, 0xFA, 0x90, 0x0B, 0xF4, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x03, 0x80, 0x3F, 0xD7, 0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0xF0, 0xFC, 0x00, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFE, 0xFF, 0xEB, 0xFD, 0x3F, 0xC0, 0xFF,
-    0x80, 0xFD, 0x3F, 0x80, 0xFF, 0x40, 0xFC, 0x2F, 0x80, 0xFF, 0x00, 0xF8, 0x05, 0x41, 0xFF, 0x00,
-    0x90, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xF8,
-    0x7D, 0x00, 0x2F, 0xC0, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x06, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xAF, 0xFA, 0x90, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x01, 0xC0, 0x03, 0xFD, 0x6F, 0x40, 0x0F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0xFF, 0xAB, 0xFC,
-    0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE, 0x02, 0xF0, 0x18,
-    0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x81, 0x00, 0x00, 0x00, 0xBF, 0x83, 0x80, 0x00, 0x00,
-    0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x1B, 0xF4, 0x1F, 0xFD, 0x00, 0xBF, 0xF4,
-    0x0F, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x00,
-    0x2F, 0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xFC, 0x00, 0x01,
-    0xFD, 0x0B, 0xFF, 0x04, 0x00, 0xBF, 0x0B, 0xDF, 0xDF, 0x00, 0x2F, 0xFF, 0xCB, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x03, 0xF0, 0x0F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x1F, 0x40, 0x08, 0x01, 0x40, 0x3D,
-    0x0B, 0xE1, 0xFD, 0x3F, 0x8B, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x02, 0xFE, 0x00, 0x1F,
-    0xFC, 0x00, 0xFE, 0xF8, 0x0F, 0xC3, 0xF0, 0xFC, 0x03, 0xC1, 0x80, 0x05, 0x00, 0x0A, 0x80, 0x83,
-    0xFE, 0x1F, 0xBF, 0xFF, 0xFF, 0x4B, 0xFC, 0x20, 0x2E, 0x00, 0x3F, 0xFF, 0xDB, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xC0, 0x04, 0x00, 0x07, 0xC0, 0x0E, 0xBF, 0x47, 0xD7, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x15,
-    0x00, 0x06, 0x42, 0xFC, 0x3F, 0xC3, 0xF8, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0xBF, 0x0F,
-    0xFF, 0xF0, 0xFD, 0x78, 0x0B, 0x40, 0x00, 0x50, 0x07, 0xFF, 0x43, 0xFB, 0xF1, 0xF0, 0xFC, 0x14,
-    0x3E, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x3D, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F,
-    0xFD, 0x78, 0x2E, 0xB4, 0x1E, 0xB8, 0x3D, 0x7F, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xC0, 0x30, 0x03, 0xF0, 0xFC, 0x0B, 0xE2, 0xFC, 0x1F, 0xC7, 0xF0, 0x3F, 0x0F, 0xC0, 0xBC,
-    0x1F, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xC3, 0xD0, 0xBD, 0x0F, 0xCB, 0xD0,
-    0x1F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x00, 0x08, 0x08, 0x0F, 0x0F, 0x87,
-    0xD3, 0xF0, 0xFC, 0xBC, 0x1F, 0x0F, 0x83, 0xD1, 0xE0, 0x20, 0x20, 0x00, 0x64, 0x00, 0xBF, 0xF8,
-    0x3F, 0xFF, 0xCB, 0xD0, 0xFD, 0xA0, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x90, 0x7C, 0x0F, 0x43, 0xF0,
-    0x7E, 0x0B, 0xE0, 0xBF, 0x03, 0xE0, 0x01, 0x40, 0x3F, 0xC0, 0x7F, 0x40, 0xFC, 0x07, 0xF0, 0x2F,
-    0x01, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x01, 0x41, 0xFD, 0x3F, 0x87, 0xF0, 0x7E, 0x03, 0xE0, 0x3F,
-    0x00, 0xF4, 0x00, 0x00, 0x0B, 0x43, 0xF1, 0xF8, 0xBC, 0x3E, 0x0F, 0x03, 0x80, 0x00, 0x01, 0x40,
-    0xFD, 0x0F, 0xD0, 0xFC, 0x3F, 0x47, 0xD0, 0x60, 0x00, 0x06, 0x42, 0xFC, 0x3F, 0xC3, 0xF8, 0x19,
-    0x00, 0x04, 0x00, 0x43, 0xF0, 0xBE, 0xBF, 0x0F, 0xFF, 0xF0, 0xFD, 0x24, 0x06, 0x00, 0x01, 0x90,
-    0x0F, 0xF8, 0x3D, 0x3C, 0x3C, 0x2C, 0x3C, 0x3C, 0x2F, 0xF4, 0x06, 0x40, 0x02, 0x41, 0xFC, 0x0F,
-    0xC0, 0xFC, 0x1F, 0x07, 0xD0, 0x50, 0x00, 0x01, 0x90, 0x1F, 0xE0, 0x1F, 0xC0, 0x3E, 0x03, 0xF0,
-    0x7F, 0x01, 0x90, 0x00, 0x01, 0x40, 0xE0, 0x3C, 0x0B, 0x80, 0xF8, 0x0F, 0xFE, 0x7F, 0xC0, 0x00,
-    0x05, 0x47, 0xE2, 0xF8, 0xFD, 0x3F, 0x1F, 0xCB, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x0F, 0xFC, 0x00, 0xFF, 0xFC, 0x0F, 0xD2, 0xF4, 0xFD, 0x03, 0xE1, 0x40, 0x01, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x01, 0x7D, 0x01, 0xDB, 0xFA, 0xFC, 0x3F, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x42, 0xFD, 0x0F, 0x7F, 0xFB, 0xFF, 0x8F, 0xFD, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0xDB, 0xFF, 0xFD, 0x7F, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0xBF, 0xF8, 0x2F, 0xFF, 0xD7, 0xD0,
-    0xBE, 0xA0, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x80, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xF1, 0xFE,
-    0x3F, 0xC7, 0xF0, 0xFE, 0x06, 0x00, 0x90, 0x3E, 0x07, 0xD0, 0xBD, 0x0B, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02,
-    0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x5A, 0xA4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3A, 0xFF, 0x4B, 0xFE, 0x00, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x02, 0xFD, 0x01, 0xFD, 0x00,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x3F, 0xFA, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF,
-    0x80, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF, 0x80, 0x1F,
-    0xFA, 0xAF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xAB, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x7F, 0x80, 0x00, 0x01,
-    0xFC, 0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xD0,
-    0x2F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x0F,
-    0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0x0B, 0xF8,
-    0x1F, 0xE0, 0x00, 0x0B, 0xFC, 0x3F, 0xFE, 0xAA, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01,
-    0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0,
-    0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x7F, 0xAA, 0xAF, 0xFD, 0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x0B, 0xC0, 0x07, 0xFE, 0x00,
-    0x1F, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x64, 0x00, 0xBF, 0xD0, 0x03, 0xF0, 0x0B,
-    0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0x03, 0xFF, 0xAA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xEA, 0xFF, 0xF0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x3F,
-    0xE0, 0x00, 0x03, 0xFD, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x8B, 0xFC, 0x1A, 0xAA, 0x3F, 0xD3, 0xFE,
-    0x2F, 0xFF, 0x8F, 0xF4, 0xFF, 0x8F, 0xFF, 0xC7, 0xFD, 0x3F, 0xE1, 0x00, 0x02, 0xFF, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4,
-    0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00,
-    0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xF5,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD7, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0xBF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x90, 0x1F, 0xFE, 0x00, 0x1F,
-    0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x40,
-    0x00, 0x00, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFE, 0x00,
-    0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x1F, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xEF, 0xC0, 0x00, 0x0B, 0xDB, 0xF0, 0x2F,
-    0x7F, 0xC0, 0x00, 0x0F, 0xCB, 0xF0, 0x3E, 0x3F, 0xC0, 0x00, 0x0F, 0xC7, 0xF4, 0xFC, 0x3F, 0xC0,
-    0x00, 0x2F, 0x83, 0xF9, 0xF8, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xFB, 0xF0, 0x3F, 0x80, 0x00, 0x3F,
-    0x03, 0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x7E, 0x02, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0xFD, 0x02, 0xFF,
-    0x40, 0x7F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xBF,
-    0x40, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x50, 0x01, 0xFF, 0xD0, 0x3F,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xF4,
-    0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xE0,
-    0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0x00, 0x00,
-    0x3F, 0xBF, 0xF0, 0x1F, 0xC0, 0x00, 0x0F, 0xD7, 0xFD, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0xFF, 0x82,
-    0xF8, 0x00, 0x02, 0xFC, 0x1F, 0xF0, 0xFD, 0x00, 0x00, 0xBE, 0x03, 0xFE, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0xBF, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x02, 0xFF, 0xF8,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0x90,
-    0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x01, 0x40, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B,
-    0xFC, 0x00, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x01,
-    0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x90, 0x07, 0xFF, 0x40, 0x01,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x5A,
-    0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFB, 0xFE, 0x6F,
-    0xFC, 0x00, 0x03, 0xFC, 0x0B, 0xFD, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFC, 0x03, 0xFE,
-    0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x1F, 0xF0, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xEA, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF5, 0x5A, 0xFD, 0x00, 0x7F, 0xD0, 0x02, 0xF0, 0x00, 0xBF,
-    0xC0, 0x0B, 0xC0, 0x00, 0xFF, 0x40, 0x2D, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0x7F, 0x80,
-    0x07, 0xE0, 0x07, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x01, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA,
-    0xFF, 0xAB, 0xFC, 0x3F, 0x01, 0xFF, 0x01, 0xFC, 0x3F, 0x02, 0xFF, 0x01, 0xF4, 0x3E, 0x02, 0xFE,
-    0x02, 0xF0, 0x18, 0x03, 0xFD, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0xA0, 0x1F, 0xF8, 0x00,
-    0x07, 0xFC, 0xBF, 0xFC, 0x00, 0x0F, 0xFC, 0xAB, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x47, 0xF4, 0x00,
-    0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xAF, 0xFB, 0xFF, 0x00, 0xBF, 0xC1, 0xFE, 0x0F, 0xF8, 0x1F, 0xF0, 0x2F,
-    0xD0, 0x7F, 0xC3, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC3, 0xFC, 0x07,
-    0xF8, 0x07, 0xFC, 0x3F, 0xC0, 0x7F, 0x40, 0xFF, 0x43, 0xFD, 0x0B, 0xF0, 0x2F, 0xF0, 0x2F, 0xF4,
-    0xFF, 0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x87, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00,
-    0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFF, 0x02,
-    0xFF, 0xFE, 0x07, 0xFC, 0x7F, 0x83, 0xFF, 0xFC, 0x0F, 0xF0, 0x7F, 0x80, 0x7F, 0xD0, 0x2F, 0xE0,
-    0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x3F, 0x80, 0xBF, 0x40,
-    0xBF, 0x40, 0x3F, 0x80, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xFF, 0x01, 0xFE, 0x00, 0x3F, 0x81,
-    0xFF, 0x02, 0xFC, 0x00, 0x3F, 0xC1, 0xFE, 0x07, 0xF8, 0x00, 0x3F, 0xD2, 0xFD, 0x1F, 0xF0, 0x00,
-    0x2F, 0xFB, 0xFE, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0x8B, 0xF0, 0x01,
-    0xFE, 0x1F, 0x3E, 0x0F, 0xD0, 0x1F, 0xE0, 0xBC, 0xF8, 0x0F, 0xC1, 0xFD, 0x03, 0xE7, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x00,
-    0x01, 0x50, 0x05, 0x00, 0x01, 0xFF, 0xC0, 0xF8, 0x00, 0xBF, 0xFF, 0x1F, 0xC0, 0x2F, 0xFB, 0xF7,
-    0xF8, 0x07, 0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xE0, 0x0B, 0xFC, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x03, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xD2, 0xFF, 0xF1, 0xC2, 0xFF, 0xFF, 0x6F, 0xFD, 0x0F, 0xFF,
-    0xD1, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xD1, 0xFE, 0x00, 0x0F, 0xE0,
-    0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xF4, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0xBF,
-    0x00, 0xFD, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x03, 0xF8, 0xBF, 0xD0, 0x01,
-    0xFD, 0x1F, 0xFC, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x1F, 0xD0, 0x2F, 0xD0, 0x0F,
-    0xF0, 0x0B, 0xFE, 0xAF, 0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x81,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40,
-    0xBF, 0xD0, 0x3F, 0xD7, 0xFF, 0xC0, 0xFF, 0x9A, 0xFF, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x0B,
-    0xF4, 0x1F, 0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x03, 0xFC,
-    0xBE, 0x00, 0x0B, 0xF3, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x79,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x2F, 0x82, 0xFC, 0x00, 0x0F, 0xD0, 0x1F, 0x00, 0x03, 0xF8, 0x02, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x0F, 0xF4, 0x03, 0xFC, 0x02, 0xFE, 0x02, 0xFE,
-    0x00, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x02, 0xFD, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x2F, 0xFA, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xE5, 0xBC, 0x03, 0xF8, 0x01, 0x40, 0x3F, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0x94, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0x03, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x14, 0x0B, 0xF0, 0x0F, 0xC0,
-    0xBF, 0x87, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x54,
-    0x00, 0x50, 0x1F, 0xFE, 0x0B, 0xFC, 0x3F, 0xFE, 0x3F, 0xFD, 0x16, 0xFE, 0xFF, 0xFD, 0x01, 0xFF,
-    0xE2, 0xFD, 0x01, 0xFF, 0x82, 0xFD, 0x02, 0xFF, 0x03, 0xFC, 0x03, 0xFE, 0x03, 0xFC, 0x03, 0xFC,
-    0x03, 0xFC, 0x07, 0xF8, 0x07, 0xF8, 0x0B, 0xF4, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x0F, 0xE0, 0x2F, 0xD0, 0x1F, 0xD0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xD7, 0xFC, 0x00, 0xFE, 0x02, 0xFD, 0x03, 0xFC,
-    0x01, 0xFE, 0x07, 0xF4, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0xFF, 0x1F, 0xD0,
-    0x00, 0xFF, 0x3F, 0xFA, 0xAB, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0x80,
-    0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x07, 0xF4, 0x7F, 0x80, 0x0F, 0xF0, 0x7F, 0x80,
-    0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD0, 0xBF, 0x40, 0x1F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xFC, 0x0B, 0xF8,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0, 0x2F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80,
-    0x7F, 0x40, 0xBF, 0x4D, 0xFF, 0xFD, 0xFF, 0xF8, 0x7F, 0xD0, 0x04, 0x00, 0x00, 0x14, 0x00, 0x05,
-    0x07, 0xFF, 0x80, 0x2F, 0xF3, 0xFF, 0xE0, 0x2F, 0xFC, 0x5B, 0xF4, 0x2F, 0xFE, 0x01, 0xFC, 0x2F,
-    0xD0, 0x00, 0x7F, 0x1F, 0xD0, 0x00, 0x2F, 0x8F, 0xF0, 0x00, 0x0F, 0xDB, 0xFC, 0x00, 0x03, 0xF7,
-    0xFE, 0x00, 0x01, 0xFF, 0xDF, 0x40, 0x00, 0xBF, 0xD7, 0xD0, 0x00, 0x3F, 0xE1, 0xF8, 0x00, 0x0F,
-    0xF0, 0xBF, 0x0B, 0x07, 0xF4, 0x1F, 0xFF, 0xC2, 0xFC, 0x03, 0xFF, 0xC0, 0xFD, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x01, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x2F, 0xBF, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0xC3,
-    0xF0, 0x00, 0x07, 0xF4, 0x3F, 0x40, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x3F, 0xD0, 0x3F, 0x9A, 0x0F,
-    0xF8, 0x03, 0xFF, 0xE3, 0xFF, 0x00, 0x3F, 0xFC, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x1F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x00,
-    0xBF, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFE,
-    0x00, 0xFF, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x5F,
-    0xFF, 0x0D, 0x03, 0xFF, 0xFF, 0x7F, 0xFD, 0x03, 0xFF, 0xFD, 0x2F, 0xF8, 0x07, 0xEF, 0xF4, 0x0F,
-    0xE0, 0x0B, 0xE0, 0x40, 0x01, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3A,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0xBF, 0xD0, 0x3F, 0xD7, 0xFF, 0xC0, 0xFF, 0x9A,
-    0xFF, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x07, 0xF4, 0x1F, 0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0x3F,
-    0x82, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x03, 0xFC, 0xBE, 0x00, 0x0B, 0xF3, 0xF0, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x60, 0x3F, 0x86,
-    0xFD, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFA, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFC, 0x01, 0xFF, 0xA5, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x01,
-    0xFF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0x07,
-    0xFF, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0x00, 0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE, 0x00, 0x3F,
-    0xCB, 0xF4, 0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F,
-    0xF0, 0x07, 0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xF8, 0x0E, 0x0F, 0xC1, 0xF8, 0x00, 0x10, 0x7E,
-    0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xE0,
-    0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0xFE, 0x07, 0xF4, 0x00, 0x0B,
-    0xF4, 0x2F, 0xE2, 0x80, 0x7F, 0xC0, 0xBF, 0xFE, 0x03, 0xFD, 0x02, 0xFF, 0xF0, 0x1F, 0xE0, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0x9F, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xC0, 0x1F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFE, 0x00,
-    0x3F, 0xC0, 0x3F, 0x80, 0x1F, 0xD0, 0x1F, 0xD0, 0x0F, 0xF0, 0x0B, 0xF8, 0x0B, 0xF4, 0x02, 0xFF,
-    0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0x40, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x07, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xF8, 0x0B, 0xFE, 0xFD, 0x07, 0xF8, 0x0B, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFD, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x1F, 0xE0, 0x07, 0xF4,
-    0x02, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x02, 0xFF, 0xAF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x2F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0xF4, 0x3F, 0x40,
-    0x01, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x78, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
-    0x05, 0x40, 0xBF, 0xF0, 0x7F, 0x8B, 0xFF, 0xC0, 0xFF, 0x15, 0xFE, 0x02, 0xFD, 0x03, 0xF4, 0x07,
-    0xF4, 0x2F, 0xC0, 0x1F, 0xD0, 0xFF, 0x00, 0x7F, 0x43, 0xF8, 0x02, 0xFC, 0x1F, 0xD0, 0x0F, 0xF0,
-    0xBF, 0x00, 0x3F, 0x83, 0xFC, 0x02, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x3F, 0xC1, 0xFF, 0x00, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x15, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xD0, 0x01, 0xFE, 0x07, 0xFF, 0xF4, 0x03, 0xF8, 0x0F,
-    0xE7, 0xFC, 0x0F, 0xF0, 0x2F, 0x82, 0xFC, 0x1F, 0xD0, 0x3F, 0x41, 0xFD, 0x2F, 0xC0, 0x7F, 0x01,
-    0xFD, 0x3F, 0xC0, 0xBF, 0x01, 0xFD, 0x3F, 0x80, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xFE, 0x03, 0xFC,
-    0x3F, 0xC1, 0xFD, 0x07, 0xF4, 0x3F, 0xC2, 0xFC, 0x0F, 0xF0, 0x1F, 0xF2, 0xFC, 0x3F, 0xC0, 0x0F,
-    0xFF, 0xFE, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x01, 0x40, 0x07, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xFE, 0x01, 0xFE, 0x00,
-    0x5B, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0x3F,
-    0x6F, 0x80, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xD0, 0x00, 0x00, 0x7F, 0x3F,
-    0x80, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x3F, 0x82, 0xFD, 0x04, 0x02, 0xFC, 0x07, 0xFE, 0xF0,
-    0x1F, 0xE0, 0x0F, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xF4, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x14, 0x02, 0xFC, 0x15, 0x02, 0xFF,
-    0x80, 0xFF, 0x1F, 0xE2, 0xFF, 0xF0, 0x3F, 0x83, 0xFC, 0x57, 0xF8, 0x0F, 0xE0, 0xBF, 0x40, 0xFD,
-    0x07, 0xF4, 0x1F, 0xD0, 0xBF, 0x02, 0xFC, 0x07, 0xF4, 0x3F, 0x80, 0xFF, 0x01, 0xFD, 0x0F, 0xD0,
-    0x3F, 0x80, 0xBF, 0x07, 0xF0, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x0B, 0xF0, 0x0F, 0xE0, 0xBF, 0x02,
-    0xFC, 0x0B, 0xF0, 0x2F, 0xD0, 0xFF, 0x07, 0xF4, 0x07, 0xFD, 0x3F, 0x8B, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x07, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0x1F, 0xD0, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x01, 0x40, 0xBF, 0x02, 0xFC, 0x07, 0xF0,
-    0x2F, 0xD0, 0xFE, 0x03, 0xFC, 0x07, 0xF4, 0x7F, 0x40, 0xFE, 0x01, 0xFD, 0x3F, 0xC0, 0x3F, 0x40,
-    0xBF, 0x0F, 0xF0, 0x0F, 0xC0, 0x2F, 0xC3, 0xFC, 0x03, 0xE0, 0x0F, 0xE0, 0xFF, 0x02, 0xF8, 0x07,
-    0xF0, 0x3F, 0xC1, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFC, 0xFF, 0xFC,
-    0x00, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0xBF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC,
-    0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40,
-    0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F,
-    0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xBE, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x01,
-    0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xD5, 0x5F, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0x55, 0x56, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE4,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0xAF, 0x80, 0x00, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x81,
-    0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x7F, 0xF6, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x07, 0xF4, 0x07, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-    0x80, 0x3F, 0xC0, 0x7F, 0xD0, 0x0F, 0xF0, 0x3F, 0xF4, 0x03, 0xFC, 0x3E, 0xFE, 0xB8, 0xFF, 0xFF,
-    0x3F, 0xFE, 0x2F, 0xFF, 0x0F, 0xFE, 0x03, 0xFE, 0x01, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x43, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x07, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF4,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x55, 0x56, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF,
-    0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x7F, 0xFF, 0x40,
-    0x2F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0xF8, 0x00,
-    0x00, 0x0A, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x00,
-    0x1F, 0xFD, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0x03, 0xFC,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x7F, 0xD0,
-    0x00, 0x3F, 0xC0, 0xFF, 0xD0, 0x00, 0x3F, 0xC3, 0xEF, 0xEB, 0x80, 0x3F, 0xFF, 0xCF, 0xFF, 0x80,
-    0x2F, 0xFF, 0x0F, 0xFE, 0x00, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBF,
-    0x0B, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0xBC, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0,
-    0x00, 0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42,
-    0xFD, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF,
-    0x55, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01,
-    0xFD, 0x55, 0x5B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x60, 0xA0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x02, 0xFC, 0x0F,
-    0x80, 0x00, 0x28, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF,
-    0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF,
-    0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03,
-    0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA,
-    0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x3D, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0xC3, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x80, 0x00, 0x00, 0x01, 0xFE,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x07, 0x80, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00,
-    0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0x55, 0x56, 0xFE, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x06, 0x0F, 0x00, 0x00,
-    0x00, 0x7F, 0x8A, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x05, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0x9F, 0xFC,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xF4, 0x00,
-    0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x7F, 0xD0, 0x00, 0x3F, 0xC0, 0xFF, 0xD0, 0x00, 0x3F, 0xC3, 0xEF, 0xEB, 0x80, 0x3F, 0xFF,
-    0xCF, 0xFF, 0x80, 0x2F, 0xFF, 0x0F, 0xFE, 0x00, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x34, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0,
-    0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA4, 0x04, 0x00, 0x00, 0xFF, 0x87, 0x80, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x1E, 0x1F, 0xF0, 0x00, 0x01, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x0B, 0xF0, 0x3F, 0x00,
-    0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F,
-    0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F,
-    0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF5, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xD5, 0x55, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x02, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x1F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFD, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xEB,
-    0xD0, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x07, 0xF0, 0x1F, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x40,
-    0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07, 0xFD,
-    0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0,
-    0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x2D, 0x24, 0x34, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF,
-    0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x10, 0x80, 0x40, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x9F, 0xFC, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0,
-    0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0xFF,
-    0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F, 0xF8, 0x0F, 0xF8,
-    0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x08, 0x34, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x91, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x10, 0x70, 0x40, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x0F, 0xC0, 0xB8,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x40,
-    0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8, 0xBF, 0xFC, 0x3F,
-    0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x09, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x04, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x91, 0x80, 0x00, 0x00, 0x02, 0xF5, 0x6D, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00, 0x00, 0x01, 0xFC,
-    0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55, 0x5B, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFF,
-    0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0x9F, 0x80, 0x00, 0x02, 0xC3, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x12, 0xD0, 0x00, 0x00, 0x3C, 0x10, 0x70, 0x00,
-    0x0F, 0x80, 0xBC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x40, 0x01, 0xFF, 0xDB, 0xF0, 0x01, 0xFF, 0xFF,
-    0xF8, 0x01, 0xFF, 0x9F, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x00, 0xFF,
-    0x01, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0xD0, 0x0F, 0xF0, 0xFB, 0xFA, 0xE3, 0xFF, 0xFC, 0xFF, 0xF8,
-    0xBF, 0xFC, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x34, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0xE0, 0x00, 0x00,
-    0x01, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xF0, 0x00, 0x00,
-    0x00, 0xBE, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x55, 0x7F,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFD, 0x55,
-    0x5B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x02, 0xFF, 0x91, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xDB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0x40, 0x00, 0x3F, 0xFB, 0xD0, 0x00, 0x2E, 0x3F,
-    0xF0, 0x00, 0x03, 0x02, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x3E,
-    0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x07, 0xFF, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFE, 0x7F, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
-    0x40, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x07,
-    0xFD, 0x00, 0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xC3, 0xEF, 0xEB, 0x8F, 0xFF, 0xF3, 0xFF, 0xE2, 0xFF,
-    0xF0, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xD0, 0x00, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x07,
-    0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x55, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xF5, 0x55, 0x6F, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFE, 0x47, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x6F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0x40, 0x00,
-    0xFE, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x14, 0x00, 0x1F, 0xFD, 0xBF, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xF9, 0xFF, 0xC0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xF8, 0x03, 0xFC, 0x01,
-    0xFD, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0,
-    0x1F, 0xF4, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0F, 0xBF, 0xAE, 0x3F, 0xFF, 0xCF, 0xFF, 0x8B,
-    0xFF, 0xC3, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E,
-    0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xC0,
-    0xBF, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x00, 0x03,
-    0xF8, 0x00, 0xB0, 0x3F, 0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00,
-    0x00, 0x02, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0xAA, 0xFE, 0x00, 0x00,
-    0xFF, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x1F, 0xF0, 0x01, 0xE0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x96, 0xA4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xE0, 0x00, 0x2F, 0xE0,
-    0x00, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xAF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x0B, 0xEF, 0xE0, 0x00, 0xF8, 0x3E, 0x00, 0x02, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8,
-    0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE4,
-    0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x0F, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0xBD, 0xFF, 0xE0, 0x00, 0x00, 0x1C, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xEA, 0xAF,
-    0xE0, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7D, 0x00, 0x01, 0xFF, 0x00, 0x1E,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x6A, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x10, 0x00, 0x07, 0xFC, 0x00, 0x2E, 0x00,
-    0x02, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0xFA, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0x90, 0x20, 0x00, 0x7F,
-    0xC3, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0x0F, 0xF8, 0x00, 0x14, 0x1B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x00,
-    0x1F, 0xD2, 0xFC, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x3F, 0x02, 0xFC, 0x02, 0xFC,
-    0x2F, 0xC0, 0x0F, 0xFB, 0xFC, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x03, 0xF8, 0x00,
-    0xB0, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x0B,
-    0xD0, 0x00, 0x00, 0x01, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x78, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xFC, 0x00, 0x78, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x5A, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x02, 0xFC, 0xFC, 0x00, 0x00, 0xBE, 0x07, 0xD0, 0x00, 0x06, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x01,
-    0xFD, 0x2F, 0xC0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFC, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0x03, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0xD2, 0xC0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x1F, 0xC1, 0xF4, 0x00, 0x00, 0x07,
-    0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00, 0x1F, 0xF0,
-    0x01, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x78, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xE5, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x40, 0x00, 0x1F, 0xF0, 0x00, 0xB8, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x00, 0x3F,
-    0x40, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x05, 0x43, 0x40, 0x00, 0x7F, 0x80, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0xBF, 0x3F, 0x00, 0x0B, 0xE0, 0x7D, 0x00, 0x19, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xF0, 0x01, 0xFD, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE, 0x03, 0xF8, 0x03, 0xF0, 0x2F, 0xC0, 0x2F, 0xC2, 0xFC, 0x00,
-    0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0xFF,
-    0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x05, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x60, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x78, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFA,
-    0xAB, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xFC, 0x00, 0x78, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x5A, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x40, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xD0,
-    0x03, 0xF4, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xBF, 0x00, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x00, 0x42, 0xE0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x05, 0x43, 0xC0, 0x00, 0x00, 0x7F, 0x8E, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x7D, 0x00, 0x00, 0x19, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x03,
-    0xF0, 0x2F, 0xC0, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0A, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x1D, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x1F, 0xC1, 0xF4, 0x00, 0x00, 0x07, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0x3F,
-    0xC0, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x01, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x78, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0xA9, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0xB8, 0x00, 0x0B, 0xF8, 0x00,
-    0x3E, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0x80, 0x10, 0x00, 0x3F, 0xD2, 0xD0, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0x47, 0xFC, 0x00, 0x04, 0x02, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x2F, 0x8F, 0xD0, 0x02, 0xF8, 0x0F, 0x80, 0x06, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x7F, 0x4B, 0xF0, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0xFE, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0,
-    0xBF, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x0F, 0xE0, 0x02,
-    0xC0, 0x3F, 0xC0, 0x7F, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x2F, 0x00, 0x00, 0x02, 0xD0, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFA, 0xAB, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0x7F,
-    0xC0, 0x07, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x5A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x01, 0xFF, 0x00,
-    0x0B, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x1F, 0xFE, 0xBF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xBD, 0xFC, 0x00,
-    0x1F, 0x83, 0xE0, 0x07, 0xE0, 0x2E, 0x00, 0x24, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xD2, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0xFE,
-    0x03, 0xF8, 0x0F, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xEF, 0xF0, 0x03, 0xFF, 0xF4, 0x00,
-    0x3F, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0xB0, 0x3F, 0xC0, 0x7F, 0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0xF4, 0x7D, 0x00, 0x01, 0x82,
-    0xF0, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x05, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xBF, 0x00, 0xF0, 0xBC, 0x01, 0x43, 0xF0, 0x00, 0x7F, 0x00,
-    0x0B, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFE, 0x00,
-    0xFF, 0xFC, 0x01, 0x6F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80,
-    0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF5, 0xD0, 0x2F, 0xFF,
-    0x40, 0xBF, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x3F, 0xC0,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0B, 0xFE, 0x03, 0xFF, 0xF0, 0x16, 0xFE, 0x00, 0x1F,
-    0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x00,
-    0x1F, 0xD0, 0x02, 0xFD, 0x74, 0x2F, 0xFF, 0x42, 0xFF, 0xE0, 0x1F, 0xF4, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x3F, 0x80, 0x0B, 0xF4, 0x00, 0xBF, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFA, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00,
-    0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xDB, 0xFD,
-    0x07, 0xF8, 0x0B, 0xFC, 0x3F, 0xC0, 0x1F, 0xF1, 0xFE, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x3F,
-    0xC0, 0x07, 0xF8, 0xFF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xD0,
-    0x7F, 0xC0, 0xBF, 0xEB, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x00, 0x09,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0x47, 0xFD, 0x00, 0x00, 0x7F, 0xE2, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x07,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x3F,
-    0xE0, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x81, 0xF4, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xFD, 0xBF, 0xD0,
-    0x7F, 0x80, 0xBF, 0xC3, 0xFC, 0x01, 0xFF, 0x1F, 0xE0, 0x03, 0xFC, 0xBF, 0x40, 0x0F, 0xF3, 0xFC,
-    0x00, 0x7F, 0x8F, 0xF0, 0x02, 0xFD, 0x3F, 0xC0, 0x0F, 0xF0, 0xFF, 0x00, 0x7F, 0x83, 0xFD, 0x07,
-    0xFC, 0x0B, 0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x2F, 0x40, 0x00, 0x00, 0x1F,
-    0xD3, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x28, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF4, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x7F, 0xC0, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x54,
-    0xBC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF,
-    0x43, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x07, 0xFD,
-    0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x60, 0xA0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x01, 0xFC, 0x0F, 0x80, 0x00, 0x28,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x6F, 0xF4, 0x01, 0xFE, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x02, 0xFF, 0xAF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xE0,
-    0x00, 0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x54, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xC3, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0x28, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xC0,
-    0x00, 0x00, 0x07, 0x80, 0x28, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF4, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x82, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x06,
-    0x0F, 0x40, 0x00, 0x00, 0x3F, 0xCB, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0x6F, 0xF4, 0x00, 0x07, 0xF8, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x1F, 0xE0,
-    0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x38, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0xBE, 0x0B, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x00, 0x0F,
-    0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x43, 0xFF,
-    0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x3F, 0xF0,
-    0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x04, 0x00, 0x03, 0xFE, 0x1E, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07, 0x87, 0xFC, 0x00, 0x01, 0x00,
-    0xA0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xF2,
-    0xF8, 0x00, 0x1F, 0xC0, 0xBC, 0x00, 0x0A, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0x6F, 0xF4, 0x07, 0xF8, 0x0B,
-    0xFC, 0x0F, 0xF0, 0x07, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07,
-    0xF8, 0x3F, 0xC0, 0x0B, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xE0, 0x3F, 0xD0, 0x7F,
-    0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xFC,
-    0x00, 0x00, 0x0B, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFA, 0xFF, 0xF0,
-    0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x7F, 0xD3,
-    0xFF, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xDB, 0xFD, 0x07, 0xF8, 0x0B, 0xFC, 0x3F,
-    0xC0, 0x1F, 0xF1, 0xFE, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0xFF, 0x3F, 0xC0, 0x07, 0xF8, 0xFF, 0x00,
-    0x2F, 0xD3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xEB, 0xFC,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0xBD, 0x00, 0x00, 0x0A, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xA4, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3C, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x05, 0x40, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x6F,
-    0xF4, 0x00, 0x7F, 0x80, 0xBF, 0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x2F,
-    0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xA4,
-    0x02, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01,
-    0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x01, 0x40,
-    0x00, 0x01, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x05, 0x40, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x7F, 0x80, 0xBF, 0xC0, 0x0F,
-    0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F,
-    0x80, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x03, 0xFD,
-    0x07, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x09,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x40, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xA4, 0x02,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE,
-    0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01, 0xFF,
-    0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xEB, 0xE0, 0x00, 0x00, 0xB8, 0x3E,
-    0x00, 0x00, 0x02, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x14, 0x00, 0x00, 0x90, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x54, 0x0F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x07, 0xF8,
-    0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x01,
-    0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x70, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xA4, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x20, 0x00, 0x01, 0xFF, 0x4B, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xC3, 0xFF, 0x00, 0x00, 0x14, 0x0B, 0x41, 0x40, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x05, 0x40, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x7F, 0x80, 0xBF, 0xC0, 0x0F, 0xF0, 0x07,
-    0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x03, 0xFD, 0x07, 0xFC,
-    0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x06, 0xA4, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xDB,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x01, 0xFF,
-    0x40, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x05, 0x40, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x6F, 0xF4, 0x00, 0x7F, 0x80, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xC0,
-    0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xFE,
-    0x00, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x07,
-    0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC,
-    0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80,
-    0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B,
-    0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00,
-    0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x24, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xF3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x3D, 0x0F,
-    0x80, 0x00, 0x01, 0x82, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x01, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0xFE, 0x00, 0xFF, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x01, 0xFC,
-    0x02, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x7F, 0x80,
-    0x0B, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x01, 0xFD, 0x0B,
-    0xFF, 0x04, 0x2F, 0xC2, 0xF7, 0xF7, 0xC2, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xFF, 0x07, 0xFF, 0x00,
-    0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xB8,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x43, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x50, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x01, 0xBF,
-    0x41, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x16, 0xFD, 0x01, 0xFE, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00,
-    0x07, 0xF4, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x40, 0x0B, 0xF0, 0xBD, 0xFD, 0xF0, 0x02,
-    0xFF, 0xFC, 0xBF, 0xFC, 0x00, 0xBF, 0xFC, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x43,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xD0, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x41, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x50, 0x00, 0x00, 0x14,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x01, 0xBF, 0x41, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x40, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x16, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0xBF,
-    0x40, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x07, 0xF4, 0x07, 0xF8,
-    0x00, 0x02, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xC0,
-    0x00, 0x1F, 0xD0, 0xBF, 0xF0, 0x40, 0x0B, 0xF0, 0xBD, 0xFD, 0xF0, 0x02, 0xFF, 0xFC, 0xBF, 0xFC,
-    0x00, 0xBF, 0xFC, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1B, 0x80, 0x00,
-    0x00, 0xB4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x07,
-    0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00,
-    0x00, 0x01, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x05, 0x00, 0x00, 0x6F, 0xD0, 0x7F, 0xF4, 0x02, 0xFF, 0xD0, 0x3F, 0xFE, 0x00, 0xFF, 0x00, 0x05,
-    0xBF, 0x40, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x2F, 0xD0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03,
-    0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xF0, 0x00, 0x07, 0xF4, 0x2F, 0xFC, 0x10, 0x02, 0xFC,
-    0x2F, 0x7F, 0x7C, 0x00, 0xBF, 0xFF, 0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0x07, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0xFE, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0x40,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3C, 0x3F, 0xE0, 0x00, 0x00, 0x05, 0x06, 0xD0, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x1B, 0xF4,
-    0x1F, 0xFD, 0x00, 0xBF, 0xF4, 0x0F, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0x6F, 0xD0, 0x1F, 0xE0, 0x00,
-    0x07, 0xF0, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0x40, 0x7F, 0x80, 0x00, 0x2F, 0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x03,
-    0xF8, 0x0F, 0xFC, 0x00, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x00, 0xBF, 0x0B, 0xDF, 0xDF, 0x00, 0x2F,
-    0xFF, 0xCB, 0xFF, 0xC0, 0x0B, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x1B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0x40,
-    0x00, 0x1B, 0xF4, 0x1F, 0xFD, 0x00, 0xBF, 0xF4, 0x0F, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0x6F, 0xD0,
-    0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x80, 0x00, 0x2F, 0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xFC, 0x00, 0x01, 0xFD, 0x0B, 0xFF, 0x04, 0x00, 0xBF, 0x0B, 0xDF,
-    0xDF, 0x00, 0x2F, 0xFF, 0xCB, 0xFF, 0xC0, 0x0B, 0xFF, 0xC1, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x3F,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0,
-    0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00,
-    0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC,
-    0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00,
-    0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0,
-    0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00,
-    0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x00,
-    0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF,
-    0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41,
-    0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD,
-    0x00, 0x64, 0x2F, 0xAF, 0xF4, 0x02, 0xFC, 0x3F, 0xFF, 0xC0, 0x03, 0xFC, 0x3F, 0xFE, 0x00, 0x03,
-    0xF8, 0x0B, 0xE0, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x03, 0xD1, 0xF4, 0x00, 0x00, 0x00, 0x60, 0xBC, 0x00,
-    0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x0F, 0xFF, 0xF0,
-    0xFF, 0xFF, 0x03, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0xD3, 0xF8, 0x00, 0x00, 0x0B, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x07, 0xEB, 0xE0, 0x00, 0x00, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x02, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD,
-    0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00,
-    0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00,
-    0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F,
-    0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x82, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x6F, 0xFC, 0x00, 0x00, 0x03,
-    0x82, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x40, 0xFF, 0xC0,
-    0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80,
-    0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0xAF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x20, 0x00, 0x00, 0x1F, 0xF4, 0xB8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3C, 0x3F, 0xF0,
-    0x00, 0x00, 0x18, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x1F, 0xFF, 0x02, 0xFE, 0x00, 0x16,
-    0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x3F,
-    0x81, 0xFC, 0x00, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x08, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xAF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57,
-    0x5D, 0x1F, 0x40, 0xF0, 0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A,
-    0xAB, 0xDB, 0xAA, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
-    0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00,
-    0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x01,
-    0x52, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0,
-    0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF,
-    0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB,
-    0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC,
-    0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A,
-    0x80, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x10, 0x07, 0xD0, 0x7F, 0x03, 0xF0, 0x2F, 0x80, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x7F, 0x80, 0x50,
-    0x00, 0x00, 0x50, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x0F,
-    0xC0, 0x3F, 0x00, 0x04, 0x00, 0x02, 0xD0, 0x3F, 0xC0, 0xBF, 0x02, 0xFC, 0x0B, 0xE0, 0x3F, 0x02,
-    0xF8, 0x1F, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x47, 0xFC, 0x1F, 0xD0, 0x3F, 0x40,
-    0xFE, 0x01, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x02, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x7D, 0x07, 0xE0,
-    0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x0F, 0xD0, 0xFD, 0x07, 0xF0, 0x7F, 0x41,
-    0xFD, 0x1F, 0xD0, 0x7F, 0x83, 0xF8, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82,
-    0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x2F, 0xC2, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0x43, 0xF4, 0x07,
-    0xF0, 0x7F, 0x00, 0xFC, 0x0F, 0xD0, 0x2F, 0x42, 0xF4, 0x01, 0x80, 0x19, 0x00, 0x02, 0xD0, 0x68,
-    0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x0F, 0xF0, 0x2F, 0xC2, 0xFC, 0x0B, 0xE0, 0xFD, 0x03, 0xF0, 0x7F,
-    0x02, 0xF8, 0x3F, 0x41, 0xFC, 0x2F, 0x80, 0xB8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x0F, 0xF4, 0xFF, 0x07, 0xFC, 0x7F, 0x81, 0xFD, 0x2F, 0xC0, 0x3F, 0x47, 0xF0, 0x0F, 0xE0,
-    0xFD, 0x01, 0xFC, 0x2F, 0x80, 0x2F, 0x43, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x2C, 0x03, 0x80, 0x00,
-    0x01, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x05,
-    0x07, 0xC0, 0x57, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0xA5, 0x3D, 0x1A, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x05, 0x07, 0xC0, 0x50, 0x7F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFD, 0x0A, 0x53, 0xD1, 0xA0, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x02, 0x90, 0xF0, 0x58, 0x0F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x50, 0xF8, 0x14,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x0A, 0x90, 0xFF, 0xDB, 0xFF, 0xBF, 0xFD, 0xFF, 0xF1, 0xFF, 0x40, 0x50,
-    0x00, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0xE7, 0xFF,
-    0x3F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0xC7, 0xFC, 0x0F, 0xF2, 0xFF, 0x07, 0xFC,
-    0xBF, 0x41, 0xFD, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0xBD, 0x00, 0x0F, 0xC7, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF6, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD,
-    0x7F, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x05, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x01, 0x03, 0xFD,
-    0x7F, 0xF7, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34,
-    0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74, 0x06,
-    0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0, 0x00,
-    0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1, 0xC3,
-    0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x40,
-    0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07, 0x07,
-    0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x3F, 0x43, 0xF0, 0x0A, 0x90, 0x00, 0x06, 0xA0, 0x1F, 0xD2, 0xFC, 0x2F, 0x42, 0xFF, 0xF0,
-    0x01, 0xFF, 0xF4, 0x3F, 0xFF, 0xC1, 0xF8, 0x3F, 0xEF, 0xE0, 0x2F, 0xEF, 0xF0, 0x2F, 0xF8, 0x0F,
-    0xC2, 0xFC, 0x2F, 0xC1, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x7F, 0x0F, 0xE0, 0x3F,
-    0x40, 0x00, 0x0B, 0xD0, 0xBF, 0x01, 0xFC, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x03, 0xF8, 0x0B,
-    0xF1, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x3F, 0x8B, 0xF0, 0x1F, 0xC0, 0x00, 0x3F,
-    0x40, 0x3F, 0x40, 0xFC, 0x2F, 0x80, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0xFE, 0x0F, 0xE0, 0xBF, 0x0B,
-    0xF0, 0x00, 0x1F, 0xC0, 0x02, 0xFE, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF,
-    0xE0, 0x02, 0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xA4, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x2F, 0x80, 0xFE, 0x0B,
-    0xF4, 0x3F, 0xC1, 0xFD, 0x0F, 0xE0, 0x3F, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x0B, 0x40, 0x2F, 0x83, 0xF4, 0x0F, 0xE1, 0xFD, 0x0B, 0xF4, 0xFF, 0x03, 0xFC, 0x7F, 0x81,
-    0xFD, 0x2F, 0xC0, 0xFE, 0x0F, 0xD0, 0x3F, 0x07, 0xE0, 0x0B, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0E, 0x00, 0xB4, 0x02, 0xF8, 0x1F, 0xC0, 0xFD, 0x03,
-    0xF8, 0x3F, 0xC1, 0xFD, 0x0B, 0xF4, 0x3F, 0x83, 0xFC, 0x0F, 0xF0, 0xBF, 0x07, 0xF4, 0x1F, 0xD0,
-    0xFE, 0x0B, 0xF0, 0x3F, 0x81, 0xFC, 0x0F, 0xD0, 0x3F, 0x02, 0xF4, 0x1F, 0x80, 0x2C, 0x01, 0xE0,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0,
-    0x7F, 0x40, 0xFE, 0x01, 0xFC, 0x02, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x2C, 0x07, 0xF0, 0x3F, 0x41, 0xFD, 0x0F, 0xF0, 0x3F, 0xC2, 0xFC, 0x07, 0xF4, 0x3F, 0x80, 0xFE,
-    0x0B, 0xF0, 0x1F, 0xC0, 0xFD, 0x02, 0xF4, 0x1F, 0xC0, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xB0, 0x07, 0x40, 0x7F, 0x03, 0xF4, 0x2F, 0x80, 0x7F, 0x43,
-    0xFC, 0x2F, 0xC0, 0x3F, 0xC2, 0xFC, 0x1F, 0xE0, 0x1F, 0xD0, 0xFE, 0x0F, 0xF0, 0x0F, 0xE0, 0xBF,
-    0x07, 0xF4, 0x07, 0xF0, 0x3F, 0x42, 0xFC, 0x02, 0xF4, 0x1F, 0xC0, 0xFC, 0x00, 0xF0, 0x0B, 0x40,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xF8, 0x00,
-    0x1F, 0xEF, 0x80, 0x1F, 0xC2, 0xF8, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1E, 0x00, 0x2F, 0xC0, 0x3F,
-    0xC0, 0x7F, 0xC0, 0x7F, 0xC0, 0x2F, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x7F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF4, 0x02, 0xFD, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8B, 0xC0, 0x0A, 0x00, 0x3E, 0x3F, 0x02, 0xF8, 0x0F,
-    0xC0, 0xF8, 0x2F, 0x82, 0xF0, 0x03, 0xE0, 0xF0, 0xBD, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x7E,
-    0x07, 0xD0, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x1F, 0x0B, 0xFE, 0x0F, 0x43, 0xF8, 0x2F, 0x82, 0xFC,
-    0x2F, 0x43, 0xFC, 0x1F, 0xC0, 0x50, 0xFA, 0xF0, 0x50, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x50, 0xFC, 0x00, 0xFC, 0x2F, 0x83, 0xF0, 0x2F, 0x02, 0xFC, 0x0F, 0x8B,
-    0xD0, 0x1F, 0x40, 0x3E, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x1A, 0x40, 0x2F, 0xD0, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8, 0x0B, 0xF8, 0x03, 0xFD,
-    0x03, 0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x1F, 0xD0, 0x1F, 0xD0, 0x07,
-    0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0x3F, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x7D,
-    0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xF4, 0x01, 0xFF, 0x01,
-    0xFE, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x1F, 0xC0, 0x2F, 0xC0, 0x01, 0x40, 0x01, 0x40, 0x00, 0x55,
-    0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x02,
-    0xFF, 0xDF, 0xFF, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x3F, 0xBF,
-    0xD0, 0xFE, 0xFF, 0x49, 0x03, 0xF4, 0x24, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xD4, 0x00,
-    0x7F, 0x50, 0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x05, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x01, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x2F, 0xF4, 0x00, 0x3F, 0xC2, 0xFF, 0xF4, 0x02, 0xFE,
-    0x0F, 0xFF, 0xF0, 0x0F, 0xF0, 0x3F, 0xBF, 0xD0, 0x7F, 0xC0, 0x90, 0x3F, 0x41, 0xFE, 0x00, 0x00,
-    0xFD, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x03, 0xF4, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x01,
-    0xFD, 0x40, 0x0B, 0xD0, 0x07, 0xFF, 0x40, 0x2F, 0x00, 0x0F, 0xF8, 0x00, 0xBC, 0x00, 0x05, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x2E, 0x00, 0x1F, 0xE0, 0x03, 0xFD,
-    0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xFE, 0x00, 0x0F, 0xF0, 0x7F, 0xFF, 0x00, 0xBF,
-    0x82, 0xFF, 0xFD, 0x03, 0xFD, 0x0B, 0xEB, 0xFC, 0x0F, 0xF0, 0x08, 0x07, 0xF0, 0x3F, 0x80, 0x00,
-    0x1F, 0xC1, 0xFD, 0x00, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0xBE, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x3F, 0x54, 0x00, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xD0, 0x02, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xBF,
-    0x80, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x40, 0x01, 0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD,
-    0x02, 0xFF, 0xFE, 0x0E, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0xE0, 0x0B, 0x40, 0x74, 0x02, 0xF8, 0x1F, 0xC0, 0xFD, 0x0B, 0xE0,
-    0x3F, 0x83, 0xFC, 0x1F, 0xD0, 0xFE, 0x0B, 0xF4, 0x3F, 0x83, 0xFC, 0x2F, 0xD0, 0xFF, 0x0B, 0xF0,
-    0x7F, 0x43, 0xFC, 0x1F, 0xD0, 0xFE, 0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0xFD, 0x0F, 0xE0,
-    0x3F, 0x02, 0xF4, 0x1F, 0x80, 0xFC, 0x02, 0xC0, 0x1E, 0x00, 0xF0, 0x0B, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x3F, 0xFF, 0x40, 0x3F, 0xDF, 0xF0, 0x2F, 0x81,
-    0xFC, 0x0F, 0xC0, 0x3F, 0x0B, 0xF0, 0x0F, 0xC3, 0xF4, 0x07, 0xF0, 0xFC, 0x02, 0xFC, 0x3F, 0x00,
-    0xFD, 0x0F, 0xC0, 0x7F, 0x03, 0xF4, 0x3F, 0x40, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x3E, 0xBC, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x3F, 0x0B, 0xC0, 0x3F, 0xAB, 0xFA, 0x1F,
-    0xFF, 0xFF, 0xC1, 0xAA, 0xBF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x2A, 0xAA, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x03, 0xE0, 0x00, 0x01, 0xF9, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFE, 0x00, 0xAB, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x02,
-    0xB8, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0x90, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0x40,
-    0x3F, 0xFF, 0xE0, 0x7D, 0x07, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0xBE, 0x07, 0xF0, 0x3F,
-    0xAF, 0xD0, 0x1F, 0xFF, 0x40, 0x01, 0x94, 0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xE3, 0xFA, 0xBF,
-    0x5F, 0x02, 0xF8, 0x74, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x6F, 0x80, 0x0F, 0xFF, 0xD0, 0xFD, 0x1F, 0xC3, 0xF0, 0x3F, 0x0F, 0xC2, 0xF4, 0x2F, 0xEF, 0x80,
-    0x3F, 0xF4, 0x07, 0xEB, 0xF0, 0x7E, 0x0B, 0xE3, 0xF0, 0x1F, 0xCF, 0xC0, 0xBE, 0x2F, 0xEB, 0xF0,
-    0x3F, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0x90, 0x01, 0xFF, 0xFC, 0x03, 0xF5, 0xFD, 0x0B,
-    0xD0, 0x7E, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x3E, 0x0B, 0xE0, 0xBE, 0x03, 0xFF, 0xFC, 0x00, 0xAF,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x2B, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x42, 0xFE, 0x3F, 0xCA, 0xF7, 0xFF, 0x03, 0xFC, 0xFC, 0x1F, 0xC3, 0xE0, 0xBD, 0x0F,
-    0x43, 0xF0, 0x7C, 0x0F, 0x82, 0xF2, 0x7D, 0x0F, 0xFE, 0xF0, 0x3F, 0xC5, 0x40, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x1F, 0xD2, 0xFC, 0x0F, 0xD0, 0x7F, 0x07,
-    0xF0, 0x0F, 0xC2, 0xF8, 0x07, 0xF0, 0xFD, 0x01, 0xFC, 0x3F, 0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0x43,
-    0xF4, 0x2F, 0xC0, 0xFE, 0x2F, 0xC0, 0x2F, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0xBF, 0xF4, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x3F, 0xFF, 0x4F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xFD, 0x07, 0xF4, 0xBE, 0x07, 0xC0, 0x7E, 0x01,
-    0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xEA, 0xA8, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x7F, 0xFF, 0x03, 0xE0, 0xBD, 0x06, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xF8, 0x00, 0xFF, 0xF0,
-    0x02, 0x5F, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x1F, 0x4F, 0x80, 0x1F, 0x47, 0xD0, 0x1F, 0x42,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xD5, 0x40, 0x03, 0xD0, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x06, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xF9, 0x03, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x1F,
-    0xD5, 0x00, 0x3F, 0xFF, 0xC0, 0x7F, 0x9F, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0xBD, 0x03,
-    0xF0, 0x7F, 0x0B, 0xE0, 0x3F, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xE7, 0xD5, 0x7F, 0x1F, 0x03, 0xF4, 0x10, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xBF, 0x83, 0xF0, 0x3F, 0x0F,
-    0xC1, 0xF8, 0x3F, 0x4F, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xD0, 0x2F, 0x5F, 0xD2, 0xF4, 0x1F, 0xCF,
-    0xC0, 0x7F, 0x3F, 0x43, 0xF8, 0x7F, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0xFC, 0x07, 0xE0, 0xBE, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x3F,
-    0x0F, 0xD0, 0x7E, 0x0B, 0xFA, 0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x17, 0xF4, 0x00, 0x0B, 0xE0, 0x01,
-    0xBF, 0xC0, 0x7F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xAA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x95, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0x94, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFB, 0xFF, 0x00, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x1E,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x04, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0xAB, 0xFE, 0xA9, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x53, 0xF8, 0x00, 0x16, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xD1,
-    0xBF, 0xFF, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4F,
-    0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x03, 0xFC,
-    0x03, 0xFD, 0x1F, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0xCF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xC0, 0x07, 0xFE, 0xFF, 0xF0, 0x1F, 0xF5, 0x02, 0xF4, 0x1C, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x83,
-    0x4E, 0x03, 0xF8, 0x07, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFA, 0xF8, 0x3F, 0x47, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0xE0, 0xBF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0x40, 0x7D, 0x00, 0x0B, 0xF8, 0x00, 0xBC, 0x00, 0x1F, 0xE0, 0x00, 0x74, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x02, 0xBF, 0xEB, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0xFF, 0x95, 0x50, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x10, 0x00, 0x7F,
-    0xF4, 0x01, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xD5, 0x6A,
-    0xAA, 0xA0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xDF, 0xEF, 0xCB, 0xE3, 0xF3,
-    0xF8, 0xF0, 0xFC, 0x3C, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xAA, 0xAA, 0xAA, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xA5, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x10, 0x3C, 0x3F, 0x0F, 0x2F, 0xCF, 0xCF, 0xE3, 0xFB, 0xFB, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x2F, 0x80, 0xBF, 0xAA, 0xAA, 0xBF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xD5, 0x55, 0x5F, 0xE0, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x3F,
-    0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFD, 0x1F, 0xDF, 0xDF, 0xC3, 0xE3, 0xF2, 0xE0, 0x20, 0xFC, 0x20, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x08, 0x3F, 0x08, 0x0F, 0x8F, 0xCB, 0xC3,
-    0xF7, 0xF7, 0xF0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xEF, 0xEF, 0xC0, 0x3F, 0x3F, 0x3F, 0x00, 0x30, 0xFC, 0x30, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x70, 0xFC, 0x34, 0x07, 0xF3, 0xF3, 0xF0,
-    0x0B, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x15,
-    0x5B, 0x95, 0x50, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x90, 0xBE, 0x00, 0xBD, 0x2F, 0x80, 0xBF, 0x4B, 0xE0, 0xBF,
-    0x02, 0xF4, 0xBF, 0x00, 0xBD, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x3F,
-    0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x40, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x18, 0x00, 0xBE, 0x1F, 0x80, 0x2F, 0x87, 0xF8, 0x0B,
-    0xE0, 0x3F, 0x81, 0xF8, 0x03, 0xF8, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF0,
-    0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF0, 0x00,
-    0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x40, 0x0F, 0xD0, 0xBE, 0x00, 0x03, 0xF4, 0xBF, 0x55,
-    0x55, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFD, 0x55, 0x55, 0x50, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x55, 0xAA, 0xA4, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x55, 0x5A, 0xA9, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF8, 0xBE,
-    0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0x03, 0xFB, 0xE2, 0xFB, 0xF0, 0xB8, 0xF8,
-    0xBC, 0xB8, 0x04, 0x3E, 0x2F, 0x04, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00,
-    0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x6A, 0xA9, 0x55, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1A, 0xA9, 0x55, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x02,
-    0x0F, 0x8B, 0xC2, 0x03, 0xE3, 0xE2, 0xF2, 0xF0, 0xFE, 0xF8, 0xBE, 0xFC, 0x0B, 0xFE, 0x2F, 0xF8,
-    0x00, 0xBF, 0x8B, 0xF8, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0x02,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0xFD, 0x00, 0x7F, 0xEA, 0xAA, 0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF5, 0x5F, 0xE0, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xE0, 0x02, 0xE0, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF,
-    0xAF, 0xFC, 0x07, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x03, 0xF8, 0x3F, 0xC0,
-    0x07, 0xF4, 0x3F, 0xC0, 0x0B, 0xF0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x40, 0x3F, 0xFB, 0xFE, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0xAA, 0xAA, 0xBF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x50, 0x00, 0x3F, 0xD7, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x03,
-    0x80, 0x00, 0x7F, 0xFF, 0xF8, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xAF,
-    0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF8, 0x02, 0xFE, 0x00,
-    0x02, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x2F, 0x7F, 0xD0, 0x7F, 0xC0, 0x02, 0xF4, 0xBF, 0x81, 0xFE,
-    0x00, 0x2F, 0x41, 0xFE, 0x0B, 0xF4, 0x02, 0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x2F, 0x80, 0x1F, 0xE0,
-    0xBF, 0x41, 0xF8, 0x00, 0xBF, 0x41, 0xFE, 0x1F, 0x80, 0x03, 0xFC, 0x07, 0xFD, 0xF8, 0x00, 0x0F,
-    0xF0, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x2F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xBF, 0xD0, 0x00, 0xFF, 0xFE, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x00, 0x02, 0xC0, 0x05, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0xF4, 0x00, 0x00, 0x2F, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x03, 0xFE,
-    0x00, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0xFF, 0x80,
-    0x03, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x1F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x2F, 0xC0, 0x00, 0x1F, 0xF4, 0x3F, 0xEA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xAA, 0xAF, 0xFD, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0xBF, 0xC0, 0x00, 0x3F, 0x41, 0xFF, 0x80, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xE0, 0x0B, 0xFC,
-    0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F,
-    0x00, 0x00, 0xFF, 0x83, 0xF8, 0x00, 0x02, 0xFF, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0xBE, 0x00, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x94, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFA, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xEA, 0xAA, 0xAA, 0xAA, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x55, 0x55, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xF9, 0x47, 0xF4, 0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0B,
-    0xF8, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xAA, 0xAF, 0xFA, 0xA8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xFE, 0xAA, 0xA0, 0xFF,
-    0x40, 0x7F, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xBF,
-    0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x55, 0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA,
-    0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA,
-    0xAA, 0xAA, 0xA0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x05, 0x55, 0x55, 0x6F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF4, 0x5B, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFE, 0x00, 0x0F,
-    0xF0, 0xAA, 0xBF, 0xEA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xAA, 0xAF, 0xEA, 0xAF, 0xF0, 0x00, 0x03, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x02, 0xFE,
-    0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x80, 0x55, 0x55, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0xAA, 0xAA, 0xAA, 0xAB, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x06, 0xFF, 0xFA, 0xAF, 0xFF, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F,
-    0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00,
-    0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF,
-    0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x00,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF1, 0xAA,
-    0xAA, 0x41, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xAA, 0xBF, 0xF8, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xFC, 0x00,
-    0x0F, 0x80, 0x2F, 0xF8, 0x00, 0x2D, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0A, 0x00,
-    0xBF, 0x80, 0x00, 0x7D, 0x07, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x1F, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x16, 0xAA, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x1F, 0x40, 0x02, 0xD1, 0xF4, 0x78, 0x3F, 0xDF, 0x7F, 0xC2, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x47, 0xFE, 0xFB, 0xFD, 0x3F, 0x1F, 0x4F, 0xC0, 0x41,
-    0xF4, 0x10, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xF8, 0x3F, 0x82, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0xD7,
-    0xF8, 0x1F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x05, 0x54, 0x00, 0x2F, 0x80, 0x7F, 0xF8, 0x00, 0xFD,
-    0x01, 0xFF, 0xF0, 0x03, 0xF0, 0x02, 0xBF, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x40, 0xBD, 0x00, 0x00,
-    0xFE, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0x7D, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0xBF, 0xD0, 0x1F, 0x3F,
-    0xFF, 0x4B, 0xF7, 0xFA, 0xFE, 0xFD, 0xBD, 0x07, 0xFE, 0x0F, 0xC0, 0x2F, 0xC0, 0xFC, 0x03, 0xFD,
-    0x0B, 0xE0, 0xBF, 0xF4, 0x7F, 0xFF, 0x5F, 0xE3, 0xFF, 0xD0, 0xBF, 0x0B, 0xE4, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0x2F, 0xFF, 0x0B, 0xFF, 0xC3,
-    0xFA, 0xFE, 0xFE, 0xFD, 0xBD, 0x07, 0xFD, 0x07, 0xEB, 0xC0, 0x2F, 0xC0, 0x3E, 0xBD, 0x03, 0xFC,
-    0x03, 0xEB, 0xE0, 0xFF, 0xF0, 0xBE, 0x7F, 0xFF, 0x5F, 0xFF, 0xC2, 0xFF, 0xD0, 0xBF, 0xF8, 0x0B,
-    0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0xAA, 0x80,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x15, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC,
-    0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x2F, 0xCB, 0xF2, 0xFC, 0xBF,
-    0x2F, 0xCB, 0xF2, 0xFC, 0xBF, 0x1A, 0x80, 0x15, 0x01, 0x52, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F,
-    0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2,
-    0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF,
-    0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B,
-    0xF2, 0xFC, 0x2F, 0xCB, 0xF0, 0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF2, 0xFC, 0x2F, 0xCB, 0xF0,
-    0xBF, 0x2F, 0xC2, 0xFC, 0xBF, 0x0B, 0xF1, 0xA8, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xCF, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x03,
-    0xFC, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xF8,
-    0x00, 0x07, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x40,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x0B, 0xF0,
-    0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF4,
-    0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x03, 0xF8,
-    0x07, 0xF8, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x3F, 0xD0, 0x02, 0xFF, 0x0F, 0xE0, 0x00,
-    0x2F, 0xC7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF,
-    0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F,
-    0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x03,
-    0xFA, 0xFC, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0F, 0xE7, 0xF0, 0x00,
-    0x03, 0xF5, 0xFD, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0xBF, 0x0F, 0xF8, 0x00, 0xBF, 0xC1, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0xBE,
-    0x00, 0x0F, 0xF4, 0x38, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x1C, 0x1F, 0xF0, 0x00, 0xBE, 0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF,
-    0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07,
-    0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xE0, 0xFF, 0x83, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3F, 0xC2, 0xFF, 0x0B, 0xF8, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF,
-    0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x64, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x2F, 0xCB, 0xFD, 0x00, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0x07, 0xFE, 0x7F, 0xC0,
-    0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0x01,
-    0x81, 0xFF, 0xFD, 0x01, 0xF9, 0xFF, 0xFF, 0xFF, 0xFD, 0xBD, 0x02, 0xFF, 0xFE, 0x0E, 0x00, 0x0B,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xC3, 0xFF,
-    0xFF, 0x47, 0xFA, 0xFE, 0xBF, 0xFF, 0xFC, 0xBC, 0x00, 0xBF, 0xFC, 0x04, 0x00, 0x01, 0x94, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA,
-    0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x01, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x0B, 0xFF,
-    0xC2, 0x40, 0x0B, 0xD0, 0x01, 0x50, 0x00, 0x41, 0xFF, 0xC0, 0x2E, 0x7F, 0xFF, 0x87, 0xFF, 0xFB,
-    0xFF, 0xFE, 0xFC, 0x0B, 0xFF, 0xC2, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x94, 0x00,
-    0x5B, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x5A, 0xA9, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xEA, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0x90, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xBD, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x15, 0x7F, 0x55, 0x47, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xD1, 0x7F, 0x55, 0x54, 0x07, 0xD0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00,
-    0xBF, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD,
-    0x04, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0x40,
-    0x0B, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0x7F, 0xF0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x1F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xE0, 0x0B, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFD, 0x00,
-    0x2F, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x07, 0xFF,
-    0x40, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x07,
-    0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x7F,
-    0x00, 0x00, 0x1F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFF, 0x9F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x55,
-    0x55, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x55, 0x5F, 0xE0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0x6F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xE0, 0x2F,
-    0xF0, 0x00, 0x07, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xFD,
-    0x00, 0x0B, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x05, 0x7F, 0x95, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x2F, 0xFD, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0xA4, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xAF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x6A, 0xAA, 0xAA,
-    0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0xB8, 0x2F, 0xC0, 0x0F, 0xD0, 0x2E,
-    0x01, 0xFC, 0x07, 0xD0, 0x0B, 0x80, 0x1F, 0x43, 0xE0, 0x02, 0xE0, 0x02, 0xF1, 0xF0, 0x00, 0xB8,
-    0x00, 0x3D, 0xB8, 0x00, 0x2E, 0x00, 0x0F, 0xBE, 0x00, 0x0B, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x0B, 0xEE, 0x00, 0x0B, 0x80,
-    0x02, 0xE7, 0xC0, 0x02, 0xE0, 0x00, 0xF4, 0xF8, 0x00, 0xB8, 0x00, 0xBC, 0x2F, 0x00, 0x2E, 0x00,
-    0x3E, 0x03, 0xF0, 0x0B, 0x80, 0x3F, 0x00, 0x3F, 0x82, 0xE0, 0xBF, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x02,
-    0xF1, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xBE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xEE, 0x00, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00,
-    0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x43,
-    0xEB, 0xE0, 0x02, 0xFA, 0xF1, 0xF0, 0xBE, 0x02, 0xF8, 0x3D, 0xB8, 0x0B, 0xE2, 0xF8, 0x0F, 0xBE,
-    0x00, 0xBF, 0xF8, 0x02, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0xF8,
-    0x02, 0xFF, 0xD0, 0x0B, 0xEE, 0x02, 0xF8, 0xBD, 0x02, 0xE7, 0xC2, 0xF8, 0x0B, 0xE0, 0xF4, 0xFA,
-    0xF8, 0x00, 0xBE, 0xBC, 0x2F, 0xF8, 0x00, 0x0B, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0xAF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x07, 0xD0,
-    0x00, 0x02, 0xFF, 0x43, 0xE0, 0x00, 0x02, 0xFA, 0xF1, 0xF0, 0x00, 0x02, 0xF8, 0x3D, 0xBC, 0x00,
-    0x02, 0xF8, 0x0F, 0xBE, 0x00, 0x02, 0xF8, 0x02, 0xFF, 0x40, 0x02, 0xF8, 0x00, 0x7F, 0xD0, 0x02,
-    0xF8, 0x00, 0x1F, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xEE, 0x02, 0xF8, 0x00, 0x03, 0xE7, 0xC2, 0xF8,
-    0x00, 0x00, 0xF4, 0xFA, 0xF8, 0x00, 0x00, 0xBC, 0x2F, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xF8, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xAB, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x1A, 0xAA, 0xFE, 0xAA, 0x9B, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00,
-    0x04, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xDB, 0xFD, 0x00, 0xFF, 0xC0, 0x1F, 0xFA, 0xFF, 0x40,
-    0x3F, 0xF0, 0x07, 0xFE, 0x7F, 0xC0, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x5B,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD2,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_bolditalicBitmaps[40872] = {
+    0x49, 0xAA, 0x93, 0xAE, 0x93, 0xF3, 0xAE, 0xA3, 0xF9, 0x3F, 0x4E, 0xA3, 0x9E, 0x93, 0x9E, 0x4A,
+    0xE4, 0xAD, 0xA4, 0xE9, 0x4E, 0x5E, 0x5D, 0xA5, 0xD9, 0x59, 0x77, 0x9D, 0x93, 0x9F, 0x3A, 0xEA,
+    0x39, 0xE5, 0x99, 0x50, 0x2A, 0xC9, 0x1A, 0xCA, 0x1E, 0x90, 0xE9, 0x0A, 0xE0, 0x9E, 0x1A, 0xE0,
+    0xAE, 0x1E, 0xA0, 0xAD, 0xA1, 0xE9, 0x0E, 0x91, 0xE1, 0xE2, 0xDA, 0x1E, 0x19, 0xD9, 0x1D, 0xA2,
+    0x93, 0x93, 0x59, 0x99, 0x92, 0x99, 0x97, 0xE9, 0x19, 0xDA, 0x7E, 0x2A, 0xD9, 0x69, 0xE2, 0xE7,
+    0xAD, 0xA2, 0xE4, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x19, 0x9A, 0xE9, 0x99, 0xE9, 0x99, 0x4A, 0xDA,
+    0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x2A, 0xD9, 0x4A, 0xAA, 0xEA, 0xAA, 0xEA, 0xAA, 0x90, 0xAF,
+    0xFF, 0xE1, 0xAF, 0xFF, 0xE4, 0xE2, 0xAD, 0x97, 0xE2, 0xE9, 0x69, 0xDA, 0x2E, 0x7A, 0xD9, 0x19,
+    0xE7, 0x77, 0x77, 0x71, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x1A, 0xFD, 0xA6, 0xFF,
+    0xD4, 0xEA, 0x0D, 0xAE, 0x92, 0xAD, 0xA1, 0xD0, 0xAD, 0xA2, 0xE9, 0x09, 0xCA, 0x1D, 0x92, 0xF0,
+    0xAC, 0x91, 0xCA, 0x3A, 0xFD, 0x70, 0x9F, 0xD7, 0x1A, 0xFD, 0x71, 0xAF, 0xD9, 0x70, 0x9F, 0xD7,
+    0x09, 0xFE, 0x2A, 0xC9, 0x1A, 0xCA, 0x0F, 0x1A, 0xDA, 0x1D, 0x1A, 0xE1, 0xF1, 0xD1, 0xAE, 0x1A,
+    0xE9, 0x9C, 0xA0, 0x9E, 0x92, 0xFD, 0xAA, 0xF3, 0x9F, 0xFC, 0xA6, 0xAF, 0xCA, 0x97, 0x09, 0xCA,
+    0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0x99, 0x72, 0x77, 0x77, 0x74, 0xCA, 0x70,
+    0x9F, 0xA7, 0x9E, 0x6A, 0xFD, 0xA6, 0xE9, 0x5A, 0xE9, 0x9E, 0x5E, 0xA5, 0x9E, 0x2E, 0x93, 0xAE,
+    0x6E, 0xA2, 0xE9, 0x3E, 0x7E, 0x3E, 0x92, 0xE9, 0x69, 0xE3, 0xE2, 0xAD, 0xA7, 0x9E, 0x29, 0xE2,
+    0xE7, 0x09, 0xE2, 0xE9, 0x1E, 0x3A, 0xAA, 0x91, 0x9E, 0x90, 0xAE, 0x1A, 0xD9, 0x1A, 0xFD, 0x1F,
+    0xF1, 0x9D, 0xA1, 0xFA, 0xEA, 0x1A, 0xFA, 0x2E, 0x1A, 0xE1, 0xAE, 0x71, 0xE2, 0xE2, 0x9E, 0x70,
+    0xAD, 0x91, 0xAE, 0x29, 0xE7, 0x9D, 0xA2, 0xEA, 0x2A, 0xE7, 0xE3, 0xE9, 0x2E, 0xA6, 0xE9, 0x3E,
+    0x92, 0xE6, 0xAD, 0xA4, 0xEA, 0x1E, 0xA5, 0x9E, 0x5A, 0xEA, 0xF6, 0xE9, 0x6F, 0xDA, 0x7D, 0xA7,
+    0x09, 0xAA, 0x97, 0x2A, 0x77, 0x20, 0x77, 0x77, 0x09, 0xFC, 0x77, 0x0F, 0xF7, 0x6F, 0x99, 0xE9,
+    0x74, 0xAE, 0x2A, 0xD9, 0x74, 0xE9, 0x2E, 0x74, 0x9E, 0x29, 0xDA, 0x74, 0x9E, 0x1A, 0xE6, 0xC5,
+    0x9E, 0x9E, 0xA5, 0xAD, 0x94, 0x9F, 0xCA, 0x39, 0xAF, 0xC4, 0x9F, 0xC3, 0xAF, 0xE9, 0x3A, 0xFC,
+    0xA2, 0xFD, 0xA5, 0xAE, 0xAE, 0x2D, 0xAE, 0x5A, 0xE1, 0xEA, 0x4E, 0x5E, 0xA1, 0xAE, 0x3A, 0xD9,
+    0x49, 0xE9, 0x2F, 0x2E, 0x5A, 0xE3, 0xAF, 0x0E, 0x95, 0x9E, 0x93, 0xFF, 0x69, 0xF4, 0xFD, 0x70,
+    0xFC, 0xA9, 0x9A, 0xFD, 0xA7, 0x0F, 0xFF, 0xFC, 0xA9, 0x5A, 0xFE, 0x90, 0x9F, 0xF9, 0x69, 0x96,
+    0xAF, 0xD7, 0x73, 0x99, 0x92, 0x2A, 0xC9, 0x1E, 0x90, 0xAE, 0x1A, 0xE1, 0xEA, 0x1E, 0x91, 0xE2,
+    0xDA, 0x19, 0xD9, 0x29, 0x30, 0x77, 0x59, 0xD7, 0x0A, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xAE, 0x79,
+    0xE9, 0x7F, 0x79, 0xE9, 0x7A, 0xE7, 0x0E, 0xA7, 0x9E, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xEA, 0x70,
+    0xEA, 0x70, 0xEA, 0x70, 0xF7, 0x0A, 0xE7, 0x09, 0xE9, 0x70, 0xEA, 0x70, 0xF7, 0x09, 0xE9, 0x70,
+    0xF7, 0x1E, 0xA7, 0x09, 0xEA, 0x70, 0x9D, 0x97, 0x19, 0x95, 0x77, 0x3A, 0xC7, 0x29, 0xE7, 0x2F,
+    0x71, 0x9E, 0xA7, 0x1A, 0xE7, 0x2E, 0xA7, 0x1A, 0xE7, 0x19, 0xE9, 0x71, 0xEA, 0x71, 0xF7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x0A, 0xE7, 0x1E,
+    0xA7, 0x09, 0xE7, 0x1E, 0xA7, 0x0A, 0xE7, 0x09, 0xE9, 0x70, 0xEA, 0x70, 0xF7, 0x0F, 0x79, 0xEA,
+    0x70, 0xE9, 0x71, 0x9A, 0x72, 0x74, 0x91, 0xAD, 0x92, 0x9C, 0xA0, 0xAD, 0x92, 0xE9, 0xAC, 0xA3,
+    0xAF, 0xC9, 0xAA, 0x92, 0x9F, 0xDA, 0x09, 0xAF, 0xAD, 0xA0, 0xEA, 0xD9, 0x3A, 0xCA, 0x0A, 0xD4,
+    0x91, 0xAD, 0x79, 0x93, 0x77, 0x2A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A,
+    0xDA, 0x49, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0xAA, 0xAA, 0xFA, 0xAA, 0xA5, 0xAD, 0xA7, 0x1A, 0xDA,
+    0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0x9A, 0xA9, 0x40, 0x74, 0xAD, 0xA3, 0x9F, 0x4F, 0x4F, 0x4E,
+    0x93, 0xF3, 0xAE, 0x3F, 0x49, 0xA9, 0x40, 0x71, 0xAF, 0xF0, 0xFF, 0xC0, 0xFF, 0xC7, 0x20, 0x69,
+    0xE1, 0xF0, 0x9F, 0x09, 0xE9, 0x19, 0x92, 0x74, 0xEA, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73,
+    0x9E, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE9, 0x73, 0xEA, 0x73, 0x9E,
+    0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4E,
+    0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x59, 0x97, 0x50, 0x77, 0x71, 0xAF, 0xC9, 0x70, 0x9F, 0xFC, 0x6F,
+    0xFE, 0xA4, 0xFC, 0x90, 0x9F, 0xC3, 0xAE, 0xA4, 0xF9, 0x19, 0xF5, 0xFA, 0x1F, 0x95, 0xFA, 0x09,
+    0xF6, 0xF9, 0x0A, 0xEA, 0x6F, 0x90, 0xF9, 0x6F, 0x90, 0xF7, 0xF0, 0x9F, 0x69, 0xF0, 0x9F, 0x6F,
+    0x90, 0xAF, 0x6F, 0x19, 0xF5, 0xF9, 0x19, 0xF4, 0xAF, 0x3F, 0xC2, 0xAF, 0x4A, 0xFF, 0xE6, 0xFF,
+    0xCA, 0x70, 0xAF, 0xD9, 0x74, 0x97, 0x20, 0x77, 0x4A, 0xD9, 0x5A, 0xFD, 0x3F, 0xFA, 0x3F, 0xF9,
+    0x69, 0xF9, 0x6A, 0xF7, 0xAF, 0x7F, 0xA7, 0xF9, 0x69, 0xF7, 0xAF, 0x7F, 0xC7, 0xFA, 0x69, 0xF9,
+    0x69, 0xF7, 0xAF, 0x7F, 0xC5, 0x9A, 0xFC, 0xA9, 0x19, 0xFF, 0xD9, 0x0F, 0xFE, 0x10, 0x77, 0x7A,
+    0xFC, 0xA7, 0xAF, 0xFC, 0x94, 0xAF, 0xFE, 0x3A, 0xF9, 0x19, 0xFA, 0x2F, 0x4F, 0xA2, 0xE5, 0xFA,
+    0x39, 0x95, 0xF9, 0x72, 0xAF, 0x72, 0xAF, 0x97, 0x1A, 0xF9, 0x71, 0xAF, 0xA7, 0x1A, 0xFA, 0x71,
+    0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xA7, 0x19, 0xF9, 0x71, 0xAF, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF,
+    0xFF, 0xD1, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xA2, 0x77, 0x7A, 0xFC, 0xA7, 0xAF, 0xFC, 0x5A, 0xFF,
+    0xE3, 0x9F, 0x91, 0x9F, 0x39, 0xE4, 0xF4, 0xD5, 0xF7, 0x3A, 0xEA, 0x72, 0xAE, 0xA7, 0x1A, 0xFA,
+    0x7A, 0xFE, 0x70, 0xFF, 0xC7, 0xAC, 0xAA, 0xAF, 0xC7, 0x39, 0xF7, 0x4F, 0x73, 0xAF, 0x72, 0xAF,
+    0x97, 0x0A, 0xFC, 0xA2, 0x9A, 0xAA, 0xFF, 0xA3, 0xAF, 0xFD, 0x95, 0xFE, 0xA9, 0x71, 0x97, 0x40,
+    0x77, 0x74, 0x9E, 0x73, 0x9F, 0x72, 0x9F, 0xA7, 0x19, 0xFC, 0x97, 0x09, 0xFD, 0x70, 0x9F, 0xE7,
+    0x9E, 0x9A, 0xE6, 0x9E, 0x90, 0xEA, 0x59, 0xE9, 0x1E, 0x94, 0x9E, 0x91, 0x9E, 0x49, 0xE9, 0x2A,
+    0xE3, 0x9E, 0x93, 0xEA, 0x29, 0xFF, 0xFE, 0xAF, 0xFF, 0xFA, 0xAF, 0xFF, 0xE9, 0x09, 0x99, 0x99,
+    0x99, 0x9F, 0x99, 0x97, 0x1E, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x74, 0xF4, 0x4A, 0xFF, 0xD5, 0xFF,
+    0xE4, 0x9F, 0xFE, 0x4A, 0xE9, 0x99, 0x99, 0x99, 0x5F, 0x74, 0xEA, 0x73, 0x9F, 0x97, 0x2F, 0xEA,
+    0x70, 0xFF, 0xC9, 0x79, 0x9A, 0xFD, 0x73, 0xAF, 0xA7, 0x3F, 0xA7, 0x3A, 0xEA, 0x73, 0xAE, 0xA7,
+    0x29, 0xF9, 0x71, 0x9F, 0xC7, 0x09, 0xFD, 0x4F, 0xFE, 0x5F, 0xFC, 0xA6, 0xAF, 0xCA, 0x97, 0x77,
+    0x10, 0x77, 0x73, 0x9A, 0xF9, 0x70, 0x9F, 0xF7, 0xFE, 0xA9, 0x69, 0xFC, 0xA9, 0x70, 0xAF, 0xC7,
+    0x29, 0xFA, 0x72, 0x9F, 0xA7, 0x3F, 0xCA, 0xAA, 0xA7, 0x9F, 0xFD, 0xA5, 0xFF, 0xFA, 0x39, 0xF9,
+    0x19, 0xFC, 0x3A, 0xEA, 0x4F, 0x92, 0xAE, 0x94, 0xF9, 0x2F, 0x94, 0xF9, 0x2F, 0x94, 0xF3, 0xAE,
+    0xA3, 0x9F, 0x39, 0xF9, 0x2F, 0x94, 0xFF, 0xEA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFD, 0x97, 0x49, 0x72,
+    0x1F, 0xFF, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFF, 0xD9, 0x0E, 0xAA, 0xAA, 0xAA, 0xFC, 0x09, 0xE4,
+    0x9F, 0x1A, 0xD9, 0x39, 0xF3, 0xD4, 0xF7, 0x2F, 0x97, 0x1F, 0xA7, 0x1A, 0xF7, 0x19, 0xF7, 0x2F,
+    0x97, 0x1F, 0xC7, 0x1A, 0xF7, 0x2F, 0xA7, 0x1A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xEA, 0x72,
+    0x9E, 0x75, 0x99, 0x73, 0x77, 0x7A, 0xFC, 0x97, 0xAF, 0xFC, 0x5F, 0xCA, 0xAF, 0xA3, 0xAE, 0xA3,
+    0xF3, 0xF4, 0xF3, 0xEA, 0x4F, 0x3F, 0x3A, 0xE9, 0x3A, 0xF9, 0x0F, 0x95, 0xFF, 0xC9, 0x7F, 0xE7,
+    0x9F, 0xFA, 0x5A, 0xF9, 0xFC, 0x93, 0xFA, 0x2A, 0xF2, 0x9E, 0xA4, 0xF9, 0x1F, 0x5A, 0xE9, 0x1F,
+    0x5A, 0xE9, 0x1F, 0xA3, 0xAF, 0x2A, 0xFC, 0xAA, 0xFC, 0x4F, 0xFE, 0x69, 0xFE, 0x97, 0x29, 0x97,
+    0x10, 0x77, 0x71, 0xAF, 0xC9, 0x70, 0xAF, 0xFC, 0x6A, 0xFF, 0xE5, 0xF9, 0x19, 0xF9, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x3F, 0x49, 0xF3, 0xF5, 0xF3, 0xF4, 0x9F, 0x3F, 0x93, 0x9E, 0xA3, 0xFC, 0x3F, 0x93,
+    0x9F, 0xFF, 0x5A, 0xFF, 0xDA, 0x7A, 0xFF, 0x73, 0x9F, 0x97, 0x29, 0xFA, 0x72, 0xAF, 0xA7, 0x19,
+    0xFC, 0xA7, 0x9A, 0xFD, 0x96, 0xFF, 0xA7, 0x0A, 0xFC, 0xA7, 0x49, 0x75, 0x73, 0xAD, 0x92, 0xAE,
+    0xA2, 0xFA, 0x2F, 0x49, 0x97, 0x77, 0x77, 0x72, 0x9E, 0x3F, 0x29, 0xF2, 0x9E, 0x93, 0x99, 0x40,
+    0x77, 0x1A, 0xD9, 0x5A, 0xEA, 0x5F, 0xA5, 0xAE, 0x79, 0x97, 0x77, 0x77, 0x77, 0x77, 0xAD, 0xA5,
+    0x9F, 0x6F, 0x6F, 0x6E, 0x95, 0xF5, 0xAE, 0x5F, 0x69, 0xA9, 0x60, 0x77, 0x7A, 0xCA, 0x70, 0xAF,
+    0x6A, 0xFC, 0x94, 0xAF, 0xA9, 0x4A, 0xFA, 0x59, 0xFA, 0x79, 0xFA, 0x70, 0x9F, 0xCA, 0x70, 0x9F,
+    0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xC7, 0x19, 0xDA, 0x73, 0xA1, 0x9F, 0xFF, 0x99, 0xFF, 0xF9,
+    0x9F, 0xFF, 0x97, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0x99, 0xFF, 0xF9,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x76, 0x9C, 0xA7, 0x2F, 0xA7, 0x0A, 0xFC, 0xA7, 0x0A,
+    0xFC, 0xA7, 0x0A, 0xFC, 0x97, 0x0A, 0xFC, 0x71, 0xF9, 0x6A, 0xFA, 0x49, 0xAF, 0xA4, 0x9F, 0xCA,
+    0x5F, 0xCA, 0x7A, 0xDA, 0x72, 0xA7, 0x20, 0x73, 0xAF, 0x92, 0xAF, 0xD9, 0x1F, 0xF1, 0xEA, 0xF9,
+    0x0A, 0x92, 0xE9, 0x5E, 0x95, 0xE5, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE5, 0x9E, 0x99, 0x39,
+    0xFC, 0x93, 0xFA, 0x59, 0x97, 0x70, 0xAD, 0x94, 0x9E, 0xA4, 0xAE, 0xA4, 0xAE, 0x69, 0x96, 0x77,
+    0x77, 0x59, 0xAF, 0xEA, 0x97, 0x59, 0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xAF, 0xEA, 0x7A, 0xFA, 0x96,
+    0x9F, 0x95, 0xAE, 0xA7, 0x3F, 0x4A, 0xE9, 0x75, 0xE9, 0x29, 0xE9, 0x39, 0xDA, 0x09, 0xAA, 0x2E,
+    0xA2, 0xEA, 0x3F, 0xFC, 0x2A, 0xDA, 0x1A, 0xE3, 0xFA, 0xFA, 0x29, 0xDA, 0x1E, 0x92, 0xAE, 0x2E,
+    0x3A, 0xDA, 0x09, 0xE3, 0xE3, 0xE3, 0xAD, 0xA0, 0xAD, 0xA2, 0xAE, 0x3D, 0xA3, 0xE9, 0x0E, 0x92,
+    0xE9, 0x2A, 0xD9, 0x3E, 0x1E, 0x3E, 0x3E, 0x3A, 0xDA, 0x1E, 0x3E, 0x2A, 0xE2, 0x9E, 0x2E, 0x3E,
+    0x90, 0xAF, 0x19, 0xE9, 0x2E, 0x3F, 0xE9, 0xDA, 0xFA, 0x3E, 0x92, 0xAF, 0xC0, 0x9F, 0xD9, 0x4E,
+    0xA3, 0xAD, 0xA2, 0xAE, 0x96, 0xAE, 0x77, 0x69, 0xEA, 0x77, 0x6F, 0xA7, 0x2A, 0x97, 0x1F, 0xCA,
+    0x99, 0x19, 0x9A, 0xEA, 0x72, 0xFF, 0xFE, 0x74, 0x9F, 0xFE, 0x97, 0x70, 0x99, 0xAA, 0xA9, 0x97,
+    0x30, 0x75, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD,
+    0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72,
+    0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF,
+    0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7,
+    0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x79, 0x9A, 0xAA, 0xA9,
+    0x70, 0xAF, 0xFD, 0xA5, 0xFF, 0xFD, 0x4C, 0xAA, 0xF9, 0x0A, 0xFA, 0x6F, 0x29, 0xF5, 0x9F, 0x3F,
+    0x59, 0xEA, 0x3E, 0xA5, 0xAE, 0x92, 0x9E, 0x95, 0xF9, 0x2F, 0x6F, 0xCA, 0xAF, 0x69, 0xFF, 0xDA,
+    0x6A, 0xFF, 0xEA, 0x5F, 0x92, 0xFC, 0x94, 0xF4, 0xFA, 0x4F, 0x4A, 0xEA, 0x39, 0xF4, 0xAE, 0xA3,
+    0xAE, 0xA4, 0xF4, 0xF9, 0x3A, 0xEA, 0x39, 0xFA, 0xAA, 0xAF, 0xC2, 0x9F, 0xFF, 0xCA, 0x3F, 0xFF,
+    0xA7, 0x77, 0x71, 0x9A, 0xAA, 0xA9, 0x72, 0xAF, 0xFC, 0x95, 0xAF, 0xFE, 0xA4, 0xAF, 0xCA, 0xAA,
+    0xAE, 0xA3, 0xFC, 0xA4, 0xAD, 0x92, 0xAF, 0x6E, 0x3F, 0x96, 0xDA, 0x2A, 0xEA, 0x79, 0x93, 0xF9,
+    0x74, 0x9F, 0x75, 0xAF, 0x75, 0xFC, 0x75, 0xFA, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x97, 0x9A,
+    0x2A, 0xFC, 0x6A, 0xD3, 0xFD, 0xA9, 0x99, 0xAE, 0xA3, 0xAF, 0xFF, 0xC5, 0xAF, 0xFE, 0x79, 0xFF,
+    0x97, 0x49, 0x97, 0x00, 0x69, 0x9A, 0xAA, 0xA9, 0x97, 0x2A, 0xFF, 0xEA, 0x7F, 0xFF, 0xEA, 0x5D,
+    0xAF, 0xA9, 0xAF, 0xDA, 0x7F, 0x39, 0xFC, 0x69, 0xF4, 0x9F, 0xA5, 0x9F, 0x5F, 0xC5, 0xAE, 0xA5,
+    0x9F, 0x5F, 0x95, 0x9F, 0x94, 0xF7, 0xF9, 0x39, 0xF6, 0x9F, 0x4A, 0xF6, 0x9F, 0x4A, 0xEA, 0x6A,
+    0xF4, 0xF9, 0x6F, 0xA4, 0xF6, 0x9F, 0x49, 0xF6, 0xFA, 0x4A, 0xEA, 0x5F, 0xC5, 0xFA, 0x3A, 0xFC,
+    0x59, 0xFF, 0xFD, 0x49, 0xFF, 0xFD, 0x95, 0xFF, 0xFA, 0x97, 0x77, 0x50, 0x77, 0x71, 0xFF, 0xFE,
+    0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4,
+    0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF,
+    0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9,
+    0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x77, 0x70, 0xFF, 0xFD,
+    0x94, 0xFF, 0xFD, 0x69, 0xFC, 0xAA, 0xAA, 0xE7, 0xF9, 0x3E, 0x69, 0xF4, 0xDA, 0x69, 0xF4, 0xD7,
+    0xAE, 0xA7, 0x6F, 0x97, 0x6F, 0x97, 0x59, 0xFF, 0xD9, 0x7A, 0xFF, 0xD7, 0x0F, 0xCA, 0xAA, 0xAA,
+    0x97, 0x0F, 0x97, 0x6F, 0x76, 0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x75, 0x9F, 0xC9, 0x97, 0x19, 0xFF,
+    0xC7, 0x1F, 0xFD, 0x70, 0x71, 0x99, 0xAA, 0xA9, 0x97, 0x2A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFA, 0x4A,
+    0xFC, 0xAA, 0xAA, 0xF9, 0x3F, 0xC9, 0x5E, 0x3A, 0xF7, 0xE3, 0xF9, 0x7D, 0x92, 0xAF, 0x70, 0x94,
+    0xF9, 0x75, 0x9F, 0x76, 0xFC, 0x76, 0xFC, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xA4, 0xAF, 0xEA,
+    0x0F, 0xC4, 0x9A, 0xFD, 0x1F, 0xC7, 0xF9, 0x1F, 0xC9, 0x6F, 0x29, 0xFC, 0x6F, 0x3F, 0xD9, 0x39,
+    0xEA, 0x39, 0xFF, 0xFD, 0x94, 0x9F, 0xFF, 0xC7, 0xAF, 0xFA, 0x97, 0x49, 0x97, 0x00, 0x77, 0x77,
+    0xFF, 0xC2, 0xFF, 0xC5, 0xFF, 0xC2, 0xFF, 0xA6, 0x9F, 0xA5, 0x9F, 0xA7, 0x1F, 0x96, 0xF7, 0x19,
+    0xF6, 0x9F, 0x71, 0x9F, 0x6A, 0xEA, 0x71, 0xAE, 0xA6, 0xFA, 0x71, 0xF9, 0x6F, 0x97, 0x1F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xF7, 0x19, 0xFF, 0xFF, 0x71, 0xAF, 0xFF, 0xEA, 0x71, 0xFA, 0x6F, 0x97, 0x1F,
+    0x96, 0xF9, 0x71, 0xF6, 0x9F, 0x71, 0x9F, 0x6A, 0xF7, 0x1A, 0xF6, 0xAE, 0xA7, 0x1F, 0xA6, 0xF9,
+    0x70, 0x9F, 0xA9, 0x4A, 0xFA, 0x95, 0x9F, 0xFA, 0x1A, 0xFF, 0x94, 0xFF, 0xC9, 0x1F, 0xFC, 0x40,
+    0x77, 0x3F, 0xFC, 0x94, 0xFF, 0xC6, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71,
+    0xFA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x71,
+    0xAF, 0x71, 0xAE, 0xA7, 0x09, 0xFC, 0x95, 0x9F, 0xFA, 0x4F, 0xFC, 0x93, 0x77, 0x73, 0xAF, 0xFA,
+    0x70, 0xFF, 0xC7, 0x29, 0xFC, 0x97, 0x4F, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAE, 0xA7,
+    0x5F, 0x97, 0x5F, 0x97, 0x49, 0xF7, 0x59, 0xF7, 0x5A, 0xEA, 0x75, 0xF9, 0x75, 0xF7, 0x59, 0xF7,
+    0x5A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x5F, 0xA7, 0x0C, 0x91, 0x9F, 0x70, 0xFF, 0xC9,
+    0x70, 0xFF, 0xA7, 0x1F, 0xE9, 0x73, 0xAA, 0xAA, 0x97, 0x30, 0x77, 0x74, 0xFF, 0xC1, 0xFE, 0xA4,
+    0xFF, 0xA1, 0xFE, 0x69, 0xFA, 0x4F, 0x97, 0x0F, 0x4F, 0x71, 0x9F, 0x29, 0xF7, 0x29, 0xF1, 0x9F,
+    0x73, 0xAE, 0xA0, 0x9E, 0xA7, 0x4F, 0x99, 0xEA, 0x75, 0xFA, 0xEA, 0x75, 0x9F, 0xEA, 0x76, 0xAF,
+    0xF7, 0x6F, 0xAF, 0xA7, 0x5F, 0x99, 0xF7, 0x5F, 0x1F, 0xC7, 0x39, 0xF2, 0xFA, 0x72, 0xAE, 0xA2,
+    0xAF, 0xA7, 0x1F, 0x93, 0xFC, 0xA7, 0x9F, 0xA9, 0x29, 0xFC, 0xA4, 0x9F, 0xF9, 0x29, 0xFD, 0x3F,
+    0xFC, 0x49, 0xFA, 0x77, 0x49, 0x40, 0x77, 0x6F, 0xFC, 0x70, 0xFF, 0xC7, 0x19, 0xFA, 0x74, 0xF9,
+    0x73, 0x9F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0x74, 0xFA,
+    0x74, 0xF9, 0x74, 0xF5, 0x9A, 0x93, 0x9F, 0x5D, 0xA3, 0xAF, 0x49, 0xDA, 0x3F, 0xA4, 0xE9, 0x29,
+    0xFC, 0xAA, 0xFD, 0x19, 0xFF, 0xFD, 0xA1, 0xFF, 0xFE, 0x10, 0x77, 0x77, 0x1F, 0xE9, 0x59, 0xFD,
+    0xA5, 0xFE, 0xA5, 0xFE, 0x7A, 0xFC, 0xA4, 0xAF, 0xC9, 0x70, 0xAF, 0xCA, 0x4F, 0xD7, 0x1F, 0xE3,
+    0xAF, 0xD7, 0x09, 0xFE, 0x3E, 0xAE, 0x70, 0xAD, 0x9A, 0xE2, 0xAD, 0x9F, 0x70, 0xE0, 0xAE, 0x2D,
+    0xA0, 0xF7, 0x0E, 0x09, 0xE9, 0x0E, 0x1F, 0x7A, 0xDA, 0x1E, 0xA9, 0xDA, 0x1F, 0x7E, 0x91, 0xEA,
+    0xE2, 0xEA, 0x7E, 0x2F, 0xDA, 0x19, 0xEA, 0x69, 0xDA, 0x2A, 0xFC, 0x29, 0xEA, 0x6E, 0x92, 0xAF,
+    0x92, 0x9E, 0xA6, 0xE3, 0x9F, 0x3A, 0xEA, 0x59, 0xE4, 0xE9, 0x3A, 0xE9, 0x5A, 0xDA, 0x4E, 0x4A,
+    0xE9, 0x49, 0xEA, 0x49, 0x94, 0x9F, 0xC9, 0x2F, 0xE9, 0x79, 0xFF, 0x90, 0xAF, 0xE7, 0x0A, 0xFF,
+    0x10, 0x77, 0x74, 0xFD, 0xA4, 0x9F, 0xEA, 0x3F, 0xE4, 0x9F, 0xE9, 0x49, 0xFC, 0xA5, 0xAE, 0x97,
+    0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA, 0x79, 0xFE, 0x4E, 0x97, 0xAF, 0xE9, 0x3E, 0x70, 0xEA,
+    0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A, 0xE7, 0x9E, 0x1F, 0xA1, 0xAD, 0xA7, 0xAE, 0x19, 0xF1,
+    0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E, 0x92, 0xAF, 0x9E, 0x70, 0xE4, 0xFF, 0x79, 0xE4, 0xAF,
+    0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A, 0xFC, 0x79, 0xEA, 0x94, 0x9F, 0xC5, 0x9F, 0xEA, 0x4F,
+    0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x49, 0x70, 0x71, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70,
+    0xFF, 0xF9, 0x59, 0xFD, 0xAA, 0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A,
+    0xF9, 0x1F, 0xC7, 0x9F, 0x90, 0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F,
+    0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F,
+    0xC7, 0xFC, 0x2A, 0xFA, 0x5F, 0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE,
+    0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x79, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFE, 0x95, 0xFF,
+    0xFD, 0x94, 0xDA, 0xFA, 0x9A, 0xFC, 0x7F, 0x2A, 0xF9, 0x59, 0xF3, 0xFA, 0x59, 0xF3, 0xFA, 0x5A,
+    0xEA, 0x3F, 0x95, 0xF9, 0x29, 0xF6, 0xF3, 0xFA, 0x59, 0xF1, 0x9F, 0xC6, 0xAF, 0xFD, 0xA7, 0xFF,
+    0xD9, 0x70, 0xFA, 0xAA, 0x97, 0x3F, 0x76, 0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x59, 0xFC, 0x97,
+    0x29, 0xFF, 0xC7, 0x1F, 0xFD, 0x70, 0x71, 0x9A, 0xAA, 0x97, 0x70, 0x9F, 0xFC, 0x75, 0xFF, 0xF9,
+    0x71, 0x9F, 0xDA, 0xAF, 0xD7, 0x1F, 0xC9, 0x3A, 0xFA, 0x7F, 0xC6, 0xFC, 0x6A, 0xF9, 0x6A, 0xF9,
+    0x5F, 0xC7, 0x9F, 0x94, 0x9F, 0x97, 0x9F, 0xA4, 0xAF, 0x70, 0x9F, 0x94, 0xFC, 0x70, 0x9F, 0x94,
+    0xFC, 0x70, 0xAF, 0x94, 0xFC, 0x70, 0xFC, 0x5F, 0xC7, 0x0F, 0xA5, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7,
+    0xFC, 0x6A, 0xFA, 0x5F, 0xC7, 0x0F, 0xC9, 0x29, 0xFC, 0x97, 0x09, 0xFF, 0xFC, 0x73, 0xAF, 0xFD,
+    0xA7, 0x5A, 0xFD, 0xA9, 0x77, 0x09, 0xFA, 0x97, 0x73, 0xAF, 0xCA, 0x97, 0x71, 0x9F, 0xFA, 0x99,
+    0x76, 0xAF, 0xFF, 0xC7, 0x49, 0xFF, 0xE7, 0x69, 0xAF, 0xE7, 0x74, 0x99, 0x30, 0x79, 0x9A, 0xAA,
+    0xA9, 0x72, 0xAF, 0xFE, 0x96, 0xFF, 0xFD, 0x95, 0xCA, 0xAF, 0x90, 0x9F, 0xC7, 0x0F, 0x29, 0xF9,
+    0x69, 0xF3, 0xF9, 0x69, 0xEA, 0x3F, 0x96, 0xAE, 0xA3, 0xF7, 0xF9, 0x2A, 0xF7, 0xF2, 0x9F, 0x79,
+    0xFA, 0xAF, 0xC7, 0x0A, 0xFF, 0xCA, 0x71, 0xFF, 0xC7, 0x3F, 0x99, 0xEA, 0x72, 0xF1, 0xF9, 0x70,
+    0x9F, 0x19, 0xF7, 0x0A, 0xEA, 0x2F, 0xC7, 0xF9, 0x29, 0xFC, 0x59, 0xFA, 0x92, 0xAF, 0xC2, 0x9F,
+    0xF9, 0x2F, 0xD9, 0x0F, 0xFC, 0x4A, 0xF7, 0x71, 0x92, 0x79, 0xAA, 0xA9, 0x97, 0x09, 0xFF, 0xA5,
+    0xAF, 0xFD, 0x93, 0xAF, 0x99, 0x9A, 0xE9, 0x3F, 0x4E, 0x39, 0xF4, 0xE3, 0x9F, 0x4D, 0x93, 0x9F,
+    0xA7, 0x3F, 0xD7, 0x2A, 0xFD, 0xA7, 0x1A, 0xFE, 0x71, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC3,
+    0xD9, 0x4A, 0xF2, 0x9D, 0x94, 0x9F, 0x2A, 0xDA, 0x49, 0xF2, 0xF9, 0x3F, 0xA2, 0xFD, 0xAF, 0xD3,
+    0xAF, 0xFE, 0x6A, 0xFE, 0x97, 0x39, 0x70, 0x77, 0x5F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x1A,
+    0xFA, 0xAF, 0xAA, 0xAF, 0x1E, 0x29, 0xF2, 0x9E, 0x1E, 0x2A, 0xF2, 0x9D, 0x91, 0xDA, 0x2A, 0xEA,
+    0x2A, 0xD2, 0x9A, 0x3F, 0x92, 0x9A, 0x71, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97,
+    0x6F, 0x76, 0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xFA, 0x97, 0x2F, 0xFC, 0x97,
+    0x1F, 0xFC, 0x70, 0x77, 0x6F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9,
+    0x39, 0xF7, 0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49,
+    0xF7, 0xEA, 0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7,
+    0xEA, 0x49, 0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF, 0xFC, 0xA7,
+    0x0F, 0xFE, 0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x77, 0x7F, 0xFC, 0x3F, 0xF1, 0xFF, 0xA3,
+    0xFE, 0x92, 0x9F, 0xA6, 0xAF, 0x5F, 0x96, 0xF6, 0xFA, 0x59, 0xE9, 0x6A, 0xEA, 0x5F, 0x79, 0xF4,
+    0x9E, 0x97, 0x0F, 0x4E, 0xA7, 0x1F, 0x39, 0xE7, 0x2F, 0x3E, 0xA7, 0x2A, 0xE9, 0x1A, 0xE7, 0x39,
+    0xE9, 0x1E, 0x97, 0x39, 0xEA, 0x0A, 0xE7, 0x5E, 0xA0, 0xE7, 0x6F, 0xAD, 0xA7, 0x6F, 0xE7, 0x7A,
+    0xFC, 0x97, 0x79, 0xFC, 0x77, 0x1F, 0x97, 0x71, 0xEA, 0x77, 0x77, 0x30, 0x77, 0x74, 0xAF, 0xF9,
+    0x29, 0xD3, 0x9F, 0xE9, 0xFF, 0xA3, 0xE3, 0x9F, 0xE1, 0x9F, 0xA4, 0x9E, 0x94, 0xAE, 0xA3, 0xFA,
+    0x4F, 0x94, 0xF4, 0xFA, 0x39, 0xF9, 0x39, 0xE5, 0xAE, 0xA3, 0xFC, 0x93, 0xEA, 0x5A, 0xEA, 0x29,
+    0xFC, 0x92, 0x9E, 0x6A, 0xEA, 0x2F, 0xDA, 0x2E, 0xA6, 0x9E, 0xA1, 0x9D, 0xAE, 0xA1, 0x9E, 0x79,
+    0xEA, 0x1E, 0x0E, 0xA1, 0xEA, 0x70, 0xEA, 0x09, 0xDA, 0x0A, 0xDA, 0x09, 0xE7, 0x1F, 0x0E, 0x1A,
+    0xDA, 0x0E, 0xA7, 0x1F, 0x9D, 0xA1, 0xAE, 0x9E, 0x72, 0xFA, 0xD9, 0x19, 0xFD, 0xA7, 0x2F, 0xE2,
+    0x9F, 0xD7, 0x3A, 0xFC, 0x92, 0x9F, 0xCA, 0x73, 0xAF, 0xC3, 0x9F, 0xC7, 0x4A, 0xF9, 0x4F, 0x97,
+    0x49, 0xF5, 0xF7, 0x59, 0xE9, 0x5E, 0x97, 0x77, 0x77, 0x77, 0x74, 0xFF, 0x91, 0xFF, 0x4F, 0xF2,
+    0xFE, 0x95, 0xAF, 0xA4, 0xF9, 0x70, 0xFC, 0x3A, 0xE9, 0x71, 0x9F, 0x29, 0xE9, 0x73, 0xFA, 0x09,
+    0xE9, 0x74, 0x9F, 0x9E, 0xA7, 0x6F, 0xEA, 0x77, 0x9F, 0xCA, 0x77, 0x1F, 0xC7, 0x71, 0x9F, 0xC7,
+    0x71, 0xFD, 0xA7, 0x7E, 0xAF, 0x76, 0xEA, 0x0F, 0xA7, 0x4F, 0x19, 0xF7, 0x3F, 0x3F, 0xA7, 0x1A,
+    0xE4, 0x9F, 0x70, 0xAE, 0xA4, 0x9F, 0xA9, 0x4A, 0xFE, 0x91, 0xFF, 0xA3, 0xFF, 0x19, 0xFF, 0x92,
+    0x77, 0x5F, 0xF9, 0x1F, 0xF1, 0xFF, 0x2F, 0xE9, 0x2F, 0xC5, 0xAE, 0xA4, 0x9F, 0x5E, 0xA6, 0xF9,
+    0x3F, 0x7A, 0xEA, 0x29, 0xE7, 0x1F, 0x2E, 0x97, 0x1F, 0x90, 0xEA, 0x72, 0xAE, 0xAA, 0xE7, 0x4F,
+    0xE7, 0x5F, 0xD9, 0x75, 0x9F, 0xA7, 0x7F, 0x77, 0x9F, 0x77, 0xAE, 0xA7, 0x7F, 0xA7, 0x7F, 0x97,
+    0x6A, 0xFA, 0x97, 0x3F, 0xFC, 0x97, 0x2F, 0xFC, 0x71, 0x77, 0x6F, 0xFF, 0xD4, 0xFF, 0xFD, 0x92,
+    0x9E, 0xAA, 0xAA, 0xAA, 0xFC, 0x92, 0xAD, 0xA4, 0xAF, 0xA3, 0xAD, 0x49, 0xFA, 0x49, 0xD3, 0x9F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC4, 0x9A, 0x94, 0xAF, 0x94, 0xE3, 0xAF, 0xA4, 0x9E, 0x29, 0xFA, 0x5F, 0x2F, 0xCA,
+    0xAA, 0xAF, 0xD9, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xCA, 0x77, 0x50, 0x6F, 0xD6, 0x9F, 0xD6, 0xAF,
+    0xCA, 0x6E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70,
+    0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70,
+    0x9E, 0x71, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1F, 0xD9, 0x6F,
+    0xD9, 0x6A, 0xAA, 0xAA, 0xA6, 0x0E, 0x71, 0xEA, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0xAD, 0xA7, 0x09,
+    0xE7, 0x1E, 0x97, 0x0A, 0xE7, 0x1E, 0x71, 0xEA, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0xAD, 0xA7, 0x09,
+    0xE7, 0x1E, 0x97, 0x0A, 0xE7, 0x09, 0xE7, 0x1E, 0xA7, 0x0A, 0xE7, 0x1E, 0x97, 0x0E, 0xA7, 0x09,
+    0xE7, 0x19, 0x99, 0x00, 0x6F, 0xD6, 0xAF, 0xD6, 0xAF, 0xCA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE,
+    0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09,
+    0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09,
+    0xE7, 0x1A, 0xE7, 0x1F, 0x71, 0xEA, 0x6F, 0xD9, 0x59, 0xFD, 0x7A, 0xAA, 0xAA, 0x96, 0x59, 0xAA,
+    0x97, 0x3F, 0x72, 0x9F, 0x97, 0x1F, 0xD7, 0x1F, 0xD7, 0x0A, 0xD9, 0x9D, 0xA7, 0xE1, 0xE6, 0x9D,
+    0xA1, 0xE9, 0x5E, 0x91, 0x9E, 0x49, 0xE3, 0xE9, 0x3A, 0xDA, 0x3A, 0xDA, 0x3E, 0x93, 0x9E, 0x2A,
+    0xE5, 0xEA, 0x1A, 0xDA, 0x5A, 0xDA, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xA7, 0x60, 0x6C, 0xA2, 0xAD, 0x91, 0xF1, 0x9F, 0x19, 0xE9, 0x2E, 0x3A, 0x00,
+    0x69, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3,
+    0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2,
+    0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F,
+    0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x59, 0x97, 0x19, 0xFD, 0x70, 0xFE, 0x70, 0x99, 0xAE,
+    0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA2, 0x99, 0x59, 0xE1, 0xAF, 0x93, 0x9E, 0x0F,
+    0xE3, 0xAD, 0xAA, 0xFE, 0x3E, 0xAD, 0x1F, 0x92, 0xFC, 0x2A, 0xE9, 0x19, 0xF9, 0x2F, 0x2A, 0xF3,
+    0xF2, 0xF9, 0x3F, 0x2F, 0x39, 0xEA, 0x2E, 0xA3, 0xF2, 0xAE, 0x92, 0x9E, 0xA2, 0xF9, 0x2F, 0x3F,
+    0xCA, 0xAF, 0x92, 0x9F, 0xFD, 0x93, 0x9D, 0xAA, 0xFA, 0x74, 0x97, 0x79, 0x99, 0x7A, 0xFC, 0x93,
+    0x9F, 0xF2, 0x9F, 0xFA, 0x2F, 0x29, 0xC2, 0xAE, 0x70, 0xEA, 0x7A, 0xE9, 0x7F, 0x70, 0xF7, 0x0F,
+    0x70, 0xF4, 0xAA, 0x1F, 0xC1, 0x9E, 0x1F, 0xFD, 0x91, 0x9F, 0xF9, 0x39, 0xFC, 0xA7, 0x09, 0x60,
+    0x75, 0x99, 0x72, 0x9F, 0xCA, 0x71, 0xFE, 0x71, 0x99, 0xAE, 0xA7, 0x39, 0xE9, 0x73, 0xAE, 0x74,
+    0xF7, 0x99, 0x91, 0xEA, 0x59, 0xFC, 0xAE, 0x94, 0x9F, 0xFD, 0x49, 0xFA, 0x9F, 0xC4, 0xF3, 0xEA,
+    0x3A, 0xE9, 0x3E, 0x93, 0xF3, 0x9E, 0x39, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2,
+    0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F,
+    0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x79, 0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xE9,
+    0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2E, 0x2A, 0xE2, 0xAE, 0x1A, 0xE3, 0xFA, 0xF4, 0xFE,
+    0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2, 0x9E, 0x2A, 0xFF, 0xCA, 0x3F, 0xF9, 0x49, 0xFC, 0xA7,
+    0x19, 0x70, 0x77, 0xAA, 0xA9, 0x77, 0xAF, 0xD7, 0x5F, 0xFA, 0x73, 0xAE, 0x1A, 0xD9, 0x73, 0xEA,
+    0x2A, 0x97, 0x3A, 0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x76, 0x9A, 0xFF, 0xA7, 0x1F, 0xFE, 0x97, 0x1A,
+    0xAA, 0xFA, 0xAA, 0x97, 0x5F, 0x77, 0x09, 0xEA, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F,
+    0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x77,
+    0x09, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x74, 0xA3, 0xEA, 0x73, 0xAD, 0x90, 0xAE, 0x74, 0xFF,
+    0xA7, 0x4F, 0xEA, 0x76, 0xAE, 0xA7, 0x60, 0x70, 0x99, 0x99, 0x75, 0xAF, 0xFE, 0x6F, 0xFF, 0xC5,
+    0xF9, 0x1E, 0xA9, 0x95, 0x9E, 0x92, 0xAE, 0x7A, 0xE3, 0xAE, 0x7A, 0xE3, 0xF7, 0xAE, 0x2A, 0xE9,
+    0x70, 0xEA, 0x9A, 0xEA, 0x71, 0x9F, 0xE9, 0x73, 0x9F, 0x97, 0x4A, 0xE7, 0x69, 0xEA, 0x77, 0xFC,
+    0xA7, 0x39, 0xAF, 0xEA, 0x70, 0xFA, 0xAF, 0xD9, 0x49, 0xEA, 0x3A, 0xFC, 0x4F, 0x6F, 0x93, 0xF6,
+    0xAE, 0x93, 0xFA, 0x49, 0xF4, 0x9F, 0xFF, 0xC6, 0x9F, 0xFD, 0xA7, 0x19, 0xAF, 0xA9, 0x70, 0x59,
+    0x97, 0x29, 0xFD, 0x71, 0xFE, 0x71, 0x99, 0xAF, 0x73, 0x9E, 0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x4E,
+    0xA2, 0x99, 0x95, 0x9E, 0x90, 0x9F, 0xA4, 0xAE, 0x0A, 0xFD, 0x4A, 0xEA, 0xFE, 0x93, 0xFD, 0x90,
+    0xAE, 0x4F, 0xC9, 0x1F, 0x39, 0xFA, 0x2E, 0xA3, 0xAF, 0x29, 0xE9, 0x3F, 0x92, 0xAE, 0x4F, 0x3F,
+    0x39, 0xEA, 0x3E, 0xA3, 0xAE, 0x92, 0x9E, 0x93, 0xF9, 0x2A, 0xE9, 0x9C, 0x90, 0xF3, 0xFE, 0x90,
+    0xF3, 0xFD, 0xA0, 0x9E, 0x93, 0x9F, 0x97, 0x49, 0x40, 0x75, 0xE4, 0xF9, 0x29, 0xF9, 0x3F, 0x49,
+    0xA9, 0x76, 0x99, 0x3A, 0xFA, 0x1F, 0xE1, 0x99, 0xAE, 0xA3, 0x9E, 0x93, 0xAE, 0x4F, 0x4E, 0xA3,
+    0xAE, 0x93, 0xF4, 0xEA, 0x39, 0xE9, 0x3A, 0xE9, 0x9C, 0x90, 0xAF, 0xD9, 0x0A, 0xFC, 0xA1, 0x9F,
+    0x94, 0x95, 0x77, 0x73, 0xAD, 0xA7, 0x2A, 0xF7, 0x2F, 0xC7, 0x2A, 0xE9, 0x73, 0xAA, 0x77, 0x74,
+    0x99, 0x97, 0x1A, 0xFC, 0x70, 0x9F, 0xD7, 0x19, 0x9F, 0x73, 0xF7, 0x3F, 0x72, 0x9E, 0xA7, 0x2A,
+    0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x29,
+    0xE9, 0x72, 0xAE, 0x73, 0xF5, 0xA9, 0x2A, 0xE9, 0x49, 0xDA, 0x9A, 0xEA, 0x5A, 0xFF, 0x69, 0xFE,
+    0x70, 0x9A, 0xDA, 0x97, 0x00, 0x59, 0x97, 0x09, 0xFD, 0x7F, 0xE7, 0x99, 0xAF, 0x71, 0x9E, 0xA7,
+    0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x29, 0x94, 0x9E, 0x1A, 0xF3, 0x9E, 0x0F, 0xDA, 0x2A, 0xDA, 0xDA,
+    0x9F, 0x2F, 0xC9, 0x1A, 0xDA, 0x2F, 0x92, 0xE9, 0x19, 0xEA, 0x2A, 0xE2, 0xAE, 0x2A, 0xE3, 0xFA,
+    0xFA, 0x4F, 0xE9, 0x59, 0xEA, 0xE9, 0x5A, 0xE0, 0xAE, 0x5F, 0x1F, 0x93, 0xF1, 0x9F, 0xCA, 0x90,
+    0xEA, 0x2A, 0xFC, 0xA9, 0xE9, 0x39, 0xF7, 0x39, 0x20, 0x59, 0x92, 0x9F, 0xCA, 0x1F, 0xE1, 0x99,
+    0xAE, 0xA3, 0x9E, 0x93, 0xAE, 0x4F, 0x4F, 0x39, 0xEA, 0x3A, 0xE9, 0x3F, 0x4F, 0x4E, 0xA3, 0x9E,
+    0x93, 0xAE, 0x4F, 0x4E, 0xA3, 0x9E, 0xA3, 0xAE, 0x93, 0xF9, 0xAC, 0x1F, 0xE1, 0xFD, 0xA1, 0xAF,
+    0x94, 0x94, 0x39, 0x99, 0x49, 0x95, 0x99, 0x39, 0xFC, 0x91, 0xAE, 0xA2, 0xFC, 0x2F, 0xDA, 0x0F,
+    0xD0, 0x9F, 0xD2, 0x99, 0xAE, 0x9F, 0xE9, 0xFE, 0x93, 0x9F, 0xCA, 0x09, 0xFC, 0x90, 0xAE, 0x49,
+    0xFC, 0x1A, 0xFA, 0x1F, 0x4A, 0xF2, 0xFC, 0x2F, 0x4F, 0x92, 0xF2, 0x9E, 0xA4, 0xF2, 0x9F, 0x2A,
+    0xE9, 0x39, 0xEA, 0x2A, 0xE9, 0x2F, 0x4A, 0xE9, 0x2F, 0x3E, 0xA4, 0xF3, 0xF2, 0x9E, 0x94, 0xF2,
+    0x9E, 0xA2, 0xAE, 0x99, 0xC9, 0x09, 0xEA, 0x2A, 0xE9, 0x2A, 0xFD, 0x90, 0xAE, 0x92, 0xAE, 0x3A,
+    0xFD, 0x1F, 0x3E, 0xA3, 0x9F, 0x97, 0x74, 0x94, 0x39, 0x99, 0x49, 0x94, 0x9F, 0xCA, 0x1A, 0xF9,
+    0x2F, 0xDA, 0x0F, 0xE2, 0x99, 0xAE, 0xAF, 0xF4, 0x9F, 0xD1, 0xF4, 0x9F, 0xC2, 0xEA, 0x4A, 0xF2,
+    0x9E, 0x94, 0xFA, 0x2A, 0xE5, 0xF3, 0xF4, 0x9E, 0xA2, 0x9E, 0xA4, 0xAE, 0x92, 0xAE, 0x94, 0xF3,
+    0xF5, 0xF3, 0xF0, 0xAC, 0x19, 0xEA, 0x3F, 0xE1, 0xAE, 0x93, 0xFD, 0x91, 0xF4, 0xAE, 0xA7, 0x69,
+    0x40, 0x79, 0x99, 0x70, 0x9F, 0xE5, 0xAF, 0xFC, 0x3A, 0xF9, 0xAF, 0x91, 0x9E, 0xA2, 0xAF, 0x1F,
+    0x39, 0xF0, 0x9E, 0xA4, 0xF0, 0xAE, 0x94, 0xF0, 0xF4, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0xF4, 0xF1,
+    0xF3, 0x9E, 0xA1, 0xF9, 0x19, 0xF2, 0xAF, 0xAA, 0xF4, 0xFF, 0xC6, 0xAF, 0xCA, 0x71, 0x99, 0x70,
+    0x69, 0x99, 0x39, 0x99, 0x5A, 0xFC, 0x19, 0xFA, 0x4F, 0xD9, 0x9F, 0xD9, 0x39, 0x9A, 0xEA, 0xFE,
+    0xA5, 0x9F, 0xC9, 0x09, 0xEA, 0x5A, 0xF9, 0x19, 0xEA, 0x5F, 0xC2, 0x9E, 0xA5, 0xF3, 0x9E, 0xA4,
+    0x9E, 0xA3, 0xAE, 0x94, 0x9E, 0x93, 0xF5, 0xAE, 0x39, 0xEA, 0x5F, 0x3F, 0x6E, 0xA2, 0xAE, 0xA5,
+    0x9F, 0xCA, 0xFA, 0x6A, 0xFF, 0xCA, 0x7F, 0xAF, 0x97, 0x0E, 0xA1, 0x97, 0x29, 0xEA, 0x75, 0xAE,
+    0x97, 0x5F, 0x75, 0xAF, 0xCA, 0xA7, 0x1F, 0xFC, 0x71, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x00, 0x69,
+    0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xD9, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE,
+    0x93, 0xEA, 0x3F, 0x3A, 0xE9, 0x2A, 0xE9, 0x3F, 0x3F, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9,
+    0x3F, 0x2F, 0xC4, 0xF1, 0xDA, 0xE4, 0xFE, 0xA9, 0xE4, 0xAF, 0xD0, 0xAD, 0xA5, 0xFA, 0x1E, 0xA7,
+    0x93, 0xE9, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xF7, 0x2A, 0xFD, 0x97, 0xFF, 0xA7, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x30, 0x49, 0x93, 0x99, 0x29, 0xFC, 0xA1, 0xF1, 0xFD, 0xA0, 0xFC, 0x19, 0x99, 0xE9, 0xAF,
+    0xC4, 0xE9, 0xEA, 0xC9, 0x39, 0xFC, 0x97, 0xAF, 0xA7, 0x0A, 0xF7, 0x1F, 0xA7, 0x1F, 0x71, 0x9E,
+    0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x70, 0x79, 0x99, 0x79, 0xFD,
+    0xA4, 0x9F, 0xF3, 0x9E, 0x99, 0x9E, 0x3A, 0xE3, 0xA9, 0x3F, 0x97, 0x0A, 0xFA, 0x70, 0xFD, 0x70,
+    0xFD, 0x70, 0xAF, 0xA7, 0x0A, 0xF2, 0x9D, 0x3F, 0x2F, 0x2F, 0x2F, 0xCA, 0xAE, 0x92, 0xAF, 0xFA,
+    0x49, 0xFD, 0x97, 0x19, 0x60, 0x5A, 0xD7, 0x0E, 0xA7, 0x9E, 0xA7, 0xAE, 0x95, 0x9A, 0xFF, 0x1F,
+    0xFE, 0x1A, 0xAA, 0xFA, 0xAA, 0x93, 0xAE, 0x97, 0xF9, 0x7F, 0x70, 0xF7, 0x9E, 0xA7, 0xAE, 0x97,
+    0xF7, 0x0F, 0x29, 0xC3, 0xF9, 0x9A, 0xD9, 0x2F, 0xFC, 0x3F, 0xF4, 0x9F, 0xC9, 0x70, 0x96, 0x39,
+    0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99, 0xAE, 0x92, 0x9E, 0xA4, 0x9E, 0x3A,
+    0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4, 0xAE, 0x3F, 0x94, 0xF2, 0x9F, 0x5E,
+    0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD, 0x9E, 0x9D, 0x1A, 0xFE, 0x0A, 0xFD,
+    0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x29, 0x95, 0x99, 0x2A, 0xF9, 0x2F, 0x99,
+    0xFD, 0x2F, 0xA9, 0xAA, 0xF2, 0x9F, 0x2F, 0x92, 0xEA, 0x29, 0xE9, 0x19, 0xE9, 0x29, 0xEA, 0x19,
+    0xE4, 0xEA, 0x1A, 0xDA, 0x4E, 0xA1, 0xE5, 0xF0, 0xAD, 0xA5, 0xAE, 0x0E, 0x6A, 0xFD, 0x7A, 0xFC,
+    0x97, 0x9F, 0xA7, 0x09, 0xEA, 0x71, 0x9D, 0xA7, 0x75, 0x29, 0x95, 0x99, 0x49, 0x92, 0xAF, 0x29,
+    0xE9, 0x2F, 0x0A, 0xFC, 0xA2, 0xF2, 0xAE, 0x99, 0x9A, 0xF2, 0xAE, 0x29, 0xEA, 0x2F, 0x29, 0xE9,
+    0x2E, 0x92, 0x9E, 0x91, 0x9E, 0xA2, 0xE4, 0xE9, 0x1A, 0xEA, 0x19, 0xE4, 0xEA, 0x1F, 0xC1, 0xAD,
+    0x94, 0xEA, 0x09, 0xFC, 0x1E, 0x5A, 0xDA, 0x0F, 0xD0, 0x9D, 0xA5, 0xAE, 0x9D, 0x9E, 0x0E, 0x69,
+    0xFC, 0xA0, 0xEA, 0xD9, 0x69, 0xFC, 0x1F, 0xCA, 0x79, 0xF9, 0x1F, 0xC7, 0x09, 0xE9, 0x2F, 0x72,
+    0xDA, 0x3A, 0xD7, 0x77, 0x40, 0x59, 0x95, 0x99, 0x93, 0x9F, 0x93, 0xFA, 0x19, 0xFD, 0x2F, 0xCA,
+    0x19, 0xFD, 0x90, 0xAF, 0xC9, 0x49, 0xEA, 0x9D, 0xA7, 0x1F, 0xDA, 0x72, 0x9F, 0xC7, 0x4F, 0x97,
+    0x4A, 0xE9, 0x74, 0xFC, 0x73, 0xFD, 0x72, 0xAD, 0xAE, 0xA5, 0xA9, 0x9A, 0xDA, 0x0F, 0x5F, 0xD1,
+    0xAF, 0xDA, 0x09, 0xFC, 0x29, 0xFD, 0x91, 0xF4, 0xAF, 0x93, 0x97, 0x60, 0x79, 0x95, 0x99, 0x7A,
+    0xF9, 0x2F, 0x94, 0x9F, 0xD2, 0xAE, 0xA4, 0x99, 0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA, 0x79, 0xE9,
+    0x19, 0xE9, 0x70, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71, 0xAE, 0x09,
+    0xE7, 0x2A, 0xE0, 0xE9, 0x72, 0x9E, 0x9D, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74, 0x9F, 0xA7,
+    0x59, 0xF7, 0x6F, 0x76, 0x9E, 0x71, 0xA3, 0x9E, 0x97, 0x0A, 0xDA, 0xAF, 0x97, 0x1F, 0xF7, 0x3F,
+    0xDA, 0x75, 0xAD, 0xA7, 0x50, 0x49, 0x94, 0x99, 0x39, 0xFC, 0x90, 0x9E, 0x2F, 0xFF, 0x19, 0xFF,
+    0xE9, 0x19, 0xD9, 0x19, 0xF9, 0x29, 0xD3, 0xE9, 0x49, 0x92, 0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71,
+    0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x3A, 0xC9, 0x2F, 0xA9, 0x90, 0x9E, 0x1F, 0xFF, 0xC0, 0x9E, 0xAF,
+    0xF9, 0x1E, 0x19, 0xFC, 0xA7, 0x39, 0x30, 0x77, 0x39, 0xF6, 0xFD, 0x5A, 0xFA, 0xA5, 0xE9, 0x79,
+    0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0E, 0xA6, 0xAF,
+    0x7F, 0x70, 0x9E, 0xA7, 0x0A, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xD9,
+    0x70, 0xE7, 0x09, 0xE7, 0x09, 0xDA, 0x70, 0xAE, 0x70, 0x9F, 0xD6, 0xFD, 0x7A, 0xDA, 0x95, 0x77,
+    0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x5E,
+    0x95, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0x95, 0xE6, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0x95, 0xE5, 0x9E,
+    0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x59, 0x99, 0x50, 0x77, 0x29, 0xF9, 0x6F, 0xD6, 0xAA, 0xFA, 0x70,
+    0xAD, 0xA7, 0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x0A, 0xDA,
+    0x70, 0xAD, 0x97, 0x0A, 0xDA, 0x70, 0x9F, 0x70, 0xF7, 0xF9, 0x6F, 0x70, 0xE9, 0x70, 0xE7, 0x09,
+    0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE5, 0xAF, 0xCA, 0x5F, 0xCA, 0x6A,
+    0xDA, 0x96, 0x29, 0x97, 0x19, 0xFA, 0x3A, 0xCA, 0x0F, 0xE9, 0x09, 0xFE, 0xAF, 0xFA, 0xE2, 0xAF,
+    0xD1, 0xAA, 0x39, 0xAD, 0xA7, 0x70, 0x69, 0x69, 0xE5, 0xF9, 0x4F, 0x5A, 0xD9, 0x77, 0x19, 0x6A,
+    0xD6, 0xE6, 0xDA, 0x59, 0xDA, 0x5A, 0xDA, 0x5E, 0x95, 0xE9, 0x49, 0xE5, 0xAE, 0x5F, 0x49, 0xEA,
+    0x4A, 0xE9, 0x4F, 0x49, 0xF4, 0xAE, 0x94, 0xAA, 0xA9, 0x40, 0x77, 0x71, 0xAD, 0x74, 0xDA, 0x74,
+    0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x72, 0x99, 0xEA, 0x96, 0x9F, 0xFA, 0x4A, 0xFF, 0xD3, 0xFC, 0xAD,
+    0x9E, 0x2A, 0xEA, 0x0A, 0xCA, 0x19, 0x92, 0xEA, 0x1D, 0x95, 0xAE, 0x2D, 0x6F, 0x19, 0xD6, 0xEA,
+    0x1A, 0xCA, 0x6E, 0xA1, 0xD9, 0x6E, 0xA1, 0xD7, 0xF0, 0x9D, 0x2A, 0xC2, 0xAF, 0xAC, 0xA0, 0x9E,
+    0x3F, 0xFE, 0x93, 0x9F, 0xFC, 0x7A, 0xFA, 0x97, 0x1A, 0xD7, 0x4A, 0xCA, 0x74, 0xDA, 0x74, 0xD9,
+    0x73, 0x9D, 0x74, 0xAD, 0x74, 0x99, 0x71, 0x77, 0x75, 0x9A, 0xF9, 0x72, 0xFF, 0x97, 0x0F, 0xAF,
+    0xC7, 0xAE, 0x2A, 0xE7, 0xE9, 0x29, 0xDA, 0x6A, 0xE3, 0x9C, 0xA7, 0xEA, 0x75, 0x9E, 0x97, 0x5F,
+    0x73, 0xAF, 0xFE, 0x6F, 0xFF, 0x6A, 0xAF, 0xAA, 0xAA, 0xA9, 0x70, 0xF7, 0x6E, 0xA7, 0x59, 0xE9,
+    0x75, 0xAE, 0x73, 0x99, 0x0E, 0xA5, 0x99, 0xA2, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0x19, 0xF9, 0x09,
+    0xAF, 0xE3, 0x9A, 0x97, 0x60, 0x29, 0x73, 0x92, 0xAC, 0xA2, 0x99, 0x99, 0x19, 0xD2, 0xAD, 0xAA,
+    0xFD, 0xAE, 0x92, 0xAF, 0xFF, 0x5F, 0x90, 0x9F, 0x6E, 0x39, 0xE5, 0xAD, 0x94, 0xE5, 0xE4, 0x9D,
+    0xA5, 0xE4, 0xE9, 0x5E, 0x92, 0xAE, 0x5A, 0xFC, 0xAF, 0xC3, 0x9F, 0xFF, 0xD2, 0xAD, 0x90, 0x9E,
+    0xA9, 0x09, 0xDA, 0x2A, 0x72, 0x9A, 0x20, 0x9F, 0xF1, 0x9F, 0xE0, 0xAF, 0xF1, 0xFF, 0x09, 0xAF,
+    0xC9, 0x3A, 0xFA, 0x3F, 0xA4, 0xAE, 0x59, 0xF3, 0x9E, 0x96, 0xF3, 0xEA, 0x7A, 0xE9, 0x1A, 0xE7,
+    0x1F, 0x09, 0xE7, 0x9A, 0xAF, 0x0F, 0xAA, 0x5A, 0xFF, 0xFC, 0x69, 0x99, 0xFC, 0xA9, 0x99, 0x97,
+    0x1A, 0xF7, 0x2A, 0xFF, 0xF6, 0x9F, 0xFE, 0xA7, 0x2F, 0x77, 0xEA, 0x76, 0x9E, 0xA7, 0x59, 0xFA,
+    0x97, 0x29, 0xFF, 0xC7, 0x1A, 0xFF, 0xA7, 0x00, 0x77, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD,
+    0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x77, 0x77, 0x77, 0x6A, 0xAA, 0x6E, 0x59, 0xE5,
+    0xAD, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0x9E, 0x5A, 0xDA, 0x5E, 0x95, 0x99, 0x95, 0x7A, 0xEA, 0x7A,
+    0xFE, 0x49, 0xEA, 0xAF, 0x4E, 0x3E, 0x3F, 0x3A, 0xCA, 0x29, 0xF9, 0x70, 0xD0, 0xE9, 0x7D, 0x09,
+    0xE9, 0x6D, 0x19, 0xEA, 0x5D, 0xA2, 0xF4, 0xAD, 0x92, 0xF4, 0xE9, 0x2E, 0x93, 0x9E, 0xA2, 0xDA,
+    0x49, 0xF1, 0xAD, 0x6F, 0x09, 0xD7, 0xEA, 0x9C, 0xA7, 0x0E, 0xAC, 0x92, 0xD3, 0x9F, 0x2E, 0x39,
+    0xEA, 0x2E, 0xA2, 0xAE, 0x3F, 0xFD, 0x5F, 0xE9, 0x79, 0x9A, 0x99, 0x60, 0x72, 0xAD, 0x19, 0xD9,
+    0xAE, 0x1F, 0xF0, 0x9E, 0x99, 0xCA, 0x2A, 0xC9, 0x00, 0x70, 0x99, 0x99, 0x76, 0x9F, 0xFA, 0x72,
+    0xEA, 0x91, 0x99, 0xAD, 0xA7, 0xDA, 0x70, 0xAC, 0xA5, 0xD9, 0x72, 0xAC, 0xA3, 0xAC, 0x93, 0xAF,
+    0x92, 0xAC, 0x92, 0xD2, 0x9F, 0xE3, 0xD1, 0xAC, 0x92, 0xE1, 0x9D, 0x3A, 0xC1, 0xD2, 0xAD, 0x3C,
+    0xA3, 0x9C, 0xA0, 0xD2, 0xE7, 0x2C, 0xA0, 0xCA, 0x2E, 0x72, 0xD0, 0xCA, 0x2E, 0x72, 0xD0, 0xD2,
+    0xE7, 0x2C, 0xA0, 0xD2, 0xEA, 0x70, 0x9C, 0xA0, 0xAC, 0x91, 0x9F, 0xA9, 0xAC, 0x3A, 0xC2, 0xCA,
+    0x2A, 0xFE, 0x3D, 0x2A, 0xC9, 0x29, 0xAE, 0xA3, 0xAC, 0x93, 0xD9, 0x72, 0xAC, 0xA5, 0xD9, 0x70,
+    0xAD, 0x7E, 0xA9, 0x29, 0xAD, 0xA7, 0x19, 0xFF, 0xA7, 0x69, 0x99, 0x99, 0x70, 0x49, 0xA9, 0x09,
+    0x93, 0x9F, 0xE2, 0x9E, 0xAE, 0xA2, 0xE1, 0x9D, 0x29, 0xD9, 0x1A, 0xD2, 0xAD, 0x2D, 0xA2, 0xDA,
+    0x1A, 0xD9, 0x2E, 0x09, 0xE0, 0xA9, 0x0F, 0xFD, 0x90, 0x9F, 0x0E, 0xA2, 0x99, 0x92, 0x99, 0x72,
+    0x92, 0xAF, 0xF9, 0x09, 0xFF, 0xA2, 0x99, 0x99, 0x99, 0x40, 0x49, 0xCA, 0x4C, 0xA4, 0xAE, 0x29,
+    0xE9, 0x2F, 0x2A, 0xE9, 0x19, 0xF2, 0xF9, 0x19, 0xF2, 0xF9, 0x2A, 0xE9, 0x19, 0xEA, 0x3F, 0xA1,
+    0xAF, 0x4F, 0x2F, 0x94, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA5, 0xD9, 0x3A, 0xCA, 0x77, 0x10, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0xE9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x97, 0x19, 0xAA, 0x90, 0x71, 0xAF, 0xF0, 0xFF,
+    0xC0, 0xFF, 0xC7, 0x20, 0x69, 0x99, 0x72, 0x9F, 0xE9, 0x6A, 0xCA, 0x4A, 0xCA, 0x4A, 0xC9, 0x69,
+    0xC9, 0x3C, 0x90, 0xFC, 0x91, 0xAC, 0x2A, 0xC1, 0x9C, 0xA0, 0xD2, 0xCA, 0x1C, 0xA2, 0xCA, 0x0A,
+    0xC9, 0x1A, 0xC1, 0xC9, 0x2D, 0x9D, 0x2A, 0xC1, 0xC9, 0x2F, 0x3A, 0xC1, 0xCA, 0x2D, 0xAC, 0xA2,
+    0xAC, 0x1D, 0x19, 0xD0, 0xDA, 0x1C, 0xA1, 0x9C, 0x1E, 0xA0, 0xD9, 0x9C, 0x92, 0xD7, 0x0C, 0xA4,
+    0xD9, 0x49, 0xD6, 0xAD, 0xAA, 0xAD, 0xA7, 0x19, 0xAA, 0xA9, 0x50, 0x0F, 0xF9, 0xAF, 0xF9, 0xAF,
+    0xF0, 0x75, 0xAF, 0x93, 0xFE, 0xA1, 0xFA, 0xF9, 0x9E, 0x2A, 0xDA, 0x9D, 0x93, 0xEA, 0xD9, 0x3E,
+    0x9E, 0x2A, 0xDA, 0x0F, 0xAF, 0x19, 0xFE, 0x92, 0x9A, 0xEA, 0x97, 0x40, 0x4A, 0xDA, 0x71, 0xAD,
+    0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x49, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0xAA, 0xAA,
+    0xFA, 0xAA, 0xA9, 0x4A, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0xA7, 0x19, 0xD9, 0x77,
+    0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x75, 0x49, 0xAD, 0xA4,
+    0x9F, 0xE3, 0xEA, 0xAE, 0xA1, 0x9D, 0x91, 0x9D, 0xA2, 0xA9, 0x2A, 0xDA, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0xAE, 0x6E, 0xA5, 0x9E, 0x96, 0xFF, 0xD1, 0xFF, 0xC9, 0x74, 0x39, 0xAD, 0xA4, 0xFE, 0x2A,
+    0xDA, 0x9E, 0x91, 0xAC, 0x29, 0xD9, 0x6E, 0x59, 0xE4, 0xFC, 0xA4, 0xDA, 0xE9, 0x69, 0xDA, 0x6A,
+    0xD9, 0x59, 0xE1, 0xAA, 0xAF, 0xC9, 0x1F, 0xDA, 0x49, 0xAA, 0x95, 0x29, 0x4D, 0x91, 0xEA, 0x09,
+    0xE9, 0x0E, 0xA0, 0xAD, 0xA1, 0xAC, 0x97, 0x00, 0x69, 0x99, 0x59, 0x96, 0x9E, 0x93, 0xEA, 0x6F,
+    0x3A, 0xE9, 0x6F, 0x3F, 0x69, 0xEA, 0x3F, 0x69, 0xE9, 0x3E, 0xA6, 0xAE, 0x39, 0xE9, 0x6F, 0x3A,
+    0xE7, 0xF3, 0xAE, 0x7E, 0xA3, 0xF6, 0x9E, 0xA2, 0x9E, 0xA6, 0x9E, 0xA2, 0xFA, 0x6A, 0xF9, 0x9F,
+    0xD1, 0xC9, 0x2F, 0xFC, 0x9F, 0xD9, 0x2F, 0xF9, 0x0A, 0xFA, 0x29, 0xDA, 0xF9, 0x2E, 0xA3, 0xAD,
+    0xA1, 0x95, 0x95, 0xEA, 0x77, 0xE9, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x77, 0xCA, 0xA7, 0x70,
+    0x77, 0x73, 0x9A, 0xFF, 0xC7, 0xFF, 0xEA, 0x59, 0xFD, 0xA9, 0xD9, 0x69, 0xFE, 0x90, 0xD7, 0xFF,
+    0x99, 0xD6, 0x9F, 0xF0, 0xAC, 0xA6, 0xAF, 0xF0, 0xDA, 0x6A, 0xFE, 0xA0, 0xD9, 0x6A, 0xFE, 0x90,
+    0xD7, 0xAF, 0xE0, 0x9D, 0x79, 0xFE, 0x0A, 0xCA, 0x70, 0xFE, 0x0D, 0xA7, 0x1A, 0xCA, 0xDA, 0x0D,
+    0x97, 0x4D, 0x90, 0xD7, 0x5D, 0x09, 0xD7, 0x49, 0xD0, 0xAD, 0x74, 0xAC, 0xA0, 0xDA, 0x74, 0xD9,
+    0x0D, 0x97, 0x4D, 0x09, 0xD7, 0x4A, 0xD0, 0xD9, 0x74, 0xDA, 0xE7, 0x9C, 0x2F, 0xD7, 0x0A, 0xFD,
+    0xAA, 0x97, 0x2F, 0xA7, 0x77, 0x71, 0x19, 0x91, 0xEA, 0xAF, 0xF9, 0x9D, 0xA5, 0x19, 0xAA, 0x29,
+    0xF2, 0x9E, 0x3D, 0xA2, 0xAD, 0x19, 0xE2, 0x9A, 0x93, 0x49, 0xAC, 0x91, 0x9A, 0xFA, 0x1A, 0xFC,
+    0x92, 0x99, 0xE4, 0x9E, 0x49, 0xDA, 0x4A, 0xD9, 0x4E, 0x5E, 0x49, 0xE4, 0x9D, 0xA2, 0x9F, 0xD9,
+    0x0F, 0xE9, 0x70, 0x59, 0xA9, 0x6A, 0xFC, 0x93, 0xAD, 0xA9, 0xE2, 0x9D, 0xA1, 0xAD, 0x2E, 0x2A,
+    0xD1, 0x9D, 0xA2, 0xE1, 0x9D, 0x91, 0x9D, 0xA1, 0x9D, 0x91, 0xE9, 0x2E, 0x9E, 0xA3, 0x9F, 0xC9,
+    0x69, 0x99, 0x75, 0x92, 0xAF, 0xF1, 0x9F, 0xF9, 0x29, 0x99, 0x99, 0x50, 0x2A, 0xC9, 0x39, 0xCA,
+    0x6E, 0x92, 0xEA, 0x5A, 0xE9, 0x2E, 0xA5, 0xF9, 0x1A, 0xEA, 0x49, 0xF2, 0xF9, 0x4F, 0x2A, 0xE9,
+    0x3A, 0xEA, 0x19, 0xF3, 0xAE, 0xA1, 0x9F, 0x3A, 0xE9, 0x19, 0xEA, 0x3A, 0xE9, 0x19, 0xEA, 0x49,
+    0xCA, 0x4D, 0x97, 0x75, 0x77, 0x77, 0x77, 0x29, 0xC9, 0x72, 0x9D, 0x97, 0x3E, 0x96, 0xAF, 0xCA,
+    0x72, 0xAE, 0x7A, 0xFC, 0x72, 0x9E, 0x73, 0xE7, 0x2E, 0x97, 0x29, 0xE7, 0x1A, 0xDA, 0x73, 0xAD,
+    0xA7, 0x09, 0xE7, 0x4A, 0xD9, 0x70, 0xE7, 0x5E, 0x70, 0xAD, 0x95, 0xDA, 0x4E, 0x79, 0xDA, 0x5E,
+    0xA3, 0x9D, 0xA7, 0xE5, 0xF9, 0x3A, 0xDA, 0x6E, 0x5F, 0xC9, 0x1A, 0xFD, 0x93, 0xAD, 0x94, 0xDA,
+    0xAD, 0x2F, 0xE3, 0x9D, 0xA4, 0xDA, 0x0E, 0x75, 0xE4, 0xE1, 0xDA, 0x74, 0xE9, 0x3E, 0x19, 0xD9,
+    0x73, 0xAD, 0xA3, 0xFF, 0xE7, 0x19, 0xE4, 0xFF, 0xE7, 0x1E, 0x69, 0x99, 0x99, 0xE9, 0x97, 0x0E,
+    0xA7, 0x3D, 0xA7, 0x1A, 0xE7, 0x39, 0xD9, 0x71, 0xAD, 0x77, 0x73, 0x99, 0x77, 0x30, 0x77, 0x77,
+    0x77, 0x1A, 0xC7, 0x49, 0xD9, 0x72, 0xE7, 0x0A, 0xFC, 0xA7, 0x1E, 0xA7, 0x0A, 0xFC, 0x71, 0xAE,
+    0x74, 0xE7, 0x09, 0xE7, 0x49, 0xE7, 0x0E, 0x97, 0x4A, 0xDA, 0x7A, 0xDA, 0x75, 0xAD, 0x96, 0x9E,
+    0x76, 0xE7, 0xE3, 0xAF, 0x95, 0xE6, 0xAD, 0x92, 0xFE, 0x93, 0x9D, 0xA5, 0x9D, 0xA2, 0xEA, 0x9A,
+    0xE3, 0xAD, 0xA5, 0xE3, 0xD9, 0x2E, 0x1A, 0xFD, 0x92, 0xE4, 0x99, 0x29, 0xDA, 0x1F, 0xE2, 0xAD,
+    0x97, 0x09, 0xE7, 0x39, 0xDA, 0x70, 0x9E, 0x97, 0x3E, 0x70, 0x9E, 0x74, 0xE9, 0x7A, 0xE7, 0x4A,
+    0xDA, 0x7E, 0x97, 0x49, 0xE6, 0x9E, 0xA9, 0x99, 0x99, 0x70, 0xE9, 0x6F, 0xFD, 0x7E, 0xA7, 0xAF,
+    0xFA, 0x7A, 0xD7, 0x77, 0x39, 0x77, 0x50, 0x77, 0x77, 0x77, 0x2A, 0xC7, 0x2A, 0xF7, 0x29, 0xE7,
+    0x0F, 0xE7, 0x1E, 0xA7, 0xE9, 0x0E, 0x97, 0xAE, 0x70, 0x9C, 0x2A, 0xD7, 0x9E, 0x76, 0xE7, 0xE9,
+    0x73, 0x9A, 0xE7, 0xAD, 0xA7, 0x3F, 0xCA, 0x69, 0xE7, 0x4C, 0xAA, 0xE9, 0x5E, 0x6D, 0xA6, 0x9D,
+    0xA4, 0xAD, 0x95, 0xEA, 0x6A, 0xD9, 0x39, 0xD9, 0x5F, 0x94, 0x9A, 0xE4, 0xDA, 0x5F, 0xC9, 0x0A,
+    0xFE, 0x4E, 0x5D, 0xAA, 0xD1, 0xAF, 0xCA, 0x4A, 0xD9, 0x4D, 0xA0, 0xE2, 0x99, 0x96, 0x9D, 0xA4,
+    0xE1, 0xDA, 0x74, 0xE4, 0xE1, 0x9D, 0x97, 0x3E, 0x93, 0xFF, 0xE7, 0x1A, 0xDA, 0x4F, 0xFE, 0x70,
+    0x9E, 0x69, 0x99, 0x99, 0xE9, 0x97, 0x9E, 0x74, 0xDA, 0x71, 0xEA, 0x73, 0x9D, 0x97, 0x1E, 0x77,
+    0x73, 0x97, 0x74, 0x69, 0x7E, 0x94, 0xF9, 0x4F, 0x59, 0xD9, 0x77, 0x09, 0x6F, 0xA3, 0xAF, 0xC3,
+    0x99, 0x9E, 0x59, 0xDA, 0x49, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x5E, 0x5A, 0xDA, 0x5A, 0xDA, 0x29,
+    0x90, 0xAE, 0xAA, 0xE1, 0xFF, 0x1A, 0xFD, 0xA2, 0x9F, 0x97, 0x30, 0x77, 0x77, 0x1C, 0xA7, 0x73,
+    0x9E, 0x77, 0x2A, 0xF9, 0x77, 0x1F, 0xC9, 0x77, 0x19, 0xAE, 0x77, 0x49, 0xA7, 0x77, 0x77, 0x29,
+    0xA9, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76,
+    0xE0, 0xF7, 0x5A, 0xDA, 0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E,
+    0xA7, 0x2E, 0x93, 0xF7, 0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69,
+    0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90,
+    0x9F, 0xE9, 0x3A, 0xFF, 0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x77, 0x77, 0x7A, 0xC7, 0x73, 0xE7, 0x71,
+    0xAF, 0x97, 0x7F, 0xCA, 0x77, 0xFA, 0x77, 0x1A, 0xA7, 0x77, 0x77, 0x59, 0xA9, 0x77, 0x2F, 0x77,
+    0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76, 0xE0, 0xF7, 0x5A, 0xDA,
+    0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E, 0xA7, 0x2E, 0x93, 0xF7,
+    0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69, 0xE9, 0x99, 0x99, 0x99,
+    0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90, 0x9F, 0xE9, 0x3A, 0xFF,
+    0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x77, 0x77, 0x4A, 0xD7, 0x72, 0xAF, 0x77, 0x0A, 0xFD, 0x76, 0xEA,
+    0x0E, 0x97, 0x4E, 0xA2, 0xE7, 0x4A, 0xA9, 0x4A, 0x77, 0x77, 0x70, 0x9A, 0x97, 0x72, 0xF7, 0x71,
+    0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0,
+    0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71,
+    0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A,
+    0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9,
+    0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x74, 0x97, 0x73, 0xAE, 0x90, 0x9C, 0xA7, 0x4A, 0xFC, 0xAD, 0xA7,
+    0x4E, 0x9F, 0xC9, 0x74, 0xAC, 0x19, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x9A, 0x97, 0x72, 0xF7, 0x71,
+    0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0,
+    0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71,
+    0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A,
+    0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9,
+    0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x72, 0x9A, 0x92, 0xAA, 0x97, 0x4A, 0xE1, 0xF7, 0x4F, 0x09, 0xF7,
+    0x4E, 0x91, 0xE7, 0x69, 0x49, 0x77, 0x77, 0x71, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09,
+    0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1,
+    0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99,
+    0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6,
+    0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F,
+    0xFC, 0x00, 0x75, 0x99, 0x97, 0x71, 0x9F, 0xC7, 0x79, 0xDA, 0xAD, 0x97, 0x6A, 0xC9, 0x1A, 0xCA,
+    0x76, 0xAC, 0x91, 0xAC, 0xA7, 0x6A, 0xDA, 0xAD, 0x77, 0x0F, 0xC9, 0x77, 0x19, 0x99, 0x77, 0x49,
+    0xA9, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76,
+    0xE0, 0xF7, 0x5A, 0xDA, 0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E,
+    0xA7, 0x2E, 0x93, 0xF7, 0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69,
+    0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90,
+    0x9F, 0xE9, 0x3A, 0xFF, 0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x77, 0x77, 0x73, 0xAF, 0xFF, 0xF7, 0x59,
+    0xFF, 0xFF, 0x77, 0x9F, 0xDA, 0xAA, 0xAF, 0x77, 0xFD, 0xA4, 0xDA, 0x76, 0xE9, 0xE9, 0x4D, 0x97,
+    0x5A, 0xD9, 0x9E, 0x5A, 0x97, 0x5A, 0xDA, 0x0A, 0xE7, 0x74, 0x9E, 0x1E, 0xA7, 0x74, 0xE2, 0xEA,
+    0x99, 0xAA, 0xA9, 0x75, 0xE9, 0x1A, 0xFF, 0xCA, 0x74, 0xEA, 0x2F, 0xFD, 0x74, 0xAE, 0x3F, 0x77,
+    0x19, 0xFF, 0xEA, 0x77, 0x09, 0xFF, 0xF9, 0x59, 0x71, 0xEA, 0x4F, 0x5A, 0xCA, 0x7F, 0x5F, 0x5D,
+    0xA6, 0xAE, 0x6F, 0x4A, 0xDA, 0x5A, 0xE9, 0x49, 0xAF, 0xAA, 0xAF, 0xC9, 0x39, 0xFD, 0xA2, 0xFF,
+    0xFE, 0x4F, 0xEA, 0x2F, 0xFF, 0xDA, 0x30, 0x71, 0x9A, 0xAA, 0xA9, 0x72, 0xAF, 0xFC, 0x95, 0xAF,
+    0xFE, 0xA4, 0xAF, 0xCA, 0xAA, 0xAE, 0xA3, 0xFC, 0xA4, 0xAD, 0x92, 0xAF, 0x6E, 0x3F, 0x96, 0xDA,
+    0x2A, 0xEA, 0x79, 0x93, 0xF9, 0x74, 0x9F, 0x75, 0xAF, 0x75, 0xFC, 0x75, 0xFA, 0x75, 0xFC, 0x75,
+    0xFC, 0x75, 0xFC, 0x97, 0x9A, 0x2A, 0xFC, 0x6A, 0xD3, 0xFD, 0xA9, 0x99, 0xAE, 0xA3, 0xAF, 0xFF,
+    0xC5, 0xAF, 0xFE, 0x79, 0xFF, 0x97, 0x49, 0x97, 0x79, 0xAA, 0x77, 0xF7, 0x69, 0xAD, 0x97, 0x6A,
+    0xD7, 0x6A, 0xD9, 0x74, 0x9E, 0x97, 0x6A, 0xA7, 0x20, 0x77, 0x76, 0xAC, 0x77, 0x2E, 0x97, 0x79,
+    0xF9, 0x77, 0xAF, 0xA7, 0x70, 0xAE, 0x97, 0x71, 0x9A, 0x77, 0x77, 0x77, 0x3F, 0xFF, 0xE5, 0xFF,
+    0xFE, 0x69, 0xFA, 0xAA, 0xAA, 0xEA, 0x7F, 0x49, 0xDA, 0x69, 0xF4, 0x9D, 0x96, 0x9F, 0x49, 0xCA,
+    0x7A, 0xEA, 0x77, 0xF9, 0x77, 0xFA, 0x99, 0xAA, 0xA9, 0x70, 0x9F, 0xFD, 0xA7, 0x0A, 0xFF, 0xD7,
+    0x1F, 0xA7, 0x7F, 0x97, 0x7F, 0x69, 0x79, 0xF5, 0xAC, 0xA6, 0xAE, 0xA5, 0xDA, 0x6F, 0x94, 0xE9,
+    0x59, 0xFC, 0xAA, 0xFD, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x30, 0x77, 0x77, 0x49, 0xC7, 0x71,
+    0xAD, 0x97, 0x69, 0xFA, 0x75, 0xFD, 0x75, 0xAE, 0xA9, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x75, 0xFF,
+    0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69,
+    0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70,
+    0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6,
+    0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x77, 0x77, 0x19,
+    0xD9, 0x77, 0x9F, 0x76, 0xAF, 0xD7, 0x4A, 0xE0, 0xAD, 0xA7, 0x2F, 0x2A, 0xD7, 0x2A, 0xC9, 0x4A,
+    0x97, 0x77, 0x77, 0x70, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D,
+    0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA,
+    0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A,
+    0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF,
+    0xFE, 0x93, 0x71, 0x9A, 0xA2, 0x9A, 0x97, 0x29, 0xE9, 0x0A, 0xE7, 0x2F, 0x90, 0xF7, 0x2A, 0xDA,
+    0x1E, 0x97, 0x39, 0x49, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xE5, 0xFF, 0xFE, 0x69, 0xFA, 0xAA, 0xAA,
+    0xEA, 0x7F, 0x49, 0xDA, 0x69, 0xF4, 0x9D, 0x96, 0x9F, 0x49, 0xCA, 0x7A, 0xEA, 0x77, 0xF9, 0x77,
+    0xFA, 0x99, 0xAA, 0xA9, 0x70, 0x9F, 0xFD, 0xA7, 0x0A, 0xFF, 0xD7, 0x1F, 0xA7, 0x7F, 0x97, 0x7F,
+    0x69, 0x79, 0xF5, 0xAC, 0xA6, 0xAE, 0xA5, 0xDA, 0x6F, 0x94, 0xE9, 0x59, 0xFC, 0xAA, 0xFD, 0x49,
+    0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x30, 0x77, 0x49, 0xC7, 0x4E, 0x97, 0x2F, 0xA7, 0x19, 0xFC, 0x72,
+    0xAE, 0xA7, 0x39, 0xA7, 0x77, 0x75, 0xFF, 0xC9, 0x4F, 0xFC, 0x69, 0xFC, 0x71, 0xF9, 0x71, 0xF7,
+    0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97,
+    0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x70, 0x9F, 0xC9, 0x59, 0xFF, 0xA4, 0xFF, 0xC9,
+    0x30, 0x77, 0x73, 0xC9, 0x72, 0xAD, 0xA7, 0x09, 0xFC, 0x7A, 0xFC, 0x79, 0xF9, 0x70, 0x9A, 0x97,
+    0x77, 0x77, 0xFF, 0xC9, 0x4F, 0xFC, 0x69, 0xFC, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7,
+    0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7,
+    0x1A, 0xF7, 0x1A, 0xEA, 0x70, 0x9F, 0xC9, 0x59, 0xFF, 0xA4, 0xFF, 0xC9, 0x30, 0x77, 0x70, 0x9D,
+    0x97, 0x29, 0xF9, 0x70, 0x9F, 0xD9, 0x69, 0xE0, 0x9E, 0x5A, 0xE2, 0x9D, 0x94, 0x9C, 0xA4, 0xAA,
+    0x77, 0x77, 0x5F, 0xFC, 0x95, 0xFF, 0xC7, 0x9F, 0xC7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF,
+    0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F,
+    0x72, 0xAF, 0x72, 0xAE, 0xA7, 0x19, 0xFC, 0x96, 0x9F, 0xFA, 0x5F, 0xFC, 0x94, 0x6A, 0xA2, 0x9A,
+    0xA6, 0xEA, 0x09, 0xE9, 0x4A, 0xEA, 0x0F, 0x94, 0x9E, 0x1A, 0xDA, 0x79, 0x39, 0x77, 0x77, 0x7F,
+    0xFC, 0x95, 0xFF, 0xC7, 0x9F, 0xC7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72,
+    0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72,
+    0xAE, 0xA7, 0x19, 0xFC, 0x96, 0x9F, 0xFA, 0x5F, 0xFC, 0x94, 0x69, 0x9A, 0xAA, 0xA9, 0x97, 0x2A,
+    0xFF, 0xEA, 0x7F, 0xFF, 0xEA, 0x5D, 0xAF, 0xA9, 0xAF, 0xDA, 0x7F, 0x39, 0xFC, 0x69, 0xF4, 0x9F,
+    0xA5, 0x9F, 0x5F, 0xC5, 0xAE, 0xA5, 0x9F, 0x5F, 0x95, 0x9F, 0x94, 0xF9, 0x6F, 0x90, 0xAF, 0xFE,
+    0x29, 0xF1, 0xAF, 0xFD, 0xA2, 0x9F, 0x4F, 0xA6, 0xAF, 0x4F, 0x96, 0xFA, 0x4F, 0x69, 0xF4, 0x9F,
+    0x6F, 0xA4, 0xAE, 0xA5, 0xFC, 0x5F, 0xA3, 0xAF, 0xC5, 0x9F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD9, 0x5F,
+    0xFF, 0xA9, 0x77, 0x75, 0x73, 0x99, 0x77, 0x5F, 0x19, 0xC9, 0x76, 0xAF, 0xCA, 0xDA, 0x76, 0xDA,
+    0xAF, 0xC7, 0x7A, 0xC1, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0xFD, 0xA4, 0x9F, 0xEA, 0x3F,
+    0xE4, 0x9F, 0xE9, 0x49, 0xFC, 0xA5, 0xAE, 0x97, 0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA, 0x79,
+    0xFE, 0x4E, 0x97, 0xAF, 0xE9, 0x3E, 0x70, 0xEA, 0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A, 0xE7,
+    0x9E, 0x1F, 0xA1, 0xAD, 0xA7, 0xAE, 0x19, 0xF1, 0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E, 0x92,
+    0xAF, 0x9E, 0x70, 0xE4, 0xFF, 0x79, 0xE4, 0xAF, 0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A, 0xFC,
+    0x79, 0xEA, 0x94, 0x9F, 0xC5, 0x9F, 0xEA, 0x4F, 0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x49, 0x70,
+    0x77, 0x75, 0xAA, 0x77, 0x19, 0xE7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0x0A, 0xE9, 0x77, 0x19,
+    0xA7, 0x77, 0x74, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xFF, 0xF9, 0x59, 0xFD, 0xAA, 0xFD,
+    0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A, 0xF9, 0x1F, 0xC7, 0x9F, 0x90, 0x9F,
+    0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC,
+    0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xFA, 0x5F, 0xC4,
+    0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97,
+    0x30, 0x77, 0x77, 0x39, 0xC7, 0x71, 0xE9, 0x76, 0x9F, 0x97, 0x5F, 0xCA, 0x75, 0xFA, 0x97, 0x6A,
+    0xA9, 0x77, 0x77, 0x69, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF, 0x95, 0x9F, 0xDA, 0xAF,
+    0xD5, 0xFC, 0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91, 0xFC, 0x79, 0xF9, 0x09,
+    0xF9, 0x79, 0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0F, 0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F, 0xC2, 0xAF, 0xA5, 0xFC,
+    0x4F, 0xCA, 0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19, 0xAF, 0xDA, 0x97, 0x69,
+    0x73, 0x77, 0x77, 0x0A, 0xD7, 0x70, 0xAF, 0x76, 0xAF, 0xD7, 0x4A, 0xE0, 0xEA, 0x72, 0xEA, 0x2E,
+    0x72, 0xAC, 0x94, 0xA9, 0x77, 0x77, 0x19, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF, 0x95,
+    0x9F, 0xDA, 0xAF, 0xD5, 0xFC, 0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91, 0xFC,
+    0x79, 0xF9, 0x09, 0xF9, 0x79, 0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F, 0xC2,
+    0xAF, 0xA5, 0xFC, 0x4F, 0xCA, 0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19, 0xAF,
+    0xDA, 0x97, 0x69, 0x73, 0x72, 0x97, 0x71, 0xAE, 0x91, 0xD7, 0x29, 0xFC, 0xAE, 0x72, 0xE9, 0xFC,
+    0x97, 0x29, 0xC2, 0xE9, 0x77, 0x77, 0x77, 0x79, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF,
+    0x95, 0x9F, 0xDA, 0xAF, 0xD5, 0xFC, 0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91,
+    0xFC, 0x79, 0xF9, 0x09, 0xF9, 0x79, 0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F,
+    0xC2, 0xAF, 0xA5, 0xFC, 0x4F, 0xCA, 0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19,
+    0xAF, 0xDA, 0x97, 0x69, 0x73, 0x70, 0x9A, 0xA2, 0xAA, 0x97, 0x29, 0xE9, 0x0F, 0x72, 0xF1, 0xF7,
+    0x2E, 0xA1, 0xE9, 0x73, 0x94, 0x97, 0x77, 0x73, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xFF,
+    0xF9, 0x59, 0xFD, 0xAA, 0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A, 0xF9,
+    0x1F, 0xC7, 0x9F, 0x90, 0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F, 0xC7,
+    0xFC, 0x2A, 0xFA, 0x5F, 0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71,
+    0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x1A, 0x5A, 0x91, 0x9D, 0xA3, 0xAD, 0x90, 0xAE, 0xA1, 0xAE,
+    0xA1, 0xAE, 0xAA, 0xEA, 0x3A, 0xFE, 0x5A, 0xFC, 0x69, 0xFA, 0x59, 0xFD, 0x93, 0x9F, 0xF9, 0x19,
+    0xF1, 0xF9, 0x0A, 0xE3, 0xEA, 0x1A, 0xC5, 0xCA, 0x76, 0x77, 0x77, 0x29, 0xAA, 0xA9, 0x4C, 0x97,
+    0x09, 0xFF, 0xC1, 0xE7, 0xFF, 0xFE, 0x69, 0xFD, 0xAA, 0xFE, 0x7F, 0xC9, 0x3A, 0xFA, 0x6F, 0xC6,
+    0xFC, 0x5A, 0xF6, 0xFD, 0x94, 0xFA, 0x49, 0xFE, 0x93, 0x9F, 0x49, 0xDA, 0x0F, 0xA3, 0xAF, 0x39,
+    0xDA, 0x1F, 0x93, 0xFA, 0x29, 0xDA, 0x2F, 0x93, 0xFA, 0x19, 0xDA, 0x29, 0xF9, 0x3F, 0xA0, 0x9D,
+    0x93, 0xAF, 0x4F, 0xAA, 0xD9, 0x4F, 0xA4, 0xFE, 0x94, 0x9F, 0x94, 0xFD, 0x95, 0xFC, 0x5A, 0xFA,
+    0x5F, 0xC7, 0xFC, 0x92, 0x9F, 0xC9, 0x6A, 0xFF, 0xFD, 0x96, 0xEA, 0xFF, 0xE7, 0xAD, 0x19, 0xAF,
+    0xDA, 0x97, 0x1A, 0x69, 0x75, 0x77, 0x75, 0x9C, 0x77, 0x3E, 0x97, 0x71, 0xFA, 0x77, 0x0A, 0xFA,
+    0x77, 0x1A, 0xE9, 0x77, 0x29, 0xA7, 0x77, 0x77, 0x74, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xA2, 0xFF,
+    0x91, 0x9F, 0xA5, 0x9F, 0x93, 0x9F, 0x7F, 0x4A, 0xF6, 0x9E, 0xA4, 0xAE, 0xA6, 0xAE, 0x94, 0xF9,
+    0x6A, 0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0xAF, 0x69, 0xE9, 0x4F, 0xA6, 0xAE, 0x94, 0xF9, 0x6A,
+    0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0x9F, 0x6A, 0xE5, 0x9F, 0x94, 0x9F, 0x59, 0xFC, 0x91, 0x9A,
+    0xF9, 0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72, 0xAF, 0xEA, 0x77, 0x99, 0x75, 0x77, 0x77, 0x39,
+    0xC7, 0x72, 0xAD, 0xA7, 0x79, 0xFA, 0x76, 0xAF, 0xC7, 0x6A, 0xF9, 0x77, 0x9A, 0x97, 0x77, 0x77,
+    0x76, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xA2, 0xFF, 0x91, 0x9F, 0xA5, 0x9F, 0x93, 0x9F, 0x7F, 0x4A,
+    0xF6, 0x9E, 0xA4, 0xAE, 0xA6, 0xAE, 0x94, 0xF9, 0x6A, 0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0xAF,
+    0x69, 0xE9, 0x4F, 0xA6, 0xAE, 0x94, 0xF9, 0x6A, 0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0x9F, 0x6A,
+    0xE5, 0x9F, 0x94, 0x9F, 0x59, 0xFC, 0x91, 0x9A, 0xF9, 0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72,
+    0xAF, 0xEA, 0x77, 0x99, 0x75, 0x77, 0x77, 0x09, 0xD9, 0x77, 0x09, 0xF9, 0x76, 0x9F, 0xD7, 0x5A,
+    0xE0, 0xAE, 0x73, 0xAE, 0x2A, 0xD7, 0x3A, 0xCA, 0x4A, 0x97, 0x77, 0x77, 0x71, 0xFF, 0xC2, 0xFF,
+    0xC0, 0xFF, 0xA2, 0xFF, 0x91, 0x9F, 0xA5, 0x9F, 0x93, 0x9F, 0x7F, 0x4A, 0xF6, 0x9E, 0xA4, 0xAE,
+    0xA6, 0xAE, 0x94, 0xF9, 0x6A, 0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0xAF, 0x69, 0xE9, 0x4F, 0xA6,
+    0xAE, 0x94, 0xF9, 0x6A, 0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0x9F, 0x6A, 0xE5, 0x9F, 0x94, 0x9F,
+    0x59, 0xFC, 0x91, 0x9A, 0xF9, 0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72, 0xAF, 0xEA, 0x77, 0x99,
+    0x75, 0x79, 0xAA, 0x29, 0xAA, 0x73, 0x9E, 0xA0, 0xAE, 0x97, 0x2A, 0xE9, 0x0F, 0x73, 0xAE, 0x1E,
+    0xA7, 0x49, 0x49, 0x77, 0x77, 0x77, 0x3F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA,
+    0x59, 0xF9, 0x39, 0xF7, 0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F,
+    0x7F, 0x49, 0xF7, 0xEA, 0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F,
+    0x49, 0xF7, 0xEA, 0x49, 0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF,
+    0xFC, 0xA7, 0x0F, 0xFE, 0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x77, 0x77, 0x2C, 0x97, 0x70,
+    0xAE, 0x77, 0xFC, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0x97, 0x7A, 0x97, 0x77, 0x77, 0x74, 0xFF, 0x91,
+    0xFF, 0x1F, 0xF2, 0xFE, 0x92, 0xFC, 0x5A, 0xEA, 0x49, 0xF5, 0xEA, 0x6F, 0x93, 0xF7, 0xAE, 0xA2,
+    0x9E, 0x71, 0xF2, 0xE9, 0x71, 0xF9, 0x0E, 0xA7, 0x2A, 0xEA, 0xAE, 0x74, 0xFE, 0x75, 0xFD, 0x97,
+    0x59, 0xFA, 0x77, 0xF7, 0x79, 0xF7, 0x7A, 0xEA, 0x77, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0xA9, 0x73,
+    0xFF, 0xC9, 0x72, 0xFF, 0xC7, 0x10, 0x77, 0x7F, 0xFC, 0x97, 0x0F, 0xFA, 0x72, 0x9F, 0xA7, 0x5F,
+    0xA9, 0x73, 0x9F, 0xFC, 0x97, 0x9F, 0xFD, 0xA6, 0xAE, 0xA0, 0x9A, 0xF9, 0x5F, 0x92, 0xFC, 0x5F,
+    0x39, 0xF4, 0x9F, 0x39, 0xF4, 0xAF, 0x3A, 0xEA, 0x4F, 0xA3, 0xF9, 0x4F, 0x92, 0xFA, 0x5F, 0x99,
+    0xAF, 0xA5, 0x9F, 0xFD, 0x96, 0xAF, 0xEA, 0x97, 0x0F, 0xA7, 0x49, 0xFA, 0x72, 0x9F, 0xFA, 0x70,
+    0xFF, 0xC9, 0x70, 0x77, 0x9A, 0xAA, 0x97, 0x70, 0x9F, 0xEA, 0x75, 0xAF, 0xFC, 0x97, 0x3A, 0xEA,
+    0x19, 0xEA, 0x73, 0xEA, 0x3E, 0xA7, 0x2A, 0xE4, 0xE9, 0x72, 0xEA, 0x39, 0xE7, 0x29, 0xE9, 0x3E,
+    0x97, 0x2A, 0xE3, 0xAD, 0xA7, 0x3F, 0x29, 0xDA, 0x74, 0xF2, 0xE7, 0x5E, 0xA1, 0xEA, 0x74, 0x9E,
+    0x91, 0xF7, 0x4A, 0xE2, 0xAF, 0x73, 0xF3, 0xFC, 0x72, 0xEA, 0x4F, 0xA7, 0x09, 0xE9, 0x49, 0xF9,
+    0x7A, 0xE9, 0x5A, 0xEA, 0x7A, 0xE1, 0x93, 0x9E, 0xA7, 0xF0, 0x9D, 0x29, 0xE7, 0x0E, 0xA0, 0xFC,
+    0xAE, 0xA7, 0x9E, 0x90, 0xFF, 0xA7, 0x0A, 0xE2, 0xFD, 0x97, 0x1F, 0x49, 0x75, 0xEA, 0x76, 0x92,
+    0x9E, 0x97, 0x5A, 0xCA, 0x1F, 0x76, 0xFF, 0x77, 0xFE, 0x97, 0x70, 0xAD, 0xA9, 0x77, 0x00, 0x77,
+    0x79, 0xC7, 0x6E, 0x74, 0x9E, 0xA7, 0x4F, 0x97, 0x4A, 0xE7, 0x59, 0xD7, 0x7A, 0x77, 0x74, 0x99,
+    0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9,
+    0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9,
+    0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2,
+    0xFA, 0x29, 0xE9, 0x59, 0x73, 0x74, 0xA7, 0x6A, 0xD7, 0x5E, 0x97, 0x3F, 0x73, 0x9E, 0x74, 0xE7,
+    0x5D, 0x77, 0x77, 0x75, 0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9,
+    0xFC, 0x4F, 0x3F, 0x3A, 0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3,
+    0xF3, 0xFA, 0x3F, 0x29, 0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD,
+    0xA0, 0xAF, 0xD1, 0xFC, 0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x73, 0x71, 0xAA, 0xA7, 0x4F, 0x97, 0x2A,
+    0xFC, 0x71, 0x9D, 0xAA, 0xD9, 0x79, 0xDA, 0x1D, 0xA6, 0x9E, 0x29, 0xD7, 0xAA, 0x4A, 0x77, 0x72,
+    0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A,
+    0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29,
+    0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC,
+    0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x73, 0x7A, 0xA9, 0x2A, 0x79, 0xF9, 0x0A, 0xCA, 0x6F, 0xFC, 0x96,
+    0xD1, 0xFC, 0x79, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x39, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49,
+    0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA,
+    0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA,
+    0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x77,
+    0x7D, 0xA1, 0xAD, 0x96, 0xF0, 0x9E, 0xA6, 0xEA, 0x0A, 0xE7, 0x9C, 0xA2, 0xAA, 0x97, 0x77, 0x77,
+    0x29, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3,
+    0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2,
+    0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F,
+    0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x77, 0x70, 0x9F, 0x97, 0x2F, 0xD7, 0x1A, 0xC9, 0x1D,
+    0x97, 0x0D, 0x2A, 0xC9, 0x70, 0xD9, 0x1D, 0x71, 0xAF, 0xCA, 0x72, 0xAE, 0x97, 0x77, 0x39, 0x99,
+    0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE, 0x93,
+    0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x93,
+    0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F, 0xCA, 0x2F,
+    0xA2, 0x9E, 0x95, 0x97, 0x30, 0x79, 0x99, 0x59, 0x99, 0x70, 0xFD, 0xA1, 0xAF, 0xC9, 0x49, 0xFF,
+    0xFF, 0xC3, 0x9F, 0xA9, 0xAF, 0xC9, 0x0F, 0x3F, 0x39, 0xE2, 0xAE, 0x2A, 0xE9, 0x3E, 0x92, 0xEA,
+    0x2F, 0x39, 0xE2, 0xAE, 0x29, 0xEA, 0x3F, 0x1A, 0xE3, 0xAE, 0x39, 0xFA, 0xEA, 0x4F, 0x3F, 0xF9,
+    0x5F, 0x29, 0xFC, 0xA9, 0x7F, 0x2F, 0xCA, 0x4A, 0xC2, 0xF1, 0xDA, 0xF2, 0x9E, 0x2F, 0xF0, 0xAF,
+    0xFC, 0xA2, 0xAF, 0xD2, 0xFF, 0x94, 0xFA, 0x39, 0xFC, 0xA7, 0x09, 0x70, 0x97, 0x79, 0x99, 0x7A,
+    0xFC, 0x93, 0x9F, 0xF2, 0x9F, 0xFA, 0x2F, 0x29, 0xC2, 0xAE, 0x70, 0xEA, 0x7A, 0xE9, 0x7F, 0x70,
+    0xF7, 0x0F, 0x70, 0xF4, 0xAA, 0x1F, 0xC1, 0x9E, 0x1F, 0xFD, 0x91, 0x9F, 0xF9, 0x39, 0xFC, 0xA7,
+    0x09, 0x72, 0x9A, 0x97, 0x0A, 0xEA, 0x70, 0x9E, 0x71, 0xDA, 0x70, 0xE7, 0xAE, 0x70, 0x9A, 0x97,
+    0x77, 0x3A, 0xC7, 0x29, 0xDA, 0x71, 0x9E, 0x97, 0x1F, 0x72, 0xF7, 0x2A, 0xD7, 0x39, 0x97, 0x77,
+    0x09, 0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA,
+    0x2E, 0x2A, 0xE2, 0xAE, 0x1A, 0xE3, 0xFA, 0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2,
+    0x9E, 0x2A, 0xFF, 0xCA, 0x3F, 0xF9, 0x49, 0xFC, 0xA7, 0x19, 0x70, 0x73, 0x97, 0x4A, 0xD7, 0x29,
+    0xE7, 0x2F, 0x71, 0xAE, 0x72, 0xE7, 0x3D, 0x74, 0x97, 0x77, 0x39, 0x99, 0x71, 0xAF, 0xC9, 0x59,
+    0xFF, 0x49, 0xE9, 0x0A, 0xE4, 0xE2, 0x9E, 0x3E, 0xA2, 0xEA, 0x3E, 0x2A, 0xE3, 0xAE, 0x1A, 0xE4,
+    0xFA, 0xF5, 0xFE, 0x96, 0xFA, 0x97, 0x0E, 0xA4, 0xAC, 0x3F, 0x29, 0xE3, 0xAF, 0xFC, 0xA4, 0xFF,
+    0x95, 0x9F, 0xCA, 0x72, 0x97, 0x00, 0x70, 0xAA, 0x97, 0x1F, 0x70, 0xFC, 0xA6, 0xAD, 0x9E, 0x59,
+    0xDA, 0x1D, 0xA3, 0x9D, 0xA2, 0xAC, 0xA4, 0xA9, 0x49, 0x77, 0x69, 0x99, 0x70, 0xAF, 0xC9, 0x49,
+    0xFF, 0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2E, 0x2A, 0xE2, 0xAE, 0x1A, 0xE3,
+    0xFA, 0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2, 0x9E, 0x2A, 0xFF, 0xCA, 0x3F, 0xF9,
+    0x49, 0xFC, 0xA7, 0x19, 0x70, 0x77, 0x39, 0xDA, 0x1A, 0xD5, 0xF0, 0xAE, 0x94, 0xEA, 0x0A, 0xE5,
+    0xAC, 0x92, 0xCA, 0x77, 0x77, 0x79, 0x99, 0x71, 0xAF, 0xC9, 0x59, 0xFF, 0x49, 0xE9, 0x0A, 0xE4,
+    0xE2, 0x9E, 0x3E, 0xA2, 0xEA, 0x3E, 0x2A, 0xE3, 0xAE, 0x1A, 0xE4, 0xFA, 0xF5, 0xFE, 0x96, 0xFA,
+    0x97, 0x0E, 0xA4, 0xAC, 0x3F, 0x29, 0xE3, 0xAF, 0xFC, 0xA4, 0xFF, 0x95, 0x9F, 0xCA, 0x72, 0x97,
+    0x00, 0x72, 0xCA, 0x4E, 0x93, 0xF3, 0x9E, 0xA3, 0x9E, 0x94, 0xDA, 0x5A, 0x74, 0x99, 0x2A, 0xFA,
+    0x0F, 0xE0, 0x99, 0xAE, 0xA2, 0x9E, 0x92, 0xAE, 0x3F, 0x3E, 0xA2, 0xAE, 0x92, 0xF3, 0xEA, 0x29,
+    0xE9, 0x2A, 0xE9, 0x9C, 0x9A, 0xFD, 0x9A, 0xFC, 0xA0, 0x9F, 0x93, 0x94, 0x79, 0x71, 0xD9, 0x6A,
+    0xDA, 0x59, 0xE9, 0x5E, 0xA5, 0xAD, 0xA6, 0xAC, 0x97, 0x77, 0x49, 0x95, 0xAF, 0xA3, 0xFE, 0x39,
+    0x9A, 0xEA, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x5A, 0xE9, 0x5F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE,
+    0x99, 0xC9, 0x2A, 0xFD, 0x92, 0xAF, 0xCA, 0x39, 0xF9, 0x69, 0x70, 0x49, 0xAA, 0x69, 0xEA, 0x49,
+    0xFC, 0x4E, 0x9D, 0xA2, 0xE1, 0xAD, 0x1E, 0x92, 0xD9, 0x09, 0xA4, 0x99, 0x77, 0x99, 0x5A, 0xFA,
+    0x3F, 0xE3, 0x99, 0xAE, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA5, 0xAE, 0x95, 0xF6, 0xEA, 0x59,
+    0xE9, 0x5A, 0xE9, 0x9C, 0x92, 0xAF, 0xD9, 0x2A, 0xFC, 0xA3, 0x9F, 0x96, 0x97, 0x74, 0xAD, 0x2D,
+    0xA0, 0x9E, 0x90, 0xF0, 0xAE, 0x1E, 0xA1, 0xAA, 0x2A, 0xCA, 0x77, 0x72, 0x99, 0x5A, 0xFA, 0x3F,
+    0xE3, 0x99, 0xAE, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA5, 0xAE, 0x95, 0xF6, 0xEA, 0x59, 0xE9,
+    0x5A, 0xE9, 0x9C, 0x92, 0xAF, 0xD9, 0x2A, 0xFC, 0xA3, 0x9F, 0x96, 0x97, 0x77, 0x69, 0xD1, 0x9C,
+    0x79, 0xFE, 0x97, 0xAF, 0xC9, 0x71, 0xFA, 0x70, 0x9F, 0xD7, 0x0A, 0xCA, 0x0E, 0xA7, 0x09, 0x19,
+    0xE7, 0x4E, 0x96, 0xAF, 0xEA, 0x49, 0xFF, 0xD3, 0x9F, 0xFE, 0x3F, 0x91, 0x9F, 0x2F, 0x93, 0xF1,
+    0x9E, 0xA4, 0xF1, 0xAE, 0x94, 0xF1, 0xF5, 0xEA, 0x1F, 0x49, 0xE9, 0x1F, 0x4F, 0x2F, 0x39, 0xE9,
+    0x2F, 0xA1, 0x9F, 0x3A, 0xFF, 0xD9, 0x4F, 0xFC, 0x96, 0xAF, 0xCA, 0x73, 0x97, 0x00, 0x7A, 0xA9,
+    0x2A, 0x70, 0x9F, 0x90, 0xAC, 0xA7, 0xFF, 0xC9, 0x7D, 0x1F, 0xC7, 0x09, 0x92, 0xAC, 0xA7, 0x77,
+    0x77, 0x39, 0x99, 0x49, 0x94, 0x9F, 0xCA, 0x1A, 0xF9, 0x2F, 0xDA, 0x0F, 0xE2, 0x99, 0xAE, 0xAF,
+    0xF4, 0x9F, 0xD1, 0xF4, 0x9F, 0xC2, 0xEA, 0x4A, 0xF2, 0x9E, 0x94, 0xFA, 0x2A, 0xE5, 0xF3, 0xF4,
+    0x9E, 0xA2, 0x9E, 0xA4, 0xAE, 0x92, 0xAE, 0x94, 0xF3, 0xF5, 0xF3, 0xF0, 0xAC, 0x19, 0xEA, 0x3F,
+    0xE1, 0xAE, 0x93, 0xFD, 0x91, 0xF4, 0xAE, 0xA7, 0x69, 0x40, 0x77, 0x59, 0xC7, 0x4E, 0x73, 0xEA,
+    0x72, 0xAE, 0x97, 0x2A, 0xE7, 0x39, 0xD9, 0x74, 0xA7, 0x77, 0x19, 0x99, 0x70, 0x9F, 0xE5, 0xAF,
+    0xFC, 0x3A, 0xF9, 0xAF, 0x91, 0x9E, 0xA2, 0xAF, 0x1F, 0x39, 0xF0, 0x9E, 0xA4, 0xF0, 0xAE, 0x94,
+    0xF0, 0xF4, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0xF4, 0xF1, 0xF3, 0x9E, 0xA1, 0xF9, 0x19, 0xF2, 0xAF,
+    0xAA, 0xF4, 0xFF, 0xC6, 0xAF, 0xCA, 0x71, 0x99, 0x70, 0x74, 0xA7, 0x59, 0xD7, 0x4E, 0x97, 0x2A,
+    0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x73, 0xD7, 0x77, 0x77, 0x39, 0x99, 0x71, 0x9F, 0xE6, 0xAF, 0xFC,
+    0x4A, 0xF9, 0xAF, 0x92, 0x9E, 0xA2, 0xAF, 0x2F, 0x39, 0xF1, 0x9E, 0xA4, 0xF1, 0xAE, 0x94, 0xF1,
+    0xF4, 0x9E, 0xA1, 0xF4, 0xAE, 0x91, 0xF4, 0xF2, 0xF3, 0x9E, 0xA2, 0xF9, 0x19, 0xF3, 0xAF, 0xAA,
+    0xF5, 0xFF, 0xC7, 0xAF, 0xCA, 0x72, 0x99, 0x70, 0x71, 0xAA, 0xA7, 0x2F, 0x97, 0x0A, 0xFC, 0x79,
+    0xDA, 0xAD, 0x95, 0x9E, 0x1E, 0x5E, 0x29, 0xD5, 0x9A, 0x4A, 0x77, 0x79, 0x99, 0x70, 0x9F, 0xE5,
+    0xAF, 0xFC, 0x3A, 0xF9, 0xAF, 0x91, 0x9E, 0xA2, 0xAF, 0x1F, 0x39, 0xF0, 0x9E, 0xA4, 0xF0, 0xAE,
+    0x94, 0xF0, 0xF4, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0xF4, 0xF1, 0xF3, 0x9E, 0xA1, 0xF9, 0x19, 0xF2,
+    0xAF, 0xAA, 0xF4, 0xFF, 0xC6, 0xAF, 0xCA, 0x71, 0x99, 0x70, 0x7A, 0xA9, 0x2A, 0x7F, 0x90, 0xAC,
+    0xA5, 0xFF, 0xCA, 0x5D, 0x90, 0xFC, 0x69, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x19, 0x99, 0x71, 0x9F,
+    0xE6, 0xAF, 0xFC, 0x4A, 0xF9, 0xAF, 0x92, 0x9E, 0xA2, 0xAF, 0x2F, 0x39, 0xF1, 0x9E, 0xA4, 0xF1,
+    0xAE, 0x94, 0xF1, 0xF4, 0x9E, 0xA1, 0xF4, 0xAE, 0x91, 0xF4, 0xF2, 0xF3, 0x9E, 0xA2, 0xF9, 0x19,
+    0xF3, 0xAF, 0xAA, 0xF5, 0xFF, 0xC7, 0xAF, 0xCA, 0x72, 0x99, 0x70, 0x77, 0x6E, 0x19, 0xD9, 0x5F,
+    0x09, 0xEA, 0x5F, 0x09, 0xE9, 0x59, 0xCA, 0x2A, 0xA9, 0x77, 0x77, 0x70, 0x99, 0x97, 0x19, 0xFE,
+    0x6A, 0xFF, 0xC4, 0xAF, 0x9A, 0xF9, 0x29, 0xEA, 0x2A, 0xF2, 0xF3, 0x9F, 0x19, 0xEA, 0x4F, 0x1A,
+    0xE9, 0x4F, 0x1F, 0x49, 0xEA, 0x1F, 0x4A, 0xE9, 0x1F, 0x4F, 0x2F, 0x39, 0xEA, 0x2F, 0x91, 0x9F,
+    0x3A, 0xFA, 0xAF, 0x5F, 0xFC, 0x7A, 0xFC, 0xA7, 0x29, 0x97, 0x00, 0x69, 0x72, 0xAE, 0x71, 0xF7,
+    0x1F, 0x72, 0xAA, 0x77, 0x39, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x39, 0xDA, 0x71, 0xF7, 0x1F, 0x71, 0x9D, 0x94, 0x71, 0x99, 0x93, 0x97, 0x9F, 0xE0, 0xAD,
+    0x5A, 0xFF, 0xE5, 0xAF, 0x99, 0xFC, 0x59, 0xEA, 0x29, 0xF5, 0xF3, 0xFC, 0x49, 0xE9, 0x2F, 0xD4,
+    0xAE, 0x19, 0xD9, 0xF4, 0xF0, 0x9D, 0x1E, 0xA4, 0xFA, 0xD1, 0x9E, 0x94, 0xFD, 0x2F, 0x5F, 0xA2,
+    0x9E, 0xA5, 0xF2, 0x9F, 0x6F, 0xCA, 0xAF, 0x6F, 0xFE, 0x6D, 0x90, 0xAF, 0xCA, 0x7A, 0x59, 0x71,
+    0x77, 0x70, 0xAC, 0x76, 0x9D, 0xA7, 0x5A, 0xE9, 0x75, 0xF7, 0x6E, 0xA7, 0x6A, 0xD7, 0x79, 0x97,
+    0x77, 0x39, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99, 0xAE, 0x92, 0x9E, 0xA4,
+    0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4, 0xAE, 0x3F, 0x94, 0xF2,
+    0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD, 0x9E, 0x9D, 0x1A, 0xFE,
+    0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x74, 0x97, 0x7A, 0xCA, 0x75,
+    0x9E, 0x75, 0xF7, 0x4A, 0xE7, 0x5E, 0x76, 0xD7, 0x79, 0x77, 0x74, 0x99, 0x79, 0x92, 0x9F, 0xC9,
+    0x3F, 0x2F, 0xDA, 0x3F, 0x29, 0x9A, 0xE9, 0x29, 0xEA, 0x49, 0xE3, 0xAE, 0x94, 0xAE, 0x3F, 0x5F,
+    0x3F, 0x49, 0xE9, 0x29, 0xEA, 0x4A, 0xE3, 0xF9, 0x4F, 0x29, 0xF5, 0xEA, 0x2F, 0xC4, 0x9E, 0x91,
+    0xAF, 0xC1, 0x91, 0xAE, 0x1A, 0xD9, 0xE9, 0xD1, 0xAF, 0xE0, 0xAF, 0xD1, 0xAF, 0xD1, 0x9F, 0xC3,
+    0xFA, 0x3E, 0xA6, 0x97, 0x40, 0x71, 0xAA, 0x97, 0x5F, 0x74, 0xFC, 0xA7, 0x2A, 0xD9, 0xE7, 0x1A,
+    0xDA, 0x09, 0xDA, 0x79, 0xDA, 0x2A, 0xCA, 0x70, 0xA9, 0x49, 0x77, 0x71, 0x99, 0x79, 0x92, 0x9F,
+    0xC9, 0x3F, 0x2F, 0xDA, 0x3F, 0x29, 0x9A, 0xE9, 0x29, 0xEA, 0x49, 0xE3, 0xAE, 0x94, 0xAE, 0x3F,
+    0x5F, 0x3F, 0x49, 0xE9, 0x29, 0xEA, 0x4A, 0xE3, 0xF9, 0x4F, 0x29, 0xF5, 0xEA, 0x2F, 0xC4, 0x9E,
+    0x91, 0xAF, 0xC1, 0x91, 0xAE, 0x1A, 0xD9, 0xE9, 0xD1, 0xAF, 0xE0, 0xAF, 0xD1, 0xAF, 0xD1, 0x9F,
+    0xC3, 0xFA, 0x3E, 0xA6, 0x97, 0x40, 0x77, 0x79, 0xD9, 0x1A, 0xD7, 0x0F, 0x0A, 0xE9, 0x69, 0xE9,
+    0x0A, 0xE7, 0x0A, 0xC9, 0x19, 0xCA, 0x77, 0x77, 0x73, 0x99, 0x79, 0x92, 0x9F, 0xC9, 0x3F, 0x2F,
+    0xDA, 0x3F, 0x29, 0x9A, 0xE9, 0x29, 0xEA, 0x49, 0xE3, 0xAE, 0x94, 0xAE, 0x3F, 0x5F, 0x3F, 0x49,
+    0xE9, 0x29, 0xEA, 0x4A, 0xE3, 0xF9, 0x4F, 0x29, 0xF5, 0xEA, 0x2F, 0xC4, 0x9E, 0x91, 0xAF, 0xC1,
+    0x91, 0xAE, 0x1A, 0xD9, 0xE9, 0xD1, 0xAF, 0xE0, 0xAF, 0xD1, 0xAF, 0xD1, 0x9F, 0xC3, 0xFA, 0x3E,
+    0xA6, 0x97, 0x40, 0x77, 0xA7, 0x71, 0xAD, 0x77, 0x0E, 0x97, 0x6F, 0x76, 0x9E, 0x97, 0x6E, 0x77,
+    0x0D, 0x77, 0x77, 0x77, 0x49, 0x95, 0x99, 0x7A, 0xF9, 0x2F, 0x94, 0x9F, 0xD2, 0xAE, 0xA4, 0x99,
+    0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x19, 0xE9, 0x70, 0xEA, 0x19, 0xE7, 0x1E, 0xA1,
+    0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71, 0xAE, 0x09, 0xE7, 0x2A, 0xE0, 0xE9, 0x72, 0x9E, 0x9D, 0xA7,
+    0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74, 0x9F, 0xA7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0x71, 0xA3, 0x9E,
+    0x97, 0x0A, 0xDA, 0xAF, 0x97, 0x1F, 0xF7, 0x3F, 0xDA, 0x75, 0xAD, 0xA7, 0x50, 0x79, 0x99, 0x74,
+    0x9F, 0xCA, 0x73, 0xFE, 0x73, 0x99, 0xAE, 0xA7, 0x5A, 0xE9, 0x75, 0xAE, 0x76, 0xF7, 0x6E, 0x92,
+    0x99, 0x70, 0x9E, 0x1A, 0xF9, 0x6A, 0xE0, 0xFE, 0x6E, 0xAF, 0xF6, 0xEA, 0xD1, 0xF5, 0x9F, 0xC2,
+    0xF5, 0x9F, 0x92, 0xF5, 0xAE, 0xA3, 0xF5, 0xF4, 0xF5, 0xF3, 0x9E, 0x94, 0x9E, 0xA3, 0xF5, 0xAE,
+    0x92, 0x9E, 0xA5, 0xF2, 0x9F, 0x6F, 0xCA, 0xAF, 0x7F, 0xFD, 0x96, 0x9E, 0xAF, 0xA7, 0x0A, 0xE7,
+    0x6F, 0x76, 0xF7, 0x59, 0xEA, 0x74, 0xAF, 0xDA, 0x71, 0x9F, 0xF9, 0x70, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x10, 0x77, 0x75, 0xDA, 0x1A, 0xD9, 0x71, 0xF0, 0x9E, 0xA7, 0x1E, 0xA0, 0x9E, 0x97, 0x19,
+    0xCA, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x19, 0x95, 0x99, 0x7A, 0xF9, 0x2F, 0x94, 0x9F, 0xD2, 0xAE,
+    0xA4, 0x99, 0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x19, 0xE9, 0x70, 0xEA, 0x19, 0xE7,
+    0x1E, 0xA1, 0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71, 0xAE, 0x09, 0xE7, 0x2A, 0xE0, 0xE9, 0x72, 0x9E,
+    0x9D, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74, 0x9F, 0xA7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0x71,
+    0xA3, 0x9E, 0x97, 0x0A, 0xDA, 0xAF, 0x97, 0x1F, 0xF7, 0x3F, 0xDA, 0x75, 0xAD, 0xA7, 0x50, 0x71,
+    0x9F, 0xF9, 0x74, 0xAF, 0xFA, 0x74, 0xAF, 0xF7, 0x77, 0x77, 0x77, 0x79, 0xA9, 0x77, 0x2F, 0x77,
+    0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76, 0xE0, 0xF7, 0x5A, 0xDA,
+    0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E, 0xA7, 0x2E, 0x93, 0xF7,
+    0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69, 0xE9, 0x99, 0x99, 0x99,
+    0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90, 0x9F, 0xE9, 0x3A, 0xFF,
+    0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x59, 0xFF, 0x7F, 0xFC, 0x7F, 0xFC, 0x77, 0x77, 0x72, 0x99, 0x93,
+    0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9, 0x3E,
+    0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9, 0x3F,
+    0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2, 0xFA,
+    0x29, 0xE9, 0x59, 0x73, 0x73, 0x97, 0x73, 0x9D, 0x4A, 0xA7, 0x49, 0xE9, 0x09, 0xD9, 0x74, 0x9F,
+    0xEA, 0x76, 0x9F, 0xCA, 0x77, 0x19, 0x99, 0x77, 0x77, 0x73, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF,
+    0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7,
+    0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE,
+    0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA,
+    0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF,
+    0xE9, 0x3F, 0xFC, 0x00, 0x69, 0x76, 0xAD, 0x4C, 0x96, 0xEA, 0x1A, 0xD7, 0xAF, 0xE9, 0x70, 0xAF,
+    0xC9, 0x73, 0x99, 0x77, 0x75, 0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F,
+    0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39,
+    0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0,
+    0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x73, 0x75, 0x9A, 0x97, 0x72, 0xF7,
+    0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD,
+    0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F,
+    0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99,
+    0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF,
+    0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x77, 0x0A, 0xCA, 0x77, 0x2D, 0xA7, 0x72, 0xAD, 0x77, 0x3E, 0x97,
+    0x72, 0xFD, 0x77, 0x1F, 0x97, 0x77, 0x10, 0x69, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF,
+    0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F,
+    0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC,
+    0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0xA5, 0x95, 0x9C, 0xA7, 0x5D,
+    0x75, 0xDA, 0x75, 0xDA, 0x75, 0xFC, 0x97, 0x29, 0xEA, 0x77, 0x20, 0x77, 0x77, 0x19, 0xC7, 0x7A,
+    0xDA, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xAE, 0xA9, 0x74, 0x9A, 0x97, 0x77, 0x72, 0x9A, 0xAA,
+    0xA9, 0x72, 0xAF, 0xFC, 0x95, 0xAF, 0xFE, 0xA4, 0xAF, 0xCA, 0xAA, 0xAE, 0xA3, 0xFC, 0xA4, 0xAD,
+    0x92, 0xAF, 0x6E, 0x3F, 0x96, 0xDA, 0x2A, 0xEA, 0x79, 0x93, 0xF9, 0x74, 0x9F, 0x75, 0xAF, 0x75,
+    0xFC, 0x75, 0xFA, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x97, 0x9A, 0x2A, 0xFC, 0x6A, 0xD3, 0xFD,
+    0xA9, 0x99, 0xAE, 0xA3, 0xAF, 0xFF, 0xC5, 0xAF, 0xFE, 0x79, 0xFF, 0x97, 0x49, 0x97, 0x00, 0x73,
+    0x97, 0x4A, 0xD7, 0x29, 0xE7, 0x2F, 0x71, 0xAE, 0x72, 0xE7, 0x3D, 0x74, 0x97, 0x77, 0x39, 0x99,
+    0x71, 0xAF, 0xC9, 0x59, 0xFF, 0x49, 0xFF, 0xA4, 0xF2, 0x9C, 0x4A, 0xE7, 0x2E, 0xA7, 0x1A, 0xE9,
+    0x71, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x4A, 0xA3, 0xFC, 0x19, 0xE3, 0xFF, 0xD9, 0x39, 0xFF, 0x95,
+    0x9F, 0xCA, 0x72, 0x97, 0x00, 0x77, 0x76, 0x9D, 0x97, 0x59, 0xF9, 0x73, 0x9F, 0xD7, 0x2A, 0xE0,
+    0xAE, 0x70, 0xAE, 0x2A, 0xD7, 0x0A, 0xC9, 0x4A, 0x97, 0x77, 0x59, 0xAA, 0xAA, 0x97, 0x2A, 0xFF,
+    0xC9, 0x5A, 0xFF, 0xEA, 0x4A, 0xFC, 0xAA, 0xAA, 0xEA, 0x3F, 0xCA, 0x4A, 0xD9, 0x2A, 0xF6, 0xE3,
+    0xF9, 0x6D, 0xA2, 0xAE, 0xA7, 0x99, 0x3F, 0x97, 0x49, 0xF7, 0x5A, 0xF7, 0x5F, 0xC7, 0x5F, 0xA7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC9, 0x79, 0xA2, 0xAF, 0xC6, 0xAD, 0x3F, 0xDA, 0x99, 0x9A, 0xEA,
+    0x3A, 0xFF, 0xFC, 0x5A, 0xFF, 0xE7, 0x9F, 0xF9, 0x74, 0x99, 0x70, 0x70, 0xAA, 0x97, 0x1F, 0x70,
+    0xFC, 0xA6, 0xAD, 0x9E, 0x59, 0xDA, 0x1D, 0xA3, 0x9D, 0xA2, 0xAC, 0xA4, 0xA9, 0x49, 0x77, 0x69,
+    0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xFF, 0xA3, 0xF2, 0x9C, 0x3A, 0xE7, 0x1E, 0xA7, 0x0A,
+    0xE9, 0x70, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x4A, 0xA2, 0xFC, 0x19, 0xE2, 0xFF, 0xD9, 0x29, 0xFF,
+    0x94, 0x9F, 0xCA, 0x71, 0x97, 0x77, 0x76, 0xE7, 0x6A, 0xE9, 0x75, 0xF7, 0x6A, 0xD9, 0x77, 0x97,
+    0x77, 0x72, 0x9A, 0xAA, 0xA9, 0x72, 0xAF, 0xFC, 0x95, 0xAF, 0xFE, 0xA4, 0xAF, 0xCA, 0xAA, 0xAE,
+    0xA3, 0xFC, 0xA4, 0xAD, 0x92, 0xAF, 0x6E, 0x3F, 0x96, 0xDA, 0x2A, 0xEA, 0x79, 0x93, 0xF9, 0x74,
+    0x9F, 0x75, 0xAF, 0x75, 0xFC, 0x75, 0xFA, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x97, 0x9A, 0x2A,
+    0xFC, 0x6A, 0xD3, 0xFD, 0xA9, 0x99, 0xAE, 0xA3, 0xAF, 0xFF, 0xC5, 0xAF, 0xFE, 0x79, 0xFF, 0x97,
+    0x49, 0x97, 0x00, 0x70, 0xAA, 0x71, 0xEA, 0x7A, 0xEA, 0x7A, 0xE9, 0x70, 0xAA, 0x97, 0x77, 0x73,
+    0x99, 0x97, 0xAF, 0xC9, 0x39, 0xFF, 0x29, 0xFF, 0xA2, 0xF2, 0x9C, 0x2A, 0xE7, 0x0E, 0xA7, 0xAE,
+    0x97, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x4A, 0xA1, 0xFC, 0x19, 0xE1, 0xFF, 0xD9, 0x19, 0xFF, 0x93,
+    0x9F, 0xCA, 0x70, 0x96, 0x77, 0x73, 0x9C, 0xA4, 0xAC, 0xA7, 0x0A, 0xD9, 0x2E, 0x97, 0x1E, 0x09,
+    0xE9, 0x72, 0xAF, 0xD7, 0x5A, 0xF7, 0x7A, 0xD7, 0x77, 0x73, 0x9A, 0xAA, 0xA9, 0x73, 0xAF, 0xFC,
+    0x96, 0xAF, 0xFE, 0xA5, 0xAF, 0xCA, 0xAA, 0xAE, 0xA4, 0xFC, 0xA4, 0xAD, 0x93, 0xAF, 0x6E, 0x4F,
+    0x96, 0xDA, 0x3A, 0xEA, 0x79, 0x94, 0xF9, 0x75, 0x9F, 0x76, 0xAF, 0x76, 0xFC, 0x76, 0xFA, 0x76,
+    0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97, 0x9A, 0x3A, 0xFC, 0x6A, 0xD4, 0xFD, 0xA9, 0x99, 0xAE, 0xA4,
+    0xAF, 0xFF, 0xC6, 0xAF, 0xFE, 0x70, 0x9F, 0xF9, 0x75, 0x99, 0x71, 0x77, 0x39, 0xCA, 0x3D, 0xA4,
+    0xAD, 0x2E, 0x59, 0xDA, 0x0E, 0x7F, 0xD7, 0x09, 0xF9, 0x71, 0xAD, 0x97, 0x39, 0x77, 0x74, 0x99,
+    0x97, 0x1A, 0xFC, 0x95, 0x9F, 0xF4, 0x9F, 0xFA, 0x4F, 0x29, 0xC4, 0xAE, 0x72, 0xEA, 0x71, 0xAE,
+    0x97, 0x1F, 0x72, 0xF7, 0x2F, 0x72, 0xF4, 0xAA, 0x3F, 0xC1, 0x9E, 0x3F, 0xFD, 0x93, 0x9F, 0xF9,
+    0x59, 0xFC, 0xA7, 0x29, 0x70, 0x77, 0x76, 0xAC, 0x49, 0xD9, 0x72, 0xE2, 0xAE, 0x73, 0xAD, 0xA0,
+    0xAD, 0xA7, 0x5F, 0xDA, 0x77, 0xFA, 0x77, 0x1D, 0xA7, 0x77, 0x73, 0x99, 0xAA, 0xAA, 0x99, 0x72,
+    0xAF, 0xFE, 0xA7, 0xFF, 0xFE, 0xA5, 0xDA, 0xFA, 0x9A, 0xFD, 0xA7, 0xF3, 0x9F, 0xC6, 0x9F, 0x49,
+    0xFA, 0x59, 0xF5, 0xFC, 0x5A, 0xEA, 0x59, 0xF5, 0xF9, 0x59, 0xF9, 0x4F, 0x7F, 0x93, 0x9F, 0x69,
+    0xF4, 0xAF, 0x69, 0xF4, 0xAE, 0xA6, 0xAF, 0x4F, 0x96, 0xFA, 0x4F, 0x69, 0xF4, 0x9F, 0x6F, 0xA4,
+    0xAE, 0xA5, 0xFC, 0x5F, 0xA3, 0xAF, 0xC5, 0x9F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD9, 0x5F, 0xFF, 0xA9,
+    0x77, 0x75, 0x75, 0x99, 0x29, 0x97, 0x29, 0xFC, 0xA1, 0xDA, 0x71, 0xFE, 0x09, 0xDA, 0x71, 0x99,
+    0xAE, 0xA0, 0xAD, 0x97, 0x39, 0xE9, 0x0E, 0x74, 0xAE, 0x1D, 0x97, 0x4F, 0x1D, 0x70, 0x99, 0x91,
+    0xEA, 0x19, 0x79, 0xFC, 0xAE, 0x97, 0x19, 0xFF, 0xD7, 0x19, 0xFA, 0x9F, 0xC7, 0x1F, 0x3E, 0xA7,
+    0x0A, 0xE9, 0x3E, 0x97, 0x0F, 0x39, 0xE7, 0x09, 0xEA, 0x3F, 0x70, 0xAE, 0x39, 0xF7, 0x0F, 0x3F,
+    0xA7, 0x0F, 0x29, 0xF9, 0x70, 0xF2, 0xFC, 0x97, 0x0F, 0x1D, 0xAE, 0xAA, 0xCA, 0x5F, 0xF0, 0xFD,
+    0xA5, 0xAF, 0xD1, 0xFC, 0xA7, 0xFA, 0x29, 0xE9, 0x72, 0x97, 0x70, 0x69, 0x9A, 0xAA, 0xA9, 0x97,
+    0x2A, 0xFF, 0xEA, 0x7F, 0xFF, 0xEA, 0x5D, 0xAF, 0xA9, 0xAF, 0xDA, 0x7F, 0x39, 0xFC, 0x69, 0xF4,
+    0x9F, 0xA5, 0x9F, 0x5F, 0xC5, 0xAE, 0xA5, 0x9F, 0x5F, 0x95, 0x9F, 0x94, 0xF9, 0x6F, 0x90, 0xAF,
+    0xFE, 0x29, 0xF1, 0xAF, 0xFD, 0xA2, 0x9F, 0x4F, 0xA6, 0xAF, 0x4F, 0x96, 0xFA, 0x4F, 0x69, 0xF4,
+    0x9F, 0x6F, 0xA4, 0xAE, 0xA5, 0xFC, 0x5F, 0xA3, 0xAF, 0xC5, 0x9F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD9,
+    0x5F, 0xFF, 0xA9, 0x77, 0x75, 0x75, 0x99, 0x74, 0x9F, 0xCA, 0x73, 0xFE, 0x73, 0x99, 0xAE, 0xA7,
+    0x59, 0xE9, 0x71, 0x9F, 0xFC, 0xA7, 0x9F, 0xFC, 0x74, 0xEA, 0x70, 0x9E, 0xA9, 0xE9, 0x7F, 0xFD,
+    0x7F, 0xCA, 0xFC, 0x6F, 0x92, 0xEA, 0x59, 0xEA, 0x3E, 0x95, 0xF3, 0x9E, 0x59, 0xEA, 0x3F, 0x5A,
+    0xE9, 0x29, 0xF5, 0xF3, 0xFA, 0x5F, 0x29, 0xF9, 0x5F, 0x2F, 0xC9, 0x5F, 0x1D, 0xAE, 0xAA, 0xCA,
+    0x2F, 0xF0, 0xFD, 0xA2, 0xAF, 0xD1, 0xFC, 0xA4, 0xFA, 0x29, 0xE9, 0x79, 0x75, 0x71, 0xFF, 0xA7,
+    0x29, 0xFF, 0xC7, 0x29, 0xFF, 0x97, 0x77, 0x77, 0x77, 0x75, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F,
+    0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7,
+    0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77,
+    0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA,
+    0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x4A, 0xFE, 0xA5, 0xFF, 0xC5, 0xFF, 0xA7, 0x77,
+    0x76, 0x99, 0x97, 0x1A, 0xFC, 0x95, 0x9F, 0xF4, 0x9E, 0x90, 0xAE, 0x4E, 0x29, 0xE3, 0xEA, 0x2E,
+    0xA3, 0xE2, 0xAE, 0x3A, 0xE1, 0xAE, 0x4F, 0xAF, 0x5F, 0xE9, 0x6F, 0xA9, 0x70, 0xEA, 0x4A, 0xC3,
+    0xF2, 0x9E, 0x3A, 0xFF, 0xCA, 0x4F, 0xF9, 0x59, 0xFC, 0xA7, 0x29, 0x70, 0x72, 0x95, 0x97, 0x3D,
+    0x93, 0xAC, 0x73, 0xE9, 0x09, 0xDA, 0x73, 0xFF, 0x75, 0xFC, 0xA7, 0x70, 0x99, 0x77, 0x77, 0x77,
+    0x4F, 0xFF, 0xE5, 0xFF, 0xFE, 0x69, 0xFA, 0xAA, 0xAA, 0xEA, 0x7F, 0x49, 0xDA, 0x69, 0xF4, 0x9D,
+    0x96, 0x9F, 0x49, 0xCA, 0x7A, 0xEA, 0x77, 0xF9, 0x77, 0xFA, 0x99, 0xAA, 0xA9, 0x70, 0x9F, 0xFD,
+    0xA7, 0x0A, 0xFF, 0xD7, 0x1F, 0xA7, 0x7F, 0x97, 0x7F, 0x69, 0x79, 0xF5, 0xAC, 0xA6, 0xAE, 0xA5,
+    0xDA, 0x6F, 0x94, 0xE9, 0x59, 0xFC, 0xAA, 0xFD, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x30, 0x59,
+    0x59, 0x5A, 0xCA, 0x39, 0xC5, 0xEA, 0x09, 0xAD, 0x5A, 0xFE, 0x7A, 0xFC, 0x72, 0x99, 0x77, 0x73,
+    0x99, 0x97, 0x1A, 0xFC, 0x95, 0x9F, 0xF4, 0x9E, 0x90, 0xAE, 0x4E, 0x29, 0xE3, 0xEA, 0x2E, 0xA3,
+    0xE2, 0xAE, 0x3A, 0xE1, 0xAE, 0x4F, 0xAF, 0x5F, 0xE9, 0x6F, 0xA9, 0x70, 0xEA, 0x4A, 0xC3, 0xF2,
+    0x9E, 0x3A, 0xFF, 0xCA, 0x4F, 0xF9, 0x59, 0xFC, 0xA7, 0x29, 0x70, 0x77, 0x77, 0x1E, 0x77, 0x0A,
+    0xE9, 0x77, 0xF7, 0x70, 0xE9, 0x77, 0x19, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0xE5, 0xFF, 0xFE, 0x69,
+    0xFA, 0xAA, 0xAA, 0xEA, 0x7F, 0x49, 0xDA, 0x69, 0xF4, 0x9D, 0x96, 0x9F, 0x49, 0xCA, 0x7A, 0xEA,
+    0x77, 0xF9, 0x77, 0xFA, 0x99, 0xAA, 0xA9, 0x70, 0x9F, 0xFD, 0xA7, 0x0A, 0xFF, 0xD7, 0x1F, 0xA7,
+    0x7F, 0x97, 0x7F, 0x69, 0x79, 0xF5, 0xAC, 0xA6, 0xAE, 0xA5, 0xDA, 0x6F, 0x94, 0xE9, 0x59, 0xFC,
+    0xAA, 0xFD, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x30, 0x70, 0xAA, 0x72, 0xEA, 0x70, 0xAE, 0xA7,
+    0x0A, 0xE9, 0x71, 0xAA, 0x97, 0x77, 0x76, 0x99, 0x97, 0x0A, 0xFC, 0x94, 0x9F, 0xF3, 0x9E, 0x90,
+    0xAE, 0x3E, 0x29, 0xE2, 0xEA, 0x2E, 0xA2, 0xE2, 0xAE, 0x2A, 0xE1, 0xAE, 0x3F, 0xAF, 0x4F, 0xE9,
+    0x5F, 0xA9, 0x7E, 0xA4, 0xAC, 0x2F, 0x29, 0xE2, 0xAF, 0xFC, 0xA3, 0xFF, 0x94, 0x9F, 0xCA, 0x71,
+    0x97, 0x77, 0x71, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6,
+    0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97,
+    0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA,
+    0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE,
+    0x97, 0x79, 0xD9, 0x77, 0x9D, 0x77, 0x1D, 0xA7, 0x70, 0x9E, 0x77, 0x1F, 0xD7, 0x69, 0xF7, 0x77,
+    0x10, 0x79, 0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2,
+    0xEA, 0x2E, 0x2A, 0xE2, 0xAE, 0x1A, 0xE3, 0xFA, 0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2,
+    0xF2, 0x9E, 0x2A, 0xFF, 0xCA, 0x3F, 0xFA, 0x49, 0xFD, 0x97, 0x09, 0xD9, 0x71, 0xAC, 0xA7, 0x2D,
+    0x72, 0x9D, 0x97, 0x19, 0xFC, 0x70, 0xAE, 0x97, 0x71, 0x77, 0x75, 0x9C, 0x94, 0xAC, 0xA7, 0x1A,
+    0xD9, 0x19, 0xE9, 0x71, 0x9E, 0x09, 0xE7, 0x4A, 0xFD, 0x76, 0xAF, 0x77, 0x0A, 0xD7, 0x77, 0x77,
+    0x74, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49,
+    0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF,
+    0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA,
+    0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x77,
+    0x39, 0xCA, 0x3D, 0xA4, 0xAD, 0x2E, 0x59, 0xDA, 0x0E, 0x7F, 0xD7, 0x09, 0xF9, 0x71, 0xAD, 0x97,
+    0x39, 0x77, 0x74, 0x99, 0x97, 0x1A, 0xFC, 0x95, 0x9F, 0xF4, 0x9E, 0x90, 0xAE, 0x4E, 0x29, 0xE3,
+    0xEA, 0x2E, 0xA3, 0xE2, 0xAE, 0x3A, 0xE1, 0xAE, 0x4F, 0xAF, 0x5F, 0xE9, 0x6F, 0xA9, 0x70, 0xEA,
+    0x4A, 0xC3, 0xF2, 0x9E, 0x3A, 0xFF, 0xCA, 0x4F, 0xF9, 0x59, 0xFC, 0xA7, 0x29, 0x70, 0x77, 0x77,
+    0x0A, 0xCA, 0x77, 0xFA, 0x75, 0xFD, 0xA7, 0x3E, 0x90, 0xE7, 0x19, 0xE9, 0x2D, 0xA7, 0x09, 0xCA,
+    0x49, 0xA7, 0x77, 0x79, 0x9A, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0xA6, 0xAF, 0xFF, 0xA4, 0xAF, 0xCA,
+    0xAA, 0xAF, 0x93, 0xFC, 0x95, 0xE3, 0xAF, 0x7E, 0x3F, 0x97, 0xD9, 0x2A, 0xF7, 0x09, 0x4F, 0x97,
+    0x59, 0xF7, 0x6F, 0xC7, 0x6F, 0xC4, 0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFA, 0x4A, 0xFE, 0xA0, 0xFC,
+    0x49, 0xAF, 0xD1, 0xFC, 0x7F, 0x91, 0xFC, 0x96, 0xF2, 0x9F, 0xC6, 0xF3, 0xFD, 0x93, 0x9E, 0xA3,
+    0x9F, 0xFF, 0xD9, 0x49, 0xFF, 0xFC, 0x7A, 0xFF, 0xA9, 0x74, 0x99, 0x70, 0x73, 0x9A, 0xA9, 0x77,
+    0xF7, 0x6F, 0xC9, 0x74, 0xE9, 0xE7, 0x3A, 0xD9, 0x09, 0xD9, 0x71, 0xAD, 0x92, 0xD9, 0x72, 0xA9,
+    0x39, 0x97, 0x77, 0x79, 0x99, 0x97, 0x5A, 0xFF, 0xE6, 0xFF, 0xFC, 0x5F, 0x91, 0xEA, 0x99, 0x59,
+    0xE9, 0x2A, 0xE7, 0xAE, 0x3A, 0xE7, 0xAE, 0x3F, 0x7A, 0xE2, 0xAE, 0x97, 0x0E, 0xA9, 0xAE, 0xA7,
+    0x19, 0xFE, 0x97, 0x39, 0xF9, 0x74, 0xAE, 0x76, 0x9E, 0xA7, 0x7F, 0xCA, 0x73, 0x9A, 0xFE, 0xA7,
+    0x0F, 0xAA, 0xFD, 0x94, 0x9E, 0xA3, 0xAF, 0xC4, 0xF6, 0xF9, 0x3F, 0x6A, 0xE9, 0x3F, 0xA4, 0x9F,
+    0x49, 0xFF, 0xFC, 0x69, 0xFF, 0xDA, 0x71, 0x9A, 0xFA, 0x97, 0x00, 0x71, 0x99, 0x77, 0x09, 0xD4,
+    0xC9, 0x71, 0xAD, 0xA9, 0x0A, 0xD7, 0x29, 0xFE, 0x97, 0x3A, 0xFC, 0x97, 0x69, 0x99, 0x77, 0x77,
+    0x29, 0x9A, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0xA6, 0xAF, 0xFF, 0xA4, 0xAF, 0xCA, 0xAA, 0xAF, 0x93,
+    0xFC, 0x95, 0xE3, 0xAF, 0x7E, 0x3F, 0x97, 0xD9, 0x2A, 0xF7, 0x09, 0x4F, 0x97, 0x59, 0xF7, 0x6F,
+    0xC7, 0x6F, 0xC4, 0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFA, 0x4A, 0xFE, 0xA0, 0xFC, 0x49, 0xAF, 0xD1,
+    0xFC, 0x7F, 0x91, 0xFC, 0x96, 0xF2, 0x9F, 0xC6, 0xF3, 0xFD, 0x93, 0x9E, 0xA3, 0x9F, 0xFF, 0xD9,
+    0x49, 0xFF, 0xFC, 0x7A, 0xFF, 0xA9, 0x74, 0x99, 0x70, 0x71, 0xA5, 0x97, 0x2D, 0x93, 0x9C, 0x72,
+    0xE9, 0x09, 0xAC, 0xA7, 0x2F, 0xF7, 0x4F, 0xCA, 0x77, 0x99, 0x77, 0x77, 0x29, 0x99, 0x97, 0x5A,
+    0xFF, 0xE6, 0xFF, 0xFC, 0x5F, 0x91, 0xEA, 0x99, 0x59, 0xE9, 0x2A, 0xE7, 0xAE, 0x3A, 0xE7, 0xAE,
+    0x3F, 0x7A, 0xE2, 0xAE, 0x97, 0x0E, 0xA9, 0xAE, 0xA7, 0x19, 0xFE, 0x97, 0x39, 0xF9, 0x74, 0xAE,
+    0x76, 0x9E, 0xA7, 0x7F, 0xCA, 0x73, 0x9A, 0xFE, 0xA7, 0x0F, 0xAA, 0xFD, 0x94, 0x9E, 0xA3, 0xAF,
+    0xC4, 0xF6, 0xF9, 0x3F, 0x6A, 0xE9, 0x3F, 0xA4, 0x9F, 0x49, 0xFF, 0xFC, 0x69, 0xFF, 0xDA, 0x71,
+    0x9A, 0xFA, 0x97, 0x00, 0x75, 0x97, 0x70, 0x9D, 0xA7, 0x7F, 0x76, 0x9E, 0xA7, 0x69, 0xE7, 0x77,
+    0x77, 0x76, 0x99, 0xAA, 0xA9, 0x97, 0x2A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFA, 0x4A, 0xFC, 0xAA, 0xAA,
+    0xF9, 0x3F, 0xC9, 0x5E, 0x3A, 0xF7, 0xE3, 0xF9, 0x7D, 0x92, 0xAF, 0x70, 0x94, 0xF9, 0x75, 0x9F,
+    0x76, 0xFC, 0x76, 0xFC, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xA4, 0xAF, 0xEA, 0x0F, 0xC4, 0x9A,
+    0xFD, 0x1F, 0xC7, 0xF9, 0x1F, 0xC9, 0x6F, 0x29, 0xFC, 0x6F, 0x3F, 0xD9, 0x39, 0xEA, 0x39, 0xFF,
+    0xFD, 0x94, 0x9F, 0xFF, 0xC7, 0xAF, 0xFA, 0x97, 0x49, 0x97, 0x00, 0x74, 0xAA, 0x77, 0x0E, 0x97,
+    0x6A, 0xE9, 0x76, 0xF7, 0x79, 0xCA, 0x77, 0x77, 0x77, 0x69, 0x99, 0x97, 0x5A, 0xFF, 0xE6, 0xFF,
+    0xFC, 0x5F, 0x91, 0xEA, 0x99, 0x59, 0xE9, 0x2A, 0xE7, 0xAE, 0x3A, 0xE7, 0xAE, 0x3F, 0x7A, 0xE2,
+    0xAE, 0x97, 0x0E, 0xA9, 0xAE, 0xA7, 0x19, 0xFE, 0x97, 0x39, 0xF9, 0x74, 0xAE, 0x76, 0x9E, 0xA7,
+    0x7F, 0xCA, 0x73, 0x9A, 0xFE, 0xA7, 0x0F, 0xAA, 0xFD, 0x94, 0x9E, 0xA3, 0xAF, 0xC4, 0xF6, 0xF9,
+    0x3F, 0x6A, 0xE9, 0x3F, 0xA4, 0x9F, 0x49, 0xFF, 0xFC, 0x69, 0xFF, 0xDA, 0x71, 0x9A, 0xFA, 0x97,
+    0x00, 0x71, 0x99, 0xAA, 0xA9, 0x97, 0x2A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFA, 0x4A, 0xFC, 0xAA, 0xAA,
+    0xF9, 0x3F, 0xC9, 0x5E, 0x3A, 0xF7, 0xE3, 0xF9, 0x7D, 0x92, 0xAF, 0x70, 0x94, 0xF9, 0x75, 0x9F,
+    0x76, 0xFC, 0x76, 0xFC, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xA4, 0xAF, 0xEA, 0x0F, 0xC4, 0x9A,
+    0xFD, 0x1F, 0xC7, 0xF9, 0x1F, 0xC9, 0x6F, 0x29, 0xFC, 0x6F, 0x3F, 0xD9, 0x39, 0xEA, 0x39, 0xFF,
+    0xFD, 0x94, 0x9F, 0xFF, 0xC7, 0xAF, 0xFA, 0x97, 0x49, 0x97, 0x71, 0xAA, 0x77, 0x0E, 0xA7, 0x7E,
+    0xA7, 0x7E, 0x97, 0x7E, 0x76, 0x9E, 0x77, 0x9A, 0x97, 0x20, 0x75, 0x9A, 0x77, 0x0D, 0x97, 0x7D,
+    0xA7, 0x79, 0xD7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0x77, 0x77, 0x29, 0x99, 0x97,
+    0x5A, 0xFF, 0xE6, 0xFF, 0xFC, 0x5F, 0x91, 0xEA, 0x99, 0x59, 0xE9, 0x2A, 0xE7, 0xAE, 0x3A, 0xE7,
+    0xAE, 0x3F, 0x7A, 0xE2, 0xAE, 0x97, 0x0E, 0xA9, 0xAE, 0xA7, 0x19, 0xFE, 0x97, 0x39, 0xF9, 0x74,
+    0xAE, 0x76, 0x9E, 0xA7, 0x7F, 0xCA, 0x73, 0x9A, 0xFE, 0xA7, 0x0F, 0xAA, 0xFD, 0x94, 0x9E, 0xA3,
+    0xAF, 0xC4, 0xF6, 0xF9, 0x3F, 0x6A, 0xE9, 0x3F, 0xA4, 0x9F, 0x49, 0xFF, 0xFC, 0x69, 0xFF, 0xDA,
+    0x71, 0x9A, 0xFA, 0x97, 0x00, 0x77, 0x77, 0x72, 0xDA, 0x77, 0x6F, 0xA7, 0x74, 0xFD, 0x97, 0x71,
+    0x9E, 0x99, 0xE7, 0x70, 0x9E, 0x91, 0x9D, 0x97, 0x79, 0xCA, 0x49, 0xA7, 0x77, 0x77, 0x77, 0x70,
+    0xFF, 0xC2, 0xFF, 0xC5, 0xFF, 0xC2, 0xFF, 0xA6, 0x9F, 0xA5, 0x9F, 0xA7, 0x1F, 0x96, 0xF7, 0x19,
+    0xF6, 0x9F, 0x71, 0x9F, 0x6A, 0xEA, 0x71, 0xAE, 0xA6, 0xFA, 0x71, 0xF9, 0x6F, 0x97, 0x1F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xF7, 0x19, 0xFF, 0xFF, 0x71, 0xAF, 0xFF, 0xEA, 0x71, 0xFA, 0x6F, 0x97, 0x1F,
+    0x96, 0xF9, 0x71, 0xF6, 0x9F, 0x71, 0x9F, 0x6A, 0xF7, 0x1A, 0xF6, 0xAE, 0xA7, 0x1F, 0xA6, 0xF9,
+    0x70, 0x9F, 0xA9, 0x4A, 0xFA, 0x95, 0x9F, 0xFA, 0x1A, 0xFF, 0x94, 0xFF, 0xC9, 0x1F, 0xFC, 0x40,
+    0x69, 0xAA, 0x74, 0xAE, 0xA7, 0x2A, 0xFC, 0x97, 0x0A, 0xE9, 0xE7, 0xAD, 0xA1, 0x9D, 0x96, 0xD9,
+    0x3A, 0xC7, 0x77, 0x39, 0x97, 0x29, 0xFD, 0x71, 0xFE, 0x71, 0x99, 0xAF, 0x73, 0x9E, 0xA7, 0x3A,
+    0xE9, 0x73, 0xF7, 0x4E, 0xA2, 0x99, 0x95, 0x9E, 0x90, 0x9F, 0xA4, 0xAE, 0x0A, 0xFD, 0x4A, 0xEA,
+    0xFE, 0x93, 0xFD, 0x90, 0xAE, 0x4F, 0xC9, 0x1F, 0x39, 0xFA, 0x2E, 0xA3, 0xAF, 0x29, 0xE9, 0x3F,
+    0x92, 0xAE, 0x4F, 0x3F, 0x39, 0xEA, 0x3E, 0xA3, 0xAE, 0x92, 0x9E, 0x93, 0xF9, 0x2A, 0xE9, 0x9C,
+    0x90, 0xF3, 0xFE, 0x90, 0xF3, 0xFD, 0xA0, 0x9E, 0x93, 0x9F, 0x97, 0x49, 0x40, 0x77, 0x77, 0xFF,
+    0xC2, 0xFF, 0xC5, 0xFF, 0xC2, 0xFF, 0xA6, 0x9F, 0xA5, 0x9F, 0xA7, 0x1F, 0x96, 0xF7, 0xAA, 0xAF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xA9, 0x39, 0xFF, 0xFF, 0xFC, 0xA4, 0x99, 0xFC, 0x99, 0x99, 0x99,
+    0x9F, 0xA9, 0x97, 0xF9, 0x6F, 0x97, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x19, 0xFF, 0xFF, 0x71,
+    0xAF, 0xFF, 0xEA, 0x71, 0xFA, 0x6F, 0x97, 0x1F, 0x96, 0xF9, 0x71, 0xF6, 0x9F, 0x71, 0x9F, 0x6A,
+    0xF7, 0x1A, 0xF6, 0xAE, 0xA7, 0x1F, 0xA6, 0xF9, 0x70, 0x9F, 0xA9, 0x4A, 0xFA, 0x95, 0x9F, 0xFA,
+    0x1A, 0xFF, 0x94, 0xFF, 0xC9, 0x1F, 0xFC, 0x40, 0x59, 0x97, 0x29, 0xFD, 0x71, 0xFE, 0x71, 0x99,
+    0xAF, 0x73, 0x9E, 0xA7, 0x0A, 0xFF, 0xC9, 0x5A, 0xFF, 0xC7, 0x1E, 0xA7, 0x39, 0xE9, 0x1A, 0xE9,
+    0x4A, 0xE0, 0x9F, 0xD4, 0xF9, 0xFE, 0x93, 0xEA, 0xDA, 0x0F, 0x4F, 0xC9, 0x1F, 0x39, 0xFA, 0x2F,
+    0x3A, 0xF2, 0x9E, 0xA3, 0xFA, 0x2A, 0xE4, 0xF3, 0xF3, 0x9F, 0x3E, 0xA3, 0xAE, 0x92, 0x9E, 0x93,
+    0xF3, 0xAE, 0x99, 0xC9, 0x0F, 0x3F, 0xE9, 0x0F, 0x3F, 0xDA, 0x09, 0xE9, 0x39, 0xF9, 0x74, 0x94,
+    0x79, 0x97, 0x39, 0xEA, 0x1A, 0xC6, 0xFF, 0xC5, 0x9D, 0x9A, 0xFC, 0x6C, 0x91, 0xAD, 0xA7, 0x77,
+    0x77, 0x76, 0xFF, 0xC9, 0x5F, 0xFC, 0x79, 0xFC, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7,
+    0x2F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x97, 0x19, 0xF7,
+    0x2A, 0xF7, 0x2A, 0xEA, 0x71, 0x9F, 0xC9, 0x69, 0xFF, 0xA5, 0xFF, 0xC9, 0x40, 0x29, 0xAA, 0x29,
+    0x92, 0xFC, 0x1D, 0x19, 0xFF, 0xC1, 0xAC, 0xA0, 0xAF, 0x92, 0xA2, 0xAC, 0xA7, 0x77, 0x69, 0x96,
+    0xAF, 0xA4, 0xFE, 0x49, 0x9A, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x6A, 0xE9, 0x6F, 0x7E,
+    0xA6, 0x9E, 0x96, 0xAE, 0x99, 0xC9, 0x3A, 0xFD, 0x93, 0xAF, 0xCA, 0x49, 0xF9, 0x79, 0x70, 0x5A,
+    0xFF, 0x6F, 0xFC, 0x6F, 0xFA, 0x77, 0x77, 0x77, 0x5F, 0xFC, 0x95, 0xFF, 0xC7, 0x9F, 0xC7, 0x2F,
+    0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA,
+    0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7, 0x19, 0xFC, 0x96, 0x9F, 0xFA,
+    0x5F, 0xFC, 0x94, 0x1F, 0xF9, 0x09, 0xFF, 0xA0, 0x9F, 0xF7, 0x77, 0x29, 0x95, 0xAF, 0xA3, 0xFE,
+    0x39, 0x9A, 0xEA, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x5A, 0xE9, 0x5F, 0x6E, 0xA5, 0x9E, 0x95,
+    0xAE, 0x99, 0xC9, 0x2A, 0xFD, 0x92, 0xAF, 0xCA, 0x39, 0xF9, 0x69, 0x70, 0x69, 0x59, 0x6D, 0xA3,
+    0x9C, 0x6E, 0x90, 0x9A, 0xD6, 0xFF, 0x70, 0xAF, 0xC7, 0x39, 0x97, 0x77, 0x77, 0x1F, 0xFC, 0x95,
+    0xFF, 0xC7, 0x9F, 0xC7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72,
+    0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7,
+    0x19, 0xFC, 0x96, 0x9F, 0xFA, 0x5F, 0xFC, 0x94, 0x29, 0x59, 0x1D, 0x4A, 0xA0, 0x9E, 0x90, 0x9D,
+    0x91, 0xFF, 0x29, 0xFC, 0xA6, 0x99, 0x77, 0x29, 0x95, 0xAF, 0xA3, 0xFE, 0x39, 0x9A, 0xEA, 0x59,
+    0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x5A, 0xE9, 0x5F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x99, 0xC9, 0x2A,
+    0xFD, 0x92, 0xAF, 0xCA, 0x39, 0xF9, 0x69, 0x70, 0x77, 0x3F, 0xFC, 0x94, 0xFF, 0xC6, 0x9F, 0xC7,
+    0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A,
+    0xEA, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x09, 0xFC, 0x95, 0x9F,
+    0xFA, 0x4F, 0xFC, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x73, 0xDA, 0x72, 0x9E, 0x73, 0xFD, 0x70, 0x9F,
+    0x77, 0x30, 0x75, 0xE4, 0xF9, 0x29, 0xF9, 0x3F, 0x49, 0xA9, 0x76, 0x99, 0x3A, 0xFA, 0x1F, 0xE1,
+    0x99, 0xAE, 0xA3, 0x9E, 0x93, 0xAE, 0x4F, 0x4E, 0xA3, 0xAE, 0x93, 0xF4, 0xEA, 0x39, 0xE9, 0x3A,
+    0xE9, 0x9C, 0x90, 0xAF, 0xD9, 0x0A, 0xFC, 0xA1, 0x9F, 0x93, 0x9D, 0x5D, 0x5A, 0xCA, 0x5E, 0x5F,
+    0xCA, 0x3F, 0x74, 0x77, 0x7A, 0xD9, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71, 0xAD, 0xA7, 0x77, 0x77,
+    0x74, 0xFF, 0xC9, 0x4F, 0xFC, 0x69, 0xFC, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F,
+    0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1A,
+    0xF7, 0x1A, 0xEA, 0x70, 0x9F, 0xC9, 0x59, 0xFF, 0xA4, 0xFF, 0xC9, 0x30, 0x39, 0x92, 0xAF, 0xA0,
+    0xFE, 0x09, 0x9A, 0xEA, 0x29, 0xE9, 0x2A, 0xE3, 0xF3, 0xEA, 0x2A, 0xE9, 0x2F, 0x3E, 0xA2, 0x9E,
+    0x92, 0xAE, 0x99, 0xC9, 0xAF, 0xD9, 0xAF, 0xCA, 0x09, 0xF9, 0x39, 0x40, 0x77, 0x77, 0xFF, 0xC9,
+    0x1F, 0xFC, 0x5F, 0xFC, 0x19, 0xFF, 0xA6, 0x9F, 0xC5, 0x9F, 0xA7, 0x1F, 0x96, 0xF7, 0x2F, 0x69,
+    0xF7, 0x19, 0xF6, 0xAE, 0xA7, 0x1A, 0xF6, 0xF9, 0x71, 0xFA, 0x6F, 0x97, 0x1F, 0x95, 0x9F, 0x72,
+    0xF6, 0xAF, 0x71, 0x9F, 0x6A, 0xEA, 0x71, 0xAE, 0xA6, 0xF9, 0x71, 0xF9, 0x6F, 0x72, 0xF9, 0x59,
+    0xF7, 0x19, 0xF6, 0xAF, 0x71, 0xAF, 0x6F, 0xA7, 0x1A, 0xEA, 0x6F, 0x97, 0x09, 0xFC, 0x95, 0xF7,
+    0x9F, 0xFA, 0x3A, 0xF7, 0xFF, 0xC9, 0x3F, 0x97, 0x75, 0xF7, 0x70, 0xAC, 0x2F, 0xA7, 0x79, 0xEA,
+    0xFC, 0x77, 0x0A, 0xFF, 0x77, 0x19, 0xFD, 0xA7, 0x73, 0x9A, 0xAA, 0x97, 0x40, 0x77, 0x7E, 0x59,
+    0xE4, 0xF9, 0x4F, 0x92, 0x9F, 0x93, 0x9F, 0x4F, 0x49, 0xEA, 0x49, 0xA9, 0x69, 0xA9, 0x77, 0x70,
+    0x99, 0x69, 0x99, 0x3A, 0xFA, 0x29, 0xFC, 0xA1, 0xFE, 0x2F, 0xDA, 0x19, 0x9A, 0xEA, 0x29, 0x9A,
+    0xE9, 0x39, 0xE9, 0x4A, 0xE9, 0x3A, 0xE5, 0xAE, 0x4F, 0x5F, 0x4E, 0xA5, 0xF3, 0xAE, 0x94, 0x9E,
+    0xA3, 0xF5, 0xAE, 0x93, 0xEA, 0x5F, 0x39, 0xE9, 0x5F, 0x3A, 0xE9, 0x9C, 0x91, 0x9E, 0xA3, 0xAF,
+    0xD9, 0x1A, 0xE9, 0x3A, 0xFC, 0xA2, 0xF4, 0x9F, 0x93, 0xF6, 0x95, 0x9E, 0xA7, 0x5A, 0xE7, 0x1A,
+    0x29, 0xEA, 0x70, 0xEA, 0xAF, 0x70, 0x9F, 0xF9, 0x71, 0xFE, 0x97, 0x3A, 0xAC, 0xA9, 0x71, 0x77,
+    0x77, 0x1A, 0xD7, 0x7A, 0xF7, 0x5A, 0xFD, 0x73, 0xEA, 0x0E, 0x97, 0x1E, 0xA2, 0xE7, 0x1A, 0xC9,
+    0x4A, 0x77, 0x77, 0x77, 0x1A, 0xFF, 0xA7, 0x1F, 0xFC, 0x73, 0x9F, 0xC9, 0x75, 0xFA, 0x76, 0xF9,
+    0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0x9F, 0x76, 0xAE,
+    0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xFA,
+    0x71, 0xC9, 0x19, 0xF7, 0x1F, 0xFC, 0x97, 0x1F, 0xFA, 0x72, 0xFE, 0x97, 0x4A, 0xAA, 0xA9, 0x74,
+    0x74, 0xAA, 0x97, 0x5F, 0x74, 0xAF, 0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xDA, 0x1D, 0xA7, 0x9D, 0xA2,
+    0xAC, 0xA7, 0x0A, 0x94, 0xA7, 0x77, 0x59, 0x99, 0x73, 0xAF, 0xC7, 0x29, 0xFD, 0x73, 0x99, 0xF7,
+    0x5F, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xAE, 0x97, 0x4A, 0xE7, 0x5F, 0x75, 0xEA, 0x74, 0x9E, 0xA7,
+    0x4A, 0xE9, 0x74, 0xF7, 0x5F, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F, 0x7A, 0x92, 0xAE, 0x96, 0x9D,
+    0xA9, 0xAE, 0xA7, 0xAF, 0xF7, 0x09, 0xFE, 0x72, 0x9A, 0xDA, 0x97, 0x20, 0x77, 0x74, 0xFF, 0xC1,
+    0xFE, 0xA4, 0xFF, 0xA1, 0xFE, 0x69, 0xFA, 0x4F, 0x97, 0x0F, 0x4F, 0x71, 0x9F, 0x29, 0xF7, 0x29,
+    0xF1, 0x9F, 0x73, 0xAE, 0xA0, 0x9E, 0xA7, 0x4F, 0x99, 0xEA, 0x75, 0xFA, 0xEA, 0x75, 0x9F, 0xEA,
+    0x76, 0xAF, 0xF7, 0x6F, 0xAF, 0xA7, 0x5F, 0x99, 0xF7, 0x5F, 0x1F, 0xC7, 0x39, 0xF2, 0xFA, 0x72,
+    0xAE, 0xA2, 0xAF, 0xA7, 0x1F, 0x93, 0xFC, 0xA7, 0x9F, 0xA9, 0x29, 0xFC, 0xA4, 0x9F, 0xF9, 0x29,
+    0xFD, 0x3F, 0xFC, 0x49, 0xFA, 0x77, 0x49, 0x76, 0x9A, 0x97, 0x73, 0xAE, 0x77, 0x4E, 0x77, 0x4E,
+    0x77, 0x3A, 0xD9, 0x77, 0x2A, 0xD9, 0x77, 0x3A, 0xA7, 0x50, 0x59, 0x97, 0x09, 0xFD, 0x7F, 0xE7,
+    0x99, 0xAF, 0x71, 0x9E, 0xA7, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x29, 0x94, 0x9E, 0x1A, 0xF3, 0x9E,
+    0x0F, 0xDA, 0x2A, 0xDA, 0xDA, 0x9F, 0x2F, 0xC9, 0x1A, 0xDA, 0x2F, 0x92, 0xE9, 0x19, 0xEA, 0x2A,
+    0xE2, 0xAE, 0x2A, 0xE3, 0xFA, 0xFA, 0x4F, 0xE9, 0x59, 0xEA, 0xE9, 0x5A, 0xE0, 0xAE, 0x5F, 0x1F,
+    0x93, 0xF1, 0x9F, 0xCA, 0x90, 0xEA, 0x2A, 0xFC, 0xA9, 0xE9, 0x39, 0xF7, 0x39, 0x70, 0x99, 0x73,
+    0xE9, 0x72, 0xE9, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xDA, 0x73, 0xA7, 0x10, 0x39, 0x99, 0x59, 0x91,
+    0x9F, 0xC9, 0x29, 0xEA, 0x0F, 0xDA, 0x1A, 0xFC, 0x09, 0x9A, 0xE9, 0x09, 0xFC, 0xA2, 0x9E, 0x09,
+    0xE9, 0x9A, 0x39, 0xE0, 0xDA, 0x7A, 0xFC, 0xA7, 0x0F, 0xD7, 0x1F, 0xDA, 0x79, 0xEA, 0xE7, 0xAE,
+    0x0E, 0x96, 0xF0, 0x9E, 0x29, 0x2E, 0xA1, 0xF9, 0x9C, 0xA0, 0x9E, 0x91, 0xAF, 0xD9, 0x0A, 0xE9,
+    0x2F, 0xCA, 0x1F, 0x39, 0xEA, 0x77, 0x10, 0x77, 0x76, 0xC9, 0x75, 0xAD, 0xA7, 0x39, 0xFC, 0x72,
+    0xAF, 0xC7, 0x29, 0xF9, 0x73, 0x9A, 0x97, 0x77, 0x77, 0x70, 0xFF, 0xC7, 0x0F, 0xFC, 0x71, 0x9F,
+    0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A,
+    0xF7, 0x4F, 0xA7, 0x4F, 0x97, 0x4F, 0x59, 0xA9, 0x39, 0xF5, 0xDA, 0x3A, 0xF4, 0x9D, 0xA3, 0xFA,
+    0x4E, 0x92, 0x9F, 0xCA, 0xAF, 0xD1, 0x9F, 0xFF, 0xDA, 0x1F, 0xFF, 0xE1, 0x77, 0x39, 0xD6, 0x9F,
+    0x49, 0xFD, 0x39, 0xFC, 0xA4, 0x9C, 0xA9, 0x77, 0x69, 0x95, 0x9F, 0xCA, 0x4F, 0xE4, 0x99, 0xAE,
+    0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7F, 0x69, 0xEA, 0x6A, 0xE9, 0x6F, 0x7F, 0x7E, 0xA6, 0x9E, 0x96,
+    0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0xA6, 0xAE, 0x96, 0xF9, 0xAC, 0x4F, 0xE4, 0xFD, 0xA4, 0xAF, 0x97,
+    0x97, 0x77, 0x6F, 0xFC, 0x70, 0xFF, 0xC7, 0x19, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x74, 0x9F, 0x74,
+    0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0x74, 0xFA, 0x74, 0xF9, 0x74, 0xF5, 0x9A,
+    0x93, 0x9F, 0x5D, 0xA3, 0xAF, 0x49, 0xDA, 0x3F, 0xA4, 0xE9, 0x29, 0xFC, 0xAA, 0xFD, 0x19, 0xFF,
+    0xFD, 0xA1, 0xFF, 0xFE, 0x77, 0x73, 0x9A, 0x97, 0x5A, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5A, 0xD7,
+    0x5A, 0xD9, 0x75, 0xAA, 0x71, 0x69, 0x93, 0x9F, 0xCA, 0x2F, 0xE2, 0x99, 0xAE, 0xA4, 0x9E, 0x94,
+    0xAE, 0x5F, 0x5F, 0x49, 0xEA, 0x4A, 0xE9, 0x4F, 0x5F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x5F, 0x5E,
+    0xA4, 0x9E, 0xA4, 0xAE, 0x94, 0xF9, 0xAC, 0x2F, 0xE2, 0xFD, 0xA2, 0xAF, 0x95, 0x97, 0x99, 0x6E,
+    0x6E, 0x95, 0xE6, 0xD9, 0x5D, 0x95, 0x99, 0x70, 0x77, 0x99, 0x77, 0x0E, 0x77, 0xE4, 0xFF, 0xC0,
+    0x9D, 0xA4, 0xFF, 0xC0, 0xAD, 0x69, 0xFA, 0x2D, 0xA7, 0xF9, 0x2D, 0x79, 0xF3, 0x99, 0x79, 0xF7,
+    0x5A, 0xEA, 0x75, 0xF9, 0x75, 0xF7, 0x59, 0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x5F, 0x59,
+    0xA9, 0x49, 0xF5, 0xDA, 0x4A, 0xF4, 0x9D, 0xA4, 0xFA, 0x4E, 0x93, 0x9F, 0xCA, 0xAF, 0xD2, 0x9F,
+    0xFF, 0xDA, 0x2F, 0xFF, 0xE2, 0x59, 0x92, 0x99, 0x29, 0xFC, 0xA1, 0xDA, 0x1F, 0xE0, 0x9D, 0xA1,
+    0x99, 0xAE, 0xA0, 0xAD, 0x93, 0x9E, 0x90, 0xE4, 0xAE, 0x1D, 0x94, 0xF1, 0xD5, 0xF1, 0x95, 0x9E,
+    0xA7, 0x0A, 0xE9, 0x70, 0xF7, 0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xEA,
+    0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF9, 0xAC, 0x6F, 0xE6, 0xFD, 0xA6, 0xAF, 0x97, 0x19, 0x71,
+    0x77, 0x7F, 0xFC, 0x71, 0xFF, 0xC7, 0x29, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75, 0x9F, 0x75, 0xAE,
+    0xA3, 0x9D, 0x6F, 0x92, 0x9E, 0xA5, 0xF3, 0xF9, 0x49, 0xF3, 0xF5, 0xAF, 0x4A, 0xA6, 0xFA, 0x75,
+    0xF9, 0x75, 0xF5, 0x9A, 0x94, 0x9F, 0x5D, 0xA4, 0xAF, 0x49, 0xDA, 0x4F, 0xA4, 0xE9, 0x39, 0xFC,
+    0xAA, 0xFD, 0x29, 0xFF, 0xFD, 0xA2, 0xFF, 0xFE, 0x20, 0x59, 0x97, 0x9F, 0xCA, 0x6F, 0xE6, 0x99,
+    0xAE, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x70, 0xF2,
+    0xDA, 0x3F, 0x1F, 0x3E, 0xA0, 0x9F, 0x29, 0xE9, 0x1E, 0x92, 0xAE, 0x29, 0x94, 0xF7, 0x1E, 0xA7,
+    0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x9A, 0xC6, 0xFE, 0x6F, 0xDA, 0x6A, 0xF9, 0x71, 0x97, 0x10,
+    0x77, 0x6F, 0xFC, 0x70, 0xFF, 0xC7, 0x19, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x74, 0x9F, 0x74, 0xAE,
+    0xA0, 0x9A, 0x71, 0xFF, 0x71, 0xFD, 0xA9, 0x70, 0x9F, 0xA7, 0x2A, 0xFC, 0x71, 0xAF, 0xDA, 0x71,
+    0xDA, 0xF9, 0x74, 0xF5, 0x9A, 0x93, 0x9F, 0x5D, 0xA3, 0xAF, 0x49, 0xDA, 0x3F, 0xA4, 0xE9, 0x29,
+    0xFC, 0xAA, 0xFD, 0x19, 0xFF, 0xFD, 0xA1, 0xFF, 0xFE, 0x10, 0x69, 0x95, 0x9F, 0xCA, 0x4F, 0xE4,
+    0x99, 0xAE, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7F, 0x69, 0xEA, 0x6A, 0xEA, 0xD4, 0xFD, 0xA4, 0xFA,
+    0x5F, 0xA4, 0xAF, 0xC9, 0x4F, 0xD7, 0xF7, 0xEA, 0x69, 0xEA, 0x6A, 0xE9, 0x6F, 0x9A, 0xC4, 0xFE,
+    0x4F, 0xDA, 0x4A, 0xF9, 0x79, 0x60, 0x77, 0x77, 0x71, 0xAA, 0x77, 0x49, 0xE7, 0x73, 0xAF, 0x77,
+    0x19, 0xFC, 0xA7, 0x71, 0xFA, 0x77, 0x3A, 0x97, 0x77, 0x77, 0x77, 0x70, 0xFD, 0xA4, 0x9F, 0xEA,
+    0x3F, 0xE4, 0x9F, 0xE9, 0x49, 0xFC, 0xA5, 0xAE, 0x97, 0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA,
+    0x79, 0xFE, 0x4E, 0x97, 0xAF, 0xE9, 0x3E, 0x70, 0xEA, 0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A,
+    0xE7, 0x9E, 0x1F, 0xA1, 0xAD, 0xA7, 0xAE, 0x19, 0xF1, 0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E,
+    0x92, 0xAF, 0x9E, 0x70, 0xE4, 0xFF, 0x79, 0xE4, 0xAF, 0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A,
+    0xFC, 0x79, 0xEA, 0x94, 0x9F, 0xC5, 0x9F, 0xEA, 0x4F, 0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x49,
+    0x70, 0x74, 0xA7, 0x7A, 0xD7, 0x6E, 0x97, 0x4F, 0x74, 0x9E, 0x75, 0xE7, 0x6D, 0x77, 0x77, 0x75,
+    0x99, 0x94, 0x99, 0x49, 0xFC, 0xA1, 0xAF, 0x92, 0xFD, 0xA0, 0xFE, 0x29, 0x9A, 0xEA, 0xFF, 0x49,
+    0xFD, 0x1F, 0x49, 0xFC, 0x2E, 0xA4, 0xAF, 0x29, 0xE9, 0x4F, 0xA2, 0xAE, 0x5F, 0x3F, 0x49, 0xEA,
+    0x29, 0xEA, 0x4A, 0xE9, 0x2A, 0xE9, 0x4F, 0x3F, 0x5F, 0x3F, 0x0A, 0xC1, 0x9E, 0xA3, 0xFE, 0x1A,
+    0xE9, 0x3F, 0xD9, 0x1F, 0x4A, 0xEA, 0x76, 0x94, 0x77, 0x74, 0xFD, 0xA4, 0x9F, 0xEA, 0x3F, 0xE4,
+    0x9F, 0xE9, 0x49, 0xFC, 0xA5, 0xAE, 0x97, 0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA, 0x79, 0xFE,
+    0x4E, 0x97, 0xAF, 0xE9, 0x3E, 0x70, 0xEA, 0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A, 0xE7, 0x9E,
+    0x1F, 0xA1, 0xAD, 0xA7, 0xAE, 0x19, 0xF1, 0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E, 0x92, 0xAF,
+    0x9E, 0x70, 0xE4, 0xFF, 0x79, 0xE4, 0xAF, 0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A, 0xFC, 0x79,
+    0xEA, 0x94, 0x9F, 0xC5, 0x9F, 0xEA, 0x4F, 0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x49, 0x77, 0x19,
+    0xA9, 0x77, 0x49, 0xE9, 0x77, 0x4E, 0xA7, 0x74, 0xE9, 0x77, 0x39, 0xDA, 0x77, 0x39, 0xDA, 0x77,
+    0x49, 0xA9, 0x76, 0x39, 0x99, 0x49, 0x94, 0x9F, 0xCA, 0x1A, 0xF9, 0x2F, 0xDA, 0x0F, 0xE2, 0x99,
+    0xAE, 0xAF, 0xF4, 0x9F, 0xD1, 0xF4, 0x9F, 0xC2, 0xEA, 0x4A, 0xF2, 0x9E, 0x94, 0xFA, 0x2A, 0xE5,
+    0xF3, 0xF4, 0x9E, 0xA2, 0x9E, 0xA4, 0xAE, 0x92, 0xAE, 0x94, 0xF3, 0xF5, 0xF3, 0xF0, 0xAC, 0x19,
+    0xEA, 0x3F, 0xE1, 0xAE, 0x93, 0xFD, 0x91, 0xF4, 0xAE, 0xA7, 0x69, 0x73, 0x99, 0x76, 0xE9, 0x75,
+    0xE9, 0x75, 0xAD, 0x76, 0xD9, 0x75, 0xDA, 0x76, 0xA7, 0x30, 0x77, 0x77, 0x2A, 0xC4, 0x9D, 0x97,
+    0x5E, 0x2A, 0xE7, 0x6A, 0xDA, 0x0A, 0xDA, 0x77, 0x0F, 0xDA, 0x77, 0x2F, 0xA7, 0x73, 0x9D, 0x97,
+    0x77, 0x77, 0x77, 0x6F, 0xDA, 0x49, 0xFE, 0xA3, 0xFE, 0x49, 0xFE, 0x94, 0x9F, 0xCA, 0x5A, 0xE9,
+    0x7F, 0xD5, 0x9E, 0x70, 0xFD, 0xA4, 0xAD, 0xA7, 0x9F, 0xE4, 0xE9, 0x7A, 0xFE, 0x93, 0xE7, 0x0E,
+    0xAF, 0xC2, 0x9E, 0x70, 0xE9, 0x9F, 0x91, 0xAE, 0x79, 0xE1, 0xFA, 0x1A, 0xDA, 0x7A, 0xE1, 0x9F,
+    0x1E, 0x97, 0xAD, 0xA2, 0xFA, 0x0E, 0x70, 0xE9, 0x2A, 0xF9, 0xE7, 0x0E, 0x4F, 0xF7, 0x9E, 0x4A,
+    0xFD, 0xA7, 0xAE, 0x5F, 0xD9, 0x7E, 0xA5, 0xAF, 0xC7, 0x9E, 0xA9, 0x49, 0xFC, 0x59, 0xFE, 0xA4,
+    0xFA, 0x5A, 0xFE, 0x94, 0x9E, 0x97, 0x74, 0x97, 0x00, 0x77, 0x79, 0xCA, 0x3E, 0x79, 0xD2, 0xE7,
+    0x1E, 0x0E, 0x72, 0xAF, 0xC9, 0x73, 0xF9, 0x74, 0xAD, 0xA7, 0x69, 0x97, 0x77, 0x49, 0x99, 0x49,
+    0x94, 0x9F, 0xCA, 0x1A, 0xF9, 0x2F, 0xDA, 0x0F, 0xE2, 0x99, 0xAE, 0xAF, 0xF4, 0x9F, 0xD1, 0xF4,
+    0x9F, 0xC2, 0xEA, 0x4A, 0xF2, 0x9E, 0x94, 0xFA, 0x2A, 0xE5, 0xF3, 0xF4, 0x9E, 0xA2, 0x9E, 0xA4,
+    0xAE, 0x92, 0xAE, 0x94, 0xF3, 0xF5, 0xF3, 0xF0, 0xAC, 0x19, 0xEA, 0x3F, 0xE1, 0xAE, 0x93, 0xFD,
+    0x91, 0xF4, 0xAE, 0xA7, 0x69, 0x40, 0x3A, 0xA7, 0x73, 0xF7, 0x72, 0xF7, 0x72, 0xAE, 0x77, 0x2E,
+    0xA7, 0x72, 0xE7, 0x72, 0xEA, 0x39, 0x94, 0x99, 0x93, 0x9E, 0x1A, 0xFA, 0x1A, 0xF9, 0x2D, 0xA1,
+    0xFD, 0xA0, 0xFE, 0x79, 0x99, 0xEA, 0xAF, 0xE7, 0x2F, 0xD1, 0xF7, 0x19, 0xFC, 0x2E, 0xA7, 0x1A,
+    0xF9, 0x19, 0xE9, 0x71, 0xFA, 0x2A, 0xE7, 0x2F, 0x3F, 0x71, 0x9F, 0x3E, 0xA7, 0x1A, 0xE9, 0x29,
+    0xE9, 0x71, 0xF3, 0xAE, 0x72, 0xF3, 0xF0, 0xAC, 0x7F, 0x3F, 0xE6, 0x9E, 0xA3, 0xFD, 0x96, 0xAE,
+    0x4A, 0xF9, 0x77, 0x29, 0x40, 0x77, 0x74, 0xFD, 0xA4, 0x9F, 0xEA, 0x3F, 0xE4, 0x9F, 0xE9, 0x49,
+    0xFC, 0xA5, 0xAE, 0x97, 0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA, 0x79, 0xFE, 0x4E, 0x97, 0xAF,
+    0xE9, 0x3E, 0x70, 0xEA, 0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A, 0xE7, 0x9E, 0x1F, 0xA1, 0xAD,
+    0xA7, 0xAE, 0x19, 0xF1, 0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E, 0x92, 0xAF, 0x9E, 0x70, 0xE4,
+    0xFF, 0x79, 0xE4, 0xAF, 0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A, 0xFC, 0x79, 0xEA, 0x94, 0x9F,
+    0xC5, 0x9F, 0xEA, 0x4F, 0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x39, 0xE7, 0x7A, 0x92, 0xEA, 0x76,
+    0x9E, 0x9A, 0xE7, 0x7A, 0xFE, 0x97, 0x79, 0xFD, 0x97, 0x71, 0x9A, 0xAA, 0x97, 0x20, 0x39, 0x99,
+    0x49, 0x92, 0x9F, 0xCA, 0x1A, 0xF9, 0x0F, 0xDA, 0x0F, 0xE0, 0x99, 0xAE, 0xAF, 0xF2, 0x9F, 0xD1,
+    0xF2, 0x9F, 0xC2, 0xEA, 0x2A, 0xF2, 0x9E, 0x92, 0xFA, 0x2A, 0xE9, 0x2F, 0x3F, 0x29, 0xEA, 0x3F,
+    0x2A, 0xE9, 0x29, 0xEA, 0x2F, 0x3A, 0xE9, 0x2F, 0x3F, 0x29, 0xEA, 0x3F, 0x2A, 0xE9, 0x29, 0xE9,
+    0x2F, 0x3A, 0xE7, 0x3F, 0x72, 0x9E, 0x96, 0xA2, 0xF6, 0xAD, 0x9A, 0xE9, 0x6F, 0xEA, 0x7F, 0xDA,
+    0x71, 0xAA, 0xCA, 0x96, 0x70, 0xFF, 0xA7, 0x2A, 0xFF, 0xA7, 0x29, 0xFF, 0x97, 0x77, 0x77, 0x76,
+    0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xFF, 0xF9, 0x59, 0xFD, 0xAA, 0xFD, 0x5F, 0xC9, 0x3A,
+    0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A, 0xF9, 0x1F, 0xC7, 0x9F, 0x90, 0x9F, 0x97, 0x9F, 0xA0,
+    0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x1F,
+    0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xFA, 0x5F, 0xC4, 0xFC, 0xA2, 0x9F,
+    0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x59, 0xFF,
+    0x6F, 0xFC, 0x95, 0xAF, 0xF7, 0x77, 0x77, 0x09, 0x99, 0x71, 0x9F, 0xE6, 0xAF, 0xFC, 0x4A, 0xF9,
+    0xAF, 0x92, 0x9E, 0xA2, 0xAF, 0x2F, 0x39, 0xF1, 0x9E, 0xA4, 0xF1, 0xAE, 0x94, 0xF1, 0xF4, 0x9E,
+    0xA1, 0xF4, 0xAE, 0x91, 0xF4, 0xF2, 0xF3, 0x9E, 0xA2, 0xF9, 0x19, 0xF3, 0xAF, 0xAA, 0xF5, 0xFF,
+    0xC7, 0xAF, 0xCA, 0x72, 0x99, 0x70, 0x71, 0x95, 0x97, 0x3D, 0x4A, 0xA7, 0x29, 0xE9, 0x09, 0xD9,
+    0x73, 0xFF, 0x74, 0x9F, 0xCA, 0x77, 0x99, 0x97, 0x77, 0x75, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9,
+    0x70, 0xFF, 0xF9, 0x59, 0xFD, 0xAA, 0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9,
+    0x6A, 0xF9, 0x1F, 0xC7, 0x9F, 0x90, 0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70,
+    0x9F, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9,
+    0x1F, 0xC7, 0xFC, 0x2A, 0xFA, 0x5F, 0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF,
+    0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x69, 0x97, 0x49, 0xD4, 0xC9, 0x5A, 0xDA, 0x1A,
+    0xD6, 0x9F, 0xE9, 0x7A, 0xFC, 0x97, 0x29, 0x97, 0x77, 0x49, 0x99, 0x71, 0x9F, 0xE6, 0xAF, 0xFC,
+    0x4A, 0xF9, 0xAF, 0x92, 0x9E, 0xA2, 0xAF, 0x2F, 0x39, 0xF1, 0x9E, 0xA4, 0xF1, 0xAE, 0x94, 0xF1,
+    0xF4, 0x9E, 0xA1, 0xF4, 0xAE, 0x91, 0xF4, 0xF2, 0xF3, 0x9E, 0xA2, 0xF9, 0x19, 0xF3, 0xAF, 0xAA,
+    0xF5, 0xFF, 0xC7, 0xAF, 0xCA, 0x72, 0x99, 0x70, 0x77, 0x77, 0x19, 0xC9, 0x3A, 0xC7, 0x3A, 0xE2,
+    0xEA, 0x71, 0xFC, 0x09, 0xF9, 0x79, 0xFA, 0x0A, 0xF9, 0x70, 0xEA, 0x19, 0xE9, 0x72, 0xC9, 0x4A,
+    0x97, 0x77, 0x74, 0x9A, 0xAA, 0x97, 0x59, 0xFF, 0xC9, 0x71, 0xFF, 0xF9, 0x69, 0xFD, 0xAA, 0xFD,
+    0x6F, 0xC9, 0x3A, 0xFA, 0x4F, 0xC6, 0xFC, 0x3A, 0xF9, 0x6A, 0xF9, 0x2F, 0xC7, 0x9F, 0x91, 0x9F,
+    0x97, 0x9F, 0xA1, 0xAF, 0x70, 0x9F, 0x91, 0xFC, 0x70, 0x9F, 0x91, 0xFC, 0x70, 0xAF, 0x91, 0xFC,
+    0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0xA2, 0xFC, 0x7A, 0xF9, 0x2F, 0xC7, 0xFC, 0x3A, 0xFA, 0x5F, 0xC5,
+    0xFC, 0xA2, 0x9F, 0xC9, 0x5A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x72, 0x9A, 0xFD, 0xA9, 0x77, 0x97,
+    0x40, 0x77, 0x71, 0xAA, 0x29, 0xA7, 0x1D, 0xA1, 0xE7, 0xEA, 0x0E, 0xA6, 0xAD, 0xA0, 0xAE, 0x69,
+    0xDA, 0x09, 0xE7, 0xDA, 0x1A, 0xCA, 0x71, 0x93, 0x97, 0x77, 0x49, 0x99, 0x72, 0x9F, 0xE7, 0xAF,
+    0xFC, 0x5A, 0xF9, 0xAF, 0x93, 0x9E, 0xA2, 0xAF, 0x3F, 0x39, 0xF2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94,
+    0xF2, 0xF4, 0x9E, 0xA2, 0xF4, 0xAE, 0x92, 0xF4, 0xF3, 0xF3, 0x9E, 0xA3, 0xF9, 0x19, 0xF4, 0xAF,
+    0xAA, 0xF6, 0xFF, 0xC7, 0x0A, 0xFC, 0xA7, 0x39, 0x97, 0x10, 0x72, 0x99, 0x99, 0x77, 0x5A, 0xFF,
+    0xFF, 0xEA, 0x5A, 0xFF, 0xFF, 0xFC, 0xA4, 0xAF, 0xDA, 0x9A, 0xAF, 0xAA, 0xAA, 0xAE, 0x93, 0xFC,
+    0xA4, 0x9F, 0x4A, 0xD3, 0xAF, 0x95, 0xAE, 0xA4, 0xAD, 0x29, 0xF9, 0x6F, 0x94, 0xAC, 0x92, 0xFC,
+    0x7F, 0x72, 0x9F, 0x97, 0xF7, 0x2A, 0xF7, 0x9F, 0x99, 0x9A, 0xAA, 0x4F, 0xA7, 0xAF, 0xFD, 0x4F,
+    0x97, 0xFF, 0xDA, 0x4F, 0x97, 0xF9, 0x72, 0xF9, 0x69, 0xF7, 0x3F, 0xA6, 0x9E, 0xA7, 0x3F, 0xC6,
+    0xAE, 0x95, 0xD9, 0x2A, 0xFA, 0x5F, 0x5A, 0xD9, 0x3F, 0xCA, 0x39, 0xF5, 0xE4, 0xAF, 0xFF, 0xDA,
+    0xAA, 0xFD, 0x5A, 0xFF, 0xFF, 0xFC, 0xA7, 0xAF, 0xFF, 0xFE, 0x73, 0x99, 0x97, 0x71, 0x79, 0x99,
+    0x69, 0x99, 0x79, 0xFD, 0x92, 0xAF, 0xC9, 0x4A, 0xFF, 0x99, 0xFF, 0x3A, 0xF9, 0xAF, 0xE9, 0x0F,
+    0x29, 0xEA, 0x2A, 0xFC, 0x2A, 0xE2, 0xF3, 0x9F, 0x92, 0xEA, 0x19, 0xEA, 0x4F, 0x2A, 0xE2, 0xAE,
+    0x94, 0xEA, 0x1F, 0x3F, 0x49, 0xEA, 0xAE, 0xA4, 0xF4, 0xAF, 0xE9, 0x5F, 0x4F, 0xCA, 0x70, 0xF3,
+    0x9F, 0x94, 0xAC, 0x2F, 0x91, 0x9F, 0xD2, 0x9E, 0x2A, 0xFA, 0xAF, 0xFF, 0xCA, 0x3F, 0xFA, 0x9F,
+    0xF9, 0x5F, 0xD9, 0x19, 0xFC, 0xA7, 0x19, 0x70, 0x97, 0x77, 0x77, 0x39, 0xC7, 0x71, 0xAD, 0x97,
+    0x69, 0xF9, 0x75, 0xFD, 0x75, 0xFA, 0x97, 0x69, 0xA9, 0x77, 0x77, 0x49, 0x9A, 0xAA, 0xA9, 0x72,
+    0xAF, 0xFE, 0x96, 0xFF, 0xFD, 0x95, 0xCA, 0xAF, 0x90, 0x9F, 0xC7, 0x0F, 0x29, 0xF9, 0x69, 0xF3,
+    0xF9, 0x69, 0xEA, 0x3F, 0x96, 0xAE, 0xA3, 0xF7, 0xF9, 0x2A, 0xF7, 0xF2, 0x9F, 0x79, 0xFA, 0xAF,
+    0xC7, 0x0A, 0xFF, 0xCA, 0x71, 0xFF, 0xC7, 0x3F, 0x99, 0xEA, 0x72, 0xF1, 0xF9, 0x70, 0x9F, 0x19,
+    0xF7, 0x0A, 0xEA, 0x2F, 0xC7, 0xF9, 0x29, 0xFC, 0x59, 0xFA, 0x92, 0xAF, 0xC2, 0x9F, 0xF9, 0x2F,
+    0xD9, 0x0F, 0xFC, 0x4A, 0xF7, 0x71, 0x92, 0x73, 0x97, 0x4A, 0xCA, 0x72, 0x9E, 0x72, 0xF7, 0x1A,
+    0xE7, 0x2E, 0x73, 0xD7, 0x49, 0x77, 0x70, 0x99, 0x39, 0x92, 0x9F, 0xCA, 0x1F, 0x1F, 0xDA, 0x0F,
+    0xC1, 0x99, 0x9E, 0x9A, 0xFC, 0x4E, 0x9E, 0xAC, 0x93, 0x9F, 0xC9, 0x7A, 0xFA, 0x70, 0xAF, 0x71,
+    0xFA, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97,
+    0x00, 0x79, 0x9A, 0xAA, 0xA9, 0x72, 0xAF, 0xFE, 0x96, 0xFF, 0xFD, 0x95, 0xCA, 0xAF, 0x90, 0x9F,
+    0xC7, 0x0F, 0x29, 0xF9, 0x69, 0xF3, 0xF9, 0x69, 0xEA, 0x3F, 0x96, 0xAE, 0xA3, 0xF7, 0xF9, 0x2A,
+    0xF7, 0xF2, 0x9F, 0x79, 0xFA, 0xAF, 0xC7, 0x0A, 0xFF, 0xCA, 0x71, 0xFF, 0xC7, 0x3F, 0x99, 0xEA,
+    0x72, 0xF1, 0xF9, 0x70, 0x9F, 0x19, 0xF7, 0x0A, 0xEA, 0x2F, 0xC7, 0xF9, 0x29, 0xFC, 0x59, 0xFA,
+    0x92, 0xAF, 0xC2, 0x9F, 0xF9, 0x2F, 0xD9, 0x0F, 0xFC, 0x4A, 0xF7, 0x71, 0x97, 0x4A, 0xA7, 0x71,
+    0xEA, 0x77, 0x0E, 0xA7, 0x70, 0xE9, 0x77, 0x0D, 0xA7, 0x79, 0xE7, 0x70, 0x9A, 0x97, 0x20, 0x59,
+    0x93, 0x99, 0x39, 0xFC, 0xA1, 0xF2, 0xFD, 0xA0, 0xFC, 0x29, 0x99, 0xE9, 0xAF, 0xC5, 0xE9, 0xEA,
+    0xC9, 0x49, 0xFC, 0x97, 0x0A, 0xFA, 0x71, 0xAF, 0x72, 0xFA, 0x72, 0xF7, 0x29, 0xEA, 0x72, 0xAE,
+    0x97, 0x2F, 0x73, 0xF7, 0x29, 0xEA, 0x72, 0xAE, 0x97, 0x77, 0x39, 0x97, 0x4E, 0x97, 0x3A, 0xD9,
+    0x73, 0xAD, 0x74, 0xDA, 0x73, 0xDA, 0x74, 0xA7, 0x50, 0x77, 0x74, 0x9C, 0x94, 0xDA, 0x71, 0xAD,
+    0x29, 0xE9, 0x71, 0x9E, 0x09, 0xE7, 0x4A, 0xFD, 0x76, 0xFC, 0x77, 0x0D, 0xA7, 0x77, 0x73, 0x99,
+    0xAA, 0xAA, 0x97, 0x2A, 0xFF, 0xE9, 0x6F, 0xFF, 0xD9, 0x5C, 0xAA, 0xF9, 0x09, 0xFC, 0x70, 0xF2,
+    0x9F, 0x96, 0x9F, 0x3F, 0x96, 0x9E, 0xA3, 0xF9, 0x6A, 0xEA, 0x3F, 0x7F, 0x92, 0xAF, 0x7F, 0x29,
+    0xF7, 0x9F, 0xAA, 0xFC, 0x70, 0xAF, 0xFC, 0xA7, 0x1F, 0xFC, 0x73, 0xF9, 0x9E, 0xA7, 0x2F, 0x1F,
+    0x97, 0x09, 0xF1, 0x9F, 0x70, 0xAE, 0xA2, 0xFC, 0x7F, 0x92, 0x9F, 0xC5, 0x9F, 0xA9, 0x2A, 0xFC,
+    0x29, 0xFF, 0x92, 0xFD, 0x90, 0xFF, 0xC4, 0xAF, 0x77, 0x19, 0x20, 0x77, 0x39, 0xCA, 0x3D, 0xA4,
+    0xAD, 0x2E, 0x59, 0xDA, 0x0E, 0x7F, 0xD7, 0x09, 0xF9, 0x71, 0xE9, 0x73, 0x97, 0x77, 0x19, 0x93,
+    0x99, 0x29, 0xFC, 0xA1, 0xF1, 0xFD, 0xA0, 0xFC, 0x19, 0x99, 0xE9, 0xAF, 0xC4, 0xE9, 0xEA, 0xC9,
+    0x39, 0xFC, 0x97, 0xAF, 0xA7, 0x0A, 0xF7, 0x1F, 0xA7, 0x1F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71,
+    0xF7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x70, 0x77, 0x76, 0xC9, 0x74, 0xAE, 0x73, 0xFC, 0x71,
+    0xAF, 0xC9, 0x70, 0x9F, 0x97, 0x3A, 0x97, 0x77, 0x69, 0xAA, 0xA9, 0x97, 0x09, 0xFF, 0xA5, 0xAF,
+    0xFD, 0x93, 0xAF, 0x99, 0x9A, 0xE9, 0x3F, 0x4E, 0x39, 0xF4, 0xE3, 0x9F, 0x4D, 0x93, 0x9F, 0xA7,
+    0x3F, 0xD7, 0x2A, 0xFD, 0xA7, 0x1A, 0xFE, 0x71, 0xAF, 0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC3, 0xD9,
+    0x4A, 0xF2, 0x9D, 0x94, 0x9F, 0x2A, 0xDA, 0x49, 0xF2, 0xF9, 0x3F, 0xA2, 0xFD, 0xAF, 0xD3, 0xAF,
+    0xFE, 0x6A, 0xFE, 0x97, 0x39, 0x70, 0x73, 0xA7, 0x49, 0xD7, 0x3E, 0x97, 0x1A, 0xE7, 0x19, 0xE9,
+    0x71, 0xE9, 0x72, 0xD7, 0x77, 0x77, 0x19, 0x99, 0x70, 0x9F, 0xDA, 0x59, 0xFF, 0x49, 0xE9, 0x99,
+    0xE4, 0xAE, 0x3A, 0x94, 0xF9, 0x71, 0xAF, 0xA7, 0x1F, 0xD7, 0x1F, 0xD7, 0x1A, 0xFA, 0x71, 0xAF,
+    0x39, 0xD3, 0xF3, 0xF2, 0xF3, 0xFC, 0xAA, 0xE9, 0x3A, 0xFF, 0xA5, 0x9F, 0xD9, 0x72, 0x97, 0x77,
+    0x72, 0x9D, 0xA7, 0x4F, 0xA7, 0x19, 0xFD, 0x97, 0x9E, 0x99, 0xE6, 0xAE, 0x91, 0x9D, 0x95, 0x9C,
+    0xA4, 0xAA, 0x77, 0x71, 0x9A, 0xAA, 0x99, 0x70, 0x9F, 0xFA, 0x5A, 0xFF, 0xD9, 0x3A, 0xF9, 0x99,
+    0xAE, 0x93, 0xF4, 0xE3, 0x9F, 0x4E, 0x39, 0xF4, 0xD9, 0x39, 0xFA, 0x73, 0xFD, 0x72, 0xAF, 0xDA,
+    0x71, 0xAF, 0xE7, 0x1A, 0xFE, 0x72, 0xFD, 0xA7, 0x2A, 0xFC, 0x3D, 0x94, 0xAF, 0x29, 0xD9, 0x49,
+    0xF2, 0xAD, 0xA4, 0x9F, 0x2F, 0x93, 0xFA, 0x2F, 0xDA, 0xFD, 0x3A, 0xFF, 0xE6, 0xAF, 0xE9, 0x73,
+    0x97, 0x00, 0x70, 0xAA, 0xA7, 0x2A, 0xE9, 0x70, 0xAF, 0xC7, 0x9D, 0xAA, 0xD9, 0x6E, 0x1E, 0x5E,
+    0x29, 0xD5, 0x9A, 0x4A, 0x77, 0x70, 0x99, 0x97, 0x09, 0xFD, 0xA5, 0x9F, 0xF4, 0x9E, 0x99, 0x9E,
+    0x4A, 0xE3, 0xA9, 0x4F, 0x97, 0x1A, 0xFA, 0x71, 0xFD, 0x71, 0xFD, 0x71, 0xAF, 0xA7, 0x1A, 0xF3,
+    0x9D, 0x3F, 0x3F, 0x2F, 0x3F, 0xCA, 0xAE, 0x93, 0xAF, 0xFA, 0x59, 0xFD, 0x97, 0x29, 0x70, 0x79,
+    0xAA, 0xA9, 0x97, 0x09, 0xFF, 0xA5, 0xAF, 0xFD, 0x93, 0xAF, 0x99, 0x9A, 0xE9, 0x3F, 0x4E, 0x39,
+    0xF4, 0xE3, 0x9F, 0x4D, 0x93, 0x9F, 0xA7, 0x3F, 0xD7, 0x2A, 0xFD, 0xA7, 0x1A, 0xFE, 0x71, 0xAF,
+    0xE7, 0x2F, 0xDA, 0x72, 0xAF, 0xC3, 0xD9, 0x4A, 0xF2, 0x9D, 0x94, 0x9F, 0x2A, 0xDA, 0x49, 0xF2,
+    0xF9, 0x3F, 0xA2, 0xFD, 0xAF, 0xD3, 0xAF, 0xFE, 0x6A, 0xFE, 0x97, 0x39, 0x76, 0xAA, 0xA7, 0x4A,
+    0xF7, 0x49, 0xE7, 0x5D, 0xA7, 0x4E, 0x73, 0xAE, 0x74, 0x9A, 0x97, 0x10, 0x79, 0x99, 0x79, 0xFD,
+    0xA4, 0x9F, 0xF3, 0x9E, 0x99, 0x9E, 0x3A, 0xE3, 0xA9, 0x3F, 0x97, 0x0A, 0xFA, 0x70, 0xFD, 0x70,
+    0xFD, 0x70, 0xAF, 0xA7, 0x0A, 0xF2, 0x9D, 0x3F, 0x2F, 0x2F, 0x2F, 0xCA, 0xAE, 0x92, 0xAF, 0xFA,
+    0x49, 0xFD, 0x97, 0x19, 0x72, 0x9A, 0xA7, 0x2F, 0x71, 0x9A, 0xD7, 0x2A, 0xD7, 0x1A, 0xD9, 0x79,
+    0xE9, 0x71, 0xA9, 0x70, 0x77, 0x70, 0xCA, 0x4A, 0xD6, 0x9D, 0xA2, 0xEA, 0x7E, 0x90, 0xE9, 0x70,
+    0x9F, 0xD9, 0x72, 0x9F, 0x97, 0x4A, 0xD7, 0x77, 0x79, 0xAA, 0xA9, 0x97, 0x19, 0xFF, 0xA6, 0xAF,
+    0xFD, 0x94, 0xAF, 0x99, 0x9A, 0xE9, 0x4F, 0x4E, 0x49, 0xF4, 0xE4, 0x9F, 0x4D, 0x94, 0x9F, 0xA7,
+    0x4F, 0xD7, 0x3A, 0xFD, 0xA7, 0x2A, 0xFE, 0x72, 0xAF, 0xE7, 0x3F, 0xDA, 0x73, 0xAF, 0xC4, 0xD9,
+    0x4A, 0xF3, 0x9D, 0x94, 0x9F, 0x3A, 0xDA, 0x49, 0xF3, 0xF9, 0x3F, 0xA3, 0xFD, 0xAF, 0xD4, 0xAF,
+    0xFE, 0x7A, 0xFE, 0x97, 0x49, 0x71, 0x77, 0x5D, 0x3A, 0xD5, 0x9D, 0x91, 0xE7, 0xE0, 0xAD, 0x97,
+    0xAF, 0xC9, 0x71, 0xFA, 0x72, 0x9E, 0x75, 0x97, 0x77, 0x59, 0x99, 0x71, 0x9F, 0xDA, 0x69, 0xFF,
+    0x59, 0xE9, 0x99, 0xE5, 0xAE, 0x3A, 0x95, 0xF9, 0x72, 0xAF, 0xA7, 0x2F, 0xD7, 0x2F, 0xD7, 0x2A,
+    0xFA, 0x72, 0xAF, 0x49, 0xD3, 0xF4, 0xF2, 0xF4, 0xFC, 0xAA, 0xE9, 0x4A, 0xFF, 0xA6, 0x9F, 0xD9,
+    0x73, 0x97, 0x00, 0x77, 0x5F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x1A, 0xFA, 0xAF, 0xAA, 0xAF,
+    0x1E, 0x29, 0xF2, 0x9E, 0x1E, 0x2A, 0xF2, 0x9D, 0x91, 0xDA, 0x2A, 0xEA, 0x2A, 0xD2, 0x9A, 0x3F,
+    0x92, 0x9A, 0x71, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F, 0x76,
+    0xAE, 0xA7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xFA, 0x97, 0x2F, 0xFC, 0x97, 0x1F, 0xFC, 0x77, 0x77,
+    0x0A, 0xAA, 0x77, 0x9F, 0x77, 0x9E, 0x77, 0x0D, 0xA7, 0x7E, 0x76, 0xAE, 0x97, 0x69, 0xA9, 0x76,
+    0x5A, 0xD7, 0x0E, 0xA7, 0x9E, 0xA7, 0xAE, 0x95, 0x9A, 0xFF, 0x1F, 0xFE, 0x1A, 0xAA, 0xFA, 0xAA,
+    0x93, 0xAE, 0x97, 0xF9, 0x7F, 0x70, 0xF7, 0x9E, 0xA7, 0xAE, 0x97, 0xF7, 0x0F, 0x29, 0xC3, 0xF9,
+    0x9A, 0xD9, 0x2F, 0xFC, 0x3F, 0xF4, 0x9F, 0xC9, 0x70, 0x97, 0x19, 0xA9, 0x70, 0x9E, 0xA7, 0x09,
+    0xE7, 0x1D, 0xA7, 0x0E, 0x79, 0xE7, 0x09, 0xA9, 0x70, 0x77, 0x72, 0xCA, 0x4A, 0xCA, 0x70, 0x9D,
+    0x92, 0xEA, 0x71, 0xE9, 0x0E, 0x97, 0x29, 0xFD, 0x97, 0x4A, 0xF7, 0x7A, 0xD7, 0x77, 0x77, 0x71,
+    0xFF, 0xFF, 0xC9, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xAA, 0xFA, 0xAA, 0xF1, 0xE2, 0x9F, 0x29, 0xE1,
+    0xE2, 0xAF, 0x29, 0xD9, 0x1D, 0xA2, 0xAE, 0xA2, 0xAD, 0x29, 0xA3, 0xF9, 0x29, 0xA7, 0x1F, 0x76,
+    0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xFA, 0x76,
+    0xF9, 0x75, 0xAF, 0xA9, 0x72, 0xFF, 0xC9, 0x71, 0xFF, 0xC7, 0x00, 0x77, 0x71, 0xAC, 0xA7, 0x3E,
+    0x73, 0xDA, 0x72, 0x9D, 0x7A, 0xD0, 0xAC, 0xA6, 0xEA, 0x0D, 0x69, 0xEA, 0x71, 0xAE, 0x97, 0x9A,
+    0xFF, 0x3F, 0xFE, 0x3A, 0xAA, 0xFA, 0xAA, 0x95, 0xAE, 0x97, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0x19,
+    0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF2, 0x9C, 0x5F, 0x99, 0xAD, 0x94, 0xFF, 0xC5, 0xFF, 0x69,
+    0xFC, 0x97, 0x29, 0x70, 0x77, 0x5F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x1A, 0xFA, 0xAF, 0xAA,
+    0xAF, 0x1E, 0x29, 0xF2, 0x9E, 0x1E, 0x2A, 0xF2, 0x9D, 0x91, 0xDA, 0x2A, 0xEA, 0x2A, 0xD2, 0x9A,
+    0x3F, 0x92, 0x9A, 0x71, 0xF7, 0x69, 0xF7, 0x3A, 0xFF, 0xD7, 0x0F, 0xFE, 0x73, 0xF9, 0x76, 0xF7,
+    0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xFA, 0x76, 0xF9, 0x75, 0xAF, 0xA9, 0x72, 0xFF, 0xC9, 0x71, 0xFF,
+    0xC7, 0x00, 0x5A, 0xD7, 0x0E, 0xA7, 0x9E, 0xA7, 0xAE, 0x95, 0x9A, 0xFF, 0x1F, 0xFE, 0x1A, 0xAA,
+    0xFA, 0xAA, 0x93, 0xAE, 0x97, 0xF9, 0x7F, 0x5A, 0xFF, 0xC9, 0x1A, 0xFF, 0xC4, 0xAE, 0x97, 0xF7,
+    0x0F, 0x29, 0xC3, 0xF9, 0x9A, 0xD9, 0x2F, 0xFC, 0x3F, 0xF4, 0x9F, 0xC9, 0x70, 0x96, 0x71, 0x97,
+    0x72, 0x9E, 0xA1, 0xD7, 0x4F, 0xCA, 0xE7, 0x3A, 0xD9, 0xFC, 0xA7, 0x39, 0xC9, 0x1E, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x0F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9, 0x39,
+    0xF7, 0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7,
+    0xEA, 0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA,
+    0x49, 0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF, 0xFC, 0xA7, 0x0F,
+    0xFE, 0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x69, 0xAA, 0x92, 0x97, 0x09, 0xF1, 0xD9, 0x7F,
+    0xFC, 0x97, 0xD1, 0xFA, 0x70, 0x99, 0x19, 0xAC, 0x97, 0x77, 0x77, 0x39, 0x97, 0x99, 0x29, 0xFC,
+    0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99, 0xAE, 0x92, 0x9E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5,
+    0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4, 0xAE, 0x3F, 0x94, 0xF2, 0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9,
+    0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD, 0x9E, 0x9D, 0x1A, 0xFE, 0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC,
+    0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x7F, 0xFC, 0x73, 0x9F, 0xFC, 0x73, 0x9F, 0xF9, 0x77, 0x77, 0x77,
+    0x77, 0x7F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9, 0x39, 0xF7, 0xF4,
+    0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x4A,
+    0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x49, 0xF6,
+    0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF, 0xFC, 0xA7, 0x0F, 0xFE, 0x97,
+    0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x5A, 0xFE, 0xA7, 0x0F, 0xFC, 0x70, 0xFF, 0xA7, 0x77, 0x77,
+    0x29, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99, 0xAE, 0x92, 0x9E, 0xA4, 0x9E,
+    0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4, 0xAE, 0x3F, 0x94, 0xF2, 0x9F,
+    0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD, 0x9E, 0x9D, 0x1A, 0xFE, 0x0A,
+    0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x70, 0x95, 0x97, 0x4D, 0x93, 0x9C,
+    0x74, 0xE9, 0x09, 0xDA, 0x74, 0xFF, 0x76, 0xFC, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x77, 0x5F, 0xFC,
+    0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9, 0x39, 0xF7, 0xF4, 0xAF, 0x69, 0xEA,
+    0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x4A, 0xF6, 0x9E, 0x94,
+    0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x49, 0xF6, 0xAE, 0x59, 0xF9,
+    0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF, 0xFC, 0xA7, 0x0F, 0xFE, 0x97, 0x2A, 0xFE, 0xA7,
+    0x79, 0x97, 0x50, 0x69, 0x59, 0x70, 0xDA, 0x39, 0xC7, 0x0E, 0x90, 0x9A, 0xD7, 0x0A, 0xFE, 0x72,
+    0xAF, 0xC7, 0x59, 0x97, 0x77, 0x49, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99,
+    0xAE, 0x92, 0x9E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4,
+    0xAE, 0x3F, 0x94, 0xF2, 0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD,
+    0x9E, 0x9D, 0x1A, 0xFE, 0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x72,
+    0x99, 0x97, 0x71, 0xFC, 0x77, 0xDA, 0x9E, 0x75, 0x9D, 0x2D, 0x75, 0x9D, 0x19, 0xD7, 0x6D, 0xAA,
+    0xDA, 0x76, 0xAF, 0xA7, 0x71, 0x99, 0x77, 0x77, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0xA2, 0xFF, 0x91,
+    0x9F, 0xA5, 0x9F, 0x93, 0x9F, 0x7F, 0x4A, 0xF6, 0x9E, 0xA4, 0xAE, 0xA6, 0xAE, 0x94, 0xF9, 0x6A,
+    0xE5, 0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0xAF, 0x69, 0xE9, 0x4F, 0xA6, 0xAE, 0x94, 0xF9, 0x6A, 0xE5,
+    0xF7, 0xF4, 0x9F, 0x7E, 0xA4, 0x9F, 0x6A, 0xE5, 0x9F, 0x94, 0x9F, 0x59, 0xFC, 0x91, 0x9A, 0xF9,
+    0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72, 0xAF, 0xEA, 0x77, 0x99, 0x75, 0x77, 0x71, 0x9F, 0x73,
+    0x9D, 0xAE, 0x72, 0xD9, 0x1D, 0x72, 0xD2, 0xD7, 0x2D, 0x19, 0xD7, 0x2F, 0xD9, 0x73, 0xAE, 0x97,
+    0x77, 0x29, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99, 0xAE, 0x92, 0x9E, 0xA4,
+    0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4, 0xAE, 0x3F, 0x94, 0xF2,
+    0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD, 0x9E, 0x9D, 0x1A, 0xFE,
+    0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x74, 0x77, 0x77, 0x09, 0xCA, 0x3A,
+    0xC9, 0x72, 0x9E, 0x2A, 0xE7, 0x1A, 0xF1, 0xFA, 0x70, 0xFA, 0x09, 0xF9, 0x70, 0xEA, 0x2E, 0xA7,
+    0x2A, 0xA4, 0xC9, 0x77, 0x77, 0x77, 0x2F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA,
+    0x59, 0xF9, 0x39, 0xF7, 0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F,
+    0x7F, 0x49, 0xF7, 0xEA, 0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F,
+    0x49, 0xF7, 0xEA, 0x49, 0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF,
+    0xFC, 0xA7, 0x0F, 0xFE, 0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x77, 0x72, 0xC9, 0x2A, 0xA7,
+    0x1A, 0xD9, 0x09, 0xD9, 0x70, 0xE9, 0x0E, 0x97, 0xE9, 0x0E, 0xA7, 0xAD, 0x90, 0xAD, 0xA7, 0x0D,
+    0x91, 0xD9, 0x71, 0x93, 0x99, 0x77, 0x72, 0x99, 0x79, 0x92, 0x9F, 0xC9, 0x3F, 0x2F, 0xDA, 0x3F,
+    0x29, 0x9A, 0xE9, 0x29, 0xEA, 0x49, 0xE3, 0xAE, 0x94, 0xAE, 0x3F, 0x5F, 0x3F, 0x49, 0xE9, 0x29,
+    0xEA, 0x4A, 0xE3, 0xF9, 0x4F, 0x29, 0xF5, 0xEA, 0x2F, 0xC4, 0x9E, 0x91, 0xAF, 0xC1, 0x91, 0xAE,
+    0x1A, 0xD9, 0xE9, 0xD1, 0xAF, 0xE0, 0xAF, 0xD1, 0xAF, 0xD1, 0x9F, 0xC3, 0xFA, 0x3E, 0xA6, 0x97,
+    0x40, 0x77, 0x6F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9, 0x39, 0xF7,
+    0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA,
+    0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x49,
+    0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x7F, 0xFF, 0xC9, 0x79, 0xFF, 0xE9,
+    0x72, 0xAF, 0xEA, 0x77, 0x9D, 0xA7, 0x71, 0xDA, 0x77, 0x1A, 0xD7, 0x72, 0xE9, 0x77, 0x1F, 0xD7,
+    0x70, 0xAE, 0xA7, 0x77, 0x70, 0x39, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2, 0x99,
+    0xAE, 0x92, 0x9E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E, 0xA4,
+    0xAE, 0x3F, 0x94, 0xF2, 0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1, 0xAD,
+    0x9E, 0x9D, 0x1A, 0xFE, 0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xF6, 0x96, 0xD7, 0x6A,
+    0xC9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0x9F, 0xC7, 0x4A, 0xE9, 0x77, 0x30, 0x77, 0x77, 0x73, 0xAD,
+    0x77, 0x70, 0xAF, 0x77, 0x6A, 0xFD, 0x77, 0x4A, 0xE0, 0xEA, 0x77, 0x2E, 0xA2, 0xE7, 0x72, 0xAC,
+    0x94, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xFF, 0x92, 0x9D, 0x39, 0xFE, 0x9F, 0xFA, 0x3E, 0x39,
+    0xFE, 0x19, 0xFA, 0x49, 0xE9, 0x4A, 0xEA, 0x3F, 0xA4, 0xF9, 0x4F, 0x4F, 0xA3, 0x9F, 0x93, 0x9E,
+    0x5A, 0xEA, 0x3F, 0xC9, 0x3E, 0xA5, 0xAE, 0xA2, 0x9F, 0xC9, 0x29, 0xE6, 0xAE, 0xA2, 0xFD, 0xA2,
+    0xEA, 0x69, 0xEA, 0x19, 0xDA, 0xEA, 0x19, 0xE7, 0x9E, 0xA1, 0xE0, 0xEA, 0x1E, 0xA7, 0x0E, 0xA0,
+    0x9D, 0xA0, 0xAD, 0xA0, 0x9E, 0x71, 0xF0, 0xE1, 0xAD, 0xA0, 0xEA, 0x71, 0xF9, 0xDA, 0x1A, 0xE9,
+    0xE7, 0x2F, 0xAD, 0x91, 0x9F, 0xDA, 0x72, 0xFE, 0x29, 0xFD, 0x73, 0xAF, 0xC9, 0x29, 0xFC, 0xA7,
+    0x3A, 0xFC, 0x39, 0xFC, 0x74, 0xAF, 0x94, 0xF9, 0x74, 0x9F, 0x5F, 0x75, 0x9E, 0x95, 0xE9, 0x77,
+    0x77, 0x70, 0x72, 0x9A, 0xA7, 0x71, 0x9E, 0xA7, 0x70, 0xFC, 0x97, 0x6E, 0x9E, 0x75, 0xE1, 0xAD,
+    0x74, 0xE9, 0x2D, 0x97, 0x39, 0xA4, 0x99, 0x77, 0x76, 0x99, 0x59, 0x94, 0x99, 0x2A, 0xF2, 0x9E,
+    0x92, 0xF0, 0xAF, 0xCA, 0x2F, 0x2A, 0xE9, 0x99, 0xAF, 0x2A, 0xE2, 0x9E, 0xA2, 0xF2, 0x9E, 0x92,
+    0xE9, 0x29, 0xE9, 0x19, 0xEA, 0x2E, 0x4E, 0x91, 0xAE, 0xA1, 0x9E, 0x4E, 0xA1, 0xFC, 0x1A, 0xD9,
+    0x4E, 0xA0, 0x9F, 0xC1, 0xE5, 0xAD, 0xA0, 0xFD, 0x09, 0xDA, 0x5A, 0xE9, 0xD9, 0xE0, 0xE6, 0x9F,
+    0xCA, 0x0E, 0xAD, 0x96, 0x9F, 0xC1, 0xFC, 0xA7, 0x9F, 0x91, 0xFC, 0x70, 0x9E, 0x92, 0xF7, 0x2D,
+    0xA3, 0xAD, 0x77, 0x74, 0x77, 0x76, 0x9D, 0xA7, 0x70, 0xF9, 0x75, 0x9F, 0xD9, 0x73, 0x9E, 0x99,
+    0xE7, 0x2A, 0xE9, 0x19, 0xD9, 0x71, 0x9C, 0xA4, 0xAA, 0x77, 0x77, 0x77, 0xFF, 0x91, 0xFF, 0x1F,
+    0xF2, 0xFE, 0x92, 0xFC, 0x5A, 0xEA, 0x49, 0xF5, 0xEA, 0x6F, 0x93, 0xF7, 0xAE, 0xA2, 0x9E, 0x71,
+    0xF2, 0xE9, 0x71, 0xF9, 0x0E, 0xA7, 0x2A, 0xEA, 0xAE, 0x74, 0xFE, 0x75, 0xFD, 0x97, 0x59, 0xFA,
+    0x77, 0xF7, 0x79, 0xF7, 0x7A, 0xEA, 0x77, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0xA9, 0x73, 0xFF, 0xC9,
+    0x72, 0xFF, 0xC7, 0x10, 0x74, 0xAA, 0xA7, 0x7F, 0x97, 0x5A, 0xFC, 0x74, 0x9D, 0xAA, 0xD9, 0x72,
+    0x9E, 0x1D, 0xA7, 0x2E, 0x29, 0xD7, 0x29, 0xA4, 0xA7, 0x77, 0x69, 0x95, 0x99, 0x7A, 0xF9, 0x2F,
+    0x94, 0x9F, 0xD2, 0xAE, 0xA4, 0x99, 0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x19, 0xE9,
+    0x70, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71, 0xAE, 0x09, 0xE7, 0x2A,
+    0xE0, 0xE9, 0x72, 0x9E, 0x9D, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74, 0x9F, 0xA7, 0x59, 0xF7,
+    0x6F, 0x76, 0x9E, 0x71, 0xA3, 0x9E, 0x97, 0x0A, 0xDA, 0xAF, 0x97, 0x1F, 0xF7, 0x3F, 0xDA, 0x75,
+    0xAD, 0xA7, 0x50, 0x7A, 0xA2, 0x9A, 0xA7, 0x3E, 0xA0, 0x9E, 0x97, 0x19, 0xEA, 0x0F, 0x97, 0x19,
+    0xE1, 0xAD, 0xA7, 0x49, 0x39, 0x77, 0x77, 0x77, 0x1F, 0xF9, 0x1F, 0xF1, 0xFF, 0x2F, 0xE9, 0x2F,
+    0xC5, 0xAE, 0xA4, 0x9F, 0x5E, 0xA6, 0xF9, 0x3F, 0x7A, 0xEA, 0x29, 0xE7, 0x1F, 0x2E, 0x97, 0x1F,
+    0x90, 0xEA, 0x72, 0xAE, 0xAA, 0xE7, 0x4F, 0xE7, 0x5F, 0xD9, 0x75, 0x9F, 0xA7, 0x7F, 0x77, 0x9F,
+    0x77, 0xAE, 0xA7, 0x7F, 0xA7, 0x7F, 0x97, 0x6A, 0xFA, 0x97, 0x3F, 0xFC, 0x97, 0x2F, 0xFC, 0x71,
+    0x77, 0x77, 0x0A, 0xA7, 0x69, 0xE7, 0x5A, 0xF7, 0x39, 0xFC, 0x97, 0x3F, 0xA7, 0x5A, 0x97, 0x77,
+    0x77, 0x71, 0xFF, 0xFD, 0x4F, 0xFF, 0xD9, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0xC9, 0x2A, 0xDA, 0x4A,
+    0xFA, 0x3A, 0xD4, 0x9F, 0xA4, 0x9D, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A,
+    0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x49, 0xA9, 0x4A, 0xF9, 0x4E, 0x3A,
+    0xFA, 0x49, 0xE2, 0x9F, 0xA5, 0xF2, 0xFC, 0xAA, 0xAA, 0xFD, 0x92, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC,
+    0xA7, 0x75, 0x73, 0x97, 0x4A, 0xD7, 0x29, 0xE7, 0x2F, 0x71, 0xAE, 0x72, 0xE7, 0x3D, 0x77, 0x77,
+    0x69, 0x94, 0x99, 0x39, 0xFC, 0x90, 0x9E, 0x2F, 0xFF, 0x19, 0xFF, 0xE9, 0x19, 0xD9, 0x19, 0xF9,
+    0x29, 0xD3, 0xE9, 0x49, 0x92, 0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA,
+    0x3A, 0xC9, 0x2F, 0xA9, 0x90, 0x9E, 0x1F, 0xFF, 0xC0, 0x9E, 0xAF, 0xF9, 0x1E, 0x19, 0xFC, 0xA7,
+    0x39, 0x30, 0x73, 0x97, 0x7A, 0xDA, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x59, 0xE7, 0x77, 0x77, 0x77,
+    0x72, 0xFF, 0xFD, 0x4F, 0xFF, 0xD9, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0xC9, 0x2A, 0xDA, 0x4A, 0xFA,
+    0x3A, 0xD4, 0x9F, 0xA4, 0x9D, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA,
+    0x73, 0x9F, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x49, 0xA9, 0x4A, 0xF9, 0x4E, 0x3A, 0xFA,
+    0x49, 0xE2, 0x9F, 0xA5, 0xF2, 0xFC, 0xAA, 0xAA, 0xFD, 0x92, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC, 0xA7,
+    0x75, 0x70, 0xAA, 0x73, 0xEA, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x72, 0xAA, 0x97, 0x77, 0x76, 0x99,
+    0x49, 0x93, 0x9F, 0xC9, 0x09, 0xE2, 0xFF, 0xF1, 0x9F, 0xFE, 0x91, 0x9D, 0x91, 0x9F, 0x92, 0x9D,
+    0x3E, 0x94, 0x99, 0x2E, 0x97, 0x1E, 0x97, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA3, 0xAC,
+    0x92, 0xFA, 0x99, 0x09, 0xE1, 0xFF, 0xFC, 0x09, 0xEA, 0xFF, 0x91, 0xE1, 0x9F, 0xCA, 0x73, 0x93,
+    0x77, 0x71, 0xAC, 0x49, 0xD7, 0x0D, 0xA2, 0xAD, 0xA7, 0x0E, 0xA0, 0xEA, 0x72, 0xFD, 0x97, 0x39,
+    0xF9, 0x75, 0x9D, 0x97, 0x77, 0x77, 0x7F, 0xFF, 0xD4, 0xFF, 0xFD, 0x92, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xFC, 0x92, 0xAD, 0xA4, 0xAF, 0xA3, 0xAD, 0x49, 0xFA, 0x49, 0xD3, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC4, 0x9A,
+    0x94, 0xAF, 0x94, 0xE3, 0xAF, 0xA4, 0x9E, 0x29, 0xFA, 0x5F, 0x2F, 0xCA, 0xAA, 0xAF, 0xD9, 0x2F,
+    0xFF, 0xE3, 0xAF, 0xFF, 0xCA, 0x77, 0x50, 0x77, 0x39, 0xCA, 0x3D, 0xA4, 0xAD, 0x2E, 0x59, 0xDA,
+    0x0E, 0x7F, 0xD7, 0x09, 0xF9, 0x71, 0xAD, 0xA7, 0x39, 0x77, 0x71, 0x99, 0x49, 0x93, 0x9F, 0xC9,
+    0x09, 0xE2, 0xFF, 0xF1, 0x9F, 0xFE, 0x91, 0x9D, 0x91, 0x9F, 0x92, 0x9D, 0x3E, 0x94, 0x99, 0x2E,
+    0x97, 0x1E, 0x97, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA3, 0xAC, 0x92, 0xFA, 0x99, 0x09,
+    0xE1, 0xFF, 0xFC, 0x09, 0xEA, 0xFF, 0x91, 0xE1, 0x9F, 0xCA, 0x73, 0x93, 0x77, 0xAA, 0xA9, 0x77,
+    0xAF, 0xD7, 0x5F, 0xFA, 0x73, 0xAE, 0x1A, 0xD9, 0x73, 0xEA, 0x2A, 0x97, 0x3A, 0xE9, 0x77, 0x0F,
+    0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x09,
+    0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x09, 0xE9, 0x77, 0x0A,
+    0xE9, 0x77, 0x0F, 0x77, 0x1F, 0x77, 0x09, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x74, 0xA3, 0xEA,
+    0x73, 0xAD, 0x90, 0xAE, 0x74, 0xFF, 0xA7, 0x4F, 0xEA, 0x76, 0xAE, 0xA7, 0x60, 0x77, 0x3A, 0xD9,
+    0x77, 0x3E, 0xA7, 0x72, 0x9E, 0xA7, 0x19, 0xAA, 0xA9, 0x3A, 0xE7, 0x9F, 0xFC, 0x9A, 0xE9, 0x6F,
+    0xFF, 0xE6, 0x9F, 0xDA, 0xAF, 0xDA, 0x7F, 0xC9, 0x3A, 0xFA, 0x6F, 0xC6, 0xFC, 0x5A, 0xF9, 0x6A,
+    0xF9, 0x4F, 0xC7, 0x9F, 0x93, 0x9F, 0x97, 0x9F, 0xA3, 0xAF, 0x70, 0x9F, 0x93, 0xFC, 0x70, 0x9F,
+    0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFC, 0x7A, 0xF9, 0x4F,
+    0xC7, 0xFC, 0x5A, 0xFA, 0x5F, 0xC7, 0xFC, 0xA2, 0x9F, 0xC9, 0x7A, 0xFF, 0xFC, 0x97, 0x1A, 0xFF,
+    0xE7, 0x49, 0xAF, 0xDA, 0x97, 0x71, 0x97, 0x60, 0x76, 0x99, 0x76, 0xAD, 0xA7, 0x5A, 0xDA, 0x79,
+    0x99, 0x2E, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94, 0x9E, 0xA2, 0xAF, 0x4F,
+    0x39, 0xF3, 0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4, 0xAE, 0x93, 0xF4, 0xF4,
+    0xF3, 0x9E, 0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC, 0xA7, 0x49, 0x97,
+    0x20, 0x69, 0xAA, 0xAA, 0xA9, 0x97, 0x9F, 0xFF, 0xA4, 0xFF, 0xFF, 0x2A, 0xEA, 0x9F, 0x9A, 0xFC,
+    0xA1, 0xE9, 0x09, 0xF2, 0xFC, 0x1A, 0xD1, 0xAE, 0xA2, 0x9F, 0x29, 0x91, 0xF9, 0x29, 0xF6, 0xF3,
+    0x9F, 0x59, 0xF3, 0xAE, 0xA5, 0x9F, 0x29, 0xF9, 0x5A, 0xEA, 0x1A, 0xFA, 0x6F, 0xFE, 0x97, 0xFF,
+    0xCA, 0x70, 0x9F, 0xAA, 0x99, 0x72, 0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x76, 0xF7, 0x59, 0xAF, 0xA9,
+    0x72, 0xFF, 0xCA, 0x71, 0xFF, 0xC9, 0x70, 0x73, 0x9A, 0xAA, 0x97, 0x4F, 0xDA, 0x72, 0xFF, 0x71,
+    0xEA, 0x1D, 0xA7, 0x09, 0xE3, 0x97, 0x1E, 0xA7, 0x6E, 0x76, 0x9E, 0x29, 0x99, 0x70, 0xAD, 0xA0,
+    0x9F, 0xA7, 0xE9, 0x9F, 0xD9, 0x6E, 0x9F, 0xEA, 0x59, 0xFC, 0x90, 0x9E, 0xA5, 0xAF, 0x91, 0x9E,
+    0xA5, 0xFC, 0x29, 0xEA, 0x5F, 0x39, 0xEA, 0x49, 0xEA, 0x3A, 0xE9, 0x4A, 0xE9, 0x3F, 0x5F, 0x39,
+    0xEA, 0x5F, 0x3F, 0x6E, 0xA2, 0xAE, 0xA5, 0x9F, 0xCA, 0xFA, 0x6A, 0xFF, 0xCA, 0x7F, 0xAF, 0x97,
+    0x0E, 0xA1, 0x97, 0x29, 0xEA, 0x75, 0xAE, 0x97, 0x5F, 0x75, 0xAF, 0xCA, 0xA7, 0x1F, 0xFC, 0x71,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x00, 0x5A, 0xD7, 0x0E, 0xA7, 0x9E, 0xA7, 0xAE, 0x95, 0x9A, 0xFF,
+    0x1F, 0xFE, 0x1A, 0xAA, 0xFA, 0xAA, 0x93, 0xAE, 0x97, 0xF9, 0x7F, 0x70, 0xF7, 0x9E, 0xA7, 0xAE,
+    0x97, 0xF7, 0x0F, 0x2C, 0xA3, 0xF9, 0x9E, 0x3F, 0xFC, 0x3F, 0xFA, 0x39, 0xFE, 0x97, 0x0E, 0x71,
+    0xE7, 0x09, 0xD9, 0x4D, 0x1E, 0x4F, 0xE9, 0x4A, 0xFC, 0x96, 0xAD, 0xA6, 0x77, 0x69, 0xAF, 0xFF,
+    0xE1, 0xAF, 0xFF, 0xFA, 0x0A, 0xFC, 0xAF, 0xCA, 0xAF, 0x90, 0xF2, 0xFA, 0x2E, 0x90, 0xEA, 0x2F,
+    0x92, 0xE1, 0xAD, 0xA2, 0xF3, 0xDA, 0x29, 0x99, 0x19, 0xF3, 0xA9, 0x70, 0xAE, 0xA7, 0x6F, 0xA7,
+    0x6F, 0x97, 0x59, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x75, 0x9F, 0x76, 0xAF,
+    0x75, 0x9F, 0xC9, 0x72, 0x9F, 0xFC, 0x71, 0xAF, 0xFA, 0x70, 0x70, 0x9A, 0xAA, 0x97, 0x9F, 0xDA,
+    0x6F, 0xF5, 0xEA, 0x09, 0xD9, 0x4A, 0xE3, 0x95, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x79, 0xAF,
+    0xF3, 0xFF, 0xE3, 0xAA, 0xAF, 0xAA, 0xA9, 0x5A, 0xE9, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0x71, 0x9E,
+    0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x29, 0xC5, 0xF9, 0x9A, 0xD9, 0x4F, 0xFC, 0x5F, 0xF6, 0x9F,
+    0xC9, 0x72, 0x97, 0x00, 0x77, 0x5F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x1A, 0xFA, 0xAF, 0xAA,
+    0xAF, 0x1E, 0x29, 0xF2, 0x9E, 0x1E, 0x2A, 0xF2, 0x9D, 0x91, 0xDA, 0x2A, 0xEA, 0x2A, 0xD2, 0x9A,
+    0x3F, 0x92, 0x9A, 0x71, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F,
+    0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x6F, 0x97, 0x59, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x76, 0xAE, 0xA1,
+    0x97, 0x3A, 0xEA, 0x1C, 0xA7, 0x2A, 0xFA, 0xE7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x59, 0xAA, 0xA9,
+    0x70, 0x77, 0x49, 0xAC, 0xA7, 0x75, 0xAE, 0x77, 0x5F, 0x77, 0x39, 0xF9, 0x1F, 0xFC, 0x2F, 0xFD,
+    0x92, 0xFF, 0xA2, 0xFF, 0xA5, 0x9F, 0xA5, 0x9F, 0x70, 0x9F, 0x7F, 0x70, 0xAF, 0x69, 0xEA, 0x70,
+    0xAE, 0xA6, 0xAE, 0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7, 0xEA, 0x70, 0xAF, 0x69,
+    0xE9, 0x70, 0xFA, 0x6A, 0xE9, 0x70, 0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70, 0x9F, 0x7E, 0xA7, 0x09,
+    0xF6, 0xAE, 0x71, 0x9F, 0x94, 0x9F, 0x71, 0x9F, 0xC9, 0x19, 0xAF, 0x97, 0x2F, 0xFF, 0xCA, 0x74,
+    0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x77, 0x19, 0x97, 0x71, 0xE7, 0x71, 0xE4,
+    0x99, 0x79, 0xAE, 0x91, 0x9F, 0xC9, 0x3A, 0xFC, 0x92, 0xFD, 0xA3, 0xF5, 0x99, 0xAE, 0x92, 0x9E,
+    0xA7, 0x9E, 0x3A, 0xE9, 0x7A, 0xE3, 0xF7, 0x0E, 0xA3, 0xF7, 0x9E, 0x92, 0x9E, 0xA7, 0xAE, 0x3F,
+    0x97, 0xF2, 0x9F, 0x70, 0xEA, 0x2F, 0xC7, 0x9E, 0x91, 0xAF, 0xC1, 0x94, 0xAE, 0x1A, 0xD9, 0xE9,
+    0xD4, 0xAF, 0xE0, 0xAF, 0xD4, 0xAF, 0xD1, 0x9F, 0xC6, 0xFA, 0x3E, 0xA7, 0x19, 0x77, 0x70, 0xC9,
+    0x3E, 0x3F, 0x2A, 0xEA, 0x29, 0xE3, 0x9D, 0x94, 0xA0, 0x29, 0x93, 0xD9, 0x1A, 0xDA, 0x09, 0xE9,
+    0x0E, 0xA0, 0xAD, 0xA1, 0xAC, 0x97, 0x00, 0x49, 0xAA, 0x6A, 0xEA, 0x49, 0xFC, 0x4E, 0xAD, 0xA2,
+    0xE1, 0xE1, 0xE3, 0xD1, 0x9A, 0x49, 0x90, 0x1A, 0xAA, 0x2A, 0x1F, 0xA0, 0x9D, 0xAF, 0xFE, 0x90,
+    0xAF, 0x1A, 0x2A, 0xCA, 0x10, 0x0F, 0xF9, 0xAF, 0xF9, 0xAF, 0xF0, 0x19, 0x69, 0xD4, 0xCA, 0xAE,
+    0x90, 0x9D, 0x99, 0xFE, 0xA1, 0x9F, 0xCA, 0x49, 0x99, 0x30, 0x19, 0xA9, 0x1A, 0xE1, 0xF1, 0xEA,
+    0x1A, 0xCA, 0x10, 0x72, 0xAD, 0x19, 0xDA, 0xAE, 0x1F, 0xF1, 0xE9, 0x9C, 0xA2, 0xAC, 0x90, 0x39,
+    0x93, 0x9F, 0xC9, 0x1E, 0xAE, 0x09, 0xD1, 0xE1, 0x99, 0x1D, 0xA3, 0x9D, 0xA3, 0xE9, 0x4D, 0x95,
+    0x9A, 0x40, 0x71, 0xFA, 0x1F, 0xD9, 0x9C, 0xA1, 0xAC, 0xAA, 0xC9, 0x19, 0xCA, 0xAC, 0xA1, 0xD9,
+    0x9F, 0xD1, 0x9E, 0xA7, 0x10, 0x76, 0x9C, 0x3C, 0x4E, 0x1E, 0x2A, 0xDA, 0x0A, 0xE1, 0x9E, 0x09,
+    0xE2, 0xE1, 0xE2, 0xAD, 0x19, 0xD4, 0x93, 0xA4, 0x73, 0xD3, 0xAD, 0x1D, 0x91, 0xAD, 0x91, 0xE0,
+    0xAD, 0x92, 0x9F, 0xCA, 0x4F, 0xA5, 0x9E, 0x70, 0x95, 0x1A, 0x2A, 0x2D, 0x1D, 0xA0, 0x9D, 0x90,
+    0xE1, 0xE0, 0xAD, 0x19, 0xD1, 0xDA, 0x1D, 0x90, 0x9C, 0xA2, 0xA2, 0xA0, 0x39, 0xA9, 0x4A, 0xFC,
+    0xA1, 0xFF, 0x0A, 0xD9, 0x1E, 0x9A, 0xA4, 0xD7, 0x91, 0x3A, 0x91, 0x9D, 0x2D, 0x91, 0xE1, 0x9D,
+    0xA1, 0xAD, 0xA1, 0xAE, 0x2D, 0xA1, 0x29, 0x93, 0xF2, 0x9E, 0x92, 0xE2, 0x9E, 0x2A, 0xD2, 0x9D,
+    0xA2, 0xDA, 0x71, 0x29, 0x91, 0x9E, 0x90, 0xEA, 0x09, 0xE1, 0x9D, 0xA2, 0xDA, 0x2E, 0x3D, 0x96,
+    0x1A, 0xC9, 0x1E, 0x09, 0xDA, 0x0A, 0xD1, 0xDA, 0x1D, 0x2C, 0xA6, 0x29, 0x92, 0xE9, 0x1E, 0x91,
+    0xE1, 0xE9, 0x09, 0xD9, 0x19, 0xA3, 0x19, 0xA9, 0x1A, 0xE1, 0xF1, 0xEA, 0x19, 0xA9, 0x10, 0x19,
+    0x49, 0x1E, 0x1A, 0xDA, 0xAE, 0x1F, 0xF1, 0xE9, 0x0A, 0x92, 0x9A, 0x10, 0x29, 0xA9, 0x3F, 0xA1,
+    0xD9, 0x0D, 0x1D, 0x1A, 0xC1, 0xD1, 0xD1, 0xAF, 0x92, 0x9A, 0x92, 0x2A, 0x91, 0x9E, 0x2E, 0x2E,
+    0x19, 0xD1, 0x9D, 0x91, 0x99, 0x30, 0x29, 0xA9, 0x29, 0xEA, 0x29, 0xE3, 0xDA, 0x2E, 0x19, 0xE2,
+    0x9A, 0x92, 0x29, 0x92, 0xCA, 0x2D, 0x2A, 0xCA, 0x2D, 0xA2, 0xFC, 0xA9, 0xF6, 0x19, 0x99, 0x09,
+    0xDA, 0x0A, 0xDA, 0x0E, 0x90, 0xE0, 0x9E, 0x0A, 0xDA, 0x09, 0x99, 0x10, 0x77, 0xE9, 0x5F, 0xC4,
+    0xFE, 0x2E, 0x90, 0xAD, 0x90, 0xE9, 0x2D, 0xA0, 0x99, 0x59, 0x00, 0x72, 0xAA, 0x59, 0x9D, 0x92,
+    0x9C, 0x9A, 0xEA, 0xAE, 0x1F, 0xE9, 0x2A, 0xEA, 0x74, 0x19, 0x99, 0x29, 0x1A, 0xE9, 0x1D, 0x9F,
+    0xCA, 0xFC, 0xA0, 0xFC, 0x99, 0xC2, 0xE9, 0x72, 0x0F, 0xF9, 0xAF, 0xF9, 0x9F, 0xF0, 0x39, 0x99,
+    0x4A, 0xFC, 0xA1, 0xAF, 0xE9, 0x9D, 0x91, 0xAD, 0xAA, 0xA4, 0xD7, 0x91, 0x77, 0x2D, 0x96, 0xAD,
+    0xA5, 0x9E, 0x6E, 0x95, 0xE7, 0xAC, 0x77, 0xAD, 0x91, 0xE0, 0x9E, 0xA0, 0xF0, 0x9E, 0x1E, 0xA1,
+    0x9A, 0x3A, 0x91, 0x0D, 0xA1, 0x9D, 0x91, 0xAD, 0x91, 0xAF, 0x09, 0xE9, 0x60, 0x75, 0x9A, 0x97,
+    0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F,
+    0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72,
+    0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99,
+    0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE,
+    0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x79, 0x9A, 0xAA, 0xA9, 0x70, 0xAF, 0xFD, 0xA5,
+    0xFF, 0xFD, 0x4C, 0xAA, 0xF9, 0x0A, 0xFA, 0x6F, 0x29, 0xF5, 0x9F, 0x3F, 0x59, 0xEA, 0x3E, 0xA5,
+    0xAE, 0x92, 0x9E, 0x95, 0xF9, 0x2F, 0x6F, 0xCA, 0xAF, 0x69, 0xFF, 0xDA, 0x6A, 0xFF, 0xEA, 0x5F,
+    0x92, 0xFC, 0x94, 0xF4, 0xFA, 0x4F, 0x4A, 0xEA, 0x39, 0xF4, 0xAE, 0xA3, 0xAE, 0xA4, 0xF4, 0xF9,
+    0x3A, 0xEA, 0x39, 0xFA, 0xAA, 0xAF, 0xC2, 0x9F, 0xFF, 0xCA, 0x3F, 0xFF, 0xA7, 0x77, 0x77, 0x70,
+    0xFF, 0xFD, 0xA4, 0xFF, 0xFD, 0xA5, 0x9F, 0xCA, 0xAA, 0xF9, 0x6F, 0x93, 0xE6, 0x9F, 0x4E, 0x69,
+    0xF4, 0xDA, 0x6A, 0xEA, 0x4D, 0x7F, 0x97, 0x6F, 0x76, 0x9F, 0x76, 0xAF, 0x76, 0xFA, 0x76, 0xF9,
+    0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x59, 0xFC, 0x99, 0x71, 0x9F, 0xFC, 0x71, 0xFF,
+    0xD7, 0x00, 0x74, 0x9A, 0x97, 0x6A, 0xEA, 0x75, 0x9F, 0xC7, 0x5F, 0xD7, 0x4A, 0xFD, 0x74, 0xE9,
+    0xE9, 0x72, 0xE9, 0x9E, 0xA7, 0x19, 0xE1, 0xF7, 0x1E, 0x91, 0xF7, 0x0A, 0xE2, 0xF7, 0x0E, 0x92,
+    0xAE, 0x96, 0xAD, 0xA3, 0x9E, 0xA5, 0x9E, 0x49, 0xF5, 0xEA, 0x5F, 0x4A, 0xE6, 0xF4, 0xEA, 0x6F,
+    0x92, 0xAE, 0x7A, 0xEA, 0x19, 0xEA, 0x7A, 0xF1, 0xFD, 0xAA, 0xAA, 0xAA, 0xFD, 0x1F, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xFC, 0xA0, 0x77, 0x71, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7,
+    0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9,
+    0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97,
+    0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF,
+    0xE4, 0xFF, 0xFE, 0x93, 0x77, 0x6F, 0xFF, 0xD4, 0xFF, 0xFD, 0x92, 0x9E, 0xAA, 0xAA, 0xAA, 0xFC,
+    0x92, 0xAD, 0xA4, 0xAF, 0xA3, 0xAD, 0x49, 0xFA, 0x49, 0xD3, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7,
+    0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC4, 0x9A, 0x94,
+    0xAF, 0x94, 0xE3, 0xAF, 0xA4, 0x9E, 0x29, 0xFA, 0x5F, 0x2F, 0xCA, 0xAA, 0xAF, 0xD9, 0x2F, 0xFF,
+    0xE3, 0xAF, 0xFF, 0xCA, 0x77, 0x50, 0x77, 0x77, 0xFF, 0xC2, 0xFF, 0xC5, 0xFF, 0xC2, 0xFF, 0xA6,
+    0x9F, 0xA5, 0x9F, 0xA7, 0x1F, 0x96, 0xF7, 0x19, 0xF6, 0x9F, 0x71, 0x9F, 0x6A, 0xEA, 0x71, 0xAE,
+    0xA6, 0xFA, 0x71, 0xF9, 0x6F, 0x97, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x19, 0xFF, 0xFF, 0x71,
+    0xAF, 0xFF, 0xEA, 0x71, 0xFA, 0x6F, 0x97, 0x1F, 0x96, 0xF9, 0x71, 0xF6, 0x9F, 0x71, 0x9F, 0x6A,
+    0xF7, 0x1A, 0xF6, 0xAE, 0xA7, 0x1F, 0xA6, 0xF9, 0x70, 0x9F, 0xA9, 0x4A, 0xFA, 0x95, 0x9F, 0xFA,
+    0x1A, 0xFF, 0x94, 0xFF, 0xC9, 0x1F, 0xFC, 0x40, 0x71, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70,
+    0xFF, 0xF9, 0x59, 0xFC, 0xAA, 0xAF, 0xD5, 0xFC, 0x4A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF7, 0x9F,
+    0x91, 0xFA, 0x70, 0xF9, 0x09, 0xF7, 0x1F, 0xA0, 0xAF, 0x19, 0xAA, 0xAA, 0xAA, 0x0F, 0x90, 0xFA,
+    0x0A, 0xFD, 0xA0, 0xF9, 0x0F, 0xA0, 0xFE, 0x09, 0xF9, 0x0F, 0xA0, 0x96, 0xAF, 0x1F, 0xA7, 0x0F,
+    0xA1, 0xFA, 0x79, 0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xF9, 0x5A, 0xF4, 0xFC, 0x92, 0x9F, 0xC9, 0x4A,
+    0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x77, 0x3F, 0xFC, 0x94,
+    0xFF, 0xC6, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x71,
+    0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7,
+    0x09, 0xFC, 0x95, 0x9F, 0xFA, 0x4F, 0xFC, 0x93, 0x77, 0x74, 0xFF, 0xC1, 0xFE, 0xA4, 0xFF, 0xA1,
+    0xFE, 0x69, 0xFA, 0x4F, 0x97, 0x0F, 0x4F, 0x71, 0x9F, 0x29, 0xF7, 0x29, 0xF1, 0x9F, 0x73, 0xAE,
+    0xA0, 0x9E, 0xA7, 0x4F, 0x99, 0xEA, 0x75, 0xFA, 0xEA, 0x75, 0x9F, 0xEA, 0x76, 0xAF, 0xF7, 0x6F,
+    0xAF, 0xA7, 0x5F, 0x99, 0xF7, 0x5F, 0x1F, 0xC7, 0x39, 0xF2, 0xFA, 0x72, 0xAE, 0xA2, 0xAF, 0xA7,
+    0x1F, 0x93, 0xFC, 0xA7, 0x9F, 0xA9, 0x29, 0xFC, 0xA4, 0x9F, 0xF9, 0x29, 0xFD, 0x3F, 0xFC, 0x49,
+    0xFA, 0x77, 0x49, 0x40, 0x75, 0x9A, 0x97, 0x72, 0xEA, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC7, 0x70,
+    0xFD, 0x97, 0x6A, 0xDA, 0xE9, 0x76, 0xE0, 0xEA, 0x75, 0xE9, 0x0F, 0x74, 0x9E, 0x1F, 0x74, 0xE9,
+    0x1A, 0xE9, 0x72, 0xAE, 0x2A, 0xE9, 0x72, 0xE9, 0x29, 0xEA, 0x71, 0xAE, 0x39, 0xF7, 0x09, 0xE9,
+    0x4F, 0x70, 0xEA, 0x5F, 0x79, 0xE6, 0xF9, 0x6E, 0xA6, 0xAE, 0xA5, 0xAE, 0x7A, 0xF4, 0x9F, 0x7F,
+    0xCA, 0x19, 0xFE, 0x93, 0xFF, 0xC0, 0xAF, 0xE9, 0x29, 0xFF, 0xC0, 0x77, 0x77, 0x1F, 0xE9, 0x59,
+    0xFD, 0xA5, 0xFE, 0xA5, 0xFE, 0x7A, 0xFC, 0xA4, 0xAF, 0xC9, 0x70, 0xAF, 0xCA, 0x4F, 0xD7, 0x1F,
+    0xE3, 0xAF, 0xD7, 0x09, 0xFE, 0x3E, 0xAE, 0x70, 0xAD, 0x9A, 0xE2, 0xAD, 0x9F, 0x70, 0xE0, 0xAE,
+    0x2D, 0xA0, 0xF7, 0x0E, 0x09, 0xE9, 0x0E, 0x1F, 0x7A, 0xDA, 0x1E, 0xA9, 0xDA, 0x1F, 0x7E, 0x91,
+    0xEA, 0xE2, 0xEA, 0x7E, 0x2F, 0xDA, 0x19, 0xEA, 0x69, 0xDA, 0x2A, 0xFC, 0x29, 0xEA, 0x6E, 0x92,
+    0xAF, 0x92, 0x9E, 0xA6, 0xE3, 0x9F, 0x3A, 0xEA, 0x59, 0xE4, 0xE9, 0x3A, 0xE9, 0x5A, 0xDA, 0x4E,
+    0x4A, 0xE9, 0x49, 0xEA, 0x49, 0x94, 0x9F, 0xC9, 0x2F, 0xE9, 0x79, 0xFF, 0x90, 0xAF, 0xE7, 0x0A,
+    0xFF, 0x10, 0x77, 0x74, 0xFD, 0xA4, 0x9F, 0xEA, 0x3F, 0xE4, 0x9F, 0xE9, 0x49, 0xFC, 0xA5, 0xAE,
+    0x97, 0xFD, 0x59, 0xE7, 0x0F, 0xDA, 0x4A, 0xDA, 0x79, 0xFE, 0x4E, 0x97, 0xAF, 0xE9, 0x3E, 0x70,
+    0xEA, 0xFC, 0x29, 0xE7, 0x0E, 0x99, 0xF9, 0x1A, 0xE7, 0x9E, 0x1F, 0xA1, 0xAD, 0xA7, 0xAE, 0x19,
+    0xF1, 0xE9, 0x7A, 0xDA, 0x2F, 0xA0, 0xE7, 0x0E, 0x92, 0xAF, 0x9E, 0x70, 0xE4, 0xFF, 0x79, 0xE4,
+    0xAF, 0xDA, 0x7A, 0xE5, 0xFD, 0x97, 0xEA, 0x5A, 0xFC, 0x79, 0xEA, 0x94, 0x9F, 0xC5, 0x9F, 0xEA,
+    0x4F, 0xA5, 0xAF, 0xE9, 0x49, 0xE9, 0x77, 0x49, 0x70, 0x77, 0x79, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF,
+    0xDA, 0x3A, 0xFF, 0xFD, 0x93, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xD9, 0x70, 0xD9, 0x59, 0x71, 0x97,
+    0x77, 0x5A, 0xAA, 0xAA, 0xAA, 0xA9, 0x71, 0xFF, 0xC7, 0x2F, 0xFC, 0x72, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x74, 0x99, 0x71, 0x99, 0x4D, 0xA7, 0x1D, 0x92, 0xAD, 0x97, 0x0A, 0xD9, 0x2E, 0x97, 0x0E,
+    0x92, 0xFF, 0xFF, 0x3F, 0xFF, 0xF2, 0x9F, 0xFF, 0xEA, 0x20, 0x71, 0x9A, 0xAA, 0x97, 0x49, 0xFF,
+    0xC9, 0x70, 0xFF, 0xF9, 0x59, 0xFD, 0xAA, 0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A,
+    0xF9, 0x6A, 0xF9, 0x1F, 0xC7, 0x9F, 0x90, 0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC,
+    0x70, 0x9F, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A,
+    0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xFA, 0x5F, 0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96,
+    0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76, 0x97, 0x30, 0x77, 0x76, 0xFF, 0xFF, 0xF9, 0x4F, 0xFF,
+    0xFF, 0x69, 0xFD, 0xAA, 0xAA, 0xFD, 0x71, 0xF9, 0x5F, 0x97, 0x09, 0xF6, 0xF7, 0x19, 0xF5, 0x9F,
+    0x71, 0xAE, 0xA5, 0xAF, 0x71, 0xF9, 0x5F, 0xA7, 0x1F, 0x95, 0xF9, 0x70, 0x9F, 0x6F, 0x71, 0xAF,
+    0x59, 0xF7, 0x1F, 0xA5, 0xAE, 0xA7, 0x1F, 0x95, 0xFA, 0x71, 0xF6, 0xF9, 0x70, 0x9F, 0x59, 0xF7,
+    0x1A, 0xF5, 0x9F, 0x71, 0xFA, 0x5A, 0xEA, 0x70, 0x9F, 0xA9, 0x39, 0xFC, 0x95, 0x9F, 0xFA, 0x09,
+    0xFF, 0xA4, 0xFF, 0xC9, 0x0A, 0xFF, 0x93, 0x79, 0x9A, 0xAA, 0xA9, 0x71, 0xAF, 0xFE, 0x95, 0xFF,
+    0xFD, 0x94, 0xDA, 0xFA, 0x9A, 0xFC, 0x7F, 0x2A, 0xF9, 0x59, 0xF3, 0xFA, 0x59, 0xF3, 0xFA, 0x5A,
+    0xEA, 0x3F, 0x95, 0xF9, 0x29, 0xF6, 0xF3, 0xFA, 0x59, 0xF1, 0x9F, 0xC6, 0xAF, 0xFD, 0xA7, 0xFF,
+    0xD9, 0x70, 0xFA, 0xAA, 0x97, 0x3F, 0x76, 0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x59, 0xFC, 0x97,
+    0x29, 0xFF, 0xC7, 0x1F, 0xFD, 0x70, 0x77, 0x69, 0xFF, 0xFC, 0xA3, 0xFF, 0xFD, 0x93, 0xFC, 0x99,
+    0x99, 0xAA, 0xE9, 0x39, 0xF9, 0x4A, 0xD5, 0xAF, 0x4A, 0xD6, 0xF9, 0x3A, 0xC9, 0x6A, 0xF7, 0x6F,
+    0xA7, 0x59, 0xF7, 0x6F, 0x97, 0x49, 0xEA, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0x9E, 0xA4, 0xD9,
+    0x49, 0xEA, 0x49, 0xDA, 0x39, 0xEA, 0x5E, 0x93, 0xF5, 0x9E, 0x3F, 0xFF, 0xE2, 0x9F, 0xFF, 0xDA,
+    0x3F, 0xFF, 0xD7, 0x76, 0x77, 0x5F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x1A, 0xFA, 0xAF, 0xAA,
+    0xAF, 0x1E, 0x29, 0xF2, 0x9E, 0x1E, 0x2A, 0xF2, 0x9D, 0x91, 0xDA, 0x2A, 0xEA, 0x2A, 0xD2, 0x9A,
+    0x3F, 0x92, 0x9A, 0x71, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F,
+    0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x6F, 0x97, 0x5A, 0xFA, 0x97, 0x2F, 0xFC, 0x97, 0x1F, 0xFC, 0x70,
+    0x29, 0xAA, 0x71, 0xAA, 0x29, 0xFA, 0x69, 0xF0, 0xAF, 0xD6, 0xFC, 0x0A, 0xAA, 0xF9, 0x4F, 0xC4,
+    0xFA, 0x3A, 0xF5, 0xAF, 0x3F, 0x7F, 0x2F, 0x70, 0xF9, 0x09, 0xE9, 0x70, 0x9E, 0x90, 0xEA, 0x72,
+    0xEA, 0x9E, 0x73, 0xEA, 0xE9, 0x73, 0xAF, 0xCA, 0x74, 0x9F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0x76,
+    0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0x97, 0x5A, 0xFA, 0x97, 0x2A, 0xFF, 0xA7, 0x1F, 0xFC, 0x70, 0x70,
+    0xFF, 0x97, 0x3A, 0xFF, 0x75, 0x9A, 0xF9, 0x77, 0xAE, 0x97, 0x59, 0xAF, 0xEA, 0x97, 0x9F, 0xFF,
+    0xD5, 0xAF, 0xAA, 0xFA, 0xFC, 0x3A, 0xF1, 0x9E, 0xA1, 0xFA, 0x19, 0xF2, 0xAE, 0x91, 0x9F, 0x1F,
+    0x92, 0xF3, 0xF1, 0xF3, 0xF3, 0xF1, 0xF2, 0x9E, 0xA2, 0x9F, 0x1F, 0x29, 0xE9, 0x2F, 0x91, 0xF9,
+    0x1A, 0xE2, 0xAF, 0x2A, 0xF9, 0x0F, 0x09, 0xFC, 0x4F, 0xFF, 0xEA, 0x69, 0xFF, 0xEA, 0x73, 0x9A,
+    0xEA, 0x77, 0x0F, 0x77, 0xAF, 0xE7, 0x4A, 0xFF, 0x97, 0x39, 0x99, 0x99, 0x99, 0x99, 0x70, 0x77,
+    0x74, 0xFF, 0x91, 0xFF, 0x4F, 0xF2, 0xFE, 0x95, 0xAF, 0xA4, 0xF9, 0x70, 0xFC, 0x3A, 0xE9, 0x71,
+    0x9F, 0x29, 0xE9, 0x73, 0xFA, 0x09, 0xE9, 0x74, 0x9F, 0x9E, 0xA7, 0x6F, 0xEA, 0x77, 0x9F, 0xCA,
+    0x77, 0x1F, 0xC7, 0x71, 0x9F, 0xC7, 0x71, 0xFD, 0xA7, 0x7E, 0xAF, 0x76, 0xEA, 0x0F, 0xA7, 0x4F,
+    0x19, 0xF7, 0x3F, 0x3F, 0xA7, 0x1A, 0xE4, 0x9F, 0x70, 0xAE, 0xA4, 0x9F, 0xA9, 0x4A, 0xFE, 0x91,
+    0xFF, 0xA3, 0xFF, 0x19, 0xFF, 0x92, 0x09, 0x97, 0x70, 0x99, 0x90, 0xF2, 0xAF, 0xEA, 0x19, 0xF0,
+    0x9E, 0xA1, 0xFF, 0x2F, 0x19, 0xEA, 0x29, 0xF9, 0x2A, 0xEA, 0x2E, 0xA3, 0xF3, 0xF3, 0xEA, 0x29,
+    0xEA, 0x29, 0xEA, 0x3E, 0xA2, 0xAE, 0x92, 0xAE, 0x93, 0xEA, 0x2F, 0x3F, 0x4E, 0xA2, 0xF2, 0x9E,
+    0xA4, 0xEA, 0x19, 0xF2, 0xAE, 0x5F, 0x19, 0xEA, 0x19, 0xEA, 0x5F, 0x90, 0xAE, 0x90, 0x9F, 0x6A,
+    0xFA, 0xFA, 0xFC, 0x70, 0xFF, 0xFD, 0x72, 0xAF, 0xFC, 0xA9, 0x76, 0xAE, 0xA7, 0x72, 0xAE, 0x97,
+    0x72, 0xF7, 0x72, 0xAF, 0xA9, 0x76, 0xAF, 0xF7, 0x6F, 0xFC, 0x73, 0x73, 0x99, 0xAA, 0xA9, 0x75,
+    0x9F, 0xFC, 0xA7, 0x2F, 0xFF, 0xC7, 0x9F, 0xCA, 0x99, 0xAF, 0xCA, 0x6F, 0xC5, 0xFC, 0x5F, 0xC6,
+    0x9F, 0x93, 0x9F, 0x97, 0xFA, 0x3A, 0xF7, 0x0F, 0xA3, 0xFA, 0x70, 0xF9, 0x3F, 0x97, 0x0F, 0x93,
+    0xF9, 0x79, 0xF4, 0xF9, 0x7A, 0xEA, 0x4F, 0x97, 0xF5, 0xAE, 0x96, 0xAE, 0x96, 0xEA, 0x59, 0xEA,
+    0x39, 0xCA, 0x0A, 0xE4, 0x9E, 0xA0, 0x9D, 0x0D, 0xA1, 0xE9, 0x29, 0xEA, 0x1A, 0xD0, 0xDA, 0x2E,
+    0x19, 0xE9, 0x2D, 0xA9, 0xFF, 0xC1, 0xAF, 0xFC, 0x9A, 0xFF, 0xA1, 0xAF, 0xFC, 0x0A, 0xFF, 0x2A,
+    0xFF, 0xC0, 0x69, 0x99, 0x39, 0x96, 0x9F, 0xC2, 0xDA, 0x4A, 0xFE, 0x09, 0xE3, 0xAF, 0xAE, 0x9E,
+    0xA2, 0x9F, 0x2F, 0xD3, 0xF3, 0xFC, 0xA2, 0x9E, 0xA3, 0xAF, 0x3A, 0xE4, 0x9E, 0x93, 0xF4, 0x9E,
+    0x4F, 0x4E, 0x94, 0xF3, 0xAE, 0x94, 0xF2, 0xAF, 0x94, 0xF9, 0x0A, 0xFD, 0x09, 0xC1, 0xAF, 0xF9,
+    0xAF, 0xC9, 0x1F, 0xE9, 0x09, 0xFA, 0x29, 0xFA, 0x3E, 0xA6, 0x96, 0x93, 0x71, 0x9A, 0xAA, 0x97,
+    0x1A, 0xFD, 0xA7, 0xAF, 0xF6, 0xAE, 0x90, 0x9E, 0xA5, 0xEA, 0x2E, 0xA4, 0xAE, 0x3E, 0xA4, 0xEA,
+    0x3E, 0x93, 0x9E, 0x92, 0x9E, 0x4A, 0xE3, 0xE9, 0x4A, 0xE2, 0xAE, 0x5F, 0x1A, 0xE6, 0xEA, 0x0A,
+    0xF9, 0x49, 0xE9, 0x09, 0xFC, 0x49, 0xE3, 0x9E, 0xA3, 0xAE, 0x4F, 0x3F, 0x4F, 0x3E, 0xA4, 0xF3,
+    0xEA, 0x4E, 0xA2, 0x9E, 0x93, 0x9E, 0x92, 0xAE, 0x93, 0xF3, 0xAF, 0xAA, 0xAF, 0x4F, 0xFE, 0x94,
+    0xFF, 0xCA, 0x59, 0xEA, 0x19, 0x70, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xF7, 0x4E, 0xA7, 0x39,
+    0xCA, 0x97, 0x40, 0x29, 0x95, 0x99, 0x2A, 0xF9, 0x2F, 0x99, 0xFD, 0x2F, 0xA9, 0xAA, 0xF2, 0x9F,
+    0x2F, 0x92, 0xEA, 0x2A, 0xE9, 0x19, 0xE9, 0x29, 0xEA, 0x19, 0xE4, 0xEA, 0x1A, 0xDA, 0x4E, 0xA1,
+    0xE5, 0xF0, 0xAD, 0xA5, 0xAE, 0x0E, 0x6A, 0xFD, 0x79, 0xFC, 0x97, 0x9F, 0xA7, 0x09, 0xF7, 0x2E,
+    0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xCA, 0x97,
+    0x00, 0x71, 0x9A, 0xA9, 0x72, 0xAF, 0xD7, 0x0F, 0xFA, 0x6A, 0xDA, 0x1A, 0xE6, 0xE9, 0x29, 0xD6,
+    0xEA, 0x3A, 0x7F, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x2A, 0xFC, 0xA7, 0xAF, 0xF9, 0x5A, 0xF9, 0x9F,
+    0x4A, 0xF2, 0xF9, 0x3F, 0x3A, 0xEA, 0x2A, 0xEA, 0x39, 0xEA, 0x2F, 0x49, 0xEA, 0x2F, 0x49, 0xEA,
+    0x2F, 0x4A, 0xE9, 0x2F, 0x4F, 0x3F, 0x92, 0xF9, 0x3A, 0xFA, 0xAF, 0xA5, 0xFF, 0xCA, 0x7A, 0xFC,
+    0xA9, 0x73, 0x97, 0x10, 0x69, 0x99, 0x97, 0xAF, 0xDA, 0x4F, 0xFC, 0x3F, 0xA9, 0x9A, 0xD3, 0xEA,
+    0x39, 0x93, 0xE9, 0x71, 0xF7, 0x19, 0xFD, 0x6A, 0xFC, 0xA5, 0xFA, 0x99, 0x5A, 0xE7, 0x1F, 0x71,
+    0xF4, 0xAC, 0x2F, 0xFE, 0x2A, 0xFF, 0xC9, 0x39, 0xFD, 0xA7, 0x09, 0x96, 0x3A, 0xC9, 0x71, 0xE9,
+    0x39, 0x92, 0xAE, 0x3E, 0x2A, 0xEA, 0x09, 0xF9, 0x2F, 0xFD, 0x4A, 0xFD, 0xA6, 0xAE, 0x70, 0x9E,
+    0x71, 0xE9, 0x70, 0xF7, 0x09, 0xE7, 0x1E, 0xA7, 0x09, 0xE7, 0x1F, 0x71, 0xEA, 0x70, 0xAE, 0x97,
+    0x0A, 0xE9, 0x70, 0xF9, 0x70, 0xAF, 0x70, 0xAF, 0xC9, 0x7F, 0xE9, 0x6F, 0xF6, 0xAF, 0xE7, 0xAF,
+    0xC9, 0x70, 0xAE, 0x97, 0x09, 0xE7, 0x0A, 0xEA, 0x5A, 0xFD, 0x6A, 0xFA, 0x70, 0xAA, 0x96, 0x39,
+    0x99, 0x49, 0x92, 0x9F, 0xCA, 0x1A, 0xF1, 0xFD, 0xA0, 0xFD, 0x90, 0x99, 0xAE, 0xAF, 0xE9, 0x29,
+    0xFC, 0xA0, 0xAE, 0x92, 0x9F, 0xA1, 0xAE, 0x92, 0xAF, 0x2F, 0x3F, 0xA2, 0xF3, 0xF3, 0xF2, 0x9E,
+    0xA2, 0x9E, 0xA2, 0xAE, 0x92, 0xAE, 0x92, 0xF3, 0xF3, 0xF3, 0xF2, 0x9E, 0xA3, 0xEA, 0x2A, 0xE9,
+    0x29, 0xE9, 0x2F, 0x3A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2F, 0x73, 0xF7, 0x2A, 0xEA,
+    0x72, 0xAC, 0xAA, 0x40, 0x79, 0xAA, 0xA7, 0x19, 0xFD, 0xA6, 0x9F, 0xFA, 0x49, 0xF9, 0x9F, 0x4E,
+    0xA2, 0xAE, 0x92, 0xF3, 0x9E, 0xA1, 0x9E, 0x94, 0xF1, 0xF5, 0xF1, 0xEA, 0x5F, 0x09, 0xE9, 0x5F,
+    0x0F, 0xCA, 0xAA, 0xAA, 0xFA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xD9, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5,
+    0xF0, 0x9E, 0xA4, 0x9E, 0x90, 0x9E, 0xA4, 0xF1, 0x9E, 0xA4, 0xEA, 0x2F, 0x3F, 0x3F, 0x91, 0xAE,
+    0x93, 0x9F, 0xAF, 0xA5, 0xFF, 0x97, 0xAF, 0xA7, 0x76, 0x49, 0x93, 0xF2, 0xAE, 0xA2, 0xF9, 0x2F,
+    0x3F, 0x29, 0xEA, 0x2A, 0xE9, 0x2F, 0x3F, 0x3E, 0xA2, 0x9E, 0x92, 0xAE, 0x90, 0xC9, 0xFE, 0x9F,
+    0xDA, 0x09, 0xF9, 0x39, 0x40, 0x49, 0x96, 0x99, 0x19, 0xFC, 0xA3, 0xAF, 0x0F, 0xDA, 0x2A, 0xFC,
+    0x09, 0x9A, 0xE9, 0x1A, 0xFC, 0xA2, 0x9E, 0x1A, 0xE9, 0x59, 0xE0, 0x9E, 0x96, 0xAD, 0xA0, 0xF7,
+    0xE9, 0xAF, 0x7E, 0x9F, 0xA6, 0x9F, 0xC9, 0xD9, 0x6A, 0xF9, 0x9D, 0x96, 0xFA, 0x09, 0xDA, 0x6F,
+    0x1A, 0xE1, 0xAC, 0x19, 0xE9, 0x19, 0xFE, 0x1A, 0xE3, 0xFD, 0x2E, 0x93, 0xAE, 0xA7, 0x59, 0x40,
+    0x69, 0xAA, 0x97, 0x39, 0xFD, 0x72, 0xFE, 0xA7, 0x19, 0x99, 0xAF, 0x75, 0xAE, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x5E, 0xA7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xFC, 0x73, 0x9F, 0xC7, 0x3F, 0xD7, 0x2A,
+    0xDA, 0xE7, 0x2E, 0x0E, 0x71, 0xE9, 0x0E, 0x70, 0xAE, 0x1E, 0x79, 0xE9, 0x1E, 0x96, 0xF2, 0xE9,
+    0x5F, 0x92, 0xEA, 0x9A, 0xA1, 0xFA, 0x3F, 0xDA, 0x0F, 0xC4, 0xFD, 0x2E, 0x94, 0x9E, 0xA4, 0x97,
+    0x09, 0x30, 0x69, 0x99, 0x59, 0x96, 0x9E, 0x93, 0xEA, 0x6F, 0x3A, 0xE9, 0x6F, 0x3F, 0x69, 0xEA,
+    0x3F, 0x69, 0xE9, 0x3E, 0xA6, 0xAE, 0x39, 0xE9, 0x6F, 0x3A, 0xE7, 0xF3, 0xAE, 0x7E, 0xA3, 0xF6,
+    0x9E, 0xA2, 0x9E, 0xA6, 0x9E, 0xA2, 0xFA, 0x6A, 0xF9, 0x9F, 0xD1, 0xC9, 0x2F, 0xFC, 0x9F, 0xD9,
+    0x2F, 0xF9, 0x0A, 0xFA, 0x29, 0xDA, 0xF9, 0x2E, 0xA3, 0xAD, 0xA1, 0x95, 0x95, 0xEA, 0x77, 0xE9,
+    0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7F, 0x77, 0xCA, 0xA7, 0x70, 0x29, 0x95, 0x99, 0x2A, 0xF9, 0x2F,
+    0x99, 0xFD, 0x2F, 0xA9, 0xAA, 0xF2, 0x9F, 0x2F, 0x92, 0xEA, 0x29, 0xE9, 0x19, 0xE9, 0x29, 0xEA,
+    0x19, 0xE4, 0xEA, 0x1A, 0xDA, 0x4E, 0xA1, 0xE5, 0xF0, 0xAD, 0xA5, 0xAE, 0x0E, 0x6A, 0xFD, 0x7A,
+    0xFC, 0x97, 0x9F, 0xA7, 0x09, 0xEA, 0x71, 0x9D, 0xA7, 0x75, 0x29, 0xA9, 0x70, 0xAD, 0xA7, 0x0E,
+    0x93, 0x9A, 0x2E, 0xA0, 0x9A, 0xE9, 0x19, 0xFF, 0xC4, 0xFE, 0x93, 0xAE, 0x79, 0xE7, 0x0F, 0x70,
+    0xF7, 0x0F, 0xA7, 0x9F, 0xAA, 0x96, 0xFD, 0x94, 0xAF, 0xD3, 0x9F, 0xAA, 0x99, 0x3F, 0x7A, 0xE9,
+    0x7F, 0x70, 0xF9, 0x7F, 0xC9, 0x69, 0xFD, 0x95, 0xAF, 0xE5, 0x9F, 0xE9, 0x59, 0xFC, 0xA7, 0x9E,
+    0xA7, 0x0E, 0xA6, 0x9F, 0x49, 0xFD, 0x94, 0x9F, 0xC7, 0x9A, 0xA6, 0x79, 0x99, 0x70, 0x9F, 0xE5,
+    0xAF, 0xFC, 0x3A, 0xF9, 0xAF, 0x91, 0x9E, 0xA2, 0xAF, 0x1F, 0x39, 0xF0, 0x9E, 0xA4, 0xF0, 0xAE,
+    0x94, 0xF0, 0xF4, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0xF4, 0xF1, 0xF3, 0x9E, 0xA1, 0xF9, 0x19, 0xF2,
+    0xAF, 0xAA, 0xF4, 0xFF, 0xC6, 0xAF, 0xCA, 0x71, 0x99, 0x70, 0x77, 0x09, 0x92, 0x9F, 0xFF, 0xDA,
+    0x1A, 0xFF, 0xFE, 0x91, 0xFF, 0xFE, 0xA2, 0xCA, 0x1E, 0x19, 0xDA, 0x59, 0x19, 0xDA, 0x1A, 0xD9,
+    0x70, 0xAD, 0x91, 0xE7, 0x1E, 0x19, 0xE7, 0x09, 0xE1, 0xAD, 0xA7, 0x0E, 0x91, 0xEA, 0x79, 0xE2,
+    0xE9, 0x7E, 0xA1, 0x9E, 0x96, 0xAE, 0x91, 0xAE, 0xA0, 0xAA, 0x29, 0xF2, 0xAF, 0xDA, 0x2F, 0x92,
+    0xAF, 0xD2, 0x9E, 0xA4, 0xF9, 0x77, 0x60, 0x70, 0x99, 0x99, 0x72, 0xAF, 0xD9, 0x7F, 0xFC, 0x95,
+    0xFA, 0x9F, 0xC4, 0x9E, 0x92, 0xF4, 0xF3, 0xF3, 0x9E, 0x93, 0xF3, 0xAE, 0x4F, 0x3F, 0x4F, 0x3E,
+    0xA4, 0xF3, 0xEA, 0x39, 0xE9, 0x29, 0xE9, 0x3F, 0x3A, 0xEA, 0x2A, 0xE9, 0x3A, 0xFC, 0xAF, 0xA4,
+    0xFF, 0xDA, 0x5F, 0xFC, 0x95, 0x9E, 0x91, 0x97, 0x09, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x4F, 0x74,
+    0xEA, 0x73, 0x9C, 0xA9, 0x74, 0x79, 0x99, 0x69, 0xFD, 0x4A, 0xFE, 0xA2, 0xAF, 0xAE, 0x91, 0x9E,
+    0xA2, 0xAC, 0x2F, 0x7A, 0xE9, 0x7F, 0x70, 0xF7, 0x0F, 0x70, 0xF9, 0x7F, 0xCA, 0x69, 0xFD, 0x95,
+    0xAF, 0xE9, 0x49, 0xFE, 0x69, 0xFC, 0x97, 0x9E, 0xA7, 0x0E, 0x96, 0xAF, 0x4A, 0xFD, 0x5A, 0xFA,
+    0x7A, 0xA9, 0x50, 0x77, 0x99, 0x59, 0xFF, 0xDA, 0x39, 0xFF, 0xF3, 0x9F, 0xFF, 0x93, 0xF9, 0x1E,
+    0xA5, 0xF3, 0xAE, 0x49, 0xEA, 0x39, 0xE9, 0x3A, 0xE4, 0x9E, 0x93, 0xF4, 0xAE, 0x93, 0xF4, 0xAE,
+    0x93, 0xF4, 0xF4, 0xF3, 0xAE, 0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC,
+    0xA7, 0x59, 0x72, 0x73, 0x99, 0x2A, 0xFF, 0xE0, 0x9F, 0xFF, 0xA0, 0xFF, 0xFC, 0x1D, 0x91, 0xE9,
+    0x59, 0x29, 0xE7, 0x2E, 0xA7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19,
+    0xF0, 0x9C, 0xA5, 0x9F, 0xEA, 0x59, 0xFD, 0xA7, 0xAF, 0x97, 0x29, 0x70, 0x39, 0x93, 0x99, 0x92,
+    0xAF, 0xC1, 0x9E, 0xA0, 0xAF, 0xD2, 0xF0, 0x99, 0x9E, 0xA2, 0xAE, 0x92, 0xE9, 0x29, 0xE9, 0x1A,
+    0xE3, 0x9E, 0x91, 0xF3, 0x9E, 0x91, 0xEA, 0x3A, 0xE1, 0x9E, 0x93, 0xF1, 0xAE, 0x4E, 0xA1, 0xF3,
+    0xAE, 0x2F, 0x3E, 0xA2, 0xF1, 0x9F, 0x3F, 0xFD, 0x49, 0xFF, 0x6A, 0xFC, 0x97, 0x19, 0x71, 0x69,
+    0x49, 0x99, 0x79, 0xF1, 0x9F, 0xC9, 0x49, 0xEA, 0x19, 0xFE, 0x93, 0xEA, 0x2E, 0xA9, 0xF2, 0xF2,
+    0xAD, 0xA1, 0xAE, 0x19, 0xE9, 0x2E, 0x91, 0x9E, 0x90, 0xAE, 0x29, 0xE2, 0x9E, 0x90, 0xF2, 0xAE,
+    0x29, 0xE9, 0x0E, 0xA2, 0xEA, 0x2A, 0xE1, 0xEA, 0x2E, 0xA2, 0xF1, 0xF1, 0x9E, 0x91, 0x9E, 0x91,
+    0xF1, 0xAE, 0x2F, 0x29, 0xF0, 0xAE, 0x1F, 0x4F, 0xFC, 0xAF, 0x6A, 0xFF, 0xDA, 0x70, 0x9A, 0xFC,
+    0xA9, 0x74, 0xAE, 0x77, 0xF7, 0x7E, 0xA7, 0x69, 0xEA, 0x76, 0xAE, 0x97, 0x6F, 0x77, 0xCA, 0xA7,
+    0x30, 0x59, 0x99, 0x59, 0x94, 0x9F, 0xC9, 0x3F, 0x92, 0xFD, 0xA2, 0x9E, 0xA3, 0x99, 0xAF, 0x2F,
+    0x7F, 0x1A, 0xE7, 0x0A, 0xE1, 0xE9, 0x71, 0xE9, 0xAD, 0xA7, 0x2E, 0xAE, 0x73, 0xAF, 0xC7, 0x49,
+    0xF9, 0x75, 0xEA, 0x76, 0xEA, 0x75, 0xAE, 0xA7, 0x49, 0xFC, 0x74, 0xFD, 0x73, 0xAD, 0x9E, 0x97,
+    0x19, 0xE0, 0xEA, 0x71, 0xE9, 0x0F, 0x70, 0xEA, 0x1A, 0xE9, 0x19, 0x3A, 0xE2, 0x9F, 0xAD, 0x29,
+    0xEA, 0x3F, 0xDA, 0x2F, 0x4F, 0xC9, 0x3A, 0xD9, 0x5D, 0xA4, 0x73, 0x9A, 0xA7, 0x70, 0xAE, 0x77,
+    0x0F, 0x77, 0x0E, 0xA7, 0x79, 0xE9, 0x71, 0x99, 0x3A, 0xE1, 0x99, 0x92, 0xAF, 0xA2, 0xF0, 0x9E,
+    0xA0, 0xAF, 0xD2, 0xEA, 0x1F, 0x09, 0x99, 0xEA, 0x2E, 0xA1, 0xAE, 0x92, 0xE9, 0x19, 0xE9, 0x19,
+    0xE9, 0x1A, 0xE2, 0xAE, 0x29, 0xE9, 0x1E, 0xA2, 0xF2, 0x9E, 0x91, 0xE9, 0x2E, 0xA2, 0xAE, 0x19,
+    0xE2, 0x9E, 0x92, 0xAE, 0x1A, 0xE2, 0xAE, 0x3E, 0xA1, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE9, 0x1F,
+    0x19, 0xE9, 0x29, 0xF9, 0x0E, 0xA0, 0xAE, 0xA4, 0xFF, 0xFD, 0xA6, 0xAF, 0xFE, 0x97, 0x09, 0xAF,
+    0xDA, 0x97, 0x5E, 0xA7, 0x70, 0xEA, 0x77, 0x9E, 0x97, 0x7A, 0xE7, 0x70, 0xF7, 0x79, 0xE9, 0x77,
+    0xAA, 0xA9, 0x73, 0x69, 0x99, 0x59, 0x97, 0x9F, 0x93, 0xEA, 0x59, 0xEA, 0x59, 0xE9, 0x39, 0xEA,
+    0x7F, 0x3E, 0xA3, 0x99, 0x2A, 0xE2, 0xAE, 0x29, 0xE2, 0xAE, 0x91, 0xEA, 0x2F, 0x29, 0xE9, 0x09,
+    0xE9, 0x2E, 0xA2, 0x9E, 0x90, 0xF3, 0xE9, 0x2A, 0xE1, 0xF3, 0xE3, 0xAE, 0x1F, 0x3D, 0xA3, 0xEA,
+    0x1F, 0x2A, 0xDA, 0x29, 0xE2, 0xF1, 0x9F, 0x2E, 0xA2, 0xFF, 0xFF, 0xC3, 0x9F, 0xE0, 0xFE, 0x59,
+    0xFA, 0x2F, 0xA7, 0x77, 0x10, 0x75, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97,
+    0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74,
+    0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71,
+    0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A,
+    0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x77,
+    0x77, 0x77, 0x7A, 0xC9, 0x77, 0x2A, 0xE7, 0x72, 0xF7, 0x72, 0xEA, 0x77, 0x2A, 0xA9, 0x73, 0x69,
+    0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE,
+    0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F,
+    0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A, 0xFD, 0x1F, 0xCA,
+    0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x77, 0x71, 0x9A, 0xA7, 0x49, 0xE9, 0x73, 0xF9, 0x73, 0xF7, 0x49,
+    0xAA, 0x71, 0x76, 0x97, 0x72, 0x9F, 0xC9, 0x77, 0xEA, 0xE7, 0x6A, 0xD1, 0xE7, 0x7A, 0x91, 0xDA,
+    0x77, 0x1A, 0xDA, 0x77, 0x1D, 0xA9, 0x77, 0x2D, 0x77, 0x49, 0x97, 0x75, 0x9A, 0x97, 0x72, 0xF7,
+    0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD,
+    0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F,
+    0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99,
+    0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF,
+    0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x71, 0x99, 0x97, 0x39, 0xFC, 0x97, 0x09, 0xDA, 0xAD, 0xA7,
+    0x0A, 0xCA, 0x1D, 0xA7, 0x1A, 0x19, 0xD9, 0x73, 0x9D, 0xA7, 0x3E, 0x97, 0x4D, 0x76, 0x99, 0x77,
+    0x75, 0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F,
+    0x3A, 0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F,
+    0x29, 0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1,
+    0xFC, 0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x73, 0x77, 0x77, 0x74, 0xAA, 0x77, 0x49, 0xD9, 0x77, 0x3E,
+    0x76, 0x99, 0x91, 0xE7, 0x6A, 0xE9, 0x0D, 0x76, 0x9F, 0xC7, 0x70, 0x9E, 0xAE, 0x76, 0xAD, 0xA1,
+    0xAD, 0x97, 0x59, 0xCA, 0x3A, 0x97, 0x72, 0x9A, 0x97, 0x73, 0xF7, 0x72, 0xAF, 0x77, 0x19, 0xFC,
+    0x97, 0x70, 0xFD, 0x97, 0x7A, 0xDA, 0xEA, 0x77, 0xE0, 0xF7, 0x6A, 0xDA, 0x0F, 0x75, 0x9E, 0x1A,
+    0xE7, 0x5E, 0x91, 0xAE, 0x97, 0x39, 0xE2, 0x9E, 0xA7, 0x3E, 0x93, 0xF7, 0x2A, 0xE9, 0x99, 0x99,
+    0xF7, 0x2F, 0xFF, 0xC7, 0x1F, 0xFF, 0xD9, 0x79, 0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA7, 0xEA, 0x6A,
+    0xF6, 0xAE, 0x79, 0xF5, 0x9F, 0x7A, 0xFA, 0x91, 0x9F, 0xE9, 0x3A, 0xFF, 0x90, 0xAF, 0xE9, 0x3F,
+    0xFC, 0x10, 0x77, 0x09, 0x77, 0x1A, 0xCA, 0x77, 0x9E, 0x77, 0xEA, 0x76, 0xEA, 0x76, 0x9D, 0x97,
+    0x49, 0xA1, 0xA9, 0x73, 0x9E, 0xA7, 0x59, 0xFC, 0xA7, 0x39, 0xE0, 0xE9, 0x71, 0xAE, 0x2D, 0xA7,
+    0x2A, 0xA3, 0x99, 0x77, 0x77, 0x09, 0x99, 0x39, 0x97, 0x09, 0xFC, 0x9A, 0xE7, 0x9F, 0xFD, 0xA6,
+    0x9F, 0xA9, 0xFC, 0x7F, 0x3F, 0x6A, 0xE9, 0x3E, 0xA6, 0xF3, 0x9E, 0x95, 0x9E, 0xA3, 0xF6, 0xAE,
+    0x39, 0xF6, 0xF3, 0xFA, 0x6F, 0x29, 0xF9, 0x6F, 0x2F, 0xC9, 0x6F, 0x1D, 0xAE, 0xAA, 0xCA, 0x3F,
+    0xF0, 0xFD, 0xA3, 0xAF, 0xD1, 0xFC, 0xA5, 0xFA, 0x29, 0xE9, 0x70, 0x97, 0x60, 0x77, 0x77, 0x79,
+    0xC7, 0x74, 0xDA, 0x77, 0x3E, 0x77, 0x09, 0x91, 0xDA, 0x76, 0xAE, 0x1A, 0xC7, 0x59, 0xFC, 0x77,
+    0x9E, 0xAD, 0xA7, 0x5A, 0xE1, 0xAD, 0x75, 0x9C, 0xA3, 0xA9, 0x77, 0x19, 0xA9, 0x77, 0x2F, 0x77,
+    0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76, 0xE0, 0xF7, 0x5A, 0xDA,
+    0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E, 0xA7, 0x2E, 0x93, 0xF7,
+    0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69, 0xE9, 0x99, 0x99, 0x99,
+    0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90, 0x9F, 0xE9, 0x3A, 0xFF,
+    0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x77, 0x73, 0x9C, 0x97, 0x5E, 0x75, 0xAD, 0xA7, 0x5A, 0xD9, 0x75,
+    0xAD, 0x72, 0x9A, 0x1A, 0xA7, 0x09, 0xEA, 0x72, 0x9F, 0xCA, 0x70, 0x9E, 0x0E, 0x96, 0xAE, 0x2D,
+    0xA7, 0xAA, 0x39, 0x97, 0x77, 0x29, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39,
+    0xFA, 0x9F, 0xC4, 0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3,
+    0x9F, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF,
+    0x0F, 0xDA, 0x0A, 0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x77, 0x77, 0x71, 0x9F,
+    0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x0A, 0xC1, 0xD9, 0x75, 0x99, 0x3A, 0xD7, 0x5A, 0xE1, 0xD9, 0x75,
+    0x9F, 0xC0, 0xAA, 0x75, 0x9E, 0xAD, 0xA7, 0x6A, 0xE1, 0xAD, 0x76, 0x9C, 0xA3, 0xA9, 0x77, 0x29,
+    0xA9, 0x77, 0x3F, 0x77, 0x2A, 0xF7, 0x71, 0x9F, 0xC9, 0x77, 0x0F, 0xD9, 0x77, 0xAD, 0xAE, 0xA7,
+    0x7E, 0x0F, 0x76, 0xAD, 0xA0, 0xF7, 0x59, 0xE1, 0xAE, 0x75, 0xE9, 0x1A, 0xE9, 0x73, 0x9E, 0x29,
+    0xEA, 0x73, 0xE9, 0x3F, 0x72, 0xAE, 0x99, 0x99, 0x9F, 0x72, 0xFF, 0xFC, 0x71, 0xFF, 0xFD, 0x97,
+    0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x7E, 0xA6, 0xAF, 0x6A, 0xE7, 0x9F, 0x59, 0xF7, 0xAF, 0xA9,
+    0x19, 0xFE, 0x93, 0xAF, 0xF9, 0x0A, 0xFE, 0x93, 0xFF, 0xC1, 0x77, 0x77, 0x1A, 0xEA, 0x75, 0xFD,
+    0x97, 0x39, 0xD1, 0xD9, 0x77, 0xAD, 0x76, 0x9D, 0xA7, 0x39, 0xA1, 0xD7, 0x39, 0xEA, 0x0A, 0xA7,
+    0x29, 0xFC, 0xA7, 0x39, 0xE0, 0xE9, 0x71, 0xAE, 0x2D, 0xA7, 0x2A, 0xA3, 0x99, 0x77, 0x77, 0x09,
+    0x99, 0x39, 0x97, 0x09, 0xFC, 0x9A, 0xE7, 0x9F, 0xFD, 0xA6, 0x9F, 0xA9, 0xFC, 0x7F, 0x3F, 0x6A,
+    0xE9, 0x3E, 0xA6, 0xF3, 0x9E, 0x95, 0x9E, 0xA3, 0xF6, 0xAE, 0x39, 0xF6, 0xF3, 0xFA, 0x6F, 0x29,
+    0xF9, 0x6F, 0x2F, 0xC9, 0x6F, 0x1D, 0xAE, 0xAA, 0xCA, 0x3F, 0xF0, 0xFD, 0xA3, 0xAF, 0xD1, 0xFC,
+    0xA5, 0xFA, 0x29, 0xE9, 0x70, 0x97, 0x60, 0x77, 0x77, 0x2E, 0xA1, 0xC9, 0x75, 0xAF, 0xEA, 0x75,
+    0xAC, 0x09, 0xF7, 0x73, 0x99, 0x77, 0x19, 0xAC, 0x97, 0x71, 0x9F, 0xA7, 0x79, 0xDA, 0xEA, 0x75,
+    0xAD, 0xA1, 0xAD, 0x75, 0xAC, 0x93, 0xA9, 0x77, 0x19, 0xA9, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x70,
+    0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76, 0xE0, 0xF7, 0x5A, 0xDA, 0x0F, 0x74, 0x9E,
+    0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E, 0xA7, 0x2E, 0x93, 0xF7, 0x1A, 0xE9, 0x99,
+    0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69, 0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA6, 0xEA,
+    0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90, 0x9F, 0xE9, 0x3A, 0xFF, 0x9A, 0xFE, 0x93,
+    0xFF, 0xC0, 0x7A, 0xA9, 0x29, 0x70, 0xFA, 0x09, 0xCA, 0x69, 0xFF, 0xA6, 0x9C, 0xA0, 0x9F, 0x70,
+    0x93, 0xAA, 0x74, 0x99, 0x74, 0x9F, 0x72, 0x9F, 0xD7, 0x09, 0xE0, 0xAD, 0xA6, 0xAE, 0x2E, 0x7A,
+    0xA4, 0xA7, 0x77, 0x29, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F,
+    0xC4, 0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F,
+    0x3F, 0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA,
+    0x0A, 0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x77, 0x77, 0x4A, 0xD7, 0x72, 0xAF,
+    0x77, 0x0A, 0xFD, 0x76, 0xEA, 0x0E, 0x97, 0x4E, 0xA2, 0xE7, 0x4A, 0xA9, 0x4A, 0x77, 0x77, 0x70,
+    0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7,
+    0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29,
+    0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96,
+    0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9,
+    0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x77, 0x77, 0x77, 0x7A, 0xC9, 0x77, 0x2A,
+    0xE7, 0x72, 0xF7, 0x72, 0xEA, 0x77, 0x2A, 0xA9, 0x73, 0x71, 0xAA, 0xA7, 0x4F, 0x97, 0x2A, 0xFC,
+    0x71, 0x9D, 0xAA, 0xD9, 0x79, 0xDA, 0x1D, 0xA6, 0x9E, 0x29, 0xD7, 0xAA, 0x4A, 0x77, 0x72, 0x99,
+    0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9,
+    0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9,
+    0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2,
+    0xFA, 0x29, 0xE9, 0x59, 0x77, 0x77, 0x19, 0xAA, 0x74, 0x9E, 0x97, 0x3F, 0x97, 0x3F, 0x74, 0x9A,
+    0xA7, 0x10, 0x77, 0x77, 0x6A, 0xA7, 0x73, 0xAD, 0x77, 0x29, 0xDA, 0x77, 0x91, 0xDA, 0x77, 0xAC,
+    0x90, 0xA9, 0x1C, 0x97, 0x4E, 0x91, 0x9D, 0x75, 0xAF, 0xE9, 0x76, 0xAF, 0xC7, 0x77, 0x77, 0x29,
+    0xA9, 0x77, 0x2F, 0x77, 0x1A, 0xF7, 0x70, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x6A, 0xDA, 0xEA, 0x76,
+    0xE0, 0xF7, 0x5A, 0xDA, 0x0F, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0x91, 0xAE, 0x97, 0x29, 0xE2, 0x9E,
+    0xA7, 0x2E, 0x93, 0xF7, 0x1A, 0xE9, 0x99, 0x99, 0xF7, 0x1F, 0xFF, 0xC7, 0x0F, 0xFF, 0xD9, 0x69,
+    0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA6, 0xEA, 0x6A, 0xF5, 0xAE, 0x79, 0xF4, 0x9F, 0x7A, 0xFA, 0x90,
+    0x9F, 0xE9, 0x3A, 0xFF, 0x9A, 0xFE, 0x93, 0xFF, 0xC0, 0x77, 0x74, 0x9C, 0x76, 0xDA, 0x74, 0xEA,
+    0x73, 0xAD, 0xA7, 0x39, 0xD9, 0x72, 0x91, 0xA2, 0x97, 0xD4, 0x9C, 0x7E, 0x2A, 0xCA, 0x7F, 0xF7,
+    0x1F, 0xCA, 0x74, 0x99, 0x77, 0x75, 0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3,
+    0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE,
+    0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F,
+    0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x73, 0x77, 0x77, 0x39, 0xC7,
+    0x74, 0xDA, 0x77, 0x3A, 0xD7, 0x71, 0x91, 0xD9, 0x77, 0xAC, 0x91, 0xA1, 0xC9, 0x74, 0xE9, 0x19,
+    0xD7, 0x5A, 0xFE, 0x97, 0x6A, 0xFC, 0x77, 0x77, 0x72, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77,
+    0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49,
+    0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99,
+    0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E,
+    0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9,
+    0x3F, 0xFC, 0x00, 0x77, 0x71, 0xC7, 0x6D, 0xA7, 0x5E, 0x75, 0x9E, 0x75, 0x9D, 0x97, 0x29, 0x19,
+    0xC1, 0x97, 0xD4, 0x9C, 0x7E, 0x2A, 0xCA, 0x7F, 0xF7, 0x1F, 0xCA, 0x74, 0x99, 0x77, 0x75, 0x99,
+    0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4, 0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9,
+    0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E, 0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9,
+    0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE, 0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2,
+    0xFA, 0x29, 0xE9, 0x59, 0x73, 0x77, 0x77, 0x39, 0xF7, 0x70, 0x9D, 0x9D, 0x97, 0x70, 0xA9, 0x0D,
+    0x97, 0x71, 0x9D, 0xA7, 0x79, 0x1D, 0x97, 0x7A, 0xC1, 0xA9, 0x09, 0xA7, 0x5A, 0xD9, 0x99, 0xAC,
+    0x97, 0x6F, 0xDA, 0x77, 0x09, 0xAA, 0x97, 0x74, 0x9A, 0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09,
+    0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1,
+    0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99,
+    0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6,
+    0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F,
+    0xFC, 0x00, 0x72, 0x99, 0x74, 0xAF, 0x72, 0xAC, 0xA9, 0xDA, 0x71, 0xAC, 0x1D, 0x97, 0x4A, 0xD7,
+    0x39, 0xDA, 0x72, 0x90, 0xAC, 0x97, 0x2D, 0x19, 0x19, 0xC7, 0xDA, 0x2A, 0xD7, 0xFF, 0x71, 0xFC,
+    0xA7, 0x49, 0x97, 0x77, 0x59, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA,
+    0x9F, 0xC4, 0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F,
+    0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F,
+    0xDA, 0x0A, 0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x77, 0x77, 0x19, 0xE9, 0x1C,
+    0x97, 0x49, 0xFC, 0xAD, 0xA7, 0x49, 0xC9, 0x0A, 0xF7, 0x69, 0x39, 0x97, 0x69, 0xC5, 0xC9, 0x74,
+    0xDA, 0x29, 0xD7, 0x5A, 0xFE, 0x97, 0x6A, 0xFA, 0x77, 0x77, 0x72, 0x9A, 0x97, 0x72, 0xF7, 0x71,
+    0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E, 0x0F, 0x75, 0xAD, 0xA0,
+    0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA, 0x72, 0xE9, 0x3F, 0x71,
+    0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E, 0x99, 0x99, 0x99, 0x9A,
+    0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09, 0xFE, 0x93, 0xAF, 0xF9,
+    0xAF, 0xE9, 0x3F, 0xFC, 0x00, 0x77, 0x79, 0xE2, 0xC9, 0x7F, 0xCA, 0xD9, 0x6A, 0xCA, 0x0F, 0xC7,
+    0x0C, 0x2A, 0xCA, 0x71, 0x97, 0x6D, 0x49, 0xC7, 0xDA, 0x2A, 0xD7, 0xFF, 0x71, 0xFC, 0xA7, 0x49,
+    0x97, 0x77, 0x59, 0x99, 0x39, 0x95, 0x9F, 0xC9, 0xAE, 0x49, 0xFF, 0xDA, 0x39, 0xFA, 0x9F, 0xC4,
+    0xF3, 0xF3, 0xAE, 0x93, 0xEA, 0x3F, 0x39, 0xE9, 0x29, 0xEA, 0x3F, 0x3A, 0xE3, 0x9F, 0x3F, 0x3F,
+    0xA3, 0xF2, 0x9F, 0x93, 0xF2, 0xFC, 0x93, 0xF1, 0xDA, 0xEA, 0xAC, 0xA0, 0xFF, 0x0F, 0xDA, 0x0A,
+    0xFD, 0x1F, 0xCA, 0x2F, 0xA2, 0x9E, 0x95, 0x97, 0x30, 0x73, 0x97, 0x73, 0x9D, 0x4A, 0xA7, 0x49,
+    0xE9, 0x09, 0xD9, 0x74, 0x9F, 0xEA, 0x76, 0x9F, 0xCA, 0x77, 0x19, 0x99, 0x77, 0x77, 0x73, 0x9A,
+    0x97, 0x72, 0xF7, 0x71, 0xAF, 0x77, 0x09, 0xFC, 0x97, 0x7F, 0xD9, 0x76, 0xAD, 0xAE, 0xA7, 0x6E,
+    0x0F, 0x75, 0xAD, 0xA0, 0xF7, 0x49, 0xE1, 0xAE, 0x74, 0xE9, 0x1A, 0xE9, 0x72, 0x9E, 0x29, 0xEA,
+    0x72, 0xE9, 0x3F, 0x71, 0xAE, 0x99, 0x99, 0x9F, 0x71, 0xFF, 0xFC, 0x70, 0xFF, 0xFD, 0x96, 0x9E,
+    0x99, 0x99, 0x99, 0x9A, 0xEA, 0x6E, 0xA6, 0xAF, 0x5A, 0xE7, 0x9F, 0x49, 0xF7, 0xAF, 0xA9, 0x09,
+    0xFE, 0x93, 0xAF, 0xF9, 0xAF, 0xE9, 0x3F, 0xFC, 0x77, 0x77, 0x77, 0x7A, 0xC9, 0x77, 0x2A, 0xE7,
+    0x72, 0xF7, 0x72, 0xEA, 0x77, 0x2A, 0xA9, 0x73, 0x69, 0x76, 0xAD, 0x4C, 0x96, 0xEA, 0x1A, 0xD7,
+    0xAF, 0xE9, 0x70, 0xAF, 0xC9, 0x73, 0x99, 0x77, 0x75, 0x99, 0x93, 0x99, 0x59, 0xFC, 0x9A, 0xE4,
+    0x9F, 0xFD, 0xA3, 0x9F, 0xA9, 0xFC, 0x4F, 0x3F, 0x3A, 0xE9, 0x3E, 0xA3, 0xF3, 0x9E, 0x92, 0x9E,
+    0xA3, 0xF3, 0xAE, 0x39, 0xF3, 0xF3, 0xFA, 0x3F, 0x29, 0xF9, 0x3F, 0x2F, 0xC9, 0x3F, 0x1D, 0xAE,
+    0xAA, 0xCA, 0x0F, 0xF0, 0xFD, 0xA0, 0xAF, 0xD1, 0xFC, 0xA2, 0xFA, 0x29, 0xE9, 0x59, 0x77, 0x77,
+    0x19, 0xAA, 0x74, 0x9E, 0x97, 0x3F, 0x97, 0x3F, 0x74, 0x9A, 0xA7, 0x10, 0x77, 0x71, 0xFF, 0xFE,
+    0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4,
+    0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF,
+    0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9,
+    0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x97, 0x77, 0x77, 0x75, 0xAC,
+    0x77, 0x1E, 0xA7, 0x7A, 0xEA, 0x77, 0xAE, 0x77, 0x1A, 0xA7, 0x30, 0x79, 0x99, 0x70, 0xAF, 0xC9,
+    0x49, 0xFF, 0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2E, 0x2A, 0xE2, 0xAE, 0x1A,
+    0xE3, 0xFA, 0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2, 0x9E, 0x2A, 0xFF, 0xCA, 0x3F,
+    0xF9, 0x49, 0xFC, 0xA7, 0x19, 0x77, 0x71, 0x9A, 0x97, 0x1A, 0xE7, 0x1F, 0x71, 0xEA, 0x71, 0xAA,
+    0x97, 0x76, 0x97, 0x70, 0xAF, 0xA7, 0x5E, 0xAE, 0x74, 0x9D, 0x1A, 0xD7, 0x5A, 0x91, 0xE7, 0x79,
+    0xE7, 0x7E, 0x97, 0x70, 0xAC, 0x97, 0x72, 0x97, 0x77, 0x70, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F,
+    0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7,
+    0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77,
+    0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA,
+    0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x70, 0x99, 0x97, 0x0A, 0xFC, 0x6A, 0xDA, 0xEA,
+    0x5D, 0xA1, 0xDA, 0x6A, 0x1A, 0xD7, 0x1A, 0xD9, 0x79, 0xDA, 0x72, 0xD7, 0x3A, 0x97, 0x77, 0x19,
+    0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF, 0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2E,
+    0x2A, 0xE2, 0xAE, 0x1A, 0xE3, 0xFA, 0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2, 0x9E,
+    0x2A, 0xFF, 0xCA, 0x3F, 0xF9, 0x49, 0xFC, 0xA7, 0x19, 0x70, 0x73, 0x97, 0x71, 0xAE, 0x91, 0xD7,
+    0x29, 0xFC, 0xAE, 0x72, 0xAD, 0x9F, 0xCA, 0x72, 0x9C, 0x2E, 0xA7, 0x77, 0x77, 0x77, 0x76, 0xFF,
+    0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69,
+    0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70,
+    0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6,
+    0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x93, 0x59, 0xAA, 0x92,
+    0xA5, 0x9F, 0x1D, 0x94, 0xFF, 0xC9, 0x4D, 0x1F, 0xA5, 0x99, 0x19, 0xAC, 0x97, 0x77, 0x77, 0x99,
+    0x97, 0x1A, 0xFC, 0x95, 0x9F, 0xF4, 0x9E, 0x90, 0xAE, 0x4E, 0x29, 0xE3, 0xEA, 0x2E, 0xA3, 0xE2,
+    0xAE, 0x3A, 0xE1, 0xAE, 0x4F, 0xAF, 0x5F, 0xE9, 0x6F, 0xA9, 0x70, 0xEA, 0x4A, 0xC3, 0xF2, 0x9E,
+    0x3A, 0xFF, 0xCA, 0x4F, 0xF9, 0x59, 0xFC, 0xA7, 0x29, 0x70, 0x77, 0x77, 0x72, 0x9C, 0x77, 0x4D,
+    0xA7, 0x72, 0xE9, 0x75, 0x99, 0x1A, 0xD9, 0x74, 0x9E, 0xA0, 0xD7, 0x6F, 0xC9, 0x77, 0xE9, 0xE7,
+    0x59, 0xE1, 0x9D, 0xA7, 0x49, 0xCA, 0x39, 0xA7, 0x77, 0x70, 0xFF, 0xFE, 0x7F, 0xFF, 0xE7, 0x09,
+    0xFA, 0xAA, 0xAA, 0xEA, 0x71, 0xF4, 0x9D, 0xA7, 0x09, 0xF4, 0x9D, 0x97, 0x09, 0xF4, 0x9C, 0xA7,
+    0x1A, 0xEA, 0x77, 0x1F, 0x97, 0x71, 0xFA, 0x99, 0xAA, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x2A, 0xFF,
+    0xD7, 0x3F, 0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x69, 0x71, 0x9F, 0x5A, 0xCA, 0x70, 0xAE, 0xA5, 0xDA,
+    0x70, 0xF9, 0x4E, 0x97, 0x9F, 0xCA, 0xAF, 0xD6, 0x9F, 0xFF, 0xE6, 0xFF, 0xFE, 0x95, 0x77, 0x97,
+    0x7D, 0x97, 0x5A, 0xE7, 0x49, 0xE9, 0x74, 0xE9, 0x74, 0xAD, 0x97, 0x19, 0x99, 0x1A, 0x72, 0x9E,
+    0xA7, 0x39, 0xFC, 0x97, 0x1A, 0xE0, 0xE7, 0x0A, 0xDA, 0x19, 0xD9, 0x79, 0xA9, 0x3A, 0x97, 0x77,
+    0x69, 0x99, 0x74, 0xAF, 0xC9, 0x70, 0x9F, 0xF7, 0x9E, 0x90, 0xAE, 0x7E, 0x29, 0xE6, 0xEA, 0x2E,
+    0xA6, 0xE2, 0xAE, 0x6A, 0xE1, 0xAE, 0x7F, 0xAF, 0x70, 0xFE, 0x97, 0x1F, 0xA9, 0x73, 0xEA, 0x4A,
+    0xC6, 0xF2, 0x9E, 0x6A, 0xFF, 0xCA, 0x7F, 0xF9, 0x70, 0x9F, 0xCA, 0x75, 0x97, 0x30, 0x77, 0x77,
+    0x49, 0xC7, 0x72, 0xE7, 0x71, 0xAD, 0x97, 0x69, 0x90, 0xAD, 0x74, 0x9E, 0x90, 0xAC, 0x74, 0xFC,
+    0x76, 0xE9, 0xE7, 0x39, 0xE1, 0x9D, 0x97, 0x29, 0xCA, 0x39, 0xA7, 0x77, 0x4F, 0xFF, 0xE5, 0xFF,
+    0xFE, 0x69, 0xFA, 0xAA, 0xAA, 0xEA, 0x7F, 0x49, 0xDA, 0x69, 0xF4, 0x9D, 0x96, 0x9F, 0x49, 0xCA,
+    0x7A, 0xEA, 0x77, 0xF9, 0x77, 0xFA, 0x99, 0xAA, 0xA9, 0x70, 0x9F, 0xFD, 0xA7, 0x0A, 0xFF, 0xD7,
+    0x1F, 0xA7, 0x7F, 0x97, 0x7F, 0x69, 0x79, 0xF5, 0xAC, 0xA6, 0xAE, 0xA5, 0xDA, 0x6F, 0x94, 0xE9,
+    0x59, 0xFC, 0xAA, 0xFD, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x30, 0x77, 0x70, 0xAC, 0x97, 0x3E,
+    0x73, 0xEA, 0x73, 0xE7, 0x4D, 0xA7, 0x99, 0x91, 0xC9, 0x69, 0xEA, 0x70, 0x9F, 0xC9, 0x6A, 0xE0,
+    0xE5, 0xAD, 0xA1, 0x9D, 0x94, 0x9A, 0x93, 0xA9, 0x77, 0x70, 0x99, 0x97, 0x1A, 0xFC, 0x95, 0x9F,
+    0xF4, 0x9E, 0x90, 0xAE, 0x4E, 0x29, 0xE3, 0xEA, 0x2E, 0xA3, 0xE2, 0xAE, 0x3A, 0xE1, 0xAE, 0x4F,
+    0xAF, 0x5F, 0xE9, 0x6F, 0xA9, 0x70, 0xEA, 0x4A, 0xC3, 0xF2, 0x9E, 0x3A, 0xFF, 0xCA, 0x4F, 0xF9,
+    0x59, 0xFC, 0xA7, 0x29, 0x70, 0x77, 0x77, 0x79, 0xF9, 0x77, 0x9D, 0xAE, 0x77, 0x9C, 0x90, 0xAC,
+    0xA7, 0x59, 0x92, 0x9D, 0x74, 0x9E, 0x90, 0xAC, 0xA7, 0x5F, 0xC0, 0x9A, 0x75, 0xE9, 0xE7, 0x59,
+    0xE1, 0x9D, 0x97, 0x49, 0xCA, 0x39, 0xA7, 0x77, 0x70, 0xFF, 0xFE, 0x7F, 0xFF, 0xE7, 0x09, 0xFA,
+    0xAA, 0xAA, 0xEA, 0x71, 0xF4, 0x9D, 0xA7, 0x09, 0xF4, 0x9D, 0x97, 0x09, 0xF4, 0x9C, 0xA7, 0x1A,
+    0xEA, 0x77, 0x1F, 0x97, 0x71, 0xFA, 0x99, 0xAA, 0xA9, 0x72, 0x9F, 0xFD, 0xA7, 0x2A, 0xFF, 0xD7,
+    0x3F, 0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x69, 0x71, 0x9F, 0x5A, 0xCA, 0x70, 0xAE, 0xA5, 0xDA, 0x70,
+    0xF9, 0x4E, 0x97, 0x9F, 0xCA, 0xAF, 0xD6, 0x9F, 0xFF, 0xE6, 0xFF, 0xFE, 0x95, 0x77, 0x77, 0xF9,
+    0x74, 0xDA, 0xE7, 0x39, 0xCA, 0x09, 0xD7, 0x49, 0x1A, 0xCA, 0x75, 0xAD, 0xA7, 0x19, 0x99, 0x1D,
+    0x72, 0x9E, 0xA0, 0xCA, 0x71, 0x9F, 0xC9, 0x72, 0xAE, 0x0E, 0x71, 0xAD, 0xA1, 0x9D, 0x97, 0x09,
+    0xA9, 0x3A, 0x97, 0x77, 0x70, 0x99, 0x97, 0x5A, 0xFC, 0x97, 0x19, 0xFF, 0x70, 0x9E, 0x90, 0xAE,
+    0x70, 0xE2, 0x9E, 0x7E, 0xA2, 0xEA, 0x7E, 0x2A, 0xE7, 0xAE, 0x1A, 0xE7, 0x0F, 0xAF, 0x71, 0xFE,
+    0x97, 0x2F, 0xA9, 0x74, 0xEA, 0x4A, 0xC7, 0xF2, 0x9E, 0x7A, 0xFF, 0xCA, 0x70, 0xFF, 0x97, 0x19,
+    0xFC, 0xA7, 0x69, 0x74, 0x77, 0x77, 0xAD, 0xA1, 0xAA, 0x73, 0x9F, 0xF7, 0x39, 0xC9, 0x0F, 0x97,
+    0x49, 0x29, 0x97, 0x70, 0xAC, 0xA7, 0x70, 0xFC, 0x75, 0x9E, 0xAE, 0x73, 0x9E, 0x19, 0xD9, 0x72,
+    0x9C, 0xA3, 0xA9, 0x77, 0x74, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0xF4,
+    0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0xA9, 0x9A,
+    0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77, 0xF6, 0x97, 0x9F,
+    0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4, 0x9F, 0xFF, 0xE4,
+    0xFF, 0xFE, 0x93, 0x59, 0xAA, 0x39, 0x6F, 0x90, 0xAC, 0x94, 0xAF, 0xF9, 0x4A, 0xC9, 0x09, 0xF6,
+    0x93, 0xAA, 0x72, 0x99, 0x72, 0x9E, 0xA7, 0x09, 0xFC, 0xA6, 0xAD, 0xA0, 0xE9, 0x4A, 0xDA, 0x2D,
+    0xA4, 0x9A, 0x94, 0x97, 0x77, 0x09, 0x99, 0x71, 0xAF, 0xC9, 0x59, 0xFF, 0x49, 0xE9, 0x0A, 0xE4,
+    0xE2, 0x9E, 0x3E, 0xA2, 0xEA, 0x3E, 0x2A, 0xE3, 0xAE, 0x1A, 0xE4, 0xFA, 0xF5, 0xFE, 0x96, 0xFA,
+    0x97, 0x0E, 0xA4, 0xAC, 0x3F, 0x29, 0xE3, 0xAF, 0xFC, 0xA4, 0xFF, 0x95, 0x9F, 0xCA, 0x72, 0x97,
+    0x00, 0x77, 0x77, 0x19, 0xD9, 0x77, 0x9F, 0x76, 0xAF, 0xD7, 0x4A, 0xE0, 0xAD, 0xA7, 0x2F, 0x2A,
+    0xD7, 0x2A, 0xC9, 0x4A, 0x97, 0x77, 0x77, 0x70, 0xFF, 0xFE, 0x5F, 0xFF, 0xE6, 0x9F, 0xAA, 0xAA,
+    0xAE, 0xA7, 0xF4, 0x9D, 0xA6, 0x9F, 0x49, 0xD9, 0x69, 0xF4, 0x9C, 0xA7, 0xAE, 0xA7, 0x7F, 0x97,
+    0x7F, 0xA9, 0x9A, 0xAA, 0x97, 0x09, 0xFF, 0xDA, 0x70, 0xAF, 0xFD, 0x71, 0xFA, 0x77, 0xF9, 0x77,
+    0xF6, 0x97, 0x9F, 0x5A, 0xCA, 0x6A, 0xEA, 0x5D, 0xA6, 0xF9, 0x4E, 0x95, 0x9F, 0xCA, 0xAF, 0xD4,
+    0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x97, 0x77, 0x77, 0x75, 0xAC, 0x77, 0x1E, 0xA7, 0x7A, 0xEA, 0x77,
+    0xAE, 0x77, 0x1A, 0xA7, 0x30, 0x70, 0xAA, 0x97, 0x1F, 0x70, 0xFC, 0xA6, 0xAD, 0x9E, 0x59, 0xDA,
+    0x1D, 0xA3, 0x9D, 0xA2, 0xAC, 0xA4, 0xA9, 0x49, 0x77, 0x69, 0x99, 0x70, 0xAF, 0xC9, 0x49, 0xFF,
+    0x39, 0xE9, 0x0A, 0xE3, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x2E, 0x2A, 0xE2, 0xAE, 0x1A, 0xE3, 0xFA,
+    0xF4, 0xFE, 0x95, 0xFA, 0x97, 0xEA, 0x4A, 0xC2, 0xF2, 0x9E, 0x2A, 0xFF, 0xCA, 0x3F, 0xF9, 0x49,
+    0xFC, 0xA7, 0x19, 0x77, 0x71, 0x9A, 0x97, 0x1A, 0xE7, 0x1F, 0x71, 0xEA, 0x71, 0xAA, 0x97, 0x72,
+    0x97, 0x2A, 0xFA, 0x7A, 0xDA, 0xE9, 0x6D, 0x90, 0x9D, 0x96, 0x9A, 0x1A, 0xD7, 0x19, 0xAD, 0x97,
+    0x0A, 0xD9, 0x72, 0x9C, 0xA7, 0x49, 0x77, 0x70, 0xFF, 0xC9, 0x4F, 0xFC, 0x69, 0xFC, 0x71, 0xF9,
+    0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7,
+    0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x70, 0x9F, 0xC9, 0x59, 0xFF, 0xA4,
+    0xFF, 0xC9, 0x30, 0x59, 0x96, 0xFC, 0xA3, 0xEA, 0xE3, 0xD1, 0xAD, 0x39, 0x91, 0xE5, 0x9E, 0x5A,
+    0xDA, 0x6A, 0xCA, 0x70, 0xA9, 0x77, 0x29, 0x95, 0xAF, 0xA3, 0xFE, 0x39, 0x9A, 0xEA, 0x59, 0xE9,
+    0x5A, 0xE6, 0xF6, 0xEA, 0x5A, 0xE9, 0x5F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x99, 0xC9, 0x2A, 0xFD,
+    0x92, 0xAF, 0xCA, 0x39, 0xF9, 0x69, 0x70, 0x77, 0x3F, 0xFC, 0x94, 0xFF, 0xC6, 0x9F, 0xC7, 0x1F,
+    0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA,
+    0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x09, 0xFC, 0x95, 0x9F, 0xFA,
+    0x4F, 0xFC, 0x97, 0x77, 0x75, 0xAC, 0x73, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xE7, 0x3A, 0xA7, 0x10,
+    0x77, 0xE5, 0xF9, 0x39, 0xF9, 0x4F, 0x59, 0xA9, 0x77, 0x09, 0x94, 0xAF, 0xA2, 0xFE, 0x29, 0x9A,
+    0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x4A, 0xE9, 0x4F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x99,
+    0xC9, 0x1A, 0xFD, 0x91, 0xAF, 0xCA, 0x29, 0xF9, 0x59, 0x77, 0x1A, 0xA6, 0xEA, 0x4A, 0xE9, 0x4A,
+    0xE6, 0xAA, 0x60, 0x71, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xFF, 0xF9, 0x59, 0xFD, 0xAA,
+    0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A, 0xF9, 0x1F, 0xC7, 0x9F, 0x90,
+    0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xFA, 0x5F,
+    0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9, 0x76,
+    0x97, 0x77, 0x76, 0x9C, 0xA7, 0x70, 0x9E, 0xA7, 0x7F, 0x97, 0x7F, 0x77, 0x09, 0xAA, 0x74, 0x79,
+    0x99, 0x70, 0x9F, 0xE5, 0xAF, 0xFC, 0x3A, 0xF9, 0xAF, 0x91, 0x9E, 0xA2, 0xAF, 0x1F, 0x39, 0xF0,
+    0x9E, 0xA4, 0xF0, 0xAE, 0x94, 0xF0, 0xF4, 0x9E, 0xA0, 0xF4, 0xAE, 0x90, 0xF4, 0xF1, 0xF3, 0x9E,
+    0xA1, 0xF9, 0x19, 0xF2, 0xAF, 0xAA, 0xF4, 0xFF, 0xC6, 0xAF, 0xCA, 0x71, 0x99, 0x77, 0x72, 0x9A,
+    0x97, 0x2A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0x9A, 0x97, 0x00, 0x75, 0x97, 0x70, 0xAF, 0x97, 0x5E,
+    0xAE, 0x74, 0x9D, 0x1A, 0xD7, 0x5A, 0x91, 0xE7, 0x79, 0xE7, 0x7D, 0xA9, 0x77, 0x0D, 0x77, 0x39,
+    0x77, 0x19, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF, 0x95, 0x9F, 0xDA, 0xAF, 0xD5, 0xFC,
+    0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91, 0xFC, 0x79, 0xF9, 0x09, 0xF9, 0x79,
+    0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F,
+    0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F, 0xC2, 0xAF, 0xA5, 0xFC, 0x4F, 0xCA,
+    0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19, 0xAF, 0xDA, 0x97, 0x69, 0x73, 0x71,
+    0x99, 0x97, 0x19, 0xFC, 0x96, 0x9D, 0xAA, 0xE6, 0xAD, 0x1E, 0x7A, 0x19, 0xD9, 0x71, 0x9D, 0xA7,
+    0x1E, 0x97, 0x2D, 0x74, 0x9A, 0x77, 0x72, 0x99, 0x97, 0x09, 0xFE, 0x5A, 0xFF, 0xC3, 0xAF, 0x9A,
+    0xF9, 0x19, 0xEA, 0x2A, 0xF1, 0xF3, 0x9F, 0x09, 0xEA, 0x4F, 0x0A, 0xE9, 0x4F, 0x0F, 0x49, 0xEA,
+    0x0F, 0x4A, 0xE9, 0x0F, 0x4F, 0x1F, 0x39, 0xEA, 0x1F, 0x91, 0x9F, 0x2A, 0xFA, 0xAF, 0x4F, 0xFC,
+    0x6A, 0xFC, 0xA7, 0x19, 0x97, 0x77, 0x77, 0x70, 0x9C, 0x77, 0x3D, 0xA7, 0x71, 0xE9, 0x73, 0x99,
+    0x91, 0xAD, 0x97, 0x39, 0xE9, 0x0D, 0x74, 0x9F, 0xC9, 0x75, 0x9E, 0x9E, 0x74, 0x9E, 0x19, 0xD9,
+    0x73, 0x9C, 0xA3, 0xAA, 0x76, 0x9A, 0xAA, 0x97, 0x59, 0xFF, 0xC9, 0x71, 0xFF, 0xF9, 0x69, 0xFD,
+    0xAA, 0xFD, 0x6F, 0xC9, 0x3A, 0xFA, 0x4F, 0xC6, 0xFC, 0x3A, 0xF9, 0x6A, 0xF9, 0x2F, 0xC7, 0x9F,
+    0x91, 0x9F, 0x97, 0x9F, 0xA1, 0xAF, 0x70, 0x9F, 0x91, 0xFC, 0x70, 0x9F, 0x91, 0xFC, 0x70, 0xAF,
+    0x91, 0xFC, 0x70, 0xFC, 0x2F, 0xC7, 0x0F, 0xA2, 0xFC, 0x7A, 0xF9, 0x2F, 0xC7, 0xFC, 0x3A, 0xFA,
+    0x5F, 0xC5, 0xFC, 0xA2, 0x9F, 0xC9, 0x5A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x72, 0x9A, 0xFD, 0xA9,
+    0x77, 0x97, 0x40, 0x77, 0x09, 0x77, 0x1A, 0xCA, 0x77, 0x9E, 0x77, 0xEA, 0x76, 0xEA, 0x76, 0x9D,
+    0x97, 0x49, 0xA1, 0xA9, 0x74, 0xF7, 0x59, 0xFC, 0xA7, 0x39, 0xE0, 0xE9, 0x71, 0x9E, 0x2D, 0xA7,
+    0x2A, 0xA3, 0x9A, 0x77, 0x77, 0x19, 0x99, 0x75, 0x9F, 0xE7, 0x2A, 0xFF, 0xC7, 0x0A, 0xF9, 0xAF,
+    0x96, 0x9E, 0xA2, 0xAF, 0x6F, 0x39, 0xF5, 0x9E, 0xA4, 0xF5, 0xAE, 0x94, 0xF5, 0xF4, 0x9E, 0xA5,
+    0xF4, 0xAE, 0x95, 0xF4, 0xF6, 0xF3, 0x9E, 0xA6, 0xF9, 0x19, 0xF7, 0xAF, 0xAA, 0xF7, 0x1F, 0xFC,
+    0x73, 0xAF, 0xCA, 0x76, 0x99, 0x74, 0x77, 0x77, 0x39, 0xC7, 0x72, 0xDA, 0x77, 0x1A, 0xD9, 0x75,
+    0x99, 0x90, 0xAD, 0x74, 0x9E, 0x1A, 0xC7, 0x39, 0xFC, 0x75, 0x9E, 0x9E, 0x73, 0x9E, 0x19, 0xD7,
+    0x39, 0xCA, 0x3A, 0xA7, 0x59, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF, 0x95, 0x9F, 0xDA,
+    0xAF, 0xD5, 0xFC, 0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91, 0xFC, 0x79, 0xF9,
+    0x09, 0xF9, 0x79, 0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9,
+    0x0F, 0xC7, 0x0F, 0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F, 0xC2, 0xAF, 0xA5,
+    0xFC, 0x4F, 0xCA, 0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19, 0xAF, 0xDA, 0x97,
+    0x69, 0x73, 0x77, 0x73, 0x9C, 0xA7, 0x5E, 0x75, 0xAE, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x29, 0xA1,
+    0xAA, 0x71, 0xF7, 0x29, 0xFC, 0xA7, 0x09, 0xE0, 0xE9, 0x69, 0xE2, 0xDA, 0x7A, 0xA3, 0x9A, 0x77,
+    0x73, 0x99, 0x97, 0x29, 0xFE, 0x7A, 0xFF, 0xC5, 0xAF, 0x9A, 0xF9, 0x39, 0xEA, 0x2A, 0xF3, 0xF3,
+    0x9F, 0x29, 0xEA, 0x4F, 0x2A, 0xE9, 0x4F, 0x2F, 0x49, 0xEA, 0x2F, 0x4A, 0xE9, 0x2F, 0x4F, 0x3F,
+    0x39, 0xEA, 0x3F, 0x91, 0x9F, 0x4A, 0xFA, 0xAF, 0x6F, 0xFC, 0x70, 0xAF, 0xCA, 0x73, 0x99, 0x71,
+    0x77, 0x77, 0x59, 0xF7, 0x79, 0xDA, 0xDA, 0x76, 0x9C, 0x90, 0xAC, 0xA7, 0x39, 0x99, 0x29, 0xD7,
+    0x39, 0xE1, 0xDA, 0x73, 0x9F, 0xC0, 0xAA, 0x73, 0x9E, 0x9E, 0x74, 0x9E, 0x19, 0xD7, 0x49, 0xCA,
+    0x3A, 0xA7, 0x69, 0xAA, 0xA9, 0x75, 0x9F, 0xFC, 0x97, 0x1F, 0xFF, 0x96, 0x9F, 0xDA, 0xAF, 0xD6,
+    0xFC, 0x93, 0xAF, 0xA4, 0xFC, 0x6F, 0xC3, 0xAF, 0x96, 0xAF, 0x92, 0xFC, 0x79, 0xF9, 0x19, 0xF9,
+    0x79, 0xFA, 0x1A, 0xF7, 0x09, 0xF9, 0x1F, 0xC7, 0x09, 0xF9, 0x1F, 0xC7, 0x0A, 0xF9, 0x1F, 0xC7,
+    0x0F, 0xC2, 0xFC, 0x70, 0xFA, 0x2F, 0xC7, 0xAF, 0x92, 0xFC, 0x7F, 0xC3, 0xAF, 0xA5, 0xFC, 0x5F,
+    0xCA, 0x29, 0xFC, 0x95, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE7, 0x29, 0xAF, 0xDA, 0x97, 0x79, 0x74,
+    0x77, 0x77, 0x1A, 0xEA, 0x75, 0xFD, 0x97, 0x4D, 0x1D, 0x97, 0x7A, 0xD7, 0x69, 0xE7, 0x39, 0xA1,
+    0xD9, 0x73, 0xF0, 0xAC, 0x72, 0x9F, 0xCA, 0x73, 0x9E, 0x0E, 0x97, 0x19, 0xE2, 0xDA, 0x72, 0xAA,
+    0x39, 0xA7, 0x77, 0x71, 0x99, 0x97, 0x59, 0xFE, 0x72, 0xAF, 0xFC, 0x70, 0xAF, 0x9A, 0xF9, 0x69,
+    0xEA, 0x2A, 0xF6, 0xF3, 0x9F, 0x59, 0xEA, 0x4F, 0x5A, 0xE9, 0x4F, 0x5F, 0x49, 0xEA, 0x5F, 0x4A,
+    0xE9, 0x5F, 0x4F, 0x6F, 0x39, 0xEA, 0x6F, 0x91, 0x9F, 0x7A, 0xFA, 0xAF, 0x71, 0xFF, 0xC7, 0x3A,
+    0xFC, 0xA7, 0x69, 0x97, 0x40, 0x77, 0x76, 0xAD, 0xA1, 0xCA, 0x73, 0xAF, 0xF7, 0x3A, 0xC1, 0xF9,
+    0x74, 0x92, 0x99, 0x77, 0x0A, 0xCA, 0x77, 0x0F, 0xA7, 0x59, 0xEA, 0xDA, 0x73, 0xAD, 0xA1, 0xAD,
+    0x73, 0x9C, 0x93, 0xA9, 0x75, 0x9A, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xFF, 0xF9, 0x59, 0xFD,
+    0xAA, 0xFD, 0x5F, 0xC9, 0x3A, 0xFA, 0x3F, 0xC6, 0xFC, 0x2A, 0xF9, 0x6A, 0xF9, 0x1F, 0xC7, 0x9F,
+    0x90, 0x9F, 0x97, 0x9F, 0xA0, 0xAF, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0x90, 0xFC, 0x70, 0xAF,
+    0x90, 0xFC, 0x70, 0xFC, 0x1F, 0xC7, 0x0F, 0xA1, 0xFC, 0x7A, 0xF9, 0x1F, 0xC7, 0xFC, 0x2A, 0xFA,
+    0x5F, 0xC4, 0xFC, 0xA2, 0x9F, 0xC9, 0x4A, 0xFF, 0xFC, 0x96, 0xAF, 0xFE, 0x71, 0x9A, 0xFD, 0xA9,
+    0x76, 0x97, 0x30, 0x7A, 0xA9, 0x29, 0x7F, 0xA0, 0x9C, 0xA5, 0x9F, 0xFA, 0x59, 0xCA, 0x09, 0xF7,
+    0x93, 0xAA, 0x73, 0x99, 0x73, 0x9F, 0x71, 0x9F, 0xD7, 0x9E, 0x0A, 0xDA, 0x59, 0xE2, 0xAD, 0x6A,
+    0xA4, 0xA7, 0x77, 0x19, 0x99, 0x71, 0x9F, 0xE6, 0xAF, 0xFC, 0x4A, 0xF9, 0xAF, 0x92, 0x9E, 0xA2,
+    0xAF, 0x2F, 0x39, 0xF1, 0x9E, 0xA4, 0xF1, 0xAE, 0x94, 0xF1, 0xF4, 0x9E, 0xA1, 0xF4, 0xAE, 0x91,
+    0xF4, 0xF2, 0xF3, 0x9E, 0xA2, 0xF9, 0x19, 0xF3, 0xAF, 0xAA, 0xF5, 0xFF, 0xC7, 0xAF, 0xCA, 0x72,
+    0x99, 0x70, 0x77, 0x77, 0x0A, 0xD7, 0x70, 0xAF, 0x76, 0xAF, 0xD7, 0x4A, 0xE0, 0xEA, 0x72, 0xEA,
+    0x2E, 0x72, 0xAC, 0x94, 0xA9, 0x77, 0x77, 0x19, 0xAA, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0F, 0xFF,
+    0x95, 0x9F, 0xDA, 0xAF, 0xD5, 0xFC, 0x93, 0xAF, 0xA3, 0xFC, 0x6F, 0xC2, 0xAF, 0x96, 0xAF, 0x91,
+    0xFC, 0x79, 0xF9, 0x09, 0xF9, 0x79, 0xFA, 0x0A, 0xF7, 0x09, 0xF9, 0x0F, 0xC7, 0x09, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC1, 0xFC, 0x70, 0xFA, 0x1F, 0xC7, 0xAF, 0x91, 0xFC, 0x7F,
+    0xC2, 0xAF, 0xA5, 0xFC, 0x4F, 0xCA, 0x29, 0xFC, 0x94, 0xAF, 0xFF, 0xC9, 0x6A, 0xFF, 0xE7, 0x19,
+    0xAF, 0xDA, 0x97, 0x69, 0x77, 0x77, 0x69, 0xCA, 0x77, 0x09, 0xEA, 0x77, 0xF9, 0x77, 0xF7, 0x70,
+    0x9A, 0xA7, 0x40, 0x71, 0xAA, 0xA7, 0x2F, 0x97, 0x0A, 0xFC, 0x79, 0xDA, 0xAD, 0x95, 0x9E, 0x1E,
+    0x5E, 0x29, 0xD5, 0x9A, 0x4A, 0x77, 0x79, 0x99, 0x70, 0x9F, 0xE5, 0xAF, 0xFC, 0x3A, 0xF9, 0xAF,
+    0x91, 0x9E, 0xA2, 0xAF, 0x1F, 0x39, 0xF0, 0x9E, 0xA4, 0xF0, 0xAE, 0x94, 0xF0, 0xF4, 0x9E, 0xA0,
+    0xF4, 0xAE, 0x90, 0xF4, 0xF1, 0xF3, 0x9E, 0xA1, 0xF9, 0x19, 0xF2, 0xAF, 0xAA, 0xF4, 0xFF, 0xC6,
+    0xAF, 0xCA, 0x71, 0x99, 0x77, 0x72, 0x9A, 0x97, 0x2A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0x9A, 0x97,
+    0x00, 0x77, 0x77, 0x69, 0xC7, 0x74, 0xE9, 0x77, 0x19, 0xF9, 0x77, 0x0F, 0xCA, 0x77, 0x0F, 0xA9,
+    0x3A, 0xD9, 0x71, 0xAA, 0x96, 0xEA, 0x77, 0x29, 0xEA, 0x71, 0x9A, 0xAA, 0x93, 0xAE, 0x79, 0xFF,
+    0xC9, 0xAE, 0x96, 0xFF, 0xFE, 0x69, 0xFD, 0xAA, 0xFD, 0xA7, 0xFC, 0x93, 0xAF, 0xA6, 0xFC, 0x6F,
+    0xC5, 0xAF, 0x96, 0xAF, 0x94, 0xFC, 0x79, 0xF9, 0x39, 0xF9, 0x79, 0xFA, 0x3A, 0xF7, 0x09, 0xF9,
+    0x3F, 0xC7, 0x09, 0xF9, 0x3F, 0xC7, 0x0A, 0xF9, 0x3F, 0xC7, 0x0F, 0xC4, 0xFC, 0x70, 0xFA, 0x4F,
+    0xC7, 0xAF, 0x94, 0xFC, 0x7F, 0xC5, 0xAF, 0xA5, 0xFC, 0x7F, 0xCA, 0x29, 0xFC, 0x97, 0xAF, 0xFF,
+    0xC9, 0x71, 0xAF, 0xFE, 0x74, 0x9A, 0xFD, 0xA9, 0x77, 0x19, 0x76, 0x73, 0xA7, 0x7A, 0xD7, 0x6E,
+    0x75, 0xF7, 0x4A, 0xE7, 0x5E, 0x76, 0xD3, 0x99, 0x76, 0xAD, 0xA7, 0x5A, 0xDA, 0x79, 0x99, 0x2E,
+    0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94, 0x9E, 0xA2, 0xAF, 0x4F, 0x39, 0xF3,
+    0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4, 0xAE, 0x93, 0xF4, 0xF4, 0xF3, 0x9E,
+    0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC, 0xA7, 0x49, 0x97, 0x20, 0x77,
+    0x77, 0x0A, 0xA7, 0x74, 0x9E, 0x77, 0x39, 0xF9, 0x77, 0x2A, 0xFA, 0x77, 0x3A, 0xE9, 0x3A, 0xD9,
+    0x74, 0x9A, 0x4E, 0xA7, 0x72, 0x9E, 0xA7, 0x19, 0xAA, 0xA9, 0x3A, 0xE7, 0x9F, 0xFC, 0x9A, 0xE9,
+    0x6F, 0xFF, 0xE6, 0x9F, 0xDA, 0xAF, 0xDA, 0x7F, 0xC9, 0x3A, 0xFA, 0x6F, 0xC6, 0xFC, 0x5A, 0xF9,
+    0x6A, 0xF9, 0x4F, 0xC7, 0x9F, 0x93, 0x9F, 0x97, 0x9F, 0xA3, 0xAF, 0x70, 0x9F, 0x93, 0xFC, 0x70,
+    0x9F, 0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFC, 0x7A, 0xF9,
+    0x4F, 0xC7, 0xFC, 0x5A, 0xFA, 0x5F, 0xC7, 0xFC, 0xA2, 0x9F, 0xC9, 0x7A, 0xFF, 0xFC, 0x97, 0x1A,
+    0xFF, 0xE7, 0x49, 0xAF, 0xDA, 0x97, 0x71, 0x97, 0x60, 0x77, 0x7A, 0xC7, 0x69, 0xDA, 0x75, 0x9E,
+    0x97, 0x5F, 0x76, 0xAE, 0x76, 0xAD, 0x39, 0x97, 0x19, 0x92, 0xAD, 0xA7, 0x5A, 0xDA, 0x79, 0x99,
+    0x2E, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94, 0x9E, 0xA2, 0xAF, 0x4F, 0x39,
+    0xF3, 0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4, 0xAE, 0x93, 0xF4, 0xF4, 0xF3,
+    0x9E, 0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC, 0xA7, 0x49, 0x97, 0x20,
+    0x75, 0x97, 0x73, 0xAF, 0x97, 0x70, 0xEA, 0xE7, 0x79, 0xD1, 0xAD, 0x77, 0x0A, 0x91, 0xE7, 0x72,
+    0x9E, 0x77, 0x2D, 0xA9, 0x4A, 0xD9, 0x72, 0xD6, 0xEA, 0x73, 0x95, 0x9E, 0xA7, 0x19, 0xAA, 0xA9,
+    0x3A, 0xE7, 0x9F, 0xFC, 0x9A, 0xE9, 0x6F, 0xFF, 0xE6, 0x9F, 0xDA, 0xAF, 0xDA, 0x7F, 0xC9, 0x3A,
+    0xFA, 0x6F, 0xC6, 0xFC, 0x5A, 0xF9, 0x6A, 0xF9, 0x4F, 0xC7, 0x9F, 0x93, 0x9F, 0x97, 0x9F, 0xA3,
+    0xAF, 0x70, 0x9F, 0x93, 0xFC, 0x70, 0x9F, 0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFC, 0x70, 0xFC, 0x4F,
+    0xC7, 0x0F, 0xA4, 0xFC, 0x7A, 0xF9, 0x4F, 0xC7, 0xFC, 0x5A, 0xFA, 0x5F, 0xC7, 0xFC, 0xA2, 0x9F,
+    0xC9, 0x7A, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xE7, 0x49, 0xAF, 0xDA, 0x97, 0x71, 0x97, 0x60, 0x70,
+    0x99, 0x97, 0x4A, 0xFC, 0x72, 0x9D, 0xAA, 0xDA, 0x71, 0xAC, 0xA1, 0xDA, 0x72, 0xA1, 0x9D, 0x97,
+    0x4A, 0xD9, 0x74, 0xE7, 0x6D, 0x49, 0x97, 0x0A, 0x93, 0xAD, 0xA7, 0x5A, 0xDA, 0x79, 0x99, 0x2E,
+    0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94, 0x9E, 0xA2, 0xAF, 0x4F, 0x39, 0xF3,
+    0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4, 0xAE, 0x93, 0xF4, 0xF4, 0xF3, 0x9E,
+    0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC, 0xA7, 0x49, 0x97, 0x20, 0x72,
+    0x97, 0x74, 0xAE, 0x91, 0xD7, 0x59, 0xFC, 0xAE, 0x75, 0xE9, 0xFC, 0x97, 0x59, 0xC2, 0xE9, 0x2A,
+    0xD9, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0xA7, 0x19, 0xAA, 0xA9, 0x3A, 0xE7, 0x9F, 0xFC, 0x9A, 0xE9,
+    0x6F, 0xFF, 0xE6, 0x9F, 0xDA, 0xAF, 0xDA, 0x7F, 0xC9, 0x3A, 0xFA, 0x6F, 0xC6, 0xFC, 0x5A, 0xF9,
+    0x6A, 0xF9, 0x4F, 0xC7, 0x9F, 0x93, 0x9F, 0x97, 0x9F, 0xA3, 0xAF, 0x70, 0x9F, 0x93, 0xFC, 0x70,
+    0x9F, 0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFC, 0x7A, 0xF9,
+    0x4F, 0xC7, 0xFC, 0x5A, 0xFA, 0x5F, 0xC7, 0xFC, 0xA2, 0x9F, 0xC9, 0x7A, 0xFF, 0xFC, 0x97, 0x1A,
+    0xFF, 0xE7, 0x49, 0xAF, 0xDA, 0x97, 0x71, 0x97, 0x60, 0x6A, 0xA9, 0x2A, 0x70, 0x9F, 0x90, 0xAC,
+    0xA7, 0xFF, 0xC9, 0x7D, 0x1F, 0xC7, 0x09, 0x92, 0xAC, 0x91, 0x99, 0x76, 0xAD, 0xA7, 0x5A, 0xDA,
+    0x79, 0x99, 0x2E, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94, 0x9E, 0xA2, 0xAF,
+    0x4F, 0x39, 0xF3, 0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4, 0xAE, 0x93, 0xF4,
+    0xF4, 0xF3, 0x9E, 0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A, 0xFC, 0xA7, 0x49,
+    0x97, 0x20, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0xA7, 0x19, 0xAA, 0xA9, 0x3A, 0xE7,
+    0x9F, 0xFC, 0x9A, 0xE9, 0x6F, 0xFF, 0xE6, 0x9F, 0xDA, 0xAF, 0xDA, 0x7F, 0xC9, 0x3A, 0xFA, 0x6F,
+    0xC6, 0xFC, 0x5A, 0xF9, 0x6A, 0xF9, 0x4F, 0xC7, 0x9F, 0x93, 0x9F, 0x97, 0x9F, 0xA3, 0xAF, 0x70,
+    0x9F, 0x93, 0xFC, 0x70, 0x9F, 0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F,
+    0xA4, 0xFC, 0x7A, 0xF9, 0x4F, 0xC7, 0xFC, 0x5A, 0xFA, 0x5F, 0xC7, 0xFC, 0xA2, 0x9F, 0xC9, 0x7A,
+    0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xE7, 0x49, 0xAF, 0xDA, 0x97, 0x71, 0x97, 0x77, 0x77, 0x49, 0xCA,
+    0x77, 0x39, 0xEA, 0x77, 0x2F, 0x97, 0x72, 0xF7, 0x73, 0x9A, 0xA7, 0x70, 0x76, 0x99, 0x76, 0xAD,
+    0xA7, 0x5A, 0xDA, 0x79, 0x99, 0x2E, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4A, 0xF9, 0xAF, 0x94,
+    0x9E, 0xA2, 0xAF, 0x4F, 0x39, 0xF3, 0x9E, 0xA4, 0xF3, 0xAE, 0x94, 0xF3, 0xF4, 0x9E, 0xA3, 0xF4,
+    0xAE, 0x93, 0xF4, 0xF4, 0xF3, 0x9E, 0xA4, 0xF9, 0x19, 0xF5, 0xAF, 0xAA, 0xF7, 0xFF, 0xC7, 0x1A,
+    0xFC, 0xA7, 0x49, 0x97, 0x77, 0x70, 0x9A, 0x97, 0x5A, 0xE7, 0x5F, 0x75, 0xEA, 0x75, 0x9A, 0x97,
+    0x30, 0x77, 0x6F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9, 0x19, 0xFA, 0x59, 0xF9, 0x39, 0xF7,
+    0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA,
+    0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x49,
+    0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF, 0x96, 0xFF, 0xFC, 0xA7, 0x0F, 0xFE,
+    0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x77, 0x77, 0x1A, 0xC9, 0x77, 0x1F, 0x77, 0x09, 0xF7, 0x70,
+    0x9E, 0x97, 0x71, 0xAA, 0x97, 0x50, 0x39, 0x97, 0x99, 0x29, 0xFC, 0x93, 0xF2, 0xFD, 0xA3, 0xF2,
+    0x99, 0xAE, 0x92, 0x9E, 0xA4, 0x9E, 0x3A, 0xE9, 0x4A, 0xE3, 0xF5, 0xF3, 0xF4, 0x9E, 0x92, 0x9E,
+    0xA4, 0xAE, 0x3F, 0x94, 0xF2, 0x9F, 0x5E, 0xA2, 0xFC, 0x49, 0xE9, 0x1A, 0xFC, 0x19, 0x1A, 0xE1,
+    0xAD, 0x9E, 0x9D, 0x1A, 0xFE, 0x0A, 0xFD, 0x1A, 0xFD, 0x19, 0xFC, 0x3F, 0xA3, 0xEA, 0x69, 0x77,
+    0x77, 0x4A, 0xA7, 0x6E, 0xA7, 0x49, 0xEA, 0x74, 0x9E, 0x97, 0x5A, 0xA9, 0x71, 0x74, 0x97, 0x71,
+    0xAF, 0xA7, 0x6E, 0xAE, 0x97, 0x49, 0xD1, 0x9D, 0x97, 0x5A, 0x91, 0xAD, 0x77, 0x09, 0xE7, 0x70,
+    0xE9, 0x77, 0x1A, 0xC9, 0x77, 0x39, 0x77, 0x77, 0x0F, 0xFC, 0x2F, 0xFC, 0x0F, 0xFA, 0x2F, 0xF9,
+    0x19, 0xFA, 0x59, 0xF9, 0x39, 0xF7, 0xF4, 0xAF, 0x69, 0xEA, 0x4A, 0xEA, 0x6A, 0xE9, 0x4F, 0x96,
+    0xAE, 0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x4A, 0xF6, 0x9E, 0x94, 0xFA, 0x6A, 0xE9, 0x4F, 0x96, 0xAE,
+    0x5F, 0x7F, 0x49, 0xF7, 0xEA, 0x49, 0xF6, 0xAE, 0x59, 0xF9, 0x49, 0xF5, 0x9F, 0xC9, 0x19, 0xAF,
+    0x96, 0xFF, 0xFC, 0xA7, 0x0F, 0xFE, 0x97, 0x2A, 0xFE, 0xA7, 0x79, 0x97, 0x50, 0x71, 0x99, 0x97,
+    0x4A, 0xFC, 0x72, 0xAD, 0xAE, 0xA7, 0x1D, 0x91, 0xDA, 0x71, 0x9A, 0x1A, 0xD7, 0x5A, 0xD9, 0x73,
+    0x9D, 0xA7, 0x6D, 0x77, 0xA9, 0x77, 0x74, 0x99, 0x79, 0x92, 0x9F, 0xC9, 0x3F, 0x2F, 0xDA, 0x3F,
+    0x29, 0x9A, 0xE9, 0x29, 0xEA, 0x49, 0xE3, 0xAE, 0x94, 0xAE, 0x3F, 0x5F, 0x3F, 0x49, 0xE9, 0x29,
+    0xEA, 0x4A, 0xE3, 0xF9, 0x4F, 0x29, 0xF5, 0xEA, 0x2F, 0xC4, 0x9E, 0x91, 0xAF, 0xC1, 0x91, 0xAE,
+    0x1A, 0xD9, 0xE9, 0xD1, 0xAF, 0xE0, 0xAF, 0xD1, 0xAF, 0xD1, 0x9F, 0xC3, 0xFA, 0x3E, 0xA6, 0x97,
+    0x40, 0x77, 0x77, 0x79, 0xC7, 0x76, 0xAD, 0xA7, 0x73, 0x9F, 0xA7, 0x72, 0xAF, 0xC7, 0x72, 0xAF,
+    0x95, 0x9A, 0xCA, 0x71, 0x9A, 0x97, 0x0A, 0xE7, 0x75, 0xF7, 0x73, 0x9F, 0x91, 0xFF, 0xC2, 0xFF,
+    0xD9, 0x2F, 0xFA, 0x2F, 0xFA, 0x59, 0xFA, 0x59, 0xF7, 0x09, 0xF7, 0xF7, 0x0A, 0xF6, 0x9E, 0xA7,
+    0x0A, 0xEA, 0x6A, 0xE9, 0x70, 0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70, 0x9F, 0x7E, 0xA7, 0x0A, 0xF6,
+    0x9E, 0x97, 0x0F, 0xA6, 0xAE, 0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7, 0xEA, 0x70,
+    0x9F, 0x6A, 0xE7, 0x19, 0xF9, 0x49, 0xF7, 0x19, 0xFC, 0x91, 0x9A, 0xF9, 0x72, 0xFF, 0xFC, 0xA7,
+    0x4F, 0xFE, 0x97, 0x6A, 0xFE, 0xA7, 0x73, 0x99, 0x77, 0x10, 0x74, 0x97, 0x72, 0xAC, 0xA7, 0x70,
+    0x9E, 0x77, 0x0F, 0x77, 0xAE, 0x77, 0x0E, 0x77, 0x1D, 0x59, 0x97, 0x29, 0x5E, 0x77, 0x1E, 0x49,
+    0x97, 0x9A, 0xE9, 0x19, 0xFC, 0x93, 0xAF, 0xC9, 0x2F, 0xDA, 0x3F, 0x59, 0x9A, 0xE9, 0x29, 0xEA,
+    0x79, 0xE3, 0xAE, 0x97, 0xAE, 0x3F, 0x70, 0xEA, 0x3F, 0x79, 0xE9, 0x29, 0xEA, 0x7A, 0xE3, 0xF9,
+    0x7F, 0x29, 0xF7, 0x0E, 0xA2, 0xFC, 0x79, 0xE9, 0x1A, 0xFC, 0x19, 0x4A, 0xE1, 0xAD, 0x9E, 0x9D,
+    0x4A, 0xFE, 0x0A, 0xFD, 0x4A, 0xFD, 0x19, 0xFC, 0x6F, 0xA3, 0xEA, 0x71, 0x97, 0x70, 0x77, 0x77,
+    0x19, 0xC7, 0x77, 0xE9, 0x77, 0x5F, 0xA7, 0x74, 0xAF, 0xA7, 0x75, 0xAE, 0x95, 0x9A, 0xCA, 0x74,
+    0x9A, 0x6A, 0xE7, 0x75, 0xF7, 0x73, 0x9F, 0x91, 0xFF, 0xC2, 0xFF, 0xD9, 0x2F, 0xFA, 0x2F, 0xFA,
+    0x59, 0xFA, 0x59, 0xF7, 0x09, 0xF7, 0xF7, 0x0A, 0xF6, 0x9E, 0xA7, 0x0A, 0xEA, 0x6A, 0xE9, 0x70,
+    0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70, 0x9F, 0x7E, 0xA7, 0x0A, 0xF6, 0x9E, 0x97, 0x0F, 0xA6, 0xAE,
+    0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7, 0xEA, 0x70, 0x9F, 0x6A, 0xE7, 0x19, 0xF9,
+    0x49, 0xF7, 0x19, 0xFC, 0x91, 0x9A, 0xF9, 0x72, 0xFF, 0xFC, 0xA7, 0x4F, 0xFE, 0x97, 0x6A, 0xFE,
+    0xA7, 0x73, 0x99, 0x77, 0x10, 0x77, 0x73, 0xAC, 0x77, 0x19, 0xDA, 0x77, 0x0A, 0xE9, 0x77, 0x0F,
+    0x77, 0x1E, 0xA7, 0x71, 0xAD, 0x59, 0x97, 0x29, 0x94, 0xE7, 0x71, 0xE4, 0x99, 0x79, 0xAE, 0x91,
+    0x9F, 0xC9, 0x3A, 0xFC, 0x92, 0xFD, 0xA3, 0xF5, 0x99, 0xAE, 0x92, 0x9E, 0xA7, 0x9E, 0x3A, 0xE9,
+    0x7A, 0xE3, 0xF7, 0x0E, 0xA3, 0xF7, 0x9E, 0x92, 0x9E, 0xA7, 0xAE, 0x3F, 0x97, 0xF2, 0x9F, 0x70,
+    0xEA, 0x2F, 0xC7, 0x9E, 0x91, 0xAF, 0xC1, 0x94, 0xAE, 0x1A, 0xD9, 0xE9, 0xD4, 0xAF, 0xE0, 0xAF,
+    0xD4, 0xAF, 0xD1, 0x9F, 0xC6, 0xFA, 0x3E, 0xA7, 0x19, 0x77, 0x74, 0x97, 0x75, 0xAF, 0xA7, 0x72,
+    0xEA, 0xE9, 0x77, 0x09, 0xD1, 0x9D, 0x97, 0x71, 0xA9, 0x1A, 0xD7, 0x74, 0x9E, 0x77, 0x4E, 0x96,
+    0x9A, 0xCA, 0x72, 0xAC, 0x97, 0xAE, 0x73, 0x97, 0x0F, 0x77, 0x39, 0xF9, 0x1F, 0xFC, 0x2F, 0xFD,
+    0x92, 0xFF, 0xA2, 0xFF, 0xA5, 0x9F, 0xA5, 0x9F, 0x70, 0x9F, 0x7F, 0x70, 0xAF, 0x69, 0xEA, 0x70,
+    0xAE, 0xA6, 0xAE, 0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7, 0xEA, 0x70, 0xAF, 0x69,
+    0xE9, 0x70, 0xFA, 0x6A, 0xE9, 0x70, 0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70, 0x9F, 0x7E, 0xA7, 0x09,
+    0xF6, 0xAE, 0x71, 0x9F, 0x94, 0x9F, 0x71, 0x9F, 0xC9, 0x19, 0xAF, 0x97, 0x2F, 0xFF, 0xCA, 0x74,
+    0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x71, 0x99, 0x97, 0x7A, 0xFC, 0x75, 0xAD,
+    0xAE, 0xA7, 0x4D, 0x91, 0xDA, 0x74, 0x9A, 0x1A, 0xD7, 0x70, 0xAD, 0x97, 0x69, 0xDA, 0x77, 0x1D,
+    0x69, 0x97, 0x1A, 0x95, 0xE7, 0x71, 0xE4, 0x99, 0x79, 0xAE, 0x91, 0x9F, 0xC9, 0x3A, 0xFC, 0x92,
+    0xFD, 0xA3, 0xF5, 0x99, 0xAE, 0x92, 0x9E, 0xA7, 0x9E, 0x3A, 0xE9, 0x7A, 0xE3, 0xF7, 0x0E, 0xA3,
+    0xF7, 0x9E, 0x92, 0x9E, 0xA7, 0xAE, 0x3F, 0x97, 0xF2, 0x9F, 0x70, 0xEA, 0x2F, 0xC7, 0x9E, 0x91,
+    0xAF, 0xC1, 0x94, 0xAE, 0x1A, 0xD9, 0xE9, 0xD4, 0xAF, 0xE0, 0xAF, 0xD4, 0xAF, 0xD1, 0x9F, 0xC6,
+    0xFA, 0x3E, 0xA7, 0x19, 0x77, 0x71, 0x97, 0x76, 0x9E, 0xA1, 0xD7, 0x70, 0xFC, 0xAE, 0x77, 0xAD,
+    0x9F, 0xCA, 0x77, 0x9C, 0x91, 0xEA, 0x49, 0xAC, 0xA7, 0x75, 0xAE, 0x77, 0x5F, 0x77, 0x39, 0xF9,
+    0x1F, 0xFC, 0x2F, 0xFD, 0x92, 0xFF, 0xA2, 0xFF, 0xA5, 0x9F, 0xA5, 0x9F, 0x70, 0x9F, 0x7F, 0x70,
+    0xAF, 0x69, 0xEA, 0x70, 0xAE, 0xA6, 0xAE, 0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7,
+    0xEA, 0x70, 0xAF, 0x69, 0xE9, 0x70, 0xFA, 0x6A, 0xE9, 0x70, 0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70,
+    0x9F, 0x7E, 0xA7, 0x09, 0xF6, 0xAE, 0x71, 0x9F, 0x94, 0x9F, 0x71, 0x9F, 0xC9, 0x19, 0xAF, 0x97,
+    0x2F, 0xFF, 0xCA, 0x74, 0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x69, 0xAA, 0x92,
+    0x97, 0x39, 0xF1, 0xD9, 0x72, 0xFF, 0xC9, 0x72, 0xD1, 0xFA, 0x73, 0x99, 0x19, 0xAC, 0x93, 0x99,
+    0x77, 0x1E, 0x77, 0x1E, 0x49, 0x97, 0x9A, 0xE9, 0x19, 0xFC, 0x93, 0xAF, 0xC9, 0x2F, 0xDA, 0x3F,
+    0x59, 0x9A, 0xE9, 0x29, 0xEA, 0x79, 0xE3, 0xAE, 0x97, 0xAE, 0x3F, 0x70, 0xEA, 0x3F, 0x79, 0xE9,
+    0x29, 0xEA, 0x7A, 0xE3, 0xF9, 0x7F, 0x29, 0xF7, 0x0E, 0xA2, 0xFC, 0x79, 0xE9, 0x1A, 0xFC, 0x19,
+    0x4A, 0xE1, 0xAD, 0x9E, 0x9D, 0x4A, 0xFE, 0x0A, 0xFD, 0x4A, 0xFD, 0x19, 0xFC, 0x6F, 0xA3, 0xEA,
+    0x71, 0x97, 0x70, 0x77, 0x49, 0xAC, 0xA7, 0x75, 0xAE, 0x77, 0x5F, 0x77, 0x39, 0xF9, 0x1F, 0xFC,
+    0x2F, 0xFD, 0x92, 0xFF, 0xA2, 0xFF, 0xA5, 0x9F, 0xA5, 0x9F, 0x70, 0x9F, 0x7F, 0x70, 0xAF, 0x69,
+    0xEA, 0x70, 0xAE, 0xA6, 0xAE, 0x97, 0x0F, 0x96, 0xAE, 0x71, 0xF7, 0xF7, 0x09, 0xF7, 0xEA, 0x70,
+    0xAF, 0x69, 0xE9, 0x70, 0xFA, 0x6A, 0xE9, 0x70, 0xF9, 0x6A, 0xE7, 0x1F, 0x7F, 0x70, 0x9F, 0x7E,
+    0xA7, 0x09, 0xF6, 0xAE, 0x71, 0x9F, 0x94, 0x9F, 0x71, 0x9F, 0xC9, 0x19, 0xAF, 0x97, 0x2F, 0xFF,
+    0xCA, 0x74, 0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x77, 0x77, 0x71, 0xAC, 0x97, 0x75,
+    0xF7, 0x74, 0x9F, 0x77, 0x49, 0xE9, 0x77, 0x5A, 0xA9, 0x77, 0x10, 0x77, 0x19, 0x97, 0x71, 0xE7,
+    0x71, 0xE4, 0x99, 0x79, 0xAE, 0x91, 0x9F, 0xC9, 0x3A, 0xFC, 0x92, 0xFD, 0xA3, 0xF5, 0x99, 0xAE,
+    0x92, 0x9E, 0xA7, 0x9E, 0x3A, 0xE9, 0x7A, 0xE3, 0xF7, 0x0E, 0xA3, 0xF7, 0x9E, 0x92, 0x9E, 0xA7,
+    0xAE, 0x3F, 0x97, 0xF2, 0x9F, 0x70, 0xEA, 0x2F, 0xC7, 0x9E, 0x91, 0xAF, 0xC1, 0x94, 0xAE, 0x1A,
+    0xD9, 0xE9, 0xD4, 0xAF, 0xE0, 0xAF, 0xD4, 0xAF, 0xD1, 0x9F, 0xC6, 0xFA, 0x3E, 0xA7, 0x19, 0x77,
+    0x77, 0x72, 0xAA, 0x77, 0x1E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0x97, 0x70, 0xAA, 0x97, 0x40, 0x77,
+    0x73, 0x9C, 0x97, 0x71, 0xE9, 0x77, 0x0F, 0xA7, 0x79, 0xFC, 0x77, 0x09, 0xEA, 0x77, 0x19, 0xA9,
+    0x77, 0x77, 0x77, 0x1F, 0xF9, 0x1F, 0xF1, 0xFF, 0x2F, 0xE9, 0x2F, 0xC5, 0xAE, 0xA4, 0x9F, 0x5E,
+    0xA6, 0xF9, 0x3F, 0x7A, 0xEA, 0x29, 0xE7, 0x1F, 0x2E, 0x97, 0x1F, 0x90, 0xEA, 0x72, 0xAE, 0xAA,
+    0xE7, 0x4F, 0xE7, 0x5F, 0xD9, 0x75, 0x9F, 0xA7, 0x7F, 0x77, 0x9F, 0x77, 0xAE, 0xA7, 0x7F, 0xA7,
+    0x7F, 0x97, 0x6A, 0xFA, 0x97, 0x3F, 0xFC, 0x97, 0x2F, 0xFC, 0x71, 0x77, 0x75, 0x9C, 0x77, 0x1E,
+    0x77, 0x9E, 0xA7, 0x7F, 0x97, 0x7A, 0xE7, 0x70, 0x9D, 0x97, 0x71, 0xA7, 0x77, 0x70, 0x99, 0x59,
+    0x97, 0xAF, 0x92, 0xF9, 0x49, 0xFD, 0x2A, 0xEA, 0x49, 0x9A, 0xF2, 0x9F, 0x7A, 0xE9, 0x2E, 0xA7,
+    0x9E, 0x91, 0x9E, 0x97, 0x0E, 0xA1, 0x9E, 0x71, 0xEA, 0x1A, 0xDA, 0x71, 0xEA, 0x1E, 0x97, 0x1A,
+    0xE0, 0x9E, 0x72, 0xAE, 0x0E, 0x97, 0x29, 0xE9, 0xDA, 0x73, 0x9F, 0xD7, 0x49, 0xFC, 0x97, 0x49,
+    0xFA, 0x75, 0x9F, 0x76, 0xF7, 0x69, 0xE7, 0x1A, 0x39, 0xE9, 0x70, 0xAD, 0xAA, 0xF9, 0x71, 0xFF,
+    0x73, 0xFD, 0xA7, 0x5A, 0xDA, 0x75, 0x77, 0x5F, 0xF9, 0x1F, 0xF1, 0xFF, 0x2F, 0xE9, 0x2F, 0xC5,
+    0xAE, 0xA4, 0x9F, 0x5E, 0xA6, 0xF9, 0x3F, 0x7A, 0xEA, 0x29, 0xE7, 0x1F, 0x2E, 0x97, 0x1F, 0x90,
+    0xEA, 0x72, 0xAE, 0xAA, 0xE7, 0x4F, 0xE7, 0x5F, 0xD9, 0x75, 0x9F, 0xA7, 0x7F, 0x77, 0x9F, 0x77,
+    0xAE, 0xA7, 0x7F, 0xA7, 0x7F, 0x97, 0x6A, 0xFA, 0x97, 0x3F, 0xFC, 0x97, 0x2F, 0xFC, 0x77, 0x77,
+    0x77, 0x79, 0xCA, 0x77, 0x0A, 0xE9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0x9A, 0xA7, 0x60, 0x79, 0x95,
+    0x99, 0x7A, 0xF9, 0x2F, 0x94, 0x9F, 0xD2, 0xAE, 0xA4, 0x99, 0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA,
+    0x79, 0xE9, 0x19, 0xE9, 0x70, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71,
+    0xAE, 0x09, 0xE7, 0x2A, 0xE0, 0xE9, 0x72, 0x9E, 0x9D, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74,
+    0x9F, 0xA7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0x71, 0xA3, 0x9E, 0x93, 0x9A, 0x91, 0xAD, 0xAA, 0xF9,
+    0x3A, 0xE1, 0xFF, 0x5F, 0x1F, 0xDA, 0x6E, 0xA2, 0xAD, 0xA7, 0x0A, 0xA9, 0x10, 0x73, 0x97, 0x70,
+    0xAF, 0xC7, 0x5A, 0xDA, 0xE9, 0x74, 0xD9, 0x09, 0xD9, 0x74, 0x9A, 0x1A, 0xD7, 0x79, 0xAD, 0x97,
+    0x6A, 0xD9, 0x77, 0x09, 0xCA, 0x77, 0x29, 0x77, 0x77, 0xFF, 0x91, 0xFF, 0x1F, 0xF2, 0xFE, 0x92,
+    0xFC, 0x5A, 0xEA, 0x49, 0xF5, 0xEA, 0x6F, 0x93, 0xF7, 0xAE, 0xA2, 0x9E, 0x71, 0xF2, 0xE9, 0x71,
+    0xF9, 0x0E, 0xA7, 0x2A, 0xEA, 0xAE, 0x74, 0xFE, 0x75, 0xFD, 0x97, 0x59, 0xFA, 0x77, 0xF7, 0x79,
+    0xF7, 0x7A, 0xEA, 0x77, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0xA9, 0x73, 0xFF, 0xC9, 0x72, 0xFF, 0xC7,
+    0x10, 0x74, 0x99, 0x97, 0x69, 0xFC, 0x97, 0x39, 0xDA, 0xAD, 0xA7, 0x3A, 0xCA, 0x1D, 0xA7, 0x4A,
+    0x19, 0xD9, 0x76, 0x9D, 0xA7, 0x6E, 0x97, 0x7D, 0x77, 0x19, 0x97, 0x77, 0x71, 0x99, 0x59, 0x97,
+    0xAF, 0x92, 0xF9, 0x49, 0xFD, 0x2A, 0xEA, 0x49, 0x9A, 0xF2, 0x9F, 0x7A, 0xE9, 0x2E, 0xA7, 0x9E,
+    0x91, 0x9E, 0x97, 0x0E, 0xA1, 0x9E, 0x71, 0xEA, 0x1A, 0xDA, 0x71, 0xEA, 0x1E, 0x97, 0x1A, 0xE0,
+    0x9E, 0x72, 0xAE, 0x0E, 0x97, 0x29, 0xE9, 0xDA, 0x73, 0x9F, 0xD7, 0x49, 0xFC, 0x97, 0x49, 0xFA,
+    0x75, 0x9F, 0x76, 0xF7, 0x69, 0xE7, 0x1A, 0x39, 0xE9, 0x70, 0xAD, 0xAA, 0xF9, 0x71, 0xFF, 0x73,
+    0xFD, 0xA7, 0x5A, 0xDA, 0x75, 0x70, 0x99, 0x77, 0x09, 0xEA, 0x1A, 0xC7, 0x3F, 0xFC, 0x97, 0x19,
+    0xD9, 0xAF, 0xC7, 0x3C, 0xA1, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x75, 0xFF, 0x91, 0xFF, 0x1F, 0xF2,
+    0xFE, 0x92, 0xFC, 0x5A, 0xEA, 0x49, 0xF5, 0xEA, 0x6F, 0x93, 0xF7, 0xAE, 0xA2, 0x9E, 0x71, 0xF2,
+    0xE9, 0x71, 0xF9, 0x0E, 0xA7, 0x2A, 0xEA, 0xAE, 0x74, 0xFE, 0x75, 0xFD, 0x97, 0x59, 0xFA, 0x77,
+    0xF7, 0x79, 0xF7, 0x7A, 0xEA, 0x77, 0xFA, 0x77, 0xF9, 0x76, 0xAF, 0xA9, 0x73, 0xFF, 0xC9, 0x72,
+    0xFF, 0xC7, 0x10, 0x72, 0xAA, 0x92, 0xA7, 0x29, 0xF9, 0x0A, 0xCA, 0x71, 0xFF, 0xCA, 0x71, 0xD1,
+    0xFC, 0x72, 0x9A, 0x2A, 0xCA, 0x77, 0x77, 0x77, 0x29, 0x95, 0x99, 0x7A, 0xF9, 0x2F, 0x94, 0x9F,
+    0xD2, 0xAE, 0xA4, 0x99, 0xAF, 0x29, 0xF7, 0xAE, 0x92, 0xEA, 0x79, 0xE9, 0x19, 0xE9, 0x70, 0xEA,
+    0x19, 0xE7, 0x1E, 0xA1, 0xAD, 0xA7, 0x1E, 0xA1, 0xE9, 0x71, 0xAE, 0x09, 0xE7, 0x2A, 0xE0, 0xE9,
+    0x72, 0x9E, 0x9D, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74, 0x9F, 0xA7, 0x59, 0xF7, 0x6F, 0x76,
+    0x9E, 0x71, 0xA3, 0x9E, 0x97, 0x0A, 0xDA, 0xAF, 0x97, 0x1F, 0xF7, 0x3F, 0xDA, 0x75, 0xAD, 0xA7,
+    0x50, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x99, 0x19, 0x99, 0xC9, 0x9C, 0x90, 0x9D,
+    0x92, 0xD2, 0xF0, 0x99, 0xAA, 0x99, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA7, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A, 0xAA, 0xAA, 0xAD, 0x9A, 0xCA,
+    0xAA, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA, 0x19, 0xC9, 0x2A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74, 0x9C, 0x95, 0x9C, 0x95, 0x9C,
+    0x69, 0xDA, 0xAA, 0xAA, 0xA9, 0x9D, 0xAA, 0xAA, 0xAC, 0xA0, 0x9C, 0x93, 0x9A, 0x19, 0xC9, 0x29,
+    0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x10,
+    0x71, 0xAF, 0xF0, 0xFF, 0xC0, 0xFF, 0xC7, 0x20, 0x71, 0xAF, 0xF0, 0xFF, 0xC0, 0xFF, 0xC7, 0x20,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0x90, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x09, 0x99, 0x29, 0x99, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A,
+    0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x09, 0xAA, 0xA1, 0x9A,
+    0xAA, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA7, 0x77,
+    0x5F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAF, 0xFF, 0xD9, 0x49, 0x39, 0xD9, 0x19, 0xE2, 0xE2, 0xAD, 0xA2,
+    0xE9, 0x19, 0xE2, 0x9E, 0x91, 0x9E, 0xA2, 0x99, 0x30, 0x39, 0x94, 0xF3, 0xF3, 0xAE, 0x3E, 0xA3,
+    0xE3, 0xAD, 0xA3, 0xE3, 0xE5, 0x94, 0x2A, 0xC9, 0x2F, 0x2A, 0xE2, 0xAE, 0x2A, 0xDA, 0x2E, 0x2A,
+    0xDA, 0x19, 0xE2, 0xAC, 0xA7, 0x20, 0x19, 0x93, 0xF9, 0x09, 0xF1, 0x9E, 0x92, 0xE9, 0x2E, 0xA2,
+    0x9E, 0x3A, 0xD9, 0x3E, 0x4A, 0xC0, 0x49, 0x49, 0x39, 0xD9, 0x19, 0xDA, 0x19, 0xE1, 0x9E, 0x2E,
+    0x2E, 0x91, 0xAD, 0xA1, 0x9E, 0x2E, 0x91, 0xE9, 0x19, 0xE1, 0x9E, 0x91, 0x9E, 0x90, 0x9E, 0x91,
+    0x9E, 0xA1, 0xEA, 0x29, 0x93, 0x99, 0x92, 0x77, 0x0A, 0xDA, 0x1A, 0xDA, 0x3F, 0x1F, 0x3A, 0xE1,
+    0xAE, 0x3A, 0xE1, 0xAE, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E, 0x3E, 0x2E, 0x92, 0xAD, 0x91, 0xAD,
+    0x93, 0x9A, 0x39, 0xA9, 0x30, 0x2A, 0xC9, 0x19, 0xAA, 0x3F, 0x1F, 0x2A, 0xE1, 0xF2, 0xAE, 0x1A,
+    0xE2, 0xAD, 0xA1, 0xE9, 0x2E, 0x19, 0xE2, 0xAD, 0xA1, 0xE9, 0x19, 0xE1, 0xAD, 0xA2, 0xAC, 0xA2,
+    0xDA, 0x77, 0x00, 0x19, 0x93, 0x99, 0x3F, 0x90, 0xF1, 0x9F, 0x09, 0xEA, 0x19, 0xE9, 0x0A, 0xE3,
+    0xE9, 0x09, 0xE3, 0xEA, 0x1E, 0x92, 0x9E, 0x1A, 0xDA, 0x3A, 0xD9, 0x1E, 0x4E, 0x2E, 0x4A, 0xC3,
+    0xCA, 0x00, 0x69, 0x97, 0x1E, 0x97, 0x9E, 0x70, 0x9E, 0x70, 0x9D, 0x94, 0x99, 0x19, 0xD2, 0x99,
+    0x9F, 0xFE, 0xAA, 0xFF, 0xE9, 0xAA, 0x99, 0x0D, 0x90, 0x9A, 0xA5, 0xD7, 0x19, 0xD7, 0x1A, 0xD7,
+    0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x09, 0xDA, 0x60, 0x70,
+    0x99, 0x73, 0xE9, 0x71, 0x9E, 0x72, 0x9E, 0x72, 0x9D, 0x96, 0x99, 0x19, 0xD2, 0x99, 0x19, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xE9, 0x1A, 0xA9, 0x90, 0xD9, 0x09, 0xAA, 0x69, 0xD9, 0x72, 0xAD, 0x97, 0x2E,
+    0x97, 0x2E, 0x73, 0xDA, 0x6A, 0xA9, 0x1D, 0x19, 0x9A, 0x2F, 0xFF, 0x19, 0xFF, 0xF2, 0x99, 0x1D,
+    0xA1, 0x99, 0x7D, 0xA7, 0x29, 0xDA, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0x99, 0x97, 0x1A, 0xAA, 0x91,
+    0xFC, 0x9A, 0xFC, 0xAF, 0xD9, 0xFD, 0x09, 0xF9, 0x29, 0x92, 0x9C, 0x96, 0xF9, 0x4F, 0xD9, 0x2F,
+    0xF9, 0x0F, 0xFC, 0xAF, 0xFC, 0xAF, 0xEA, 0x1F, 0xCA, 0x3E, 0xA5, 0x9A, 0x70, 0x6A, 0xE9, 0x9F,
+    0xA9, 0xFC, 0x0F, 0x91, 0x99, 0x10, 0x75, 0xAD, 0xA2, 0x9E, 0x09, 0xF2, 0xF0, 0xAF, 0x19, 0xF0,
+    0xAE, 0x91, 0x9E, 0x91, 0x99, 0x49, 0x92, 0x77, 0x71, 0x9D, 0xA5, 0xAD, 0x95, 0xE0, 0x9F, 0x4A,
+    0xEA, 0x4F, 0x9A, 0xF4, 0xFA, 0x4F, 0x99, 0xE9, 0x4F, 0x5E, 0xA1, 0x99, 0x79, 0x97, 0x99, 0x10,
+    0x29, 0x2F, 0x99, 0xFC, 0x9F, 0xC0, 0xF9, 0x50, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A,
+    0x2A, 0xAD, 0x9A, 0xC2, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA, 0x19, 0xC9,
+    0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74, 0x9C, 0x95,
+    0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xA2, 0xA9, 0x9D, 0xAA, 0x2C, 0xA0, 0x9C, 0x93, 0x9A, 0x19, 0xC9,
+    0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79,
+    0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x10, 0x3A, 0x96, 0xAD, 0x94, 0x9C, 0xAA, 0xC9, 0x29, 0xC0, 0xAA, 0x0C, 0x91, 0xC1, 0xAA, 0x1C,
+    0x4A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0x50, 0x76, 0x9C, 0x90, 0xC9, 0x69, 0xC9, 0x0C, 0xA6, 0x9C, 0x90, 0xCA, 0x09, 0xAA, 0xAA, 0xAD,
+    0x90, 0xCA, 0xCA, 0xAA, 0xAA, 0xD9, 0x0C, 0x9C, 0x92, 0x9C, 0x90, 0xC9, 0x0C, 0x91, 0x9C, 0x1C,
+    0x91, 0xC9, 0x09, 0xC1, 0xC9, 0x2C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x75, 0x76, 0x9C, 0x09, 0xC9, 0x4A, 0xC0,
+    0x9C, 0x94, 0xAC, 0x09, 0xC9, 0x4A, 0xC0, 0x9D, 0xAA, 0xAA, 0xA9, 0x9C, 0x1D, 0xAA, 0xAA, 0xAC,
+    0x09, 0xC1, 0xC9, 0x29, 0xC1, 0x9C, 0x1C, 0x91, 0x9C, 0x29, 0xC1, 0xC9, 0x09, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x30, 0x77, 0x77, 0x77, 0x71, 0xCA, 0x77, 0x59, 0xFA, 0x79, 0xE7, 0x73, 0xAF, 0xDA,
+    0x6E, 0x97, 0x72, 0xAE, 0x99, 0xE5, 0xEA, 0x77, 0x29, 0xE2, 0xE9, 0x3A, 0xE7, 0x73, 0xEA, 0x2E,
+    0x93, 0xE7, 0x74, 0xE3, 0xE9, 0x2E, 0x97, 0x73, 0x9E, 0x3E, 0x2A, 0xDA, 0x77, 0x49, 0xE2, 0x9E,
+    0x2E, 0x77, 0x59, 0xE2, 0xE9, 0x1E, 0x3A, 0xAA, 0x97, 0x9A, 0xAA, 0x29, 0xE9, 0x0A, 0xE1, 0xAD,
+    0x91, 0xAF, 0xD4, 0x9F, 0xD9, 0x1F, 0xF1, 0x9D, 0xA1, 0xFA, 0xEA, 0x2A, 0xEA, 0xF2, 0xAF, 0xA2,
+    0xE1, 0xAE, 0x1A, 0xE1, 0x9E, 0x2E, 0x72, 0xE2, 0xE2, 0x9E, 0x1E, 0xA2, 0xE9, 0x70, 0xAD, 0x91,
+    0xAE, 0x29, 0xE1, 0xE3, 0xE9, 0x79, 0xDA, 0x2E, 0xA2, 0xAE, 0x09, 0xE3, 0xE7, 0x0E, 0x3E, 0x92,
+    0xEA, 0x0A, 0xE2, 0x9E, 0x7E, 0x93, 0xE9, 0x2E, 0x1A, 0xDA, 0x2E, 0x96, 0xAD, 0xA4, 0xEA, 0x1E,
+    0xA1, 0xAE, 0x1A, 0xE6, 0x9E, 0x5A, 0xEA, 0xF3, 0xFF, 0x7E, 0x96, 0xFD, 0xA4, 0xAF, 0xD7, 0x0D,
+    0xA7, 0x09, 0xAA, 0x97, 0x0A, 0xAA, 0x97, 0x2A, 0x77, 0x77, 0x71, 0x9C, 0x93, 0xAD, 0xA2, 0xEA,
+    0x1A, 0xE9, 0x1F, 0x19, 0xE9, 0x1E, 0xA2, 0xE3, 0xAC, 0x72, 0x77, 0x9C, 0x92, 0xAC, 0x93, 0xAD,
+    0xA1, 0xE9, 0x2E, 0xA0, 0x9E, 0x91, 0xAE, 0x90, 0xF2, 0xF0, 0x9E, 0xA1, 0x9E, 0x90, 0xAE, 0x2E,
+    0xA1, 0xE9, 0x2E, 0x19, 0xDA, 0x3A, 0xC3, 0xD7, 0x70, 0x77, 0x69, 0xC9, 0x3C, 0xA3, 0xAC, 0x93,
+    0xAD, 0xA1, 0x9E, 0x2E, 0x92, 0xEA, 0x1F, 0x19, 0xE9, 0x1A, 0xE9, 0x1E, 0xA1, 0xF2, 0xF1, 0xAE,
+    0x19, 0xE9, 0x19, 0xE9, 0x1E, 0xA1, 0xAE, 0x2E, 0xA1, 0x9E, 0x2E, 0x92, 0xE2, 0xAD, 0x91, 0x9D,
+    0xA3, 0xAC, 0x39, 0xCA, 0x3D, 0x77, 0x70, 0x79, 0xCA, 0x29, 0xE2, 0x9E, 0x92, 0xF2, 0x9E, 0x92,
+    0xEA, 0x29, 0xE3, 0xAD, 0x93, 0xD7, 0x75, 0x9C, 0xA3, 0xAC, 0x29, 0xE2, 0xE9, 0x19, 0xE9, 0x1F,
+    0x2F, 0x1A, 0xE2, 0x9E, 0x91, 0xEA, 0x2E, 0xA1, 0xAE, 0x29, 0xE2, 0xE9, 0x2A, 0xD9, 0x19, 0xE3,
+    0xD3, 0xAC, 0x97, 0x40, 0x77, 0x49, 0xCA, 0x3A, 0xC3, 0x9C, 0x92, 0x9E, 0x2E, 0x91, 0xAD, 0xA2,
+    0x9E, 0x91, 0xF1, 0xAE, 0x3F, 0x1A, 0xE1, 0x9E, 0xA2, 0x9E, 0x91, 0xEA, 0x1F, 0x3E, 0xA1, 0xAE,
+    0x19, 0xE9, 0x29, 0xE2, 0xE9, 0x1A, 0xE3, 0xAD, 0x91, 0x9E, 0x2E, 0x4D, 0x3A, 0xC9, 0x3C, 0xA7,
+    0x74, 0x49, 0xA7, 0x19, 0xDA, 0x79, 0xFA, 0x59, 0xEA, 0xDA, 0x39, 0xE1, 0xAD, 0xA2, 0xE3, 0xAD,
+    0xA0, 0x49, 0xCA, 0x4A, 0xE3, 0xF2, 0x9F, 0x29, 0xF3, 0xAE, 0x93, 0xFA, 0x4F, 0x5E, 0xA4, 0x9E,
+    0x95, 0xD9, 0x72, 0x2A, 0xC9, 0x6E, 0x95, 0xAE, 0x95, 0xF9, 0x49, 0xF5, 0xF4, 0xAE, 0xA3, 0xAE,
+    0xA3, 0xAE, 0x93, 0xAE, 0x94, 0x9C, 0xA7, 0x70, 0x0A, 0x75, 0xA0, 0xAD, 0x4A, 0xA4, 0xDA, 0x0E,
+    0x2A, 0xDA, 0x2E, 0x2D, 0xA1, 0xAD, 0xA1, 0xAD, 0x4D, 0xA1, 0xD1, 0xAD, 0x94, 0x9D, 0xA3, 0xAD,
+    0x96, 0x9D, 0xA1, 0x9D, 0x97, 0x09, 0xD9, 0x9D, 0x95, 0x9D, 0x1A, 0xFA, 0x1D, 0x91, 0xEA, 0x1A,
+    0xDA, 0x1A, 0xE1, 0xAD, 0x91, 0xF1, 0x9E, 0x29, 0x91, 0xDA, 0xAD, 0x19, 0x96, 0xE1, 0xE7, 0x0E,
+    0x3E, 0x6E, 0x19, 0x91, 0xE4, 0xE1, 0xAD, 0xA1, 0xE2, 0xAD, 0x2A, 0xE2, 0xDA, 0x0A, 0xD9, 0x29,
+    0xD9, 0x3D, 0xA0, 0xC9, 0x73, 0x9C, 0x77, 0x20, 0x49, 0xAA, 0x93, 0x9A, 0xA9, 0x3A, 0xE9, 0x2A,
+    0xE9, 0x3F, 0x3F, 0x3A, 0xEA, 0x2A, 0xEA, 0x3F, 0x92, 0xF9, 0x3F, 0x3F, 0x4E, 0xA3, 0xEA, 0x39,
+    0xE9, 0x29, 0xE9, 0x39, 0xE3, 0xAE, 0x4A, 0xE3, 0xAE, 0x4A, 0xDA, 0x3E, 0xA4, 0xE9, 0x3E, 0x5E,
+    0x4E, 0x5E, 0x4D, 0xA5, 0xDA, 0x4D, 0xA5, 0xD9, 0x39, 0xD9, 0x59, 0x69, 0x77, 0x79, 0xD9, 0x3A,
+    0xD9, 0x39, 0xF2, 0x9E, 0xA3, 0xAE, 0xA2, 0xAE, 0xA3, 0x9E, 0x3A, 0xE5, 0x99, 0x59, 0x95, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x6A, 0xFC, 0x9F, 0xD9, 0xFD, 0x96, 0x77, 0x77, 0x1C, 0xA7, 0x7A, 0xE7, 0x6E,
+    0x97, 0x5E, 0xA7, 0x5A, 0xDA, 0x75, 0x9E, 0x76, 0xE9, 0x75, 0xAD, 0x97, 0x59, 0xDA, 0x76, 0xE7,
+    0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xE7, 0x6A, 0xD9, 0x75, 0xAD, 0xA7, 0x59, 0xE7, 0x6E,
+    0x97, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0x9D, 0xA7, 0x70, 0xA7, 0x70, 0x77, 0x6A, 0xF9,
+    0x4A, 0xF9, 0x2A, 0xFD, 0x92, 0xAF, 0xD9, 0x1F, 0xF2, 0xFF, 0x1E, 0xAF, 0x91, 0xEA, 0xF9, 0x0A,
+    0x92, 0xE9, 0x1A, 0x92, 0xE9, 0x5E, 0x96, 0xE9, 0x5E, 0x7E, 0x5E, 0x96, 0xE9, 0x4E, 0x96, 0xE9,
+    0x4E, 0x96, 0xE9, 0x4E, 0x96, 0xE9, 0x4E, 0x7E, 0x59, 0xE9, 0x94, 0x9E, 0x99, 0x39, 0xFC, 0x93,
+    0x9F, 0xC9, 0x3F, 0xA5, 0xFA, 0x59, 0x97, 0x09, 0x97, 0x77, 0x3A, 0xD9, 0x6A, 0xD9, 0x49, 0xEA,
+    0x59, 0xEA, 0x4A, 0xEA, 0x5A, 0xEA, 0x4A, 0xE6, 0xAE, 0x69, 0x97, 0x09, 0x96, 0x76, 0xAA, 0xA2,
+    0xAF, 0x95, 0xF1, 0xAF, 0xD9, 0x3A, 0xEA, 0x1F, 0xF3, 0xF2, 0xEA, 0xF9, 0x19, 0xF2, 0xA9, 0x2E,
+    0x91, 0x9E, 0xA7, 0xE9, 0x1A, 0xE7, 0x0E, 0x2F, 0x7E, 0x92, 0xEA, 0x6E, 0x93, 0xE9, 0x5E, 0x94,
+    0xE5, 0xE9, 0x49, 0xE4, 0xE6, 0x9D, 0xA3, 0x9E, 0x99, 0x4A, 0xD9, 0x39, 0xFC, 0x93, 0xAD, 0x5F,
+    0xA4, 0xAD, 0x69, 0x96, 0x97, 0x77, 0x2A, 0xD9, 0x5A, 0xCA, 0x49, 0xEA, 0x4F, 0x93, 0xAE, 0xA4,
+    0xF4, 0xAE, 0x5E, 0xA5, 0x99, 0x79, 0x95, 0x49, 0xAA, 0x97, 0x5A, 0xE9, 0x19, 0xFA, 0x5F, 0x19,
+    0xFE, 0x3A, 0xEA, 0x1A, 0xFE, 0x92, 0xF9, 0x1A, 0xDA, 0xAF, 0x2F, 0x3A, 0x29, 0xE2, 0xEA, 0x79,
+    0xE1, 0x9E, 0x97, 0xAD, 0x91, 0x9E, 0x7A, 0xE2, 0xAE, 0x6A, 0xE3, 0xAD, 0xA5, 0xAE, 0x4E, 0x94,
+    0xAD, 0xA5, 0xE4, 0x9D, 0xA6, 0xE4, 0xE9, 0x99, 0x4D, 0xA4, 0xFD, 0x4D, 0x94, 0xAF, 0x59, 0x70,
+    0x99, 0x77, 0x70, 0x9D, 0x95, 0xDA, 0x49, 0xF4, 0xF4, 0xAE, 0xA4, 0xF4, 0x9E, 0x5E, 0x95, 0x99,
+    0x79, 0x60, 0x77, 0x3A, 0xAA, 0xA9, 0x59, 0xA1, 0x9F, 0xE9, 0x29, 0xDA, 0x9F, 0xFF, 0xE9, 0xAD,
+    0x92, 0xAF, 0xEA, 0x1C, 0xA5, 0xAE, 0xA9, 0x77, 0x20, 0x77, 0x74, 0x9C, 0x93, 0xCA, 0x3A, 0xC9,
+    0x29, 0xC9, 0x3A, 0xDA, 0x19, 0xE2, 0xE9, 0x1A, 0xDA, 0x2E, 0xA1, 0xF1, 0x9E, 0x91, 0xEA, 0x1A,
+    0xE9, 0x1E, 0xA1, 0xF1, 0xAE, 0x91, 0xF1, 0xAE, 0x19, 0xE9, 0x1F, 0x19, 0xE9, 0x1E, 0xA1, 0xAE,
+    0x19, 0xE2, 0xEA, 0x19, 0xE2, 0xE9, 0x1E, 0xA2, 0xE2, 0xAD, 0x91, 0x9D, 0xA2, 0xE3, 0xAC, 0x39,
+    0xCA, 0x3D, 0x3A, 0xC7, 0x77, 0x50, 0x49, 0xAD, 0xA6, 0xFE, 0x93, 0xF9, 0xF2, 0xAD, 0xA1, 0x9E,
+    0x2E, 0x3E, 0x1A, 0xE3, 0xE1, 0xE9, 0x29, 0xE1, 0xE3, 0xAE, 0x1E, 0x3E, 0x91, 0xE2, 0x9E, 0x2E,
+    0x91, 0xE9, 0x2A, 0xFE, 0xA4, 0xFD, 0x96, 0x9A, 0x99, 0x50, 0x70, 0xAC, 0x97, 0x0E, 0xA7, 0xF9,
+    0x6F, 0xC6, 0xDA, 0xAD, 0x5D, 0xA0, 0xDA, 0x4D, 0xA0, 0x9D, 0x93, 0xE1, 0xAD, 0x3E, 0xAA, 0xAE,
+    0xAA, 0x09, 0xFF, 0xE1, 0x9A, 0xAA, 0xAA, 0xEA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x19, 0x99, 0x30,
+    0x4A, 0xAA, 0xAA, 0xAA, 0x49, 0xFE, 0x4F, 0xEA, 0x4D, 0xA7, 0x09, 0xDA, 0x97, 0xAF, 0xC9, 0x59,
+    0x9A, 0xF7, 0x1E, 0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x9E, 0xA3, 0xAA, 0xAF, 0xC4, 0xFD, 0x96, 0xAA,
+    0x99, 0x60, 0x6A, 0xAC, 0xA5, 0xFD, 0xA2, 0x9F, 0xA9, 0x39, 0xE9, 0x6E, 0x7F, 0xE9, 0x3F, 0xFA,
+    0x19, 0xD9, 0x19, 0xE1, 0xAD, 0x92, 0xE1, 0xAD, 0x92, 0xE1, 0xAD, 0xA1, 0x9E, 0x2E, 0xAA, 0xE9,
+    0x29, 0xFD, 0x95, 0x9A, 0x99, 0x40, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0xA0, 0xEA, 0xAA,
+    0xE9, 0x9D, 0x2A, 0xDA, 0x09, 0xC9, 0x19, 0xE6, 0xE6, 0xE9, 0x5A, 0xDA, 0x59, 0xE6, 0xE9, 0x5A,
+    0xE6, 0xE9, 0x6E, 0x79, 0xA9, 0x60, 0x39, 0xAD, 0xA4, 0xFE, 0x91, 0xE9, 0x09, 0xE1, 0xE2, 0xE1,
+    0xE1, 0xAD, 0x91, 0xAE, 0xAD, 0xA3, 0xFC, 0x92, 0x9D, 0xAA, 0xE1, 0x9D, 0xA1, 0xAD, 0xA0, 0xE2,
+    0x9E, 0x0E, 0x2A, 0xDA, 0x0A, 0xEA, 0xAE, 0x2F, 0xE5, 0x99, 0x94, 0x4A, 0xDA, 0x94, 0x9F, 0xE3,
+    0xE9, 0x9E, 0x91, 0xAD, 0x91, 0x9D, 0xA1, 0xE3, 0xE1, 0xE3, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x2F,
+    0xF4, 0xAA, 0xFA, 0x69, 0xE6, 0xAE, 0x92, 0xAA, 0xFC, 0x39, 0xFC, 0x95, 0x99, 0x97, 0x79, 0x1A,
+    0xEA, 0x0F, 0x0A, 0xAD, 0x9F, 0xC2, 0xF0, 0xE1, 0x9E, 0x1D, 0xA1, 0xAD, 0x91, 0xD9, 0x1E, 0x19,
+    0xD2, 0xDA, 0x1A, 0xD0, 0xA9, 0xD9, 0x1F, 0xCA, 0xD2, 0xF0, 0x99, 0x92, 0x9A, 0x91, 0x77, 0x1A,
+    0xFA, 0x49, 0xFE, 0xA2, 0x9E, 0x90, 0xAE, 0x2E, 0x91, 0x9E, 0x19, 0xE3, 0xE1, 0xAD, 0xA2, 0x9E,
+    0x1E, 0x92, 0x9E, 0x1E, 0x3A, 0xDA, 0x1E, 0x3E, 0x91, 0xE9, 0x1A, 0xE2, 0xEA, 0x0A, 0xE3, 0xAF,
+    0xE5, 0x9F, 0xA7, 0x71, 0x74, 0x9A, 0xDA, 0x1A, 0xFC, 0x91, 0x9F, 0xC5, 0xE4, 0x9E, 0x4A, 0xDA,
+    0x4A, 0xD9, 0x4E, 0x5E, 0x49, 0xDA, 0x4A, 0xDA, 0x2F, 0xE9, 0x0F, 0xE0, 0x77, 0x9F, 0xC9, 0x3A,
+    0xFE, 0x91, 0x9E, 0x90, 0xAD, 0xA1, 0x9D, 0x29, 0xDA, 0x29, 0x3E, 0x96, 0xAD, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x59, 0xE9, 0x59, 0xE6, 0xAE, 0xAA, 0xAA, 0xAA, 0x1F, 0xFD, 0x1A, 0xFE, 0xA1, 0x75, 0x9F,
+    0xC9, 0x29, 0xFE, 0x2D, 0xA1, 0xAD, 0x91, 0x9A, 0x2A, 0xD6, 0x9D, 0xA4, 0x9E, 0xA4, 0xFD, 0x4A,
+    0x99, 0xE9, 0x69, 0xDA, 0x6E, 0x94, 0x9F, 0x1F, 0xF2, 0xAF, 0xA9, 0x76, 0x77, 0x4A, 0xDA, 0x7A,
+    0xE9, 0x6A, 0xF6, 0xAF, 0xC5, 0x9D, 0x9E, 0x49, 0xD9, 0x0D, 0xA3, 0x9D, 0x90, 0x9D, 0x92, 0x9D,
+    0x91, 0xAD, 0x3F, 0xFE, 0x1F, 0xFE, 0x69, 0xDA, 0x70, 0xAD, 0x71, 0xAD, 0x30, 0x39, 0xFE, 0x4A,
+    0xFE, 0x4E, 0x99, 0x99, 0x5D, 0x97, 0x0A, 0xEA, 0x96, 0xFD, 0xA7, 0x0A, 0xE9, 0x70, 0xE9, 0x70,
+    0xE9, 0x79, 0xE6, 0x9A, 0xE9, 0x3F, 0xE9, 0x4A, 0xFA, 0x77, 0x20, 0x77, 0x1A, 0xF9, 0x3A, 0xFC,
+    0xA9, 0x2F, 0x95, 0xAD, 0xA6, 0x9E, 0x99, 0x94, 0xFF, 0x29, 0xEA, 0x9F, 0x1A, 0xD9, 0x2E, 0x1A,
+    0xD9, 0x2E, 0x1A, 0xD9, 0x2E, 0x19, 0xE1, 0xAD, 0xA2, 0xFF, 0x4A, 0xFA, 0x77, 0x0A, 0xFF, 0x90,
+    0xFF, 0xCA, 0x9D, 0x99, 0x99, 0xE0, 0x9D, 0x2E, 0x91, 0x92, 0xAD, 0x95, 0x9D, 0xA6, 0xE6, 0xE9,
+    0x5A, 0xDA, 0x6E, 0x6E, 0xA6, 0xE7, 0xDA, 0x77, 0x10, 0x76, 0xAF, 0xA2, 0x9E, 0xAE, 0xA1, 0xE2,
+    0xE1, 0xE1, 0x9D, 0xA1, 0xE9, 0x0E, 0x29, 0xFD, 0x39, 0xFC, 0x92, 0xAD, 0x99, 0xE9, 0x0A, 0xD9,
+    0x19, 0xE0, 0xE2, 0x9E, 0x0E, 0x91, 0xEA, 0x09, 0xFE, 0xA2, 0x9F, 0xC9, 0x75, 0x69, 0x7A, 0xFC,
+    0x4A, 0xFE, 0x29, 0xDA, 0x1A, 0xDA, 0x1E, 0x3E, 0x1E, 0x3E, 0x1E, 0x91, 0x9D, 0xA1, 0xAE, 0xAA,
+    0xE9, 0x2A, 0xFE, 0x59, 0x9E, 0x96, 0xAD, 0xA4, 0x9A, 0xF2, 0x9F, 0xDA, 0x4F, 0xA7, 0x71, 0x4A,
+    0xFF, 0xFC, 0x5F, 0xFF, 0xD5, 0x9A, 0xFF, 0xF7, 0xF4, 0xE6, 0x9F, 0x4D, 0xA6, 0x9F, 0x4D, 0x7A,
+    0xEA, 0x76, 0xF9, 0x76, 0xFA, 0x9A, 0xAA, 0xA7, 0x09, 0xFF, 0xD7, 0x0A, 0xFF, 0xCA, 0x70, 0xFA,
+    0x76, 0xF7, 0x5A, 0xAF, 0xAA, 0xA7, 0x19, 0xFF, 0xC7, 0x29, 0xFA, 0x99, 0x97, 0x3F, 0x97, 0x59,
+    0xFA, 0x99, 0x71, 0xAF, 0xFC, 0x71, 0xFF, 0xD7, 0x00, 0x77, 0x75, 0x9A, 0xF9, 0x72, 0xAF, 0xE9,
+    0x70, 0xFA, 0xFC, 0x7A, 0xE9, 0x1A, 0xE7, 0xEA, 0x29, 0xDA, 0x6A, 0xE3, 0x9C, 0xA7, 0xEA, 0x75,
+    0xAE, 0x92, 0x96, 0x9F, 0xFE, 0x6F, 0xFF, 0x70, 0x9E, 0xA7, 0x3A, 0xAF, 0xAA, 0xAA, 0xA6, 0xAF,
+    0xFE, 0x6A, 0xAA, 0xFA, 0xAA, 0xA9, 0x70, 0x9E, 0x97, 0x5A, 0xE7, 0x39, 0x90, 0xEA, 0x59, 0x9A,
+    0x2F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1, 0x9F, 0x90, 0x9A, 0xFE, 0x39, 0xA9, 0x76, 0x77, 0x77, 0x72,
+    0x9A, 0xFE, 0xA7, 0x77, 0x19, 0xFF, 0xFA, 0x77, 0x7F, 0xFF, 0xD9, 0x77, 0x69, 0x90, 0xF2, 0xFC,
+    0x77, 0x71, 0xF2, 0x9F, 0x77, 0x70, 0x9F, 0x3F, 0x3E, 0x77, 0x1A, 0xEA, 0x3F, 0x2E, 0xA7, 0x71,
+    0xF9, 0x29, 0xF2, 0xE9, 0x79, 0x99, 0x6F, 0x3F, 0x90, 0x9F, 0xE9, 0x2A, 0xFC, 0x5F, 0x2F, 0xC0,
+    0xFF, 0xC2, 0xFE, 0x49, 0xFA, 0xFD, 0x29, 0xF9, 0x92, 0xAD, 0x91, 0x9C, 0x4A, 0xFF, 0xC9, 0x4E,
+    0xA4, 0xAE, 0x70, 0xFE, 0xA9, 0x59, 0xE9, 0x49, 0xF7, 0xF7, 0x29, 0xE6, 0xFC, 0x94, 0x9F, 0x72,
+    0xAE, 0x7A, 0xF4, 0x9E, 0xA7, 0x2F, 0x70, 0xAE, 0xA3, 0xAE, 0x97, 0x2E, 0xA1, 0xC9, 0x0C, 0xA2,
+    0xEA, 0x29, 0xFA, 0x97, 0x1F, 0xEA, 0xAD, 0xA1, 0xE9, 0x09, 0xFF, 0xC7, 0x0F, 0xE0, 0x9F, 0xEA,
+    0x1A, 0xFF, 0xA7, 0x0A, 0xF9, 0x29, 0xFC, 0x97, 0x77, 0x77, 0x00, 0x77, 0x76, 0x9A, 0xFC, 0xA7,
+    0x19, 0xFF, 0xD7, 0xAF, 0xFD, 0xA6, 0xFC, 0x92, 0x9D, 0x95, 0xAE, 0xA4, 0xAD, 0x59, 0xEA, 0x59,
+    0xC9, 0x5F, 0x75, 0xAA, 0xFA, 0xAF, 0x6A, 0xFF, 0xF6, 0x99, 0xFA, 0x99, 0x99, 0x97, 0x1F, 0x74,
+    0xAF, 0xFF, 0x6F, 0xFF, 0x97, 0x1F, 0x77, 0xF9, 0x76, 0xAF, 0x79, 0x59, 0xFC, 0x93, 0x9D, 0x6A,
+    0xFF, 0xF7, 0xFF, 0xE7, 0x19, 0xFE, 0x97, 0x69, 0x70, 0x77, 0x7A, 0xC7, 0x7A, 0xE7, 0x5A, 0xE9,
+    0x74, 0xAE, 0x75, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0xFC, 0x90, 0xFF,
+    0xFF, 0xC9, 0x09, 0xE9, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xE7, 0x7A, 0xE9, 0x76, 0xAE,
+    0x77, 0xAC, 0x77, 0x76, 0x77, 0x1E, 0x70, 0xFC, 0x6F, 0xE4, 0xFF, 0xC2, 0xE9, 0xEA, 0xE0, 0xAD,
+    0xA0, 0xE0, 0xEA, 0x0D, 0x1E, 0x1D, 0x5E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x77, 0x10, 0x77, 0x75, 0x9C, 0xA7, 0x7E, 0xA7, 0x69, 0xEA,
+    0x77, 0xEA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0xE9, 0x75, 0xE9, 0x74, 0x9E, 0xA7, 0x5E, 0xA7,
+    0x7C, 0xA7, 0x77, 0x77, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x19, 0x2D, 0x1E, 0x1D, 0x0A, 0xE0, 0xE0, 0xEA, 0x0E, 0xAE, 0xAE, 0x2F,
+    0xFC, 0x4F, 0xE6, 0xFA, 0x70, 0xAC, 0xA7, 0x71, 0x77, 0x7C, 0x94, 0x9C, 0x70, 0xE9, 0x29, 0xE6,
+    0xF4, 0xF4, 0xEA, 0x6A, 0xDA, 0x2A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x0A, 0xFF, 0xFF, 0xC9,
+    0x9F, 0xFF, 0xFC, 0x90, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA2, 0xAD, 0xA6, 0xAD, 0xA4, 0xF3,
+    0x9E, 0xA6, 0xE4, 0xE7, 0x0C, 0x6A, 0x77, 0x70, 0x59, 0x72, 0xE7, 0x0F, 0xC5, 0x9F, 0xE3, 0x9F,
+    0xFC, 0x90, 0x9E, 0x9E, 0x9E, 0x1D, 0xA0, 0xE0, 0xAC, 0xA2, 0xA1, 0xE1, 0xA6, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x6A, 0x1E, 0x1A, 0x2D, 0xA0, 0xE0, 0xAD, 0x1E, 0x9E, 0x9E, 0x2F, 0xFC, 0x4F, 0xE6,
+    0xFC, 0x70, 0xE7, 0x29, 0x50, 0x5A, 0xCA, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xFF, 0xC4, 0xEA,
+    0xEA, 0xE3, 0xE0, 0xE0, 0xE4, 0xC1, 0xE1, 0xC7, 0x0E, 0x73, 0xE7, 0x3E, 0x79, 0xC1, 0xE1, 0xC9,
+    0x29, 0xE0, 0xE0, 0xE3, 0xAF, 0xFC, 0xA4, 0xAF, 0xEA, 0x6A, 0xFC, 0xA7, 0x09, 0xE9, 0x59, 0x99,
+    0x99, 0xAC, 0xA9, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x70, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA4, 0xA9,
+    0x1A, 0xDA, 0x3A, 0xD9, 0x0A, 0xDA, 0x2A, 0xE9, 0x0A, 0xDA, 0x1A, 0xE2, 0xAD, 0x90, 0xAE, 0x3A,
+    0xD9, 0x9F, 0xFE, 0x9A, 0xFF, 0xE9, 0x0F, 0xFE, 0x91, 0xE9, 0x70, 0x9E, 0xA7, 0x09, 0xEA, 0x70,
+    0x9D, 0x72, 0x96, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x19, 0xA4, 0xAD, 0xA0, 0x9D, 0xA3, 0xAD, 0xA0, 0x9E, 0xA2,
+    0xAD, 0xA2, 0xEA, 0x19, 0xDA, 0x3E, 0xA0, 0x9F, 0xFE, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0x79, 0xE7,
+    0xAE, 0x7A, 0xE9, 0x70, 0xD9, 0x72, 0x94, 0x74, 0x9A, 0xA7, 0x5E, 0x97, 0x4E, 0x94, 0xD5, 0xE9,
+    0x3A, 0xE4, 0xE9, 0x2A, 0xE9, 0x4E, 0x91, 0xAD, 0xA6, 0xE9, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E,
+    0x99, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x1A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xDA, 0x75,
+    0xAE, 0x75, 0xF7, 0x5D, 0x77, 0x72, 0x6A, 0x77, 0x0E, 0x76, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x99,
+    0x99, 0x9A, 0xAA, 0xAA, 0xA9, 0x1A, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xF9, 0x9D, 0xA7, 0x69, 0xDA,
+    0x77, 0xAF, 0xFF, 0xF9, 0x1A, 0xFF, 0xFE, 0x92, 0xAE, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xA9, 0x3A,
+    0xDA, 0x77, 0xAD, 0xA7, 0x7D, 0xA7, 0x70, 0xA7, 0x20, 0x6A, 0xCA, 0x74, 0xAE, 0xA7, 0x2A, 0xFC,
+    0xA7, 0x0A, 0xDA, 0x0A, 0xDA, 0x6F, 0xA0, 0xAF, 0x4F, 0xCA, 0x0A, 0xFC, 0x2E, 0xAD, 0xA0, 0xAD,
+    0xAE, 0x1A, 0xCA, 0x0D, 0xA0, 0xAD, 0x0A, 0xCA, 0x29, 0x1D, 0xA0, 0xAD, 0x19, 0x6D, 0xA0, 0xAD,
+    0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA,
+    0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0x90, 0x9D, 0x40, 0x72, 0xA7, 0x70,
+    0xE7, 0x7A, 0xE7, 0x7A, 0xE3, 0x9A, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0xEA, 0x29, 0xFF, 0xFE, 0xA1,
+    0x9F, 0xFF, 0xFA, 0x77, 0xAD, 0x97, 0x6A, 0xD9, 0x9F, 0xFF, 0xFA, 0x09, 0xFF, 0xFE, 0xA1, 0x9A,
+    0xAA, 0xAA, 0x99, 0x99, 0x99, 0xEA, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x76, 0xAD, 0x77, 0x0A, 0x60,
+    0x4D, 0x90, 0x9D, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0,
+    0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x71, 0xDA, 0x0A, 0xD7, 0x1D, 0xA0, 0xAD, 0x6A,
+    0x1D, 0xA0, 0xAD, 0x1A, 0x2D, 0xA0, 0xDA, 0x0A, 0xD0, 0xAD, 0x1E, 0xAD, 0xA0, 0xAD, 0xAE, 0x2A,
+    0xFA, 0x0A, 0xFA, 0x4A, 0xEA, 0x0A, 0xEA, 0x6A, 0xDA, 0x0A, 0xDA, 0x70, 0xAF, 0xCA, 0x72, 0xAE,
+    0xA7, 0x4A, 0xCA, 0x60, 0x77, 0x70, 0xC4, 0xC7, 0x2E, 0x2E, 0x70, 0xE9, 0x2A, 0xE6, 0xEA, 0x4A,
+    0xE4, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0xA0, 0xAD, 0x97, 0x29, 0xD9, 0x9D, 0x97, 0x2A, 0xD9, 0x0A,
+    0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xCA, 0x4E, 0xA4, 0xAD, 0xA6, 0xEA, 0x2A, 0xE7, 0x0E, 0x2E, 0x72,
+    0xC4, 0xC7, 0x77, 0x00, 0x77, 0x5F, 0xC7, 0x1F, 0x1F, 0xC7, 0x1E, 0xA1, 0x9F, 0xA7, 0xAE, 0x92,
+    0xFC, 0x7F, 0x3A, 0xF7, 0xE9, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0xDA, 0x5A, 0xFF,
+    0xFC, 0x7F, 0xC9, 0x99, 0x9E, 0xA7, 0xFC, 0x3E, 0x97, 0x9F, 0x29, 0xE7, 0x1F, 0xA1, 0xE9, 0x71,
+    0xAF, 0x1E, 0x72, 0x9F, 0x0A, 0xDA, 0x73, 0xFA, 0xE7, 0x4A, 0xFE, 0x74, 0x9F, 0xD9, 0x75, 0xFD,
+    0x76, 0xAF, 0xA7, 0x7E, 0xA7, 0x70, 0x99, 0x72, 0x59, 0xAA, 0xA9, 0x70, 0x9F, 0xEA, 0x59, 0xFF,
+    0xCA, 0x4A, 0xCA, 0x2A, 0xF7, 0x3F, 0xA7, 0x29, 0xF7, 0x3F, 0x73, 0xF6, 0xAE, 0xAF, 0x49, 0xFF,
+    0xD3, 0xAF, 0xAA, 0xFC, 0x29, 0xEA, 0x3F, 0x2F, 0x4F, 0x19, 0xE9, 0x4E, 0xA1, 0xF4, 0x9E, 0x91,
+    0xF4, 0xAE, 0x2F, 0x4F, 0x2F, 0x39, 0xE9, 0x2F, 0x3F, 0x3F, 0x2A, 0xE9, 0x3F, 0xCA, 0xFA, 0x5F,
+    0xF9, 0x7F, 0xCA, 0x73, 0x97, 0x10, 0x77, 0xFF, 0xFC, 0x1F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x71,
+    0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x0F,
+    0xFF, 0xC9, 0x0F, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71,
+    0xF9, 0x71, 0xF9, 0x09, 0x96, 0xF9, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC0, 0x77,
+    0x77, 0x9A, 0xAA, 0xA9, 0x4C, 0xA6, 0x9F, 0xFC, 0xA1, 0xE5, 0xAF, 0xFF, 0xE5, 0xAF, 0xCA, 0xAA,
+    0xAF, 0xD5, 0xAF, 0x95, 0xAF, 0x5F, 0x96, 0xFC, 0xA3, 0xAE, 0xA6, 0xAF, 0xD3, 0xF6, 0xAD, 0x9F,
+    0x91, 0x9F, 0x5A, 0xD9, 0x0A, 0xEA, 0x19, 0xEA, 0x4A, 0xD9, 0x19, 0xEA, 0x1A, 0xE9, 0x3A, 0xD9,
+    0x29, 0xEA, 0x1A, 0xE9, 0x2A, 0xDA, 0x39, 0xEA, 0x1A, 0xE9, 0x19, 0xDA, 0x4A, 0xE9, 0x19, 0xEA,
+    0x09, 0xDA, 0x5F, 0x29, 0xF9, 0xDA, 0x6F, 0x3F, 0xDA, 0x6A, 0xEA, 0x3A, 0xFA, 0x69, 0xF5, 0xFC,
+    0x5A, 0xF9, 0x5F, 0xEA, 0xAF, 0xDA, 0x5F, 0xFF, 0xE9, 0x5E, 0x1A, 0xFF, 0xA7, 0xAC, 0x49, 0x9A,
+    0x99, 0x97, 0x77, 0x70, 0x71, 0xAA, 0x77, 0xAE, 0xA7, 0x59, 0xFC, 0x75, 0xFD, 0x97, 0x39, 0xFD,
+    0xA7, 0x3A, 0xFE, 0x73, 0xE0, 0xF9, 0x71, 0xAD, 0xA0, 0xFC, 0x71, 0xE1, 0x9F, 0x70, 0x9E, 0x2F,
+    0xA7, 0xE9, 0x2F, 0xC7, 0xE3, 0x9F, 0x95, 0xAD, 0xA4, 0xFA, 0x5E, 0x94, 0xFC, 0x49, 0xE5, 0x9F,
+    0x93, 0xEA, 0x6F, 0xA2, 0x9E, 0x96, 0xFC, 0x2A, 0xE7, 0x9F, 0x91, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFC, 0x09, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x00, 0x77, 0x29, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF,
+    0xFC, 0xA9, 0xFD, 0xAA, 0xAA, 0xAA, 0xFC, 0x90, 0xFC, 0x7F, 0x1A, 0xF7, 0xE9, 0x19, 0xFA, 0x5A,
+    0xE3, 0xFC, 0x5E, 0xA3, 0xAF, 0x49, 0xE5, 0xFA, 0x3A, 0xE5, 0xFC, 0x3E, 0x95, 0x9F, 0x29, 0xE7,
+    0xFA, 0x1E, 0xA7, 0xAF, 0x1E, 0x70, 0x9F, 0x0A, 0xDA, 0x71, 0xFA, 0xE7, 0x2A, 0xFE, 0x73, 0xFD,
+    0x97, 0x3F, 0xD7, 0x49, 0xFA, 0x75, 0xF7, 0x69, 0x97, 0x10, 0x77, 0x73, 0xAF, 0xFF, 0x5A, 0xFF,
+    0xFD, 0x4F, 0xFF, 0xF3, 0xFC, 0xA9, 0x97, 0x3A, 0xF7, 0x7F, 0x77, 0xAE, 0xA7, 0x7F, 0x77, 0x0F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x77, 0x0A, 0xF7, 0x70,
+    0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0xF5, 0xAF, 0xFF, 0xD7, 0x9A, 0xFF, 0xE0,
+    0x76, 0x99, 0x97, 0x70, 0x9E, 0x77, 0x0F, 0x71, 0xAF, 0xFF, 0x5A, 0xFF, 0xFD, 0x4F, 0xFF, 0xF3,
+    0xFC, 0xA9, 0x90, 0x9E, 0x95, 0xAF, 0x4A, 0xE6, 0xF5, 0xEA, 0x5A, 0xEA, 0x49, 0xE6, 0xF5, 0xAE,
+    0x6F, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xAA, 0xAA,
+    0xAE, 0xAA, 0xAA, 0xAA, 0xA1, 0xF9, 0x29, 0xE7, 0x0A, 0xEA, 0x2E, 0xA7, 0x1F, 0x2E, 0x97, 0x1A,
+    0xF9, 0xAE, 0x73, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFF, 0x5A, 0xFF, 0xFD, 0x7F, 0xFF,
+    0xC6, 0x9E, 0x77, 0x0F, 0x77, 0x09, 0x99, 0x73, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x9F,
+    0xFF, 0xD4, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x2F, 0xCA, 0x75, 0x9F, 0x77, 0xF9, 0x77, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xAE, 0xA7, 0x79, 0xF7, 0x70, 0xFC, 0xA9, 0x76, 0xFF, 0xFF, 0xC4,
+    0xFF, 0xFF, 0x59, 0xAF, 0xFF, 0xC7, 0x29, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x5F, 0xFF, 0xA7,
+    0xFF, 0xFD, 0xA5, 0xFF, 0xFF, 0x75, 0x99, 0xAF, 0xC7, 0x70, 0xFA, 0x77, 0x0F, 0x77, 0x0A, 0xEA,
+    0x77, 0x0F, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
+    0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x77, 0x0F, 0x77, 0xAE, 0xA7, 0x7F, 0x77,
+    0xFA, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0xFF, 0xFF, 0x4F, 0xFF, 0xDA, 0x5F, 0xFE,
+    0xA9, 0x60, 0x29, 0x99, 0x77, 0x1E, 0x97, 0x70, 0xF7, 0x6F, 0xFF, 0xA7, 0xFF, 0xFD, 0xA5, 0xFF,
+    0xFF, 0x79, 0xE9, 0x09, 0x9A, 0xFC, 0x7E, 0xA4, 0xFA, 0x6A, 0xE5, 0xF7, 0xE9, 0x4A, 0xEA, 0x6E,
+    0xA5, 0xF1, 0xAA, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAF, 0x70, 0xE9, 0x29, 0xF7, 0x0A, 0xE2, 0xAE, 0xA7, 0x09, 0xE2,
+    0xF7, 0x2E, 0xA9, 0xFA, 0x29, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFD, 0xA5,
+    0xFF, 0xFC, 0x77, 0x1E, 0x97, 0x70, 0xF7, 0x71, 0x99, 0x95, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x71, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x77, 0xAF, 0xC7, 0x70, 0xF9, 0x77, 0x9F,
+    0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE1, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x77, 0xAE, 0xA7, 0x69, 0xF9, 0x74, 0x9A, 0xFC, 0x2F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99, 0x99, 0x99, 0x99, 0x97, 0x10, 0x77,
+    0x6F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x19, 0xAF, 0xDA, 0xAA, 0xAF, 0xE9, 0x39, 0xF9, 0x6F,
+    0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F,
+    0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA,
+    0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9,
+    0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA4, 0x9F, 0x96, 0xFA, 0x49, 0xF9, 0x6F, 0xA2,
+    0x9F, 0xFA, 0x2A, 0xFF, 0x0F, 0xFD, 0x1A, 0xFF, 0xC0, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x19, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x4F, 0xFF, 0xE9, 0x19, 0xFF, 0xFE, 0xA1, 0x9F, 0xCA, 0xAA, 0xAA,
+    0xFC, 0xA2, 0xFC, 0x95, 0x9E, 0x3F, 0xC6, 0xDA, 0x3A, 0xFA, 0x5A, 0xC9, 0x4F, 0xC7, 0x6F, 0xC7,
+    0x59, 0xF9, 0x75, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x76, 0xF7, 0x5F, 0x97, 0x4A, 0xEA, 0x74, 0x9F,
+    0x75, 0xF7, 0x5F, 0x96, 0xAA, 0x3A, 0xEA, 0x69, 0xD9, 0x19, 0xF7, 0xE9, 0x1F, 0x79, 0xE9, 0x0F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1A, 0xFF, 0xFE, 0xA2, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x00, 0x75, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x74,
+    0xEA, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x4E, 0x97,
+    0x3A, 0xE7, 0x39, 0xE9, 0x73, 0xEA, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x97, 0x3E,
+    0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4E, 0x97, 0x3E, 0xA7, 0x39, 0xE7, 0x59, 0x97, 0x50,
+    0x0F, 0x72, 0x9E, 0x97, 0x2F, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72,
+    0x9E, 0x97, 0x2F, 0x72, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x97,
+    0x2F, 0x72, 0xAE, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x3E, 0xA7, 0x2F, 0x73, 0x99, 0x90, 0x5A, 0xA9,
+    0x71, 0x9D, 0x97, 0x19, 0xD9, 0x5A, 0xC9, 0x09, 0xD9, 0x09, 0xCA, 0x1F, 0x9D, 0x9F, 0x1A, 0xFF,
+    0xDA, 0x3A, 0xFD, 0xA5, 0x9F, 0xD9, 0x39, 0xFF, 0xD9, 0x09, 0xFA, 0xDA, 0xF9, 0x0E, 0x09, 0xD9,
+    0x0E, 0x29, 0x19, 0xD9, 0x19, 0x69, 0xD9, 0x71, 0x9D, 0x94, 0x39, 0xAA, 0xA9, 0x49, 0xFD, 0xA2,
+    0x9F, 0xFA, 0x1E, 0xA1, 0xAE, 0x1E, 0x3E, 0x1E, 0x3E, 0x1E, 0x3E, 0x1F, 0x99, 0xEA, 0x19, 0xFF,
+    0x39, 0xFD, 0x69, 0x99, 0x40, 0x29, 0x2F, 0x0A, 0xFA, 0xAF, 0xA0, 0xF6, 0x77, 0x99, 0x97, 0x6A,
+    0xDA, 0x76, 0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xD9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76,
+    0xE7, 0x7E, 0x39, 0x99, 0x99, 0x5A, 0xDA, 0x29, 0xFC, 0xA4, 0xE9, 0x29, 0xFD, 0x4E, 0x4A, 0xAF,
+    0x39, 0xDA, 0x69, 0xE9, 0x2A, 0xD9, 0x7E, 0xA2, 0xE7, 0x0F, 0x19, 0xDA, 0x70, 0xAE, 0x1A, 0xD9,
+    0x71, 0xE9, 0x0E, 0x72, 0xEA, 0x0E, 0x72, 0xAE, 0x9D, 0x97, 0x29, 0xFD, 0x74, 0xFD, 0x74, 0xAF,
+    0xA7, 0x49, 0xF7, 0x6F, 0x77, 0x99, 0x70, 0x39, 0x96, 0x91, 0xAF, 0x92, 0x9D, 0x0F, 0xE9, 0x0A,
+    0xE9, 0xEA, 0xAE, 0xAE, 0x9A, 0xD9, 0x19, 0xFA, 0x1E, 0x3A, 0xE2, 0xE3, 0xF9, 0x1A, 0xDA, 0x1A,
+    0xFC, 0x90, 0x9F, 0xE9, 0x9E, 0xA0, 0xFD, 0x91, 0xAE, 0x1A, 0xDA, 0x93, 0x9D, 0x75, 0x39, 0x79,
+    0x94, 0xAF, 0x39, 0xF9, 0x1A, 0xFD, 0x1A, 0xFD, 0x1E, 0xAA, 0xEA, 0xEA, 0xE9, 0xAD, 0x91, 0x9F,
+    0x91, 0x9D, 0xAA, 0xD3, 0xAE, 0x3D, 0xAA, 0xD9, 0x2F, 0x3D, 0xAA, 0xDA, 0x1F, 0xD1, 0xAD, 0xA9,
+    0xFE, 0x99, 0xFE, 0x1A, 0xFC, 0x91, 0xAF, 0xCA, 0x2A, 0xE9, 0x39, 0xE9, 0x10, 0x77, 0x3E, 0x97,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x00,
+    0x77, 0x77, 0x6A, 0xA7, 0x73, 0x9E, 0x77, 0x2F, 0x97, 0x70, 0xFA, 0x77, 0x0F, 0xA7, 0x70, 0xAF,
+    0x77, 0x09, 0xF7, 0x71, 0xF9, 0x77, 0x0F, 0xA7, 0x70, 0xFA, 0x77, 0x0A, 0xF7, 0x70, 0x9F, 0x77,
+    0x1F, 0x97, 0x70, 0xF9, 0x77, 0x0F, 0xA7, 0x70, 0xAF, 0x77, 0x09, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x09, 0x99, 0x0A,
+    0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0,
+    0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE,
+    0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x0A, 0xE0, 0xAE, 0x09, 0xAA, 0xA0, 0x09, 0x99, 0x29, 0x99,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A,
+    0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE,
+    0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A,
+    0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1, 0xAE, 0x0A, 0xE1,
+    0xAE, 0x0A, 0xE1, 0xAE, 0x09, 0xAA, 0xA1, 0x9A, 0xAA, 0x00, 0x77, 0x75, 0xE9, 0x77, 0xAF, 0x77,
+    0xFC, 0x97, 0x59, 0xFC, 0xA7, 0x5F, 0xE7, 0x5E, 0xAE, 0xA7, 0x3A, 0xE0, 0xF7, 0x3E, 0xA0, 0x9E,
+    0x97, 0x19, 0xE9, 0x1E, 0xA7, 0x1F, 0x2A, 0xE7, 0x09, 0xEA, 0x29, 0xEA, 0x7A, 0xE4, 0xF7, 0xF4,
+    0x9E, 0x95, 0xAE, 0x95, 0xF5, 0xF6, 0xAE, 0x49, 0xEA, 0x69, 0xEA, 0x3A, 0xE7, 0x0F, 0x3F, 0x70,
+    0xAE, 0x91, 0xAE, 0x97, 0x1F, 0x1F, 0x72, 0xF0, 0x77, 0x5F, 0x72, 0xF1, 0xAE, 0x97, 0x1F, 0x2F,
+    0x70, 0xAE, 0x92, 0xAE, 0x70, 0xF3, 0x9E, 0xA6, 0x9E, 0xA4, 0xF6, 0xF5, 0x9E, 0x95, 0xEA, 0x6F,
+    0x4A, 0xE9, 0x6A, 0xE4, 0xF7, 0x0E, 0xA2, 0x9E, 0xA7, 0x0F, 0x2A, 0xE7, 0x19, 0xE9, 0x1E, 0xA7,
+    0x2F, 0x09, 0xE9, 0x72, 0xAE, 0x0F, 0x74, 0xFE, 0x97, 0x4F, 0xE7, 0x59, 0xFC, 0xA7, 0x6F, 0xC7,
+    0x7A, 0xF7, 0x70, 0xE9, 0x70, 0x49, 0xAA, 0xAA, 0xA9, 0x79, 0xFF, 0xC9, 0x4A, 0xFF, 0xEA, 0x29,
+    0xFC, 0xAA, 0xAF, 0xC9, 0x1F, 0x94, 0xAF, 0x1E, 0xA6, 0xAE, 0x09, 0xE7, 0x0E, 0x99, 0xE7, 0x0E,
+    0x9A, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA,
+    0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7,
+    0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xA0, 0x77, 0x0A, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA,
+    0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7,
+    0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E, 0xAA, 0xE7, 0x0E,
+    0xA9, 0xE7, 0x0E, 0x99, 0xE9, 0x69, 0xE9, 0x0E, 0xA6, 0xAE, 0x1F, 0xA4, 0xAF, 0x19, 0xFF, 0xFC,
+    0x39, 0xFF, 0xE9, 0x5A, 0xFE, 0xA7, 0x19, 0x99, 0x99, 0x50, 0x71, 0xAA, 0xA9, 0x71, 0xAF, 0xD9,
+    0x6F, 0xFC, 0x59, 0xF9, 0xAD, 0xA5, 0xF9, 0x1C, 0xA6, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF6,
+    0x9C, 0x19, 0xF5, 0xAD, 0xA0, 0xAE, 0xA5, 0xFF, 0xC6, 0x9F, 0xE7, 0x1A, 0xAC, 0xA9, 0x70, 0x77,
+    0x71, 0x9E, 0x97, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x69, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0xF7, 0x0A, 0xE0, 0xAF, 0x96, 0x9F, 0xAA, 0xF9, 0x69, 0xFA, 0x9F, 0x70,
+    0xF9, 0x19, 0x97, 0x29, 0x91, 0x77, 0x3A, 0xDA, 0x70, 0xAE, 0x0A, 0xF9, 0x69, 0xFA, 0xAF, 0x96,
+    0x9F, 0xA9, 0xF7, 0x0F, 0x90, 0x9A, 0x97, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0x9E, 0xA7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5A, 0xEA, 0x76, 0x99, 0x97, 0x39, 0x93, 0xEA,
+    0x1F, 0xA1, 0xF9, 0x1A, 0xDA, 0x77, 0x77, 0x74, 0x99, 0x3F, 0x1A, 0xF1, 0xAE, 0xA1, 0x9D, 0xA7,
+    0x10, 0x77, 0x3A, 0xDA, 0x70, 0xAE, 0x0A, 0xF9, 0x69, 0xFA, 0xAF, 0x96, 0x9F, 0xA9, 0xF7, 0x0F,
+    0x90, 0x9A, 0x97, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0x70, 0xAE,
+    0x0A, 0xF9, 0x69, 0xFA, 0xAF, 0x96, 0x9F, 0xA9, 0xF7, 0x0F, 0x91, 0x99, 0x72, 0x99, 0x10, 0x77,
+    0x3A, 0xAA, 0xA9, 0x59, 0xA1, 0x9F, 0xE9, 0x29, 0xDA, 0x9F, 0xFF, 0xE9, 0xAD, 0x92, 0xAF, 0xEA,
+    0x1C, 0xA5, 0xAE, 0xA9, 0x77, 0x20, 0x77, 0x2A, 0xFC, 0x94, 0xD1, 0xFF, 0xC9, 0x09, 0xEA, 0xAE,
+    0xAA, 0xFF, 0xD0, 0xAD, 0x4A, 0xFD, 0x29, 0x79, 0xA9, 0x97, 0x77, 0x74, 0xAF, 0xFF, 0xE9, 0xAF,
+    0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x77, 0x00, 0x29, 0x97, 0x19, 0xFC, 0x3A, 0xCA, 0x9F, 0xEA,
+    0x09, 0xFE, 0xAF, 0xFA, 0xE2, 0xAF, 0xD1, 0xA9, 0x4A, 0xD9, 0x49, 0x99, 0x59, 0x19, 0xFC, 0x3A,
+    0xCA, 0x9F, 0xEA, 0x09, 0xFE, 0xAF, 0xFA, 0xE2, 0xAF, 0xD1, 0xA9, 0x4A, 0xD9, 0x10, 0x77, 0x1D,
+    0xA9, 0x94, 0x99, 0xAD, 0x1F, 0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x49, 0x9A, 0xAA, 0xAA, 0x99, 0x77,
+    0x77, 0x70, 0x9A, 0xAA, 0xEA, 0xAA, 0x93, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xCA, 0x97, 0x09, 0xAC,
+    0x77, 0x10, 0x77, 0x6D, 0x97, 0x1A, 0xD9, 0x19, 0xFF, 0xF9, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x5E,
+    0x71, 0xAD, 0x95, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x09, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x99, 0xE9,
+    0x99, 0x99, 0x99, 0x29, 0xD9, 0x72, 0xAA, 0x77, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x0A, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97,
+    0x77, 0x72, 0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x77, 0x77, 0x19, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x77, 0x00, 0x77, 0x7A,
+    0xCA, 0x70, 0xAF, 0x6A, 0xFC, 0x94, 0xAF, 0xC9, 0x4A, 0xFA, 0x59, 0xFA, 0x79, 0xFA, 0x70, 0x9F,
+    0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xC7, 0x1A, 0xE7, 0x3A, 0x77, 0x9F, 0xFF,
+    0x99, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x19, 0x73, 0xAD, 0x97, 0x1F, 0xC9, 0x79, 0xAF, 0xC9, 0x70,
+    0xAF, 0xC9, 0x70, 0xAF, 0xC9, 0x70, 0xAF, 0x97, 0x9F, 0x95, 0xAF, 0xC9, 0x4A, 0xFC, 0x94, 0xAF,
+    0xC9, 0x5F, 0xC9, 0x7A, 0xCA, 0x97, 0x77, 0x74, 0x9F, 0xFF, 0x99, 0xFF, 0xF9, 0x9F, 0xFF, 0x90,
+    0x77, 0x77, 0x2A, 0xCA, 0x7A, 0xC9, 0x70, 0xAF, 0x49, 0xFC, 0x6A, 0xFC, 0x92, 0x9F, 0xCA, 0x5A,
+    0xFC, 0x92, 0x9F, 0xCA, 0x5A, 0xFA, 0x39, 0xFC, 0xA6, 0xFA, 0x4A, 0xF9, 0x79, 0xFA, 0x4A, 0xF9,
+    0x70, 0x9F, 0xCA, 0x39, 0xFC, 0xA7, 0x09, 0xFC, 0xA3, 0x9F, 0xCA, 0x70, 0x9F, 0xCA, 0x3A, 0xFC,
+    0xA7, 0x09, 0xFC, 0x4A, 0xFC, 0x71, 0x9E, 0x6A, 0xD9, 0x73, 0x99, 0x70, 0xA1, 0x77, 0x71, 0x9C,
+    0xA7, 0xAC, 0xA7, 0x2F, 0xA9, 0x4F, 0xA7, 0x1A, 0xFC, 0x92, 0x9F, 0xCA, 0x71, 0xAF, 0xC9, 0x29,
+    0xFC, 0xA7, 0x1A, 0xFC, 0x93, 0xAF, 0xA7, 0x19, 0xFA, 0x4A, 0xF7, 0x09, 0xFA, 0x4A, 0xF6, 0xAF,
+    0xC9, 0x3A, 0xFC, 0x94, 0xAF, 0xC9, 0x3A, 0xFC, 0x94, 0xAF, 0xCA, 0x3A, 0xFC, 0x95, 0xFC, 0xA3,
+    0x9F, 0xC9, 0x7A, 0xDA, 0x6E, 0x97, 0x2A, 0x70, 0x99, 0x72, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x71, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x77, 0x9F, 0xC7, 0x70, 0xF9, 0x77, 0x9F,
+    0x77, 0x0F, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7F, 0x97, 0x5A, 0xFC, 0x2F,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99, 0x99, 0x99, 0x99, 0x97, 0x10, 0x76,
+    0x99, 0x97, 0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xE9, 0x74, 0x99, 0x9A, 0xE9, 0x99, 0x59, 0xAF,
+    0xFF, 0xC4, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x2F, 0xCA, 0x3E, 0xA5, 0x9F, 0x49, 0xE6, 0xF9, 0x4A,
+    0xE6, 0xF5, 0xEA, 0x6F, 0x49, 0xE7, 0xF4, 0xF7, 0xF4, 0xE9, 0x7F, 0x92, 0x9E, 0x70, 0x9F, 0x2E,
+    0xA7, 0x1F, 0xCA, 0x9E, 0x97, 0x2F, 0xFF, 0xFC, 0x4F, 0xFF, 0xF5, 0x9A, 0xFF, 0xFC, 0x7A, 0xE9,
+    0x99, 0x99, 0x99, 0x99, 0x7E, 0xA7, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xAA, 0x97, 0x20, 0x73,
+    0x99, 0x97, 0x70, 0xF7, 0x70, 0xE9, 0x77, 0xAE, 0x79, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x7F, 0xFF,
+    0xCA, 0x95, 0xFF, 0xFF, 0x4F, 0xFF, 0xFC, 0x72, 0x9E, 0x9A, 0xFC, 0x71, 0xAE, 0x2F, 0x97, 0x0E,
+    0xA2, 0xAF, 0x79, 0xE4, 0xF7, 0xF4, 0xF7, 0xE9, 0x4F, 0x6A, 0xE5, 0xF6, 0xEA, 0x49, 0xF6, 0xE9,
+    0x4F, 0x95, 0xAE, 0x39, 0xFC, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0xFF, 0xFC, 0xA9, 0x59, 0x99,
+    0xEA, 0x99, 0x99, 0x73, 0x9E, 0x77, 0x0E, 0xA7, 0x70, 0xE9, 0x77, 0x09, 0x99, 0x76, 0x77, 0x79,
+    0xAF, 0xFE, 0xA2, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFA, 0x0A, 0xFC, 0x99, 0x72, 0xF9, 0x74, 0x9E,
+    0xA7, 0x5A, 0xE9, 0x75, 0xAE, 0x97, 0x5A, 0xEA, 0x75, 0x9F, 0x76, 0xFA, 0x75, 0x9F, 0xCA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0x9F, 0xFF, 0xEA, 0x3F, 0xFF, 0xDA, 0x59, 0xAA, 0xFF, 0xCA, 0x77,
+    0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFC, 0xA0, 0x77, 0x2A, 0xFF, 0xEA, 0x94, 0xAF, 0xFF, 0xDA, 0x2A, 0xFF, 0xFF, 0x73,
+    0x99, 0xFC, 0xA7, 0x59, 0xF7, 0x6A, 0xE9, 0x75, 0x9E, 0xA7, 0x59, 0xEA, 0x75, 0xAE, 0xA7, 0x5F,
+    0x97, 0x4A, 0xF0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x90, 0xAF, 0xFF, 0xE9, 0x1A, 0xFF,
+    0xFD, 0x3A, 0xFF, 0xCA, 0xA9, 0x77, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x00, 0x70, 0x99, 0x97, 0x6A, 0xFE,
+    0xA7, 0x1A, 0xFF, 0xEA, 0x6E, 0xA1, 0xAC, 0xA1, 0xAE, 0x4E, 0x92, 0xAC, 0xA2, 0x9E, 0x29, 0xD9,
+    0x3A, 0xCA, 0x39, 0xD9, 0x1D, 0xA4, 0xAC, 0xA4, 0xAD, 0x09, 0xD5, 0xAC, 0xA5, 0xD9, 0xAC, 0xA5,
+    0xAC, 0xA5, 0xDA, 0xDA, 0x5A, 0xCA, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0xAC, 0xA5,
+    0xAD, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA9, 0xD5, 0xAC, 0xA5, 0xD9, 0x0D, 0xA4, 0xAC, 0xA4, 0xAD,
+    0x1A, 0xD4, 0xAC, 0xA4, 0xDA, 0x2E, 0x3A, 0xCA, 0x3E, 0x4E, 0xA1, 0xAC, 0xA1, 0xAE, 0x6A, 0xFF,
+    0xEA, 0x70, 0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x70, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A,
+    0xFA, 0xAA, 0xFA, 0x6E, 0xA6, 0xAE, 0x4E, 0x97, 0x09, 0xE2, 0x9D, 0x97, 0x29, 0xD9, 0x1D, 0xA7,
+    0x4A, 0xD0, 0x9D, 0x76, 0xD9, 0xAC, 0xA7, 0x6A, 0xCA, 0xDA, 0x76, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDA, 0x76, 0xAD, 0xAC, 0xA7, 0x6A, 0xCA, 0x9D, 0x76, 0xD9, 0x0D, 0xA7, 0x4A, 0xD1, 0xAD,
+    0x74, 0xDA, 0x2E, 0x72, 0xE4, 0xEA, 0x6A, 0xE6, 0xAF, 0xAA, 0xAF, 0xA7, 0x09, 0xFF, 0xC9, 0x74,
+    0x99, 0x99, 0x97, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xFA, 0xAA, 0xFA, 0x6E, 0xA6, 0xAE,
+    0x4E, 0xA7, 0x0A, 0xE2, 0x9F, 0xA6, 0xAF, 0x91, 0xDA, 0xAD, 0xA4, 0xAD, 0xAA, 0xD0, 0x9D, 0x1A,
+    0xDA, 0x2A, 0xDA, 0x1D, 0x9A, 0xCA, 0x2A, 0xDA, 0x0A, 0xDA, 0x2D, 0xAD, 0xA3, 0xAF, 0xCA, 0x3A,
+    0xF9, 0x4A, 0xEA, 0x49, 0xF9, 0x4A, 0xE9, 0x49, 0xFA, 0x3A, 0xFC, 0x93, 0xAD, 0xAC, 0xA2, 0xAD,
+    0xA0, 0xAD, 0x92, 0xAC, 0xA9, 0xD1, 0xAD, 0xA2, 0xAD, 0xA1, 0xD9, 0x0D, 0xAA, 0xDA, 0x4A, 0xDA,
+    0xAD, 0x1A, 0xFA, 0x6A, 0xFA, 0x2E, 0xA7, 0x0F, 0x4E, 0xA6, 0xAE, 0x6A, 0xFA, 0xAA, 0xFA, 0x70,
+    0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x70, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xFA, 0xAA,
+    0xFA, 0x6E, 0xA6, 0xAE, 0x4E, 0x97, 0x0A, 0xE2, 0x9D, 0x97, 0x0A, 0xF9, 0x1D, 0xA7, 0x0A, 0xDA,
+    0xAD, 0x09, 0xD7, 0x0A, 0xDA, 0x1D, 0x9A, 0xD7, 0xAD, 0xA2, 0xDA, 0xDA, 0x6A, 0xDA, 0x3A, 0xF9,
+    0x5A, 0xDA, 0x49, 0xF9, 0x4A, 0xDA, 0x59, 0xFA, 0x3A, 0xDA, 0x6A, 0xDA, 0xCA, 0x2A, 0xDA, 0x7D,
+    0xA9, 0xD1, 0xAD, 0xA7, 0x0D, 0x90, 0xDA, 0xAD, 0xA7, 0x0A, 0xD1, 0xAF, 0xA7, 0x1D, 0xA2, 0xEA,
+    0x70, 0x9E, 0x4E, 0xA6, 0xAE, 0x6A, 0xFA, 0xAA, 0xFA, 0x70, 0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99,
+    0x70, 0x77, 0x69, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E,
+    0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97,
+    0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x95, 0x9A, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA,
+    0xAA, 0x9A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA0, 0x29, 0x2F, 0x0A, 0xFA, 0xAF,
+    0xA0, 0xF6, 0x19, 0x97, 0x97, 0x09, 0x2F, 0x4A, 0xEA, 0x4F, 0x9A, 0xF9, 0x3F, 0xC3, 0x9F, 0xAA,
+    0xF9, 0x3F, 0xC3, 0x9F, 0xA9, 0xF4, 0xAE, 0x94, 0xF7, 0x77, 0x10, 0x74, 0xA7, 0x77, 0x0A, 0xCA,
+    0x77, 0x6A, 0xEA, 0x77, 0x4A, 0xFC, 0xA7, 0x72, 0xAC, 0xA9, 0x9A, 0xDA, 0x77, 0x0A, 0xC5, 0xAC,
+    0xA7, 0x6A, 0xCA, 0x69, 0xCA, 0x74, 0xAE, 0x09, 0xAA, 0x92, 0xAC, 0xA7, 0x2A, 0xFF, 0xD2, 0xDA,
+    0x70, 0xAF, 0xFF, 0x1E, 0xA6, 0xAF, 0xFF, 0xC1, 0xAE, 0xA4, 0xAF, 0xFF, 0xD1, 0xAF, 0xA2, 0xAF,
+    0xFF, 0xD9, 0x1A, 0xFC, 0xA0, 0xAF, 0xFE, 0xA9, 0x4F, 0xEA, 0x0F, 0xFD, 0x6F, 0xF2, 0xFF, 0xC4,
+    0xAF, 0xF4, 0xFF, 0x2A, 0xFF, 0xC6, 0xFE, 0x1A, 0xFF, 0xC7, 0x0F, 0xD9, 0x09, 0xFF, 0x72, 0xFF,
+    0xFE, 0x74, 0xFD, 0xAF, 0xD7, 0x6F, 0x2F, 0x77, 0x0E, 0x2E, 0x77, 0x2D, 0x90, 0xAD, 0x77, 0x4F,
+    0xC7, 0x76, 0xE7, 0x77, 0x0C, 0x77, 0x77, 0x70,
 };
 
 static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 9, 23, 11, 1, 22, 52, 0 }, // !
-    { 11, 10, 13, 1, 21, 28, 52 }, // "
-    { 18, 19, 19, 0, 17, 86, 80 }, // #
-    { 16, 30, 18, 1, 24, 120, 166 }, // $
-    { 26, 24, 29, 1, 22, 156, 286 }, // %
-    { 24, 24, 26, 1, 22, 144, 442 }, // &
-    { 6, 10, 8, 1, 21, 15, 586 }, // '
-    { 13, 30, 15, 1, 24, 98, 601 }, // (
-    { 14, 30, 13, -2, 24, 105, 699 }, // )
-    { 11, 11, 13, 1, 22, 31, 804 }, // *
-    { 14, 14, 18, 2, 17, 49, 835 }, // +
-    { 9, 10, 9, -2, 5, 23, 884 }, // ,
-    { 10, 5, 12, 1, 10, 13, 907 }, // -
-    { 6, 6, 9, 1, 5, 9, 920 }, // .
-    { 17, 23, 17, -1, 21, 98, 929 }, // /
-    { 18, 22, 19, 0, 21, 99, 1027 }, // 0
-    { 13, 21, 18, 2, 21, 69, 1126 }, // 1
-    { 17, 21, 18, 0, 21, 90, 1195 }, // 2
-    { 17, 22, 18, 0, 21, 94, 1285 }, // 3
-    { 17, 21, 18, 0, 21, 90, 1379 }, // 4
-    { 17, 21, 19, 1, 20, 90, 1469 }, // 5
-    { 18, 22, 20, 1, 21, 99, 1559 }, // 6
-    { 16, 21, 20, 3, 20, 84, 1658 }, // 7
-    { 17, 22, 19, 1, 21, 94, 1742 }, // 8
-    { 18, 22, 18, -1, 21, 99, 1836 }, // 9
-    { 8, 17, 10, 1, 16, 34, 1935 }, // :
-    { 11, 21, 10, -2, 16, 58, 1969 }, // ;
-    { 14, 14, 18, 2, 17, 49, 2027 }, // <
-    { 14, 9, 18, 2, 14, 32, 2076 }, // =
-    { 14, 14, 18, 2, 17, 49, 2108 }, // >
-    { 10, 23, 13, 2, 22, 58, 2157 }, // ?
-    { 27, 27, 29, 1, 21, 183, 2215 }, // @
-    { 23, 21, 22, -2, 21, 121, 2398 }, // A
-    { 19, 22, 18, -2, 21, 105, 2519 }, // B
-    { 19, 22, 20, 0, 21, 105, 2624 }, // C
-    { 22, 22, 22, -1, 21, 121, 2729 }, // D
-    { 21, 21, 20, -2, 21, 111, 2850 }, // E
-    { 20, 21, 19, -2, 21, 105, 2961 }, // F
-    { 20, 22, 21, 0, 21, 110, 3066 }, // G
-    { 27, 21, 26, -2, 21, 142, 3176 }, // H
-    { 15, 21, 14, -2, 21, 79, 3318 }, // I
-    { 19, 27, 14, -6, 21, 129, 3397 }, // J
-    { 24, 22, 23, -2, 21, 132, 3526 }, // K
-    { 18, 21, 17, -2, 21, 95, 3658 }, // L
-    { 28, 21, 27, -2, 21, 147, 3753 }, // M
-    { 25, 22, 25, -1, 21, 138, 3900 }, // N
-    { 21, 22, 22, 0, 21, 116, 4038 }, // O
-    { 20, 21, 19, -2, 21, 105, 4154 }, // P
-    { 25, 28, 26, 0, 21, 175, 4259 }, // Q
-    { 21, 22, 20, -2, 21, 116, 4434 }, // R
-    { 17, 22, 17, -1, 21, 94, 4550 }, // S
-    { 20, 21, 22, 1, 21, 105, 4644 }, // T
-    { 22, 22, 25, 2, 21, 121, 4749 }, // U
-    { 23, 22, 25, 1, 21, 127, 4870 }, // V
-    { 29, 22, 32, 2, 21, 160, 4997 }, // W
-    { 24, 21, 22, -3, 21, 126, 5157 }, // X
-    { 21, 21, 23, 1, 21, 111, 5283 }, // Y
-    { 19, 22, 19, -1, 21, 105, 5394 }, // Z
-    { 14, 28, 13, -2, 23, 98, 5499 }, // [
-    { 13, 23, 15, 1, 21, 75, 5597 }, // <backslash>
-    { 14, 28, 13, -2, 23, 98, 5672 }, // ]
-    { 16, 14, 18, 1, 19, 56, 5770 }, // ^
-    { 15, 4, 16, 0, -1, 15, 5826 }, // _
-    { 6, 8, 18, 6, 25, 12, 5841 }, // `
-    { 17, 17, 18, 0, 16, 73, 5853 }, // a
-    { 16, 24, 17, 0, 23, 96, 5926 }, // b
-    { 13, 17, 14, 0, 16, 56, 6022 }, // c
-    { 17, 24, 18, 0, 23, 102, 6078 }, // d
-    { 14, 17, 15, 0, 16, 60, 6180 }, // e
-    { 22, 30, 17, -6, 23, 165, 6240 }, // f
-    { 20, 23, 19, -2, 16, 115, 6405 }, // g
-    { 17, 24, 18, 0, 23, 102, 6520 }, // h
-    { 9, 24, 11, 1, 23, 54, 6622 }, // i
-    { 16, 30, 11, -6, 23, 120, 6676 }, // j
-    { 15, 24, 16, 0, 23, 90, 6796 }, // k
-    { 9, 24, 10, 0, 23, 54, 6886 }, // l
-    { 25, 17, 26, 0, 16, 107, 6940 }, // m
-    { 18, 17, 19, 0, 16, 77, 7047 }, // n
-    { 15, 17, 16, 0, 16, 64, 7124 }, // o
-    { 19, 23, 17, -3, 16, 110, 7188 }, // p
-    { 17, 23, 18, 0, 16, 98, 7298 }, // q
-    { 15, 16, 16, 0, 16, 60, 7396 }, // r
-    { 14, 17, 14, -1, 16, 60, 7456 }, // s
-    { 13, 20, 14, 0, 19, 65, 7516 }, // t
-    { 18, 17, 19, 0, 16, 77, 7581 }, // u
-    { 15, 17, 16, 0, 16, 64, 7658 }, // v
-    { 22, 17, 23, 0, 16, 94, 7722 }, // w
-    { 18, 17, 18, -1, 16, 77, 7816 }, // x
-    { 20, 23, 16, -5, 16, 115, 7893 }, // y
-    { 15, 17, 15, -1, 16, 64, 8008 }, // z
-    { 13, 29, 15, 1, 24, 95, 8072 }, // {
-    { 10, 27, 10, -1, 23, 68, 8167 }, // |
-    { 13, 29, 12, -2, 24, 95, 8235 }, // }
-    { 14, 7, 18, 2, 13, 25, 8330 }, // ~
-    { 0, 0, 6, 0, 0, 0, 8355 }, //  
-    { 10, 23, 10, -1, 16, 58, 8355 }, // ¡
-    { 16, 29, 18, 1, 23, 116, 8413 }, // ¢
-    { 19, 22, 19, -1, 21, 105, 8529 }, // £
-    { 18, 14, 19, 0, 17, 63, 8634 }, // ¤
-    { 20, 20, 22, 1, 20, 100, 8697 }, // ¥
-    { 10, 27, 10, -1, 23, 68, 8797 }, // ¦
-    { 15, 23, 15, -1, 20, 87, 8865 }, // §
-    { 10, 5, 18, 4, 23, 13, 8952 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8965 }, // ©
-    { 12, 15, 14, 1, 21, 45, 9086 }, // ª
-    { 16, 12, 18, 1, 13, 48, 9131 }, // «
-    { 14, 8, 18, 2, 14, 28, 9179 }, // ¬
-    { 10, 5, 12, 1, 10, 13, 9207 }, // ­
-    { 17, 16, 18, 0, 23, 68, 9220 }, // ®
-    { 10, 3, 18, 4, 21, 8, 9288 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 9296 }, // °
-    { 14, 18, 18, 2, 17, 63, 9329 }, // ±
-    { 12, 14, 13, 0, 24, 42, 9392 }, // ²
-    { 11, 14, 13, 1, 24, 39, 9434 }, // ³
-    { 6, 8, 18, 6, 25, 12, 9473 }, // ´
-    { 20, 23, 19, -2, 16, 115, 9485 }, // µ
-    { 20, 26, 20, -1, 21, 130, 9600 }, // ¶
-    { 5, 6, 9, 2, 11, 8, 9730 }, // ·
-    { 7, 7, 18, 6, -1, 13, 9738 }, // ¸
-    { 9, 14, 13, 1, 24, 32, 9751 }, // ¹
-    { 12, 15, 14, 1, 21, 45, 9783 }, // º
-    { 17, 12, 18, 0, 13, 51, 9828 }, // »
-    { 30, 24, 32, 1, 22, 180, 9879 }, // ¼
-    { 30, 24, 32, 1, 22, 180, 10059 }, // ½
-    { 30, 24, 32, 1, 22, 180, 10239 }, // ¾
-    { 10, 23, 12, 0, 16, 58, 10419 }, // ¿
-    { 23, 29, 22, -2, 29, 167, 10477 }, // À
-    { 23, 29, 22, -2, 29, 167, 10644 }, // Á
-    { 23, 29, 22, -2, 29, 167, 10811 }, // Â
-    { 23, 28, 22, -2, 28, 161, 10978 }, // Ã
-    { 23, 27, 22, -2, 27, 156, 11139 }, // Ä
-    { 23, 29, 22, -2, 29, 167, 11295 }, // Å
-    { 31, 21, 29, -3, 21, 163, 11462 }, // Æ
-    { 19, 29, 20, 0, 21, 138, 11625 }, // Ç
-    { 21, 29, 20, -2, 29, 153, 11763 }, // È
-    { 21, 29, 20, -2, 29, 153, 11916 }, // É
-    { 21, 29, 20, -2, 29, 153, 12069 }, // Ê
-    { 21, 27, 20, -2, 27, 142, 12222 }, // Ë
-    { 15, 29, 14, -2, 29, 109, 12364 }, // Ì
-    { 15, 29, 14, -2, 29, 109, 12473 }, // Í
-    { 16, 29, 15, -2, 29, 116, 12582 }, // Î
-    { 16, 27, 15, -2, 27, 108, 12698 }, // Ï
-    { 22, 22, 22, -1, 21, 121, 12806 }, // Ð
-    { 25, 29, 25, -1, 28, 182, 12927 }, // Ñ
-    { 21, 30, 22, 0, 29, 158, 13109 }, // Ò
-    { 21, 30, 22, 0, 29, 158, 13267 }, // Ó
-    { 21, 30, 22, 0, 29, 158, 13425 }, // Ô
-    { 21, 29, 22, 0, 28, 153, 13583 }, // Õ
-    { 21, 28, 22, 0, 27, 147, 13736 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 13883 }, // ×
-    { 24, 23, 24, -1, 22, 138, 13926 }, // Ø
-    { 22, 30, 25, 2, 29, 165, 14064 }, // Ù
-    { 22, 30, 25, 2, 29, 165, 14229 }, // Ú
-    { 22, 30, 25, 2, 29, 165, 14394 }, // Û
-    { 22, 28, 25, 2, 27, 154, 14559 }, // Ü
-    { 21, 29, 23, 1, 29, 153, 14713 }, // Ý
-    { 19, 21, 18, -2, 21, 100, 14866 }, // Þ
-    { 24, 30, 19, -6, 23, 180, 14966 }, // ß
-    { 17, 26, 18, 0, 25, 111, 15146 }, // à
-    { 17, 26, 18, 0, 25, 111, 15257 }, // á
-    { 17, 25, 18, 0, 24, 107, 15368 }, // â
-    { 17, 24, 18, 0, 23, 102, 15475 }, // ã
-    { 17, 24, 18, 0, 23, 102, 15577 }, // ä
-    { 17, 26, 18, 0, 25, 111, 15679 }, // å
-    { 23, 17, 24, 0, 16, 98, 15790 }, // æ
-    { 13, 24, 14, 0, 16, 78, 15888 }, // ç
-    { 14, 26, 15, 0, 25, 91, 15966 }, // è
-    { 15, 26, 16, 0, 25, 98, 16057 }, // é
-    { 14, 25, 15, 0, 24, 88, 16155 }, // ê
-    { 15, 24, 16, 0, 23, 90, 16243 }, // ë
-    { 8, 26, 10, 1, 25, 52, 16333 }, // ì
-    { 11, 26, 13, 1, 25, 72, 16385 }, // í
-    { 11, 25, 13, 1, 24, 69, 16457 }, // î
-    { 11, 24, 13, 1, 23, 66, 16526 }, // ï
-    { 16, 25, 17, 0, 24, 100, 16592 }, // ð
-    { 18, 24, 19, 0, 23, 108, 16692 }, // ñ
-    { 15, 26, 16, 0, 25, 98, 16800 }, // ò
-    { 16, 26, 17, 0, 25, 104, 16898 }, // ó
-    { 15, 25, 16, 0, 24, 94, 17002 }, // ô
-    { 16, 24, 17, 0, 23, 96, 17096 }, // õ
-    { 16, 24, 17, 0, 23, 96, 17192 }, // ö
-    { 14, 14, 18, 2, 17, 49, 17288 }, // ÷
-    { 19, 17, 18, -2, 16, 81, 17337 }, // ø
-    { 18, 26, 19, 0, 25, 117, 17418 }, // ù
-    { 18, 26, 19, 0, 25, 117, 17535 }, // ú
-    { 18, 25, 19, 0, 24, 113, 17652 }, // û
-    { 18, 24, 19, 0, 23, 108, 17765 }, // ü
-    { 20, 32, 16, -5, 25, 160, 17873 }, // ý
-    { 19, 30, 17, -3, 23, 143, 18033 }, // þ
-    { 20, 30, 16, -5, 23, 150, 18176 }, // ÿ
-    { 23, 26, 22, -2, 26, 150, 18326 }, // Ā
-    { 17, 22, 18, 0, 21, 94, 18476 }, // ā
-    { 23, 28, 22, -2, 28, 161, 18570 }, // Ă
-    { 17, 24, 18, 0, 23, 102, 18731 }, // ă
-    { 23, 28, 22, -2, 21, 161, 18833 }, // Ą
-    { 17, 23, 18, 0, 16, 98, 18994 }, // ą
-    { 19, 30, 20, 0, 29, 143, 19092 }, // Ć
-    { 15, 26, 16, 0, 25, 98, 19235 }, // ć
-    { 19, 30, 20, 0, 29, 143, 19333 }, // Ĉ
-    { 14, 25, 15, 0, 24, 88, 19476 }, // ĉ
-    { 19, 29, 20, 0, 28, 138, 19564 }, // Ċ
-    { 13, 24, 14, 0, 23, 78, 19702 }, // ċ
-    { 20, 30, 21, 0, 29, 150, 19780 }, // Č
-    { 15, 26, 16, 0, 25, 98, 19930 }, // č
-    { 22, 30, 22, -1, 29, 165, 20028 }, // Ď
-    { 22, 24, 23, 0, 23, 132, 20193 }, // ď
-    { 22, 22, 22, -1, 21, 121, 20325 }, // Đ
-    { 19, 24, 20, 0, 23, 114, 20446 }, // đ
-    { 21, 26, 20, -2, 26, 137, 20560 }, // Ē
-    { 15, 22, 16, 0, 21, 83, 20697 }, // ē
-    { 21, 28, 20, -2, 28, 147, 20780 }, // Ĕ
-    { 15, 24, 16, 0, 23, 90, 20927 }, // ĕ
-    { 21, 28, 20, -2, 28, 147, 21017 }, // Ė
-    { 14, 24, 15, 0, 23, 84, 21164 }, // ė
-    { 21, 28, 20, -2, 21, 147, 21248 }, // Ę
-    { 14, 23, 15, 0, 16, 81, 21395 }, // ę
-    { 21, 29, 20, -2, 29, 153, 21476 }, // Ě
-    { 15, 26, 16, 0, 25, 98, 21629 }, // ě
-    { 20, 30, 21, 0, 29, 150, 21727 }, // Ĝ
-    { 20, 31, 19, -2, 24, 155, 21877 }, // ĝ
-    { 20, 29, 21, 0, 28, 145, 22032 }, // Ğ
-    { 20, 30, 19, -2, 23, 150, 22177 }, // ğ
-    { 20, 29, 21, 0, 28, 145, 22327 }, // Ġ
-    { 20, 30, 19, -2, 23, 150, 22472 }, // ġ
-    { 20, 29, 21, 0, 21, 145, 22622 }, // Ģ
-    { 20, 32, 19, -2, 25, 160, 22767 }, // ģ
-    { 27, 29, 26, -2, 29, 196, 22927 }, // Ĥ
-    { 17, 31, 18, 0, 30, 132, 23123 }, // ĥ
-    { 27, 21, 26, -2, 21, 142, 23255 }, // Ħ
-    { 17, 24, 18, 0, 23, 102, 23397 }, // ħ
-    { 16, 28, 15, -2, 28, 112, 23499 }, // Ĩ
-    { 12, 24, 14, 1, 23, 72, 23611 }, // ĩ
-    { 16, 26, 15, -2, 26, 104, 23683 }, // Ī
-    { 11, 22, 13, 1, 21, 61, 23787 }, // ī
-    { 16, 28, 15, -2, 28, 112, 23848 }, // Ĭ
-    { 11, 24, 13, 1, 23, 66, 23960 }, // ĭ
-    { 15, 28, 14, -2, 21, 105, 24026 }, // Į
-    { 9, 30, 11, 1, 23, 68, 24131 }, // į
-    { 15, 28, 14, -2, 28, 105, 24199 }, // İ
-    { 8, 17, 10, 1, 16, 34, 24304 }, // ı
-    { 27, 27, 26, -2, 21, 183, 24338 }, // Ĳ
-    { 19, 30, 21, 1, 23, 143, 24521 }, // ĳ
-    { 20, 35, 15, -6, 29, 175, 24664 }, // Ĵ
-    { 18, 31, 13, -6, 24, 140, 24839 }, // ĵ
-    { 24, 29, 23, -2, 21, 174, 24979 }, // Ķ
-    { 15, 31, 16, 0, 23, 117, 25153 }, // ķ
-    { 16, 17, 17, 0, 16, 68, 25270 }, // ĸ
-    { 18, 29, 17, -2, 29, 131, 25338 }, // Ĺ
-    { 12, 31, 13, 0, 30, 93, 25469 }, // ĺ
-    { 18, 29, 17, -2, 21, 131, 25562 }, // Ļ
-    { 10, 31, 10, -1, 23, 78, 25693 }, // ļ
-    { 19, 23, 18, -2, 23, 110, 25771 }, // Ľ
-    { 14, 24, 15, 0, 23, 84, 25881 }, // ľ
-    { 19, 21, 18, -2, 21, 100, 25965 }, // Ŀ
-    { 14, 24, 15, 0, 23, 84, 26065 }, // ŀ
-    { 18, 21, 17, -2, 21, 95, 26149 }, // Ł
-    { 12, 24, 12, -1, 23, 72, 26244 }, // ł
-    { 25, 30, 25, -1, 29, 188, 26316 }, // Ń
-    { 18, 26, 19, 0, 25, 117, 26504 }, // ń
-    { 25, 29, 25, -1, 21, 182, 26621 }, // Ņ
-    { 18, 24, 19, 0, 16, 108, 26803 }, // ņ
-    { 25, 30, 25, -1, 29, 188, 26911 }, // Ň
-    { 18, 26, 19, 0, 25, 117, 27099 }, // ň
-    { 23, 23, 25, 1, 22, 133, 27216 }, // ŉ
-    { 25, 27, 25, -1, 21, 169, 27349 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 27518 }, // ŋ
-    { 21, 27, 22, 0, 26, 142, 27610 }, // Ō
-    { 16, 22, 17, 0, 21, 88, 27752 }, // ō
-    { 21, 29, 22, 0, 28, 153, 27840 }, // Ŏ
-    { 16, 24, 17, 0, 23, 96, 27993 }, // ŏ
-    { 22, 30, 23, 0, 29, 165, 28089 }, // Ő
-    { 17, 26, 18, 0, 25, 111, 28254 }, // ő
-    { 29, 22, 30, 0, 21, 160, 28365 }, // Œ
-    { 24, 17, 25, 0, 16, 102, 28525 }, // œ
-    { 21, 30, 20, -2, 29, 158, 28627 }, // Ŕ
-    { 15, 25, 16, 0, 25, 94, 28785 }, // ŕ
-    { 21, 29, 20, -2, 21, 153, 28879 }, // Ŗ
-    { 16, 24, 16, -1, 16, 96, 29032 }, // ŗ
-    { 21, 30, 20, -2, 29, 158, 29128 }, // Ř
-    { 15, 25, 16, 0, 25, 94, 29286 }, // ř
-    { 17, 30, 17, -1, 29, 128, 29380 }, // Ś
-    { 15, 26, 15, -1, 25, 98, 29508 }, // ś
-    { 17, 30, 17, -1, 29, 128, 29606 }, // Ŝ
-    { 15, 25, 15, -1, 24, 94, 29734 }, // ŝ
-    { 17, 29, 17, -1, 21, 124, 29828 }, // Ş
-    { 14, 24, 14, -1, 16, 84, 29952 }, // ş
-    { 18, 30, 18, -1, 29, 135, 30036 }, // Š
-    { 16, 26, 16, -1, 25, 104, 30171 }, // š
-    { 20, 29, 22, 1, 21, 145, 30275 }, // Ţ
-    { 13, 27, 14, 0, 19, 88, 30420 }, // ţ
-    { 20, 29, 22, 1, 29, 145, 30508 }, // Ť
-    { 15, 25, 16, 0, 24, 94, 30653 }, // ť
-    { 20, 21, 22, 1, 21, 105, 30747 }, // Ŧ
-    { 13, 20, 14, 0, 19, 65, 30852 }, // ŧ
-    { 22, 29, 25, 2, 28, 160, 30917 }, // Ũ
-    { 18, 24, 19, 0, 23, 108, 31077 }, // ũ
-    { 22, 27, 25, 2, 26, 149, 31185 }, // Ū
-    { 18, 22, 19, 0, 21, 99, 31334 }, // ū
-    { 22, 29, 25, 2, 28, 160, 31433 }, // Ŭ
-    { 18, 24, 19, 0, 23, 108, 31593 }, // ŭ
-    { 22, 30, 25, 2, 29, 165, 31701 }, // Ů
-    { 18, 26, 19, 0, 25, 117, 31866 }, // ů
-    { 22, 30, 25, 2, 29, 165, 31983 }, // Ű
-    { 18, 26, 19, 0, 25, 117, 32148 }, // ű
-    { 22, 28, 25, 2, 21, 154, 32265 }, // Ų
-    { 18, 23, 19, 0, 16, 104, 32419 }, // ų
-    { 29, 30, 32, 2, 29, 218, 32523 }, // Ŵ
-    { 22, 25, 23, 0, 24, 138, 32741 }, // ŵ
-    { 21, 29, 23, 1, 29, 153, 32879 }, // Ŷ
-    { 20, 31, 16, -5, 24, 155, 33032 }, // ŷ
-    { 21, 27, 23, 1, 27, 142, 33187 }, // Ÿ
-    { 19, 30, 19, -1, 29, 143, 33329 }, // Ź
-    { 15, 26, 15, -1, 25, 98, 33472 }, // ź
-    { 19, 29, 19, -1, 28, 138, 33570 }, // Ż
-    { 15, 24, 15, -1, 23, 90, 33708 }, // ż
-    { 19, 30, 19, -1, 29, 143, 33798 }, // Ž
-    { 15, 26, 15, -1, 25, 98, 33941 }, // ž
-    { 22, 30, 17, -6, 23, 165, 34039 }, // ſ
-    { 24, 25, 25, 0, 24, 150, 34204 }, // Ơ
-    { 18, 20, 19, 0, 19, 90, 34354 }, // ơ
-    { 20, 21, 21, 0, 21, 105, 34444 }, // Ƥ
-    { 19, 30, 17, -3, 23, 143, 34549 }, // ƥ
-    { 13, 26, 14, 0, 19, 85, 34692 }, // ƫ
-    { 20, 21, 22, 1, 21, 105, 34777 }, // Ƭ
-    { 15, 24, 16, 0, 23, 90, 34882 }, // ƭ
-    { 20, 27, 22, 1, 21, 135, 34972 }, // Ʈ
-    { 26, 25, 29, 2, 24, 163, 35107 }, // Ư
-    { 21, 20, 22, 0, 19, 105, 35270 }, // ư
-    { 7, 8, 3, -5, 25, 14, 35375 }, // ̀
-    { 6, 8, 5, -2, 25, 12, 35389 }, // ́
-    { 11, 7, 6, -6, 24, 20, 35401 }, // ̂
-    { 10, 5, 6, -5, 23, 13, 35421 }, // ̃
-    { 10, 3, 6, -5, 21, 8, 35434 }, // ̄
-    { 10, 6, 6, -5, 23, 15, 35442 }, // ̆
-    { 6, 5, 4, -3, 23, 8, 35457 }, // ̇
-    { 10, 5, 6, -5, 23, 13, 35465 }, // ̈
-    { 9, 9, 6, -4, 26, 21, 35478 }, // ̉
-    { 8, 9, 5, -4, 25, 18, 35499 }, // ̊
-    { 12, 8, 8, -5, 25, 24, 35517 }, // ̋
-    { 11, 8, 7, -5, 25, 22, 35541 }, // ̌
-    { 9, 7, 4, -6, 24, 16, 35563 }, // ̏
-    { 10, 6, 6, -5, 23, 15, 35579 }, // ̑
-    { 6, 8, 4, -3, 25, 12, 35594 }, // ̒
-    { 7, 9, 5, -3, 26, 16, 35606 }, // ̓
-    { 6, 9, 3, -4, 26, 14, 35622 }, // ̔
-    { 5, 8, 3, -3, 25, 10, 35636 }, // ̕
-    { 6, 7, 4, -3, 19, 11, 35646 }, // ̛
-    { 6, 5, 4, -3, -2, 8, 35657 }, // ̣
-    { 10, 5, 6, -5, -2, 13, 35665 }, // ̤
-    { 8, 7, 5, -4, -1, 14, 35678 }, // ̥
-    { 6, 7, 4, -3, -1, 11, 35692 }, // ̦
-    { 7, 7, 4, -4, -1, 13, 35703 }, // ̧
-    { 6, 8, 4, -3, 1, 12, 35716 }, // ̨
-    { 5, 8, 8, -1, -1, 10, 35728 }, // ̩
-    { 11, 7, 6, -6, -1, 20, 35738 }, // ̭
-    { 10, 7, 6, -5, -1, 18, 35758 }, // ̮
-    { 10, 6, 6, -5, -2, 15, 35776 }, // ̰
-    { 10, 3, 6, -5, -3, 8, 35791 }, // ̱
-    { 10, 6, 6, -5, 23, 15, 35799 }, // ͂
-    { 11, 12, 6, -6, 30, 33, 35814 }, // ̈́
-    { 6, 6, 5, -2, -2, 9, 35847 }, // ͅ
-    { 23, 21, 22, -2, 21, 121, 35856 }, // Α
-    { 19, 22, 18, -2, 21, 105, 35977 }, // Β
-    { 20, 21, 19, -2, 21, 105, 36082 }, // Γ
-    { 20, 21, 21, -1, 21, 105, 36187 }, // Δ
-    { 21, 21, 20, -2, 21, 111, 36292 }, // Ε
-    { 19, 22, 19, -1, 21, 105, 36403 }, // Ζ
-    { 27, 21, 26, -2, 21, 142, 36508 }, // Η
-    { 21, 22, 22, 0, 21, 116, 36650 }, // Θ
-    { 15, 21, 14, -2, 21, 79, 36766 }, // Ι
-    { 24, 22, 23, -2, 21, 132, 36845 }, // Κ
-    { 23, 21, 22, -2, 21, 121, 36977 }, // Λ
-    { 28, 21, 27, -2, 21, 147, 37098 }, // Μ
-    { 25, 22, 25, -1, 21, 138, 37245 }, // Ν
-    { 20, 21, 20, -1, 21, 105, 37383 }, // Ξ
-    { 21, 22, 22, 0, 21, 116, 37488 }, // Ο
-    { 26, 21, 25, -2, 21, 137, 37604 }, // Π
-    { 20, 21, 19, -2, 21, 105, 37741 }, // Ρ
-    { 19, 22, 19, -1, 21, 105, 37846 }, // Σ
-    { 20, 21, 22, 1, 21, 105, 37951 }, // Τ
-    { 20, 21, 22, 1, 21, 105, 38056 }, // Υ
-    { 22, 22, 23, 0, 21, 121, 38161 }, // Φ
-    { 24, 21, 22, -3, 21, 126, 38282 }, // Χ
-    { 24, 21, 27, 2, 21, 126, 38408 }, // Ψ
-    { 23, 21, 25, -1, 21, 121, 38534 }, // Ω
-    { 18, 17, 19, 0, 16, 77, 38655 }, // α
-    { 17, 30, 17, -1, 23, 128, 38732 }, // β
-    { 15, 23, 16, 0, 16, 87, 38860 }, // γ
-    { 17, 24, 18, 0, 23, 102, 38947 }, // δ
-    { 14, 17, 15, 0, 16, 60, 39049 }, // ε
-    { 14, 30, 16, 1, 24, 105, 39109 }, // ζ
-    { 16, 23, 17, 0, 16, 92, 39214 }, // η
-    { 16, 24, 18, 1, 23, 96, 39306 }, // θ
-    { 8, 17, 10, 1, 16, 34, 39402 }, // ι
-    { 17, 17, 18, 0, 16, 73, 39436 }, // κ
-    { 18, 24, 17, -2, 23, 108, 39509 }, // λ
-    { 20, 23, 19, -2, 16, 115, 39617 }, // μ
-    { 15, 17, 16, 0, 16, 64, 39732 }, // ν
-    { 13, 30, 15, 1, 24, 98, 39796 }, // ξ
-    { 15, 17, 16, 0, 16, 64, 39894 }, // ο
-    { 19, 17, 20, 0, 16, 81, 39958 }, // π
-    { 17, 23, 17, -1, 16, 98, 40039 }, // ρ
-    { 13, 22, 14, 0, 16, 72, 40137 }, // ς
-    { 18, 17, 19, 0, 16, 77, 40209 }, // σ
-    { 15, 17, 17, 1, 16, 64, 40286 }, // τ
-    { 15, 17, 17, 1, 16, 64, 40350 }, // υ
-    { 20, 23, 21, 0, 16, 115, 40414 }, // φ
-    { 19, 23, 18, -2, 16, 110, 40529 }, // χ
-    { 21, 28, 23, 1, 21, 147, 40639 }, // ψ
-    { 21, 17, 22, 0, 16, 90, 40786 }, // ω
-    { 23, 28, 22, -2, 21, 161, 40876 }, // Ạ
-    { 17, 23, 18, 0, 16, 98, 41037 }, // ạ
-    { 23, 30, 22, -2, 30, 173, 41135 }, // Ả
-    { 17, 27, 18, 0, 26, 115, 41308 }, // ả
-    { 24, 31, 23, -2, 31, 186, 41423 }, // Ấ
-    { 20, 30, 21, 0, 29, 150, 41609 }, // ấ
-    { 23, 31, 22, -2, 31, 179, 41759 }, // Ầ
-    { 17, 30, 18, 0, 29, 128, 41938 }, // ầ
-    { 24, 31, 23, -2, 31, 186, 42066 }, // Ẩ
-    { 20, 30, 21, 0, 29, 150, 42252 }, // ẩ
-    { 23, 31, 22, -2, 31, 179, 42402 }, // Ẫ
-    { 17, 29, 18, 0, 28, 124, 42581 }, // ẫ
-    { 23, 36, 22, -2, 29, 207, 42705 }, // Ậ
-    { 17, 31, 18, 0, 24, 132, 42912 }, // ậ
-    { 23, 31, 22, -2, 31, 179, 43044 }, // Ắ
-    { 17, 30, 18, 0, 29, 128, 43223 }, // ắ
-    { 23, 31, 22, -2, 31, 179, 43351 }, // Ằ
-    { 17, 30, 18, 0, 29, 128, 43530 }, // ằ
-    { 23, 31, 22, -2, 31, 179, 43658 }, // Ẳ
-    { 17, 30, 18, 0, 29, 128, 43837 }, // ẳ
-    { 23, 31, 22, -2, 31, 179, 43965 }, // Ẵ
-    { 17, 29, 18, 0, 28, 124, 44144 }, // ẵ
-    { 23, 35, 22, -2, 28, 202, 44268 }, // Ặ
-    { 17, 30, 18, 0, 23, 128, 44470 }, // ặ
-    { 21, 28, 20, -2, 21, 147, 44598 }, // Ẹ
-    { 14, 23, 15, 0, 16, 81, 44745 }, // ẹ
-    { 21, 30, 20, -2, 30, 158, 44826 }, // Ẻ
-    { 14, 27, 15, 0, 26, 95, 44984 }, // ẻ
-    { 21, 28, 20, -2, 28, 147, 45079 }, // Ẽ
-    { 15, 24, 16, 0, 23, 90, 45226 }, // ẽ
-    { 23, 31, 22, -2, 31, 179, 45316 }, // Ế
-    { 18, 30, 19, 0, 29, 135, 45495 }, // ế
-    { 21, 31, 20, -2, 31, 163, 45630 }, // Ề
-    { 15, 30, 16, 0, 29, 113, 45793 }, // ề
-    { 23, 31, 22, -2, 31, 179, 45906 }, // Ể
-    { 19, 30, 20, 0, 29, 143, 46085 }, // ể
-    { 21, 31, 20, -2, 31, 163, 46228 }, // Ễ
-    { 15, 29, 16, 0, 28, 109, 46391 }, // ễ
-    { 21, 36, 20, -2, 29, 189, 46500 }, // Ệ
-    { 14, 31, 15, 0, 24, 109, 46689 }, // ệ
-    { 15, 30, 14, -2, 30, 113, 46798 }, // Ỉ
-    { 11, 27, 13, 1, 26, 75, 46911 }, // ỉ
-    { 15, 28, 14, -2, 21, 105, 46986 }, // Ị
-    { 10, 30, 11, 0, 23, 75, 47091 }, // ị
-    { 21, 28, 22, 0, 21, 147, 47166 }, // Ọ
-    { 15, 23, 16, 0, 16, 87, 47313 }, // ọ
-    { 21, 31, 22, 0, 30, 163, 47400 }, // Ỏ
-    { 15, 27, 16, 0, 26, 102, 47563 }, // ỏ
-    { 22, 32, 23, 0, 31, 176, 47665 }, // Ố
-    { 20, 30, 21, 0, 29, 150, 47841 }, // ố
-    { 21, 32, 22, 0, 31, 168, 47991 }, // Ồ
-    { 17, 30, 18, 0, 29, 128, 48159 }, // ồ
-    { 22, 32, 23, 0, 31, 176, 48287 }, // Ổ
-    { 20, 30, 21, 0, 29, 150, 48463 }, // ổ
-    { 21, 32, 22, 0, 31, 168, 48613 }, // Ỗ
-    { 16, 29, 17, 0, 28, 116, 48781 }, // ỗ
-    { 21, 36, 22, 0, 29, 189, 48897 }, // Ộ
-    { 15, 31, 16, 0, 24, 117, 49086 }, // ộ
-    { 24, 30, 25, 0, 29, 180, 49203 }, // Ớ
-    { 18, 26, 19, 0, 25, 117, 49383 }, // ớ
-    { 24, 30, 25, 0, 29, 180, 49500 }, // Ờ
-    { 18, 26, 19, 0, 25, 117, 49680 }, // ờ
-    { 24, 31, 25, 0, 30, 186, 49797 }, // Ở
-    { 18, 27, 19, 0, 26, 122, 49983 }, // ở
-    { 24, 29, 25, 0, 28, 174, 50105 }, // Ỡ
-    { 18, 24, 19, 0, 23, 108, 50279 }, // ỡ
-    { 24, 31, 25, 0, 24, 186, 50387 }, // Ợ
-    { 18, 26, 19, 0, 19, 117, 50573 }, // ợ
-    { 22, 28, 25, 2, 21, 154, 50690 }, // Ụ
-    { 18, 23, 19, 0, 16, 104, 50844 }, // ụ
-    { 22, 31, 25, 2, 30, 171, 50948 }, // Ủ
-    { 18, 27, 19, 0, 26, 122, 51119 }, // ủ
-    { 26, 30, 29, 2, 29, 195, 51241 }, // Ứ
-    { 21, 26, 22, 0, 25, 137, 51436 }, // ứ
-    { 26, 30, 29, 2, 29, 195, 51573 }, // Ừ
-    { 21, 26, 22, 0, 25, 137, 51768 }, // ừ
-    { 26, 31, 29, 2, 30, 202, 51905 }, // Ử
-    { 21, 27, 22, 0, 26, 142, 52107 }, // ử
-    { 26, 29, 29, 2, 28, 189, 52249 }, // Ữ
-    { 21, 24, 22, 0, 23, 126, 52438 }, // ữ
-    { 26, 31, 29, 2, 24, 202, 52564 }, // Ự
-    { 21, 26, 22, 0, 19, 137, 52766 }, // ự
-    { 21, 29, 23, 1, 29, 153, 52903 }, // Ỳ
-    { 20, 32, 16, -5, 25, 160, 53056 }, // ỳ
-    { 21, 28, 23, 1, 21, 147, 53216 }, // Ỵ
-    { 20, 23, 16, -5, 16, 115, 53363 }, // ỵ
-    { 21, 30, 23, 1, 30, 158, 53478 }, // Ỷ
-    { 20, 33, 16, -5, 26, 165, 53636 }, // ỷ
-    { 21, 28, 23, 1, 28, 147, 53801 }, // Ỹ
-    { 20, 30, 16, -5, 23, 150, 53948 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 54098 }, //  
-    { 0, 0, 29, 0, 0, 0, 54098 }, //  
-    { 0, 0, 15, 0, 0, 0, 54098 }, //  
-    { 0, 0, 29, 0, 0, 0, 54098 }, //  
-    { 0, 0, 10, 0, 0, 0, 54098 }, //  
-    { 0, 0, 7, 0, 0, 0, 54098 }, //  
-    { 0, 0, 5, 0, 0, 0, 54098 }, //  
-    { 0, 0, 18, 0, 0, 0, 54098 }, //  
-    { 0, 0, 9, 0, 0, 0, 54098 }, //  
-    { 0, 0, 6, 0, 0, 0, 54098 }, //  
-    { 0, 0, 1, 0, 0, 0, 54098 }, //  
-    { 0, 0, 1, 0, 0, 0, 54098 }, // ​
-    { 2, 24, 2, -1, 17, 12, 54098 }, // ‌
-    { 6, 26, 4, -3, 19, 39, 54110 }, // ‍
-    { 10, 28, 6, -5, 21, 70, 54149 }, // ‎
-    { 10, 28, 6, -5, 21, 70, 54219 }, // ‏
-    { 10, 5, 12, 1, 10, 13, 54289 }, // ‐
-    { 10, 5, 12, 1, 10, 13, 54302 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 54315 }, // ‒
-    { 15, 3, 16, 0, 9, 12, 54326 }, // –
-    { 29, 3, 30, 0, 9, 22, 54338 }, // —
-    { 29, 3, 30, 0, 9, 22, 54360 }, // ―
-    { 11, 30, 15, 2, 23, 83, 54382 }, // ‖
-    { 15, 8, 16, 0, -1, 30, 54465 }, // ‗
-    { 7, 10, 10, 2, 22, 18, 54495 }, // ‘
-    { 8, 10, 10, 1, 22, 20, 54513 }, // ’
-    { 7, 10, 9, 0, 4, 18, 54533 }, // ‚
-    { 7, 10, 9, 1, 22, 18, 54551 }, // ‛
-    { 13, 10, 16, 2, 22, 33, 54569 }, // “
-    { 14, 10, 16, 1, 22, 35, 54602 }, // ”
-    { 13, 10, 15, 0, 4, 33, 54637 }, // „
-    { 13, 10, 15, 1, 22, 33, 54670 }, // ‟
-    { 13, 19, 15, 1, 21, 62, 54703 }, // †
-    { 15, 23, 15, -1, 21, 87, 54765 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 54852 }, // •
-    { 10, 10, 18, 4, 15, 25, 54865 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 54890 }, // ․
-    { 13, 6, 15, 1, 5, 20, 54899 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 54919 }, // …
-    { 6, 6, 8, 1, 11, 9, 54957 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 54966 }, //  
-    { 0, 0, 1, 0, 0, 0, 54966 }, //  
-    { 10, 28, 6, -5, 21, 70, 54966 }, // ‪
-    { 10, 28, 6, -5, 21, 70, 55036 }, // ‫
-    { 10, 27, 6, -5, 20, 68, 55106 }, // ‬
-    { 12, 28, 7, -6, 21, 84, 55174 }, // ‭
-    { 12, 28, 7, -6, 21, 84, 55258 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 55342 }, //  
-    { 39, 24, 41, 1, 22, 234, 55342 }, // ‰
-    { 7, 11, 8, 0, 21, 20, 55576 }, // ′
-    { 13, 11, 14, 0, 21, 36, 55596 }, // ″
-    { 20, 11, 21, 0, 21, 55, 55632 }, // ‴
-    { 7, 11, 8, 0, 21, 20, 55687 }, // ‵
-    { 13, 11, 14, 0, 21, 36, 55707 }, // ‶
-    { 20, 11, 21, 0, 21, 55, 55743 }, // ‷
-    { 13, 6, 15, 1, 0, 20, 55798 }, // ‸
-    { 9, 12, 11, 1, 13, 27, 55818 }, // ‹
-    { 10, 12, 11, 0, 13, 30, 55845 }, // ›
-    { 18, 20, 19, 0, 19, 90, 55875 }, // ※
-    { 17, 23, 19, 1, 22, 98, 55965 }, // ‼
-    { 15, 4, 16, 0, 25, 15, 56063 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 56078 }, // ⁃
-    { 19, 24, 15, -5, 22, 114, 56087 }, // ⁄
-    { 21, 23, 24, 2, 22, 121, 56201 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 56322 }, // ⁈
-    { 19, 23, 21, 1, 22, 110, 56432 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 56542 }, // ⁓
-    { 26, 11, 27, 0, 21, 72, 56572 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 56644 }, //  
-    { 0, 0, 1, 0, 0, 0, 56644 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 56644 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 56644 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 56644 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 56644 }, // ⁤
-    { 13, 14, 14, 0, 24, 46, 56644 }, // ⁰
-    { 13, 14, 14, 0, 24, 46, 56690 }, // ⁴
-    { 13, 14, 14, 0, 24, 46, 56736 }, // ⁵
-    { 12, 14, 14, 1, 24, 42, 56782 }, // ⁶
-    { 11, 14, 14, 2, 24, 39, 56824 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 56863 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 56902 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 56944 }, // ⁿ
-    { 13, 15, 14, 0, 10, 49, 56975 }, // ₀
-    { 9, 14, 13, 1, 10, 32, 57024 }, // ₁
-    { 12, 14, 13, 0, 10, 42, 57056 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 57098 }, // ₃
-    { 13, 14, 14, 0, 10, 46, 57140 }, // ₄
-    { 13, 14, 14, 0, 9, 46, 57186 }, // ₅
-    { 12, 15, 14, 1, 10, 45, 57232 }, // ₆
-    { 11, 14, 14, 2, 9, 39, 57277 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 57316 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 57358 }, // ₉
-    { 20, 20, 20, -1, 20, 100, 57403 }, // ₣
-    { 19, 22, 19, -1, 21, 105, 57503 }, // ₤
-    { 38, 22, 39, 0, 21, 209, 57608 }, // ₧
-    { 20, 22, 20, -1, 21, 110, 57817 }, // €
-    { 19, 14, 29, 5, 17, 67, 57927 }, // ←
-    { 13, 20, 29, 8, 20, 65, 57994 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 58059 }, // →
-    { 13, 20, 29, 8, 20, 65, 58126 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 58191 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 58258 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 58323 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 58398 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 58463 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 58528 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 58596 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 58672 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 58749 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 58825 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 58902 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 58978 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 59094 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 59190 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 59269 }, // ∅
-    { 20, 21, 21, 0, 21, 105, 59407 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 59512 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 59617 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 59728 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 59865 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 59960 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 60071 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 60208 }, // ∍
-    { 23, 26, 25, 1, 21, 150, 60303 }, // ∏
-    { 19, 26, 20, 0, 21, 124, 60453 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 60577 }, // −
-    { 17, 23, 17, -1, 21, 98, 60591 }, // ∕
-    { 15, 23, 16, 0, 21, 87, 60689 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 60776 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 60825 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 60858 }, // ∙
-    { 19, 28, 19, -1, 24, 133, 60867 }, // √
-    { 14, 12, 18, 2, 15, 42, 61000 }, // ∝
-    { 18, 11, 19, 0, 15, 50, 61042 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 61092 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 61192 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 61313 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 61351 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 61434 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 61545 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 61656 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 61746 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 61840 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 61960 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 62046 }, // ∵
-    { 7, 17, 9, 1, 18, 30, 62132 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 62162 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 62248 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 62278 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 62351 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 62393 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 62444 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 62497 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 62561 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 62624 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 62687 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 62775 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 62863 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 62958 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 63095 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 63232 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 63332 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 63432 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 63548 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 63664 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 63780 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 63896 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 63986 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 63995 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 64033 }, // �
+    { 9, 23, 11, 1, 22, 36, 0 }, // !
+    { 11, 10, 13, 1, 21, 30, 36 }, // "
+    { 18, 19, 19, 0, 17, 64, 66 }, // #
+    { 16, 30, 18, 1, 24, 89, 130 }, // $
+    { 26, 24, 29, 1, 22, 107, 219 }, // %
+    { 24, 24, 26, 1, 22, 95, 326 }, // &
+    { 6, 10, 8, 1, 21, 16, 421 }, // '
+    { 13, 30, 15, 1, 24, 53, 437 }, // (
+    { 14, 30, 13, -2, 24, 59, 490 }, // )
+    { 11, 11, 13, 1, 22, 31, 549 }, // *
+    { 14, 14, 18, 2, 17, 37, 580 }, // +
+    { 9, 10, 9, -2, 5, 14, 617 }, // ,
+    { 10, 5, 12, 1, 10, 8, 631 }, // -
+    { 6, 6, 9, 1, 5, 8, 639 }, // .
+    { 17, 23, 17, -1, 21, 49, 647 }, // /
+    { 18, 22, 19, 0, 21, 63, 696 }, // 0
+    { 13, 21, 18, 2, 21, 39, 759 }, // 1
+    { 17, 21, 18, 0, 21, 58, 798 }, // 2
+    { 17, 22, 18, 0, 21, 56, 856 }, // 3
+    { 17, 21, 18, 0, 21, 60, 912 }, // 4
+    { 17, 21, 19, 1, 20, 53, 972 }, // 5
+    { 18, 22, 20, 1, 21, 63, 1025 }, // 6
+    { 16, 21, 20, 3, 20, 52, 1088 }, // 7
+    { 17, 22, 19, 1, 21, 61, 1140 }, // 8
+    { 18, 22, 18, -1, 21, 59, 1201 }, // 9
+    { 8, 17, 10, 1, 16, 20, 1260 }, // :
+    { 11, 21, 10, -2, 16, 27, 1280 }, // ;
+    { 14, 14, 18, 2, 17, 32, 1307 }, // <
+    { 14, 9, 18, 2, 14, 28, 1339 }, // =
+    { 14, 14, 18, 2, 17, 32, 1367 }, // >
+    { 10, 23, 13, 2, 22, 40, 1399 }, // ?
+    { 27, 27, 29, 1, 21, 130, 1439 }, // @
+    { 23, 21, 22, -2, 21, 75, 1569 }, // A
+    { 19, 22, 18, -2, 21, 70, 1644 }, // B
+    { 19, 22, 20, 0, 21, 66, 1714 }, // C
+    { 22, 22, 22, -1, 21, 72, 1780 }, // D
+    { 21, 21, 20, -2, 21, 64, 1852 }, // E
+    { 20, 21, 19, -2, 21, 56, 1916 }, // F
+    { 20, 22, 21, 0, 21, 74, 1972 }, // G
+    { 27, 21, 26, -2, 21, 82, 2046 }, // H
+    { 15, 21, 14, -2, 21, 44, 2128 }, // I
+    { 19, 27, 14, -6, 21, 62, 2172 }, // J
+    { 24, 22, 23, -2, 21, 76, 2234 }, // K
+    { 18, 21, 17, -2, 21, 52, 2310 }, // L
+    { 28, 21, 27, -2, 21, 103, 2362 }, // M
+    { 25, 22, 25, -1, 21, 87, 2465 }, // N
+    { 21, 22, 22, 0, 21, 79, 2552 }, // O
+    { 20, 21, 19, -2, 21, 63, 2631 }, // P
+    { 25, 28, 26, 0, 21, 103, 2694 }, // Q
+    { 21, 22, 20, -2, 21, 76, 2797 }, // R
+    { 17, 22, 17, -1, 21, 62, 2873 }, // S
+    { 20, 21, 22, 1, 21, 60, 2935 }, // T
+    { 22, 22, 25, 2, 21, 70, 2995 }, // U
+    { 23, 22, 25, 1, 21, 67, 3065 }, // V
+    { 29, 22, 32, 2, 21, 109, 3132 }, // W
+    { 24, 21, 22, -3, 21, 71, 3241 }, // X
+    { 21, 21, 23, 1, 21, 57, 3312 }, // Y
+    { 19, 22, 19, -1, 21, 66, 3369 }, // Z
+    { 14, 28, 13, -2, 23, 58, 3435 }, // [
+    { 13, 23, 15, 1, 21, 47, 3493 }, // <backslash>
+    { 14, 28, 13, -2, 23, 58, 3540 }, // ]
+    { 16, 14, 18, 1, 19, 41, 3598 }, // ^
+    { 15, 4, 16, 0, -1, 14, 3639 }, // _
+    { 6, 8, 18, 6, 25, 11, 3653 }, // `
+    { 17, 17, 18, 0, 16, 55, 3664 }, // a
+    { 16, 24, 17, 0, 23, 68, 3719 }, // b
+    { 13, 17, 14, 0, 16, 37, 3787 }, // c
+    { 17, 24, 18, 0, 23, 71, 3824 }, // d
+    { 14, 17, 15, 0, 16, 43, 3895 }, // e
+    { 22, 30, 17, -6, 23, 85, 3938 }, // f
+    { 20, 23, 19, -2, 16, 72, 4023 }, // g
+    { 17, 24, 18, 0, 23, 74, 4095 }, // h
+    { 9, 24, 11, 1, 23, 41, 4169 }, // i
+    { 16, 30, 11, -6, 23, 67, 4210 }, // j
+    { 15, 24, 16, 0, 23, 68, 4277 }, // k
+    { 9, 24, 10, 0, 23, 41, 4345 }, // l
+    { 25, 17, 26, 0, 16, 86, 4386 }, // m
+    { 18, 17, 19, 0, 16, 57, 4472 }, // n
+    { 15, 17, 16, 0, 16, 47, 4529 }, // o
+    { 19, 23, 17, -3, 16, 79, 4576 }, // p
+    { 17, 23, 18, 0, 16, 67, 4655 }, // q
+    { 15, 16, 16, 0, 16, 42, 4722 }, // r
+    { 14, 17, 14, -1, 16, 41, 4764 }, // s
+    { 13, 20, 14, 0, 19, 42, 4805 }, // t
+    { 18, 17, 19, 0, 16, 58, 4847 }, // u
+    { 15, 17, 16, 0, 16, 48, 4905 }, // v
+    { 22, 17, 23, 0, 16, 76, 4953 }, // w
+    { 18, 17, 18, -1, 16, 55, 5029 }, // x
+    { 20, 23, 16, -5, 16, 73, 5084 }, // y
+    { 15, 17, 15, -1, 16, 50, 5157 }, // z
+    { 13, 29, 15, 1, 24, 56, 5207 }, // {
+    { 10, 27, 10, -1, 23, 41, 5263 }, // |
+    { 13, 29, 12, -2, 24, 58, 5304 }, // }
+    { 14, 7, 18, 2, 13, 20, 5362 }, // ~
+    { 0, 0, 6, 0, 0, 0, 5382 }, //  
+    { 10, 23, 10, -1, 16, 36, 5382 }, // ¡
+    { 16, 29, 18, 1, 23, 77, 5418 }, // ¢
+    { 19, 22, 19, -1, 21, 62, 5495 }, // £
+    { 18, 14, 19, 0, 17, 50, 5557 }, // ¤
+    { 20, 20, 22, 1, 20, 65, 5607 }, // ¥
+    { 10, 27, 10, -1, 23, 37, 5672 }, // ¦
+    { 15, 23, 15, -1, 20, 63, 5709 }, // §
+    { 10, 5, 18, 4, 23, 13, 5772 }, // ¨
+    { 22, 22, 23, 0, 21, 100, 5785 }, // ©
+    { 12, 15, 14, 1, 21, 45, 5885 }, // ª
+    { 16, 12, 18, 1, 13, 37, 5930 }, // «
+    { 14, 8, 18, 2, 14, 29, 5967 }, // ¬
+    { 10, 5, 12, 1, 10, 8, 5996 }, // ­
+    { 17, 16, 18, 0, 23, 71, 6004 }, // ®
+    { 10, 3, 18, 4, 21, 6, 6075 }, // ¯
+    { 11, 12, 15, 2, 21, 27, 6081 }, // °
+    { 14, 18, 18, 2, 17, 49, 6108 }, // ±
+    { 12, 14, 13, 0, 24, 30, 6157 }, // ²
+    { 11, 14, 13, 1, 24, 32, 6187 }, // ³
+    { 6, 8, 18, 6, 25, 13, 6219 }, // ´
+    { 20, 23, 19, -2, 16, 72, 6232 }, // µ
+    { 20, 26, 20, -1, 21, 86, 6304 }, // ¶
+    { 5, 6, 9, 2, 11, 7, 6390 }, // ·
+    { 7, 7, 18, 6, -1, 12, 6397 }, // ¸
+    { 9, 14, 13, 1, 24, 26, 6409 }, // ¹
+    { 12, 15, 14, 1, 21, 41, 6435 }, // º
+    { 17, 12, 18, 0, 13, 40, 6476 }, // »
+    { 30, 24, 32, 1, 22, 106, 6516 }, // ¼
+    { 30, 24, 32, 1, 22, 105, 6622 }, // ½
+    { 30, 24, 32, 1, 22, 108, 6727 }, // ¾
+    { 10, 23, 12, 0, 16, 40, 6835 }, // ¿
+    { 23, 29, 22, -2, 29, 94, 6875 }, // À
+    { 23, 29, 22, -2, 29, 92, 6969 }, // Á
+    { 23, 29, 22, -2, 29, 96, 7061 }, // Â
+    { 23, 28, 22, -2, 28, 96, 7157 }, // Ã
+    { 23, 27, 22, -2, 27, 93, 7253 }, // Ä
+    { 23, 29, 22, -2, 29, 103, 7346 }, // Å
+    { 31, 21, 29, -3, 21, 94, 7449 }, // Æ
+    { 19, 29, 20, 0, 21, 82, 7543 }, // Ç
+    { 21, 29, 20, -2, 29, 82, 7625 }, // È
+    { 21, 29, 20, -2, 29, 82, 7707 }, // É
+    { 21, 29, 20, -2, 29, 85, 7789 }, // Ê
+    { 21, 27, 20, -2, 27, 84, 7874 }, // Ë
+    { 15, 29, 14, -2, 29, 59, 7958 }, // Ì
+    { 15, 29, 14, -2, 29, 60, 8017 }, // Í
+    { 16, 29, 15, -2, 29, 64, 8077 }, // Î
+    { 16, 27, 15, -2, 27, 61, 8141 }, // Ï
+    { 22, 22, 22, -1, 21, 74, 8202 }, // Ð
+    { 25, 29, 25, -1, 28, 108, 8276 }, // Ñ
+    { 21, 30, 22, 0, 29, 97, 8384 }, // Ò
+    { 21, 30, 22, 0, 29, 96, 8481 }, // Ó
+    { 21, 30, 22, 0, 29, 99, 8577 }, // Ô
+    { 21, 29, 22, 0, 28, 97, 8676 }, // Õ
+    { 21, 28, 22, 0, 27, 97, 8773 }, // Ö
+    { 13, 13, 18, 3, 16, 35, 8870 }, // ×
+    { 24, 23, 24, -1, 22, 92, 8905 }, // Ø
+    { 22, 30, 25, 2, 29, 88, 8997 }, // Ù
+    { 22, 30, 25, 2, 29, 88, 9085 }, // Ú
+    { 22, 30, 25, 2, 29, 92, 9173 }, // Û
+    { 22, 28, 25, 2, 27, 90, 9265 }, // Ü
+    { 21, 29, 23, 1, 29, 75, 9355 }, // Ý
+    { 19, 21, 18, -2, 21, 61, 9430 }, // Þ
+    { 24, 30, 19, -6, 23, 108, 9491 }, // ß
+    { 17, 26, 18, 0, 25, 70, 9599 }, // à
+    { 17, 26, 18, 0, 25, 69, 9669 }, // á
+    { 17, 25, 18, 0, 24, 76, 9738 }, // â
+    { 17, 24, 18, 0, 23, 73, 9814 }, // ã
+    { 17, 24, 18, 0, 23, 72, 9887 }, // ä
+    { 17, 26, 18, 0, 25, 78, 9959 }, // å
+    { 23, 17, 24, 0, 16, 72, 10037 }, // æ
+    { 13, 24, 14, 0, 16, 51, 10109 }, // ç
+    { 14, 26, 15, 0, 25, 59, 10160 }, // è
+    { 15, 26, 16, 0, 25, 59, 10219 }, // é
+    { 14, 25, 15, 0, 24, 63, 10278 }, // ê
+    { 15, 24, 16, 0, 23, 60, 10341 }, // ë
+    { 8, 26, 10, 1, 25, 43, 10401 }, // ì
+    { 11, 26, 13, 1, 25, 47, 10444 }, // í
+    { 11, 25, 13, 1, 24, 50, 10491 }, // î
+    { 11, 24, 13, 1, 23, 47, 10541 }, // ï
+    { 16, 25, 17, 0, 24, 66, 10588 }, // ð
+    { 18, 24, 19, 0, 23, 76, 10654 }, // ñ
+    { 15, 26, 16, 0, 25, 63, 10730 }, // ò
+    { 16, 26, 17, 0, 25, 63, 10793 }, // ó
+    { 15, 25, 16, 0, 24, 66, 10856 }, // ô
+    { 16, 24, 17, 0, 23, 65, 10922 }, // õ
+    { 16, 24, 17, 0, 23, 64, 10987 }, // ö
+    { 14, 14, 18, 2, 17, 30, 11051 }, // ÷
+    { 19, 17, 18, -2, 16, 55, 11081 }, // ø
+    { 18, 26, 19, 0, 25, 75, 11136 }, // ù
+    { 18, 26, 19, 0, 25, 74, 11211 }, // ú
+    { 18, 25, 19, 0, 24, 81, 11285 }, // û
+    { 18, 24, 19, 0, 23, 77, 11366 }, // ü
+    { 20, 32, 16, -5, 25, 90, 11443 }, // ý
+    { 19, 30, 17, -3, 23, 85, 11533 }, // þ
+    { 20, 30, 16, -5, 23, 93, 11618 }, // ÿ
+    { 23, 26, 22, -2, 26, 86, 11711 }, // Ā
+    { 17, 22, 18, 0, 21, 63, 11797 }, // ā
+    { 23, 28, 22, -2, 28, 96, 11860 }, // Ă
+    { 17, 24, 18, 0, 23, 71, 11956 }, // ă
+    { 23, 28, 22, -2, 21, 92, 12027 }, // Ą
+    { 17, 23, 18, 0, 16, 68, 12119 }, // ą
+    { 19, 30, 20, 0, 29, 84, 12187 }, // Ć
+    { 15, 26, 16, 0, 25, 54, 12271 }, // ć
+    { 19, 30, 20, 0, 29, 86, 12325 }, // Ĉ
+    { 14, 25, 15, 0, 24, 58, 12411 }, // ĉ
+    { 19, 29, 20, 0, 28, 78, 12469 }, // Ċ
+    { 13, 24, 14, 0, 23, 49, 12547 }, // ċ
+    { 20, 30, 21, 0, 29, 87, 12596 }, // Č
+    { 15, 26, 16, 0, 25, 58, 12683 }, // č
+    { 22, 30, 22, -1, 29, 93, 12741 }, // Ď
+    { 22, 24, 23, 0, 23, 89, 12834 }, // ď
+    { 22, 22, 22, -1, 21, 74, 12923 }, // Đ
+    { 19, 24, 20, 0, 23, 72, 12997 }, // đ
+    { 21, 26, 20, -2, 26, 75, 13069 }, // Ē
+    { 15, 22, 16, 0, 21, 52, 13144 }, // ē
+    { 21, 28, 20, -2, 28, 83, 13196 }, // Ĕ
+    { 15, 24, 16, 0, 23, 60, 13279 }, // ĕ
+    { 21, 28, 20, -2, 28, 78, 13339 }, // Ė
+    { 14, 24, 15, 0, 23, 56, 13417 }, // ė
+    { 21, 28, 20, -2, 21, 80, 13473 }, // Ę
+    { 14, 23, 15, 0, 16, 56, 13553 }, // ę
+    { 21, 29, 20, -2, 29, 86, 13609 }, // Ě
+    { 15, 26, 16, 0, 25, 63, 13695 }, // ě
+    { 20, 30, 21, 0, 29, 94, 13758 }, // Ĝ
+    { 20, 31, 19, -2, 24, 95, 13852 }, // ĝ
+    { 20, 29, 21, 0, 28, 94, 13947 }, // Ğ
+    { 20, 30, 19, -2, 23, 91, 14041 }, // ğ
+    { 20, 29, 21, 0, 28, 87, 14132 }, // Ġ
+    { 20, 30, 19, -2, 23, 86, 14219 }, // ġ
+    { 20, 29, 21, 0, 21, 89, 14305 }, // Ģ
+    { 20, 32, 19, -2, 25, 91, 14394 }, // ģ
+    { 27, 29, 26, -2, 29, 107, 14485 }, // Ĥ
+    { 17, 31, 18, 0, 30, 93, 14592 }, // ĥ
+    { 27, 21, 26, -2, 21, 91, 14685 }, // Ħ
+    { 17, 24, 18, 0, 23, 72, 14776 }, // ħ
+    { 16, 28, 15, -2, 28, 61, 14848 }, // Ĩ
+    { 12, 24, 14, 1, 23, 50, 14909 }, // ĩ
+    { 16, 26, 15, -2, 26, 52, 14959 }, // Ī
+    { 11, 22, 13, 1, 21, 41, 15011 }, // ī
+    { 16, 28, 15, -2, 28, 60, 15052 }, // Ĭ
+    { 11, 24, 13, 1, 23, 48, 15112 }, // ĭ
+    { 15, 28, 14, -2, 21, 58, 15160 }, // Į
+    { 9, 30, 11, 1, 23, 49, 15218 }, // į
+    { 15, 28, 14, -2, 28, 57, 15267 }, // İ
+    { 8, 17, 10, 1, 16, 32, 15324 }, // ı
+    { 27, 27, 26, -2, 21, 97, 15356 }, // Ĳ
+    { 19, 30, 21, 1, 23, 98, 15453 }, // ĳ
+    { 20, 35, 15, -6, 29, 81, 15551 }, // Ĵ
+    { 18, 31, 13, -6, 24, 76, 15632 }, // ĵ
+    { 24, 29, 23, -2, 21, 94, 15708 }, // Ķ
+    { 15, 31, 16, 0, 23, 82, 15802 }, // ķ
+    { 16, 17, 17, 0, 16, 59, 15884 }, // ĸ
+    { 18, 29, 17, -2, 29, 69, 15943 }, // Ĺ
+    { 12, 31, 13, 0, 30, 53, 16012 }, // ĺ
+    { 18, 29, 17, -2, 21, 68, 16065 }, // Ļ
+    { 10, 31, 10, -1, 23, 51, 16133 }, // ļ
+    { 19, 23, 18, -2, 23, 61, 16184 }, // Ľ
+    { 14, 24, 15, 0, 23, 59, 16245 }, // ľ
+    { 19, 21, 18, -2, 21, 57, 16304 }, // Ŀ
+    { 14, 24, 15, 0, 23, 55, 16361 }, // ŀ
+    { 18, 21, 17, -2, 21, 58, 16416 }, // Ł
+    { 12, 24, 12, -1, 23, 44, 16474 }, // ł
+    { 25, 30, 25, -1, 29, 107, 16518 }, // Ń
+    { 18, 26, 19, 0, 25, 71, 16625 }, // ń
+    { 25, 29, 25, -1, 21, 107, 16696 }, // Ņ
+    { 18, 24, 19, 0, 16, 71, 16803 }, // ņ
+    { 25, 30, 25, -1, 29, 111, 16874 }, // Ň
+    { 18, 26, 19, 0, 25, 77, 16985 }, // ň
+    { 23, 23, 25, 1, 22, 79, 17062 }, // ŉ
+    { 25, 27, 25, -1, 21, 105, 17141 }, // Ŋ
+    { 16, 23, 17, 0, 16, 70, 17246 }, // ŋ
+    { 21, 27, 22, 0, 26, 90, 17316 }, // Ō
+    { 16, 22, 17, 0, 21, 56, 17406 }, // ō
+    { 21, 29, 22, 0, 28, 98, 17462 }, // Ŏ
+    { 16, 24, 17, 0, 23, 64, 17560 }, // ŏ
+    { 22, 30, 23, 0, 29, 105, 17624 }, // Ő
+    { 17, 26, 18, 0, 25, 73, 17729 }, // ő
+    { 29, 22, 30, 0, 21, 100, 17802 }, // Œ
+    { 24, 17, 25, 0, 16, 75, 17902 }, // œ
+    { 21, 30, 20, -2, 29, 94, 17977 }, // Ŕ
+    { 15, 25, 16, 0, 25, 58, 18071 }, // ŕ
+    { 21, 29, 20, -2, 21, 94, 18129 }, // Ŗ
+    { 16, 24, 16, -1, 16, 58, 18223 }, // ŗ
+    { 21, 30, 20, -2, 29, 98, 18281 }, // Ř
+    { 15, 25, 16, 0, 25, 61, 18379 }, // ř
+    { 17, 30, 17, -1, 29, 78, 18440 }, // Ś
+    { 15, 26, 15, -1, 25, 57, 18518 }, // ś
+    { 17, 30, 17, -1, 29, 83, 18575 }, // Ŝ
+    { 15, 25, 15, -1, 24, 61, 18658 }, // ŝ
+    { 17, 29, 17, -1, 21, 77, 18719 }, // Ş
+    { 14, 24, 14, -1, 16, 56, 18796 }, // ş
+    { 18, 30, 18, -1, 29, 82, 18852 }, // Š
+    { 16, 26, 16, -1, 25, 61, 18934 }, // š
+    { 20, 29, 22, 1, 21, 77, 18995 }, // Ţ
+    { 13, 27, 14, 0, 19, 57, 19072 }, // ţ
+    { 20, 29, 22, 1, 29, 82, 19129 }, // Ť
+    { 15, 25, 16, 0, 24, 57, 19211 }, // ť
+    { 20, 21, 22, 1, 21, 62, 19268 }, // Ŧ
+    { 13, 20, 14, 0, 19, 44, 19330 }, // ŧ
+    { 22, 29, 25, 2, 28, 90, 19374 }, // Ũ
+    { 18, 24, 19, 0, 23, 77, 19464 }, // ũ
+    { 22, 27, 25, 2, 26, 81, 19541 }, // Ū
+    { 18, 22, 19, 0, 21, 68, 19622 }, // ū
+    { 22, 29, 25, 2, 28, 89, 19690 }, // Ŭ
+    { 18, 24, 19, 0, 23, 76, 19779 }, // ŭ
+    { 22, 30, 25, 2, 29, 93, 19855 }, // Ů
+    { 18, 26, 19, 0, 25, 79, 19948 }, // ů
+    { 22, 30, 25, 2, 29, 96, 20027 }, // Ű
+    { 18, 26, 19, 0, 25, 86, 20123 }, // ű
+    { 22, 28, 25, 2, 21, 84, 20209 }, // Ų
+    { 18, 23, 19, 0, 16, 71, 20293 }, // ų
+    { 29, 30, 32, 2, 29, 134, 20364 }, // Ŵ
+    { 22, 25, 23, 0, 24, 98, 20498 }, // ŵ
+    { 21, 29, 23, 1, 29, 80, 20596 }, // Ŷ
+    { 20, 31, 16, -5, 24, 95, 20676 }, // ŷ
+    { 21, 27, 23, 1, 27, 77, 20771 }, // Ÿ
+    { 19, 30, 19, -1, 29, 82, 20848 }, // Ź
+    { 15, 26, 15, -1, 25, 64, 20930 }, // ź
+    { 19, 29, 19, -1, 28, 79, 20994 }, // Ż
+    { 15, 24, 15, -1, 23, 63, 21073 }, // ż
+    { 19, 30, 19, -1, 29, 87, 21136 }, // Ž
+    { 15, 26, 15, -1, 25, 69, 21223 }, // ž
+    { 22, 30, 17, -6, 23, 81, 21292 }, // ſ
+    { 24, 25, 25, 0, 24, 91, 21373 }, // Ơ
+    { 18, 20, 19, 0, 19, 57, 21464 }, // ơ
+    { 20, 21, 21, 0, 21, 70, 21521 }, // Ƥ
+    { 19, 30, 17, -3, 23, 95, 21591 }, // ƥ
+    { 13, 26, 14, 0, 19, 54, 21686 }, // ƫ
+    { 20, 21, 22, 1, 21, 62, 21740 }, // Ƭ
+    { 15, 24, 16, 0, 23, 58, 21802 }, // ƭ
+    { 20, 27, 22, 1, 21, 77, 21860 }, // Ʈ
+    { 26, 25, 29, 2, 24, 88, 21937 }, // Ư
+    { 21, 20, 22, 0, 19, 69, 22025 }, // ư
+    { 7, 8, 3, -5, 25, 11, 22094 }, // ̀
+    { 6, 8, 5, -2, 25, 14, 22105 }, // ́
+    { 11, 7, 6, -6, 24, 16, 22119 }, // ̂
+    { 10, 5, 6, -5, 23, 14, 22135 }, // ̃
+    { 10, 3, 6, -5, 21, 6, 22149 }, // ̄
+    { 10, 6, 6, -5, 23, 15, 22155 }, // ̆
+    { 6, 5, 4, -3, 23, 9, 22170 }, // ̇
+    { 10, 5, 6, -5, 23, 12, 22179 }, // ̈
+    { 9, 9, 6, -4, 26, 19, 22191 }, // ̉
+    { 8, 9, 5, -4, 25, 19, 22210 }, // ̊
+    { 12, 8, 8, -5, 25, 19, 22229 }, // ̋
+    { 11, 8, 7, -5, 25, 17, 22248 }, // ̌
+    { 9, 7, 4, -6, 24, 19, 22265 }, // ̏
+    { 10, 6, 6, -5, 23, 13, 22284 }, // ̑
+    { 6, 8, 4, -3, 25, 13, 22297 }, // ̒
+    { 7, 9, 5, -3, 26, 13, 22310 }, // ̓
+    { 6, 9, 3, -4, 26, 13, 22323 }, // ̔
+    { 5, 8, 3, -3, 25, 11, 22336 }, // ̕
+    { 6, 7, 4, -3, 19, 11, 22347 }, // ̛
+    { 6, 5, 4, -3, -2, 9, 22358 }, // ̣
+    { 10, 5, 6, -5, -2, 13, 22367 }, // ̤
+    { 8, 7, 5, -4, -1, 15, 22380 }, // ̥
+    { 6, 7, 4, -3, -1, 11, 22395 }, // ̦
+    { 7, 7, 4, -4, -1, 12, 22406 }, // ̧
+    { 6, 8, 4, -3, 1, 11, 22418 }, // ̨
+    { 5, 8, 8, -1, -1, 15, 22429 }, // ̩
+    { 11, 7, 6, -6, -1, 15, 22444 }, // ̭
+    { 10, 7, 6, -5, -1, 14, 22459 }, // ̮
+    { 10, 6, 6, -5, -2, 15, 22473 }, // ̰
+    { 10, 3, 6, -5, -3, 6, 22488 }, // ̱
+    { 10, 6, 6, -5, 23, 14, 22494 }, // ͂
+    { 11, 12, 6, -6, 30, 23, 22508 }, // ̈́
+    { 6, 6, 5, -2, -2, 10, 22531 }, // ͅ
+    { 23, 21, 22, -2, 21, 75, 22541 }, // Α
+    { 19, 22, 18, -2, 21, 70, 22616 }, // Β
+    { 20, 21, 19, -2, 21, 52, 22686 }, // Γ
+    { 20, 21, 21, -1, 21, 66, 22738 }, // Δ
+    { 21, 21, 20, -2, 21, 64, 22804 }, // Ε
+    { 19, 22, 19, -1, 21, 66, 22868 }, // Ζ
+    { 27, 21, 26, -2, 21, 82, 22934 }, // Η
+    { 21, 22, 22, 0, 21, 84, 23016 }, // Θ
+    { 15, 21, 14, -2, 21, 44, 23100 }, // Ι
+    { 24, 22, 23, -2, 21, 76, 23144 }, // Κ
+    { 23, 21, 22, -2, 21, 71, 23220 }, // Λ
+    { 28, 21, 27, -2, 21, 103, 23291 }, // Μ
+    { 25, 22, 25, -1, 21, 87, 23394 }, // Ν
+    { 20, 21, 20, -1, 21, 65, 23481 }, // Ξ
+    { 21, 22, 22, 0, 21, 79, 23546 }, // Ο
+    { 26, 21, 25, -2, 21, 78, 23625 }, // Π
+    { 20, 21, 19, -2, 21, 63, 23703 }, // Ρ
+    { 19, 22, 19, -1, 21, 62, 23766 }, // Σ
+    { 20, 21, 22, 1, 21, 60, 23828 }, // Τ
+    { 20, 21, 22, 1, 21, 63, 23888 }, // Υ
+    { 22, 22, 23, 0, 21, 80, 23951 }, // Φ
+    { 24, 21, 22, -3, 21, 71, 24031 }, // Χ
+    { 24, 21, 27, 2, 21, 85, 24102 }, // Ψ
+    { 23, 21, 25, -1, 21, 87, 24187 }, // Ω
+    { 18, 17, 19, 0, 16, 58, 24274 }, // α
+    { 17, 30, 17, -1, 23, 87, 24332 }, // β
+    { 15, 23, 16, 0, 16, 62, 24419 }, // γ
+    { 17, 24, 18, 0, 23, 67, 24481 }, // δ
+    { 14, 17, 15, 0, 16, 40, 24548 }, // ε
+    { 14, 30, 16, 1, 24, 67, 24588 }, // ζ
+    { 16, 23, 17, 0, 16, 69, 24655 }, // η
+    { 16, 24, 18, 1, 23, 69, 24724 }, // θ
+    { 8, 17, 10, 1, 16, 28, 24793 }, // ι
+    { 17, 17, 18, 0, 16, 59, 24821 }, // κ
+    { 18, 24, 17, -2, 23, 66, 24880 }, // λ
+    { 20, 23, 19, -2, 16, 72, 24946 }, // μ
+    { 15, 17, 16, 0, 16, 48, 25018 }, // ν
+    { 13, 30, 15, 1, 24, 65, 25066 }, // ξ
+    { 15, 17, 16, 0, 16, 47, 25131 }, // ο
+    { 19, 17, 20, 0, 16, 61, 25178 }, // π
+    { 17, 23, 17, -1, 16, 62, 25239 }, // ρ
+    { 13, 22, 14, 0, 16, 46, 25301 }, // ς
+    { 18, 17, 19, 0, 16, 48, 25347 }, // σ
+    { 15, 17, 17, 1, 16, 41, 25395 }, // τ
+    { 15, 17, 17, 1, 16, 51, 25436 }, // υ
+    { 20, 23, 21, 0, 16, 82, 25487 }, // φ
+    { 19, 23, 18, -2, 16, 73, 25569 }, // χ
+    { 21, 28, 23, 1, 21, 105, 25642 }, // ψ
+    { 21, 17, 22, 0, 16, 66, 25747 }, // ω
+    { 23, 28, 22, -2, 21, 90, 25813 }, // Ạ
+    { 17, 23, 18, 0, 16, 67, 25903 }, // ạ
+    { 23, 30, 22, -2, 30, 100, 25970 }, // Ả
+    { 17, 27, 18, 0, 26, 81, 26070 }, // ả
+    { 24, 31, 23, -2, 31, 107, 26151 }, // Ấ
+    { 20, 30, 21, 0, 29, 91, 26258 }, // ấ
+    { 23, 31, 22, -2, 31, 104, 26349 }, // Ầ
+    { 17, 30, 18, 0, 29, 87, 26453 }, // ầ
+    { 24, 31, 23, -2, 31, 110, 26540 }, // Ẩ
+    { 20, 30, 21, 0, 29, 93, 26650 }, // ẩ
+    { 23, 31, 22, -2, 31, 107, 26743 }, // Ẫ
+    { 17, 29, 18, 0, 28, 88, 26850 }, // ẫ
+    { 23, 36, 22, -2, 29, 111, 26938 }, // Ậ
+    { 17, 31, 18, 0, 24, 89, 27049 }, // ậ
+    { 23, 31, 22, -2, 31, 103, 27138 }, // Ắ
+    { 17, 30, 18, 0, 29, 83, 27241 }, // ắ
+    { 23, 31, 22, -2, 31, 103, 27324 }, // Ằ
+    { 17, 30, 18, 0, 29, 82, 27427 }, // ằ
+    { 23, 31, 22, -2, 31, 109, 27509 }, // Ẳ
+    { 17, 30, 18, 0, 29, 89, 27618 }, // ẳ
+    { 23, 31, 22, -2, 31, 106, 27707 }, // Ẵ
+    { 17, 29, 18, 0, 28, 84, 27813 }, // ẵ
+    { 23, 35, 22, -2, 28, 111, 27897 }, // Ặ
+    { 17, 30, 18, 0, 23, 84, 28008 }, // ặ
+    { 21, 28, 20, -2, 21, 79, 28092 }, // Ẹ
+    { 14, 23, 15, 0, 16, 54, 28171 }, // ẹ
+    { 21, 30, 20, -2, 30, 87, 28225 }, // Ẻ
+    { 14, 27, 15, 0, 26, 66, 28312 }, // ẻ
+    { 21, 28, 20, -2, 28, 83, 28378 }, // Ẽ
+    { 15, 24, 16, 0, 23, 61, 28461 }, // ẽ
+    { 23, 31, 22, -2, 31, 100, 28522 }, // Ế
+    { 18, 30, 19, 0, 29, 80, 28622 }, // ế
+    { 21, 31, 20, -2, 31, 93, 28702 }, // Ề
+    { 15, 30, 16, 0, 29, 74, 28795 }, // ề
+    { 23, 31, 22, -2, 31, 104, 28869 }, // Ể
+    { 19, 30, 20, 0, 29, 87, 28973 }, // ể
+    { 21, 31, 20, -2, 31, 95, 29060 }, // Ễ
+    { 15, 29, 16, 0, 28, 78, 29155 }, // ễ
+    { 21, 36, 20, -2, 29, 100, 29233 }, // Ệ
+    { 14, 31, 15, 0, 24, 74, 29333 }, // ệ
+    { 15, 30, 14, -2, 30, 68, 29407 }, // Ỉ
+    { 11, 27, 13, 1, 26, 52, 29475 }, // ỉ
+    { 15, 28, 14, -2, 21, 57, 29527 }, // Ị
+    { 10, 30, 11, 0, 23, 51, 29584 }, // ị
+    { 21, 28, 22, 0, 21, 92, 29635 }, // Ọ
+    { 15, 23, 16, 0, 16, 59, 29727 }, // ọ
+    { 21, 31, 22, 0, 30, 101, 29786 }, // Ỏ
+    { 15, 27, 16, 0, 26, 70, 29887 }, // ỏ
+    { 22, 32, 23, 0, 31, 110, 29957 }, // Ố
+    { 20, 30, 21, 0, 29, 83, 30067 }, // ố
+    { 21, 32, 22, 0, 31, 108, 30150 }, // Ồ
+    { 17, 30, 18, 0, 29, 78, 30258 }, // ồ
+    { 22, 32, 23, 0, 31, 112, 30336 }, // Ổ
+    { 20, 30, 21, 0, 29, 85, 30448 }, // ổ
+    { 21, 32, 22, 0, 31, 110, 30533 }, // Ỗ
+    { 16, 29, 17, 0, 28, 79, 30643 }, // ỗ
+    { 21, 36, 22, 0, 29, 113, 30722 }, // Ộ
+    { 15, 31, 16, 0, 24, 78, 30835 }, // ộ
+    { 24, 30, 25, 0, 29, 106, 30913 }, // Ớ
+    { 18, 26, 19, 0, 25, 68, 31019 }, // ớ
+    { 24, 30, 25, 0, 29, 106, 31087 }, // Ờ
+    { 18, 26, 19, 0, 25, 71, 31193 }, // ờ
+    { 24, 31, 25, 0, 30, 111, 31264 }, // Ở
+    { 18, 27, 19, 0, 26, 80, 31375 }, // ở
+    { 24, 29, 25, 0, 28, 106, 31455 }, // Ỡ
+    { 18, 24, 19, 0, 23, 73, 31561 }, // ỡ
+    { 24, 31, 25, 0, 24, 106, 31634 }, // Ợ
+    { 18, 26, 19, 0, 19, 69, 31740 }, // ợ
+    { 22, 28, 25, 2, 21, 85, 31809 }, // Ụ
+    { 18, 23, 19, 0, 16, 71, 31894 }, // ụ
+    { 22, 31, 25, 2, 30, 96, 31965 }, // Ủ
+    { 18, 27, 19, 0, 26, 84, 32061 }, // ủ
+    { 26, 30, 29, 2, 29, 105, 32145 }, // Ứ
+    { 21, 26, 22, 0, 25, 84, 32250 }, // ứ
+    { 26, 30, 29, 2, 29, 103, 32334 }, // Ừ
+    { 21, 26, 22, 0, 25, 85, 32437 }, // ừ
+    { 26, 31, 29, 2, 30, 111, 32522 }, // Ử
+    { 21, 27, 22, 0, 26, 92, 32633 }, // ử
+    { 26, 29, 29, 2, 28, 104, 32725 }, // Ữ
+    { 21, 24, 22, 0, 23, 86, 32829 }, // ữ
+    { 26, 31, 29, 2, 24, 104, 32915 }, // Ự
+    { 21, 26, 22, 0, 19, 84, 33019 }, // ự
+    { 21, 29, 23, 1, 29, 76, 33103 }, // Ỳ
+    { 20, 32, 16, -5, 25, 91, 33179 }, // ỳ
+    { 21, 28, 23, 1, 21, 72, 33270 }, // Ỵ
+    { 20, 23, 16, -5, 16, 79, 33342 }, // ỵ
+    { 21, 30, 23, 1, 30, 84, 33421 }, // Ỷ
+    { 20, 33, 16, -5, 26, 100, 33505 }, // ỷ
+    { 21, 28, 23, 1, 28, 78, 33605 }, // Ỹ
+    { 20, 30, 16, -5, 23, 94, 33683 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 33777 }, //  
+    { 0, 0, 29, 0, 0, 0, 33777 }, //  
+    { 0, 0, 15, 0, 0, 0, 33777 }, //  
+    { 0, 0, 29, 0, 0, 0, 33777 }, //  
+    { 0, 0, 10, 0, 0, 0, 33777 }, //  
+    { 0, 0, 7, 0, 0, 0, 33777 }, //  
+    { 0, 0, 5, 0, 0, 0, 33777 }, //  
+    { 0, 0, 18, 0, 0, 0, 33777 }, //  
+    { 0, 0, 9, 0, 0, 0, 33777 }, //  
+    { 0, 0, 6, 0, 0, 0, 33777 }, //  
+    { 0, 0, 1, 0, 0, 0, 33777 }, //  
+    { 0, 0, 1, 0, 0, 0, 33777 }, // ​
+    { 2, 24, 2, -1, 17, 24, 33777 }, // ‌
+    { 6, 26, 4, -3, 19, 42, 33801 }, // ‍
+    { 10, 28, 6, -5, 21, 55, 33843 }, // ‎
+    { 10, 28, 6, -5, 21, 54, 33898 }, // ‏
+    { 10, 5, 12, 1, 10, 8, 33952 }, // ‐
+    { 10, 5, 12, 1, 10, 8, 33960 }, // ‑
+    { 14, 3, 18, 2, 11, 6, 33968 }, // ‒
+    { 15, 3, 16, 0, 9, 8, 33974 }, // –
+    { 29, 3, 30, 0, 9, 11, 33982 }, // —
+    { 29, 3, 30, 0, 9, 11, 33993 }, // ―
+    { 11, 30, 15, 2, 23, 94, 34004 }, // ‖
+    { 15, 8, 16, 0, -1, 22, 34098 }, // ‗
+    { 7, 10, 10, 2, 22, 17, 34120 }, // ‘
+    { 8, 10, 10, 1, 22, 13, 34137 }, // ’
+    { 7, 10, 9, 0, 4, 16, 34150 }, // ‚
+    { 7, 10, 9, 1, 22, 16, 34166 }, // ‛
+    { 13, 10, 16, 2, 22, 33, 34182 }, // “
+    { 14, 10, 16, 1, 22, 30, 34215 }, // ”
+    { 13, 10, 15, 0, 4, 30, 34245 }, // „
+    { 13, 10, 15, 1, 22, 31, 34275 }, // ‟
+    { 13, 19, 15, 1, 21, 45, 34306 }, // †
+    { 15, 23, 15, -1, 21, 62, 34351 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 34413 }, // •
+    { 10, 10, 18, 4, 15, 19, 34426 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 34445 }, // ․
+    { 13, 6, 15, 1, 5, 17, 34454 }, // ‥
+    { 25, 6, 29, 2, 5, 25, 34471 }, // …
+    { 6, 6, 8, 1, 11, 8, 34496 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 34504 }, //  
+    { 0, 0, 1, 0, 0, 0, 34504 }, //  
+    { 10, 28, 6, -5, 21, 53, 34504 }, // ‪
+    { 10, 28, 6, -5, 21, 52, 34557 }, // ‫
+    { 10, 27, 6, -5, 20, 48, 34609 }, // ‬
+    { 12, 28, 7, -6, 21, 73, 34657 }, // ‭
+    { 12, 28, 7, -6, 21, 73, 34730 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 34803 }, //  
+    { 39, 24, 41, 1, 22, 151, 34803 }, // ‰
+    { 7, 11, 8, 0, 21, 16, 34954 }, // ′
+    { 13, 11, 14, 0, 21, 31, 34970 }, // ″
+    { 20, 11, 21, 0, 21, 46, 35001 }, // ‴
+    { 7, 11, 8, 0, 21, 15, 35047 }, // ‵
+    { 13, 11, 14, 0, 21, 30, 35062 }, // ‶
+    { 20, 11, 21, 0, 21, 45, 35092 }, // ‷
+    { 13, 6, 15, 1, 0, 16, 35137 }, // ‸
+    { 9, 12, 11, 1, 13, 18, 35153 }, // ‹
+    { 10, 12, 11, 0, 13, 21, 35171 }, // ›
+    { 18, 20, 19, 0, 19, 80, 35192 }, // ※
+    { 17, 23, 19, 1, 22, 71, 35272 }, // ‼
+    { 15, 4, 16, 0, 25, 20, 35343 }, // ‾
+    { 7, 5, 9, 1, 10, 6, 35363 }, // ⁃
+    { 19, 24, 15, -5, 22, 52, 35369 }, // ⁄
+    { 21, 23, 24, 2, 22, 80, 35421 }, // ⁇
+    { 19, 23, 22, 2, 22, 74, 35501 }, // ⁈
+    { 19, 23, 21, 1, 22, 75, 35575 }, // ⁉
+    { 17, 7, 29, 6, 12, 23, 35650 }, // ⁓
+    { 26, 11, 27, 0, 21, 61, 35673 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 35734 }, //  
+    { 0, 0, 1, 0, 0, 0, 35734 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 35734 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 35734 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 35734 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 35734 }, // ⁤
+    { 13, 14, 14, 0, 24, 36, 35734 }, // ⁰
+    { 13, 14, 14, 0, 24, 38, 35770 }, // ⁴
+    { 13, 14, 14, 0, 24, 34, 35808 }, // ⁵
+    { 12, 14, 14, 1, 24, 36, 35842 }, // ⁶
+    { 11, 14, 14, 2, 24, 32, 35878 }, // ⁷
+    { 11, 14, 13, 1, 24, 37, 35910 }, // ⁸
+    { 12, 14, 13, 0, 24, 35, 35947 }, // ⁹
+    { 11, 11, 16, 3, 21, 32, 35982 }, // ⁿ
+    { 13, 15, 14, 0, 10, 38, 36014 }, // ₀
+    { 9, 14, 13, 1, 10, 24, 36052 }, // ₁
+    { 12, 14, 13, 0, 10, 34, 36076 }, // ₂
+    { 11, 15, 13, 1, 10, 30, 36110 }, // ₃
+    { 13, 14, 14, 0, 10, 33, 36140 }, // ₄
+    { 13, 14, 14, 0, 9, 30, 36173 }, // ₅
+    { 12, 15, 14, 1, 10, 34, 36203 }, // ₆
+    { 11, 14, 14, 2, 9, 28, 36237 }, // ₇
+    { 11, 15, 13, 1, 10, 36, 36265 }, // ₈
+    { 12, 15, 13, 0, 10, 34, 36301 }, // ₉
+    { 20, 20, 20, -1, 20, 58, 36335 }, // ₣
+    { 19, 22, 19, -1, 21, 68, 36393 }, // ₤
+    { 38, 22, 39, 0, 21, 126, 36461 }, // ₧
+    { 20, 22, 20, -1, 21, 62, 36587 }, // €
+    { 19, 14, 29, 5, 17, 43, 36649 }, // ←
+    { 13, 20, 29, 8, 20, 36, 36692 }, // ↑
+    { 19, 14, 29, 5, 17, 43, 36728 }, // →
+    { 13, 20, 29, 8, 20, 37, 36771 }, // ↓
+    { 19, 14, 29, 5, 17, 48, 36808 }, // ↔
+    { 13, 20, 29, 8, 20, 45, 36856 }, // ↕
+    { 15, 20, 29, 7, 20, 56, 36901 }, // ↨
+    { 13, 20, 29, 8, 20, 54, 36957 }, // ↲
+    { 13, 20, 29, 8, 20, 52, 37011 }, // ↳
+    { 17, 16, 29, 6, 18, 47, 37063 }, // ↵
+    { 19, 16, 29, 5, 18, 51, 37110 }, // ⇐
+    { 17, 18, 29, 6, 19, 68, 37161 }, // ⇑
+    { 19, 16, 29, 5, 18, 51, 37229 }, // ⇒
+    { 17, 18, 29, 6, 19, 68, 37280 }, // ⇓
+    { 19, 16, 29, 5, 18, 48, 37348 }, // ⇔
+    { 21, 22, 29, 4, 21, 68, 37396 }, // ∀
+    { 16, 24, 18, 1, 23, 62, 37464 }, // ∂
+    { 15, 21, 29, 7, 21, 57, 37526 }, // ∃
+    { 23, 24, 29, 3, 22, 101, 37583 }, // ∅
+    { 20, 21, 21, 0, 21, 69, 37684 }, // ∆
+    { 19, 22, 29, 5, 21, 65, 37753 }, // ∇
+    { 21, 21, 29, 4, 21, 70, 37818 }, // ∈
+    { 21, 26, 29, 4, 23, 88, 37888 }, // ∉
+    { 21, 18, 29, 4, 19, 68, 37976 }, // ∊
+    { 21, 21, 29, 4, 21, 70, 38044 }, // ∋
+    { 21, 26, 29, 4, 23, 88, 38114 }, // ∌
+    { 21, 18, 29, 4, 19, 69, 38202 }, // ∍
+    { 23, 26, 25, 1, 21, 101, 38271 }, // ∏
+    { 19, 26, 20, 0, 21, 78, 38372 }, // ∑
+    { 14, 4, 18, 2, 12, 13, 38450 }, // −
+    { 17, 23, 17, -1, 21, 49, 38463 }, // ∕
+    { 15, 23, 16, 0, 21, 46, 38512 }, // ∖
+    { 14, 14, 18, 2, 17, 44, 38558 }, // ∗
+    { 12, 11, 18, 3, 15, 27, 38602 }, // ∘
+    { 6, 6, 18, 6, 11, 7, 38629 }, // ∙
+    { 19, 28, 19, -1, 24, 75, 38636 }, // √
+    { 14, 12, 18, 2, 15, 39, 38711 }, // ∝
+    { 18, 11, 19, 0, 15, 47, 38750 }, // ∞
+    { 19, 21, 29, 5, 21, 51, 38797 }, // ∟
+    { 23, 21, 29, 3, 21, 61, 38848 }, // ∠
+    { 5, 30, 15, 5, 23, 47, 38909 }, // ∣
+    { 11, 30, 15, 2, 23, 94, 38956 }, // ∥
+    { 21, 21, 29, 4, 21, 62, 39050 }, // ∧
+    { 21, 21, 29, 4, 21, 61, 39112 }, // ∨
+    { 17, 21, 29, 6, 21, 67, 39173 }, // ∩
+    { 17, 22, 29, 6, 21, 66, 39240 }, // ∪
+    { 16, 30, 18, 1, 23, 69, 39306 }, // ∫
+    { 19, 18, 29, 5, 17, 38, 39375 }, // ∴
+    { 19, 18, 29, 5, 17, 40, 39413 }, // ∵
+    { 7, 17, 9, 1, 18, 20, 39453 }, // ∶
+    { 19, 18, 29, 5, 17, 46, 39473 }, // ∷
+    { 17, 7, 29, 6, 12, 23, 39519 }, // ∼
+    { 17, 17, 29, 6, 18, 50, 39542 }, // ≅
+    { 14, 12, 18, 2, 16, 38, 39592 }, // ≈
+    { 17, 12, 29, 6, 14, 36, 39630 }, // ≍
+    { 14, 15, 18, 2, 17, 39, 39666 }, // ≠
+    { 17, 15, 29, 6, 16, 53, 39705 }, // ≡
+    { 14, 18, 18, 2, 18, 40, 39758 }, // ≤
+    { 14, 18, 18, 2, 18, 42, 39798 }, // ≥
+    { 25, 14, 29, 2, 17, 61, 39840 }, // ≪
+    { 25, 14, 29, 2, 17, 61, 39901 }, // ≫
+    { 21, 18, 29, 4, 19, 53, 39962 }, // ⊃
+    { 21, 26, 29, 4, 23, 80, 40015 }, // ⊄
+    { 21, 26, 29, 4, 23, 79, 40095 }, // ⊅
+    { 19, 21, 29, 5, 21, 70, 40174 }, // ⊆
+    { 19, 21, 29, 5, 21, 71, 40244 }, // ⊇
+    { 21, 22, 29, 4, 21, 94, 40315 }, // ⊕
+    { 21, 22, 29, 4, 21, 74, 40409 }, // ⊖
+    { 21, 22, 29, 4, 21, 100, 40483 }, // ⊗
+    { 21, 22, 29, 4, 21, 90, 40583 }, // ⊘
+    { 17, 21, 29, 6, 21, 58, 40673 }, // ⊥
+    { 6, 6, 18, 6, 11, 7, 40731 }, // ⋅
+    { 25, 6, 29, 2, 11, 25, 40738 }, // ⋯
+    { 27, 28, 29, 1, 24, 109, 40763 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_bolditalicIntervals[] = {
@@ -4783,4 +3324,5 @@ static const EpdFontData bookerly_14_bolditalic = {
     31,
     -8,
     true,
+    true,
 };
@@ -2,4413 +2,3152 @@
  * generated by fontconvert.py
  * name: bookerly_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_italicBitmaps[59535] = {
-    0x00, 0x05, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x02, 0xC0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x0F,
-    0xC0, 0x01, 0x40, 0x00, 0x02, 0x40, 0x90, 0xF4, 0x3D, 0x1F, 0x07, 0xC2, 0xF0, 0xBC, 0x2E, 0x0B,
-    0x83, 0xD0, 0xF4, 0x3C, 0x0F, 0x03, 0x80, 0xE0, 0x34, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x38, 0x00, 0x00, 0xB4, 0x07, 0x40, 0x00, 0x0F, 0x00,
-    0xB0, 0x00, 0xAA, 0xFA, 0xAF, 0xA9, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00,
-    0x2C, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x38, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0xB8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x06, 0xAF, 0xAA, 0xFA, 0xA0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x1E,
-    0x01, 0xE0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x7F, 0xBF, 0xFC, 0x00, 0xF8, 0x38,
-    0xBD, 0x02, 0xF0, 0x74, 0x3E, 0x03, 0xE0, 0xB0, 0x3D, 0x03, 0xF0, 0xF0, 0x00, 0x02, 0xF8, 0xE0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x07, 0x6F, 0xC0, 0x10, 0x0B, 0x0B, 0xE0, 0xB4, 0x0F, 0x07, 0xE0, 0xF8, 0x0E, 0x07,
-    0xE0, 0xFC, 0x1D, 0x0B, 0xD0, 0xBF, 0x6C, 0x2F, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xAF, 0x40, 0x00,
-    0xF8, 0x00, 0x1F, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x0F, 0x00, 0x3D, 0x00, 0x02, 0xD0, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0xF4, 0x01, 0xE0, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x0F, 0x40, 0x6E, 0x02, 0xE0, 0x3D,
-    0x0B, 0x80, 0xFF, 0xF0, 0x7E, 0xBD, 0x07, 0xC0, 0xF8, 0x2E, 0x07, 0xFD, 0x03, 0xC0, 0xB8, 0x07,
-    0xC0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x3C, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x1F, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0xF4, 0x03, 0xC0,
-    0x00, 0xBC, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xD6, 0xF0, 0x00, 0x3E, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x04, 0x00, 0x2F, 0x7E,
-    0x00, 0x00, 0x34, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xD0, 0x0B, 0xF0, 0x00, 0x1B, 0xFE, 0x01, 0xFB,
-    0xD0, 0x1B, 0xFF, 0x80, 0x0F, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0xF4, 0x2F, 0x07, 0x4F, 0x00, 0x07,
-    0x80, 0x3E, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0xBD, 0x02, 0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x0F, 0x00,
-    0x03, 0xD0, 0x01, 0xFD, 0xF4, 0x00, 0x0F, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x07, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xD0, 0xBF, 0xF5, 0x00, 0x01, 0x40,
-    0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0x43, 0xD1, 0xF0, 0xBC, 0x2E, 0x0F,
-    0x43, 0xC0, 0xE0, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x07, 0xE0, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x1C, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0xB4, 0x50, 0x1F, 0xFF,
-    0x0B, 0xF5, 0xF3, 0xF3, 0x80, 0x2C, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x0F, 0xE0, 0x1F,
-    0x80, 0x7D, 0x02, 0xF0, 0x0F, 0x40, 0xF8, 0x0F, 0x80, 0x64, 0x00, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB,
-    0xFF, 0xF4, 0x06, 0x0B, 0xE3, 0xF8, 0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFD, 0x5B, 0xF4, 0x00, 0x7E, 0x00,
-    0x2F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFC, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01,
-    0xF8, 0x3F, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0xF8, 0x00, 0xAB, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x57, 0xFC, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x0E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0x42, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0x96, 0xFD, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x1B, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x04, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1B, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x0F, 0xC0,
-    0x0F, 0x80, 0x0F, 0xC0, 0x03, 0xE0, 0x0B, 0xD0, 0x01, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x6F, 0xF4,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xE4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07,
-    0xF5, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xAF, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xEA, 0xAB, 0xFC, 0x2F, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x0B, 0xC0, 0x3C,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0x40, 0xFD, 0x00,
-    0xFC, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0xBC, 0x01, 0xF8, 0x01, 0xF8, 0x00,
-    0xFE, 0x07, 0xE0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xF4, 0x7F, 0xC0, 0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x03, 0xE0, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0xFD, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x2F, 0xC0, 0x03, 0xE0, 0x03, 0xFE, 0x6B, 0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x01,
-    0x69, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFC, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x2F, 0x80, 0x3F,
-    0x80, 0x3F, 0x00, 0x04, 0x00, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xCA, 0xAA,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xF2, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x01,
-    0xFF, 0x40, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xA4, 0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0xC1, 0x90, 0xBD, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0xF8,
-    0x00, 0x2E, 0x00, 0x03, 0xFA, 0x00, 0x2F, 0xE0, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xAF, 0xE0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x1F, 0x40, 0x06, 0xE0, 0x90, 0x2F, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x7C,
-    0x0B, 0xC0, 0x0F, 0x82, 0xFC, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x02, 0xE0, 0x07, 0xC1, 0xF0, 0x07,
-    0xC0, 0x0B, 0x40, 0x1F, 0x0B, 0x80, 0x2F, 0x00, 0x3C, 0x00, 0xB8, 0x3D, 0x00, 0xF4, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x03, 0xC0, 0x0F, 0x80, 0x2F, 0x03, 0xC0, 0x1F, 0x00, 0xBD, 0x00, 0xF4, 0x1F,
-    0x00, 0x7C, 0x07, 0xB4, 0x0F, 0x80, 0x3D, 0x00, 0xF8, 0xB6, 0xE6, 0xF8, 0x00, 0xF4, 0x03, 0xFF,
-    0x4B, 0xFF, 0x40, 0x03, 0xE0, 0x03, 0xE4, 0x0B, 0x90, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEA, 0xFF, 0x40, 0x00, 0x7D, 0x01, 0xFC,
-    0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4,
-    0x00, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x02, 0xFA, 0xAF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x03, 0xE5, 0x6F, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x80, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x02,
-    0xF0, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x0B,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x03, 0xFC, 0x00,
-    0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xF8,
-    0x00, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40,
-    0x17, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x02, 0xF8,
-    0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x00, 0x38, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x55, 0x54, 0xBC, 0x00, 0x07, 0xFF, 0xF2, 0xF0, 0x00, 0x05, 0xBF, 0x0B, 0xD0, 0x00,
-    0x00, 0xF8, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x00, 0xBC,
-    0x00, 0xFF, 0x90, 0x1B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55,
-    0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE,
-    0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06,
-    0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xD0,
-    0xBD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x1F,
-    0xF8, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x4F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xE0,
-    0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x01, 0xFB, 0xC0,
-    0x02, 0xEB, 0xC0, 0x00, 0x02, 0xE7, 0xD0, 0x07, 0xCB, 0xC0, 0x00, 0x03, 0xD3, 0xD0, 0x0F, 0x4F,
-    0xC0, 0x00, 0x07, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x80, 0x00,
-    0x0F, 0x42, 0xF0, 0x78, 0x0F, 0x80, 0x00, 0x0F, 0x02, 0xF0, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x01,
-    0xF2, 0xE0, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xFF, 0x40,
-    0x1F, 0x40, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0xB8, 0x00, 0xBD, 0x00, 0x1F, 0x00,
-    0x00, 0xF4, 0x00, 0x78, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x1B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x00,
-    0x7E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC7, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA,
-    0xFF, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02, 0xF0, 0x02,
-    0xF4, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xE0, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xAF, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xF0, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03,
-    0xF0, 0x00, 0x1F, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x03, 0xF5, 0xBF, 0x80, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0xFC, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x07, 0xF0,
-    0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xD0, 0x0B, 0xF4, 0xBF, 0xFF, 0x80, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFA, 0xFF, 0x80,
-    0xBD, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x03, 0xC0, 0x7E, 0x00, 0x08, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00, 0xFC, 0x1E, 0x00, 0x02, 0xF0,
-    0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E,
-    0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x00,
-    0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC7, 0xFF, 0x90, 0x06, 0xFF, 0x80, 0x3F,
-    0x00, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x7E,
-    0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x01, 0xF4,
-    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x03, 0xE3,
-    0xE0, 0x00, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xB0, 0x00,
-    0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x1F, 0x00, 0x0B, 0xFF, 0x40, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0x80, 0x07, 0xE0, 0x00, 0x7F, 0x40, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xF4, 0x00, 0x3E, 0x00,
-    0x03, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0xF8, 0x00, 0xF8, 0x00, 0x03,
-    0xF0, 0x07, 0xCF, 0x80, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0xFC, 0x02, 0xE0, 0x00, 0x03, 0xF0,
-    0x1F, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0xBC, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x3C,
-    0x07, 0xC0, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0x80, 0x7C, 0x2E, 0x00, 0x00, 0x02, 0xF0, 0xF0, 0x07,
-    0xD3, 0xC0, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x03, 0xDF,
-    0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F, 0xFF, 0x80,
-    0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0x40, 0x01,
-    0xFC, 0x01, 0xE0, 0x00, 0x3F, 0x00, 0x2D, 0x00, 0x0F, 0xC0, 0x00, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xB0, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x02, 0xF0,
-    0x3F, 0x80, 0x55, 0x7E, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0xAA, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xF9, 0xF0,
-    0x00, 0x0F, 0x0F, 0x40, 0x02, 0xE0, 0xB8, 0x00, 0x3D, 0x07, 0xC0, 0x07, 0xC0, 0x3D, 0x00, 0xF8,
-    0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xF8, 0x3D, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x28,
-    0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x00, 0x03, 0x80, 0xBD,
-    0x07, 0xF0, 0x1F, 0x80, 0x7C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4,
-    0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0,
-    0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00,
-    0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C,
-    0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x03, 0xD2,
-    0xFF, 0xC0, 0x0F, 0x2E, 0x6F, 0x80, 0x7E, 0xD0, 0x3F, 0x02, 0xFE, 0x00, 0xFC, 0x0F, 0xF0, 0x03,
-    0xF0, 0x3F, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0x3D, 0x0B, 0xC0, 0x01, 0xF0, 0x2F, 0x00, 0x0F, 0xC0,
-    0xF8, 0x00, 0x7D, 0x07, 0xD0, 0x03, 0xE0, 0x2F, 0x80, 0x7F, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xDF,
-    0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0,
-    0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x1A, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xF6, 0xF0, 0x00, 0x7F, 0xFF,
-    0xE0, 0x01, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x1F, 0x40, 0x7C, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F,
-    0x00, 0xBC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B,
-    0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28,
-    0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x1E,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x0F,
-    0x80, 0x00, 0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x2B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xEF, 0xFF,
-    0x40, 0x02, 0xF4, 0x0F, 0x50, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x03,
-    0xE0, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x00, 0x1F, 0x80,
-    0x0B, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x7E,
-    0x00, 0x3F, 0xE5, 0x5F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xFA, 0x40, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x3D, 0x1F, 0xFE, 0x00, 0x0F, 0x1F, 0x9F, 0xC0, 0x07,
-    0xCF, 0x03, 0xF0, 0x02, 0xEF, 0x00, 0xF8, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x3F, 0x80, 0x1F, 0x00,
-    0x1F, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x7C,
-    0x00, 0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0, 0x03, 0xFF, 0x03, 0xE0, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xFC, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x1F, 0xFD, 0x00, 0x1F, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0,
-    0x00, 0xF8, 0x70, 0x3E, 0xBC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x80, 0xF4,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0xBF, 0x80, 0x2E, 0x3F, 0xFD,
-    0x03, 0xEF, 0x43, 0xD0, 0x3F, 0xC0, 0x3D, 0x07, 0xF0, 0x0B, 0xC0, 0xBC, 0x01, 0xF4, 0x0B, 0x81,
-    0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x2F, 0x0F, 0x80, 0x03,
-    0xE0, 0xBE, 0x00, 0x3D, 0x03, 0xFC, 0x07, 0xD0, 0x0F, 0xFE, 0xBC, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x14, 0x0F, 0xFD, 0x1A, 0xFD, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xF4, 0x01,
-    0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F,
-    0x40, 0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3D, 0x28, 0x7E, 0xF4, 0xBF, 0xE0, 0x7F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xD0, 0x0B, 0xE0, 0xBF, 0xF0, 0xBF,
-    0xF0, 0x7F, 0xF4, 0x03, 0xE2, 0xF7, 0xF1, 0xF6, 0xF4, 0x03, 0xDB, 0x82, 0xE7, 0xC1, 0xF4, 0x03,
-    0xEE, 0x02, 0xEF, 0x01, 0xF0, 0x07, 0xFC, 0x03, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xF4, 0x03,
-    0xE0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xC0, 0x1F, 0x80, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x2F, 0x00, 0x1F, 0x00, 0x0F, 0x4A, 0x3E,
-    0x00, 0x2F, 0x00, 0x1F, 0x7E, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0xF8, 0x7C, 0x00, 0x3D, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF,
-    0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07,
-    0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F,
-    0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D,
-    0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E,
-    0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00,
-    0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0B, 0xF0,
-    0x02, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0xF8, 0xF5, 0xFC, 0x00, 0x0F, 0x7C, 0x0B, 0xD0, 0x00, 0xFF,
-    0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x07, 0xD0, 0x02, 0xFC, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xBF, 0xF4, 0x00, 0x02,
-    0xF0, 0x10, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xD0, 0x0B, 0xFF, 0xFF, 0x00, 0xFD, 0x0B, 0xF8, 0x0B, 0xC0,
-    0x07, 0xD0, 0x3D, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x7C, 0x00, 0x1F,
-    0x42, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x07, 0xF0, 0x3F, 0x00, 0x3F, 0x80, 0xFC, 0x03, 0xFD, 0x02,
-    0xF8, 0x7C, 0xF0, 0x07, 0xFF, 0xD3, 0xC0, 0x0B, 0xF8, 0x1F, 0x00, 0x01, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x06, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x7E, 0xBF, 0xF1, 0xFF, 0x02,
-    0xE3, 0xFE, 0x03, 0xDB, 0x40, 0x03, 0xEE, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xE0, 0x7C, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x74, 0x01, 0xF0, 0xBE, 0x03, 0xE0,
-    0x7F, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x00,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0, 0x0F, 0xFF, 0xC0, 0x07,
-    0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00,
-    0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03,
-    0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F,
-    0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F,
-    0x87, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x0F, 0x80, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xB8, 0x0F, 0x80, 0x02, 0xF0, 0x7C, 0x00, 0x07,
-    0xC3, 0xD0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x7F, 0xE0, 0x0B, 0xD0, 0x0B, 0xE0, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x02,
-    0xF4, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0x40, 0x3F, 0x00, 0x3D, 0x00, 0xF8, 0x07, 0xF4, 0x07, 0xC0,
-    0x0F, 0xC0, 0xBF, 0x40, 0xF8, 0x00, 0xBC, 0x0F, 0xF8, 0x0F, 0x00, 0x07, 0xC1, 0xEB, 0x82, 0xE0,
-    0x00, 0x3C, 0x3C, 0x7C, 0x3C, 0x00, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x00, 0x3D, 0xF0, 0x3D, 0xF0,
-    0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFC,
-    0x07, 0xFF, 0x00, 0x7F, 0xC0, 0x65, 0xF8, 0x1F, 0x98, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0x7D,
-    0xB8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x3C, 0x2F,
-    0x00, 0x02, 0x5F, 0x41, 0xF9, 0x60, 0x3F, 0xE0, 0x0F, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0,
-    0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81,
-    0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00,
-    0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00, 0xBE, 0x00, 0xC0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5, 0xF4, 0xFF, 0xFF, 0xFF,
-    0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x0B,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x07,
-    0x80, 0x0B, 0x40, 0x0F, 0x40, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x3E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x2F,
-    0xF0, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0D, 0x3F, 0xFF, 0x43, 0xE7,
-    0xD2, 0xFF, 0xFC, 0x74, 0x02, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x0F, 0xC0, 0x07,
-    0xF0, 0x01, 0xF4, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1D,
-    0x00, 0x0B, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x01, 0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0x1E,
-    0x1D, 0x0F, 0xC1, 0xD0, 0x02, 0xF0, 0x2C, 0x00, 0x3E, 0x03, 0xC0, 0x03, 0xD0, 0x38, 0x00, 0x7C,
-    0x07, 0x40, 0x0B, 0xC0, 0xB0, 0x00, 0xBC, 0x0F, 0x00, 0x07, 0xD0, 0xE0, 0x04, 0x3F, 0x1D, 0x07,
-    0xC2, 0xFF, 0xD7, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0A, 0xFE, 0xAA, 0x80, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xAF, 0x95, 0x56, 0xB4, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0x96, 0xBF, 0xFE, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x2D, 0x03, 0xD2, 0xFF, 0x8F, 0x80, 0x0F, 0xFE, 0xFF, 0xD0, 0x00,
-    0x7D, 0x01, 0xF4, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x1E, 0x00, 0x0F,
-    0x40, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x5F, 0xD0, 0x02, 0xFB,
-    0xFF, 0xEF, 0x40, 0xB8, 0x0A, 0x90, 0x3C, 0x01, 0x00, 0x00, 0x01, 0x00, 0x7F, 0xFF, 0x01, 0xFF,
-    0xF9, 0xFF, 0xF8, 0x07, 0xFF, 0xD0, 0xFE, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x3F, 0x03,
-    0xD0, 0x00, 0x19, 0xFD, 0x3F, 0x64, 0x00, 0x7F, 0xFA, 0xFF, 0xD0, 0x00, 0x56, 0xFF, 0x55, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x0B, 0x40, 0x0F,
-    0x40, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x14,
-    0x00, 0x00, 0x06, 0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0x0F, 0x41, 0xF8, 0x0F, 0x40, 0x2E, 0x0F, 0xD0,
-    0x07, 0x47, 0xBC, 0x00, 0x02, 0xCB, 0x80, 0x00, 0xF0, 0xF8, 0x00, 0x3C, 0x0B, 0xC0, 0x0B, 0x00,
-    0xBD, 0x01, 0xF0, 0x07, 0xD0, 0x3F, 0x00, 0x7C, 0x03, 0xF4, 0x0F, 0x40, 0x2F, 0x42, 0xD0, 0x01,
-    0xF4, 0x74, 0x00, 0x1F, 0x2D, 0x00, 0x01, 0xEB, 0x09, 0x00, 0x3F, 0x8F, 0x80, 0x0F, 0xD3, 0xF0,
-    0x07, 0xE0, 0xBF, 0x9B, 0xE0, 0x0B, 0xFF, 0xD0, 0x00, 0x15, 0x00, 0x00, 0x18, 0x01, 0x47, 0xE0,
-    0xBE, 0xBE, 0x0F, 0xD7, 0x80, 0xB8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00,
-    0x2E, 0x00, 0xB4, 0x01, 0xBE, 0x40, 0xB4, 0x0F, 0x00, 0xFF, 0xF8, 0x03, 0xC2, 0xD0, 0x3D, 0x03,
-    0x80, 0x2C, 0x3C, 0x07, 0x80, 0x34, 0x01, 0xE3, 0xC0, 0xB4, 0x00, 0x00, 0x0E, 0x38, 0x0F, 0x00,
-    0x00, 0x00, 0xF3, 0x80, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0xE3, 0xC0, 0xBC,
-    0x00, 0x00, 0x1E, 0x2D, 0x03, 0xE4, 0x18, 0x02, 0xC0, 0xE0, 0x1F, 0xFF, 0xC0, 0x3C, 0x0B, 0x40,
-    0x1A, 0x90, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03,
-    0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x07, 0xFF, 0xC0, 0x7D, 0x7E, 0x03, 0xD0, 0xB4, 0x1E, 0x03, 0xC0, 0xB4, 0x0F, 0x03,
-    0xC0, 0xB8, 0x0F, 0x07, 0xD1, 0x3E, 0xBB, 0xB4, 0xBF, 0x4F, 0xC0, 0x50, 0x14, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE2, 0xFF, 0xFE, 0x00, 0x00, 0x18, 0x01, 0x80, 0x0B, 0xC0, 0xBC, 0x03, 0xF0, 0x3F,
-    0x00, 0xFC, 0x1F, 0xC0, 0x7F, 0x07, 0xF0, 0x0F, 0xD0, 0xFC, 0x00, 0xFD, 0x0F, 0xC0, 0x03, 0xF0,
-    0x3E, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x90, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D,
-    0x3F, 0xF4, 0x2C, 0x0B, 0x03, 0x8F, 0x03, 0x83, 0x80, 0xE2, 0xC0, 0xB0, 0xD0, 0x3D, 0xE0, 0x2C,
-    0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0x8E, 0x02, 0xC3, 0xC0, 0xE1, 0xE0, 0xE0, 0x70, 0xFE, 0x1D,
-    0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x2A, 0xAA, 0x47, 0xFF, 0xFC, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0xFF, 0xFD, 0x0B, 0x80, 0xBC, 0x3C, 0x00, 0xF4, 0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x0B, 0xC0, 0xBC,
-    0x0F, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x2A, 0xAF, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0,
-    0x55, 0xF5, 0x54, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0x80, 0x0F, 0xFF, 0xC0, 0xBD, 0x1F, 0x43, 0xC0, 0x3D, 0x04, 0x00, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x2F,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x3F, 0xFD, 0x0B, 0x82, 0xE0,
-    0x60, 0x1E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x02, 0xFF, 0x00, 0x2A, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x0F, 0x81, 0x5B, 0xE0, 0xBF, 0xF4, 0x01, 0x94, 0x00, 0x00, 0x40, 0x3E, 0x0B, 0xD1,
-    0xF8, 0x3E, 0x0B, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-    0x00, 0xF4, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xF8,
-    0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0xBA, 0xE6, 0xC0, 0xBF, 0xFF, 0xC7, 0xFE, 0x02, 0xDF, 0xF8,
-    0x0F, 0xD0, 0x0F, 0x01, 0x00, 0x04, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xCB, 0x00, 0x00, 0x7F, 0xFF, 0x3C, 0x00,
-    0x03, 0xFF, 0xF8, 0xF0, 0x00, 0x1F, 0xFF, 0xD3, 0x80, 0x00, 0xBF, 0xFF, 0x1D, 0x00, 0x03, 0xFF,
-    0xFC, 0xB0, 0x00, 0x0F, 0xFF, 0xF3, 0xC0, 0x00, 0x2F, 0xFF, 0x8F, 0x00, 0x00, 0x7F, 0xFD, 0x38,
-    0x00, 0x00, 0xFF, 0xF1, 0xD0, 0x00, 0x00, 0xBB, 0xCB, 0x00, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00,
-    0x00, 0x38, 0xF0, 0x00, 0x00, 0x01, 0xD3, 0x80, 0x00, 0x00, 0x0B, 0x1D, 0x00, 0x00, 0x00, 0x3C,
-    0xB0, 0x00, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x00, 0x07, 0x5D, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x00,
-    0x01, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xBE, 0x50, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xDB, 0xF1, 0xF4, 0x00, 0x00, 0x06, 0x41, 0xFE, 0x03, 0xE0,
-    0x3D, 0x0B, 0x87, 0xE0, 0x50, 0x00, 0x00, 0x1D, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x7C, 0x00, 0xBC,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x1B, 0xF4, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0x5F, 0x40, 0xF0, 0x2E, 0x0B, 0x80, 0xB8,
-    0x3D, 0x03, 0xE0, 0xF0, 0x0F, 0x03, 0xC0, 0xBC, 0x0F, 0x8B, 0xC0, 0x1F, 0xFC, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x60, 0x00, 0x3C, 0x07, 0xC0,
-    0x01, 0xF0, 0x2F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x7F, 0x0B, 0xE0, 0x03, 0xF0, 0x7F, 0x00, 0xFD,
-    0x0F, 0xD0, 0x3F, 0x43, 0xF0, 0x0B, 0xC0, 0xFC, 0x02, 0xF0, 0x3E, 0x00, 0x24, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x6D,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x06, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x02, 0xE0, 0x00,
-    0x0F, 0x40, 0x03, 0xFC, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x0F, 0x7C, 0x1F, 0xF8, 0x00, 0x7C, 0x00,
-    0x3D, 0x78, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0xF4, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3D, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x1F, 0xF4, 0x01, 0xF0,
-    0x00, 0x0F, 0x00, 0xBF, 0xFC, 0x02, 0xE0, 0x00, 0x3C, 0x02, 0xF4, 0x3E, 0x03, 0xD0, 0x00, 0xB4,
-    0x03, 0xC0, 0x2E, 0x1F, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x7F, 0xFC, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x42, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x57, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x0F, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0x0F, 0x00, 0x03, 0xDF, 0x16, 0xBF,
-    0x80, 0x0B, 0x40, 0x03, 0xD7, 0x8B, 0xFE, 0x40, 0x07, 0xC0, 0x03, 0xD2, 0xD0, 0x50, 0x00, 0x03,
-    0xC0, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x02, 0xE0, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x07, 0xF8, 0x00, 0xAF, 0xC0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x02, 0x43, 0xFF, 0xF8,
-    0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4,
-    0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E,
-    0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9,
-    0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA,
-    0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01,
-    0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x07, 0x40, 0x00, 0x00, 0x02, 0xD0, 0xB4, 0x00, 0x00, 0x00,
-    0x1F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x03, 0x80, 0x00, 0x00,
-    0x03, 0xD7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x05, 0x50, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x56, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x0F, 0x80, 0x00, 0x80, 0x00, 0x2E, 0x00, 0x07, 0xD0, 0x00, 0xB4, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x6F, 0x00, 0x2F, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x01, 0xFC, 0x02, 0xF8, 0x00,
-    0x07, 0xC0, 0x7E, 0x00, 0x00, 0xB8, 0x0F, 0xC0, 0x00, 0x0B, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x03, 0xFC, 0x00, 0x02, 0xD0, 0x1F, 0xF9, 0x56, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0,
-    0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00,
-    0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60,
-    0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xE0,
-    0x00, 0x02, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00,
-    0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B,
-    0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x40, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0x41, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x02,
-    0xF4, 0x01, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xF6, 0xF4, 0x00, 0x2F, 0x02, 0xF0, 0x01, 0xE0,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xBF, 0xE4,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0xFC, 0x0F, 0xC0, 0x07, 0xF0, 0x7F, 0x00,
-    0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF8, 0x00,
-    0x7D, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xFF,
-    0xFF, 0xF8, 0x01, 0xF8, 0x3F, 0xFF, 0xFD, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8,
-    0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE7, 0xC0,
-    0x00, 0x00, 0x00, 0x3D, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xEF, 0x40, 0x03, 0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00,
-    0x3C, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03,
-    0xC0, 0x3E, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xBF, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
-    0x02, 0xD0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00,
-    0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43,
-    0x40, 0x00, 0x00, 0xFF, 0xDB, 0x80, 0x00, 0x01, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01, 0xFC,
-    0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x3F, 0x00, 0xBC, 0x0F, 0xC2, 0xF0,
-    0x03, 0xEB, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xC3, 0xE0, 0x2F,
-    0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55, 0x00, 0x10, 0x00, 0x00,
-    0x7F, 0xFF, 0x82, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xEE, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0xFC,
-    0x00, 0xBD, 0x00, 0x03, 0xE3, 0xF0, 0x03, 0xF0, 0x00, 0x3D, 0x0F, 0xC0, 0x1F, 0x80, 0x03, 0xD0,
-    0x3F, 0x00, 0xBD, 0x00, 0x3D, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x7D,
-    0x00, 0x1F, 0x80, 0x3F, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0xFD, 0x7C, 0x00, 0x03, 0xF0, 0x02, 0xFF,
-    0xC0, 0x00, 0x2F, 0x40, 0x07, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x3C, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x0F, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F, 0xFE,
-    0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xEB, 0xFF, 0x00, 0x00, 0xF4, 0x02,
-    0xF8, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x03,
-    0xE0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x07, 0xF0, 0x00, 0xBC, 0x06, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF9, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x3D,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x08, 0x00, 0x7C, 0x00,
-    0x00, 0xF4, 0xF8, 0x03, 0xD0, 0x00, 0x07, 0xC3, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07,
-    0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E,
-    0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE,
-    0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xEF,
-    0xC0, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x70, 0x00, 0x1F, 0xFD,
-    0xF0, 0x00, 0x2D, 0x3F, 0xE0, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x3F, 0x43,
-    0xF0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07,
-    0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE,
-    0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x0B, 0x43,
-    0xC0, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x0B, 0xDB, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x41, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x0B, 0xE0, 0x2F, 0xD0, 0x3D, 0x07, 0xE0, 0x03, 0xD0, 0x0F, 0x43,
-    0xE0, 0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x00, 0xF4, 0x0B, 0xD0, 0xF8, 0x00, 0xBC, 0x1F, 0xD0, 0x7D,
-    0x00, 0x3F, 0x7F, 0xC0, 0x2F, 0x00, 0x2F, 0xFE, 0x40, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0x03, 0xF0,
-    0x0F, 0xF8, 0x00, 0x00, 0xFC, 0x0B, 0x7F, 0x00, 0x1D, 0x2F, 0x9B, 0x8F, 0xE0, 0x6F, 0x07, 0xFF,
-    0xC1, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00,
-    0x40, 0x00, 0x01, 0x90, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0,
-    0x00, 0x1F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00,
-    0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x0B, 0xEF, 0xD0, 0x0F, 0x80, 0xF8, 0x0B, 0x80, 0x3E, 0x07, 0xC0, 0x1F, 0x43,
-    0xE0, 0x1F, 0x80, 0xF4, 0x2F, 0x80, 0x7D, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x1F, 0x81, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3E,
-    0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xEF, 0xD0, 0x0F, 0x80, 0xF8, 0x0B, 0x80, 0x3E, 0x07, 0xC0,
-    0x1F, 0x43, 0xE0, 0x1F, 0x80, 0xF4, 0x2F, 0x80, 0x7D, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x1F, 0x81, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x0B, 0xD0, 0xFC, 0x00, 0xFD, 0x1F,
-    0xC0, 0x0B, 0x40, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xD0,
-    0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40, 0x3F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0B, 0xD0, 0x07, 0xF0, 0x01,
-    0xF8, 0x00, 0x7D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xF4, 0x01, 0xF0, 0x02,
-    0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x2F, 0x00, 0x3E,
-    0x1C, 0x3E, 0xBC, 0x7F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x1C, 0x00, 0xFA, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x07, 0xFC, 0x00, 0x7D, 0xF4, 0x03, 0xD2, 0xF0, 0x3D, 0x03, 0xC1, 0xD0,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x1C, 0x00, 0xFA, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x3F, 0x03, 0xF1, 0xFC, 0x2F, 0x83, 0xC0, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xE1, 0xC0, 0x0F, 0xAF, 0x00, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x3F, 0x0F, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x40,
-    0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xF7, 0xC0, 0x07, 0xFF, 0xFF, 0x40, 0x7E, 0x01, 0xFD,
-    0x03, 0xE0, 0x02, 0xF8, 0x3F, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x3D, 0x3F,
-    0x00, 0x01, 0xF0, 0xFC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x01, 0xF0, 0x3F, 0x00,
-    0x0F, 0x80, 0xBE, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x70, 0x00, 0x1F, 0xFD, 0xF0, 0x00, 0x3D, 0x3F,
-    0xE0, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81,
-    0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03,
-    0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F,
-    0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC,
-    0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40,
-    0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD,
-    0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2E, 0xBC, 0x00,
-    0x0B, 0xC3, 0xD0, 0x01, 0xF0, 0x2E, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4,
-    0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC,
-    0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xC1,
-    0xC0, 0x01, 0xFF, 0xDF, 0x00, 0x0B, 0x4F, 0xF8, 0x00, 0x18, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F,
-    0x41, 0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xD0, 0x00,
-    0x7D, 0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xF4,
-    0x2F, 0x40, 0x1F, 0x80, 0x7F, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0xBE, 0x0B, 0xD0, 0x03, 0xF4, 0x3F, 0x40, 0x0B,
-    0x80, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x7F, 0x00, 0xFC, 0x00, 0xBD, 0x07, 0xD0, 0x01, 0xF8,
-    0x3F, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0x7D, 0x2F, 0x00, 0x02, 0xF0, 0xFC,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0xBD, 0x0B, 0xD0, 0x07, 0xE0, 0x1F, 0xC0, 0x7F, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD1, 0xD0, 0x00, 0x3F, 0xFF, 0xEF, 0x00, 0x03, 0xF4, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x40,
-    0x01, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0x3E, 0xF8, 0x00, 0x7D, 0x03, 0xD7, 0xD0, 0x02, 0xF0,
-    0x7C, 0x1F, 0x40, 0x0B, 0xC7, 0xC0, 0xBC, 0x00, 0x3F, 0xB8, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0x40, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02,
-    0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F,
-    0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF,
-    0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01,
-    0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB,
-    0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFB,
-    0xC0, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x2C, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01,
-    0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03,
-    0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F,
-    0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B,
-    0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x50, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x2F, 0x83,
-    0xF4, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01,
-    0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB,
-    0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF,
-    0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F,
-    0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00,
-    0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x7F, 0x40, 0x00, 0x3D, 0x2F, 0xFD, 0x00, 0x03, 0xCF, 0x9B, 0xE0, 0x00,
-    0x7E, 0xD0, 0x3F, 0x00, 0x0B, 0xF8, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xE0, 0x01, 0xF8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3D,
-    0x00, 0x1F, 0x40, 0x03, 0xC0, 0x03, 0xE0, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x00, 0xFB, 0xFF, 0x40, 0x00, 0x0F, 0x41, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x02,
-    0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x02, 0xF8,
-    0x3F, 0x40, 0x00, 0x1E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF,
-    0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0A,
-    0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80,
-    0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F,
-    0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x60, 0x00, 0x00, 0x07, 0xE0, 0x2D, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0,
-    0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00,
-    0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x24,
-    0x00, 0x1F, 0x40, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0,
-    0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0,
-    0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00,
-    0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00,
-    0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD,
-    0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8,
-    0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0,
-    0x1F, 0xC0, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xC0,
-    0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D, 0x01, 0xFF,
-    0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xD5, 0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0x34, 0x1F, 0xD1, 0xBC, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x40, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00,
-    0x00, 0xB0, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F,
-    0xC0, 0x00, 0x2D, 0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x3E, 0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xD5, 0xF0, 0x0B, 0xC0, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x1F, 0xD1, 0xBC, 0x03, 0xFF, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0,
-    0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D, 0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03, 0xF5, 0x7C, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0x34, 0x7F, 0x46, 0xF0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x90, 0x02, 0xD0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0xB0, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x2D,
-    0x01, 0xFF, 0x95, 0x6F, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0x57, 0xC0, 0x0B, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x34, 0x07, 0xF4, 0x6F, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x38,
-    0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xBD, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xBF, 0xFC, 0x00,
-    0x00, 0x7D, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40,
-    0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x01,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x7C, 0x00, 0x00, 0x1A, 0xFD, 0x2D, 0x00, 0x00,
-    0x00, 0x2F, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xF8, 0x2F, 0xE0, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x07,
-    0xD0, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x00, 0xFB, 0x87, 0x00, 0x0B, 0xE5, 0xF2, 0xE7, 0xC0, 0x01, 0xFF, 0xF4, 0xBF,
-    0xC0, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x00, 0x1F, 0x40,
-    0x1F, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xF8, 0x00,
-    0x02, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0xFF, 0xFF, 0xF8, 0x01, 0xF8, 0x3F, 0xFF, 0xFD, 0x00, 0x7E, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x1B, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x56, 0xF9,
-    0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x91, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFD,
-    0x7F, 0xE0, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x07,
-    0xF0, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x3E, 0xE1, 0xC0, 0xBE, 0x5F, 0x2E, 0x7C, 0x07,
-    0xFF, 0xD2, 0xFF, 0x00, 0x2F, 0xE0, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00,
-    0x0D, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x01, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06,
-    0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x5F, 0x80, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x2F, 0xFF, 0xF0,
-    0x06, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x02, 0xFB, 0xF4, 0x03, 0xE0, 0x3E, 0x02, 0xE0, 0x0F, 0x81, 0xF0, 0x07, 0xD0, 0xF8, 0x07, 0xE0,
-    0x3D, 0x0B, 0xE0, 0x1F, 0x7F, 0xD0, 0x0B, 0xFF, 0x40, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x0A, 0x07, 0xE0, 0x6F, 0x40, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x01, 0xC0, 0x00, 0x03, 0xE0, 0x2E, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E,
-    0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0C, 0x00, 0xBC, 0x07,
-    0xC0, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE0, 0x3E, 0x00, 0xB8, 0x03, 0xE0,
-    0x1F, 0x00, 0x7D, 0x03, 0xE0, 0x1F, 0x80, 0x3D, 0x0B, 0xE0, 0x07, 0xDF, 0xF4, 0x00, 0xBF, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x80, 0x7E, 0x06, 0xF4, 0x03,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x02,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x1F,
-    0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E,
-    0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x80,
-    0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x17, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E, 0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B,
-    0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28,
-    0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x24, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0,
-    0x01, 0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E,
-    0x01, 0xF0, 0x07, 0xD0, 0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40,
-    0x3F, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x00,
-    0xBD, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40,
-    0x3F, 0x40, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF, 0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC,
-    0x00, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00,
-    0x0F, 0x80, 0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0xBC,
-    0x0B, 0x40, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xEF, 0xFF, 0x40, 0x02, 0xF4, 0x0F, 0x50, 0x00, 0x0F,
-    0x40, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x3F,
-    0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x0B, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xF0,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x3F, 0xE5, 0x5F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x0A, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x03, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40, 0x3F, 0x40,
-    0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF, 0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC, 0x00, 0x00,
-    0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0x80,
-    0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xC0, 0x00, 0x02, 0xF0,
-    0x1F, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFB, 0xFF, 0xD0, 0x00, 0xBD, 0x03, 0xD4, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x3D,
-    0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xDB, 0xFD, 0x00,
-    0x07, 0xE0, 0x02, 0xFE, 0x00, 0x3E, 0x00, 0x01, 0xFC, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x07, 0xE0,
-    0x00, 0x1F, 0x80, 0x0F, 0xF9, 0x57, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xBE, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x03, 0xF9, 0x00, 0x6F, 0x40, 0x3F, 0x40, 0x00, 0x3C, 0x02, 0xF4, 0x00, 0x00, 0xF0,
-    0x1F, 0x80, 0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x05, 0x55, 0x4F, 0xC0, 0x00, 0xBF,
-    0xFE, 0x3F, 0x00, 0x00, 0x5B, 0xE0, 0xFC, 0x00, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x00, 0xBC, 0x0B,
-    0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0x80, 0x1F, 0xF8, 0x05, 0xBD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xFE, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x2F, 0x40, 0xF5, 0x00, 0x00, 0xF4, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x0F, 0xF6, 0xFF, 0x40, 0x01, 0xF8, 0x00, 0xBF, 0x80, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x7D, 0x00,
-    0x00, 0xBC, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x03, 0xFE, 0x55, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0F, 0xE4, 0x01, 0xBD, 0x00, 0xFD, 0x00, 0x00, 0xF0, 0x0B, 0xD0,
-    0x00, 0x03, 0xC0, 0x7E, 0x00, 0x00, 0x1D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x15, 0x55, 0x3F,
-    0x00, 0x02, 0xFF, 0xF8, 0xFC, 0x00, 0x01, 0x6F, 0x83, 0xF0, 0x00, 0x00, 0x7D, 0x0F, 0xD0, 0x00,
-    0x02, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x16, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xBF, 0xFD, 0x00, 0x0B, 0xD0, 0x3D, 0x40, 0x00, 0x3D,
-    0x00, 0xF8, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x03, 0xFD, 0xBF, 0xD0, 0x00, 0x7E, 0x00, 0x2F, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0xC0,
-    0x1F, 0x40, 0x00, 0x2F, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0x95, 0x7F, 0xC0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x2B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0x80, 0x1B, 0xFE, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x55, 0x55,
-    0x6F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xFF, 0xF0, 0x01, 0xBF, 0xF8,
-    0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x00, 0xA0, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xAF, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x7F, 0xF8, 0x00,
-    0x3C, 0x7E, 0x7F, 0x00, 0x1F, 0x3C, 0x0F, 0xC0, 0x0B, 0xBC, 0x03, 0xE0, 0x03, 0xFD, 0x00, 0xF4,
-    0x00, 0xFE, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x0F, 0xC0, 0x03,
-    0xD0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0xBC, 0x70, 0xBC, 0x00, 0x3F, 0xBC, 0x2F, 0x00,
-    0x0F, 0xFC, 0x0F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x6B, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x5B, 0xD5, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x06, 0xA0, 0x00, 0x3D, 0x0F, 0xFE, 0x00, 0x1F, 0x0F, 0xFF, 0xC0, 0x07, 0xCF,
-    0x43, 0xE0, 0x02, 0xEF, 0x40, 0xF8, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x3F, 0x80, 0x1F, 0x00, 0x1F,
-    0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x7C, 0x00,
-    0x7D, 0x00, 0x2F, 0x1C, 0x2F, 0x00, 0x0F, 0xEF, 0x0B, 0xC0, 0x03, 0xFF, 0x03, 0xE0, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0x00, 0x2F, 0xF9, 0xF0,
-    0x03, 0xDB, 0xFD, 0x00, 0x34, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xE0, 0xE0, 0xFF, 0xDB, 0x83,
-    0xCB, 0xFC, 0x0D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x87, 0x00, 0x3E, 0xBC,
-    0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x90, 0x03, 0xFF, 0xFE,
-    0x00, 0x1A, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x06, 0xFF, 0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x40,
-    0x0B, 0xFF, 0xF4, 0x00, 0x06, 0xAA, 0xA0, 0x3F, 0xFF, 0xE0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x70, 0x03, 0xEB, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0xC0, 0x03, 0xF0, 0x1F, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x30,
-    0xF8, 0x07, 0x82, 0xFF, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF0, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x87,
-    0x00, 0x3E, 0xBC, 0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xFC,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x1F, 0xFD, 0x00, 0x1F, 0x00,
-    0x0B, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x02,
-    0xF0, 0x00, 0xF8, 0x70, 0x3E, 0xBC, 0x1F, 0xFC, 0x03, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E,
-    0x00, 0x0B, 0x80, 0x02, 0xFE, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFE, 0x40, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x7F, 0xF4, 0x01, 0xF0, 0x02, 0xF0,
-    0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x2F, 0x00, 0x3E, 0x1C,
-    0x3E, 0xBC, 0x7F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x42, 0xFF, 0xFC, 0x00, 0x6F, 0xF9, 0x01, 0xBF, 0xE4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xC0, 0x00,
-    0xBF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0,
-    0x06, 0xFD, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x07, 0xC0,
-    0x03, 0xE0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x0F, 0x40, 0x0F, 0x80, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x03,
-    0xE1, 0xC0, 0x3D, 0x00, 0x3E, 0xBC, 0x07, 0xC0, 0x07, 0xFF, 0x00, 0xBC, 0x00, 0x3F, 0x80, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x80, 0xBC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xF5, 0xF8, 0x00, 0x00, 0x2F, 0x41, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07,
-    0x42, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x0B, 0x40,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x60, 0x3D, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xC0, 0x06, 0xFF, 0x90, 0x1F, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0A, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0xBF, 0x80, 0x2E, 0x3F,
-    0xFD, 0x03, 0xEF, 0x43, 0xD0, 0x3F, 0xC0, 0x3D, 0x07, 0xF0, 0x0B, 0xC0, 0xBC, 0x01, 0xF4, 0x0B,
-    0x81, 0xFD, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x2F, 0x0F, 0x80,
-    0x03, 0xE0, 0xBE, 0x00, 0x3D, 0x03, 0xFC, 0x07, 0xD0, 0x0F, 0xFE, 0xBC, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x2F, 0x8B, 0xFE, 0x03, 0xFF, 0x00, 0xF8, 0x3F, 0xB8, 0x03, 0xD3, 0xE0, 0x00, 0x0F, 0x2D,
-    0x00, 0x00, 0x7D, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3E, 0xF8, 0x00,
-    0x01, 0xF5, 0xF0, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x2F, 0x0B, 0xC0, 0x60, 0xF8, 0x0F, 0xDB, 0x83,
-    0xD0, 0x1F, 0xFC, 0x1F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xF9, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x03, 0xE0, 0x00,
-    0x2D, 0x01, 0xF4, 0x00, 0x0F, 0x00, 0xBD, 0x00, 0x5F, 0xC2, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0xF0, 0x0B, 0xFE, 0x07, 0xFE, 0x40, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F, 0xFD, 0x01, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07,
-    0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x00, 0x3D, 0x28, 0x07, 0xEF, 0x40, 0xBF, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F,
-    0xFD, 0x01, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x01, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x28, 0x07, 0xEF,
-    0x40, 0xBF, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xFF, 0xF4, 0xBC, 0x00, 0x6F, 0xF9, 0x0B,
-    0x40, 0x00, 0x7D, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x0D, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x00, 0xF8, 0x00, 0x0B, 0x40,
-    0x1F, 0x40, 0x00, 0xF0, 0x02, 0xF4, 0x01, 0x7F, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x03, 0xD0, 0x01, 0x40, 0xF0, 0x3F, 0xF4, 0x7C, 0x1A,
-    0xFD, 0x2D, 0x00, 0x2F, 0x0F, 0x00, 0x0F, 0xC3, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x4A, 0x00, 0x07, 0xEF, 0x40, 0x02, 0xFF, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x28, 0x00, 0x1F, 0x40, 0x0F, 0xD0,
-    0x02, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x34, 0x00,
-    0xF8, 0x00, 0x0B, 0x40, 0x1F, 0x40, 0x00, 0xF0, 0x02, 0xF4, 0x01, 0x7F, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xFD, 0x00, 0x1A, 0xFD, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x14, 0x07, 0xC0, 0xFD, 0x0B, 0xC0, 0xFD, 0x0F, 0xC0, 0xF8,
-    0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D,
-    0x28, 0x00, 0x7E, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x04, 0x00,
-    0x00, 0x1F, 0x5F, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0A, 0x6F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0D, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x7D, 0x00, 0x03, 0xC0, 0x2F, 0x40, 0x17, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x03, 0xFF, 0x40, 0x1A, 0xFD,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xFA, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xDF,
-    0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0xA0, 0x07,
-    0xEF, 0x40, 0x2F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xEF, 0x40, 0x03,
-    0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x3E, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4,
-    0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0,
-    0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF,
-    0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0,
-    0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00,
-    0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x7E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC7,
-    0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0x7F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4, 0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE,
-    0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0,
-    0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00,
-    0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xEF, 0x40, 0x03,
-    0xE0, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x3E,
-    0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x42, 0xF4, 0x0B, 0xC0, 0x00, 0x03, 0xC0, 0x3E, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xBC, 0x01, 0xF8, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x07, 0xEB, 0x80, 0x00, 0x03, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x01, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xBF, 0xE0, 0x00,
-    0xBF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x0E, 0x00, 0xF4, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x0B, 0x8F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1F, 0xE0, 0xBF, 0xF0, 0xBF, 0xF4, 0x03, 0xE2, 0xF6, 0xF4,
-    0x03, 0xDB, 0x81, 0xF4, 0x03, 0xEE, 0x01, 0xF0, 0x07, 0xFC, 0x02, 0xF0, 0x0B, 0xF0, 0x03, 0xE0,
-    0x0F, 0xE0, 0x03, 0xD0, 0x0F, 0xC0, 0x07, 0xC0, 0x1F, 0x80, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x0F, 0x4A, 0x3E, 0x00, 0x1F, 0xBE, 0x3D, 0x00, 0x1F, 0xF8, 0x7C, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xE0, 0x1F, 0xF0, 0xF4, 0x2F,
-    0xFC, 0x2F, 0xFD, 0x00, 0x00, 0x2E, 0x2F, 0x6F, 0x40, 0x00, 0x0F, 0xAE, 0x03, 0xD0, 0x00, 0x03,
-    0xEE, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0x80, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x2C, 0x00, 0x3E, 0x00, 0x1F, 0xBE, 0x00, 0x0F, 0x40,
-    0x07, 0xFE, 0x00, 0x07, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00,
-    0x2F, 0x2F, 0x40, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02,
-    0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F,
-    0x00, 0x3E, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0xC7, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0,
-    0x00, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x8B, 0xFF, 0x0B,
-    0xFF, 0x40, 0xF8, 0xBD, 0xBD, 0x03, 0xDB, 0x81, 0xF4, 0x0F, 0xB8, 0x07, 0xC0, 0x7F, 0xC0, 0x2F,
-    0x02, 0xFC, 0x00, 0xF8, 0x0F, 0xE0, 0x03, 0xD0, 0x3F, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0xBC, 0x07,
-    0xC0, 0x03, 0xE0, 0x2F, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0, 0x1F, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x80, 0xBC,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x90, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x3F, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x7E, 0x0F, 0xC0, 0x00,
-    0xF8, 0x7D, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x1F, 0x4B, 0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE0,
-    0xFC, 0x00, 0x2F, 0x42, 0xF4, 0x01, 0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-    0x80, 0x00, 0x00, 0xF8, 0x0B, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x90,
-    0x01, 0xF4, 0x0F, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x41,
-    0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x7D,
-    0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x02, 0xF4, 0x2F,
-    0x40, 0x1F, 0x80, 0x7F, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xC0, 0x00, 0x00, 0x7F,
-    0x02, 0xF4, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0xFE, 0x03,
-    0xF4, 0x00, 0x00, 0x24, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x3F,
-    0xC0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x01, 0xF8,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x28, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x1F, 0x40, 0x07, 0xE0, 0x3F, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0,
-    0xBC, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x2F, 0x40,
-    0xBD, 0x00, 0x7E, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x00, 0xF8, 0x00, 0x3D, 0x01,
-    0xFD, 0x00, 0x07, 0xD0, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x03, 0x80, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x50, 0x07, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x2F, 0x40,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x80,
-    0x7F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0x00, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x01, 0xFE, 0x00,
-    0x1F, 0x80, 0x17, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x1B, 0xF8, 0x00, 0xFF, 0xFF, 0x4B, 0xEF, 0xE0, 0x3F, 0x41, 0xFF, 0xE0, 0x3F, 0x0F,
-    0xC0, 0x0B, 0xF8, 0x03, 0xE1, 0xF4, 0x00, 0x7F, 0x00, 0x7D, 0x3F, 0x00, 0x03, 0xE0, 0x1F, 0xC7,
-    0xD0, 0x00, 0x7D, 0x0B, 0xE0, 0xBC, 0x00, 0x07, 0xDB, 0xF4, 0x0B, 0xC0, 0x00, 0xBF, 0xF4, 0x00,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7F, 0xC0, 0x02,
-    0x87, 0xF0, 0x1F, 0xFF, 0x06, 0xF4, 0x3F, 0xFF, 0xE3, 0xFF, 0xFD, 0x00, 0xBF, 0xF4, 0x0F, 0xFE,
-    0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0x7D, 0x02, 0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x07,
-    0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x0B, 0xC0,
-    0x02, 0xFC, 0x02, 0xFF, 0xF4, 0x02, 0xFD, 0x2F, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x1F, 0x8B, 0xFF, 0x1F, 0xF0, 0x0B, 0x8F, 0xF8, 0x03, 0xDB, 0x40, 0x00, 0xFB, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xAF, 0xF0, 0x00, 0x01, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x02, 0xF8, 0x00, 0x03,
-    0xF5, 0xBF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xF0, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xF4, 0x00,
-    0x07, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xF0, 0x0B, 0xFF, 0xD0, 0x0B, 0xF4, 0xBF, 0xFF,
-    0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x7E,
-    0x0B, 0xFF, 0x1F, 0xF0, 0x02, 0xE3, 0xFE, 0x00, 0x3D, 0xB4, 0x00, 0x03, 0xEE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x03, 0x80, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x2F, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0x7D, 0x02,
-    0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x01, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xBE, 0x00, 0x00, 0xFD,
-    0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xAF, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x01,
-    0xF4, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x02, 0xFF, 0xF4, 0x02, 0xFD, 0x2F, 0xFF, 0xE0,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x0B, 0x40, 0xBC, 0x00, 0xB8,
-    0x2F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xE0, 0xBF, 0xF1, 0xFF, 0x00, 0x2E, 0x3F,
-    0xE0, 0x03, 0xDB, 0x40, 0x00, 0x3E, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0xBF,
-    0xE0, 0x2F, 0x40, 0x0F, 0x40, 0xF8, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x90, 0x00, 0x3F, 0x07, 0x80, 0x00,
-    0xBC, 0x2F, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x82, 0xF8, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x81, 0xF0, 0x07,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x74, 0x01, 0xF0, 0x2F, 0x80, 0xF8, 0x07,
-    0xFF, 0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x0F, 0xC0, 0xB8, 0x00, 0xB8, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0xBF, 0xE0,
-    0x2F, 0x40, 0x0F, 0x40, 0xF8, 0x00, 0x3C, 0x07, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x02, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x90, 0x00, 0x3F, 0x07, 0x80, 0x00, 0xBC,
-    0x2F, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x82, 0xF8, 0x01, 0xFC, 0x07, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3E, 0xFC, 0x00, 0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x81, 0xF0, 0x07, 0xC0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x74, 0x01, 0xF0, 0x2F, 0x80, 0xF8, 0x07, 0xFF,
-    0xFC, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x0B, 0xFA, 0xFF, 0x80, 0xBD, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0xF0, 0x1F, 0x80, 0x03, 0xC0,
-    0x7E, 0x00, 0x08, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x02, 0x40, 0x00,
-    0xFC, 0x1E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x07, 0xF0,
-    0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFC, 0x03,
-    0xE0, 0x7C, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x74, 0x01, 0xF0, 0xBE, 0x03, 0xE0,
-    0x7F, 0xFF, 0xC0, 0x1F, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x01, 0x90, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x2D, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0xBF, 0xAF, 0xF8, 0x02, 0xF4, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0xF0, 0x07, 0xE0,
-    0x00, 0xF0, 0x07, 0xE0, 0x00, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x24, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x0F, 0x80, 0xBE, 0x00, 0x7F, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x7D, 0x00, 0x7C, 0x0F, 0x40, 0x03, 0xE3, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x3E, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x74, 0x01, 0xF0, 0x0B, 0xE0, 0x3E, 0x00, 0x7F,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03, 0xF0, 0x07,
-    0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x01, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x1D, 0x00, 0x00, 0xF4, 0x0B, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x7C, 0x02, 0xF0, 0x07, 0xC7,
-    0x80, 0x3F, 0x00, 0x78, 0xB4, 0x03, 0xE0, 0x07, 0x47, 0x00, 0x7D, 0x00, 0x60, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x02, 0x8B, 0x00,
-    0x02, 0xE3, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xBF, 0xFF, 0x43, 0xFF, 0xFF, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x40, 0x0F, 0x80, 0xB4,
-    0x03, 0xF5, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C,
-    0x78, 0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x5B, 0xE5,
-    0x50, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0x80, 0xB4, 0x0F, 0xD7, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0x80, 0x00, 0x00, 0x1F, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0,
-    0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0x80, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01,
-    0xF8, 0x00, 0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x34, 0x00, 0x0F, 0xFD, 0xF4, 0x00, 0x2E, 0x3F, 0xF0, 0x00, 0x1C, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00,
-    0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03,
-    0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F,
-    0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2,
-    0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0,
-    0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8,
-    0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0x90, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF, 0xE0, 0x03, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x7D, 0x00,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x02, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x02,
-    0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x18, 0x00, 0x0F,
-    0x40, 0xB4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x1D,
-    0x00, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00,
-    0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4,
-    0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x07, 0x42, 0xD0, 0x00, 0x0B, 0x42, 0xC0, 0x00,
-    0x07, 0xDB, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03,
-    0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F,
-    0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F,
-    0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0x40,
-    0x00, 0x02, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00,
-    0x00, 0x02, 0x40, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00,
-    0x7C, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0,
-    0x1B, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x1D, 0x00, 0x01, 0xF8, 0x3F,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x18, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80,
-    0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC,
-    0x0F, 0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0xBC,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x03,
-    0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xE0, 0x1B, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xF0, 0x00, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0x00, 0x0F,
-    0xFF, 0xD2, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0xBF, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xF8,
-    0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x1F, 0xF8, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x03, 0xEF, 0x80, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x7C, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x8F, 0xC0, 0x2E, 0x00, 0x00, 0x3F, 0x01,
-    0xF0, 0xBC, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x3E, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x2F, 0x03, 0xC0,
-    0x7C, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0xB8, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x7D,
-    0x3C, 0x00, 0x00, 0x01, 0xF2, 0xE0, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x3D, 0xF4,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x00,
-    0x3D, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x01, 0xD0, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x7F,
-    0xE0, 0x0B, 0xD0, 0x0B, 0xE0, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xE0,
-    0x0F, 0x40, 0x3F, 0x00, 0x3D, 0x00, 0xF8, 0x07, 0xF4, 0x07, 0xC0, 0x0F, 0xC0, 0xBF, 0x40, 0xF8,
-    0x00, 0xBC, 0x0F, 0xF8, 0x0F, 0x00, 0x07, 0xC1, 0xEB, 0x82, 0xE0, 0x00, 0x3C, 0x3C, 0x7C, 0x3C,
-    0x00, 0x03, 0xC7, 0x87, 0xCB, 0x80, 0x00, 0x3D, 0xF0, 0x3D, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xBD, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x07, 0x80, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F,
-    0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B,
-    0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xC0,
-    0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x02, 0xC0, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0,
-    0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4,
-    0x00, 0x1F, 0xC0, 0x1E, 0x00, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00,
-    0x2F, 0x03, 0xF8, 0x05, 0x57, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00,
-    0xBE, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5,
-    0xF4, 0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4, 0x00, 0x1F, 0xC0, 0x1E, 0x00,
-    0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x03, 0xF8, 0x05, 0x57,
-    0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA,
-    0xFF, 0xF8, 0x1D, 0x00, 0xBE, 0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x03, 0x07, 0xFF, 0xA5, 0xF4, 0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x02, 0x80, 0x07, 0x40, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xF4, 0x00,
-    0x1F, 0xC0, 0x1E, 0x00, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0x08, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x2F,
-    0x03, 0xF8, 0x05, 0x57, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x80, 0x3D, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE3,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x90, 0x3C, 0x0F, 0xFF, 0xD7, 0xD0, 0xFA, 0xFF, 0xF8, 0x1D, 0x00, 0xBE,
-    0x00, 0xC0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x03, 0x07, 0xFF, 0xA5, 0xF4,
-    0xFF, 0xFF, 0xFF, 0x4B, 0x46, 0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x0E, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x20, 0x0F, 0x80,
-    0x00, 0x00, 0xBE, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0x54, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0,
-    0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x1F, 0xFD, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x7D, 0x02,
-    0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x02, 0xF4,
-    0x02, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xAB, 0xFC, 0x03, 0xF4, 0xFC, 0x02, 0xFC, 0x1F, 0x43, 0xE0, 0x03, 0xF0, 0x2C, 0x1F,
-    0x40, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x07,
-    0xD0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x0B, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x06, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0x80, 0xE0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0xBF, 0x00, 0x00, 0xBC, 0x3F, 0xFC, 0x00, 0x0F, 0x8F, 0x5F, 0xC0, 0x00, 0xF7, 0xC0, 0xBD,
-    0x00, 0x1F, 0xB0, 0x07, 0xD0, 0x02, 0xFD, 0x00, 0x7D, 0x00, 0x2F, 0xC0, 0x07, 0xC0, 0x03, 0xF0,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x07, 0xC0, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x01, 0xFB, 0xFF,
-    0x00, 0x00, 0x2F, 0x01, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x06, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x10, 0x0F, 0xC0,
-    0xB4, 0x0F, 0xD7, 0xF0, 0x0F, 0xFF, 0xF0, 0x07, 0xFE, 0xE0, 0x00, 0x41, 0xD0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0x80, 0x0C, 0x0F, 0x40, 0x3F, 0xBE, 0x00, 0x3F, 0xF8, 0x00, 0x0A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F,
-    0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x01, 0xE0, 0xF4, 0x03, 0xE0, 0x07, 0x40, 0x40, 0x1F, 0x40, 0x18,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0x02,
-    0xE0, 0x38, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x01, 0x00, 0x03, 0xE0, 0x2D, 0x00, 0x0F, 0xD7,
-    0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78,
-    0x03, 0xF0, 0x07, 0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x01, 0xF0, 0x04, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xFF,
-    0x80, 0x0F, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x07,
-    0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x00,
-    0xBF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF0, 0x00, 0x7F, 0x82, 0xFF,
-    0xC0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x02,
-    0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0xBE, 0x00, 0x02, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xC0,
-    0x7A, 0xD1, 0xC0, 0x3F, 0x4B, 0xCF, 0xAE, 0x00, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xBE,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0xFC, 0x0B, 0xF0, 0x2F, 0x40, 0x7C, 0x01,
-    0xC0, 0x00, 0x00, 0x40, 0x2E, 0x07, 0xE0, 0xF8, 0x3E, 0x0B, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x80, 0x2F, 0xBC, 0x07, 0xC3, 0xE1, 0xF4, 0x1F, 0x2C, 0x00, 0x90, 0x01,
-    0x00, 0x01, 0xFD, 0x0D, 0x3F, 0xF7, 0xD7, 0x8F, 0xFC, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0x47, 0xFF, 0xFD, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x06, 0x3E, 0x02, 0xD3, 0xFF, 0xF8,
-    0x0F, 0xFD, 0x00, 0x05, 0x00, 0x2D, 0xBF, 0xFE, 0xB8, 0x08, 0x01, 0x87, 0xF0, 0x7E, 0xBE, 0x0F,
-    0xD7, 0x80, 0x78, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xBE, 0x3C, 0x2E, 0x24, 0x3D, 0x00, 0xF8, 0x07,
-    0xE0, 0x0B, 0x40, 0x07, 0x00, 0x07, 0xE0, 0x1F, 0xFC, 0x3C, 0x2D, 0x78, 0x2D, 0x78, 0x2D, 0x7D,
-    0xBC, 0x2F, 0xF0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x7E, 0x0F, 0xC3, 0xF0, 0xFD,
-    0x3F, 0x0B, 0xD1, 0xF0, 0x7D, 0x06, 0x00, 0xC0, 0x00, 0x10, 0x01, 0x0F, 0x00, 0xB8, 0xF4, 0x2E,
-    0x07, 0xCB, 0xC0, 0x3F, 0xF0, 0x01, 0xFC, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x47,
-    0xC3, 0xE0, 0xF8, 0xBC, 0x2F, 0x0F, 0x03, 0xC2, 0xD0, 0x70, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x7F, 0xF0, 0x2F, 0xFF, 0xC7, 0x80, 0xBC, 0x90, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x3D, 0x0F,
-    0x42, 0xF0, 0x3D, 0x07, 0xD0, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x00,
-    0xFC, 0x03, 0xE0, 0x0F, 0x00, 0xF8, 0x0B, 0x80, 0x14, 0x00, 0x00, 0x00, 0xBC, 0x2F, 0x83, 0xF0,
-    0x3D, 0x03, 0xD0, 0x2E, 0x00, 0xF0, 0x01, 0x00, 0x2C, 0x3E, 0x3D, 0x7C, 0xB8, 0xB0, 0xA0, 0x00,
-    0x00, 0x00, 0xBD, 0x0B, 0xD0, 0xFC, 0x2F, 0x03, 0xC0, 0x10, 0x00, 0x04, 0x7F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x7E, 0xBF, 0x0F, 0xE7, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F,
-    0xF4, 0x2C, 0x3C, 0x3C, 0x2C, 0x3C, 0x38, 0x1F, 0xF0, 0x06, 0x40, 0x01, 0x00, 0xFC, 0x0F, 0xC0,
-    0xF8, 0x1F, 0x03, 0xC0, 0x50, 0x00, 0x06, 0x41, 0xFE, 0x02, 0xF0, 0x3D, 0x0B, 0xC7, 0xE0, 0x64,
-    0x00, 0x01, 0x00, 0xE0, 0x3C, 0x07, 0x40, 0xF4, 0x0B, 0xF9, 0x3F, 0x80, 0x00, 0x05, 0x03, 0xD0,
-    0xF0, 0x7C, 0x2E, 0x0F, 0x82, 0x80, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xBE, 0x02, 0xF4,
-    0xBC, 0x2F, 0x00, 0xF4, 0x50, 0x00, 0x40, 0x00, 0x00, 0x03, 0x40, 0x08, 0xBC, 0x03, 0xC7, 0xFF,
-    0xF4, 0x2F, 0xFD, 0x00, 0x15, 0x00, 0x06, 0x80, 0x82, 0xFE, 0x1D, 0x7E, 0xFB, 0xD7, 0x4B, 0xF8,
-    0x10, 0x19, 0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xFC, 0x05, 0x55, 0x40, 0x00, 0x10, 0x00, 0x7F, 0xF0,
-    0x2F, 0xFF, 0xC7, 0x80, 0xBC, 0x90, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x07, 0xD0,
-    0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x64,
-    0x7F, 0x07, 0xF2, 0xFC, 0x2F, 0xC3, 0x80, 0x78, 0x00, 0x3D, 0x03, 0xC0, 0x7C, 0x07, 0xFC, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D,
-    0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F,
-    0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xEA, 0xFF, 0x40, 0x00, 0x7D, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x7D,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x02, 0xFA,
-    0xAF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xE5, 0x6F, 0xF0, 0x00, 0x7D, 0x00, 0x2F, 0x80,
-    0x0B, 0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x2C, 0x00, 0x03, 0xE0, 0x00, 0x50, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7A,
-    0xF0, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x1E, 0x0F, 0x40, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x0B,
-    0x80, 0xF8, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x01, 0xF0, 0x01, 0xF4, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0xBC,
-    0x1F, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x01, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x17, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0x40, 0x01, 0xFC, 0x01, 0xE0, 0x00, 0x3F,
-    0x00, 0x2D, 0x00, 0x0F, 0xC0, 0x00, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xB0, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x3F, 0x80, 0x55, 0x7E, 0x07,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0,
-    0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD5, 0x55, 0x5B, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x55, 0x50, 0xFC, 0xBD, 0x0B, 0xFF, 0xE0, 0xFC, 0xBD, 0x0F, 0xFF, 0xC0, 0xFC, 0xFC, 0x00, 0x00,
-    0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B,
-    0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-    0x06, 0xFF, 0x90, 0x1F, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xFD,
-    0x00, 0x0B, 0xFF, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00,
-    0x00, 0x3C, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x03, 0xE0, 0x00,
-    0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xBF, 0xA0, 0x00, 0x7F,
-    0xF8, 0x3F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x2F, 0xFE, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFB, 0xC0, 0x00, 0x01, 0xFB, 0xC0, 0x02, 0xEB,
-    0xC0, 0x00, 0x02, 0xE7, 0xD0, 0x07, 0xCB, 0xC0, 0x00, 0x03, 0xD3, 0xD0, 0x0F, 0x4F, 0xC0, 0x00,
-    0x07, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x80, 0x00, 0x0F, 0x42,
-    0xF0, 0x78, 0x0F, 0x80, 0x00, 0x0F, 0x02, 0xF0, 0xF0, 0x0F, 0x80, 0x00, 0x2F, 0x01, 0xF2, 0xE0,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0xF7, 0xC0, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0xFF, 0x40, 0x1F, 0x40,
-    0x00, 0x7C, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x00, 0xB8, 0x00, 0xBD, 0x00, 0x1F, 0x00, 0x00, 0xF4,
-    0x00, 0x78, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x1B, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFB, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x2F, 0x40,
-    0x0F, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0xBD, 0x02, 0xF0, 0x00, 0x00,
-    0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x7E, 0x0F,
-    0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC7, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0xFA, 0xE0, 0x00, 0x00, 0xF0,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x6F, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0x55, 0x55, 0x7E, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x03,
-    0xC0, 0x0A, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xD0,
-    0x1F, 0x00, 0x00, 0x0B, 0x40, 0xB8, 0x00, 0x00, 0x3D, 0x03, 0xF9, 0x55, 0x5A, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00,
-    0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00,
-    0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0xBF, 0xFF,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFA,
-    0xFF, 0x80, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x02, 0xF0, 0x02,
-    0xF4, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x02, 0xE0, 0x00, 0x3F, 0x00, 0x07, 0x40,
-    0x00, 0x7E, 0x00, 0x18, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x01, 0xC0, 0x03,
-    0xF0, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x03, 0xF9, 0x55, 0x6B, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC0, 0x2F, 0x00, 0x7C, 0x78, 0x03,
-    0xF0, 0x07, 0x8B, 0x40, 0x3E, 0x00, 0x74, 0x70, 0x07, 0xD0, 0x06, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40,
-    0x2F, 0xC0, 0x00, 0x0F, 0xC7, 0xFF, 0x40, 0x00, 0xFF, 0x05, 0xBE, 0x00, 0x0F, 0xF0, 0x01, 0xFC,
-    0x00, 0xBF, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0x81, 0xF4,
-    0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00,
-    0x03, 0xEE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xEB, 0xFA, 0xFF, 0x00, 0x3F,
-    0x80, 0xF8, 0x0B, 0xE0, 0x2F, 0x40, 0x3D, 0x00, 0xFC, 0x1F, 0x80, 0x1F, 0x40, 0x2F, 0x0B, 0xC0,
-    0x07, 0xC0, 0x0B, 0xC3, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x3F, 0x00,
-    0x3D, 0x00, 0x3E, 0x0F, 0xC0, 0x1F, 0x00, 0x3F, 0x02, 0xF8, 0x07, 0xC0, 0x3F, 0x40, 0x3F, 0xD2,
-    0xF1, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xBF, 0x94, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFE, 0x40, 0x6F, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0x4B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1B, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF,
-    0xC0, 0x10, 0x00, 0x00, 0x00, 0x01, 0x4B, 0xC0, 0x7F, 0xFF, 0x40, 0xFC, 0x7D, 0x06, 0xFF, 0x90,
-    0x2F, 0x47, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x7D, 0x00, 0xBC, 0x00, 0xBD, 0x07, 0xD0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x80, 0x2F, 0x00, 0x7C, 0x01, 0xF4,
-    0x03, 0xF0, 0x07, 0xC0, 0x2F, 0x00, 0x7D, 0x00, 0x7D, 0x03, 0xF0, 0x0F, 0xC0, 0x03, 0xF0, 0x3E,
-    0x02, 0xF4, 0x00, 0x2F, 0xC3, 0xE1, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x7E, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80,
-    0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x7D,
-    0x00, 0x1C, 0x0F, 0x40, 0x07, 0xD0, 0xE0, 0xF0, 0x1F, 0x00, 0xBD, 0x07, 0x83, 0xD4, 0x2E, 0x0B,
-    0xD0, 0x7D, 0x0F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0x00, 0x0F, 0xFF, 0x87, 0xE0, 0x0F, 0xD6, 0xF2, 0xF0, 0x0F,
-    0xC0, 0x3D, 0xF8, 0x07, 0xC0, 0x07, 0xFC, 0x03, 0xE0, 0x00, 0xFD, 0x00, 0xF4, 0x00, 0x3F, 0x00,
-    0x7C, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x07, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xFC,
-    0x00, 0xBC, 0x03, 0xFF, 0x00, 0x2F, 0xDB, 0xF2, 0xF6, 0xC3, 0xFF, 0xF0, 0xBF, 0xE0, 0x7F, 0xE0,
-    0x0F, 0xE0, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x7F, 0xBF, 0x40, 0x03, 0xE0, 0x3E, 0x00, 0x2E, 0x00, 0xF8, 0x00, 0xF0, 0x03, 0xD0, 0x0B, 0xC0,
-    0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xF4, 0x0B, 0xC0, 0x03, 0xC0, 0xBC, 0x00, 0x1F, 0x0B, 0xE0,
-    0x00, 0xBC, 0x7F, 0xE0, 0x03, 0xE0, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0xC0, 0x3D, 0x00, 0x2F, 0x01,
-    0xF0, 0x00, 0x7C, 0x07, 0xC0, 0x01, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x3E, 0x03, 0xD0,
-    0x02, 0xF0, 0x0F, 0x80, 0x1F, 0x40, 0x7F, 0xFF, 0xF4, 0x02, 0xFB, 0xFE, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x87,
-    0xFF, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF4, 0x02, 0xF0, 0x03, 0xE0, 0x0B, 0x80, 0x0F,
-    0x80, 0x3D, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x01, 0xF0, 0x7C, 0x00, 0x07, 0xC3,
-    0xD0, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3D, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xBE, 0xBF, 0x40, 0x07, 0xC0, 0x3F, 0x00, 0x2E,
-    0x00, 0x38, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0xF8, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40,
-    0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xFC, 0x1F, 0x40, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x3E, 0x0F, 0xC0, 0x01, 0xF4, 0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xBC, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x01,
-    0xFF, 0xFF, 0x07, 0xE0, 0x1E, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xFB,
-    0x80, 0x07, 0xFF, 0x80, 0x1F, 0x95, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x04,
-    0xBF, 0x40, 0x7C, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0x90, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x03,
-    0xD0, 0x00, 0x07, 0xC0, 0x1E, 0x07, 0xE0, 0x7F, 0x03, 0xFE, 0xFE, 0x00, 0x6F, 0xE4, 0x00, 0x1E,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00,
-    0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x6F, 0xC0,
-    0x03, 0xFE, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x02, 0xFC, 0xBF, 0xF0, 0xFF,
-    0xE0, 0x3E, 0x3E, 0x7F, 0x03, 0xDB, 0x03, 0xF0, 0x3E, 0xC0, 0x3E, 0x07, 0xF4, 0x03, 0xE0, 0xBF,
-    0x00, 0x3D, 0x0F, 0xD0, 0x03, 0xC0, 0xFC, 0x00, 0x7C, 0x1F, 0x40, 0x0B, 0xC1, 0xF0, 0x00, 0xF8,
-    0x2F, 0x00, 0x0F, 0x43, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x1F, 0x07, 0xC0, 0x02, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x1F, 0xEB, 0xF0, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBC, 0x03,
-    0xD0, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x7C, 0x1F,
-    0x55, 0x55, 0xBC, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xA9, 0xFC, 0x3E, 0x00, 0x00, 0xF8, 0x3E,
-    0x00, 0x01, 0xF4, 0x3E, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x07, 0xC0, 0x3F,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x7D, 0x02, 0xF0, 0x0B, 0xC0,
-    0x3E, 0x00, 0xF4, 0x07, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x0F, 0x40, 0x7C, 0x02, 0xF1, 0xDB,
-    0xFF, 0x1F, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xFC, 0xBF, 0xE0, 0x0B,
-    0xFC, 0x03, 0xE0, 0x2F, 0xD4, 0x03, 0xD0, 0xBD, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x07, 0xC7, 0xE0,
-    0x00, 0x0B, 0x8F, 0xD0, 0x00, 0x0F, 0x6F, 0xC0, 0x00, 0x0F, 0x7A, 0xC0, 0x00, 0x1F, 0xF2, 0xC0,
-    0x00, 0x2F, 0xD3, 0xD0, 0x00, 0x3F, 0x82, 0xE0, 0x00, 0x3F, 0x02, 0xF5, 0xB0, 0x3D, 0x00, 0xFF,
-    0xE0, 0x7C, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xEF, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0xFC, 0x0F,
-    0x40, 0x02, 0xF0, 0x0F, 0x40, 0x0B, 0xE0, 0x0F, 0x80, 0x1F, 0xC0, 0x0F, 0xDB, 0x7F, 0x00, 0x0B,
-    0xFD, 0xBD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0xBA, 0xE6, 0xC0, 0xBF, 0xFF, 0xC7, 0xFE,
-    0x02, 0xDF, 0xF8, 0x0F, 0xD0, 0x0F, 0x01, 0x00, 0x04, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x1F, 0x87, 0xFE, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xF0, 0x07, 0xD0,
-    0x0B, 0xC0, 0x0F, 0x80, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xB8, 0x0F, 0x80, 0x02, 0xF0, 0x7C,
-    0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x07, 0xE1, 0xBF, 0x01, 0xFF, 0xFE, 0x00, 0x7D, 0x54, 0x01, 0xF0, 0x00,
-    0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x7F, 0xE0, 0x01, 0xFF, 0xD0, 0x0B, 0xE4, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x6F, 0xC0, 0x03,
-    0xFE, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40,
-    0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xC1, 0xF4, 0x00, 0xBD, 0x3F, 0x00, 0x07, 0xD7, 0xD0, 0x00,
-    0x7D, 0xBC, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0xFC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF0, 0xBC,
-    0x00, 0x7D, 0x07, 0xF0, 0x2F, 0x80, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFE,
-    0xFA, 0xBE, 0x90, 0x0C, 0x0F, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x00, 0x2D, 0x0B, 0x40,
-    0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0xBC, 0x03, 0xF6, 0xD0,
-    0x1F, 0x40, 0x3F, 0xFC, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x3D,
-    0x00, 0x7E, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x3F, 0x01, 0xF0,
-    0x00, 0x3E, 0x02, 0xF0, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0xF8, 0x03, 0xD0,
-    0x03, 0xF0, 0x07, 0xF4, 0x0B, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x0B, 0xBF, 0xF8, 0x00, 0x0F, 0x41,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0xFF, 0xC1, 0xF9, 0x6E, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x2F,
-    0xD0, 0x07, 0xFC, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x0F, 0xE5, 0xBD, 0x90, 0x0F, 0xD0, 0x0F, 0x40, 0x07, 0xD0, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x1F, 0x80,
-    0x7E, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xC7, 0xEA, 0xFA, 0xA4, 0xA0, 0x2E,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x10, 0x00, 0x2F, 0x5F,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xC0, 0x2F, 0x03, 0xFF, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0xFC, 0x03, 0xE0, 0x03, 0xF0, 0x0F,
-    0x40, 0x0F, 0xC0, 0xBC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xD0, 0x7D, 0x00,
-    0x1F, 0x02, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x07, 0xD0, 0x2F, 0x40, 0x3E, 0x00, 0x7F, 0x07, 0xF0,
-    0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0xF8, 0x00, 0x1F, 0x40, 0xBF, 0xFC, 0x01, 0xF4, 0x07, 0xC1, 0xF8, 0x0F,
-    0x80, 0x3D, 0x02, 0xF0, 0xBC, 0x00, 0xF0, 0x07, 0xC3, 0xE0, 0x0B, 0x80, 0x1F, 0x0F, 0x40, 0x3E,
-    0x00, 0x7C, 0x7C, 0x00, 0xF4, 0x02, 0xF1, 0xF0, 0x03, 0xC0, 0x0F, 0x87, 0xD0, 0x1F, 0x00, 0x7C,
-    0x1F, 0x80, 0xB8, 0x03, 0xD0, 0x3F, 0x03, 0xD0, 0x3E, 0x00, 0x7F, 0x4F, 0x4B, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0xBC, 0x02, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0xBC,
-    0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0x2F, 0x78, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0x7C, 0x00, 0x00, 0x02, 0xE3,
-    0xD0, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00,
-    0x7C, 0x01, 0xF4, 0x10, 0x0F, 0x80, 0x0F, 0xEF, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x28, 0x00, 0x03,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x1B, 0xF0, 0x07, 0xC1, 0xF4, 0x3F, 0xF4, 0x0B, 0xC0, 0xFC, 0x02, 0xF0, 0x0F, 0x80, 0xBC, 0x03,
-    0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x0B, 0xC0,
-    0x2E, 0x00, 0xBC, 0x0F, 0x80, 0x3D, 0x00, 0xBC, 0x0F, 0x80, 0x3D, 0x00, 0xF8, 0x0F, 0x40, 0x7C,
-    0x01, 0xF0, 0x0F, 0x80, 0xBC, 0x03, 0xE0, 0x0F, 0xC0, 0xF8, 0x0F, 0xC0, 0x07, 0xF4, 0xF4, 0xBF,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00,
-    0xBC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0xF4, 0x03, 0xD2, 0xF0, 0x0B, 0xC0, 0x0F, 0x4F,
-    0x80, 0x2F, 0x00, 0x3D, 0x7C, 0x00, 0xF4, 0x00, 0xF6, 0xF0, 0x03, 0xC0, 0x07, 0xCB, 0xC0, 0x0F,
-    0x00, 0x2F, 0x3F, 0x00, 0x7C, 0x00, 0xF8, 0xBC, 0x03, 0xF0, 0x07, 0xC2, 0xF8, 0x3E, 0xE0, 0x7D,
-    0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA,
-    0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07,
-    0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E,
-    0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x41, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F,
-    0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B,
-    0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x07, 0x83, 0xD0, 0x00, 0x03, 0x43, 0xC0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8,
-    0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0,
-    0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x83, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF0, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xB8, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x4B, 0x40, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x2F, 0x82, 0xFE, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x7C,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0xFC, 0x03, 0xEE, 0x1C,
-    0x0B, 0xE5, 0xF2, 0xE7, 0xC0, 0x7F, 0xFD, 0x2F, 0xF0, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x34, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x00, 0x07, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x64, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00,
-    0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xDF, 0xC0, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xB8, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0,
-    0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00,
-    0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03,
-    0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x29, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x19, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0,
-    0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xAA, 0xAA,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00,
-    0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x6F, 0xE4, 0x00, 0x1B, 0xFF, 0x47, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x06, 0xD1, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0xBC, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD2, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xBE, 0x0B, 0xF8,
-    0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0F,
-    0x80, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07,
-    0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0x02, 0xF9, 0x7C, 0xB9, 0xF0,
-    0x07, 0xFF, 0xD2, 0xFF, 0x00, 0x0B, 0xF8, 0x07, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xAE, 0x00,
-    0x00, 0x00, 0x2C, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xF4,
-    0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF,
-    0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0,
-    0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF,
-    0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xE0, 0x14, 0x00, 0x0B,
-    0xFD, 0x3C, 0x00, 0x0F, 0x6F, 0xF8, 0x00, 0x0D, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x68, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0xB8,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF,
-    0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00,
-    0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD,
-    0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC0,
-    0x00, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0,
-    0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0,
-    0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA,
-    0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x0B, 0xC3, 0xD0, 0x00,
-    0x2F, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F,
-    0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE,
-    0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x50, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x2C, 0x00, 0x70, 0x00, 0x3E,
-    0x02, 0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8,
-    0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0,
-    0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x74, 0x20, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00,
-    0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x2C, 0x00, 0x70, 0x00, 0x3E, 0x02,
-    0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F,
-    0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F,
-    0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0x85, 0x14, 0x00, 0x00, 0x00, 0x3E, 0x5B,
-    0x40, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x02,
-    0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x01, 0xC2, 0xD0,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x28, 0x00, 0x20,
-    0x00, 0x3D, 0x01, 0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0,
-    0x02, 0xF8, 0x2F, 0xE0, 0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0,
-    0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0,
-    0x2F, 0xE0, 0x1F, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xBD, 0x00, 0x00, 0x00, 0x74, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE5, 0x57, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xAA, 0xAA,
-    0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xBF, 0x90, 0x00, 0x6F, 0xFD, 0x7F, 0xFF, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xE0, 0x30, 0x00, 0x0F, 0xFC, 0xB4, 0x00, 0x2E, 0x3F, 0xF0, 0x00,
-    0x1C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x00, 0x3D, 0x01, 0xE0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0, 0x07,
-    0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80, 0x7D,
-    0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFC,
-    0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x60, 0x00, 0x00,
-    0x07, 0xE0, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2E, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x55, 0x7F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFA, 0xAA, 0xAF, 0x80, 0x00, 0x3E, 0x00, 0x01,
-    0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xD0, 0x1B, 0xF9, 0x00, 0x06, 0xFF, 0xD7, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x24, 0x00, 0x1F, 0x40, 0xF0,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0xB4, 0x00, 0xBF, 0xFF, 0xF0, 0x02, 0xF8, 0x2F, 0xE0,
-    0x07, 0xD0, 0x07, 0xD0, 0x0F, 0x80, 0x07, 0xC0, 0x2F, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x0F, 0x80,
-    0x7D, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-    0xFC, 0x03, 0xEE, 0x1C, 0xBE, 0x5F, 0x2E, 0x7C, 0x7F, 0xFD, 0x2F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x7C, 0x00,
-    0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x00,
-    0x7C, 0x00, 0x2F, 0x40, 0x17, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0xFD, 0x03, 0xE0, 0x3E, 0x0B, 0x80, 0x3E,
-    0x1F, 0x00, 0x7D, 0x3E, 0x01, 0xF8, 0x3D, 0x0B, 0xE0, 0x7D, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x7E, 0x06, 0xF4, 0x3F, 0xFF, 0xD0, 0x1F, 0xFE,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00, 0x01, 0x0F, 0x40, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xD0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x01, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06, 0x00, 0x03, 0xE0, 0x00,
-    0x3C, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00, 0xBD, 0x00, 0x5F, 0x80, 0x2F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xF0, 0x00,
-    0x78, 0x3C, 0x00, 0x1C, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xBE, 0xFD, 0x00,
-    0xF8, 0x0F, 0x80, 0xB8, 0x03, 0xE0, 0x7C, 0x01, 0xF4, 0x3E, 0x01, 0xF8, 0x0F, 0x42, 0xF8, 0x07,
-    0xDF, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x81,
-    0xF8, 0x1B, 0xD0, 0x3F, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0x80, 0x00, 0x03, 0xFF, 0x6E, 0x00, 0x00, 0x1F, 0x3F, 0xF0,
-    0x00, 0x00, 0x30, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00,
-    0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01,
-    0xF4, 0x00, 0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x2C, 0x00, 0xBF, 0xE7, 0xC0, 0x0F, 0x1F, 0xF8,
-    0x00, 0xA0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE0, 0x3E, 0x00, 0xB8, 0x03, 0xE0, 0x1F, 0x00, 0x7D, 0x03,
-    0xE0, 0x1F, 0x80, 0x3D, 0x0B, 0xE0, 0x07, 0xDF, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x80, 0x7E, 0x06, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0x02, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x40, 0x01, 0xF0, 0x00,
-    0x02, 0xF4, 0x01, 0x7E, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xEF, 0xD0,
-    0x00, 0x0F, 0x80, 0xF8, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0x07, 0xC0, 0x1F, 0x40, 0x03, 0xE0, 0x1F,
-    0x80, 0x00, 0xF4, 0x2F, 0x80, 0x00, 0x7D, 0xFF, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x00, 0x1F, 0x81, 0xBD, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x90, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xF3, 0xE0, 0x00, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0,
-    0x00, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x7D, 0x00,
-    0x07, 0xC0, 0x02, 0xF4, 0x01, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xF4, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x7F,
-    0x00, 0x0F, 0xC0, 0xF4, 0x02, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xBE, 0xFD, 0x00, 0x3E, 0x03, 0xE0, 0x0B, 0x80, 0x3E, 0x01, 0xF0, 0x07, 0xD0,
-    0x3E, 0x01, 0xF8, 0x03, 0xD0, 0xBE, 0x00, 0x7D, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x07, 0xE0, 0x6F, 0x40, 0x3F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x06, 0x83, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x14, 0x00, 0x00, 0x00,
-    0xBD, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0x02, 0x40, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x7D, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x40, 0x01, 0xF0,
-    0x00, 0x02, 0xF4, 0x01, 0x7E, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xC7, 0xC0,
-    0x00, 0x00, 0x10, 0x78, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xB0,
-    0xA0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x02,
-    0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0x01, 0xF0,
-    0x07, 0xD0, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x03, 0xD0, 0xBE, 0x00, 0x00, 0x7D, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x28, 0x00, 0x07, 0xE0, 0x6F, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x82, 0x80, 0x00,
-    0x00, 0xFF, 0xEF, 0x00, 0x00, 0x07, 0x0B, 0xF4, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0x80,
-    0x00, 0x01, 0x90, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x6F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00,
-    0x34, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x04, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x18,
-    0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x01, 0x7E, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x80, 0x03, 0xFF, 0x1E,
-    0x00, 0x7D, 0xFF, 0xD0, 0x03, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0xF8, 0x1F, 0x00, 0x3D, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xEF, 0xD0, 0x03, 0xE0, 0x3E, 0x00, 0xB8, 0x03,
-    0xE0, 0x1F, 0x00, 0x7D, 0x03, 0xE0, 0x1F, 0x80, 0x3D, 0x0B, 0xE0, 0x07, 0xDF, 0xF4, 0x00, 0xBF,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0x80, 0x7E, 0x06, 0xF4,
-    0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00,
-    0x3F, 0x02, 0xE0, 0x00, 0x02, 0xE0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00,
-    0x02, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x01, 0xF4, 0x00,
-    0x1F, 0x00, 0x0B, 0xD0, 0x05, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3E, 0xFC, 0x00,
-    0x3E, 0x1F, 0x00, 0x2F, 0x02, 0xD0, 0x0E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x0B, 0xEF, 0xD0, 0x0F, 0x80, 0xF8, 0x0B, 0x80, 0x3E, 0x07, 0xC0, 0x1F, 0x43,
-    0xE0, 0x1F, 0x80, 0xF4, 0x2F, 0x80, 0x7D, 0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x28, 0x1F, 0x81, 0xBD, 0x03, 0xFF, 0xFD, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x07,
-    0xEF, 0xC0, 0x00, 0xB4, 0x3C, 0x00, 0x01, 0x0B, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x06, 0xFF,
-    0x90, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFB, 0xF0, 0x3D, 0x1F, 0x01, 0x82, 0xE0, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0x07, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x7F, 0xF4,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3E, 0x1C, 0x03, 0xEB, 0xC0, 0x7F, 0xF0, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8,
-    0x70, 0x0F, 0xAF, 0x01, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8,
-    0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4,
-    0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00,
-    0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD,
-    0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0,
-    0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3C, 0x3D,
-    0x00, 0x02, 0x43, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40,
-    0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B, 0xD1, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0xBC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD,
-    0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xBC, 0x34,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00,
-    0x00, 0x00, 0x64, 0x01, 0x40, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40,
-    0x1F, 0x80, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x2F,
-    0x40, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xFD,
-    0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xDF,
-    0xC0, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x41, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x07, 0xD0,
-    0x00, 0x7D, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0x80,
-    0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x01, 0x90, 0x05, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40,
-    0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00,
-    0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0xD0, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0xFD,
-    0x0F, 0x80, 0x0B, 0xC0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFD, 0x07, 0xF0, 0x0F, 0xC0, 0x0B, 0xD0, 0x7D, 0x00, 0x1F, 0x83,
-    0xF0, 0x00, 0x3E, 0x1F, 0x40, 0x01, 0xF4, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0xF8, 0x3F, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x7E, 0x01, 0xFC, 0x07, 0xF0, 0x03, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x39, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x68, 0x38, 0x00, 0x00, 0x00, 0xBF, 0x84, 0x00, 0x00, 0x00,
-    0xFD, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x24, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xD0,
-    0x03, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x02,
-    0xF4, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x07, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x00,
-    0x00, 0x00, 0x14, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x06,
-    0xD1, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0xBC, 0x0F, 0x80,
-    0x00, 0x07, 0x80, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0xBC, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00,
-    0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x82, 0x80, 0x00, 0x00, 0x7F, 0xFB, 0x80, 0x00, 0x00, 0x70, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x02, 0x90, 0x08, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F,
-    0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00,
-    0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x14, 0x00,
-    0x2F, 0xF4, 0xF0, 0x00, 0xF6, 0xFF, 0x80, 0x03, 0x41, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x3F, 0x03, 0xD0, 0x02, 0xE0, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x3F, 0x41, 0xFC, 0x03, 0xF0, 0x02, 0xF4, 0x1F, 0x40, 0x07, 0xE0, 0xFC, 0x00, 0x0F, 0x87, 0xD0,
-    0x00, 0x7D, 0x2F, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x0F, 0xC0, 0x02,
-    0xF4, 0x2F, 0x40, 0x1F, 0x80, 0x7F, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x02, 0xD0,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x07, 0xE0, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2E,
-    0xBC, 0x00, 0x0B, 0xC3, 0xD0, 0x01, 0xF0, 0x2E, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x41, 0xFC, 0x0F, 0xC0, 0x0B,
-    0xD1, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xDB, 0xC0,
-    0x00, 0xBC, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x02, 0xF4, 0xBD, 0x00, 0x7E, 0x07, 0xF0, 0x1F, 0xC0,
-    0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xA0, 0x00, 0x01, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x54, 0x02, 0xF4, 0x00, 0x02,
-    0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xFF,
-    0x7F, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xD0,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x07, 0xD0, 0x2F,
-    0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x7E, 0x00,
-    0x1F, 0xC0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xA0, 0x00,
-    0x00, 0x05, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x54, 0x02, 0xF4,
-    0x00, 0x02, 0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x07, 0xFF, 0x7F, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0,
-    0x07, 0xD0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x07,
-    0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0xBC, 0x00,
-    0x7E, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x1A, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x15, 0x40, 0x2F, 0x40, 0x00, 0x2F,
-    0xFF, 0xE1, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00,
-    0x00, 0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xF8, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x0C, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x40, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0xF7, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFD,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x03, 0xE0, 0x1F,
-    0x40, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x38, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xE0, 0x00, 0x00, 0x01, 0xF2, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0x43, 0xF4, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0x54, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0,
-    0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xB0, 0x00, 0x0B, 0xFE, 0x7C, 0x00, 0x03, 0xC7,
-    0xFE, 0x00, 0x00, 0xA0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFD, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x7D,
-    0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x02,
-    0xF4, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x54, 0x02, 0xF4, 0x00, 0x02,
-    0xFF, 0xFE, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xFC, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFD, 0xFC, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B,
-    0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x02, 0xF4, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x01,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00,
-    0xBC, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00,
-    0x1F, 0x40, 0x00, 0x0B, 0x80, 0x02, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40,
-    0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x1B, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02,
-    0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B,
-    0xC0, 0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F,
-    0x00, 0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F,
-    0xF8, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00,
-    0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xC2, 0xFF, 0xE0, 0x00, 0xBF,
-    0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0x7C, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x40, 0x00,
-    0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x40,
-    0x01, 0xF8, 0x00, 0x02, 0xFE, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x02, 0x43, 0xD0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0xF8, 0x02, 0xF0,
-    0x01, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x0F, 0xC0, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x2F, 0x80, 0x2F, 0x00,
-    0x7F, 0x80, 0x2F, 0x01, 0xEB, 0x47, 0x3F, 0x4B, 0xCF, 0xAE, 0x2F, 0xFF, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0xB0, 0x00, 0x00, 0x50, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0,
-    0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xC0, 0x01, 0xFE, 0x0B, 0xFF, 0x00, 0x0F,
-    0xC0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3D, 0x00,
-    0x3F, 0x00, 0x01, 0xF0, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0xE0, 0x00, 0x2F, 0x01, 0xEB, 0x47,
-    0x00, 0xFD, 0x2F, 0x3E, 0xB8, 0x02, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0xFE, 0x02, 0xF8, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0xB0, 0x00, 0x00, 0x01, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x40,
-    0x01, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xC0, 0x01, 0xFE, 0x0B, 0xFF, 0x00, 0x0F, 0xC0, 0x00,
-    0xBC, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3D, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x3F, 0x00,
-    0x01, 0xF0, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0xE0, 0x00, 0x2F, 0x01, 0xEB, 0x47, 0x00, 0xFD,
-    0x2F, 0x3E, 0xB8, 0x02, 0xFF, 0xF0, 0xFF, 0xC0, 0x03, 0xFE, 0x02, 0xF8, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFB, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFF, 0xF8, 0x00, 0xFF,
-    0xF8, 0x0B, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0x07, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07,
-    0xD0, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xF8, 0x06,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xBD, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x02, 0x43, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xFC, 0x00, 0x1F, 0xE0, 0xBF, 0xF0,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x03,
-    0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x2F, 0x80, 0x00, 0xBC, 0x01, 0xFE, 0x00, 0x02, 0xF0, 0x1E,
-    0xB4, 0x70, 0x0F, 0xD2, 0xF3, 0xEB, 0x80, 0x2F, 0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0x80,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0D,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xC0,
-    0xFD, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0,
-    0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xD0, 0x00, 0x00, 0xFF, 0xDF, 0x40, 0x00, 0x0B, 0x8F, 0xFC, 0x00,
-    0x00, 0x1C, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0xF0, 0x00, 0x7F, 0x82, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x1F,
-    0x40, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00,
-    0xBC, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x7C, 0x00,
-    0xBE, 0x00, 0x02, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xC0, 0x7A, 0xD1, 0xC0, 0x3F, 0x4B, 0xCF, 0xAE,
-    0x00, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x6F, 0x80, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF0, 0x00, 0x7F, 0x82, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F,
-    0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x0F,
-    0x80, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00,
-    0x7C, 0x00, 0xBE, 0x00, 0x02, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xC0, 0x7A, 0xD1, 0xC0, 0x3F, 0x4B,
-    0xCF, 0xAE, 0x00, 0xBF, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0xF4,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F,
-    0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00,
-    0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFD,
-    0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01,
-    0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0,
-    0x00, 0xBD, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0,
-    0x07, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x01, 0x41, 0x01, 0xF4, 0x00, 0xFC, 0x7F, 0xFC, 0x00, 0x1F,
-    0xC7, 0xFE, 0x00, 0x01, 0xF8, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00,
-    0x10, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0xFF,
-    0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xBD, 0x00, 0x00, 0x03,
-    0xC2, 0xE0, 0x00, 0x00, 0x24, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xF4, 0x00, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x3E, 0x00,
-    0x03, 0xE0, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00,
-    0x0B, 0x87, 0x80, 0x00, 0x00, 0x78, 0xF0, 0x00, 0x00, 0x07, 0xAD, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0x00, 0x00,
-    0x02, 0xFF, 0x9F, 0x00, 0x00, 0x03, 0xDB, 0xFE, 0x00, 0x00, 0x03, 0x82, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFD, 0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x34, 0x00, 0x00, 0xFF, 0xDF, 0x40, 0x00,
-    0x2E, 0x3F, 0xF0, 0x00, 0x01, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0xBE, 0x00, 0x0B,
-    0xD0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x0B,
-    0x83, 0xD0, 0x00, 0x00, 0xB8, 0x78, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x7A, 0xD0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x10, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D, 0x1F, 0x40, 0xF0, 0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB, 0xDB, 0xAA, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0,
-    0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE,
-    0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x6A, 0xAA,
-    0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0x40, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xA8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x14, 0x01, 0x43, 0xE0, 0x3E, 0x3E, 0x03, 0xE3,
-    0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0,
-    0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E,
-    0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E,
-    0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03,
-    0xE2, 0x90, 0x29, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x07, 0xC0, 0x3C, 0x03, 0xE0, 0x1F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0xFD, 0x0F, 0xD0, 0xBC, 0x0F, 0xC0, 0xF0, 0x2E, 0x07, 0xC0, 0xA0, 0x00, 0x01, 0x40,
-    0xFD, 0x0F, 0xD0, 0xBD, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x04, 0x0F, 0xDB,
-    0xF2, 0xF4, 0x7D, 0x0F, 0x42, 0xE0, 0x3C, 0x07, 0x80, 0x00, 0x00, 0x10, 0x00, 0x01, 0xF0, 0x1E,
-    0x03, 0xC0, 0x7C, 0x0F, 0x80, 0xF4, 0x1F, 0x02, 0xF0, 0x3F, 0x03, 0xE0, 0x3F, 0x07, 0xE0, 0x7F,
-    0x0B, 0xF0, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x0F, 0xD1, 0xFC, 0x0F, 0xD0,
-    0xFD, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x41, 0xF0, 0x2F, 0x03, 0xE0, 0x3C, 0x07, 0xC0,
-    0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x0F, 0xD1, 0xFC, 0x0F, 0xD0, 0xFD, 0x0B,
-    0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x41, 0xF0, 0x2F, 0x03, 0xE0, 0x3C, 0x07, 0xC0, 0xF0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFD, 0x1F, 0xCB, 0xF0, 0xBE, 0x2F, 0x43, 0xF0, 0x7D,
-    0x0B, 0xC0, 0xF4, 0x1F, 0x02, 0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x43, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x14, 0x2C, 0x05, 0x00, 0x0F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3C, 0x04, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x05, 0x0F, 0x41, 0x40, 0x00, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x10,
-    0x3C, 0x05, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFD, 0x04, 0x0B, 0x40, 0x40, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x83, 0xFF, 0x1F, 0xFC, 0x7F, 0xF0, 0xFF, 0x40, 0x50, 0x00, 0x74, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFE, 0x0F, 0xFE, 0x00,
-    0xFE, 0x00, 0x06, 0x00, 0x00, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x0A, 0x00, 0x18,
-    0x3F, 0x40, 0xBE, 0x7F, 0x40, 0xFE, 0x7E, 0x00, 0xFC, 0x14, 0x00, 0x10, 0x06, 0x00, 0x00, 0x90,
-    0x00, 0x19, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0xFD, 0x04, 0x00, 0x01, 0x00, 0x00, 0x10, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0,
-    0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00,
-    0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00,
-    0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x90, 0x00, 0x2F,
-    0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34, 0x30, 0xA0, 0xC0, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD3, 0x40, 0x00, 0x74, 0xE0, 0x00, 0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA,
-    0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0, 0x70, 0xD0, 0xD1, 0xC3, 0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x40, 0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00,
-    0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB, 0x1C, 0x34, 0x07, 0x07, 0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0xE0, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x01, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x07, 0xC0, 0xF4, 0x06, 0xE0, 0x00, 0x0A, 0x90, 0xB8, 0x0F, 0x42, 0xE0, 0x3F,
-    0xFC, 0x00, 0xBF, 0xF8, 0x7E, 0xBD, 0x07, 0xC0, 0xF8, 0x2E, 0x02, 0xF0, 0x7C, 0x1F, 0xF4, 0x0F,
-    0x02, 0xE0, 0x1F, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x0F, 0x0B, 0x80, 0x2E, 0x00,
-    0x00, 0xB8, 0x0B, 0x80, 0x0F, 0x0F, 0x00, 0x2D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x1F, 0x1F, 0x00,
-    0x3D, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x2E, 0x1F, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x3C,
-    0x1F, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0xB8, 0x1F, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x07,
-    0xD6, 0xF0, 0x0F, 0x9B, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x00, 0xF0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x07, 0xE0, 0xBD, 0x0F, 0xC2, 0xF4, 0x3E, 0x07, 0xC0, 0xF4, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x34, 0x07, 0xE0, 0xBC, 0x0B, 0xD0, 0xFC, 0x0F, 0xC2, 0xF8, 0x2F, 0x43,
-    0xF0, 0x3E, 0x07, 0xD0, 0x7C, 0x0F, 0x80, 0xF4, 0x0F, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x0D, 0x02, 0xC0, 0x7E, 0x0B, 0xC0, 0xFC, 0x2F, 0x43, 0xF0, 0x7E, 0x0F, 0xC2,
-    0xF8, 0x3F, 0x0B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0x7D, 0x0B, 0xC1, 0xF0, 0x3E, 0x03, 0xD0, 0xF4,
-    0x0F, 0x01, 0xE0, 0x04, 0x01, 0x00, 0x20, 0x00, 0x00, 0x07, 0x40, 0xFC, 0x0F, 0xD0, 0x7F, 0x03,
-    0xF0, 0x0F, 0x80, 0x7C, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00, 0x74, 0x02, 0xC0, 0xFC, 0x0B, 0xC0,
-    0xFD, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x0F, 0x80, 0xFC, 0x07, 0xC0, 0x3D, 0x02,
-    0xD0, 0x1E, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xC0,
-    0xBC, 0x07, 0xE0, 0x3F, 0x41, 0xF8, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x07, 0xE0,
-    0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x7D, 0x01, 0xF0, 0x0F, 0x40, 0xF8, 0x02, 0xD0, 0x1E, 0x00, 0xF0,
-    0x02, 0x00, 0x10, 0x01, 0x40, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x1F,
-    0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0x18, 0x00, 0xBC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x7F, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x00, 0x90, 0x02,
-    0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x02, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00,
-    0x1E, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0xB4, 0x1F, 0x40, 0xE0, 0x02, 0xC0, 0xA0, 0x38, 0x00, 0x0B,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0A, 0x03, 0xFC, 0x0A,
-    0x01, 0xF8, 0x0F, 0x01, 0xF4, 0x0F, 0x42, 0xF8, 0x0F, 0x00, 0x00, 0xB5, 0xE0, 0x00, 0x00, 0x2D,
-    0x07, 0x80, 0x00, 0x07, 0x40, 0x1D, 0x00, 0x01, 0xE0, 0x50, 0x74, 0x00, 0x78, 0x1F, 0x42, 0xD0,
-    0x0E, 0x01, 0xF4, 0x0B, 0x43, 0x80, 0x05, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0,
-    0x03, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0x80,
-    0x0B, 0x80, 0x0B, 0x40, 0x0B, 0x40, 0x0B, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
-    0x0E, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x14, 0x00, 0x14, 0x00, 0xAA, 0xAA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x6A, 0xA3, 0xFF, 0xDB, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x06,
-    0xA0, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0x82, 0xFF, 0xFC, 0x03, 0xFF, 0xF4, 0x64, 0x2F, 0x40, 0xE0,
-    0x7F, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0xBD,
-    0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00,
-    0x0F, 0xE8, 0x00, 0x1F, 0xA4, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x29, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x01,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x0A, 0x90, 0x00, 0x0B, 0xC0, 0xFF, 0xF0, 0x00, 0x3F, 0x0B, 0xFF,
-    0xF0, 0x02, 0xF4, 0x19, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x3D, 0x00,
-    0xF4, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xB8, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0xB8, 0x00,
-    0x00, 0xE0, 0x03, 0xFA, 0x00, 0x07, 0x40, 0x0B, 0xF8, 0x00, 0x1D, 0x00, 0x0A, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7F,
-    0x00, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2A, 0x40, 0x00, 0xBD, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x02,
-    0xFF, 0xF8, 0x00, 0xF8, 0x02, 0x90, 0xBC, 0x01, 0xF4, 0x00, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x00,
-    0x3C, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x03, 0xC0, 0x00, 0x07, 0xD0,
-    0x07, 0xC0, 0x00, 0x1F, 0x40, 0x07, 0x80, 0x00, 0x7D, 0x00, 0x0B, 0x40, 0x01, 0xF4, 0x00, 0x0B,
-    0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x03, 0xE9, 0x00, 0x0F, 0x00, 0x03, 0xFD, 0x00, 0x08, 0x00,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x03,
-    0xE0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x14, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06,
-    0xFF, 0xE0, 0x10, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xD0,
-    0x2C, 0x03, 0x80, 0x7E, 0x0B, 0xC0, 0xFC, 0x1F, 0x42, 0xF4, 0x3F, 0x07, 0xE0, 0xFD, 0x0F, 0xC2,
-    0xF8, 0x3F, 0x03, 0xF0, 0xBD, 0x0F, 0xC1, 0xF8, 0x2F, 0x43, 0xE0, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F,
-    0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4, 0x0F, 0x01, 0xE0, 0x3D, 0x00, 0x40, 0x10, 0x02, 0x00, 0x10,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xFF, 0xC0, 0xBD, 0x2F, 0x43, 0xD0, 0x3E, 0x2E, 0x00, 0xB8, 0xF4,
-    0x03, 0xE7, 0xC0, 0x0F, 0x6E, 0x00, 0x3C, 0xB8, 0x01, 0xF2, 0xE0, 0x0F, 0x4B, 0xC0, 0xBC, 0x1F,
-    0x9B, 0xC0, 0x2F, 0xFC, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xB8, 0x00, 0x3C, 0xB4, 0x00, 0xF0, 0xF0, 0x03, 0xD0, 0xF0, 0x0F, 0x41, 0xF0,
-    0x3F, 0xAB, 0xF9, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA4, 0x03, 0xFF, 0xE0, 0x1F, 0xAA, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00,
-    0x1F, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x01, 0xF4,
-    0x05, 0xBF, 0x80, 0xBF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x1F, 0xF9, 0x00,
-    0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xAF, 0xD0, 0x3D, 0x02,
-    0xF0, 0x3C, 0x01, 0xF0, 0x3C, 0x01, 0xF0, 0x3D, 0x03, 0xD0, 0x2F, 0x5F, 0xC0, 0x0B, 0xFE, 0x00,
-    0x01, 0x50, 0x00, 0x2A, 0xAA, 0x47, 0xFF, 0xFD, 0xB9, 0x5B, 0xCF, 0x00, 0xF0, 0x50, 0x3D, 0x00,
-    0x0B, 0x80, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-    0x00, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xEF, 0xC0, 0x7C, 0x0F, 0x42, 0xD0,
-    0x3D, 0x0B, 0x81, 0xF0, 0x0F, 0xAF, 0x00, 0x2F, 0xF0, 0x03, 0xD7, 0xE0, 0x3D, 0x07, 0xC1, 0xF0,
-    0x0F, 0x47, 0xC0, 0x3C, 0x0F, 0x87, 0xE0, 0x2F, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0x90,
-    0x00, 0xFF, 0xF8, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0x3D, 0x07, 0x80, 0x2D, 0x0B, 0xC0, 0x3D, 0x07,
-    0xD0, 0x7C, 0x02, 0xFF, 0xFC, 0x00, 0x19, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x01, 0xFE,
-    0x00, 0x3F, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x2F, 0x81, 0xF7, 0xFE, 0x03,
-    0xE8, 0x78, 0x0F, 0xC2, 0xD0, 0x7C, 0x0F, 0x02, 0xE0, 0x3C, 0x0F, 0x41, 0xE0, 0x3C, 0x0B, 0xB4,
-    0xF0, 0x3F, 0x81, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xBF, 0x03, 0xE0,
-    0x3D, 0x1F, 0x00, 0xF8, 0xF4, 0x02, 0xE3, 0xC0, 0x0F, 0x9F, 0x00, 0x3D, 0xB8, 0x01, 0xF2, 0xE0,
-    0x0B, 0xCB, 0x80, 0x3D, 0x1F, 0x03, 0xE0, 0x3F, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x0F, 0xFD, 0x05, 0xBC, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xD0, 0x2F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x7F, 0xBF, 0x03, 0xE0, 0x3D, 0x0E, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00,
-    0x07, 0xD0, 0x00, 0x7D, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xEB, 0xE0, 0xB0, 0x2E, 0x00, 0x02, 0xE0,
-    0x00, 0x7C, 0x00, 0x7F, 0x00, 0x3F, 0xF4, 0x01, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x02,
-    0xF4, 0x6B, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x02, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x1E, 0xB8, 0x00, 0x78, 0xF4, 0x01, 0xF0, 0xF0, 0x07, 0xC0,
-    0xF0, 0x1F, 0x01, 0xE0, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0,
-    0x00, 0x07, 0x40, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x1B, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x3F, 0x90, 0x01, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x94, 0x00, 0x1F, 0xFF, 0x80, 0x2E,
-    0x57, 0xE0, 0x3C, 0x01, 0xF0, 0x3C, 0x01, 0xF0, 0x3C, 0x02, 0xE0, 0x3E, 0x03, 0xD0, 0x1F, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0xB0, 0x0B, 0x8E, 0x01,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00,
-    0x3D, 0x00, 0x07, 0xC0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x3E, 0x6F, 0x02, 0xE0, 0x3D, 0x0B, 0x40, 0xF0, 0x1F, 0x0B, 0x80, 0x2F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x1F, 0x0F, 0xC0, 0xF0, 0x0F, 0x47, 0x80, 0x3D, 0x1F, 0x01, 0xF0, 0x3F, 0xAF, 0x40, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xF0, 0x01, 0xFA, 0xFC, 0x03, 0xD0, 0x3C,
-    0x07, 0xC0, 0x3D, 0x0B, 0x80, 0x3D, 0x07, 0xC0, 0x3D, 0x03, 0xF9, 0xBC, 0x00, 0xFF, 0xF8, 0x00,
-    0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x1B, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xE5, 0x57, 0xD0, 0x00,
-    0x7D, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x10, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x95, 0x64, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xAA, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x5B, 0xE5, 0x40, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00,
-    0x7C, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x04, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xAF, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0x85, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x17, 0xF5,
-    0x55, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xAF, 0x95, 0x56, 0xB4, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x96, 0xBF, 0xFE, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-    0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0xB4,
-    0x00, 0x01, 0x50, 0x00, 0xFC, 0x00, 0xBC, 0x2F, 0xFF, 0xC0, 0xBF, 0xE0, 0x03, 0xE0, 0x1F, 0xD2,
-    0xFF, 0xFD, 0x0B, 0x9B, 0x80, 0x0F, 0xEF, 0xFC, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0xFE,
-    0x40, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF4,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x02, 0x10,
-    0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x7C, 0xF0, 0x1E, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0xC3, 0xFA, 0xF0, 0xBF, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x50, 0x7D, 0x00, 0x03, 0xF4, 0x00, 0x3C, 0x00, 0x0F,
-    0xC0, 0x00, 0x38, 0x00, 0x1F, 0x40, 0x00, 0x10, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x55,
-    0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFD, 0x55, 0x50, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x2A, 0xFE, 0xAA, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x00,
-    0x2F, 0xE4, 0x06, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00,
-    0x0B, 0xFF, 0x80, 0x0B, 0x9D, 0xB8, 0x0B, 0x87, 0x4F, 0x81, 0xC1, 0xD0, 0xD0, 0x00, 0x74, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x1D, 0x00, 0x0B, 0x07, 0x43, 0x42, 0xF1, 0xD3, 0xE0, 0x2F, 0x77, 0xE0, 0x02, 0xFF,
-    0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00,
-    0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x03,
-    0xD0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0x5D,
-    0x7C, 0x0F, 0x87, 0x4B, 0xC0, 0x81, 0xD0, 0x80, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x06, 0x07, 0x42, 0x43, 0xE1,
-    0xD2, 0xF0, 0x3E, 0x76, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x0F,
-    0x9D, 0xBC, 0x0F, 0x87, 0x4B, 0xC1, 0x81, 0xD0, 0x90, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x60, 0x74, 0x24, 0x3E, 0x1D, 0x2F, 0x03, 0xE7, 0x6F, 0x00,
-    0x2F, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x34, 0x0F,
-    0x00, 0x3E, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x2E, 0x00, 0x3C, 0x2F, 0x55, 0x5F, 0x0F, 0xFF, 0xFF,
-    0xC2, 0xF5, 0x55, 0x50, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x0B,
-    0x00, 0x0F, 0x03, 0xE0, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x02, 0xE0, 0x3D, 0x55, 0x7E, 0x0F, 0xFF,
-    0xFF, 0xC1, 0x55, 0x57, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x00,
-    0x01, 0xF0, 0x01, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0xF4,
-    0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0x8B, 0x80, 0x0F, 0xE2, 0xFC, 0x0F, 0xF8, 0xBF,
-    0xC7, 0x9E, 0x2D, 0xB4, 0x47, 0x8B, 0x44, 0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x00, 0x2E, 0x2D,
-    0x00, 0x0B, 0x8B, 0x40, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B,
-    0x80, 0x02, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0xBF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0x8B,
-    0x80, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2D, 0x00, 0x07, 0x8B, 0x40, 0x01, 0xE2,
-    0xD0, 0x00, 0x78, 0xB4, 0x01, 0x1E, 0x2D, 0x11, 0xE7, 0x8B, 0x6D, 0x2F, 0xE2, 0xFE, 0x02, 0xF8,
-    0xBE, 0x00, 0x2E, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x40, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x00, 0x7C, 0x00,
-    0x0F, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-    0x0F, 0x40, 0x00, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1C, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x2F,
-    0x4F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xBD,
-    0x00, 0x00, 0xF8, 0x01, 0xFE, 0xAA, 0xAF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF5, 0x56,
-    0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00,
-    0x00, 0xFC, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F,
-    0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B,
-    0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0x00, 0x34, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xFF, 0xFF, 0x03, 0xF4,
-    0x1F, 0xF0, 0xBC, 0x00, 0x3E, 0x1F, 0x40, 0x03, 0xE3, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x07, 0xC7,
-    0xC0, 0x00, 0xBC, 0xBC, 0x00, 0x0F, 0x8B, 0xC0, 0x01, 0xF0, 0xBC, 0x00, 0x3E, 0x0B, 0xD0, 0x07,
-    0xC0, 0x7F, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFC, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC5, 0x54, 0x07, 0xF7,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF5, 0x55, 0x41, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x03, 0x40,
-    0x00, 0x2F, 0xFF, 0xF4, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0xBF, 0x90, 0x07, 0xFF,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF4, 0x01, 0xF8, 0x00, 0x02,
-    0xF7, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x2F, 0x01, 0xF8, 0x00,
-    0x1F, 0x40, 0x7D, 0x07, 0xD0, 0x01, 0xF4, 0x01, 0xF4, 0x1F, 0x40, 0x1F, 0x40, 0x07, 0xD0, 0x7D,
-    0x01, 0xF4, 0x00, 0x2F, 0x41, 0xF8, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0xF8, 0x00, 0x03, 0xF0,
-    0x0B, 0xDF, 0x80, 0x00, 0x2F, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x1F,
-    0xD0, 0x00, 0xFF, 0xD0, 0x06, 0xFE, 0x00, 0x0F, 0xAF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x1F, 0xFF,
-    0xF8, 0x00, 0x01, 0xC0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0xBD, 0x00, 0x00,
-    0x03, 0xD1, 0xF8, 0x00, 0x00, 0x1F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xC0,
-    0x1F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0xBE, 0x00, 0x0B, 0xC0, 0x00, 0xFC,
-    0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3D,
-    0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xFD,
-    0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00,
-    0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00,
-    0x00, 0xFC, 0x0B, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x0F,
-    0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x94, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF9, 0x55, 0x55, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xBF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x42, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x00, 0x3C, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD7, 0xD0, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00,
-    0xBD, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x01, 0xFD, 0x3D, 0x00, 0x00, 0x01, 0xFF,
-    0xF5, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF4,
-    0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xE5, 0x55, 0x55, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x15, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0x90, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x01, 0x55, 0x55, 0xBF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xE0, 0x5B, 0xF8, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x0F, 0x00, 0x03,
-    0xF0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x1F, 0x40,
-    0x03, 0xE0, 0x00, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3D,
-    0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F,
-    0x80, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x1F, 0xD0, 0x15, 0x55, 0x7F, 0xFD, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x01, 0x55, 0x55, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x55, 0x55, 0x50, 0x2F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA,
-    0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0xBF, 0x90, 0x00, 0x6F, 0xE4, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xC6, 0xAA, 0xA0, 0x02,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFE, 0x00, 0x00, 0xFC, 0x07, 0xF4, 0x00, 0x07, 0xC0, 0x2F, 0xC0, 0x00, 0x3C, 0x00, 0xFF, 0x00,
-    0x02, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x03, 0xF0, 0x00, 0x03,
-    0xD0, 0xFC, 0x00, 0x00, 0x3C, 0x2F, 0x80, 0x00, 0x1B, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x80, 0xF0,
-    0x14, 0x3F, 0x4F, 0x0F, 0xC0, 0xBE, 0xFB, 0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07,
-    0xFF, 0xFD, 0x02, 0xF8, 0xF2, 0xFC, 0x2D, 0x0F, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x2F, 0xAF, 0xC7, 0xC0, 0x3D, 0xB8, 0x02,
-    0xEB, 0x40, 0x1E, 0xB8, 0x02, 0xE7, 0xD0, 0x7C, 0x2F, 0xFF, 0x40, 0x6F, 0x80, 0x1F, 0x43, 0xFC,
-    0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xBC, 0x05, 0x55, 0x00, 0x0F, 0x80, 0xFF, 0xF0, 0x01, 0xF0, 0x0F, 0xFF, 0x00,
-    0x2F, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00,
-    0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x03, 0xF1, 0xF0, 0x00, 0x00, 0x2F, 0x2E,
-    0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2E, 0x2F, 0xFE, 0x0B, 0xD7, 0xD1, 0xF9, 0xE0, 0xB4,
-    0x03, 0xFC, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF4, 0x0B, 0x80, 0x7F, 0xC0, 0x7F, 0xAF, 0x1F,
-    0x82, 0xFF, 0xC0, 0x7E, 0x01, 0x50, 0x00, 0x90, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0xFF, 0xF0, 0x7F,
-    0xFC, 0x3E, 0x0B, 0x8F, 0x47, 0xD7, 0xC0, 0x3F, 0xC0, 0x2E, 0x78, 0x00, 0xF4, 0x01, 0xE7, 0x80,
-    0x1F, 0x80, 0x1E, 0x7C, 0x03, 0xFE, 0x03, 0xD3, 0xFA, 0xF0, 0xFE, 0xFC, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xEA, 0xAA, 0xAA, 0xAA, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x14, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0x54, 0x05, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC,
-    0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0,
-    0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1,
-    0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07,
-    0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x1A, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xEF,
-    0x40, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x00,
-    0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x0F, 0x80, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x02,
-    0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x41,
-    0xF4, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00,
-    0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00,
-    0xFC, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x0F, 0xC0,
-    0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x7F,
-    0x40, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x01, 0xF5,
-    0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00,
-    0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00,
-    0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC,
-    0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x00, 0x7D,
-    0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x02, 0xF0, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x7F, 0xAF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40,
-    0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00,
-    0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00,
-    0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x0F, 0xF0, 0xFD, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3F, 0x0B, 0xF0, 0xBE, 0x02, 0x40, 0x05, 0x00, 0x00, 0x00,
-    0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC,
-    0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00,
-    0x06, 0x40, 0x00, 0x01, 0xA8, 0x00, 0x05, 0x03, 0xFF, 0xF4, 0x03, 0xC3, 0xF5, 0xBF, 0xEB, 0xD0,
-    0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55,
-    0x55, 0x55, 0x50, 0x02, 0x90, 0x00, 0x41, 0xFF, 0xD0, 0x2E, 0x3F, 0xBF, 0xDB, 0xD7, 0xC0, 0xBF,
-    0xF8, 0x20, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x04, 0x1F, 0xFD, 0x02, 0xD3, 0xFF, 0xFD, 0xBD, 0x7C,
-    0x0B, 0xFF, 0xC3, 0x00, 0x1B, 0xE0, 0x10, 0x00, 0x00, 0x01, 0x0F, 0xFA, 0xAA, 0xBF, 0xC2, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x01, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xBF, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x95, 0x55, 0xAF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x05, 0x55, 0x6F, 0x53, 0xFF, 0xFF, 0xFC, 0xAA, 0xAF,
-    0xAA, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x01, 0x57, 0xD5, 0x54, 0xFF, 0xFF, 0xFF, 0x2B, 0xFA,
-    0xAA, 0x80, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFC, 0x15,
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00,
-    0x01, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0xBF, 0x40, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x7F,
-    0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00,
-    0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x0B,
-    0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x0B, 0xF8,
-    0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x00,
-    0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x02,
-    0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x07,
-    0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x06, 0xAA, 0xAA,
-    0xAF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC1, 0xAA, 0xAA, 0xAB, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0xAA, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x81, 0xFF, 0xAA, 0xFE, 0xA9, 0x1F, 0xD0, 0x03, 0xD0, 0x00, 0xFD, 0x00, 0x1F, 0x00, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x3F, 0x40, 0xBC, 0x00,
-    0x00, 0x3F, 0x43, 0xE0, 0x00, 0x00, 0x7F, 0xEF, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x07, 0xFA, 0xAA, 0xA4, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0xAA, 0xAF,
-    0xBF, 0xD0, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0xC0, 0x00, 0x1F, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07, 0xE0, 0x00,
-    0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x07, 0xF0, 0x00, 0xBC, 0x00,
-    0xBF, 0x06, 0xAB, 0xFA, 0xAF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xFE, 0xAA, 0x40, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
-    0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE6, 0xE6, 0xF8, 0x00,
-    0x0F, 0x80, 0x74, 0x0B, 0xC0, 0x0F, 0x40, 0x1D, 0x00, 0x7C, 0x07, 0x80, 0x07, 0x40, 0x0B, 0x43,
-    0xC0, 0x01, 0xD0, 0x00, 0xF1, 0xD0, 0x00, 0x74, 0x00, 0x2D, 0xB0, 0x00, 0x1D, 0x00, 0x03, 0xBC,
-    0x00, 0x07, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1D, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x40, 0x00, 0xE7, 0x40, 0x01, 0xD0, 0x00, 0x74, 0xF0,
-    0x00, 0x74, 0x00, 0x3C, 0x2E, 0x00, 0x1D, 0x00, 0x2E, 0x03, 0xD0, 0x07, 0x40, 0x1F, 0x00, 0x3E,
-    0x01, 0xD0, 0x2F, 0x00, 0x02, 0xF9, 0xB9, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x07, 0x80,
-    0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xD0, 0x00, 0x00, 0x00, 0x2D, 0xB0, 0x00,
-    0x00, 0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x40, 0x00,
-    0x00, 0x00, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x00,
-    0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x07, 0xBC, 0x00, 0x01, 0xFB, 0x43, 0xC7, 0xC0, 0x01, 0xF4, 0xF1, 0xD0, 0x7C, 0x01,
-    0xF4, 0x1D, 0xB0, 0x07, 0xC1, 0xF4, 0x03, 0xBC, 0x00, 0x7D, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFB, 0xC0, 0x03, 0xEC, 0x01, 0xF0, 0x7C,
-    0x00, 0xE7, 0x41, 0xF0, 0x07, 0xC0, 0x74, 0xF1, 0xF0, 0x00, 0x7C, 0x3C, 0x2E, 0xF0, 0x00, 0x07,
-    0xEE, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0xC0, 0x0F, 0x40, 0x00, 0x01, 0xFC, 0x07, 0x80, 0x00, 0x01, 0xFB, 0x43, 0xC0, 0x00, 0x01, 0xF4,
-    0xF1, 0xD0, 0x00, 0x01, 0xF4, 0x1D, 0xB0, 0x00, 0x01, 0xF4, 0x03, 0xBC, 0x00, 0x01, 0xF4, 0x00,
-    0xFF, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x03,
-    0xEC, 0x01, 0xF4, 0x00, 0x00, 0xE7, 0x41, 0xF4, 0x00, 0x00, 0x74, 0xF1, 0xF4, 0x00, 0x00, 0x3C,
-    0x2E, 0xF4, 0x00, 0x00, 0x2E, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06, 0xAA, 0xBF, 0xAA,
-    0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x43, 0xFC, 0x3F, 0xC2, 0xF8,
-    0x00, 0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F, 0xC3, 0xFC,
-    0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x5B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xD1, 0xFF,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_14_italicBitmaps[39356] = {
+    0x59, 0x95, 0xDA, 0x4A, 0xD9, 0x4E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0xA5, 0xD9, 0x5D, 0x59,
+    0xD5, 0x9C, 0xA5, 0xAC, 0x95, 0xAC, 0x6D, 0x6D, 0x6A, 0x77, 0x70, 0xAD, 0x5E, 0x94, 0xE5, 0x99,
+    0x50, 0x2A, 0x92, 0xA9, 0x1D, 0x91, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xD1, 0xAD, 0x1A, 0xCA, 0x1A,
+    0xCA, 0x1D, 0x91, 0xD9, 0x1D, 0x2D, 0x2C, 0xA2, 0xCA, 0x2C, 0x92, 0xC9, 0x10, 0x77, 0x70, 0xD3,
+    0xD7, 0x09, 0xCA, 0x3C, 0xA7, 0x0A, 0xC9, 0x29, 0xC9, 0x70, 0xD3, 0xAC, 0x5A, 0xAA, 0xAD, 0xAA,
+    0xAA, 0xDA, 0xAA, 0x91, 0xFF, 0xFE, 0x94, 0xAC, 0x92, 0xAC, 0xA7, 0x0A, 0xC3, 0xAC, 0x71, 0xD3,
+    0xD7, 0x1C, 0xA3, 0xD7, 0x0A, 0xCA, 0x2A, 0xCA, 0x5F, 0xFF, 0xE1, 0x9A, 0xAA, 0xDA, 0xAA, 0xAD,
+    0xAA, 0xAA, 0x5D, 0x3D, 0x70, 0x9C, 0xA2, 0x9C, 0xA7, 0x0A, 0xC9, 0x2A, 0xC9, 0x70, 0xD3, 0xD7,
+    0x77, 0x00, 0x77, 0x71, 0xAC, 0x75, 0xD7, 0x5C, 0xA7, 0x39, 0xAC, 0xA7, 0x1A, 0xFD, 0x95, 0x9E,
+    0xAF, 0xD4, 0xDA, 0x1C, 0xA0, 0xAD, 0x92, 0xAD, 0x19, 0xC9, 0x1D, 0xA2, 0xDA, 0x1A, 0xC2, 0xD9,
+    0x2E, 0x1D, 0x70, 0xAD, 0xA0, 0xCA, 0x71, 0xFC, 0x97, 0x19, 0xFA, 0x73, 0xFC, 0x97, 0x2F, 0xC9,
+    0x70, 0x9C, 0x9A, 0xE3, 0x93, 0xAC, 0x1A, 0xDA, 0x1A, 0xC9, 0x2D, 0x19, 0xDA, 0x1D, 0xA2, 0xCA,
+    0x19, 0xDA, 0x1E, 0x19, 0xC9, 0x1A, 0xD9, 0x1A, 0xE9, 0xAC, 0x1A, 0xDA, 0x3F, 0xFD, 0xA5, 0x9F,
+    0xE9, 0x70, 0x9C, 0xA7, 0x4A, 0xC7, 0x5D, 0x75, 0xD7, 0x4A, 0xCA, 0x74, 0x99, 0x72, 0x77, 0x77,
+    0x72, 0x9A, 0x79, 0xF9, 0x70, 0xD9, 0x59, 0xDA, 0xAD, 0x96, 0xDA, 0x59, 0xD2, 0xAC, 0xA5, 0xAD,
+    0x6D, 0x92, 0x9D, 0x49, 0xD6, 0x9D, 0x4D, 0x4D, 0x96, 0xAC, 0x93, 0x9D, 0x3A, 0xCA, 0x7D, 0x93,
+    0x9C, 0xA2, 0x9D, 0x70, 0xD4, 0xD9, 0x2D, 0x71, 0xD9, 0x29, 0xD2, 0xD9, 0x29, 0xAC, 0xA2, 0xAC,
+    0xA2, 0xD9, 0x1A, 0xCA, 0x2F, 0xD1, 0x9D, 0xAA, 0xD9, 0x19, 0xD2, 0xDA, 0x1A, 0xCA, 0x19, 0xF9,
+    0x2D, 0x2A, 0xCA, 0x29, 0xD7, 0x1A, 0xC9, 0x2D, 0x4D, 0x70, 0xAC, 0xA2, 0xAC, 0xA4, 0xD7, 0x9D,
+    0x3D, 0x93, 0x9D, 0x7D, 0x93, 0xD9, 0x3A, 0xCA, 0x6A, 0xCA, 0x4D, 0x93, 0xD6, 0xAD, 0x5A, 0xCA,
+    0x2A, 0xCA, 0x59, 0xD6, 0x9D, 0x99, 0xAD, 0x6D, 0xA7, 0xAF, 0xA7, 0xD7, 0x29, 0x97, 0x77, 0x60,
+    0x77, 0x77, 0xAE, 0x97, 0x79, 0xFD, 0x97, 0x6D, 0x91, 0xDA, 0x75, 0xAC, 0xA2, 0xAC, 0xA7, 0x5D,
+    0x3D, 0x97, 0x49, 0xD2, 0x9D, 0x75, 0xAD, 0x1A, 0xD7, 0x95, 0xAD, 0x9D, 0xA7, 0x0C, 0x94, 0xAE,
+    0xA7, 0x09, 0xD9, 0x3A, 0xE6, 0x9A, 0xFA, 0x29, 0xDA, 0xD9, 0x29, 0xAF, 0xCA, 0x4D, 0x1D, 0xA1,
+    0x9F, 0xC6, 0xD9, 0x1A, 0xD1, 0x9C, 0x90, 0xD5, 0x9C, 0xA3, 0xDA, 0x4D, 0x5D, 0x93, 0xAD, 0x92,
+    0xAC, 0x95, 0xD9, 0x4E, 0x2D, 0x6D, 0x94, 0x9E, 0x9D, 0x96, 0xE5, 0x9F, 0xA7, 0x9E, 0x93, 0x9F,
+    0xA7, 0x0A, 0xFF, 0xFD, 0xA7, 0x9F, 0xE9, 0x1A, 0xFC, 0x99, 0x69, 0x96, 0x9A, 0xFA, 0x77, 0x29,
+    0x99, 0x20, 0x2A, 0x91, 0xD9, 0x09, 0xD1, 0xAD, 0x1A, 0xCA, 0x1D, 0x91, 0xD2, 0xCA, 0x2C, 0x91,
+    0x77, 0x6A, 0xC7, 0x09, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x09, 0xD7, 0x1D, 0x97, 0x0D,
+    0xA7, 0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x19,
+    0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x19, 0xD7, 0x2D, 0x72, 0xD9, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xDA,
+    0x71, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x72, 0x95, 0x77, 0x0A, 0xA7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0x71, 0xDA, 0x70, 0xAC, 0xA7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xCA, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0D,
+    0xA7, 0x9D, 0x70, 0xDA, 0x7A, 0xD7, 0x9D, 0x97, 0xD9, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x96, 0xAD,
+    0x71, 0x97, 0x10, 0x76, 0xAC, 0x92, 0x9C, 0x1D, 0xA2, 0xE0, 0xD3, 0x9D, 0xAC, 0x90, 0x99, 0x29,
+    0xFD, 0x1A, 0xE9, 0x9D, 0x0E, 0x0C, 0xA3, 0xAC, 0x1D, 0x7D, 0xA6, 0x93, 0x77, 0x1D, 0x72, 0xD7,
+    0x2D, 0x72, 0xD7, 0x2D, 0x5F, 0xFF, 0x0F, 0xFF, 0x5D, 0x97, 0x1D, 0x72, 0xD7, 0x2D, 0x72, 0xD7,
+    0x29, 0x95, 0x39, 0xA3, 0xEA, 0x29, 0xDA, 0x29, 0xD9, 0x2A, 0xD3, 0xD9, 0x2D, 0xA2, 0xDA, 0x29,
+    0xA9, 0x30, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0x19, 0xA1, 0xAD, 0xA0, 0xEA, 0x0E,
+    0x29, 0x10, 0x74, 0xAC, 0xA7, 0x5D, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD7,
+    0x5A, 0xCA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD7, 0x5A, 0xCA, 0x74, 0x9D, 0x75, 0xD9,
+    0x74, 0xAD, 0x75, 0xD9, 0x74, 0xAC, 0xA7, 0x49, 0xD7, 0x5D, 0x97, 0x49, 0xD7, 0x5D, 0x97, 0x59,
+    0x97, 0x50, 0x77, 0x71, 0x9F, 0xC9, 0x70, 0x9F, 0xFA, 0x6A, 0xE9, 0x99, 0xAE, 0x94, 0x9D, 0xA4,
+    0xAE, 0x4E, 0x6E, 0x3E, 0x7E, 0x29, 0xDA, 0x7E, 0x2A, 0xD7, 0x0E, 0x2E, 0x70, 0xE1, 0x9D, 0xA7,
+    0x0E, 0x1A, 0xD9, 0x79, 0xDA, 0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0E, 0x2E, 0x79, 0xDA, 0x2E, 0x7E,
+    0x3E, 0x6A, 0xD9, 0x3E, 0xA4, 0x9D, 0xA4, 0x9E, 0x92, 0xAE, 0x6F, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7,
+    0x59, 0x72, 0x77, 0x39, 0xD5, 0x9F, 0xC3, 0xAF, 0xDA, 0x4A, 0xAA, 0xE9, 0x7A, 0xD7, 0x0E, 0x70,
+    0xDA, 0x79, 0xD9, 0x7A, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x70,
+    0xE7, 0x9D, 0xA7, 0xAD, 0x94, 0x9F, 0xF1, 0x9F, 0xFC, 0x10, 0x77, 0x79, 0xAF, 0xA7, 0x9F, 0xFC,
+    0x59, 0xEA, 0x99, 0x9F, 0x4E, 0x49, 0xE3, 0x9D, 0x6E, 0x4C, 0xA6, 0xE7, 0x49, 0xE7, 0x4E, 0x97,
+    0x3A, 0xDA, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A,
+    0xDA, 0x73, 0xE9, 0x73, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFF, 0xC2, 0x9F, 0xFF, 0x92,
+    0x77, 0x69, 0xFC, 0x96, 0x9F, 0xFC, 0x49, 0xEA, 0x99, 0xAE, 0x93, 0xE4, 0x9D, 0xA3, 0xD5, 0x9D,
+    0xA7, 0x3A, 0xD9, 0x72, 0x9E, 0x72, 0x9E, 0x71, 0x9E, 0xA7, 0x9A, 0xFC, 0x70, 0xAF, 0xE9, 0x79,
+    0x2A, 0xE7, 0x4E, 0x97, 0x3A, 0xD9, 0x73, 0xE7, 0x3A, 0xDA, 0x71, 0x9F, 0x79, 0xAF, 0xC3, 0x9F,
+    0xFC, 0xA5, 0xFE, 0xA7, 0x19, 0x73, 0x77, 0x75, 0xE7, 0x4E, 0xA7, 0x3F, 0x97, 0x2F, 0xC9, 0x71,
+    0xDA, 0x9D, 0x71, 0xDA, 0x0A, 0xD7, 0x0E, 0x1D, 0xA7, 0xE2, 0xD9, 0x6E, 0x29, 0xD6, 0xE3, 0xAD,
+    0x5E, 0x4D, 0xA4, 0xE5, 0xDA, 0x3A, 0xD9, 0x49, 0xD9, 0x2A, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x72,
+    0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE4, 0x49, 0xFF, 0xC9, 0x4A, 0xFF, 0xC5,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x49, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x4E, 0x97, 0x29, 0xFC, 0xA7, 0x0A,
+    0xFE, 0x97, 0x29, 0xF7, 0x4E, 0xA7, 0x39, 0xE7, 0x4E, 0x74, 0xE7, 0x3A, 0xD9, 0x72, 0x9E, 0x72,
+    0xAE, 0x97, 0x9A, 0xF9, 0x4A, 0xFF, 0x6A, 0xFC, 0xA7, 0x29, 0x74, 0x77, 0x73, 0xAF, 0x97, 0x0F,
+    0xDA, 0x96, 0xAF, 0x97, 0x1F, 0x97, 0x2E, 0xA7, 0x3E, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x99, 0x99,
+    0x70, 0xFF, 0xD5, 0x9F, 0xAA, 0xFC, 0x4A, 0xD9, 0x4F, 0x3E, 0x6E, 0x3E, 0x6E, 0x3D, 0xA6, 0xE3,
+    0xDA, 0x6E, 0x3E, 0x59, 0xDA, 0x3E, 0x94, 0xE4, 0x9E, 0x3E, 0x95, 0xAF, 0xF9, 0x7A, 0xFC, 0xA7,
+    0x49, 0x71, 0x19, 0xFF, 0xEA, 0x2F, 0xFF, 0xC2, 0xEA, 0xAA, 0xAA, 0xAF, 0x1A, 0xD6, 0xE2, 0xD9,
+    0x5A, 0xD3, 0xD5, 0xAD, 0x97, 0x29, 0xD9, 0x73, 0xDA, 0x73, 0xE7, 0x3E, 0x73, 0xAD, 0xA7, 0x29,
+    0xE7, 0x3E, 0x73, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x29, 0xE7, 0x3E, 0x97, 0x3E, 0x74, 0xDA,
+    0x75, 0x97, 0x40, 0x77, 0x69, 0xFC, 0x96, 0x9F, 0xFA, 0x49, 0xE9, 0x2E, 0x93, 0xE4, 0x9D, 0xA2,
+    0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x94, 0xAD, 0x39, 0xDA, 0x39, 0xDA, 0x4E, 0xA1, 0x9D, 0xA5, 0x9F,
+    0xEA, 0x79, 0xFC, 0x70, 0xAF, 0xDA, 0x6E, 0x90, 0x9F, 0x4E, 0x4E, 0x92, 0xE5, 0x9E, 0x19, 0xDA,
+    0x6E, 0x19, 0xDA, 0x6D, 0xA1, 0x9E, 0x5E, 0x92, 0xEA, 0x3E, 0xA3, 0xAF, 0xFC, 0xA5, 0x9F, 0xDA,
+    0x72, 0x99, 0x70, 0x77, 0x7A, 0xFC, 0x97, 0x9F, 0xFA, 0x6E, 0x91, 0x9E, 0x94, 0xE4, 0x9E, 0x39,
+    0xDA, 0x5E, 0x3A, 0xD6, 0xAD, 0x92, 0xE6, 0xAD, 0x92, 0xE6, 0xAD, 0x3E, 0x6E, 0x3A, 0xE5, 0xDA,
+    0x4F, 0xA9, 0xAA, 0xE9, 0x49, 0xFF, 0xD7, 0x99, 0xAA, 0x9E, 0x97, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x3A, 0xE9, 0x71, 0xAF, 0x79, 0xAF, 0xCA, 0x79, 0xFC, 0xA7, 0x39, 0x97, 0x40, 0x49, 0x94,
+    0xE3, 0xAE, 0x3A, 0xDA, 0x49, 0x97, 0x77, 0x77, 0x73, 0x9A, 0x4A, 0xDA, 0x3E, 0xA3, 0xE5, 0x94,
+    0x69, 0x96, 0xE5, 0x9E, 0x5A, 0xDA, 0x69, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9A, 0x6E, 0xA5, 0x9D,
+    0xA5, 0x9D, 0x95, 0xAD, 0x6D, 0x95, 0xDA, 0x5D, 0xA5, 0x9A, 0x96, 0x77, 0x7A, 0xC9, 0x70, 0xAF,
+    0x6A, 0xF9, 0x5A, 0xF9, 0x5A, 0xF9, 0x6E, 0xA7, 0x1F, 0x97, 0x19, 0xF9, 0x71, 0xAF, 0x97, 0x1A,
+    0xF9, 0x71, 0xAF, 0x72, 0xAC, 0xA7, 0x39, 0x10, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF,
+    0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x76, 0x9C, 0x97, 0x2F, 0x97, 0x1A, 0xF9, 0x71,
+    0xAF, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x71, 0xAE, 0x79, 0xF9, 0x59, 0xF9, 0x5A, 0xF9, 0x5A, 0xF9,
+    0x79, 0xD9, 0x72, 0x97, 0x20, 0x2A, 0xAA, 0x94, 0xFD, 0x2A, 0xFE, 0x19, 0xA9, 0x1A, 0xD9, 0x6D,
+    0x96, 0xD9, 0x6D, 0x6D, 0x95, 0xDA, 0x5D, 0xA4, 0x9D, 0xA5, 0xDA, 0x5A, 0xCA, 0x6E, 0xAA, 0x4A,
+    0xEA, 0x5A, 0xA9, 0x77, 0x71, 0xE5, 0x9E, 0x59, 0xDA, 0x69, 0x96, 0x73, 0x99, 0xAA, 0xAA, 0xA9,
+    0x77, 0x0A, 0xFF, 0xE9, 0x73, 0xAF, 0xA9, 0x99, 0x9A, 0xAE, 0xA7, 0x09, 0xEA, 0x71, 0xAD, 0xA6,
+    0xAD, 0xA7, 0x4A, 0xD5, 0x9D, 0x97, 0x6D, 0xA3, 0x9D, 0x94, 0x9A, 0xCA, 0x1A, 0x92, 0xAD, 0x3D,
+    0xA4, 0xFF, 0x92, 0x9D, 0x2A, 0xD4, 0xDA, 0x1A, 0xE3, 0x9D, 0x2D, 0x93, 0xAD, 0x3A, 0xCA, 0x39,
+    0xD1, 0x9D, 0x39, 0xD4, 0xAC, 0x93, 0x9D, 0x1A, 0xCA, 0x3A, 0xD4, 0xD4, 0xAC, 0xA1, 0xD9, 0x3D,
+    0x93, 0x9D, 0x4D, 0x91, 0xD9, 0x3D, 0x4D, 0xA3, 0xAD, 0x2D, 0x39, 0xD3, 0xAD, 0x93, 0xD9, 0x19,
+    0xD3, 0x9D, 0x29, 0xCA, 0xC9, 0x2D, 0xA3, 0xD9, 0x3D, 0xA0, 0xAC, 0x9A, 0xCA, 0x9A, 0xDA, 0x4D,
+    0x93, 0xFC, 0x90, 0xAF, 0xC9, 0x5D, 0xA4, 0xDA, 0x92, 0xAC, 0xA9, 0x7A, 0xD7, 0x77, 0x9D, 0xA7,
+    0x77, 0xAD, 0xA7, 0x39, 0x72, 0xF9, 0x69, 0xAD, 0x73, 0xAF, 0xFF, 0xC7, 0x59, 0xAF, 0xFA, 0x97,
+    0x72, 0x99, 0x97, 0x60, 0x75, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD,
+    0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD,
+    0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9,
+    0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E,
+    0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x79, 0x99,
+    0x99, 0x70, 0x9F, 0xFD, 0x95, 0xFC, 0xAA, 0xAF, 0x96, 0x9D, 0x92, 0x9E, 0x6A, 0xD4, 0xAD, 0x95,
+    0xE4, 0x9D, 0x95, 0xDA, 0x4A, 0xD5, 0x9D, 0x94, 0xE5, 0x9D, 0x4A, 0xD6, 0xAD, 0xAA, 0xAA, 0xE7,
+    0xFF, 0xCA, 0x7D, 0xA9, 0x99, 0xAF, 0x59, 0xD9, 0x4A, 0xDA, 0x4A, 0xD6, 0xE4, 0xAD, 0x6E, 0x4E,
+    0x6E, 0x4D, 0xA5, 0x9D, 0xA3, 0x9D, 0x95, 0xE4, 0xAD, 0x49, 0xE9, 0x2A, 0xFF, 0xF9, 0x2A, 0xFF,
+    0xDA, 0x97, 0x76, 0x71, 0x99, 0x97, 0x3A, 0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39, 0xE3, 0xAD,
+    0xA6, 0x9D, 0x29, 0xDA, 0x7A, 0xCA, 0x2E, 0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x59,
+    0xD9, 0x75, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E, 0x71, 0x93,
+    0xF7, 0xAC, 0x92, 0x9F, 0xA9, 0x99, 0x9A, 0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74, 0x97, 0x10,
+    0x70, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xE9, 0x7F, 0xDA, 0xAF, 0xD7, 0x09, 0xD9, 0x39, 0xF7, 0xAD,
+    0x6F, 0x6E, 0x7E, 0x95, 0xDA, 0x7A, 0xDA, 0x49, 0xDA, 0x79, 0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7,
+    0x1E, 0x4E, 0x70, 0x9D, 0xA4, 0xDA, 0x70, 0x9D, 0xA3, 0x9D, 0x97, 0x0A, 0xD9, 0x3A, 0xD9, 0x70,
+    0xE4, 0xAD, 0x70, 0x9D, 0xA4, 0xE7, 0x0E, 0x5D, 0xA7, 0xE9, 0x49, 0xD9, 0x6E, 0x95, 0xAD, 0x93,
+    0x9A, 0xE9, 0x4A, 0xFF, 0xFA, 0x5A, 0xFF, 0xDA, 0x97, 0x77, 0x40, 0x77, 0x6A, 0xFF, 0xFC, 0x93,
+    0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69,
+    0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A,
+    0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF,
+    0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x77, 0x5A, 0xFF, 0xF9, 0x39, 0xAF, 0xFE, 0x69, 0xD9, 0x39, 0xD6,
+    0xAD, 0x5D, 0x6E, 0x5C, 0x96, 0xDA, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6F, 0xFC, 0x97,
+    0xFF, 0xC7, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD,
+    0x74, 0xAF, 0xDA, 0x70, 0xAF, 0xF7, 0x00, 0x71, 0x99, 0x99, 0x73, 0xAF, 0xFA, 0x6A, 0xFF, 0xF4,
+    0xAE, 0x94, 0xAD, 0xA3, 0xAD, 0xA7, 0xD9, 0x29, 0xDA, 0x70, 0xD3, 0xE7, 0x1C, 0xA2, 0xAD, 0x97,
+    0x6E, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD9, 0x69, 0x99, 0x99, 0x99, 0x0A, 0xD6, 0x9F, 0xE0,
+    0xAD, 0x79, 0x9A, 0xE1, 0xAD, 0x97, 0x1D, 0xA1, 0xAD, 0xA7, 0x09, 0xD9, 0x2E, 0x70, 0xAD, 0x3F,
+    0x7A, 0xD4, 0xFA, 0x92, 0x9A, 0xE4, 0x9F, 0xFF, 0x96, 0xAF, 0xF9, 0x74, 0x97, 0x10, 0x77, 0x74,
+    0xAF, 0xE4, 0xFE, 0xA3, 0x9A, 0xFA, 0x94, 0xAF, 0xCA, 0x69, 0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x1D,
+    0xA7, 0x0E, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0xE7, 0x09, 0xD9, 0x70, 0xDA,
+    0x70, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0xFF, 0xFE, 0x97, 0x0E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x70, 0x9D, 0xA7, 0x0E, 0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x70,
+    0xE7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x71, 0xDA, 0x6A,
+    0xFD, 0x49, 0xAF, 0xCA, 0x3A, 0xFE, 0x4F, 0xEA, 0x30, 0x77, 0x0A, 0xFE, 0x93, 0x9A, 0xFA, 0x96,
+    0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7,
+    0xAF, 0xD9, 0x3A, 0xFE, 0x93, 0x77, 0x70, 0xAF, 0xE9, 0x79, 0xAF, 0xC9, 0x73, 0xDA, 0x74, 0x9D,
+    0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7,
+    0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E,
+    0x75, 0xDA, 0x74, 0xAD, 0x79, 0xC9, 0x1A, 0xD9, 0x7A, 0xFD, 0xA7, 0x09, 0xFC, 0x97, 0x39, 0x99,
+    0x73, 0x77, 0x72, 0xAF, 0xE1, 0x9F, 0xE4, 0x9A, 0xFA, 0x92, 0x9F, 0xA7, 0x9D, 0x94, 0x9D, 0xA7,
+    0x1A, 0xD4, 0xAD, 0xA7, 0x2E, 0x3A, 0xD9, 0x73, 0xE2, 0xE9, 0x74, 0xDA, 0x1E, 0x75, 0x9D, 0x90,
+    0xE7, 0x6A, 0xD9, 0xDA, 0x77, 0xFD, 0x77, 0x0D, 0xAA, 0xD9, 0x76, 0x9D, 0x90, 0xE7, 0x6A, 0xD9,
+    0x0A, 0xDA, 0x75, 0xAD, 0x2E, 0x97, 0x4E, 0x29, 0xE9, 0x73, 0xDA, 0x3A, 0xE7, 0x29, 0xD9, 0x4F,
+    0x71, 0xAD, 0x6F, 0x95, 0xAF, 0xDA, 0x4F, 0xA3, 0xAF, 0xF5, 0xFA, 0x77, 0x39, 0x40, 0x77, 0x4A,
+    0xFE, 0x97, 0x9A, 0xFA, 0x97, 0x29, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x74, 0x9D,
+    0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0xC9,
+    0x3D, 0xA6, 0xAC, 0x92, 0x9D, 0x96, 0xD3, 0xAD, 0x93, 0x99, 0xE1, 0xAF, 0xFF, 0xC9, 0x0A, 0xFF,
+    0xFD, 0x10, 0x77, 0x77, 0x1A, 0xFC, 0xA7, 0xAF, 0xCA, 0x59, 0xAF, 0xA7, 0xFC, 0xA7, 0x0F, 0xC6,
+    0xAF, 0x72, 0xFC, 0x6D, 0xAD, 0x71, 0x9D, 0xAD, 0x5A, 0xCA, 0xAD, 0x71, 0xAC, 0xA9, 0xD9, 0x39,
+    0xD0, 0xAD, 0x71, 0xD9, 0x0D, 0x93, 0xD9, 0x0E, 0x70, 0x9D, 0x1D, 0xA2, 0x9D, 0x1E, 0x70, 0xAD,
+    0x1D, 0xA2, 0xD9, 0x1D, 0xA7, 0x0D, 0x91, 0xAD, 0x19, 0xCA, 0x2D, 0xA7, 0x0D, 0x2A, 0xD1, 0xD3,
+    0xDA, 0x7A, 0xD2, 0x9D, 0x0A, 0xCA, 0x3D, 0xA7, 0xDA, 0x3D, 0x9D, 0x4D, 0x97, 0xD9, 0x3F, 0x93,
+    0x9D, 0x96, 0x9D, 0x4F, 0x49, 0xD9, 0x6A, 0xCA, 0x4A, 0xD9, 0x49, 0xD7, 0xD9, 0x49, 0xCA, 0x5A,
+    0xD6, 0x9D, 0x69, 0x6A, 0xD4, 0x9A, 0xFA, 0x72, 0x9F, 0xCA, 0x2F, 0xE7, 0x19, 0xFE, 0x10, 0x77,
+    0x74, 0xAF, 0x96, 0xFE, 0x5A, 0xEA, 0x6A, 0xF9, 0x7A, 0xE7, 0x0D, 0x71, 0xAE, 0xA6, 0x9D, 0x71,
+    0xFC, 0x6A, 0xD7, 0x1D, 0xAD, 0x95, 0xDA, 0x70, 0x9D, 0x0E, 0x5D, 0x97, 0x0A, 0xD0, 0xAD, 0x94,
+    0xD7, 0x1D, 0xA1, 0xE3, 0x9D, 0x71, 0xD9, 0x1A, 0xD9, 0x2A, 0xD7, 0x1D, 0x3D, 0xA2, 0xDA, 0x70,
+    0x9D, 0x3A, 0xD2, 0xD9, 0x70, 0xAD, 0x39, 0xDA, 0x1D, 0x71, 0xDA, 0x4E, 0x09, 0xD7, 0x1D, 0x94,
+    0x9D, 0xAA, 0xCA, 0x71, 0xD6, 0xFC, 0xA7, 0x09, 0xD6, 0x9F, 0x97, 0x0A, 0xD7, 0xF7, 0x9A, 0xFA,
+    0x5A, 0xE6, 0x9F, 0xE6, 0xDA, 0x77, 0x77, 0x71, 0x99, 0x99, 0x74, 0xAF, 0xEA, 0x70, 0x9F, 0xFE,
+    0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92, 0x9D, 0xA7, 0x09, 0xE2, 0xE7, 0x2E, 0x1A, 0xD9, 0x72,
+    0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xE7, 0x39,
+    0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE9, 0x72, 0xE1, 0xAD, 0x97, 0x1A, 0xD9, 0x19, 0xE7, 0x09, 0xDA,
+    0x3E, 0x96, 0x9E, 0x49, 0xEA, 0x39, 0xF6, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20,
+    0x79, 0x99, 0x99, 0x70, 0x9F, 0xFD, 0x95, 0xFD, 0xAA, 0xFA, 0x69, 0xD9, 0x3E, 0x6A, 0xD4, 0x9D,
+    0xA5, 0xE5, 0xDA, 0x5D, 0xA5, 0xDA, 0x49, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x4E, 0x5A, 0xD4, 0xAD,
+    0x95, 0xE2, 0x9E, 0x96, 0xFF, 0xC9, 0x69, 0xFD, 0xA9, 0x70, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76,
+    0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x4A, 0xFD, 0xA7, 0x0A, 0xFF, 0x70, 0x71, 0x99, 0x97, 0x71,
+    0xAF, 0xE9, 0x74, 0x9F, 0xFE, 0x72, 0xAE, 0x94, 0xEA, 0x70, 0xAD, 0xA7, 0xE9, 0x69, 0xE7, 0x09,
+    0xDA, 0x6E, 0x72, 0xE5, 0xAD, 0x97, 0x2E, 0x5E, 0x73, 0xE4, 0x9D, 0xA7, 0x3E, 0x4A, 0xD9, 0x73,
+    0xE4, 0xAD, 0x74, 0xE4, 0xE7, 0x39, 0xDA, 0x4E, 0x73, 0xE5, 0xE7, 0x3E, 0x5A, 0xD9, 0x71, 0xE6,
+    0x9E, 0x70, 0xAD, 0xA7, 0xE9, 0x6A, 0xDA, 0x71, 0xEA, 0x39, 0xEA, 0x72, 0x9F, 0xFD, 0x97, 0x49,
+    0xFD, 0xA9, 0x77, 0x0A, 0xE9, 0x77, 0x39, 0xF9, 0x77, 0x39, 0xFC, 0x97, 0x72, 0xAF, 0xDA, 0x99,
+    0x77, 0x9F, 0xFD, 0x97, 0x6A, 0xFD, 0xA7, 0x73, 0x99, 0x20, 0x79, 0x99, 0x99, 0x71, 0x9F, 0xFC,
+    0xA7, 0xFD, 0xAA, 0xF7, 0x09, 0xD9, 0x2A, 0xE7, 0xAD, 0x4E, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6,
+    0x9D, 0x94, 0xE6, 0x9D, 0x4A, 0xD9, 0x6A, 0xD3, 0xAD, 0xA7, 0xE9, 0x9A, 0xEA, 0x70, 0xFE, 0xA7,
+    0x19, 0xDA, 0xAE, 0x72, 0xAD, 0x19, 0xD9, 0x71, 0xAD, 0x2E, 0x71, 0xE2, 0x9D, 0xA7, 0x0D, 0xA3,
+    0xE9, 0x69, 0xD9, 0x39, 0xE6, 0xAD, 0x5A, 0xE3, 0xAF, 0xD9, 0x3A, 0xE9, 0x0A, 0xFE, 0xA4, 0x9E,
+    0xA7, 0x72, 0x79, 0x99, 0x70, 0x9F, 0xEA, 0x4A, 0xEA, 0xAF, 0xA2, 0xAD, 0x94, 0xD9, 0x2D, 0xA5,
+    0xD2, 0x9D, 0xA5, 0xD2, 0x9D, 0xA5, 0xA3, 0x9E, 0x73, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x97, 0x1A,
+    0xFA, 0x72, 0xF9, 0x72, 0xAE, 0x2A, 0x96, 0xE1, 0x9C, 0xA6, 0xAD, 0x1A, 0xD6, 0xAD, 0x1A, 0xD6,
+    0xDA, 0x1A, 0xDA, 0x39, 0xE2, 0x9F, 0xFD, 0x94, 0xAF, 0xDA, 0x71, 0x99, 0x70, 0x77, 0x2F, 0xFF,
+    0xF1, 0xFF, 0xFF, 0x09, 0xD3, 0xAD, 0x39, 0xD0, 0x9C, 0xA3, 0xE3, 0x9C, 0xA0, 0xAC, 0x93, 0xDA,
+    0x39, 0xC9, 0x09, 0xC3, 0x9D, 0x93, 0x9A, 0x7A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xDA, 0x75, 0x9D,
+    0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x39, 0xAF,
+    0xD9, 0x70, 0xFF, 0x97, 0x77, 0x6F, 0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D,
+    0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7, 0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E,
+    0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7,
+    0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7, 0x0A, 0xD6, 0xE7, 0x0D, 0xA6, 0xE7, 0x9D, 0x7E, 0x95, 0x9D,
+    0xA7, 0xAE, 0xA2, 0x9A, 0xDA, 0x71, 0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x97, 0x79, 0x97, 0x50, 0x77,
+    0x4A, 0xFE, 0x39, 0xFE, 0x09, 0xFC, 0xA9, 0x39, 0xAF, 0xA3, 0xE7, 0x0A, 0xD5, 0xAD, 0x97, 0xDA,
+    0x59, 0xD9, 0x6A, 0xD6, 0x9D, 0xA6, 0xDA, 0x7D, 0xA5, 0xAD, 0x70, 0xE5, 0xD9, 0x70, 0xE4, 0xAD,
+    0x71, 0xAD, 0x4D, 0x97, 0x1A, 0xD3, 0xE7, 0x29, 0xD9, 0x19, 0xD7, 0x4D, 0x91, 0xDA, 0x74, 0xDA,
+    0x09, 0xD7, 0x5D, 0xA0, 0xDA, 0x75, 0xAD, 0x9D, 0x76, 0xAF, 0x97, 0x69, 0xF7, 0x79, 0xE9, 0x77,
+    0x0E, 0x77, 0x77, 0x10, 0x77, 0x75, 0x9F, 0xEA, 0x4A, 0xC5, 0xFE, 0x90, 0xAF, 0xCA, 0x49, 0xD5,
+    0xAF, 0xC9, 0x29, 0xDA, 0x6E, 0x96, 0xDA, 0x49, 0xDA, 0x59, 0xE9, 0x59, 0xD5, 0x9D, 0xA5, 0xF9,
+    0x5D, 0xA6, 0xDA, 0x49, 0xFA, 0x49, 0xD7, 0xE4, 0xDA, 0xDA, 0x4D, 0xA7, 0xE3, 0x9D, 0x0D, 0xA3,
+    0x9D, 0x70, 0xE3, 0xDA, 0x0E, 0x3A, 0xCA, 0x70, 0xE2, 0x9D, 0x1A, 0xD3, 0xD7, 0x1E, 0x2D, 0xA1,
+    0xAD, 0x2A, 0xCA, 0x71, 0xAD, 0x2D, 0x29, 0xD2, 0xD7, 0x2A, 0xD1, 0xAC, 0xA2, 0x9D, 0x1A, 0xCA,
+    0x72, 0xAD, 0x1D, 0x39, 0xD9, 0x0D, 0x73, 0x9D, 0x0A, 0xCA, 0x4D, 0x99, 0xD7, 0x39, 0xD9, 0xD5,
+    0xD9, 0xD9, 0x73, 0x9F, 0xA5, 0xFC, 0x75, 0xF6, 0xF9, 0x75, 0xE9, 0x6F, 0x76, 0xE7, 0xAD, 0x97,
+    0x77, 0x77, 0x00, 0x77, 0x74, 0xAF, 0xE2, 0xFE, 0x94, 0x9F, 0xCA, 0x92, 0x9A, 0xF9, 0x79, 0xDA,
+    0x59, 0xD9, 0x72, 0xE5, 0xDA, 0x73, 0x9D, 0xA3, 0xDA, 0x75, 0xE2, 0xDA, 0x76, 0x9D, 0x90, 0xAD,
+    0x77, 0x0E, 0xAD, 0x77, 0x19, 0xF7, 0x73, 0xE9, 0x77, 0x2A, 0xEA, 0x77, 0x1A, 0xFC, 0x77, 0x09,
+    0xD0, 0x9D, 0xA7, 0x69, 0xD2, 0xE7, 0x59, 0xD9, 0x29, 0xDA, 0x74, 0xDA, 0x4E, 0x73, 0xDA, 0x59,
+    0xDA, 0x71, 0xE7, 0xE6, 0x9A, 0xFC, 0x93, 0x9F, 0xDA, 0x3F, 0xEA, 0x3F, 0xF2, 0x77, 0x4F, 0xF2,
+    0xFE, 0x90, 0xAF, 0xCA, 0x39, 0xFC, 0x93, 0xE7, 0xDA, 0x5E, 0x6E, 0x69, 0xDA, 0x4A, 0xD7, 0x0E,
+    0x39, 0xD9, 0x70, 0xAD, 0x3D, 0xA7, 0x2D, 0xA1, 0xAD, 0x73, 0xE0, 0x9D, 0x74, 0x9D, 0xAD, 0x97,
+    0x5F, 0xA7, 0x6A, 0xE7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77,
+    0xAD, 0x76, 0xAF, 0xDA, 0x72, 0xFF, 0xA7, 0x00, 0x77, 0x5A, 0xFF, 0xF9, 0x3F, 0xFF, 0xC9, 0x29,
+    0xD9, 0x59, 0xE3, 0x9C, 0xA6, 0xE4, 0xAC, 0x95, 0xE6, 0xA5, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA,
+    0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x6A, 0xC4,
+    0xE7, 0xD3, 0xE7, 0xAD, 0x2E, 0xA2, 0x99, 0x99, 0x9D, 0xA1, 0x9F, 0xFF, 0xD3, 0xFF, 0xFD, 0x77,
+    0x40, 0x5A, 0xF6, 0xFC, 0x6D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x97,
+    0x9D, 0x70, 0xAD, 0x70, 0xAF, 0x6A, 0xAA, 0xA9, 0x60, 0x0D, 0x97, 0x0A, 0xCA, 0x71, 0xD7, 0x1D,
+    0x97, 0x09, 0xD7, 0x1D, 0x71, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xCA, 0x71, 0xD7, 0x1D,
+    0x97, 0x09, 0xD7, 0x1D, 0x71, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xCA, 0x71, 0xD7, 0x1D,
+    0x97, 0x09, 0xD7, 0x1D, 0x72, 0x90, 0x5A, 0xF6, 0xFC, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x70,
+    0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70,
+    0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x95, 0xFC, 0x69, 0xAA, 0xA9, 0x60, 0x59, 0x97,
+    0x2A, 0xDA, 0x71, 0xF7, 0x09, 0xF9, 0x7D, 0xA9, 0xD7, 0xD1, 0xD9, 0x5A, 0xCA, 0x1A, 0xCA, 0x5D,
+    0x91, 0x9D, 0x49, 0xD3, 0xD9, 0x3D, 0xA3, 0xAD, 0x3D, 0x5D, 0x91, 0xAD, 0x5D, 0xA1, 0xD9, 0x59,
+    0xD1, 0xAA, 0x7A, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x6C, 0xA2, 0xAD, 0x91, 0x9E, 0x29, 0xDA, 0x29, 0xD4, 0xC6,
+    0x77, 0x49, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93,
+    0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A,
+    0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D,
+    0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x30, 0x49, 0x99, 0x71, 0xFC, 0x70, 0x9A,
+    0xAE, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0x9D, 0x73, 0xAC, 0xA1, 0x9E, 0x94,
+    0xD9, 0x0A, 0xFC, 0x4D, 0x0A, 0xCA, 0x9A, 0xDA, 0x29, 0xDA, 0xC9, 0x2E, 0x2A, 0xEA, 0x3E, 0x2F,
+    0x4E, 0x2E, 0x5D, 0xA1, 0x9D, 0xA5, 0xD9, 0x1A, 0xD5, 0x9D, 0x2A, 0xD5, 0xE2, 0xDA, 0x49, 0xD9,
+    0x19, 0xD9, 0x4D, 0xA2, 0xAD, 0xA2, 0x9E, 0x3F, 0xFD, 0x4D, 0x9F, 0xCA, 0x72, 0x97, 0x77, 0x09,
+    0xFA, 0x4F, 0xE3, 0xE9, 0x99, 0xD2, 0xAD, 0x79, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD,
+    0x70, 0xE7, 0x0E, 0x70, 0xAD, 0x94, 0xC9, 0x09, 0xE9, 0x09, 0xAD, 0x2F, 0xF4, 0xFC, 0x97, 0x96,
+    0x74, 0x99, 0x72, 0xFC, 0x97, 0x09, 0xAA, 0xE9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9,
+    0x73, 0x9D, 0x7A, 0xE9, 0xAD, 0x59, 0xFF, 0xA4, 0x9D, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93,
+    0xDA, 0x49, 0xD3, 0x9D, 0x5A, 0xD3, 0xDA, 0x5D, 0xA3, 0xD9, 0x49, 0xD9, 0x29, 0xD5, 0xE3, 0xAD,
+    0x49, 0xE3, 0xAD, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D,
+    0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x30, 0x77, 0x09, 0xFA, 0x4A, 0xDA, 0xE9,
+    0x2D, 0xA2, 0xDA, 0x1A, 0xCA, 0x3D, 0xA0, 0x9D, 0x39, 0xD9, 0x0D, 0xA2, 0x9D, 0xA1, 0xD9, 0x1A,
+    0xDA, 0x19, 0xD9, 0xF9, 0x2A, 0xFC, 0x94, 0xE9, 0x7E, 0x70, 0xAD, 0x5A, 0xA0, 0x9D, 0xA1, 0x9A,
+    0xD9, 0x1F, 0xF9, 0x29, 0xFC, 0xA7, 0x96, 0x77, 0x77, 0x1A, 0xF9, 0x74, 0xFE, 0x73, 0xDA, 0x19,
+    0xCA, 0x72, 0x9D, 0x77, 0x0D, 0xA7, 0x70, 0xD9, 0x77, 0x9D, 0x76, 0x9A, 0xFE, 0x71, 0xFF, 0xD7,
+    0x4D, 0xA7, 0x70, 0xD9, 0x77, 0x9D, 0x77, 0x0A, 0xD7, 0x70, 0xDA, 0x77, 0x0D, 0x97, 0x79, 0xD9,
+    0x77, 0xAD, 0x77, 0x0A, 0xD7, 0x70, 0xDA, 0x77, 0x0D, 0x97, 0x79, 0xD7, 0x70, 0xAD, 0x77, 0x0E,
+    0x77, 0x0D, 0x97, 0x79, 0xD7, 0x3A, 0x3D, 0xA7, 0x2A, 0xDA, 0x9A, 0xD7, 0x3A, 0xFD, 0x75, 0xAA,
+    0xCA, 0x97, 0x50, 0x77, 0x72, 0x9A, 0xFF, 0xA6, 0xAE, 0xAF, 0xD9, 0x5A, 0xD9, 0x2D, 0x99, 0x7D,
+    0x93, 0xDA, 0x7A, 0xD4, 0xD9, 0x7D, 0xA4, 0xD7, 0x0D, 0xA3, 0xE7, 0x0A, 0xD2, 0xE7, 0x2F, 0xDA,
+    0x74, 0xAD, 0xA9, 0x74, 0x9D, 0x76, 0x9D, 0x97, 0x69, 0xEA, 0x75, 0xAF, 0xCA, 0x71, 0xF9, 0xAF,
+    0x95, 0x9D, 0xA4, 0xAE, 0xA4, 0xDA, 0x69, 0xE3, 0x9D, 0x97, 0xAD, 0x39, 0xDA, 0x69, 0xDA, 0x4F,
+    0xA9, 0x99, 0x9F, 0x6F, 0xFD, 0xA7, 0x1A, 0xAD, 0xAA, 0x97, 0x49, 0x99, 0x73, 0xFC, 0x72, 0x9A,
+    0xAE, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x2A, 0xE6, 0xD9,
+    0x09, 0xFC, 0xA5, 0xD0, 0x9D, 0xA9, 0xE4, 0x9D, 0x0D, 0x2E, 0x4A, 0xCA, 0xD3, 0xDA, 0x4F, 0x93,
+    0xD9, 0x4E, 0xA3, 0x9D, 0x49, 0xE4, 0xAD, 0x4A, 0xD9, 0x4D, 0xA4, 0xE5, 0xD9, 0x4D, 0xA4, 0x9D,
+    0x49, 0xD9, 0x4A, 0xD0, 0x9C, 0x1A, 0xD5, 0xEA, 0xD1, 0xAD, 0x5F, 0xC2, 0xDA, 0x5E, 0xA7, 0x59,
+    0x40, 0x75, 0xE4, 0x9E, 0x4A, 0xE5, 0xAA, 0x77, 0x75, 0x9A, 0xE2, 0x9F, 0xC9, 0x49, 0xD5, 0xAD,
+    0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0xA0, 0x9C, 0x2D, 0xAA,
+    0xD1, 0x9F, 0xC3, 0xEA, 0x74, 0x77, 0x72, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x29, 0xAA, 0x77, 0x77,
+    0x77, 0x5A, 0xAE, 0x70, 0x9F, 0xC7, 0x3A, 0xD7, 0x3E, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73,
+    0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xE7, 0x3D, 0x97, 0x29, 0xD7, 0x3E,
+    0x73, 0xD9, 0x72, 0xAD, 0x69, 0xA2, 0xD9, 0x6F, 0xDA, 0x7F, 0xCA, 0x70, 0x9A, 0xCA, 0x97, 0x00,
+    0x49, 0x97, 0x0A, 0xFA, 0x7A, 0xAA, 0xDA, 0x71, 0x9D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7,
+    0x2D, 0x97, 0x19, 0xD1, 0xAE, 0xA3, 0xAC, 0xA0, 0xFD, 0x92, 0xDA, 0xD9, 0x1D, 0x92, 0xF3, 0xD9,
+    0x19, 0xE3, 0xAD, 0x2A, 0xD3, 0x9D, 0x92, 0xAC, 0xA1, 0x9E, 0x93, 0xFE, 0xA5, 0xFC, 0xA6, 0x9D,
+    0x0A, 0xD6, 0xAD, 0x1D, 0xA5, 0xDA, 0x1A, 0xDA, 0x4D, 0x92, 0xF2, 0x9D, 0x93, 0xFC, 0xAA, 0xD5,
+    0xF9, 0x72, 0x91, 0x49, 0x92, 0xFC, 0x90, 0x9A, 0xAE, 0x93, 0xAD, 0x4E, 0x4D, 0xA4, 0xD9, 0x39,
+    0xD4, 0xAD, 0x4D, 0xA4, 0xD9, 0x39, 0xD4, 0xAD, 0x4E, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4E, 0x4D,
+    0xA4, 0xD9, 0x0A, 0xA0, 0x9D, 0xAD, 0x90, 0xAF, 0xA1, 0x9E, 0x97, 0x20, 0x77, 0x70, 0xAE, 0xA2,
+    0x9E, 0x93, 0xAD, 0xA1, 0xAF, 0xC1, 0xAF, 0xC1, 0x9F, 0xC9, 0x3D, 0xA0, 0xAD, 0x9E, 0x09, 0xD9,
+    0xAD, 0x93, 0xD9, 0xAC, 0xA1, 0xAC, 0xA9, 0xD1, 0x9D, 0x93, 0xDA, 0xCA, 0x2A, 0xCA, 0xD2, 0x9D,
+    0x39, 0xF3, 0xF3, 0xAD, 0x3A, 0xE4, 0xE9, 0x3D, 0xA3, 0xEA, 0x39, 0xE4, 0xD9, 0x3E, 0x4A, 0xD9,
+    0x39, 0xD3, 0x9D, 0xA4, 0xE4, 0xAD, 0x39, 0xD5, 0xD9, 0x4D, 0xA3, 0xAD, 0x49, 0xD5, 0xD9, 0x0A,
+    0xA0, 0xDA, 0x4A, 0xD4, 0x9D, 0x9D, 0xA0, 0xD9, 0x4D, 0xA4, 0xAF, 0xA0, 0x9D, 0x5D, 0x94, 0x9E,
+    0x97, 0x77, 0x10, 0x77, 0x0A, 0xEA, 0x29, 0xEA, 0x1A, 0xFC, 0x1A, 0xFC, 0x93, 0xDA, 0x0A, 0xD9,
+    0xAD, 0x93, 0xD9, 0xAC, 0xA1, 0x9D, 0x93, 0xDA, 0xCA, 0x29, 0xD3, 0x9F, 0x3A, 0xD3, 0xAE, 0x4D,
+    0xA3, 0xEA, 0x4D, 0x93, 0xE4, 0x9D, 0x39, 0xDA, 0x4A, 0xD3, 0x9D, 0x5D, 0xA3, 0xAD, 0x5D, 0x90,
+    0xAA, 0x0D, 0xA4, 0x9D, 0xAD, 0xA0, 0xD9, 0x49, 0xFA, 0x09, 0xD5, 0x9E, 0x97, 0x71, 0x77, 0x29,
+    0xFC, 0x95, 0xFF, 0x93, 0xE9, 0x19, 0xE2, 0xE4, 0xAD, 0x90, 0x9D, 0x94, 0x9D, 0xA0, 0xE6, 0xDA,
+    0x9D, 0x95, 0x9D, 0x9A, 0xD6, 0x9D, 0x9A, 0xD6, 0xAD, 0x0E, 0x6D, 0xA0, 0xE5, 0xAD, 0x90, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9E, 0x29, 0xE3, 0xFF, 0xC5, 0xAF, 0xC9, 0x70, 0x97, 0x00, 0x77, 0x5A, 0xEA,
+    0x2A, 0xE4, 0xAF, 0xA0, 0x9F, 0xD6, 0xDA, 0x0D, 0x99, 0xE6, 0xD9, 0xD2, 0xAD, 0x95, 0xF3, 0x9D,
+    0x94, 0x9E, 0x93, 0x9D, 0x94, 0xAE, 0x49, 0xD5, 0xAD, 0x5A, 0xD5, 0xE5, 0xDA, 0x5D, 0x94, 0x9D,
+    0x94, 0x9D, 0x5E, 0x5A, 0xD4, 0x9D, 0x95, 0xE9, 0x2A, 0xDA, 0x6F, 0xFC, 0xA6, 0x9D, 0xAF, 0xC9,
+    0x7A, 0xD2, 0x97, 0x2A, 0xCA, 0x76, 0xD9, 0x76, 0xD9, 0x75, 0xAD, 0x97, 0x4F, 0xE9, 0x70, 0x9A,
+    0xAA, 0xAA, 0xAA, 0x71, 0x77, 0x39, 0xF9, 0x0A, 0xC9, 0x3A, 0xFF, 0xC3, 0xE9, 0x1A, 0xEA, 0x2A,
+    0xD4, 0x9D, 0x92, 0xD9, 0x49, 0xD2, 0xAD, 0x5A, 0xD2, 0xDA, 0x5D, 0xA1, 0x9D, 0x59, 0xD9, 0x1A,
+    0xD5, 0xE2, 0xAD, 0x49, 0xE2, 0xE4, 0xEA, 0x2E, 0x3F, 0x92, 0xAD, 0xA0, 0x9D, 0x0D, 0x39, 0xFD,
+    0x90, 0xD4, 0xAE, 0xA1, 0x9D, 0x69, 0x3A, 0xCA, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD9, 0x72, 0xAD,
+    0xA7, 0x0F, 0xE6, 0x9A, 0xAA, 0xAA, 0xAA, 0x20, 0x74, 0xAE, 0xA1, 0x9D, 0xAA, 0xFC, 0x09, 0xF2,
+    0xAC, 0xA0, 0xFA, 0x2D, 0x9A, 0xC9, 0x5D, 0xAC, 0xA6, 0xF6, 0x9E, 0x7A, 0xDA, 0x7E, 0x70, 0xDA,
+    0x79, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0x97, 0x77, 0x09, 0xFA, 0x4F, 0xE3, 0xDA,
+    0x19, 0xD2, 0x9D, 0x70, 0x9D, 0x97, 0x0E, 0x97, 0xAE, 0xA7, 0xAF, 0x79, 0xEA, 0x70, 0xE7, 0x0A,
+    0xD1, 0x9C, 0x93, 0x9D, 0x1A, 0xDA, 0x2D, 0xA1, 0x9F, 0xF3, 0x9F, 0xC9, 0x79, 0x60, 0x5A, 0xA7,
+    0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD6, 0x9A, 0xFE, 0x90, 0xFF, 0xD4, 0xDA, 0x70, 0xD9, 0x79, 0xD7,
+    0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0x9D, 0x70, 0xAD, 0x39, 0x3D, 0xA2, 0xAC, 0x92,
+    0xE9, 0x9E, 0x3F, 0xE4, 0x9F, 0x97, 0x96, 0x77, 0x0A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD,
+    0x49, 0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD,
+    0x4D, 0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C,
+    0x0E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x77,
+    0x9E, 0x49, 0xDA, 0x09, 0xFA, 0x4E, 0x3E, 0x4A, 0xD3, 0xAD, 0x4A, 0xD3, 0x9D, 0x93, 0xAD, 0x4D,
+    0xA3, 0xD9, 0x4D, 0xA2, 0x9D, 0x5A, 0xCA, 0x2D, 0xA5, 0xAD, 0x19, 0xD6, 0x9D, 0x1D, 0x96, 0x9D,
+    0x0A, 0xCA, 0x70, 0xDA, 0xD7, 0x1F, 0x72, 0xE7, 0x3D, 0x77, 0x60, 0x77, 0x69, 0xE4, 0xE4, 0xE0,
+    0x9F, 0xA3, 0xAD, 0x93, 0xAD, 0xA2, 0xE4, 0xDA, 0x39, 0xDA, 0x2A, 0xD9, 0x3E, 0x4D, 0xA3, 0xD9,
+    0x3E, 0x4D, 0x93, 0xDA, 0x29, 0xE9, 0x29, 0xD4, 0xE2, 0xAE, 0x92, 0xDA, 0x4A, 0xD2, 0xFA, 0x2D,
+    0x59, 0xD1, 0x9C, 0xAA, 0xCA, 0x1A, 0xCA, 0x6D, 0x1D, 0x09, 0xD1, 0xD7, 0xD0, 0x9C, 0xA0, 0x9D,
+    0x0A, 0xCA, 0x7D, 0x9D, 0x2D, 0x9D, 0x70, 0xF3, 0xF7, 0x1E, 0x93, 0xE7, 0x2D, 0x94, 0xD7, 0x77,
+    0x40, 0x77, 0x5A, 0xDA, 0x49, 0xE2, 0x9F, 0xC3, 0x9F, 0x29, 0xA9, 0x9D, 0xA1, 0x9D, 0xA9, 0xA6,
+    0xE1, 0xD9, 0x71, 0x9D, 0x9A, 0xCA, 0x73, 0xFC, 0x74, 0xAE, 0x75, 0x9D, 0xA7, 0x5F, 0x74, 0xAF,
+    0x97, 0x29, 0xD0, 0xE7, 0x2D, 0x1A, 0xD6, 0xA9, 0x9D, 0x91, 0x9D, 0xA9, 0x9A, 0x2F, 0xA3, 0xFD,
+    0x2E, 0xA4, 0x9E, 0x94, 0x97, 0x60, 0x77, 0x59, 0xAD, 0x94, 0xE3, 0x9F, 0xC4, 0xAD, 0xA5, 0xAD,
+    0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D, 0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92, 0xAC, 0xA7, 0x0D,
+    0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C, 0xA7, 0x29, 0xCA,
+    0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x5D, 0x97,
+    0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7, 0x29, 0xFA, 0x74, 0xAC, 0xA7, 0x50, 0x77, 0x0E, 0xA9, 0x2D,
+    0x2F, 0xE9, 0x9D, 0x91, 0xDA, 0xAF, 0xDA, 0x19, 0xC9, 0x3A, 0xDA, 0x3C, 0x4E, 0x71, 0xAD, 0x71,
+    0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x71, 0x9D, 0x97, 0x09, 0xD9, 0x5C, 0x19, 0xFC, 0xAA,
+    0x99, 0xD9, 0x0F, 0xFF, 0x90, 0xAC, 0x90, 0x9A, 0xFC, 0xA7, 0x19, 0x40, 0x77, 0x29, 0xE6, 0x9F,
+    0x6D, 0x97, 0xAC, 0xA7, 0x0D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0xAC, 0xA7,
+    0x0A, 0xCA, 0x70, 0xD7, 0xAD, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1D, 0x97, 0x0D, 0x70, 0x9D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x71, 0xD7, 0x1D, 0xA7, 0x0A,
+    0xF7, 0xAD, 0x95, 0x74, 0x9D, 0x4A, 0xCA, 0x4D, 0x94, 0xD5, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x94,
+    0xD4, 0x9D, 0x49, 0xCA, 0x4A, 0xCA, 0x4D, 0x94, 0xD4, 0x9D, 0x49, 0xCA, 0x4A, 0xC9, 0x4D, 0x94,
+    0xD4, 0x9D, 0x4A, 0xCA, 0x4A, 0xC9, 0x4D, 0x5D, 0x49, 0xD5, 0x99, 0x40, 0x77, 0x0E, 0x95, 0x9F,
+    0x97, 0xDA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x7A, 0xCA,
+    0x7D, 0xA7, 0xAD, 0x97, 0xE6, 0x9D, 0xA5, 0x9D, 0x7D, 0x97, 0xD7, 0x9D, 0x79, 0xD7, 0x9D, 0x79,
+    0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x7D, 0xA4, 0xAF, 0x5A, 0xCA, 0x96, 0x77, 0xAE, 0x94, 0xC9, 0x0F,
+    0xE9, 0x1D, 0xA9, 0xD9, 0x0A, 0xFE, 0x09, 0xC9, 0x3A, 0xF9, 0x71, 0x99, 0x20, 0x59, 0x6E, 0x49,
+    0xE4, 0x9D, 0x95, 0x97, 0x71, 0x96, 0xCA, 0x6C, 0xA5, 0x9C, 0x95, 0xAC, 0x95, 0xD6, 0xD5, 0x9D,
+    0x5A, 0xD5, 0xDA, 0x5D, 0x94, 0xAD, 0x5E, 0x5E, 0x4A, 0xD9, 0x4E, 0x5A, 0x95, 0x77, 0x6A, 0xCA,
+    0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x72, 0x9C, 0xA7, 0x19, 0xEA, 0x95, 0xAF, 0xEA, 0x3F, 0xFD, 0x2E,
+    0x09, 0xCA, 0x09, 0xC9, 0x1E, 0x19, 0xC9, 0x4A, 0xD2, 0xAC, 0x5D, 0xA2, 0xD5, 0xD9, 0x2C, 0xA4,
+    0x9D, 0x29, 0xC9, 0x4A, 0xD2, 0xAC, 0x5A, 0xD2, 0xD5, 0x9D, 0x91, 0xCA, 0x39, 0x1E, 0x09, 0xC9,
+    0x19, 0xD1, 0xAF, 0xC9, 0x9E, 0x92, 0xAF, 0xF5, 0x9F, 0xA9, 0x79, 0xCA, 0x72, 0xAC, 0x97, 0x2D,
+    0x73, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x97, 0x29, 0x97, 0x00, 0x77, 0x75, 0x9A, 0xF7, 0x3A, 0xFE,
+    0x71, 0xAD, 0x91, 0xAD, 0x97, 0x9D, 0x4D, 0x97, 0xDA, 0x4D, 0x79, 0xD5, 0x97, 0x0A, 0xD7, 0x7D,
+    0xA7, 0x69, 0xD9, 0x74, 0xAA, 0xEA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFD, 0xA7, 0x09, 0xDA, 0x76, 0x9D,
+    0x97, 0x6E, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x4A, 0xAA, 0xDA, 0x99, 0x99, 0x99, 0xAA,
+    0xC9, 0x2F, 0xFF, 0xE3, 0xEA, 0x99, 0xAA, 0xFD, 0xA3, 0xAA, 0x77, 0x77, 0x4C, 0xA7, 0x1A, 0xC9,
+    0x2D, 0x90, 0xAF, 0xA0, 0xDA, 0x4F, 0xCA, 0xFC, 0x95, 0x9D, 0x92, 0x9D, 0x96, 0xD9, 0x4D, 0xA5,
+    0x9D, 0x5A, 0xCA, 0x59, 0xCA, 0x5D, 0x95, 0xAC, 0xA4, 0x9D, 0x6A, 0xD4, 0xDA, 0x6F, 0x99, 0x9E,
+    0x94, 0xAD, 0xAF, 0xDA, 0xD9, 0x2A, 0xCA, 0x2A, 0xAA, 0x92, 0xD3, 0x97, 0x29, 0x30, 0x9F, 0xE2,
+    0x9F, 0xDA, 0x9F, 0xDA, 0x29, 0xFD, 0x91, 0xEA, 0x6A, 0xD9, 0x39, 0xDA, 0x59, 0xD9, 0x5E, 0x5D,
+    0xA6, 0xAD, 0x4E, 0x79, 0xDA, 0x2A, 0xD7, 0x1E, 0x2D, 0x96, 0x9A, 0x9E, 0x90, 0xE9, 0xA9, 0x49,
+    0xFC, 0xAA, 0xFC, 0x95, 0x99, 0x9A, 0xF9, 0x99, 0x97, 0x19, 0xE9, 0x71, 0x9F, 0xFE, 0xA6, 0xFF,
+    0xE7, 0x29, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x49, 0xAF, 0xCA, 0x71, 0x9F, 0xF7, 0x00,
+    0x74, 0x9D, 0x4A, 0xCA, 0x4D, 0x94, 0xD5, 0xD4, 0x9C, 0xA4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD7,
+    0x77, 0x77, 0x39, 0xA9, 0x4A, 0xC9, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x94, 0xD5, 0xD4,
+    0x9D, 0x59, 0x94, 0x59, 0xAD, 0xA6, 0xAF, 0xD9, 0x3D, 0x91, 0x9D, 0xA2, 0xD9, 0x3A, 0xCA, 0x1E,
+    0x93, 0x9C, 0x90, 0x9C, 0xAD, 0x7A, 0xC0, 0xAC, 0xA6, 0xD1, 0xDA, 0x5D, 0x2A, 0xD4, 0xAC, 0x3A,
+    0xD9, 0x29, 0xD3, 0x9D, 0x92, 0xE3, 0x9D, 0x3E, 0x92, 0xD9, 0x3A, 0xD9, 0x1A, 0xC9, 0x49, 0xD9,
+    0x09, 0xC9, 0x59, 0xD0, 0xAC, 0x96, 0x9C, 0xAA, 0xC1, 0xA9, 0x4E, 0xA0, 0xDA, 0x4E, 0x90, 0xE3,
+    0x9D, 0xA1, 0xAE, 0xA9, 0xAD, 0xA3, 0xAF, 0xD9, 0x69, 0x99, 0x60, 0x09, 0xA3, 0x99, 0x09, 0xDA,
+    0x1A, 0xDA, 0xAD, 0xA1, 0xE9, 0x9C, 0xA2, 0xAC, 0xA0, 0x70, 0x99, 0x99, 0x76, 0x9F, 0xFA, 0x72,
+    0xEA, 0x91, 0x99, 0xAD, 0xA7, 0xDA, 0x70, 0xAC, 0xA5, 0xD9, 0x72, 0xAC, 0xA3, 0xAC, 0x93, 0x9A,
+    0xDA, 0x92, 0xAC, 0x92, 0xD3, 0xFD, 0xA3, 0xD1, 0xAC, 0x92, 0xD9, 0x2C, 0xA3, 0xAC, 0x1D, 0x29,
+    0xCA, 0x3C, 0x93, 0x9C, 0xA0, 0xD2, 0xAC, 0x97, 0x2C, 0xA0, 0xCA, 0x2D, 0x73, 0xD0, 0xCA, 0x2D,
+    0x73, 0xD0, 0xD2, 0xD9, 0x72, 0xCA, 0x0D, 0x2A, 0xD7, 0x19, 0xCA, 0x0A, 0xC9, 0x2D, 0xA9, 0x19,
+    0xA3, 0xAC, 0x2C, 0xA2, 0x9F, 0xE3, 0xD2, 0xAC, 0x93, 0x9A, 0xAA, 0x93, 0xAC, 0x93, 0xD9, 0x72,
+    0xAC, 0xA5, 0xD9, 0x70, 0xAD, 0x7E, 0xA9, 0x29, 0xAD, 0xA7, 0x19, 0xFF, 0xA7, 0x69, 0x99, 0x99,
+    0x70, 0x49, 0x96, 0x9F, 0xD2, 0x9D, 0x99, 0xDA, 0x2D, 0x91, 0xAC, 0x91, 0x9C, 0xA2, 0xD2, 0xAC,
+    0x92, 0xD2, 0xD2, 0xAC, 0xA2, 0xD1, 0x9D, 0x90, 0x90, 0xDA, 0xAC, 0xAC, 0xAC, 0x90, 0xAE, 0x90,
+    0xE2, 0x99, 0x29, 0x97, 0x5F, 0xFA, 0x0A, 0xFE, 0xA1, 0x49, 0xA3, 0x9A, 0x4A, 0xD2, 0xAD, 0x3E,
+    0x2E, 0x3E, 0x19, 0xE2, 0x9E, 0x19, 0xE3, 0xE9, 0x1E, 0x4E, 0x91, 0xE5, 0xE2, 0xDA, 0x5D, 0xA1,
+    0x9D, 0x95, 0xD2, 0x9D, 0x6A, 0x92, 0x9C, 0x20, 0x74, 0xFF, 0xF0, 0xFF, 0xF7, 0x2D, 0x72, 0xD7,
+    0x2D, 0x72, 0xD7, 0x50, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0x69, 0x99, 0x72, 0x9F,
+    0xE9, 0x6A, 0xCA, 0x4A, 0xCA, 0x4A, 0xC9, 0x69, 0xC9, 0x3C, 0x90, 0xFC, 0x91, 0xAC, 0x2A, 0xC2,
+    0xCA, 0x0D, 0x2C, 0xA1, 0xCA, 0x2C, 0xA0, 0xAC, 0x2A, 0xC1, 0xC9, 0x2D, 0x9C, 0xA2, 0xAC, 0x1C,
+    0x92, 0xF3, 0xAC, 0x1C, 0xA2, 0xCA, 0x0C, 0xA2, 0xAC, 0x1D, 0x2C, 0xA0, 0x9C, 0xA1, 0xCA, 0x19,
+    0xC1, 0xEA, 0x09, 0xC9, 0x9C, 0x92, 0xD7, 0x0C, 0xA4, 0xD9, 0x49, 0xD6, 0xAD, 0xAA, 0xAD, 0xA7,
+    0x19, 0xAA, 0xA9, 0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0x9F, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x75, 0xAF, 0x93, 0xFE, 0x91, 0xAC, 0xA2, 0xAD, 0x1D, 0x4D, 0x90, 0xD4, 0xD9, 0x0D, 0x93, 0xD1,
+    0xAD, 0x2A, 0xD2, 0xFE, 0x4A, 0xEA, 0x75, 0x4D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x5A, 0xAA,
+    0xAA, 0xDA, 0xAA, 0xAA, 0x0F, 0xFF, 0x19, 0x99, 0x9D, 0x99, 0x99, 0x95, 0xD7, 0x2D, 0x72, 0xD7,
+    0x2D, 0x72, 0x99, 0x77, 0x77, 0xFF, 0xF0, 0xFF, 0xF0, 0x39, 0xAD, 0xA4, 0xFE, 0x2A, 0xD9, 0x09,
+    0xD9, 0x1D, 0x3D, 0x91, 0x94, 0xD7, 0xDA, 0x6A, 0xD6, 0xDA, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6A,
+    0xFF, 0x90, 0xFF, 0xC7, 0x40, 0x39, 0xAC, 0xA9, 0x3F, 0xD9, 0x1A, 0xCA, 0x1A, 0xCA, 0x19, 0xA2,
+    0x9C, 0xA6, 0xD5, 0x9D, 0x93, 0xAF, 0x4A, 0xAA, 0xDA, 0x69, 0xD6, 0x9D, 0x6D, 0xA1, 0x99, 0x9A,
+    0xDA, 0x1A, 0xFC, 0x93, 0x9A, 0x99, 0x40, 0x39, 0x3D, 0xA1, 0xAD, 0x90, 0x9D, 0xA1, 0xDA, 0x1A,
+    0xC9, 0x29, 0x93, 0x77, 0x7A, 0xCA, 0x5D, 0x95, 0x9D, 0x94, 0xAD, 0x69, 0xD5, 0xE6, 0xAD, 0x5D,
+    0xA6, 0xDA, 0x5D, 0x96, 0xD9, 0x49, 0xD7, 0xD9, 0x4A, 0xD6, 0x9D, 0x5D, 0xA6, 0xAD, 0x5D, 0x96,
+    0xE4, 0x9D, 0x96, 0xE4, 0xE7, 0xE3, 0xAE, 0x95, 0x9E, 0xA1, 0xAC, 0xAA, 0xCA, 0x9A, 0xC2, 0xAF,
+    0xF0, 0x9F, 0xA2, 0xAC, 0x9F, 0xA2, 0xE9, 0x3D, 0x29, 0x59, 0x5D, 0x77, 0x9D, 0x77, 0xAD, 0x77,
+    0xE7, 0x7D, 0xA7, 0x7C, 0xA7, 0x77, 0x72, 0x77, 0x72, 0x9A, 0xFF, 0x69, 0xFF, 0xD9, 0x5A, 0xFD,
+    0x0A, 0xC7, 0x9F, 0xE0, 0xD7, 0xFE, 0xA0, 0xD6, 0x9F, 0xE9, 0x0C, 0xA6, 0xAF, 0xE0, 0x9C, 0x96,
+    0xFF, 0x0A, 0xC7, 0xFF, 0x0D, 0x7A, 0xFD, 0xA0, 0xD7, 0x9F, 0xD9, 0x0C, 0xA7, 0x0F, 0xD0, 0x9C,
+    0x97, 0x1A, 0xCA, 0xD0, 0xAC, 0x75, 0xD0, 0xD7, 0x5C, 0xA0, 0xD7, 0x49, 0xC9, 0x0C, 0xA7, 0x4A,
+    0xC0, 0x9C, 0x97, 0x4D, 0x0A, 0xC7, 0x5C, 0xA0, 0xD7, 0x49, 0xC9, 0x9C, 0x97, 0x4D, 0x9D, 0x70,
+    0x92, 0xAF, 0x70, 0xAD, 0xAD, 0xA9, 0x97, 0x19, 0xF9, 0x77, 0x77, 0x09, 0xD0, 0x9E, 0x9A, 0xE0,
+    0x9D, 0x95, 0x19, 0xA9, 0x19, 0xEA, 0x2D, 0xA2, 0xD9, 0x1A, 0xCA, 0x09, 0xDA, 0x19, 0x93, 0x49,
+    0xC9, 0x19, 0xF9, 0x1A, 0xF4, 0x9D, 0x4A, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4,
+    0xD9, 0x29, 0xAE, 0x90, 0x9F, 0xD7, 0x00, 0x59, 0x96, 0x9F, 0xA3, 0xAD, 0x99, 0xD9, 0x2D, 0x2A,
+    0xCA, 0x1A, 0xCA, 0x2A, 0xCA, 0x1D, 0x92, 0xDA, 0x1D, 0x3D, 0x2D, 0x2A, 0xD2, 0xDA, 0x0A, 0xD3,
+    0x9F, 0xC6, 0x99, 0x97, 0x7A, 0xFE, 0xA0, 0x9F, 0xEA, 0x10, 0x2A, 0x39, 0xA6, 0xD2, 0x9D, 0x59,
+    0xD2, 0xAD, 0x5E, 0x2D, 0xA4, 0x9E, 0x1A, 0xDA, 0x4E, 0x19, 0xE3, 0xE9, 0x1E, 0x92, 0xE9, 0x1E,
+    0x3A, 0xD2, 0xE3, 0xAD, 0x2D, 0xA4, 0xA9, 0x29, 0xC9, 0x40, 0x77, 0x77, 0x77, 0x0A, 0x97, 0x09,
+    0xAC, 0x97, 0x39, 0xD6, 0xAF, 0x97, 0x3D, 0x96, 0x9A, 0xAD, 0x73, 0xDA, 0x71, 0x9D, 0x72, 0xAD,
+    0x72, 0xAC, 0xA7, 0x19, 0xD7, 0x3D, 0xA7, 0x1D, 0x97, 0x3D, 0x97, 0x0A, 0xCA, 0x74, 0xD7, 0x09,
+    0xD6, 0xD9, 0x29, 0xD7, 0x0D, 0x6E, 0x3A, 0xCA, 0x7D, 0x95, 0xF3, 0xD9, 0x6A, 0xCA, 0x5D, 0x9D,
+    0x19, 0xFA, 0x49, 0xD5, 0xD9, 0x9C, 0xA0, 0x9F, 0xD4, 0xD5, 0xD9, 0x0A, 0xC9, 0x73, 0xD9, 0x4D,
+    0x91, 0xD7, 0x3A, 0xD4, 0xD9, 0x2D, 0x72, 0x9D, 0x4F, 0xFD, 0xA7, 0x0D, 0x94, 0xFF, 0xDA, 0x7D,
+    0xA7, 0x3A, 0xC9, 0x70, 0xAD, 0x74, 0xD7, 0x09, 0xD9, 0x74, 0xD7, 0x09, 0xCA, 0x77, 0x77, 0x76,
+    0x77, 0x77, 0x77, 0xC9, 0x71, 0x9A, 0xC9, 0x72, 0xAD, 0x7A, 0xF9, 0x71, 0x9D, 0x97, 0x9A, 0xAD,
+    0x72, 0xD9, 0x72, 0x9D, 0x71, 0xAC, 0xA7, 0x3A, 0xCA, 0x70, 0x9D, 0x74, 0xDA, 0x70, 0xD7, 0x5D,
+    0x97, 0xD9, 0x75, 0xD7, 0x9C, 0xA3, 0x9F, 0x93, 0x9D, 0x7D, 0x3A, 0xFD, 0x3A, 0xCA, 0x6D, 0x3A,
+    0xD9, 0x1D, 0xA2, 0xD9, 0x5A, 0xC9, 0x3D, 0x3A, 0xCA, 0x09, 0xFA, 0x39, 0xD7, 0x2D, 0x99, 0xFD,
+    0x3D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x1A, 0xD7, 0x2A, 0xCA, 0x71, 0xE7, 0x29, 0xD7, 0x1D, 0xA7,
+    0x3D, 0x97, 0x9D, 0x97, 0x3D, 0xA7, 0xAD, 0x74, 0xAD, 0x7A, 0xFF, 0xA5, 0x9D, 0x70, 0x9F, 0xF9,
+    0x59, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2C, 0x71, 0xAE, 0xA7, 0x3D, 0xA7, 0xFD, 0xA7,
+    0x1A, 0xD7, 0xAC, 0x91, 0xAC, 0xA7, 0x09, 0xD7, 0x19, 0x2A, 0xCA, 0x70, 0xD9, 0x75, 0xD7, 0x0A,
+    0xCA, 0x73, 0x9A, 0xD7, 0x09, 0xD7, 0x3F, 0xC7, 0x0D, 0x74, 0x99, 0x9E, 0x6D, 0x96, 0xD9, 0x59,
+    0xD5, 0x9C, 0xA6, 0xE6, 0xAD, 0x5D, 0x6F, 0x59, 0xD9, 0x4D, 0x6D, 0x9D, 0x09, 0x9A, 0xAE, 0xA4,
+    0xAC, 0x95, 0xD9, 0x9C, 0xA0, 0xAF, 0xA9, 0x49, 0xD5, 0xD9, 0x0A, 0xC9, 0x19, 0x97, 0x0D, 0x5D,
+    0x91, 0xD7, 0x4D, 0x94, 0xD9, 0x2D, 0x73, 0xAC, 0xA4, 0xFF, 0xDA, 0x70, 0x9D, 0x5F, 0xFD, 0xA7,
+    0x0D, 0x97, 0x3A, 0xC9, 0x71, 0xDA, 0x74, 0xD7, 0x1A, 0xD7, 0x5D, 0x71, 0xAC, 0x77, 0x77, 0x77,
+    0x00, 0x79, 0x69, 0xD9, 0x5E, 0x95, 0xE7, 0x97, 0x70, 0x9A, 0x95, 0x9E, 0xA4, 0xAA, 0xE6, 0x9D,
+    0x59, 0xD5, 0x9D, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0x9D, 0x6D, 0x95, 0x9D, 0x69, 0xD6, 0x9D, 0x92,
+    0xA9, 0x1F, 0xEA, 0x2F, 0xD4, 0xAD, 0xA2, 0x73, 0x97, 0x73, 0xAC, 0x97, 0x72, 0xEA, 0x77, 0x1A,
+    0xEA, 0x77, 0x2A, 0xDA, 0x77, 0x39, 0x97, 0x77, 0x77, 0x09, 0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77,
+    0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90, 0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D,
+    0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99,
+    0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD,
+    0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE, 0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4,
+    0x9F, 0xE9, 0x77, 0x19, 0x77, 0x29, 0xD7, 0x71, 0xF7, 0x7A, 0xF9, 0x76, 0xAE, 0xA7, 0x70, 0x99,
+    0x77, 0x77, 0x73, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D,
+    0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7,
+    0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7,
+    0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x76, 0x99, 0x77, 0x2E,
+    0x97, 0x70, 0xFC, 0x77, 0xDA, 0x0E, 0x74, 0x9D, 0xA2, 0xD9, 0x73, 0xD9, 0x4C, 0x77, 0x77, 0x69,
+    0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90,
+    0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72,
+    0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE,
+    0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x77, 0x77, 0x09, 0xE2, 0xC9, 0x74, 0xFC, 0x9D,
+    0x97, 0x3A, 0xCA, 0x0F, 0xC7, 0x49, 0xC1, 0x9E, 0x77, 0x77, 0x77, 0x75, 0x99, 0x77, 0x2E, 0x77,
+    0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1,
+    0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72,
+    0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69,
+    0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC,
+    0x99, 0xFE, 0x49, 0xFE, 0x90, 0x72, 0x99, 0x39, 0x97, 0x49, 0xDA, 0x19, 0xDA, 0x73, 0xEA, 0x1E,
+    0xA7, 0x3A, 0xD2, 0xAD, 0x77, 0x77, 0x77, 0x74, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9,
+    0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19,
+    0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E,
+    0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E,
+    0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE,
+    0x90, 0x75, 0x99, 0x77, 0x19, 0xFA, 0x77, 0xD9, 0x9D, 0x76, 0x9C, 0x91, 0x9C, 0x97, 0x5A, 0xC9,
+    0x1A, 0xC9, 0x75, 0x9D, 0x99, 0xD7, 0x7A, 0xF7, 0x72, 0x99, 0x77, 0x39, 0x97, 0x72, 0xE7, 0x71,
+    0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90, 0xAD, 0x75, 0x9D, 0x1A,
+    0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D,
+    0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x7D, 0xA6, 0x9D,
+    0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE, 0xA9, 0x59, 0xAF, 0xC9,
+    0x9F, 0xE4, 0x9F, 0xE9, 0x77, 0x77, 0x72, 0xFF, 0xFD, 0xA7, 0x59, 0xAF, 0xFF, 0x97, 0x6A, 0xF5,
+    0xD9, 0x75, 0x9F, 0xC5, 0xD7, 0x6D, 0x9D, 0xA5, 0xCA, 0x75, 0xD9, 0x9D, 0x97, 0x74, 0xAC, 0xA0,
+    0xAD, 0x77, 0x4A, 0xD1, 0xAD, 0x77, 0x39, 0xD2, 0xE1, 0x99, 0x99, 0x75, 0xD9, 0x2F, 0xFC, 0x74,
+    0xDA, 0x29, 0xFF, 0x97, 0x3A, 0xD9, 0x99, 0x9A, 0xD7, 0x71, 0x9F, 0xFD, 0x77, 0x1D, 0x99, 0x99,
+    0x99, 0xE7, 0x70, 0xD9, 0x5D, 0xA6, 0xA7, 0xAC, 0xA5, 0x9D, 0x95, 0xAC, 0x95, 0xAD, 0x6A, 0xD6,
+    0xD5, 0x9D, 0x7E, 0x49, 0xAD, 0x4A, 0xFA, 0x3A, 0xFF, 0xF9, 0x3F, 0xDA, 0x2F, 0xFF, 0xD3, 0x71,
+    0x99, 0x97, 0x3A, 0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39, 0xE3, 0xAD, 0xA6, 0x9D, 0x29, 0xDA,
+    0x7A, 0xCA, 0x2E, 0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76,
+    0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E, 0x71, 0x93, 0xF7, 0xAC, 0x92, 0x9F,
+    0xA9, 0x99, 0x9A, 0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74, 0x97, 0x70, 0xA9, 0x76, 0xF7, 0x59,
+    0xAD, 0x76, 0xAD, 0x75, 0x9D, 0x75, 0xE7, 0x6A, 0x97, 0x20, 0x71, 0x97, 0x70, 0x9C, 0xA7, 0x7A,
+    0xE7, 0x69, 0xF7, 0x7A, 0xE7, 0x70, 0x99, 0x77, 0x77, 0x75, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF,
+    0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E, 0x6C, 0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A,
+    0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC, 0x97, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6,
+    0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D, 0x5A, 0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF,
+    0xFF, 0xD3, 0x77, 0x97, 0x70, 0xD9, 0x75, 0xAE, 0x97, 0x39, 0xFA, 0x73, 0x9E, 0xA7, 0x59, 0x97,
+    0x77, 0x77, 0x70, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF, 0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E,
+    0x6C, 0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC,
+    0x97, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6, 0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D,
+    0x5A, 0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xD3, 0x74, 0x99, 0x77, 0xEA, 0x75,
+    0xFC, 0x97, 0x3E, 0x0E, 0x72, 0xE2, 0xAC, 0xA7, 0x0A, 0xCA, 0x4C, 0x97, 0x77, 0x77, 0x2A, 0xFF,
+    0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D,
+    0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD,
+    0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA,
+    0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x71, 0x94, 0x97, 0x19, 0xE2, 0xE7, 0x0A, 0xE1, 0xAE,
+    0x70, 0x9D, 0x91, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x5A, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D,
+    0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49,
+    0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6,
+    0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD,
+    0x30, 0x77, 0x2D, 0x71, 0x9E, 0x71, 0xF9, 0x70, 0x9E, 0x73, 0xA7, 0x77, 0x7A, 0xFE, 0x93, 0x9A,
+    0xFA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71,
+    0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x0A, 0xD7, 0xAF, 0xD9, 0x3A, 0xFE, 0x93, 0x73, 0x97, 0x3A, 0xCA, 0x70, 0x9E, 0xA7, 0xFC, 0x7E,
+    0xA9, 0x70, 0xA9, 0x77, 0x77, 0x4A, 0xFE, 0x94, 0x9A, 0xFA, 0x97, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD,
+    0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x0A, 0xFD, 0x94, 0xAF, 0xE9,
+    0x40, 0x70, 0x99, 0x73, 0xAD, 0xA7, 0x1A, 0xFA, 0x7A, 0xD9, 0xAD, 0x95, 0xAD, 0x2A, 0xD4, 0x9C,
+    0xA4, 0xAA, 0x77, 0x77, 0x2A, 0xFE, 0x95, 0x9A, 0xFA, 0x97, 0x09, 0xD9, 0x72, 0xAD, 0x73, 0xE7,
+    0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD9,
+    0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x71, 0xAF, 0xD9, 0x5A, 0xFE, 0x95,
+    0x59, 0x93, 0x99, 0x5E, 0x2E, 0x49, 0xE1, 0x9E, 0x5D, 0xA2, 0xDA, 0x77, 0x77, 0x77, 0x1A, 0xFE,
+    0x95, 0x9A, 0xFA, 0x97, 0x09, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97,
+    0x2A, 0xD7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7,
+    0x29, 0xD9, 0x72, 0xAD, 0x71, 0xAF, 0xD9, 0x5A, 0xFE, 0x95, 0x70, 0x99, 0x99, 0x97, 0x29, 0xFF,
+    0xE9, 0x7F, 0xDA, 0xAF, 0xD7, 0x09, 0xD9, 0x39, 0xF7, 0xAD, 0x6F, 0x6E, 0x7E, 0x95, 0xDA, 0x7A,
+    0xDA, 0x49, 0xD9, 0x79, 0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x1E, 0x1F, 0xFD, 0xA3, 0x9D, 0xA1,
+    0xFF, 0xD9, 0x39, 0xDA, 0x39, 0xD9, 0x70, 0xAD, 0x93, 0xAD, 0x97, 0x0E, 0x4A, 0xD7, 0x09, 0xDA,
+    0x4E, 0x70, 0xE5, 0xDA, 0x7E, 0x94, 0x9D, 0x96, 0xE9, 0x5A, 0xD9, 0x39, 0xAE, 0x94, 0xAF, 0xFF,
+    0xA5, 0xAF, 0xFD, 0xA9, 0x77, 0x74, 0x77, 0x77, 0x3A, 0xDA, 0x1A, 0xC7, 0x7A, 0xFA, 0x9D, 0x77,
+    0xD9, 0x9F, 0xA7, 0x7A, 0xA1, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAF, 0x96, 0xFE, 0x5A,
+    0xEA, 0x6A, 0xF9, 0x7A, 0xE7, 0x0D, 0x71, 0xAE, 0xA6, 0x9D, 0x71, 0xFC, 0x6A, 0xD7, 0x1D, 0xAD,
+    0x95, 0xDA, 0x70, 0x9D, 0x0E, 0x5D, 0x97, 0x0A, 0xD0, 0xAD, 0x94, 0xD7, 0x1D, 0xA1, 0xE3, 0x9D,
+    0x71, 0xD9, 0x1A, 0xD9, 0x2A, 0xD7, 0x1D, 0x3D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD2, 0xD9, 0x70,
+    0xAD, 0x39, 0xDA, 0x1D, 0x71, 0xDA, 0x4E, 0x09, 0xD7, 0x1D, 0x94, 0x9D, 0xAA, 0xCA, 0x71, 0xD6,
+    0xFC, 0xA7, 0x09, 0xD6, 0x9F, 0x97, 0x0A, 0xD7, 0xF7, 0x9A, 0xFA, 0x5A, 0xE6, 0x9F, 0xE6, 0xDA,
+    0x77, 0x77, 0x70, 0x97, 0x71, 0x9C, 0xA7, 0x70, 0xEA, 0x77, 0x9F, 0x77, 0x0A, 0xE7, 0x71, 0x99,
+    0x77, 0x77, 0x39, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94, 0xF4, 0xAD, 0xA7,
+    0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE0, 0x9D, 0xA7,
+    0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3A, 0xD9, 0x0E,
+    0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69, 0xE4, 0x9E, 0xA3,
+    0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x76, 0x97, 0x70, 0x9D, 0x77, 0xAE,
+    0x97, 0x49, 0xFA, 0x74, 0x9E, 0xA7, 0x69, 0x97, 0x77, 0x76, 0x99, 0x99, 0x74, 0xAF, 0xEA, 0x70,
+    0x9F, 0xFE, 0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92, 0x9D, 0xA7, 0x09, 0xE2, 0xE7, 0x2E, 0x1A,
+    0xD9, 0x72, 0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0A, 0xD9, 0x73, 0xE0,
+    0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE9, 0x72, 0xE1, 0xAD, 0x97, 0x1A, 0xD9, 0x19, 0xE7,
+    0x09, 0xDA, 0x3E, 0x96, 0x9E, 0x49, 0xEA, 0x39, 0xF6, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69,
+    0x97, 0x20, 0x73, 0x99, 0x77, 0x0E, 0x97, 0x6F, 0xC9, 0x74, 0xE0, 0xE7, 0x3D, 0xA2, 0xDA, 0x71,
+    0xAC, 0x94, 0xC9, 0x77, 0x77, 0x09, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94,
+    0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73,
+    0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7,
+    0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69,
+    0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x77, 0x74, 0xE9,
+    0x1C, 0x97, 0x2F, 0xC9, 0xAC, 0xA7, 0x19, 0xD0, 0xFC, 0x73, 0xC2, 0xE9, 0x77, 0x77, 0x77, 0x59,
+    0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94, 0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA,
+    0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9,
+    0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A,
+    0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69, 0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF,
+    0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x70, 0x94, 0x97, 0x29, 0xE1, 0x9E, 0x71, 0xAE, 0x1A,
+    0xE7, 0x1A, 0xD2, 0xAD, 0x77, 0x77, 0x77, 0x59, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6,
+    0xAE, 0x94, 0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E,
+    0x1E, 0x73, 0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D,
+    0xA0, 0xE7, 0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3,
+    0xE9, 0x69, 0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x74,
+    0xD5, 0xD1, 0xE3, 0xAD, 0x2E, 0x1A, 0xD4, 0xDA, 0xAD, 0x6F, 0x7A, 0xDA, 0x6A, 0xFA, 0x4A, 0xD1,
+    0xDA, 0x2A, 0xD3, 0xDA, 0x09, 0xD5, 0xD9, 0x09, 0x79, 0x00, 0x73, 0x99, 0x99, 0x49, 0x71, 0x9F,
+    0xEA, 0x1A, 0xC9, 0x69, 0xFF, 0xEA, 0xCA, 0x6A, 0xE9, 0x39, 0xFA, 0x6A, 0xDA, 0x7E, 0x95, 0x9D,
+    0xA7, 0xFC, 0x5E, 0x7D, 0xAE, 0x4A, 0xD9, 0x6D, 0xA0, 0xE4, 0xE6, 0xD9, 0x1E, 0x39, 0xDA, 0x5D,
+    0x92, 0xE3, 0xAD, 0x94, 0xD9, 0x3E, 0x3A, 0xD9, 0x3D, 0x94, 0xE3, 0xE2, 0x9D, 0x94, 0x9D, 0xA3,
+    0xE1, 0x9D, 0x95, 0xAD, 0x93, 0xE9, 0x9D, 0x7E, 0x4A, 0xFC, 0x7A, 0xD9, 0x49, 0xF7, 0x9D, 0xA6,
+    0xEA, 0x6A, 0xE6, 0xAF, 0xA3, 0x9F, 0x6A, 0xDA, 0xFF, 0xDA, 0x7D, 0x19, 0xAF, 0xDA, 0x77, 0x19,
+    0x74, 0x70, 0x97, 0x73, 0x9C, 0xA7, 0x72, 0xAD, 0xA7, 0x71, 0x9F, 0x77, 0x2A, 0xE7, 0x73, 0x99,
+    0x77, 0x77, 0x77, 0x4F, 0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D, 0x6D, 0xA7,
+    0x09, 0xD5, 0x9D, 0xA7, 0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D,
+    0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95,
+    0xE7, 0x09, 0xD6, 0xE7, 0x0A, 0xD6, 0xE7, 0x0D, 0xA6, 0xE7, 0x9D, 0x7E, 0x95, 0x9D, 0xA7, 0xAE,
+    0xA2, 0x9A, 0xDA, 0x71, 0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x97, 0x79, 0x97, 0x50, 0x76, 0x97, 0x72,
+    0x9D, 0x77, 0x1A, 0xE9, 0x76, 0x9F, 0xA7, 0x69, 0xEA, 0x77, 0x09, 0x97, 0x77, 0x77, 0x77, 0xFE,
+    0xA4, 0xFE, 0x1A, 0xFC, 0xA5, 0xAF, 0xA4, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xDA, 0x70,
+    0xAD, 0x59, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59,
+    0xD9, 0x70, 0xAC, 0xA5, 0xAD, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6E, 0x70,
+    0xAD, 0x6E, 0x70, 0xDA, 0x6E, 0x79, 0xD7, 0xE9, 0x59, 0xDA, 0x7A, 0xEA, 0x29, 0xAD, 0xA7, 0x1F,
+    0xFD, 0xA7, 0x3A, 0xFD, 0xA9, 0x77, 0x99, 0x75, 0x73, 0x99, 0x77, 0x2E, 0x97, 0x70, 0xFC, 0x97,
+    0x6E, 0x0E, 0x75, 0xE2, 0xDA, 0x73, 0xAC, 0xA4, 0xC9, 0x77, 0x77, 0x77, 0x1F, 0xEA, 0x4F, 0xE1,
+    0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7, 0x0A, 0xD5, 0x9D,
+    0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0x97, 0x0A,
+    0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7, 0x0A, 0xD6, 0xE7,
+    0x0D, 0xA6, 0xE7, 0x9D, 0x7E, 0x95, 0x9D, 0xA7, 0xAE, 0xA2, 0x9A, 0xDA, 0x71, 0xFF, 0xDA, 0x73,
+    0xAF, 0xDA, 0x97, 0x79, 0x97, 0x50, 0x70, 0x94, 0x97, 0x49, 0xE1, 0x9E, 0x73, 0xAE, 0x1A, 0xE7,
+    0x3A, 0xD2, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFE, 0xA4, 0xFE, 0x1A, 0xFC, 0xA5, 0xAF, 0xA4,
+    0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xDA, 0x70, 0xAD, 0x59, 0xD9, 0x70, 0xDA, 0x5A, 0xD7,
+    0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xD9, 0x70, 0xAC, 0xA5, 0xAD, 0x97, 0x0D,
+    0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6E, 0x70, 0xAD, 0x6E, 0x70, 0xDA, 0x6E, 0x79, 0xD7,
+    0xE9, 0x59, 0xDA, 0x7A, 0xEA, 0x29, 0xAD, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA9, 0x77, 0x99,
+    0x75, 0x75, 0x97, 0x71, 0xAC, 0xA7, 0x69, 0xEA, 0x75, 0xFC, 0x75, 0xEA, 0x97, 0x6A, 0x97, 0x77,
+    0x77, 0x71, 0xFF, 0x2F, 0xE9, 0x0A, 0xFC, 0xA3, 0x9F, 0xC9, 0x3E, 0x7D, 0xA5, 0xE6, 0xE6, 0x9D,
+    0xA4, 0xAD, 0x70, 0xE3, 0x9D, 0x97, 0x0A, 0xD3, 0xDA, 0x72, 0xDA, 0x1A, 0xD7, 0x3E, 0x09, 0xD7,
+    0x49, 0xDA, 0xD9, 0x75, 0xFA, 0x76, 0xAE, 0x77, 0xAD, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA,
+    0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x6A, 0xFD, 0xA7, 0x2F, 0xFA, 0x70, 0x77, 0x5A, 0xFE, 0x71, 0x9A,
+    0xFA, 0x74, 0x9D, 0x76, 0xAD, 0x97, 0x5F, 0xFA, 0x70, 0xEA, 0xAF, 0xC7, 0xD9, 0x3A, 0xDA, 0x59,
+    0xD5, 0xE5, 0xAD, 0x5A, 0xD5, 0xE5, 0xAD, 0x5D, 0xA5, 0xE4, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x49,
+    0xE5, 0xAD, 0x29, 0xAE, 0x6F, 0xFC, 0x97, 0xFD, 0xA9, 0x70, 0x9D, 0x97, 0x5A, 0xD7, 0x4A, 0xFC,
+    0xA7, 0x1A, 0xFE, 0x71, 0x77, 0x9A, 0xAA, 0x77, 0x0A, 0xFD, 0x97, 0x5E, 0xA9, 0xAE, 0x74, 0xAD,
+    0x39, 0xD9, 0x72, 0x9D, 0x94, 0xD9, 0x72, 0xAD, 0x5D, 0x73, 0xDA, 0x4A, 0xCA, 0x72, 0x9D, 0x94,
+    0xD7, 0x3A, 0xD4, 0xD7, 0x4E, 0x3A, 0xC9, 0x74, 0xDA, 0x29, 0xCA, 0x75, 0xD9, 0x2D, 0x97, 0x49,
+    0xD3, 0xE7, 0x4A, 0xD3, 0xAD, 0xA7, 0x3D, 0xA4, 0xEA, 0x72, 0xDA, 0x5E, 0x97, 0x09, 0xD9, 0x6E,
+    0x70, 0x9D, 0x7A, 0xD9, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x1A, 0x49, 0xD7, 0x0D, 0x90, 0xDA, 0x3D,
+    0x97, 0x9D, 0x1F, 0xF9, 0x70, 0xAD, 0x2A, 0xFC, 0x72, 0xE5, 0x97, 0x4D, 0x97, 0x72, 0x9D, 0x76,
+    0x93, 0xDA, 0x76, 0xDA, 0x9A, 0xD7, 0x7F, 0xD9, 0x77, 0x0A, 0xCA, 0xA7, 0x70, 0x77, 0x5A, 0xC7,
+    0x5E, 0x74, 0xE9, 0x74, 0xE7, 0x5A, 0xD7, 0x59, 0xC7, 0x77, 0x77, 0x19, 0xF9, 0x0A, 0xC9, 0x4A,
+    0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3,
+    0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3,
+    0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA,
+    0x29, 0xE5, 0x97, 0x30, 0x73, 0x97, 0x5D, 0x97, 0x3A, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0x97, 0x3D,
+    0x97, 0x49, 0x77, 0x77, 0x73, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39,
+    0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9,
+    0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99,
+    0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x70, 0xE7,
+    0x3F, 0x97, 0x1D, 0xAE, 0x70, 0xAD, 0x1D, 0x96, 0xAD, 0x2A, 0xCA, 0x6D, 0x4C, 0x97, 0x77, 0x76,
+    0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4,
+    0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49,
+    0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F,
+    0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x79, 0x74, 0xAE, 0x19, 0xC6, 0x9F, 0xC9, 0xD6,
+    0xAC, 0x90, 0xFA, 0x69, 0xA1, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC,
+    0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5,
+    0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC,
+    0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E,
+    0x59, 0x73, 0x59, 0x93, 0x99, 0x6A, 0xDA, 0x1E, 0x95, 0xE9, 0x1E, 0x6A, 0xCA, 0x2A, 0xC9, 0x77,
+    0x77, 0x77, 0x69, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D,
+    0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E,
+    0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA,
+    0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x30, 0x7A, 0xDA, 0x72, 0xAF, 0xA7,
+    0x09, 0xCA, 0x1D, 0x70, 0xAC, 0x91, 0xD7, 0x0A, 0xC9, 0x1D, 0x70, 0xAD, 0x9A, 0xCA, 0x71, 0xFA,
+    0x73, 0x99, 0x77, 0x72, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9,
+    0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A,
+    0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0,
+    0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x72, 0xAF, 0x91,
+    0x9F, 0x94, 0x9F, 0xFE, 0xAE, 0x3A, 0xDA, 0x2A, 0xE9, 0x2D, 0x91, 0x9D, 0xA4, 0xD9, 0x3D, 0x91,
+    0xDA, 0x4A, 0xD3, 0xAD, 0x1A, 0xD5, 0xD9, 0x2A, 0xD9, 0x1D, 0xA4, 0xAD, 0x19, 0xE9, 0x19, 0xD9,
+    0x4E, 0x9F, 0x3A, 0xD4, 0xAF, 0xCA, 0x94, 0xAD, 0x4F, 0x97, 0xE3, 0xFA, 0x70, 0xE2, 0xAC, 0x9E,
+    0x49, 0xC9, 0x0A, 0xDA, 0x9A, 0xCA, 0x0E, 0xA1, 0x9A, 0xD1, 0x9F, 0xD1, 0x9F, 0xF3, 0xFA, 0x39,
+    0xFC, 0x96, 0x97, 0x09, 0x60, 0x77, 0x09, 0xFA, 0x4F, 0xE3, 0xE9, 0x99, 0xD2, 0xAD, 0x79, 0xD7,
+    0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x70, 0xAD, 0x94, 0xC9, 0x09, 0xE9,
+    0x09, 0xAD, 0x2F, 0xF4, 0xFC, 0x97, 0x97, 0x19, 0xA9, 0x79, 0xEA, 0x70, 0xDA, 0x70, 0xD9, 0x7A,
+    0xCA, 0x69, 0xDA, 0x79, 0x97, 0x00, 0x77, 0x0A, 0xC7, 0x09, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x1D,
+    0xA7, 0x1A, 0xA7, 0x77, 0x69, 0xFA, 0x4A, 0xDA, 0xE9, 0x2D, 0xA2, 0xDA, 0x1A, 0xCA, 0x3D, 0xA0,
+    0x9D, 0x39, 0xD9, 0x0D, 0xA2, 0x9D, 0xA1, 0xD9, 0x1A, 0xDA, 0x19, 0xD9, 0xF9, 0x2A, 0xFC, 0x94,
+    0xE9, 0x7E, 0x70, 0xAD, 0x5A, 0xA0, 0x9D, 0xA1, 0x9A, 0xD9, 0x1F, 0xF9, 0x29, 0xFC, 0xA7, 0x96,
+    0x71, 0x99, 0x72, 0xD7, 0x1E, 0x70, 0xAD, 0x97, 0x9D, 0x97, 0x0D, 0x72, 0xA7, 0x77, 0x73, 0x9F,
+    0xA5, 0xAD, 0xAE, 0x93, 0xDA, 0x2D, 0xA2, 0xAC, 0xA3, 0xDA, 0x19, 0xD3, 0x9D, 0x91, 0xDA, 0x29,
+    0xDA, 0x2D, 0x91, 0xAD, 0xA2, 0x9D, 0x9F, 0x93, 0xAF, 0xC9, 0x5E, 0x97, 0x0E, 0x71, 0xAD, 0x5A,
+    0xA1, 0x9D, 0xA1, 0x9A, 0xD9, 0x2F, 0xF9, 0x39, 0xFC, 0xA7, 0x09, 0x70, 0x77, 0x39, 0xDA, 0x70,
+    0xF9, 0x6D, 0xAE, 0x5D, 0xA0, 0x9D, 0x4A, 0xD2, 0xAC, 0x93, 0xCA, 0x4C, 0x77, 0x77, 0x9F, 0xA5,
+    0xAD, 0xAE, 0x93, 0xDA, 0x2D, 0xA2, 0xAC, 0xA3, 0xDA, 0x19, 0xD3, 0x9D, 0x91, 0xDA, 0x29, 0xDA,
+    0x2D, 0x91, 0xAD, 0xA2, 0x9D, 0x9F, 0x93, 0xAF, 0xC9, 0x5E, 0x97, 0x0E, 0x71, 0xAD, 0x5A, 0xA1,
+    0x9D, 0xA1, 0x9A, 0xD9, 0x2F, 0xF9, 0x39, 0xFC, 0xA7, 0x09, 0x70, 0x49, 0x93, 0x99, 0x4A, 0xD9,
+    0x1E, 0x4E, 0x90, 0x9E, 0x4A, 0xC9, 0x2D, 0x97, 0x77, 0x77, 0x79, 0xFA, 0x6A, 0xDA, 0xE9, 0x4D,
+    0xA2, 0xDA, 0x3A, 0xCA, 0x3D, 0xA2, 0x9D, 0x39, 0xD9, 0x2D, 0xA2, 0x9D, 0xA3, 0xD9, 0x1A, 0xDA,
+    0x39, 0xD9, 0xF9, 0x4A, 0xFC, 0x96, 0xE9, 0x71, 0xE7, 0x2A, 0xD5, 0xAA, 0x29, 0xDA, 0x19, 0xAD,
+    0x93, 0xFF, 0x94, 0x9F, 0xCA, 0x71, 0x97, 0x00, 0x72, 0xCA, 0x4A, 0xD9, 0x39, 0xE4, 0x9D, 0xA4,
+    0x9D, 0x95, 0xC9, 0x77, 0x09, 0xAE, 0x19, 0xFC, 0x93, 0x9D, 0x4A, 0xD4, 0xDA, 0x39, 0xD9, 0x3A,
+    0xD4, 0xE4, 0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xDA, 0x09, 0xC1, 0xDA, 0xAD, 0x09, 0xFC, 0x2E, 0xA7,
+    0x20, 0x79, 0x70, 0x9D, 0x7E, 0x6E, 0x6A, 0xD6, 0x9D, 0x70, 0xA7, 0x77, 0x39, 0xAE, 0x49, 0xFC,
+    0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xDA,
+    0x09, 0xC4, 0xDA, 0xAD, 0x39, 0xFC, 0x5E, 0xA7, 0x70, 0x77, 0xAD, 0x95, 0x9F, 0x49, 0xD9, 0xD9,
+    0x3D, 0x90, 0xAD, 0x2D, 0x92, 0xD1, 0x9C, 0x93, 0x9A, 0x77, 0x79, 0xAE, 0x49, 0xFC, 0x96, 0x9D,
+    0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xDA, 0x09, 0xC4,
+    0xDA, 0xAD, 0x39, 0xFC, 0x5E, 0xA7, 0x70, 0x29, 0x93, 0x92, 0xE2, 0xE0, 0x9E, 0x1A, 0xDA, 0x1D,
+    0x29, 0xCA, 0x77, 0x77, 0x29, 0xAE, 0x49, 0xFC, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A,
+    0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xDA, 0x09, 0xC4, 0xDA, 0xAD, 0x39, 0xFC, 0x5E, 0xA7,
+    0x70, 0x77, 0x59, 0xC3, 0x97, 0xE1, 0xD9, 0x7F, 0xC7, 0x2E, 0x71, 0x9F, 0xA7, 0x9C, 0xA0, 0x9D,
+    0x70, 0x92, 0xDA, 0x73, 0x9D, 0x6A, 0xF9, 0xD4, 0x9F, 0xFC, 0x92, 0x9D, 0xA2, 0x9E, 0x92, 0xDA,
+    0x4A, 0xDA, 0x1E, 0x59, 0xDA, 0x1D, 0xA6, 0xD9, 0x0A, 0xD7, 0xD9, 0x0E, 0x69, 0xD1, 0xE6, 0xAD,
+    0x1E, 0x6D, 0xA1, 0xE5, 0x9D, 0x2E, 0x5D, 0xA2, 0xAD, 0xA2, 0x9D, 0xA4, 0xFF, 0xA6, 0xAF, 0xC9,
+    0x71, 0x97, 0x00, 0x79, 0x74, 0xAE, 0x19, 0xC6, 0x9F, 0xC9, 0xD6, 0xD9, 0x0F, 0xA6, 0x9A, 0x19,
+    0xDA, 0x77, 0x77, 0x77, 0x3A, 0xEA, 0x29, 0xEA, 0x1A, 0xFC, 0x1A, 0xFC, 0x93, 0xDA, 0x0A, 0xD9,
+    0xAD, 0x93, 0xD9, 0xAC, 0xA1, 0x9D, 0x93, 0xDA, 0xCA, 0x29, 0xD3, 0x9F, 0x3A, 0xD3, 0xAE, 0x4D,
+    0xA3, 0xEA, 0x4D, 0x93, 0xE4, 0x9D, 0x39, 0xDA, 0x4A, 0xD3, 0x9D, 0x5D, 0xA3, 0xAD, 0x5D, 0x90,
+    0xAA, 0x0D, 0xA4, 0x9D, 0xAD, 0xA0, 0xD9, 0x49, 0xFA, 0x09, 0xD5, 0x9E, 0x97, 0x71, 0x77, 0x3A,
+    0xC7, 0x3E, 0x72, 0xAD, 0xA7, 0x2E, 0x73, 0xAD, 0x73, 0x9C, 0x77, 0x77, 0x39, 0xFC, 0x95, 0xFF,
+    0x93, 0xE9, 0x19, 0xE2, 0xE4, 0xAD, 0x90, 0x9D, 0x94, 0x9D, 0xA0, 0xE6, 0xDA, 0x9D, 0x95, 0x9D,
+    0x9A, 0xD6, 0x9D, 0x9A, 0xD6, 0xAD, 0x0E, 0x6D, 0xA0, 0xE5, 0xAD, 0x90, 0xAD, 0x93, 0x9D, 0xA1,
+    0x9E, 0x29, 0xE3, 0xFF, 0xC5, 0xAF, 0xC9, 0x70, 0x97, 0x00, 0x73, 0x97, 0x3D, 0x97, 0x1A, 0xD9,
+    0x70, 0x9D, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x29, 0x97, 0x77, 0x74, 0x9F, 0xC9, 0x5F, 0xF9, 0x3E,
+    0x91, 0x9E, 0x2E, 0x4A, 0xD9, 0x09, 0xD9, 0x49, 0xDA, 0x0E, 0x6D, 0xA9, 0xD9, 0x59, 0xD9, 0xAD,
+    0x69, 0xD9, 0xAD, 0x6A, 0xD0, 0xE6, 0xDA, 0x0E, 0x5A, 0xD9, 0x0A, 0xD9, 0x39, 0xDA, 0x19, 0xE2,
+    0x9E, 0x3F, 0xFC, 0x5A, 0xFC, 0x97, 0x09, 0x70, 0x77, 0x6E, 0x71, 0xF9, 0x7A, 0xCA, 0xAD, 0x6A,
+    0xD1, 0xD9, 0x49, 0xD2, 0xAC, 0xA4, 0xD4, 0xC9, 0x77, 0x77, 0x09, 0xFC, 0x95, 0xFF, 0x93, 0xE9,
+    0x19, 0xE2, 0xE4, 0xAD, 0x90, 0x9D, 0x94, 0x9D, 0xA0, 0xE6, 0xDA, 0x9D, 0x95, 0x9D, 0x9A, 0xD6,
+    0x9D, 0x9A, 0xD6, 0xAD, 0x0E, 0x6D, 0xA0, 0xE5, 0xAD, 0x90, 0xAD, 0x93, 0x9D, 0xA1, 0x9E, 0x29,
+    0xE3, 0xFF, 0xC5, 0xAF, 0xC9, 0x70, 0x97, 0x00, 0x79, 0x73, 0xAE, 0x19, 0xC5, 0x9F, 0xC9, 0xD5,
+    0xAC, 0x90, 0xFA, 0x59, 0xA1, 0x9D, 0xA7, 0x77, 0x77, 0x73, 0x9F, 0xC9, 0x6F, 0xF9, 0x4E, 0x91,
+    0x9E, 0x3E, 0x4A, 0xD9, 0x19, 0xD9, 0x49, 0xDA, 0x1E, 0x6D, 0xA0, 0x9D, 0x95, 0x9D, 0x90, 0xAD,
+    0x69, 0xD9, 0x0A, 0xD6, 0xAD, 0x1E, 0x6D, 0xA1, 0xE5, 0xAD, 0x91, 0xAD, 0x93, 0x9D, 0xA2, 0x9E,
+    0x29, 0xE4, 0xFF, 0xC6, 0xAF, 0xC9, 0x71, 0x97, 0x10, 0x59, 0xA3, 0x99, 0x5A, 0xDA, 0x1A, 0xD9,
+    0x4E, 0x91, 0xE9, 0x4A, 0xCA, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x29, 0xFC, 0x96, 0xFF, 0x94, 0xE9,
+    0x19, 0xE3, 0xE4, 0xAD, 0x91, 0x9D, 0x94, 0x9D, 0xA1, 0xE6, 0xDA, 0x09, 0xD9, 0x59, 0xD9, 0x0A,
+    0xD6, 0x9D, 0x90, 0xAD, 0x6A, 0xD1, 0xE6, 0xDA, 0x1E, 0x5A, 0xD9, 0x1A, 0xD9, 0x39, 0xDA, 0x29,
+    0xE2, 0x9E, 0x4F, 0xFC, 0x6A, 0xFC, 0x97, 0x19, 0x71, 0x59, 0x71, 0x9D, 0xA7, 0x0A, 0xE7, 0x09,
+    0xD9, 0x77, 0x76, 0xFF, 0xF0, 0xFF, 0xF7, 0x77, 0x7A, 0xA7, 0x1A, 0xDA, 0x70, 0xAD, 0xA7, 0x1A,
+    0xA5, 0x77, 0x72, 0x9F, 0xC9, 0x09, 0xC9, 0x6F, 0xFA, 0xD6, 0xE9, 0x19, 0xEA, 0x6E, 0x4E, 0x95,
+    0x9D, 0x93, 0xFA, 0x5E, 0x3D, 0xAD, 0xA4, 0x9D, 0x92, 0xD9, 0x9D, 0x94, 0xAD, 0x19, 0xD1, 0x9D,
+    0x94, 0xAD, 0x09, 0xD2, 0xAD, 0x5E, 0xAC, 0xA3, 0xE5, 0xFA, 0x3A, 0xD9, 0x5A, 0xDA, 0x39, 0xDA,
+    0x6E, 0xA2, 0x9E, 0x59, 0xFF, 0xE6, 0xD1, 0xAF, 0xC9, 0x77, 0x71, 0x77, 0x59, 0xC9, 0x74, 0xE7,
+    0x4A, 0xDA, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x59, 0xC7, 0x77, 0x75, 0xAF, 0x59, 0xD0, 0xAF, 0xC5,
+    0xDA, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xDA, 0x3A, 0xD5, 0xD9,
+    0x3E, 0x4A, 0xD4, 0xD9, 0x4E, 0x39, 0xD4, 0xAD, 0xA3, 0xAD, 0x39, 0xEA, 0x3A, 0xD2, 0x9C, 0xAA,
+    0xC9, 0x09, 0xC0, 0xE9, 0x0A, 0xD0, 0xDA, 0xAC, 0xA0, 0xAF, 0xD1, 0xFC, 0x2F, 0xA2, 0xAD, 0xA5,
+    0x97, 0x20, 0x73, 0x97, 0x5A, 0xCA, 0x73, 0xAD, 0x97, 0x29, 0xDA, 0x73, 0xDA, 0x73, 0xAC, 0xA7,
+    0x49, 0x97, 0x77, 0x76, 0xAF, 0x59, 0xD0, 0xAF, 0xC5, 0xDA, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0x9D,
+    0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xDA, 0x3A, 0xD5, 0xD9, 0x3E, 0x4A, 0xD4, 0xD9, 0x4E, 0x39, 0xD4,
+    0xAD, 0xA3, 0xAD, 0x39, 0xEA, 0x3A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC0, 0xE9, 0x0A, 0xD0, 0xDA,
+    0xAC, 0xA0, 0xAF, 0xD1, 0xFC, 0x2F, 0xA2, 0xAD, 0xA5, 0x97, 0x20, 0x77, 0x70, 0xE7, 0x3A, 0xEA,
+    0x71, 0xAD, 0xAD, 0x70, 0x9D, 0x1D, 0xA6, 0x9D, 0x29, 0xD6, 0xAC, 0x4A, 0x97, 0x77, 0x72, 0xAF,
+    0x59, 0xD0, 0xAF, 0xC5, 0xDA, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94,
+    0xDA, 0x3A, 0xD5, 0xD9, 0x3E, 0x4A, 0xD4, 0xD9, 0x4E, 0x39, 0xD4, 0xAD, 0xA3, 0xAD, 0x39, 0xEA,
+    0x3A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC0, 0xE9, 0x0A, 0xD0, 0xDA, 0xAC, 0xA0, 0xAF, 0xD1, 0xFC,
+    0x2F, 0xA2, 0xAD, 0xA5, 0x97, 0x20, 0x59, 0xA3, 0x99, 0x69, 0xE1, 0xAD, 0xA5, 0xAD, 0xA1, 0xE9,
+    0x59, 0xCA, 0x2A, 0xCA, 0x77, 0x77, 0x77, 0x2A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD, 0x49,
+    0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD, 0x4D,
+    0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x0E,
+    0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x75, 0x97,
+    0x7A, 0xCA, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xDA, 0x75, 0xAC, 0xA7, 0x69, 0x97, 0x77, 0x77,
+    0x59, 0xAD, 0x94, 0xE3, 0x9F, 0xC4, 0xAD, 0xA5, 0xAD, 0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D,
+    0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92, 0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC,
+    0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C, 0xA7, 0x29, 0xCA, 0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE,
+    0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x5D, 0x97, 0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7, 0x29,
+    0xFA, 0x74, 0xAC, 0xA7, 0x50, 0x79, 0x99, 0x74, 0xFC, 0x73, 0x9A, 0xAE, 0x76, 0xAD, 0x76, 0xDA,
+    0x76, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0xAC, 0xA1, 0x9E, 0x97, 0xD9, 0x0A, 0xFC, 0x96, 0xD0,
+    0xDA, 0x9A, 0xDA, 0x59, 0xDA, 0xC9, 0x2E, 0x5A, 0xEA, 0x3E, 0x5F, 0x4E, 0x5E, 0x5D, 0xA4, 0x9D,
+    0xA5, 0xD9, 0x4A, 0xD5, 0xAD, 0x5E, 0x5D, 0xA5, 0xD9, 0x49, 0xD9, 0x5D, 0x5D, 0xA5, 0x9D, 0xA2,
+    0x9E, 0x6A, 0xFF, 0xC7, 0xDA, 0xFC, 0x97, 0x0D, 0x91, 0x97, 0x29, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7,
+    0x59, 0xDA, 0x74, 0xFF, 0x71, 0xAA, 0xAA, 0xAA, 0xA9, 0x70, 0x79, 0xA3, 0x99, 0x70, 0x9E, 0x1A,
+    0xDA, 0x7A, 0xDA, 0x1E, 0x97, 0x9C, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x39, 0xAD, 0x94, 0xE3,
+    0x9F, 0xC4, 0xAD, 0xA5, 0xAD, 0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D, 0x96, 0xAD, 0x39, 0xD7,
+    0x0D, 0x92, 0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x71, 0xAC,
+    0xA0, 0x9C, 0xA7, 0x29, 0xCA, 0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E,
+    0x75, 0x9D, 0x97, 0x5D, 0x97, 0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7, 0x29, 0xFA, 0x74, 0xAC, 0xA7,
+    0x50, 0x72, 0xAA, 0xAA, 0xAA, 0xAA, 0x74, 0x9F, 0xF7, 0x5A, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77,
+    0x77, 0x49, 0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7,
+    0x6D, 0x90, 0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4,
+    0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9,
+    0x29, 0xAE, 0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x5A, 0xAA, 0xAA, 0xAA, 0x96, 0xAF,
+    0xF7, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x69, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD,
+    0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2,
+    0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09,
+    0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97,
+    0x30, 0x77, 0x77, 0x0D, 0x49, 0xA7, 0x39, 0xDA, 0x2A, 0xC9, 0x74, 0xFE, 0xA7, 0x6F, 0xC9, 0x77,
+    0x09, 0x99, 0x77, 0x77, 0x71, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD,
+    0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD,
+    0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9,
+    0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E,
+    0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x77, 0x5C,
+    0xA4, 0xA9, 0x59, 0xD9, 0x2D, 0x7F, 0xE9, 0x79, 0xFC, 0x97, 0x29, 0x97, 0x77, 0x77, 0x29, 0xF9,
+    0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3,
+    0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E,
+    0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90,
+    0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x30, 0x75, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9,
+    0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19,
+    0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E,
+    0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E,
+    0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE,
+    0x97, 0x70, 0xD9, 0x77, 0x1D, 0x77, 0x2D, 0x97, 0x72, 0xDA, 0x77, 0x2F, 0xCA, 0x77, 0x0E, 0xA7,
+    0x77, 0x77, 0x49, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D,
+    0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E,
+    0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA,
+    0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x95, 0xD7, 0x4A, 0xC9, 0x74, 0xD7, 0x49,
+    0xD7, 0x49, 0xFA, 0x72, 0xAE, 0x97, 0x71, 0x76, 0x97, 0x7D, 0x97, 0x4A, 0xE9, 0x72, 0x9F, 0xA7,
+    0x29, 0xEA, 0x75, 0x97, 0x77, 0x72, 0x99, 0x97, 0x3A, 0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39,
+    0xE3, 0xAD, 0xA6, 0x9D, 0x29, 0xDA, 0x7A, 0xCA, 0x2E, 0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D,
+    0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E,
+    0x71, 0x93, 0xF7, 0xAC, 0x92, 0x9F, 0xA9, 0x99, 0x9A, 0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74,
+    0x97, 0x10, 0x71, 0x99, 0x72, 0xD7, 0x1E, 0x70, 0xAD, 0x97, 0x9D, 0x97, 0x0D, 0x72, 0xA7, 0x77,
+    0x73, 0x9F, 0xA5, 0xFE, 0x4E, 0x99, 0x9D, 0x3A, 0xD7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09,
+    0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x1A, 0xD9, 0x4C, 0x91, 0x9E, 0x90, 0x9A, 0xD3, 0xFF, 0x5F,
+    0xC9, 0x70, 0x97, 0x73, 0x99, 0x76, 0xEA, 0x74, 0xFC, 0x97, 0x2E, 0x0A, 0xD9, 0x70, 0xE2, 0xAC,
+    0xA7, 0xAC, 0xA4, 0xA9, 0x77, 0x74, 0x99, 0x97, 0x3A, 0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39,
+    0xE3, 0xAD, 0xA6, 0x9D, 0x29, 0xDA, 0x7A, 0xCA, 0x2E, 0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D,
+    0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E,
+    0x71, 0x93, 0xF7, 0xAC, 0x92, 0x9F, 0xA9, 0x99, 0x9A, 0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74,
+    0x97, 0x10, 0x77, 0x39, 0xDA, 0x70, 0xF9, 0x6D, 0xAE, 0x5D, 0xA0, 0x9D, 0x4A, 0xD2, 0xAC, 0x93,
+    0xCA, 0x4C, 0x77, 0x77, 0x9F, 0xA5, 0xFE, 0x4E, 0x99, 0x9D, 0x3A, 0xD7, 0x09, 0xD7, 0x1D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x1A, 0xD9, 0x4C, 0x91, 0x9E, 0x90, 0x9A,
+    0xD3, 0xFF, 0x5F, 0xC9, 0x70, 0x97, 0x77, 0x74, 0xAD, 0x75, 0x9E, 0x75, 0xAE, 0x75, 0x9C, 0xA7,
+    0x77, 0x77, 0x72, 0x99, 0x97, 0x3A, 0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39, 0xE3, 0xAD, 0xA6,
+    0x9D, 0x29, 0xDA, 0x7A, 0xCA, 0x2E, 0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD9,
+    0x75, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E, 0x71, 0x93, 0xF7,
+    0xAC, 0x92, 0x9F, 0xA9, 0x99, 0x9A, 0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74, 0x97, 0x10, 0x7A,
+    0xC7, 0x0E, 0x96, 0x9E, 0x70, 0xD9, 0x77, 0x77, 0x72, 0x9F, 0xA4, 0xFE, 0x3E, 0x99, 0x9D, 0x2A,
+    0xD7, 0x9D, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x0A, 0xD9, 0x4C,
+    0x90, 0x9E, 0x90, 0x9A, 0xD2, 0xFF, 0x4F, 0xC9, 0x79, 0x60, 0x7A, 0x94, 0xAC, 0x96, 0x9D, 0x92,
+    0xAD, 0x70, 0xE1, 0xE7, 0x19, 0xFD, 0x73, 0x9F, 0x75, 0xAC, 0xA7, 0x77, 0x70, 0x99, 0x97, 0x3A,
+    0xFF, 0x95, 0xAF, 0xFE, 0x4A, 0xE9, 0x39, 0xE3, 0xAD, 0xA6, 0x9D, 0x29, 0xDA, 0x7A, 0xCA, 0x2E,
+    0x70, 0xAC, 0x2A, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xAD, 0x76, 0xAD,
+    0x76, 0xAD, 0x97, 0x5A, 0xDA, 0x75, 0x9E, 0x71, 0x93, 0xF7, 0xAC, 0x92, 0x9F, 0xA9, 0x99, 0x9A,
+    0xE4, 0x9F, 0xFD, 0xA7, 0xAF, 0xDA, 0x74, 0x97, 0x10, 0x73, 0x94, 0x9C, 0xA2, 0x9D, 0x93, 0x9D,
+    0x2D, 0x95, 0xDA, 0x0D, 0x96, 0x9F, 0xA7, 0x0E, 0xA7, 0x2A, 0xA7, 0x77, 0x75, 0x9F, 0xA6, 0xFE,
+    0x5E, 0x99, 0x9D, 0x4A, 0xD7, 0x19, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2A, 0xD9, 0x4C, 0x92, 0x9E, 0x90, 0x9A, 0xD4, 0xFF, 0x6F, 0xC9, 0x71, 0x97, 0x00,
+    0x70, 0x9C, 0x5C, 0xA7, 0x2E, 0x29, 0xDA, 0x72, 0x9D, 0xA0, 0x9D, 0x97, 0x4A, 0xDA, 0xD9, 0x76,
+    0xF9, 0x77, 0x0D, 0x97, 0x77, 0x73, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xE9, 0x7F, 0xDA, 0xAF, 0xD7,
+    0x09, 0xD9, 0x39, 0xF7, 0xAD, 0x6F, 0x6E, 0x7E, 0x95, 0xDA, 0x7A, 0xDA, 0x49, 0xDA, 0x79, 0xE4,
+    0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x1E, 0x4E, 0x70, 0x9D, 0xA4, 0xDA, 0x70, 0x9D, 0xA3, 0x9D, 0x97,
+    0x0A, 0xD9, 0x3A, 0xD9, 0x70, 0xE4, 0xAD, 0x70, 0x9D, 0xA4, 0xE7, 0x0E, 0x5D, 0xA7, 0xE9, 0x49,
+    0xD9, 0x6E, 0x95, 0xAD, 0x93, 0x9A, 0xE9, 0x4A, 0xFF, 0xFA, 0x5A, 0xFF, 0xDA, 0x97, 0x77, 0x40,
+    0x77, 0x1A, 0xA7, 0x72, 0xD9, 0x74, 0x99, 0x2D, 0x72, 0xFC, 0x90, 0x9D, 0x71, 0x9A, 0xAE, 0x90,
+    0xAC, 0x97, 0x4A, 0xD1, 0xD7, 0x5A, 0xD1, 0xC9, 0x75, 0xDA, 0x77, 0x1D, 0x97, 0x70, 0x9D, 0x74,
+    0xAE, 0x9A, 0xD7, 0x29, 0xFF, 0xA7, 0x19, 0xDA, 0x1A, 0xEA, 0x70, 0x9D, 0x93, 0x9D, 0x97, 0x0D,
+    0xA4, 0x9D, 0x70, 0x9D, 0x5A, 0xD7, 0x0D, 0xA5, 0xDA, 0x70, 0xD9, 0x49, 0xD9, 0x79, 0xD5, 0xE7,
+    0x0A, 0xD4, 0x9E, 0x70, 0xAD, 0x4E, 0xA7, 0x0E, 0x3D, 0xAC, 0xA0, 0x9C, 0x5A, 0xDA, 0x99, 0xD0,
+    0xAC, 0xA9, 0xD5, 0x9F, 0xD9, 0x0A, 0xF7, 0xAE, 0xA2, 0x9E, 0x72, 0x97, 0x70, 0x70, 0x99, 0x99,
+    0x97, 0x29, 0xFF, 0xE9, 0x7F, 0xDA, 0xAF, 0xD7, 0x09, 0xD9, 0x39, 0xF7, 0xAD, 0x6F, 0x6E, 0x7E,
+    0x95, 0xDA, 0x7A, 0xDA, 0x49, 0xD9, 0x79, 0xE4, 0x9D, 0x97, 0x0E, 0x4A, 0xD7, 0x1E, 0x1F, 0xFD,
+    0xA3, 0x9D, 0xA1, 0xFF, 0xD9, 0x39, 0xDA, 0x39, 0xD9, 0x70, 0xAD, 0x93, 0xAD, 0x97, 0x0E, 0x4A,
+    0xD7, 0x09, 0xDA, 0x4E, 0x70, 0xE5, 0xDA, 0x7E, 0x94, 0x9D, 0x96, 0xE9, 0x5A, 0xD9, 0x39, 0xAE,
+    0x94, 0xAF, 0xFF, 0xA5, 0xAF, 0xFD, 0xA9, 0x77, 0x74, 0x74, 0x99, 0x74, 0xFC, 0x97, 0x29, 0xAA,
+    0xE9, 0x75, 0x9D, 0x76, 0xAD, 0x72, 0xAF, 0xF7, 0x09, 0x99, 0xAD, 0xA9, 0x97, 0x39, 0xD7, 0x19,
+    0xAA, 0x90, 0x9D, 0x70, 0xFF, 0xA6, 0x9E, 0x99, 0xFA, 0x6D, 0xA3, 0xE9, 0x5E, 0x49, 0xD5, 0x9D,
+    0x5A, 0xD5, 0xDA, 0x5D, 0xA5, 0xD9, 0x49, 0xD9, 0x49, 0xD5, 0xE5, 0xAD, 0x49, 0xE5, 0xAD, 0x4E,
+    0xA5, 0xE3, 0xDA, 0xCA, 0x09, 0xC2, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x29, 0xFD, 0x90, 0xAF,
+    0x4A, 0xEA, 0x29, 0xE7, 0x97, 0x50, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x1F, 0xF9, 0x71, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF, 0x69, 0xD9, 0x49,
+    0xD6, 0xAD, 0x6D, 0x6E, 0x6C, 0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD4, 0x97, 0x1F,
+    0xFC, 0xA7, 0x0F, 0xFC, 0x97, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6, 0x9A, 0x6D, 0xA6,
+    0xD5, 0x9D, 0x95, 0x9D, 0x5A, 0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xD3, 0x4A,
+    0xAA, 0xAA, 0xAA, 0x93, 0xAF, 0xF3, 0x9A, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x39, 0xFA, 0x5A,
+    0xDA, 0xE9, 0x3D, 0xA2, 0xDA, 0x2A, 0xCA, 0x3D, 0xA1, 0x9D, 0x39, 0xD9, 0x1D, 0xA2, 0x9D, 0xA2,
+    0xD9, 0x1A, 0xDA, 0x29, 0xD9, 0xF9, 0x3A, 0xFC, 0x95, 0xE9, 0x70, 0xE7, 0x1A, 0xD5, 0xAA, 0x19,
+    0xDA, 0x19, 0xAD, 0x92, 0xFF, 0x93, 0x9F, 0xCA, 0x70, 0x97, 0x77, 0x73, 0xAC, 0x49, 0xC7, 0x1D,
+    0xA2, 0xAC, 0xA7, 0x1A, 0xFE, 0x73, 0xFC, 0xA7, 0x69, 0x97, 0x77, 0x77, 0x6A, 0xFF, 0xFC, 0x93,
+    0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69,
+    0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A,
+    0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF,
+    0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x77, 0x19, 0xC9, 0x4C, 0x4A, 0xD2, 0x9D, 0x49, 0xFE, 0x6A, 0xFC,
+    0x71, 0x99, 0x77, 0x77, 0x59, 0xFA, 0x6A, 0xDA, 0xE9, 0x4D, 0xA2, 0xDA, 0x3A, 0xCA, 0x3D, 0xA2,
+    0x9D, 0x39, 0xD9, 0x2D, 0xA2, 0x9D, 0xA3, 0xD9, 0x1A, 0xDA, 0x39, 0xD9, 0xF9, 0x4A, 0xFC, 0x96,
+    0xE9, 0x71, 0xE7, 0x2A, 0xD5, 0xAA, 0x29, 0xDA, 0x19, 0xAD, 0x93, 0xFF, 0x94, 0x9F, 0xCA, 0x71,
+    0x97, 0x00, 0x77, 0x76, 0xAD, 0x76, 0xAE, 0x76, 0xF7, 0x69, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x1A,
+    0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7,
+    0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76,
+    0xAD, 0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99,
+    0xDA, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x7A, 0xC7, 0x0E, 0x96, 0x9E, 0x70, 0xD9, 0x77,
+    0x77, 0x72, 0x9F, 0xA4, 0xAD, 0xAE, 0x92, 0xDA, 0x2D, 0xA1, 0xAC, 0xA3, 0xDA, 0x09, 0xD3, 0x9D,
+    0x90, 0xDA, 0x29, 0xDA, 0x1D, 0x91, 0xAD, 0xA1, 0x9D, 0x9F, 0x92, 0xAF, 0xC9, 0x4E, 0x97, 0xE7,
+    0x0A, 0xD5, 0xAA, 0x09, 0xDA, 0x19, 0xAD, 0x91, 0xFF, 0x92, 0x9F, 0xCA, 0x79, 0x60, 0x77, 0x6A,
+    0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7,
+    0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76,
+    0xAD, 0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99,
+    0xDA, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD, 0x76, 0xAC, 0xA7, 0x6A, 0xC9, 0x77, 0xD7, 0x79, 0xD7,
+    0x70, 0xFC, 0x75, 0x9E, 0x97, 0x76, 0x77, 0x09, 0xFA, 0x4A, 0xDA, 0xE9, 0x2D, 0xA2, 0xDA, 0x1A,
+    0xCA, 0x3D, 0xA0, 0x9D, 0x39, 0xD9, 0x0D, 0xA2, 0x9D, 0xA1, 0xD9, 0x1A, 0xDA, 0x19, 0xD9, 0xF9,
+    0x2A, 0xFC, 0x94, 0xE9, 0x7E, 0x70, 0xAD, 0x5A, 0xA0, 0x9D, 0xA1, 0x9A, 0xD9, 0x1F, 0xF9, 0x29,
+    0xFD, 0x96, 0x9D, 0x70, 0x9C, 0x97, 0x0D, 0x71, 0xD7, 0x1F, 0xA6, 0xAE, 0x97, 0x60, 0x70, 0xA9,
+    0x4A, 0xC9, 0x79, 0xD3, 0xE7, 0x1E, 0x1E, 0x72, 0x9F, 0xCA, 0x74, 0xAE, 0xA7, 0x6A, 0xCA, 0x77,
+    0x77, 0x76, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF, 0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E, 0x6C,
+    0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC, 0x97,
+    0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6, 0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D, 0x5A,
+    0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xD3, 0x73, 0x94, 0x9C, 0xA2, 0x9D, 0x93,
+    0x9D, 0x2D, 0x95, 0xDA, 0x0D, 0x96, 0x9F, 0xA7, 0x0E, 0xA7, 0x2A, 0xA7, 0x77, 0x75, 0x9F, 0xA6,
+    0xAD, 0xAE, 0x94, 0xDA, 0x2D, 0xA3, 0xAC, 0xA3, 0xDA, 0x29, 0xD3, 0x9D, 0x92, 0xDA, 0x29, 0xDA,
+    0x3D, 0x91, 0xAD, 0xA3, 0x9D, 0x9F, 0x94, 0xAF, 0xC9, 0x6E, 0x97, 0x1E, 0x72, 0xAD, 0x5A, 0xA2,
+    0x9D, 0xA1, 0x9A, 0xD9, 0x3F, 0xF9, 0x49, 0xFC, 0xA7, 0x19, 0x70, 0x73, 0x99, 0x77, 0xAE, 0x75,
+    0xAF, 0xC7, 0x3A, 0xD9, 0x9D, 0xA7, 0x1A, 0xD9, 0x19, 0xD7, 0x09, 0xCA, 0x4A, 0xA7, 0x77, 0x79,
+    0x99, 0x73, 0x9A, 0xFF, 0xA6, 0xAF, 0xFE, 0x94, 0xEA, 0x93, 0x9A, 0xD9, 0x3E, 0x97, 0xD3, 0xAD,
+    0x97, 0x0D, 0x29, 0xDA, 0x70, 0x9C, 0x92, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7,
+    0x99, 0x99, 0x99, 0x90, 0xE6, 0xAF, 0xDA, 0x0E, 0x79, 0x9A, 0xDA, 0x1E, 0x71, 0x9D, 0x91, 0xE9,
+    0x70, 0xAD, 0x2A, 0xE7, 0x0E, 0x3E, 0xA7, 0xDA, 0x39, 0xFA, 0x29, 0x9A, 0xD9, 0x4A, 0xFF, 0xF7,
+    0xAF, 0xEA, 0x97, 0x39, 0x97, 0x00, 0x77, 0x76, 0x9D, 0xA7, 0x6F, 0x97, 0x4D, 0xAE, 0x73, 0xDA,
+    0x09, 0xD7, 0x2A, 0xD2, 0xAC, 0x97, 0x1C, 0xA4, 0xC7, 0x77, 0x77, 0x79, 0xAF, 0xFA, 0x6A, 0xEA,
+    0xFD, 0x95, 0xAD, 0x92, 0xD9, 0x97, 0xD9, 0x3D, 0xA7, 0xAD, 0x4D, 0x97, 0xDA, 0x4D, 0x70, 0xDA,
+    0x3E, 0x70, 0xAD, 0x2E, 0x72, 0xFD, 0xA7, 0x4A, 0xDA, 0x97, 0x49, 0xD7, 0x69, 0xD9, 0x76, 0x9E,
+    0xA7, 0x5A, 0xFC, 0xA7, 0x1F, 0x9A, 0xF9, 0x59, 0xDA, 0x4A, 0xEA, 0x4D, 0xA6, 0x9E, 0x39, 0xD9,
+    0x7A, 0xD3, 0x9D, 0xA6, 0x9D, 0xA4, 0xFA, 0x99, 0x99, 0xF6, 0xFF, 0xDA, 0x71, 0xAA, 0xDA, 0xA9,
+    0x70, 0x77, 0x72, 0x9C, 0x94, 0xC7, 0x1A, 0xD2, 0x9D, 0x71, 0x9F, 0xE7, 0x3A, 0xFC, 0x76, 0x99,
+    0x77, 0x77, 0x39, 0x99, 0x73, 0x9A, 0xFF, 0xA6, 0xAF, 0xFE, 0x94, 0xEA, 0x93, 0x9A, 0xD9, 0x3E,
+    0x97, 0xD3, 0xAD, 0x97, 0x0D, 0x29, 0xDA, 0x70, 0x9C, 0x92, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97,
+    0x6E, 0x77, 0xE7, 0x99, 0x99, 0x99, 0x90, 0xE6, 0xAF, 0xDA, 0x0E, 0x79, 0x9A, 0xDA, 0x1E, 0x71,
+    0x9D, 0x91, 0xE9, 0x70, 0xAD, 0x2A, 0xE7, 0x0E, 0x3E, 0xA7, 0xDA, 0x39, 0xFA, 0x29, 0x9A, 0xD9,
+    0x4A, 0xFF, 0xF7, 0xAF, 0xEA, 0x97, 0x39, 0x97, 0x00, 0x77, 0x73, 0x9C, 0x94, 0xC7, 0x1A, 0xD2,
+    0x9D, 0x71, 0x9F, 0xE7, 0x3A, 0xFC, 0x76, 0x99, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xFA, 0x6A, 0xEA,
+    0xFD, 0x95, 0xAD, 0x92, 0xD9, 0x97, 0xD9, 0x3D, 0xA7, 0xAD, 0x4D, 0x97, 0xDA, 0x4D, 0x70, 0xDA,
+    0x3E, 0x70, 0xAD, 0x2E, 0x72, 0xFD, 0xA7, 0x4A, 0xDA, 0x97, 0x49, 0xD7, 0x69, 0xD9, 0x76, 0x9E,
+    0xA7, 0x5A, 0xFC, 0xA7, 0x1F, 0x9A, 0xF9, 0x59, 0xDA, 0x4A, 0xEA, 0x4D, 0xA6, 0x9E, 0x39, 0xD9,
+    0x7A, 0xD3, 0x9D, 0xA6, 0x9D, 0xA4, 0xFA, 0x99, 0x99, 0xF6, 0xFF, 0xDA, 0x71, 0xAA, 0xDA, 0xA9,
+    0x70, 0x77, 0x75, 0x9D, 0x77, 0xE9, 0x75, 0x9E, 0x77, 0xD9, 0x77, 0x77, 0x77, 0x59, 0x99, 0x73,
+    0x9A, 0xFF, 0xA6, 0xAF, 0xFE, 0x94, 0xEA, 0x93, 0x9A, 0xD9, 0x3E, 0x97, 0xD3, 0xAD, 0x97, 0x0D,
+    0x29, 0xDA, 0x70, 0x9C, 0x92, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x99, 0x99,
+    0x99, 0x90, 0xE6, 0xAF, 0xDA, 0x0E, 0x79, 0x9A, 0xDA, 0x1E, 0x71, 0x9D, 0x91, 0xE9, 0x70, 0xAD,
+    0x2A, 0xE7, 0x0E, 0x3E, 0xA7, 0xDA, 0x39, 0xFA, 0x29, 0x9A, 0xD9, 0x4A, 0xFF, 0xF7, 0xAF, 0xEA,
+    0x97, 0x39, 0x97, 0x00, 0x74, 0xAC, 0x77, 0xE9, 0x75, 0x9E, 0x77, 0xD9, 0x77, 0x77, 0x77, 0x77,
+    0x49, 0xAF, 0xFA, 0x6A, 0xEA, 0xFD, 0x95, 0xAD, 0x92, 0xD9, 0x97, 0xD9, 0x3D, 0xA7, 0xAD, 0x4D,
+    0x97, 0xDA, 0x4D, 0x70, 0xDA, 0x3E, 0x70, 0xAD, 0x2E, 0x72, 0xFD, 0xA7, 0x4A, 0xDA, 0x97, 0x49,
+    0xD7, 0x69, 0xD9, 0x76, 0x9E, 0xA7, 0x5A, 0xFC, 0xA7, 0x1F, 0x9A, 0xF9, 0x59, 0xDA, 0x4A, 0xEA,
+    0x4D, 0xA6, 0x9E, 0x39, 0xD9, 0x7A, 0xD3, 0x9D, 0xA6, 0x9D, 0xA4, 0xFA, 0x99, 0x99, 0xF6, 0xFF,
+    0xDA, 0x71, 0xAA, 0xDA, 0xA9, 0x70, 0x72, 0x99, 0x97, 0x39, 0xAF, 0xFA, 0x6A, 0xFF, 0xE9, 0x4E,
+    0xA9, 0x39, 0xAD, 0x93, 0xE9, 0x7D, 0x3A, 0xD9, 0x70, 0xD2, 0x9D, 0xA7, 0x09, 0xC9, 0x2E, 0x76,
+    0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x79, 0x99, 0x99, 0x99, 0x0E, 0x6A, 0xFD, 0xA0, 0xE7,
+    0x99, 0xAD, 0xA1, 0xE7, 0x19, 0xD9, 0x1E, 0x97, 0x0A, 0xD2, 0xAE, 0x70, 0xE3, 0xEA, 0x7D, 0xA3,
+    0x9F, 0xA2, 0x99, 0xAD, 0x94, 0xAF, 0xFF, 0x7A, 0xFE, 0xA9, 0x73, 0x99, 0x77, 0x09, 0x97, 0x7E,
+    0x77, 0xAD, 0x77, 0xAD, 0x77, 0xD7, 0x7D, 0x97, 0x79, 0x73, 0x76, 0x97, 0x79, 0xD7, 0x69, 0xD7,
+    0x7D, 0x97, 0x69, 0xD7, 0x7E, 0x77, 0xE7, 0x7A, 0xD9, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xFA, 0x6A,
+    0xEA, 0xFD, 0x95, 0xAD, 0x92, 0xD9, 0x97, 0xD9, 0x3D, 0xA7, 0xAD, 0x4D, 0x97, 0xDA, 0x4D, 0x70,
+    0xDA, 0x3E, 0x70, 0xAD, 0x2E, 0x72, 0xFD, 0xA7, 0x4A, 0xDA, 0x97, 0x49, 0xD7, 0x69, 0xD9, 0x76,
+    0x9E, 0xA7, 0x5A, 0xFC, 0xA7, 0x1F, 0x9A, 0xF9, 0x59, 0xDA, 0x4A, 0xEA, 0x4D, 0xA6, 0x9E, 0x39,
+    0xD9, 0x7A, 0xD3, 0x9D, 0xA6, 0x9D, 0xA4, 0xFA, 0x99, 0x99, 0xF6, 0xFF, 0xDA, 0x71, 0xAA, 0xDA,
+    0xA9, 0x70, 0x76, 0x99, 0x77, 0x59, 0xE7, 0x73, 0x9F, 0xC7, 0x71, 0xAD, 0x99, 0xDA, 0x77, 0xAD,
+    0x91, 0x9D, 0x77, 0xD4, 0x9A, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xE4, 0xFE, 0xA3, 0x9A, 0xFA, 0x94,
+    0xAF, 0xCA, 0x69, 0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x1D, 0xA7, 0x0E, 0x70, 0x9D, 0x97, 0x0E, 0x70,
+    0xAD, 0x71, 0xDA, 0x70, 0xE7, 0x09, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x9A,
+    0xDA, 0x70, 0xFF, 0xFE, 0x97, 0x0E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x70, 0x9D, 0xA7, 0x0E, 0x70,
+    0xAD, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x70, 0xE7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xAD,
+    0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x71, 0xDA, 0x6A, 0xFD, 0x49, 0xAF, 0xCA, 0x3A, 0xFE, 0x4F,
+    0xEA, 0x30, 0x69, 0x99, 0x74, 0x9E, 0x97, 0x29, 0xFC, 0x71, 0x9D, 0xA0, 0xE7, 0xAD, 0x92, 0xD7,
+    0xAA, 0x49, 0xA7, 0x77, 0x29, 0x99, 0x73, 0xFC, 0x72, 0x9A, 0xAE, 0x75, 0xAD, 0x75, 0xDA, 0x75,
+    0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x2A, 0xE6, 0xD9, 0x09, 0xFC, 0xA5, 0xD0, 0x9D, 0xA9,
+    0xE4, 0x9D, 0x0D, 0x2E, 0x4A, 0xCA, 0xD3, 0xDA, 0x4F, 0x93, 0xD9, 0x4E, 0xA3, 0x9D, 0x49, 0xE4,
+    0xAD, 0x4A, 0xD9, 0x4D, 0xA4, 0xE5, 0xD9, 0x4D, 0xA4, 0x9D, 0x49, 0xD9, 0x4A, 0xD0, 0x9C, 0x1A,
+    0xD5, 0xEA, 0xD1, 0xAD, 0x5F, 0xC2, 0xDA, 0x5E, 0xA7, 0x59, 0x40, 0x77, 0x74, 0xAF, 0xE4, 0xFE,
+    0xA3, 0x9A, 0xFA, 0x94, 0xAF, 0xCA, 0x69, 0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x1D, 0xA5, 0xAF, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0xC6, 0xDA, 0x70, 0xE7, 0x09, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x99, 0x99,
+    0x99, 0x99, 0x9A, 0xDA, 0x70, 0xFF, 0xFE, 0x97, 0x0E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x70, 0x9D,
+    0xA7, 0x0E, 0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x70, 0xE7, 0x0A, 0xD9, 0x70,
+    0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x71, 0xDA, 0x6A, 0xFD, 0x49, 0xAF, 0xCA,
+    0x3A, 0xFE, 0x4F, 0xEA, 0x30, 0x49, 0x99, 0x73, 0xFC, 0x72, 0x9A, 0xAE, 0x75, 0xAD, 0x75, 0xE7,
+    0x2F, 0xFC, 0x79, 0x9A, 0xD9, 0x99, 0x97, 0x1A, 0xD7, 0x5D, 0xA2, 0x9A, 0xAA, 0x6D, 0x91, 0xFC,
+    0xA4, 0x9D, 0x1F, 0xE4, 0x9D, 0x0D, 0x91, 0xDA, 0x4A, 0xCA, 0xD9, 0x2D, 0xA4, 0xF9, 0x3D, 0x94,
+    0xEA, 0x39, 0xD4, 0x9E, 0x4A, 0xD4, 0xAD, 0x94, 0xDA, 0x4E, 0x5D, 0x94, 0xDA, 0x49, 0xD4, 0x9D,
+    0x94, 0xAD, 0x09, 0xC1, 0xAD, 0x5E, 0xAD, 0x1A, 0xD5, 0xFC, 0x2D, 0xA5, 0xEA, 0x75, 0x94, 0x77,
+    0x3A, 0xDA, 0x1A, 0xC4, 0xAF, 0xA9, 0xD4, 0xD9, 0xAF, 0x94, 0xC9, 0x1A, 0xDA, 0x77, 0x77, 0x76,
+    0xAF, 0xE9, 0x49, 0xAF, 0xA9, 0x79, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D,
+    0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D,
+    0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x70, 0xAF, 0xD9, 0x4A, 0xFE, 0x94, 0x39, 0x70, 0xEA, 0x1C, 0xA1,
+    0xFC, 0x9A, 0xCA, 0x1D, 0x0A, 0xF2, 0xC9, 0x1A, 0xD9, 0x77, 0x77, 0x29, 0xAE, 0x49, 0xFC, 0x96,
+    0x9D, 0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xDA, 0x09,
+    0xC4, 0xDA, 0xAD, 0x39, 0xFC, 0x5E, 0xA7, 0x70, 0x49, 0xAA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFA, 0x49,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x75, 0xAF, 0xE9, 0x49, 0xAF, 0xA9, 0x79, 0xD9, 0x71, 0xAD,
+    0x72, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97,
+    0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x70, 0xAF, 0xD9, 0x4A,
+    0xFE, 0x94, 0x19, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xA1, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x29,
+    0xAE, 0x49, 0xFC, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9,
+    0x6A, 0xD7, 0xDA, 0x09, 0xC4, 0xDA, 0xAD, 0x39, 0xFC, 0x5E, 0xA7, 0x70, 0x77, 0x39, 0xC9, 0x4C,
+    0x5E, 0x29, 0xD5, 0x9F, 0xE7, 0xAF, 0xA7, 0x29, 0x97, 0x77, 0x76, 0xAF, 0xE9, 0x59, 0xAF, 0xA9,
+    0x70, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xE7,
+    0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A,
+    0xD7, 0x1A, 0xFD, 0x95, 0xAF, 0xE9, 0x50, 0x74, 0xAC, 0x5C, 0x1D, 0xA2, 0x9C, 0xA1, 0xAF, 0xE3,
+    0xAF, 0xA6, 0x99, 0x77, 0x72, 0x9A, 0xE4, 0x9F, 0xC9, 0x69, 0xD7, 0xAD, 0x7D, 0xA6, 0x9D, 0x96,
+    0xAD, 0x7E, 0x7D, 0xA6, 0x9D, 0x96, 0xAD, 0x7D, 0xA0, 0x9C, 0x4D, 0xAA, 0xD3, 0x9F, 0xC5, 0xEA,
+    0x77, 0x00, 0x77, 0x0A, 0xFE, 0x93, 0x9A, 0xFA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7,
+    0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0A,
+    0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0xAF, 0xD9, 0x3A, 0xFE, 0x97, 0x0D, 0x71,
+    0xD7, 0x1A, 0xC9, 0x71, 0xDA, 0x71, 0xAF, 0xA7, 0xF7, 0x71, 0x75, 0xE4, 0x9E, 0x4A, 0xE5, 0xAA,
+    0x77, 0x75, 0x9A, 0xE2, 0x9F, 0xC9, 0x49, 0xD5, 0xAD, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5D,
+    0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0xA0, 0x9C, 0x2D, 0xAA, 0xD1, 0x9F, 0xC3, 0xF5, 0xD5, 0xD5, 0x9C,
+    0xA5, 0xAC, 0xA5, 0xAE, 0xAA, 0x3F, 0x74, 0x77, 0x49, 0xD7, 0x09, 0xE9, 0x7A, 0xE7, 0x1D, 0x97,
+    0x77, 0x77, 0x4A, 0xFE, 0x93, 0x9A, 0xFA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD7,
+    0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0xAF, 0xD9, 0x3A, 0xFE, 0x93, 0x70, 0x9A, 0xE1,
+    0x9F, 0xC9, 0x39, 0xD4, 0xAD, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4E, 0x4D, 0xA3, 0x9D, 0x93, 0xAD,
+    0x4D, 0xA0, 0x9C, 0x1D, 0xAA, 0xD0, 0x9F, 0xC2, 0xEA, 0x72, 0x77, 0x73, 0xAF, 0xE9, 0x1A, 0xFE,
+    0x49, 0xAF, 0xA9, 0x29, 0xAF, 0xA9, 0x69, 0xD9, 0x69, 0xD9, 0x70, 0xAD, 0x7A, 0xD7, 0x1E, 0x7E,
+    0x71, 0xE7, 0xE7, 0x1D, 0xA7, 0xDA, 0x70, 0x9D, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0xAD, 0x71, 0xE7,
+    0xE7, 0x1D, 0xA7, 0xE7, 0x09, 0xD9, 0x69, 0xDA, 0x70, 0xAD, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0xAD,
+    0x71, 0xE7, 0xE7, 0x1D, 0xA7, 0xDA, 0x70, 0x9D, 0x96, 0x9D, 0xA7, 0x0A, 0xD7, 0xAD, 0x96, 0xAF,
+    0xD9, 0x4E, 0x6A, 0xFE, 0x94, 0xDA, 0x77, 0x39, 0xD9, 0x77, 0x3E, 0x76, 0xAC, 0x91, 0xE9, 0x76,
+    0xFE, 0xA7, 0x7A, 0xFC, 0x97, 0x72, 0x99, 0x74, 0x77, 0x6E, 0x5A, 0xD4, 0x9E, 0x49, 0xE9, 0x3A,
+    0xE4, 0x9E, 0x5A, 0xA6, 0xAA, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xE3, 0x9A, 0xE9, 0x19, 0xFC, 0x92,
+    0xFC, 0x94, 0x9D, 0x6D, 0x94, 0xAD, 0x59, 0xD5, 0xDA, 0x5A, 0xD4, 0x9D, 0x95, 0xE4, 0xAD, 0x6D,
+    0xA4, 0xE6, 0xD9, 0x4D, 0xA5, 0x9D, 0x49, 0xD9, 0x5A, 0xD4, 0xAD, 0x6D, 0xA4, 0xDA, 0x09, 0xC3,
+    0xD9, 0x4D, 0xAA, 0xD2, 0x9D, 0x49, 0xFC, 0x3A, 0xD5, 0xEA, 0x4D, 0xA7, 0x59, 0xD9, 0x75, 0xAD,
+    0x76, 0xD9, 0x71, 0xA2, 0xAD, 0x71, 0xAF, 0xD7, 0x2A, 0xFC, 0x74, 0xAC, 0xA9, 0x71, 0x75, 0x97,
+    0x79, 0xE7, 0x59, 0xFC, 0x73, 0x9D, 0x99, 0xDA, 0x71, 0xAD, 0x91, 0x9D, 0x71, 0xD4, 0x9A, 0x77,
+    0x77, 0x76, 0xAF, 0xE9, 0x71, 0x9A, 0xFC, 0x97, 0x5D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x77, 0xE7,
+    0x7E, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0x9D, 0xA7, 0x6A, 0xD9,
+    0x76, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x6A, 0xD7,
+    0x19, 0xC9, 0x1A, 0xD9, 0x71, 0xAF, 0xDA, 0x72, 0x9F, 0xC9, 0x75, 0x99, 0x97, 0x50, 0x77, 0x74,
+    0xE7, 0x4A, 0xF7, 0x29, 0xDA, 0xD9, 0x70, 0x9D, 0x1D, 0xA7, 0x0D, 0x92, 0xD7, 0xAC, 0x93, 0xAA,
+    0x77, 0x77, 0x71, 0xAA, 0xE7, 0x29, 0xFC, 0x75, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x5D, 0x97, 0x49,
+    0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0x75, 0xD9, 0x74, 0x9D,
+    0x75, 0xE7, 0x5D, 0x97, 0x4A, 0xD7, 0x09, 0xA2, 0xD9, 0x70, 0xFD, 0xA7, 0x1F, 0xCA, 0x72, 0x9A,
+    0xCA, 0x97, 0x20, 0x77, 0x72, 0xAF, 0xE1, 0x9F, 0xE4, 0x9A, 0xFA, 0x92, 0x9F, 0xA7, 0x9D, 0x94,
+    0x9D, 0xA7, 0x1A, 0xD4, 0xAD, 0xA7, 0x2E, 0x3A, 0xD9, 0x73, 0xE2, 0xE9, 0x74, 0xDA, 0x1E, 0x75,
+    0x9D, 0x90, 0xE7, 0x6A, 0xD9, 0xDA, 0x77, 0xFD, 0x77, 0x0D, 0xAA, 0xD9, 0x76, 0x9D, 0x90, 0xE7,
+    0x6A, 0xD9, 0x0A, 0xDA, 0x75, 0xAD, 0x2E, 0x97, 0x4E, 0x29, 0xE9, 0x73, 0xDA, 0x3A, 0xE7, 0x29,
+    0xD9, 0x4F, 0x71, 0xAD, 0x6F, 0x95, 0xAF, 0xDA, 0x4F, 0xA3, 0xAF, 0xF5, 0xFA, 0x77, 0x39, 0x75,
+    0x99, 0x77, 0x39, 0xE7, 0x73, 0xE7, 0x73, 0xDA, 0x77, 0x29, 0xD7, 0x72, 0x9D, 0x77, 0x39, 0x97,
+    0x50, 0x49, 0x97, 0x0A, 0xFA, 0x7A, 0xAA, 0xDA, 0x71, 0x9D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D,
+    0xA7, 0x2D, 0x97, 0x19, 0xD1, 0xAE, 0xA3, 0xAC, 0xA0, 0xFD, 0x92, 0xDA, 0xD9, 0x1D, 0x92, 0xF3,
+    0xD9, 0x19, 0xE3, 0xAD, 0x2A, 0xD3, 0x9D, 0x92, 0xAC, 0xA1, 0x9E, 0x93, 0xFE, 0xA5, 0xFC, 0xA6,
+    0x9D, 0x0A, 0xD6, 0xAD, 0x1D, 0xA5, 0xDA, 0x1A, 0xDA, 0x4D, 0x92, 0xF2, 0x9D, 0x93, 0xFC, 0xAA,
+    0xD5, 0xF9, 0x72, 0x96, 0x99, 0x72, 0x9D, 0xA7, 0x2D, 0xA7, 0x2D, 0x97, 0x1A, 0xCA, 0x71, 0x9C,
+    0xA7, 0x29, 0x97, 0x00, 0x77, 0xAE, 0xA3, 0xAD, 0xA0, 0xAF, 0xA2, 0xFC, 0x3D, 0xA1, 0xEA, 0xCA,
+    0x3D, 0x90, 0xDA, 0x7D, 0x0A, 0xC9, 0x79, 0xD9, 0xC9, 0x70, 0xAF, 0x71, 0xFC, 0x71, 0xDA, 0xDA,
+    0x79, 0xD9, 0x9D, 0x79, 0xD1, 0xDA, 0x6A, 0xD1, 0xAD, 0x29, 0xA1, 0xDA, 0x2E, 0x9A, 0xCA, 0x1D,
+    0x92, 0x9F, 0xC1, 0x9D, 0x4A, 0xDA, 0x77, 0x10, 0x73, 0x97, 0x6A, 0xCA, 0x73, 0x9E, 0xA7, 0x2F,
+    0xC7, 0x2E, 0xA9, 0x73, 0xA9, 0x77, 0x77, 0x75, 0xAF, 0xE9, 0x79, 0xAF, 0xA9, 0x72, 0x9D, 0x97,
+    0x4A, 0xD7, 0x5E, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49,
+    0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5E, 0x7C, 0x93, 0xDA, 0x6A, 0xC9, 0x29, 0xD9, 0x6D, 0x3A,
+    0xD9, 0x39, 0x9E, 0x1A, 0xFF, 0xFC, 0x90, 0xAF, 0xFF, 0xD1, 0x77, 0x09, 0xCA, 0x5F, 0x3A, 0xFA,
+    0x19, 0xFA, 0x93, 0x99, 0x77, 0x39, 0x94, 0xFC, 0x92, 0x9A, 0xAE, 0x95, 0xAD, 0x6E, 0x6D, 0xA6,
+    0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD,
+    0x6E, 0x6D, 0xA6, 0xD9, 0x0A, 0xA2, 0x9D, 0xAD, 0x92, 0xAF, 0xA3, 0x9E, 0x97, 0x60, 0x77, 0x4A,
+    0xFE, 0x97, 0x9A, 0xFA, 0x97, 0x29, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x74, 0x9D,
+    0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0xC9,
+    0x3D, 0xA6, 0xAC, 0x92, 0x9D, 0x96, 0xD3, 0xAD, 0x93, 0x99, 0xE1, 0xAF, 0xFF, 0xC9, 0x0A, 0xFF,
+    0xFD, 0x77, 0x71, 0x99, 0x75, 0x9D, 0xA7, 0x5E, 0x75, 0xD9, 0x74, 0xAD, 0x74, 0x9D, 0x75, 0x99,
+    0x71, 0x69, 0x94, 0xFC, 0x92, 0x9A, 0xAE, 0x95, 0xAD, 0x6E, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD,
+    0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6E, 0x6D, 0xA6, 0xD9,
+    0x0A, 0xA2, 0x9D, 0xAD, 0x92, 0xAF, 0xA3, 0x9E, 0x97, 0x79, 0x96, 0xE6, 0xAD, 0x6A, 0xD6, 0xD6,
+    0xD9, 0x69, 0x70, 0x76, 0x97, 0x70, 0xD7, 0x69, 0xD4, 0xAF, 0xE9, 0x0A, 0xD4, 0x9A, 0xFA, 0x91,
+    0xAC, 0x96, 0x9D, 0x93, 0xD7, 0xAD, 0x4C, 0x97, 0xE4, 0x97, 0x0E, 0x76, 0xDA, 0x75, 0x9D, 0x97,
+    0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0xC9, 0x4D,
+    0xA6, 0xAC, 0x93, 0x9D, 0x96, 0xD4, 0xAD, 0x93, 0x99, 0xE2, 0xAF, 0xFF, 0xC9, 0x1A, 0xFF, 0xFD,
+    0x20, 0x71, 0xAA, 0x72, 0xD9, 0x49, 0x92, 0xD2, 0xFC, 0x90, 0x9D, 0x19, 0xAA, 0xE9, 0x0A, 0xC9,
+    0x4A, 0xD1, 0xD5, 0xE1, 0xC9, 0x5D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D,
+    0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA,
+    0x71, 0xD9, 0x0A, 0xA5, 0x9D, 0xAD, 0x95, 0xAF, 0xA6, 0x9E, 0x97, 0x74, 0x77, 0x5A, 0xFE, 0x97,
+    0x09, 0xAF, 0xA9, 0x73, 0x9D, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x6D, 0xA5, 0xAA, 0x59, 0xD9,
+    0x4E, 0x94, 0xAD, 0x4A, 0xE5, 0xE4, 0xAD, 0xA5, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xAD,
+    0x76, 0xE7, 0xC9, 0x4D, 0xA6, 0xAC, 0x93, 0x9D, 0x96, 0xD4, 0xAD, 0x93, 0x99, 0xE2, 0xAF, 0xFF,
+    0xC9, 0x1A, 0xFF, 0xFD, 0x20, 0x49, 0x96, 0xFC, 0x94, 0x9A, 0xAE, 0x97, 0xAD, 0x70, 0xE7, 0x0D,
+    0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x29, 0x92, 0x9D, 0x2E, 0x91, 0xAD,
+    0x2E, 0x91, 0xE2, 0xDA, 0x2D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA7, 0x0D, 0x90, 0xAA,
+    0x49, 0xDA, 0xD9, 0x4A, 0xFA, 0x59, 0xE9, 0x77, 0x20, 0x77, 0x4A, 0xFE, 0x97, 0x9A, 0xFA, 0x97,
+    0x29, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x19, 0x71, 0x9D, 0x99, 0xD7, 0x1A, 0xFC,
+    0xA7, 0x1F, 0x97, 0x1A, 0xF7, 0x1A, 0xFC, 0x97, 0x1A, 0xA9, 0xAD, 0x97, 0x4A, 0xD7, 0x5E, 0x7C,
+    0x93, 0xDA, 0x6A, 0xC9, 0x29, 0xD9, 0x6D, 0x3A, 0xD9, 0x39, 0x9E, 0x1A, 0xFF, 0xFC, 0x90, 0xAF,
+    0xFF, 0xD1, 0x69, 0x95, 0xFC, 0x93, 0x9A, 0xAE, 0x96, 0xAD, 0x7E, 0x7D, 0xA7, 0xD9, 0x69, 0xD7,
+    0xAD, 0x7D, 0xAA, 0xC9, 0x4F, 0xA4, 0x9E, 0x94, 0xAE, 0x49, 0xFC, 0x4D, 0x9D, 0xA6, 0x9D, 0x96,
+    0xAD, 0x7E, 0x7D, 0xA7, 0xD9, 0x0A, 0xA3, 0x9D, 0xAD, 0x93, 0xAF, 0xA4, 0x9E, 0x97, 0x60, 0x77,
+    0x19, 0x77, 0x5A, 0xCA, 0x77, 0x39, 0xEA, 0x77, 0x2F, 0xC7, 0x72, 0xEA, 0x97, 0x73, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x0A, 0xF9, 0x6F, 0xE5, 0xAE, 0xA6, 0xAF, 0x97, 0xAE, 0x70, 0xD7, 0x1A, 0xEA,
+    0x69, 0xD7, 0x1F, 0xC6, 0xAD, 0x71, 0xDA, 0xD9, 0x5D, 0xA7, 0x09, 0xD0, 0xE5, 0xD9, 0x70, 0xAD,
+    0x0A, 0xD9, 0x4D, 0x71, 0xDA, 0x1E, 0x39, 0xD7, 0x1D, 0x91, 0xAD, 0x92, 0xAD, 0x71, 0xD3, 0xDA,
+    0x2D, 0xA7, 0x09, 0xD3, 0xAD, 0x2D, 0x97, 0x0A, 0xD3, 0x9D, 0xA1, 0xD7, 0x1D, 0xA4, 0xE0, 0x9D,
+    0x71, 0xD9, 0x49, 0xDA, 0xAC, 0xA7, 0x1D, 0x6F, 0xCA, 0x70, 0x9D, 0x69, 0xF9, 0x70, 0xAD, 0x7F,
+    0x79, 0xAF, 0xA5, 0xAE, 0x69, 0xFE, 0x6D, 0xA7, 0x77, 0x70, 0x73, 0x97, 0x5D, 0x97, 0x3A, 0xD7,
+    0x3A, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0x97, 0x49, 0x77, 0x77, 0x7A, 0xEA, 0x29, 0xEA, 0x1A, 0xFC,
+    0x1A, 0xFC, 0x93, 0xDA, 0x0A, 0xD9, 0xAD, 0x93, 0xD9, 0xAC, 0xA1, 0x9D, 0x93, 0xDA, 0xCA, 0x29,
+    0xD3, 0x9F, 0x3A, 0xD3, 0xAE, 0x4D, 0xA3, 0xEA, 0x4D, 0x93, 0xE4, 0x9D, 0x39, 0xDA, 0x4A, 0xD3,
+    0x9D, 0x5D, 0xA3, 0xAD, 0x5D, 0x90, 0xAA, 0x0D, 0xA4, 0x9D, 0xAD, 0xA0, 0xD9, 0x49, 0xFA, 0x09,
+    0xD5, 0x9E, 0x97, 0x71, 0x77, 0x74, 0xAF, 0x96, 0xFE, 0x5A, 0xEA, 0x6A, 0xF9, 0x7A, 0xE7, 0x0D,
+    0x71, 0xAE, 0xA6, 0x9D, 0x71, 0xFC, 0x6A, 0xD7, 0x1D, 0xAD, 0x95, 0xDA, 0x70, 0x9D, 0x0E, 0x5D,
+    0x97, 0x0A, 0xD0, 0xAD, 0x94, 0xD7, 0x1D, 0xA1, 0xE3, 0x9D, 0x71, 0xD9, 0x1A, 0xD9, 0x2A, 0xD7,
+    0x1D, 0x3D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD2, 0xD9, 0x70, 0xAD, 0x39, 0xDA, 0x1D, 0x71, 0xDA,
+    0x4E, 0x09, 0xD7, 0x1D, 0x94, 0x9D, 0xAA, 0xCA, 0x71, 0xD6, 0xFC, 0xA7, 0x09, 0xD6, 0x9F, 0x97,
+    0x0A, 0xD7, 0xF7, 0x9A, 0xFA, 0x5A, 0xE6, 0x9F, 0xE6, 0xDA, 0x77, 0x77, 0x70, 0x99, 0x77, 0x6E,
+    0x77, 0x5E, 0x77, 0x5D, 0xA7, 0x74, 0x9D, 0x77, 0x49, 0xD7, 0x75, 0x99, 0x77, 0x77, 0x0A, 0xEA,
+    0x29, 0xEA, 0x1A, 0xFC, 0x1A, 0xFC, 0x93, 0xDA, 0x0A, 0xD9, 0xAD, 0x93, 0xD9, 0xAC, 0xA1, 0x9D,
+    0x93, 0xDA, 0xCA, 0x29, 0xD3, 0x9F, 0x3A, 0xD3, 0xAE, 0x4D, 0xA3, 0xEA, 0x4D, 0x93, 0xE4, 0x9D,
+    0x39, 0xDA, 0x4A, 0xD3, 0x9D, 0x5D, 0xA3, 0xAD, 0x5D, 0x90, 0xAA, 0x0D, 0xA4, 0x9D, 0xAD, 0xA0,
+    0xD9, 0x49, 0xFA, 0x09, 0xD5, 0x9E, 0x97, 0x77, 0x99, 0x74, 0xE7, 0x4A, 0xD7, 0x4A, 0xD7, 0x4D,
+    0x74, 0xD9, 0x74, 0x97, 0x20, 0x71, 0xAA, 0x49, 0xCA, 0x76, 0xDA, 0x2A, 0xD9, 0x76, 0xAD, 0x90,
+    0xAD, 0x97, 0x70, 0xEA, 0xD7, 0x73, 0xF7, 0x74, 0x9D, 0x77, 0x77, 0x77, 0x77, 0xAF, 0x96, 0xFE,
+    0x5A, 0xEA, 0x6A, 0xF9, 0x7A, 0xE7, 0x0D, 0x71, 0xAE, 0xA6, 0x9D, 0x71, 0xFC, 0x6A, 0xD7, 0x1D,
+    0xAD, 0x95, 0xDA, 0x70, 0x9D, 0x0E, 0x5D, 0x97, 0x0A, 0xD0, 0xAD, 0x94, 0xD7, 0x1D, 0xA1, 0xE3,
+    0x9D, 0x71, 0xD9, 0x1A, 0xD9, 0x2A, 0xD7, 0x1D, 0x3D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD2, 0xD9,
+    0x70, 0xAD, 0x39, 0xDA, 0x1D, 0x71, 0xDA, 0x4E, 0x09, 0xD7, 0x1D, 0x94, 0x9D, 0xAA, 0xCA, 0x71,
+    0xD6, 0xFC, 0xA7, 0x09, 0xD6, 0x9F, 0x97, 0x0A, 0xD7, 0xF7, 0x9A, 0xFA, 0x5A, 0xE6, 0x9F, 0xE6,
+    0xDA, 0x77, 0x77, 0x74, 0x97, 0xCA, 0x3D, 0x96, 0xD2, 0xD9, 0x7A, 0xCA, 0x0D, 0xA7, 0x1F, 0xA7,
+    0x2A, 0xE7, 0x4A, 0xA7, 0x77, 0x76, 0xAE, 0xA2, 0x9E, 0xA1, 0xAF, 0xC1, 0xAF, 0xC9, 0x3D, 0xA0,
+    0xAD, 0x9A, 0xD9, 0x3D, 0x9A, 0xCA, 0x19, 0xD9, 0x3D, 0xAC, 0xA2, 0x9D, 0x39, 0xF3, 0xAD, 0x3A,
+    0xE4, 0xDA, 0x3E, 0xA4, 0xD9, 0x3E, 0x49, 0xD3, 0x9D, 0xA4, 0xAD, 0x39, 0xD5, 0xDA, 0x3A, 0xD5,
+    0xD9, 0x0A, 0xA0, 0xDA, 0x49, 0xDA, 0xDA, 0x0D, 0x94, 0x9F, 0xA0, 0x9D, 0x59, 0xE9, 0x77, 0x10,
+    0x29, 0x97, 0x71, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71, 0xD9, 0x77, 0x0A,
+    0xD7, 0x71, 0xD2, 0xAE, 0xA2, 0x9F, 0x1D, 0x91, 0xAF, 0xC1, 0xAF, 0xC9, 0x70, 0xAC, 0xA0, 0xAD,
+    0x9A, 0xD9, 0x70, 0xDA, 0xAC, 0xA2, 0xD9, 0x70, 0xDA, 0xCA, 0x29, 0xD7, 0x09, 0xF3, 0xAD, 0x70,
+    0x9E, 0x4D, 0xA7, 0x0A, 0xDA, 0x4D, 0x97, 0x0E, 0x49, 0xD7, 0x1D, 0xA4, 0xAD, 0x70, 0x9D, 0x94,
+    0xDA, 0x70, 0xAD, 0x5D, 0x90, 0xAC, 0x5D, 0xA4, 0x9D, 0xAD, 0xA5, 0xD9, 0x49, 0xFA, 0x59, 0xD6,
+    0xEA, 0x77, 0x60, 0x77, 0x74, 0xAF, 0x96, 0xFE, 0x5A, 0xEA, 0x6A, 0xF9, 0x7A, 0xE7, 0x0D, 0x71,
+    0xAE, 0xA6, 0x9D, 0x71, 0xFC, 0x6A, 0xD7, 0x1D, 0xAD, 0x95, 0xDA, 0x70, 0x9D, 0x0E, 0x5D, 0x97,
+    0x0A, 0xD0, 0xAD, 0x94, 0xD7, 0x1D, 0xA1, 0xE3, 0x9D, 0x71, 0xD9, 0x1A, 0xD9, 0x2A, 0xD7, 0x1D,
+    0x3D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD2, 0xD9, 0x70, 0xAD, 0x4D, 0xA1, 0xD7, 0x1D, 0xA4, 0xAD,
+    0x09, 0xD7, 0x1D, 0x94, 0x9D, 0xAA, 0xCA, 0x71, 0xD6, 0xFC, 0xA7, 0x09, 0xD6, 0x9F, 0x97, 0x0A,
+    0xD7, 0xF7, 0x9A, 0xF9, 0x59, 0xDA, 0x69, 0xFE, 0x6D, 0x97, 0x75, 0xD7, 0x75, 0xAC, 0xA7, 0x70,
+    0xCA, 0x19, 0xD7, 0x70, 0x9F, 0xD7, 0x72, 0xFC, 0x77, 0x49, 0x97, 0x40, 0x77, 0xAE, 0xA2, 0x9E,
+    0xA0, 0xAF, 0xC1, 0xAF, 0xC9, 0x2D, 0xA0, 0xAD, 0x9A, 0xD9, 0x2D, 0x9A, 0xCA, 0x19, 0xD9, 0x2D,
+    0xAC, 0xA2, 0x9D, 0x29, 0xF3, 0xAD, 0x2A, 0xE4, 0xDA, 0x2E, 0xA4, 0xD9, 0x2E, 0x49, 0xD2, 0x9D,
+    0xA4, 0xAD, 0x29, 0xD5, 0xDA, 0x2A, 0xD5, 0xD9, 0x2D, 0xA4, 0x9D, 0x3D, 0x94, 0xAD, 0x29, 0xD5,
+    0xDA, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xD9, 0x6A, 0x2A, 0xD6, 0xAF, 0xD7, 0xAF, 0xC7, 0x1A, 0xCA,
+    0x97, 0x7A, 0xAA, 0xAA, 0xAA, 0xA7, 0x3F, 0xF9, 0x72, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77,
+    0x59, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94, 0xF4, 0xAD, 0xA7, 0xE9, 0x29,
+    0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE0, 0x9D, 0xA7, 0x3E, 0x0A,
+    0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3A, 0xD9, 0x0E, 0x97, 0x2E,
+    0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69, 0xE4, 0x9E, 0xA3, 0x9F, 0x69,
+    0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x5A, 0xAA, 0xAA, 0xAA, 0x95, 0x9F, 0xF6, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x29, 0xFC, 0x96, 0xFF, 0x94, 0xE9, 0x19, 0xE3, 0xE4, 0xAD,
+    0x91, 0x9D, 0x94, 0x9D, 0xA1, 0xE6, 0xDA, 0x09, 0xD9, 0x59, 0xD9, 0x0A, 0xD6, 0x9D, 0x90, 0xAD,
+    0x6A, 0xD1, 0xE6, 0xDA, 0x1E, 0x5A, 0xD9, 0x1A, 0xD9, 0x39, 0xDA, 0x29, 0xE2, 0x9E, 0x4F, 0xFC,
+    0x6A, 0xFC, 0x97, 0x19, 0x71, 0x77, 0x73, 0xD4, 0x9A, 0x72, 0xDA, 0x2A, 0xC9, 0x72, 0xFE, 0xA7,
+    0x4F, 0xCA, 0x77, 0x99, 0x77, 0x77, 0x49, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE,
+    0x94, 0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E,
+    0x73, 0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0,
+    0xE7, 0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9,
+    0x69, 0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x77, 0x4C,
+    0xA4, 0xA9, 0x49, 0xD9, 0x2D, 0x6F, 0xE9, 0x69, 0xFC, 0x97, 0x19, 0x97, 0x77, 0x77, 0x9F, 0xC9,
+    0x6F, 0xF9, 0x4E, 0x91, 0x9E, 0x3E, 0x4A, 0xD9, 0x19, 0xD9, 0x49, 0xDA, 0x1E, 0x6D, 0xA0, 0x9D,
+    0x95, 0x9D, 0x90, 0xAD, 0x69, 0xD9, 0x0A, 0xD6, 0xAD, 0x1E, 0x6D, 0xA1, 0xE5, 0xAD, 0x91, 0xAD,
+    0x93, 0x9D, 0xA2, 0x9E, 0x29, 0xE4, 0xFF, 0xC6, 0xAF, 0xC9, 0x71, 0x97, 0x10, 0x77, 0x77, 0x0C,
+    0x93, 0x9C, 0x72, 0x9E, 0x2A, 0xD9, 0x70, 0xAE, 0xA1, 0xF9, 0x7F, 0x90, 0x9F, 0x70, 0xEA, 0x2E,
+    0x97, 0x1A, 0x94, 0xC9, 0x77, 0x77, 0x39, 0x99, 0x97, 0x5A, 0xFE, 0xA7, 0x19, 0xFF, 0xE7, 0xAE,
+    0x94, 0xF5, 0xAD, 0xA7, 0xE9, 0x39, 0xDA, 0x70, 0x9E, 0x3E, 0x72, 0xE2, 0xAD, 0x97, 0x2E, 0x2E,
+    0x73, 0xE1, 0x9D, 0xA7, 0x3E, 0x1A, 0xD9, 0x73, 0xE1, 0xAD, 0x97, 0x3E, 0x1E, 0x73, 0x9D, 0xA1,
+    0xE7, 0x3A, 0xD9, 0x1E, 0x97, 0x2E, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0x9E, 0x70, 0x9D, 0xA4, 0xE9,
+    0x69, 0xE5, 0x9E, 0xA3, 0x9F, 0x79, 0xFF, 0xDA, 0x72, 0xAF, 0xDA, 0x77, 0x99, 0x73, 0x77, 0x7D,
+    0x2A, 0xC9, 0x6A, 0xD9, 0x09, 0xDA, 0x59, 0xE1, 0xE6, 0xE1, 0xE6, 0xAD, 0x19, 0xD7, 0xAA, 0x29,
+    0xA7, 0x77, 0x77, 0x09, 0xFC, 0x97, 0xFF, 0x95, 0xE9, 0x19, 0xE4, 0xE4, 0xAD, 0x92, 0x9D, 0x94,
+    0x9D, 0xA2, 0xE6, 0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xE6,
+    0xDA, 0x2E, 0x5A, 0xD9, 0x2A, 0xD9, 0x39, 0xDA, 0x39, 0xE2, 0x9E, 0x5F, 0xFC, 0x7A, 0xFC, 0x97,
+    0x29, 0x72, 0x77, 0x77, 0x19, 0xAF, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xF9, 0x39, 0xF9, 0x4D, 0xA5,
+    0xD9, 0x29, 0xE9, 0x59, 0xD9, 0x5D, 0x3E, 0x7A, 0xD6, 0xCA, 0x2E, 0x70, 0xE7, 0x29, 0xDA, 0x70,
+    0xE7, 0x2E, 0x71, 0xDA, 0x72, 0xDA, 0x70, 0x9D, 0x93, 0x99, 0x39, 0xD9, 0x70, 0xAF, 0xFC, 0x3A,
+    0xD9, 0x70, 0xFF, 0xC9, 0x3E, 0x71, 0xDA, 0x72, 0xE7, 0x09, 0xDA, 0x72, 0xE9, 0x79, 0xD9, 0x72,
+    0xAD, 0xA7, 0xAD, 0x7A, 0x29, 0xE7, 0xE6, 0xAC, 0x3E, 0xA6, 0xDA, 0x6D, 0x39, 0xEA, 0x49, 0xDA,
+    0x39, 0x9E, 0x49, 0xFF, 0xFF, 0xF9, 0x6A, 0xFF, 0xFF, 0xD7, 0x29, 0x99, 0x77, 0x00, 0x77, 0x72,
+    0x9F, 0xC9, 0x29, 0xAE, 0xA4, 0xFF, 0x90, 0xAD, 0xAE, 0xA2, 0xE9, 0x19, 0xFC, 0xA2, 0xE1, 0xE4,
+    0xAE, 0xA3, 0xDA, 0x09, 0xD9, 0x49, 0xE3, 0x9D, 0x90, 0xE6, 0xDA, 0x29, 0xE0, 0x9D, 0x95, 0x9D,
+    0x91, 0xAD, 0xA1, 0xAD, 0x69, 0xD9, 0xAE, 0x92, 0xAD, 0x6A, 0xFC, 0x94, 0xE6, 0xE9, 0x7E, 0x5A,
+    0xE7, 0x0A, 0xD9, 0x39, 0xF5, 0xAA, 0x09, 0xE2, 0x9F, 0xD1, 0x9A, 0xD9, 0x1F, 0xFA, 0x0F, 0xF9,
+    0x3A, 0xFC, 0x92, 0xFC, 0xA7, 0x99, 0x79, 0x60, 0x76, 0x97, 0x7A, 0xD7, 0x59, 0xF7, 0x4A, 0xF9,
+    0x73, 0xF9, 0x75, 0xA9, 0x77, 0x77, 0x29, 0x99, 0x99, 0x71, 0x9F, 0xFC, 0xA7, 0xFD, 0xAA, 0xF7,
+    0x09, 0xD9, 0x2A, 0xE7, 0xAD, 0x4E, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0x94, 0xE6, 0x9D,
+    0x4A, 0xD9, 0x6A, 0xD3, 0xAD, 0xA7, 0xE9, 0x9A, 0xEA, 0x70, 0xFE, 0xA7, 0x19, 0xDA, 0xAE, 0x72,
+    0xAD, 0x19, 0xD9, 0x71, 0xAD, 0x2E, 0x71, 0xE2, 0x9D, 0xA7, 0x0D, 0xA3, 0xE9, 0x69, 0xD9, 0x39,
+    0xE6, 0xAD, 0x5A, 0xE3, 0xAF, 0xD9, 0x3A, 0xE9, 0x0A, 0xFE, 0xA4, 0x9E, 0xA7, 0x72, 0x71, 0x97,
+    0x29, 0xD7, 0x1E, 0x70, 0xE7, 0x0A, 0xD7, 0x09, 0xD7, 0x2A, 0x77, 0x77, 0xAE, 0xA1, 0x9D, 0xA0,
+    0xAF, 0xC0, 0x9F, 0x3A, 0xCA, 0x0F, 0xA3, 0xD9, 0xAC, 0x96, 0xDA, 0xCA, 0x7F, 0x79, 0xE7, 0x0A,
+    0xDA, 0x70, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x00, 0x79, 0x99, 0x99, 0x71, 0x9F, 0xFC, 0xA7, 0xFD, 0xAA, 0xF7, 0x09, 0xD9, 0x2A, 0xE7, 0xAD,
+    0x4E, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0x94, 0xE6, 0x9D, 0x4A, 0xD9, 0x6A, 0xD3, 0xAD,
+    0xA7, 0xE9, 0x9A, 0xEA, 0x70, 0xFE, 0xA7, 0x19, 0xDA, 0xAE, 0x72, 0xAD, 0x19, 0xD9, 0x71, 0xAD,
+    0x2E, 0x71, 0xE2, 0x9D, 0xA7, 0x0D, 0xA3, 0xE9, 0x69, 0xD9, 0x39, 0xE6, 0xAD, 0x5A, 0xE3, 0xAF,
+    0xD9, 0x3A, 0xE9, 0x0A, 0xFE, 0xA4, 0x9E, 0xA7, 0x77, 0x29, 0x97, 0x79, 0xE7, 0x7E, 0x77, 0xDA,
+    0x76, 0x9D, 0x76, 0x9D, 0x77, 0x99, 0x72, 0x77, 0x0A, 0xEA, 0x19, 0xDA, 0x1A, 0xFC, 0x09, 0xF4,
+    0xAC, 0xA0, 0xFA, 0x4D, 0x9A, 0xC9, 0x7D, 0xAC, 0xA7, 0x0F, 0x70, 0x9E, 0x71, 0xAD, 0xA7, 0x1E,
+    0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2D, 0xA7, 0x2D, 0xA7, 0x19, 0xD9, 0x77, 0x70, 0x97,
+    0x3E, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x72, 0x99, 0x73, 0x69, 0xC5, 0xCA, 0x70, 0xDA,
+    0x29, 0xDA, 0x70, 0x9D, 0x90, 0x9D, 0x97, 0x2A, 0xDA, 0xD9, 0x74, 0xF9, 0x76, 0xD9, 0x77, 0x77,
+    0x09, 0x99, 0x99, 0x71, 0x9F, 0xFC, 0xA7, 0xFD, 0xAA, 0xF7, 0x09, 0xD9, 0x2A, 0xE7, 0xAD, 0x4E,
+    0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0x94, 0xE6, 0x9D, 0x4A, 0xD9, 0x6A, 0xD3, 0xAD, 0xA7,
+    0xE9, 0x9A, 0xEA, 0x70, 0xFE, 0xA7, 0x19, 0xDA, 0xAE, 0x72, 0xAD, 0x19, 0xD9, 0x71, 0xAD, 0x2E,
+    0x71, 0xE2, 0x9D, 0xA7, 0x0D, 0xA3, 0xE9, 0x69, 0xD9, 0x39, 0xE6, 0xAD, 0x5A, 0xE3, 0xAF, 0xD9,
+    0x3A, 0xE9, 0x0A, 0xFE, 0xA4, 0x9E, 0xA7, 0x72, 0x49, 0x49, 0x94, 0xAC, 0x92, 0xAD, 0x4A, 0xCA,
+    0x1A, 0xD6, 0xD9, 0x9D, 0x7A, 0xF9, 0x70, 0xE9, 0x71, 0x9A, 0x97, 0x77, 0x71, 0xAE, 0xA1, 0x9D,
+    0xA1, 0xAF, 0xC0, 0x9F, 0x4A, 0xCA, 0x0F, 0xA4, 0xD9, 0xAC, 0x97, 0xDA, 0xCA, 0x70, 0xF7, 0x09,
+    0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xDA, 0x72, 0xDA, 0x71,
+    0x9D, 0x97, 0x10, 0x74, 0x97, 0x4D, 0x97, 0x1A, 0xE9, 0x79, 0xFA, 0x79, 0xEA, 0x71, 0x99, 0x77,
+    0x74, 0x99, 0x97, 0x09, 0xFE, 0xA4, 0xAE, 0xAA, 0xFA, 0x2A, 0xD9, 0x4D, 0x92, 0xDA, 0x5D, 0x29,
+    0xDA, 0x5D, 0x29, 0xDA, 0x5A, 0x39, 0xE7, 0x3F, 0x97, 0x2F, 0xA7, 0x2F, 0xC9, 0x71, 0xAF, 0xA7,
+    0x2F, 0x97, 0x2A, 0xE2, 0xA9, 0x6E, 0x19, 0xCA, 0x6A, 0xD1, 0xAD, 0x6A, 0xD1, 0xAD, 0x6D, 0xA1,
+    0xAD, 0xA3, 0x9E, 0x29, 0xFF, 0xD9, 0x4A, 0xFD, 0xA7, 0x19, 0x97, 0x71, 0x99, 0x72, 0xD7, 0x1E,
+    0x70, 0xAD, 0x97, 0x9D, 0x97, 0x0D, 0x72, 0xA7, 0x77, 0x73, 0x9F, 0xA5, 0xFE, 0x4D, 0xA1, 0x9D,
+    0x39, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x70, 0xAE, 0xA7, 0x0A, 0xF7, 0x09, 0xEA, 0x71, 0xE7, 0x1A,
+    0xD2, 0x9C, 0x93, 0x9D, 0x2A, 0xDA, 0x2D, 0xA2, 0x9F, 0xF4, 0x9F, 0xC9, 0x70, 0x97, 0x71, 0x99,
+    0x73, 0xEA, 0x71, 0xFC, 0x97, 0xE0, 0xE6, 0xE2, 0xAC, 0xA4, 0xAC, 0xA4, 0xC9, 0x77, 0x69, 0x99,
+    0x70, 0x9F, 0xEA, 0x4A, 0xEA, 0xAF, 0xA2, 0xAD, 0x94, 0xD9, 0x2D, 0xA5, 0xD2, 0x9D, 0xA5, 0xD2,
+    0x9D, 0xA5, 0xA3, 0x9E, 0x73, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xF9, 0x72,
+    0xAE, 0x2A, 0x96, 0xE1, 0x9C, 0xA6, 0xAD, 0x1A, 0xD6, 0xAD, 0x1A, 0xD6, 0xDA, 0x1A, 0xDA, 0x39,
+    0xE2, 0x9F, 0xFD, 0x94, 0xAF, 0xDA, 0x71, 0x99, 0x70, 0x77, 0x39, 0xDA, 0x70, 0xF9, 0x6D, 0xAE,
+    0x5D, 0xA0, 0x9D, 0x4A, 0xD2, 0xAC, 0x93, 0xCA, 0x4C, 0x77, 0x77, 0x9F, 0xA5, 0xFE, 0x4D, 0xA1,
+    0x9D, 0x39, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x70, 0xAE, 0xA7, 0x0A, 0xF7, 0x09, 0xEA, 0x71, 0xE7,
+    0x1A, 0xD2, 0x9C, 0x93, 0x9D, 0x2A, 0xDA, 0x2D, 0xA2, 0x9F, 0xF4, 0x9F, 0xC9, 0x70, 0x97, 0x79,
+    0x99, 0x70, 0x9F, 0xEA, 0x4A, 0xEA, 0xAF, 0xA2, 0xAD, 0x94, 0xD9, 0x2D, 0xA5, 0xD2, 0x9D, 0xA5,
+    0xD2, 0x9D, 0xA5, 0xA3, 0x9E, 0x73, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xF9,
+    0x72, 0xAE, 0x2A, 0x96, 0xE1, 0x9C, 0xA6, 0xAD, 0x1A, 0xD6, 0xAD, 0x1A, 0xD6, 0xDA, 0x1A, 0xDA,
+    0x39, 0xE2, 0x9F, 0xFD, 0x94, 0xAF, 0xDA, 0x71, 0x99, 0x74, 0x9A, 0x73, 0xAE, 0x97, 0x29, 0xD9,
+    0x73, 0xD7, 0x3D, 0xA7, 0x1A, 0xD9, 0x72, 0x99, 0x71, 0x77, 0x09, 0xFA, 0x4F, 0xE3, 0xDA, 0x19,
+    0xD2, 0x9D, 0x70, 0x9D, 0x97, 0x0E, 0x97, 0xAE, 0xA7, 0xAF, 0x79, 0xEA, 0x70, 0xE7, 0x0A, 0xD1,
+    0x9C, 0x93, 0x9D, 0x1A, 0xDA, 0x2D, 0xA1, 0x9F, 0xF3, 0x9F, 0xC9, 0x79, 0x71, 0x9A, 0x97, 0x9E,
+    0xA7, 0x0A, 0xD7, 0x0D, 0xA7, 0xAD, 0x69, 0xDA, 0x70, 0xA9, 0x70, 0x5A, 0x94, 0xAC, 0x94, 0x9D,
+    0x3E, 0x6E, 0x1E, 0x79, 0xFC, 0xA7, 0x1A, 0xEA, 0x73, 0xAC, 0xA7, 0x77, 0x49, 0x99, 0x71, 0x9F,
+    0xEA, 0x5A, 0xEA, 0xAF, 0xA3, 0xAD, 0x94, 0xD9, 0x3D, 0xA5, 0xD3, 0x9D, 0xA5, 0xD3, 0x9D, 0xA5,
+    0xA4, 0x9E, 0x74, 0xF9, 0x73, 0xFA, 0x73, 0xFC, 0x97, 0x2A, 0xFA, 0x73, 0xF9, 0x73, 0xAE, 0x3A,
+    0x96, 0xE2, 0x9C, 0xA6, 0xAD, 0x2A, 0xD6, 0xAD, 0x2A, 0xD6, 0xDA, 0x2A, 0xDA, 0x39, 0xE3, 0x9F,
+    0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99, 0x70, 0x73, 0x94, 0x9C, 0xA2, 0x9D, 0x93, 0x9D, 0x2D, 0x95,
+    0xDA, 0x0D, 0x96, 0x9F, 0xA7, 0x0E, 0xA7, 0x2A, 0xA7, 0x77, 0x75, 0x9F, 0xA6, 0xFE, 0x5D, 0xA1,
+    0x9D, 0x49, 0xD7, 0x29, 0xD9, 0x72, 0xE9, 0x71, 0xAE, 0xA7, 0x1A, 0xF7, 0x19, 0xEA, 0x72, 0xE7,
+    0x2A, 0xD3, 0x9C, 0x93, 0x9D, 0x3A, 0xDA, 0x2D, 0xA3, 0x9F, 0xF5, 0x9F, 0xC9, 0x71, 0x97, 0x00,
+    0x77, 0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0x09, 0xD3, 0xAD, 0x39, 0xD0, 0x9C, 0xA3, 0xE3, 0x9C, 0xA0,
+    0xAC, 0x93, 0xDA, 0x39, 0xC9, 0x09, 0xC3, 0x9D, 0x93, 0x9A, 0x7A, 0xD9, 0x75, 0xE7, 0x6E, 0x76,
+    0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76,
+    0xE7, 0x39, 0xAF, 0xD9, 0x70, 0xFF, 0x97, 0x77, 0x49, 0xA9, 0x75, 0x9E, 0xA7, 0x59, 0xE7, 0x6D,
+    0xA7, 0x5A, 0xD7, 0x49, 0xDA, 0x75, 0x9A, 0x97, 0x50, 0x5A, 0xA7, 0x0A, 0xCA, 0x70, 0xD9, 0x79,
+    0xD6, 0x9A, 0xFE, 0x90, 0xFF, 0xD4, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D,
+    0x97, 0x9D, 0x97, 0x9D, 0x70, 0xAD, 0x39, 0x3D, 0xA2, 0xAC, 0x92, 0xE9, 0x9E, 0x3F, 0xE4, 0x9F,
+    0x97, 0x97, 0x19, 0xA7, 0x0F, 0x70, 0x9D, 0x97, 0x0D, 0x70, 0xD9, 0x6A, 0xD9, 0x79, 0x97, 0x00,
+    0x5A, 0xA4, 0x9C, 0x97, 0xD9, 0x2A, 0xD9, 0x7A, 0xD1, 0xAD, 0x72, 0xFD, 0x73, 0x9F, 0x75, 0x9D,
+    0x77, 0x77, 0x73, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0x9D, 0x3A, 0xD3, 0x9D, 0x09, 0xCA, 0x3E, 0x39,
+    0xCA, 0x0A, 0xC9, 0x3D, 0xA3, 0x9C, 0x90, 0x9C, 0x39, 0xD9, 0x39, 0xA7, 0xAD, 0x97, 0x5E, 0x76,
+    0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A,
+    0xD7, 0x6E, 0x73, 0x9A, 0xFD, 0x97, 0x0F, 0xF9, 0x70, 0x77, 0x6A, 0xC7, 0x2D, 0x97, 0x1D, 0x71,
+    0x9C, 0xA6, 0xAA, 0x0A, 0xC6, 0xAC, 0xA0, 0xCA, 0x6D, 0x97, 0x09, 0xD7, 0x9A, 0xFE, 0x91, 0xFF,
+    0xD5, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x97, 0x09,
+    0xD7, 0x1A, 0xD3, 0x94, 0xDA, 0x2A, 0xC9, 0x3E, 0x99, 0xE4, 0xFE, 0x59, 0xF9, 0x70, 0x97, 0x77,
+    0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0x09, 0xD3, 0xAD, 0x39, 0xD0, 0x9C, 0xA3, 0xE3, 0x9C, 0xA0, 0xAC,
+    0x93, 0xDA, 0x39, 0xC9, 0x09, 0xC3, 0x9D, 0x93, 0x9A, 0x7A, 0xD7, 0x6E, 0x76, 0xE7, 0x3F, 0xFA,
+    0x70, 0xFF, 0x97, 0x2A, 0xD7, 0x6E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7,
+    0x39, 0xAF, 0xD9, 0x70, 0xFF, 0x97, 0x5A, 0xA7, 0x0A, 0xCA, 0x70, 0xD9, 0x79, 0xD6, 0x9A, 0xFE,
+    0x90, 0xFF, 0xD4, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD5, 0xAF, 0xFC, 0x19, 0x9A, 0xDA, 0x99,
+    0x99, 0x39, 0xD9, 0x79, 0xD7, 0x0A, 0xD3, 0x93, 0xDA, 0x2A, 0xC9, 0x2E, 0x99, 0xE3, 0xFE, 0x49,
+    0xF9, 0x79, 0x60, 0x77, 0x76, 0xE9, 0x1C, 0x97, 0x4F, 0xC9, 0xAC, 0xA7, 0x39, 0xD0, 0xFC, 0x75,
+    0xC2, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFE, 0xA4, 0xFE, 0x1A, 0xFC, 0xA5, 0xAF, 0xA4, 0xE7,
+    0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xDA, 0x70, 0xAD, 0x59, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D,
+    0x95, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xD9, 0x70, 0xAC, 0xA5, 0xAD, 0x97, 0x0D, 0xA5,
+    0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6E, 0x70, 0xAD, 0x6E, 0x70, 0xDA, 0x6E, 0x79, 0xD7, 0xE9,
+    0x59, 0xDA, 0x7A, 0xEA, 0x29, 0xAD, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA9, 0x77, 0x99, 0x75,
+    0x79, 0x74, 0x9E, 0x2C, 0x96, 0xFC, 0x9D, 0x95, 0xAC, 0xA0, 0xFC, 0x69, 0xC2, 0xDA, 0x77, 0x77,
+    0x77, 0x3A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD, 0x49, 0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A,
+    0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD, 0x4D, 0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A,
+    0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x0E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A,
+    0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x7A, 0xAA, 0xAA, 0xAA, 0xA7, 0x5F, 0xF9, 0x74,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFE, 0xA4, 0xFE, 0x1A, 0xFC, 0xA5, 0xAF,
+    0xA4, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xDA, 0x70, 0xAD, 0x59, 0xD9, 0x70, 0xDA, 0x5A,
+    0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xD9, 0x70, 0xAC, 0xA5, 0xAD, 0x97,
+    0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6E, 0x70, 0xAD, 0x6E, 0x70, 0xDA, 0x6E, 0x79,
+    0xD7, 0xE9, 0x59, 0xDA, 0x7A, 0xEA, 0x29, 0xAD, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA9, 0x77,
+    0x99, 0x75, 0x5A, 0xAA, 0xAA, 0xAA, 0x96, 0x9F, 0xF7, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77,
+    0x2A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD, 0x49, 0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4,
+    0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD, 0x4D, 0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3,
+    0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x0E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD,
+    0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x77, 0x75, 0xD4, 0x9A, 0x74, 0xDA, 0x2A, 0xC9, 0x74,
+    0xFE, 0xA7, 0x6F, 0xCA, 0x77, 0x19, 0x97, 0x77, 0x77, 0x75, 0xFE, 0xA4, 0xFE, 0x1A, 0xFC, 0xA5,
+    0xAF, 0xA4, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xDA, 0x70, 0xAD, 0x59, 0xD9, 0x70, 0xDA,
+    0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D, 0x59, 0xD9, 0x70, 0xAC, 0xA5, 0xAD,
+    0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6E, 0x70, 0xAD, 0x6E, 0x70, 0xDA, 0x6E,
+    0x79, 0xD7, 0xE9, 0x59, 0xDA, 0x7A, 0xEA, 0x29, 0xAD, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA9,
+    0x77, 0x99, 0x75, 0x77, 0x5D, 0x49, 0xA6, 0xD9, 0x2A, 0xC9, 0x6F, 0xEA, 0x79, 0xFC, 0x97, 0x39,
+    0x97, 0x77, 0x75, 0xAF, 0x59, 0xD0, 0xAF, 0xC5, 0xDA, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0x9D, 0x4D,
+    0xA4, 0xAD, 0x4D, 0x94, 0xDA, 0x3A, 0xD5, 0xD9, 0x3E, 0x4A, 0xD4, 0xD9, 0x4E, 0x39, 0xD4, 0xAD,
+    0xA3, 0xAD, 0x39, 0xEA, 0x3A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC0, 0xE9, 0x0A, 0xD0, 0xDA, 0xAC,
+    0xA0, 0xAF, 0xD1, 0xFC, 0x2F, 0xA2, 0xAD, 0xA5, 0x97, 0x20, 0x72, 0x99, 0x97, 0x71, 0xFA, 0x77,
+    0xD9, 0x0D, 0x97, 0x59, 0xCA, 0x19, 0xCA, 0x75, 0x9C, 0xA1, 0x9C, 0x97, 0x6D, 0x99, 0xD7, 0x79,
+    0xF9, 0x77, 0x19, 0x97, 0x77, 0x7F, 0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D,
+    0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7, 0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E,
+    0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7,
+    0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7, 0x0A, 0xD6, 0xE7, 0x0D, 0xA6, 0xE7, 0x9D, 0x7E, 0x95, 0x9D,
+    0xA7, 0xAE, 0xA2, 0x9A, 0xDA, 0x71, 0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x97, 0x79, 0x97, 0x50, 0x79,
+    0xDA, 0x72, 0xAF, 0xC7, 0x1D, 0x1D, 0x97, 0x9C, 0x91, 0xAC, 0x97, 0xAC, 0x91, 0xAC, 0x70, 0x9D,
+    0x9A, 0xD7, 0x1A, 0xF7, 0x49, 0x97, 0x75, 0xAF, 0x59, 0xD0, 0xAF, 0xC5, 0xDA, 0x3A, 0xD4, 0x9D,
+    0x93, 0xE4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xDA, 0x3A, 0xD5, 0xD9, 0x3E, 0x4A, 0xD4, 0xD9,
+    0x4E, 0x39, 0xD4, 0xAD, 0xA3, 0xAD, 0x39, 0xEA, 0x3A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC0, 0xE9,
+    0x0A, 0xD0, 0xDA, 0xAC, 0xA0, 0xAF, 0xD1, 0xFC, 0x2F, 0xA2, 0xAD, 0xA5, 0x97, 0x20, 0x77, 0x77,
+    0x1C, 0x93, 0x9C, 0x73, 0x9E, 0x2A, 0xD9, 0x71, 0xAE, 0xA1, 0xF9, 0x70, 0xF9, 0x1F, 0x71, 0xEA,
+    0x2E, 0x97, 0x2A, 0x94, 0xC9, 0x77, 0x77, 0x77, 0x2F, 0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA,
+    0x4E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7, 0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD,
+    0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70,
+    0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7, 0x0A, 0xD6, 0xE7, 0x0D, 0xA6, 0xE7, 0x9D,
+    0x7E, 0x95, 0x9D, 0xA7, 0xAE, 0xA2, 0x9A, 0xDA, 0x71, 0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x97, 0x79,
+    0x97, 0x50, 0x77, 0x7A, 0xC9, 0x19, 0xC9, 0x69, 0xDA, 0x1E, 0x6E, 0x1E, 0x6E, 0x1A, 0xD9, 0x5A,
+    0xD1, 0x9D, 0x96, 0x9A, 0x3C, 0x77, 0x77, 0x4A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD, 0x49,
+    0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD, 0x4D,
+    0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x0E,
+    0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x77, 0x6F,
+    0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7,
+    0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5,
+    0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7,
+    0x0A, 0xD6, 0xE7, 0x0D, 0x96, 0xE7, 0x9D, 0x7E, 0x95, 0x9D, 0x97, 0xAE, 0xA2, 0x9A, 0xDA, 0x71,
+    0xFF, 0xDA, 0x73, 0xAF, 0xE7, 0x70, 0x9D, 0x97, 0x71, 0xD9, 0x77, 0x19, 0xD7, 0x72, 0xAD, 0x77,
+    0x29, 0xFC, 0x77, 0x0A, 0xE9, 0x77, 0x77, 0x00, 0x77, 0x0A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3,
+    0xAD, 0x49, 0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4,
+    0xAD, 0x4D, 0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90,
+    0x9C, 0x0E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xE5, 0x95, 0xD7,
+    0x4D, 0x74, 0x9C, 0xA7, 0x4A, 0xCA, 0x74, 0xAE, 0xA9, 0x72, 0xF7, 0x71, 0x77, 0x99, 0x77, 0x72,
+    0xE9, 0x77, 0x70, 0xFC, 0x97, 0x76, 0xE0, 0xE7, 0x75, 0xDA, 0x2D, 0xA7, 0x73, 0xAC, 0x94, 0xC9,
+    0x77, 0x77, 0x77, 0x77, 0x49, 0xFE, 0xA4, 0xAC, 0x5F, 0xE9, 0x0A, 0xFC, 0xA4, 0x9D, 0x5A, 0xFC,
+    0x92, 0x9D, 0xA6, 0xE9, 0x6D, 0xA4, 0x9D, 0xA5, 0x9E, 0x95, 0x9D, 0x59, 0xDA, 0x5F, 0x95, 0xDA,
+    0x6D, 0xA4, 0x9F, 0xA4, 0x9D, 0x7E, 0x4D, 0xAD, 0xA4, 0xDA, 0x7E, 0x39, 0xD0, 0xDA, 0x39, 0xD7,
+    0x0E, 0x3D, 0xA0, 0xE3, 0xAC, 0xA7, 0x0E, 0x29, 0xD1, 0xAD, 0x3D, 0x71, 0xE2, 0xDA, 0x1A, 0xD2,
+    0xAC, 0xA7, 0x1A, 0xD2, 0xD2, 0x9D, 0x2D, 0x72, 0xAD, 0x1A, 0xCA, 0x29, 0xD1, 0xAC, 0xA7, 0x2A,
+    0xD1, 0xD3, 0x9D, 0x90, 0xD7, 0x39, 0xD0, 0xAC, 0xA4, 0xD9, 0x9D, 0x73, 0x9D, 0x9D, 0x5D, 0x9D,
+    0x97, 0x39, 0xFA, 0x5F, 0xC7, 0x5F, 0x6F, 0x97, 0x5E, 0x96, 0xF7, 0x6E, 0x7A, 0xD9, 0x77, 0x77,
+    0x70, 0x77, 0x77, 0x0A, 0xD9, 0x77, 0x09, 0xF7, 0x70, 0xD9, 0xD9, 0x76, 0xD9, 0x0A, 0xD7, 0x5D,
+    0xA2, 0xD7, 0x49, 0xC9, 0x39, 0xA7, 0x77, 0x77, 0x72, 0x9E, 0x4E, 0x4E, 0x09, 0xFA, 0x3A, 0xD9,
+    0x3A, 0xDA, 0x2E, 0x4D, 0xA3, 0x9D, 0xA2, 0xAD, 0x93, 0xE4, 0xDA, 0x3D, 0x93, 0xE4, 0xD9, 0x3D,
+    0xA2, 0x9E, 0x92, 0x9D, 0x4E, 0x2A, 0xE9, 0x2D, 0xA4, 0xAD, 0x2F, 0xA2, 0xD5, 0x9D, 0x19, 0xCA,
+    0xAC, 0xA1, 0xAC, 0xA6, 0xD1, 0xD0, 0x9D, 0x1D, 0x7D, 0x09, 0xCA, 0x09, 0xD0, 0xAC, 0xA7, 0xD9,
+    0xD2, 0xD9, 0xD7, 0x0F, 0x3F, 0x71, 0xE9, 0x3E, 0x72, 0xD9, 0x4D, 0x77, 0x74, 0x72, 0x99, 0x77,
+    0x0A, 0xE7, 0x6A, 0xFA, 0x74, 0xAD, 0x9A, 0xD9, 0x72, 0xAD, 0x91, 0xAD, 0x71, 0x9C, 0xA4, 0xAA,
+    0x77, 0x77, 0x74, 0xFF, 0x2F, 0xE9, 0x0A, 0xFC, 0xA3, 0x9F, 0xC9, 0x3E, 0x7D, 0xA5, 0xE6, 0xE6,
+    0x9D, 0xA4, 0xAD, 0x70, 0xE3, 0x9D, 0x97, 0x0A, 0xD3, 0xDA, 0x72, 0xDA, 0x1A, 0xD7, 0x3E, 0x09,
+    0xD7, 0x49, 0xDA, 0xD9, 0x75, 0xFA, 0x76, 0xAE, 0x77, 0xAD, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70,
+    0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x6A, 0xFD, 0xA7, 0x2F, 0xFA, 0x70, 0x77, 0x74, 0xE7, 0x5A,
+    0xEA, 0x73, 0xAD, 0xAD, 0x72, 0x9D, 0x1D, 0xA7, 0x09, 0xD2, 0x9D, 0x70, 0xAC, 0x4A, 0x97, 0x77,
+    0x77, 0x19, 0xAD, 0x94, 0xE3, 0x9F, 0xC4, 0xAD, 0xA5, 0xAD, 0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E,
+    0x4D, 0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92, 0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71,
+    0xAC, 0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C, 0xA7, 0x29, 0xCA, 0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73,
+    0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x5D, 0x97, 0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7,
+    0x29, 0xFA, 0x74, 0xAC, 0xA7, 0x50, 0x79, 0x93, 0x99, 0x72, 0xE9, 0x1E, 0x97, 0x09, 0xE1, 0x9E,
+    0x72, 0xDA, 0x2D, 0xA7, 0x77, 0x77, 0x77, 0x70, 0xFF, 0x2F, 0xE9, 0x0A, 0xFC, 0xA3, 0x9F, 0xC9,
+    0x3E, 0x7D, 0xA5, 0xE6, 0xE6, 0x9D, 0xA4, 0xAD, 0x70, 0xE3, 0x9D, 0x97, 0x0A, 0xD3, 0xDA, 0x72,
+    0xDA, 0x1A, 0xD7, 0x3E, 0x09, 0xD7, 0x49, 0xDA, 0xD9, 0x75, 0xFA, 0x76, 0xAE, 0x77, 0xAD, 0x97,
+    0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x6A, 0xFD, 0xA7, 0x2F, 0xFA,
+    0x70, 0x75, 0x97, 0x7A, 0xCA, 0x74, 0x9E, 0xA7, 0x3F, 0xC7, 0x3E, 0xA9, 0x74, 0xA9, 0x77, 0x77,
+    0x76, 0xAF, 0xFF, 0x93, 0xFF, 0xFC, 0x92, 0x9D, 0x95, 0x9E, 0x39, 0xCA, 0x6E, 0x4A, 0xC9, 0x5E,
+    0x6A, 0x5E, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0xA7, 0x49, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x97, 0x4A,
+    0xD9, 0x74, 0xAD, 0xA7, 0x49, 0xE6, 0xAC, 0x4E, 0x7D, 0x3E, 0x7A, 0xD2, 0xEA, 0x29, 0x99, 0x99,
+    0xDA, 0x19, 0xFF, 0xFD, 0x3F, 0xFF, 0xD7, 0x74, 0x71, 0x99, 0x73, 0xD7, 0x2E, 0x71, 0xAD, 0x97,
+    0x09, 0xD9, 0x71, 0xD9, 0x72, 0xA7, 0x77, 0x74, 0xEA, 0x92, 0xD2, 0xFE, 0x99, 0xD9, 0x1D, 0xAA,
+    0xFD, 0xA1, 0x9C, 0x93, 0xAD, 0xA3, 0xC4, 0xE7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7,
+    0x19, 0xD7, 0x19, 0xD9, 0x70, 0x9D, 0x95, 0xC1, 0x9F, 0xCA, 0xA9, 0x9D, 0x90, 0xFF, 0xF9, 0x0A,
+    0xC9, 0x09, 0xAF, 0xCA, 0x71, 0x94, 0x77, 0x73, 0xAD, 0x75, 0x9E, 0x97, 0x4A, 0xE7, 0x6D, 0x97,
+    0x77, 0x77, 0x77, 0x6A, 0xFF, 0xF9, 0x3F, 0xFF, 0xC9, 0x29, 0xD9, 0x59, 0xE3, 0x9C, 0xA6, 0xE4,
+    0xAC, 0x95, 0xE6, 0xA5, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x6A, 0xC4, 0xE7, 0xD3, 0xE7, 0xAD, 0x2E, 0xA2,
+    0x99, 0x99, 0x9D, 0xA1, 0x9F, 0xFF, 0xD3, 0xFF, 0xFD, 0x77, 0x40, 0x7A, 0xC7, 0x2E, 0x97, 0x09,
+    0xE7, 0x2D, 0x97, 0x77, 0x77, 0x70, 0xEA, 0x92, 0xD2, 0xFE, 0x99, 0xD9, 0x1D, 0xAA, 0xFD, 0xA1,
+    0x9C, 0x93, 0xAD, 0xA3, 0xC4, 0xE7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x19, 0xD7,
+    0x19, 0xD9, 0x70, 0x9D, 0x95, 0xC1, 0x9F, 0xCA, 0xA9, 0x9D, 0x90, 0xFF, 0xF9, 0x0A, 0xC9, 0x09,
+    0xAF, 0xCA, 0x71, 0x94, 0x6A, 0xA4, 0x9C, 0x97, 0xD9, 0x2A, 0xD7, 0x0E, 0x1A, 0xD7, 0x2F, 0xD7,
+    0x39, 0xF7, 0x59, 0xD7, 0x77, 0x77, 0x5A, 0xFF, 0xF9, 0x3F, 0xFF, 0xC9, 0x29, 0xD9, 0x59, 0xE3,
+    0x9C, 0xA6, 0xE4, 0xAC, 0x95, 0xE6, 0xA5, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x6A, 0xC4, 0xE7, 0xD3, 0xE7,
+    0xAD, 0x2E, 0xA2, 0x99, 0x99, 0x9D, 0xA1, 0x9F, 0xFF, 0xD3, 0xFF, 0xFD, 0x77, 0x40, 0x73, 0x94,
+    0x9C, 0xA3, 0xD9, 0x4D, 0x2D, 0x95, 0xDA, 0x0D, 0x96, 0x9F, 0xA7, 0x0A, 0xDA, 0x72, 0xAA, 0x77,
+    0x77, 0x3E, 0xA9, 0x2D, 0x2F, 0xE9, 0x9D, 0x91, 0xDA, 0xAF, 0xDA, 0x19, 0xC9, 0x3A, 0xDA, 0x3C,
+    0x4E, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x71, 0x9D, 0x97, 0x09, 0xD9,
+    0x5C, 0x19, 0xFC, 0xAA, 0x99, 0xD9, 0x0F, 0xFF, 0x90, 0xAC, 0x90, 0x9A, 0xFC, 0xA7, 0x19, 0x40,
+    0x77, 0x77, 0x1A, 0xF9, 0x74, 0xFE, 0x73, 0xAC, 0xA2, 0xCA, 0x72, 0x9D, 0x77, 0x0A, 0xD7, 0x70,
+    0xD9, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x0D, 0x97, 0x79, 0xD7, 0x70,
+    0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77, 0x9D, 0x77, 0x0A, 0xD7, 0x70, 0xDA, 0x77,
+    0x0D, 0x97, 0x79, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD7, 0x3A, 0x3D, 0xA7,
+    0x2A, 0xDA, 0x9A, 0xD7, 0x3A, 0xFD, 0x75, 0x9A, 0xCA, 0x97, 0x50, 0x77, 0x29, 0xAA, 0x77, 0x3E,
+    0x77, 0x3E, 0x72, 0x99, 0x99, 0x3A, 0xD9, 0x7A, 0xFE, 0xA0, 0x9D, 0xA6, 0x9F, 0xFF, 0xC9, 0x6A,
+    0xE9, 0x4F, 0x7A, 0xDA, 0x7E, 0x95, 0x9D, 0xA7, 0x09, 0xE5, 0xE7, 0x2E, 0x4A, 0xD9, 0x72, 0xE4,
+    0xE7, 0x3E, 0x39, 0xDA, 0x73, 0xE3, 0xAD, 0x97, 0x3E, 0x3A, 0xD9, 0x73, 0xE3, 0xE7, 0x39, 0xDA,
+    0x3E, 0x73, 0xAD, 0x93, 0xE9, 0x72, 0xE4, 0xAD, 0x97, 0x1A, 0xD9, 0x49, 0xE7, 0x09, 0xDA, 0x6E,
+    0x96, 0x9E, 0x79, 0xEA, 0x39, 0xF7, 0x19, 0xFF, 0xDA, 0x74, 0xAF, 0xDA, 0x77, 0x19, 0x97, 0x50,
+    0x77, 0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x59, 0xFC, 0x9E, 0x5F, 0xFC, 0xA5, 0xE9, 0x19, 0xE5, 0xE4,
+    0xAD, 0x93, 0x9D, 0x94, 0x9D, 0xA3, 0xE6, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0x9D, 0x92,
+    0xAD, 0x6A, 0xD3, 0xE6, 0xE3, 0xE5, 0xAD, 0x93, 0xAD, 0x49, 0xDA, 0x49, 0xE2, 0x9E, 0x6F, 0xFC,
+    0x70, 0xAF, 0xC9, 0x73, 0x97, 0x30, 0x79, 0x99, 0x99, 0x71, 0x9A, 0xFF, 0xCA, 0x49, 0xFE, 0xAA,
+    0xAF, 0x3E, 0x90, 0xE3, 0xAE, 0x19, 0xD9, 0x1D, 0xA4, 0xE2, 0xAC, 0x19, 0xD9, 0x4A, 0xD6, 0x9D,
+    0x94, 0xAD, 0x6A, 0xD5, 0xE6, 0xE4, 0x9D, 0x96, 0xDA, 0x4E, 0x69, 0xD9, 0x2A, 0xE7, 0xAF, 0xFA,
+    0x70, 0xFE, 0xA7, 0x2E, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x7E, 0x77, 0xE7, 0x49, 0xAF,
+    0xD9, 0x71, 0xFF, 0x97, 0x00, 0x77, 0x73, 0xAF, 0x97, 0x2F, 0xE7, 0x1A, 0xCA, 0x2C, 0xA7, 0x09,
+    0xD7, 0x6A, 0xCA, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x2A, 0xE7, 0xAD, 0x1F, 0xD6, 0xDA, 0x0D,
+    0x99, 0xE6, 0xD9, 0xD2, 0xAD, 0x94, 0x9D, 0xAC, 0x39, 0xD9, 0x4A, 0xE9, 0x39, 0xD9, 0x4A, 0xE4,
+    0x9D, 0x5E, 0x5A, 0xD5, 0xE5, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xE4, 0x9D, 0x6E,
+    0x92, 0xAD, 0x96, 0xFF, 0xC9, 0x69, 0xDA, 0xFC, 0x70, 0xAD, 0x29, 0x72, 0xDA, 0x76, 0xD9, 0x76,
+    0xD9, 0x75, 0xAD, 0x97, 0x4F, 0xE9, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0x71, 0x5A, 0xA7, 0x0A, 0xCA,
+    0x70, 0xD9, 0x79, 0xD6, 0x9A, 0xFE, 0x90, 0xFF, 0xD4, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7,
+    0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0x9D, 0x70, 0xAD, 0x39, 0x3E, 0x2A, 0xC9, 0x2E, 0x99, 0xE3,
+    0xFF, 0x39, 0xFA, 0xCA, 0x59, 0x19, 0xC9, 0x70, 0xD7, 0x09, 0xCA, 0x4C, 0x2D, 0x93, 0xEA, 0xDA,
+    0x4F, 0xCA, 0x6A, 0xAA, 0x95, 0x77, 0x5A, 0xFF, 0xFD, 0x2F, 0xFF, 0xF1, 0xF2, 0xAD, 0x39, 0xD1,
+    0xE3, 0xE3, 0x9C, 0xA1, 0xD9, 0x3D, 0xA3, 0x9C, 0x92, 0x93, 0x9D, 0x93, 0x9A, 0x70, 0xAD, 0x97,
+    0x6E, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7E, 0x77, 0xDA, 0x76, 0x9D,
+    0x97, 0x6A, 0xD7, 0x7E, 0x74, 0x9A, 0xFD, 0x97, 0x1F, 0xF9, 0x70, 0x77, 0x6A, 0xF9, 0x7F, 0xE6,
+    0xAC, 0xA2, 0xCA, 0x6D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x71, 0x9A, 0xFE, 0x93, 0xFF, 0xD7,
+    0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x97, 0x29, 0xD7,
+    0x3A, 0xD3, 0x96, 0xDA, 0x2A, 0xC9, 0x5E, 0x99, 0xE6, 0xFE, 0x79, 0xF9, 0x72, 0x97, 0x10, 0x77,
+    0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0x09, 0xD3, 0xAD, 0x39, 0xD0, 0x9C, 0xA3, 0xE3, 0x9C, 0xA0, 0xAC,
+    0x93, 0xDA, 0x39, 0xC9, 0x09, 0xC3, 0x9D, 0x93, 0x9A, 0x7A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xDA,
+    0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7,
+    0x6D, 0xA7, 0x6D, 0x97, 0x59, 0xD9, 0x75, 0x9D, 0x39, 0x72, 0xD9, 0x1D, 0x72, 0xFE, 0x72, 0x9F,
+    0xC9, 0x74, 0xAA, 0xA7, 0x00, 0x77, 0x3A, 0xC7, 0x73, 0x9D, 0xA7, 0x72, 0x9D, 0x97, 0x71, 0x9E,
+    0x1F, 0xEA, 0x4F, 0xDA, 0x2A, 0xFC, 0xA5, 0xAE, 0xA6, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69,
+    0xDA, 0x70, 0xAD, 0x69, 0xD9, 0x70, 0xDA, 0x6A, 0xD7, 0x1D, 0x96, 0xE7, 0x09, 0xD7, 0xDA, 0x70,
+    0x9D, 0x69, 0xD9, 0x70, 0xAC, 0xA6, 0xAD, 0x97, 0x0D, 0xA6, 0xAD, 0x71, 0xD9, 0x6E, 0x70, 0x9D,
+    0x7E, 0x70, 0xAD, 0x7E, 0x70, 0xDA, 0x7E, 0x79, 0xD7, 0x0E, 0x95, 0x9D, 0xA7, 0x0A, 0xEA, 0x29,
+    0xAD, 0xA7, 0x2F, 0xFD, 0xA7, 0x4A, 0xFD, 0xA9, 0x77, 0x09, 0x97, 0x60, 0x77, 0x77, 0x19, 0xD9,
+    0x76, 0x9D, 0x97, 0x59, 0xE1, 0xAF, 0x59, 0xEA, 0x1A, 0xFC, 0x5E, 0x6A, 0xD4, 0x9D, 0x96, 0xAD,
+    0x49, 0xD7, 0xDA, 0x4A, 0xD7, 0xD9, 0x4D, 0xA6, 0xAD, 0x5D, 0x96, 0xE4, 0xAD, 0x7D, 0x94, 0xE6,
+    0x9D, 0x4A, 0xDA, 0x6A, 0xD3, 0x9E, 0xA6, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x3E, 0x90, 0xAD,
+    0x0D, 0xAA, 0xCA, 0x3A, 0xFD, 0x1F, 0xC5, 0xFA, 0x2A, 0xDA, 0x70, 0x97, 0x50, 0x59, 0xC9, 0x2E,
+    0x2A, 0xE2, 0xAD, 0x92, 0x9D, 0x39, 0xC6, 0x39, 0x3A, 0xCA, 0x19, 0xDA, 0x1D, 0xA1, 0xDA, 0x1A,
+    0xCA, 0x39, 0x30, 0x76, 0xE5, 0xAE, 0xA3, 0xAD, 0xAD, 0x29, 0xD1, 0xDA, 0x09, 0xD9, 0x19, 0xD0,
+    0xAC, 0x4A, 0x90, 0x29, 0x69, 0xE9, 0x1C, 0x90, 0xFC, 0x9D, 0x99, 0xCA, 0x0F, 0xC1, 0xC2, 0xE7,
+    0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0x9F, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xA0, 0x72, 0xD4, 0x9A,
+    0x0D, 0xA2, 0xAC, 0x90, 0xFE, 0xA2, 0xFC, 0x95, 0x99, 0x30, 0x0A, 0xC9, 0xAF, 0xDA, 0xAC, 0xA0,
+    0x1A, 0x39, 0xA0, 0x9E, 0x19, 0xDA, 0xAD, 0xA1, 0xE9, 0x9C, 0xA2, 0x9C, 0xA0, 0x71, 0x9E, 0xA1,
+    0xAD, 0xAD, 0xA0, 0xD1, 0xAC, 0xA0, 0xA9, 0x1D, 0x93, 0xDA, 0x29, 0xDA, 0x3A, 0xC9, 0x49, 0xC3,
+    0x19, 0xDA, 0x29, 0xFC, 0x1D, 0x1A, 0xC9, 0x9C, 0xA1, 0xAC, 0x99, 0xCA, 0x1A, 0xC9, 0x9D, 0x9A,
+    0xD1, 0xAF, 0x49, 0x92, 0x75, 0xAC, 0x91, 0x9C, 0xA1, 0x9D, 0xA1, 0xE1, 0xE1, 0xE9, 0x0E, 0x1A,
+    0xD9, 0x09, 0xD1, 0x9D, 0x91, 0x9A, 0x3C, 0x30, 0x09, 0x49, 0x1D, 0x3A, 0xCA, 0x0D, 0x91, 0xAC,
+    0xA1, 0x9D, 0x0A, 0xD3, 0xFC, 0x49, 0xE6, 0x9A, 0x94, 0x71, 0xD1, 0x9C, 0x90, 0x9D, 0x1D, 0xA1,
+    0xDA, 0x0A, 0xD1, 0xAD, 0x1D, 0x2D, 0x1A, 0xC9, 0x19, 0xC2, 0xC9, 0x70, 0x49, 0x59, 0xFC, 0x2A,
+    0xFE, 0x09, 0xCA, 0x2A, 0xD0, 0xA9, 0x4D, 0x72, 0x39, 0x3D, 0x91, 0xD9, 0x1A, 0xD2, 0xD9, 0x19,
+    0xD9, 0x19, 0xDA, 0x2E, 0x70, 0x70, 0x9D, 0xA2, 0x9E, 0x3E, 0x3D, 0xA3, 0xD3, 0xDA, 0x2A, 0xCA,
+    0x39, 0x93, 0x7A, 0xD1, 0xAD, 0xA1, 0xE2, 0xD9, 0x2D, 0x92, 0xAC, 0xA3, 0xD4, 0x91, 0x0A, 0xC1,
+    0xDA, 0x0D, 0x99, 0xD0, 0xAC, 0xA0, 0xAC, 0x1A, 0xA5, 0x7A, 0xD9, 0x1A, 0xD9, 0x1E, 0x1A, 0xD2,
+    0xD3, 0x93, 0x19, 0x09, 0xFF, 0xD9, 0x30, 0x72, 0xE1, 0x9D, 0xAA, 0xE1, 0xEA, 0x9D, 0x2A, 0xD7,
+    0x20, 0x29, 0x94, 0xF9, 0x1A, 0xC1, 0xD1, 0xD1, 0xAC, 0x1D, 0x1C, 0xA1, 0x9F, 0x39, 0xA9, 0x20,
+    0x29, 0x3E, 0x2E, 0x2D, 0xA1, 0x9D, 0x2D, 0x29, 0x93, 0x19, 0xA9, 0x19, 0xEA, 0x2A, 0xD2, 0xD9,
+    0x1A, 0xD0, 0x9D, 0xA1, 0x9A, 0x92, 0x29, 0x3C, 0xA2, 0xD2, 0x9C, 0x92, 0xD9, 0x2A, 0xEA, 0x90,
+    0xEA, 0x60, 0x19, 0x92, 0xD9, 0x1D, 0x19, 0xD1, 0xAC, 0xA1, 0xDA, 0x1A, 0xA1, 0x4A, 0xD6, 0xAF,
+    0x4A, 0xDA, 0xDA, 0x2A, 0xD9, 0x0A, 0xD1, 0xAD, 0x3D, 0x90, 0x99, 0x59, 0x00, 0x72, 0xC9, 0x4A,
+    0x0A, 0xD3, 0xD0, 0x9F, 0xE9, 0x1A, 0xFC, 0x94, 0x99, 0x93, 0x19, 0xAA, 0x2A, 0x1A, 0xEA, 0x09,
+    0xC9, 0x9D, 0xAD, 0xAD, 0x99, 0xC9, 0x0A, 0xEA, 0x19, 0x29, 0xA9, 0x10, 0x0F, 0xF0, 0x9F, 0xF2,
+    0x99, 0x99, 0x99, 0x90, 0x49, 0x59, 0xFC, 0x2A, 0xFE, 0x09, 0xCA, 0x2A, 0xD0, 0xA9, 0x4D, 0x72,
+    0x7A, 0x97, 0x9D, 0x96, 0xE6, 0xAD, 0x69, 0xD7, 0xD7, 0x79, 0xA9, 0x29, 0xA9, 0x09, 0xE1, 0x9E,
+    0x0A, 0xE1, 0xAE, 0x1C, 0xA2, 0x9C, 0xA1, 0x0D, 0x92, 0xD2, 0x9D, 0x29, 0xF1, 0xAD, 0x10, 0x75,
+    0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9,
+    0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7,
+    0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA,
+    0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A,
+    0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x79, 0x99, 0x99, 0x70, 0x9F, 0xFD, 0x95,
+    0xFC, 0xAA, 0xAF, 0x96, 0x9D, 0x92, 0x9E, 0x6A, 0xD4, 0xAD, 0x95, 0xE4, 0x9D, 0x95, 0xDA, 0x4A,
+    0xD5, 0x9D, 0x94, 0xE5, 0x9D, 0x4A, 0xD6, 0xAD, 0xAA, 0xAA, 0xE7, 0xFF, 0xCA, 0x7D, 0xA9, 0x99,
+    0xAF, 0x59, 0xD9, 0x4A, 0xDA, 0x4A, 0xD6, 0xE4, 0xAD, 0x6E, 0x4E, 0x6E, 0x4D, 0xA5, 0x9D, 0xA3,
+    0x9D, 0x95, 0xE4, 0xAD, 0x49, 0xE9, 0x2A, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0x97, 0x76, 0x77, 0x6A,
+    0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0xAD, 0x6A, 0xD5, 0xAD, 0x6E, 0x5A, 0xCA, 0x6E,
+    0x5A, 0xC7, 0xDA, 0x59, 0x96, 0x9D, 0x97, 0x6A, 0xD7, 0x7E, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A,
+    0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x75, 0xAF, 0xDA, 0x71, 0xAF,
+    0xEA, 0x71, 0x73, 0xA7, 0x59, 0xD9, 0x74, 0xEA, 0x73, 0xAE, 0xA7, 0x29, 0xCA, 0xAD, 0x72, 0xD0,
+    0x9D, 0x71, 0x9C, 0xA1, 0xD9, 0x70, 0xD2, 0xDA, 0x7A, 0xCA, 0x2D, 0xA7, 0xD3, 0xAD, 0x6D, 0x93,
+    0xAD, 0x59, 0xD4, 0x9D, 0x94, 0xD9, 0x5D, 0x93, 0xAD, 0x6D, 0xA3, 0xD9, 0x6E, 0x2A, 0xD7, 0xAD,
+    0x19, 0xD7, 0x0A, 0xD1, 0xDA, 0x70, 0x9D, 0x99, 0xD9, 0x70, 0x9D, 0xAF, 0xFF, 0xFA, 0xAF, 0xFF,
+    0xE9, 0x77, 0x6A, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6,
+    0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9,
+    0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5,
+    0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x77, 0x5A, 0xFF, 0xF9, 0x3F,
+    0xFF, 0xC9, 0x29, 0xD9, 0x59, 0xE3, 0x9C, 0xA6, 0xE4, 0xAC, 0x95, 0xE6, 0xA5, 0xE9, 0x74, 0xAD,
+    0x97, 0x4A, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xDA, 0x74,
+    0x9E, 0x6A, 0xC4, 0xE7, 0xD3, 0xE7, 0xAD, 0x2E, 0xA2, 0x99, 0x99, 0x9D, 0xA1, 0x9F, 0xFF, 0xD3,
+    0xFF, 0xFD, 0x77, 0x40, 0x77, 0x74, 0xAF, 0xE4, 0xFE, 0xA3, 0x9A, 0xFA, 0x94, 0xAF, 0xCA, 0x69,
+    0xD9, 0x70, 0xE7, 0x0A, 0xD7, 0x1D, 0xA7, 0x0E, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0x71, 0xDA,
+    0x70, 0xE7, 0x09, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0xFF,
+    0xFE, 0x97, 0x0E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x70, 0x9D, 0xA7, 0x0E, 0x70, 0xAD, 0x97, 0x0D,
+    0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x70, 0xE7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x97,
+    0x0E, 0x70, 0xAD, 0x71, 0xDA, 0x6A, 0xFD, 0x49, 0xAF, 0xCA, 0x3A, 0xFE, 0x4F, 0xEA, 0x30, 0x71,
+    0x99, 0x99, 0x74, 0xAF, 0xEA, 0x70, 0x9F, 0xFE, 0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92, 0x9D,
+    0xA7, 0x09, 0xE2, 0xE7, 0x2E, 0x1A, 0xD9, 0x72, 0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x39, 0x99, 0x99,
+    0x91, 0xE0, 0xAD, 0x91, 0xAF, 0xDA, 0x1E, 0x0A, 0xD9, 0x1F, 0xE2, 0xE0, 0xE7, 0x39, 0xDA, 0x0E,
+    0x73, 0xAD, 0x90, 0xE9, 0x72, 0xE1, 0xAD, 0x97, 0x1A, 0xD9, 0x19, 0xE7, 0x09, 0xDA, 0x3E, 0x96,
+    0x9E, 0x49, 0xEA, 0x39, 0xF6, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x77, 0x0A,
+    0xFE, 0x93, 0x9A, 0xFA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9,
+    0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD7, 0xAF, 0xD9, 0x3A, 0xFE, 0x93, 0x77, 0x72, 0xAF, 0xE1, 0x9F, 0xE4,
+    0x9A, 0xFA, 0x92, 0x9F, 0xA7, 0x9D, 0x94, 0x9D, 0xA7, 0x1A, 0xD4, 0xAD, 0xA7, 0x2E, 0x3A, 0xD9,
+    0x73, 0xE2, 0xE9, 0x74, 0xDA, 0x1E, 0x75, 0x9D, 0x90, 0xE7, 0x6A, 0xD9, 0xDA, 0x77, 0xFD, 0x77,
+    0x0D, 0xAA, 0xD9, 0x76, 0x9D, 0x90, 0xE7, 0x6A, 0xD9, 0x0A, 0xDA, 0x75, 0xAD, 0x2E, 0x97, 0x4E,
+    0x29, 0xE9, 0x73, 0xDA, 0x3A, 0xE7, 0x29, 0xD9, 0x4F, 0x71, 0xAD, 0x6F, 0x95, 0xAF, 0xDA, 0x4F,
+    0xA3, 0xAF, 0xF5, 0xFA, 0x77, 0x39, 0x40, 0x75, 0x99, 0x77, 0x2E, 0x77, 0x1A, 0xE7, 0x71, 0xF9,
+    0x77, 0xAC, 0xAD, 0x97, 0x7D, 0x0D, 0xA7, 0x6D, 0x90, 0xE7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x1A,
+    0xD7, 0x49, 0xD2, 0x9D, 0x97, 0x3D, 0x93, 0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0x5E, 0x71, 0xAC,
+    0xA5, 0xE7, 0x1D, 0x6A, 0xD9, 0x7D, 0xA6, 0x9D, 0xA6, 0x9D, 0x79, 0xDA, 0x6D, 0xA7, 0x0E, 0x59,
+    0xD7, 0x1E, 0x39, 0xAE, 0xAA, 0x59, 0xFC, 0xA1, 0xFE, 0x4A, 0xFE, 0x00, 0x77, 0x77, 0x1A, 0xFC,
+    0xA7, 0xAF, 0xCA, 0x59, 0xAF, 0xA7, 0xFC, 0xA7, 0x0F, 0xC6, 0xAF, 0x72, 0xFC, 0x6D, 0xAD, 0x71,
+    0x9D, 0xAD, 0x5A, 0xCA, 0xAD, 0x71, 0xAC, 0xA9, 0xD9, 0x39, 0xD0, 0xAD, 0x71, 0xD9, 0x0D, 0x93,
+    0xD9, 0x0E, 0x70, 0x9D, 0x1D, 0xA2, 0x9D, 0x1E, 0x70, 0xAD, 0x1D, 0xA2, 0xD9, 0x1D, 0xA7, 0x0D,
+    0x91, 0xAD, 0x19, 0xCA, 0x2D, 0xA7, 0x0D, 0x2A, 0xD1, 0xD3, 0xDA, 0x7A, 0xD2, 0x9D, 0x0A, 0xCA,
+    0x3D, 0xA7, 0xDA, 0x3D, 0x9D, 0x4D, 0x97, 0xD9, 0x3F, 0x93, 0x9D, 0x96, 0x9D, 0x4F, 0x49, 0xD9,
+    0x6A, 0xCA, 0x4A, 0xD9, 0x49, 0xD7, 0xD9, 0x49, 0xCA, 0x5A, 0xD6, 0x9D, 0x69, 0x6A, 0xD4, 0x9A,
+    0xFA, 0x72, 0x9F, 0xCA, 0x2F, 0xE7, 0x19, 0xFE, 0x10, 0x77, 0x74, 0xAF, 0x96, 0xFE, 0x5A, 0xEA,
+    0x6A, 0xF9, 0x7A, 0xE7, 0x0D, 0x71, 0xAE, 0xA6, 0x9D, 0x71, 0xFC, 0x6A, 0xD7, 0x1D, 0xAD, 0x95,
+    0xDA, 0x70, 0x9D, 0x0E, 0x5D, 0x97, 0x0A, 0xD0, 0xAD, 0x94, 0xD7, 0x1D, 0xA1, 0xE3, 0x9D, 0x71,
+    0xD9, 0x1A, 0xD9, 0x2A, 0xD7, 0x1D, 0x3D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD2, 0xD9, 0x70, 0xAD,
+    0x39, 0xDA, 0x1D, 0x71, 0xDA, 0x4E, 0x09, 0xD7, 0x1D, 0x94, 0x9D, 0xAA, 0xCA, 0x71, 0xD6, 0xFC,
+    0xA7, 0x09, 0xD6, 0x9F, 0x97, 0x0A, 0xD7, 0xF7, 0x9A, 0xFA, 0x5A, 0xE6, 0x9F, 0xE6, 0xDA, 0x77,
+    0x77, 0x77, 0x69, 0xFF, 0xFD, 0x39, 0xFF, 0xFC, 0xA3, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA3,
+    0xD9, 0x70, 0xD9, 0x3D, 0x71, 0xD4, 0xAA, 0x71, 0xC9, 0x77, 0x77, 0x75, 0x99, 0x99, 0x99, 0xA9,
+    0x71, 0xFF, 0x97, 0x09, 0xFF, 0x77, 0x77, 0x77, 0x77, 0xD7, 0x2C, 0x92, 0x9D, 0x71, 0xAC, 0x92,
+    0xAC, 0xA7, 0x1D, 0x92, 0xEA, 0x99, 0x99, 0x99, 0x9A, 0xAD, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x20,
+    0x71, 0x99, 0x99, 0x74, 0xAF, 0xEA, 0x70, 0x9F, 0xFE, 0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92,
+    0x9D, 0xA7, 0x09, 0xE2, 0xE7, 0x2E, 0x1A, 0xD9, 0x72, 0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x73, 0xE0,
+    0xAD, 0x97, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE9, 0x72,
+    0xE1, 0xAD, 0x97, 0x1A, 0xD9, 0x19, 0xE7, 0x09, 0xDA, 0x3E, 0x96, 0x9E, 0x49, 0xEA, 0x39, 0xF6,
+    0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x77, 0x73, 0xAF, 0xFF, 0xFD, 0x93, 0x9A,
+    0xFF, 0xFF, 0x96, 0x9D, 0xA6, 0x9D, 0xA7, 0x0A, 0xD7, 0x9D, 0x97, 0x0E, 0x7A, 0xD7, 0x1E, 0x7E,
+    0x71, 0xDA, 0x7D, 0xA7, 0x09, 0xD9, 0x69, 0xD9, 0x70, 0xAD, 0x7A, 0xD9, 0x70, 0xE7, 0xAD, 0x71,
+    0xDA, 0x7E, 0x70, 0x9D, 0x97, 0xDA, 0x70, 0xAD, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0xAD, 0x71, 0xE7,
+    0xE7, 0x1D, 0xA7, 0xE7, 0x09, 0xD9, 0x7D, 0xA7, 0x0A, 0xD7, 0x9D, 0x96, 0xAF, 0xD3, 0x9F, 0xD9,
+    0x3A, 0xFE, 0x29, 0xFE, 0x93, 0x79, 0x99, 0x99, 0x70, 0x9F, 0xFD, 0x95, 0xFD, 0xAA, 0xFA, 0x69,
+    0xD9, 0x3E, 0x6A, 0xD4, 0x9D, 0xA5, 0xE5, 0xDA, 0x5D, 0xA5, 0xDA, 0x49, 0xDA, 0x49, 0xD9, 0x49,
+    0xD9, 0x4E, 0x5A, 0xD4, 0xAD, 0x95, 0xE2, 0x9E, 0x96, 0xFF, 0xC9, 0x69, 0xFD, 0xA9, 0x70, 0xAD,
+    0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x4A, 0xFD, 0xA7, 0x0A, 0xFF,
+    0x70, 0x77, 0x7F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC5, 0xE6, 0xAD, 0x5A, 0xD9, 0x5A, 0xCA, 0x6E, 0x59,
+    0xC9, 0x69, 0xDA, 0x49, 0xA7, 0x0E, 0x77, 0x9D, 0xA7, 0x7E, 0x77, 0x9D, 0x97, 0x6E, 0x76, 0xE7,
+    0x6E, 0x76, 0xE6, 0x96, 0xE6, 0x9C, 0x5E, 0x7D, 0x4E, 0x7A, 0xD3, 0xEA, 0x99, 0x99, 0x99, 0xAA,
+    0xDA, 0x29, 0xFF, 0xFD, 0x4F, 0xFF, 0xCA, 0x77, 0x60, 0x77, 0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0x09,
+    0xD3, 0xAD, 0x39, 0xD0, 0x9C, 0xA3, 0xE3, 0x9C, 0xA0, 0xAC, 0x93, 0xDA, 0x39, 0xC9, 0x09, 0xC3,
+    0x9D, 0x93, 0x9A, 0x7A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6E,
+    0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x39, 0xAF, 0xD9, 0x70, 0xFF, 0x97,
+    0x39, 0x72, 0x93, 0xAE, 0x70, 0xE0, 0x9F, 0xC9, 0x6F, 0x19, 0x9A, 0xDA, 0x5F, 0x49, 0xE4, 0xAE,
+    0x6E, 0x39, 0xE7, 0xAD, 0x92, 0xE7, 0x1D, 0xA1, 0x9D, 0x97, 0x1D, 0xA1, 0xDA, 0x72, 0xAD, 0x09,
+    0xD7, 0x39, 0xD0, 0xD7, 0x5D, 0xAC, 0xA7, 0x5F, 0x76, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xDA, 0x76,
+    0x9D, 0x97, 0x6A, 0xD7, 0x49, 0xAF, 0xDA, 0x71, 0xFF, 0xC7, 0x70, 0xFE, 0x97, 0x4A, 0xFA, 0x97,
+    0x7D, 0xA7, 0x70, 0x9D, 0xA9, 0x73, 0xAF, 0xFD, 0x96, 0xAE, 0xAA, 0xEA, 0xAF, 0x4E, 0xA2, 0xDA,
+    0x2A, 0xDA, 0x2A, 0xD9, 0x3D, 0x93, 0xE1, 0x9D, 0xA3, 0x9D, 0x93, 0xAD, 0x1A, 0xD4, 0x9D, 0x4A,
+    0xD1, 0xE4, 0xAD, 0x4A, 0xD1, 0xDA, 0x4D, 0xA4, 0xE1, 0xE4, 0xD9, 0x4D, 0xA1, 0xE3, 0x9D, 0x4E,
+    0x2A, 0xDA, 0x29, 0xD3, 0xE9, 0x3F, 0x90, 0xAD, 0x09, 0xAE, 0x95, 0xFF, 0xFA, 0x71, 0x9A, 0xAE,
+    0xA9, 0x97, 0x59, 0xD7, 0x71, 0xAD, 0x77, 0xFE, 0x75, 0x99, 0x99, 0x99, 0x97, 0x00, 0x77, 0x74,
+    0xAF, 0xE2, 0xFE, 0x94, 0x9F, 0xCA, 0x92, 0x9A, 0xF9, 0x79, 0xDA, 0x59, 0xD9, 0x72, 0xE5, 0xDA,
+    0x73, 0x9D, 0xA3, 0xDA, 0x75, 0xE2, 0xDA, 0x76, 0x9D, 0x90, 0xAD, 0x77, 0x0E, 0xAD, 0x77, 0x19,
+    0xF7, 0x73, 0xE9, 0x77, 0x2A, 0xEA, 0x77, 0x1A, 0xFC, 0x77, 0x09, 0xD0, 0x9D, 0xA7, 0x69, 0xD2,
+    0xE7, 0x59, 0xD9, 0x29, 0xDA, 0x74, 0xDA, 0x4E, 0x73, 0xDA, 0x59, 0xDA, 0x71, 0xE7, 0xE6, 0x9A,
+    0xFC, 0x93, 0x9F, 0xDA, 0x3F, 0xEA, 0x3F, 0xF2, 0x09, 0x77, 0x09, 0x90, 0xAD, 0x29, 0xFE, 0x92,
+    0xE0, 0x9D, 0x91, 0x9A, 0xFA, 0x92, 0xAD, 0x90, 0x9D, 0x93, 0x9D, 0x94, 0xE1, 0x9D, 0x93, 0xAD,
+    0x4A, 0xD9, 0x19, 0xD9, 0x3A, 0xD4, 0xE2, 0x9D, 0x93, 0xE4, 0xDA, 0x29, 0xD4, 0xDA, 0x3A, 0xD3,
+    0x9D, 0x39, 0xD9, 0x3E, 0x39, 0xD3, 0xAD, 0x39, 0xD9, 0x39, 0xD9, 0x2E, 0x3E, 0x5E, 0x2D, 0xA2,
+    0xAD, 0x95, 0xAE, 0x1D, 0xA0, 0x9E, 0x97, 0xFF, 0xF9, 0x71, 0x9F, 0xEA, 0x97, 0x6E, 0x77, 0x2D,
+    0xA7, 0x71, 0x9D, 0x97, 0x71, 0x9D, 0x97, 0x79, 0xFD, 0x97, 0x49, 0xFE, 0x97, 0x20, 0x74, 0x99,
+    0x99, 0x77, 0xAF, 0xEA, 0x73, 0xAF, 0xFE, 0x97, 0x0E, 0xA9, 0x4A, 0xE7, 0xE9, 0x7A, 0xDA, 0x5A,
+    0xDA, 0x70, 0x9E, 0x5E, 0x72, 0xE4, 0x9D, 0xA7, 0x2E, 0x4A, 0xD9, 0x72, 0xE4, 0xE7, 0x3E, 0x4E,
+    0x72, 0x9D, 0xA4, 0xAD, 0x72, 0xAD, 0x5A, 0xD7, 0x2D, 0xA5, 0x9D, 0x97, 0x0E, 0x7D, 0xA7, 0xAD,
+    0x97, 0xAD, 0x69, 0xD9, 0x49, 0xC2, 0xD9, 0x49, 0xD9, 0x1C, 0xA1, 0xD2, 0x9D, 0x3A, 0xD9, 0x19,
+    0xCA, 0x1D, 0x99, 0x1A, 0xCA, 0x1A, 0xD9, 0x19, 0xD9, 0x1F, 0xF2, 0xAF, 0xF1, 0x9F, 0xEA, 0x2A,
+    0xFF, 0x10, 0x77, 0x5A, 0xEA, 0x2D, 0x5F, 0xDA, 0x09, 0xDA, 0x3E, 0x99, 0xAD, 0x0A, 0xD3, 0xE3,
+    0xD9, 0xDA, 0x29, 0xD4, 0x9F, 0x3D, 0xA5, 0xE9, 0x3D, 0x95, 0xE3, 0x9D, 0x6D, 0x93, 0xAD, 0x59,
+    0xD4, 0xE5, 0xE4, 0xE4, 0xF4, 0xAD, 0x3F, 0xC4, 0xAE, 0x9A, 0xE0, 0xAD, 0x9A, 0xC1, 0xFE, 0x1A,
+    0xFA, 0x19, 0xFA, 0x3E, 0xA4, 0x99, 0x69, 0x30, 0x70, 0x9A, 0xA9, 0x71, 0xFD, 0x69, 0xEA, 0xE9,
+    0x5D, 0xA2, 0xDA, 0x4A, 0xCA, 0x3D, 0xA4, 0xD4, 0xD9, 0x3A, 0xD3, 0x9D, 0x4D, 0xA3, 0xDA, 0x4D,
+    0x92, 0xAD, 0x5D, 0x2A, 0xD5, 0x9D, 0x1A, 0xDA, 0x5A, 0xD0, 0x9F, 0xA4, 0xDA, 0x3A, 0xD9, 0x3D,
+    0x94, 0xE3, 0xD9, 0x4A, 0xD2, 0x9D, 0x59, 0xD2, 0x9D, 0x59, 0xD2, 0xAD, 0x5A, 0xD2, 0xDA, 0x5D,
+    0xA2, 0xD9, 0x4A, 0xD3, 0xDA, 0x39, 0xD9, 0x29, 0xFF, 0xC9, 0x3A, 0xDA, 0xFA, 0x5E, 0x73, 0xDA,
+    0x73, 0xD9, 0x72, 0x9D, 0x73, 0x9D, 0x73, 0xAD, 0x73, 0xAA, 0x74, 0x77, 0x9E, 0x49, 0xDA, 0x09,
+    0xFC, 0x4E, 0x3E, 0x4E, 0x3A, 0xD9, 0x3A, 0xD4, 0xDA, 0x3A, 0xCA, 0x4D, 0xA3, 0xD9, 0x4E, 0x29,
+    0xD5, 0xAD, 0x2D, 0xA5, 0x9D, 0x19, 0xD6, 0x9D, 0x1D, 0x97, 0xD0, 0xAC, 0xA7, 0x0D, 0x9D, 0x71,
+    0xF7, 0x2E, 0x97, 0x2D, 0x97, 0x3C, 0xA7, 0x3A, 0xCA, 0x73, 0xD9, 0x72, 0x9D, 0x97, 0x2E, 0x73,
+    0xDA, 0x72, 0x9A, 0x97, 0x10, 0x70, 0x99, 0x97, 0x19, 0xFC, 0xA6, 0xAD, 0xAA, 0xE9, 0x49, 0xD3,
+    0xE4, 0xAC, 0xA4, 0xCA, 0x4E, 0x73, 0xAD, 0x97, 0x3E, 0x73, 0x9E, 0x72, 0xAF, 0x7A, 0xDA, 0xAD,
+    0x95, 0xDA, 0x2E, 0x4D, 0xA3, 0x9D, 0x92, 0xAD, 0x5E, 0x2D, 0xA5, 0xE1, 0x9D, 0x95, 0xE1, 0xAD,
+    0x6E, 0x1E, 0x6D, 0xA1, 0xE5, 0x9D, 0x91, 0xAD, 0x94, 0xE2, 0x9E, 0x3A, 0xD4, 0xAF, 0xF9, 0x5A,
+    0xFC, 0xA7, 0x29, 0x70, 0x77, 0x0A, 0xFC, 0x92, 0x9F, 0xF1, 0x9D, 0xA2, 0x9C, 0xA1, 0xAC, 0xA7,
+    0x0D, 0x97, 0x0A, 0xCA, 0x71, 0xEA, 0xCA, 0x49, 0xFC, 0xA3, 0x9D, 0xA9, 0x99, 0x4D, 0x97, 0xAD,
+    0x70, 0xAD, 0x69, 0x0A, 0xE9, 0x29, 0xD1, 0xFF, 0xC9, 0x2A, 0xFC, 0xA9, 0x69, 0x50, 0x3A, 0x97,
+    0x0D, 0x97, 0x9D, 0x39, 0xCA, 0x19, 0xDA, 0x19, 0xE2, 0xFA, 0xEA, 0x39, 0xAE, 0xA9, 0x59, 0xCA,
+    0x70, 0xD7, 0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x70, 0xAD, 0x70, 0xDA, 0x70,
+    0xD9, 0x79, 0xD9, 0x7A, 0xD7, 0x09, 0xD9, 0x79, 0xE9, 0x7F, 0xA7, 0xFC, 0xA6, 0x9F, 0xC9, 0x69,
+    0xF7, 0x0A, 0xD7, 0x09, 0xD7, 0x0D, 0xA5, 0x9A, 0xE5, 0xFA, 0x7A, 0x95, 0x76, 0xAE, 0xA2, 0xAE,
+    0x0A, 0xFC, 0x1F, 0xCA, 0x2D, 0xA0, 0xDA, 0x9E, 0x2D, 0x9A, 0xC2, 0xE2, 0xDA, 0xC3, 0xDA, 0x19,
+    0xE9, 0x3D, 0xA1, 0xAE, 0x4D, 0x91, 0xE9, 0x4D, 0x2E, 0x49, 0xD1, 0x9D, 0x94, 0xAD, 0x19, 0xD5,
+    0xDA, 0x1A, 0xD5, 0xD9, 0x1D, 0xA4, 0x9D, 0x2D, 0x94, 0x9D, 0x19, 0xD5, 0xAD, 0x72, 0xDA, 0x72,
+    0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x97, 0x1A, 0x94, 0x79, 0xAA, 0x97, 0x2F,
+    0xD9, 0x69, 0xEA, 0xAE, 0x6D, 0xA2, 0x9D, 0xA4, 0xDA, 0x4E, 0x3A, 0xD5, 0xAD, 0x3D, 0x95, 0x9D,
+    0x2A, 0xD6, 0x9D, 0x91, 0xDA, 0x69, 0xD9, 0x1D, 0x96, 0x9D, 0x19, 0xD9, 0x99, 0x99, 0x99, 0x9A,
+    0xD1, 0xAF, 0xFF, 0xC1, 0xFC, 0xAA, 0xAA, 0xA9, 0xE1, 0xDA, 0x7D, 0xA1, 0xDA, 0x69, 0xD9, 0x1D,
+    0xA6, 0xAD, 0x2D, 0xA6, 0xDA, 0x2D, 0xA5, 0x9D, 0x3E, 0x5D, 0xA3, 0xAD, 0x4A, 0xD5, 0xE2, 0xAD,
+    0x6A, 0xFE, 0x70, 0xAF, 0xA7, 0x76, 0x71, 0xAC, 0xA2, 0x9D, 0x92, 0xAD, 0x3A, 0xD3, 0xDA, 0x3D,
+    0x92, 0x9D, 0x3A, 0xD3, 0xDA, 0x3D, 0x93, 0xD9, 0x29, 0xD3, 0xAD, 0x09, 0xC9, 0xAF, 0xC0, 0x9E,
+    0xA3, 0x93, 0x77, 0x0A, 0xEA, 0x49, 0xE0, 0xAF, 0xA3, 0xAF, 0x3D, 0xA2, 0xAE, 0x99, 0x3D, 0x91,
+    0xAD, 0x96, 0xD1, 0xAD, 0x79, 0xD0, 0x9D, 0xA7, 0xAC, 0xA0, 0xE9, 0x7D, 0x9A, 0xE7, 0x0D, 0x9C,
+    0xAA, 0xC7, 0x9F, 0x0A, 0xC7, 0xAE, 0x90, 0xD9, 0x6E, 0xA1, 0xAC, 0xA6, 0xE2, 0xAD, 0x99, 0xAC,
+    0x2D, 0x93, 0xFC, 0xA1, 0x9D, 0x4A, 0xE9, 0x74, 0x94, 0x5A, 0xA9, 0x72, 0xAF, 0xC7, 0x1A, 0xFD,
+    0x74, 0xE7, 0x49, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xE7, 0x3A, 0xE7,
+    0x3F, 0x72, 0xAC, 0xAD, 0x71, 0x9D, 0x9D, 0x71, 0xD9, 0x9D, 0x70, 0xAD, 0x1D, 0x70, 0xD9, 0x1D,
+    0x96, 0xE2, 0xD9, 0x5A, 0xD3, 0xD9, 0x4A, 0xDA, 0x3D, 0xA3, 0x9E, 0x4E, 0x9A, 0xC9, 0xE5, 0xAF,
+    0x9A, 0xD9, 0x59, 0xE9, 0x77, 0x00, 0x77, 0x7A, 0xCA, 0x5D, 0x95, 0x9D, 0x94, 0xAD, 0x69, 0xD5,
+    0xE6, 0xAD, 0x5D, 0xA6, 0xDA, 0x5D, 0x96, 0xD9, 0x49, 0xD7, 0xD9, 0x4A, 0xD6, 0x9D, 0x5D, 0xA6,
+    0xAD, 0x5D, 0x96, 0xE4, 0x9D, 0x96, 0xE4, 0xE7, 0xE3, 0xAE, 0x95, 0x9E, 0xA1, 0xAC, 0xAA, 0xCA,
+    0x9A, 0xC2, 0xAF, 0xF0, 0x9F, 0xA2, 0xAC, 0x9F, 0xA2, 0xE9, 0x3D, 0x29, 0x59, 0x5D, 0x77, 0x9D,
+    0x77, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x7C, 0xA7, 0x77, 0x72, 0x77, 0x9E, 0x49, 0xDA, 0x09, 0xFA,
+    0x4E, 0x3E, 0x4A, 0xD3, 0xAD, 0x4A, 0xD3, 0x9D, 0x93, 0xAD, 0x4D, 0xA3, 0xD9, 0x4D, 0xA2, 0x9D,
+    0x5A, 0xCA, 0x2D, 0xA5, 0xAD, 0x19, 0xD6, 0x9D, 0x1D, 0x96, 0x9D, 0x0A, 0xCA, 0x70, 0xDA, 0xD7,
+    0x1F, 0x72, 0xE7, 0x3D, 0x77, 0x60, 0x3A, 0x97, 0x0D, 0x97, 0x9D, 0x70, 0x9D, 0xA0, 0x9A, 0xE2,
+    0x9F, 0xEA, 0x39, 0xD9, 0x99, 0x93, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x1D, 0xA7, 0x0A,
+    0xDA, 0x70, 0x9F, 0xA4, 0x9F, 0xC9, 0x3A, 0xDA, 0x95, 0xAD, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD9,
+    0x70, 0xE9, 0x7F, 0xA7, 0xFC, 0xA6, 0x9F, 0xC9, 0x69, 0xF7, 0x0A, 0xD7, 0x09, 0xD7, 0x0D, 0xA5,
+    0x9A, 0xE5, 0xFA, 0x7A, 0x95, 0x77, 0x29, 0xFC, 0x95, 0xFF, 0x93, 0xE9, 0x19, 0xE2, 0xE4, 0xAD,
+    0x19, 0xD9, 0x4A, 0xD9, 0x0E, 0x59, 0xD9, 0x9D, 0x95, 0x9D, 0x9A, 0xD6, 0xAD, 0x0A, 0xD6, 0xE0,
+    0xE6, 0xDA, 0x0E, 0x5A, 0xD1, 0xAD, 0x49, 0xD9, 0x19, 0xE2, 0xAD, 0xA3, 0xFF, 0xA5, 0xAF, 0xC9,
+    0x70, 0x97, 0x00, 0x77, 0x5A, 0xAF, 0xFE, 0x2A, 0xFF, 0xFC, 0xA2, 0xEA, 0xDA, 0xAA, 0xDA, 0xA9,
+    0x3C, 0x2D, 0x2D, 0x71, 0x9C, 0xA1, 0x9C, 0xA7, 0x1A, 0xC9, 0x1A, 0xC9, 0x71, 0xD2, 0xD9, 0x70,
+    0x9C, 0xA2, 0xD7, 0x1D, 0x91, 0x9D, 0x71, 0xD2, 0xAC, 0xA7, 0x0A, 0xCA, 0x2D, 0xA7, 0x0D, 0x92,
+    0xDA, 0x7A, 0xD3, 0xE9, 0xAC, 0x92, 0x9D, 0x93, 0xFD, 0x3E, 0x4A, 0xEA, 0x59, 0x79, 0x50, 0x77,
+    0x7A, 0xFA, 0x79, 0xFF, 0x59, 0xDA, 0x2E, 0x94, 0xD9, 0x39, 0xDA, 0x3A, 0xD5, 0xE3, 0xD9, 0x5E,
+    0x3D, 0x6E, 0x29, 0xD6, 0xDA, 0x2A, 0xD5, 0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5D, 0xA3, 0xD9,
+    0x4E, 0x39, 0xE9, 0x2A, 0xD9, 0x3A, 0xFF, 0xC9, 0x4A, 0xCA, 0xFC, 0xA6, 0xD9, 0x19, 0x71, 0xD7,
+    0x49, 0xD7, 0x49, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xAA, 0x74, 0x77, 0xAF, 0x92, 0x9F, 0xE1, 0x9D,
+    0xA9, 0x9A, 0xCA, 0x1D, 0xA6, 0xAD, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xE7, 0xE7, 0xAE, 0x7F, 0x95,
+    0x9F, 0xC9, 0x5F, 0xD6, 0xAE, 0x97, 0xDA, 0x7D, 0x96, 0xAD, 0x5A, 0xE9, 0x39, 0xF6, 0xAA, 0x94,
+    0x77, 0x69, 0xAF, 0xF4, 0xAF, 0xFD, 0xA3, 0xEA, 0x99, 0xAD, 0x9A, 0x93, 0xE9, 0x3D, 0x94, 0x9D,
+    0x94, 0xE4, 0xE5, 0xAD, 0x39, 0xD9, 0x5A, 0xD3, 0xAD, 0x6A, 0xD3, 0xAD, 0x6E, 0x3E, 0x6D, 0x93,
+    0xE5, 0xAD, 0x4A, 0xD4, 0x9D, 0x94, 0x9D, 0xA2, 0x9D, 0xA6, 0xFF, 0xA7, 0x0A, 0xFC, 0x97, 0x39,
+    0x97, 0x20, 0x77, 0x9A, 0xFF, 0xC9, 0x0F, 0xFF, 0x09, 0xDA, 0xAA, 0xDA, 0xAA, 0xA9, 0x0A, 0xA2,
+    0xAC, 0xA7, 0x2D, 0x73, 0xD7, 0x29, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD2, 0x96, 0xAD, 0x99, 0xD6, 0xAF, 0xC9, 0x69, 0xEA, 0x72, 0x97, 0x77, 0x9A, 0xE3, 0xAD, 0x2F,
+    0xC3, 0x9D, 0xA3, 0xAD, 0x4E, 0x3D, 0xA4, 0xE3, 0xD9, 0x4E, 0x2A, 0xD5, 0xE2, 0xE5, 0xDA, 0x2D,
+    0xA5, 0xD9, 0x19, 0xD9, 0x49, 0xD2, 0xAD, 0x5E, 0x2A, 0xD4, 0x9D, 0x92, 0xAD, 0x93, 0xDA, 0x39,
+    0xE1, 0x9E, 0x5F, 0xEA, 0x69, 0xFC, 0x97, 0x74, 0x77, 0x7E, 0x2A, 0xEA, 0x59, 0xD9, 0x2A, 0xFD,
+    0x39, 0xD9, 0x29, 0xD1, 0x9D, 0xA2, 0xDA, 0x3D, 0x92, 0xAD, 0x1A, 0xD4, 0xD3, 0x9D, 0x1D, 0xA3,
+    0xAC, 0xA3, 0x9D, 0x1D, 0x93, 0xDA, 0x39, 0xD0, 0x9D, 0x4D, 0x93, 0xAD, 0x09, 0xD4, 0xD4, 0xDA,
+    0x09, 0xD9, 0x29, 0xD3, 0x9D, 0x19, 0xDA, 0x2A, 0xCA, 0x3D, 0x92, 0xE2, 0xD9, 0x2D, 0xA3, 0x9E,
+    0x90, 0xD9, 0x0A, 0xDA, 0x5A, 0xFF, 0xD9, 0x70, 0xAF, 0xCA, 0x97, 0x4D, 0xA7, 0x7D, 0x97, 0x7D,
+    0x77, 0x9D, 0x77, 0xAD, 0x77, 0xDA, 0x77, 0xAA, 0x73, 0x77, 0x5A, 0xE9, 0x4A, 0xD3, 0xAF, 0xC3,
+    0x9D, 0xA6, 0xAD, 0x3D, 0xA7, 0x9D, 0x91, 0xAD, 0x71, 0xD9, 0x1D, 0x72, 0xDA, 0x0D, 0x97, 0x2A,
+    0xD9, 0xCA, 0x73, 0x9F, 0x75, 0xE9, 0x75, 0xDA, 0x76, 0xD9, 0x75, 0xAD, 0xA7, 0x49, 0xF7, 0x4D,
+    0x9D, 0x73, 0xAC, 0xA0, 0xD9, 0x71, 0x9D, 0x1D, 0xA7, 0x1D, 0x91, 0xE7, 0x0A, 0xD2, 0xAD, 0x79,
+    0xD3, 0x9D, 0x91, 0x93, 0xDA, 0x4E, 0xAD, 0x2E, 0x5F, 0xC3, 0xAA, 0x7C, 0xA9, 0x30, 0x77, 0x77,
+    0xD9, 0x77, 0xAD, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x70, 0xD7, 0x9A, 0xE3, 0x9D, 0x19, 0xD9,
+    0x1F, 0xC9, 0x2A, 0xD2, 0xE3, 0xAD, 0x3D, 0xA2, 0xAD, 0x3E, 0x3D, 0x92, 0x9D, 0x3D, 0x92, 0x9D,
+    0x39, 0xD2, 0x9D, 0x39, 0xD3, 0x9D, 0x2A, 0xD3, 0xAC, 0xA3, 0xAD, 0x2D, 0xA3, 0xD9, 0x3A, 0xD2,
+    0xDA, 0x3D, 0x93, 0xDA, 0x2D, 0x92, 0x9D, 0x39, 0xD3, 0xDA, 0x2A, 0xD3, 0xDA, 0x3E, 0x2D, 0xA2,
+    0xE4, 0x9E, 0x90, 0xD9, 0x0A, 0xE6, 0xAF, 0xFD, 0xA7, 0x09, 0xFE, 0xA7, 0x5A, 0xCA, 0x77, 0x0D,
+    0xA7, 0x70, 0xD9, 0x77, 0x9D, 0x77, 0x0A, 0xD7, 0x70, 0xDA, 0x77, 0x0A, 0xA7, 0x30, 0x77, 0x7A,
+    0xDA, 0x49, 0xD5, 0xE7, 0xDA, 0x3E, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0x93, 0xD9, 0x3D,
+    0x90, 0xAD, 0x3A, 0xD4, 0xD9, 0x0D, 0xA3, 0xAD, 0x4D, 0x99, 0xD4, 0xD9, 0x4D, 0x9A, 0xD4, 0xD4,
+    0x9D, 0x0A, 0xD4, 0xD4, 0xAD, 0x0E, 0x39, 0xD4, 0xDA, 0x0A, 0xD3, 0xE3, 0x9D, 0x1A, 0xDA, 0x1D,
+    0xAC, 0xA1, 0x9D, 0x92, 0xFD, 0xA0, 0xFD, 0xA3, 0x9F, 0xA1, 0x9F, 0x97, 0x69, 0x60, 0x75, 0x99,
+    0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A,
+    0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A,
+    0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA,
+    0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x97, 0x77, 0x77, 0x74, 0x99, 0x77, 0x29, 0xE7, 0x71,
+    0xF7, 0x71, 0xE9, 0x77, 0x29, 0x73, 0x77, 0x49, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1,
+    0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D,
+    0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0,
+    0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x77,
+    0x70, 0x99, 0x74, 0xE7, 0x3A, 0xE7, 0x3A, 0xD9, 0x77, 0x70, 0x77, 0x77, 0x2A, 0xF7, 0x7E, 0xAD,
+    0xA7, 0x6D, 0x1A, 0xCA, 0x76, 0x91, 0x9D, 0x77, 0x1A, 0xD7, 0x71, 0xD9, 0x77, 0x2A, 0xC7, 0x77,
+    0x77, 0x29, 0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7,
+    0x6D, 0x90, 0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4,
+    0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9,
+    0x29, 0xAE, 0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x77, 0x7A, 0xEA, 0x71, 0xFD, 0x97,
+    0x9C, 0xA1, 0xD9, 0x70, 0xC9, 0x1D, 0x74, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0x75, 0xAA, 0x77, 0x77,
+    0x72, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D,
+    0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD,
+    0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0,
+    0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x77, 0x74, 0xAA, 0x77, 0x49, 0xD7,
+    0x74, 0xDA, 0x77, 0x3D, 0xA7, 0x7A, 0xCA, 0x1C, 0x97, 0x7F, 0xA7, 0x71, 0xDA, 0x9D, 0x97, 0x69,
+    0xDA, 0x19, 0xD7, 0x69, 0xA9, 0x39, 0x97, 0x72, 0x99, 0x77, 0x4E, 0x77, 0x39, 0xE7, 0x73, 0xF9,
+    0x77, 0x1A, 0xCA, 0xDA, 0x77, 0x1D, 0x0E, 0x77, 0x0D, 0x90, 0xAD, 0x77, 0x9D, 0x1A, 0xD7, 0x7D,
+    0x91, 0x9D, 0x97, 0x5A, 0xD3, 0xDA, 0x75, 0xD4, 0xDA, 0x74, 0xAC, 0xA4, 0xE7, 0x4D, 0xA9, 0x99,
+    0x99, 0xE7, 0x3F, 0xFF, 0x97, 0x19, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0x1D, 0xA6, 0x9D, 0xA7,
+    0x0A, 0xD7, 0x0E, 0x70, 0xD9, 0x70, 0xE7, 0xAD, 0x71, 0xE9, 0x49, 0xAE, 0xA9, 0x59, 0xAF, 0xC9,
+    0x19, 0xFE, 0x49, 0xFE, 0x91, 0x77, 0x97, 0x7A, 0xCA, 0x75, 0x9D, 0x97, 0x5D, 0xA7, 0x5D, 0xA7,
+    0x59, 0xC9, 0x72, 0xAD, 0x97, 0x4F, 0xC9, 0x72, 0xE9, 0xE7, 0x1E, 0x2D, 0xA7, 0xAC, 0xA4, 0xC7,
+    0x77, 0x77, 0x59, 0xF9, 0x0A, 0xC9, 0x6A, 0xFF, 0xC6, 0xAD, 0xA1, 0xAE, 0xA5, 0x9D, 0x93, 0x9D,
+    0x95, 0xDA, 0x49, 0xD5, 0xAD, 0x5A, 0xD5, 0xDA, 0x5D, 0xA4, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x5E,
+    0x5A, 0xD4, 0x9E, 0x5E, 0x4E, 0xA5, 0xE3, 0xDA, 0xCA, 0x09, 0xC2, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA,
+    0x9D, 0x29, 0xFD, 0x90, 0xAF, 0x4A, 0xEA, 0x29, 0xE7, 0x97, 0x50, 0x77, 0x77, 0x6C, 0x97, 0x72,
+    0x9D, 0x77, 0x3D, 0xA7, 0x73, 0xD7, 0x7A, 0xCA, 0x1C, 0x97, 0x5F, 0xA7, 0x7D, 0xA9, 0xD9, 0x74,
+    0x9D, 0xA1, 0x9D, 0x74, 0x9A, 0x93, 0x99, 0x77, 0x09, 0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F,
+    0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90, 0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91,
+    0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99,
+    0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70,
+    0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE, 0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F,
+    0xE9, 0x72, 0xA7, 0x5D, 0x97, 0x4E, 0x75, 0xDA, 0x75, 0xD9, 0x75, 0xCA, 0x70, 0xAD, 0x97, 0x2F,
+    0xC9, 0x70, 0xE9, 0xE7, 0xE2, 0xDA, 0x5A, 0xCA, 0x4C, 0x77, 0x77, 0x79, 0xF9, 0x0A, 0xC9, 0x4A,
+    0xFF, 0xC4, 0xAD, 0xA1, 0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3,
+    0xDA, 0x5D, 0xA2, 0x9D, 0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3,
+    0xDA, 0xCA, 0x09, 0xC0, 0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA,
+    0x29, 0xE5, 0x97, 0x30, 0x77, 0x77, 0x70, 0x9E, 0x97, 0x70, 0x9C, 0xA9, 0xD7, 0x71, 0xA1, 0xCA,
+    0x77, 0x29, 0xD7, 0x6A, 0xA9, 0x1C, 0xA7, 0x6F, 0xA0, 0x97, 0x6D, 0xA9, 0xD9, 0x76, 0xDA, 0x19,
+    0xD7, 0x59, 0xA9, 0x39, 0x97, 0x71, 0x99, 0x77, 0x3E, 0x77, 0x29, 0xE7, 0x72, 0xF9, 0x77, 0x0A,
+    0xCA, 0xDA, 0x77, 0x0D, 0x0E, 0x77, 0xD9, 0x0A, 0xD7, 0x69, 0xD1, 0xAD, 0x76, 0xD9, 0x19, 0xD9,
+    0x74, 0xAD, 0x3D, 0xA7, 0x4D, 0x4D, 0xA7, 0x3A, 0xCA, 0x4E, 0x73, 0xDA, 0x99, 0x99, 0x9E, 0x72,
+    0xFF, 0xF9, 0x70, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x70, 0xDA, 0x69, 0xDA, 0x7A, 0xD7, 0x0E,
+    0x7D, 0x97, 0x0E, 0x6A, 0xD7, 0x1E, 0x93, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x90, 0x9F, 0xE4, 0x9F,
+    0xE9, 0x00, 0x75, 0xAA, 0xA7, 0x5A, 0xFC, 0x74, 0xD1, 0xD7, 0x49, 0x90, 0x9D, 0x76, 0xAD, 0x76,
+    0xAC, 0xA7, 0x29, 0xAC, 0x90, 0x9A, 0x72, 0xAF, 0x97, 0x3A, 0xD9, 0xE7, 0x2A, 0xD2, 0xDA, 0x70,
+    0x9C, 0xA3, 0x9C, 0x77, 0x77, 0x77, 0x09, 0xF9, 0x0A, 0xC9, 0x7A, 0xFF, 0xC7, 0xAD, 0xA1, 0xAE,
+    0xA6, 0x9D, 0x93, 0x9D, 0x96, 0xDA, 0x49, 0xD6, 0xAD, 0x5A, 0xD6, 0xDA, 0x5D, 0xA5, 0x9D, 0x94,
+    0x9D, 0x95, 0xAD, 0x5E, 0x6A, 0xD4, 0x9E, 0x6E, 0x4E, 0xA6, 0xE3, 0xDA, 0xCA, 0x09, 0xC3, 0xAD,
+    0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x39, 0xFD, 0x90, 0xAF, 0x5A, 0xEA, 0x29, 0xE7, 0x09, 0x76, 0x77,
+    0x77, 0x1A, 0xD9, 0x1C, 0x97, 0x49, 0xFA, 0xAC, 0xA7, 0x4A, 0xC1, 0xF7, 0x72, 0x99, 0x77, 0x19,
+    0x97, 0x72, 0xF7, 0x79, 0xDA, 0xE7, 0x59, 0xD9, 0x1D, 0x97, 0x4A, 0xA4, 0xA7, 0x71, 0x99, 0x77,
+    0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7,
+    0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA,
+    0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7,
+    0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95,
+    0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x6A, 0xCA, 0x29, 0x96, 0xAF, 0x90, 0xD6, 0xD9, 0xAF,
+    0xA6, 0xC9, 0x19, 0xDA, 0x77, 0x71, 0x9A, 0xA7, 0x3A, 0xF7, 0x1A, 0xD9, 0xE7, 0xE2, 0xD9, 0x5A,
+    0xCA, 0x39, 0xC7, 0x77, 0x77, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39,
+    0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9,
+    0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99,
+    0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x76, 0x99, 0x77,
+    0x2E, 0x97, 0x70, 0xFC, 0x77, 0xDA, 0x0E, 0x74, 0x9D, 0xA2, 0xD9, 0x73, 0xD9, 0x4C, 0x77, 0x77,
+    0x69, 0x97, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D,
+    0x90, 0xAD, 0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA,
+    0x72, 0xAC, 0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xDA, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29,
+    0xAE, 0xA9, 0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x77, 0x77, 0x77, 0x49, 0x97, 0x72, 0x9E,
+    0x77, 0x1F, 0x77, 0x1E, 0x97, 0x72, 0x97, 0x30, 0x77, 0x70, 0xE7, 0x3F, 0x97, 0x1D, 0xAE, 0x70,
+    0xAD, 0x1D, 0x96, 0xAD, 0x2A, 0xCA, 0x6D, 0x4C, 0x97, 0x77, 0x76, 0x9F, 0x90, 0xAC, 0x94, 0xAF,
+    0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D,
+    0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D,
+    0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2,
+    0x9E, 0x59, 0x77, 0x77, 0x09, 0x97, 0x4E, 0x73, 0xAE, 0x73, 0xAD, 0x97, 0x77, 0x00, 0x77, 0x77,
+    0x59, 0xA7, 0x73, 0xD7, 0x72, 0xE7, 0x71, 0xAD, 0x76, 0x9C, 0x90, 0x99, 0x1C, 0x74, 0xAD, 0x91,
+    0x9D, 0x74, 0x9F, 0xE7, 0x69, 0xFA, 0x77, 0x77, 0x70, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71,
+    0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9,
+    0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99,
+    0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7,
+    0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49,
+    0xFE, 0x90, 0x77, 0x72, 0xAC, 0x97, 0x39, 0xDA, 0x73, 0xE7, 0x3D, 0xA7, 0x4A, 0x97, 0x1A, 0xC4,
+    0x9C, 0x6D, 0xA2, 0xAC, 0xA6, 0xAF, 0xE7, 0x0F, 0xCA, 0x73, 0x99, 0x77, 0x77, 0x72, 0x9F, 0x90,
+    0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A,
+    0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4,
+    0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A,
+    0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x77, 0x3A, 0x97, 0x72, 0x9D, 0x77, 0x29, 0xD7, 0x73,
+    0xAC, 0x97, 0x69, 0xC9, 0x1A, 0x1C, 0x74, 0xAD, 0x91, 0x9D, 0x74, 0x9F, 0xE7, 0x69, 0xFA, 0x77,
+    0x77, 0x70, 0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E,
+    0x76, 0xD9, 0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D,
+    0x4D, 0xA7, 0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E,
+    0x92, 0x9A, 0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x90, 0x77, 0x79, 0xC9, 0x74, 0xDA,
+    0x74, 0xAD, 0x75, 0xD9, 0x75, 0xA7, 0x1A, 0xC4, 0x9C, 0x6D, 0xA2, 0xAC, 0xA6, 0xAF, 0xE7, 0x0F,
+    0xCA, 0x73, 0x99, 0x77, 0x77, 0x72, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA,
+    0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49,
+    0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA,
+    0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x77,
+    0x3E, 0xA7, 0x70, 0xD9, 0xD9, 0x77, 0xA9, 0x0D, 0x77, 0x2A, 0xC9, 0x77, 0x1D, 0x77, 0x0C, 0xA0,
+    0x99, 0x09, 0x97, 0x5D, 0xA9, 0x9A, 0xC9, 0x75, 0xAF, 0xC9, 0x77, 0x9A, 0xA9, 0x77, 0x39, 0x97,
+    0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90, 0xAD,
+    0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72, 0xAC,
+    0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA,
+    0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE, 0xA9,
+    0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x71, 0x99, 0x73, 0xAF, 0x71, 0x9D, 0x9D, 0xA7, 0x09,
+    0xC1, 0xAC, 0x97, 0x39, 0xCA, 0x73, 0xD9, 0x74, 0xCA, 0x71, 0xAA, 0x5A, 0x6D, 0x92, 0x9C, 0xA6,
+    0xAF, 0xE7, 0x0A, 0xFA, 0x73, 0x99, 0x77, 0x77, 0x72, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A,
+    0xDA, 0x1A, 0xEA, 0x39, 0xD9, 0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA,
+    0x29, 0xD9, 0x49, 0xD9, 0x2A, 0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0,
+    0x9C, 0x0A, 0xDA, 0x99, 0xD0, 0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59,
+    0x73, 0x77, 0x77, 0x1E, 0x91, 0xC9, 0x74, 0xFC, 0xAD, 0x97, 0x39, 0xC9, 0x09, 0xEA, 0x77, 0x29,
+    0x76, 0x9A, 0x5C, 0x74, 0xD9, 0x29, 0xD7, 0x4A, 0xFE, 0x76, 0xAF, 0xA7, 0x77, 0x77, 0x09, 0x97,
+    0x72, 0xE7, 0x71, 0x9E, 0x77, 0x1F, 0x97, 0x7A, 0xCA, 0xDA, 0x77, 0xD0, 0xE7, 0x6D, 0x90, 0xAD,
+    0x75, 0x9D, 0x1A, 0xD7, 0x5D, 0x91, 0x9D, 0x97, 0x3A, 0xD3, 0xDA, 0x73, 0xD4, 0xDA, 0x72, 0xAC,
+    0xA4, 0xE7, 0x2D, 0xA9, 0x99, 0x99, 0xE7, 0x1F, 0xFF, 0x97, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA,
+    0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x70, 0xE6, 0xD9, 0x70, 0xE5, 0xAD, 0x71, 0xE9, 0x29, 0xAE, 0xA9,
+    0x59, 0xAF, 0xC9, 0x9F, 0xE4, 0x9F, 0xE9, 0x6A, 0xCA, 0x2C, 0x7F, 0xC0, 0xAC, 0x95, 0xAC, 0xA0,
+    0xFC, 0x69, 0xC2, 0xDA, 0x77, 0x7A, 0xA5, 0xA6, 0xD9, 0x29, 0xCA, 0x6F, 0xF7, 0x0F, 0xCA, 0x73,
+    0x99, 0x77, 0x77, 0x72, 0x9F, 0x90, 0xAC, 0x94, 0xAF, 0xFC, 0x4A, 0xDA, 0x1A, 0xEA, 0x39, 0xD9,
+    0x39, 0xD9, 0x3D, 0xA4, 0x9D, 0x3A, 0xD5, 0xAD, 0x3D, 0xA5, 0xDA, 0x29, 0xD9, 0x49, 0xD9, 0x2A,
+    0xD5, 0xE3, 0xAD, 0x49, 0xE3, 0xE4, 0xEA, 0x3E, 0x3D, 0xAC, 0xA0, 0x9C, 0x0A, 0xDA, 0x99, 0xD0,
+    0xAC, 0xA9, 0xD0, 0x9F, 0xD9, 0x0A, 0xF2, 0xAE, 0xA2, 0x9E, 0x59, 0x73, 0x77, 0x77, 0x0D, 0x49,
+    0xA7, 0x39, 0xDA, 0x2A, 0xC9, 0x74, 0xFE, 0xA7, 0x6F, 0xC9, 0x77, 0x09, 0x99, 0x77, 0x77, 0x71,
+    0x99, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xF9, 0x77, 0xAC, 0xAD, 0xA7, 0x7D, 0x0E, 0x76, 0xD9,
+    0x0A, 0xD7, 0x59, 0xD1, 0xAD, 0x75, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x3D, 0xA7, 0x3D, 0x4D, 0xA7,
+    0x2A, 0xCA, 0x4E, 0x72, 0xDA, 0x99, 0x99, 0x9E, 0x71, 0xFF, 0xF9, 0x79, 0xDA, 0xAA, 0xAA, 0xAA,
+    0xAD, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD7, 0x0E, 0x6D, 0x97, 0x0E, 0x5A, 0xD7, 0x1E, 0x92, 0x9A,
+    0xEA, 0x95, 0x9A, 0xFC, 0x99, 0xFE, 0x49, 0xFE, 0x97, 0x77, 0x77, 0x74, 0x99, 0x77, 0x29, 0xE7,
+    0x71, 0xF7, 0x71, 0xE9, 0x77, 0x29, 0x73, 0x77, 0x5C, 0xA4, 0xA9, 0x59, 0xD9, 0x2D, 0x7F, 0xE9,
+    0x79, 0xFC, 0x97, 0x29, 0x97, 0x77, 0x77, 0x29, 0xF9, 0x0A, 0xC9, 0x4A, 0xFF, 0xC4, 0xAD, 0xA1,
+    0xAE, 0xA3, 0x9D, 0x93, 0x9D, 0x93, 0xDA, 0x49, 0xD3, 0xAD, 0x5A, 0xD3, 0xDA, 0x5D, 0xA2, 0x9D,
+    0x94, 0x9D, 0x92, 0xAD, 0x5E, 0x3A, 0xD4, 0x9E, 0x3E, 0x4E, 0xA3, 0xE3, 0xDA, 0xCA, 0x09, 0xC0,
+    0xAD, 0xA9, 0x9D, 0x0A, 0xCA, 0x9D, 0x09, 0xFD, 0x90, 0xAF, 0x2A, 0xEA, 0x29, 0xE5, 0x97, 0x77,
+    0x70, 0x99, 0x74, 0xE7, 0x3A, 0xE7, 0x3A, 0xD9, 0x77, 0x70, 0x77, 0x6A, 0xFF, 0xFC, 0x93, 0x9A,
+    0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69, 0xD9,
+    0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A, 0xD7,
+    0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xFD, 0x77, 0x77, 0x77, 0x09, 0x97, 0x7E, 0x97, 0x59, 0xE9, 0x75, 0x9E, 0x77, 0x99,
+    0x72, 0x77, 0x09, 0xFA, 0x4A, 0xDA, 0xE9, 0x2D, 0xA2, 0xDA, 0x1A, 0xCA, 0x3D, 0xA0, 0x9D, 0x39,
+    0xD9, 0x0D, 0xA2, 0x9D, 0xA1, 0xD9, 0x1A, 0xDA, 0x19, 0xD9, 0xF9, 0x2A, 0xFC, 0x94, 0xE9, 0x7E,
+    0x70, 0xAD, 0x5A, 0xA0, 0x9D, 0xA1, 0x9A, 0xD9, 0x1F, 0xF9, 0x29, 0xFC, 0xA7, 0x97, 0x75, 0x99,
+    0x70, 0x9E, 0x7E, 0xA7, 0xE7, 0x72, 0x77, 0x75, 0x9F, 0x74, 0xAD, 0xAE, 0x73, 0xD1, 0x9D, 0x74,
+    0x91, 0xD9, 0x75, 0xAD, 0x97, 0x5A, 0xCA, 0x77, 0x9C, 0x97, 0x77, 0x77, 0x6A, 0xFF, 0xFC, 0x93,
+    0x9A, 0xFF, 0xF6, 0x9D, 0x94, 0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69,
+    0xD9, 0x76, 0xAD, 0x49, 0x71, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A,
+    0xD7, 0x7E, 0x69, 0xA6, 0xDA, 0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF,
+    0xFC, 0x3A, 0xFF, 0xFD, 0x30, 0x77, 0x3A, 0xE9, 0x6F, 0xD5, 0x9C, 0xA1, 0xD5, 0x9C, 0x19, 0xD7,
+    0x09, 0xD9, 0x7A, 0xD9, 0x70, 0xD7, 0x2A, 0x97, 0x77, 0x72, 0x9F, 0xA5, 0xAD, 0xAE, 0x93, 0xDA,
+    0x2D, 0xA2, 0xAC, 0xA3, 0xDA, 0x19, 0xD3, 0x9D, 0x91, 0xDA, 0x29, 0xDA, 0x2D, 0x91, 0xAD, 0xA2,
+    0x9D, 0x9F, 0x93, 0xAF, 0xC9, 0x5E, 0x97, 0x0E, 0x71, 0xAD, 0x5A, 0xA1, 0x9D, 0xA1, 0x9A, 0xD9,
+    0x2F, 0xF9, 0x39, 0xFC, 0xA7, 0x09, 0x70, 0x77, 0x74, 0xE9, 0x1C, 0xA7, 0x1F, 0xC9, 0xAC, 0xA7,
+    0x09, 0xD0, 0xFC, 0x72, 0xC2, 0xE9, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF,
+    0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E, 0x6C, 0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A,
+    0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC, 0x97, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6,
+    0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D, 0x5A, 0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF,
+    0xFF, 0xD3, 0x69, 0x72, 0xAE, 0x1A, 0xC4, 0xAF, 0xA9, 0xD4, 0xD0, 0x9F, 0xA4, 0xAA, 0x19, 0xDA,
+    0x77, 0x77, 0x77, 0x09, 0xFA, 0x6A, 0xDA, 0xE9, 0x4D, 0xA2, 0xDA, 0x3A, 0xCA, 0x3D, 0xA2, 0x9D,
+    0x39, 0xD9, 0x2D, 0xA2, 0x9D, 0xA3, 0xD9, 0x1A, 0xDA, 0x39, 0xD9, 0xF9, 0x4A, 0xFC, 0x96, 0xE9,
+    0x71, 0xE7, 0x2A, 0xD5, 0xAA, 0x29, 0xDA, 0x19, 0xAD, 0x93, 0xFF, 0x94, 0x9F, 0xCA, 0x71, 0x97,
+    0x00, 0x77, 0x77, 0x70, 0x9C, 0x77, 0x3D, 0x97, 0x71, 0xE7, 0x71, 0xAC, 0xA7, 0x5A, 0xD1, 0xC9,
+    0x75, 0xFC, 0x77, 0xE0, 0xDA, 0x75, 0xDA, 0x2D, 0x75, 0xA9, 0x39, 0x97, 0x77, 0x6A, 0xFF, 0xFC,
+    0x96, 0x9A, 0xFF, 0xF7, 0x19, 0xD9, 0x49, 0xD7, 0x1A, 0xD6, 0xD7, 0x1E, 0x6C, 0x97, 0x1D, 0xA7,
+    0x72, 0xDA, 0x77, 0x19, 0xD9, 0x77, 0x1A, 0xD4, 0x97, 0x4F, 0xFC, 0xA7, 0x3F, 0xFC, 0x97, 0x29,
+    0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1A, 0xD7, 0x72, 0xE6, 0x9A, 0x71, 0xDA, 0x6D, 0x70, 0x9D, 0x95,
+    0x9D, 0x70, 0xAD, 0x93, 0x99, 0xDA, 0x6A, 0xFF, 0xFC, 0x6A, 0xFF, 0xFD, 0x60, 0x76, 0x97, 0x6D,
+    0x97, 0x4A, 0xD9, 0x73, 0x9D, 0xA7, 0x4D, 0x97, 0x4A, 0xC9, 0x71, 0xE9, 0x73, 0xFC, 0x72, 0xE9,
+    0xE7, 0x0E, 0x2D, 0x96, 0xAC, 0xA3, 0x9C, 0x77, 0x77, 0x73, 0x9F, 0xA7, 0x1A, 0xDA, 0xE9, 0x7D,
+    0xA2, 0xDA, 0x6A, 0xCA, 0x3D, 0xA5, 0x9D, 0x39, 0xD9, 0x5D, 0xA2, 0x9D, 0xA6, 0xD9, 0x1A, 0xDA,
+    0x69, 0xD9, 0xF9, 0x7A, 0xFC, 0x97, 0x1E, 0x97, 0x4E, 0x75, 0xAD, 0x5A, 0xA5, 0x9D, 0xA1, 0x9A,
+    0xD9, 0x6F, 0xF9, 0x79, 0xFC, 0xA7, 0x49, 0x73, 0x77, 0x77, 0x1A, 0xA7, 0x70, 0xD7, 0x70, 0xE7,
+    0x70, 0xD9, 0x73, 0xAD, 0x1A, 0x97, 0x2F, 0xC7, 0x4E, 0x0D, 0xA7, 0x2D, 0xA2, 0xD7, 0x2A, 0x93,
+    0x99, 0x77, 0x70, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF, 0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E,
+    0x6C, 0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC,
+    0x97, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6, 0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D,
+    0x5A, 0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xD3, 0x71, 0x97, 0x3D, 0x73, 0xE7,
+    0x29, 0xD9, 0x72, 0x9D, 0x73, 0x9C, 0xA6, 0xE9, 0x09, 0x6F, 0xC7, 0xE9, 0xE5, 0xE2, 0xD9, 0x3A,
+    0xCA, 0x39, 0xC7, 0x77, 0x72, 0x9F, 0xA6, 0xAD, 0xAE, 0x94, 0xDA, 0x2D, 0xA3, 0xAC, 0xA3, 0xDA,
+    0x29, 0xD3, 0x9D, 0x92, 0xDA, 0x29, 0xDA, 0x3D, 0x91, 0xAD, 0xA3, 0x9D, 0x9F, 0x94, 0xAF, 0xC9,
+    0x6E, 0x97, 0x1E, 0x72, 0xAD, 0x5A, 0xA2, 0x9D, 0xA1, 0x9A, 0xD9, 0x3F, 0xF9, 0x49, 0xFC, 0xA7,
+    0x19, 0x70, 0x77, 0x77, 0x59, 0xEA, 0x77, 0x0D, 0x9D, 0x77, 0x0A, 0x1D, 0x77, 0x19, 0xD9, 0x74,
+    0x9A, 0xA1, 0xD7, 0x5A, 0xF0, 0x99, 0x74, 0xAD, 0x9D, 0xA7, 0x5E, 0x2D, 0x97, 0x4A, 0x94, 0xA7,
+    0x77, 0x6A, 0xFF, 0xFC, 0x96, 0x9A, 0xFF, 0xF7, 0x19, 0xD9, 0x49, 0xD7, 0x1A, 0xD6, 0xD7, 0x1E,
+    0x6C, 0x97, 0x1D, 0xA7, 0x72, 0xDA, 0x77, 0x19, 0xD9, 0x77, 0x1A, 0xD4, 0x97, 0x4F, 0xFC, 0xA7,
+    0x3F, 0xFC, 0x97, 0x29, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1A, 0xD7, 0x72, 0xE6, 0x9A, 0x71, 0xDA,
+    0x6D, 0x70, 0x9D, 0x95, 0x9D, 0x70, 0xAD, 0x93, 0x99, 0xDA, 0x6A, 0xFF, 0xFC, 0x6A, 0xFF, 0xFD,
+    0x60, 0x73, 0x9A, 0xAA, 0x74, 0xAF, 0xC7, 0x3D, 0x09, 0xD7, 0x39, 0x19, 0xCA, 0x75, 0xAD, 0x75,
+    0xD9, 0x71, 0xAA, 0xC1, 0xAA, 0x71, 0xFC, 0x73, 0xAD, 0x9E, 0x71, 0xE2, 0xD9, 0x7A, 0xCA, 0x39,
+    0xC7, 0x77, 0x77, 0x69, 0xFA, 0x72, 0xAD, 0xAE, 0x97, 0x0D, 0xA2, 0xDA, 0x7A, 0xCA, 0x3D, 0xA6,
+    0x9D, 0x39, 0xD9, 0x6D, 0xA2, 0x9D, 0xA7, 0xD9, 0x1A, 0xDA, 0x79, 0xD9, 0xF9, 0x70, 0xAF, 0xC9,
+    0x72, 0xE9, 0x75, 0xE7, 0x6A, 0xD5, 0xAA, 0x69, 0xDA, 0x19, 0xAD, 0x97, 0xFF, 0x97, 0x09, 0xFC,
+    0xA7, 0x59, 0x74, 0x77, 0x74, 0x9D, 0xA1, 0xAA, 0x72, 0xFC, 0xAD, 0x71, 0x9C, 0x1A, 0xE9, 0x72,
+    0x93, 0x97, 0x69, 0x97, 0x7F, 0x75, 0xDA, 0xAD, 0x72, 0x9D, 0xA1, 0xAC, 0xA7, 0x19, 0xA9, 0x3A,
+    0x77, 0x71, 0xAF, 0xFF, 0xC9, 0x39, 0xAF, 0xFF, 0x69, 0xD9, 0x49, 0xD6, 0xAD, 0x6D, 0x6E, 0x6C,
+    0x96, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD4, 0x97, 0x1F, 0xFC, 0xA7, 0x0F, 0xFC, 0x97,
+    0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE6, 0x9A, 0x6D, 0xA6, 0xD5, 0x9D, 0x95, 0x9D, 0x5A,
+    0xD9, 0x39, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xD3, 0x5A, 0xCA, 0x2A, 0x5F, 0xC0, 0x9C,
+    0xA3, 0x9D, 0x9F, 0xC9, 0x4C, 0x2A, 0xD9, 0x77, 0x59, 0xAA, 0x71, 0xFC, 0x7E, 0x9E, 0x5D, 0xA1,
+    0x9D, 0x4D, 0x93, 0xAC, 0x77, 0x77, 0x29, 0xFA, 0x6A, 0xDA, 0xE9, 0x4D, 0xA2, 0xDA, 0x3A, 0xCA,
+    0x3D, 0xA2, 0x9D, 0x39, 0xD9, 0x2D, 0xA2, 0x9D, 0xA3, 0xD9, 0x1A, 0xDA, 0x39, 0xD9, 0xF9, 0x4A,
+    0xFC, 0x96, 0xE9, 0x71, 0xE7, 0x2A, 0xD5, 0xAA, 0x29, 0xDA, 0x19, 0xAD, 0x93, 0xFF, 0x94, 0x9F,
+    0xCA, 0x71, 0x97, 0x00, 0x74, 0x99, 0x77, 0xEA, 0x75, 0xFC, 0x97, 0x3E, 0x0E, 0x72, 0xE2, 0xAC,
+    0xA7, 0x0A, 0xCA, 0x4C, 0x97, 0x77, 0x77, 0x2A, 0xFF, 0xFC, 0x93, 0x9A, 0xFF, 0xF6, 0x9D, 0x94,
+    0x9D, 0x6A, 0xD6, 0xD6, 0xE6, 0xC9, 0x6D, 0xA7, 0x7D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x49, 0x71,
+    0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xDA, 0x76, 0xAD, 0x97, 0x6A, 0xD7, 0x7E, 0x69, 0xA6, 0xDA,
+    0x6D, 0x59, 0xD9, 0x59, 0xD5, 0xAD, 0x93, 0x99, 0xDA, 0x3A, 0xFF, 0xFC, 0x3A, 0xFF, 0xFD, 0x77,
+    0x77, 0x77, 0x09, 0x97, 0x7E, 0x97, 0x59, 0xE9, 0x75, 0x9E, 0x77, 0x99, 0x72, 0x77, 0x39, 0xDA,
+    0x70, 0xF9, 0x6D, 0xAE, 0x5D, 0xA0, 0x9D, 0x4A, 0xD2, 0xAC, 0x93, 0xCA, 0x4C, 0x77, 0x77, 0x9F,
+    0xA5, 0xAD, 0xAE, 0x93, 0xDA, 0x2D, 0xA2, 0xAC, 0xA3, 0xDA, 0x19, 0xD3, 0x9D, 0x91, 0xDA, 0x29,
+    0xDA, 0x2D, 0x91, 0xAD, 0xA2, 0x9D, 0x9F, 0x93, 0xAF, 0xC9, 0x5E, 0x97, 0x0E, 0x71, 0xAD, 0x5A,
+    0xA1, 0x9D, 0xA1, 0x9A, 0xD9, 0x2F, 0xF9, 0x39, 0xFC, 0xA7, 0x09, 0x77, 0x79, 0x97, 0x19, 0xE7,
+    0x0E, 0xA7, 0x0E, 0x77, 0x40, 0x77, 0x49, 0xF9, 0x69, 0xDA, 0xE6, 0xAC, 0x91, 0xD7, 0x91, 0xAC,
+    0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x73, 0xCA, 0x77, 0x77, 0x3A, 0xFE, 0x94, 0x9A, 0xFA, 0x97, 0x9D,
+    0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7,
+    0x19, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x0A,
+    0xFD, 0x94, 0xAF, 0xE9, 0x40, 0x76, 0xAE, 0x39, 0xDA, 0xE2, 0xD9, 0x09, 0xD2, 0x9A, 0x1A, 0xCA,
+    0x5A, 0xD5, 0xE5, 0x9C, 0xA7, 0xC7, 0x77, 0x09, 0xAE, 0x39, 0xFC, 0x95, 0x9D, 0x6A, 0xD6, 0xDA,
+    0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xDA, 0x09, 0xC3, 0xDA, 0xAD, 0x29,
+    0xFC, 0x4E, 0xA7, 0x60, 0x77, 0x0A, 0xFE, 0x93, 0x9A, 0xFA, 0x96, 0x9D, 0x97, 0x0A, 0xD7, 0x1E,
+    0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD,
+    0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0xAF, 0xD9, 0x3A, 0xFE, 0x97,
+    0x77, 0x70, 0x99, 0x71, 0xE9, 0x79, 0xE9, 0x79, 0xE7, 0x19, 0x97, 0x00, 0x77, 0xE5, 0x9E, 0x5A,
+    0xE6, 0xAA, 0x77, 0x77, 0x19, 0xAE, 0x39, 0xFC, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x59, 0xD9, 0x5A,
+    0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xDA, 0x09, 0xC3, 0xDA, 0xAD, 0x29, 0xFC, 0x4E, 0xA7,
+    0x77, 0x19, 0x96, 0xE5, 0x9E, 0x59, 0xDA, 0x77, 0x71, 0x99, 0x99, 0x74, 0xAF, 0xEA, 0x70, 0x9F,
+    0xFE, 0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92, 0x9D, 0xA7, 0x09, 0xE2, 0xE7, 0x2E, 0x1A, 0xD9,
+    0x72, 0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xE7,
+    0x39, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE9, 0x72, 0xE1, 0xAD, 0x97, 0x1A, 0xD9, 0x19, 0xE7, 0x09,
+    0xDA, 0x3E, 0x96, 0x9E, 0x49, 0xEA, 0x39, 0xF6, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97,
+    0x77, 0x74, 0x99, 0x77, 0x0E, 0x77, 0xAE, 0x77, 0xAD, 0xA7, 0x70, 0x99, 0x74, 0x77, 0x29, 0xFC,
+    0x95, 0xFF, 0x93, 0xE9, 0x19, 0xE2, 0xE4, 0xAD, 0x90, 0x9D, 0x94, 0x9D, 0xA0, 0xE6, 0xDA, 0x9D,
+    0x95, 0x9D, 0x9A, 0xD6, 0x9D, 0x9A, 0xD6, 0xAD, 0x0E, 0x6D, 0xA0, 0xE5, 0xAD, 0x90, 0xAD, 0x93,
+    0x9D, 0xA1, 0x9E, 0x29, 0xE3, 0xFF, 0xC5, 0xAF, 0xC9, 0x70, 0x97, 0x77, 0x19, 0x97, 0x29, 0xE7,
+    0x1E, 0xA7, 0x1E, 0x77, 0x60, 0x77, 0x75, 0xAF, 0x75, 0xAD, 0xAD, 0xA7, 0x4D, 0x1A, 0xCA, 0x74,
+    0x99, 0x09, 0xD9, 0x76, 0xAD, 0x77, 0xAC, 0xA7, 0x70, 0x9C, 0x77, 0x77, 0x59, 0x99, 0x97, 0x4A,
+    0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94, 0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E,
+    0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD,
+    0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD,
+    0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69, 0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF,
+    0xDA, 0x76, 0x99, 0x72, 0x77, 0x59, 0xEA, 0x7A, 0xFC, 0x96, 0xD1, 0xD9, 0x6A, 0x91, 0xD7, 0x2D,
+    0x97, 0x09, 0xD9, 0x71, 0xD7, 0x3A, 0xA7, 0x77, 0x74, 0x9F, 0xC9, 0x5F, 0xF9, 0x3E, 0x91, 0x9E,
+    0x2E, 0x4A, 0xD9, 0x09, 0xD9, 0x49, 0xDA, 0x0E, 0x6D, 0xA9, 0xD9, 0x59, 0xD9, 0xAD, 0x69, 0xD9,
+    0xAD, 0x6A, 0xD0, 0xE6, 0xDA, 0x0E, 0x5A, 0xD9, 0x0A, 0xD9, 0x39, 0xDA, 0x19, 0xE2, 0x9E, 0x3F,
+    0xFC, 0x5A, 0xFC, 0x97, 0x09, 0x70, 0x77, 0x77, 0x69, 0xC7, 0x72, 0xD9, 0x77, 0x0E, 0x77, 0x0A,
+    0xCA, 0x74, 0xAD, 0x1C, 0x97, 0x4F, 0xA7, 0x6D, 0xA0, 0xDA, 0x74, 0xDA, 0x2D, 0x73, 0x9A, 0x93,
+    0x99, 0x76, 0x99, 0x99, 0x75, 0xAF, 0xEA, 0x71, 0x9F, 0xFE, 0x7A, 0xE9, 0x4F, 0x5A, 0xDA, 0x7E,
+    0x93, 0x9D, 0xA7, 0x09, 0xE3, 0xE7, 0x2E, 0x2A, 0xD9, 0x72, 0xE2, 0xE7, 0x3E, 0x19, 0xDA, 0x73,
+    0xE1, 0xAD, 0x97, 0x3E, 0x1A, 0xD9, 0x73, 0xE1, 0xE7, 0x39, 0xDA, 0x1E, 0x73, 0xAD, 0x91, 0xE9,
+    0x72, 0xE2, 0xAD, 0x97, 0x1A, 0xD9, 0x29, 0xE7, 0x09, 0xDA, 0x4E, 0x96, 0x9E, 0x59, 0xEA, 0x39,
+    0xF7, 0x9F, 0xFD, 0xA7, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x30, 0x77, 0xA7, 0x7A, 0xCA, 0x75, 0x9D,
+    0x97, 0x5D, 0xA7, 0x5D, 0xA7, 0x59, 0xC9, 0x72, 0xAD, 0x97, 0x4F, 0xC9, 0x72, 0xE9, 0xE7, 0x1E,
+    0x91, 0xDA, 0x79, 0xD4, 0xC9, 0x77, 0x77, 0x74, 0x9F, 0xC9, 0x71, 0xFF, 0x97, 0xE9, 0x19, 0xE6,
+    0xE4, 0xAD, 0x94, 0x9D, 0x94, 0x9D, 0xA4, 0xE6, 0xDA, 0x39, 0xD9, 0x59, 0xD9, 0x3A, 0xD6, 0x9D,
+    0x93, 0xAD, 0x6A, 0xD4, 0xE6, 0xDA, 0x4E, 0x5A, 0xD9, 0x4A, 0xD9, 0x39, 0xDA, 0x59, 0xE2, 0x9E,
+    0x7F, 0xFC, 0x71, 0xAF, 0xC9, 0x74, 0x97, 0x40, 0x77, 0x77, 0x1A, 0xA7, 0x70, 0x9D, 0x77, 0x1D,
+    0xA7, 0x71, 0xD9, 0x74, 0xAC, 0xA1, 0xC9, 0x73, 0xFA, 0x75, 0xDA, 0x0D, 0xA7, 0x3D, 0xA2, 0xD7,
+    0x29, 0xA9, 0x39, 0x97, 0x59, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94, 0xF4,
+    0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE0,
+    0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3A,
+    0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69, 0xE4,
+    0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x72, 0xA7, 0x4D, 0x97,
+    0x3E, 0x74, 0xDA, 0x74, 0xD9, 0x74, 0xD7, 0xAD, 0x91, 0x96, 0xFC, 0x97, 0xE9, 0xE6, 0xE9, 0x1D,
+    0xA4, 0xAD, 0x4C, 0x97, 0x77, 0x73, 0x9F, 0xC9, 0x6F, 0xF9, 0x4E, 0x91, 0x9E, 0x3E, 0x4A, 0xD9,
+    0x19, 0xD9, 0x49, 0xDA, 0x1E, 0x6D, 0xA0, 0x9D, 0x95, 0x9D, 0x90, 0xAD, 0x69, 0xD9, 0x0A, 0xD6,
+    0xAD, 0x1E, 0x6D, 0xA1, 0xE5, 0xAD, 0x91, 0xAD, 0x93, 0x9D, 0xA2, 0x9E, 0x29, 0xE4, 0xFF, 0xC6,
+    0xAF, 0xC9, 0x71, 0x97, 0x10, 0x77, 0x77, 0x39, 0xEA, 0x77, 0xCA, 0x9D, 0x77, 0xA1, 0xD7, 0x70,
+    0x9D, 0x74, 0x9A, 0xA1, 0xCA, 0x74, 0xAE, 0xA0, 0x97, 0x4E, 0x9D, 0xA7, 0x4D, 0xA2, 0xD7, 0x4A,
+    0x93, 0x99, 0x76, 0x99, 0x99, 0x75, 0xAF, 0xEA, 0x71, 0x9F, 0xFE, 0x7A, 0xE9, 0x4F, 0x5A, 0xDA,
+    0x7E, 0x93, 0x9D, 0xA7, 0x09, 0xE3, 0xE7, 0x2E, 0x2A, 0xD9, 0x72, 0xE2, 0xE7, 0x3E, 0x19, 0xDA,
+    0x73, 0xE1, 0xAD, 0x97, 0x3E, 0x1A, 0xD9, 0x73, 0xE1, 0xE7, 0x39, 0xDA, 0x1E, 0x73, 0xAD, 0x91,
+    0xE9, 0x72, 0xE2, 0xAD, 0x97, 0x1A, 0xD9, 0x29, 0xE7, 0x09, 0xDA, 0x4E, 0x96, 0x9E, 0x59, 0xEA,
+    0x39, 0xF7, 0x9F, 0xFD, 0xA7, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x30, 0x75, 0xAA, 0xA7, 0x59, 0xFC,
+    0x74, 0xD1, 0xD7, 0x49, 0x91, 0xD7, 0x6A, 0xD7, 0x6A, 0xCA, 0x72, 0x9A, 0xC9, 0x09, 0xA7, 0x2A,
+    0xF9, 0x73, 0xAD, 0x9E, 0x72, 0xAD, 0x2D, 0xA7, 0x09, 0xCA, 0x39, 0xC9, 0x77, 0x77, 0x77, 0x9F,
+    0xC9, 0x72, 0xFF, 0x97, 0x0E, 0x91, 0x9E, 0x7E, 0x4A, 0xD9, 0x59, 0xD9, 0x49, 0xDA, 0x5E, 0x6D,
+    0xA4, 0x9D, 0x95, 0x9D, 0x94, 0xAD, 0x69, 0xD9, 0x4A, 0xD6, 0xAD, 0x5E, 0x6D, 0xA5, 0xE5, 0xAD,
+    0x95, 0xAD, 0x93, 0x9D, 0xA6, 0x9E, 0x29, 0xE7, 0x0F, 0xFC, 0x72, 0xAF, 0xC9, 0x75, 0x97, 0x50,
+    0x77, 0x74, 0xAD, 0xA1, 0xAA, 0x72, 0x9F, 0xCA, 0xCA, 0x72, 0x9C, 0x1A, 0xE7, 0x70, 0x99, 0x77,
+    0x99, 0x77, 0x0F, 0x76, 0xDA, 0xE7, 0x39, 0xD9, 0x1D, 0x97, 0x2A, 0xA9, 0x3A, 0x76, 0x99, 0x99,
+    0x74, 0xAF, 0xEA, 0x70, 0x9F, 0xFE, 0x6A, 0xE9, 0x4F, 0x4A, 0xDA, 0x7E, 0x92, 0x9D, 0xA7, 0x09,
+    0xE2, 0xE7, 0x2E, 0x1A, 0xD9, 0x72, 0xE1, 0xE7, 0x3E, 0x09, 0xDA, 0x73, 0xE0, 0xAD, 0x97, 0x3E,
+    0x0A, 0xD9, 0x73, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE9, 0x72, 0xE1, 0xAD, 0x97,
+    0x1A, 0xD9, 0x19, 0xE7, 0x09, 0xDA, 0x3E, 0x96, 0x9E, 0x49, 0xEA, 0x39, 0xF6, 0x9F, 0xFD, 0xA7,
+    0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x69, 0xCA, 0x29, 0x95, 0xAF, 0x90, 0xD5, 0xD9, 0xAF, 0xA5,
+    0xC9, 0x19, 0xDA, 0x77, 0x79, 0xAA, 0x72, 0xAF, 0x70, 0xAD, 0x9E, 0x6E, 0x2D, 0x94, 0xAC, 0xA3,
+    0x9C, 0x77, 0x77, 0x49, 0xFC, 0x96, 0xFF, 0x94, 0xE9, 0x19, 0xE3, 0xE4, 0xAD, 0x91, 0x9D, 0x94,
+    0x9D, 0xA1, 0xE6, 0xDA, 0x09, 0xD9, 0x59, 0xD9, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x6A, 0xD1, 0xE6,
+    0xDA, 0x1E, 0x5A, 0xD9, 0x1A, 0xD9, 0x39, 0xDA, 0x29, 0xE2, 0x9E, 0x4F, 0xFC, 0x6A, 0xFC, 0x97,
+    0x19, 0x71, 0x73, 0x99, 0x77, 0x0E, 0x97, 0x6F, 0xC9, 0x74, 0xE0, 0xE7, 0x3D, 0xA2, 0xDA, 0x71,
+    0xAC, 0x94, 0xC9, 0x77, 0x77, 0x09, 0x99, 0x97, 0x4A, 0xFE, 0xA7, 0x09, 0xFF, 0xE6, 0xAE, 0x94,
+    0xF4, 0xAD, 0xA7, 0xE9, 0x29, 0xDA, 0x70, 0x9E, 0x2E, 0x72, 0xE1, 0xAD, 0x97, 0x2E, 0x1E, 0x73,
+    0xE0, 0x9D, 0xA7, 0x3E, 0x0A, 0xD9, 0x73, 0xE0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7,
+    0x3A, 0xD9, 0x0E, 0x97, 0x2E, 0x1A, 0xD9, 0x71, 0xAD, 0x91, 0x9E, 0x70, 0x9D, 0xA3, 0xE9, 0x69,
+    0xE4, 0x9E, 0xA3, 0x9F, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x77, 0x77, 0x49, 0x97,
+    0x70, 0xE7, 0x7A, 0xE7, 0x7A, 0xDA, 0x77, 0x09, 0x97, 0x40, 0x77, 0x6E, 0x71, 0xF9, 0x7A, 0xCA,
+    0xAD, 0x6A, 0xD1, 0xD9, 0x49, 0xD2, 0xAC, 0xA4, 0xD4, 0xC9, 0x77, 0x77, 0x09, 0xFC, 0x95, 0xFF,
+    0x93, 0xE9, 0x19, 0xE2, 0xE4, 0xAD, 0x90, 0x9D, 0x94, 0x9D, 0xA0, 0xE6, 0xDA, 0x9D, 0x95, 0x9D,
+    0x9A, 0xD6, 0x9D, 0x9A, 0xD6, 0xAD, 0x0E, 0x6D, 0xA0, 0xE5, 0xAD, 0x90, 0xAD, 0x93, 0x9D, 0xA1,
+    0x9E, 0x29, 0xE3, 0xFF, 0xC5, 0xAF, 0xC9, 0x70, 0x97, 0x77, 0x19, 0x97, 0x29, 0xE7, 0x1E, 0xA7,
+    0x1E, 0x77, 0x60, 0x75, 0x97, 0x74, 0xD9, 0x77, 0x1A, 0xE9, 0x77, 0x9F, 0xA7, 0x79, 0xEA, 0x59,
+    0xAA, 0x70, 0x99, 0x70, 0xE7, 0x73, 0xE7, 0x29, 0x99, 0x93, 0xAD, 0x97, 0xAF, 0xEA, 0x09, 0xDA,
+    0x69, 0xFF, 0xFC, 0x96, 0xAE, 0x94, 0xF7, 0xAD, 0xA7, 0xE9, 0x59, 0xDA, 0x70, 0x9E, 0x5E, 0x72,
+    0xE4, 0xAD, 0x97, 0x2E, 0x4E, 0x73, 0xE3, 0x9D, 0xA7, 0x3E, 0x3A, 0xD9, 0x73, 0xE3, 0xAD, 0x97,
+    0x3E, 0x3E, 0x73, 0x9D, 0xA3, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x2E, 0x4A, 0xD9, 0x71, 0xAD, 0x94,
+    0x9E, 0x70, 0x9D, 0xA6, 0xE9, 0x69, 0xE7, 0x9E, 0xA3, 0x9F, 0x71, 0x9F, 0xFD, 0xA7, 0x4A, 0xFD,
+    0xA7, 0x71, 0x99, 0x75, 0x71, 0x99, 0x76, 0xD7, 0x5E, 0x74, 0xAD, 0x97, 0x39, 0xD9, 0x74, 0xD9,
+    0x75, 0x94, 0xE7, 0x5E, 0x75, 0xDA, 0x59, 0xFC, 0x9E, 0x5F, 0xFC, 0xA5, 0xE9, 0x19, 0xE5, 0xE4,
+    0xAD, 0x93, 0x9D, 0x94, 0x9D, 0xA3, 0xE6, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0x9D, 0x92,
+    0xAD, 0x6A, 0xD3, 0xE6, 0xE3, 0xE5, 0xAD, 0x93, 0xAD, 0x49, 0xDA, 0x49, 0xE2, 0x9E, 0x6F, 0xFC,
+    0x70, 0xAF, 0xC9, 0x73, 0x97, 0x30, 0x79, 0x77, 0x49, 0xCA, 0x77, 0x3A, 0xE7, 0x72, 0x9F, 0x77,
+    0x3A, 0xE5, 0x9A, 0xA7, 0x39, 0x95, 0xE7, 0x73, 0xE7, 0x29, 0x99, 0x93, 0xAD, 0x97, 0xAF, 0xEA,
+    0x09, 0xDA, 0x69, 0xFF, 0xFC, 0x96, 0xAE, 0x94, 0xF7, 0xAD, 0xA7, 0xE9, 0x59, 0xDA, 0x70, 0x9E,
+    0x5E, 0x72, 0xE4, 0xAD, 0x97, 0x2E, 0x4E, 0x73, 0xE3, 0x9D, 0xA7, 0x3E, 0x3A, 0xD9, 0x73, 0xE3,
+    0xAD, 0x97, 0x3E, 0x3E, 0x73, 0x9D, 0xA3, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x2E, 0x4A, 0xD9, 0x71,
+    0xAD, 0x94, 0x9E, 0x70, 0x9D, 0xA6, 0xE9, 0x69, 0xE7, 0x9E, 0xA3, 0x9F, 0x71, 0x9F, 0xFD, 0xA7,
+    0x4A, 0xFD, 0xA7, 0x71, 0x99, 0x75, 0x77, 0x5A, 0xC7, 0x6D, 0xA7, 0x5E, 0x97, 0x5E, 0x76, 0xDA,
+    0x76, 0xAA, 0x2E, 0x75, 0xE7, 0x5D, 0xA5, 0x9F, 0xC9, 0xE5, 0xFF, 0xCA, 0x5E, 0x91, 0x9E, 0x5E,
+    0x4A, 0xD9, 0x39, 0xD9, 0x49, 0xDA, 0x3E, 0x6D, 0xA2, 0x9D, 0x95, 0x9D, 0x92, 0xAD, 0x69, 0xD9,
+    0x2A, 0xD6, 0xAD, 0x3E, 0x6E, 0x3E, 0x5A, 0xD9, 0x3A, 0xD4, 0x9D, 0xA4, 0x9E, 0x29, 0xE6, 0xFF,
+    0xC7, 0x0A, 0xFC, 0x97, 0x39, 0x73, 0x77, 0x77, 0x9F, 0x77, 0x0A, 0xDA, 0xE7, 0x7D, 0x19, 0xD7,
+    0x70, 0x91, 0xD9, 0x77, 0x1A, 0xD9, 0x77, 0x1A, 0xCA, 0x69, 0xAA, 0x71, 0x9C, 0x96, 0xE7, 0x73,
+    0xE7, 0x29, 0x99, 0x93, 0xAD, 0x97, 0xAF, 0xEA, 0x09, 0xDA, 0x69, 0xFF, 0xFC, 0x96, 0xAE, 0x94,
+    0xF7, 0xAD, 0xA7, 0xE9, 0x59, 0xDA, 0x70, 0x9E, 0x5E, 0x72, 0xE4, 0xAD, 0x97, 0x2E, 0x4E, 0x73,
+    0xE3, 0x9D, 0xA7, 0x3E, 0x3A, 0xD9, 0x73, 0xE3, 0xAD, 0x97, 0x3E, 0x3E, 0x73, 0x9D, 0xA3, 0xE7,
+    0x3A, 0xD9, 0x3E, 0x97, 0x2E, 0x4A, 0xD9, 0x71, 0xAD, 0x94, 0x9E, 0x70, 0x9D, 0xA6, 0xE9, 0x69,
+    0xE7, 0x9E, 0xA3, 0x9F, 0x71, 0x9F, 0xFD, 0xA7, 0x4A, 0xFD, 0xA7, 0x71, 0x99, 0x75, 0x77, 0x7A,
+    0xE9, 0x72, 0xFD, 0x71, 0x9C, 0xA1, 0xD7, 0x2C, 0x19, 0xD7, 0x49, 0xD9, 0x73, 0xAD, 0x97, 0x4D,
+    0x76, 0xA9, 0x3E, 0x75, 0xE7, 0x5D, 0xA5, 0x9F, 0xC9, 0xE5, 0xFF, 0xCA, 0x5E, 0x91, 0x9E, 0x5E,
+    0x4A, 0xD9, 0x39, 0xD9, 0x49, 0xDA, 0x3E, 0x6D, 0xA2, 0x9D, 0x95, 0x9D, 0x92, 0xAD, 0x69, 0xD9,
+    0x2A, 0xD6, 0xAD, 0x3E, 0x6E, 0x3E, 0x5A, 0xD9, 0x3A, 0xD4, 0x9D, 0xA4, 0x9E, 0x29, 0xE6, 0xFF,
+    0xC7, 0x0A, 0xFC, 0x97, 0x39, 0x73, 0x77, 0x76, 0xE9, 0x1C, 0xA7, 0x5F, 0xC9, 0xAC, 0xA7, 0x49,
+    0xD0, 0xAF, 0x76, 0xC9, 0x1E, 0x93, 0x9A, 0xA7, 0x73, 0xE7, 0x73, 0xE7, 0x29, 0x99, 0x93, 0xAD,
+    0x97, 0xAF, 0xEA, 0x09, 0xDA, 0x69, 0xFF, 0xFC, 0x96, 0xAE, 0x94, 0xF7, 0xAD, 0xA7, 0xE9, 0x59,
+    0xDA, 0x70, 0x9E, 0x5E, 0x72, 0xE4, 0xAD, 0x97, 0x2E, 0x4E, 0x73, 0xE3, 0x9D, 0xA7, 0x3E, 0x3A,
+    0xD9, 0x73, 0xE3, 0xAD, 0x97, 0x3E, 0x3E, 0x73, 0x9D, 0xA3, 0xE7, 0x3A, 0xD9, 0x3E, 0x97, 0x2E,
+    0x4A, 0xD9, 0x71, 0xAD, 0x94, 0x9E, 0x70, 0x9D, 0xA6, 0xE9, 0x69, 0xE7, 0x9E, 0xA3, 0x9F, 0x71,
+    0x9F, 0xFD, 0xA7, 0x4A, 0xFD, 0xA7, 0x71, 0x99, 0x75, 0x69, 0x75, 0xAE, 0x1A, 0xC7, 0xAF, 0xA9,
+    0xD7, 0xD0, 0x9F, 0xA7, 0xAA, 0x19, 0xDA, 0x77, 0x1E, 0x75, 0xE7, 0x5D, 0xA5, 0x9F, 0xC9, 0xE5,
+    0xFF, 0xCA, 0x5E, 0x91, 0x9E, 0x5E, 0x4A, 0xD9, 0x39, 0xD9, 0x49, 0xDA, 0x3E, 0x6D, 0xA2, 0x9D,
+    0x95, 0x9D, 0x92, 0xAD, 0x69, 0xD9, 0x2A, 0xD6, 0xAD, 0x3E, 0x6E, 0x3E, 0x5A, 0xD9, 0x3A, 0xD4,
+    0x9D, 0xA4, 0x9E, 0x29, 0xE6, 0xFF, 0xC7, 0x0A, 0xFC, 0x97, 0x39, 0x73, 0x77, 0x29, 0xAA, 0x77,
+    0x3E, 0x77, 0x3E, 0x72, 0x99, 0x99, 0x3A, 0xD9, 0x7A, 0xFE, 0xA0, 0x9D, 0xA6, 0x9F, 0xFF, 0xC9,
+    0x6A, 0xE9, 0x4F, 0x7A, 0xDA, 0x7E, 0x95, 0x9D, 0xA7, 0x09, 0xE5, 0xE7, 0x2E, 0x4A, 0xD9, 0x72,
+    0xE4, 0xE7, 0x3E, 0x39, 0xDA, 0x73, 0xE3, 0xAD, 0x97, 0x3E, 0x3A, 0xD9, 0x73, 0xE3, 0xE7, 0x39,
+    0xDA, 0x3E, 0x73, 0xAD, 0x93, 0xE9, 0x72, 0xE4, 0xAD, 0x97, 0x1A, 0xD9, 0x49, 0xE7, 0x09, 0xDA,
+    0x6E, 0x96, 0x9E, 0x79, 0xEA, 0x39, 0xF7, 0x19, 0xFF, 0xDA, 0x74, 0xAF, 0xDA, 0x77, 0x19, 0x97,
+    0x77, 0x77, 0x29, 0x97, 0x73, 0xE7, 0x72, 0xAE, 0x77, 0x2A, 0xDA, 0x77, 0x39, 0x97, 0x70, 0x77,
+    0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x59, 0xFC, 0x9E, 0x5F, 0xFC, 0xA5, 0xE9, 0x19, 0xE5, 0xE4, 0xAD,
+    0x93, 0x9D, 0x94, 0x9D, 0xA3, 0xE6, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0x9D, 0x92, 0xAD,
+    0x6A, 0xD3, 0xE6, 0xE3, 0xE5, 0xAD, 0x93, 0xAD, 0x49, 0xDA, 0x49, 0xE2, 0x9E, 0x6F, 0xFC, 0x70,
+    0xAF, 0xC9, 0x73, 0x97, 0x77, 0x79, 0x97, 0x59, 0xE7, 0x4E, 0xA7, 0x4E, 0x77, 0x74, 0x77, 0x6F,
+    0xEA, 0x4F, 0xE1, 0xAF, 0xCA, 0x5A, 0xFA, 0x4E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5, 0x9D, 0xA7,
+    0x0A, 0xD5, 0x9D, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x6D, 0xA7, 0x09, 0xD5,
+    0x9D, 0x97, 0x0A, 0xCA, 0x5A, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xE7,
+    0x0A, 0xD6, 0xE7, 0x0D, 0xA6, 0xE7, 0x9D, 0x7E, 0x95, 0x9D, 0xA7, 0xAE, 0xA2, 0x9A, 0xDA, 0x71,
+    0xFF, 0xDA, 0x73, 0xAF, 0xDA, 0x97, 0x79, 0x97, 0x77, 0x77, 0x19, 0x97, 0x72, 0xE9, 0x77, 0x09,
+    0xE9, 0x77, 0x09, 0xE7, 0x72, 0x99, 0x76, 0x77, 0x0A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD,
+    0x49, 0xD9, 0x3E, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD,
+    0x4D, 0x94, 0xE3, 0x9D, 0x4A, 0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C,
+    0x0E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x77, 0x77,
+    0x09, 0x74, 0x9E, 0x73, 0xF7, 0x3A, 0xD9, 0x77, 0x70, 0x77, 0x77, 0xAF, 0x77, 0xAD, 0xAD, 0xA7,
+    0x6D, 0x1A, 0xCA, 0x76, 0x99, 0x1D, 0x97, 0x70, 0xAD, 0x77, 0x1A, 0xCA, 0x77, 0x29, 0xC7, 0x77,
+    0x77, 0x76, 0xFE, 0xA4, 0xFE, 0x1A, 0xFC, 0xA5, 0xAF, 0xA4, 0xE7, 0x09, 0xD6, 0xDA, 0x70, 0x9D,
+    0x59, 0xDA, 0x70, 0xAD, 0x59, 0xD9, 0x70, 0xDA, 0x5A, 0xD7, 0x1D, 0x95, 0xE7, 0x09, 0xD6, 0xDA,
+    0x70, 0x9D, 0x59, 0xD9, 0x70, 0xAC, 0xA5, 0xAD, 0x97, 0x0D, 0xA5, 0xAD, 0x71, 0xD9, 0x5E, 0x70,
+    0x9D, 0x6E, 0x70, 0xAD, 0x6E, 0x70, 0xDA, 0x6E, 0x79, 0xD7, 0xE9, 0x59, 0xDA, 0x7A, 0xEA, 0x29,
+    0xAD, 0xA7, 0x1F, 0xFD, 0xA7, 0x3A, 0xFD, 0xA9, 0x77, 0x99, 0x75, 0x77, 0x79, 0xEA, 0x71, 0xAD,
+    0xAD, 0x97, 0x0D, 0x1A, 0xCA, 0x70, 0xA9, 0x1D, 0x97, 0x3D, 0xA7, 0x29, 0xDA, 0x73, 0xD9, 0x74,
+    0x9A, 0x77, 0x77, 0x6A, 0xF5, 0x9D, 0x0A, 0xFC, 0x5D, 0xA3, 0xAD, 0x49, 0xD9, 0x3E, 0x49, 0xD4,
+    0xDA, 0x4A, 0xD4, 0xD9, 0x4D, 0xA3, 0xAD, 0x5D, 0x93, 0xE4, 0xAD, 0x4D, 0x94, 0xE3, 0x9D, 0x4A,
+    0xDA, 0x3A, 0xD3, 0x9E, 0xA3, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x0E, 0x90, 0xAD, 0x0D, 0xAA,
+    0xCA, 0x0A, 0xFD, 0x1F, 0xC2, 0xFA, 0x2A, 0xDA, 0x59, 0x72, 0x76, 0x97, 0x73, 0x9D, 0x77, 0x2A,
+    0xE9, 0x77, 0x9F, 0xA7, 0x79, 0xEA, 0x5A, 0xC7, 0x19, 0x97, 0x9D, 0xA7, 0x72, 0x9D, 0x97, 0x71,
+    0x9E, 0x1F, 0xEA, 0x4F, 0xDA, 0x2A, 0xFC, 0xA5, 0xAE, 0xA6, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D,
+    0x69, 0xDA, 0x70, 0xAD, 0x69, 0xD9, 0x70, 0xDA, 0x6A, 0xD7, 0x1D, 0x96, 0xE7, 0x09, 0xD7, 0xDA,
+    0x70, 0x9D, 0x69, 0xD9, 0x70, 0xAC, 0xA6, 0xAD, 0x97, 0x0D, 0xA6, 0xAD, 0x71, 0xD9, 0x6E, 0x70,
+    0x9D, 0x7E, 0x70, 0xAD, 0x7E, 0x70, 0xDA, 0x7E, 0x79, 0xD7, 0x0E, 0x95, 0x9D, 0xA7, 0x0A, 0xEA,
+    0x29, 0xAD, 0xA7, 0x2F, 0xFD, 0xA7, 0x4A, 0xFD, 0xA9, 0x77, 0x09, 0x97, 0x60, 0x73, 0x97, 0x70,
+    0xAC, 0xA7, 0x6A, 0xD9, 0x75, 0x9D, 0xA7, 0x6D, 0xA7, 0x6A, 0xCA, 0x77, 0x99, 0x49, 0xD9, 0x76,
+    0x9D, 0x97, 0x59, 0xE1, 0xAF, 0x59, 0xEA, 0x1A, 0xFC, 0x5E, 0x6A, 0xD4, 0x9D, 0x96, 0xAD, 0x49,
+    0xD7, 0xDA, 0x4A, 0xD7, 0xD9, 0x4D, 0xA6, 0xAD, 0x5D, 0x96, 0xE4, 0xAD, 0x7D, 0x94, 0xE6, 0x9D,
+    0x4A, 0xDA, 0x6A, 0xD3, 0x9E, 0xA6, 0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x3E, 0x90, 0xAD, 0x0D,
+    0xAA, 0xCA, 0x3A, 0xFD, 0x1F, 0xC5, 0xFA, 0x2A, 0xDA, 0x70, 0x97, 0x50, 0x70, 0x97, 0x74, 0x9C,
+    0xA7, 0x73, 0xAD, 0xA7, 0x72, 0x9F, 0x77, 0x3A, 0xE5, 0xAC, 0x74, 0x99, 0x49, 0xDA, 0x77, 0x29,
+    0xD9, 0x77, 0x19, 0xE1, 0xFE, 0xA4, 0xFD, 0xA2, 0xAF, 0xCA, 0x5A, 0xEA, 0x6E, 0x70, 0x9D, 0x7D,
+    0xA7, 0x09, 0xD6, 0x9D, 0xA7, 0x0A, 0xD6, 0x9D, 0x97, 0x0D, 0xA6, 0xAD, 0x71, 0xD9, 0x6E, 0x70,
+    0x9D, 0x7D, 0xA7, 0x09, 0xD6, 0x9D, 0x97, 0x0A, 0xCA, 0x6A, 0xD9, 0x70, 0xDA, 0x6A, 0xD7, 0x1D,
+    0x96, 0xE7, 0x09, 0xD7, 0xE7, 0x0A, 0xD7, 0xE7, 0x0D, 0xA7, 0xE7, 0x9D, 0x70, 0xE9, 0x59, 0xDA,
+    0x70, 0xAE, 0xA2, 0x9A, 0xDA, 0x72, 0xFF, 0xDA, 0x74, 0xAF, 0xDA, 0x97, 0x70, 0x99, 0x76, 0x77,
+    0x70, 0x9C, 0x97, 0x7E, 0x77, 0xAD, 0xA7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x09, 0xC3, 0x9D, 0x97,
+    0x69, 0xD9, 0x75, 0x9E, 0x1A, 0xF5, 0x9E, 0xA1, 0xAF, 0xC5, 0xE6, 0xAD, 0x49, 0xD9, 0x6A, 0xD4,
+    0x9D, 0x7D, 0xA4, 0xAD, 0x7D, 0x94, 0xDA, 0x6A, 0xD5, 0xD9, 0x6E, 0x4A, 0xD7, 0xD9, 0x4E, 0x69,
+    0xD4, 0xAD, 0xA6, 0xAD, 0x39, 0xEA, 0x6A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC3, 0xE9, 0x0A, 0xD0,
+    0xDA, 0xAC, 0xA3, 0xAF, 0xD1, 0xFC, 0x5F, 0xA2, 0xAD, 0xA7, 0x09, 0x75, 0x77, 0x77, 0x0A, 0xF7,
+    0x70, 0xAD, 0xAD, 0xA7, 0x7D, 0x1A, 0xCA, 0x77, 0x99, 0x1D, 0x97, 0x71, 0xAD, 0x77, 0x2A, 0xCA,
+    0x6A, 0xC7, 0x29, 0xC6, 0x9D, 0xA7, 0x72, 0x9D, 0x97, 0x71, 0x9E, 0x1F, 0xEA, 0x4F, 0xDA, 0x2A,
+    0xFC, 0xA5, 0xAE, 0xA6, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xDA, 0x70, 0xAD, 0x69, 0xD9,
+    0x70, 0xDA, 0x6A, 0xD7, 0x1D, 0x96, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xD9, 0x70, 0xAC,
+    0xA6, 0xAD, 0x97, 0x0D, 0xA6, 0xAD, 0x71, 0xD9, 0x6E, 0x70, 0x9D, 0x7E, 0x70, 0xAD, 0x7E, 0x70,
+    0xDA, 0x7E, 0x79, 0xD7, 0x0E, 0x95, 0x9D, 0xA7, 0x0A, 0xEA, 0x29, 0xAD, 0xA7, 0x2F, 0xFD, 0xA7,
+    0x4A, 0xFD, 0xA9, 0x77, 0x09, 0x97, 0x60, 0x77, 0x72, 0x9E, 0xA7, 0x4A, 0xDA, 0xD9, 0x73, 0xD1,
+    0xAC, 0xA7, 0x3A, 0x91, 0xD9, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x6D, 0x97, 0x79, 0xA4, 0x9D, 0x97,
+    0x69, 0xD9, 0x75, 0x9E, 0x1A, 0xF5, 0x9E, 0xA1, 0xAF, 0xC5, 0xE6, 0xAD, 0x49, 0xD9, 0x6A, 0xD4,
+    0x9D, 0x7D, 0xA4, 0xAD, 0x7D, 0x94, 0xDA, 0x6A, 0xD5, 0xD9, 0x6E, 0x4A, 0xD7, 0xD9, 0x4E, 0x69,
+    0xD4, 0xAD, 0xA6, 0xAD, 0x39, 0xEA, 0x6A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09, 0xC3, 0xE9, 0x0A, 0xD0,
+    0xDA, 0xAC, 0xA3, 0xAF, 0xD1, 0xFC, 0x5F, 0xA2, 0xAD, 0xA7, 0x09, 0x75, 0x77, 0x77, 0xE9, 0x1C,
+    0x97, 0x5F, 0xC9, 0xAC, 0xA7, 0x49, 0xD0, 0xFC, 0x76, 0xC2, 0xE9, 0x3A, 0xC7, 0x73, 0x9D, 0xA7,
+    0x72, 0x9D, 0x97, 0x71, 0x9E, 0x1F, 0xEA, 0x4F, 0xDA, 0x2A, 0xFC, 0xA5, 0xAE, 0xA6, 0xE7, 0x09,
+    0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xDA, 0x70, 0xAD, 0x69, 0xD9, 0x70, 0xDA, 0x6A, 0xD7, 0x1D, 0x96,
+    0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xD9, 0x70, 0xAC, 0xA6, 0xAD, 0x97, 0x0D, 0xA6, 0xAD,
+    0x71, 0xD9, 0x6E, 0x70, 0x9D, 0x7E, 0x70, 0xAD, 0x7E, 0x70, 0xDA, 0x7E, 0x79, 0xD7, 0x0E, 0x95,
+    0x9D, 0xA7, 0x0A, 0xEA, 0x29, 0xAD, 0xA7, 0x2F, 0xFD, 0xA7, 0x4A, 0xFD, 0xA9, 0x77, 0x09, 0x97,
+    0x60, 0x79, 0x77, 0x9E, 0x2C, 0x97, 0x1F, 0xC9, 0xD9, 0x70, 0xAC, 0xA0, 0xFC, 0x71, 0x9C, 0x2D,
+    0xA7, 0x74, 0x9D, 0x97, 0x69, 0xD9, 0x75, 0x9E, 0x1A, 0xF5, 0x9E, 0xA1, 0xAF, 0xC5, 0xE6, 0xAD,
+    0x49, 0xD9, 0x6A, 0xD4, 0x9D, 0x7D, 0xA4, 0xAD, 0x7D, 0x94, 0xDA, 0x6A, 0xD5, 0xD9, 0x6E, 0x4A,
+    0xD7, 0xD9, 0x4E, 0x69, 0xD4, 0xAD, 0xA6, 0xAD, 0x39, 0xEA, 0x6A, 0xD2, 0x9C, 0xAA, 0xC9, 0x09,
+    0xC3, 0xE9, 0x0A, 0xD0, 0xDA, 0xAC, 0xA3, 0xAF, 0xD1, 0xFC, 0x5F, 0xA2, 0xAD, 0xA7, 0x09, 0x75,
+    0x77, 0x3A, 0xC7, 0x73, 0x9D, 0xA7, 0x72, 0x9D, 0x97, 0x71, 0x9E, 0x1F, 0xEA, 0x4F, 0xDA, 0x2A,
+    0xFC, 0xA5, 0xAE, 0xA6, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xDA, 0x70, 0xAD, 0x69, 0xD9,
+    0x70, 0xDA, 0x6A, 0xD7, 0x1D, 0x96, 0xE7, 0x09, 0xD7, 0xDA, 0x70, 0x9D, 0x69, 0xD9, 0x70, 0xAC,
+    0xA6, 0xAD, 0x97, 0x0D, 0xA6, 0xAD, 0x71, 0xD9, 0x6E, 0x70, 0x9D, 0x7E, 0x70, 0xAD, 0x7E, 0x70,
+    0xDA, 0x7E, 0x79, 0xD7, 0x0E, 0x95, 0x9D, 0xA7, 0x0A, 0xEA, 0x29, 0xAD, 0xA7, 0x2F, 0xFD, 0xA7,
+    0x4A, 0xFD, 0xA9, 0x77, 0x09, 0x97, 0x77, 0x77, 0x39, 0x97, 0x73, 0xE9, 0x77, 0x19, 0xE9, 0x77,
+    0x19, 0xE7, 0x73, 0x99, 0x77, 0x77, 0x77, 0x19, 0xD9, 0x76, 0x9D, 0x97, 0x59, 0xE1, 0xAF, 0x59,
+    0xEA, 0x1A, 0xFC, 0x5E, 0x6A, 0xD4, 0x9D, 0x96, 0xAD, 0x49, 0xD7, 0xDA, 0x4A, 0xD7, 0xD9, 0x4D,
+    0xA6, 0xAD, 0x5D, 0x96, 0xE4, 0xAD, 0x7D, 0x94, 0xE6, 0x9D, 0x4A, 0xDA, 0x6A, 0xD3, 0x9E, 0xA6,
+    0xAD, 0x29, 0xCA, 0xAC, 0x90, 0x9C, 0x3E, 0x90, 0xAD, 0x0D, 0xAA, 0xCA, 0x3A, 0xFD, 0x1F, 0xC5,
+    0xFA, 0x2A, 0xDA, 0x70, 0x97, 0x77, 0x76, 0x97, 0x79, 0xE7, 0x6F, 0x76, 0xAD, 0x97, 0x77, 0x50,
+    0x77, 0x73, 0xD7, 0x70, 0x9E, 0x77, 0x0F, 0x97, 0x79, 0xE7, 0x72, 0xA7, 0x77, 0x77, 0x7F, 0xF2,
+    0xFE, 0x90, 0xAF, 0xCA, 0x39, 0xFC, 0x93, 0xE7, 0xDA, 0x5E, 0x6E, 0x69, 0xDA, 0x4A, 0xD7, 0x0E,
+    0x39, 0xD9, 0x70, 0xAD, 0x3D, 0xA7, 0x2D, 0xA1, 0xAD, 0x73, 0xE0, 0x9D, 0x74, 0x9D, 0xAD, 0x97,
+    0x5F, 0xA7, 0x6A, 0xE7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77,
+    0xAD, 0x76, 0xAF, 0xDA, 0x72, 0xFF, 0xA7, 0x00, 0x77, 0x71, 0x9C, 0x97, 0x6E, 0x76, 0xAD, 0xA7,
+    0x6A, 0xD9, 0x76, 0xAD, 0x77, 0x9C, 0x77, 0x77, 0x74, 0x9A, 0xD9, 0x4E, 0x39, 0xFC, 0x4A, 0xDA,
+    0x5A, 0xD9, 0x4D, 0xA6, 0xDA, 0x4D, 0xA6, 0xE4, 0xD9, 0x6A, 0xD3, 0x9D, 0x70, 0xD9, 0x2A, 0xCA,
+    0x70, 0xD9, 0x2D, 0x71, 0xDA, 0x19, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x1A, 0xCA, 0x09, 0xCA, 0x72,
+    0x9C, 0xA0, 0xD7, 0x39, 0xCA, 0xAC, 0x97, 0x3A, 0xEA, 0x74, 0xAE, 0x75, 0xE7, 0x59, 0xD9, 0x75,
+    0xD9, 0x70, 0x92, 0x9D, 0x97, 0x09, 0xFD, 0x72, 0x9F, 0xA7, 0x4A, 0xCA, 0x75, 0x77, 0x4F, 0xF2,
+    0xFE, 0x90, 0xAF, 0xCA, 0x39, 0xFC, 0x93, 0xE7, 0xDA, 0x5E, 0x6E, 0x69, 0xDA, 0x4A, 0xD7, 0x0E,
+    0x39, 0xD9, 0x70, 0xAD, 0x3D, 0xA7, 0x2D, 0xA1, 0xAD, 0x73, 0xE0, 0x9D, 0x74, 0x9D, 0xAD, 0x97,
+    0x5F, 0xA7, 0x6A, 0xE7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77,
+    0xAD, 0x76, 0xAF, 0xDA, 0x72, 0xFF, 0xA7, 0x77, 0x77, 0x75, 0x99, 0x77, 0x0E, 0x97, 0x6A, 0xE9,
+    0x76, 0xAD, 0xA7, 0x70, 0x99, 0x75, 0x77, 0x59, 0xAD, 0x94, 0xE3, 0x9F, 0xC4, 0xAD, 0xA5, 0xAD,
+    0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D, 0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92, 0xAC, 0xA7, 0x0D,
+    0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C, 0xA7, 0x29, 0xCA,
+    0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x5D, 0x94,
+    0x99, 0x19, 0x29, 0xD9, 0x4E, 0x09, 0xFD, 0x59, 0xE0, 0x9F, 0xA6, 0x9D, 0xA1, 0xAC, 0xA7, 0x50,
+    0x77, 0x74, 0x9F, 0x97, 0x49, 0xDA, 0xE7, 0x4A, 0xC9, 0x1D, 0x75, 0x91, 0xAC, 0xA7, 0x69, 0xD9,
+    0x76, 0x9D, 0x77, 0x1C, 0xA7, 0x77, 0x77, 0x70, 0xFF, 0x2F, 0xE9, 0x0A, 0xFC, 0xA3, 0x9F, 0xC9,
+    0x3E, 0x7D, 0xA5, 0xE6, 0xE6, 0x9D, 0xA4, 0xAD, 0x70, 0xE3, 0x9D, 0x97, 0x0A, 0xD3, 0xDA, 0x72,
+    0xDA, 0x1A, 0xD7, 0x3E, 0x09, 0xD7, 0x49, 0xDA, 0xD9, 0x75, 0xFA, 0x76, 0xAE, 0x77, 0xAD, 0x97,
+    0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x6A, 0xFD, 0xA7, 0x2F, 0xFA,
+    0x70, 0x77, 0x73, 0x9E, 0xA7, 0x3A, 0xDA, 0xD9, 0x72, 0xD1, 0xAC, 0xA7, 0x2A, 0x91, 0xD9, 0x75,
+    0xDA, 0x74, 0x9D, 0xA7, 0x5D, 0x97, 0x69, 0xA7, 0x77, 0x77, 0x59, 0xAD, 0x94, 0xE3, 0x9F, 0xC4,
+    0xAD, 0xA5, 0xAD, 0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D, 0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92,
+    0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C,
+    0xA7, 0x29, 0xCA, 0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE, 0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D,
+    0x97, 0x5D, 0x97, 0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7, 0x29, 0xFA, 0x74, 0xAC, 0xA7, 0x50, 0x77,
+    0x73, 0xAD, 0xA1, 0xAC, 0x72, 0xAF, 0xA9, 0xD7, 0x2D, 0x9A, 0xFA, 0x72, 0xCA, 0x1A, 0xDA, 0x77,
+    0x77, 0x77, 0x77, 0x1F, 0xF2, 0xFE, 0x90, 0xAF, 0xCA, 0x39, 0xFC, 0x93, 0xE7, 0xDA, 0x5E, 0x6E,
+    0x69, 0xDA, 0x4A, 0xD7, 0x0E, 0x39, 0xD9, 0x70, 0xAD, 0x3D, 0xA7, 0x2D, 0xA1, 0xAD, 0x73, 0xE0,
+    0x9D, 0x74, 0x9D, 0xAD, 0x97, 0x5F, 0xA7, 0x6A, 0xE7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77,
+    0x0D, 0xA7, 0x79, 0xD9, 0x77, 0xAD, 0x76, 0xAF, 0xDA, 0x72, 0xFF, 0xA7, 0x00, 0x71, 0x97, 0x69,
+    0xE2, 0xC9, 0x70, 0xFC, 0x9D, 0x97, 0xAC, 0xA0, 0xFC, 0x70, 0x9C, 0x2D, 0xA7, 0x77, 0x77, 0x77,
+    0x49, 0xAD, 0x94, 0xE3, 0x9F, 0xC4, 0xAD, 0xA5, 0xAD, 0x94, 0xDA, 0x6D, 0xA4, 0xDA, 0x6E, 0x4D,
+    0x96, 0xAD, 0x39, 0xD7, 0x0D, 0x92, 0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D, 0xA1, 0x9D, 0x71, 0xAC,
+    0xA1, 0xD9, 0x71, 0xAC, 0xA0, 0x9C, 0xA7, 0x29, 0xCA, 0x0D, 0x73, 0x9C, 0xAA, 0xC9, 0x73, 0xAE,
+    0xA7, 0x4A, 0xE7, 0x5E, 0x75, 0x9D, 0x97, 0x5D, 0x97, 0x09, 0x29, 0xD9, 0x70, 0x9F, 0xD7, 0x29,
+    0xFA, 0x74, 0xAC, 0xA7, 0x50, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x99, 0x19, 0x99,
+    0xC9, 0x9C, 0x90, 0x9D, 0x92, 0xD2, 0xF0, 0x99, 0xAA, 0x99, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A, 0xAA,
+    0xAA, 0xAD, 0x9A, 0xCA, 0xAA, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA, 0x19,
+    0xC9, 0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74, 0x9C,
+    0x95, 0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xAA, 0xAA, 0xA9, 0x9D, 0xAA, 0xAA, 0xAC, 0xA0, 0x9C, 0x93,
+    0x9A, 0x19, 0xC9, 0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79,
+    0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x9A, 0x79, 0xA7, 0x10, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAA,
+    0x9F, 0xFA, 0xAF, 0xE9, 0xAF, 0xFF, 0xAA, 0xFF, 0xFA, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x0F, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF, 0xFF, 0xCA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF, 0xFF, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0x93,
+    0x99, 0x1D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA,
+    0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D,
+    0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2,
+    0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA,
+    0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D,
+    0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0A, 0xA9, 0x2A, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x9F, 0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA,
+    0x76, 0x49, 0x39, 0xD3, 0xD3, 0xDA, 0x29, 0xD3, 0xE3, 0xE2, 0x9E, 0x3E, 0x71, 0x19, 0xAA, 0x2E,
+    0x91, 0xE9, 0x1A, 0xD2, 0xE2, 0xD2, 0xAC, 0xA1, 0x9D, 0x2A, 0xA3, 0x29, 0x92, 0xE9, 0x1E, 0x91,
+    0xAD, 0x91, 0xE2, 0xD9, 0x1A, 0xD2, 0xD2, 0xD7, 0x10, 0x19, 0x2E, 0x9A, 0xE0, 0xAD, 0x90, 0x9D,
+    0x91, 0xD9, 0x1A, 0xCA, 0x2D, 0x29, 0xCA, 0x40, 0x49, 0x70, 0x9D, 0x29, 0xCA, 0x2D, 0x29, 0xD2,
+    0xDA, 0x2D, 0x91, 0x9D, 0x2A, 0xD2, 0xE2, 0xDA, 0x2E, 0x19, 0xDA, 0x19, 0xE1, 0xAE, 0x2E, 0x19,
+    0xE7, 0x50, 0x29, 0x93, 0x93, 0xE9, 0x09, 0xE2, 0xE9, 0x1E, 0x91, 0xAD, 0x91, 0xE2, 0xE2, 0xDA,
+    0x2D, 0x91, 0x9D, 0x2A, 0xD2, 0xDA, 0x2D, 0x29, 0xD2, 0xD9, 0x2D, 0x77, 0x29, 0x93, 0x99, 0x2E,
+    0x90, 0x9E, 0x2E, 0x91, 0xE9, 0x1A, 0xD9, 0x1E, 0x2E, 0x2D, 0xA2, 0xD9, 0x19, 0xD2, 0xAD, 0x2D,
+    0xA2, 0xD2, 0x9D, 0x2D, 0x3D, 0x77, 0x19, 0x49, 0x2E, 0x90, 0x9E, 0x0A, 0xE1, 0xAD, 0xA0, 0xAD,
+    0x91, 0xE1, 0x9D, 0x91, 0xAD, 0x2D, 0x91, 0x9D, 0x2A, 0xCA, 0x2D, 0xA2, 0xD2, 0x9D, 0x29, 0xCA,
+    0x29, 0xCA, 0x72, 0x69, 0x97, 0x1E, 0x71, 0xDA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x29, 0x1F, 0xFE,
+    0x09, 0xFF, 0xE1, 0x99, 0x1A, 0xC2, 0x99, 0x5D, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9,
+    0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x60, 0x79, 0x97, 0x2E, 0x72, 0xDA,
+    0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x29, 0x2F, 0xFE, 0x19, 0xFF, 0xE2, 0x99, 0x1D, 0x91, 0x99, 0x6D,
+    0x72, 0x9D, 0x72, 0xE7, 0x2E, 0x72, 0xD9, 0x69, 0x2D, 0x29, 0x91, 0xFF, 0xEA, 0x1F, 0xFE, 0x91,
+    0x92, 0xAC, 0x92, 0x96, 0xD9, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0x99, 0x97, 0x79, 0xEA,
+    0x1F, 0xC0, 0x9F, 0xC0, 0x9F, 0xC1, 0xF9, 0x29, 0x92, 0x9C, 0x96, 0xF9, 0x4F, 0xD9, 0x2F, 0xF9,
+    0x0F, 0xFC, 0xAF, 0xFC, 0xAF, 0xEA, 0x1F, 0xCA, 0x3E, 0xA5, 0x9A, 0x70, 0x19, 0x92, 0xF1, 0xF1,
+    0xEA, 0x29, 0x91, 0x1A, 0xA4, 0x9A, 0x1E, 0x92, 0xAD, 0xA9, 0xE9, 0x2E, 0xA9, 0xDA, 0x3E, 0x19,
+    0x95, 0x91, 0x19, 0xA7, 0xA9, 0x69, 0xA9, 0x0E, 0xA5, 0xE5, 0x9E, 0x0E, 0x94, 0xAE, 0x5F, 0x0E,
+    0x59, 0xDA, 0x5E, 0x91, 0x97, 0x97, 0x09, 0x10, 0x09, 0xD9, 0x1F, 0x1F, 0x19, 0xD9, 0x00, 0x75,
+    0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90, 0x9A, 0x2A, 0xAD, 0x9A, 0xC2, 0xAA, 0xD9, 0xAA, 0x39, 0xC9,
+    0x0A, 0xA2, 0x9C, 0x91, 0xAA, 0x19, 0xC9, 0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x77, 0x10, 0x74, 0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xA2, 0xA9, 0x9D, 0xAA,
+    0x2C, 0xA0, 0x9C, 0x93, 0x9A, 0x19, 0xC9, 0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A,
+    0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79,
+    0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x10, 0x3A, 0x96, 0xAD, 0x94, 0x9C, 0xAA, 0xC9, 0x29,
+    0xC0, 0xAA, 0x0C, 0x91, 0xC1, 0xAA, 0x1C, 0x4A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0x50, 0x76, 0x9C, 0x90, 0xC9, 0x69, 0xC9, 0x0C, 0xA6,
+    0x9C, 0x90, 0xCA, 0x09, 0xAA, 0xAA, 0xAD, 0x90, 0xCA, 0xCA, 0xAA, 0xAA, 0xD9, 0x0C, 0x9C, 0x92,
+    0x9C, 0x90, 0xC9, 0x0C, 0x91, 0x9C, 0x1C, 0x91, 0xC9, 0x09, 0xC1, 0xC9, 0x2C, 0x97, 0x1C, 0x97,
+    0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97,
+    0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97,
+    0x75, 0x76, 0x9C, 0x09, 0xC9, 0x4A, 0xC0, 0x9C, 0x94, 0xAC, 0x09, 0xC9, 0x4A, 0xC0, 0x9D, 0xAA,
+    0xAA, 0xA9, 0x9C, 0x1D, 0xAA, 0xAA, 0xAC, 0x09, 0xC1, 0xC9, 0x29, 0xC1, 0x9C, 0x1C, 0x91, 0x9C,
+    0x29, 0xC1, 0xC9, 0x09, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19,
+    0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19,
+    0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x30, 0x77, 0x77, 0x77, 0x59, 0xA7, 0x72,
+    0x9F, 0x97, 0x0D, 0x97, 0x70, 0x9D, 0xAA, 0xD9, 0x6D, 0xA7, 0x70, 0x9D, 0x2A, 0xCA, 0x5A, 0xD7,
+    0x71, 0xD9, 0x29, 0xD4, 0x9D, 0x77, 0x19, 0xD4, 0xD4, 0xD9, 0x77, 0x1A, 0xC9, 0x39, 0xD3, 0xAC,
+    0xA7, 0x72, 0xD9, 0x39, 0xCA, 0x29, 0xD7, 0x73, 0xD4, 0xD9, 0x2D, 0x77, 0x4D, 0x92, 0x9D, 0x2D,
+    0x92, 0x9A, 0xCA, 0x7A, 0xAA, 0x91, 0xAC, 0xA2, 0xD9, 0x1A, 0xCA, 0x2F, 0xD4, 0xAF, 0xCA, 0x09,
+    0xDA, 0xAD, 0x91, 0x9D, 0x2D, 0xA1, 0xAC, 0xA2, 0xAD, 0x19, 0xD1, 0x9F, 0x92, 0xD2, 0xAC, 0xA2,
+    0x9D, 0x2D, 0x3D, 0x97, 0x0A, 0xC9, 0x2D, 0x4D, 0x1A, 0xCA, 0x3A, 0xCA, 0x7A, 0xCA, 0x2A, 0xCA,
+    0x4D, 0x1D, 0x4A, 0xC9, 0x69, 0xD3, 0xD9, 0x39, 0xD0, 0x9D, 0x4D, 0x96, 0xD9, 0x3D, 0x93, 0xAC,
+    0xA0, 0x9D, 0x4D, 0x6A, 0xCA, 0x4D, 0x93, 0xD1, 0x9D, 0x3A, 0xCA, 0x5A, 0xD5, 0xAC, 0xA2, 0xAC,
+    0xA1, 0x9D, 0x3D, 0x59, 0xD6, 0x9D, 0x99, 0xAD, 0x3D, 0xA9, 0xAD, 0x95, 0xDA, 0x7A, 0xFA, 0x49,
+    0xFC, 0x96, 0xD7, 0x29, 0x97, 0x09, 0x99, 0x77, 0x77, 0x70, 0x70, 0xCA, 0x29, 0xDA, 0x1A, 0xD9,
+    0x1E, 0x1A, 0xD9, 0x1D, 0xA1, 0x9D, 0x2D, 0x93, 0x93, 0x76, 0xCA, 0x3C, 0x92, 0x9D, 0xA1, 0xAD,
+    0x2A, 0xD9, 0x1E, 0x2E, 0x1A, 0xDA, 0x1A, 0xD9, 0x1E, 0x2D, 0xA1, 0x9D, 0x91, 0x9D, 0x2D, 0xA2,
+    0xD9, 0x2D, 0x49, 0x39, 0x40, 0x77, 0x3C, 0xA3, 0xC9, 0x2A, 0xC2, 0x9D, 0xA1, 0xAD, 0x2E, 0x1A,
+    0xD9, 0x1E, 0x19, 0xDA, 0x1E, 0x1A, 0xDA, 0x1E, 0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1D, 0xA1, 0x9D,
+    0x91, 0xAD, 0x19, 0xD2, 0xDA, 0x2D, 0x91, 0xD9, 0x2D, 0x29, 0xCA, 0x39, 0x39, 0x4A, 0x30, 0x59,
+    0xC9, 0x2E, 0x2E, 0x91, 0x9E, 0x2E, 0x3D, 0xA2, 0x9D, 0x3A, 0xC9, 0x3A, 0x00, 0x73, 0x9C, 0x93,
+    0xAC, 0x2E, 0x2A, 0xD2, 0xE9, 0x19, 0xDA, 0x19, 0xE2, 0xE2, 0xE2, 0x9D, 0xA2, 0xDA, 0x2E, 0x29,
+    0xD3, 0xD9, 0x2A, 0xC9, 0x29, 0xCA, 0x3A, 0x49, 0x00, 0x77, 0x29, 0xC9, 0x3A, 0xC3, 0xAC, 0x3E,
+    0x2A, 0xD2, 0x9D, 0xA2, 0xE9, 0x19, 0xDA, 0x2E, 0x29, 0xE2, 0xE2, 0xAD, 0x92, 0xE2, 0x9D, 0xA2,
+    0xE3, 0xDA, 0x2E, 0x29, 0xD9, 0x29, 0xD3, 0xD9, 0x2D, 0xA3, 0xAC, 0x92, 0x9C, 0xA3, 0xD4, 0xA4,
+    0x94, 0x99, 0x00, 0x49, 0xA7, 0x19, 0xDA, 0x79, 0xDA, 0xCA, 0x59, 0xD1, 0xAC, 0xA3, 0x9D, 0x3A,
+    0xCA, 0x2D, 0x94, 0xAC, 0xA0, 0x49, 0xA4, 0xAD, 0x3E, 0x3E, 0x29, 0xE3, 0xE9, 0x3E, 0x94, 0xE5,
+    0xDA, 0x5D, 0x6A, 0x91, 0x2A, 0x7D, 0x69, 0xD6, 0xE5, 0x9E, 0x5E, 0x4E, 0x93, 0xE9, 0x3A, 0xD4,
+    0xAD, 0x5A, 0x95, 0x09, 0x75, 0x90, 0x9C, 0x97, 0x39, 0xCA, 0x0A, 0xC9, 0x3D, 0x39, 0xCA, 0x2A,
+    0xC9, 0x19, 0xD9, 0x2C, 0xA4, 0xAC, 0x2A, 0xA2, 0xCA, 0x6A, 0xC5, 0xD7, 0x0D, 0x3D, 0x72, 0xD1,
+    0xD7, 0xAA, 0x2F, 0x2A, 0xA2, 0x9D, 0xA2, 0xD2, 0x9D, 0x92, 0xD9, 0x1A, 0xDA, 0x2D, 0x7A, 0xC9,
+    0x9C, 0xA7, 0x2A, 0xC9, 0x19, 0xCA, 0x70, 0x9C, 0x93, 0x9C, 0x96, 0x9C, 0xA1, 0x99, 0x19, 0xC9,
+    0x49, 0xCA, 0x19, 0xD9, 0x1A, 0xC9, 0x3C, 0xA2, 0x9D, 0x92, 0xAC, 0x91, 0xCA, 0x49, 0x94, 0xAC,
+    0x09, 0xC7, 0x5A, 0x97, 0x71, 0x59, 0x95, 0x99, 0x4D, 0xA4, 0xDA, 0x3A, 0xD9, 0x3A, 0xD9, 0x3E,
+    0x4E, 0x4D, 0xA3, 0x9D, 0xA3, 0x9D, 0x93, 0xAD, 0x4A, 0xD4, 0xAD, 0x4D, 0xA4, 0xDA, 0x4D, 0x94,
+    0xD9, 0x4D, 0x5D, 0x49, 0xD4, 0x9D, 0x49, 0xCA, 0x4A, 0xCA, 0x4A, 0xC9, 0x4A, 0xC9, 0x4A, 0xC5,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xCA, 0x5A, 0x6A, 0x77, 0x77, 0x5A, 0xD4, 0xAD, 0x4E, 0x93, 0xE4, 0xE3,
+    0x9D, 0xA4, 0x99, 0x59, 0x94, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9A, 0xAA, 0xAA, 0x0F, 0xD9, 0xAF, 0xC9, 0x77, 0x77,
+    0x1C, 0x77, 0xDA, 0x75, 0xAD, 0x75, 0x9D, 0x76, 0xD9, 0x75, 0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0x76,
+    0xAC, 0x97, 0x59, 0xCA, 0x76, 0xD7, 0x6D, 0x76, 0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0x76, 0xD9, 0x75,
+    0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0x97, 0x5D, 0xA7, 0x5A, 0xD7, 0x6A, 0xC7, 0x77, 0x70, 0x2A, 0xAA,
+    0x96, 0x9A, 0xAA, 0x4F, 0xD4, 0xAF, 0xCA, 0x1A, 0xFE, 0x3F, 0xE9, 0x09, 0xA9, 0x1A, 0xD9, 0x2C,
+    0xA1, 0x9E, 0x6D, 0x97, 0x9D, 0x6D, 0x97, 0x9D, 0x6D, 0x70, 0xAC, 0xA5, 0xD9, 0x79, 0xD5, 0xDA,
+    0x79, 0xD5, 0xDA, 0x7A, 0xD9, 0x39, 0xDA, 0x7A, 0xD5, 0xDA, 0x7A, 0xD5, 0xAC, 0xA7, 0x0D, 0x6E,
+    0xAA, 0x59, 0xDA, 0xA9, 0x3A, 0xEA, 0x6F, 0x5A, 0xA9, 0x79, 0xAA, 0x77, 0x77, 0x77, 0xE7, 0x9D,
+    0x94, 0x9E, 0x7E, 0xA4, 0x9D, 0xA7, 0xE6, 0x99, 0x71, 0x96, 0x77, 0x99, 0x3A, 0xAA, 0x97, 0xAD,
+    0x2F, 0xD6, 0xE1, 0xAF, 0xE4, 0xAD, 0x91, 0x9A, 0x91, 0xAD, 0x93, 0xE7, 0x0D, 0x93, 0xE7, 0x0D,
+    0x93, 0xD9, 0x70, 0xD3, 0x9D, 0x70, 0xD9, 0x3A, 0xD7, 0xDA, 0x4A, 0xCA, 0x6D, 0xA5, 0xD9, 0x49,
+    0xDA, 0x6D, 0x5D, 0xA7, 0xD4, 0xAC, 0xA7, 0x0C, 0xA4, 0xEA, 0xA5, 0x9C, 0x94, 0xAE, 0xA5, 0x9C,
+    0x95, 0xAA, 0x96, 0x99, 0x77, 0x77, 0x73, 0xE7, 0xDA, 0x39, 0xE6, 0xAD, 0xA3, 0x9D, 0xA6, 0xAD,
+    0x94, 0x99, 0x70, 0x95, 0x59, 0x97, 0x70, 0xDA, 0x4A, 0xAA, 0x96, 0xAD, 0x92, 0x9F, 0xD5, 0xE3,
+    0xAF, 0xDA, 0x4D, 0xA3, 0xAA, 0x91, 0xAD, 0x39, 0xD9, 0x71, 0xD3, 0xAD, 0x72, 0xD3, 0xDA, 0x71,
+    0x9D, 0x3D, 0x97, 0x09, 0xD9, 0x3D, 0x70, 0x9D, 0x93, 0x9D, 0x79, 0xD9, 0x49, 0xCA, 0x69, 0xD9,
+    0x5A, 0xC9, 0x59, 0xD9, 0x6A, 0xC6, 0xD9, 0x7D, 0x6D, 0xAA, 0x95, 0xD6, 0xF9, 0x5A, 0x70, 0xAA,
+    0x97, 0x77, 0x77, 0x5A, 0xD6, 0xDA, 0x6E, 0x94, 0xAE, 0x6E, 0x5A, 0xD9, 0x69, 0x97, 0x97, 0x39,
+    0x99, 0x73, 0xAF, 0xCA, 0x4D, 0x1A, 0xDA, 0xAF, 0xA9, 0x9D, 0xA1, 0xD3, 0x9A, 0xFC, 0xA2, 0x97,
+    0x9A, 0x93, 0x77, 0x71, 0xCA, 0x3C, 0x92, 0xAC, 0x3C, 0xA2, 0x9D, 0xA1, 0xAD, 0x2E, 0x19, 0xD9,
+    0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1E, 0x91, 0xE1, 0xAD, 0xA1, 0xE2, 0xE1, 0xAD, 0x91, 0xE1, 0x9D,
+    0xA1, 0xAD, 0x91, 0xDA, 0x19, 0xD9, 0x1A, 0xD2, 0xDA, 0x19, 0xD2, 0xDA, 0x2D, 0x91, 0xAD, 0x2D,
+    0x92, 0xD2, 0x9C, 0xA2, 0xD9, 0x39, 0x39, 0x4A, 0x49, 0x30, 0x4A, 0xDA, 0x4A, 0xFD, 0x2A, 0xD9,
+    0x0A, 0xD9, 0x1D, 0x92, 0xDA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0x93, 0xDA, 0x9D, 0x4D, 0x9A, 0xCA,
+    0x4D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0xD9, 0x0A, 0xD2, 0xAD, 0x19, 0xDA, 0x9A, 0xD3, 0xAF,
+    0xC5, 0x9A, 0x99, 0x40, 0x70, 0xAA, 0x70, 0xE7, 0xF6, 0xDA, 0xCA, 0x5D, 0x0A, 0xC9, 0x4D, 0x1D,
+    0x4D, 0x91, 0xD3, 0xD9, 0x19, 0xD2, 0xEA, 0xAA, 0xEA, 0x90, 0xFF, 0xD9, 0x6D, 0x71, 0xD7, 0x09,
+    0xCA, 0x76, 0x39, 0xAA, 0xAA, 0xA9, 0x3F, 0xDA, 0x29, 0xDA, 0xAA, 0xA3, 0xAC, 0x97, 0xD9, 0x69,
+    0xFA, 0x69, 0xAD, 0xA7, 0x9D, 0x70, 0xD7, 0x9D, 0x69, 0xD9, 0x29, 0x9A, 0xEA, 0x2A, 0xFC, 0x94,
+    0x99, 0x96, 0x69, 0xAC, 0xA5, 0x9F, 0xA9, 0x3E, 0xA6, 0xE7, 0xAD, 0x70, 0xFC, 0xA4, 0xAD, 0xAA,
+    0xE9, 0x2D, 0x92, 0xAD, 0x2D, 0x39, 0xD2, 0xD3, 0x9D, 0x2D, 0x92, 0xD9, 0x2A, 0xD9, 0x9E, 0x4A,
+    0xFA, 0x69, 0x99, 0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0x9F, 0xF9, 0xAC, 0xA9, 0x99, 0xAD, 0x0D,
+    0x3D, 0x19, 0x92, 0xD9, 0x5A, 0xCA, 0x59, 0xD6, 0xD9, 0x5A, 0xCA, 0x59, 0xD6, 0xDA, 0x59, 0xD6,
+    0x9C, 0xA7, 0x97, 0x4A, 0xDA, 0x49, 0xDA, 0xE2, 0x9D, 0x2D, 0x91, 0xAC, 0x92, 0xD9, 0x1A, 0xCA,
+    0x19, 0xD3, 0xDA, 0xAD, 0x4A, 0xF4, 0xD9, 0x9D, 0xA2, 0xD9, 0x19, 0xD1, 0x9D, 0x3D, 0x90, 0x9D,
+    0x3D, 0x2D, 0xA0, 0x9D, 0xA2, 0xAF, 0xCA, 0x59, 0x99, 0x40, 0x49, 0xDA, 0x95, 0xFD, 0xA3, 0xDA,
+    0x19, 0xD2, 0x9D, 0x3D, 0x91, 0x9C, 0xA3, 0xAC, 0x91, 0xAD, 0x3D, 0x91, 0x9D, 0x91, 0x9D, 0x3A,
+    0xFE, 0x59, 0xA9, 0xD9, 0x7D, 0xA6, 0x9E, 0x59, 0xEA, 0x4F, 0xC9, 0x69, 0x97, 0x72, 0x9E, 0x90,
+    0xAD, 0xA1, 0x9D, 0x9F, 0xA2, 0xDA, 0xA0, 0x9C, 0xA2, 0xE1, 0xAC, 0x91, 0x9D, 0x2D, 0x2A, 0xCA,
+    0x2D, 0x2D, 0x91, 0x9C, 0xA2, 0xD2, 0xAC, 0xAC, 0x90, 0xD2, 0xEA, 0x19, 0x39, 0xA9, 0x10, 0x76,
+    0xAF, 0x93, 0xEA, 0xE2, 0xDA, 0x2D, 0x90, 0x9D, 0x3D, 0xA0, 0xD9, 0x3A, 0xCA, 0x0D, 0x4D, 0xA9,
+    0xD4, 0xD9, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x3A, 0xD0, 0xAC, 0xA3, 0xD9, 0x09, 0xD2, 0xDA, 0x2F,
+    0xDA, 0x39, 0xF9, 0x76, 0x73, 0xAD, 0xA1, 0xFC, 0x91, 0x99, 0xAD, 0x49, 0xD4, 0xAC, 0xA4, 0xD9,
+    0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x92, 0xAF, 0xC0, 0x9F, 0xCA, 0x00, 0x76, 0xAF, 0x92,
+    0x9E, 0xAE, 0x2D, 0xA2, 0xD9, 0x1C, 0xA3, 0xD9, 0x69, 0xD7, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x5A,
+    0xD6, 0xDA, 0x6D, 0xA6, 0xFF, 0xC9, 0x09, 0xFE, 0xA1, 0x75, 0xFC, 0x29, 0xDA, 0xAD, 0xA1, 0xAC,
+    0x2A, 0xCA, 0x6A, 0xCA, 0x59, 0xD4, 0x9E, 0x4F, 0xC9, 0x39, 0x1A, 0xD6, 0x9D, 0x6A, 0xD5, 0xAD,
+    0x90, 0x9A, 0xAF, 0x91, 0x9F, 0xA7, 0x50, 0x77, 0x39, 0xD7, 0xAE, 0x69, 0xEA, 0x59, 0xCA, 0xAC,
+    0xA4, 0x9C, 0xA0, 0xD9, 0x39, 0xD1, 0xD3, 0x9D, 0x2D, 0x29, 0xD2, 0x9C, 0xA2, 0xFF, 0xD9, 0x0A,
+    0xFF, 0xC7, 0xD7, 0x09, 0xD7, 0x09, 0xC9, 0x20, 0x3F, 0xDA, 0x3F, 0xD9, 0x2A, 0xCA, 0x7D, 0x70,
+    0xEA, 0x6A, 0xF9, 0x7E, 0x70, 0xD7, 0x0D, 0x7A, 0xD6, 0xAD, 0x29, 0xAF, 0xC3, 0x9F, 0x97, 0x70,
+    0x77, 0x19, 0xF9, 0x4E, 0xA9, 0x49, 0xDA, 0x7D, 0x97, 0xDA, 0x99, 0x59, 0xFD, 0xA3, 0xAC, 0xA9,
+    0x99, 0xDA, 0x2D, 0x39, 0xD2, 0xD3, 0x9D, 0x2D, 0x3A, 0xCA, 0x2D, 0xA2, 0xD9, 0x29, 0xFD, 0xA4,
+    0x9F, 0x97, 0x70, 0x0F, 0xF9, 0x9F, 0xF9, 0xAC, 0x3A, 0xCA, 0x0C, 0xA2, 0x9D, 0x6D, 0x6D, 0x95,
+    0xAC, 0xA5, 0x9D, 0x6D, 0x95, 0xAD, 0x6D, 0x95, 0x9D, 0x69, 0xC9, 0x77, 0x00, 0x76, 0xAF, 0x93,
+    0xDA, 0x9A, 0xD2, 0xAC, 0xA2, 0xD9, 0x1A, 0xC9, 0x2D, 0x29, 0xD1, 0xAC, 0xA3, 0xAF, 0x94, 0xFC,
+    0x39, 0xD1, 0xE2, 0xD3, 0xD9, 0x09, 0xCA, 0x3D, 0x90, 0x9D, 0x29, 0xD2, 0xEA, 0xAD, 0x93, 0xAE,
+    0xA7, 0x60, 0x69, 0x79, 0xFC, 0x49, 0xDA, 0xAE, 0x3D, 0x92, 0xD2, 0x9D, 0x3D, 0x91, 0xAC, 0xA3,
+    0xD9, 0x19, 0xD3, 0xD9, 0x2E, 0xA9, 0xAD, 0x4F, 0xDA, 0x79, 0xD7, 0x9D, 0x96, 0xAD, 0x93, 0x9A,
+    0xF9, 0x4A, 0xE9, 0x77, 0x10, 0x4F, 0xFF, 0x93, 0x9F, 0xFF, 0x95, 0x9D, 0xA9, 0x99, 0x99, 0xD9,
+    0x59, 0xD9, 0x4D, 0x6A, 0xD5, 0xD6, 0xE5, 0x97, 0xDA, 0x76, 0xDA, 0x75, 0x9D, 0xA9, 0x99, 0x9A,
+    0x97, 0xAF, 0xFA, 0x7E, 0xAA, 0xAA, 0xAA, 0x70, 0xDA, 0x75, 0x9D, 0x97, 0x39, 0x9A, 0xDA, 0x99,
+    0x97, 0x0F, 0xF9, 0x72, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x73, 0x9F, 0xDA, 0x70, 0x9F, 0xF7, 0x00,
+    0x77, 0x75, 0x9A, 0xF7, 0x3A, 0xFE, 0x71, 0xAD, 0x91, 0xAD, 0x97, 0x9D, 0x4D, 0x97, 0xDA, 0x4D,
+    0x79, 0xD5, 0x97, 0x0E, 0x77, 0xDA, 0x74, 0xAA, 0xAD, 0xAA, 0xAA, 0xAA, 0x7F, 0xFE, 0x71, 0xE7,
+    0x49, 0x99, 0xDA, 0x09, 0x99, 0x97, 0xFF, 0xE7, 0x99, 0xE9, 0x99, 0x99, 0x97, 0x1D, 0xA7, 0x69,
+    0xD9, 0x76, 0xAD, 0x74, 0xAA, 0xAD, 0xA9, 0x99, 0x99, 0x9A, 0xAC, 0x92, 0xFF, 0xFE, 0x3E, 0xA9,
+    0x9A, 0xAF, 0xDA, 0x3A, 0xA9, 0x76, 0x77, 0x77, 0x7A, 0xFE, 0xA9, 0x77, 0x7F, 0xFF, 0x77, 0x69,
+    0x0A, 0xD3, 0xAD, 0xA7, 0x77, 0xE4, 0xE7, 0x77, 0xE4, 0xAD, 0x77, 0x7D, 0xA4, 0xAD, 0x3D, 0x77,
+    0x09, 0xD9, 0x4A, 0xD2, 0x9C, 0xA7, 0x70, 0xAD, 0x5D, 0xA2, 0xAC, 0x97, 0x99, 0x95, 0xE4, 0xAD,
+    0x1A, 0xFE, 0x2A, 0xFA, 0x4D, 0xA2, 0x9E, 0x90, 0xAF, 0xE9, 0x1A, 0xCA, 0x9A, 0xCA, 0x4E, 0xAF,
+    0xC4, 0x9D, 0x5D, 0x70, 0x9F, 0xDA, 0x95, 0xAC, 0xA4, 0x9D, 0x70, 0xAD, 0x97, 0x2D, 0x95, 0xE7,
+    0xE7, 0x3D, 0x69, 0xE9, 0x5D, 0xA7, 0x29, 0xD7, 0x0E, 0x93, 0x9D, 0x97, 0x29, 0xD7, 0x1E, 0x3A,
+    0xD7, 0x3A, 0xCA, 0x2A, 0x09, 0x39, 0xD3, 0xAD, 0x73, 0xDA, 0x09, 0xD0, 0xD2, 0x9C, 0xA1, 0xAF,
+    0xD9, 0x70, 0xFD, 0x1E, 0xAA, 0xD1, 0xAF, 0xEA, 0x70, 0x9E, 0xA2, 0x9F, 0xA7, 0x77, 0x75, 0x77,
+    0x76, 0x9A, 0xFC, 0xA7, 0x19, 0xFF, 0xCA, 0x7F, 0x99, 0x19, 0xD9, 0x6E, 0x95, 0xD6, 0xE7, 0xCA,
+    0x59, 0xD9, 0x79, 0x6D, 0xA7, 0x79, 0xD9, 0x99, 0x99, 0x99, 0x96, 0xAF, 0xFE, 0x79, 0x9E, 0x99,
+    0x99, 0x99, 0x97, 0x1D, 0xA7, 0x5A, 0xFF, 0xE7, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0x72, 0xDA, 0x77,
+    0x0E, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x09, 0x6A, 0xEA, 0x92, 0x9A, 0xCA, 0x7F, 0xFE, 0x71, 0x9F,
+    0xEA, 0x76, 0x97, 0x49, 0x76, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xAC, 0xA7, 0x4A, 0xFF, 0xFE,
+    0xAA, 0xFF, 0xFE, 0xA0, 0xAC, 0xA7, 0x6A, 0xCA, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x69, 0x72, 0x77,
+    0x1A, 0xCA, 0x70, 0xAE, 0xA6, 0xAF, 0xCA, 0x4A, 0xCA, 0x9C, 0x9A, 0xCA, 0x2A, 0xCA, 0x09, 0xC9,
+    0x0D, 0xA1, 0x9C, 0x19, 0xC9, 0x1C, 0x95, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9,
+    0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x77, 0x10, 0x72, 0x97, 0x69, 0xD7, 0x6A, 0xD7, 0x6A, 0xD7, 0x6A, 0xCA,
+    0x0A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA7, 0x4A, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x74, 0x9D,
+    0x76, 0x94, 0x77, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C,
+    0x95, 0xAC, 0x19, 0xC9, 0x1C, 0x91, 0xAD, 0x09, 0xC9, 0x0D, 0xA2, 0xAD, 0x9C, 0x9D, 0xA4, 0xAF,
+    0xCA, 0x6A, 0xEA, 0x70, 0xAC, 0xA7, 0x71, 0x77, 0x6D, 0x4D, 0x7D, 0x94, 0x9D, 0x5D, 0x96, 0x9D,
+    0x3D, 0x97, 0x09, 0xD1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC1, 0xD9, 0x70, 0x9D, 0x3D, 0x96, 0x9D,
+    0x5D, 0x94, 0xAD, 0x7D, 0x4D, 0x77, 0x50, 0x59, 0x72, 0xE7, 0x0F, 0xC6, 0xFE, 0x4D, 0x99, 0xC9,
+    0x9D, 0x2D, 0xA0, 0x9C, 0x90, 0xAD, 0x2A, 0x19, 0xC9, 0x1A, 0x69, 0xC9, 0x71, 0x9C, 0x97, 0x19,
+    0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x95, 0x9A, 0x19, 0xC9, 0x1A, 0x91, 0xDA, 0x09,
+    0xC9, 0x0A, 0xD2, 0xDA, 0x9C, 0x9A, 0xD4, 0xFE, 0x6F, 0xC7, 0x0E, 0x72, 0x95, 0x59, 0x72, 0xAC,
+    0xA7, 0x0F, 0xC6, 0xFE, 0x4D, 0xA9, 0xC9, 0xAD, 0x2D, 0xA0, 0x9C, 0x90, 0xAD, 0x19, 0xA1, 0x9C,
+    0x91, 0xA9, 0x59, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x95, 0x9A, 0x19, 0xC9, 0x1A,
+    0x91, 0xDA, 0x09, 0xC9, 0x0A, 0xD2, 0xDA, 0x9C, 0x9A, 0xD4, 0xAF, 0xCA, 0x6A, 0xEA, 0x70, 0xAC,
+    0xA4, 0x9F, 0xFE, 0x99, 0xFF, 0xE9, 0x74, 0x77, 0x59, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x2D, 0x72,
+    0xD7, 0x2D, 0x72, 0xD5, 0xC9, 0x2D, 0x4D, 0xA2, 0xD3, 0xAC, 0xA3, 0xD2, 0xAC, 0xA4, 0xD1, 0xAD,
+    0x99, 0x99, 0x99, 0xD1, 0xFF, 0xE1, 0xAD, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0x97, 0x72, 0x75, 0xD9, 0x71, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72,
+    0xD2, 0xAC, 0x5D, 0x2D, 0xA4, 0xD3, 0xAC, 0xA3, 0xD4, 0xAC, 0xA2, 0xD9, 0x99, 0x99, 0x9D, 0xA1,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x71, 0x9A, 0x77,
+    0x10, 0x75, 0xAA, 0x75, 0x9D, 0x59, 0x69, 0xD4, 0x9D, 0x59, 0xD3, 0x9D, 0x95, 0x9D, 0x3D, 0x97,
+    0xD2, 0xD9, 0x70, 0xD1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2D, 0xA7, 0x6D,
+    0xA7, 0x6D, 0xA7, 0x6D, 0x77, 0x72, 0x77, 0x5C, 0xA7, 0x5D, 0xA7, 0x4D, 0xA7, 0x4A, 0xFF, 0xFC,
+    0xA0, 0xAF, 0xFF, 0xDA, 0xAC, 0xA7, 0x5A, 0xCA, 0x76, 0xAF, 0xFF, 0xDA, 0x1A, 0xFF, 0xFC, 0xA2,
+    0xAC, 0xA7, 0x6A, 0xCA, 0x76, 0xC9, 0x77, 0x72, 0x59, 0x72, 0xAC, 0xA7, 0x0A, 0xEA, 0x6A, 0xCA,
+    0x0A, 0xCA, 0x4E, 0xA0, 0xAE, 0x2F, 0xA0, 0xAF, 0x09, 0xCA, 0x9C, 0xA0, 0xAC, 0x9A, 0xC9, 0x09,
+    0x09, 0xCA, 0x0A, 0xC9, 0x09, 0x39, 0xCA, 0x0A, 0xC9, 0x59, 0xCA, 0x0A, 0xC9, 0x5A, 0xCA, 0x0A,
+    0xC9, 0x5A, 0xCA, 0x0A, 0xC9, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A,
+    0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x77, 0x77, 0x72, 0xAC, 0x76, 0xAD, 0x76,
+    0xAC, 0xA2, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFD, 0xA7, 0x6A, 0xCA, 0x75, 0xAC, 0xAA, 0xFF, 0xFD,
+    0xA0, 0xAF, 0xFF, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x75, 0x9C, 0x77, 0x50, 0x39, 0x29, 0x6A,
+    0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A,
+    0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xC9, 0x59, 0xCA, 0x0A, 0xC9, 0x59, 0xCA, 0x0A, 0xC9, 0x59,
+    0xCA, 0x0A, 0xC9, 0x39, 0x09, 0xCA, 0x0A, 0xC9, 0x09, 0x09, 0xCA, 0x9C, 0xA0, 0xAC, 0x9A, 0xC9,
+    0x0A, 0xEA, 0x0A, 0xEA, 0x2A, 0xDA, 0x0A, 0xDA, 0x4A, 0xCA, 0x0A, 0xCA, 0x6A, 0xEA, 0x70, 0xAC,
+    0xA7, 0x71, 0x77, 0x79, 0xC4, 0xC9, 0x70, 0x9D, 0x92, 0x9D, 0x96, 0x9D, 0x6D, 0x95, 0xFF, 0xFC,
+    0x4F, 0xFF, 0xE2, 0xD7, 0x4D, 0x1D, 0x97, 0x29, 0xD2, 0xFF, 0xFE, 0x4F, 0xFF, 0xC6, 0xD5, 0x9D,
+    0x70, 0xD9, 0x29, 0xD7, 0x19, 0xC4, 0xC9, 0x77, 0x70, 0x77, 0x2A, 0xDA, 0x73, 0xDA, 0x9E, 0x72,
+    0xAD, 0x90, 0xE9, 0x71, 0xE1, 0xAD, 0xA7, 0x09, 0xD9, 0x2E, 0x70, 0xAD, 0x3A, 0xD9, 0x7D, 0xA3,
+    0x9E, 0xAA, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0xC5, 0xAE, 0x99, 0x99, 0x9A, 0xD9, 0x6E, 0x4A, 0xD7,
+    0xE9, 0x3D, 0xA7, 0x9D, 0xA2, 0x9D, 0x71, 0xE2, 0xDA, 0x71, 0xAD, 0x91, 0xD9, 0x72, 0xE0, 0xAD,
+    0x73, 0xE0, 0xD9, 0x73, 0x9F, 0xC7, 0x5F, 0xA7, 0x5A, 0xE7, 0x69, 0xD9, 0x77, 0x97, 0x10, 0x69,
+    0x97, 0x0A, 0xFD, 0x5E, 0xAA, 0xF4, 0xC9, 0x39, 0xDA, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA7,
+    0x2D, 0xA5, 0xAD, 0xA9, 0xE3, 0xAF, 0xFC, 0x2E, 0x91, 0x9F, 0x1A, 0xD5, 0xDA, 0x09, 0xD9, 0x5D,
+    0xA0, 0xE6, 0xD9, 0x0D, 0x95, 0x9D, 0x09, 0xD6, 0xAD, 0x0A, 0xD6, 0xDA, 0x0A, 0xD5, 0x9D, 0x1A,
+    0xD5, 0xDA, 0x1A, 0xD9, 0x39, 0xD2, 0x9E, 0x29, 0xD9, 0x3F, 0xF9, 0x5A, 0xFA, 0x77, 0x30, 0x74,
+    0xAF, 0xFE, 0xAA, 0xFF, 0xF0, 0x99, 0x95, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x09,
+    0x99, 0x99, 0x29, 0xE9, 0xFF, 0xF9, 0xFF, 0xF7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE9, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFF, 0xFF, 0xF9, 0x77, 0x77, 0x09, 0x99, 0x95, 0xC9, 0x7A,
+    0xFF, 0x91, 0xE5, 0x9F, 0xFE, 0xAE, 0x5A, 0xEA, 0x93, 0x9F, 0xC5, 0x9E, 0x70, 0xEA, 0x5E, 0x70,
+    0xAF, 0x93, 0x9D, 0xA7, 0xAD, 0x9D, 0xA3, 0xE7, 0xAD, 0x1E, 0x3D, 0xA6, 0xAD, 0x91, 0xAD, 0x29,
+    0xDA, 0x59, 0xD9, 0x29, 0xD9, 0x19, 0xD9, 0x49, 0xD9, 0x39, 0xD9, 0x19, 0xD9, 0x39, 0xD9, 0x49,
+    0xD9, 0x19, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x19, 0xDA, 0x19, 0xD9, 0x6A, 0xD3, 0xE1, 0xDA, 0x7E,
+    0x3A, 0xD9, 0xDA, 0x7A, 0xD9, 0x39, 0xFA, 0x70, 0xE5, 0xAE, 0x79, 0xE9, 0x5F, 0xC9, 0x39, 0xAE,
+    0xA5, 0xDA, 0xAF, 0xFE, 0x95, 0xE1, 0x9F, 0xFA, 0x79, 0xC5, 0x99, 0x99, 0x77, 0x77, 0x00, 0x71,
+    0x97, 0x79, 0xDA, 0x76, 0xF7, 0x59, 0xF7, 0x5F, 0xCA, 0x74, 0xD0, 0xE7, 0x3A, 0xCA, 0x0A, 0xD9,
+    0x72, 0xD9, 0x09, 0xDA, 0x71, 0x9D, 0x2E, 0x71, 0xDA, 0x2A, 0xD9, 0x79, 0xD3, 0x9E, 0x7A, 0xD4,
+    0xE7, 0xD9, 0x4A, 0xDA, 0x5A, 0xD6, 0xE5, 0xDA, 0x6E, 0x49, 0xD7, 0xAD, 0xA3, 0xE7, 0x0E, 0x3D,
+    0x97, 0x0E, 0x91, 0xAD, 0x97, 0x0A, 0xDA, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x00, 0x77, 0x3F,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1E, 0x97, 0x1E, 0x1A, 0xDA, 0x70, 0x9D, 0x92, 0xE7, 0x0A, 0xD3,
+    0xE9, 0x7D, 0xA3, 0x9E, 0x69, 0xD5, 0xE6, 0xE5, 0xAD, 0xA5, 0xD9, 0x6E, 0x4A, 0xD7, 0xE9, 0x3D,
+    0xA7, 0x9D, 0xA2, 0x9D, 0x71, 0xE2, 0xAC, 0xA7, 0x1A, 0xD9, 0x1D, 0x97, 0x2E, 0x0A, 0xD7, 0x3E,
+    0x0D, 0x97, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0xAE, 0x76, 0x9D, 0x97, 0x79, 0x71, 0x77, 0x70, 0x9A,
+    0xFF, 0xDA, 0x39, 0xFF, 0xFC, 0xA2, 0xAE, 0xA9, 0x97, 0x29, 0xE7, 0x6E, 0x76, 0xAD, 0x77, 0xE7,
+    0x69, 0xD9, 0x76, 0x9D, 0x97, 0x6A, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xD9, 0x76, 0x9D,
+    0xA7, 0x7E, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x9E, 0x97, 0x69, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x94,
+    0x9F, 0xFF, 0xCA, 0x59, 0xAF, 0xFD, 0xA0, 0x77, 0x77, 0x0D, 0x77, 0xAD, 0x70, 0x9A, 0xFF, 0xDA,
+    0x39, 0xFF, 0xFC, 0xA2, 0xAE, 0xA9, 0x91, 0xAD, 0x59, 0xE5, 0xDA, 0x5E, 0x6D, 0x5A, 0xD6, 0x9D,
+    0x5E, 0x6D, 0xA4, 0x9D, 0x96, 0xD5, 0x9D, 0x95, 0xAD, 0x5A, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC,
+    0x99, 0xD9, 0x49, 0xD6, 0x9D, 0xA4, 0xDA, 0x7E, 0x4D, 0x97, 0xAD, 0x92, 0x9D, 0x71, 0xE2, 0xAC,
+    0xA7, 0x19, 0xE9, 0x0D, 0x97, 0x29, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x49, 0xFF, 0xFC, 0xA5, 0x9F,
+    0xFE, 0xA5, 0x9D, 0x77, 0xAC, 0xA7, 0x79, 0x97, 0x20, 0x49, 0xAF, 0xFE, 0x92, 0x9F, 0xFF, 0xDA,
+    0x1A, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xE9, 0x75, 0xE7, 0x7D, 0xA7, 0x69, 0xDA, 0x29,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xA0, 0x9D, 0x97, 0x7E, 0x77,
+    0xAD, 0x97, 0x7E, 0xA7, 0x69, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xAF, 0xFF, 0xCA, 0x59,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x2A, 0xFF, 0xDA, 0x95, 0xAF, 0xFF, 0xC9, 0x74, 0x99,
+    0xAE, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x77, 0x9D, 0x97, 0x69, 0xD9, 0x9F, 0xFF,
+    0xFC, 0xA9, 0xFF, 0xFF, 0xC9, 0x76, 0x9D, 0x97, 0x6A, 0xD9, 0x76, 0xE7, 0x69, 0xDA, 0x76, 0xE7,
+    0x59, 0xE9, 0x29, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x92, 0xAF, 0xFF, 0xC4, 0xAF, 0xFD, 0xA9, 0x50,
+    0x77, 0x5D, 0x77, 0x0D, 0xA7, 0x4A, 0xFF, 0xDA, 0x95, 0xAF, 0xFF, 0xC9, 0x7D, 0xA1, 0x99, 0xAE,
+    0xA6, 0xAD, 0x5E, 0x96, 0xD6, 0xE6, 0xD9, 0x59, 0xDA, 0x5A, 0xD6, 0xE6, 0xD6, 0x9D, 0x95, 0xDA,
+    0x59, 0xD9, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x6D, 0x94, 0x9D, 0x96, 0xAD, 0x4A, 0xD9,
+    0x69, 0xD4, 0xE7, 0x0D, 0x92, 0x9D, 0xA7, 0x0A, 0xCA, 0x2E, 0x71, 0x9D, 0x09, 0xE9, 0x29, 0x99,
+    0x99, 0x99, 0x9F, 0xD9, 0x2A, 0xFF, 0xFC, 0x93, 0xAF, 0xFE, 0x97, 0x7D, 0x97, 0x7A, 0xCA, 0x77,
+    0x09, 0x95, 0x9F, 0xFE, 0xA9, 0x4A, 0xFF, 0xFD, 0x93, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x97,
+    0x69, 0xE9, 0x77, 0xE7, 0x7A, 0xD2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xD9, 0x0A, 0xFF, 0xFF,
+    0xA0, 0xAF, 0xFF, 0xF9, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0x9D, 0xA7, 0x5A, 0xE1, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFF, 0xCA, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x50, 0x77,
+    0x5A, 0xFF, 0xFF, 0xF9, 0x9F, 0xFF, 0xFD, 0xA9, 0x3E, 0x70, 0xAD, 0xA5, 0xE7, 0x09, 0xDA, 0x5E,
+    0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D,
+    0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7,
+    0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA,
+    0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x4A, 0xEA,
+    0x95, 0x9A, 0xEA, 0x90, 0xAF, 0xEA, 0x3F, 0xF0, 0x9A, 0xAA, 0xAA, 0xAA, 0x4A, 0xAA, 0xAA, 0xAA,
+    0xA0, 0x77, 0x29, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xDA, 0x2E, 0xA7, 0xE2, 0x9E, 0x96, 0x9D, 0x3A,
+    0xE7, 0xD4, 0xF6, 0xA9, 0x5E, 0xA7, 0x59, 0xE7, 0x6A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x5A, 0xDA,
+    0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x5E, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x9C,
+    0x3E, 0x70, 0xD9, 0x1E, 0x71, 0xD1, 0xAD, 0xA7, 0x9A, 0xD1, 0xFF, 0xFF, 0x1F, 0xFF, 0xEA, 0x2A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF0, 0xFF, 0xF7, 0x50, 0x74, 0xAC, 0xA7, 0x5D,
+    0x75, 0xDA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD7, 0x5A, 0xCA, 0x74, 0x9D, 0x75, 0xD9,
+    0x74, 0xAD, 0x75, 0xD7, 0x5A, 0xCA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD9, 0x74, 0xAC,
+    0xA7, 0x49, 0xD7, 0x5D, 0x97, 0x49, 0xD7, 0x5D, 0x97, 0x59, 0x97, 0x50, 0xAC, 0x97, 0x9D, 0x70,
+    0xD7, 0x0A, 0xCA, 0x79, 0xD7, 0x0D, 0x97, 0xAC, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xCA, 0x70, 0xD7,
+    0x0D, 0x97, 0x9D, 0x70, 0xD7, 0x0A, 0xCA, 0x79, 0xD7, 0x0D, 0x97, 0xAC, 0xA7, 0x0D, 0x70, 0xD9,
+    0x79, 0xD7, 0x0D, 0x71, 0x90, 0x59, 0x97, 0x3D, 0x73, 0xD6, 0x9A, 0x2D, 0x29, 0x91, 0xE9, 0x0D,
+    0x1E, 0x2A, 0xDA, 0xDA, 0xDA, 0x5F, 0xD9, 0x69, 0xF9, 0x59, 0xFF, 0x92, 0xAD, 0xA0, 0xD0, 0xAE,
+    0x1A, 0xC9, 0x1D, 0x19, 0xCA, 0x6D, 0x73, 0xD7, 0x3D, 0x50, 0x73, 0xAF, 0xA2, 0xAD, 0xAA, 0xE0,
+    0x9D, 0x3D, 0x9A, 0xCA, 0x3A, 0xCA, 0xAC, 0x93, 0x9C, 0xAA, 0xCA, 0x3A, 0xCA, 0x9D, 0x91, 0x9D,
+    0x1A, 0xFD, 0x92, 0x9A, 0xDA, 0x20, 0x09, 0xD9, 0x1F, 0x1F, 0x19, 0xD9, 0x00, 0x76, 0x99, 0x97,
+    0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xDA, 0x76, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6D, 0x97,
+    0x59, 0xD7, 0x6A, 0xD2, 0x99, 0x99, 0x99, 0x5D, 0xA2, 0xFD, 0x49, 0xD3, 0xFD, 0x4A, 0xD6, 0xAD,
+    0x93, 0xDA, 0x7D, 0xA3, 0xD9, 0x7E, 0x29, 0xD7, 0x0A, 0xD2, 0xDA, 0x70, 0x9D, 0x91, 0xD9, 0x71,
+    0xE0, 0x9D, 0x72, 0xAD, 0x0A, 0xCA, 0x72, 0x9D, 0x9D, 0x97, 0x3F, 0xC7, 0x4A, 0xF7, 0x49, 0xE9,
+    0x75, 0xE7, 0x6E, 0x77, 0x97, 0x00, 0x77, 0x9E, 0x93, 0xAC, 0xA0, 0xAF, 0xCA, 0x1A, 0xD9, 0x9D,
+    0x90, 0x9D, 0xA9, 0xCA, 0x1A, 0xC9, 0x3F, 0x2D, 0x49, 0xD3, 0xD4, 0x9D, 0x92, 0xAC, 0xA2, 0x9F,
+    0x29, 0xEA, 0xAD, 0x09, 0xDA, 0x1A, 0xFC, 0x29, 0xDA, 0x29, 0x99, 0x5A, 0x90, 0x2A, 0xDA, 0x4A,
+    0xDA, 0x3F, 0xD1, 0x9F, 0xD1, 0xDA, 0x1A, 0xCA, 0x0D, 0x90, 0x9D, 0x99, 0xD3, 0xF3, 0xAC, 0xA9,
+    0xCA, 0x4D, 0x93, 0x9C, 0xA9, 0xCA, 0x39, 0xDA, 0x39, 0xCA, 0x9D, 0x3F, 0xA2, 0xD9, 0x0E, 0xAA,
+    0xD1, 0xEA, 0xE2, 0xFC, 0x3F, 0xC4, 0x99, 0x95, 0x99, 0x92, 0x77, 0x29, 0xD7, 0x79, 0xD7, 0x79,
+    0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79,
+    0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF, 0xFC, 0x00, 0x77, 0x77,
+    0x4C, 0x97, 0x71, 0xE7, 0x70, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0xA7,
+    0x79, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E,
+    0x97, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF,
+    0xFD, 0x90, 0xAF, 0xFF, 0xFD, 0x90, 0x09, 0x91, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xAA, 0x90, 0x99, 0x92, 0x99, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D,
+    0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A,
+    0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1,
+    0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D,
+    0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A,
+    0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x09, 0xAA, 0x2A, 0xA0, 0x77,
+    0x72, 0xE7, 0x7E, 0xA7, 0x5A, 0xF7, 0x5D, 0xAD, 0x97, 0x39, 0xD0, 0xDA, 0x73, 0xDA, 0x0A, 0xD7,
+    0x3D, 0x91, 0xD9, 0x71, 0xAD, 0x2E, 0x71, 0xDA, 0x29, 0xD7, 0x09, 0xD4, 0xDA, 0x7A, 0xD4, 0xAD,
+    0x7D, 0xA4, 0x9D, 0x95, 0x9D, 0x6D, 0xA5, 0xE6, 0xAD, 0x5D, 0x97, 0xD9, 0x3A, 0xD7, 0x0E, 0x3D,
+    0xA7, 0x09, 0xD9, 0x19, 0xD9, 0x71, 0xDA, 0x1E, 0x72, 0xAD, 0x1D, 0xA7, 0x29, 0xD9, 0x77, 0x3D,
+    0xA7, 0x29, 0xD9, 0x0A, 0xD7, 0x2A, 0xD1, 0x9D, 0x97, 0x1D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD7,
+    0x0E, 0x4D, 0x97, 0xD9, 0x4E, 0x6A, 0xD5, 0x9D, 0x6D, 0xA6, 0xDA, 0x49, 0xD9, 0x6A, 0xD4, 0xAD,
+    0x79, 0xD9, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x71, 0x9D, 0x2E, 0x72, 0xD9, 0x1D, 0x97, 0x2A, 0xD0,
+    0xAD, 0x73, 0x9D, 0x0D, 0xA7, 0x4F, 0xC7, 0x5A, 0xF7, 0x6E, 0x97, 0x6E, 0x70, 0x59, 0xAA, 0xA9,
+    0x70, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x92, 0x9E, 0x94, 0x9E, 0x91, 0xE7, 0x0E, 0x1D, 0xA7, 0x0A,
+    0xD0, 0x9D, 0x97, 0x09, 0xD9, 0x9D, 0x72, 0xD9, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72,
+    0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA,
+    0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0x77,
+    0x0A, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA,
+    0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7,
+    0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xA9, 0xD7, 0x2D, 0x99, 0xD9, 0x70, 0x9D, 0x90, 0xDA,
+    0x70, 0xAD, 0x1E, 0x96, 0x9E, 0x19, 0xEA, 0x4A, 0xE3, 0x9F, 0xFE, 0x95, 0xAF, 0xEA, 0x71, 0x99,
+    0x99, 0x95, 0x71, 0x9A, 0xA9, 0x71, 0x9F, 0xD7, 0x0E, 0xAE, 0x96, 0xAD, 0x2D, 0x7D, 0xA7, 0x39,
+    0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9,
+    0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73,
+    0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0xAD,
+    0x97, 0x3A, 0xD7, 0xD2, 0xE6, 0x9E, 0xAA, 0xD9, 0x7F, 0xD9, 0x71, 0x9A, 0xA9, 0x71, 0x70, 0x97,
+    0x70, 0xE9, 0x75, 0x9E, 0xA7, 0x59, 0xE9, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0x97, 0x29, 0x92, 0xEA, 0x70, 0xAE, 0x1F, 0x70, 0xF1, 0xEA, 0x70, 0xAE, 0x29,
+    0x97, 0x29, 0x91, 0x19, 0x97, 0x39, 0x2E, 0xA7, 0x09, 0xE1, 0xF7, 0x0F, 0x1E, 0xA7, 0x0A, 0xE2,
+    0xA9, 0x72, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x77, 0xE9, 0x75,
+    0x9E, 0xA7, 0x59, 0xE9, 0x77, 0x97, 0x00, 0x39, 0x29, 0xE1, 0xF1, 0xE9, 0x19, 0xA9, 0x77, 0x77,
+    0x69, 0x3E, 0x1A, 0xE1, 0xAD, 0xA2, 0xA9, 0x20, 0x19, 0x97, 0x39, 0x2E, 0xA7, 0x09, 0xE1, 0xF7,
+    0x0F, 0x1E, 0xA7, 0x0A, 0xE2, 0xA9, 0x72, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x99, 0x72, 0x99, 0x2E, 0xA7, 0x0A, 0xE1, 0xF7, 0x0F, 0x1E, 0xA7, 0x0A, 0xE2, 0x99, 0x72,
+    0x99, 0x10, 0x39, 0x99, 0x73, 0xAF, 0xCA, 0x4D, 0x1A, 0xDA, 0xAF, 0xA9, 0x9D, 0xA1, 0xD3, 0x9A,
+    0xFC, 0xA2, 0x97, 0x9A, 0x93, 0x29, 0xAA, 0xA6, 0x99, 0x2F, 0xE9, 0x3D, 0x1E, 0x99, 0xAF, 0xAA,
+    0xD9, 0x1C, 0xA4, 0x9F, 0xC9, 0x74, 0x97, 0x77, 0x77, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA1, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x3A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x2A, 0xA9, 0x59, 0x19, 0xFC, 0x92, 0xAC, 0xA0, 0xEA, 0xF9, 0xAD, 0x99, 0xD2, 0xAF, 0xCA, 0x1A,
+    0x5A, 0xD9, 0x4A, 0xA9, 0x59, 0x19, 0xFC, 0x92, 0xAC, 0x90, 0xFF, 0x9A, 0xD9, 0x9D, 0x2A, 0xFD,
+    0x1C, 0x49, 0xAD, 0xA1, 0x09, 0x74, 0x91, 0xFA, 0xAA, 0xAA, 0xAA, 0xF1, 0xAF, 0xFF, 0xCA, 0x49,
+    0x9A, 0xAA, 0xAA, 0x99, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xEA, 0xAA, 0x93, 0xFF, 0xFE, 0x1D, 0xAA,
+    0x99, 0x99, 0x99, 0x9A, 0xAD, 0x77, 0x10, 0x70, 0xA7, 0x2D, 0x29, 0x99, 0x99, 0x99, 0xAD, 0x99,
+    0x0F, 0xFF, 0x0A, 0xAA, 0xAA, 0xAD, 0xAA, 0xAA, 0x5A, 0xC9, 0x71, 0xD5, 0x99, 0x99, 0xD9, 0x99,
+    0x99, 0x90, 0xFF, 0xF0, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0x2D, 0x72, 0xCA, 0x77, 0x50, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x77, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFE, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x79, 0xC9, 0x70, 0x9F, 0x69,
+    0xFA, 0x59, 0xF9, 0x59, 0xF9, 0x6F, 0x97, 0x0F, 0x97, 0x1A, 0xF9, 0x71, 0xAE, 0xA7, 0x2A, 0xEA,
+    0x71, 0x9F, 0xA7, 0x19, 0xDA, 0x73, 0x97, 0x77, 0x6F, 0xFF, 0x1F, 0xFF, 0x00, 0x76, 0x9C, 0x97,
+    0x2F, 0x97, 0x1A, 0xEA, 0x72, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0xAE, 0x79, 0xAE, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA7, 0xAD, 0xA7, 0x29, 0x77, 0x77, 0x7F, 0xFF, 0x1F, 0xFF, 0x00,
+    0x77, 0x77, 0x9C, 0xA7, 0xAC, 0x79, 0xF5, 0xAE, 0x94, 0x9F, 0xA4, 0xAF, 0x93, 0x9F, 0x94, 0xAE,
+    0xA4, 0x9F, 0x94, 0xAE, 0xA5, 0xF9, 0x49, 0xEA, 0x7F, 0x95, 0xF9, 0x79, 0xF9, 0x4A, 0xF7, 0x09,
+    0xF9, 0x4A, 0xEA, 0x70, 0xAF, 0x94, 0xAE, 0xA7, 0x0A, 0xF4, 0x9F, 0xA7, 0x0A, 0xD6, 0x9D, 0x97,
+    0x74, 0x90, 0x77, 0x7C, 0xA7, 0xAC, 0x97, 0x0A, 0xEA, 0x5F, 0x97, 0x9F, 0xA4, 0xAF, 0x97, 0x0A,
+    0xEA, 0x49, 0xF9, 0x70, 0xAE, 0xA4, 0x9F, 0x97, 0x0A, 0xE5, 0x9F, 0x69, 0xF5, 0xAE, 0xA4, 0x9F,
+    0xA4, 0x9F, 0x94, 0xAE, 0xA4, 0x9F, 0x94, 0xAE, 0xA4, 0x9F, 0x94, 0xAF, 0x94, 0xFA, 0x69, 0xD9,
+    0x6D, 0xA7, 0x19, 0x77, 0x40, 0x9F, 0xFC, 0xAA, 0x95, 0xAF, 0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xF9, 0x76, 0x9E, 0x97, 0x69, 0xE7, 0x7A, 0xD7, 0x79, 0xD9, 0x77, 0xDA, 0x76, 0x9D,
+    0xA7, 0x69, 0xD9, 0x76, 0xE7, 0x69, 0xE7, 0x5A, 0xE1, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9,
+    0x1A, 0xFF, 0xFC, 0xA3, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0x75, 0x97, 0x70, 0xAC, 0xA7,
+    0x7D, 0x97, 0x69, 0xD7, 0x7A, 0xCA, 0x71, 0x9A, 0xAF, 0xFC, 0x93, 0xFF, 0xFD, 0xA1, 0x9F, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xA9, 0x09, 0xE9, 0x4D, 0x95, 0xE9, 0x49, 0xD6, 0xDA, 0x5A, 0xD5, 0x9D, 0x95,
+    0xD9, 0x5A, 0xD5, 0x9D, 0x6A, 0xD5, 0xAD, 0x69, 0xD9, 0x4D, 0x97, 0xDA, 0x4D, 0x70, 0xE9, 0x2A,
+    0xD7, 0x1E, 0x91, 0xDA, 0x71, 0x9F, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFD, 0xA5, 0x9E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x96, 0xD7, 0x79, 0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x79, 0x97, 0x20, 0x72,
+    0x99, 0x77, 0x9D, 0x77, 0xAC, 0xA7, 0x7D, 0x97, 0x69, 0xD6, 0x9F, 0xFE, 0x95, 0xAF, 0xFF, 0xD3,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAD, 0xAF, 0x97, 0x1A, 0xCA, 0x19, 0xE9, 0x70, 0xD9, 0x29, 0xE7, 0x9D,
+    0x4A, 0xD7, 0xAD, 0x49, 0xD9, 0x6D, 0x95, 0xDA, 0x6D, 0x59, 0xDA, 0x5A, 0xD5, 0x9D, 0x95, 0xD9,
+    0x5E, 0x6D, 0x59, 0xE5, 0xAD, 0x4A, 0xE1, 0x9A, 0xAA, 0xAE, 0xAA, 0xAA, 0xF9, 0x1A, 0xFF, 0xFC,
+    0xA3, 0x9A, 0xAA, 0xEA, 0xAA, 0xAA, 0x97, 0x1D, 0xA7, 0x7D, 0x77, 0x9D, 0x77, 0xDA, 0x77, 0x99,
+    0x75, 0x77, 0x7A, 0xFF, 0xFA, 0x2A, 0xFF, 0xFD, 0xA1, 0xAE, 0xA9, 0x73, 0x9E, 0x76, 0xE7, 0x69,
+    0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x79, 0xD9, 0x76, 0x9D, 0x97, 0x7E, 0x77, 0xAD, 0xA7, 0x7F,
+    0x97, 0x6F, 0xFF, 0xEA, 0x39, 0xFF, 0xFC, 0xA6, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x75, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x77, 0x2A,
+    0xFF, 0xFA, 0x4A, 0xFF, 0xFD, 0xA7, 0x59, 0xAE, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0xAD, 0x97, 0x69,
+    0xD9, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x69, 0xD9, 0x76, 0xE7, 0x6A, 0xDA, 0x74, 0x9F, 0x1A, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFC, 0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x29, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA0, 0x70, 0x99, 0x97, 0x6A,
+    0xFE, 0xA7, 0x1A, 0xDA, 0x9A, 0xCA, 0x9A, 0xDA, 0x6D, 0xA2, 0x9C, 0x92, 0xAD, 0x4D, 0x93, 0x9C,
+    0x93, 0x9D, 0x29, 0xCA, 0x49, 0xC9, 0x4A, 0xC9, 0x1D, 0x59, 0xC9, 0x5D, 0x09, 0xC9, 0x59, 0xC9,
+    0x5A, 0xC9, 0xAC, 0x69, 0xC9, 0x6C, 0xAD, 0x69, 0xC9, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6,
+    0x9C, 0x96, 0xDA, 0xC6, 0x9C, 0x96, 0xCA, 0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x90, 0xD5, 0x9C, 0x95,
+    0xD1, 0xAC, 0xA4, 0x9C, 0x94, 0xAC, 0xA2, 0xD9, 0x39, 0xC9, 0x39, 0xD4, 0xDA, 0x29, 0xC9, 0x2A,
+    0xD6, 0xAD, 0xA9, 0xAC, 0xA9, 0xAD, 0xA7, 0x09, 0xFF, 0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99,
+    0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x99, 0x09, 0x9A, 0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xD9, 0x72,
+    0x9D, 0x29, 0xCA, 0x74, 0xAC, 0x91, 0xD7, 0x6D, 0x09, 0xC9, 0x76, 0xAC, 0x9A, 0xC7, 0x70, 0xCA,
+    0xD7, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x77, 0x0D, 0xAC, 0x77, 0x0C, 0xA9, 0xC9, 0x76,
+    0x9C, 0x90, 0xD7, 0x6D, 0x1A, 0xCA, 0x74, 0xAC, 0xA2, 0xD9, 0x72, 0x9D, 0x4D, 0xA7, 0x0A, 0xD6,
+    0xAD, 0xA9, 0x29, 0xAD, 0xA7, 0x09, 0xFF, 0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99, 0x97, 0x6A,
+    0xFE, 0xA7, 0x1A, 0xDA, 0x99, 0x09, 0x9A, 0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xE7, 0x19, 0xE2, 0x9C,
+    0xAD, 0x79, 0xDA, 0xC9, 0x1D, 0x09, 0xD5, 0x9D, 0x90, 0xD0, 0x9C, 0x91, 0x9D, 0x39, 0xD9, 0x19,
+    0xC9, 0xAC, 0x39, 0xD1, 0x9D, 0x93, 0xCA, 0xD4, 0x9D, 0x9D, 0x5F, 0x59, 0xE6, 0xF5, 0x9E, 0x6F,
+    0x49, 0xDA, 0xD5, 0xDA, 0xC3, 0x9D, 0x19, 0xD4, 0xCA, 0x9C, 0x91, 0x9D, 0x39, 0xD2, 0x9C, 0x90,
+    0xD0, 0x9D, 0x59, 0xD1, 0xD1, 0xAC, 0xAD, 0x79, 0xDA, 0xCA, 0x2E, 0x71, 0x9E, 0x4D, 0xA7, 0x0A,
+    0xD6, 0xAD, 0xA9, 0x29, 0xAD, 0xA7, 0x09, 0xFF, 0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99, 0x97,
+    0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x99, 0x09, 0x9A, 0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xD9, 0x71, 0x9E,
+    0x29, 0xCA, 0x71, 0x9D, 0xAC, 0x91, 0xD7, 0x19, 0xD9, 0x0D, 0x09, 0xC9, 0x70, 0x9D, 0x91, 0x9C,
+    0x9A, 0xC7, 0x09, 0xD9, 0x3C, 0xAD, 0x79, 0xD9, 0x4F, 0x69, 0xD9, 0x5F, 0x59, 0xD9, 0x6F, 0x49,
+    0xD9, 0x7D, 0xAC, 0x39, 0xD9, 0x70, 0xCA, 0x9C, 0x91, 0x9D, 0x97, 0x09, 0xC9, 0x0D, 0x09, 0xD9,
+    0x71, 0xD1, 0xAC, 0xAD, 0x97, 0x1A, 0xCA, 0x2E, 0x97, 0x19, 0xD4, 0xDA, 0x70, 0xAD, 0x6A, 0xDA,
+    0x92, 0x9A, 0xDA, 0x70, 0x9F, 0xFC, 0x97, 0x49, 0x99, 0x99, 0x70, 0x77, 0x7E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x69, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xEA,
+    0xAF, 0xFF, 0xEA, 0x1A, 0xA9, 0x1F, 0x1F, 0x1A, 0xDA, 0x60, 0x1A, 0xA6, 0x9A, 0xA6, 0xAA, 0x91,
+    0xF4, 0x9E, 0x94, 0xAE, 0x1F, 0x4A, 0xEA, 0x4F, 0x1E, 0x95, 0xE5, 0x9D, 0xA7, 0x77, 0x10, 0x74,
+    0xA7, 0x77, 0x0A, 0xCA, 0x77, 0x6A, 0xEA, 0x77, 0x4A, 0xFC, 0xA7, 0x72, 0xAC, 0xA9, 0x9A, 0xDA,
+    0x77, 0x0A, 0xC5, 0xAC, 0xA7, 0x6A, 0xCA, 0x69, 0xCA, 0x74, 0xAE, 0x09, 0xAA, 0x92, 0xAC, 0xA7,
+    0x2A, 0xFF, 0xD2, 0xDA, 0x70, 0xAF, 0xFF, 0x1E, 0xA6, 0xAF, 0xFF, 0xC1, 0xAE, 0xA4, 0xAF, 0xFF,
+    0xD1, 0xAF, 0xA2, 0xAF, 0xFF, 0xD9, 0x1A, 0xFC, 0xA0, 0xAF, 0xFE, 0xA9, 0x4F, 0xEA, 0x0F, 0xFD,
+    0x6F, 0xF2, 0xFF, 0xC4, 0xAF, 0xF4, 0xFF, 0x2A, 0xFF, 0xC6, 0xFE, 0x1A, 0xFF, 0xC7, 0x0F, 0xD9,
+    0x09, 0xFF, 0x72, 0xFF, 0xFE, 0x74, 0xFD, 0xAF, 0xD7, 0x6F, 0x2F, 0x77, 0x0E, 0x2E, 0x77, 0x2D,
+    0x90, 0xAD, 0x77, 0x4F, 0xC7, 0x76, 0xE7, 0x77, 0x0C, 0x77, 0x77, 0x70,
 };
 
 static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 9, 23, 11, 1, 22, 52, 0 }, // !
-    { 10, 9, 12, 1, 21, 23, 52 }, // "
-    { 18, 19, 19, 0, 17, 86, 75 }, // #
-    { 16, 30, 18, 1, 24, 120, 161 }, // $
-    { 25, 24, 28, 2, 22, 150, 281 }, // %
-    { 23, 24, 26, 2, 22, 138, 431 }, // &
-    { 5, 9, 7, 1, 21, 12, 569 }, // '
-    { 13, 30, 15, 1, 24, 98, 581 }, // (
-    { 12, 30, 11, -2, 24, 90, 679 }, // )
-    { 10, 11, 12, 1, 22, 28, 769 }, // *
-    { 13, 14, 18, 3, 17, 46, 797 }, // +
-    { 7, 9, 9, -1, 4, 16, 843 }, // ,
-    { 9, 3, 11, 1, 9, 7, 859 }, // -
-    { 5, 5, 9, 1, 4, 7, 866 }, // .
-    { 17, 23, 17, -1, 21, 98, 873 }, // /
-    { 18, 22, 19, 0, 21, 99, 971 }, // 0
-    { 12, 21, 18, 2, 21, 63, 1070 }, // 1
-    { 17, 21, 18, 0, 21, 90, 1133 }, // 2
-    { 16, 22, 18, 0, 21, 88, 1223 }, // 3
-    { 17, 21, 18, 0, 21, 90, 1311 }, // 4
-    { 16, 21, 18, 1, 20, 84, 1401 }, // 5
-    { 17, 22, 19, 1, 21, 94, 1485 }, // 6
-    { 16, 21, 20, 3, 20, 84, 1579 }, // 7
-    { 16, 22, 18, 1, 21, 88, 1663 }, // 8
-    { 17, 22, 18, 0, 21, 94, 1751 }, // 9
-    { 8, 16, 10, 1, 15, 32, 1845 }, // :
-    { 10, 20, 10, -1, 15, 50, 1877 }, // ;
-    { 14, 14, 18, 2, 17, 49, 1927 }, // <
-    { 13, 8, 18, 3, 14, 26, 1976 }, // =
-    { 14, 14, 18, 2, 17, 49, 2002 }, // >
-    { 10, 22, 13, 2, 21, 55, 2051 }, // ?
-    { 27, 26, 29, 1, 20, 176, 2106 }, // @
-    { 22, 21, 21, -2, 21, 116, 2282 }, // A
-    { 18, 22, 18, -1, 21, 99, 2398 }, // B
-    { 18, 22, 20, 1, 21, 99, 2497 }, // C
-    { 21, 22, 21, -1, 21, 116, 2596 }, // D
-    { 19, 21, 19, -1, 21, 100, 2712 }, // E
-    { 18, 21, 18, -1, 21, 95, 2812 }, // F
-    { 19, 22, 21, 1, 21, 105, 2907 }, // G
-    { 25, 21, 25, -1, 21, 132, 3012 }, // H
-    { 13, 21, 13, -1, 21, 69, 3144 }, // I
-    { 17, 27, 13, -5, 21, 115, 3213 }, // J
-    { 23, 22, 23, -1, 21, 127, 3328 }, // K
-    { 17, 21, 17, -1, 21, 90, 3455 }, // L
-    { 28, 21, 27, -2, 21, 147, 3545 }, // M
-    { 25, 22, 25, -1, 21, 138, 3692 }, // N
-    { 20, 22, 22, 1, 21, 110, 3830 }, // O
-    { 18, 21, 18, -1, 21, 95, 3940 }, // P
-    { 24, 28, 26, 1, 21, 168, 4035 }, // Q
-    { 19, 22, 19, -1, 21, 105, 4203 }, // R
-    { 15, 22, 16, 0, 21, 83, 4308 }, // S
-    { 18, 21, 21, 2, 21, 95, 4391 }, // T
-    { 22, 22, 25, 2, 21, 121, 4486 }, // U
-    { 21, 22, 24, 2, 21, 116, 4607 }, // V
-    { 30, 22, 33, 2, 21, 165, 4723 }, // W
-    { 24, 21, 22, -3, 21, 126, 4888 }, // X
-    { 20, 21, 22, 1, 21, 105, 5014 }, // Y
-    { 18, 22, 18, -1, 21, 99, 5119 }, // Z
-    { 12, 28, 12, -1, 23, 84, 5218 }, // [
-    { 12, 23, 14, 1, 21, 69, 5302 }, // <backslash>
-    { 12, 28, 12, -1, 23, 84, 5371 }, // ]
-    { 14, 14, 18, 2, 19, 49, 5455 }, // ^
-    { 15, 3, 16, 0, -1, 12, 5504 }, // _
-    { 6, 8, 18, 6, 24, 12, 5516 }, // `
-    { 16, 17, 18, 1, 16, 68, 5528 }, // a
-    { 15, 24, 16, 0, 23, 90, 5596 }, // b
-    { 12, 17, 14, 1, 16, 51, 5686 }, // c
-    { 16, 24, 18, 1, 23, 96, 5737 }, // d
-    { 12, 17, 14, 1, 16, 51, 5833 }, // e
-    { 20, 30, 16, -5, 23, 150, 5884 }, // f
-    { 19, 23, 17, -3, 16, 110, 6034 }, // g
-    { 17, 24, 18, 0, 23, 102, 6144 }, // h
-    { 9, 24, 11, 1, 23, 54, 6246 }, // i
-    { 15, 30, 10, -6, 23, 113, 6300 }, // j
-    { 14, 24, 16, 1, 23, 84, 6413 }, // k
-    { 8, 24, 10, 1, 23, 48, 6497 }, // l
-    { 24, 17, 26, 1, 16, 102, 6545 }, // m
-    { 16, 17, 18, 1, 16, 68, 6647 }, // n
-    { 14, 17, 16, 1, 16, 60, 6715 }, // o
-    { 18, 23, 17, -2, 16, 104, 6775 }, // p
-    { 15, 23, 17, 1, 16, 87, 6879 }, // q
-    { 12, 16, 14, 1, 16, 48, 6966 }, // r
-    { 12, 17, 13, 0, 16, 51, 7014 }, // s
-    { 12, 20, 13, 0, 19, 60, 7065 }, // t
-    { 16, 17, 18, 1, 16, 68, 7125 }, // u
-    { 15, 17, 16, 0, 16, 64, 7193 }, // v
-    { 22, 17, 23, 0, 16, 94, 7257 }, // w
-    { 18, 17, 18, -1, 16, 77, 7351 }, // x
-    { 18, 23, 16, -3, 16, 104, 7428 }, // y
-    { 14, 17, 15, 0, 16, 60, 7532 }, // z
-    { 12, 29, 14, 1, 24, 87, 7592 }, // {
-    { 8, 27, 9, 0, 23, 54, 7679 }, // |
-    { 11, 29, 11, -1, 24, 80, 7733 }, // }
-    { 14, 6, 18, 2, 13, 21, 7813 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7834 }, //  
-    { 9, 23, 9, -1, 16, 52, 7834 }, // ¡
-    { 14, 29, 18, 2, 23, 102, 7886 }, // ¢
-    { 19, 22, 19, -1, 21, 105, 7988 }, // £
-    { 18, 14, 19, 0, 17, 63, 8093 }, // ¤
-    { 19, 20, 21, 1, 20, 95, 8156 }, // ¥
-    { 8, 27, 9, 0, 23, 54, 8251 }, // ¦
-    { 13, 23, 14, 0, 20, 75, 8305 }, // §
-    { 10, 4, 18, 4, 22, 10, 8380 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 8390 }, // ©
-    { 11, 14, 13, 1, 21, 39, 8511 }, // ª
-    { 14, 11, 16, 1, 13, 39, 8550 }, // «
-    { 13, 8, 18, 3, 14, 26, 8589 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 8615 }, // ­
-    { 17, 16, 18, 0, 23, 68, 8622 }, // ®
-    { 10, 3, 18, 4, 21, 8, 8690 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 8698 }, // °
-    { 13, 17, 18, 3, 17, 56, 8729 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8785 }, // ²
-    { 10, 14, 13, 1, 24, 35, 8824 }, // ³
-    { 6, 7, 18, 6, 24, 11, 8859 }, // ´
-    { 19, 24, 19, -1, 16, 114, 8870 }, // µ
-    { 19, 26, 19, -1, 21, 124, 8984 }, // ¶
-    { 5, 5, 9, 2, 10, 7, 9108 }, // ·
-    { 6, 7, 18, 6, -1, 11, 9115 }, // ¸
-    { 8, 14, 13, 2, 24, 28, 9126 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 9154 }, // º
-    { 14, 11, 15, 0, 13, 39, 9193 }, // »
-    { 28, 24, 31, 2, 22, 168, 9232 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 9400 }, // ½
-    { 29, 24, 31, 1, 22, 174, 9568 }, // ¾
-    { 10, 22, 12, 0, 16, 55, 9742 }, // ¿
-    { 22, 28, 21, -2, 28, 154, 9797 }, // À
-    { 22, 28, 21, -2, 28, 154, 9951 }, // Á
-    { 22, 28, 21, -2, 28, 154, 10105 }, // Â
-    { 22, 28, 21, -2, 28, 154, 10259 }, // Ã
-    { 22, 27, 21, -2, 27, 149, 10413 }, // Ä
-    { 22, 29, 21, -2, 29, 160, 10562 }, // Å
-    { 29, 21, 27, -3, 21, 153, 10722 }, // Æ
-    { 18, 29, 20, 1, 21, 131, 10875 }, // Ç
-    { 19, 28, 19, -1, 28, 133, 11006 }, // È
-    { 19, 28, 19, -1, 28, 133, 11139 }, // É
-    { 19, 28, 19, -1, 28, 133, 11272 }, // Ê
-    { 19, 27, 19, -1, 27, 129, 11405 }, // Ë
-    { 13, 28, 13, -1, 28, 91, 11534 }, // Ì
-    { 14, 28, 14, -1, 28, 98, 11625 }, // Í
-    { 15, 28, 15, -1, 28, 105, 11723 }, // Î
-    { 15, 27, 15, -1, 27, 102, 11828 }, // Ï
-    { 21, 22, 21, -1, 21, 116, 11930 }, // Ð
-    { 25, 29, 25, -1, 28, 182, 12046 }, // Ñ
-    { 20, 29, 22, 1, 28, 145, 12228 }, // Ò
-    { 20, 29, 22, 1, 28, 145, 12373 }, // Ó
-    { 20, 29, 22, 1, 28, 145, 12518 }, // Ô
-    { 20, 29, 22, 1, 28, 145, 12663 }, // Õ
-    { 20, 28, 22, 1, 27, 140, 12808 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 12948 }, // ×
-    { 23, 22, 23, -1, 21, 127, 12984 }, // Ø
-    { 22, 29, 25, 2, 28, 160, 13111 }, // Ù
-    { 22, 29, 25, 2, 28, 160, 13271 }, // Ú
-    { 22, 29, 25, 2, 28, 160, 13431 }, // Û
-    { 22, 28, 25, 2, 27, 154, 13591 }, // Ü
-    { 20, 28, 22, 1, 28, 140, 13745 }, // Ý
-    { 18, 21, 18, -1, 21, 95, 13885 }, // Þ
-    { 23, 30, 19, -5, 23, 173, 13980 }, // ß
-    { 16, 25, 18, 1, 24, 100, 14153 }, // à
-    { 16, 25, 18, 1, 24, 100, 14253 }, // á
-    { 16, 25, 18, 1, 24, 100, 14353 }, // â
-    { 16, 24, 18, 1, 23, 96, 14453 }, // ã
-    { 16, 23, 18, 1, 22, 92, 14549 }, // ä
-    { 16, 25, 18, 1, 24, 100, 14641 }, // å
-    { 21, 17, 23, 1, 16, 90, 14741 }, // æ
-    { 12, 24, 14, 1, 16, 72, 14831 }, // ç
-    { 12, 25, 14, 1, 24, 75, 14903 }, // è
-    { 13, 25, 15, 1, 24, 82, 14978 }, // é
-    { 13, 25, 15, 1, 24, 82, 15060 }, // ê
-    { 14, 23, 16, 1, 22, 81, 15142 }, // ë
-    { 8, 25, 10, 1, 24, 50, 15223 }, // ì
-    { 11, 25, 13, 1, 24, 69, 15273 }, // í
-    { 11, 25, 13, 1, 24, 69, 15342 }, // î
-    { 11, 23, 13, 1, 22, 64, 15411 }, // ï
-    { 15, 25, 16, 0, 24, 94, 15475 }, // ð
-    { 16, 24, 18, 1, 23, 96, 15569 }, // ñ
-    { 14, 25, 16, 1, 24, 88, 15665 }, // ò
-    { 14, 25, 16, 1, 24, 88, 15753 }, // ó
-    { 14, 25, 16, 1, 24, 88, 15841 }, // ô
-    { 15, 24, 17, 1, 23, 90, 15929 }, // õ
-    { 15, 23, 17, 1, 22, 87, 16019 }, // ö
-    { 13, 14, 18, 3, 17, 46, 16106 }, // ÷
-    { 19, 17, 18, -2, 16, 81, 16152 }, // ø
-    { 16, 25, 18, 1, 24, 100, 16233 }, // ù
-    { 16, 25, 18, 1, 24, 100, 16333 }, // ú
-    { 16, 25, 18, 1, 24, 100, 16433 }, // û
-    { 16, 23, 18, 1, 22, 92, 16533 }, // ü
-    { 18, 31, 16, -3, 24, 140, 16625 }, // ý
-    { 18, 30, 16, -3, 23, 135, 16765 }, // þ
-    { 18, 29, 16, -3, 22, 131, 16900 }, // ÿ
-    { 22, 26, 21, -2, 26, 143, 17031 }, // Ā
-    { 16, 22, 18, 1, 21, 88, 17174 }, // ā
-    { 22, 28, 21, -2, 28, 154, 17262 }, // Ă
-    { 16, 24, 18, 1, 23, 96, 17416 }, // ă
-    { 22, 28, 21, -2, 21, 154, 17512 }, // Ą
-    { 16, 23, 18, 1, 16, 92, 17666 }, // ą
-    { 18, 29, 20, 1, 28, 131, 17758 }, // Ć
-    { 13, 25, 15, 1, 24, 82, 17889 }, // ć
-    { 18, 29, 20, 1, 28, 131, 17971 }, // Ĉ
-    { 13, 25, 15, 1, 24, 82, 18102 }, // ĉ
-    { 18, 29, 20, 1, 28, 131, 18184 }, // Ċ
-    { 12, 23, 14, 1, 22, 69, 18315 }, // ċ
-    { 18, 29, 20, 1, 28, 131, 18384 }, // Č
-    { 14, 25, 16, 1, 24, 88, 18515 }, // č
-    { 21, 29, 21, -1, 28, 153, 18603 }, // Ď
-    { 21, 26, 23, 1, 25, 137, 18756 }, // ď
-    { 21, 22, 21, -1, 21, 116, 18893 }, // Đ
-    { 18, 24, 20, 1, 23, 108, 19009 }, // đ
-    { 19, 26, 19, -1, 26, 124, 19117 }, // Ē
-    { 13, 22, 15, 1, 21, 72, 19241 }, // ē
-    { 19, 28, 19, -1, 28, 133, 19313 }, // Ĕ
-    { 14, 24, 16, 1, 23, 84, 19446 }, // ĕ
-    { 19, 28, 19, -1, 28, 133, 19530 }, // Ė
-    { 12, 23, 14, 1, 22, 69, 19663 }, // ė
-    { 19, 28, 19, -1, 21, 133, 19732 }, // Ę
-    { 12, 23, 14, 1, 16, 69, 19865 }, // ę
-    { 19, 28, 19, -1, 28, 133, 19934 }, // Ě
-    { 14, 25, 16, 1, 24, 88, 20067 }, // ě
-    { 19, 29, 21, 1, 28, 138, 20155 }, // Ĝ
-    { 19, 31, 17, -3, 24, 148, 20293 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 20441 }, // Ğ
-    { 19, 30, 17, -3, 23, 143, 20579 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 20722 }, // Ġ
-    { 19, 29, 17, -3, 22, 138, 20860 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 20998 }, // Ģ
-    { 19, 32, 17, -3, 25, 152, 21136 }, // ģ
-    { 25, 28, 25, -1, 28, 175, 21288 }, // Ĥ
-    { 17, 31, 18, 0, 30, 132, 21463 }, // ĥ
-    { 25, 21, 25, -1, 21, 132, 21595 }, // Ħ
-    { 17, 24, 18, 0, 23, 102, 21727 }, // ħ
-    { 14, 28, 14, -1, 28, 98, 21829 }, // Ĩ
-    { 11, 24, 13, 1, 23, 66, 21927 }, // ĩ
-    { 14, 26, 14, -1, 26, 91, 21993 }, // Ī
-    { 11, 22, 13, 1, 21, 61, 22084 }, // ī
-    { 15, 28, 15, -1, 28, 105, 22145 }, // Ĭ
-    { 11, 24, 13, 1, 23, 66, 22250 }, // ĭ
-    { 13, 28, 13, -1, 21, 91, 22316 }, // Į
-    { 9, 30, 11, 1, 23, 68, 22407 }, // į
-    { 13, 28, 13, -1, 28, 91, 22475 }, // İ
-    { 8, 17, 10, 1, 16, 34, 22566 }, // ı
-    { 24, 27, 24, -1, 21, 162, 22600 }, // Ĳ
-    { 18, 30, 20, 1, 23, 135, 22762 }, // ĳ
-    { 19, 34, 15, -5, 28, 162, 22897 }, // Ĵ
-    { 17, 31, 12, -6, 24, 132, 23059 }, // ĵ
-    { 23, 29, 23, -1, 21, 167, 23191 }, // Ķ
-    { 14, 31, 16, 1, 23, 109, 23358 }, // ķ
-    { 15, 17, 17, 1, 16, 64, 23467 }, // ĸ
-    { 17, 28, 17, -1, 28, 119, 23531 }, // Ĺ
-    { 10, 31, 12, 1, 30, 78, 23650 }, // ĺ
-    { 17, 29, 17, -1, 21, 124, 23728 }, // Ļ
-    { 10, 31, 10, -1, 23, 78, 23852 }, // ļ
-    { 18, 23, 18, -1, 23, 104, 23930 }, // Ľ
-    { 13, 26, 15, 1, 25, 85, 24034 }, // ľ
-    { 18, 21, 18, -1, 21, 95, 24119 }, // Ŀ
-    { 12, 24, 14, 1, 23, 72, 24214 }, // ŀ
-    { 17, 21, 17, -1, 21, 90, 24286 }, // Ł
-    { 11, 24, 11, -1, 23, 66, 24376 }, // ł
-    { 25, 29, 25, -1, 28, 182, 24442 }, // Ń
-    { 16, 25, 18, 1, 24, 100, 24624 }, // ń
-    { 25, 29, 25, -1, 21, 182, 24724 }, // Ņ
-    { 16, 24, 18, 1, 16, 96, 24906 }, // ņ
-    { 25, 29, 25, -1, 28, 182, 25002 }, // Ň
-    { 16, 25, 18, 1, 24, 100, 25184 }, // ň
-    { 21, 23, 24, 2, 22, 121, 25284 }, // ŉ
-    { 25, 27, 25, -1, 21, 169, 25405 }, // Ŋ
-    { 15, 23, 17, 1, 16, 87, 25574 }, // ŋ
-    { 20, 27, 22, 1, 26, 135, 25661 }, // Ō
-    { 15, 22, 17, 1, 21, 83, 25796 }, // ō
-    { 20, 29, 22, 1, 28, 145, 25879 }, // Ŏ
-    { 15, 24, 17, 1, 23, 90, 26024 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 26114 }, // Ő
-    { 16, 25, 18, 1, 24, 100, 26272 }, // ő
-    { 27, 22, 29, 1, 21, 149, 26372 }, // Œ
-    { 22, 17, 24, 1, 16, 94, 26521 }, // œ
-    { 19, 29, 19, -1, 28, 138, 26615 }, // Ŕ
-    { 13, 24, 15, 1, 24, 78, 26753 }, // ŕ
-    { 19, 29, 19, -1, 21, 138, 26831 }, // Ŗ
-    { 14, 24, 14, -1, 16, 84, 26969 }, // ŗ
-    { 19, 29, 19, -1, 28, 138, 27053 }, // Ř
-    { 14, 24, 16, 1, 24, 84, 27191 }, // ř
-    { 15, 29, 16, 0, 28, 109, 27275 }, // Ś
-    { 13, 25, 14, 0, 24, 82, 27384 }, // ś
-    { 15, 29, 16, 0, 28, 109, 27466 }, // Ŝ
-    { 13, 25, 14, 0, 24, 82, 27575 }, // ŝ
-    { 15, 29, 16, 0, 21, 109, 27657 }, // Ş
-    { 12, 24, 13, 0, 16, 72, 27766 }, // ş
-    { 16, 29, 17, 0, 28, 116, 27838 }, // Š
-    { 14, 25, 15, 0, 24, 88, 27954 }, // š
-    { 18, 29, 21, 2, 21, 131, 28042 }, // Ţ
-    { 12, 27, 13, 0, 19, 81, 28173 }, // ţ
-    { 18, 28, 21, 2, 28, 126, 28254 }, // Ť
-    { 13, 25, 14, 0, 24, 82, 28380 }, // ť
-    { 18, 21, 21, 2, 21, 95, 28462 }, // Ŧ
-    { 12, 20, 13, 0, 19, 60, 28557 }, // ŧ
-    { 22, 29, 25, 2, 28, 160, 28617 }, // Ũ
-    { 16, 24, 18, 1, 23, 96, 28777 }, // ũ
-    { 22, 27, 25, 2, 26, 149, 28873 }, // Ū
-    { 16, 22, 18, 1, 21, 88, 29022 }, // ū
-    { 22, 29, 25, 2, 28, 160, 29110 }, // Ŭ
-    { 16, 24, 18, 1, 23, 96, 29270 }, // ŭ
-    { 22, 30, 25, 2, 29, 165, 29366 }, // Ů
-    { 16, 25, 18, 1, 24, 100, 29531 }, // ů
-    { 22, 30, 25, 2, 29, 165, 29631 }, // Ű
-    { 16, 25, 18, 1, 24, 100, 29796 }, // ű
-    { 22, 28, 25, 2, 21, 154, 29896 }, // Ų
-    { 16, 23, 18, 1, 16, 92, 30050 }, // ų
-    { 30, 29, 33, 2, 28, 218, 30142 }, // Ŵ
-    { 22, 25, 23, 0, 24, 138, 30360 }, // ŵ
-    { 20, 28, 22, 1, 28, 140, 30498 }, // Ŷ
-    { 18, 31, 16, -3, 24, 140, 30638 }, // ŷ
-    { 20, 27, 22, 1, 27, 135, 30778 }, // Ÿ
-    { 18, 29, 18, -1, 28, 131, 30913 }, // Ź
-    { 14, 25, 15, 0, 24, 88, 31044 }, // ź
-    { 18, 29, 18, -1, 28, 131, 31132 }, // Ż
-    { 14, 23, 15, 0, 22, 81, 31263 }, // ż
-    { 18, 29, 18, -1, 28, 131, 31344 }, // Ž
-    { 14, 25, 15, 0, 24, 88, 31475 }, // ž
-    { 20, 30, 16, -5, 23, 150, 31563 }, // ſ
-    { 23, 25, 25, 1, 24, 144, 31713 }, // Ơ
-    { 17, 20, 19, 1, 19, 85, 31857 }, // ơ
-    { 19, 21, 20, 0, 21, 100, 31942 }, // Ƥ
-    { 18, 30, 17, -2, 23, 135, 32042 }, // ƥ
-    { 12, 26, 13, 0, 19, 78, 32177 }, // ƫ
-    { 19, 21, 21, 1, 21, 100, 32255 }, // Ƭ
-    { 15, 24, 16, 0, 23, 90, 32355 }, // ƭ
-    { 18, 27, 21, 2, 21, 122, 32445 }, // Ʈ
-    { 23, 25, 26, 2, 24, 144, 32567 }, // Ư
-    { 19, 20, 21, 1, 19, 95, 32711 }, // ư
-    { 6, 8, 3, -4, 24, 12, 32806 }, // ̀
-    { 6, 7, 5, -2, 24, 11, 32818 }, // ́
-    { 10, 7, 5, -6, 24, 18, 32829 }, // ̂
-    { 10, 6, 6, -5, 23, 15, 32847 }, // ̃
-    { 10, 3, 6, -5, 21, 8, 32862 }, // ̄
-    { 10, 6, 6, -5, 23, 15, 32870 }, // ̆
-    { 4, 4, 3, -2, 22, 4, 32885 }, // ̇
-    { 10, 4, 6, -5, 22, 10, 32889 }, // ̈
-    { 8, 9, 5, -4, 26, 18, 32899 }, // ̉
-    { 8, 8, 5, -4, 24, 16, 32917 }, // ̊
-    { 11, 7, 7, -5, 24, 20, 32933 }, // ̋
-    { 10, 7, 7, -4, 24, 18, 32953 }, // ̌
-    { 9, 8, 4, -6, 24, 18, 32971 }, // ̏
-    { 10, 6, 6, -5, 23, 15, 32989 }, // ̑
-    { 6, 9, 4, -3, 25, 14, 33004 }, // ̒
-    { 7, 9, 5, -3, 26, 16, 33018 }, // ̓
-    { 6, 9, 3, -4, 26, 14, 33034 }, // ̔
-    { 4, 8, 3, -2, 25, 8, 33048 }, // ̕
-    { 6, 7, 4, -3, 19, 11, 33056 }, // ̛
-    { 4, 5, 3, -2, -2, 5, 33067 }, // ̣
-    { 10, 5, 6, -5, -2, 13, 33072 }, // ̤
-    { 8, 7, 5, -4, -1, 14, 33085 }, // ̥
-    { 6, 7, 4, -3, -1, 11, 33099 }, // ̦
-    { 6, 7, 4, -3, -1, 11, 33110 }, // ̧
-    { 6, 8, 4, -3, 1, 12, 33121 }, // ̨
-    { 5, 7, 8, -1, -1, 9, 33133 }, // ̩
-    { 11, 6, 6, -6, -2, 17, 33142 }, // ̭
-    { 10, 6, 6, -5, -1, 15, 33159 }, // ̮
-    { 10, 5, 6, -5, -2, 13, 33174 }, // ̰
-    { 10, 3, 6, -5, -3, 8, 33187 }, // ̱
-    { 10, 6, 6, -5, 23, 15, 33195 }, // ͂
-    { 11, 11, 6, -6, 29, 31, 33210 }, // ̈́
-    { 6, 5, 5, -2, -2, 8, 33241 }, // ͅ
-    { 22, 21, 21, -2, 21, 116, 33249 }, // Α
-    { 18, 22, 18, -1, 21, 99, 33365 }, // Β
-    { 19, 21, 19, -1, 21, 100, 33464 }, // Γ
-    { 17, 21, 20, 0, 21, 90, 33564 }, // Δ
-    { 19, 21, 19, -1, 21, 100, 33654 }, // Ε
-    { 18, 22, 18, -1, 21, 99, 33754 }, // Ζ
-    { 25, 21, 25, -1, 21, 132, 33853 }, // Η
-    { 20, 22, 22, 1, 21, 110, 33985 }, // Θ
-    { 13, 21, 13, -1, 21, 69, 34095 }, // Ι
-    { 23, 22, 23, -1, 21, 127, 34164 }, // Κ
-    { 22, 21, 21, -2, 21, 116, 34291 }, // Λ
-    { 28, 21, 27, -2, 21, 147, 34407 }, // Μ
-    { 25, 22, 25, -1, 21, 138, 34554 }, // Ν
-    { 19, 21, 19, -1, 21, 100, 34692 }, // Ξ
-    { 20, 22, 22, 1, 21, 110, 34792 }, // Ο
-    { 24, 21, 24, -1, 21, 126, 34902 }, // Π
-    { 18, 21, 18, -1, 21, 95, 35028 }, // Ρ
-    { 19, 22, 19, -1, 21, 105, 35123 }, // Σ
-    { 18, 21, 21, 2, 21, 95, 35228 }, // Τ
-    { 19, 21, 21, 1, 21, 100, 35323 }, // Υ
-    { 21, 22, 22, 0, 21, 116, 35423 }, // Φ
-    { 24, 21, 22, -3, 21, 126, 35539 }, // Χ
-    { 22, 21, 25, 2, 21, 116, 35665 }, // Ψ
-    { 23, 21, 23, -1, 21, 121, 35781 }, // Ω
-    { 17, 17, 19, 1, 16, 73, 35902 }, // α
-    { 15, 30, 16, 0, 23, 113, 35975 }, // β
-    { 15, 23, 16, 0, 16, 87, 36088 }, // γ
-    { 15, 24, 17, 1, 23, 90, 36175 }, // δ
-    { 12, 17, 14, 1, 16, 51, 36265 }, // ε
-    { 12, 30, 14, 1, 24, 90, 36316 }, // ζ
-    { 14, 23, 17, 1, 16, 81, 36406 }, // η
-    { 16, 24, 18, 1, 23, 96, 36487 }, // θ
-    { 7, 17, 9, 1, 16, 30, 36583 }, // ι
-    { 16, 17, 18, 1, 16, 68, 36613 }, // κ
-    { 16, 24, 16, -1, 23, 96, 36681 }, // λ
-    { 19, 24, 19, -1, 16, 114, 36777 }, // μ
-    { 15, 17, 16, 0, 16, 64, 36891 }, // ν
-    { 12, 30, 14, 1, 24, 90, 36955 }, // ξ
-    { 14, 17, 16, 1, 16, 60, 37045 }, // ο
-    { 18, 17, 19, 0, 16, 77, 37105 }, // π
-    { 16, 23, 16, -1, 16, 92, 37182 }, // ρ
-    { 11, 22, 13, 1, 16, 61, 37274 }, // ς
-    { 17, 17, 19, 1, 16, 73, 37335 }, // σ
-    { 14, 17, 16, 1, 16, 60, 37408 }, // τ
-    { 15, 17, 17, 1, 16, 64, 37468 }, // υ
-    { 19, 23, 21, 1, 16, 110, 37532 }, // φ
-    { 18, 23, 17, -2, 16, 104, 37642 }, // χ
-    { 20, 28, 22, 1, 21, 140, 37746 }, // ψ
-    { 19, 17, 21, 1, 16, 81, 37886 }, // ω
-    { 22, 28, 21, -2, 21, 154, 37967 }, // Ạ
-    { 16, 23, 18, 1, 16, 92, 38121 }, // ạ
-    { 22, 30, 21, -2, 30, 165, 38213 }, // Ả
-    { 16, 27, 18, 1, 26, 108, 38378 }, // ả
-    { 24, 31, 23, -2, 31, 186, 38486 }, // Ấ
-    { 18, 29, 20, 1, 28, 131, 38672 }, // ấ
-    { 22, 31, 21, -2, 31, 171, 38803 }, // Ầ
-    { 16, 29, 18, 1, 28, 116, 38974 }, // ầ
-    { 23, 31, 22, -2, 31, 179, 39090 }, // Ẩ
-    { 19, 29, 21, 1, 28, 138, 39269 }, // ẩ
-    { 22, 31, 21, -2, 31, 171, 39407 }, // Ẫ
-    { 16, 28, 18, 1, 27, 112, 39578 }, // ẫ
-    { 22, 35, 21, -2, 28, 193, 39690 }, // Ậ
-    { 16, 31, 18, 1, 24, 124, 39883 }, // ậ
-    { 22, 31, 21, -2, 31, 171, 40007 }, // Ắ
-    { 16, 29, 18, 1, 28, 116, 40178 }, // ắ
-    { 22, 31, 21, -2, 31, 171, 40294 }, // Ằ
-    { 16, 29, 18, 1, 28, 116, 40465 }, // ằ
-    { 22, 31, 21, -2, 31, 171, 40581 }, // Ẳ
-    { 16, 30, 18, 1, 29, 120, 40752 }, // ẳ
-    { 22, 31, 21, -2, 31, 171, 40872 }, // Ẵ
-    { 16, 28, 18, 1, 27, 112, 41043 }, // ẵ
-    { 22, 35, 21, -2, 28, 193, 41155 }, // Ặ
-    { 16, 30, 18, 1, 23, 120, 41348 }, // ặ
-    { 19, 28, 19, -1, 21, 133, 41468 }, // Ẹ
-    { 12, 23, 14, 1, 16, 69, 41601 }, // ẹ
-    { 19, 30, 19, -1, 30, 143, 41670 }, // Ẻ
-    { 13, 27, 15, 1, 26, 88, 41813 }, // ẻ
-    { 19, 28, 19, -1, 28, 133, 41901 }, // Ẽ
-    { 14, 24, 16, 1, 23, 84, 42034 }, // ẽ
-    { 22, 31, 22, -1, 31, 171, 42118 }, // Ế
-    { 17, 29, 19, 1, 28, 124, 42289 }, // ế
-    { 19, 31, 19, -1, 31, 148, 42413 }, // Ề
-    { 14, 29, 16, 1, 28, 102, 42561 }, // ề
-    { 22, 31, 22, -1, 31, 171, 42663 }, // Ể
-    { 18, 29, 20, 1, 28, 131, 42834 }, // ể
-    { 19, 31, 19, -1, 31, 148, 42965 }, // Ễ
-    { 14, 28, 16, 1, 27, 98, 43113 }, // ễ
-    { 19, 35, 19, -1, 28, 167, 43211 }, // Ệ
-    { 13, 31, 15, 1, 24, 101, 43378 }, // ệ
-    { 14, 30, 14, -1, 30, 105, 43479 }, // Ỉ
-    { 10, 27, 12, 1, 26, 68, 43584 }, // ỉ
-    { 13, 28, 13, -1, 21, 91, 43652 }, // Ị
-    { 10, 30, 11, 0, 23, 75, 43743 }, // ị
-    { 20, 28, 22, 1, 21, 140, 43818 }, // Ọ
-    { 14, 23, 16, 1, 16, 81, 43958 }, // ọ
-    { 20, 31, 22, 1, 30, 155, 44039 }, // Ỏ
-    { 14, 27, 16, 1, 26, 95, 44194 }, // ỏ
-    { 21, 32, 23, 1, 31, 168, 44289 }, // Ố
-    { 18, 29, 20, 1, 28, 131, 44457 }, // ố
-    { 20, 32, 22, 1, 31, 160, 44588 }, // Ồ
-    { 15, 29, 17, 1, 28, 109, 44748 }, // ồ
-    { 21, 32, 23, 1, 31, 168, 44857 }, // Ổ
-    { 19, 29, 21, 1, 28, 138, 45025 }, // ổ
-    { 20, 32, 22, 1, 31, 160, 45163 }, // Ỗ
-    { 15, 28, 17, 1, 27, 105, 45323 }, // ỗ
-    { 20, 35, 22, 1, 28, 175, 45428 }, // Ộ
-    { 14, 31, 16, 1, 24, 109, 45603 }, // ộ
-    { 23, 29, 25, 1, 28, 167, 45712 }, // Ớ
-    { 17, 25, 19, 1, 24, 107, 45879 }, // ớ
-    { 23, 29, 25, 1, 28, 167, 45986 }, // Ờ
-    { 17, 25, 19, 1, 24, 107, 46153 }, // ờ
-    { 23, 31, 25, 1, 30, 179, 46260 }, // Ở
-    { 17, 27, 19, 1, 26, 115, 46439 }, // ở
-    { 23, 29, 25, 1, 28, 167, 46554 }, // Ỡ
-    { 17, 24, 19, 1, 23, 102, 46721 }, // ỡ
-    { 23, 31, 25, 1, 24, 179, 46823 }, // Ợ
-    { 17, 26, 19, 1, 19, 111, 47002 }, // ợ
-    { 22, 28, 25, 2, 21, 154, 47113 }, // Ụ
-    { 16, 23, 18, 1, 16, 92, 47267 }, // ụ
-    { 22, 31, 25, 2, 30, 171, 47359 }, // Ủ
-    { 16, 27, 18, 1, 26, 108, 47530 }, // ủ
-    { 23, 29, 26, 2, 28, 167, 47638 }, // Ứ
-    { 19, 25, 21, 1, 24, 119, 47805 }, // ứ
-    { 23, 29, 26, 2, 28, 167, 47924 }, // Ừ
-    { 19, 25, 21, 1, 24, 119, 48091 }, // ừ
-    { 23, 31, 26, 2, 30, 179, 48210 }, // Ử
-    { 19, 27, 21, 1, 26, 129, 48389 }, // ử
-    { 23, 29, 26, 2, 28, 167, 48518 }, // Ữ
-    { 19, 24, 21, 1, 23, 114, 48685 }, // ữ
-    { 23, 31, 26, 2, 24, 179, 48799 }, // Ự
-    { 19, 26, 21, 1, 19, 124, 48978 }, // ự
-    { 20, 28, 22, 1, 28, 140, 49102 }, // Ỳ
-    { 18, 31, 16, -3, 24, 140, 49242 }, // ỳ
-    { 20, 28, 22, 1, 21, 140, 49382 }, // Ỵ
-    { 18, 23, 16, -3, 16, 104, 49522 }, // ỵ
-    { 20, 30, 22, 1, 30, 150, 49626 }, // Ỷ
-    { 18, 33, 16, -3, 26, 149, 49776 }, // ỷ
-    { 20, 28, 22, 1, 28, 140, 49925 }, // Ỹ
-    { 18, 30, 16, -3, 23, 135, 50065 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 50200 }, //  
-    { 0, 0, 29, 0, 0, 0, 50200 }, //  
-    { 0, 0, 15, 0, 0, 0, 50200 }, //  
-    { 0, 0, 29, 0, 0, 0, 50200 }, //  
-    { 0, 0, 10, 0, 0, 0, 50200 }, //  
-    { 0, 0, 7, 0, 0, 0, 50200 }, //  
-    { 0, 0, 5, 0, 0, 0, 50200 }, //  
-    { 0, 0, 18, 0, 0, 0, 50200 }, //  
-    { 0, 0, 8, 0, 0, 0, 50200 }, //  
-    { 0, 0, 6, 0, 0, 0, 50200 }, //  
-    { 0, 0, 1, 0, 0, 0, 50200 }, //  
-    { 0, 0, 1, 0, 0, 0, 50200 }, // ​
-    { 2, 24, 2, -1, 17, 12, 50200 }, // ‌
-    { 6, 26, 4, -3, 19, 39, 50212 }, // ‍
-    { 10, 28, 6, -5, 21, 70, 50251 }, // ‎
-    { 10, 28, 6, -5, 21, 70, 50321 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 50391 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 50398 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 50405 }, // ‒
-    { 15, 3, 16, 0, 9, 12, 50416 }, // –
-    { 29, 3, 30, 0, 9, 22, 50428 }, // —
-    { 29, 3, 30, 0, 9, 22, 50450 }, // ―
-    { 10, 30, 15, 2, 23, 75, 50472 }, // ‖
-    { 15, 7, 16, 0, -1, 27, 50547 }, // ‗
-    { 7, 10, 10, 2, 22, 18, 50574 }, // ‘
-    { 6, 9, 9, 2, 22, 14, 50592 }, // ’
-    { 6, 10, 9, 1, 4, 15, 50606 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 50621 }, // ‛
-    { 12, 10, 15, 2, 22, 30, 50634 }, // “
-    { 12, 10, 15, 2, 22, 30, 50664 }, // ”
-    { 12, 10, 15, 1, 4, 30, 50694 }, // „
-    { 11, 10, 13, 1, 22, 28, 50724 }, // ‟
-    { 13, 19, 15, 1, 21, 62, 50752 }, // †
-    { 14, 23, 15, 0, 21, 81, 50814 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 50895 }, // •
-    { 10, 10, 18, 4, 15, 25, 50908 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 50933 }, // ․
-    { 12, 5, 15, 1, 4, 15, 50941 }, // ‥
-    { 24, 5, 29, 2, 4, 30, 50956 }, // …
-    { 6, 4, 8, 1, 10, 6, 50986 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 50992 }, //  
-    { 0, 0, 1, 0, 0, 0, 50992 }, //  
-    { 10, 28, 6, -5, 21, 70, 50992 }, // ‪
-    { 10, 28, 6, -5, 21, 70, 51062 }, // ‫
-    { 10, 27, 6, -5, 20, 68, 51132 }, // ‬
-    { 12, 28, 7, -6, 21, 84, 51200 }, // ‭
-    { 12, 28, 7, -6, 21, 84, 51284 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 51368 }, //  
-    { 36, 24, 40, 2, 22, 216, 51368 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 51584 }, // ′
-    { 12, 10, 14, 1, 21, 30, 51599 }, // ″
-    { 17, 10, 19, 1, 21, 43, 51629 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 51672 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 51687 }, // ‶
-    { 19, 10, 21, 1, 21, 48, 51717 }, // ‷
-    { 13, 6, 15, 1, 0, 20, 51765 }, // ‸
-    { 8, 11, 10, 1, 13, 22, 51785 }, // ‹
-    { 9, 11, 10, 0, 13, 25, 51807 }, // ›
-    { 18, 20, 19, 0, 19, 90, 51832 }, // ※
-    { 16, 23, 18, 1, 22, 92, 51922 }, // ‼
-    { 15, 3, 16, 0, 24, 12, 52014 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 52026 }, // ⁃
-    { 18, 24, 13, -6, 22, 108, 52032 }, // ⁄
-    { 21, 22, 24, 2, 21, 116, 52140 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 52256 }, // ⁈
-    { 20, 23, 22, 1, 22, 115, 52366 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 52481 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 52503 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 52561 }, //  
-    { 0, 0, 1, 0, 0, 0, 52561 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 52561 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 52561 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 52561 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 52561 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 52561 }, // ⁰
-    { 12, 14, 13, 0, 24, 42, 52600 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 52642 }, // ⁵
-    { 12, 14, 14, 1, 24, 42, 52681 }, // ⁶
-    { 10, 14, 14, 3, 24, 35, 52723 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 52758 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 52797 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 52839 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 52870 }, // ₀
-    { 8, 14, 13, 2, 10, 28, 52912 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 52940 }, // ₂
-    { 10, 15, 13, 1, 10, 38, 52979 }, // ₃
-    { 12, 14, 13, 0, 10, 42, 53017 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 53059 }, // ₅
-    { 12, 15, 14, 1, 10, 45, 53098 }, // ₆
-    { 10, 14, 14, 3, 9, 35, 53143 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 53178 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 53220 }, // ₉
-    { 18, 20, 19, 0, 20, 90, 53265 }, // ₣
-    { 19, 22, 19, -1, 21, 105, 53355 }, // ₤
-    { 35, 22, 36, 0, 21, 193, 53460 }, // ₧
-    { 20, 22, 20, -1, 21, 110, 53653 }, // €
-    { 17, 12, 29, 6, 16, 51, 53763 }, // ←
-    { 13, 20, 29, 8, 20, 65, 53814 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 53879 }, // →
-    { 13, 20, 29, 8, 20, 65, 53930 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 53995 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 54049 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 54114 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 54179 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 54244 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 54309 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 54369 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 54429 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 54488 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 54548 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 54607 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 54674 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 54779 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 54863 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 54932 }, // ∅
-    { 19, 21, 20, 0, 21, 100, 55070 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 55170 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 55275 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 55375 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 55499 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 55575 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 55675 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 55799 }, // ∍
-    { 22, 26, 24, 1, 21, 143, 55875 }, // ∏
-    { 18, 26, 19, 0, 21, 117, 56018 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 56135 }, // −
-    { 17, 23, 17, -1, 21, 98, 56145 }, // ∕
-    { 11, 23, 14, 2, 21, 64, 56243 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 56307 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 56356 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 56381 }, // ∙
-    { 18, 28, 19, 0, 24, 126, 56387 }, // √
-    { 14, 11, 18, 2, 15, 39, 56513 }, // ∝
-    { 18, 10, 19, 0, 14, 45, 56552 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 56597 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 56697 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 56808 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 56838 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 56906 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 57006 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 57106 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 57196 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 57290 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 57410 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 57491 }, // ∵
-    { 6, 16, 9, 1, 18, 24, 57572 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 57596 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 57677 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 57699 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 57763 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 57798 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 57841 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 57884 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 57940 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 58003 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 58066 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 58147 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 58228 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 58304 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 58428 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 58552 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 58652 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 58752 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 58868 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 58984 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 59100 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 59216 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 59306 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 59314 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 59346 }, // �
+    { 9, 23, 11, 1, 22, 33, 0 }, // !
+    { 10, 9, 12, 1, 21, 28, 33 }, // "
+    { 18, 19, 19, 0, 17, 69, 61 }, // #
+    { 16, 30, 18, 1, 24, 92, 130 }, // $
+    { 25, 24, 28, 2, 22, 114, 222 }, // %
+    { 23, 24, 26, 2, 22, 98, 336 }, // &
+    { 5, 9, 7, 1, 21, 14, 434 }, // '
+    { 13, 30, 15, 1, 24, 58, 448 }, // (
+    { 12, 30, 11, -2, 24, 57, 506 }, // )
+    { 10, 11, 12, 1, 22, 25, 563 }, // *
+    { 13, 14, 18, 3, 17, 22, 588 }, // +
+    { 7, 9, 9, -1, 4, 16, 610 }, // ,
+    { 9, 3, 11, 1, 9, 8, 626 }, // -
+    { 5, 5, 9, 1, 4, 8, 634 }, // .
+    { 17, 23, 17, -1, 21, 48, 642 }, // /
+    { 18, 22, 19, 0, 21, 64, 690 }, // 0
+    { 12, 21, 18, 2, 21, 40, 754 }, // 1
+    { 17, 21, 18, 0, 21, 54, 794 }, // 2
+    { 16, 22, 18, 0, 21, 54, 848 }, // 3
+    { 17, 21, 18, 0, 21, 52, 902 }, // 4
+    { 16, 21, 18, 1, 20, 49, 954 }, // 5
+    { 17, 22, 19, 1, 21, 55, 1003 }, // 6
+    { 16, 21, 20, 3, 20, 49, 1058 }, // 7
+    { 16, 22, 18, 1, 21, 64, 1107 }, // 8
+    { 17, 22, 18, 0, 21, 59, 1171 }, // 9
+    { 8, 16, 10, 1, 15, 18, 1230 }, // :
+    { 10, 20, 10, -1, 15, 27, 1248 }, // ;
+    { 14, 14, 18, 2, 17, 29, 1275 }, // <
+    { 13, 8, 18, 3, 14, 32, 1304 }, // =
+    { 14, 14, 18, 2, 17, 29, 1336 }, // >
+    { 10, 22, 13, 2, 21, 38, 1365 }, // ?
+    { 27, 26, 29, 1, 20, 137, 1403 }, // @
+    { 22, 21, 21, -2, 21, 74, 1540 }, // A
+    { 18, 22, 18, -1, 21, 69, 1614 }, // B
+    { 18, 22, 20, 1, 21, 61, 1683 }, // C
+    { 21, 22, 21, -1, 21, 75, 1744 }, // D
+    { 19, 21, 19, -1, 21, 58, 1819 }, // E
+    { 18, 21, 18, -1, 21, 50, 1877 }, // F
+    { 19, 22, 21, 1, 21, 71, 1927 }, // G
+    { 25, 21, 25, -1, 21, 91, 1998 }, // H
+    { 13, 21, 13, -1, 21, 44, 2089 }, // I
+    { 17, 27, 13, -5, 21, 60, 2133 }, // J
+    { 23, 22, 23, -1, 21, 77, 2193 }, // K
+    { 17, 21, 17, -1, 21, 52, 2270 }, // L
+    { 28, 21, 27, -2, 21, 109, 2322 }, // M
+    { 25, 22, 25, -1, 21, 88, 2431 }, // N
+    { 20, 22, 22, 1, 21, 73, 2519 }, // O
+    { 18, 21, 18, -1, 21, 60, 2592 }, // P
+    { 24, 28, 26, 1, 21, 94, 2652 }, // Q
+    { 19, 22, 19, -1, 21, 72, 2746 }, // R
+    { 15, 22, 16, 0, 21, 59, 2818 }, // S
+    { 18, 21, 21, 2, 21, 55, 2877 }, // T
+    { 22, 22, 25, 2, 21, 75, 2932 }, // U
+    { 21, 22, 24, 2, 21, 69, 3007 }, // V
+    { 30, 22, 33, 2, 21, 111, 3076 }, // W
+    { 24, 21, 22, -3, 21, 74, 3187 }, // X
+    { 20, 21, 22, 1, 21, 59, 3261 }, // Y
+    { 18, 22, 18, -1, 21, 57, 3320 }, // Z
+    { 12, 28, 12, -1, 23, 56, 3377 }, // [
+    { 12, 23, 14, 1, 21, 45, 3433 }, // <backslash>
+    { 12, 28, 12, -1, 23, 56, 3478 }, // ]
+    { 14, 14, 18, 2, 19, 38, 3534 }, // ^
+    { 15, 3, 16, 0, -1, 18, 3572 }, // _
+    { 6, 8, 18, 6, 24, 10, 3590 }, // `
+    { 16, 17, 18, 1, 16, 58, 3600 }, // a
+    { 15, 24, 16, 0, 23, 68, 3658 }, // b
+    { 12, 17, 14, 1, 16, 34, 3726 }, // c
+    { 16, 24, 18, 1, 23, 74, 3760 }, // d
+    { 12, 17, 14, 1, 16, 45, 3834 }, // e
+    { 20, 30, 16, -5, 23, 76, 3879 }, // f
+    { 19, 23, 17, -3, 16, 71, 3955 }, // g
+    { 17, 24, 18, 0, 23, 71, 4026 }, // h
+    { 9, 24, 11, 1, 23, 36, 4097 }, // i
+    { 15, 30, 10, -6, 23, 59, 4133 }, // j
+    { 14, 24, 16, 1, 23, 67, 4192 }, // k
+    { 8, 24, 10, 1, 23, 41, 4259 }, // l
+    { 24, 17, 26, 1, 16, 87, 4300 }, // m
+    { 16, 17, 18, 1, 16, 59, 4387 }, // n
+    { 14, 17, 16, 1, 16, 47, 4446 }, // o
+    { 18, 23, 17, -2, 16, 71, 4493 }, // p
+    { 15, 23, 17, 1, 16, 68, 4564 }, // q
+    { 12, 16, 14, 1, 16, 34, 4632 }, // r
+    { 12, 17, 13, 0, 16, 36, 4666 }, // s
+    { 12, 20, 13, 0, 19, 41, 4702 }, // t
+    { 16, 17, 18, 1, 16, 56, 4743 }, // u
+    { 15, 17, 16, 0, 16, 44, 4799 }, // v
+    { 22, 17, 23, 0, 16, 70, 4843 }, // w
+    { 18, 17, 18, -1, 16, 53, 4913 }, // x
+    { 18, 23, 16, -3, 16, 70, 4966 }, // y
+    { 14, 17, 15, 0, 16, 48, 5036 }, // z
+    { 12, 29, 14, 1, 24, 55, 5084 }, // {
+    { 8, 27, 9, 0, 23, 41, 5139 }, // |
+    { 11, 29, 11, -1, 24, 47, 5180 }, // }
+    { 14, 6, 18, 2, 13, 18, 5227 }, // ~
+    { 0, 0, 6, 0, 0, 0, 5245 }, //  
+    { 9, 23, 9, -1, 16, 32, 5245 }, // ¡
+    { 14, 29, 18, 2, 23, 77, 5277 }, // ¢
+    { 19, 22, 19, -1, 21, 65, 5354 }, // £
+    { 18, 14, 19, 0, 17, 51, 5419 }, // ¤
+    { 19, 20, 21, 1, 20, 66, 5470 }, // ¥
+    { 8, 27, 9, 0, 23, 35, 5536 }, // ¦
+    { 13, 23, 14, 0, 20, 72, 5571 }, // §
+    { 10, 4, 18, 4, 22, 14, 5643 }, // ¨
+    { 22, 22, 23, 0, 21, 104, 5657 }, // ©
+    { 11, 14, 13, 1, 21, 40, 5761 }, // ª
+    { 14, 11, 16, 1, 13, 31, 5801 }, // «
+    { 13, 8, 18, 3, 14, 12, 5832 }, // ¬
+    { 9, 3, 11, 1, 9, 8, 5844 }, // ­
+    { 17, 16, 18, 0, 23, 72, 5852 }, // ®
+    { 10, 3, 18, 4, 21, 12, 5924 }, // ¯
+    { 11, 11, 15, 2, 21, 23, 5936 }, // °
+    { 13, 17, 18, 3, 17, 34, 5959 }, // ±
+    { 11, 14, 13, 1, 24, 28, 5993 }, // ²
+    { 10, 14, 13, 1, 24, 34, 6021 }, // ³
+    { 6, 7, 18, 6, 24, 12, 6055 }, // ´
+    { 19, 24, 19, -1, 16, 68, 6067 }, // µ
+    { 19, 26, 19, -1, 21, 84, 6135 }, // ¶
+    { 5, 5, 9, 2, 10, 7, 6219 }, // ·
+    { 6, 7, 18, 6, -1, 13, 6226 }, // ¸
+    { 8, 14, 13, 2, 24, 24, 6239 }, // ¹
+    { 11, 14, 13, 1, 21, 35, 6263 }, // º
+    { 14, 11, 15, 0, 13, 32, 6298 }, // »
+    { 28, 24, 31, 2, 22, 102, 6330 }, // ¼
+    { 28, 24, 31, 2, 22, 101, 6432 }, // ½
+    { 29, 24, 31, 1, 22, 108, 6533 }, // ¾
+    { 10, 22, 12, 0, 16, 38, 6641 }, // ¿
+    { 22, 28, 21, -2, 28, 91, 6679 }, // À
+    { 22, 28, 21, -2, 28, 90, 6770 }, // Á
+    { 22, 28, 21, -2, 28, 92, 6860 }, // Â
+    { 22, 28, 21, -2, 28, 93, 6952 }, // Ã
+    { 22, 27, 21, -2, 27, 92, 7045 }, // Ä
+    { 22, 29, 21, -2, 29, 99, 7137 }, // Å
+    { 29, 21, 27, -3, 21, 91, 7236 }, // Æ
+    { 18, 29, 20, 1, 21, 75, 7327 }, // Ç
+    { 19, 28, 19, -1, 28, 72, 7402 }, // È
+    { 19, 28, 19, -1, 28, 73, 7474 }, // É
+    { 19, 28, 19, -1, 28, 76, 7547 }, // Ê
+    { 19, 27, 19, -1, 27, 74, 7623 }, // Ë
+    { 13, 28, 13, -1, 28, 54, 7697 }, // Ì
+    { 14, 28, 14, -1, 28, 58, 7751 }, // Í
+    { 15, 28, 15, -1, 28, 63, 7809 }, // Î
+    { 15, 27, 15, -1, 27, 58, 7872 }, // Ï
+    { 21, 22, 21, -1, 21, 76, 7930 }, // Ð
+    { 25, 29, 25, -1, 28, 108, 8006 }, // Ñ
+    { 20, 29, 22, 1, 28, 88, 8114 }, // Ò
+    { 20, 29, 22, 1, 28, 88, 8202 }, // Ó
+    { 20, 29, 22, 1, 28, 91, 8290 }, // Ô
+    { 20, 29, 22, 1, 28, 90, 8381 }, // Õ
+    { 20, 28, 22, 1, 27, 88, 8471 }, // Ö
+    { 12, 12, 18, 3, 16, 27, 8559 }, // ×
+    { 23, 22, 23, -1, 21, 87, 8586 }, // Ø
+    { 22, 29, 25, 2, 28, 92, 8673 }, // Ù
+    { 22, 29, 25, 2, 28, 91, 8765 }, // Ú
+    { 22, 29, 25, 2, 28, 94, 8856 }, // Û
+    { 22, 28, 25, 2, 27, 91, 8950 }, // Ü
+    { 20, 28, 22, 1, 28, 74, 9041 }, // Ý
+    { 18, 21, 18, -1, 21, 57, 9115 }, // Þ
+    { 23, 30, 19, -5, 23, 105, 9172 }, // ß
+    { 16, 25, 18, 1, 24, 71, 9277 }, // à
+    { 16, 25, 18, 1, 24, 73, 9348 }, // á
+    { 16, 25, 18, 1, 24, 75, 9421 }, // â
+    { 16, 24, 18, 1, 23, 74, 9496 }, // ã
+    { 16, 23, 18, 1, 22, 73, 9570 }, // ä
+    { 16, 25, 18, 1, 24, 81, 9643 }, // å
+    { 21, 17, 23, 1, 16, 73, 9724 }, // æ
+    { 12, 24, 14, 1, 16, 49, 9797 }, // ç
+    { 12, 25, 14, 1, 24, 58, 9846 }, // è
+    { 13, 25, 15, 1, 24, 60, 9904 }, // é
+    { 13, 25, 15, 1, 24, 63, 9964 }, // ê
+    { 14, 23, 16, 1, 22, 61, 10027 }, // ë
+    { 8, 25, 10, 1, 24, 41, 10088 }, // ì
+    { 11, 25, 13, 1, 24, 40, 10129 }, // í
+    { 11, 25, 13, 1, 24, 46, 10169 }, // î
+    { 11, 23, 13, 1, 22, 42, 10215 }, // ï
+    { 15, 25, 16, 0, 24, 66, 10257 }, // ð
+    { 16, 24, 18, 1, 23, 75, 10323 }, // ñ
+    { 14, 25, 16, 1, 24, 60, 10398 }, // ò
+    { 14, 25, 16, 1, 24, 62, 10458 }, // ó
+    { 14, 25, 16, 1, 24, 64, 10520 }, // ô
+    { 15, 24, 17, 1, 23, 65, 10584 }, // õ
+    { 15, 23, 17, 1, 22, 64, 10649 }, // ö
+    { 13, 14, 18, 3, 17, 24, 10713 }, // ÷
+    { 19, 17, 18, -2, 16, 58, 10737 }, // ø
+    { 16, 25, 18, 1, 24, 71, 10795 }, // ù
+    { 16, 25, 18, 1, 24, 73, 10866 }, // ú
+    { 16, 25, 18, 1, 24, 75, 10939 }, // û
+    { 16, 23, 18, 1, 22, 72, 11014 }, // ü
+    { 18, 31, 16, -3, 24, 87, 11086 }, // ý
+    { 18, 30, 16, -3, 23, 85, 11173 }, // þ
+    { 18, 29, 16, -3, 22, 87, 11258 }, // ÿ
+    { 22, 26, 21, -2, 26, 89, 11345 }, // Ā
+    { 16, 22, 18, 1, 21, 71, 11434 }, // ā
+    { 22, 28, 21, -2, 28, 93, 11505 }, // Ă
+    { 16, 24, 18, 1, 23, 73, 11598 }, // ă
+    { 22, 28, 21, -2, 21, 90, 11671 }, // Ą
+    { 16, 23, 18, 1, 16, 70, 11761 }, // ą
+    { 18, 29, 20, 1, 28, 75, 11831 }, // Ć
+    { 13, 25, 15, 1, 24, 49, 11906 }, // ć
+    { 18, 29, 20, 1, 28, 79, 11955 }, // Ĉ
+    { 13, 25, 15, 1, 24, 52, 12034 }, // ĉ
+    { 18, 29, 20, 1, 28, 73, 12086 }, // Ċ
+    { 12, 23, 14, 1, 22, 43, 12159 }, // ċ
+    { 18, 29, 20, 1, 28, 79, 12202 }, // Č
+    { 14, 25, 16, 1, 24, 55, 12281 }, // č
+    { 21, 29, 21, -1, 28, 96, 12336 }, // Ď
+    { 21, 26, 23, 1, 25, 93, 12432 }, // ď
+    { 21, 22, 21, -1, 21, 76, 12525 }, // Đ
+    { 18, 24, 20, 1, 23, 77, 12601 }, // đ
+    { 19, 26, 19, -1, 26, 73, 12678 }, // Ē
+    { 13, 22, 15, 1, 21, 59, 12751 }, // ē
+    { 19, 28, 19, -1, 28, 75, 12810 }, // Ĕ
+    { 14, 24, 16, 1, 23, 61, 12885 }, // ĕ
+    { 19, 28, 19, -1, 28, 70, 12946 }, // Ė
+    { 12, 23, 14, 1, 22, 54, 13016 }, // ė
+    { 19, 28, 19, -1, 21, 72, 13070 }, // Ę
+    { 12, 23, 14, 1, 16, 56, 13142 }, // ę
+    { 19, 28, 19, -1, 28, 76, 13198 }, // Ě
+    { 14, 25, 16, 1, 24, 65, 13274 }, // ě
+    { 19, 29, 21, 1, 28, 91, 13339 }, // Ĝ
+    { 19, 31, 17, -3, 24, 91, 13430 }, // ĝ
+    { 19, 29, 21, 1, 28, 88, 13521 }, // Ğ
+    { 19, 30, 17, -3, 23, 88, 13609 }, // ğ
+    { 19, 29, 21, 1, 28, 83, 13697 }, // Ġ
+    { 19, 29, 17, -3, 22, 82, 13780 }, // ġ
+    { 19, 29, 21, 1, 21, 84, 13862 }, // Ģ
+    { 19, 32, 17, -3, 25, 88, 13946 }, // ģ
+    { 25, 28, 25, -1, 28, 112, 14034 }, // Ĥ
+    { 17, 31, 18, 0, 30, 89, 14146 }, // ĥ
+    { 25, 21, 25, -1, 21, 90, 14235 }, // Ħ
+    { 17, 24, 18, 0, 23, 74, 14325 }, // ħ
+    { 14, 28, 14, -1, 28, 60, 14399 }, // Ĩ
+    { 11, 24, 13, 1, 23, 45, 14459 }, // ĩ
+    { 14, 26, 14, -1, 26, 58, 14504 }, // Ī
+    { 11, 22, 13, 1, 21, 42, 14562 }, // ī
+    { 15, 28, 15, -1, 28, 59, 14604 }, // Ĭ
+    { 11, 24, 13, 1, 23, 43, 14663 }, // ĭ
+    { 13, 28, 13, -1, 21, 56, 14706 }, // Į
+    { 9, 30, 11, 1, 23, 45, 14762 }, // į
+    { 13, 28, 13, -1, 28, 54, 14807 }, // İ
+    { 8, 17, 10, 1, 16, 29, 14861 }, // ı
+    { 24, 27, 24, -1, 21, 94, 14890 }, // Ĳ
+    { 18, 30, 20, 1, 23, 86, 14984 }, // ĳ
+    { 19, 34, 15, -5, 28, 80, 15070 }, // Ĵ
+    { 17, 31, 12, -6, 24, 69, 15150 }, // ĵ
+    { 23, 29, 23, -1, 21, 94, 15219 }, // Ķ
+    { 14, 31, 16, 1, 23, 83, 15313 }, // ķ
+    { 15, 17, 17, 1, 16, 52, 15396 }, // ĸ
+    { 17, 28, 17, -1, 28, 66, 15448 }, // Ĺ
+    { 10, 31, 12, 1, 30, 52, 15514 }, // ĺ
+    { 17, 29, 17, -1, 21, 67, 15566 }, // Ļ
+    { 10, 31, 10, -1, 23, 50, 15633 }, // ļ
+    { 18, 23, 18, -1, 23, 62, 15683 }, // Ľ
+    { 13, 26, 15, 1, 25, 59, 15745 }, // ľ
+    { 18, 21, 18, -1, 21, 57, 15804 }, // Ŀ
+    { 12, 24, 14, 1, 23, 52, 15861 }, // ŀ
+    { 17, 21, 17, -1, 21, 57, 15913 }, // Ł
+    { 11, 24, 11, -1, 23, 45, 15970 }, // ł
+    { 25, 29, 25, -1, 28, 107, 16015 }, // Ń
+    { 16, 25, 18, 1, 24, 74, 16122 }, // ń
+    { 25, 29, 25, -1, 21, 105, 16196 }, // Ņ
+    { 16, 24, 18, 1, 16, 72, 16301 }, // ņ
+    { 25, 29, 25, -1, 28, 110, 16373 }, // Ň
+    { 16, 25, 18, 1, 24, 77, 16483 }, // ň
+    { 21, 23, 24, 2, 22, 83, 16560 }, // ŉ
+    { 25, 27, 25, -1, 21, 105, 16643 }, // Ŋ
+    { 15, 23, 17, 1, 16, 69, 16748 }, // ŋ
+    { 20, 27, 22, 1, 26, 87, 16817 }, // Ō
+    { 15, 22, 17, 1, 21, 61, 16904 }, // ō
+    { 20, 29, 22, 1, 28, 89, 16965 }, // Ŏ
+    { 15, 24, 17, 1, 23, 63, 17054 }, // ŏ
+    { 21, 30, 23, 1, 29, 97, 17117 }, // Ő
+    { 16, 25, 18, 1, 24, 68, 17214 }, // ő
+    { 27, 22, 29, 1, 21, 92, 17282 }, // Œ
+    { 22, 17, 24, 1, 16, 74, 17374 }, // œ
+    { 19, 29, 19, -1, 28, 86, 17448 }, // Ŕ
+    { 13, 24, 15, 1, 24, 51, 17534 }, // ŕ
+    { 19, 29, 19, -1, 21, 86, 17585 }, // Ŗ
+    { 14, 24, 14, -1, 16, 52, 17671 }, // ŗ
+    { 19, 29, 19, -1, 28, 93, 17723 }, // Ř
+    { 14, 24, 16, 1, 24, 59, 17816 }, // ř
+    { 15, 29, 16, 0, 28, 72, 17875 }, // Ś
+    { 13, 25, 14, 0, 24, 51, 17947 }, // ś
+    { 15, 29, 16, 0, 28, 75, 17998 }, // Ŝ
+    { 13, 25, 14, 0, 24, 54, 18073 }, // ŝ
+    { 15, 29, 16, 0, 21, 74, 18127 }, // Ş
+    { 12, 24, 13, 0, 16, 50, 18201 }, // ş
+    { 16, 29, 17, 0, 28, 76, 18251 }, // Š
+    { 14, 25, 15, 0, 24, 57, 18327 }, // š
+    { 18, 29, 21, 2, 21, 73, 18384 }, // Ţ
+    { 12, 27, 13, 0, 19, 55, 18457 }, // ţ
+    { 18, 28, 21, 2, 28, 73, 18512 }, // Ť
+    { 13, 25, 14, 0, 24, 54, 18585 }, // ť
+    { 18, 21, 21, 2, 21, 55, 18639 }, // Ŧ
+    { 12, 20, 13, 0, 19, 45, 18694 }, // ŧ
+    { 22, 29, 25, 2, 28, 93, 18739 }, // Ũ
+    { 16, 24, 18, 1, 23, 72, 18832 }, // ũ
+    { 22, 27, 25, 2, 26, 90, 18904 }, // Ū
+    { 16, 22, 18, 1, 21, 69, 18994 }, // ū
+    { 22, 29, 25, 2, 28, 92, 19063 }, // Ŭ
+    { 16, 24, 18, 1, 23, 71, 19155 }, // ŭ
+    { 22, 30, 25, 2, 29, 101, 19226 }, // Ů
+    { 16, 25, 18, 1, 24, 79, 19327 }, // ů
+    { 22, 30, 25, 2, 29, 100, 19406 }, // Ű
+    { 16, 25, 18, 1, 24, 76, 19506 }, // ű
+    { 22, 28, 25, 2, 21, 90, 19582 }, // Ų
+    { 16, 23, 18, 1, 16, 68, 19672 }, // ų
+    { 30, 29, 33, 2, 28, 133, 19740 }, // Ŵ
+    { 22, 25, 23, 0, 24, 92, 19873 }, // ŵ
+    { 20, 28, 22, 1, 28, 79, 19965 }, // Ŷ
+    { 18, 31, 16, -3, 24, 90, 20044 }, // ŷ
+    { 20, 27, 22, 1, 27, 75, 20134 }, // Ÿ
+    { 18, 29, 18, -1, 28, 71, 20209 }, // Ź
+    { 14, 25, 15, 0, 24, 62, 20280 }, // ź
+    { 18, 29, 18, -1, 28, 69, 20342 }, // Ż
+    { 14, 23, 15, 0, 22, 57, 20411 }, // ż
+    { 18, 29, 18, -1, 28, 74, 20468 }, // Ž
+    { 14, 25, 15, 0, 24, 66, 20542 }, // ž
+    { 20, 30, 16, -5, 23, 75, 20608 }, // ſ
+    { 23, 25, 25, 1, 24, 85, 20683 }, // Ơ
+    { 17, 20, 19, 1, 19, 54, 20768 }, // ơ
+    { 19, 21, 20, 0, 21, 63, 20822 }, // Ƥ
+    { 18, 30, 17, -2, 23, 87, 20885 }, // ƥ
+    { 12, 26, 13, 0, 19, 57, 20972 }, // ƫ
+    { 19, 21, 21, 1, 21, 54, 21029 }, // Ƭ
+    { 15, 24, 16, 0, 23, 52, 21083 }, // ƭ
+    { 18, 27, 21, 2, 21, 70, 21135 }, // Ʈ
+    { 23, 25, 26, 2, 24, 87, 21205 }, // Ư
+    { 19, 20, 21, 1, 19, 65, 21292 }, // ư
+    { 6, 8, 3, -4, 24, 10, 21357 }, // ̀
+    { 6, 7, 5, -2, 24, 12, 21367 }, // ́
+    { 10, 7, 5, -6, 24, 16, 21379 }, // ̂
+    { 10, 6, 6, -5, 23, 14, 21395 }, // ̃
+    { 10, 3, 6, -5, 21, 12, 21409 }, // ̄
+    { 10, 6, 6, -5, 23, 13, 21421 }, // ̆
+    { 4, 4, 3, -2, 22, 6, 21434 }, // ̇
+    { 10, 4, 6, -5, 22, 13, 21440 }, // ̈
+    { 8, 9, 5, -4, 26, 19, 21453 }, // ̉
+    { 8, 8, 5, -4, 24, 20, 21472 }, // ̊
+    { 11, 7, 7, -5, 24, 20, 21492 }, // ̋
+    { 10, 7, 7, -4, 24, 17, 21512 }, // ̌
+    { 9, 8, 4, -6, 24, 19, 21529 }, // ̏
+    { 10, 6, 6, -5, 23, 12, 21548 }, // ̑
+    { 6, 9, 4, -3, 25, 13, 21560 }, // ̒
+    { 7, 9, 5, -3, 26, 13, 21573 }, // ̓
+    { 6, 9, 3, -4, 26, 12, 21586 }, // ̔
+    { 4, 8, 3, -2, 25, 11, 21598 }, // ̕
+    { 6, 7, 4, -3, 19, 9, 21609 }, // ̛
+    { 4, 5, 3, -2, -2, 5, 21618 }, // ̣
+    { 10, 5, 6, -5, -2, 10, 21623 }, // ̤
+    { 8, 7, 5, -4, -1, 15, 21633 }, // ̥
+    { 6, 7, 4, -3, -1, 9, 21648 }, // ̦
+    { 6, 7, 4, -3, -1, 13, 21657 }, // ̧
+    { 6, 8, 4, -3, 1, 12, 21670 }, // ̨
+    { 5, 7, 8, -1, -1, 11, 21682 }, // ̩
+    { 11, 6, 6, -6, -2, 16, 21693 }, // ̭
+    { 10, 6, 6, -5, -1, 13, 21709 }, // ̮
+    { 10, 5, 6, -5, -2, 18, 21722 }, // ̰
+    { 10, 3, 6, -5, -3, 8, 21740 }, // ̱
+    { 10, 6, 6, -5, 23, 12, 21748 }, // ͂
+    { 11, 11, 6, -6, 29, 23, 21760 }, // ̈́
+    { 6, 5, 5, -2, -2, 8, 21783 }, // ͅ
+    { 22, 21, 21, -2, 21, 74, 21791 }, // Α
+    { 18, 22, 18, -1, 21, 69, 21865 }, // Β
+    { 19, 21, 19, -1, 21, 52, 21934 }, // Γ
+    { 17, 21, 20, 0, 21, 63, 21986 }, // Δ
+    { 19, 21, 19, -1, 21, 58, 22049 }, // Ε
+    { 18, 22, 18, -1, 21, 57, 22107 }, // Ζ
+    { 25, 21, 25, -1, 21, 91, 22164 }, // Η
+    { 20, 22, 22, 1, 21, 79, 22255 }, // Θ
+    { 13, 21, 13, -1, 21, 44, 22334 }, // Ι
+    { 23, 22, 23, -1, 21, 77, 22378 }, // Κ
+    { 22, 21, 21, -2, 21, 69, 22455 }, // Λ
+    { 28, 21, 27, -2, 21, 109, 22524 }, // Μ
+    { 25, 22, 25, -1, 21, 88, 22633 }, // Ν
+    { 19, 21, 19, -1, 21, 63, 22721 }, // Ξ
+    { 20, 22, 22, 1, 21, 73, 22784 }, // Ο
+    { 24, 21, 24, -1, 21, 76, 22857 }, // Π
+    { 18, 21, 18, -1, 21, 60, 22933 }, // Ρ
+    { 19, 22, 19, -1, 21, 56, 22993 }, // Σ
+    { 18, 21, 21, 2, 21, 55, 23049 }, // Τ
+    { 19, 21, 21, 1, 21, 58, 23104 }, // Υ
+    { 21, 22, 22, 0, 21, 84, 23162 }, // Φ
+    { 24, 21, 22, -3, 21, 74, 23246 }, // Χ
+    { 22, 21, 25, 2, 21, 86, 23320 }, // Ψ
+    { 23, 21, 23, -1, 21, 84, 23406 }, // Ω
+    { 17, 17, 19, 1, 16, 54, 23490 }, // α
+    { 15, 30, 16, 0, 23, 83, 23544 }, // β
+    { 15, 23, 16, 0, 16, 58, 23627 }, // γ
+    { 15, 24, 17, 1, 23, 63, 23685 }, // δ
+    { 12, 17, 14, 1, 16, 42, 23748 }, // ε
+    { 12, 30, 14, 1, 24, 62, 23790 }, // ζ
+    { 14, 23, 17, 1, 16, 64, 23852 }, // η
+    { 16, 24, 18, 1, 23, 74, 23916 }, // θ
+    { 7, 17, 9, 1, 16, 28, 23990 }, // ι
+    { 16, 17, 18, 1, 16, 55, 24018 }, // κ
+    { 16, 24, 16, -1, 23, 61, 24073 }, // λ
+    { 19, 24, 19, -1, 16, 68, 24134 }, // μ
+    { 15, 17, 16, 0, 16, 44, 24202 }, // ν
+    { 12, 30, 14, 1, 24, 63, 24246 }, // ξ
+    { 14, 17, 16, 1, 16, 46, 24309 }, // ο
+    { 18, 17, 19, 0, 16, 60, 24355 }, // π
+    { 16, 23, 16, -1, 16, 59, 24415 }, // ρ
+    { 11, 22, 13, 1, 16, 38, 24474 }, // ς
+    { 17, 17, 19, 1, 16, 50, 24512 }, // σ
+    { 14, 17, 16, 1, 16, 41, 24562 }, // τ
+    { 15, 17, 17, 1, 16, 45, 24603 }, // υ
+    { 19, 23, 21, 1, 16, 81, 24648 }, // φ
+    { 18, 23, 17, -2, 16, 69, 24729 }, // χ
+    { 20, 28, 22, 1, 21, 96, 24798 }, // ψ
+    { 19, 17, 21, 1, 16, 64, 24894 }, // ω
+    { 22, 28, 21, -2, 21, 88, 24958 }, // Ạ
+    { 16, 23, 18, 1, 16, 68, 25046 }, // ạ
+    { 22, 30, 21, -2, 30, 96, 25114 }, // Ả
+    { 16, 27, 18, 1, 26, 79, 25210 }, // ả
+    { 24, 31, 23, -2, 31, 108, 25289 }, // Ấ
+    { 18, 29, 20, 1, 28, 86, 25397 }, // ấ
+    { 22, 31, 21, -2, 31, 102, 25483 }, // Ầ
+    { 16, 29, 18, 1, 28, 83, 25585 }, // ầ
+    { 23, 31, 22, -2, 31, 110, 25668 }, // Ẩ
+    { 19, 29, 21, 1, 28, 93, 25778 }, // ẩ
+    { 22, 31, 21, -2, 31, 104, 25871 }, // Ẫ
+    { 16, 28, 18, 1, 27, 86, 25975 }, // ẫ
+    { 22, 35, 21, -2, 28, 107, 26061 }, // Ậ
+    { 16, 31, 18, 1, 24, 86, 26168 }, // ậ
+    { 22, 31, 21, -2, 31, 100, 26254 }, // Ắ
+    { 16, 29, 18, 1, 28, 84, 26354 }, // ắ
+    { 22, 31, 21, -2, 31, 101, 26438 }, // Ằ
+    { 16, 29, 18, 1, 28, 83, 26539 }, // ằ
+    { 22, 31, 21, -2, 31, 105, 26622 }, // Ẳ
+    { 16, 30, 18, 1, 29, 90, 26727 }, // ẳ
+    { 22, 31, 21, -2, 31, 102, 26817 }, // Ẵ
+    { 16, 28, 18, 1, 27, 85, 26919 }, // ẵ
+    { 22, 35, 21, -2, 28, 107, 27004 }, // Ặ
+    { 16, 30, 18, 1, 23, 83, 27111 }, // ặ
+    { 19, 28, 19, -1, 21, 71, 27194 }, // Ẹ
+    { 12, 23, 14, 1, 16, 53, 27265 }, // ẹ
+    { 19, 30, 19, -1, 30, 79, 27318 }, // Ẻ
+    { 13, 27, 15, 1, 26, 66, 27397 }, // ẻ
+    { 19, 28, 19, -1, 28, 75, 27463 }, // Ẽ
+    { 14, 24, 16, 1, 23, 63, 27538 }, // ẽ
+    { 22, 31, 22, -1, 31, 92, 27601 }, // Ế
+    { 17, 29, 19, 1, 28, 75, 27693 }, // ế
+    { 19, 31, 19, -1, 31, 83, 27768 }, // Ề
+    { 14, 29, 16, 1, 28, 71, 27851 }, // ề
+    { 22, 31, 22, -1, 31, 95, 27922 }, // Ể
+    { 18, 29, 20, 1, 28, 82, 28017 }, // ể
+    { 19, 31, 19, -1, 31, 87, 28099 }, // Ễ
+    { 14, 28, 16, 1, 27, 74, 28186 }, // ễ
+    { 19, 35, 19, -1, 28, 89, 28260 }, // Ệ
+    { 13, 31, 15, 1, 24, 72, 28349 }, // ệ
+    { 14, 30, 14, -1, 30, 64, 28421 }, // Ỉ
+    { 10, 27, 12, 1, 26, 47, 28485 }, // ỉ
+    { 13, 28, 13, -1, 21, 56, 28532 }, // Ị
+    { 10, 30, 11, 0, 23, 44, 28588 }, // ị
+    { 20, 28, 22, 1, 21, 85, 28632 }, // Ọ
+    { 14, 23, 16, 1, 16, 56, 28717 }, // ọ
+    { 20, 31, 22, 1, 30, 95, 28773 }, // Ỏ
+    { 14, 27, 16, 1, 26, 66, 28868 }, // ỏ
+    { 21, 32, 23, 1, 31, 100, 28934 }, // Ố
+    { 18, 29, 20, 1, 28, 78, 29034 }, // ố
+    { 20, 32, 22, 1, 31, 100, 29112 }, // Ồ
+    { 15, 29, 17, 1, 28, 73, 29212 }, // ồ
+    { 21, 32, 23, 1, 31, 102, 29285 }, // Ổ
+    { 19, 29, 21, 1, 28, 85, 29387 }, // ổ
+    { 20, 32, 22, 1, 31, 102, 29472 }, // Ỗ
+    { 15, 28, 17, 1, 27, 76, 29574 }, // ỗ
+    { 20, 35, 22, 1, 28, 104, 29650 }, // Ộ
+    { 14, 31, 16, 1, 24, 73, 29754 }, // ộ
+    { 23, 29, 25, 1, 28, 97, 29827 }, // Ớ
+    { 17, 25, 19, 1, 24, 66, 29924 }, // ớ
+    { 23, 29, 25, 1, 28, 96, 29990 }, // Ờ
+    { 17, 25, 19, 1, 24, 64, 30086 }, // ờ
+    { 23, 31, 25, 1, 30, 104, 30150 }, // Ở
+    { 17, 27, 19, 1, 26, 72, 30254 }, // ở
+    { 23, 29, 25, 1, 28, 99, 30326 }, // Ỡ
+    { 17, 24, 19, 1, 23, 67, 30425 }, // ỡ
+    { 23, 31, 25, 1, 24, 99, 30492 }, // Ợ
+    { 17, 26, 19, 1, 19, 63, 30591 }, // ợ
+    { 22, 28, 25, 2, 21, 89, 30654 }, // Ụ
+    { 16, 23, 18, 1, 16, 66, 30743 }, // ụ
+    { 22, 31, 25, 2, 30, 98, 30809 }, // Ủ
+    { 16, 27, 18, 1, 26, 79, 30907 }, // ủ
+    { 23, 29, 26, 2, 28, 99, 30986 }, // Ứ
+    { 19, 25, 21, 1, 24, 79, 31085 }, // ứ
+    { 23, 29, 26, 2, 28, 99, 31164 }, // Ừ
+    { 19, 25, 21, 1, 24, 77, 31263 }, // ừ
+    { 23, 31, 26, 2, 30, 107, 31340 }, // Ử
+    { 19, 27, 21, 1, 26, 85, 31447 }, // ử
+    { 23, 29, 26, 2, 28, 101, 31532 }, // Ữ
+    { 19, 24, 21, 1, 23, 79, 31633 }, // ữ
+    { 23, 31, 26, 2, 24, 101, 31712 }, // Ự
+    { 19, 26, 21, 1, 19, 75, 31813 }, // ự
+    { 20, 28, 22, 1, 28, 72, 31888 }, // Ỳ
+    { 18, 31, 16, -3, 24, 85, 31960 }, // ỳ
+    { 20, 28, 22, 1, 21, 73, 32045 }, // Ỵ
+    { 18, 23, 16, -3, 16, 74, 32118 }, // ỵ
+    { 20, 30, 22, 1, 30, 81, 32192 }, // Ỷ
+    { 18, 33, 16, -3, 26, 94, 32273 }, // ỷ
+    { 20, 28, 22, 1, 28, 78, 32367 }, // Ỹ
+    { 18, 30, 16, -3, 23, 88, 32445 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 32533 }, //  
+    { 0, 0, 29, 0, 0, 0, 32533 }, //  
+    { 0, 0, 15, 0, 0, 0, 32533 }, //  
+    { 0, 0, 29, 0, 0, 0, 32533 }, //  
+    { 0, 0, 10, 0, 0, 0, 32533 }, //  
+    { 0, 0, 7, 0, 0, 0, 32533 }, //  
+    { 0, 0, 5, 0, 0, 0, 32533 }, //  
+    { 0, 0, 18, 0, 0, 0, 32533 }, //  
+    { 0, 0, 8, 0, 0, 0, 32533 }, //  
+    { 0, 0, 6, 0, 0, 0, 32533 }, //  
+    { 0, 0, 1, 0, 0, 0, 32533 }, //  
+    { 0, 0, 1, 0, 0, 0, 32533 }, // ​
+    { 2, 24, 2, -1, 17, 24, 32533 }, // ‌
+    { 6, 26, 4, -3, 19, 42, 32557 }, // ‍
+    { 10, 28, 6, -5, 21, 55, 32599 }, // ‎
+    { 10, 28, 6, -5, 21, 54, 32654 }, // ‏
+    { 9, 3, 11, 1, 9, 8, 32708 }, // ‐
+    { 9, 3, 11, 1, 9, 8, 32716 }, // ‑
+    { 14, 3, 18, 2, 11, 6, 32724 }, // ‒
+    { 15, 3, 16, 0, 9, 18, 32730 }, // –
+    { 29, 3, 30, 0, 9, 33, 32748 }, // —
+    { 29, 3, 30, 0, 9, 33, 32781 }, // ―
+    { 10, 30, 15, 2, 23, 91, 32814 }, // ‖
+    { 15, 7, 16, 0, -1, 24, 32905 }, // ‗
+    { 7, 10, 10, 2, 22, 12, 32929 }, // ‘
+    { 6, 9, 9, 2, 22, 14, 32941 }, // ’
+    { 6, 10, 9, 1, 4, 14, 32955 }, // ‚
+    { 5, 10, 7, 1, 22, 15, 32969 }, // ‛
+    { 12, 10, 15, 2, 22, 26, 32984 }, // “
+    { 12, 10, 15, 2, 22, 26, 33010 }, // ”
+    { 12, 10, 15, 1, 4, 26, 33036 }, // „
+    { 11, 10, 13, 1, 22, 29, 33062 }, // ‟
+    { 13, 19, 15, 1, 21, 40, 33091 }, // †
+    { 14, 23, 15, 0, 21, 51, 33131 }, // ‡
+    { 7, 7, 9, 1, 11, 11, 33182 }, // •
+    { 10, 10, 18, 4, 15, 19, 33193 }, // ‣
+    { 6, 5, 8, 1, 4, 7, 33212 }, // ․
+    { 12, 5, 15, 1, 4, 15, 33219 }, // ‥
+    { 24, 5, 29, 2, 4, 22, 33234 }, // …
+    { 6, 4, 8, 1, 10, 7, 33256 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 33263 }, //  
+    { 0, 0, 1, 0, 0, 0, 33263 }, //  
+    { 10, 28, 6, -5, 21, 53, 33263 }, // ‪
+    { 10, 28, 6, -5, 21, 52, 33316 }, // ‫
+    { 10, 27, 6, -5, 20, 48, 33368 }, // ‬
+    { 12, 28, 7, -6, 21, 73, 33416 }, // ‭
+    { 12, 28, 7, -6, 21, 73, 33489 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 33562 }, //  
+    { 36, 24, 40, 2, 22, 160, 33562 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 33722 }, // ′
+    { 12, 10, 14, 1, 21, 28, 33737 }, // ″
+    { 17, 10, 19, 1, 21, 42, 33765 }, // ‴
+    { 6, 10, 8, 1, 21, 14, 33807 }, // ‵
+    { 12, 10, 14, 1, 21, 28, 33821 }, // ‶
+    { 19, 10, 21, 1, 21, 42, 33849 }, // ‷
+    { 13, 6, 15, 1, 0, 18, 33891 }, // ‸
+    { 8, 11, 10, 1, 13, 15, 33909 }, // ‹
+    { 9, 11, 10, 0, 13, 15, 33924 }, // ›
+    { 18, 20, 19, 0, 19, 82, 33939 }, // ※
+    { 16, 23, 18, 1, 22, 64, 34021 }, // ‼
+    { 15, 3, 16, 0, 24, 18, 34085 }, // ‾
+    { 7, 3, 9, 1, 9, 7, 34103 }, // ⁃
+    { 18, 24, 13, -6, 22, 48, 34110 }, // ⁄
+    { 21, 22, 24, 2, 21, 76, 34158 }, // ⁇
+    { 19, 23, 22, 2, 22, 74, 34234 }, // ⁈
+    { 20, 23, 22, 1, 22, 75, 34308 }, // ⁉
+    { 17, 5, 29, 6, 11, 19, 34383 }, // ⁓
+    { 23, 10, 25, 1, 21, 56, 34402 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 34458 }, //  
+    { 0, 0, 1, 0, 0, 0, 34458 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 34458 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 34458 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 34458 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 34458 }, // ⁤
+    { 11, 14, 13, 1, 24, 42, 34458 }, // ⁰
+    { 12, 14, 13, 0, 24, 30, 34500 }, // ⁴
+    { 11, 14, 13, 1, 24, 32, 34530 }, // ⁵
+    { 12, 14, 14, 1, 24, 34, 34562 }, // ⁶
+    { 10, 14, 14, 3, 24, 31, 34596 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 34627 }, // ⁸
+    { 12, 14, 13, 0, 24, 35, 34666 }, // ⁹
+    { 11, 11, 16, 3, 21, 34, 34701 }, // ⁿ
+    { 11, 15, 13, 1, 10, 37, 34735 }, // ₀
+    { 8, 14, 13, 2, 10, 25, 34772 }, // ₁
+    { 11, 14, 13, 1, 10, 28, 34797 }, // ₂
+    { 10, 15, 13, 1, 10, 30, 34825 }, // ₃
+    { 12, 14, 13, 0, 10, 33, 34855 }, // ₄
+    { 11, 14, 13, 1, 9, 24, 34888 }, // ₅
+    { 12, 15, 14, 1, 10, 35, 34912 }, // ₆
+    { 10, 14, 14, 3, 9, 26, 34947 }, // ₇
+    { 11, 15, 13, 1, 10, 37, 34973 }, // ₈
+    { 12, 15, 13, 0, 10, 35, 35010 }, // ₉
+    { 18, 20, 19, 0, 20, 59, 35045 }, // ₣
+    { 19, 22, 19, -1, 21, 70, 35104 }, // ₤
+    { 35, 22, 36, 0, 21, 121, 35174 }, // ₧
+    { 20, 22, 20, -1, 21, 68, 35295 }, // €
+    { 17, 12, 29, 6, 16, 28, 35363 }, // ←
+    { 13, 20, 29, 8, 20, 55, 35391 }, // ↑
+    { 17, 12, 29, 6, 16, 28, 35446 }, // →
+    { 13, 20, 29, 8, 20, 53, 35474 }, // ↓
+    { 18, 12, 29, 5, 16, 32, 35527 }, // ↔
+    { 13, 20, 29, 8, 20, 54, 35559 }, // ↕
+    { 13, 20, 29, 8, 20, 58, 35613 }, // ↨
+    { 13, 20, 29, 8, 20, 45, 35671 }, // ↲
+    { 13, 20, 29, 8, 20, 45, 35716 }, // ↳
+    { 17, 14, 29, 6, 17, 37, 35761 }, // ↵
+    { 17, 14, 29, 6, 17, 34, 35798 }, // ⇐
+    { 13, 18, 29, 8, 19, 66, 35832 }, // ⇑
+    { 17, 14, 29, 6, 17, 35, 35898 }, // ⇒
+    { 13, 18, 29, 8, 19, 69, 35933 }, // ⇓
+    { 19, 14, 29, 5, 17, 39, 36002 }, // ⇔
+    { 19, 22, 29, 5, 21, 70, 36041 }, // ∀
+    { 14, 24, 18, 2, 23, 64, 36111 }, // ∂
+    { 13, 21, 29, 8, 21, 42, 36175 }, // ∃
+    { 23, 24, 29, 3, 22, 102, 36217 }, // ∅
+    { 19, 21, 20, 0, 21, 63, 36319 }, // ∆
+    { 19, 22, 29, 5, 21, 63, 36382 }, // ∇
+    { 19, 21, 29, 5, 21, 58, 36445 }, // ∈
+    { 19, 26, 29, 5, 23, 82, 36503 }, // ∉
+    { 19, 16, 29, 5, 18, 61, 36585 }, // ∊
+    { 19, 21, 29, 5, 21, 58, 36646 }, // ∋
+    { 19, 26, 29, 5, 23, 82, 36704 }, // ∌
+    { 19, 16, 29, 5, 18, 61, 36786 }, // ∍
+    { 22, 26, 24, 1, 21, 98, 36847 }, // ∏
+    { 18, 26, 19, 0, 21, 70, 36945 }, // ∑
+    { 13, 3, 18, 3, 11, 5, 37015 }, // −
+    { 17, 23, 17, -1, 21, 48, 37020 }, // ∕
+    { 11, 23, 14, 2, 21, 41, 37068 }, // ∖
+    { 14, 14, 18, 2, 17, 37, 37109 }, // ∗
+    { 10, 10, 18, 4, 15, 28, 37146 }, // ∘
+    { 6, 4, 18, 6, 10, 7, 37174 }, // ∙
+    { 18, 28, 19, 0, 24, 73, 37181 }, // √
+    { 14, 11, 18, 2, 15, 39, 37254 }, // ∝
+    { 18, 10, 19, 0, 14, 45, 37293 }, // ∞
+    { 19, 21, 29, 5, 21, 52, 37338 }, // ∟
+    { 21, 21, 29, 3, 21, 56, 37390 }, // ∠
+    { 4, 30, 15, 5, 23, 46, 37446 }, // ∣
+    { 9, 30, 15, 3, 23, 91, 37492 }, // ∥
+    { 19, 21, 29, 5, 21, 63, 37583 }, // ∧
+    { 19, 21, 29, 5, 21, 63, 37646 }, // ∨
+    { 17, 21, 29, 6, 21, 66, 37709 }, // ∩
+    { 17, 22, 29, 6, 21, 67, 37775 }, // ∪
+    { 16, 30, 18, 1, 23, 76, 37842 }, // ∫
+    { 19, 17, 29, 5, 16, 37, 37918 }, // ∴
+    { 19, 17, 29, 5, 16, 36, 37955 }, // ∵
+    { 6, 16, 9, 1, 18, 17, 37991 }, // ∶
+    { 19, 17, 29, 5, 16, 42, 38008 }, // ∷
+    { 17, 5, 29, 6, 11, 19, 38050 }, // ∼
+    { 17, 15, 29, 6, 17, 59, 38069 }, // ≅
+    { 14, 10, 18, 2, 15, 36, 38128 }, // ≈
+    { 17, 10, 29, 6, 13, 35, 38164 }, // ≍
+    { 13, 13, 18, 3, 16, 39, 38199 }, // ≠
+    { 17, 13, 29, 6, 15, 60, 38238 }, // ≡
+    { 14, 18, 18, 2, 18, 35, 38298 }, // ≤
+    { 14, 18, 18, 2, 18, 35, 38333 }, // ≥
+    { 23, 14, 29, 3, 17, 50, 38368 }, // ≪
+    { 23, 14, 29, 3, 17, 51, 38418 }, // ≫
+    { 19, 16, 29, 5, 18, 54, 38469 }, // ⊃
+    { 19, 26, 29, 5, 23, 84, 38523 }, // ⊄
+    { 19, 26, 29, 5, 23, 82, 38607 }, // ⊅
+    { 19, 21, 29, 5, 21, 61, 38689 }, // ⊆
+    { 19, 21, 29, 5, 21, 62, 38750 }, // ⊇
+    { 21, 22, 29, 4, 21, 98, 38812 }, // ⊕
+    { 21, 22, 29, 4, 21, 78, 38910 }, // ⊖
+    { 21, 22, 29, 4, 21, 97, 38988 }, // ⊗
+    { 21, 22, 29, 4, 21, 94, 39085 }, // ⊘
+    { 17, 21, 29, 6, 21, 40, 39179 }, // ⊥
+    { 6, 5, 18, 6, 10, 7, 39219 }, // ⋅
+    { 25, 5, 29, 2, 10, 21, 39226 }, // ⋯
+    { 27, 28, 29, 1, 24, 109, 39247 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
@@ -4490,4 +3229,5 @@ static const EpdFontData bookerly_14_italic = {
     31,
     -8,
     true,
+    true,
 };
@@ -2,4300 +2,3091 @@
  * generated by fontconvert.py
  * name: bookerly_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_regularBitmaps[57713] = {
-    0x1A, 0x1F, 0xCB, 0xE2, 0xF4, 0xBD, 0x2F, 0x4B, 0xC2, 0xF0, 0xBC, 0x2F, 0x07, 0xC1, 0xF0, 0x7C,
-    0x0F, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x40, 0xFC, 0xBF, 0x5F, 0xC1, 0x40, 0x18, 0x06, 0x1F,
-    0x07, 0xCB, 0xC2, 0xF1, 0xF0, 0xBC, 0x7C, 0x1F, 0x1F, 0x07, 0xC7, 0xC1, 0xF1, 0xF0, 0x7C, 0x34,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x38, 0x00,
-    0x00, 0xB4, 0x07, 0x40, 0x00, 0x0F, 0x00, 0xB0, 0x00, 0xAA, 0xFA, 0xAF, 0xA9, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x2C, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,
-    0x38, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x06, 0xAF, 0xAA, 0xFA,
-    0xA0, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x03, 0x80, 0x00, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0x80, 0xBD, 0x38, 0xFD, 0x0F, 0x43, 0x43, 0xE1, 0xF0, 0x34, 0x3D, 0x1F, 0x03, 0x41, 0x41, 0xF8,
-    0x74, 0x00, 0x0F, 0xFB, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x0B, 0x2F, 0xC0, 0x40, 0xB0, 0x7D, 0x3C, 0x0B, 0x03, 0xE7, 0xC0, 0xB0, 0x3D, 0x7E, 0x0F,
-    0x07, 0xC3, 0xF8, 0xF1, 0xF8, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xB8,
-    0x00, 0x03, 0xE0, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x02, 0xD0, 0x00, 0x03, 0xC0,
-    0x0B, 0x80, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x81, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0xF4, 0x3C, 0x07, 0xF8, 0x02, 0xF0, 0x2F, 0x07, 0x43, 0xFF, 0xF0, 0x0F,
-    0xEF, 0xD0, 0xF0, 0xBC, 0x0F, 0x80, 0x3F, 0xF0, 0x2C, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x07, 0x81,
-    0xF0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x02, 0xF0, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0B, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x00, 0xF8,
-    0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0xC1, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x15, 0x54, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xD0, 0x0F,
-    0x9F, 0xC0, 0x6F, 0xE8, 0x03, 0xF0, 0xBE, 0x00, 0x7C, 0x00, 0x3E, 0x03, 0xF8, 0x07, 0xC0, 0x07,
-    0xD0, 0x0F, 0xE0, 0x7C, 0x00, 0x7D, 0x00, 0x3F, 0x87, 0xC0, 0x07, 0xE0, 0x00, 0xFF, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xFE, 0x40, 0x0B, 0xFE, 0xAF, 0xFB, 0xFF,
-    0x90, 0x1F, 0xFF, 0xF8, 0x0B, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x05, 0x00, 0x18, 0x7C, 0xBC, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x34, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xF4, 0x00, 0xF4, 0x00, 0xF8,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3D,
-    0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x1C, 0x3E, 0x03, 0xF3, 0xC0, 0x1F, 0xF4, 0x50, 0x1F, 0xFF, 0x0B,
-    0xF5, 0xF3, 0xF3, 0x80, 0x2C, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x1F, 0xC0, 0x3F, 0x40,
-    0xFC, 0x03, 0xF0, 0x1F, 0x40, 0xFC, 0x07, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x7F, 0xFF,
-    0xEB, 0xFF, 0xF4, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x07, 0xF9, 0x5F, 0xF0, 0x0F, 0xD0, 0x03, 0xF8, 0x2F, 0x80, 0x01, 0xFC, 0x3F, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x7F, 0xBD, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0xBE, 0x7E, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x2F, 0xC0, 0x03, 0xF0, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x1B, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x03, 0xF8, 0x1B, 0xF4, 0x7E, 0x00, 0x3F, 0x8B, 0xC0,
-    0x01, 0xFC, 0xBC, 0x00, 0x1F, 0xC1, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAB,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0xFF, 0xFF,
-    0xD0, 0xFE, 0x42, 0xFC, 0x7D, 0x00, 0x3F, 0x0E, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0xD1, 0xAF, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x2F, 0x6F, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x3F,
-    0x00, 0x2F, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x05,
-    0x55, 0x6F, 0x54, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x03, 0xFA,
-    0xAA, 0x80, 0x7D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x6A, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x6B, 0xFF, 0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x0F, 0xFF, 0x90, 0x07, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x55, 0x40,
-    0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x0B, 0xD0, 0x03, 0xFC, 0xBD, 0x00, 0x0F, 0xDF, 0xD0,
-    0x00, 0xBE, 0xBD, 0x00, 0x07, 0xEB, 0xE0, 0x00, 0x7E, 0x7F, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0xFD,
-    0x2F, 0xD0, 0x2F, 0xC0, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x0F, 0x40, 0x01, 0xF8, 0x3C, 0x00, 0x0F,
-    0xC0, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0xFD, 0x07, 0xFC, 0x2F, 0x40, 0x0F, 0xC3, 0xF0,
-    0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xC2, 0xF8, 0x00, 0xF8, 0x0F, 0xF0, 0x3F, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0xD0, 0xFF, 0x83, 0xF0, 0x02, 0xFD, 0x7E, 0x00,
-    0x0B, 0xEB, 0xD0, 0x00, 0x7F, 0xBD, 0x00, 0x03, 0xEB, 0xE0, 0x00, 0xBD, 0x3F, 0x80, 0x2F, 0xC1,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xFD, 0x5F, 0xF0, 0x1F, 0x80, 0x0F, 0xE0, 0xFD, 0x00, 0x1F,
-    0xC3, 0xF0, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x0B, 0xE1,
-    0xFD, 0x00, 0x2F, 0x42, 0xFF, 0x96, 0xFD, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xAF, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF,
-    0x40, 0x05, 0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFC,
-    0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F,
-    0xC3, 0xFC, 0x3F, 0x80, 0x50, 0x00, 0x40, 0x1F, 0xC0, 0xBF, 0x41, 0xFC, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x07, 0xF0, 0x0F, 0xD0, 0x3F, 0x00,
-    0xFC, 0x07, 0xD0, 0x3F, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x10, 0x55, 0x55, 0x55, 0x3F, 0xFF,
-    0xFF, 0xCA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x4F, 0xFF,
-    0xFF, 0xF2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x20, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x1F, 0xC0, 0x2F, 0xFE, 0x07, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x01,
-    0xB9, 0x00, 0x0F, 0x81, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBC, 0x2F, 0x00, 0x7D, 0x0F, 0xC0, 0x07,
-    0xC3, 0xE0, 0x0B, 0x40, 0x7C, 0x00, 0x7C, 0x7D, 0x00, 0x10, 0x07, 0xC0, 0x03, 0xD7, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x3C, 0xBC, 0x00, 0x0B, 0xFF, 0xC0, 0x07, 0xCB, 0xC0, 0x03, 0xF9, 0xBC, 0x00,
-    0xBC, 0xBC, 0x00, 0xF8, 0x07, 0xC0, 0x0F, 0x47, 0xC0, 0x0F, 0x40, 0x7D, 0x02, 0xF0, 0x7D, 0x00,
-    0xFC, 0x1F, 0xF5, 0xFC, 0x03, 0xE0, 0x0B, 0xFF, 0xAF, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0xD0, 0x6E,
-    0x40, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x1B, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00,
-    0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x15, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFA, 0xBF, 0xE0, 0x03,
-    0xF0, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xF8, 0x03,
-    0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xFA, 0x5B, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFA, 0xAF, 0xFC, 0x03, 0xF0, 0x01, 0xFD, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xF0, 0x07, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x3D,
-    0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x56, 0xB4, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xF0, 0x00,
-    0x1F, 0xE0, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFD,
-    0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x03, 0xF0,
-    0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0xFC, 0x00, 0x07,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x15,
-    0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0xB8, 0x0F, 0xC0, 0x01, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0x80, 0x02, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x02, 0xF4, 0x00, 0x00,
-    0x38, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x55, 0x55, 0xBE, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00,
-    0x06, 0xBF, 0xC7, 0xF0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x07,
-    0xE0, 0x7F, 0xC0, 0x00, 0x1F, 0x80, 0x7F, 0xE4, 0x01, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xD5, 0x55,
-    0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x7F, 0xFF, 0x47, 0xFF, 0xE0,
-    0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0x7F, 0x00, 0x0B, 0x7F, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x0F,
-    0x1F, 0x40, 0x1F, 0x2F, 0x00, 0x00, 0xF0, 0xFC, 0x02, 0xD2, 0xF0, 0x00, 0x0F, 0x0B, 0xC0, 0x3C,
-    0x1F, 0x00, 0x01, 0xF0, 0x7D, 0x07, 0x81, 0xF4, 0x00, 0x1F, 0x03, 0xE0, 0xB4, 0x1F, 0x40, 0x01,
-    0xF0, 0x2F, 0x0F, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0xF5, 0xE0, 0x0F, 0x80, 0x02, 0xE0, 0x0F, 0xBD,
-    0x00, 0xF8, 0x00, 0x3E, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0xFC, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x02, 0xFF, 0xE0, 0x04,
-    0x00, 0xBF, 0xFD, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB, 0xE0, 0x00, 0x3C,
-    0x00, 0x3D, 0x3F, 0x40, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D, 0x0B, 0xE0, 0x03,
-    0xC0, 0x03, 0xD0, 0x3F, 0x40, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0xF0,
-    0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00, 0x3D, 0x00, 0x07,
-    0xF3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00,
-    0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFA, 0xBF, 0xF4, 0x03, 0xF0, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03,
-    0xF0, 0x1B, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x02, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0x00,
-    0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xFD,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03,
-    0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F,
-    0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x05,
-    0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC1, 0xFD, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xC3,
-    0xF0, 0x00, 0x7C, 0x3F, 0x00, 0x07, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x0F, 0xDB, 0x80, 0x00, 0xBD, 0xBC, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFC, 0xBF, 0x00, 0x3F,
-    0x8B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4,
-    0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00,
-    0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80,
-    0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF7, 0xFF, 0xE4,
-    0x01, 0xBF, 0xE4, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x0F,
-    0x40, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x01, 0x40, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0x80, 0x03, 0xE0, 0x00, 0xBF, 0xF8, 0x03,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0x80, 0x00,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x00,
-    0xBE, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x7D, 0x00, 0x3D, 0x00, 0x00,
-    0x3F, 0x00, 0x3C, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x40, 0x7C, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0x80, 0xB8, 0x1F, 0x40, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x0F, 0x81, 0xF0, 0x00, 0x00,
-    0x0B, 0xC1, 0xF0, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x07, 0xD2, 0xE0, 0x07, 0xD3, 0xE0, 0x00, 0x00,
-    0x03, 0xF3, 0xD0, 0x03, 0xE3, 0xC0, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x03, 0xF7, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0xFD, 0x00,
-    0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x80,
-    0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8, 0x01, 0xBF, 0xFE,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE,
-    0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00,
-    0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F,
-    0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C,
-    0x00, 0x0F, 0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F,
-    0xC0, 0x00, 0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xFD, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80,
-    0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
-    0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xFF, 0xD6,
-    0xA8, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x7F, 0xE7, 0xFF, 0x02,
-    0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0,
-    0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
-    0x02, 0xF0, 0x2F, 0x7F, 0xF2, 0xA9, 0x00, 0x05, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x02, 0xE0, 0xB8, 0x00, 0x3D,
-    0x07, 0xC0, 0x07, 0xC0, 0x3D, 0x00, 0xF8, 0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0xF8,
-    0x3D, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x28, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55,
-    0x55, 0x55, 0x00, 0x08, 0x00, 0xF4, 0x03, 0xF0, 0x0B, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x02, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F,
-    0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F,
-    0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x50, 0x00, 0x01, 0xF4, 0xBF, 0xF4, 0x00, 0x1F, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0x91,
-    0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0xC0, 0x1F, 0x40, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00,
-    0xFC, 0x01, 0xF4, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x05, 0x0F, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x00, 0x7F, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xFC,
-    0x0B, 0xE0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xD0, 0x2F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFE, 0x1F, 0xF8, 0x00, 0x54, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x2F, 0xAB, 0xF0, 0x07, 0xD0, 0x1D,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1B, 0xFF,
-    0xFD, 0x07, 0xFF, 0xFF, 0xD0, 0x16, 0xF9, 0x54, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x1F, 0x80, 0x2F, 0x44, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x3E, 0xFF,
-    0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0x55, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0xE5, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x03, 0xF1, 0xFF, 0xF4, 0x00,
-    0x0F, 0xEF, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x03, 0xFF, 0xC0, 0x17, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x2F, 0xD0, 0x7F, 0xD0, 0x0A, 0x40,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0xFF, 0x80, 0x3F, 0x01, 0xFF, 0xF4, 0x03, 0xF0,
-    0x07, 0xF4, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x3F, 0x0B,
-    0xE0, 0x00, 0x03, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x01,
-    0xFF, 0xE0, 0x1F, 0xF4, 0x3F, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x0B,
-    0xFC, 0x07, 0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x07, 0xFF, 0xE7, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFC, 0x2F, 0xFD, 0x03, 0xFF, 0xC0, 0x07,
-    0xFF, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x00, 0x6F, 0xFE, 0x07, 0xFF, 0xD0, 0xBF, 0x40, 0x01, 0xFC,
-    0x00, 0x7F, 0x80, 0x0B, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x01, 0xFF, 0xF0, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF,
-    0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00,
-    0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4,
-    0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01,
-    0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0xF4, 0x7F, 0xF8, 0x0B, 0xFE, 0xBF,
-    0xFF, 0xC0, 0x6F, 0xFD, 0x1B, 0xF8, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x3F,
-    0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xD0,
-    0x3F, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0xBF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x06, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00,
-    0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0xFC,
-    0x07, 0xD0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xF4,
-    0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xBF, 0x00, 0x0B, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7,
-    0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F,
-    0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00,
-    0x7D, 0x3C, 0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00,
-    0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x7F, 0xFE, 0x03,
-    0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00,
-    0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0xB0, 0x03, 0xFF, 0xD3, 0xFF, 0xD0, 0x0F, 0x40,
-    0x2F, 0xFC, 0x0F, 0xD0, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x07, 0xD0, 0x03,
-    0xF0, 0x03, 0xFD, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x7F, 0xE0, 0x0F, 0x80, 0x01, 0xF8, 0x0B, 0xAF,
-    0x00, 0xF0, 0x00, 0x0F, 0xC0, 0xF1, 0xF4, 0x2F, 0x00, 0x00, 0xBC, 0x1F, 0x0F, 0x83, 0xD0, 0x00,
-    0x03, 0xD2, 0xD0, 0xBC, 0x3C, 0x00, 0x00, 0x3F, 0x3C, 0x07, 0xD7, 0x80, 0x00, 0x02, 0xF7, 0x80,
-    0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x07,
-    0xFF, 0x8F, 0xFF, 0x41, 0xFF, 0xD0, 0x7F, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7E,
-    0x0B, 0x80, 0x00, 0x0B, 0xD7, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x03, 0xD1, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x80,
-    0x03, 0xF0, 0x03, 0xF4, 0x0B, 0xFE, 0x01, 0xFF, 0xDB, 0xFF, 0xD1, 0xFF, 0xF8, 0x7F, 0xFE, 0x03,
-    0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x03,
-    0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00, 0x00,
-    0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFD, 0x1F, 0x40, 0x2F, 0x81, 0xD0, 0x07, 0xF0, 0x1C, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0xE0, 0xBE, 0x00, 0x1E, 0x1F, 0x80, 0x03, 0xE3, 0xFF, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0xE0, 0x3F,
-    0x00, 0x0F, 0x80, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40,
-    0x03, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x6E, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x14, 0x00, 0x00, 0x0F, 0xE4, 0x03, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x7D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x1F, 0x40,
-    0x1F, 0xC0, 0xBF, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0D, 0x3F, 0xFF,
-    0x43, 0xE7, 0xD2, 0xFF, 0xFC, 0x74, 0x02, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x04, 0x0F, 0xD7, 0xF4,
-    0xFC, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x3D,
-    0x1F, 0x87, 0xE1, 0xF8, 0xBE, 0x2F, 0x8F, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x7F, 0x90, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xFA, 0xDB, 0xF0, 0x2F, 0x07, 0x0B, 0xC0, 0xF4,
-    0x1C, 0x1E, 0x0B, 0xC0, 0xB0, 0x00, 0x3F, 0x02, 0xC0, 0x00, 0xFC, 0x0B, 0x00, 0x03, 0xF0, 0x2C,
-    0x00, 0x0F, 0xC0, 0xB0, 0x00, 0x3F, 0x02, 0xC0, 0x00, 0xBD, 0x0F, 0x00, 0x01, 0xFC, 0x3C, 0x00,
-    0x03, 0xFE, 0xF1, 0x7C, 0x03, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0xBE, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x3E,
-    0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1A, 0xFE,
-    0xAB, 0xC0, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x58, 0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xBF, 0xFF, 0xFC, 0x18, 0x00, 0x05, 0x50, 0x10, 0x00,
-    0x00, 0x04, 0x78, 0x01, 0x40, 0x2D, 0x2E, 0x2F, 0xFD, 0xB8, 0x0B, 0xFE, 0xBF, 0xE0, 0x03, 0xE0,
-    0x0B, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xE0, 0x07, 0xC0, 0x03, 0xD0, 0x07, 0xC0,
-    0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xF9, 0x6F, 0xD0, 0x1F, 0xBF, 0xFE, 0xF4, 0x7C, 0x06,
-    0x90, 0x3D, 0x20, 0x00, 0x00, 0x08, 0x7F, 0xFE, 0x00, 0x2F, 0xF8, 0x7F, 0xFD, 0x00, 0x3F, 0xF8,
-    0x0B, 0xF0, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x1F, 0x00, 0x00,
-    0xBD, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x80, 0xF4, 0x00, 0x00, 0x5F,
-    0xC1, 0xF5, 0x40, 0x01, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x57, 0xFB, 0x95, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x14, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xBC, 0x0B, 0xD0, 0x7C,
-    0x00, 0xF0, 0x3F, 0x00, 0x14, 0x1F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xDF, 0xF4, 0x00, 0xF0,
-    0xBF, 0x80, 0x2D, 0x07, 0xFC, 0x07, 0xC0, 0x1F, 0xC0, 0xFC, 0x00, 0xF8, 0x0F, 0xE0, 0x0F, 0x00,
-    0xFF, 0x42, 0xD0, 0x0B, 0xF8, 0x74, 0x00, 0x2F, 0xAD, 0x00, 0x01, 0xFF, 0x41, 0x00, 0x1F, 0xC3,
-    0xC0, 0x03, 0xE1, 0xF4, 0x02, 0xF0, 0x7F, 0x96, 0xF0, 0x0B, 0xFF, 0xE0, 0x00, 0x1A, 0x40, 0x00,
-    0x09, 0x00, 0x50, 0xFD, 0x0F, 0xE3, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x5B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0x00, 0x2E, 0x00, 0xB4, 0x01, 0xBE, 0x40, 0xB4, 0x0F, 0x00, 0xFF, 0xF8,
-    0x03, 0xC2, 0xD0, 0x3D, 0x03, 0x80, 0x2C, 0x3C, 0x07, 0x80, 0x34, 0x01, 0xE3, 0xC0, 0xB4, 0x00,
-    0x00, 0x0E, 0x38, 0x0F, 0x00, 0x00, 0x00, 0xF3, 0x80, 0xF0, 0x00, 0x00, 0x0F, 0x3C, 0x0F, 0x40,
-    0x00, 0x00, 0xE3, 0xC0, 0xBC, 0x00, 0x00, 0x1E, 0x2D, 0x03, 0xE4, 0x18, 0x02, 0xC0, 0xE0, 0x1F,
-    0xFF, 0xC0, 0x3C, 0x0B, 0x40, 0x1A, 0x90, 0x0B, 0x40, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2F, 0xF8, 0x02, 0xF0, 0xF0, 0x0B, 0x43, 0xD0, 0x00,
-    0x0F, 0x40, 0x2F, 0xFD, 0x02, 0xF4, 0xF4, 0x0F, 0x03, 0xD0, 0x3E, 0x1F, 0xD0, 0x7F, 0xDF, 0xC0,
-    0x14, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x24, 0x00, 0x50, 0x03,
-    0xD0, 0x0B, 0x80, 0x7E, 0x00, 0xFC, 0x07, 0xE0, 0x1F, 0xC0, 0xBF, 0x01, 0xFC, 0x03, 0xF4, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x1F, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x0B, 0xD0, 0x1F, 0x80, 0x07, 0xC0, 0x0F,
-    0x40, 0x03, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2E,
-    0x00, 0x2E, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x0D, 0x3F, 0xF4, 0x2C, 0x0B, 0x03, 0x8F, 0x03, 0x83,
-    0x80, 0xE2, 0xC0, 0xB0, 0xD0, 0x3D, 0xE0, 0x2C, 0x34, 0x0F, 0xF0, 0x0B, 0x0E, 0x03, 0x8E, 0x02,
-    0xC3, 0xC0, 0xE1, 0xE0, 0xE0, 0x70, 0xFE, 0x1D, 0x74, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x6A, 0xAA, 0x8F, 0xFF, 0xFD, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xFD, 0x0B, 0x80, 0xBC, 0x3C, 0x00, 0xF4,
-    0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x0B, 0xC0, 0xBC, 0x0F, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x2A, 0xAF, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0, 0x55, 0xF5, 0x54, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0x3F, 0xFF, 0x42, 0xF4,
-    0x7F, 0x0F, 0x40, 0xBC, 0x1C, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x1F, 0xFF, 0xCF, 0x81, 0xF5, 0x80, 0x3D, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0xFF, 0xD0,
-    0x2A, 0xFD, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF5, 0x5B, 0xF8, 0xFF, 0xF4, 0x0A, 0x90, 0x00,
-    0x01, 0x00, 0x3D, 0x0F, 0xD2, 0xF8, 0x3F, 0x0B, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x7D, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B,
-    0xC0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x01, 0xFD,
-    0x00, 0xBF, 0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x0B, 0xEF, 0x40, 0xBF, 0xFF, 0xF8, 0xFF, 0xDB, 0x9F,
-    0xFE, 0x0B, 0xFC, 0xBC, 0x15, 0x00, 0x14, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x03, 0xFF,
-    0xF3, 0xC0, 0x2F, 0xFF, 0x8F, 0x00, 0xFF, 0xFE, 0x3C, 0x07, 0xFF, 0xF8, 0xF0, 0x1F, 0xFF, 0xE3,
-    0xC0, 0x7F, 0xFF, 0x8F, 0x00, 0xFF, 0xFE, 0x3C, 0x03, 0xFF, 0xF8, 0xF0, 0x03, 0xFF, 0xE3, 0xC0,
-    0x07, 0xFF, 0x8F, 0x00, 0x02, 0xEE, 0x3C, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0x03, 0x8F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x38, 0xF0, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x03,
-    0x8F, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x00, 0x38, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x19, 0x0B, 0xFC, 0x1B, 0xC0,
-    0x7C, 0x0F, 0x87, 0xE0, 0x24, 0x00, 0x00, 0x60, 0x06, 0xFC, 0x07, 0xFF, 0x00, 0x0B, 0xC0, 0x01,
-    0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x1B,
-    0xE4, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xFE, 0x00, 0xF9, 0xBE, 0x0F, 0x80,
-    0x7C, 0x3C, 0x00, 0xF4, 0xF0, 0x03, 0xD3, 0xD0, 0x0F, 0x4F, 0x80, 0x7C, 0x2F, 0x87, 0xE0, 0x2F,
-    0xFE, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x20, 0x00, 0x90,
-    0x00, 0xF4, 0x02, 0xE0, 0x00, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x01, 0xFC, 0x03, 0xF0,
-    0x03, 0xF4, 0x0B, 0xE0, 0x2F, 0xC0, 0x7F, 0x41, 0xFC, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0x00, 0xF8,
-    0x02, 0xF0, 0x03, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x02, 0xE0, 0x01, 0xF0, 0x00,
-    0x0B, 0x00, 0x0B, 0xE0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x1F, 0xE0, 0x01, 0xF0, 0x00, 0x3C, 0x00,
-    0x3F, 0xE0, 0x1B, 0xFE, 0x00, 0x78, 0x00, 0xFA, 0xE0, 0x3F, 0xFF, 0x40, 0xF0, 0x02, 0xF2, 0xE0,
-    0x00, 0x00, 0x02, 0xD0, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x42, 0xE0, 0x00, 0x00,
-    0x0F, 0x40, 0x3F, 0xAB, 0xF9, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x00,
-    0x05, 0x57, 0xE5, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xB0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x0B, 0x40, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0x1E, 0x03, 0xFF, 0xF8, 0x01, 0xF0, 0x00, 0x3C,
-    0x0B, 0xC0, 0xFC, 0x01, 0xF0, 0x00, 0x78, 0x0B, 0x80, 0x7C, 0x1B, 0xFE, 0x00, 0xF0, 0x02, 0x40,
-    0xBC, 0x3F, 0xFF, 0x42, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x04, 0x03, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x02, 0x5B, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0x00, 0xF8, 0x00, 0xB0, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x1A, 0xFF, 0x40, 0x1E, 0x00, 0x2F, 0x7C, 0x0F, 0xFF, 0x40, 0x0F,
-    0x00, 0x1F, 0x1F, 0x00, 0x54, 0x00, 0x0B, 0x40, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x81, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x07, 0xEA, 0xBE, 0x80, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x15, 0x5B, 0xD4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x02, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xF4, 0x01,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5,
-    0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC,
-    0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC,
-    0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9,
-    0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA,
-    0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x80, 0x00, 0x00, 0x0F,
-    0xFE, 0xBC, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xC0, 0x00, 0x00, 0x0E, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xD6,
-    0xE0, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x6E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x02,
-    0xE7, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x02, 0xC0, 0x00, 0x00, 0xB8, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x1F, 0x85, 0x54, 0x00, 0x00, 0x0F, 0x40, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE5, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFA, 0xAA, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x09, 0x00, 0xBC,
-    0x00, 0x07, 0xE0, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0xBE,
-    0x01, 0x5F, 0x87, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x0B, 0xF4, 0x01,
-    0xF4, 0x07, 0xE0, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x42, 0xF4, 0x00, 0x02, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x56,
-    0xB4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03,
-    0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0,
-    0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x78, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00,
-    0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x50, 0x05, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x07, 0xD0,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0,
-    0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F,
-    0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x10, 0x00, 0x2F, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x80, 0x06, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xFF,
-    0xF7, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0x03, 0xD0, 0x07, 0xF8, 0x0F, 0xFC, 0x0F, 0xE4, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xFF, 0xF7,
-    0xFF, 0xFE, 0x00, 0x14, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF8, 0x02, 0xF2, 0xF8, 0x2F, 0x02, 0xF0,
-    0xF0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xF8, 0x14,
-    0x00, 0x51, 0xFC, 0x0F, 0xDB, 0xF0, 0x7F, 0x4F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0x43, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x03,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xFF,
-    0xFF, 0xE0, 0x03, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1B, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0xBC, 0x00, 0x00, 0x00,
-    0xF6, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0xC0, 0x00, 0x3C, 0x00, 0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C,
-    0x00, 0x3D, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03,
-    0xC0, 0x03, 0xD0, 0x1F, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4,
-    0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xC3, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03,
-    0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00,
-    0x02, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE,
-    0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00,
-    0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00,
-    0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07,
-    0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F,
-    0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x03, 0x80, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0xC0, 0x00, 0x00, 0x7D, 0xBF, 0xE0, 0x00, 0x00, 0x0D,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0,
-    0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00,
-    0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xD0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF,
-    0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07,
-    0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xCB, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x3F, 0x00, 0xBC, 0x0F, 0xC2,
-    0xF0, 0x03, 0xEB, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xC3, 0xE0,
-    0x2F, 0x00, 0xF8, 0x7C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x16, 0x90, 0x00, 0x40, 0x00,
-    0x7F, 0xFF, 0xF4, 0x1E, 0x00, 0x2F, 0xFE, 0xFF, 0xFB, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xF0, 0x02,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xF0, 0x0B, 0xE0, 0x00, 0x0B, 0xFF, 0x80,
-    0xFC, 0x00, 0x02, 0xF2, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0x1F, 0xC1, 0xFC, 0x00, 0x2F, 0x01, 0xFC,
-    0x2F, 0x80, 0x0B, 0xC0, 0x0F, 0xC2, 0xF8, 0x02, 0xF0, 0x00, 0xFC, 0x2F, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC1, 0xFC, 0x2F, 0x00, 0x01, 0xFC, 0x1F, 0xDB, 0xC0, 0x00, 0x2F, 0x80, 0xFF, 0xF0, 0x00, 0x03,
-    0xF4, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0x40, 0x0B,
-    0xF4, 0x02, 0xF7, 0xFF, 0xFF, 0xFD, 0x00, 0x3C, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x7F, 0x40, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4,
-    0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0,
-    0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFA, 0xBF, 0xF0, 0x03, 0xF0, 0x03, 0xFC, 0x03, 0xF0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x01, 0xFC,
-    0x03, 0xF0, 0x0B, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x1F, 0xEB, 0xFD, 0x00, 0x07, 0xE0, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x0F, 0x00, 0x00, 0x2F, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x00, 0xFF, 0x40, 0x02, 0xF0, 0x03, 0xFE, 0x00,
-    0x2F, 0x00, 0x0F, 0xF8, 0x02, 0xF0, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x2F, 0x0E, 0x00, 0x3E, 0x02, 0xF0, 0xF0, 0x07, 0xC1, 0xFF, 0x0F, 0xEA, 0xF8, 0x3F,
-    0xF0, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF,
-    0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F,
-    0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF,
-    0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F,
-    0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F,
-    0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC,
-    0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3E, 0xF8, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xF0, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0,
-    0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD,
-    0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xE0, 0x00, 0xFF, 0xD7, 0xC0, 0x03, 0xC7, 0xFF,
-    0x00, 0x0A, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x17, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE,
-    0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF,
-    0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x54, 0x00, 0x40, 0x06, 0x00, 0x24, 0x00,
-    0x7F, 0x03, 0xF0, 0x01, 0xFC, 0x1F, 0xD0, 0x02, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0xFD, 0x02,
-    0xF8, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x05, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0xAF, 0xC0, 0x3F, 0x40, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF, 0xEF, 0xFC, 0x3F, 0xFC, 0x3F, 0xC0, 0x15,
-    0x00, 0x10, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0xF0,
-    0x3C, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0x9B, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80,
-    0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00,
-    0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01,
-    0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xD0, 0x0F, 0xFB, 0xF9, 0xFF,
-    0xFF, 0x43, 0xF4, 0x0B, 0xFD, 0x01, 0xFC, 0x3F, 0x00, 0x3F, 0x80, 0x0F, 0xC1, 0xD0, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x01, 0x5F, 0xD0, 0x00, 0x6B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xFA, 0x95, 0x01, 0xFE, 0x53, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x02,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x0B, 0xFF, 0x40, 0x18, 0x3F, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xC0, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x01, 0x50, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F,
-    0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF,
-    0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFB, 0xD0, 0x01, 0xF4,
-    0xFC, 0x00, 0xF8, 0x0F, 0x40, 0x78, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0,
-    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00,
-    0x15, 0x40, 0x00, 0x01, 0x40, 0x14, 0x03, 0xF8, 0x2F, 0xC0, 0xFE, 0x0B, 0xF0, 0x1F, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE,
-    0x07, 0xE0, 0x0F, 0xD3, 0xF0, 0x01, 0xF9, 0xF4, 0x00, 0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFF, 0x80, 0x19, 0x0F, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x80, 0x01, 0x54, 0x00, 0x14, 0x00,
-    0x03, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0xF4, 0x00,
-    0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xFC, 0x00, 0xFF, 0xF0,
-    0x2F, 0x0F, 0x87, 0xD0, 0x7C, 0xB4, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F,
-    0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83,
-    0xFF, 0xFC, 0x09, 0x00, 0x50, 0xFD, 0x0F, 0xE3, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x1F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D,
-    0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x06, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x3C, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x1E, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x02, 0xFF, 0x8F, 0x40, 0x3F, 0xFF, 0xFF, 0x03, 0xF4, 0x07, 0xFC, 0x2F, 0x00, 0x03, 0xF4,
-    0xF8, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x03, 0xFB, 0xD0, 0x00, 0x0F, 0xAF, 0xC0, 0x00, 0x7D, 0x3F, 0x40, 0x03, 0xF0, 0xBF, 0x40,
-    0x2F, 0x40, 0xFF, 0xEF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x81, 0xC0, 0x00, 0x02, 0xFF, 0xDF, 0x40, 0x00, 0x0B, 0x8F, 0xFD, 0x00,
-    0x00, 0x1C, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x0B, 0xF0, 0xBF, 0xF8, 0x01, 0xFF, 0xDF, 0xFF, 0xF4, 0x01, 0xBF, 0xF8, 0x1F,
-    0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00,
-    0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0,
-    0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F,
-    0x40, 0x6F, 0xFD, 0x02, 0xFF, 0xE3, 0xFF, 0xF4, 0x1F, 0xFF, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E,
-    0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F,
-    0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x3E, 0xFC, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x02, 0xD0, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0B, 0x00, 0x03,
-    0xFF, 0x9F, 0x00, 0x03, 0xD7, 0xFF, 0x00, 0x01, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF,
-    0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0x90, 0x05, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x07,
-    0xF4, 0x3F, 0x40, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE1, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0,
-    0x1F, 0xF0, 0x0F, 0xC0, 0x02, 0xFD, 0x03, 0xE0, 0x02, 0xFF, 0x82, 0xF4, 0x02, 0xF3, 0xF0, 0xBC,
-    0x02, 0xF0, 0xFC, 0x3F, 0x02, 0xF0, 0x3F, 0x0F, 0xC2, 0xF0, 0x0F, 0xC2, 0xF6, 0xF0, 0x03, 0xF0,
-    0xBF, 0xF0, 0x00, 0xF8, 0x0F, 0xF0, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0xBE, 0x02, 0xFF, 0xFA, 0xFE,
-    0x00, 0xF2, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8,
-    0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07,
-    0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00,
-    0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0,
-    0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8,
-    0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F,
-    0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00,
-    0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F,
-    0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00,
-    0x00, 0xF8, 0x0F, 0x40, 0x00, 0x07, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00,
-    0x14, 0x01, 0x40, 0x00, 0x03, 0xF8, 0x2F, 0x80, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x1F, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0xF0, 0x0B, 0xFE, 0x00, 0x6F, 0x80, 0x02, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFE, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xBF, 0xF4, 0x01, 0xFF, 0xF4, 0xBF, 0xD0, 0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80, 0xFD,
-    0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01, 0xF0,
-    0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F,
-    0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x14, 0x00, 0x02, 0xF1, 0xFF, 0xF0, 0x00,
-    0xBE, 0xFF, 0xFF, 0x00, 0x2F, 0xF4, 0x2F, 0xF0, 0x0B, 0xE0, 0x01, 0xFD, 0x02, 0xF0, 0x00, 0x2F,
-    0x80, 0xBC, 0x00, 0x07, 0xE0, 0x2F, 0x00, 0x01, 0xFC, 0x0B, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00,
-    0x1F, 0x80, 0xBC, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x01, 0xF8, 0x02, 0xF4,
-    0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x60, 0x06, 0x40, 0x00, 0x1F, 0xC0,
-    0xFC, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02,
-    0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02,
-    0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC,
-    0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0,
-    0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x0A, 0xAA, 0xA8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFE, 0xFF, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0xFC, 0x00, 0xF8,
-    0x01, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x7F, 0x00, 0x0B, 0xFF, 0xFC, 0x01,
-    0xFF, 0xEB, 0xF0, 0x0F, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x07, 0xF0,
-    0x0F, 0xF4, 0x0F, 0xFF, 0xFB, 0xFF, 0x0F, 0xFF, 0x0F, 0xF0, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00,
-    0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00,
-    0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x00,
-    0xF8, 0x07, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4, 0x0B,
-    0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x17, 0xF0,
-    0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x2F,
-    0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x54,
-    0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA,
-    0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD,
-    0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x0B, 0x80, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0,
-    0x07, 0xD0, 0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5,
-    0x5A, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00,
-    0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F,
-    0x5F, 0xC0, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x0B, 0x40, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xD0,
-    0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5, 0x5A, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0xF4, 0xBC, 0x00, 0xF8, 0x0F,
-    0x80, 0x38, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xD0, 0x1F, 0x80,
-    0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0B, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xE5, 0x5A, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x03, 0xF0, 0x0F, 0xD2, 0xF0, 0x01, 0xF4, 0xF8,
-    0x00, 0x38, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x90, 0x05, 0x0F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x1F, 0x40, 0x7E, 0x00, 0x03,
-    0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x2F, 0xD0, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00,
-    0x0B, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xE5, 0x5A, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x01, 0x00, 0x04, 0x02, 0xE0, 0x0F, 0x80, 0x3D, 0x0B, 0xC0, 0x0B, 0xD7, 0xC0, 0x00,
-    0xBF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0x00, 0xFD, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x03, 0x87,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF9, 0x00, 0x50, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xF8,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x80, 0x00, 0x90, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xFD,
-    0x1F, 0x80, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFA, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
-    0x03, 0xF0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x01, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x2F,
-    0xC0, 0x03, 0xF0, 0x06, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x7F, 0xF0, 0x3C, 0x00,
-    0x00, 0xBF, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0xB8, 0x00, 0x00,
-    0x03, 0xF0, 0xB0, 0x00, 0x00, 0x03, 0xF0, 0xB0, 0x00, 0x01, 0x43, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xE1, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x40, 0x00, 0x00, 0x05, 0x55,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xEB, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x01,
-    0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xD3, 0xFF, 0xFF, 0xE0, 0x03, 0xF4, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1B, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1A, 0xBF, 0xA0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x1A, 0xA7, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0x9A, 0xFF, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0xD0, 0x2F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFE, 0x1F, 0xF8, 0x00, 0x54, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x1A, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0xFC, 0x00,
-    0x0B, 0x40, 0x3F, 0x00, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x05, 0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x06,
-    0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x05, 0xBC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xAA, 0xA9, 0x02, 0xFF, 0xFF, 0x80, 0x6A, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xF8,
-    0x1F, 0x80, 0x3F, 0x4F, 0xC0, 0x07, 0xE7, 0xD0, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x64, 0x3F, 0xFF, 0xFD, 0x02, 0xFF, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x60, 0x00, 0x2F, 0x40, 0x78, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00,
-    0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60,
-    0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0x40, 0xBD, 0x02, 0xD0, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x81, 0xF8, 0x03, 0xF4, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x0F, 0xEF,
-    0x40, 0x03, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x43, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xE0,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xD3, 0xF0, 0x01, 0xF9, 0xF4, 0x00,
-    0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x19, 0x0F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0xFC, 0x00, 0x07, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x15, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00,
-    0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB,
-    0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0x16, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0x80, 0x00, 0xF8, 0x03, 0xF0, 0x00,
-    0x1F, 0x83, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0x00,
-    0x04, 0x02, 0xD0, 0x0F, 0x40, 0x7D, 0x0F, 0x80, 0x0B, 0xCB, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F,
-    0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0xBC, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1F, 0xE0, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00,
-    0x00, 0x0E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF,
-    0x00, 0x01, 0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBE, 0xF4, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00,
-    0x3E, 0x03, 0xE0, 0x00, 0x0E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF4, 0x1F, 0x80, 0x2F, 0x44, 0x0B, 0xC0, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF4,
-    0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x3E, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF9, 0x55, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x03,
-    0xF0, 0x3F, 0xE5, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xE0,
-    0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00, 0x00, 0x0E,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF, 0x00, 0x01,
-    0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00, 0x01, 0xF8,
-    0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F, 0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xA0,
-    0x00, 0x1F, 0x40, 0xB8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x7E, 0x00, 0xBD, 0x10, 0x2F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0xFB, 0xFE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x55,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x01, 0xFC, 0x3F, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0x95, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x01,
-    0xF0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0xBD, 0x00, 0x00, 0x0E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x15, 0x55, 0x6F, 0x80, 0x01, 0xFF, 0xFE, 0xBF, 0x00, 0x01, 0xAF, 0xF1, 0xFC, 0x00, 0x00, 0x1F,
-    0x83, 0xF4, 0x00, 0x00, 0x7E, 0x0F, 0xF0, 0x00, 0x01, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xE0, 0x1F,
-    0xF9, 0x00, 0x6F, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x41, 0xF8, 0x02, 0xF4, 0x40, 0xBC, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x41,
-    0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xEF, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x95, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0xF8, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x3F,
-    0x03, 0xFE, 0x56, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xAF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x80, 0x02,
-    0xF0, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x0F, 0x02, 0xF4, 0x00, 0x00, 0x38, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x55, 0x55, 0xBE, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00, 0x06, 0xBF,
-    0xC7, 0xF0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x01, 0xF8, 0x3F, 0xC0, 0x00, 0x07, 0xE0, 0x7F,
-    0xC0, 0x00, 0x1F, 0x80, 0x7F, 0xE4, 0x01, 0xBE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFD, 0x07, 0xE0, 0x0B, 0xD1, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0xFD, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xBF, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x55, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x00, 0xF8, 0x3F,
-    0x00, 0x00, 0xFC, 0x0F, 0xF9, 0x5B, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xBE, 0x90, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xF1, 0xFF, 0xF4, 0x00, 0x3F, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF5, 0x55, 0x55,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFC, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x7F, 0xFD,
-    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xC0,
-    0x2F, 0xFD, 0x0F, 0xFF, 0xC0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x55,
-    0x55, 0x7F, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x02, 0xBF, 0xA9, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2A, 0x90, 0x00,
-    0x0F, 0xCB, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x03, 0xF4,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD3, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x43, 0x83, 0xFF, 0x9F, 0x0F, 0x6F, 0xFC, 0x28, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFD, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xF8, 0x2C, 0xBF, 0xE7, 0xDF, 0x4F, 0xFC, 0x70, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC2,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0xE0,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x80, 0x6A, 0xAA, 0x8F, 0xFF, 0xFC, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xC3, 0xE0, 0x0F, 0x0F,
-    0xFF, 0xF8, 0x0B, 0xFF, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x7F, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xBF,
-    0xFD, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0x00, 0x0C, 0xFC, 0x03, 0xC7, 0xFF, 0xF8, 0x1F, 0xFE,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF, 0xFF, 0x80, 0xB8, 0x00,
-    0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x03, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x40, 0x1F,
-    0xD0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0x80, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x02, 0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x7F, 0xF4, 0x00, 0x7F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B, 0xFF, 0x83, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8B, 0xFF, 0xFC, 0x7F, 0xFE, 0x07, 0xFF, 0xE4, 0x03, 0xF0,
-    0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x2F, 0xFF,
-    0x40, 0x3F, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x07, 0xF8,
-    0x01, 0xFE, 0x03, 0xF8, 0x01, 0xFD, 0x01, 0xA0, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x06, 0xFC, 0x7F, 0xF4, 0x1F, 0xFC, 0x07, 0xF4,
-    0x01, 0xFC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4,
-    0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4,
-    0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xBC, 0x1B, 0xFF, 0x80, 0xBC, 0x3F, 0xFF,
-    0xC0, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xF2, 0xF4, 0x02, 0xF0, 0x2F, 0x00, 0xF0,
-    0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x7E, 0xF4, 0x03, 0xE2, 0xF0, 0x2F, 0x03, 0xE0, 0xE0, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x5F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF4, 0x01, 0xFF, 0x40, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x7F, 0xFF, 0x47, 0xFF, 0xE0,
-    0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x40, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x2F, 0xFF, 0x80, 0x3F, 0x01, 0xFF, 0xF4, 0x03, 0xF0, 0x07, 0xF4, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x3F,
-    0x80, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0xE0, 0x1F, 0xF4, 0x3F,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x41, 0xFF,
-    0xFC, 0x7F, 0xF4, 0x1F, 0xFF, 0x80, 0x7F, 0x40, 0x3F, 0x40, 0x01, 0xF4, 0x0F, 0xD0, 0x00, 0x1F,
-    0x43, 0xF0, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0x6F, 0xC0, 0x00, 0x01, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x00, 0x01, 0xF4,
-    0x0F, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x0B, 0xFE, 0x00, 0xFF, 0x83, 0xFF, 0xF4, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xB0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x1F, 0x00,
-    0xFC, 0x00, 0x5F, 0xC2, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x0B, 0xF0, 0x2F, 0xFC, 0x3F, 0xE4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF0,
-    0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x1F, 0xFF, 0x9F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0B, 0xFC,
-    0x07, 0xFF, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x07, 0xFF, 0xE7, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xF4, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xFF,
-    0xFF, 0x0F, 0x80, 0x7F, 0xFE, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x3F, 0x00, 0x34, 0x00,
-    0x0F, 0xC0, 0x04, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xC0, 0x3F,
-    0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x7C, 0x03, 0xF0, 0x01, 0x7F, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x50, 0x10, 0x2F, 0xF0, 0x3D, 0x7F, 0xF0, 0x3E, 0x03, 0xF0, 0x3D,
-    0x02, 0xF0, 0x3C, 0x02, 0xF0, 0x78, 0x02, 0xF0, 0x70, 0x02, 0xF0, 0x10, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0x80, 0x03, 0xF0, 0x03, 0xFC, 0x00,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x01, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x17, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x06, 0x40, 0x2F, 0x00, 0xFD, 0x02, 0xF0, 0x1F,
-    0xD0, 0x2F, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x80, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0xB4, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x2C,
-    0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x01, 0x7F, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x20, 0x02, 0xF7, 0xD0, 0x0B, 0xFD, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0E, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xBF, 0xF8, 0x03,
-    0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x3C, 0x00,
-    0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C, 0x00, 0x3D, 0x1F, 0xC0, 0x03, 0xC0,
-    0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03, 0xC0, 0x03, 0xD0, 0x1F, 0xC0, 0x3C,
-    0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4, 0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xC3,
-    0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x0F,
-    0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00, 0x02, 0xFC, 0x0F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F,
-    0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00,
-    0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40,
-    0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD,
-    0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x6F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x03, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB, 0xE0, 0x00, 0x3C,
-    0x00, 0x3D, 0x3F, 0x40, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D, 0x0B, 0xE0, 0x03,
-    0xC0, 0x03, 0xD0, 0x3F, 0x40, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0xF0,
-    0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00, 0x3D, 0x00, 0x07,
-    0xF3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F,
-    0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00,
-    0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0,
-    0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D,
-    0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B,
-    0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18,
-    0x00, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xBD,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xC0, 0x03, 0xFF,
-    0xC0, 0x00, 0x3C, 0x00, 0x3D, 0xBE, 0x00, 0x03, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0x3C, 0x00, 0x3D,
-    0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xD0, 0xBE, 0x00, 0x3C, 0x00, 0x3D, 0x03, 0xF4, 0x03, 0xC0, 0x03,
-    0xD0, 0x1F, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xBF, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF4, 0x3C, 0x00,
-    0x3D, 0x00, 0x0F, 0xC3, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x3C, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xC0,
-    0x03, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0x00, 0x02, 0xFC,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xC2, 0xFF, 0xE0, 0x07, 0xFF, 0x7F, 0xFF, 0xD0,
-    0x06, 0xFF, 0xE0, 0x7F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x1F,
-    0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00,
-    0xBD, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x07, 0xD0, 0x00, 0xBD, 0x01, 0xBF, 0xF4, 0x0B, 0xFF, 0x8F, 0xFF, 0xD0, 0x7F, 0xFF, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x01, 0xF0, 0x06, 0xF8, 0x3F,
-    0xFD, 0x00, 0x3C, 0x01, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0x03, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB,
-    0xD0, 0x00, 0x3C, 0x00, 0x3D, 0x3F, 0x00, 0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D,
-    0x0B, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x3F, 0x00, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03,
-    0xD0, 0x0B, 0xE0, 0x3C, 0x00, 0x3D, 0x00, 0x3F, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00,
-    0x3D, 0x00, 0x07, 0xE3, 0xC0, 0x03, 0xD0, 0x00, 0x3F, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xD0, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x1F,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x2F, 0xFE, 0x07, 0xFF, 0x7F, 0xFF, 0xD0, 0x6F,
-    0xFE, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x0B, 0xD0, 0xBF, 0xF4,
-    0x02, 0xF4, 0xFF, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x01, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xEF, 0xFF, 0x00, 0x03, 0xFD,
-    0x00, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xBE, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00,
-    0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00,
-    0xBF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00,
-    0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE,
-    0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x07, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40,
-    0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x00, 0x03, 0xF0, 0x0F, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F,
-    0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x2C, 0x00, 0x00, 0x03,
-    0xF0, 0x2F, 0x40, 0x00, 0x07, 0xF8, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x00, 0x07, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03,
-    0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01,
-    0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xE4, 0x03, 0xF0, 0x00, 0x3D, 0x07,
-    0xF4, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2C, 0x2F, 0x80, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x03, 0xF0, 0x55, 0x40, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x0B, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x05, 0x1F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xF0, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x1F, 0x03, 0xFE, 0x40, 0x3F, 0x00, 0x17,
-    0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0xBF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0xBF, 0xFC, 0x02, 0xF4, 0x3F, 0x00, 0x0B,
-    0xFD, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF2,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x3F, 0x40, 0x00, 0x7D,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xF4, 0x01, 0x80, 0xFF, 0xEF, 0xF2, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0x15, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0,
-    0x00, 0x03, 0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x07, 0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F,
-    0xD0, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF,
-    0x40, 0x2F, 0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F,
-    0xF7, 0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x07,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00,
-    0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0,
-    0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F, 0xFF, 0x40,
-    0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7, 0xFF, 0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x00, 0x06,
-    0x40, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x03, 0xF4, 0xBD, 0x00, 0x00, 0x00, 0xFE, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xBF, 0xF0, 0x00, 0x03,
-    0xF0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x03, 0xF5, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x1F, 0xD0, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x2F,
-    0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x04, 0x03, 0xC0, 0x1F, 0x00, 0xBC, 0x0F, 0x40, 0x0F, 0xCF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x1F, 0xF7, 0xFF,
-    0x2F, 0xFC, 0x6F, 0xEF, 0xAE, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xBD,
-    0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8,
-    0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00,
-    0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xCF, 0xD0, 0x03, 0xF0, 0x2F, 0x00, 0x78,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC,
-    0x1F, 0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00,
-    0xBD, 0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFB, 0xD0, 0x03,
-    0xD3, 0xF0, 0x0F, 0x80, 0xF4, 0x1E, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF,
-    0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C,
-    0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC1, 0xFD, 0x00, 0xFC, 0x2F, 0x40, 0x0B, 0xC3,
-    0xF0, 0x00, 0x7C, 0x3F, 0x00, 0x07, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x10,
-    0x00, 0x0F, 0xDB, 0x80, 0x00, 0xBD, 0xBC, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xFC, 0xBF, 0x00, 0x3F,
-    0x8B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x17, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8, 0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC,
-    0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00, 0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB,
-    0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x64, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0A, 0x00,
-    0xF8, 0x03, 0xF0, 0x07, 0xE0, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xD0, 0x0F, 0xC2, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x74, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0xFD, 0xB8, 0x00, 0x0B, 0xDB, 0xC0, 0x00, 0xBD,
-    0xBC, 0x00, 0x0F, 0xCB, 0xF0, 0x03, 0xF8, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x04, 0x00, 0x10, 0x2E, 0x00, 0xF8, 0x1F, 0x43, 0xF0, 0x0B, 0xCB, 0xC0, 0x03, 0xFF,
-    0x40, 0x00, 0xFE, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xF8,
-    0x0F, 0xEB, 0xFC, 0x2F, 0x00, 0xBC, 0x3E, 0x00, 0x3C, 0x3F, 0x00, 0x10, 0x2F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFC, 0x38, 0x00, 0x7D, 0x3C, 0x00,
-    0x3D, 0x3E, 0x00, 0xBC, 0x3F, 0xEB, 0xF4, 0x2F, 0xFF, 0xD0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4,
-    0x03, 0xF4, 0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x19, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x1B, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x80, 0x00, 0x90, 0x00, 0x1F, 0x40, 0x7E, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x03,
-    0xFB, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x03,
-    0xF4, 0x03, 0xEF, 0x40, 0x3F, 0x40, 0x3D, 0xF0, 0x03, 0xF4, 0x02, 0xD7, 0x00, 0x3F, 0x40, 0x28,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xA1,
-    0xD0, 0x03, 0xE1, 0xC0, 0x03, 0xE0, 0x40, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8,
-    0x57, 0xF5, 0x50, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4, 0x03,
-    0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x57, 0xF5, 0x50, 0xBF, 0xFF, 0xF0, 0x17, 0xF5, 0x50,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x3D, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x0B,
-    0xFF, 0x7D, 0x00, 0x00, 0x2E, 0x3F, 0xF4, 0x00, 0x00, 0x30, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x02,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0,
-    0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0,
-    0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4,
-    0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x2F, 0xE0, 0x2F, 0xFC, 0x02,
-    0xFF, 0x80, 0x1B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF8, 0x00, 0x3F, 0x80, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xEF, 0xFD, 0x00, 0x7F, 0xFD, 0x2F, 0xF4,
-    0x00, 0x15, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x30, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xF8, 0x01, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x02, 0x40, 0x00, 0x0B,
-    0xD0, 0x2D, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFE, 0x02,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0,
-    0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xF5, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0x9B, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x02, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xE0, 0xF4, 0x00, 0x00, 0x0B, 0x42, 0xE0, 0x00, 0x00,
-    0x2E, 0x0B, 0x40, 0x00, 0x00, 0x7D, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0,
-    0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00,
-    0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05,
-    0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x01, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0x02, 0xF8, 0x00, 0x00, 0x03, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x07, 0x81,
-    0xE0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0x00,
-    0x00, 0x7C, 0x2F, 0x00, 0x00, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F,
-    0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E,
-    0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF,
-    0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0x40, 0x01, 0xFF, 0xFE, 0x2F,
-    0xFF, 0x80, 0x03, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x40, 0x00,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x3E, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x3C, 0x3F, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x40, 0x7C, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0xB8, 0x1F, 0x40, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0xF4, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x0B, 0xC1, 0xF0, 0x0F, 0xC2, 0xF0, 0x00, 0x00,
-    0x07, 0xD2, 0xE0, 0x07, 0xD3, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xD0, 0x03, 0xE3, 0xC0, 0x00, 0x00,
-    0x02, 0xF7, 0xC0, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0B, 0x00, 0x3F, 0xFD,
-    0x3F, 0xFD, 0x00, 0xF4, 0x02, 0xFF, 0xC0, 0xFD, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x07, 0xE0, 0x02,
-    0xFC, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x3F, 0xD0, 0x0B, 0xC0, 0x02, 0xF4, 0x07, 0xFE, 0x00, 0xF8,
-    0x00, 0x1F, 0x80, 0xBA, 0xF0, 0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x1F, 0x42, 0xF0, 0x00, 0x0B, 0xC1,
-    0xF0, 0xF8, 0x3D, 0x00, 0x00, 0x3D, 0x2D, 0x0B, 0xC3, 0xC0, 0x00, 0x03, 0xF3, 0xC0, 0x7D, 0x78,
-    0x00, 0x00, 0x2F, 0x78, 0x03, 0xEF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xD7, 0xF0, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F,
-    0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD,
-    0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1,
-    0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFB, 0xE0, 0x00,
-    0x00, 0x3E, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80,
-    0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01,
-    0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00,
-    0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00,
-    0x3F, 0x43, 0xF8, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F,
-    0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00,
-    0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00, 0x0F,
-    0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0, 0x00,
-    0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xD1, 0xF4, 0x02, 0xF8, 0x1D,
-    0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x0B, 0xE0, 0x01, 0xE1, 0xF8,
-    0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00, 0x0F, 0xE0, 0x78, 0x00, 0x1F,
-    0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0, 0x00, 0x3C, 0x3F, 0x40, 0x00,
-    0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xD1, 0xF4, 0x02, 0xF8, 0x1D, 0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E,
-    0x0B, 0xE0, 0x01, 0xE1, 0xF8, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x06, 0x40, 0x0B, 0xC0, 0x2F, 0x40, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFE,
-    0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00,
-    0x0F, 0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0,
-    0x00, 0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3C, 0x02, 0xF0, 0x03, 0xE0, 0x7C,
-    0x00, 0x1F, 0x8F, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xD1, 0xF4, 0x02, 0xF8,
-    0x1D, 0x00, 0x7F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x0E, 0x0B, 0xE0, 0x01, 0xE1,
-    0xF8, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x2F, 0xAB, 0xF0, 0x07, 0xD0, 0x1D, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x05, 0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE, 0x1F, 0x80, 0x0B, 0xFF, 0xBF, 0xFF, 0xE0,
-    0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFC,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00,
-    0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x05, 0x00, 0xBC, 0x00, 0xBF, 0xFE, 0x3E, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x02, 0xF8, 0x2F,
-    0x40, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x0F, 0xC0, 0x2F, 0xD0, 0x0B,
-    0xE0, 0x03, 0xFF, 0xAF, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFE, 0xBF, 0xF8, 0x2F, 0x87, 0xE0, 0x07,
-    0xF8, 0xFC, 0x1F, 0x80, 0x07, 0xF2, 0xF0, 0x7E, 0x00, 0x0F, 0xC1, 0x41, 0xF8, 0x00, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x40, 0x01, 0xF8,
-    0x07, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xAB, 0xF0, 0x00,
-    0x07, 0xD0, 0x1D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x50, 0x00, 0x01, 0xF4, 0xBF, 0xF4, 0x00, 0x1F, 0xBF, 0xFF, 0xD0, 0x01,
-    0xFF, 0x91, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0xC0, 0x1F, 0x40, 0x00,
-    0xFC, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x1F,
-    0x40, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x03, 0xF0, 0x01, 0xF8, 0x01, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x1B, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0x57, 0xF5, 0x50, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFD, 0x00, 0x15, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x90, 0xB8, 0x01, 0xFA,
-    0xF0, 0x01, 0xFF, 0xD0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x3F, 0x00, 0x7D, 0xFC, 0x00, 0xFC, 0x00, 0xF2, 0xF4,
-    0x03, 0xF0, 0x03, 0xC3, 0xF0, 0x0F, 0xC0, 0x09, 0x01, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x7F, 0xAF, 0xC0, 0x0F, 0x80, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x57, 0xF5,
-    0x50, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x80, 0x3F, 0x40,
-    0x3E, 0xF4, 0x03, 0xF4, 0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03, 0xF4, 0x02, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x01, 0xF4, 0x08, 0x00, 0x00, 0x0F, 0xC2, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4,
-    0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF0,
-    0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x02, 0xFE, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x2F, 0xF0, 0x06, 0xBF,
-    0xD2, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07,
-    0xFF, 0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x08, 0x00, 0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x07,
-    0xF0, 0x03, 0xE0, 0x01, 0x00, 0x00, 0x40, 0x3E, 0x07, 0xF0, 0xFC, 0x3F, 0x47, 0xC0, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFE, 0x00, 0xBE, 0xF4, 0x1F, 0x4F, 0xC3, 0xE0, 0x3D, 0x78,
-    0x00, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x0D, 0x7F, 0xF7, 0xEB, 0x8F, 0xFD, 0x30, 0x2F, 0x80, 0x00,
-    0x00, 0x2A, 0xAA, 0x9B, 0xFF, 0xFE, 0x6A, 0xAA, 0x80, 0x00, 0x00, 0x07, 0x40, 0x09, 0xBD, 0x02,
-    0xD3, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x05, 0x00, 0x3D, 0xFF, 0xFF, 0x7D, 0x14, 0x01, 0x4F, 0xE0,
-    0xBF, 0xFE, 0x0B, 0xF7, 0xC0, 0x3D, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0xFD, 0xB8, 0x2F, 0x74, 0x2E,
-    0x00, 0x7C, 0x06, 0xF0, 0x07, 0x80, 0x03, 0x40, 0x0B, 0xE0, 0x3F, 0xFC, 0x78, 0x3D, 0xB4, 0x1E,
-    0xB8, 0x1E, 0x7D, 0x7C, 0x2F, 0xF4, 0x01, 0x40, 0x01, 0x00, 0x40, 0x1E, 0x07, 0x80, 0xFC, 0x3F,
-    0x07, 0xD1, 0xF4, 0x3E, 0x0F, 0x81, 0xF0, 0x7C, 0x03, 0x00, 0xC0, 0x00, 0x10, 0x00, 0x4B, 0x40,
-    0x3D, 0x7D, 0x0F, 0x82, 0xF2, 0xF0, 0x0F, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xA0, 0x00, 0x04, 0x01,
-    0x00, 0xB4, 0x2D, 0x03, 0xF0, 0xFC, 0x07, 0xD1, 0xF4, 0x0B, 0xC2, 0xF0, 0x0F, 0x43, 0xD0, 0x0C,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0xC7, 0x80, 0xBE, 0xB0, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x40, 0x7C, 0x0F, 0x03, 0xE0, 0x3D, 0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xC3, 0xF8, 0x3E, 0x0F, 0x83, 0xD2, 0xF0, 0xF0, 0x20, 0x00, 0x00, 0x0F, 0xCB, 0xF2, 0xF0,
-    0xBC, 0x1F, 0x03, 0xE0, 0x3C, 0x02, 0x00, 0x28, 0x3E, 0x3E, 0x3D, 0x3C, 0x34, 0x30, 0x00, 0x04,
-    0x0F, 0xC3, 0xF0, 0xF8, 0xBC, 0x3C, 0x08, 0x00, 0x14, 0xBF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x7E, 0xFE, 0x0B, 0xFB, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1F, 0xF4, 0x3C, 0x3C,
-    0x38, 0x2C, 0x3C, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x05, 0x0B, 0xE0, 0xFC, 0x3F, 0x0F, 0x4F, 0x81,
-    0x40, 0x19, 0x03, 0xFC, 0x1B, 0xE0, 0x3D, 0x0F, 0xC3, 0xF0, 0x14, 0x00, 0x00, 0x40, 0x7C, 0x07,
-    0xC0, 0x3E, 0x00, 0xFC, 0x02, 0xFF, 0xC2, 0xFE, 0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x28, 0x00, 0xB4, 0x00, 0x3F, 0xE0, 0x0B, 0xEF, 0x41, 0xF4, 0xBC, 0x3D, 0x02, 0xD1, 0x00, 0x04,
-    0x00, 0x00, 0x03, 0x00, 0x09, 0xBC, 0x01, 0xE7, 0xFA, 0xFC, 0x1F, 0xFF, 0x40, 0x1A, 0x40, 0x1A,
-    0x40, 0x83, 0xFD, 0x1D, 0xBE, 0xFF, 0xE7, 0x47, 0xFC, 0x10, 0x0A, 0x00, 0x7F, 0xFF, 0xEB, 0xFF,
-    0xFD, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0xC7, 0x80, 0xBE, 0xB0, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0xA0, 0x3F, 0x82, 0xFC, 0x3F, 0x82,
-    0xFC, 0x1F, 0x00, 0xF4, 0x3C, 0x07, 0xC0, 0x7C, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F,
-    0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B,
-    0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x15, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x7F, 0xFA, 0xBF, 0xE0, 0x03, 0xF0, 0x07, 0xF0,
-    0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xF8, 0x03, 0xF0, 0x01, 0xF4,
-    0x03, 0xF0, 0x03, 0xF0, 0x03, 0xFA, 0x5B, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFA, 0xAF, 0xFC,
-    0x03, 0xF0, 0x01, 0xFD, 0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xF0, 0x07, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xF4, 0x0F, 0xC0, 0x03, 0xD0, 0x3F,
-    0x00, 0x0B, 0x00, 0xFC, 0x00, 0x14, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0xBD, 0x00, 0x00, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x1F, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x00, 0xF4, 0x00, 0xBE, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xF0,
-    0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00,
-    0xBE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D,
-    0x00, 0xFC, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x15, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03,
-    0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3E, 0x00, 0x07, 0xF4, 0x7C, 0x00, 0x0F, 0xE0, 0x78, 0x00, 0x1F, 0xC0, 0x24, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x1C, 0x0F, 0xC0, 0x00, 0x3C, 0x3F, 0x40, 0x00, 0x7C, 0xBF, 0x00, 0x55,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x0F, 0xD5, 0x55, 0x57, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xD0, 0x01, 0xFF, 0xF8,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x55, 0x54, 0x0F, 0xCB, 0xE0, 0xBF, 0xFF, 0x03, 0xF2,
-    0xF8, 0x2F, 0xFF, 0xC0, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xFF,
-    0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0xFD, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x7F, 0xFF, 0x47, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03,
-    0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC1, 0xFC, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x3F, 0x80, 0x00, 0x00, 0x3F, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x03, 0xF0,
-    0x07, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xFD,
-    0x00, 0x7F, 0xE0, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xD0,
-    0x3F, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3D, 0x00,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xC0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x41, 0xBF, 0xE4, 0x00, 0xBF, 0xFD, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0x7F,
-    0x00, 0x0B, 0x7F, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0xF2, 0xF0, 0x00, 0x0F, 0x1F, 0x40, 0x1F, 0x2F,
-    0x00, 0x00, 0xF0, 0xFC, 0x02, 0xD2, 0xF0, 0x00, 0x0F, 0x0B, 0xC0, 0x3C, 0x1F, 0x00, 0x01, 0xF0,
-    0x7D, 0x07, 0x81, 0xF4, 0x00, 0x1F, 0x03, 0xE0, 0xB4, 0x1F, 0x40, 0x01, 0xF0, 0x2F, 0x0F, 0x00,
-    0xF4, 0x00, 0x2E, 0x00, 0xF5, 0xE0, 0x0F, 0x80, 0x02, 0xE0, 0x0F, 0xBD, 0x00, 0xF8, 0x00, 0x3E,
-    0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xD0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x02, 0xFF, 0xE0, 0x04, 0x00, 0xBF, 0xFD, 0xBF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0x6F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x03, 0xC0, 0x03, 0xFF, 0x00, 0x00,
-    0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xC0, 0x03, 0xDB, 0xE0, 0x00, 0x3C, 0x00, 0x3D, 0x3F, 0x40,
-    0x03, 0xC0, 0x03, 0xD1, 0xFC, 0x00, 0x3C, 0x00, 0x3D, 0x0B, 0xE0, 0x03, 0xC0, 0x03, 0xD0, 0x3F,
-    0x40, 0x3C, 0x00, 0x3D, 0x01, 0xFC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0xF0, 0x3C, 0x00, 0x3D, 0x00,
-    0x3F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0xFC, 0x3C, 0x00, 0x3D, 0x00, 0x07, 0xF3, 0xC0, 0x03, 0xD0,
-    0x00, 0x3F, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0xF0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x55, 0xFC,
-    0x3C, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x07, 0xC2, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x00, 0x2C, 0xB4, 0x00, 0x00, 0x0B, 0x6E, 0x00, 0x00, 0x03, 0xDB, 0xEA, 0xAA, 0xAA, 0xF6,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x0B, 0xF0,
-    0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00,
-    0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0x00,
-    0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xC0, 0x00, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFA, 0xBF, 0xF4, 0x03, 0xF0, 0x07,
-    0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xBD, 0x03, 0xF0, 0x00,
-    0xBD, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF0, 0x1B, 0xF0, 0x03, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xBC, 0x03, 0xF8, 0x00, 0x0F, 0x00, 0x3F, 0x40, 0x03, 0xC0, 0x07,
-    0xF4, 0x00, 0x60, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x10, 0x03, 0xF4, 0x00, 0x0F, 0x03, 0xF4, 0x00, 0x07, 0xC3, 0xF4, 0x00,
-    0x03, 0xE2, 0xFD, 0x55, 0x5A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xEF, 0x80, 0x3F, 0x40, 0x3E, 0xF4, 0x03, 0xF4, 0x03, 0xDF, 0x00, 0x3F, 0x40, 0x2D, 0x70, 0x03,
-    0xF4, 0x02, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x7F, 0x80, 0x00, 0x0F, 0xEB, 0xFF, 0x40, 0x00, 0xBF,
-    0x5A, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x7D, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x2F, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0xFD,
-    0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x40,
-    0x00, 0xFF, 0xFF, 0xEF, 0xFD, 0x00, 0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0xFD, 0x00, 0xFC, 0x01, 0xFC,
-    0x7F, 0x00, 0x3F, 0x00, 0x3F, 0xAF, 0x40, 0x0F, 0xC0, 0x07, 0xEF, 0xD0, 0x03, 0xF0, 0x01, 0xFF,
-    0xF4, 0x00, 0xFC, 0x00, 0x7E, 0xBE, 0x00, 0x3F, 0x00, 0x2F, 0x9F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC2,
-    0xFC, 0x03, 0xF0, 0x1F, 0xD0, 0x2F, 0xE5, 0xFD, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0x6F, 0xE5, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x01, 0xBF, 0xD0, 0x07, 0xF4, 0x00, 0x1F, 0x40, 0x00,
-    0xBF, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x00,
-    0x1F, 0xC7, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xF4, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xF8,
-    0x01, 0xBF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3F,
-    0x00, 0xFF, 0xFF, 0x00, 0xFC, 0x2F, 0x80, 0xBF, 0xF8, 0x02, 0xF8, 0x1F, 0xC0, 0x07, 0xD0, 0x03,
-    0xF0, 0x0F, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xD0, 0x07,
-    0xD0, 0x07, 0xE0, 0x0B, 0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xD0, 0x0B, 0xD0, 0x07,
-    0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xFC, 0x07, 0xD0, 0x3F,
-    0x40, 0x00, 0xFF, 0x47, 0xD1, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFA, 0xFF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x07, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0xB0,
-    0x7E, 0x00, 0x0F, 0xC2, 0xCF, 0x41, 0xF8, 0x03, 0xF0, 0x3D, 0xF9, 0x07, 0xD0, 0xFC, 0x17, 0xDF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x07, 0xD0, 0x03, 0xFF, 0xF4, 0xFC, 0x00, 0xFD, 0x0B, 0xCF, 0xC0, 0x2F, 0x40, 0x2E,
-    0xF8, 0x03, 0xF0, 0x00, 0xFF, 0x40, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0xBD,
-    0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0xFF,
-    0x00, 0x3F, 0x00, 0x1F, 0xF4, 0x02, 0xFC, 0x07, 0xCF, 0xC0, 0x0F, 0xFF, 0xF4, 0xFF, 0xE0, 0x2F,
-    0xFD, 0x07, 0xFC, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0xBF, 0xAF, 0xE0, 0x07, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0x2F, 0x40, 0xF8, 0x00, 0xBD, 0x07, 0xD0,
-    0x01, 0xF4, 0x1F, 0x40, 0x0B, 0xC0, 0xBD, 0x00, 0x3E, 0x02, 0xF4, 0x01, 0xF0, 0x0B, 0xD0, 0xFF,
-    0x40, 0x2F, 0x47, 0xFF, 0x80, 0xBD, 0x05, 0xBF, 0x82, 0xF4, 0x00, 0x3F, 0x4B, 0xD0, 0x00, 0x7F,
-    0x2F, 0x40, 0x00, 0xFC, 0xBD, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x3F, 0x2F,
-    0x40, 0x03, 0xF4, 0xBE, 0x00, 0x7F, 0xC2, 0xFF, 0xFF, 0xFC, 0x0B, 0xEF, 0xFF, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0xF8, 0xFF, 0xD0, 0x00, 0xFC, 0x0B, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0xFC, 0x01, 0xF8, 0x01,
-    0xF8, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x3F, 0x07,
-    0xC0, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x06, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xAB, 0xFF,
-    0x01, 0xF4, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x7E, 0x07, 0xFC, 0x03, 0xE0,
-    0x07, 0xF8, 0x3F, 0x00, 0x07, 0xF0, 0xF8, 0x00, 0x0F, 0xE7, 0xE0, 0x00, 0x1F, 0xAF, 0x40, 0x00,
-    0x7F, 0xBD, 0x00, 0x00, 0xFA, 0xF8, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0xFC,
-    0x2F, 0xD0, 0x0F, 0xD0, 0x2F, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0, 0xBD, 0x00, 0x70, 0x3E, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xE4, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xD0, 0x06, 0xC3, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x01,
-    0xA1, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x01, 0x50, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x16, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xC1, 0xFF,
-    0xE0, 0xFF, 0xC7, 0xFF, 0xF8, 0x0B, 0xDF, 0x82, 0xFC, 0x03, 0xFE, 0x00, 0xBD, 0x02, 0xFC, 0x00,
-    0x7E, 0x02, 0xF8, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x00,
-    0x3E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x00,
-    0x3E, 0x02, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x64, 0x00, 0x1A, 0x90, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xAF, 0xF4,
-    0x03, 0xF0, 0x07, 0xF0, 0x1F, 0x40, 0x0B, 0xE0, 0xBC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x0F,
-    0x40, 0x00, 0xBD, 0x7D, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x03, 0xEB, 0xEA, 0xAA, 0xAF, 0xAF, 0xFF,
-    0xFF, 0xFE, 0xBE, 0xAA, 0xAA, 0xFA, 0xF0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x3D, 0x3E, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x0B, 0xC2, 0xF4, 0x00, 0x3F, 0x07, 0xF0, 0x01, 0xF4,
-    0x0F, 0xE0, 0x0F, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0x7F, 0xFE, 0x2F, 0xFC, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x0B, 0xD0, 0x07, 0xFC, 0x2F, 0x40, 0x7F, 0x80,
-    0xBD, 0x07, 0xF0, 0x02, 0xF4, 0x3F, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x2F, 0x6F, 0x80, 0x00, 0xBE,
-    0xFF, 0x00, 0x02, 0xFF, 0x7C, 0x00, 0x0B, 0xF4, 0xF8, 0x00, 0x2F, 0x82, 0xF0, 0x00, 0xBD, 0x03,
-    0xF0, 0x02, 0xF4, 0x0F, 0xE0, 0x0B, 0xC0, 0x0F, 0xFF, 0xEF, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x05,
-    0x40, 0x02, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3B, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x02, 0xEF, 0xC0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x07, 0xC7, 0xE0, 0x00,
-    0x00, 0xF8, 0x3F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0x40, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x03,
-    0xF4, 0x00, 0x3F, 0xFC, 0xBE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD,
-    0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xBC,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B, 0xE0,
-    0x01, 0xFD, 0x00, 0xBF, 0x00, 0x2F, 0xE0, 0x0B, 0xFC, 0x0B, 0xEF, 0x40, 0xBF, 0xFF, 0xF8, 0xFF,
-    0xDB, 0x9F, 0xFE, 0x0B, 0xFC, 0xBC, 0x15, 0x00, 0x14, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xF8, 0xFF, 0xD0, 0x00,
-    0xFC, 0x0B, 0xF0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x02,
-    0xF4, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x1F, 0x0B,
-    0x80, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x7C,
-    0x00, 0x5D, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0x40, 0x02, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xF0,
-    0x01, 0xFF, 0xF0, 0x0B, 0xE5, 0x40, 0x2F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xE4, 0x00, 0x0B, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x03, 0xF4,
-    0x0B, 0xF8, 0x2F, 0x40, 0x0B, 0xF0, 0xFC, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x2F, 0x9F, 0x40, 0x00,
-    0x7E, 0xBD, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x07, 0xEB, 0xE0, 0x00, 0x1F, 0x5F, 0xC0, 0x00, 0xBC,
-    0x3F, 0x40, 0x03, 0xE0, 0xBF, 0x40, 0x3F, 0x00, 0xFF, 0xEF, 0xF4, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xEF, 0xEA, 0xBF, 0xA8, 0x38, 0x1F, 0x00, 0xF4, 0x00, 0x80, 0xBC, 0x03, 0xC0, 0x00,
-    0x02, 0xE0, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x00, 0xF8,
-    0x07, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0x40, 0x3E, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x02,
-    0xF8, 0x03, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0xBD, 0x00, 0x0B, 0xD2, 0xF0, 0x00, 0x2F, 0x8F, 0xC0,
-    0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0xBF, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xEF, 0xFD, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1F,
-    0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0x40, 0xFE, 0x2F, 0x00, 0x0F, 0x8F, 0xC0, 0x03, 0x87, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x07, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xD5, 0xFD, 0x64, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x3F,
-    0x01, 0xF4, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0xBD, 0x0B, 0xE0, 0x00,
-    0x3F, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x07, 0xE0, 0x0B, 0xF4, 0x07, 0xF0, 0x00, 0xFF,
-    0xEF, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xAB, 0xFA, 0xA8, 0x74, 0x0F, 0x80, 0x00, 0x80,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x01, 0xF0, 0x7F, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0xBD,
-    0x03, 0xE0, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0xFC,
-    0x01, 0xFC, 0x02, 0xF4, 0x00, 0xBF, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF4, 0x2F, 0x06,
-    0xFE, 0x02, 0xF8, 0x02, 0xF0, 0x07, 0xF0, 0x3F, 0x00, 0x2F, 0x00, 0x2F, 0x87, 0xE0, 0x02, 0xF0,
-    0x00, 0xFC, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xCB, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0xBD, 0x00, 0x2F,
-    0x00, 0x0F, 0xC7, 0xE0, 0x02, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0x83, 0xFC, 0x02,
-    0xF0, 0x03, 0xF0, 0x0F, 0xF4, 0x2F, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x3F, 0x07, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x0B, 0xC0, 0x00,
-    0x3F, 0x03, 0xE0, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x1F, 0xBC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0xF4,
-    0x2F, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x2F,
-    0x80, 0x03, 0xF9, 0x1F, 0xC0, 0x00, 0xBF, 0xD2, 0xD0, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xF0, 0x03,
-    0xE0, 0x0F, 0x4B, 0xFF, 0x00, 0x3E, 0x00, 0xBC, 0x03, 0xF0, 0x03, 0xE0, 0x0B, 0xD0, 0x3E, 0x00,
-    0x3E, 0x00, 0x7E, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x07, 0xE0,
-    0x03, 0xE0, 0x03, 0xF0, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x03, 0xF0, 0x3F,
-    0x00, 0x3E, 0x00, 0x7E, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0xC0, 0x3E, 0x02, 0xF8, 0x00,
-    0xFF, 0x43, 0xE0, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0,
-    0x03, 0xD0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x3E, 0x00, 0xBD, 0x3F, 0x00, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x7E, 0x00,
-    0x3E, 0x00, 0x3F, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x7F, 0x00, 0x3F,
-    0x00, 0x3E, 0x3F, 0x00, 0x7F, 0x00, 0x7D, 0x2F, 0xC0, 0xFF, 0x80, 0xFC, 0x0F, 0xFB, 0xE3, 0xFB,
-    0xF4, 0x03, 0xFF, 0x81, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4,
-    0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55,
-    0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0,
-    0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0,
-    0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40,
-    0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3,
-    0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x1F,
-    0x40, 0x00, 0x00, 0x02, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00,
-    0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xF0, 0x7C, 0x00,
-    0x03, 0x80, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFB,
-    0xFC, 0x00, 0xFD, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x05, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0xAF, 0xC0, 0x3F, 0x40, 0x3F, 0x02,
-    0xF4, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0xD0, 0x3F, 0xFF, 0xEF, 0xFC, 0x3F,
-    0xFC, 0x3F, 0xC0, 0x15, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x74, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xF7, 0xF4, 0x00, 0x3F, 0x03, 0xF0, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00,
-    0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01,
-    0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xA0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x00,
-    0x00, 0x00, 0xA0, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF,
-    0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x07, 0xF0, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x3F, 0x03, 0xF0, 0x01,
-    0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF,
-    0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0,
-    0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3,
-    0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x4B, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x02, 0xA0, 0x78, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0x00, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x04,
-    0x3D, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xB4, 0x60, 0x00, 0x3F, 0xF4, 0x00,
-    0x02, 0xF7, 0xF4, 0x00, 0x2F, 0x42, 0xF0, 0x01, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00,
-    0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01,
-    0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x78, 0x00, 0x00,
-    0x00, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x00,
-    0x00, 0x00, 0xA0, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF,
-    0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0xE0, 0x10, 0x00, 0x3F, 0xF0,
-    0xE0, 0x00, 0xF7, 0xFF, 0x80, 0x03, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBD, 0xFE, 0x00, 0x0B, 0xC0, 0xBD, 0x00, 0x7C, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4,
-    0x0B, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x17,
-    0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0,
-    0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00,
-    0x54, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x00,
-    0xF0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x3E, 0xF8, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0xF0, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0,
-    0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD,
-    0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x81, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA,
-    0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x03, 0xE0,
-    0x0F, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80,
-    0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00,
-    0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE, 0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x21,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00,
-    0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC,
-    0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0xE0, 0x00, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0xFF, 0xBF, 0xC0, 0x0F, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0x3E, 0x00, 0x74, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x5F, 0xC0, 0x02, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xFC, 0x03, 0xF4,
-    0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x01, 0xFC, 0x03, 0xFD, 0x03, 0xFF, 0xFE,
-    0xFF, 0xC3, 0xFF, 0xC3, 0xFC, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x09, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0x08, 0x2C, 0x00, 0x00,
-    0x00, 0xBD, 0x5F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC,
-    0x00, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA,
-    0xAF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0x6F, 0x00, 0x00,
-    0x70, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x03, 0x80,
-    0x03, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFE, 0xFF, 0x00,
-    0x3F, 0x40, 0xBE, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0x7F, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xEB, 0xF0, 0x0F, 0xD0, 0x0F, 0xC0, 0xBD, 0x00,
-    0x3F, 0x02, 0xF4, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xF4, 0x0F, 0xFF, 0xFB, 0xFF, 0x0F, 0xFF, 0x0F,
-    0xF0, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x90, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF2,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x55, 0x6F, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0xD0, 0x00, 0x1F,
-    0x40, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x0B,
-    0xC0, 0x00, 0x01, 0xFC, 0x06, 0xFF, 0x90, 0x01, 0xFF, 0xFC, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xC0,
-    0x02, 0x90, 0x10, 0x00, 0x2F, 0xE0, 0xD0, 0x00, 0xFB, 0xFF, 0x40, 0x03, 0x43, 0xFC, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x30, 0x00, 0x70, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x3F, 0xEF, 0xF0, 0x03, 0xF4, 0x0B, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x17, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0x00, 0xFD,
-    0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0xFF,
-    0xBF, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF5, 0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xEA, 0xAA,
-    0xFD, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0xC0, 0x6F, 0xF9, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x70, 0x00, 0xF8, 0x07, 0xC0, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0xEF, 0xF0, 0x03,
-    0xF4, 0x0B, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x17, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFE, 0xBF, 0x00, 0xFD, 0x00, 0xFC, 0x0B, 0xD0, 0x03,
-    0xF0, 0x2F, 0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xFF, 0x40, 0xFF, 0xFF, 0xBF, 0xF0, 0xFF, 0xF0, 0xFF,
-    0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2D,
-    0x00, 0xFC, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x15, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x18, 0x03,
-    0xF0, 0x00, 0x0F, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x16, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00, 0xFD, 0x3F,
-    0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x90,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x20,
-    0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xF0, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x0B, 0x40, 0x3F, 0x00, 0x01, 0xC0, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x05, 0x55, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0x00, 0xF0,
-    0x0F, 0xC0, 0x05, 0xBC, 0x2F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFF, 0x40, 0x0B, 0x82, 0xF0, 0x01, 0xD0, 0xB8, 0x00, 0x00, 0x7C,
-    0x00, 0x01, 0xBC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFE, 0x07, 0xE0, 0x0F, 0xD3, 0xF0, 0x01, 0xF9, 0xF4, 0x00,
-    0x3F, 0xBD, 0x00, 0x0F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x19, 0x0F, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0x80, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xD0, 0x00, 0x1F, 0xFD,
-    0xBC, 0x00, 0x07, 0xDB, 0xFE, 0x00, 0x00, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x03, 0x40, 0x7F, 0xF7, 0xE0, 0x2E, 0x3F, 0xF4, 0x03, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x81, 0xF8, 0x03, 0xF4,
-    0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x0F, 0xEF, 0x40, 0x03, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x06,
-    0x43, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF8, 0x34, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBC, 0x0F, 0x80,
-    0x00, 0x28, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0, 0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x40, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3C, 0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xF9, 0xFC, 0x00,
-    0x1F, 0x81, 0xF4, 0x00, 0xF8, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xE0, 0x0F, 0xD0, 0x3F, 0x00, 0x1F, 0x81, 0xF4, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x19, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF8, 0x24, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBC, 0x0F,
-    0x80, 0x00, 0x28, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0, 0x0F, 0xC0, 0x00, 0x70, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x40,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3C, 0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0x80, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xF9, 0xF8, 0x01, 0xF8, 0x1F, 0x40,
-    0xF8, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0,
-    0x7E, 0x00, 0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xF8, 0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x79, 0xF4, 0x00, 0x00, 0x08, 0x2D, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0xA8, 0x2D, 0x00, 0x00, 0xFF, 0xC2, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0xBC, 0x0F, 0x80, 0x00, 0x28, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0, 0x0F, 0xC0,
-    0x00, 0x70, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC1, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00,
-    0xF0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x01, 0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00,
-    0x10, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1B, 0x82, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x0B, 0x80, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0x80,
-    0x3F, 0x40, 0x3F, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x0F, 0xC0, 0xBF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xD0, 0x00, 0x0F,
-    0xFD, 0x74, 0x00, 0x03, 0x87, 0xFC, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x28, 0x00, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00,
-    0x0F, 0x40, 0x3F, 0x00, 0x02, 0xD0, 0x0F, 0xC0, 0x00, 0x70, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0x80, 0x3F, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x01,
-    0x6F, 0x0B, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xE4, 0x04, 0x00, 0xFF, 0x87,
-    0x00, 0x79, 0xFF, 0xC0, 0x1C, 0x1F, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x02, 0xA0, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xF7, 0xF0, 0x03, 0xE0, 0x3F, 0x02, 0xE0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x81, 0xF8, 0x03, 0xF4, 0xFC, 0x00, 0x7E, 0x7D, 0x00,
-    0x0F, 0xEF, 0x40, 0x03, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x43, 0xFF, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x78, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xB4, 0x03, 0xF0, 0x00, 0x1C, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x55, 0x50, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x60, 0x0F, 0xC0, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x0F, 0x00,
-    0xFC, 0x00, 0x5B, 0xC2, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0xFE, 0x00, 0x02, 0xFB, 0xD0, 0x01, 0xF4, 0xFC, 0x00, 0xF8, 0x0F, 0x40, 0x78, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x7E, 0x00,
-    0xFD, 0x3F, 0x00, 0x1F, 0x9F, 0x40, 0x03, 0xFB, 0xD0, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF8,
-    0x01, 0x90, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x43, 0xFB, 0xF1, 0xF0, 0x7D, 0x24, 0x1F, 0x00, 0x2F, 0x40, 0x3E, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0xFF, 0xF8, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0xFF,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xFF, 0x03, 0xD0, 0xF8, 0x2C, 0x0F, 0x40,
-    0x02, 0xF0, 0x01, 0xF8, 0x00, 0x2D, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x40, 0x7F, 0xF4, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x1B,
-    0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBF,
-    0xFD, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x07, 0xF4, 0x02, 0xFD, 0x00, 0x7F,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0x40, 0x07, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x01, 0xBF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x5A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xBF, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFE, 0x00, 0x00,
-    0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xD0, 0x02,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F,
-    0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01,
-    0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1E, 0x07,
-    0xC0, 0x00, 0x00, 0x02, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x90,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xEF, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x2F,
-    0xF0, 0x02, 0xFC, 0x00, 0x01, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xBE, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x03,
-    0xF2, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x40,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xF0, 0x3D, 0x00,
-    0x00, 0xB0, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8,
-    0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0,
-    0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC3, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x02, 0x80, 0x08, 0x00,
-    0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF, 0xC0,
-    0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF0,
-    0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB,
-    0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x07,
-    0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBD, 0xFD, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xC0, 0x0B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC,
-    0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x00, 0x02, 0x80, 0x08, 0x00, 0x00, 0x00, 0x05, 0xA4,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x0B,
-    0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00, 0x00,
-    0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x03,
-    0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xD0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0F, 0xD1, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xBD, 0xFD, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0,
-    0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8,
-    0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xDF, 0x40, 0x00, 0x00, 0x00, 0x92, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0A, 0x81, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x20, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0xB8, 0x00, 0x00, 0x02, 0x80, 0x09, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFB, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x04, 0x2E, 0x00, 0x00, 0x01, 0xBC,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x0A, 0xD0, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBD, 0xBE, 0x00,
-    0x01, 0xF4, 0x2F, 0x40, 0x03, 0xD0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4,
-    0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0,
-    0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x09, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0x80, 0x00,
-    0x00, 0x38, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x00,
-    0x02, 0x80, 0x09, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFB, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0,
-    0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x80,
-    0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0xBE, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x07, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0xB8, 0x04, 0x00, 0x02, 0xFF, 0x0F, 0x00,
-    0x03, 0xDB, 0xFE, 0x00, 0x02, 0x82, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7D, 0xBF, 0x00, 0x01, 0xF4, 0x1F, 0x80, 0x03, 0xD0, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD0, 0x1F, 0xF0, 0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC,
-    0xBC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0xBC, 0x00, 0x00, 0x03, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xF0, 0x00, 0x3F, 0xD0, 0x02,
-    0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xE0, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3E, 0xFC, 0x00,
-    0x00, 0xBC, 0x7E, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x02, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0,
-    0x3F, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x01, 0xF8,
-    0x3F, 0x40, 0x03, 0xF0, 0x2F, 0xD0, 0x0B, 0xE0, 0x0F, 0xFE, 0xBF, 0x80, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x06, 0x80, 0x00, 0x09, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x05, 0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE, 0x1F, 0x80, 0x0B, 0xFF,
-    0xBF, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xC0,
-    0x00, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xBE,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x07,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01,
-    0x40, 0x2F, 0x00, 0x2F, 0xFF, 0x8F, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0x40, 0x7F, 0xC0, 0x3F,
-    0x00, 0x03, 0xF4, 0x0F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x07,
-    0xE0, 0x3F, 0x40, 0x03, 0xF0, 0x0B, 0xF4, 0x02, 0xF8, 0x00, 0xFF, 0xEB, 0xF8, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x06, 0x80, 0x00, 0x00, 0x14, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x05,
-    0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE, 0x1F, 0x80, 0x0B, 0xFF, 0xBF, 0xFF, 0xE0, 0x03, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0x40, 0x2F, 0x00, 0x2F, 0xFF,
-    0x8F, 0x80, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0x40, 0x7F, 0xC0, 0x3F, 0x00, 0x03, 0xF4, 0x0F, 0x80,
-    0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F,
-    0x40, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x03, 0xF0,
-    0x0B, 0xF4, 0x02, 0xF8, 0x00, 0xFF, 0xEB, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x02, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x06, 0x80, 0x00, 0x03, 0x80, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x05, 0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE, 0x1F, 0x80, 0x0B,
-    0xFF, 0xBF, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x80, 0x1F,
-    0xC0, 0x00, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0xB0,
-    0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x07, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x14, 0x02, 0xF0, 0x02, 0xFF, 0xF8, 0xF8,
-    0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xF4, 0x07, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0xF8, 0x00, 0x0B,
-    0xE0, 0xBD, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xF4, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0xBF,
-    0x40, 0x2F, 0x80, 0x0F, 0xFE, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0xBC, 0x00,
-    0x00, 0x01, 0xF6, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0x0B, 0xF0, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x05, 0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE,
-    0x1F, 0x80, 0x0B, 0xFF, 0xBF, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xC0, 0x00, 0x3F, 0xF9, 0xF0, 0x00, 0x0F, 0x5F, 0xFC,
-    0x00, 0x01, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x05,
-    0x00, 0xBC, 0x00, 0xBF, 0xFE, 0x3E, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x1F,
-    0x80, 0xFD, 0x00, 0x0F, 0xC0, 0x2F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xAF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x05, 0xA4, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xFE,
-    0x1F, 0x80, 0x0B, 0xFF, 0xBF, 0xFF, 0xE0, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x80, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00,
-    0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x05,
-    0x00, 0xBC, 0x00, 0xBF, 0xFE, 0x3E, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0xFC,
-    0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x1F,
-    0x80, 0xFD, 0x00, 0x0F, 0xC0, 0x2F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xAF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFE, 0x00, 0x0B, 0xFF,
-    0x80, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x00,
-    0x00, 0x7C, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x1B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00,
-    0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80,
-    0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB,
-    0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x90, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF8, 0x01,
-    0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x1C, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0xF0, 0x0B, 0xFE,
-    0x00, 0x6F, 0x80, 0x02, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFE, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xBF, 0xF4, 0x01, 0xFF, 0xF4, 0xBF, 0xD0, 0x00,
-    0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00,
-    0xB4, 0x00, 0x00, 0x90, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00,
-    0x01, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xBF, 0xC0, 0x1A, 0xFF, 0x4B, 0xFF, 0x00, 0xBF, 0xE0, 0x06,
-    0xF8, 0x00, 0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8,
-    0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F,
-    0xE0, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40,
-    0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0xB4, 0x00,
-    0x00, 0x01, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4,
-    0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF0,
-    0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x02, 0xFE, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0xBF, 0xC0, 0x1A, 0xFF, 0x4B, 0xFF, 0x00, 0xBF, 0xE0, 0x06, 0xF8, 0x00,
-    0x2F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E,
-    0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x1F,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0x40, 0x1F, 0xFF, 0x4B, 0xFD, 0x00, 0x05, 0x40, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x90, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x0F,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00,
-    0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xE0, 0x06, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x1C, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xFC, 0x01, 0xAF, 0xF4, 0xBF, 0xF0, 0x0B, 0xFE,
-    0x00, 0x6F, 0x80, 0x02, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-    0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00,
-    0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFE, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xBF, 0xF4, 0x01, 0xFF, 0xF4, 0xBF, 0xD0, 0x00,
-    0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x38, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0xF0, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0x81, 0xFC, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40,
-    0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00,
-    0x01, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x07, 0x00, 0x00, 0x0B, 0xFF, 0x7D, 0x00, 0x00, 0x2E, 0x3F, 0xF4, 0x00, 0x00, 0x30,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xBD, 0x2F, 0xF0, 0x06, 0xBF, 0xD2, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B, 0xE0, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE, 0x00, 0x07,
-    0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF, 0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00,
-    0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x0B,
-    0xD0, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x6F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xBD, 0x2F, 0xF0, 0x06, 0xBF, 0xD2, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xBE, 0x00, 0x0B,
-    0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00,
-    0x3E, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0x80,
-    0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x07, 0xFE,
-    0x00, 0x07, 0xFF, 0xFE, 0xFF, 0xD0, 0x07, 0xFF, 0xD2, 0xFF, 0x40, 0x01, 0x50, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03, 0xF4,
-    0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3, 0xE0,
-    0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5,
-    0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE,
-    0x00, 0x6F, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00,
-    0x2F, 0x00, 0x00, 0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0,
-    0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x7F, 0xFE, 0x03, 0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-    0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F,
-    0x00, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x01,
-    0x40, 0x00, 0xBF, 0x00, 0xFD, 0x0B, 0xFF, 0xD0, 0x1F, 0xD0, 0xBF, 0xF4, 0x00, 0xFC, 0x02, 0xE8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x00, 0x06, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8, 0x03,
-    0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x7F,
-    0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0xE3,
-    0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x00, 0x38, 0x1F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x7F,
-    0xFD, 0x02, 0xFF, 0x80, 0xFD, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F,
-    0x80, 0x02, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x03,
-    0xE0, 0xBC, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0xAE, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xB0, 0x00, 0x00, 0x3F, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7F,
-    0xF0, 0x00, 0x00, 0x1C, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFE, 0x7F, 0xFE, 0x00, 0x6F, 0xF8,
-    0x03, 0xF4, 0x00, 0x0B, 0xC0, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFD, 0x00, 0x2F, 0x00, 0x00,
-    0x7F, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B,
-    0xE3, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x38, 0x00, 0x00, 0xFF, 0xD7, 0xC0, 0x00, 0x0F, 0x1F, 0xF8, 0x00, 0x00, 0xA0, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x03, 0xFF, 0xC7, 0xFF, 0xD0, 0x2F, 0xF8, 0x0F, 0xD0, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x1F, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x3D, 0x00, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x1F, 0x5F, 0x00, 0x00,
-    0x00, 0xFA, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00,
-    0x00, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x50, 0x57, 0x5D,
-    0x1F, 0x40, 0xF0, 0x3F, 0xC5, 0xA5, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x34, 0x6A, 0xAB,
-    0xDB, 0xAA, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x07,
-    0x40, 0x01, 0xC0, 0x00, 0x7E, 0xAA, 0x97, 0xEA, 0xAE, 0x1D, 0x00, 0x60, 0x74, 0x06, 0x00, 0xD0,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0x6A, 0xAA, 0x7F, 0xFF, 0xEB, 0xFF, 0xF4, 0xBF, 0xFF,
-    0xFF, 0xEB, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF,
-    0xEA, 0xAA, 0xAA, 0xAA, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x14, 0x01, 0x43, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E,
-    0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E,
-    0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03,
-    0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3,
-    0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE2, 0x90, 0x29, 0xAA, 0xAA, 0xAA, 0xA7,
-    0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xE0, 0xF0, 0xB8, 0x3D, 0x1F, 0x4B, 0xD1,
-    0xFC, 0x3F, 0x00, 0x00, 0x01, 0x01, 0xFC, 0x0F, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0F, 0x41, 0xF0,
-    0x3C, 0x00, 0x00, 0x01, 0x01, 0xFC, 0x0F, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0F, 0x41, 0xF0, 0x3C,
-    0x00, 0x00, 0x04, 0x0F, 0xDB, 0xF2, 0xF4, 0x7D, 0x0F, 0x42, 0xE0, 0x3C, 0x07, 0x80, 0x00, 0x01,
-    0x00, 0x10, 0x1E, 0x02, 0xD0, 0xF0, 0x1F, 0x0B, 0x80, 0xF4, 0x3D, 0x07, 0xC1, 0xF4, 0x2F, 0x0B,
-    0xD0, 0xFD, 0x1F, 0xC2, 0xFC, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x1F, 0xC2,
-    0xFC, 0x0F, 0xD0, 0xFC, 0x0B, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF4,
-    0x1F, 0x02, 0xE0, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x1F, 0xC2, 0xFC, 0x0F,
-    0xD0, 0xFC, 0x0B, 0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x0B, 0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x1F, 0x02,
-    0xE0, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFD, 0x1F, 0xCB, 0xF0, 0xBE, 0x2F,
-    0x43, 0xF0, 0x7D, 0x0B, 0xC0, 0xF4, 0x1F, 0x02, 0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0x40, 0x01, 0x40, 0xF4, 0x04, 0x3F, 0xEF, 0xBF, 0xD3, 0xFF, 0xFF, 0xFD, 0x25,
-    0x0F, 0x41, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x01, 0x40, 0xF4, 0x04, 0x3F, 0xEF, 0xBF, 0xD3, 0xFF,
-    0xFF, 0xFD, 0x25, 0x0F, 0x41, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x15, 0x0F, 0x41, 0x83, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xD1, 0x40, 0xF4, 0x14, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF, 0x2F, 0xFD, 0x7F, 0xF0,
-    0xFF, 0x80, 0x50, 0x00, 0x74, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFE, 0xFF, 0xFE, 0x0F, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x05, 0x03, 0xFC,
-    0x3F, 0xC3, 0xF8, 0x05, 0x00, 0x05, 0x00, 0x14, 0x3F, 0x80, 0xFF, 0x7F, 0x80, 0xFF, 0x3F, 0x40,
-    0xFE, 0x04, 0x00, 0x10, 0x05, 0x00, 0x00, 0x50, 0x00, 0x14, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F,
-    0xC3, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFE, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x04, 0x00, 0x00,
-    0x40, 0x00, 0x14, 0x00, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x1D, 0x00, 0x00, 0x34, 0x60, 0x2B, 0xDB, 0x02, 0xBD, 0xA0, 0x07, 0x4A, 0x01, 0xD0, 0xA0, 0x74,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xC0, 0x00, 0x7E, 0x80, 0x97, 0xE8, 0x0E, 0x1D,
-    0x00, 0x60, 0x74, 0x06, 0x00, 0xD0, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-    0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60,
-    0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
-    0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x90, 0x00, 0x2F, 0x40, 0x07, 0xAD, 0x01, 0xCA, 0x34,
-    0x30, 0xA0, 0xC0, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD3, 0x40,
-    0x00, 0x74, 0xE0, 0x00, 0x1D, 0x38, 0x6A, 0xAF, 0x4E, 0xEA, 0xAF, 0x4D, 0xD0, 0x1D, 0x34, 0xD0,
-    0x70, 0xD0, 0xD1, 0xC3, 0x40, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC7, 0x40, 0x0B, 0x1D, 0x00, 0x2C, 0x74, 0x00, 0xB1, 0xFA, 0xA9, 0x70, 0xFA, 0xAB,
-    0x1C, 0x34, 0x07, 0x07, 0x0D, 0x07, 0x01, 0xC3, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0xB8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0xF4, 0x3C, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x02, 0xF0, 0x2F, 0x07, 0x43, 0xFF,
-    0xF0, 0x03, 0xFF, 0xF0, 0x0F, 0xEF, 0xD0, 0xF0, 0xBC, 0x0F, 0x80, 0xFC, 0x1F, 0x40, 0x3F, 0xF0,
-    0x2C, 0x0F, 0x40, 0xBC, 0x0F, 0x00, 0xBC, 0x00, 0x00, 0x07, 0x81, 0xF0, 0x03, 0xC2, 0xF0, 0x07,
-    0xC0, 0x00, 0x00, 0xF0, 0x2F, 0x00, 0x3D, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x02, 0xF0, 0x03,
-    0xD3, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x3C, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0xB4,
-    0x01, 0xF0, 0x07, 0xC2, 0xF0, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0xF8, 0x1F, 0x40, 0xF4,
-    0x00, 0x03, 0xD0, 0x00, 0xBE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xE0, 0xBD, 0x0F, 0xC2, 0xF4, 0x3E,
-    0x07, 0xC0, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x34, 0x07, 0xE0, 0xBC, 0x0B, 0xD0,
-    0xFC, 0x0F, 0xC2, 0xF8, 0x2F, 0x43, 0xF0, 0x3E, 0x07, 0xD0, 0x7C, 0x0F, 0x80, 0xF4, 0x0F, 0x00,
-    0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0D, 0x02, 0xC0, 0x7E, 0x0B, 0xC0, 0xFC,
-    0x2F, 0x43, 0xF0, 0x7E, 0x0F, 0xC2, 0xF8, 0x3F, 0x0B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0x7D, 0x0B,
-    0xC1, 0xF0, 0x3E, 0x03, 0xD0, 0xF4, 0x0F, 0x01, 0xE0, 0x04, 0x01, 0x00, 0x20, 0x00, 0x00, 0x07,
-    0x40, 0xFC, 0x0F, 0xD0, 0x7F, 0x03, 0xF0, 0x0F, 0x80, 0x7C, 0x02, 0xD0, 0x08, 0x00, 0x00, 0x00,
-    0x74, 0x02, 0xC0, 0xFC, 0x0B, 0xC0, 0xFD, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x3F, 0x01, 0xF8, 0x0F,
-    0x80, 0xFC, 0x07, 0xC0, 0x3D, 0x02, 0xD0, 0x1E, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x0B, 0x00, 0xB0, 0x0F, 0xC0, 0xBC, 0x07, 0xE0, 0x3F, 0x41, 0xF8, 0x0F, 0xC0, 0x7F, 0x03,
-    0xF0, 0x2F, 0x40, 0xFC, 0x07, 0xE0, 0x3F, 0x00, 0xF8, 0x0F, 0xC0, 0x7D, 0x01, 0xF0, 0x0F, 0x40,
-    0xF8, 0x02, 0xD0, 0x1E, 0x00, 0xF0, 0x02, 0x00, 0x10, 0x01, 0x40, 0x00, 0x18, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0xB8, 0x00, 0x1F, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x0F, 0x40, 0x0B, 0x80, 0x00,
-    0x24, 0x03, 0xD0, 0x7E, 0x07, 0xE0, 0xBF, 0x03, 0xF4, 0x0B, 0xE0, 0x0B, 0xD0, 0x0B, 0xD0, 0x07,
-    0xC0, 0x03, 0x40, 0x20, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0xFD, 0x02,
-    0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0x34, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00,
-    0x00, 0x1E, 0x2D, 0x00, 0xF0, 0x07, 0x80, 0xB4, 0x1F, 0x40, 0xE0, 0x02, 0xC0, 0xA0, 0x38, 0x00,
-    0x0B, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0A, 0x03, 0xFC,
-    0x0A, 0x01, 0xF8, 0x0F, 0x01, 0xF4, 0x0F, 0x42, 0xF8, 0x0F, 0x00, 0x00, 0xB5, 0xE0, 0x00, 0x00,
-    0x2D, 0x07, 0x80, 0x00, 0x07, 0x40, 0x1D, 0x00, 0x01, 0xE0, 0x50, 0x74, 0x00, 0x78, 0x1F, 0x42,
-    0xD0, 0x0E, 0x01, 0xF4, 0x0B, 0x43, 0x80, 0x05, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x1A, 0x1F, 0xC0, 0x1F, 0x8B, 0xE0, 0x0B, 0xE2, 0xF4, 0x03, 0xF4,
-    0xBD, 0x00, 0xFD, 0x2F, 0x40, 0x2F, 0x0B, 0xC0, 0x0B, 0xC2, 0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC,
-    0x2F, 0x00, 0x2F, 0x07, 0xC0, 0x0B, 0xC1, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x0F, 0x00, 0x0F,
-    0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x40, 0xFC, 0x01, 0xFC, 0xBF, 0x40, 0xBF, 0x1F, 0xC0, 0x1F, 0xC1, 0x40, 0x01, 0x40, 0xAA, 0xAA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x6A, 0xA3, 0xFF, 0xDB, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0xBF, 0x80, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x20, 0x1F, 0xC0, 0x20, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x2F, 0xFE, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x1F,
-    0xF8, 0x00, 0x1F, 0xF9, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x90, 0xBF, 0x80, 0x00, 0x2F, 0x8B, 0xFF, 0xD0, 0x00, 0xFD, 0x2F, 0xFF, 0xD0,
-    0x03, 0xF4, 0x20, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0xFC,
-    0x00, 0x00, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x2F, 0x00, 0x2F,
-    0xFE, 0x00, 0xBC, 0x07, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00,
-    0x1F, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x0F, 0xE0,
-    0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x14, 0x00, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x0B, 0xE0, 0x0B, 0xFF, 0xD0, 0x2F, 0x40, 0x3F, 0xFF, 0xD0,
-    0xBD, 0x00, 0x50, 0x1F, 0xC2, 0xF4, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x2F, 0x2F, 0x00,
-    0x00, 0x00, 0x3C, 0xBC, 0x00, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x00, 0x1F, 0xC7, 0xC0, 0x00, 0x2F,
-    0xFD, 0x1F, 0x00, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x03,
-    0xC0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xBF, 0x40, 0x0F, 0xE0,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0, 0x10, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xD0, 0x2C, 0x03, 0x80, 0x7E, 0x0B, 0xC0,
-    0xFC, 0x1F, 0x42, 0xF4, 0x3F, 0x07, 0xE0, 0xFD, 0x0F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0xBD, 0x0F,
-    0xC1, 0xF8, 0x2F, 0x43, 0xE0, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4,
-    0x0F, 0x01, 0xE0, 0x3D, 0x00, 0x40, 0x10, 0x02, 0x00, 0x50, 0x00, 0x01, 0xBE, 0x00, 0x3F, 0xFF,
-    0x43, 0xF4, 0x7F, 0x1F, 0x40, 0x3E, 0xBC, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xF0, 0x03, 0xE7, 0xD0, 0x2F, 0x0F, 0xE6, 0xF8, 0x1F, 0xFF, 0x80, 0x06,
-    0x90, 0x00, 0x00, 0x06, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x02, 0xEB, 0x80,
-    0x1F, 0x2E, 0x00, 0xF0, 0xB8, 0x0F, 0x42, 0xE0, 0xBD, 0x5F, 0xD6, 0xFF, 0xFF, 0xF2, 0xAA, 0xFE,
-    0x40, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x19, 0x00, 0x02, 0xAA, 0x80, 0x7F, 0xFC, 0x07, 0xEA,
-    0x80, 0xB4, 0x00, 0x0B, 0x90, 0x00, 0xFF, 0xE0, 0x06, 0xBF, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0x0B, 0xC1, 0x5B, 0xF4, 0x3F, 0xFD, 0x01, 0xA5, 0x00, 0x00, 0x0B, 0xD0, 0x01,
-    0xFF, 0x80, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0xFD, 0x03, 0xFF, 0xFE, 0x0F,
-    0x40, 0xBC, 0x3D, 0x00, 0xF4, 0xF4, 0x03, 0xD3, 0xF0, 0x1F, 0x47, 0xF5, 0xFC, 0x0B, 0xFF, 0xC0,
-    0x01, 0xA4, 0x00, 0x2A, 0xAA, 0x87, 0xFF, 0xFE, 0x7A, 0xAB, 0xDB, 0x00, 0xB8, 0x20, 0x1F, 0x00,
-    0x03, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x00, 0x20, 0x00, 0x01, 0xBE, 0x00, 0x2F, 0xFF, 0x01, 0xF0, 0x3E, 0x0B, 0x80,
-    0x7C, 0x1F, 0x03, 0xE0, 0x3F, 0xBE, 0x00, 0x3F, 0xF0, 0x03, 0xFB, 0xF4, 0x2E, 0x03, 0xF0, 0xF0,
-    0x07, 0xC3, 0xC0, 0x1F, 0x0F, 0xD1, 0xF8, 0x1F, 0xFF, 0x80, 0x06, 0x90, 0x00, 0x01, 0xFD, 0x00,
-    0x3F, 0xFF, 0x02, 0xF4, 0x7E, 0x0F, 0x40, 0x7C, 0x3D, 0x00, 0xF4, 0xF8, 0x03, 0xD2, 0xF4, 0x1F,
-    0x43, 0xFF, 0xFC, 0x01, 0xBF, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF8, 0x00, 0x6F, 0xC0, 0x2F, 0xF8,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xF4, 0x07, 0xFF, 0xBF, 0x00, 0x3E, 0x03,
-    0xD0, 0x0F, 0x40, 0xF8, 0x03, 0xD0, 0x3E, 0x00, 0xF4, 0x0F, 0x80, 0x3D, 0x03, 0xE0, 0x0F, 0x40,
-    0xF8, 0x1F, 0xF8, 0xBF, 0xC1, 0x54, 0x15, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xFE,
-    0x0F, 0xC0, 0xBD, 0x7C, 0x00, 0xFA, 0xF0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00,
-    0xBF, 0xE0, 0x03, 0xEB, 0xC0, 0x0F, 0x5F, 0x80, 0xFC, 0x2F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0x00, 0xAF, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x2F, 0xFF, 0x4F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0xFE, 0xFE, 0x0F, 0x80, 0xFC, 0x3D, 0x02, 0xF0,
-    0x10, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00,
-    0x0B, 0xE5, 0x54, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0x00, 0x40, 0x0B, 0xFF, 0x4B, 0xEB, 0xF3,
-    0xC0, 0x3D, 0x10, 0x0F, 0x00, 0x0F, 0x80, 0x7F, 0x80, 0x3F, 0xFC, 0x04, 0x1F, 0x40, 0x03, 0xE0,
-    0x00, 0xF8, 0x01, 0xFC, 0xAF, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x02, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x0F, 0x6E, 0x00, 0xB8, 0xB8, 0x07, 0xC2,
-    0xE0, 0x3C, 0x0B, 0x83, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xC0, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x0B, 0x80, 0x00, 0xB4, 0x00, 0x0B,
-    0xE4, 0x00, 0xFF, 0xF4, 0x00, 0x6F, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F,
-    0xC2, 0xBF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x90, 0x03, 0xFF, 0xFC, 0x0F, 0x96, 0xFC, 0x3C, 0x01,
-    0xF4, 0xF4, 0x03, 0xD3, 0xE0, 0x0F, 0x4F, 0xD0, 0xBC, 0x0F, 0xFF, 0xE0, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xD7, 0xFF, 0xFE, 0xB4, 0x07, 0xC7, 0x00, 0xF4, 0x10, 0x2E, 0x00, 0x07,
-    0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00,
-    0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFE, 0x00, 0xF9, 0xBD, 0x0B, 0xC0, 0xBC,
-    0x2E, 0x02, 0xE0, 0x7E, 0x0F, 0x40, 0x7F, 0xF4, 0x00, 0xFF, 0xD0, 0x1F, 0x5F, 0xE0, 0xF4, 0x0B,
-    0xC3, 0xC0, 0x0F, 0x0F, 0x40, 0x7C, 0x2F, 0xAB, 0xD0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x1F, 0xFD, 0x01, 0xFE, 0xFD, 0x0F, 0x80, 0xFC, 0x3D, 0x01, 0xF0, 0xF4, 0x03, 0xD3,
-    0xF0, 0x0F, 0x47, 0xFA, 0xBC, 0x07, 0xFF, 0xF0, 0x01, 0x5F, 0x80, 0x00, 0xBC, 0x00, 0x0B, 0xD0,
-    0x16, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0x95, 0x5B, 0xC0, 0xBD, 0x00, 0x1F, 0x02, 0xF4, 0x00, 0x38, 0x0B, 0xD0, 0x00, 0x40,
-    0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x2F,
-    0xEA, 0xA8, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xAF, 0xFA, 0x40, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0B, 0xD0, 0xBE, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0x04,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0A, 0xBE, 0xAA, 0x80, 0x1F, 0xFF, 0xFF, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x05, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2A, 0xF9, 0x55, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x58,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xBF, 0xFF, 0xFC, 0x18, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x3E, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3E, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0xFC, 0x6F, 0xFF, 0xC0, 0x7F, 0xF4, 0x01, 0xF8, 0x0B, 0xF4, 0xFF, 0xFF, 0xC2, 0xF9, 0xBC, 0x01,
-    0xFF, 0xFF, 0xD0, 0x07, 0xC0, 0x03, 0xC0, 0x38, 0x01, 0xFF, 0xF9, 0x00, 0x07, 0xC0, 0x03, 0xD0,
-    0x10, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x01, 0xFF, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xF4, 0x01, 0xF8, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x02, 0x40, 0x7C, 0x01, 0xF8,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0x80, 0x7C, 0x1F, 0xFF, 0xD0, 0x00, 0x03, 0xFA, 0x93, 0xD6, 0xF4,
-    0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC3, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0x91, 0xBC, 0x00, 0x1F, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x38, 0x00, 0xBD, 0x00,
-    0x02, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x40, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x17,
-    0xF5, 0x55, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x06, 0xBF, 0xAA, 0x90,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x05, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0x9D, 0xB8, 0x0B, 0x87, 0x4F, 0x81, 0xC1, 0xD0, 0xD0, 0x00,
-    0x74, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x0B, 0x07, 0x43, 0x42, 0xF1, 0xD3, 0xE0, 0x2F, 0x77, 0xE0,
-    0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x0F,
-    0x40, 0x00, 0x07, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF4, 0x00, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xC0,
-    0x0F, 0x5D, 0x7C, 0x0F, 0x87, 0x4B, 0xC0, 0x81, 0xD0, 0x80, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1D, 0x00, 0x06, 0x07, 0x42,
-    0x43, 0xE1, 0xD2, 0xF0, 0x3E, 0x76, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xC0, 0x0F, 0x9D, 0xBC, 0x0F, 0x87, 0x4B, 0xC1, 0x81, 0xD0, 0x90, 0x00, 0x74, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x60, 0x74, 0x24, 0x3E, 0x1D, 0x2F, 0x03, 0xE7,
-    0x6F, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00,
-    0x34, 0x0F, 0x00, 0x3E, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x2E, 0x00, 0x3C, 0x2F, 0x55, 0x5F, 0x0F,
-    0xFF, 0xFF, 0xC2, 0xF5, 0x55, 0x50, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x0B, 0x00, 0x0F, 0x03, 0xE0, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x02, 0xE0, 0x3D, 0x55, 0x7E,
-    0x0F, 0xFF, 0xFF, 0xC1, 0x55, 0x57, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x01, 0x00, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x7C, 0x01, 0xF4, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x03,
-    0xC0, 0xF4, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xEB, 0x80, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE0, 0x2E, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0x8B, 0x80, 0x0F, 0xE2, 0xFC, 0x0F,
-    0xF8, 0xBF, 0xC7, 0x9E, 0x2D, 0xB4, 0x47, 0x8B, 0x44, 0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x00,
-    0x2E, 0x2D, 0x00, 0x0B, 0x8B, 0x40, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00,
-    0x0B, 0x8B, 0x80, 0x02, 0xE2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBF, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0xBF, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2E, 0x00,
-    0x0B, 0x8B, 0x80, 0x02, 0xE2, 0xE0, 0x00, 0xB8, 0xB8, 0x00, 0x2E, 0x2D, 0x00, 0x07, 0x8B, 0x40,
-    0x01, 0xE2, 0xD0, 0x00, 0x78, 0xB4, 0x01, 0x1E, 0x2D, 0x11, 0xE7, 0x8B, 0x6D, 0x2F, 0xE2, 0xFE,
-    0x02, 0xF8, 0xBE, 0x00, 0x2E, 0x2E, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x40, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x00,
-    0x7C, 0x00, 0x0F, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x00,
-    0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x1C, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0xBD, 0x00, 0x00, 0xF8, 0x01, 0xFE, 0xAA, 0xAF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xF5, 0x56, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01,
-    0xF0, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00,
-    0x00, 0x0F, 0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x0B, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0x00, 0x34, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE7, 0xF0, 0x0B, 0xFF, 0xFF,
-    0x03, 0xF4, 0x1F, 0xF0, 0xBC, 0x00, 0x3E, 0x1F, 0x40, 0x03, 0xE3, 0xF0, 0x00, 0x3D, 0x3D, 0x00,
-    0x07, 0xC7, 0xC0, 0x00, 0xBC, 0xBC, 0x00, 0x0F, 0x8B, 0xC0, 0x01, 0xF0, 0xBC, 0x00, 0x3E, 0x0B,
-    0xD0, 0x07, 0xC0, 0x7F, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFC, 0x54, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC5, 0x54,
-    0x07, 0xF7, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF5, 0x55, 0x41, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x03, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0xBF, 0x90,
-    0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF4, 0x01, 0xF8,
-    0x00, 0x02, 0xF7, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x0F, 0xC0, 0x3E, 0x00, 0x02, 0xF4, 0x2F, 0x01,
-    0xF8, 0x00, 0x1F, 0x40, 0x7D, 0x07, 0xD0, 0x01, 0xF4, 0x01, 0xF4, 0x1F, 0x40, 0x1F, 0x40, 0x07,
-    0xD0, 0x7D, 0x01, 0xF4, 0x00, 0x2F, 0x41, 0xF8, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0xF8, 0x00,
-    0x03, 0xF0, 0x0B, 0xDF, 0x80, 0x00, 0x2F, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0,
-    0x00, 0x1F, 0xD0, 0x00, 0xFF, 0xD0, 0x06, 0xFE, 0x00, 0x0F, 0xAF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC,
-    0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xC0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0xBD,
-    0x00, 0x00, 0x03, 0xD1, 0xF8, 0x00, 0x00, 0x1F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00,
-    0x07, 0xC0, 0x1F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0xBE, 0x00, 0x0B, 0xC0,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x00, 0x3F, 0x42, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0xFD, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B,
-    0xE0, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0x7E, 0x01,
-    0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x02, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00,
-    0x00, 0x0F, 0xCF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x94, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xF9, 0x55, 0x55, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x0B, 0xF9, 0x42, 0xF0, 0x00, 0x7F, 0x00,
-    0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80,
-    0x07, 0xD0, 0x00, 0x3C, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xD0, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0x00, 0xBD, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0x01, 0xFD, 0x3D, 0x00, 0x00,
-    0x01, 0xFF, 0xF5, 0x55, 0x50, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xE5, 0x55, 0x55, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x15, 0x55, 0x54, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xAA, 0xAA, 0x90,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x01, 0x55,
-    0x55, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xE0, 0x5B, 0xF8, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x0F,
-    0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00,
-    0x1F, 0x40, 0x03, 0xE0, 0x00, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xD0, 0x1F, 0x80, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x00, 0x1F, 0x1F, 0xD0, 0x15, 0x55, 0x7F, 0xFD,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x01, 0x55, 0x55, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x55, 0x55, 0x50, 0x2F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1A, 0xAA, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0xBF, 0x90, 0x00, 0x6F, 0xE4, 0xBF, 0xFF, 0x80, 0x3F, 0xFF, 0xC6, 0xAA,
-    0xA0, 0x02, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFE, 0x00, 0x00, 0xFC, 0x07, 0xF4, 0x00, 0x07, 0xC0, 0x2F, 0xC0, 0x00, 0x3C, 0x00,
-    0xFF, 0x00, 0x02, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x03, 0xF0,
-    0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x3C, 0x2F, 0x80, 0x00, 0x1B, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x01, 0x80, 0xF0, 0x14, 0x3F, 0x4F, 0x0F, 0xC0, 0xBE, 0xFB, 0xE0, 0x00, 0xFF,
-    0xF4, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFF, 0xFD, 0x02, 0xF8, 0xF2, 0xFC, 0x2D, 0x0F, 0x07, 0x80,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x2F,
-    0xAF, 0xC7, 0xC0, 0x3D, 0xB8, 0x02, 0xEB, 0x40, 0x1E, 0xB8, 0x02, 0xE7, 0xD0, 0x7C, 0x2F, 0xFF,
-    0x40, 0x6F, 0x80, 0x1F, 0x43, 0xFC, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x05, 0x55, 0x00, 0x0F, 0x80, 0xFF,
-    0xF0, 0x01, 0xF0, 0x0F, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D,
-    0x00, 0x00, 0xFC, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x03,
-    0xF1, 0xF0, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x2E, 0x2F, 0xFE,
-    0x0B, 0xD7, 0xD1, 0xF9, 0xE0, 0xB4, 0x03, 0xFC, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF4, 0x0B,
-    0x80, 0x7F, 0xC0, 0x7F, 0xAF, 0x1F, 0x82, 0xFF, 0xC0, 0x7E, 0x01, 0x50, 0x00, 0x90, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0xFF, 0xF0, 0x7F, 0xFC, 0x3E, 0x0B, 0x8F, 0x47, 0xD7, 0xC0, 0x3F, 0xC0, 0x2E,
-    0x78, 0x00, 0xF4, 0x01, 0xE7, 0x80, 0x1F, 0x80, 0x1E, 0x7C, 0x03, 0xFE, 0x03, 0xD3, 0xFA, 0xF0,
-    0xFE, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xEA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x14, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0x54, 0x05, 0x2F, 0x07,
-    0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F,
-    0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C,
-    0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2,
-    0xF0, 0x7C, 0xBC, 0x1F, 0x2F, 0x07, 0xCB, 0xC1, 0xF2, 0xF0, 0x7C, 0xBC, 0x1F, 0x1A, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00,
-    0x07, 0xC0, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x07, 0xC0,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x0F,
-    0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x3F,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03,
-    0xE0, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00,
-    0x00, 0x07, 0xCF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0x40, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00,
-    0x0B, 0xC7, 0xD0, 0x00, 0x01, 0xF5, 0xF0, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF,
-    0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F,
-    0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA, 0xF0,
-    0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0xFA,
-    0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00,
-    0xFA, 0xF0, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0x03, 0xE7, 0xC0, 0x00,
-    0x00, 0xF5, 0xF4, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE,
-    0x00, 0x2F, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x02, 0xF0, 0x3C,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x7F, 0xAF, 0x40, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F,
-    0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFE, 0x00,
-    0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x09, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF9, 0xFD, 0x19,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x6F, 0xE7, 0xF4, 0x64, 0x05, 0x00,
-    0x00, 0x00, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02,
-    0xFC, 0x09, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0xFE, 0x00, 0x00, 0x2F,
-    0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x54, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03, 0xC2, 0xFA, 0xFF, 0x97, 0xE0, 0xF0, 0x06, 0xFF, 0xE0,
-    0x10, 0x00, 0x06, 0x40, 0x00, 0x01, 0xA8, 0x00, 0x05, 0x03, 0xFF, 0xF4, 0x03, 0xC3, 0xF5, 0xBF,
-    0xEB, 0xD0, 0xE0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC1, 0x55, 0x55, 0x55, 0x50, 0x02, 0x90, 0x00, 0x41, 0xFF, 0xD0, 0x2E, 0x3F, 0xBF, 0xDB, 0xD7,
-    0xC0, 0xBF, 0xF8, 0x20, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x04, 0x1F, 0xFD, 0x02, 0xD3, 0xFF, 0xFD,
-    0xBD, 0x7C, 0x0B, 0xFF, 0x83, 0x00, 0x1B, 0xE0, 0x10, 0x00, 0x00, 0x01, 0x0F, 0xFA, 0xAA, 0xBF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xBF, 0xA9, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3E, 0x95, 0x55, 0xAF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x3C, 0x05, 0x55, 0x6F, 0x53, 0xFF, 0xFF, 0xFC,
-    0xAA, 0xAF, 0xAA, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x01, 0x57, 0xD5, 0x54, 0xFF, 0xFF, 0xFF,
-    0x2B, 0xFA, 0xAA, 0x80, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x15, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x40, 0x0B, 0xF8,
-    0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF,
-    0x40, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00,
-    0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x07,
-    0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0xC0, 0x02, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xBF,
-    0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x06,
-    0xAA, 0xAA, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xAA, 0xAA, 0xAB, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1A, 0xAA, 0xAA,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xAA, 0xFE, 0xA9, 0x1F, 0xD0, 0x03, 0xD0, 0x00, 0xFD, 0x00, 0x1F,
-    0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x3F, 0x40,
-    0xBC, 0x00, 0x00, 0x3F, 0x43, 0xE0, 0x00, 0x00, 0x7F, 0xEF, 0xAA, 0xAA, 0x40, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x07, 0xFA, 0xAA, 0xA4, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A,
-    0xAA, 0xAF, 0xBF, 0xD0, 0x00, 0x00, 0xB8, 0x1F, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0xC0, 0x00, 0x1F,
-    0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x07,
-    0xE0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x07, 0xF0, 0x00,
-    0xBC, 0x00, 0xBF, 0x06, 0xAB, 0xFA, 0xAF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xFE, 0xAA,
-    0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x82, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE6, 0xE6,
-    0xF8, 0x00, 0x0F, 0x80, 0x74, 0x0B, 0xC0, 0x0F, 0x40, 0x1D, 0x00, 0x7C, 0x07, 0x80, 0x07, 0x40,
-    0x0B, 0x43, 0xC0, 0x01, 0xD0, 0x00, 0xF1, 0xD0, 0x00, 0x74, 0x00, 0x2D, 0xB0, 0x00, 0x1D, 0x00,
-    0x03, 0xBC, 0x00, 0x07, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x1D, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x40, 0x00, 0xE7, 0x40, 0x01, 0xD0, 0x00,
-    0x74, 0xF0, 0x00, 0x74, 0x00, 0x3C, 0x2E, 0x00, 0x1D, 0x00, 0x2E, 0x03, 0xD0, 0x07, 0x40, 0x1F,
-    0x00, 0x3E, 0x01, 0xD0, 0x2F, 0x00, 0x02, 0xF9, 0xB9, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x7C,
-    0x07, 0x80, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xD0, 0x00, 0x00, 0x00, 0x2D,
-    0xB0, 0x00, 0x00, 0x00, 0x03, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xE7,
-    0x40, 0x00, 0x00, 0x00, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x03,
-    0xD0, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x00, 0x01, 0xFC, 0x07, 0xBC, 0x00, 0x01, 0xFB, 0x43, 0xC7, 0xC0, 0x01, 0xF4, 0xF1, 0xD0,
-    0x7C, 0x01, 0xF4, 0x1D, 0xB0, 0x07, 0xC1, 0xF4, 0x03, 0xBC, 0x00, 0x7D, 0xF0, 0x00, 0xFF, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFB, 0xC0, 0x03, 0xEC, 0x01,
-    0xF0, 0x7C, 0x00, 0xE7, 0x41, 0xF0, 0x07, 0xC0, 0x74, 0xF1, 0xF0, 0x00, 0x7C, 0x3C, 0x2E, 0xF0,
-    0x00, 0x07, 0xEE, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xF9,
-    0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xE5, 0x16, 0xF8, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x0F, 0x40, 0x00, 0x01, 0xFC, 0x07, 0x80, 0x00, 0x01, 0xFB, 0x43, 0xC0, 0x00,
-    0x01, 0xF4, 0xF1, 0xD0, 0x00, 0x01, 0xF4, 0x1D, 0xB0, 0x00, 0x01, 0xF4, 0x03, 0xBC, 0x00, 0x01,
-    0xF4, 0x00, 0xFF, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x0F, 0xF0, 0x01, 0xF4,
-    0x00, 0x03, 0xEC, 0x01, 0xF4, 0x00, 0x00, 0xE7, 0x41, 0xF4, 0x00, 0x00, 0x74, 0xF1, 0xF4, 0x00,
-    0x00, 0x3C, 0x2E, 0xF4, 0x00, 0x00, 0x2E, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0x00, 0x02, 0xF9, 0x01, 0xBE, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06, 0xAA,
-    0xBF, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x0A, 0x43, 0xFC, 0x3F,
-    0xC2, 0xF8, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xA0, 0x00, 0x29, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x2F,
-    0xC3, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x69, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x03, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xE2, 0xFF, 0xFF, 0xFE, 0x40,
-    0x0F, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xD1, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00,
+static const uint8_t bookerly_14_regularBitmaps[38373] = {
+    0x09, 0xAA, 0x09, 0xE0, 0xAD, 0xA0, 0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x1A, 0xD1, 0xAD,
+    0x1A, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x2D, 0x2D, 0x2D, 0x75, 0x92, 0xE0, 0xAE, 0x99, 0xE1, 0x99,
+    0x10, 0x09, 0xA2, 0x9A, 0x09, 0xD1, 0x9D, 0x0A, 0xD1, 0xAD, 0x09, 0xD1, 0xAD, 0x09, 0xD1, 0x9D,
+    0x09, 0xD1, 0x9D, 0x09, 0xD1, 0x9D, 0x09, 0xD1, 0x9D, 0x1C, 0x92, 0xC9, 0x00, 0x77, 0x70, 0xD3,
+    0xD7, 0x09, 0xCA, 0x3C, 0xA7, 0x0A, 0xC9, 0x29, 0xC9, 0x70, 0xD3, 0xAC, 0x5A, 0xAA, 0xAD, 0xAA,
+    0xAA, 0xDA, 0xAA, 0x91, 0xFF, 0xFE, 0x94, 0xAC, 0x92, 0xAC, 0xA7, 0x0A, 0xC3, 0xAC, 0x71, 0xD3,
+    0xD7, 0x1C, 0xA3, 0xD7, 0x0A, 0xCA, 0x2A, 0xCA, 0x5F, 0xFF, 0xE1, 0x9A, 0xAA, 0xDA, 0xAA, 0xAD,
+    0xAA, 0xAA, 0x5D, 0x3D, 0x70, 0x9C, 0xA2, 0x9C, 0xA7, 0x0A, 0xC9, 0x2A, 0xC9, 0x70, 0xD3, 0xD7,
+    0x77, 0x00, 0x77, 0x4D, 0x73, 0xD7, 0x3C, 0xA7, 0x3C, 0xA7, 0x09, 0xAF, 0xA9, 0x4A, 0xFF, 0xA2,
+    0xAD, 0x90, 0xCA, 0x0E, 0x91, 0xD9, 0x1C, 0x91, 0xDA, 0x09, 0xD2, 0xC9, 0x1D, 0x90, 0x9D, 0x2C,
+    0x91, 0x99, 0x19, 0xDA, 0x09, 0xC9, 0x6F, 0xAC, 0x97, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7, 0x0A, 0xFC,
+    0x7A, 0xC0, 0xAE, 0x29, 0x2A, 0xC1, 0x9D, 0x90, 0xD2, 0xAC, 0x2D, 0xA9, 0xD2, 0xAC, 0x2D, 0x99,
+    0xDA, 0x1D, 0x19, 0xD1, 0xEA, 0x0D, 0x09, 0xDA, 0x19, 0xFF, 0xCA, 0x4A, 0xFC, 0xA9, 0x70, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x39, 0x95, 0x77, 0x77, 0x73, 0xC9, 0x70, 0x9F, 0x97, 0x9D,
+    0x7A, 0xFD, 0x96, 0xD9, 0x69, 0xD2, 0xAD, 0x5A, 0xCA, 0x7D, 0xA3, 0xD9, 0x4D, 0x70, 0xD9, 0x3D,
+    0xA3, 0xAC, 0x97, 0x0D, 0x4A, 0xCA, 0x3D, 0x70, 0x9D, 0x4A, 0xCA, 0x2D, 0x72, 0xD9, 0x3D, 0xA1,
+    0x9C, 0xA7, 0x2D, 0x93, 0xD9, 0x1D, 0x29, 0xEA, 0x3A, 0xD2, 0xAD, 0x19, 0xC9, 0x1F, 0xE3, 0xEA,
+    0xE9, 0x1D, 0x1A, 0xD2, 0xDA, 0x3F, 0xC2, 0xAC, 0x2D, 0x92, 0xAD, 0x72, 0x9C, 0xA1, 0x9D, 0x4D,
+    0x72, 0xD2, 0xAD, 0x4D, 0x97, 0x0A, 0xCA, 0x2A, 0xD4, 0xD9, 0x70, 0xD3, 0xAD, 0x4D, 0x70, 0xAC,
+    0x93, 0x9D, 0x39, 0xD7, 0x9D, 0x5D, 0x92, 0xDA, 0x7D, 0x95, 0xAD, 0xA9, 0xE7, 0xAC, 0xA7, 0xAF,
+    0xC7, 0x0A, 0xC7, 0x29, 0x97, 0x77, 0x60, 0x77, 0x74, 0xAE, 0xA7, 0x69, 0xFE, 0x74, 0x9D, 0xA1,
+    0x9D, 0xA7, 0x3E, 0x3D, 0xA7, 0x3D, 0xA3, 0xAC, 0xA7, 0x3D, 0xA3, 0xD9, 0x73, 0xDA, 0x29, 0xD7,
+    0x4E, 0x19, 0xD7, 0x5A, 0xD1, 0x9A, 0x76, 0xEA, 0x49, 0x99, 0x99, 0x94, 0x9F, 0xC3, 0xAF, 0xD9,
+    0x3D, 0xA9, 0xE2, 0x9A, 0xEA, 0xA3, 0xE1, 0xAD, 0xA3, 0x9D, 0x5D, 0xA2, 0xEA, 0x29, 0xD4, 0x9D,
+    0x93, 0xEA, 0x19, 0xD4, 0x9D, 0x94, 0xEA, 0x09, 0xD4, 0x9D, 0xA5, 0xFD, 0x95, 0xE6, 0xAF, 0x6A,
+    0xE9, 0x5F, 0xCA, 0x94, 0xAF, 0xAA, 0xAF, 0xAF, 0xCA, 0x92, 0x9F, 0xFA, 0x2A, 0xF9, 0x59, 0x99,
+    0x97, 0x99, 0x10, 0x09, 0xA0, 0x9D, 0x0A, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x1C,
+    0x90, 0x76, 0x9C, 0x59, 0xD9, 0x4D, 0x94, 0xDA, 0x4A, 0xD4, 0x9D, 0x94, 0xE5, 0xD9, 0x4A, 0xD5,
+    0xDA, 0x5D, 0x94, 0x9D, 0x94, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0x9D, 0x94, 0x9D, 0x95, 0xDA,
+    0x5E, 0x59, 0xD9, 0x5E, 0x5A, 0xD9, 0x5E, 0x59, 0xE5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9C, 0x00, 0x72,
+    0xAC, 0x7E, 0x7E, 0x7E, 0x69, 0xDA, 0x6E, 0x69, 0xDA, 0x6E, 0x69, 0xD9, 0x6D, 0xA6, 0xE6, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xDA, 0x6D, 0x95, 0x9D, 0x6E, 0x6D, 0x95, 0xE5,
+    0x9D, 0x6D, 0xA5, 0xDA, 0x5A, 0xD6, 0x9A, 0x60, 0x76, 0xAC, 0x92, 0x9C, 0x1D, 0xA2, 0xE0, 0xD3,
+    0x9F, 0x90, 0x99, 0x29, 0xFD, 0x1A, 0xE9, 0x9D, 0x0E, 0x0C, 0xA3, 0xAC, 0x1D, 0x7D, 0xA6, 0x93,
+    0x77, 0x1D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x5F, 0xFF, 0x0F, 0xFF, 0x5D, 0x97, 0x1D, 0x72,
+    0xD7, 0x2D, 0x72, 0xD7, 0x29, 0x95, 0x39, 0x92, 0x9E, 0x3E, 0x92, 0xE3, 0xE2, 0x9D, 0x92, 0xE2,
+    0x9D, 0x3D, 0x97, 0x10, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0x19, 0x92, 0xF1, 0xF1,
+    0xEA, 0x29, 0x91, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x0A, 0xD7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x71, 0xAD, 0x71, 0xD9, 0x70,
+    0xAD, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x0A, 0xD7,
+    0x29, 0x72, 0x77, 0x4A, 0xFC, 0x96, 0x9F, 0xFC, 0x49, 0xEA, 0x99, 0x9F, 0x3E, 0x94, 0xEA, 0x1A,
+    0xDA, 0x59, 0xE1, 0xE7, 0xE9, 0x0E, 0x7A, 0xD9, 0x9D, 0xA7, 0xAD, 0xAA, 0xDA, 0x79, 0xDA, 0xAD,
+    0x97, 0x9E, 0xAD, 0x97, 0x9D, 0xAA, 0xD9, 0x79, 0xDA, 0xAD, 0xA7, 0xAD, 0xA9, 0xDA, 0x7A, 0xD9,
+    0x9E, 0x7E, 0x1E, 0x69, 0xDA, 0x1A, 0xE5, 0xE3, 0xEA, 0x3E, 0xA3, 0x9F, 0xFC, 0xA6, 0xFE, 0x97,
+    0x19, 0x99, 0x60, 0x77, 0x1A, 0xC6, 0x9F, 0x4F, 0xE4, 0xFE, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x93,
+    0x9A, 0xFF, 0x90, 0xFF, 0xD9, 0x77, 0x09, 0xAF, 0xC9, 0x4A, 0xFF, 0xA2, 0xEA, 0x19, 0xAE, 0x90,
+    0x9D, 0xA4, 0xEA, 0x0A, 0xD5, 0x9E, 0x0A, 0xD5, 0x9E, 0x19, 0x95, 0x9E, 0x71, 0xAD, 0x97, 0x1E,
+    0x71, 0xE9, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFC, 0x0F, 0xFF, 0x90,
+    0x77, 0x9A, 0xFC, 0x93, 0xFF, 0xC9, 0x1E, 0xA9, 0x1A, 0xE0, 0x9D, 0x94, 0xE1, 0xCA, 0x5A, 0xD9,
+    0x70, 0xE7, 0x09, 0xE7, 0x9E, 0x69, 0xF5, 0xAF, 0xDA, 0x49, 0xFF, 0x70, 0x9E, 0xA7, 0x09, 0xE7,
+    0x1E, 0x70, 0x9E, 0x70, 0xEA, 0x7A, 0xE6, 0xAF, 0x90, 0x9A, 0xAF, 0xE9, 0x2F, 0xE9, 0x59, 0x99,
+    0x96, 0x77, 0x70, 0xAD, 0x73, 0xF7, 0x29, 0xF7, 0x2F, 0xC7, 0x1E, 0xAD, 0x70, 0xAD, 0x9A, 0xD7,
+    0x9D, 0xA0, 0xAD, 0x7E, 0x1A, 0xD6, 0xAD, 0x2A, 0xD5, 0x9D, 0x92, 0xAD, 0x5D, 0xA3, 0xAD, 0x4E,
+    0x4A, 0xD3, 0xAD, 0x94, 0xAD, 0x92, 0xFF, 0xFE, 0xA9, 0xFF, 0xFD, 0xA1, 0x99, 0x99, 0x99, 0x9A,
+    0xD9, 0x99, 0x71, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0x99, 0x93, 0x2F, 0xFC, 0xA3,
+    0xFF, 0xD3, 0xEA, 0xAA, 0xAA, 0xAA, 0x29, 0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x72, 0xAD, 0x97, 0x1A,
+    0xFC, 0xA6, 0xAF, 0xEA, 0x49, 0xAA, 0xAF, 0xCA, 0x70, 0x9F, 0x97, 0x1E, 0xA7, 0x19, 0xE7, 0x19,
+    0xDA, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x0F, 0x7A, 0xF2, 0x9A, 0xAF, 0xE3, 0x9F, 0xE9, 0x69, 0x99,
+    0x97, 0x77, 0x49, 0xAF, 0x6F, 0xDA, 0x93, 0x9F, 0xA6, 0x9E, 0xA7, 0x9E, 0x97, 0x0E, 0x97, 0x09,
+    0xE7, 0x1E, 0x99, 0x99, 0x95, 0xFF, 0xCA, 0x29, 0xFF, 0xE1, 0xAD, 0x94, 0xF0, 0xAD, 0x95, 0xE9,
+    0xE9, 0x5A, 0xDA, 0xAD, 0x95, 0x9D, 0xAA, 0xDA, 0x59, 0xDA, 0x9E, 0x59, 0xDA, 0x0E, 0x94, 0xE9,
+    0x0A, 0xE9, 0x2A, 0xE2, 0xFF, 0xD4, 0xAF, 0xDA, 0x79, 0x99, 0x94, 0x09, 0xFF, 0xEA, 0x1F, 0xFF,
+    0xC9, 0x0F, 0xFF, 0xC1, 0xD9, 0x59, 0xDA, 0x1D, 0x6E, 0x2D, 0x5A, 0xD9, 0x72, 0xDA, 0x72, 0xE7,
+    0x29, 0xD9, 0x72, 0xE7, 0x29, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x3E, 0x73, 0xDA, 0x73, 0xDA, 0x74, 0x97, 0x00, 0x77, 0x19, 0xFC, 0xA5, 0xFF, 0xC3,
+    0xE9, 0x19, 0xF1, 0xAD, 0x94, 0xE1, 0xE5, 0xAD, 0x1E, 0x5A, 0xD1, 0xAD, 0xA4, 0xDA, 0x2F, 0x2E,
+    0x4F, 0xAE, 0x6F, 0xD6, 0xAF, 0xE9, 0x3E, 0x91, 0xFA, 0x1E, 0x4A, 0xE9, 0x9D, 0xA5, 0xAD, 0xAA,
+    0xD9, 0x59, 0xEA, 0xD9, 0x6D, 0xAA, 0xDA, 0x5A, 0xD9, 0x0E, 0xA3, 0xAE, 0x19, 0xFF, 0xD3, 0x9F,
+    0xEA, 0x79, 0x99, 0x94, 0x77, 0x29, 0xFC, 0xA6, 0xFF, 0xC9, 0x3F, 0x99, 0x9F, 0x29, 0xDA, 0x4E,
+    0xA1, 0xE9, 0x49, 0xE1, 0xE6, 0xE9, 0x0E, 0x6A, 0xD9, 0x0E, 0x6A, 0xDA, 0x0A, 0xDA, 0x5A, 0xDA,
+    0x09, 0xE9, 0x4A, 0xD9, 0x1A, 0xFA, 0x99, 0xAE, 0x92, 0xAF, 0xFD, 0x59, 0xAA, 0xAA, 0xAE, 0x72,
+    0xE9, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x09, 0xE9, 0x79, 0xF9, 0x49, 0x9A, 0xFC, 0x95, 0xAF, 0xC9,
+    0x71, 0x99, 0x71, 0x19, 0x92, 0xF1, 0xF1, 0xEA, 0x29, 0x97, 0x77, 0x77, 0x99, 0x2F, 0x1F, 0x1E,
+    0xA2, 0x99, 0x10, 0x39, 0x39, 0xE2, 0xAE, 0x91, 0x9E, 0x39, 0x97, 0x77, 0x77, 0x79, 0x92, 0x9E,
+    0x3E, 0x92, 0xE3, 0xE2, 0x9D, 0x92, 0xE2, 0x9D, 0x3D, 0x97, 0x10, 0x77, 0x7A, 0xC9, 0x70, 0xAF,
+    0x6A, 0xF9, 0x5A, 0xF9, 0x5A, 0xF9, 0x6E, 0xA7, 0x1F, 0x97, 0x19, 0xF9, 0x71, 0xAF, 0x97, 0x1A,
+    0xF9, 0x71, 0xAF, 0x72, 0xAC, 0xA7, 0x39, 0x10, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF,
+    0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x76, 0x9C, 0x97, 0x2F, 0x97, 0x1A, 0xF9, 0x71,
+    0xAF, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x71, 0xAE, 0x79, 0xF9, 0x59, 0xF9, 0x5A, 0xF9, 0x5A, 0xF9,
+    0x79, 0xD9, 0x72, 0x97, 0x20, 0x73, 0xAE, 0xA4, 0xAF, 0xD9, 0x2A, 0xFE, 0x92, 0xA2, 0x9E, 0x70,
+    0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD6, 0x9E, 0x3A, 0xFC, 0xA1, 0x9F, 0xDA, 0x29, 0xFA, 0x49, 0xDA,
+    0x7D, 0x70, 0xD7, 0x77, 0x77, 0x1A, 0xDA, 0x6E, 0xA6, 0xE9, 0x79, 0x95, 0x71, 0x9A, 0xAA, 0xAA,
+    0xA9, 0x77, 0xAF, 0xFE, 0x97, 0x2A, 0xFA, 0x99, 0x99, 0xAF, 0xA7, 0x9E, 0xA7, 0x09, 0xEA, 0x59,
+    0xE9, 0x73, 0xAD, 0xA4, 0xE7, 0x6A, 0xD3, 0xE5, 0x9A, 0xCA, 0x95, 0xDA, 0x19, 0xDA, 0x39, 0xFD,
+    0xA4, 0xAD, 0x1A, 0xD3, 0x9D, 0x91, 0xE4, 0x9D, 0x1D, 0xA3, 0xAC, 0x92, 0x9D, 0x49, 0xD0, 0x9D,
+    0x94, 0x93, 0x9D, 0x5D, 0x99, 0xD7, 0x29, 0xD5, 0xD0, 0xAD, 0x6A, 0xFD, 0x49, 0xD0, 0xAD, 0x5E,
+    0xA9, 0xAD, 0x4A, 0xD0, 0xAD, 0x4D, 0xA2, 0x9D, 0x4D, 0x90, 0x9D, 0x4D, 0x92, 0x9D, 0x92, 0xAD,
+    0x19, 0xD9, 0x3E, 0x19, 0xF9, 0x9E, 0x3D, 0xA3, 0xAF, 0xCA, 0xAF, 0xD4, 0xE4, 0x9E, 0x91, 0x9A,
+    0xCA, 0x95, 0x9E, 0x77, 0x6A, 0xDA, 0x77, 0x6E, 0xA7, 0x49, 0x70, 0xFA, 0x96, 0x9A, 0xD7, 0x19,
+    0xFF, 0xFD, 0xA7, 0x39, 0xFF, 0xD9, 0x77, 0x19, 0x99, 0x73, 0x72, 0x97, 0x72, 0x9D, 0xA7, 0x71,
+    0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7,
+    0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99,
+    0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD,
+    0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94,
+    0xFF, 0x00, 0x49, 0x99, 0x99, 0x5A, 0xFF, 0xE9, 0x29, 0xFC, 0xAA, 0xAF, 0xA4, 0xE3, 0x9E, 0x4E,
+    0x4A, 0xDA, 0x3E, 0x49, 0xDA, 0x3E, 0x5D, 0xA3, 0xE4, 0x9D, 0x93, 0xE4, 0xE4, 0xEA, 0xA9, 0x9A,
+    0xD5, 0xFF, 0xDA, 0x4E, 0xAA, 0xAA, 0xFC, 0x3E, 0x49, 0xE9, 0x2E, 0x59, 0xE2, 0xE6, 0xE2, 0xE6,
+    0xE2, 0xE5, 0x9E, 0x2E, 0x5E, 0xA2, 0xE3, 0x9F, 0x1A, 0xFF, 0xF1, 0xFF, 0xEA, 0x97, 0x72, 0x79,
+    0x99, 0x99, 0x71, 0xAF, 0xF9, 0x4A, 0xFF, 0xD9, 0x3A, 0xE9, 0x39, 0xD9, 0x29, 0xDA, 0x6D, 0x92,
+    0xE7, 0xD9, 0x1A, 0xD9, 0x7A, 0xC2, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7,
+    0x4A, 0xDA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE9, 0x74, 0xF7, 0x49, 0xF9, 0x73, 0xAF, 0xCA, 0x99,
+    0x99, 0xAA, 0xC9, 0x29, 0xFF, 0xF5, 0xAF, 0xFA, 0x71, 0x99, 0x99, 0x40, 0x49, 0x99, 0x99, 0x97,
+    0x0A, 0xFF, 0xFA, 0x59, 0xFC, 0xAA, 0xFE, 0xA6, 0xE4, 0x9F, 0xC5, 0xE6, 0x9E, 0xA4, 0xE7, 0x9E,
+    0x4E, 0x70, 0xEA, 0x3E, 0x70, 0x9E, 0x3E, 0x71, 0xE3, 0xE7, 0x1E, 0x92, 0xE7, 0x1E, 0x92, 0xE7,
+    0x1E, 0x92, 0xE7, 0x1E, 0x3E, 0x71, 0xE3, 0xE7, 0x09, 0xDA, 0x3E, 0x70, 0xE9, 0x3E, 0x7A, 0xDA,
+    0x4E, 0x6A, 0xE5, 0xE3, 0x9A, 0xF4, 0xAF, 0xFF, 0xA4, 0xFF, 0xEA, 0x97, 0x77, 0x20, 0x77, 0x0A,
+    0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA,
+    0x00, 0x76, 0xAF, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x2E, 0x49, 0xDA, 0x2E, 0x5A, 0xCA, 0x2E, 0x59,
+    0xC9, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xFD, 0x93, 0xFF, 0xD4, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x1A, 0xFE, 0x5F, 0xFC, 0x50, 0x70, 0x99, 0x99, 0x97, 0x29,
+    0xFF, 0xCA, 0x59, 0xFF, 0xF4, 0x9E, 0xA5, 0xAD, 0x39, 0xE7, 0x9D, 0x3E, 0x71, 0xD2, 0xAD, 0x97,
+    0x1C, 0xA2, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xDA, 0x76, 0xAD, 0xA6, 0x99, 0x99, 0x99, 0x99,
+    0xAD, 0xA5, 0x9F, 0xEA, 0xAE, 0x69, 0xAA, 0xF0, 0x9E, 0x71, 0x9D, 0xA1, 0xE9, 0x70, 0x9D, 0xA1,
+    0xF7, 0x09, 0xDA, 0x19, 0xF7, 0x9D, 0xA2, 0x9F, 0xA9, 0x39, 0xAD, 0xA3, 0x9F, 0xFF, 0xCA, 0x5A,
+    0xFF, 0xDA, 0x71, 0x99, 0x99, 0x95, 0x77, 0x6A, 0xFE, 0x93, 0x9F, 0xF0, 0x9F, 0xD9, 0x5F, 0xDA,
+    0x93, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7,
+    0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x95, 0xFF, 0xFF, 0x95,
+    0xFF, 0xFF, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD,
+    0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x3A, 0xFD, 0x94, 0x9F, 0xDA,
+    0x0F, 0xF9, 0x39, 0xFF, 0x00, 0x70, 0xFF, 0xA9, 0xFD, 0xA3, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE3, 0xAF, 0xD9, 0xFF, 0xA0, 0x76, 0xFF,
+    0xC2, 0xAF, 0xDA, 0x6E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x79, 0xD9,
+    0x7E, 0x7A, 0xDA, 0x6A, 0xE5, 0xAF, 0x69, 0xDA, 0x60, 0x77, 0x4A, 0xFE, 0xA1, 0x9F, 0xE9, 0x09,
+    0xFD, 0xA3, 0x9F, 0xC9, 0x4E, 0x6E, 0xA6, 0xE5, 0xE9, 0x7E, 0x4E, 0x97, 0x0E, 0x3E, 0x72, 0xE1,
+    0x9E, 0x73, 0xE0, 0x9E, 0x74, 0xE9, 0xDA, 0x75, 0xFD, 0x76, 0xFE, 0x75, 0xE0, 0xEA, 0x74, 0xE1,
+    0xEA, 0x73, 0xE1, 0x9E, 0xA7, 0x2E, 0x29, 0xEA, 0x71, 0xE3, 0x9F, 0x70, 0xE4, 0x9F, 0x7E, 0x59,
+    0xF9, 0x3A, 0xFD, 0x93, 0x9F, 0xA1, 0xFF, 0x95, 0xFA, 0x77, 0x09, 0x99, 0x10, 0x77, 0x0A, 0xFF,
+    0x79, 0xFD, 0xA7, 0x3E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x7A, 0xC3, 0xE7, 0xD3, 0xE6, 0x9D, 0x3E, 0x49, 0x9E, 0x1A,
+    0xFF, 0xFC, 0xA0, 0xFF, 0xFE, 0x90, 0x77, 0x73, 0xFD, 0xA7, 0x9F, 0xD3, 0x9F, 0xD7, 0xAF, 0xC9,
+    0x5A, 0xF9, 0x6F, 0xA7, 0xAC, 0xAD, 0xA5, 0x9F, 0xC7, 0xD9, 0xE5, 0xAC, 0x9E, 0x7D, 0x9A, 0xD5,
+    0xD0, 0xAD, 0x7D, 0x09, 0xD9, 0x39, 0xD0, 0xAD, 0x7D, 0x1E, 0x3A, 0xC9, 0x0A, 0xD7, 0xD1, 0xAD,
+    0x3D, 0x19, 0xD6, 0x9D, 0x19, 0xD9, 0x19, 0xCA, 0x19, 0xD9, 0x59, 0xD2, 0xDA, 0x1A, 0xC9, 0x19,
+    0xD9, 0x59, 0xD2, 0xAD, 0x1D, 0x3D, 0x95, 0xAC, 0xA3, 0xD9, 0x9C, 0xA3, 0xDA, 0x5A, 0xCA, 0x3D,
+    0xAD, 0x93, 0xDA, 0x5D, 0xA3, 0xAF, 0x4E, 0x5D, 0x94, 0xEA, 0x4E, 0x5D, 0x94, 0xE5, 0xE5, 0xD9,
+    0x49, 0xD5, 0xAD, 0x3A, 0xFC, 0xA3, 0x94, 0xAF, 0xD9, 0xAF, 0xE7, 0x09, 0xFE, 0xA0, 0x77, 0x5A,
+    0xFC, 0x7F, 0xF9, 0xAF, 0xC6, 0xAF, 0xCA, 0x3F, 0xA7, 0x0D, 0x5F, 0xC7, 0x0D, 0x5F, 0xD7, 0xD5,
+    0xD9, 0xAD, 0xA6, 0xD5, 0xD9, 0x0E, 0x95, 0xD5, 0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A, 0xDA, 0x4D,
+    0x5D, 0x92, 0xE9, 0x3D, 0x5D, 0x92, 0x9E, 0x3D, 0x5D, 0x93, 0xAE, 0x2D, 0x5D, 0x94, 0xE9, 0x1D,
+    0x5D, 0x95, 0xE1, 0xD5, 0xD9, 0x59, 0xE0, 0xD5, 0xD9, 0x6F, 0xD5, 0xD9, 0x7F, 0xC5, 0xD9, 0x79,
+    0xF3, 0xAF, 0xD6, 0xAE, 0x2F, 0xF7, 0xE7, 0x73, 0x93, 0x79, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97,
+    0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7,
+    0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD,
+    0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9,
+    0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA,
+    0x74, 0x99, 0x99, 0x97, 0x00, 0x39, 0x99, 0x99, 0x95, 0xAF, 0xFE, 0xA2, 0x9F, 0xCA, 0xAA, 0xFC,
+    0x93, 0xE3, 0x9F, 0x3E, 0x5E, 0x3E, 0x5A, 0xD9, 0x2E, 0x5A, 0xD9, 0x2E, 0x5A, 0xD9, 0x2E, 0x5E,
+    0x3E, 0x4A, 0xDA, 0x3E, 0x29, 0xAE, 0x4F, 0xFC, 0xA5, 0xFE, 0xA9, 0x6E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x2A, 0xFD, 0xA6, 0xFF, 0xC6, 0x70, 0x99, 0x99, 0x76, 0xAF, 0xF9, 0x71,
+    0xAF, 0xFE, 0xA7, 0xAE, 0x94, 0xAF, 0x5A, 0xE7, 0x9E, 0xA4, 0xE7, 0x1A, 0xE3, 0xAD, 0xA7, 0x2E,
+    0xA2, 0xE7, 0x3A, 0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAD, 0xA7,
+    0x4E, 0x1A, 0xE7, 0x4E, 0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x73, 0xAD, 0xA2, 0xEA, 0x72, 0xE3, 0xAE,
+    0x71, 0xAD, 0xA4, 0xF7, 0x9E, 0x59, 0xF9, 0x4A, 0xE7, 0x9F, 0xFF, 0x72, 0x9F, 0xEA, 0x97, 0x6A,
+    0xE7, 0x72, 0x9E, 0x97, 0x72, 0xFA, 0x97, 0x70, 0xAF, 0xFA, 0x75, 0xAF, 0xDA, 0x77, 0x9A, 0xAA,
+    0x90, 0x49, 0x99, 0x99, 0x71, 0xAF, 0xFE, 0xA6, 0x9F, 0xCA, 0xAA, 0xFC, 0x70, 0xE3, 0x9E, 0xA7,
+    0xE5, 0xE7, 0xE5, 0xE9, 0x6E, 0x5A, 0xD9, 0x6E, 0x5E, 0x7E, 0x5E, 0x7E, 0x39, 0xE7, 0x0E, 0x99,
+    0xAF, 0x71, 0xFF, 0x97, 0x2E, 0xAA, 0xE7, 0x3E, 0x1A, 0xDA, 0x72, 0xE2, 0xE9, 0x71, 0xE2, 0x9E,
+    0x97, 0x0E, 0x3A, 0xE7, 0x0E, 0x4F, 0x96, 0xE5, 0xF9, 0x3A, 0xFD, 0x93, 0xFA, 0x1F, 0xFA, 0x4F,
+    0xC7, 0x79, 0x99, 0x10, 0x59, 0x99, 0x96, 0x9F, 0xF9, 0x29, 0xFF, 0xD1, 0x9E, 0x93, 0xE1, 0xAD,
+    0x94, 0xAD, 0x1E, 0x59, 0xD1, 0xE5, 0x9C, 0x91, 0xF7, 0x19, 0xF9, 0x70, 0xAF, 0xC9, 0x79, 0xFC,
+    0xA7, 0x0A, 0xFC, 0x97, 0x0A, 0xFA, 0x70, 0x9F, 0x19, 0x7E, 0x9A, 0xCA, 0x6A, 0xD9, 0xAD, 0x6A,
+    0xD9, 0xAD, 0x6E, 0x0A, 0xE4, 0xEA, 0x0A, 0xFF, 0xDA, 0x2A, 0xFF, 0x96, 0x99, 0x99, 0x94, 0x77,
+    0x1A, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC, 0xAD, 0xA3, 0xE9, 0x3D, 0xAD, 0x93, 0xE9, 0x3D, 0x9D, 0x4E,
+    0x93, 0xAC, 0x99, 0xC4, 0xE9, 0x3A, 0xA7, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x72, 0x9A,
+    0xFE, 0x97, 0xFF, 0xC9, 0x30, 0x77, 0x59, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9,
+    0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72,
+    0xAF, 0xFA, 0x76, 0x99, 0x99, 0x70, 0x77, 0x4A, 0xFF, 0x3F, 0xF9, 0xFD, 0xA9, 0x39, 0xAF, 0xA9,
+    0x2E, 0x70, 0x9D, 0x94, 0xEA, 0x7E, 0x59, 0xE7, 0xDA, 0x6E, 0x69, 0xD9, 0x6A, 0xD9, 0x5E, 0x79,
+    0xE5, 0xDA, 0x70, 0xE4, 0x9D, 0x71, 0xAD, 0x93, 0xE7, 0x2D, 0xA3, 0xD9, 0x72, 0xE2, 0x9D, 0x73,
+    0xAD, 0x91, 0xDA, 0x74, 0xDA, 0x1D, 0x97, 0x4E, 0x09, 0xD7, 0x59, 0xD9, 0xDA, 0x76, 0xFC, 0x77,
+    0xAF, 0x77, 0x9E, 0x97, 0x70, 0xE7, 0x77, 0x50, 0x77, 0x77, 0x0F, 0xFA, 0x49, 0x95, 0x9F, 0xEA,
+    0x0A, 0xFD, 0xA5, 0xDA, 0x5A, 0xFC, 0xA3, 0xEA, 0x69, 0xE7, 0xE5, 0x9E, 0x6A, 0xE9, 0x6D, 0xA6,
+    0xE6, 0xFA, 0x59, 0xD9, 0x6E, 0x95, 0xFC, 0x5A, 0xD7, 0xAD, 0xA4, 0x9F, 0xC5, 0xE7, 0x0E, 0x4D,
+    0xA9, 0xD9, 0x4D, 0x97, 0x0E, 0x4D, 0x1E, 0x39, 0xD7, 0x1A, 0xD9, 0x29, 0xD1, 0xE3, 0xAD, 0x71,
+    0x9D, 0xA2, 0xAC, 0xA1, 0x9D, 0x92, 0xD9, 0x72, 0xE2, 0xD9, 0x2D, 0xA1, 0x9D, 0x73, 0xAD, 0x19,
+    0xD3, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xAC, 0xA3, 0x9D, 0x90, 0xDA, 0x74, 0xE0, 0xD9, 0x4D, 0xA0,
+    0xD7, 0x5A, 0xD9, 0xD5, 0xE9, 0xD7, 0x59, 0xFA, 0x5A, 0xFA, 0x76, 0xF9, 0x6F, 0x97, 0x6A, 0xE7,
+    0xF7, 0x79, 0xE7, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x5F, 0xFA, 0x2F, 0xE1, 0x9F, 0xDA, 0x39, 0xAF,
+    0x93, 0x9E, 0x95, 0x9D, 0x96, 0xAE, 0x5D, 0xA7, 0x0F, 0x3E, 0x72, 0xE9, 0x1A, 0xD7, 0x39, 0xE0,
+    0x9D, 0x97, 0x4A, 0xFC, 0xA7, 0x6F, 0xC7, 0x79, 0xE9, 0x77, 0xFC, 0x76, 0xAF, 0xD7, 0x49, 0xD9,
+    0x0E, 0x97, 0x3D, 0xA1, 0x9E, 0x72, 0xE3, 0xAE, 0x70, 0xAD, 0x94, 0xEA, 0x69, 0xDA, 0x59, 0xE9,
+    0x5E, 0x7A, 0xE3, 0xAF, 0xCA, 0x39, 0xAF, 0xDA, 0xFF, 0x3F, 0xFA, 0x77, 0x3A, 0xFF, 0x2A, 0xFD,
+    0xA9, 0xFD, 0xA3, 0x9A, 0xFA, 0x3E, 0x96, 0xAD, 0x5A, 0xE6, 0xDA, 0x6E, 0x94, 0xAD, 0x79, 0xE4,
+    0xD9, 0x70, 0xAD, 0x92, 0xAD, 0x72, 0xE1, 0x9D, 0x73, 0xAD, 0xA0, 0xDA, 0x74, 0xE9, 0xD7, 0x59,
+    0xF9, 0x76, 0xF7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77,
+    0x9D, 0xA7, 0x5A, 0xFE, 0xA7, 0x1A, 0xFF, 0xC4, 0x77, 0x0F, 0xFF, 0xCA, 0x1F, 0xFF, 0xD1, 0xDA,
+    0x59, 0xE9, 0x09, 0xD6, 0xEA, 0x19, 0xCA, 0x59, 0xE3, 0xA9, 0x5E, 0x73, 0xE9, 0x72, 0xAD, 0xA7,
+    0x29, 0xE7, 0x3E, 0x97, 0x2A, 0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x69, 0xC2,
+    0xE7, 0xD1, 0xE9, 0x69, 0xD0, 0xAE, 0x39, 0x99, 0x9E, 0x0F, 0xFF, 0xDA, 0x0A, 0xFF, 0xFC, 0x97,
+    0x70, 0xAF, 0x9F, 0xC9, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2,
+    0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA,
+    0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xFC, 0x99, 0xAA, 0xAA, 0x00, 0xAC, 0xA7, 0x19,
+    0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x2D, 0x97, 0x1A, 0xCA, 0x71, 0x9D, 0x72,
+    0xDA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xD7, 0x2D, 0xA7, 0x19,
+    0xD7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x29, 0x90, 0x9F, 0xA9, 0xFC, 0x2A, 0xD2,
+    0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD,
+    0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A,
+    0xD2, 0xAD, 0x9F, 0xC0, 0xAA, 0xAA, 0x90, 0x59, 0x97, 0x2A, 0xDA, 0x71, 0xF7, 0x09, 0xF9, 0x7D,
+    0xA9, 0xD7, 0xD1, 0xD9, 0x5A, 0xCA, 0x1A, 0xCA, 0x5D, 0x91, 0x9D, 0x49, 0xD3, 0xD9, 0x3D, 0xA3,
+    0xAD, 0x3D, 0x5D, 0x91, 0xAD, 0x5D, 0xA1, 0xD9, 0x59, 0xD1, 0xAA, 0x7A, 0xA0, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x1A,
+    0x4D, 0x93, 0xE3, 0xAE, 0x39, 0xE3, 0x9D, 0x94, 0xA0, 0x59, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4,
+    0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F,
+    0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF,
+    0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x39, 0x97, 0x4A, 0xF9, 0x73, 0xFC, 0x97, 0x59, 0xD9,
+    0x75, 0x9D, 0x97, 0x59, 0xD9, 0x75, 0x9D, 0x97, 0x59, 0xD9, 0x29, 0x97, 0x09, 0xD9, 0x0A, 0xFC,
+    0x95, 0x9D, 0xAF, 0xF9, 0x49, 0xFA, 0x90, 0x9F, 0x49, 0xE5, 0xEA, 0x39, 0xD9, 0x59, 0xE3, 0x9D,
+    0x96, 0xE3, 0x9D, 0x96, 0xE3, 0x9D, 0x96, 0xE3, 0x9D, 0x96, 0xE3, 0x9D, 0x96, 0xE3, 0x9D, 0x95,
+    0x9D, 0xA3, 0x9D, 0x95, 0xE4, 0x9D, 0xA4, 0xE9, 0x4A, 0xFF, 0xDA, 0x59, 0xFF, 0xC9, 0x72, 0x99,
+    0x99, 0x60, 0x69, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0x3E, 0x90, 0xAD, 0x49, 0xD9, 0x0D, 0xA5,
+    0xCA, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x0A, 0xE7, 0x09, 0xEA, 0x70,
+    0xFA, 0x93, 0x99, 0x1F, 0xFD, 0xA2, 0xAF, 0xEA, 0x69, 0x99, 0x92, 0x73, 0x99, 0x72, 0x9F, 0xC7,
+    0x2A, 0xFC, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x71, 0x99, 0x1E, 0x6A, 0xFF, 0xC4, 0x9F, 0xFE,
+    0x4E, 0x93, 0x9E, 0x3A, 0xD9, 0x5E, 0x3D, 0xA6, 0xE2, 0x9D, 0x96, 0xE2, 0xAD, 0x96, 0xE2, 0xE7,
+    0xE2, 0xE9, 0x6E, 0x2A, 0xD9, 0x6E, 0x2A, 0xDA, 0x6E, 0x29, 0xE5, 0x9E, 0x3F, 0x92, 0xAF, 0x4F,
+    0xFF, 0xDA, 0x2F, 0xDA, 0x09, 0xFA, 0x49, 0x99, 0x39, 0x30, 0x59, 0x97, 0x9F, 0xDA, 0x39, 0xFF,
+    0xA1, 0x9D, 0xA3, 0xE9, 0x0E, 0x49, 0xDA, 0x9D, 0x95, 0xEA, 0xD9, 0x5E, 0xAF, 0xFF, 0xFF, 0xFA,
+    0xE7, 0x1A, 0xD7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xFA, 0x39, 0xA9, 0x1F, 0xFD, 0x92, 0xAF, 0xEA,
+    0x59, 0x99, 0x93, 0x79, 0xAA, 0x97, 0xAF, 0xD9, 0x4A, 0xDA, 0xAA, 0xE3, 0x9D, 0x92, 0x9C, 0x93,
+    0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x97, 0x9A, 0xFF, 0x91, 0x9F, 0xFD, 0x92, 0x99, 0xAD,
+    0xA9, 0x99, 0x95, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19,
+    0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x79, 0xAF, 0xD9, 0x4F, 0xFA,
+    0x30, 0x69, 0x97, 0x39, 0xFF, 0xE9, 0x2A, 0xFF, 0xF9, 0x19, 0xDA, 0x3A, 0xD9, 0x09, 0x2A, 0xD5,
+    0xE4, 0xE5, 0xAD, 0x4E, 0x5E, 0x4A, 0xD9, 0x4E, 0x5E, 0x91, 0x9E, 0x95, 0x9F, 0xF9, 0x6D, 0xAF,
+    0xA7, 0xAD, 0x75, 0xE7, 0x5E, 0xA9, 0x99, 0x99, 0x96, 0xAF, 0xFE, 0xA4, 0xFF, 0xFA, 0x2D, 0xA6,
+    0x9E, 0x1E, 0x70, 0xE1, 0xDA, 0x70, 0xDA, 0x1E, 0x7E, 0x2F, 0xA9, 0x99, 0xAF, 0x4F, 0xFD, 0xA6,
+    0x9A, 0xAD, 0xAA, 0x95, 0x39, 0x97, 0x5A, 0xF7, 0x49, 0xFC, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE3, 0x99, 0x71, 0xE0, 0x9F, 0xD9, 0x6E, 0xAF, 0xF6, 0xFC, 0x91, 0x9E, 0xA5, 0xEA, 0x49,
+    0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6,
+    0xE5, 0xE6, 0xE3, 0x9F, 0xD3, 0xAF, 0xC9, 0x0F, 0xE2, 0xAF, 0xD9, 0x74, 0xE9, 0x49, 0xEA, 0x5E,
+    0xA5, 0x9A, 0xA7, 0x77, 0x72, 0x9A, 0xE9, 0x29, 0xFC, 0x94, 0x9E, 0x95, 0x9D, 0x95, 0x9D, 0x95,
+    0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93,
+    0x9A, 0xFC, 0xA1, 0xFF, 0x00, 0x74, 0x9E, 0x4A, 0xE9, 0x3A, 0xE5, 0xAA, 0x97, 0x77, 0x6A, 0xF2,
+    0xFD, 0x39, 0x9E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5D, 0xA4, 0xAD, 0x93, 0x9E, 0x3A, 0xE9, 0x19, 0xF9, 0x3A, 0xA9, 0x40, 0x39, 0x97, 0x4A, 0xF7,
+    0x39, 0xFC, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x2A, 0xFD, 0xA3, 0xE2, 0x9F,
+    0xD9, 0x3E, 0x39, 0xE9, 0x5E, 0x29, 0xDA, 0x7E, 0x1A, 0xDA, 0x70, 0xE0, 0xAD, 0x97, 0x1F, 0xD9,
+    0x72, 0xE9, 0xE7, 0x2E, 0x0A, 0xE7, 0x1E, 0x1A, 0xDA, 0x70, 0xE2, 0xEA, 0x7E, 0x3F, 0x6E, 0x4F,
+    0x39, 0xFC, 0xA2, 0x9F, 0x91, 0xFE, 0x4F, 0x76, 0x99, 0x10, 0x39, 0x93, 0xAF, 0x29, 0xFC, 0x5E,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD3, 0x9F, 0xDA, 0x9F, 0xF0, 0x72, 0x97,
+    0x99, 0x70, 0xAE, 0x1A, 0xFC, 0x92, 0xFD, 0x49, 0xFC, 0x9F, 0xF0, 0xAF, 0xF4, 0x9A, 0xFC, 0xA1,
+    0x9F, 0xD9, 0x1A, 0xE9, 0x59, 0xE4, 0x9E, 0xA4, 0xAD, 0xA5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95,
+    0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95,
+    0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE5, 0x9D, 0x95, 0xE6, 0xE3, 0x9A, 0xFC,
+    0x92, 0xAF, 0xC2, 0x9F, 0xD1, 0xFE, 0x91, 0xAF, 0xD2, 0xFE, 0x00, 0x72, 0x99, 0x7A, 0xE1, 0xAF,
+    0xCA, 0x39, 0xFC, 0x9F, 0xF9, 0x39, 0xAF, 0xCA, 0x19, 0xF5, 0x9E, 0x5E, 0x59, 0xD9, 0x5A, 0xD9,
+    0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9,
+    0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9,
+    0x29, 0xAF, 0xC9, 0x2A, 0xFC, 0xA0, 0xFE, 0x91, 0x9F, 0xE0, 0x69, 0x97, 0x2A, 0xFD, 0xA6, 0xFF,
+    0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0,
+    0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93,
+    0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x71, 0x99, 0x59, 0xAD, 0x90,
+    0x9F, 0xCA, 0x2A, 0xFA, 0xAF, 0xF2, 0x9A, 0xFC, 0x90, 0x9A, 0xEA, 0x3E, 0x94, 0xAE, 0x3E, 0x6E,
+    0x92, 0xE6, 0xAD, 0xA2, 0xE6, 0x9D, 0xA2, 0xE6, 0x9D, 0xA2, 0xE6, 0x9D, 0x92, 0xE6, 0xAD, 0x3E,
+    0x6E, 0x3E, 0x5A, 0xDA, 0x3E, 0x93, 0xAE, 0x4F, 0xFE, 0x5F, 0xFC, 0x96, 0xE7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x74, 0x9E, 0x99, 0x70, 0x9F, 0xF7, 0x9A, 0xAA, 0xAA, 0xAA, 0x97, 0x69, 0x97, 0x3A, 0xFE,
+    0xA9, 0x49, 0xFF, 0xE4, 0xE9, 0x39, 0xE3, 0xE9, 0x5E, 0x3D, 0xA6, 0xE2, 0x9D, 0x96, 0xE2, 0xAD,
+    0x96, 0xE2, 0xE7, 0xE2, 0xE9, 0x6E, 0x2A, 0xD9, 0x6E, 0x2A, 0xDA, 0x6E, 0x29, 0xE5, 0xAE, 0x3F,
+    0x91, 0x9F, 0xC4, 0xFF, 0xAE, 0x5A, 0xFC, 0x90, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x49,
+    0xE9, 0x71, 0xFF, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x72, 0x92, 0xAE, 0x19, 0xF9, 0xFC, 0x0A,
+    0xFC, 0x09, 0xAE, 0xAD, 0xAA, 0xCA, 0x29, 0xEA, 0x79, 0xE7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09,
+    0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x96, 0x9A, 0xFD,
+    0xA2, 0x9F, 0xFC, 0x20, 0x49, 0x97, 0xAF, 0xDA, 0x2E, 0xAA, 0xF1, 0xAD, 0x3A, 0xD1, 0xDA, 0x4D,
+    0x1E, 0x49, 0x2A, 0xEA, 0x7F, 0xCA, 0x6F, 0xDA, 0x59, 0xFC, 0xA7, 0xAE, 0x1C, 0xA4, 0x9D, 0x90,
+    0xD5, 0xD9, 0x0D, 0xA3, 0xAD, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE, 0x94, 0x99, 0x99, 0x40, 0x3A, 0xA7,
+    0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA6, 0x9A, 0xFE, 0xA0, 0xFF, 0xDA, 0x09, 0x99, 0xE9, 0x99, 0x94,
+    0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70,
+    0xE7, 0x0E, 0x97, 0xFF, 0x93, 0xFD, 0xA5, 0x99, 0x99, 0x20, 0x77, 0x3A, 0xF4, 0xAE, 0xA2, 0xAF,
+    0xC3, 0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5,
+    0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5,
+    0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90,
+    0xAF, 0x95, 0x99, 0x94, 0x93, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E, 0x96, 0xDA,
+    0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD9, 0x6E, 0x3A, 0xD7, 0xAD, 0x3D, 0x97,
+    0x9D, 0xA1, 0xAD, 0x71, 0xE1, 0xD9, 0x71, 0x9D, 0x99, 0xD7, 0x3D, 0xAA, 0xCA, 0x73, 0xAF, 0x75,
+    0xEA, 0x75, 0xAD, 0x97, 0x77, 0x00, 0x9F, 0xDA, 0x3A, 0xC4, 0xFD, 0x90, 0xFD, 0x93, 0xD9, 0x3A,
+    0xFC, 0x2E, 0x94, 0x9D, 0xA5, 0xDA, 0x39, 0xDA, 0x4A, 0xE4, 0x9D, 0x94, 0xE4, 0xF9, 0x3A, 0xD5,
+    0xAD, 0x92, 0x9F, 0xA3, 0xDA, 0x59, 0xDA, 0x2A, 0xCA, 0xAD, 0x3D, 0x7E, 0x2D, 0x09, 0xD9, 0x1A,
+    0xD7, 0xAD, 0x19, 0xD1, 0xDA, 0x1D, 0x97, 0x0D, 0x90, 0xAC, 0x91, 0xAD, 0x1D, 0x71, 0xE0, 0xD2,
+    0x9D, 0x99, 0xCA, 0x71, 0xAD, 0x9C, 0xA3, 0xDA, 0xD9, 0x72, 0xF9, 0x3A, 0xF7, 0x3F, 0x5E, 0xA7,
+    0x39, 0xDA, 0x5E, 0x97, 0x77, 0x70, 0x0F, 0xDA, 0x19, 0xFC, 0xA0, 0xFD, 0x91, 0x9F, 0xC9, 0x19,
+    0xE5, 0xDA, 0x49, 0xE3, 0xDA, 0x69, 0xDA, 0x1A, 0xCA, 0x70, 0xAD, 0x99, 0xD7, 0x2A, 0xF7, 0x4E,
+    0x97, 0x39, 0xF7, 0x3D, 0x9E, 0x71, 0xD9, 0x09, 0xE7, 0xDA, 0x2A, 0xDA, 0x5E, 0x4E, 0x92, 0xAF,
+    0xA2, 0x9F, 0xC9, 0xAF, 0xD9, 0x09, 0xFD, 0xA0, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA,
+    0x2E, 0x96, 0xDA, 0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A,
+    0xD3, 0xD9, 0x70, 0xDA, 0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7,
+    0x3A, 0xF7, 0x5E, 0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x4A, 0xE7, 0x1A, 0xFD,
+    0x97, 0x1A, 0xFC, 0x97, 0x3A, 0xCA, 0xA7, 0x40, 0x1F, 0xFD, 0xA1, 0x9F, 0xFE, 0x90, 0x9D, 0x93,
+    0xAD, 0xA1, 0x9C, 0x93, 0x9E, 0x29, 0xC4, 0xE7, 0x1E, 0x97, 0x0A, 0xD9, 0x70, 0x9D, 0xA7, 0x09,
+    0xE7, 0x1E, 0x71, 0xE9, 0x4C, 0xA1, 0xAD, 0xA4, 0x9C, 0xA0, 0x9D, 0xA5, 0xDA, 0x0F, 0xFF, 0x90,
+    0xAF, 0xFE, 0x76, 0x74, 0xAE, 0x29, 0xFA, 0x2E, 0x5D, 0xA4, 0x9D, 0x94, 0x9D, 0x95, 0xDA, 0x5D,
+    0xA5, 0xE5, 0xAD, 0x5A, 0xD5, 0xAD, 0x4A, 0xDA, 0x3E, 0xA4, 0xAE, 0x59, 0xE5, 0xAD, 0x5A, 0xD5,
+    0xAD, 0x5E, 0x5D, 0xA5, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x5D, 0xA5, 0xE9, 0x5F, 0xC9, 0x39, 0xAC,
+    0xA0, 0x4D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x19, 0x90, 0x71, 0xEA, 0x93, 0xFC,
+    0x95, 0xE5, 0x9D, 0x95, 0xD9, 0x5D, 0x94, 0x9D, 0x94, 0xAD, 0x5A, 0xD5, 0xE5, 0xDA, 0x5E, 0x59,
+    0xDA, 0x5A, 0xE4, 0xAE, 0x3A, 0xD9, 0x4E, 0x5D, 0xA5, 0xE5, 0xAD, 0x5A, 0xD5, 0x9D, 0x95, 0xD9,
+    0x5D, 0x94, 0x9D, 0x93, 0x9E, 0x2A, 0xF3, 0xAD, 0xA3, 0x77, 0xAE, 0x94, 0xC9, 0x0F, 0xE9, 0x1D,
+    0xA9, 0xD9, 0x0A, 0xFE, 0x09, 0xC9, 0x3A, 0xF9, 0x71, 0x99, 0x20, 0x19, 0x2E, 0x99, 0xE9, 0x0E,
+    0x29, 0x75, 0xD2, 0xD2, 0xD2, 0xD2, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x09, 0xDA, 0x09,
+    0xDA, 0x09, 0xDA, 0x0A, 0xDA, 0x0A, 0xDA, 0x0E, 0x90, 0xD9, 0x00, 0x77, 0x6C, 0xA7, 0x39, 0xCA,
+    0x73, 0x9C, 0xA7, 0x39, 0xC9, 0x73, 0x9C, 0x97, 0x29, 0xEA, 0x96, 0xAF, 0xF9, 0x3E, 0xAA, 0xC9,
+    0xAE, 0x2A, 0xD1, 0x9C, 0x1A, 0xD2, 0xD9, 0x19, 0xC1, 0x9C, 0xA1, 0xAD, 0x2A, 0xC6, 0xE2, 0xAC,
+    0x6E, 0x2A, 0xC6, 0xE2, 0xAC, 0x6E, 0x2A, 0xC6, 0xE2, 0xAC, 0x6A, 0xD9, 0x1D, 0x69, 0xE1, 0xD7,
+    0xFA, 0xD0, 0x99, 0xD3, 0xFF, 0xE4, 0xAF, 0xE9, 0x70, 0xD7, 0x4C, 0xA7, 0x4C, 0xA7, 0x4C, 0xA7,
+    0x4C, 0xA7, 0x4C, 0xA7, 0x49, 0x60, 0x77, 0x7A, 0xFA, 0x70, 0xFF, 0x6A, 0xD9, 0x1A, 0xDA, 0x49,
+    0xD9, 0x3E, 0x4A, 0xD4, 0xAC, 0x94, 0xDA, 0x59, 0x5D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x09,
+    0xAA, 0xEA, 0xAA, 0xAD, 0x3A, 0xFF, 0xDA, 0x6E, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x4D, 0xA7, 0x39, 0xDA, 0x59, 0x9A, 0x09, 0xFF, 0xFD, 0x1E, 0xAF, 0xFD, 0x19, 0xA6, 0x99,
+    0x99, 0x10, 0x09, 0x73, 0x90, 0x9C, 0xA3, 0x99, 0x3A, 0xC9, 0x0A, 0xCA, 0x0A, 0xFC, 0x9A, 0xCA,
+    0x2A, 0xFA, 0xAF, 0xA4, 0xDA, 0x3A, 0xD5, 0xD5, 0xD9, 0x39, 0xD5, 0xDA, 0x39, 0xD5, 0xD9, 0x39,
+    0xD5, 0xD9, 0x4D, 0x93, 0x9D, 0x5E, 0xA9, 0x9A, 0xE9, 0x29, 0xDA, 0xFD, 0xAD, 0x90, 0x9D, 0x29,
+    0xAA, 0x92, 0xD9, 0x0A, 0x73, 0xA0, 0x9F, 0xDA, 0x4A, 0xFA, 0x09, 0xFD, 0x94, 0xFC, 0xA2, 0xAE,
+    0x79, 0xD9, 0x4E, 0x96, 0xDA, 0x59, 0xE5, 0x9D, 0x7A, 0xD9, 0x4D, 0xA7, 0x0E, 0x39, 0xD7, 0x1A,
+    0xDA, 0x2D, 0x97, 0x09, 0x9E, 0x19, 0xD9, 0x99, 0x59, 0xFC, 0xA0, 0xFC, 0x96, 0x99, 0x9E, 0xAC,
+    0xA9, 0x99, 0x73, 0xF7, 0x3F, 0xFF, 0x7A, 0xFF, 0xDA, 0x73, 0x9D, 0x97, 0x79, 0xD9, 0x77, 0x9D,
+    0x97, 0x79, 0xD9, 0x75, 0xAF, 0xE9, 0x71, 0xAF, 0xF9, 0x40, 0x4D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x77, 0x5A, 0xA1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+    0x99, 0x00, 0x4A, 0xEA, 0x5A, 0xFE, 0x3A, 0xD2, 0xAD, 0x91, 0x9D, 0x4D, 0x2E, 0x49, 0x91, 0x9E,
+    0x97, 0xAF, 0x96, 0xAC, 0x9F, 0x94, 0xD1, 0xAE, 0xA3, 0xAC, 0x91, 0x9F, 0x29, 0xD3, 0x9E, 0x2E,
+    0x4D, 0xA2, 0xEA, 0x3D, 0x3F, 0x91, 0xAC, 0x93, 0xAE, 0xA0, 0x9C, 0x95, 0xAD, 0xAA, 0xC9, 0x69,
+    0xF9, 0x19, 0x49, 0xE1, 0xD5, 0xDA, 0x09, 0xD9, 0x3A, 0xD1, 0x9E, 0xA9, 0x9A, 0xD3, 0xAF, 0xDA,
+    0x69, 0xAA, 0x95, 0x1A, 0x93, 0x99, 0x1E, 0x91, 0xEA, 0x0E, 0x91, 0xEA, 0x0A, 0xCA, 0x29, 0xD0,
+    0x70, 0x99, 0x99, 0x76, 0x9F, 0xFA, 0x72, 0xEA, 0x91, 0x99, 0xAD, 0xA7, 0xDA, 0x70, 0xAC, 0xA5,
+    0xD9, 0x72, 0xAC, 0xA3, 0xAC, 0x93, 0x9A, 0xDA, 0x92, 0xAC, 0x92, 0xD3, 0xFD, 0xA3, 0xD1, 0xAC,
+    0x92, 0xD9, 0x2C, 0xA3, 0xAC, 0x1D, 0x29, 0xCA, 0x3C, 0x93, 0x9C, 0xA0, 0xD2, 0xAC, 0x97, 0x2C,
+    0xA0, 0xCA, 0x2D, 0x73, 0xD0, 0xCA, 0x2D, 0x73, 0xD0, 0xD2, 0xD9, 0x72, 0xCA, 0x0D, 0x2A, 0xD7,
+    0x19, 0xCA, 0x0A, 0xC9, 0x2D, 0xA9, 0x19, 0xA3, 0xAC, 0x2C, 0xA2, 0x9F, 0xE3, 0xD2, 0xAC, 0x93,
+    0x9A, 0xAA, 0x93, 0xAC, 0x93, 0xD9, 0x72, 0xAC, 0xA5, 0xD9, 0x70, 0xAD, 0x7E, 0xA9, 0x29, 0xAD,
+    0xA7, 0x19, 0xFF, 0xA7, 0x69, 0x99, 0x99, 0x70, 0x39, 0x96, 0xAF, 0xA3, 0xAD, 0x1D, 0x3A, 0xC9,
+    0x1D, 0x97, 0xD9, 0x3A, 0xFC, 0x92, 0xAD, 0x90, 0xD9, 0x2D, 0x2D, 0x92, 0xDA, 0x09, 0xE9, 0x19,
+    0xF9, 0xE3, 0x99, 0x29, 0x75, 0xAF, 0xEA, 0x1F, 0xF1, 0x4A, 0x94, 0x99, 0x4D, 0x93, 0xAC, 0xA2,
+    0x9D, 0xA3, 0xE2, 0x9D, 0xA2, 0x9E, 0x2A, 0xE2, 0x9E, 0x3E, 0x92, 0xAD, 0xA3, 0xAD, 0xA2, 0x9E,
+    0x4A, 0xD9, 0x29, 0xDA, 0x4A, 0xD9, 0x29, 0xDA, 0x49, 0xD4, 0xD9, 0x5C, 0x94, 0xAA, 0x00, 0x74,
+    0xFF, 0xF0, 0xFF, 0xF7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x50, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F,
+    0xFA, 0xAF, 0xE9, 0x69, 0x99, 0x72, 0x9F, 0xE9, 0x6A, 0xCA, 0x4A, 0xCA, 0x4A, 0xC9, 0x69, 0xC9,
+    0x3C, 0x90, 0xFC, 0x91, 0xAC, 0x2A, 0xC2, 0xCA, 0x0D, 0x2C, 0xA1, 0xCA, 0x2C, 0xA0, 0xAC, 0x2A,
+    0xC1, 0xC9, 0x2D, 0x9C, 0xA2, 0xAC, 0x1C, 0x92, 0xF3, 0xAC, 0x1C, 0xA2, 0xCA, 0x0C, 0xA2, 0xAC,
+    0x1D, 0x2C, 0xA0, 0x9C, 0xA1, 0xCA, 0x19, 0xC1, 0xEA, 0x09, 0xC9, 0x9C, 0x92, 0xD7, 0x0C, 0xA4,
+    0xD9, 0x49, 0xD6, 0xAD, 0xAA, 0xAD, 0xA7, 0x19, 0xAA, 0xA9, 0x50, 0x9A, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xFF, 0xC9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x75, 0xAF, 0x93, 0xFE, 0x91, 0xAC, 0xA2, 0xAD, 0x1D,
+    0x4D, 0x90, 0xD4, 0xD9, 0x0D, 0x93, 0xD1, 0xAD, 0x2A, 0xD2, 0xFE, 0x4A, 0xEA, 0x75, 0x4D, 0x72,
+    0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x5A, 0xAA, 0xAA, 0xDA, 0xAA, 0xAA, 0x0F, 0xFF, 0x19, 0x99, 0x9D,
+    0x99, 0x99, 0x95, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0x99, 0x77, 0x77, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x29, 0xAD, 0xA4, 0xFE, 0x91, 0xAD, 0x90, 0x9E, 0x1D, 0x92, 0xAD, 0x19, 0xC3, 0xAD, 0x7D, 0x96,
+    0xE6, 0xE6, 0xE6, 0xDA, 0x6D, 0xA6, 0xFF, 0xCA, 0x0F, 0xFC, 0x97, 0x20, 0x1A, 0xE9, 0x19, 0xFE,
+    0x0D, 0xA1, 0x9D, 0x99, 0xA3, 0xD9, 0x4A, 0xD3, 0x9E, 0x3F, 0xC9, 0x2A, 0xAA, 0xE9, 0x5D, 0xA5,
+    0xDA, 0x49, 0xD9, 0x99, 0x9A, 0xEA, 0x0F, 0xD9, 0x2A, 0xAA, 0x93, 0x29, 0x4D, 0x91, 0xE9, 0x0A,
+    0xDA, 0x1E, 0x1A, 0xCA, 0x39, 0x30, 0x77, 0x2D, 0xA5, 0x9D, 0x93, 0xAD, 0xA5, 0xAD, 0x93, 0xAD,
+    0x95, 0xAD, 0x4A, 0xD9, 0x5A, 0xD4, 0xAD, 0x95, 0xAD, 0x4A, 0xD9, 0x5A, 0xD4, 0xAD, 0x95, 0xAD,
+    0x4A, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E, 0x4A, 0xDA, 0x49, 0xE9, 0x3A, 0xE4, 0xAE,
+    0xA3, 0xAF, 0x2A, 0xDA, 0xD9, 0x2A, 0xFF, 0xCA, 0x0F, 0xC9, 0xAC, 0xA9, 0xFC, 0xA1, 0xAF, 0x0A,
+    0xD1, 0x99, 0x94, 0x99, 0x2A, 0xD7, 0x6A, 0xD7, 0x6A, 0xD7, 0x6E, 0x97, 0x5E, 0x76, 0xAA, 0x97,
+    0x60, 0x77, 0x29, 0xAF, 0xFA, 0x2F, 0xFD, 0xA2, 0xFE, 0x0D, 0x3A, 0xFD, 0xA0, 0xD3, 0xFE, 0xA0,
+    0xD2, 0x9F, 0xEA, 0x0D, 0x29, 0xFE, 0xA0, 0xD2, 0x9F, 0xEA, 0x0D, 0x3F, 0xEA, 0x0D, 0x3F, 0xEA,
+    0x0D, 0x4F, 0xDA, 0x0D, 0x49, 0xFC, 0xA0, 0xD6, 0xAC, 0xAC, 0xA0, 0xD7, 0x1C, 0xA0, 0xD7, 0x1C,
+    0xA0, 0xD7, 0x1C, 0xA0, 0xD7, 0x1C, 0xA0, 0xD7, 0x1C, 0xA0, 0xD7, 0x1C, 0xA0, 0xD7, 0x1C, 0xA0,
+    0xD7, 0x1C, 0xA0, 0xD7, 0x1C, 0xA0, 0xC9, 0x71, 0xCA, 0x74, 0xC9, 0x77, 0x40, 0x09, 0xD9, 0x1F,
+    0x1F, 0x19, 0xD9, 0x00, 0x09, 0xA9, 0x1A, 0xF1, 0x9A, 0xD2, 0x9D, 0x2D, 0xA0, 0x9D, 0xA2, 0xA9,
+    0x20, 0x39, 0xA3, 0x9A, 0xE2, 0x9F, 0xC5, 0xAD, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5,
+    0x9D, 0x59, 0xD4, 0x9A, 0xDA, 0x91, 0xFE, 0x97, 0x00, 0x49, 0x95, 0x9F, 0xCA, 0x3D, 0xA9, 0xAD,
+    0xA1, 0xDA, 0x29, 0xD1, 0xD4, 0xD9, 0x0D, 0x4D, 0x90, 0xD9, 0x3D, 0x90, 0xDA, 0x29, 0xD1, 0xAD,
+    0xA0, 0x9D, 0xA2, 0xAF, 0xCA, 0x59, 0xA9, 0x77, 0x0F, 0xEA, 0x19, 0xFE, 0x10, 0x0A, 0x5A, 0x95,
+    0xD9, 0x3A, 0xCA, 0x5D, 0xA3, 0xE4, 0x9D, 0xA3, 0xE4, 0x9E, 0x3E, 0x4E, 0x92, 0xAD, 0xA2, 0xAE,
+    0x29, 0xE9, 0x19, 0xE3, 0xE9, 0x2E, 0x3E, 0x3D, 0xA3, 0xAD, 0x4C, 0x94, 0xCA, 0x40, 0x77, 0x77,
+    0x76, 0xC9, 0x71, 0x9A, 0xC7, 0x39, 0xD7, 0xAF, 0x73, 0xD9, 0x69, 0xFC, 0x72, 0xAC, 0xA7, 0x29,
+    0xD7, 0x2D, 0x73, 0x9D, 0x71, 0xAC, 0xA7, 0x39, 0xD7, 0x1D, 0x74, 0x9D, 0x70, 0xAC, 0x97, 0x49,
+    0xD7, 0x0D, 0x5A, 0xCA, 0x49, 0xD7, 0xAC, 0x5A, 0xDA, 0x49, 0xD6, 0x9C, 0xA4, 0x9E, 0xA4, 0x9D,
+    0x6D, 0x5F, 0xA2, 0x9A, 0xFA, 0x39, 0xCA, 0x4D, 0xAA, 0xCA, 0x2F, 0xE9, 0x2D, 0x4A, 0xD0, 0xAC,
+    0xA7, 0x4A, 0xC9, 0x39, 0xD1, 0xAC, 0xA7, 0x4D, 0x4D, 0x91, 0xAC, 0xA7, 0x3D, 0x93, 0xEA, 0xAA,
+    0xEA, 0x97, 0x09, 0xD4, 0xAF, 0xFD, 0x70, 0xD6, 0x99, 0x99, 0x9D, 0xA9, 0x97, 0xAC, 0xA7, 0x3A,
+    0xCA, 0x71, 0xD7, 0x4A, 0xCA, 0x70, 0xAC, 0xA7, 0x49, 0x99, 0x71, 0xA7, 0x72, 0x77, 0x77, 0x75,
+    0x9A, 0x72, 0x9A, 0xC7, 0x3D, 0x97, 0xAF, 0x72, 0xAC, 0xA7, 0x9F, 0xC7, 0x2D, 0x73, 0x9D, 0x71,
+    0xAC, 0xA7, 0x39, 0xD7, 0x1D, 0x74, 0x9D, 0x70, 0xAC, 0x97, 0x49, 0xD7, 0x0D, 0x75, 0x9D, 0x7A,
+    0xC9, 0x29, 0xF9, 0x49, 0xD6, 0x9C, 0xA2, 0xFE, 0xA3, 0x9D, 0x6D, 0x2A, 0xD2, 0xE3, 0x9D, 0x59,
+    0xCA, 0x2A, 0xCA, 0x29, 0xD1, 0x9A, 0xFA, 0x3D, 0x4A, 0x92, 0xAD, 0x1F, 0xE9, 0x1A, 0xC9, 0x71,
+    0xDA, 0x73, 0xD7, 0x1E, 0x73, 0xAC, 0x97, 0x0A, 0xD7, 0x39, 0xD7, 0x0E, 0x74, 0xD9, 0x7E, 0x74,
+    0x9C, 0xA7, 0xE7, 0x5D, 0x7F, 0xFD, 0x6A, 0xCA, 0x79, 0xFF, 0x96, 0xD7, 0x77, 0x19, 0x97, 0x72,
+    0x77, 0x77, 0x77, 0xC9, 0x70, 0x9F, 0xA7, 0x29, 0xD7, 0xAF, 0xE7, 0x1D, 0x97, 0xD9, 0x2D, 0x97,
+    0xAC, 0xA7, 0x19, 0x3D, 0x70, 0xD7, 0x6E, 0x7A, 0xCA, 0x73, 0x9A, 0xDA, 0x70, 0xD7, 0x4F, 0xCA,
+    0x6A, 0xC9, 0x74, 0xA9, 0x9A, 0xD9, 0x5D, 0x59, 0xD7, 0x0D, 0xA4, 0xAC, 0x59, 0xE7, 0x0D, 0xA3,
+    0x9C, 0xA5, 0xF7, 0xAD, 0x4D, 0x5F, 0xC2, 0x9A, 0xAF, 0x93, 0x9C, 0xA4, 0xAD, 0x9D, 0x2F, 0xD9,
+    0x4D, 0x49, 0xD0, 0x9D, 0x39, 0x99, 0x6A, 0xC9, 0x4D, 0x90, 0x9D, 0x75, 0xD4, 0xDA, 0x19, 0xD7,
+    0x4D, 0x93, 0x9D, 0xAA, 0xAA, 0xDA, 0xA7, 0x19, 0xD4, 0x9F, 0xFD, 0x71, 0xD6, 0x99, 0x99, 0x9A,
+    0xD9, 0x97, 0x0A, 0xCA, 0x73, 0x9D, 0x72, 0xD7, 0x49, 0xD7, 0x1A, 0xCA, 0x75, 0x99, 0x72, 0xA7,
+    0x73, 0x59, 0x97, 0xAD, 0xA6, 0xF6, 0xEA, 0x79, 0x97, 0x77, 0x69, 0xCA, 0x70, 0xD7, 0xAD, 0x5A,
+    0xF3, 0xAF, 0xD2, 0xAF, 0xCA, 0x3E, 0x95, 0x9D, 0x79, 0xD7, 0x0D, 0x70, 0xE7, 0x9E, 0x3A, 0x2A,
+    0xFE, 0x92, 0xAF, 0xD9, 0x39, 0xAE, 0xA7, 0x30, 0x69, 0x77, 0x3A, 0xCA, 0x77, 0x2F, 0x97, 0x71,
+    0xFA, 0x77, 0x19, 0xF7, 0x73, 0x99, 0x77, 0x77, 0x71, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70,
+    0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2,
+    0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA,
+    0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6,
+    0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00,
+    0x74, 0x97, 0x73, 0xD9, 0x77, 0x0A, 0xEA, 0x77, 0xFC, 0x77, 0xEA, 0x97, 0x70, 0xA9, 0x77, 0x77,
+    0x74, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A,
+    0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72,
+    0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A,
+    0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x71, 0x97, 0x73, 0xE9, 0x77, 0x0F, 0xC9, 0x76,
+    0xE0, 0xAD, 0x97, 0x4A, 0xD2, 0xAD, 0x74, 0xD4, 0xAC, 0x77, 0x77, 0x79, 0x77, 0x29, 0xDA, 0x77,
+    0x1F, 0x77, 0x09, 0xF9, 0x77, 0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E,
+    0x74, 0x9D, 0x2E, 0x74, 0xDA, 0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99,
+    0x99, 0xAD, 0xA7, 0x09, 0xFF, 0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A,
+    0xD7, 0x0E, 0x6D, 0xA7, 0x0E, 0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9,
+    0x4F, 0xF0, 0x77, 0x73, 0x9E, 0x91, 0xCA, 0x74, 0xFC, 0xAA, 0xD7, 0x4D, 0x9A, 0xFC, 0x74, 0xCA,
+    0x19, 0xE7, 0x77, 0x77, 0x77, 0x69, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77, 0xAF,
+    0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA, 0x2A,
+    0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF, 0xF7,
+    0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E, 0xA4,
+    0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF0, 0x59, 0x94, 0x97, 0x49,
+    0xE2, 0xE7, 0x3A, 0xE1, 0x9E, 0x97, 0x29, 0xDA, 0x2E, 0x77, 0x77, 0x77, 0x75, 0x97, 0x72, 0x9D,
+    0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D,
+    0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E,
+    0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69,
+    0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0,
+    0xFE, 0x94, 0xFF, 0x00, 0x70, 0x9A, 0x97, 0x71, 0xFC, 0x77, 0xD9, 0x9A, 0xCA, 0x76, 0xD2, 0xD7,
+    0x6D, 0x2D, 0x76, 0xDA, 0x9A, 0xCA, 0x76, 0x9F, 0xC7, 0x71, 0x99, 0x97, 0x74, 0x97, 0x72, 0x9D,
+    0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D,
+    0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E,
+    0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69,
+    0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0,
+    0xFE, 0x94, 0xFF, 0x00, 0x77, 0x77, 0x4A, 0xFF, 0xFE, 0x73, 0xAF, 0xFF, 0xD7, 0x4D, 0xAD, 0xA4,
+    0x9D, 0x73, 0xAC, 0xA9, 0xDA, 0x5D, 0x73, 0xD0, 0x9D, 0xA5, 0xAC, 0x72, 0xAC, 0xA0, 0x9D, 0xA7,
+    0x71, 0x9D, 0x19, 0xDA, 0x77, 0x1D, 0xA1, 0x9D, 0xA7, 0x70, 0x9D, 0x29, 0xDA, 0x09, 0x99, 0x99,
+    0x72, 0xD9, 0x29, 0xFF, 0xC9, 0x70, 0xAD, 0x39, 0xFF, 0xC7, 0x1D, 0xA9, 0x99, 0x9A, 0xDA, 0x76,
+    0xFF, 0xEA, 0x75, 0x9D, 0xAA, 0xAA, 0xAA, 0xEA, 0x75, 0xDA, 0x59, 0xDA, 0x6A, 0x93, 0xAD, 0x69,
+    0xDA, 0x6D, 0x3D, 0xA6, 0x9D, 0xA5, 0xAD, 0x2A, 0xD7, 0xAD, 0xA2, 0x99, 0x9D, 0xA0, 0x9F, 0xCA,
+    0x39, 0xFF, 0xFC, 0xA0, 0xFE, 0x92, 0xFF, 0xFD, 0x00, 0x79, 0x99, 0x99, 0x71, 0xAF, 0xF9, 0x4A,
+    0xFF, 0xD9, 0x3A, 0xE9, 0x39, 0xD9, 0x29, 0xDA, 0x6D, 0x92, 0xE7, 0xD9, 0x1A, 0xD9, 0x7A, 0xC2,
+    0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xDA, 0x74, 0xAE, 0x74, 0x9E,
+    0x75, 0xE9, 0x74, 0xF7, 0x49, 0xF9, 0x73, 0xAF, 0xCA, 0x99, 0x99, 0xAA, 0xC9, 0x29, 0xFF, 0xF5,
+    0xAF, 0xFA, 0x71, 0x99, 0x99, 0x74, 0x9A, 0x97, 0x4A, 0xEA, 0x74, 0x9E, 0x75, 0xAD, 0x74, 0x9D,
+    0xA7, 0x3A, 0xDA, 0x75, 0xA9, 0x60, 0x39, 0x97, 0x6D, 0xA7, 0x5F, 0x74, 0x9F, 0xA7, 0x49, 0xEA,
+    0x76, 0x99, 0x77, 0x77, 0x7A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC,
+    0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD,
+    0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x72, 0x97, 0x59, 0xD7, 0x4A, 0xE9, 0x71, 0x9F, 0xA7, 0x2E,
+    0xA7, 0x4A, 0x77, 0x77, 0x73, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9, 0x3E, 0x6A,
+    0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF, 0xE5, 0xFF,
+    0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49, 0x9A, 0xD1,
+    0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x79, 0x75, 0x9E, 0x97, 0x3F, 0xC9, 0x71, 0xE0, 0xE7, 0x0E,
+    0x2E, 0x69, 0xCA, 0x4A, 0xA7, 0x77, 0x75, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9,
+    0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF,
+    0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49,
+    0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x39, 0x93, 0x99, 0x7A, 0xDA, 0x19, 0xE6, 0xF1,
+    0xAE, 0x69, 0xD9, 0x2D, 0xA7, 0x77, 0x77, 0x76, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6,
+    0xD9, 0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95,
+    0xFF, 0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E,
+    0x49, 0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x09, 0x6A, 0xD5, 0xAE, 0x94, 0xFA, 0x49,
+    0xAE, 0x69, 0x97, 0x73, 0xFF, 0xA9, 0xFD, 0xA3, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE3, 0xAF, 0xD9, 0xFF, 0xA0, 0x69, 0x6D, 0x93, 0x9E,
+    0xA2, 0xFC, 0x2E, 0xA9, 0x3A, 0x97, 0x76, 0xFF, 0xA9, 0xFD, 0xA3, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE3, 0xAF, 0xD9, 0xFF, 0xA0, 0x49,
+    0x97, 0xE9, 0x5F, 0xCA, 0x3A, 0xD0, 0xAD, 0xA1, 0xAD, 0x2A, 0xD1, 0xD4, 0x9C, 0x77, 0x7F, 0xFA,
+    0x19, 0xFD, 0xA5, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE5, 0xAF, 0xD9, 0x1F, 0xFA, 0x00, 0x09, 0x94, 0x99, 0x09, 0xE2, 0xE9, 0xAE, 0x19,
+    0xE9, 0x0D, 0xA2, 0xE7, 0x77, 0x72, 0xFF, 0xA1, 0x9F, 0xDA, 0x5E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x5A, 0xFD, 0x91, 0xFF, 0xA0, 0x59,
+    0x99, 0x99, 0x97, 0x1A, 0xFF, 0xFA, 0x69, 0xFC, 0xAA, 0xFE, 0xA7, 0xE4, 0x9F, 0xC6, 0xE6, 0x9E,
+    0xA5, 0xE7, 0x9E, 0x5E, 0x70, 0xEA, 0x4E, 0x70, 0x9E, 0x4E, 0x71, 0xE4, 0xE7, 0x1E, 0x90, 0xFF,
+    0xDA, 0x4E, 0x90, 0xFF, 0xDA, 0x4E, 0x93, 0xE7, 0x1E, 0x4E, 0x71, 0xE4, 0xE7, 0x09, 0xDA, 0x4E,
+    0x70, 0xE9, 0x4E, 0x7A, 0xDA, 0x5E, 0x6A, 0xE6, 0xE3, 0x9A, 0xF5, 0xAF, 0xFF, 0xA5, 0xFF, 0xEA,
+    0x97, 0x77, 0x30, 0x77, 0x73, 0x9E, 0x91, 0xCA, 0x74, 0xFC, 0xAA, 0xD7, 0x4D, 0x9A, 0xFC, 0x74,
+    0xAA, 0x19, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xFC, 0x7F, 0xF9, 0xAF, 0xC6, 0xAF, 0xCA, 0x3F,
+    0xA7, 0x0D, 0x5F, 0xC7, 0x0D, 0x5F, 0xD7, 0xD5, 0xD9, 0xAD, 0xA6, 0xD5, 0xD9, 0x0E, 0x95, 0xD5,
+    0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A, 0xDA, 0x4D, 0x5D, 0x92, 0xE9, 0x3D, 0x5D, 0x92, 0x9E, 0x3D,
+    0x5D, 0x93, 0xAE, 0x2D, 0x5D, 0x94, 0xE9, 0x1D, 0x5D, 0x95, 0xE1, 0xD5, 0xD9, 0x59, 0xE0, 0xD5,
+    0xD9, 0x6F, 0xD5, 0xD9, 0x7F, 0xC5, 0xD9, 0x79, 0xF3, 0xAF, 0xD6, 0xAE, 0x2F, 0xF7, 0xE7, 0x73,
+    0x93, 0x69, 0x77, 0x2A, 0xCA, 0x77, 0x1F, 0x97, 0x79, 0xFA, 0x77, 0x09, 0xEA, 0x77, 0x29, 0x97,
+    0x77, 0x74, 0x99, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A,
+    0xE7, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39,
+    0xE0, 0x9E, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73,
+    0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F,
+    0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x74, 0x97, 0x71,
+    0x9D, 0x97, 0x7A, 0xE9, 0x76, 0xFA, 0x76, 0xEA, 0x77, 0x0A, 0x97, 0x77, 0x77, 0x99, 0xAA, 0x97,
+    0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2, 0x9E, 0x71,
+    0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74, 0xE0, 0xAD,
+    0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA,
+    0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF,
+    0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x71, 0x97, 0x72, 0xE9, 0x77, 0xFC, 0x97, 0x5E,
+    0x0E, 0x97, 0x3E, 0x2A, 0xD7, 0x3C, 0xA4, 0xAA, 0x77, 0x77, 0x29, 0x9A, 0xA9, 0x74, 0x9F, 0xFC,
+    0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD,
+    0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0,
+    0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72,
+    0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF,
+    0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x77, 0x72, 0xAE, 0x91, 0xCA, 0x73, 0xFC, 0x9A, 0xD7, 0x29,
+    0xD9, 0xAF, 0xA7, 0x3C, 0x91, 0xAE, 0x77, 0x77, 0x77, 0x70, 0x99, 0xAA, 0x97, 0x49, 0xFF, 0xC9,
+    0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x2A, 0xDA,
+    0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A,
+    0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E,
+    0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF,
+    0xA7, 0x49, 0x99, 0x99, 0x70, 0x59, 0x94, 0x97, 0x3A, 0xE2, 0xE7, 0x2F, 0x19, 0xE9, 0x71, 0x9D,
+    0xA2, 0xE7, 0x77, 0x77, 0x77, 0x99, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F,
+    0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE,
+    0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74,
+    0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F,
+    0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70,
+    0x74, 0xD5, 0xD1, 0xE3, 0xAD, 0x2E, 0x1A, 0xD4, 0xDA, 0xAD, 0x6F, 0x7A, 0xDA, 0x6A, 0xFA, 0x4A,
+    0xD1, 0xDA, 0x2A, 0xD3, 0xDA, 0x09, 0xD5, 0xD9, 0x09, 0x79, 0x00, 0x70, 0x99, 0xAA, 0x95, 0x96,
+    0x9F, 0xFC, 0x91, 0x9C, 0xA4, 0xAF, 0xCA, 0xFD, 0xAD, 0x4F, 0x94, 0xAF, 0xC4, 0xAE, 0x79, 0xEA,
+    0x39, 0xE7, 0x0A, 0xF3, 0xAD, 0xA7, 0xAF, 0xCA, 0x2E, 0x7A, 0xD0, 0xAE, 0x19, 0xE6, 0xAD, 0x19,
+    0xE1, 0x9E, 0x5A, 0xD2, 0x9E, 0x1A, 0xDA, 0x4A, 0xD4, 0xE1, 0xAD, 0xA3, 0xAD, 0x5E, 0x1A, 0xE2,
+    0xAD, 0x6E, 0x19, 0xE1, 0xAD, 0x69, 0xE1, 0x9E, 0x9A, 0xD7, 0xAD, 0xA2, 0xFD, 0x70, 0xE9, 0x2A,
+    0xF7, 0x0A, 0xE4, 0xF7, 0x9E, 0x4A, 0xFC, 0x94, 0xAE, 0x93, 0xAD, 0x9F, 0xFF, 0x94, 0xD2, 0xAF,
+    0xFA, 0x75, 0x99, 0x99, 0x97, 0x00, 0x79, 0x77, 0x3A, 0xD7, 0x72, 0xAE, 0x97, 0x71, 0xFA, 0x77,
+    0x19, 0xAE, 0x77, 0x39, 0x97, 0x77, 0x77, 0x73, 0x9F, 0xF4, 0xFF, 0x0F, 0xDA, 0x5A, 0xFC, 0xA3,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xAD, 0x97, 0x09, 0xD5,
+    0xAD, 0x97, 0x0A, 0xD5, 0x9E, 0x70, 0xE6, 0xE9, 0x6A, 0xDA, 0x6A, 0xEA, 0x39, 0xAE, 0x70, 0xFF,
+    0xF7, 0x2A, 0xFF, 0xA7, 0x69, 0x99, 0x97, 0x00, 0x75, 0x97, 0x73, 0xD9, 0x77, 0x0A, 0xEA, 0x77,
+    0xFC, 0x77, 0xEA, 0x97, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x69, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF,
+    0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09,
+    0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09,
+    0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70,
+    0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7,
+    0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0x99, 0x70, 0x72, 0x99, 0x77, 0x2E, 0x97, 0x70, 0xFC,
+    0xA7, 0x6A, 0xD0, 0xAD, 0x97, 0x4A, 0xD2, 0xAD, 0x74, 0xD4, 0x9C, 0x77, 0x77, 0x77, 0x19, 0xFF,
+    0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD,
+    0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0x99, 0x70, 0x69, 0x94,
+    0x99, 0x73, 0x9E, 0x2E, 0x97, 0x2A, 0xE1, 0x9E, 0x97, 0x29, 0xDA, 0x2E, 0x77, 0x77, 0x77, 0x77,
+    0x79, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9,
+    0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9,
+    0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9,
+    0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E,
+    0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0x99, 0x70,
+    0x73, 0x97, 0x71, 0xAC, 0xA7, 0x69, 0xF7, 0x5A, 0xF9, 0x74, 0xAE, 0x97, 0x69, 0x97, 0x77, 0x77,
+    0x72, 0xAF, 0xF2, 0xAF, 0xDA, 0x9F, 0xDA, 0x39, 0xAF, 0xA3, 0xE9, 0x6A, 0xD5, 0xAE, 0x6D, 0xA6,
+    0xE9, 0x4A, 0xD7, 0x9E, 0x4D, 0x97, 0x0A, 0xD9, 0x2A, 0xD7, 0x2E, 0x19, 0xD7, 0x3A, 0xDA, 0x0D,
+    0xA7, 0x4E, 0x9D, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79,
+    0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x75, 0xAF, 0xEA, 0x71, 0xAF, 0xFC, 0x40, 0x77, 0xAF, 0xE9,
+    0x69, 0xAF, 0xA9, 0x72, 0xE7, 0x4E, 0x09, 0x72, 0xFF, 0xCA, 0x5E, 0xAA, 0xAF, 0xC4, 0xE4, 0xF3,
+    0xE5, 0xE9, 0x2E, 0x59, 0xDA, 0x2E, 0x59, 0xDA, 0x2E, 0x59, 0xDA, 0x2E, 0x5A, 0xD9, 0x2E, 0x49,
+    0xE3, 0xE3, 0xAE, 0x4F, 0xFD, 0x5F, 0xEA, 0x96, 0xE7, 0x4E, 0x72, 0xAF, 0xCA, 0x7F, 0xF9, 0x60,
+    0x79, 0xAA, 0xA9, 0x72, 0x9F, 0xE9, 0x79, 0xEA, 0xAF, 0x95, 0x9D, 0xA3, 0x9E, 0x5E, 0x5E, 0x5D,
+    0xA5, 0xE4, 0x9D, 0x95, 0xDA, 0x4A, 0xD5, 0xAD, 0x5A, 0xD4, 0xE6, 0xAD, 0x3A, 0xCA, 0x7A, 0xD3,
+    0xD7, 0x0A, 0xD2, 0x9D, 0x97, 0xAD, 0x29, 0xE7, 0xAD, 0x3F, 0x95, 0xAD, 0x4F, 0xA4, 0xAD, 0x5F,
+    0xA3, 0xAD, 0x6A, 0xE9, 0x2A, 0xD7, 0xAD, 0xA2, 0xAD, 0x70, 0xDA, 0x2A, 0xD1, 0xCA, 0x4D, 0xA2,
+    0xAD, 0x1D, 0x39, 0xD1, 0x9F, 0x1E, 0xAA, 0xAD, 0xA1, 0xFC, 0x19, 0xFD, 0x97, 0x39, 0x99, 0x40,
+    0x2A, 0x97, 0x39, 0xD7, 0x3A, 0xE7, 0x3E, 0xA7, 0x3E, 0x97, 0x3A, 0xD7, 0x5A, 0x77, 0x73, 0x99,
+    0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7,
+    0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E,
+    0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99, 0x94, 0x92, 0x79, 0x74, 0x9D, 0x73,
+    0xE7, 0x2A, 0xDA, 0x71, 0x9D, 0xA7, 0x2D, 0xA7, 0x39, 0x97, 0x77, 0x49, 0x97, 0x19, 0xFD, 0x95,
+    0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF,
+    0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92,
+    0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x77, 0x3E, 0x72, 0xAF, 0x71, 0xDA, 0xDA,
+    0x7E, 0x09, 0xD9, 0x5A, 0xD2, 0xAD, 0x5D, 0x4A, 0xA7, 0x77, 0x09, 0x97, 0x19, 0xFD, 0x95, 0xFA,
+    0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3,
+    0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF,
+    0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x77, 0x09, 0xE9, 0x1C, 0xA5, 0xFC, 0x99, 0xD5,
+    0xD0, 0x9F, 0xC5, 0xAA, 0x19, 0xE7, 0x77, 0x77, 0x09, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9,
+    0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA,
+    0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1,
+    0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x19, 0xA4, 0xA9, 0x49, 0xE2, 0xE4, 0x9E, 0x19, 0xE9, 0x4A,
+    0xC9, 0x2A, 0xCA, 0x77, 0x77, 0x79, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E,
+    0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93,
+    0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39,
+    0x99, 0x49, 0x20, 0x39, 0xAC, 0xA9, 0x70, 0x9F, 0xC9, 0x7D, 0x19, 0xD7, 0xD2, 0xD7, 0xD2, 0xD7,
+    0xDA, 0x9A, 0xCA, 0x70, 0xFA, 0x72, 0x99, 0x75, 0x99, 0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92,
+    0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA,
+    0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F,
+    0xD1, 0xF3, 0x99, 0x94, 0x92, 0x59, 0x96, 0x99, 0x79, 0xFC, 0xA2, 0xFD, 0x93, 0xFA, 0xEA, 0x9F,
+    0xF9, 0x1E, 0x92, 0xAF, 0x92, 0x9E, 0x1E, 0x4E, 0xA4, 0xE1, 0x9C, 0x94, 0xE5, 0xAD, 0x97, 0x0E,
+    0x29, 0x99, 0xE9, 0x59, 0xAA, 0xFF, 0xF9, 0x2A, 0xFF, 0xDA, 0xAA, 0x99, 0x92, 0x9E, 0xA9, 0x90,
+    0xE7, 0x2E, 0x4E, 0x71, 0xAD, 0x94, 0xAD, 0x97, 0x0A, 0xD9, 0x4A, 0xE7, 0x09, 0xE3, 0xAF, 0xC9,
+    0x39, 0xA1, 0xFF, 0xC9, 0xFF, 0xD2, 0xFD, 0x92, 0xFF, 0x49, 0x99, 0x79, 0x99, 0x93, 0x69, 0x97,
+    0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0x3E, 0x90, 0xAD, 0x49, 0xD9, 0x0D, 0xA5, 0xCA, 0x09, 0xD9, 0x70,
+    0xAD, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x0A, 0xE7, 0x09, 0xEA, 0x70, 0xFA, 0x93, 0x99, 0x1F,
+    0xFD, 0xA2, 0xAF, 0xEA, 0x69, 0x99, 0x97, 0x09, 0x97, 0x1F, 0x97, 0x09, 0xE7, 0x1E, 0x70, 0x9D,
+    0x70, 0xAD, 0x97, 0x09, 0x95, 0x3A, 0x72, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0x9E, 0x72, 0xDA,
+    0x72, 0x97, 0x77, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D, 0xA9,
+    0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09, 0xE7,
+    0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x70, 0x97, 0x2D, 0xA7,
+    0x09, 0xE7, 0x0E, 0x70, 0xE9, 0x79, 0xD7, 0x2A, 0x77, 0x70, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA,
+    0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE,
+    0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5,
+    0x99, 0x99, 0x30, 0x77, 0x19, 0xDA, 0x70, 0xFA, 0x6A, 0xDA, 0xD9, 0x49, 0xD9, 0x0E, 0x4D, 0xA2,
+    0xD9, 0x29, 0xCA, 0x4C, 0x97, 0x73, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90,
+    0xE4, 0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD,
+    0x97, 0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x29,
+    0x93, 0x99, 0x3E, 0xA1, 0xAE, 0x2E, 0xA1, 0xAE, 0x29, 0xD3, 0xD9, 0x77, 0x77, 0x09, 0x97, 0x9F,
+    0xDA, 0x39, 0xFF, 0xA1, 0x9D, 0xA3, 0xE9, 0x0E, 0x49, 0xDA, 0x9D, 0x95, 0xEA, 0xD9, 0x5E, 0xAF,
+    0xFF, 0xFF, 0xFA, 0xE7, 0x1A, 0xD7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xFA, 0x39, 0xA9, 0x1F, 0xFD,
+    0x92, 0xAF, 0xEA, 0x59, 0x99, 0x93, 0x09, 0x97, 0xD9, 0x59, 0xE6, 0xAE, 0x6A, 0xDA, 0x69, 0xD9,
+    0x7A, 0x77, 0x70, 0x9A, 0xE9, 0x29, 0xFC, 0x94, 0x9E, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95,
+    0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93, 0x9A, 0xFC,
+    0xA1, 0xFF, 0x00, 0x59, 0x97, 0xD9, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xAC, 0xA7, 0xA7, 0x77, 0x19,
+    0xAE, 0x92, 0x9F, 0xC9, 0x49, 0xE9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x39, 0xAF, 0xCA, 0x1F, 0xF0, 0x74,
+    0xAD, 0x94, 0x9F, 0x4F, 0xD2, 0xAD, 0x1D, 0xA0, 0x9D, 0x91, 0x9D, 0x0A, 0xC9, 0x39, 0xA7, 0x75,
+    0x9A, 0xE9, 0x29, 0xFC, 0x94, 0x9E, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93, 0x9A, 0xFC, 0xA1, 0xFF, 0x00,
+    0x1A, 0x93, 0x99, 0x1E, 0x91, 0xEA, 0x0E, 0x91, 0xEA, 0x0A, 0xCA, 0x29, 0xD7, 0x77, 0x73, 0x9A,
+    0xE9, 0x39, 0xFC, 0x95, 0x9E, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96,
+    0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x96, 0x9D, 0x94, 0x9A, 0xFC, 0xA2, 0xFF, 0x00, 0x77,
+    0x2A, 0xC3, 0xD6, 0xE9, 0x9D, 0x97, 0xAF, 0x71, 0x9E, 0xA7, 0x0A, 0xD9, 0xDA, 0x69, 0xCA, 0x19,
+    0xD9, 0x73, 0xAD, 0x74, 0xE5, 0xAF, 0xA0, 0xD9, 0x3F, 0xFE, 0x2E, 0x92, 0x9F, 0x1A, 0xD6, 0xE9,
+    0x0D, 0xA6, 0xAD, 0xA9, 0xD9, 0x7E, 0xAD, 0x70, 0xFD, 0x70, 0xFD, 0x97, 0xEA, 0xD9, 0x7D, 0xAA,
+    0xE6, 0x9D, 0x90, 0xE9, 0x5E, 0x1A, 0xE9, 0x3A, 0xD9, 0x2F, 0xCA, 0xFA, 0x4A, 0xFE, 0x97, 0x99,
+    0x99, 0x50, 0x77, 0x70, 0xEA, 0x19, 0xC7, 0x1A, 0xFC, 0x9D, 0x97, 0x0A, 0xCA, 0x0F, 0xC9, 0x70,
+    0x9C, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x59, 0x97, 0xAE, 0x1A, 0xFC, 0xA3, 0x9F, 0xC9, 0xFF, 0x93,
+    0x9A, 0xFC, 0xA1, 0x9F, 0x59, 0xE5, 0xE5, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D,
+    0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D,
+    0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x92, 0x9A, 0xFC, 0x92, 0xAF, 0xCA,
+    0x0F, 0xE9, 0x19, 0xFE, 0x39, 0x97, 0x5D, 0x74, 0x9E, 0x74, 0xF7, 0x4A, 0xDA, 0x74, 0x9D, 0x76,
+    0xA7, 0x77, 0x59, 0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6,
+    0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0,
+    0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97,
+    0x09, 0x99, 0x96, 0x70, 0x97, 0x6D, 0x97, 0x3E, 0x97, 0x2A, 0xDA, 0x73, 0xE7, 0x3A, 0xCA, 0x75,
+    0x97, 0x77, 0x69, 0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6,
+    0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0,
+    0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97,
+    0x09, 0x99, 0x96, 0x77, 0x5A, 0xD9, 0x72, 0x9F, 0x72, 0xDA, 0xE7, 0x0A, 0xD0, 0x9D, 0xA6, 0x9D,
+    0x29, 0xD6, 0xAC, 0x93, 0xAA, 0x77, 0x72, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F,
+    0x2E, 0x6E, 0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9,
+    0x7E, 0x0A, 0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA,
+    0xAE, 0xA5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x29, 0xEA, 0x1A, 0xC6, 0xFC, 0xA9, 0xD6,
+    0xD9, 0x9F, 0xC6, 0x9C, 0x2E, 0x97, 0x77, 0x77, 0x29, 0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4, 0xE9,
+    0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7, 0x0E,
+    0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD, 0xA3,
+    0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x29, 0xA9, 0x39, 0x96, 0xE2, 0xE9, 0x49,
+    0xE9, 0x1E, 0x95, 0xAC, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x29, 0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4,
+    0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7,
+    0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD,
+    0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x59, 0x71, 0x9D, 0xA7, 0x0A, 0xE7,
+    0x09, 0xD9, 0x77, 0x76, 0xFF, 0xF0, 0xFF, 0xF7, 0x77, 0x7A, 0xA7, 0x1A, 0xE7, 0x0A, 0xDA, 0x71,
+    0xAA, 0x50, 0x79, 0x97, 0x3A, 0xFD, 0xA0, 0x9C, 0x4F, 0xFF, 0x3E, 0x39, 0xF3, 0xE5, 0xAE, 0x92,
+    0xDA, 0x4A, 0xFA, 0x1A, 0xD9, 0x3A, 0xD0, 0xE1, 0xAD, 0x3A, 0xD1, 0xE1, 0xE2, 0xAD, 0x2E, 0x1E,
+    0x1A, 0xD3, 0xE1, 0xAD, 0x9A, 0xD4, 0xE1, 0xAF, 0xC5, 0xDA, 0x2F, 0x5A, 0xD3, 0xF4, 0xAD, 0xA2,
+    0xAF, 0xDA, 0xAE, 0xA3, 0xD0, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x60, 0x5A, 0x77, 0x0D, 0xA7, 0x7E,
+    0x97, 0x6A, 0xE7, 0x79, 0xE7, 0x70, 0xDA, 0x77, 0x0A, 0x77, 0x77, 0x77, 0xAF, 0x4A, 0xEA, 0x2A,
+    0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA,
+    0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA,
+    0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F, 0xD9,
+    0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x72, 0x97, 0x70, 0xDA, 0x76, 0xAD, 0xA7, 0x6E, 0x76, 0xE7,
+    0x69, 0xD7, 0x70, 0xA7, 0x77, 0x77, 0x70, 0xAF, 0x4A, 0xEA, 0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD,
+    0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A,
+    0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F, 0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49,
+    0x30, 0x77, 0x71, 0x9D, 0xA7, 0x6F, 0x97, 0x4A, 0xFC, 0x73, 0x9D, 0x90, 0xE7, 0x2D, 0xA2, 0xD9,
+    0x70, 0x9C, 0xA3, 0x9C, 0x77, 0x77, 0x74, 0xAF, 0x4A, 0xEA, 0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD,
+    0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A,
+    0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F, 0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49,
+    0x30, 0x49, 0x93, 0x99, 0x71, 0xEA, 0x1A, 0xDA, 0x70, 0xEA, 0x1F, 0x70, 0x9D, 0x29, 0xD9, 0x77,
+    0x77, 0x77, 0x76, 0xAF, 0x4A, 0xEA, 0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA,
+    0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA,
+    0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F,
+    0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F, 0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x71, 0x97, 0x79,
+    0xD7, 0x6E, 0x75, 0xAD, 0xA7, 0x49, 0xDA, 0x75, 0xD9, 0x76, 0x99, 0x77, 0x77, 0x74, 0x9F, 0xDA,
+    0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E, 0x96, 0xDA, 0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A,
+    0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A, 0xD3, 0xD9, 0x70, 0xDA, 0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19,
+    0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7, 0x3A, 0xF7, 0x5E, 0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97,
+    0x49, 0xE7, 0x4A, 0xE7, 0x1A, 0xFD, 0x97, 0x1A, 0xFC, 0x97, 0x3A, 0xCA, 0xA7, 0x40, 0x39, 0x97,
+    0x3A, 0xF7, 0x29, 0xFC, 0x75, 0xE7, 0x5A, 0xD7, 0x5A, 0xD7, 0x5A, 0xD7, 0x5A, 0xD3, 0x99, 0x7A,
+    0xD0, 0x9F, 0xD5, 0xAD, 0xAF, 0xF4, 0xAF, 0x91, 0xAF, 0x3A, 0xDA, 0x49, 0xE9, 0x2A, 0xD6, 0xAD,
+    0xA2, 0xAD, 0x69, 0xDA, 0x2A, 0xD6, 0x9E, 0x2A, 0xD7, 0xE2, 0xAD, 0x69, 0xDA, 0x2A, 0xD6, 0x9D,
+    0x92, 0xAD, 0x6A, 0xD3, 0xAD, 0x59, 0xDA, 0x3A, 0xD9, 0x39, 0xE4, 0xAF, 0xFD, 0x5A, 0xFF, 0xA6,
+    0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xEA, 0x97, 0x1F, 0xF7, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x39, 0xA3, 0x9A, 0x97, 0x9E, 0x2E, 0x7A, 0xE1, 0x9E, 0x70, 0xD9, 0x2A, 0xCA, 0x77, 0x77,
+    0x77, 0x72, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E, 0x96, 0xDA, 0x39, 0xDA, 0x5A,
+    0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A, 0xD3, 0xD9, 0x70, 0xDA, 0x1A, 0xD7,
+    0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7, 0x3A, 0xF7, 0x5E, 0xA7, 0x5A, 0xD7,
+    0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x4A, 0xE7, 0x1A, 0xFD, 0x97, 0x1A, 0xFC, 0x97, 0x3A, 0xCA,
+    0xA7, 0x40, 0x5A, 0xFF, 0x74, 0xFF, 0xC7, 0x4A, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x75,
+    0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0,
+    0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD,
+    0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA,
+    0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFC, 0x5A, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x79, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E,
+    0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93,
+    0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39,
+    0x99, 0x49, 0x20, 0x77, 0x73, 0xCA, 0x5C, 0x73, 0x9D, 0xA2, 0x9D, 0x74, 0xFF, 0x97, 0x5A, 0xFC,
+    0x97, 0x70, 0x99, 0x97, 0x77, 0x77, 0x29, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77,
+    0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA,
+    0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF,
+    0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E,
+    0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF0, 0x77, 0x0D, 0x49,
+    0xC5, 0xDA, 0x29, 0xD5, 0xAF, 0xE9, 0x6A, 0xFC, 0x97, 0x19, 0x99, 0x77, 0x73, 0x99, 0x71, 0x9F,
+    0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19, 0x9E,
+    0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29, 0xE3,
+    0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99, 0x94, 0x92, 0x72, 0x97, 0x72, 0x9D, 0xA7, 0x71,
+    0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7,
+    0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99,
+    0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD,
+    0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94,
+    0xFF, 0x77, 0x9D, 0x97, 0x70, 0xAD, 0x77, 0x2D, 0xA7, 0x72, 0xE7, 0x72, 0xFD, 0x77, 0x0A, 0xEA,
+    0x77, 0x70, 0x59, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C,
+    0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94,
+    0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x3A, 0xCA,
+    0x72, 0xAC, 0xA7, 0x3D, 0x97, 0x3E, 0x73, 0xFC, 0xA7, 0x1A, 0xE9, 0x76, 0x73, 0x97, 0x6A, 0xD7,
+    0x39, 0xF7, 0x2A, 0xF9, 0x71, 0xAE, 0x97, 0x39, 0x97, 0x77, 0x70, 0x99, 0x99, 0x97, 0x1A, 0xFF,
+    0x94, 0xAF, 0xFD, 0x93, 0xAE, 0x93, 0x9D, 0x92, 0x9D, 0xA6, 0xD9, 0x2E, 0x7D, 0x91, 0xAD, 0x97,
+    0xAC, 0x2E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xE7,
+    0x49, 0xE7, 0x5E, 0x97, 0x4F, 0x74, 0x9F, 0x97, 0x3A, 0xFC, 0xA9, 0x99, 0x9A, 0xAC, 0x92, 0x9F,
+    0xFF, 0x5A, 0xFF, 0xA7, 0x19, 0x99, 0x94, 0x70, 0x97, 0x2A, 0xD7, 0x09, 0xE7, 0x0E, 0x97, 0xAD,
+    0x97, 0x0D, 0x97, 0x1A, 0x77, 0x71, 0x99, 0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xE3, 0xE9, 0x0A, 0xD4,
+    0x9D, 0x90, 0xDA, 0x5C, 0xA0, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0xAE,
+    0x70, 0x9E, 0xA7, 0x0F, 0xA9, 0x39, 0x91, 0xFF, 0xDA, 0x2A, 0xFE, 0xA6, 0x99, 0x99, 0x20, 0x70,
+    0x99, 0x75, 0xAD, 0xA7, 0x3A, 0xFC, 0x71, 0x9D, 0x99, 0xE7, 0x9D, 0x91, 0x9D, 0x96, 0xAC, 0x94,
+    0xC9, 0x77, 0x72, 0x99, 0x99, 0x97, 0x1A, 0xFF, 0x94, 0xAF, 0xFD, 0x93, 0xAE, 0x93, 0x9D, 0x92,
+    0x9D, 0xA6, 0xD9, 0x2E, 0x7D, 0x91, 0xAD, 0x97, 0xAC, 0x2E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD,
+    0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x97, 0x4F, 0x74, 0x9F, 0x97,
+    0x3A, 0xFC, 0xA9, 0x99, 0x9A, 0xAC, 0x92, 0x9F, 0xFF, 0x5A, 0xFF, 0xA7, 0x19, 0x99, 0x94, 0x77,
+    0x2E, 0x70, 0xFA, 0x69, 0xDA, 0xD9, 0x5D, 0x90, 0xAD, 0x4D, 0xA2, 0xDA, 0x3C, 0xA4, 0xC9, 0x77,
+    0x49, 0x97, 0xAF, 0xCA, 0x4F, 0xFC, 0x2E, 0x3E, 0x90, 0xAD, 0x49, 0xD9, 0x0D, 0xA5, 0xCA, 0x09,
+    0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x0A, 0xE7, 0x09, 0xEA, 0x70, 0xFA, 0x93,
+    0x99, 0x1F, 0xFD, 0xA2, 0xAF, 0xEA, 0x69, 0x99, 0x92, 0x77, 0x70, 0xAD, 0x97, 0x4E, 0xA7, 0x4E,
+    0xA7, 0x4A, 0xD7, 0x77, 0x77, 0x79, 0x99, 0x99, 0x71, 0xAF, 0xF9, 0x4A, 0xFF, 0xD9, 0x3A, 0xE9,
+    0x39, 0xD9, 0x29, 0xDA, 0x6D, 0x92, 0xE7, 0xD9, 0x1A, 0xD9, 0x7A, 0xC2, 0xE7, 0x5E, 0x74, 0x9D,
+    0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xDA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE9, 0x74, 0xF7,
+    0x49, 0xF9, 0x73, 0xAF, 0xCA, 0x99, 0x99, 0xAA, 0xC9, 0x29, 0xFF, 0xF5, 0xAF, 0xFA, 0x71, 0x99,
+    0x99, 0x40, 0x5A, 0xC9, 0x70, 0xAE, 0x70, 0xAE, 0x71, 0xD9, 0x77, 0x77, 0x49, 0x97, 0xAF, 0xCA,
+    0x4F, 0xFC, 0x2E, 0x3E, 0x90, 0xAD, 0x49, 0xD9, 0x0D, 0xA5, 0xCA, 0x09, 0xD9, 0x70, 0xAD, 0x71,
+    0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x0A, 0xE7, 0x09, 0xEA, 0x70, 0xFA, 0x93, 0x99, 0x1F, 0xFD, 0xA2,
+    0xAF, 0xEA, 0x69, 0x99, 0x92, 0x4A, 0x6A, 0x95, 0x9D, 0x92, 0x9D, 0xA6, 0xE9, 0x09, 0xDA, 0x70,
+    0xEA, 0xDA, 0x72, 0xFA, 0x74, 0xAC, 0xA7, 0x77, 0x69, 0x99, 0x99, 0x71, 0xAF, 0xF9, 0x4A, 0xFF,
+    0xD9, 0x3A, 0xE9, 0x39, 0xD9, 0x29, 0xDA, 0x6D, 0x92, 0xE7, 0xD9, 0x1A, 0xD9, 0x7A, 0xC2, 0xE7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xDA, 0x74, 0xAE, 0x74, 0x9E, 0x75,
+    0xE9, 0x74, 0xF7, 0x49, 0xF9, 0x73, 0xAF, 0xCA, 0x99, 0x99, 0xAA, 0xC9, 0x29, 0xFF, 0xF5, 0xAF,
+    0xFA, 0x71, 0x99, 0x99, 0x40, 0x29, 0x59, 0x3A, 0xCA, 0x3D, 0xA3, 0xD9, 0x1A, 0xD4, 0xAD, 0x99,
+    0xD6, 0xAF, 0x97, 0xEA, 0x71, 0xAA, 0x77, 0x70, 0x99, 0x7A, 0xFC, 0xA4, 0xFF, 0xC2, 0xE3, 0xE9,
+    0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x5C, 0xA0, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x1A, 0xD9,
+    0x70, 0xAE, 0x70, 0x9E, 0xA7, 0x0F, 0xA9, 0x39, 0x91, 0xFF, 0xDA, 0x2A, 0xFE, 0xA6, 0x99, 0x99,
+    0x20, 0x3A, 0x6A, 0x97, 0x09, 0xD3, 0x9D, 0xA7, 0x1E, 0x90, 0x9D, 0xA7, 0x3E, 0xAD, 0xA7, 0x5F,
+    0xA7, 0x7A, 0xCA, 0x77, 0x77, 0x29, 0x99, 0x99, 0x97, 0x0A, 0xFF, 0xFA, 0x59, 0xFC, 0xAA, 0xFE,
+    0xA6, 0xE4, 0x9F, 0xC5, 0xE6, 0x9E, 0xA4, 0xE7, 0x9E, 0x4E, 0x70, 0xEA, 0x3E, 0x70, 0x9E, 0x3E,
+    0x71, 0xE3, 0xE7, 0x1E, 0x92, 0xE7, 0x1E, 0x92, 0xE7, 0x1E, 0x92, 0xE7, 0x1E, 0x3E, 0x71, 0xE3,
+    0xE7, 0x09, 0xDA, 0x3E, 0x70, 0xE9, 0x3E, 0x7A, 0xDA, 0x4E, 0x6A, 0xE5, 0xE3, 0x9A, 0xF4, 0xAF,
+    0xFF, 0xA4, 0xFF, 0xEA, 0x97, 0x77, 0x20, 0x73, 0x99, 0x29, 0x71, 0x9F, 0xC2, 0xD7, 0x0A, 0xFC,
+    0x19, 0xD7, 0x3E, 0x19, 0xD7, 0x3E, 0x1A, 0xCA, 0x73, 0xE1, 0xAC, 0x74, 0xE1, 0xAC, 0x70, 0x99,
+    0x1E, 0x71, 0xAF, 0xFC, 0x79, 0xFF, 0xE7, 0xE9, 0x39, 0xE6, 0xAD, 0x95, 0xE6, 0xDA, 0x6E, 0x59,
+    0xD9, 0x6E, 0x5A, 0xD9, 0x6E, 0x5E, 0x7E, 0x5E, 0x96, 0xE5, 0xAD, 0x96, 0xE5, 0xAD, 0xA6, 0xE5,
+    0x9E, 0x59, 0xE6, 0xF9, 0x2A, 0xF7, 0xFF, 0xFD, 0xA5, 0xFD, 0xA0, 0x9F, 0xA7, 0x99, 0x93, 0x96,
+    0x59, 0x99, 0x99, 0x97, 0x1A, 0xFF, 0xFA, 0x69, 0xFC, 0xAA, 0xFE, 0xA7, 0xE4, 0x9F, 0xC6, 0xE6,
+    0x9E, 0xA5, 0xE7, 0x9E, 0x5E, 0x70, 0xEA, 0x4E, 0x70, 0x9E, 0x4E, 0x71, 0xE4, 0xE7, 0x1E, 0x90,
+    0xFF, 0xDA, 0x4E, 0x90, 0xFF, 0xDA, 0x4E, 0x93, 0xE7, 0x1E, 0x4E, 0x71, 0xE4, 0xE7, 0x09, 0xDA,
+    0x4E, 0x70, 0xE9, 0x4E, 0x7A, 0xDA, 0x5E, 0x6A, 0xE6, 0xE3, 0x9A, 0xF5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xEA, 0x97, 0x77, 0x30, 0x73, 0x99, 0x72, 0x9F, 0xC7, 0x2A, 0xFC, 0x75, 0xE7, 0x49, 0xE7, 0x1F,
+    0xFC, 0x96, 0x9A, 0xAA, 0xEA, 0xA7, 0x3E, 0x79, 0xAA, 0xAA, 0x9E, 0x59, 0xFF, 0xD4, 0xAE, 0xA9,
+    0xAA, 0xF3, 0x9D, 0xA5, 0xE3, 0xE6, 0xE2, 0x9D, 0xA6, 0xE2, 0xAD, 0x96, 0xE2, 0xAD, 0x7E, 0x2E,
+    0x7E, 0x2A, 0xD9, 0x6E, 0x2A, 0xDA, 0x6E, 0x29, 0xE5, 0x9E, 0x3F, 0x92, 0xAF, 0x39, 0xFF, 0xFD,
+    0xA2, 0xFD, 0xA0, 0x9F, 0xA4, 0x99, 0x93, 0x93, 0x3F, 0xFA, 0x69, 0xFF, 0xA6, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x77, 0x77, 0x77, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9, 0x3E, 0x6A,
+    0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF, 0xE5, 0xFF,
+    0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49, 0x9A, 0xD1,
+    0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x2A, 0xFF, 0xA2, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xA7, 0x77, 0x71, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4,
+    0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97,
+    0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x77, 0x39,
+    0xC9, 0x49, 0xA6, 0xAD, 0x92, 0x9C, 0xA7, 0xFF, 0x71, 0xFD, 0x74, 0x99, 0x77, 0x77, 0x71, 0xAF,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9, 0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF, 0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49, 0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0,
+    0x76, 0x9C, 0x94, 0xA9, 0x2A, 0xD9, 0x2A, 0xC9, 0x3F, 0xF5, 0xFC, 0xA7, 0x09, 0x97, 0x77, 0x99,
+    0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95,
+    0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91,
+    0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x77, 0x69, 0xDA, 0x74, 0xF7, 0x4F, 0x74, 0x9D,
+    0x97, 0x77, 0x77, 0x77, 0x1A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC,
+    0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD,
+    0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x5D, 0x97, 0x0F, 0x70, 0xF7, 0x09, 0xD9, 0x77, 0x77, 0x39,
+    0x97, 0x9F, 0xDA, 0x39, 0xFF, 0xA1, 0x9D, 0xA3, 0xE9, 0x0E, 0x49, 0xDA, 0x9D, 0x95, 0xEA, 0xD9,
+    0x5E, 0xAF, 0xFF, 0xFF, 0xFA, 0xE7, 0x1A, 0xD7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xFA, 0x39, 0xA9,
+    0x1F, 0xFD, 0x92, 0xAF, 0xEA, 0x59, 0x99, 0x93, 0x77, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9,
+    0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99,
+    0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7,
+    0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x72, 0x9D, 0x97, 0x39, 0xD7, 0x5D,
+    0xA7, 0x5E, 0x75, 0xFD, 0x73, 0xAE, 0xA7, 0x72, 0x59, 0x97, 0x9F, 0xDA, 0x39, 0xFF, 0xA1, 0x9D,
+    0xA3, 0xE9, 0x0E, 0x49, 0xDA, 0x9D, 0x95, 0xEA, 0xD9, 0x5E, 0xAF, 0xFF, 0xFF, 0xFA, 0xE7, 0x1A,
+    0xD7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xFA, 0x39, 0xA9, 0x1F, 0xFD, 0x92, 0xAF, 0xEA, 0x59, 0x9A,
+    0xD9, 0x70, 0xD9, 0x70, 0x9D, 0x71, 0x9D, 0x97, 0x1F, 0xC9, 0x69, 0xF7, 0x50, 0x29, 0x95, 0xAA,
+    0x6D, 0xA3, 0xE6, 0x9D, 0xA1, 0xE7, 0x09, 0xFD, 0x72, 0x9F, 0x74, 0x9D, 0x97, 0x77, 0x77, 0x0A,
+    0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA,
+    0x00, 0x29, 0x59, 0x3A, 0xC9, 0x3D, 0x92, 0x9D, 0x91, 0xDA, 0x4A, 0xD0, 0xAD, 0x6F, 0xC9, 0x7E,
+    0xA7, 0x1A, 0xA7, 0x77, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D,
+    0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09,
+    0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x71, 0x99, 0x77,
+    0xE9, 0x75, 0xFC, 0xA7, 0x3A, 0xD0, 0xAD, 0xA7, 0x1A, 0xD2, 0xAD, 0x71, 0xD4, 0x9C, 0x77, 0x77,
+    0x99, 0x99, 0x97, 0x29, 0xFF, 0xCA, 0x59, 0xFF, 0xF4, 0x9E, 0xA5, 0xAD, 0x39, 0xE7, 0x9D, 0x3E,
+    0x71, 0xD2, 0xAD, 0x97, 0x1C, 0xA2, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xDA, 0x76, 0xAD, 0xA6,
+    0x99, 0x99, 0x99, 0x99, 0xAD, 0xA5, 0x9F, 0xEA, 0xAE, 0x69, 0xAA, 0xF0, 0x9E, 0x71, 0x9D, 0xA1,
+    0xE9, 0x70, 0x9D, 0xA1, 0xF7, 0x09, 0xDA, 0x19, 0xF7, 0x9D, 0xA2, 0x9F, 0xA9, 0x39, 0xAD, 0xA3,
+    0x9F, 0xFF, 0xCA, 0x5A, 0xFF, 0xDA, 0x71, 0x99, 0x99, 0x95, 0x77, 0x69, 0xE7, 0x4F, 0xA7, 0x2A,
+    0xDA, 0xD9, 0x71, 0xD9, 0x0A, 0xD7, 0x0D, 0xA2, 0xDA, 0x7C, 0xA4, 0xC9, 0x77, 0x73, 0x99, 0x73,
+    0x9F, 0xFE, 0x92, 0xAF, 0xFF, 0x91, 0x9D, 0xA3, 0xAD, 0x90, 0x92, 0xAD, 0x5E, 0x4E, 0x5A, 0xD4,
+    0xE5, 0xE4, 0xAD, 0x94, 0xE5, 0xE9, 0x19, 0xE9, 0x59, 0xFF, 0x96, 0xDA, 0xFA, 0x7A, 0xD7, 0x5E,
+    0x75, 0xEA, 0x99, 0x99, 0x99, 0x6A, 0xFF, 0xEA, 0x4F, 0xFF, 0xA2, 0xDA, 0x69, 0xE1, 0xE7, 0x0E,
+    0x1D, 0xA7, 0x0D, 0xA1, 0xE7, 0xE2, 0xFA, 0x99, 0x9A, 0xF4, 0xFF, 0xDA, 0x69, 0xAA, 0xDA, 0xA9,
+    0x50, 0x77, 0x70, 0xCA, 0x5C, 0x71, 0xDA, 0x3D, 0x71, 0xFF, 0xA7, 0x2A, 0xFC, 0x97, 0x59, 0x99,
+    0x77, 0x77, 0x29, 0x99, 0x99, 0x72, 0x9F, 0xFC, 0xA5, 0x9F, 0xFF, 0x49, 0xEA, 0x5A, 0xD3, 0x9E,
+    0x79, 0xD3, 0xE7, 0x1D, 0x2A, 0xD9, 0x71, 0xCA, 0x2E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0xA7,
+    0x6A, 0xDA, 0x69, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x59, 0xFE, 0xAA, 0xE6, 0x9A, 0xAF, 0x09, 0xE7,
+    0x19, 0xDA, 0x1E, 0x97, 0x09, 0xDA, 0x1F, 0x70, 0x9D, 0xA1, 0x9F, 0x79, 0xDA, 0x29, 0xFA, 0x93,
+    0x9A, 0xDA, 0x39, 0xFF, 0xFC, 0xA5, 0xAF, 0xFD, 0xA7, 0x19, 0x99, 0x99, 0x50, 0x77, 0x4C, 0x94,
+    0xAA, 0x69, 0xD9, 0x2A, 0xCA, 0x7F, 0xF7, 0x1F, 0xCA, 0x74, 0x99, 0x77, 0x77, 0x99, 0x73, 0x9F,
+    0xFE, 0x92, 0xAF, 0xFF, 0x91, 0x9D, 0xA3, 0xAD, 0x90, 0x92, 0xAD, 0x5E, 0x4E, 0x5A, 0xD4, 0xE5,
+    0xE4, 0xAD, 0x94, 0xE5, 0xE9, 0x19, 0xE9, 0x59, 0xFF, 0x96, 0xDA, 0xFA, 0x7A, 0xD7, 0x5E, 0x75,
+    0xEA, 0x99, 0x99, 0x99, 0x6A, 0xFF, 0xEA, 0x4F, 0xFF, 0xA2, 0xDA, 0x69, 0xE1, 0xE7, 0x0E, 0x1D,
+    0xA7, 0x0D, 0xA1, 0xE7, 0xE2, 0xFA, 0x99, 0x9A, 0xF4, 0xFF, 0xDA, 0x69, 0xAA, 0xDA, 0xA9, 0x50,
+    0x77, 0x73, 0xE7, 0x69, 0xE9, 0x75, 0x9E, 0x97, 0x6A, 0xCA, 0x77, 0x77, 0x77, 0x59, 0x99, 0x99,
+    0x72, 0x9F, 0xFC, 0xA5, 0x9F, 0xFF, 0x49, 0xEA, 0x5A, 0xD3, 0x9E, 0x79, 0xD3, 0xE7, 0x1D, 0x2A,
+    0xD9, 0x71, 0xCA, 0x2E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0xA7, 0x6A, 0xDA, 0x69, 0x99, 0x99,
+    0x99, 0x9A, 0xDA, 0x59, 0xFE, 0xAA, 0xE6, 0x9A, 0xAF, 0x09, 0xE7, 0x19, 0xDA, 0x1E, 0x97, 0x09,
+    0xDA, 0x1F, 0x70, 0x9D, 0xA1, 0x9F, 0x79, 0xDA, 0x29, 0xFA, 0x93, 0x9A, 0xDA, 0x39, 0xFF, 0xFC,
+    0xA5, 0xAF, 0xFD, 0xA7, 0x19, 0x99, 0x99, 0x50, 0x6D, 0x97, 0x4A, 0xE7, 0x4F, 0x74, 0x9D, 0x97,
+    0x77, 0x77, 0x79, 0x97, 0x39, 0xFF, 0xE9, 0x2A, 0xFF, 0xF9, 0x19, 0xDA, 0x3A, 0xD9, 0x09, 0x2A,
+    0xD5, 0xE4, 0xE5, 0xAD, 0x4E, 0x5E, 0x4A, 0xD9, 0x4E, 0x5E, 0x91, 0x9E, 0x95, 0x9F, 0xF9, 0x6D,
+    0xAF, 0xA7, 0xAD, 0x75, 0xE7, 0x5E, 0xA9, 0x99, 0x99, 0x96, 0xAF, 0xFE, 0xA4, 0xFF, 0xFA, 0x2D,
+    0xA6, 0x9E, 0x1E, 0x70, 0xE1, 0xDA, 0x70, 0xDA, 0x1E, 0x7E, 0x2F, 0xA9, 0x99, 0xAF, 0x4F, 0xFD,
+    0xA6, 0x9A, 0xAD, 0xAA, 0x95, 0x70, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xCA, 0x59, 0xFF, 0xF4, 0x9E,
+    0xA5, 0xAD, 0x39, 0xE7, 0x9D, 0x3E, 0x71, 0xD2, 0xAD, 0x97, 0x1C, 0xA2, 0xE7, 0x7E, 0x76, 0x9D,
+    0xA7, 0x6A, 0xDA, 0x76, 0xAD, 0xA6, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA5, 0x9F, 0xEA, 0xAE, 0x69,
+    0xAA, 0xF0, 0x9E, 0x71, 0x9D, 0xA1, 0xE9, 0x70, 0x9D, 0xA1, 0xF7, 0x09, 0xDA, 0x19, 0xF7, 0x9D,
+    0xA2, 0x9F, 0xA9, 0x39, 0xAD, 0xA3, 0x9F, 0xFF, 0xCA, 0x5A, 0xFF, 0xDA, 0x71, 0x99, 0x99, 0x97,
+    0x79, 0x97, 0x7A, 0xDA, 0x77, 0xE7, 0x7E, 0x77, 0xD9, 0x76, 0xAC, 0xA7, 0x79, 0x97, 0x70, 0x97,
+    0x59, 0xD7, 0x5D, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5E, 0x97, 0x4A, 0xDA, 0x77, 0x76,
+    0x99, 0x73, 0x9F, 0xFE, 0x92, 0xAF, 0xFF, 0x91, 0x9D, 0xA3, 0xAD, 0x90, 0x92, 0xAD, 0x5E, 0x4E,
+    0x5A, 0xD4, 0xE5, 0xE4, 0xAD, 0x94, 0xE5, 0xE9, 0x19, 0xE9, 0x59, 0xFF, 0x96, 0xDA, 0xFA, 0x7A,
+    0xD7, 0x5E, 0x75, 0xEA, 0x99, 0x99, 0x99, 0x6A, 0xFF, 0xEA, 0x4F, 0xFF, 0xA2, 0xDA, 0x69, 0xE1,
+    0xE7, 0x0E, 0x1D, 0xA7, 0x0D, 0xA1, 0xE7, 0xE2, 0xFA, 0x99, 0x9A, 0xF4, 0xFF, 0xDA, 0x69, 0xAA,
+    0xDA, 0xA9, 0x50, 0x72, 0x97, 0x73, 0x9E, 0x77, 0x2F, 0xC7, 0x70, 0xDA, 0x0E, 0x76, 0xE2, 0xE7,
+    0x49, 0xCA, 0x4A, 0xA7, 0x77, 0x77, 0x74, 0xAF, 0xE9, 0x39, 0xFF, 0x09, 0xFD, 0x95, 0xFD, 0xA9,
+    0x3E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71,
+    0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x5F, 0xFF, 0xF9, 0x5F,
+    0xFF, 0xF9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9,
+    0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x93, 0xAF, 0xD9, 0x49, 0xFD, 0xA0,
+    0xFF, 0x93, 0x9F, 0xF0, 0x49, 0x97, 0x70, 0xEA, 0x76, 0xFC, 0x97, 0x4A, 0xD0, 0xAD, 0x97, 0x29,
+    0xD2, 0xAD, 0x72, 0xAA, 0x4A, 0x97, 0x77, 0x72, 0x99, 0x76, 0xAF, 0x75, 0x9F, 0xC7, 0x70, 0xE7,
+    0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE3, 0x99, 0x72, 0xE0, 0x9F, 0xD9, 0x7E, 0xAF, 0xF7,
+    0xFC, 0x91, 0x9E, 0xA6, 0xEA, 0x49, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE4, 0x9F, 0xD3, 0xAF, 0xC9, 0x1F, 0xE2, 0xAF,
+    0xD9, 0x77, 0x70, 0xAF, 0xE9, 0x39, 0xFF, 0x19, 0xFD, 0x95, 0xFD, 0xA9, 0x4E, 0x71, 0xAD, 0x96,
+    0xE7, 0x1A, 0xD9, 0x3F, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFF, 0xD9, 0x3E, 0x71, 0xAD, 0x96, 0xE7,
+    0x1A, 0xD9, 0x6E, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x6F, 0xFF, 0xF9, 0x6F, 0xFF, 0xF9, 0x6E,
+    0x71, 0xAD, 0x96, 0xE7, 0x1A, 0xD9, 0x6E, 0x71, 0xAD, 0x96, 0xE7, 0x1A, 0xD9, 0x6E, 0x71, 0xAD,
+    0x96, 0xE7, 0x1A, 0xD9, 0x6E, 0x71, 0xAD, 0x94, 0xAF, 0xD9, 0x49, 0xFD, 0xA1, 0xFF, 0x93, 0x9F,
+    0xF0, 0x39, 0x97, 0x5A, 0xF7, 0x49, 0xFC, 0x77, 0xE7, 0x7E, 0x97, 0x39, 0xFF, 0xC7, 0x1A, 0xAE,
+    0xAA, 0xA9, 0x73, 0xE7, 0x7E, 0x2A, 0xAA, 0xA9, 0x7E, 0x0A, 0xFD, 0xA6, 0xFF, 0xF9, 0x5F, 0xA3,
+    0xAE, 0x5E, 0x95, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5, 0xE6, 0xE5,
+    0xE6, 0xE5, 0xE6, 0xE3, 0x9F, 0xD3, 0xAF, 0xC9, 0x0F, 0xE2, 0xAF, 0xD9, 0x73, 0x9E, 0x91, 0xCA,
+    0x1F, 0xCA, 0x9D, 0x1D, 0x9A, 0xFC, 0x1A, 0xA1, 0x9E, 0x77, 0x77, 0x3F, 0xFA, 0x19, 0xFD, 0xA5,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE5,
+    0xAF, 0xD9, 0x1F, 0xFA, 0x00, 0x72, 0xEA, 0x1A, 0xC0, 0xAF, 0xA9, 0xD9, 0xD9, 0x0F, 0xC0, 0x9C,
+    0x2E, 0x97, 0x77, 0x79, 0xAE, 0x92, 0x9F, 0xC9, 0x49, 0xE9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x39, 0xAF,
+    0xCA, 0x1F, 0xF0, 0x0A, 0xFF, 0x1F, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x2F, 0xFA,
+    0x19, 0xFD, 0xA5, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE5, 0xAF, 0xD9, 0x1F, 0xFA, 0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xC0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x79, 0xAE, 0x92, 0x9F, 0xC9, 0x49, 0xE9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x39, 0xAF, 0xCA, 0x1F, 0xF0, 0x73, 0xCA, 0x5C, 0x1D, 0xA3, 0xD1, 0xFF, 0xA2, 0xAF, 0xC9, 0x59,
+    0x99, 0x77, 0x72, 0xFF, 0xA1, 0x9F, 0xDA, 0x5E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x5A, 0xFD, 0x91, 0xFF, 0xA0, 0x71, 0xAC, 0x5C, 0x0E,
+    0x3D, 0x09, 0xFE, 0xA1, 0x9F, 0xCA, 0x59, 0x97, 0x77, 0x09, 0xAE, 0x92, 0x9F, 0xC9, 0x49, 0xE9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x39, 0xAF, 0xCA, 0x1F, 0xF0, 0x70, 0xFF, 0xA9, 0xFD, 0xA3, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE3, 0xAF, 0xD9,
+    0xFF, 0xA2, 0xAC, 0xA4, 0xDA, 0x49, 0xD5, 0x9D, 0xA5, 0xFC, 0xA2, 0x9F, 0x97, 0x10, 0x74, 0xE9,
+    0x49, 0xEA, 0x5E, 0xA5, 0x9A, 0xA7, 0x77, 0x72, 0x9A, 0xE9, 0x29, 0xFC, 0x94, 0x9E, 0x95, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x93, 0x9A, 0xFC, 0xA1, 0xFF, 0x49, 0xD9, 0x49, 0xD6, 0xDA, 0x6E, 0x6A, 0xFC, 0x4A,
+    0xEA, 0x72, 0x73, 0xE4, 0x9E, 0x93, 0x9E, 0x94, 0xAC, 0xA7, 0x77, 0x5F, 0xFA, 0x9F, 0xDA, 0x3E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x3A,
+    0xFD, 0x9F, 0xFA, 0x72, 0x9A, 0xE9, 0x29, 0xFC, 0x94, 0x9E, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93, 0x9A,
+    0xFC, 0xA1, 0xFF, 0x00, 0x77, 0x3F, 0xFA, 0x0A, 0xFF, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x93, 0xE6,
+    0xE9, 0x5E, 0x6E, 0x95, 0xE6, 0xE9, 0x5E, 0x6E, 0x95, 0xE6, 0xE9, 0x5E, 0x6E, 0x95, 0xE6, 0xE9,
+    0x5E, 0x6E, 0x95, 0xE6, 0xE9, 0x5E, 0x6E, 0x95, 0xE6, 0xE9, 0x5E, 0x6E, 0x95, 0xE6, 0xE9, 0x5E,
+    0x6E, 0x95, 0xE6, 0xE9, 0x5E, 0x6E, 0x93, 0xAF, 0xD9, 0x3E, 0x3F, 0xFA, 0x3E, 0x77, 0x0E, 0x77,
+    0xAD, 0xA7, 0x7E, 0x76, 0x9E, 0x97, 0x49, 0xFA, 0x76, 0xDA, 0x70, 0x77, 0x2E, 0x94, 0xE9, 0x19,
+    0xEA, 0x39, 0xEA, 0x2E, 0xA3, 0x9E, 0x92, 0x9A, 0xA5, 0xAA, 0xA7, 0x77, 0x77, 0x71, 0x9A, 0xE9,
+    0x29, 0xAE, 0x09, 0xFC, 0x91, 0x9F, 0xC2, 0x9E, 0x93, 0x9E, 0x39, 0xD9, 0x4A, 0xD3, 0x9D, 0x94,
+    0xAD, 0x39, 0xD9, 0x4A, 0xD3, 0x9D, 0x94, 0xAD, 0x39, 0xD9, 0x4A, 0xD3, 0x9D, 0x94, 0xAD, 0x39,
+    0xD9, 0x4A, 0xD3, 0x9D, 0x94, 0xAD, 0x39, 0xD9, 0x4A, 0xD3, 0x9D, 0x94, 0xAD, 0x19, 0xAF, 0xCA,
+    0x2A, 0xD1, 0xFF, 0x2A, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x3E, 0x97, 0x19, 0xEA, 0x71, 0xFA,
+    0x72, 0xAC, 0xA4, 0x69, 0x72, 0xE9, 0x7F, 0xC9, 0x5E, 0x0A, 0xD9, 0x3A, 0xD2, 0xAD, 0x3D, 0x49,
+    0xC7, 0x77, 0x5F, 0xFC, 0x3A, 0xFD, 0xA7, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x09, 0xDA, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0xAD, 0xA7, 0xAE, 0x6A, 0xF7, 0x9D, 0xA7, 0x77, 0xE6,
+    0xAE, 0xA4, 0x9D, 0xAD, 0x93, 0xDA, 0x0A, 0xD2, 0xAD, 0x2D, 0xA1, 0xCA, 0x4C, 0x97, 0x77, 0x0A,
+    0xF4, 0xFD, 0x59, 0x9E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7D, 0xA6, 0xAD, 0x95, 0x9E, 0x5A, 0xE9, 0x39, 0xF9, 0x5A, 0xA9, 0x60, 0x77, 0x4A, 0xFE,
+    0xA1, 0x9F, 0xE9, 0x09, 0xFD, 0xA3, 0x9F, 0xC9, 0x4E, 0x6E, 0xA6, 0xE5, 0xE9, 0x7E, 0x4E, 0x97,
+    0x0E, 0x3E, 0x72, 0xE1, 0x9E, 0x73, 0xE0, 0x9E, 0x74, 0xE9, 0xDA, 0x75, 0xFD, 0x76, 0xFE, 0x75,
+    0xE0, 0xEA, 0x74, 0xE1, 0xEA, 0x73, 0xE1, 0x9E, 0xA7, 0x2E, 0x29, 0xEA, 0x71, 0xE3, 0x9F, 0x70,
+    0xE4, 0x9F, 0x7E, 0x59, 0xF9, 0x3A, 0xFD, 0x93, 0x9F, 0xA1, 0xFF, 0x95, 0xFA, 0x77, 0x09, 0x99,
+    0x72, 0x99, 0x77, 0x2E, 0x77, 0x1A, 0xD9, 0x77, 0x0A, 0xD9, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x77,
+    0x19, 0x97, 0x20, 0x39, 0x97, 0x4A, 0xF7, 0x39, 0xFC, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76,
+    0xE7, 0x6E, 0x2A, 0xFD, 0xA3, 0xE2, 0x9F, 0xD9, 0x3E, 0x39, 0xE9, 0x5E, 0x29, 0xDA, 0x7E, 0x1A,
+    0xDA, 0x70, 0xE0, 0xAD, 0x97, 0x1F, 0xD9, 0x72, 0xE9, 0xE7, 0x2E, 0x0A, 0xE7, 0x1E, 0x1A, 0xDA,
+    0x70, 0xE2, 0xEA, 0x7E, 0x3F, 0x6E, 0x4F, 0x39, 0xFC, 0xA2, 0x9F, 0x91, 0xFE, 0x4F, 0x76, 0x99,
+    0x72, 0x99, 0x76, 0xE9, 0x75, 0x9D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6D, 0x97, 0x69, 0x70, 0x77,
+    0x29, 0xAE, 0x91, 0x9F, 0xE0, 0x9F, 0xC9, 0x19, 0xFD, 0xA2, 0x9E, 0x93, 0xE9, 0x59, 0xD9, 0x2E,
+    0x96, 0x9D, 0x91, 0xE7, 0x09, 0xD9, 0x0E, 0x71, 0x9D, 0xAE, 0x72, 0x9F, 0xD7, 0x29, 0xD9, 0xAE,
+    0x71, 0x9D, 0x90, 0xF7, 0x09, 0xD9, 0x1F, 0x79, 0xD9, 0x2F, 0x69, 0xD9, 0x3F, 0x4A, 0xFA, 0x3F,
+    0xA1, 0xFE, 0x93, 0xF9, 0x75, 0x99, 0x90, 0x69, 0x76, 0xD9, 0x73, 0xAE, 0xA7, 0x2F, 0xC7, 0x2E,
+    0xA9, 0x73, 0xA9, 0x77, 0x77, 0x76, 0xAF, 0xF7, 0x9F, 0xDA, 0x73, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0xAC, 0x3E,
+    0x7D, 0x3E, 0x69, 0xD3, 0xE4, 0x99, 0xE1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFF, 0xE9, 0x00, 0x76, 0xAC,
+    0x4A, 0xE2, 0xAF, 0xC1, 0xFA, 0x92, 0x99, 0x77, 0x29, 0x93, 0xAF, 0x29, 0xFC, 0x5E, 0x5A, 0xD5,
+    0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD3, 0x9F, 0xDA, 0x9F, 0xF0, 0x77, 0x0A, 0xFF, 0x79,
+    0xFD, 0xA7, 0x3E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x7A, 0xC3, 0xE7, 0xD3, 0xE6, 0x9D, 0x3E, 0x49, 0x9E, 0x1A, 0xFF,
+    0xFC, 0xA0, 0xFF, 0xFE, 0x97, 0x77, 0x09, 0x97, 0x5E, 0x97, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x49,
+    0xD7, 0x5D, 0x97, 0x5A, 0x71, 0x39, 0x93, 0xAF, 0x29, 0xFC, 0x5E, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5,
+    0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD3, 0x9F, 0xDA, 0x9F, 0xF7, 0x49, 0x95, 0xE9, 0x49, 0xDA, 0x5D, 0x94,
+    0x9D, 0x5D, 0x95, 0x94, 0x73, 0x97, 0x6A, 0xCA, 0x75, 0xAD, 0x2A, 0xFF, 0x1D, 0xA2, 0x9F, 0xDA,
+    0x2D, 0x95, 0xE4, 0xD6, 0xE4, 0xC9, 0x6E, 0x49, 0x7E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0xAC, 0x3E, 0x7D, 0x3E, 0x69, 0xD3, 0xE4, 0x99, 0xE1,
+    0xAF, 0xFF, 0xCA, 0x0F, 0xFF, 0xE9, 0x00, 0x39, 0x92, 0x92, 0xAF, 0x2D, 0x99, 0xFC, 0x2D, 0xA2,
+    0xE2, 0xD9, 0x2A, 0xD2, 0xD3, 0xAD, 0x19, 0xCA, 0x3A, 0xD1, 0x9C, 0x4A, 0xD2, 0x94, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x69, 0xFD, 0xA2, 0x9F, 0xF2, 0x77, 0x0A, 0xFF, 0x79,
+    0xFD, 0xA7, 0x3E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x5A, 0xA5, 0xE4, 0xF4, 0xE4, 0xF4, 0xE4,
+    0xAD, 0xA4, 0xE5, 0x96, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x7A, 0xC3, 0xE7, 0xD3, 0xE6, 0x9D, 0x3E,
+    0x49, 0x9E, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xFE, 0x90, 0x39, 0x97, 0x0A, 0xF7, 0x9F, 0xC7, 0x2E,
+    0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x39, 0xA9,
+    0x3A, 0xD3, 0xE9, 0x2A, 0xD2, 0x9E, 0x92, 0xAD, 0x3E, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x09, 0xFD, 0xA4, 0x9F, 0xF4, 0x77, 0x4A, 0xFF, 0x71,
+    0x9F, 0xDA, 0x75, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE2, 0xA7, 0x3E, 0x0A, 0xD9, 0x72, 0xFD,
+    0x97, 0x3F, 0x97, 0x3A, 0xF7, 0x3A, 0xFD, 0x73, 0xAC, 0x90, 0xE7, 0x7E, 0x77, 0xE7, 0xAC, 0x5E,
+    0x7D, 0x5E, 0x69, 0xD5, 0xE4, 0x99, 0xE3, 0xAF, 0xFF, 0xCA, 0x2F, 0xFF, 0xE9, 0x00, 0x49, 0x95,
+    0xAF, 0x49, 0xFC, 0x7E, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD1, 0xA4, 0xAD, 0x9D, 0x93,
+    0xAF, 0x94, 0xAE, 0x59, 0xE5, 0xAF, 0x4F, 0xD4, 0xCA, 0x0A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A,
+    0xD7, 0xAD, 0x59, 0xFD, 0xA1, 0x9F, 0xF0, 0x74, 0x97, 0x73, 0xD9, 0x77, 0x0A, 0xEA, 0x77, 0xFC,
+    0x77, 0xEA, 0x97, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x7A, 0xFC, 0x7F, 0xF9, 0xAF, 0xC6, 0xAF, 0xCA,
+    0x3F, 0xA7, 0x0D, 0x5F, 0xC7, 0x0D, 0x5F, 0xD7, 0xD5, 0xD9, 0xAD, 0xA6, 0xD5, 0xD9, 0x0E, 0x95,
+    0xD5, 0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A, 0xDA, 0x4D, 0x5D, 0x92, 0xE9, 0x3D, 0x5D, 0x92, 0x9E,
+    0x3D, 0x5D, 0x93, 0xAE, 0x2D, 0x5D, 0x94, 0xE9, 0x1D, 0x5D, 0x95, 0xE1, 0xD5, 0xD9, 0x59, 0xE0,
+    0xD5, 0xD9, 0x6F, 0xD5, 0xD9, 0x7F, 0xC5, 0xD9, 0x79, 0xF3, 0xAF, 0xD6, 0xAE, 0x2F, 0xF7, 0xE7,
+    0x73, 0x93, 0x73, 0x97, 0x70, 0xDA, 0x76, 0xAD, 0xA7, 0x6E, 0x76, 0xE7, 0x69, 0xD7, 0x70, 0xA7,
+    0x77, 0x76, 0x99, 0x7A, 0xE1, 0xAF, 0xCA, 0x39, 0xFC, 0x9F, 0xF9, 0x39, 0xAF, 0xCA, 0x19, 0xF5,
+    0x9E, 0x5E, 0x59, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9,
+    0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9,
+    0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x29, 0xAF, 0xC9, 0x2A, 0xFC, 0xA0, 0xFE, 0x91, 0x9F, 0xE0,
+    0x77, 0x5A, 0xFC, 0x7F, 0xF9, 0xAF, 0xC6, 0xAF, 0xCA, 0x3F, 0xA7, 0x0D, 0x5F, 0xC7, 0x0D, 0x5F,
+    0xD7, 0xD5, 0xD9, 0xAD, 0xA6, 0xD5, 0xD9, 0x0E, 0x95, 0xD5, 0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A,
+    0xDA, 0x4D, 0x5D, 0x92, 0xE9, 0x3D, 0x5D, 0x92, 0x9E, 0x3D, 0x5D, 0x93, 0xAE, 0x2D, 0x5D, 0x94,
+    0xE9, 0x1D, 0x5D, 0x95, 0xE1, 0xD5, 0xD9, 0x59, 0xE0, 0xD5, 0xD9, 0x6F, 0xD5, 0xD9, 0x7F, 0xC5,
+    0xD9, 0x79, 0xF3, 0xAF, 0xD6, 0xAE, 0x2F, 0xF7, 0xE7, 0x73, 0x97, 0x59, 0x97, 0x72, 0xAD, 0xA7,
+    0x72, 0xE7, 0x72, 0xE7, 0x72, 0xD9, 0x77, 0x1A, 0xCA, 0x77, 0x29, 0x97, 0x20, 0x72, 0x99, 0x7A,
+    0xE1, 0xAF, 0xCA, 0x39, 0xFC, 0x9F, 0xF9, 0x39, 0xAF, 0xCA, 0x19, 0xF5, 0x9E, 0x5E, 0x59, 0xD9,
+    0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9,
+    0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9, 0x5A, 0xD9, 0x49, 0xD9,
+    0x5A, 0xD9, 0x29, 0xAF, 0xC9, 0x2A, 0xFC, 0xA0, 0xFE, 0x91, 0x9F, 0xE7, 0x77, 0x39, 0x97, 0x7A,
+    0xDA, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD7, 0x7D, 0x97, 0x7A, 0x97, 0x00, 0x5A, 0x59, 0xA7, 0x3A,
+    0xD3, 0xAD, 0x97, 0x3E, 0x1A, 0xD9, 0x74, 0x9E, 0xAD, 0x97, 0x69, 0xF9, 0x77, 0x1D, 0xA7, 0x77,
+    0x77, 0x75, 0xAF, 0xC7, 0xFF, 0x9A, 0xFC, 0x6A, 0xFC, 0xA3, 0xFA, 0x70, 0xD5, 0xFC, 0x70, 0xD5,
+    0xFD, 0x7D, 0x5D, 0x9A, 0xDA, 0x6D, 0x5D, 0x90, 0xE9, 0x5D, 0x5D, 0x90, 0x9E, 0x5D, 0x5D, 0x91,
+    0xAD, 0xA4, 0xD5, 0xD9, 0x2E, 0x93, 0xD5, 0xD9, 0x29, 0xE3, 0xD5, 0xD9, 0x3A, 0xE2, 0xD5, 0xD9,
+    0x4E, 0x91, 0xD5, 0xD9, 0x5E, 0x1D, 0x5D, 0x95, 0x9E, 0x0D, 0x5D, 0x96, 0xFD, 0x5D, 0x97, 0xFC,
+    0x5D, 0x97, 0x9F, 0x3A, 0xFD, 0x6A, 0xE2, 0xFF, 0x7E, 0x77, 0x39, 0x30, 0x59, 0x59, 0x71, 0xD9,
+    0x3D, 0x97, 0x09, 0xD2, 0xDA, 0x72, 0xE0, 0xAD, 0x74, 0xFC, 0x76, 0xE9, 0x77, 0xAA, 0x77, 0x77,
+    0x59, 0x97, 0xAE, 0x1A, 0xFC, 0xA3, 0x9F, 0xC9, 0xFF, 0x93, 0x9A, 0xFC, 0xA1, 0x9F, 0x59, 0xE5,
+    0xE5, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD,
+    0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD, 0x94, 0x9D, 0x95, 0xAD,
+    0x94, 0x9D, 0x95, 0xAD, 0x92, 0x9A, 0xFC, 0x92, 0xAF, 0xCA, 0x0F, 0xE9, 0x19, 0xFE, 0x29, 0x77,
+    0x69, 0xE7, 0x76, 0xE9, 0x77, 0x5A, 0xD9, 0x77, 0x59, 0xD9, 0x77, 0x5A, 0xD7, 0x76, 0xD9, 0x73,
+    0x99, 0x79, 0xD3, 0x9A, 0xDA, 0x1F, 0xD9, 0x4D, 0x39, 0xFC, 0x9F, 0xF9, 0x72, 0x9A, 0xFC, 0x91,
+    0x9E, 0xA7, 0x4A, 0xDA, 0x5E, 0x74, 0xAD, 0x6E, 0x74, 0xAD, 0x6E, 0x74, 0xAD, 0x6A, 0xD7, 0x4A,
+    0xD6, 0xAD, 0x74, 0xAD, 0x6A, 0xD7, 0x4A, 0xD6, 0xAD, 0x74, 0xAD, 0x6A, 0xD7, 0x4A, 0xD6, 0xAD,
+    0x74, 0xAD, 0x6A, 0xD7, 0x29, 0xFD, 0x3A, 0xFC, 0x97, 0xFE, 0x2A, 0xFD, 0xA0, 0x77, 0x5A, 0xFC,
+    0x7F, 0xF9, 0xFD, 0x6A, 0xFC, 0xA3, 0xF9, 0x70, 0xD5, 0xFC, 0x70, 0xD5, 0xFD, 0x7D, 0x5D, 0x9A,
+    0xD9, 0x6D, 0x5D, 0x90, 0xE6, 0xD5, 0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A, 0xD9, 0x4D, 0x5D, 0x92,
+    0xE4, 0xD5, 0xD9, 0x29, 0xE3, 0xD5, 0xD9, 0x3A, 0xDA, 0x2D, 0x5D, 0x94, 0xE2, 0xD5, 0xD9, 0x5E,
+    0x1D, 0x5D, 0x95, 0x9D, 0xA0, 0xD5, 0xD9, 0x6E, 0x9D, 0x5D, 0x97, 0xFC, 0x5D, 0x97, 0x9F, 0x3A,
+    0xFD, 0x6A, 0xE2, 0xFF, 0x7E, 0x77, 0x2A, 0xD7, 0x59, 0x92, 0xDA, 0x74, 0x9D, 0x19, 0xD9, 0x74,
+    0x9F, 0xE7, 0x6F, 0xD7, 0x70, 0x9A, 0xA9, 0x50, 0x72, 0x99, 0x5A, 0xE1, 0xAF, 0xCA, 0x19, 0xFC,
+    0x9F, 0xF9, 0x19, 0xAF, 0xCA, 0x19, 0xF3, 0x9E, 0x5E, 0x39, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A,
+    0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A,
+    0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x1A, 0xFC, 0x93,
+    0xAD, 0x90, 0xFE, 0x93, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xE9, 0x72, 0x9E, 0xA7,
+    0x2F, 0xA7, 0x39, 0xCA, 0x93, 0x5F, 0xFA, 0x72, 0x9F, 0xFC, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x99, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF,
+    0x4A, 0xE7, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7,
+    0x39, 0xE0, 0x9E, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E,
+    0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4,
+    0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x29, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x6F, 0xFC, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x72, 0x99, 0x72, 0xAF,
+    0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F, 0x2E, 0x6E, 0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A,
+    0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9, 0x7E, 0x0A, 0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E,
+    0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA, 0xAE, 0xA5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x72,
+    0xCA, 0x49, 0xC7, 0x29, 0xDA, 0x29, 0xD7, 0x3F, 0xF9, 0x74, 0xAF, 0xC9, 0x77, 0x99, 0x77, 0x77,
+    0x69, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79,
+    0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09,
+    0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0,
+    0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A,
+    0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x77, 0x2A, 0xC5, 0xC6,
+    0xE3, 0xD6, 0xAF, 0xEA, 0x79, 0xFC, 0x97, 0x39, 0x97, 0x77, 0x59, 0x97, 0x2A, 0xFD, 0xA6, 0xFF,
+    0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0,
+    0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93,
+    0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x77, 0x76, 0xC9, 0x3A, 0xC7,
+    0x3E, 0x2A, 0xD9, 0x70, 0x9E, 0xA1, 0xAE, 0x70, 0x9E, 0x91, 0xF7, 0x09, 0xDA, 0x2E, 0x97, 0x2C,
+    0x93, 0xAA, 0x77, 0x77, 0x39, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9,
+    0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0,
+    0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E,
+    0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7,
+    0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00,
+    0x77, 0x5D, 0x91, 0xD9, 0x69, 0xDA, 0x09, 0xDA, 0x6E, 0x1E, 0x69, 0xD9, 0x09, 0xD9, 0x6D, 0x91,
+    0xD9, 0x7A, 0xA2, 0xAA, 0x77, 0x73, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F, 0x2E,
+    0x6E, 0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9, 0x7E,
+    0x0A, 0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA, 0xAE,
+    0xA5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x77, 0x9A, 0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xFF,
+    0x92, 0x9E, 0xA9, 0x3E, 0x6D, 0x91, 0x9E, 0x95, 0xE6, 0xD2, 0xE7, 0xE6, 0xAC, 0x1A, 0xDA, 0x7E,
+    0x72, 0xE7, 0x0E, 0x71, 0x9E, 0x70, 0xE7, 0x19, 0xDA, 0x70, 0xE1, 0x99, 0x99, 0x92, 0xAD, 0xA7,
+    0x0F, 0xFD, 0xA1, 0xAD, 0xA7, 0x0F, 0xFD, 0x91, 0xAD, 0xA7, 0x0E, 0x71, 0x9E, 0x70, 0xE7, 0x2E,
+    0x70, 0xE7, 0x2E, 0xA7, 0xE7, 0x99, 0x09, 0xE7, 0xE7, 0xD1, 0xF9, 0x5E, 0x69, 0xD2, 0xFA, 0x93,
+    0xE4, 0x99, 0xE3, 0xAF, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xFD, 0x97, 0x19, 0x99, 0x74, 0x69, 0x71,
+    0x99, 0x70, 0xAF, 0xCA, 0x3A, 0xFC, 0xA4, 0x9F, 0xFC, 0x1F, 0xFC, 0x29, 0xE3, 0xAF, 0xD3, 0xAD,
+    0x91, 0xE5, 0xAF, 0x94, 0xE0, 0x9D, 0xA6, 0xF5, 0xE0, 0xAD, 0x96, 0xAD, 0xA5, 0xE0, 0xAD, 0x79,
+    0xFF, 0xF0, 0xE7, 0x9F, 0xFE, 0xA0, 0xE9, 0x69, 0xD9, 0x71, 0xAD, 0x96, 0x9D, 0xA7, 0x1A, 0xDA,
+    0x6F, 0x71, 0x9E, 0x59, 0xFA, 0x71, 0xF3, 0x9F, 0xE9, 0x39, 0xA2, 0xFC, 0xAF, 0x0A, 0xFF, 0xCA,
+    0x3F, 0xEA, 0x29, 0xFE, 0xA6, 0x99, 0x99, 0x79, 0x99, 0x93, 0x71, 0x97, 0x71, 0xAC, 0xA7, 0x69,
+    0xF7, 0x5A, 0xF7, 0x5F, 0x97, 0x69, 0x97, 0x77, 0x75, 0x99, 0x99, 0x97, 0x1A, 0xFF, 0xEA, 0x69,
+    0xFC, 0xAA, 0xAF, 0xC7, 0x0E, 0x39, 0xEA, 0x7E, 0x5E, 0x7E, 0x5E, 0x96, 0xE5, 0xAD, 0x96, 0xE5,
+    0xE7, 0xE5, 0xE7, 0xE3, 0x9E, 0x70, 0xE9, 0x9A, 0xF7, 0x1F, 0xF9, 0x72, 0xEA, 0xAE, 0x73, 0xE1,
+    0xAD, 0xA7, 0x2E, 0x2E, 0x97, 0x1E, 0x29, 0xE9, 0x70, 0xE3, 0xAE, 0x70, 0xE4, 0xF9, 0x6E, 0x5F,
+    0x93, 0xAF, 0xD9, 0x3F, 0xA1, 0xFF, 0xA4, 0xFC, 0x77, 0x99, 0x91, 0x79, 0x73, 0xD9, 0x70, 0xE9,
+    0x79, 0xE7, 0x0E, 0x70, 0xAC, 0xA7, 0x29, 0x77, 0x75, 0x92, 0xAE, 0x19, 0xF9, 0xFC, 0x0A, 0xFC,
+    0x09, 0xAE, 0xAD, 0xAA, 0xCA, 0x29, 0xEA, 0x79, 0xE7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9,
+    0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x96, 0x9A, 0xFD, 0xA2,
+    0x9F, 0xFC, 0x20, 0x49, 0x99, 0x99, 0x71, 0xAF, 0xFE, 0xA6, 0x9F, 0xCA, 0xAA, 0xFC, 0x70, 0xE3,
+    0x9E, 0xA7, 0xE5, 0xE7, 0xE5, 0xE9, 0x6E, 0x5A, 0xD9, 0x6E, 0x5E, 0x7E, 0x5E, 0x7E, 0x39, 0xE7,
+    0x0E, 0x99, 0xAF, 0x71, 0xFF, 0x97, 0x2E, 0xAA, 0xE7, 0x3E, 0x1A, 0xDA, 0x72, 0xE2, 0xE9, 0x71,
+    0xE2, 0x9E, 0x97, 0x0E, 0x3A, 0xE7, 0x0E, 0x4F, 0x96, 0xE5, 0xF9, 0x3A, 0xFD, 0x93, 0xFA, 0x1F,
+    0xFA, 0x4F, 0xC7, 0x79, 0x99, 0x72, 0x99, 0x77, 0x0E, 0x97, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79,
+    0xD7, 0x70, 0xD9, 0x77, 0x0A, 0x72, 0x72, 0x92, 0xAE, 0x19, 0xF9, 0xFC, 0x0A, 0xFC, 0x09, 0xAE,
+    0xAD, 0xAA, 0xCA, 0x29, 0xEA, 0x79, 0xE7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D,
+    0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x96, 0x9A, 0xFD, 0xA2, 0x9F, 0xFC,
+    0x77, 0x39, 0x97, 0x1A, 0xDA, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x0D, 0xA7, 0x19, 0x97, 0x2A,
+    0x59, 0xA9, 0x70, 0xAD, 0x39, 0xD9, 0x71, 0xE9, 0x0A, 0xD9, 0x73, 0xEA, 0xD9, 0x75, 0xFA, 0x77,
+    0xAC, 0xA7, 0x77, 0x73, 0x99, 0x99, 0x97, 0x1A, 0xFF, 0xEA, 0x69, 0xFC, 0xAA, 0xAF, 0xC7, 0x0E,
+    0x39, 0xEA, 0x7E, 0x5E, 0x7E, 0x5E, 0x96, 0xE5, 0xAD, 0x96, 0xE5, 0xE7, 0xE5, 0xE7, 0xE3, 0x9E,
+    0x70, 0xE9, 0x9A, 0xF7, 0x1F, 0xF9, 0x72, 0xEA, 0xAE, 0x73, 0xE1, 0xAD, 0xA7, 0x2E, 0x2E, 0x97,
+    0x1E, 0x29, 0xE9, 0x70, 0xE3, 0xAE, 0x70, 0xE4, 0xF9, 0x6E, 0x5F, 0x93, 0xAF, 0xD9, 0x3F, 0xA1,
+    0xFF, 0xA4, 0xFC, 0x77, 0x99, 0x91, 0x71, 0x93, 0xD3, 0x9D, 0x3A, 0xD2, 0xD9, 0x4E, 0x0D, 0xA5,
+    0x9F, 0xC7, 0x9E, 0x71, 0x9A, 0x97, 0x77, 0x49, 0x2A, 0xE1, 0x9F, 0x9F, 0xC0, 0xAF, 0xC0, 0x9A,
+    0xEA, 0xDA, 0xAC, 0xA2, 0x9E, 0xA7, 0x9E, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09,
+    0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x69, 0xAF, 0xDA, 0x29, 0xFF,
+    0xC2, 0x71, 0x97, 0x29, 0xD7, 0x1A, 0xE9, 0x69, 0xFA, 0x7E, 0xA7, 0x1A, 0x77, 0x73, 0x99, 0x99,
+    0x69, 0xFF, 0x92, 0x9F, 0xFD, 0x19, 0xE9, 0x3E, 0x1A, 0xD9, 0x4A, 0xD1, 0xE5, 0x9D, 0x1E, 0x59,
+    0xC9, 0x1F, 0x71, 0x9F, 0x97, 0x0A, 0xFC, 0x97, 0x9F, 0xCA, 0x70, 0xAF, 0xC9, 0x70, 0xAF, 0xA7,
+    0x09, 0xF1, 0x97, 0xE9, 0xAC, 0xA6, 0xAD, 0x9A, 0xD6, 0xAD, 0x9A, 0xD6, 0xE0, 0xAE, 0x4E, 0xA0,
+    0xAF, 0xFD, 0xA2, 0xAF, 0xF9, 0x69, 0x99, 0x99, 0x40, 0x79, 0x71, 0xAC, 0xA7, 0x9E, 0x7E, 0x7A,
+    0xD9, 0x7D, 0x71, 0xA7, 0x76, 0x99, 0x7A, 0xFD, 0xA2, 0xEA, 0xAF, 0x1A, 0xD3, 0xAD, 0x1D, 0xA4,
+    0xD1, 0xE4, 0x92, 0xAE, 0xA7, 0xFC, 0xA6, 0xFD, 0xA5, 0x9F, 0xCA, 0x7A, 0xE1, 0xCA, 0x49, 0xD9,
+    0x0D, 0x5D, 0x90, 0xDA, 0x3A, 0xD1, 0xFA, 0xAE, 0x91, 0xAF, 0xE9, 0x49, 0x99, 0x94, 0x69, 0x72,
+    0x9E, 0x97, 0x0F, 0xC9, 0x6E, 0x0E, 0x94, 0xE2, 0xAD, 0x39, 0xCA, 0x4A, 0xA7, 0x75, 0x99, 0x99,
+    0x69, 0xFF, 0x92, 0x9F, 0xFD, 0x19, 0xE9, 0x3E, 0x1A, 0xD9, 0x4A, 0xD1, 0xE5, 0x9D, 0x1E, 0x59,
+    0xC9, 0x1F, 0x71, 0x9F, 0x97, 0x0A, 0xFC, 0x97, 0x9F, 0xCA, 0x70, 0xAF, 0xC9, 0x70, 0xAF, 0xA7,
+    0x09, 0xF1, 0x97, 0xE9, 0xAC, 0xA6, 0xAD, 0x9A, 0xD6, 0xAD, 0x9A, 0xD6, 0xE0, 0xAE, 0x4E, 0xA0,
+    0xAF, 0xFD, 0xA2, 0xAF, 0xF9, 0x69, 0x99, 0x99, 0x40, 0x77, 0x9D, 0xA7, 0xFA, 0x5A, 0xDA, 0xD9,
+    0x4D, 0x90, 0xE3, 0xDA, 0x2D, 0x91, 0x9C, 0xA4, 0xC9, 0x77, 0x19, 0x97, 0xAF, 0xDA, 0x2E, 0xAA,
+    0xF1, 0xAD, 0x3A, 0xD1, 0xDA, 0x4D, 0x1E, 0x49, 0x2A, 0xEA, 0x7F, 0xCA, 0x6F, 0xDA, 0x59, 0xFC,
+    0xA7, 0xAE, 0x1C, 0xA4, 0x9D, 0x90, 0xD5, 0xD9, 0x0D, 0xA3, 0xAD, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE,
+    0x94, 0x99, 0x99, 0x40, 0x59, 0x99, 0x96, 0x9F, 0xF9, 0x29, 0xFF, 0xD1, 0x9E, 0x93, 0xE1, 0xAD,
+    0x94, 0xAD, 0x1E, 0x59, 0xD1, 0xE5, 0x9C, 0x91, 0xF7, 0x19, 0xF9, 0x70, 0xAF, 0xC9, 0x79, 0xFC,
+    0xA7, 0x0A, 0xFC, 0x97, 0x0A, 0xFA, 0x70, 0x9F, 0x19, 0x7E, 0x9A, 0xCA, 0x6A, 0xD9, 0xAD, 0x6A,
+    0xD9, 0xAD, 0x6E, 0x0A, 0xE4, 0xEA, 0x0A, 0xFF, 0xDA, 0x2A, 0xFF, 0x96, 0x99, 0x99, 0x97, 0x2A,
+    0x97, 0x2F, 0x97, 0x09, 0x9D, 0xA7, 0x2D, 0xA7, 0x1A, 0xD7, 0x1E, 0x97, 0x19, 0x96, 0x49, 0x97,
+    0xAF, 0xDA, 0x2E, 0xAA, 0xF1, 0xAD, 0x3A, 0xD1, 0xDA, 0x4D, 0x1E, 0x49, 0x2A, 0xEA, 0x7F, 0xCA,
+    0x6F, 0xDA, 0x59, 0xFC, 0xA7, 0xAE, 0x1C, 0xA4, 0x9D, 0x90, 0xD5, 0xD9, 0x0D, 0xA3, 0xAD, 0x1F,
+    0xAA, 0xE9, 0x1A, 0xFE, 0x94, 0x99, 0x99, 0x70, 0x9A, 0x97, 0x0F, 0x79, 0xAD, 0xA7, 0x0D, 0x97,
+    0xAD, 0x7E, 0x70, 0x99, 0x50, 0x19, 0x95, 0xAA, 0x3D, 0xA3, 0xE3, 0x9D, 0xA1, 0xE5, 0x9F, 0xD7,
+    0x9F, 0x71, 0x9D, 0x97, 0x77, 0x09, 0x99, 0x96, 0x9F, 0xF9, 0x29, 0xFF, 0xD1, 0x9E, 0x93, 0xE1,
+    0xAD, 0x94, 0xAD, 0x1E, 0x59, 0xD1, 0xE5, 0x9C, 0x91, 0xF7, 0x19, 0xF9, 0x70, 0xAF, 0xC9, 0x79,
+    0xFC, 0xA7, 0x0A, 0xFC, 0x97, 0x0A, 0xFA, 0x70, 0x9F, 0x19, 0x7E, 0x9A, 0xCA, 0x6A, 0xD9, 0xAD,
+    0x6A, 0xD9, 0xAD, 0x6E, 0x0A, 0xE4, 0xEA, 0x0A, 0xFF, 0xDA, 0x2A, 0xFF, 0x96, 0x99, 0x99, 0x94,
+    0x19, 0x59, 0x2A, 0xCA, 0x3D, 0xA1, 0x9D, 0x91, 0xE3, 0xAD, 0x0A, 0xD5, 0xFC, 0x96, 0xEA, 0x70,
+    0xAA, 0x77, 0x59, 0x97, 0xAF, 0xDA, 0x2E, 0xAA, 0xF1, 0xAD, 0x3A, 0xD1, 0xDA, 0x4D, 0x1E, 0x49,
+    0x2A, 0xEA, 0x7F, 0xCA, 0x6F, 0xDA, 0x59, 0xFC, 0xA7, 0xAE, 0x1C, 0xA4, 0x9D, 0x90, 0xD5, 0xD9,
+    0x0D, 0xA3, 0xAD, 0x1F, 0xAA, 0xE9, 0x1A, 0xFE, 0x94, 0x99, 0x99, 0x40, 0x77, 0x1A, 0xFF, 0xFF,
+    0xAF, 0xFF, 0xFC, 0xAD, 0xA3, 0xE9, 0x3D, 0xAD, 0x93, 0xE9, 0x3D, 0x9D, 0x4E, 0x93, 0xAC, 0x99,
+    0xC4, 0xE9, 0x3A, 0xA7, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x72, 0x9A, 0xFE, 0x97, 0xFF,
+    0xC9, 0x77, 0x74, 0x9A, 0x97, 0x59, 0xF7, 0x59, 0xE9, 0x75, 0xAD, 0x76, 0xDA, 0x74, 0x9E, 0x76,
+    0xA9, 0x70, 0x3A, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA6, 0x9A, 0xFE, 0xA0, 0xFF, 0xDA, 0x09,
+    0x99, 0xE9, 0x99, 0x94, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70,
+    0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x0E, 0x97, 0xFF, 0x93, 0xFD, 0xA5, 0x99, 0x99, 0x79, 0xA9, 0x79,
+    0xF7, 0x9A, 0xD9, 0x70, 0xD9, 0x7E, 0x7E, 0x70, 0x99, 0x40, 0x3A, 0x6A, 0x96, 0x9D, 0x92, 0x9D,
+    0xA7, 0xE9, 0x09, 0xDA, 0x71, 0xEA, 0xDA, 0x73, 0xFA, 0x75, 0xAD, 0x77, 0x77, 0x73, 0xAF, 0xFF,
+    0xFA, 0xFF, 0xFF, 0xCA, 0xDA, 0x3E, 0x93, 0xDA, 0xD9, 0x3E, 0x93, 0xD9, 0xD4, 0xE9, 0x3A, 0xC9,
+    0x9C, 0x4E, 0x93, 0xAA, 0x7E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x29, 0xAF, 0xE9, 0x7F,
+    0xFC, 0x93, 0x77, 0x3D, 0x71, 0xD9, 0x70, 0xD7, 0x09, 0xD5, 0xAA, 0x09, 0xC9, 0x4D, 0xA0, 0x9C,
+    0x5D, 0xA1, 0x95, 0xDA, 0x69, 0xAF, 0xEA, 0x0F, 0xFD, 0xA0, 0x99, 0x9E, 0x99, 0x99, 0x4D, 0xA7,
+    0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0E, 0x70,
+    0xE9, 0x7F, 0xF9, 0x3F, 0xDA, 0x59, 0x99, 0x92, 0x77, 0x1A, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC, 0xAD,
+    0xA3, 0xE9, 0x3D, 0xAD, 0x93, 0xE9, 0x3D, 0x9D, 0x4E, 0x93, 0xAC, 0x99, 0xC4, 0xE9, 0x3A, 0xA7,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x72, 0xFF, 0xC9, 0x7A, 0xFF, 0x97, 0x2E, 0x97, 0x5E, 0x97, 0x5E,
+    0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x29, 0xAF, 0xE9, 0x7F, 0xFC, 0x93, 0x3A,
+    0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA6, 0x9A, 0xFE, 0xA0, 0xFF, 0xDA, 0x09, 0x99, 0xE9, 0x99,
+    0x94, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x59, 0x99, 0xE9, 0x99, 0x91, 0xAF, 0xFC, 0x29, 0x9E, 0x99,
+    0x99, 0x4D, 0xA7, 0x0D, 0xA7, 0x0E, 0x70, 0xE9, 0x7F, 0xF9, 0x3F, 0xDA, 0x59, 0x99, 0x92, 0x77,
+    0x74, 0x9E, 0x91, 0xCA, 0x74, 0xFC, 0xAA, 0xD7, 0x4D, 0x9A, 0xFC, 0x74, 0xAA, 0x19, 0xE7, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E,
+    0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E,
+    0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E,
+    0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59,
+    0xE7, 0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76,
+    0x99, 0x99, 0x70, 0x77, 0x7F, 0x19, 0xC7, 0x1A, 0xFC, 0x9D, 0x97, 0x0A, 0xCA, 0x0F, 0xC9, 0x71,
+    0xC2, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x7A, 0xF4, 0xAE, 0xA2, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA,
+    0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA,
+    0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD,
+    0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94, 0x93,
+    0x6A, 0xFF, 0x74, 0xFF, 0xC7, 0x4A, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x79, 0xFF,
+    0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD,
+    0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0x99, 0x70, 0x4A, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x70, 0xAF, 0xF9, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x7A,
+    0xF4, 0xAE, 0xA2, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA,
+    0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA,
+    0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF,
+    0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94, 0x93, 0x77, 0x74, 0xCA, 0x5C, 0x73, 0x9D, 0xA2,
+    0x9D, 0x74, 0xFF, 0x97, 0x5A, 0xFC, 0x97, 0x70, 0x99, 0x97, 0x77, 0x77, 0x74, 0x9F, 0xF4, 0xFF,
+    0x0F, 0xDA, 0x5A, 0xFC, 0xA3, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D,
+    0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D,
+    0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D,
+    0x94, 0xAD, 0x97, 0x09, 0xD5, 0xAD, 0x97, 0x0A, 0xD5, 0x9E, 0x70, 0xE6, 0xE9, 0x6A, 0xDA, 0x6A,
+    0xEA, 0x39, 0xAE, 0x70, 0xFF, 0xF7, 0x2A, 0xFF, 0xA7, 0x69, 0x99, 0x97, 0x00, 0x77, 0x69, 0xC9,
+    0x4A, 0x97, 0x0A, 0xD9, 0x2A, 0xC9, 0x71, 0xFF, 0x72, 0x9F, 0xCA, 0x76, 0x99, 0x77, 0x77, 0x77,
+    0xAF, 0x4A, 0xEA, 0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D,
+    0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA,
+    0xFC, 0x93, 0x9F, 0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x71, 0x9A, 0x97, 0x71, 0xFC, 0x77,
+    0xD9, 0x9A, 0xD7, 0x6D, 0x2D, 0x76, 0xD2, 0xD7, 0x6D, 0xA9, 0xAC, 0xA7, 0x69, 0xFC, 0x77, 0x19,
+    0x99, 0x77, 0x76, 0x9F, 0xF4, 0xFF, 0x0F, 0xDA, 0x5A, 0xFC, 0xA3, 0xE9, 0x70, 0x9D, 0x94, 0xE9,
+    0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9,
+    0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9,
+    0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xAD, 0x97, 0x09, 0xD5, 0xAD, 0x97, 0x0A, 0xD5, 0x9E,
+    0x70, 0xE6, 0xE9, 0x6A, 0xDA, 0x6A, 0xEA, 0x39, 0xAE, 0x70, 0xFF, 0xF7, 0x2A, 0xFF, 0xA7, 0x69,
+    0x99, 0x97, 0x00, 0x6A, 0xDA, 0x75, 0xFD, 0x73, 0x9C, 0xA1, 0xD9, 0x72, 0xAC, 0x91, 0xAC, 0xA7,
+    0x2A, 0xCA, 0x1A, 0xC9, 0x72, 0x9D, 0x99, 0xD7, 0x4A, 0xF9, 0x76, 0x99, 0x77, 0x74, 0xAF, 0x4A,
+    0xEA, 0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA,
+    0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93,
+    0x9F, 0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x77, 0x77, 0x0C, 0x93, 0x9C, 0x74, 0xE2, 0xAD,
+    0x97, 0x2E, 0xA1, 0xAE, 0x71, 0x9E, 0xA1, 0xAE, 0x72, 0xE2, 0xAD, 0xA7, 0x3C, 0x93, 0xAA, 0x77,
+    0x77, 0x77, 0x29, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97,
+    0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7,
+    0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99,
+    0x99, 0x70, 0x79, 0x39, 0x73, 0x9C, 0xA1, 0x9C, 0xA7, 0x2E, 0x1E, 0x71, 0x9D, 0x90, 0xAD, 0x97,
+    0x1D, 0xA1, 0xDA, 0x71, 0x9D, 0x1A, 0xD7, 0x29, 0xA2, 0x9A, 0x77, 0x77, 0x75, 0xAF, 0x4A, 0xEA,
+    0x2A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5,
+    0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59,
+    0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F,
+    0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x77, 0x59, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF, 0xCA,
+    0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9,
+    0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9,
+    0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70, 0x9D,
+    0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7, 0x0F,
+    0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0xE7, 0x71, 0xAD, 0x77, 0x2D, 0xA7, 0x72, 0xE7, 0x72, 0xFD,
+    0x77, 0x0A, 0xEA, 0x77, 0x73, 0x77, 0x3A, 0xF4, 0xAE, 0xA2, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA,
+    0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA,
+    0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD,
+    0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94, 0xAC,
+    0xA7, 0x6A, 0xCA, 0x77, 0xD9, 0x77, 0xDA, 0x77, 0xFC, 0xA7, 0x5A, 0xE9, 0x77, 0x20, 0x76, 0x99,
+    0x77, 0x74, 0xAE, 0x77, 0x72, 0x9F, 0xC7, 0x77, 0x09, 0xDA, 0x9E, 0x77, 0x69, 0xDA, 0x2D, 0xA7,
+    0x75, 0xAC, 0x94, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x73, 0xFF, 0xA4, 0x99, 0x59, 0xFE, 0xA0, 0xAF,
+    0xDA, 0x5D, 0xA5, 0xAF, 0xCA, 0x3E, 0xA6, 0x9E, 0x7E, 0x59, 0xE6, 0xAE, 0x96, 0xDA, 0x6E, 0x6F,
+    0xA5, 0x9D, 0x96, 0xE9, 0x5F, 0xC5, 0xAD, 0x7A, 0xDA, 0x49, 0xFC, 0x5E, 0x70, 0xE4, 0xDA, 0x9D,
+    0x94, 0xD9, 0x70, 0xE4, 0xD1, 0xE3, 0x9D, 0x71, 0xAD, 0x92, 0x9D, 0x1E, 0x3A, 0xD7, 0x19, 0xDA,
+    0x2A, 0xCA, 0x19, 0xD9, 0x2D, 0x97, 0x2E, 0x2D, 0x92, 0xDA, 0x19, 0xD7, 0x3A, 0xD1, 0x9D, 0x3E,
+    0x1A, 0xD7, 0x39, 0xD9, 0x0A, 0xCA, 0x39, 0xD9, 0x0D, 0xA7, 0x4E, 0x0D, 0x94, 0xDA, 0x0D, 0x75,
+    0xAD, 0x9D, 0x5E, 0x9D, 0x75, 0x9F, 0xA5, 0xAF, 0xA7, 0x6F, 0x96, 0xF9, 0x76, 0xAE, 0x7F, 0x77,
+    0x9E, 0x7A, 0xDA, 0x77, 0x77, 0x70, 0x77, 0x77, 0x4A, 0xD9, 0x77, 0x49, 0xF7, 0x74, 0xDA, 0xE7,
+    0x72, 0xAD, 0x09, 0xD9, 0x77, 0x09, 0xD2, 0x9D, 0x77, 0x0A, 0xC9, 0x3A, 0xA7, 0x77, 0x77, 0x77,
+    0x49, 0xFD, 0xA3, 0xAC, 0x4F, 0xD9, 0x0F, 0xD9, 0x3D, 0x93, 0xAF, 0xC2, 0xE9, 0x49, 0xDA, 0x5D,
+    0xA3, 0x9D, 0xA4, 0xAE, 0x49, 0xD9, 0x4E, 0x4F, 0x93, 0xAD, 0x5A, 0xD9, 0x29, 0xFA, 0x3D, 0xA5,
+    0x9D, 0xA2, 0xAC, 0xAA, 0xD3, 0xD7, 0xE2, 0xD0, 0x9D, 0x91, 0xAD, 0x7A, 0xD1, 0x9D, 0x1D, 0xA1,
+    0xD9, 0x70, 0xD9, 0x0A, 0xC9, 0x1A, 0xD1, 0xD7, 0x1E, 0x0D, 0x29, 0xD9, 0x9C, 0xA7, 0x1A, 0xD9,
+    0xCA, 0x3D, 0xAD, 0x97, 0x2F, 0x93, 0xAF, 0x73, 0xF5, 0xEA, 0x73, 0x9D, 0xA5, 0xE9, 0x77, 0x77,
+    0x70, 0x99, 0x77, 0x0A, 0xDA, 0x76, 0xAF, 0xC7, 0x49, 0xD9, 0x9E, 0x72, 0x9D, 0x91, 0x9D, 0x97,
+    0x1A, 0xC9, 0x4C, 0x97, 0x77, 0x77, 0x4A, 0xFF, 0x2A, 0xFD, 0xA9, 0xFD, 0xA3, 0x9A, 0xFA, 0x3E,
+    0x96, 0xAD, 0x5A, 0xE6, 0xDA, 0x6E, 0x94, 0xAD, 0x79, 0xE4, 0xD9, 0x70, 0xAD, 0x92, 0xAD, 0x72,
+    0xE1, 0x9D, 0x73, 0xAD, 0xA0, 0xDA, 0x74, 0xE9, 0xD7, 0x59, 0xF9, 0x76, 0xF7, 0x79, 0xDA, 0x77,
+    0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x5A, 0xFE, 0xA7, 0x1A,
+    0xFF, 0xC4, 0x77, 0x70, 0xE7, 0x5A, 0xF7, 0x39, 0xDA, 0xDA, 0x72, 0xDA, 0x09, 0xD9, 0x70, 0xAD,
+    0x2A, 0xD7, 0x0D, 0x4C, 0xA7, 0x77, 0x77, 0x09, 0xFD, 0xA2, 0xFD, 0x09, 0xFD, 0x92, 0xAF, 0xA2,
+    0xE9, 0x6D, 0xA3, 0x9D, 0xA5, 0xAD, 0x5E, 0x5D, 0xA5, 0xAD, 0x93, 0x9D, 0x7E, 0x3A, 0xD7, 0xAD,
+    0x3D, 0x97, 0x0D, 0xA1, 0xAD, 0x71, 0xE1, 0xD9, 0x71, 0x9D, 0x99, 0xD7, 0x3D, 0xAA, 0xCA, 0x73,
+    0xAF, 0x75, 0xEA, 0x75, 0xAD, 0x76, 0xE7, 0x59, 0xD9, 0x74, 0x9E, 0x74, 0xAE, 0x71, 0xAF, 0xD9,
+    0x71, 0xAF, 0xC9, 0x73, 0xAC, 0xAA, 0x74, 0x59, 0x49, 0x97, 0x2E, 0x91, 0xEA, 0x70, 0x9E, 0x91,
+    0xEA, 0x71, 0xE2, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAF, 0xF2, 0xAF, 0xDA, 0x9F, 0xDA, 0x39,
+    0xAF, 0xA3, 0xE9, 0x6A, 0xD5, 0xAE, 0x6D, 0xA6, 0xE9, 0x4A, 0xD7, 0x9E, 0x4D, 0x97, 0x0A, 0xD9,
+    0x2A, 0xD7, 0x2E, 0x19, 0xD7, 0x3A, 0xDA, 0x0D, 0xA7, 0x4E, 0x9D, 0x75, 0x9F, 0x97, 0x6F, 0x77,
+    0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x75, 0xAF,
+    0xEA, 0x71, 0xAF, 0xFC, 0x40, 0x71, 0x97, 0x5D, 0xA7, 0x29, 0xEA, 0x71, 0xAF, 0x71, 0xEA, 0x97,
+    0x29, 0x97, 0x77, 0x77, 0x1F, 0xFF, 0xCA, 0x1F, 0xFF, 0xD1, 0xDA, 0x59, 0xE9, 0x09, 0xD6, 0xEA,
+    0x19, 0xCA, 0x59, 0xE3, 0xA9, 0x5E, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2A,
+    0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x69, 0xC2, 0xE7, 0xD1, 0xE9, 0x69, 0xD0,
+    0xAE, 0x39, 0x99, 0x9E, 0x0F, 0xFF, 0xDA, 0x0A, 0xFF, 0xFC, 0x97, 0x70, 0x70, 0x97, 0x39, 0xD7,
+    0x2E, 0x71, 0xAD, 0xA7, 0x09, 0xDA, 0x71, 0xDA, 0x72, 0x99, 0x77, 0x77, 0x3F, 0xFD, 0xA1, 0x9F,
+    0xFE, 0x90, 0x9D, 0x93, 0xAD, 0xA1, 0x9C, 0x93, 0x9E, 0x29, 0xC4, 0xE7, 0x1E, 0x97, 0x0A, 0xD9,
+    0x70, 0x9D, 0xA7, 0x09, 0xE7, 0x1E, 0x71, 0xE9, 0x4C, 0xA1, 0xAD, 0xA4, 0x9C, 0xA0, 0x9D, 0xA5,
+    0xDA, 0x0F, 0xFF, 0x90, 0xAF, 0xFE, 0x76, 0x77, 0x5A, 0xD7, 0x39, 0xEA, 0x72, 0x9E, 0x97, 0x3A,
+    0xCA, 0x77, 0x77, 0x77, 0x7F, 0xFF, 0xCA, 0x1F, 0xFF, 0xD1, 0xDA, 0x59, 0xE9, 0x09, 0xD6, 0xEA,
+    0x19, 0xCA, 0x59, 0xE3, 0xA9, 0x5E, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2A,
+    0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x69, 0xC2, 0xE7, 0xD1, 0xE9, 0x69, 0xD0,
+    0xAE, 0x39, 0x99, 0x9E, 0x0F, 0xFF, 0xDA, 0x0A, 0xFF, 0xFC, 0x97, 0x70, 0x5A, 0xCA, 0x71, 0x9E,
+    0x97, 0x09, 0xE9, 0x71, 0xAC, 0xA7, 0x77, 0x77, 0x70, 0xFF, 0xDA, 0x19, 0xFF, 0xE9, 0x09, 0xD9,
+    0x3A, 0xDA, 0x19, 0xC9, 0x39, 0xE2, 0x9C, 0x4E, 0x71, 0xE9, 0x70, 0xAD, 0x97, 0x09, 0xDA, 0x70,
+    0x9E, 0x71, 0xE7, 0x1E, 0x94, 0xCA, 0x1A, 0xDA, 0x49, 0xCA, 0x09, 0xDA, 0x5D, 0xA0, 0xFF, 0xF9,
+    0x0A, 0xFF, 0xE7, 0x60, 0x2A, 0x59, 0xA9, 0x4A, 0xD3, 0xAD, 0x95, 0xE1, 0xAD, 0x97, 0xEA, 0xD9,
+    0x71, 0xFA, 0x73, 0xAC, 0xA7, 0x77, 0x77, 0xFF, 0xFC, 0xA1, 0xFF, 0xFD, 0x1D, 0xA5, 0x9E, 0x90,
+    0x9D, 0x6E, 0xA1, 0x9C, 0xA5, 0x9E, 0x3A, 0x95, 0xE7, 0x3E, 0x97, 0x2A, 0xDA, 0x72, 0x9E, 0x73,
+    0xE9, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A, 0xE6, 0x9C, 0x2E, 0x7D, 0x1E,
+    0x96, 0x9D, 0x0A, 0xE3, 0x99, 0x99, 0xE0, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xC9, 0x77, 0x00, 0x71,
+    0x95, 0xD3, 0xAD, 0x4D, 0xA1, 0x9D, 0x59, 0xDA, 0x0D, 0x96, 0x9F, 0xA7, 0x0A, 0xE7, 0x29, 0xA9,
+    0x77, 0x77, 0x2F, 0xFD, 0xA1, 0x9F, 0xFE, 0x90, 0x9D, 0x93, 0xAD, 0xA1, 0x9C, 0x93, 0x9E, 0x29,
+    0xC4, 0xE7, 0x1E, 0x97, 0x0A, 0xD9, 0x70, 0x9D, 0xA7, 0x09, 0xE7, 0x1E, 0x71, 0xE9, 0x4C, 0xA1,
+    0xAD, 0xA4, 0x9C, 0xA0, 0x9D, 0xA5, 0xDA, 0x0F, 0xFF, 0x90, 0xAF, 0xFE, 0x76, 0x79, 0xAA, 0x97,
+    0xAF, 0xD9, 0x4A, 0xDA, 0xAA, 0xE3, 0x9D, 0x92, 0x9C, 0x93, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71,
+    0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D,
+    0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97,
+    0x19, 0xD9, 0x79, 0xAF, 0xD9, 0x4F, 0xFA, 0x30, 0x77, 0x19, 0xAA, 0x77, 0x29, 0xDA, 0x77, 0x19,
+    0xDA, 0x79, 0x9A, 0xA9, 0x4A, 0xD9, 0x49, 0xFF, 0xCA, 0x09, 0xDA, 0x4A, 0xFC, 0xAF, 0xFA, 0x4F,
+    0x94, 0xAF, 0x94, 0xAE, 0x79, 0xEA, 0x39, 0xE7, 0x1A, 0xE3, 0xAD, 0xA7, 0x2E, 0xA2, 0xE7, 0x3A,
+    0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAD, 0xA7, 0x4E, 0x1A, 0xE7,
+    0x4E, 0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x73, 0xAD, 0xA2, 0xEA, 0x72, 0xE9, 0x2A, 0xE7, 0x1A, 0xE4,
+    0xF7, 0x9E, 0x59, 0xF9, 0x4A, 0xE9, 0x69, 0xFF, 0xF9, 0x71, 0xAF, 0xFA, 0x75, 0x99, 0x99, 0x97,
+    0x10, 0x77, 0x75, 0xAD, 0x97, 0x49, 0xD9, 0x69, 0x93, 0xAD, 0x4A, 0xFD, 0xA0, 0xDA, 0x3F, 0xFE,
+    0xA3, 0xE9, 0x29, 0xF3, 0xE6, 0xE9, 0x2D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xAD, 0x70, 0xE1,
+    0xE7, 0x0E, 0x1E, 0x97, 0xE1, 0xAD, 0x97, 0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x95, 0xE3, 0xAE, 0x93,
+    0xAD, 0xA4, 0xFC, 0xAA, 0xEA, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x97, 0x59, 0x99, 0x99, 0x97, 0x09,
+    0xAF, 0xFE, 0x93, 0xFF, 0xAA, 0xFC, 0xA1, 0xAD, 0xA0, 0x9D, 0xA3, 0x9E, 0xA0, 0xE1, 0x9D, 0xA4,
+    0x9E, 0x0A, 0xD1, 0x9D, 0xA5, 0xE1, 0x99, 0x19, 0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x59, 0xDA, 0x5E,
+    0x59, 0xDA, 0x4E, 0x95, 0x9D, 0xA2, 0x9E, 0xA6, 0x9F, 0xFC, 0xA7, 0x9F, 0xEA, 0x71, 0x9D, 0xA7,
+    0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x74, 0x9F, 0xEA, 0x71,
+    0xFF, 0xA6, 0x79, 0xAA, 0x97, 0x3A, 0xFD, 0x97, 0x0A, 0xDA, 0xAA, 0xE7, 0x9D, 0x92, 0x9C, 0x97,
+    0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0x9D, 0x92, 0x99, 0x70, 0x9D, 0x90, 0xAF, 0xC9, 0x59, 0xDA,
+    0xFF, 0x94, 0x9F, 0xA9, 0x09, 0xF4, 0x9E, 0x5E, 0xA3, 0x9D, 0x95, 0x9E, 0x39, 0xD9, 0x6E, 0x39,
+    0xD9, 0x6E, 0x39, 0xD9, 0x6E, 0x39, 0xD9, 0x6E, 0x39, 0xD9, 0x6D, 0xA3, 0x9D, 0x95, 0x9D, 0x93,
+    0x9D, 0x95, 0xE4, 0x9D, 0xA3, 0x9E, 0x94, 0x9F, 0xFD, 0x95, 0x9F, 0xFA, 0x79, 0xD9, 0x75, 0x9D,
+    0x97, 0x59, 0xD9, 0x75, 0x9D, 0x97, 0x5A, 0xDA, 0x97, 0x2F, 0xF9, 0x70, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x70, 0x3A, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA6, 0x9A, 0xFE, 0xA0, 0xFF, 0xDA, 0x09, 0x99,
+    0xE9, 0x99, 0x94, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xDA,
+    0x70, 0xDA, 0x70, 0xE7, 0x0E, 0x97, 0xFF, 0x93, 0xFE, 0x94, 0x99, 0x99, 0xD9, 0x70, 0xD7, 0x09,
+    0xD4, 0xA9, 0x1A, 0xCA, 0x39, 0xDA, 0xAD, 0x49, 0xFC, 0x96, 0xAA, 0xA3, 0x77, 0x4A, 0xFF, 0xFE,
+    0x90, 0xFF, 0xFF, 0xC9, 0xAD, 0xA3, 0xE3, 0x9D, 0x9E, 0x4E, 0x4D, 0x0A, 0xD9, 0x3E, 0x4D, 0x1E,
+    0x3E, 0x4A, 0x92, 0x99, 0x3E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x49, 0xAF, 0xE7, 0x09, 0xFF, 0xC4, 0x69, 0xAA, 0x97, 0x9F,
+    0xDA, 0x49, 0xEA, 0xAE, 0x4D, 0xA3, 0xD3, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xDA, 0x70, 0x9A, 0xFE,
+    0xA2, 0xFF, 0xDA, 0x29, 0x99, 0xE9, 0x99, 0x96, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72,
+    0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xE7, 0x2E, 0x97, 0x1F, 0xF9, 0x5F, 0xDA, 0x79,
+    0x99, 0x94, 0x77, 0x1A, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC, 0xAD, 0xA3, 0xE9, 0x3D, 0xAD, 0x93, 0xE9,
+    0x3D, 0x9D, 0x4E, 0x93, 0xAC, 0x99, 0xC4, 0xE9, 0x3A, 0xA7, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xAD, 0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x97, 0x59, 0xD9, 0x2A, 0x72, 0xE1, 0xAC, 0xA7,
+    0x19, 0xFE, 0x72, 0xAF, 0xCA, 0x74, 0xAA, 0xA9, 0x20, 0x77, 0x3A, 0xC9, 0x77, 0x3E, 0x77, 0x3E,
+    0x77, 0x2A, 0xDA, 0x9F, 0xF4, 0xFE, 0xA1, 0xFD, 0xA5, 0xAF, 0xA5, 0xE9, 0x70, 0x9D, 0x95, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xAD, 0x97, 0x09, 0xD6, 0xAD, 0x97, 0x0A, 0xD6, 0x9E,
+    0x70, 0xE7, 0xE9, 0x6A, 0xDA, 0x7A, 0xEA, 0x39, 0xAE, 0x71, 0xFF, 0xF7, 0x3A, 0xFF, 0xA7, 0x79,
+    0x99, 0x97, 0x10, 0x77, 0x77, 0x19, 0xD9, 0x77, 0xDA, 0x76, 0xAD, 0x90, 0xAF, 0x39, 0xAA, 0xF9,
+    0x0A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5,
+    0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59,
+    0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F,
+    0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x1A, 0x4D, 0xA3, 0xE9, 0x29, 0xE3, 0x9E, 0x4D, 0xA4,
+    0x90, 0x39, 0x3D, 0xA1, 0x9E, 0x1E, 0x1E, 0x90, 0x9D, 0x3A, 0x30, 0x74, 0x9D, 0xA5, 0xFA, 0x3A,
+    0xDA, 0xD9, 0x19, 0xD9, 0x0E, 0x1D, 0xA2, 0xD9, 0x9C, 0xA4, 0xC9, 0x72, 0xF2, 0xC9, 0x9F, 0xC9,
+    0xDA, 0xAC, 0xA0, 0xFC, 0x90, 0xC2, 0xAD, 0xA7, 0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFA,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0x71, 0x9C, 0x94, 0xA9, 0xAD, 0x92, 0xAC, 0x90, 0xFF, 0x2F, 0xCA,
+    0x59, 0x93, 0x0D, 0x9F, 0xF9, 0xD9, 0x09, 0x93, 0x99, 0x0E, 0xA1, 0xAF, 0xDA, 0x1A, 0xE9, 0xD3,
+    0xD9, 0x70, 0x9F, 0x90, 0x9F, 0xD9, 0xAC, 0xA1, 0xAD, 0x9C, 0x91, 0xAC, 0xA3, 0x9D, 0x29, 0xAD,
+    0x39, 0xCA, 0x5C, 0x92, 0x1A, 0xDA, 0x2F, 0xD0, 0x9C, 0xA1, 0xD9, 0xAC, 0x91, 0x9C, 0xAA, 0xCA,
+    0x19, 0xCA, 0x9D, 0x99, 0xD1, 0xAF, 0x93, 0x99, 0x20, 0x29, 0x39, 0x39, 0xCA, 0x19, 0xCA, 0x2E,
+    0x1E, 0x19, 0xD9, 0x09, 0xD9, 0x1D, 0xA1, 0xDA, 0x19, 0xD1, 0x9D, 0x3C, 0x3C, 0x30, 0x09, 0x59,
+    0x0A, 0xC9, 0x3D, 0x99, 0xD9, 0x1D, 0xA1, 0xAD, 0x0A, 0xD3, 0xFC, 0x94, 0xEA, 0x6A, 0xA3, 0x19,
+    0x39, 0x3A, 0xC9, 0x1A, 0xC9, 0x2E, 0x1E, 0x29, 0xD9, 0x09, 0xD9, 0x2A, 0xD1, 0xAD, 0x3D, 0x91,
+    0xD9, 0x3C, 0x3C, 0x00, 0x73, 0xAF, 0xA2, 0xFF, 0x09, 0xCA, 0x2A, 0xDA, 0xAC, 0x49, 0xC9, 0x71,
+    0x39, 0x29, 0xD2, 0xD2, 0xDA, 0x2D, 0x91, 0x9D, 0xA2, 0xE2, 0xAD, 0xA6, 0x5E, 0x1E, 0xA1, 0xDA,
+    0x1D, 0xA1, 0xD9, 0x0A, 0xD1, 0xD2, 0xA2, 0x5E, 0x0A, 0xE0, 0xAD, 0x1A, 0xD1, 0x9D, 0x2D, 0xA2,
+    0xD3, 0xA0, 0x0A, 0xA1, 0xDA, 0x0D, 0xA0, 0xD9, 0x0D, 0x1C, 0x91, 0xC5, 0x19, 0x2E, 0x1E, 0x1D,
+    0xA0, 0xAD, 0x1D, 0x2A, 0x30, 0x09, 0x90, 0xAF, 0xEA, 0xDA, 0x30, 0x71, 0xAD, 0x91, 0x9D, 0xAE,
+    0xA1, 0xAE, 0xAD, 0x91, 0x9D, 0xA7, 0x10, 0x29, 0x93, 0x9F, 0x91, 0xD1, 0xD1, 0xCA, 0x1A, 0xC1,
+    0xD1, 0xD1, 0x9F, 0x93, 0x99, 0x20, 0x19, 0x91, 0xAD, 0xA1, 0xE1, 0xE1, 0xD9, 0x0D, 0xA1, 0x99,
+    0x10, 0x09, 0xA9, 0x2F, 0x19, 0xAD, 0xA2, 0xD9, 0x1E, 0x1E, 0x29, 0x92, 0x39, 0x29, 0xD2, 0x9D,
+    0x3D, 0xA3, 0xE3, 0xAF, 0xC1, 0xAE, 0xA7, 0x09, 0x90, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D,
+    0x1A, 0xA0, 0x3A, 0xC9, 0x5F, 0xA3, 0xAD, 0xAD, 0x91, 0x9D, 0x90, 0xAD, 0x1D, 0x92, 0xAC, 0x90,
+    0x95, 0x90, 0x72, 0xC5, 0xA9, 0xAD, 0x39, 0xCA, 0x9E, 0xAA, 0xE1, 0x9F, 0xD9, 0x39, 0xAA, 0x92,
+    0x09, 0xAA, 0x92, 0xA1, 0xF9, 0x09, 0xC9, 0xAD, 0xAF, 0xCA, 0x9C, 0x90, 0x9F, 0x19, 0x3A, 0xA1,
+    0x9F, 0xFA, 0xAF, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x90, 0x73, 0xAF, 0xA2, 0xFF, 0x09, 0xCA, 0x2A,
+    0xDA, 0xAC, 0x49, 0xC9, 0x71, 0x69, 0xA7, 0x1D, 0xA7, 0x9D, 0x97, 0xE7, 0x9D, 0x70, 0xAC, 0x77,
+    0x2A, 0xA3, 0xAA, 0x2E, 0xA1, 0xAE, 0x1E, 0xA1, 0xAE, 0x19, 0xD3, 0xD9, 0x00, 0x0D, 0x29, 0xD2,
+    0x9D, 0x3F, 0x90, 0xAD, 0x90, 0x72, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A,
+    0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2,
+    0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF,
+    0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA,
+    0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x49, 0x99, 0x99,
+    0x5A, 0xFF, 0xE9, 0x29, 0xFC, 0xAA, 0xAF, 0xA4, 0xE3, 0x9E, 0x4E, 0x4A, 0xDA, 0x3E, 0x49, 0xDA,
+    0x3E, 0x5D, 0xA3, 0xE4, 0x9D, 0x93, 0xE4, 0xE4, 0xEA, 0xA9, 0x9A, 0xD5, 0xFF, 0xDA, 0x4E, 0xAA,
+    0xAA, 0xFC, 0x3E, 0x49, 0xE9, 0x2E, 0x59, 0xE2, 0xE6, 0xE2, 0xE6, 0xE2, 0xE5, 0x9E, 0x2E, 0x5E,
+    0xA2, 0xE3, 0x9F, 0x1A, 0xFF, 0xF1, 0xFF, 0xEA, 0x97, 0x72, 0x76, 0xAF, 0xFF, 0xCA, 0x9F, 0xFF,
+    0xCA, 0x2E, 0x49, 0xDA, 0x2E, 0x5D, 0x92, 0xE5, 0xD9, 0x2E, 0x5A, 0xC3, 0xE5, 0x99, 0x3E, 0x73,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x71, 0xAF,
+    0xE5, 0xFF, 0xC5, 0x71, 0x97, 0x79, 0xDA, 0x76, 0xF7, 0x59, 0xF7, 0x5F, 0xCA, 0x74, 0xD0, 0xE7,
+    0x3A, 0xCA, 0x0A, 0xD9, 0x72, 0xD9, 0x09, 0xDA, 0x71, 0x9D, 0x2E, 0x71, 0xDA, 0x2A, 0xD9, 0x79,
+    0xD3, 0x9E, 0x7A, 0xD4, 0xE7, 0xD9, 0x4A, 0xDA, 0x5A, 0xD6, 0xE5, 0xDA, 0x6E, 0x49, 0xD7, 0xAD,
+    0xA3, 0xE7, 0x0E, 0x3D, 0x97, 0x0E, 0x91, 0xAD, 0x97, 0x0A, 0xDA, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF,
+    0xFC, 0x00, 0x77, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93,
+    0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x77, 0x0F, 0xFF, 0xCA, 0x1F, 0xFF, 0xD1, 0xDA, 0x59, 0xE9, 0x09,
+    0xD6, 0xEA, 0x19, 0xCA, 0x59, 0xE3, 0xA9, 0x5E, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E,
+    0x97, 0x2A, 0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x69, 0xC2, 0xE7, 0xD1, 0xE9,
+    0x69, 0xD0, 0xAE, 0x39, 0x99, 0x9E, 0x0F, 0xFF, 0xDA, 0x0A, 0xFF, 0xFC, 0x97, 0x70, 0x77, 0x6A,
+    0xFE, 0x93, 0x9F, 0xF0, 0x9F, 0xD9, 0x5F, 0xDA, 0x93, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95,
+    0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE9, 0x99,
+    0x99, 0x99, 0x99, 0x9E, 0x95, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71,
+    0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95, 0xE7, 0x1A, 0xD9, 0x5E, 0x71, 0xAD, 0x95,
+    0xE7, 0x1A, 0xD9, 0x3A, 0xFD, 0x94, 0x9F, 0xDA, 0x0F, 0xF9, 0x39, 0xFF, 0x00, 0x79, 0x9A, 0xA9,
+    0x74, 0x9F, 0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7,
+    0x1A, 0xE2, 0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE2, 0x99, 0x99,
+    0x99, 0x92, 0xE0, 0xAD, 0xA1, 0xAF, 0xE2, 0xE0, 0xAD, 0xA1, 0xAF, 0xE2, 0xE0, 0xAE, 0x74, 0xE0,
+    0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79,
+    0xE4, 0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x70,
+    0xFF, 0xA9, 0xFD, 0xA3, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE3, 0xAF, 0xD9, 0xFF, 0xA0, 0x77, 0x4A, 0xFE, 0xA1, 0x9F, 0xE9, 0x09, 0xFD,
+    0xA3, 0x9F, 0xC9, 0x4E, 0x6E, 0xA6, 0xE5, 0xE9, 0x7E, 0x4E, 0x97, 0x0E, 0x3E, 0x72, 0xE1, 0x9E,
+    0x73, 0xE0, 0x9E, 0x74, 0xE9, 0xDA, 0x75, 0xFD, 0x76, 0xFE, 0x75, 0xE0, 0xEA, 0x74, 0xE1, 0xEA,
+    0x73, 0xE1, 0x9E, 0xA7, 0x2E, 0x29, 0xEA, 0x71, 0xE3, 0x9F, 0x70, 0xE4, 0x9F, 0x7E, 0x59, 0xF9,
+    0x3A, 0xFD, 0x93, 0x9F, 0xA1, 0xFF, 0x95, 0xFA, 0x77, 0x09, 0x99, 0x10, 0x72, 0x97, 0x71, 0xAD,
+    0x97, 0x70, 0xEA, 0x77, 0xAF, 0x77, 0xFC, 0x97, 0x59, 0xD0, 0xDA, 0x75, 0xDA, 0x0E, 0x75, 0xD1,
+    0xAD, 0x97, 0x3A, 0xD2, 0xE7, 0x3D, 0x92, 0xE7, 0x29, 0xD3, 0xAD, 0x97, 0x1D, 0xA3, 0x9E, 0x71,
+    0xD9, 0x4E, 0x70, 0xAD, 0x5A, 0xDA, 0x7D, 0xA5, 0x9E, 0x69, 0xD7, 0xE6, 0xE7, 0xAD, 0xA5, 0xD9,
+    0x79, 0xE4, 0xAD, 0x71, 0xE9, 0x19, 0xAF, 0xA9, 0x4A, 0xFD, 0x9F, 0xE9, 0x3F, 0xFA, 0x77, 0x73,
+    0xFD, 0xA7, 0x9F, 0xD3, 0x9F, 0xD7, 0xAF, 0xC9, 0x5A, 0xF9, 0x6F, 0xA7, 0xAC, 0xAD, 0xA5, 0x9F,
+    0xC7, 0xD9, 0xE5, 0xAC, 0x9E, 0x7D, 0x9A, 0xD5, 0xD0, 0xAD, 0x7D, 0x09, 0xD9, 0x39, 0xD0, 0xAD,
+    0x7D, 0x1E, 0x3A, 0xC9, 0x0A, 0xD7, 0xD1, 0xAD, 0x3D, 0x19, 0xD6, 0x9D, 0x19, 0xD9, 0x19, 0xCA,
+    0x19, 0xD9, 0x59, 0xD2, 0xDA, 0x1A, 0xC9, 0x19, 0xD9, 0x59, 0xD2, 0xAD, 0x1D, 0x3D, 0x95, 0xAC,
+    0xA3, 0xD9, 0x9C, 0xA3, 0xDA, 0x5A, 0xCA, 0x3D, 0xAD, 0x93, 0xDA, 0x5D, 0xA3, 0xAF, 0x4E, 0x5D,
+    0x94, 0xEA, 0x4E, 0x5D, 0x94, 0xE5, 0xE5, 0xD9, 0x49, 0xD5, 0xAD, 0x3A, 0xFC, 0xA3, 0x94, 0xAF,
+    0xD9, 0xAF, 0xE7, 0x09, 0xFE, 0xA0, 0x77, 0x5A, 0xFC, 0x7F, 0xF9, 0xAF, 0xC6, 0xAF, 0xCA, 0x3F,
+    0xA7, 0x0D, 0x5F, 0xC7, 0x0D, 0x5F, 0xD7, 0xD5, 0xD9, 0xAD, 0xA6, 0xD5, 0xD9, 0x0E, 0x95, 0xD5,
+    0xD9, 0x09, 0xE5, 0xD5, 0xD9, 0x1A, 0xDA, 0x4D, 0x5D, 0x92, 0xE9, 0x3D, 0x5D, 0x92, 0x9E, 0x3D,
+    0x5D, 0x93, 0xAE, 0x2D, 0x5D, 0x94, 0xE9, 0x1D, 0x5D, 0x95, 0xE1, 0xD5, 0xD9, 0x59, 0xE0, 0xD5,
+    0xD9, 0x6F, 0xD5, 0xD9, 0x7F, 0xC5, 0xD9, 0x79, 0xF3, 0xAF, 0xD6, 0xAE, 0x2F, 0xF7, 0xE7, 0x73,
+    0x93, 0x77, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xE1, 0xD7, 0x19,
+    0xD1, 0xD7, 0x19, 0xD1, 0xAC, 0x72, 0xC9, 0x77, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x7F, 0xFC,
+    0x7F, 0xFA, 0x77, 0x77, 0x77, 0x69, 0xC9, 0x72, 0xAC, 0x0A, 0xC9, 0x72, 0xAC, 0x9A, 0xCA, 0x72,
+    0xD9, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x9A, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x90, 0x79,
+    0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA,
+    0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7,
+    0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E,
+    0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9,
+    0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x77, 0x5A, 0xFF, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xFD, 0xA9, 0x3E, 0x70, 0xAD, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7,
+    0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA,
+    0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70,
+    0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x3A, 0xFD, 0x93, 0x9F,
+    0xE0, 0xFF, 0x93, 0xFF, 0x00, 0x39, 0x99, 0x99, 0x95, 0xAF, 0xFE, 0xA2, 0x9F, 0xCA, 0xAA, 0xFC,
+    0x93, 0xE3, 0x9F, 0x3E, 0x5E, 0x3E, 0x5A, 0xD9, 0x2E, 0x5A, 0xD9, 0x2E, 0x5A, 0xD9, 0x2E, 0x5E,
+    0x3E, 0x4A, 0xDA, 0x3E, 0x29, 0xAE, 0x4F, 0xFC, 0xA5, 0xFE, 0xA9, 0x6E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x2A, 0xFD, 0xA6, 0xFF, 0xC6, 0x77, 0x2F, 0xFF, 0xD1, 0x9F, 0xFF, 0xD2,
+    0xF6, 0xAD, 0x3E, 0xA6, 0xD4, 0xE9, 0x5D, 0x49, 0xE9, 0x49, 0xA5, 0xAE, 0x75, 0xAE, 0x75, 0xEA,
+    0x75, 0xE7, 0x5E, 0x74, 0xE7, 0x4E, 0x74, 0xE6, 0x94, 0xE9, 0x6D, 0x2E, 0x96, 0x9D, 0x1E, 0x97,
+    0xDA, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0xAA, 0xDA, 0x0F, 0xFF, 0xE9, 0x0A, 0xFF, 0xFD, 0x77, 0x10,
+    0x77, 0x1A, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC, 0xAD, 0xA3, 0xE9, 0x3D, 0xAD, 0x93, 0xE9, 0x3D, 0x9D,
+    0x4E, 0x93, 0xAC, 0x99, 0xC4, 0xE9, 0x3A, 0xA7, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x72,
+    0x9A, 0xFE, 0x97, 0xFF, 0xC9, 0x30, 0x39, 0x72, 0x99, 0x19, 0xEA, 0x70, 0xEA, 0xAF, 0xC9, 0x6A,
+    0xE9, 0x9A, 0xAF, 0x59, 0xE5, 0xE5, 0xE9, 0x5A, 0xDA, 0x39, 0xDA, 0x7E, 0x3E, 0x70, 0x9D, 0x91,
+    0x9D, 0x97, 0x1D, 0xA1, 0xE7, 0x2A, 0xD1, 0xD9, 0x73, 0xD9, 0xAD, 0x74, 0xDA, 0xD9, 0x74, 0x9F,
+    0x76, 0xEA, 0x76, 0xE9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x97, 0x39, 0xAF,
+    0xE9, 0x70, 0xFF, 0xC9, 0x30, 0x59, 0xFE, 0xA7, 0x39, 0xFD, 0xA9, 0x76, 0xE7, 0x71, 0xE7, 0x5A,
+    0xFF, 0xCA, 0x96, 0xFF, 0xCA, 0xFC, 0x93, 0xEA, 0x2E, 0x2A, 0xE9, 0x1E, 0x93, 0xE3, 0x9E, 0x09,
+    0xE4, 0xE4, 0xEA, 0xAD, 0x94, 0xE4, 0x9D, 0xAE, 0x94, 0xE4, 0x9F, 0xD9, 0x4E, 0x49, 0xDA, 0xAD,
+    0xA4, 0xE4, 0xAD, 0xA9, 0xE4, 0xE4, 0xE1, 0xAE, 0x3E, 0x29, 0xE9, 0x2A, 0xEA, 0x99, 0xE9, 0x9A,
+    0xE9, 0x49, 0xFF, 0xFA, 0x71, 0x99, 0xAE, 0xA9, 0x97, 0x6E, 0x77, 0x09, 0xE9, 0x97, 0x49, 0xFE,
+    0x97, 0x39, 0x99, 0x99, 0x99, 0x96, 0x77, 0x5F, 0xFA, 0x2F, 0xE1, 0x9F, 0xDA, 0x39, 0xAF, 0x93,
+    0x9E, 0x95, 0x9D, 0x96, 0xAE, 0x5D, 0xA7, 0x0F, 0x3E, 0x72, 0xE9, 0x1A, 0xD7, 0x39, 0xE0, 0x9D,
+    0x97, 0x4A, 0xFC, 0xA7, 0x6F, 0xC7, 0x79, 0xE9, 0x77, 0xFC, 0x76, 0xAF, 0xD7, 0x49, 0xD9, 0x0E,
+    0x97, 0x3D, 0xA1, 0x9E, 0x72, 0xE3, 0xAE, 0x70, 0xAD, 0x94, 0xEA, 0x69, 0xDA, 0x59, 0xE9, 0x5E,
+    0x7A, 0xE3, 0xAF, 0xCA, 0x39, 0xAF, 0xDA, 0xFF, 0x3F, 0xFA, 0x09, 0x97, 0x71, 0x99, 0x1E, 0x3F,
+    0xF3, 0xE1, 0xAD, 0xA2, 0xAF, 0xCA, 0x3A, 0xDA, 0x19, 0xE4, 0x9D, 0x94, 0xE3, 0xE4, 0x9D, 0x94,
+    0xE3, 0xE4, 0x9D, 0x94, 0xE3, 0xE9, 0x39, 0xD9, 0x39, 0xDA, 0x3A, 0xD9, 0x39, 0xD9, 0x39, 0xDA,
+    0x39, 0xDA, 0x39, 0xD9, 0x3A, 0xD9, 0x39, 0xE3, 0x9D, 0x93, 0xE5, 0xE3, 0x9D, 0x93, 0xE5, 0xAE,
+    0x29, 0xD9, 0x2E, 0x96, 0xF9, 0x09, 0xD9, 0x09, 0xEA, 0x70, 0xFF, 0xFC, 0xA7, 0x29, 0xAF, 0xFA,
+    0x77, 0x09, 0xD9, 0x77, 0x39, 0xD9, 0x77, 0x39, 0xD9, 0x77, 0x39, 0xD9, 0x77, 0x19, 0xAF, 0xCA,
+    0x77, 0xFF, 0x70, 0x79, 0xAA, 0xA9, 0x97, 0x49, 0xFF, 0xCA, 0x71, 0xAF, 0xCA, 0xAF, 0xC9, 0x6A,
+    0xE9, 0x5F, 0x94, 0x9E, 0x97, 0xAE, 0x4E, 0xA7, 0x1E, 0x93, 0xE7, 0x2A, 0xDA, 0x29, 0xE7, 0x29,
+    0xE2, 0x9E, 0x72, 0x9E, 0x2A, 0xE7, 0x29, 0xE2, 0x9E, 0x72, 0x9E, 0x3E, 0x72, 0xAD, 0xA3, 0xE9,
+    0x71, 0xE9, 0x39, 0xDA, 0x71, 0xE5, 0xE7, 0x0A, 0xD9, 0x6E, 0x69, 0xDA, 0x3A, 0xC1, 0x9D, 0xA5,
+    0xE1, 0xAC, 0x0D, 0x91, 0x9D, 0xA3, 0xE2, 0xD9, 0xDA, 0x91, 0x9D, 0x91, 0xE1, 0x99, 0xD9, 0xFF,
+    0xC9, 0x1F, 0xFC, 0x9A, 0xFF, 0x29, 0xFF, 0x90, 0x59, 0x97, 0x5F, 0xC9, 0x19, 0xD9, 0x4F, 0xE9,
+    0x0E, 0x4E, 0x91, 0xAD, 0x0E, 0x3A, 0xD9, 0x3A, 0xCA, 0xDA, 0x3E, 0x5F, 0x92, 0x9D, 0xA5, 0x9E,
+    0x39, 0xD9, 0x6E, 0x3A, 0xD9, 0x6A, 0xD3, 0xAD, 0x96, 0xE3, 0xAD, 0xA5, 0x9E, 0x39, 0xE5, 0xF4,
+    0xE4, 0x9F, 0x93, 0xAE, 0x29, 0xD0, 0xE4, 0xFF, 0x90, 0xFC, 0xA2, 0xAF, 0xC9, 0x19, 0xF5, 0x99,
+    0x95, 0x99, 0x10, 0x49, 0xAA, 0x97, 0x0A, 0xFD, 0xA5, 0xAE, 0xAA, 0xEA, 0x39, 0xDA, 0x29, 0xE3,
+    0xE4, 0xAD, 0x92, 0xDA, 0x4A, 0xD9, 0x19, 0xD9, 0x49, 0xD9, 0x19, 0xD9, 0x4A, 0xD2, 0xAD, 0x94,
+    0xDA, 0x2A, 0xD9, 0x39, 0xD3, 0xAD, 0x91, 0xF9, 0x3A, 0xD9, 0x09, 0xFC, 0xA2, 0xAD, 0x91, 0x99,
+    0xAE, 0xA1, 0xAD, 0x95, 0xE9, 0x0A, 0xD9, 0x59, 0xE0, 0xAD, 0x96, 0xE0, 0xAD, 0x96, 0xE0, 0xAD,
+    0x96, 0xE0, 0xAD, 0x96, 0xE0, 0xAD, 0x95, 0xE9, 0x0A, 0xDA, 0x39, 0xF1, 0xAF, 0xFE, 0x2A, 0xDA,
+    0xFD, 0x93, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xAA, 0x97, 0x30,
+    0x77, 0xAF, 0x6D, 0xA0, 0xFC, 0x95, 0xE2, 0xAE, 0x5E, 0x3E, 0x94, 0xE3, 0x9D, 0xA3, 0x9D, 0xA4,
+    0xE3, 0xAD, 0x94, 0xAD, 0x92, 0xAD, 0x6D, 0xA2, 0xDA, 0x6E, 0x19, 0xD7, 0x9D, 0x1A, 0xCA, 0x70,
+    0xD9, 0x0D, 0x71, 0xDA, 0xAC, 0xA7, 0x1A, 0xF7, 0x3E, 0x97, 0x3E, 0x74, 0xAC, 0x97, 0x4D, 0xA7,
+    0x4D, 0xA7, 0x39, 0xDA, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x39, 0xA9, 0x60, 0x59, 0xAA, 0xA9, 0x96,
+    0xAF, 0xF9, 0x3E, 0xAA, 0xAF, 0xC2, 0x9D, 0x94, 0xAC, 0xA2, 0x9D, 0x73, 0x9D, 0xA7, 0x3F, 0x73,
+    0xFA, 0x72, 0xFC, 0x96, 0x9F, 0xEA, 0x49, 0xDA, 0x19, 0xF3, 0xDA, 0x39, 0xEA, 0x1E, 0x59, 0xE1,
+    0xDA, 0x6E, 0xA9, 0xDA, 0x69, 0xDA, 0xAD, 0x96, 0x9E, 0xAD, 0x97, 0xDA, 0xAD, 0xA6, 0x9D, 0xA9,
+    0xE6, 0xAD, 0x90, 0xE9, 0x5E, 0x1A, 0xE9, 0x3E, 0x92, 0xAF, 0xAF, 0x94, 0xAF, 0xE9, 0x79, 0x99,
+    0x95, 0x59, 0x97, 0xAF, 0xDA, 0x3F, 0xFC, 0x91, 0xAD, 0x93, 0x9C, 0x2D, 0xA7, 0x1D, 0xA7, 0x1E,
+    0x71, 0x9F, 0xDA, 0x5A, 0xFD, 0x4A, 0xDA, 0x97, 0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0x9E,
+    0x93, 0x9A, 0xC1, 0xFF, 0xE2, 0xAF, 0xEA, 0x59, 0x99, 0x94, 0x75, 0xCA, 0x71, 0x9D, 0x59, 0xAA,
+    0x09, 0xFF, 0xDA, 0x09, 0xFF, 0xD3, 0x99, 0x91, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0x9D, 0xA7,
+    0x0E, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0E, 0x70, 0x9D, 0x97, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x09, 0xD9, 0x70, 0x9D, 0xA7, 0x09, 0xE7, 0x1E, 0x97, 0x0F, 0xC9, 0x7F, 0xFA, 0x4A, 0xFF, 0x59,
+    0x9A, 0xF7, 0x1E, 0x71, 0xDA, 0x71, 0xD7, 0x1A, 0xCA, 0x71, 0x99, 0x20, 0x71, 0x99, 0x4A, 0xE1,
+    0x9F, 0xCA, 0x1F, 0xC0, 0x9F, 0xEA, 0x2A, 0xD9, 0xDA, 0x1A, 0xE3, 0xFA, 0x3A, 0xD9, 0x2A, 0xE4,
+    0x9D, 0xA2, 0xAD, 0xA4, 0x9D, 0xA2, 0xAD, 0x95, 0xDA, 0x2A, 0xD9, 0x5D, 0xA2, 0xAD, 0x95, 0xDA,
+    0x2A, 0xD9, 0x5D, 0xA2, 0xAD, 0x95, 0xDA, 0x2A, 0xD9, 0x5D, 0xA2, 0xAD, 0x95, 0xDA, 0x2A, 0xD9,
+    0x5D, 0xA2, 0xAD, 0x6D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x73,
+    0x9D, 0xA7, 0x39, 0xA9, 0x00, 0x49, 0xAA, 0xA9, 0x70, 0xFE, 0x95, 0xEA, 0xAF, 0x93, 0xE3, 0x9E,
+    0x29, 0xD9, 0x4A, 0xDA, 0x1A, 0xD6, 0xE1, 0xDA, 0x6E, 0x1D, 0x96, 0xAD, 0x99, 0xD9, 0x69, 0xDA,
+    0x9D, 0x70, 0xDA, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xDA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xDA, 0xAD, 0x70, 0xDA, 0xAD, 0x97, 0xDA, 0x9D, 0x97, 0xD9, 0x0D, 0xA6, 0x9D, 0x90,
+    0xE6, 0xAD, 0x1A, 0xD9, 0x5E, 0x19, 0xE4, 0x9D, 0x92, 0xEA, 0x3E, 0x4F, 0xFC, 0x6A, 0xFC, 0xA7,
+    0x19, 0x99, 0x50, 0x79, 0xD9, 0x3A, 0xD9, 0x3A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x93, 0xAE, 0x39, 0xFD, 0xA0, 0xAF, 0xC2, 0x99, 0x92, 0x76,
+    0x9D, 0x94, 0x9E, 0x1A, 0xD9, 0x39, 0xF1, 0xAD, 0x92, 0x9E, 0xA2, 0xAD, 0x91, 0x9E, 0x4A, 0xD9,
+    0x1E, 0x5A, 0xD9, 0x0E, 0x6A, 0xD9, 0xAD, 0xA6, 0xAD, 0xAF, 0x6A, 0xF9, 0xD6, 0xAE, 0x90, 0xDA,
+    0x5A, 0xDA, 0x1A, 0xD5, 0xAD, 0x92, 0xE4, 0xAD, 0x92, 0xEA, 0x3A, 0xD4, 0xFE, 0xAD, 0x49, 0xFC,
+    0x97, 0x19, 0x99, 0x10, 0x2A, 0xA9, 0x74, 0xAF, 0xC7, 0x3C, 0xAF, 0xC7, 0x6E, 0x97, 0x59, 0xE7,
+    0x6E, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x59, 0xE7, 0x5A, 0xE9, 0x74, 0xFA, 0x73, 0xAC, 0xAE, 0x73,
+    0xD9, 0xAD, 0x72, 0x9D, 0x09, 0xDA, 0x71, 0xDA, 0x1E, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0xAD, 0x29,
+    0xD9, 0x7E, 0x3E, 0x6A, 0xD9, 0x3E, 0x6E, 0x4A, 0xD9, 0x4A, 0xDA, 0x49, 0xE9, 0x3E, 0x95, 0xFD,
+    0x0A, 0xDA, 0x69, 0xF9, 0x75, 0x93, 0x77, 0x2D, 0xA5, 0x9D, 0x93, 0xAD, 0xA5, 0xAD, 0x93, 0xAD,
+    0x95, 0xAD, 0x4A, 0xD9, 0x5A, 0xD4, 0xAD, 0x95, 0xAD, 0x4A, 0xD9, 0x5A, 0xD4, 0xAD, 0x95, 0xAD,
+    0x4A, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E, 0x4A, 0xDA, 0x49, 0xE9, 0x3A, 0xE4, 0xAE,
+    0xA3, 0xAF, 0x2A, 0xDA, 0xD9, 0x2A, 0xFF, 0xCA, 0x0F, 0xC9, 0xAC, 0xA9, 0xFC, 0xA1, 0xAF, 0x0A,
+    0xD1, 0x99, 0x94, 0x99, 0x2A, 0xD7, 0x6A, 0xD7, 0x6A, 0xD7, 0x6E, 0x97, 0x5E, 0x76, 0xAA, 0x97,
+    0x60, 0x77, 0xAF, 0x6D, 0xA0, 0xFC, 0x95, 0xE2, 0xAE, 0x5E, 0x3E, 0x94, 0xE3, 0x9D, 0xA3, 0x9D,
+    0xA4, 0xE3, 0xAD, 0x94, 0xAD, 0x92, 0xAD, 0x6D, 0xA2, 0xDA, 0x6E, 0x19, 0xD7, 0x9D, 0x1A, 0xCA,
+    0x70, 0xD9, 0x0D, 0x71, 0xDA, 0xAC, 0xA7, 0x1A, 0xF7, 0x3E, 0x97, 0x3E, 0x77, 0x50, 0x74, 0xCA,
+    0x70, 0x9D, 0x49, 0x9C, 0x99, 0xFF, 0xD9, 0x9F, 0xFC, 0x94, 0x9E, 0x95, 0xAD, 0xA6, 0x9D, 0x97,
+    0xE7, 0x0E, 0x70, 0xE7, 0x09, 0xE9, 0x79, 0xFD, 0x49, 0xFD, 0x3A, 0xDA, 0x99, 0x93, 0xAD, 0x97,
+    0xDA, 0x79, 0xD9, 0x7A, 0xD9, 0x7A, 0xDA, 0x79, 0xE9, 0x7F, 0xA9, 0x6A, 0xFE, 0xA3, 0x9F, 0xF5,
+    0x99, 0xF7, 0x0E, 0x70, 0xD9, 0x79, 0xD7, 0x0D, 0x97, 0x09, 0x91, 0x69, 0x97, 0x1A, 0xFD, 0x95,
+    0xFF, 0xCA, 0x3E, 0x92, 0xAE, 0xA1, 0xAD, 0x94, 0xAE, 0x1E, 0x6E, 0x99, 0xDA, 0x6A, 0xDA, 0x9D,
+    0x96, 0x9D, 0xAA, 0xD9, 0x69, 0xDA, 0xAD, 0x96, 0x9D, 0xAA, 0xDA, 0x69, 0xD9, 0x9E, 0x6A, 0xD1,
+    0xE9, 0x5D, 0xA1, 0xAE, 0x93, 0xE3, 0xFC, 0xAF, 0x94, 0xAF, 0xE7, 0x09, 0x99, 0x95, 0x77, 0x4F,
+    0xFF, 0xF9, 0x0A, 0xFF, 0xFF, 0x1E, 0xAE, 0xAA, 0xAA, 0xEA, 0xAA, 0x1C, 0xA1, 0x9D, 0x3D, 0x94,
+    0xA2, 0xAD, 0x3D, 0x71, 0xAC, 0xA3, 0xD7, 0x1D, 0xA3, 0xD7, 0x1D, 0xA3, 0xD7, 0x1D, 0xA2, 0x9D,
+    0x71, 0xD9, 0x29, 0xD7, 0x09, 0xD9, 0x29, 0xD9, 0x7A, 0xD9, 0x3D, 0xA7, 0xE4, 0xE9, 0x6E, 0x4F,
+    0xD9, 0x3D, 0xA5, 0xF9, 0x77, 0x30, 0x69, 0x97, 0x1A, 0xFD, 0xA5, 0xFF, 0xD3, 0xAD, 0xA3, 0xEA,
+    0x2E, 0x5E, 0x1A, 0xD9, 0x5A, 0xD9, 0x0A, 0xD6, 0xAD, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0,
+    0xE6, 0x9D, 0x90, 0xE6, 0xAD, 0x90, 0xE6, 0xE1, 0xE5, 0xAD, 0xA1, 0xE9, 0x3A, 0xE2, 0xFF, 0xE3,
+    0xEA, 0xFC, 0x94, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xA9, 0x73, 0x69, 0x97,
+    0x9F, 0xD9, 0x3F, 0xFC, 0x2E, 0x92, 0xEA, 0x0A, 0xD5, 0xDA, 0x0E, 0x5C, 0xA0, 0x9D, 0x97, 0x09,
+    0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0xA7, 0x09, 0xE7, 0x1E, 0xA7, 0x0A, 0xF9, 0x7A,
+    0xFE, 0x94, 0x9F, 0xEA, 0x69, 0xAF, 0x70, 0x9D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xD7, 0x29,
+    0x30, 0x77, 0x59, 0xAF, 0xFC, 0x92, 0xAF, 0xFF, 0x2A, 0xE9, 0x99, 0xE9, 0x9A, 0x91, 0x9D, 0xA4,
+    0xDA, 0x4E, 0x59, 0xD9, 0x29, 0xDA, 0x6E, 0x29, 0xD9, 0x6E, 0x2A, 0xD9, 0x6A, 0xD2, 0xAD, 0x96,
+    0xAD, 0x91, 0xAD, 0xA6, 0xE2, 0x9E, 0x6E, 0x3E, 0x94, 0x9D, 0xA3, 0xAE, 0x92, 0x9E, 0x5F, 0xCA,
+    0xF9, 0x6A, 0xFE, 0x72, 0x99, 0x99, 0x70, 0x77, 0x9F, 0xFF, 0x90, 0xFF, 0xFC, 0x90, 0xDA, 0xAA,
+    0xEA, 0xAA, 0xAA, 0x09, 0xC9, 0x2D, 0xA6, 0xA3, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x73,
+    0x9D, 0x73, 0x9D, 0x73, 0xAD, 0x97, 0x29, 0xDA, 0x72, 0x9E, 0x97, 0x2F, 0xE7, 0x9F, 0xCA, 0x71,
+    0x99, 0x93, 0x77, 0x0A, 0xF4, 0x9D, 0x19, 0xFC, 0x5E, 0x3E, 0x5E, 0x3D, 0xA5, 0xAD, 0x92, 0xDA,
+    0x5A, 0xDA, 0x2D, 0xA5, 0x9D, 0xA1, 0x9D, 0xA5, 0x9D, 0xA1, 0x9D, 0xA5, 0x9D, 0xA2, 0xE5, 0x9D,
+    0xA2, 0xE5, 0x9D, 0x92, 0xE5, 0xAD, 0x3A, 0xD9, 0x4E, 0x39, 0xE3, 0xAD, 0x94, 0xAF, 0xAE, 0xA6,
+    0xAF, 0xD9, 0x71, 0x99, 0x99, 0x40, 0x72, 0x97, 0x72, 0x9D, 0x97, 0x71, 0xAD, 0x77, 0x2A, 0xD7,
+    0x72, 0xAD, 0x77, 0x2A, 0xD9, 0x75, 0xAF, 0xFD, 0xA7, 0xAF, 0xFF, 0xD9, 0x4A, 0xE9, 0x1A, 0xD1,
+    0x9A, 0xEA, 0x2A, 0xDA, 0x3A, 0xD3, 0x9E, 0x2E, 0x4A, 0xD4, 0xAD, 0xA0, 0x9D, 0xA4, 0xAD, 0x5E,
+    0x09, 0xD9, 0x4A, 0xD5, 0xE0, 0xAD, 0x94, 0xAD, 0x5E, 0x0A, 0xD9, 0x4A, 0xD5, 0xE0, 0x9D, 0xA4,
+    0xAD, 0x5E, 0x1E, 0x4A, 0xD4, 0x9D, 0xA1, 0xF3, 0xAD, 0x4E, 0x3F, 0x91, 0xAD, 0x2A, 0xE9, 0x4F,
+    0xFF, 0xE9, 0x69, 0xFF, 0xEA, 0x74, 0x9E, 0x99, 0x77, 0x0A, 0xD7, 0x72, 0xAD, 0x77, 0x2A, 0xD7,
+    0x72, 0xAD, 0x77, 0x2A, 0xD7, 0x72, 0x99, 0x72, 0x77, 0x1A, 0xE9, 0x5E, 0x19, 0xFC, 0x4A, 0xDA,
+    0x4E, 0x4E, 0x59, 0xDA, 0x2A, 0xD7, 0xE2, 0xDA, 0x79, 0xD9, 0x0A, 0xD7, 0x1E, 0x0D, 0x97, 0x19,
+    0xDA, 0xD7, 0x3F, 0x74, 0xAD, 0xA7, 0x49, 0xDA, 0x74, 0xF7, 0x39, 0xFA, 0x72, 0xD9, 0xAD, 0x71,
+    0x9D, 0x1D, 0xA7, 0x0D, 0x91, 0xAD, 0x7A, 0xD2, 0x9D, 0xA5, 0x9D, 0xA3, 0xE5, 0xE4, 0x9D, 0xA3,
+    0xAD, 0xA5, 0xEA, 0x90, 0x9E, 0x6A, 0xF9, 0x0A, 0xC9, 0x7C, 0xAA, 0x90, 0x74, 0x97, 0x72, 0xE7,
+    0x72, 0xDA, 0x77, 0x2D, 0xA7, 0x72, 0xDA, 0x77, 0x2D, 0xA7, 0x0A, 0xF4, 0xDA, 0x3D, 0x90, 0xAF,
+    0xC4, 0xDA, 0x3A, 0xD3, 0xE4, 0xDA, 0x3A, 0xD9, 0x2D, 0xA4, 0xDA, 0x39, 0xDA, 0x2D, 0xA4, 0xDA,
+    0x4E, 0x2D, 0xA4, 0xDA, 0x4E, 0x19, 0xDA, 0x4D, 0xA4, 0xE1, 0x9D, 0xA4, 0xDA, 0x4E, 0x2E, 0x4D,
+    0xA4, 0xE2, 0xE4, 0xDA, 0x39, 0xDA, 0x2E, 0x93, 0xDA, 0x3E, 0x39, 0xE3, 0xDA, 0x2A, 0xDA, 0x4F,
+    0x91, 0xDA, 0x1A, 0xE6, 0xFF, 0xFD, 0x70, 0x9F, 0xFD, 0x97, 0x49, 0x9E, 0x97, 0x71, 0xDA, 0x77,
+    0x2D, 0xA7, 0x72, 0xDA, 0x77, 0x2D, 0xA7, 0x72, 0xDA, 0x77, 0x2A, 0x97, 0x00, 0x77, 0x69, 0xD7,
+    0x9D, 0x5D, 0x97, 0x0E, 0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0x97, 0x2E, 0x1E, 0x4D, 0xA3, 0xAD, 0x90,
+    0xE3, 0x9D, 0xA3, 0x9D, 0xA9, 0xDA, 0x4D, 0xA4, 0xE9, 0xDA, 0x4D, 0xA4, 0xE9, 0xDA, 0x4D, 0xA4,
+    0xE9, 0xDA, 0x4D, 0xA4, 0xE9, 0xE4, 0xE4, 0xDA, 0x0E, 0x39, 0xE3, 0x9D, 0x90, 0xAE, 0x2F, 0xA2,
+    0xE2, 0xFA, 0xDA, 0x0E, 0xAE, 0x93, 0xFC, 0xA1, 0x9F, 0xC9, 0x59, 0x99, 0x59, 0x99, 0x30, 0x72,
+    0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0,
+    0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD,
+    0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA,
+    0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x77, 0x77, 0x77, 0x59, 0x99, 0x77, 0x19, 0xE7, 0x71, 0xAE,
+    0x97, 0x70, 0x9E, 0x77, 0x29, 0x97, 0x20, 0x59, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A,
+    0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE,
+    0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD,
+    0x1F, 0x39, 0x99, 0x49, 0x77, 0x79, 0x97, 0x3E, 0xA7, 0x2E, 0xA7, 0x2A, 0xD9, 0x77, 0x40, 0x77,
+    0x74, 0x9F, 0xC9, 0x76, 0xEA, 0xE7, 0x59, 0xD1, 0x9D, 0x97, 0x5A, 0x91, 0xAD, 0x77, 0x1A, 0xD9,
+    0x77, 0x0D, 0xA7, 0x72, 0xD7, 0x77, 0x77, 0x39, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9,
+    0x77, 0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74,
+    0xDA, 0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09,
+    0xFF, 0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7,
+    0x0E, 0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF0, 0x77, 0x2A,
+    0xEA, 0x70, 0xFE, 0x69, 0xD1, 0x9D, 0x7C, 0xA2, 0xD7, 0x3D, 0xA7, 0x1A, 0xDA, 0x72, 0xD7, 0x4A,
+    0xA7, 0x77, 0x49, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C,
+    0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94,
+    0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20,
+    0x77, 0x77, 0x5C, 0x97, 0x72, 0xAD, 0x77, 0x19, 0xD9, 0x77, 0x1D, 0xA7, 0x5A, 0xD1, 0xC9, 0x75,
+    0xAF, 0x77, 0xAD, 0x9E, 0x75, 0x9D, 0x2A, 0xD7, 0x4A, 0xA4, 0xA9, 0x77, 0x19, 0x77, 0x29, 0xDA,
+    0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77, 0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9,
+    0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA, 0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9,
+    0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF, 0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E,
+    0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E, 0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F,
+    0xE9, 0x4F, 0xF0, 0x73, 0xA7, 0x4A, 0xCA, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xD7, 0x39, 0xC9, 0x69,
+    0xE9, 0x71, 0xFC, 0x97, 0xE9, 0xE9, 0x5E, 0x2E, 0x49, 0xD4, 0xD7, 0x77, 0x09, 0x97, 0x19, 0xFD,
+    0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5,
+    0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F,
+    0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x77, 0x77, 0x19, 0xC7, 0x73, 0xD9,
+    0x77, 0x2A, 0xD7, 0x73, 0xAC, 0xA7, 0x6A, 0xD1, 0xAA, 0x75, 0xAF, 0x77, 0xAD, 0x9E, 0x75, 0x9D,
+    0x2A, 0xD7, 0x4A, 0xA4, 0xA9, 0x77, 0x19, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77,
+    0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA,
+    0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF,
+    0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E,
+    0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF0, 0x79, 0x74, 0xD9,
+    0x73, 0xE7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAC, 0x79, 0xE1, 0x97, 0xFC, 0x70, 0xE9, 0xE6, 0xE2,
+    0xE4, 0x9D, 0x4D, 0x77, 0x70, 0x99, 0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4,
+    0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E,
+    0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99,
+    0x94, 0x92, 0x77, 0x77, 0x29, 0xEA, 0x77, 0x0D, 0x9D, 0x97, 0x7A, 0x90, 0xAC, 0xA7, 0x71, 0x9D,
+    0x74, 0xAA, 0xA1, 0x9C, 0xA7, 0x4A, 0xF1, 0x97, 0x4A, 0xD9, 0xE7, 0x59, 0xD2, 0xAD, 0x74, 0xAA,
+    0x4A, 0x97, 0x71, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0,
+    0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D,
+    0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19,
+    0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x70, 0x9A, 0xAA, 0x71, 0xAF, 0xC9,
+    0x7D, 0x1D, 0xA7, 0x09, 0x1D, 0x97, 0x19, 0xDA, 0x72, 0xD9, 0x6A, 0xAC, 0x90, 0x9A, 0x6F, 0xC9,
+    0x7A, 0xD9, 0xE9, 0x5A, 0xD9, 0x1A, 0xD4, 0x9D, 0x4A, 0xC7, 0x77, 0x09, 0x97, 0x19, 0xFD, 0x95,
+    0xFA, 0xF4, 0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF,
+    0xF3, 0x9F, 0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92,
+    0xFF, 0xAF, 0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x77, 0x74, 0xE9, 0x1A, 0x97, 0x4A, 0xFA,
+    0x9C, 0xA7, 0x4A, 0xC1, 0xF9, 0x77, 0x19, 0xA9, 0x77, 0x09, 0x99, 0x77, 0x1A, 0xF7, 0x79, 0xD9,
+    0xE7, 0x59, 0xD2, 0xAD, 0x74, 0xAA, 0x4A, 0x97, 0x71, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70,
+    0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2,
+    0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA,
+    0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6,
+    0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00,
+    0x2A, 0xCA, 0x29, 0x6F, 0xC1, 0xCA, 0x5D, 0x9F, 0xCA, 0x5C, 0x91, 0xF7, 0x49, 0x72, 0x9A, 0xA9,
+    0x71, 0xAF, 0xA7, 0xAD, 0x9E, 0xA5, 0xAD, 0x2A, 0xD9, 0x39, 0xD4, 0xAC, 0x77, 0x70, 0x99, 0x71,
+    0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19,
+    0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29,
+    0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99, 0x94, 0x92, 0x71, 0x97, 0x73, 0xE9, 0x77,
+    0x0F, 0xC9, 0x76, 0xE0, 0xAD, 0x97, 0x4A, 0xD2, 0xAD, 0x74, 0xD4, 0xAC, 0x77, 0x77, 0x79, 0x77,
+    0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77, 0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9,
+    0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA, 0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9,
+    0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF, 0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D,
+    0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E, 0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49,
+    0xFE, 0x0F, 0xE9, 0x4F, 0xF7, 0x77, 0x77, 0x75, 0x99, 0x97, 0x71, 0x9E, 0x77, 0x1A, 0xE9, 0x77,
+    0x09, 0xE7, 0x72, 0x99, 0x72, 0x77, 0x3E, 0x72, 0xAF, 0x71, 0xDA, 0xDA, 0x7E, 0x09, 0xD9, 0x5A,
+    0xD2, 0xAD, 0x5D, 0x4A, 0xA7, 0x77, 0x09, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4, 0xE9, 0x2A, 0xDA,
+    0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F, 0xCA, 0xAE, 0x3E,
+    0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF, 0xC1, 0xFD, 0x1F,
+    0x39, 0x99, 0x49, 0x77, 0x79, 0x97, 0x3E, 0xA7, 0x2E, 0xA7, 0x2A, 0xD9, 0x77, 0x40, 0x77, 0x77,
+    0x0A, 0xA7, 0x73, 0xD7, 0x72, 0xAD, 0x77, 0x2D, 0x77, 0xCA, 0x1A, 0x19, 0xC7, 0x4D, 0xA2, 0x9D,
+    0x74, 0xAF, 0xE7, 0x69, 0xFA, 0x77, 0x77, 0x71, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F,
+    0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7,
+    0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70,
+    0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA,
+    0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x77,
+    0x5A, 0xC9, 0x73, 0xDA, 0x72, 0xAD, 0x97, 0x19, 0xD9, 0x73, 0xC7, 0x1C, 0xA5, 0xC5, 0xDA, 0x3D,
+    0x5A, 0xFE, 0x96, 0xAF, 0xC9, 0x71, 0x99, 0x97, 0x77, 0x39, 0x97, 0x19, 0xFD, 0x95, 0xFA, 0xF4,
+    0xE9, 0x2A, 0xDA, 0x3E, 0x4D, 0xA3, 0x9C, 0x94, 0xE7, 0x3E, 0x71, 0x99, 0xE5, 0xAF, 0xF3, 0x9F,
+    0xCA, 0xAE, 0x3E, 0x93, 0xE2, 0xAD, 0x94, 0xE2, 0xAD, 0x94, 0xE2, 0x9E, 0x3F, 0x92, 0xFF, 0xAF,
+    0xC1, 0xFD, 0x1F, 0x39, 0x99, 0x49, 0x20, 0x77, 0x76, 0xC7, 0x73, 0xAD, 0x77, 0x3D, 0x97, 0x72,
+    0x9D, 0x77, 0xCA, 0x2A, 0x09, 0xC7, 0x4D, 0xA2, 0x9D, 0x74, 0xAF, 0xE7, 0x69, 0xFA, 0x77, 0x77,
+    0x71, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A,
+    0xD0, 0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72,
+    0xAD, 0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A,
+    0xFA, 0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x49, 0x74, 0xAC, 0x74, 0xE7, 0x3A, 0xD9, 0x73,
+    0xAD, 0x74, 0x9A, 0x70, 0xCA, 0x5C, 0x5D, 0xA3, 0xD5, 0xAF, 0xE9, 0x6A, 0xFC, 0x97, 0x19, 0x99,
+    0x77, 0x73, 0x99, 0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9,
+    0x4E, 0x73, 0xE7, 0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E,
+    0x2A, 0xD9, 0x4E, 0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99, 0x94, 0x92, 0x77,
+    0x75, 0x9E, 0xA7, 0x70, 0xD9, 0xD9, 0x77, 0xA9, 0x0A, 0xC9, 0x77, 0x1A, 0xCA, 0x77, 0x19, 0xC9,
+    0x77, 0xAC, 0x1A, 0x1A, 0xC7, 0x4A, 0xD9, 0x99, 0xD9, 0x75, 0xFD, 0xA7, 0x79, 0xAA, 0x97, 0x74,
+    0x97, 0x72, 0x9D, 0xA7, 0x71, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x77, 0xD0, 0xE7, 0x6A, 0xD0,
+    0xAD, 0x97, 0x5D, 0x91, 0xE7, 0x49, 0xD2, 0xE7, 0x4D, 0xA2, 0xAD, 0xA7, 0x3D, 0x4E, 0x72, 0xAD,
+    0x4E, 0x97, 0x1E, 0x99, 0x99, 0x9A, 0xDA, 0x70, 0x9F, 0xFF, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x69, 0xD9, 0x69, 0xE6, 0xAD, 0x70, 0xE6, 0xDA, 0x70, 0xEA, 0x4A, 0xD7, 0x19, 0xE2, 0x9A, 0xFA,
+    0x94, 0x9F, 0xE0, 0xFE, 0x94, 0xFF, 0x00, 0x59, 0x97, 0x2F, 0xC9, 0x7A, 0xD9, 0xAD, 0x79, 0xC1,
+    0x9D, 0x73, 0xD9, 0x71, 0xAD, 0x97, 0x29, 0xC9, 0x70, 0xCA, 0x5C, 0x5D, 0xA3, 0xD5, 0xAF, 0xE9,
+    0x6A, 0xFC, 0x97, 0x19, 0x99, 0x77, 0x73, 0x99, 0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD,
+    0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3,
+    0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1,
+    0xF3, 0x99, 0x94, 0x92, 0x77, 0x74, 0xEA, 0x19, 0xA7, 0x49, 0xFC, 0x9D, 0x74, 0x9C, 0x1F, 0xA7,
+    0x59, 0x29, 0xA9, 0x76, 0x95, 0xA9, 0x73, 0xAC, 0xA3, 0xAC, 0x97, 0x3A, 0xEA, 0xF7, 0x5A, 0xFC,
+    0xA7, 0x71, 0x99, 0x77, 0x49, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9, 0x77, 0xAF, 0xA7,
+    0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74, 0xDA, 0x2A, 0xDA,
+    0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09, 0xFF, 0xF7, 0x0E,
+    0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7, 0x0E, 0xA4, 0xAD,
+    0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF0, 0x2A, 0xA9, 0x29, 0x6A, 0xEA,
+    0x1C, 0x95, 0xDA, 0xFC, 0x95, 0xC9, 0x1F, 0x73, 0x99, 0x7C, 0x59, 0xC4, 0x9D, 0x39, 0xD5, 0xFF,
+    0x95, 0x9F, 0xD9, 0x71, 0x99, 0x77, 0x74, 0x99, 0x71, 0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD,
+    0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19, 0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3,
+    0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29, 0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1,
+    0xF3, 0x99, 0x94, 0x92, 0x77, 0x73, 0xCA, 0x5C, 0x73, 0x9D, 0xA2, 0x9D, 0x74, 0xFF, 0x97, 0x5A,
+    0xFC, 0x97, 0x70, 0x99, 0x97, 0x77, 0x77, 0x29, 0x77, 0x29, 0xDA, 0x77, 0x1F, 0x77, 0x09, 0xF9,
+    0x77, 0xAF, 0xA7, 0x7D, 0x0E, 0x76, 0xAD, 0x0A, 0xD9, 0x75, 0xD9, 0x1E, 0x74, 0x9D, 0x2E, 0x74,
+    0xDA, 0x2A, 0xDA, 0x73, 0xD4, 0xE7, 0x2A, 0xD4, 0xE9, 0x71, 0xE9, 0x99, 0x99, 0xAD, 0xA7, 0x09,
+    0xFF, 0xF7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAE, 0x96, 0x9D, 0x96, 0x9E, 0x6A, 0xD7, 0x0E, 0x6D, 0xA7,
+    0x0E, 0xA4, 0xAD, 0x71, 0x9E, 0x29, 0xAF, 0xA9, 0x49, 0xFE, 0x0F, 0xE9, 0x4F, 0xF7, 0x77, 0x77,
+    0x75, 0x99, 0x97, 0x71, 0x9E, 0x77, 0x1A, 0xE9, 0x77, 0x09, 0xE7, 0x72, 0x99, 0x72, 0x77, 0x0D,
+    0x49, 0xC5, 0xDA, 0x29, 0xD5, 0xAF, 0xE9, 0x6A, 0xFC, 0x97, 0x19, 0x99, 0x77, 0x73, 0x99, 0x71,
+    0x9F, 0xD9, 0x5F, 0xAF, 0x4E, 0x92, 0xAD, 0xA3, 0xE4, 0xDA, 0x39, 0xC9, 0x4E, 0x73, 0xE7, 0x19,
+    0x9E, 0x5A, 0xFF, 0x39, 0xFC, 0xAA, 0xE3, 0xE9, 0x3E, 0x2A, 0xD9, 0x4E, 0x2A, 0xD9, 0x4E, 0x29,
+    0xE3, 0xF9, 0x2F, 0xFA, 0xFC, 0x1F, 0xD1, 0xF3, 0x99, 0x94, 0x97, 0x77, 0x99, 0x73, 0xEA, 0x72,
+    0xEA, 0x72, 0xAD, 0x97, 0x74, 0x77, 0x0A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93,
+    0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE,
+    0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99,
+    0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x77, 0x77, 0x71, 0x99, 0x75, 0x9E, 0x74, 0xAE, 0x97,
+    0x39, 0xE7, 0x59, 0x97, 0x59, 0x97, 0x9F, 0xDA, 0x39, 0xFF, 0xA1, 0x9D, 0xA3, 0xE9, 0x0E, 0x49,
+    0xDA, 0x9D, 0x95, 0xEA, 0xD9, 0x5E, 0xAF, 0xFF, 0xFF, 0xFA, 0xE7, 0x1A, 0xD7, 0x1A, 0xD9, 0x70,
+    0x9E, 0x71, 0xFA, 0x39, 0xA9, 0x1F, 0xFD, 0x92, 0xAF, 0xEA, 0x59, 0x99, 0x97, 0x76, 0x99, 0x71,
+    0xAE, 0x70, 0xF7, 0x0A, 0xDA, 0x77, 0x00, 0x77, 0x59, 0xFC, 0x71, 0x9E, 0xAE, 0x70, 0xAC, 0xA1,
+    0xAD, 0x71, 0xA2, 0xAD, 0x74, 0xAD, 0x73, 0x9D, 0x97, 0x5C, 0xA7, 0x77, 0x77, 0x1A, 0xFF, 0xFD,
+    0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79,
+    0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x77,
+    0x09, 0xF9, 0x59, 0xFD, 0x94, 0xAC, 0xA1, 0xAD, 0x49, 0xC9, 0x1A, 0xCA, 0x70, 0x9D, 0x79, 0xAD,
+    0x70, 0x9C, 0xA7, 0x2C, 0x97, 0x77, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90,
+    0xE4, 0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD,
+    0x97, 0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x77,
+    0x4A, 0xE2, 0xC9, 0x69, 0xFC, 0x9A, 0xD6, 0x9D, 0x9A, 0xFA, 0x7C, 0x91, 0xAE, 0x77, 0x77, 0x77,
+    0x7A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF,
+    0xEA, 0x00, 0x77, 0xF2, 0xC9, 0x29, 0xFC, 0x9D, 0xA2, 0xAC, 0xA0, 0xFC, 0x93, 0xC2, 0xAD, 0xA7,
+    0x77, 0x71, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D, 0xA9, 0xD9,
+    0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1F,
+    0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x77, 0x75, 0x9C, 0x76, 0xDA,
+    0x74, 0x9D, 0x97, 0x4D, 0x97, 0x0D, 0xA1, 0xC9, 0x70, 0xFC, 0x72, 0xAD, 0x9E, 0x70, 0xAD, 0x2D,
+    0xA7, 0xAA, 0x4A, 0x77, 0x5A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D, 0x93, 0xE6, 0xAC,
+    0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFD,
+    0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4, 0x99, 0xAD, 0x1A,
+    0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x73, 0x99, 0x74, 0xD9, 0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x2A,
+    0xCA, 0x73, 0xAC, 0x7A, 0xDA, 0x71, 0xAF, 0xC7, 0x9D, 0xA9, 0xE5, 0x9D, 0xA1, 0x9D, 0x94, 0xDA,
+    0x39, 0xC9, 0x77, 0x79, 0x97, 0x19, 0xFD, 0xA5, 0x9F, 0xFA, 0x39, 0xDA, 0x3E, 0x92, 0xE4, 0x9D,
+    0xA1, 0x9D, 0x95, 0xE1, 0xAD, 0x95, 0xE1, 0xAF, 0xFF, 0x1F, 0xFF, 0xA1, 0xE7, 0x3A, 0xD7, 0x3A,
+    0xD9, 0x72, 0x9E, 0x73, 0xFA, 0x39, 0xA9, 0x3F, 0xFD, 0x94, 0xAF, 0xEA, 0x79, 0x99, 0x95, 0x77,
+    0x72, 0xAA, 0x75, 0x9D, 0x76, 0xE7, 0x6D, 0x97, 0x1D, 0xA1, 0xA9, 0x70, 0xFC, 0x72, 0xAD, 0x9E,
+    0x70, 0xAD, 0x2D, 0xA7, 0xAA, 0x4A, 0x77, 0x5A, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xD9, 0x3E, 0x6D,
+    0x93, 0xE6, 0xAC, 0x93, 0xE6, 0x9C, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE1, 0x99, 0x99, 0x99, 0x5F,
+    0xFE, 0x5F, 0xFD, 0x95, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x79, 0xA3, 0xE7, 0xD3, 0xE7, 0xD3, 0xE4,
+    0x99, 0xAD, 0x1A, 0xFF, 0xFD, 0x0F, 0xFF, 0xEA, 0x00, 0x79, 0x97, 0x19, 0xD7, 0x19, 0xD9, 0x71,
+    0xE7, 0x2D, 0x97, 0x2C, 0xA5, 0xAD, 0xA7, 0x9F, 0xA5, 0x9D, 0xA9, 0xDA, 0x39, 0xDA, 0x19, 0xD9,
+    0x2D, 0xA3, 0x9C, 0x97, 0x73, 0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4,
+    0x9D, 0xA9, 0xD9, 0x5E, 0xAD, 0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97,
+    0x09, 0xE7, 0x1F, 0xA3, 0x9A, 0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x30, 0x77, 0x73,
+    0xAE, 0xA7, 0x29, 0xCA, 0x9D, 0x97, 0x2A, 0x1A, 0xC9, 0x74, 0xAC, 0xA7, 0xAA, 0xA1, 0xAC, 0x97,
+    0xFC, 0x1A, 0x7A, 0xD9, 0xE7, 0x0A, 0xD2, 0xDA, 0x7A, 0xA4, 0xA7, 0x75, 0xAF, 0xFF, 0xD9, 0x09,
+    0xFF, 0xFD, 0x93, 0xE6, 0xD9, 0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x19, 0x99, 0x99, 0x95, 0xFF, 0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E,
+    0x7D, 0x3E, 0x7D, 0x3E, 0x49, 0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x71, 0x9A, 0xA9,
+    0x72, 0xFD, 0x70, 0x9C, 0xA1, 0xD7, 0x19, 0x19, 0xD7, 0x3A, 0xD9, 0x72, 0x9D, 0x79, 0xAC, 0xA1,
+    0xA9, 0x69, 0xFC, 0x71, 0xE9, 0xE7, 0xE2, 0xDA, 0x5A, 0xCA, 0x4C, 0xA7, 0x77, 0x19, 0x97, 0x29,
+    0xFD, 0xA6, 0x9F, 0xFA, 0x49, 0xDA, 0x3E, 0x93, 0xE4, 0x9D, 0xA2, 0x9D, 0x95, 0xE2, 0xAD, 0x95,
+    0xE2, 0xAF, 0xFF, 0x2F, 0xFF, 0xA2, 0xE7, 0x4A, 0xD7, 0x4A, 0xD9, 0x73, 0x9E, 0x74, 0xFA, 0x39,
+    0xA9, 0x4F, 0xFD, 0x95, 0xAF, 0xEA, 0x70, 0x99, 0x99, 0x60, 0x77, 0x49, 0xE2, 0xC9, 0x7F, 0xC9,
+    0x9C, 0x97, 0xCA, 0x09, 0xF7, 0x5A, 0xA9, 0x73, 0x99, 0x97, 0x4A, 0xEA, 0x72, 0xAD, 0x9D, 0xA7,
+    0x0A, 0xD2, 0xDA, 0x7A, 0xA4, 0xA7, 0x75, 0xAF, 0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9,
+    0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF,
+    0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49,
+    0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA0, 0x29, 0xCA, 0x92, 0x94, 0xFA, 0x09, 0xC3, 0x9C,
+    0xA9, 0xFC, 0x39, 0xC1, 0x9E, 0xA7, 0x19, 0x97, 0x0A, 0xAA, 0x70, 0xFC, 0x6E, 0x9E, 0x4D, 0xA2,
+    0xE2, 0xAC, 0xA4, 0xCA, 0x77, 0x39, 0x97, 0x9F, 0xDA, 0x39, 0xFF, 0xA1, 0x9D, 0xA3, 0xE9, 0x0E,
+    0x49, 0xDA, 0x9D, 0x95, 0xEA, 0xD9, 0x5E, 0xAF, 0xFF, 0xFF, 0xFA, 0xE7, 0x1A, 0xD7, 0x1A, 0xD9,
+    0x70, 0x9E, 0x71, 0xFA, 0x39, 0xA9, 0x1F, 0xFD, 0x92, 0xAF, 0xEA, 0x59, 0x99, 0x93, 0x79, 0x75,
+    0x9E, 0x97, 0x3F, 0xC9, 0x71, 0xE0, 0xE7, 0x0E, 0x2E, 0x69, 0xCA, 0x4A, 0xA7, 0x77, 0x75, 0xAF,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x93, 0xE6, 0xD9, 0x3E, 0x6A, 0xC9, 0x3E, 0x69, 0xC4, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x19, 0x99, 0x99, 0x95, 0xFF, 0xE5, 0xFF, 0xD9, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x9A, 0x3E, 0x7D, 0x3E, 0x7D, 0x3E, 0x49, 0x9A, 0xD1, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0xA7,
+    0x77, 0x77, 0x19, 0x97, 0x59, 0xE7, 0x4A, 0xE9, 0x73, 0x9E, 0x75, 0x99, 0x70, 0x77, 0x19, 0xDA,
+    0x70, 0xFA, 0x6A, 0xDA, 0xD9, 0x49, 0xD9, 0x0E, 0x4D, 0xA2, 0xD9, 0x29, 0xCA, 0x4C, 0x97, 0x73,
+    0x99, 0x79, 0xFD, 0xA3, 0x9F, 0xFA, 0x19, 0xDA, 0x3E, 0x90, 0xE4, 0x9D, 0xA9, 0xD9, 0x5E, 0xAD,
+    0x95, 0xEA, 0xFF, 0xFF, 0xFF, 0xAE, 0x71, 0xAD, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1F, 0xA3, 0x9A,
+    0x91, 0xFF, 0xD9, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x77, 0x69, 0x97, 0x1A, 0xE7, 0x0F, 0x70, 0xAD,
+    0xA7, 0x70, 0x71, 0x9F, 0xC9, 0x1E, 0xAE, 0x09, 0xD1, 0x9D, 0x90, 0xA9, 0x19, 0xD4, 0xAD, 0x93,
+    0xDA, 0x5D, 0x77, 0x5F, 0xFA, 0x9F, 0xDA, 0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x3A, 0xFD, 0x9F, 0xFA, 0x73, 0x9F, 0x92, 0xAF, 0xD2,
+    0xD9, 0x1D, 0xA1, 0xAC, 0x2D, 0x95, 0xAD, 0x49, 0xDA, 0x5A, 0xC9, 0x69, 0xC7, 0x77, 0x19, 0xAE,
+    0x92, 0x9F, 0xC9, 0x49, 0xE9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x39, 0xAF, 0xCA, 0x1F, 0xF0, 0x70, 0xFF,
+    0xA9, 0xFD, 0xA3, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE3, 0xAF, 0xD9, 0xFF, 0xA7, 0x74, 0x99, 0x94, 0x9E, 0x93, 0xAE, 0x93, 0x9E, 0x69,
+    0x30, 0x74, 0xE9, 0x49, 0xEA, 0x5E, 0xA5, 0x9A, 0xA7, 0x77, 0x72, 0x9A, 0xE9, 0x29, 0xFC, 0x94,
+    0x9E, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95,
+    0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93, 0x9A, 0xFC, 0xA1, 0xFF, 0x77, 0x70, 0x99, 0x6A, 0xDA, 0x5F,
+    0x5A, 0xD9, 0x74, 0x79, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A,
+    0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E,
+    0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09,
+    0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E,
+    0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x77, 0x76,
+    0x99, 0x77, 0x19, 0xE7, 0x70, 0xAE, 0x97, 0x79, 0xE7, 0x71, 0x99, 0x71, 0x69, 0x97, 0x2A, 0xFD,
+    0xA6, 0xFF, 0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD,
+    0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2,
+    0xAE, 0x93, 0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x97, 0x77, 0x59, 0x97,
+    0x49, 0xE7, 0x3A, 0xE7, 0x39, 0xE7, 0x75, 0x77, 0x73, 0x9F, 0xC7, 0x59, 0xEA, 0xE7, 0x49, 0xCA,
+    0x19, 0xD7, 0x5A, 0x91, 0xAD, 0x77, 0x0A, 0xD7, 0x79, 0xD9, 0x77, 0x1C, 0xA7, 0x77, 0x76, 0x99,
+    0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2,
+    0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74,
+    0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7,
+    0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95,
+    0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x77, 0x4A, 0xEA, 0x71, 0xAF, 0xD7,
+    0x0D, 0x2D, 0x97, 0xAC, 0x2D, 0x97, 0x3A, 0xD7, 0x2A, 0xDA, 0x73, 0xD7, 0x59, 0xC7, 0x77, 0x69,
+    0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4, 0xE9, 0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD,
+    0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA,
+    0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD, 0xA3, 0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96,
+    0x77, 0x77, 0x4C, 0x77, 0x2D, 0xA7, 0x70, 0x9D, 0x97, 0x70, 0xD9, 0x74, 0xAD, 0x1C, 0x97, 0x4F,
+    0xC7, 0x6A, 0xD9, 0xE7, 0x4A, 0xD2, 0xAC, 0xA7, 0x3A, 0xA4, 0xA7, 0x69, 0x9A, 0xA9, 0x74, 0x9F,
+    0xFC, 0x97, 0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2,
+    0xAD, 0xA7, 0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74,
+    0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA,
+    0x72, 0xE9, 0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70,
+    0xAF, 0xFA, 0x74, 0x99, 0x99, 0x97, 0x00, 0x74, 0xA7, 0x59, 0xD7, 0x4E, 0x73, 0x9D, 0x74, 0xD9,
+    0x74, 0xC9, 0x70, 0xE9, 0x72, 0xFC, 0x97, 0x0A, 0xD9, 0xE9, 0x6A, 0xD9, 0x1A, 0xD6, 0xD4, 0xAC,
+    0x77, 0x72, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F, 0x2E, 0x6E, 0x91, 0xDA, 0x6A,
+    0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9, 0x7E, 0x0A, 0xD9, 0x7E, 0x0A,
+    0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA, 0xAE, 0xA5, 0xAF, 0xE9, 0x70,
+    0x99, 0x99, 0x60, 0x77, 0x77, 0x0A, 0xA7, 0x72, 0xD9, 0x77, 0x1A, 0xD7, 0x72, 0xAC, 0x97, 0x5A,
+    0xD1, 0xAA, 0x74, 0xFC, 0x76, 0xAD, 0x9E, 0x74, 0xAD, 0x2A, 0xCA, 0x73, 0xAA, 0x4A, 0x76, 0x99,
+    0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70, 0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2,
+    0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72, 0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74,
+    0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7,
+    0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91, 0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95,
+    0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x70, 0x97, 0x5A, 0xCA, 0x74, 0xE7,
+    0x5D, 0xA7, 0x49, 0xD7, 0x59, 0xC9, 0x70, 0xE9, 0x09, 0x70, 0xFC, 0x97, 0x0A, 0xD9, 0xE9, 0x6A,
+    0xD9, 0x1A, 0xD6, 0xD4, 0xAC, 0x77, 0x72, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F,
+    0x2E, 0x6E, 0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9,
+    0x7E, 0x0A, 0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA,
+    0xAE, 0xA5, 0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x77, 0x77, 0x19, 0xEA, 0x77, 0xD9, 0xD9, 0x76,
+    0xA9, 0x0A, 0xC9, 0x77, 0x0A, 0xCA, 0x73, 0xAA, 0xA1, 0x9C, 0xA7, 0x3A, 0xF1, 0xA7, 0x3A, 0xD9,
+    0xE7, 0x4A, 0xD2, 0xAC, 0xA7, 0x3A, 0xA4, 0xA9, 0x75, 0x99, 0xAA, 0x97, 0x49, 0xFF, 0xC9, 0x70,
+    0xAF, 0xCA, 0xFD, 0x6F, 0x94, 0xAF, 0x4A, 0xE7, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x2A, 0xDA, 0x72,
+    0xEA, 0x1E, 0x73, 0xAE, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x74, 0xE0, 0xAD, 0xA7, 0x4E, 0x0A, 0xDA,
+    0x74, 0xE0, 0xAE, 0x74, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x3A, 0xDA, 0x1E, 0xA7, 0x2E, 0x91,
+    0xAE, 0x71, 0xAE, 0x3F, 0x79, 0xE4, 0x9F, 0x94, 0xAE, 0x95, 0x9F, 0xFF, 0x97, 0x0A, 0xFF, 0xA7,
+    0x49, 0x99, 0x99, 0x70, 0x72, 0xAA, 0xA9, 0x71, 0x9F, 0xC9, 0x70, 0xD9, 0x0A, 0xD7, 0x19, 0x1A,
+    0xCA, 0x72, 0x9A, 0xD7, 0x3A, 0xC9, 0x7A, 0xAC, 0x91, 0xA7, 0xAF, 0xA7, 0x0A, 0xD9, 0xAD, 0xA6,
+    0x9D, 0x91, 0xAD, 0x95, 0xD9, 0x3A, 0xC7, 0x77, 0x29, 0x97, 0x2A, 0xFD, 0xA6, 0xFF, 0xD4, 0xE9,
+    0x29, 0xF2, 0xE6, 0xE9, 0x1D, 0xA6, 0xAD, 0xA0, 0xAD, 0x97, 0xE0, 0xAD, 0x70, 0xE0, 0xE7, 0x0E,
+    0x0E, 0x97, 0xE0, 0xAD, 0x97, 0xE0, 0xAE, 0x69, 0xDA, 0x1E, 0x95, 0xE2, 0xAE, 0x93, 0xAD, 0xA3,
+    0xFC, 0xAA, 0xEA, 0x5A, 0xFE, 0x97, 0x09, 0x99, 0x96, 0x77, 0x72, 0x9E, 0x91, 0xA9, 0x73, 0xFC,
+    0x99, 0xCA, 0x73, 0xCA, 0x09, 0xF9, 0x77, 0x09, 0xA9, 0x77, 0x99, 0x97, 0x70, 0xAF, 0x76, 0xAD,
+    0x9E, 0x74, 0xAD, 0x2A, 0xCA, 0x73, 0xAA, 0x4A, 0x97, 0x59, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97,
+    0x0A, 0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7,
+    0x2E, 0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD,
+    0xA7, 0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9,
+    0x1A, 0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA,
+    0x74, 0x99, 0x99, 0x97, 0x00, 0x3A, 0xCA, 0x29, 0x7A, 0xF1, 0xD6, 0xD9, 0xAF, 0xA6, 0xAA, 0x1A,
+    0xE9, 0x74, 0x97, 0x39, 0xAA, 0x97, 0x2A, 0xFA, 0x70, 0x9D, 0x9A, 0xE6, 0x9D, 0x91, 0x9D, 0xA5,
+    0xD9, 0x39, 0xC9, 0x77, 0x71, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F, 0x2E, 0x6E,
+    0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9, 0x7E, 0x0A,
+    0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA, 0xAE, 0xA5,
+    0xAF, 0xE9, 0x70, 0x99, 0x99, 0x60, 0x71, 0x97, 0x72, 0xE9, 0x77, 0xFC, 0x97, 0x5E, 0x0E, 0x97,
+    0x3E, 0x2A, 0xD7, 0x3C, 0xA4, 0xAA, 0x77, 0x77, 0x29, 0x9A, 0xA9, 0x74, 0x9F, 0xFC, 0x97, 0x0A,
+    0xFC, 0xAF, 0xD6, 0xF9, 0x4A, 0xF4, 0xAE, 0x79, 0xEA, 0x29, 0xE7, 0x1A, 0xE2, 0xAD, 0xA7, 0x2E,
+    0xA1, 0xE7, 0x3A, 0xE0, 0x9E, 0x73, 0x9E, 0x09, 0xE7, 0x4E, 0x0A, 0xDA, 0x74, 0xE0, 0xAD, 0xA7,
+    0x4E, 0x0A, 0xE7, 0x4E, 0x09, 0xE7, 0x39, 0xE0, 0x9E, 0x73, 0xAD, 0xA1, 0xEA, 0x72, 0xE9, 0x1A,
+    0xE7, 0x1A, 0xE3, 0xF7, 0x9E, 0x49, 0xF9, 0x4A, 0xE9, 0x59, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x74,
+    0x99, 0x99, 0x97, 0x77, 0x76, 0x99, 0x77, 0x19, 0xE7, 0x70, 0xAE, 0x97, 0x79, 0xE7, 0x71, 0x99,
+    0x71, 0x77, 0x5A, 0xD9, 0x72, 0x9F, 0x72, 0xDA, 0xE7, 0x0A, 0xD0, 0x9D, 0xA6, 0x9D, 0x29, 0xD6,
+    0xAC, 0x93, 0xAA, 0x77, 0x72, 0x99, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x4E, 0x92, 0x9F, 0x2E, 0x6E,
+    0x91, 0xDA, 0x6A, 0xDA, 0x0A, 0xD9, 0x7E, 0x0A, 0xD7, 0x0E, 0x0E, 0x70, 0xE0, 0xE9, 0x7E, 0x0A,
+    0xD9, 0x7E, 0x0A, 0xE6, 0x9D, 0xA1, 0xE9, 0x5E, 0x2A, 0xE9, 0x3A, 0xDA, 0x3F, 0xCA, 0xAE, 0xA5,
+    0xAF, 0xE9, 0x70, 0x99, 0x99, 0x77, 0x75, 0x99, 0x74, 0x9E, 0x73, 0xAE, 0x73, 0x9E, 0x77, 0x50,
+    0x74, 0x97, 0x72, 0x9D, 0x97, 0x70, 0xAE, 0x97, 0x7F, 0xA7, 0x7E, 0xA5, 0x9A, 0xA7, 0x0A, 0x97,
+    0x9D, 0xA7, 0x71, 0x9D, 0xA7, 0x99, 0xAA, 0x94, 0xAD, 0x94, 0x9F, 0xFC, 0xA0, 0x9D, 0xA4, 0xAF,
+    0xCA, 0xFF, 0xA4, 0xF9, 0x4A, 0xF9, 0x4A, 0xE7, 0x9E, 0xA3, 0x9E, 0x71, 0xAE, 0x3A, 0xDA, 0x72,
+    0xEA, 0x2E, 0x73, 0xAE, 0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x74, 0xE1, 0xAD, 0xA7, 0x4E, 0x1A, 0xDA,
+    0x74, 0xE1, 0xAE, 0x74, 0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x3A, 0xDA, 0x2E, 0xA7, 0x2E, 0x92,
+    0xAE, 0x71, 0xAE, 0x4F, 0x79, 0xE5, 0x9F, 0x94, 0xAE, 0x96, 0x9F, 0xFF, 0x97, 0x1A, 0xFF, 0xA7,
+    0x59, 0x99, 0x99, 0x71, 0x70, 0x97, 0x7D, 0x97, 0x4E, 0x97, 0x3A, 0xDA, 0x74, 0xE7, 0x4A, 0xCA,
+    0x76, 0x94, 0xAD, 0x97, 0x49, 0xD9, 0x69, 0x93, 0xAD, 0x4A, 0xFD, 0xA0, 0xDA, 0x3F, 0xFE, 0xA3,
+    0xE9, 0x29, 0xF3, 0xE6, 0xE9, 0x2D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xAD, 0x70, 0xE1, 0xE7,
+    0x0E, 0x1E, 0x97, 0xE1, 0xAD, 0x97, 0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x95, 0xE3, 0xAE, 0x93, 0xAD,
+    0xA4, 0xFC, 0xAA, 0xEA, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x97, 0x69, 0x77, 0x3A, 0xCA, 0x77, 0x2F,
+    0x97, 0x70, 0x9F, 0xA7, 0x71, 0x9E, 0xA4, 0x9A, 0xA7, 0x39, 0x94, 0x9D, 0xA7, 0x71, 0x9D, 0xA7,
+    0x99, 0xAA, 0x94, 0xAD, 0x94, 0x9F, 0xFC, 0xA0, 0x9D, 0xA4, 0xAF, 0xCA, 0xFF, 0xA4, 0xF9, 0x4A,
+    0xF9, 0x4A, 0xE7, 0x9E, 0xA3, 0x9E, 0x71, 0xAE, 0x3A, 0xDA, 0x72, 0xEA, 0x2E, 0x73, 0xAE, 0x19,
+    0xE7, 0x39, 0xE1, 0x9E, 0x74, 0xE1, 0xAD, 0xA7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAE, 0x74, 0xE1,
+    0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x3A, 0xDA, 0x2E, 0xA7, 0x2E, 0x92, 0xAE, 0x71, 0xAE, 0x4F, 0x79,
+    0xE5, 0x9F, 0x94, 0xAE, 0x96, 0x9F, 0xFF, 0x97, 0x1A, 0xFF, 0xA7, 0x59, 0x99, 0x99, 0x71, 0x39,
+    0x97, 0x6D, 0x75, 0x9E, 0x75, 0xF7, 0x5A, 0xDA, 0x75, 0x9D, 0x77, 0xA3, 0xAD, 0x97, 0x49, 0xD9,
+    0x69, 0x93, 0xAD, 0x4A, 0xFD, 0xA0, 0xDA, 0x3F, 0xFE, 0xA3, 0xE9, 0x29, 0xF3, 0xE6, 0xE9, 0x2D,
+    0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xAD, 0x70, 0xE1, 0xE7, 0x0E, 0x1E, 0x97, 0xE1, 0xAD, 0x97,
+    0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x95, 0xE3, 0xAE, 0x93, 0xAD, 0xA4, 0xFC, 0xAA, 0xEA, 0x6A, 0xFE,
+    0x97, 0x19, 0x99, 0x97, 0x77, 0x74, 0x9F, 0xC7, 0x69, 0xEA, 0xE7, 0x59, 0xCA, 0x19, 0xD7, 0x6A,
+    0x91, 0xAD, 0x77, 0x1A, 0xD7, 0x70, 0x9D, 0x95, 0x9A, 0xA7, 0x1C, 0xA6, 0x9D, 0xA7, 0x71, 0x9D,
+    0xA7, 0x99, 0xAA, 0x94, 0xAD, 0x94, 0x9F, 0xFC, 0xA0, 0x9D, 0xA4, 0xAF, 0xCA, 0xFF, 0xA4, 0xF9,
+    0x4A, 0xF9, 0x4A, 0xE7, 0x9E, 0xA3, 0x9E, 0x71, 0xAE, 0x3A, 0xDA, 0x72, 0xEA, 0x2E, 0x73, 0xAE,
+    0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x74, 0xE1, 0xAD, 0xA7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAE, 0x74,
+    0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x3A, 0xDA, 0x2E, 0xA7, 0x2E, 0x92, 0xAE, 0x71, 0xAE, 0x4F,
+    0x79, 0xE5, 0x9F, 0x94, 0xAE, 0x96, 0x9F, 0xFF, 0x97, 0x1A, 0xFF, 0xA7, 0x59, 0x99, 0x99, 0x71,
+    0x77, 0x5A, 0xEA, 0x72, 0xAF, 0xD7, 0x1D, 0x2D, 0x97, 0x0A, 0xC2, 0xD9, 0x74, 0xAD, 0x73, 0xAD,
+    0xA7, 0x4D, 0x76, 0x9C, 0x4A, 0xD9, 0x74, 0x9D, 0x96, 0x99, 0x3A, 0xD4, 0xAF, 0xDA, 0x0D, 0xA3,
+    0xFF, 0xEA, 0x3E, 0x92, 0x9F, 0x3E, 0x6E, 0x92, 0xDA, 0x6A, 0xDA, 0x1A, 0xD9, 0x7E, 0x1A, 0xD7,
+    0x0E, 0x1E, 0x70, 0xE1, 0xE9, 0x7E, 0x1A, 0xD9, 0x7E, 0x1A, 0xE6, 0x9D, 0xA2, 0xE9, 0x5E, 0x3A,
+    0xE9, 0x3A, 0xDA, 0x4F, 0xCA, 0xAE, 0xA6, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x70, 0x77, 0x73, 0xAE,
+    0x91, 0xCA, 0x74, 0xFC, 0x9A, 0xD7, 0x39, 0xD9, 0xAF, 0xA7, 0x4C, 0x91, 0xAE, 0x39, 0xAA, 0x77,
+    0x29, 0xDA, 0x77, 0x19, 0xDA, 0x79, 0x9A, 0xA9, 0x4A, 0xD9, 0x49, 0xFF, 0xCA, 0x09, 0xDA, 0x4A,
+    0xFC, 0xAF, 0xFA, 0x4F, 0x94, 0xAF, 0x94, 0xAE, 0x79, 0xEA, 0x39, 0xE7, 0x1A, 0xE3, 0xAD, 0xA7,
+    0x2E, 0xA2, 0xE7, 0x3A, 0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAD,
+    0xA7, 0x4E, 0x1A, 0xE7, 0x4E, 0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x73, 0xAD, 0xA2, 0xEA, 0x72, 0xE9,
+    0x2A, 0xE7, 0x1A, 0xE4, 0xF7, 0x9E, 0x59, 0xF9, 0x4A, 0xE9, 0x69, 0xFF, 0xF9, 0x71, 0xAF, 0xFA,
+    0x75, 0x99, 0x99, 0x97, 0x10, 0x77, 0x39, 0xEA, 0x1A, 0xC7, 0xFC, 0xA9, 0xD7, 0xD9, 0x9F, 0xC7,
+    0x9C, 0x2E, 0x97, 0x71, 0xAD, 0x97, 0x49, 0xD9, 0x69, 0x93, 0xAD, 0x4A, 0xFD, 0xA0, 0xDA, 0x3F,
+    0xFE, 0xA3, 0xE9, 0x29, 0xF3, 0xE6, 0xE9, 0x2D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xAD, 0x70,
+    0xE1, 0xE7, 0x0E, 0x1E, 0x97, 0xE1, 0xAD, 0x97, 0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x95, 0xE3, 0xAE,
+    0x93, 0xAD, 0xA4, 0xFC, 0xAA, 0xEA, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x97, 0x77, 0x19, 0xAA, 0x77,
+    0x29, 0xDA, 0x77, 0x19, 0xDA, 0x79, 0x9A, 0xA9, 0x4A, 0xD9, 0x49, 0xFF, 0xCA, 0x09, 0xDA, 0x4A,
+    0xFC, 0xAF, 0xFA, 0x4F, 0x94, 0xAF, 0x94, 0xAE, 0x79, 0xEA, 0x39, 0xE7, 0x1A, 0xE3, 0xAD, 0xA7,
+    0x2E, 0xA2, 0xE7, 0x3A, 0xE1, 0x9E, 0x73, 0x9E, 0x19, 0xE7, 0x4E, 0x1A, 0xDA, 0x74, 0xE1, 0xAD,
+    0xA7, 0x4E, 0x1A, 0xE7, 0x4E, 0x19, 0xE7, 0x39, 0xE1, 0x9E, 0x73, 0xAD, 0xA2, 0xEA, 0x72, 0xE9,
+    0x2A, 0xE7, 0x1A, 0xE4, 0xF7, 0x9E, 0x59, 0xF9, 0x4A, 0xE9, 0x69, 0xFF, 0xF9, 0x71, 0xAF, 0xFA,
+    0x75, 0x99, 0x99, 0x97, 0x77, 0x77, 0x09, 0x97, 0x72, 0x9E, 0x77, 0x1A, 0xE9, 0x77, 0x09, 0xE7,
+    0x72, 0x99, 0x72, 0x77, 0x75, 0xAD, 0x97, 0x49, 0xD9, 0x69, 0x93, 0xAD, 0x4A, 0xFD, 0xA0, 0xDA,
+    0x3F, 0xFE, 0xA3, 0xE9, 0x29, 0xF3, 0xE6, 0xE9, 0x2D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xAD,
+    0x70, 0xE1, 0xE7, 0x0E, 0x1E, 0x97, 0xE1, 0xAD, 0x97, 0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x95, 0xE3,
+    0xAE, 0x93, 0xAD, 0xA4, 0xFC, 0xAA, 0xEA, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x97, 0x77, 0x79, 0x97,
+    0x5E, 0x97, 0x39, 0xE9, 0x74, 0xE7, 0x77, 0x00, 0x77, 0x59, 0xFF, 0x4F, 0xF0, 0xFD, 0xA5, 0xAF,
+    0xCA, 0x3E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09,
+    0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09,
+    0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4E, 0x97, 0x09, 0xD9, 0x4A, 0xD9, 0x70,
+    0x9D, 0x5A, 0xD9, 0x70, 0xAD, 0x59, 0xE7, 0x0E, 0x6E, 0x96, 0xAD, 0xA6, 0xAE, 0xA3, 0x9A, 0xE7,
+    0x0F, 0xFF, 0x72, 0xAF, 0xFA, 0x76, 0x99, 0x99, 0x77, 0x77, 0x70, 0x99, 0x97, 0x71, 0x9E, 0x97,
+    0x70, 0xAE, 0x97, 0x70, 0x9E, 0x77, 0x29, 0x97, 0x10, 0x77, 0x3A, 0xF4, 0xAE, 0xA2, 0xAF, 0xC3,
+    0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5,
+    0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF,
+    0x95, 0x99, 0x94, 0x97, 0x77, 0x69, 0x99, 0x76, 0x9E, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0x72, 0x77,
+    0x75, 0x9F, 0xC9, 0x76, 0xEA, 0xE7, 0x59, 0xD1, 0x9D, 0x97, 0x5A, 0x91, 0x9D, 0x77, 0x1A, 0xD9,
+    0x77, 0x0D, 0xA7, 0x72, 0xD7, 0x77, 0x77, 0x75, 0x9F, 0xF4, 0xFF, 0x0F, 0xDA, 0x5A, 0xFC, 0xA3,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94,
+    0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xE9, 0x70, 0x9D, 0x94, 0xAD, 0x97, 0x09, 0xD5,
+    0xAD, 0x97, 0x0A, 0xD5, 0x9E, 0x70, 0xE6, 0xE9, 0x6A, 0xDA, 0x6A, 0xEA, 0x39, 0xAE, 0x70, 0xFF,
+    0xF7, 0x2A, 0xFF, 0xA7, 0x69, 0x99, 0x97, 0x00, 0x77, 0x70, 0x9F, 0x97, 0x39, 0xFD, 0x97, 0x2D,
+    0xA1, 0xE7, 0x29, 0xC2, 0xAC, 0xA7, 0x69, 0xD7, 0x59, 0xE7, 0x69, 0xC9, 0x77, 0x0C, 0x97, 0x77,
+    0x77, 0x7A, 0xF4, 0xAE, 0xA2, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA,
+    0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59,
+    0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94, 0x93, 0x75, 0x97, 0x74, 0xD9, 0x77,
+    0x19, 0xEA, 0x77, 0x0F, 0xC7, 0x70, 0xEA, 0x95, 0xAC, 0x97, 0x0A, 0x97, 0x0E, 0x77, 0x3E, 0x77,
+    0x2A, 0xDA, 0x9F, 0xF4, 0xFE, 0xA1, 0xFD, 0xA5, 0xAF, 0xA5, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70,
+    0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70,
+    0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70,
+    0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xAD, 0x97, 0x09, 0xD6, 0xAD, 0x97, 0x0A, 0xD6, 0x9E, 0x70,
+    0xE7, 0xE9, 0x6A, 0xDA, 0x7A, 0xEA, 0x39, 0xAE, 0x71, 0xFF, 0xF7, 0x3A, 0xFF, 0xA7, 0x79, 0x99,
+    0x97, 0x10, 0x72, 0x97, 0x70, 0xDA, 0x76, 0xAD, 0xA7, 0x6E, 0x76, 0xE7, 0x69, 0xD7, 0x70, 0xA5,
+    0x9D, 0x97, 0x7D, 0xA7, 0x6A, 0xD9, 0x0A, 0xF3, 0x9A, 0xAF, 0x90, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A,
+    0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59,
+    0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5,
+    0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94,
+    0x93, 0x79, 0x77, 0x4A, 0xD7, 0x73, 0xAE, 0x97, 0x72, 0xFA, 0x77, 0x29, 0xAE, 0x5A, 0xC9, 0x73,
+    0x99, 0x5E, 0x77, 0x3E, 0x77, 0x2A, 0xDA, 0x9F, 0xF4, 0xFE, 0xA1, 0xFD, 0xA5, 0xAF, 0xA5, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9,
+    0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xAD, 0x97, 0x09, 0xD6, 0xAD,
+    0x97, 0x0A, 0xD6, 0x9E, 0x70, 0xE7, 0xE9, 0x6A, 0xDA, 0x7A, 0xEA, 0x39, 0xAE, 0x71, 0xFF, 0xF7,
+    0x3A, 0xFF, 0xA7, 0x79, 0x99, 0x97, 0x10, 0x5A, 0x77, 0x0D, 0xA7, 0x7E, 0x97, 0x6A, 0xE7, 0x79,
+    0xE7, 0x70, 0xDA, 0x77, 0x0A, 0x49, 0xD9, 0x77, 0xDA, 0x76, 0xAD, 0x90, 0xAF, 0x39, 0xAA, 0xF9,
+    0x0A, 0xFC, 0x3A, 0xFA, 0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5,
+    0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59,
+    0xDA, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F,
+    0xD9, 0x0A, 0xF9, 0x59, 0x99, 0x49, 0x30, 0x77, 0x76, 0x9F, 0xC9, 0x77, 0xEA, 0xE7, 0x69, 0xD1,
+    0x9D, 0x97, 0x6A, 0x91, 0x9D, 0x77, 0x2A, 0xD9, 0x77, 0x1D, 0xA6, 0xAC, 0x97, 0x1D, 0x7E, 0x77,
+    0x3E, 0x77, 0x2A, 0xDA, 0x9F, 0xF4, 0xFE, 0xA1, 0xFD, 0xA5, 0xAF, 0xA5, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xAD, 0x97, 0x09, 0xD6, 0xAD, 0x97, 0x0A, 0xD6,
+    0x9E, 0x70, 0xE7, 0xE9, 0x6A, 0xDA, 0x7A, 0xEA, 0x39, 0xAE, 0x71, 0xFF, 0xF7, 0x3A, 0xFF, 0xA7,
+    0x79, 0x99, 0x97, 0x10, 0x77, 0x70, 0x9F, 0x97, 0x39, 0xFD, 0x97, 0x2D, 0xA1, 0xE7, 0x29, 0xC2,
+    0xAC, 0xA7, 0x69, 0xD7, 0x59, 0xE7, 0x69, 0xC9, 0x77, 0x0C, 0x94, 0x9D, 0x97, 0x7D, 0xA7, 0x6A,
+    0xD9, 0x0A, 0xF3, 0x9A, 0xAF, 0x90, 0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5,
+    0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5,
+    0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA,
+    0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD, 0x90, 0xAF, 0x95, 0x99, 0x94, 0x93, 0x77, 0x75, 0x9E, 0x91,
+    0xCA, 0x75, 0xFC, 0xA9, 0xD7, 0x5D, 0x9A, 0xFC, 0x75, 0xAA, 0x19, 0xE4, 0xAC, 0x97, 0x73, 0xE7,
+    0x73, 0xE7, 0x72, 0xAD, 0xA9, 0xFF, 0x4F, 0xEA, 0x1F, 0xDA, 0x5A, 0xFA, 0x5E, 0x97, 0x09, 0xD9,
+    0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9,
+    0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9,
+    0x5E, 0x97, 0x09, 0xD9, 0x5E, 0x97, 0x09, 0xD9, 0x5A, 0xD9, 0x70, 0x9D, 0x6A, 0xD9, 0x70, 0xAD,
+    0x69, 0xE7, 0x0E, 0x7E, 0x96, 0xAD, 0xA7, 0xAE, 0xA3, 0x9A, 0xE7, 0x1F, 0xFF, 0x73, 0xAF, 0xFA,
+    0x77, 0x99, 0x99, 0x71, 0x77, 0x7F, 0x19, 0xC7, 0x1A, 0xFC, 0x9D, 0x97, 0x0A, 0xCA, 0x0F, 0xC9,
+    0x71, 0xC2, 0xAD, 0xA7, 0x74, 0x9D, 0x97, 0x7D, 0xA7, 0x6A, 0xD9, 0x0A, 0xF3, 0x9A, 0xAF, 0x90,
+    0xAF, 0xC3, 0xAF, 0xA3, 0x9A, 0xDA, 0x5A, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D,
+    0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D,
+    0xA5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0xA5, 0xEA, 0x29, 0xFA, 0x59, 0xFF, 0xAF, 0xC9, 0x39, 0xFD,
+    0x90, 0xAF, 0x95, 0x99, 0x94, 0x93, 0x77, 0x3A, 0xC9, 0x77, 0x3E, 0x77, 0x3E, 0x77, 0x2A, 0xDA,
+    0x9F, 0xF4, 0xFE, 0xA1, 0xFD, 0xA5, 0xAF, 0xA5, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95, 0xE9, 0x70, 0x9D, 0x95,
+    0xE9, 0x70, 0x9D, 0x95, 0xAD, 0x97, 0x09, 0xD6, 0xAD, 0x97, 0x0A, 0xD6, 0x9E, 0x70, 0xE7, 0xE9,
+    0x6A, 0xDA, 0x7A, 0xEA, 0x39, 0xAE, 0x71, 0xFF, 0xF7, 0x3A, 0xFF, 0xA7, 0x79, 0x99, 0x97, 0x77,
+    0x77, 0x29, 0x99, 0x77, 0x29, 0xE9, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE7, 0x74, 0x97, 0x20, 0x77,
+    0x77, 0x19, 0xD9, 0x77, 0xDA, 0x76, 0xAD, 0x90, 0xAF, 0x39, 0xAA, 0xF9, 0x0A, 0xFC, 0x3A, 0xFA,
+    0x39, 0xAD, 0xA5, 0xAD, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D,
+    0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5D, 0xA5, 0x9D, 0xA5, 0xDA, 0x59, 0xDA, 0x5E, 0x59, 0xDA,
+    0x5E, 0x5A, 0xDA, 0x5E, 0xA2, 0x9F, 0xA5, 0x9F, 0xFA, 0xFC, 0x93, 0x9F, 0xD9, 0x0A, 0xF9, 0x59,
+    0x99, 0x49, 0x77, 0x76, 0x99, 0x97, 0x69, 0xE7, 0x6A, 0xE7, 0x69, 0xE7, 0x77, 0x20, 0x59, 0x77,
+    0x19, 0xD9, 0x77, 0x9E, 0xA7, 0x7A, 0xF7, 0x70, 0xAE, 0x77, 0x19, 0xA7, 0x77, 0x77, 0x7A, 0xFF,
+    0x2A, 0xFD, 0xA9, 0xFD, 0xA3, 0x9A, 0xFA, 0x3E, 0x96, 0xAD, 0x5A, 0xE6, 0xDA, 0x6E, 0x94, 0xAD,
+    0x79, 0xE4, 0xD9, 0x70, 0xAD, 0x92, 0xAD, 0x72, 0xE1, 0x9D, 0x73, 0xAD, 0xA0, 0xDA, 0x74, 0xE9,
+    0xD7, 0x59, 0xF9, 0x76, 0xF7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79,
+    0xDA, 0x77, 0x9D, 0xA7, 0x5A, 0xFE, 0xA7, 0x1A, 0xFF, 0xC4, 0x4A, 0x77, 0x9D, 0x76, 0xAE, 0x76,
+    0xEA, 0x76, 0xE9, 0x76, 0xAD, 0x77, 0x09, 0x77, 0x77, 0x73, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9,
+    0x2A, 0xFA, 0x2E, 0x96, 0xDA, 0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3,
+    0xAD, 0x7A, 0xD3, 0xD9, 0x70, 0xDA, 0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA,
+    0xAC, 0xA7, 0x3A, 0xF7, 0x5E, 0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x4A, 0xE7,
+    0x1A, 0xFD, 0x97, 0x1A, 0xFC, 0x97, 0x3A, 0xCA, 0xA7, 0x40, 0x77, 0x3A, 0xFF, 0x2A, 0xFD, 0xA9,
+    0xFD, 0xA3, 0x9A, 0xFA, 0x3E, 0x96, 0xAD, 0x5A, 0xE6, 0xDA, 0x6E, 0x94, 0xAD, 0x79, 0xE4, 0xD9,
+    0x70, 0xAD, 0x92, 0xAD, 0x72, 0xE1, 0x9D, 0x73, 0xAD, 0xA0, 0xDA, 0x74, 0xE9, 0xD7, 0x59, 0xF9,
+    0x76, 0xF7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D,
+    0xA7, 0x5A, 0xFE, 0xA7, 0x1A, 0xFF, 0xC7, 0x77, 0x77, 0x75, 0x99, 0x77, 0x0E, 0xA7, 0x7F, 0x77,
+    0xE9, 0x77, 0x09, 0x97, 0x00, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E, 0x96, 0xDA,
+    0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A, 0xD3, 0xD9, 0x70,
+    0xDA, 0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7, 0x3A, 0xF7, 0x5E,
+    0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE3, 0x99, 0x6A, 0xE3, 0xE9, 0x1A, 0xFD, 0x92,
+    0x9E, 0x91, 0xAF, 0xC9, 0x4E, 0x3A, 0xCA, 0xA7, 0x40, 0x77, 0x72, 0xAF, 0xA7, 0x4E, 0xAE, 0x97,
+    0x3D, 0x2D, 0xA7, 0x39, 0xA2, 0xD9, 0x76, 0x9D, 0xA7, 0x6D, 0xA7, 0x70, 0xAC, 0x77, 0x29, 0x77,
+    0x75, 0xAF, 0xF2, 0xAF, 0xDA, 0x9F, 0xDA, 0x39, 0xAF, 0xA3, 0xE9, 0x6A, 0xD5, 0xAE, 0x6D, 0xA6,
+    0xE9, 0x4A, 0xD7, 0x9E, 0x4D, 0x97, 0x0A, 0xD9, 0x2A, 0xD7, 0x2E, 0x19, 0xD7, 0x3A, 0xDA, 0x0D,
+    0xA7, 0x4E, 0x9D, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79,
+    0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x75, 0xAF, 0xEA, 0x71, 0xAF, 0xFC, 0x40, 0x77, 0x7A, 0xEA,
+    0x73, 0xFE, 0x71, 0x9D, 0x19, 0xD7, 0x2C, 0xA1, 0x9D, 0x76, 0xDA, 0x74, 0xAD, 0x97, 0x5D, 0x77,
+    0xAA, 0x77, 0x77, 0x74, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E, 0x96, 0xDA, 0x39,
+    0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A, 0xD3, 0xD9, 0x70, 0xDA,
+    0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7, 0x3A, 0xF7, 0x5E, 0xA7,
+    0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x4A, 0xE7, 0x1A, 0xFD, 0x97, 0x1A, 0xFC, 0x97,
+    0x3A, 0xCA, 0xA7, 0x40, 0x77, 0x71, 0xEA, 0x1A, 0xC7, 0x2F, 0xCA, 0x9D, 0x97, 0x1D, 0xA9, 0xFC,
+    0x72, 0x9C, 0x2E, 0x97, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xF2, 0xAF, 0xDA, 0x9F, 0xDA, 0x39, 0xAF,
+    0xA3, 0xE9, 0x6A, 0xD5, 0xAE, 0x6D, 0xA6, 0xE9, 0x4A, 0xD7, 0x9E, 0x4D, 0x97, 0x0A, 0xD9, 0x2A,
+    0xD7, 0x2E, 0x19, 0xD7, 0x3A, 0xDA, 0x0D, 0xA7, 0x4E, 0x9D, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0x9D,
+    0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x75, 0xAF, 0xEA,
+    0x71, 0xAF, 0xFC, 0x40, 0x77, 0x59, 0xE9, 0x1C, 0xA7, 0x0F, 0xC9, 0x9D, 0x70, 0xD0, 0x9F, 0xA7,
+    0x0A, 0xA1, 0x9E, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xDA, 0x2F, 0xD0, 0x9F, 0xD9, 0x2A, 0xFA, 0x2E,
+    0x96, 0xDA, 0x39, 0xDA, 0x5A, 0xD5, 0xE5, 0xDA, 0x5A, 0xD9, 0x39, 0xD7, 0xE3, 0xAD, 0x7A, 0xD3,
+    0xD9, 0x70, 0xDA, 0x1A, 0xD7, 0x1E, 0x1D, 0x97, 0x19, 0xD9, 0x9D, 0x73, 0xDA, 0xAC, 0xA7, 0x3A,
+    0xF7, 0x5E, 0xA7, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x4A, 0xE7, 0x1A, 0xFD, 0x97,
+    0x1A, 0xFC, 0x97, 0x3A, 0xCA, 0xA7, 0x40, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x99,
+    0x19, 0x99, 0xC9, 0x9C, 0x90, 0x9D, 0x92, 0xD2, 0xF0, 0x99, 0xAA, 0x99, 0x1A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C, 0x90,
+    0x9A, 0xAA, 0xAA, 0xAD, 0x9A, 0xCA, 0xAA, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91,
+    0xAA, 0x19, 0xC9, 0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10,
+    0x74, 0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xAA, 0xAA, 0xA9, 0x9D, 0xAA, 0xAA, 0xAC, 0xA0,
+    0x9C, 0x93, 0x9A, 0x19, 0xC9, 0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A,
+    0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x10, 0x9A, 0xAA, 0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0x9A, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFA, 0xAF, 0xE9, 0xAF, 0xFF, 0xAA, 0xFF, 0xFA, 0x75, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF, 0xFF,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x09, 0x93, 0x99, 0x1D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D,
+    0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2,
+    0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA,
+    0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D,
+    0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2,
+    0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0A, 0xA9, 0x2A, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0xFF, 0xFD, 0x9F,
+    0xFF, 0xDA, 0x76, 0x29, 0x29, 0xCA, 0x1D, 0x1A, 0xCA, 0x1D, 0x90, 0x9D, 0x90, 0xAD, 0x90, 0x9E,
+    0x1E, 0x50, 0x29, 0x29, 0xE2, 0xE9, 0x1A, 0xD9, 0x19, 0xD9, 0x1A, 0xD2, 0xD9, 0x19, 0xD2, 0xD7,
+    0x00, 0x29, 0x29, 0xE2, 0xE9, 0x1A, 0xD9, 0x19, 0xD9, 0x1A, 0xD2, 0xD9, 0x19, 0xD2, 0xD7, 0x00,
+    0x19, 0x2E, 0x9A, 0xE0, 0xAD, 0x90, 0x9D, 0x91, 0xD9, 0x1A, 0xCA, 0x2D, 0x29, 0xCA, 0x40, 0x29,
+    0x49, 0x29, 0xCA, 0x2A, 0xC9, 0x1D, 0x29, 0xD1, 0xAC, 0xA2, 0xD9, 0x1D, 0x91, 0x9D, 0x19, 0xD9,
+    0x1A, 0xD1, 0xAD, 0x91, 0xE9, 0x09, 0xE1, 0xAE, 0x1E, 0x2E, 0x73, 0x29, 0x49, 0x29, 0xE1, 0xAE,
+    0x2E, 0x91, 0xE2, 0xAD, 0x91, 0xAD, 0x91, 0x9D, 0x91, 0xAD, 0x2A, 0xD2, 0xDA, 0x2D, 0x92, 0xD9,
+    0x19, 0xD2, 0xAC, 0xA2, 0xD3, 0xD7, 0x60, 0x29, 0x39, 0x92, 0x9E, 0x1A, 0xE2, 0xE9, 0x1E, 0x2A,
+    0xD9, 0x1A, 0xD9, 0x19, 0xD9, 0x1A, 0xD2, 0xAD, 0x2D, 0xA2, 0xD9, 0x2D, 0x29, 0xD2, 0xAC, 0xA2,
+    0xD3, 0xD7, 0x60, 0x19, 0x49, 0x2E, 0x90, 0x9E, 0x0A, 0xE1, 0xAD, 0xA0, 0xAD, 0x91, 0xE1, 0x9D,
+    0x91, 0xAD, 0x2D, 0x91, 0x9D, 0x2A, 0xCA, 0x2D, 0xA2, 0xD2, 0x9D, 0x29, 0xCA, 0x29, 0xCA, 0x72,
+    0x59, 0x97, 0x29, 0xE7, 0x19, 0xDA, 0x72, 0xDA, 0x72, 0xD9, 0x59, 0x92, 0xD9, 0x29, 0x1F, 0xAD,
+    0xAF, 0x90, 0xFF, 0xF9, 0x0A, 0x99, 0x1D, 0x91, 0x9A, 0x6D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D,
+    0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA4, 0x59, 0x97, 0x29,
+    0xE7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0x95, 0x99, 0x2D, 0x92, 0x91, 0xFA, 0xDA, 0xF9, 0x0F, 0xFF,
+    0x90, 0xA9, 0x91, 0xD9, 0x19, 0xA6, 0xD9, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x59,
+    0x99, 0x1D, 0x91, 0x9A, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x09, 0x92, 0xD9, 0x19, 0x96, 0xDA, 0x72,
+    0xDA, 0x72, 0xDA, 0x71, 0x9E, 0x72, 0x99, 0x94, 0x7A, 0xE9, 0x09, 0xFC, 0x0A, 0xFC, 0x99, 0xFC,
+    0x1F, 0xA2, 0x99, 0x20, 0x9C, 0x96, 0xF9, 0x4F, 0xD9, 0x2F, 0xF9, 0x0F, 0xFC, 0xAF, 0xFC, 0xAF,
+    0xEA, 0x1F, 0xCA, 0x3E, 0xA5, 0x9A, 0x70, 0x19, 0x92, 0xF1, 0xF1, 0xEA, 0x29, 0x91, 0x19, 0x94,
+    0x99, 0x1E, 0xA2, 0xF9, 0xEA, 0x2F, 0x0E, 0x92, 0xEA, 0x19, 0x59, 0x10, 0x19, 0x97, 0x99, 0x69,
+    0x92, 0xEA, 0x49, 0xE9, 0x4A, 0xE1, 0xF4, 0xAE, 0xA4, 0xF1, 0xEA, 0x49, 0xE5, 0xAE, 0x29, 0x70,
+    0x97, 0x99, 0x10, 0x09, 0xD9, 0x1F, 0x1F, 0x19, 0xD9, 0x00, 0x75, 0x9C, 0x97, 0x9C, 0x97, 0x0C,
+    0x90, 0x9A, 0x2A, 0xAD, 0x9A, 0xC2, 0xAA, 0xD9, 0xAA, 0x39, 0xC9, 0x0A, 0xA2, 0x9C, 0x91, 0xAA,
+    0x19, 0xC9, 0x2A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x77, 0x10, 0x74,
+    0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x69, 0xDA, 0xA2, 0xA9, 0x9D, 0xAA, 0x2C, 0xA0, 0x9C, 0x93, 0x9A,
+    0x19, 0xC9, 0x29, 0xA3, 0xC9, 0x19, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7,
+    0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A, 0x79, 0xA7, 0x9A,
+    0x79, 0xA7, 0x10, 0x3A, 0x96, 0xAD, 0x94, 0x9C, 0xAA, 0xC9, 0x29, 0xC0, 0xAA, 0x0C, 0x91, 0xC1,
+    0xAA, 0x1C, 0x4A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0x50, 0x76, 0x9C, 0x90, 0xC9, 0x69, 0xC9, 0x0C, 0xA6, 0x9C, 0x90, 0xCA, 0x09, 0xAA,
+    0xAA, 0xAD, 0x90, 0xCA, 0xCA, 0xAA, 0xAA, 0xD9, 0x0C, 0x9C, 0x92, 0x9C, 0x90, 0xC9, 0x0C, 0x91,
+    0x9C, 0x1C, 0x91, 0xC9, 0x09, 0xC1, 0xC9, 0x2C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C,
+    0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x1C, 0x97, 0x75, 0x76, 0x9C, 0x09, 0xC9,
+    0x4A, 0xC0, 0x9C, 0x94, 0xAC, 0x09, 0xC9, 0x4A, 0xC0, 0x9D, 0xAA, 0xAA, 0xA9, 0x9C, 0x1D, 0xAA,
+    0xAA, 0xAC, 0x09, 0xC1, 0xC9, 0x29, 0xC1, 0x9C, 0x1C, 0x91, 0x9C, 0x29, 0xC1, 0xC9, 0x09, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x30, 0x77, 0x77, 0x77, 0x7C, 0x97, 0x74, 0x9F, 0x97, 0x9D, 0x77, 0x3A,
+    0xFD, 0x96, 0xD9, 0x77, 0x29, 0xD2, 0xAD, 0x5A, 0xCA, 0x77, 0x3D, 0xA3, 0xD9, 0x4D, 0x77, 0x4D,
+    0x93, 0xDA, 0x3A, 0xC9, 0x77, 0x4D, 0x4A, 0xCA, 0x3D, 0x77, 0x49, 0xD4, 0xAC, 0xA2, 0xD7, 0x76,
+    0xD9, 0x3D, 0xA1, 0x9C, 0xA7, 0x76, 0xD9, 0x3D, 0x91, 0xD2, 0x9E, 0xA6, 0xAE, 0x93, 0xAD, 0x2A,
+    0xD1, 0x9C, 0x91, 0xFE, 0x4F, 0xE3, 0xEA, 0xE9, 0x1D, 0x1A, 0xD2, 0xDA, 0x2E, 0x19, 0xD9, 0x3F,
+    0xC2, 0xAC, 0x2D, 0x92, 0xAD, 0x2D, 0x3A, 0xD7, 0x29, 0xCA, 0x19, 0xD4, 0xD1, 0xAD, 0x39, 0xD7,
+    0x2D, 0x2A, 0xD4, 0xD9, 0x0A, 0xCA, 0x39, 0xD7, 0x1A, 0xCA, 0x2A, 0xD4, 0xD9, 0x0D, 0xA3, 0x9D,
+    0x71, 0xD3, 0xAD, 0x4D, 0x1A, 0xCA, 0x39, 0xD7, 0x0A, 0xC9, 0x39, 0xD3, 0x9D, 0x1A, 0xD3, 0xAD,
+    0x79, 0xD5, 0xD9, 0x2D, 0xA1, 0x9D, 0x92, 0xD9, 0x7D, 0x95, 0xAD, 0xA9, 0xE3, 0xEA, 0x9E, 0x7A,
+    0xCA, 0x7A, 0xFC, 0x5F, 0xCA, 0x70, 0xAC, 0x72, 0x99, 0x71, 0x99, 0x77, 0x77, 0x72, 0x70, 0xCA,
+    0x29, 0xDA, 0x1A, 0xD9, 0x1E, 0x1A, 0xD9, 0x1D, 0xA1, 0x9D, 0x2D, 0x93, 0x93, 0x76, 0xCA, 0x3C,
+    0x92, 0x9D, 0xA1, 0xAD, 0x2A, 0xD9, 0x1E, 0x2E, 0x1A, 0xDA, 0x1A, 0xD9, 0x1E, 0x2D, 0xA1, 0x9D,
+    0x91, 0x9D, 0x2D, 0xA2, 0xD9, 0x2D, 0x49, 0x39, 0x40, 0x77, 0x3C, 0xA3, 0xC9, 0x2A, 0xC2, 0x9D,
+    0xA1, 0xAD, 0x2E, 0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1E, 0x1A, 0xDA, 0x1E, 0x1A, 0xD9, 0x1E, 0x19,
+    0xDA, 0x1D, 0xA1, 0x9D, 0x91, 0xAD, 0x19, 0xD2, 0xDA, 0x2D, 0x91, 0xD9, 0x2D, 0x29, 0xCA, 0x39,
+    0x39, 0x4A, 0x30, 0x59, 0xC9, 0x2E, 0x2E, 0x91, 0x9E, 0x2E, 0x3D, 0xA2, 0x9D, 0x3A, 0xC9, 0x3A,
+    0x00, 0x73, 0x9C, 0x93, 0xAC, 0x2E, 0x2A, 0xD2, 0xE9, 0x19, 0xDA, 0x19, 0xE2, 0xE2, 0xE2, 0x9D,
+    0xA2, 0xDA, 0x2E, 0x29, 0xD3, 0xD9, 0x2A, 0xC9, 0x29, 0xCA, 0x3A, 0x49, 0x00, 0x77, 0x29, 0xC9,
+    0x3A, 0xC3, 0xAC, 0x3E, 0x2A, 0xD2, 0x9D, 0xA2, 0xE9, 0x19, 0xDA, 0x2E, 0x29, 0xE2, 0xE2, 0xAD,
+    0x92, 0xE2, 0x9D, 0xA2, 0xE3, 0xDA, 0x2E, 0x29, 0xD9, 0x29, 0xD3, 0xD9, 0x2D, 0xA3, 0xAC, 0x92,
+    0x9C, 0xA3, 0xD4, 0xA4, 0x94, 0x99, 0x00, 0x49, 0xA7, 0x19, 0xDA, 0x79, 0xDA, 0xCA, 0x59, 0xD1,
+    0xAC, 0xA3, 0x9D, 0x3A, 0xCA, 0x2D, 0x94, 0xAC, 0xA0, 0x4A, 0x93, 0xD9, 0x19, 0xDA, 0x19, 0xDA,
+    0x1A, 0xE2, 0xE9, 0x2A, 0xDA, 0x3A, 0xD9, 0x3A, 0xD9, 0x39, 0xD5, 0xC9, 0x0A, 0x6D, 0x95, 0xDA,
+    0x49, 0xDA, 0x49, 0xE4, 0xE9, 0x2A, 0xE2, 0x9E, 0x3E, 0x3D, 0xA4, 0xC9, 0x40, 0x09, 0x75, 0x90,
+    0x9C, 0x97, 0x39, 0xCA, 0x0A, 0xC9, 0x3D, 0x39, 0xCA, 0x2A, 0xC9, 0x19, 0xD9, 0x2C, 0xA4, 0xAC,
+    0x2A, 0xA2, 0xCA, 0x6A, 0xC5, 0xD7, 0x0D, 0x3D, 0x72, 0xD1, 0xD7, 0xAA, 0x2F, 0x2A, 0xA2, 0x9D,
+    0xA2, 0xD2, 0x9D, 0x92, 0xD9, 0x1A, 0xDA, 0x2D, 0x7A, 0xC9, 0x9C, 0xA7, 0x2A, 0xC9, 0x19, 0xCA,
+    0x70, 0x9C, 0x93, 0x9C, 0x96, 0x9C, 0xA1, 0x99, 0x19, 0xC9, 0x49, 0xCA, 0x19, 0xD9, 0x1A, 0xC9,
+    0x3C, 0xA2, 0x9D, 0x92, 0xAC, 0x91, 0xCA, 0x49, 0x94, 0xAC, 0x09, 0xC7, 0x5A, 0xA7, 0x71, 0x09,
+    0xAA, 0x49, 0xAA, 0x09, 0xE3, 0x9D, 0xA0, 0xAD, 0xA3, 0xAD, 0xA0, 0xAD, 0x93, 0xE9, 0x0A, 0xD9,
+    0x3E, 0x90, 0xAD, 0x93, 0xAD, 0x1A, 0xD4, 0xAD, 0x1A, 0xD4, 0xAD, 0x1A, 0xD4, 0xAD, 0x1A, 0xD4,
+    0xAD, 0x19, 0xD4, 0xAD, 0x19, 0xD4, 0x9D, 0x19, 0xD4, 0x9D, 0x2D, 0x5D, 0x2D, 0x5D, 0x2D, 0x5D,
+    0x77, 0x75, 0x96, 0x92, 0xE3, 0x9E, 0x0A, 0xE9, 0x2A, 0xE0, 0x9E, 0x39, 0xE1, 0x99, 0x59, 0x91,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x00, 0x9A, 0xAA, 0xAA, 0x0F, 0xD9, 0xAF, 0xC9, 0x77, 0x72, 0x9A, 0x74, 0xD9, 0x72, 0xAD,
+    0x73, 0xD7, 0x3A, 0xCA, 0x73, 0xD7, 0x3A, 0xC9, 0x73, 0xD7, 0x3A, 0xC9, 0x73, 0xCA, 0x73, 0xD7,
+    0x39, 0xCA, 0x73, 0xD7, 0x3A, 0xC9, 0x73, 0xD7, 0x3A, 0xC9, 0x72, 0x9D, 0x73, 0xD9, 0x72, 0x9C,
+    0xA7, 0x3D, 0x73, 0xAC, 0xA7, 0x3D, 0x75, 0x97, 0x30, 0x77, 0x7A, 0xEA, 0x6A, 0xEA, 0x4A, 0xFD,
+    0x93, 0xAF, 0xD9, 0x2A, 0xFE, 0x92, 0xAF, 0xE9, 0x2A, 0x29, 0xE3, 0xA2, 0x9E, 0x70, 0xDA, 0x70,
+    0xDA, 0x79, 0xD7, 0x09, 0xD7, 0x0D, 0x71, 0xD7, 0x0D, 0x71, 0xD6, 0x9E, 0x79, 0xE3, 0xAF, 0xCA,
+    0x49, 0xFC, 0xA1, 0x9F, 0xDA, 0x4F, 0xDA, 0x29, 0xFA, 0x59, 0xFA, 0x93, 0x9D, 0xA7, 0x0D, 0xA7,
+    0xD7, 0x1D, 0x70, 0xD7, 0x1A, 0xC7, 0x77, 0x77, 0x77, 0x74, 0x97, 0xAD, 0xA7, 0xAD, 0xA6, 0xEA,
+    0x7F, 0x6E, 0x97, 0xEA, 0x79, 0x97, 0x19, 0x95, 0x76, 0xAA, 0x91, 0xAE, 0xA7, 0xAD, 0xA0, 0xAF,
+    0xD9, 0x5E, 0x90, 0xAF, 0xE9, 0x4E, 0x91, 0xA2, 0x9E, 0x4E, 0x70, 0xDA, 0x3E, 0x70, 0x9D, 0x3E,
+    0x71, 0xD3, 0xE7, 0x1D, 0x3E, 0x79, 0xE3, 0xAD, 0x4A, 0xFC, 0xA3, 0xAD, 0x29, 0xFD, 0xA4, 0xAD,
+    0x29, 0xFA, 0x69, 0xD2, 0x9D, 0xA7, 0x09, 0xD3, 0xD7, 0x19, 0xD3, 0xD7, 0x2D, 0x77, 0x77, 0x77,
+    0x79, 0x3A, 0xDA, 0x79, 0xE2, 0xEA, 0x7A, 0xE2, 0xE9, 0x7A, 0xE3, 0x99, 0x71, 0x99, 0x10, 0x09,
+    0xAA, 0x76, 0x9E, 0x4A, 0xEA, 0x4A, 0xDA, 0x3A, 0xFD, 0x92, 0xAD, 0x93, 0xFF, 0x91, 0xAD, 0x93,
+    0x99, 0x29, 0xE1, 0xAD, 0x97, 0x2D, 0x90, 0xAD, 0x73, 0xAD, 0x0A, 0xD7, 0x4D, 0x0A, 0xD7, 0x39,
+    0xD0, 0xAD, 0x72, 0x9E, 0x09, 0xD7, 0xAF, 0xC9, 0x09, 0xD5, 0x9F, 0xDA, 0x19, 0xD5, 0x9F, 0xA4,
+    0xD5, 0x9D, 0x96, 0xD6, 0xD7, 0xD6, 0xD7, 0x77, 0x77, 0x69, 0x79, 0x7E, 0x5E, 0x94, 0xAE, 0x94,
+    0xEA, 0x49, 0xE5, 0xE9, 0x59, 0x97, 0x99, 0x50, 0x39, 0x99, 0x73, 0xAF, 0xCA, 0x4D, 0x1A, 0xDA,
+    0xAF, 0xA9, 0x9D, 0xA1, 0xD3, 0x9A, 0xFC, 0xA2, 0x97, 0x9A, 0x93, 0x77, 0x71, 0xCA, 0x3C, 0x92,
+    0xAC, 0x3C, 0xA2, 0x9D, 0xA1, 0xAD, 0x2E, 0x19, 0xD9, 0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1E, 0x91,
+    0xE1, 0xAD, 0xA1, 0xE2, 0xE1, 0xAD, 0x91, 0xE1, 0x9D, 0xA1, 0xAD, 0x91, 0xDA, 0x19, 0xD9, 0x1A,
+    0xD2, 0xDA, 0x19, 0xD2, 0xDA, 0x2D, 0x91, 0xAD, 0x2D, 0x92, 0xD2, 0x9C, 0xA2, 0xD9, 0x39, 0x39,
+    0x4A, 0x39, 0x93, 0x29, 0xAD, 0xA4, 0xFE, 0x91, 0xE9, 0x09, 0xE0, 0x9D, 0x93, 0xDA, 0xAD, 0x4F,
+    0xCA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4F, 0xD4, 0xDA, 0x9D, 0x92, 0xAD, 0x1E, 0xA9, 0xAD,
+    0xA1, 0x9F, 0xDA, 0x49, 0xAA, 0x93, 0x59, 0xAA, 0x69, 0xDA, 0x6E, 0xA5, 0xFA, 0x4A, 0xCA, 0xAC,
+    0xA3, 0x9D, 0x0A, 0xCA, 0x3D, 0x1A, 0xCA, 0x2D, 0x91, 0xAC, 0xA1, 0xAD, 0x99, 0x9E, 0x99, 0xAF,
+    0xFD, 0x0A, 0xAA, 0xAA, 0xEA, 0x95, 0xAC, 0xA7, 0xAC, 0xA7, 0x9A, 0x91, 0x2A, 0xAA, 0xAA, 0xA2,
+    0x9F, 0xD2, 0x9D, 0xAA, 0xAA, 0x2A, 0xC9, 0x6A, 0xCA, 0x95, 0xFC, 0xA3, 0x9A, 0xAF, 0x69, 0xD9,
+    0x6D, 0x96, 0xD9, 0x5A, 0xD1, 0x99, 0x9A, 0xE9, 0x1F, 0xD9, 0x29, 0xAA, 0x99, 0x30, 0x5A, 0xD9,
+    0x49, 0xFA, 0x3A, 0xDA, 0x5A, 0xD9, 0x59, 0xDA, 0x6A, 0xFD, 0x92, 0xFF, 0xA1, 0xD9, 0x2A, 0xD1,
+    0xD9, 0x3D, 0x90, 0xD9, 0x3D, 0x90, 0xE2, 0x9D, 0x90, 0x9E, 0x99, 0xE2, 0xAF, 0xD5, 0x9A, 0xA9,
+    0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFA, 0x9C, 0xAA, 0xAA, 0xAD, 0x9A, 0xC3, 0xAC, 0xA1,
+    0xA2, 0x9D, 0x6D, 0x95, 0xAC, 0xA6, 0xD6, 0xAD, 0x6D, 0x95, 0x9D, 0x6A, 0xCA, 0x6A, 0xCA, 0x7A,
+    0x50, 0x29, 0xAD, 0xA4, 0xAF, 0xD2, 0x9D, 0x2D, 0xA1, 0xAC, 0xA2, 0x9D, 0x19, 0xD2, 0xDA, 0x2E,
+    0xAD, 0xA4, 0xFC, 0x4E, 0xAE, 0x91, 0xAC, 0xA2, 0xE1, 0xD3, 0x9D, 0x1D, 0x39, 0xD1, 0xE9, 0x09,
+    0xDA, 0x19, 0xFD, 0xA4, 0x9A, 0xA9, 0x30, 0x29, 0xE9, 0x4F, 0xE2, 0xAD, 0x90, 0x9D, 0xA1, 0xD9,
+    0x29, 0xD1, 0xD9, 0x3D, 0x90, 0xDA, 0x3D, 0x90, 0xAD, 0x91, 0x9D, 0x91, 0xFF, 0x39, 0xAF, 0xC6,
+    0x9D, 0x95, 0x9D, 0xA4, 0x9A, 0xE3, 0xAF, 0xA5, 0xAA, 0x95, 0x75, 0xAD, 0x0A, 0xE9, 0x29, 0xFC,
+    0xAE, 0x4D, 0xA2, 0xD9, 0x3D, 0x92, 0xDA, 0x3D, 0x92, 0xDA, 0x3D, 0x92, 0xDA, 0x3D, 0x92, 0xDA,
+    0x3D, 0x92, 0xDA, 0x19, 0xFA, 0x0A, 0xF1, 0x99, 0x99, 0x19, 0x99, 0x99, 0x00, 0x74, 0x9F, 0xCA,
+    0x29, 0xFE, 0xA1, 0xE2, 0xAD, 0x99, 0xD4, 0xDA, 0xAD, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A,
+    0xFA, 0x4D, 0xAA, 0xD4, 0xD9, 0x9D, 0xA2, 0xE1, 0xAF, 0xE3, 0xAF, 0xA7, 0x50, 0x73, 0x9D, 0x29,
+    0xFC, 0x3A, 0xAE, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x3A,
+    0xFD, 0x90, 0xFE, 0x90, 0x75, 0xAF, 0xA2, 0x9E, 0xAE, 0xA1, 0xDA, 0x2E, 0x1D, 0x92, 0xAD, 0x29,
+    0x3D, 0xA6, 0x9D, 0x69, 0xD9, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xD9, 0x5A, 0xDA, 0x99, 0x99, 0x91,
+    0xFF, 0xCA, 0x09, 0xFE, 0xA0, 0x39, 0x4A, 0xFC, 0x90, 0xAD, 0xAA, 0xE0, 0xD3, 0xD9, 0x09, 0x3D,
+    0x5D, 0xA2, 0x9E, 0xA3, 0xFD, 0x29, 0x19, 0xD9, 0x5D, 0xA5, 0xDA, 0x39, 0xE0, 0xAA, 0xFC, 0x90,
+    0xAF, 0xA7, 0x30, 0x77, 0x0D, 0xA6, 0xAD, 0xA5, 0x9E, 0xA5, 0xFA, 0x4D, 0x9A, 0xCA, 0x3A, 0xCA,
+    0x0A, 0xCA, 0x29, 0xD1, 0xAC, 0xA2, 0xD2, 0xAC, 0xA1, 0xFF, 0xDA, 0xAF, 0xFD, 0x5A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x74, 0x19, 0xFD, 0x29, 0xFD, 0x2A, 0xCA, 0x6A, 0xC9, 0x6A, 0xDA, 0x94, 0xFD,
+    0x94, 0x9A, 0xE7, 0xD9, 0x6D, 0x96, 0xD9, 0x49, 0xE1, 0xAA, 0xFC, 0x2F, 0xCA, 0x74, 0x77, 0x9F,
+    0x4F, 0x94, 0xE6, 0xE6, 0x9D, 0xAA, 0x94, 0xFF, 0x2D, 0xA9, 0x9A, 0xE1, 0xD3, 0x9D, 0x90, 0xD9,
+    0x3D, 0x90, 0xDA, 0x3D, 0x90, 0xE9, 0x1A, 0xD2, 0xFE, 0xA3, 0xFC, 0x97, 0x40, 0x9F, 0xF9, 0x9F,
+    0xFA, 0xAC, 0x92, 0x9D, 0x09, 0xC3, 0xD9, 0x19, 0x2A, 0xCA, 0x59, 0xD6, 0xDA, 0x59, 0xD6, 0xDA,
+    0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0x9C, 0x97, 0x60, 0x49, 0x7A, 0xFA, 0x3D, 0xA9, 0xAD, 0x91, 0xAD,
+    0x2A, 0xD1, 0xAC, 0xA2, 0xAC, 0xA1, 0x9D, 0xA1, 0xD9, 0x29, 0xFC, 0x94, 0xFC, 0x92, 0x9D, 0x99,
+    0xEA, 0x1D, 0x92, 0xAD, 0x1D, 0x4D, 0x1D, 0x92, 0x9D, 0x1A, 0xDA, 0xAA, 0xD9, 0x2A, 0xFC, 0x97,
+    0x40, 0x49, 0x69, 0xFC, 0x92, 0x9E, 0xAE, 0x91, 0xDA, 0x2E, 0x1D, 0x92, 0x9D, 0x1D, 0x93, 0xD9,
+    0x0E, 0x3D, 0x90, 0x9E, 0xAA, 0xAD, 0x29, 0xFE, 0x49, 0x99, 0xDA, 0x6A, 0xD6, 0xAD, 0x92, 0x99,
+    0xAE, 0x93, 0xAE, 0xA7, 0x70, 0x0A, 0xFF, 0xFA, 0x0F, 0xFF, 0xD2, 0xAD, 0xA9, 0x99, 0x99, 0xAD,
+    0x2A, 0xD9, 0x49, 0xD2, 0xAD, 0x95, 0xCA, 0x2A, 0xD9, 0x59, 0x3A, 0xD9, 0x72, 0xAD, 0x97, 0x2A,
+    0xDA, 0x99, 0x99, 0x9A, 0x4A, 0xFF, 0xCA, 0x3A, 0xEA, 0xAA, 0xAA, 0xA4, 0xAD, 0x97, 0x2A, 0xD9,
+    0x70, 0xAA, 0xFA, 0xA9, 0x5F, 0xFC, 0x7A, 0xDA, 0x72, 0xAD, 0x97, 0x2A, 0xD9, 0x70, 0x9F, 0xEA,
+    0x5F, 0xFA, 0x40, 0x77, 0x79, 0xFA, 0x70, 0xFF, 0x6A, 0xD9, 0x1A, 0xDA, 0x5D, 0xA3, 0xE4, 0xAD,
+    0x4A, 0xC9, 0x4E, 0x59, 0x5D, 0xA7, 0x39, 0xD9, 0x71, 0xAA, 0xAD, 0xAA, 0xAA, 0xAA, 0x39, 0xFF,
+    0xDA, 0x6A, 0xD7, 0x4E, 0x29, 0x94, 0xFF, 0xE4, 0xAA, 0xAD, 0xA9, 0x99, 0x99, 0x69, 0xD9, 0x73,
+    0xAD, 0x74, 0xDA, 0x73, 0x9D, 0x95, 0x99, 0xA0, 0x9F, 0xFF, 0xD1, 0xEA, 0xFF, 0xD1, 0x9A, 0x69,
+    0x99, 0x91, 0x77, 0x77, 0x49, 0xAF, 0xFA, 0x97, 0x77, 0xFF, 0xFC, 0x77, 0x79, 0xAD, 0xA3, 0xAE,
+    0x77, 0x79, 0xDA, 0x4E, 0x97, 0x76, 0x9D, 0xA4, 0x9D, 0xA7, 0x76, 0x9D, 0xA5, 0xDA, 0x29, 0xC7,
+    0x71, 0x9D, 0xA5, 0xDA, 0x2D, 0x77, 0x19, 0xDA, 0x49, 0xD9, 0x2D, 0x77, 0x19, 0xDA, 0x4E, 0x09,
+    0xAF, 0xE2, 0x9F, 0xC9, 0x39, 0xDA, 0x2A, 0xE9, 0x0F, 0xFC, 0x1A, 0xDA, 0x9A, 0xD3, 0x9F, 0xFC,
+    0x93, 0x9D, 0x5D, 0x3C, 0xA3, 0x9F, 0xDA, 0x95, 0x9D, 0x5D, 0x92, 0x94, 0x9D, 0xA7, 0x29, 0xD5,
+    0xEA, 0x79, 0xDA, 0x72, 0x9D, 0x59, 0xFA, 0x59, 0xDA, 0x72, 0x9D, 0x7A, 0xF9, 0x39, 0xDA, 0x72,
+    0x9D, 0x71, 0x9E, 0x39, 0xDA, 0x72, 0x9D, 0x5A, 0x92, 0x9D, 0x39, 0xDA, 0x72, 0x9D, 0x94, 0xCA,
+    0x29, 0xD1, 0x9F, 0xE9, 0x70, 0xEA, 0xAA, 0x90, 0xD9, 0x9A, 0xD9, 0x1F, 0xFA, 0x70, 0xAF, 0xC1,
+    0xFD, 0x97, 0x76, 0x99, 0x59, 0x99, 0x30, 0x77, 0x72, 0xAF, 0xCA, 0x97, 0x9F, 0xFC, 0x95, 0xAE,
+    0xA9, 0x09, 0xAD, 0x59, 0xE5, 0xD5, 0xE6, 0xCA, 0x4A, 0xD9, 0x6A, 0x5E, 0x75, 0xAD, 0xA9, 0x99,
+    0x99, 0x95, 0xFF, 0xEA, 0x59, 0x9E, 0x99, 0x99, 0x99, 0x70, 0xE7, 0x39, 0xFF, 0xE5, 0x9A, 0xAE,
+    0xAA, 0xAA, 0xA9, 0x70, 0xAD, 0x97, 0x59, 0xDA, 0x76, 0xE7, 0x6A, 0xE7, 0x6F, 0xA9, 0x29, 0x9C,
+    0x6F, 0xFE, 0x79, 0xFE, 0xA7, 0x39, 0x99, 0x93, 0x49, 0x76, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x74,
+    0xAC, 0xA7, 0x4A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA0, 0xAC, 0xA7, 0x6A, 0xCA, 0x76, 0xAC, 0xA7,
+    0x6D, 0x97, 0x69, 0x72, 0x77, 0x1A, 0xCA, 0x70, 0xAE, 0xA6, 0xAF, 0xCA, 0x4A, 0xCA, 0x9C, 0x9A,
+    0xCA, 0x2A, 0xCA, 0x09, 0xC9, 0x0D, 0xA1, 0x9C, 0x19, 0xC9, 0x1C, 0x95, 0x9C, 0x97, 0x19, 0xC9,
+    0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x77, 0x10, 0x72, 0x97, 0x69, 0xD7, 0x6A,
+    0xD7, 0x6A, 0xD7, 0x6A, 0xCA, 0x0A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA7, 0x4A, 0xCA, 0x74, 0xAC,
+    0xA7, 0x4A, 0xCA, 0x74, 0x9D, 0x76, 0x94, 0x77, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x71, 0x9C,
+    0x97, 0x19, 0xC9, 0x71, 0x9C, 0x95, 0xAC, 0x19, 0xC9, 0x1C, 0x91, 0xAD, 0x09, 0xC9, 0x0D, 0xA2,
+    0xAD, 0x9C, 0x9D, 0xA4, 0xAF, 0xCA, 0x6A, 0xEA, 0x70, 0xAC, 0xA7, 0x71, 0x77, 0x6D, 0x4D, 0x7D,
+    0x94, 0x9D, 0x5D, 0x96, 0x9D, 0x3D, 0x97, 0x09, 0xD1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC1, 0xD9,
+    0x70, 0x9D, 0x3D, 0x96, 0x9D, 0x5D, 0x94, 0xAD, 0x7D, 0x4D, 0x77, 0x50, 0x59, 0x72, 0xE7, 0x0F,
+    0xC6, 0xFE, 0x4D, 0x99, 0xC9, 0x9D, 0x2D, 0xA0, 0x9C, 0x90, 0xAD, 0x2A, 0x19, 0xC9, 0x1A, 0x69,
+    0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C, 0x95, 0x9A, 0x19,
+    0xC9, 0x1A, 0x91, 0xDA, 0x09, 0xC9, 0x0A, 0xD2, 0xDA, 0x9C, 0x9A, 0xD4, 0xFE, 0x6F, 0xC7, 0x0E,
+    0x72, 0x95, 0x59, 0x72, 0xAC, 0xA7, 0x0F, 0xC6, 0xFE, 0x4D, 0xA9, 0xC9, 0xAD, 0x2D, 0xA0, 0x9C,
+    0x90, 0xAD, 0x19, 0xA1, 0x9C, 0x91, 0xA9, 0x59, 0xC9, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x71, 0x9C,
+    0x95, 0x9A, 0x19, 0xC9, 0x1A, 0x91, 0xDA, 0x09, 0xC9, 0x0A, 0xD2, 0xDA, 0x9C, 0x9A, 0xD4, 0xAF,
+    0xCA, 0x6A, 0xEA, 0x70, 0xAC, 0xA4, 0x9F, 0xFE, 0x99, 0xFF, 0xE9, 0x74, 0x77, 0x59, 0xD7, 0x19,
+    0xD7, 0x19, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD5, 0xC9, 0x2D, 0x4D, 0xA2, 0xD3, 0xAC, 0xA3,
+    0xD2, 0xAC, 0xA4, 0xD1, 0xAD, 0x99, 0x99, 0x99, 0xD1, 0xFF, 0xE1, 0xAD, 0x99, 0x99, 0x99, 0x99,
+    0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0x97, 0x72, 0x75, 0xD9, 0x71, 0xD7, 0x2D, 0x72, 0xD7,
+    0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD2, 0xAC, 0x5D, 0x2D, 0xA4, 0xD3, 0xAC, 0xA3, 0xD4, 0xAC, 0xA2,
+    0xD9, 0x99, 0x99, 0x9D, 0xA1, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x70, 0xDA, 0x70, 0xDA,
+    0x70, 0xDA, 0x71, 0x9A, 0x77, 0x10, 0x75, 0xAA, 0x75, 0x9D, 0x59, 0x69, 0xD4, 0x9D, 0x59, 0xD3,
+    0x9D, 0x95, 0x9D, 0x3D, 0x97, 0xD2, 0xD9, 0x70, 0xD1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x2D, 0xA7, 0x6D, 0xA7, 0x6D, 0xA7, 0x6D, 0x77, 0x72, 0x77, 0x5C, 0xA7, 0x5D, 0xA7,
+    0x4D, 0xA7, 0x4A, 0xFF, 0xFC, 0xA0, 0xAF, 0xFF, 0xDA, 0xAC, 0xA7, 0x5A, 0xCA, 0x76, 0xAF, 0xFF,
+    0xDA, 0x1A, 0xFF, 0xFC, 0xA2, 0xAC, 0xA7, 0x6A, 0xCA, 0x76, 0xC9, 0x77, 0x72, 0x59, 0x72, 0xAC,
+    0xA7, 0x0A, 0xEA, 0x6A, 0xCA, 0x0A, 0xCA, 0x4E, 0xA0, 0xAE, 0x2F, 0xA0, 0xAF, 0x09, 0xCA, 0x9C,
+    0xA0, 0xAC, 0x9A, 0xC9, 0x09, 0x09, 0xCA, 0x0A, 0xC9, 0x09, 0x39, 0xCA, 0x0A, 0xC9, 0x59, 0xCA,
+    0x0A, 0xC9, 0x5A, 0xCA, 0x0A, 0xC9, 0x5A, 0xCA, 0x0A, 0xC9, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA,
+    0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x77, 0x77,
+    0x72, 0xAC, 0x76, 0xAD, 0x76, 0xAC, 0xA2, 0xAF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFD, 0xA7, 0x6A, 0xCA,
+    0x75, 0xAC, 0xAA, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x75, 0x9C,
+    0x77, 0x50, 0x39, 0x29, 0x6A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA,
+    0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xCA, 0x5A, 0xCA, 0x0A, 0xC9, 0x59, 0xCA, 0x0A, 0xC9,
+    0x59, 0xCA, 0x0A, 0xC9, 0x59, 0xCA, 0x0A, 0xC9, 0x39, 0x09, 0xCA, 0x0A, 0xC9, 0x09, 0x09, 0xCA,
+    0x9C, 0xA0, 0xAC, 0x9A, 0xC9, 0x0A, 0xEA, 0x0A, 0xEA, 0x2A, 0xDA, 0x0A, 0xDA, 0x4A, 0xCA, 0x0A,
+    0xCA, 0x6A, 0xEA, 0x70, 0xAC, 0xA7, 0x71, 0x77, 0x79, 0xC4, 0xC9, 0x70, 0x9D, 0x92, 0x9D, 0x96,
+    0x9D, 0x6D, 0x95, 0xFF, 0xFC, 0x4F, 0xFF, 0xE2, 0xD7, 0x4D, 0x1D, 0x97, 0x29, 0xD2, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xC6, 0xD5, 0x9D, 0x70, 0xD9, 0x29, 0xD7, 0x19, 0xC4, 0xC9, 0x77, 0x70, 0x77, 0x2A,
+    0xDA, 0x73, 0xDA, 0x9E, 0x72, 0xAD, 0x90, 0xE9, 0x71, 0xE1, 0xAD, 0xA7, 0x09, 0xD9, 0x2E, 0x70,
+    0xAD, 0x3A, 0xD9, 0x7D, 0xA3, 0x9E, 0xAA, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0xC5, 0xAE, 0x99, 0x99,
+    0x9A, 0xD9, 0x6E, 0x4A, 0xD7, 0xE9, 0x3D, 0xA7, 0x9D, 0xA2, 0x9D, 0x71, 0xE2, 0xDA, 0x71, 0xAD,
+    0x91, 0xD9, 0x72, 0xE0, 0xAD, 0x73, 0xE0, 0xD9, 0x73, 0x9F, 0xC7, 0x5F, 0xA7, 0x5A, 0xE7, 0x69,
+    0xD9, 0x77, 0x97, 0x10, 0x69, 0x97, 0x0A, 0xFD, 0x5E, 0xAA, 0xF4, 0xC9, 0x39, 0xDA, 0x72, 0xAD,
+    0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA9, 0xE3, 0xAF, 0xFC, 0x2E, 0x91, 0x9F, 0x1A,
+    0xD5, 0xDA, 0x09, 0xD9, 0x5D, 0xA0, 0xE6, 0xD9, 0x0D, 0x95, 0x9D, 0x09, 0xD6, 0xAD, 0x0A, 0xD6,
+    0xDA, 0x0A, 0xD5, 0x9D, 0x1A, 0xD5, 0xDA, 0x1A, 0xD9, 0x39, 0xD2, 0x9E, 0x29, 0xD9, 0x3F, 0xF9,
+    0x5A, 0xFA, 0x77, 0x30, 0x74, 0xAF, 0xFE, 0xAA, 0xFF, 0xF0, 0x99, 0x95, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x09, 0x99, 0x99, 0x29, 0xE9, 0xFF, 0xF9, 0xFF, 0xF7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE9, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFF, 0xFF, 0xF9, 0x77, 0x77,
+    0x09, 0x99, 0x95, 0xC9, 0x7A, 0xFF, 0x91, 0xE5, 0x9F, 0xFE, 0xAE, 0x5A, 0xEA, 0x93, 0x9F, 0xC5,
+    0x9E, 0x70, 0xEA, 0x5E, 0x70, 0xAF, 0x93, 0x9D, 0xA7, 0xAD, 0x9D, 0xA3, 0xE7, 0xAD, 0x1E, 0x3D,
+    0xA6, 0xAD, 0x91, 0xAD, 0x29, 0xDA, 0x59, 0xD9, 0x29, 0xD9, 0x19, 0xD9, 0x49, 0xD9, 0x39, 0xD9,
+    0x19, 0xD9, 0x39, 0xD9, 0x49, 0xD9, 0x19, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x19, 0xDA, 0x19, 0xD9,
+    0x6A, 0xD3, 0xE1, 0xDA, 0x7E, 0x3A, 0xD9, 0xDA, 0x7A, 0xD9, 0x39, 0xFA, 0x70, 0xE5, 0xAE, 0x79,
+    0xE9, 0x5F, 0xC9, 0x39, 0xAE, 0xA5, 0xDA, 0xAF, 0xFE, 0x95, 0xE1, 0x9F, 0xFA, 0x79, 0xC5, 0x99,
+    0x99, 0x77, 0x77, 0x00, 0x71, 0x97, 0x79, 0xDA, 0x76, 0xF7, 0x59, 0xF7, 0x5F, 0xCA, 0x74, 0xD0,
+    0xE7, 0x3A, 0xCA, 0x0A, 0xD9, 0x72, 0xD9, 0x09, 0xDA, 0x71, 0x9D, 0x2E, 0x71, 0xDA, 0x2A, 0xD9,
+    0x79, 0xD3, 0x9E, 0x7A, 0xD4, 0xE7, 0xD9, 0x4A, 0xDA, 0x5A, 0xD6, 0xE5, 0xDA, 0x6E, 0x49, 0xD7,
+    0xAD, 0xA3, 0xE7, 0x0E, 0x3D, 0x97, 0x0E, 0x91, 0xAD, 0x97, 0x0A, 0xDA, 0x1F, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xFC, 0x00, 0x77, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1E, 0x97, 0x1E, 0x1A, 0xDA, 0x70,
+    0x9D, 0x92, 0xE7, 0x0A, 0xD3, 0xE9, 0x7D, 0xA3, 0x9E, 0x69, 0xD5, 0xE6, 0xE5, 0xAD, 0xA5, 0xD9,
+    0x6E, 0x4A, 0xD7, 0xE9, 0x3D, 0xA7, 0x9D, 0xA2, 0x9D, 0x71, 0xE2, 0xAC, 0xA7, 0x1A, 0xD9, 0x1D,
+    0x97, 0x2E, 0x0A, 0xD7, 0x3E, 0x0D, 0x97, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0xAE, 0x76, 0x9D, 0x97,
+    0x79, 0x71, 0x77, 0x70, 0x9A, 0xFF, 0xDA, 0x39, 0xFF, 0xFC, 0xA2, 0xAE, 0xA9, 0x97, 0x29, 0xE7,
+    0x6E, 0x76, 0xAD, 0x77, 0xE7, 0x69, 0xD9, 0x76, 0x9D, 0x97, 0x6A, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF,
+    0xFC, 0x99, 0xD9, 0x76, 0x9D, 0xA7, 0x7E, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x9E, 0x97, 0x69, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFF, 0xCA, 0x59, 0xAF, 0xFD, 0xA0, 0x77, 0x77, 0x0D, 0x77,
+    0xAD, 0x70, 0x9A, 0xFF, 0xDA, 0x39, 0xFF, 0xFC, 0xA2, 0xAE, 0xA9, 0x91, 0xAD, 0x59, 0xE5, 0xDA,
+    0x5E, 0x6D, 0x5A, 0xD6, 0x9D, 0x5E, 0x6D, 0xA4, 0x9D, 0x96, 0xD5, 0x9D, 0x95, 0xAD, 0x5A, 0xFF,
+    0xFF, 0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xD9, 0x49, 0xD6, 0x9D, 0xA4, 0xDA, 0x7E, 0x4D, 0x97, 0xAD,
+    0x92, 0x9D, 0x71, 0xE2, 0xAC, 0xA7, 0x19, 0xE9, 0x0D, 0x97, 0x29, 0xFD, 0x99, 0x99, 0x99, 0x99,
+    0x49, 0xFF, 0xFC, 0xA5, 0x9F, 0xFE, 0xA5, 0x9D, 0x77, 0xAC, 0xA7, 0x79, 0x97, 0x20, 0x49, 0xAF,
+    0xFE, 0x92, 0x9F, 0xFF, 0xDA, 0x1A, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xE9, 0x75, 0xE7,
+    0x7D, 0xA7, 0x69, 0xDA, 0x29, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF,
+    0xA0, 0x9D, 0x97, 0x7E, 0x77, 0xAD, 0x97, 0x7E, 0xA7, 0x69, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x93, 0xAF, 0xFF, 0xCA, 0x59, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x2A, 0xFF, 0xDA, 0x95,
+    0xAF, 0xFF, 0xC9, 0x74, 0x99, 0xAE, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x77, 0x9D,
+    0x97, 0x69, 0xD9, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xC9, 0x76, 0x9D, 0x97, 0x6A, 0xD9, 0x76,
+    0xE7, 0x69, 0xDA, 0x76, 0xE7, 0x59, 0xE9, 0x29, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x92, 0xAF, 0xFF,
+    0xC4, 0xAF, 0xFD, 0xA9, 0x50, 0x77, 0x5D, 0x77, 0x0D, 0xA7, 0x4A, 0xFF, 0xDA, 0x95, 0xAF, 0xFF,
+    0xC9, 0x7D, 0xA1, 0x99, 0xAE, 0xA6, 0xAD, 0x5E, 0x96, 0xD6, 0xE6, 0xD9, 0x59, 0xDA, 0x5A, 0xD6,
+    0xE6, 0xD6, 0x9D, 0x95, 0xDA, 0x59, 0xD9, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x6D, 0x94,
+    0x9D, 0x96, 0xAD, 0x4A, 0xD9, 0x69, 0xD4, 0xE7, 0x0D, 0x92, 0x9D, 0xA7, 0x0A, 0xCA, 0x2E, 0x71,
+    0x9D, 0x09, 0xE9, 0x29, 0x99, 0x99, 0x99, 0x9F, 0xD9, 0x2A, 0xFF, 0xFC, 0x93, 0xAF, 0xFE, 0x97,
+    0x7D, 0x97, 0x7A, 0xCA, 0x77, 0x09, 0x95, 0x9F, 0xFE, 0xA9, 0x4A, 0xFF, 0xFD, 0x93, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xAF, 0x97, 0x69, 0xE9, 0x77, 0xE7, 0x7A, 0xD2, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x2A, 0xD9, 0x0A, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xF9, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0x9D, 0xA7,
+    0x5A, 0xE1, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFF, 0xCA, 0x39, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x99, 0x50, 0x77, 0x5A, 0xFF, 0xFF, 0xF9, 0x9F, 0xFF, 0xFD, 0xA9, 0x3E, 0x70, 0xAD,
+    0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7,
+    0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA,
+    0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70,
+    0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x70, 0x9D, 0xA5,
+    0xE7, 0x09, 0xDA, 0x4A, 0xEA, 0x95, 0x9A, 0xEA, 0x90, 0xAF, 0xEA, 0x3F, 0xF0, 0x9A, 0xAA, 0xAA,
+    0xAA, 0x4A, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x29, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xDA, 0x2E, 0xA7,
+    0xE2, 0x9E, 0x96, 0x9D, 0x3A, 0xE7, 0xD4, 0xF6, 0xA9, 0x5E, 0xA7, 0x59, 0xE7, 0x6A, 0xE7, 0x6E,
+    0xA7, 0x6E, 0x97, 0x5A, 0xDA, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x5E, 0x75, 0xE7, 0x5A,
+    0xD9, 0x74, 0x9D, 0xA7, 0x9C, 0x3E, 0x70, 0xD9, 0x1E, 0x71, 0xD1, 0xAD, 0xA7, 0x9A, 0xD1, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xEA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF0, 0xFF, 0xF7,
+    0x50, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0x97,
+    0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x71, 0xAD, 0x71, 0xD9, 0x70, 0xAD, 0x71,
+    0xD9, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x29, 0x72,
+    0xAC, 0xA7, 0x19, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x2D, 0x97, 0x1A, 0xD7,
+    0x2D, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xD7, 0x2D,
+    0xA7, 0x19, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x29, 0x90, 0x59, 0x97, 0x3D,
+    0x73, 0xD6, 0x9A, 0x2D, 0x29, 0x91, 0xE9, 0x0D, 0x1E, 0x2A, 0xDA, 0xDA, 0xDA, 0x5F, 0xD9, 0x69,
+    0xF9, 0x59, 0xFF, 0x92, 0xAD, 0xA0, 0xD0, 0xAE, 0x1A, 0xC9, 0x1D, 0x19, 0xCA, 0x6D, 0x73, 0xD7,
+    0x3D, 0x50, 0x73, 0xAF, 0xA2, 0xAD, 0xAA, 0xE0, 0x9D, 0x3D, 0x9A, 0xCA, 0x3A, 0xCA, 0xAC, 0x93,
+    0x9C, 0xAA, 0xCA, 0x3A, 0xCA, 0x9D, 0x91, 0x9D, 0x1A, 0xFD, 0x92, 0x9A, 0xDA, 0x20, 0x09, 0xD9,
+    0x1F, 0x1F, 0x19, 0xD9, 0x00, 0x76, 0x99, 0x97, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x76, 0xDA,
+    0x76, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD2, 0x99, 0x99, 0x99, 0x5D,
+    0xA2, 0xFD, 0x49, 0xD3, 0xFD, 0x4A, 0xD6, 0xAD, 0x93, 0xDA, 0x7D, 0xA3, 0xD9, 0x7E, 0x29, 0xD7,
+    0x0A, 0xD2, 0xDA, 0x70, 0x9D, 0x91, 0xD9, 0x71, 0xE0, 0x9D, 0x72, 0xAD, 0x0A, 0xCA, 0x72, 0x9D,
+    0x9D, 0x97, 0x3F, 0xC7, 0x4A, 0xF7, 0x49, 0xE9, 0x75, 0xE7, 0x6E, 0x77, 0x97, 0x00, 0x77, 0x9E,
+    0x93, 0xAC, 0xA0, 0xAF, 0xCA, 0x1A, 0xD9, 0x9D, 0x90, 0x9D, 0xA9, 0xCA, 0x1A, 0xC9, 0x3F, 0x2D,
+    0x49, 0xD3, 0xD4, 0x9D, 0x92, 0xAC, 0xA2, 0x9F, 0x29, 0xEA, 0xAD, 0x09, 0xDA, 0x1A, 0xFC, 0x29,
+    0xDA, 0x29, 0x99, 0x5A, 0x90, 0x2A, 0xDA, 0x4A, 0xDA, 0x3F, 0xD1, 0x9F, 0xD1, 0xDA, 0x1A, 0xCA,
+    0x0D, 0x90, 0x9D, 0x99, 0xD3, 0xF3, 0xAC, 0xA9, 0xCA, 0x4D, 0x93, 0x9C, 0xA9, 0xCA, 0x39, 0xDA,
+    0x39, 0xCA, 0x9D, 0x3F, 0xA2, 0xD9, 0x0E, 0xAA, 0xD1, 0xEA, 0xE2, 0xFC, 0x3F, 0xC4, 0x99, 0x95,
+    0x99, 0x92, 0x77, 0x29, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79,
+    0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79,
+    0xD7, 0x79, 0xD7, 0x79, 0xD7, 0x79, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xFF, 0xC0, 0x9F, 0xFF, 0xFC, 0x00, 0x77, 0x77, 0x4C, 0x97, 0x71, 0xE7, 0x70, 0xAD, 0xA7, 0x79,
+    0xE7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA,
+    0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xFD, 0x90, 0x09, 0x91,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xAA, 0x90, 0x99, 0x92, 0x99, 0x0A,
+    0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1,
+    0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D,
+    0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A,
+    0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1,
+    0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D, 0x0A, 0xD1, 0x9D,
+    0x0A, 0xD1, 0x9D, 0x09, 0xAA, 0x2A, 0xA0, 0x77, 0x72, 0xE7, 0x7E, 0xA7, 0x5A, 0xF7, 0x5D, 0xAD,
+    0x97, 0x39, 0xD0, 0xDA, 0x73, 0xDA, 0x0A, 0xD7, 0x3D, 0x91, 0xD9, 0x71, 0xAD, 0x2E, 0x71, 0xDA,
+    0x29, 0xD7, 0x09, 0xD4, 0xDA, 0x7A, 0xD4, 0xAD, 0x7D, 0xA4, 0x9D, 0x95, 0x9D, 0x6D, 0xA5, 0xE6,
+    0xAD, 0x5D, 0x97, 0xD9, 0x3A, 0xD7, 0x0E, 0x3D, 0xA7, 0x09, 0xD9, 0x19, 0xD9, 0x71, 0xDA, 0x1E,
+    0x72, 0xAD, 0x1D, 0xA7, 0x29, 0xD9, 0x77, 0x3D, 0xA7, 0x29, 0xD9, 0x0A, 0xD7, 0x2A, 0xD1, 0x9D,
+    0x97, 0x1D, 0xA2, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0E, 0x4D, 0x97, 0xD9, 0x4E, 0x6A, 0xD5, 0x9D,
+    0x6D, 0xA6, 0xDA, 0x49, 0xD9, 0x6A, 0xD4, 0xAD, 0x79, 0xD9, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x71,
+    0x9D, 0x2E, 0x72, 0xD9, 0x1D, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0x9D, 0x0D, 0xA7, 0x4F, 0xC7, 0x5A,
+    0xF7, 0x6E, 0x97, 0x6E, 0x70, 0x59, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x94, 0x9F, 0xFE, 0x92, 0x9E,
+    0x94, 0x9E, 0x91, 0xE7, 0x0E, 0x1D, 0xA7, 0x0A, 0xD0, 0x9D, 0x97, 0x09, 0xD9, 0x9D, 0x72, 0xD9,
+    0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD,
+    0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72,
+    0xDA, 0xAD, 0x72, 0xDA, 0xAD, 0x72, 0xDA, 0x77, 0x0A, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7,
+    0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D,
+    0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xAA, 0xD7, 0x2D, 0xA9,
+    0xD7, 0x2D, 0x99, 0xD9, 0x70, 0x9D, 0x90, 0xDA, 0x70, 0xAD, 0x1E, 0x96, 0x9E, 0x19, 0xEA, 0x4A,
+    0xE3, 0x9F, 0xFE, 0x95, 0xAF, 0xEA, 0x71, 0x99, 0x99, 0x95, 0x71, 0x9A, 0xA9, 0x71, 0x9F, 0xD7,
+    0x0E, 0xAE, 0x96, 0xAD, 0x2D, 0x7D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xD9, 0x73, 0x9D,
+    0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97,
+    0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39,
+    0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0xD2, 0xE6, 0x9E, 0xAA, 0xD9,
+    0x7F, 0xD9, 0x71, 0x9A, 0xA9, 0x71, 0x70, 0x97, 0x70, 0xE9, 0x75, 0x9E, 0xA7, 0x59, 0xE9, 0x76,
+    0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x97, 0x29, 0x92, 0xEA, 0x70,
+    0xAE, 0x1F, 0x70, 0xF1, 0xEA, 0x70, 0xAE, 0x29, 0x97, 0x29, 0x91, 0x19, 0x97, 0x39, 0x2E, 0xA7,
+    0x09, 0xE1, 0xF7, 0x0F, 0x1E, 0xA7, 0x0A, 0xE2, 0xA9, 0x72, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x99, 0x77, 0xE9, 0x75, 0x9E, 0xA7, 0x59, 0xE9, 0x77, 0x97, 0x00, 0x5E,
+    0x0A, 0xEA, 0x9E, 0x90, 0x9A, 0x97, 0x77, 0x70, 0x92, 0xE9, 0xAE, 0xA9, 0xE9, 0x09, 0xA9, 0x00,
+    0x19, 0x97, 0x39, 0x2E, 0xA7, 0x09, 0xE1, 0xF7, 0x0F, 0x1E, 0xA7, 0x0A, 0xE2, 0xA9, 0x72, 0x99,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x72, 0x99, 0x2E, 0xA7, 0x0A, 0xE1,
+    0xF7, 0x0F, 0x1E, 0xA7, 0x0A, 0xE2, 0x99, 0x72, 0x99, 0x10, 0x39, 0x99, 0x73, 0xAF, 0xCA, 0x4D,
+    0x1A, 0xDA, 0xAF, 0xA9, 0x9D, 0xA1, 0xD3, 0x9A, 0xFC, 0xA2, 0x97, 0x9A, 0x93, 0x29, 0xAA, 0xA6,
+    0x99, 0x2F, 0xE9, 0x3D, 0x1E, 0x99, 0xAF, 0xAA, 0xD9, 0x1C, 0xA4, 0x9F, 0xC9, 0x74, 0x97, 0x77,
+    0x77, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x77, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xE1,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x2A, 0xA9, 0x59, 0x19, 0xFC, 0x92, 0xAC, 0xA0,
+    0xEA, 0xF9, 0xAD, 0x99, 0xD2, 0xAF, 0xCA, 0x1A, 0x5A, 0xD9, 0x4A, 0xA9, 0x59, 0x19, 0xFC, 0x92,
+    0xAC, 0x90, 0xFF, 0x9A, 0xD9, 0x9D, 0x2A, 0xFC, 0xA1, 0xC4, 0x9A, 0xDA, 0x10, 0x09, 0x74, 0x91,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xF1, 0xAF, 0xFF, 0xCA, 0x49, 0x9A, 0xAA, 0xAA, 0x99, 0x77, 0x77, 0x70,
+    0x9A, 0xAA, 0xEA, 0xAA, 0x93, 0xFF, 0xFE, 0x1D, 0xAA, 0x99, 0x99, 0x99, 0x9A, 0xAD, 0x77, 0x10,
+    0x70, 0xA7, 0x2D, 0x29, 0x99, 0x99, 0x99, 0xAD, 0x99, 0x0F, 0xFF, 0x0A, 0xAA, 0xAA, 0xAD, 0xAA,
+    0xAA, 0x5A, 0xC9, 0x71, 0xD5, 0x99, 0x99, 0xD9, 0x99, 0x99, 0x90, 0xFF, 0xF0, 0xAA, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x2D, 0x72, 0xCA, 0x77, 0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x73, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0x77, 0x79, 0xC9, 0x70, 0x9F, 0x69, 0xFA, 0x59, 0xF9, 0x59, 0xF9, 0x6F, 0x97,
+    0x0F, 0x97, 0x1A, 0xF9, 0x71, 0xAE, 0xA7, 0x2A, 0xEA, 0x71, 0x9F, 0xA7, 0x19, 0xDA, 0x73, 0x97,
+    0x77, 0x6F, 0xFF, 0x1F, 0xFF, 0x00, 0x76, 0x9C, 0x97, 0x2F, 0x97, 0x1A, 0xEA, 0x72, 0xFA, 0x71,
+    0x9F, 0xA7, 0x19, 0xFA, 0x71, 0xAE, 0x79, 0xAE, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA7, 0xAD,
+    0xA7, 0x29, 0x77, 0x77, 0x7F, 0xFF, 0x1F, 0xFF, 0x00, 0x77, 0x77, 0x9C, 0xA7, 0xAC, 0x79, 0xF5,
+    0xAE, 0x94, 0x9F, 0xA4, 0xAF, 0x93, 0x9F, 0x94, 0xAE, 0xA4, 0x9F, 0x94, 0xAE, 0xA5, 0xF9, 0x49,
+    0xEA, 0x7F, 0x95, 0xF9, 0x79, 0xF9, 0x4A, 0xF7, 0x09, 0xF9, 0x4A, 0xEA, 0x70, 0xAF, 0x94, 0xAE,
+    0xA7, 0x0A, 0xF4, 0x9F, 0xA7, 0x0A, 0xD6, 0x9D, 0x97, 0x74, 0x90, 0x77, 0x7C, 0xA7, 0xAC, 0x97,
+    0x0A, 0xEA, 0x5F, 0x97, 0x9F, 0xA4, 0xAF, 0x97, 0x0A, 0xEA, 0x49, 0xF9, 0x70, 0xAE, 0xA4, 0x9F,
+    0x97, 0x0A, 0xE5, 0x9F, 0x69, 0xF5, 0xAE, 0xA4, 0x9F, 0xA4, 0x9F, 0x94, 0xAE, 0xA4, 0x9F, 0x94,
+    0xAE, 0xA4, 0x9F, 0x94, 0xAF, 0x94, 0xFA, 0x69, 0xD9, 0x6D, 0xA7, 0x19, 0x77, 0x40, 0x9F, 0xFC,
+    0xAA, 0x95, 0xAF, 0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x76, 0x9E, 0x97, 0x69,
+    0xE7, 0x7A, 0xD7, 0x79, 0xD9, 0x77, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xD9, 0x76, 0xE7, 0x69, 0xE7,
+    0x5A, 0xE1, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x1A, 0xFF, 0xFC, 0xA3, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x95, 0x75, 0x97, 0x70, 0xAC, 0xA7, 0x7D, 0x97, 0x69, 0xD7, 0x7A, 0xCA, 0x71,
+    0x9A, 0xAF, 0xFC, 0x93, 0xFF, 0xFD, 0xA1, 0x9F, 0xAA, 0xAA, 0xEA, 0xAA, 0xA9, 0x09, 0xE9, 0x4D,
+    0x95, 0xE9, 0x49, 0xD6, 0xDA, 0x5A, 0xD5, 0x9D, 0x95, 0xD9, 0x5A, 0xD5, 0x9D, 0x6A, 0xD5, 0xAD,
+    0x69, 0xD9, 0x4D, 0x97, 0xDA, 0x4D, 0x70, 0xE9, 0x2A, 0xD7, 0x1E, 0x91, 0xDA, 0x71, 0x9F, 0xAD,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFD, 0xA5, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0x96, 0xD7, 0x79,
+    0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x79, 0x97, 0x20, 0x72, 0x99, 0x77, 0x9D, 0x77, 0xAC, 0xA7, 0x7D,
+    0x97, 0x69, 0xD6, 0x9F, 0xFE, 0x95, 0xAF, 0xFF, 0xD3, 0x9A, 0xAA, 0xAA, 0xAA, 0xAD, 0xAF, 0x97,
+    0x1A, 0xCA, 0x19, 0xE9, 0x70, 0xD9, 0x29, 0xE7, 0x9D, 0x4A, 0xD7, 0xAD, 0x49, 0xD9, 0x6D, 0x95,
+    0xDA, 0x6D, 0x59, 0xDA, 0x5A, 0xD5, 0x9D, 0x95, 0xD9, 0x5E, 0x6D, 0x59, 0xE5, 0xAD, 0x4A, 0xE1,
+    0x9A, 0xAA, 0xAE, 0xAA, 0xAA, 0xF9, 0x1A, 0xFF, 0xFC, 0xA3, 0x9A, 0xAA, 0xEA, 0xAA, 0xAA, 0x97,
+    0x1D, 0xA7, 0x7D, 0x77, 0x9D, 0x77, 0xDA, 0x77, 0x99, 0x75, 0x77, 0x7A, 0xFF, 0xFA, 0x2A, 0xFF,
+    0xFD, 0xA1, 0xAE, 0xA9, 0x73, 0x9E, 0x76, 0xE7, 0x69, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x79,
+    0xD9, 0x76, 0x9D, 0x97, 0x7E, 0x77, 0xAD, 0xA7, 0x7F, 0x97, 0x6F, 0xFF, 0xEA, 0x39, 0xFF, 0xFC,
+    0xA6, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x1A, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x77, 0x2A, 0xFF, 0xFA, 0x4A, 0xFF, 0xFD, 0xA7, 0x59,
+    0xAE, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0xAD, 0x97, 0x69, 0xD9, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x69,
+    0xD9, 0x76, 0xE7, 0x6A, 0xDA, 0x74, 0x9F, 0x1A, 0xFF, 0xFE, 0x2A, 0xFF, 0xFC, 0x94, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x77, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF,
+    0xFA, 0x0A, 0xFF, 0xFF, 0xA0, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x9A, 0xCA, 0x9A,
+    0xDA, 0x6D, 0xA2, 0x9C, 0x92, 0xAD, 0x4D, 0x93, 0x9C, 0x93, 0x9D, 0x29, 0xCA, 0x49, 0xC9, 0x4A,
+    0xC9, 0x1D, 0x59, 0xC9, 0x5D, 0x09, 0xC9, 0x59, 0xC9, 0x5A, 0xC9, 0xAC, 0x69, 0xC9, 0x6C, 0xAD,
+    0x69, 0xC9, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x9C, 0x96, 0xDA, 0xC6, 0x9C, 0x96, 0xCA,
+    0x9C, 0x95, 0x9C, 0x95, 0x9C, 0x90, 0xD5, 0x9C, 0x95, 0xD1, 0xAC, 0xA4, 0x9C, 0x94, 0xAC, 0xA2,
+    0xD9, 0x39, 0xC9, 0x39, 0xD4, 0xDA, 0x29, 0xC9, 0x2A, 0xD6, 0xAD, 0xA9, 0xAC, 0xA9, 0xAD, 0xA7,
+    0x09, 0xFF, 0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x99,
+    0x09, 0x9A, 0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xD9, 0x72, 0x9D, 0x29, 0xCA, 0x74, 0xAC, 0x91, 0xD7,
+    0x6D, 0x09, 0xC9, 0x76, 0xAC, 0x9A, 0xC7, 0x70, 0xCA, 0xD7, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFD, 0x77, 0x0D, 0xAC, 0x77, 0x0C, 0xA9, 0xC9, 0x76, 0x9C, 0x90, 0xD7, 0x6D, 0x1A, 0xCA, 0x74,
+    0xAC, 0xA2, 0xD9, 0x72, 0x9D, 0x4D, 0xA7, 0x0A, 0xD6, 0xAD, 0xA9, 0x29, 0xAD, 0xA7, 0x09, 0xFF,
+    0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x99, 0x09, 0x9A,
+    0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xE7, 0x19, 0xE2, 0x9C, 0xAD, 0x79, 0xDA, 0xC9, 0x1D, 0x09, 0xD5,
+    0x9D, 0x90, 0xD0, 0x9C, 0x91, 0x9D, 0x39, 0xD9, 0x19, 0xC9, 0xAC, 0x39, 0xD1, 0x9D, 0x93, 0xCA,
+    0xD4, 0x9D, 0x9D, 0x5F, 0x59, 0xE6, 0xF5, 0x9E, 0x6F, 0x49, 0xDA, 0xD5, 0xDA, 0xC3, 0x9D, 0x19,
+    0xD4, 0xCA, 0x9C, 0x91, 0x9D, 0x39, 0xD2, 0x9C, 0x90, 0xD0, 0x9D, 0x59, 0xD1, 0xD1, 0xAC, 0xAD,
+    0x79, 0xDA, 0xCA, 0x2E, 0x71, 0x9E, 0x4D, 0xA7, 0x0A, 0xD6, 0xAD, 0xA9, 0x29, 0xAD, 0xA7, 0x09,
+    0xFF, 0xC9, 0x74, 0x99, 0x99, 0x97, 0x70, 0x99, 0x97, 0x6A, 0xFE, 0xA7, 0x1A, 0xDA, 0x99, 0x09,
+    0x9A, 0xDA, 0x6D, 0xA7, 0x0A, 0xD4, 0xD9, 0x71, 0x9E, 0x29, 0xCA, 0x71, 0x9D, 0xAC, 0x91, 0xD7,
+    0x19, 0xD9, 0x0D, 0x09, 0xC9, 0x70, 0x9D, 0x91, 0x9C, 0x9A, 0xC7, 0x09, 0xD9, 0x3C, 0xAD, 0x79,
+    0xD9, 0x4F, 0x69, 0xD9, 0x5F, 0x59, 0xD9, 0x6F, 0x49, 0xD9, 0x7D, 0xAC, 0x39, 0xD9, 0x70, 0xCA,
+    0x9C, 0x91, 0x9D, 0x97, 0x09, 0xC9, 0x0D, 0x09, 0xD9, 0x71, 0xD1, 0xAC, 0xAD, 0x97, 0x1A, 0xCA,
+    0x2E, 0x97, 0x19, 0xD4, 0xDA, 0x70, 0xAD, 0x6A, 0xDA, 0x92, 0x9A, 0xDA, 0x70, 0x9F, 0xFC, 0x97,
+    0x49, 0x99, 0x99, 0x70, 0x77, 0x7E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x69, 0xAA,
+    0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x1A, 0xA9, 0x1F, 0x1F,
+    0x1A, 0xDA, 0x60, 0x1A, 0xA6, 0x9A, 0xA6, 0xAA, 0x91, 0xF4, 0x9E, 0x94, 0xAE, 0x1F, 0x4A, 0xEA,
+    0x4F, 0x1E, 0x95, 0xE5, 0x9D, 0xA7, 0x77, 0x10, 0x74, 0xA7, 0x77, 0x0A, 0xCA, 0x77, 0x6A, 0xEA,
+    0x77, 0x4A, 0xFC, 0xA7, 0x72, 0xAC, 0xA9, 0x9A, 0xDA, 0x77, 0x0A, 0xC5, 0xAC, 0xA7, 0x6A, 0xCA,
+    0x69, 0xCA, 0x74, 0xAE, 0x09, 0xAA, 0x92, 0xAC, 0xA7, 0x2A, 0xFF, 0xD2, 0xDA, 0x70, 0xAF, 0xFF,
+    0x1E, 0xA6, 0xAF, 0xFF, 0xC1, 0xAE, 0xA4, 0xAF, 0xFF, 0xD1, 0xAF, 0xA2, 0xAF, 0xFF, 0xD9, 0x1A,
+    0xFC, 0xA0, 0xAF, 0xFE, 0xA9, 0x4F, 0xEA, 0x0F, 0xFD, 0x6F, 0xF2, 0xFF, 0xC4, 0xAF, 0xF4, 0xFF,
+    0x2A, 0xFF, 0xC6, 0xFE, 0x1A, 0xFF, 0xC7, 0x0F, 0xD9, 0x09, 0xFF, 0x72, 0xFF, 0xFE, 0x74, 0xFD,
+    0xAF, 0xD7, 0x6F, 0x2F, 0x77, 0x0E, 0x2E, 0x77, 0x2D, 0x90, 0xAD, 0x77, 0x4F, 0xC7, 0x76, 0xE7,
+    0x77, 0x0C, 0x77, 0x77, 0x70,
 };
 
 static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 5, 23, 8, 2, 22, 29, 0 }, // !
-    { 9, 9, 11, 1, 21, 21, 29 }, // "
-    { 18, 19, 19, 0, 17, 86, 50 }, // #
-    { 14, 30, 18, 2, 24, 105, 136 }, // $
-    { 26, 24, 28, 1, 22, 156, 241 }, // %
-    { 22, 23, 24, 1, 22, 127, 397 }, // &
-    { 4, 9, 6, 1, 21, 9, 524 }, // '
-    { 9, 29, 11, 1, 24, 66, 533 }, // (
-    { 10, 29, 11, 0, 24, 73, 599 }, // )
-    { 10, 11, 11, 0, 22, 28, 672 }, // *
-    { 13, 14, 18, 3, 17, 46, 700 }, // +
-    { 7, 10, 8, 0, 4, 18, 746 }, // ,
-    { 9, 3, 11, 1, 9, 7, 764 }, // -
-    { 6, 5, 8, 1, 4, 8, 771 }, // .
-    { 13, 23, 15, 1, 21, 75, 779 }, // /
-    { 16, 22, 18, 1, 21, 88, 854 }, // 0
-    { 12, 21, 18, 3, 21, 63, 942 }, // 1
-    { 14, 21, 18, 2, 21, 74, 1005 }, // 2
-    { 13, 22, 18, 2, 21, 72, 1079 }, // 3
-    { 16, 22, 18, 1, 21, 88, 1151 }, // 4
-    { 14, 21, 18, 2, 20, 74, 1239 }, // 5
-    { 14, 22, 18, 2, 21, 77, 1313 }, // 6
-    { 15, 21, 18, 2, 20, 79, 1390 }, // 7
-    { 14, 22, 18, 2, 21, 77, 1469 }, // 8
-    { 15, 22, 18, 1, 21, 83, 1546 }, // 9
-    { 6, 16, 8, 1, 15, 24, 1629 }, // :
-    { 7, 21, 8, 0, 15, 37, 1653 }, // ;
-    { 14, 14, 18, 2, 17, 49, 1690 }, // <
-    { 13, 8, 18, 3, 14, 26, 1739 }, // =
-    { 14, 14, 18, 2, 17, 49, 1765 }, // >
-    { 11, 23, 14, 2, 22, 64, 1814 }, // ?
-    { 26, 26, 28, 1, 20, 169, 1878 }, // @
-    { 22, 21, 23, 0, 21, 116, 2047 }, // A
-    { 16, 22, 18, 1, 21, 88, 2163 }, // B
-    { 17, 22, 19, 1, 21, 94, 2251 }, // C
-    { 20, 22, 22, 1, 21, 110, 2345 }, // D
-    { 17, 21, 19, 1, 21, 90, 2455 }, // E
-    { 15, 21, 17, 1, 21, 79, 2545 }, // F
-    { 19, 22, 21, 1, 21, 105, 2624 }, // G
-    { 23, 21, 25, 1, 21, 121, 2729 }, // H
-    { 9, 21, 11, 1, 21, 48, 2850 }, // I
-    { 12, 27, 11, -2, 21, 81, 2898 }, // J
-    { 21, 22, 23, 1, 21, 116, 2979 }, // K
-    { 17, 21, 19, 1, 21, 90, 3095 }, // L
-    { 26, 21, 27, 0, 21, 137, 3185 }, // M
-    { 22, 22, 24, 1, 21, 121, 3322 }, // N
-    { 21, 22, 23, 1, 21, 116, 3443 }, // O
-    { 16, 21, 18, 1, 21, 84, 3559 }, // P
-    { 22, 27, 24, 1, 21, 149, 3643 }, // Q
-    { 20, 22, 22, 1, 21, 110, 3792 }, // R
-    { 14, 22, 16, 1, 21, 77, 3902 }, // S
-    { 18, 21, 20, 1, 21, 95, 3979 }, // T
-    { 22, 22, 23, 0, 21, 121, 4074 }, // U
-    { 21, 22, 22, 0, 21, 116, 4195 }, // V
-    { 32, 22, 33, 0, 21, 176, 4311 }, // W
-    { 21, 21, 22, 0, 21, 111, 4487 }, // X
-    { 20, 21, 21, 0, 21, 105, 4598 }, // Y
-    { 16, 22, 18, 1, 21, 88, 4703 }, // Z
-    { 6, 28, 9, 2, 23, 42, 4791 }, // [
-    { 13, 23, 15, 1, 21, 75, 4833 }, // <backslash>
-    { 6, 28, 9, 1, 23, 42, 4908 }, // ]
-    { 14, 14, 18, 2, 19, 49, 4950 }, // ^
-    { 15, 3, 16, 0, -1, 12, 4999 }, // _
-    { 7, 7, 19, 6, 24, 13, 5011 }, // `
-    { 15, 17, 17, 1, 16, 64, 5024 }, // a
-    { 18, 24, 18, -1, 23, 108, 5088 }, // b
-    { 13, 17, 15, 1, 16, 56, 5196 }, // c
-    { 17, 24, 19, 1, 23, 102, 5252 }, // d
-    { 13, 17, 15, 1, 16, 56, 5354 }, // e
-    { 14, 23, 15, 0, 23, 81, 5410 }, // f
-    { 17, 23, 18, 0, 16, 98, 5491 }, // g
-    { 19, 23, 20, 0, 23, 110, 5589 }, // h
-    { 10, 23, 11, 0, 23, 58, 5699 }, // i
-    { 9, 30, 8, -2, 23, 68, 5757 }, // j
-    { 18, 24, 19, 0, 23, 108, 5825 }, // k
-    { 9, 23, 10, 0, 23, 52, 5933 }, // l
-    { 29, 16, 30, 0, 16, 116, 5985 }, // m
-    { 19, 16, 20, 0, 16, 76, 6101 }, // n
-    { 16, 17, 18, 1, 16, 68, 6177 }, // o
-    { 17, 23, 18, 0, 16, 98, 6245 }, // p
-    { 17, 23, 19, 1, 16, 98, 6343 }, // q
-    { 13, 16, 14, 0, 16, 52, 6441 }, // r
-    { 12, 17, 14, 1, 16, 51, 6493 }, // s
-    { 12, 20, 13, 0, 19, 60, 6544 }, // t
-    { 19, 17, 20, 0, 16, 81, 6604 }, // u
-    { 18, 16, 19, 0, 15, 72, 6685 }, // v
-    { 26, 16, 27, 0, 15, 104, 6757 }, // w
-    { 17, 15, 18, 0, 15, 64, 6861 }, // x
-    { 18, 22, 19, 0, 15, 99, 6925 }, // y
-    { 14, 16, 15, 0, 15, 56, 7024 }, // z
-    { 9, 29, 12, 2, 24, 66, 7080 }, // {
-    { 4, 27, 8, 2, 23, 27, 7146 }, // |
-    { 9, 29, 11, 0, 24, 66, 7173 }, // }
-    { 14, 6, 18, 2, 13, 21, 7239 }, // ~
-    { 0, 0, 6, 0, 0, 0, 7260 }, //  
-    { 5, 23, 8, 1, 16, 29, 7260 }, // ¡
-    { 15, 29, 18, 1, 23, 109, 7289 }, // ¢
-    { 16, 22, 18, 1, 21, 88, 7398 }, // £
-    { 16, 14, 18, 1, 17, 56, 7486 }, // ¤
-    { 20, 20, 20, -1, 20, 100, 7542 }, // ¥
-    { 4, 27, 8, 2, 23, 27, 7642 }, // ¦
-    { 13, 23, 15, 1, 20, 75, 7669 }, // §
-    { 11, 4, 19, 4, 22, 11, 7744 }, // ¨
-    { 22, 22, 23, 0, 21, 121, 7755 }, // ©
-    { 11, 14, 13, 1, 21, 39, 7876 }, // ª
-    { 15, 11, 17, 1, 13, 42, 7915 }, // «
-    { 13, 8, 18, 3, 14, 26, 7957 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 7983 }, // ­
-    { 17, 16, 18, 0, 23, 68, 7990 }, // ®
-    { 10, 3, 19, 5, 21, 8, 8058 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 8066 }, // °
-    { 13, 17, 18, 3, 17, 56, 8097 }, // ±
-    { 11, 14, 13, 1, 24, 39, 8153 }, // ²
-    { 9, 14, 13, 2, 24, 32, 8192 }, // ³
-    { 6, 7, 19, 7, 24, 11, 8224 }, // ´
-    { 18, 23, 21, 2, 16, 104, 8235 }, // µ
-    { 15, 26, 16, 0, 21, 98, 8339 }, // ¶
-    { 6, 4, 8, 1, 10, 6, 8437 }, // ·
-    { 6, 7, 19, 7, -1, 11, 8443 }, // ¸
-    { 9, 14, 13, 2, 24, 32, 8454 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 8486 }, // º
-    { 15, 11, 17, 1, 13, 42, 8525 }, // »
-    { 28, 24, 31, 2, 22, 168, 8567 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 8735 }, // ½
-    { 29, 24, 32, 2, 22, 174, 8903 }, // ¾
-    { 11, 23, 14, 1, 16, 64, 9077 }, // ¿
-    { 22, 28, 23, 0, 28, 154, 9141 }, // À
-    { 22, 28, 23, 0, 28, 154, 9295 }, // Á
-    { 22, 28, 23, 0, 28, 154, 9449 }, // Â
-    { 22, 28, 23, 0, 28, 154, 9603 }, // Ã
-    { 22, 27, 23, 0, 27, 149, 9757 }, // Ä
-    { 22, 29, 23, 0, 29, 160, 9906 }, // Å
-    { 27, 21, 27, -1, 21, 142, 10066 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 10208 }, // Ç
-    { 17, 28, 19, 1, 28, 119, 10332 }, // È
-    { 17, 28, 19, 1, 28, 119, 10451 }, // É
-    { 17, 28, 19, 1, 28, 119, 10570 }, // Ê
-    { 17, 27, 19, 1, 27, 115, 10689 }, // Ë
-    { 9, 28, 11, 1, 28, 63, 10804 }, // Ì
-    { 9, 28, 11, 1, 28, 63, 10867 }, // Í
-    { 11, 28, 12, 0, 28, 77, 10930 }, // Î
-    { 11, 27, 12, 0, 27, 75, 11007 }, // Ï
-    { 21, 22, 22, 0, 21, 116, 11082 }, // Ð
-    { 22, 29, 24, 1, 28, 160, 11198 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 11358 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 11511 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 11664 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 11817 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 11970 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 12117 }, // ×
-    { 22, 22, 23, 0, 21, 121, 12153 }, // Ø
-    { 22, 29, 23, 0, 28, 160, 12274 }, // Ù
-    { 22, 29, 23, 0, 28, 160, 12434 }, // Ú
-    { 22, 29, 23, 0, 28, 160, 12594 }, // Û
-    { 22, 28, 23, 0, 27, 154, 12754 }, // Ü
-    { 20, 28, 21, 0, 28, 140, 12908 }, // Ý
-    { 16, 21, 18, 1, 21, 84, 13048 }, // Þ
-    { 18, 24, 19, 0, 23, 108, 13132 }, // ß
-    { 15, 25, 17, 1, 24, 94, 13240 }, // à
-    { 15, 25, 17, 1, 24, 94, 13334 }, // á
-    { 15, 25, 17, 1, 24, 94, 13428 }, // â
-    { 15, 24, 17, 1, 23, 90, 13522 }, // ã
-    { 15, 23, 17, 1, 22, 87, 13612 }, // ä
-    { 15, 25, 17, 1, 24, 94, 13699 }, // å
-    { 22, 17, 24, 1, 16, 94, 13793 }, // æ
-    { 13, 24, 15, 1, 16, 78, 13887 }, // ç
-    { 13, 25, 15, 1, 24, 82, 13965 }, // è
-    { 13, 25, 15, 1, 24, 82, 14047 }, // é
-    { 13, 25, 15, 1, 24, 82, 14129 }, // ê
-    { 13, 23, 15, 1, 22, 75, 14211 }, // ë
-    { 10, 24, 11, 0, 24, 60, 14286 }, // ì
-    { 10, 24, 11, 0, 24, 60, 14346 }, // í
-    { 10, 24, 11, 0, 24, 60, 14406 }, // î
-    { 11, 22, 11, -1, 22, 61, 14466 }, // ï
-    { 15, 25, 17, 1, 24, 94, 14527 }, // ð
-    { 19, 23, 20, 0, 23, 110, 14621 }, // ñ
-    { 16, 25, 18, 1, 24, 100, 14731 }, // ò
-    { 16, 25, 18, 1, 24, 100, 14831 }, // ó
-    { 16, 25, 18, 1, 24, 100, 14931 }, // ô
-    { 16, 24, 18, 1, 23, 96, 15031 }, // õ
-    { 16, 23, 18, 1, 22, 92, 15127 }, // ö
-    { 13, 14, 18, 3, 17, 46, 15219 }, // ÷
-    { 17, 17, 18, 0, 16, 73, 15265 }, // ø
-    { 19, 25, 20, 0, 24, 119, 15338 }, // ù
-    { 19, 25, 20, 0, 24, 119, 15457 }, // ú
-    { 19, 25, 20, 0, 24, 119, 15576 }, // û
-    { 19, 23, 20, 0, 22, 110, 15695 }, // ü
-    { 18, 31, 19, 0, 24, 140, 15805 }, // ý
-    { 17, 30, 18, 0, 23, 128, 15945 }, // þ
-    { 18, 29, 19, 0, 22, 131, 16073 }, // ÿ
-    { 22, 26, 23, 0, 26, 143, 16204 }, // Ā
-    { 15, 22, 17, 1, 21, 83, 16347 }, // ā
-    { 22, 28, 23, 0, 28, 154, 16430 }, // Ă
-    { 15, 24, 17, 1, 23, 90, 16584 }, // ă
-    { 22, 28, 23, 0, 21, 154, 16674 }, // Ą
-    { 15, 23, 17, 1, 16, 87, 16828 }, // ą
-    { 17, 29, 19, 1, 28, 124, 16915 }, // Ć
-    { 13, 25, 15, 1, 24, 82, 17039 }, // ć
-    { 17, 29, 19, 1, 28, 124, 17121 }, // Ĉ
-    { 13, 25, 15, 1, 24, 82, 17245 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 17327 }, // Ċ
-    { 13, 23, 15, 1, 22, 75, 17451 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 17526 }, // Č
-    { 13, 25, 15, 1, 24, 82, 17650 }, // č
-    { 20, 29, 22, 1, 28, 145, 17732 }, // Ď
-    { 20, 24, 22, 1, 23, 120, 17877 }, // ď
-    { 21, 22, 22, 0, 21, 116, 17997 }, // Đ
-    { 17, 24, 19, 1, 23, 102, 18113 }, // đ
-    { 17, 26, 19, 1, 26, 111, 18215 }, // Ē
-    { 13, 22, 15, 1, 21, 72, 18326 }, // ē
-    { 17, 28, 19, 1, 28, 119, 18398 }, // Ĕ
-    { 13, 24, 15, 1, 23, 78, 18517 }, // ĕ
-    { 17, 28, 19, 1, 28, 119, 18595 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 18714 }, // ė
-    { 17, 28, 19, 1, 21, 119, 18789 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 18908 }, // ę
-    { 17, 28, 19, 1, 28, 119, 18983 }, // Ě
-    { 13, 25, 15, 1, 24, 82, 19102 }, // ě
-    { 19, 29, 21, 1, 28, 138, 19184 }, // Ĝ
-    { 17, 31, 18, 0, 24, 132, 19322 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 19454 }, // Ğ
-    { 17, 30, 18, 0, 23, 128, 19592 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 19720 }, // Ġ
-    { 17, 29, 18, 0, 22, 124, 19858 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 19982 }, // Ģ
-    { 17, 32, 18, 0, 25, 136, 20120 }, // ģ
-    { 23, 28, 25, 1, 28, 161, 20256 }, // Ĥ
-    { 20, 30, 20, -1, 30, 150, 20417 }, // ĥ
-    { 24, 21, 25, 0, 21, 126, 20567 }, // Ħ
-    { 19, 23, 20, 0, 23, 110, 20693 }, // ħ
-    { 11, 28, 12, 0, 28, 77, 20803 }, // Ĩ
-    { 10, 23, 11, 0, 23, 58, 20880 }, // ĩ
-    { 11, 26, 12, 0, 26, 72, 20938 }, // Ī
-    { 10, 21, 11, 0, 21, 53, 21010 }, // ī
-    { 11, 28, 12, 0, 28, 77, 21063 }, // Ĭ
-    { 10, 23, 11, 0, 23, 58, 21140 }, // ĭ
-    { 9, 28, 11, 1, 21, 63, 21198 }, // Į
-    { 10, 30, 11, 0, 23, 75, 21261 }, // į
-    { 9, 28, 11, 1, 28, 63, 21336 }, // İ
-    { 10, 16, 11, 0, 16, 40, 21399 }, // ı
-    { 20, 27, 22, 1, 21, 135, 21439 }, // Ĳ
-    { 16, 30, 18, 0, 23, 120, 21574 }, // ĳ
-    { 13, 34, 12, -2, 28, 111, 21694 }, // Ĵ
-    { 11, 31, 10, -2, 24, 86, 21805 }, // ĵ
-    { 21, 29, 23, 1, 21, 153, 21891 }, // Ķ
-    { 18, 31, 19, 0, 23, 140, 22044 }, // ķ
-    { 18, 17, 19, 0, 16, 77, 22184 }, // ĸ
-    { 17, 28, 19, 1, 28, 119, 22261 }, // Ĺ
-    { 9, 30, 10, 0, 30, 68, 22380 }, // ĺ
-    { 17, 29, 19, 1, 21, 124, 22448 }, // Ļ
-    { 9, 31, 10, 0, 23, 70, 22572 }, // ļ
-    { 17, 23, 19, 1, 23, 98, 22642 }, // Ľ
-    { 12, 23, 13, 0, 23, 69, 22740 }, // ľ
-    { 17, 21, 19, 1, 21, 90, 22809 }, // Ŀ
-    { 14, 23, 15, 0, 23, 81, 22899 }, // ŀ
-    { 19, 21, 19, -1, 21, 100, 22980 }, // Ł
-    { 11, 23, 11, -1, 23, 64, 23080 }, // ł
-    { 22, 29, 24, 1, 28, 160, 23144 }, // Ń
-    { 19, 24, 20, 0, 24, 114, 23304 }, // ń
-    { 22, 29, 24, 1, 21, 160, 23418 }, // Ņ
-    { 19, 24, 20, 0, 16, 114, 23578 }, // ņ
-    { 22, 29, 24, 1, 28, 160, 23692 }, // Ň
-    { 19, 24, 20, 0, 24, 114, 23852 }, // ň
-    { 26, 22, 27, 0, 22, 143, 23966 }, // ŉ
-    { 22, 27, 24, 1, 21, 149, 24109 }, // Ŋ
-    { 17, 23, 19, 0, 16, 98, 24258 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 24356 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 24498 }, // ō
-    { 21, 29, 23, 1, 28, 153, 24586 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 24739 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 24835 }, // Ő
-    { 16, 25, 18, 1, 24, 100, 24993 }, // ő
-    { 26, 22, 28, 1, 21, 143, 25093 }, // Œ
-    { 25, 17, 27, 1, 16, 107, 25236 }, // œ
-    { 20, 29, 22, 1, 28, 145, 25343 }, // Ŕ
-    { 13, 24, 14, 0, 24, 78, 25488 }, // ŕ
-    { 20, 29, 22, 1, 21, 145, 25566 }, // Ŗ
-    { 13, 24, 14, 0, 16, 78, 25711 }, // ŗ
-    { 20, 29, 22, 1, 28, 145, 25789 }, // Ř
-    { 13, 24, 14, 0, 24, 78, 25934 }, // ř
-    { 14, 29, 16, 1, 28, 102, 26012 }, // Ś
-    { 12, 25, 14, 1, 24, 75, 26114 }, // ś
-    { 14, 29, 16, 1, 28, 102, 26189 }, // Ŝ
-    { 12, 25, 14, 1, 24, 75, 26291 }, // ŝ
-    { 14, 29, 16, 1, 21, 102, 26366 }, // Ş
-    { 12, 24, 14, 1, 16, 72, 26468 }, // ş
-    { 14, 29, 16, 1, 28, 102, 26540 }, // Š
-    { 12, 25, 14, 1, 24, 75, 26642 }, // š
-    { 18, 29, 20, 1, 21, 131, 26717 }, // Ţ
-    { 12, 27, 13, 0, 19, 81, 26848 }, // ţ
-    { 18, 28, 20, 1, 28, 126, 26929 }, // Ť
-    { 12, 25, 13, 0, 24, 75, 27055 }, // ť
-    { 18, 21, 20, 1, 21, 95, 27130 }, // Ŧ
-    { 12, 20, 13, 0, 19, 60, 27225 }, // ŧ
-    { 22, 29, 23, 0, 28, 160, 27285 }, // Ũ
-    { 19, 24, 20, 0, 23, 114, 27445 }, // ũ
-    { 22, 27, 23, 0, 26, 149, 27559 }, // Ū
-    { 19, 22, 20, 0, 21, 105, 27708 }, // ū
-    { 22, 29, 23, 0, 28, 160, 27813 }, // Ŭ
-    { 19, 24, 20, 0, 23, 114, 27973 }, // ŭ
-    { 22, 30, 23, 0, 29, 165, 28087 }, // Ů
-    { 19, 25, 20, 0, 24, 119, 28252 }, // ů
-    { 22, 30, 23, 0, 29, 165, 28371 }, // Ű
-    { 19, 25, 20, 0, 24, 119, 28536 }, // ű
-    { 22, 28, 23, 0, 21, 154, 28655 }, // Ų
-    { 19, 23, 20, 0, 16, 110, 28809 }, // ų
-    { 32, 29, 33, 0, 28, 232, 28919 }, // Ŵ
-    { 26, 25, 27, 0, 24, 163, 29151 }, // ŵ
-    { 20, 28, 21, 0, 28, 140, 29314 }, // Ŷ
-    { 18, 31, 19, 0, 24, 140, 29454 }, // ŷ
-    { 20, 27, 21, 0, 27, 135, 29594 }, // Ÿ
-    { 16, 29, 18, 1, 28, 116, 29729 }, // Ź
-    { 14, 25, 15, 0, 24, 88, 29845 }, // ź
-    { 16, 29, 18, 1, 28, 116, 29933 }, // Ż
-    { 14, 23, 15, 0, 22, 81, 30049 }, // ż
-    { 16, 29, 18, 1, 28, 116, 30130 }, // Ž
-    { 14, 25, 15, 0, 24, 88, 30246 }, // ž
-    { 14, 23, 15, 0, 23, 81, 30334 }, // ſ
-    { 22, 25, 24, 1, 24, 138, 30415 }, // Ơ
-    { 17, 20, 19, 1, 19, 85, 30553 }, // ơ
-    { 19, 21, 20, 0, 21, 100, 30638 }, // Ƥ
-    { 18, 30, 19, 0, 23, 135, 30738 }, // ƥ
-    { 12, 26, 13, 0, 19, 78, 30873 }, // ƫ
-    { 19, 21, 20, 0, 21, 100, 30951 }, // Ƭ
-    { 14, 24, 15, 0, 23, 84, 31051 }, // ƭ
-    { 18, 27, 20, 1, 21, 122, 31135 }, // Ʈ
-    { 23, 25, 24, 0, 24, 144, 31257 }, // Ư
-    { 19, 20, 20, 0, 19, 95, 31401 }, // ư
-    { 7, 7, 3, -5, 24, 13, 31496 }, // ̀
-    { 6, 7, 5, -2, 24, 11, 31509 }, // ́
-    { 10, 7, 6, -5, 24, 18, 31520 }, // ̂
-    { 10, 6, 6, -5, 23, 15, 31538 }, // ̃
-    { 10, 3, 6, -5, 21, 8, 31553 }, // ̄
-    { 10, 6, 6, -5, 23, 15, 31561 }, // ̆
-    { 4, 4, 3, -2, 22, 4, 31576 }, // ̇
-    { 10, 4, 6, -5, 22, 10, 31580 }, // ̈
-    { 8, 9, 5, -4, 26, 18, 31590 }, // ̉
-    { 8, 8, 5, -4, 24, 16, 31608 }, // ̊
-    { 11, 7, 8, -4, 24, 20, 31624 }, // ̋
-    { 10, 7, 6, -5, 24, 18, 31644 }, // ̌
-    { 11, 7, 5, -7, 24, 20, 31662 }, // ̏
-    { 10, 6, 6, -5, 23, 15, 31682 }, // ̑
-    { 6, 9, 4, -3, 25, 14, 31697 }, // ̒
-    { 5, 9, 4, -2, 26, 12, 31711 }, // ̓
-    { 5, 9, 3, -3, 26, 12, 31723 }, // ̔
-    { 4, 8, 3, -2, 25, 8, 31735 }, // ̕
-    { 5, 7, 4, -2, 19, 9, 31743 }, // ̛
-    { 4, 5, 3, -2, -2, 5, 31752 }, // ̣
-    { 10, 5, 6, -5, -2, 13, 31757 }, // ̤
-    { 8, 7, 5, -4, -1, 14, 31770 }, // ̥
-    { 5, 7, 3, -3, -1, 9, 31784 }, // ̦
-    { 6, 7, 4, -3, -1, 11, 31793 }, // ̧
-    { 7, 8, 5, -3, 1, 14, 31804 }, // ̨
-    { 4, 7, 8, 2, -1, 7, 31818 }, // ̩
-    { 10, 6, 6, -5, -2, 15, 31825 }, // ̭
-    { 10, 6, 6, -5, -1, 15, 31840 }, // ̮
-    { 10, 5, 6, -5, -2, 13, 31855 }, // ̰
-    { 10, 3, 6, -5, -3, 8, 31868 }, // ̱
-    { 10, 6, 6, -5, 23, 15, 31876 }, // ͂
-    { 12, 11, 7, -6, 29, 33, 31891 }, // ̈́
-    { 6, 5, 5, -2, -2, 8, 31924 }, // ͅ
-    { 22, 21, 23, 0, 21, 116, 31932 }, // Α
-    { 16, 22, 18, 1, 21, 88, 32048 }, // Β
-    { 15, 21, 17, 1, 21, 79, 32136 }, // Γ
-    { 19, 21, 20, 0, 21, 100, 32215 }, // Δ
-    { 17, 21, 19, 1, 21, 90, 32315 }, // Ε
-    { 16, 22, 18, 1, 21, 88, 32405 }, // Ζ
-    { 23, 21, 25, 1, 21, 121, 32493 }, // Η
-    { 21, 22, 23, 1, 21, 116, 32614 }, // Θ
-    { 9, 21, 11, 1, 21, 48, 32730 }, // Ι
-    { 21, 22, 23, 1, 21, 116, 32778 }, // Κ
-    { 21, 21, 22, 0, 21, 111, 32894 }, // Λ
-    { 26, 21, 27, 0, 21, 137, 33005 }, // Μ
-    { 22, 22, 24, 1, 21, 121, 33142 }, // Ν
-    { 17, 21, 19, 1, 21, 90, 33263 }, // Ξ
-    { 21, 22, 23, 1, 21, 116, 33353 }, // Ο
-    { 22, 21, 24, 1, 21, 116, 33469 }, // Π
-    { 16, 21, 18, 1, 21, 84, 33585 }, // Ρ
-    { 17, 22, 18, 0, 21, 94, 33669 }, // Σ
-    { 18, 21, 20, 1, 21, 95, 33763 }, // Τ
-    { 19, 21, 20, 0, 21, 100, 33858 }, // Υ
-    { 21, 22, 23, 1, 21, 116, 33958 }, // Φ
-    { 21, 21, 22, 0, 21, 111, 34074 }, // Χ
-    { 24, 21, 25, 0, 21, 126, 34185 }, // Ψ
-    { 22, 21, 24, 1, 21, 116, 34311 }, // Ω
-    { 18, 17, 20, 1, 16, 77, 34427 }, // α
-    { 15, 30, 18, 2, 23, 113, 34504 }, // β
-    { 16, 23, 17, 0, 16, 92, 34617 }, // γ
-    { 15, 24, 17, 1, 23, 90, 34709 }, // δ
-    { 13, 17, 15, 1, 16, 56, 34799 }, // ε
-    { 13, 30, 15, 1, 24, 98, 34855 }, // ζ
-    { 16, 23, 18, 0, 16, 92, 34953 }, // η
-    { 15, 24, 17, 1, 23, 90, 35045 }, // θ
-    { 8, 17, 11, 2, 16, 34, 35135 }, // ι
-    { 15, 17, 18, 2, 16, 64, 35169 }, // κ
-    { 18, 24, 19, 0, 23, 108, 35233 }, // λ
-    { 18, 23, 21, 2, 16, 104, 35341 }, // μ
-    { 16, 17, 17, 0, 16, 68, 35445 }, // ν
-    { 12, 30, 14, 1, 24, 90, 35513 }, // ξ
-    { 15, 17, 17, 1, 16, 64, 35603 }, // ο
-    { 19, 17, 20, 0, 16, 81, 35667 }, // π
-    { 15, 23, 17, 1, 16, 87, 35748 }, // ρ
-    { 13, 22, 15, 1, 16, 72, 35835 }, // ς
-    { 17, 17, 19, 1, 16, 73, 35907 }, // σ
-    { 15, 17, 16, 0, 16, 64, 35980 }, // τ
-    { 16, 17, 17, 0, 16, 68, 36044 }, // υ
-    { 22, 28, 24, 1, 21, 154, 36112 }, // φ
-    { 17, 23, 18, 0, 16, 98, 36266 }, // χ
-    { 22, 28, 23, 0, 21, 154, 36364 }, // ψ
-    { 20, 17, 22, 1, 16, 85, 36518 }, // ω
-    { 22, 28, 23, 0, 21, 154, 36603 }, // Ạ
-    { 15, 23, 17, 1, 16, 87, 36757 }, // ạ
-    { 22, 30, 23, 0, 30, 165, 36844 }, // Ả
-    { 15, 27, 17, 1, 26, 102, 37009 }, // ả
-    { 22, 31, 23, 0, 31, 171, 37111 }, // Ấ
-    { 15, 29, 17, 1, 28, 109, 37282 }, // ấ
-    { 22, 31, 23, 0, 31, 171, 37391 }, // Ầ
-    { 15, 29, 17, 1, 28, 109, 37562 }, // ầ
-    { 22, 31, 23, 0, 31, 171, 37671 }, // Ẩ
-    { 15, 29, 17, 1, 28, 109, 37842 }, // ẩ
-    { 22, 31, 23, 0, 31, 171, 37951 }, // Ẫ
-    { 15, 28, 17, 1, 27, 105, 38122 }, // ẫ
-    { 22, 35, 23, 0, 28, 193, 38227 }, // Ậ
-    { 15, 31, 17, 1, 24, 117, 38420 }, // ậ
-    { 22, 31, 23, 0, 31, 171, 38537 }, // Ắ
-    { 15, 29, 17, 1, 28, 109, 38708 }, // ắ
-    { 22, 31, 23, 0, 31, 171, 38817 }, // Ằ
-    { 15, 29, 17, 1, 28, 109, 38988 }, // ằ
-    { 22, 31, 23, 0, 31, 171, 39097 }, // Ẳ
-    { 15, 30, 17, 1, 29, 113, 39268 }, // ẳ
-    { 22, 31, 23, 0, 31, 171, 39381 }, // Ẵ
-    { 15, 28, 17, 1, 27, 105, 39552 }, // ẵ
-    { 22, 35, 23, 0, 28, 193, 39657 }, // Ặ
-    { 15, 30, 17, 1, 23, 113, 39850 }, // ặ
-    { 17, 28, 19, 1, 21, 119, 39963 }, // Ẹ
-    { 13, 23, 15, 1, 16, 75, 40082 }, // ẹ
-    { 17, 30, 19, 1, 30, 128, 40157 }, // Ẻ
-    { 13, 27, 15, 1, 26, 88, 40285 }, // ẻ
-    { 17, 28, 19, 1, 28, 119, 40373 }, // Ẽ
-    { 13, 24, 15, 1, 23, 78, 40492 }, // ẽ
-    { 17, 31, 19, 1, 31, 132, 40570 }, // Ế
-    { 15, 29, 17, 1, 28, 109, 40702 }, // ế
-    { 17, 31, 19, 1, 31, 132, 40811 }, // Ề
-    { 13, 29, 15, 1, 28, 95, 40943 }, // ề
-    { 17, 31, 19, 1, 31, 132, 41038 }, // Ể
-    { 16, 29, 18, 1, 28, 116, 41170 }, // ể
-    { 17, 31, 19, 1, 31, 132, 41286 }, // Ễ
-    { 13, 28, 15, 1, 27, 91, 41418 }, // ễ
-    { 17, 35, 19, 1, 28, 149, 41509 }, // Ệ
-    { 13, 31, 15, 1, 24, 101, 41658 }, // ệ
-    { 9, 30, 11, 1, 30, 68, 41759 }, // Ỉ
-    { 10, 26, 11, 0, 26, 65, 41827 }, // ỉ
-    { 9, 28, 11, 1, 21, 63, 41892 }, // Ị
-    { 10, 30, 11, 0, 23, 75, 41955 }, // ị
-    { 21, 28, 23, 1, 21, 147, 42030 }, // Ọ
-    { 16, 23, 18, 1, 16, 92, 42177 }, // ọ
-    { 21, 31, 23, 1, 30, 163, 42269 }, // Ỏ
-    { 16, 27, 18, 1, 26, 108, 42432 }, // ỏ
-    { 21, 32, 23, 1, 31, 168, 42540 }, // Ố
-    { 16, 29, 18, 1, 28, 116, 42708 }, // ố
-    { 21, 32, 23, 1, 31, 168, 42824 }, // Ồ
-    { 16, 29, 18, 1, 28, 116, 42992 }, // ồ
-    { 21, 32, 23, 1, 31, 168, 43108 }, // Ổ
-    { 16, 29, 18, 1, 28, 116, 43276 }, // ổ
-    { 21, 32, 23, 1, 31, 168, 43392 }, // Ỗ
-    { 16, 28, 18, 1, 27, 112, 43560 }, // ỗ
-    { 21, 35, 23, 1, 28, 184, 43672 }, // Ộ
-    { 16, 31, 18, 1, 24, 124, 43856 }, // ộ
-    { 22, 29, 24, 1, 28, 160, 43980 }, // Ớ
-    { 17, 25, 19, 1, 24, 107, 44140 }, // ớ
-    { 22, 29, 24, 1, 28, 160, 44247 }, // Ờ
-    { 17, 25, 19, 1, 24, 107, 44407 }, // ờ
-    { 22, 31, 24, 1, 30, 171, 44514 }, // Ở
-    { 17, 27, 19, 1, 26, 115, 44685 }, // ở
-    { 22, 29, 24, 1, 28, 160, 44800 }, // Ỡ
-    { 17, 24, 19, 1, 23, 102, 44960 }, // ỡ
-    { 22, 31, 24, 1, 24, 171, 45062 }, // Ợ
-    { 17, 26, 19, 1, 19, 111, 45233 }, // ợ
-    { 22, 28, 23, 0, 21, 154, 45344 }, // Ụ
-    { 19, 23, 20, 0, 16, 110, 45498 }, // ụ
-    { 22, 31, 23, 0, 30, 171, 45608 }, // Ủ
-    { 19, 27, 20, 0, 26, 129, 45779 }, // ủ
-    { 23, 29, 24, 0, 28, 167, 45908 }, // Ứ
-    { 19, 25, 20, 0, 24, 119, 46075 }, // ứ
-    { 23, 29, 24, 0, 28, 167, 46194 }, // Ừ
-    { 19, 25, 20, 0, 24, 119, 46361 }, // ừ
-    { 23, 31, 24, 0, 30, 179, 46480 }, // Ử
-    { 19, 27, 20, 0, 26, 129, 46659 }, // ử
-    { 23, 29, 24, 0, 28, 167, 46788 }, // Ữ
-    { 19, 24, 20, 0, 23, 114, 46955 }, // ữ
-    { 23, 31, 24, 0, 24, 179, 47069 }, // Ự
-    { 19, 26, 20, 0, 19, 124, 47248 }, // ự
-    { 20, 28, 21, 0, 28, 140, 47372 }, // Ỳ
-    { 18, 31, 19, 0, 24, 140, 47512 }, // ỳ
-    { 20, 28, 21, 0, 21, 140, 47652 }, // Ỵ
-    { 18, 22, 19, 0, 15, 99, 47792 }, // ỵ
-    { 20, 30, 21, 0, 30, 150, 47891 }, // Ỷ
-    { 18, 33, 19, 0, 26, 149, 48041 }, // ỷ
-    { 20, 28, 21, 0, 28, 140, 48190 }, // Ỹ
-    { 18, 30, 19, 0, 23, 135, 48330 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 48465 }, //  
-    { 0, 0, 29, 0, 0, 0, 48465 }, //  
-    { 0, 0, 15, 0, 0, 0, 48465 }, //  
-    { 0, 0, 29, 0, 0, 0, 48465 }, //  
-    { 0, 0, 10, 0, 0, 0, 48465 }, //  
-    { 0, 0, 7, 0, 0, 0, 48465 }, //  
-    { 0, 0, 5, 0, 0, 0, 48465 }, //  
-    { 0, 0, 18, 0, 0, 0, 48465 }, //  
-    { 0, 0, 8, 0, 0, 0, 48465 }, //  
-    { 0, 0, 6, 0, 0, 0, 48465 }, //  
-    { 0, 0, 1, 0, 0, 0, 48465 }, //  
-    { 0, 0, 1, 0, 0, 0, 48465 }, // ​
-    { 2, 24, 2, -1, 17, 12, 48465 }, // ‌
-    { 6, 26, 4, -3, 19, 39, 48477 }, // ‍
-    { 10, 28, 6, -5, 21, 70, 48516 }, // ‎
-    { 10, 28, 6, -5, 21, 70, 48586 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 48656 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 48663 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 48670 }, // ‒
-    { 15, 3, 16, 0, 9, 12, 48681 }, // –
-    { 29, 3, 30, 0, 9, 22, 48693 }, // —
-    { 29, 3, 30, 0, 9, 22, 48715 }, // ―
-    { 10, 30, 15, 2, 23, 75, 48737 }, // ‖
-    { 15, 7, 16, 0, -1, 27, 48812 }, // ‗
-    { 5, 10, 7, 1, 22, 13, 48839 }, // ‘
-    { 6, 10, 7, 0, 22, 15, 48852 }, // ’
-    { 6, 10, 7, 0, 4, 15, 48867 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 48882 }, // ‛
-    { 11, 10, 13, 1, 22, 28, 48895 }, // “
-    { 12, 10, 13, 0, 22, 30, 48923 }, // ”
-    { 12, 10, 13, 0, 4, 30, 48953 }, // „
-    { 11, 10, 13, 1, 22, 28, 48983 }, // ‟
-    { 14, 19, 15, 0, 21, 67, 49011 }, // †
-    { 14, 23, 15, 0, 21, 81, 49078 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 49159 }, // •
-    { 10, 10, 18, 4, 15, 25, 49172 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 49197 }, // ․
-    { 12, 5, 15, 1, 4, 15, 49205 }, // ‥
-    { 25, 5, 29, 2, 4, 32, 49220 }, // …
-    { 6, 4, 8, 1, 10, 6, 49252 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 49258 }, //  
-    { 0, 0, 1, 0, 0, 0, 49258 }, //  
-    { 10, 28, 6, -5, 21, 70, 49258 }, // ‪
-    { 10, 28, 6, -5, 21, 70, 49328 }, // ‫
-    { 10, 27, 6, -5, 20, 68, 49398 }, // ‬
-    { 12, 28, 7, -6, 21, 84, 49466 }, // ‭
-    { 12, 28, 7, -6, 21, 84, 49550 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 49634 }, //  
-    { 38, 24, 40, 1, 22, 228, 49634 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 49862 }, // ′
-    { 12, 10, 14, 1, 21, 30, 49877 }, // ″
-    { 17, 10, 19, 1, 21, 43, 49907 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 49950 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 49965 }, // ‶
-    { 19, 10, 21, 1, 21, 48, 49995 }, // ‷
-    { 13, 6, 15, 1, 0, 20, 50043 }, // ‸
-    { 7, 11, 9, 1, 13, 20, 50063 }, // ‹
-    { 8, 11, 10, 1, 13, 22, 50083 }, // ›
-    { 18, 20, 19, 0, 19, 90, 50105 }, // ※
-    { 13, 23, 16, 2, 22, 75, 50195 }, // ‼
-    { 15, 3, 16, 0, 24, 12, 50270 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 50282 }, // ⁃
-    { 15, 24, 11, -5, 22, 90, 50288 }, // ⁄
-    { 23, 23, 26, 2, 22, 133, 50378 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 50511 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 50621 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 50731 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 50753 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 50811 }, //  
-    { 0, 0, 1, 0, 0, 0, 50811 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 50811 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 50811 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 50811 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 50811 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 50811 }, // ⁰
-    { 11, 14, 13, 1, 24, 39, 50850 }, // ⁴
-    { 10, 14, 13, 1, 24, 35, 50889 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 50924 }, // ⁶
-    { 10, 14, 13, 2, 24, 35, 50963 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 50998 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 51037 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 51076 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 51112 }, // ₀
-    { 9, 14, 13, 2, 10, 32, 51154 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 51186 }, // ₂
-    { 9, 15, 13, 2, 10, 34, 51225 }, // ₃
-    { 11, 15, 13, 1, 10, 42, 51259 }, // ₄
-    { 10, 14, 13, 1, 9, 35, 51301 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 51336 }, // ₆
-    { 10, 14, 13, 2, 9, 35, 51378 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 51413 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 51455 }, // ₉
-    { 15, 20, 18, 1, 20, 75, 51497 }, // ₣
-    { 16, 22, 18, 1, 21, 88, 51572 }, // ₤
-    { 36, 22, 37, 0, 21, 198, 51660 }, // ₧
-    { 18, 22, 19, 0, 21, 99, 51858 }, // €
-    { 17, 12, 29, 6, 16, 51, 51957 }, // ←
-    { 13, 20, 29, 8, 20, 65, 52008 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 52073 }, // →
-    { 13, 20, 29, 8, 20, 65, 52124 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 52189 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 52243 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 52308 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 52373 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 52438 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 52503 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 52563 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 52623 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 52682 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 52742 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 52801 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 52868 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 52973 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 53057 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 53126 }, // ∅
-    { 19, 21, 20, 0, 21, 100, 53264 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 53364 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 53469 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 53569 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 53693 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 53769 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 53869 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 53993 }, // ∍
-    { 22, 26, 24, 1, 21, 143, 54069 }, // ∏
-    { 18, 26, 19, 0, 21, 117, 54212 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 54329 }, // −
-    { 13, 23, 15, 1, 21, 75, 54339 }, // ∕
-    { 13, 23, 16, 2, 21, 75, 54414 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 54489 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 54538 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 54563 }, // ∙
-    { 18, 28, 19, 0, 24, 126, 54569 }, // √
-    { 14, 11, 18, 2, 15, 39, 54695 }, // ∝
-    { 18, 10, 19, 0, 14, 45, 54734 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 54779 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 54879 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 54990 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 55020 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 55088 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 55188 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 55288 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 55378 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 55472 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 55592 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 55673 }, // ∵
-    { 5, 16, 9, 2, 18, 20, 55754 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 55774 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 55855 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 55877 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 55941 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 55976 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 56019 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 56062 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 56118 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 56181 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 56244 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 56325 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 56406 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 56482 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 56606 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 56730 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 56830 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 56930 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 57046 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 57162 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 57278 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 57394 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 57484 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 57492 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 57524 }, // �
+    { 5, 23, 8, 2, 22, 33, 0 }, // !
+    { 9, 9, 11, 1, 21, 28, 33 }, // "
+    { 18, 19, 19, 0, 17, 69, 61 }, // #
+    { 14, 30, 18, 2, 24, 86, 130 }, // $
+    { 26, 24, 28, 1, 22, 111, 216 }, // %
+    { 22, 23, 24, 1, 22, 92, 327 }, // &
+    { 4, 9, 6, 1, 21, 14, 419 }, // '
+    { 9, 29, 11, 1, 24, 46, 433 }, // (
+    { 10, 29, 11, 0, 24, 41, 479 }, // )
+    { 10, 11, 11, 0, 22, 24, 520 }, // *
+    { 13, 14, 18, 3, 17, 22, 544 }, // +
+    { 7, 10, 8, 0, 4, 14, 566 }, // ,
+    { 9, 3, 11, 1, 9, 8, 580 }, // -
+    { 6, 5, 8, 1, 4, 7, 588 }, // .
+    { 13, 23, 15, 1, 21, 47, 595 }, // /
+    { 16, 22, 18, 1, 21, 65, 642 }, // 0
+    { 12, 21, 18, 3, 21, 34, 707 }, // 1
+    { 14, 21, 18, 2, 21, 59, 741 }, // 2
+    { 13, 22, 18, 2, 21, 49, 800 }, // 3
+    { 16, 22, 18, 1, 21, 60, 849 }, // 4
+    { 14, 21, 18, 2, 20, 52, 909 }, // 5
+    { 14, 22, 18, 2, 21, 58, 961 }, // 6
+    { 15, 21, 18, 2, 20, 47, 1019 }, // 7
+    { 14, 22, 18, 2, 21, 58, 1066 }, // 8
+    { 15, 22, 18, 1, 21, 63, 1124 }, // 9
+    { 6, 16, 8, 1, 15, 16, 1187 }, // :
+    { 7, 21, 8, 0, 15, 24, 1203 }, // ;
+    { 14, 14, 18, 2, 17, 29, 1227 }, // <
+    { 13, 8, 18, 3, 14, 32, 1256 }, // =
+    { 14, 14, 18, 2, 17, 29, 1288 }, // >
+    { 11, 23, 14, 2, 22, 39, 1317 }, // ?
+    { 26, 26, 28, 1, 20, 126, 1356 }, // @
+    { 22, 21, 23, 0, 21, 72, 1482 }, // A
+    { 16, 22, 18, 1, 21, 61, 1554 }, // B
+    { 17, 22, 19, 1, 21, 61, 1615 }, // C
+    { 20, 22, 22, 1, 21, 66, 1676 }, // D
+    { 17, 21, 19, 1, 21, 51, 1742 }, // E
+    { 15, 21, 17, 1, 21, 42, 1793 }, // F
+    { 19, 22, 21, 1, 21, 75, 1835 }, // G
+    { 23, 21, 25, 1, 21, 79, 1910 }, // H
+    { 9, 21, 11, 1, 21, 25, 1989 }, // I
+    { 12, 27, 11, -2, 21, 43, 2014 }, // J
+    { 21, 22, 23, 1, 21, 68, 2057 }, // K
+    { 17, 21, 19, 1, 21, 41, 2125 }, // L
+    { 26, 21, 27, 0, 21, 104, 2166 }, // M
+    { 22, 22, 24, 1, 21, 75, 2270 }, // N
+    { 21, 22, 23, 1, 21, 76, 2345 }, // O
+    { 16, 21, 18, 1, 21, 52, 2421 }, // P
+    { 22, 27, 24, 1, 21, 88, 2473 }, // Q
+    { 20, 22, 22, 1, 21, 67, 2561 }, // R
+    { 14, 22, 16, 1, 21, 59, 2628 }, // S
+    { 18, 21, 20, 1, 21, 54, 2687 }, // T
+    { 22, 22, 23, 0, 21, 81, 2741 }, // U
+    { 21, 22, 22, 0, 21, 66, 2822 }, // V
+    { 32, 22, 33, 0, 21, 111, 2888 }, // W
+    { 21, 21, 22, 0, 21, 68, 2999 }, // X
+    { 20, 21, 21, 0, 21, 61, 3067 }, // Y
+    { 16, 22, 18, 1, 21, 57, 3128 }, // Z
+    { 6, 28, 9, 2, 23, 44, 3185 }, // [
+    { 13, 23, 15, 1, 21, 46, 3229 }, // <backslash>
+    { 6, 28, 9, 1, 23, 44, 3275 }, // ]
+    { 14, 14, 18, 2, 19, 38, 3319 }, // ^
+    { 15, 3, 16, 0, -1, 18, 3357 }, // _
+    { 7, 7, 19, 6, 24, 10, 3375 }, // `
+    { 15, 17, 17, 1, 16, 46, 3385 }, // a
+    { 18, 24, 18, -1, 23, 75, 3431 }, // b
+    { 13, 17, 15, 1, 16, 41, 3506 }, // c
+    { 17, 24, 19, 1, 23, 63, 3547 }, // d
+    { 13, 17, 15, 1, 16, 41, 3610 }, // e
+    { 14, 23, 15, 0, 23, 62, 3651 }, // f
+    { 17, 23, 18, 0, 16, 67, 3713 }, // g
+    { 19, 23, 20, 0, 23, 55, 3780 }, // h
+    { 10, 23, 11, 0, 23, 42, 3835 }, // i
+    { 9, 30, 8, -2, 23, 39, 3877 }, // j
+    { 18, 24, 19, 0, 23, 62, 3916 }, // k
+    { 9, 23, 10, 0, 23, 36, 3978 }, // l
+    { 29, 16, 30, 0, 16, 77, 4014 }, // m
+    { 19, 16, 20, 0, 16, 63, 4091 }, // n
+    { 16, 17, 18, 1, 16, 49, 4154 }, // o
+    { 17, 23, 18, 0, 16, 65, 4203 }, // p
+    { 17, 23, 19, 1, 16, 61, 4268 }, // q
+    { 13, 16, 14, 0, 16, 43, 4329 }, // r
+    { 12, 17, 14, 1, 16, 42, 4372 }, // s
+    { 12, 20, 13, 0, 19, 44, 4414 }, // t
+    { 19, 17, 20, 0, 16, 59, 4458 }, // u
+    { 18, 16, 19, 0, 15, 49, 4517 }, // v
+    { 26, 16, 27, 0, 15, 80, 4566 }, // w
+    { 17, 15, 18, 0, 15, 50, 4646 }, // x
+    { 18, 22, 19, 0, 15, 64, 4696 }, // y
+    { 14, 16, 15, 0, 15, 43, 4760 }, // z
+    { 9, 29, 12, 2, 24, 46, 4803 }, // {
+    { 4, 27, 8, 2, 23, 27, 4849 }, // |
+    { 9, 29, 11, 0, 24, 45, 4876 }, // }
+    { 14, 6, 18, 2, 13, 18, 4921 }, // ~
+    { 0, 0, 6, 0, 0, 0, 4939 }, //  
+    { 5, 23, 8, 1, 16, 32, 4939 }, // ¡
+    { 15, 29, 18, 1, 23, 75, 4971 }, // ¢
+    { 16, 22, 18, 1, 21, 60, 5046 }, // £
+    { 16, 14, 18, 1, 17, 52, 5106 }, // ¤
+    { 20, 20, 20, -1, 20, 68, 5158 }, // ¥
+    { 4, 27, 8, 2, 23, 24, 5226 }, // ¦
+    { 13, 23, 15, 1, 20, 65, 5250 }, // §
+    { 11, 4, 19, 4, 22, 13, 5315 }, // ¨
+    { 22, 22, 23, 0, 21, 104, 5328 }, // ©
+    { 11, 14, 13, 1, 21, 33, 5432 }, // ª
+    { 15, 11, 17, 1, 13, 38, 5465 }, // «
+    { 13, 8, 18, 3, 14, 12, 5503 }, // ¬
+    { 9, 3, 11, 1, 9, 8, 5515 }, // ­
+    { 17, 16, 18, 0, 23, 72, 5523 }, // ®
+    { 10, 3, 19, 5, 21, 12, 5595 }, // ¯
+    { 11, 11, 15, 2, 21, 23, 5607 }, // °
+    { 13, 17, 18, 3, 17, 34, 5630 }, // ±
+    { 11, 14, 13, 1, 24, 28, 5664 }, // ²
+    { 9, 14, 13, 2, 24, 31, 5692 }, // ³
+    { 6, 7, 19, 7, 24, 11, 5723 }, // ´
+    { 18, 23, 21, 2, 16, 75, 5734 }, // µ
+    { 15, 26, 16, 0, 21, 76, 5809 }, // ¶
+    { 6, 4, 8, 1, 10, 7, 5885 }, // ·
+    { 6, 7, 19, 7, -1, 13, 5892 }, // ¸
+    { 9, 14, 13, 2, 24, 24, 5905 }, // ¹
+    { 11, 14, 13, 1, 21, 36, 5929 }, // º
+    { 15, 11, 17, 1, 13, 33, 5965 }, // »
+    { 28, 24, 31, 2, 22, 111, 5998 }, // ¼
+    { 28, 24, 31, 2, 22, 99, 6109 }, // ½
+    { 29, 24, 32, 2, 22, 113, 6208 }, // ¾
+    { 11, 23, 14, 1, 16, 39, 6321 }, // ¿
+    { 22, 28, 23, 0, 28, 88, 6360 }, // À
+    { 22, 28, 23, 0, 28, 88, 6448 }, // Á
+    { 22, 28, 23, 0, 28, 90, 6536 }, // Â
+    { 22, 28, 23, 0, 28, 90, 6626 }, // Ã
+    { 22, 27, 23, 0, 27, 88, 6716 }, // Ä
+    { 22, 29, 23, 0, 29, 96, 6804 }, // Å
+    { 27, 21, 27, -1, 21, 101, 6900 }, // Æ
+    { 17, 29, 19, 1, 21, 77, 7001 }, // Ç
+    { 17, 28, 19, 1, 28, 64, 7078 }, // È
+    { 17, 28, 19, 1, 28, 64, 7142 }, // É
+    { 17, 28, 19, 1, 28, 66, 7206 }, // Ê
+    { 17, 27, 19, 1, 27, 65, 7272 }, // Ë
+    { 9, 28, 11, 1, 28, 35, 7337 }, // Ì
+    { 9, 28, 11, 1, 28, 35, 7372 }, // Í
+    { 11, 28, 12, 0, 28, 41, 7407 }, // Î
+    { 11, 27, 12, 0, 27, 39, 7448 }, // Ï
+    { 21, 22, 22, 0, 21, 68, 7487 }, // Ð
+    { 22, 29, 24, 1, 28, 94, 7555 }, // Ñ
+    { 21, 29, 23, 1, 28, 92, 7649 }, // Ò
+    { 21, 29, 23, 1, 28, 91, 7741 }, // Ó
+    { 21, 29, 23, 1, 28, 94, 7832 }, // Ô
+    { 21, 29, 23, 1, 28, 95, 7926 }, // Õ
+    { 21, 28, 23, 1, 27, 91, 8021 }, // Ö
+    { 12, 12, 18, 3, 16, 27, 8112 }, // ×
+    { 22, 22, 23, 0, 21, 91, 8139 }, // Ø
+    { 22, 29, 23, 0, 28, 98, 8230 }, // Ù
+    { 22, 29, 23, 0, 28, 97, 8328 }, // Ú
+    { 22, 29, 23, 0, 28, 101, 8425 }, // Û
+    { 22, 28, 23, 0, 27, 98, 8526 }, // Ü
+    { 20, 28, 21, 0, 28, 77, 8624 }, // Ý
+    { 16, 21, 18, 1, 21, 51, 8701 }, // Þ
+    { 18, 24, 19, 0, 23, 80, 8752 }, // ß
+    { 15, 25, 17, 1, 24, 60, 8832 }, // à
+    { 15, 25, 17, 1, 24, 61, 8892 }, // á
+    { 15, 25, 17, 1, 24, 63, 8953 }, // â
+    { 15, 24, 17, 1, 23, 62, 9016 }, // ã
+    { 15, 23, 17, 1, 22, 61, 9078 }, // ä
+    { 15, 25, 17, 1, 24, 66, 9139 }, // å
+    { 22, 17, 24, 1, 16, 73, 9205 }, // æ
+    { 13, 24, 15, 1, 16, 55, 9278 }, // ç
+    { 13, 25, 15, 1, 24, 55, 9333 }, // è
+    { 13, 25, 15, 1, 24, 55, 9388 }, // é
+    { 13, 25, 15, 1, 24, 60, 9443 }, // ê
+    { 13, 23, 15, 1, 22, 55, 9503 }, // ë
+    { 10, 24, 11, 0, 24, 45, 9558 }, // ì
+    { 10, 24, 11, 0, 24, 44, 9603 }, // í
+    { 10, 24, 11, 0, 24, 49, 9647 }, // î
+    { 11, 22, 11, -1, 22, 47, 9696 }, // ï
+    { 15, 25, 17, 1, 24, 67, 9743 }, // ð
+    { 19, 23, 20, 0, 23, 82, 9810 }, // ñ
+    { 16, 25, 18, 1, 24, 63, 9892 }, // ò
+    { 16, 25, 18, 1, 24, 64, 9955 }, // ó
+    { 16, 25, 18, 1, 24, 69, 10019 }, // ô
+    { 16, 24, 18, 1, 23, 65, 10088 }, // õ
+    { 16, 23, 18, 1, 22, 65, 10153 }, // ö
+    { 13, 14, 18, 3, 17, 24, 10218 }, // ÷
+    { 17, 17, 18, 0, 16, 57, 10242 }, // ø
+    { 19, 25, 20, 0, 24, 75, 10299 }, // ù
+    { 19, 25, 20, 0, 24, 75, 10374 }, // ú
+    { 19, 25, 20, 0, 24, 80, 10449 }, // û
+    { 19, 23, 20, 0, 22, 76, 10529 }, // ü
+    { 18, 31, 19, 0, 24, 81, 10605 }, // ý
+    { 17, 30, 18, 0, 23, 83, 10686 }, // þ
+    { 18, 29, 19, 0, 22, 81, 10769 }, // ÿ
+    { 22, 26, 23, 0, 26, 85, 10850 }, // Ā
+    { 15, 22, 17, 1, 21, 60, 10935 }, // ā
+    { 22, 28, 23, 0, 28, 90, 10995 }, // Ă
+    { 15, 24, 17, 1, 23, 61, 11085 }, // ă
+    { 22, 28, 23, 0, 21, 88, 11146 }, // Ą
+    { 15, 23, 17, 1, 16, 58, 11234 }, // ą
+    { 17, 29, 19, 1, 28, 75, 11292 }, // Ć
+    { 13, 25, 15, 1, 24, 56, 11367 }, // ć
+    { 17, 29, 19, 1, 28, 80, 11423 }, // Ĉ
+    { 13, 25, 15, 1, 24, 58, 11503 }, // ĉ
+    { 17, 29, 19, 1, 28, 73, 11561 }, // Ċ
+    { 13, 23, 15, 1, 22, 51, 11634 }, // ċ
+    { 17, 29, 19, 1, 28, 80, 11685 }, // Č
+    { 13, 25, 15, 1, 24, 60, 11765 }, // č
+    { 20, 29, 22, 1, 28, 86, 11825 }, // Ď
+    { 20, 24, 22, 1, 23, 73, 11911 }, // ď
+    { 21, 22, 22, 0, 21, 68, 11984 }, // Đ
+    { 17, 24, 19, 1, 23, 68, 12052 }, // đ
+    { 17, 26, 19, 1, 26, 62, 12120 }, // Ē
+    { 13, 22, 15, 1, 21, 56, 12182 }, // ē
+    { 17, 28, 19, 1, 28, 66, 12238 }, // Ĕ
+    { 13, 24, 15, 1, 23, 56, 12304 }, // ĕ
+    { 17, 28, 19, 1, 28, 62, 12360 }, // Ė
+    { 13, 23, 15, 1, 22, 50, 12422 }, // ė
+    { 17, 28, 19, 1, 21, 64, 12472 }, // Ę
+    { 13, 23, 15, 1, 16, 53, 12536 }, // ę
+    { 17, 28, 19, 1, 28, 68, 12589 }, // Ě
+    { 13, 25, 15, 1, 24, 60, 12657 }, // ě
+    { 19, 29, 21, 1, 28, 93, 12717 }, // Ĝ
+    { 17, 31, 18, 0, 24, 87, 12810 }, // ĝ
+    { 19, 29, 21, 1, 28, 92, 12897 }, // Ğ
+    { 17, 30, 18, 0, 23, 83, 12989 }, // ğ
+    { 19, 29, 21, 1, 28, 88, 13072 }, // Ġ
+    { 17, 29, 18, 0, 22, 77, 13160 }, // ġ
+    { 19, 29, 21, 1, 21, 89, 13237 }, // Ģ
+    { 17, 32, 18, 0, 25, 85, 13326 }, // ģ
+    { 23, 28, 25, 1, 28, 97, 13411 }, // Ĥ
+    { 20, 30, 20, -1, 30, 77, 13508 }, // ĥ
+    { 24, 21, 25, 0, 21, 80, 13585 }, // Ħ
+    { 19, 23, 20, 0, 23, 59, 13665 }, // ħ
+    { 11, 28, 12, 0, 28, 41, 13724 }, // Ĩ
+    { 10, 23, 11, 0, 23, 46, 13765 }, // ĩ
+    { 11, 26, 12, 0, 26, 37, 13811 }, // Ī
+    { 10, 21, 11, 0, 21, 45, 13848 }, // ī
+    { 11, 28, 12, 0, 28, 39, 13893 }, // Ĭ
+    { 10, 23, 11, 0, 23, 45, 13932 }, // ĭ
+    { 9, 28, 11, 1, 21, 37, 13977 }, // Į
+    { 10, 30, 11, 0, 23, 52, 14014 }, // į
+    { 9, 28, 11, 1, 28, 33, 14066 }, // İ
+    { 10, 16, 11, 0, 16, 33, 14099 }, // ı
+    { 20, 27, 22, 1, 21, 71, 14132 }, // Ĳ
+    { 16, 30, 18, 0, 23, 88, 14203 }, // ĳ
+    { 13, 34, 12, -2, 28, 59, 14291 }, // Ĵ
+    { 11, 31, 10, -2, 24, 47, 14350 }, // ĵ
+    { 21, 29, 23, 1, 21, 86, 14397 }, // Ķ
+    { 18, 31, 19, 0, 23, 76, 14483 }, // ķ
+    { 18, 17, 19, 0, 16, 56, 14559 }, // ĸ
+    { 17, 28, 19, 1, 28, 55, 14615 }, // Ĺ
+    { 9, 30, 10, 0, 30, 46, 14670 }, // ĺ
+    { 17, 29, 19, 1, 21, 57, 14716 }, // Ļ
+    { 9, 31, 10, 0, 23, 47, 14773 }, // ļ
+    { 17, 23, 19, 1, 23, 51, 14820 }, // Ľ
+    { 12, 23, 13, 0, 23, 53, 14871 }, // ľ
+    { 17, 21, 19, 1, 21, 45, 14924 }, // Ŀ
+    { 14, 23, 15, 0, 23, 51, 14969 }, // ŀ
+    { 19, 21, 19, -1, 21, 50, 15020 }, // Ł
+    { 11, 23, 11, -1, 23, 41, 15070 }, // ł
+    { 22, 29, 24, 1, 28, 91, 15111 }, // Ń
+    { 19, 24, 20, 0, 24, 78, 15202 }, // ń
+    { 22, 29, 24, 1, 21, 93, 15280 }, // Ņ
+    { 19, 24, 20, 0, 16, 79, 15373 }, // ņ
+    { 22, 29, 24, 1, 28, 96, 15452 }, // Ň
+    { 19, 24, 20, 0, 24, 82, 15548 }, // ň
+    { 26, 22, 27, 0, 22, 79, 15630 }, // ŉ
+    { 22, 27, 24, 1, 21, 91, 15709 }, // Ŋ
+    { 17, 23, 19, 0, 16, 77, 15800 }, // ŋ
+    { 21, 27, 23, 1, 26, 89, 15877 }, // Ō
+    { 16, 22, 18, 1, 21, 64, 15966 }, // ō
+    { 21, 29, 23, 1, 28, 94, 16030 }, // Ŏ
+    { 16, 24, 18, 1, 23, 63, 16124 }, // ŏ
+    { 21, 30, 23, 1, 29, 101, 16187 }, // Ő
+    { 16, 25, 18, 1, 24, 71, 16288 }, // ő
+    { 26, 22, 28, 1, 21, 87, 16359 }, // Œ
+    { 25, 17, 27, 1, 16, 76, 16446 }, // œ
+    { 20, 29, 22, 1, 28, 81, 16522 }, // Ŕ
+    { 13, 24, 14, 0, 24, 56, 16603 }, // ŕ
+    { 20, 29, 22, 1, 21, 83, 16659 }, // Ŗ
+    { 13, 24, 14, 0, 16, 57, 16742 }, // ŗ
+    { 20, 29, 22, 1, 28, 87, 16799 }, // Ř
+    { 13, 24, 14, 0, 24, 59, 16886 }, // ř
+    { 14, 29, 16, 1, 28, 72, 16945 }, // Ś
+    { 12, 25, 14, 1, 24, 53, 17017 }, // ś
+    { 14, 29, 16, 1, 28, 75, 17070 }, // Ŝ
+    { 12, 25, 14, 1, 24, 59, 17145 }, // ŝ
+    { 14, 29, 16, 1, 21, 74, 17204 }, // Ş
+    { 12, 24, 14, 1, 16, 55, 17278 }, // ş
+    { 14, 29, 16, 1, 28, 75, 17333 }, // Š
+    { 12, 25, 14, 1, 24, 60, 17408 }, // š
+    { 18, 29, 20, 1, 21, 70, 17468 }, // Ţ
+    { 12, 27, 13, 0, 19, 56, 17538 }, // ţ
+    { 18, 28, 20, 1, 28, 72, 17594 }, // Ť
+    { 12, 25, 13, 0, 24, 54, 17666 }, // ť
+    { 18, 21, 20, 1, 21, 55, 17720 }, // Ŧ
+    { 12, 20, 13, 0, 19, 48, 17775 }, // ŧ
+    { 22, 29, 23, 0, 28, 100, 17823 }, // Ũ
+    { 19, 24, 20, 0, 23, 77, 17923 }, // ũ
+    { 22, 27, 23, 0, 26, 94, 18000 }, // Ū
+    { 19, 22, 20, 0, 21, 75, 18094 }, // ū
+    { 22, 29, 23, 0, 28, 100, 18169 }, // Ŭ
+    { 19, 24, 20, 0, 23, 77, 18269 }, // ŭ
+    { 22, 30, 23, 0, 29, 105, 18346 }, // Ů
+    { 19, 25, 20, 0, 24, 85, 18451 }, // ů
+    { 22, 30, 23, 0, 29, 106, 18536 }, // Ű
+    { 19, 25, 20, 0, 24, 85, 18642 }, // ű
+    { 22, 28, 23, 0, 21, 94, 18727 }, // Ų
+    { 19, 23, 20, 0, 16, 73, 18821 }, // ų
+    { 32, 29, 33, 0, 28, 136, 18894 }, // Ŵ
+    { 26, 25, 27, 0, 24, 106, 19030 }, // ŵ
+    { 20, 28, 21, 0, 28, 82, 19136 }, // Ŷ
+    { 18, 31, 19, 0, 24, 85, 19218 }, // ŷ
+    { 20, 27, 21, 0, 27, 78, 19303 }, // Ÿ
+    { 16, 29, 18, 1, 28, 71, 19381 }, // Ź
+    { 14, 25, 15, 0, 24, 59, 19452 }, // ź
+    { 16, 29, 18, 1, 28, 69, 19511 }, // Ż
+    { 14, 23, 15, 0, 22, 56, 19580 }, // ż
+    { 16, 29, 18, 1, 28, 75, 19636 }, // Ž
+    { 14, 25, 15, 0, 24, 62, 19711 }, // ž
+    { 14, 23, 15, 0, 23, 59, 19773 }, // ſ
+    { 22, 25, 24, 1, 24, 89, 19832 }, // Ơ
+    { 17, 20, 19, 1, 19, 58, 19921 }, // ơ
+    { 19, 21, 20, 0, 21, 71, 19979 }, // Ƥ
+    { 18, 30, 19, 0, 23, 95, 20050 }, // ƥ
+    { 12, 26, 13, 0, 19, 59, 20145 }, // ƫ
+    { 19, 21, 20, 0, 21, 48, 20204 }, // Ƭ
+    { 14, 24, 15, 0, 23, 54, 20252 }, // ƭ
+    { 18, 27, 20, 1, 21, 71, 20306 }, // Ʈ
+    { 23, 25, 24, 0, 24, 90, 20377 }, // Ư
+    { 19, 20, 20, 0, 19, 68, 20467 }, // ư
+    { 7, 7, 3, -5, 24, 10, 20535 }, // ̀
+    { 6, 7, 5, -2, 24, 10, 20545 }, // ́
+    { 10, 7, 6, -5, 24, 16, 20555 }, // ̂
+    { 10, 6, 6, -5, 23, 14, 20571 }, // ̃
+    { 10, 3, 6, -5, 21, 12, 20585 }, // ̄
+    { 10, 6, 6, -5, 23, 13, 20597 }, // ̆
+    { 4, 4, 3, -2, 22, 4, 20610 }, // ̇
+    { 10, 4, 6, -5, 22, 11, 20614 }, // ̈
+    { 8, 9, 5, -4, 26, 19, 20625 }, // ̉
+    { 8, 8, 5, -4, 24, 21, 20644 }, // ̊
+    { 11, 7, 8, -4, 24, 21, 20665 }, // ̋
+    { 10, 7, 6, -5, 24, 17, 20686 }, // ̌
+    { 11, 7, 5, -7, 24, 21, 20703 }, // ̏
+    { 10, 6, 6, -5, 23, 12, 20724 }, // ̑
+    { 6, 9, 4, -3, 25, 12, 20736 }, // ̒
+    { 5, 9, 4, -2, 26, 11, 20748 }, // ̓
+    { 5, 9, 3, -3, 26, 11, 20759 }, // ̔
+    { 4, 8, 3, -2, 25, 10, 20770 }, // ̕
+    { 5, 7, 4, -2, 19, 9, 20780 }, // ̛
+    { 4, 5, 3, -2, -2, 6, 20789 }, // ̣
+    { 10, 5, 6, -5, -2, 12, 20795 }, // ̤
+    { 8, 7, 5, -4, -1, 15, 20807 }, // ̥
+    { 5, 7, 3, -3, -1, 11, 20822 }, // ̦
+    { 6, 7, 4, -3, -1, 11, 20833 }, // ̧
+    { 7, 8, 5, -3, 1, 11, 20844 }, // ̨
+    { 4, 7, 8, 2, -1, 11, 20855 }, // ̩
+    { 10, 6, 6, -5, -2, 16, 20866 }, // ̭
+    { 10, 6, 6, -5, -1, 14, 20882 }, // ̮
+    { 10, 5, 6, -5, -2, 16, 20896 }, // ̰
+    { 10, 3, 6, -5, -3, 9, 20912 }, // ̱
+    { 10, 6, 6, -5, 23, 12, 20921 }, // ͂
+    { 12, 11, 7, -6, 29, 24, 20933 }, // ̈́
+    { 6, 5, 5, -2, -2, 8, 20957 }, // ͅ
+    { 22, 21, 23, 0, 21, 72, 20965 }, // Α
+    { 16, 22, 18, 1, 21, 61, 21037 }, // Β
+    { 15, 21, 17, 1, 21, 41, 21098 }, // Γ
+    { 19, 21, 20, 0, 21, 63, 21139 }, // Δ
+    { 17, 21, 19, 1, 21, 51, 21202 }, // Ε
+    { 16, 22, 18, 1, 21, 57, 21253 }, // Ζ
+    { 23, 21, 25, 1, 21, 79, 21310 }, // Η
+    { 21, 22, 23, 1, 21, 82, 21389 }, // Θ
+    { 9, 21, 11, 1, 21, 25, 21471 }, // Ι
+    { 21, 22, 23, 1, 21, 68, 21496 }, // Κ
+    { 21, 21, 22, 0, 21, 66, 21564 }, // Λ
+    { 26, 21, 27, 0, 21, 104, 21630 }, // Μ
+    { 22, 22, 24, 1, 21, 75, 21734 }, // Ν
+    { 17, 21, 19, 1, 21, 62, 21809 }, // Ξ
+    { 21, 22, 23, 1, 21, 76, 21871 }, // Ο
+    { 22, 21, 24, 1, 21, 74, 21947 }, // Π
+    { 16, 21, 18, 1, 21, 52, 22021 }, // Ρ
+    { 17, 22, 18, 0, 21, 55, 22073 }, // Σ
+    { 18, 21, 20, 1, 21, 54, 22128 }, // Τ
+    { 19, 21, 20, 0, 21, 63, 22182 }, // Υ
+    { 21, 22, 23, 1, 21, 81, 22245 }, // Φ
+    { 21, 21, 22, 0, 21, 68, 22326 }, // Χ
+    { 24, 21, 25, 0, 21, 89, 22394 }, // Ψ
+    { 22, 21, 24, 1, 21, 85, 22483 }, // Ω
+    { 18, 17, 20, 1, 16, 59, 22568 }, // α
+    { 15, 30, 18, 2, 23, 93, 22627 }, // β
+    { 16, 23, 17, 0, 16, 60, 22720 }, // γ
+    { 15, 24, 17, 1, 23, 69, 22780 }, // δ
+    { 13, 17, 15, 1, 16, 41, 22849 }, // ε
+    { 13, 30, 15, 1, 24, 66, 22890 }, // ζ
+    { 16, 23, 18, 0, 16, 73, 22956 }, // η
+    { 15, 24, 17, 1, 23, 78, 23029 }, // θ
+    { 8, 17, 11, 2, 16, 28, 23107 }, // ι
+    { 15, 17, 18, 2, 16, 53, 23135 }, // κ
+    { 18, 24, 19, 0, 23, 66, 23188 }, // λ
+    { 18, 23, 21, 2, 16, 75, 23254 }, // μ
+    { 16, 17, 17, 0, 16, 45, 23329 }, // ν
+    { 12, 30, 14, 1, 24, 61, 23374 }, // ξ
+    { 15, 17, 17, 1, 16, 51, 23435 }, // ο
+    { 19, 17, 20, 0, 16, 56, 23486 }, // π
+    { 15, 23, 17, 1, 16, 56, 23542 }, // ρ
+    { 13, 22, 15, 1, 16, 51, 23598 }, // ς
+    { 17, 17, 19, 1, 16, 54, 23649 }, // σ
+    { 15, 17, 16, 0, 16, 43, 23703 }, // τ
+    { 16, 17, 17, 0, 16, 52, 23746 }, // υ
+    { 22, 28, 24, 1, 21, 98, 23798 }, // φ
+    { 17, 23, 18, 0, 16, 68, 23896 }, // χ
+    { 22, 28, 23, 0, 21, 97, 23964 }, // ψ
+    { 20, 17, 22, 1, 16, 66, 24061 }, // ω
+    { 22, 28, 23, 0, 21, 88, 24127 }, // Ạ
+    { 15, 23, 17, 1, 16, 56, 24215 }, // ạ
+    { 22, 30, 23, 0, 30, 95, 24271 }, // Ả
+    { 15, 27, 17, 1, 26, 66, 24366 }, // ả
+    { 22, 31, 23, 0, 31, 99, 24432 }, // Ấ
+    { 15, 29, 17, 1, 28, 71, 24531 }, // ấ
+    { 22, 31, 23, 0, 31, 99, 24602 }, // Ầ
+    { 15, 29, 17, 1, 28, 69, 24701 }, // ầ
+    { 22, 31, 23, 0, 31, 104, 24770 }, // Ẩ
+    { 15, 29, 17, 1, 28, 79, 24874 }, // ẩ
+    { 22, 31, 23, 0, 31, 103, 24953 }, // Ẫ
+    { 15, 28, 17, 1, 27, 75, 25056 }, // ẫ
+    { 22, 35, 23, 0, 28, 106, 25131 }, // Ậ
+    { 15, 31, 17, 1, 24, 73, 25237 }, // ậ
+    { 22, 31, 23, 0, 31, 97, 25310 }, // Ắ
+    { 15, 29, 17, 1, 28, 72, 25407 }, // ắ
+    { 22, 31, 23, 0, 31, 97, 25479 }, // Ằ
+    { 15, 29, 17, 1, 28, 71, 25576 }, // ằ
+    { 22, 31, 23, 0, 31, 104, 25647 }, // Ẳ
+    { 15, 30, 17, 1, 29, 77, 25751 }, // ẳ
+    { 22, 31, 23, 0, 31, 103, 25828 }, // Ẵ
+    { 15, 28, 17, 1, 27, 73, 25931 }, // ẵ
+    { 22, 35, 23, 0, 28, 106, 26004 }, // Ặ
+    { 15, 30, 17, 1, 23, 71, 26110 }, // ặ
+    { 17, 28, 19, 1, 21, 63, 26181 }, // Ẹ
+    { 13, 23, 15, 1, 16, 51, 26244 }, // ẹ
+    { 17, 30, 19, 1, 30, 72, 26295 }, // Ẻ
+    { 13, 27, 15, 1, 26, 64, 26367 }, // ẻ
+    { 17, 28, 19, 1, 28, 67, 26431 }, // Ẽ
+    { 13, 24, 15, 1, 23, 57, 26498 }, // ẽ
+    { 17, 31, 19, 1, 31, 75, 26555 }, // Ế
+    { 15, 29, 17, 1, 28, 73, 26630 }, // ế
+    { 17, 31, 19, 1, 31, 74, 26703 }, // Ề
+    { 13, 29, 15, 1, 28, 69, 26777 }, // ề
+    { 17, 31, 19, 1, 31, 79, 26846 }, // Ể
+    { 16, 29, 18, 1, 28, 77, 26925 }, // ể
+    { 17, 31, 19, 1, 31, 78, 27002 }, // Ễ
+    { 13, 28, 15, 1, 27, 70, 27080 }, // ễ
+    { 17, 35, 19, 1, 28, 79, 27150 }, // Ệ
+    { 13, 31, 15, 1, 24, 69, 27229 }, // ệ
+    { 9, 30, 11, 1, 30, 41, 27298 }, // Ỉ
+    { 10, 26, 11, 0, 26, 51, 27339 }, // ỉ
+    { 9, 28, 11, 1, 21, 35, 27390 }, // Ị
+    { 10, 30, 11, 0, 23, 50, 27425 }, // ị
+    { 21, 28, 23, 1, 21, 89, 27475 }, // Ọ
+    { 16, 23, 18, 1, 16, 59, 27564 }, // ọ
+    { 21, 31, 23, 1, 30, 99, 27623 }, // Ỏ
+    { 16, 27, 18, 1, 26, 70, 27722 }, // ỏ
+    { 21, 32, 23, 1, 31, 103, 27792 }, // Ố
+    { 16, 29, 18, 1, 28, 76, 27895 }, // ố
+    { 21, 32, 23, 1, 31, 103, 27971 }, // Ồ
+    { 16, 29, 18, 1, 28, 78, 28074 }, // ồ
+    { 21, 32, 23, 1, 31, 108, 28152 }, // Ổ
+    { 16, 29, 18, 1, 28, 85, 28260 }, // ổ
+    { 21, 32, 23, 1, 31, 108, 28345 }, // Ỗ
+    { 16, 28, 18, 1, 27, 81, 28453 }, // ỗ
+    { 21, 35, 23, 1, 28, 107, 28534 }, // Ộ
+    { 16, 31, 18, 1, 24, 79, 28641 }, // ộ
+    { 22, 29, 24, 1, 28, 100, 28720 }, // Ớ
+    { 17, 25, 19, 1, 24, 70, 28820 }, // ớ
+    { 22, 29, 24, 1, 28, 101, 28890 }, // Ờ
+    { 17, 25, 19, 1, 24, 69, 28991 }, // ờ
+    { 22, 31, 24, 1, 30, 108, 29060 }, // Ở
+    { 17, 27, 19, 1, 26, 77, 29168 }, // ở
+    { 22, 29, 24, 1, 28, 104, 29245 }, // Ỡ
+    { 17, 24, 19, 1, 23, 71, 29349 }, // ỡ
+    { 22, 31, 24, 1, 24, 103, 29420 }, // Ợ
+    { 17, 26, 19, 1, 19, 69, 29523 }, // ợ
+    { 22, 28, 23, 0, 21, 97, 29592 }, // Ụ
+    { 19, 23, 20, 0, 16, 70, 29689 }, // ụ
+    { 22, 31, 23, 0, 30, 105, 29759 }, // Ủ
+    { 19, 27, 20, 0, 26, 83, 29864 }, // ủ
+    { 23, 29, 24, 0, 28, 103, 29947 }, // Ứ
+    { 19, 25, 20, 0, 24, 79, 30050 }, // ứ
+    { 23, 29, 24, 0, 28, 102, 30129 }, // Ừ
+    { 19, 25, 20, 0, 24, 80, 30231 }, // ừ
+    { 23, 31, 24, 0, 30, 109, 30311 }, // Ử
+    { 19, 27, 20, 0, 26, 88, 30420 }, // ử
+    { 23, 29, 24, 0, 28, 104, 30508 }, // Ữ
+    { 19, 24, 20, 0, 23, 82, 30612 }, // ữ
+    { 23, 31, 24, 0, 24, 105, 30694 }, // Ự
+    { 19, 26, 20, 0, 19, 79, 30799 }, // ự
+    { 20, 28, 21, 0, 28, 76, 30878 }, // Ỳ
+    { 18, 31, 19, 0, 24, 80, 30954 }, // ỳ
+    { 20, 28, 21, 0, 21, 75, 31034 }, // Ỵ
+    { 18, 22, 19, 0, 15, 68, 31109 }, // ỵ
+    { 20, 30, 21, 0, 30, 84, 31177 }, // Ỷ
+    { 18, 33, 19, 0, 26, 87, 31261 }, // ỷ
+    { 20, 28, 21, 0, 28, 80, 31348 }, // Ỹ
+    { 18, 30, 19, 0, 23, 83, 31428 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 31511 }, //  
+    { 0, 0, 29, 0, 0, 0, 31511 }, //  
+    { 0, 0, 15, 0, 0, 0, 31511 }, //  
+    { 0, 0, 29, 0, 0, 0, 31511 }, //  
+    { 0, 0, 10, 0, 0, 0, 31511 }, //  
+    { 0, 0, 7, 0, 0, 0, 31511 }, //  
+    { 0, 0, 5, 0, 0, 0, 31511 }, //  
+    { 0, 0, 18, 0, 0, 0, 31511 }, //  
+    { 0, 0, 8, 0, 0, 0, 31511 }, //  
+    { 0, 0, 6, 0, 0, 0, 31511 }, //  
+    { 0, 0, 1, 0, 0, 0, 31511 }, //  
+    { 0, 0, 1, 0, 0, 0, 31511 }, // ​
+    { 2, 24, 2, -1, 17, 24, 31511 }, // ‌
+    { 6, 26, 4, -3, 19, 42, 31535 }, // ‍
+    { 10, 28, 6, -5, 21, 55, 31577 }, // ‎
+    { 10, 28, 6, -5, 21, 54, 31632 }, // ‏
+    { 9, 3, 11, 1, 9, 8, 31686 }, // ‐
+    { 9, 3, 11, 1, 9, 8, 31694 }, // ‑
+    { 14, 3, 18, 2, 11, 6, 31702 }, // ‒
+    { 15, 3, 16, 0, 9, 18, 31708 }, // –
+    { 29, 3, 30, 0, 9, 33, 31726 }, // —
+    { 29, 3, 30, 0, 9, 33, 31759 }, // ―
+    { 10, 30, 15, 2, 23, 91, 31792 }, // ‖
+    { 15, 7, 16, 0, -1, 24, 31883 }, // ‗
+    { 5, 10, 7, 1, 22, 15, 31907 }, // ‘
+    { 6, 10, 7, 0, 22, 15, 31922 }, // ’
+    { 6, 10, 7, 0, 4, 15, 31937 }, // ‚
+    { 5, 10, 7, 1, 22, 15, 31952 }, // ‛
+    { 11, 10, 13, 1, 22, 28, 31967 }, // “
+    { 12, 10, 13, 0, 22, 28, 31995 }, // ”
+    { 12, 10, 13, 0, 4, 28, 32023 }, // „
+    { 11, 10, 13, 1, 22, 29, 32051 }, // ‟
+    { 14, 19, 15, 0, 21, 45, 32080 }, // †
+    { 14, 23, 15, 0, 21, 59, 32125 }, // ‡
+    { 7, 7, 9, 1, 11, 12, 32184 }, // •
+    { 10, 10, 18, 4, 15, 19, 32196 }, // ‣
+    { 6, 5, 8, 1, 4, 7, 32215 }, // ․
+    { 12, 5, 15, 1, 4, 14, 32222 }, // ‥
+    { 25, 5, 29, 2, 4, 23, 32236 }, // …
+    { 6, 4, 8, 1, 10, 7, 32259 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 32266 }, //  
+    { 0, 0, 1, 0, 0, 0, 32266 }, //  
+    { 10, 28, 6, -5, 21, 53, 32266 }, // ‪
+    { 10, 28, 6, -5, 21, 52, 32319 }, // ‫
+    { 10, 27, 6, -5, 20, 48, 32371 }, // ‬
+    { 12, 28, 7, -6, 21, 73, 32419 }, // ‭
+    { 12, 28, 7, -6, 21, 73, 32492 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 32565 }, //  
+    { 38, 24, 40, 1, 22, 153, 32565 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 32718 }, // ′
+    { 12, 10, 14, 1, 21, 28, 32733 }, // ″
+    { 17, 10, 19, 1, 21, 42, 32761 }, // ‴
+    { 6, 10, 8, 1, 21, 14, 32803 }, // ‵
+    { 12, 10, 14, 1, 21, 28, 32817 }, // ‶
+    { 19, 10, 21, 1, 21, 42, 32845 }, // ‷
+    { 13, 6, 15, 1, 0, 18, 32887 }, // ‸
+    { 7, 11, 9, 1, 13, 19, 32905 }, // ‹
+    { 8, 11, 10, 1, 13, 17, 32924 }, // ›
+    { 18, 20, 19, 0, 19, 82, 32941 }, // ※
+    { 13, 23, 16, 2, 22, 65, 33023 }, // ‼
+    { 15, 3, 16, 0, 24, 18, 33088 }, // ‾
+    { 7, 3, 9, 1, 9, 7, 33106 }, // ⁃
+    { 15, 24, 11, -5, 22, 48, 33113 }, // ⁄
+    { 23, 23, 26, 2, 22, 79, 33161 }, // ⁇
+    { 19, 23, 22, 2, 22, 71, 33240 }, // ⁈
+    { 19, 23, 22, 2, 22, 73, 33311 }, // ⁉
+    { 17, 5, 29, 6, 11, 19, 33384 }, // ⁓
+    { 23, 10, 25, 1, 21, 56, 33403 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 33459 }, //  
+    { 0, 0, 1, 0, 0, 0, 33459 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 33459 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 33459 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 33459 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 33459 }, // ⁤
+    { 11, 14, 13, 1, 24, 35, 33459 }, // ⁰
+    { 11, 14, 13, 1, 24, 38, 33494 }, // ⁴
+    { 10, 14, 13, 1, 24, 34, 33532 }, // ⁵
+    { 11, 14, 13, 1, 24, 35, 33566 }, // ⁶
+    { 10, 14, 13, 2, 24, 32, 33601 }, // ⁷
+    { 11, 14, 13, 1, 24, 38, 33633 }, // ⁸
+    { 11, 14, 13, 1, 24, 35, 33671 }, // ⁹
+    { 13, 11, 16, 2, 21, 35, 33706 }, // ⁿ
+    { 11, 15, 13, 1, 10, 32, 33741 }, // ₀
+    { 9, 14, 13, 2, 10, 23, 33773 }, // ₁
+    { 11, 14, 13, 1, 10, 33, 33796 }, // ₂
+    { 9, 15, 13, 2, 10, 30, 33829 }, // ₃
+    { 11, 15, 13, 1, 10, 33, 33859 }, // ₄
+    { 10, 14, 13, 1, 9, 26, 33892 }, // ₅
+    { 11, 15, 13, 1, 10, 31, 33918 }, // ₆
+    { 10, 14, 13, 2, 9, 27, 33949 }, // ₇
+    { 11, 15, 13, 1, 10, 41, 33976 }, // ₈
+    { 11, 15, 13, 1, 10, 36, 34017 }, // ₉
+    { 15, 20, 18, 1, 20, 62, 34053 }, // ₣
+    { 16, 22, 18, 1, 21, 63, 34115 }, // ₤
+    { 36, 22, 37, 0, 21, 133, 34178 }, // ₧
+    { 18, 22, 19, 0, 21, 65, 34311 }, // €
+    { 17, 12, 29, 6, 16, 28, 34376 }, // ←
+    { 13, 20, 29, 8, 20, 55, 34404 }, // ↑
+    { 17, 12, 29, 6, 16, 28, 34459 }, // →
+    { 13, 20, 29, 8, 20, 53, 34487 }, // ↓
+    { 18, 12, 29, 5, 16, 32, 34540 }, // ↔
+    { 13, 20, 29, 8, 20, 54, 34572 }, // ↕
+    { 13, 20, 29, 8, 20, 58, 34626 }, // ↨
+    { 13, 20, 29, 8, 20, 45, 34684 }, // ↲
+    { 13, 20, 29, 8, 20, 45, 34729 }, // ↳
+    { 17, 14, 29, 6, 17, 37, 34774 }, // ↵
+    { 17, 14, 29, 6, 17, 34, 34811 }, // ⇐
+    { 13, 18, 29, 8, 19, 66, 34845 }, // ⇑
+    { 17, 14, 29, 6, 17, 35, 34911 }, // ⇒
+    { 13, 18, 29, 8, 19, 69, 34946 }, // ⇓
+    { 19, 14, 29, 5, 17, 39, 35015 }, // ⇔
+    { 19, 22, 29, 5, 21, 70, 35054 }, // ∀
+    { 14, 24, 18, 2, 23, 64, 35124 }, // ∂
+    { 13, 21, 29, 8, 21, 42, 35188 }, // ∃
+    { 23, 24, 29, 3, 22, 102, 35230 }, // ∅
+    { 19, 21, 20, 0, 21, 63, 35332 }, // ∆
+    { 19, 22, 29, 5, 21, 63, 35395 }, // ∇
+    { 19, 21, 29, 5, 21, 58, 35458 }, // ∈
+    { 19, 26, 29, 5, 23, 82, 35516 }, // ∉
+    { 19, 16, 29, 5, 18, 61, 35598 }, // ∊
+    { 19, 21, 29, 5, 21, 58, 35659 }, // ∋
+    { 19, 26, 29, 5, 23, 82, 35717 }, // ∌
+    { 19, 16, 29, 5, 18, 61, 35799 }, // ∍
+    { 22, 26, 24, 1, 21, 98, 35860 }, // ∏
+    { 18, 26, 19, 0, 21, 70, 35958 }, // ∑
+    { 13, 3, 18, 3, 11, 5, 36028 }, // −
+    { 13, 23, 15, 1, 21, 47, 36033 }, // ∕
+    { 13, 23, 16, 2, 21, 45, 36080 }, // ∖
+    { 14, 14, 18, 2, 17, 37, 36125 }, // ∗
+    { 10, 10, 18, 4, 15, 28, 36162 }, // ∘
+    { 6, 4, 18, 6, 10, 7, 36190 }, // ∙
+    { 18, 28, 19, 0, 24, 73, 36197 }, // √
+    { 14, 11, 18, 2, 15, 39, 36270 }, // ∝
+    { 18, 10, 19, 0, 14, 45, 36309 }, // ∞
+    { 19, 21, 29, 5, 21, 52, 36354 }, // ∟
+    { 21, 21, 29, 3, 21, 56, 36406 }, // ∠
+    { 4, 30, 15, 5, 23, 46, 36462 }, // ∣
+    { 9, 30, 15, 3, 23, 91, 36508 }, // ∥
+    { 19, 21, 29, 5, 21, 63, 36599 }, // ∧
+    { 19, 21, 29, 5, 21, 63, 36662 }, // ∨
+    { 17, 21, 29, 6, 21, 66, 36725 }, // ∩
+    { 17, 22, 29, 6, 21, 67, 36791 }, // ∪
+    { 16, 30, 18, 1, 23, 76, 36858 }, // ∫
+    { 19, 17, 29, 5, 16, 37, 36934 }, // ∴
+    { 19, 17, 29, 5, 16, 36, 36971 }, // ∵
+    { 5, 16, 9, 2, 18, 17, 37007 }, // ∶
+    { 19, 17, 29, 5, 16, 42, 37024 }, // ∷
+    { 17, 5, 29, 6, 11, 19, 37066 }, // ∼
+    { 17, 15, 29, 6, 17, 59, 37085 }, // ≅
+    { 14, 10, 18, 2, 15, 37, 37144 }, // ≈
+    { 17, 10, 29, 6, 13, 35, 37181 }, // ≍
+    { 13, 13, 18, 3, 16, 39, 37216 }, // ≠
+    { 17, 13, 29, 6, 15, 60, 37255 }, // ≡
+    { 14, 18, 18, 2, 18, 35, 37315 }, // ≤
+    { 14, 18, 18, 2, 18, 35, 37350 }, // ≥
+    { 23, 14, 29, 3, 17, 50, 37385 }, // ≪
+    { 23, 14, 29, 3, 17, 51, 37435 }, // ≫
+    { 19, 16, 29, 5, 18, 54, 37486 }, // ⊃
+    { 19, 26, 29, 5, 23, 84, 37540 }, // ⊄
+    { 19, 26, 29, 5, 23, 82, 37624 }, // ⊅
+    { 19, 21, 29, 5, 21, 61, 37706 }, // ⊆
+    { 19, 21, 29, 5, 21, 62, 37767 }, // ⊇
+    { 21, 22, 29, 4, 21, 98, 37829 }, // ⊕
+    { 21, 22, 29, 4, 21, 78, 37927 }, // ⊖
+    { 21, 22, 29, 4, 21, 97, 38005 }, // ⊗
+    { 21, 22, 29, 4, 21, 94, 38102 }, // ⊘
+    { 17, 21, 29, 6, 21, 40, 38196 }, // ⊥
+    { 6, 5, 18, 6, 10, 7, 38236 }, // ⋅
+    { 25, 5, 29, 2, 10, 21, 38243 }, // ⋯
+    { 27, 28, 29, 1, 24, 109, 38264 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
@@ -4377,4 +3168,5 @@ static const EpdFontData bookerly_14_regular = {
     31,
     -8,
     true,
+    true,
 };
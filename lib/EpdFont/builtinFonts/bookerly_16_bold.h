@@ -2,5565 +2,3875 @@
  * generated by fontconvert.py
  * name: bookerly_16_bold
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_boldBitmaps[77959] = {
-    0x0A, 0x90, 0xFF, 0x87, 0xFE, 0x2F, 0xF4, 0xBF, 0xC2, 0xFF, 0x0B, 0xFC, 0x2F, 0xF0, 0xBF, 0xC2,
-    0xFF, 0x0B, 0xFC, 0x1F, 0xF0, 0x7F, 0xC0, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0xBF, 0x01,
-    0x40, 0x00, 0x00, 0x05, 0x40, 0xFF, 0xC7, 0xFF, 0x1F, 0xFC, 0x3F, 0xF0, 0x19, 0x00, 0x0A, 0x80,
-    0xA9, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFC, 0xBF, 0xC7, 0xFC, 0xBF, 0xC3, 0xFC, 0x7F, 0xC3, 0xFC,
-    0x7F, 0x83, 0xFC, 0x7F, 0x83, 0xFC, 0x3F, 0x83, 0xFC, 0x3F, 0x43, 0xF8, 0x39, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x01, 0xAB, 0xFE, 0xAF,
-    0xFA, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xC0, 0x7F,
-    0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x15, 0xFF, 0x56, 0xFD, 0x54, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x41, 0x5B, 0xF5, 0x6F, 0xE5, 0x40, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x01, 0x50, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xF6, 0xF2, 0xFF, 0x07, 0xF4, 0x7C, 0x2F, 0xC2, 0xFC, 0x2F, 0x03, 0xE0,
-    0xBF, 0x4B, 0xC0, 0xA0, 0x2F, 0xF2, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xF0, 0x24, 0x0F, 0x8B, 0xFC, 0x3E, 0x03, 0xE0, 0xFF, 0x1F, 0xC0, 0xF8, 0x3F, 0xCB, 0xF4,
-    0x3E, 0x0F, 0xF2, 0xFF, 0x0F, 0x4F, 0xF4, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x1F, 0xE6, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x7F, 0x40, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x7F,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xF0, 0xBF, 0x00, 0x69, 0x00, 0x3F, 0xC0, 0xFE, 0x0F,
-    0xD0, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0xC2, 0xF8, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x3F, 0x07,
-    0xF4, 0x7F, 0xC0, 0x1B, 0xE4, 0x0F, 0xE0, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x01, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x1F, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x7F, 0x80, 0x00,
-    0x1F, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x1F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x7D, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0xBF, 0xC0, 0x6F, 0xFA, 0x41, 0xFF, 0x0F, 0xFC, 0x01, 0xFC,
-    0x00, 0xBF, 0x81, 0xFF, 0xC0, 0x7F, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x1F, 0xC0, 0x0F, 0xF8, 0x02,
-    0xFF, 0xDB, 0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xE4, 0x02, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x01, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0x00, 0x00, 0x55, 0x40, 0x00, 0x55, 0x00,
-    0x0A, 0x83, 0xFC, 0x7F, 0xCB, 0xFC, 0xBF, 0xC7, 0xFC, 0x7F, 0x87, 0xF8, 0x3F, 0x83, 0xF4, 0x39,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80,
-    0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFE,
-    0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x01, 0xFF,
-    0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xE0, 0xFE, 0x00, 0xBE, 0x3F, 0x00, 0x3F, 0xEF, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x6F, 0xFD, 0xFC, 0x3F, 0xDF, 0x41, 0x0B, 0xD3, 0xF0,
-    0x00, 0x90, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFF,
-    0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x2F, 0xD0, 0x0F, 0xE0, 0x0F, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x42, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x06, 0x90, 0xBF, 0xD3,
-    0xFF, 0x8F, 0xFE, 0x3F, 0xF0, 0x19, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFD, 0x02, 0xFF, 0xC0, 0xBF, 0xE0, 0x03, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x3F, 0xF6, 0xFF, 0x40, 0x00, 0xFF, 0xDF, 0xFD,
-    0x00, 0x02, 0xFF, 0x7F, 0xF4, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x3F, 0xF7, 0xFF, 0x40, 0x00,
-    0xFF, 0xDF, 0xFD, 0x00, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0x7F, 0xF1,
-    0xFF, 0xC0, 0x02, 0xFF, 0x43, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFF, 0x81, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x6F, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x50, 0x1F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFB, 0xFF, 0xF0, 0x3F, 0xF8, 0x07, 0xFF, 0x43, 0xFF,
-    0x00, 0x3F, 0xF8, 0x3F, 0xE0, 0x02, 0xFF, 0x82, 0xFD, 0x00, 0x2F, 0xF8, 0x05, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x6B, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xEA, 0xFF,
-    0xF0, 0xBF, 0xC0, 0x0F, 0xFC, 0x1F, 0xC0, 0x02, 0xFF, 0x41, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x24, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x5F, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0x2F,
-    0xF3, 0xFF, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x02, 0xFE, 0x03,
-    0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xFA, 0xAB, 0xFF,
-    0xAA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x55,
-    0x55, 0x55, 0x40, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFD, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x06, 0xAF, 0xFF,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x1B, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x03, 0xFF, 0xC3, 0xFF,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF4, 0x00, 0xBF,
-    0xD2, 0xFF, 0x80, 0x0B, 0xFD, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0xF4, 0x7F, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x15, 0x55, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0x95, 0x57, 0xFF, 0x2F, 0xC0, 0x00, 0xFF, 0x4B, 0xE0, 0x00, 0xFF, 0xC0, 0xF4, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF5, 0x7F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF8, 0x0B, 0xFF, 0x43, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xE1, 0xFF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0xC2, 0xFF, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0xBF, 0xE3, 0xFF, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0xFF, 0xD3, 0xFF, 0xD0, 0x2F, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFC, 0x07, 0xFF, 0x82, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xF0, 0x00,
-    0xFF, 0xD3, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xE3, 0xFF, 0x40, 0x07, 0xFE, 0x2F,
-    0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0xF4, 0x0B, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x1B, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x42, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xFF, 0xC0, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xF0, 0x3F, 0xFC, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0B, 0xF0, 0x07,
-    0xF4, 0x03, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x0B,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0x95, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0x90, 0x10, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF,
-    0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x0B, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x0E, 0x56, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x1B, 0xF4, 0x01, 0xBF, 0xFC, 0x0B, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x06, 0xF9, 0x00, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0xFF, 0x00,
-    0x1F, 0xE0, 0x3F, 0xC0, 0x2F, 0xFB, 0xFD, 0x00, 0x3F, 0xC2, 0xFE, 0x00, 0xFE, 0x07, 0xFC, 0x00,
-    0xFF, 0x0F, 0xF4, 0x03, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0xFF, 0x00, 0x00, 0x16, 0xFF, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFF,
-    0x1F, 0xF0, 0x01, 0xFF, 0xAF, 0xF0, 0x03, 0xF8, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xD1,
-    0xFF, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x01, 0xFF, 0x0B, 0xFE, 0x5F, 0xF0, 0x0F,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0xBF,
-    0xC0, 0x06, 0xF8, 0x06, 0xA8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xFF,
-    0xE4, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xEB, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x01, 0x54, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFF,
-    0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xA5, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xAB, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03,
-    0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x95, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC,
-    0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xF9, 0x6A, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xD0, 0x3F, 0xF4, 0x00, 0xFD, 0x03,
-    0xFF, 0x40, 0x0B, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xEA, 0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFE, 0xAA, 0x90, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9,
-    0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF,
-    0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0,
-    0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B,
-    0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFD,
-    0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2E, 0x40, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x41, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF,
-    0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95,
-    0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00,
-    0x03, 0xF7, 0xFE, 0x00, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xDB, 0xFC, 0x03, 0xF3, 0xFF, 0x00, 0x00,
-    0x7F, 0x5F, 0xF0, 0x2F, 0xCF, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0xD0, 0xFE, 0x2F, 0xF0, 0x00, 0x0B,
-    0xF0, 0xFF, 0xC3, 0xF0, 0xBF, 0xC0, 0x00, 0x2F, 0xC1, 0xFF, 0x1F, 0xC2, 0xFF, 0x40, 0x00, 0xFF,
-    0x03, 0xFD, 0xBE, 0x07, 0xFD, 0x00, 0x03, 0xFC, 0x0F, 0xFB, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xF0,
-    0x1F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00,
-    0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x03,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xA0, 0x1F,
-    0xC0, 0x1F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xBF, 0xF8, 0x02, 0xFE,
-    0x00, 0x03, 0xFC, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x3F,
-    0xC2, 0xFF, 0xE0, 0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF, 0xD2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF,
-    0xCB, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4,
-    0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
-    0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0x42, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x02, 0xFF, 0xC0, 0xFF, 0xD0,
-    0x07, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x3F, 0xF4, 0x03, 0xFF,
-    0x40, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFA, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF0,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x2F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0xF5, 0x1B, 0xFF,
-    0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00,
-    0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3,
-    0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0,
-    0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE, 0x00,
-    0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x4F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x2A, 0x40, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF4, 0x00,
-    0xBF, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xFC, 0x01, 0xFF,
-    0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0x7F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0x4F, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x1F, 0xC3, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xF0, 0x7F, 0xE2, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE3, 0xF8, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x03, 0xFF, 0x3F,
-    0x80, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x1F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF,
-    0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00,
-    0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFD,
-    0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
-    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x7F, 0xFF, 0x2F, 0xFF, 0xC7, 0xFF, 0xF0, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x03, 0xF4, 0xFF, 0x00,
-    0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFE, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x04, 0x00, 0x2E, 0x00, 0x7F, 0x40, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x0B, 0xF8, 0x01, 0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80,
-    0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA9, 0x00, 0x00,
-    0x3F, 0xF7, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF4, 0x2F, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x02,
-    0xA9, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x06,
-    0xAA, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEF,
-    0xFF, 0x80, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x02, 0xFF,
-    0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x02, 0xFF, 0x80,
-    0xFF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xF0, 0x02, 0xFF, 0x80, 0x7F,
-    0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xFE, 0x5F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF,
-    0xFE, 0xFF, 0xFE, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x6B, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x7F, 0xE0, 0x2F, 0x80,
-    0x0B, 0xFC, 0x00, 0xA0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B,
-    0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF,
-    0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xE4, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xBF,
-    0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00,
-    0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x50,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xF8, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x80, 0x1F, 0xFD, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFC, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC1, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xDF, 0xFC,
-    0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x1F, 0xFE, 0x40, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0x4F, 0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x02, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00, 0x5A, 0x01, 0xA9, 0x00, 0x06, 0xA4,
-    0x00, 0x0B, 0xFF, 0xC7, 0xFF, 0xF4, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF4, 0x7F, 0xFF, 0xD2,
-    0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x07, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0x7F, 0xF8, 0x02, 0xFF, 0xE4, 0x2F, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x00, 0x5A,
-    0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF,
-    0xFE, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF,
-    0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0,
-    0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC,
-    0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x2F, 0xFD, 0x3F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF, 0xFC,
-    0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x40,
-    0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFC, 0x02, 0xFF,
-    0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x2F, 0xF8, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0xBF,
-    0xE0, 0x02, 0xFF, 0x83, 0xFF, 0x40, 0x0B, 0xFE, 0x0F, 0xFE, 0x00, 0x2F, 0xF8, 0x2F, 0xF8, 0x00,
-    0xBF, 0xE0, 0xBF, 0xF0, 0x02, 0xFF, 0x81, 0xFF, 0xD0, 0x0F, 0xFE, 0x03, 0xFF, 0xE6, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xD7, 0xFE, 0x00, 0x00,
-    0x40, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x07, 0xFD, 0x07, 0xFC, 0x2F, 0xE0, 0x07, 0xF0,
-    0xFF, 0x80, 0x0F, 0x83, 0xFF, 0xD0, 0x14, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x2E, 0x00, 0x7F, 0xF5, 0xFC, 0x00,
-    0x7F, 0xD7, 0xF4, 0x01, 0xFF, 0x1F, 0xFD, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x3F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00,
-    0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x0B, 0xFE, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F,
-    0x40, 0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0xFD, 0x3F, 0xFF, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-    0xF4, 0x02, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xFC,
-    0x03, 0xF8, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0xBF, 0xC0, 0xFF, 0xFD, 0x0B,
-    0xF0, 0x00, 0x07, 0xFD, 0x1F, 0x5F, 0xE0, 0xFE, 0x00, 0x00, 0x3F, 0xE2, 0xF0, 0xFF, 0x1F, 0xC0,
-    0x00, 0x02, 0xFF, 0x3F, 0x0F, 0xF6, 0xFC, 0x00, 0x00, 0x1F, 0xF7, 0xE0, 0xBF, 0xBF, 0x40, 0x00,
-    0x00, 0xFF, 0xFD, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xFE, 0x00,
-    0xBF, 0x80, 0x01, 0xFF, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xD7, 0xFE,
-    0x00, 0x00, 0x2F, 0xE0, 0xBF, 0xE0, 0x00, 0x2F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xF4, 0x02, 0xFF,
-    0xE4, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x2F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x2F, 0xFC,
-    0x07, 0xD0, 0x1F, 0xFC, 0x00, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x24, 0x03, 0xFF,
-    0x80, 0x2F, 0x03, 0xFF, 0xC0, 0x0F, 0xC2, 0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x41, 0xFF, 0xF8, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
-    0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x0F, 0xF4,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xFA, 0x40, 0x3F,
-    0xFF, 0x40, 0x2F, 0xFD, 0x00, 0x05, 0x50, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC,
-    0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x2B, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF,
-    0x80, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x1A, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0x41, 0xFF, 0xFC, 0x03, 0xF0, 0xFF, 0xFF, 0xE7,
-    0xFC, 0xBF, 0x9F, 0xFF, 0xFE, 0x1F, 0x80, 0x7F, 0xFF, 0x01, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xB0,
-    0x1F, 0xD0, 0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x1F, 0xF0,
-    0x7F, 0xC1, 0xFF, 0x4B, 0xFD, 0x2F, 0xF4, 0xBF, 0xD3, 0xFF, 0x0F, 0xFC, 0x3F, 0xD0, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFE, 0x3D,
-    0x3F, 0xD0, 0xFF, 0x83, 0xD1, 0xFC, 0x0F, 0xF0, 0x3D, 0x0F, 0x42, 0xFE, 0x03, 0xD0, 0x40, 0x3F,
-    0xD0, 0x3C, 0x00, 0x03, 0xFD, 0x03, 0xC0, 0x00, 0x3F, 0xD0, 0x7C, 0x00, 0x03, 0xFE, 0x07, 0xC0,
-    0x00, 0x3F, 0xE0, 0x7C, 0x00, 0x02, 0xFF, 0x07, 0xC0, 0x00, 0x1F, 0xFC, 0x7C, 0x00, 0x40, 0xFF,
-    0xFF, 0xC5, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x47, 0xFE, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x07,
-    0xFC, 0x01, 0xFD, 0x00, 0x0F, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x6F, 0xF5, 0x56, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x15, 0xFF, 0x55, 0x56, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xFF, 0xFF, 0xF4, 0x07, 0x80, 0x00, 0x15, 0x40, 0x08, 0x00, 0x00,
-    0x01, 0x40, 0xFC, 0x06, 0xA4, 0x1F, 0x47, 0xFD, 0xFF, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xAF, 0xFD, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0xFD,
-    0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x3F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFE, 0x7F, 0xFD, 0x3F, 0xC1,
-    0xE0, 0x00, 0x00, 0x3C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x05, 0x55, 0x51, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0x80,
-    0x02, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0xFF, 0xFD, 0x54, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0xBF, 0xFA, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3, 0xFC, 0xFF, 0x3F, 0xCF, 0xF3,
-    0xFC, 0xFF, 0x3F, 0xC0, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x02,
-    0xF8, 0x0F, 0xFC, 0x1F, 0xC0, 0x0F, 0xE0, 0xFF, 0x00, 0x1F, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0xBE, 0xFF, 0x40, 0x02, 0xF3, 0xFF, 0xD0, 0x0B, 0xC2, 0xFF, 0xE0, 0x1F, 0x41, 0xFF,
-    0xE0, 0x3F, 0x40, 0x7F, 0xE0, 0xBF, 0x80, 0x2F, 0xC0, 0xFF, 0xE0, 0x2F, 0x80, 0xFF, 0xF4, 0x3E,
-    0x00, 0xBF, 0xF8, 0xFC, 0x00, 0x3F, 0xF6, 0xE0, 0x00, 0x1F, 0xFF, 0x81, 0x00, 0x0F, 0xFD, 0x3F,
-    0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x3F, 0x8B, 0xFC, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x8B, 0xFC, 0x3F, 0xF3,
-    0xFF, 0x0F, 0xFC, 0x7F, 0x81, 0xFE, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x7C, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x0B,
-    0xC0, 0x0F, 0x0B, 0x40, 0xBE, 0x01, 0xF0, 0x02, 0xD3, 0xC0, 0x3F, 0x00, 0x10, 0x00, 0x78, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x1E, 0x3C, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xCF, 0x01, 0xFC, 0x00, 0x00,
-    0x01, 0xE3, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x78, 0xB4, 0x0F, 0xF0, 0x00, 0x00, 0x2D, 0x1E, 0x02,
-    0xFF, 0x96, 0xD0, 0x0F, 0x03, 0xC0, 0x3F, 0xFF, 0xF0, 0x07, 0xC0, 0xB8, 0x02, 0xFF, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x01, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x02, 0xFF, 0xF0, 0x02, 0xFE, 0xFE,
-    0x00, 0xFC, 0x1F, 0xC0, 0x05, 0x03, 0xF0, 0x00, 0x16, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x5F,
-    0xC0, 0x7E, 0x03, 0xF0, 0x0F, 0xC2, 0xFE, 0x83, 0xFF, 0xFF, 0xF0, 0x3F, 0xD3, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x09, 0x00, 0x06, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x7F,
-    0xD0, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xFD, 0x0B, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xFD,
-    0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x02, 0xFF, 0x01, 0xFF,
-    0x00, 0x07, 0xF4, 0x07, 0xFC, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x15, 0x55, 0x42, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x1A, 0xA9,
-    0x03, 0xC0, 0x78, 0x7F, 0xBE, 0x07, 0x42, 0xC0, 0x7C, 0x7C, 0x0F, 0x0F, 0x01, 0xF1, 0xF0, 0x2C,
-    0x3C, 0x07, 0xDF, 0x40, 0xB0, 0xE0, 0x1F, 0xF4, 0x02, 0xC3, 0xC0, 0x7D, 0xF0, 0x0B, 0x0B, 0x01,
-    0xF3, 0xF0, 0x3C, 0x1D, 0x1F, 0xE3, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00,
-    0xB4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00,
-    0x2A, 0xAA, 0xA9, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x00, 0x6F, 0x90, 0x00,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xBF, 0x97, 0xFD, 0x3F, 0x80, 0x3F, 0x8F, 0xC0, 0x0F, 0xE3,
-    0xF4, 0x03, 0xF8, 0xFE, 0x00, 0xFD, 0x2F, 0xE6, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x40,
-    0x01, 0xA9, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xEF, 0xF8, 0x3F,
-    0xC1, 0xFF, 0x0F, 0xD0, 0x3F, 0xC0, 0xA0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF5, 0x55, 0x1F, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xF4, 0x6A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x3F,
-    0xD7, 0xFD, 0x3E, 0x01, 0xFD, 0x08, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x01, 0xBF, 0xD0, 0x02, 0xFF,
-    0xF8, 0x01, 0xAB, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFD, 0x2A, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x40, 0xFF, 0x07, 0xFC,
-    0x3F, 0xD1, 0xFD, 0x0B, 0xD0, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x68, 0x00, 0x05, 0x80, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0xC0,
-    0x02, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x2F, 0xFE, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x3F, 0xE1, 0x50, 0x00,
-    0x54, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x1F, 0x80, 0x2F, 0xFF, 0xFC, 0x7E, 0x00,
-    0xFF, 0xFF, 0xF1, 0xF8, 0x07, 0xFF, 0xFF, 0xC7, 0xE0, 0x1F, 0xFF, 0xFF, 0x1F, 0x80, 0x7F, 0xFF,
-    0xFC, 0x7E, 0x01, 0xFF, 0xFF, 0xF1, 0xF8, 0x07, 0xFF, 0xFF, 0xC7, 0xE0, 0x0F, 0xFF, 0xFF, 0x1F,
-    0x80, 0x1F, 0xFF, 0xFC, 0x7E, 0x00, 0x2F, 0xFF, 0xF1, 0xF8, 0x00, 0x2F, 0xDF, 0xC7, 0xE0, 0x00,
-    0x04, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x0F,
-    0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x03, 0xF1, 0xF8,
-    0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x7C, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x06, 0x90, 0xFF,
-    0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x15, 0x00, 0x05, 0x01, 0xFF, 0x87, 0xFF, 0x01, 0xFD, 0x07,
-    0xF0, 0x3F, 0x47, 0xF4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x01, 0xBF, 0xF0, 0x2F, 0xFF,
-    0xC0, 0x7F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x6F, 0xFF, 0x83, 0xFF, 0xFF, 0x4A,
-    0xAA, 0xA8, 0x00, 0x59, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0xFD, 0x07, 0xF8, 0x7F,
-    0x00, 0xBF, 0x1F, 0xC0, 0x1F, 0xCB, 0xF0, 0x07, 0xF1, 0xFC, 0x01, 0xFC, 0x7F, 0x40, 0xBE, 0x0F,
-    0xF5, 0xBF, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x05, 0x55, 0x40, 0x00, 0x18, 0x00, 0x19, 0x00, 0x07, 0xF4,
-    0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFF, 0x03, 0xFF,
-    0x40, 0x1F, 0xFC, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x1F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF,
-    0x02, 0xFF, 0x40, 0xFF, 0x80, 0xBF, 0xC0, 0x2F, 0xE0, 0x1F, 0xF0, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0x18, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x1A, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x1F, 0xFC, 0x00, 0x6F, 0xF9, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0x80, 0x0F, 0xDF, 0xC0, 0x7F, 0xFF, 0xF4, 0x1F, 0xC0, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x55, 0x7F, 0x50, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x5F, 0xE0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x0F, 0xD0, 0x1B, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0xFF, 0xD0, 0x00,
-    0xFE, 0x00, 0x03, 0xF4, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x1F, 0xE0, 0xFF, 0x80,
-    0x6F, 0xF9, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0xBC, 0x0B, 0xF4,
-    0x7F, 0xFF, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x2F,
-    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1C, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x68,
-    0x00, 0x00, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xD0, 0x01, 0xFF, 0xC0, 0x15, 0xAF, 0xFC, 0x01, 0xFC, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0x0F, 0xDF, 0xC0, 0x3F, 0xFF, 0x80, 0x0B, 0xF0,
-    0x03, 0xF4, 0xFC, 0x00, 0x55, 0x00, 0x00, 0xFD, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0x55, 0xFD, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFD, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x10, 0x0F, 0xFE, 0xAF, 0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF7,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x2C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD3, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC2,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA,
-    0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD6, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x7F,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x9F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC7,
-    0xFF, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xFC, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xE5, 0x55, 0xBF, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xD5, 0x6B, 0xFC, 0x0B,
-    0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B,
-    0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4,
-    0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6E,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x01, 0xFF, 0x83, 0xFF,
-    0x00, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF,
-    0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03,
-    0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x08, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x3F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xBF, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x02, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x1B, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xC0, 0x0F, 0xF7, 0xFC, 0x0F, 0xF0, 0x7F, 0x8F, 0xF0, 0x07, 0xF0, 0xA0, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD,
-    0x05, 0x00, 0x05, 0x03, 0xFD, 0x0B, 0xF8, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xFC, 0x2F, 0xD0,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x7F, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x00,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x0A, 0xBF,
-    0xFE, 0xA8, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE5, 0x6F, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0xFF,
-    0xE0, 0x0B, 0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0xBF,
-    0x80, 0x00, 0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0x4B, 0xF8, 0x00, 0x0F,
-    0xF0, 0x0F, 0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00,
-    0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4,
-    0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F,
-    0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4,
-    0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x03, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x8B, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xD7, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40,
-    0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x02, 0xF8, 0x00, 0xFD, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x1F, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xEF, 0xF4, 0x0B, 0xFC, 0x2F, 0xF4, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x7C, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0xB8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF9, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xBE, 0xBF, 0xF4, 0x1F, 0xFC, 0x00, 0x2F, 0x87,
-    0xFF, 0x41, 0xFF, 0xC0, 0x0B, 0xE0, 0x7F, 0xF4, 0x2F, 0xFC, 0x02, 0xF8, 0x03, 0xFF, 0x42, 0xFF,
-    0xC0, 0xBE, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x2F, 0x80, 0x07, 0xFF, 0x01, 0xFF, 0xDB, 0xE0, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xF9, 0x02,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0x03,
-    0xE0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80,
-    0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x45, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x3F, 0xFC, 0x03,
-    0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x03, 0xFF, 0x46,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x95, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xE6, 0xFF, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x2F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0xBF, 0xF8, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xF4, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x03, 0xFF,
-    0x01, 0x00, 0xFF, 0xC0, 0xFF, 0xC3, 0xC0, 0x3F, 0xF0, 0x3F, 0xF2, 0xF4, 0x0F, 0xF4, 0x2F, 0xFC,
-    0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB,
-    0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF,
-    0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F,
-    0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8,
-    0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF,
-    0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0xBD, 0x03, 0x40, 0x00, 0x3F, 0xF8, 0x7D, 0x00,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7D, 0x7F, 0xFC, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F,
-    0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF,
-    0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x0B, 0xF4, 0x2F, 0xD0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B,
-    0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7,
-    0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x1F,
-    0x40, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0,
-    0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x6A, 0x40, 0x00, 0x1B, 0xFF, 0xF4, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xEB, 0xFF, 0xFA, 0xBF, 0xF4, 0x3F, 0xF0, 0x2F, 0xFD, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xAA,
-    0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFA, 0x94, 0x0F,
-    0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0xE5, 0x5B, 0x87,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x41,
-    0xFF, 0xFF, 0xD0, 0x00, 0x55, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0, 0x2F,
-    0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xA4, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x7F, 0x1F, 0xD0, 0x00, 0xFC, 0x07, 0xF0,
-    0x02, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0,
-    0x07, 0xFD, 0x1F, 0xF4, 0x07, 0xFD, 0x2F, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07,
-    0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x1A, 0x00, 0x00,
-    0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x07, 0xFB, 0xF0, 0x0F, 0xD3, 0xFC, 0x2F, 0x80, 0xFD, 0x3F, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x41, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0x42, 0xFD, 0x04, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x7F, 0xE0, 0x00, 0x02, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x55, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x80, 0x7F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xD7, 0xFF,
-    0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF,
-    0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF4,
-    0x01, 0xFF, 0x83, 0xFF, 0xD0, 0x3F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x06, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0xBF, 0xF8, 0x00, 0x00,
-    0x0B, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00,
-    0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD,
-    0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00,
-    0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7,
-    0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF,
-    0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF,
-    0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0xA8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80, 0x3F, 0xFC, 0x3F, 0xF0, 0x01,
-    0xFF, 0xD7, 0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF,
-    0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x2F, 0x40, 0xD0,
-    0x00, 0x0F, 0xFE, 0x1F, 0x40, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x5F, 0xFF, 0x00, 0x00, 0xF0,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB,
-    0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00,
-    0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F,
-    0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x02, 0xFD, 0x0B, 0xF4, 0x00, 0x01, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8, 0x03, 0xFF,
-    0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE, 0xBF, 0xE0,
-    0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD,
-    0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xAA, 0x90,
-    0x10, 0x00, 0x1F, 0xFF, 0xFD, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x9B, 0xFF, 0xF0,
-    0x07, 0xFD, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xF4, 0x1F, 0xF8, 0x02, 0xFF, 0xF8, 0x2F,
-    0xF4, 0x0B, 0xFF, 0xF8, 0x2F, 0xF4, 0x2F, 0x9F, 0xFC, 0x3F, 0xF4, 0xBE, 0x1F, 0xF8, 0x3F, 0xF6,
-    0xF8, 0x1F, 0xF8, 0x2F, 0xFF, 0xE0, 0x2F, 0xF4, 0x2F, 0xFF, 0x80, 0x2F, 0xF0, 0x1F, 0xFE, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xEB, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2E, 0x2F, 0xFF, 0xE0, 0x00, 0x04, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03,
-    0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1B, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x01, 0xBF, 0xF8, 0x0B, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x02,
-    0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x3F, 0xFD, 0x5B, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x4B, 0xFF, 0xD0,
-    0x00, 0x15, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xE1, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00,
-    0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9, 0x00, 0x03, 0xFF, 0x7F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF,
-    0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x40, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03,
-    0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFB,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF,
-    0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3D, 0x00,
-    0x1D, 0x00, 0x0B, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F,
-    0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00,
-    0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0,
-    0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x50, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC,
-    0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x2F, 0xFE,
-    0xFF, 0xE1, 0xFF, 0x80, 0xFF, 0xCF, 0xFC, 0x02, 0xFE, 0x7F, 0xE0, 0x07, 0xF2, 0xFF, 0x40, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x95, 0xBC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x80, 0x00, 0x07,
-    0xF8, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x00, 0x06, 0x40, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC,
-    0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x01, 0xB0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xBF,
-    0x1F, 0xC0, 0x07, 0xF0, 0x2F, 0x80, 0x2F, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xBF, 0xF8,
-    0x7F, 0xE0, 0x3F, 0xF3, 0xFF, 0x00, 0xBF, 0x9F, 0xF8, 0x01, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE5, 0x6F, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC,
-    0x00, 0x03, 0xF8, 0x2F, 0xF8, 0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x19, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x01,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xF9, 0x5B, 0xC7, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xE0,
-    0x7F, 0x40, 0x00, 0x0B, 0xF9, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xE4, 0x1B, 0xFC, 0x0B, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xF8, 0x2F, 0xF8,
-    0x00, 0x02, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x19, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0x80,
-    0x3F, 0x00, 0xFD, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x90, 0x00, 0x1F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x2F, 0xFE, 0xFF, 0xE1, 0xFF, 0x80, 0xFF,
-    0xCF, 0xFC, 0x02, 0xFE, 0x7F, 0xE0, 0x07, 0xF2, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0x95, 0xBC, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x95,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x41,
-    0x50, 0x00, 0x00, 0x7F, 0xFE, 0x0B, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0x80, 0x00, 0x1F, 0xFF,
-    0xE0, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0x80, 0x00, 0x00,
-    0x2F, 0xF8, 0x3D, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xF0, 0x00, 0x06, 0xAA, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x2F, 0xF8,
-    0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xE5, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xD2, 0xFF, 0xF4,
-    0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0xAB, 0xFF, 0xEA, 0x80,
-    0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x0A, 0xBF, 0xFE, 0xA8, 0x01, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xE5, 0x6F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xAB,
-    0xFF, 0xE9, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xAB, 0xFF, 0xE9, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x1A, 0xFB, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xAB, 0xFF, 0x80, 0x3F, 0xF8, 0x02, 0xFF, 0x80, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0xBF,
-    0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0xFF, 0xE0,
-    0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0xBF, 0xF0, 0x02, 0xFF, 0x80, 0x7F, 0xF4, 0x02,
-    0xFF, 0x80, 0x3F, 0xFE, 0x5F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE4, 0x0F, 0xFF, 0xFE, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x2A, 0xAA, 0xA4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95,
-    0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95,
-    0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x01, 0xAA, 0xAA, 0xA0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0x55, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x00,
-    0xFE, 0x00, 0x7C, 0x00, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8,
-    0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02,
-    0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x40, 0x00, 0x10, 0x02, 0xF0, 0x00, 0xB0, 0x03, 0xFC, 0x03,
-    0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03,
-    0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55,
-    0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41,
-    0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95,
-    0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95,
-    0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF,
-    0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB,
-    0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x05, 0x6F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x28, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0xDF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB,
-    0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x2F, 0x80,
-    0x00, 0xFF, 0xBF, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x02, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x0F, 0xF0,
-    0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F,
-    0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07,
-    0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01,
-    0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00,
-    0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07,
-    0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4,
-    0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF,
-    0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0xA9, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFD,
-    0x00, 0x01, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xCB, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x0B, 0xFC, 0x07, 0xFF,
-    0xE0, 0x00, 0x2F, 0xF0, 0x0B, 0xFF, 0xFE, 0x5A, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x05, 0xA8, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFE, 0x6C, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xFE,
-    0x02, 0xFF, 0x40, 0x03, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFC, 0x54, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFA, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x7F,
-    0xF0, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0xAB, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x6A,
-    0x40, 0x00, 0x03, 0xFF, 0x1F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF9, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0xFF, 0xE5, 0x55, 0x57, 0xFF, 0x94, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xE5, 0x55, 0x57, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x40,
-    0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x06, 0xBF, 0xFA, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xBF, 0xFA, 0xA0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2B, 0xE0, 0x00, 0x03, 0xFF, 0x2F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x07,
-    0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xF9, 0x02, 0xFF, 0xE4, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x38, 0x3F, 0xFC, 0x7D, 0xBF, 0xFF, 0xFD,
-    0xBD, 0x7F, 0xFC, 0x3C, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFD, 0x0B, 0xD0, 0x24, 0x3F, 0xF8, 0x3D, 0x7F, 0xFF, 0xFD, 0x7E, 0x7F, 0xFC,
-    0x3C, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xA9, 0x7F,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0xBF, 0x00, 0x7D, 0x7F, 0xFB, 0xFC,
-    0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFD, 0x04, 0x00, 0x04, 0x3D, 0x00, 0x1D, 0x7F, 0x80, 0x7D, 0x3F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F,
-    0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00,
-    0x2F, 0xD0, 0x00, 0x2F, 0xFA, 0x80, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-    0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xE5, 0x00, 0x3F, 0xFF, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x40, 0x3F,
-    0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x54, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xBF, 0xF0, 0x0F, 0xFF,
-    0x00, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x2A, 0x40, 0x00, 0x6A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x55, 0x0B, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xC7, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0xBF, 0xFE, 0x02, 0xFF, 0xFC, 0x01, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xFF, 0x90, 0x0F, 0xFC, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0x0F, 0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0xFE, 0x0B, 0xF4, 0x0F, 0xE0, 0x07, 0xE0, 0x19, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0xB9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x7F, 0x0F, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x1F, 0x40, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x60, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xFF, 0x40, 0x3F, 0xF0, 0x3F,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC1, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFF,
-    0x00, 0x1F, 0xFE, 0x40, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0x4F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0x82, 0xFF, 0xFF,
-    0x02, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x2F, 0xF0,
-    0x00, 0x01, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0xBF,
-    0xF0, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-    0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0x83, 0xFF, 0xFF,
-    0x80, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC,
-    0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xC0, 0x07,
-    0xFF, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0xD0, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0,
-    0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD,
-    0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFD, 0x0B, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xC0, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xFF, 0xFD, 0x0F, 0xC0, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xC0, 0xBF, 0xFF, 0xF4, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x1F, 0x00, 0x03, 0xFF, 0x40, 0x1D, 0x00,
-    0x03, 0xFF, 0x40, 0x04, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x15, 0x01, 0x40, 0xBF, 0xFD,
-    0x0F, 0xCB, 0xFF, 0xF4, 0x3F, 0x6F, 0xFF, 0xD0, 0xFC, 0x03, 0xFF, 0x43, 0xF0, 0x0F, 0xFD, 0x1F,
-    0x40, 0x3F, 0xF4, 0x7C, 0x00, 0xFF, 0xD1, 0xE0, 0x03, 0xFF, 0x41, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x06, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF,
-    0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x03, 0xFF, 0x40, 0x00,
-    0xFC, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x03, 0xFF, 0x40, 0x03, 0xFC, 0x03, 0xFF, 0x95, 0x6B, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x15, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xF4, 0x02, 0xA0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F, 0xFD, 0x03, 0xFF,
-    0x40, 0xFF, 0xC0, 0x3F, 0xF4, 0x0B, 0xF8, 0x03, 0xFF, 0x40, 0x04, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x41, 0xD0, 0x00,
-    0x00, 0x3F, 0xF9, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x2E, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xB4, 0x00, 0x3F, 0xF4, 0x00,
-    0x0F, 0xC0, 0x03, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0x95,
-    0x6B, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF6, 0xC0, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xFD, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0x3F, 0xF4, 0x00, 0x0F, 0xFD,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0xBF, 0x80, 0x00,
-    0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF, 0x4B, 0xF8, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x01,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xD2, 0xFF,
-    0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xBF, 0xF8, 0x02, 0xFE, 0x00, 0x03, 0xFC,
-    0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xE0,
-    0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF, 0xD2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xCB, 0xF8, 0x00,
-    0x0F, 0xF0, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF,
-    0xF1, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF4, 0x7F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00,
-    0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x02, 0xFE,
-    0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x0B, 0xF8, 0x00, 0x0F, 0xF3, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x3F,
-    0xC3, 0xFF, 0xC0, 0xBF, 0x80, 0x00, 0xFF, 0x0B, 0xFF, 0x82, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xFF,
-    0x4B, 0xF8, 0x00, 0x0F, 0xF0, 0x0F, 0xFF, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xBF, 0x80,
-    0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x01, 0xAA, 0x00, 0x02, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0xBF,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x7F, 0xFD, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x69, 0x01, 0xA9, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0xE2,
-    0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF4, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x04, 0x00, 0x03, 0xFF, 0xE4, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0xBF, 0xF4, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x0F,
-    0xF0, 0xFF, 0xE0, 0x2F, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xD0, 0xBF, 0x80, 0x00, 0xFF, 0x03, 0xFF,
-    0xC2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x8B, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0x6F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x6A, 0x01, 0xAA, 0x00, 0x2F, 0xFF, 0x1F, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x7F, 0xFC, 0x01,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80,
-    0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x07, 0xFF, 0xD0, 0x0B, 0xFD, 0x2F, 0xFF, 0xF4, 0x0B, 0xFD, 0x3F, 0xFF, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F,
-    0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x0F, 0x40,
-    0x07, 0x40, 0x02, 0xFE, 0x01, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F,
-    0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0x80,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x1F,
-    0xD0, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x02,
-    0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8,
-    0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE,
-    0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00,
-    0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x41, 0xFF, 0xE5, 0xAB,
-    0xFC, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x03, 0xF0, 0x3F, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x0F,
-    0xC1, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x28, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x54, 0x07,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0xBF, 0xF4, 0x00, 0x0F, 0xFD, 0x00, 0x07, 0xF0, 0xFF, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xC1, 0xFF, 0xFD, 0x00, 0xFF, 0xE5, 0x56, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0xAF, 0xFC, 0x1F, 0xF8, 0x03, 0xFF, 0xF0, 0x0B, 0xFE, 0x3F,
-    0xF0, 0x01, 0xFF, 0xE0, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xBF, 0xE0, 0x00,
-    0xFF, 0xE5, 0x57, 0xFF, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xD5, 0x55, 0x54, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFD,
-    0x03, 0xFF, 0xFE, 0x51, 0x6D, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xE0, 0x00, 0x05, 0x50, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-    0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F,
-    0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-    0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x59, 0x01,
-    0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x78, 0x00, 0x00, 0x0B,
-    0xD0, 0x0B, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF,
-    0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0x41, 0xFF, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD7,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xFF, 0x00,
-    0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0x4B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xF0, 0x02,
-    0xF8, 0x0B, 0xF0, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x01, 0xA0, 0x2F, 0xFE, 0x0F, 0xFC, 0x7F, 0xFF, 0x3F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xE0, 0x10, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD,
-    0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07,
-    0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0,
-    0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x5A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x7F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xD0, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0x0F, 0xF8, 0x00, 0xF8,
-    0x3F, 0xFD, 0x01, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC2, 0xE0, 0x07, 0xFF, 0x5F, 0xC0, 0x07, 0xFD, 0x7F, 0x40,
-    0x1F, 0xF1, 0xFF, 0xD6, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x7F, 0xC0, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B,
-    0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7,
-    0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0x00, 0x06,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xBF, 0x80, 0x01, 0xFC, 0x7F,
-    0x40, 0x0F, 0xC0, 0x7F, 0x00, 0xBD, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0x1F, 0xF0, 0xBF,
-    0x80, 0x1F, 0xC3, 0xFE, 0x00, 0x3E, 0x0F, 0xFF, 0x40, 0x50, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0xB8, 0x01, 0xFF,
-    0xD7, 0xF0, 0x01, 0xFF, 0x5F, 0xD0, 0x07, 0xFC, 0x7F, 0xF5, 0xBF, 0xE0, 0xFF, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00, 0xFF, 0x0B, 0xFD, 0x00, 0x2F,
-    0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x1A, 0x00, 0x07, 0xFF, 0x8F,
-    0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x07, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x94,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x07,
-    0xFD, 0x07, 0xFC, 0x2F, 0xE0, 0x07, 0xF0, 0xFF, 0x80, 0x0F, 0x83, 0xFF, 0xD0, 0x14, 0x0B, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFC, 0x2E, 0x00, 0x7F, 0xF5, 0xFC, 0x00, 0x7F, 0xD7, 0xF4, 0x01, 0xFF, 0x1F, 0xFD, 0x6F, 0xF8,
-    0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x01, 0x80, 0x00, 0xB4, 0x00, 0xFC,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x00,
-    0xFF, 0x0B, 0xFD, 0x00, 0x2F, 0xC3, 0xFF, 0x00, 0x0B, 0xF0, 0xFF, 0xD0, 0x01, 0xF4, 0x3F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE,
-    0x1A, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x7F, 0xE7, 0xF4, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x0B,
-    0xFD, 0x7F, 0xF0, 0x07, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xFD,
-    0x03, 0xF4, 0x02, 0xFC, 0x2F, 0x80, 0x03, 0xFE, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40,
-    0x00, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF0, 0x7F, 0xD0, 0x7F, 0xC2, 0xFE, 0x00, 0x7F, 0x0F,
-    0xF8, 0x00, 0xF8, 0x3F, 0xFD, 0x01, 0x40, 0xBF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC2, 0xE0, 0x07, 0xFF, 0x5F, 0xC0, 0x07,
-    0xFD, 0x7F, 0x40, 0x1F, 0xF1, 0xFF, 0xD6, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x55, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07,
-    0xF4, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD,
-    0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0x5A, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x02, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x03,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xE9, 0x7F, 0xF9, 0xAF, 0xF4, 0xFF, 0x00, 0xFF, 0xD0,
-    0x1F, 0xD3, 0xF8, 0x03, 0xFF, 0x40, 0x7F, 0x4F, 0xD0, 0x0F, 0xFD, 0x01, 0xFC, 0x0A, 0x00, 0x3F,
-    0xF4, 0x02, 0x90, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x19, 0x1F, 0x80,
-    0x03, 0xFC, 0x7C, 0x00, 0x2F, 0xF0, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xFD, 0x69, 0x00, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE,
-    0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xAB, 0xFF, 0xAA,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x6F, 0xFD, 0x54, 0x00,
-    0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x3F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x09, 0x00, 0x00, 0x01, 0xFF, 0xD2, 0xF0, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x1E, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80,
-    0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xB0, 0x00,
-    0x00, 0x3F, 0xD0, 0x2F, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF,
-    0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0xBD, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00,
-    0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01,
-    0x54, 0x01, 0x50, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x07, 0xFF, 0xE5, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B, 0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF,
-    0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0x7F,
-    0xFC, 0x00, 0x01, 0x54, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x0A, 0x90, 0x01, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x0B, 0xFC, 0x00,
-    0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F,
-    0xFD, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFF,
-    0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x3F, 0xDF, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xD3, 0xFF, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x07, 0xF0, 0xFF, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFC, 0x1F, 0xF8, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFE, 0x03, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0x00,
-    0xFF, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xC0, 0x1F, 0xFB, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xE0, 0x0F,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0x40, 0x2F, 0xF0, 0x02, 0xFF,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x2F, 0xD0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0xFC, 0x00,
-    0x1F, 0xF8, 0x07, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0xFF, 0xFC, 0x07, 0xF4, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0xD1, 0xF5, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xFE,
-    0x2F, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xF3, 0xF0, 0xFF, 0x6F, 0xC0, 0x00, 0x01, 0xFF, 0x7E,
-    0x0B, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x02, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xE2, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x42, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF,
-    0xC0, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xF0, 0x00, 0x07,
-    0xFF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xF4, 0x00, 0x00,
-    0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF8, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01,
-    0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF,
-    0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x02, 0xFF,
-    0xC0, 0x7D, 0x01, 0xFF, 0xC0, 0x0F, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x02, 0x40, 0x3F,
-    0xF8, 0x02, 0xF0, 0x3F, 0xFC, 0x00, 0xFC, 0x2F, 0xFC, 0x00, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0,
-    0x01, 0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xFF, 0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x2F, 0xFC, 0x07, 0xD0, 0x1F, 0xFC, 0x00, 0xF0, 0x0F,
-    0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x24, 0x03, 0xFF, 0x80, 0x2F, 0x03, 0xFF, 0xC0, 0x0F, 0xC2,
-    0xFF, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x2D, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xDB, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F, 0xC0, 0x03, 0xFF, 0xC0,
-    0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFD, 0x0F, 0xFF, 0x00, 0x02,
-    0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x02, 0xFF, 0xC0, 0x7D, 0x01, 0xFF, 0xC0, 0x0F, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x02, 0x40, 0x3F, 0xF8, 0x02, 0xF0, 0x3F, 0xFC, 0x00, 0xFC,
-    0x2F, 0xFC, 0x00, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xEF, 0xFD, 0x00, 0xFF, 0xC0, 0x7F, 0x00, 0xBF, 0xD0, 0x07, 0x40,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x05, 0xA4, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF0,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x2F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x06,
-    0xA9, 0x4B, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xF8, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFF, 0x47, 0xFF, 0x00, 0x0F, 0xFE, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF8, 0xBF, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0x80, 0x02, 0xFF, 0x8F, 0xFE, 0x00,
-    0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF, 0xD0, 0x07, 0xFF,
-    0x03, 0xFF, 0xD0, 0x3F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0xD3, 0xFF, 0x42, 0xFF, 0xF3, 0xFE, 0x0F, 0xFD, 0x01, 0xFF, 0xEF, 0xF4, 0x3F, 0xF4, 0x02,
-    0xFF, 0x8F, 0xE0, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0F, 0xFD,
-    0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x03,
-    0xFF, 0xAF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xEA, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xE5, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0x00, 0x01, 0xFF, 0x40, 0x08,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xA9, 0x00,
-    0x03, 0xFF, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00,
-    0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F,
-    0xF4, 0x03, 0xFF, 0x40, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x95, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x06, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x6F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x3F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x15, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x10, 0x03, 0xF0, 0x02, 0xF0, 0x2F, 0x80, 0x0F,
-    0xFB, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xF9, 0x5F, 0xFE, 0x6B, 0xFD, 0x7F, 0xC0, 0x3F, 0xF4, 0x07, 0xF5, 0xFF, 0x00, 0xFF, 0xD0, 0x1F,
-    0xD3, 0xFD, 0x03, 0xFF, 0x40, 0x7F, 0x0B, 0xFC, 0x0F, 0xFD, 0x00, 0xA4, 0x01, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xE6, 0xFF, 0x00, 0x7F, 0xD0, 0x2F, 0x40, 0x3F, 0xF0, 0x02, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0x5A, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0x00, 0x15, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD, 0x3F, 0xC0, 0x3F,
-    0xF4, 0x07, 0xF4, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40, 0x7F, 0x02, 0x80,
-    0x0F, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x46, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x7F, 0xD2, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0xBF,
-    0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x04, 0x00, 0xF4,
-    0x0B, 0xF0, 0x2F, 0xF0, 0x3F, 0xF0, 0x2F, 0xE0, 0x1F, 0xC0, 0x0D, 0x00, 0x00, 0x01, 0x00, 0x7D,
-    0x0F, 0xF1, 0xFF, 0x3F, 0xDB, 0xF4, 0xFD, 0x03, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xFF,
-    0x80, 0x02, 0xFF, 0xD0, 0x07, 0xFB, 0xF0, 0x0F, 0xD3, 0xFC, 0x2F, 0x80, 0xFD, 0x3F, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x24, 0x3F, 0xF8, 0x3D, 0x7F, 0xFF, 0xFD, 0x7E, 0x7F, 0xFC, 0x3C,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA9, 0x7F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x15, 0x55,
-    0x54, 0x04, 0x00, 0x04, 0x3D, 0x00, 0x1D, 0x7F, 0x80, 0x7D, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0,
-    0x02, 0xFE, 0x40, 0x1A, 0x47, 0xFD, 0xBF, 0xEB, 0xFE, 0x3F, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0x41, 0xFD, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0x42, 0xFD, 0x04, 0x00, 0x10, 0x06, 0xFD,
-    0x03, 0xFF, 0xFC, 0x7F, 0x5F, 0xD7, 0xD0, 0xBE, 0x2C, 0x0F, 0xD0, 0x02, 0xF8, 0x03, 0xFE, 0x00,
-    0x3F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0xF0, 0x2F, 0xAF, 0xC3, 0xD0,
-    0xBC, 0x7D, 0x07, 0xD7, 0xD0, 0x7C, 0x3F, 0x5F, 0xC1, 0xFF, 0xF0, 0x02, 0xE4, 0x00, 0x04, 0x00,
-    0x40, 0x3E, 0x07, 0xD1, 0xFC, 0x3F, 0xCF, 0xF1, 0xFE, 0x7F, 0x4B, 0xF2, 0xF8, 0x3F, 0x4F, 0xC1,
-    0xF8, 0x2D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xBC, 0xBF, 0x01, 0xFC,
-    0x3F, 0x83, 0xF0, 0x1F, 0xEF, 0xD0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x04,
-    0x00, 0x41, 0xF4, 0x2F, 0x0F, 0xF0, 0xFD, 0x2F, 0xD3, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x0B, 0xE0,
-    0xBD, 0x0F, 0xC0, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFC, 0x7D, 0x02, 0xFD, 0x70, 0x00, 0x7C, 0x10, 0x00, 0x10, 0x00, 0x00, 0x7D, 0x1F, 0xC3, 0xF8,
-    0x7F, 0x0B, 0xF0, 0xFF, 0x0B, 0xF8, 0x7F, 0xC1, 0xA0, 0x0B, 0xE0, 0xBF, 0xD0, 0xFF, 0x81, 0xFE,
-    0x07, 0xF4, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x2E, 0x00, 0x2F, 0x81, 0xFF, 0x8B, 0xFC, 0x2F, 0xD0,
-    0x7F, 0x40, 0xFE, 0x01, 0xFC, 0x02, 0xFC, 0x02, 0xE0, 0x10, 0x0F, 0xC7, 0xF1, 0xFC, 0x7E, 0x2F,
-    0x4B, 0xC2, 0xD0, 0x20, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0xD1, 0xFD, 0x2F, 0xC7, 0xF4, 0xBD, 0x0B,
-    0x00, 0x00, 0x00, 0x05, 0x03, 0xFC, 0xBF, 0xEB, 0xFE, 0x7F, 0xD1, 0xA4, 0x3F, 0x40, 0xFD, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0x82, 0xFE, 0x15, 0x00, 0x54, 0x01, 0x40, 0x1F, 0xF8, 0x7E,
-    0xBD, 0xB8, 0x3E, 0xF8, 0x2E, 0xBD, 0x7D, 0x3F, 0xF8, 0x06, 0x90, 0x01, 0x40, 0x3F, 0xC0, 0xFF,
-    0x42, 0xFE, 0x07, 0xF4, 0x3F, 0xC2, 0xFC, 0x06, 0x40, 0x05, 0x40, 0x2F, 0xF4, 0x2F, 0xFC, 0x02,
-    0xFC, 0x02, 0xFC, 0x07, 0xF0, 0x2F, 0xD0, 0x1A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x7F,
-    0x00, 0xBF, 0x00, 0xBF, 0xD5, 0x3F, 0xFE, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x2A, 0x00, 0x00, 0x6E, 0x00, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0xF0,
-    0x0F, 0xFB, 0xFC, 0x2F, 0xC1, 0xFE, 0x7F, 0x00, 0x7E, 0x28, 0x00, 0x18, 0x04, 0x00, 0x04, 0x3D,
-    0x00, 0x1D, 0x7F, 0x80, 0x7D, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x38, 0x3F, 0xFC, 0x7D, 0x7F, 0xFF, 0xFD, 0x7D, 0x3F, 0xFC, 0x2C, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x7F, 0xFF, 0xFE, 0xBF, 0xFF, 0xFD, 0x2A, 0xAA, 0xA8, 0x01,
-    0xBF, 0x80, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7D, 0x02, 0xFD, 0x70, 0x00, 0x7C, 0x10, 0x00,
-    0x10, 0x00, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x28, 0x00, 0x04, 0x00, 0x10, 0x7F, 0x82, 0xFE, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xFD, 0x03, 0xF4,
-    0x0F, 0xF5, 0x2F, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
-    0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F,
-    0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xA5, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xAB, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x41, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x0F, 0xFD, 0x00, 0x2F, 0xC0, 0x3F, 0xF4,
-    0x00, 0xBF, 0x00, 0xFF, 0xD0, 0x01, 0xF4, 0x03, 0xFF, 0x40, 0x01, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0xC0,
-    0x00, 0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x07, 0xFF,
-    0x00, 0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x1F,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xD0, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01,
-    0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40,
-    0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xF9, 0x55, 0xFF, 0xF0, 0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x1F,
-    0xC0, 0x03, 0xFF, 0xC0, 0x0F, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x64, 0x03, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFD,
-    0x0F, 0xFF, 0x00, 0x02, 0xFC, 0x3F, 0xFD, 0x55, 0x5B, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE2, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFC,
-    0x00, 0x00, 0xBF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x15, 0x50, 0x0F, 0xFD, 0x7F, 0xF0, 0xBF, 0xFE,
-    0x0F, 0xFD, 0xBF, 0xF0, 0xFF, 0xFE, 0x0F, 0xFD, 0xBF, 0xF0, 0xFF, 0xFD, 0x0F, 0xFD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xF8,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00,
-    0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x43, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xBF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x6F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x4F, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xFC,
-    0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFA, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0xCB, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xE0, 0x00, 0x03, 0xF7, 0xFE, 0x00, 0xFD, 0xFF,
-    0xC0, 0x00, 0x0F, 0xDB, 0xFC, 0x03, 0xF3, 0xFF, 0x00, 0x00, 0x7F, 0x5F, 0xF0, 0x2F, 0xCF, 0xFC,
-    0x00, 0x01, 0xFC, 0x3F, 0xD0, 0xFE, 0x2F, 0xF0, 0x00, 0x0B, 0xF0, 0xFF, 0xC3, 0xF0, 0xBF, 0xC0,
-    0x00, 0x2F, 0xC1, 0xFF, 0x1F, 0xC2, 0xFF, 0x40, 0x00, 0xFF, 0x03, 0xFD, 0xBE, 0x07, 0xFD, 0x00,
-    0x03, 0xFC, 0x0F, 0xFB, 0xF0, 0x1F, 0xF4, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x3F, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x07,
-    0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0x40, 0x0B, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xA0, 0x1F, 0xC0, 0x1F, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xBF, 0xF8, 0x02, 0xFE, 0x00, 0x03, 0xFC, 0xFF, 0xF4, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x3F, 0xC2, 0xFF, 0xE0, 0xBF, 0x80, 0x00,
-    0xFF, 0x03, 0xFF, 0xD2, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xCB, 0xF8, 0x00, 0x0F, 0xF0, 0x07,
-    0xFF, 0xEF, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xEA, 0xAA, 0xAB, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00,
-    0x00, 0x03, 0xF4, 0x0A, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55,
-    0x50, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0xA0,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0xBF,
-    0x95, 0x55, 0x56, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0x55,
-    0x57, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0x8B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x42, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x02, 0xFF,
-    0xC0, 0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x3F,
-    0xF4, 0x03, 0xFF, 0x40, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFA, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0x80, 0x01, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x7C, 0x01, 0xFF, 0x80, 0x00, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0xFD, 0x1F, 0xF8, 0x00, 0x02, 0xFD,
-    0x7F, 0xFA, 0xAA, 0xAF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFA, 0x5F, 0xFE, 0x6B, 0xFD,
-    0x3F, 0xC0, 0x3F, 0xF4, 0x07, 0xF4, 0xFE, 0x00, 0xFF, 0xD0, 0x1F, 0xD3, 0xF4, 0x03, 0xFF, 0x40,
-    0x7F, 0x02, 0x80, 0x0F, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x01, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xC7, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xAF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x16, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x2F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xAF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFE, 0x7F, 0xF6, 0xFF, 0xF0, 0x2F, 0xF8, 0x0F, 0xF8, 0x1F, 0xFE,
-    0x0F, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0xCB, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xF7, 0xFF, 0x40, 0x3F,
-    0xE0, 0x0B, 0xFD, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x6F, 0xF4, 0x03, 0xFE, 0x00, 0xBF, 0xDB,
-    0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0xFF, 0xD0, 0x3F, 0xE0, 0x2F, 0xF8, 0x2F, 0xFE, 0x0F, 0xF8,
-    0x2F, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x1B, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xAA, 0xAA, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x7F,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0xBF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFB,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xE4, 0x06, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0x81, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7F, 0xD0, 0x3F, 0xFF,
-    0xFE, 0x03, 0xFE, 0x3F, 0xF0, 0x7F, 0xFF, 0xFE, 0x0B, 0xFC, 0x2F, 0xF4, 0x2F, 0xFF, 0xF4, 0x0F,
-    0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x1F, 0xF4, 0x0F,
-    0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0x80,
-    0x3F, 0xE0, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xD0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0xFF, 0xC0,
-    0x01, 0xFF, 0xD0, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x01,
-    0xF0, 0xFF, 0x80, 0x01, 0xFF, 0x0B, 0x8F, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x2F, 0x3F, 0x40, 0xFF,
-    0x40, 0xFF, 0x00, 0xFC, 0xFE, 0x55, 0xFE, 0x07, 0xF5, 0x5B, 0xF7, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x1A, 0x90, 0x05, 0xA4, 0x00, 0x3F, 0xFF, 0x07, 0xFD, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0x00, 0x3F,
-    0xFE, 0xFE, 0xFF, 0xC0, 0x2F, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x07, 0xFE,
-    0x00, 0x1F, 0xFD, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xE0,
-    0x03, 0xFF, 0xC0, 0x1F, 0xFC, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xC2, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0x80, 0xBF, 0xFC, 0x07, 0xFF, 0x80, 0x01, 0x54,
-    0x00, 0x15, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xEB, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xD0, 0x03, 0xFF, 0x01,
-    0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0xBF, 0xC0,
-    0x07, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x2F, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0xF4,
-    0x00, 0xBF, 0xC3, 0xFF, 0xFC, 0x02, 0xFF, 0x06, 0xBF, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xF4, 0x2F,
-    0xF0, 0x00, 0x7F, 0xF0, 0xBF, 0xC0, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x03, 0xFF, 0x0B, 0xFC, 0x00,
-    0x0F, 0xFC, 0x2F, 0xF0, 0x00, 0x7F, 0xF0, 0xBF, 0xC0, 0x03, 0xFF, 0x42, 0xFF, 0x00, 0x7F, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0x05, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x06, 0x90, 0x2F, 0xFF, 0x00, 0x0F, 0xF8, 0x7F,
-    0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0xF4,
-    0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0xBF,
-    0x80, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFA, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x40, 0xBF, 0xC0,
-    0x00, 0x20, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFD, 0x3F,
-    0xFF, 0x01, 0xFF, 0x80, 0xBF, 0xF8, 0x3F, 0xF0, 0x03, 0xFF, 0xC7, 0xFF, 0x00, 0x1F, 0xFD, 0xBF,
-    0xE0, 0x00, 0xFF, 0xDF, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0xE0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xF8, 0x3F, 0xFD, 0x07, 0xFF, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x16, 0xA9, 0x40, 0x07, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xAB, 0xFC,
-    0x3F, 0xF0, 0x00, 0xD0, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x69, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xEA, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x1B, 0xFF, 0x40, 0x5F, 0x9F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFE, 0x00, 0x01, 0x55, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x43, 0xF4, 0x01, 0xBF, 0x5F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x41,
-    0xA9, 0x4F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xD4, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x01,
-    0xAF, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x6A, 0x00, 0x2F, 0xFF,
-    0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0x6F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF8,
-    0x1F, 0xFD, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE,
-    0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00,
-    0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x06, 0xF9, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFA, 0xFF, 0xE0, 0x0F, 0xF8, 0x07,
-    0xFF, 0x02, 0xFF, 0x00, 0x2F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x0F, 0xFD, 0x7F,
-    0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x55, 0x5B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xBF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x07, 0xFE, 0x7F, 0xE0, 0x00, 0x7F,
-    0xD7, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x80, 0x1F, 0xF4, 0x0F, 0xFE,
-    0x07, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x05, 0xA0, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFE, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0xFE, 0x7F, 0xFF, 0xD2,
-    0xFF, 0xF4, 0x01, 0x50, 0x00, 0x05, 0xA0, 0x00, 0x69, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0xBF, 0xE0,
-    0x0F, 0xFF, 0x4B, 0xFD, 0x03, 0xFF, 0xF8, 0xBF, 0xD0, 0xFF, 0xF4, 0x0B, 0xFD, 0x2F, 0xF4, 0x00,
-    0xBF, 0xD7, 0xF8, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF6, 0xFE, 0x00, 0x0B, 0xFE, 0x1F, 0xF0, 0x00, 0xBF, 0xD0, 0xFF, 0x40, 0x0B,
-    0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x7F, 0xF5, 0x4B, 0xFD, 0x03, 0xFF, 0xFE, 0xBF, 0xD0, 0x1F,
-    0xFF, 0xDB, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xAF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xD7, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC3, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x2F,
-    0xFC, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0x80, 0x01, 0xFF, 0xE0, 0x01, 0x50, 0x00, 0x01, 0x50, 0x00,
-    0x01, 0x68, 0x00, 0x05, 0x80, 0x01, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x1F,
-    0xFC, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x2F, 0xFE, 0x0B,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xE0, 0x7F, 0xF0, 0x3F, 0xE1, 0x50, 0x00, 0x54, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x06, 0x90, 0x2F, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x3F,
-    0xE0, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xBC, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC1, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFE, 0x54, 0x00, 0xBF, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00,
-    0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB,
-    0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xAF, 0xFA, 0xAF, 0xFA,
-    0x41, 0xF8, 0x2F, 0xC0, 0x7F, 0x40, 0x03, 0xC0, 0xFF, 0x01, 0xFD, 0x00, 0x01, 0x03, 0xFC, 0x0B,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x01, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x0B, 0xFF, 0xF8,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xFF, 0xF8, 0x0F, 0xFE, 0x02, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFD, 0x2F, 0xF8, 0x00,
-    0xFF, 0xE2, 0xFF, 0x40, 0x0B, 0xFE, 0x2F, 0xF4, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x0B, 0xFE, 0x2F,
-    0xF4, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x0F, 0xFD, 0x2F, 0xF4, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x2F,
-    0xF8, 0x2F, 0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x54, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0x42, 0xFF, 0xEF, 0xFE, 0x1F, 0xF8, 0x0F, 0xFC, 0xFF, 0xC0, 0x2F, 0xE7, 0xFE, 0x00,
-    0x7F, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xF8, 0x06, 0xFF, 0xFF, 0xF0, 0x00, 0x5B, 0xFF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x07, 0xFE, 0xA0, 0x3F, 0xF4,
-    0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00,
-    0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0xFF,
-    0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xFD, 0x0B, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x91, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xAB, 0xFF, 0xAA, 0x47, 0xE0, 0x3F, 0xD0, 0x00, 0x3C,
-    0x03, 0xFD, 0x00, 0x00, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x55, 0x80, 0x1A, 0x40, 0x2F,
-    0xFF, 0xC0, 0x2F, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x02, 0xFF, 0x80,
-    0x0F, 0xFE, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0x0F,
-    0xFE, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xD0, 0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xD0,
-    0x3F, 0xE0, 0x3F, 0xF8, 0x7F, 0xE0, 0x0F, 0xF8, 0x07, 0xFF, 0x2F, 0xF4, 0x03, 0xFE, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xF3, 0xFF, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0xFF, 0xD0, 0x0F,
-    0xF8, 0x03, 0xFF, 0x2F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xE0,
-    0xFF, 0xE0, 0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0xFF, 0x4F, 0xF8, 0xBF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x06, 0x90, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0xFC, 0x03, 0xFF,
-    0x80, 0xBF, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0,
-    0x00, 0x03, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0x7F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x0B, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0xF0, 0xBF, 0xF0, 0x00, 0xFF, 0xFD, 0x3F,
-    0xF8, 0x00, 0x2F, 0xFE, 0x01, 0xA4, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x0B, 0xFC, 0x06, 0x90, 0x0B, 0xFF, 0xE0, 0x2F, 0xF0, 0x3F, 0xE0,
-    0x3F, 0xFF, 0x80, 0xBF, 0xC0, 0xBF, 0xC0, 0xFF, 0xFE, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0xF4,
-    0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xC0,
-    0x3F, 0xF0, 0x0B, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x0B, 0xFC, 0x03, 0xFF, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF0, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x02,
-    0xFF, 0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x0B, 0xFC, 0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x2F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x7F, 0xFD, 0xBF, 0xCB, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x68, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x0F, 0xE0, 0x0F, 0xFC, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0,
-    0x0B, 0xFD, 0xBF, 0xD0, 0x1F, 0xF0, 0x07, 0xFD, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFD, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x07, 0xFD, 0xBF, 0xD0, 0x0F, 0xF0, 0x07, 0xFD, 0xBF, 0xD0, 0x1F, 0xF0, 0x0B, 0xFC,
-    0x7F, 0xE0, 0x2F, 0xF4, 0x0F, 0xFC, 0x3F, 0xF4, 0x3F, 0xFC, 0x1F, 0xF4, 0x2F, 0xFE, 0xFE, 0xFF,
-    0xBF, 0xF0, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x15,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06,
-    0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD,
-    0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF,
-    0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC2,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01,
-    0xFD, 0x7F, 0x40, 0x00, 0x1F, 0x43, 0xF4, 0x00, 0x00, 0xB0, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0,
-    0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00,
-    0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x16, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0xAE, 0x0A, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE,
-    0xBF, 0x80, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF8, 0x00,
-    0x68, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0xBF,
-    0xD0, 0x0F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x16, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA,
-    0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAE,
-    0x03, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00,
-    0x3F, 0xC2, 0xFD, 0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8,
-    0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF,
-    0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x16, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA,
-    0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xF8, 0x7E, 0x00, 0x00, 0x0B,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xAE, 0x0F, 0x80, 0x00,
-    0x2F, 0xF8, 0x64, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xBF, 0x80, 0x00, 0x3F, 0xC2, 0xFD,
-    0x00, 0x0B, 0xF0, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xBF, 0xF4,
-    0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFE, 0x02,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40,
-    0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x2E, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x64, 0x01, 0x00, 0x00, 0x2F, 0xF0, 0x3C,
-    0x00, 0x07, 0xFF, 0xDB, 0xC0, 0x00, 0x7E, 0xBF, 0xFC, 0x00, 0x03, 0xC1, 0xFF, 0x40, 0x00, 0x04,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F,
-    0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00,
-    0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07,
-    0xFB, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x03, 0xF0, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80,
-    0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF,
-    0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07,
-    0xFE, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x3E, 0x09, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE5,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0x40, 0x40, 0x00, 0x3C, 0x00, 0x0D, 0x00, 0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x7F, 0xFB, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF,
-    0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF,
-    0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x09, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x12, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x00, 0x3C, 0x00, 0x0D, 0x00,
-    0x0B, 0xF0, 0x07, 0xD0, 0x00, 0x7F, 0xFB, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F,
-    0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF,
-    0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xC2, 0xD0, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0,
-    0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF,
-    0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x14, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC1, 0x00, 0xD0, 0x00, 0xBE, 0x00,
-    0x3D, 0x00, 0x07, 0xFE, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0xBF, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x3F,
-    0xD0, 0x0F, 0xF8, 0x00, 0x68, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xAF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE,
-    0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0x7F, 0xFD, 0x0F, 0xFF, 0x83, 0xFF, 0x40, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xEB, 0xD0,
-    0x00, 0x00, 0x00, 0x3D, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x95, 0xBD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xAA, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x38, 0x00, 0x03, 0xFF, 0x87, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFD, 0x00, 0x07, 0xC2, 0xFF, 0xC0, 0x00, 0x2C, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x0B, 0xE0, 0x03, 0xE0, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xEB, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80,
-    0xBF, 0xE0, 0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8,
-    0x3F, 0xF4, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xFA, 0xAB, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xAA, 0xAF, 0xFD, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x3D, 0x00, 0x1D, 0x00, 0x0B, 0xF8, 0x07, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xEB, 0xFF,
-    0x40, 0x3F, 0xE0, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x06, 0x80, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x1A, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0xE0, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xE0,
-    0x2F, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF7, 0xFF, 0xD0, 0xFF, 0xF8, 0x3F, 0xF4,
-    0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40,
-    0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF,
-    0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F,
-    0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x47, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95,
-    0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00,
-    0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95,
-    0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFE, 0x7F, 0xC0, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x68, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x34, 0x00, 0x00, 0x7F, 0xF8, 0xBC, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x7F,
-    0xFC, 0x00, 0x00, 0x78, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03,
-    0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC,
-    0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x01, 0x80, 0x01, 0xFF, 0xC3,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xF2, 0xFF, 0xE0, 0x02, 0xD0, 0xBF, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x59, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0x47, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEB,
-    0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC,
-    0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x6F, 0x07, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x03, 0xF4, 0x03, 0xD0, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFE, 0xBF, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xD0,
-    0x03, 0xFE, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xE5, 0x57, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x55, 0x55, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x16, 0xD0, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x59, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0x42, 0xC0,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00,
-    0x3D, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40,
-    0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF,
-    0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x06, 0xF0, 0x1C, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0x7F, 0xC0, 0x01, 0xFD, 0x0F, 0xF0, 0x03, 0xF4, 0x03, 0xD0,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x59,
-    0x0B, 0xE0, 0x00, 0x01, 0xFF, 0x4B, 0x80, 0x00, 0x03, 0xFF, 0xE1, 0x00, 0x00, 0x0F, 0xEB, 0xF4,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03, 0xFF,
-    0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03,
-    0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x03, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xBC, 0x1F, 0x00, 0x00, 0x0F, 0xFD, 0x28, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0x43, 0xFC, 0x00, 0x03, 0xF4, 0x03, 0xD0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xEB, 0xFF, 0xC0, 0x07, 0xFC, 0x02,
-    0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x55, 0x7F, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0x55, 0x55, 0x50, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x05,
-    0xB4, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x3C, 0x00, 0x00,
-    0xBF, 0xFD, 0xFD, 0x00, 0x00, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x28, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xEB,
-    0xF8, 0x00, 0x00, 0x7F, 0x81, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x40, 0x01, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC,
-    0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x18, 0x01, 0x00, 0x00, 0xFF, 0x42, 0xD0, 0x03, 0xFF, 0xE7, 0xE0,
-    0x03, 0xF7, 0xFF, 0xD0, 0x02, 0xD0, 0xBF, 0xC0, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0xBF, 0xD0, 0x01, 0xFE, 0x0F, 0xF0,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD,
-    0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF, 0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0x3F, 0x81, 0xFD,
-    0x00, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x24, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xAB, 0xFC, 0x03, 0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF,
-    0x40, 0x01, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xF0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x15, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xFC, 0x03,
-    0xFF, 0x40, 0x02, 0xFC, 0x03, 0xFF, 0x95, 0x5B, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x01, 0xB0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xBF, 0x80,
-    0x00, 0x7F, 0x1F, 0xD0, 0x00, 0xFC, 0x07, 0xF0, 0x02, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFE, 0xBF, 0xFC, 0x1F, 0xF0, 0x0B, 0xFD, 0x3F, 0xD0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFF,
-    0xBF, 0xE5, 0x57, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x54,
-    0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x41, 0x6D,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x14, 0x00, 0x07,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xF0, 0x2F, 0x83, 0xF4, 0x1F, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x7F,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFD, 0x01, 0xBF, 0x40, 0x0F, 0xFF, 0xF0, 0x1F, 0xD7, 0xF4, 0x1F, 0x42, 0xF8, 0x0B, 0x03,
-    0xF4, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x07, 0xFF, 0xE4, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80,
-    0x02, 0xFF, 0x40, 0x00, 0x68, 0x00, 0x00, 0x15, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03,
-    0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x2F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x07, 0xFF, 0xE4, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x40,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF8,
-    0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F, 0xFE,
-    0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE, 0x00,
-    0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF, 0x41,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A,
-    0x50, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x5F, 0xD0,
-    0x00, 0x07, 0xD0, 0xFD, 0x00, 0x00, 0x2C, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xD7,
-    0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00,
-    0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F, 0xFC, 0x7F,
-    0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x05, 0x90, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0,
-    0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2B, 0x82, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80, 0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF,
-    0xD7, 0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0,
-    0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F, 0xFC,
-    0x7F, 0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x90, 0xBD, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x07, 0x40, 0x00, 0x00, 0x00, 0x05,
-    0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x2B, 0x80, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xAF, 0xE0, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80, 0x3F, 0xFC, 0x3F, 0xF0, 0x01,
-    0xFF, 0xD7, 0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFE, 0xFF,
-    0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x90, 0xBE, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xFE, 0x7F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02,
-    0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8,
-    0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0,
-    0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0xF8, 0x7E, 0x00, 0x00, 0x02, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAE, 0x0F, 0x80, 0x00, 0x0B, 0xFE, 0x19, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x02, 0xFC, 0x02,
-    0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFE,
-    0x00, 0xFF, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x03, 0xFF, 0x8B, 0xFE, 0x00, 0x0F,
-    0xFE, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0xFF, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0x80, 0x02, 0xFF, 0x8B,
-    0xFE, 0x00, 0x0B, 0xFD, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xF4, 0x01, 0xFF, 0xC0, 0xFF, 0xF4,
-    0x0F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x03,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0xD0, 0x00, 0x00, 0x0B, 0xD3, 0xFF, 0xC0, 0x00, 0x00, 0x02,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x1F,
-    0xD0, 0x00, 0x00, 0x07, 0xE0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00,
-    0xFF, 0xF4, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD,
-    0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00,
-    0x1F, 0xFC, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x40, 0x00, 0x0B, 0xFC, 0x0F, 0x00, 0x01, 0xFF, 0xF6, 0xF0, 0x00, 0x1F, 0xAF, 0xFF, 0x00,
-    0x00, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00,
-    0x2F, 0xC0, 0x1F, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xF8, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0F,
-    0xFE, 0xBF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFC, 0x3F, 0xFD, 0x03, 0xFF,
-    0x41, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x2F, 0xF8, 0x00,
-    0x00, 0x3F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF4, 0x00,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x2F,
-    0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xFC,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x80,
-    0x3F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0xD7, 0xFF, 0x00, 0x0F, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xEB,
-    0xFE, 0x00, 0x0B, 0xFE, 0xFF, 0xE0, 0x00, 0xBF, 0xEF, 0xFE, 0x00, 0x0B, 0xFE, 0xBF, 0xE0, 0x00,
-    0xBF, 0xDB, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xF4, 0x01, 0xFF, 0xC3, 0xFF, 0xD0, 0x3F, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xA4, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x1F,
-    0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0x47, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xC1, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x40,
-    0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x04, 0x00, 0x00, 0x34, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x6A, 0x94, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xF4, 0x7F, 0xF0, 0x00, 0xFF,
-    0xE2, 0xFF, 0x80, 0x03, 0xFF, 0x8B, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xF8, 0x00, 0x2F, 0xF8, 0xFF,
-    0xE0, 0x00, 0xBF, 0xE2, 0xFF, 0x80, 0x02, 0xFF, 0x4B, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFD, 0x00,
-    0x7F, 0xF0, 0x3F, 0xFD, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x01, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xA4,
-    0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x04, 0x00, 0x00, 0x0D, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x6A, 0x94, 0xBF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x3F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x7F, 0xF4, 0x7F, 0xF0, 0x00, 0xFF, 0xE2, 0xFF, 0x80, 0x03, 0xFF, 0x8B, 0xFE,
-    0x00, 0x0B, 0xFE, 0x3F, 0xF8, 0x00, 0x2F, 0xF8, 0xFF, 0xE0, 0x00, 0xBF, 0xE2, 0xFF, 0x80, 0x02,
-    0xFF, 0x4B, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xFD, 0x00, 0x7F, 0xF0, 0x3F, 0xFD, 0x03, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x5A, 0x40, 0x0F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x87, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE, 0x41, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x0B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4,
-    0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x4B, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xD2, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x1F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0xBF,
-    0xFE, 0x41, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x1F, 0x43, 0xF4,
-    0x00, 0x00, 0x2C, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x10, 0x00, 0x01, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x01, 0xAA, 0x52, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x00, 0xFF, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0xD1, 0xFF,
-    0xC0, 0x03, 0xFF, 0x8B, 0xFE, 0x00, 0x0F, 0xFE, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0xFF, 0xE0, 0x00,
-    0xBF, 0xE3, 0xFF, 0x80, 0x02, 0xFF, 0x8B, 0xFE, 0x00, 0x0B, 0xFD, 0x2F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x7F, 0xF4, 0x01, 0xFF, 0xC0, 0xFF, 0xF4, 0x0F, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xBD, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xD7, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x05, 0xA4, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xE0, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF,
-    0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x1B,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xD0,
-    0x00, 0x03, 0xFF, 0x87, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x7D, 0x7F, 0xFC, 0x00, 0x00,
-    0xF0, 0x3F, 0xD0, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x06, 0xA9, 0x4B, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFF, 0x47, 0xFF,
-    0x00, 0x0F, 0xFE, 0x2F, 0xF8, 0x00, 0x3F, 0xF8, 0xBF, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0x80, 0x02,
-    0xFF, 0x8F, 0xFE, 0x00, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00, 0xFF, 0xC1,
-    0xFF, 0xD0, 0x07, 0xFF, 0x03, 0xFF, 0xD0, 0x3F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xA4, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xF8, 0x7F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xE4, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x2F, 0xF8,
-    0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x00,
-    0x07, 0xFF, 0x40, 0x0B, 0xFF, 0xE4, 0x1B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x06, 0xA9, 0x4B, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFF, 0x47, 0xFF, 0x00,
-    0x0F, 0xFE, 0x2F, 0xF8, 0x00, 0x3F, 0xF8, 0xBF, 0xE0, 0x00, 0xBF, 0xE3, 0xFF, 0x80, 0x02, 0xFF,
-    0x8F, 0xFE, 0x00, 0x0B, 0xFE, 0x2F, 0xF8, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF,
-    0xD0, 0x07, 0xFF, 0x03, 0xFF, 0xD0, 0x3F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xE4, 0x6F, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x1B,
-    0xFF, 0x80, 0xBF, 0xFF, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x01, 0xBF,
-    0xF8, 0x0B, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x40, 0x2F, 0xF8, 0x00, 0x3F, 0xFD, 0x5B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0F,
-    0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x4B, 0xFF, 0xD0, 0x00, 0x15, 0x40, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0x00, 0x00, 0x03, 0x40,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x05, 0x00,
-    0x01, 0x7F, 0xD2, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xF0,
-    0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD,
-    0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x02,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x46, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x7F, 0xD2, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0xBF,
-    0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0xBF, 0xFE, 0x46, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x07, 0x43, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x10, 0x00, 0x00,
-    0x3C, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x50, 0x00, 0x17, 0xFD, 0x2F, 0xFF, 0x01, 0xFF, 0xFF, 0x8B, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0x3F, 0xFD, 0x5B, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x4B,
-    0xFF, 0xD0, 0x00, 0x15, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x2F, 0xD0, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x46, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x28, 0x00, 0x00, 0x03, 0xFF, 0xC3, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x07,
-    0xE3, 0xFF, 0xD0, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x04, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x7F, 0xD2,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x46, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x7F, 0xD2, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8,
-    0xBF, 0xFF, 0x03, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF4, 0x02,
-    0xFF, 0x80, 0x03, 0xFF, 0xD5, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xF4, 0xBF, 0xFD, 0x00, 0x01, 0x54, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00,
-    0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F,
-    0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F,
-    0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00,
-    0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F,
-    0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x03, 0xFC, 0x00,
-    0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x00,
-    0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x7F, 0x40,
-    0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x04, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0xF8, 0x00, 0x06, 0xFF, 0xC0, 0xFF, 0xC0, 0xBF, 0xFF, 0xF4,
-    0x1F, 0xFC, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x02, 0x90, 0x01, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF4, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00,
-    0x2F, 0xFC, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00,
-    0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0x42, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD3, 0xFF, 0xFF, 0x42, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x07,
-    0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0xC0, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xDF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x6F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x03, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x8B, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC7, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0x81, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4,
-    0x07, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x28, 0x00,
-    0x00, 0x02, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xE3, 0xFF, 0xD0,
-    0x00, 0x00, 0x2C, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x82,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x2F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80,
-    0x03, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x0B, 0xFE,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xF4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38, 0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4,
-    0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75,
-    0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B,
-    0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x40, 0xA9, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF,
-    0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0,
-    0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF,
-    0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0,
-    0xFF, 0x3F, 0xC0, 0xFF, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x40,
-    0x0F, 0xC0, 0xFD, 0x0B, 0xF0, 0x3F, 0x81, 0xFD, 0x0B, 0xF4, 0x3F, 0xE0, 0xBF, 0xC1, 0xFF, 0x41,
-    0xE0, 0x00, 0x00, 0x40, 0x2F, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0x42, 0xFC,
-    0x0F, 0xD0, 0xBE, 0x01, 0xA0, 0x00, 0x00, 0x40, 0x2F, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFC, 0x1F,
-    0xE0, 0x7F, 0x42, 0xFC, 0x0F, 0xD0, 0xBE, 0x01, 0xE0, 0x00, 0x05, 0x00, 0xFF, 0x0B, 0xFD, 0x2F,
-    0xF0, 0xBF, 0x42, 0xFD, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x19, 0x00, 0x00, 0x40,
-    0x05, 0x00, 0xFC, 0x0B, 0xD0, 0xFD, 0x07, 0xF0, 0xBF, 0x03, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xD0,
-    0xFF, 0x0B, 0xF4, 0x3F, 0xC3, 0xFE, 0x0F, 0xF4, 0xBF, 0xC3, 0xFF, 0x1F, 0xF4, 0xBF, 0xC1, 0xE0,
-    0x0B, 0x80, 0x00, 0x40, 0x05, 0x00, 0xBF, 0x07, 0xF8, 0x1F, 0xF8, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD,
-    0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x82, 0xFC, 0x07, 0xF4, 0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x0F, 0xD0,
-    0xBF, 0x02, 0xF8, 0x0F, 0xC0, 0x1A, 0x00, 0xA4, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0x07, 0xF8,
-    0x1F, 0xF8, 0xFF, 0xC0, 0xFF, 0xC3, 0xFD, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0x82, 0xFD, 0x07, 0xF4,
-    0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x0F, 0xD0, 0xBF, 0x02, 0xF8, 0x0F, 0xD0, 0x1E, 0x00, 0xB4, 0x00,
-    0x05, 0x00, 0x10, 0x0F, 0xF0, 0x7F, 0x8B, 0xFD, 0x3F, 0xF2, 0xFF, 0x0F, 0xF4, 0xBF, 0x43, 0xFC,
-    0x2F, 0xD0, 0xFF, 0x03, 0xF8, 0x2F, 0xC0, 0xBF, 0x03, 0xF4, 0x0F, 0xD0, 0xBF, 0x02, 0xFC, 0x0F,
-    0xD0, 0x19, 0x00, 0xA0, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0x91, 0xFC, 0x6F, 0x3F, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xBF, 0xBF, 0xC5, 0x01, 0xF8, 0x05, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0x91, 0xFC,
-    0x6F, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0xBF, 0xAF, 0xC5, 0x01, 0xFC, 0x01,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0xB9, 0x0F, 0x86, 0xF3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEB,
-    0xF6, 0xFC, 0x50, 0x1F, 0xC0, 0x10, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xFD, 0xBF,
-    0xFE, 0xBF, 0xFE, 0xBF, 0xFD, 0x3F, 0xFC, 0x0A, 0xA0, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xD0, 0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0xBF,
-    0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF4, 0x15, 0x00, 0x1A, 0x80, 0x0A, 0x81, 0xFF, 0xC0, 0xFF, 0xCB,
-    0xFF, 0x0B, 0xFF, 0x6F, 0xFC, 0x2F, 0xFC, 0x7F, 0xE0, 0x3F, 0xF0, 0x59, 0x00, 0x19, 0x00, 0x0A,
-    0x80, 0x00, 0x2A, 0x00, 0x00, 0xA8, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x40,
-    0x1F, 0xFD, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x01, 0x90, 0x00, 0x06, 0x40, 0x00, 0x19, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF,
-    0x8F, 0xFE, 0x2F, 0xF0, 0x15, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E,
-    0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F,
-    0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40,
-    0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB,
-    0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D,
-    0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E,
-    0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE6, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x41, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0xBF, 0x0B, 0xF0, 0x06, 0x90, 0x00, 0x00, 0x65, 0x00, 0x3F, 0xC0, 0xFE, 0x0F,
-    0xD0, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x2F, 0x83, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0x07, 0xF4, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x01, 0xBE, 0x40,
-    0xFE, 0x0F, 0xE0, 0x2F, 0xC0, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xD1,
-    0xFD, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0x0F, 0xE2, 0xFC, 0x01, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xD0, 0x0F, 0xE2, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x1F,
-    0xD2, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x00,
-    0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x2F, 0xC1, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4,
-    0x7F, 0x80, 0xFF, 0x4B, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x3F, 0x80, 0x1F, 0xF0, 0x0F, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0xFF,
-    0x40, 0xBF, 0x80, 0x3F, 0xC0, 0x0F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x64, 0x00, 0x90, 0x00, 0xFE,
-    0x02, 0xFC, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xFF, 0x0B, 0xFC, 0x03, 0xFE, 0x0F, 0xF8, 0x0B, 0xFC,
-    0x2F, 0xF0, 0x0F, 0xF4, 0x3F, 0xE0, 0x2F, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0x00,
-    0xBD, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x64, 0x00, 0x90, 0x03, 0x40, 0x03, 0xF8, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x1F, 0xF0, 0x3F, 0xD0, 0xFF, 0x80, 0xFF, 0xC2, 0xFF, 0x07, 0xFD, 0x03, 0xFE, 0x0F,
-    0xF8, 0x3F, 0xF0, 0x2F, 0xF0, 0xBF, 0xC1, 0xFF, 0x40, 0xFF, 0x43, 0xFE, 0x0F, 0xF8, 0x0B, 0xF8,
-    0x1F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x02, 0xFD, 0x00, 0xFC, 0x02, 0xF4, 0x07, 0xE0, 0x00,
-    0x50, 0x01, 0x40, 0x06, 0x00, 0x00, 0x06, 0x40, 0x0B, 0xF0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x2F,
-    0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0x40, 0x0A,
-    0x00, 0x18, 0x01, 0xFC, 0x03, 0xF4, 0x0F, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0, 0x7F, 0xD0, 0x3F, 0xE0,
-    0xFF, 0xC0, 0xBF, 0xC1, 0xFF, 0x00, 0xFF, 0x43, 0xFE, 0x01, 0xFF, 0x03, 0xFC, 0x02, 0xFD, 0x07,
-    0xF4, 0x03, 0xF0, 0x0B, 0xD0, 0x02, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x60, 0x07, 0xF0,
-    0x0F, 0xD0, 0x3F, 0x80, 0xFF, 0x82, 0xFF, 0x07, 0xFC, 0x0B, 0xFC, 0x1F, 0xF4, 0x3F, 0xE0, 0x3F,
-    0xE0, 0xFF, 0xC3, 0xFF, 0x02, 0xFF, 0x07, 0xFC, 0x1F, 0xF4, 0x0F, 0xF4, 0x3F, 0xE0, 0xBF, 0xC0,
-    0x7F, 0xC0, 0xFF, 0x03, 0xFD, 0x02, 0xFD, 0x07, 0xF4, 0x0F, 0xE0, 0x0F, 0xC0, 0x2F, 0x40, 0x7E,
-    0x00, 0x20, 0x00, 0x80, 0x01, 0x40, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x07, 0xF8, 0xFE, 0x01, 0xFE, 0x03, 0xF8, 0x2F, 0x80, 0x0F, 0xD0, 0x00,
-    0x09, 0x00, 0x1F, 0xD0, 0x2F, 0xF0, 0x2F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF4, 0x0F, 0xF8, 0x03, 0xFF,
-    0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x01, 0xFD, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x1F,
-    0xD0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x0B, 0xFC, 0x07, 0xFF, 0x03,
-    0xFF, 0x03, 0xFE, 0x02, 0xFE, 0x01, 0xFD, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x07, 0x8B, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0xBE, 0x02, 0xFC, 0x03, 0xF0,
-    0x0B, 0xE0, 0xBF, 0x03, 0xF4, 0x00, 0xFD, 0x0F, 0x43, 0xF4, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00,
-    0x00, 0xFD, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x01, 0x80, 0xFE, 0xF8, 0x18, 0x02,
-    0xFC, 0x1F, 0xF8, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0B, 0xF4, 0x1F, 0xC1, 0xFF, 0xC1, 0xFC, 0x01,
-    0x41, 0xFD, 0xFC, 0x04, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0x82, 0xF8, 0x00, 0xFD, 0x0B, 0xF0, 0x3F, 0x40, 0xFD,
-    0x02, 0xFC, 0x03, 0xF4, 0xBD, 0x00, 0x2D, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x01, 0xA8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xE0, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x0F, 0xFC, 0xBF, 0xC0, 0x0F, 0xFC, 0xBF, 0xC0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF8,
-    0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x7F, 0xC0, 0x0F, 0xF4, 0x7F, 0xC0, 0x0F, 0xF4, 0x3F, 0x80, 0x0B, 0xF4, 0x3F, 0x80, 0x0B, 0xF4,
-    0x3F, 0x80, 0x07, 0xF4, 0x3F, 0xC0, 0x07, 0xF4, 0x2F, 0xC0, 0x03, 0xF4, 0x14, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x50, 0x3F, 0xF0, 0x07, 0xFD, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x7F, 0xF0, 0x0F, 0xFF, 0x3F, 0xF0, 0x0B, 0xFD, 0x06, 0x40, 0x01, 0x90, 0xAA, 0xAA, 0xAA, 0xAA,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x15, 0x50, 0xBF,
-    0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x39, 0x5B, 0xFE, 0x01, 0xE5, 0x6F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x00,
-    0x07, 0xFC, 0x00, 0x6F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0xBF, 0xE4, 0x00, 0x00, 0xFF, 0x8B, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xF4, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0xE5, 0x6F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0xC0, 0x00,
-    0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x1B, 0xF4, 0x0B, 0xF8, 0x00, 0x1B, 0xFF, 0xC0, 0x2F, 0xE0,
-    0x0B, 0xFF, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x03,
-    0xF8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x24, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x05, 0x40, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x03,
-    0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x40, 0x00, 0x00, 0x19,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xE0, 0x1F, 0xFF,
-    0xF4, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0x0B, 0xFC, 0x00, 0xF9,
-    0x5F, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xCB, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0xC0, 0x00,
-    0x00, 0x0B, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x01, 0xBF, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0xFF, 0xC3, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x3F, 0x80,
-    0x02, 0xFF, 0xE4, 0x03, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x14, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xF0, 0x02, 0xFF, 0xC0, 0x07,
-    0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x00, 0x64, 0x00, 0x06, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x90, 0x03, 0x40, 0x0A, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F,
-    0x01, 0xFD, 0x01, 0xFF, 0x03, 0xFD, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F, 0xF0, 0xBF, 0xC1, 0xFF, 0x43,
-    0xFE, 0x03, 0xFE, 0x0F, 0xF8, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xC2, 0xFF, 0x07, 0xFD, 0x0F, 0xF8,
-    0x0F, 0xF4, 0x3F, 0xE0, 0xFF, 0x82, 0xFF, 0x02, 0xFE, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F,
-    0xC0, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x03, 0xF0, 0x0B, 0xD0, 0x1F, 0x80, 0x3E, 0x00, 0x05, 0x00,
-    0x14, 0x00, 0x60, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x3F, 0xD0, 0xFF, 0x40, 0x7F, 0x83, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xC0, 0x0F, 0xF1, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F,
-    0xF0, 0x0B, 0xF8, 0x2F, 0xE0, 0x3F, 0xC0, 0x7F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0xFC, 0xFD, 0x00, 0x2F,
-    0x4F, 0xD0, 0x0B, 0xE0, 0xFD, 0x01, 0xFC, 0x0F, 0xD0, 0x3F, 0xAA, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00,
-    0xBF, 0xE4, 0x02, 0xFF, 0xFC, 0x06, 0xBF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
-    0x80, 0x07, 0xFC, 0xAA, 0xFF, 0xE3, 0xFF, 0xFE, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFF, 0xF0, 0x07, 0xFF, 0x90, 0x07, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x02, 0xFF, 0xA9, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xEB, 0xFF, 0x1F, 0xD0, 0x3F, 0xC7, 0xF4,
-    0x07, 0xF4, 0xFE, 0x01, 0xFD, 0x3F, 0xC0, 0xBF, 0x0B, 0xFE, 0xBF, 0xC0, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE8, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFD,
-    0x03, 0xF8, 0xFC, 0x07, 0xF0, 0x24, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFF, 0xC0,
-    0x7F, 0x47, 0xF8, 0x2F, 0xC0, 0xBF, 0x0B, 0xF0, 0x3F, 0x81, 0xFF, 0x2F, 0xC0, 0x1F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x43, 0xF8, 0x1F, 0xF1, 0xFC, 0x02, 0xFC, 0x7F, 0x00, 0xBF,
-    0x0F, 0xF4, 0x7F, 0x82, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xEF, 0xF4, 0x3F, 0xC0, 0xFF, 0x1F, 0xD0,
-    0x3F, 0xC7, 0xF4, 0x0B, 0xF0, 0xFF, 0x02, 0xFC, 0x2F, 0xFA, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x1A,
-    0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC7, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xEB,
-    0xF4, 0x02, 0xFC, 0x0F, 0xE0, 0x0B, 0xE0, 0x2F, 0x80, 0x2F, 0x80, 0xBE, 0x00, 0xBE, 0x02, 0xF8,
-    0x02, 0xF8, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0x80, 0xFF, 0xE2, 0xFF, 0xC7, 0xFF, 0x8F, 0xFF, 0x00,
-    0x00, 0x06, 0x90, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFE, 0x6F, 0xF0, 0x2F,
-    0xE0, 0x2F, 0xE0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x7F, 0xC0,
-    0x0F, 0xF0, 0xFF, 0x00, 0x3F, 0xC3, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x04, 0x00, 0x06,
-    0xFC, 0x06, 0xFF, 0xF0, 0x2F, 0xFF, 0x80, 0x2A, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0x40,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x45, 0x55, 0x54, 0x00, 0x59, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xD0, 0xFF, 0x5F, 0xF8, 0x3F, 0x80, 0xFF, 0x0B, 0xD0, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x50, 0x00, 0x59, 0x40, 0x0B,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x3F, 0x42, 0xFD, 0x2D, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x1F, 0xFC, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xD0, 0x0A, 0xE9, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xEF,
-    0xD0, 0x01, 0xFC, 0xFD, 0x00, 0x3F, 0x0F, 0xD0, 0x0F, 0xD0, 0xFD, 0x02, 0xF8, 0x0F, 0xD0, 0x3F,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x0A, 0xAA, 0xFF, 0xA0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD1, 0xFF, 0xFF, 0x47, 0xFF, 0xFC, 0x1F,
-    0xC0, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xF4, 0x0F, 0xFF, 0xF8, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x6F, 0xF3, 0xFF, 0xFF, 0x4B, 0xFF, 0xF4, 0x0B, 0xE9, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x0B, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x3F, 0x82, 0xFF, 0x1F, 0xD0, 0x2F,
-    0xD7, 0xF8, 0x07, 0xF4, 0xFF, 0x01, 0xFD, 0x3F, 0xD0, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0x80, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC,
-    0xFC, 0x03, 0xF4, 0xB8, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x1A, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xBF, 0xD0, 0xBF, 0x03,
-    0xF8, 0x2F, 0xC0, 0xBE, 0x0B, 0xF4, 0x3F, 0x40, 0xFF, 0xBF, 0x80, 0x0F, 0xFF, 0x80, 0x07, 0xFF,
-    0xF8, 0x0B, 0xF5, 0xFF, 0x83, 0xF4, 0x0F, 0xF1, 0xFC, 0x02, 0xFC, 0x7F, 0x40, 0xBF, 0x0F, 0xFA,
-    0xFF, 0x41, 0xFF, 0xFF, 0x40, 0x06, 0xF9, 0x00, 0x00, 0x69, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xC0, 0xFF, 0x5B, 0xF8, 0x3F, 0x80, 0xFF, 0x1F, 0xD0, 0x2F, 0xC7, 0xF8, 0x0B, 0xF0, 0xFF,
-    0x42, 0xFC, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x00,
-    0x7F, 0xF0, 0x0A, 0xFF, 0xF4, 0x03, 0xFF, 0xE0, 0x00, 0x2E, 0x80, 0x00, 0x15, 0x55, 0x55, 0x55,
-    0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xFA, 0xFF, 0xFC, 0x01,
-    0xFF, 0x80, 0x03, 0xF4, 0x07, 0xFE, 0x00, 0x0F, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x55, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xFA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xAB, 0xFF, 0xA9,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFE, 0x00, 0x03,
-    0xFE, 0x02, 0xFE, 0x00, 0x07, 0xFC, 0x01, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xAF, 0xFA, 0xAF, 0x40, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xBF, 0xFE, 0xAA, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x06, 0x7F, 0xFA, 0xAA, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x15, 0xFF, 0x95, 0x56, 0xBC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xFF, 0xFF, 0xF8, 0x06, 0x80, 0x00,
-    0x55, 0x40, 0x01, 0x6A, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xD5, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x07,
-    0xFC, 0x00, 0x00, 0x15, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x6F, 0xFF, 0xFD, 0x02, 0xFF, 0xF8,
-    0x00, 0xFF, 0xC0, 0xBF, 0xF1, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xD0, 0xBD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC0,
-    0x7C, 0x00, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x14, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x1E, 0x02, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0x00, 0xFE, 0x0B, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x3F, 0x02, 0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xA0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x57, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0x80, 0x07, 0xFC, 0x00, 0x0B, 0xC0, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x10, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x5F, 0xFD, 0x55, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF9, 0x01, 0xBC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xBF, 0x7F, 0x7F, 0x8B, 0xF4, 0xFC,
-    0x7F, 0x8F, 0x83, 0xF0, 0xBC, 0x08, 0x1F, 0xC0, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x05, 0x55, 0x00, 0x00, 0xBF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x08, 0x1F, 0xC0, 0x80, 0xB8, 0x3F, 0x0B, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F, 0xF7, 0xF7,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x00, 0x0B,
-    0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x0B, 0xF4,
-    0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xF5, 0x55, 0x55, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF8,
-    0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0xFC, 0xFF, 0x0B, 0xC3, 0xF1,
-    0xF8, 0x09, 0x0F, 0xC2, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x90, 0xFC, 0x18, 0x0B, 0xC3, 0xF0, 0xF8, 0x3F,
-    0xCF, 0xCF, 0xF0, 0x7F, 0xBF, 0xBF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xFF, 0x7F, 0x7F,
-    0xC3, 0xF4, 0xFC, 0x7F, 0x03, 0x83, 0xF0, 0xB0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0x03, 0xF0, 0x10, 0x1F, 0x0F, 0xC3, 0xD0, 0xFF, 0x3F, 0x3F, 0xC1, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00,
-    0x08, 0x03, 0xF4, 0x00, 0xBC, 0x0F, 0xD0, 0x0B, 0xFC, 0x3F, 0x40, 0xBF, 0xC0, 0xFD, 0x07, 0xF8,
-    0x03, 0xF4, 0x7F, 0x95, 0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x01, 0xFC, 0x1F, 0x80, 0x07, 0xF0, 0xFF,
-    0x80, 0x1F, 0xC0, 0xFF, 0x40, 0x7F, 0x00, 0xBF, 0x41, 0xFD, 0x55, 0xBF, 0x47, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0x80,
-    0x00, 0xFD, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F,
-    0x43, 0xF8, 0x00, 0x00, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xF9, 0x55, 0x55, 0x54, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x55, 0x5A, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F,
-    0x55, 0x55, 0x55, 0x55, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x55, 0x55, 0x55, 0x50, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x95, 0x6A, 0xAA, 0xE0, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0xBF, 0x47, 0xF8,
-    0x00, 0x0B, 0xFD, 0x1F, 0xF8, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x0B, 0xFB, 0xD1, 0xFB, 0xF8, 0x3F,
-    0x5F, 0x47, 0xD7, 0xF0, 0x34, 0x7D, 0x1F, 0x47, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x07, 0xD1,
-    0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x7D, 0x00,
-    0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02,
-    0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x1A, 0x95, 0x54, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x07, 0xE1, 0x55, 0x55, 0x55, 0x57, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x2E, 0xAA, 0xA5, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x02, 0x90, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00,
-    0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4,
-    0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40,
-    0x00, 0x01, 0xF4, 0x7D, 0x00, 0x03, 0x07, 0xD1, 0xF4, 0x70, 0x3F, 0x1F, 0x47, 0xD3, 0xF0, 0xFF,
-    0x7D, 0x1F, 0x7F, 0xC0, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0xBF, 0xD1, 0xFF, 0x80, 0x00, 0xBF, 0x47,
-    0xF8, 0x00, 0x00, 0xBF, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0E, 0x00, 0x00,
-    0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFD, 0x55, 0x55, 0x55, 0xFD, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xD5, 0x55, 0x55, 0x5F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x03,
-    0xFC, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x02, 0xFE,
-    0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xFC, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x2F,
-    0xFC, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0x00, 0x00,
-    0x01, 0xFF, 0xC3, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0F, 0xD5, 0xBF, 0xF0, 0x00, 0x90, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x02,
-    0xFF, 0x40, 0xFF, 0xC0, 0x3F, 0xD0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x0B,
-    0xFC, 0x1F, 0xF0, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xEA, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x45, 0x55, 0x40, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xF5, 0xEA, 0xAA, 0x5F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40,
-    0x02, 0x80, 0x00, 0x1B, 0xFF, 0xFF, 0x42, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFA, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF,
-    0x40, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x07, 0xFD, 0x00,
-    0x01, 0xFC, 0xFF, 0x82, 0xFF, 0x00, 0x01, 0xFC, 0x2F, 0xF0, 0xFF, 0xC0, 0x01, 0xFD, 0x0B, 0xFC,
-    0x3F, 0xE0, 0x00, 0xFD, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0xFD, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0xFD,
-    0x00, 0x2F, 0xF0, 0xFF, 0x80, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0xFD, 0x00, 0x03, 0xFE, 0x0B,
-    0xFC, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00,
-    0xBF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0x00, 0x06, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x03, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0xC0, 0x00,
-    0x00, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00,
-    0x00, 0x7F, 0x40, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xD0, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xE5, 0x55, 0x57, 0xFD, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0x00, 0x00,
-    0xBF, 0x41, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0xF8, 0x00, 0x1F, 0xE0, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0x0F, 0xE0,
-    0x00, 0x00, 0xFF, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x95, 0x55, 0x55, 0x55,
-    0x43, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xE4,
-    0x03, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE1, 0x55, 0xFF, 0x95, 0x51,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xE5, 0x5B, 0xFD, 0x55, 0x50, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFE,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0x55, 0x55, 0x55,
-    0x54, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x06,
-    0xFF, 0xD0, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x02, 0xFF, 0x40, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x15, 0x5B, 0xFD, 0x55, 0x2F, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x15, 0x55, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xEF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0x55, 0x55, 0x5B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xF9, 0x55, 0x57, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F,
-    0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00,
-    0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF5, 0x55, 0x5F, 0xF0,
-    0x1F, 0xFD, 0x00, 0x01, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xC0,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xC0, 0xFF,
-    0x80, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95,
-    0x55, 0x55, 0x54, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0x03, 0xF0, 0x78, 0x2F, 0xD3, 0xE3, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFB, 0xFF, 0xFD, 0x1F,
-    0xC3, 0xE1, 0xFC, 0x0D, 0x07, 0xF0, 0x34, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC,
-    0x7F, 0x00, 0xBF, 0x2F, 0xC0, 0x1F, 0xCB, 0xF0, 0x03, 0xF2, 0xFC, 0x02, 0xFC, 0x3F, 0xD6, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0xF9, 0x00, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F,
-    0xFC, 0x7F, 0xE0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0xD0, 0x00,
-    0xFD, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0x16, 0xFF, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0x00, 0x07, 0xFC,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x1F,
-    0xE3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0xFF, 0xD0, 0x07, 0xC0, 0xFF, 0xFD, 0x0B, 0xF0, 0xFF, 0xFF, 0xCB,
-    0xF8, 0x3F, 0x82, 0xFF, 0xF0, 0x1F, 0xC0, 0x3F, 0xF0, 0x0B, 0xE0, 0x03, 0xF8, 0x02, 0xFC, 0x02,
-    0xFF, 0x40, 0x7F, 0x42, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0xFF, 0x82, 0xFF, 0xFC, 0x0F, 0xF0, 0x2F,
-    0xF8, 0x00, 0xFC, 0x00, 0x50, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 0x43, 0xFF,
-    0xE0, 0xBF, 0x2F, 0xC0, 0x3F, 0xE0, 0x0F, 0xCB, 0xE0, 0x0B, 0xF0, 0x03, 0xF2, 0xF8, 0x03, 0xFF,
-    0x00, 0xFC, 0x7F, 0x03, 0xFF, 0xE0, 0xBF, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0x3F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD,
-    0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF,
-    0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x55,
-    0x40, 0x2A, 0x40, 0xA9, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x15, 0x40, 0x55, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF4, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00,
-    0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x87,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x56, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0xBF, 0xC7, 0xFC, 0x00,
-    0x00, 0xFF, 0x5F, 0xE0, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F,
-    0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD,
-    0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00,
-    0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE,
-    0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0,
-    0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00,
-    0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB,
-    0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00,
-    0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07,
-    0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0x7F,
-    0x80, 0x00, 0x0B, 0xF5, 0xFF, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x02, 0xFF, 0x0B, 0xFF, 0x95,
-    0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x02, 0xFF, 0x07, 0xD0, 0x00, 0x0F, 0xFC,
-    0x04, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x04, 0x07, 0xFD, 0x00, 0x00, 0xFC,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x4B, 0xFF, 0x3F, 0xFC, 0xBF, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x07, 0xFE, 0x2F, 0xFC, 0xFF, 0xF1, 0xFF, 0x81, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF,
-    0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x14, 0x03, 0xFF, 0xF8, 0x00, 0x7D, 0x0F,
-    0xFF, 0xFF, 0x96, 0xFE, 0x2F, 0xE6, 0xFF, 0xFF, 0xFC, 0x2F, 0x40, 0x1F, 0xFF, 0xF0, 0x0A, 0x00,
-    0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x54,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01,
-    0xA4, 0x00, 0x14, 0x03, 0xFF, 0xD0, 0x0F, 0xC3, 0xFF, 0xFE, 0x0B, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0x03, 0xFF, 0xFD, 0x0F, 0x40, 0x1F, 0xFD, 0x00, 0x40, 0x00, 0x54, 0x00, 0x0B, 0xE0, 0x00,
-    0x60, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0xFD, 0x2F, 0xC7, 0xFE, 0xFF, 0xFF, 0xF2, 0xF8, 0x0B,
-    0xFF, 0xF0, 0x2C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE4, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFA, 0x55, 0x6B, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x03, 0xF0, 0x2A, 0xAA, 0xBF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEA,
-    0xAA, 0xFF, 0xAA, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xAA, 0xFE, 0xAA, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFA, 0xAA, 0xA4, 0x2F, 0x80, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0xBF, 0xF9, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02,
-    0xFF, 0xD0, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF, 0x40,
-    0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40,
-    0x1F, 0xFF, 0x40, 0x07, 0xFF, 0x90, 0x07, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x07, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xD0, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0xBF, 0x40, 0x02,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00,
-    0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x40,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0xAA, 0xA4, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0x9F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xF0,
-    0x6A, 0xBF, 0xFA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x2A, 0xAA, 0xAA, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x9F, 0xDB, 0xFD, 0x00, 0x01,
-    0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00,
-    0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x0F, 0x80,
-    0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAF, 0xEA, 0xAA,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00,
-    0x3F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0xFC, 0x6F, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7E,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x7E, 0xBF, 0x00, 0x07,
-    0xF6, 0xF4, 0x2F, 0x0B, 0xF0, 0x07, 0xF4, 0x3E, 0x0F, 0xC0, 0xBF, 0x07, 0xF4, 0x0F, 0xC3, 0xE0,
-    0x0B, 0xF7, 0xF4, 0x02, 0xF1, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x0B, 0xF8, 0x00,
-    0x1F, 0x5F, 0x40, 0x07, 0xFF, 0x00, 0x07, 0xD3, 0xD0, 0x07, 0xFF, 0xF0, 0x01, 0xF0, 0xF8, 0x07,
-    0xF4, 0xBF, 0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x0B, 0xF0, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0xBF, 0x1F,
-    0x40, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xF6, 0xF4, 0x2F,
-    0x00, 0x00, 0x07, 0xF4, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x00, 0x07, 0xF4,
-    0x02, 0xF1, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x5F, 0x40,
-    0x07, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x07, 0xF4, 0x00, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0x00, 0x00,
-    0xBC, 0x3F, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC, 0x7F,
-    0xE0, 0x15, 0x00, 0x0A, 0x90, 0x00, 0x2A, 0x40, 0x00, 0xA9, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F, 0xFD,
-    0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_boldBitmaps[50928] = {
+    0x1A, 0xAA, 0x91, 0xFA, 0x09, 0xFA, 0x0A, 0xF9, 0x0A, 0xF1, 0xAF, 0x1A, 0xF1, 0xAF, 0x1A, 0xF1,
+    0xAF, 0x1A, 0xF1, 0x9F, 0x19, 0xF2, 0xEA, 0x2E, 0xA2, 0xEA, 0x2F, 0x2A, 0xE2, 0x99, 0x74, 0x99,
+    0x92, 0xFC, 0x09, 0xFC, 0x09, 0xFC, 0x1F, 0xC2, 0x9A, 0x91, 0x1A, 0xAA, 0x2A, 0xAA, 0x90, 0xF1,
+    0xF9, 0x9F, 0x1F, 0x0A, 0xF0, 0x9F, 0x0A, 0xF1, 0xF0, 0x9F, 0x1F, 0x09, 0xEA, 0x1F, 0x09, 0xEA,
+    0x1F, 0x1E, 0xA1, 0xF1, 0xE9, 0x1E, 0xA1, 0xCA, 0x92, 0xAC, 0xA7, 0x50, 0x6A, 0xDA, 0x29, 0xDA,
+    0x71, 0xEA, 0x2F, 0x71, 0xE9, 0x2E, 0xA7, 0x09, 0xE2, 0x9E, 0x97, 0x0A, 0xE2, 0xAE, 0x59, 0xAA,
+    0xAF, 0xAA, 0xAF, 0xAA, 0xA2, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xD5, 0xAE, 0x29, 0xE7, 0x1E, 0xA2,
+    0xAE, 0x71, 0xE9, 0x2E, 0xA7, 0x09, 0xE3, 0xE9, 0x59, 0x99, 0xF9, 0x99, 0xAE, 0x99, 0x99, 0x19,
+    0xFF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFF, 0xC9, 0x19, 0x99, 0xAE, 0x99, 0x9A, 0xEA, 0x99, 0x95, 0xAE,
+    0x29, 0xE7, 0x1E, 0xA2, 0xAE, 0x71, 0xE9, 0x2E, 0xA7, 0x09, 0xE3, 0xE9, 0x71, 0x99, 0x93, 0x99,
+    0x97, 0x77, 0x79, 0xDA, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0x9D, 0x97, 0x29, 0xAF, 0xCA, 0x7F,
+    0xFD, 0xA4, 0xFF, 0xFA, 0x2F, 0x9A, 0xD0, 0xAF, 0x19, 0xE9, 0x09, 0xD1, 0xAE, 0x1A, 0xE1, 0xAD,
+    0x2D, 0xA1, 0xAE, 0x90, 0xAD, 0x2A, 0xA2, 0xAF, 0x0A, 0xD7, 0x9F, 0xF7, 0x0F, 0xF9, 0x70, 0xFF,
+    0xCA, 0x7A, 0xFF, 0xC9, 0x7A, 0xFF, 0x97, 0xFF, 0xC2, 0xA9, 0x2D, 0xA0, 0xAF, 0x1D, 0xA2, 0xDA,
+    0x1F, 0x09, 0xE2, 0xDA, 0x1F, 0x0A, 0xE9, 0x1D, 0xA1, 0xF0, 0xAF, 0x1D, 0x90, 0xF9, 0x1F, 0xFF,
+    0xD2, 0x9F, 0xFE, 0xA5, 0xAF, 0xEA, 0x97, 0x19, 0xDA, 0x74, 0x9D, 0x97, 0x49, 0xD9, 0x74, 0xAD,
+    0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1C, 0xA7, 0x29, 0xFC, 0xA7, 0x0A,
+    0xE7, 0x0A, 0xFF, 0x7E, 0xA7, 0x9E, 0xA9, 0xAE, 0xA5, 0xAE, 0x70, 0xEA, 0x2F, 0x49, 0xE9, 0x79,
+    0xE9, 0x2A, 0xE4, 0xF7, 0x09, 0xE3, 0x9E, 0x92, 0x9E, 0x71, 0xAE, 0x39, 0xE9, 0x2E, 0xA7, 0x1A,
+    0xE3, 0x9E, 0x91, 0x9E, 0x72, 0xAE, 0x39, 0xE2, 0xE9, 0x72, 0x9E, 0x92, 0xAE, 0x1A, 0xE3, 0x9A,
+    0xA9, 0x4F, 0x2E, 0xA1, 0xE9, 0x1A, 0xFD, 0x92, 0xAF, 0xFC, 0x1A, 0xDA, 0x1F, 0xFC, 0x92, 0xAF,
+    0xE2, 0xE1, 0x9E, 0x90, 0x9F, 0x39, 0xAD, 0xA9, 0x2E, 0xA1, 0xEA, 0x2A, 0xE7, 0x39, 0xE2, 0xE9,
+    0x29, 0xE9, 0x72, 0xEA, 0x19, 0xE9, 0x3E, 0xA7, 0x1A, 0xE2, 0x9E, 0x93, 0xEA, 0x71, 0xE9, 0x29,
+    0xE9, 0x29, 0xE9, 0x70, 0xAE, 0x39, 0xE9, 0x29, 0xE9, 0x79, 0xE9, 0x4E, 0xA2, 0xAE, 0x70, 0xF5,
+    0xF9, 0x09, 0xEA, 0x79, 0xE9, 0x6F, 0xFC, 0x70, 0xEA, 0x70, 0xFD, 0xA7, 0x19, 0xD7, 0x29, 0x99,
+    0x97, 0x59, 0x77, 0x30, 0x77, 0x77, 0x9A, 0xFA, 0x77, 0x0A, 0xFF, 0x97, 0x5F, 0xFE, 0x74, 0x9F,
+    0x2F, 0x74, 0xF9, 0x29, 0xE9, 0x73, 0xF3, 0x9E, 0x74, 0xF3, 0xAE, 0x74, 0xF9, 0x19, 0xE9, 0x74,
+    0xFA, 0x1E, 0x97, 0x5A, 0xF0, 0x9D, 0x97, 0x6A, 0xF9, 0x77, 0x1F, 0xE3, 0xAF, 0xF3, 0xFF, 0x92,
+    0xFF, 0xC2, 0xAF, 0xAF, 0x29, 0xAF, 0xAA, 0x91, 0x9F, 0x1F, 0xC3, 0x9E, 0x4A, 0xEA, 0x19, 0xFC,
+    0x29, 0xE4, 0xFA, 0x2A, 0xFC, 0x19, 0xE4, 0xFA, 0x3A, 0xFC, 0x9A, 0xE4, 0xFC, 0x4A, 0xFF, 0xC4,
+    0xAF, 0x94, 0xAF, 0xE9, 0x49, 0xFC, 0x94, 0x9F, 0xEA, 0x93, 0xAF, 0xDA, 0xAA, 0xAF, 0xFE, 0xA9,
+    0x1A, 0xFF, 0xFF, 0xFC, 0xA2, 0x9A, 0xFF, 0xCA, 0x1A, 0xFD, 0x79, 0x99, 0x99, 0x69, 0x99, 0x91,
+    0x1A, 0xAA, 0x1F, 0x09, 0xF0, 0xAF, 0x0A, 0xF0, 0x9F, 0x09, 0xEA, 0x09, 0xEA, 0x1E, 0xA1, 0xE9,
+    0x1C, 0xA9, 0x70, 0x77, 0x1D, 0x96, 0xF9, 0x4F, 0xC4, 0xAF, 0x49, 0xF5, 0xF9, 0x49, 0xF5, 0xF9,
+    0x5F, 0x5A, 0xEA, 0x5F, 0x95, 0xF5, 0x9F, 0x59, 0xF5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAF,
+    0x59, 0xF5, 0x9F, 0x6F, 0x95, 0xFA, 0x59, 0xF6, 0xF9, 0x5A, 0xF6, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F,
+    0xA5, 0x9F, 0x96, 0xE7, 0x09, 0x10, 0x75, 0xD9, 0x7F, 0x96, 0xAF, 0x96, 0xAF, 0x7A, 0xF7, 0xF9,
+    0x69, 0xF7, 0xF9, 0x6A, 0xF7, 0xF7, 0xFA, 0x6A, 0xEA, 0x69, 0xF6, 0x9F, 0x7F, 0x7F, 0x7F, 0x69,
+    0xF6, 0x9F, 0x6A, 0xEA, 0x6A, 0xE9, 0x6F, 0x69, 0xF6, 0xF9, 0x6F, 0x6F, 0x95, 0x9F, 0x6F, 0x95,
+    0xFA, 0x5F, 0xA6, 0x9D, 0xA7, 0x19, 0x70, 0x77, 0x2E, 0x5C, 0xA1, 0xEA, 0x3A, 0xDA, 0x0E, 0x4F,
+    0xAD, 0x95, 0xAF, 0xFC, 0x4A, 0xFE, 0x19, 0xAF, 0xC9, 0xE1, 0xF9, 0xD9, 0x19, 0x1A, 0xD9, 0x0E,
+    0x5A, 0x91, 0xE9, 0x70, 0xDA, 0x30, 0x59, 0x99, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE,
+    0x72, 0xAE, 0x5A, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99,
+    0xAE, 0x99, 0x99, 0x95, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x77, 0x40, 0x39,
+    0xA9, 0x4F, 0xA3, 0xFC, 0x3A, 0xF3, 0xAE, 0xA3, 0xF9, 0x3F, 0x3A, 0xE9, 0x3E, 0xA3, 0xEA, 0x4D,
+    0xA7, 0x50, 0x09, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0x9F, 0xFD, 0x9F, 0xFD, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x00, 0x19, 0xAA, 0x91, 0xAF, 0x90, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0x29, 0xA9, 0x10,
+    0x72, 0xF7, 0x2A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xEA, 0x72, 0xF7,
+    0x2A, 0xEA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x72, 0xAE,
+    0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xA7, 0x2F, 0x72, 0xAE, 0xA7, 0x2F,
+    0x72, 0xAF, 0x72, 0x99, 0x99, 0x73, 0x59, 0xAE, 0xA9, 0x71, 0x9F, 0xFC, 0xA6, 0xAF, 0xFF, 0x49,
+    0xFF, 0xFC, 0xA3, 0xFC, 0x92, 0xAF, 0xC2, 0xAF, 0xA4, 0xFC, 0xA1, 0xFC, 0x59, 0xFC, 0x09, 0xFC,
+    0x6F, 0xC0, 0xAF, 0xA6, 0xFC, 0x9A, 0xF9, 0x6F, 0xC9, 0xFC, 0x96, 0xAF, 0x9F, 0xC9, 0x6A, 0xF9,
+    0xFC, 0x7F, 0xC9, 0xFC, 0x96, 0xFC, 0x9F, 0xC9, 0x6F, 0xC0, 0xAF, 0x96, 0xFC, 0x0A, 0xFA, 0x59,
+    0xFC, 0x09, 0xFC, 0x5A, 0xF9, 0x1F, 0xCA, 0x39, 0xFC, 0x29, 0xFC, 0xA1, 0x9F, 0xC9, 0x3F, 0xFF,
+    0xCA, 0x5F, 0xFE, 0xA7, 0x9F, 0xF9, 0x73, 0x99, 0x99, 0x70, 0x7C, 0x97, 0x19, 0xF9, 0x59, 0xAF,
+    0xDA, 0x3A, 0xFF, 0xCA, 0x3A, 0xFF, 0xC9, 0x4F, 0xFC, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A,
+    0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9,
+    0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x79, 0xFC, 0xA9, 0x92, 0x9F, 0xFF,
+    0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x5A, 0xAE, 0xA9, 0x79, 0xFF, 0xD9, 0x49, 0xFF, 0xF9, 0x29,
+    0xFD, 0xAF, 0xE2, 0xFC, 0xA2, 0x9F, 0xC9, 0x1F, 0xC4, 0xFC, 0xA1, 0xFA, 0x4A, 0xFA, 0x1A, 0xE9,
+    0x4A, 0xFA, 0x29, 0x99, 0x5F, 0xC9, 0x72, 0x9F, 0xC7, 0x3F, 0xC9, 0x72, 0xFC, 0xA7, 0x2A, 0xFC,
+    0x72, 0xAF, 0xC7, 0x2A, 0xFC, 0x72, 0xAF, 0xA7, 0x2F, 0xCA, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xA1, 0xFF, 0xFD, 0xA0, 0x39, 0xAA, 0xEA, 0x96,
+    0x9F, 0xFD, 0x93, 0xAF, 0xFF, 0x91, 0x9F, 0xCA, 0xAA, 0xFD, 0x1A, 0xF4, 0xFC, 0x19, 0xE5, 0xAF,
+    0x91, 0x9C, 0x6A, 0xF7, 0x3F, 0xC7, 0x2F, 0xC7, 0x09, 0xAF, 0xC6, 0x9A, 0xFE, 0x96, 0xAF, 0xFD,
+    0x6F, 0xFE, 0x5A, 0x92, 0x9F, 0xCA, 0x72, 0x9F, 0xC7, 0x3F, 0xC7, 0x29, 0xFC, 0x72, 0xFC, 0xA7,
+    0x09, 0xFD, 0x69, 0x9F, 0xEA, 0x1A, 0xFF, 0xFA, 0x29, 0xFF, 0xE9, 0x4A, 0xFF, 0x97, 0x99, 0x99,
+    0x99, 0x70, 0x73, 0x9A, 0xAC, 0x75, 0xAF, 0xC7, 0x49, 0xFD, 0x74, 0xFE, 0x73, 0xAF, 0xE7, 0x29,
+    0xFF, 0x72, 0xFF, 0xC7, 0x1F, 0xAF, 0xC7, 0x0A, 0xF0, 0xFC, 0x79, 0xF1, 0xFC, 0x7F, 0x91, 0xFC,
+    0x6A, 0xEA, 0x2F, 0xC5, 0x9F, 0x3F, 0xC5, 0xF4, 0xFC, 0x4F, 0xCA, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA,
+    0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x09, 0xFF, 0xFF, 0xD7, 0x2F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7,
+    0x6F, 0xC7, 0x6F, 0xC7, 0x69, 0xAA, 0xAA, 0x30, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x29,
+    0xFF, 0xF9, 0x29, 0xFF, 0xF9, 0x2A, 0xFF, 0xF9, 0x2A, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7,
+    0x3F, 0xF9, 0x7F, 0xFD, 0xA5, 0xFF, 0xF4, 0x9A, 0xAA, 0xFF, 0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9,
+    0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0x71, 0xAF, 0xCA, 0x69, 0xAF, 0xE2,
+    0xFF, 0xFC, 0x3F, 0xFE, 0xA5, 0xFF, 0xA7, 0x09, 0x99, 0x99, 0x70, 0x71, 0x9A, 0xEA, 0x71, 0xAF,
+    0xF6, 0x9F, 0xFD, 0x94, 0x9F, 0xEA, 0x96, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0xFC, 0xA7, 0x29, 0xFC,
+    0x73, 0xFC, 0x99, 0x99, 0x79, 0xFF, 0xEA, 0x4A, 0xFF, 0xFC, 0x92, 0xFF, 0xFE, 0x91, 0xFC, 0x4F,
+    0xD1, 0xFC, 0x5F, 0xC1, 0xFC, 0x5A, 0xF9, 0x0F, 0xC5, 0xAF, 0xA0, 0xFC, 0x94, 0xAF, 0x90, 0xAF,
+    0xA4, 0xAF, 0x90, 0x9F, 0xC4, 0xFC, 0x2F, 0xD9, 0x09, 0xFC, 0xA3, 0xFF, 0xFC, 0x49, 0xFF, 0xE7,
+    0xAF, 0xEA, 0x72, 0x99, 0x99, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF,
+    0xEA, 0x9F, 0xFF, 0xFA, 0xFF, 0xFE, 0xAA, 0xEA, 0x99, 0x99, 0x99, 0xFC, 0x0A, 0xE6, 0xF9, 0x0A,
+    0xDA, 0x5F, 0xC2, 0xD9, 0x4A, 0xF7, 0x3F, 0xA7, 0x2F, 0xC7, 0x2A, 0xF9, 0x72, 0xFC, 0x72, 0xAF,
+    0x97, 0x19, 0xFC, 0x72, 0xFC, 0x97, 0x2F, 0xC7, 0x2A, 0xFA, 0x72, 0xFC, 0x72, 0x9F, 0xC7, 0x2A,
+    0xFA, 0x72, 0xAF, 0x97, 0x2A, 0xF7, 0x4F, 0x75, 0x99, 0x97, 0x00, 0x59, 0xAE, 0xAA, 0x70, 0x9F,
+    0xFC, 0xA5, 0xAF, 0xFF, 0x39, 0xFC, 0x99, 0x9F, 0xCA, 0x2F, 0xC4, 0xFC, 0x2F, 0xA4, 0xFC, 0x2F,
+    0xA4, 0xFC, 0x2F, 0xC3, 0x9F, 0xA2, 0xAF, 0xC9, 0x1F, 0xC4, 0xFF, 0xF6, 0xFF, 0xCA, 0x70, 0xFF,
+    0xC9, 0x59, 0xFF, 0xE9, 0x39, 0xFA, 0x09, 0xFD, 0x92, 0xFA, 0x3F, 0xD1, 0xAF, 0x5F, 0xC9, 0x0F,
+    0xC5, 0xAF, 0xA0, 0xFC, 0x59, 0xFA, 0x0F, 0xC5, 0xFC, 0x90, 0xFD, 0x92, 0xAF, 0xC1, 0x9F, 0xFF,
+    0xD9, 0x29, 0xFF, 0xF9, 0x5A, 0xFF, 0xA7, 0x19, 0x99, 0x99, 0x60, 0x59, 0xAE, 0xA9, 0x70, 0xAF,
+    0xFC, 0x6F, 0xFF, 0x93, 0xAF, 0xFF, 0xC2, 0x9F, 0xC2, 0x9F, 0xCA, 0x1A, 0xF9, 0x39, 0xFC, 0x1F,
+    0xC5, 0xFC, 0x90, 0xFC, 0x5A, 0xFA, 0x0F, 0xC5, 0x9F, 0xA0, 0xFC, 0x94, 0x9F, 0xA0, 0xAF, 0xC4,
+    0x9F, 0xA1, 0xFD, 0x92, 0xAF, 0xA1, 0x9F, 0xFF, 0xD9, 0x29, 0xFF, 0xFC, 0x59, 0xAF, 0xFD, 0x73,
+    0xFC, 0x97, 0x2A, 0xFC, 0x72, 0xAF, 0xC7, 0x2F, 0xD9, 0x79, 0xAF, 0xDA, 0x49, 0xAF, 0xFC, 0xA5,
+    0xFF, 0xD9, 0x7F, 0xE9, 0x72, 0x99, 0x99, 0x72, 0x79, 0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0xA0,
+    0x9E, 0xA7, 0x77, 0x77, 0x73, 0x9A, 0xA9, 0x1A, 0xF9, 0x0F, 0xCA, 0x0F, 0xCA, 0x0F, 0xC2, 0x9A,
+    0x91, 0x73, 0xF9, 0x2A, 0xFC, 0x2F, 0xD2, 0xAF, 0xC3, 0xF7, 0x77, 0x77, 0x77, 0x74, 0xAA, 0x93,
+    0x9F, 0xA3, 0xFC, 0x3A, 0xF3, 0xAE, 0xA3, 0xF3, 0x9E, 0xA3, 0xAE, 0x39, 0xE9, 0x3E, 0xA4, 0xDA,
+    0x75, 0x73, 0x97, 0x39, 0xDA, 0x70, 0x9F, 0xC6, 0x9F, 0xD9, 0x49, 0xFD, 0x94, 0xAF, 0xD9, 0x4A,
+    0xFC, 0xA7, 0xFC, 0x71, 0xFD, 0x97, 0x09, 0xFD, 0x97, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x0A,
+    0xFD, 0x97, 0x0A, 0xF7, 0x3A, 0xC9, 0x77, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x75, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x09, 0x75, 0xDA, 0x72, 0xAF, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0x97,
+    0x09, 0xFD, 0x97, 0x09, 0xFC, 0xA7, 0x0A, 0xFA, 0x59, 0xAF, 0xC9, 0x49, 0xFD, 0x94, 0x9F, 0xD9,
+    0x49, 0xFD, 0x96, 0x9F, 0x97, 0x1D, 0x97, 0x77, 0x10, 0x75, 0xAF, 0xA9, 0x4A, 0xFF, 0x3F, 0xFD,
+    0x2A, 0xFF, 0xD2, 0xCA, 0x99, 0x9A, 0xFA, 0x70, 0xF7, 0x1E, 0x97, 0x0E, 0x97, 0x0E, 0xA6, 0x9A,
+    0xE9, 0x39, 0xAF, 0xD2, 0xAF, 0xFA, 0x2F, 0xFA, 0x3F, 0xDA, 0x5F, 0x97, 0xAD, 0xA7, 0x09, 0xDA,
+    0x71, 0xA9, 0x77, 0x70, 0x99, 0x70, 0x9F, 0x96, 0xFC, 0xA6, 0xFC, 0xA6, 0xAF, 0x97, 0x9A, 0x96,
+    0x73, 0x9A, 0xAF, 0xAA, 0x97, 0x71, 0x9A, 0xFF, 0xFA, 0x76, 0xFF, 0xFF, 0xC9, 0x72, 0x9F, 0xEA,
+    0xAA, 0xAA, 0xFE, 0xA7, 0x0A, 0xFC, 0xA7, 0x09, 0xFC, 0xA6, 0xAF, 0xA7, 0x4A, 0xF9, 0x49, 0xF9,
+    0x76, 0xAF, 0x4F, 0x94, 0x9A, 0xDA, 0x95, 0xF9, 0x2A, 0xEA, 0x39, 0xFF, 0x49, 0xEA, 0x2F, 0x3A,
+    0xFA, 0xF9, 0x4F, 0x1A, 0xEA, 0x3E, 0xA1, 0x9F, 0x4F, 0x1F, 0x93, 0xE3, 0xF4, 0xF1, 0xF5, 0x99,
+    0x3F, 0x4F, 0x1F, 0x70, 0x99, 0xAF, 0x4F, 0x09, 0xF6, 0xAF, 0xF4, 0xF0, 0x9F, 0x49, 0xFA, 0xAF,
+    0x4E, 0xA0, 0x9F, 0x4F, 0x2F, 0x3A, 0xE9, 0x09, 0xF3, 0x9E, 0xA2, 0xF3, 0xF1, 0x9F, 0x39, 0xF1,
+    0xAF, 0xA9, 0x9F, 0x3F, 0x93, 0xFF, 0xFF, 0xC9, 0x3F, 0xA3, 0xAF, 0xD0, 0xAF, 0xE5, 0xAF, 0x49,
+    0xAD, 0xA2, 0x9A, 0xAA, 0xA7, 0x0F, 0xC7, 0x77, 0x1A, 0xFA, 0x77, 0x71, 0xFD, 0x75, 0x9C, 0x71,
+    0xFD, 0xA9, 0x79, 0xAE, 0x72, 0xAF, 0xFC, 0xAA, 0xFF, 0x73, 0x9F, 0xFF, 0xFA, 0x76, 0x9A, 0xFF,
+    0xEA, 0x77, 0x49, 0x99, 0x99, 0x99, 0x73, 0x74, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77,
+    0x3F, 0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E,
+    0xA0, 0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE,
+    0x3A, 0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70,
+    0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79,
+    0xFC, 0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF,
+    0xCA, 0x3A, 0xFF, 0xD0, 0x69, 0x99, 0x97, 0x09, 0xAF, 0xFF, 0x94, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF,
+    0x5F, 0xC2, 0x9F, 0xC9, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFA,
+    0x4F, 0xC3, 0x9F, 0x5F, 0xCA, 0xA9, 0x9F, 0x95, 0xFF, 0xFC, 0x6F, 0xFF, 0xD9, 0x4F, 0xCA, 0xAA,
+    0xFE, 0x93, 0xFC, 0x4F, 0xD3, 0xFC, 0x5F, 0xC3, 0xFC, 0x5F, 0xC3, 0xFC, 0x5F, 0xC3, 0xFC, 0x5F,
+    0xC3, 0xFC, 0x4A, 0xFC, 0x3F, 0xC9, 0x19, 0xFD, 0x91, 0xAF, 0xFF, 0xEA, 0x1A, 0xFF, 0xFE, 0x92,
+    0xFF, 0xFC, 0xA9, 0x77, 0x70, 0x71, 0x99, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0xA9, 0x5A, 0xFF, 0xFC,
+    0x4F, 0xFF, 0xE3, 0xFD, 0xA9, 0x19, 0xAF, 0x2A, 0xFC, 0x6F, 0x2F, 0xC7, 0xEA, 0x1A, 0xFA, 0x7A,
+    0xD9, 0x1F, 0xC9, 0x70, 0x93, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC,
+    0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xE7, 0x49, 0xFE, 0xA6,
+    0x9A, 0x91, 0xAF, 0xFF, 0xF9, 0x2F, 0xFF, 0xF4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9, 0x72, 0x99,
+    0x99, 0x99, 0x40, 0x69, 0x99, 0x97, 0x49, 0xAF, 0xFF, 0xCA, 0x96, 0xFF, 0xFF, 0xD9, 0x4A, 0xFF,
+    0xFF, 0xE6, 0xFC, 0x92, 0x9F, 0xF5, 0xFC, 0x94, 0x9F, 0xDA, 0x4F, 0xC9, 0x6F, 0xD4, 0xFC, 0x96,
+    0x9F, 0xCA, 0x3F, 0xC9, 0x7F, 0xD3, 0xFC, 0x97, 0xAF, 0xC3, 0xFC, 0x97, 0x9F, 0xC3, 0xFC, 0x97,
+    0x9F, 0xC3, 0xFC, 0x97, 0x0F, 0xC3, 0xFC, 0x97, 0x9F, 0xC3, 0xFC, 0x97, 0x9F, 0xC3, 0xFC, 0x97,
+    0xAF, 0xA3, 0xFC, 0x97, 0xFC, 0x93, 0xFC, 0x96, 0x9F, 0xC4, 0xFC, 0x96, 0xFC, 0x94, 0xFC, 0x95,
+    0xFD, 0x5F, 0xCA, 0x99, 0x9A, 0xFE, 0x4A, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xEA, 0x95, 0xFF, 0xFC,
+    0xA9, 0x77, 0x77, 0x00, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC,
+    0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC,
+    0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC,
+    0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9,
+    0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF,
+    0xFF, 0xD9, 0x00, 0xAF, 0xFF, 0xF0, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xF9, 0x2F, 0xCA, 0x99, 0xAA,
+    0xAE, 0x92, 0xFC, 0x94, 0xE9, 0x2F, 0xC9, 0x4E, 0x92, 0xFC, 0x94, 0xAD, 0x3F, 0xC9, 0x73, 0xFC,
+    0x97, 0x3F, 0xC9, 0x73, 0xFD, 0xAA, 0xAA, 0xDA, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC, 0x4F, 0xDA, 0xAA,
+    0xAA, 0xA9, 0x4F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC,
+    0xA7, 0x19, 0xFF, 0xC9, 0x5A, 0xFF, 0xE5, 0xFF, 0xEA, 0x50, 0x71, 0x99, 0xAA, 0xA9, 0x97, 0x49,
+    0xFF, 0xEA, 0x79, 0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xEA, 0x4A, 0xFD, 0x93, 0x9F, 0xA3, 0x9F, 0xC9,
+    0x69, 0xEA, 0x3F, 0xC9, 0x79, 0xE9, 0x29, 0xFC, 0x71, 0xE3, 0xFC, 0x97, 0x19, 0x94, 0xFC, 0x77,
+    0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x0A, 0xFC, 0x77, 0x0A, 0xFC, 0x59, 0xFF, 0xC0, 0xAF, 0xC5,
+    0xAF, 0xFC, 0x0A, 0xFC, 0x6F, 0xFA, 0x09, 0xFC, 0x97, 0x0F, 0xC2, 0xFD, 0x70, 0xAF, 0x2F, 0xDA,
+    0x7A, 0xF2, 0x9F, 0xDA, 0x6A, 0xF3, 0xAF, 0xFA, 0x99, 0xAA, 0xFC, 0x4F, 0xFF, 0xFD, 0x5A, 0xFF,
+    0xFF, 0x7A, 0xFF, 0xEA, 0x74, 0x99, 0x99, 0x99, 0x70, 0xAF, 0xFD, 0x92, 0xFF, 0xE0, 0xFF, 0xE9,
+    0x2F, 0xFE, 0x0A, 0xFF, 0xC9, 0x3A, 0xFF, 0xC9, 0x3F, 0xCA, 0x79, 0xFC, 0x95, 0xFC, 0x97, 0x0F,
+    0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F,
+    0xC6, 0xFC, 0xA7, 0x9F, 0xC6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFC, 0xA7,
+    0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97,
+    0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0xA7, 0x0F, 0xC9, 0x39, 0xFF, 0xA4, 0xAF, 0xFA, 0x0A,
+    0xFF, 0xD9, 0x2F, 0xFE, 0x0F, 0xFE, 0x92, 0xFF, 0xE0, 0xAF, 0xFD, 0xAF, 0xFE, 0x9A, 0xFF, 0xCA,
+    0x3F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x5F, 0xCA, 0x39, 0xFF, 0xC9, 0xAF, 0xFD, 0xAF, 0xFE, 0x90, 0x2F, 0xFE, 0x92, 0xFF, 0xE9, 0x2F,
+    0xFD, 0xA6, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9,
+    0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70,
+    0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0xC7,
+    0x09, 0xFC, 0x70, 0xAF, 0xA7, 0x0F, 0xC9, 0x7F, 0xD6, 0xAF, 0xD5, 0x9F, 0xE9, 0x6F, 0xD9, 0x70,
+    0xAC, 0xA9, 0x70, 0xAF, 0xFD, 0x2F, 0xFC, 0x9F, 0xFE, 0x19, 0xFF, 0xC0, 0xAF, 0xFA, 0x39, 0xFD,
+    0xA4, 0xFC, 0x95, 0xFC, 0x6F, 0xC9, 0x4F, 0xC7, 0xFC, 0x93, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0x71,
+    0xFC, 0x91, 0xFA, 0x72, 0xFC, 0x90, 0xFA, 0x73, 0xFC, 0x9F, 0xA7, 0x4F, 0xFD, 0x75, 0xFF, 0xDA,
+    0x74, 0xFC, 0xAF, 0xCA, 0x73, 0xFC, 0x9A, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xD9, 0x71, 0xFC, 0x91,
+    0xFD, 0x71, 0xFC, 0x91, 0x9F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFD, 0x7F, 0xC9, 0x3A, 0xFD, 0x95, 0xFC,
+    0x94, 0xFE, 0x92, 0x9F, 0xFA, 0x3F, 0xEA, 0x0A, 0xFF, 0xD9, 0x3F, 0xFF, 0xFE, 0x5A, 0xFC, 0x77,
+    0x39, 0xA9, 0x10, 0xAF, 0xFD, 0x97, 0xFF, 0xE9, 0x7A, 0xFF, 0xC9, 0x73, 0xFC, 0xA7, 0x5F, 0xC9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75,
+    0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xAC, 0x93, 0xFC, 0x96,
+    0xE3, 0xFC, 0x95, 0x9E, 0x3F, 0xC9, 0x5F, 0x3F, 0xCA, 0x99, 0x99, 0xAA, 0xF1, 0x9F, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x2F, 0xFC, 0x7F, 0xFA, 0x4F, 0xFC, 0x69, 0xFF,
+    0xC4, 0x9F, 0xFA, 0x5A, 0xFF, 0x96, 0xFF, 0x5F, 0xEA, 0x70, 0xFF, 0x49, 0xFE, 0xA7, 0x0F, 0xF9,
+    0x3A, 0xFE, 0xA7, 0x0E, 0x9F, 0xA3, 0xE9, 0xFC, 0x70, 0xE9, 0xAF, 0x3E, 0x0F, 0xC7, 0x9E, 0x99,
+    0xF2, 0xAE, 0x0F, 0xC7, 0x9E, 0x1F, 0x91, 0xEA, 0x0A, 0xF7, 0xAE, 0x1F, 0xC1, 0xE1, 0xAF, 0x7A,
+    0xE1, 0x9F, 0x09, 0xE1, 0xAF, 0x96, 0xF2, 0xF9, 0xAD, 0xA1, 0x9F, 0x96, 0xF2, 0xFA, 0xE2, 0x9F,
+    0x96, 0xF2, 0x9F, 0xE2, 0x9F, 0xA6, 0xF3, 0xFD, 0xA3, 0xFA, 0x6E, 0xA3, 0xFD, 0x4F, 0xA5, 0x9E,
+    0xA3, 0x9F, 0xC4, 0xFC, 0x59, 0xEA, 0x4F, 0xA4, 0xFC, 0x5A, 0xE9, 0x4A, 0xE9, 0x4F, 0xC4, 0xAF,
+    0xCA, 0xA2, 0x9E, 0x39, 0xFF, 0x90, 0xFF, 0xC9, 0x70, 0x9F, 0xFC, 0xA9, 0xFF, 0xC7, 0x19, 0xFF,
+    0xC9, 0x0F, 0xF6, 0x9F, 0xFC, 0x90, 0xFF, 0xC5, 0xAF, 0xFC, 0x90, 0xAF, 0xF9, 0x49, 0xFF, 0x93,
+    0x9F, 0xE7, 0xAE, 0xA6, 0xFF, 0x6A, 0xEA, 0x6F, 0xFA, 0x5A, 0xEA, 0x6F, 0xFC, 0x5A, 0xEA, 0x6F,
+    0xFD, 0x4A, 0xEA, 0x6F, 0xAF, 0xCA, 0x3A, 0xEA, 0x6F, 0x0F, 0xD9, 0x2A, 0xEA, 0x6F, 0x1F, 0xD2,
+    0xAE, 0xA6, 0xF1, 0xAF, 0xCA, 0x1A, 0xEA, 0x6F, 0x2F, 0xD9, 0x0A, 0xEA, 0x6F, 0x3F, 0xD0, 0xAE,
+    0xA6, 0xF3, 0x9F, 0xDA, 0xEA, 0x6F, 0x4F, 0xFD, 0xA6, 0xF5, 0xFF, 0xCA, 0x6F, 0x59, 0xFF, 0xA6,
+    0xF6, 0xAF, 0xEA, 0x6F, 0x7F, 0xEA, 0x4A, 0xFE, 0x94, 0x9F, 0xDA, 0x3F, 0xFD, 0x5A, 0xFC, 0xA3,
+    0xFF, 0xD6, 0xFC, 0x97, 0x75, 0xA9, 0x50, 0x71, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF,
+    0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F,
+    0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99,
+    0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC,
+    0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD,
+    0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A,
+    0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97,
+    0x10, 0x79, 0x99, 0x96, 0x9A, 0xFF, 0xFC, 0x92, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x3F, 0xC9,
+    0x1A, 0xFD, 0x92, 0xFC, 0x93, 0xFC, 0xA2, 0xFC, 0x93, 0xAF, 0xC2, 0xFC, 0x93, 0x9F, 0xC2, 0xFC,
+    0x93, 0x9F, 0xC2, 0xFC, 0x93, 0xAF, 0xA2, 0xFC, 0x93, 0xFC, 0x92, 0xFC, 0x92, 0xFD, 0x3F, 0xCA,
+    0xAF, 0xE4, 0xFF, 0xFC, 0x5F, 0xFE, 0x96, 0xFD, 0xAA, 0x97, 0x1F, 0xC9, 0x74, 0xFC, 0x97, 0x4F,
+    0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC9, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFD, 0xA6, 0xFF, 0xEA, 0x60,
+    0x71, 0x99, 0xA9, 0x97, 0x70, 0xAF, 0xFC, 0xA7, 0x3A, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6,
+    0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x49, 0xFC, 0x6A, 0xFD, 0x4F, 0xC9, 0x7F, 0xD9, 0x2A, 0xFA, 0x71,
+    0xFD, 0x2F, 0xC9, 0x71, 0xFD, 0x2F, 0xC7, 0x2A, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0x9F,
+    0xC7, 0x29, 0xFC, 0x90, 0xAF, 0xC7, 0x3F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC, 0x90, 0xAF, 0xC7, 0x29,
+    0xFC, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x19, 0xFC, 0xA7, 0x1A, 0xFA, 0x2F, 0xD7, 0x1F, 0xC9, 0x2A,
+    0xFC, 0xA7, 0x9F, 0xC3, 0x9F, 0xD9, 0x59, 0xFC, 0x5A, 0xFE, 0x99, 0x09, 0xAF, 0xC9, 0x6F, 0xFF,
+    0xFA, 0x70, 0xAF, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0x97, 0x79, 0xFC, 0x77, 0x39, 0xFC, 0xA7, 0x73,
+    0xFD, 0xA9, 0x77, 0x1A, 0xFF, 0xEA, 0x74, 0x9F, 0xFE, 0x76, 0xAF, 0xF9, 0x77, 0x09, 0xAF, 0xA7,
+    0x77, 0x10, 0x79, 0x99, 0x97, 0x29, 0xAF, 0xFF, 0xA9, 0x6F, 0xFF, 0xFA, 0x5A, 0xFF, 0xFF, 0xC7,
+    0xFC, 0x91, 0x9F, 0xD9, 0x6F, 0xC4, 0xFD, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x49,
+    0xFC, 0x6F, 0xC4, 0xAF, 0xA6, 0xFC, 0x39, 0xFC, 0x7F, 0xC9, 0x09, 0xFD, 0x97, 0xFF, 0xFC, 0x97,
+    0x0F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x2F, 0xC9, 0x9F, 0xC7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1F, 0xC2,
+    0xFC, 0xA7, 0x0F, 0xC3, 0xFC, 0xA7, 0xFC, 0x39, 0xFC, 0xA6, 0xFC, 0x4A, 0xFD, 0x39, 0xFF, 0xA2,
+    0xFE, 0x90, 0xAF, 0xFD, 0x3F, 0xEA, 0xFF, 0xE4, 0xAF, 0xC7, 0x72, 0x9A, 0xA1, 0x69, 0x9A, 0xA9,
+    0x97, 0x9F, 0xFD, 0x93, 0xAF, 0xFF, 0x2A, 0xFF, 0xFC, 0x2F, 0xC9, 0x3F, 0x1A, 0xF9, 0x4A, 0xE1,
+    0xFC, 0x5A, 0xE1, 0xFC, 0x94, 0x9D, 0x91, 0xFD, 0x72, 0xAF, 0xDA, 0x70, 0x9F, 0xFA, 0x7A, 0xFF,
+    0xCA, 0x6A, 0xFF, 0xD9, 0x59, 0xFF, 0xD9, 0x69, 0xFF, 0xC7, 0x1A, 0xFD, 0xA0, 0x9A, 0xA5, 0x9F,
+    0xCA, 0x0E, 0x69, 0xFA, 0x9E, 0x95, 0x9F, 0xA9, 0xF5, 0xAF, 0x99, 0xFC, 0x39, 0xFC, 0x1F, 0xFF,
+    0xD9, 0x1F, 0xFF, 0xC9, 0x29, 0xFF, 0xDA, 0x79, 0x9A, 0xAA, 0x99, 0x50, 0x0F, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xAA, 0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x0F,
+    0x3F, 0xC9, 0x29, 0xE9, 0x0E, 0xA3, 0xFC, 0x92, 0x9E, 0x90, 0xE9, 0x3F, 0xC9, 0x29, 0xE2, 0xAA,
+    0x4F, 0xC9, 0x3A, 0xA9, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97,
+    0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x59, 0xAF, 0xFC, 0x97, 0x2F, 0xFE, 0xA7, 0x19,
+    0xFF, 0xE9, 0x40, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3,
+    0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC,
+    0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC,
+    0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC,
+    0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6,
+    0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF,
+    0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10, 0x0F, 0xFD, 0xA2, 0x9F, 0xFC, 0x09, 0xFF, 0xDA, 0x2A,
+    0xFF, 0xC1, 0xFF, 0xCA, 0x4A, 0xFE, 0x92, 0x9F, 0xD7, 0x0F, 0xC5, 0xFD, 0x79, 0xF9, 0x59, 0xFC,
+    0xA6, 0xAF, 0x7F, 0xD6, 0xFA, 0x7A, 0xFC, 0x59, 0xF7, 0x09, 0xFC, 0x94, 0xAF, 0x71, 0xFD, 0x4F,
+    0x97, 0x19, 0xFC, 0x39, 0xF7, 0x3F, 0xC9, 0x2A, 0xEA, 0x73, 0xAF, 0xC2, 0xF7, 0x5F, 0xC1, 0x9F,
+    0x75, 0xFC, 0x90, 0xF9, 0x75, 0x9F, 0xA0, 0xF7, 0x7F, 0xCA, 0xEA, 0x77, 0xAF, 0xF7, 0x71, 0xFF,
+    0x77, 0x1F, 0xE9, 0x77, 0x19, 0xFD, 0x77, 0x3F, 0xCA, 0x77, 0x3A, 0xF7, 0x77, 0x74, 0x0F, 0xFD,
+    0xA4, 0xAA, 0xA9, 0x49, 0xFF, 0xC1, 0xFF, 0xDA, 0x3A, 0xF4, 0xAF, 0xFC, 0x1A, 0xFF, 0xC4, 0xFC,
+    0x94, 0xFF, 0x4F, 0xD6, 0xFC, 0xA6, 0xFA, 0x5A, 0xFC, 0x94, 0x9F, 0xD5, 0x9F, 0x69, 0xFC, 0x94,
+    0xAF, 0xD5, 0xAF, 0x7F, 0xCA, 0x4F, 0xEA, 0x4F, 0xA7, 0xAF, 0xC4, 0xFF, 0x4F, 0x70, 0x9F, 0xC3,
+    0x9F, 0xF3, 0x9F, 0x71, 0xFC, 0x92, 0xAF, 0xF9, 0x2A, 0xEA, 0x71, 0xAF, 0xA2, 0xF9, 0xFA, 0x2F,
+    0x72, 0x9F, 0xC2, 0xE9, 0x0F, 0xC2, 0xF7, 0x3F, 0xC1, 0x9E, 0x1F, 0xC1, 0x9E, 0xA7, 0x3A, 0xF9,
+    0x0A, 0xE1, 0x9F, 0xA0, 0xAE, 0x74, 0x9F, 0xA0, 0xEA, 0x2F, 0xC0, 0xF7, 0x5F, 0xC0, 0xE3, 0xFC,
+    0x0E, 0xA7, 0x5A, 0xFA, 0xE3, 0x9F, 0xAE, 0x97, 0x59, 0xFE, 0xA4, 0xFF, 0x77, 0xFE, 0x94, 0xFE,
+    0xA7, 0x7A, 0xFD, 0x59, 0xFD, 0x97, 0x79, 0xFC, 0xA6, 0xFD, 0x77, 0x1F, 0xC9, 0x6F, 0xCA, 0x77,
+    0x1F, 0xC7, 0x9F, 0x97, 0x77, 0x77, 0x50, 0x09, 0xFF, 0xD9, 0x1F, 0xFC, 0x1A, 0xFF, 0xD9, 0x1F,
+    0xFC, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x93, 0x9F, 0xD5, 0x9F, 0x96, 0x9F, 0xD4, 0xFA, 0x70, 0xAF,
+    0xC9, 0x2F, 0xA7, 0x2A, 0xFC, 0x1A, 0xF7, 0x4F, 0xD9, 0xF7, 0x6F, 0xFC, 0x97, 0x69, 0xFE, 0x97,
+    0x70, 0xAF, 0xCA, 0x77, 0x19, 0xFD, 0x77, 0x1F, 0xEA, 0x77, 0xFF, 0xC9, 0x75, 0xAF, 0xAF, 0xC7,
+    0x49, 0xF1, 0xFD, 0x73, 0xF9, 0x2F, 0xCA, 0x71, 0xFC, 0x3A, 0xFC, 0x97, 0xAF, 0x5F, 0xD6, 0xAF,
+    0x96, 0xFD, 0x39, 0xFE, 0xA9, 0x29, 0xAF, 0xF9, 0x9F, 0xFD, 0x19, 0xFF, 0xEA, 0xFF, 0xCA, 0x19,
+    0xFF, 0xE0, 0x9F, 0xFD, 0x91, 0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x29, 0xFE,
+    0x92, 0x9F, 0xD6, 0xAE, 0xA5, 0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9, 0x3F, 0x71,
+    0xAF, 0xC2, 0xAE, 0x97, 0x2F, 0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9, 0xEA, 0x76,
+    0xFF, 0x77, 0xAF, 0xD9, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7,
+    0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF, 0xF7, 0x3F,
+    0xFF, 0x50, 0x1F, 0xFF, 0xEA, 0x3F, 0xFF, 0xF9, 0x19, 0xFF, 0xFF, 0xA1, 0x9F, 0xA9, 0x99, 0x99,
+    0xFD, 0x29, 0xE5, 0x9F, 0xCA, 0x29, 0xE5, 0xFD, 0x4D, 0x94, 0xAF, 0xC7, 0x49, 0xFC, 0x97, 0x4F,
+    0xD7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC, 0xA7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC,
+    0xA7, 0x4F, 0xD5, 0x9A, 0x93, 0xFD, 0x6E, 0x2A, 0xFC, 0xA5, 0x9E, 0x91, 0xFD, 0x6A, 0xE1, 0xFD,
+    0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xCA, 0x19, 0xFF, 0xFF, 0x97, 0x74,
+    0xFE, 0xAF, 0xEA, 0xFE, 0xAF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0xE9, 0xFE,
+    0xAF, 0xEA, 0x70, 0xAE, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xF7, 0x3F, 0x73, 0xAE, 0xA7, 0x3F,
+    0x73, 0xFA, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0xAE, 0xA7, 0x3F, 0x73, 0xAE,
+    0xA7, 0x29, 0xF7, 0x3F, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xEA, 0x73, 0xF7, 0x3A, 0xEA, 0x72,
+    0x9F, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0x99, 0x99, 0x00, 0x9F, 0xE0, 0xAF, 0xE0, 0x9F, 0xE4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF0, 0x9F, 0xE0, 0xAF, 0xE0, 0xAF, 0xE7, 0x10, 0x77,
+    0x6F, 0x97, 0x3F, 0xA7, 0x2A, 0xFC, 0x72, 0xFD, 0xA7, 0x09, 0xEA, 0xE7, 0x0E, 0xA0, 0xE9, 0x7E,
+    0x90, 0xF6, 0xAE, 0x1A, 0xE6, 0xEA, 0x2E, 0xA4, 0x9E, 0x92, 0xF4, 0xF3, 0x9E, 0x92, 0x9E, 0xA4,
+    0xF2, 0xAE, 0x5F, 0x2F, 0x59, 0xEA, 0x0A, 0xEA, 0x6F, 0x77, 0x10, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x19, 0x5A, 0xCA, 0x39, 0xE9, 0x29, 0xF3, 0xAF, 0x3A, 0xEA, 0x39, 0xE5, 0xAA, 0x70, 0x59,
+    0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA,
+    0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39,
+    0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF,
+    0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49, 0x99,
+    0x20, 0x59, 0x99, 0x74, 0x9A, 0xFD, 0x74, 0xFF, 0x74, 0xFF, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x19, 0xAA, 0xA9, 0x70, 0xFC, 0x9F, 0xEA, 0x6F, 0xFF, 0xDA, 0x5F, 0xFF,
+    0xE5, 0xFD, 0x91, 0xAF, 0xCA, 0x4F, 0xC4, 0xFD, 0x4F, 0xC4, 0x9F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC,
+    0x5F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC, 0x49, 0xFA, 0x4F, 0xC4,
+    0xFC, 0x94, 0xFC, 0x3A, 0xFC, 0x5F, 0xFF, 0xD5, 0x9F, 0xFF, 0xC7, 0xAF, 0xFD, 0xA7, 0x39, 0x99,
+    0x99, 0x99, 0x60, 0x6A, 0xAA, 0xA9, 0x69, 0xFF, 0x93, 0xAF, 0xFD, 0x91, 0xAF, 0xCA, 0xFC, 0xA0,
+    0x9F, 0xA2, 0xFC, 0x0F, 0xC3, 0xAE, 0xA9, 0xFA, 0x39, 0xE0, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xFC,
+    0x97, 0x0F, 0xCA, 0x70, 0xAF, 0xC7, 0x0A, 0xFC, 0x70, 0x9F, 0xD7, 0x0F, 0xEA, 0x99, 0x9A, 0xD0,
+    0x9F, 0xFF, 0xC1, 0xAF, 0xFE, 0xA2, 0x9F, 0xFC, 0xA6, 0x99, 0x99, 0x93, 0x74, 0x99, 0x99, 0x73,
+    0x9F, 0xDA, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xEA, 0x75, 0xAF, 0xA7, 0x5A, 0xFA, 0x75, 0xAF, 0xA7,
+    0x5A, 0xFA, 0x70, 0x9A, 0xAA, 0xAA, 0xFA, 0x6A, 0xFF, 0xEA, 0x5F, 0xFF, 0xCA, 0x4F, 0xEA, 0xFD,
+    0xA3, 0xAF, 0xC3, 0xAF, 0xA3, 0xFC, 0x4A, 0xFA, 0x29, 0xFA, 0x4A, 0xFA, 0x2A, 0xFA, 0x4A, 0xFA,
+    0x2A, 0xF9, 0x4A, 0xFA, 0x2F, 0xC9, 0x4A, 0xFA, 0x2F, 0xCA, 0x4A, 0xFA, 0x2A, 0xFA, 0x4A, 0xFA,
+    0x2A, 0xFC, 0x4A, 0xFA, 0x29, 0xFC, 0x93, 0xAF, 0xA3, 0xFD, 0xA9, 0x9F, 0xDA, 0x3F, 0xFF, 0xFA,
+    0x92, 0xFF, 0xCA, 0xFE, 0xA2, 0xFE, 0x90, 0xAF, 0xD9, 0x49, 0x99, 0x49, 0x99, 0x30, 0x59, 0xAA,
+    0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F,
+    0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9,
+    0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x79, 0xAA, 0xDA,
+    0x97, 0x1F, 0xFC, 0x96, 0xFF, 0xE5, 0xFD, 0xAF, 0xC4, 0x9F, 0xA2, 0xAD, 0xA4, 0xAF, 0x4A, 0xA5,
+    0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xC7, 0x1A, 0xFF, 0xF3, 0x9F, 0xFF, 0xC3, 0xAF, 0xFF, 0x96, 0x9F,
+    0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7,
+    0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x29, 0xFE, 0xA9, 0x6A, 0xFF, 0xD6,
+    0xFF, 0xE5, 0x69, 0xAA, 0xA9, 0x19, 0x9A, 0xAA, 0x5A, 0xFF, 0xFC, 0xA3, 0xFF, 0xFE, 0x92, 0xFC,
+    0xA9, 0xAF, 0xA9, 0xAC, 0x29, 0xF9, 0x29, 0xF5, 0xAF, 0x4F, 0x94, 0xAF, 0x4F, 0xA4, 0xAF, 0x4F,
+    0xA4, 0x9F, 0xA2, 0xAF, 0x95, 0xFD, 0xAF, 0xD7, 0xFF, 0xE7, 0x0F, 0xFC, 0xA7, 0x0F, 0x09, 0x99,
+    0x72, 0x9E, 0x97, 0x6A, 0xEA, 0x76, 0xAF, 0xFF, 0xCA, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x2F,
+    0xAA, 0xFF, 0xDA, 0x1F, 0xC7, 0xFA, 0x1F, 0xA6, 0x9F, 0x90, 0x9F, 0xC5, 0x9F, 0xC2, 0xFD, 0xAA,
+    0xAA, 0xFD, 0x92, 0xAF, 0xFF, 0xD9, 0x49, 0xFF, 0xEA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9, 0x96, 0x49,
+    0x99, 0x76, 0xAF, 0xD9, 0x74, 0xAF, 0xE9, 0x74, 0xAF, 0xE9, 0x77, 0xFC, 0x97, 0x7F, 0xC9, 0x77,
+    0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x29, 0xAA, 0xA9, 0x70, 0xFC, 0x09, 0xFE, 0x96, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xEA, 0x5F, 0xDA, 0x90, 0x9F, 0xD5, 0xFC, 0xA3, 0x9F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F,
+    0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F, 0xC9, 0x4F,
+    0xC5, 0xFC, 0x94, 0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x4A, 0xFC, 0xA9, 0x2A, 0xFC,
+    0xA9, 0x1F, 0xFC, 0x1A, 0xFF, 0x90, 0xFF, 0xC1, 0xFF, 0xC0, 0x49, 0x99, 0x69, 0xFA, 0x5F, 0xD5,
+    0xFD, 0x5A, 0xFA, 0x6A, 0xAA, 0x97, 0x77, 0x79, 0x99, 0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A,
+    0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD0, 0x69,
+    0x99, 0x7F, 0xC5, 0x9F, 0xCA, 0x49, 0xFC, 0xA5, 0xFC, 0x7A, 0xAA, 0x77, 0x77, 0x09, 0x99, 0xA4,
+    0xFE, 0x3A, 0xFE, 0x39, 0xFE, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6,
+    0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5, 0xFC, 0x94,
+    0xAF, 0xC3, 0x9F, 0xD9, 0x2A, 0xFD, 0xA3, 0x9F, 0xC9, 0x59, 0xAA, 0x95, 0x49, 0x99, 0x75, 0xAF,
+    0xD7, 0x4A, 0xFE, 0x74, 0xAF, 0xE7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC2, 0xFF, 0x93, 0xFC, 0x2F, 0xF9, 0x3F, 0xC3, 0xAF, 0xA5, 0xFC, 0x29, 0xF9, 0x6F, 0xC1,
+    0x9F, 0x97, 0xFC, 0x1F, 0x97, 0x0F, 0xC9, 0xF7, 0x2F, 0xFD, 0xA7, 0x1F, 0xC9, 0xFC, 0x71, 0xFC,
+    0x09, 0xFC, 0x70, 0xFC, 0x1F, 0xCA, 0x7F, 0xC2, 0xFC, 0x96, 0xFC, 0x2A, 0xFC, 0x95, 0xFC, 0x3F,
+    0xD4, 0x9F, 0xCA, 0x92, 0xFD, 0x2F, 0xFC, 0x29, 0xFD, 0x90, 0xFF, 0xC3, 0x9F, 0xC7, 0x70, 0x99,
+    0x91, 0x49, 0x99, 0x3A, 0xFD, 0x91, 0xAF, 0xE9, 0x1A, 0xFE, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC,
+    0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC,
+    0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC,
+    0x93, 0xAF, 0xDA, 0x09, 0xFF, 0xD9, 0xFF, 0xCA, 0x39, 0x9A, 0xA2, 0x9A, 0xAA, 0x95, 0x9A, 0xAA,
+    0x96, 0xAF, 0xD0, 0x9F, 0xE9, 0x19, 0xFE, 0x49, 0xFE, 0xAF, 0xFC, 0x9F, 0xFD, 0x4F, 0xFF, 0xFF,
+    0xFF, 0x95, 0xAF, 0xD9, 0x09, 0xFF, 0x90, 0xAF, 0xCA, 0x59, 0xFC, 0x4F, 0xCA, 0x3A, 0xFC, 0x59,
+    0xFA, 0x4F, 0xC4, 0x9F, 0xC5, 0x9F, 0xA4, 0xFC, 0x49, 0xFC, 0x59, 0xFA, 0x4F, 0xC4, 0x9F, 0xC5,
+    0x9F, 0xA4, 0xFC, 0x49, 0xFC, 0x59, 0xFA, 0x4F, 0xC4, 0x9F, 0xC5, 0x9F, 0xA4, 0xFC, 0x49, 0xFC,
+    0x59, 0xFA, 0x4F, 0xC4, 0x9F, 0xC5, 0x9F, 0xA4, 0xFC, 0x49, 0xFC, 0x59, 0xFA, 0x4F, 0xC4, 0x9F,
+    0xC4, 0x9F, 0xD9, 0x29, 0xFC, 0xA3, 0xAF, 0xCA, 0x91, 0xAF, 0xF1, 0x9F, 0xF1, 0xFF, 0xC1, 0xFF,
+    0xC1, 0xAF, 0xEA, 0x1F, 0xFC, 0x00, 0x39, 0x9A, 0xA2, 0x9A, 0xAA, 0xA6, 0xAF, 0xD0, 0x9F, 0xEA,
+    0x39, 0xFE, 0xAF, 0xFC, 0x93, 0xFF, 0xFF, 0xD5, 0xAF, 0xD9, 0x09, 0xFD, 0x59, 0xFC, 0x4F, 0xC9,
+    0x49, 0xFA, 0x4F, 0xC9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9,
+    0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9,
+    0x49, 0xFA, 0x4A, 0xF9, 0x39, 0xFD, 0x92, 0x9F, 0xDA, 0x1A, 0xFF, 0x90, 0x9F, 0xFA, 0x0F, 0xFC,
+    0x90, 0x9F, 0xFA, 0x59, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95, 0xFF, 0xFA, 0x3F, 0xFF, 0xD9,
+    0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA, 0xAF, 0xA5, 0xFC, 0xAA, 0xFA,
+    0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5, 0xAF, 0x9A, 0xFC, 0x5F, 0xC0,
+    0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA5, 0x9F,
+    0xFA, 0x72, 0x99, 0x99, 0x96, 0x39, 0xAA, 0x92, 0x9A, 0xAA, 0x94, 0xAF, 0xC9, 0x0F, 0xF2, 0xAF,
+    0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0xCA, 0x3F, 0xD9, 0x1A, 0xFD, 0x3F, 0xC9, 0x3A, 0xFC, 0x3F, 0xC5,
+    0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92,
+    0xFC, 0x5F, 0xC3, 0xFC, 0x5F, 0xC3, 0xFC, 0x4A, 0xF9, 0x3F, 0xC9, 0x2A, 0xFC, 0x4F, 0xFF, 0xD9,
+    0x4F, 0xFF, 0xC9, 0x5F, 0xFE, 0xA7, 0xFC, 0xA9, 0x99, 0x97, 0x1F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7,
+    0x6F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xD7, 0x19, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x59,
+    0xAA, 0xAA, 0xA9, 0x97, 0x0A, 0xFF, 0xE9, 0x4F, 0xFF, 0xCA, 0x3F, 0xFF, 0xDA, 0x2A, 0xFC, 0x3A,
+    0xFA, 0x2F, 0xC4, 0xAF, 0xA1, 0x9F, 0xC4, 0xAF, 0xA1, 0xAF, 0xA4, 0xAF, 0xA1, 0xAF, 0xA4, 0xAF,
+    0xA1, 0xFC, 0x94, 0xAF, 0xA1, 0xFC, 0xA4, 0xAF, 0xA1, 0xAF, 0xA4, 0xAF, 0xA1, 0xAF, 0xC4, 0xAF,
+    0xA1, 0x9F, 0xC9, 0x3F, 0xCA, 0x2F, 0xDA, 0x9A, 0xFD, 0xA2, 0xAF, 0xFF, 0xDA, 0x3F, 0xFF, 0xDA,
+    0x4A, 0xFD, 0x99, 0xFA, 0x79, 0x3A, 0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0xA7, 0x4A,
+    0xFA, 0x72, 0xAF, 0xF9, 0x79, 0xFF, 0xC9, 0x70, 0x99, 0x99, 0x99, 0x99, 0x90, 0x39, 0x9A, 0x92,
+    0x9A, 0xA2, 0xAF, 0xCA, 0x1F, 0xC0, 0x9F, 0xE0, 0xFD, 0x1F, 0xFF, 0xD3, 0xAF, 0xFD, 0x93, 0x9F,
+    0xCA, 0x29, 0x49, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F,
+    0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x70, 0x9F, 0xEA, 0x5F, 0xFE, 0x4F, 0xFD, 0xA3,
+    0x49, 0xAA, 0xAA, 0x96, 0x9F, 0xFC, 0x92, 0xAF, 0xFE, 0x19, 0xF9, 0x19, 0xF1, 0xAE, 0xA3, 0x9E,
+    0x1F, 0xA4, 0xDA, 0x1F, 0xD9, 0x29, 0x92, 0xAF, 0xEA, 0x6F, 0xFC, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF,
+    0xC6, 0x9F, 0xE1, 0xAC, 0xA3, 0x9F, 0xC9, 0x9E, 0x49, 0xF9, 0x9E, 0x93, 0x9F, 0x09, 0xFC, 0x99,
+    0xAF, 0xA1, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x50, 0x59, 0xA9, 0x72, 0xF7, 0x1A,
+    0xF7, 0x1F, 0xC7, 0x1F, 0xC6, 0x9A, 0xFF, 0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA3, 0x9F, 0xC7, 0x09,
+    0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC,
+    0x70, 0x9F, 0xC7, 0x1F, 0xC7, 0x1F, 0xD9, 0x9A, 0xA9, 0x3F, 0xFD, 0x93, 0xAF, 0xFC, 0x94, 0xAF,
+    0xE9, 0x79, 0x99, 0x93, 0x59, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29,
+    0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9,
+    0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x77, 0x59,
+    0xFF, 0xCA, 0x1A, 0xFE, 0x90, 0xFF, 0xC9, 0x1A, 0xFE, 0x2F, 0xDA, 0x49, 0xFA, 0x4F, 0xCA, 0x5F,
+    0x5A, 0xFC, 0x4A, 0xEA, 0x6F, 0xC4, 0xF9, 0x6A, 0xFA, 0x29, 0xF7, 0x9F, 0xC2, 0xAE, 0x97, 0x0F,
+    0xC2, 0xF7, 0x19, 0xF9, 0x09, 0xE9, 0x72, 0xFC, 0x0F, 0x73, 0xAF, 0x9E, 0xA7, 0x4F, 0xF7, 0x5A,
+    0xFD, 0xA7, 0x59, 0xFD, 0x77, 0xFD, 0x77, 0x9F, 0x97, 0x77, 0x50, 0x77, 0x76, 0xFF, 0xC3, 0xEA,
+    0x3F, 0xE9, 0x0F, 0xFC, 0x3F, 0x29, 0xFE, 0x2F, 0xD9, 0x3A, 0xF4, 0xAF, 0x4F, 0xC4, 0xFC, 0x93,
+    0xAE, 0x94, 0xFC, 0x4F, 0xCA, 0x3F, 0x59, 0xFA, 0x29, 0xFD, 0x3E, 0xA6, 0xFC, 0x2F, 0xE2, 0x9E,
+    0x96, 0xAF, 0x2F, 0xE9, 0x1A, 0xE7, 0x9F, 0x90, 0x9D, 0x99, 0xEA, 0x1E, 0xA7, 0x0F, 0xA0, 0xAD,
+    0x1F, 0x09, 0xE7, 0x1A, 0xF0, 0xE1, 0xF9, 0xAE, 0x71, 0x9F, 0x9D, 0xA1, 0xAE, 0xAE, 0x97, 0x2F,
+    0xE9, 0x2F, 0xE7, 0x3A, 0xFD, 0x3F, 0xDA, 0x74, 0xFC, 0xA3, 0xAF, 0xC9, 0x74, 0xFC, 0x93, 0x9F,
+    0xC7, 0x59, 0xF5, 0xFA, 0x77, 0x77, 0x40, 0x77, 0x5F, 0xFC, 0x1F, 0xEA, 0x1F, 0xF9, 0x19, 0xFD,
+    0x92, 0x9F, 0xCA, 0x3A, 0xEA, 0x59, 0xFC, 0x29, 0xEA, 0x79, 0xFC, 0x1F, 0x71, 0x9F, 0xAF, 0x73,
+    0xAF, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xC7, 0x6F, 0xE7, 0x4F, 0xFA, 0x72, 0xAE, 0x99, 0xFA, 0x70,
+    0xAE, 0xA1, 0xAF, 0xA6, 0xAF, 0x3F, 0xC9, 0x4A, 0xF9, 0x3A, 0xFC, 0xA9, 0x09, 0xFF, 0x1F, 0xFC,
+    0x0A, 0xFE, 0xA1, 0xFF, 0xC0, 0x77, 0x59, 0xFF, 0xCA, 0x1A, 0xFE, 0x90, 0xFF, 0xC9, 0x1A, 0xFE,
+    0x2F, 0xDA, 0x49, 0xFA, 0x4F, 0xCA, 0x5F, 0x5A, 0xFC, 0x4A, 0xEA, 0x6F, 0xC4, 0xF7, 0xAF, 0xA2,
+    0x9F, 0x79, 0xFC, 0x2A, 0xE9, 0x70, 0xFC, 0x2F, 0x71, 0x9F, 0x90, 0x9E, 0x97, 0x2F, 0xA0, 0xF7,
+    0x3A, 0xF9, 0xEA, 0x74, 0xFF, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0xAF, 0xC7, 0x79, 0xF9, 0x77,
+    0x0F, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x59, 0xAF, 0xC7, 0x2A, 0xFF, 0xC9, 0x72, 0x9F, 0xF9, 0x74,
+    0xFE, 0x76, 0x9A, 0xAA, 0xA7, 0x70, 0x77, 0x2F, 0xFF, 0xC9, 0x19, 0xFF, 0xFD, 0x19, 0xFF, 0xFC,
+    0xA1, 0x9E, 0x3A, 0xFC, 0x29, 0xD9, 0x29, 0xFC, 0x4D, 0x3F, 0xC9, 0x71, 0xFC, 0xA7, 0x1F, 0xD7,
+    0x1A, 0xFC, 0x71, 0x9F, 0xC7, 0x2F, 0xC9, 0x3A, 0x93, 0xFC, 0xA3, 0xAD, 0x2F, 0xD4, 0xE1, 0xAF,
+    0xC4, 0xAE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xC9, 0x77, 0x10, 0x76, 0x9F, 0xC9,
+    0x29, 0xFD, 0x91, 0x9F, 0xDA, 0x2A, 0xF5, 0xF9, 0x5F, 0x6F, 0x6F, 0x95, 0xAE, 0x95, 0xAE, 0xA5,
+    0x9F, 0x6F, 0x59, 0xF5, 0xFA, 0x39, 0xFC, 0x4F, 0xC5, 0xAF, 0xC6, 0xFA, 0x59, 0xF6, 0xF5, 0x9F,
+    0x59, 0xEA, 0x5A, 0xE9, 0x5F, 0x95, 0xF6, 0xF6, 0xF6, 0xF9, 0x59, 0xFA, 0xA9, 0x3F, 0xE9, 0x3A,
+    0xFC, 0x95, 0x99, 0x99, 0x00, 0x4F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x00, 0x74, 0xFC, 0xA5, 0xFE, 0x4A, 0xAF, 0xCA, 0x69, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF6, 0x9E, 0xA6, 0xAE, 0xA6, 0xAE, 0x96, 0xAE, 0xA6, 0x9F, 0x7F, 0xCA, 0x6F, 0xC5, 0xAF, 0xC4,
+    0x9F, 0x95, 0xAE, 0xA6, 0xAE, 0x96, 0xAE, 0xA6, 0x9E, 0xA6, 0x9F, 0x7F, 0x7F, 0x7F, 0x7F, 0x69,
+    0xF3, 0x9A, 0xAF, 0xA3, 0xFE, 0x4F, 0xCA, 0x59, 0x99, 0x96, 0x77, 0x3F, 0x94, 0xAC, 0x91, 0x9F,
+    0xE3, 0xE1, 0xFF, 0xCA, 0x9F, 0x0A, 0xEA, 0x9F, 0xFC, 0xA0, 0x9D, 0xA2, 0x9F, 0xE2, 0x9C, 0x5A,
+    0xEA, 0x77, 0x30, 0x09, 0xAC, 0xA1, 0x9F, 0xC0, 0xAF, 0xC0, 0xAF, 0xC1, 0xF7, 0x71, 0x9A, 0xC2,
+    0x9E, 0x92, 0xE9, 0x2E, 0xA2, 0xEA, 0x2F, 0x2F, 0x2F, 0x2F, 0x19, 0xF1, 0x9F, 0x19, 0xF9, 0x0A,
+    0xF9, 0x0A, 0xF9, 0x0A, 0xF9, 0x0F, 0xC1, 0xFC, 0x1F, 0x91, 0x99, 0x92, 0x77, 0x72, 0xAD, 0x76,
+    0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x39, 0xFE, 0xA6, 0x9F, 0xFE, 0x93, 0x9F, 0xFF, 0xC3,
+    0xFA, 0x0D, 0x90, 0xF9, 0x1F, 0xA1, 0xD9, 0x09, 0xE2, 0xF2, 0xD9, 0x1D, 0x91, 0xAE, 0xA2, 0xD9,
+    0x19, 0x3F, 0x92, 0xD7, 0xF9, 0x2D, 0x7F, 0x91, 0x9D, 0x7F, 0xA1, 0x9D, 0x7F, 0xA1, 0x9D, 0x7A,
+    0xF1, 0x9D, 0x79, 0xFC, 0x09, 0xD4, 0x92, 0xFF, 0xC0, 0x99, 0xE2, 0x9F, 0xFF, 0xD3, 0x9F, 0xFF,
+    0x95, 0xAF, 0xFA, 0x72, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x69, 0x70,
+    0x71, 0x9A, 0xEA, 0x97, 0x3A, 0xFF, 0x97, 0x0F, 0xFE, 0x7A, 0xF9, 0x09, 0xFA, 0x6F, 0x92, 0xAE,
+    0xA5, 0x9F, 0x39, 0xE9, 0x5F, 0xA3, 0x9D, 0xA6, 0xF9, 0x76, 0xF9, 0x75, 0x9F, 0x73, 0x99, 0x9A,
+    0xF9, 0x99, 0x99, 0xA5, 0xFF, 0xFD, 0x5F, 0xFF, 0xCA, 0x70, 0xFC, 0x76, 0xFA, 0x76, 0xF9, 0x75,
+    0x9F, 0x76, 0x9F, 0x76, 0xAE, 0xA7, 0x39, 0x99, 0xF9, 0x99, 0x99, 0x99, 0xAA, 0xD1, 0xFF, 0xFF,
+    0xD1, 0xFF, 0xFF, 0xD1, 0x9F, 0xAA, 0xFF, 0xD9, 0x29, 0xCA, 0x79, 0x99, 0x92, 0x1A, 0x73, 0x99,
+    0x2E, 0x29, 0xAA, 0xA9, 0x19, 0xD9, 0x09, 0xF9, 0xFE, 0xAF, 0x2F, 0xFF, 0xDA, 0x4F, 0xCA, 0xAF,
+    0xC9, 0x5F, 0x3A, 0xE9, 0x5E, 0xA4, 0xEA, 0x5E, 0x94, 0xF5, 0xE9, 0x4E, 0xA5, 0xF4, 0xEA, 0x5F,
+    0xA2, 0xF5, 0x9F, 0xFF, 0xA3, 0xAF, 0xFF, 0xE1, 0x9E, 0xA9, 0xFD, 0x90, 0xF1, 0x9C, 0xA7, 0x2D,
+    0x39, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFC, 0x91, 0x9F,
+    0xF1, 0xFF, 0xC2, 0x9F, 0xEA, 0x29, 0xFC, 0x95, 0xAE, 0xA5, 0xAF, 0xA5, 0xF7, 0xFC, 0x49, 0xEA,
+    0x7A, 0xFA, 0x3F, 0x71, 0xFC, 0x3E, 0xA7, 0x19, 0xF9, 0x1A, 0xE7, 0x3F, 0xC1, 0xE9, 0x70, 0xAF,
+    0xE9, 0xAF, 0xDA, 0x59, 0xFF, 0xFE, 0x96, 0x99, 0x99, 0xFE, 0x99, 0x99, 0x73, 0x9F, 0xC9, 0x73,
+    0xFF, 0xFE, 0x7F, 0xFF, 0xDA, 0x79, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0x97, 0x4F, 0xC7, 0x71, 0xFC,
+    0x77, 0x1F, 0xC7, 0x69, 0xAF, 0xFA, 0x72, 0x9F, 0xFE, 0x97, 0x19, 0xFF, 0xE5, 0x4F, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x99, 0x97, 0x77, 0x19, 0xAA, 0xA0, 0xF0,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x69, 0xAA, 0x97, 0x9F, 0xEA, 0x4A,
+    0xFF, 0xC9, 0x2A, 0xDA, 0x2F, 0xC1, 0x9E, 0x4E, 0xA1, 0xF4, 0x9D, 0x19, 0xF9, 0x70, 0xAF, 0xCA,
+    0x7A, 0xDA, 0xF9, 0x5A, 0xD0, 0xFD, 0x93, 0xAD, 0x1A, 0xFC, 0xA2, 0x9D, 0x91, 0x9F, 0xCA, 0x2E,
+    0x92, 0x9F, 0xA1, 0xAE, 0xA3, 0xAE, 0x2F, 0xCA, 0x2A, 0xDA, 0x2F, 0xD9, 0x1D, 0xA3, 0xAF, 0xCA,
+    0x0E, 0x5F, 0xC9, 0xAC, 0xA6, 0x9F, 0xDA, 0x19, 0x5F, 0xC9, 0x0E, 0x5F, 0x0A, 0xE5, 0xEA, 0x0A,
+    0xF3, 0xAE, 0x19, 0xFF, 0xE3, 0xAF, 0xFA, 0x6A, 0xFA, 0x50, 0x75, 0xEA, 0x2E, 0xA0, 0xAF, 0x1F,
+    0xC0, 0xFC, 0x1F, 0xC0, 0x9E, 0xA1, 0x9E, 0xA2, 0x95, 0x92, 0x77, 0x77, 0x09, 0xFE, 0xA9, 0x74,
+    0xAF, 0xAA, 0xAA, 0xF9, 0x71, 0xEA, 0x7A, 0xDA, 0x7E, 0x73, 0xDA, 0x5D, 0xA7, 0x5D, 0xA3, 0x9D,
+    0x4A, 0xFC, 0xA3, 0xD3, 0xD9, 0x3F, 0xF3, 0xAC, 0xA1, 0x9D, 0x3E, 0xA1, 0xAD, 0x4D, 0x1A, 0xC9,
+    0x2A, 0xDA, 0x29, 0xD4, 0xAC, 0x90, 0xD3, 0xE4, 0x95, 0x9C, 0xA0, 0xD3, 0xE7, 0x39, 0xCA, 0x0D,
+    0x29, 0xE7, 0x39, 0xD0, 0xD2, 0x9E, 0x73, 0x9C, 0xA0, 0xD2, 0x9E, 0x97, 0x29, 0xCA, 0x0A, 0xC9,
+    0x2F, 0x72, 0xAC, 0x90, 0x9C, 0xA2, 0xAF, 0xA9, 0x9A, 0xC9, 0x3D, 0x2D, 0x3F, 0xFC, 0x39, 0xD2,
+    0xAC, 0xA3, 0xAF, 0xD9, 0x3D, 0x93, 0xD9, 0x59, 0x6A, 0xD5, 0xD9, 0x73, 0xAD, 0x69, 0xDA, 0x70,
+    0x9E, 0x71, 0xFA, 0x99, 0x99, 0xAE, 0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0xA9, 0x97, 0x00,
+    0x39, 0x99, 0x96, 0xAF, 0xD4, 0xAE, 0xAE, 0xA3, 0xE1, 0x9E, 0x49, 0x92, 0xE6, 0x99, 0xAE, 0x4A,
+    0xFE, 0x3E, 0xA9, 0x9E, 0x29, 0xDA, 0x2E, 0x3E, 0x1A, 0xEA, 0xA1, 0xFF, 0xE2, 0xF9, 0x0D, 0xA7,
+    0x77, 0x99, 0x2F, 0xFD, 0x91, 0xFF, 0xD2, 0x99, 0x99, 0x99, 0x99, 0x30, 0x5A, 0x95, 0x9A, 0x59,
+    0xE9, 0x3E, 0xA3, 0xAF, 0x29, 0xF3, 0xAF, 0x29, 0xF9, 0x2F, 0xC2, 0xAF, 0x92, 0xFC, 0x91, 0xAF,
+    0xA3, 0xFA, 0x2A, 0xF4, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x94, 0xAF,
+    0x29, 0xF5, 0x9E, 0x92, 0x9F, 0x6A, 0xA5, 0xAA, 0x10, 0x76, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF,
+    0xFD, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xAA, 0x90, 0x09, 0x99, 0x99,
+    0x99, 0x91, 0xAF, 0xFC, 0x9F, 0xFD, 0x9F, 0xFD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x00, 0x69, 0x99,
+    0x99, 0x73, 0xAF, 0xEA, 0x70, 0xDA, 0x93, 0xAD, 0x95, 0xD9, 0x7D, 0x4A, 0xC0, 0x9A, 0xAA, 0xAA,
+    0x92, 0xD2, 0x9C, 0xA0, 0x9E, 0xAD, 0xA1, 0x9C, 0x91, 0xAC, 0x29, 0xD0, 0x9D, 0x2D, 0x1D, 0x29,
+    0xD0, 0x9D, 0x2A, 0xC1, 0xD2, 0x9D, 0x9D, 0x92, 0xAC, 0x1C, 0xA2, 0x9F, 0x93, 0xAC, 0x1D, 0x29,
+    0xD9, 0xD3, 0xAC, 0x1A, 0xC2, 0x9D, 0x0E, 0x2D, 0x19, 0xC9, 0x09, 0xEA, 0x0E, 0x09, 0xCA, 0x2D,
+    0x19, 0x99, 0x91, 0x99, 0x0D, 0x4D, 0x70, 0xAC, 0x94, 0x9D, 0x94, 0x9D, 0x97, 0xAF, 0xF9, 0x72,
+    0x9A, 0xAA, 0xA6, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFD, 0xA9, 0xFF, 0xDA, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x39, 0xAD, 0xA9, 0x5F, 0xF3, 0xFF, 0xD1, 0xAE, 0xA9, 0x9F, 0x90, 0xEA,
+    0x3E, 0xA0, 0xE4, 0xEA, 0x0E, 0x93, 0xEA, 0x0E, 0xA3, 0xE9, 0x0A, 0xEA, 0x9A, 0xF2, 0xFF, 0xC9,
+    0x29, 0xFE, 0x95, 0x9A, 0xAA, 0x93, 0x59, 0x99, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE,
+    0x72, 0xAE, 0x5A, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99,
+    0xAE, 0x99, 0x99, 0x95, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x73, 0x99, 0x97,
+    0x74, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xA7, 0x60, 0x77, 0x9F, 0xCA, 0x4F, 0xFC, 0x2F,
+    0xCA, 0xFA, 0x1F, 0x19, 0xF1, 0xE9, 0x2F, 0x2A, 0xA2, 0x9E, 0xA7, 0xF7, 0xF9, 0x6F, 0x96, 0xF9,
+    0x59, 0xF6, 0x9F, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x90, 0x76, 0xAF, 0xCA, 0x29, 0xFF, 0xC1, 0xF9, 0x9F, 0x90, 0xDA, 0x29, 0xE9, 0x1A, 0x3A,
+    0xE6, 0xAE, 0x93, 0x9A, 0xF9, 0x4A, 0xFD, 0xA3, 0x9A, 0xAA, 0xF9, 0x7E, 0xA6, 0x9E, 0xA5, 0x9F,
+    0x90, 0xAA, 0xAF, 0xE1, 0xFF, 0xA2, 0xAF, 0xCA, 0x97, 0x60, 0x29, 0x5D, 0x92, 0xF1, 0x9F, 0x1F,
+    0x90, 0x9E, 0x91, 0xAD, 0x93, 0xC9, 0x72, 0x29, 0x9A, 0xA6, 0x99, 0xA5, 0x9F, 0xC4, 0xFC, 0x94,
+    0xAF, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x94,
+    0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A,
+    0xF9, 0x39, 0xFC, 0x5A, 0xFA, 0x39, 0xFC, 0x5A, 0xFC, 0x3F, 0xD5, 0xAF, 0xCA, 0x1A, 0xFD, 0xA4,
+    0xAF, 0xFE, 0x9F, 0xE1, 0xFF, 0xEA, 0x0F, 0xE1, 0xFF, 0xDA, 0x19, 0xFC, 0x2F, 0xA0, 0x99, 0x95,
+    0x99, 0x93, 0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x97, 0x7F, 0xC7,
+    0x70, 0xA9, 0x97, 0x71, 0x59, 0xAF, 0xFD, 0x93, 0xAF, 0xFF, 0xC9, 0x2F, 0xFF, 0xD9, 0x2F, 0xFC,
+    0x09, 0xDA, 0x3A, 0xFF, 0xC0, 0x9D, 0xA3, 0xFF, 0xD0, 0x9D, 0xA2, 0x9F, 0xFD, 0x09, 0xDA, 0x29,
+    0xFF, 0xD0, 0x9D, 0xA2, 0x9F, 0xFD, 0x09, 0xDA, 0x29, 0xFF, 0xD0, 0x9D, 0xA2, 0x9F, 0xFD, 0x09,
+    0xDA, 0x3F, 0xFD, 0x09, 0xDA, 0x39, 0xFF, 0xC0, 0x9D, 0xA4, 0xAF, 0xF0, 0x9D, 0xA5, 0xAE, 0x9E,
+    0x09, 0xDA, 0x79, 0x1E, 0x09, 0xDA, 0x72, 0xE0, 0x9D, 0xA7, 0x2E, 0x09, 0xDA, 0x72, 0xE0, 0x9D,
+    0xA7, 0x2E, 0x09, 0xDA, 0x72, 0xE0, 0x9D, 0xA7, 0x2E, 0x09, 0xDA, 0x72, 0xE0, 0x9D, 0xA7, 0x2E,
+    0x09, 0xDA, 0x72, 0xE0, 0x9D, 0x73, 0xE7, 0x7D, 0xA7, 0x7A, 0x97, 0x00, 0x19, 0xAA, 0x91, 0xFC,
+    0x90, 0xFC, 0xA0, 0xFC, 0xA0, 0xAF, 0x29, 0x99, 0x10, 0x19, 0x92, 0x9F, 0xA0, 0x9F, 0xC2, 0x9E,
+    0x91, 0x9E, 0x2E, 0x90, 0x9E, 0x92, 0xAA, 0x30, 0x76, 0x9A, 0xC9, 0x39, 0xAF, 0xC2, 0xAF, 0xE2,
+    0x9F, 0xDA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x39, 0xAF,
+    0xDA, 0x1F, 0xFC, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x39, 0x9A, 0x99, 0x59, 0xFE, 0x4F, 0xFC,
+    0x2E, 0x91, 0x9E, 0xA0, 0x9E, 0x3A, 0xE0, 0x9E, 0x39, 0xE0, 0xAE, 0x39, 0xE0, 0x9E, 0x39, 0xE0,
+    0x9E, 0x92, 0xAD, 0xA1, 0xF9, 0x9A, 0xE3, 0xFF, 0x94, 0xAF, 0xA7, 0x77, 0x19, 0x93, 0xFF, 0xC2,
+    0xAF, 0xFA, 0x39, 0x99, 0x99, 0x99, 0x30, 0x09, 0xA5, 0x9A, 0x95, 0x9E, 0x93, 0xEA, 0x5F, 0xA2,
+    0xAF, 0x5F, 0xA2, 0xAF, 0x5F, 0xC2, 0xFC, 0x93, 0x9F, 0xC2, 0xFC, 0x4A, 0xF2, 0x9F, 0x92, 0x9F,
+    0xC2, 0xFC, 0x3F, 0xC2, 0xAF, 0x92, 0xFA, 0x2A, 0xF3, 0xAE, 0xA2, 0x9F, 0x39, 0xE9, 0x3E, 0xA5,
+    0x9A, 0x59, 0xA9, 0x50, 0x77, 0x77, 0x77, 0x59, 0xC9, 0x75, 0x9A, 0x75, 0xF7, 0x19, 0xAF, 0x73,
+    0x9E, 0x97, 0xAF, 0xE7, 0x3F, 0x70, 0x9F, 0xDA, 0x72, 0x9E, 0x97, 0x19, 0x99, 0xEA, 0x72, 0xEA,
+    0x75, 0xEA, 0x71, 0x9E, 0x76, 0xEA, 0x71, 0xEA, 0x76, 0xEA, 0x70, 0x9E, 0x77, 0xEA, 0x70, 0xE9,
+    0x59, 0xAA, 0x6E, 0xA7, 0x9E, 0x5F, 0x6E, 0xA7, 0xE9, 0x4A, 0xF6, 0xEA, 0x6A, 0xE4, 0x9F, 0xC4,
+    0x9A, 0xFA, 0x94, 0xE5, 0xFD, 0x3F, 0xFC, 0x92, 0xAD, 0xA4, 0xE9, 0xE2, 0x9F, 0xFC, 0x91, 0x9E,
+    0x4E, 0x90, 0xE7, 0x7E, 0xA3, 0xAD, 0xA1, 0xE7, 0x69, 0xE3, 0x9E, 0x2E, 0x76, 0xEA, 0x3E, 0x99,
+    0x99, 0xE9, 0x97, 0x3A, 0xE3, 0x9F, 0xFF, 0xA7, 0x2E, 0x94, 0xFF, 0xFA, 0x71, 0xF7, 0x99, 0x99,
+    0x9E, 0x99, 0x71, 0x9E, 0x97, 0x4E, 0x73, 0xF7, 0x5E, 0x72, 0x9E, 0x97, 0x59, 0x99, 0x74, 0xD7,
+    0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x49, 0xC9, 0x76, 0x9A, 0x74, 0xF7, 0x29, 0xAF, 0x72, 0x9E,
+    0x97, 0x0A, 0xFE, 0x72, 0xF7, 0x19, 0xFD, 0xA7, 0x19, 0xE9, 0x72, 0x99, 0x9E, 0xA7, 0x1F, 0x76,
+    0xEA, 0x70, 0x9E, 0x77, 0xEA, 0x70, 0xEA, 0x77, 0xEA, 0x79, 0xE7, 0x70, 0xEA, 0x7E, 0x92, 0x9A,
+    0xEA, 0x7E, 0xA6, 0x9E, 0x2F, 0xF9, 0x5E, 0xA6, 0xE9, 0x1F, 0xFD, 0x5E, 0xA5, 0xAE, 0x19, 0xEA,
+    0x1F, 0xA2, 0x9A, 0xFA, 0x93, 0xE2, 0x9E, 0x29, 0xEA, 0x1F, 0xFC, 0x91, 0xAD, 0xA3, 0xAD, 0x2A,
+    0xE9, 0x09, 0xFF, 0xC9, 0x09, 0xE7, 0x2F, 0x75, 0xEA, 0x71, 0xF9, 0x74, 0x9E, 0x71, 0xF9, 0x75,
+    0xEA, 0x70, 0xF9, 0x75, 0xAE, 0x70, 0xF9, 0x76, 0xE9, 0x69, 0xF7, 0x7F, 0x69, 0xFF, 0xE9, 0x79,
+    0xE9, 0x69, 0xFF, 0xE7, 0x0F, 0x70, 0xFF, 0xDA, 0x79, 0xE9, 0x77, 0x75, 0xD7, 0x77, 0x77, 0x76,
+    0x77, 0x77, 0x77, 0x7A, 0xC7, 0x49, 0xAE, 0xA9, 0x73, 0xE9, 0x71, 0xFF, 0xA7, 0x1A, 0xE7, 0x1F,
+    0xAF, 0xC7, 0x1E, 0xA7, 0x1E, 0x2A, 0xE9, 0x7A, 0xE7, 0x29, 0xC3, 0xAE, 0x70, 0xE9, 0x77, 0x9E,
+    0xA7, 0xAE, 0x76, 0x9F, 0xA7, 0x0E, 0x97, 0x5F, 0xE9, 0x6E, 0xA7, 0x6A, 0xFE, 0x94, 0x9E, 0x69,
+    0xAA, 0x71, 0x9E, 0xA4, 0xEA, 0x5F, 0x72, 0xEA, 0x39, 0xE5, 0xAF, 0x71, 0xFA, 0x3E, 0x94, 0x9F,
+    0xC3, 0x99, 0x9A, 0xAF, 0xC3, 0x9E, 0x5F, 0xD3, 0xFF, 0xC4, 0xE9, 0x4E, 0x9E, 0x3F, 0xEA, 0x4A,
+    0xE4, 0xE9, 0x0E, 0x49, 0x99, 0x97, 0xE9, 0x3A, 0xDA, 0x1E, 0x77, 0xEA, 0x39, 0xE2, 0xE7, 0x69,
+    0xE4, 0xE9, 0x99, 0x9E, 0x99, 0x74, 0xEA, 0x39, 0xFF, 0xFA, 0x72, 0xAE, 0x5F, 0xFF, 0xA7, 0x2E,
+    0xA7, 0x99, 0x99, 0x9E, 0x99, 0x72, 0xAE, 0x75, 0xE7, 0x39, 0xEA, 0x75, 0xE7, 0x3A, 0xE7, 0x69,
+    0x99, 0x74, 0x9C, 0x97, 0x77, 0x77, 0x76, 0x59, 0xAC, 0xA7, 0x1F, 0xC7, 0x9F, 0xC7, 0x9F, 0xC7,
+    0x0F, 0x97, 0x77, 0x76, 0x9A, 0x97, 0x19, 0xDA, 0x71, 0x9E, 0x70, 0xAF, 0x59, 0xFE, 0x4A, 0xFF,
+    0x3A, 0xFF, 0xA3, 0xFD, 0x95, 0x9E, 0xA7, 0x09, 0xE7, 0x19, 0xE7, 0x2E, 0x97, 0x1A, 0xE9, 0x49,
+    0x3F, 0xCA, 0xAA, 0xDA, 0x2A, 0xFF, 0xD3, 0xAF, 0xFC, 0x49, 0xFE, 0xA6, 0x9A, 0xDA, 0x91, 0x7A,
+    0x97, 0x76, 0x9D, 0xA7, 0x75, 0xAF, 0x97, 0x73, 0xAF, 0xCA, 0x77, 0x3A, 0xFD, 0x77, 0x49, 0xF7,
+    0x77, 0x99, 0x77, 0x77, 0x77, 0x19, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97,
+    0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7,
+    0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7,
+    0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF,
+    0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7,
+    0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF,
+    0xFD, 0x00, 0x76, 0xA7, 0x76, 0x9E, 0x77, 0x4A, 0xF9, 0x77, 0x19, 0xFD, 0x77, 0x19, 0xFD, 0x97,
+    0x71, 0xAE, 0xA9, 0x77, 0x49, 0x77, 0x77, 0x77, 0x59, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7,
+    0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77,
+    0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A,
+    0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7,
+    0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97,
+    0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F,
+    0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x72, 0xAA, 0xC7, 0x75, 0xFC, 0x97, 0x72, 0xAF, 0xD9, 0x77, 0x0A,
+    0xE9, 0xF9, 0x76, 0xAE, 0x91, 0xF7, 0x59, 0xE9, 0x3E, 0x76, 0x9A, 0x6A, 0x77, 0x77, 0x77, 0x99,
+    0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77,
+    0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0, 0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F,
+    0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A, 0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA,
+    0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC,
+    0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC, 0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF,
+    0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA, 0x3A, 0xFF, 0xD0, 0x77, 0x77, 0x1A, 0xE2, 0xAC,
+    0x77, 0xFD, 0x90, 0xDA, 0x76, 0xFF, 0xDA, 0x76, 0xDA, 0x0A, 0xFC, 0x97, 0x6A, 0xC2, 0xAE, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x19, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71,
+    0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69,
+    0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E,
+    0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F,
+    0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD,
+    0x00, 0x79, 0x94, 0x99, 0x76, 0x9F, 0x19, 0xF7, 0x5F, 0xC1, 0xAF, 0x97, 0x4F, 0xC1, 0xAF, 0x97,
+    0x49, 0xEA, 0x2F, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77,
+    0x3F, 0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E,
+    0xA0, 0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE,
+    0x3A, 0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70,
+    0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79,
+    0xFC, 0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF,
+    0xCA, 0x3A, 0xFF, 0xD0, 0x72, 0x99, 0x97, 0x74, 0x9F, 0xC9, 0x77, 0x19, 0xEA, 0xE7, 0x71, 0xE1,
+    0x9D, 0xA7, 0x70, 0xDA, 0x2D, 0xA7, 0x70, 0xE2, 0xD9, 0x77, 0x0A, 0xEA, 0xE7, 0x72, 0xFD, 0x77,
+    0x49, 0x99, 0x97, 0x77, 0x09, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71,
+    0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69,
+    0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E,
+    0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F,
+    0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD,
+    0x00, 0x71, 0xAF, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0xFC, 0x74, 0xAF, 0xFF, 0xFE, 0x76, 0xFF, 0xC9,
+    0x9A, 0xAA, 0xF7, 0x5F, 0x9F, 0xC5, 0xE7, 0x49, 0xEA, 0x9F, 0xC5, 0xE7, 0x4F, 0x09, 0xFC, 0x5A,
+    0xA7, 0x4A, 0xE9, 0x09, 0xFC, 0x77, 0x4F, 0x19, 0xFC, 0x77, 0x3A, 0xE9, 0x19, 0xFC, 0x29, 0x99,
+    0x97, 0x4F, 0x29, 0xFF, 0xF7, 0x3F, 0x92, 0x9F, 0xFF, 0x72, 0x9E, 0xA3, 0x9F, 0xFF, 0x72, 0xFC,
+    0xAA, 0xAA, 0xAF, 0xC7, 0x70, 0x9F, 0xFF, 0xE7, 0x70, 0xFF, 0xFF, 0x77, 0xAE, 0xA9, 0x99, 0x99,
+    0x9A, 0xFC, 0x6D, 0xA5, 0xF6, 0x9F, 0xC5, 0x9E, 0x4F, 0x96, 0x9F, 0xC5, 0xF3, 0x9F, 0x79, 0xFC,
+    0x99, 0x99, 0xAA, 0xF2, 0xAF, 0xDA, 0x39, 0xAF, 0xFF, 0xEA, 0x1F, 0xFC, 0x92, 0xFF, 0xFF, 0xCA,
+    0x1F, 0xFC, 0x91, 0x9F, 0xFF, 0xFC, 0x10, 0x71, 0x99, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0xA9, 0x5A,
+    0xFF, 0xFC, 0x4F, 0xFF, 0xE3, 0xFD, 0xA9, 0x19, 0xAF, 0x2A, 0xFC, 0x6F, 0x2F, 0xC7, 0xEA, 0x1A,
+    0xFA, 0x7A, 0xD9, 0x1F, 0xC9, 0x70, 0x93, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x75, 0xAF, 0xC7,
+    0x5A, 0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xE7, 0x49,
+    0xFE, 0xA6, 0x9A, 0x91, 0xAF, 0xFF, 0xF9, 0x2F, 0xFF, 0xF4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9,
+    0x72, 0x99, 0x99, 0x99, 0x76, 0x99, 0x77, 0x9F, 0xA7, 0x59, 0xFC, 0x97, 0x69, 0xE9, 0x76, 0x9E,
+    0x77, 0xEA, 0x75, 0xAE, 0xA7, 0x7A, 0xA9, 0x70, 0x5A, 0x77, 0x1E, 0x97, 0x69, 0xFA, 0x76, 0xFD,
+    0x97, 0x49, 0xFD, 0x97, 0x59, 0xAE, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x7A, 0xFF, 0xFF, 0xCA, 0x0F,
+    0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F,
+    0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F,
+    0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F,
+    0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F,
+    0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x73, 0x9A, 0x77, 0x0A, 0xD9, 0x75,
+    0x9F, 0xA7, 0x4A, 0xFC, 0xA7, 0x3F, 0xDA, 0x74, 0xF9, 0x76, 0x99, 0x77, 0x77, 0x77, 0x2A, 0xFF,
+    0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC,
+    0x95, 0xAE, 0x3F, 0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA,
+    0x39, 0x99, 0x6F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75,
+    0xFC, 0x97, 0x5F, 0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99,
+    0x9A, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x79, 0xAC, 0xA7,
+    0x69, 0xFA, 0x74, 0x9F, 0xE7, 0x3E, 0xAA, 0xEA, 0x71, 0xEA, 0x19, 0xE9, 0x7E, 0xA3, 0x9D, 0xA7,
+    0x0A, 0x95, 0x99, 0x77, 0x77, 0x74, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF,
+    0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96,
+    0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95,
+    0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E,
+    0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x49, 0x94, 0x99, 0x71, 0xF9, 0x1F, 0xA6, 0x9F, 0xA1, 0xFC, 0x69,
+    0xFA, 0x1F, 0xC7, 0xF2, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x7A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD,
+    0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F, 0xC9, 0x59,
+    0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F, 0xFF, 0xC9,
+    0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6D,
+    0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x1A, 0x71, 0xE9, 0x7F, 0xC6, 0xFD, 0x94, 0x9F,
+    0xDA, 0x59, 0xAF, 0x71, 0x99, 0x77, 0x72, 0xAF, 0xFD, 0xAF, 0xFE, 0x9A, 0xFF, 0xCA, 0x3F, 0xCA,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x39, 0xFF, 0xC9, 0xAF, 0xFD, 0xAF, 0xFE, 0x90, 0x79, 0xA7, 0x0A, 0xDA, 0x59, 0xFC, 0x4A, 0xFD,
+    0x3F, 0xE4, 0xFA, 0x69, 0x97, 0x77, 0x6A, 0xFF, 0xDA, 0xFF, 0xE9, 0xAF, 0xFC, 0xA3, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA3,
+    0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9, 0x49, 0xAC, 0xA7, 0x9F, 0xC6, 0xFE, 0x4F, 0x9F, 0x2F,
+    0x19, 0xEA, 0x0F, 0x39, 0xE1, 0xAA, 0x59, 0x97, 0x77, 0x3A, 0xFF, 0xDA, 0x0F, 0xFE, 0x90, 0xAF,
+    0xFC, 0xA4, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6,
+    0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA6,
+    0xFC, 0xA6, 0xFC, 0xA4, 0x9F, 0xFC, 0x90, 0xAF, 0xFD, 0xA0, 0xFF, 0xE9, 0x19, 0x95, 0x99, 0x2F,
+    0x91, 0xAE, 0xA1, 0xFC, 0x1F, 0xC1, 0xFC, 0x1F, 0xC1, 0xAE, 0x91, 0xAE, 0x97, 0x77, 0x77, 0x3A,
+    0xFF, 0xDA, 0x1F, 0xFE, 0x91, 0xAF, 0xFC, 0xA5, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7,
+    0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7,
+    0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA7, 0xFC, 0xA5, 0x9F, 0xFC, 0x91, 0xAF, 0xFD, 0xA1,
+    0xFF, 0xE9, 0x00, 0x79, 0x99, 0x97, 0x59, 0xAF, 0xFF, 0xCA, 0x97, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF,
+    0xFF, 0xE7, 0xFC, 0x92, 0x9F, 0xF6, 0xFC, 0x94, 0x9F, 0xDA, 0x5F, 0xC9, 0x6F, 0xD5, 0xFC, 0x96,
+    0x9F, 0xCA, 0x4F, 0xC9, 0x7F, 0xD4, 0xFC, 0x97, 0xAF, 0xC4, 0xFC, 0x97, 0x9F, 0xC1, 0xAA, 0xAF,
+    0xDA, 0xAA, 0xA3, 0x9F, 0xC1, 0xFF, 0xFC, 0x4F, 0xC1, 0xAA, 0xAF, 0xDA, 0xAA, 0xA3, 0x9F, 0xC4,
+    0xFC, 0x97, 0x9F, 0xC4, 0xFC, 0x97, 0xAF, 0xA4, 0xFC, 0x97, 0xFC, 0x94, 0xFC, 0x96, 0x9F, 0xC5,
+    0xFC, 0x96, 0xFC, 0x95, 0xFC, 0x95, 0xFD, 0x6F, 0xCA, 0x99, 0x9A, 0xFE, 0x5A, 0xFF, 0xFF, 0xA5,
+    0xAF, 0xFF, 0xEA, 0x96, 0xFF, 0xFC, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x77, 0x29, 0xEA, 0x2C, 0xA7,
+    0x70, 0xFD, 0x09, 0xD9, 0x76, 0xAF, 0xFD, 0x97, 0x6A, 0xD9, 0x9F, 0xD7, 0x70, 0xD2, 0xF7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x3F, 0xF6, 0x9F, 0xFC, 0x90, 0xFF, 0xC5, 0xAF, 0xFC, 0x90, 0xAF, 0xF9,
+    0x49, 0xFF, 0x93, 0x9F, 0xE7, 0xAE, 0xA6, 0xFF, 0x6A, 0xEA, 0x6F, 0xFA, 0x5A, 0xEA, 0x6F, 0xFC,
+    0x5A, 0xEA, 0x6F, 0xFD, 0x4A, 0xEA, 0x6F, 0xAF, 0xCA, 0x3A, 0xEA, 0x6F, 0x0F, 0xD9, 0x2A, 0xEA,
+    0x6F, 0x1F, 0xD2, 0xAE, 0xA6, 0xF1, 0xAF, 0xCA, 0x1A, 0xEA, 0x6F, 0x2F, 0xD9, 0x0A, 0xEA, 0x6F,
+    0x3F, 0xD0, 0xAE, 0xA6, 0xF3, 0x9F, 0xDA, 0xEA, 0x6F, 0x4F, 0xFD, 0xA6, 0xF5, 0xFF, 0xCA, 0x6F,
+    0x59, 0xFF, 0xA6, 0xF6, 0xAF, 0xEA, 0x6F, 0x7F, 0xEA, 0x4A, 0xFE, 0x94, 0x9F, 0xDA, 0x3F, 0xFD,
+    0x5A, 0xFC, 0xA3, 0xFF, 0xD6, 0xFC, 0x97, 0x75, 0xA9, 0x50, 0x7A, 0x77, 0x5E, 0x97, 0x73, 0xFC,
+    0x77, 0x2F, 0xD9, 0x77, 0x09, 0xFD, 0xA7, 0x71, 0x9A, 0xF7, 0x75, 0x99, 0x77, 0x77, 0x72, 0x99,
+    0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91,
+    0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9,
+    0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A,
+    0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F,
+    0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9,
+    0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x75, 0x9A, 0x77, 0x4A, 0xDA, 0x77, 0x19, 0xFC,
+    0x77, 0x0A, 0xFC, 0xA7, 0x7F, 0xE7, 0x70, 0xFA, 0x77, 0x29, 0x97, 0x77, 0x77, 0x69, 0x9A, 0x99,
+    0x77, 0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0x97, 0xAF, 0xFF, 0xEA, 0x5A, 0xFC, 0xA9, 0x19, 0xFE,
+    0x93, 0x9F, 0xC6, 0xAF, 0xD3, 0xFC, 0x97, 0xFD, 0x91, 0xAF, 0xA7, 0x1F, 0xD1, 0xFC, 0x97, 0x1F,
+    0xD1, 0xFC, 0x72, 0xAF, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0xAF, 0xC7,
+    0x3F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x29, 0xFC, 0x09, 0xFC, 0x97, 0x19, 0xFC, 0x09,
+    0xFC, 0xA7, 0x1A, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC, 0xA7, 0x9F, 0xC3, 0xFD, 0x95, 0x9F,
+    0xC9, 0x3A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x5F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFC, 0x97, 0x19, 0xFF,
+    0xDA, 0x76, 0x99, 0xAA, 0x99, 0x71, 0x71, 0x9A, 0xCA, 0x77, 0x29, 0xFC, 0x77, 0x1F, 0xE7, 0x7F,
+    0x9F, 0x75, 0xF1, 0x9E, 0xA7, 0x3F, 0x39, 0xE7, 0x4A, 0xA5, 0x99, 0x77, 0x77, 0x70, 0x99, 0xA9,
+    0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F,
+    0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71,
+    0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC,
+    0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0,
+    0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59,
+    0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F,
+    0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x77, 0x76, 0x9E, 0xA2, 0xCA, 0x75, 0xFC, 0xA0, 0xAD,
+    0x97, 0x3A, 0xFF, 0xD9, 0x73, 0xAD, 0x99, 0xFD, 0x75, 0xD2, 0xF7, 0x77, 0x77, 0x77, 0x71, 0x99,
+    0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91,
+    0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9,
+    0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A,
+    0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F,
+    0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9,
+    0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x69, 0x95, 0x99, 0x74, 0xF9, 0x1A, 0xEA, 0x72,
+    0x9F, 0xC1, 0xFC, 0x73, 0xFC, 0x1F, 0xC7, 0x3A, 0xE9, 0x1A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x99,
+    0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91,
+    0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9,
+    0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A,
+    0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F,
+    0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9,
+    0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x77, 0x0A, 0xA6, 0xC3, 0xAD, 0xA4, 0xE9, 0x09,
+    0xF9, 0x2F, 0xC1, 0x9F, 0x90, 0xFC, 0x39, 0xFF, 0xC5, 0x9F, 0xE7, 0xAF, 0xC7, 0x0F, 0xD9, 0x6F,
+    0xF9, 0x4F, 0xCA, 0xF9, 0x2A, 0xF1, 0xAF, 0x90, 0x9F, 0x3A, 0xF1, 0x9D, 0x5A, 0xD3, 0x97, 0x92,
+    0x72, 0x99, 0xA9, 0x96, 0x97, 0x1A, 0xFF, 0xCA, 0x2A, 0xCA, 0x6A, 0xFF, 0xFC, 0x9A, 0xDA, 0x5A,
+    0xFF, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x19, 0xFF, 0x59, 0xFC, 0x6A, 0xFD, 0x5F, 0xC9, 0x7F, 0xD9,
+    0x3A, 0xFA, 0x7A, 0xFE, 0x3F, 0xC9, 0x6A, 0xFF, 0x3F, 0xC6, 0xAD, 0xAA, 0xFC, 0x91, 0x9F, 0xC5,
+    0xAD, 0xA0, 0x9F, 0xC9, 0x19, 0xFC, 0x4A, 0xDA, 0x19, 0xFC, 0x91, 0xAF, 0xC3, 0xAD, 0xA3, 0xFC,
+    0x91, 0xAF, 0xC2, 0xAD, 0xA4, 0xFC, 0x91, 0xAF, 0xC1, 0xAD, 0xA4, 0x9F, 0xC2, 0x9F, 0xC9, 0xAD,
+    0xA5, 0x9F, 0xC2, 0x9F, 0xFA, 0x6A, 0xFA, 0x3F, 0xEA, 0x7F, 0xC9, 0x3A, 0xFD, 0x79, 0xFC, 0x49,
+    0xFD, 0x95, 0x9F, 0xC9, 0x5F, 0xEA, 0x92, 0xAF, 0xCA, 0x5F, 0xFF, 0xFD, 0xA5, 0xEA, 0xAF, 0xFF,
+    0xC9, 0x6D, 0xA1, 0x9F, 0xFD, 0xA7, 0x19, 0x59, 0xAA, 0xAA, 0x97, 0x20, 0x70, 0xA9, 0x77, 0x69,
+    0xDA, 0x77, 0x5A, 0xF9, 0x77, 0x3A, 0xFC, 0xA7, 0x73, 0xAF, 0xD7, 0x74, 0xAF, 0x77, 0x79, 0x97,
+    0x77, 0x77, 0x77, 0x59, 0xFF, 0xDA, 0x29, 0xFF, 0xD9, 0xFF, 0xDA, 0x2A, 0xFF, 0xD0, 0xFF, 0xCA,
+    0x39, 0xFF, 0xA3, 0xAF, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F,
+    0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F,
+    0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F,
+    0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC6, 0xFC, 0x96, 0x9F, 0xA6, 0xFD,
+    0x6F, 0xC9, 0x6A, 0xFD, 0xA9, 0x09, 0xAF, 0xD7, 0x0F, 0xFF, 0xF7, 0x2F, 0xFF, 0xD9, 0x73, 0xAF,
+    0xFD, 0xA7, 0x70, 0x9A, 0xAA, 0xA9, 0x71, 0x77, 0xA7, 0x76, 0x9E, 0x77, 0x4A, 0xF9, 0x77, 0x19,
+    0xFD, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xAE, 0xA9, 0x77, 0x49, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFF,
+    0xDA, 0x29, 0xFF, 0xD9, 0xFF, 0xDA, 0x2A, 0xFF, 0xD0, 0xFF, 0xCA, 0x39, 0xFF, 0xA3, 0xAF, 0xC7,
+    0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7,
+    0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7,
+    0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7,
+    0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC6, 0xFC, 0x96, 0x9F, 0xA6, 0xFD, 0x6F, 0xC9, 0x6A, 0xFD, 0xA9,
+    0x09, 0xAF, 0xD7, 0x0F, 0xFF, 0xF7, 0x2F, 0xFF, 0xD9, 0x73, 0xAF, 0xFD, 0xA7, 0x70, 0x9A, 0xAA,
+    0xA9, 0x71, 0x73, 0xAA, 0xC7, 0x75, 0xFC, 0x97, 0x72, 0xAF, 0xD9, 0x77, 0x0A, 0xE9, 0xF9, 0x76,
+    0xAE, 0x91, 0xF7, 0x59, 0xE9, 0x3E, 0x76, 0x9A, 0x6A, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xFD, 0xA2,
+    0x9F, 0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A,
+    0xFD, 0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97,
+    0x10, 0x70, 0x99, 0x49, 0x97, 0x69, 0xF1, 0x9F, 0x75, 0xFC, 0x1A, 0xF9, 0x74, 0xFC, 0x1A, 0xF9,
+    0x74, 0x9E, 0xA2, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD,
+    0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF, 0xFF,
+    0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10, 0x75, 0x9A, 0x77,
+    0x4A, 0xD9, 0x77, 0x19, 0xFA, 0x77, 0x0A, 0xFC, 0xA7, 0x7F, 0xDA, 0x77, 0x9F, 0x97, 0x72, 0x99,
+    0x77, 0x77, 0x77, 0x74, 0x9F, 0xFD, 0x91, 0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9,
+    0x29, 0xFE, 0x92, 0x9F, 0xD6, 0xAE, 0xA5, 0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9,
+    0x3F, 0x71, 0xAF, 0xC2, 0xAE, 0x97, 0x2F, 0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9,
+    0xEA, 0x76, 0xFF, 0x77, 0xAF, 0xD9, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71,
+    0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF,
+    0xF7, 0x3F, 0xFF, 0x50, 0xAF, 0xFD, 0x97, 0xFF, 0xE9, 0x79, 0xAF, 0xDA, 0x97, 0x4F, 0xC9, 0x75,
+    0xFC, 0xAA, 0xAA, 0x99, 0x70, 0xFF, 0xFA, 0x6F, 0xFF, 0xD9, 0x4F, 0xC9, 0x09, 0x9F, 0xD9, 0x3F,
+    0xC9, 0x3F, 0xD3, 0xFC, 0x93, 0x9F, 0xC3, 0xFC, 0x94, 0xFC, 0x92, 0xFC, 0x94, 0xFC, 0x3F, 0xC9,
+    0x4F, 0xC3, 0xFC, 0x93, 0x9F, 0xC3, 0xFC, 0x93, 0xFC, 0x93, 0xFC, 0x90, 0x9A, 0xFC, 0xA4, 0xFF,
+    0xFC, 0xA5, 0xFF, 0xEA, 0x7F, 0xCA, 0x99, 0x97, 0x2F, 0xC9, 0x74, 0xAF, 0xCA, 0xA9, 0x70, 0xAF,
+    0xFD, 0x97, 0xAF, 0xFD, 0x97, 0x70, 0x9A, 0xEA, 0x97, 0x3A, 0xFF, 0xC9, 0x70, 0xFF, 0xF9, 0x6F,
+    0xCA, 0x9A, 0xFD, 0x5A, 0xF9, 0x3F, 0xC5, 0xFA, 0x49, 0xF4, 0x9F, 0x94, 0x9F, 0x4A, 0xF5, 0xAE,
+    0xA4, 0xFC, 0x4A, 0xF5, 0xFC, 0x3A, 0xEA, 0x6F, 0xC2, 0xAE, 0x97, 0xFC, 0x19, 0xEA, 0x70, 0xFC,
+    0x1A, 0xEA, 0x70, 0xFC, 0x1A, 0xFA, 0x7F, 0xC1, 0xAF, 0xCA, 0x6F, 0xC2, 0xFE, 0x5F, 0xC2, 0x9F,
+    0xE4, 0xFC, 0x39, 0xFE, 0x3F, 0xC5, 0xFD, 0x92, 0xFC, 0x6F, 0xD2, 0xFC, 0x29, 0x3F, 0xC2, 0xFC,
+    0x1D, 0x3F, 0xC2, 0xFC, 0x0A, 0xD9, 0x2F, 0x91, 0xAF, 0xC0, 0xFA, 0xAF, 0xC0, 0x9F, 0xE0, 0xAF,
+    0xFC, 0x19, 0xFD, 0xA1, 0xFE, 0xA7, 0x69, 0x99, 0x94, 0x49, 0x77, 0xD9, 0x75, 0xAE, 0x75, 0xAF,
+    0x75, 0xFA, 0x75, 0xAE, 0xA7, 0x59, 0xE7, 0x7C, 0x97, 0x77, 0x77, 0x71, 0x9A, 0xAA, 0xA9, 0x70,
+    0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4,
+    0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC,
+    0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF,
+    0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x70, 0x97, 0x79,
+    0xD9, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xF7, 0x4A, 0xE9, 0x74, 0xE9, 0x76, 0xC9, 0x77, 0x77, 0x77,
+    0x29, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29,
+    0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA,
+    0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2,
+    0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49,
+    0x99, 0x20, 0x6A, 0xAA, 0x75, 0xFA, 0x73, 0xAF, 0xC9, 0x71, 0x9E, 0xAE, 0x71, 0xE9, 0x0F, 0x7A,
+    0xDA, 0x2E, 0x96, 0xE3, 0x9D, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF,
+    0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74,
+    0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA,
+    0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD,
+    0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x3A, 0xD9, 0x2C, 0x97, 0xFC, 0xA0, 0x9D,
+    0x95, 0x9F, 0xFD, 0x95, 0x9D, 0x99, 0xFD, 0x7D, 0x2F, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xAA,
+    0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9,
+    0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF,
+    0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29,
+    0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x77,
+    0x39, 0xE9, 0x19, 0xE9, 0x5F, 0xC1, 0xFC, 0x5F, 0xC1, 0xFC, 0x5A, 0xE9, 0x1A, 0xE9, 0x79, 0x59,
+    0x77, 0x77, 0x77, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9,
+    0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5,
+    0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA,
+    0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94,
+    0x99, 0x94, 0x99, 0x92, 0x69, 0x99, 0x74, 0xAF, 0xC7, 0x2A, 0xDA, 0xAE, 0x71, 0xD9, 0x1A, 0xD7,
+    0x09, 0xD9, 0x19, 0xD9, 0x79, 0xD9, 0x19, 0xD7, 0x1E, 0x99, 0xDA, 0x71, 0x9F, 0xD7, 0x4A, 0xCA,
+    0x97, 0x77, 0x79, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93,
+    0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A,
+    0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2,
+    0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49,
+    0x99, 0x49, 0x99, 0x20, 0x59, 0xAA, 0xA9, 0x49, 0xAA, 0xA9, 0x79, 0xAF, 0xE9, 0x09, 0xFE, 0xA4,
+    0xAF, 0xFF, 0xFF, 0xC2, 0xAF, 0xCA, 0xAF, 0xEA, 0xAA, 0xFC, 0x91, 0xFC, 0x2A, 0xFC, 0x93, 0xFC,
+    0x1F, 0x93, 0xFC, 0x4A, 0xF2, 0xAD, 0x4F, 0x94, 0xAF, 0x72, 0xFA, 0xAA, 0xAF, 0xE5, 0x9A, 0xFF,
+    0xFF, 0xD3, 0xAF, 0xFF, 0xFA, 0xAA, 0x99, 0x2F, 0xEA, 0xFA, 0x73, 0xFC, 0x92, 0xFA, 0x72, 0x9F,
+    0x93, 0xFC, 0x72, 0xAF, 0x93, 0xAF, 0xA7, 0x1A, 0xFC, 0x29, 0xFE, 0xA9, 0x99, 0x9A, 0xCA, 0x09,
+    0xFF, 0xFF, 0xFE, 0xA1, 0xFF, 0xDA, 0xAF, 0xFE, 0x92, 0xFF, 0x91, 0x9F, 0xFC, 0x95, 0x99, 0x99,
+    0x79, 0x99, 0x99, 0x40, 0x6A, 0xAA, 0xA9, 0x69, 0xFF, 0x93, 0xAF, 0xFD, 0x91, 0xAF, 0xCA, 0xFC,
+    0xA0, 0x9F, 0xA2, 0xFC, 0x0F, 0xC3, 0xAE, 0xA9, 0xFA, 0x39, 0xE0, 0xAF, 0x97, 0x0A, 0xF9, 0x70,
+    0xFC, 0x97, 0x0F, 0xCA, 0x70, 0xAF, 0xC7, 0x0A, 0xFC, 0x70, 0x9F, 0xD7, 0x0F, 0xEA, 0x99, 0x9A,
+    0xD0, 0x9F, 0xFF, 0xC1, 0xAF, 0xFE, 0xA2, 0x9F, 0xFC, 0xA6, 0x99, 0x99, 0x97, 0x29, 0x99, 0x72,
+    0xFC, 0x71, 0xFC, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x1A, 0xE7, 0x1F, 0x72, 0xAA, 0x95, 0x49, 0x75,
+    0x9D, 0x74, 0xEA, 0x73, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF7, 0x4E, 0x97, 0x49, 0xC7, 0x77, 0x77,
+    0x39, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90,
+    0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF,
+    0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19,
+    0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x71,
+    0x97, 0x5D, 0xA7, 0x39, 0xE9, 0x72, 0xF7, 0x2A, 0xEA, 0x72, 0xF7, 0x29, 0xDA, 0x74, 0xAA, 0x77,
+    0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9, 0x2F, 0xCA, 0xAF, 0xD1, 0x9F, 0x3A,
+    0xF9, 0x0F, 0x94, 0xFA, 0x9F, 0x5F, 0xCA, 0xFA, 0x99, 0x99, 0x9F, 0xCA, 0xFF, 0xFD, 0xAF, 0xFF,
+    0xEA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xF7, 0x2A, 0xF9, 0x71, 0x9F, 0xC7, 0x2F, 0xDA,
+    0x91, 0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3, 0x9F, 0xFC, 0xA7, 0x99, 0x99, 0x94,
+    0x69, 0xAC, 0x73, 0xAF, 0x72, 0xFD, 0x70, 0xEA, 0xEA, 0x69, 0xE0, 0x9E, 0x95, 0xE2, 0x9E, 0x4A,
+    0xD9, 0x3A, 0xCA, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA,
+    0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF,
+    0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19,
+    0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA,
+    0x79, 0x99, 0x99, 0x40, 0x77, 0x2A, 0xE2, 0xAE, 0x39, 0xF9, 0x09, 0xF9, 0x29, 0xF9, 0x0A, 0xF9,
+    0x3F, 0x2F, 0x59, 0x59, 0x77, 0x77, 0x71, 0x9A, 0xAA, 0xA9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9, 0x2F,
+    0xCA, 0xAF, 0xD1, 0x9F, 0x3A, 0xF9, 0x0F, 0x94, 0xFA, 0x9F, 0x5F, 0xCA, 0xFA, 0x99, 0x99, 0x9F,
+    0xCA, 0xFF, 0xFD, 0xAF, 0xFF, 0xEA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xF7, 0x2A, 0xF9,
+    0x71, 0x9F, 0xC7, 0x2F, 0xDA, 0x91, 0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3, 0x9F,
+    0xFC, 0xA7, 0x99, 0x99, 0x94, 0x29, 0x71, 0xD9, 0x7A, 0xE7, 0xAF, 0x7F, 0xC7, 0xAE, 0xA7, 0x9E,
+    0x71, 0xC9, 0x77, 0x77, 0x99, 0x99, 0x93, 0xAF, 0xDA, 0x29, 0xFE, 0xA3, 0xAF, 0xDA, 0x59, 0xFA,
+    0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA,
+    0x59, 0xFA, 0x59, 0xFA, 0x49, 0xFD, 0xA9, 0x1F, 0xFD, 0x1F, 0xFD, 0x00, 0x69, 0x71, 0x9D, 0x97,
+    0xF6, 0x9F, 0x6F, 0x95, 0xAE, 0x96, 0xE9, 0x70, 0xC9, 0x77, 0x77, 0x09, 0x99, 0x99, 0x3A, 0xFD,
+    0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA, 0x91, 0xFF,
+    0xD1, 0xFF, 0xD0, 0x49, 0xAA, 0x7F, 0xA5, 0xAF, 0xC9, 0x39, 0xEA, 0xE3, 0xE9, 0x0F, 0x1A, 0xDA,
+    0x2E, 0x90, 0xE4, 0xD7, 0x77, 0x49, 0x99, 0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD0, 0x73, 0x9E, 0x91,
+    0x9E, 0x9F, 0xC1, 0xFF, 0xD1, 0xFC, 0xAE, 0x91, 0xAE, 0x91, 0x95, 0x97, 0x77, 0x59, 0x99, 0x99,
+    0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA,
+    0x91, 0xFF, 0xD1, 0xFF, 0xD0, 0x77, 0x7D, 0x91, 0xAD, 0x70, 0xFA, 0xEA, 0x70, 0xFE, 0x97, 0x2F,
+    0xD7, 0x2A, 0xFE, 0x70, 0xAD, 0xA9, 0xFA, 0x70, 0xA2, 0x9F, 0x97, 0x4A, 0xF7, 0x09, 0x99, 0x90,
+    0xFA, 0x5A, 0xFF, 0xE4, 0xFF, 0xFC, 0xA2, 0xFF, 0xFE, 0x1A, 0xFA, 0x29, 0xFD, 0x1F, 0xC4, 0x9F,
+    0xC9, 0x9F, 0xC5, 0xFC, 0x9A, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xFC,
+    0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xA1, 0xFD, 0x92,
+    0xFC, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFE, 0x95, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x69, 0xDA,
+    0x29, 0xA7, 0x3A, 0xFC, 0x1E, 0x72, 0xFF, 0xE7, 0x2E, 0x0A, 0xFC, 0xA7, 0x2A, 0xC9, 0x1A, 0xEA,
+    0x77, 0x29, 0x77, 0x77, 0x77, 0x79, 0x9A, 0xA2, 0x9A, 0xAA, 0xA6, 0xAF, 0xD0, 0x9F, 0xEA, 0x39,
+    0xFE, 0xAF, 0xFC, 0x93, 0xFF, 0xFF, 0xD5, 0xAF, 0xD9, 0x09, 0xFD, 0x59, 0xFC, 0x4F, 0xC9, 0x49,
+    0xFA, 0x4F, 0xC9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49,
+    0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49,
+    0xFA, 0x4A, 0xF9, 0x39, 0xFD, 0x92, 0x9F, 0xDA, 0x1A, 0xFF, 0x90, 0x9F, 0xFA, 0x0F, 0xFC, 0x90,
+    0x9F, 0xFA, 0x59, 0x77, 0xD9, 0x75, 0xAE, 0x75, 0xAF, 0x75, 0xFA, 0x75, 0xAE, 0xA7, 0x59, 0xE7,
+    0x7C, 0x97, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF,
+    0xFD, 0x91, 0x9F, 0xA3, 0xFD, 0x1F, 0xC4, 0x9F, 0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA,
+    0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5,
+    0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC1, 0xFD, 0x92, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA,
+    0x59, 0xFF, 0xA7, 0x29, 0x99, 0x99, 0x60, 0x71, 0x97, 0x79, 0xD9, 0x75, 0xF7, 0x49, 0xEA, 0x74,
+    0xF7, 0x4A, 0xE9, 0x74, 0xE9, 0x76, 0xC9, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xA9, 0x70, 0x9F,
+    0xFC, 0x95, 0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC,
+    0x5F, 0xCA, 0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA,
+    0xAF, 0xA5, 0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19,
+    0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x7A, 0xAA, 0x75, 0xFA,
+    0x73, 0xAF, 0xC9, 0x71, 0x9E, 0xAE, 0x71, 0xE9, 0x0F, 0x7A, 0xDA, 0x2E, 0x96, 0xE3, 0x9D, 0x77,
+    0x77, 0x75, 0x9A, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F,
+    0xA3, 0xFD, 0x1F, 0xC4, 0x9F, 0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF,
+    0xAF, 0xCA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC,
+    0x93, 0x9F, 0xC1, 0xFD, 0x92, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7,
+    0x29, 0x99, 0x99, 0x60, 0x4A, 0xD9, 0x2C, 0x97, 0xFC, 0xA0, 0x9D, 0x95, 0x9F, 0xFD, 0x95, 0x9D,
+    0x99, 0xFD, 0x7D, 0x2F, 0x97, 0x77, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95,
+    0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA,
+    0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5,
+    0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC,
+    0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x77, 0x49, 0xE9, 0x19, 0xE9, 0x5F,
+    0xC1, 0xFC, 0x5F, 0xC1, 0xFC, 0x5A, 0xE9, 0x1A, 0xE9, 0x79, 0x59, 0x77, 0x77, 0x76, 0x9A, 0xAA,
+    0xAA, 0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F, 0xA3, 0xFD, 0x1F, 0xC4,
+    0x9F, 0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA,
+    0xFC, 0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC1, 0xFD,
+    0x92, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7, 0x29, 0x99, 0x99, 0x60,
+    0x59, 0xA9, 0x72, 0xAE, 0x97, 0x1F, 0xA7, 0x1F, 0x97, 0x19, 0xDA, 0x77, 0x4A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x49, 0xE7, 0x2F, 0xA7, 0x1F, 0xA7, 0x1A, 0xE7, 0x39, 0x96, 0x69, 0xAA, 0xAA, 0xA9, 0x29,
+    0x69, 0xFF, 0xC9, 0x9C, 0xA4, 0xFF, 0xFD, 0xA3, 0xFC, 0xA9, 0xAF, 0xE3, 0x9F, 0x93, 0xFD, 0x3F,
+    0xC4, 0xAF, 0xC9, 0x19, 0xFA, 0x3A, 0xFD, 0xA1, 0xAF, 0x92, 0xAF, 0xEA, 0x1A, 0xF9, 0x1A, 0xDA,
+    0x9F, 0xC1, 0xFC, 0x90, 0xAD, 0xA0, 0x9F, 0xA1, 0xFC, 0x9A, 0xDA, 0x19, 0xFA, 0x1A, 0xFE, 0xA2,
+    0xAF, 0x91, 0xAF, 0xDA, 0x3A, 0xF2, 0x9F, 0xCA, 0x4F, 0xC3, 0xFD, 0x3A, 0xF9, 0x3A, 0xFD, 0xAA,
+    0xFC, 0xA3, 0xAF, 0xFF, 0xCA, 0x4A, 0xCA, 0x0A, 0xFE, 0xA7, 0x93, 0x99, 0x99, 0x97, 0x79, 0x77,
+    0x3D, 0x77, 0x2F, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x97, 0x71, 0xF9, 0x77, 0x1A, 0xDA, 0x77, 0x29,
+    0xC7, 0x77, 0x77, 0x77, 0x39, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29,
+    0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9,
+    0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x73, 0x97,
+    0x73, 0xAD, 0x77, 0x2E, 0xA7, 0x70, 0xF9, 0x77, 0x9F, 0x77, 0x0F, 0x77, 0x1E, 0x77, 0x29, 0xC7,
+    0x77, 0x77, 0x77, 0x49, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE,
+    0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF,
+    0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F,
+    0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x70, 0x9A, 0xC9,
+    0x77, 0x09, 0xF9, 0x77, 0xFD, 0x76, 0xAF, 0xE7, 0x49, 0xE1, 0xEA, 0x73, 0xE9, 0x19, 0xE7, 0x29,
+    0xDA, 0x3A, 0xD7, 0x77, 0x77, 0x77, 0x99, 0x76, 0xAF, 0xD2, 0x9A, 0xFC, 0xA2, 0xAF, 0xE2, 0xFE,
+    0xA2, 0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A,
+    0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93, 0xAF, 0xA5, 0xFD, 0x99, 0x9A, 0xFC, 0xA5, 0xAF, 0xFF,
+    0xEA, 0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE, 0x90, 0xAF, 0xD9, 0x69, 0x99, 0x93, 0x99, 0x93, 0x77,
+    0x72, 0xAE, 0x2A, 0xE7, 0x2F, 0xA0, 0x9F, 0xA7, 0x1F, 0xA0, 0x9F, 0xA7, 0x1F, 0x2F, 0x74, 0x95,
+    0x97, 0x77, 0x77, 0x77, 0x09, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29,
+    0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9,
+    0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x72, 0x97,
+    0x74, 0xDA, 0x77, 0x1A, 0xE7, 0x71, 0xF7, 0x70, 0xF9, 0x77, 0x9E, 0xA7, 0x70, 0xAD, 0xA7, 0x72,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x0F, 0xFC, 0x91, 0xAF, 0xE2,
+    0xFD, 0xA4, 0x9F, 0xA4, 0xFC, 0xA5, 0xF5, 0xAF, 0xC4, 0xAE, 0xA6, 0xFC, 0x4F, 0x7A, 0xFA, 0x29,
+    0xF7, 0x9F, 0xC2, 0xAE, 0x97, 0x0F, 0xC2, 0xF7, 0x19, 0xF9, 0x09, 0xE9, 0x72, 0xFA, 0x0F, 0x73,
+    0xAF, 0x9E, 0xA7, 0x4F, 0xF7, 0x5A, 0xFD, 0xA7, 0x6F, 0xD7, 0x7A, 0xFC, 0x77, 0x9F, 0x97, 0x70,
+    0xF7, 0x70, 0xF9, 0x77, 0xAF, 0x75, 0x9A, 0xFC, 0x72, 0xAF, 0xFC, 0x97, 0x29, 0xFF, 0x97, 0x4F,
+    0xE7, 0x69, 0xAA, 0xAA, 0x77, 0x49, 0x99, 0x74, 0xAF, 0xD7, 0x3F, 0xF7, 0x3A, 0xFE, 0x76, 0xFC,
+    0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x29, 0xAA, 0xA9, 0x6F, 0xC9, 0xFF, 0x5F, 0xFF,
+    0xE4, 0xFF, 0xFE, 0xA3, 0xFD, 0x91, 0xAF, 0xD3, 0xFC, 0x93, 0xAF, 0xC3, 0xFC, 0x5F, 0xC9, 0x2F,
+    0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC,
+    0x3F, 0xC5, 0xFC, 0x3F, 0xC4, 0xAF, 0x93, 0xFC, 0x92, 0xAF, 0xC4, 0xFF, 0xFD, 0x94, 0xFF, 0xFC,
+    0x95, 0xFF, 0xEA, 0x7F, 0xCA, 0x99, 0x99, 0x71, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97,
+    0x3A, 0xFF, 0xC7, 0x1F, 0xFD, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x70, 0x77, 0x72, 0xEA, 0x2E,
+    0xA7, 0x1A, 0xF1, 0xAF, 0x71, 0xAF, 0x1A, 0xF7, 0x19, 0xEA, 0x19, 0xEA, 0x73, 0x95, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x19, 0xFF, 0xCA, 0x1A, 0xFE, 0x90, 0xFF, 0xC9, 0x1A, 0xFE, 0x2F, 0xDA, 0x49,
+    0xFA, 0x4F, 0xCA, 0x5F, 0x5A, 0xFC, 0x4A, 0xEA, 0x6F, 0xC4, 0xF7, 0xAF, 0xA2, 0x9F, 0x79, 0xFC,
+    0x2A, 0xE9, 0x70, 0xFC, 0x2F, 0x71, 0x9F, 0x90, 0x9E, 0x97, 0x2F, 0xA0, 0xF7, 0x3A, 0xF9, 0xEA,
+    0x74, 0xFF, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0xAF, 0xC7, 0x79, 0xF9, 0x77, 0x0F, 0x77, 0x0F,
+    0x97, 0x7A, 0xF7, 0x59, 0xAF, 0xC7, 0x2A, 0xFF, 0xC9, 0x72, 0x9F, 0xF9, 0x74, 0xFE, 0x76, 0x9A,
+    0xAA, 0xA7, 0x70, 0x69, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x7F, 0xFD, 0xA7, 0x6F, 0xFD, 0xA7, 0x6A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x19, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F,
+    0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC,
+    0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97,
+    0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF,
+    0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE,
+    0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD,
+    0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0x9F, 0xFD, 0xA5, 0xAF,
+    0xFD, 0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC,
+    0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4,
+    0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA,
+    0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF,
+    0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x77, 0x77, 0x0A, 0xC9, 0x5C,
+    0xA7, 0x6E, 0x93, 0xE7, 0x6F, 0xCA, 0xFA, 0x76, 0xAF, 0xFC, 0x77, 0x09, 0xFD, 0xA7, 0x73, 0x99,
+    0x97, 0x77, 0x77, 0x73, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19,
+    0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0, 0xFC, 0x76, 0x9E,
+    0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A, 0xFA, 0x73, 0xEA,
+    0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xF7, 0x0F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC, 0x6F, 0x71, 0xFC,
+    0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA, 0x3A, 0xFF, 0xD0,
+    0x39, 0x69, 0x7D, 0x94, 0x9C, 0x95, 0xAE, 0xA2, 0x9D, 0x95, 0x9F, 0xFD, 0x7A, 0xFF, 0x72, 0xAE,
+    0xA9, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA,
+    0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF,
+    0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9,
+    0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F,
+    0xC9, 0x49, 0x99, 0x49, 0x99, 0x20, 0x74, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F,
+    0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0,
+    0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A,
+    0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F,
+    0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC,
+    0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA,
+    0x3A, 0xFF, 0xD7, 0x71, 0x9E, 0xA7, 0x73, 0x9E, 0x97, 0x74, 0xEA, 0x77, 0x49, 0xF7, 0x74, 0x9F,
+    0xCA, 0xA7, 0x72, 0xFE, 0x77, 0x3A, 0xFA, 0x77, 0x74, 0x59, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6,
+    0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F,
+    0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2,
+    0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC,
+    0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x4E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75,
+    0xAF, 0x99, 0x97, 0x2F, 0xDA, 0x73, 0xAE, 0xA7, 0x72, 0x75, 0xA9, 0x77, 0x0E, 0x76, 0xAF, 0x97,
+    0x4F, 0xD9, 0x73, 0xFD, 0xA7, 0x39, 0xEA, 0x97, 0x6A, 0x77, 0x77, 0x79, 0x9A, 0xA9, 0x97, 0x2A,
+    0xFF, 0xCA, 0x95, 0xAF, 0xFF, 0xC4, 0xFF, 0xFE, 0x3F, 0xDA, 0x91, 0x9A, 0xF2, 0xAF, 0xC6, 0xF2,
+    0xFC, 0x7E, 0xA1, 0xAF, 0xA7, 0xAD, 0x91, 0xFC, 0x97, 0x09, 0x3F, 0xC7, 0x59, 0xFC, 0x75, 0x9F,
+    0xC7, 0x5A, 0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFD,
+    0x75, 0xFE, 0x74, 0x9F, 0xEA, 0x69, 0xA9, 0x1A, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x4A, 0xFF, 0xFC,
+    0xA6, 0xAF, 0xFD, 0x97, 0x29, 0x99, 0x99, 0x94, 0x70, 0x99, 0x74, 0xDA, 0x72, 0x9E, 0x72, 0xF7,
+    0x1A, 0xEA, 0x71, 0xEA, 0x71, 0x9D, 0xA7, 0x3A, 0xA7, 0x77, 0x77, 0x2A, 0xAA, 0xA9, 0x69, 0xFF,
+    0x93, 0xAF, 0xFD, 0x91, 0xAF, 0xCA, 0xFC, 0xA0, 0x9F, 0xA2, 0xFC, 0x0F, 0xC3, 0xAE, 0xA9, 0xFA,
+    0x39, 0xE0, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xFC, 0x97, 0x0F, 0xCA, 0x70, 0xAF, 0xC7, 0x0A, 0xFC,
+    0x70, 0x9F, 0xD7, 0x0F, 0xEA, 0x99, 0x9A, 0xD0, 0x9F, 0xFF, 0xC1, 0xAF, 0xFE, 0xA2, 0x9F, 0xFC,
+    0xA6, 0x99, 0x99, 0x93, 0x71, 0xAA, 0xC9, 0x76, 0xAF, 0xA7, 0x49, 0xFD, 0xA7, 0x29, 0xE9, 0xAE,
+    0xA7, 0x09, 0xEA, 0x1A, 0xE9, 0x7E, 0xA3, 0xAD, 0x97, 0x9A, 0x95, 0xA9, 0x77, 0x77, 0x09, 0x9A,
+    0xA9, 0x97, 0x2A, 0xFF, 0xCA, 0x95, 0xAF, 0xFF, 0xC4, 0xFF, 0xFE, 0x3F, 0xDA, 0x91, 0x9A, 0xF2,
+    0xAF, 0xC6, 0xF2, 0xFC, 0x7E, 0xA1, 0xAF, 0xA7, 0xAD, 0x91, 0xFC, 0x97, 0x09, 0x3F, 0xC7, 0x59,
+    0xFC, 0x75, 0x9F, 0xC7, 0x5A, 0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x75, 0xAF, 0xC9, 0x74, 0x9F,
+    0xCA, 0x75, 0xFD, 0x75, 0xFE, 0x74, 0x9F, 0xEA, 0x69, 0xA9, 0x1A, 0xFF, 0xFF, 0x92, 0xFF, 0xFF,
+    0x4A, 0xFF, 0xFC, 0xA6, 0xAF, 0xFD, 0x97, 0x29, 0x99, 0x99, 0x94, 0x69, 0xAC, 0x72, 0xAF, 0x71,
+    0xFD, 0x7E, 0xAE, 0xA5, 0xAE, 0x09, 0xE4, 0x9E, 0x2A, 0xDA, 0x3A, 0xD9, 0x3D, 0xA7, 0x77, 0x75,
+    0xAA, 0xAA, 0x96, 0x9F, 0xF9, 0x3A, 0xFF, 0xD9, 0x1A, 0xFC, 0xAF, 0xCA, 0x09, 0xFA, 0x2F, 0xC0,
+    0xFC, 0x3A, 0xEA, 0x9F, 0xA3, 0x9E, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0xA7,
+    0x0A, 0xFC, 0x70, 0xAF, 0xC7, 0x09, 0xFD, 0x70, 0xFE, 0xA9, 0x99, 0xAD, 0x09, 0xFF, 0xFC, 0x1A,
+    0xFF, 0xEA, 0x29, 0xFF, 0xCA, 0x69, 0x99, 0x99, 0x30, 0x77, 0x74, 0x9E, 0x97, 0x6F, 0xC7, 0x59,
+    0xFC, 0x97, 0x5F, 0xC7, 0x6A, 0xE9, 0x77, 0x77, 0x77, 0x79, 0x9A, 0xA9, 0x97, 0x2A, 0xFF, 0xCA,
+    0x95, 0xAF, 0xFF, 0xC4, 0xFF, 0xFE, 0x3F, 0xDA, 0x91, 0x9A, 0xF2, 0xAF, 0xC6, 0xF2, 0xFC, 0x7E,
+    0xA1, 0xAF, 0xA7, 0xAD, 0x91, 0xFC, 0x97, 0x09, 0x3F, 0xC7, 0x59, 0xFC, 0x75, 0x9F, 0xC7, 0x5A,
+    0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFD, 0x75, 0xFE,
+    0x74, 0x9F, 0xEA, 0x69, 0xA9, 0x1A, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x4A, 0xFF, 0xFC, 0xA6, 0xAF,
+    0xFD, 0x97, 0x29, 0x99, 0x99, 0x94, 0x6A, 0xAA, 0x72, 0xFC, 0x70, 0x9F, 0xC7, 0x1F, 0xC7, 0x1F,
+    0x97, 0x39, 0x77, 0x77, 0x72, 0xAA, 0xAA, 0x96, 0x9F, 0xF9, 0x3A, 0xFF, 0xD9, 0x1A, 0xFC, 0xAF,
+    0xCA, 0x09, 0xFA, 0x2F, 0xC0, 0xFC, 0x3A, 0xEA, 0x9F, 0xA3, 0x9E, 0x0A, 0xF9, 0x70, 0xAF, 0x97,
+    0x0F, 0xC9, 0x70, 0xFC, 0xA7, 0x0A, 0xFC, 0x70, 0xAF, 0xC7, 0x09, 0xFD, 0x70, 0xFE, 0xA9, 0x99,
+    0xAD, 0x09, 0xFF, 0xFC, 0x1A, 0xFF, 0xEA, 0x29, 0xFF, 0xCA, 0x69, 0x99, 0x99, 0x30, 0x5A, 0xA5,
+    0x9C, 0xA7, 0x9D, 0xA3, 0x9E, 0x97, 0xEA, 0x19, 0xE9, 0x70, 0xAE, 0xA9, 0xE9, 0x72, 0xAF, 0xDA,
+    0x74, 0xAF, 0xC7, 0x69, 0xE7, 0x77, 0x74, 0x99, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0xA9, 0x5A, 0xFF,
+    0xFC, 0x4F, 0xFF, 0xE3, 0xFD, 0xA9, 0x19, 0xAF, 0x2A, 0xFC, 0x6F, 0x2F, 0xC7, 0xEA, 0x1A, 0xFA,
+    0x7A, 0xD9, 0x1F, 0xC9, 0x70, 0x93, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x75, 0xAF, 0xC7, 0x5A,
+    0xFC, 0x75, 0xAF, 0xC7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xE7, 0x49, 0xFE,
+    0xA6, 0x9A, 0x91, 0xAF, 0xFF, 0xF9, 0x2F, 0xFF, 0xF4, 0xAF, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9, 0x72,
+    0x99, 0x99, 0x99, 0x40, 0x77, 0x1A, 0xCA, 0x4D, 0xA3, 0xE3, 0xE9, 0x3F, 0x1E, 0xA5, 0xFA, 0xE6,
+    0x9F, 0xD7, 0x09, 0xF9, 0x71, 0x9D, 0xA7, 0x77, 0x77, 0x1A, 0xAA, 0xA9, 0x69, 0xFF, 0x93, 0xAF,
+    0xFD, 0x91, 0xAF, 0xCA, 0xFC, 0xA0, 0x9F, 0xA2, 0xFC, 0x0F, 0xC3, 0xAE, 0xA9, 0xFA, 0x39, 0xE0,
+    0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xFC, 0x97, 0x0F, 0xCA, 0x70, 0xAF, 0xC7, 0x0A, 0xFC, 0x70, 0x9F,
+    0xD7, 0x0F, 0xEA, 0x99, 0x9A, 0xD0, 0x9F, 0xFF, 0xC1, 0xAF, 0xFE, 0xA2, 0x9F, 0xFC, 0xA6, 0x99,
+    0x99, 0x93, 0x4A, 0xA5, 0x9C, 0xA7, 0x39, 0xDA, 0x39, 0xE9, 0x72, 0x9E, 0xA1, 0x9E, 0x97, 0x4A,
+    0xEA, 0x9E, 0x97, 0x6A, 0xFD, 0xA7, 0x70, 0xAF, 0xC7, 0x72, 0x9E, 0x77, 0x77, 0x72, 0x99, 0x99,
+    0x74, 0x9A, 0xFF, 0xFC, 0xA9, 0x6F, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xFE, 0x6F, 0xC9, 0x29, 0xFF,
+    0x5F, 0xC9, 0x49, 0xFD, 0xA4, 0xFC, 0x96, 0xFD, 0x4F, 0xC9, 0x69, 0xFC, 0xA3, 0xFC, 0x97, 0xFD,
+    0x3F, 0xC9, 0x7A, 0xFC, 0x3F, 0xC9, 0x79, 0xFC, 0x3F, 0xC9, 0x79, 0xFC, 0x3F, 0xC9, 0x70, 0xFC,
+    0x3F, 0xC9, 0x79, 0xFC, 0x3F, 0xC9, 0x79, 0xFC, 0x3F, 0xC9, 0x7A, 0xFA, 0x3F, 0xC9, 0x7F, 0xC9,
+    0x3F, 0xC9, 0x69, 0xFC, 0x4F, 0xC9, 0x6F, 0xC9, 0x4F, 0xC9, 0x5F, 0xD5, 0xFC, 0xA9, 0x99, 0xAF,
+    0xE4, 0xAF, 0xFF, 0xFA, 0x4A, 0xFF, 0xFE, 0xA9, 0x5F, 0xFF, 0xCA, 0x97, 0x77, 0x70, 0x74, 0x99,
+    0x99, 0x19, 0x99, 0x71, 0x9F, 0xDA, 0x1A, 0xD9, 0x79, 0xFE, 0xA1, 0xEA, 0x79, 0xFE, 0xA1, 0xE9,
+    0x72, 0xAF, 0xA1, 0xE7, 0x3A, 0xFA, 0x1D, 0xA7, 0x3A, 0xFA, 0x1D, 0x97, 0x3A, 0xFA, 0x1D, 0x79,
+    0xAA, 0xAA, 0xAF, 0xA7, 0x1A, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA7, 0xFE, 0xAF, 0xDA, 0x6A, 0xFC,
+    0x3A, 0xFA, 0x6F, 0xC4, 0xAF, 0xA5, 0x9F, 0xA4, 0xAF, 0xA5, 0xAF, 0xA4, 0xAF, 0xA5, 0xAF, 0x94,
+    0xAF, 0xA5, 0xFC, 0x94, 0xAF, 0xA5, 0xFC, 0xA4, 0xAF, 0xA5, 0xAF, 0xA4, 0xAF, 0xA5, 0xAF, 0xC4,
+    0xAF, 0xA5, 0x9F, 0xC9, 0x3A, 0xFA, 0x6F, 0xDA, 0x99, 0xFD, 0xA6, 0xFF, 0xFF, 0xA9, 0x5F, 0xFC,
+    0xAF, 0xEA, 0x5F, 0xE9, 0x0A, 0xFD, 0x97, 0x99, 0x94, 0x99, 0x96, 0x79, 0x99, 0x97, 0x59, 0xAF,
+    0xFF, 0xCA, 0x97, 0xFF, 0xFF, 0xD9, 0x5A, 0xFF, 0xFF, 0xE7, 0xFC, 0x92, 0x9F, 0xF6, 0xFC, 0x94,
+    0x9F, 0xDA, 0x5F, 0xC9, 0x6F, 0xD5, 0xFC, 0x96, 0x9F, 0xCA, 0x4F, 0xC9, 0x7F, 0xD4, 0xFC, 0x97,
+    0xAF, 0xC4, 0xFC, 0x97, 0x9F, 0xC1, 0xAA, 0xAF, 0xDA, 0xAA, 0xA3, 0x9F, 0xC1, 0xFF, 0xFC, 0x4F,
+    0xC1, 0xAA, 0xAF, 0xDA, 0xAA, 0xA3, 0x9F, 0xC4, 0xFC, 0x97, 0x9F, 0xC4, 0xFC, 0x97, 0xAF, 0xA4,
+    0xFC, 0x97, 0xFC, 0x94, 0xFC, 0x96, 0x9F, 0xC5, 0xFC, 0x96, 0xFC, 0x95, 0xFC, 0x95, 0xFD, 0x6F,
+    0xCA, 0x99, 0x9A, 0xFE, 0x5A, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xEA, 0x96, 0xFF, 0xFC, 0xA9, 0x77,
+    0x77, 0x10, 0x74, 0x99, 0x99, 0x73, 0x9F, 0xDA, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xEA, 0x75, 0xAF,
+    0xA7, 0x19, 0xAA, 0xAF, 0xDA, 0xA9, 0x6F, 0xFF, 0xA6, 0x9A, 0xAA, 0xFD, 0xAA, 0x97, 0x2A, 0xFA,
+    0x79, 0xAA, 0xDA, 0xFC, 0xA5, 0x9F, 0xFF, 0xA4, 0x9F, 0xFF, 0xCA, 0x39, 0xFD, 0xAA, 0xAF, 0xCA,
+    0x3F, 0xCA, 0x3A, 0xFA, 0x3F, 0xC4, 0xAF, 0xA2, 0xAF, 0xA4, 0xAF, 0xA2, 0xAF, 0xA4, 0xAF, 0xA2,
+    0xFC, 0x94, 0xAF, 0xA2, 0xFC, 0xA4, 0xAF, 0xA2, 0xAF, 0xA4, 0xAF, 0xA2, 0xAF, 0xC4, 0xAF, 0xA2,
+    0x9F, 0xC9, 0x3A, 0xFA, 0x3F, 0xDA, 0x99, 0xFD, 0xA3, 0xFF, 0xFF, 0xA9, 0x2F, 0xFC, 0xAF, 0xEA,
+    0x2F, 0xE9, 0x0A, 0xFD, 0x94, 0x99, 0x94, 0x99, 0x93, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x0A,
+    0xFF, 0xD7, 0x0A, 0xFF, 0xD7, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x0A,
+    0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3,
+    0xFC, 0x95, 0xAE, 0x3F, 0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F,
+    0xCA, 0x39, 0x99, 0x6F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99,
+    0x99, 0x9A, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x29, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x4F, 0xFE, 0x4F, 0xFE, 0x49, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x09, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90,
+    0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF,
+    0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19,
+    0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x77,
+    0x79, 0xD5, 0x9C, 0x70, 0xEA, 0x39, 0xD7, 0x0A, 0xFA, 0xAF, 0x71, 0xFF, 0xC9, 0x72, 0xAF, 0xCA,
+    0x76, 0x99, 0x97, 0x77, 0x77, 0x70, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF,
+    0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96,
+    0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95,
+    0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E,
+    0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x39, 0x79, 0x4A, 0xD5, 0xAC, 0x4F, 0x3E, 0x4F, 0xFD, 0x95, 0xFF,
+    0x97, 0x9F, 0xA7, 0x77, 0x77, 0x29, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA,
+    0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF,
+    0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19,
+    0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA,
+    0x79, 0x99, 0x99, 0x40, 0x77, 0x73, 0xEA, 0x76, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x59,
+    0xEA, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD,
+    0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F, 0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D,
+    0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F,
+    0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3,
+    0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFD, 0x90, 0x6A, 0xAA, 0x73, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xAE, 0x97, 0x49,
+    0x77, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9, 0x2F, 0xCA, 0xAF, 0xD1, 0x9F,
+    0x3A, 0xF9, 0x0F, 0x94, 0xFA, 0x9F, 0x5F, 0xCA, 0xFA, 0x99, 0x99, 0x9F, 0xCA, 0xFF, 0xFD, 0xAF,
+    0xFF, 0xEA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xF7, 0x2A, 0xF9, 0x71, 0x9F, 0xC7, 0x2F,
+    0xDA, 0x91, 0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3, 0x9F, 0xFC, 0xA7, 0x99, 0x99,
+    0x94, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA,
+    0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9,
+    0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75,
+    0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC,
+    0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x74,
+    0xAD, 0xA7, 0x6E, 0xA7, 0x6A, 0xE9, 0x76, 0xF9, 0x76, 0xFC, 0xAA, 0xA7, 0x39, 0xFE, 0x74, 0x9F,
+    0xC7, 0x76, 0x59, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3,
+    0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF,
+    0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD,
+    0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xD7, 0x99, 0x9A, 0xDA,
+    0x73, 0xE7, 0x3A, 0xDA, 0x73, 0xF7, 0x3F, 0xC9, 0x97, 0x09, 0xFD, 0x97, 0x09, 0xFA, 0x77, 0x00,
+    0x39, 0xA6, 0xAA, 0x70, 0xE4, 0xEA, 0x7F, 0x2E, 0xA7, 0x09, 0xF9, 0xEA, 0x72, 0x9F, 0xE7, 0x49,
+    0xFC, 0x77, 0xE7, 0x77, 0x77, 0x70, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF,
+    0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96,
+    0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95,
+    0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E,
+    0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x77, 0x29, 0xCA, 0x4D, 0xA4, 0xE9, 0x2E, 0x94, 0xAE, 0x1A, 0xDA,
+    0x6F, 0xAE, 0x70, 0xFD, 0x97, 0x09, 0xFA, 0x72, 0x9D, 0xA7, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0x97,
+    0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5,
+    0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF,
+    0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x72, 0xAA, 0xC9, 0x77, 0x1F,
+    0xC9, 0x77, 0xAF, 0xD9, 0x75, 0x9E, 0x9F, 0x97, 0x39, 0xE9, 0x1F, 0x72, 0x9E, 0x93, 0xE9, 0x72,
+    0x9A, 0x95, 0xA7, 0x77, 0x76, 0x99, 0xAA, 0xA9, 0x97, 0x49, 0xFF, 0xEA, 0x79, 0xFF, 0xFD, 0xA5,
+    0xAF, 0xFF, 0xEA, 0x4A, 0xFD, 0x93, 0x9F, 0xA3, 0x9F, 0xC9, 0x69, 0xEA, 0x3F, 0xC9, 0x79, 0xE9,
+    0x29, 0xFC, 0x71, 0xE3, 0xFC, 0x97, 0x19, 0x94, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77,
+    0x0A, 0xFC, 0x77, 0x0A, 0xFC, 0x59, 0xFF, 0xC0, 0xAF, 0xC5, 0xAF, 0xFC, 0x0A, 0xFC, 0x6F, 0xFA,
+    0x09, 0xFC, 0x97, 0x0F, 0xC2, 0xFD, 0x70, 0xAF, 0x2F, 0xDA, 0x7A, 0xF2, 0x9F, 0xDA, 0x6A, 0xF3,
+    0xAF, 0xFA, 0x99, 0xAA, 0xFC, 0x4F, 0xFF, 0xFD, 0x5A, 0xFF, 0xFF, 0x7A, 0xFF, 0xEA, 0x74, 0x99,
+    0x99, 0x99, 0x70, 0x79, 0xAC, 0x77, 0xAF, 0x76, 0xFD, 0x74, 0xEA, 0xEA, 0x72, 0xAE, 0x09, 0xE9,
+    0x70, 0x9E, 0x2A, 0xE7, 0x0A, 0xD9, 0x3D, 0xA7, 0x77, 0x77, 0x73, 0x9A, 0xAA, 0x91, 0x99, 0xAA,
+    0xA5, 0xAF, 0xFF, 0xCA, 0x3F, 0xFF, 0xE9, 0x2F, 0xCA, 0x9A, 0xFA, 0x9A, 0xC2, 0x9F, 0x92, 0x9F,
+    0x5A, 0xF4, 0xF9, 0x4A, 0xF4, 0xFA, 0x4A, 0xF4, 0xFA, 0x49, 0xFA, 0x2A, 0xF9, 0x5F, 0xDA, 0xFD,
+    0x7F, 0xFE, 0x70, 0xFF, 0xCA, 0x70, 0xF0, 0x99, 0x97, 0x29, 0xE9, 0x76, 0xAE, 0xA7, 0x6A, 0xFF,
+    0xFC, 0xA4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x92, 0xFA, 0xAF, 0xFD, 0xA1, 0xFC, 0x7F, 0xA1, 0xFA,
+    0x69, 0xF9, 0x09, 0xFC, 0x59, 0xFC, 0x2F, 0xDA, 0xAA, 0xAF, 0xD9, 0x2A, 0xFF, 0xFD, 0x94, 0x9F,
+    0xFE, 0xA7, 0x09, 0xAA, 0xAA, 0xAA, 0x99, 0x60, 0x77, 0x75, 0xAC, 0x95, 0xAA, 0x73, 0xE9, 0x3A,
+    0xD7, 0x3F, 0xCA, 0xFA, 0x73, 0x9F, 0xFC, 0x75, 0x9F, 0xDA, 0x77, 0x09, 0x99, 0x97, 0x77, 0x77,
+    0x19, 0x9A, 0xAA, 0x99, 0x74, 0x9F, 0xFE, 0xA7, 0x9F, 0xFF, 0xDA, 0x5A, 0xFF, 0xFE, 0xA4, 0xAF,
+    0xD9, 0x39, 0xFA, 0x39, 0xFC, 0x96, 0x9E, 0xA3, 0xFC, 0x97, 0x9E, 0x92, 0x9F, 0xC7, 0x1E, 0x3F,
+    0xC9, 0x71, 0x99, 0x4F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC7, 0x70, 0xAF,
+    0xC5, 0x9F, 0xFC, 0x0A, 0xFC, 0x5A, 0xFF, 0xC0, 0xAF, 0xC6, 0xFF, 0xA0, 0x9F, 0xC9, 0x70, 0xFC,
+    0x2F, 0xD7, 0x0A, 0xF2, 0xFD, 0xA7, 0xAF, 0x29, 0xFD, 0xA6, 0xAF, 0x3A, 0xFF, 0xA9, 0x9A, 0xAF,
+    0xC4, 0xFF, 0xFF, 0xD5, 0xAF, 0xFF, 0xF7, 0xAF, 0xFE, 0xA7, 0x49, 0x99, 0x99, 0x97, 0x49, 0x77,
+    0x1E, 0x5D, 0x70, 0xF2, 0x9E, 0x70, 0xFF, 0xD9, 0x71, 0xFF, 0x97, 0x39, 0xFA, 0x77, 0x77, 0x77,
+    0x69, 0xAA, 0xA9, 0x19, 0x9A, 0xAA, 0x5A, 0xFF, 0xFC, 0xA3, 0xFF, 0xFE, 0x92, 0xFC, 0xA9, 0xAF,
+    0xA9, 0xAC, 0x29, 0xF9, 0x29, 0xF5, 0xAF, 0x4F, 0x94, 0xAF, 0x4F, 0xA4, 0xAF, 0x4F, 0xA4, 0x9F,
+    0xA2, 0xAF, 0x95, 0xFD, 0xAF, 0xD7, 0xFF, 0xE7, 0x0F, 0xFC, 0xA7, 0x0F, 0x09, 0x99, 0x72, 0x9E,
+    0x97, 0x6A, 0xEA, 0x76, 0xAF, 0xFF, 0xCA, 0x49, 0xFF, 0xFE, 0x4F, 0xFF, 0xE9, 0x2F, 0xAA, 0xFF,
+    0xDA, 0x1F, 0xC7, 0xFA, 0x1F, 0xA6, 0x9F, 0x90, 0x9F, 0xC5, 0x9F, 0xC2, 0xFD, 0xAA, 0xAA, 0xFD,
+    0x92, 0xAF, 0xFF, 0xD9, 0x49, 0xFF, 0xEA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9, 0x96, 0x77, 0x77, 0x09,
+    0xE9, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x71, 0xAE, 0x97, 0x77, 0x77, 0x77,
+    0x79, 0x9A, 0xAA, 0x99, 0x74, 0x9F, 0xFE, 0xA7, 0x9F, 0xFF, 0xDA, 0x5A, 0xFF, 0xFE, 0xA4, 0xAF,
+    0xD9, 0x39, 0xFA, 0x39, 0xFC, 0x96, 0x9E, 0xA3, 0xFC, 0x97, 0x9E, 0x92, 0x9F, 0xC7, 0x1E, 0x3F,
+    0xC9, 0x71, 0x99, 0x4F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0x9F, 0xC7, 0x70, 0xAF, 0xC7, 0x70, 0xAF,
+    0xC5, 0x9F, 0xFC, 0x0A, 0xFC, 0x5A, 0xFF, 0xC0, 0xAF, 0xC6, 0xFF, 0xA0, 0x9F, 0xC9, 0x70, 0xFC,
+    0x2F, 0xD7, 0x0A, 0xF2, 0xFD, 0xA7, 0xAF, 0x29, 0xFD, 0xA6, 0xAF, 0x3A, 0xFF, 0xA9, 0x9A, 0xAF,
+    0xC4, 0xFF, 0xFF, 0xD5, 0xAF, 0xFF, 0xF7, 0xAF, 0xFE, 0xA7, 0x49, 0x99, 0x99, 0x97, 0x7A, 0xAA,
+    0x77, 0xFC, 0x75, 0x9F, 0xC7, 0x6F, 0xC7, 0x6A, 0xE9, 0x77, 0x09, 0x77, 0x77, 0x77, 0x70, 0x9A,
+    0xAA, 0x91, 0x99, 0xAA, 0xA5, 0xAF, 0xFF, 0xCA, 0x3F, 0xFF, 0xE9, 0x2F, 0xCA, 0x9A, 0xFA, 0x9A,
+    0xC2, 0x9F, 0x92, 0x9F, 0x5A, 0xF4, 0xF9, 0x4A, 0xF4, 0xFA, 0x4A, 0xF4, 0xFA, 0x49, 0xFA, 0x2A,
+    0xF9, 0x5F, 0xDA, 0xFD, 0x7F, 0xFE, 0x70, 0xFF, 0xCA, 0x70, 0xF0, 0x99, 0x97, 0x29, 0xE9, 0x76,
+    0xAE, 0xA7, 0x6A, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xE4, 0xFF, 0xFE, 0x92, 0xFA, 0xAF, 0xFD, 0xA1,
+    0xFC, 0x7F, 0xA1, 0xFA, 0x69, 0xF9, 0x09, 0xFC, 0x59, 0xFC, 0x2F, 0xDA, 0xAA, 0xAF, 0xD9, 0x2A,
+    0xFF, 0xFD, 0x94, 0x9F, 0xFE, 0xA7, 0x09, 0xAA, 0xAA, 0xAA, 0x99, 0x60, 0x71, 0x99, 0xAA, 0xA9,
+    0x97, 0x49, 0xFF, 0xEA, 0x79, 0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xEA, 0x4A, 0xFD, 0x93, 0x9F, 0xA3,
+    0x9F, 0xC9, 0x69, 0xEA, 0x3F, 0xC9, 0x79, 0xE9, 0x29, 0xFC, 0x71, 0xE3, 0xFC, 0x97, 0x19, 0x94,
+    0xFC, 0x77, 0x09, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x0A, 0xFC, 0x77, 0x0A, 0xFC, 0x59, 0xFF, 0xC0,
+    0xAF, 0xC5, 0xAF, 0xFC, 0x0A, 0xFC, 0x6F, 0xFA, 0x09, 0xFC, 0x97, 0x0F, 0xC2, 0xFD, 0x70, 0xAF,
+    0x2F, 0xDA, 0x7A, 0xF2, 0x9F, 0xDA, 0x6A, 0xF3, 0xAF, 0xFA, 0x99, 0xAA, 0xFC, 0x4F, 0xFF, 0xFD,
+    0x5A, 0xFF, 0xFF, 0x7A, 0xFF, 0xEA, 0x74, 0x99, 0x99, 0x99, 0x77, 0x39, 0x97, 0x72, 0x9F, 0x77,
+    0x2F, 0xA7, 0x71, 0xAE, 0xA7, 0x71, 0xAE, 0x97, 0x71, 0xF7, 0x71, 0xAE, 0x77, 0x29, 0xA9, 0x71,
+    0x77, 0x74, 0xE7, 0x7E, 0x97, 0x6A, 0xE7, 0x7E, 0xA7, 0x69, 0xE9, 0x76, 0x9E, 0xA7, 0x69, 0xF7,
+    0x7F, 0xA7, 0x7A, 0xA9, 0x77, 0x77, 0x39, 0xAA, 0xA9, 0x19, 0x9A, 0xAA, 0x5A, 0xFF, 0xFC, 0xA3,
+    0xFF, 0xFE, 0x92, 0xFC, 0xA9, 0xAF, 0xA9, 0xAC, 0x29, 0xF9, 0x29, 0xF5, 0xAF, 0x4F, 0x94, 0xAF,
+    0x4F, 0xA4, 0xAF, 0x4F, 0xA4, 0x9F, 0xA2, 0xAF, 0x95, 0xFD, 0xAF, 0xD7, 0xFF, 0xE7, 0x0F, 0xFC,
+    0xA7, 0x0F, 0x09, 0x99, 0x72, 0x9E, 0x97, 0x6A, 0xEA, 0x76, 0xAF, 0xFF, 0xCA, 0x49, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xE9, 0x2F, 0xAA, 0xFF, 0xDA, 0x1F, 0xC7, 0xFA, 0x1F, 0xA6, 0x9F, 0x90, 0x9F, 0xC5,
+    0x9F, 0xC2, 0xFD, 0xAA, 0xAA, 0xFD, 0x92, 0xAF, 0xFF, 0xD9, 0x49, 0xFF, 0xEA, 0x70, 0x9A, 0xAA,
+    0xAA, 0xA9, 0x96, 0x73, 0xAA, 0xC7, 0x76, 0xFC, 0x97, 0x73, 0xAF, 0xD9, 0x77, 0x1A, 0xE9, 0xF7,
+    0x70, 0xAE, 0x2F, 0x76, 0xAE, 0x93, 0xE7, 0x7A, 0xA6, 0xA7, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xD9,
+    0x2F, 0xFE, 0x0F, 0xFE, 0x92, 0xFF, 0xE0, 0xAF, 0xFC, 0x93, 0xAF, 0xFC, 0x93, 0xFC, 0xA7, 0x9F,
+    0xC9, 0x5F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9, 0x70,
+    0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xCA, 0x79, 0xFC, 0x6F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0x6F,
+    0xFF, 0xFF, 0x6F, 0xCA, 0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9,
+    0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xC9, 0x70, 0xFC, 0x6F, 0xCA, 0x70, 0xFC, 0x93, 0x9F,
+    0xFA, 0x4A, 0xFF, 0xA0, 0xAF, 0xFD, 0x92, 0xFF, 0xE0, 0xFF, 0xE9, 0x2F, 0xFE, 0x00, 0x59, 0x97,
+    0x72, 0x9F, 0x77, 0x1F, 0xD7, 0x7F, 0xF7, 0x5A, 0xE0, 0x9F, 0x73, 0x9E, 0x29, 0xE9, 0x72, 0xE9,
+    0x39, 0xD7, 0x77, 0x77, 0x99, 0x97, 0x7A, 0xFD, 0x97, 0x5A, 0xFE, 0x97, 0x5A, 0xFE, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC2, 0x9A, 0xAA, 0x97,
+    0x1F, 0xC0, 0x9F, 0xE9, 0x7F, 0xFF, 0xE7, 0xFF, 0xFE, 0xA6, 0xFD, 0xA9, 0x09, 0xFD, 0x6F, 0xCA,
+    0x39, 0xFC, 0x6F, 0xC9, 0x4F, 0xC6, 0xFC, 0x94, 0xFC, 0x6F, 0xC9, 0x4F, 0xC6, 0xFC, 0x94, 0xFC,
+    0x6F, 0xC9, 0x4F, 0xC6, 0xFC, 0x94, 0xFC, 0x6F, 0xC9, 0x4F, 0xC6, 0xFC, 0x94, 0xFC, 0x6F, 0xC9,
+    0x4F, 0xC5, 0xAF, 0xCA, 0x92, 0xAF, 0xCA, 0x92, 0xFF, 0xC1, 0xAF, 0xF9, 0x1F, 0xFC, 0x1F, 0xFC,
+    0x00, 0x0A, 0xFF, 0xD9, 0x2F, 0xFE, 0x1F, 0xFE, 0x92, 0xFF, 0xE1, 0x9F, 0xFC, 0x93, 0xAF, 0xFA,
+    0x94, 0xFC, 0xA7, 0x0F, 0xC7, 0xFC, 0x97, 0x0F, 0xC4, 0xFF, 0xFF, 0xFF, 0xD9, 0x0F, 0xFF, 0xFF,
+    0xFD, 0xA0, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xCA, 0x99, 0x4F, 0xC9, 0x70, 0xFC,
+    0x7F, 0xCA, 0x70, 0xFC, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xCA, 0x99,
+    0x99, 0x99, 0x99, 0x9F, 0xC7, 0xFC, 0x97, 0x0F, 0xC7, 0xFC, 0x97, 0x0F, 0xC7, 0xFC, 0x97, 0x0F,
+    0xC7, 0xFC, 0x97, 0x0F, 0xC7, 0xFC, 0x97, 0x0F, 0xC7, 0xFC, 0xA7, 0x0F, 0xC9, 0x49, 0xFF, 0xA4,
+    0xAF, 0xFA, 0x1A, 0xFF, 0xD9, 0x2F, 0xFE, 0x1F, 0xFE, 0x92, 0xFF, 0xE0, 0x49, 0x99, 0x76, 0xAF,
+    0xD9, 0x74, 0xAF, 0xE9, 0x74, 0x9F, 0xE9, 0x77, 0xFC, 0x97, 0x49, 0xAA, 0xFC, 0xAA, 0xAA, 0x71,
+    0xAF, 0xFE, 0x97, 0x09, 0xAA, 0xFC, 0xAA, 0xAA, 0x74, 0xFC, 0x77, 0x0F, 0xC2, 0xAA, 0xDA, 0x70,
+    0xFC, 0x0A, 0xFE, 0x96, 0xFF, 0xFE, 0x6F, 0xFF, 0xEA, 0x5F, 0xDA, 0x19, 0xFD, 0x5F, 0xC9, 0x39,
+    0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F,
+    0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0xFC, 0x94, 0xFC, 0x4A, 0xFC, 0xA9,
+    0x2A, 0xFC, 0xA9, 0x1F, 0xFC, 0x1A, 0xFF, 0x90, 0xFF, 0xC1, 0xFF, 0xC0, 0x74, 0x9E, 0xA2, 0xCA,
+    0x1F, 0xD0, 0x9D, 0x9A, 0xFF, 0xD9, 0xAD, 0x99, 0xFD, 0x1D, 0x2F, 0x77, 0x77, 0x5A, 0xFF, 0xDA,
+    0xFF, 0xE9, 0xAF, 0xFC, 0xA3, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC,
+    0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC,
+    0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA3, 0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9, 0x1A, 0xD9,
+    0x2A, 0x91, 0xFC, 0xA1, 0xD9, 0x9F, 0xFD, 0x99, 0xDA, 0x9F, 0xD1, 0xD2, 0xF9, 0x77, 0x77, 0x70,
+    0x99, 0x99, 0x93, 0xAF, 0xDA, 0x29, 0xFE, 0xA3, 0xAF, 0xDA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA,
+    0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA,
+    0x49, 0xFD, 0xA9, 0x1F, 0xFD, 0x1F, 0xFD, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x9F, 0xFD,
+    0x9A, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x4A, 0xFF, 0xDA, 0xFF, 0xE9, 0xAF,
+    0xFC, 0xA3, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA3, 0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x9F, 0xFD, 0xAA, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x49, 0x99, 0x99,
+    0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA,
+    0x91, 0xFF, 0xD1, 0xFF, 0xD0, 0x74, 0xD6, 0xC0, 0xAE, 0x39, 0xD9, 0x9F, 0xCA, 0xF1, 0xFF, 0xC9,
+    0x2A, 0xFD, 0x95, 0x99, 0x97, 0x77, 0x4A, 0xFF, 0xDA, 0xFF, 0xE9, 0xAF, 0xFC, 0xA3, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA3,
+    0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9, 0x19, 0x69, 0x1D, 0x94, 0x9C, 0x99, 0xEA, 0x29, 0xD9,
+    0x0F, 0xFD, 0x19, 0xFF, 0x4A, 0xEA, 0x97, 0x77, 0x69, 0x99, 0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA,
+    0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F, 0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD0,
+    0xAF, 0xFD, 0xAF, 0xFE, 0x9A, 0xFF, 0xCA, 0x3F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F,
+    0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F,
+    0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x39, 0xFF, 0xC9, 0xAF, 0xFD, 0xAF, 0xFE,
+    0x92, 0xAD, 0xA6, 0xEA, 0x69, 0xE9, 0x6A, 0xE9, 0x6A, 0xFA, 0xAA, 0x39, 0xFE, 0x49, 0xFC, 0x97,
+    0x60, 0x49, 0x99, 0x69, 0xFA, 0x5F, 0xD5, 0xFD, 0x5A, 0xFA, 0x6A, 0xAA, 0x97, 0x77, 0x79, 0x99,
+    0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA4, 0x9F,
+    0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD6, 0x9E, 0x95, 0x9E, 0x7E, 0xA7, 0xEA, 0x7F, 0xA9, 0x94, 0xFE,
+    0x5A, 0xF9, 0x73, 0x77, 0xAD, 0xA6, 0xAF, 0xA5, 0xFC, 0xA5, 0xFC, 0xA6, 0xEA, 0x77, 0x77, 0x7A,
+    0xFF, 0xDA, 0xFF, 0xE9, 0xAF, 0xFC, 0xA3, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC,
+    0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC,
+    0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA3, 0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9,
+    0x39, 0x99, 0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA4, 0x9F, 0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD0, 0xAF, 0xFD, 0xA0, 0x9F, 0xFE, 0x9F, 0xFE, 0x90,
+    0x9F, 0xFE, 0x0A, 0xFF, 0xCA, 0x2F, 0xFD, 0x93, 0xFC, 0xA6, 0x9F, 0xC6, 0xFC, 0xA7, 0xFC, 0x6F,
+    0xCA, 0x7F, 0xC6, 0xFC, 0xA7, 0xFC, 0x6F, 0xCA, 0x7F, 0xC6, 0xFC, 0xA7, 0xFC, 0x6F, 0xCA, 0x7F,
+    0xC6, 0xFC, 0xA7, 0xFC, 0x6F, 0xCA, 0x7F, 0xC6, 0xFC, 0xA7, 0xFC, 0x6F, 0xCA, 0x7F, 0xC6, 0xFC,
+    0xA7, 0xFC, 0x6F, 0xCA, 0x7F, 0xC6, 0xFC, 0xA7, 0xFC, 0x6F, 0xCA, 0x7F, 0xC6, 0xFC, 0xA7, 0xFC,
+    0x6F, 0xCA, 0x7F, 0xC4, 0x9F, 0xFC, 0x94, 0xFC, 0x3A, 0xFF, 0xDA, 0x39, 0xFC, 0x3F, 0xFE, 0x93,
+    0x9F, 0xA7, 0x73, 0xFC, 0x97, 0x72, 0x9F, 0xC7, 0x72, 0x9F, 0xCA, 0x77, 0x1A, 0xFD, 0x77, 0x09,
+    0xFE, 0x77, 0x2F, 0xD7, 0x73, 0x9A, 0xCA, 0x97, 0x00, 0x49, 0x99, 0x79, 0x99, 0x49, 0xFA, 0x5F,
+    0xC3, 0xFD, 0x4A, 0xFC, 0x3F, 0xD4, 0xAF, 0xC3, 0xAF, 0xA4, 0x9F, 0xC4, 0xAA, 0xA9, 0x69, 0xAA,
+    0xA7, 0x77, 0x77, 0x79, 0x99, 0x99, 0x69, 0x99, 0x91, 0xAF, 0xDA, 0x29, 0xFE, 0x09, 0xFE, 0xA2,
+    0xFF, 0x1A, 0xFD, 0xA2, 0xAF, 0xE3, 0x9F, 0xA5, 0xFC, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xA5, 0xFC,
+    0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xA5, 0xFC, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xA5, 0xFC, 0x39, 0xFA,
+    0x5F, 0xC3, 0x9F, 0xA5, 0xFC, 0x39, 0xFA, 0x5F, 0xC3, 0x9F, 0xA5, 0xFC, 0x29, 0xFD, 0xA9, 0x3F,
+    0xC1, 0xFF, 0xD3, 0xFC, 0x1F, 0xFD, 0x29, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x76,
+    0xFC, 0xA7, 0x49, 0xFD, 0x74, 0xFE, 0x97, 0x4A, 0xFC, 0x77, 0xAA, 0xA9, 0x50, 0x69, 0xAC, 0xA7,
+    0x19, 0xFA, 0x79, 0xFD, 0xA6, 0xEA, 0xAE, 0xA4, 0xEA, 0x1A, 0xE9, 0x2E, 0xA3, 0x9D, 0xA2, 0x9A,
+    0x95, 0x99, 0x77, 0x77, 0x1F, 0xFE, 0x92, 0xFF, 0xE9, 0x2F, 0xFD, 0xA6, 0xFC, 0x97, 0x0F, 0xC9,
+    0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70,
+    0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC,
+    0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x09, 0xFC, 0x70, 0xAF, 0xA7, 0x0F,
+    0xC9, 0x7F, 0xD6, 0xAF, 0xD5, 0x9F, 0xE9, 0x6F, 0xD9, 0x70, 0xAC, 0xA9, 0x70, 0x69, 0xAC, 0x97,
+    0x19, 0xF7, 0x1F, 0xD7, 0xAF, 0xE5, 0x9E, 0x1E, 0x94, 0xE9, 0x19, 0xE3, 0x9D, 0x93, 0xAC, 0xA7,
+    0x77, 0x75, 0x99, 0x9A, 0x7F, 0xE6, 0xAF, 0xE6, 0x9F, 0xE7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7,
+    0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7,
+    0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x70, 0xFC, 0x97, 0xAF, 0xC6, 0x9F,
+    0xD9, 0x5A, 0xFD, 0xA6, 0x9F, 0xC9, 0x70, 0x9A, 0xA9, 0x70, 0xAF, 0xFD, 0x2F, 0xFC, 0x9F, 0xFE,
+    0x19, 0xFF, 0xC0, 0xAF, 0xFA, 0x39, 0xFD, 0xA4, 0xFC, 0x95, 0xFC, 0x6F, 0xC9, 0x4F, 0xC7, 0xFC,
+    0x93, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0x71, 0xFC, 0x91, 0xFA, 0x72, 0xFC, 0x90, 0xFA, 0x73, 0xFC,
+    0x9F, 0xA7, 0x4F, 0xFD, 0x75, 0xFF, 0xDA, 0x74, 0xFC, 0xAF, 0xCA, 0x73, 0xFC, 0x9A, 0xFC, 0x97,
+    0x2F, 0xC9, 0x0F, 0xD9, 0x71, 0xFC, 0x91, 0xFD, 0x71, 0xFC, 0x91, 0x9F, 0xD7, 0x0F, 0xC9, 0x2A,
+    0xFD, 0x7F, 0xC9, 0x3A, 0xFD, 0x95, 0xFC, 0x94, 0xFE, 0x92, 0x9F, 0xFA, 0x3F, 0xEA, 0x0A, 0xFF,
+    0xD9, 0x3F, 0xFF, 0xFE, 0x5A, 0xFC, 0x77, 0x39, 0xA9, 0x75, 0x97, 0x74, 0xAE, 0xA7, 0x72, 0xAF,
+    0x77, 0x3F, 0x77, 0x3F, 0x77, 0x29, 0xE9, 0x77, 0x19, 0xEA, 0x77, 0x3A, 0xA7, 0x30, 0x49, 0x99,
+    0x75, 0xAF, 0xD7, 0x4A, 0xFE, 0x74, 0xAF, 0xE7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC2, 0xFF, 0x93, 0xFC, 0x2F, 0xF9, 0x3F, 0xC3, 0xAF, 0xA5, 0xFC, 0x29, 0xF9,
+    0x6F, 0xC1, 0x9F, 0x97, 0xFC, 0x1F, 0x97, 0x0F, 0xC9, 0xF7, 0x2F, 0xFD, 0xA7, 0x1F, 0xC9, 0xFC,
+    0x71, 0xFC, 0x09, 0xFC, 0x70, 0xFC, 0x1F, 0xCA, 0x7F, 0xC2, 0xFC, 0x96, 0xFC, 0x2A, 0xFC, 0x95,
+    0xFC, 0x3F, 0xD4, 0x9F, 0xCA, 0x92, 0xFD, 0x2F, 0xFC, 0x29, 0xFD, 0x90, 0xFF, 0xC3, 0x9F, 0xC7,
+    0x70, 0x99, 0x97, 0x49, 0x77, 0x1F, 0x97, 0x7F, 0xC7, 0x70, 0xF7, 0x70, 0xEA, 0x77, 0x9E, 0x77,
+    0x9E, 0x97, 0x70, 0xA9, 0x71, 0x39, 0x99, 0x99, 0x75, 0xAF, 0xDA, 0x1F, 0xFC, 0x19, 0xFE, 0xA1,
+    0xAF, 0xF2, 0xAF, 0xDA, 0x29, 0xFC, 0x95, 0x9F, 0xA2, 0xFC, 0x79, 0xFA, 0x1A, 0xF7, 0x09, 0xFA,
+    0x0A, 0xF7, 0x19, 0xFA, 0x9F, 0x72, 0x9F, 0xFC, 0xA7, 0x29, 0xFF, 0xD9, 0x71, 0x9F, 0xA0, 0xFC,
+    0x71, 0x9F, 0xA0, 0xAF, 0xC7, 0x09, 0xFA, 0x1F, 0xCA, 0x79, 0xFA, 0x19, 0xFC, 0xA6, 0x9F, 0xA2,
+    0xAF, 0xCA, 0x49, 0xFD, 0x92, 0xFD, 0xA2, 0xAF, 0xFA, 0x2F, 0xDA, 0x1F, 0xFC, 0xA3, 0xFC, 0xA7,
+    0x70, 0x99, 0x92, 0x79, 0xA7, 0x70, 0xAD, 0xA7, 0x59, 0xFC, 0x74, 0xAF, 0xCA, 0x73, 0xFE, 0x74,
+    0xFA, 0x76, 0x99, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xD9, 0x7F, 0xFE, 0x97, 0xAF, 0xFC, 0x97, 0x3F,
+    0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6A,
+    0xC9, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x59, 0xE3, 0xFC, 0x95, 0xF3, 0xFC, 0xA9, 0x99, 0x9A, 0xAF,
+    0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x79, 0x96, 0x9E, 0x49,
+    0xFC, 0x3A, 0xFD, 0x2F, 0xE9, 0x2E, 0xA9, 0x77, 0x76, 0x99, 0x93, 0xAF, 0xD9, 0x1A, 0xFE, 0x91,
+    0xAF, 0xE9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9,
+    0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9,
+    0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x4F, 0xC9, 0x3A, 0xFD, 0xA0, 0x9F, 0xFD, 0x9F, 0xFC, 0xA0,
+    0xAF, 0xFD, 0x97, 0xFF, 0xE9, 0x7A, 0xFF, 0xC9, 0x73, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97,
+    0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F,
+    0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xAC, 0x93, 0xFC, 0x96, 0xE3, 0xFC, 0x95,
+    0x9E, 0x3F, 0xC9, 0x5F, 0x3F, 0xCA, 0x99, 0x99, 0xAA, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF,
+    0xCA, 0x0F, 0xFF, 0xFD, 0x97, 0x77, 0x49, 0x97, 0x79, 0xF7, 0x7F, 0xA7, 0x6A, 0xF7, 0x69, 0xEA,
+    0x76, 0xF7, 0x6A, 0xE7, 0x79, 0xA9, 0x72, 0x49, 0x99, 0x3A, 0xFD, 0x91, 0xAF, 0xE9, 0x1A, 0xFE,
+    0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC,
+    0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC,
+    0x94, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x93, 0xAF, 0xDA, 0x09, 0xFF, 0xD9, 0xFF, 0xCA, 0x77, 0x97,
+    0x9E, 0xA5, 0x9F, 0x6F, 0x95, 0xAE, 0x6E, 0xA5, 0xEA, 0x69, 0xA9, 0x40, 0x75, 0x99, 0x77, 0x1E,
+    0x77, 0x0E, 0x91, 0xAF, 0xFD, 0x91, 0xE2, 0xFF, 0xE9, 0x09, 0xE2, 0xAF, 0xFC, 0x91, 0x9D, 0x95,
+    0xFC, 0xA3, 0x9D, 0x6F, 0xC9, 0x39, 0xC9, 0x6F, 0xC9, 0x49, 0x7F, 0xC9, 0x75, 0xFC, 0x97, 0x5F,
+    0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9,
+    0x75, 0xFC, 0x96, 0xAC, 0x93, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0x9E, 0x3F, 0xC9, 0x5F, 0x3F, 0xCA,
+    0x99, 0x99, 0xAA, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x49,
+    0x99, 0x29, 0x92, 0xAF, 0xD9, 0x1E, 0x0A, 0xFE, 0x91, 0xE9, 0xAF, 0xE9, 0x1E, 0x3F, 0xC9, 0x1E,
+    0x3F, 0xC9, 0x09, 0xD9, 0x3F, 0xC9, 0x09, 0xD4, 0xFC, 0x90, 0x9C, 0xA4, 0xFC, 0x91, 0x95, 0xFC,
+    0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97,
+    0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x97, 0x0F,
+    0xC9, 0x7A, 0xFD, 0xA4, 0x9F, 0xFD, 0x39, 0xFF, 0xCA, 0x30, 0xAF, 0xFD, 0x97, 0xFF, 0xE9, 0x7A,
+    0xFF, 0xC9, 0x73, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x94, 0x9A,
+    0xCA, 0x4F, 0xC9, 0x39, 0xFA, 0x3F, 0xC9, 0x3A, 0xFC, 0x3F, 0xC9, 0x3A, 0xFC, 0x3F, 0xC9, 0x39,
+    0xF9, 0x3F, 0xC9, 0x59, 0x95, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xAC, 0x93, 0xFC, 0x96,
+    0xE3, 0xFC, 0x95, 0x9E, 0x3F, 0xC9, 0x5F, 0x3F, 0xCA, 0x99, 0x99, 0xAA, 0xF1, 0x9F, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x49, 0x99, 0x72, 0xAF, 0xD9, 0x70, 0xAF, 0xE9,
+    0x70, 0xAF, 0xE9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97,
+    0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x3A, 0xAA, 0x4F, 0xC9, 0x2F, 0xC3, 0xFC, 0x92, 0xFC,
+    0x92, 0xFC, 0x92, 0xFC, 0x3F, 0xC9, 0x2A, 0xEA, 0x3F, 0xC9, 0x49, 0x5F, 0xC9, 0x73, 0xFC, 0x97,
+    0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x2A, 0xFD, 0xA7, 0x9F, 0xFD, 0x69,
+    0xFF, 0xCA, 0x60, 0x1A, 0xFF, 0xD9, 0x71, 0xFF, 0xE9, 0x71, 0xAF, 0xFC, 0x97, 0x5F, 0xCA, 0x77,
+    0xFC, 0x97, 0x7F, 0xC9, 0x77, 0xFC, 0x97, 0x7F, 0xC9, 0x19, 0xC9, 0x72, 0xFC, 0xA9, 0xF7, 0x2F,
+    0xFD, 0x97, 0x2F, 0xEA, 0x74, 0x9F, 0xCA, 0x74, 0x9F, 0xE9, 0x73, 0xFF, 0xC9, 0x73, 0xAC, 0xA0,
+    0xFC, 0x97, 0x7F, 0xC9, 0x6A, 0xC9, 0x5F, 0xC9, 0x6E, 0x5F, 0xC9, 0x59, 0xE5, 0xFC, 0x95, 0xF5,
+    0xFC, 0xA9, 0x99, 0x9A, 0xAF, 0x39, 0xFF, 0xFF, 0xC2, 0xAF, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xD9,
+    0x00, 0x59, 0x99, 0x5A, 0xFD, 0x93, 0xAF, 0xE9, 0x3A, 0xFE, 0x96, 0xFC, 0x96, 0xFC, 0x96, 0xFC,
+    0x96, 0xFC, 0x96, 0xFC, 0x96, 0xFC, 0x9A, 0xC4, 0xFF, 0x93, 0xFE, 0x94, 0xFD, 0x6F, 0xC9, 0x5F,
+    0xD9, 0x39, 0xFE, 0x93, 0xAF, 0xE9, 0x4A, 0x0F, 0xC9, 0x6F, 0xC9, 0x6F, 0xC9, 0x6F, 0xC9, 0x6F,
+    0xC9, 0x6F, 0xC9, 0x5A, 0xFD, 0xA2, 0x9F, 0xFD, 0x19, 0xFF, 0xCA, 0x00, 0x76, 0x9A, 0x77, 0x7A,
+    0xDA, 0x77, 0x49, 0xFC, 0x77, 0x3A, 0xFD, 0x77, 0x2F, 0xE7, 0x73, 0xFA, 0x77, 0x59, 0x97, 0x77,
+    0x77, 0x77, 0x75, 0xFF, 0x69, 0xFF, 0xC9, 0x0F, 0xFC, 0x5A, 0xFF, 0xC9, 0x0A, 0xFF, 0x94, 0x9F,
+    0xF9, 0x39, 0xFE, 0x7A, 0xEA, 0x6F, 0xF6, 0xAE, 0xA6, 0xFF, 0xA5, 0xAE, 0xA6, 0xFF, 0xC5, 0xAE,
+    0xA6, 0xFF, 0xD4, 0xAE, 0xA6, 0xFA, 0xFC, 0xA3, 0xAE, 0xA6, 0xF0, 0xFD, 0x92, 0xAE, 0xA6, 0xF1,
+    0xFD, 0x2A, 0xEA, 0x6F, 0x1A, 0xFC, 0xA1, 0xAE, 0xA6, 0xF2, 0xFD, 0x90, 0xAE, 0xA6, 0xF3, 0xFD,
+    0x0A, 0xEA, 0x6F, 0x39, 0xFD, 0xAE, 0xA6, 0xF4, 0xFF, 0xDA, 0x6F, 0x5F, 0xFC, 0xA6, 0xF5, 0x9F,
+    0xFA, 0x6F, 0x6A, 0xFE, 0xA6, 0xF7, 0xFE, 0xA4, 0xAF, 0xE9, 0x49, 0xFD, 0xA3, 0xFF, 0xD5, 0xAF,
+    0xCA, 0x3F, 0xFD, 0x6F, 0xC9, 0x77, 0x5A, 0x95, 0x74, 0x97, 0x73, 0xDA, 0x77, 0x19, 0xE9, 0x77,
+    0x0F, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x77, 0x09, 0xDA, 0x77, 0x2A, 0xA7, 0x77, 0x77, 0x77, 0x19,
+    0x9A, 0xA2, 0x9A, 0xAA, 0xA6, 0xAF, 0xD0, 0x9F, 0xEA, 0x39, 0xFE, 0xAF, 0xFC, 0x93, 0xFF, 0xFF,
+    0xD5, 0xAF, 0xD9, 0x09, 0xFD, 0x59, 0xFC, 0x4F, 0xC9, 0x49, 0xFA, 0x4F, 0xC9, 0x49, 0xFA, 0x4A,
+    0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A,
+    0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x39, 0xFD, 0x92,
+    0x9F, 0xDA, 0x1A, 0xFF, 0x90, 0x9F, 0xFA, 0x0F, 0xFC, 0x90, 0x9F, 0xFA, 0x0F, 0xF6, 0x9F, 0xFC,
+    0x90, 0xFF, 0xC5, 0xAF, 0xFC, 0x90, 0xAF, 0xF9, 0x49, 0xFF, 0x93, 0x9F, 0xE7, 0xAE, 0xA6, 0xFF,
+    0x6A, 0xEA, 0x6F, 0xFA, 0x5A, 0xEA, 0x6F, 0xFC, 0x5A, 0xEA, 0x6F, 0xFD, 0x4A, 0xEA, 0x6F, 0xAF,
+    0xCA, 0x3A, 0xEA, 0x6F, 0x0F, 0xD9, 0x2A, 0xEA, 0x6F, 0x1F, 0xD2, 0xAE, 0xA6, 0xF1, 0xAF, 0xCA,
+    0x1A, 0xEA, 0x6F, 0x2F, 0xD9, 0x0A, 0xEA, 0x6F, 0x3F, 0xD0, 0xAE, 0xA6, 0xF3, 0x9F, 0xDA, 0xEA,
+    0x6F, 0x4F, 0xFD, 0xA6, 0xF5, 0xFF, 0xCA, 0x6F, 0x59, 0xFF, 0xA6, 0xF6, 0xAF, 0xEA, 0x6F, 0x7F,
+    0xEA, 0x4A, 0xFE, 0x94, 0x9F, 0xDA, 0x3F, 0xFD, 0x5A, 0xFC, 0xA3, 0xFF, 0xD6, 0xFC, 0x97, 0x75,
+    0xA9, 0x77, 0x29, 0x97, 0x76, 0xAE, 0xA7, 0x75, 0x9F, 0x77, 0x6F, 0x97, 0x75, 0xF7, 0x75, 0x9E,
+    0xA7, 0x75, 0xEA, 0x77, 0x69, 0xA9, 0x74, 0x39, 0x9A, 0xA2, 0x9A, 0xAA, 0xA6, 0xAF, 0xD0, 0x9F,
+    0xEA, 0x39, 0xFE, 0xAF, 0xFC, 0x93, 0xFF, 0xFF, 0xD5, 0xAF, 0xD9, 0x09, 0xFD, 0x59, 0xFC, 0x4F,
+    0xC9, 0x49, 0xFA, 0x4F, 0xC9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A,
+    0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x49, 0xFA, 0x4A,
+    0xF9, 0x49, 0xFA, 0x4A, 0xF9, 0x39, 0xFD, 0x92, 0x9F, 0xDA, 0x1A, 0xFF, 0x90, 0x9F, 0xFA, 0x0F,
+    0xFC, 0x90, 0x9F, 0xFA, 0x77, 0x77, 0x09, 0x77, 0x2A, 0xE9, 0x77, 0x0A, 0xF7, 0x71, 0xF7, 0x71,
+    0xF7, 0x70, 0x9E, 0x97, 0x70, 0xE9, 0x77, 0x1A, 0xA7, 0x20, 0x69, 0xA6, 0xAC, 0x97, 0x6E, 0x4F,
+    0x76, 0xF2, 0xF7, 0x70, 0xF9, 0xF7, 0x71, 0x9F, 0xE7, 0x73, 0x9F, 0xC7, 0x76, 0xE9, 0x77, 0x77,
+    0x77, 0x77, 0x2F, 0xF6, 0x9F, 0xFC, 0x90, 0xFF, 0xC5, 0xAF, 0xFC, 0x90, 0xAF, 0xF9, 0x49, 0xFF,
+    0x93, 0x9F, 0xE7, 0xAE, 0xA6, 0xFF, 0x6A, 0xEA, 0x6F, 0xFA, 0x5A, 0xEA, 0x6F, 0xFC, 0x5A, 0xEA,
+    0x6F, 0xFD, 0x4A, 0xEA, 0x6F, 0xAF, 0xCA, 0x3A, 0xEA, 0x6F, 0x0F, 0xD9, 0x2A, 0xEA, 0x6F, 0x1F,
+    0xD2, 0xAE, 0xA6, 0xF1, 0xAF, 0xCA, 0x1A, 0xEA, 0x6F, 0x2F, 0xD9, 0x0A, 0xEA, 0x6F, 0x3F, 0xD0,
+    0xAE, 0xA6, 0xF3, 0x9F, 0xDA, 0xEA, 0x6F, 0x4F, 0xFD, 0xA6, 0xF5, 0xFF, 0xCA, 0x6F, 0x59, 0xFF,
+    0xA6, 0xF6, 0xAF, 0xEA, 0x6F, 0x7F, 0xEA, 0x4A, 0xFE, 0x94, 0x9F, 0xDA, 0x3F, 0xFD, 0x5A, 0xFC,
+    0xA3, 0xFF, 0xD6, 0xFC, 0x97, 0x75, 0xA9, 0x50, 0x77, 0x73, 0x9C, 0xA4, 0xDA, 0x72, 0xE9, 0x2E,
+    0x97, 0x2A, 0xE1, 0xAD, 0xA7, 0x4F, 0xAE, 0x76, 0xFD, 0x97, 0x69, 0xFA, 0x77, 0x09, 0xDA, 0x77,
+    0x77, 0x77, 0x70, 0x99, 0xAA, 0x29, 0xAA, 0xAA, 0x6A, 0xFD, 0x09, 0xFE, 0xA3, 0x9F, 0xEA, 0xFF,
+    0xC9, 0x3F, 0xFF, 0xFD, 0x5A, 0xFD, 0x90, 0x9F, 0xD5, 0x9F, 0xC4, 0xFC, 0x94, 0x9F, 0xA4, 0xFC,
+    0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF,
+    0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF, 0x94, 0x9F, 0xA4, 0xAF,
+    0x93, 0x9F, 0xD9, 0x29, 0xFD, 0xA1, 0xAF, 0xF9, 0x09, 0xFF, 0xA0, 0xFF, 0xC9, 0x09, 0xFF, 0xA0,
+    0x2A, 0xA9, 0x77, 0x70, 0x9F, 0x97, 0x77, 0x0F, 0xA7, 0x77, 0x0A, 0xF7, 0x77, 0x09, 0xF7, 0x77,
+    0x09, 0xEA, 0x77, 0x70, 0x9E, 0x59, 0xAA, 0x92, 0x9A, 0xAA, 0x97, 0xEA, 0x2A, 0xFC, 0xA0, 0xAF,
+    0xE9, 0x49, 0xE2, 0xAF, 0xFF, 0xFC, 0x4E, 0x92, 0x9F, 0xFF, 0xFC, 0xA4, 0x97, 0xFD, 0xA9, 0x09,
+    0xFD, 0x75, 0xFC, 0x93, 0x9F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9,
+    0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9,
+    0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x5F, 0xC9, 0x4F, 0xC7, 0x4A, 0xFC, 0xA9, 0x29, 0xFD, 0x97,
+    0x1F, 0xFC, 0x1A, 0xFF, 0x97, 0x0F, 0xFC, 0x1F, 0xFC, 0x90, 0x0F, 0xF6, 0x9F, 0xFC, 0x90, 0xFF,
+    0xA5, 0xAF, 0xFC, 0x90, 0xAF, 0xF9, 0x49, 0xFF, 0x93, 0x9F, 0xE7, 0xAE, 0xA6, 0xFE, 0xA6, 0xAE,
+    0xA6, 0xFF, 0x95, 0xAE, 0xA6, 0xFF, 0xC5, 0xAE, 0xA6, 0xFF, 0xCA, 0x4A, 0xEA, 0x6F, 0xAF, 0xC9,
+    0x3A, 0xEA, 0x6F, 0x0F, 0xD3, 0xAE, 0xA6, 0xF1, 0xFC, 0xA2, 0xAE, 0xA6, 0xF1, 0xAF, 0xC9, 0x1A,
+    0xEA, 0x6F, 0x2F, 0xD1, 0xAE, 0xA6, 0xF3, 0xFC, 0xA0, 0xAE, 0xA6, 0xF3, 0x9F, 0xC9, 0xAE, 0xA6,
+    0xF4, 0xAF, 0xCA, 0xEA, 0x6F, 0x5F, 0xFC, 0xA6, 0xF5, 0x9F, 0xFA, 0x6F, 0x6A, 0xFE, 0xA6, 0xF7,
+    0xFE, 0x94, 0xAF, 0xE9, 0x5F, 0xD9, 0x3F, 0xFD, 0x5A, 0xFC, 0x93, 0xFF, 0xD6, 0xFC, 0x97, 0x74,
+    0x9F, 0x77, 0x09, 0xC2, 0x9F, 0x77, 0x9E, 0x1F, 0x97, 0x7A, 0xFF, 0xC7, 0x70, 0xAF, 0xF7, 0x72,
+    0xFE, 0x77, 0x59, 0xAA, 0x97, 0x39, 0xAA, 0xA2, 0x9A, 0xAA, 0xA4, 0xAF, 0xD0, 0x9F, 0xEA, 0x19,
+    0xFE, 0xAF, 0xFC, 0x91, 0xFF, 0xFF, 0xD3, 0xAF, 0xD9, 0x09, 0xFD, 0x39, 0xFC, 0x4F, 0xC9, 0x29,
+    0xFA, 0x4F, 0xC9, 0x29, 0xFA, 0x4A, 0xF9, 0x29, 0xFA, 0x4A, 0xF9, 0x29, 0xFA, 0x4A, 0xF9, 0x29,
+    0xFA, 0x4A, 0xF9, 0x29, 0xFA, 0x4A, 0xF9, 0x29, 0xFA, 0x4A, 0xF9, 0x29, 0xFA, 0x4A, 0xF9, 0x29,
+    0xFA, 0x4A, 0xF9, 0x19, 0xFD, 0x93, 0xAF, 0x90, 0xAF, 0xF9, 0x2A, 0xF9, 0x0F, 0xFC, 0x92, 0xFC,
+    0x76, 0xFC, 0x76, 0xFC, 0x75, 0xAF, 0xA7, 0x49, 0xFC, 0x74, 0xAF, 0xCA, 0x72, 0xAF, 0xDA, 0x73,
+    0x9F, 0xCA, 0x75, 0x9A, 0xAA, 0x50, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x49, 0xFF, 0xD9, 0x73,
+    0xAF, 0xFD, 0x75, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x09, 0x9A, 0x99, 0x77,
+    0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0x97, 0xAF, 0xFF, 0xEA, 0x5A, 0xFC, 0xA9, 0x19, 0xFE, 0x93,
+    0x9F, 0xC6, 0xAF, 0xD3, 0xFC, 0x97, 0xFD, 0x91, 0xAF, 0xA7, 0x1F, 0xD1, 0xFC, 0x97, 0x1F, 0xD1,
+    0xFC, 0x72, 0xAF, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0xAF, 0xC7, 0x3F,
+    0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x29, 0xFC, 0x09, 0xFC, 0x97, 0x19, 0xFC, 0x09, 0xFC,
+    0xA7, 0x1A, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC, 0xA7, 0x9F, 0xC3, 0xFD, 0x95, 0x9F, 0xC9,
+    0x3A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x5F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xDA,
+    0x76, 0x99, 0xAA, 0x99, 0x71, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0x9F, 0xFD, 0xA5, 0xAF, 0xFD,
+    0x96, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC9,
+    0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F, 0xA3, 0xFD, 0x1F, 0xC4, 0x9F, 0xC9, 0x9F, 0xC5, 0xFC,
+    0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAA, 0xFA,
+    0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC1, 0xFD, 0x92, 0xFC, 0x91, 0x9F, 0xFF,
+    0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7, 0x29, 0x99, 0x99, 0x60, 0x77, 0x76, 0xD5, 0x9C, 0x74,
+    0xAE, 0x39, 0xD9, 0x73, 0x9F, 0xCA, 0xF7, 0x5F, 0xFC, 0x97, 0x6A, 0xFD, 0x97, 0x71, 0x99, 0x97,
+    0x77, 0x77, 0x49, 0x9A, 0x99, 0x77, 0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0x97, 0xAF, 0xFF, 0xEA,
+    0x5A, 0xFC, 0xA9, 0x19, 0xFE, 0x93, 0x9F, 0xC6, 0xAF, 0xD3, 0xFC, 0x97, 0xFD, 0x91, 0xAF, 0xA7,
+    0x1F, 0xD1, 0xFC, 0x97, 0x1F, 0xD1, 0xFC, 0x72, 0xAF, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x99, 0xFC,
+    0x72, 0x9F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x29, 0xFC, 0x09,
+    0xFC, 0x97, 0x19, 0xFC, 0x09, 0xFC, 0xA7, 0x1A, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC, 0xA7,
+    0x9F, 0xC3, 0xFD, 0x95, 0x9F, 0xC9, 0x3A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x5F, 0xFF, 0xFA, 0x7A,
+    0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xDA, 0x76, 0x99, 0xAA, 0x99, 0x71, 0x49, 0x69, 0x7D, 0x94, 0x9C,
+    0x95, 0xAE, 0xA2, 0x9D, 0x95, 0x9F, 0xFD, 0x7A, 0xFF, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x9A,
+    0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F, 0xA3, 0xFD, 0x1F,
+    0xC4, 0x9F, 0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A,
+    0xFA, 0xFC, 0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC1,
+    0xFD, 0x92, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7, 0x29, 0x99, 0x99,
+    0x60, 0x72, 0x99, 0x5A, 0x76, 0xD9, 0x3D, 0xA7, 0x4F, 0x2A, 0xE7, 0x3F, 0xC1, 0xAF, 0x72, 0xFC,
+    0x1A, 0xF9, 0x71, 0xAE, 0xA1, 0x9F, 0x73, 0xE3, 0xAD, 0x97, 0x4A, 0xA4, 0x9A, 0x77, 0x77, 0x71,
+    0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA,
+    0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F,
+    0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC,
+    0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71,
+    0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F,
+    0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9,
+    0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x69, 0x49, 0x72, 0xDA, 0x19, 0xD9, 0x79,
+    0xE1, 0xF7, 0xF0, 0x9E, 0x96, 0x9E, 0x90, 0xAE, 0x7A, 0xDA, 0x1E, 0x97, 0xE1, 0x9D, 0xA7, 0x0A,
+    0xC3, 0xD7, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95, 0xFF, 0xFA, 0x3F, 0xFF,
+    0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA, 0xAF, 0xA5, 0xFC, 0xAA,
+    0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5, 0xAF, 0x9A, 0xFC, 0x5F,
+    0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA5,
+    0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x79, 0xAF, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0xFE, 0x49, 0xFF,
+    0xFF, 0xFF, 0xC3, 0x9F, 0xDA, 0x91, 0x9F, 0xCA, 0x99, 0xAA, 0xAF, 0x29, 0xFC, 0xA5, 0xFC, 0x95,
+    0xE2, 0xFC, 0xA6, 0xFC, 0x95, 0xE1, 0x9F, 0xC7, 0xFC, 0x95, 0xAA, 0x2F, 0xC9, 0x7F, 0xC9, 0x72,
+    0xFC, 0x70, 0xFC, 0x97, 0x19, 0xFC, 0x70, 0xFC, 0xA3, 0x99, 0x92, 0x9F, 0xA7, 0x0F, 0xFF, 0xC2,
+    0xAF, 0xA7, 0x0F, 0xFF, 0xC2, 0xAF, 0xA7, 0x0F, 0xFF, 0xA2, 0xAF, 0xC7, 0x0F, 0xCA, 0x71, 0x9F,
+    0xC7, 0x0F, 0xC9, 0x72, 0xFC, 0x70, 0xFC, 0x97, 0x2F, 0xCA, 0x7F, 0xC9, 0x6D, 0xA0, 0xAF, 0xC9,
+    0x6F, 0xC9, 0x59, 0xE1, 0xFD, 0x95, 0xFC, 0x95, 0xF1, 0x9F, 0xE9, 0x3F, 0xCA, 0x99, 0x99, 0x9A,
+    0xF2, 0x9F, 0xFF, 0xFF, 0xFD, 0xA4, 0xFF, 0xFF, 0xFF, 0xC9, 0x6A, 0xFF, 0xFF, 0xFD, 0x73, 0x99,
+    0x99, 0x97, 0x60, 0x59, 0xAA, 0xAA, 0x95, 0x9A, 0xAA, 0xA9, 0x79, 0xFF, 0xA1, 0x9F, 0xF9, 0x4A,
+    0xFF, 0xDA, 0xAF, 0xFD, 0x92, 0xFF, 0xFF, 0xCA, 0xAA, 0xFC, 0x19, 0xFA, 0x3F, 0xE3, 0xAF, 0xA0,
+    0xFC, 0x49, 0xFC, 0xA4, 0xFA, 0x9F, 0xC5, 0xFC, 0x94, 0xFC, 0xAF, 0xA5, 0xFC, 0xA9, 0x99, 0x99,
+    0xFC, 0xAF, 0xA5, 0xAF, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xDA, 0xFC, 0xA5, 0xAF, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x0A, 0xFA, 0x5A, 0xF9, 0x71, 0xAF, 0xC5, 0xFC, 0xA7, 0x19, 0xFC, 0x93, 0x9F, 0xD9,
+    0x71, 0xFD, 0x92, 0xFF, 0xA9, 0x90, 0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xFF, 0xFC, 0x91, 0xAF, 0xFE,
+    0x0F, 0xFF, 0x39, 0xFF, 0xA2, 0xAF, 0xFA, 0x79, 0x99, 0x97, 0x09, 0x99, 0x99, 0x30, 0x73, 0xA9,
+    0x77, 0x29, 0xE7, 0x71, 0xAF, 0x97, 0x69, 0xFD, 0x76, 0x9F, 0xD9, 0x76, 0xAE, 0xA9, 0x77, 0x19,
+    0x77, 0x77, 0x75, 0x99, 0x99, 0x72, 0x9A, 0xFF, 0xFA, 0x96, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xFC,
+    0x7F, 0xC9, 0x19, 0xFD, 0x96, 0xFC, 0x4F, 0xD6, 0xFC, 0x49, 0xFC, 0x6F, 0xC5, 0xFC, 0x6F, 0xC4,
+    0x9F, 0xC6, 0xFC, 0x4A, 0xFA, 0x6F, 0xC3, 0x9F, 0xC7, 0xFC, 0x90, 0x9F, 0xD9, 0x7F, 0xFF, 0xC9,
+    0x70, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x72, 0xFC, 0x99, 0xFC, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xFC,
+    0x2F, 0xCA, 0x70, 0xFC, 0x3F, 0xCA, 0x7F, 0xC3, 0x9F, 0xCA, 0x6F, 0xC4, 0xAF, 0xD3, 0x9F, 0xFA,
+    0x2F, 0xE9, 0x0A, 0xFF, 0xD3, 0xFE, 0xAF, 0xFE, 0x4A, 0xFC, 0x77, 0x29, 0xAA, 0x10, 0x71, 0x97,
+    0x59, 0xD7, 0x4E, 0xA7, 0x2A, 0xEA, 0x72, 0xF7, 0x2A, 0xE9, 0x72, 0xE9, 0x74, 0xC7, 0x77, 0x77,
+    0x29, 0x9A, 0x92, 0x9A, 0xA2, 0xAF, 0xCA, 0x1F, 0xC0, 0x9F, 0xE0, 0xFD, 0x1F, 0xFF, 0xD3, 0xAF,
+    0xFD, 0x93, 0x9F, 0xCA, 0x29, 0x49, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19,
+    0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x70, 0x9F, 0xEA, 0x5F, 0xFE,
+    0x4F, 0xFD, 0xA3, 0x79, 0x99, 0x97, 0x29, 0xAF, 0xFF, 0xA9, 0x6F, 0xFF, 0xFA, 0x5A, 0xFF, 0xFF,
+    0xC7, 0xFC, 0x91, 0x9F, 0xD9, 0x6F, 0xC4, 0xFD, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC,
+    0x49, 0xFC, 0x6F, 0xC4, 0xAF, 0xA6, 0xFC, 0x39, 0xFC, 0x7F, 0xC9, 0x09, 0xFD, 0x97, 0xFF, 0xFC,
+    0x97, 0x0F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x2F, 0xC9, 0x9F, 0xC7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1F,
+    0xC2, 0xFC, 0xA7, 0x0F, 0xC3, 0xFC, 0xA7, 0xFC, 0x39, 0xFC, 0xA6, 0xFC, 0x4A, 0xFD, 0x39, 0xFF,
+    0xA2, 0xFE, 0x90, 0xAF, 0xFD, 0x3F, 0xEA, 0xFF, 0xE4, 0xAF, 0xC7, 0x72, 0x9A, 0xA7, 0x49, 0x97,
+    0x72, 0xAF, 0x77, 0x19, 0xF9, 0x77, 0x1F, 0x97, 0x71, 0xF7, 0x72, 0xEA, 0x77, 0x1E, 0xA7, 0x72,
+    0x9A, 0x97, 0x20, 0x39, 0x9A, 0x92, 0x9A, 0xA2, 0xAF, 0xCA, 0x1F, 0xC0, 0x9F, 0xE0, 0xFD, 0x1F,
+    0xFF, 0xD3, 0xAF, 0xFD, 0x93, 0x9F, 0xCA, 0x29, 0x49, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71,
+    0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x70, 0x9F,
+    0xEA, 0x5F, 0xFE, 0x4F, 0xFD, 0xA7, 0x77, 0x09, 0x97, 0x4F, 0x73, 0xFA, 0x72, 0x9E, 0xA7, 0x29,
+    0xE9, 0x72, 0xAE, 0x72, 0xAE, 0x73, 0x9A, 0x97, 0x10, 0x3A, 0xA5, 0x9C, 0xA7, 0x2A, 0xD9, 0x3A,
+    0xE9, 0x71, 0x9E, 0xA1, 0x9E, 0x97, 0x3A, 0xEA, 0x9E, 0x97, 0x5F, 0xE9, 0x77, 0xAF, 0xA7, 0x71,
+    0x9D, 0xA7, 0x77, 0x77, 0x29, 0x99, 0x97, 0x29, 0xAF, 0xFF, 0xA9, 0x6F, 0xFF, 0xFA, 0x5A, 0xFF,
+    0xFF, 0xC7, 0xFC, 0x91, 0x9F, 0xD9, 0x6F, 0xC4, 0xFD, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6,
+    0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0xAF, 0xA6, 0xFC, 0x39, 0xFC, 0x7F, 0xC9, 0x09, 0xFD, 0x97, 0xFF,
+    0xFC, 0x97, 0x0F, 0xFE, 0xA7, 0x2F, 0xFE, 0x97, 0x2F, 0xC9, 0x9F, 0xC7, 0x2F, 0xC1, 0xAF, 0xC7,
+    0x1F, 0xC2, 0xFC, 0xA7, 0x0F, 0xC3, 0xFC, 0xA7, 0xFC, 0x39, 0xFC, 0xA6, 0xFC, 0x4A, 0xFD, 0x39,
+    0xFF, 0xA2, 0xFE, 0x90, 0xAF, 0xFD, 0x3F, 0xEA, 0xFF, 0xE4, 0xAF, 0xC7, 0x72, 0x9A, 0xA1, 0x77,
+    0x3D, 0x4A, 0xD4, 0xAD, 0xA2, 0xAE, 0x49, 0xE9, 0x09, 0xE6, 0xAE, 0xAE, 0x97, 0xAF, 0xCA, 0x71,
+    0xFC, 0x73, 0xAD, 0x97, 0x77, 0x77, 0x09, 0x9A, 0x92, 0x9A, 0xA2, 0xAF, 0xCA, 0x1F, 0xC0, 0x9F,
+    0xE0, 0xFD, 0x1F, 0xFF, 0xD3, 0xAF, 0xFD, 0x93, 0x9F, 0xCA, 0x29, 0x49, 0xFA, 0x71, 0x9F, 0xA7,
+    0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19,
+    0xFA, 0x70, 0x9F, 0xEA, 0x5F, 0xFE, 0x4F, 0xFD, 0xA3, 0x72, 0x9A, 0x75, 0xAD, 0xA7, 0x29, 0xFC,
+    0x71, 0xAF, 0xD7, 0x0F, 0xE7, 0x1F, 0xA7, 0x39, 0x97, 0x77, 0x70, 0x99, 0xAA, 0x99, 0x79, 0xFF,
+    0xD9, 0x3A, 0xFF, 0xF2, 0xAF, 0xFF, 0xC2, 0xFC, 0x93, 0xF1, 0xAF, 0x94, 0xAE, 0x1F, 0xC5, 0xAE,
+    0x1F, 0xC9, 0x49, 0xD9, 0x1F, 0xD7, 0x2A, 0xFD, 0xA7, 0x09, 0xFF, 0xA7, 0xAF, 0xFC, 0xA6, 0xAF,
+    0xFD, 0x95, 0x9F, 0xFD, 0x96, 0x9F, 0xFC, 0x71, 0xAF, 0xDA, 0x09, 0xAA, 0x59, 0xFC, 0xA0, 0xE6,
+    0x9F, 0xA9, 0xE9, 0x59, 0xFA, 0x9F, 0x5A, 0xF9, 0x9F, 0xC3, 0x9F, 0xC1, 0xFF, 0xFD, 0x91, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFD, 0xA7, 0x99, 0xAA, 0xA9, 0x95, 0x70, 0x97, 0x4D, 0xA7, 0x29, 0xE9, 0x71,
+    0xF9, 0x70, 0xAE, 0xA7, 0x1F, 0x71, 0x9E, 0x73, 0xAA, 0x77, 0x77, 0x71, 0x9A, 0xAA, 0xA9, 0x69,
+    0xFF, 0xC9, 0x2A, 0xFF, 0xE1, 0x9F, 0x91, 0x9F, 0x1A, 0xEA, 0x39, 0xE1, 0xFA, 0x4D, 0xA1, 0xFD,
+    0x92, 0x99, 0x2A, 0xFE, 0xA6, 0xFF, 0xCA, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x1A, 0xCA,
+    0x39, 0xFC, 0x99, 0xE4, 0x9F, 0x99, 0xE9, 0x39, 0xF0, 0x9F, 0xC9, 0x9A, 0xFA, 0x1F, 0xFE, 0xA2,
+    0xAF, 0xFC, 0x96, 0x99, 0x99, 0x95, 0x69, 0xAC, 0xA7, 0x4F, 0xC7, 0x2F, 0xE7, 0x0F, 0x9F, 0x6F,
+    0x19, 0xEA, 0x4F, 0x39, 0xE5, 0xAA, 0x59, 0x97, 0x77, 0x29, 0x9A, 0xA9, 0x97, 0x9F, 0xFD, 0x93,
+    0xAF, 0xFF, 0x2A, 0xFF, 0xFC, 0x2F, 0xC9, 0x3F, 0x1A, 0xF9, 0x4A, 0xE1, 0xFC, 0x5A, 0xE1, 0xFC,
+    0x94, 0x9D, 0x91, 0xFD, 0x72, 0xAF, 0xDA, 0x70, 0x9F, 0xFA, 0x7A, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9,
+    0x59, 0xFF, 0xD9, 0x69, 0xFF, 0xC7, 0x1A, 0xFD, 0xA0, 0x9A, 0xA5, 0x9F, 0xCA, 0x0E, 0x69, 0xFA,
+    0x9E, 0x95, 0x9F, 0xA9, 0xF5, 0xAF, 0x99, 0xFC, 0x39, 0xFC, 0x1F, 0xFF, 0xD9, 0x1F, 0xFF, 0xC9,
+    0x29, 0xFF, 0xDA, 0x79, 0x9A, 0xAA, 0x99, 0x50, 0x59, 0xAC, 0x72, 0xAF, 0x71, 0xFD, 0x7E, 0xAE,
+    0xA5, 0x9E, 0x09, 0xE9, 0x4E, 0x29, 0xE3, 0xAD, 0x93, 0xAC, 0xA7, 0x77, 0x74, 0x9A, 0xAA, 0xA9,
+    0x69, 0xFF, 0xC9, 0x2A, 0xFF, 0xE1, 0x9F, 0x91, 0x9F, 0x1A, 0xEA, 0x39, 0xE1, 0xFA, 0x4D, 0xA1,
+    0xFD, 0x92, 0x99, 0x2A, 0xFE, 0xA6, 0xFF, 0xCA, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x1A,
+    0xCA, 0x39, 0xFC, 0x99, 0xE4, 0x9F, 0x99, 0xE9, 0x39, 0xF0, 0x9F, 0xC9, 0x9A, 0xFA, 0x1F, 0xFE,
+    0xA2, 0xAF, 0xFC, 0x96, 0x99, 0x99, 0x95, 0x69, 0x9A, 0xA9, 0x97, 0x9F, 0xFD, 0x93, 0xAF, 0xFF,
+    0x2A, 0xFF, 0xFC, 0x2F, 0xC9, 0x3F, 0x1A, 0xF9, 0x4A, 0xE1, 0xFC, 0x5A, 0xE1, 0xFC, 0x94, 0x9D,
+    0x91, 0xFD, 0x72, 0xAF, 0xDA, 0x70, 0x9F, 0xFA, 0x7A, 0xFF, 0xCA, 0x6A, 0xFF, 0xD9, 0x59, 0xFF,
+    0xD9, 0x69, 0xFF, 0xC7, 0x1A, 0xFD, 0xA0, 0x9A, 0xA5, 0x9F, 0xCA, 0x0E, 0x69, 0xFA, 0x9E, 0x95,
+    0x9F, 0xA9, 0xF5, 0xAF, 0x99, 0xFC, 0x39, 0xFC, 0x1F, 0xFF, 0xD9, 0x1F, 0xFF, 0xC9, 0x29, 0xFF,
+    0xDA, 0x79, 0x9A, 0xAA, 0x99, 0x74, 0x99, 0x97, 0x4A, 0xF9, 0x72, 0xFD, 0x74, 0xAE, 0x74, 0xAE,
+    0x73, 0xAE, 0x73, 0xF9, 0x73, 0x9A, 0x97, 0x49, 0xAA, 0xAA, 0x96, 0x9F, 0xFC, 0x92, 0xAF, 0xFE,
+    0x19, 0xF9, 0x19, 0xF1, 0xAE, 0xA3, 0x9E, 0x1F, 0xA4, 0xDA, 0x1F, 0xD9, 0x29, 0x92, 0xAF, 0xEA,
+    0x6F, 0xFC, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xC6, 0x9F, 0xE1, 0xAC, 0xA3, 0x9F, 0xC9, 0x9E, 0x49,
+    0xF9, 0x9E, 0x93, 0x9F, 0x09, 0xFC, 0x99, 0xAF, 0xA1, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x69, 0x99,
+    0x99, 0x73, 0x99, 0x73, 0xFC, 0x71, 0xFC, 0x97, 0x2E, 0xA7, 0x2E, 0x97, 0x1E, 0xA7, 0x09, 0xEA,
+    0x72, 0xAA, 0x96, 0x29, 0xA6, 0xAC, 0x94, 0xE4, 0xF4, 0xF2, 0xF6, 0xF9, 0xF7, 0x9F, 0xE7, 0x19,
+    0xFC, 0x74, 0xE9, 0x77, 0x75, 0x99, 0xAA, 0x99, 0x79, 0xFF, 0xD9, 0x3A, 0xFF, 0xF2, 0xAF, 0xFF,
+    0xC2, 0xFC, 0x93, 0xF1, 0xAF, 0x94, 0xAE, 0x1F, 0xC5, 0xAE, 0x1F, 0xC9, 0x49, 0xD9, 0x1F, 0xD7,
+    0x2A, 0xFD, 0xA7, 0x09, 0xFF, 0xA7, 0xAF, 0xFC, 0xA6, 0xAF, 0xFD, 0x95, 0x9F, 0xFD, 0x96, 0x9F,
+    0xFC, 0x71, 0xAF, 0xDA, 0x09, 0xAA, 0x59, 0xFC, 0xA0, 0xE6, 0x9F, 0xA9, 0xE9, 0x59, 0xFA, 0x9F,
+    0x5A, 0xF9, 0x9F, 0xC3, 0x9F, 0xC1, 0xFF, 0xFD, 0x91, 0xFF, 0xFC, 0x92, 0x9F, 0xFD, 0xA7, 0x99,
+    0xAA, 0xA9, 0x95, 0x77, 0x09, 0xCA, 0x4D, 0xA3, 0xE9, 0x2E, 0x93, 0xAE, 0x1A, 0xDA, 0x5F, 0xAE,
+    0x7F, 0xD9, 0x79, 0xFA, 0x71, 0x9D, 0xA7, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0x96, 0x9F, 0xFC, 0x92,
+    0xAF, 0xFE, 0x19, 0xF9, 0x19, 0xF1, 0xAE, 0xA3, 0x9E, 0x1F, 0xA4, 0xDA, 0x1F, 0xD9, 0x29, 0x92,
+    0xAF, 0xEA, 0x6F, 0xFC, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xC6, 0x9F, 0xE1, 0xAC, 0xA3, 0x9F, 0xC9,
+    0x9E, 0x49, 0xF9, 0x9E, 0x93, 0x9F, 0x09, 0xFC, 0x99, 0xAF, 0xA1, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9,
+    0x69, 0x99, 0x99, 0x50, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xAA, 0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x0F, 0x3F, 0xC9, 0x29, 0xE9, 0x0E, 0xA3, 0xFC, 0x92,
+    0x9E, 0x90, 0xE9, 0x3F, 0xC9, 0x29, 0xE2, 0xAA, 0x4F, 0xC9, 0x3A, 0xA9, 0x71, 0xFC, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC,
+    0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97,
+    0x59, 0xAF, 0xFC, 0x97, 0x2F, 0xFE, 0xA7, 0x19, 0xFF, 0xE9, 0x77, 0x77, 0x59, 0x99, 0x77, 0x2F,
+    0xC7, 0x71, 0xFD, 0x77, 0x2F, 0x77, 0x2E, 0xA7, 0x71, 0xAE, 0x77, 0x1F, 0x77, 0x2A, 0xA9, 0x72,
+    0x59, 0xA9, 0x72, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xC6, 0x9A, 0xFF, 0xE1, 0xFF, 0xFC, 0x1F,
+    0xFF, 0xA3, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC,
+    0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x1F, 0xC7, 0x1F, 0xD9, 0x9A, 0xA9, 0x3F, 0xFD,
+    0x93, 0xAF, 0xFC, 0x94, 0xAF, 0xE9, 0x79, 0x99, 0x97, 0x39, 0x97, 0x29, 0xFA, 0x70, 0x9F, 0xC7,
+    0x29, 0xE9, 0x71, 0x9E, 0x72, 0xEA, 0x70, 0x9E, 0xA7, 0x2A, 0xA5, 0x59, 0xA6, 0xAA, 0x73, 0xE4,
+    0xEA, 0x72, 0xF2, 0xEA, 0x73, 0x9F, 0x9E, 0xA7, 0x59, 0xFE, 0x77, 0x9F, 0xC7, 0x72, 0xE9, 0x77,
+    0x77, 0x77, 0x7F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xAA,
+    0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x0F, 0x3F, 0xC9, 0x29, 0xE9, 0x0E, 0xA3, 0xFC, 0x92, 0x9E, 0x90,
+    0xE9, 0x3F, 0xC9, 0x29, 0xE2, 0xAA, 0x4F, 0xC9, 0x3A, 0xA9, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97,
+    0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x59, 0xAF,
+    0xFC, 0x97, 0x2F, 0xFE, 0xA7, 0x19, 0xFF, 0xE9, 0x40, 0x77, 0x71, 0xE7, 0x3E, 0x97, 0x2E, 0x73,
+    0xE6, 0x9A, 0x90, 0x9D, 0xA5, 0xF0, 0x9D, 0x5A, 0xF1, 0xCA, 0x5F, 0xC7, 0x1F, 0xC6, 0x9A, 0xFF,
+    0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA3, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70,
+    0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x1F, 0xC7, 0x1F, 0xD9,
+    0x9A, 0xA9, 0x3F, 0xFD, 0x93, 0xAF, 0xFC, 0x94, 0xAF, 0xE9, 0x79, 0x99, 0x93, 0x0F, 0xFF, 0xFF,
+    0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xAA, 0x99, 0xFC, 0xA9, 0xAA, 0xF9,
+    0x0F, 0x3F, 0xC9, 0x29, 0xE9, 0x0E, 0xA3, 0xFC, 0x92, 0x9E, 0x90, 0xE9, 0x3F, 0xC9, 0x29, 0xE2,
+    0xAA, 0x4F, 0xC9, 0x3A, 0xA9, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x49, 0xAA, 0xAF, 0xCA, 0xAA,
+    0xA7, 0x1A, 0xFF, 0xF7, 0x19, 0xFF, 0xEA, 0x75, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97,
+    0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x59, 0xAF, 0xFC, 0x97,
+    0x2F, 0xFE, 0xA7, 0x19, 0xFF, 0xE9, 0x40, 0x59, 0xA9, 0x72, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F,
+    0xC6, 0x9A, 0xFF, 0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA3, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7,
+    0x09, 0xFC, 0x6A, 0xFF, 0xE2, 0xFF, 0xF2, 0x99, 0xAF, 0xC9, 0x99, 0x94, 0x9F, 0xC7, 0x09, 0xFC,
+    0x71, 0xFC, 0x71, 0xFD, 0x99, 0xAA, 0x93, 0xFF, 0xD9, 0x3A, 0xFF, 0xC9, 0x4A, 0xFE, 0x97, 0x99,
+    0x99, 0x30, 0x77, 0x77, 0x2A, 0xE2, 0xAC, 0x77, 0xFD, 0x90, 0xDA, 0x76, 0xFF, 0xDA, 0x76, 0xDA,
+    0x0A, 0xFC, 0x97, 0x6A, 0xC2, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9F, 0xFD, 0xA2, 0x9F,
+    0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD,
+    0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10,
+    0x59, 0xE9, 0x2A, 0x97, 0x29, 0xFC, 0x90, 0xAD, 0x72, 0xAF, 0xFD, 0x72, 0xE9, 0x9F, 0xD7, 0x29,
+    0xCA, 0x19, 0xF7, 0x72, 0x97, 0x77, 0x77, 0x77, 0x29, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A,
+    0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA,
+    0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39,
+    0x99, 0x30, 0x79, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x7F, 0xFD, 0xA7, 0x6F, 0xFD, 0xA7, 0x6A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD,
+    0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC,
+    0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF, 0xFF,
+    0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10, 0x49, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x72, 0xAF, 0xFD, 0x97, 0x1F, 0xFE, 0x73, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77,
+    0x77, 0x77, 0x79, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A,
+    0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A,
+    0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC,
+    0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x77, 0x77, 0x1A, 0xC9,
+    0x5C, 0xA7, 0x6E, 0x93, 0xE7, 0x6F, 0xCA, 0xFA, 0x76, 0xAF, 0xFC, 0x77, 0x09, 0xFD, 0xA7, 0x73,
+    0x99, 0x97, 0x77, 0x77, 0x77, 0x79, 0xFF, 0xDA, 0x29, 0xFF, 0xD9, 0xFF, 0xDA, 0x2A, 0xFF, 0xD0,
+    0xFF, 0xCA, 0x39, 0xFF, 0xA3, 0xAF, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC6, 0xFC, 0x96, 0x9F,
+    0xA6, 0xFD, 0x6F, 0xC9, 0x6A, 0xFD, 0xA9, 0x09, 0xAF, 0xD7, 0x0F, 0xFF, 0xF7, 0x2F, 0xFF, 0xD9,
+    0x73, 0xAF, 0xFD, 0xA7, 0x70, 0x9A, 0xAA, 0xA9, 0x71, 0x59, 0x96, 0x97, 0x29, 0xD5, 0xAC, 0x72,
+    0xF9, 0x2A, 0xD7, 0x2A, 0xFF, 0xCA, 0x73, 0xFF, 0xA7, 0x59, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x29,
+    0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9,
+    0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F,
+    0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x73, 0x99, 0x97, 0x74, 0x9F, 0xC9, 0x77,
+    0x19, 0xEA, 0xE7, 0x71, 0xE1, 0x9D, 0xA7, 0x70, 0xDA, 0x2D, 0xA7, 0x70, 0xE2, 0xD9, 0x77, 0x0A,
+    0xEA, 0xE7, 0x72, 0xFD, 0x77, 0x49, 0x99, 0x97, 0x77, 0x74, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F,
+    0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF,
+    0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10, 0x70, 0x99,
+    0x97, 0x71, 0xFC, 0xA7, 0x6E, 0xAE, 0xA7, 0x49, 0xD2, 0xE7, 0x4A, 0xD2, 0xAD, 0x74, 0xAD, 0x2A,
+    0xD7, 0x49, 0xE9, 0x9D, 0x97, 0x5A, 0xFC, 0xA7, 0x79, 0xAC, 0xA9, 0x77, 0x77, 0x49, 0x97, 0x6A,
+    0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA,
+    0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A,
+    0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x74, 0xA5, 0x97, 0x70, 0xAC, 0xA3, 0x9D, 0x76, 0xAE,
+    0x91, 0x9E, 0xA7, 0x4A, 0xF1, 0x9F, 0x97, 0x39, 0xF9, 0x1F, 0xA7, 0x39, 0xF2, 0xF9, 0x74, 0xAD,
+    0x92, 0x9D, 0xA7, 0x7A, 0x5A, 0x97, 0x77, 0x77, 0x77, 0x39, 0xFF, 0xDA, 0x29, 0xFF, 0xD9, 0xFF,
+    0xDA, 0x2A, 0xFF, 0xD0, 0xFF, 0xCA, 0x39, 0xFF, 0xA3, 0xAF, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC5, 0x9F, 0xC7, 0x0F,
+    0xC6, 0xFC, 0x96, 0x9F, 0xA6, 0xFD, 0x6F, 0xC9, 0x6A, 0xFD, 0xA9, 0x09, 0xAF, 0xD7, 0x0F, 0xFF,
+    0xF7, 0x2F, 0xFF, 0xD9, 0x73, 0xAF, 0xFD, 0xA7, 0x70, 0x9A, 0xAA, 0xA9, 0x71, 0x70, 0x94, 0x97,
+    0x59, 0xD9, 0x1A, 0xD7, 0x4F, 0x1E, 0x97, 0x3E, 0xA0, 0xAE, 0x73, 0xAE, 0x1E, 0xA7, 0x3E, 0x90,
+    0x9E, 0x73, 0x9D, 0xA1, 0xAD, 0x97, 0x4D, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x70, 0x99, 0x76, 0xAF,
+    0xD2, 0x9A, 0xFC, 0xA2, 0xAF, 0xE2, 0xFE, 0xA2, 0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A,
+    0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93, 0xAF, 0xA5,
+    0xFD, 0x99, 0x9A, 0xFC, 0xA5, 0xAF, 0xFF, 0xEA, 0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE, 0x90, 0xAF,
+    0xD9, 0x69, 0x99, 0x93, 0x99, 0x93, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD,
+    0x0F, 0xFC, 0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69,
+    0xFA, 0x6F, 0xD6, 0xFC, 0x79, 0xFD, 0xA9, 0x99, 0xAF, 0xCA, 0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD,
+    0x74, 0x9F, 0xFD, 0xA7, 0x70, 0x99, 0x9A, 0xE7, 0x75, 0xE7, 0x75, 0xF7, 0x75, 0xF7, 0x75, 0xFC,
+    0xAA, 0x97, 0x71, 0xFE, 0x97, 0x72, 0xAF, 0xA7, 0x77, 0x70, 0x59, 0x97, 0x6A, 0xFD, 0x29, 0xAF,
+    0xCA, 0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF,
+    0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99,
+    0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x09, 0xFD, 0x79, 0x99,
+    0x94, 0xE9, 0x77, 0x0A, 0xD9, 0x77, 0x09, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xFA, 0x99, 0x76, 0xFD,
+    0xA7, 0x7A, 0xEA, 0x77, 0x60, 0x77, 0x9A, 0xAA, 0x77, 0x77, 0x0F, 0xC7, 0x77, 0x6F, 0xE7, 0x77,
+    0x4F, 0x9F, 0x77, 0x72, 0xF2, 0xF7, 0x77, 0x0A, 0xE4, 0xE7, 0x77, 0x1A, 0xA5, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xFF, 0xDA, 0x4A, 0xAA, 0x94, 0x9F, 0xFC, 0x1F, 0xFD, 0xA3, 0xAF, 0x4A,
+    0xFF, 0xC1, 0xAF, 0xFC, 0x4F, 0xC9, 0x4F, 0xF4, 0xFD, 0x6F, 0xCA, 0x6F, 0xA5, 0xAF, 0xC9, 0x49,
+    0xFD, 0x59, 0xF6, 0x9F, 0xC9, 0x4A, 0xFD, 0x5A, 0xF7, 0xFC, 0xA4, 0xFE, 0xA4, 0xFA, 0x7A, 0xFC,
+    0x4F, 0xF4, 0xF7, 0x09, 0xFC, 0x39, 0xFF, 0x39, 0xF7, 0x1F, 0xC9, 0x2A, 0xFF, 0x92, 0xAE, 0xA7,
+    0x1A, 0xFA, 0x2F, 0x9F, 0xA2, 0xF7, 0x29, 0xFC, 0x2E, 0x90, 0xFC, 0x2F, 0x73, 0xFC, 0x19, 0xE1,
+    0xFC, 0x19, 0xEA, 0x73, 0xAF, 0x90, 0xAE, 0x19, 0xFA, 0x0A, 0xE7, 0x49, 0xFA, 0x0E, 0xA2, 0xFC,
+    0x0F, 0x75, 0xFC, 0x0E, 0x3F, 0xC0, 0xEA, 0x75, 0xAF, 0xAE, 0x39, 0xFA, 0xE9, 0x75, 0x9F, 0xEA,
+    0x4F, 0xF7, 0x7F, 0xE9, 0x4F, 0xEA, 0x77, 0xAF, 0xD5, 0x9F, 0xD9, 0x77, 0x9F, 0xCA, 0x6F, 0xD7,
+    0x71, 0xFC, 0x96, 0xFC, 0xA7, 0x71, 0xFC, 0x79, 0xF9, 0x77, 0x77, 0x75, 0x74, 0x9A, 0xA9, 0x77,
+    0x71, 0xF9, 0x77, 0x7F, 0xD7, 0x76, 0x9F, 0xE7, 0x75, 0xE1, 0xEA, 0x77, 0x3E, 0x92, 0xE7, 0x72,
+    0x9D, 0xA3, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4F, 0xFC, 0x3E, 0xA3, 0xFE, 0x90, 0xFF,
+    0xC3, 0xF2, 0x9F, 0xE2, 0xFD, 0x93, 0xAF, 0x4A, 0xF4, 0xFC, 0x4F, 0xC9, 0x3A, 0xE9, 0x4F, 0xC4,
+    0xFC, 0xA3, 0xF5, 0x9F, 0xA2, 0x9F, 0xD3, 0xEA, 0x6F, 0xC2, 0xFE, 0x29, 0xE9, 0x6A, 0xF2, 0xFE,
+    0x91, 0xAE, 0x79, 0xF9, 0x09, 0xD9, 0x9E, 0xA1, 0xEA, 0x70, 0xFA, 0x0A, 0xD1, 0xF0, 0x9E, 0x71,
+    0xAF, 0x0E, 0x1F, 0x9A, 0xE7, 0x19, 0xF9, 0xDA, 0x1A, 0xEA, 0xE9, 0x72, 0xFE, 0x92, 0xFE, 0x73,
+    0xAF, 0xD3, 0xFD, 0xA7, 0x4F, 0xCA, 0x3A, 0xFC, 0x97, 0x4F, 0xC9, 0x39, 0xFC, 0x75, 0x9F, 0x5F,
+    0xA7, 0x77, 0x74, 0x71, 0x9A, 0xCA, 0x77, 0x29, 0xFA, 0x77, 0x09, 0xFD, 0xA7, 0x7E, 0xAA, 0xEA,
+    0x75, 0xEA, 0x19, 0xE9, 0x73, 0xEA, 0x39, 0xDA, 0x74, 0xA9, 0x59, 0x97, 0x77, 0x77, 0x76, 0x9F,
+    0xFD, 0x91, 0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x29, 0xFE, 0x92, 0x9F, 0xD6,
+    0xAE, 0xA5, 0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9, 0x3F, 0x71, 0xAF, 0xC2, 0xAE,
+    0x97, 0x2F, 0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9, 0xEA, 0x76, 0xFF, 0x77, 0xAF,
+    0xD9, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7,
+    0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF, 0xF7, 0x3F, 0xFF, 0x50, 0x70,
+    0x9A, 0xA7, 0x71, 0xFC, 0x77, 0x9F, 0xCA, 0x76, 0xEA, 0xE9, 0x74, 0xAD, 0xA0, 0xAE, 0x73, 0x9E,
+    0x2A, 0xDA, 0x72, 0xE4, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x79, 0xFF, 0xCA, 0x1A, 0xFE, 0x90, 0xFF,
+    0xC9, 0x1A, 0xFE, 0x2F, 0xDA, 0x49, 0xFA, 0x4F, 0xCA, 0x5F, 0x5A, 0xFC, 0x4A, 0xEA, 0x6F, 0xC4,
+    0xF7, 0xAF, 0xA2, 0x9F, 0x79, 0xFC, 0x2A, 0xE9, 0x70, 0xFC, 0x2F, 0x71, 0x9F, 0x90, 0x9E, 0x97,
+    0x2F, 0xA0, 0xF7, 0x3A, 0xF9, 0xEA, 0x74, 0xFF, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0xAF, 0xC7,
+    0x79, 0xF9, 0x77, 0x0F, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x59, 0xAF, 0xC7, 0x2A, 0xFF, 0xC9, 0x72,
+    0x9F, 0xF9, 0x74, 0xFE, 0x76, 0x9A, 0xAA, 0xA7, 0x70, 0x69, 0x94, 0x99, 0x75, 0xF9, 0x1F, 0x97,
+    0x29, 0xFA, 0x09, 0xFC, 0x72, 0x9F, 0xA1, 0xFC, 0x73, 0xF2, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x59, 0xFF, 0xD9, 0x1A, 0xFF, 0x9A, 0xFF, 0xD2, 0xFF, 0xC9, 0x0F, 0xFC, 0x92, 0x9F, 0xE9, 0x29,
+    0xFD, 0x6A, 0xEA, 0x59, 0xFC, 0x95, 0xF7, 0xFD, 0x4A, 0xEA, 0x79, 0xFC, 0x93, 0xF7, 0x1A, 0xFC,
+    0x2A, 0xE9, 0x72, 0xFC, 0x91, 0xEA, 0x73, 0x9F, 0xC0, 0xAE, 0x75, 0xFC, 0x9E, 0xA7, 0x6F, 0xF7,
+    0x7A, 0xFD, 0x97, 0x70, 0xFD, 0x77, 0x1A, 0xFA, 0x77, 0x1A, 0xFA, 0x77, 0x1A, 0xFA, 0x77, 0x1A,
+    0xFA, 0x77, 0x1A, 0xFA, 0x77, 0x1A, 0xFA, 0x77, 0xAF, 0xFC, 0xA7, 0x3F, 0xFF, 0x73, 0xFF, 0xF5,
+    0x74, 0xA7, 0x70, 0xAD, 0xA7, 0x6F, 0xC7, 0x4A, 0xFD, 0x73, 0xAF, 0xD7, 0x4F, 0xA9, 0x75, 0x99,
+    0x77, 0x77, 0x77, 0x4F, 0xFF, 0xEA, 0x3F, 0xFF, 0xF9, 0x19, 0xFF, 0xFF, 0xA1, 0x9F, 0xA9, 0x99,
+    0x99, 0xFD, 0x29, 0xE5, 0x9F, 0xCA, 0x29, 0xE5, 0xFD, 0x4D, 0x94, 0xAF, 0xC7, 0x49, 0xFC, 0x97,
+    0x4F, 0xD7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC, 0xA7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39,
+    0xFC, 0xA7, 0x4F, 0xD5, 0x9A, 0x93, 0xFD, 0x6E, 0x2A, 0xFC, 0xA5, 0x9E, 0x91, 0xFD, 0x6A, 0xE1,
+    0xFD, 0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xCA, 0x19, 0xFF, 0xFF, 0x97,
+    0x74, 0x70, 0x99, 0x76, 0xDA, 0x74, 0x9E, 0x74, 0xF7, 0x3A, 0xEA, 0x73, 0xEA, 0x73, 0x9D, 0xA7,
+    0x5A, 0xA7, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xC9, 0x19, 0xFF, 0xFD, 0x19, 0xFF, 0xFC, 0xA1, 0x9E,
+    0x3A, 0xFC, 0x29, 0xD9, 0x29, 0xFC, 0x4D, 0x3F, 0xC9, 0x71, 0xFC, 0xA7, 0x1F, 0xD7, 0x1A, 0xFC,
+    0x71, 0x9F, 0xC7, 0x2F, 0xC9, 0x3A, 0x93, 0xFC, 0xA3, 0xAD, 0x2F, 0xD4, 0xE1, 0xAF, 0xC4, 0xAE,
+    0x1F, 0xFF, 0xE1, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xC9, 0x77, 0x10, 0x77, 0x73, 0xAE, 0x76, 0xAF,
+    0xA7, 0x5F, 0xCA, 0x75, 0xAF, 0xA7, 0x6E, 0xA7, 0x77, 0x77, 0x77, 0x75, 0xFF, 0xFE, 0xA3, 0xFF,
+    0xFF, 0x91, 0x9F, 0xFF, 0xFA, 0x19, 0xFA, 0x99, 0x99, 0x9F, 0xD2, 0x9E, 0x59, 0xFC, 0xA2, 0x9E,
+    0x5F, 0xD4, 0xD9, 0x4A, 0xFC, 0x74, 0x9F, 0xC9, 0x74, 0xFD, 0x74, 0xFD, 0x74, 0xAF, 0xC9, 0x73,
+    0x9F, 0xCA, 0x74, 0xFD, 0x74, 0xAF, 0xC9, 0x73, 0x9F, 0xCA, 0x74, 0xFD, 0x59, 0xA9, 0x3F, 0xD6,
+    0xE2, 0xAF, 0xCA, 0x59, 0xE9, 0x1F, 0xD6, 0xAE, 0x1F, 0xD9, 0x99, 0x99, 0x99, 0xAF, 0x1F, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFC, 0xA1, 0x9F, 0xFF, 0xF9, 0x77, 0x40, 0x6A, 0xAA, 0x74, 0xFC, 0x72, 0x9F,
+    0xC7, 0x3F, 0xC7, 0x3F, 0x97, 0x59, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFC, 0x91, 0x9F, 0xFF, 0xD1,
+    0x9F, 0xFF, 0xCA, 0x19, 0xE3, 0xAF, 0xC2, 0x9D, 0x92, 0x9F, 0xC4, 0xD3, 0xFC, 0x97, 0x1F, 0xCA,
+    0x71, 0xFD, 0x71, 0xAF, 0xC7, 0x19, 0xFC, 0x72, 0xFC, 0x93, 0xA9, 0x3F, 0xCA, 0x3A, 0xD2, 0xFD,
+    0x4E, 0x1A, 0xFC, 0x4A, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xDA, 0x19, 0xFF, 0xFC, 0x97, 0x71, 0x39,
+    0xA6, 0xAC, 0x97, 0xE4, 0xF7, 0xF2, 0xF7, 0x1F, 0x9A, 0xE7, 0x29, 0xFE, 0x75, 0xFC, 0x97, 0x6A,
+    0xD9, 0x77, 0x77, 0x77, 0x1F, 0xFF, 0xEA, 0x3F, 0xFF, 0xF9, 0x19, 0xFF, 0xFF, 0xA1, 0x9F, 0xA9,
+    0x99, 0x99, 0xFD, 0x29, 0xE5, 0x9F, 0xCA, 0x29, 0xE5, 0xFD, 0x4D, 0x94, 0xAF, 0xC7, 0x49, 0xFC,
+    0x97, 0x4F, 0xD7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC, 0xA7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97,
+    0x39, 0xFC, 0xA7, 0x4F, 0xD5, 0x9A, 0x93, 0xFD, 0x6E, 0x2A, 0xFC, 0xA5, 0x9E, 0x91, 0xFD, 0x6A,
+    0xE1, 0xFD, 0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xCA, 0x19, 0xFF, 0xFF,
+    0x97, 0x74, 0x77, 0x3A, 0xCA, 0x4D, 0xA5, 0xE3, 0xE9, 0x5F, 0x1E, 0xA7, 0xFA, 0xE7, 0x09, 0xFD,
+    0x72, 0x9F, 0x97, 0x39, 0xDA, 0x77, 0x77, 0x77, 0x73, 0xFF, 0xFC, 0x91, 0x9F, 0xFF, 0xD1, 0x9F,
+    0xFF, 0xCA, 0x19, 0xE3, 0xAF, 0xC2, 0x9D, 0x92, 0x9F, 0xC4, 0xD3, 0xFC, 0x97, 0x1F, 0xCA, 0x71,
+    0xFD, 0x71, 0xAF, 0xC7, 0x19, 0xFC, 0x72, 0xFC, 0x93, 0xA9, 0x3F, 0xCA, 0x3A, 0xD2, 0xFD, 0x4E,
+    0x1A, 0xFC, 0x4A, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xDA, 0x19, 0xFF, 0xFC, 0x97, 0x71, 0x79, 0xAD,
+    0xAA, 0x70, 0xAF, 0xFA, 0x5F, 0xFE, 0x93, 0xAF, 0xCA, 0xFC, 0x93, 0xFC, 0x29, 0xE3, 0xAF, 0x93,
+    0x9C, 0x93, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73,
+    0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73,
+    0xFC, 0x73, 0xFC, 0x72, 0xAF, 0xDA, 0x95, 0x9F, 0xFD, 0xA4, 0x9F, 0xFD, 0x94, 0x77, 0x77, 0x74,
+    0xF9, 0x77, 0x3F, 0xC7, 0x73, 0xFC, 0x71, 0x99, 0xAA, 0x94, 0xFA, 0x6A, 0xFF, 0xCA, 0x09, 0xF5,
+    0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xCA, 0x91, 0x9F, 0xEA, 0x49, 0xFC, 0x6A,
+    0xFD, 0x4F, 0xC9, 0x7F, 0xD9, 0x2A, 0xFA, 0x71, 0xFD, 0x2F, 0xC9, 0x71, 0xFD, 0x2F, 0xC7, 0x2A,
+    0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0xAF, 0xC7, 0x3F, 0xC9,
+    0x0A, 0xFC, 0x73, 0xFC, 0x90, 0xAF, 0xC7, 0x29, 0xFC, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x19, 0xFC,
+    0xA7, 0x1A, 0xFA, 0x2F, 0xD7, 0x1F, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F, 0xC4, 0xFD, 0x95, 0x9F, 0xC9,
+    0x4A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x6F, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xC9, 0x72, 0x9F, 0xFD,
+    0xA7, 0x79, 0x9A, 0xA9, 0x97, 0x20, 0x77, 0x97, 0x7F, 0x97, 0x5A, 0xF7, 0x59, 0xF5, 0x9A, 0xAA,
+    0xA9, 0x90, 0xAE, 0xA3, 0x9F, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD9, 0x29, 0xFA, 0x3F, 0xD2,
+    0xFC, 0x49, 0xFC, 0x90, 0x9F, 0xC5, 0xFC, 0xA0, 0xAF, 0xA5, 0xFC, 0xA0, 0xAF, 0xA5, 0xAF, 0xA0,
+    0xFC, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xAF, 0xA5, 0xAF, 0x90, 0xAF, 0xC5, 0xFC, 0x19,
+    0xFC, 0x93, 0x9F, 0xC2, 0xFD, 0x92, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x4A, 0xFF, 0xEA, 0x69, 0xFF,
+    0xA7, 0x39, 0x99, 0x99, 0x70, 0x71, 0x99, 0x99, 0x97, 0x39, 0xAF, 0xFF, 0xA5, 0xAF, 0xFF, 0xFC,
+    0x92, 0xFF, 0xFF, 0xF9, 0x0A, 0xF9, 0x0F, 0xC9, 0x1A, 0xFD, 0x0F, 0xA1, 0xFC, 0x92, 0x9F, 0xCA,
+    0xF9, 0x1F, 0xC9, 0x3A, 0xFA, 0x0E, 0xA1, 0xFC, 0x93, 0x9F, 0xC6, 0xFC, 0x93, 0x9F, 0xA6, 0xFC,
+    0x93, 0xAF, 0xA6, 0xFC, 0x93, 0xFC, 0x7F, 0xC9, 0x2F, 0xCA, 0x7F, 0xCA, 0xAF, 0xE7, 0x0F, 0xFF,
+    0xC7, 0x1F, 0xFE, 0x97, 0x2F, 0xCA, 0xAA, 0x97, 0x5F, 0xC9, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC9,
+    0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC9, 0x76, 0xAF, 0xFA, 0x73, 0xFF, 0xEA, 0x72, 0xFF, 0xE9, 0x60,
+    0x79, 0xAD, 0xAA, 0x73, 0xAF, 0xFA, 0x70, 0xFF, 0xE9, 0x6A, 0xFA, 0x99, 0xFA, 0x6F, 0xC3, 0xE6,
+    0x9F, 0x94, 0xA7, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC2, 0x9A, 0xAA, 0x96, 0xFC, 0x9F, 0xF5, 0xFF,
+    0xFE, 0x4F, 0xFF, 0xEA, 0x3F, 0xD9, 0x1A, 0xFD, 0x3F, 0xC9, 0x3A, 0xFC, 0x3F, 0xC5, 0xFC, 0x92,
+    0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F,
+    0xC3, 0xFC, 0x5F, 0xC3, 0xFC, 0x4A, 0xF9, 0x3F, 0xC9, 0x2A, 0xFC, 0x4F, 0xFF, 0xD9, 0x4F, 0xFF,
+    0xC9, 0x5F, 0xFE, 0xA7, 0xFC, 0xA9, 0x99, 0x97, 0x1F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC9,
+    0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xD7, 0x19, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x59, 0xA9, 0x72,
+    0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xC6, 0x9A, 0xFF, 0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA3, 0x9F,
+    0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x70, 0x9F, 0xC7,
+    0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x1F, 0xC7, 0x1F, 0xD9, 0x9A, 0xA9, 0x3F, 0xFD, 0xA3, 0xAF, 0xFC,
+    0x94, 0xAF, 0xF9, 0x69, 0x99, 0x9E, 0x97, 0x2E, 0x59, 0x4E, 0x4A, 0xD2, 0xAD, 0xA4, 0xFA, 0xF5,
+    0xFF, 0x95, 0x9F, 0xD9, 0x70, 0x9A, 0xA9, 0x40, 0x39, 0xAF, 0xFF, 0xFA, 0x1A, 0xFF, 0xFF, 0xEA,
+    0x0A, 0xFF, 0xFF, 0xFA, 0x0F, 0xA9, 0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x9F, 0x3F, 0xC9, 0x29, 0xE9,
+    0x9F, 0x3F, 0xC9, 0x29, 0xE9, 0x0F, 0x92, 0xFC, 0x92, 0x9E, 0x1A, 0xF2, 0xFC, 0x93, 0xAA, 0x93,
+    0x94, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC,
+    0x97, 0x70, 0xFC, 0x97, 0x59, 0xAF, 0xFC, 0x97, 0x2F, 0xFE, 0xA7, 0x19, 0xFF, 0xE9, 0x40, 0x79,
+    0xAA, 0xDA, 0x97, 0x0F, 0xFC, 0x6F, 0xFE, 0x4F, 0xCA, 0x9A, 0xF3, 0x9F, 0x92, 0xAD, 0x93, 0xFC,
+    0x4A, 0x5F, 0xC7, 0x3F, 0xC7, 0x29, 0xFC, 0x70, 0x9A, 0xFF, 0xE3, 0xFF, 0xFC, 0x3F, 0xFF, 0xA5,
+    0x9F, 0xC7, 0x29, 0xFC, 0x72, 0x9F, 0xC7, 0x29, 0xFC, 0x72, 0x9F, 0xC7, 0x29, 0xFC, 0x72, 0x9F,
+    0xC7, 0x29, 0xFC, 0x72, 0x9F, 0xC7, 0x3F, 0xC7, 0x3F, 0xD9, 0x9A, 0xA9, 0x5F, 0xFD, 0x95, 0xAF,
+    0xFC, 0x96, 0xAF, 0xE9, 0x71, 0x99, 0x99, 0x50, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xAA, 0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x0F, 0x3F, 0xC9, 0x29, 0xE9,
+    0x0E, 0xA3, 0xFC, 0x92, 0x9E, 0x90, 0xE9, 0x3F, 0xC9, 0x29, 0xE2, 0xAA, 0x4F, 0xC9, 0x3A, 0xA9,
+    0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70,
+    0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC,
+    0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xAF, 0x97,
+    0x70, 0x9F, 0x91, 0x9C, 0x75, 0xFC, 0x1E, 0x74, 0x9F, 0xFC, 0xA7, 0x4A, 0xFF, 0x97, 0x5A, 0xFD,
+    0xA7, 0x70, 0x9A, 0xA9, 0x40, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x77, 0x6A, 0xF7, 0x76, 0x9F, 0x77,
+    0x6F, 0xC0, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x90, 0x9F, 0xFD, 0xA2, 0xAF, 0xFC, 0x92, 0xFF, 0xCA,
+    0x39, 0xFE, 0xA6, 0xAF, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F,
+    0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F,
+    0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F,
+    0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x69, 0xFA, 0x70,
+    0xFD, 0x6F, 0xC9, 0x70, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x72, 0xFF, 0xFF, 0x74, 0xFF, 0xFD, 0x97,
+    0x5A, 0xFF, 0xDA, 0x77, 0x29, 0xAA, 0xAA, 0x97, 0x30, 0x77, 0x29, 0x77, 0x2F, 0x97, 0x70, 0xAF,
+    0x77, 0x09, 0xEA, 0x59, 0x96, 0x99, 0xF9, 0x0A, 0xFD, 0x29, 0xFF, 0xA0, 0xAF, 0xE2, 0xFF, 0x91,
+    0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93, 0xAF, 0xA5, 0xFD, 0x99, 0x9A, 0xFC, 0xA5, 0xAF, 0xFF, 0xEA,
+    0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE, 0x90, 0xAF, 0xD9, 0x69, 0x99, 0x93, 0x99, 0x93, 0x19, 0x4D,
+    0x92, 0xAE, 0x2A, 0xF2, 0xFC, 0x2A, 0xEA, 0x29, 0xE4, 0xC9, 0x60, 0x29, 0x39, 0xD9, 0x1F, 0x09,
+    0xF0, 0xF9, 0xAE, 0x90, 0xE9, 0x2C, 0x97, 0x00, 0x49, 0xAA, 0x7F, 0xA5, 0xAF, 0xC9, 0x39, 0xEA,
+    0xE3, 0xE9, 0x0F, 0x1A, 0xDA, 0x2E, 0x90, 0xE4, 0xD7, 0x40, 0x1A, 0xD9, 0x2A, 0x91, 0xFC, 0xA1,
+    0xD9, 0x9F, 0xFD, 0x99, 0xDA, 0x9F, 0xD1, 0xD2, 0xF9, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x9F, 0xFD, 0xAA, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x19, 0x69, 0x1D, 0x94, 0x9C,
+    0x99, 0xEA, 0x29, 0xD9, 0x0F, 0xFD, 0x19, 0xFF, 0x4A, 0xEA, 0x92, 0x09, 0xAA, 0x90, 0x9F, 0x9A,
+    0xFA, 0xAF, 0xA0, 0xF2, 0x92, 0x73, 0x9E, 0x91, 0x9E, 0x9F, 0xC1, 0xFF, 0xD1, 0xFC, 0xAE, 0x91,
+    0xAE, 0x91, 0x95, 0x91, 0x19, 0xAE, 0x92, 0xFF, 0x09, 0xE9, 0x9E, 0x99, 0xD9, 0x1A, 0xDA, 0x0A,
+    0xC2, 0xE9, 0x4A, 0xDA, 0x3F, 0xA4, 0xE6, 0x9C, 0xA7, 0x50, 0x39, 0x99, 0x4A, 0xFC, 0x2A, 0xDA,
+    0xAE, 0x1D, 0x91, 0xAD, 0x09, 0xD9, 0x19, 0xD9, 0x9D, 0x91, 0x9D, 0x1E, 0x99, 0xE1, 0x9F, 0xD4,
+    0xAC, 0xA9, 0x20, 0x19, 0x49, 0x3D, 0xA1, 0x9D, 0x90, 0x9E, 0x1F, 0x0F, 0x09, 0xEA, 0x9E, 0x90,
+    0xAE, 0x0A, 0xDA, 0x1E, 0x90, 0xE1, 0x9D, 0xA1, 0xAC, 0x92, 0xD7, 0x50, 0x74, 0xAC, 0x4A, 0xD0,
+    0xAE, 0x29, 0xE1, 0xEA, 0x1E, 0x29, 0xEA, 0xE9, 0x3A, 0xFD, 0x5A, 0xF7, 0xAD, 0x93, 0x19, 0x49,
+    0x19, 0xD9, 0x1A, 0xD1, 0xF1, 0xE9, 0x0A, 0xE9, 0x0F, 0x1E, 0xA0, 0x9E, 0x90, 0x9E, 0x1A, 0xDA,
+    0x1A, 0xD9, 0x1E, 0x2D, 0x29, 0xCA, 0x72, 0x29, 0xAE, 0xA4, 0xFF, 0xA1, 0xFF, 0xD0, 0x9D, 0x92,
+    0xAE, 0x99, 0xC5, 0x9D, 0x19, 0x69, 0x10, 0x79, 0xD9, 0x09, 0xE1, 0xEA, 0x09, 0xE1, 0xAE, 0x1F,
+    0x1A, 0xEA, 0x09, 0xF1, 0x9A, 0xA1, 0x1A, 0xDA, 0x1A, 0xF9, 0x1F, 0xA1, 0x9E, 0xA1, 0x9E, 0x91,
+    0xAE, 0x2E, 0x91, 0xEA, 0x2A, 0xCA, 0x20, 0x0A, 0xDA, 0x19, 0xFA, 0x0A, 0xF1, 0xAE, 0x91, 0x9E,
+    0x92, 0xEA, 0x29, 0xE3, 0xAE, 0x3A, 0xCA, 0x00, 0x09, 0x3E, 0x09, 0xE0, 0x9E, 0x09, 0xDA, 0x0A,
+    0xD9, 0x0A, 0xD1, 0xAC, 0x92, 0xA2, 0x6A, 0xDA, 0x1A, 0xE9, 0x09, 0xE9, 0x0A, 0xE0, 0x9E, 0x90,
+    0xAD, 0x91, 0xAC, 0x71, 0x19, 0x92, 0xF0, 0xAF, 0xAA, 0xFA, 0x9F, 0x90, 0x9A, 0xA9, 0x00, 0x0E,
+    0x92, 0xE9, 0xFC, 0x1F, 0xFD, 0x1F, 0xCA, 0xEA, 0x1A, 0xEA, 0x09, 0x99, 0x39, 0x99, 0x00, 0x29,
+    0x93, 0x9F, 0xA0, 0x9D, 0xAA, 0xD9, 0xAC, 0xA1, 0xDA, 0xDA, 0x1A, 0xCA, 0xAD, 0x99, 0xD9, 0x0F,
+    0xCA, 0x29, 0xAA, 0x91, 0x29, 0x93, 0xF2, 0xF9, 0x1A, 0xEA, 0x19, 0xE9, 0x1F, 0x1A, 0xE2, 0x9A,
+    0x92, 0x19, 0x99, 0x3A, 0xF9, 0x1A, 0xFC, 0x3A, 0xE3, 0xAE, 0x29, 0xE2, 0xAE, 0x92, 0x9A, 0xA3,
+    0x71, 0xAD, 0xA2, 0xAD, 0xA2, 0x9E, 0x3A, 0xE3, 0xAF, 0x99, 0x90, 0xFD, 0xA1, 0xAE, 0xA7, 0x00,
+    0x5E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xAA, 0xA0, 0x39, 0xAC, 0xA6,
+    0x9F, 0xC5, 0xFE, 0x3F, 0xAF, 0x1A, 0xE1, 0x9E, 0xA9, 0xE3, 0x9D, 0xA0, 0xAA, 0x59, 0xA0, 0x19,
+    0x69, 0x1D, 0x94, 0x9C, 0x99, 0xEA, 0x29, 0xD9, 0x0F, 0xFD, 0x1A, 0xFF, 0x4A, 0xEA, 0x92, 0x74,
+    0x9E, 0xA2, 0xCA, 0x1F, 0xD0, 0x9D, 0x99, 0xFF, 0xD9, 0x9D, 0x90, 0xFD, 0x1A, 0xC2, 0xAE, 0x75,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFD, 0xAA, 0xFF, 0xD9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA0, 0x29, 0xAE, 0xA4, 0xFF, 0xA1, 0xFF, 0xD0, 0x9D, 0x92, 0xAE, 0x99, 0xC5, 0x9D, 0x19, 0x69,
+    0x10, 0x79, 0x71, 0xDA, 0x79, 0xE9, 0x6F, 0x95, 0xAE, 0xA6, 0xF6, 0x9E, 0x70, 0xAA, 0x69, 0x59,
+    0x19, 0xEA, 0x1A, 0xEA, 0xFC, 0x1F, 0xFD, 0x1F, 0xC9, 0xE9, 0x19, 0xE9, 0x73, 0x0A, 0xAA, 0x92,
+    0xE9, 0x2E, 0x92, 0xF9, 0x90, 0xAF, 0xC1, 0xAE, 0x96, 0x74, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39,
+    0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F,
+    0xC7, 0x7E, 0xA0, 0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9,
+    0x73, 0xAE, 0x3A, 0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF,
+    0xFF, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A,
+    0xE9, 0x79, 0xFC, 0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF,
+    0xD0, 0xFF, 0xCA, 0x3A, 0xFF, 0xD0, 0x69, 0x99, 0x97, 0x09, 0xAF, 0xFF, 0x94, 0xFF, 0xFF, 0x3A,
+    0xFF, 0xFF, 0x5F, 0xC2, 0x9F, 0xC9, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x4F,
+    0xC4, 0xFA, 0x4F, 0xC3, 0x9F, 0x5F, 0xCA, 0xA9, 0x9F, 0x95, 0xFF, 0xFC, 0x6F, 0xFF, 0xD9, 0x4F,
+    0xCA, 0xAA, 0xFE, 0x93, 0xFC, 0x4F, 0xD3, 0xFC, 0x5F, 0xC3, 0xFC, 0x5F, 0xC3, 0xFC, 0x5F, 0xC3,
+    0xFC, 0x5F, 0xC3, 0xFC, 0x4A, 0xFC, 0x3F, 0xC9, 0x19, 0xFD, 0x91, 0xAF, 0xFF, 0xEA, 0x1A, 0xFF,
+    0xFE, 0x92, 0xFF, 0xFC, 0xA9, 0x77, 0x70, 0xAF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF,
+    0xC3, 0xFD, 0xAA, 0xAA, 0xAF, 0x3F, 0xC9, 0x4F, 0x3F, 0xC9, 0x4A, 0xE3, 0xFC, 0x94, 0xAE, 0x3F,
+    0xC9, 0x49, 0xD9, 0x3F, 0xC9, 0x59, 0x5F, 0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC, 0x97,
+    0x4F, 0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC, 0x97, 0x4F,
+    0xCA, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFE, 0x6F, 0xFE, 0xA6, 0x73, 0x99, 0x77, 0x09, 0xF7, 0x70,
+    0xFC, 0xA7, 0x6A, 0xFD, 0x76, 0xFE, 0x97, 0x49, 0xFE, 0xA7, 0x4E, 0xAF, 0xC7, 0x39, 0xE0, 0xFC,
+    0x97, 0x2A, 0xE0, 0x9F, 0xC7, 0x2E, 0x91, 0xFC, 0x71, 0xAE, 0x2F, 0xCA, 0x70, 0xEA, 0x29, 0xFC,
+    0x79, 0xE9, 0x3F, 0xC9, 0x6F, 0x4F, 0xCA, 0x6E, 0xA4, 0x9F, 0xC5, 0xAE, 0x6F, 0xC9, 0x4F, 0x6F,
+    0xCA, 0x39, 0xEA, 0x69, 0xFC, 0x3F, 0x70, 0xFC, 0x91, 0x9F, 0x70, 0xFD, 0x1F, 0x97, 0x09, 0xFC,
+    0x1F, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xFA, 0x9F, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF,
+    0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC,
+    0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF,
+    0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC,
+    0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF,
+    0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x1F, 0xFF, 0xEA, 0x3F, 0xFF, 0xF9,
+    0x19, 0xFF, 0xFF, 0xA1, 0x9F, 0xA9, 0x99, 0x99, 0xFD, 0x29, 0xE5, 0x9F, 0xCA, 0x29, 0xE5, 0xFD,
+    0x4D, 0x94, 0xAF, 0xC7, 0x49, 0xFC, 0x97, 0x4F, 0xD7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC,
+    0xA7, 0x4F, 0xD7, 0x4A, 0xFC, 0x97, 0x39, 0xFC, 0xA7, 0x4F, 0xD5, 0x9A, 0x93, 0xFD, 0x6E, 0x2A,
+    0xFC, 0xA5, 0x9E, 0x91, 0xFD, 0x6A, 0xE1, 0xFD, 0x99, 0x99, 0x99, 0x9A, 0xF1, 0xFF, 0xFF, 0xD1,
+    0xFF, 0xFF, 0xCA, 0x19, 0xFF, 0xFF, 0x97, 0x74, 0xAF, 0xFD, 0x92, 0xFF, 0xE0, 0xFF, 0xE9, 0x2F,
+    0xFE, 0x0A, 0xFF, 0xC9, 0x3A, 0xFF, 0xC9, 0x3F, 0xCA, 0x79, 0xFC, 0x95, 0xFC, 0x97, 0x0F, 0xC6,
+    0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6,
+    0xFC, 0xA7, 0x9F, 0xC6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xF6, 0xFC, 0xA7, 0x0F,
+    0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0x97, 0x0F,
+    0xC6, 0xFC, 0x97, 0x0F, 0xC6, 0xFC, 0xA7, 0x0F, 0xC9, 0x39, 0xFF, 0xA4, 0xAF, 0xFA, 0x0A, 0xFF,
+    0xD9, 0x2F, 0xFE, 0x0F, 0xFE, 0x92, 0xFF, 0xE0, 0x71, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72,
+    0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD,
+    0x3F, 0xC7, 0x0A, 0xFC, 0x91, 0xAF, 0xA7, 0x1F, 0xD1, 0xFC, 0x97, 0x1A, 0xFC, 0x1F, 0xC7, 0x29,
+    0xFC, 0x99, 0xFC, 0x29, 0x99, 0x99, 0x3F, 0xC9, 0x9F, 0xC1, 0xAF, 0xDA, 0x1F, 0xC9, 0xAF, 0xC1,
+    0xFE, 0xA1, 0xFC, 0x9A, 0xFC, 0x1F, 0xE9, 0x1F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC0, 0x9F, 0xC7, 0x29,
+    0xFC, 0x09, 0xFC, 0x97, 0x19, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC, 0x97, 0x9F, 0xC3, 0xFD,
+    0x96, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0xAF, 0xFD, 0xAF, 0xFE, 0x9A, 0xFF, 0xCA, 0x3F,
+    0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F,
+    0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F,
+    0xCA, 0x39, 0xFF, 0xC9, 0xAF, 0xFD, 0xAF, 0xFE, 0x90, 0xAF, 0xFD, 0x2F, 0xFC, 0x9F, 0xFE, 0x19,
+    0xFF, 0xC0, 0xAF, 0xFA, 0x39, 0xFD, 0xA4, 0xFC, 0x95, 0xFC, 0x6F, 0xC9, 0x4F, 0xC7, 0xFC, 0x93,
+    0xFC, 0x70, 0xFC, 0x92, 0xFC, 0x71, 0xFC, 0x91, 0xFA, 0x72, 0xFC, 0x90, 0xFA, 0x73, 0xFC, 0x9F,
+    0xA7, 0x4F, 0xFD, 0x75, 0xFF, 0xDA, 0x74, 0xFC, 0xAF, 0xCA, 0x73, 0xFC, 0x9A, 0xFC, 0x97, 0x2F,
+    0xC9, 0x0F, 0xD9, 0x71, 0xFC, 0x91, 0xFD, 0x71, 0xFC, 0x91, 0x9F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFD,
+    0x7F, 0xC9, 0x3A, 0xFD, 0x95, 0xFC, 0x94, 0xFE, 0x92, 0x9F, 0xFA, 0x3F, 0xEA, 0x0A, 0xFF, 0xD9,
+    0x3F, 0xFF, 0xFE, 0x5A, 0xFC, 0x77, 0x39, 0xA9, 0x10, 0x74, 0x9A, 0x77, 0x4F, 0x97, 0x72, 0xFC,
+    0xA7, 0x72, 0xFD, 0x77, 0x1A, 0xFD, 0x97, 0x70, 0xFE, 0xA7, 0x79, 0xFF, 0x77, 0xEA, 0xAF, 0x97,
+    0x59, 0xE9, 0x9F, 0xA7, 0x5A, 0xE1, 0xFC, 0x75, 0xEA, 0x1F, 0xC9, 0x73, 0x9E, 0x29, 0xFC, 0x73,
+    0xF3, 0xFC, 0x72, 0x9E, 0xA3, 0xFC, 0x97, 0x1A, 0xE4, 0xAF, 0xC7, 0x1F, 0x49, 0xFC, 0x70, 0xAE,
+    0x95, 0xFC, 0xA7, 0xF6, 0xAF, 0xC6, 0x9F, 0x69, 0xFC, 0x6A, 0xE9, 0x7F, 0xCA, 0x5F, 0x70, 0xAF,
+    0xC3, 0xAF, 0xDA, 0x49, 0xAF, 0xF0, 0xAF, 0xFA, 0x29, 0xFF, 0xDA, 0xFF, 0xCA, 0x29, 0xFF, 0xD9,
+    0x2F, 0xFC, 0x7F, 0xFA, 0x4F, 0xFC, 0x69, 0xFF, 0xC4, 0x9F, 0xFA, 0x5A, 0xFF, 0x96, 0xFF, 0x5F,
+    0xEA, 0x70, 0xFF, 0x49, 0xFE, 0xA7, 0x0F, 0xF9, 0x3A, 0xFE, 0xA7, 0x0E, 0x9F, 0xA3, 0xE9, 0xFC,
+    0x70, 0xE9, 0xAF, 0x3E, 0x0F, 0xC7, 0x9E, 0x99, 0xF2, 0xAE, 0x0F, 0xC7, 0x9E, 0x1F, 0x91, 0xEA,
+    0x0A, 0xF7, 0xAE, 0x1F, 0xC1, 0xE1, 0xAF, 0x7A, 0xE1, 0x9F, 0x09, 0xE1, 0xAF, 0x96, 0xF2, 0xF9,
+    0xAD, 0xA1, 0x9F, 0x96, 0xF2, 0xFA, 0xE2, 0x9F, 0x96, 0xF2, 0x9F, 0xE2, 0x9F, 0xA6, 0xF3, 0xFD,
+    0xA3, 0xFA, 0x6E, 0xA3, 0xFD, 0x4F, 0xA5, 0x9E, 0xA3, 0x9F, 0xC4, 0xFC, 0x59, 0xEA, 0x4F, 0xA4,
+    0xFC, 0x5A, 0xE9, 0x4A, 0xE9, 0x4F, 0xC4, 0xAF, 0xCA, 0xA2, 0x9E, 0x39, 0xFF, 0x90, 0xFF, 0xC9,
+    0x70, 0x9F, 0xFC, 0xA9, 0xFF, 0xC7, 0x19, 0xFF, 0xC9, 0x0F, 0xF6, 0x9F, 0xFC, 0x90, 0xFF, 0xC5,
+    0xAF, 0xFC, 0x90, 0xAF, 0xF9, 0x49, 0xFF, 0x93, 0x9F, 0xE7, 0xAE, 0xA6, 0xFF, 0x6A, 0xEA, 0x6F,
+    0xFA, 0x5A, 0xEA, 0x6F, 0xFC, 0x5A, 0xEA, 0x6F, 0xFD, 0x4A, 0xEA, 0x6F, 0xAF, 0xCA, 0x3A, 0xEA,
+    0x6F, 0x0F, 0xD9, 0x2A, 0xEA, 0x6F, 0x1F, 0xD2, 0xAE, 0xA6, 0xF1, 0xAF, 0xCA, 0x1A, 0xEA, 0x6F,
+    0x2F, 0xD9, 0x0A, 0xEA, 0x6F, 0x3F, 0xD0, 0xAE, 0xA6, 0xF3, 0x9F, 0xDA, 0xEA, 0x6F, 0x4F, 0xFD,
+    0xA6, 0xF5, 0xFF, 0xCA, 0x6F, 0x59, 0xFF, 0xA6, 0xF6, 0xAF, 0xEA, 0x6F, 0x7F, 0xEA, 0x4A, 0xFE,
+    0x94, 0x9F, 0xDA, 0x3F, 0xFD, 0x5A, 0xFC, 0xA3, 0xFF, 0xD6, 0xFC, 0x97, 0x75, 0xA9, 0x50, 0x0F,
+    0xFF, 0xFC, 0xA1, 0xFF, 0xFF, 0xCA, 0x1F, 0xFF, 0xFC, 0xA1, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0xA1, 0xEA, 0x71, 0xEA, 0x1E, 0x97, 0x1E, 0xA1, 0xE7, 0x2E, 0x92, 0xAA, 0x72, 0x9A, 0x97, 0x77,
+    0x39, 0x99, 0x99, 0x99, 0x97, 0x2F, 0xFC, 0xA7, 0x1F, 0xFC, 0xA7, 0x1F, 0xFC, 0x97, 0x77, 0x77,
+    0x59, 0xA9, 0x73, 0xAA, 0x19, 0xDA, 0x73, 0xE0, 0xAE, 0x73, 0xE9, 0xAE, 0x72, 0x9E, 0x9A, 0xEA,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x9A, 0xFF, 0xFF, 0xD9, 0xAF, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF,
+    0xD9, 0x71, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5,
+    0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71,
+    0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7,
+    0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F,
+    0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79,
+    0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF,
+    0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0xAF, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFF, 0xE9, 0x3F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0xFC, 0xA5, 0xFC,
+    0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC,
+    0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC,
+    0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC,
+    0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0xA7, 0xFC, 0xA3, 0x9F,
+    0xFA, 0x3A, 0xFF, 0xA0, 0xAF, 0xFD, 0x91, 0xAF, 0xFD, 0x9F, 0xFE, 0x91, 0xFF, 0xE9, 0x79, 0x99,
+    0x96, 0x9A, 0xFF, 0xFC, 0x92, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x3F, 0xC9, 0x1A, 0xFD, 0x92,
+    0xFC, 0x93, 0xFC, 0xA2, 0xFC, 0x93, 0xAF, 0xC2, 0xFC, 0x93, 0x9F, 0xC2, 0xFC, 0x93, 0x9F, 0xC2,
+    0xFC, 0x93, 0xAF, 0xA2, 0xFC, 0x93, 0xFC, 0x92, 0xFC, 0x92, 0xFD, 0x3F, 0xCA, 0xAF, 0xE4, 0xFF,
+    0xFC, 0x5F, 0xFE, 0x96, 0xFD, 0xAA, 0x97, 0x1F, 0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC,
+    0x97, 0x4F, 0xC9, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFD, 0xA6, 0xFF, 0xEA, 0x60, 0x1F, 0xFF, 0xFA,
+    0x1A, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x19, 0xFD, 0x6F, 0x2A, 0xFC, 0xA5, 0x9E, 0x3A, 0xFC,
+    0x95, 0xE4, 0xFD, 0x5D, 0xA5, 0xFD, 0x75, 0x9F, 0xCA, 0x75, 0xAF, 0xC9, 0x75, 0xAF, 0xC7, 0x6F,
+    0xC7, 0x5A, 0xF9, 0x74, 0xAF, 0x97, 0x4A, 0xF9, 0x74, 0x9F, 0xA5, 0x9D, 0x39, 0xFA, 0x6E, 0x91,
+    0x9F, 0xA7, 0xE9, 0x09, 0xFA, 0x7A, 0xE9, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC0, 0x9F, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xF9, 0x77, 0x40, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0F, 0xAA, 0x99, 0xFC, 0xA9, 0xAA, 0xF9, 0x0F, 0x3F, 0xC9,
+    0x29, 0xE9, 0x0E, 0xA3, 0xFC, 0x92, 0x9E, 0x90, 0xE9, 0x3F, 0xC9, 0x29, 0xE2, 0xAA, 0x4F, 0xC9,
+    0x3A, 0xA9, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC,
+    0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97,
+    0x70, 0xFC, 0x97, 0x70, 0xFC, 0x97, 0x59, 0xAF, 0xFC, 0x97, 0x2F, 0xFE, 0xA7, 0x19, 0xFF, 0xE9,
+    0x40, 0x39, 0xA9, 0x73, 0x99, 0x3A, 0xFC, 0x70, 0xAF, 0x09, 0xFE, 0x96, 0x9F, 0xCA, 0xAF, 0xF6,
+    0xFC, 0xA1, 0x99, 0xAF, 0xC9, 0x4A, 0xFA, 0x5F, 0xCA, 0x4F, 0xC7, 0xFC, 0x3A, 0xF7, 0x0A, 0xF9,
+    0x2F, 0x97, 0x1F, 0xA1, 0xAE, 0xA7, 0x2A, 0xF1, 0xF7, 0x39, 0xF9, 0x9E, 0xA7, 0x4F, 0xAA, 0xE7,
+    0x59, 0xFE, 0x97, 0x6F, 0xE7, 0x7A, 0xFC, 0xA7, 0x79, 0xFC, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77,
+    0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC9, 0x75, 0x9A, 0xFF, 0xA7, 0x29, 0xFF, 0xE9, 0x71, 0x9F,
+    0xFE, 0x94, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x75, 0xFF, 0xDA, 0x75, 0xFF, 0xCA, 0x77, 0x09,
+    0xFC, 0x77, 0x29, 0xFC, 0x99, 0x74, 0xAF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFF, 0xCA, 0x4F, 0xDA, 0x9F,
+    0xC9, 0xAF, 0xD2, 0xAF, 0xA2, 0xFA, 0x19, 0xFC, 0xA1, 0xFC, 0x3F, 0xA2, 0x9F, 0xC0, 0xAF, 0x93,
+    0xFA, 0x3F, 0xC9, 0xFC, 0x93, 0xFA, 0x3A, 0xF9, 0xFC, 0x4F, 0xA3, 0xAF, 0x9A, 0xF9, 0x3F, 0xA3,
+    0xAF, 0x9A, 0xFA, 0x3F, 0xA3, 0xFC, 0x1F, 0xC9, 0x2F, 0xA2, 0xAF, 0xA1, 0xAF, 0xCA, 0x1F, 0xA1,
+    0xAF, 0xC3, 0xAF, 0xFF, 0xFE, 0x59, 0xFF, 0xFF, 0x97, 0x19, 0xAF, 0xFA, 0xA7, 0x70, 0xFA, 0x77,
+    0x29, 0xFC, 0x77, 0x09, 0xFF, 0xCA, 0x75, 0xFF, 0xE7, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x60,
+    0x09, 0xFF, 0xD9, 0x1F, 0xFC, 0x1A, 0xFF, 0xD9, 0x1F, 0xFC, 0x19, 0xFF, 0xC9, 0x29, 0xFE, 0x93,
+    0x9F, 0xD5, 0x9F, 0x96, 0x9F, 0xD4, 0xFA, 0x70, 0xAF, 0xC9, 0x2F, 0xA7, 0x2A, 0xFC, 0x1A, 0xF7,
+    0x4F, 0xD9, 0xF7, 0x6F, 0xFC, 0x97, 0x69, 0xFE, 0x97, 0x70, 0xAF, 0xCA, 0x77, 0x19, 0xFD, 0x77,
+    0x1F, 0xEA, 0x77, 0xFF, 0xC9, 0x75, 0xAF, 0xAF, 0xC7, 0x49, 0xF1, 0xFD, 0x73, 0xF9, 0x2F, 0xCA,
+    0x71, 0xFC, 0x3A, 0xFC, 0x97, 0xAF, 0x5F, 0xD6, 0xAF, 0x96, 0xFD, 0x39, 0xFE, 0xA9, 0x29, 0xAF,
+    0xF9, 0x9F, 0xFD, 0x19, 0xFF, 0xEA, 0xFF, 0xCA, 0x19, 0xFF, 0xE0, 0x77, 0x70, 0x99, 0x09, 0xF9,
+    0x2F, 0xFD, 0xA2, 0xFA, 0x0F, 0xC1, 0x9F, 0xFD, 0xA1, 0xAF, 0x1A, 0xF9, 0x1A, 0xFF, 0x92, 0xFC,
+    0x19, 0xFA, 0x4F, 0xA3, 0x9F, 0xA2, 0xFC, 0x4F, 0xA3, 0x9F, 0x92, 0xFC, 0x4F, 0xA3, 0xAF, 0x92,
+    0xFC, 0x4F, 0xA3, 0xAF, 0x3A, 0xF4, 0xFA, 0x3F, 0xC3, 0xAF, 0x93, 0xFA, 0x3F, 0xC3, 0x9F, 0x93,
+    0xFA, 0x3F, 0xA4, 0xFC, 0x3F, 0xA2, 0x9F, 0x94, 0xFC, 0x92, 0xFA, 0x2F, 0xC5, 0x9F, 0xC9, 0x1F,
+    0xA1, 0xAF, 0x96, 0xAF, 0xDA, 0xFC, 0xAF, 0xCA, 0x70, 0xAF, 0xFF, 0xFA, 0x73, 0xAF, 0xFF, 0xA7,
+    0x71, 0x9F, 0xA7, 0x76, 0xFA, 0x77, 0x6F, 0xA7, 0x76, 0xFA, 0x77, 0x4A, 0xFE, 0xA7, 0x71, 0xFF,
+    0xDA, 0x77, 0x9F, 0xFD, 0xA7, 0x72, 0x99, 0xA9, 0x97, 0x72, 0xAF, 0xFC, 0xA7, 0x59, 0xFF, 0xFC,
+    0x97, 0x2A, 0xFF, 0xFE, 0x97, 0x09, 0xFC, 0xA3, 0xAF, 0xD9, 0x7F, 0xCA, 0x59, 0xFD, 0x6A, 0xFC,
+    0x7A, 0xFC, 0x95, 0xFC, 0x97, 0x0F, 0xCA, 0x49, 0xFC, 0x71, 0xFD, 0x4A, 0xFC, 0x71, 0xAF, 0xC4,
+    0xAF, 0xC7, 0x1A, 0xFC, 0x4A, 0xFC, 0x71, 0xAF, 0xC4, 0xAF, 0xC7, 0x1A, 0xFA, 0x49, 0xFC, 0x71,
+    0xAF, 0x95, 0xFC, 0x97, 0x0F, 0xC6, 0x9F, 0xA7, 0x9F, 0x97, 0xAF, 0x7F, 0xC4, 0x9D, 0x1F, 0xA5,
+    0x9F, 0x1A, 0xCA, 0x0E, 0x2F, 0xA4, 0xF2, 0xAD, 0x0E, 0x92, 0xF9, 0x2F, 0x3E, 0x0E, 0xA9, 0x99,
+    0x9E, 0xA1, 0x9E, 0x99, 0x99, 0xAE, 0x9F, 0xFE, 0x92, 0xFF, 0xE0, 0xFF, 0xE3, 0xFF, 0xE0, 0xFF,
+    0xE3, 0xAF, 0xFD, 0x00, 0x49, 0xAA, 0xA9, 0x39, 0x9A, 0xA9, 0x5F, 0xE1, 0x9F, 0x93, 0x9F, 0xFC,
+    0x0A, 0xF4, 0xFD, 0xAE, 0xAF, 0xC3, 0xAF, 0xA2, 0xFE, 0xA3, 0xFC, 0x4F, 0xD9, 0x29, 0xFA, 0x49,
+    0xFC, 0x92, 0xAF, 0x95, 0xFC, 0x3A, 0xF9, 0x5F, 0xC3, 0xFC, 0x95, 0xFC, 0x3F, 0xC9, 0x49, 0xFC,
+    0x3A, 0xFA, 0x4A, 0xFC, 0x3A, 0xFA, 0x4F, 0xD3, 0x9F, 0xC3, 0xAF, 0xD4, 0xFD, 0x1A, 0xFE, 0xA3,
+    0xAF, 0xFD, 0x0F, 0xF1, 0xFF, 0xC9, 0x0F, 0xEA, 0x2A, 0xFD, 0x29, 0xFC, 0xA5, 0x99, 0x99, 0x59,
+    0x99, 0x20, 0x59, 0xAE, 0xA9, 0x71, 0x9F, 0xFC, 0x96, 0xAF, 0xFE, 0xA4, 0x9F, 0xCA, 0xAF, 0xD4,
+    0xFC, 0x3A, 0xFA, 0x3F, 0x94, 0xFC, 0x29, 0xF5, 0xFC, 0x2A, 0xF5, 0xFA, 0x2A, 0xF5, 0xF9, 0x2A,
+    0xF4, 0x9F, 0x3A, 0xF4, 0xF9, 0x3A, 0xF1, 0xAF, 0xCA, 0x4A, 0xF1, 0xFD, 0x94, 0xAF, 0x1F, 0xF3,
+    0xAF, 0x19, 0xAA, 0xFD, 0x2A, 0xF4, 0x9F, 0xC9, 0x1A, 0xF5, 0x9F, 0xC1, 0xAF, 0x6F, 0xC1, 0xAF,
+    0x6F, 0xC1, 0xAF, 0x6F, 0xC1, 0xAF, 0x59, 0xFC, 0x1A, 0xF5, 0xFC, 0x91, 0xAF, 0x39, 0xFD, 0x2A,
+    0xFF, 0xFD, 0x3F, 0xFF, 0xD4, 0xFF, 0xF9, 0x5F, 0xC1, 0x99, 0x97, 0x0F, 0xC7, 0x5F, 0xC9, 0x74,
+    0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5A, 0x99, 0x76, 0x39, 0x99, 0x95, 0x9A,
+    0xA9, 0x2A, 0xFD, 0x5F, 0xA0, 0x9F, 0xE9, 0x4F, 0xC1, 0xFF, 0x4F, 0xC3, 0xAF, 0xC4, 0xFC, 0x4F,
+    0xCA, 0x3F, 0xC4, 0x9F, 0xC3, 0xFA, 0x5F, 0xC2, 0x9F, 0x95, 0xAF, 0x91, 0xAF, 0x7F, 0xA1, 0xF9,
+    0x7A, 0xF1, 0xF7, 0x09, 0xF0, 0xAE, 0xA7, 0x1F, 0x9F, 0x72, 0xAF, 0xE9, 0x72, 0x9F, 0xE7, 0x4F,
+    0xD7, 0x5A, 0xF9, 0x75, 0x9F, 0x77, 0xEA, 0x77, 0xF7, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0xC9, 0x75,
+    0xFC, 0x97, 0x5F, 0xC7, 0x6A, 0x99, 0x70, 0x59, 0xAA, 0xEA, 0xA7, 0x9F, 0xFD, 0xA4, 0x9F, 0xFF,
+    0x93, 0xFC, 0xAA, 0xFD, 0xA2, 0x9F, 0x5A, 0xD9, 0x2A, 0xF7, 0xA3, 0x9F, 0xC7, 0x4F, 0xDA, 0x72,
+    0xAF, 0xE9, 0x71, 0xAF, 0xF7, 0x1F, 0xFC, 0x95, 0xAF, 0xFE, 0x93, 0xAF, 0x90, 0xFE, 0x29, 0xFA,
+    0x2A, 0xFC, 0xA1, 0xFC, 0x4F, 0xD0, 0x9F, 0xC4, 0x9F, 0xC9, 0xAF, 0xA5, 0xFC, 0x9F, 0xCA, 0x5F,
+    0xC9, 0xFC, 0xA5, 0xFC, 0x9A, 0xFA, 0x5F, 0xC9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xA1,
+    0xFD, 0x91, 0x9F, 0xC2, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xE9, 0x6A, 0xFE, 0xA7, 0x29, 0x99, 0x99,
+    0x60, 0x49, 0x9A, 0xAA, 0xA9, 0x94, 0x9F, 0xFC, 0xA2, 0xFF, 0xF1, 0xAF, 0xCA, 0xAA, 0xF1, 0xFC,
+    0x5C, 0x91, 0xFA, 0x71, 0xFA, 0x71, 0xAF, 0x99, 0xAA, 0x95, 0xAF, 0xF5, 0xAF, 0xF4, 0xAF, 0xCA,
+    0xAA, 0xA3, 0x9F, 0xA7, 0x0A, 0xF7, 0x1F, 0xC9, 0x79, 0xAF, 0xC9, 0x29, 0x9D, 0xA9, 0xFF, 0xFC,
+    0x90, 0xAF, 0xFF, 0x29, 0xFF, 0xCA, 0x69, 0x99, 0x99, 0x40, 0x09, 0xCA, 0x73, 0xE7, 0x09, 0x1E,
+    0x93, 0x9A, 0xE9, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0x91, 0x9A, 0xAA, 0x99, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0A, 0xF7, 0x09, 0xF7, 0x1F, 0x97, 0x0F, 0xA7, 0x0A, 0xF7, 0x1F,
+    0x97, 0x0A, 0xF7, 0x1F, 0xA7, 0x09, 0xF9, 0x70, 0x9F, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A,
+    0xFA, 0x70, 0xAF, 0xCA, 0x79, 0xFE, 0x99, 0x5F, 0xFE, 0xA3, 0xFF, 0xF3, 0x9F, 0xFD, 0x95, 0x9A,
+    0xAF, 0xC9, 0x70, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x09, 0xEA, 0x71, 0xAD, 0xA7, 0x71, 0x29,
+    0xAA, 0xA4, 0x9A, 0xAA, 0x4A, 0xFD, 0x1A, 0xFD, 0xA2, 0xFE, 0x9A, 0xFF, 0xA1, 0xFF, 0xFF, 0xD4,
+    0xFD, 0xA1, 0x9F, 0xC9, 0x3F, 0xD3, 0xFC, 0xA3, 0xFC, 0xA3, 0xAF, 0xA3, 0xFC, 0x93, 0x9F, 0xA3,
+    0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3,
+    0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x93, 0x9F, 0xA3,
+    0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x49, 0xFA, 0x75, 0x9F, 0xA7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x59,
+    0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xAF, 0x97, 0x59, 0x99, 0x20, 0x59, 0xAD, 0xA9, 0x71,
+    0xAF, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xCA, 0x3F, 0xA2, 0x9F, 0xC2, 0xAF, 0x4A, 0xFA,
+    0x1F, 0xA5, 0xFC, 0x09, 0xF9, 0x5F, 0xC9, 0x9F, 0x6A, 0xF9, 0xAF, 0x69, 0xFA, 0xFC, 0x7F, 0xFD,
+    0x99, 0x99, 0x99, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xD7,
+    0xFF, 0xD7, 0xFA, 0xAF, 0x95, 0x9F, 0xA9, 0xFA, 0x59, 0xF9, 0x9F, 0xC5, 0xAF, 0x1F, 0xC5, 0xFA,
+    0x1A, 0xFA, 0x39, 0xF9, 0x2F, 0xCA, 0x19, 0xFC, 0x39, 0xFF, 0xF5, 0xAF, 0xFD, 0x96, 0x9F, 0xEA,
+    0x73, 0x99, 0x99, 0x60, 0x19, 0x9A, 0xA3, 0x9F, 0xA3, 0xAF, 0xA3, 0xAF, 0x93, 0xAF, 0x93, 0xAF,
+    0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF,
+    0xA3, 0xAF, 0xC3, 0xAF, 0xFA, 0x9F, 0xF9, 0x0A, 0xFD, 0x93, 0x99, 0x93, 0x19, 0x9A, 0xA5, 0x9A,
+    0xA9, 0x19, 0xFA, 0x4A, 0xF9, 0x0A, 0xFA, 0x3F, 0xD9, 0x0A, 0xF9, 0x2F, 0xEA, 0x0A, 0xF9, 0x1F,
+    0xD9, 0x2A, 0xF9, 0x0A, 0xF9, 0x4A, 0xF9, 0x9E, 0xA6, 0xAF, 0xAF, 0xA6, 0xAF, 0xFD, 0x6A, 0xFF,
+    0xD6, 0xAF, 0xC9, 0xAE, 0xA5, 0xAF, 0xA0, 0x9F, 0x5A, 0xF9, 0x1F, 0x94, 0xAF, 0x91, 0xFC, 0x4A,
+    0xF9, 0x19, 0xFC, 0x99, 0x90, 0xAF, 0x92, 0xFF, 0xAA, 0xF9, 0x29, 0xFE, 0x9A, 0xF4, 0xAF, 0xCA,
+    0x74, 0x99, 0x92, 0x3A, 0xAD, 0xA7, 0x6A, 0xFE, 0x97, 0x4F, 0xFC, 0x74, 0xFF, 0xCA, 0x77, 0xAF,
+    0xC7, 0x70, 0xAF, 0x97, 0x70, 0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0x97, 0x7A, 0xFA, 0x77, 0xFD,
+    0x76, 0x9F, 0xD7, 0x6F, 0xE9, 0x74, 0x9F, 0xEA, 0x74, 0xAF, 0xF7, 0x4E, 0xAA, 0xF9, 0x72, 0xAE,
+    0x99, 0xFA, 0x72, 0xF1, 0xFC, 0x71, 0xAF, 0x1F, 0xC7, 0x1F, 0xA1, 0xAF, 0xA7, 0x9F, 0x92, 0xFC,
+    0x7F, 0xC3, 0xFC, 0x69, 0xFC, 0x3A, 0xFA, 0x5F, 0xCA, 0x39, 0xFF, 0x1A, 0xFC, 0x5F, 0xF1, 0xFC,
+    0xA5, 0x9F, 0xCA, 0x49, 0x99, 0x70, 0x99, 0x93, 0x29, 0x9A, 0xA6, 0x99, 0xA5, 0x9F, 0xC4, 0xFC,
+    0x94, 0xAF, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF,
+    0x94, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x94, 0xFC,
+    0x5A, 0xF9, 0x39, 0xFC, 0x5A, 0xFA, 0x39, 0xFC, 0x5A, 0xFC, 0x3F, 0xD5, 0xAF, 0xCA, 0x1A, 0xFD,
+    0xA4, 0xAF, 0xFE, 0x9F, 0xE1, 0xFF, 0xEA, 0x0F, 0xE1, 0xFF, 0xDA, 0x19, 0xFC, 0x2F, 0xA0, 0x99,
+    0x95, 0x99, 0x93, 0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x97, 0x7F,
+    0xC7, 0x70, 0xA9, 0x97, 0x71, 0x39, 0x99, 0x95, 0x9A, 0xA9, 0x2A, 0xFD, 0x5F, 0xA0, 0x9F, 0xE9,
+    0x4F, 0xC1, 0xFF, 0x4F, 0xC3, 0xAF, 0xC4, 0xFC, 0x4F, 0xCA, 0x3F, 0xC4, 0x9F, 0xC3, 0xFA, 0x5F,
+    0xC2, 0x9F, 0x95, 0xAF, 0x91, 0xAF, 0x7F, 0xA1, 0xFA, 0x7A, 0xF1, 0xF7, 0x09, 0xF0, 0xAE, 0xA7,
+    0x1F, 0x9F, 0x72, 0xAF, 0xE9, 0x72, 0x9F, 0xE7, 0x4F, 0xD7, 0x5F, 0xCA, 0x75, 0xAF, 0x77, 0x72,
+    0x0A, 0xC9, 0x72, 0x9D, 0xA7, 0x2A, 0xE4, 0x9A, 0xD1, 0xAF, 0xFF, 0x1A, 0xFF, 0xF1, 0x9F, 0xFD,
+    0xA6, 0x9F, 0xA7, 0x9F, 0x70, 0x9F, 0x71, 0xFA, 0x70, 0x9F, 0xA7, 0x09, 0xFC, 0x71, 0xFC, 0xA7,
+    0x1F, 0xFA, 0x69, 0xFE, 0x5A, 0xFE, 0xA4, 0xFC, 0xA9, 0x99, 0x4A, 0xF7, 0x09, 0xF7, 0x1A, 0xF7,
+    0x1F, 0xC7, 0x1F, 0xC9, 0x70, 0xAF, 0xC7, 0x09, 0xFD, 0xA9, 0x6F, 0xFE, 0x93, 0xAF, 0xFE, 0x39,
+    0xAF, 0xFC, 0x79, 0xAF, 0xC7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAD, 0xA7,
+    0x71, 0x59, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95, 0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA,
+    0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA, 0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA,
+    0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5, 0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9,
+    0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72,
+    0x99, 0x99, 0x96, 0x77, 0x19, 0x9A, 0xA1, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xFA, 0x09, 0xEA, 0xAF, 0xAA, 0xAA, 0xFA, 0xA9, 0x19, 0xDA, 0x1A, 0xE2, 0x9E, 0x95, 0xD2, 0xF2,
+    0x9E, 0x96, 0x92, 0xF2, 0xAE, 0x97, 0x2F, 0x2A, 0xE7, 0x3F, 0x2A, 0xE7, 0x29, 0xF2, 0xF7, 0x2A,
+    0xF2, 0xF9, 0x71, 0xFA, 0x2F, 0x97, 0x1F, 0xA2, 0xFA, 0x70, 0x9F, 0x92, 0xFC, 0x97, 0xAF, 0x92,
+    0xAF, 0xEA, 0x4F, 0xC4, 0xFE, 0x93, 0x9F, 0xA4, 0x9F, 0xC9, 0x77, 0x19, 0x94, 0x69, 0xAA, 0xAA,
+    0x97, 0x09, 0xFF, 0xCA, 0x5A, 0xFF, 0xF3, 0x9F, 0xDA, 0xFD, 0xA2, 0xFC, 0xA2, 0xAF, 0xC1, 0x9F,
+    0xC4, 0xFC, 0x90, 0xAF, 0xA4, 0xFC, 0xA0, 0xAF, 0x94, 0xAF, 0xA0, 0xAF, 0x94, 0xAF, 0xA0, 0xAF,
+    0x94, 0xAF, 0xA0, 0xAF, 0x94, 0xAF, 0xA0, 0xAF, 0x94, 0xFC, 0x90, 0xAF, 0x94, 0xFC, 0x1A, 0xF9,
+    0x3A, 0xFA, 0x1A, 0xFA, 0x29, 0xFC, 0x2A, 0xFF, 0xFC, 0x92, 0xFF, 0xFC, 0x93, 0xFF, 0xEA, 0x5F,
+    0xC9, 0x99, 0x99, 0x7F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x3F, 0xC9, 0x73,
+    0xFC, 0x74, 0xA9, 0x97, 0x50, 0x69, 0xAA, 0xA9, 0x69, 0xFF, 0x93, 0xAF, 0xFD, 0x91, 0xAF, 0xCA,
+    0xFC, 0xA0, 0x9F, 0xA2, 0xFC, 0x0F, 0xC3, 0xAE, 0xA9, 0xFA, 0x39, 0xE0, 0xAF, 0x97, 0x0A, 0xF9,
+    0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xAF, 0xA7, 0x0A, 0xFC, 0x70, 0x9F, 0xD7, 0x0F, 0xEA, 0x95,
+    0xAF, 0xFE, 0x92, 0xAF, 0xFE, 0xA2, 0x9A, 0xFF, 0xD5, 0x99, 0xAF, 0xD7, 0x1F, 0xA7, 0x1F, 0x71,
+    0x9E, 0xA7, 0x1F, 0x72, 0xE9, 0x77, 0x00, 0x76, 0x99, 0x9A, 0x94, 0xAF, 0xFF, 0xC9, 0x29, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFF, 0x19, 0xFC, 0xA1, 0x9F, 0xAA, 0xA2, 0xFC, 0x93, 0xAF, 0x4F, 0xC4, 0x9F,
+    0x92, 0xAF, 0xA5, 0xFC, 0x2A, 0xFA, 0x5F, 0xC2, 0xFC, 0x95, 0xFC, 0x2F, 0xCA, 0x5F, 0xC2, 0xAF,
+    0xA5, 0xFC, 0x2A, 0xFC, 0x5F, 0xC2, 0x9F, 0xC9, 0x3A, 0xFA, 0x3F, 0xD9, 0x1A, 0xFC, 0x49, 0xFF,
+    0xFC, 0x95, 0x9F, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x99, 0x70, 0x74, 0x99, 0x9A, 0x90,
+    0x9F, 0xFF, 0xEA, 0x0F, 0xFF, 0xF9, 0x0F, 0xFF, 0xF0, 0x9E, 0xAA, 0xAF, 0xCA, 0xAA, 0xA9, 0x09,
+    0xDA, 0x2F, 0x96, 0xD3, 0xF9, 0x79, 0x29, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x3A, 0xFF, 0xCA, 0x7F, 0xFC, 0x97, 0x9F, 0xE9, 0x72,
+    0x99, 0x99, 0x40, 0x39, 0x99, 0x9A, 0x39, 0xAA, 0x93, 0xAF, 0xE3, 0xAF, 0x2F, 0xF3, 0x9F, 0xA1,
+    0xFE, 0xA4, 0xFC, 0x39, 0xFA, 0x4F, 0xC3, 0x9F, 0xA4, 0xFC, 0x92, 0xAF, 0xA4, 0xFC, 0x92, 0xAF,
+    0xA4, 0xFC, 0xA2, 0xAF, 0xA4, 0xAF, 0xA2, 0xAF, 0xA4, 0xAF, 0xA2, 0xAF, 0xA4, 0xFC, 0xA2, 0xAF,
+    0xC4, 0xFC, 0x92, 0x9F, 0xC4, 0xFC, 0x4F, 0xC3, 0x9F, 0xA4, 0xFD, 0x2F, 0xC5, 0x9F, 0xFF, 0xA6,
+    0x9F, 0xFD, 0xA7, 0x09, 0xFF, 0x97, 0x49, 0x99, 0x96, 0x75, 0x97, 0x73, 0x9F, 0x77, 0x3F, 0xA7,
+    0x73, 0xFA, 0x77, 0x3F, 0xA7, 0x73, 0xFA, 0x77, 0x09, 0x9A, 0xFC, 0xA9, 0x74, 0xAF, 0xFF, 0xCA,
+    0x7A, 0xFF, 0xFF, 0xC9, 0x4A, 0xFD, 0xAF, 0xFF, 0x92, 0x9F, 0xC9, 0x1F, 0xA0, 0x9F, 0xD2, 0xFC,
+    0x92, 0xFA, 0x2F, 0xCA, 0x09, 0xFA, 0x3F, 0xA2, 0x9F, 0xC0, 0xAF, 0x93, 0xFA, 0x3F, 0xC0, 0xAF,
+    0x93, 0xFA, 0x3F, 0xC0, 0xFC, 0x4F, 0xA3, 0xFC, 0x0F, 0xC9, 0x3F, 0xA3, 0xFC, 0x0A, 0xFA, 0x3F,
+    0xA3, 0xFC, 0x09, 0xFC, 0x3F, 0xA2, 0x9F, 0xA1, 0xFC, 0xA2, 0xFA, 0x2F, 0xC2, 0xAF, 0xD9, 0x0F,
+    0xA0, 0xAF, 0xCA, 0x3A, 0xFF, 0xFF, 0xDA, 0x59, 0xFF, 0xFF, 0xA7, 0x09, 0xAF, 0xFE, 0x97, 0x69,
+    0xFA, 0x77, 0x3F, 0xA7, 0x73, 0xFA, 0x77, 0x3F, 0xA7, 0x73, 0xFA, 0x77, 0x29, 0xFA, 0x77, 0x29,
+    0xF7, 0x73, 0x9A, 0x97, 0x40, 0x39, 0x99, 0x95, 0x9A, 0xA9, 0x39, 0xFD, 0x93, 0x9F, 0xC2, 0xFF,
+    0x3F, 0xCA, 0x2A, 0xFE, 0x29, 0xFC, 0x6F, 0xCA, 0x1A, 0xF7, 0x0F, 0xC1, 0xFA, 0x70, 0xFC, 0x9A,
+    0xF7, 0x19, 0xFA, 0xF7, 0x3F, 0xFA, 0x73, 0x9F, 0xE7, 0x5F, 0xD9, 0x75, 0x9F, 0xC7, 0x7F, 0xC7,
+    0x69, 0xFC, 0xA7, 0x5F, 0xE7, 0x49, 0xFE, 0xA7, 0x3E, 0xAF, 0xC7, 0x2A, 0xE9, 0x9F, 0x97, 0x09,
+    0xF1, 0xFC, 0x70, 0xFA, 0x1A, 0xF9, 0x6A, 0xF3, 0xFC, 0x59, 0xFC, 0x3F, 0xC9, 0x4F, 0xC9, 0x39,
+    0xFE, 0x1A, 0xFC, 0x5F, 0xE9, 0x0F, 0xCA, 0x5A, 0xFC, 0xA2, 0x9A, 0xA9, 0x7A, 0x99, 0x30, 0x77,
+    0x97, 0x76, 0xF9, 0x77, 0x4A, 0xF7, 0x75, 0xAF, 0x77, 0x5A, 0xF7, 0x75, 0xAF, 0x75, 0x99, 0x99,
+    0x92, 0xAF, 0x29, 0xAA, 0x93, 0xAF, 0xDA, 0x2A, 0xF2, 0xFA, 0x2F, 0xEA, 0x2A, 0xF2, 0xAF, 0x2F,
+    0xEA, 0x2A, 0xF2, 0x9F, 0xA3, 0x9F, 0x92, 0xAF, 0x3F, 0xC3, 0x9F, 0x92, 0xAF, 0x3F, 0xC3, 0xAF,
+    0x92, 0xAF, 0x3F, 0xC3, 0xAF, 0x92, 0xAF, 0x3F, 0xC3, 0xAF, 0x92, 0xAF, 0x3F, 0xC3, 0xAF, 0x92,
+    0xAF, 0x3F, 0xC3, 0xAF, 0xA2, 0xAF, 0x3F, 0xC3, 0xAF, 0xC2, 0xAF, 0x29, 0xFC, 0x39, 0xFC, 0x2A,
+    0xF2, 0xFC, 0x94, 0xFC, 0xA1, 0xAF, 0x19, 0xFC, 0x59, 0xFD, 0x9A, 0xF0, 0xAF, 0xC7, 0xAF, 0xFF,
+    0xFC, 0x97, 0x09, 0xFF, 0xFE, 0x74, 0x9F, 0xFD, 0xA9, 0x77, 0x1A, 0xF7, 0x75, 0xAF, 0x77, 0x5A,
+    0xF7, 0x75, 0xAF, 0x77, 0x5A, 0xF7, 0x75, 0xFC, 0x77, 0x5F, 0xA7, 0x75, 0xA9, 0x97, 0x30, 0x4A,
+    0xA9, 0x79, 0xAA, 0x7A, 0xF9, 0x59, 0xF9, 0x49, 0xFA, 0x7A, 0xF9, 0x3F, 0xC7, 0x1F, 0xC2, 0xAF,
+    0x97, 0x1A, 0xF9, 0x1F, 0xC3, 0xEA, 0x3F, 0xC1, 0xFA, 0x29, 0xF3, 0xFC, 0x09, 0xF9, 0x29, 0xF3,
+    0xAF, 0x9A, 0xF9, 0x29, 0xF3, 0x9F, 0x9F, 0xC3, 0x9F, 0x39, 0xF9, 0xFC, 0x4F, 0x39, 0xF9, 0xAF,
+    0x93, 0xF3, 0x9F, 0x9A, 0xF9, 0x29, 0xF3, 0xAF, 0x09, 0xFA, 0x2A, 0xF9, 0x2F, 0xC1, 0xFC, 0x91,
+    0xFD, 0x19, 0xF9, 0x1A, 0xFC, 0xAE, 0xAF, 0xAF, 0xC3, 0xFF, 0xC0, 0x9F, 0xF5, 0xAF, 0xD2, 0xAF,
+    0xCA, 0x70, 0x99, 0x96, 0x99, 0x95, 0x74, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F,
+    0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0,
+    0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A,
+    0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F,
+    0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC,
+    0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA,
+    0x3A, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x79, 0xA9, 0x77, 0x5F, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0x9F,
+    0xC7, 0x74, 0xFA, 0x77, 0x49, 0xAA, 0x97, 0x30, 0x59, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF,
+    0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7,
+    0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F,
+    0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F,
+    0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49, 0x99, 0x77, 0x74, 0x99, 0x75, 0xAE, 0xA7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x5A, 0xA9, 0x70, 0x72, 0x99, 0x77, 0x5A, 0xFC, 0xA7, 0x71, 0xFF,
+    0xA7, 0x70, 0xE1, 0xAE, 0x77, 0x0D, 0xA1, 0xAE, 0x77, 0x5E, 0x97, 0x72, 0x9A, 0xEA, 0x77, 0x3E,
+    0xA7, 0x75, 0x9D, 0x77, 0x79, 0x97, 0x77, 0x19, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73,
+    0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA,
+    0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3,
+    0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09,
+    0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F,
+    0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC,
+    0xA3, 0xAF, 0xFD, 0x00, 0x49, 0xAE, 0x97, 0x2F, 0xF7, 0x09, 0xE9, 0x9E, 0x97, 0x9D, 0x91, 0xE9,
+    0x70, 0xAC, 0x2E, 0x97, 0x4E, 0xA7, 0x3F, 0xA7, 0x4D, 0xA7, 0x69, 0xCA, 0x77, 0x77, 0x77, 0x29,
+    0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA,
+    0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39,
+    0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF,
+    0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49, 0x99,
+    0x20, 0x77, 0x77, 0x75, 0xCA, 0x77, 0x6E, 0x77, 0x5A, 0xE7, 0x75, 0xE9, 0x76, 0x99, 0xA2, 0xE9,
+    0x76, 0xFC, 0x1D, 0x77, 0xAF, 0xD7, 0x71, 0xAE, 0x9F, 0x77, 0x9E, 0x2E, 0x97, 0x6A, 0xD4, 0xCA,
+    0x77, 0x59, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77,
+    0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7,
+    0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7,
+    0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD,
+    0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x77, 0x77,
+    0xD7, 0x6A, 0xE7, 0x5F, 0x74, 0x9E, 0x97, 0x4E, 0x97, 0x5D, 0xA7, 0x0A, 0xAC, 0xA1, 0xAA, 0x70,
+    0xAF, 0xA7, 0x29, 0xFD, 0xA7, 0x1E, 0xAA, 0xEA, 0x7F, 0x1A, 0xE9, 0x5A, 0xE3, 0xAD, 0x70, 0x97,
+    0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F,
+    0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF,
+    0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A,
+    0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99,
+    0x94, 0x99, 0x92, 0x77, 0x77, 0x70, 0xAC, 0x77, 0x69, 0xE7, 0x76, 0xE9, 0x77, 0x59, 0xE7, 0x71,
+    0x99, 0xA1, 0x9D, 0xA7, 0x7F, 0xC2, 0xD7, 0x6A, 0xFD, 0x77, 0x1A, 0xE9, 0xF7, 0x79, 0xE2, 0xE9,
+    0x76, 0xAD, 0x4C, 0xA7, 0x75, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F, 0xD9, 0x77,
+    0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0, 0xFC, 0x76,
+    0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A, 0xFA, 0x73,
+    0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xF7,
+    0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC, 0x6F, 0x71,
+    0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA, 0x3A, 0xFF,
+    0xD0, 0x77, 0x73, 0xAC, 0xA7, 0x6E, 0x76, 0xEA, 0x75, 0xAE, 0x76, 0xEA, 0x76, 0xE7, 0x0A, 0xAC,
+    0xA2, 0xC9, 0x7A, 0xFA, 0x72, 0x9F, 0xDA, 0x71, 0xEA, 0xAE, 0xA7, 0xF1, 0xAE, 0x95, 0xAE, 0x3A,
+    0xD7, 0x09, 0x77, 0x77, 0x49, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA,
+    0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF,
+    0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9,
+    0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F,
+    0xC9, 0x49, 0x99, 0x49, 0x99, 0x20, 0x77, 0x19, 0x77, 0x59, 0xFA, 0x77, 0x3F, 0xD9, 0x77, 0x2D,
+    0x1D, 0xA7, 0x75, 0xAD, 0x77, 0x99, 0xA2, 0xE9, 0x76, 0xFC, 0x1D, 0x77, 0xAF, 0xD7, 0x71, 0xAE,
+    0x9F, 0x77, 0x9E, 0x2E, 0x97, 0x6A, 0xD4, 0xCA, 0x77, 0x59, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F,
+    0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC,
+    0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97,
+    0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF,
+    0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE,
+    0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD,
+    0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x77, 0x74, 0xAF, 0x97, 0x2F, 0xE9, 0x71, 0xDA, 0x09, 0xDA,
+    0x71, 0xAC, 0x19, 0xDA, 0x75, 0xE7, 0x4F, 0x7A, 0xAC, 0xA1, 0xDA, 0x7A, 0xFA, 0x09, 0xA9, 0x69,
+    0xFD, 0xA7, 0x1E, 0xAA, 0xEA, 0x7F, 0x1A, 0xE9, 0x5A, 0xE3, 0xAD, 0x70, 0x97, 0x77, 0x74, 0x9A,
+    0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3,
+    0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F,
+    0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC,
+    0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92,
+    0x71, 0x97, 0x75, 0x9F, 0x91, 0xAC, 0xA7, 0x6F, 0xDA, 0xAE, 0x76, 0xDA, 0x0A, 0xFC, 0x97, 0x69,
+    0xC9, 0x19, 0xE9, 0x77, 0x77, 0x74, 0xFC, 0x77, 0x3A, 0xFD, 0x77, 0x1A, 0xEA, 0xF7, 0x7F, 0x91,
+    0xEA, 0x76, 0xAC, 0xA4, 0xAA, 0x77, 0x59, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD,
+    0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F,
+    0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF,
+    0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF,
+    0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6,
+    0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3,
+    0xAF, 0xFD, 0x00, 0x39, 0xA9, 0x39, 0x70, 0xAF, 0x2D, 0x69, 0xFD, 0x9A, 0xD6, 0x9D, 0xAA, 0xFD,
+    0x7D, 0x19, 0xF9, 0x70, 0x93, 0x9A, 0x77, 0x75, 0x9F, 0xA7, 0x3F, 0xE7, 0x1F, 0xAF, 0x7F, 0x19,
+    0xEA, 0x5A, 0xE3, 0x9D, 0xA7, 0x97, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF,
+    0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74,
+    0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA,
+    0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD,
+    0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x72, 0xAA, 0xC7, 0x75, 0xFC, 0x97, 0x72,
+    0xAF, 0xD9, 0x77, 0x0A, 0xE9, 0xF9, 0x76, 0xAE, 0x91, 0xF7, 0x59, 0xE9, 0x3E, 0x76, 0x9A, 0x6A,
+    0x77, 0x77, 0x77, 0x99, 0x77, 0x5A, 0xEA, 0x77, 0x39, 0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19, 0xFD,
+    0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE, 0x9F, 0xC7, 0x7E, 0xA0, 0xFC, 0x76, 0x9E, 0x1A,
+    0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F, 0xC9, 0x73, 0xAE, 0x3A, 0xFA, 0x73, 0xEA, 0x39,
+    0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71, 0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC, 0x6A, 0xE9, 0x79, 0xFC, 0x6F, 0x71, 0xFC, 0xA3,
+    0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A, 0xFF, 0xD0, 0xFF, 0xCA, 0x3A, 0xFF, 0xD7, 0x77,
+    0x77, 0x77, 0x79, 0xA9, 0x77, 0x5F, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0x9F, 0xC7, 0x74, 0xFA, 0x77,
+    0x49, 0xAA, 0x97, 0x30, 0x6A, 0xAA, 0x75, 0xFA, 0x73, 0xAF, 0xC9, 0x71, 0x9E, 0xAE, 0x71, 0xE9,
+    0x0F, 0x7A, 0xDA, 0x2E, 0x96, 0xE3, 0x9D, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC,
+    0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4,
+    0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA,
+    0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF,
+    0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x97, 0x77, 0x49, 0x97, 0x5A, 0xEA,
+    0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x75, 0xAA, 0x97, 0x77, 0x77, 0x6D, 0x77, 0x69, 0xDA, 0x77,
+    0x5E, 0x97, 0x74, 0xAD, 0xA7, 0x71, 0xD1, 0xDA, 0x1A, 0x97, 0x6D, 0xA1, 0x91, 0xAC, 0xA7, 0x6F,
+    0xA9, 0x9E, 0x97, 0x69, 0xFF, 0xA7, 0x70, 0x9F, 0xD9, 0x77, 0x77, 0x77, 0x09, 0x97, 0x75, 0xAE,
+    0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97,
+    0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E,
+    0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC,
+    0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7,
+    0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF,
+    0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x70, 0x9A, 0x77, 0xDA, 0x75, 0xAE, 0x75,
+    0xEA, 0x74, 0xEA, 0x75, 0xDA, 0x76, 0xA9, 0x29, 0x7D, 0x6C, 0x95, 0xAE, 0x39, 0xD9, 0x59, 0xFC,
+    0xAF, 0x7A, 0xFF, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6,
+    0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F,
+    0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2,
+    0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC,
+    0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49, 0x99, 0x20, 0x77, 0x77, 0x3A, 0xC7, 0x76,
+    0x9D, 0xA7, 0x75, 0x9E, 0x77, 0x69, 0xE7, 0x72, 0xD1, 0x9D, 0x1A, 0x97, 0x6D, 0xA2, 0x90, 0xAC,
+    0xA7, 0x6F, 0xA9, 0x9E, 0x97, 0x69, 0xFF, 0xA7, 0x70, 0x9F, 0xD9, 0x77, 0x77, 0x77, 0x09, 0x97,
+    0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71,
+    0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC,
+    0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA,
+    0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9,
+    0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA,
+    0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x5A, 0x77, 0xDA, 0x75, 0x9E,
+    0x76, 0xF7, 0x6E, 0x97, 0x6D, 0xA7, 0x7A, 0x29, 0x7D, 0x6C, 0x95, 0xAE, 0x39, 0xD9, 0x59, 0xFC,
+    0xAF, 0x7A, 0xFF, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6,
+    0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F,
+    0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA, 0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2,
+    0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2, 0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC,
+    0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49, 0x99, 0x20, 0x77, 0x77, 0x3A, 0xF9, 0x77,
+    0x2A, 0xDA, 0xE7, 0x72, 0xAC, 0x90, 0x9D, 0x77, 0x59, 0xDA, 0x77, 0x4E, 0x97, 0x71, 0x9C, 0x1A,
+    0xC9, 0x1C, 0x97, 0x6E, 0x4A, 0xCA, 0x76, 0xAE, 0xAA, 0xAE, 0x77, 0x0A, 0xFE, 0x77, 0x3A, 0xAA,
+    0xA7, 0x77, 0x09, 0x97, 0x75, 0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA,
+    0x77, 0x1F, 0xF7, 0x71, 0xFF, 0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF,
+    0xA7, 0x5F, 0x19, 0xFC, 0x74, 0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F,
+    0xC7, 0x2A, 0xFA, 0xAA, 0xAA, 0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xC9, 0x69, 0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A,
+    0xFD, 0xA5, 0x9F, 0xFA, 0x0A, 0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x69,
+    0x99, 0x74, 0xAF, 0xC9, 0x71, 0xAF, 0xE7, 0x1A, 0xD1, 0xE9, 0x71, 0x99, 0x1E, 0x74, 0x9E, 0x97,
+    0x39, 0xDA, 0x76, 0xD7, 0x3D, 0x19, 0x3C, 0x95, 0xAD, 0xA4, 0xD9, 0x59, 0xFA, 0xAF, 0x7A, 0xFF,
+    0x71, 0x9A, 0xEA, 0x97, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4,
+    0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2, 0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA,
+    0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD, 0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F,
+    0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA, 0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91,
+    0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94, 0x99, 0x92, 0x70, 0x97, 0x76, 0x9F, 0x2D, 0x77, 0xFD, 0xAA,
+    0xD9, 0x76, 0xD9, 0x9F, 0xD7, 0x7A, 0xA2, 0x9E, 0x97, 0x77, 0x09, 0x77, 0xD5, 0x9C, 0xA7, 0x6E,
+    0xA9, 0x99, 0xAD, 0x97, 0x6F, 0xFC, 0xA7, 0x70, 0xAF, 0xD9, 0x77, 0x77, 0x77, 0x09, 0x97, 0x75,
+    0xAE, 0xA7, 0x73, 0x9F, 0xC7, 0x73, 0xFD, 0x97, 0x71, 0x9F, 0xDA, 0x77, 0x1F, 0xF7, 0x71, 0xFF,
+    0x97, 0x7A, 0xE9, 0xFC, 0x77, 0xEA, 0x0F, 0xC7, 0x69, 0xE1, 0xAF, 0xA7, 0x5F, 0x19, 0xFC, 0x74,
+    0x9E, 0x92, 0xFC, 0x97, 0x3A, 0xE3, 0xAF, 0xA7, 0x3E, 0xA3, 0x9F, 0xC7, 0x2A, 0xFA, 0xAA, 0xAA,
+    0xFC, 0x97, 0x1F, 0xFF, 0xF7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x69,
+    0xF7, 0xAF, 0xC6, 0xAE, 0x97, 0x9F, 0xC6, 0xF7, 0x1F, 0xCA, 0x3A, 0xFD, 0xA5, 0x9F, 0xFA, 0x0A,
+    0xFF, 0xA3, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0xAF, 0xFD, 0x00, 0x77, 0x49, 0xEA, 0x2C, 0xA7, 0xFC,
+    0xA0, 0x9D, 0x95, 0x9F, 0xFD, 0x95, 0x9D, 0x1A, 0xFC, 0x7A, 0xC2, 0x9D, 0xA7, 0x77, 0x19, 0xCA,
+    0x6C, 0xA5, 0xAD, 0xA4, 0xDA, 0x5A, 0xFA, 0xAF, 0x7F, 0xFC, 0x97, 0x09, 0xFC, 0xA7, 0x77, 0x77,
+    0x70, 0x9A, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x6A, 0xFF, 0xE4, 0xAF, 0xCA, 0xAF, 0xC9, 0x3F, 0xA2,
+    0x9F, 0xA3, 0xF9, 0x3F, 0xA4, 0x9A, 0xA4, 0xFA, 0x74, 0xFA, 0x79, 0xAA, 0xFD, 0xA5, 0xAF, 0xFD,
+    0xA3, 0x9F, 0xFF, 0xA3, 0xFC, 0xA2, 0xFA, 0x29, 0xFA, 0x3F, 0xA2, 0xAF, 0x93, 0xFA, 0x2A, 0xFA,
+    0x2A, 0xFC, 0x29, 0xFF, 0xFF, 0xA0, 0xFF, 0xC9, 0xFD, 0x91, 0xFD, 0xA1, 0xFC, 0x94, 0x99, 0x94,
+    0x99, 0x92, 0x77, 0x77, 0x0A, 0xC9, 0x5C, 0xA7, 0x6E, 0x93, 0xE7, 0x6F, 0xCA, 0xFA, 0x76, 0xAF,
+    0xFC, 0x77, 0x09, 0xFD, 0xA7, 0x73, 0x99, 0x97, 0x77, 0x77, 0x73, 0x99, 0x77, 0x5A, 0xEA, 0x77,
+    0x39, 0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0xFF, 0x77, 0x1F, 0xF9, 0x77, 0xAE,
+    0x9F, 0xC7, 0x7E, 0xA0, 0xFC, 0x76, 0x9E, 0x1A, 0xFA, 0x75, 0xF1, 0x9F, 0xC7, 0x49, 0xE9, 0x2F,
+    0xC9, 0x73, 0xAE, 0x3A, 0xFA, 0x73, 0xEA, 0x39, 0xFC, 0x72, 0xAF, 0xAA, 0xAA, 0xAF, 0xC9, 0x71,
+    0xFF, 0xFF, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x96, 0x9F, 0x7A, 0xFC,
+    0x6A, 0xE9, 0x79, 0xFC, 0x6F, 0x71, 0xFC, 0xA3, 0xAF, 0xDA, 0x59, 0xFF, 0xA0, 0xAF, 0xFA, 0x3A,
+    0xFF, 0xD0, 0xFF, 0xCA, 0x3A, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x79, 0xA9, 0x77, 0x5F, 0xA7, 0x73,
+    0x9F, 0xC7, 0x73, 0x9F, 0xC7, 0x74, 0xFA, 0x77, 0x49, 0xAA, 0x97, 0x30, 0x39, 0x69, 0x7D, 0x94,
+    0x9C, 0x95, 0xAE, 0xA2, 0x9D, 0x95, 0x9F, 0xFD, 0x7A, 0xFF, 0x72, 0xAE, 0xA9, 0x77, 0x77, 0x77,
+    0x09, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC6, 0xAF, 0xFE, 0x4A, 0xFC, 0xAA, 0xFC, 0x93, 0xFA, 0x29,
+    0xFA, 0x3F, 0x93, 0xFA, 0x49, 0xAA, 0x4F, 0xA7, 0x4F, 0xA7, 0x9A, 0xAF, 0xDA, 0x5A, 0xFF, 0xDA,
+    0x39, 0xFF, 0xFA, 0x3F, 0xCA, 0x2F, 0xA2, 0x9F, 0xA3, 0xFA, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0xA2,
+    0xAF, 0xC2, 0x9F, 0xFF, 0xFA, 0x0F, 0xFC, 0x9F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x49, 0x99, 0x49,
+    0x99, 0x77, 0x74, 0x99, 0x75, 0xAE, 0xA7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x5A, 0xA9, 0x70,
+    0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF,
+    0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75,
+    0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC,
+    0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9,
+    0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x77, 0x77,
+    0x77, 0x19, 0x97, 0x79, 0xF9, 0x75, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xAF, 0x97, 0x69, 0xAA, 0x70,
+    0x59, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90,
+    0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF,
+    0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19,
+    0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x77, 0x74,
+    0x99, 0x73, 0xAE, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x3A, 0xA9, 0x50, 0x70, 0x99, 0x76,
+    0x9F, 0xD7, 0x39, 0xFF, 0x72, 0xE9, 0x09, 0xE9, 0x71, 0xAD, 0x2E, 0x77, 0xAE, 0x75, 0xAF, 0x75,
+    0x9E, 0x97, 0x7D, 0x97, 0x70, 0x99, 0x77, 0x75, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A,
+    0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3,
+    0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF,
+    0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F,
+    0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x5A, 0xEA, 0x70, 0x9F, 0xE9, 0x6E, 0xA9, 0xF6, 0xE1,
+    0x9E, 0x69, 0xAA, 0x19, 0xE7, 0x29, 0xE7, 0x19, 0xF7, 0x29, 0xD9, 0x74, 0xD7, 0x77, 0x77, 0x49,
+    0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9,
+    0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A,
+    0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x77, 0x70,
+    0x9E, 0xA2, 0xC9, 0x70, 0x9F, 0xCA, 0x0A, 0xD7, 0x0A, 0xFF, 0xD7, 0x0E, 0x09, 0xFD, 0x70, 0x9C,
+    0xA1, 0x9E, 0xA7, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF,
+    0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC,
+    0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC,
+    0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9,
+    0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF,
+    0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x39, 0xDA, 0x29, 0xA5, 0x9F, 0xC1, 0xE4, 0xFF, 0xE4, 0xE0,
+    0xAF, 0xCA, 0x4A, 0xC9, 0x1A, 0xEA, 0x74, 0x97, 0x77, 0x77, 0x29, 0xAA, 0xAA, 0x97, 0xAF, 0xF9,
+    0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD, 0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF,
+    0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91,
+    0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79, 0x99, 0x99, 0x40, 0x77, 0x77, 0x4A, 0xC7, 0x70, 0x9D, 0xA7,
+    0x7E, 0xA7, 0x6F, 0x70, 0x99, 0xA9, 0x19, 0xDA, 0x70, 0x9F, 0x90, 0x9C, 0xA7, 0x1F, 0xDA, 0x73,
+    0xEA, 0xAE, 0x97, 0x1E, 0xA1, 0x9E, 0x71, 0xD9, 0x39, 0xA7, 0x77, 0x1A, 0xFF, 0xFF, 0xCA, 0x0F,
+    0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F,
+    0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F,
+    0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F,
+    0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F,
+    0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0x90, 0x77, 0x77, 0xAC, 0xA7, 0x6E, 0x97,
+    0x4A, 0xE9, 0x74, 0xF7, 0x49, 0xE7, 0x5A, 0xD7, 0x09, 0xAD, 0x19, 0xC7, 0x1F, 0xC9, 0x72, 0xFE,
+    0x97, 0x0A, 0xE9, 0xF7, 0x9E, 0x91, 0xF6, 0xE9, 0x3D, 0x97, 0x97, 0x77, 0x74, 0x9A, 0xAA, 0xA9,
+    0x71, 0xAF, 0xF9, 0x6F, 0xFE, 0x94, 0xFC, 0xAA, 0xFD, 0x39, 0xF3, 0xAF, 0x92, 0xF9, 0x4F, 0xA1,
+    0x9F, 0x5F, 0xC1, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0x1A, 0xFF, 0xFD, 0xA1, 0xFF, 0xFE, 0xA1, 0xFC,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xF7, 0x4A, 0xF9, 0x73, 0x9F, 0xC7, 0x4F, 0xDA, 0x91, 0x99,
+    0xAC, 0x92, 0x9F, 0xFF, 0xC9, 0x3A, 0xFF, 0xF5, 0x9F, 0xFC, 0xA7, 0x19, 0x99, 0x99, 0x60, 0x77,
+    0x77, 0x0C, 0xA7, 0x70, 0xE9, 0x77, 0xF7, 0x70, 0xEA, 0x72, 0x99, 0xA9, 0x1E, 0x71, 0x9F, 0x91,
+    0xAC, 0x71, 0xFD, 0xA7, 0x3E, 0xAA, 0xE9, 0x71, 0xEA, 0x19, 0xE7, 0x1D, 0x93, 0x9A, 0x77, 0x71,
+    0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF,
+    0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75,
+    0xFC, 0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC,
+    0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9,
+    0x99, 0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x00, 0x73,
+    0x97, 0x5D, 0x74, 0xAD, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x39, 0xE7, 0x49, 0xD9, 0x59, 0xAD, 0x29,
+    0xC6, 0xFC, 0x97, 0x0F, 0xE9, 0x6A, 0xE9, 0xF5, 0x9E, 0x91, 0xF4, 0xE9, 0x3D, 0x95, 0x97, 0x77,
+    0x70, 0x9A, 0xAA, 0xA9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9, 0x2F, 0xCA, 0xAF, 0xD1, 0x9F, 0x3A, 0xF9,
+    0x0F, 0x94, 0xFA, 0x9F, 0x5F, 0xCA, 0xFA, 0x99, 0x99, 0x9F, 0xCA, 0xFF, 0xFD, 0xAF, 0xFF, 0xEA,
+    0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xF7, 0x2A, 0xF9, 0x71, 0x9F, 0xC7, 0x2F, 0xDA, 0x91,
+    0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3, 0x9F, 0xFC, 0xA7, 0x99, 0x99, 0x94, 0x76,
+    0x97, 0x70, 0xFC, 0x97, 0x4E, 0xAE, 0x74, 0xD9, 0x0A, 0xD7, 0x79, 0xDA, 0x70, 0x99, 0xA9, 0x1A,
+    0xDA, 0x70, 0x9F, 0x90, 0xAC, 0xA7, 0x1F, 0xDA, 0x09, 0x71, 0xEA, 0xAE, 0x97, 0x1E, 0xA1, 0x9E,
+    0x71, 0xD9, 0x39, 0xA7, 0x77, 0x1A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD,
+    0x3F, 0xCA, 0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F, 0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D,
+    0x4F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F,
+    0xFF, 0xC6, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3,
+    0xFC, 0x95, 0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFD, 0x90, 0x77, 0x75, 0x9F, 0xA7, 0x39, 0xFE, 0x72, 0xAD, 0x1E, 0x73, 0xCA, 0x1E,
+    0x76, 0xAD, 0xA7, 0x49, 0xE9, 0x79, 0xAD, 0x19, 0xD7, 0x1F, 0xC9, 0x0A, 0xA7, 0x0F, 0xE9, 0x71,
+    0xAE, 0x9F, 0x70, 0x9E, 0x91, 0xF7, 0xE9, 0x3D, 0x97, 0x09, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0x97,
+    0x2A, 0xFF, 0x97, 0xFF, 0xE9, 0x5F, 0xCA, 0xAF, 0xD4, 0x9F, 0x3A, 0xF9, 0x3F, 0x94, 0xFA, 0x29,
+    0xF5, 0xFC, 0x2A, 0xFA, 0x99, 0x99, 0x9F, 0xC2, 0xAF, 0xFF, 0xDA, 0x2F, 0xFF, 0xEA, 0x2F, 0xC9,
+    0x99, 0x99, 0x99, 0x99, 0x93, 0xAF, 0x75, 0xAF, 0x97, 0x49, 0xFC, 0x75, 0xFD, 0xA9, 0x19, 0x9A,
+    0xC9, 0x39, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0x69, 0xFF, 0xCA, 0x72, 0x99, 0x99, 0x97, 0x69, 0x77,
+    0x0A, 0xEA, 0x2D, 0x70, 0xAF, 0xD9, 0xE9, 0x7E, 0x09, 0xFD, 0x71, 0xAA, 0x2A, 0xDA, 0x77, 0x77,
+    0x09, 0xF9, 0x74, 0x9F, 0xDA, 0x72, 0x9E, 0xAA, 0xEA, 0x70, 0x9E, 0xA1, 0x9E, 0x70, 0x9D, 0x93,
+    0x9C, 0x97, 0x77, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFD, 0x3F, 0xCA,
+    0x99, 0x9A, 0xAA, 0xF3, 0xFC, 0x95, 0xAE, 0x3F, 0xC9, 0x59, 0xDA, 0x3F, 0xC9, 0x6D, 0x4F, 0xC9,
+    0x75, 0xFC, 0x97, 0x5F, 0xCA, 0x39, 0x99, 0x6F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6,
+    0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x97, 0x5F, 0xC9, 0x6D, 0xA3, 0xFC, 0x96, 0xE3, 0xFC, 0x95,
+    0xAE, 0x3F, 0xCA, 0x99, 0x99, 0x9A, 0xF1, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFD, 0x90, 0x49, 0xA3, 0x97, 0xF9, 0x1A, 0xC9, 0x4F, 0xDA, 0x9D, 0xA4, 0xE9, 0xFD, 0x94, 0xAC,
+    0x91, 0xAF, 0x69, 0x39, 0xA9, 0x77, 0x71, 0xAF, 0x97, 0x0A, 0xFD, 0x96, 0x9E, 0xAF, 0x94, 0x9E,
+    0xA1, 0xF4, 0xEA, 0x3E, 0x59, 0x69, 0x77, 0x70, 0x9A, 0xAA, 0xA9, 0x7A, 0xFF, 0x94, 0xFF, 0xE9,
+    0x2F, 0xCA, 0xAF, 0xD1, 0x9F, 0x3A, 0xF9, 0x0F, 0x94, 0xFA, 0x9F, 0x5F, 0xCA, 0xFA, 0x99, 0x99,
+    0x9F, 0xCA, 0xFF, 0xFD, 0xAF, 0xFF, 0xEA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xF7, 0x2A,
+    0xF9, 0x71, 0x9F, 0xC7, 0x2F, 0xDA, 0x91, 0x99, 0xAC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3,
+    0x9F, 0xFC, 0xA7, 0x99, 0x99, 0x94, 0x79, 0xAC, 0xA7, 0x69, 0xFA, 0x74, 0x9F, 0xE7, 0x3E, 0xAA,
+    0xEA, 0x71, 0xEA, 0x19, 0xE9, 0x7E, 0xA3, 0x9D, 0xA7, 0x0A, 0x95, 0x99, 0x77, 0x77, 0x74, 0xAF,
+    0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xD3, 0xFC, 0xA9, 0x99, 0xAA, 0xAF, 0x3F,
+    0xC9, 0x5A, 0xE3, 0xFC, 0x95, 0x9D, 0xA3, 0xFC, 0x96, 0xD4, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xFC,
+    0xA3, 0x99, 0x96, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x95, 0xFF, 0xFC, 0x6F, 0xCA, 0x75, 0xFC, 0x97,
+    0x5F, 0xC9, 0x75, 0xFC, 0x96, 0xDA, 0x3F, 0xC9, 0x6E, 0x3F, 0xC9, 0x5A, 0xE3, 0xFC, 0xA9, 0x99,
+    0x99, 0xAF, 0x19, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xD9, 0x77, 0x77, 0x77,
+    0x19, 0x97, 0x79, 0xF9, 0x75, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xAF, 0x97, 0x69, 0xAA, 0x70, 0x69,
+    0xAC, 0x73, 0xAF, 0x72, 0xFD, 0x70, 0xEA, 0xEA, 0x69, 0xE0, 0x9E, 0x95, 0xE2, 0x9E, 0x4A, 0xD9,
+    0x3A, 0xCA, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0x92, 0xFC, 0xAA, 0xFD,
+    0x19, 0xF3, 0xAF, 0x90, 0xF9, 0x4F, 0xA9, 0xF5, 0xFC, 0xAF, 0xA9, 0x99, 0x99, 0xFC, 0xAF, 0xFF,
+    0xDA, 0xFF, 0xFE, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC,
+    0x72, 0xFD, 0xA9, 0x19, 0x9A, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x79,
+    0x99, 0x99, 0x77, 0x74, 0x99, 0x73, 0xAE, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x3A, 0xA9,
+    0x50, 0x49, 0x96, 0x9F, 0xD9, 0x29, 0xFF, 0x2A, 0xDA, 0x1E, 0x91, 0x9D, 0x2E, 0x96, 0x9E, 0x59,
+    0xF6, 0xE9, 0x7D, 0xA7, 0x19, 0x77, 0x1A, 0xFF, 0xDA, 0xFF, 0xE9, 0xAF, 0xFC, 0xA3, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5,
+    0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0xA3,
+    0x9F, 0xFC, 0x9A, 0xFF, 0xDA, 0xFF, 0xE9, 0x29, 0xAE, 0x94, 0xFF, 0x29, 0xE9, 0x9E, 0x91, 0x9D,
+    0x91, 0xAD, 0xA2, 0xAC, 0x2E, 0x96, 0xAD, 0xA5, 0xFA, 0x6E, 0x70, 0x9C, 0xA7, 0x77, 0x70, 0x99,
+    0x99, 0x93, 0xAF, 0xDA, 0x29, 0xFE, 0xA3, 0xAF, 0xDA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59,
+    0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x49,
+    0xFD, 0xA9, 0x1F, 0xFD, 0x1F, 0xFD, 0x00, 0xAF, 0xFD, 0xAF, 0xFE, 0x9A, 0xFF, 0xCA, 0x3F, 0xCA,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA, 0x5F, 0xCA,
+    0x39, 0xFF, 0xC9, 0xAF, 0xFD, 0xAF, 0xFE, 0x97, 0x77, 0x49, 0x97, 0x9F, 0x95, 0xFC, 0xA5, 0xFC,
+    0xA5, 0xAF, 0x96, 0x9A, 0xA4, 0x49, 0x99, 0x69, 0xFA, 0x5F, 0xD5, 0xFD, 0x5A, 0xFA, 0x6A, 0xAA,
+    0x97, 0x77, 0x79, 0x99, 0x99, 0x3A, 0xFD, 0xA2, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F,
+    0xA5, 0x9F, 0xA4, 0x9F, 0xDA, 0x91, 0xFF, 0xD1, 0xFF, 0xD7, 0x77, 0x59, 0x97, 0x0F, 0x95, 0xAF,
+    0xA5, 0xAF, 0xC5, 0x9F, 0x96, 0x9A, 0xA9, 0x30, 0x71, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72,
+    0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD,
+    0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC,
+    0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73,
+    0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1,
+    0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91,
+    0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9,
+    0x97, 0x77, 0x77, 0x49, 0x97, 0x73, 0x9F, 0x97, 0x71, 0xFC, 0xA7, 0x71, 0xFC, 0xA7, 0x71, 0xAF,
+    0x97, 0x72, 0x9A, 0xA7, 0x20, 0x59, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95, 0xFF, 0xFA, 0x3F,
+    0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA, 0xAF, 0xA5, 0xFC,
+    0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5, 0xAF, 0x9A, 0xFC,
+    0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE,
+    0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x97, 0x77, 0x70, 0x99, 0x76, 0xF7, 0x4A, 0xFA, 0x73, 0xAF,
+    0xA7, 0x39, 0xF9, 0x74, 0x9A, 0xA9, 0x60, 0x72, 0x99, 0x77, 0x29, 0xFD, 0x97, 0x69, 0xFF, 0x76,
+    0xAD, 0xA1, 0xE9, 0x75, 0x9D, 0x2E, 0x97, 0x72, 0x9E, 0x77, 0x19, 0xF7, 0x72, 0xE9, 0x77, 0x3D,
+    0xA7, 0x75, 0x97, 0x75, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF,
+    0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A,
+    0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9,
+    0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F,
+    0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF,
+    0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF,
+    0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x59, 0xAE, 0x97,
+    0x2F, 0xF7, 0x09, 0xE9, 0x9E, 0x97, 0x9D, 0x91, 0xE9, 0x70, 0xAC, 0x2E, 0x97, 0x4E, 0xA7, 0x3F,
+    0xA7, 0x4D, 0xA7, 0x69, 0xCA, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC, 0x95,
+    0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F, 0xCA,
+    0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF, 0xA5,
+    0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF, 0xFC,
+    0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x77, 0x77, 0x72, 0xAC, 0x77, 0x49,
+    0xE7, 0x73, 0xF7, 0x72, 0xAE, 0x74, 0x99, 0xA9, 0x2E, 0x74, 0x9F, 0xA1, 0xCA, 0x75, 0xFD, 0xA7,
+    0x7E, 0xA9, 0xEA, 0x75, 0xEA, 0x19, 0xE7, 0x5A, 0xCA, 0x39, 0xC9, 0x77, 0x09, 0x9A, 0x99, 0x77,
+    0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0x97, 0xAF, 0xFF, 0xEA, 0x5A, 0xFC, 0xA9, 0x19, 0xFE, 0x93,
+    0x9F, 0xC6, 0xAF, 0xD3, 0xFC, 0x97, 0xFD, 0x91, 0xAF, 0xA7, 0x1F, 0xD1, 0xFC, 0x97, 0x1F, 0xD1,
+    0xFC, 0x72, 0xAF, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0xAF, 0xC7, 0x3F,
+    0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x29, 0xFC, 0x09, 0xFC, 0x97, 0x19, 0xFC, 0x09, 0xFC,
+    0xA7, 0x1A, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC, 0xA7, 0x9F, 0xC3, 0xFD, 0x95, 0x9F, 0xC9,
+    0x3A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x5F, 0xFF, 0xFA, 0x7A, 0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xDA,
+    0x76, 0x99, 0xAA, 0x99, 0x71, 0x77, 0x77, 0x0D, 0x76, 0xAE, 0x75, 0xF7, 0x49, 0xE9, 0x74, 0xE9,
+    0x75, 0xDA, 0x70, 0xAA, 0xCA, 0x1A, 0xA7, 0x0A, 0xFA, 0x72, 0x9F, 0xDA, 0x71, 0xEA, 0xAE, 0xA7,
+    0xF1, 0xAE, 0x95, 0xAE, 0x3A, 0xD7, 0x09, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0xA9, 0x70, 0x9F, 0xFC,
+    0x95, 0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99, 0xFC, 0x5F,
+    0xCA, 0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xAF,
+    0xA5, 0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9, 0x19, 0xFF,
+    0xFC, 0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x77, 0x77, 0x6C, 0xA7, 0x74,
+    0xAD, 0x97, 0x73, 0xAE, 0x77, 0x4F, 0x76, 0x99, 0xA9, 0x1A, 0xD9, 0x74, 0x9F, 0xA1, 0xAC, 0x97,
+    0x4F, 0xDA, 0x77, 0xEA, 0x9E, 0xA7, 0x5E, 0xA1, 0x9E, 0x75, 0xAC, 0xA3, 0x9C, 0x97, 0x70, 0x99,
+    0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91,
+    0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9,
+    0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A,
+    0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F,
+    0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9,
+    0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71,
+    0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x77, 0x74, 0xAC, 0xA7, 0x6E, 0x76, 0xEA, 0x75,
+    0xAE, 0x76, 0xEA, 0x76, 0xE7, 0x0A, 0xAC, 0xA2, 0xC9, 0x7A, 0xFA, 0x72, 0x9F, 0xDA, 0x71, 0xEA,
+    0xAE, 0xA7, 0xF1, 0xAE, 0x95, 0xAE, 0x3A, 0xD7, 0x09, 0x77, 0x77, 0x39, 0xAA, 0xAA, 0xA9, 0x70,
+    0x9F, 0xFC, 0x95, 0xFF, 0xFA, 0x3F, 0xFF, 0xD9, 0x19, 0xFA, 0x3F, 0xD1, 0xFC, 0x49, 0xFC, 0x99,
+    0xFC, 0x5F, 0xCA, 0xAF, 0xA5, 0xFC, 0xAA, 0xFA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A,
+    0xFA, 0xAF, 0xA5, 0xAF, 0x9A, 0xFC, 0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x1F, 0xD9, 0x2F, 0xC9,
+    0x19, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA5, 0x9F, 0xFA, 0x72, 0x99, 0x99, 0x96, 0x77, 0x09, 0x77,
+    0x4A, 0xF9, 0x77, 0x0A, 0xDA, 0xE7, 0x70, 0xAC, 0x90, 0x9D, 0x77, 0x4E, 0x74, 0x99, 0xA9, 0x1A,
+    0xDA, 0x74, 0x9F, 0xA0, 0x9C, 0xA7, 0x5F, 0xDA, 0x09, 0x75, 0xEA, 0x9E, 0xA7, 0x5E, 0xA1, 0x9E,
+    0x75, 0xAC, 0xA3, 0x9C, 0x97, 0x70, 0x99, 0xA9, 0x97, 0x7A, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0xC9,
+    0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC, 0x6A, 0xFD, 0x3F, 0xC9, 0x7F,
+    0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7, 0x2A, 0xFC, 0x99, 0xFC, 0x72,
+    0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A, 0xFC,
+    0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71, 0xAF, 0xA1, 0xFD, 0x71, 0xFC,
+    0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA5,
+    0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69, 0x9A, 0xA9, 0x97, 0x10, 0x77,
+    0x76, 0xAF, 0x97, 0x3F, 0xE9, 0x72, 0xDA, 0x09, 0xDA, 0x72, 0xAC, 0x19, 0xDA, 0x76, 0xE7, 0x5F,
+    0x70, 0xAA, 0xCA, 0x1D, 0xA7, 0x0A, 0xFA, 0x09, 0xA9, 0x79, 0xFD, 0xA7, 0x2E, 0xAA, 0xEA, 0x70,
+    0xF1, 0xAE, 0x96, 0xAE, 0x3A, 0xD7, 0x19, 0x77, 0x77, 0x59, 0xAA, 0xAA, 0xA9, 0x71, 0x9F, 0xFC,
+    0x96, 0xFF, 0xFA, 0x4F, 0xFF, 0xD9, 0x29, 0xFA, 0x3F, 0xD2, 0xFC, 0x49, 0xFC, 0x90, 0x9F, 0xC5,
+    0xFC, 0xA0, 0xAF, 0xA5, 0xFC, 0xA0, 0xAF, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5,
+    0xAF, 0xA0, 0xAF, 0xA5, 0xAF, 0x90, 0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x93, 0x9F, 0xC2, 0xFD, 0x92,
+    0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x4A, 0xFF, 0xEA, 0x69, 0xFF, 0xA7, 0x39, 0x99, 0x99, 0x70, 0x70,
+    0x97, 0x74, 0xAF, 0x2D, 0x74, 0x9F, 0xDA, 0xE9, 0x73, 0xAD, 0x90, 0xFD, 0x75, 0xAC, 0x2A, 0xDA,
+    0x77, 0x77, 0x71, 0xFA, 0x77, 0x1F, 0xDA, 0x77, 0xFA, 0xEA, 0x74, 0x9F, 0x19, 0xE9, 0x73, 0x9D,
+    0xA4, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x77, 0xAF, 0xFC, 0xA7, 0x2A, 0xFF, 0xFC, 0x97, 0xAF, 0xFF,
+    0xEA, 0x5A, 0xFC, 0xA9, 0x19, 0xFE, 0x93, 0x9F, 0xC6, 0xAF, 0xD3, 0xFC, 0x97, 0xFD, 0x91, 0xAF,
+    0xA7, 0x1F, 0xD1, 0xFC, 0x97, 0x1F, 0xD1, 0xFC, 0x72, 0xAF, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x99,
+    0xFC, 0x72, 0x9F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x3F, 0xC9, 0xAF, 0xC7, 0x29, 0xFC,
+    0x09, 0xFC, 0x97, 0x19, 0xFC, 0x09, 0xFC, 0xA7, 0x1A, 0xFA, 0x1F, 0xD7, 0x1F, 0xC9, 0x1A, 0xFC,
+    0xA7, 0x9F, 0xC3, 0xFD, 0x95, 0x9F, 0xC9, 0x3A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x5F, 0xFF, 0xFA,
+    0x7A, 0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xDA, 0x76, 0x99, 0xAA, 0x99, 0x71, 0x49, 0xA9, 0x39, 0x70,
+    0xAF, 0x2D, 0x69, 0xFD, 0x9A, 0xD6, 0x9D, 0xAA, 0xFD, 0x7D, 0x19, 0xF9, 0x70, 0x93, 0x9A, 0x77,
+    0x75, 0x9F, 0xA7, 0x3F, 0xE7, 0x1F, 0xAF, 0x7F, 0x19, 0xEA, 0x5A, 0xE3, 0x9D, 0xA7, 0x97, 0x77,
+    0x73, 0x9A, 0xAA, 0xAA, 0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F, 0xA3,
+    0xFD, 0x1F, 0xC4, 0x9F, 0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF,
+    0xCA, 0x5A, 0xFA, 0xFC, 0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93,
+    0x9F, 0xC1, 0xFD, 0x92, 0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7, 0x29,
+    0x99, 0x99, 0x60, 0x71, 0x9A, 0xCA, 0x77, 0x29, 0xFC, 0x77, 0x1F, 0xE7, 0x7F, 0x9F, 0x75, 0xF1,
+    0x9E, 0xA7, 0x3F, 0x39, 0xE7, 0x4A, 0xA5, 0x99, 0x77, 0x77, 0x70, 0x99, 0xA9, 0x97, 0x7A, 0xFF,
+    0xCA, 0x72, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xFE, 0xA5, 0xAF, 0xCA, 0x91, 0x9F, 0xE9, 0x39, 0xFC,
+    0x6A, 0xFD, 0x3F, 0xC9, 0x7F, 0xD9, 0x1A, 0xFA, 0x71, 0xFD, 0x1F, 0xC9, 0x71, 0xFD, 0x1F, 0xC7,
+    0x2A, 0xFC, 0x99, 0xFC, 0x72, 0x9F, 0xC9, 0x9F, 0xC7, 0x29, 0xFC, 0x9A, 0xFC, 0x73, 0xFC, 0x9A,
+    0xFC, 0x73, 0xFC, 0x9A, 0xFC, 0x72, 0x9F, 0xC0, 0x9F, 0xC9, 0x71, 0x9F, 0xC0, 0x9F, 0xCA, 0x71,
+    0xAF, 0xA1, 0xFD, 0x71, 0xFC, 0x91, 0xAF, 0xCA, 0x79, 0xFC, 0x3F, 0xD9, 0x59, 0xFC, 0x93, 0xAF,
+    0xDA, 0x91, 0x9A, 0xFC, 0xA5, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xC9, 0x71, 0x9F, 0xFD, 0xA7, 0x69,
+    0x9A, 0xA9, 0x97, 0x77, 0x77, 0x49, 0x97, 0x73, 0x9F, 0x97, 0x71, 0xFC, 0xA7, 0x71, 0xFC, 0xA7,
+    0x71, 0xAF, 0x97, 0x72, 0x9A, 0xA7, 0x20, 0x7A, 0xAA, 0x75, 0xFA, 0x73, 0xAF, 0xC9, 0x71, 0x9E,
+    0xAE, 0x71, 0xE9, 0x0F, 0x7A, 0xDA, 0x2E, 0x96, 0xE3, 0x9D, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0xAA,
+    0x97, 0x09, 0xFF, 0xC9, 0x5F, 0xFF, 0xA3, 0xFF, 0xFD, 0x91, 0x9F, 0xA3, 0xFD, 0x1F, 0xC4, 0x9F,
+    0xC9, 0x9F, 0xC5, 0xFC, 0xAA, 0xFA, 0x5F, 0xCA, 0xAF, 0xA5, 0xAF, 0xAF, 0xCA, 0x5A, 0xFA, 0xFC,
+    0xA5, 0xAF, 0xAA, 0xFA, 0x5A, 0xF9, 0xAF, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC1, 0xFD, 0x92,
+    0xFC, 0x91, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xEA, 0x59, 0xFF, 0xA7, 0x29, 0x99, 0x99, 0x77, 0x77,
+    0x09, 0x97, 0x6F, 0x74, 0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0x9F, 0x97, 0x49, 0xAA, 0x96, 0x75, 0x9A,
+    0x77, 0x5A, 0xDA, 0x77, 0x29, 0xFC, 0x77, 0x1A, 0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x1F, 0xA5, 0xF9,
+    0x70, 0x99, 0x70, 0xFC, 0x77, 0x3F, 0xC7, 0x19, 0x9A, 0xA9, 0x4F, 0xA6, 0xAF, 0xFC, 0xA0, 0x9F,
+    0x5A, 0xFF, 0xFF, 0xCA, 0x4A, 0xFF, 0xFF, 0xCA, 0x4A, 0xFC, 0xA9, 0x19, 0xFE, 0xA4, 0x9F, 0xC6,
+    0xAF, 0xD4, 0xFC, 0x97, 0xFD, 0x92, 0xAF, 0xA7, 0x1F, 0xD2, 0xFC, 0x97, 0x1F, 0xD2, 0xFC, 0x72,
+    0xAF, 0xC9, 0x09, 0xFC, 0x72, 0x9F, 0xC9, 0x09, 0xFC, 0x72, 0x9F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC,
+    0x90, 0xAF, 0xC7, 0x3F, 0xC9, 0x0A, 0xFC, 0x72, 0x9F, 0xC1, 0x9F, 0xC9, 0x71, 0x9F, 0xC1, 0x9F,
+    0xCA, 0x71, 0xAF, 0xA2, 0xFD, 0x71, 0xFC, 0x92, 0xAF, 0xCA, 0x79, 0xFC, 0x4F, 0xD9, 0x59, 0xFC,
+    0x94, 0xAF, 0xDA, 0x91, 0x9A, 0xFC, 0xA6, 0xFF, 0xFF, 0xA7, 0x0A, 0xFF, 0xFC, 0x97, 0x29, 0xFF,
+    0xDA, 0x77, 0x99, 0xAA, 0x99, 0x72, 0x71, 0x97, 0x70, 0x9D, 0x97, 0x6F, 0x75, 0x9E, 0xA7, 0x5F,
+    0x75, 0xAE, 0x97, 0x5E, 0x94, 0x97, 0x1C, 0x93, 0xF9, 0x75, 0xAF, 0x75, 0x9F, 0x59, 0xAA, 0xAA,
+    0x99, 0x0A, 0xEA, 0x39, 0xFF, 0xFC, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x92, 0x9F, 0xA3, 0xFD, 0x2F,
+    0xC4, 0x9F, 0xC9, 0x09, 0xFC, 0x5F, 0xCA, 0x0A, 0xFA, 0x5F, 0xCA, 0x0A, 0xFA, 0x5A, 0xFA, 0x0F,
+    0xCA, 0x5A, 0xFA, 0x0F, 0xCA, 0x5A, 0xFA, 0x0A, 0xFA, 0x5A, 0xF9, 0x0A, 0xFC, 0x5F, 0xC1, 0x9F,
+    0xC9, 0x39, 0xFC, 0x2F, 0xD9, 0x2F, 0xC9, 0x29, 0xFF, 0xFC, 0xA4, 0xAF, 0xFE, 0xA6, 0x9F, 0xFA,
+    0x73, 0x99, 0x99, 0x97, 0x7A, 0x77, 0x6E, 0x97, 0x74, 0xFC, 0x77, 0x3F, 0xD9, 0x77, 0x19, 0xFD,
+    0xA7, 0x72, 0x9A, 0xF4, 0xF9, 0x74, 0x99, 0x4F, 0xC7, 0x73, 0xFC, 0x71, 0x99, 0xAA, 0x94, 0xFA,
+    0x6A, 0xFF, 0xCA, 0x09, 0xF5, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xCA, 0x91,
+    0x9F, 0xEA, 0x49, 0xFC, 0x6A, 0xFD, 0x4F, 0xC9, 0x7F, 0xD9, 0x2A, 0xFA, 0x71, 0xFD, 0x2F, 0xC9,
+    0x71, 0xFD, 0x2F, 0xC7, 0x2A, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC,
+    0x90, 0xAF, 0xC7, 0x3F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC, 0x90, 0xAF, 0xC7, 0x29, 0xFC, 0x19, 0xFC,
+    0x97, 0x19, 0xFC, 0x19, 0xFC, 0xA7, 0x1A, 0xFA, 0x2F, 0xD7, 0x1F, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F,
+    0xC4, 0xFD, 0x95, 0x9F, 0xC9, 0x4A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x6F, 0xFF, 0xFA, 0x70, 0xAF,
+    0xFF, 0xC9, 0x72, 0x9F, 0xFD, 0xA7, 0x79, 0x9A, 0xA9, 0x97, 0x20, 0x59, 0x77, 0x0D, 0x97, 0x6A,
+    0xE7, 0x6A, 0xF7, 0x6F, 0xA7, 0x6A, 0xEA, 0x76, 0x9E, 0x49, 0x72, 0xC9, 0x2F, 0x97, 0x5A, 0xF7,
+    0x59, 0xF5, 0x9A, 0xAA, 0xA9, 0x90, 0xAE, 0xA3, 0x9F, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD9,
+    0x29, 0xFA, 0x3F, 0xD2, 0xFC, 0x49, 0xFC, 0x90, 0x9F, 0xC5, 0xFC, 0xA0, 0xAF, 0xA5, 0xFC, 0xA0,
+    0xAF, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xAF, 0xA5, 0xAF, 0x90,
+    0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x93, 0x9F, 0xC2, 0xFD, 0x92, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x4A,
+    0xFF, 0xEA, 0x69, 0xFF, 0xA7, 0x39, 0x99, 0x99, 0x70, 0x72, 0x99, 0x77, 0x39, 0xFD, 0x97, 0x79,
+    0xFF, 0x77, 0xAD, 0xA1, 0xE9, 0x76, 0x9D, 0x2E, 0x97, 0x73, 0x9E, 0x77, 0x29, 0xF7, 0x73, 0xE9,
+    0x5F, 0x97, 0x1D, 0xA6, 0xFC, 0x72, 0x97, 0xFC, 0x71, 0x99, 0xAA, 0x94, 0xFA, 0x6A, 0xFF, 0xCA,
+    0x09, 0xF5, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xCA, 0x91, 0x9F, 0xEA, 0x49,
+    0xFC, 0x6A, 0xFD, 0x4F, 0xC9, 0x7F, 0xD9, 0x2A, 0xFA, 0x71, 0xFD, 0x2F, 0xC9, 0x71, 0xFD, 0x2F,
+    0xC7, 0x2A, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0xAF, 0xC7,
+    0x3F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC, 0x90, 0xAF, 0xC7, 0x29, 0xFC, 0x19, 0xFC, 0x97, 0x19, 0xFC,
+    0x19, 0xFC, 0xA7, 0x1A, 0xFA, 0x2F, 0xD7, 0x1F, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F, 0xC4, 0xFD, 0x95,
+    0x9F, 0xC9, 0x4A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x6F, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xC9, 0x72,
+    0x9F, 0xFD, 0xA7, 0x79, 0x9A, 0xA9, 0x97, 0x20, 0x59, 0xAE, 0x97, 0x3F, 0xF7, 0x19, 0xE9, 0x9E,
+    0x97, 0x09, 0xD9, 0x1E, 0x97, 0x1A, 0xC2, 0xE9, 0x75, 0xEA, 0x74, 0xFA, 0x75, 0xDA, 0x59, 0x70,
+    0x9C, 0xA3, 0xF9, 0x75, 0xAF, 0x75, 0x9F, 0x59, 0xAA, 0xAA, 0x99, 0x0A, 0xEA, 0x39, 0xFF, 0xFC,
+    0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x92, 0x9F, 0xA3, 0xFD, 0x2F, 0xC4, 0x9F, 0xC9, 0x09, 0xFC, 0x5F,
+    0xCA, 0x0A, 0xFA, 0x5F, 0xCA, 0x0A, 0xFA, 0x5A, 0xFA, 0x0F, 0xCA, 0x5A, 0xFA, 0x0F, 0xCA, 0x5A,
+    0xFA, 0x0A, 0xFA, 0x5A, 0xF9, 0x0A, 0xFC, 0x5F, 0xC1, 0x9F, 0xC9, 0x39, 0xFC, 0x2F, 0xD9, 0x2F,
+    0xC9, 0x29, 0xFF, 0xFC, 0xA4, 0xAF, 0xFE, 0xA6, 0x9F, 0xFA, 0x73, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x9E, 0xA2, 0xCA, 0x76, 0xFC, 0xA0, 0xAD, 0x97, 0x4A, 0xFF, 0xD9, 0x74, 0xAD, 0x99, 0xFD, 0x76,
+    0xD2, 0xF3, 0xF9, 0x77, 0x3F, 0xC7, 0x73, 0xFC, 0x71, 0x99, 0xAA, 0x94, 0xFA, 0x6A, 0xFF, 0xCA,
+    0x09, 0xF5, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF, 0xCA, 0x91, 0x9F, 0xEA, 0x49,
+    0xFC, 0x6A, 0xFD, 0x4F, 0xC9, 0x7F, 0xD9, 0x2A, 0xFA, 0x71, 0xFD, 0x2F, 0xC9, 0x71, 0xFD, 0x2F,
+    0xC7, 0x2A, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0xAF, 0xC7,
+    0x3F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC, 0x90, 0xAF, 0xC7, 0x29, 0xFC, 0x19, 0xFC, 0x97, 0x19, 0xFC,
+    0x19, 0xFC, 0xA7, 0x1A, 0xFA, 0x2F, 0xD7, 0x1F, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F, 0xC4, 0xFD, 0x95,
+    0x9F, 0xC9, 0x4A, 0xFD, 0xA9, 0x19, 0xAF, 0xCA, 0x6F, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xC9, 0x72,
+    0x9F, 0xFD, 0xA7, 0x79, 0x9A, 0xA9, 0x97, 0x20, 0x4A, 0xD9, 0x2C, 0x97, 0x0F, 0xCA, 0x09, 0xD9,
+    0x69, 0xFF, 0xD9, 0x69, 0xD9, 0x9F, 0xD7, 0x0D, 0x2F, 0x91, 0x97, 0x7F, 0x97, 0x5A, 0xF7, 0x59,
+    0xF5, 0x9A, 0xAA, 0xA9, 0x90, 0xAE, 0xA3, 0x9F, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD9, 0x29,
+    0xFA, 0x3F, 0xD2, 0xFC, 0x49, 0xFC, 0x90, 0x9F, 0xC5, 0xFC, 0xA0, 0xAF, 0xA5, 0xFC, 0xA0, 0xAF,
+    0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xAF, 0xA5, 0xAF, 0x90, 0xAF,
+    0xC5, 0xFC, 0x19, 0xFC, 0x93, 0x9F, 0xC2, 0xFD, 0x92, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x4A, 0xFF,
+    0xEA, 0x69, 0xFF, 0xA7, 0x39, 0x99, 0x99, 0x70, 0x77, 0x77, 0x74, 0xF9, 0x77, 0x3F, 0xC7, 0x73,
+    0xFC, 0x71, 0x99, 0xAA, 0x94, 0xFA, 0x6A, 0xFF, 0xCA, 0x09, 0xF5, 0xAF, 0xFF, 0xFC, 0xA4, 0xAF,
+    0xFF, 0xFC, 0xA4, 0xAF, 0xCA, 0x91, 0x9F, 0xEA, 0x49, 0xFC, 0x6A, 0xFD, 0x4F, 0xC9, 0x7F, 0xD9,
+    0x2A, 0xFA, 0x71, 0xFD, 0x2F, 0xC9, 0x71, 0xFD, 0x2F, 0xC7, 0x2A, 0xFC, 0x90, 0x9F, 0xC7, 0x29,
+    0xFC, 0x90, 0x9F, 0xC7, 0x29, 0xFC, 0x90, 0xAF, 0xC7, 0x3F, 0xC9, 0x0A, 0xFC, 0x73, 0xFC, 0x90,
+    0xAF, 0xC7, 0x29, 0xFC, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x19, 0xFC, 0xA7, 0x1A, 0xFA, 0x2F, 0xD7,
+    0x1F, 0xC9, 0x2A, 0xFC, 0xA7, 0x9F, 0xC4, 0xFD, 0x95, 0x9F, 0xC9, 0x4A, 0xFD, 0xA9, 0x19, 0xAF,
+    0xCA, 0x6F, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xC9, 0x72, 0x9F, 0xFD, 0xA7, 0x79, 0x9A, 0xA9, 0x97,
+    0x77, 0x77, 0x69, 0x97, 0x74, 0x9F, 0x97, 0x72, 0xFC, 0xA7, 0x72, 0xFC, 0xA7, 0x72, 0xAF, 0x97,
+    0x73, 0x9A, 0xA7, 0x30, 0x77, 0x97, 0x7F, 0x97, 0x5A, 0xF7, 0x59, 0xF5, 0x9A, 0xAA, 0xA9, 0x90,
+    0xAE, 0xA3, 0x9F, 0xFF, 0xC3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD9, 0x29, 0xFA, 0x3F, 0xD2, 0xFC, 0x49,
+    0xFC, 0x90, 0x9F, 0xC5, 0xFC, 0xA0, 0xAF, 0xA5, 0xFC, 0xA0, 0xAF, 0xA5, 0xAF, 0xA0, 0xFC, 0xA5,
+    0xAF, 0xA0, 0xFC, 0xA5, 0xAF, 0xA0, 0xAF, 0xA5, 0xAF, 0x90, 0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x93,
+    0x9F, 0xC2, 0xFD, 0x92, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x4A, 0xFF, 0xEA, 0x69, 0xFF, 0xA7, 0x39,
+    0x99, 0x99, 0x77, 0x77, 0x29, 0x97, 0x7F, 0x75, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0x9F, 0x97, 0x59,
+    0xAA, 0x97, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC, 0xA3, 0x9F,
+    0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70,
+    0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F, 0xD6, 0xFC,
+    0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A, 0xFF, 0xDA,
+    0x77, 0x09, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x79, 0xA9, 0x77, 0x5F, 0xA7, 0x73, 0x9F, 0xC7, 0x73,
+    0x9F, 0xC7, 0x74, 0xFA, 0x77, 0x49, 0xAA, 0x97, 0x20, 0x59, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA,
+    0x2A, 0xFE, 0x2F, 0xEA, 0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A,
+    0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF,
+    0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99,
+    0x39, 0x99, 0x77, 0x77, 0x39, 0x97, 0x71, 0x9F, 0x77, 0x0F, 0xC9, 0x77, 0xFC, 0x97, 0x7F, 0xC7,
+    0x71, 0xAA, 0xA7, 0x10, 0x73, 0x99, 0x77, 0x5A, 0xFC, 0xA7, 0x71, 0xFF, 0xA7, 0x70, 0xE1, 0xAE,
+    0x77, 0x0D, 0xA1, 0xAE, 0x77, 0x5E, 0x97, 0x72, 0x9A, 0xE9, 0x77, 0x3E, 0xA7, 0x75, 0x9D, 0x77,
+    0x79, 0x97, 0x77, 0x75, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x0F, 0xFC,
+    0xA3, 0x9F, 0xFA, 0x3A, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59,
+    0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x59, 0xFC, 0x70, 0xFC, 0x6F, 0xC9, 0x69, 0xFA, 0x6F,
+    0xD6, 0xFC, 0x96, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x70, 0xFF, 0xFF, 0x72, 0xFF, 0xFD, 0x97, 0x3A,
+    0xFF, 0xDA, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x10, 0x7A, 0xEA, 0x97, 0x6F, 0xEA, 0x74, 0xAE, 0x9A,
+    0xE7, 0x4A, 0xD2, 0xE7, 0x5A, 0xA2, 0xE7, 0x70, 0x9E, 0x97, 0x69, 0xF9, 0x77, 0x0D, 0x97, 0x72,
+    0xAC, 0x97, 0x77, 0x77, 0x77, 0x39, 0x97, 0x6A, 0xFD, 0x29, 0xAF, 0xCA, 0x2A, 0xFE, 0x2F, 0xEA,
+    0x29, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F,
+    0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF,
+    0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE,
+    0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x77,
+    0xA7, 0x77, 0x09, 0xE7, 0x76, 0xAF, 0x97, 0x73, 0x9F, 0xD7, 0x73, 0x9F, 0xD9, 0x77, 0x3A, 0xEA,
+    0x95, 0xAE, 0xA7, 0x39, 0x71, 0xAF, 0x77, 0x69, 0xF7, 0x76, 0xFC, 0x09, 0xFF, 0xDA, 0x29, 0xFF,
+    0xD9, 0x09, 0xFF, 0xDA, 0x2A, 0xFF, 0xC9, 0x2F, 0xFC, 0xA3, 0x9F, 0xEA, 0x6A, 0xFC, 0x70, 0xFC,
+    0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC,
+    0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC,
+    0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC,
+    0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x96, 0x9F, 0xA7, 0x0F, 0xD6, 0xFC, 0x97, 0x0A, 0xFD, 0xA9,
+    0x09, 0xAF, 0xD7, 0x2F, 0xFF, 0xF7, 0x4F, 0xFF, 0xD9, 0x75, 0xAF, 0xFD, 0xA7, 0x72, 0x9A, 0xAA,
+    0xA9, 0x73, 0x72, 0x97, 0x74, 0xD9, 0x77, 0x1A, 0xE7, 0x70, 0x9F, 0x77, 0x0F, 0x97, 0x79, 0xEA,
+    0x77, 0x0A, 0xD9, 0x69, 0x72, 0xC9, 0x5F, 0x97, 0x70, 0xAF, 0x77, 0x09, 0xEA, 0x59, 0x96, 0x99,
+    0xF9, 0x0A, 0xFD, 0x29, 0xFF, 0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93,
+    0xAF, 0xA5, 0xFD, 0x99, 0x9A, 0xFC, 0xA5, 0xAF, 0xFF, 0xEA, 0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE,
+    0x90, 0xAF, 0xD9, 0x69, 0x99, 0x93, 0x99, 0x93, 0x70, 0xA9, 0x77, 0x70, 0x9D, 0xA7, 0x77, 0xAF,
+    0x97, 0x75, 0xAF, 0xCA, 0x77, 0x5A, 0xFD, 0x77, 0x6A, 0xF5, 0xAE, 0xA7, 0x69, 0x95, 0xAF, 0x77,
+    0x69, 0xF7, 0x76, 0xFC, 0x09, 0xFF, 0xDA, 0x29, 0xFF, 0xD9, 0x09, 0xFF, 0xDA, 0x2A, 0xFF, 0xC9,
+    0x2F, 0xFC, 0xA3, 0x9F, 0xEA, 0x6A, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70,
+    0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70,
+    0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70,
+    0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x96,
+    0x9F, 0xA7, 0x0F, 0xD6, 0xFC, 0x97, 0x0A, 0xFD, 0xA9, 0x09, 0xAF, 0xD7, 0x2F, 0xFF, 0xF7, 0x4F,
+    0xFF, 0xD9, 0x75, 0xAF, 0xFD, 0xA7, 0x72, 0x9A, 0xAA, 0xA9, 0x73, 0x69, 0x77, 0x3A, 0xCA, 0x77,
+    0x19, 0xE9, 0x77, 0x09, 0xF7, 0x71, 0xAF, 0x77, 0x1A, 0xEA, 0x77, 0x19, 0xE6, 0x97, 0x3A, 0xA4,
+    0xF9, 0x77, 0x0A, 0xF7, 0x70, 0x9E, 0xA5, 0x99, 0x69, 0x9F, 0x90, 0xAF, 0xD2, 0x9F, 0xFA, 0x0A,
+    0xFE, 0x2F, 0xF9, 0x19, 0xFE, 0x2A, 0xFD, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA,
+    0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA, 0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39,
+    0x99, 0x30, 0x73, 0x99, 0x77, 0x7A, 0xFC, 0xA7, 0x73, 0xFF, 0xA7, 0x72, 0xE1, 0xAE, 0x77, 0x2D,
+    0xA1, 0xAE, 0x77, 0x7E, 0x97, 0x74, 0x9A, 0xE9, 0x77, 0x5E, 0xA6, 0xAE, 0xA7, 0x39, 0xD7, 0xAF,
+    0x74, 0x99, 0x79, 0xF7, 0x76, 0xFC, 0x09, 0xFF, 0xDA, 0x29, 0xFF, 0xD9, 0x09, 0xFF, 0xDA, 0x2A,
+    0xFF, 0xC9, 0x2F, 0xFC, 0xA3, 0x9F, 0xEA, 0x6A, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x70,
+    0xFC, 0x96, 0x9F, 0xA7, 0x0F, 0xD6, 0xFC, 0x97, 0x0A, 0xFD, 0xA9, 0x09, 0xAF, 0xD7, 0x2F, 0xFF,
+    0xF7, 0x4F, 0xFF, 0xD9, 0x75, 0xAF, 0xFD, 0xA7, 0x72, 0x9A, 0xAA, 0xA9, 0x73, 0x69, 0xAE, 0xA7,
+    0x6A, 0xFE, 0x75, 0xE9, 0x9E, 0xA7, 0x4D, 0xA1, 0xAD, 0xA7, 0x49, 0xC9, 0x1E, 0x97, 0x70, 0xAE,
+    0x77, 0xAE, 0xA7, 0x70, 0xAD, 0x79, 0x72, 0xD5, 0xF9, 0x77, 0x0A, 0xF7, 0x70, 0x9E, 0xA5, 0x99,
+    0x69, 0x9F, 0x90, 0xAF, 0xD2, 0x9F, 0xFA, 0x0A, 0xFE, 0x2F, 0xF9, 0x19, 0xFE, 0x2A, 0xFD, 0xA5,
+    0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A,
+    0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F,
+    0xC9, 0x3A, 0xFA, 0x5F, 0xD9, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xFE, 0xA9, 0x4F, 0xFC, 0xAF, 0xEA,
+    0x4F, 0xE9, 0x0A, 0xFD, 0x96, 0x99, 0x99, 0x39, 0x99, 0x30, 0x77, 0x77, 0x4A, 0xE2, 0xAC, 0x77,
+    0x1F, 0xD9, 0x0D, 0xA7, 0x70, 0xFF, 0xDA, 0x77, 0x0D, 0xA0, 0xAF, 0xC9, 0x77, 0x0A, 0xC2, 0xAE,
+    0x93, 0xAE, 0xA7, 0x76, 0xAF, 0x77, 0x69, 0xF7, 0x76, 0xFC, 0x09, 0xFF, 0xDA, 0x29, 0xFF, 0xD9,
+    0x09, 0xFF, 0xDA, 0x2A, 0xFF, 0xC9, 0x2F, 0xFC, 0xA3, 0x9F, 0xEA, 0x6A, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x96, 0x9F, 0xA7, 0x0F, 0xD6, 0xFC, 0x97, 0x0A, 0xFD, 0xA9, 0x09,
+    0xAF, 0xD7, 0x2F, 0xFF, 0xF7, 0x4F, 0xFF, 0xD9, 0x75, 0xAF, 0xFD, 0xA7, 0x72, 0x9A, 0xAA, 0xA9,
+    0x73, 0x5A, 0xDA, 0x2A, 0xA7, 0x3F, 0xD1, 0xD9, 0x72, 0xFF, 0xDA, 0x71, 0x9D, 0xA0, 0xFD, 0x97,
+    0x2D, 0x2F, 0xA3, 0x97, 0x59, 0x3F, 0x97, 0x70, 0xAF, 0x77, 0x09, 0xEA, 0x59, 0x96, 0x99, 0xF9,
+    0x0A, 0xFD, 0x29, 0xFF, 0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4, 0xAF,
+    0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC,
+    0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93, 0xAF,
+    0xA5, 0xFD, 0x99, 0x9A, 0xFC, 0xA5, 0xAF, 0xFF, 0xEA, 0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE, 0x90,
+    0xAF, 0xD9, 0x69, 0x99, 0x93, 0x99, 0x93, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x77, 0x6A, 0xF7, 0x76,
+    0x9F, 0x77, 0x6F, 0xC0, 0x9F, 0xFD, 0xA2, 0x9F, 0xFD, 0x90, 0x9F, 0xFD, 0xA2, 0xAF, 0xFC, 0x92,
+    0xFF, 0xCA, 0x39, 0xFE, 0xA6, 0xAF, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F,
+    0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F,
+    0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F,
+    0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x69,
+    0xFA, 0x70, 0xFD, 0x6F, 0xC9, 0x70, 0xAF, 0xDA, 0x90, 0x9A, 0xFD, 0x72, 0xFF, 0xFF, 0x74, 0xFF,
+    0xFD, 0x97, 0x5A, 0xFF, 0xDA, 0x77, 0x29, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x73, 0x9A, 0x97, 0x77,
+    0xFA, 0x77, 0x59, 0xFC, 0x77, 0x59, 0xFC, 0x77, 0x6F, 0xA7, 0x76, 0x9A, 0xA9, 0x74, 0x77, 0x29,
+    0x77, 0x2F, 0x97, 0x70, 0xAF, 0x77, 0x09, 0xEA, 0x59, 0x96, 0x99, 0xF9, 0x0A, 0xFD, 0x29, 0xFF,
+    0xA0, 0xAF, 0xE2, 0xFF, 0x91, 0x9F, 0xE2, 0xAF, 0xDA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4,
+    0xAF, 0xA5, 0xFC, 0x4A, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x93, 0xAF, 0xA5, 0xFD, 0x99, 0x9A,
+    0xFC, 0xA5, 0xAF, 0xFF, 0xEA, 0x94, 0xFF, 0xCA, 0xFE, 0xA4, 0xFE, 0x90, 0xAF, 0xD9, 0x69, 0x99,
+    0x93, 0x99, 0x97, 0x77, 0x73, 0x99, 0x77, 0x19, 0xF7, 0x70, 0xFC, 0x97, 0x7F, 0xC9, 0x77, 0xFC,
+    0x77, 0x1A, 0xAA, 0x71, 0x69, 0xA7, 0x75, 0xE9, 0x77, 0x29, 0xFA, 0x77, 0x2F, 0xD9, 0x77, 0x09,
+    0xFD, 0x97, 0x71, 0x9A, 0xEA, 0x77, 0x59, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xFD, 0x91, 0xAF, 0xF9,
+    0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x29, 0xFE, 0x92, 0x9F, 0xD6, 0xAE, 0xA5, 0x9F, 0xC9,
+    0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9, 0x3F, 0x71, 0xAF, 0xC2, 0xAE, 0x97, 0x2F, 0xC9, 0x1E,
+    0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9, 0xEA, 0x76, 0xFF, 0x77, 0xAF, 0xD9, 0x77, 0x0F, 0xD7,
+    0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71,
+    0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF, 0xF7, 0x3F, 0xFF, 0x50, 0x69, 0x77, 0x3A, 0xCA, 0x77,
+    0x19, 0xE9, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xAF, 0x77, 0x19, 0xE7, 0x73, 0xAA, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x0F, 0xFC, 0x91, 0xAF, 0xE2, 0xFD, 0xA4,
+    0x9F, 0xA4, 0xFC, 0xA5, 0xF5, 0xAF, 0xC4, 0xAE, 0xA6, 0xFC, 0x4F, 0x7A, 0xFA, 0x29, 0xF7, 0x9F,
+    0xC2, 0xAE, 0x97, 0x0F, 0xC2, 0xF7, 0x19, 0xF9, 0x09, 0xE9, 0x72, 0xFA, 0x0F, 0x73, 0xAF, 0x9E,
+    0xA7, 0x4F, 0xF7, 0x5A, 0xFD, 0xA7, 0x6F, 0xD7, 0x7A, 0xFC, 0x77, 0x9F, 0x97, 0x70, 0xF7, 0x70,
+    0xF9, 0x77, 0xAF, 0x75, 0x9A, 0xFC, 0x72, 0xAF, 0xFC, 0x97, 0x29, 0xFF, 0x97, 0x4F, 0xE7, 0x69,
+    0xAA, 0xAA, 0x77, 0x9F, 0xFD, 0x91, 0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x29,
+    0xFE, 0x92, 0x9F, 0xD6, 0xAE, 0xA5, 0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9, 0x3F,
+    0x71, 0xAF, 0xC2, 0xAE, 0x97, 0x2F, 0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9, 0xEA,
+    0x76, 0xFF, 0x77, 0xAF, 0xD9, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF,
+    0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF, 0xF7,
+    0x3F, 0xFF, 0x77, 0x77, 0x77, 0x77, 0x9A, 0x97, 0x73, 0xAF, 0x77, 0x2F, 0xC9, 0x77, 0x1F, 0xC9,
+    0x77, 0x1F, 0xC7, 0x73, 0xAA, 0xA7, 0x20, 0x77, 0x59, 0xFF, 0xCA, 0x1A, 0xFE, 0x90, 0xFF, 0xC9,
+    0x1A, 0xFE, 0x2F, 0xDA, 0x49, 0xFA, 0x4F, 0xCA, 0x5F, 0x5A, 0xFC, 0x4A, 0xEA, 0x6F, 0xC4, 0xF7,
+    0xAF, 0xA2, 0x9F, 0x79, 0xFC, 0x2A, 0xE9, 0x70, 0xFC, 0x2F, 0x71, 0x9F, 0x90, 0x9E, 0x97, 0x2F,
+    0xA0, 0xF7, 0x3A, 0xF9, 0xEA, 0x74, 0xFF, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0xAF, 0xC7, 0x79,
+    0xF9, 0x77, 0x0F, 0x77, 0x0F, 0x92, 0x97, 0x3A, 0xF1, 0xAE, 0xA6, 0x9A, 0xFC, 0x2F, 0xC2, 0xAF,
+    0xFC, 0x91, 0x9F, 0xC2, 0x9F, 0xF9, 0x3F, 0xA3, 0xFE, 0x6A, 0xA9, 0x49, 0xAA, 0xAA, 0x77, 0x72,
+    0x99, 0x77, 0x29, 0xFD, 0x77, 0x9F, 0xF7, 0x6E, 0x90, 0x9E, 0x97, 0x5A, 0xD2, 0xE7, 0x73, 0xAE,
+    0x77, 0x1A, 0xF7, 0x71, 0x9E, 0x97, 0x73, 0xD9, 0x77, 0x49, 0x97, 0x77, 0x73, 0x9F, 0xFD, 0x91,
+    0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x29, 0xFE, 0x92, 0x9F, 0xD6, 0xAE, 0xA5,
+    0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9, 0x3F, 0x71, 0xAF, 0xC2, 0xAE, 0x97, 0x2F,
+    0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9, 0xEA, 0x76, 0xFF, 0x77, 0xAF, 0xD9, 0x77,
+    0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF,
+    0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF, 0xF7, 0x3F, 0xFF, 0x50, 0x69, 0xAE, 0xA7,
+    0x6A, 0xFE, 0x75, 0xEA, 0x9E, 0xA7, 0x4D, 0xA1, 0xAE, 0x74, 0x9C, 0x91, 0xAD, 0xA7, 0x70, 0xAE,
+    0x77, 0xAE, 0xA7, 0x70, 0xAD, 0x77, 0x3D, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9F, 0xFC, 0xA1, 0xAF,
+    0xE9, 0x0F, 0xFC, 0x91, 0xAF, 0xE2, 0xFD, 0xA4, 0x9F, 0xA4, 0xFC, 0xA5, 0xF5, 0xAF, 0xC4, 0xAE,
+    0xA6, 0xFC, 0x4F, 0x7A, 0xFA, 0x29, 0xF7, 0x9F, 0xC2, 0xAE, 0x97, 0x0F, 0xC2, 0xF7, 0x19, 0xF9,
+    0x09, 0xE9, 0x72, 0xFA, 0x0F, 0x73, 0xAF, 0x9E, 0xA7, 0x4F, 0xF7, 0x5A, 0xFD, 0xA7, 0x6F, 0xD7,
+    0x7A, 0xFC, 0x77, 0x9F, 0x97, 0x70, 0xF7, 0x70, 0xF9, 0x77, 0xAF, 0x75, 0x9A, 0xFC, 0x72, 0xAF,
+    0xFC, 0x97, 0x29, 0xFF, 0x97, 0x4F, 0xE7, 0x69, 0xAA, 0xAA, 0x77, 0x77, 0x76, 0x9E, 0xA2, 0xC9,
+    0x74, 0x9F, 0xCA, 0x0A, 0xD7, 0x4F, 0xFE, 0x74, 0xE0, 0x9F, 0xD7, 0x49, 0xCA, 0x19, 0xEA, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x9F, 0xFD, 0x91, 0xAF, 0xF9, 0xAF, 0xFD, 0x2F, 0xFC, 0x90, 0xFF, 0xC9,
+    0x29, 0xFE, 0x92, 0x9F, 0xD6, 0xAE, 0xA5, 0x9F, 0xC9, 0x5F, 0x7F, 0xD4, 0xAE, 0xA7, 0x9F, 0xC9,
+    0x3F, 0x71, 0xAF, 0xC2, 0xAE, 0x97, 0x2F, 0xC9, 0x1E, 0xA7, 0x39, 0xFC, 0x0A, 0xE7, 0x5F, 0xC9,
+    0xEA, 0x76, 0xFF, 0x77, 0xAF, 0xD9, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71,
+    0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0xAF, 0xA7, 0x7A, 0xFF, 0xCA, 0x73, 0xFF,
+    0xF7, 0x3F, 0xFF, 0x50, 0x5A, 0xDA, 0x2A, 0xA7, 0x3A, 0xFC, 0x1D, 0xA7, 0x2F, 0xFD, 0xA7, 0x2D,
+    0xA0, 0xFD, 0x97, 0x2A, 0xC2, 0xAE, 0xA7, 0x72, 0x97, 0x77, 0x77, 0x77, 0x77, 0x29, 0xFF, 0xCA,
+    0x1A, 0xFE, 0x90, 0xFF, 0xC9, 0x1A, 0xFE, 0x2F, 0xDA, 0x49, 0xFA, 0x4F, 0xCA, 0x5F, 0x5A, 0xFC,
+    0x4A, 0xEA, 0x6F, 0xC4, 0xF7, 0xAF, 0xA2, 0x9F, 0x79, 0xFC, 0x2A, 0xE9, 0x70, 0xFC, 0x2F, 0x71,
+    0x9F, 0x90, 0x9E, 0x97, 0x2F, 0xA0, 0xF7, 0x3A, 0xF9, 0xEA, 0x74, 0xFF, 0x75, 0xAF, 0xDA, 0x76,
+    0xFD, 0x77, 0xAF, 0xC7, 0x79, 0xF9, 0x77, 0x0F, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x59, 0xAF, 0xC7,
+    0x2A, 0xFF, 0xC9, 0x72, 0x9F, 0xF9, 0x74, 0xFE, 0x76, 0x9A, 0xAA, 0xA7, 0x70, 0x1A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x70, 0xCA, 0x1A, 0xC1, 0x9C, 0xAA, 0xC9, 0x29,
+    0xD9, 0x3A, 0xD9, 0x2A, 0xF9, 0x1C, 0x9A, 0xA9, 0xC3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA7, 0x20, 0x49, 0xC7, 0x2A, 0xC9, 0x71,
+    0xAC, 0x97, 0x19, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x99, 0x99, 0x9A, 0xCA, 0x09, 0xC5, 0xCA, 0x19,
+    0xC4, 0xCA, 0x29, 0xC3, 0xCA, 0x39, 0xC2, 0x99, 0x49, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x75, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xFD, 0x1A, 0xCA, 0x99, 0x99, 0x99,
+    0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73, 0x09, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0x9F, 0xFD, 0x9F,
+    0xFD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0x9F, 0xFD,
+    0x9F, 0xFD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0A, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77,
+    0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFF, 0xFA, 0x77, 0x00, 0x77, 0x77, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x77, 0x77, 0x00, 0x77, 0x77, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x77, 0x77, 0x00, 0x0A, 0xAA,
+    0x92, 0xAA, 0xA9, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F,
+    0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F,
+    0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F,
+    0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F,
+    0x2F, 0x0F, 0x2F, 0x09, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77,
+    0x1F, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFF, 0xFA, 0x39, 0x4E, 0x2E, 0x91, 0xAE, 0x2E, 0xA1, 0x9E,
+    0x91, 0xAE, 0x91, 0xFA, 0x1A, 0xF1, 0x9F, 0x91, 0x9C, 0xA2, 0x39, 0x3A, 0xE1, 0x9F, 0xA1, 0xFC,
+    0x19, 0xF1, 0x9E, 0xA1, 0x9E, 0x91, 0xAE, 0x2E, 0x91, 0xAD, 0xA2, 0x9A, 0xA2, 0x39, 0x3A, 0xE1,
+    0x9F, 0xA1, 0xFC, 0x19, 0xF1, 0x9E, 0xA1, 0x9E, 0x91, 0xAE, 0x2E, 0x91, 0xAD, 0xA2, 0x9C, 0xA2,
+    0x19, 0x93, 0xF1, 0xAF, 0x90, 0xAF, 0x1A, 0xE9, 0x1A, 0xE9, 0x2E, 0xA2, 0xAE, 0x3E, 0x92, 0xAE,
+    0x39, 0xA9, 0x00, 0x39, 0x49, 0x93, 0xE2, 0xAD, 0x91, 0xE9, 0x19, 0xE1, 0xAE, 0x2E, 0xA1, 0xEA,
+    0x19, 0xE1, 0x9E, 0x91, 0xF1, 0xAE, 0x91, 0xF1, 0xFA, 0x1F, 0x90, 0xAF, 0x1F, 0xC0, 0x9F, 0x90,
+    0xAF, 0x19, 0xCA, 0x3A, 0xCA, 0x10, 0x39, 0x49, 0x93, 0xAE, 0x19, 0xEA, 0x19, 0xFA, 0x0F, 0xC2,
+    0xFC, 0x1F, 0x91, 0x9F, 0x1F, 0x91, 0x9E, 0xA1, 0xAE, 0x29, 0xE9, 0x1F, 0x2A, 0xE2, 0xE9, 0x2E,
+    0x91, 0xAE, 0x2A, 0xDA, 0x2E, 0x39, 0xAA, 0x3A, 0xA9, 0x20, 0x39, 0x72, 0xAE, 0x19, 0xEA, 0x19,
+    0xFA, 0x0F, 0xC2, 0xFC, 0x1F, 0x91, 0x9F, 0x1F, 0x91, 0x9E, 0xA1, 0xAE, 0x91, 0x9E, 0x91, 0xF2,
+    0xAE, 0x2E, 0x92, 0xE9, 0x1A, 0xE2, 0xAD, 0xA2, 0xE9, 0x29, 0xCA, 0x3A, 0xC9, 0x20, 0x19, 0x94,
+    0x93, 0xF1, 0x9E, 0xA0, 0xAF, 0x90, 0xFC, 0x0A, 0xF1, 0xF9, 0x0A, 0xE9, 0x1F, 0x1A, 0xE9, 0x1F,
+    0x2E, 0xA1, 0xAE, 0x2A, 0xE2, 0xE9, 0x2E, 0x91, 0xAE, 0x2A, 0xE2, 0xE9, 0x29, 0xA9, 0x3A, 0xA0,
+    0x69, 0x73, 0xFA, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x2A, 0xE5, 0xAC, 0xA9, 0x09, 0xE0, 0x9A,
+    0xD0, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFA, 0xAE, 0xAF, 0x09, 0x92, 0x9D, 0xA2, 0x99, 0x59, 0xDA,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xF7, 0x2F, 0x97,
+    0x1F, 0x97, 0x19, 0xAA, 0xA5, 0x69, 0x73, 0xFA, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xAE, 0x72, 0xAE,
+    0x5A, 0xCA, 0x90, 0x9E, 0x09, 0xAD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xAA, 0xEA, 0xAE, 0x09,
+    0x92, 0x9E, 0x39, 0x5A, 0xE7, 0x2F, 0x72, 0xF9, 0x71, 0xAE, 0x72, 0x9E, 0x5A, 0xCA, 0x91, 0xDA,
+    0x09, 0xAD, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xAA, 0xE9, 0xAE, 0x09, 0x92, 0x9E, 0x39, 0x5A,
+    0xE7, 0x2F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0x9A, 0xAA, 0x50, 0x70, 0x9F, 0x91, 0xFD, 0x9A, 0xFD,
+    0xAA, 0xFD, 0xAA, 0xFD, 0x90, 0xFD, 0x2A, 0xAA, 0xA1, 0x0A, 0xA7, 0x1E, 0xA7, 0xFC, 0xA5, 0xFE,
+    0xA3, 0xFF, 0xCA, 0x1F, 0xFD, 0xA0, 0xFF, 0xD9, 0x0F, 0xF9, 0x2F, 0xD9, 0x4F, 0x96, 0xAC, 0x97,
+    0x73, 0x19, 0xAA, 0x91, 0xAF, 0x90, 0xFC, 0xA0, 0xFC, 0xA0, 0xAF, 0x91, 0x99, 0x91, 0x09, 0xAA,
+    0xA4, 0xAA, 0xA1, 0x9F, 0xC2, 0xFC, 0x0A, 0xFC, 0x1A, 0xFC, 0x9A, 0xFC, 0x1A, 0xFC, 0x09, 0xFA,
+    0x2F, 0xC1, 0x99, 0xA9, 0x49, 0xA9, 0x10, 0x1A, 0xAA, 0x7A, 0xAA, 0x7A, 0xAA, 0x2F, 0xC5, 0xFC,
+    0x5F, 0xC0, 0x9F, 0xC9, 0x39, 0xFC, 0x93, 0x9F, 0xC9, 0x9F, 0xC9, 0x39, 0xFC, 0x93, 0x9F, 0xC9,
+    0x0F, 0xC5, 0xFC, 0x5F, 0xC2, 0x9A, 0x97, 0x9A, 0x97, 0x9A, 0x91, 0x19, 0xAA, 0x91, 0xAF, 0x90,
+    0xFC, 0xA0, 0xFC, 0xA0, 0xAF, 0x29, 0x99, 0x10, 0x49, 0xC7, 0x2A, 0xC9, 0x71, 0xAC, 0x97, 0x19,
+    0xC9, 0x1C, 0xA1, 0x9F, 0xC0, 0x9C, 0x92, 0x99, 0xAC, 0xA0, 0x9C, 0x5C, 0xA1, 0x9C, 0x4C, 0xA2,
+    0x9C, 0x3C, 0xA3, 0x9C, 0x29, 0x94, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x77, 0x50, 0x4C,
+    0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xC9, 0x19, 0xC1, 0xAC, 0xA9, 0x93, 0xC9, 0x1A,
+    0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x73, 0x39, 0x96, 0x9D, 0x94, 0x9F, 0x4C, 0xAA, 0xA9, 0xC2, 0xCA, 0x0A, 0xA0,
+    0xAC, 0x0A, 0xA1, 0xAA, 0x1A, 0xA9, 0x2A, 0xA2, 0x93, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x75, 0x3A, 0xA1, 0xC9, 0x70,
+    0xD0, 0x9C, 0xA7, 0x0D, 0x1C, 0xA7, 0x0D, 0x1C, 0xA0, 0xAF, 0xFC, 0x1C, 0xAA, 0xC9, 0x99, 0x99,
+    0xAC, 0x90, 0xAC, 0x0A, 0xA3, 0x9C, 0x90, 0xAC, 0x1A, 0xA2, 0x9C, 0x90, 0xAC, 0x2A, 0xA1, 0x9C,
+    0x90, 0xAC, 0x3A, 0xA1, 0x92, 0x94, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x77, 0x71, 0x39,
+    0xC1, 0xAA, 0x6A, 0xC9, 0x0D, 0x6A, 0xC9, 0x0D, 0x6A, 0xC1, 0xD6, 0xAC, 0x1F, 0xFC, 0xA0, 0xCA,
+    0x09, 0xCA, 0x99, 0x99, 0x9C, 0xA1, 0xCA, 0x09, 0xC9, 0x3A, 0xA2, 0xCA, 0x09, 0xC9, 0x2A, 0xA3,
+    0xCA, 0x09, 0xC9, 0x1A, 0xA4, 0x92, 0x91, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x75, 0x77, 0x77, 0x77, 0x77, 0xCA, 0x77, 0x70, 0x9F, 0xCA, 0x70, 0xAE, 0x77, 0x6A, 0xFF, 0x7E,
+    0xA7, 0x75, 0x9E, 0xA9, 0xAE, 0xA5, 0xAE, 0x77, 0x6E, 0xA2, 0xF4, 0x9E, 0x97, 0x75, 0x9E, 0x92,
+    0xAE, 0x4F, 0x77, 0x69, 0xE3, 0x9E, 0x92, 0x9E, 0x77, 0x7A, 0xE3, 0x9E, 0x92, 0xEA, 0x77, 0x7A,
+    0xE3, 0x9E, 0x91, 0x9E, 0x77, 0x70, 0xAE, 0x39, 0xE2, 0xE9, 0x77, 0x70, 0x9E, 0x92, 0xAE, 0x1A,
+    0xE3, 0x9A, 0xA9, 0x71, 0x9A, 0x99, 0x4F, 0x2E, 0xA1, 0xE9, 0x1A, 0xFD, 0x95, 0xAF, 0xD9, 0x2A,
+    0xFF, 0xC1, 0xAD, 0xA1, 0xFF, 0xC9, 0x3F, 0xFC, 0x3A, 0xFE, 0x2E, 0x19, 0xE9, 0x09, 0xF2, 0xAE,
+    0x90, 0x9F, 0x39, 0xAD, 0xA9, 0x2E, 0xA1, 0xEA, 0x2A, 0xE2, 0xEA, 0x2A, 0xE7, 0x39, 0xE2, 0xE9,
+    0x29, 0xE9, 0x09, 0xE9, 0x29, 0xE9, 0x72, 0xEA, 0x19, 0xE9, 0x3E, 0xA0, 0xAE, 0x39, 0xE9, 0x71,
+    0xAE, 0x29, 0xE9, 0x3E, 0xA0, 0xAE, 0x39, 0xE9, 0x71, 0xE9, 0x29, 0xE9, 0x29, 0xE9, 0x0A, 0xE3,
+    0x9E, 0x97, 0x0A, 0xE3, 0x9E, 0x92, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x70, 0x9E, 0x94, 0xEA, 0x2A,
+    0xE1, 0x9E, 0xA2, 0xF7, 0x0F, 0x5F, 0x90, 0x9E, 0xA2, 0xF9, 0x0A, 0xE9, 0x79, 0xE9, 0x6F, 0xFC,
+    0x39, 0xFF, 0xA7, 0x0E, 0xA7, 0x0F, 0xDA, 0x59, 0xFD, 0xA7, 0x19, 0xD7, 0x29, 0x99, 0x97, 0x19,
+    0x99, 0x97, 0x59, 0x77, 0x77, 0x10, 0x39, 0xA9, 0x5E, 0xA3, 0x9F, 0x3F, 0xC3, 0xFA, 0x2A, 0xF3,
+    0xF9, 0x2A, 0xEA, 0x3F, 0x4E, 0x69, 0x94, 0x39, 0xA9, 0x4A, 0x95, 0xEA, 0x2A, 0xE3, 0x9F, 0x2F,
+    0x92, 0xFC, 0x1A, 0xF3, 0xFA, 0x1F, 0xA2, 0xAF, 0x1A, 0xF3, 0xF9, 0x1F, 0xA2, 0xAE, 0xA1, 0x9F,
+    0x3F, 0x2F, 0x4E, 0x3A, 0xD9, 0x59, 0x94, 0x99, 0x40, 0x39, 0xA9, 0x4A, 0x94, 0xC9, 0x5E, 0xA2,
+    0xAE, 0x29, 0xE3, 0x9F, 0x2F, 0x91, 0xFA, 0x2F, 0xC1, 0xAF, 0x19, 0xF9, 0x2F, 0xA1, 0xFA, 0x1F,
+    0xC2, 0xAF, 0x1A, 0xF1, 0x9F, 0x92, 0xF9, 0x1F, 0xA1, 0xFA, 0x2A, 0xEA, 0x19, 0xF2, 0xF3, 0xF2,
+    0xF2, 0xAE, 0x93, 0xE3, 0xAD, 0x92, 0x9D, 0xA5, 0x99, 0x49, 0x94, 0x9A, 0x40, 0x19, 0xA9, 0x4A,
+    0xE4, 0xF9, 0x3F, 0xC3, 0xAF, 0x4F, 0xA3, 0x9F, 0x4A, 0xEA, 0x4F, 0x5E, 0x59, 0x91, 0x1A, 0xA4,
+    0x9A, 0x39, 0xE3, 0xE9, 0x2F, 0xA1, 0xAF, 0x2A, 0xF1, 0x9F, 0x92, 0xFA, 0x1F, 0xC2, 0xAF, 0x19,
+    0xF3, 0xF9, 0x1F, 0xA2, 0x9F, 0x2F, 0x3A, 0xE9, 0x19, 0xE9, 0x3E, 0x3A, 0xD9, 0x4A, 0x5A, 0x10,
+    0x1A, 0xA4, 0x9A, 0x49, 0xA3, 0x9E, 0x3E, 0x92, 0xEA, 0x2F, 0xA1, 0xAF, 0x19, 0xF2, 0xAF, 0x19,
+    0xF9, 0x1F, 0xA2, 0xFA, 0x1F, 0xC1, 0xFC, 0x2A, 0xF1, 0x9F, 0x19, 0xF9, 0x2F, 0x91, 0xFA, 0x1A,
+    0xF2, 0x9F, 0x2F, 0x2F, 0x92, 0xAE, 0x91, 0x9E, 0x92, 0xEA, 0x3E, 0x3A, 0xD9, 0x29, 0xDA, 0x4A,
+    0x5A, 0x59, 0x90, 0x59, 0xA7, 0x29, 0xDA, 0x70, 0x9F, 0xA6, 0x9F, 0xDA, 0x49, 0xEA, 0x0E, 0xA2,
+    0x9E, 0xA2, 0xEA, 0x1A, 0xDA, 0x4E, 0x90, 0x5A, 0x94, 0x9E, 0x92, 0xAF, 0x2A, 0xF2, 0xFC, 0x2F,
+    0xC9, 0x2F, 0xA3, 0xFC, 0x93, 0xFC, 0x4F, 0xC4, 0xAF, 0x49, 0xE9, 0x5A, 0xA0, 0x09, 0xA5, 0x9E,
+    0x94, 0xFA, 0x4F, 0xA4, 0xFC, 0x39, 0xFC, 0x3A, 0xF2, 0x9F, 0xC2, 0xFC, 0x2F, 0xA2, 0xAE, 0xA2,
+    0x9E, 0x94, 0x9A, 0x50, 0x77, 0x5C, 0xA7, 0x59, 0xCA, 0x0A, 0xDA, 0x4D, 0xA4, 0xE1, 0xAD, 0xA2,
+    0xAE, 0x3E, 0x3A, 0xDA, 0x1A, 0xE2, 0xE9, 0x4E, 0x91, 0xD9, 0x1E, 0x96, 0xE9, 0x4E, 0x97, 0x0E,
+    0x92, 0xAD, 0x97, 0x2E, 0x90, 0xAD, 0xA7, 0x9A, 0x2E, 0xAD, 0xA1, 0x9A, 0x3A, 0xE1, 0x9F, 0xA1,
+    0x9E, 0x2F, 0x2A, 0xE2, 0xAE, 0x91, 0x9E, 0x19, 0xFC, 0x19, 0xE3, 0x99, 0x19, 0xE9, 0xE2, 0x97,
+    0x9E, 0x19, 0xDA, 0x72, 0xE3, 0xAD, 0xA7, 0x0E, 0x5A, 0xDA, 0x6E, 0x91, 0xDA, 0x1A, 0xDA, 0x4E,
+    0x91, 0xAE, 0x2E, 0x92, 0xE9, 0x2A, 0xE3, 0xE9, 0x0A, 0xD9, 0x4A, 0xC9, 0x4E, 0x1A, 0xA7, 0x6C,
+    0x97, 0x75, 0x1A, 0xAA, 0x94, 0x9A, 0xAA, 0x1F, 0xA3, 0xAF, 0x09, 0xFA, 0x3F, 0xC0, 0xAF, 0x93,
+    0xFC, 0x0A, 0xF4, 0xFC, 0x0A, 0xF4, 0xFA, 0x0A, 0xF4, 0xFA, 0x0A, 0xF4, 0xF9, 0x0A, 0xF4, 0xF9,
+    0x0A, 0xF4, 0xF9, 0x0A, 0xF4, 0xF9, 0x09, 0xF4, 0xF9, 0x09, 0xF4, 0xF9, 0x1E, 0xA4, 0xAE, 0x91,
+    0xEA, 0x4A, 0xE9, 0x1E, 0xA4, 0x9E, 0x91, 0xF4, 0x9E, 0x91, 0xAE, 0x5E, 0x91, 0x99, 0x7A, 0x97,
+    0x74, 0x99, 0x96, 0x99, 0x2F, 0xC3, 0x9F, 0x99, 0xFC, 0x3F, 0xD9, 0xFC, 0x3F, 0xD0, 0xFC, 0x3A,
+    0xF9, 0x19, 0xA9, 0x59, 0xA9, 0x10, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x09, 0x99, 0x99, 0x1A,
+    0xFD, 0xAF, 0xEA, 0xFE, 0x90, 0x99, 0x99, 0x99, 0x00, 0x77, 0x77, 0xCA, 0x76, 0xAE, 0x75, 0xEA,
+    0x74, 0xAE, 0x75, 0xEA, 0x74, 0xAE, 0x75, 0xE9, 0x74, 0xAE, 0x75, 0xE9, 0x74, 0xAD, 0xA7, 0x5E,
+    0x75, 0xAD, 0xA7, 0x49, 0xE7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0x97, 0x4A, 0xE7, 0x5E, 0x97, 0x4F,
+    0x74, 0x9E, 0x97, 0x4E, 0xA7, 0x4A, 0xE7, 0x5E, 0xA7, 0x4A, 0xE7, 0x5E, 0xA7, 0x6A, 0xC7, 0x77,
+    0x70, 0x77, 0x74, 0xAF, 0xA9, 0x7A, 0xFA, 0x5A, 0xFF, 0x5F, 0xFA, 0x3F, 0xFD, 0x4F, 0xFD, 0x2A,
+    0xFF, 0xD3, 0xFF, 0xDA, 0x2C, 0xA9, 0x99, 0xAF, 0xA2, 0x9C, 0xA9, 0x99, 0xAF, 0x71, 0xF7, 0x19,
+    0xEA, 0x71, 0xE9, 0x71, 0x9E, 0x71, 0xE9, 0x72, 0xE7, 0x1E, 0xA7, 0x2E, 0x96, 0x9A, 0xE9, 0x70,
+    0x9F, 0x49, 0xAF, 0xD6, 0x9F, 0xE2, 0xAF, 0xFA, 0x4F, 0xFC, 0x92, 0xFF, 0xA4, 0x9F, 0xF9, 0x3F,
+    0xDA, 0x7F, 0xDA, 0x5F, 0x97, 0x1F, 0x97, 0xAD, 0xA7, 0x2E, 0x97, 0x09, 0xDA, 0x72, 0xAD, 0x97,
+    0x1A, 0x97, 0x49, 0x77, 0x77, 0x70, 0x99, 0x74, 0x99, 0x70, 0x9F, 0x97, 0x0A, 0xF7, 0xFC, 0xA7,
+    0x0F, 0xC9, 0x6F, 0xCA, 0x70, 0xFC, 0x96, 0xAF, 0x97, 0x0F, 0xC7, 0x09, 0xA9, 0x73, 0x9A, 0x96,
+    0x77, 0x09, 0xAA, 0xA9, 0x1A, 0xFA, 0x97, 0x0F, 0xA0, 0xAF, 0xF6, 0xAF, 0x90, 0xFF, 0xD5, 0xFC,
+    0x90, 0xAF, 0xFD, 0x4F, 0xC2, 0xCA, 0x99, 0x9A, 0xFA, 0x3F, 0xC7, 0x1F, 0x3F, 0xC7, 0x2E, 0x92,
+    0xFC, 0x72, 0xE9, 0x2F, 0xC7, 0x2E, 0xA2, 0xAE, 0xA7, 0x09, 0xAE, 0x92, 0xAE, 0xA5, 0x9A, 0xFD,
+    0x3A, 0xEA, 0x3A, 0xFF, 0xA3, 0x9E, 0xA3, 0xFF, 0xA4, 0x9E, 0xA3, 0xFD, 0xA7, 0xEA, 0x3F, 0x97,
+    0x1E, 0xA3, 0xAD, 0xA7, 0x2E, 0xA3, 0x9D, 0xA7, 0x2E, 0xA4, 0xA9, 0x73, 0x99, 0x77, 0x76, 0x99,
+    0x73, 0x99, 0x93, 0x9F, 0x97, 0x0F, 0xA2, 0xFC, 0xA7, 0x9F, 0xC2, 0xFC, 0xA7, 0xAF, 0xC2, 0xAF,
+    0x97, 0x0F, 0xA3, 0x9A, 0x97, 0x39, 0xA9, 0x10, 0x1A, 0xAA, 0x97, 0x70, 0xFA, 0x39, 0xFC, 0x94,
+    0x9F, 0xA2, 0x9F, 0xF9, 0x2A, 0xF9, 0x2A, 0xFF, 0xC9, 0x1A, 0xF3, 0x9F, 0xFD, 0x1A, 0xF4, 0xDA,
+    0x99, 0x9F, 0xC0, 0xAF, 0x73, 0xAE, 0x0A, 0xF7, 0x4E, 0xAA, 0xF7, 0x4A, 0xDA, 0xAF, 0x74, 0xAE,
+    0xAF, 0x73, 0xAE, 0xA9, 0xF7, 0x9A, 0xFD, 0x99, 0xF5, 0x9F, 0xFC, 0x1E, 0xA5, 0xAF, 0xF2, 0xEA,
+    0x5A, 0xFC, 0xA9, 0x3E, 0xA5, 0xAE, 0xA6, 0xF5, 0x9E, 0x7A, 0xE6, 0xE7, 0x99, 0x70, 0x99, 0x77,
+    0x77, 0x99, 0x97, 0x99, 0x7F, 0xC5, 0xFA, 0x49, 0xFC, 0x4A, 0xFC, 0x49, 0xFC, 0x4A, 0xFC, 0x5F,
+    0xC4, 0x9F, 0x96, 0x9A, 0x96, 0x9A, 0x99, 0x50, 0x77, 0x69, 0xFC, 0xA9, 0x5D, 0x2A, 0xFF, 0xC9,
+    0x2F, 0x09, 0xFF, 0xFF, 0xC9, 0x0E, 0xA2, 0x9F, 0xFC, 0xA2, 0xCA, 0x6A, 0xFC, 0x97, 0x75, 0x39,
+    0xA9, 0x4A, 0x94, 0xC9, 0x4A, 0xA5, 0xEA, 0x2A, 0xE2, 0x9E, 0x29, 0xE9, 0x29, 0xF2, 0xF9, 0x1F,
+    0xA1, 0xFA, 0x2F, 0xC1, 0xAF, 0x19, 0xF9, 0x1F, 0xA2, 0xFA, 0x1F, 0xA1, 0xFC, 0x1A, 0xF2, 0xAF,
+    0x1A, 0xF1, 0x9F, 0x91, 0xFA, 0x2F, 0x91, 0xFA, 0x1F, 0xA1, 0xAF, 0x2A, 0xEA, 0x19, 0xF2, 0xF2,
+    0xF3, 0xF2, 0xF2, 0xAE, 0x91, 0x9E, 0xA3, 0xE3, 0xAD, 0x92, 0x9D, 0xA3, 0xDA, 0x59, 0x94, 0x99,
+    0x49, 0xA5, 0xA4, 0x77, 0x29, 0xFC, 0xA6, 0xFF, 0xC9, 0x3F, 0xFE, 0x29, 0xF2, 0xF9, 0x1F, 0x92,
+    0x9E, 0xA1, 0xF4, 0xF1, 0xF4, 0xF0, 0x9F, 0x4F, 0x09, 0xF4, 0xF1, 0xF4, 0xF1, 0xF3, 0xAE, 0xA1,
+    0xAE, 0xA2, 0xF2, 0x9F, 0xFD, 0xA3, 0x9F, 0xFA, 0x59, 0xFD, 0x97, 0x72, 0x77, 0x5A, 0xD9, 0x70,
+    0xF9, 0x7A, 0xF9, 0x69, 0xFC, 0x96, 0xFD, 0x95, 0xE0, 0xE9, 0x4A, 0xD9, 0x0E, 0x93, 0xAD, 0xA1,
+    0xE9, 0x29, 0xE2, 0xE9, 0x2E, 0xAA, 0xAA, 0xFA, 0xA0, 0xFF, 0xFC, 0x09, 0xFF, 0xF7, 0xE9, 0x71,
+    0xE9, 0x71, 0xE9, 0x77, 0x1F, 0xF9, 0x1F, 0xF9, 0x09, 0xFF, 0x19, 0xE6, 0xAD, 0xA6, 0xAF, 0xA9,
+    0x3A, 0xFE, 0x29, 0xAA, 0xFD, 0x6F, 0x95, 0x9E, 0xA5, 0x9E, 0xA4, 0x9F, 0x0A, 0xAA, 0xAF, 0xCA,
+    0x0F, 0xFA, 0x19, 0xFC, 0xA9, 0x75, 0x77, 0x29, 0xF9, 0x49, 0xFE, 0x39, 0xFC, 0xA9, 0x39, 0xFA,
+    0x6F, 0x96, 0xAF, 0xAA, 0xA9, 0x3F, 0xFD, 0x2F, 0xAA, 0xFC, 0x09, 0xE9, 0x2F, 0x09, 0xE9, 0x29,
+    0xE9, 0x0E, 0xA2, 0x9E, 0x90, 0xF2, 0xAE, 0x1A, 0xFA, 0xAF, 0x2F, 0xFC, 0x4A, 0xFC, 0xA7, 0x70,
+    0x9F, 0xFA, 0xA0, 0xAF, 0xFD, 0x9F, 0xFE, 0x9E, 0x92, 0xEA, 0x0E, 0x29, 0xE2, 0xA9, 0x2E, 0x96,
+    0xEA, 0x69, 0xE7, 0xEA, 0x6A, 0xE7, 0xF6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0x9E, 0x77, 0x10, 0x77,
+    0x9F, 0xCA, 0x4A, 0xFF, 0x29, 0xE9, 0x09, 0xEA, 0x1A, 0xE2, 0xAE, 0x1A, 0xE2, 0xEA, 0x19, 0xF0,
+    0xAE, 0x39, 0xFE, 0x5F, 0xE3, 0x9F, 0xFC, 0x91, 0xEA, 0x19, 0xF0, 0x9E, 0x3A, 0xE0, 0x9E, 0x3A,
+    0xE1, 0xF9, 0x09, 0xEA, 0x1A, 0xFF, 0xC3, 0x9F, 0xD9, 0x77, 0x77, 0xAF, 0xC9, 0x4F, 0xFA, 0x2F,
+    0xCA, 0xF9, 0x1F, 0x2F, 0x09, 0xE9, 0x2F, 0x09, 0xE9, 0x2A, 0xE1, 0xF2, 0xAE, 0x1A, 0xFA, 0xAF,
+    0x2F, 0xFD, 0x39, 0xAA, 0xFC, 0xA6, 0x9F, 0x6A, 0xF9, 0x39, 0xAF, 0xCA, 0x3F, 0xEA, 0x49, 0xFA,
+    0x77, 0x20, 0x09, 0xAD, 0x09, 0xEA, 0x3A, 0xFF, 0xE3, 0xAF, 0xCA, 0xAE, 0x93, 0xAE, 0x2E, 0xA3,
+    0xAD, 0xA2, 0xAD, 0xA3, 0xAD, 0xA2, 0xAD, 0xA3, 0xAD, 0xA2, 0xAD, 0xA3, 0xAD, 0xA2, 0xAD, 0xA3,
+    0xAD, 0xA2, 0xAD, 0xA2, 0xFC, 0xA0, 0xAF, 0xC0, 0x9F, 0xCA, 0x0F, 0xD0, 0x59, 0xAA, 0x97, 0x0F,
+    0xEA, 0x49, 0xFF, 0xCA, 0x3F, 0xA9, 0xAF, 0x2A, 0xEA, 0x2A, 0xEA, 0x1F, 0x4F, 0x1F, 0x4F, 0x1F,
+    0x4F, 0x09, 0xF4, 0xF1, 0xF4, 0xF1, 0xF3, 0x9E, 0xA1, 0xF3, 0xAE, 0x91, 0xAF, 0x1A, 0xF3, 0xFF,
+    0xD5, 0xFF, 0x79, 0xAA, 0xAA, 0x94, 0x59, 0x69, 0xAE, 0x29, 0xAF, 0xD2, 0xAF, 0xDA, 0x3A, 0xAA,
+    0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA5, 0x9F, 0x92, 0xFF, 0xC9,
+    0x9F, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x90, 0x39, 0x9A, 0x99, 0x59, 0xFE, 0x92, 0x9F, 0xFC,
+    0x91, 0xF9, 0x9F, 0xA1, 0xEA, 0x2F, 0x1A, 0xD9, 0x19, 0xF7, 0xAE, 0x96, 0x9F, 0x69, 0xF6, 0x9F,
+    0x6A, 0xEA, 0x6A, 0xEA, 0x6F, 0xFE, 0x90, 0xFF, 0xE9, 0x0F, 0xFE, 0x29, 0x99, 0x99, 0x99, 0x99,
+    0x10, 0x39, 0x9A, 0x99, 0x4A, 0xFE, 0x91, 0xAF, 0xFC, 0x1E, 0x91, 0xAE, 0x90, 0xAC, 0x92, 0x9E,
+    0x96, 0xF5, 0x9F, 0x4F, 0xDA, 0x4A, 0xFE, 0x7A, 0xEA, 0x7F, 0x6A, 0xEA, 0x49, 0xFC, 0x1F, 0xFC,
+    0x91, 0xFF, 0x93, 0xAA, 0xCA, 0xA9, 0x30, 0x71, 0x97, 0x19, 0xE9, 0x70, 0xF9, 0x7F, 0xC9, 0x6A,
+    0xFC, 0x95, 0xAD, 0xAE, 0x94, 0x9E, 0x0E, 0x94, 0xE1, 0xE9, 0x3E, 0x91, 0xE9, 0x2A, 0xDA, 0x2E,
+    0x92, 0xFF, 0xFC, 0x0F, 0xFF, 0xC1, 0xAA, 0xAA, 0xAA, 0xFA, 0xA7, 0xE9, 0x71, 0xE9, 0x71, 0xAD,
+    0x91, 0x74, 0xFF, 0x90, 0x9F, 0xF9, 0x09, 0xFF, 0x19, 0xE6, 0xAE, 0x95, 0xAF, 0xD9, 0x2F, 0xFA,
+    0x39, 0x9F, 0xC6, 0xAE, 0xA5, 0x9E, 0xA5, 0xAE, 0x93, 0x9A, 0xF0, 0xFF, 0xC9, 0x0A, 0xFE, 0x92,
+    0xAD, 0xAA, 0x93, 0x79, 0xA9, 0x69, 0xFC, 0xA4, 0xAF, 0xE3, 0xFC, 0xA5, 0xAF, 0x69, 0xF7, 0xFF,
+    0xC9, 0x2F, 0xFD, 0x91, 0xEA, 0x1A, 0xF0, 0x9E, 0x92, 0xAE, 0x99, 0xEA, 0x29, 0xE9, 0x0F, 0x29,
+    0xE9, 0x0F, 0x91, 0xF1, 0x9F, 0xFC, 0xA2, 0x9F, 0xEA, 0x5A, 0xAC, 0xAA, 0x30, 0x73, 0xAF, 0xFD,
+    0x0F, 0xFE, 0x9F, 0xFE, 0x0E, 0x3E, 0x90, 0xAC, 0xA2, 0xEA, 0x69, 0xE7, 0xE9, 0x6A, 0xE7, 0xE9,
+    0x6F, 0x7E, 0xA6, 0xAE, 0x96, 0xAE, 0x7A, 0xE7, 0x0A, 0xCA, 0x50, 0x49, 0xAA, 0x96, 0xFE, 0x93,
+    0xFA, 0xF9, 0x1A, 0xE2, 0xEA, 0x1A, 0xE2, 0xAD, 0xA1, 0xAE, 0x91, 0xE9, 0x2F, 0xAE, 0xA4, 0xFD,
+    0xA4, 0x9F, 0xEA, 0x2A, 0xE9, 0x9F, 0xA1, 0xE9, 0x2F, 0x09, 0xE3, 0xAE, 0x09, 0xE9, 0x2A, 0xE1,
+    0xFA, 0xAF, 0x91, 0x9F, 0xF9, 0x49, 0xAD, 0xA9, 0x30, 0x39, 0xAA, 0x96, 0x9F, 0xDA, 0x39, 0xFF,
+    0xC2, 0xF9, 0x9A, 0xEA, 0x1E, 0xA2, 0xF0, 0x9E, 0x92, 0xAE, 0x09, 0xEA, 0x2A, 0xE1, 0xF9, 0x1A,
+    0xE1, 0x9F, 0xFD, 0x29, 0xFF, 0xC5, 0x99, 0xF9, 0x6A, 0xF5, 0x9F, 0xC3, 0xAA, 0xFD, 0x93, 0xFD,
+    0xA6, 0xAC, 0xAA, 0x60, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFF,
+    0xC0, 0x9F, 0xFF, 0xFC, 0x29, 0xAF, 0xCA, 0xAF, 0xE3, 0x9F, 0xA5, 0xE9, 0x29, 0xFA, 0x5E, 0x39,
+    0xFA, 0x5E, 0x39, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFC, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA4,
+    0x9F, 0xFF, 0x94, 0x9F, 0xFF, 0x59, 0xFA, 0x74, 0x9F, 0xA7, 0x2A, 0xAF, 0xDA, 0xAA, 0x96, 0xFF,
+    0xE9, 0x6A, 0xAA, 0xFC, 0xAA, 0xA9, 0x70, 0x9F, 0xA7, 0x49, 0xFA, 0x73, 0xAF, 0xFA, 0x7F, 0xFE,
+    0x95, 0x9F, 0xFE, 0x95, 0x72, 0xAE, 0xA9, 0x73, 0xAF, 0xF9, 0x70, 0xFF, 0xE7, 0x9F, 0x90, 0x9F,
+    0xA6, 0xFA, 0x2A, 0xEA, 0x59, 0xF3, 0x9E, 0x95, 0xAF, 0x4D, 0xA6, 0xFA, 0x76, 0xF9, 0x73, 0xAA,
+    0xAF, 0xAA, 0xAA, 0xD9, 0x5F, 0xFF, 0xC9, 0x5A, 0xAF, 0xDA, 0xAA, 0xAA, 0x70, 0xAF, 0x73, 0x9A,
+    0x9F, 0xCA, 0xAA, 0xAA, 0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x71, 0xF9, 0x75, 0x9F, 0x76, 0xAE,
+    0xA7, 0x39, 0x99, 0xFA, 0x99, 0x99, 0x99, 0xAA, 0xD1, 0xFF, 0xFF, 0xD1, 0xAF, 0xFF, 0xFC, 0x19,
+    0xFA, 0xAF, 0xFD, 0xA2, 0x9A, 0xA6, 0x99, 0x99, 0x92, 0x29, 0x9A, 0xAA, 0xFA, 0xA9, 0x77, 0x75,
+    0xFF, 0xFE, 0x97, 0x77, 0x3F, 0xFF, 0xF9, 0x77, 0x73, 0x9A, 0xFC, 0x99, 0x9F, 0xD7, 0x77, 0x5F,
+    0xC3, 0xAF, 0xA7, 0x77, 0x4F, 0xC4, 0xFC, 0x49, 0xAA, 0x77, 0x4F, 0xC4, 0xFC, 0x3A, 0xE7, 0x74,
+    0xFC, 0x4F, 0xC3, 0xF7, 0x74, 0xFC, 0x4F, 0xA2, 0x9F, 0x71, 0x99, 0x97, 0xFC, 0x3A, 0xF9, 0x09,
+    0xAF, 0xFC, 0x92, 0xAF, 0xDA, 0x4F, 0xC2, 0xAF, 0xC0, 0x9F, 0xFE, 0x91, 0xFF, 0xCA, 0x3F, 0xFF,
+    0xC2, 0xFF, 0xE1, 0xAE, 0x91, 0xAD, 0x93, 0xFF, 0xF5, 0xAF, 0x5F, 0x29, 0xD4, 0xFF, 0xCA, 0x96,
+    0xAF, 0x5F, 0xA2, 0x99, 0x4F, 0xC7, 0x4A, 0xF5, 0xAF, 0xCA, 0x96, 0xFC, 0x74, 0xAF, 0x6F, 0xF5,
+    0xFC, 0x74, 0xAF, 0x7A, 0xFE, 0x4F, 0xC7, 0x4A, 0xF7, 0x1A, 0xFC, 0xA3, 0xFC, 0x74, 0xAF, 0x59,
+    0xCA, 0x2A, 0xEA, 0x3F, 0xC7, 0x4A, 0xF9, 0x4E, 0x3E, 0xA1, 0xAF, 0xFC, 0x71, 0x9F, 0xFC, 0x0E,
+    0x2A, 0xE9, 0x0F, 0xFE, 0xA7, 0x1F, 0xFA, 0x0F, 0xFD, 0x1F, 0xFE, 0x97, 0x19, 0xFD, 0xA1, 0xAF,
+    0xEA, 0x77, 0x73, 0x99, 0x96, 0x99, 0x99, 0x30, 0x72, 0x9A, 0xEA, 0xA7, 0x3A, 0xFF, 0xD7, 0x9F,
+    0xFF, 0x69, 0xFC, 0xA9, 0x99, 0xF6, 0xFC, 0x4A, 0xE5, 0xFC, 0x5A, 0xDA, 0x49, 0xF6, 0xAD, 0x5F,
+    0xA7, 0x69, 0xFA, 0x09, 0x99, 0x99, 0x6F, 0xFF, 0xCA, 0x6F, 0xFF, 0xC9, 0x70, 0xFC, 0x77, 0xFC,
+    0x49, 0x69, 0xFF, 0xFC, 0x6A, 0xFF, 0xF9, 0x79, 0x9F, 0xC9, 0x99, 0x99, 0x72, 0xAF, 0xA7, 0x7F,
+    0xC7, 0x7F, 0xD7, 0x69, 0xFD, 0xA9, 0x29, 0xAD, 0x59, 0xFF, 0xFD, 0x69, 0xFF, 0xF9, 0x70, 0xAF,
+    0xFC, 0x97, 0x49, 0x99, 0x99, 0x40, 0x59, 0x77, 0x29, 0xD7, 0x70, 0x9F, 0x76, 0x9F, 0x97, 0x59,
+    0xEA, 0x76, 0x9E, 0xA7, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xEA, 0x9F, 0xFF,
+    0xFE, 0xA0, 0x9E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9E, 0xA7, 0x70, 0x9F, 0x77,
+    0x0A, 0xF7, 0x70, 0xAD, 0x77, 0x2A, 0x75, 0x5A, 0xC9, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xAF,
+    0xEA, 0x4A, 0xFF, 0xCA, 0x2A, 0xE9, 0xE9, 0xEA, 0x0A, 0xE9, 0x0E, 0x09, 0xEA, 0x0D, 0xA1, 0xE1,
+    0xAD, 0x2A, 0x19, 0xE2, 0xA6, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97,
+    0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19,
+    0xE9, 0x40, 0x75, 0x97, 0x72, 0xD9, 0x77, 0x0F, 0x97, 0x79, 0xF9, 0x77, 0x0A, 0xE9, 0x29, 0x99,
+    0x99, 0x97, 0xAE, 0x90, 0xAF, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xEA, 0xAF, 0xFF, 0xFE, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x97, 0x6A, 0xE9, 0x76, 0xF9, 0x76, 0xF9, 0x77, 0x0D,
+    0xA7, 0x72, 0xA5, 0x49, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71,
+    0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE7, 0x29, 0xE7,
+    0xA1, 0x9E, 0x2A, 0x2A, 0xCA, 0x1E, 0x1A, 0xCA, 0x0A, 0xE9, 0x0E, 0x09, 0xEA, 0x0F, 0x9E, 0x9F,
+    0x2F, 0xFE, 0x4F, 0xFC, 0x6F, 0xDA, 0x70, 0xAE, 0xA7, 0x2A, 0xCA, 0x50, 0x77, 0x71, 0xAC, 0x6C,
+    0xA7, 0x0A, 0xE4, 0xEA, 0x6A, 0xF4, 0xFA, 0x4A, 0xEA, 0x6A, 0xEA, 0x2A, 0xE9, 0x70, 0x9E, 0x90,
+    0x9F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xEA, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xEA, 0x2A, 0xE9, 0x69, 0xEA, 0x4A, 0xEA, 0x4A, 0xEA, 0x6F, 0x4E, 0xA7, 0x0D, 0x6D, 0x77,
+    0x71, 0x77, 0x4E, 0x72, 0xFC, 0x70, 0xFE, 0x6F, 0xFC, 0x4F, 0xFE, 0x2F, 0x9E, 0x0F, 0x1A, 0xD1,
+    0xE0, 0x9D, 0xA2, 0xA9, 0x1E, 0x1A, 0xA7, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0xA9, 0x1E,
+    0x19, 0xA2, 0xAD, 0x1E, 0x1D, 0xA1, 0xF0, 0xE0, 0xF1, 0x9E, 0xAE, 0xAE, 0x4F, 0xFC, 0x6F, 0xE7,
+    0x0F, 0xC7, 0x2E, 0x74, 0x96, 0x59, 0xA9, 0x72, 0x9E, 0x97, 0x0A, 0xFC, 0xA6, 0xAF, 0xEA, 0x4A,
+    0xFF, 0xCA, 0x2F, 0x9E, 0x9F, 0x1E, 0x90, 0xE0, 0x9E, 0x2C, 0xA1, 0xE1, 0xAC, 0x7E, 0x73, 0xE7,
+    0x3E, 0x79, 0x2E, 0x29, 0x29, 0xD1, 0xE1, 0xD9, 0x1F, 0x0E, 0x0F, 0x19, 0xFF, 0xE9, 0x29, 0xFF,
+    0xC9, 0x49, 0xFE, 0x97, 0xFC, 0x72, 0xE5, 0xFF, 0xFD, 0xAF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFC,
+    0xA0, 0x72, 0xAA, 0xA9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E,
+    0x97, 0x19, 0xE9, 0x72, 0xE9, 0x5A, 0x3E, 0x94, 0xAD, 0x2E, 0x93, 0xAF, 0x1E, 0x92, 0xAF, 0x2E,
+    0x91, 0x9E, 0xA3, 0xE9, 0x09, 0xEA, 0x99, 0x99, 0x9E, 0x99, 0xFF, 0xFC, 0x9A, 0xFF, 0xFC, 0x90,
+    0xFF, 0xFC, 0x19, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xF9, 0x71, 0x9F, 0x72, 0x9D, 0x74, 0x97, 0x9A,
+    0xAA, 0x72, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0x9E, 0x72,
+    0x9E, 0x72, 0x9E, 0x29, 0xA5, 0x9E, 0x19, 0xDA, 0x49, 0xE1, 0xFA, 0x39, 0xE2, 0xF9, 0x29, 0xE3,
+    0xAE, 0x91, 0x9E, 0x99, 0x99, 0x9A, 0xE9, 0x09, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0xA9, 0xFF, 0xFC,
+    0x71, 0xAE, 0x71, 0xF9, 0x79, 0xF9, 0x70, 0xF9, 0x72, 0xD9, 0x74, 0x95, 0x75, 0x9E, 0xA7, 0x59,
+    0xEA, 0x76, 0xE9, 0x49, 0xCA, 0x6E, 0x94, 0xEA, 0x5E, 0x93, 0xF9, 0x5E, 0x92, 0xF7, 0xE9, 0x1E,
+    0xA7, 0x0E, 0x90, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x0A, 0xEA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xE9, 0x76, 0xAE, 0xA7, 0x6A, 0xF7, 0x6E, 0x97, 0x7C, 0x97,
+    0x77, 0x50, 0x77, 0x73, 0xAC, 0x77, 0x1A, 0xE7, 0x7A, 0xE9, 0x76, 0xAE, 0x97, 0x69, 0xE9, 0x29,
+    0x99, 0x99, 0x9A, 0xAA, 0x91, 0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD, 0xA9, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0x97, 0x70, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x1A, 0xFF, 0xFF, 0xDA, 0x1A, 0xFF, 0xFF, 0xCA, 0x2A, 0xEA, 0x99, 0x99, 0xAA, 0xAA,
+    0xAA, 0xAC, 0xA3, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1D, 0x77, 0x77, 0x00, 0x79, 0xA9,
+    0x76, 0x9E, 0x97, 0x49, 0xFC, 0x97, 0x29, 0xE9, 0xE9, 0x70, 0xAE, 0x90, 0x9E, 0xA6, 0xAF, 0x90,
+    0x9F, 0xA4, 0xAF, 0xC9, 0x09, 0xFC, 0xA2, 0xAE, 0xAD, 0x90, 0x9D, 0xAE, 0xA1, 0xE9, 0x9D, 0x90,
+    0x9D, 0x99, 0xE2, 0xC9, 0x09, 0xD9, 0x09, 0xD9, 0x09, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9,
+    0x09, 0xD9, 0x71, 0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x71, 0xAD, 0x90, 0x9D, 0x97,
+    0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90,
+    0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA4, 0x77, 0x77, 0x0C, 0xA7, 0x71,
+    0xEA, 0x77, 0x09, 0xEA, 0x77, 0x09, 0xEA, 0x39, 0xAA, 0xA9, 0x99, 0x99, 0x92, 0x9E, 0x92, 0xAF,
+    0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0xFD, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E,
+    0x97, 0x70, 0x9D, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0xAF, 0xFF, 0xFD,
+    0xA0, 0xAF, 0xFF, 0xFC, 0xA1, 0xAC, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0xEA, 0x77, 0xEA, 0x77,
+    0xEA, 0x77, 0xEA, 0x77, 0x1D, 0x77, 0x73, 0x49, 0xAA, 0x2A, 0xA9, 0x71, 0xAD, 0x90, 0x9D, 0xA7,
+    0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90,
+    0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xD9, 0x71, 0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x71,
+    0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x6C, 0x19, 0xD9, 0x09, 0xD9, 0x09, 0xC2, 0xE0,
+    0x9D, 0x90, 0x9D, 0x90, 0xE1, 0xF9, 0xD9, 0x09, 0xD9, 0xF2, 0xAF, 0xC9, 0x09, 0xFC, 0xA4, 0xAF,
+    0x90, 0x9F, 0xA6, 0xAE, 0x90, 0x9E, 0xA7, 0x0A, 0xE9, 0xEA, 0x72, 0xAF, 0xCA, 0x74, 0xAE, 0xA7,
+    0x69, 0xC9, 0x70, 0x77, 0x72, 0xAC, 0x4C, 0xA7, 0x2A, 0xE2, 0xEA, 0x70, 0xAE, 0x92, 0x9E, 0xA6,
+    0xAE, 0x94, 0x9E, 0xA4, 0xAF, 0xFF, 0xEA, 0x2A, 0xFF, 0xFF, 0xC9, 0x09, 0xE9, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0xE9, 0x74, 0x9E, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA0,
+    0xAF, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xEA, 0x4A, 0xE9, 0x49, 0xEA, 0x6F, 0x4E, 0xA7, 0x0F, 0x2F,
+    0x72, 0xD9, 0x29, 0xD7, 0x49, 0x49, 0x60, 0xAF, 0xC7, 0x3F, 0x90, 0xFC, 0xA7, 0x2F, 0x1F, 0xD7,
+    0x1A, 0xEA, 0x1A, 0xFC, 0x71, 0xF9, 0x2F, 0xC9, 0x79, 0xF3, 0xFD, 0x7A, 0xE9, 0x39, 0xFC, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xF5, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xE6, 0x9F, 0xFF, 0xE7, 0xFC, 0x93, 0xAE,
+    0x97, 0xAF, 0xC3, 0xF7, 0x1F, 0xC3, 0xEA, 0x71, 0xFC, 0x91, 0xAE, 0x72, 0x9F, 0xC1, 0xEA, 0x73,
+    0xFC, 0x09, 0xE7, 0x4A, 0xF9, 0xAE, 0x74, 0x9F, 0xF9, 0x75, 0xFF, 0x76, 0xAF, 0xDA, 0x77, 0xFD,
+    0x77, 0x0F, 0xCA, 0x77, 0x09, 0xF7, 0x72, 0xA9, 0x73, 0x69, 0xAD, 0xA9, 0x71, 0x9F, 0xF9, 0x6A,
+    0xFF, 0xD9, 0x5E, 0x99, 0x9A, 0xFC, 0x5A, 0x94, 0xAF, 0xA7, 0x4F, 0xC7, 0x4A, 0xF7, 0x49, 0xF7,
+    0x49, 0xF9, 0x6A, 0xFA, 0xF9, 0x49, 0xFF, 0xE9, 0x3A, 0xFF, 0xF9, 0x2A, 0xF9, 0x2F, 0xC3, 0xF9,
+    0x39, 0xF2, 0xAE, 0xA4, 0x9F, 0x2F, 0x5A, 0xF1, 0x9F, 0x5F, 0xA1, 0xAE, 0xA5, 0xF2, 0xFA, 0x49,
+    0xF2, 0xFA, 0x4F, 0xA2, 0xFA, 0x4F, 0x3F, 0xC3, 0xF9, 0x3A, 0xF9, 0x1F, 0xA4, 0x9F, 0xFE, 0x6A,
+    0xFF, 0xA7, 0x09, 0xFD, 0x97, 0x49, 0x97, 0x10, 0x0F, 0xFF, 0xDA, 0x1F, 0xFF, 0xE9, 0x0F, 0xFF,
+    0xE9, 0x0F, 0xCA, 0xAA, 0xAA, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC,
+    0x97, 0x2F, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x2F, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9,
+    0x0A, 0xFF, 0xFD, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9,
+    0x72, 0xFC, 0x99, 0xCA, 0xAA, 0xAA, 0xAA, 0x99, 0xFC, 0x99, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x99,
+    0xFF, 0xFE, 0x00, 0x77, 0x77, 0x29, 0x9A, 0xA9, 0x95, 0xAA, 0x79, 0xAF, 0xFC, 0x91, 0xAD, 0xA5,
+    0xFF, 0xFC, 0xAA, 0xE5, 0xFF, 0xFF, 0xD5, 0xFD, 0xA3, 0xAF, 0xD5, 0xFC, 0xA7, 0xFC, 0x93, 0x9F,
+    0xA7, 0x9F, 0xD3, 0xFC, 0x79, 0xFE, 0x91, 0x9F, 0x96, 0x9E, 0x0F, 0xA1, 0xAF, 0x69, 0xE1, 0xAF,
+    0x1F, 0xC5, 0x9E, 0x91, 0xAF, 0x1F, 0xA5, 0xE9, 0x2A, 0xF1, 0xFA, 0x4E, 0x93, 0xAF, 0x1F, 0xA3,
+    0xE9, 0x4A, 0xF1, 0xFA, 0x2E, 0x95, 0xFC, 0x1F, 0xA1, 0xE9, 0x6F, 0xA1, 0xAF, 0x0E, 0xA6, 0x9F,
+    0x91, 0x9F, 0xEA, 0x7F, 0xC3, 0xFD, 0xA7, 0xAF, 0x93, 0x9F, 0xC7, 0xAF, 0xC5, 0xFD, 0x93, 0x9F,
+    0xD5, 0xAF, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFC, 0x5A, 0xE1, 0x9F, 0xFD, 0x97, 0xD5, 0x9A, 0xAA,
+    0x99, 0x77, 0x77, 0x20, 0x73, 0x99, 0x77, 0x09, 0xF7, 0x70, 0xFC, 0xA7, 0x6A, 0xFD, 0x76, 0xFE,
+    0x97, 0x49, 0xFE, 0xA7, 0x4E, 0xAF, 0xC7, 0x39, 0xE0, 0xFC, 0x97, 0x2A, 0xE0, 0x9F, 0xC7, 0x2E,
+    0x91, 0xFC, 0x71, 0xAE, 0x2F, 0xCA, 0x70, 0xEA, 0x29, 0xFC, 0x79, 0xE9, 0x3F, 0xC9, 0x6F, 0x4F,
+    0xCA, 0x6E, 0xA4, 0x9F, 0xC5, 0xAE, 0x6F, 0xC9, 0x4F, 0x6F, 0xCA, 0x39, 0xEA, 0x69, 0xFC, 0x3F,
+    0x70, 0xFC, 0x91, 0x9F, 0x70, 0xFD, 0x1F, 0x97, 0x09, 0xFC, 0x1F, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF,
+    0xFA, 0x9F, 0xFF, 0xFF, 0xA0, 0x0F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA9, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0xF9, 0x0F, 0xCA, 0x79, 0xF1, 0xAF, 0xC7, 0xAE, 0x91, 0x9F, 0xC7,
+    0xF3, 0xFC, 0xA5, 0x9E, 0xA3, 0xAF, 0xC5, 0xF4, 0x9F, 0xC5, 0xF5, 0xFC, 0xA3, 0xAE, 0x95, 0xAF,
+    0xC3, 0xF7, 0xFC, 0x3E, 0xA7, 0xFC, 0xA1, 0xAE, 0x70, 0x9F, 0xC1, 0xEA, 0x71, 0xFC, 0x09, 0xE9,
+    0x71, 0xAF, 0xAA, 0xE7, 0x29, 0xFF, 0x97, 0x3F, 0xF7, 0x4A, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xCA,
+    0x76, 0x9F, 0x77, 0x0A, 0x97, 0x20, 0x79, 0xAA, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x93, 0x9F, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFF, 0xFD, 0x91, 0x9F, 0xCA, 0x97, 0x6F, 0xC9, 0x77, 0x9F, 0xA7, 0x70, 0xFC,
+    0x77, 0x1F, 0xA7, 0x70, 0x9F, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF,
+    0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xFA, 0x77, 0x1F, 0xC7, 0x71, 0xAF, 0x97, 0x71, 0xFC, 0x97, 0x70, 0x9F,
+    0xCA, 0x77, 0x0A, 0xFF, 0xFF, 0xD9, 0x3A, 0xFF, 0xFF, 0xC9, 0x5A, 0xFF, 0xFE, 0x97, 0x9A, 0xFF,
+    0xF9, 0x77, 0x9A, 0xAA, 0x77, 0x2F, 0x77, 0x2F, 0x72, 0x9A, 0xAF, 0xFE, 0x95, 0xAF, 0xFF, 0xE9,
+    0x39, 0xFF, 0xFF, 0xC9, 0x29, 0xFF, 0xFF, 0xD9, 0x19, 0xFC, 0xA9, 0x3F, 0x6F, 0xC9, 0x49, 0xEA,
+    0x59, 0xFA, 0x5A, 0xE9, 0x5F, 0xC6, 0xF6, 0xFA, 0x59, 0xEA, 0x59, 0xFA, 0x09, 0x99, 0x99, 0xFA,
+    0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F,
+    0xA9, 0x99, 0x9A, 0xF9, 0x99, 0x99, 0x99, 0x1F, 0xA3, 0xAE, 0x97, 0x0F, 0xC3, 0xF7, 0x1A, 0xF9,
+    0x19, 0xEA, 0x72, 0xFC, 0x90, 0xAE, 0x97, 0x29, 0xFC, 0xAF, 0x74, 0xAF, 0xFF, 0xFD, 0x93, 0xAF,
+    0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xF9, 0x6A, 0xFF, 0xFD, 0x96, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0x9E,
+    0x97, 0x30, 0x69, 0xAF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0x92, 0x9F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF,
+    0xFE, 0x91, 0xFD, 0x97, 0x6A, 0xFA, 0x77, 0x0F, 0xC7, 0x71, 0xFA, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFC, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xCA,
+    0x77, 0x09, 0xFF, 0xFF, 0xE9, 0x29, 0xFF, 0xFF, 0xD9, 0x4F, 0xFF, 0xFC, 0x96, 0xAA, 0xFF, 0xFC,
+    0x97, 0x76, 0x9F, 0xFE, 0xAA, 0x97, 0x9F, 0xFF, 0xEA, 0x59, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFF,
+    0xD9, 0x77, 0x9A, 0xFC, 0x97, 0x70, 0x9F, 0xC7, 0x71, 0xAF, 0x97, 0x71, 0xFC, 0x77, 0x1A, 0xF1,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF,
+    0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x97,
+    0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xA7, 0x79, 0xFC, 0x77, 0xAF, 0xC9, 0x19, 0xFF, 0xFF,
+    0xDA, 0x29, 0xFF, 0xFF, 0xCA, 0x39, 0xFF, 0xFE, 0xA5, 0x9F, 0xFF, 0xA9, 0x70, 0x19, 0xAA, 0xA9,
+    0x77, 0x2F, 0x77, 0x2F, 0x77, 0x9F, 0xFE, 0xAA, 0x97, 0x9F, 0xFF, 0xEA, 0x59, 0xFF, 0xFF, 0xC9,
+    0x39, 0xFF, 0xFF, 0xD9, 0x7F, 0x39, 0xAF, 0xC9, 0x6A, 0xE9, 0x49, 0xFC, 0x69, 0xEA, 0x5A, 0xF9,
+    0x6F, 0x6F, 0xC6, 0xAE, 0x95, 0xAF, 0x19, 0x99, 0x99, 0xAF, 0x99, 0x99, 0x90, 0xAF, 0x99, 0xFF,
+    0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x9F, 0xA9,
+    0x99, 0x9A, 0xF9, 0x79, 0xEA, 0x3A, 0xF7, 0x1F, 0x3F, 0xC7, 0x1A, 0xE9, 0x19, 0xFA, 0x71, 0x9E,
+    0xA0, 0x9F, 0xC7, 0x3F, 0xAF, 0xC9, 0x19, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xCA, 0x39, 0xFF,
+    0xFF, 0x94, 0x9F, 0xFF, 0xDA, 0x77, 0x2F, 0x77, 0x2A, 0xE9, 0x77, 0x19, 0xE9, 0x50, 0x9F, 0xFF,
+    0xCA, 0x96, 0x9F, 0xFF, 0xFA, 0x49, 0xFF, 0xFF, 0xD9, 0x29, 0xFF, 0xFF, 0xE9, 0x77, 0x9F, 0xD7,
+    0x71, 0xAF, 0xA7, 0x71, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0x09, 0xFF,
+    0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0xAF, 0xC1, 0x9F, 0xFF, 0xFE,
+    0x91, 0x9F, 0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0xAA, 0x77, 0x75, 0xAF, 0xFF,
+    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFF, 0xE9, 0x3F, 0xCA, 0x99, 0x99, 0x99, 0x99,
+    0xFC, 0xA5, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97,
+    0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97,
+    0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97,
+    0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97,
+    0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97,
+    0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x93, 0x9F, 0xFA, 0x39, 0xFF, 0xA0, 0xAF, 0xFD, 0x91, 0xAF, 0xFD,
+    0x9F, 0xFE, 0x91, 0xFF, 0xE9, 0x77, 0x71, 0x09, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xD1, 0x9F, 0xFF,
+    0xFD, 0x2F, 0xD9, 0x99, 0x99, 0x99, 0x9F, 0x29, 0xFC, 0x96, 0x9E, 0x3A, 0xFC, 0x7E, 0x4F, 0xCA,
+    0x6A, 0xD4, 0x9F, 0xC9, 0x76, 0xAF, 0xC7, 0x7F, 0xCA, 0x76, 0x9F, 0xC9, 0x76, 0xAF, 0xC7, 0x7F,
+    0xCA, 0x76, 0x9F, 0xC7, 0x7F, 0xC7, 0x6F, 0xC7, 0x6A, 0xF9, 0x75, 0x9F, 0xA7, 0x6F, 0xC7, 0x6F,
+    0xC7, 0x6A, 0xF7, 0x0D, 0xA2, 0x9F, 0x97, 0x9E, 0x2F, 0xA7, 0x0F, 0x1F, 0xC7, 0x09, 0xF0, 0xAF,
+    0xFF, 0xFD, 0xA0, 0xFF, 0xFF, 0xE9, 0x0A, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xD7, 0x72, 0x92, 0xFF,
+    0xFD, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x72, 0xF7,
+    0x2A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xEA, 0x72, 0xF7, 0x2A, 0xEA,
+    0x72, 0xF9, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x72, 0xAE, 0xA7, 0x2F,
+    0x97, 0x19, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xA7, 0x2F, 0x72, 0xAE, 0xA7, 0x2F, 0x72, 0xAF,
+    0x72, 0x99, 0x99, 0x73, 0xAE, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xF7, 0x3F, 0x73, 0xAE, 0xA7,
+    0x3F, 0x73, 0xFA, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0xAE, 0xA7, 0x3F, 0x73,
+    0xAE, 0xA7, 0x29, 0xF7, 0x3F, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xEA, 0x73, 0xF7, 0x3A, 0xEA,
+    0x72, 0x9F, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0x99, 0x99, 0x00, 0x59, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0xD2, 0xE1, 0x9C, 0xA1, 0xAE, 0x90, 0xDA, 0x0F, 0x1F, 0xFF, 0xD9, 0x19, 0xFF, 0xDA, 0x59, 0xFD,
+    0xA7, 0xAF, 0xE9, 0x4A, 0xFF, 0xE9, 0x1F, 0xCA, 0xFF, 0x90, 0x9E, 0x1D, 0xA0, 0x9E, 0x2C, 0x91,
+    0x9E, 0x2C, 0x96, 0x9E, 0x73, 0x9E, 0x74, 0x99, 0x95, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x92, 0x9F,
+    0xFC, 0x91, 0xF9, 0x9A, 0xF0, 0x9E, 0x3A, 0xE0, 0xAE, 0x39, 0xE0, 0xAE, 0x4E, 0x0A, 0xE3, 0xAE,
+    0x1F, 0x99, 0xAE, 0xA1, 0xAF, 0xFC, 0x3F, 0xF5, 0x9A, 0xDA, 0x93, 0x09, 0xAA, 0xA1, 0x9F, 0xC0,
+    0xAF, 0xC0, 0xAF, 0xC0, 0x9F, 0xA2, 0x99, 0x91, 0x77, 0x1A, 0xAA, 0x77, 0x1A, 0xE7, 0x71, 0xF7,
+    0x71, 0xE9, 0x77, 0x09, 0xE7, 0x71, 0xF7, 0x71, 0xEA, 0x77, 0x09, 0xE7, 0x71, 0xAE, 0x77, 0x1E,
+    0xA7, 0x71, 0xE9, 0x77, 0x0A, 0xE7, 0x71, 0xEA, 0x39, 0xFD, 0x95, 0xE9, 0x39, 0xFD, 0xA4, 0x9E,
+    0x49, 0xFE, 0x4A, 0xDA, 0x59, 0x9A, 0xF4, 0xE9, 0x70, 0xF9, 0x29, 0xE7, 0x1A, 0xEA, 0x2A, 0xE7,
+    0x19, 0xF2, 0xE9, 0x72, 0xF2, 0xE7, 0x3F, 0x90, 0x9E, 0x73, 0x9E, 0xA0, 0xEA, 0x74, 0xF0, 0xE7,
+    0x5F, 0x9E, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x97, 0x6F, 0xD7, 0x7A, 0xFA, 0x77, 0x9F, 0x97, 0x70,
+    0xAE, 0x71, 0x49, 0x70, 0x93, 0xFC, 0x93, 0x9D, 0x2F, 0xE9, 0x1A, 0xE1, 0xFF, 0xC0, 0xAE, 0xA1,
+    0xEA, 0x1A, 0xFD, 0x29, 0xE3, 0xFC, 0x3A, 0xDA, 0x4E, 0xA3, 0xAE, 0x3A, 0xF9, 0x29, 0xE9, 0x1A,
+    0xFD, 0x92, 0xFF, 0xC0, 0xFA, 0x1A, 0xFE, 0x2F, 0x2A, 0xFA, 0x4E, 0x49, 0x97, 0x9A, 0x00, 0x49,
+    0x70, 0x99, 0x59, 0xFC, 0x4A, 0xF9, 0x29, 0xFE, 0x2F, 0xE9, 0x1F, 0xFC, 0x0F, 0xFC, 0x09, 0xE9,
+    0x1F, 0xDA, 0x1A, 0xE0, 0xAE, 0x3F, 0xA3, 0xE0, 0xAD, 0xA3, 0xAE, 0x4E, 0x0A, 0xDA, 0x3F, 0xC3,
+    0xE0, 0x9E, 0x2F, 0xDA, 0x1A, 0xE1, 0xFF, 0xA9, 0xFF, 0xA1, 0xAF, 0xDA, 0x19, 0xFE, 0x3A, 0xFA,
+    0x39, 0xFC, 0x69, 0x97, 0x09, 0x40, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77,
+    0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E,
+    0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7,
+    0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xFF, 0xFF, 0xE9, 0x9F, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xE9,
+    0x9F, 0xFF, 0xFE, 0x90, 0x77, 0x1A, 0x97, 0x75, 0x9D, 0x97, 0x73, 0x9F, 0xA7, 0x72, 0xFC, 0x77,
+    0x2F, 0xC9, 0x77, 0x1A, 0xFA, 0x77, 0x19, 0xFA, 0x77, 0x19, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC,
+    0x97, 0x71, 0xAF, 0x97, 0x71, 0x9F, 0xA7, 0x71, 0x9F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xC7, 0x72,
+    0xAF, 0x97, 0x71, 0x9F, 0xA7, 0x71, 0x9F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xFF, 0xFF, 0xCA, 0x1A,
+    0xFF, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFF, 0xDA, 0x9F, 0xFF, 0xFF, 0xEA, 0x9A, 0xAA, 0x0F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x99, 0x99,
+    0x90, 0x0A, 0xAA, 0x92, 0xAA, 0xA9, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x09, 0x99, 0x92, 0x99, 0x99, 0x70, 0x9E, 0xA7, 0x71, 0xAF,
+    0x77, 0x1F, 0xC9, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x69, 0xFE, 0xA7, 0x5F, 0xAF, 0x75, 0xF0, 0xF9,
+    0x73, 0xAE, 0xA0, 0x9F, 0x73, 0xF9, 0x1F, 0x97, 0x19, 0xF2, 0xAE, 0xA7, 0x1F, 0xA3, 0xF7, 0x1F,
+    0x4F, 0x97, 0xAF, 0x49, 0xF7, 0xF9, 0x5F, 0x95, 0x9F, 0x6A, 0xEA, 0x5F, 0xA6, 0x9F, 0x5F, 0x70,
+    0xFA, 0x3A, 0xF7, 0x0A, 0xF3, 0xF9, 0x71, 0xF9, 0x19, 0xF7, 0x2A, 0xF1, 0xFA, 0x72, 0x9F, 0x09,
+    0xF9, 0x73, 0xFA, 0x9F, 0x74, 0xFA, 0x0F, 0xA7, 0x29, 0xF1, 0xAF, 0x72, 0xAF, 0x2F, 0x97, 0x1F,
+    0x92, 0xAF, 0x70, 0x9F, 0x39, 0xF7, 0x0F, 0xA4, 0xFA, 0x7F, 0x59, 0xF6, 0xAF, 0x6F, 0x95, 0xF9,
+    0x6A, 0xEA, 0x49, 0xF7, 0x9F, 0x4F, 0xA7, 0x0F, 0xA3, 0xF7, 0x19, 0xF2, 0xAE, 0xA7, 0x2F, 0x91,
+    0xF9, 0x72, 0xAE, 0xA0, 0x9F, 0x74, 0xF0, 0xAE, 0xA7, 0x4F, 0xAF, 0x75, 0x9F, 0xEA, 0x76, 0xFE,
+    0x97, 0x6A, 0xFD, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0x9E, 0xA7, 0x00, 0x69, 0x9A, 0x99,
+    0x72, 0x9F, 0xFC, 0x96, 0xFF, 0xFC, 0x4F, 0xFF, 0xE2, 0xAF, 0xCA, 0x99, 0x9A, 0xFC, 0xA1, 0xFA,
+    0x6A, 0xF0, 0x9F, 0x70, 0xF9, 0x9E, 0xA7, 0x0A, 0xE9, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09,
+    0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0x9E, 0xA7, 0x0A, 0xE9, 0x9F, 0x70, 0xF9,
+    0x0F, 0xA6, 0xAF, 0x1A, 0xFC, 0xA9, 0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xE4, 0xFF, 0xFC, 0x69, 0xFF,
+    0xC9, 0x72, 0x99, 0xA9, 0x96, 0x72, 0xAA, 0xCA, 0xA7, 0x39, 0xFE, 0xA7, 0x0A, 0xFF, 0xC7, 0x0F,
+    0xCA, 0xF7, 0xAF, 0x19, 0xD9, 0x7F, 0xC2, 0x97, 0x1F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49,
+    0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC,
+    0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74,
+    0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFA, 0x70, 0x92,
+    0x9F, 0x97, 0xE1, 0xAF, 0x7A, 0xFA, 0xFA, 0x7A, 0xFF, 0xC7, 0x1F, 0xF7, 0x39, 0xAA, 0xAA, 0x97,
+    0x20, 0x77, 0x77, 0xAE, 0xA7, 0x70, 0x9F, 0xC9, 0x77, 0x9F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0xAE,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xA9, 0x72,
+    0x9A, 0xAA, 0x2A, 0xFA, 0x70, 0x9F, 0xA1, 0xFD, 0x70, 0xFD, 0x1F, 0xD7, 0x0F, 0xD1, 0xAF, 0x97,
+    0x09, 0xFA, 0x29, 0x99, 0x73, 0x99, 0x92, 0x77, 0x70, 0xF9, 0x71, 0xF9, 0x1F, 0xD7, 0x0A, 0xFC,
+    0x1F, 0xD7, 0x0F, 0xD1, 0xFC, 0xA7, 0x0A, 0xFC, 0x2E, 0xA7, 0x2E, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xA9, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9,
+    0x77, 0x9F, 0xC9, 0x77, 0x0F, 0xC7, 0x72, 0x99, 0x97, 0x10, 0x7A, 0xE9, 0x0A, 0xFC, 0x0F, 0xD0,
+    0xAF, 0xC1, 0xF9, 0x77, 0x77, 0x77, 0x39, 0xA9, 0x19, 0xFA, 0x0A, 0xFC, 0x0F, 0xD0, 0x9F, 0xA1,
+    0x9A, 0xA9, 0x10, 0x77, 0x70, 0xF9, 0x71, 0xF9, 0x1F, 0xD7, 0x0A, 0xFC, 0x1F, 0xD7, 0x0F, 0xD1,
+    0xFC, 0xA7, 0x0A, 0xFC, 0x2E, 0xA7, 0x2E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x39, 0xAA, 0x97, 0x29, 0xAA, 0xA2, 0xAF, 0xA7, 0x09, 0xFA, 0x1F, 0xD7, 0x0F,
+    0xD1, 0xFD, 0x70, 0xFD, 0x1A, 0xF9, 0x70, 0x9F, 0xA2, 0x99, 0x97, 0x39, 0x99, 0x20, 0x77, 0x69,
+    0xFC, 0xA9, 0x5D, 0x2A, 0xFF, 0xC9, 0x2F, 0x09, 0xFF, 0xFF, 0xC9, 0x0E, 0xA2, 0x9F, 0xFC, 0xA2,
+    0xCA, 0x6A, 0xFC, 0x97, 0x75, 0x39, 0xAA, 0xA9, 0x79, 0x93, 0xFE, 0xA4, 0x9D, 0x91, 0xFF, 0xDA,
+    0x99, 0xAE, 0xA0, 0xAE, 0xA9, 0xAF, 0xFE, 0x1A, 0xD9, 0x39, 0xFF, 0x3A, 0xA6, 0x9A, 0xDA, 0x97,
+    0x77, 0x77, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xFC, 0x90,
+    0xAF, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xFC, 0x97, 0x77, 0x77, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFF, 0xC9, 0x0A, 0xFF, 0xFF, 0xC9, 0x09, 0xFF, 0xFF, 0xC9, 0x29,
+    0xAA, 0x95, 0x99, 0x3F, 0xD9, 0x3E, 0x1F, 0xFA, 0x1A, 0xE0, 0x9F, 0xFF, 0xE0, 0xAE, 0x2F, 0xF9,
+    0x1D, 0x93, 0x9F, 0xC9, 0x39, 0x69, 0x99, 0x6A, 0xDA, 0x59, 0xA3, 0xFD, 0xA3, 0xE1, 0xFF, 0xC9,
+    0x0A, 0xE0, 0x9F, 0xAF, 0xFD, 0x0A, 0xDA, 0x2A, 0xFE, 0x2A, 0xC4, 0x9F, 0xC7, 0x73, 0x77, 0x3C,
+    0xA9, 0x72, 0x9A, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC2, 0xAF, 0xFF, 0xCA, 0x70, 0x99, 0x99,
+    0x97, 0x77, 0x77, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xAF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFC,
+    0x1F, 0xAA, 0x99, 0x99, 0x9A, 0xAF, 0x1A, 0x76, 0xA0, 0x71, 0xA7, 0x49, 0xD9, 0x72, 0xE2, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFA, 0xA9, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xA9,
+    0x5E, 0x72, 0xAD, 0xA5, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1A, 0xDA, 0x72, 0xAD, 0x74, 0x99, 0x71, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0x9A, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x97, 0x77, 0x76,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0x9A, 0xFF, 0xFF, 0xC9,
+    0x9F, 0xFF, 0xFC, 0x90, 0x73, 0x97, 0x39, 0xDA, 0x70, 0xAF, 0xC6, 0xAF, 0xD9, 0x4A, 0xFC, 0xA9,
+    0x4A, 0xFC, 0xA5, 0xAF, 0xCA, 0x7F, 0xC7, 0x1A, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7,
+    0x09, 0xFD, 0xA7, 0x09, 0xFD, 0x97, 0x09, 0xF7, 0x3A, 0xC9, 0x77, 0x76, 0xFF, 0xFD, 0xAF, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xA0, 0x77, 0xCA, 0x73, 0x9E, 0xA7, 0x1A, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x09,
+    0xFD, 0xA7, 0x09, 0xFD, 0x97, 0x09, 0xFD, 0x97, 0x0A, 0xFA, 0x7A, 0xFC, 0x94, 0x9A, 0xFC, 0xA4,
+    0x9F, 0xD9, 0x49, 0xFD, 0x95, 0xAF, 0xC9, 0x70, 0xE9, 0x72, 0xA9, 0x77, 0x77, 0x71, 0xFF, 0xFD,
+    0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xA0, 0x73, 0x97, 0x29, 0x97, 0x29, 0xDA, 0x79, 0xE7, 0x09, 0xFC,
+    0x59, 0xFC, 0x95, 0x9F, 0xD9, 0x39, 0xFD, 0xA4, 0x9F, 0xD9, 0x39, 0xFD, 0x94, 0x9F, 0xD9, 0x39,
+    0xFD, 0x94, 0x9F, 0xCA, 0x93, 0x9F, 0xD9, 0x6F, 0xC6, 0xFC, 0x97, 0x0A, 0xFC, 0xA4, 0xAF, 0xCA,
+    0x70, 0x9F, 0xDA, 0x39, 0xFD, 0xA7, 0x09, 0xFD, 0xA3, 0x9F, 0xDA, 0x70, 0x9F, 0xDA, 0x39, 0xFD,
+    0xA7, 0x09, 0xFD, 0x93, 0x9F, 0xD9, 0x70, 0xAF, 0x69, 0xF7, 0x3A, 0xCA, 0x70, 0x9C, 0xA7, 0x77,
+    0x30, 0x09, 0x97, 0x29, 0x74, 0xE9, 0x7E, 0x97, 0x19, 0xFC, 0x95, 0xFC, 0x97, 0x0A, 0xFD, 0x93,
+    0x9F, 0xD9, 0x70, 0x9F, 0xD9, 0x39, 0xFD, 0x97, 0x09, 0xFD, 0x93, 0x9F, 0xD9, 0x70, 0x9F, 0xD9,
+    0x39, 0xAF, 0xC9, 0x70, 0x9F, 0xA5, 0x9F, 0xC7, 0xAF, 0xCA, 0x4A, 0xFC, 0xA5, 0xAF, 0xD4, 0xAF,
+    0xD9, 0x4A, 0xFD, 0x93, 0xAF, 0xD9, 0x4A, 0xFD, 0x93, 0xAF, 0xD9, 0x49, 0xFD, 0x93, 0x9F, 0xD9,
+    0x7F, 0x96, 0xF9, 0x71, 0xAC, 0x97, 0x0A, 0xCA, 0x77, 0x77, 0x50, 0x9F, 0xFF, 0xCA, 0x96, 0x9F,
+    0xFF, 0xFA, 0x49, 0xFF, 0xFF, 0xD9, 0x29, 0xFF, 0xFF, 0xE9, 0x77, 0x9F, 0xD7, 0x71, 0xAF, 0xA7,
+    0x71, 0xFC, 0x77, 0x19, 0xF7, 0x72, 0xF9, 0x77, 0x1F, 0x97, 0x71, 0xF9, 0x77, 0x09, 0xF9, 0x77,
+    0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x7A, 0xFC, 0x19, 0xFF, 0xFF, 0xE9, 0x19, 0xFF, 0xFF, 0xD9, 0x29,
+    0xFF, 0xFF, 0xC4, 0x9F, 0xFF, 0xCA, 0xA7, 0x77, 0x50, 0x77, 0x09, 0x99, 0x77, 0x2F, 0x77, 0x2F,
+    0x77, 0x1A, 0xEA, 0x77, 0x1F, 0x72, 0x9A, 0xAF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x29, 0xFF, 0xFF,
+    0xD9, 0x19, 0xFF, 0xFF, 0xE9, 0x1F, 0xD9, 0x3A, 0xE9, 0x5A, 0xFA, 0x5F, 0x6F, 0xC5, 0x9E, 0xA6,
+    0xF9, 0x5F, 0x69, 0xF6, 0xF6, 0x9F, 0x5A, 0xE9, 0x69, 0xF5, 0xF7, 0x9F, 0x93, 0x9F, 0x70, 0xFA,
+    0x3A, 0xE9, 0x70, 0xAF, 0x92, 0xF7, 0x2F, 0xCA, 0x09, 0xEA, 0x72, 0xAF, 0xFE, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x92, 0xAF, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xFD, 0x97, 0xF7, 0x71,
+    0xAE, 0x97, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xE9, 0x73, 0x74, 0xAA, 0xA9, 0x77, 0x1A, 0xE9,
+    0x77, 0x1F, 0x77, 0x19, 0xEA, 0x77, 0x1F, 0x96, 0x9F, 0xFF, 0xD9, 0x69, 0xFF, 0xFF, 0xA4, 0x9F,
+    0xFF, 0xFD, 0x92, 0x9F, 0xFF, 0xFE, 0x97, 0x2A, 0xEA, 0x9F, 0xD7, 0x2F, 0x2A, 0xFA, 0x70, 0x9E,
+    0xA3, 0xFC, 0x70, 0xAE, 0x93, 0x9F, 0x70, 0xF5, 0xF9, 0x69, 0xEA, 0x5F, 0x96, 0xF9, 0x5F, 0x96,
+    0xF5, 0x9F, 0x95, 0x9E, 0xA5, 0xFC, 0x6F, 0x59, 0xFA, 0x6F, 0x4A, 0xFC, 0x19, 0xAA, 0xAA, 0xFC,
+    0xAA, 0xAF, 0xE9, 0x19, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFD, 0xA9, 0x71,
+    0xF7, 0x71, 0x9E, 0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x77, 0x19, 0xAA, 0xA9, 0x77, 0x59, 0xAA, 0xFF,
+    0xF3, 0xAF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFE, 0x0F, 0xD9, 0x74, 0x9F, 0xA7, 0x6A,
+    0xF7, 0x7F, 0xC7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xC7, 0x79, 0xFA, 0x77, 0xFC, 0xA7, 0x69, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x9F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x5A, 0xFF, 0xFD, 0x77,
+    0x77, 0x72, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFA,
+    0xA9, 0x5F, 0xFF, 0xFA, 0x3F, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xE7, 0x69, 0xFD, 0x77, 0xAF, 0x97,
+    0x7F, 0xA7, 0x7F, 0xC7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xA7, 0x6A, 0xF9, 0x75, 0xAF, 0xC0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xF9, 0x0F, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0xA7,
+    0x77, 0x77, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x77,
+    0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19, 0xFA, 0x9E, 0x9A, 0xF9, 0x69, 0xEA, 0x2E,
+    0x2A, 0xE9, 0x5E, 0x93, 0xE3, 0x9E, 0x4E, 0x94, 0xE4, 0x9E, 0x29, 0xDA, 0x5E, 0x5A, 0xD9, 0x1A,
+    0xD6, 0xE6, 0xDA, 0x1D, 0xA6, 0xE6, 0xE1, 0xDA, 0x6E, 0x6A, 0xD0, 0x9E, 0xAA, 0xAA, 0xAA, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xFE, 0x90, 0xD9, 0x6E, 0x69,
+    0xD1, 0xDA, 0x6E, 0x6A, 0xD1, 0xE6, 0xE6, 0xE1, 0x9D, 0x95, 0xE5, 0x9D, 0x92, 0xE5, 0xE5, 0xE3,
+    0x9E, 0x4E, 0x4E, 0x94, 0xAE, 0x3E, 0x3E, 0xA6, 0xAE, 0xA9, 0x0E, 0x09, 0xAE, 0xA7, 0x09, 0xFF,
+    0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74,
+    0xAF, 0xFE, 0xA7, 0x19, 0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x4E, 0x4E,
+    0x97, 0x49, 0xE2, 0x9D, 0xA7, 0x6A, 0xD9, 0x1A, 0xD7, 0x70, 0xDA, 0x1E, 0x77, 0x0E, 0x1D, 0xA7,
+    0x70, 0xAD, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFF,
+    0xE9, 0x9F, 0xFF, 0xFF, 0xE9, 0x0D, 0x97, 0x70, 0x9D, 0x1D, 0xA7, 0x70, 0xAD, 0x1E, 0x77, 0x0E,
+    0x19, 0xD9, 0x76, 0x9D, 0x92, 0xE7, 0x6E, 0x39, 0xE7, 0x4E, 0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA,
+    0x94, 0x9A, 0xEA, 0x70, 0x9F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10,
+    0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19, 0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xEA,
+    0x70, 0x9E, 0x95, 0xF7, 0x19, 0xF4, 0xFD, 0x79, 0xFD, 0x29, 0xDA, 0xAE, 0x59, 0xE9, 0xAD, 0x91,
+    0xAD, 0x1A, 0xE3, 0x9E, 0x91, 0xDA, 0x1E, 0x2A, 0xE1, 0x9E, 0x92, 0xE1, 0xDA, 0x3A, 0xE9, 0xE9,
+    0x3A, 0xD0, 0x9D, 0x94, 0xAF, 0xC9, 0x49, 0xD9, 0x9D, 0x95, 0xAE, 0xA5, 0x9D, 0x99, 0xD9, 0x49,
+    0xFC, 0x59, 0xD9, 0x0D, 0x93, 0x9F, 0xE4, 0x9D, 0x1D, 0xA2, 0x9E, 0x90, 0xAE, 0x3A, 0xD1, 0xE1,
+    0x9E, 0x92, 0xAE, 0x2E, 0x19, 0xD9, 0x9E, 0x94, 0xAE, 0x09, 0xD9, 0x2F, 0xD9, 0x6A, 0xFD, 0x39,
+    0xF9, 0x70, 0xAF, 0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA, 0x94, 0x9A, 0xEA, 0x70, 0x9F, 0xFF, 0xC9,
+    0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF,
+    0xFE, 0xA7, 0x19, 0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xE9, 0x70, 0x9E, 0x95, 0xE9, 0x71, 0x9F, 0x4E,
+    0x97, 0x19, 0xFD, 0x29, 0xDA, 0x71, 0x9E, 0x9A, 0xD9, 0x1A, 0xD7, 0x19, 0xE9, 0x1D, 0xA1, 0xE7,
+    0x09, 0xE9, 0x2E, 0x1D, 0xA7, 0x9E, 0x93, 0xAD, 0x09, 0xD9, 0x69, 0xE9, 0x49, 0xD9, 0x9D, 0x95,
+    0x9E, 0x95, 0x9D, 0x99, 0xD9, 0x49, 0xE9, 0x69, 0xD9, 0x0D, 0x93, 0x9E, 0x97, 0x9D, 0x1D, 0xA2,
+    0x9E, 0x97, 0x0A, 0xD1, 0xE1, 0x9E, 0x97, 0x1E, 0x19, 0xD9, 0x9E, 0x97, 0x19, 0xD9, 0x2F, 0xD9,
+    0x72, 0xE3, 0x9F, 0x97, 0x2E, 0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA, 0x94, 0x9A, 0xEA, 0x70, 0x9F,
+    0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x69, 0xE9, 0x75, 0xAE, 0xA7,
+    0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A,
+    0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA,
+    0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0xAA, 0xA1, 0x9F, 0xC0, 0xAF, 0xC0, 0xAF, 0xC0, 0x9F, 0xA2, 0x99,
+    0x91, 0x1A, 0xAA, 0x96, 0xAA, 0xA9, 0x6A, 0xAA, 0x91, 0xFC, 0x5F, 0xC5, 0xFC, 0x09, 0xFC, 0x93,
+    0x9F, 0xC9, 0x39, 0xFC, 0x99, 0xFC, 0x93, 0x9F, 0xC9, 0x39, 0xFC, 0x90, 0xFC, 0x5F, 0xC5, 0xFC,
+    0x29, 0x99, 0x79, 0x99, 0x79, 0x99, 0x10, 0x77, 0x77, 0x75, 0xC7, 0x77, 0x4E, 0x77, 0x72, 0xFC,
+    0x77, 0x70, 0xFE, 0x77, 0x6E, 0xAF, 0xC7, 0x74, 0xD4, 0x9E, 0x77, 0x2D, 0x7A, 0xD7, 0x70, 0xE7,
+    0x0A, 0xD7, 0x6F, 0xA9, 0xAD, 0xA9, 0x2E, 0x74, 0xFF, 0xFA, 0x19, 0xE7, 0x2F, 0xFF, 0xD9, 0x1F,
+    0x70, 0xFF, 0xFE, 0xA1, 0xFC, 0x6F, 0xFF, 0xFC, 0x1A, 0xFC, 0x4F, 0xFF, 0xFC, 0x91, 0xFE, 0x2F,
+    0xFF, 0xEA, 0x93, 0xFF, 0x09, 0xFF, 0xF9, 0x6A, 0xFF, 0x90, 0x9F, 0xFD, 0xA6, 0xAF, 0xF9, 0x29,
+    0xFF, 0xCA, 0x49, 0xFF, 0xC9, 0x49, 0xFF, 0xA2, 0xAF, 0xFD, 0x96, 0x9F, 0xF1, 0xAF, 0xFD, 0x97,
+    0x09, 0xFE, 0x19, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x9F, 0xFC, 0x97, 0x49, 0xFF, 0xFE, 0x97, 0x69,
+    0xFC, 0x90, 0x9F, 0xC9, 0x77, 0x09, 0xEA, 0x2F, 0x97, 0x72, 0x9D, 0xA2, 0xE9, 0x77, 0x49, 0xD9,
+    0x0A, 0xD9, 0x77, 0x69, 0xFC, 0x97, 0x77, 0x09, 0xE9, 0x77, 0x72, 0x9C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 7, 26, 10, 2, 25, 46, 0 }, // !
-    { 12, 12, 14, 1, 24, 36, 46 }, // "
-    { 21, 21, 22, 0, 19, 111, 82 }, // #
-    { 17, 34, 21, 2, 27, 145, 193 }, // $
-    { 30, 27, 32, 1, 25, 203, 338 }, // %
-    { 25, 26, 27, 1, 25, 163, 541 }, // &
-    { 6, 12, 8, 1, 24, 18, 704 }, // '
-    { 11, 33, 13, 1, 27, 91, 722 }, // (
-    { 12, 33, 13, 0, 27, 99, 813 }, // )
-    { 13, 12, 14, 0, 25, 39, 912 }, // *
-    { 15, 16, 21, 3, 19, 60, 951 }, // +
-    { 9, 12, 10, 0, 5, 27, 1011 }, // ,
-    { 11, 5, 13, 1, 11, 14, 1038 }, // -
-    { 7, 6, 10, 1, 5, 11, 1052 }, // .
-    { 16, 26, 18, 1, 24, 104, 1063 }, // /
-    { 19, 24, 21, 1, 23, 114, 1167 }, // 0
-    { 15, 23, 21, 3, 23, 87, 1281 }, // 1
-    { 18, 23, 21, 1, 23, 104, 1368 }, // 2
-    { 17, 24, 21, 2, 23, 102, 1472 }, // 3
-    { 20, 24, 21, 0, 23, 120, 1574 }, // 4
-    { 17, 24, 21, 1, 23, 102, 1694 }, // 5
-    { 18, 24, 21, 1, 23, 108, 1796 }, // 6
-    { 17, 24, 21, 2, 23, 102, 1904 }, // 7
-    { 18, 24, 21, 1, 23, 108, 2006 }, // 8
-    { 18, 24, 21, 1, 23, 108, 2114 }, // 9
-    { 7, 19, 10, 1, 18, 34, 2222 }, // :
-    { 9, 25, 10, 0, 18, 57, 2256 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2313 }, // <
-    { 15, 10, 21, 3, 16, 38, 2373 }, // =
-    { 15, 16, 21, 3, 19, 60, 2411 }, // >
-    { 13, 26, 16, 2, 25, 85, 2471 }, // ?
-    { 31, 30, 33, 1, 23, 233, 2556 }, // @
-    { 26, 24, 27, 0, 24, 156, 2789 }, // A
-    { 20, 25, 22, 1, 24, 125, 2945 }, // B
-    { 20, 25, 22, 1, 24, 125, 3070 }, // C
-    { 24, 25, 26, 1, 24, 150, 3195 }, // D
-    { 20, 23, 22, 1, 23, 115, 3345 }, // E
-    { 18, 23, 20, 1, 23, 104, 3460 }, // F
-    { 23, 25, 25, 1, 24, 144, 3564 }, // G
-    { 27, 23, 29, 1, 23, 156, 3708 }, // H
-    { 12, 23, 14, 1, 23, 69, 3864 }, // I
-    { 15, 30, 14, -2, 23, 113, 3933 }, // J
-    { 24, 24, 26, 1, 23, 144, 4046 }, // K
-    { 20, 23, 22, 1, 23, 115, 4190 }, // L
-    { 31, 23, 32, 0, 23, 179, 4305 }, // M
-    { 27, 24, 28, 0, 23, 162, 4484 }, // N
-    { 24, 25, 26, 1, 24, 150, 4646 }, // O
-    { 19, 24, 21, 1, 24, 114, 4796 }, // P
-    { 25, 32, 27, 1, 24, 200, 4910 }, // Q
-    { 23, 25, 25, 1, 24, 144, 5110 }, // R
-    { 17, 25, 19, 1, 24, 107, 5254 }, // S
-    { 23, 23, 24, 0, 23, 133, 5361 }, // T
-    { 26, 24, 27, 0, 23, 156, 5494 }, // U
-    { 26, 24, 27, 0, 23, 156, 5650 }, // V
-    { 37, 24, 38, 0, 23, 222, 5806 }, // W
-    { 25, 23, 26, 0, 23, 144, 6028 }, // X
-    { 24, 23, 25, 0, 23, 138, 6172 }, // Y
-    { 20, 24, 21, 0, 23, 120, 6310 }, // Z
-    { 8, 32, 11, 2, 26, 64, 6430 }, // [
-    { 16, 26, 18, 1, 24, 104, 6494 }, // <backslash>
-    { 9, 32, 11, 1, 26, 72, 6598 }, // ]
-    { 17, 17, 21, 2, 22, 73, 6670 }, // ^
-    { 17, 4, 18, 0, -1, 17, 6743 }, // _
-    { 8, 9, 22, 7, 28, 18, 6760 }, // `
-    { 18, 19, 20, 1, 18, 86, 6778 }, // a
-    { 21, 27, 21, -1, 26, 142, 6864 }, // b
-    { 15, 19, 17, 1, 18, 72, 7006 }, // c
-    { 20, 27, 22, 1, 26, 135, 7078 }, // d
-    { 16, 19, 18, 1, 18, 76, 7213 }, // e
-    { 18, 26, 19, 0, 26, 117, 7289 }, // f
-    { 20, 26, 21, 0, 18, 130, 7406 }, // g
-    { 22, 26, 23, 0, 26, 143, 7536 }, // h
-    { 12, 26, 13, 0, 26, 78, 7679 }, // i
-    { 12, 34, 10, -3, 26, 102, 7757 }, // j
-    { 21, 27, 22, 0, 26, 142, 7859 }, // k
-    { 11, 26, 12, 0, 26, 72, 8001 }, // l
-    { 33, 18, 34, 0, 18, 149, 8073 }, // m
-    { 22, 18, 23, 0, 18, 99, 8222 }, // n
-    { 18, 19, 20, 1, 18, 86, 8321 }, // o
-    { 20, 26, 21, 0, 18, 130, 8407 }, // p
-    { 19, 26, 21, 1, 18, 124, 8537 }, // q
-    { 16, 18, 17, 0, 18, 72, 8661 }, // r
-    { 15, 19, 17, 1, 18, 72, 8733 }, // s
-    { 15, 23, 15, -1, 22, 87, 8805 }, // t
-    { 22, 19, 23, 0, 18, 105, 8892 }, // u
-    { 22, 19, 23, 0, 18, 105, 8997 }, // v
-    { 30, 19, 31, 0, 18, 143, 9102 }, // w
-    { 21, 18, 22, 0, 18, 95, 9245 }, // x
-    { 22, 26, 23, 0, 18, 143, 9340 }, // y
-    { 17, 19, 18, 0, 18, 81, 9483 }, // z
-    { 11, 33, 14, 2, 27, 91, 9564 }, // {
-    { 5, 30, 10, 3, 26, 38, 9655 }, // |
-    { 12, 33, 13, 0, 27, 99, 9693 }, // }
-    { 17, 8, 21, 2, 15, 34, 9792 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9826 }, //  
-    { 7, 26, 10, 1, 18, 46, 9826 }, // ¡
-    { 18, 33, 21, 1, 26, 149, 9872 }, // ¢
-    { 20, 24, 21, 0, 23, 120, 10021 }, // £
-    { 19, 16, 21, 1, 19, 76, 10141 }, // ¤
-    { 23, 23, 23, -1, 23, 133, 10217 }, // ¥
-    { 5, 30, 10, 3, 26, 38, 10350 }, // ¦
-    { 15, 26, 17, 1, 23, 98, 10388 }, // §
-    { 13, 6, 22, 5, 26, 20, 10486 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 10506 }, // ©
-    { 13, 17, 15, 1, 24, 56, 10663 }, // ª
-    { 18, 13, 20, 1, 15, 59, 10719 }, // «
-    { 15, 9, 21, 3, 16, 34, 10778 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 10812 }, // ­
-    { 19, 18, 20, 0, 26, 86, 10826 }, // ®
-    { 12, 4, 22, 5, 24, 12, 10912 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 10924 }, // °
-    { 15, 21, 21, 3, 20, 79, 10963 }, // ±
-    { 13, 16, 15, 1, 28, 52, 11042 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11094 }, // ³
-    { 7, 9, 22, 8, 28, 16, 11145 }, // ´
-    { 22, 26, 24, 1, 18, 143, 11161 }, // µ
-    { 19, 28, 20, 0, 23, 133, 11304 }, // ¶
-    { 7, 6, 10, 1, 12, 11, 11437 }, // ·
-    { 7, 8, 22, 8, -1, 14, 11448 }, // ¸
-    { 11, 16, 15, 2, 28, 44, 11462 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 11506 }, // º
-    { 18, 13, 20, 1, 15, 59, 11562 }, // »
-    { 33, 28, 36, 2, 25, 231, 11621 }, // ¼
-    { 33, 28, 36, 2, 25, 231, 11852 }, // ½
-    { 34, 28, 36, 1, 25, 238, 12083 }, // ¾
-    { 14, 25, 16, 1, 18, 88, 12321 }, // ¿
-    { 26, 32, 27, 0, 32, 208, 12409 }, // À
-    { 26, 32, 27, 0, 32, 208, 12617 }, // Á
-    { 26, 32, 27, 0, 32, 208, 12825 }, // Â
-    { 26, 32, 27, 0, 32, 208, 13033 }, // Ã
-    { 26, 31, 27, 0, 31, 202, 13241 }, // Ä
-    { 26, 33, 27, 0, 33, 215, 13443 }, // Å
-    { 33, 23, 33, -1, 23, 190, 13658 }, // Æ
-    { 20, 33, 22, 1, 24, 165, 13848 }, // Ç
-    { 20, 32, 22, 1, 32, 160, 14013 }, // È
-    { 20, 32, 22, 1, 32, 160, 14173 }, // É
-    { 20, 32, 22, 1, 32, 160, 14333 }, // Ê
-    { 20, 31, 22, 1, 31, 155, 14493 }, // Ë
-    { 12, 32, 14, 1, 32, 96, 14648 }, // Ì
-    { 12, 32, 14, 1, 32, 96, 14744 }, // Í
-    { 13, 32, 14, 0, 32, 104, 14840 }, // Î
-    { 14, 31, 15, 0, 31, 109, 14944 }, // Ï
-    { 25, 25, 26, 0, 24, 157, 15053 }, // Ð
-    { 27, 33, 28, 0, 32, 223, 15210 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 15433 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 15631 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 15829 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 16027 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 16225 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 16417 }, // ×
-    { 26, 25, 27, 0, 24, 163, 16474 }, // Ø
-    { 26, 33, 27, 0, 32, 215, 16637 }, // Ù
-    { 26, 33, 27, 0, 32, 215, 16852 }, // Ú
-    { 26, 33, 27, 0, 32, 215, 17067 }, // Û
-    { 26, 32, 27, 0, 31, 208, 17282 }, // Ü
-    { 24, 32, 25, 0, 32, 192, 17490 }, // Ý
-    { 20, 23, 22, 1, 23, 115, 17682 }, // Þ
-    { 21, 27, 22, 0, 26, 142, 17797 }, // ß
-    { 18, 29, 20, 1, 28, 131, 17939 }, // à
-    { 18, 29, 20, 1, 28, 131, 18070 }, // á
-    { 18, 28, 20, 1, 27, 126, 18201 }, // â
-    { 18, 27, 20, 1, 26, 122, 18327 }, // ã
-    { 18, 27, 20, 1, 26, 122, 18449 }, // ä
-    { 18, 29, 20, 1, 28, 131, 18571 }, // å
-    { 26, 19, 28, 1, 18, 124, 18702 }, // æ
-    { 15, 27, 17, 1, 18, 102, 18826 }, // ç
-    { 16, 29, 18, 1, 28, 116, 18928 }, // è
-    { 16, 29, 18, 1, 28, 116, 19044 }, // é
-    { 16, 28, 18, 1, 27, 112, 19160 }, // ê
-    { 16, 27, 18, 1, 26, 108, 19272 }, // ë
-    { 12, 28, 13, 0, 28, 84, 19380 }, // ì
-    { 12, 28, 13, 0, 28, 84, 19464 }, // í
-    { 12, 27, 13, 0, 27, 81, 19548 }, // î
-    { 12, 26, 13, 0, 26, 78, 19629 }, // ï
-    { 18, 28, 20, 1, 27, 126, 19707 }, // ð
-    { 22, 26, 23, 0, 26, 143, 19833 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 19976 }, // ò
-    { 18, 29, 20, 1, 28, 131, 20107 }, // ó
-    { 18, 28, 20, 1, 27, 126, 20238 }, // ô
-    { 18, 27, 20, 1, 26, 122, 20364 }, // õ
-    { 18, 27, 20, 1, 26, 122, 20486 }, // ö
-    { 15, 16, 21, 3, 19, 60, 20608 }, // ÷
-    { 20, 19, 21, 0, 18, 95, 20668 }, // ø
-    { 22, 29, 23, 0, 28, 160, 20763 }, // ù
-    { 22, 29, 23, 0, 28, 160, 20923 }, // ú
-    { 22, 28, 23, 0, 27, 154, 21083 }, // û
-    { 22, 27, 23, 0, 26, 149, 21237 }, // ü
-    { 22, 36, 23, 0, 28, 198, 21386 }, // ý
-    { 20, 34, 21, 0, 26, 170, 21584 }, // þ
-    { 22, 34, 23, 0, 26, 187, 21754 }, // ÿ
-    { 26, 30, 27, 0, 30, 195, 21941 }, // Ā
-    { 18, 25, 20, 1, 24, 113, 22136 }, // ā
-    { 26, 32, 27, 0, 32, 208, 22249 }, // Ă
-    { 18, 27, 20, 1, 26, 122, 22457 }, // ă
-    { 26, 32, 27, 0, 24, 208, 22579 }, // Ą
-    { 18, 26, 20, 1, 18, 117, 22787 }, // ą
-    { 20, 33, 22, 1, 32, 165, 22904 }, // Ć
-    { 15, 29, 17, 1, 28, 109, 23069 }, // ć
-    { 20, 33, 22, 1, 32, 165, 23178 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 23343 }, // ĉ
-    { 20, 33, 22, 1, 32, 165, 23448 }, // Ċ
-    { 15, 27, 17, 1, 26, 102, 23613 }, // ċ
-    { 20, 33, 22, 1, 32, 165, 23715 }, // Č
-    { 15, 29, 17, 1, 28, 109, 23880 }, // č
-    { 24, 33, 26, 1, 32, 198, 23989 }, // Ď
-    { 23, 27, 25, 1, 26, 156, 24187 }, // ď
-    { 25, 25, 26, 0, 24, 157, 24343 }, // Đ
-    { 20, 27, 22, 1, 26, 135, 24500 }, // đ
-    { 20, 30, 22, 1, 30, 150, 24635 }, // Ē
-    { 16, 25, 18, 1, 24, 100, 24785 }, // ē
-    { 20, 32, 22, 1, 32, 160, 24885 }, // Ĕ
-    { 16, 27, 18, 1, 26, 108, 25045 }, // ĕ
-    { 20, 32, 22, 1, 32, 160, 25153 }, // Ė
-    { 16, 27, 18, 1, 26, 108, 25313 }, // ė
-    { 20, 31, 22, 1, 23, 155, 25421 }, // Ę
-    { 16, 26, 18, 1, 18, 104, 25576 }, // ę
-    { 20, 32, 22, 1, 32, 160, 25680 }, // Ě
-    { 16, 29, 18, 1, 28, 116, 25840 }, // ě
-    { 23, 33, 25, 1, 32, 190, 25956 }, // Ĝ
-    { 20, 35, 21, 0, 27, 175, 26146 }, // ĝ
-    { 23, 33, 25, 1, 32, 190, 26321 }, // Ğ
-    { 20, 34, 21, 0, 26, 170, 26511 }, // ğ
-    { 23, 33, 25, 1, 32, 190, 26681 }, // Ġ
-    { 20, 34, 21, 0, 26, 170, 26871 }, // ġ
-    { 23, 33, 25, 1, 24, 190, 27041 }, // Ģ
-    { 20, 37, 21, 0, 29, 185, 27231 }, // ģ
-    { 27, 32, 29, 1, 32, 216, 27416 }, // Ĥ
-    { 23, 34, 23, -1, 34, 196, 27632 }, // ĥ
-    { 28, 23, 29, 0, 23, 161, 27828 }, // Ħ
-    { 22, 26, 23, 0, 26, 143, 27989 }, // ħ
-    { 12, 32, 14, 1, 32, 96, 28132 }, // Ĩ
-    { 12, 26, 13, 0, 26, 78, 28228 }, // ĩ
-    { 12, 30, 14, 1, 30, 90, 28306 }, // Ī
-    { 12, 24, 13, 0, 24, 72, 28396 }, // ī
-    { 12, 32, 14, 1, 32, 96, 28468 }, // Ĭ
-    { 12, 26, 13, 0, 26, 78, 28564 }, // ĭ
-    { 12, 31, 14, 1, 23, 93, 28642 }, // Į
-    { 12, 34, 13, 0, 26, 102, 28735 }, // į
-    { 12, 32, 14, 1, 32, 96, 28837 }, // İ
-    { 12, 18, 13, 0, 18, 54, 28933 }, // ı
-    { 26, 30, 28, 1, 23, 195, 28987 }, // Ĳ
-    { 21, 34, 22, 0, 26, 179, 29182 }, // ĳ
-    { 15, 39, 14, -2, 32, 147, 29361 }, // Ĵ
-    { 15, 35, 13, -3, 27, 132, 29508 }, // ĵ
-    { 24, 32, 26, 1, 23, 192, 29640 }, // Ķ
-    { 21, 35, 22, 0, 26, 184, 29832 }, // ķ
-    { 22, 19, 23, 0, 18, 105, 30016 }, // ĸ
-    { 20, 32, 22, 1, 32, 160, 30121 }, // Ĺ
-    { 11, 34, 12, 0, 34, 94, 30281 }, // ĺ
-    { 20, 32, 22, 1, 23, 160, 30375 }, // Ļ
-    { 11, 35, 12, 0, 26, 97, 30535 }, // ļ
-    { 20, 26, 22, 1, 26, 130, 30632 }, // Ľ
-    { 15, 26, 16, 0, 26, 98, 30762 }, // ľ
-    { 20, 23, 22, 1, 23, 115, 30860 }, // Ŀ
-    { 18, 26, 19, 0, 26, 117, 30975 }, // ŀ
-    { 22, 23, 22, -1, 23, 127, 31092 }, // Ł
-    { 13, 26, 13, -1, 26, 85, 31219 }, // ł
-    { 27, 33, 28, 0, 32, 223, 31304 }, // Ń
-    { 22, 28, 23, 0, 28, 154, 31527 }, // ń
-    { 27, 32, 28, 0, 23, 216, 31681 }, // Ņ
-    { 22, 27, 23, 0, 18, 149, 31897 }, // ņ
-    { 27, 33, 28, 0, 32, 223, 32046 }, // Ň
-    { 22, 28, 23, 0, 28, 154, 32269 }, // ň
-    { 30, 24, 31, 0, 24, 180, 32423 }, // ŉ
-    { 27, 30, 28, 0, 23, 203, 32603 }, // Ŋ
-    { 20, 26, 22, 0, 18, 130, 32806 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 32936 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 33122 }, // ō
-    { 24, 33, 26, 1, 32, 198, 33235 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 33433 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 33555 }, // Ő
-    { 18, 29, 20, 1, 28, 131, 33759 }, // ő
-    { 31, 24, 33, 1, 23, 186, 33890 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 34076 }, // œ
-    { 23, 33, 25, 1, 32, 190, 34209 }, // Ŕ
-    { 16, 28, 17, 0, 28, 112, 34399 }, // ŕ
-    { 23, 33, 25, 1, 24, 190, 34511 }, // Ŗ
-    { 16, 27, 17, 0, 18, 108, 34701 }, // ŗ
-    { 23, 33, 25, 1, 32, 190, 34809 }, // Ř
-    { 16, 28, 17, 0, 28, 112, 34999 }, // ř
-    { 17, 33, 19, 1, 32, 141, 35111 }, // Ś
-    { 15, 29, 17, 1, 28, 109, 35252 }, // ś
-    { 17, 33, 19, 1, 32, 141, 35361 }, // Ŝ
-    { 15, 28, 17, 1, 27, 105, 35502 }, // ŝ
-    { 17, 33, 19, 1, 24, 141, 35607 }, // Ş
-    { 15, 27, 17, 1, 18, 102, 35748 }, // ş
-    { 17, 33, 19, 1, 32, 141, 35850 }, // Š
-    { 15, 29, 17, 1, 28, 109, 35991 }, // š
-    { 23, 32, 24, 0, 23, 184, 36100 }, // Ţ
-    { 15, 31, 15, -1, 22, 117, 36284 }, // ţ
-    { 23, 32, 24, 0, 32, 184, 36401 }, // Ť
-    { 15, 28, 15, -1, 27, 105, 36585 }, // ť
-    { 23, 23, 24, 0, 23, 133, 36690 }, // Ŧ
-    { 15, 23, 15, -1, 22, 87, 36823 }, // ŧ
-    { 26, 33, 27, 0, 32, 215, 36910 }, // Ũ
-    { 22, 27, 23, 0, 26, 149, 37125 }, // ũ
-    { 26, 31, 27, 0, 30, 202, 37274 }, // Ū
-    { 22, 25, 23, 0, 24, 138, 37476 }, // ū
-    { 26, 33, 27, 0, 32, 215, 37614 }, // Ŭ
-    { 22, 27, 23, 0, 26, 149, 37829 }, // ŭ
-    { 26, 34, 27, 0, 33, 221, 37978 }, // Ů
-    { 22, 29, 23, 0, 28, 160, 38199 }, // ů
-    { 26, 34, 27, 0, 33, 221, 38359 }, // Ű
-    { 22, 29, 23, 0, 28, 160, 38580 }, // ű
-    { 26, 31, 27, 0, 23, 202, 38740 }, // Ų
-    { 22, 26, 23, 0, 18, 143, 38942 }, // ų
-    { 37, 33, 38, 0, 32, 306, 39085 }, // Ŵ
-    { 30, 28, 31, 0, 27, 210, 39391 }, // ŵ
-    { 24, 32, 25, 0, 32, 192, 39601 }, // Ŷ
-    { 22, 35, 23, 0, 27, 193, 39793 }, // ŷ
-    { 24, 31, 25, 0, 31, 186, 39986 }, // Ÿ
-    { 20, 33, 21, 0, 32, 165, 40172 }, // Ź
-    { 17, 29, 18, 0, 28, 124, 40337 }, // ź
-    { 20, 33, 21, 0, 32, 165, 40461 }, // Ż
-    { 17, 27, 18, 0, 26, 115, 40626 }, // ż
-    { 20, 33, 21, 0, 32, 165, 40741 }, // Ž
-    { 17, 29, 18, 0, 28, 124, 40906 }, // ž
-    { 17, 26, 18, 0, 26, 111, 41030 }, // ſ
-    { 25, 29, 27, 1, 28, 182, 41141 }, // Ơ
-    { 19, 23, 21, 1, 22, 110, 41323 }, // ơ
-    { 23, 24, 24, 0, 24, 138, 41433 }, // Ƥ
-    { 20, 34, 21, 0, 26, 170, 41571 }, // ƥ
-    { 15, 30, 15, -1, 22, 113, 41741 }, // ƫ
-    { 23, 23, 24, 0, 23, 133, 41854 }, // Ƭ
-    { 17, 27, 17, -1, 26, 115, 41987 }, // ƭ
-    { 23, 30, 24, 0, 23, 173, 42102 }, // Ʈ
-    { 28, 29, 29, 0, 28, 203, 42275 }, // Ư
-    { 22, 23, 23, 0, 22, 127, 42478 }, // ư
-    { 7, 9, 3, -5, 28, 16, 42605 }, // ̀
-    { 6, 9, 5, -2, 28, 14, 42621 }, // ́
-    { 12, 8, 7, -6, 27, 24, 42635 }, // ̂
-    { 12, 6, 7, -6, 26, 18, 42659 }, // ̃
-    { 12, 4, 7, -6, 24, 12, 42677 }, // ̄
-    { 12, 6, 7, -6, 26, 18, 42689 }, // ̆
-    { 6, 6, 4, -3, 26, 9, 42707 }, // ̇
-    { 12, 6, 7, -6, 26, 18, 42716 }, // ̈
-    { 10, 10, 6, -5, 29, 25, 42734 }, // ̉
-    { 10, 9, 6, -5, 28, 23, 42759 }, // ̊
-    { 11, 9, 8, -4, 28, 25, 42782 }, // ̋
-    { 12, 8, 7, -6, 28, 24, 42807 }, // ̌
-    { 11, 9, 5, -7, 28, 25, 42831 }, // ̏
-    { 12, 6, 7, -6, 26, 18, 42856 }, // ̑
-    { 6, 10, 4, -3, 29, 15, 42874 }, // ̒
-    { 7, 9, 5, -3, 29, 16, 42889 }, // ̓
-    { 7, 9, 4, -4, 29, 16, 42905 }, // ̔
-    { 5, 9, 4, -2, 29, 12, 42921 }, // ̕
-    { 6, 9, 4, -3, 22, 14, 42933 }, // ̛
-    { 6, 6, 4, -3, -2, 9, 42947 }, // ̣
-    { 12, 5, 7, -6, -3, 15, 42956 }, // ̤
-    { 8, 8, 5, -4, -1, 16, 42971 }, // ̥
-    { 7, 8, 4, -4, -1, 14, 42987 }, // ̦
-    { 8, 8, 5, -4, -1, 16, 43001 }, // ̧
-    { 8, 9, 5, -4, 1, 18, 43017 }, // ̨
-    { 5, 9, 9, 2, -1, 12, 43035 }, // ̩
-    { 12, 7, 7, -6, -2, 21, 43047 }, // ̭
-    { 12, 6, 7, -6, -2, 18, 43068 }, // ̮
-    { 12, 7, 7, -6, -2, 21, 43086 }, // ̰
-    { 12, 4, 7, -6, -3, 12, 43107 }, // ̱
-    { 12, 6, 7, -6, 26, 18, 43119 }, // ͂
-    { 12, 14, 7, -6, 34, 42, 43137 }, // ̈́
-    { 7, 7, 5, -3, -2, 13, 43179 }, // ͅ
-    { 26, 24, 27, 0, 24, 156, 43192 }, // Α
-    { 20, 25, 22, 1, 24, 125, 43348 }, // Β
-    { 19, 23, 21, 1, 23, 110, 43473 }, // Γ
-    { 22, 24, 23, 0, 24, 132, 43583 }, // Δ
-    { 20, 23, 22, 1, 23, 115, 43715 }, // Ε
-    { 20, 24, 21, 0, 23, 120, 43830 }, // Ζ
-    { 27, 23, 29, 1, 23, 156, 43950 }, // Η
-    { 24, 25, 26, 1, 24, 150, 44106 }, // Θ
-    { 12, 23, 14, 1, 23, 69, 44256 }, // Ι
-    { 24, 24, 26, 1, 23, 144, 44325 }, // Κ
-    { 25, 24, 26, 0, 24, 150, 44469 }, // Λ
-    { 31, 23, 32, 0, 23, 179, 44619 }, // Μ
-    { 27, 24, 28, 0, 23, 162, 44798 }, // Ν
-    { 20, 23, 22, 1, 23, 115, 44960 }, // Ξ
-    { 24, 25, 26, 1, 24, 150, 45075 }, // Ο
-    { 26, 23, 28, 1, 23, 150, 45225 }, // Π
-    { 19, 24, 21, 1, 24, 114, 45375 }, // Ρ
-    { 20, 24, 21, 0, 23, 120, 45489 }, // Σ
-    { 23, 23, 24, 0, 23, 133, 45609 }, // Τ
-    { 23, 24, 24, 0, 24, 138, 45742 }, // Υ
-    { 25, 25, 27, 1, 24, 157, 45880 }, // Φ
-    { 25, 23, 26, 0, 23, 144, 46037 }, // Χ
-    { 28, 24, 29, 0, 24, 168, 46181 }, // Ψ
-    { 27, 24, 29, 1, 24, 162, 46349 }, // Ω
-    { 21, 19, 23, 1, 18, 100, 46511 }, // α
-    { 19, 34, 21, 1, 26, 162, 46611 }, // β
-    { 20, 26, 20, -1, 18, 130, 46773 }, // γ
-    { 18, 27, 20, 1, 26, 122, 46903 }, // δ
-    { 15, 19, 17, 1, 18, 72, 47025 }, // ε
-    { 15, 34, 17, 1, 27, 128, 47097 }, // ζ
-    { 20, 26, 21, -1, 18, 130, 47225 }, // η
-    { 18, 27, 20, 1, 26, 122, 47355 }, // θ
-    { 10, 19, 13, 2, 18, 48, 47477 }, // ι
-    { 18, 19, 21, 2, 18, 86, 47525 }, // κ
-    { 22, 27, 22, -1, 26, 149, 47611 }, // λ
-    { 22, 26, 24, 1, 18, 143, 47760 }, // μ
-    { 20, 19, 20, -1, 18, 95, 47903 }, // ν
-    { 15, 34, 17, 1, 27, 128, 47998 }, // ξ
-    { 18, 19, 20, 1, 18, 86, 48126 }, // ο
-    { 23, 19, 24, 0, 18, 110, 48212 }, // π
-    { 18, 26, 20, 1, 18, 117, 48322 }, // ρ
-    { 15, 25, 17, 1, 18, 94, 48439 }, // ς
-    { 20, 19, 22, 1, 18, 95, 48533 }, // σ
-    { 18, 19, 19, 0, 18, 86, 48628 }, // τ
-    { 20, 19, 20, -1, 18, 95, 48714 }, // υ
-    { 25, 32, 27, 1, 24, 200, 48809 }, // φ
-    { 21, 26, 21, -1, 18, 137, 49009 }, // χ
-    { 27, 32, 27, -1, 24, 216, 49146 }, // ψ
-    { 24, 19, 26, 1, 18, 114, 49362 }, // ω
-    { 26, 32, 27, 0, 24, 208, 49476 }, // Ạ
-    { 18, 26, 20, 1, 18, 117, 49684 }, // ạ
-    { 26, 34, 27, 0, 34, 221, 49801 }, // Ả
-    { 18, 30, 20, 1, 29, 135, 50022 }, // ả
-    { 26, 35, 27, 0, 35, 228, 50157 }, // Ấ
-    { 18, 34, 20, 1, 33, 153, 50385 }, // ấ
-    { 26, 35, 27, 0, 35, 228, 50538 }, // Ầ
-    { 18, 34, 20, 1, 33, 153, 50766 }, // ầ
-    { 26, 35, 27, 0, 35, 228, 50919 }, // Ẩ
-    { 18, 34, 20, 1, 33, 153, 51147 }, // ẩ
-    { 26, 35, 27, 0, 35, 228, 51300 }, // Ẫ
-    { 18, 33, 20, 1, 32, 149, 51528 }, // ẫ
-    { 26, 40, 27, 0, 32, 260, 51677 }, // Ậ
-    { 18, 35, 20, 1, 27, 158, 51937 }, // ậ
-    { 26, 35, 27, 0, 35, 228, 52095 }, // Ắ
-    { 18, 33, 20, 1, 32, 149, 52323 }, // ắ
-    { 26, 35, 27, 0, 35, 228, 52472 }, // Ằ
-    { 18, 33, 20, 1, 32, 149, 52700 }, // ằ
-    { 26, 35, 27, 0, 35, 228, 52849 }, // Ẳ
-    { 18, 34, 20, 1, 33, 153, 53077 }, // ẳ
-    { 26, 35, 27, 0, 35, 228, 53230 }, // Ẵ
-    { 18, 33, 20, 1, 32, 149, 53458 }, // ẵ
-    { 26, 40, 27, 0, 32, 260, 53607 }, // Ặ
-    { 18, 34, 20, 1, 26, 153, 53867 }, // ặ
-    { 20, 31, 22, 1, 23, 155, 54020 }, // Ẹ
-    { 16, 26, 18, 1, 18, 104, 54175 }, // ẹ
-    { 20, 34, 22, 1, 34, 170, 54279 }, // Ẻ
-    { 16, 30, 18, 1, 29, 120, 54449 }, // ẻ
-    { 20, 32, 22, 1, 32, 160, 54569 }, // Ẽ
-    { 16, 27, 18, 1, 26, 108, 54729 }, // ẽ
-    { 20, 35, 22, 1, 35, 175, 54837 }, // Ế
-    { 18, 34, 20, 1, 33, 153, 55012 }, // ế
-    { 20, 35, 22, 1, 35, 175, 55165 }, // Ề
-    { 16, 34, 18, 1, 33, 136, 55340 }, // ề
-    { 20, 35, 22, 1, 35, 175, 55476 }, // Ể
-    { 19, 34, 21, 1, 33, 162, 55651 }, // ể
-    { 20, 35, 22, 1, 35, 175, 55813 }, // Ễ
-    { 16, 33, 18, 1, 32, 132, 55988 }, // ễ
-    { 20, 40, 22, 1, 32, 200, 56120 }, // Ệ
-    { 16, 35, 18, 1, 27, 140, 56320 }, // ệ
-    { 12, 34, 14, 1, 34, 102, 56460 }, // Ỉ
-    { 12, 29, 13, 0, 29, 87, 56562 }, // ỉ
-    { 12, 31, 14, 1, 23, 93, 56649 }, // Ị
-    { 12, 34, 13, 0, 26, 102, 56742 }, // ị
-    { 24, 32, 26, 1, 24, 192, 56844 }, // Ọ
-    { 18, 26, 20, 1, 18, 117, 57036 }, // ọ
-    { 24, 35, 26, 1, 34, 210, 57153 }, // Ỏ
-    { 18, 30, 20, 1, 29, 135, 57363 }, // ỏ
-    { 24, 36, 26, 1, 35, 216, 57498 }, // Ố
-    { 18, 34, 20, 1, 33, 153, 57714 }, // ố
-    { 24, 36, 26, 1, 35, 216, 57867 }, // Ồ
-    { 18, 34, 20, 1, 33, 153, 58083 }, // ồ
-    { 24, 36, 26, 1, 35, 216, 58236 }, // Ổ
-    { 19, 34, 21, 1, 33, 162, 58452 }, // ổ
-    { 24, 36, 26, 1, 35, 216, 58614 }, // Ỗ
-    { 18, 33, 20, 1, 32, 149, 58830 }, // ỗ
-    { 24, 40, 26, 1, 32, 240, 58979 }, // Ộ
-    { 18, 35, 20, 1, 27, 158, 59219 }, // ộ
-    { 25, 33, 27, 1, 32, 207, 59377 }, // Ớ
-    { 19, 29, 21, 1, 28, 138, 59584 }, // ớ
-    { 25, 33, 27, 1, 32, 207, 59722 }, // Ờ
-    { 19, 29, 21, 1, 28, 138, 59929 }, // ờ
-    { 25, 35, 27, 1, 34, 219, 60067 }, // Ở
-    { 19, 30, 21, 1, 29, 143, 60286 }, // ở
-    { 25, 33, 27, 1, 32, 207, 60429 }, // Ỡ
-    { 19, 27, 21, 1, 26, 129, 60636 }, // ỡ
-    { 25, 36, 27, 1, 28, 225, 60765 }, // Ợ
-    { 19, 30, 21, 1, 22, 143, 60990 }, // ợ
-    { 26, 31, 27, 0, 23, 202, 61133 }, // Ụ
-    { 22, 26, 23, 0, 18, 143, 61335 }, // ụ
-    { 26, 35, 27, 0, 34, 228, 61478 }, // Ủ
-    { 22, 30, 23, 0, 29, 165, 61706 }, // ủ
-    { 28, 33, 29, 0, 32, 231, 61871 }, // Ứ
-    { 22, 29, 23, 0, 28, 160, 62102 }, // ứ
-    { 28, 33, 29, 0, 32, 231, 62262 }, // Ừ
-    { 22, 29, 23, 0, 28, 160, 62493 }, // ừ
-    { 28, 35, 29, 0, 34, 245, 62653 }, // Ử
-    { 22, 30, 23, 0, 29, 165, 62898 }, // ử
-    { 28, 33, 29, 0, 32, 231, 63063 }, // Ữ
-    { 22, 27, 23, 0, 26, 149, 63294 }, // ữ
-    { 28, 36, 29, 0, 28, 252, 63443 }, // Ự
-    { 22, 30, 23, 0, 22, 165, 63695 }, // ự
-    { 24, 32, 25, 0, 32, 192, 63860 }, // Ỳ
-    { 22, 36, 23, 0, 28, 198, 64052 }, // ỳ
-    { 24, 31, 25, 0, 23, 186, 64250 }, // Ỵ
-    { 22, 26, 23, 0, 18, 143, 64436 }, // ỵ
-    { 24, 34, 25, 0, 34, 204, 64579 }, // Ỷ
-    { 22, 37, 23, 0, 29, 204, 64783 }, // ỷ
-    { 24, 32, 25, 0, 32, 192, 64987 }, // Ỹ
-    { 22, 34, 23, 0, 26, 187, 65179 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 65366 }, //  
-    { 0, 0, 33, 0, 0, 0, 65366 }, //  
-    { 0, 0, 17, 0, 0, 0, 65366 }, //  
-    { 0, 0, 33, 0, 0, 0, 65366 }, //  
-    { 0, 0, 11, 0, 0, 0, 65366 }, //  
-    { 0, 0, 8, 0, 0, 0, 65366 }, //  
-    { 0, 0, 5, 0, 0, 0, 65366 }, //  
-    { 0, 0, 21, 0, 0, 0, 65366 }, //  
-    { 0, 0, 10, 0, 0, 0, 65366 }, //  
-    { 0, 0, 7, 0, 0, 0, 65366 }, //  
-    { 0, 0, 2, 0, 0, 0, 65366 }, //  
-    { 0, 0, 1, 0, 0, 0, 65366 }, // ​
-    { 2, 28, 2, -1, 20, 14, 65366 }, // ‌
-    { 8, 30, 5, -4, 22, 60, 65380 }, // ‍
-    { 12, 31, 7, -6, 23, 93, 65440 }, // ‎
-    { 12, 31, 7, -6, 23, 93, 65533 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 65626 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 65640 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 65654 }, // ‒
-    { 17, 5, 18, 0, 11, 22, 65671 }, // –
-    { 33, 5, 34, 0, 11, 42, 65693 }, // —
-    { 33, 5, 34, 0, 11, 42, 65735 }, // ―
-    { 12, 34, 17, 2, 26, 102, 65777 }, // ‖
-    { 17, 9, 18, 0, -1, 39, 65879 }, // ‗
-    { 7, 11, 9, 1, 25, 20, 65918 }, // ‘
-    { 7, 11, 8, 0, 25, 20, 65938 }, // ’
-    { 7, 11, 8, 0, 5, 20, 65958 }, // ‚
-    { 7, 11, 9, 1, 25, 20, 65978 }, // ‛
-    { 13, 11, 15, 1, 25, 36, 65998 }, // “
-    { 14, 11, 15, 0, 25, 39, 66034 }, // ”
-    { 14, 11, 15, 0, 5, 39, 66073 }, // „
-    { 13, 11, 15, 1, 25, 36, 66112 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 66148 }, // †
-    { 15, 26, 17, 1, 24, 98, 66231 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 66329 }, // •
-    { 12, 12, 21, 4, 17, 36, 66345 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 66381 }, // ․
-    { 15, 6, 17, 1, 5, 23, 66392 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 66415 }, // …
-    { 7, 6, 10, 1, 12, 11, 66459 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 66470 }, //  
-    { 0, 0, 1, 0, 0, 0, 66470 }, //  
-    { 12, 31, 7, -6, 23, 93, 66470 }, // ‪
-    { 12, 31, 7, -6, 23, 93, 66563 }, // ‫
-    { 10, 31, 6, -5, 23, 78, 66656 }, // ‬
-    { 14, 31, 8, -7, 23, 109, 66734 }, // ‭
-    { 14, 31, 8, -7, 23, 109, 66843 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 66952 }, //  
-    { 44, 27, 46, 1, 25, 297, 66952 }, // ‰
-    { 9, 11, 10, 0, 23, 25, 67249 }, // ′
-    { 16, 11, 17, 0, 23, 44, 67274 }, // ″
-    { 23, 11, 24, 0, 23, 64, 67318 }, // ‴
-    { 9, 11, 10, 0, 23, 25, 67382 }, // ‵
-    { 15, 11, 17, 1, 23, 42, 67407 }, // ‶
-    { 22, 11, 24, 1, 23, 61, 67449 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 67510 }, // ‸
-    { 9, 13, 11, 1, 15, 30, 67535 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 67565 }, // ›
-    { 21, 23, 22, 0, 22, 121, 67595 }, // ※
-    { 16, 26, 19, 2, 25, 104, 67716 }, // ‼
-    { 17, 4, 18, 0, 28, 17, 67820 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 67837 }, // ⁃
-    { 18, 28, 13, -6, 25, 126, 67847 }, // ⁄
-    { 28, 26, 31, 2, 25, 182, 67973 }, // ⁇
-    { 23, 26, 26, 2, 25, 150, 68155 }, // ⁈
-    { 22, 26, 25, 2, 25, 143, 68305 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 68448 }, // ⁓
-    { 30, 11, 31, 0, 23, 83, 68483 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 68566 }, //  
-    { 0, 0, 1, 0, 0, 0, 68566 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 68566 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 68566 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 68566 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 68566 }, // ⁤
-    { 15, 17, 16, 0, 28, 64, 68566 }, // ⁰
-    { 14, 17, 15, 0, 28, 60, 68630 }, // ⁴
-    { 11, 16, 15, 2, 27, 44, 68690 }, // ⁵
-    { 13, 17, 15, 1, 28, 56, 68734 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 68790 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 68838 }, // ⁸
-    { 13, 17, 15, 1, 28, 56, 68894 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 68950 }, // ⁿ
-    { 15, 16, 16, 0, 11, 60, 68992 }, // ₀
-    { 11, 16, 15, 2, 11, 44, 69052 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 69096 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 69148 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 69196 }, // ₄
-    { 11, 16, 15, 2, 11, 44, 69252 }, // ₅
-    { 13, 16, 15, 1, 11, 52, 69296 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 69348 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 69396 }, // ₈
-    { 13, 16, 15, 1, 11, 52, 69448 }, // ₉
-    { 19, 23, 21, 1, 23, 110, 69500 }, // ₣
-    { 20, 24, 21, 0, 23, 120, 69610 }, // ₤
-    { 44, 24, 45, 0, 23, 264, 69730 }, // ₧
-    { 21, 24, 22, 0, 23, 126, 69994 }, // €
-    { 21, 15, 33, 6, 19, 79, 70120 }, // ←
-    { 15, 21, 33, 9, 22, 79, 70199 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 70278 }, // →
-    { 15, 21, 33, 9, 22, 79, 70357 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 70436 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 70515 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 70602 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 70689 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 70776 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 70863 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 70949 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 71049 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 71149 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 71249 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 71349 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 71439 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 71577 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 71699 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 71797 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 71966 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 72098 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 72224 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 72357 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 72524 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 72639 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 72772 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 72939 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 73054 }, // ∏
-    { 21, 29, 23, 1, 23, 153, 73243 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 73396 }, // −
-    { 16, 26, 18, 1, 24, 104, 73411 }, // ∕
-    { 16, 26, 18, 1, 24, 104, 73515 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 73619 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 73683 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 73722 }, // ∙
-    { 22, 31, 22, -1, 27, 171, 73733 }, // √
-    { 17, 13, 21, 2, 17, 56, 73904 }, // ∝
-    { 21, 13, 22, 0, 17, 69, 73960 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 74029 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 74150 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 74294 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 74337 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 74439 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 74572 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 74705 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 74819 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 74933 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 75095 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 75210 }, // ∵
-    { 7, 19, 10, 2, 21, 34, 75325 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 75359 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 75474 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 75509 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 75599 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 75659 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 75721 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 75781 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 75857 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 75932 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 76011 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 76119 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 76227 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 76342 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 76509 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 76676 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 76797 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 76918 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 77075 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 77232 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 77389 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 77546 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 77656 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 77667 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 77711 }, // �
+    { 7, 26, 10, 2, 25, 42, 0 }, // !
+    { 12, 12, 14, 1, 24, 34, 42 }, // "
+    { 21, 21, 22, 0, 19, 85, 76 }, // #
+    { 17, 34, 21, 2, 27, 102, 161 }, // $
+    { 30, 27, 32, 1, 25, 141, 263 }, // %
+    { 25, 26, 27, 1, 25, 108, 404 }, // &
+    { 6, 12, 8, 1, 24, 19, 512 }, // '
+    { 11, 33, 13, 1, 27, 51, 531 }, // (
+    { 12, 33, 13, 0, 27, 49, 582 }, // )
+    { 13, 12, 14, 0, 25, 31, 631 }, // *
+    { 15, 16, 21, 3, 19, 41, 662 }, // +
+    { 9, 12, 10, 0, 5, 19, 703 }, // ,
+    { 11, 5, 13, 1, 11, 17, 722 }, // -
+    { 7, 6, 10, 1, 5, 13, 739 }, // .
+    { 16, 26, 18, 1, 24, 54, 752 }, // /
+    { 19, 24, 21, 1, 23, 84, 806 }, // 0
+    { 15, 23, 21, 3, 23, 60, 890 }, // 1
+    { 18, 23, 21, 1, 23, 70, 950 }, // 2
+    { 17, 24, 21, 2, 23, 70, 1020 }, // 3
+    { 20, 24, 21, 0, 23, 70, 1090 }, // 4
+    { 17, 24, 21, 1, 23, 67, 1160 }, // 5
+    { 18, 24, 21, 1, 23, 75, 1227 }, // 6
+    { 17, 24, 21, 2, 23, 69, 1302 }, // 7
+    { 18, 24, 21, 1, 23, 80, 1371 }, // 8
+    { 18, 24, 21, 1, 23, 77, 1451 }, // 9
+    { 7, 19, 10, 1, 18, 25, 1528 }, // :
+    { 9, 25, 10, 0, 18, 32, 1553 }, // ;
+    { 15, 16, 21, 3, 19, 38, 1585 }, // <
+    { 15, 10, 21, 3, 16, 42, 1623 }, // =
+    { 15, 16, 21, 3, 19, 40, 1665 }, // >
+    { 13, 26, 16, 2, 25, 55, 1705 }, // ?
+    { 31, 30, 33, 1, 23, 151, 1760 }, // @
+    { 26, 24, 27, 0, 24, 93, 1911 }, // A
+    { 20, 25, 22, 1, 24, 81, 2004 }, // B
+    { 20, 25, 22, 1, 24, 78, 2085 }, // C
+    { 24, 25, 26, 1, 24, 97, 2163 }, // D
+    { 20, 23, 22, 1, 23, 79, 2260 }, // E
+    { 18, 23, 20, 1, 23, 71, 2339 }, // F
+    { 23, 25, 25, 1, 24, 95, 2410 }, // G
+    { 27, 23, 29, 1, 23, 96, 2505 }, // H
+    { 12, 23, 14, 1, 23, 49, 2601 }, // I
+    { 15, 30, 14, -2, 23, 73, 2650 }, // J
+    { 24, 24, 26, 1, 23, 96, 2723 }, // K
+    { 20, 23, 22, 1, 23, 69, 2819 }, // L
+    { 31, 23, 32, 0, 23, 121, 2888 }, // M
+    { 27, 24, 28, 0, 23, 102, 3009 }, // N
+    { 24, 25, 26, 1, 24, 106, 3111 }, // O
+    { 19, 24, 21, 1, 24, 79, 3217 }, // P
+    { 25, 32, 27, 1, 24, 130, 3296 }, // Q
+    { 23, 25, 25, 1, 24, 91, 3426 }, // R
+    { 17, 25, 19, 1, 24, 79, 3517 }, // S
+    { 23, 23, 24, 0, 23, 87, 3596 }, // T
+    { 26, 24, 27, 0, 23, 100, 3683 }, // U
+    { 26, 24, 27, 0, 23, 87, 3783 }, // V
+    { 37, 24, 38, 0, 23, 137, 3870 }, // W
+    { 25, 23, 26, 0, 23, 91, 4007 }, // X
+    { 24, 23, 25, 0, 23, 80, 4098 }, // Y
+    { 20, 24, 21, 0, 23, 78, 4178 }, // Z
+    { 8, 32, 11, 2, 26, 35, 4256 }, // [
+    { 16, 26, 18, 1, 24, 54, 4291 }, // <backslash>
+    { 9, 32, 11, 1, 26, 38, 4345 }, // ]
+    { 17, 17, 21, 2, 22, 44, 4383 }, // ^
+    { 17, 4, 18, 0, -1, 22, 4427 }, // _
+    { 8, 9, 22, 7, 28, 14, 4449 }, // `
+    { 18, 19, 20, 1, 18, 66, 4463 }, // a
+    { 21, 27, 21, -1, 26, 82, 4529 }, // b
+    { 15, 19, 17, 1, 18, 57, 4611 }, // c
+    { 20, 27, 22, 1, 26, 98, 4668 }, // d
+    { 16, 19, 18, 1, 18, 63, 4766 }, // e
+    { 18, 26, 19, 0, 26, 69, 4829 }, // f
+    { 20, 26, 21, 0, 18, 93, 4898 }, // g
+    { 22, 26, 23, 0, 26, 91, 4991 }, // h
+    { 12, 26, 13, 0, 26, 53, 5082 }, // i
+    { 12, 34, 10, -3, 26, 61, 5135 }, // j
+    { 21, 27, 22, 0, 26, 85, 5196 }, // k
+    { 11, 26, 12, 0, 26, 55, 5281 }, // l
+    { 33, 18, 34, 0, 18, 110, 5336 }, // m
+    { 22, 18, 23, 0, 18, 77, 5446 }, // n
+    { 18, 19, 20, 1, 18, 66, 5523 }, // o
+    { 20, 26, 21, 0, 18, 90, 5589 }, // p
+    { 19, 26, 21, 1, 18, 94, 5679 }, // q
+    { 16, 18, 17, 0, 18, 51, 5773 }, // r
+    { 15, 19, 17, 1, 18, 59, 5824 }, // s
+    { 15, 23, 15, -1, 22, 57, 5883 }, // t
+    { 22, 19, 23, 0, 18, 74, 5940 }, // u
+    { 22, 19, 23, 0, 18, 61, 6014 }, // v
+    { 30, 19, 31, 0, 18, 92, 6075 }, // w
+    { 21, 18, 22, 0, 18, 62, 6167 }, // x
+    { 22, 26, 23, 0, 18, 81, 6229 }, // y
+    { 17, 19, 18, 0, 18, 55, 6310 }, // z
+    { 11, 33, 14, 2, 27, 56, 6365 }, // {
+    { 5, 30, 10, 3, 26, 30, 6421 }, // |
+    { 12, 33, 13, 0, 27, 55, 6451 }, // }
+    { 17, 8, 21, 2, 15, 25, 6506 }, // ~
+    { 0, 0, 7, 0, 0, 0, 6531 }, //  
+    { 7, 26, 10, 1, 18, 41, 6531 }, // ¡
+    { 18, 33, 21, 1, 26, 84, 6572 }, // ¢
+    { 20, 24, 21, 0, 23, 77, 6656 }, // £
+    { 19, 16, 21, 1, 19, 53, 6733 }, // ¤
+    { 23, 23, 23, -1, 23, 91, 6786 }, // ¥
+    { 5, 30, 10, 3, 26, 29, 6877 }, // ¦
+    { 15, 26, 17, 1, 23, 80, 6906 }, // §
+    { 13, 6, 22, 5, 26, 16, 6986 }, // ¨
+    { 25, 25, 26, 0, 24, 118, 7002 }, // ©
+    { 13, 17, 15, 1, 24, 44, 7120 }, // ª
+    { 18, 13, 20, 1, 15, 45, 7164 }, // «
+    { 15, 9, 21, 3, 16, 20, 7209 }, // ¬
+    { 11, 5, 13, 1, 11, 17, 7229 }, // ­
+    { 19, 18, 20, 0, 26, 85, 7246 }, // ®
+    { 12, 4, 22, 5, 24, 17, 7331 }, // ¯
+    { 13, 12, 17, 2, 23, 34, 7348 }, // °
+    { 15, 21, 21, 3, 20, 52, 7382 }, // ±
+    { 13, 16, 15, 1, 28, 40, 7434 }, // ²
+    { 12, 17, 15, 1, 28, 40, 7474 }, // ³
+    { 7, 9, 22, 8, 28, 13, 7514 }, // ´
+    { 22, 26, 24, 1, 18, 93, 7527 }, // µ
+    { 19, 28, 20, 0, 23, 104, 7620 }, // ¶
+    { 7, 6, 10, 1, 12, 13, 7724 }, // ·
+    { 7, 8, 22, 8, -1, 15, 7737 }, // ¸
+    { 11, 16, 15, 2, 28, 33, 7752 }, // ¹
+    { 13, 17, 15, 1, 24, 46, 7785 }, // º
+    { 18, 13, 20, 1, 15, 45, 7831 }, // »
+    { 33, 28, 36, 2, 25, 127, 7876 }, // ¼
+    { 33, 28, 36, 2, 25, 125, 8003 }, // ½
+    { 34, 28, 36, 1, 25, 135, 8128 }, // ¾
+    { 14, 25, 16, 1, 18, 56, 8263 }, // ¿
+    { 26, 32, 27, 0, 32, 115, 8319 }, // À
+    { 26, 32, 27, 0, 32, 115, 8434 }, // Á
+    { 26, 32, 27, 0, 32, 118, 8549 }, // Â
+    { 26, 32, 27, 0, 32, 118, 8667 }, // Ã
+    { 26, 31, 27, 0, 31, 115, 8785 }, // Ä
+    { 26, 33, 27, 0, 33, 125, 8900 }, // Å
+    { 33, 23, 33, -1, 23, 118, 9025 }, // Æ
+    { 20, 33, 22, 1, 24, 97, 9143 }, // Ç
+    { 20, 32, 22, 1, 32, 98, 9240 }, // È
+    { 20, 32, 22, 1, 32, 99, 9338 }, // É
+    { 20, 32, 22, 1, 32, 104, 9437 }, // Ê
+    { 20, 31, 22, 1, 31, 99, 9541 }, // Ë
+    { 12, 32, 14, 1, 32, 64, 9640 }, // Ì
+    { 12, 32, 14, 1, 32, 63, 9704 }, // Í
+    { 13, 32, 14, 0, 32, 69, 9767 }, // Î
+    { 14, 31, 15, 0, 31, 71, 9836 }, // Ï
+    { 25, 25, 26, 0, 24, 103, 9907 }, // Ð
+    { 27, 33, 28, 0, 32, 128, 10010 }, // Ñ
+    { 24, 33, 26, 1, 32, 126, 10138 }, // Ò
+    { 24, 33, 26, 1, 32, 126, 10264 }, // Ó
+    { 24, 33, 26, 1, 32, 129, 10390 }, // Ô
+    { 24, 33, 26, 1, 32, 129, 10519 }, // Õ
+    { 24, 32, 26, 1, 31, 128, 10648 }, // Ö
+    { 15, 15, 21, 3, 19, 40, 10776 }, // ×
+    { 26, 25, 27, 0, 24, 124, 10816 }, // Ø
+    { 26, 33, 27, 0, 32, 123, 10940 }, // Ù
+    { 26, 33, 27, 0, 32, 123, 11063 }, // Ú
+    { 26, 33, 27, 0, 32, 127, 11186 }, // Û
+    { 26, 32, 27, 0, 31, 124, 11313 }, // Ü
+    { 24, 32, 25, 0, 32, 103, 11437 }, // Ý
+    { 20, 23, 22, 1, 23, 81, 11540 }, // Þ
+    { 21, 27, 22, 0, 26, 100, 11621 }, // ß
+    { 18, 29, 20, 1, 28, 84, 11721 }, // à
+    { 18, 29, 20, 1, 28, 85, 11805 }, // á
+    { 18, 28, 20, 1, 27, 87, 11890 }, // â
+    { 18, 27, 20, 1, 26, 86, 11977 }, // ã
+    { 18, 27, 20, 1, 26, 85, 12063 }, // ä
+    { 18, 29, 20, 1, 28, 96, 12148 }, // å
+    { 26, 19, 28, 1, 18, 96, 12244 }, // æ
+    { 15, 27, 17, 1, 18, 74, 12340 }, // ç
+    { 16, 29, 18, 1, 28, 81, 12414 }, // è
+    { 16, 29, 18, 1, 28, 81, 12495 }, // é
+    { 16, 28, 18, 1, 27, 84, 12576 }, // ê
+    { 16, 27, 18, 1, 26, 81, 12660 }, // ë
+    { 12, 28, 13, 0, 28, 55, 12741 }, // ì
+    { 12, 28, 13, 0, 28, 55, 12796 }, // í
+    { 12, 27, 13, 0, 27, 58, 12851 }, // î
+    { 12, 26, 13, 0, 26, 56, 12909 }, // ï
+    { 18, 28, 20, 1, 27, 89, 12965 }, // ð
+    { 22, 26, 23, 0, 26, 100, 13054 }, // ñ
+    { 18, 29, 20, 1, 28, 85, 13154 }, // ò
+    { 18, 29, 20, 1, 28, 85, 13239 }, // ó
+    { 18, 28, 20, 1, 27, 88, 13324 }, // ô
+    { 18, 27, 20, 1, 26, 86, 13412 }, // õ
+    { 18, 27, 20, 1, 26, 86, 13498 }, // ö
+    { 15, 16, 21, 3, 19, 43, 13584 }, // ÷
+    { 20, 19, 21, 0, 18, 83, 13627 }, // ø
+    { 22, 29, 23, 0, 28, 96, 13710 }, // ù
+    { 22, 29, 23, 0, 28, 95, 13806 }, // ú
+    { 22, 28, 23, 0, 27, 98, 13901 }, // û
+    { 22, 27, 23, 0, 26, 95, 13999 }, // ü
+    { 22, 36, 23, 0, 28, 103, 14094 }, // ý
+    { 20, 34, 21, 0, 26, 103, 14197 }, // þ
+    { 22, 34, 23, 0, 26, 103, 14300 }, // ÿ
+    { 26, 30, 27, 0, 30, 115, 14403 }, // Ā
+    { 18, 25, 20, 1, 24, 85, 14518 }, // ā
+    { 26, 32, 27, 0, 32, 117, 14603 }, // Ă
+    { 18, 27, 20, 1, 26, 86, 14720 }, // ă
+    { 26, 32, 27, 0, 24, 115, 14806 }, // Ą
+    { 18, 26, 20, 1, 18, 80, 14921 }, // ą
+    { 20, 33, 22, 1, 32, 95, 15001 }, // Ć
+    { 15, 29, 17, 1, 28, 76, 15096 }, // ć
+    { 20, 33, 22, 1, 32, 103, 15172 }, // Ĉ
+    { 15, 28, 17, 1, 27, 78, 15275 }, // ĉ
+    { 20, 33, 22, 1, 32, 93, 15353 }, // Ċ
+    { 15, 27, 17, 1, 26, 72, 15446 }, // ċ
+    { 20, 33, 22, 1, 32, 102, 15518 }, // Č
+    { 15, 29, 17, 1, 28, 78, 15620 }, // č
+    { 24, 33, 26, 1, 32, 124, 15698 }, // Ď
+    { 23, 27, 25, 1, 26, 109, 15822 }, // ď
+    { 25, 25, 26, 0, 24, 103, 15931 }, // Đ
+    { 20, 27, 22, 1, 26, 103, 16034 }, // đ
+    { 20, 30, 22, 1, 30, 101, 16137 }, // Ē
+    { 16, 25, 18, 1, 24, 81, 16238 }, // ē
+    { 20, 32, 22, 1, 32, 102, 16319 }, // Ĕ
+    { 16, 27, 18, 1, 26, 79, 16421 }, // ĕ
+    { 20, 32, 22, 1, 32, 96, 16500 }, // Ė
+    { 16, 27, 18, 1, 26, 77, 16596 }, // ė
+    { 20, 31, 22, 1, 23, 97, 16673 }, // Ę
+    { 16, 26, 18, 1, 18, 78, 16770 }, // ę
+    { 20, 32, 22, 1, 32, 101, 16848 }, // Ě
+    { 16, 29, 18, 1, 28, 86, 16949 }, // ě
+    { 23, 33, 25, 1, 32, 120, 17035 }, // Ĝ
+    { 20, 35, 21, 0, 27, 117, 17155 }, // ĝ
+    { 23, 33, 25, 1, 32, 118, 17272 }, // Ğ
+    { 20, 34, 21, 0, 26, 111, 17390 }, // ğ
+    { 23, 33, 25, 1, 32, 113, 17501 }, // Ġ
+    { 20, 34, 21, 0, 26, 110, 17614 }, // ġ
+    { 23, 33, 25, 1, 24, 116, 17724 }, // Ģ
+    { 20, 37, 21, 0, 29, 115, 17840 }, // ģ
+    { 27, 32, 29, 1, 32, 123, 17955 }, // Ĥ
+    { 23, 34, 23, -1, 34, 115, 18078 }, // ĥ
+    { 28, 23, 29, 0, 23, 107, 18193 }, // Ħ
+    { 22, 26, 23, 0, 26, 96, 18300 }, // ħ
+    { 12, 32, 14, 1, 32, 66, 18396 }, // Ĩ
+    { 12, 26, 13, 0, 26, 58, 18462 }, // ĩ
+    { 12, 30, 14, 1, 30, 67, 18520 }, // Ī
+    { 12, 24, 13, 0, 24, 58, 18587 }, // ī
+    { 12, 32, 14, 1, 32, 66, 18645 }, // Ĭ
+    { 12, 26, 13, 0, 26, 57, 18711 }, // ĭ
+    { 12, 31, 14, 1, 23, 65, 18768 }, // Į
+    { 12, 34, 13, 0, 26, 66, 18833 }, // į
+    { 12, 32, 14, 1, 32, 61, 18899 }, // İ
+    { 12, 18, 13, 0, 18, 40, 18960 }, // ı
+    { 26, 30, 28, 1, 23, 113, 19000 }, // Ĳ
+    { 21, 34, 22, 0, 26, 116, 19113 }, // ĳ
+    { 15, 39, 14, -2, 32, 96, 19229 }, // Ĵ
+    { 15, 35, 13, -3, 27, 77, 19325 }, // ĵ
+    { 24, 32, 26, 1, 23, 116, 19402 }, // Ķ
+    { 21, 35, 22, 0, 26, 103, 19518 }, // ķ
+    { 22, 19, 23, 0, 18, 78, 19621 }, // ĸ
+    { 20, 32, 22, 1, 32, 89, 19699 }, // Ĺ
+    { 11, 34, 12, 0, 34, 68, 19788 }, // ĺ
+    { 20, 32, 22, 1, 23, 87, 19856 }, // Ļ
+    { 11, 35, 12, 0, 26, 69, 19943 }, // ļ
+    { 20, 26, 22, 1, 26, 83, 20012 }, // Ľ
+    { 15, 26, 16, 0, 26, 75, 20095 }, // ľ
+    { 20, 23, 22, 1, 23, 78, 20170 }, // Ŀ
+    { 18, 26, 19, 0, 26, 75, 20248 }, // ŀ
+    { 22, 23, 22, -1, 23, 78, 20323 }, // Ł
+    { 13, 26, 13, -1, 26, 59, 20401 }, // ł
+    { 27, 33, 28, 0, 32, 124, 20460 }, // Ń
+    { 22, 28, 23, 0, 28, 100, 20584 }, // ń
+    { 27, 32, 28, 0, 23, 123, 20684 }, // Ņ
+    { 22, 27, 23, 0, 18, 99, 20807 }, // ņ
+    { 27, 33, 28, 0, 32, 126, 20906 }, // Ň
+    { 22, 28, 23, 0, 28, 104, 21032 }, // ň
+    { 30, 24, 31, 0, 24, 106, 21136 }, // ŉ
+    { 27, 30, 28, 0, 23, 123, 21242 }, // Ŋ
+    { 20, 26, 22, 0, 18, 97, 21365 }, // ŋ
+    { 24, 31, 26, 1, 30, 127, 21462 }, // Ō
+    { 18, 25, 20, 1, 24, 86, 21589 }, // ō
+    { 24, 33, 26, 1, 32, 128, 21675 }, // Ŏ
+    { 18, 27, 20, 1, 26, 86, 21803 }, // ŏ
+    { 24, 34, 26, 1, 33, 136, 21889 }, // Ő
+    { 18, 29, 20, 1, 28, 93, 22025 }, // ő
+    { 31, 24, 33, 1, 23, 125, 22118 }, // Œ
+    { 28, 19, 30, 1, 18, 107, 22243 }, // œ
+    { 23, 33, 25, 1, 32, 112, 22350 }, // Ŕ
+    { 16, 28, 17, 0, 28, 69, 22462 }, // ŕ
+    { 23, 33, 25, 1, 24, 112, 22531 }, // Ŗ
+    { 16, 27, 17, 0, 18, 70, 22643 }, // ŗ
+    { 23, 33, 25, 1, 32, 118, 22713 }, // Ř
+    { 16, 28, 17, 0, 28, 74, 22831 }, // ř
+    { 17, 33, 19, 1, 32, 96, 22905 }, // Ś
+    { 15, 29, 17, 1, 28, 77, 23001 }, // ś
+    { 17, 33, 19, 1, 32, 98, 23078 }, // Ŝ
+    { 15, 28, 17, 1, 27, 79, 23176 }, // ŝ
+    { 17, 33, 19, 1, 24, 96, 23255 }, // Ş
+    { 15, 27, 17, 1, 18, 76, 23351 }, // ş
+    { 17, 33, 19, 1, 32, 96, 23427 }, // Š
+    { 15, 29, 17, 1, 28, 81, 23523 }, // š
+    { 23, 32, 24, 0, 23, 108, 23604 }, // Ţ
+    { 15, 31, 15, -1, 22, 75, 23712 }, // ţ
+    { 23, 32, 24, 0, 32, 110, 23787 }, // Ť
+    { 15, 28, 15, -1, 27, 68, 23897 }, // ť
+    { 23, 23, 24, 0, 23, 90, 23965 }, // Ŧ
+    { 15, 23, 15, -1, 22, 59, 24055 }, // ŧ
+    { 26, 33, 27, 0, 32, 126, 24114 }, // Ũ
+    { 22, 27, 23, 0, 26, 98, 24240 }, // ũ
+    { 26, 31, 27, 0, 30, 123, 24338 }, // Ū
+    { 22, 25, 23, 0, 24, 95, 24461 }, // ū
+    { 26, 33, 27, 0, 32, 125, 24556 }, // Ŭ
+    { 22, 27, 23, 0, 26, 96, 24681 }, // ŭ
+    { 26, 34, 27, 0, 33, 133, 24777 }, // Ů
+    { 22, 29, 23, 0, 28, 105, 24910 }, // ů
+    { 26, 34, 27, 0, 33, 134, 25015 }, // Ű
+    { 22, 29, 23, 0, 28, 105, 25149 }, // ű
+    { 26, 31, 27, 0, 23, 116, 25254 }, // Ų
+    { 22, 26, 23, 0, 18, 91, 25370 }, // ų
+    { 37, 33, 38, 0, 32, 167, 25461 }, // Ŵ
+    { 30, 28, 31, 0, 27, 119, 25628 }, // ŵ
+    { 24, 32, 25, 0, 32, 108, 25747 }, // Ŷ
+    { 22, 35, 23, 0, 27, 106, 25855 }, // ŷ
+    { 24, 31, 25, 0, 31, 103, 25961 }, // Ÿ
+    { 20, 33, 21, 0, 32, 97, 26064 }, // Ź
+    { 17, 29, 18, 0, 28, 74, 26161 }, // ź
+    { 20, 33, 21, 0, 32, 95, 26235 }, // Ż
+    { 17, 27, 18, 0, 26, 69, 26330 }, // ż
+    { 20, 33, 21, 0, 32, 99, 26399 }, // Ž
+    { 17, 29, 18, 0, 28, 76, 26498 }, // ž
+    { 17, 26, 18, 0, 26, 63, 26574 }, // ſ
+    { 25, 29, 27, 1, 28, 121, 26637 }, // Ơ
+    { 19, 23, 21, 1, 22, 79, 26758 }, // ơ
+    { 23, 24, 24, 0, 24, 91, 26837 }, // Ƥ
+    { 20, 34, 21, 0, 26, 109, 26928 }, // ƥ
+    { 15, 30, 15, -1, 22, 75, 27037 }, // ƫ
+    { 23, 23, 24, 0, 23, 87, 27112 }, // Ƭ
+    { 17, 27, 17, -1, 26, 73, 27199 }, // ƭ
+    { 23, 30, 24, 0, 23, 109, 27272 }, // Ʈ
+    { 28, 29, 29, 0, 28, 116, 27381 }, // Ư
+    { 22, 23, 23, 0, 22, 85, 27497 }, // ư
+    { 7, 9, 3, -5, 28, 13, 27582 }, // ̀
+    { 6, 9, 5, -2, 28, 13, 27595 }, // ́
+    { 12, 8, 7, -6, 27, 18, 27608 }, // ̂
+    { 12, 6, 7, -6, 26, 16, 27626 }, // ̃
+    { 12, 4, 7, -6, 24, 17, 27642 }, // ̄
+    { 12, 6, 7, -6, 26, 16, 27659 }, // ̆
+    { 6, 6, 4, -3, 26, 10, 27675 }, // ̇
+    { 12, 6, 7, -6, 26, 15, 27685 }, // ̈
+    { 10, 10, 6, -5, 29, 22, 27700 }, // ̉
+    { 10, 9, 6, -5, 28, 25, 27722 }, // ̊
+    { 11, 9, 8, -4, 28, 25, 27747 }, // ̋
+    { 12, 8, 7, -6, 28, 18, 27772 }, // ̌
+    { 11, 9, 5, -7, 28, 25, 27790 }, // ̏
+    { 12, 6, 7, -6, 26, 16, 27815 }, // ̑
+    { 6, 10, 4, -3, 29, 15, 27831 }, // ̒
+    { 7, 9, 5, -3, 29, 17, 27846 }, // ̓
+    { 7, 9, 4, -4, 29, 17, 27863 }, // ̔
+    { 5, 9, 4, -2, 29, 14, 27880 }, // ̕
+    { 6, 9, 4, -3, 22, 14, 27894 }, // ̛
+    { 6, 6, 4, -3, -2, 11, 27908 }, // ̣
+    { 12, 5, 7, -6, -3, 16, 27919 }, // ̤
+    { 8, 8, 5, -4, -1, 21, 27935 }, // ̥
+    { 7, 8, 4, -4, -1, 13, 27956 }, // ̦
+    { 8, 8, 5, -4, -1, 15, 27969 }, // ̧
+    { 8, 9, 5, -4, 1, 16, 27984 }, // ̨
+    { 5, 9, 9, 2, -1, 13, 28000 }, // ̩
+    { 12, 7, 7, -6, -2, 18, 28013 }, // ̭
+    { 12, 6, 7, -6, -2, 16, 28031 }, // ̮
+    { 12, 7, 7, -6, -2, 17, 28047 }, // ̰
+    { 12, 4, 7, -6, -3, 17, 28064 }, // ̱
+    { 12, 6, 7, -6, 26, 16, 28081 }, // ͂
+    { 12, 14, 7, -6, 34, 28, 28097 }, // ̈́
+    { 7, 7, 5, -3, -2, 12, 28125 }, // ͅ
+    { 26, 24, 27, 0, 24, 93, 28137 }, // Α
+    { 20, 25, 22, 1, 24, 81, 28230 }, // Β
+    { 19, 23, 21, 1, 23, 67, 28311 }, // Γ
+    { 22, 24, 23, 0, 24, 81, 28378 }, // Δ
+    { 20, 23, 22, 1, 23, 79, 28459 }, // Ε
+    { 20, 24, 21, 0, 23, 78, 28538 }, // Ζ
+    { 27, 23, 29, 1, 23, 96, 28616 }, // Η
+    { 24, 25, 26, 1, 24, 112, 28712 }, // Θ
+    { 12, 23, 14, 1, 23, 49, 28824 }, // Ι
+    { 24, 24, 26, 1, 23, 96, 28873 }, // Κ
+    { 25, 24, 26, 0, 24, 87, 28969 }, // Λ
+    { 31, 23, 32, 0, 23, 121, 29056 }, // Μ
+    { 27, 24, 28, 0, 23, 102, 29177 }, // Ν
+    { 20, 23, 22, 1, 23, 82, 29279 }, // Ξ
+    { 24, 25, 26, 1, 24, 106, 29361 }, // Ο
+    { 26, 23, 28, 1, 23, 99, 29467 }, // Π
+    { 19, 24, 21, 1, 24, 79, 29566 }, // Ρ
+    { 20, 24, 21, 0, 23, 77, 29645 }, // Σ
+    { 23, 23, 24, 0, 23, 87, 29722 }, // Τ
+    { 23, 24, 24, 0, 24, 81, 29809 }, // Υ
+    { 25, 25, 27, 1, 24, 110, 29890 }, // Φ
+    { 25, 23, 26, 0, 23, 91, 30000 }, // Χ
+    { 28, 24, 29, 0, 24, 106, 30091 }, // Ψ
+    { 27, 24, 29, 1, 24, 111, 30197 }, // Ω
+    { 21, 19, 23, 1, 18, 78, 30308 }, // α
+    { 19, 34, 21, 1, 26, 106, 30386 }, // β
+    { 20, 26, 20, -1, 18, 75, 30492 }, // γ
+    { 18, 27, 20, 1, 26, 90, 30567 }, // δ
+    { 15, 19, 17, 1, 18, 57, 30657 }, // ε
+    { 15, 34, 17, 1, 27, 85, 30714 }, // ζ
+    { 20, 26, 21, -1, 18, 93, 30799 }, // η
+    { 18, 27, 20, 1, 26, 88, 30892 }, // θ
+    { 10, 19, 13, 2, 18, 40, 30980 }, // ι
+    { 18, 19, 21, 2, 18, 71, 31020 }, // κ
+    { 22, 27, 22, -1, 26, 85, 31091 }, // λ
+    { 22, 26, 24, 1, 18, 93, 31176 }, // μ
+    { 20, 19, 20, -1, 18, 59, 31269 }, // ν
+    { 15, 34, 17, 1, 27, 81, 31328 }, // ξ
+    { 18, 19, 20, 1, 18, 66, 31409 }, // ο
+    { 23, 19, 24, 0, 18, 74, 31475 }, // π
+    { 18, 26, 20, 1, 18, 88, 31549 }, // ρ
+    { 15, 25, 17, 1, 18, 66, 31637 }, // ς
+    { 20, 19, 22, 1, 18, 69, 31703 }, // σ
+    { 18, 19, 19, 0, 18, 55, 31772 }, // τ
+    { 20, 19, 20, -1, 18, 70, 31827 }, // υ
+    { 25, 32, 27, 1, 24, 124, 31897 }, // φ
+    { 21, 26, 21, -1, 18, 90, 32021 }, // χ
+    { 27, 32, 27, -1, 24, 128, 32111 }, // ψ
+    { 24, 19, 26, 1, 18, 87, 32239 }, // ω
+    { 26, 32, 27, 0, 24, 114, 32326 }, // Ạ
+    { 18, 26, 20, 1, 18, 80, 32440 }, // ạ
+    { 26, 34, 27, 0, 34, 124, 32520 }, // Ả
+    { 18, 30, 20, 1, 29, 93, 32644 }, // ả
+    { 26, 35, 27, 0, 35, 125, 32737 }, // Ấ
+    { 18, 34, 20, 1, 33, 101, 32862 }, // ấ
+    { 26, 35, 27, 0, 35, 126, 32963 }, // Ầ
+    { 18, 34, 20, 1, 33, 101, 33089 }, // ầ
+    { 26, 35, 27, 0, 35, 128, 33190 }, // Ẩ
+    { 18, 34, 20, 1, 33, 106, 33318 }, // ẩ
+    { 26, 35, 27, 0, 35, 131, 33424 }, // Ẫ
+    { 18, 33, 20, 1, 32, 102, 33555 }, // ẫ
+    { 26, 40, 27, 0, 32, 139, 33657 }, // Ậ
+    { 18, 35, 20, 1, 27, 101, 33796 }, // ậ
+    { 26, 35, 27, 0, 35, 128, 33897 }, // Ắ
+    { 18, 33, 20, 1, 32, 98, 34025 }, // ắ
+    { 26, 35, 27, 0, 35, 128, 34123 }, // Ằ
+    { 18, 33, 20, 1, 32, 96, 34251 }, // ằ
+    { 26, 35, 27, 0, 35, 132, 34347 }, // Ẳ
+    { 18, 34, 20, 1, 33, 105, 34479 }, // ẳ
+    { 26, 35, 27, 0, 35, 130, 34584 }, // Ẵ
+    { 18, 33, 20, 1, 32, 104, 34714 }, // ẵ
+    { 26, 40, 27, 0, 32, 138, 34818 }, // Ặ
+    { 18, 34, 20, 1, 26, 100, 34956 }, // ặ
+    { 20, 31, 22, 1, 23, 96, 35056 }, // Ẹ
+    { 16, 26, 18, 1, 18, 77, 35152 }, // ẹ
+    { 20, 34, 22, 1, 34, 106, 35229 }, // Ẻ
+    { 16, 30, 18, 1, 29, 87, 35335 }, // ẻ
+    { 20, 32, 22, 1, 32, 104, 35422 }, // Ẽ
+    { 16, 27, 18, 1, 26, 83, 35526 }, // ẽ
+    { 20, 35, 22, 1, 35, 113, 35609 }, // Ế
+    { 18, 34, 20, 1, 33, 101, 35722 }, // ế
+    { 20, 35, 22, 1, 35, 112, 35823 }, // Ề
+    { 16, 34, 18, 1, 33, 96, 35935 }, // ề
+    { 20, 35, 22, 1, 35, 117, 36031 }, // Ể
+    { 19, 34, 21, 1, 33, 106, 36148 }, // ể
+    { 20, 35, 22, 1, 35, 116, 36254 }, // Ễ
+    { 16, 33, 18, 1, 32, 100, 36370 }, // ễ
+    { 20, 40, 22, 1, 32, 121, 36470 }, // Ệ
+    { 16, 35, 18, 1, 27, 98, 36591 }, // ệ
+    { 12, 34, 14, 1, 34, 70, 36689 }, // Ỉ
+    { 12, 29, 13, 0, 29, 64, 36759 }, // ỉ
+    { 12, 31, 14, 1, 23, 62, 36823 }, // Ị
+    { 12, 34, 13, 0, 26, 67, 36885 }, // ị
+    { 24, 32, 26, 1, 24, 125, 36952 }, // Ọ
+    { 18, 26, 20, 1, 18, 82, 37077 }, // ọ
+    { 24, 35, 26, 1, 34, 134, 37159 }, // Ỏ
+    { 18, 30, 20, 1, 29, 93, 37293 }, // ỏ
+    { 24, 36, 26, 1, 35, 139, 37386 }, // Ố
+    { 18, 34, 20, 1, 33, 102, 37525 }, // ố
+    { 24, 36, 26, 1, 35, 141, 37627 }, // Ồ
+    { 18, 34, 20, 1, 33, 101, 37768 }, // ồ
+    { 24, 36, 26, 1, 35, 146, 37869 }, // Ổ
+    { 19, 34, 21, 1, 33, 112, 38015 }, // ổ
+    { 24, 36, 26, 1, 35, 141, 38127 }, // Ỗ
+    { 18, 33, 20, 1, 32, 103, 38268 }, // ỗ
+    { 24, 40, 26, 1, 32, 148, 38371 }, // Ộ
+    { 18, 35, 20, 1, 27, 103, 38519 }, // ộ
+    { 25, 33, 27, 1, 32, 136, 38622 }, // Ớ
+    { 19, 29, 21, 1, 28, 94, 38758 }, // ớ
+    { 25, 33, 27, 1, 32, 135, 38852 }, // Ờ
+    { 19, 29, 21, 1, 28, 94, 38987 }, // ờ
+    { 25, 35, 27, 1, 34, 143, 39081 }, // Ở
+    { 19, 30, 21, 1, 29, 102, 39224 }, // ở
+    { 25, 33, 27, 1, 32, 138, 39326 }, // Ỡ
+    { 19, 27, 21, 1, 26, 96, 39464 }, // ỡ
+    { 25, 36, 27, 1, 28, 140, 39560 }, // Ợ
+    { 19, 30, 21, 1, 22, 94, 39700 }, // ợ
+    { 26, 31, 27, 0, 23, 119, 39794 }, // Ụ
+    { 22, 26, 23, 0, 18, 91, 39913 }, // ụ
+    { 26, 35, 27, 0, 34, 132, 40004 }, // Ủ
+    { 22, 30, 23, 0, 29, 103, 40136 }, // ủ
+    { 28, 33, 29, 0, 32, 131, 40239 }, // Ứ
+    { 22, 29, 23, 0, 28, 102, 40370 }, // ứ
+    { 28, 33, 29, 0, 32, 131, 40472 }, // Ừ
+    { 22, 29, 23, 0, 28, 103, 40603 }, // ừ
+    { 28, 35, 29, 0, 34, 139, 40706 }, // Ử
+    { 22, 30, 23, 0, 29, 109, 40845 }, // ử
+    { 28, 33, 29, 0, 32, 135, 40954 }, // Ữ
+    { 22, 27, 23, 0, 26, 102, 41089 }, // ữ
+    { 28, 36, 29, 0, 28, 135, 41191 }, // Ự
+    { 22, 30, 23, 0, 22, 102, 41326 }, // ự
+    { 24, 32, 25, 0, 32, 103, 41428 }, // Ỳ
+    { 22, 36, 23, 0, 28, 104, 41531 }, // ỳ
+    { 24, 31, 25, 0, 23, 100, 41635 }, // Ỵ
+    { 22, 26, 23, 0, 18, 88, 41735 }, // ỵ
+    { 24, 34, 25, 0, 34, 110, 41823 }, // Ỷ
+    { 22, 37, 23, 0, 29, 110, 41933 }, // ỷ
+    { 24, 32, 25, 0, 32, 105, 42043 }, // Ỹ
+    { 22, 34, 23, 0, 26, 105, 42148 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 42253 }, //  
+    { 0, 0, 33, 0, 0, 0, 42253 }, //  
+    { 0, 0, 17, 0, 0, 0, 42253 }, //  
+    { 0, 0, 33, 0, 0, 0, 42253 }, //  
+    { 0, 0, 11, 0, 0, 0, 42253 }, //  
+    { 0, 0, 8, 0, 0, 0, 42253 }, //  
+    { 0, 0, 5, 0, 0, 0, 42253 }, //  
+    { 0, 0, 21, 0, 0, 0, 42253 }, //  
+    { 0, 0, 10, 0, 0, 0, 42253 }, //  
+    { 0, 0, 7, 0, 0, 0, 42253 }, //  
+    { 0, 0, 2, 0, 0, 0, 42253 }, //  
+    { 0, 0, 1, 0, 0, 0, 42253 }, // ​
+    { 2, 28, 2, -1, 20, 27, 42253 }, // ‌
+    { 8, 30, 5, -4, 22, 51, 42280 }, // ‍
+    { 12, 31, 7, -6, 23, 70, 42331 }, // ‎
+    { 12, 31, 7, -6, 23, 69, 42401 }, // ‏
+    { 11, 5, 13, 1, 11, 17, 42470 }, // ‐
+    { 11, 5, 13, 1, 11, 17, 42487 }, // ‑
+    { 17, 4, 21, 2, 13, 23, 42504 }, // ‒
+    { 17, 5, 18, 0, 11, 11, 42527 }, // –
+    { 33, 5, 34, 0, 11, 18, 42538 }, // —
+    { 33, 5, 34, 0, 11, 18, 42556 }, // ―
+    { 12, 34, 17, 2, 26, 74, 42574 }, // ‖
+    { 17, 9, 18, 0, -1, 32, 42648 }, // ‗
+    { 7, 11, 9, 1, 25, 18, 42680 }, // ‘
+    { 7, 11, 8, 0, 25, 19, 42698 }, // ’
+    { 7, 11, 8, 0, 5, 19, 42717 }, // ‚
+    { 7, 11, 9, 1, 25, 19, 42736 }, // ‛
+    { 13, 11, 15, 1, 25, 35, 42755 }, // “
+    { 14, 11, 15, 0, 25, 36, 42790 }, // ”
+    { 14, 11, 15, 0, 5, 36, 42826 }, // „
+    { 13, 11, 15, 1, 25, 34, 42862 }, // ‟
+    { 15, 22, 17, 1, 24, 53, 42896 }, // †
+    { 15, 26, 17, 1, 24, 69, 42949 }, // ‡
+    { 8, 8, 10, 1, 13, 15, 43018 }, // •
+    { 12, 12, 21, 4, 17, 24, 43033 }, // ‣
+    { 7, 6, 10, 1, 5, 13, 43057 }, // ․
+    { 15, 6, 17, 1, 5, 25, 43070 }, // ‥
+    { 29, 6, 33, 2, 5, 36, 43095 }, // …
+    { 7, 6, 10, 1, 12, 13, 43131 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 43144 }, //  
+    { 0, 0, 1, 0, 0, 0, 43144 }, //  
+    { 12, 31, 7, -6, 23, 71, 43144 }, // ‪
+    { 12, 31, 7, -6, 23, 69, 43215 }, // ‫
+    { 10, 31, 6, -5, 23, 56, 43284 }, // ‬
+    { 14, 31, 8, -7, 23, 83, 43340 }, // ‭
+    { 14, 31, 8, -7, 23, 82, 43423 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 43505 }, //  
+    { 44, 27, 46, 1, 25, 197, 43505 }, // ‰
+    { 9, 11, 10, 0, 23, 17, 43702 }, // ′
+    { 16, 11, 17, 0, 23, 34, 43719 }, // ″
+    { 23, 11, 24, 0, 23, 52, 43753 }, // ‴
+    { 9, 11, 10, 0, 23, 17, 43805 }, // ‵
+    { 15, 11, 17, 1, 23, 34, 43822 }, // ‶
+    { 22, 11, 24, 1, 23, 51, 43856 }, // ‷
+    { 14, 7, 16, 1, 0, 20, 43907 }, // ‸
+    { 9, 13, 11, 1, 15, 22, 43927 }, // ‹
+    { 9, 13, 11, 1, 15, 23, 43949 }, // ›
+    { 21, 23, 22, 0, 22, 94, 43972 }, // ※
+    { 16, 26, 19, 2, 25, 84, 44066 }, // ‼
+    { 17, 4, 18, 0, 28, 22, 44150 }, // ‾
+    { 8, 5, 10, 1, 11, 13, 44172 }, // ⁃
+    { 18, 28, 13, -6, 25, 56, 44185 }, // ⁄
+    { 28, 26, 31, 2, 25, 111, 44241 }, // ⁇
+    { 23, 26, 26, 2, 25, 104, 44352 }, // ⁈
+    { 22, 26, 25, 2, 25, 96, 44456 }, // ⁉
+    { 20, 7, 33, 6, 13, 23, 44552 }, // ⁓
+    { 30, 11, 31, 0, 23, 68, 44575 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 44643 }, //  
+    { 0, 0, 1, 0, 0, 0, 44643 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 44643 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 44643 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 44643 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 44643 }, // ⁤
+    { 15, 17, 16, 0, 28, 41, 44643 }, // ⁰
+    { 14, 17, 15, 0, 28, 40, 44684 }, // ⁴
+    { 11, 16, 15, 2, 27, 34, 44724 }, // ⁵
+    { 13, 17, 15, 1, 28, 42, 44758 }, // ⁶
+    { 12, 16, 15, 2, 27, 31, 44800 }, // ⁷
+    { 13, 17, 15, 1, 28, 43, 44831 }, // ⁸
+    { 13, 17, 15, 1, 28, 40, 44874 }, // ⁹
+    { 15, 11, 19, 2, 23, 42, 44914 }, // ⁿ
+    { 15, 16, 16, 0, 11, 42, 44956 }, // ₀
+    { 11, 16, 15, 2, 11, 34, 44998 }, // ₁
+    { 13, 16, 15, 1, 11, 41, 45032 }, // ₂
+    { 12, 16, 15, 1, 11, 38, 45073 }, // ₃
+    { 14, 16, 15, 0, 11, 42, 45111 }, // ₄
+    { 11, 16, 15, 2, 11, 34, 45153 }, // ₅
+    { 13, 16, 15, 1, 11, 42, 45187 }, // ₆
+    { 12, 16, 15, 2, 11, 30, 45229 }, // ₇
+    { 13, 16, 15, 1, 11, 46, 45259 }, // ₈
+    { 13, 16, 15, 1, 11, 43, 45305 }, // ₉
+    { 19, 23, 21, 1, 23, 80, 45348 }, // ₣
+    { 20, 24, 21, 0, 23, 85, 45428 }, // ₤
+    { 44, 24, 45, 0, 23, 159, 45513 }, // ₧
+    { 21, 24, 22, 0, 23, 78, 45672 }, // €
+    { 21, 15, 33, 6, 19, 49, 45750 }, // ←
+    { 15, 21, 33, 9, 22, 59, 45799 }, // ↑
+    { 21, 15, 33, 6, 19, 49, 45858 }, // →
+    { 15, 21, 33, 9, 22, 57, 45907 }, // ↓
+    { 21, 15, 33, 6, 19, 53, 45964 }, // ↔
+    { 15, 23, 33, 9, 23, 52, 46017 }, // ↕
+    { 15, 23, 33, 9, 23, 60, 46069 }, // ↨
+    { 15, 23, 33, 9, 23, 62, 46129 }, // ↲
+    { 15, 23, 33, 9, 23, 61, 46191 }, // ↳
+    { 19, 18, 33, 7, 20, 54, 46252 }, // ↵
+    { 21, 19, 33, 6, 21, 76, 46306 }, // ⇐
+    { 19, 21, 33, 7, 22, 93, 46382 }, // ⇑
+    { 21, 19, 33, 6, 21, 76, 46475 }, // ⇒
+    { 19, 21, 33, 7, 22, 92, 46551 }, // ⇓
+    { 21, 17, 33, 6, 20, 68, 46643 }, // ⇔
+    { 23, 24, 33, 5, 23, 82, 46711 }, // ∀
+    { 18, 27, 21, 1, 26, 79, 46793 }, // ∂
+    { 17, 23, 33, 8, 23, 75, 46872 }, // ∃
+    { 25, 27, 33, 4, 25, 113, 46947 }, // ∅
+    { 22, 24, 23, 0, 24, 81, 47060 }, // ∆
+    { 21, 24, 33, 6, 23, 81, 47141 }, // ∇
+    { 23, 23, 33, 5, 23, 91, 47222 }, // ∈
+    { 23, 29, 33, 5, 26, 113, 47313 }, // ∉
+    { 23, 20, 33, 5, 21, 80, 47426 }, // ∊
+    { 23, 23, 33, 5, 23, 91, 47506 }, // ∋
+    { 23, 29, 33, 5, 26, 113, 47597 }, // ∌
+    { 23, 20, 33, 5, 21, 80, 47710 }, // ∍
+    { 26, 29, 28, 1, 23, 121, 47790 }, // ∏
+    { 21, 29, 23, 1, 23, 88, 47911 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 47999 }, // −
+    { 16, 26, 18, 1, 24, 54, 48014 }, // ∕
+    { 16, 26, 18, 1, 24, 54, 48068 }, // ∖
+    { 16, 16, 21, 2, 19, 47, 48122 }, // ∗
+    { 13, 12, 21, 4, 17, 34, 48169 }, // ∘
+    { 7, 6, 21, 7, 12, 13, 48203 }, // ∙
+    { 22, 31, 22, -1, 27, 90, 48216 }, // √
+    { 17, 13, 21, 2, 17, 45, 48306 }, // ∝
+    { 21, 13, 22, 0, 17, 55, 48351 }, // ∞
+    { 21, 23, 33, 6, 23, 62, 48406 }, // ∟
+    { 25, 23, 33, 4, 23, 72, 48468 }, // ∠
+    { 5, 34, 17, 6, 26, 37, 48540 }, // ∣
+    { 12, 34, 17, 2, 26, 106, 48577 }, // ∥
+    { 23, 23, 33, 5, 23, 72, 48683 }, // ∧
+    { 23, 23, 33, 5, 23, 74, 48755 }, // ∨
+    { 19, 24, 33, 7, 24, 92, 48829 }, // ∩
+    { 19, 24, 33, 7, 23, 92, 48921 }, // ∪
+    { 19, 34, 21, 1, 26, 92, 49013 }, // ∫
+    { 23, 20, 33, 5, 19, 54, 49105 }, // ∴
+    { 23, 20, 33, 5, 19, 51, 49159 }, // ∵
+    { 7, 19, 10, 2, 21, 25, 49210 }, // ∶
+    { 23, 20, 33, 5, 19, 59, 49235 }, // ∷
+    { 20, 7, 33, 6, 13, 23, 49294 }, // ∼
+    { 20, 18, 33, 6, 20, 74, 49317 }, // ≅
+    { 17, 14, 21, 2, 18, 47, 49391 }, // ≈
+    { 19, 13, 33, 7, 16, 43, 49438 }, // ≍
+    { 15, 16, 21, 3, 19, 52, 49481 }, // ≠
+    { 19, 16, 33, 7, 18, 71, 49533 }, // ≡
+    { 15, 20, 21, 3, 20, 48, 49604 }, // ≤
+    { 15, 21, 21, 3, 21, 50, 49652 }, // ≥
+    { 27, 16, 33, 3, 19, 75, 49702 }, // ≪
+    { 27, 16, 33, 3, 19, 74, 49777 }, // ≫
+    { 23, 20, 33, 5, 21, 62, 49851 }, // ⊃
+    { 23, 29, 33, 5, 26, 97, 49913 }, // ⊄
+    { 23, 29, 33, 5, 26, 99, 50010 }, // ⊅
+    { 21, 23, 33, 6, 23, 65, 50109 }, // ⊆
+    { 21, 23, 33, 6, 23, 65, 50174 }, // ⊇
+    { 25, 25, 33, 4, 24, 107, 50239 }, // ⊕
+    { 25, 25, 33, 4, 24, 102, 50346 }, // ⊖
+    { 25, 25, 33, 4, 24, 121, 50448 }, // ⊗
+    { 25, 25, 33, 4, 24, 114, 50569 }, // ⊘
+    { 19, 23, 33, 7, 23, 57, 50683 }, // ⊥
+    { 7, 6, 21, 7, 12, 13, 50740 }, // ⋅
+    { 29, 6, 33, 2, 12, 38, 50753 }, // ⋯
+    { 31, 32, 33, 1, 28, 137, 50791 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_boldIntervals[] = {
@@ -5642,4 +3952,5 @@ static const EpdFontData bookerly_16_bold = {
     36,
     -9,
     true,
+    true,
 };
@@ -2,5789 +2,3826 @@
  * generated by fontconvert.py
  * name: bookerly_16_bolditalic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_bolditalicBitmaps[81544] = {
-    0x00, 0x06, 0xA0, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x07, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0xBF, 0x40, 0x03, 0xFE, 0x00, 0x1F,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0x54, 0x00, 0x00, 0x01, 0xA4, 0x1A, 0x41, 0xFD, 0x2F, 0xC0, 0xFF,
-    0x0F, 0xF0, 0x7F, 0xC7, 0xF8, 0x1F, 0xD2, 0xFD, 0x0B, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFE,
-    0x0F, 0xE0, 0x3F, 0x43, 0xF4, 0x0F, 0xC0, 0xFC, 0x03, 0x90, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x01, 0xAB, 0xFE, 0xAF, 0xFA, 0x90, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x15, 0xFF,
-    0x56, 0xFE, 0x54, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x5B, 0xF5,
-    0x5F, 0xE5, 0x40, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x01, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x7F, 0x47, 0xDF, 0xF0, 0x0F, 0xE0, 0xB8, 0xBF, 0x00, 0xFE, 0x0F, 0x47, 0xE0,
-    0x1F, 0xF1, 0xF0, 0x3C, 0x00, 0xFF, 0xEF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0x2F, 0xF0, 0x7F, 0x03, 0xE0, 0xFF, 0x0B, 0xF4, 0x3D, 0x0F,
-    0xF0, 0xBF, 0xC7, 0xC1, 0xFE, 0x07, 0xFE, 0xBC, 0x7F, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x43, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00,
-    0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xF0, 0x2F, 0x80, 0x01,
-    0x00, 0x3F, 0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xFE, 0x03, 0xFE, 0xBF, 0xC0, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x3F, 0x42, 0xFE, 0x7F, 0xD0, 0x7F, 0xF4, 0x0B, 0xE0, 0x7F, 0x81, 0xFE, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0xFE, 0x00, 0x00,
-    0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xE0, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x34, 0x00, 0x2F, 0xD7, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xFF,
-    0x40, 0x1B, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x1B, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x02, 0xFF, 0xFE,
-    0x40, 0x0B, 0xFF, 0xF4, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0x5F, 0xF0, 0x39, 0xBE, 0x00, 0x07, 0xF8,
-    0x3F, 0xD0, 0x03, 0xF4, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x80,
-    0xFE, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x8B, 0xF0, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x3F, 0xD0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0xBF, 0xFF, 0x91, 0xFF,
-    0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00,
-    0x01, 0xA4, 0x1F, 0xD0, 0xFF, 0x07, 0xFC, 0x1F, 0xD0, 0xBF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x40,
-    0xFC, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xB0, 0xFF, 0x00, 0xBE,
-    0x3F, 0x00, 0x3F, 0xEF, 0x40, 0x01, 0xFF, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x6F, 0xFD, 0xBC, 0x3F,
-    0xDF, 0x41, 0x07, 0xE3, 0xF0, 0x00, 0x60, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x0A, 0xAB, 0xFF, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0xBF,
-    0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x03, 0xF8,
-    0x00, 0x04, 0x00, 0x00, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x15,
-    0x55, 0x50, 0x06, 0x80, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xF0, 0x0F, 0xFE, 0x01,
-    0xFF, 0x80, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,
-    0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF8, 0x7F, 0xD0, 0x00, 0x2F, 0xF0, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xFD, 0x6F, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x03, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFA, 0xBF, 0xF8, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x24, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, 0xAF, 0xFC, 0x00, 0xFF,
-    0x80, 0x1F, 0xF4, 0x03, 0xF8, 0x00, 0x3F, 0xD0, 0x07, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x39, 0x5F, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x00,
-    0x7F, 0xC0, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x02, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0x5B, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xE0,
-    0x07, 0xFF, 0x40, 0x7F, 0xD0, 0x02, 0xFF, 0x80, 0xBF, 0xC0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x01,
-    0xFF, 0x40, 0xBF, 0xC0, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x40, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE5, 0x55,
-    0xFF, 0xC0, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0xD0, 0x0F, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x5F, 0xFC, 0x00,
-    0xFF, 0x80, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0xBF, 0xC0,
-    0x0F, 0xF8, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF8, 0x7F, 0xF8, 0x01, 0xFF,
-    0x40, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0xBF, 0xC0, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x03,
-    0xFD, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFA, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFA, 0xBF, 0xF4, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xE5, 0x6F, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x0F, 0xFC, 0x07, 0xFF, 0x01, 0xFF, 0x40, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x02, 0xFF, 0x00, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x0F, 0xF0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA,
-    0x90, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x1B, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFD,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x0F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x2F, 0x57, 0xFC, 0x04, 0x02, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x95, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFC, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x2F, 0xFF, 0xA5, 0x5B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F,
-    0xE0, 0x01, 0xB8, 0x1A, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xFE, 0xFC, 0x03, 0xF4, 0x0F, 0xF0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0xD0, 0xFF, 0x00, 0x3F, 0x83, 0xFC, 0x01,
-    0xFD, 0x01, 0xFC, 0x00, 0xFD, 0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xE0, 0x07, 0xF4, 0x7F, 0x40, 0x7F,
-    0x40, 0x3F, 0x40, 0x2F, 0xC2, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x03,
-    0xFD, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFF, 0xBE, 0xF8, 0x7F, 0xD0, 0x0F, 0xF0, 0x0B, 0xFF, 0xE3,
-    0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x0F, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x1B, 0x90, 0x0B,
-    0xA4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05,
-    0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFE, 0xFF, 0xF4, 0x00, 0x55, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x02,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x00,
-    0x7F, 0xD0, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x53, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x80,
-    0x02, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41,
-    0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03,
-    0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5,
-    0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00,
-    0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x05, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00,
-    0x2F, 0xF4, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x6A, 0xA0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xEA, 0xA8, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD,
-    0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC,
-    0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0,
-    0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x28, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD7,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x3F,
-    0xE0, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFB, 0xF8, 0x03, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFC, 0xFF, 0x00,
-    0x00, 0x00, 0xFC, 0x7F, 0xC0, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x1F, 0xF0, 0xBF, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0x83, 0xFC, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x6F, 0x82, 0xFF,
-    0x00, 0x00, 0x07, 0xF0, 0x3F, 0xEF, 0xC0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xE0, 0x2F,
-    0xF0, 0x00, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03,
-    0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00,
-    0x3F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40,
-    0x03, 0xFD, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF5,
-    0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xFF,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xF8, 0xFF,
-    0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80,
-    0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD,
-    0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x65, 0xFF, 0x82, 0xFF, 0xE0, 0x00, 0x07, 0xFD,
-    0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xD1, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xAE, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x1B,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x00,
-    0x3F, 0x00, 0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF,
-    0xC0, 0x7F, 0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF,
-    0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F,
-    0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xA4, 0x00, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0xFF, 0xD2, 0xFF, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xE0, 0x1F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xFC, 0x02,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0x7F, 0xC0,
-    0xBF, 0x40, 0x00, 0x0B, 0xFC, 0x1F, 0xCB, 0xF0, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xD2, 0xFD,
-    0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x1F, 0xF3, 0xF4, 0x1F,
-    0xDB, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0xFC, 0x07, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00,
-    0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFB,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90, 0x07, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x02,
-    0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xF9, 0x40, 0x2F, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
-    0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x01, 0x90, 0x01, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0xBF, 0xF0, 0x00, 0x6F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x2A, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x03, 0xF4, 0xFF,
-    0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x3F, 0xC0,
-    0x1F, 0xD0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFE,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x04, 0x00, 0xF0, 0x0F, 0xE0, 0x3F, 0xD0,
-    0xBF, 0xC0, 0x7F, 0xC0, 0x7F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07,
-    0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00,
-    0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F,
-    0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x68,
-    0x00, 0x0F, 0xF0, 0x7F, 0xF4, 0x00, 0xFF, 0x2F, 0xFF, 0xC0, 0x0F, 0xEB, 0xFF, 0xFC, 0x01, 0xFE,
-    0xF8, 0xBF, 0xD0, 0x2F, 0xFE, 0x03, 0xFD, 0x03, 0xFF, 0xC0, 0x3F, 0xD0, 0x3F, 0xF0, 0x03, 0xFD,
-    0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0xFF, 0x40,
-    0x1F, 0xF0, 0x0F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF4, 0x1F, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x69, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFB, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFC, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF,
-    0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F,
-    0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0,
-    0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE6,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4, 0x00, 0x0F, 0xF8, 0x07,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x2F,
-    0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40,
-    0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x29, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0x00,
-    0x3F, 0xDF, 0xFF, 0xF4, 0x01, 0xFE, 0xFD, 0x3F, 0xD0, 0x0B, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xFC,
-    0x07, 0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07,
-    0xFF, 0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x0A, 0xBF, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x24, 0x7F, 0xEF, 0x8B, 0xFF, 0xF4, 0xBF, 0xFE, 0x03, 0xFE, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x04, 0x01, 0xFF, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x64, 0x00, 0x3F, 0xC1, 0xFF, 0xC0, 0x0F, 0xF2, 0xFF,
-    0xF8, 0x03, 0xF7, 0xFA, 0xFF, 0x01, 0xFE, 0xE0, 0x3F, 0x80, 0xBF, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0,
-    0x0B, 0xF0, 0x0F, 0xF4, 0x07, 0xF4, 0x07, 0xFC, 0x0B, 0xF4, 0x02, 0xFF, 0xBF, 0xF0, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x1F, 0xF3, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02,
-    0xFE, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0xFE, 0x3F, 0xD0, 0x0F, 0xFF, 0x5F, 0xF0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0xC2, 0xFF, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD,
-    0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x30, 0xBF, 0xEF, 0x4F, 0xFF,
-    0xF0, 0xFF, 0xFD, 0x07, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x01, 0x64, 0x00, 0x64, 0x00, 0x19, 0x00,
-    0xBF, 0xF4, 0x1F, 0xFC, 0x0B, 0xFF, 0x0F, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0xFD, 0x2A, 0xFF, 0x6F,
-    0xFF, 0xDF, 0xFF, 0xF8, 0x02, 0xFE, 0xF8, 0xFF, 0xBD, 0x3F, 0xE0, 0x0F, 0xFF, 0x43, 0xFF, 0xD0,
-    0xFF, 0x40, 0x3F, 0xF8, 0x0F, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xF0, 0x0B,
-    0xFD, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0xBF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0xA3, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xEF, 0xCF, 0xF4,
-    0x07, 0xFC, 0x01, 0xFF, 0xFE, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFF, 0xF2, 0xFE, 0x00, 0xBF, 0x40,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x69, 0x00, 0xBF,
-    0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF, 0xAF, 0xFF, 0xF0, 0x02, 0xFE, 0xF8,
-    0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xD0,
-    0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xFD,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0xC3, 0xFE, 0x00, 0xBF,
-    0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF, 0xD2, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xF0, 0xFF,
-    0x80, 0x0B, 0xFC, 0x3F, 0xD0, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0xBF, 0xCF, 0xFC, 0x00, 0x3F, 0xE3,
-    0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x03, 0xFE, 0x0F, 0xFC, 0x02, 0xFF,
-    0x02, 0xFF, 0x42, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x64, 0x01, 0xA4, 0x00, 0x1F, 0xFF, 0x43, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xD3, 0xFF, 0xF4, 0x02, 0xAF, 0xF7, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0xFF,
-    0xC0, 0x00, 0xFF, 0xF0, 0x2F, 0xF0, 0x00, 0x7F, 0xF4, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x01, 0x50, 0x00, 0x1F, 0xFF, 0x3F, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFE,
-    0xFF, 0xF4, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF4,
-    0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x03, 0xFE,
-    0x00, 0x7F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0xFF, 0x82, 0xFB,
-    0xF0, 0x03, 0xFF, 0x6F, 0x7F, 0x80, 0x0F, 0xFF, 0xF8, 0xFE, 0x00, 0x1F, 0xFF, 0x87, 0xF4, 0x00,
-    0x2F, 0xF4, 0x2F, 0xD0, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x64, 0x01, 0xA0, 0x2F,
-    0xFE, 0x0B, 0xFC, 0xFF, 0xFE, 0x2F, 0xFC, 0xAB, 0xFE, 0x7F, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x02,
-    0xFE, 0xF4, 0x10, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x2F,
-    0xEA, 0xFE, 0x01, 0xFF, 0x00, 0xB0, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
-    0x0F, 0x00, 0x3F, 0xE0, 0xBF, 0x00, 0xBF, 0x83, 0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF,
-    0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F,
-    0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0,
-    0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07,
-    0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0,
-    0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04,
-    0x00, 0x01, 0x60, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF, 0xFC,
-    0x03, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0xA4, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0xC7, 0xFF,
-    0xD0, 0x2F, 0xF0, 0x1F, 0xF5, 0xBF, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0x40,
-    0xBF, 0x40, 0x3F, 0xD0, 0x3F, 0xE0, 0x2F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xF0, 0x02, 0xFE,
-    0x07, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x82, 0xFF, 0xC1, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xF0, 0xBF,
-    0x00, 0x03, 0xFC, 0x7F, 0xFC, 0x3F, 0x40, 0x00, 0xFF, 0x3F, 0xBF, 0x2F, 0xC0, 0x00, 0x3F, 0xEF,
-    0x5F, 0xDF, 0xC0, 0x00, 0x0F, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC1, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x64, 0x00, 0x3F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x0F,
-    0xF8, 0xBF, 0x18, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF3,
-    0xFE, 0x00, 0x03, 0xEF, 0xF0, 0xBF, 0xC6, 0x81, 0xFF, 0xF4, 0x1F, 0xFF, 0xF0, 0x7F, 0xF8, 0x03,
-    0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x7F, 0xE4, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x58,
-    0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF,
-    0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00,
-    0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1A,
-    0x00, 0x3F, 0xFD, 0x0F, 0xF0, 0x3F, 0xFF, 0xFB, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x07, 0xF9, 0xBF,
-    0xFD, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x3D, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x38, 0x01, 0xFF, 0x00, 0x2F, 0x40, 0xFF, 0xFE, 0xAF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xEF, 0xFF, 0xFC, 0x0B, 0xD0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xA8, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
-    0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xAB, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0B,
-    0x41, 0xFF, 0xFC, 0x03, 0xF0, 0xFF, 0xFF, 0xE7, 0xFC, 0xBF, 0x9F, 0xFF, 0xFE, 0x1F, 0x80, 0x7F,
-    0xFF, 0x01, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2F, 0xD0,
-    0x01, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x06, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFB, 0xEB,
-    0xF4, 0x3F, 0xF1, 0xF0, 0x28, 0x2F, 0xF0, 0xBC, 0x00, 0x0F, 0xF4, 0x3E, 0x00, 0x07, 0xFC, 0x0F,
-    0x40, 0x02, 0xFE, 0x03, 0xC0, 0x00, 0xFF, 0x41, 0xF0, 0x00, 0x3F, 0xD0, 0xBC, 0x00, 0x0F, 0xF8,
-    0x3E, 0x00, 0x03, 0xFF, 0x0F, 0x40, 0xB0, 0xBF, 0xD7, 0xC0, 0xBD, 0x0F, 0xFF, 0xF6, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0x97, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x40, 0x2F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x57, 0xFD, 0x55, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0xFF, 0x95, 0x50, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xEF, 0xF9, 0x56, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x1B, 0xFF, 0xF0, 0x02, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x08, 0x01, 0xF8, 0x06, 0xA4, 0x1F, 0x80, 0x7F, 0xAF,
-    0xFF, 0xEF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xE5, 0xFF, 0xC0, 0x00, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x00, 0x1F, 0xFE, 0xBF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xD7, 0xFF, 0xE7, 0xFC, 0x03, 0xC0, 0x05, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x15, 0x55, 0x51, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF4, 0x07, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xC2, 0xFC, 0x00, 0x00, 0x11, 0xFF, 0x1F, 0xE1, 0x00,
-    0x01, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x14, 0x2F, 0xF4, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00,
-    0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x16, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x07, 0xFC,
-    0x00, 0xFF, 0x00, 0x7F, 0x00, 0xBF, 0xC0, 0x0F, 0x40, 0x3F, 0xF4, 0x00, 0x00, 0x2E, 0x7F, 0x00,
-    0x00, 0x0F, 0x8F, 0xF4, 0x00, 0x03, 0xE0, 0xFF, 0x80, 0x00, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0x40,
-    0xBF, 0xC0, 0x07, 0xF4, 0x07, 0xF8, 0x00, 0xFF, 0x40, 0x7F, 0x00, 0x0F, 0xF8, 0x0B, 0xD0, 0x00,
-    0xFF, 0xC0, 0xF8, 0x00, 0x0B, 0xFC, 0x3E, 0x00, 0x00, 0xBF, 0x8F, 0x80, 0x00, 0x07, 0xF3, 0xD0,
-    0x04, 0x00, 0xBF, 0xF0, 0x1F, 0x40, 0x0F, 0xF8, 0x0F, 0xE0, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFD,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0xBD, 0x3F, 0xD2, 0xFE, 0x3F, 0xC3, 0xFE, 0x3F, 0x42, 0xF8, 0x04, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA,
-    0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xBF, 0xF8, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFF,
-    0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x0B, 0xC0, 0x0F, 0x0B, 0x40, 0xBE, 0x01, 0xF0, 0x02, 0xD3, 0xC0,
-    0x3F, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x1E, 0x3C, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xCF, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x78, 0xB4, 0x0F,
-    0xF0, 0x00, 0x00, 0x2D, 0x1E, 0x02, 0xFF, 0x96, 0xD0, 0x0F, 0x03, 0xC0, 0x3F, 0xFF, 0xF0, 0x07,
-    0xC0, 0xB8, 0x02, 0xFF, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x01, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x07, 0xFE, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x3F, 0x47, 0xF0, 0x0F, 0xD0, 0x3E, 0x00, 0xFC,
-    0x0B, 0xD0, 0x1F, 0x40, 0xFC, 0x02, 0xF4, 0x2F, 0x80, 0x2F, 0x47, 0xF8, 0x82, 0xFF, 0xFF, 0xBC,
-    0x1F, 0xFD, 0xFF, 0x80, 0xBE, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x2F, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x15, 0x55, 0x40, 0x00, 0x00, 0x02, 0x40, 0x02, 0x80, 0x00, 0x7F,
-    0x40, 0x7F, 0x80, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x1F, 0xF8, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x1F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0x80,
-    0x3F, 0xC0, 0x00, 0x28, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFD, 0x15, 0x55, 0x50, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x1A, 0xA9, 0x03, 0xC0, 0x78,
-    0x7F, 0xBE, 0x07, 0x42, 0xC0, 0x7C, 0x7C, 0x0F, 0x0F, 0x01, 0xF1, 0xF0, 0x2C, 0x3C, 0x07, 0xDF,
-    0x40, 0xB0, 0xE0, 0x1F, 0xF4, 0x02, 0xC3, 0xC0, 0x7D, 0xF0, 0x0B, 0x0B, 0x01, 0xF3, 0xF0, 0x3C,
-    0x1D, 0x1F, 0xE3, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1A, 0xAA, 0xA8,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0x97, 0xFD, 0x3F, 0x80, 0x3F, 0x8F, 0xC0, 0x0F, 0xE3, 0xF4, 0x03, 0xF8,
-    0xFE, 0x00, 0xFD, 0x2F, 0xE6, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x40, 0x01, 0xA9, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xF9, 0x55, 0xBF, 0x55, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x2F, 0xEB, 0xFC, 0x03, 0xF0, 0x1F,
-    0xD0, 0x3C, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0x01, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0xFD,
-    0x03, 0xF9, 0xFF, 0x07, 0xC0, 0x7F, 0x01, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xF0, 0x01,
-    0xFF, 0xF0, 0x01, 0xEB, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x15, 0xBF,
-    0xF0, 0xBF, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x02,
-    0xFD, 0x1F, 0xF0, 0xFF, 0x0B, 0xF4, 0x3F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x16, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFE, 0x01, 0x02, 0xFF, 0xEB, 0xFB, 0xFA, 0xF0, 0x2F,
-    0xFF, 0xFD, 0x7F, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0x7F, 0xD0, 0x1F, 0xE0, 0x07,
-    0xF0, 0x50, 0x00, 0x10, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0x1F,
-    0x40, 0x00, 0x3F, 0xFF, 0xF2, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xE3,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFD, 0x3E, 0x00, 0x01, 0xFF, 0xFF, 0xC7, 0xD0, 0x00, 0x1F, 0xFF, 0xFC,
-    0xBC, 0x00, 0x01, 0xFF, 0xFF, 0x8B, 0xC0, 0x00, 0x0F, 0xFF, 0xF4, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0x4F, 0x80, 0x00, 0x07, 0xFF, 0xF1, 0xF4, 0x00, 0x00, 0x0B, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x60,
-    0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xEB, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xFE, 0x7F, 0xEB, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x50,
-    0x03, 0xFD, 0x06, 0xFE, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xF4, 0x2F, 0xD0, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x2F, 0xFF, 0x01, 0xFF, 0xF8, 0x01, 0x6F, 0xD0, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xFE, 0x00, 0x1B, 0xFE, 0x42, 0xFF, 0xFE, 0x0A, 0xAA, 0xA4, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF4, 0x0B, 0xF0, 0x7F, 0x03, 0xF0, 0x1F, 0xC2, 0xF8, 0x07, 0xF0, 0xFD, 0x02,
-    0xF8, 0x3F, 0x00, 0xFD, 0x0F, 0xC0, 0xBF, 0x03, 0xF8, 0xBF, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x15, 0x55,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x60, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x7F, 0xF0, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0F, 0xF8, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x0A, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0x40, 0x07, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x0F,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0x80, 0x03, 0xF3, 0xF0, 0x3F, 0xFF, 0xE0, 0x0B, 0xF0, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xD0,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF9, 0x5F, 0xE4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2B, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x0B, 0xE8, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xF0, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xE0, 0x00,
-    0x2F, 0x80, 0x7F, 0x42, 0xFC, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x07, 0xC0, 0x2F, 0xC2, 0xFF, 0xFF,
-    0x00, 0xFC, 0x00, 0x04, 0x03, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xFA,
-    0xAA, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02,
-    0x40, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x0B, 0xE0,
-    0x00, 0x3F, 0xF4, 0x00, 0x6F, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0x0B, 0xFF, 0xFC, 0x00, 0x3F,
-    0x00, 0x03, 0xF3, 0xF0, 0xBF, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x3F, 0x01, 0x54, 0x00, 0x02,
-    0xFC, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x03, 0xF9, 0x5F, 0xE4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xD0, 0x05, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x1F, 0xD0, 0x02, 0xFD,
-    0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x04, 0xBF, 0x96, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x03, 0xFF, 0xF4, 0x02, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x1C, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5,
-    0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF,
-    0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x05, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x55, 0x7F, 0xD0, 0x00, 0x7C, 0x00, 0x01,
-    0xFF, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F, 0xF4, 0x00,
-    0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x00, 0x00,
-    0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x08,
-    0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F,
-    0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x07, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0x01, 0x6F, 0xC0, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xEF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0x40, 0x00,
-    0x00, 0xA8, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0,
-    0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B,
-    0xF9, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFB, 0xF4, 0x00, 0x07, 0xFC, 0x2F, 0xC0, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x0A, 0x40, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00,
-    0xFF, 0x4B, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F,
-    0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x2A, 0xFF, 0xEA, 0x90, 0x0F, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xC0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xFD, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0x00, 0x00,
-    0x07, 0xF8, 0x0B, 0xFE, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00, 0xBF,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD,
-    0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x2A, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x2F, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF,
-    0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF,
-    0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x02, 0xF8, 0x00, 0xFD, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x1F, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xEF, 0xF4, 0x0B, 0xFC, 0x2F,
-    0xF4, 0x7F, 0xC0, 0x2F, 0xF0, 0x7C, 0x00, 0x2F, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x95, 0xBF, 0xFD, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x00,
-    0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x1F, 0xCF, 0xFD,
-    0x00, 0x7F, 0xF0, 0x01, 0xFC, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x1F, 0xC0, 0xFF, 0xD0, 0x0F, 0xFD,
-    0x02, 0xFC, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x2F, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC2, 0xF8, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x6F, 0x80, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF9, 0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xF7, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0x41, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x20,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03,
-    0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0xBF,
-    0xF8, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00,
-    0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80,
-    0x2F, 0xF4, 0x00, 0x2F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x5B, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF5, 0x40, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x5F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x0F, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x0F, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xBF, 0x42, 0xFD, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF5,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0,
-    0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0,
-    0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE,
-    0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF,
-    0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00,
-    0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00,
-    0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F,
-    0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x80, 0x00, 0x01, 0xFF, 0xC2, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xE3, 0xFF, 0xC0, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x0B, 0xD0, 0x00, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x03, 0xF4,
-    0x2F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00,
-    0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-    0xFE, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0,
-    0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1,
-    0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x69, 0x40, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0x82, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xBF, 0xFF, 0x9B, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0xFF,
-    0x80, 0x0F, 0xF0, 0x2F, 0xE0, 0x1F, 0xF0, 0x02, 0xFE, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xEB,
-    0xFD, 0x00, 0x3F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xE0, 0x3F, 0xFD, 0x00, 0x0A, 0x03, 0xFE, 0x0B, 0xFF, 0xE0, 0x03, 0xF0, 0x3F, 0xF6, 0xFA, 0xFF,
-    0x96, 0xFF, 0x02, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0,
-    0x0F, 0xF4, 0x00, 0x40, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0,
-    0x1F, 0x43, 0xFF, 0xEB, 0xFD, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xFE, 0x6F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xFE, 0x01, 0xFE, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0xBF, 0x41, 0xFD, 0x1F, 0xF4, 0x0B, 0xFB, 0xFF, 0x40, 0x3F, 0xFF,
-    0xE0, 0x00, 0xFF, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x0F, 0xF4, 0x01, 0xFC, 0x3F, 0xF5, 0x7F,
-    0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xF9, 0xBF, 0xC0,
-    0x07, 0xF4, 0x0F, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x02, 0xFD,
-    0x00, 0x7F, 0x47, 0xFD, 0x00, 0x2F, 0xEF, 0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x02, 0x40, 0x3F, 0xD0, 0x07, 0xF0, 0x0F, 0xFD, 0x5F, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0x9B, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF8,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x1F, 0xD1, 0xFF, 0x40, 0x2F, 0xEF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x3F, 0xD0, 0x07, 0xF0,
-    0x3F, 0xF5, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x01, 0xFF, 0x0F,
-    0xF4, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0x00,
-    0xBF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF, 0x40, 0x0B, 0xFB, 0xFF, 0x40,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x0F, 0xF4, 0x01,
-    0xFC, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB4, 0x00, 0x7F, 0x00, 0x1F, 0xF0,
-    0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFC, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0xBF, 0xFC, 0xBF, 0xFF, 0x2A, 0xFF, 0x80, 0x2F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x02, 0xFE, 0x00,
-    0xFF, 0x40, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x09, 0x7F, 0xEF, 0xAF,
-    0xFF, 0xDB, 0xFF, 0xE0, 0xFF, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0A, 0xBF, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xC2, 0x40, 0x1F, 0xFB, 0xE0, 0x0B, 0xFF, 0xF4,
-    0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xE4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xF8, 0x01, 0xFE, 0xFC, 0x03, 0xF4, 0xBE, 0x0F, 0xD0, 0x3F,
-    0x2F, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x2F, 0xFF, 0x00, 0xBF,
-    0xFF, 0x00, 0xAB, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x7F, 0xC2, 0x40, 0x7F, 0xEF, 0x80, 0xBF, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x3F, 0xE4, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0xFF, 0x4B, 0xF8, 0x7F, 0xC3, 0xFD, 0x0F,
-    0xD0, 0xFE, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90, 0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0xF0, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xFD, 0x00, 0x00, 0x1D, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF8, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0xC0,
-    0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x83,
-    0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x0B,
-    0xFC, 0x02, 0xFF, 0x97, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x1F, 0xFC,
-    0x3E, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xE3, 0xFF, 0xC0, 0x00, 0x0F, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x69, 0x00, 0xBF, 0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF, 0xAF, 0xFF,
-    0xF0, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B, 0xF8, 0x01,
-    0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0xFF, 0x80,
-    0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xF0,
-    0xC3, 0xFE, 0x00, 0xBF, 0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF, 0xD2, 0xFE,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x2F, 0xF0, 0x1F, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC3, 0xFD, 0x00, 0x2F, 0xF2, 0xFF, 0x00, 0x0B, 0xFC, 0xFF, 0xC0, 0x03, 0xFE, 0x3F, 0xE0,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x2F, 0xF0, 0x2F,
-    0xF4, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFB, 0xFF, 0x40, 0x2F, 0xF0, 0x1F, 0xF8, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x0B, 0xFC, 0x0F, 0xF4, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x0B, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80,
-    0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x80, 0x00, 0x0F, 0xFC, 0x2F, 0x00, 0x03, 0xFF, 0xFB, 0xF0, 0x00, 0x3E, 0x2F,
-    0xFD, 0x00, 0x03, 0xC0, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8,
-    0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0xBD, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B,
-    0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x01, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0xBC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xEB, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x07, 0xEB, 0xFC,
-    0x00, 0x3F, 0xE2, 0xF4, 0xBF, 0x80, 0x03, 0xFD, 0xBD, 0x0F, 0xF4, 0x00, 0x3F, 0xFF, 0x01, 0xFF,
-    0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x02, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xD1, 0xFF, 0xF8,
-    0x00, 0x00, 0x24, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F,
-    0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF,
-    0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D,
-    0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A,
-    0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01,
-    0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF,
-    0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF4,
-    0x0F, 0x80, 0x00, 0x0F, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00,
-    0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40,
-    0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F,
-    0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F,
-    0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6,
-    0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00,
-    0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x01, 0xA0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF7, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3D, 0x06, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x68, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x2F, 0xFF, 0xC0,
-    0x00, 0x1F, 0xDB, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0xF8, 0xBF, 0xD0, 0x00, 0x3F, 0xFE, 0x07, 0xFD,
-    0x00, 0x03, 0xFF, 0x80, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x1A, 0x00,
-    0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F,
-    0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xAA, 0xAA,
-    0x80, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB,
-    0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02,
-    0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xBF, 0x80, 0x00, 0x50, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x50, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x90, 0x7F,
-    0xC0, 0x1F, 0xFD, 0x00, 0x0B, 0xF0, 0x0F, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xFD, 0x00, 0x00, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x02, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x3F, 0xFF, 0x40, 0x1B, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFD, 0x0B, 0xC0, 0x03, 0xFD,
-    0x00, 0x10, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0x00,
-    0x3F, 0xF0, 0x07, 0xD0, 0x0F, 0xFF, 0xAF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xF0, 0x00,
-    0x00, 0x2F, 0xD1, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x1F, 0x80, 0x00, 0x06, 0x80, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8,
-    0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8,
-    0x01, 0xFF, 0x42, 0xF0, 0x03, 0xFD, 0x00, 0x10, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x80, 0x3F, 0xF0, 0x07, 0xD0, 0x3F, 0xFE, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x41, 0xFF,
-    0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F, 0xF4, 0x00, 0x03, 0xF0,
-    0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0x00, 0x6F, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0x42, 0xF0, 0x0F, 0xF4, 0x00, 0x40, 0xBF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x80, 0xFF, 0xC0, 0x1F, 0x43, 0xFF, 0xEB, 0xFD,
-    0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x1E, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xD0, 0x00, 0x07, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0xBF, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0x41, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xE0, 0x3F,
-    0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x08, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0xFF, 0xFD,
-    0x00, 0x6F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x06, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0xBF, 0x2F, 0xC0,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x42,
-    0xF0, 0x00, 0x3F, 0xD0, 0x01, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x80, 0x03, 0xFF, 0x00, 0x7D, 0x00, 0x3F, 0xFE, 0xBF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x65, 0xFF, 0x81, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x05, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC2, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xD0, 0x00, 0x00, 0x69, 0x1F, 0xF0, 0x10,
-    0x00, 0x01, 0xFF, 0xFB, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xEF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF,
-    0x80, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x2F, 0xBF, 0x0B,
-    0x00, 0x03, 0xFF, 0x6F, 0x9F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x87, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x65, 0xFF, 0x81, 0xBF,
-    0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x2A, 0xFF, 0xEA, 0x90, 0x0F, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0xAB, 0xFF, 0xEA, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xAA, 0xFF, 0xE8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xAA, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF6, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0xFF,
-    0xD0, 0x00, 0x3F, 0xE0, 0x2F, 0xFC, 0x00, 0x03, 0xFE, 0x0B, 0xEF, 0xC2, 0xC0, 0x3F, 0xF6, 0xF9,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x0F, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x05, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFC, 0x00, 0x02,
-    0xFF, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x0B,
-    0xFD, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x2F, 0xE6, 0xFF,
-    0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x0B, 0xF0, 0x0F, 0xF0, 0x03, 0xF8, 0x0B,
-    0xF4, 0x01, 0xFD, 0x1F, 0xF4, 0x00, 0xBF, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x3F, 0xF5, 0x7F, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00,
-    0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0xE0,
-    0x01, 0xC0, 0x01, 0xFD, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC,
-    0x00, 0xFE, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF,
-    0x40, 0x0B, 0xFB, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x90, 0x0F, 0xF4, 0x01, 0xFC, 0x03, 0xFF, 0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0,
-    0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6,
-    0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4,
-    0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F,
-    0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16,
-    0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01,
-    0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F, 0xE0, 0x1F, 0xE0, 0xBF, 0x00,
-    0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F, 0xC3, 0xFF, 0x57, 0xFE, 0x07,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF9, 0x50, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F,
-    0xC0, 0x00, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0,
-    0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x00,
-    0x06, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xF9, 0xBF, 0xC0, 0x01, 0xFD, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x7F, 0x80, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0xFE, 0x02, 0xFD, 0x00, 0x1F, 0xD1,
-    0xFF, 0x40, 0x02, 0xFE, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x90, 0x03, 0xFD, 0x00, 0x7F, 0x00, 0x3F, 0xF5, 0x7F, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F,
-    0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xF8, 0x2F, 0xEA, 0x40, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x6F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF9,
-    0x05, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x70,
-    0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00,
-    0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00,
-    0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F,
-    0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x40, 0x00, 0x00, 0x0F, 0x80, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4,
-    0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x2F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00,
-    0x0B, 0xFF, 0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8,
-    0x00, 0x03, 0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x82, 0xFE, 0xA4, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xF8, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE6, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x2F, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0xBF,
-    0xC0, 0x03, 0xFF, 0x90, 0x5F, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFD, 0x00, 0x7F, 0xC0, 0x1F, 0xFD, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0xFF, 0xD0, 0x00, 0x03, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x14, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xF8, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xF8, 0x00, 0x03,
-    0xFD, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0x1F, 0xFF, 0xE5, 0x5F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0xBF, 0xA9, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xF9, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xBF, 0xFF, 0xD0, 0x00, 0x7F, 0xD0, 0x0B, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xE4, 0x17,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1B,
-    0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0x90, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x0B, 0xC0,
-    0x00, 0x19, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x29, 0x00, 0x03, 0xFD, 0x0F, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0x00, 0x3F,
-    0xDF, 0xFF, 0xF4, 0x01, 0xFE, 0xFD, 0x3F, 0xD0, 0x0B, 0xFF, 0xC0, 0xFF, 0x00, 0x3F, 0xFC, 0x07,
-    0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07, 0xFF,
-    0xE1, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x05, 0x7F, 0xF5, 0x55, 0x5B, 0xFE, 0x54, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x2A, 0xFF, 0xEA, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xAF, 0xFA, 0x90, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFD, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0x00, 0x7F, 0xCF, 0xFF,
-    0xF4, 0x01, 0xFE, 0xFE, 0xBF, 0xD0, 0x0B, 0xFF, 0xD0, 0xFF, 0x00, 0x3F, 0xFD, 0x07, 0xFC, 0x00,
-    0xFF, 0xE0, 0x2F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0xC0,
-    0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x92, 0xFF, 0x00, 0x7F, 0xEF, 0xCF, 0xF8, 0x02, 0xFF, 0xFE, 0x3F, 0xD0, 0x07, 0xFF, 0xE1, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x38, 0x00, 0x03, 0xFF, 0x8B, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC7, 0xFF, 0x40,
-    0x00, 0x70, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xB8, 0x02, 0x01, 0xFF, 0xC3, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x7E, 0x3F, 0xFC, 0x0F, 0x03, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90,
-    0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x6A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xAA, 0xAA, 0x03, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xF0, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xBF,
-    0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2A, 0xFF, 0x80, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0F,
-    0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x09, 0x00, 0x7F, 0xEF, 0x80, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xE0, 0x00, 0xFF, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x70, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x1F, 0xFA, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x01, 0xD0, 0xFE, 0x02, 0xF0, 0x3F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0B,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xAF, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0x90, 0x07, 0xFE, 0xF8, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xA8,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x02, 0xFF, 0xF0, 0xBF, 0xFF, 0x0A, 0xBF, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC,
-    0x24, 0x7F, 0xEF, 0x8B, 0xFF, 0xF4, 0xBF, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00,
-    0x3D, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0x54, 0x07, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x68, 0x0B, 0xFF, 0xCB, 0xFF, 0xF2, 0xAF, 0xF8, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x1F, 0xF0, 0x97, 0xFE, 0xFA, 0xFF, 0xFD, 0xBF, 0xFE, 0x0F, 0xF9, 0x00, 0x50, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x07, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x01, 0x60, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0xBF, 0xFF, 0x01, 0xFF, 0xFC, 0x0A, 0xBF, 0xE0,
-    0x1A, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x24, 0x0B, 0xFC, 0x00, 0x7F, 0xEF, 0x80, 0xFF, 0x80, 0x0B,
-    0xFF, 0xF4, 0x0F, 0xF4, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x40, 0x2F, 0xF0, 0x00,
-    0x05, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x10, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0x42, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFB, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x06,
-    0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x02, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0x5F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x40, 0x1F, 0xF0, 0x00, 0x00, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x2F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF7,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x64, 0x00, 0x3F,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xF2, 0xFF, 0xF8, 0x03, 0xF7, 0xFA, 0xFF, 0x01, 0xFE, 0xE0, 0x3F, 0x80,
-    0xBF, 0xE0, 0x0F, 0xE0, 0x3F, 0xF0, 0x0B, 0xF0, 0x0F, 0xF4, 0x07, 0xF4, 0x07, 0xFC, 0x0B, 0xF4,
-    0x02, 0xFF, 0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x1F, 0xF3, 0xFD,
-    0x00, 0x07, 0xFC, 0x7F, 0xD0, 0x02, 0xFE, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0xFE, 0x3F, 0xD0,
-    0x0F, 0xFF, 0x5F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0x0A, 0x02, 0xFF, 0xE0, 0x0B, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0xCA, 0xBF, 0xD0, 0xFF, 0xF8, 0x02,
-    0xFD, 0x3F, 0xEF, 0x40, 0x3F, 0xCB, 0xF0, 0x00, 0x03, 0xFD, 0xF8, 0x00, 0x00, 0x7F, 0xBE, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x01, 0xFF,
-    0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x38, 0x3F, 0xD0, 0xFF, 0xEF,
-    0xC3, 0xFC, 0x07, 0xFF, 0xF4, 0x7F, 0xC0, 0x3F, 0xFE, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00,
-    0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x02,
-    0xFE, 0x00, 0x2F, 0xFE, 0x02, 0xFF, 0xFC, 0x03, 0xFF, 0x90, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x0B, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC3, 0x00, 0xBF, 0xEF, 0x40, 0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE,
-    0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xFC, 0x30, 0x0B, 0xFE, 0xF4, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xFF, 0xF1, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFE, 0x2F, 0x40, 0x01, 0xFF, 0xFF, 0x83, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x3D,
-    0x00, 0x00, 0x1F, 0xF8, 0x03, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x19, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xFE,
-    0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x50, 0x2F, 0xFF, 0x0B,
-    0xE2, 0xFF, 0xFC, 0x3F, 0x8B, 0xFF, 0xF0, 0xFD, 0x00, 0xBF, 0x87, 0xF0, 0x03, 0xFE, 0x2F, 0x40,
-    0x0F, 0xF4, 0xBC, 0x00, 0x7F, 0xC3, 0xD0, 0x02, 0xFF, 0x01, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x0C, 0x00, 0x0B, 0xFE, 0xF4, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7C, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0x80, 0x01,
-    0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xF8, 0x00, 0x0F,
-    0xFC, 0x00, 0x10, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x64, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xFE,
-    0x00, 0x0F, 0xE0, 0x02, 0xFF, 0x40, 0x1B, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F,
-    0xC0, 0x68, 0x0B, 0xFC, 0x1F, 0xF0, 0xBF, 0x83, 0xFF, 0x0F, 0xF4, 0x3F, 0xD0, 0xFF, 0x03, 0xF8,
-    0x1F, 0xF0, 0x04, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x30, 0x00, 0xBF, 0xEF, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x08, 0x00, 0x00,
-    0x07, 0xFF, 0xBE, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xAF, 0xF4,
-    0x00, 0x00, 0x04, 0x3F, 0xF0, 0x00, 0x19, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00,
-    0x7F, 0x00, 0x7F, 0xE0, 0x00, 0xFE, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x50, 0x00, 0x2F, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x40, 0x03, 0xFE, 0xF4, 0x01, 0xFF,
-    0xFD, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x3E, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF,
-    0x0C, 0x00, 0xBF, 0xEF, 0x40, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0xFF, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x5F, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC3, 0xFF, 0x41, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xF0, 0xBF,
-    0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0x8F, 0xF0, 0x00,
-    0x00, 0xBF, 0x40, 0x3F, 0xF7, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F,
-    0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x1A, 0x40, 0x2F, 0xFE, 0x07, 0xFF, 0x43, 0xFF, 0xF8, 0xBF, 0xFF, 0x0A, 0xBF, 0xEB, 0xFF, 0xFC,
-    0x00, 0xBF, 0xBE, 0x2F, 0xF0, 0x03, 0xFF, 0xE0, 0x7F, 0xC0, 0x0F, 0xFF, 0x02, 0xFE, 0x00, 0x7F,
-    0xF0, 0x0F, 0xF4, 0x02, 0xFF, 0x80, 0x3F, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x0B,
-    0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xD0, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x30,
-    0xFF, 0x80, 0x2F, 0xFB, 0xD3, 0xFD, 0x00, 0xFF, 0xFF, 0x1F, 0xF0, 0x02, 0xFF, 0xF4, 0xBF, 0x80,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF5, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00,
-    0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xF8, 0xFF, 0x00, 0x00, 0x0B, 0xF4,
-    0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x69, 0x00, 0xBF, 0xF8, 0x1F, 0xFD, 0x0F, 0xFF, 0xE2, 0xFF, 0xFC, 0x2A, 0xFF,
-    0xAF, 0xFF, 0xF0, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x0F, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xFC, 0x0B,
-    0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x0B, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFC, 0x00,
-    0xFF, 0x80, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0xC0,
-    0x1F, 0xF0, 0xC3, 0xFE, 0x00, 0xBF, 0xEF, 0x4F, 0xF4, 0x03, 0xFF, 0xFC, 0x7F, 0xC0, 0x0B, 0xFF,
-    0xD2, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xFF,
-    0x40, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x7F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xFD, 0x07,
-    0xF4, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0x00,
-    0x00, 0x07, 0xF8, 0x0B, 0xFE, 0x3F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0xDF, 0xE0, 0x00, 0x00,
-    0xBF, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x02, 0x40, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x07, 0xF0, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x06, 0x90, 0x0B, 0xFF, 0x81, 0xFF, 0xD0, 0xFF, 0xFE, 0x2F, 0xFF, 0xC2, 0xAF,
-    0xFA, 0xFF, 0xFF, 0x00, 0x2F, 0xEF, 0x8B, 0xFC, 0x00, 0xFF, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0xC0,
-    0xBF, 0x80, 0x1F, 0xFC, 0x03, 0xFD, 0x00, 0xBF, 0xE0, 0x0F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xC0,
-    0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xFC,
-    0x01, 0xFF, 0x0C, 0x3F, 0xE0, 0x0B, 0xFE, 0xF4, 0xFF, 0x40, 0x3F, 0xFF, 0xC7, 0xFC, 0x00, 0xBF,
-    0xFD, 0x2F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x59, 0x00, 0x1A, 0x40, 0x3F, 0x82, 0xFF,
-    0xE0, 0x7F, 0xF4, 0x2F, 0x83, 0xFF, 0xF8, 0xBF, 0xFF, 0x01, 0x00, 0xAB, 0xFE, 0xBF, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xBE, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFE,
-    0x02, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x03,
-    0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC3, 0x00, 0x00,
-    0xFF, 0x80, 0x2F, 0xFB, 0xD0, 0x00, 0x3F, 0xD0, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
-    0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00,
-    0x07, 0xF5, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF,
-    0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F,
-    0xF8, 0xFF, 0x00, 0x00, 0x0B, 0xF4, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x69, 0x02, 0xFF, 0xE0, 0x7F,
-    0xF4, 0xFF, 0xFE, 0x2F, 0xFF, 0xCA, 0xBF, 0xEB, 0xFF, 0xFC, 0x02, 0xFE, 0xF8, 0xBF, 0xC0, 0x3F,
-    0xFE, 0x07, 0xFC, 0x03, 0xFF, 0xC0, 0xBF, 0x80, 0x7F, 0xF0, 0x0F, 0xF8, 0x0B, 0xFE, 0x00, 0xFF,
-    0x40, 0xFF, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x03, 0xFD, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x7F, 0xC0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F,
-    0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x03, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x0D, 0x00, 0x03, 0xFC, 0x07, 0xD0, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F,
-    0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x07,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x03,
-    0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x95, 0xBF, 0xFC, 0x00,
-    0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x40, 0x00,
-    0x1F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xF8,
-    0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0xF9,
-    0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x3F, 0xC3,
-    0xFC, 0x00, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x00, 0x03, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFB, 0xFF, 0x40, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x2F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0x90, 0x0F, 0xF8, 0x01, 0x7F, 0x40, 0x2F, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xC0,
-    0x1F, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xF0,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0xBC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF4,
-    0x00, 0x2F, 0xC0, 0x0B, 0xFF, 0xE5, 0x6F, 0xFD, 0x00, 0x5F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A,
-    0x40, 0x00, 0x69, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFE, 0xFF, 0xBF, 0xD7, 0xFC, 0x02, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x03, 0xFF, 0xC0, 0x3F, 0xC0, 0xFF, 0x80, 0x0B, 0xFD, 0x02, 0xFD, 0x07, 0xFD, 0x00, 0x2F,
-    0xF0, 0x1F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x83, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0xD0,
-    0x03, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xE0,
-    0x03, 0xFF, 0x40, 0x01, 0x80, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x2F, 0x02, 0xFF, 0x42, 0xFF, 0xFE,
-    0x5B, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81,
-    0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0,
-    0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x01, 0xA0, 0x2F, 0xFE, 0x0B, 0xFC, 0xFF, 0xFE,
-    0x2F, 0xFC, 0xAB, 0xFE, 0x7F, 0xFC, 0x01, 0xFD, 0xFF, 0xF8, 0x02, 0xFE, 0xF4, 0x10, 0x03, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x1A, 0x00, 0x2F, 0xFE, 0x0B, 0xFC, 0x0F, 0xFF, 0xE2,
-    0xFF, 0xC0, 0xAB, 0xFE, 0x7F, 0xFC, 0x00, 0x1F, 0xDF, 0xFF, 0x80, 0x02, 0xFE, 0xF4, 0x10, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xC1, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x55, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x7F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x1B, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x00,
-    0x00, 0x7F, 0xD0, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x03,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x18, 0x00, 0x0F, 0x80, 0x2F, 0x80, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x1A, 0x00, 0xBF, 0xF8, 0x2F, 0xF0, 0xFF, 0xFE, 0x2F, 0xFC, 0x2A, 0xFF, 0x9F, 0xFF, 0x00,
-    0x1F, 0xDF, 0xFF, 0x80, 0x0B, 0xFB, 0xD0, 0x40, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xD0, 0x0B, 0xFC,
-    0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xD0, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x3F, 0x00, 0x07, 0xFF, 0x01, 0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xF0, 0x00, 0x3F, 0xF0,
-    0x3F, 0xD0, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x2F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xBF, 0x80, 0x07, 0xFC, 0x02,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3C,
-    0x00, 0xFF, 0x80, 0x2F, 0xC0, 0x2F, 0xE0, 0x0F, 0xFC, 0x0F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xAC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0B, 0xFB, 0xF8,
-    0x00, 0x00, 0xFF, 0x47, 0xF4, 0x00, 0x0F, 0xF4, 0x07, 0xD0, 0x00, 0x1A, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0,
-    0x0F, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F,
-    0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x07,
-    0xF0, 0xFD, 0x00, 0x0F, 0xD0, 0x3E, 0x00, 0x2F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xBF,
-    0xAB, 0xF8, 0x01, 0xFF, 0x00, 0xB0, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xE0, 0x0F, 0x00, 0x3F, 0xE0, 0x2F, 0xC0, 0x2F, 0xE0, 0x3F, 0xF0, 0x3F, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xF4, 0x02, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0x00,
-    0x3F, 0xF0, 0x01, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x7F,
-    0x00, 0x03, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xFC, 0x0F, 0xF4, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x0B,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00,
-    0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x80, 0x2F, 0xEA, 0xFE, 0x01, 0xFF, 0x00, 0xB0, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0x00, 0x3F, 0xE0, 0xBF, 0x00, 0xBF, 0x83,
-    0xFF, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x78, 0x00, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xE0,
-    0x07, 0xF4, 0x00, 0xBF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0xFF, 0xC0, 0x07,
-    0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x1F, 0xC0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF4, 0x0B,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x00, 0x00, 0xBC, 0x02, 0xFC, 0x00,
-    0x0B, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFA, 0xBF, 0x80, 0x01, 0xFF, 0x00, 0xB0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0x00, 0x3F, 0xE0, 0x02, 0xFC, 0x02,
-    0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF,
-    0x00, 0xFF, 0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02,
-    0x80, 0x3F, 0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF, 0xEB, 0xFC,
-    0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x01, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0x95, 0xFF, 0xD5, 0x7F, 0x8B, 0xF0, 0x0F, 0xFC, 0x03, 0xF4, 0xBE, 0x01, 0xFF, 0x80, 0x3F,
-    0x0B, 0xD0, 0x2F, 0xF4, 0x07, 0xE0, 0x28, 0x03, 0xFF, 0x00, 0x68, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x68, 0x3E, 0x00, 0x00, 0xBF, 0x1F, 0x00, 0x00, 0x7F, 0xC7, 0x40,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x50, 0x00, 0xFF, 0xC0, 0xBC, 0x00,
-    0x3F, 0xFA, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF, 0xC0, 0x3F,
-    0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F, 0xF0, 0x06,
-    0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xA8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x05, 0xBF, 0xD5,
-    0x40, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x0B, 0xFC, 0x01, 0x40, 0x3F, 0xF0, 0x2F, 0x00, 0xFF, 0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x01, 0x80, 0x00, 0x02, 0xFF, 0x83, 0xE0, 0x00, 0x03, 0xFF, 0xEF,
-    0xD0, 0x00, 0x07, 0xD3, 0xFF, 0xC0, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F,
-    0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF,
-    0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00,
-    0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D,
-    0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD,
-    0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x03, 0xE0, 0x01,
-    0xC0, 0x00, 0x03, 0xF8, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF,
-    0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00,
-    0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-    0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0xFD, 0xBD, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
-    0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F,
-    0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0,
-    0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-    0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x4B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD,
-    0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0xF0, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0xFF,
-    0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xC0, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54,
-    0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00,
-    0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03,
-    0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF,
-    0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4,
-    0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,
-    0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F,
-    0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B,
-    0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0,
-    0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-    0xFF, 0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x50,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x3F, 0xFF, 0xEB, 0xFF, 0xFF, 0x80,
-    0x2F, 0x80, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x0F, 0xF0, 0x02, 0xFF, 0xF8, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x3F,
-    0xF0, 0x2F, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0x0B, 0xFC, 0x0F, 0xDF, 0xF0, 0x2F, 0xD0, 0x00, 0x02,
-    0xFF, 0x07, 0xF2, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xC3, 0xF4, 0xBF, 0x4B, 0xF4, 0x00, 0x00,
-    0x1F, 0xF1, 0xFC, 0x2F, 0xD3, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFD, 0x07, 0xF6, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x7F, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0A, 0x40, 0x06, 0x80,
-    0xBF, 0xF0, 0x0F, 0xF4, 0x0F, 0xFC, 0x7F, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x5B, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF4, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFC, 0x00,
-    0xFF, 0x40, 0xFF, 0x80, 0xFF, 0x00, 0x2F, 0xE0, 0x7F, 0xF0, 0x3F, 0x80, 0x07, 0xF8, 0x2F, 0xFC,
-    0x1F, 0xC0, 0x00, 0xFE, 0x0F, 0xFF, 0x0B, 0xF0, 0x00, 0x3F, 0xC7, 0xFF, 0xC3, 0xF4, 0x00, 0x0F,
-    0xF3, 0xFB, 0xF2, 0xFC, 0x00, 0x03, 0xFE, 0xF5, 0xFD, 0xFC, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFD,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0x07, 0xE0, 0x00, 0x00, 0x1A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x7F, 0x80, 0x00, 0x01, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xFE, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x3E, 0x00,
-    0x00, 0x03, 0xF4, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F,
-    0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF,
-    0xC0, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x94, 0x02, 0xFF, 0xD0, 0x1F, 0xC0, 0x01, 0xFF,
-    0xE0, 0x07, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x19, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xC0,
-    0x0F, 0xFE, 0x00, 0x07, 0xF0, 0x0F, 0xFF, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0x00, 0x06, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x68, 0x00, 0xFF, 0xF4, 0x3F, 0xC0, 0xFF, 0xFF, 0xEF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0xE6, 0xFF, 0xF4, 0x07, 0xF0, 0x0B, 0xF4, 0x00, 0xF4, 0x0B,
-    0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xE0, 0x07, 0xFC, 0x00, 0xBD, 0x03,
-    0xFF, 0xFA, 0xBF, 0x83, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xBF, 0xFF, 0xF0, 0x2F, 0x42, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x0B, 0xFF, 0x40, 0x7F, 0x00, 0x07, 0xFF, 0x80, 0x1F,
-    0xC0, 0x03, 0xFF, 0x80, 0x03, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x64, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0xF8,
-    0x00, 0x1F, 0xC0, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x1B, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x1A, 0x00, 0x3F, 0xFD, 0x0F, 0xF0, 0x3F, 0xFF,
-    0xFB, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x07, 0xF9, 0xBF, 0xFD, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x3D,
-    0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x38, 0x01, 0xFF, 0x00, 0x2F,
-    0x40, 0xFF, 0xFE, 0xAF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xEF, 0xFF, 0xFC, 0x0B, 0xD0, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0xBF,
-    0x40, 0x00, 0x0F, 0xD0, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFE, 0x50, 0x0B, 0xFF, 0x40, 0x7F, 0x00, 0x07, 0xFF, 0x80,
-    0x1F, 0xC0, 0x03, 0xFF, 0x80, 0x03, 0xD0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x64, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x00, 0x3F,
-    0xF8, 0x00, 0x1F, 0xC0, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x2F, 0xFC, 0x00, 0x1B, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x03, 0xE0, 0x0F, 0xE0, 0x00, 0xFC, 0x0F,
-    0xE0, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x01, 0xA0, 0x03, 0xFF, 0xD0, 0xFF, 0x03, 0xFF, 0xFF, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0x9B, 0xFF, 0xD0, 0x1F, 0xC0, 0x2F, 0xD0, 0x03, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x03, 0x80, 0x1F, 0xF0, 0x02, 0xF4, 0x0F, 0xFF, 0xEA, 0xFE, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x87, 0xFE, 0xFF, 0xFF, 0xC0, 0xBD, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7C, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x40, 0x0F, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xE5, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x69, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0xFB, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xBF, 0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x03,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xE1, 0xFF, 0x42, 0xFF, 0xD2,
-    0xFC, 0x2F, 0xF0, 0x0B, 0xFE, 0x1F, 0x83, 0xFF, 0x00, 0x7F, 0xF0, 0x10, 0x3F, 0xF0, 0x07, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x0F, 0xFD, 0x6F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xD7, 0xF8, 0x00, 0x00, 0x1F,
-    0xD0, 0x28, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xA4, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0xC0, 0x00, 0x1F, 0xD3,
-    0xFF, 0xF4, 0x00, 0x0B, 0xF7, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-    0x2F, 0xF0, 0x00, 0x7F, 0xF4, 0x0B, 0xFC, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFF,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x0F, 0xF4, 0x14, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x06, 0x00, 0x3F, 0xF0, 0xBD, 0x00, 0xFF,
-    0xEF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1C, 0x0F, 0xD0, 0x01, 0xF9, 0xBF, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0x5B, 0xFE,
-    0x56, 0xFC, 0xBF, 0x80, 0xBF, 0xD0, 0x2F, 0xCB, 0xF4, 0x0F, 0xFC, 0x02, 0xF8, 0x7F, 0x40, 0xFF,
-    0xC0, 0x2F, 0x40, 0xA0, 0x0F, 0xF8, 0x02, 0x90, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xF9, 0xFE, 0x00, 0x0B, 0xF8, 0x0E,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x01, 0x40, 0x03, 0xFF, 0x02, 0xF0, 0x00, 0xFF, 0xEB, 0xFC, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9,
-    0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD,
-    0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F, 0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x04,
-    0x00, 0x00, 0x00, 0xFF, 0xC1, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x59, 0x00, 0x01, 0x6F, 0xF0, 0x1F, 0xFF,
-    0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00,
-    0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x00, 0x1F, 0xF6, 0xFC, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x0B, 0xFE,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0xF4, 0x0B, 0xF0, 0x2F,
-    0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x3F, 0x80, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3F, 0x02,
-    0xFD, 0x1F, 0xF0, 0xFF, 0x0B, 0xF4, 0x3F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF8, 0x02, 0xFE, 0xFC, 0x07, 0xF0, 0xFD, 0x1F, 0xD0,
-    0x3E, 0x3F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x18, 0x2F, 0xF8, 0x3E, 0x3F, 0xFE, 0xFD,
-    0x7D, 0x3F, 0xFC, 0x38, 0x1F, 0xF0, 0x00, 0x01, 0x00, 0x1A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFC, 0x15, 0x55, 0x50, 0x09, 0x00, 0x04, 0x3E, 0x00, 0x1C, 0x3F, 0x80, 0xBC, 0x3F, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x06, 0x83, 0xFD, 0x7F, 0xD7, 0xFC, 0x3F, 0x40, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFD, 0x7F, 0x43, 0xF8, 0x04,
-    0x00, 0x40, 0x06, 0xF9, 0x0F, 0xFF, 0xDB, 0xE7, 0xFB, 0xE0, 0xBE, 0x24, 0x3F, 0x00, 0x3F, 0x40,
-    0xFF, 0x00, 0x3E, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0xBF, 0xF4, 0x1F, 0xEF,
-    0xC3, 0xE0, 0x7C, 0x3D, 0x03, 0xC3, 0xD0, 0xBC, 0x3F, 0x6F, 0x81, 0xFF, 0xE0, 0x06, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x1F, 0xC2, 0xFC, 0x0F, 0xF1, 0xFE, 0x0F, 0xF0, 0xFF,
-    0x0B, 0xF0, 0xBF, 0x03, 0xF0, 0x7F, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x60, 0xBC, 0x02, 0xFC, 0xBD, 0x0B, 0xF0, 0x7F, 0x2F, 0xC0, 0x3F, 0xFF, 0x00, 0x1F, 0xFD, 0x00,
-    0x0F, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x09, 0x03, 0xF0, 0xFC, 0x0F, 0xC3,
-    0xF0, 0x3F, 0x4F, 0xD0, 0x7F, 0x1F, 0xC0, 0xBC, 0x2F, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x1F, 0xFF, 0xC1, 0xFF, 0xFF, 0x8F, 0xD5, 0xFF, 0x78, 0x00, 0xFD, 0x40, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBC, 0x07, 0xD0, 0x3F, 0x02, 0xF8, 0x0F, 0xE0, 0x3F,
-    0xC0, 0xBF, 0x40, 0xA4, 0x00, 0x07, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFE, 0x07, 0xF0, 0x2F, 0x81,
-    0xFC, 0x1F, 0xC0, 0x78, 0x00, 0x0F, 0xC3, 0xFD, 0xBF, 0x4F, 0xF0, 0xFE, 0x0B, 0xE0, 0x7F, 0x02,
-    0xF4, 0x0A, 0x00, 0x04, 0x00, 0xFC, 0x1F, 0xC2, 0xFC, 0x3F, 0x43, 0xF0, 0x3D, 0x07, 0xC0, 0x10,
-    0x00, 0x0B, 0xD0, 0xFF, 0x0F, 0xE1, 0xFD, 0x3F, 0x4B, 0xD0, 0xE0, 0x00, 0x00, 0x01, 0x01, 0xFC,
-    0x3F, 0xD7, 0xFD, 0x7F, 0x81, 0x90, 0x0F, 0x80, 0xBC, 0x3F, 0xC3, 0xFD, 0x7F, 0xC3, 0xFD, 0x7F,
-    0x43, 0xF8, 0x14, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xF8, 0x3E, 0xBD, 0x78, 0x2E, 0xB8, 0x2E, 0x7D,
-    0x7C, 0x3F, 0xF4, 0x06, 0x80, 0x00, 0x40, 0x1F, 0xC0, 0x7F, 0x40, 0xFD, 0x03, 0xF0, 0x2F, 0x02,
-    0xF4, 0x05, 0x00, 0x01, 0x50, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x3F,
-    0xC0, 0x29, 0x00, 0x00, 0x50, 0x07, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7F, 0x54, 0x3F,
-    0xFC, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x2F, 0xC3, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x0B, 0xF0, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x02, 0xFE,
-    0xFE, 0x03, 0xFC, 0x1F, 0xC3, 0xF8, 0x02, 0xF0, 0x24, 0x00, 0x10, 0x08, 0x00, 0x04, 0x3E, 0x00,
-    0x1C, 0x3F, 0x80, 0xBC, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x2C, 0x2F, 0xFC, 0x3E, 0x7F, 0xFF, 0xFD, 0x7C, 0x3F, 0xF8, 0x28, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x00, 0x1A,
-    0x40, 0x02, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x3F, 0x96, 0xFC, 0x3C, 0x00, 0xFC, 0x20, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x01, 0x00, 0x14,
-    0x07, 0xF4, 0x3F, 0x83, 0xFD, 0x2F, 0xE0, 0xFF, 0x0F, 0xF4, 0x3F, 0x41, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x07, 0xE0, 0xBD, 0x0F, 0xF5, 0xFF, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB, 0xFF,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE,
-    0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xF4, 0x00, 0x55,
-    0xFF, 0x41, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x00,
-    0x3F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x07, 0xFE, 0x53, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xFF, 0xEB, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x1F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF,
-    0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0B, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF1, 0x57, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xE0, 0x00,
-    0x0B, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xD0,
-    0x00, 0x07, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xDF, 0xF8, 0x00, 0x00, 0x03,
-    0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x47, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00, 0x02,
-    0xFD, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xE0, 0x00, 0x0B, 0xF0, 0x03, 0xFF, 0x00, 0x01,
-    0xFE, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0,
-    0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80,
-    0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF9, 0x40, 0x2F, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xFE, 0x00,
-    0x0F, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x01, 0x90, 0x01, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0xF0, 0x00, 0x6F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x02,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x0F,
-    0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x01, 0x4F, 0xFD, 0x2F, 0xF8, 0x7F,
-    0xFF, 0x8F, 0xFD, 0x3F, 0xF4, 0xFF, 0xFF, 0x4F, 0xFC, 0x3F, 0xF4, 0xFF, 0xFE, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0xD1, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFD, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xE7, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x06, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0x9B, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFB,
-    0xF8, 0x03, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0xC0, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x1F, 0xF0, 0xBF, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0x83, 0xFC, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0xFF, 0x6F, 0x82, 0xFF, 0x00, 0x00, 0x07,
-    0xF0, 0x3F, 0xEF, 0xC0, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x0B, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x00,
-    0xFD, 0x01, 0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x00,
-    0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xE0, 0x00,
-    0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xFD, 0x00,
-    0x06, 0xFF, 0x90, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF5, 0xFF, 0xC0, 0x3F,
-    0x80, 0x00, 0x02, 0xFC, 0x3F, 0xF4, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x2F, 0xF8, 0xFF, 0x00, 0x00, 0x0B,
-    0xF4, 0x03, 0xFF, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xEA, 0xAA, 0xAB, 0xFC, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x05, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xFA, 0x95, 0x6A, 0xBF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8,
-    0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x55, 0x57, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF9, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x65, 0xFF, 0x82, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x01, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFD, 0x6F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0xFF, 0xC0, 0x02, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0xBF, 0xC0, 0x01, 0xF8,
-    0x00, 0x2F, 0xF0, 0x00, 0x3F, 0x80, 0x0B, 0xFC, 0x00, 0x07, 0xF4, 0x02, 0xFF, 0xAA, 0xAA, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9, 0x5F, 0xFD, 0x57, 0xF8, 0xBF, 0x00, 0xFF,
-    0xC0, 0x3F, 0x4B, 0xE0, 0x1F, 0xF8, 0x03, 0xF0, 0xBD, 0x02, 0xFF, 0x40, 0x7E, 0x02, 0x80, 0x3F,
-    0xF0, 0x06, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0xBF, 0x43, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xF4, 0x12, 0xFF, 0x80,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x1F,
-    0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFB, 0xFF, 0xBF, 0xFC,
-    0x07, 0xFF, 0x03, 0xFD, 0x0F, 0xFD, 0x0F, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x2F, 0xF4, 0x07, 0xFC,
-    0x03, 0xFF, 0x3F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFF, 0x3F, 0xE0,
-    0x0F, 0xF4, 0x03, 0xFE, 0x3F, 0xF0, 0x1F, 0xF0, 0x0B, 0xFC, 0x3F, 0xF0, 0x2F, 0xF0, 0x2F, 0xF8,
-    0x1F, 0xFD, 0x3F, 0xE0, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xE0, 0x7F, 0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x8B, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xF4, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x90,
-    0x07, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xE3,
-    0xFD, 0x0B, 0xFF, 0xFF, 0x03, 0xFF, 0x0F, 0xF8, 0x1F, 0xFF, 0xE0, 0x2F, 0xF0, 0x3F, 0xE0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-    0xE0, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
-    0x40, 0xBF, 0xC0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xF8,
-    0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x7F, 0xE1, 0xFF, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x07,
-    0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF0, 0x01, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x1E, 0x3F, 0x0B, 0xF4, 0x00, 0xFF, 0x43, 0xF3,
-    0xF0, 0x3F, 0xC0, 0x7F, 0xC0, 0x7F, 0x7F, 0x55, 0xFD, 0x0F, 0xF5, 0x5F, 0xE7, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x69, 0x00, 0x60, 0x00, 0x0B, 0xFF, 0x80, 0xFC, 0x00, 0x3F, 0xFF, 0xD2, 0xFE, 0x00,
-    0xFF, 0xFF, 0xF3, 0xFC, 0x03, 0xFF, 0x43, 0xFB, 0xF8, 0x07, 0xFD, 0x02, 0xFF, 0xF0, 0x0F, 0xF8,
-    0x01, 0xFF, 0xD0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00,
-    0xFF, 0x00, 0x3F, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFD,
-    0x00, 0x3F, 0xF0, 0x3F, 0xFD, 0x05, 0x3F, 0xFA, 0xFF, 0x7F, 0xAE, 0x1F, 0xFF, 0xFD, 0x3F, 0xFE,
-    0x0F, 0xFF, 0xF4, 0x3F, 0xFC, 0x02, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xBF,
-    0xD7, 0xFE, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0xD0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x7F,
-    0x80, 0x0B, 0xF8, 0x01, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x03,
-    0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x87, 0xFE, 0x00, 0x03, 0xFD, 0x2F,
-    0xFE, 0x00, 0x0F, 0xF0, 0x17, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x1F, 0xF0,
-    0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x03, 0xFC,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xEF, 0xFF, 0x40, 0x00, 0xFF, 0x01, 0x40, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x60, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0, 0x1F, 0xF9, 0xFF, 0xFC,
-    0x03, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x07, 0xFC, 0x7F, 0x40,
-    0x00, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBA, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0x57, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0x80, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEB, 0xFE, 0x00, 0x0B, 0xFD,
-    0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x00, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x3F,
-    0xE0, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xFF, 0x81, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xEB,
-    0xFC, 0x02, 0xFE, 0x00, 0x74, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x54,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0xA4, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x60, 0x3F, 0xF5, 0x5B, 0xF0, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x24, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFD, 0x0B,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x64, 0x00, 0x64, 0x0B, 0xFF, 0x81,
-    0xFF, 0xCF, 0xFF, 0xE2, 0xFF, 0xF6, 0xAF, 0xFA, 0xFF, 0xFE, 0x02, 0xFE, 0xF5, 0xFF, 0x80, 0xFF,
-    0xF4, 0x3F, 0xD0, 0x3F, 0xF8, 0x0F, 0xF4, 0x1F, 0xFC, 0x07, 0xFC, 0x0B, 0xFD, 0x01, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x3F, 0xE0, 0x7F, 0xD0, 0x0F, 0xF4, 0x1F, 0xF0, 0x07, 0xFC,
-    0x0B, 0xFC, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F, 0xE0, 0x7F, 0xC0, 0x0F,
-    0xF4, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x03, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFE, 0xBF, 0xF0, 0x00, 0x3F, 0xD0, 0x3F, 0xE0,
-    0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x01, 0xFF, 0x07, 0xFE, 0x55, 0x5B,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0xAB, 0xFE, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x02, 0xFE, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0,
-    0x01, 0xFF, 0x83, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0xC0, 0x3F, 0xE0,
-    0x1F, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x4B, 0xFE, 0xBA, 0xFF, 0xFD, 0xBF, 0xFE, 0x1F,
-    0xF8, 0x00, 0x50, 0x00, 0x00, 0x64, 0x00, 0x01, 0x90, 0xBF, 0xF8, 0x00, 0xBF, 0xCF, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x2A, 0xFF, 0x80, 0xFF, 0xFC, 0x02, 0xFD, 0x0F, 0xF9, 0x40, 0x0F, 0xF0, 0xBF, 0x40,
-    0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x01, 0xFD, 0x3F, 0xE0, 0x00, 0x0B, 0xF3, 0xFF, 0x40, 0x00, 0x3F,
-    0xDF, 0xFC, 0x00, 0x00, 0xFE, 0xF7, 0xF0, 0x00, 0x07, 0xFF, 0x8F, 0xC0, 0x00, 0x1F, 0xFC, 0x7F,
-    0x00, 0x00, 0xBF, 0xC1, 0xFD, 0x02, 0x03, 0xFE, 0x07, 0xFE, 0xBC, 0x0F, 0xF0, 0x0F, 0xFF, 0xF0,
-    0x7F, 0x80, 0x3F, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x01, 0xBA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1E,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x2F,
-    0xD0, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x01, 0x07, 0xFF, 0x00,
-    0xBF, 0xEF, 0x1F, 0xFC, 0x00, 0xBF, 0xFE, 0x3F, 0xF4, 0x00, 0x7F, 0xFC, 0x0F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x54, 0x00, 0x16, 0x00, 0x00, 0xFF, 0x40, 0x2F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x07,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40,
-    0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x1F, 0xF4,
-    0x1F, 0xFE, 0x01, 0x02, 0xFF, 0xEB, 0xFB, 0xFA, 0xF0, 0x2F, 0xFF, 0xFD, 0x7F, 0xFE, 0x03, 0xFF,
-    0xFF, 0x83, 0xFF, 0xC0, 0x3F, 0x7F, 0xD0, 0x1F, 0xE0, 0x07, 0xF0, 0x50, 0x00, 0x10, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x68, 0x0B, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xE0,
-    0x1F, 0xF9, 0xFF, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F,
-    0xF4, 0x0F, 0xF0, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0xBF, 0x81, 0xFD, 0x00, 0x1F, 0xF0, 0xFF, 0x00,
-    0x03, 0xFC, 0x7F, 0x40, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x02, 0xFC, 0x00, 0x18, 0x0B, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0x00, 0x2F, 0xD5, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x6F, 0xFF, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x81,
-    0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xD0, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0xBF,
-    0xCF, 0xFC, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x03,
-    0xFE, 0x0F, 0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xEB, 0xF5, 0x7F, 0xD4, 0x00, 0x90, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x7F,
-    0x40, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x40, 0x0B, 0xFC, 0x07, 0xFF, 0xBC, 0x01, 0xFF, 0x80,
-    0x7F, 0xFF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x05, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x7F,
-    0xD0, 0x0B, 0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x07, 0xFD, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x0B,
-    0xF8, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x03, 0xFC, 0x00,
-    0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xEF, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x5A, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x03,
-    0xFF, 0x47, 0xE0, 0x1F, 0xF0, 0x01, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01,
-    0xBF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x92, 0xFD, 0x50, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0xFF, 0xC0,
-    0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00,
-    0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x03,
-    0xFE, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFE, 0x5F, 0xF5, 0x50, 0x28, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xC0, 0x00, 0x3F, 0xFA,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x58, 0x00, 0x64, 0x0B, 0xFF, 0xC0, 0xFF, 0x87, 0xFF, 0xF0, 0x1F, 0xF1,
-    0xAF, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xC0, 0x0F,
-    0xF8, 0x2F, 0xE0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x2F, 0xE0, 0xBF, 0x80, 0x0F, 0xF0, 0x2F, 0xE0, 0x0B, 0xF8, 0x0B, 0xF8, 0x07, 0xFC, 0x02, 0xFF,
-    0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0xA4, 0x00, 0x00, 0xBF, 0xC0, 0xBF, 0xFC, 0x00,
-    0x0B, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xAF, 0xF4, 0x07, 0xFC, 0x03, 0xF8, 0x2F,
-    0xF0, 0x3F, 0xD0, 0x2F, 0xD0, 0x7F, 0xC1, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0B, 0xF8, 0x07, 0xFC,
-    0x03, 0xFC, 0x3F, 0xD0, 0x2F, 0xE0, 0x1F, 0xF0, 0xFF, 0x40, 0xFF, 0x40, 0x7F, 0x83, 0xFD, 0x03,
-    0xFC, 0x03, 0xFD, 0x0F, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x40, 0xBF,
-    0xC2, 0xFE, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF5, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x90, 0x00, 0x29, 0x00,
-    0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0x80, 0x3F, 0xF0, 0x0A, 0xBF, 0xF0, 0x1F, 0xF0, 0x00,
-    0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00,
-    0x07, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0xE0, 0x00, 0x01, 0xFE, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x5B, 0x00, 0xFF, 0x80,
-    0x3F, 0xFF, 0xC0, 0xBF, 0xC0, 0x0F, 0xFF, 0xD0, 0xBF, 0xD0, 0x02, 0xFF, 0xC0, 0x0A, 0xD0, 0x00,
-    0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x58, 0x00, 0xFF, 0x01, 0x90, 0x2F, 0xFF, 0x00,
-    0xFF, 0x0F, 0xF4, 0x7F, 0xFF, 0x01, 0xFF, 0x0B, 0xFC, 0x6B, 0xFE, 0x02, 0xFE, 0x03, 0xFD, 0x02,
-    0xFD, 0x03, 0xFD, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x07, 0xFC, 0x07, 0xFC, 0x03,
-    0xFD, 0x0B, 0xF8, 0x0B, 0xF8, 0x03, 0xFC, 0x0F, 0xF4, 0x0B, 0xF4, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x07, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF8, 0x3F, 0xD0, 0xBF, 0x80, 0x0B, 0xFF, 0x7F, 0xDB, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xFC, 0x03, 0xFD, 0x01, 0xFC, 0x07, 0xFC, 0x0B, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x0F, 0xF4, 0x0B,
-    0xF8, 0x03, 0xFC, 0x1F, 0xF0, 0x0B, 0xF4, 0x03, 0xFC, 0x2F, 0xE0, 0x0F, 0xF0, 0x07, 0xFC, 0x3F,
-    0xE0, 0x0F, 0xE0, 0x07, 0xF8, 0x3F, 0xD0, 0x0F, 0xD0, 0x0B, 0xF4, 0x3F, 0xD0, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x3F, 0xE0, 0x3F, 0xD0, 0x1F, 0xE0, 0x3F, 0xF5, 0xBF, 0xF4, 0xBF, 0xC0, 0x2F, 0xFF, 0xFE,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4,
-    0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01,
-    0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD,
-    0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8,
-    0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x7E, 0x6F, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x00, 0x24, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50,
-    0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8,
-    0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07,
-    0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC,
-    0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0,
-    0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x42, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x19, 0x08, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x15, 0x00, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF8, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00,
-    0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0xD0,
-    0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x03, 0xFF, 0x6F, 0x9F, 0xFF, 0xC0, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x01, 0xFF, 0xF8, 0x1F, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x08, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x7D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x90, 0xA0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x07, 0xF8,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F,
-    0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF5, 0x56, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x42, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x64, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xBF, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x1F,
-    0xF8, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xE0,
-    0xBE, 0xFC, 0x2C, 0x00, 0xFF, 0xDB, 0xE7, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x1F, 0xFF, 0x80, 0x07,
-    0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0xBD, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF,
-    0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x19, 0x00, 0x40, 0x00, 0x00, 0xFF, 0x81, 0xE0, 0x00,
-    0x01, 0xFF, 0xF7, 0xE0, 0x00, 0x02, 0xF6, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xF8, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0B,
-    0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50,
-    0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01,
-    0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8,
-    0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07,
-    0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC,
-    0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0,
-    0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9F,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xAA,
-    0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC,
-    0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03,
-    0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD,
-    0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8,
-    0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1E, 0x06, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x41, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xE6, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B,
-    0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x81, 0x40, 0x40, 0x00, 0x03,
-    0xD0, 0x02, 0xC0, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0,
-    0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F,
-    0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x0B, 0x06, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x11, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xE6, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80,
-    0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x40, 0x00, 0x03, 0xD0, 0x02, 0xC0, 0x00, 0x07, 0xF0, 0x0B,
-    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00,
-    0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF,
-    0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE,
-    0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C,
-    0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B,
-    0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xD1, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x04, 0x2C, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B,
-    0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x00, 0x08, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x43, 0xC0, 0x40, 0x00, 0x03, 0xC1, 0x41, 0xC0, 0x00, 0x07, 0xE0, 0x0B, 0xC0, 0x00,
-    0x03, 0xFE, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF,
-    0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF,
-    0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00,
-    0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F,
-    0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6,
-    0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00,
-    0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x95, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD5, 0x5B, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x1B, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x4B, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0xC0,
-    0x00, 0x00, 0xFF, 0xD2, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xD0, 0xFF, 0x80, 0x00,
-    0x00, 0x80, 0x29, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x07,
-    0xE0, 0x0B, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01,
-    0x50, 0x00, 0x07, 0xFF, 0xCF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0,
-    0x01, 0xFF, 0x80, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0,
-    0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE,
-    0xFC, 0x2C, 0x3F, 0xF6, 0xF9, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF,
-    0xE0, 0x0B, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFA, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x9F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x55, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFE,
-    0xAA, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF,
-    0x40, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xBF, 0xE4, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF,
-    0xD0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x01, 0x50, 0x00, 0x07, 0xFF, 0xCF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFB, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xC0,
-    0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x1F,
-    0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0,
-    0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x2F, 0xFD, 0x00, 0x3F, 0xE0, 0xBE, 0xFC, 0x2C, 0x3F, 0xF6, 0xF9,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF, 0xE0, 0x0B, 0xFE, 0x00, 0xFF,
-    0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16, 0xFC,
-    0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFC,
-    0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0xE6, 0xFF, 0x01, 0xFD, 0x03, 0xFC, 0x0F,
-    0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x1F, 0xD1, 0xFF, 0x40, 0xBF, 0xBF,
-    0xF4, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0xFF, 0x40, 0x1F,
-    0xC3, 0xFF, 0x57, 0xFE, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xF8, 0x05, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xE0,
-    0x00, 0x0F, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x6F, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x03,
-    0xE0, 0xBD, 0x00, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0x9B, 0xFC, 0x01, 0xFD,
-    0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF8, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x1F, 0xD1,
-    0xFF, 0x40, 0x2F, 0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x90, 0x3F, 0xD0, 0x07, 0xF0, 0x3F, 0xF5, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x0B, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0x80, 0x5B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00,
-    0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xF8, 0x06, 0x00, 0x02, 0xFF, 0x83, 0xD0, 0x01, 0xFF, 0xFB, 0xF4, 0x00,
-    0xBD, 0x3F, 0xFC, 0x00, 0x1E, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x02, 0xFE, 0x6F, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0xBF, 0x00,
-    0xFF, 0x00, 0x3F, 0x80, 0xBF, 0x40, 0x1F, 0xD1, 0xFF, 0x40, 0x0B, 0xFB, 0xFF, 0x40, 0x03, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x0F, 0xF4, 0x01, 0xFC, 0x03,
-    0xFF, 0x57, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x05, 0xBF, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x6F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x68, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xF9, 0xBF, 0xC0, 0x00, 0x07, 0xF4, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x02, 0xFD,
-    0x00, 0x00, 0x7F, 0x47, 0xFD, 0x00, 0x00, 0x2F, 0xEF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x02, 0x40, 0x00, 0x3F, 0xD0, 0x07, 0xF0,
-    0x00, 0x0F, 0xFD, 0x5F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x68, 0x0D, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x7F, 0x7F, 0xC0, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x0B, 0xF9, 0xBF, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0xFE, 0x02, 0xFD, 0x00, 0x7F, 0x47, 0xFD, 0x00, 0x2F, 0xEF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x02, 0x40, 0x3F, 0xD0, 0x07,
-    0xF0, 0x0F, 0xFD, 0x5F, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x05, 0xBF, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x2E, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x6F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x2D, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x68, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0x80, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x43, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x7C, 0x00, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xF9, 0xBF, 0xC0, 0x00, 0x07,
-    0xF4, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x02, 0xFD, 0x00, 0x00, 0x7F, 0x47, 0xFD, 0x00, 0x00, 0x2F, 0xEF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x02, 0x40, 0x00, 0x3F, 0xD0,
-    0x07, 0xF0, 0x00, 0x0F, 0xFD, 0x5F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0B, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBD, 0x00,
-    0x00, 0x00, 0x7C, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFD,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xBE, 0x00, 0x00, 0x00, 0x78, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x16, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xE0,
-    0x00, 0x2F, 0xF4, 0x01, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x42,
-    0xC0, 0x00, 0xBF, 0xF9, 0xF4, 0x00, 0x3E, 0x7F, 0xFC, 0x00, 0x0B, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01,
-    0xFD, 0xFF, 0x00, 0x02, 0xFD, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xE6, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x0B, 0xF0, 0x0F,
-    0xF0, 0x03, 0xF8, 0x0B, 0xF4, 0x01, 0xFD, 0x1F, 0xF4, 0x00, 0xBF, 0xBF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x09, 0x00, 0xFF, 0x40, 0x1F, 0xC0, 0x3F,
-    0xF5, 0x7F, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0xA8, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x5B, 0xF0,
-    0x00, 0x07, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xC0, 0x01,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xD0, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFE, 0xFC, 0x00,
-    0x07, 0xF0, 0xFD, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0xBF, 0x9B, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF8, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x2F, 0xD0, 0x1F, 0xD1, 0xFF, 0x40, 0x2F, 0xEF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x90, 0x3F, 0xD0, 0x07, 0xF0, 0x3F, 0xF5, 0x7F, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x01, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x1B,
-    0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xF4, 0x00,
-    0xFF, 0xFD, 0x02, 0xF9, 0xBE, 0x02, 0xF0, 0x7E, 0x00, 0x90, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x2F,
-    0xD0, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x2F, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0xAB, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC2, 0x40, 0x7F, 0xEF, 0x80, 0xBF, 0xFF, 0x40, 0xBF, 0xFE, 0x00,
-    0x3F, 0xE4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x2F, 0xFF, 0x02, 0xFF, 0xFC, 0x0A, 0xBF, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFE,
-    0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC2, 0x41, 0xFF, 0xBE, 0x0B, 0xFF, 0xF4, 0x2F, 0xFF, 0x80, 0x3F,
-    0xE4, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0x40, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD,
-    0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x00,
-    0x3F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xD0, 0x02, 0xFF, 0x2F, 0xF0, 0x00, 0xBF, 0xCF, 0xFC,
-    0x00, 0x3F, 0xE3, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x07, 0xFC, 0x3F, 0xE0, 0x03, 0xFE, 0x0F,
-    0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF,
-    0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00,
-    0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F,
-    0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x07, 0xF6, 0xFC, 0x00, 0x02, 0xF0, 0x7F, 0x00, 0x00, 0x24, 0x2F, 0x40, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B, 0xFC, 0x07, 0xFE, 0x07, 0xFC, 0x00,
-    0xFF, 0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x40, 0x0B, 0xFC, 0xBF, 0xC0, 0x02, 0xFF, 0x3F, 0xF0,
-    0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x0F, 0xF8, 0x3F,
-    0xF0, 0x0B, 0xFC, 0x0B, 0xFD, 0x0B, 0xFD, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBD, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF9, 0x5B, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-    0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0,
-    0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x3F,
-    0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFF,
-    0x40, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x96, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x1A, 0x09, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0F,
-    0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFB,
-    0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80,
-    0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x80, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00,
-    0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B,
-    0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x68, 0x18, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xEB,
-    0xF0, 0x00, 0x01, 0xFE, 0x0B, 0xE0, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x07, 0xFC, 0x00, 0xFF,
-    0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x3F,
-    0xF0, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00,
-    0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0xBF, 0xD0, 0xBF, 0xD0, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE1,
-    0x00, 0x00, 0x00, 0x07, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0xF4, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF9,
-    0x5B, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0x0F,
-    0xFE, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0x96, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x83, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x68, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xC0,
-    0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00,
-    0xFF, 0x80, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0B, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0x40, 0x00, 0x00, 0x07, 0xCB, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF6, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0xBE, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xFE, 0x56, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFD, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xE5, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x40, 0x00, 0x0B, 0xF8, 0x0E, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x2F, 0x6F, 0xFE, 0x00, 0x01,
-    0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00, 0xFE,
-    0x00, 0xB8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x02, 0xFF, 0x01,
-    0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x2A, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00,
-    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x1F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xFD, 0x00,
-    0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x03, 0xF8, 0x0F,
-    0xC0, 0x00, 0x7E, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xBF, 0xF4,
-    0x02, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x40,
-    0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0xFF, 0x43,
-    0xFE, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x2F,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x24, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x01, 0x55, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x82, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF9, 0x5B, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x02,
-    0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x96, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x69, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0xFB, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xBF, 0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F,
-    0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x60, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0x55, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x82,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xF9, 0x5B, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x96, 0xFF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x01, 0xA4, 0x0F, 0xD0, 0x00, 0x1F, 0xFF, 0xEF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFE, 0xFF, 0xE0, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x2F, 0xF4, 0x2F, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x05, 0x54, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xE5, 0x6F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x1F,
-    0xFE, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0xBF, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xBF, 0xFE, 0x5B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0x9F, 0xE0, 0x00, 0x00, 0x0F, 0x82, 0xF4, 0x00, 0x00, 0x00, 0x90, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x69,
-    0x03, 0xF4, 0x00, 0x07, 0xFF, 0xFB, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xBF,
-    0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF2, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x40, 0x0F, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xE5, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x06, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xE0, 0x00, 0x00, 0xFF, 0xFB, 0xF4, 0x00,
-    0x00, 0x7D, 0x3F, 0xFC, 0x00, 0x00, 0x0E, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1A, 0x40, 0xFD, 0x00,
-    0x01, 0xFF, 0xFE, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xEF, 0xFE, 0x00, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-    0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xFC,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x40, 0x0F, 0xF4,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xE5, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x69, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0xFB, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xBF, 0xF8, 0x00, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xC0,
-    0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF,
-    0x80, 0x2F, 0xF0, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF,
-    0x80, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00,
-    0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0x81, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0xD0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x80, 0x00, 0x00, 0xF8, 0x2F, 0x40, 0x00, 0x00,
-    0x24, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x01, 0x54, 0x1F, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xFF, 0x80, 0x2F, 0xF0,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x1F,
-    0xFF, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xEA, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x59, 0x00, 0x01, 0x6F, 0xF0, 0x1F,
-    0xFF, 0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x2A, 0xFF, 0x80, 0x2F, 0xF0,
-    0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x07,
-    0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x00, 0x1F, 0xF6, 0xFC,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC1, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xEA,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x59,
-    0x00, 0x01, 0x6F, 0xF0, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x2F, 0xF4, 0x00,
-    0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x7E, 0xFF,
-    0x1D, 0x00, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xC0, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x81, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x24, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x59, 0x00, 0x01, 0x6F, 0xF0, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x2F,
-    0xF4, 0x00, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x7E, 0xFF, 0x1D, 0x00, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xAB,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x01, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x83, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xEF, 0xD0, 0x00, 0x00, 0x07, 0xD3, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x59, 0x00, 0x01, 0x6F, 0xF0, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF,
-    0x80, 0x2F, 0xF4, 0x00, 0x2A, 0xFF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00,
-    0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x00, 0x1F, 0xF6, 0xFC, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xE4, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFF, 0xAB, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x59, 0x00, 0x01, 0x6F,
-    0xF0, 0x1F, 0xFF, 0x40, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x2F, 0xF4, 0x00, 0x2A, 0xFF, 0x80,
-    0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80,
-    0x00, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0B,
-    0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x7E, 0xFF, 0x1D, 0x00, 0x1F,
-    0xF6, 0xFC, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,
-    0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01, 0xBF, 0xFC,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03,
-    0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE2, 0xFF, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0x80, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC,
-    0x02, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xCF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xE0, 0x01,
-    0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x80,
-    0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x05, 0x03, 0xD0, 0x6F, 0xD0, 0x03, 0xFC, 0x7F, 0xFF, 0xF4, 0x00, 0xBF, 0xCB, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFC, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0xBA, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x2E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0x40, 0x3F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xFC, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0xF3, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF9,
-    0xFE, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x80, 0x01, 0xA0, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x1B,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF1, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x3D, 0x06, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x01, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x5F, 0x80, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0x80, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x8B, 0xFF, 0xF4, 0x01,
-    0xFF, 0xF4, 0x03, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF4,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0x80, 0x00, 0x01,
-    0xFF, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x06, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0xBF, 0x40, 0x00, 0x01, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x0E, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x58, 0x00, 0x1A, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0x80,
-    0x7F, 0xE0, 0x01, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x03, 0xFD,
-    0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x03, 0xD0, 0x6F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
-    0x38, 0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70,
-    0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00,
-    0x1E, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00,
-    0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x15,
-    0x55, 0x50, 0x15, 0x55, 0x41, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x15, 0x55, 0x50,
-    0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0xA9, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x15, 0x40,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x7E, 0x01, 0xFC, 0x03, 0xF4,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD0, 0x3F, 0xE0, 0x1A, 0x40, 0x00, 0x50,
-    0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x0B, 0xF0, 0x0F, 0xE0, 0x3F, 0xC0,
-    0xBF, 0x00, 0x38, 0x00, 0x00, 0x40, 0x07, 0xF8, 0x0B, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x07, 0xF4,
-    0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xBF, 0x00, 0x78, 0x00, 0x01, 0x00, 0x1F, 0xF0, 0x3F, 0xF0,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xBF, 0x00, 0xFD, 0x07,
-    0xF4, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x41, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x3F, 0xD0, 0xFF, 0x00, 0xFF, 0x83, 0xFD, 0x01, 0xA4, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x2F, 0x80, 0xBF, 0xC2, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x7F, 0x80, 0xBF, 0x42, 0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0xBF, 0x01, 0xFC, 0x07,
-    0xF0, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x7F, 0x82, 0xFD,
-    0x0B, 0xFC, 0x3F, 0xE0, 0x7F, 0xC2, 0xFE, 0x03, 0xFC, 0x2F, 0xD0, 0x7F, 0x43, 0xFC, 0x0F, 0xF0,
-    0x3F, 0x81, 0xFD, 0x0B, 0xF0, 0x3F, 0x81, 0xFD, 0x0B, 0xF0, 0x3F, 0x40, 0x78, 0x02, 0xD0, 0x00,
-    0x01, 0x00, 0x14, 0x00, 0x7F, 0xC3, 0xFE, 0x03, 0xFF, 0x1F, 0xF8, 0x0F, 0xF4, 0xBF, 0xC0, 0x3F,
-    0xC1, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFD, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xD0, 0x03, 0xF4,
-    0x2F, 0xC0, 0x07, 0xF0, 0x3F, 0x80, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x02, 0x50, 0xBD, 0x05, 0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF6, 0xF9,
-    0x7E, 0x6B, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x25, 0x0B, 0xD0, 0x54, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xF9, 0x7E, 0x6B, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x25, 0x07, 0xC0, 0x54, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-    0x81, 0xFA, 0x7E, 0x6B, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x3F, 0xFD, 0xBF, 0xFE, 0xBF, 0xFE, 0xBF, 0xFD, 0x7F, 0xF8, 0x1B, 0x90, 0x28,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF4, 0x15, 0x00, 0x06, 0x80,
-    0x06, 0x80, 0xFF, 0x80, 0xBF, 0xC7, 0xFE, 0x03, 0xFF, 0x1F, 0xF8, 0x1F, 0xFC, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x54, 0x00, 0x14, 0x00, 0x06, 0x80, 0x00, 0x1A, 0x00, 0x00, 0x68, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00, 0x14,
-    0x00, 0x06, 0x90, 0xBF, 0xD3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x15, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00,
-    0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0,
-    0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70,
-    0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40, 0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00,
-    0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB, 0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0,
-    0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D, 0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0,
-    0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E, 0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0,
-    0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xBF, 0x02, 0xF8, 0x00, 0x10, 0x00, 0x00,
-    0x01, 0x00, 0x3F, 0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xEB, 0xFC,
-    0x0F, 0xC0, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x3F, 0x42, 0xFE, 0x7F, 0xD0,
-    0x2F, 0xE7, 0xFD, 0x07, 0xFF, 0x40, 0xBE, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x00,
-    0x01, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x0F,
-    0xE0, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xE1, 0xFD, 0x00, 0xFE, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x1F, 0xD2, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0,
-    0x3F, 0xC2, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x82, 0xFC, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0xFF, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0xFD, 0x01, 0xFE, 0x03, 0xFD, 0x07, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x3F, 0x80, 0x3F, 0x00, 0x08, 0x00, 0x00, 0xA0, 0x02, 0x40, 0x03, 0xF4, 0x2F, 0x80,
-    0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x47, 0xFC, 0x07, 0xFC, 0x3F, 0xE0, 0x2F, 0xE1, 0xFF, 0x00, 0xFF,
-    0x0B, 0xF4, 0x0B, 0xF4, 0x3F, 0xC0, 0x3F, 0x81, 0xFC, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x80, 0x06,
-    0x00, 0x00, 0x00, 0xA0, 0x01, 0x80, 0x02, 0x40, 0x03, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x1F, 0xE0,
-    0x7F, 0xC0, 0xFF, 0x00, 0xFF, 0x42, 0xFE, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xF4, 0x3F, 0xD0, 0x2F,
-    0xE0, 0xBF, 0xC1, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x0B, 0xF4, 0x0B, 0xF4, 0x1F, 0xE0, 0x3F, 0xC0,
-    0x3F, 0x80, 0xBF, 0x02, 0xFC, 0x00, 0xFC, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x80, 0x01, 0x40, 0x05,
-    0x00, 0x00, 0x06, 0x00, 0x3F, 0x40, 0x7F, 0xC0, 0x3F, 0xD0, 0x2F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF8,
-    0x03, 0xFC, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x24, 0x06, 0x00, 0x18, 0x00, 0xFD, 0x02, 0xF8, 0x07,
-    0xFC, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xD0, 0x2F, 0xE0, 0x7F, 0xC0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF,
-    0x81, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFD, 0x03, 0xF8, 0x02, 0xF4, 0x07, 0xD0, 0x02, 0x40,
-    0x05, 0x00, 0x06, 0x00, 0x18, 0x00, 0x24, 0x03, 0xF4, 0x0B, 0xE0, 0x1F, 0xC0, 0x7F, 0xC0, 0xFF,
-    0x03, 0xFC, 0x03, 0xFD, 0x0F, 0xF4, 0x2F, 0xE0, 0x2F, 0xE0, 0x7F, 0xC1, 0xFF, 0x00, 0xFF, 0x03,
-    0xFD, 0x0F, 0xF4, 0x0B, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0x02, 0xFD, 0x01, 0xFD,
-    0x03, 0xF8, 0x0F, 0xE0, 0x0B, 0xD0, 0x1F, 0x40, 0x3E, 0x00, 0x24, 0x00, 0x50, 0x01, 0x40, 0x00,
-    0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xF8, 0xFE,
-    0x01, 0xFE, 0x03, 0xF8, 0x2F, 0x80, 0x0F, 0xD0, 0x00, 0x02, 0x40, 0x01, 0xFD, 0x00, 0xBF, 0xC0,
-    0x3F, 0xF0, 0x1F, 0xF8, 0x07, 0xFE, 0x00, 0xBF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x28, 0x00, 0x00, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x8B, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0xBE, 0x02, 0xFC,
-    0x03, 0xF0, 0x0B, 0xE0, 0xBF, 0x03, 0xF4, 0x00, 0xFD, 0x0F, 0x43, 0xF4, 0x00, 0x0F, 0xD0, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x01, 0x80, 0xFE, 0xF8,
-    0x18, 0x02, 0xFC, 0x1F, 0xF8, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0B, 0xF4, 0x1F, 0xC1, 0xFF, 0xC1,
-    0xFC, 0x01, 0x41, 0xFD, 0xFC, 0x04, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0x82, 0xF8, 0x00, 0xFD, 0x0B, 0xF0, 0x3F,
-    0x40, 0xFD, 0x02, 0xFC, 0x03, 0xF4, 0xBD, 0x00, 0x2D, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x01, 0xA8, 0x00, 0x2F, 0xF0, 0x0B, 0xFC,
-    0x00, 0x7F, 0xD0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x01,
-    0xFF, 0x40, 0x7F, 0xD0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
-    0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x02, 0xFC,
-    0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x09, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0x2F,
-    0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x1F, 0xF4, 0x00, 0x3F, 0x80,
-    0x0F, 0xF0, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x15, 0x50, 0x7F, 0xFD, 0xBF, 0xFE, 0xBF,
-    0xFD, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x01, 0xBF, 0x40, 0x0F, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x2F, 0x57,
-    0xFC, 0x0F, 0x97, 0xFD, 0x04, 0x02, 0xFC, 0x04, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x0B, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x95, 0x00, 0x2F, 0xD5, 0x00,
-    0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x06, 0x90, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0x40, 0x00, 0x2F, 0xD0,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x2F, 0xE4, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0x42, 0xFF, 0xFF, 0x40,
-    0x3F, 0xF0, 0x2F, 0xFF, 0xFC, 0x03, 0xFE, 0x02, 0xF5, 0x7F, 0xC0, 0x7F, 0xD0, 0x04, 0x02, 0xFC,
-    0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x03, 0xF9,
-    0x50, 0x02, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x06,
-    0x90, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00, 0x02,
-    0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x01, 0xBF, 0x80, 0x00, 0x7F, 0xD0, 0x7F, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xFF,
-    0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xD0, 0x1F, 0xF4, 0x0F, 0x96, 0xFE, 0x01, 0xFF, 0x00, 0x40,
-    0x0F, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x07, 0xF8, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00,
-    0x1F, 0xE5, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x09, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x14, 0x00, 0x02, 0xFD,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x3F,
-    0x80, 0x02, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80,
-    0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01,
-    0x80, 0x02, 0x40, 0x09, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0xBE, 0x01, 0xFC, 0x01, 0xFE, 0x07, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xD0, 0x3F, 0xD0, 0xBF, 0x81, 0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xF4, 0x3F,
-    0xD0, 0xBF, 0x80, 0xBF, 0x82, 0xFF, 0x07, 0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0xBF, 0x42,
-    0xFE, 0x02, 0xFD, 0x07, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0xBF, 0x02, 0xFC, 0x07, 0xF4,
-    0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x40, 0x7E, 0x00, 0x08, 0x00, 0x14, 0x00, 0x50, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFB, 0xFD, 0x03, 0xF8,
-    0x0F, 0xE0, 0xFF, 0x00, 0xFF, 0x0F, 0xE0, 0x0F, 0xF2, 0xFD, 0x00, 0xFE, 0x3F, 0xC0, 0x0F, 0xE3,
-    0xFC, 0x02, 0xFD, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07, 0xF4, 0x3F, 0xC0, 0xFF, 0x02, 0xFF, 0xBF,
-    0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFE,
-    0xF4, 0x00, 0x3F, 0x3F, 0x00, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0x7F, 0x00, 0xFD, 0x0B, 0xE0, 0x3F,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x2B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x07, 0xE0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x55, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x1F, 0xFF, 0xD0, 0x0B, 0xFE, 0x40, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xFA, 0x80,
-    0x02, 0xFF, 0xFF, 0x80, 0x3F, 0xAB, 0xFD, 0x07, 0xF0, 0x0F, 0xE0, 0x7F, 0x00, 0xBE, 0x07, 0xF0,
-    0x0B, 0xE0, 0x7F, 0x00, 0xFD, 0x03, 0xF9, 0x7F, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x07, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0xF8, 0x07,
-    0xF4, 0x3D, 0x03, 0xF8, 0x01, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F,
-    0xFF, 0xF0, 0x1F, 0xD1, 0xFD, 0x0B, 0xE0, 0x3F, 0x43, 0xF8, 0x1F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0B,
-    0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x07, 0xF6, 0xFE, 0x03, 0xF0, 0x2F, 0xC2, 0xF8, 0x03, 0xF4, 0xBE,
-    0x01, 0xFC, 0x2F, 0xD1, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xD7, 0xFC, 0x07, 0xF0,
-    0x0F, 0xD0, 0xBF, 0x00, 0xFD, 0x0B, 0xE0, 0x0F, 0xD0, 0xBF, 0x00, 0xFD, 0x07, 0xFE, 0xBF, 0xC0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x6A, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x6F, 0xFE,
-    0x00, 0x7F, 0xFF, 0x40, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x7F, 0x47, 0xFE, 0xBF, 0xF0, 0x1F, 0xBA, 0xFC, 0x0B, 0xF8, 0x7E, 0x03, 0xFC, 0x2F, 0x40,
-    0xFD, 0x0F, 0xC0, 0x7F, 0x03, 0xE0, 0x2F, 0x81, 0xF4, 0x4F, 0xD0, 0xBE, 0xF3, 0xF0, 0x3F, 0xF5,
-    0xF8, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xD2, 0xFE, 0x07, 0xF4, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x1F, 0xD0, 0x0F, 0xF2,
-    0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x1F, 0xD3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xFC, 0x0B,
-    0xF4, 0x3F, 0xD1, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x00, 0x1A, 0x90, 0x00, 0x00,
-    0x01, 0x80, 0x01, 0xBF, 0xC0, 0x7F, 0xFE, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0xFE, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFE, 0x05, 0x55, 0x50, 0x00, 0x01, 0x94, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xD2, 0xFD, 0x03, 0xE0, 0x0F, 0xD0, 0x1C, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xF5, 0x55, 0x03, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x00,
-    0x55, 0x55, 0x00, 0x00, 0x06, 0x50, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFE, 0x07, 0xE0, 0xBF, 0x03,
-    0x80, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00, 0x42,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xF4, 0x6B, 0xFF, 0xD0, 0xBF, 0xFF, 0x40,
-    0x2A, 0x90, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFA, 0xF4, 0x00, 0x7E, 0x3F, 0x00, 0x1F, 0x83, 0xF0, 0x07,
-    0xE0, 0x7E, 0x01, 0xFC, 0x0B, 0xE0, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x05, 0x56, 0xFD,
-    0x40, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xF4, 0x07, 0xF5, 0x54, 0x02, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x3F,
-    0xFD, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xD0, 0x00, 0x2F, 0xF0, 0x2B, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x00, 0xAA, 0x40, 0x00, 0x00,
-    0x00, 0x16, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xF9, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0x42, 0xFD, 0x07, 0xF0,
-    0x0F, 0xE0, 0x7F, 0x00, 0xBE, 0x07, 0xF0, 0x0F, 0xE0, 0x7F, 0x41, 0xFC, 0x03, 0xFE, 0xFF, 0x80,
-    0x0F, 0xFF, 0xE0, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF,
-    0xF4, 0xFD, 0x57, 0xFC, 0x3E, 0x02, 0xFC, 0x0B, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x2F,
-    0xFF, 0x40, 0x3F, 0xEF, 0xF4, 0x2F, 0xC0, 0xFE, 0x0F, 0xE0, 0x3F, 0x42, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xEF, 0xC0, 0x07, 0xFF, 0x80, 0x0B, 0xFF, 0xF0, 0x0B, 0xE0, 0xFF, 0x07, 0xF0, 0x1F, 0xD2, 0xF8,
-    0x03, 0xF4, 0xBF, 0x02, 0xFC, 0x1F, 0xFB, 0xFD, 0x02, 0xFF, 0xFD, 0x00, 0x06, 0x94, 0x00, 0x00,
-    0x05, 0x90, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x81, 0xFC, 0x07, 0xF0, 0x0F,
-    0xD0, 0xBF, 0x00, 0xFD, 0x0B, 0xF0, 0x0F, 0xD0, 0x7F, 0x41, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xF4, 0x00, 0x05, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xF4, 0x02, 0xBF, 0xFC, 0x00,
-    0x3F, 0xFD, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x50, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0xAB, 0xFD, 0x00, 0x01, 0xFF,
-    0x80, 0x0F, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x99, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x97, 0xFD, 0x00, 0x00, 0x2F, 0xE0,
-    0x2F, 0xD0, 0x00, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFD, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1A, 0xFF, 0xEA, 0xA4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xFF,
-    0xEB, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xAB, 0xFF, 0xAA, 0x90, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xEF,
-    0xF9, 0x56, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xE0, 0x1B, 0xFF, 0xF0, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB, 0xFA, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xDB, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0F, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xFC,
-    0x0B, 0xFE, 0xA0, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x40, 0xBF, 0xE3, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0x40, 0x0B, 0xFC, 0x1F, 0xFE, 0x1F, 0xFF, 0xFE, 0x03, 0xF9, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x20, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80,
-    0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0x02, 0x09, 0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x7C, 0xBC, 0x07,
-    0xF8, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFE, 0x7F, 0xC1, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0x47, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xAA, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0xBF, 0xC0, 0x00, 0x78, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xF5, 0x6A, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x05, 0xBF, 0xD5, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x0B, 0xFF, 0xE5, 0x6F, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x01, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xF9, 0x55, 0x55, 0x55, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xBF, 0x7F, 0x7F, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F,
-    0x83, 0xF0, 0xBC, 0x08, 0x1F, 0xC0, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x05, 0x55,
-    0x00, 0x00, 0xBF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x08, 0x1F, 0xC0, 0x80, 0xB8, 0x3F, 0x0B, 0x8B, 0xF4, 0xFC, 0x7F, 0x8F, 0xF7, 0xF7, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x00, 0x0B, 0xF0, 0x03,
-    0xF8, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x0B, 0xF4, 0x00, 0x00,
-    0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8B, 0xF5, 0x55, 0x55, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF8, 0x00, 0xBF,
-    0x80, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x03, 0xFD, 0xFC, 0xFF, 0x0B, 0xC3, 0xF1, 0xF8, 0x09,
-    0x0F, 0xC2, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x90, 0xFC, 0x18, 0x0B, 0xC3, 0xF0, 0xF8, 0x3F, 0xCF, 0xCF,
-    0xF0, 0x7F, 0xBF, 0xBF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0xFF, 0x7F, 0x7F, 0xC3, 0xF4,
-    0xFC, 0x7F, 0x03, 0x83, 0xF0, 0xB0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0x03, 0xF0, 0x10, 0x1F, 0x0F, 0xC3, 0xD0, 0xFF, 0x3F, 0x3F, 0xC1, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xA4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x08, 0x03,
-    0xF4, 0x00, 0xBC, 0x0F, 0xD0, 0x0B, 0xFC, 0x3F, 0x40, 0xBF, 0xC0, 0xFD, 0x07, 0xF8, 0x03, 0xF4,
-    0x7F, 0x95, 0x5F, 0xD7, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F,
-    0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x01, 0xFC, 0x1F, 0x80, 0x07, 0xF0, 0xFF, 0x80, 0x1F,
-    0xC0, 0xFF, 0x40, 0x7F, 0x00, 0xBF, 0x41, 0xFD, 0x55, 0xBF, 0x47, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x07, 0x80, 0x00, 0xFD,
-    0x00, 0x3F, 0x80, 0x03, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0x43, 0xF8,
-    0x00, 0x00, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x4B, 0xF9, 0x55, 0x55, 0x54, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x55, 0x5A, 0x90, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x55, 0x55,
-    0x55, 0x55, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x55, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x95, 0x6A, 0xAA, 0xE0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x0B,
-    0xFD, 0x1F, 0xF8, 0x00, 0xBF, 0xF4, 0x7F, 0xF8, 0x0B, 0xFB, 0xD1, 0xFB, 0xF8, 0x3F, 0x5F, 0x47,
-    0xD7, 0xF0, 0x34, 0x7D, 0x1F, 0x47, 0x00, 0x01, 0xF4, 0x7D, 0x00, 0x00, 0x07, 0xD1, 0xF4, 0x00,
-    0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x7D, 0x00, 0x00, 0x0B,
-    0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E,
-    0x00, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x1A, 0x95, 0x54, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x42,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE1,
-    0x55, 0x55, 0x55, 0x57, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2E,
-    0xAA, 0xA5, 0x5B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x02, 0x90, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0x0B, 0xD1,
-    0xF8, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x7D, 0x00,
-    0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x01,
-    0xF4, 0x7D, 0x00, 0x03, 0x07, 0xD1, 0xF4, 0x70, 0x3F, 0x1F, 0x47, 0xD3, 0xF0, 0xFF, 0x7D, 0x1F,
-    0x7F, 0xC0, 0xBF, 0xF4, 0x7F, 0xF8, 0x00, 0xBF, 0xD1, 0xFF, 0x80, 0x00, 0xBF, 0x47, 0xF8, 0x00,
-    0x00, 0xBF, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0E, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0xFD, 0x55, 0x55, 0x55, 0xFD, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xD5, 0x55, 0x55, 0x5F, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x0F,
-    0xF0, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF4, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x0B, 0xFF,
-    0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xFC, 0x00, 0x02, 0xFD, 0x00,
-    0x7F, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xFC, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x01, 0xFF,
-    0xC3, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFD, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0F, 0xD5, 0xBF, 0xF0, 0x00, 0x90, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x3F, 0xD0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x0B, 0xFC, 0x1F,
-    0xF0, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x3F, 0xE0, 0x03, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xE0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xEA,
-    0xAF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x45, 0x55, 0x40, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF5, 0xEA, 0xAA, 0x5F, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x02, 0x80,
-    0x00, 0x1B, 0xFF, 0xFF, 0x42, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFA, 0xFC, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x01, 0xFC,
-    0xFF, 0x82, 0xFF, 0x00, 0x01, 0xFC, 0x2F, 0xF0, 0xFF, 0xC0, 0x01, 0xFD, 0x0B, 0xFC, 0x3F, 0xE0,
-    0x00, 0xFD, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0xFD, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0xFD, 0x00, 0x2F,
-    0xF0, 0xFF, 0x80, 0xFD, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0xFD, 0x00, 0x03, 0xFE, 0x0B, 0xFC, 0xFE,
-    0x00, 0x01, 0xFF, 0x41, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xD0,
-    0x07, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0x00, 0x06, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFB,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFD,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x7F,
-    0x40, 0x3F, 0xF4, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x2F,
-    0xC0, 0x00, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xF0, 0x0F,
-    0xF0, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xE5, 0x55, 0x57, 0xFD, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x0B, 0xFF, 0x00, 0x00, 0xBF, 0x41,
-    0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0xF8, 0x00, 0x1F, 0xE0, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x01,
-    0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0x0F, 0xE0, 0x00, 0x00,
-    0xFF, 0xC7, 0xF4, 0x00, 0x00, 0x2F, 0xFA, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x6B, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x43, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xE4, 0x03, 0xFC,
-    0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE1, 0x55, 0xFF, 0x95, 0x51, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xE5, 0x5B, 0xFD, 0x55, 0x50, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-    0x0B, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF9, 0x55, 0x55, 0x55, 0x54, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x06, 0xFF, 0xD0,
-    0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x15, 0x5B, 0xFD, 0x55, 0x2F, 0xF5, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55,
-    0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x0B, 0xF4, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xFD,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0x55, 0x55, 0x5B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x3F, 0xF9, 0x55, 0x57, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4,
-    0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF4, 0x01, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xD0, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xF5, 0x55, 0x5F, 0xF0, 0x1F, 0xFD,
-    0x00, 0x01, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xC0, 0xFF, 0x80, 0x00,
-    0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0x03,
-    0xF0, 0x78, 0x2F, 0xD3, 0xE3, 0xFC, 0x3F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFB, 0xFF, 0xFD, 0x1F, 0xC3,
-    0xE1, 0xFC, 0x0D, 0x07, 0xF0, 0x34, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0x5B, 0xFC, 0x7F,
-    0x00, 0xBF, 0x2F, 0xC0, 0x1F, 0xCB, 0xF0, 0x03, 0xF2, 0xFC, 0x02, 0xFC, 0x3F, 0xD6, 0xFE, 0x0B,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0xF9, 0x00, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC,
-    0x7F, 0xE0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xFD,
-    0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xC0, 0x07, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0x16, 0xFF, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x00, 0x00, 0x07, 0xFC, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE3,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x01, 0x00, 0xFF, 0xD0, 0x07, 0xC0, 0xFF, 0xFD, 0x0B, 0xF0, 0xFF, 0xFF, 0xCB, 0xF8,
-    0x3F, 0x82, 0xFF, 0xF0, 0x1F, 0xC0, 0x3F, 0xF0, 0x0B, 0xE0, 0x03, 0xF8, 0x02, 0xFC, 0x02, 0xFF,
-    0x40, 0x7F, 0x42, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0xFF, 0x82, 0xFF, 0xFC, 0x0F, 0xF0, 0x2F, 0xF8,
-    0x00, 0xFC, 0x00, 0x50, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x01, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 0x43, 0xFF, 0xE0,
-    0xBF, 0x2F, 0xC0, 0x3F, 0xE0, 0x0F, 0xCB, 0xE0, 0x0B, 0xF0, 0x03, 0xF2, 0xF8, 0x03, 0xFF, 0x00,
-    0xFC, 0x7F, 0x03, 0xFF, 0xE0, 0xBF, 0x0F, 0xFF, 0xF9, 0xFF, 0xFF, 0x82, 0xFF, 0xF8, 0x1F, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0x3F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF,
-    0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F,
-    0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x7F, 0xDF, 0xF7, 0xFD, 0xFF, 0x55, 0x40,
-    0x2A, 0x40, 0xA9, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F,
-    0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1,
-    0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE, 0x3F, 0xC1, 0xFE,
-    0x3F, 0xC1, 0xFE, 0x15, 0x40, 0x55, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0x80, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xC7, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x02,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x87, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0x56, 0xFF, 0xE0, 0xFF, 0x80, 0x00, 0xBF, 0xC7, 0xFC, 0x00, 0x00,
-    0xFF, 0x5F, 0xE0, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB,
-    0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00,
-    0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07,
-    0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF,
-    0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00,
-    0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F,
-    0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4,
-    0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x00,
-    0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0x40, 0x00, 0x07, 0xFA,
-    0xFD, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x01, 0xFE, 0x7F, 0x80,
-    0x00, 0x0B, 0xF5, 0xFF, 0x00, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x02, 0xFF, 0x0B, 0xFF, 0x95, 0xBF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x59, 0x40, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x02, 0xFF, 0x07, 0xD0, 0x00, 0x0F, 0xFC, 0x04,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x04, 0x07, 0xFD, 0x00, 0x00, 0xFC, 0x2F,
-    0xF0, 0x00, 0x0B, 0xFE, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00, 0x00,
-    0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0x40,
-    0x00, 0x07, 0xFE, 0x01, 0x50, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xFE,
-    0x07, 0xFF, 0x07, 0xFE, 0x03, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xD0, 0x3F, 0xF0, 0x7F, 0xE0, 0x7F, 0xC0, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x01, 0x50, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3C, 0x0B, 0xFF, 0xFF,
-    0x40, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x7F, 0xFF, 0xF8, 0x0E, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x14, 0x03, 0xFF, 0xF8, 0x00, 0x7D,
-    0x0F, 0xFF, 0xFF, 0x96, 0xFE, 0x2F, 0xE6, 0xFF, 0xFF, 0xFC, 0x2F, 0x40, 0x1F, 0xFF, 0xF0, 0x0A,
-    0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x55, 0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55,
-    0x54, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x01, 0xA4, 0x00, 0x14, 0x03, 0xFF, 0xD0, 0x0F, 0xC3, 0xFF, 0xFE, 0x0B, 0xF1, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0x03, 0xFF, 0xFD, 0x0F, 0x40, 0x1F, 0xFD, 0x00, 0x40, 0x00, 0x54, 0x00, 0x0B, 0xE0,
-    0x00, 0x60, 0x0F, 0xFF, 0x80, 0x3F, 0x0F, 0xFF, 0xFD, 0x2F, 0xC7, 0xFE, 0xFF, 0xFF, 0xF2, 0xF8,
-    0x0B, 0xFF, 0xF0, 0x2C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xE4, 0x00, 0x00, 0x06, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFA, 0x55, 0x6B, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF0, 0x2A, 0xAA, 0xBF, 0xE9, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xEA, 0xAA, 0xFF, 0xAA, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xAA, 0xFE, 0xAA, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFA, 0xAA, 0xA4, 0x2F, 0x80, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xFF,
-    0xF4, 0x00, 0xBF, 0xF9, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x02, 0xFF, 0xD0, 0x01, 0xBF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x02, 0xFF, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xFF,
-    0x40, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF,
-    0x40, 0x1F, 0xFF, 0x40, 0x07, 0xFF, 0x90, 0x07, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x07,
-    0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x0B, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xD0, 0x02, 0xFF, 0xF4, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFD, 0x00, 0xBF, 0x40,
-    0x02, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x02, 0xFF,
-    0x40, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0xAA, 0xA4,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x1F,
-    0xE0, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0xBF,
-    0xF0, 0x6A, 0xBF, 0xFA, 0xBF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xAA, 0xAA, 0xA0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x2A, 0xAA, 0xAA, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x9F, 0xDB, 0xFD, 0x00,
-    0x01, 0xFE, 0x03, 0xF0, 0x2F, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x0F,
-    0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAF, 0xEA,
-    0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0,
-    0x00, 0x3F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0xFC, 0x6F, 0xE0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF1, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x7E, 0xBF, 0x00,
-    0x07, 0xF6, 0xF4, 0x2F, 0x0B, 0xF0, 0x07, 0xF4, 0x3E, 0x0F, 0xC0, 0xBF, 0x07, 0xF4, 0x0F, 0xC3,
-    0xE0, 0x0B, 0xF7, 0xF4, 0x02, 0xF1, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x0B, 0xF8,
-    0x00, 0x1F, 0x5F, 0x40, 0x07, 0xFF, 0x00, 0x07, 0xD3, 0xD0, 0x07, 0xFF, 0xF0, 0x01, 0xF0, 0xF8,
-    0x07, 0xF4, 0xBF, 0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x0B, 0xF0, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0xBF,
-    0x1F, 0x40, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0x90, 0x1B, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xF6, 0xF4,
-    0x2F, 0x00, 0x00, 0x07, 0xF4, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xF4, 0x0F, 0xC3, 0xE0, 0x00, 0x07,
-    0xF4, 0x02, 0xF1, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0x5F,
-    0x40, 0x07, 0xF4, 0x00, 0x07, 0xD3, 0xD0, 0x07, 0xF4, 0x00, 0x01, 0xF0, 0xF8, 0x07, 0xF4, 0x00,
-    0x00, 0xBC, 0x3F, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x07, 0xD7, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0xFF,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x6F, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0x81, 0xFF, 0xCB, 0xFF, 0x2F, 0xFC,
-    0x7F, 0xE0, 0x15, 0x00, 0x0A, 0x90, 0x00, 0x2A, 0x40, 0x00, 0xA9, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x1F,
-    0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_bolditalicBitmaps[50141] = {
+    0x59, 0xAA, 0xA5, 0xAF, 0x49, 0xF9, 0x4F, 0xC5, 0xFA, 0x49, 0xF9, 0x49, 0xF5, 0xAE, 0xA5, 0xF9,
+    0x5F, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0x9E, 0x6A, 0xE6, 0xAD, 0xA6, 0xAD, 0x96, 0xE7, 0xA9, 0x77,
+    0x39, 0x99, 0x6A, 0xE9, 0x5F, 0xA4, 0x9F, 0x95, 0xEA, 0x69, 0x99, 0x60, 0x29, 0xAA, 0x91, 0x9A,
+    0xA9, 0x19, 0xE9, 0x0A, 0xE2, 0xF1, 0xF1, 0x9F, 0x09, 0xEA, 0x19, 0xE9, 0x0A, 0xE9, 0x1A, 0xE1,
+    0xF2, 0xF1, 0xF2, 0xEA, 0x1E, 0xA2, 0xE9, 0x1E, 0x92, 0xE2, 0xE3, 0xCA, 0x91, 0x9C, 0xA9, 0x77,
+    0x6A, 0xDA, 0x29, 0xDA, 0x71, 0xEA, 0x2A, 0xE7, 0x1E, 0x92, 0xEA, 0x70, 0x9E, 0x3E, 0x97, 0x0A,
+    0xE2, 0x9E, 0x59, 0xAA, 0xAF, 0xAA, 0xAF, 0xAA, 0xA9, 0x1F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x5A,
+    0xE2, 0x9E, 0x71, 0xEA, 0x2A, 0xE7, 0x1E, 0x92, 0xEA, 0x70, 0x9E, 0x3E, 0x95, 0x99, 0x9F, 0x99,
+    0x9A, 0xEA, 0x99, 0x91, 0x9F, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xFC, 0x91, 0x99, 0x9A, 0xE9, 0x99,
+    0x9E, 0xA9, 0x99, 0x5A, 0xE2, 0x9E, 0x71, 0xEA, 0x2A, 0xE7, 0x1E, 0x92, 0xEA, 0x70, 0x9E, 0x3E,
+    0x97, 0x19, 0x99, 0x39, 0x99, 0x70, 0x77, 0x75, 0xAC, 0xA7, 0x6D, 0x97, 0x6D, 0x76, 0x9D, 0x73,
+    0x9F, 0xCA, 0x70, 0xAF, 0xFC, 0x95, 0xAF, 0xFE, 0x93, 0x9E, 0x90, 0x9D, 0x9F, 0x3E, 0xA1, 0xAC,
+    0xA0, 0xAE, 0x3E, 0xA1, 0xD9, 0x09, 0xDA, 0x29, 0xF0, 0x9D, 0x2D, 0x4F, 0xCA, 0xD7, 0x1F, 0xEA,
+    0x71, 0x9F, 0xE7, 0x29, 0xFE, 0x97, 0x19, 0xFE, 0x97, 0x2F, 0xE9, 0x71, 0xFF, 0x29, 0xD2, 0x9D,
+    0x0A, 0xF1, 0x9E, 0x2D, 0xA1, 0xF1, 0xAE, 0x91, 0xD9, 0x1F, 0x1A, 0xF0, 0x9D, 0x19, 0xEA, 0x19,
+    0xFA, 0xAD, 0x09, 0xF3, 0xFF, 0xFC, 0x94, 0xFF, 0xE9, 0x69, 0xFE, 0x97, 0x2A, 0xCA, 0x76, 0xD9,
+    0x75, 0x9D, 0x76, 0xAD, 0x76, 0xDA, 0x76, 0xD9, 0x77, 0x74, 0x77, 0x77, 0x77, 0x3C, 0xA7, 0x3A,
+    0xE9, 0x71, 0xAE, 0x70, 0xAF, 0xE7, 0x0F, 0x7A, 0xFF, 0xA6, 0xF7, 0xAE, 0x91, 0xF5, 0xAE, 0x97,
+    0xEA, 0x2A, 0xE4, 0x9E, 0xA7, 0xAE, 0x3A, 0xE4, 0xEA, 0x70, 0xF3, 0xF3, 0xAE, 0x71, 0xEA, 0x3F,
+    0x29, 0xE9, 0x71, 0xEA, 0x3E, 0xA2, 0xE9, 0x71, 0x9E, 0xA2, 0xAE, 0x2A, 0xDA, 0x59, 0x4E, 0xA2,
+    0xEA, 0x19, 0xE2, 0x9F, 0xCA, 0x2F, 0xAA, 0xF2, 0xE2, 0xAF, 0xF1, 0x9F, 0xF2, 0xE9, 0x1A, 0xEA,
+    0x9F, 0x91, 0x9F, 0xC9, 0x2A, 0xDA, 0x19, 0xEA, 0x19, 0xEA, 0x72, 0x9E, 0x2F, 0x3E, 0xA7, 0x2E,
+    0x92, 0xEA, 0x3E, 0xA7, 0x1E, 0xA2, 0x9E, 0x92, 0x9E, 0xA7, 0x0A, 0xE3, 0xAE, 0x39, 0xE9, 0x79,
+    0xE9, 0x3A, 0xE3, 0xF7, 0x0E, 0xA4, 0xAE, 0x29, 0xEA, 0x7F, 0x5A, 0xE9, 0x1F, 0x7A, 0xE9, 0x6F,
+    0xFC, 0x79, 0xEA, 0x79, 0xFD, 0xA7, 0x09, 0xE7, 0x2A, 0xAA, 0xA7, 0x4C, 0x77, 0x77, 0x77, 0x30,
+    0x77, 0x77, 0x5A, 0xFA, 0x77, 0x29, 0xFF, 0x97, 0x79, 0xFF, 0xCA, 0x77, 0xF2, 0xF7, 0x6A, 0xE3,
+    0xAE, 0x76, 0xEA, 0x3E, 0xA7, 0x59, 0xE9, 0x2A, 0xE7, 0x6A, 0xE2, 0xAE, 0x7C, 0x95, 0xAE, 0x99,
+    0xF6, 0x9D, 0xA5, 0xAF, 0xE9, 0x39, 0xAF, 0xCA, 0x5A, 0xFC, 0x92, 0x9A, 0xFF, 0x49, 0xFD, 0x3A,
+    0xFE, 0xA9, 0x4A, 0xFE, 0x92, 0xFE, 0x6A, 0xE9, 0x9F, 0x2C, 0xA9, 0xAD, 0xA5, 0x9E, 0xA1, 0xF9,
+    0x4E, 0x95, 0xF9, 0x19, 0xF3, 0x9E, 0x6F, 0x3F, 0xA2, 0xEA, 0x59, 0xF3, 0x9F, 0xA0, 0xAE, 0x69,
+    0xF4, 0xAF, 0xFA, 0x7F, 0x94, 0xFE, 0xA7, 0x0F, 0xC9, 0x4F, 0xD9, 0x70, 0x9F, 0xEA, 0xFF, 0xD9,
+    0x79, 0xFF, 0xFF, 0xEA, 0x99, 0x5A, 0xFE, 0xA9, 0x09, 0xFF, 0xCA, 0x79, 0x99, 0x69, 0xFE, 0x77,
+    0x59, 0x9A, 0x92, 0x29, 0xAA, 0x91, 0x9E, 0x91, 0xF1, 0x9F, 0x19, 0xE9, 0x1A, 0xE2, 0xF2, 0xEA,
+    0x2E, 0x92, 0xE3, 0xCA, 0x97, 0x10, 0x77, 0x71, 0xAC, 0xA7, 0x19, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7,
+    0x0F, 0xA7, 0x0A, 0xEA, 0x70, 0x9F, 0x71, 0xF7, 0x1F, 0x97, 0x09, 0xF7, 0x1F, 0x97, 0x09, 0xF7,
+    0x1A, 0xE9, 0x71, 0xF7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71,
+    0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0xA7, 0x19, 0xF7, 0x2F, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xF9,
+    0x71, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9D, 0x97, 0x74, 0x77, 0x49, 0xCA, 0x73,
+    0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x1A, 0xF7, 0x2F, 0x97, 0x1A, 0xEA, 0x71, 0x9F, 0x72,
+    0xF7, 0x2F, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71,
+    0xF9, 0x71, 0xF7, 0x2F, 0x71, 0xAE, 0xA7, 0x1F, 0x71, 0x9F, 0x71, 0xF9, 0x70, 0x9E, 0xA7, 0x1F,
+    0x71, 0xF9, 0x70, 0xAE, 0xA7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x71, 0xE7, 0x49,
+    0x73, 0x77, 0x2A, 0xD9, 0x4A, 0xC1, 0xF3, 0xAD, 0xA0, 0xE4, 0xFA, 0xD9, 0x59, 0xFC, 0xAE, 0x4A,
+    0xFE, 0x19, 0xAF, 0xC9, 0xAD, 0x1F, 0x9D, 0x91, 0x91, 0x9D, 0xA0, 0xE5, 0x9A, 0x1E, 0xA7, 0x0D,
+    0xA3, 0x59, 0x99, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x5A, 0xAA, 0xAA,
+    0xFC, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0xAE, 0x99, 0x99, 0x95, 0xAE,
+    0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x77, 0x40, 0x49, 0xAA, 0x5F, 0xA4, 0xFC, 0x4A,
+    0xF4, 0xAE, 0xA4, 0xF9, 0x39, 0xEA, 0x39, 0xF3, 0xAF, 0x4E, 0xA6, 0x96, 0x09, 0x99, 0x99, 0x99,
+    0x91, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x90, 0x19, 0xAA,
+    0x2A, 0xF1, 0xFC, 0x1F, 0xC1, 0xF3, 0x99, 0x20, 0x77, 0xEA, 0x77, 0xAE, 0x97, 0x69, 0xEA, 0x77,
+    0xF7, 0x7A, 0xEA, 0x77, 0xF7, 0x7A, 0xE9, 0x76, 0x9E, 0xA7, 0x7F, 0x77, 0x9E, 0xA7, 0x7F, 0x77,
+    0xAE, 0x97, 0x69, 0xEA, 0x77, 0xF7, 0x79, 0xEA, 0x77, 0xF7, 0x7A, 0xE9, 0x76, 0x9E, 0xA7, 0x7F,
+    0x77, 0x9E, 0xA7, 0x7F, 0x77, 0xAE, 0x97, 0x69, 0xF7, 0x7F, 0x77, 0x9E, 0xA7, 0x79, 0x99, 0x97,
+    0x70, 0x71, 0xAA, 0xEA, 0x73, 0xAF, 0xFA, 0x79, 0xFF, 0xEA, 0x5A, 0xFF, 0xFC, 0x4A, 0xFC, 0x3F,
+    0xCA, 0x29, 0xFA, 0x49, 0xFC, 0x2F, 0xC6, 0xFC, 0x19, 0xF9, 0x6F, 0xC1, 0xFC, 0x7F, 0xC0, 0x9F,
+    0x97, 0xFC, 0x0A, 0xF7, 0x0F, 0xC0, 0xFC, 0x79, 0xFA, 0x0F, 0xA7, 0x9F, 0x99, 0xFA, 0x7F, 0xC0,
+    0x9F, 0x97, 0xFA, 0x09, 0xF9, 0x6A, 0xF1, 0x9F, 0xA6, 0xFA, 0x19, 0xFA, 0x5F, 0xC3, 0xFC, 0x4A,
+    0xF9, 0x3F, 0xD9, 0x9A, 0xFC, 0x94, 0x9F, 0xFF, 0x96, 0xAF, 0xFD, 0x71, 0x9F, 0xE9, 0x75, 0x99,
+    0x97, 0x20, 0x77, 0x70, 0x9D, 0x70, 0x9A, 0xFC, 0x4A, 0xFF, 0xC3, 0x9F, 0xFC, 0xA4, 0xAF, 0xF9,
+    0x70, 0xFC, 0x70, 0x9F, 0xC7, 0x0A, 0xFA, 0x70, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0xFC, 0x70, 0x9F,
+    0xC7, 0x0A, 0xFA, 0x70, 0xFC, 0x97, 0x0F, 0xC7, 0x09, 0xFC, 0x70, 0xAF, 0xC7, 0x0A, 0xFA, 0x70,
+    0xFC, 0x97, 0x0F, 0xC6, 0x9F, 0xFC, 0xA2, 0xFF, 0xF9, 0x09, 0xFF, 0xF1, 0x70, 0xAA, 0xEA, 0x97,
+    0x19, 0xFF, 0xD7, 0xAF, 0xFF, 0x5A, 0xFC, 0xAA, 0xAF, 0xCA, 0x4F, 0xC3, 0x9F, 0xC3, 0xAF, 0x5F,
+    0xC3, 0x9E, 0x6F, 0xC5, 0xA9, 0x59, 0xFA, 0x75, 0xFC, 0x97, 0x4A, 0xFA, 0x74, 0xAF, 0xC7, 0x4A,
+    0xFC, 0x74, 0xAF, 0xC7, 0x4F, 0xD7, 0x4F, 0xD7, 0x39, 0xFC, 0xA7, 0x39, 0xFC, 0x97, 0x3A, 0xFC,
+    0x74, 0xAF, 0xA7, 0x4F, 0xFF, 0xF2, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xA2, 0x9F, 0xFF, 0xDA, 0x30,
+    0x70, 0xAA, 0xEA, 0x71, 0x9F, 0xFC, 0xA6, 0xAF, 0xFE, 0xA4, 0x9F, 0xCA, 0xAA, 0xFC, 0x4F, 0xA3,
+    0x9F, 0x93, 0xEA, 0x5F, 0x93, 0x9D, 0x59, 0xF9, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0xAF, 0xC7, 0x19,
+    0xFD, 0xA7, 0x09, 0xFF, 0xC9, 0x70, 0xFF, 0xD9, 0x7C, 0xA9, 0x99, 0xFD, 0x75, 0xFC, 0x75, 0xAF,
+    0x75, 0xFC, 0x74, 0xAF, 0xA7, 0x29, 0xFD, 0x70, 0x9A, 0xFE, 0x3A, 0xFF, 0xFC, 0x49, 0xFF, 0xE9,
+    0x6A, 0xFE, 0xA9, 0x72, 0x99, 0x75, 0x76, 0xAC, 0xA7, 0x69, 0xF7, 0x59, 0xFC, 0x74, 0x9F, 0xCA,
+    0x73, 0x9F, 0xDA, 0x72, 0x9F, 0xE9, 0x71, 0x9F, 0xF7, 0x19, 0xF0, 0xF7, 0x09, 0xF0, 0x9E, 0xA7,
+    0x9F, 0x1A, 0xE9, 0x69, 0xF2, 0xF6, 0x9F, 0x3F, 0x59, 0xF3, 0x9F, 0x49, 0xF4, 0xAE, 0xA3, 0x9F,
+    0xFF, 0xFD, 0x0A, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x1A, 0xFF, 0xFF, 0x97, 0x2A, 0xEA, 0x76,
+    0xF9, 0x76, 0xF7, 0x69, 0xF7, 0x6A, 0xEA, 0x50, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5F,
+    0xFF, 0xA4, 0x9F, 0xFF, 0x94, 0xAF, 0xFF, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xFC, 0x97, 0x4F,
+    0xF9, 0x70, 0x9F, 0xFC, 0xA7, 0x9F, 0xFD, 0xA7, 0x3A, 0xFD, 0x97, 0x4F, 0xCA, 0x74, 0x9F, 0xC7,
+    0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x72, 0x9F, 0xD9, 0x59, 0x99, 0xAF, 0xE9,
+    0x4F, 0xFF, 0x95, 0xAF, 0xFC, 0xA7, 0x9F, 0xDA, 0x97, 0x39, 0x97, 0x60, 0x74, 0x9A, 0xE9, 0x72,
+    0x9F, 0xF9, 0x79, 0xFF, 0xCA, 0x96, 0xAF, 0xE9, 0x71, 0xFE, 0x97, 0x2F, 0xD9, 0x73, 0xFD, 0x74,
+    0xAF, 0xA7, 0x49, 0xFC, 0xA9, 0x99, 0x71, 0xFF, 0xEA, 0x69, 0xFF, 0xFC, 0x5F, 0xFF, 0xE4, 0xFA,
+    0x39, 0xFC, 0x92, 0x9F, 0x94, 0xAF, 0xA2, 0xAF, 0x59, 0xFA, 0x2A, 0xF5, 0x9F, 0x92, 0xAF, 0x59,
+    0xF9, 0x2A, 0xF5, 0xAF, 0x39, 0xFA, 0x39, 0xFA, 0x4F, 0xCA, 0x19, 0xFC, 0x59, 0xFF, 0xF9, 0x6A,
+    0xFF, 0xD9, 0x70, 0x9A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x93, 0xFF, 0xFF, 0x2F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1, 0xAE, 0xA9, 0x99, 0x99, 0x9F, 0xC2, 0xF5,
+    0xFC, 0x3E, 0x94, 0xAF, 0x93, 0xE4, 0x9F, 0x97, 0x39, 0xFA, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xAF,
+    0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73,
+    0x9F, 0xC7, 0x4F, 0xC9, 0x74, 0xFC, 0x75, 0xF9, 0x75, 0xF7, 0x79, 0x99, 0x75, 0x70, 0xAA, 0xEA,
+    0x72, 0xFF, 0xCA, 0x69, 0xFF, 0xEA, 0x49, 0xFC, 0x99, 0x9F, 0xC4, 0xFA, 0x4F, 0x92, 0x9F, 0x5F,
+    0x92, 0xAF, 0x49, 0xF3, 0xAF, 0x4F, 0xA4, 0xFC, 0x90, 0x9F, 0xC5, 0xAF, 0xFE, 0x7A, 0xFF, 0x97,
+    0x0A, 0xFE, 0xA7, 0x9F, 0xFD, 0xA5, 0xAF, 0xA0, 0x9F, 0xCA, 0x39, 0xF9, 0x3F, 0xC3, 0xF9, 0x49,
+    0xF9, 0x1A, 0xF6, 0xFA, 0x1F, 0xA6, 0xF9, 0x1F, 0xC5, 0xAF, 0x2A, 0xFC, 0x3A, 0xFA, 0x3F, 0xFF,
+    0xCA, 0x49, 0xFF, 0xEA, 0x7A, 0xFE, 0xA7, 0x49, 0x97, 0x20, 0x70, 0x9A, 0xEA, 0xA7, 0x39, 0xFF,
+    0xCA, 0x70, 0x9F, 0xFE, 0xA6, 0x9F, 0xCA, 0xAA, 0xFC, 0x95, 0xFC, 0x39, 0xFA, 0x49, 0xF9, 0x4F,
+    0xC4, 0xAF, 0x5A, 0xF4, 0xAF, 0x59, 0xF4, 0xFC, 0x5A, 0xF4, 0xFC, 0x5A, 0xF4, 0xAF, 0xA4, 0xFC,
+    0x5F, 0xCA, 0x99, 0x9A, 0xFA, 0x5A, 0xFF, 0xFC, 0x7A, 0xFF, 0xEA, 0x70, 0x9A, 0xFF, 0xC7, 0x6F,
+    0xC9, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x4A, 0xFD, 0x73, 0xAF, 0xDA, 0x70, 0x9A, 0xFF, 0x97, 0x0F,
+    0xFC, 0xA7, 0x29, 0xFD, 0x97, 0x69, 0x97, 0x70, 0x75, 0xE9, 0x3F, 0xC2, 0x9F, 0xC2, 0x9F, 0x93,
+    0xAD, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xA4, 0xAF, 0x3F, 0xC3, 0xFC, 0x3F, 0x59, 0x94, 0x77,
+    0x3E, 0x96, 0xFC, 0x6F, 0xC5, 0x9F, 0x96, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA,
+    0x7F, 0xA6, 0xFC, 0x6A, 0xF6, 0xAE, 0xA6, 0xF9, 0x59, 0xEA, 0x59, 0xF5, 0xAF, 0x6E, 0xA7, 0x09,
+    0x70, 0x73, 0x97, 0x39, 0xDA, 0x70, 0x9F, 0xC6, 0x9F, 0xD9, 0x49, 0xFD, 0x94, 0xAF, 0xD9, 0x4A,
+    0xFC, 0xA7, 0xFC, 0x71, 0xFD, 0x97, 0x09, 0xFD, 0x97, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x0A,
+    0xFD, 0x97, 0x0A, 0xF7, 0x3A, 0xC9, 0x77, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x75, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x09, 0x75, 0xDA, 0x72, 0xAF, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0x97,
+    0x09, 0xFD, 0x97, 0x09, 0xFC, 0xA7, 0x0A, 0xFA, 0x59, 0xAF, 0xC9, 0x49, 0xFD, 0x94, 0x9F, 0xD9,
+    0x49, 0xFD, 0x96, 0x9F, 0x97, 0x1D, 0x97, 0x77, 0x10, 0x2A, 0xEA, 0x94, 0xFE, 0xA2, 0xAF, 0xF9,
+    0x1A, 0xFF, 0xC1, 0xAD, 0x99, 0x9F, 0x29, 0x3A, 0xE7, 0xAE, 0x7E, 0xA6, 0xF6, 0xF6, 0xF6, 0xF6,
+    0xF6, 0xAD, 0xA7, 0xEA, 0x99, 0x94, 0xFD, 0xA4, 0xAF, 0xC6, 0x9A, 0xA9, 0x77, 0x39, 0x99, 0x7A,
+    0xE9, 0x6F, 0xA5, 0x9F, 0x96, 0xF7, 0x09, 0x97, 0x75, 0x9A, 0xAF, 0xAA, 0x97, 0x71, 0x9A, 0xFF,
+    0xFA, 0x75, 0x9F, 0xFF, 0xFC, 0x97, 0x2A, 0xFD, 0xAA, 0x99, 0x99, 0xAF, 0xD9, 0x70, 0xFC, 0xA9,
+    0x71, 0xFC, 0x7F, 0xC9, 0x74, 0xAE, 0xA5, 0xFA, 0x77, 0xF4, 0xAE, 0xA4, 0x9A, 0xCA, 0x19, 0xAA,
+    0x2A, 0xE9, 0x29, 0xF4, 0xFD, 0xAE, 0x3E, 0x92, 0xF4, 0xFF, 0xDA, 0x3E, 0xA1, 0x9E, 0x93, 0xF9,
+    0x1F, 0x4E, 0xA1, 0xF3, 0x9E, 0x92, 0x9E, 0x4E, 0x91, 0xEA, 0x3F, 0x3A, 0xDA, 0x39, 0xE9, 0x09,
+    0xE9, 0x29, 0xE9, 0x3E, 0x93, 0xAE, 0x1A, 0xE3, 0xAE, 0x39, 0xE4, 0xF1, 0xF3, 0xF3, 0xF3, 0x9E,
+    0x91, 0xF3, 0xF2, 0x9E, 0xA3, 0xF2, 0xF3, 0xF2, 0xF9, 0x2F, 0x92, 0xF3, 0xFC, 0xAD, 0xAD, 0xA0,
+    0x9F, 0x93, 0xF3, 0xAF, 0xDA, 0x0F, 0xF9, 0x4F, 0x39, 0xFC, 0xA1, 0xFE, 0x6A, 0xE9, 0x39, 0xAC,
+    0xA9, 0x3A, 0xCA, 0xA9, 0x79, 0xF7, 0x77, 0x2F, 0xA7, 0x77, 0x1A, 0xFA, 0x74, 0xA7, 0x3F, 0xD9,
+    0x79, 0xE9, 0x73, 0xFF, 0xFF, 0xD7, 0x5A, 0xFF, 0xFD, 0xA7, 0x70, 0xAF, 0xFD, 0xA7, 0x76, 0x99,
+    0x99, 0x77, 0x77, 0x09, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9,
+    0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F,
+    0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F,
+    0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9,
+    0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x71, 0x99, 0x99,
+    0x99, 0x73, 0xAF, 0xFE, 0x96, 0x9F, 0xFF, 0xDA, 0x5A, 0xFF, 0xAF, 0xD9, 0x49, 0x99, 0x9F, 0x91,
+    0x9F, 0xC7, 0x9F, 0x92, 0xAF, 0x7A, 0xF3, 0x9F, 0x7F, 0xC3, 0x9F, 0x7F, 0xA3, 0xAE, 0xA6, 0x9F,
+    0x93, 0xF7, 0x9F, 0xA9, 0x90, 0xF9, 0x7A, 0xFF, 0xE9, 0x70, 0xFF, 0xFC, 0x97, 0xFC, 0xAA, 0xFE,
+    0x69, 0xF9, 0x3F, 0xCA, 0x5A, 0xF4, 0x9F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFA, 0x5F,
+    0xA4, 0x9F, 0x94, 0xAF, 0x5A, 0xF4, 0xAF, 0xA3, 0x9F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0x94, 0xFF,
+    0xFC, 0xA9, 0x77, 0x73, 0x73, 0x99, 0x99, 0x74, 0x9A, 0xFF, 0xA9, 0x7F, 0xFF, 0xC9, 0x49, 0xFF,
+    0xFD, 0x4A, 0xFD, 0xA9, 0x19, 0xF3, 0x9F, 0xC9, 0x5A, 0xE3, 0xFC, 0x7A, 0xDA, 0x2F, 0xC9, 0x7E,
+    0x29, 0xFA, 0x70, 0x99, 0x3F, 0xC9, 0x76, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7,
+    0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x6F, 0xD7, 0x6A, 0xFC, 0x72, 0xA2, 0xAF, 0xD7, 0x9D, 0x3F, 0xE9,
+    0x39, 0xAE, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE6, 0xFF, 0xFA, 0x70, 0x9F, 0xFA, 0x76, 0x99, 0x97,
+    0x10, 0x71, 0x99, 0x99, 0x99, 0x97, 0x6A, 0xFF, 0xF9, 0x71, 0x9F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFF,
+    0xCA, 0x69, 0xA9, 0x9F, 0xA1, 0x9A, 0xFD, 0x97, 0x09, 0xF9, 0x39, 0xFD, 0x70, 0xAF, 0x6F, 0xC9,
+    0x7F, 0xC6, 0xAF, 0xC7, 0xFC, 0x69, 0xFC, 0x69, 0xFA, 0x7F, 0xC6, 0x9F, 0x97, 0xFC, 0x6A, 0xF7,
+    0x0F, 0xC6, 0xFC, 0x70, 0xFC, 0x6F, 0xC7, 0x9F, 0xC5, 0x9F, 0xA7, 0xAF, 0xA5, 0xAF, 0x97, 0xFC,
+    0x95, 0xAF, 0x79, 0xFC, 0x6F, 0xC7, 0xFC, 0x96, 0xFC, 0x6F, 0xCA, 0x69, 0xFA, 0x49, 0xFD, 0x7A,
+    0xFA, 0x99, 0x9A, 0xFE, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA9, 0x77,
+    0x77, 0x30, 0x5F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2, 0x99, 0xAE,
+    0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09, 0xFA, 0x77,
+    0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA, 0x77, 0x0A,
+    0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E, 0xA6, 0xAF,
+    0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x30, 0x5F, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xFE, 0xA4, 0x9F, 0xFF, 0xEA, 0x7F, 0xC2, 0x99, 0xE9, 0x69, 0xFA, 0x4E, 0x7A,
+    0xF9, 0x4E, 0x7F, 0xC5, 0xD9, 0x7F, 0xC7, 0x79, 0xFA, 0x77, 0x9F, 0x97, 0x7A, 0xFA, 0x9A, 0xAA,
+    0xAA, 0x71, 0xFF, 0xF7, 0x1F, 0xFE, 0xA7, 0x09, 0xFC, 0xAA, 0xAA, 0xAA, 0x71, 0xAF, 0x97, 0x7F,
+    0xC7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x59, 0xFF, 0xA7, 0x2A, 0xFF,
+    0xD9, 0x71, 0xFF, 0xE7, 0x10, 0x73, 0x99, 0x99, 0x97, 0x49, 0xAF, 0xFC, 0xA9, 0x7A, 0xFF, 0xFC,
+    0x94, 0x9F, 0xFF, 0xE4, 0xAF, 0xD9, 0x39, 0xF3, 0x9F, 0xC9, 0x6A, 0xE3, 0xFC, 0x70, 0xEA, 0x2F,
+    0xC9, 0x70, 0xE2, 0x9F, 0xC7, 0x19, 0x93, 0xFC, 0x97, 0x7F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0xA7,
+    0x7F, 0xCA, 0x5F, 0xFC, 0xAF, 0xCA, 0x5F, 0xFC, 0x9F, 0xCA, 0x5A, 0xFE, 0xA0, 0xFD, 0x70, 0xFC,
+    0x1A, 0xFC, 0x70, 0xFA, 0x19, 0xFC, 0xA7, 0xF9, 0x2F, 0xDA, 0x59, 0xF3, 0x9F, 0xEA, 0x99, 0x99,
+    0xFC, 0x4A, 0xFF, 0xFF, 0x59, 0xFF, 0xFD, 0x97, 0xAF, 0xFC, 0xA9, 0x75, 0x99, 0x97, 0x10, 0x5F,
+    0xFD, 0x2A, 0xFF, 0xC9, 0x4A, 0xFF, 0xCA, 0x2F, 0xFD, 0x59, 0xFF, 0xA3, 0xAF, 0xEA, 0x97, 0x0F,
+    0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7, 0x2F, 0xC7, 0x9F, 0xA7, 0x2F,
+    0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7A, 0xF7, 0x29, 0xFA, 0x7F, 0xC7, 0x2A, 0xFF, 0xFF, 0xD7, 0x2F,
+    0xFF, 0xFD, 0xA7, 0x2F, 0xFF, 0xFD, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7, 0x2F,
+    0xC7, 0x0F, 0xA7, 0x2F, 0xC7, 0x9F, 0x97, 0x2F, 0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A,
+    0xF9, 0x7F, 0xC7, 0x09, 0xFE, 0xA9, 0x3A, 0xFE, 0xA5, 0xAF, 0xFC, 0xA2, 0xFF, 0xD5, 0xFF, 0xD9,
+    0x19, 0xFF, 0xD4, 0x5F, 0xFD, 0x5A, 0xFF, 0xD5, 0x9F, 0xFA, 0x71, 0xFC, 0x72, 0x9F, 0xA7, 0x2A,
+    0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC,
+    0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9,
+    0x70, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x40, 0x71, 0xFF, 0xD9, 0x70, 0xAF, 0xFD,
+    0x72, 0xFF, 0xA7, 0x5F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0x9F, 0x97,
+    0x6A, 0xF9, 0x76, 0xFC, 0x77, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x77, 0xFA, 0x76,
+    0xAF, 0x97, 0x0A, 0xA3, 0xFC, 0x70, 0x9E, 0x99, 0xFC, 0x97, 0x0A, 0xFF, 0xC9, 0x71, 0xAF, 0xF9,
+    0x72, 0x9F, 0xE7, 0x69, 0xA9, 0x97, 0x60, 0x5F, 0xFD, 0x1F, 0xFA, 0x4A, 0xFF, 0xCA, 0x09, 0xFF,
+    0x94, 0x9F, 0xFA, 0x29, 0xFD, 0x97, 0x0F, 0xA4, 0x9F, 0xA7, 0x19, 0xF9, 0x3A, 0xF9, 0x72, 0xAF,
+    0x3A, 0xF9, 0x73, 0xFC, 0x2A, 0xF7, 0x5F, 0xC1, 0xAF, 0x75, 0x9F, 0xA0, 0xFC, 0x76, 0x9F, 0x9F,
+    0xA7, 0x7A, 0xFF, 0xA7, 0x70, 0xFF, 0xC7, 0x71, 0xFF, 0xCA, 0x77, 0x9F, 0xAF, 0xC9, 0x76, 0xAF,
+    0x99, 0xFC, 0x76, 0xFC, 0x1A, 0xFC, 0x75, 0xFC, 0x2F, 0xCA, 0x74, 0xFA, 0x29, 0xFC, 0x97, 0x29,
+    0xF9, 0x3F, 0xD9, 0x71, 0xAF, 0x5F, 0xD9, 0x69, 0xFE, 0xA3, 0x9F, 0xDA, 0x4A, 0xFF, 0xCA, 0x39,
+    0xFE, 0x3F, 0xFD, 0x94, 0x9F, 0xC7, 0x77, 0x95, 0x5F, 0xFD, 0x70, 0xAF, 0xFC, 0xA7, 0x09, 0xFF,
+    0xA7, 0x4F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F,
+    0x97, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x69, 0xA9,
+    0x4F, 0xC6, 0xE4, 0xFC, 0x59, 0xE3, 0x9F, 0xA5, 0xEA, 0x3A, 0xF9, 0x39, 0xAE, 0x91, 0x9F, 0xFF,
+    0xF1, 0xAF, 0xFF, 0xFA, 0x1F, 0xFF, 0xFC, 0x10, 0x69, 0xFF, 0x7A, 0xFE, 0x7A, 0xFF, 0x69, 0xFF,
+    0x70, 0xAF, 0xE6, 0xFE, 0xA7, 0x2A, 0xFD, 0x94, 0x9F, 0xD9, 0x73, 0xFE, 0x94, 0xFE, 0x97, 0x29,
+    0xFE, 0x93, 0x9F, 0xE9, 0x72, 0xAE, 0xAE, 0xA3, 0xE9, 0xF7, 0x3E, 0xAA, 0xEA, 0x29, 0xE0, 0xF7,
+    0x3E, 0x09, 0xF2, 0xE9, 0x0F, 0x72, 0xAE, 0x09, 0xF1, 0xAE, 0x09, 0xF7, 0x2E, 0xA1, 0xF1, 0xE1,
+    0x9F, 0x72, 0xE9, 0x1F, 0x9A, 0xDA, 0x1A, 0xF7, 0x19, 0xE2, 0xFA, 0xE2, 0xAF, 0x71, 0xF2, 0xAF,
+    0xDA, 0x2A, 0xF7, 0x1E, 0x92, 0x9F, 0xD3, 0xFA, 0x70, 0x9E, 0x39, 0xFC, 0xA3, 0xFA, 0x70, 0xAE,
+    0x4F, 0xC4, 0xFA, 0x70, 0xEA, 0x4F, 0x94, 0xFA, 0x79, 0xE9, 0x4A, 0xE5, 0xFA, 0x7A, 0xE5, 0xAD,
+    0x95, 0xF9, 0x59, 0xAF, 0xA9, 0x72, 0x9A, 0xFE, 0x92, 0xAF, 0xF7, 0x19, 0xFF, 0xCA, 0x2F, 0xFC,
+    0x71, 0xAF, 0xFC, 0x91, 0x4F, 0xE6, 0xFF, 0xC4, 0xAF, 0xE9, 0x49, 0xFF, 0xC5, 0xFF, 0x5A, 0xFD,
+    0xA7, 0x0F, 0xD9, 0x6F, 0x71, 0x9F, 0xDA, 0x6E, 0xA7, 0x1A, 0xFE, 0x59, 0xE9, 0x71, 0xFF, 0xA4,
+    0xAE, 0x97, 0x1F, 0xFC, 0x4F, 0x72, 0xEA, 0xFC, 0x93, 0xF7, 0x19, 0xE9, 0x9F, 0xC3, 0xEA, 0x71,
+    0xAE, 0x1F, 0xC9, 0x19, 0xE9, 0x71, 0xF1, 0x9F, 0xC1, 0xAE, 0x72, 0xF2, 0xFC, 0x1F, 0x71, 0x9E,
+    0xA2, 0xAF, 0xA0, 0xF7, 0x1A, 0xE9, 0x3F, 0xC9, 0xEA, 0x71, 0xAE, 0x4A, 0xFF, 0x97, 0x1F, 0x5F,
+    0xF7, 0x2E, 0xA5, 0xAF, 0xE7, 0x19, 0xE9, 0x59, 0xFD, 0xA7, 0x1A, 0xE9, 0x6F, 0xDA, 0x70, 0xAF,
+    0xCA, 0x59, 0xFC, 0x96, 0x9F, 0xFA, 0x5F, 0xC7, 0xFF, 0xC9, 0x59, 0xF7, 0x77, 0x09, 0x97, 0x10,
+    0x73, 0x99, 0x99, 0x97, 0x7A, 0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0x96, 0xFD, 0xA9,
+    0x99, 0xAF, 0xD5, 0xFD, 0x59, 0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xC9, 0x79, 0xFC, 0x2A, 0xFC,
+    0x70, 0x9F, 0xC9, 0x1F, 0xC9, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFC, 0x71, 0x9F,
+    0xC9, 0x0F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0xA7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0xFC, 0xA1, 0xFC,
+    0xA7, 0x1F, 0xC9, 0x1F, 0xCA, 0x70, 0xAF, 0xC2, 0xFD, 0x70, 0xFC, 0x92, 0xAF, 0xC9, 0x6F, 0xD4,
+    0xFD, 0x5F, 0xD5, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xE7, 0x1F, 0xFF, 0xA7, 0x39, 0xFF,
+    0xA7, 0x71, 0x99, 0x74, 0x71, 0x99, 0x99, 0x99, 0x74, 0xAF, 0xFE, 0xA7, 0x9F, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xF5, 0x9A, 0x99, 0xFA, 0x1A, 0xFC, 0xA7, 0x9F, 0x92, 0xAF, 0xC7, 0xAF, 0x4F, 0xC7, 0xFC,
+    0x4F, 0xC7, 0xFC, 0x4F, 0xC6, 0x9F, 0xA3, 0x9F, 0xA6, 0x9F, 0x93, 0xFC, 0x7A, 0xF3, 0xFC, 0xA7,
+    0xFC, 0x99, 0xAF, 0xCA, 0x70, 0xFF, 0xF9, 0x70, 0x9F, 0xFD, 0xA7, 0x2A, 0xFC, 0xAA, 0x97, 0x5F,
+    0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x69, 0xFF, 0xA7, 0x3A,
+    0xFF, 0xD9, 0x72, 0xFF, 0xE7, 0x20, 0x73, 0x99, 0x99, 0x97, 0x73, 0xAF, 0xFA, 0x77, 0x9F, 0xFF,
+    0x97, 0x4F, 0xFF, 0xE9, 0x72, 0xFD, 0xA9, 0x99, 0xAF, 0xD7, 0x1F, 0xD5, 0xAF, 0xCA, 0x7A, 0xFC,
+    0x7F, 0xD7, 0xFC, 0x97, 0xAF, 0xC6, 0xAF, 0xC7, 0x09, 0xFC, 0x95, 0xFC, 0x97, 0x1F, 0xC9, 0x49,
+    0xFC, 0x72, 0xFC, 0x94, 0xAF, 0xC7, 0x19, 0xFC, 0x94, 0xFC, 0xA7, 0x19, 0xFC, 0x5F, 0xCA, 0x71,
+    0xAF, 0xC5, 0xFC, 0xA7, 0x1A, 0xFA, 0x5F, 0xCA, 0x71, 0xFC, 0x95, 0xFC, 0xA7, 0x09, 0xFC, 0x6F,
+    0xD7, 0x0F, 0xC9, 0x69, 0xFC, 0x7A, 0xFC, 0x70, 0xFD, 0x5A, 0xFC, 0x71, 0xAF, 0xD9, 0x09, 0xAF,
+    0xD7, 0x3F, 0xFF, 0xE7, 0x5F, 0xFF, 0x97, 0x7F, 0xEA, 0xA7, 0x73, 0xAF, 0xC9, 0x77, 0x59, 0xFD,
+    0xA9, 0x77, 0x4A, 0xFF, 0xA9, 0x77, 0x2F, 0xFF, 0xCA, 0xAC, 0xA7, 0x39, 0xFF, 0xFD, 0x97, 0x6A,
+    0xFF, 0xE7, 0x71, 0x9A, 0xFD, 0xA7, 0x77, 0x50, 0x71, 0x99, 0x99, 0x99, 0x75, 0x9A, 0xFF, 0xDA,
+    0x70, 0x9F, 0xFF, 0xE7, 0xAF, 0xFA, 0xFE, 0x69, 0x99, 0x9F, 0xA1, 0x9F, 0xCA, 0x70, 0x9F, 0x92,
+    0x9F, 0xC7, 0x0A, 0xF4, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFA, 0x79, 0xFA, 0x3A, 0xF9,
+    0x79, 0xF9, 0x29, 0xFA, 0x70, 0xAF, 0x19, 0xAF, 0xC7, 0x1F, 0xFF, 0xA7, 0x2F, 0xFD, 0xA7, 0x39,
+    0xFF, 0xD7, 0x4A, 0xF1, 0xF9, 0x73, 0xFC, 0x1F, 0xC7, 0x3F, 0xC1, 0x9F, 0xA7, 0x2F, 0xA2, 0xFC,
+    0xA7, 0x09, 0xF9, 0x3F, 0xC9, 0x7A, 0xF4, 0xAF, 0xCA, 0x49, 0xFE, 0xA3, 0xFD, 0xA2, 0xAF, 0xFC,
+    0xA3, 0xFE, 0x1F, 0xFD, 0x5A, 0xFA, 0x77, 0x39, 0x92, 0x71, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xC9,
+    0x6A, 0xFF, 0xEA, 0x4A, 0xFF, 0xFA, 0x39, 0xFA, 0x39, 0xE9, 0x3A, 0xF5, 0xE4, 0xFC, 0x5E, 0x4F,
+    0xC4, 0x9D, 0x94, 0xFC, 0xA7, 0x4F, 0xE7, 0x39, 0xFE, 0x97, 0x2A, 0xFF, 0x72, 0xAF, 0xF7, 0x29,
+    0xFF, 0x73, 0xAF, 0xDA, 0x73, 0x9F, 0xD3, 0xE5, 0x9F, 0xC2, 0x9E, 0x6F, 0xC2, 0xAE, 0x6F, 0xC2,
+    0xF9, 0x49, 0xFA, 0x2F, 0xC9, 0x2A, 0xFC, 0x3F, 0xFF, 0xD9, 0x39, 0xFF, 0xF9, 0x69, 0xFF, 0x97,
+    0x49, 0x97, 0x10, 0x0A, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x9E, 0xA9, 0x99,
+    0xFC, 0x99, 0x99, 0xEA, 0x0A, 0xE3, 0xFC, 0x3E, 0x90, 0xAD, 0xA2, 0x9F, 0xA3, 0xE1, 0xAD, 0x92,
+    0xAF, 0x92, 0x9D, 0xA2, 0xAA, 0x3F, 0xC3, 0x9A, 0xA7, 0x1F, 0xC7, 0x70, 0xFA, 0x77, 0x9F, 0xA7,
+    0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0xFC,
+    0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x75, 0x9A, 0xFD, 0xA9, 0x72, 0xAF, 0xFD, 0x72, 0xFF, 0xDA, 0x71,
+    0x09, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A,
+    0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F,
+    0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA,
+    0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F,
+    0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72,
+    0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x72, 0x99, 0x97, 0x70, 0x9F, 0xFC, 0xA3, 0xFF, 0xC0, 0xAF,
+    0xFC, 0xA2, 0x9F, 0xFC, 0x09, 0xFF, 0x94, 0x9F, 0xDA, 0x3A, 0xFA, 0x79, 0xF9, 0x49, 0xFA, 0x7F,
+    0xA6, 0xFC, 0x69, 0xF7, 0xFC, 0x6F, 0xA7, 0xFC, 0x59, 0xF7, 0x0A, 0xF5, 0xF9, 0x70, 0x9F, 0x49,
+    0xF7, 0x2F, 0x93, 0xF7, 0x3F, 0x92, 0x9E, 0xA7, 0x3F, 0xA2, 0xF7, 0x4A, 0xEA, 0x1A, 0xE9, 0x74,
+    0xAF, 0x1F, 0x75, 0x9F, 0x0A, 0xE9, 0x76, 0xF0, 0xEA, 0x77, 0xFF, 0x77, 0x0F, 0xEA, 0x77, 0x0A,
+    0xFD, 0x77, 0x19, 0xFC, 0x97, 0x71, 0x9F, 0xC7, 0x73, 0xF7, 0x77, 0x77, 0x0F, 0xFD, 0x4A, 0xA9,
+    0x4F, 0xFA, 0xAF, 0xFC, 0xA3, 0xAD, 0xA3, 0x9F, 0xF9, 0x0A, 0xFE, 0x94, 0xF4, 0xAF, 0xDA, 0x29,
+    0xFA, 0x5A, 0xF5, 0x9F, 0x49, 0xFA, 0x5F, 0xC5, 0xF9, 0x49, 0xFA, 0x4A, 0xFC, 0x49, 0xF6, 0xFC,
+    0x4F, 0xD4, 0xF9, 0x6F, 0xC3, 0xAF, 0xD4, 0xF7, 0xFC, 0x3F, 0xE3, 0xAE, 0x97, 0xFC, 0x2A, 0xFE,
+    0x3F, 0x70, 0xAF, 0x2E, 0x9F, 0x2A, 0xE9, 0x70, 0xAF, 0x19, 0xE0, 0xAE, 0x2F, 0x71, 0xAF, 0x1E,
+    0x90, 0xAE, 0x90, 0xAE, 0x97, 0x19, 0xF0, 0x9E, 0x1A, 0xE9, 0x0F, 0x72, 0x9F, 0x0E, 0x91, 0x9E,
+    0x9A, 0xE9, 0x73, 0xF9, 0xE2, 0x9E, 0xAE, 0xA7, 0x4F, 0xEA, 0x29, 0xFE, 0x75, 0xFE, 0x4F, 0xDA,
+    0x75, 0xFD, 0xA4, 0xFD, 0x76, 0xFD, 0x5F, 0xCA, 0x76, 0xAF, 0xA5, 0xFC, 0x77, 0xAF, 0x6F, 0xA7,
+    0x79, 0xEA, 0x6F, 0x77, 0x77, 0x75, 0x4A, 0xFF, 0xC2, 0xFF, 0xA4, 0xFF, 0xCA, 0x19, 0xFF, 0x94,
+    0xAF, 0xE9, 0x39, 0xFC, 0xA9, 0x7A, 0xFA, 0x5F, 0x97, 0x2F, 0xC4, 0xF9, 0x73, 0xAF, 0xA2, 0xAE,
+    0x97, 0x5F, 0xC1, 0xAE, 0xA7, 0x6A, 0xF9, 0x9E, 0xA7, 0x70, 0xFF, 0xA7, 0x71, 0xAF, 0xE7, 0x73,
+    0xFD, 0x77, 0x4F, 0xC9, 0x77, 0x3A, 0xFD, 0x77, 0x2A, 0xFE, 0x97, 0x70, 0x9E, 0xAF, 0xC7, 0x79,
+    0xEA, 0x0A, 0xF9, 0x75, 0x9F, 0x2F, 0xC7, 0x5F, 0x3F, 0xC9, 0x73, 0xF9, 0x39, 0xFC, 0x72, 0xF9,
+    0x5F, 0xC9, 0x7A, 0xFC, 0xA9, 0x39, 0xFD, 0xA9, 0x4F, 0xFC, 0x91, 0xFF, 0xD3, 0x9F, 0xFC, 0x19,
+    0xFF, 0xCA, 0x30, 0x0A, 0xFF, 0xC2, 0xFF, 0xA0, 0xFF, 0xCA, 0x19, 0xFF, 0xA0, 0xAF, 0xE9, 0x39,
+    0xFD, 0x93, 0xFC, 0x6A, 0xEA, 0x5A, 0xF5, 0x9F, 0x69, 0xF9, 0x4F, 0x70, 0xFC, 0x3A, 0xE9, 0x70,
+    0xAF, 0x29, 0xEA, 0x71, 0x9F, 0x91, 0xF7, 0x3F, 0xC0, 0xF7, 0x4A, 0xFA, 0xE9, 0x75, 0xFE, 0xA7,
+    0x6F, 0xE7, 0x79, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0xFC, 0x77,
+    0x1F, 0xC7, 0x70, 0x9F, 0xA7, 0x69, 0xAF, 0xDA, 0x97, 0x3A, 0xFF, 0xD7, 0x3F, 0xFD, 0xA7, 0x10,
+    0x39, 0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xEA, 0x99, 0x3A, 0xFC, 0x92, 0x9E,
+    0x59, 0xFC, 0xA3, 0x9E, 0x5F, 0xCA, 0x5D, 0x94, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F,
+    0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC,
+    0x94, 0x9A, 0x94, 0x9F, 0xCA, 0x5E, 0x4F, 0xCA, 0x59, 0xE3, 0xFD, 0x6F, 0x2A, 0xFC, 0x59, 0xAF,
+    0x19, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0xA7, 0x77, 0x69, 0xFD, 0xA6, 0xAF,
+    0xDA, 0x6F, 0xE7, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE,
+    0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA,
+    0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7,
+    0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0xCA, 0xA7, 0xFE, 0x69, 0xFE, 0x77, 0x50, 0x0A, 0xDA, 0x72,
+    0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0xAE, 0x97, 0x2E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72,
+    0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0xAE, 0x97, 0x2E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72,
+    0xAE, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0xAE, 0x97, 0x2E, 0xA7, 0x2F, 0x72, 0x9E, 0x97, 0x2F, 0x72,
+    0x99, 0x99, 0x00, 0x6A, 0xFD, 0xA6, 0xFE, 0x96, 0xFE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97,
+    0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA, 0x71,
+    0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x1A,
+    0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x6A, 0xAA, 0xF6, 0x9F, 0xE6,
+    0x9F, 0xDA, 0x77, 0x50, 0x77, 0x6F, 0x97, 0x3F, 0xA7, 0x2A, 0xFC, 0x72, 0xFD, 0xA7, 0x09, 0xEA,
+    0xE7, 0x0E, 0xA0, 0xE9, 0x7E, 0x90, 0xF6, 0xAE, 0x1A, 0xE6, 0xEA, 0x2E, 0xA4, 0x9E, 0x92, 0xF4,
+    0xF3, 0x9E, 0x92, 0x9E, 0xA4, 0xF2, 0xAE, 0x5F, 0x2F, 0x59, 0xEA, 0x0A, 0xEA, 0x6F, 0x77, 0x10,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x19, 0x4D, 0x3E, 0xA2, 0xF9, 0x1A, 0xF2, 0x9F, 0x29, 0xE9,
+    0x3D, 0x70, 0x79, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9,
+    0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A,
+    0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD,
+    0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19,
+    0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95, 0x59, 0x99, 0x73, 0xAF, 0xD7, 0x1F, 0xF7, 0x1A,
+    0xFE, 0x74, 0xAF, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x29, 0xAA, 0x6F, 0x19, 0xFC,
+    0x94, 0xF0, 0xAF, 0xE4, 0xEA, 0xAF, 0xF3, 0x9E, 0xAD, 0xA0, 0xAF, 0x92, 0xAF, 0xCA, 0x2F, 0x92,
+    0xFD, 0x3F, 0x92, 0xFC, 0x4F, 0x91, 0x9F, 0xA3, 0x9F, 0x29, 0xF4, 0xAF, 0x2A, 0xEA, 0x4F, 0xA2,
+    0xF9, 0x39, 0xF3, 0xF4, 0xAF, 0x29, 0xF3, 0x9F, 0x3F, 0xC9, 0x19, 0xFA, 0x3F, 0xFF, 0xA3, 0x9F,
+    0xFE, 0xA4, 0x9E, 0x9F, 0xD9, 0x74, 0x99, 0x70, 0x70, 0x9A, 0xA9, 0x70, 0xFE, 0x59, 0xFF, 0xA3,
+    0xAF, 0xFC, 0xA2, 0x9F, 0x91, 0xAD, 0x3F, 0x94, 0x92, 0xAF, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF,
+    0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFC, 0x5A, 0x2F, 0xC3, 0x9D, 0x91, 0xFD, 0xAA, 0xF9, 0x19, 0xFF,
+    0xE3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x76, 0x99, 0x97, 0x5A, 0xFD, 0x73, 0xAF, 0xE7,
+    0x3A, 0xFE, 0x76, 0xAF, 0x76, 0xFA, 0x76, 0xF9, 0x76, 0xF7, 0x19, 0xAA, 0x90, 0x9F, 0x79, 0xFD,
+    0xAE, 0xA6, 0xAF, 0xFE, 0x95, 0xAF, 0xCA, 0xFD, 0x59, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xEA, 0x4A,
+    0xF4, 0xF9, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3,
+    0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x5F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1,
+    0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95,
+    0x70, 0x9A, 0xA9, 0x79, 0xFE, 0x5A, 0xFF, 0xA3, 0xAE, 0xA9, 0xAF, 0x29, 0xE9, 0x2F, 0x2E, 0xA2,
+    0x9E, 0xA1, 0xAE, 0x3F, 0x2E, 0xA2, 0xAE, 0x91, 0x9E, 0x90, 0x9F, 0x92, 0xAE, 0xAF, 0xC9, 0x3F,
+    0xFA, 0x5F, 0xD9, 0x7F, 0x95, 0xA9, 0x1F, 0x93, 0x9E, 0x1F, 0xC9, 0x99, 0xFA, 0x19, 0xFF, 0xE3,
+    0xFF, 0xCA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x77, 0x0A, 0xAC, 0xAA, 0x77, 0x0A, 0xFE, 0x97, 0x5F,
+    0xFD, 0x74, 0xAE, 0xA9, 0xAE, 0xA7, 0x4F, 0x29, 0xD7, 0x4A, 0xEA, 0x77, 0x2F, 0x97, 0x71, 0x9F,
+    0x77, 0x2A, 0xF7, 0x79, 0xAF, 0xFD, 0x97, 0x1A, 0xFF, 0xF7, 0x2F, 0xFF, 0xA7, 0x59, 0xF7, 0x72,
+    0xAF, 0x77, 0x2F, 0xA7, 0x72, 0xF9, 0x77, 0x19, 0xF9, 0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77, 0x2F,
+    0xA7, 0x72, 0xF9, 0x77, 0x19, 0xF9, 0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77, 0x2F, 0xA7, 0x72, 0xF9,
+    0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77, 0x2F, 0xA7, 0x4D, 0x29, 0xF7, 0x4A, 0xEA, 0xAF, 0xA7, 0x4F,
+    0xFC, 0xA7, 0x5A, 0xFE, 0xA7, 0x79, 0xAD, 0xA9, 0x77, 0x00, 0x72, 0x9A, 0xAA, 0x99, 0x76, 0xFF,
+    0xFC, 0x96, 0x9F, 0xFF, 0xD6, 0x9F, 0xA1, 0xAE, 0xAA, 0xA9, 0x6F, 0xA2, 0x9F, 0x71, 0xF4, 0xF7,
+    0x09, 0xF3, 0x9F, 0x70, 0x9E, 0xA3, 0xFA, 0x71, 0xF2, 0x9F, 0x72, 0xFA, 0x9A, 0xF9, 0x73, 0xFF,
+    0xC7, 0x6A, 0xFA, 0x97, 0x6A, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x1F, 0xC9, 0x77, 0x0A, 0xFD, 0xA7,
+    0x49, 0xFF, 0xDA, 0x70, 0x9F, 0xCA, 0xFF, 0x95, 0x9F, 0x93, 0xAF, 0xD5, 0xF7, 0xFC, 0x94, 0xF7,
+    0x0F, 0x5F, 0x96, 0xAF, 0x5F, 0xCA, 0x91, 0x99, 0xFC, 0x95, 0x9F, 0xFF, 0xD9, 0x70, 0xFF, 0xEA,
+    0x74, 0x9A, 0xEA, 0xA9, 0x71, 0x59, 0x99, 0x74, 0xAF, 0xD7, 0x2A, 0xFE, 0x97, 0x1A, 0xFE, 0x75,
+    0xAF, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75, 0xAF, 0x3A, 0xA9, 0x6F, 0x91, 0xFD, 0x5F, 0x09,
+    0xFE, 0x5F, 0x9F, 0xF9, 0x39, 0xEA, 0xE9, 0x0F, 0x93, 0xAF, 0xD2, 0xF4, 0xFD, 0x29, 0xF4, 0xFC,
+    0x92, 0xAE, 0xA3, 0x9F, 0xC3, 0xF9, 0x3A, 0xF9, 0x3F, 0x4F, 0xC3, 0x9F, 0x4F, 0xA3, 0xAE, 0xA3,
+    0x9F, 0x93, 0xF9, 0x39, 0xF4, 0xF1, 0xA9, 0x0A, 0xF3, 0x9F, 0xAE, 0x0F, 0xA3, 0xAF, 0xEA, 0x0F,
+    0x93, 0x9F, 0xDA, 0x09, 0xF5, 0xFC, 0x97, 0x59, 0x94, 0x76, 0x9E, 0x94, 0xFC, 0x3A, 0xFC, 0x3A,
+    0xF9, 0x39, 0xEA, 0x77, 0x70, 0x9A, 0xA3, 0xAF, 0xD1, 0xAF, 0xE1, 0xAA, 0xAF, 0xA4, 0xAE, 0x94,
+    0xF4, 0x9F, 0x4A, 0xEA, 0x4F, 0x94, 0xF4, 0x9F, 0x4F, 0xA4, 0xF9, 0x39, 0xF1, 0xA9, 0x09, 0xFA,
+    0xDA, 0x0A, 0xFE, 0x90, 0xAF, 0xDA, 0x2F, 0xA9, 0x49, 0x95, 0x77, 0x77, 0x0A, 0xE7, 0x5A, 0xF9,
+    0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5A, 0xE7, 0x77, 0x77, 0x73, 0x99, 0xA9, 0x73, 0x9F, 0xD9, 0x72,
+    0xFE, 0x97, 0x2A, 0xAF, 0xC9, 0x74, 0x9F, 0x75, 0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x75, 0xF9, 0x74,
+    0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x75,
+    0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x93, 0x9F, 0x7D, 0xA1, 0x9F, 0xA6, 0x9F, 0xFD, 0x79, 0xFF, 0xC7,
+    0x1F, 0xEA, 0x73, 0x9A, 0xAA, 0x97, 0x30, 0x59, 0x99, 0x72, 0xAF, 0xD7, 0x0A, 0xFE, 0x97, 0xAF,
+    0xE7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA2, 0x9A, 0x95, 0xF1, 0x9F, 0xC4,
+    0xF0, 0xAF, 0xDA, 0x3E, 0x9E, 0xAA, 0xF2, 0x9E, 0xAC, 0xA2, 0xEA, 0x2A, 0xFA, 0x3E, 0xA2, 0xFC,
+    0x3A, 0xE3, 0xF9, 0x29, 0xE9, 0x29, 0xF2, 0xAE, 0x93, 0xAF, 0xAF, 0xC5, 0xFF, 0xA7, 0xFA, 0xEA,
+    0x69, 0xF0, 0xF9, 0x59, 0xF0, 0x9F, 0x94, 0xAE, 0xA1, 0xAF, 0xA3, 0xF9, 0x2F, 0xEA, 0x0F, 0x93,
+    0xFD, 0x99, 0xF5, 0xFA, 0x75, 0x92, 0x49, 0x99, 0x3A, 0xFD, 0x1A, 0xFE, 0x1A, 0xFE, 0x4A, 0xEA,
+    0x4F, 0xA4, 0xF9, 0x39, 0xF4, 0xAF, 0x4F, 0xA4, 0xF9, 0x39, 0xF4, 0xAF, 0x4A, 0xEA, 0x4F, 0x94,
+    0xF4, 0x9F, 0x4A, 0xF4, 0xFA, 0x4F, 0x93, 0x9F, 0x4A, 0xF1, 0xC1, 0xAF, 0xAD, 0x90, 0xFF, 0x1F,
+    0xE9, 0x19, 0xFA, 0x59, 0x95, 0x29, 0x9A, 0x94, 0x9A, 0x95, 0x9A, 0x93, 0xAF, 0xC9, 0x19, 0xFC,
+    0x2A, 0xFC, 0x1F, 0xEA, 0x0A, 0xFD, 0x1F, 0xE9, 0x0A, 0xAA, 0xF9, 0xAF, 0xE9, 0xFF, 0xA3, 0xAE,
+    0xAD, 0xA0, 0xFA, 0xD9, 0x0F, 0xA3, 0xFD, 0x91, 0xFD, 0x91, 0xF9, 0x3F, 0xCA, 0x2F, 0xC9, 0x19,
+    0xF3, 0x9F, 0xC2, 0x9F, 0xC2, 0x9F, 0x3A, 0xF9, 0x2A, 0xF9, 0x2F, 0xA3, 0xFC, 0x3F, 0xC3, 0xF9,
+    0x3F, 0xA3, 0xF9, 0x29, 0xF3, 0x9F, 0x39, 0xF3, 0xAF, 0x39, 0xF3, 0xAF, 0x3F, 0x93, 0xAE, 0xA3,
+    0xFA, 0x3F, 0x90, 0xAA, 0x0F, 0x93, 0xF9, 0x3F, 0xAE, 0x0F, 0x92, 0x9F, 0x39, 0xFE, 0xA9, 0xF3,
+    0x9F, 0x39, 0xFE, 0x0A, 0xEA, 0x3A, 0xE9, 0x4F, 0xC9, 0x77, 0x69, 0x40, 0x39, 0xA9, 0x49, 0xAA,
+    0x93, 0xAF, 0xCA, 0x19, 0xFC, 0x91, 0xFE, 0xA0, 0xAF, 0xE1, 0xAA, 0xAF, 0xAA, 0xFF, 0x4A, 0xEA,
+    0xDA, 0x0A, 0xF4, 0xFD, 0xA1, 0x9F, 0x4F, 0xD2, 0xAE, 0xA3, 0x9F, 0xC3, 0xF9, 0x3A, 0xFA, 0x3F,
+    0x4F, 0xC3, 0x9F, 0x4F, 0xA3, 0xAE, 0xA3, 0x9F, 0x93, 0xF9, 0x39, 0xF3, 0x9F, 0x4A, 0xF3, 0x9F,
+    0x1C, 0x1F, 0xA3, 0xAF, 0xAD, 0x90, 0xF9, 0x3F, 0xF0, 0x9F, 0x4A, 0xFD, 0x90, 0xAE, 0xA4, 0x9F,
+    0xA7, 0x69, 0x94, 0x70, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6A, 0xFF, 0xD4, 0xFD, 0xAF, 0xC9, 0x2A,
+    0xF2, 0x9F, 0xA1, 0x9F, 0x4F, 0xC1, 0xFA, 0x4A, 0xF1, 0xF9, 0x4A, 0xF0, 0xAF, 0x5A, 0xF0, 0xFC,
+    0x5F, 0xA0, 0xFA, 0x5F, 0x90, 0xFA, 0x49, 0xF1, 0xFA, 0x4F, 0xA1, 0xFC, 0x3A, 0xF2, 0xAF, 0x91,
+    0xAF, 0x92, 0x9F, 0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x73, 0x99, 0x70, 0x69, 0x9A, 0x93,
+    0x9A, 0xA9, 0x59, 0xFD, 0x91, 0xFD, 0x4F, 0xE9, 0x0F, 0xE9, 0x3A, 0xAA, 0xF9, 0xFF, 0xA6, 0xFE,
+    0x90, 0xFC, 0x6F, 0xD2, 0xAF, 0x59, 0xFC, 0x92, 0xAF, 0x59, 0xFA, 0x3F, 0xC5, 0xAF, 0x4F, 0xA5,
+    0xFA, 0x4F, 0x95, 0xF4, 0x9F, 0x59, 0xF4, 0xFA, 0x5A, 0xEA, 0x39, 0xF9, 0x5F, 0x93, 0xFA, 0x6F,
+    0xA2, 0xFC, 0x69, 0xFF, 0xF7, 0xAF, 0xFE, 0x70, 0xFF, 0xDA, 0x71, 0xF9, 0x19, 0x97, 0x3F, 0x77,
+    0x9F, 0x77, 0xAF, 0x77, 0xFC, 0x97, 0x4A, 0xFF, 0xC7, 0x2F, 0xFD, 0x72, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x71, 0x79, 0xAA, 0x92, 0x99, 0x96, 0x9F, 0xD0, 0xF5, 0xAF, 0xFE, 0xA4, 0xAF, 0xCA, 0xFD,
+    0x93, 0x9F, 0xA2, 0xAF, 0x4F, 0xA3, 0xAE, 0xA3, 0xAF, 0x4F, 0x93, 0xFA, 0x4F, 0x39, 0xF4, 0xAF,
+    0x3A, 0xF4, 0xFA, 0x3F, 0xA3, 0x9F, 0xA3, 0xFA, 0x3F, 0xC9, 0x3F, 0xA2, 0xAF, 0xC4, 0xFA, 0x1A,
+    0xDA, 0xE4, 0xFC, 0x9A, 0xD9, 0xEA, 0x4F, 0xFA, 0x0E, 0xA4, 0x9F, 0xDA, 0x09, 0xE9, 0x5A, 0xF9,
+    0x1A, 0xE9, 0x79, 0x93, 0xF7, 0x6F, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0xA7, 0x2A, 0xFF, 0xA7,
+    0x0F, 0xFC, 0xA7, 0x09, 0x99, 0x99, 0x99, 0x99, 0x30, 0x39, 0xA9, 0x39, 0xAA, 0x2A, 0xFC, 0xA1,
+    0xAF, 0x0F, 0xEA, 0x0A, 0xFC, 0x0A, 0xAA, 0xFA, 0x9F, 0xD3, 0x9E, 0x9F, 0xDA, 0x3A, 0xEA, 0xD9,
+    0x19, 0x4F, 0xD9, 0x70, 0xFC, 0xA7, 0x09, 0xFC, 0x71, 0xAF, 0xA7, 0x1F, 0xC7, 0x2F, 0xA7, 0x19,
+    0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x79, 0x9A, 0xA9, 0x79,
+    0xFE, 0x94, 0xFF, 0xCA, 0x3A, 0xEA, 0xAA, 0xEA, 0x29, 0xF3, 0xAC, 0x3A, 0xF7, 0x19, 0xFC, 0x71,
+    0xFD, 0x97, 0x9F, 0xD9, 0x79, 0xFD, 0x97, 0x0F, 0xD7, 0x1F, 0xCA, 0x2D, 0x4F, 0xA1, 0xAE, 0x3A,
+    0xEA, 0x1F, 0xC2, 0xF2, 0xFF, 0xEA, 0x29, 0xFF, 0xCA, 0x5A, 0xFD, 0x97, 0x19, 0x96, 0x69, 0xAA,
+    0x72, 0xAE, 0x71, 0x9F, 0x71, 0xFA, 0x71, 0xFA, 0x69, 0xAF, 0xFD, 0x1A, 0xFF, 0xEA, 0x1F, 0xFF,
+    0x5F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7,
+    0x1A, 0xF3, 0x99, 0x3F, 0xC2, 0xAD, 0x3F, 0xCA, 0xAF, 0x3F, 0xFD, 0x93, 0xAF, 0xF9, 0x5F, 0xD9,
+    0x71, 0x99, 0x70, 0x39, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2,
+    0xAA, 0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF,
+    0x5F, 0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD,
+    0x49, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F,
+    0xE2, 0xFD, 0x92, 0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x29, 0x9A, 0x59, 0xAA, 0x2A, 0xFC,
+    0x3F, 0xC9, 0x9F, 0xDA, 0x29, 0xFA, 0x9F, 0xE3, 0xFC, 0x29, 0xF3, 0xAE, 0xA3, 0xF9, 0x2A, 0xEA,
+    0x3F, 0x92, 0xF4, 0xAE, 0xA2, 0xF4, 0xAE, 0xA1, 0x9E, 0x94, 0x9F, 0x1F, 0x6F, 0x09, 0xE9, 0x6F,
+    0x0E, 0xA7, 0xFA, 0xE7, 0x0F, 0xE9, 0x70, 0xFD, 0x97, 0x1F, 0xCA, 0x72, 0xFA, 0x73, 0xAD, 0xA7,
+    0x77, 0x00, 0x29, 0x99, 0x5A, 0xA9, 0x49, 0xAA, 0x2A, 0xFC, 0x3F, 0x92, 0xFC, 0x09, 0xFD, 0x92,
+    0xAF, 0x29, 0xF9, 0x9A, 0xFD, 0x3F, 0x3F, 0x92, 0x9F, 0x3F, 0x92, 0xAE, 0x93, 0xF9, 0x2F, 0xA2,
+    0xAE, 0x4F, 0x92, 0xFA, 0x2F, 0x4A, 0xEA, 0x19, 0xFC, 0x2E, 0xA4, 0x9E, 0xA1, 0xAF, 0xC1, 0x9E,
+    0x6E, 0xA1, 0xFD, 0x1A, 0xE6, 0xF0, 0x9F, 0xD1, 0xE9, 0x6F, 0x0E, 0xAE, 0x0A, 0xE7, 0xFA, 0xD9,
+    0x9E, 0x9E, 0x70, 0xFE, 0x09, 0xFD, 0xA7, 0x0A, 0xFC, 0x19, 0xFD, 0x71, 0xAF, 0x91, 0x9F, 0xC7,
+    0x2A, 0xE9, 0x29, 0xF7, 0x39, 0xD9, 0x4E, 0x77, 0x77, 0x00, 0x59, 0xA9, 0x69, 0xA9, 0x5F, 0xC9,
+    0x39, 0xFC, 0x3F, 0xE2, 0x9F, 0xD2, 0x9F, 0xE9, 0x1F, 0xDA, 0x6F, 0xA0, 0xAE, 0x09, 0xA7, 0x9F,
+    0x9E, 0x74, 0xFE, 0x75, 0x9F, 0xC9, 0x76, 0xFA, 0x77, 0xFC, 0x76, 0x9F, 0xC7, 0x6F, 0xDA, 0x74,
+    0xFF, 0x73, 0xAE, 0x0F, 0xA6, 0xDA, 0xF1, 0xAF, 0x09, 0xAA, 0x19, 0xFD, 0x91, 0x9F, 0xF1, 0x9F,
+    0xCA, 0x3F, 0xE9, 0x2F, 0xA4, 0x9F, 0xA9, 0x49, 0x97, 0x09, 0x60, 0x79, 0x9A, 0x59, 0xAA, 0x7A,
+    0xFC, 0x3F, 0xC9, 0x49, 0xFD, 0xA2, 0x9F, 0xA4, 0x9A, 0xFD, 0x3F, 0xC7, 0x9F, 0x3A, 0xEA, 0x70,
+    0xF9, 0x2A, 0xEA, 0x70, 0xF9, 0x2F, 0x97, 0x0A, 0xEA, 0x2F, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x2F,
+    0x1A, 0xE7, 0x3F, 0x1E, 0xA7, 0x3F, 0x09, 0xE7, 0x4F, 0x0E, 0xA7, 0x4F, 0x9E, 0x75, 0xAF, 0xD9,
+    0x75, 0xAF, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xC7, 0x70, 0xF9, 0x77, 0xAE, 0x97, 0x79, 0xE9, 0x71,
+    0xD9, 0x19, 0xAE, 0x97, 0x19, 0xFF, 0xC9, 0x72, 0xAF, 0xF9, 0x74, 0xFD, 0xA7, 0x7A, 0xCA, 0xA7,
+    0x70, 0x49, 0x99, 0x49, 0xAA, 0x4F, 0xD9, 0x1F, 0x2F, 0xFC, 0xAF, 0x2F, 0xFF, 0xC9, 0x19, 0xEA,
+    0x9A, 0xFD, 0x92, 0x9E, 0x3A, 0xE9, 0x4D, 0x92, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0x9E, 0xA7, 0x29,
+    0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0x9F, 0x4C, 0xA3, 0x9F, 0x4A, 0xD9, 0x2F, 0xEA, 0xAA,
+    0xEA, 0x1F, 0xFF, 0xDA, 0x09, 0xFA, 0xFF, 0xC2, 0xAD, 0x91, 0xAF, 0xD9, 0x74, 0x94, 0x77, 0x69,
+    0xFC, 0x7F, 0xE6, 0xAF, 0xDA, 0x6F, 0x71, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x19, 0xE9, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xF7, 0x09, 0xF9, 0x79, 0xF9, 0x70, 0xAF, 0x72,
+    0xAE, 0xA7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xF7, 0x2E, 0x97, 0x1A, 0xE7, 0x2E,
+    0xA7, 0x2E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xFA, 0xAA, 0x7F, 0xE7, 0x9F, 0xD7, 0x19,
+    0x99, 0x97, 0x77, 0x1E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA6, 0xE9, 0x59, 0xE9, 0x5A, 0xE6,
+    0xF6, 0xEA, 0x59, 0xE9, 0x59, 0xE6, 0xAE, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6A, 0xE6, 0xF6,
+    0xEA, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA5, 0x77,
+    0x5F, 0xCA, 0x79, 0xFD, 0xA6, 0xAF, 0xE7, 0x2F, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xEA, 0x72, 0xE9,
+    0x71, 0xAE, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2F, 0x97, 0x19,
+    0xF9, 0x70, 0x9F, 0x70, 0x9F, 0xA7, 0x0F, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xF7, 0x2F,
+    0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xF6, 0xAA, 0xAF, 0xA6, 0xFE, 0x69, 0xFC, 0xA7, 0x09,
+    0x99, 0x97, 0x10, 0x77, 0x3F, 0x94, 0xAC, 0x91, 0x9F, 0xE3, 0xE1, 0xFF, 0xCA, 0x9F, 0x0A, 0xEA,
+    0x9F, 0xFC, 0xA0, 0x9D, 0xA2, 0x9F, 0xE2, 0x9C, 0x5A, 0xEA, 0x77, 0x30, 0x69, 0xA9, 0x6A, 0xE9,
+    0x49, 0xF9, 0x4A, 0xF9, 0x49, 0xEA, 0x69, 0x99, 0x77, 0x39, 0xA7, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E,
+    0xA6, 0xE9, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xF5, 0x9F, 0x5A, 0xEA, 0x5F, 0xA4, 0x9F, 0x94, 0xAF,
+    0x5F, 0xC4, 0x9F, 0x94, 0xFC, 0x5A, 0xAA, 0x95, 0x74, 0x97, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9,
+    0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x29, 0xAF, 0xCA, 0x6A, 0xFF, 0xD4, 0xFF, 0xF9, 0x2F, 0xCA,
+    0xDA, 0xAE, 0x91, 0xFC, 0x09, 0xD2, 0xAA, 0x1A, 0xF1, 0xAD, 0x6F, 0x91, 0xDA, 0x59, 0xF2, 0xD9,
+    0x5A, 0xEA, 0x2D, 0x6F, 0x91, 0x9D, 0x6F, 0x91, 0xAD, 0x6F, 0xA1, 0xDA, 0x6F, 0xC1, 0xD9, 0x2A,
+    0xC1, 0xAF, 0x99, 0xD2, 0xAD, 0x91, 0xFF, 0x9A, 0xF2, 0x9F, 0xFE, 0xA4, 0x9F, 0xFC, 0x97, 0xAF,
+    0xA9, 0x72, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x77,
+    0x20, 0x74, 0x9A, 0xEA, 0x97, 0x5F, 0xF9, 0x72, 0x9F, 0xFD, 0x72, 0xFA, 0x99, 0xF9, 0x70, 0xF9,
+    0x2A, 0xE9, 0x79, 0xEA, 0x39, 0xE7, 0x0F, 0x93, 0xAD, 0x71, 0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xF9,
+    0x75, 0x99, 0x9F, 0x99, 0x99, 0x9A, 0x7A, 0xFF, 0xFC, 0x7F, 0xFF, 0xCA, 0x79, 0x99, 0xFA, 0x99,
+    0x99, 0x97, 0x29, 0xF7, 0x70, 0xAF, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x70, 0x9E, 0xA7, 0x5D, 0xAF,
+    0xA9, 0x99, 0x9A, 0xAA, 0xE9, 0x19, 0xFF, 0xFF, 0xD2, 0x9F, 0xFF, 0xFD, 0x29, 0xFA, 0x29, 0xAF,
+    0xE4, 0xAA, 0x97, 0x71, 0x29, 0xA7, 0x4A, 0x39, 0xDA, 0x29, 0xAA, 0xA9, 0x19, 0xDA, 0x29, 0xEA,
+    0xAF, 0xEA, 0xEA, 0x39, 0xFF, 0xFD, 0x95, 0x9F, 0xA9, 0x9F, 0xC7, 0xAE, 0x4F, 0x7E, 0x94, 0xAE,
+    0x69, 0xE5, 0xAE, 0x69, 0xE5, 0xEA, 0x69, 0xE4, 0x9E, 0x79, 0xE9, 0x29, 0xEA, 0x69, 0xFC, 0xAA,
+    0xFC, 0xA5, 0xAF, 0xFF, 0xDA, 0x3A, 0xE9, 0x9F, 0xDA, 0x9F, 0x3D, 0x49, 0x94, 0xD7, 0x77, 0x00,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFC, 0x91, 0xFF, 0xC0,
+    0x9F, 0xFA, 0x2F, 0xF9, 0x2F, 0xCA, 0x59, 0xF9, 0x49, 0xFA, 0x5F, 0x96, 0xFC, 0x4A, 0xEA, 0x79,
+    0xF9, 0x29, 0xEA, 0x71, 0xFA, 0x2F, 0x72, 0xAF, 0x1A, 0xE7, 0x19, 0x09, 0xF0, 0x9E, 0xA0, 0x96,
+    0x9F, 0xEA, 0xFE, 0x95, 0x9F, 0xFF, 0xE7, 0x3F, 0xD7, 0x49, 0x91, 0xAF, 0x90, 0x99, 0x97, 0x0F,
+    0xFF, 0xD7, 0x0F, 0xFF, 0xD7, 0x4F, 0x97, 0x71, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xF7, 0x79, 0xFE,
+    0xA7, 0x4F, 0xFD, 0xA7, 0x29, 0xFF, 0xD7, 0x20, 0x77, 0x1E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E,
+    0xA6, 0xE9, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x59, 0xE9, 0x69, 0x99, 0x77, 0x77, 0x77, 0x74,
+    0x9A, 0xAA, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA6, 0xEA, 0x59, 0xE9, 0x5A, 0xE6,
+    0xF6, 0xEA, 0x50, 0x70, 0x99, 0xAA, 0x97, 0x19, 0xFE, 0x96, 0xFF, 0xD5, 0xEA, 0x19, 0xF4, 0xF3,
+    0x9E, 0x3A, 0xF4, 0xD9, 0x3F, 0xC9, 0x71, 0xAC, 0xA9, 0xE7, 0x1D, 0xA0, 0xF9, 0x7D, 0xA1, 0xFA,
+    0x6E, 0x2F, 0xA5, 0xAD, 0x92, 0xAF, 0x49, 0xE9, 0x29, 0xEA, 0x4F, 0x92, 0x9E, 0x5F, 0xA2, 0xAD,
+    0x95, 0xFC, 0x2D, 0xA6, 0xAF, 0x1D, 0xA7, 0xAE, 0xA0, 0xDA, 0x70, 0x9E, 0x0D, 0x93, 0x94, 0xAF,
+    0xC2, 0x9D, 0x94, 0xFA, 0x2E, 0xA4, 0xF3, 0xF9, 0x2F, 0x93, 0xFF, 0xE9, 0x5F, 0xFC, 0x70, 0x9A,
+    0xEA, 0x96, 0x75, 0xE2, 0xAD, 0x90, 0xF9, 0x0A, 0xEA, 0x0F, 0x1F, 0xA0, 0xE9, 0x1A, 0xDA, 0x29,
+    0x49, 0x20, 0x77, 0x77, 0x09, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAA, 0xF9, 0x71, 0xEA, 0x7A, 0xDA,
+    0x7E, 0x73, 0xDA, 0x5D, 0xA7, 0x5D, 0xA3, 0x9D, 0x4A, 0xFC, 0xA3, 0xD3, 0xD9, 0x3F, 0xF3, 0xAC,
+    0xA1, 0x9D, 0x3E, 0xA1, 0xAD, 0x4D, 0x1A, 0xC9, 0x2A, 0xDA, 0x29, 0xD4, 0xAC, 0x90, 0xD3, 0xE4,
+    0x95, 0x9C, 0xA0, 0xD3, 0xE7, 0x39, 0xCA, 0x0D, 0x29, 0xE7, 0x39, 0xD0, 0xD2, 0x9E, 0x73, 0x9C,
+    0xA0, 0xD2, 0x9E, 0x97, 0x29, 0xCA, 0x0A, 0xC9, 0x2F, 0x72, 0xAC, 0x90, 0x9C, 0xA2, 0xAF, 0xA9,
+    0x9A, 0xC9, 0x3D, 0x2D, 0x3F, 0xFC, 0x39, 0xD2, 0xAC, 0xA3, 0xAF, 0xD9, 0x3D, 0x93, 0xD9, 0x59,
+    0x6A, 0xD5, 0xD9, 0x73, 0xAD, 0x69, 0xDA, 0x70, 0x9E, 0x71, 0xFA, 0x99, 0x99, 0xAE, 0xA7, 0x39,
+    0xFF, 0xCA, 0x77, 0x09, 0x9A, 0xA9, 0x97, 0x00, 0x59, 0x97, 0x19, 0xFA, 0xE3, 0x9F, 0xF9, 0x3E,
+    0x90, 0x9E, 0x3E, 0x92, 0xDA, 0x3E, 0x2A, 0xD9, 0x29, 0xD9, 0x2E, 0x3A, 0xD9, 0x1A, 0xDA, 0x3A,
+    0xD9, 0x09, 0xEA, 0x0A, 0x1A, 0xFF, 0xAD, 0x19, 0xFC, 0x9F, 0xA2, 0xAD, 0xA1, 0xAD, 0xA7, 0x77,
+    0x09, 0xAA, 0x2A, 0xFF, 0xD2, 0xFF, 0xD9, 0x29, 0x99, 0x99, 0x99, 0x94, 0x6A, 0x95, 0xAA, 0x69,
+    0xE9, 0x29, 0xEA, 0x4A, 0xF2, 0x9F, 0x4F, 0xC2, 0xAF, 0x39, 0xFA, 0x2F, 0xC3, 0x9F, 0xA2, 0xFC,
+    0x4A, 0xF2, 0x9F, 0x94, 0xAF, 0x91, 0x9F, 0xA5, 0xFC, 0x2A, 0xF6, 0xF9, 0x2F, 0xA5, 0x9F, 0x3F,
+    0x96, 0xEA, 0x3F, 0x7A, 0xA5, 0xAA, 0x30, 0x76, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xA7,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xAA, 0x90, 0x09, 0x99, 0x99, 0x99, 0x91,
+    0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x90, 0x69, 0x99, 0x99,
+    0x73, 0xAF, 0xEA, 0x70, 0xDA, 0x93, 0xAD, 0x95, 0xD9, 0x7D, 0x4A, 0xC0, 0x9A, 0xAA, 0xAA, 0x92,
+    0xD2, 0x9C, 0xA0, 0x9E, 0xAD, 0xA1, 0x9C, 0x91, 0xAC, 0x29, 0xD0, 0x9D, 0x2D, 0x1D, 0x29, 0xD0,
+    0x9D, 0x2A, 0xC1, 0xD2, 0x9D, 0x9D, 0x92, 0xAC, 0x1C, 0xA2, 0x9F, 0x93, 0xAC, 0x1D, 0x29, 0xD9,
+    0xD3, 0xAC, 0x1A, 0xC2, 0x9D, 0x0E, 0x2D, 0x19, 0xC9, 0x09, 0xEA, 0x0E, 0x09, 0xCA, 0x2D, 0x19,
+    0x99, 0x91, 0x99, 0x0D, 0x4D, 0x70, 0xAC, 0x94, 0x9D, 0x94, 0x9D, 0x97, 0xAF, 0xF9, 0x72, 0x9A,
+    0xAA, 0xA6, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD9, 0x0F, 0xFD, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x39, 0xAD, 0xA9, 0x5F, 0xF3, 0xFF, 0xD1, 0xAE, 0xA9, 0x9F, 0x90, 0xEA, 0x3E, 0xA0,
+    0xE4, 0xEA, 0x0E, 0x93, 0xEA, 0x0E, 0xA3, 0xE9, 0x0A, 0xEA, 0x9A, 0xF2, 0xFF, 0xC9, 0x29, 0xFE,
+    0x95, 0x9A, 0xAA, 0x93, 0x59, 0x99, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE,
+    0x5A, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0xAE, 0x99,
+    0x99, 0x95, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x73, 0x99, 0x97, 0x74, 0xFF,
+    0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xA7, 0x60, 0x77, 0x29, 0xFC, 0x95, 0xAF, 0xEA, 0x3A, 0xEA,
+    0xAF, 0x3E, 0x29, 0xE9, 0x2D, 0x39, 0xE7, 0x1F, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xF7, 0x9E, 0xA7,
+    0x9E, 0x97, 0xAE, 0x70, 0xFF, 0xE9, 0x1F, 0xFE, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x10, 0x77,
+    0x0A, 0xF9, 0x3A, 0xFE, 0x92, 0xEA, 0x9F, 0x19, 0xD2, 0x9E, 0x29, 0x3A, 0xDA, 0x6A, 0xE4, 0x9A,
+    0xF4, 0x9F, 0xD4, 0x9C, 0xAA, 0xF7, 0x9E, 0x79, 0xE6, 0x9E, 0xA1, 0x99, 0x9A, 0xFC, 0x1A, 0xFE,
+    0xA2, 0x9F, 0xCA, 0x77, 0x00, 0x71, 0x9C, 0x4E, 0x2A, 0xE9, 0x09, 0xF1, 0xF1, 0xAE, 0x91, 0xE3,
+    0x9C, 0x73, 0x69, 0x99, 0x95, 0x99, 0xA7, 0xF9, 0x3A, 0xF6, 0x9F, 0x4F, 0xA6, 0xAF, 0x4F, 0x96,
+    0xFA, 0x39, 0xF7, 0xF9, 0x3A, 0xF7, 0xF4, 0xAE, 0xA6, 0x9F, 0x4F, 0x96, 0x9E, 0xA4, 0xF7, 0xAE,
+    0xA3, 0x9F, 0x7F, 0x93, 0xAF, 0x7F, 0x93, 0xFA, 0x7F, 0x92, 0xAF, 0xA6, 0x9F, 0x91, 0x9F, 0xCA,
+    0x29, 0x2A, 0xFC, 0xAA, 0xEA, 0xEA, 0xAD, 0x2A, 0xFF, 0xC9, 0x9F, 0xDA, 0x2F, 0xFC, 0xA1, 0xFD,
+    0x3E, 0x9F, 0x92, 0x9E, 0xA3, 0x9E, 0x19, 0x96, 0x95, 0xAE, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x09,
+    0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xF7, 0x71, 0xCA, 0xA7, 0x71, 0x71, 0x99, 0xAF, 0xF9, 0x79, 0xFF,
+    0xF9, 0x6F, 0xFF, 0xA9, 0x6F, 0xF0, 0x9D, 0x97, 0xFF, 0xC0, 0xAD, 0x7A, 0xFF, 0xC0, 0xAD, 0x7F,
+    0xFC, 0xA0, 0xDA, 0x7F, 0xFC, 0x90, 0xDA, 0x69, 0xFF, 0xC0, 0x9D, 0x96, 0x9F, 0xFC, 0x0A, 0xD7,
+    0x9F, 0xFA, 0x0A, 0xD7, 0x0F, 0xF9, 0x0E, 0x70, 0xFF, 0x90, 0xDA, 0x70, 0x9F, 0xE0, 0x9D, 0x97,
+    0x2A, 0xC9, 0xE0, 0x9D, 0x76, 0xDA, 0x0A, 0xD7, 0x6D, 0x90, 0xE7, 0x59, 0xD1, 0xDA, 0x75, 0xAD,
+    0x09, 0xD9, 0x75, 0xE0, 0x9D, 0x76, 0xDA, 0x0E, 0x75, 0x9D, 0x1D, 0xA7, 0x5E, 0x0E, 0x75, 0x9D,
+    0xAE, 0x97, 0x9A, 0x3F, 0xD9, 0x70, 0xEA, 0xAF, 0xCA, 0x72, 0x9F, 0xD9, 0x76, 0x9A, 0xAA, 0x97,
+    0x70, 0x1A, 0xD1, 0xFA, 0x9F, 0xAA, 0xF9, 0x0E, 0xA6, 0x39, 0x94, 0xF9, 0x19, 0xAE, 0xA3, 0x9D,
+    0xA3, 0xE3, 0xE9, 0x1A, 0xE9, 0x29, 0xA9, 0x30, 0x77, 0x0A, 0xDA, 0x3A, 0xFD, 0x29, 0xFD, 0xA3,
+    0x99, 0xAE, 0x95, 0x9E, 0x6A, 0xE6, 0xEA, 0x6E, 0xA6, 0xE9, 0x59, 0xE6, 0xAE, 0x6E, 0xA4, 0x9A,
+    0xFA, 0x91, 0xAF, 0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x79, 0x97, 0x9F, 0xCA, 0x4A, 0xFE,
+    0x92, 0xAE, 0x19, 0xE2, 0xE2, 0x9E, 0x1A, 0xDA, 0x29, 0xE1, 0xE9, 0x2A, 0xDA, 0x1E, 0x3E, 0x91,
+    0xE2, 0xAE, 0x2E, 0xA0, 0xAE, 0x39, 0xFE, 0x94, 0x9F, 0xA7, 0x77, 0x09, 0x9A, 0x29, 0xFF, 0xC9,
+    0x1F, 0xFC, 0xA2, 0x99, 0x99, 0x99, 0x94, 0x3A, 0x95, 0x9A, 0x7F, 0x3A, 0xE6, 0x9F, 0x3F, 0x6F,
+    0xC2, 0x9F, 0x6F, 0xA2, 0xFC, 0x5A, 0xF9, 0x19, 0xFC, 0x5F, 0x92, 0xFA, 0x4F, 0xC2, 0xAF, 0x93,
+    0xFC, 0x2A, 0xF9, 0x3F, 0xA2, 0xAF, 0x4F, 0xA2, 0xAF, 0x4F, 0x92, 0x9E, 0xA6, 0xAA, 0x59, 0xA9,
+    0x50, 0x77, 0x77, 0x77, 0x72, 0xC9, 0x75, 0xAC, 0x97, 0x5A, 0xE7, 0x09, 0xAF, 0xC7, 0x49, 0xEA,
+    0x79, 0xFD, 0xA7, 0x4F, 0x71, 0xAA, 0xF9, 0x73, 0xAE, 0x74, 0x9E, 0x73, 0x9E, 0x97, 0x4A, 0xE7,
+    0x3E, 0xA7, 0x5A, 0xE7, 0x2F, 0x76, 0xEA, 0x71, 0x9E, 0x77, 0xE9, 0x71, 0xE9, 0x6A, 0xC9, 0x49,
+    0xE7, 0x1E, 0xA6, 0xF4, 0xAE, 0x70, 0x9E, 0x6F, 0xA4, 0xEA, 0x70, 0xE6, 0xFC, 0x93, 0x9F, 0x96,
+    0xE9, 0x5F, 0xD2, 0xAF, 0xF4, 0xAD, 0xA5, 0xE0, 0xE2, 0xFF, 0xA3, 0xAE, 0x5E, 0x1E, 0x76, 0x9E,
+    0x5E, 0x19, 0xDA, 0x76, 0xEA, 0x4E, 0x91, 0xAD, 0x97, 0x5F, 0x4E, 0xA9, 0x99, 0xEA, 0x97, 0x3A,
+    0xE4, 0x9F, 0xFF, 0x97, 0x19, 0xE9, 0x5F, 0xFF, 0x72, 0xF7, 0x4A, 0xDA, 0x73, 0xF7, 0x5E, 0x97,
+    0x2A, 0xE9, 0x75, 0xE7, 0x3A, 0xE7, 0x77, 0x7C, 0x77, 0x77, 0x77, 0x70, 0x77, 0x77, 0x77, 0x70,
+    0x9C, 0x77, 0xAC, 0x97, 0x4E, 0x97, 0x19, 0xAF, 0xC7, 0x3F, 0x71, 0x9F, 0xDA, 0x72, 0x9E, 0x97,
+    0x2A, 0xAF, 0x97, 0x2E, 0xA7, 0x59, 0xE7, 0x2F, 0x76, 0xAE, 0x71, 0xAE, 0x77, 0xAE, 0x71, 0xE9,
+    0x77, 0xEA, 0x70, 0xEA, 0x77, 0x0E, 0x97, 0xAE, 0x4A, 0xDA, 0xA6, 0x9E, 0x79, 0xE3, 0xAF, 0xE9,
+    0x4A, 0xE7, 0xE9, 0x2A, 0xFF, 0xC4, 0xEA, 0x6A, 0xDA, 0x29, 0xE9, 0x1A, 0xE3, 0x9F, 0x94, 0x9E,
+    0x39, 0xD3, 0xAE, 0x1A, 0xFF, 0x3E, 0x69, 0x3E, 0xA1, 0xFF, 0xA2, 0xE9, 0x72, 0xAE, 0x75, 0xAE,
+    0x72, 0xAE, 0x97, 0x49, 0xE7, 0x2F, 0x75, 0x9E, 0x97, 0x1F, 0x76, 0xEA, 0x70, 0x9E, 0xA7, 0x6F,
+    0x70, 0xAE, 0x97, 0x6A, 0xE9, 0x7F, 0xCA, 0xAA, 0xAA, 0xA7, 0x09, 0xEA, 0x70, 0xFF, 0xE7, 0x0F,
+    0x71, 0xFF, 0xD9, 0x70, 0xE9, 0x77, 0x76, 0xAA, 0x77, 0x77, 0x77, 0x71, 0x77, 0x77, 0x77, 0x71,
+    0x9C, 0x74, 0x9A, 0xDA, 0x75, 0xEA, 0x70, 0x9F, 0xE9, 0x72, 0xAE, 0x97, 0x0F, 0xFC, 0x71, 0x9E,
+    0xA7, 0x09, 0xD9, 0x19, 0xE7, 0x1F, 0x72, 0xA9, 0x29, 0xDA, 0x70, 0xF7, 0x79, 0xE7, 0x09, 0xE9,
+    0x75, 0x9A, 0xE9, 0x70, 0xE9, 0x74, 0x9F, 0xD7, 0x0E, 0xA7, 0x59, 0xFD, 0xA6, 0xAE, 0x7A, 0xC9,
+    0x79, 0xE6, 0xE7, 0xF7, 0x9E, 0x5E, 0x96, 0xFA, 0x7E, 0xA4, 0xAD, 0xA6, 0xFC, 0x94, 0x9A, 0xF4,
+    0x9E, 0x6F, 0xD1, 0xAF, 0xF5, 0xE6, 0xE0, 0xE1, 0xAF, 0xD9, 0x5E, 0xA5, 0xE1, 0xE2, 0x99, 0x99,
+    0x7A, 0xE5, 0xE1, 0x9D, 0xA7, 0x59, 0xE5, 0xE9, 0x1A, 0xD9, 0x75, 0xE9, 0x4E, 0xA9, 0x99, 0xEA,
+    0x97, 0x3F, 0x49, 0xFF, 0xF9, 0x71, 0xAE, 0x6F, 0xFF, 0x71, 0x9E, 0x97, 0x4A, 0xDA, 0x73, 0xEA,
+    0x75, 0xE9, 0x72, 0xF7, 0x6E, 0x73, 0xE9, 0x77, 0x76, 0x9A, 0x77, 0x77, 0x77, 0x70, 0x79, 0x96,
+    0x9E, 0xA5, 0xFC, 0x5F, 0xA5, 0xF7, 0x99, 0x77, 0x2A, 0xAA, 0x59, 0xFC, 0x4F, 0xD9, 0x39, 0x99,
+    0xE9, 0x59, 0xE5, 0x9E, 0x94, 0xAE, 0x94, 0xAE, 0x94, 0xAE, 0x94, 0x9E, 0x95, 0xE9, 0x5A, 0xE6,
+    0xAE, 0x49, 0x0A, 0xEA, 0x99, 0xAD, 0x09, 0xFF, 0xC1, 0xFF, 0xC2, 0xFE, 0x93, 0xAE, 0xA9, 0x10,
+    0x77, 0x77, 0x59, 0xC7, 0x77, 0xE7, 0x75, 0x9F, 0x97, 0x74, 0xFC, 0xA7, 0x73, 0x9F, 0xD7, 0x74,
+    0x9A, 0xE7, 0x77, 0x9A, 0x77, 0x77, 0x77, 0x19, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC,
+    0x97, 0x71, 0x9F, 0xD9, 0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE,
+    0x1F, 0x77, 0xEA, 0x1F, 0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A,
+    0xE9, 0x39, 0xF7, 0x3F, 0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09,
+    0xFA, 0x39, 0xAF, 0xA9, 0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD,
+    0x00, 0x77, 0x77, 0x75, 0xC7, 0x76, 0xAD, 0x97, 0x73, 0x9F, 0xA7, 0x72, 0xAF, 0xC9, 0x77, 0x1F,
+    0xD9, 0x77, 0x1A, 0xEA, 0x97, 0x73, 0x9A, 0x97, 0x77, 0x77, 0x74, 0x99, 0x77, 0x5F, 0x77, 0x4F,
+    0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E,
+    0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74,
+    0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70,
+    0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9,
+    0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F,
+    0xFC, 0x4A, 0xFF, 0xD0, 0x77, 0xAA, 0xA7, 0x75, 0xFC, 0x77, 0x3F, 0xDA, 0x77, 0x1F, 0xAE, 0x97,
+    0x7F, 0x1A, 0xE7, 0x59, 0xF3, 0xAD, 0x76, 0xAA, 0x95, 0xA9, 0x77, 0x77, 0x76, 0x99, 0x77, 0x5F,
+    0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF,
+    0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92,
+    0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF,
+    0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7,
+    0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F,
+    0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0, 0x77, 0x77, 0x6E, 0xA2, 0xCA, 0x77, 0xFC, 0xA0, 0xAD, 0x76,
+    0xAF, 0xFD, 0x76, 0xE0, 0x9F, 0xC9, 0x76, 0x9C, 0x29, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99,
+    0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70,
+    0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74,
+    0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97,
+    0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A,
+    0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF,
+    0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0, 0x74, 0x99, 0x49, 0x77, 0x0E, 0xA1, 0xAE, 0x76,
+    0xAF, 0x1F, 0x97, 0x5F, 0xA0, 0x9F, 0x76, 0xAD, 0xA2, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99,
+    0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70,
+    0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74,
+    0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97,
+    0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A,
+    0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF,
+    0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0, 0x77, 0x99, 0x77, 0x5A, 0xFA, 0x77, 0x2A, 0xFD,
+    0xA7, 0x71, 0xD9, 0x1A, 0xD7, 0x70, 0x9D, 0x2A, 0xD7, 0x70, 0x9D, 0x2D, 0xA7, 0x71, 0xEA, 0xE7,
+    0x72, 0x9F, 0xC9, 0x77, 0x49, 0x99, 0x77, 0x70, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF,
+    0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A,
+    0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73,
+    0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7,
+    0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70,
+    0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF,
+    0xD0, 0x76, 0xFF, 0xFF, 0xDA, 0x76, 0xFF, 0xFF, 0xDA, 0x77, 0x9A, 0xFF, 0xFE, 0xA7, 0x70, 0xFE,
+    0x92, 0x99, 0xE9, 0x77, 0xAD, 0xAF, 0x5E, 0x77, 0x9E, 0x0F, 0x5E, 0x76, 0x9E, 0x09, 0xEA, 0x5A,
+    0xA7, 0x7E, 0x90, 0xAE, 0x97, 0x76, 0xEA, 0x1F, 0x77, 0x6A, 0xE2, 0xF7, 0x75, 0xAE, 0x91, 0x9F,
+    0xFE, 0x75, 0x9E, 0x92, 0xFF, 0xEA, 0x75, 0xEA, 0x3F, 0xFE, 0x75, 0xF9, 0x29, 0xF7, 0x73, 0xFF,
+    0xFD, 0x77, 0x2A, 0xFF, 0xFC, 0xA7, 0x71, 0x9F, 0x99, 0x99, 0x99, 0xF9, 0x59, 0xD7, 0x9F, 0x6F,
+    0x95, 0xE7, 0xF6, 0x9F, 0x59, 0xE6, 0xF9, 0x6A, 0xF4, 0x9F, 0x49, 0xFC, 0x94, 0x9F, 0xFF, 0xEA,
+    0x3F, 0xFA, 0x2A, 0xFF, 0xFF, 0x4F, 0xF9, 0x2F, 0xFF, 0xFC, 0x30, 0x73, 0x99, 0x99, 0x74, 0x9A,
+    0xFF, 0xA9, 0x7F, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x4A, 0xFD, 0xA9, 0x19, 0xF3, 0x9F, 0xC9, 0x5A,
+    0xE3, 0xFC, 0x7A, 0xDA, 0x2F, 0xC9, 0x7E, 0x29, 0xFA, 0x70, 0x99, 0x3F, 0xC9, 0x76, 0xFC, 0x76,
+    0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x6F, 0xD7, 0x6A, 0xFC,
+    0x72, 0xA2, 0xAF, 0xD7, 0x9D, 0x3F, 0xE9, 0x39, 0xAE, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE6, 0xFF,
+    0xFA, 0x70, 0x9F, 0xFA, 0x76, 0x99, 0x97, 0x71, 0x99, 0x77, 0x1F, 0x97, 0x69, 0xFC, 0x77, 0x09,
+    0xDA, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x6A, 0xEA, 0x77, 0x9A, 0xA7, 0x40, 0x77, 0x77, 0x19, 0xC7,
+    0x74, 0xE9, 0x77, 0x19, 0xFA, 0x77, 0x1F, 0xCA, 0x77, 0x1A, 0xFC, 0x77, 0x2A, 0xE9, 0x77, 0x39,
+    0xA7, 0x77, 0x77, 0x77, 0x0F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2,
+    0x99, 0xAE, 0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09,
+    0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA,
+    0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E,
+    0xA6, 0xAF, 0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x30,
+    0x77, 0x77, 0x71, 0xC7, 0x73, 0x9D, 0xA7, 0x71, 0xFC, 0x77, 0xAF, 0xCA, 0x76, 0xFD, 0xA7, 0x69,
+    0xF9, 0x77, 0x1A, 0x97, 0x77, 0x77, 0x77, 0x3F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF,
+    0xF7, 0x0F, 0xA2, 0x99, 0xAE, 0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70,
+    0xFC, 0x77, 0x09, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF,
+    0xF7, 0x19, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E,
+    0x69, 0xF9, 0x5E, 0xA6, 0xAF, 0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF,
+    0xFF, 0xC9, 0x30, 0x76, 0xAA, 0xC7, 0x72, 0xAF, 0x77, 0x0A, 0xFD, 0x76, 0xAE, 0xAE, 0xA7, 0x4F,
+    0x90, 0x9E, 0x73, 0xF3, 0xAD, 0x97, 0x2A, 0xAA, 0x5A, 0x97, 0x77, 0x77, 0x75, 0xFF, 0xFF, 0x94,
+    0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A, 0xF5,
+    0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0xFE,
+    0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x1F,
+    0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F, 0xFF,
+    0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x73, 0x99, 0x49, 0x75, 0xF1, 0x9E, 0x97, 0x2A,
+    0xF1, 0xFA, 0x72, 0xFA, 0x09, 0xF7, 0x3A, 0xE2, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFF,
+    0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A,
+    0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF,
+    0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77,
+    0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F,
+    0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x77, 0x7A, 0xA7, 0x6E, 0x74, 0xAF, 0x97,
+    0x29, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x39, 0xAE, 0x76, 0x99, 0x77, 0x77, 0x72, 0xFF, 0xD5, 0xAF,
+    0xFD, 0x59, 0xFF, 0xA7, 0x1F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F,
+    0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF,
+    0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x09, 0xAF, 0xDA, 0x95, 0xAF, 0xFD,
+    0x5F, 0xFD, 0xA4, 0x77, 0x76, 0x9C, 0x75, 0xAD, 0x97, 0x29, 0xFA, 0x71, 0xAF, 0xC9, 0x79, 0xFD,
+    0x97, 0x0A, 0xEA, 0x97, 0x29, 0xA9, 0x77, 0x77, 0x75, 0xFF, 0xD5, 0xAF, 0xFD, 0x59, 0xFF, 0xA7,
+    0x1F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72,
+    0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F,
+    0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x09, 0xAF, 0xDA, 0x95, 0xAF, 0xFD, 0x5F, 0xFD, 0xA4, 0x72,
+    0xAC, 0xA7, 0x5F, 0xA7, 0x3F, 0xDA, 0x71, 0xFA, 0xE9, 0x69, 0xF1, 0xAE, 0x59, 0xF3, 0xE6, 0xAA,
+    0x95, 0xA9, 0x77, 0x77, 0x72, 0xFF, 0xD6, 0xAF, 0xFD, 0x69, 0xFF, 0xA7, 0x2F, 0xC7, 0x39, 0xFA,
+    0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73,
+    0xAF, 0x97, 0x19, 0xAF, 0xDA, 0x96, 0xAF, 0xFD, 0x6F, 0xFD, 0xA5, 0x79, 0x94, 0x97, 0x0E, 0xA1,
+    0xAE, 0x6F, 0xC0, 0x9F, 0x95, 0xF9, 0x0A, 0xF6, 0xEA, 0x19, 0xE9, 0x77, 0x77, 0x77, 0x74, 0xFF,
+    0xD6, 0xAF, 0xFD, 0x69, 0xFF, 0xA7, 0x2F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x39, 0xFA,
+    0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x19, 0xAF, 0xDA, 0x96,
+    0xAF, 0xFD, 0x6F, 0xFD, 0xA5, 0x71, 0x99, 0x99, 0x99, 0x97, 0x6A, 0xFF, 0xF9, 0x71, 0x9F, 0xFF,
+    0xF9, 0x7A, 0xFF, 0xFF, 0xCA, 0x69, 0xA9, 0x9F, 0xA1, 0x9A, 0xFD, 0x97, 0x09, 0xF9, 0x39, 0xFD,
+    0x70, 0xAF, 0x6F, 0xC9, 0x7F, 0xC6, 0xAF, 0xC7, 0xFC, 0x69, 0xFC, 0x69, 0xFA, 0x7F, 0xC6, 0x9F,
+    0x97, 0xFC, 0x3A, 0xAA, 0xFC, 0xAA, 0xAA, 0x93, 0xFC, 0x2A, 0xFF, 0xFA, 0x3F, 0xC2, 0xAA, 0xAF,
+    0xDA, 0xAA, 0xA3, 0x9F, 0xC5, 0x9F, 0xA7, 0xAF, 0xA5, 0xAF, 0x97, 0xFC, 0x95, 0xFC, 0x79, 0xFC,
+    0x6F, 0xC7, 0xFC, 0x96, 0xFC, 0x6F, 0xCA, 0x69, 0xFA, 0x49, 0xFD, 0x7A, 0xFA, 0x99, 0x9A, 0xFE,
+    0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x77, 0x77,
+    0x71, 0xEA, 0x2C, 0xA7, 0x72, 0xFC, 0xA0, 0xAD, 0x77, 0x1A, 0xFF, 0xD7, 0x71, 0xE0, 0x9F, 0xC9,
+    0x77, 0x19, 0xC2, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xFE, 0x6F, 0xFC, 0x4A, 0xFE,
+    0x94, 0x9F, 0xFC, 0x5F, 0xF5, 0xAF, 0xDA, 0x70, 0xFD, 0x96, 0xF7, 0x19, 0xFD, 0xA6, 0xEA, 0x71,
+    0xAF, 0xE5, 0x9E, 0x97, 0x1F, 0xFA, 0x4A, 0xE9, 0x71, 0xFF, 0xC4, 0xF7, 0x2E, 0xAF, 0xC9, 0x3F,
+    0x71, 0x9E, 0x99, 0xFC, 0x3E, 0xA7, 0x1A, 0xE1, 0xFC, 0x91, 0x9E, 0x97, 0x1F, 0x19, 0xFC, 0x1A,
+    0xE7, 0x2F, 0x2F, 0xC1, 0xF7, 0x19, 0xEA, 0x2A, 0xFA, 0x0F, 0x71, 0xAE, 0x93, 0xFC, 0x9E, 0xA7,
+    0x1A, 0xE4, 0xAF, 0xF9, 0x71, 0xF5, 0xFF, 0x72, 0xEA, 0x5A, 0xFE, 0x71, 0x9E, 0x95, 0x9F, 0xDA,
+    0x71, 0xAE, 0x96, 0xFD, 0xA7, 0x0A, 0xFC, 0xA5, 0x9F, 0xC9, 0x69, 0xFF, 0xA5, 0xFC, 0x7F, 0xFC,
+    0x95, 0x9F, 0x77, 0x70, 0x99, 0x71, 0x77, 0x77, 0x19, 0xC7, 0x75, 0xE9, 0x77, 0x29, 0xFA, 0x77,
+    0x2F, 0xCA, 0x77, 0x2A, 0xFC, 0x77, 0x3A, 0xE9, 0x77, 0x49, 0xA7, 0x77, 0x77, 0x29, 0x99, 0x99,
+    0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F,
+    0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91,
+    0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7,
+    0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91,
+    0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A,
+    0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97,
+    0x40, 0x77, 0x77, 0x71, 0xC9, 0x77, 0x39, 0xDA, 0x77, 0x2F, 0xC7, 0x70, 0xAF, 0xCA, 0x77, 0xFD,
+    0xA7, 0x79, 0xF9, 0x77, 0x2A, 0x97, 0x77, 0x77, 0x59, 0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF,
+    0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC,
+    0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09,
+    0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71,
+    0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F,
+    0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96,
+    0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x75, 0xAA, 0xC7, 0x73,
+    0xAF, 0x77, 0x1A, 0xFD, 0x77, 0xAE, 0xAE, 0xA7, 0x5F, 0x90, 0x9E, 0x74, 0xF9, 0x2A, 0xD9, 0x73,
+    0xAA, 0xA5, 0xA9, 0x77, 0x77, 0x79, 0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F,
+    0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC,
+    0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC,
+    0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC,
+    0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9,
+    0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71,
+    0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x77, 0x77, 0x2A, 0xDA, 0x2A, 0xC7, 0x5F,
+    0xD0, 0xAD, 0x97, 0x39, 0xFF, 0xD7, 0x4A, 0xD1, 0xFC, 0xA7, 0x5C, 0x92, 0xE9, 0x77, 0x77, 0x77,
+    0x77, 0x09, 0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA,
+    0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF,
+    0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19,
+    0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F,
+    0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD,
+    0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F,
+    0xFA, 0x77, 0x19, 0x97, 0x40, 0x72, 0x99, 0x49, 0x76, 0xF1, 0x9E, 0x97, 0x3A, 0xF1, 0xFA, 0x73,
+    0xFC, 0x09, 0xF9, 0x73, 0x9E, 0x2E, 0x97, 0x77, 0x77, 0x77, 0x79, 0x99, 0x99, 0x77, 0xAF, 0xFA,
+    0x73, 0xAF, 0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA,
+    0x3A, 0xFC, 0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F,
+    0xC9, 0x09, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F,
+    0xCA, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A,
+    0xFC, 0x2F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A,
+    0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x77, 0x0A,
+    0xA6, 0xC3, 0xAD, 0xA4, 0xE9, 0x09, 0xF9, 0x2F, 0xC1, 0x9F, 0x90, 0xFC, 0x39, 0xFF, 0xC5, 0x9F,
+    0xE7, 0xAF, 0xC7, 0x0F, 0xD9, 0x6F, 0xF9, 0x4F, 0xCA, 0xF9, 0x2A, 0xF1, 0xAF, 0x90, 0x9F, 0x3A,
+    0xF1, 0x9D, 0x5A, 0xD3, 0x97, 0x92, 0x74, 0x99, 0x99, 0x95, 0xA7, 0x3A, 0xFF, 0xA2, 0xE7, 0x0A,
+    0xFF, 0xF9, 0xE9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD, 0xA9, 0x99, 0xAF, 0xD9, 0x7F, 0xD5, 0x9F, 0xCA,
+    0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x69, 0xFE, 0x5A, 0xFA, 0x59, 0xFF, 0x94, 0xFC, 0x59, 0xE0, 0xFC,
+    0x93, 0x9F, 0xC4, 0x9E, 0x1F, 0xC9, 0x3A, 0xFA, 0x39, 0xE2, 0xFC, 0x93, 0xFC, 0x92, 0xAE, 0x3F,
+    0xC4, 0xFC, 0x91, 0xAD, 0xA4, 0xFC, 0x4F, 0xC1, 0xAD, 0xA4, 0x9F, 0xA4, 0xFC, 0x9A, 0xDA, 0x5F,
+    0xC9, 0x4F, 0xFA, 0x59, 0xFC, 0x5F, 0xEA, 0x6F, 0xC9, 0x5A, 0xFC, 0xA6, 0xAF, 0xC7, 0xFD, 0x5F,
+    0xD7, 0x0F, 0xEA, 0x99, 0xAF, 0xD9, 0x7F, 0xFF, 0xFC, 0x70, 0xE9, 0xFF, 0xFA, 0x70, 0xAD, 0x91,
+    0x9F, 0xFA, 0x73, 0xA7, 0x99, 0x76, 0x77, 0x77, 0x3C, 0x97, 0x76, 0xAD, 0xA7, 0x75, 0xFC, 0x77,
+    0x4A, 0xFC, 0x97, 0x73, 0xAF, 0xC9, 0x77, 0x49, 0xF7, 0x77, 0xA7, 0x77, 0x77, 0x77, 0x69, 0xFF,
+    0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A,
+    0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9,
+    0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6,
+    0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9,
+    0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF,
+    0x97, 0x5A, 0xFF, 0x97, 0x72, 0x99, 0x97, 0x70, 0x77, 0x77, 0x72, 0xAA, 0x77, 0x6E, 0x77, 0x4A,
+    0xF7, 0x72, 0x9F, 0xD7, 0x71, 0xAF, 0xD7, 0x72, 0xFA, 0x77, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x71,
+    0x9F, 0xFC, 0xA2, 0xAF, 0xFC, 0x1F, 0xFD, 0x92, 0xFF, 0xD1, 0xAF, 0xF9, 0x3A, 0xFE, 0x94, 0xAF,
+    0x97, 0xAF, 0x6A, 0xF7, 0x0F, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6,
+    0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7,
+    0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF7, 0xFC, 0x7A, 0xF7, 0xFC,
+    0x7F, 0x97, 0xFC, 0xA4, 0x9F, 0xC7, 0x0F, 0xEA, 0xAA, 0xFD, 0x97, 0x09, 0xFF, 0xFD, 0x97, 0x29,
+    0xFF, 0xF9, 0x75, 0xAF, 0xF9, 0x77, 0x29, 0x99, 0x77, 0x74, 0x9A, 0xC9, 0x77, 0x49, 0xF9, 0x77,
+    0x29, 0xFD, 0x97, 0x70, 0x9E, 0xAF, 0x77, 0xAE, 0xA1, 0xEA, 0x75, 0xAE, 0xA3, 0xE7, 0x59, 0xAA,
+    0x59, 0xA7, 0x77, 0x77, 0x77, 0x39, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A,
+    0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC,
+    0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9,
+    0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7,
+    0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9,
+    0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x72, 0x99, 0x97, 0x70, 0x72,
+    0x94, 0x99, 0x77, 0xAE, 0x2E, 0xA7, 0x6F, 0x90, 0xAF, 0x75, 0x9F, 0x1F, 0xA7, 0x6E, 0x91, 0xAE,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A,
+    0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC,
+    0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9,
+    0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7,
+    0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9,
+    0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x72, 0x99, 0x97, 0x70, 0x77,
+    0x77, 0x6A, 0xA7, 0x72, 0x9E, 0x77, 0x1A, 0xF7, 0x79, 0xFD, 0x76, 0xAF, 0xD7, 0x7F, 0xA7, 0x71,
+    0xA9, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xFC, 0x2F, 0xFA, 0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE,
+    0x93, 0x9F, 0xD9, 0x3F, 0xC6, 0xAE, 0xA5, 0xAF, 0x59, 0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE,
+    0x97, 0x0A, 0xF2, 0x9E, 0xA7, 0x19, 0xF9, 0x1F, 0x73, 0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F,
+    0xEA, 0x76, 0xFE, 0x77, 0x9F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F,
+    0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x76, 0x9A, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA,
+    0x71, 0x5F, 0xFD, 0x72, 0xAF, 0xFD, 0x72, 0x9F, 0xF9, 0x76, 0xFA, 0x77, 0x9F, 0xCA, 0x99, 0x74,
+    0xAF, 0xFD, 0x97, 0x1F, 0xFF, 0xC7, 0x0F, 0xC0, 0x9A, 0xFC, 0xA6, 0x9F, 0xA3, 0xFC, 0x69, 0xF9,
+    0x3A, 0xF6, 0xAF, 0x4A, 0xF9, 0x5F, 0xC4, 0xAF, 0x6F, 0xC4, 0xFC, 0x59, 0xFA, 0x3A, 0xF9, 0x5A,
+    0xF9, 0x2A, 0xFA, 0x6F, 0xC9, 0x9A, 0xFC, 0xA7, 0xFF, 0xF9, 0x70, 0xFF, 0xD9, 0x71, 0x9F, 0xC9,
+    0x99, 0x74, 0xAF, 0x97, 0x59, 0xFE, 0xA7, 0x3A, 0xFF, 0xD7, 0x2F, 0xFD, 0x97, 0x10, 0x77, 0x09,
+    0xAA, 0xDA, 0x97, 0x71, 0x9F, 0xFA, 0x77, 0x9F, 0xFD, 0xA7, 0x59, 0xFA, 0x99, 0xFC, 0x75, 0xF9,
+    0x3F, 0x74, 0xAE, 0xA4, 0xF7, 0x4F, 0x5E, 0xA7, 0x39, 0xF4, 0xAE, 0x74, 0xFA, 0x39, 0xEA, 0x74,
+    0xF9, 0x3E, 0xA7, 0x5F, 0x3A, 0xE7, 0x59, 0xF2, 0xAE, 0x76, 0xAE, 0xA2, 0xEA, 0x76, 0xF9, 0x1A,
+    0xF7, 0x6F, 0x91, 0xAF, 0xA7, 0x49, 0xF3, 0xFC, 0x97, 0x39, 0xF3, 0x9F, 0xC9, 0x72, 0xAE, 0xA4,
+    0x9F, 0xC7, 0x2F, 0x95, 0xAF, 0xA7, 0x1F, 0x7F, 0xC7, 0x09, 0xF7, 0x9F, 0x70, 0xAF, 0x1D, 0x39,
+    0xF7, 0x0F, 0xA0, 0xAE, 0x91, 0xAE, 0x97, 0x0F, 0x90, 0xFF, 0xDA, 0x71, 0xF1, 0xAF, 0xFA, 0x71,
+    0x9F, 0x2A, 0xFC, 0xA7, 0x3A, 0xEA, 0x59, 0x76, 0xF9, 0x77, 0x5F, 0x77, 0x0C, 0xA2, 0xAE, 0xA7,
+    0x7A, 0xE9, 0x9F, 0x77, 0x0F, 0xFC, 0x97, 0x70, 0xAF, 0xE9, 0x77, 0x29, 0xAD, 0xA9, 0x77, 0x30,
+    0x70, 0x97, 0x71, 0xAC, 0xA7, 0x79, 0xE9, 0x76, 0x9F, 0x77, 0xFA, 0x77, 0xF9, 0x77, 0xAE, 0x77,
+    0x09, 0xCA, 0x77, 0x77, 0x77, 0x59, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A,
+    0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49,
+    0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9,
+    0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1,
+    0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95, 0x77, 0x77, 0x19, 0xC9, 0x77,
+    0x0E, 0x77, 0xAE, 0x97, 0x6F, 0x76, 0xF9, 0x75, 0x9E, 0x97, 0x6E, 0x97, 0x79, 0xC7, 0x77, 0x77,
+    0x76, 0x9A, 0xA9, 0x29, 0x99, 0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F,
+    0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F,
+    0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1,
+    0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA,
+    0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69, 0x50, 0x77, 0x76, 0xAD, 0xA7, 0x6A, 0xF7, 0x59, 0xFC, 0xA7,
+    0x39, 0xEA, 0xE7, 0x3E, 0x90, 0xAD, 0xA7, 0x1E, 0x92, 0xE7, 0x0A, 0xD9, 0x39, 0xCA, 0x77, 0x77,
+    0x77, 0x29, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49,
+    0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4,
+    0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE,
+    0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC,
+    0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95, 0x70, 0xAC, 0xA3, 0xA7, 0x19, 0xFC, 0x1A, 0xCA, 0x70,
+    0xFF, 0xDA, 0x70, 0xDA, 0x0F, 0xD7, 0x1D, 0x2F, 0x97, 0x79, 0x77, 0x77, 0x77, 0x59, 0xAA, 0x92,
+    0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA,
+    0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F,
+    0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A,
+    0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9,
+    0x69, 0x96, 0x95, 0x77, 0x72, 0x9E, 0x2A, 0xD9, 0x70, 0xF9, 0x0A, 0xEA, 0x79, 0xF1, 0xF9, 0x70,
+    0xE9, 0x1A, 0xDA, 0x72, 0x94, 0x97, 0x77, 0x77, 0x74, 0x9A, 0xA9, 0x29, 0x99, 0x79, 0xFD, 0x0F,
+    0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0xFA,
+    0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3, 0xFC, 0x94,
+    0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE, 0x1A, 0xFE,
+    0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69, 0x50, 0x72,
+    0x9A, 0x97, 0x69, 0xFC, 0x97, 0x4E, 0xAE, 0x73, 0xAD, 0x2D, 0x97, 0x2D, 0x92, 0xD9, 0x72, 0xDA,
+    0x19, 0xD7, 0x3E, 0xAA, 0xDA, 0x74, 0xFD, 0x76, 0xAC, 0xA9, 0x77, 0x77, 0x19, 0xAA, 0x92, 0x99,
+    0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A,
+    0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4,
+    0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA,
+    0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69,
+    0x96, 0x95, 0x79, 0xAA, 0x99, 0x59, 0xAA, 0x97, 0x09, 0xFE, 0xA1, 0xAF, 0xD9, 0x5A, 0xFF, 0xFF,
+    0xE4, 0xAF, 0xCA, 0xFE, 0xA9, 0xAF, 0x39, 0xFA, 0x3F, 0xA2, 0xF3, 0xFA, 0x4F, 0x3F, 0x2A, 0xF4,
+    0xAE, 0x92, 0xAE, 0x92, 0xFA, 0x4F, 0x2A, 0xEA, 0x29, 0xF4, 0xAE, 0xA1, 0xFA, 0x3A, 0xF4, 0xFA,
+    0xAF, 0x94, 0xFA, 0x3A, 0xFF, 0xA6, 0xFA, 0x3F, 0xEA, 0x70, 0xFA, 0x2F, 0xD9, 0x5A, 0xA2, 0xFA,
+    0x1A, 0xFD, 0xA4, 0xE2, 0xFC, 0x9A, 0xDA, 0xAF, 0xA9, 0x9A, 0xF2, 0xAF, 0xF1, 0xFF, 0xE3, 0x9F,
+    0xE2, 0xAF, 0xFA, 0x59, 0xFA, 0x4A, 0xFC, 0xA9, 0x70, 0x99, 0x71, 0x97, 0x00, 0x70, 0x9A, 0xA9,
+    0x70, 0xFE, 0x59, 0xFF, 0xA3, 0xAF, 0xFC, 0xA2, 0x9F, 0x91, 0xAD, 0x3F, 0x94, 0x92, 0xAF, 0x71,
+    0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFC, 0x5A, 0x2F, 0xC3, 0x9D, 0x91,
+    0xFD, 0xAA, 0xF9, 0x19, 0xFF, 0xE3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x49, 0x97, 0x3F,
+    0xA7, 0x1A, 0xF7, 0x3E, 0x72, 0xAD, 0x97, 0x1A, 0xDA, 0x70, 0x9E, 0xA7, 0x19, 0xAA, 0x71, 0x79,
+    0x74, 0xD7, 0x3A, 0xE7, 0x2A, 0xEA, 0x71, 0x9F, 0x97, 0x19, 0xF7, 0x3E, 0xA7, 0x3A, 0xC9, 0x77,
+    0x77, 0x70, 0x9A, 0xA9, 0x79, 0xFE, 0x5A, 0xFF, 0xA3, 0xAE, 0xA9, 0xAF, 0x29, 0xE9, 0x2F, 0x2E,
+    0xA2, 0x9E, 0xA1, 0xAE, 0x3F, 0x2E, 0xA2, 0xAE, 0x91, 0x9E, 0x90, 0x9F, 0x92, 0xAE, 0xAF, 0xC9,
+    0x3F, 0xFA, 0x5F, 0xD9, 0x7F, 0x95, 0xA9, 0x1F, 0x93, 0x9E, 0x1F, 0xC9, 0x99, 0xFA, 0x19, 0xFF,
+    0xE3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x77, 0x75, 0xAA, 0x75, 0x9E, 0x74, 0xF7, 0x3A,
+    0xF7, 0x3F, 0x73, 0xF7, 0x4E, 0x75, 0xAA, 0x77, 0x77, 0x77, 0x9A, 0xA9, 0x71, 0x9F, 0xE7, 0xAF,
+    0xFA, 0x5A, 0xEA, 0x9A, 0xF4, 0x9E, 0x92, 0xF4, 0xEA, 0x29, 0xEA, 0x3A, 0xE3, 0xF4, 0xEA, 0x2A,
+    0xE9, 0x39, 0xE9, 0x09, 0xF9, 0x4A, 0xEA, 0xFC, 0x95, 0xFF, 0xA7, 0xFD, 0x97, 0x1F, 0x95, 0xA9,
+    0x3F, 0x93, 0x9E, 0x3F, 0xC9, 0x99, 0xFA, 0x39, 0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39,
+    0x97, 0x10, 0x77, 0x71, 0xAD, 0x73, 0xFC, 0x71, 0xFD, 0x97, 0xAE, 0xAE, 0x69, 0xE1, 0xE9, 0x49,
+    0xE2, 0x9D, 0xA4, 0xE4, 0xD9, 0x77, 0x77, 0x70, 0x9A, 0xA9, 0x70, 0x9F, 0xE6, 0xAF, 0xFA, 0x4A,
+    0xEA, 0x9A, 0xF3, 0x9E, 0x92, 0xF3, 0xEA, 0x29, 0xEA, 0x2A, 0xE3, 0xF3, 0xEA, 0x2A, 0xE9, 0x29,
+    0xE9, 0x09, 0xF9, 0x3A, 0xEA, 0xFC, 0x94, 0xFF, 0xA6, 0xFD, 0x97, 0x0F, 0x95, 0xA9, 0x2F, 0x93,
+    0x9E, 0x2F, 0xC9, 0x99, 0xFA, 0x29, 0xFF, 0xE4, 0xFF, 0xCA, 0x6A, 0xFC, 0xA7, 0x29, 0x97, 0x00,
+    0x77, 0x69, 0xDA, 0x19, 0xE5, 0x9F, 0x1F, 0x94, 0xAF, 0x09, 0xF5, 0x9E, 0x2E, 0x97, 0x59, 0x77,
+    0x77, 0x75, 0x9A, 0xA9, 0x71, 0x9F, 0xE7, 0xAF, 0xFA, 0x5A, 0xEA, 0x9A, 0xF4, 0x9E, 0x92, 0xF4,
+    0xEA, 0x29, 0xEA, 0x3A, 0xE3, 0xF4, 0xEA, 0x2A, 0xE9, 0x39, 0xE9, 0x09, 0xF9, 0x4A, 0xEA, 0xFC,
+    0x95, 0xFF, 0xA7, 0xFD, 0x97, 0x1F, 0x95, 0xA9, 0x3F, 0x93, 0x9E, 0x3F, 0xC9, 0x99, 0xFA, 0x39,
+    0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39, 0x97, 0x10, 0x39, 0x6A, 0xC9, 0x49, 0xE4, 0x9F,
+    0x4F, 0xA4, 0xF9, 0x4A, 0xE5, 0x9C, 0xA7, 0x75, 0x9A, 0xA2, 0xAF, 0xD0, 0xAF, 0xE0, 0xAA, 0xAF,
+    0xA3, 0xAE, 0x93, 0xF3, 0x9F, 0x3A, 0xEA, 0x3F, 0x93, 0xF3, 0x9F, 0x3F, 0xA3, 0xF9, 0x29, 0xF1,
+    0xA9, 0x9F, 0xAD, 0xAA, 0xFE, 0x9A, 0xFD, 0xA1, 0xFA, 0x93, 0x99, 0x40, 0x77, 0x59, 0xC7, 0x2E,
+    0x70, 0xAE, 0x96, 0x9F, 0x7F, 0x96, 0xAE, 0x97, 0xE7, 0x19, 0xC7, 0x77, 0x72, 0x9A, 0xA6, 0xAF,
+    0xD4, 0xAF, 0xE4, 0xAA, 0xAF, 0xA7, 0xAE, 0x97, 0xF7, 0x9F, 0x7A, 0xEA, 0x7F, 0x97, 0xF7, 0x9F,
+    0x7F, 0xA7, 0xF9, 0x69, 0xF1, 0xA9, 0x39, 0xFA, 0xDA, 0x3A, 0xFE, 0x93, 0xAF, 0xDA, 0x5F, 0xA9,
+    0x79, 0x97, 0x00, 0x77, 0x1A, 0xD9, 0x6A, 0xF5, 0xAF, 0xCA, 0x39, 0xEA, 0xE3, 0xE9, 0x0A, 0xDA,
+    0x1E, 0x92, 0xE0, 0xAD, 0x93, 0xAC, 0xA7, 0x77, 0x39, 0xAA, 0x5A, 0xFD, 0x3A, 0xFE, 0x3A, 0xAA,
+    0xFA, 0x6A, 0xE9, 0x6F, 0x69, 0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x69, 0xF6, 0xFA, 0x6F, 0x95, 0x9F,
+    0x1A, 0x92, 0x9F, 0xAD, 0xA2, 0xAF, 0xE9, 0x2A, 0xFD, 0xA4, 0xFA, 0x96, 0x99, 0x70, 0x76, 0x9E,
+    0x2E, 0x91, 0xF9, 0x0A, 0xEA, 0x09, 0xF1, 0xF9, 0x1E, 0x91, 0xEA, 0x39, 0x49, 0x77, 0x77, 0x09,
+    0xAA, 0x6A, 0xFD, 0x4A, 0xFE, 0x4A, 0xAA, 0xFA, 0x7A, 0xE9, 0x7F, 0x79, 0xF7, 0xAE, 0xA7, 0xF9,
+    0x7F, 0x79, 0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x1A, 0x93, 0x9F, 0xAD, 0xA3, 0xAF, 0xE9, 0x3A, 0xFD,
+    0xA5, 0xFA, 0x97, 0x99, 0x70, 0x77, 0x71, 0xAD, 0x91, 0xD7, 0x0A, 0xFA, 0xE9, 0x70, 0xAF, 0xD9,
+    0x72, 0xFC, 0x73, 0xAF, 0xCA, 0x71, 0xEA, 0xF9, 0x70, 0x9C, 0x90, 0x9E, 0xA7, 0x5F, 0x75, 0x9E,
+    0xA7, 0xAF, 0xFA, 0x59, 0xFF, 0xE4, 0xAF, 0xFF, 0x39, 0xFA, 0x19, 0xFC, 0x3F, 0xA3, 0xAF, 0x2A,
+    0xF4, 0x9F, 0x2F, 0x94, 0x9F, 0x1A, 0xF5, 0x9F, 0x1F, 0xA5, 0xAE, 0xA1, 0xFA, 0x5F, 0x91, 0xFA,
+    0x49, 0xF2, 0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3, 0xAF, 0xA9, 0x9F, 0xC9, 0x4F, 0xFE, 0xA5, 0x9F,
+    0xFC, 0xA7, 0x9F, 0xDA, 0x74, 0x99, 0x71, 0x7A, 0xCA, 0x3A, 0x70, 0x9F, 0xC1, 0xDA, 0x7F, 0xFD,
+    0xA6, 0x9D, 0xA0, 0xFD, 0x70, 0xD2, 0xF9, 0x76, 0x97, 0x77, 0x77, 0x79, 0xA9, 0x49, 0xAA, 0x93,
+    0xAF, 0xCA, 0x19, 0xFC, 0x91, 0xFE, 0xA0, 0xAF, 0xE1, 0xAA, 0xAF, 0xAA, 0xFF, 0x4A, 0xEA, 0xDA,
+    0x0A, 0xF4, 0xFD, 0xA1, 0x9F, 0x4F, 0xD2, 0xAE, 0xA3, 0x9F, 0xC3, 0xF9, 0x3A, 0xFA, 0x3F, 0x4F,
+    0xC3, 0x9F, 0x4F, 0xA3, 0xAE, 0xA3, 0x9F, 0x93, 0xF9, 0x39, 0xF3, 0x9F, 0x4A, 0xF3, 0x9F, 0x1C,
+    0x1F, 0xA3, 0xAF, 0xAD, 0x90, 0xF9, 0x3F, 0xF0, 0x9F, 0x4A, 0xFD, 0x90, 0xAE, 0xA4, 0x9F, 0xA7,
+    0x69, 0x94, 0x70, 0x97, 0x6A, 0xCA, 0x75, 0xE9, 0x73, 0x9F, 0x74, 0xFC, 0x74, 0xF9, 0x74, 0xAE,
+    0x75, 0x9D, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6A, 0xFF, 0xD4, 0xFD, 0xAF, 0xC9,
+    0x2A, 0xF2, 0x9F, 0xA1, 0x9F, 0x4F, 0xC1, 0xFA, 0x4A, 0xF1, 0xF9, 0x4A, 0xF0, 0xAF, 0x5A, 0xF0,
+    0xFC, 0x5F, 0xA0, 0xFA, 0x5F, 0x90, 0xFA, 0x49, 0xF1, 0xFA, 0x4F, 0xA1, 0xFC, 0x3A, 0xF2, 0xAF,
+    0x91, 0xAF, 0x92, 0x9F, 0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x73, 0x99, 0x70, 0x77, 0x77,
+    0x0C, 0x97, 0x6E, 0x97, 0x4A, 0xEA, 0x74, 0xF7, 0x4F, 0x97, 0x39, 0xE9, 0x74, 0xAD, 0x97, 0x59,
+    0xC7, 0x77, 0x77, 0x71, 0x9A, 0xA9, 0x72, 0x9F, 0xEA, 0x7A, 0xFF, 0xD5, 0xFD, 0xAF, 0xC9, 0x3A,
+    0xF2, 0x9F, 0xA2, 0x9F, 0x4F, 0xC2, 0xFA, 0x4A, 0xF2, 0xF9, 0x4A, 0xF1, 0xAF, 0x5A, 0xF1, 0xFC,
+    0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA, 0x49, 0xF2, 0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3, 0xAF, 0x91,
+    0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFC, 0x97, 0x9F, 0xDA, 0x74, 0x99, 0x71, 0x77, 0x74, 0xAD,
+    0xA7, 0x4A, 0xF9, 0x72, 0x9F, 0xD7, 0x2E, 0xAE, 0x97, 0x0E, 0x90, 0xAD, 0xA7, 0xEA, 0x2E, 0x69,
+    0xDA, 0x39, 0xCA, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x72, 0x9F, 0xEA, 0x7A, 0xFF, 0xD5, 0xFD, 0xAF,
+    0xC9, 0x3A, 0xF2, 0x9F, 0xA2, 0x9F, 0x4F, 0xC2, 0xFA, 0x4A, 0xF2, 0xF9, 0x4A, 0xF1, 0xAF, 0x5A,
+    0xF1, 0xFC, 0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA, 0x49, 0xF2, 0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3,
+    0xAF, 0x91, 0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFC, 0x97, 0x9F, 0xDA, 0x74, 0x99, 0x71, 0x70,
+    0xAC, 0xA3, 0xA7, 0x0F, 0xC1, 0xAD, 0x6F, 0xEA, 0xE6, 0xDA, 0x0A, 0xFC, 0x96, 0xD2, 0xF9, 0x75,
+    0x99, 0x77, 0x77, 0x77, 0x9A, 0xA9, 0x72, 0x9F, 0xEA, 0x7A, 0xFF, 0xD5, 0xFD, 0xAF, 0xC9, 0x3A,
+    0xF2, 0x9F, 0xA2, 0x9F, 0x4F, 0xC2, 0xFA, 0x4A, 0xF2, 0xF9, 0x4A, 0xF1, 0xAF, 0x5A, 0xF1, 0xFC,
+    0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA, 0x49, 0xF2, 0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3, 0xAF, 0x91,
+    0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFC, 0x97, 0x9F, 0xDA, 0x74, 0x99, 0x71, 0x77, 0x71, 0xE2,
+    0xAD, 0x96, 0xF9, 0x0A, 0xF6, 0xF9, 0x0F, 0xA6, 0xEA, 0x1A, 0xE7, 0x09, 0x77, 0x77, 0x77, 0x59,
+    0xAA, 0x97, 0x29, 0xFE, 0xA7, 0xAF, 0xFD, 0x5F, 0xDA, 0xFC, 0x93, 0xAF, 0x29, 0xFA, 0x29, 0xF4,
+    0xFC, 0x2F, 0xA4, 0xAF, 0x2F, 0x94, 0xAF, 0x1A, 0xF5, 0xAF, 0x1F, 0xC5, 0xFA, 0x1F, 0xA5, 0xF9,
+    0x1F, 0xA4, 0x9F, 0x2F, 0xA4, 0xFA, 0x2F, 0xC3, 0xAF, 0x3A, 0xF9, 0x1A, 0xF9, 0x39, 0xFF, 0xE9,
+    0x5A, 0xFF, 0xC9, 0x79, 0xFD, 0xA7, 0x49, 0x97, 0x10, 0x59, 0xA9, 0x72, 0xAE, 0x97, 0x1F, 0xA7,
+    0x1F, 0x97, 0x19, 0xDA, 0x77, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFD, 0xAF,
+    0xFF, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x49, 0xE7, 0x2F, 0xA7, 0x1F, 0xA7,
+    0x1A, 0xE7, 0x39, 0x96, 0x72, 0x9A, 0xA9, 0x39, 0x97, 0x09, 0xFE, 0xA0, 0xAD, 0x7A, 0xFF, 0xF9,
+    0x6F, 0xCA, 0xAF, 0xD7, 0xAF, 0x3F, 0xA6, 0x9F, 0x4F, 0xC6, 0xFA, 0x29, 0xFD, 0x6F, 0x29, 0xFE,
+    0x5A, 0xF1, 0x9D, 0xAA, 0xF5, 0xFA, 0x0A, 0xD9, 0x0A, 0xEA, 0x5F, 0x9A, 0xD9, 0x1F, 0x95, 0xFE,
+    0x29, 0xF6, 0xFD, 0x3F, 0xA6, 0xFC, 0x3A, 0xF7, 0xAF, 0x2A, 0xF9, 0x69, 0xFF, 0xF9, 0x69, 0xFF,
+    0xF9, 0x69, 0xD9, 0x09, 0xFD, 0xA7, 0x1A, 0x94, 0x99, 0x73, 0x70, 0x97, 0x71, 0xD9, 0x77, 0xAE,
+    0x77, 0xAE, 0xA7, 0x7F, 0x97, 0x69, 0xF7, 0x70, 0xEA, 0x77, 0x0A, 0xC9, 0x77, 0x77, 0x77, 0x19,
+    0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA, 0xAF, 0xA3, 0xAF,
+    0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x49,
+    0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49, 0xF1, 0x9D, 0xAF,
+    0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2, 0xFD, 0x92, 0xAF,
+    0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x77, 0x77, 0x1A, 0xC7, 0x71, 0xE7, 0x7F, 0x76, 0x9F, 0x76,
+    0xF7, 0x6A, 0xE7, 0x7E, 0x77, 0x0A, 0xA7, 0x77, 0x77, 0x72, 0x99, 0xA9, 0x69, 0x99, 0x91, 0x9F,
+    0xD9, 0x4F, 0x91, 0xFE, 0xA3, 0xAF, 0x2A, 0xAA, 0xFA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA5, 0xF4, 0xF9,
+    0x49, 0xF3, 0x9F, 0x5A, 0xEA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA4, 0x9F, 0x39, 0xF9, 0x4A, 0xF3, 0xFC,
+    0x5F, 0x92, 0xAF, 0xC5, 0xF2, 0x9F, 0xD4, 0x9F, 0x19, 0xDA, 0xF0, 0x9C, 0x90, 0x9F, 0x9A, 0xE0,
+    0xFE, 0xA0, 0x9F, 0xF1, 0xFE, 0x19, 0xFE, 0x2F, 0xD9, 0x2A, 0xFA, 0x39, 0xEA, 0x69, 0x97, 0x94,
+    0x77, 0x76, 0xAD, 0x97, 0x6F, 0xC7, 0x5A, 0xFC, 0x97, 0x3A, 0xEA, 0xE7, 0x29, 0xE1, 0xE9, 0x70,
+    0x9E, 0x92, 0xDA, 0x70, 0xE9, 0x3A, 0xC9, 0x77, 0x77, 0x76, 0x99, 0xA9, 0x69, 0x99, 0x91, 0x9F,
+    0xD9, 0x4F, 0x91, 0xFE, 0xA3, 0xAF, 0x2A, 0xAA, 0xFA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA5, 0xF4, 0xF9,
+    0x49, 0xF3, 0x9F, 0x5A, 0xEA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA4, 0x9F, 0x39, 0xF9, 0x4A, 0xF3, 0xFC,
+    0x5F, 0x92, 0xAF, 0xC5, 0xF2, 0x9F, 0xD4, 0x9F, 0x19, 0xDA, 0xF0, 0x9C, 0x90, 0x9F, 0x9A, 0xE0,
+    0xFE, 0xA0, 0x9F, 0xF1, 0xFE, 0x19, 0xFE, 0x2F, 0xD9, 0x2A, 0xFA, 0x39, 0xEA, 0x69, 0x97, 0x94,
+    0x77, 0x72, 0x9E, 0x2E, 0x71, 0xF1, 0xF9, 0x79, 0xF1, 0xF9, 0x79, 0xE9, 0x1E, 0xA7, 0x29, 0x49,
+    0x77, 0x77, 0x77, 0x09, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2,
+    0xAA, 0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF,
+    0x5F, 0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD,
+    0x49, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F,
+    0xE2, 0xFD, 0x92, 0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x77, 0x77, 0x6A, 0xC7, 0x73, 0xE7,
+    0x71, 0xF7, 0x70, 0x9F, 0x77, 0x0F, 0x77, 0x0A, 0xE7, 0x71, 0xE7, 0x72, 0xAA, 0x77, 0x77, 0x77,
+    0x71, 0x99, 0xA5, 0x9A, 0xA7, 0xAF, 0xC3, 0xFC, 0x94, 0x9F, 0xDA, 0x29, 0xFA, 0x49, 0xAF, 0xD3,
+    0xFC, 0x79, 0xF3, 0xAE, 0xA7, 0x0F, 0x92, 0xAE, 0xA7, 0x0F, 0x92, 0xF9, 0x70, 0xAE, 0xA2, 0xF7,
+    0x19, 0xEA, 0x19, 0xEA, 0x72, 0xF1, 0xAE, 0x73, 0xF1, 0xEA, 0x73, 0xF0, 0x9E, 0x74, 0xF0, 0xEA,
+    0x74, 0xF9, 0xE7, 0x5A, 0xFD, 0x97, 0x5A, 0xFC, 0xA7, 0x6A, 0xFC, 0x77, 0xFC, 0x77, 0x0F, 0x97,
+    0x7A, 0xE9, 0x77, 0x9E, 0x97, 0x1D, 0x91, 0x9A, 0xE9, 0x71, 0x9F, 0xFC, 0x97, 0x2A, 0xFF, 0x97,
+    0x4F, 0xDA, 0x77, 0xAC, 0xAA, 0x77, 0x71, 0x99, 0x97, 0x7A, 0xFD, 0x75, 0xFF, 0x75, 0xFF, 0x77,
+    0x0F, 0xA7, 0x70, 0xF9, 0x77, 0x0F, 0x77, 0x09, 0xF7, 0x70, 0xAE, 0x92, 0x9A, 0xA7, 0x2F, 0x19,
+    0xFC, 0x71, 0xF0, 0xAF, 0xE7, 0x9E, 0x9A, 0xFF, 0x7A, 0xEA, 0xDA, 0x0A, 0xF9, 0x6F, 0xDA, 0x19,
+    0xF9, 0x6F, 0xCA, 0x29, 0xF9, 0x6F, 0xC3, 0x9F, 0x69, 0xFA, 0x39, 0xF6, 0xAF, 0x4A, 0xF6, 0xFA,
+    0x4F, 0xA6, 0xF9, 0x39, 0xF6, 0x9F, 0x4F, 0xA6, 0xAF, 0x3A, 0xF7, 0xAF, 0x91, 0xAF, 0x97, 0xFF,
+    0xFA, 0x70, 0xFF, 0xEA, 0x70, 0x9F, 0xAF, 0xC9, 0x71, 0xAF, 0x29, 0x74, 0xFA, 0x77, 0x0F, 0x97,
+    0x79, 0xF7, 0x70, 0xAF, 0x97, 0x59, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0x20, 0x77, 0x77, 0x9E, 0x2E, 0x73, 0xF1, 0xF9, 0x71, 0x9F, 0x1F, 0x72, 0x9E, 0x91,
+    0xEA, 0x74, 0x94, 0x97, 0x77, 0x77, 0x77, 0x99, 0xA5, 0x9A, 0xA7, 0xAF, 0xC3, 0xFC, 0x94, 0x9F,
+    0xDA, 0x29, 0xFA, 0x49, 0xAF, 0xD3, 0xFC, 0x79, 0xF3, 0xAE, 0xA7, 0x0F, 0x92, 0xAE, 0xA7, 0x0F,
+    0x92, 0xF9, 0x70, 0xAE, 0xA2, 0xF7, 0x19, 0xEA, 0x19, 0xEA, 0x72, 0xF1, 0xAE, 0x73, 0xF1, 0xEA,
+    0x73, 0xF0, 0x9E, 0x74, 0xF0, 0xEA, 0x74, 0xF9, 0xE7, 0x5A, 0xFD, 0x97, 0x5A, 0xFC, 0xA7, 0x6A,
+    0xFC, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x7A, 0xE9, 0x77, 0x9E, 0x97, 0x1D, 0x91, 0x9A, 0xE9, 0x71,
+    0x9F, 0xFC, 0x97, 0x2A, 0xFF, 0x97, 0x4F, 0xDA, 0x77, 0xAC, 0xAA, 0x77, 0x73, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x76, 0x9F, 0xFD, 0x76, 0xAF, 0xFD, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9,
+    0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F,
+    0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F,
+    0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9,
+    0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x69, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA7, 0x1F, 0xFD, 0x97, 0x0F, 0xFD, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x29, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49,
+    0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4,
+    0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE,
+    0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC,
+    0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95, 0x74, 0x97, 0x77, 0xD9, 0x5C, 0x76, 0x9E, 0x39, 0xD7,
+    0x69, 0xFA, 0xAE, 0x97, 0x7F, 0xFA, 0x77, 0x1A, 0xFC, 0x97, 0x75, 0x97, 0x77, 0x77, 0x73, 0x99,
+    0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70,
+    0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74,
+    0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97,
+    0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A,
+    0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF,
+    0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0, 0x79, 0x97, 0x70, 0xAD, 0x5C, 0x97, 0x0E, 0xA2,
+    0xAD, 0x71, 0xFF, 0xCA, 0x72, 0xFE, 0xA7, 0x4A, 0xEA, 0x97, 0x77, 0x77, 0x74, 0x9A, 0xA9, 0x29,
+    0x99, 0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3,
+    0xAF, 0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA,
+    0x4F, 0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD,
+    0xA9, 0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96,
+    0x99, 0x69, 0x50, 0x77, 0x09, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F,
+    0xD9, 0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA,
+    0x1F, 0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7,
+    0x3F, 0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF,
+    0xA9, 0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x77, 0x2A, 0xD9,
+    0x77, 0x4E, 0x77, 0x5E, 0x77, 0x59, 0xE7, 0x75, 0x9F, 0xAA, 0xA7, 0x72, 0xFD, 0xA7, 0x73, 0xAE,
+    0xA3, 0x79, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49,
+    0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4,
+    0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE,
+    0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC,
+    0xA3, 0xAF, 0xA3, 0xAE, 0xA6, 0x99, 0x6A, 0xCA, 0x77, 0xAD, 0x77, 0x0D, 0x97, 0x7A, 0xD7, 0x70,
+    0xAE, 0x99, 0x97, 0x49, 0xFC, 0x97, 0x5A, 0xEA, 0x20, 0x77, 0x77, 0x5A, 0x97, 0x70, 0x9E, 0x77,
+    0xAF, 0x75, 0x9F, 0xD7, 0x4A, 0xFC, 0xA7, 0x49, 0xFA, 0x77, 0xA9, 0x77, 0x77, 0x70, 0x99, 0x99,
+    0x74, 0x9A, 0xFF, 0xA9, 0x7F, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x4A, 0xFD, 0xA9, 0x19, 0xF3, 0x9F,
+    0xC9, 0x5A, 0xE3, 0xFC, 0x7A, 0xDA, 0x2F, 0xC9, 0x7E, 0x29, 0xFA, 0x70, 0x99, 0x3F, 0xC9, 0x76,
+    0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xFA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x6F, 0xD7,
+    0x6A, 0xFC, 0x72, 0xA2, 0xAF, 0xD7, 0x9D, 0x3F, 0xE9, 0x39, 0xAE, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF,
+    0xE6, 0xFF, 0xFA, 0x70, 0x9F, 0xFA, 0x76, 0x99, 0x97, 0x10, 0x77, 0x75, 0xAA, 0x75, 0x9E, 0x74,
+    0xF7, 0x3A, 0xF7, 0x3F, 0x73, 0xF7, 0x4E, 0x75, 0xAA, 0x77, 0x77, 0x77, 0x9A, 0xA9, 0x72, 0xFE,
+    0x79, 0xFF, 0xA5, 0xAF, 0xFC, 0xA4, 0x9F, 0x91, 0xAD, 0x5F, 0x94, 0x94, 0xAF, 0x73, 0xF9, 0x72,
+    0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFC, 0x5A, 0x4F, 0xC3, 0x9D, 0x93, 0xFD, 0xAA,
+    0xF9, 0x39, 0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39, 0x97, 0x10, 0x74, 0x9A, 0xC7, 0x70,
+    0x9F, 0x76, 0x9F, 0xD7, 0x4A, 0xEA, 0xF7, 0x2A, 0xE9, 0x09, 0xE9, 0x70, 0xF9, 0x29, 0xDA, 0x70,
+    0x9A, 0xA5, 0x99, 0x77, 0x77, 0x29, 0x99, 0x97, 0x49, 0xAF, 0xFA, 0x97, 0xFF, 0xFC, 0x94, 0x9F,
+    0xFF, 0xD4, 0xAF, 0xDA, 0x91, 0x9F, 0x39, 0xFC, 0x95, 0xAE, 0x3F, 0xC7, 0xAD, 0xA2, 0xFC, 0x97,
+    0xE2, 0x9F, 0xA7, 0x09, 0x93, 0xFC, 0x97, 0x6F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0xA7, 0x6F, 0xCA,
+    0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFD, 0x76, 0xAF, 0xC7, 0x2A, 0x2A, 0xFD, 0x79, 0xD3, 0xFE,
+    0x93, 0x9A, 0xE3, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x6F, 0xFF, 0xA7, 0x09, 0xFF, 0xA7, 0x69, 0x99,
+    0x71, 0x77, 0x71, 0xAD, 0x73, 0xFC, 0x71, 0xFD, 0x97, 0xAE, 0xAE, 0x69, 0xE1, 0xE9, 0x49, 0xE2,
+    0x9D, 0xA4, 0xE4, 0xD9, 0x77, 0x77, 0x70, 0x9A, 0xA9, 0x71, 0xFE, 0x69, 0xFF, 0xA4, 0xAF, 0xFC,
+    0xA3, 0x9F, 0x91, 0xAD, 0x4F, 0x94, 0x93, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFA,
+    0x72, 0xFA, 0x72, 0xFC, 0x5A, 0x3F, 0xC3, 0x9D, 0x92, 0xFD, 0xAA, 0xF9, 0x29, 0xFF, 0xE4, 0xFF,
+    0xCA, 0x6A, 0xFC, 0xA7, 0x29, 0x97, 0x00, 0x77, 0x77, 0x1A, 0xD7, 0x70, 0xFA, 0x76, 0x9F, 0xA7,
+    0x69, 0xF7, 0x70, 0xE9, 0x77, 0x77, 0x77, 0x72, 0x99, 0x99, 0x74, 0x9A, 0xFF, 0xA9, 0x7F, 0xFF,
+    0xC9, 0x49, 0xFF, 0xFD, 0x4A, 0xFD, 0xA9, 0x19, 0xF3, 0x9F, 0xC9, 0x5A, 0xE3, 0xFC, 0x7A, 0xDA,
+    0x2F, 0xC9, 0x7E, 0x29, 0xFA, 0x70, 0x99, 0x3F, 0xC9, 0x76, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xFA,
+    0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x6F, 0xD7, 0x6A, 0xFC, 0x72, 0xA2, 0xAF, 0xD7,
+    0x9D, 0x3F, 0xE9, 0x39, 0xAE, 0x3F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE6, 0xFF, 0xFA, 0x70, 0x9F, 0xFA,
+    0x76, 0x99, 0x97, 0x10, 0x71, 0xAA, 0x97, 0x2F, 0x97, 0x09, 0xF9, 0x70, 0xAF, 0x71, 0x9E, 0x97,
+    0x39, 0x77, 0x77, 0x72, 0x9A, 0xA9, 0x70, 0xFE, 0x59, 0xFF, 0xA3, 0xAF, 0xFC, 0xA2, 0x9F, 0x91,
+    0xAD, 0x3F, 0x94, 0x92, 0xAF, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xFA, 0x71,
+    0xFC, 0x5A, 0x2F, 0xC3, 0x9D, 0x91, 0xFD, 0xAA, 0xF9, 0x19, 0xFF, 0xE3, 0xFF, 0xCA, 0x5A, 0xFC,
+    0xA7, 0x19, 0x97, 0x70, 0xAA, 0x59, 0xCA, 0x70, 0xAD, 0xA3, 0xAE, 0x97, 0x9E, 0x91, 0xF7, 0x2A,
+    0xE9, 0xF7, 0x4F, 0xE7, 0x6F, 0xC7, 0x70, 0xDA, 0x77, 0x77, 0x69, 0x99, 0x97, 0x49, 0xAF, 0xFA,
+    0x97, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xD4, 0xAF, 0xDA, 0x91, 0x9F, 0x39, 0xFC, 0x95, 0xAE, 0x3F,
+    0xC7, 0xAD, 0xA2, 0xFC, 0x97, 0xE2, 0x9F, 0xA7, 0x09, 0x93, 0xFC, 0x97, 0x6F, 0xC7, 0x69, 0xFA,
+    0x76, 0xAF, 0xA7, 0x6F, 0xCA, 0x76, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFD, 0x76, 0xAF, 0xC7, 0x2A,
+    0x2A, 0xFD, 0x79, 0xD3, 0xFE, 0x93, 0x9A, 0xE3, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x6F, 0xFF, 0xA7,
+    0x09, 0xFF, 0xA7, 0x69, 0x99, 0x71, 0x69, 0x59, 0xA7, 0xDA, 0x3A, 0xDA, 0x6E, 0x2A, 0xDA, 0x7A,
+    0xE0, 0xAE, 0x71, 0xFE, 0x72, 0xAF, 0xC7, 0x4F, 0x97, 0x49, 0xD9, 0x77, 0x77, 0x77, 0x29, 0xAA,
+    0x97, 0x3F, 0xE7, 0x09, 0xFF, 0xA6, 0xAF, 0xFC, 0xA5, 0x9F, 0x91, 0xAD, 0x6F, 0x94, 0x95, 0xAF,
+    0x74, 0xF9, 0x73, 0x9F, 0x74, 0xAF, 0x74, 0xFA, 0x74, 0xFA, 0x74, 0xFC, 0x5A, 0x5F, 0xC3, 0x9D,
+    0x94, 0xFD, 0xAA, 0xF9, 0x49, 0xFF, 0xE6, 0xFF, 0xCA, 0x70, 0xAF, 0xCA, 0x74, 0x99, 0x72, 0x72,
+    0x9A, 0x95, 0xAC, 0x97, 0x5E, 0x4E, 0xA7, 0x5A, 0xE1, 0x9E, 0xA7, 0x7F, 0x9E, 0x97, 0x70, 0x9F,
+    0xD9, 0x77, 0x2A, 0xF9, 0x77, 0x4A, 0xD9, 0x77, 0x77, 0x73, 0x99, 0x99, 0x99, 0x97, 0x6A, 0xFF,
+    0xF9, 0x71, 0x9F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFF, 0xCA, 0x69, 0xA9, 0x9F, 0xA1, 0x9A, 0xFD, 0x97,
+    0x09, 0xF9, 0x39, 0xFD, 0x70, 0xAF, 0x6F, 0xC9, 0x7F, 0xC6, 0xAF, 0xC7, 0xFC, 0x69, 0xFC, 0x69,
+    0xFA, 0x7F, 0xC6, 0x9F, 0x97, 0xFC, 0x6A, 0xF7, 0x0F, 0xC6, 0xFC, 0x70, 0xFC, 0x6F, 0xC7, 0x9F,
+    0xC5, 0x9F, 0xA7, 0xAF, 0xA5, 0xAF, 0x97, 0xFC, 0x95, 0xAF, 0x79, 0xFC, 0x6F, 0xC7, 0xFC, 0x96,
+    0xFC, 0x6F, 0xCA, 0x69, 0xFA, 0x49, 0xFD, 0x7A, 0xFA, 0x99, 0x9A, 0xFE, 0x69, 0xFF, 0xFF, 0xA6,
+    0xAF, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x76, 0x99, 0x93, 0x99, 0x74, 0xAF,
+    0xD1, 0x9D, 0xA7, 0x2A, 0xFE, 0x1A, 0xDA, 0x72, 0xAF, 0xE1, 0xE9, 0x75, 0xAF, 0x1E, 0x76, 0xFA,
+    0x09, 0xD9, 0x76, 0xF9, 0x0A, 0xD7, 0x7F, 0x1A, 0xC9, 0x71, 0x9A, 0xA9, 0x09, 0xF2, 0x97, 0x09,
+    0xFD, 0xAE, 0xA7, 0x3A, 0xFF, 0xE9, 0x72, 0xAF, 0xCA, 0xFD, 0x72, 0x9F, 0xA2, 0xAF, 0x72, 0xFA,
+    0x3A, 0xEA, 0x71, 0xAF, 0x4F, 0x97, 0x1F, 0xA4, 0xF7, 0x19, 0xF4, 0x9F, 0x71, 0xAF, 0x4F, 0xA7,
+    0x1F, 0xA3, 0x9F, 0xA7, 0x1F, 0xA3, 0xFC, 0x97, 0x1F, 0xA2, 0xAF, 0xC7, 0x2F, 0xA1, 0xAD, 0xAE,
+    0x1A, 0xC6, 0xFC, 0x9A, 0xDA, 0x9F, 0xE6, 0xAF, 0xEA, 0x09, 0xFD, 0xA6, 0x9F, 0xDA, 0x19, 0xFC,
+    0xA7, 0x0A, 0xFA, 0x3F, 0x97, 0x39, 0x96, 0x97, 0x20, 0x71, 0x99, 0x99, 0x99, 0x97, 0x6A, 0xFF,
+    0xF9, 0x71, 0x9F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFF, 0xCA, 0x69, 0xA9, 0x9F, 0xA1, 0x9A, 0xFD, 0x97,
+    0x09, 0xF9, 0x39, 0xFD, 0x70, 0xAF, 0x6F, 0xC9, 0x7F, 0xC6, 0xAF, 0xC7, 0xFC, 0x69, 0xFC, 0x69,
+    0xFA, 0x7F, 0xC6, 0x9F, 0x97, 0xFC, 0x3A, 0xAA, 0xFC, 0xAA, 0xAA, 0x93, 0xFC, 0x2A, 0xFF, 0xFA,
+    0x3F, 0xC2, 0xAA, 0xAF, 0xDA, 0xAA, 0xA3, 0x9F, 0xC5, 0x9F, 0xA7, 0xAF, 0xA5, 0xAF, 0x97, 0xFC,
+    0x95, 0xFC, 0x79, 0xFC, 0x6F, 0xC7, 0xFC, 0x96, 0xFC, 0x6F, 0xCA, 0x69, 0xFA, 0x49, 0xFD, 0x7A,
+    0xFA, 0x99, 0x9A, 0xFE, 0x69, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0xA9, 0x77,
+    0x77, 0x30, 0x76, 0x99, 0x97, 0x7A, 0xFD, 0x75, 0xAF, 0xE7, 0x5A, 0xAA, 0xFC, 0x77, 0x0A, 0xEA,
+    0x74, 0xAA, 0xAA, 0xFC, 0xAA, 0x72, 0xFF, 0xE7, 0x2A, 0xAA, 0xAF, 0xAA, 0x97, 0x59, 0xF7, 0x29,
+    0xF9, 0xAE, 0xA7, 0x1F, 0xFE, 0x97, 0x9F, 0xFF, 0x70, 0xFC, 0x2F, 0xC7, 0xFC, 0x3A, 0xEA, 0x69,
+    0xF4, 0xF9, 0x6F, 0xA4, 0xF7, 0xF9, 0x39, 0xF6, 0xAF, 0x4F, 0xA6, 0xFC, 0x39, 0xF9, 0x6F, 0xA3,
+    0xFC, 0x96, 0xFA, 0x2A, 0xFC, 0x7F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC3, 0xFC, 0x9A, 0xDA, 0x9F, 0xE3,
+    0xAF, 0xEA, 0x09, 0xFD, 0xA3, 0x9F, 0xDA, 0x19, 0xFC, 0xA5, 0xAF, 0xA3, 0xF9, 0x70, 0x99, 0x69,
+    0x70, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x74, 0xFF, 0xD7, 0x39, 0xFF, 0xD7, 0x4A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF,
+    0xF7, 0x0F, 0xA2, 0x99, 0xAE, 0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70,
+    0xFC, 0x77, 0x09, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF,
+    0xF7, 0x19, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E,
+    0x69, 0xF9, 0x5E, 0xA6, 0xAF, 0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF,
+    0xFF, 0xC9, 0x30, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFF, 0xD5, 0x9F, 0xFC, 0xA6, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x77, 0x77, 0x49, 0xAA, 0x97, 0x19, 0xFE, 0x7A, 0xFF, 0xA5, 0xAE, 0xA9, 0xAF,
+    0x49, 0xE9, 0x2F, 0x4E, 0xA2, 0x9E, 0xA3, 0xAE, 0x3F, 0x4E, 0xA2, 0xAE, 0x93, 0x9E, 0x90, 0x9F,
+    0x94, 0xAE, 0xAF, 0xC9, 0x5F, 0xFA, 0x7F, 0xD9, 0x71, 0xF9, 0x5A, 0x93, 0xF9, 0x39, 0xE3, 0xFC,
+    0x99, 0x9F, 0xA3, 0x9F, 0xFE, 0x5F, 0xFC, 0xA7, 0xAF, 0xCA, 0x73, 0x99, 0x71, 0x77, 0x77, 0x1A,
+    0xCA, 0x5C, 0x74, 0xE3, 0x9D, 0x74, 0xFA, 0xAE, 0xA7, 0x4A, 0xFE, 0xA7, 0x6A, 0xFC, 0x97, 0x72,
+    0x97, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2,
+    0x99, 0xAE, 0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09,
+    0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA,
+    0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E,
+    0xA6, 0xAF, 0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x30,
+    0x6A, 0x69, 0x6D, 0xA4, 0x9C, 0x59, 0xE9, 0x2A, 0xD6, 0xFF, 0xC9, 0x69, 0xFE, 0x97, 0x1A, 0xEA,
+    0x77, 0x77, 0x76, 0x9A, 0xA9, 0x71, 0x9F, 0xE7, 0xAF, 0xFA, 0x5A, 0xEA, 0x9A, 0xF4, 0x9E, 0x92,
+    0xF4, 0xEA, 0x29, 0xEA, 0x3A, 0xE3, 0xF4, 0xEA, 0x2A, 0xE9, 0x39, 0xE9, 0x09, 0xF9, 0x4A, 0xEA,
+    0xFC, 0x95, 0xFF, 0xA7, 0xFD, 0x97, 0x1F, 0x95, 0xA9, 0x3F, 0x93, 0x9E, 0x3F, 0xC9, 0x99, 0xFA,
+    0x39, 0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39, 0x97, 0x10, 0x77, 0x77, 0x5E, 0x77, 0x2F,
+    0x97, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x19, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFF, 0xFF,
+    0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A,
+    0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF,
+    0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77,
+    0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F,
+    0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x71, 0xAA, 0x97, 0x2F, 0x97, 0x09, 0xF9,
+    0x70, 0xAF, 0x71, 0x9E, 0x97, 0x39, 0x77, 0x77, 0x72, 0x9A, 0xA9, 0x79, 0xFE, 0x5A, 0xFF, 0xA3,
+    0xAE, 0xA9, 0xAF, 0x29, 0xE9, 0x2F, 0x2E, 0xA2, 0x9E, 0xA1, 0xAE, 0x3F, 0x2E, 0xA2, 0xAE, 0x91,
+    0x9E, 0x90, 0x9F, 0x92, 0xAE, 0xAF, 0xC9, 0x3F, 0xFA, 0x5F, 0xD9, 0x7F, 0x95, 0xA9, 0x1F, 0x93,
+    0x9E, 0x1F, 0xC9, 0x99, 0xFA, 0x19, 0xFF, 0xE3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x5F,
+    0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2, 0x99, 0xAE, 0x79, 0xF9, 0x49,
+    0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x09, 0xF9, 0x77,
+    0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0F,
+    0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E, 0xA6, 0xAF, 0x93, 0x9A, 0xE9,
+    0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x77,
+    0x2A, 0xD9, 0x77, 0x2E, 0x77, 0x3F, 0xAA, 0xA7, 0x7A, 0xFC, 0xA7, 0x70, 0xAE, 0xA4, 0x70, 0x9A,
+    0xA9, 0x79, 0xFE, 0x5A, 0xFF, 0xA3, 0xAE, 0xA9, 0xAF, 0x29, 0xE9, 0x2F, 0x2E, 0xA2, 0x9E, 0xA1,
+    0xAE, 0x3F, 0x2E, 0xA2, 0xAE, 0x91, 0x9E, 0x90, 0x9F, 0x92, 0xAE, 0xAF, 0xC9, 0x3F, 0xFA, 0x5F,
+    0xD9, 0x7F, 0x95, 0xA9, 0x1F, 0x93, 0x9E, 0x1F, 0xC9, 0x99, 0xFA, 0x19, 0xFF, 0xE3, 0xFF, 0xCA,
+    0x5A, 0xFD, 0xA7, 0x09, 0x9D, 0x97, 0x2A, 0xCA, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xEA, 0x99, 0x97,
+    0xAF, 0xC9, 0x70, 0xAE, 0x93, 0x72, 0xAA, 0x59, 0xCA, 0x72, 0xE9, 0x3F, 0x72, 0x9E, 0x2F, 0x74,
+    0xF9, 0xEA, 0x76, 0xFD, 0xA7, 0x79, 0xFA, 0x77, 0x19, 0xDA, 0x77, 0x77, 0x77, 0x71, 0xFF, 0xFF,
+    0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A,
+    0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF,
+    0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77,
+    0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F,
+    0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x69, 0x59, 0xA7, 0xDA, 0x3A, 0xDA, 0x6E,
+    0x2A, 0xDA, 0x7A, 0xE0, 0xAE, 0x71, 0xFE, 0x72, 0xAF, 0xC7, 0x4F, 0x97, 0x49, 0xD9, 0x77, 0x77,
+    0x77, 0x29, 0xAA, 0x97, 0x29, 0xFE, 0x70, 0xAF, 0xFA, 0x6A, 0xEA, 0x9A, 0xF5, 0x9E, 0x92, 0xF5,
+    0xEA, 0x29, 0xEA, 0x4A, 0xE3, 0xF5, 0xEA, 0x2A, 0xE9, 0x49, 0xE9, 0x09, 0xF9, 0x5A, 0xEA, 0xFC,
+    0x96, 0xFF, 0xA7, 0x0F, 0xD9, 0x72, 0xF9, 0x5A, 0x94, 0xF9, 0x39, 0xE4, 0xFC, 0x99, 0x9F, 0xA4,
+    0x9F, 0xFE, 0x6F, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7, 0x49, 0x97, 0x20, 0x75, 0xAC, 0xA7, 0x71, 0xFA,
+    0x77, 0xFD, 0xA7, 0x5F, 0xAE, 0x97, 0x29, 0xF1, 0xAE, 0x71, 0x9F, 0x3E, 0x72, 0xAA, 0x95, 0xA9,
+    0x77, 0x77, 0x39, 0x99, 0x99, 0x74, 0x9A, 0xFF, 0xCA, 0x97, 0xAF, 0xFF, 0xC9, 0x49, 0xFF, 0xFE,
+    0x4A, 0xFD, 0x93, 0x9F, 0x39, 0xFC, 0x96, 0xAE, 0x3F, 0xC7, 0x0E, 0xA2, 0xFC, 0x97, 0x0E, 0x29,
+    0xFC, 0x71, 0x99, 0x3F, 0xC9, 0x77, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xFA, 0x77, 0xFC, 0xA5, 0xFF,
+    0xCA, 0xFC, 0xA5, 0xFF, 0xC9, 0xFC, 0xA5, 0xAF, 0xEA, 0x0F, 0xD7, 0x0F, 0xC1, 0xAF, 0xC7, 0x0F,
+    0xA1, 0x9F, 0xCA, 0x7F, 0x92, 0xFD, 0xA5, 0x9F, 0x39, 0xFE, 0xA9, 0x99, 0x9F, 0xC4, 0xAF, 0xFF,
+    0xF5, 0x9F, 0xFF, 0xD9, 0x7A, 0xFF, 0xCA, 0x97, 0x59, 0x99, 0x71, 0x77, 0x77, 0x5A, 0xD9, 0x77,
+    0x1F, 0xC7, 0x70, 0xAF, 0xC9, 0x76, 0xAE, 0xAE, 0x75, 0x9E, 0x1E, 0x97, 0x39, 0xE2, 0x9D, 0xA7,
+    0x3E, 0x93, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x29, 0xAA, 0xA9, 0x97, 0x6F, 0xFF, 0xC9, 0x69, 0xFF,
+    0xFD, 0x69, 0xFA, 0x1A, 0xEA, 0xAA, 0x96, 0xFA, 0x29, 0xF7, 0x1F, 0x4F, 0x70, 0x9F, 0x39, 0xF7,
+    0x09, 0xEA, 0x3F, 0xA7, 0x1F, 0x29, 0xF7, 0x2F, 0xA9, 0xAF, 0x97, 0x3F, 0xFC, 0x76, 0xAF, 0xA9,
+    0x76, 0xAE, 0xA7, 0x70, 0xAE, 0x97, 0x71, 0xFC, 0x97, 0x70, 0xAF, 0xDA, 0x74, 0x9F, 0xFD, 0xA7,
+    0x09, 0xFC, 0xAF, 0xF9, 0x59, 0xF9, 0x3A, 0xFD, 0x5F, 0x7F, 0xC9, 0x4F, 0x70, 0xF5, 0xF9, 0x6A,
+    0xF5, 0xFC, 0xA9, 0x19, 0x9F, 0xC9, 0x59, 0xFF, 0xFD, 0x97, 0x0F, 0xFE, 0xA7, 0x49, 0xAE, 0xAA,
+    0x97, 0x10, 0x72, 0x97, 0x73, 0xD9, 0x49, 0xC7, 0x29, 0xE3, 0xAD, 0x72, 0x9F, 0xAA, 0xE9, 0x73,
+    0xFF, 0x97, 0x5A, 0xFC, 0x97, 0x71, 0x97, 0x77, 0x77, 0x09, 0x99, 0x99, 0x74, 0x9A, 0xFF, 0xCA,
+    0x97, 0xAF, 0xFF, 0xC9, 0x49, 0xFF, 0xFE, 0x4A, 0xFD, 0x93, 0x9F, 0x39, 0xFC, 0x96, 0xAE, 0x3F,
+    0xC7, 0x0E, 0xA2, 0xFC, 0x97, 0x0E, 0x29, 0xFC, 0x71, 0x99, 0x3F, 0xC9, 0x77, 0xFC, 0x77, 0x9F,
+    0xA7, 0x7A, 0xFA, 0x77, 0xFC, 0xA5, 0xFF, 0xCA, 0xFC, 0xA5, 0xFF, 0xC9, 0xFC, 0xA5, 0xAF, 0xEA,
+    0x0F, 0xD7, 0x0F, 0xC1, 0xAF, 0xC7, 0x0F, 0xA1, 0x9F, 0xCA, 0x7F, 0x92, 0xFD, 0xA5, 0x9F, 0x39,
+    0xFE, 0xA9, 0x99, 0x9F, 0xC4, 0xAF, 0xFF, 0xF5, 0x9F, 0xFF, 0xD9, 0x7A, 0xFF, 0xCA, 0x97, 0x59,
+    0x99, 0x71, 0x73, 0xA6, 0x97, 0x4D, 0xA4, 0x9C, 0x74, 0xE9, 0x2A, 0xD7, 0x4F, 0xFC, 0x97, 0x49,
+    0xFE, 0x97, 0x7A, 0xEA, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0x99, 0x76, 0xFF, 0xFC, 0x96, 0x9F,
+    0xFF, 0xD6, 0x9F, 0xA1, 0xAE, 0xAA, 0xA9, 0x6F, 0xA2, 0x9F, 0x71, 0xF4, 0xF7, 0x09, 0xF3, 0x9F,
+    0x70, 0x9E, 0xA3, 0xFA, 0x71, 0xF2, 0x9F, 0x72, 0xFA, 0x9A, 0xF9, 0x73, 0xFF, 0xC7, 0x6A, 0xFA,
+    0x97, 0x6A, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x1F, 0xC9, 0x77, 0x0A, 0xFD, 0xA7, 0x49, 0xFF, 0xDA,
+    0x70, 0x9F, 0xCA, 0xFF, 0x95, 0x9F, 0x93, 0xAF, 0xD5, 0xF7, 0xFC, 0x94, 0xF7, 0x0F, 0x5F, 0x96,
+    0xAF, 0x5F, 0xCA, 0x91, 0x99, 0xFC, 0x95, 0x9F, 0xFF, 0xD9, 0x70, 0xFF, 0xEA, 0x74, 0x9A, 0xEA,
+    0xA9, 0x71, 0x77, 0x77, 0x29, 0xDA, 0x77, 0x09, 0xF7, 0x70, 0xFC, 0x77, 0x0F, 0xA7, 0x70, 0xAD,
+    0xA7, 0x77, 0x77, 0x77, 0x59, 0x99, 0x99, 0x74, 0x9A, 0xFF, 0xCA, 0x97, 0xAF, 0xFF, 0xC9, 0x49,
+    0xFF, 0xFE, 0x4A, 0xFD, 0x93, 0x9F, 0x39, 0xFC, 0x96, 0xAE, 0x3F, 0xC7, 0x0E, 0xA2, 0xFC, 0x97,
+    0x0E, 0x29, 0xFC, 0x71, 0x99, 0x3F, 0xC9, 0x77, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xFA, 0x77, 0xFC,
+    0xA5, 0xFF, 0xCA, 0xFC, 0xA5, 0xFF, 0xC9, 0xFC, 0xA5, 0xAF, 0xEA, 0x0F, 0xD7, 0x0F, 0xC1, 0xAF,
+    0xC7, 0x0F, 0xA1, 0x9F, 0xCA, 0x7F, 0x92, 0xFD, 0xA5, 0x9F, 0x39, 0xFE, 0xA9, 0x99, 0x9F, 0xC4,
+    0xAF, 0xFF, 0xF5, 0x9F, 0xFF, 0xD9, 0x7A, 0xFF, 0xCA, 0x97, 0x59, 0x99, 0x71, 0x76, 0xAA, 0xA7,
+    0x72, 0xF9, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xF7, 0x71, 0x9E, 0x97, 0x73, 0x97, 0x77, 0x77, 0x77,
+    0x79, 0xAA, 0xA9, 0x97, 0x6F, 0xFF, 0xC9, 0x69, 0xFF, 0xFD, 0x69, 0xFA, 0x1A, 0xEA, 0xAA, 0x96,
+    0xFA, 0x29, 0xF7, 0x1F, 0x4F, 0x70, 0x9F, 0x39, 0xF7, 0x09, 0xEA, 0x3F, 0xA7, 0x1F, 0x29, 0xF7,
+    0x2F, 0xA9, 0xAF, 0x97, 0x3F, 0xFC, 0x76, 0xAF, 0xA9, 0x76, 0xAE, 0xA7, 0x70, 0xAE, 0x97, 0x71,
+    0xFC, 0x97, 0x70, 0xAF, 0xDA, 0x74, 0x9F, 0xFD, 0xA7, 0x09, 0xFC, 0xAF, 0xF9, 0x59, 0xF9, 0x3A,
+    0xFD, 0x5F, 0x7F, 0xC9, 0x4F, 0x70, 0xF5, 0xF9, 0x6A, 0xF5, 0xFC, 0xA9, 0x19, 0x9F, 0xC9, 0x59,
+    0xFF, 0xFD, 0x97, 0x0F, 0xFE, 0xA7, 0x49, 0xAE, 0xAA, 0x97, 0x10, 0x73, 0x99, 0x99, 0x97, 0x49,
+    0xAF, 0xFC, 0xA9, 0x7A, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xE4, 0xAF, 0xD9, 0x39, 0xF3, 0x9F, 0xC9,
+    0x6A, 0xE3, 0xFC, 0x70, 0xEA, 0x2F, 0xC9, 0x70, 0xE2, 0x9F, 0xC7, 0x19, 0x93, 0xFC, 0x97, 0x7F,
+    0xC7, 0x79, 0xFA, 0x77, 0xAF, 0xA7, 0x7F, 0xCA, 0x5F, 0xFC, 0xAF, 0xCA, 0x5F, 0xFC, 0x9F, 0xCA,
+    0x5A, 0xFE, 0xA0, 0xFD, 0x70, 0xFC, 0x1A, 0xFC, 0x70, 0xFA, 0x19, 0xFC, 0xA7, 0xF9, 0x2F, 0xDA,
+    0x59, 0xF3, 0x9F, 0xEA, 0x99, 0x99, 0xFC, 0x4A, 0xFF, 0xFF, 0x59, 0xFF, 0xFD, 0x97, 0xAF, 0xFC,
+    0xA9, 0x75, 0x99, 0x97, 0x72, 0x99, 0x77, 0x2F, 0x77, 0x1F, 0x97, 0x70, 0xAE, 0x77, 0x1A, 0xE7,
+    0x70, 0x9E, 0x77, 0x09, 0xE7, 0x71, 0x9A, 0x97, 0x40, 0x77, 0x77, 0x6A, 0xD7, 0x72, 0xAD, 0x77,
+    0x2A, 0xD9, 0x77, 0x2E, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0xA7, 0x72, 0xF7, 0x72, 0xF9, 0x77, 0x2A,
+    0xA7, 0x77, 0x77, 0x09, 0xAA, 0xA9, 0x97, 0x6F, 0xFF, 0xC9, 0x69, 0xFF, 0xFD, 0x69, 0xFA, 0x1A,
+    0xEA, 0xAA, 0x96, 0xFA, 0x29, 0xF7, 0x1F, 0x4F, 0x70, 0x9F, 0x39, 0xF7, 0x09, 0xEA, 0x3F, 0xA7,
+    0x1F, 0x29, 0xF7, 0x2F, 0xA9, 0xAF, 0x97, 0x3F, 0xFC, 0x76, 0xAF, 0xA9, 0x76, 0xAE, 0xA7, 0x70,
+    0xAE, 0x97, 0x71, 0xFC, 0x97, 0x70, 0xAF, 0xDA, 0x74, 0x9F, 0xFD, 0xA7, 0x09, 0xFC, 0xAF, 0xF9,
+    0x59, 0xF9, 0x3A, 0xFD, 0x5F, 0x7F, 0xC9, 0x4F, 0x70, 0xF5, 0xF9, 0x6A, 0xF5, 0xFC, 0xA9, 0x19,
+    0x9F, 0xC9, 0x59, 0xFF, 0xFD, 0x97, 0x0F, 0xFE, 0xA7, 0x49, 0xAE, 0xAA, 0x97, 0x10, 0x77, 0x1A,
+    0xCA, 0x77, 0x71, 0xFA, 0x77, 0x7F, 0xDA, 0x77, 0x5F, 0xAE, 0x97, 0x72, 0x9F, 0x1A, 0xE7, 0x71,
+    0x9F, 0x3E, 0x77, 0x2A, 0xA9, 0x5A, 0x97, 0x77, 0x77, 0x77, 0x77, 0xFF, 0xD2, 0xAF, 0xFC, 0x94,
+    0xAF, 0xFC, 0xA2, 0xFF, 0xD5, 0x9F, 0xFA, 0x3A, 0xFE, 0xA9, 0x70, 0xFC, 0x7A, 0xF9, 0x71, 0x9F,
+    0xA7, 0xFC, 0x72, 0xAF, 0x97, 0xFC, 0x72, 0xFC, 0x79, 0xFA, 0x72, 0xFC, 0x7A, 0xF9, 0x71, 0x9F,
+    0xA7, 0xAF, 0x72, 0x9F, 0xA7, 0xFC, 0x72, 0xAF, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0xDA, 0x72, 0xFF,
+    0xFF, 0xD9, 0x71, 0x9F, 0xA7, 0xFC, 0x72, 0xAF, 0x97, 0xFC, 0x72, 0xFC, 0x70, 0xFA, 0x72, 0xFC,
+    0x79, 0xF9, 0x72, 0xFC, 0x7A, 0xF9, 0x71, 0x9F, 0xA7, 0xFC, 0x72, 0xAF, 0x97, 0xFC, 0x70, 0x9F,
+    0xEA, 0x93, 0xAF, 0xEA, 0x5A, 0xFF, 0xCA, 0x2F, 0xFD, 0x5F, 0xFD, 0x91, 0x9F, 0xFD, 0x40, 0x7A,
+    0xAC, 0x97, 0x5A, 0xF7, 0x4A, 0xFD, 0x72, 0xAE, 0xAE, 0xA7, 0x0A, 0xE1, 0x9E, 0x7F, 0x3A, 0xD7,
+    0x9A, 0x95, 0xA9, 0x77, 0x75, 0x99, 0x97, 0x4A, 0xFD, 0x72, 0xAF, 0xE9, 0x71, 0xAF, 0xE7, 0x5A,
+    0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x5A, 0xF3, 0xAA, 0x96, 0xF9, 0x1F, 0xD5, 0xF0, 0x9F,
+    0xE5, 0xF9, 0xFF, 0x93, 0x9E, 0xAE, 0x90, 0xF9, 0x3A, 0xFD, 0x2F, 0x4F, 0xD2, 0x9F, 0x4F, 0xC9,
+    0x2A, 0xEA, 0x39, 0xFC, 0x3F, 0x93, 0xAF, 0x93, 0xF4, 0xFC, 0x39, 0xF4, 0xFA, 0x3A, 0xEA, 0x39,
+    0xF9, 0x3F, 0x93, 0x9F, 0x4F, 0x1A, 0x90, 0xAF, 0x39, 0xFA, 0xE0, 0xFA, 0x3A, 0xFE, 0xA0, 0xF9,
+    0x39, 0xFD, 0xA0, 0x9F, 0x5F, 0xC9, 0x75, 0x99, 0x40, 0x5F, 0xFD, 0x2A, 0xFF, 0xC9, 0x4A, 0xFF,
+    0xCA, 0x2F, 0xFD, 0x59, 0xFF, 0xA3, 0xAF, 0xEA, 0x97, 0x0F, 0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7F,
+    0xC7, 0xAF, 0xFF, 0xFF, 0xEA, 0x4F, 0xFF, 0xFF, 0xFC, 0x49, 0x99, 0xFC, 0x99, 0x99, 0x99, 0x99,
+    0xAF, 0xA9, 0x99, 0x69, 0xFA, 0x7A, 0xF7, 0x29, 0xFA, 0x7F, 0xC7, 0x2A, 0xFF, 0xFF, 0xD7, 0x2F,
+    0xFF, 0xFD, 0xA7, 0x2F, 0xFF, 0xFD, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7, 0x2F,
+    0xC7, 0x0F, 0xA7, 0x2F, 0xC7, 0x9F, 0x97, 0x2F, 0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A,
+    0xF9, 0x7F, 0xC7, 0x09, 0xFE, 0xA9, 0x3A, 0xFE, 0xA5, 0xAF, 0xFC, 0xA2, 0xFF, 0xD5, 0xFF, 0xD9,
+    0x19, 0xFF, 0xD4, 0x59, 0x99, 0x74, 0xAF, 0xD7, 0x2A, 0xFE, 0x97, 0x1A, 0xAA, 0xFC, 0x75, 0xAF,
+    0x72, 0xAA, 0xAF, 0xCA, 0xAA, 0x6A, 0xFF, 0xE6, 0x9A, 0xAA, 0xFA, 0xAA, 0x97, 0x1A, 0xF7, 0x5F,
+    0x91, 0x9F, 0x95, 0xF1, 0xFE, 0x49, 0xF0, 0xFF, 0x93, 0x9E, 0xAE, 0xAA, 0xF9, 0x3A, 0xFD, 0x91,
+    0xF4, 0xFD, 0x91, 0x9F, 0x4F, 0xCA, 0x2A, 0xEA, 0x39, 0xFC, 0x3F, 0x93, 0xAF, 0x93, 0xF4, 0xFC,
+    0x39, 0xF4, 0xFA, 0x3A, 0xEA, 0x39, 0xF9, 0x3F, 0x93, 0x9F, 0x4F, 0x1A, 0x90, 0xAF, 0x39, 0xFA,
+    0xE0, 0xFA, 0x3A, 0xFE, 0xA0, 0xF9, 0x39, 0xFD, 0xA0, 0x9F, 0x5F, 0xC9, 0x75, 0x99, 0x40, 0x77,
+    0x70, 0x9E, 0xA2, 0xCA, 0x7F, 0xCA, 0x0A, 0xD6, 0xFF, 0xE6, 0xE0, 0x9F, 0xC9, 0x69, 0xC2, 0x9E,
+    0x77, 0x77, 0x77, 0x76, 0xFF, 0xD6, 0xAF, 0xFD, 0x69, 0xFF, 0xA7, 0x2F, 0xC7, 0x39, 0xFA, 0x73,
+    0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF,
+    0x97, 0x19, 0xAF, 0xDA, 0x96, 0xAF, 0xFD, 0x6F, 0xFD, 0xA5, 0x29, 0xAC, 0xA3, 0xA2, 0x9F, 0xC1,
+    0xDA, 0x1F, 0xFD, 0xA0, 0x9D, 0xA0, 0xFD, 0x2D, 0x2F, 0x71, 0x97, 0x77, 0x71, 0x9A, 0xA6, 0xAF,
+    0xD4, 0xAF, 0xE4, 0xAA, 0xAF, 0xA7, 0xAE, 0x97, 0xF7, 0x9F, 0x7A, 0xEA, 0x7F, 0x97, 0xF7, 0x9F,
+    0x7F, 0xA7, 0xF9, 0x69, 0xF1, 0xA9, 0x39, 0xFA, 0xDA, 0x3A, 0xFE, 0x93, 0xAF, 0xDA, 0x5F, 0xA9,
+    0x79, 0x97, 0x00, 0x69, 0x99, 0x99, 0x99, 0x99, 0x96, 0x9F, 0xFD, 0x6A, 0xFF, 0xCA, 0x69, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xD6, 0xAF, 0xFD, 0x69, 0xFF, 0xA7, 0x2F,
+    0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF,
+    0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7,
+    0x39, 0xFA, 0x73, 0xAF, 0x97, 0x19, 0xAF, 0xDA, 0x96, 0xAF, 0xFD, 0x6F, 0xFD, 0xA5, 0x19, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xD9, 0x1F, 0xFD, 0x29, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x69,
+    0xAA, 0x6A, 0xFD, 0x4A, 0xFE, 0x4A, 0xAA, 0xFA, 0x7A, 0xE9, 0x7F, 0x79, 0xF7, 0xAE, 0xA7, 0xF9,
+    0x7F, 0x79, 0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x1A, 0x93, 0x9F, 0xAD, 0xA3, 0xAF, 0xE9, 0x3A, 0xFD,
+    0xA5, 0xFA, 0x97, 0x99, 0x70, 0x79, 0x76, 0xD9, 0x49, 0xC5, 0x9E, 0x3A, 0xD5, 0x9F, 0xAA, 0xE9,
+    0x6F, 0xF9, 0x70, 0xAF, 0xC9, 0x74, 0x97, 0x77, 0x77, 0x4F, 0xFD, 0x5A, 0xFF, 0xD5, 0x9F, 0xFA,
+    0x71, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7,
+    0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73,
+    0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x70, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x40,
+    0x29, 0x97, 0x1E, 0x49, 0xC9, 0x1E, 0xA2, 0xAD, 0x2F, 0xFC, 0xA3, 0xFE, 0xA5, 0xAE, 0xA9, 0x77,
+    0x77, 0x09, 0xAA, 0x6A, 0xFD, 0x4A, 0xFE, 0x4A, 0xAA, 0xFA, 0x7A, 0xE9, 0x7F, 0x79, 0xF7, 0xAE,
+    0xA7, 0xF9, 0x7F, 0x79, 0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x1A, 0x93, 0x9F, 0xAD, 0xA3, 0xAF, 0xE9,
+    0x3A, 0xFD, 0xA5, 0xFA, 0x97, 0x99, 0x70, 0x5F, 0xFD, 0x5A, 0xFF, 0xD5, 0x9F, 0xFA, 0x71, 0xFC,
+    0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9,
+    0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x72,
+    0x9F, 0xA7, 0x2A, 0xF9, 0x70, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x73, 0x9D, 0x97,
+    0x3A, 0xD7, 0x4A, 0xD9, 0x74, 0xE9, 0x74, 0xFA, 0xAA, 0x71, 0xAF, 0xD7, 0x29, 0xEA, 0x50, 0x76,
+    0x9E, 0x94, 0xFC, 0x3A, 0xFC, 0x3A, 0xF9, 0x39, 0xEA, 0x77, 0x70, 0x9A, 0xA3, 0xAF, 0xD1, 0xAF,
+    0xE1, 0xAA, 0xAF, 0xA4, 0xAE, 0x94, 0xF4, 0x9F, 0x4A, 0xEA, 0x4F, 0x94, 0xF4, 0x9F, 0x4F, 0xA4,
+    0xF9, 0x39, 0xF1, 0xA9, 0x09, 0xFA, 0xDA, 0x0A, 0xFE, 0x90, 0xAF, 0xD9, 0x2F, 0xC5, 0xE5, 0x9D,
+    0x6D, 0x95, 0xAD, 0x6A, 0xE9, 0x99, 0x29, 0xFC, 0x93, 0xAE, 0xA3, 0x77, 0x72, 0x9D, 0xA7, 0x39,
+    0xF7, 0x3F, 0xC7, 0x3F, 0xA7, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xD5, 0xAF, 0xFD, 0x59,
+    0xFF, 0xA7, 0x1F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29,
+    0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F,
+    0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x09, 0xAF, 0xDA, 0x95, 0xAF, 0xFD, 0x5F, 0xFD,
+    0xA4, 0x39, 0xAA, 0x2A, 0xFD, 0x0A, 0xFE, 0x0A, 0xAA, 0xFA, 0x3A, 0xE9, 0x3F, 0x39, 0xF3, 0xAE,
+    0xA3, 0xF9, 0x3F, 0x39, 0xF3, 0xFA, 0x3F, 0x92, 0x9F, 0x1A, 0x99, 0xFA, 0xDA, 0xAF, 0xE9, 0xAF,
+    0xDA, 0x1F, 0xA9, 0x39, 0x94, 0x5F, 0xFD, 0x2F, 0xFD, 0x94, 0xAF, 0xFD, 0x19, 0xFF, 0xD5, 0x9F,
+    0xFA, 0x3A, 0xFE, 0xA9, 0x70, 0xFC, 0x7F, 0xC7, 0x29, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7,
+    0x2F, 0xC7, 0x9F, 0xA7, 0x2F, 0xC7, 0xAF, 0x97, 0x2F, 0xC7, 0xFC, 0x72, 0x9F, 0xA7, 0xFC, 0x72,
+    0xAF, 0x96, 0x9F, 0xA7, 0x2F, 0xC7, 0x9F, 0x97, 0x2F, 0xC7, 0xAF, 0x97, 0x2F, 0xA7, 0xFC, 0x72,
+    0x9F, 0xA7, 0xFC, 0x72, 0xAF, 0x96, 0x9F, 0xA7, 0x2F, 0xC7, 0xAF, 0x97, 0x2F, 0xC7, 0xFC, 0x72,
+    0x9F, 0xA7, 0xFC, 0x72, 0xAF, 0x97, 0xFC, 0x70, 0x9A, 0xFD, 0xA9, 0x49, 0xF9, 0x7A, 0xFF, 0xD4,
+    0xAF, 0x70, 0xFF, 0xDA, 0x4F, 0xC7, 0x77, 0x9F, 0x97, 0x71, 0x9A, 0x3F, 0xC7, 0x72, 0xEA, 0x9F,
+    0xC9, 0x77, 0x1A, 0xFF, 0xCA, 0x77, 0x2A, 0xFF, 0xA7, 0x74, 0xFE, 0x97, 0x76, 0x99, 0x99, 0x76,
+    0x77, 0x72, 0x9E, 0x96, 0xE9, 0x5F, 0xC5, 0xFC, 0x4A, 0xFC, 0x49, 0xFC, 0x4A, 0xF9, 0x49, 0xFA,
+    0x49, 0xEA, 0x6E, 0xA7, 0x77, 0x77, 0x71, 0x9A, 0xA7, 0x99, 0xA4, 0xAF, 0xD3, 0xAF, 0xD2, 0xAF,
+    0xE2, 0x9F, 0xE2, 0xAA, 0xAF, 0xA2, 0x9A, 0xAF, 0xC5, 0xAE, 0x95, 0xAF, 0x5F, 0x6F, 0xA4, 0x9F,
+    0x6F, 0x94, 0xAE, 0xA6, 0xF5, 0xF9, 0x59, 0xF5, 0xF6, 0xAF, 0x49, 0xF6, 0xFA, 0x4F, 0xA6, 0xF9,
+    0x4F, 0x95, 0x9F, 0x49, 0xF1, 0xA9, 0x2A, 0xF4, 0x9F, 0xAD, 0xA2, 0xFA, 0x4A, 0xFE, 0x92, 0xF9,
+    0x4A, 0xFD, 0xA2, 0x9F, 0x6F, 0xA9, 0x3A, 0xF7, 0x99, 0x6F, 0xA7, 0x70, 0xF7, 0x39, 0x3A, 0xEA,
+    0x72, 0xD9, 0x1A, 0xF7, 0x2A, 0xFF, 0xCA, 0x72, 0xFF, 0xCA, 0x73, 0x9F, 0xE9, 0x76, 0xAA, 0xAA,
+    0x97, 0x30, 0x76, 0x9A, 0xC9, 0x77, 0x09, 0xF9, 0x76, 0x9F, 0xD7, 0x59, 0xEA, 0xF7, 0x3A, 0xEA,
+    0x1E, 0xA7, 0x1F, 0x92, 0x9D, 0xA7, 0x19, 0xAA, 0x59, 0xA7, 0x77, 0x77, 0x76, 0xFF, 0xD9, 0x71,
+    0xAF, 0xFD, 0x73, 0xFF, 0xA7, 0x6F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC,
+    0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79,
+    0xFA, 0x77, 0x9F, 0x97, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97,
+    0x7F, 0xC7, 0x70, 0xFA, 0x77, 0xAF, 0x97, 0x1A, 0xA3, 0xFC, 0x71, 0x9E, 0x99, 0xFC, 0x97, 0x1A,
+    0xFF, 0xC9, 0x72, 0xAF, 0xF9, 0x73, 0x9F, 0xE7, 0x79, 0xA9, 0x97, 0x70, 0x77, 0x77, 0x29, 0xE7,
+    0x70, 0xFA, 0x76, 0xFD, 0x75, 0xEA, 0xEA, 0x73, 0xAE, 0x1E, 0x72, 0xAE, 0x2A, 0xD9, 0x71, 0xE4,
+    0xD7, 0x77, 0x77, 0x76, 0x99, 0xA9, 0x75, 0x9F, 0xD9, 0x74, 0xFE, 0x97, 0x4A, 0xAF, 0xC9, 0x76,
+    0x9F, 0x77, 0x9F, 0x77, 0xAF, 0x77, 0xFA, 0x77, 0xF9, 0x76, 0x9F, 0x77, 0xAF, 0x77, 0xFA, 0x77,
+    0xFA, 0x77, 0xF9, 0x76, 0x9F, 0x77, 0xAF, 0x77, 0xFA, 0x77, 0xF7, 0x7A, 0xF7, 0x7F, 0xA7, 0x19,
+    0x39, 0xF7, 0x1D, 0xA1, 0x9F, 0xA7, 0x09, 0xFF, 0xD7, 0x19, 0xFF, 0xC7, 0x3F, 0xEA, 0x75, 0x9A,
+    0xAA, 0x97, 0x50, 0x5F, 0xFD, 0x1F, 0xFA, 0x4A, 0xFF, 0xCA, 0x09, 0xFF, 0x94, 0x9F, 0xFA, 0x29,
+    0xFD, 0x97, 0x0F, 0xA4, 0x9F, 0xA7, 0x19, 0xF9, 0x3A, 0xF9, 0x72, 0xAF, 0x3A, 0xF9, 0x73, 0xFC,
+    0x2A, 0xF7, 0x5F, 0xC1, 0xAF, 0x75, 0x9F, 0xA0, 0xFC, 0x76, 0x9F, 0x9F, 0xA7, 0x7A, 0xFF, 0xA7,
+    0x70, 0xFF, 0xC7, 0x71, 0xFF, 0xCA, 0x77, 0x9F, 0xAF, 0xC9, 0x76, 0xAF, 0x99, 0xFC, 0x76, 0xFC,
+    0x1A, 0xFC, 0x75, 0xFC, 0x2F, 0xCA, 0x74, 0xFA, 0x29, 0xFC, 0x97, 0x29, 0xF9, 0x3F, 0xD9, 0x71,
+    0xAF, 0x5F, 0xD9, 0x69, 0xFE, 0xA3, 0x9F, 0xDA, 0x4A, 0xFF, 0xCA, 0x39, 0xFE, 0x3F, 0xFD, 0x94,
+    0x9F, 0xC7, 0x77, 0x97, 0x71, 0x99, 0x77, 0x6A, 0xEA, 0x77, 0x59, 0xF7, 0x76, 0xEA, 0x77, 0x59,
+    0xE9, 0x77, 0x5E, 0xA7, 0x75, 0xEA, 0x77, 0x6A, 0xA7, 0x70, 0x59, 0x99, 0x72, 0xAF, 0xD7, 0x0A,
+    0xFE, 0x97, 0xAF, 0xE7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA2, 0x9A, 0x95,
+    0xF1, 0x9F, 0xC4, 0xF0, 0xAF, 0xDA, 0x3E, 0x9E, 0xAA, 0xF2, 0x9E, 0xAC, 0xA2, 0xEA, 0x2A, 0xFA,
+    0x3E, 0xA2, 0xFC, 0x3A, 0xE3, 0xF9, 0x29, 0xE9, 0x29, 0xF2, 0xAE, 0x93, 0xAF, 0xAF, 0xC5, 0xFF,
+    0xA7, 0xFA, 0xEA, 0x69, 0xF0, 0xF9, 0x59, 0xF0, 0x9F, 0x94, 0xAE, 0xA1, 0xAF, 0xA3, 0xF9, 0x2F,
+    0xEA, 0x0F, 0x93, 0xFD, 0x99, 0xF5, 0xFA, 0x75, 0x97, 0x19, 0x76, 0xE9, 0x74, 0xEA, 0x74, 0xE9,
+    0x74, 0xE7, 0x4A, 0xD9, 0x73, 0xAD, 0x97, 0x49, 0x97, 0x20, 0x39, 0xA9, 0x6A, 0xA2, 0xAF, 0xCA,
+    0x3A, 0xF0, 0xFE, 0xA2, 0xFD, 0x0A, 0xAA, 0xF9, 0x1F, 0xDA, 0x3A, 0xE9, 0x0F, 0xAD, 0x93, 0xF0,
+    0xAE, 0x70, 0xF9, 0xDA, 0x70, 0x9E, 0xAD, 0xA7, 0x1A, 0xFD, 0xA7, 0x1F, 0xF7, 0x1F, 0xAE, 0x97,
+    0x9F, 0x0E, 0xA7, 0x9F, 0x0A, 0xE9, 0x6A, 0xEA, 0x1F, 0x2C, 0xA1, 0xF9, 0x1F, 0xCA, 0xE1, 0xF2,
+    0x9F, 0xE9, 0x09, 0xF3, 0xFD, 0xA1, 0xAE, 0xA4, 0xF9, 0x76, 0x94, 0x77, 0x77, 0x19, 0xC7, 0x70,
+    0xAD, 0x97, 0x59, 0xFA, 0x74, 0xAF, 0xC9, 0x72, 0x9F, 0xD9, 0x73, 0xAE, 0xA9, 0x75, 0x9A, 0x97,
+    0x77, 0x77, 0x76, 0xFF, 0xD7, 0x0A, 0xFF, 0xCA, 0x70, 0x9F, 0xFA, 0x74, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x59, 0xF9, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC6, 0x9A, 0x94, 0xFC, 0x6E, 0x4F, 0xC5, 0x9E,
+    0x39, 0xFA, 0x5E, 0xA3, 0xAF, 0x93, 0x9A, 0xE9, 0x19, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xA1, 0xFF,
+    0xFF, 0xC1, 0x77, 0x4A, 0xC9, 0x6A, 0xEA, 0x4A, 0xFC, 0xA2, 0xAF, 0xE3, 0xFC, 0xA9, 0x4A, 0xA9,
+    0x77, 0x69, 0x99, 0x5A, 0xFD, 0x3A, 0xFE, 0x3A, 0xFE, 0x6A, 0xEA, 0x6F, 0xA6, 0xF9, 0x59, 0xF6,
+    0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x6A, 0xF6, 0xFA,
+    0x6F, 0x95, 0x9F, 0x6A, 0xF1, 0xC3, 0xAF, 0xAD, 0x92, 0xFF, 0x3F, 0xE9, 0x39, 0xFA, 0x79, 0x97,
+    0x5F, 0xFD, 0x70, 0xAF, 0xFC, 0xA7, 0x09, 0xFF, 0xA7, 0x4F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97,
+    0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0x97, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75,
+    0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x69, 0xA9, 0x4F, 0xC6, 0xE4, 0xFC, 0x59, 0xE3, 0x9F, 0xA5,
+    0xEA, 0x3A, 0xF9, 0x39, 0xAE, 0x91, 0x9F, 0xFF, 0xF1, 0xAF, 0xFF, 0xFA, 0x1F, 0xFF, 0xFC, 0x77,
+    0x77, 0x97, 0x70, 0xF7, 0x7A, 0xE9, 0x76, 0x9E, 0x97, 0x6A, 0xE7, 0x7E, 0x97, 0x59, 0xE9, 0x76,
+    0x9A, 0x97, 0x20, 0x69, 0x99, 0x5A, 0xFD, 0x3A, 0xFE, 0x3A, 0xFE, 0x6A, 0xEA, 0x6F, 0xA6, 0xF9,
+    0x59, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x6A,
+    0xF6, 0xFA, 0x6F, 0x95, 0x9F, 0x6A, 0xF1, 0xC3, 0xAF, 0xAD, 0x92, 0xFF, 0x3F, 0xE9, 0x39, 0xFA,
+    0x79, 0x97, 0x19, 0x70, 0xAD, 0xA7, 0xF7, 0xAE, 0x7E, 0x96, 0x9D, 0xA6, 0x9D, 0xA7, 0x9A, 0x97,
+    0x00, 0x77, 0x19, 0x97, 0x73, 0xE7, 0x72, 0xE6, 0xFF, 0xD0, 0x9E, 0x5A, 0xFF, 0xCA, 0x0A, 0xD9,
+    0x59, 0xFF, 0xA1, 0xE7, 0x1F, 0xC3, 0xD9, 0x70, 0x9F, 0xA3, 0xD7, 0x1A, 0xF9, 0x77, 0xFC, 0x77,
+    0x0F, 0xC7, 0x79, 0xFA, 0x77, 0x9F, 0x97, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA,
+    0x77, 0xAF, 0x97, 0x7F, 0xC6, 0x9A, 0x96, 0xFC, 0x6E, 0x6F, 0xC5, 0x9E, 0x59, 0xFA, 0x5E, 0xA5,
+    0xAF, 0x93, 0x9A, 0xE9, 0x39, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xC3, 0x49, 0x99,
+    0x39, 0x92, 0xAF, 0xD1, 0xAD, 0xA0, 0xAF, 0xE1, 0xEA, 0x0A, 0xFE, 0x1E, 0x93, 0xAE, 0xA0, 0x9E,
+    0x4F, 0xA0, 0xAD, 0x94, 0xF9, 0x0A, 0xD4, 0x9F, 0x1D, 0x94, 0xAF, 0x29, 0x5F, 0xA7, 0x1F, 0x97,
+    0x09, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7,
+    0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF1, 0xC6, 0xAF, 0xAD, 0x95, 0xFF, 0x6F, 0xE9, 0x69, 0xFA, 0x72,
+    0x99, 0x72, 0x5F, 0xFD, 0x71, 0xAF, 0xFC, 0xA7, 0x19, 0xFF, 0xA7, 0x5F, 0xC7, 0x69, 0xFA, 0x76,
+    0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC4, 0x9D, 0x69, 0xFA, 0x39, 0xEA, 0x59, 0xF9, 0x3F, 0xC5, 0xAF,
+    0x93, 0xFA, 0x5F, 0xC4, 0xEA, 0x6F, 0xC5, 0x97, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x69, 0xA9,
+    0x5F, 0xC6, 0xE5, 0xFC, 0x59, 0xE4, 0x9F, 0xA5, 0xEA, 0x4A, 0xF9, 0x39, 0xAE, 0x92, 0x9F, 0xFF,
+    0xF2, 0xAF, 0xFF, 0xFA, 0x2F, 0xFF, 0xFC, 0x20, 0x49, 0x99, 0x7A, 0xFD, 0x5A, 0xFE, 0x5A, 0xFE,
+    0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF2,
+    0x9A, 0xA2, 0xAF, 0x19, 0xF1, 0xAE, 0xA1, 0xFC, 0x1F, 0x91, 0xF9, 0x1F, 0x2E, 0xA1, 0x9F, 0x39,
+    0x3A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0xAF, 0x1C, 0x5A, 0xFA, 0xD9, 0x4F, 0xF5, 0xFE,
+    0x95, 0x9F, 0xA7, 0x19, 0x97, 0x10, 0x5F, 0xFD, 0x70, 0xAF, 0xFC, 0xA7, 0x09, 0xFF, 0xA7, 0x4F,
+    0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC1, 0xA7, 0x29, 0xFC, 0xAD, 0xA7, 0x19,
+    0xFF, 0x97, 0x1A, 0xFD, 0x97, 0x29, 0xFC, 0x97, 0x29, 0xFE, 0x72, 0xFF, 0xA7, 0x2D, 0xAA, 0xF9,
+    0x72, 0x91, 0xFC, 0x69, 0xA9, 0x4F, 0xC6, 0xE4, 0xFC, 0x59, 0xE3, 0x9F, 0xA5, 0xEA, 0x3A, 0xF9,
+    0x39, 0xAE, 0x91, 0x9F, 0xFF, 0xF1, 0xAF, 0xFF, 0xFA, 0x1F, 0xFF, 0xFC, 0x10, 0x69, 0x99, 0x6A,
+    0xFD, 0x4A, 0xFE, 0x4A, 0xFE, 0x7A, 0xEA, 0x7F, 0xA7, 0xF9, 0x69, 0xF7, 0xAF, 0x7F, 0xA0, 0x95,
+    0xFA, 0xD9, 0x39, 0xFE, 0x93, 0xAF, 0xCA, 0x5F, 0xC5, 0xAF, 0xC9, 0x39, 0xFE, 0x5D, 0xAF, 0x7A,
+    0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x7A, 0xF1, 0xC4, 0xAF, 0xAD, 0x93, 0xFF, 0x4F, 0xE9, 0x49, 0xFA,
+    0x70, 0x99, 0x60, 0x77, 0x77, 0x77, 0x9C, 0x77, 0x71, 0xAD, 0x97, 0x76, 0x9F, 0xA7, 0x75, 0xAF,
+    0xC9, 0x77, 0x4F, 0xD9, 0x77, 0x4A, 0xEA, 0x97, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x3F,
+    0xE6, 0xFF, 0xC4, 0xAF, 0xE9, 0x49, 0xFF, 0xC5, 0xFF, 0x5A, 0xFD, 0xA7, 0x0F, 0xD9, 0x6F, 0x71,
+    0x9F, 0xDA, 0x6E, 0xA7, 0x1A, 0xFE, 0x59, 0xE9, 0x71, 0xFF, 0xA4, 0xAE, 0x97, 0x1F, 0xFC, 0x4F,
+    0x72, 0xEA, 0xFC, 0x93, 0xF7, 0x19, 0xE9, 0x9F, 0xC3, 0xEA, 0x71, 0xAE, 0x1F, 0xC9, 0x19, 0xE9,
+    0x71, 0xF1, 0x9F, 0xC1, 0xAE, 0x72, 0xF2, 0xFC, 0x1F, 0x71, 0x9E, 0xA2, 0xAF, 0xA0, 0xF7, 0x1A,
+    0xE9, 0x3F, 0xC9, 0xEA, 0x71, 0xAE, 0x4A, 0xFF, 0x97, 0x1F, 0x5F, 0xF7, 0x2E, 0xA5, 0xAF, 0xE7,
+    0x19, 0xE9, 0x59, 0xFD, 0xA7, 0x1A, 0xE9, 0x6F, 0xDA, 0x70, 0xAF, 0xCA, 0x59, 0xFC, 0x96, 0x9F,
+    0xFA, 0x5F, 0xC7, 0xFF, 0xC9, 0x59, 0xF7, 0x77, 0x09, 0x97, 0x10, 0x77, 0x77, 0x9C, 0x77, 0x0E,
+    0x76, 0xAE, 0x97, 0x49, 0xF7, 0x5F, 0x97, 0x4A, 0xE9, 0x75, 0xE9, 0x76, 0x9C, 0x77, 0x77, 0x77,
+    0x09, 0xA9, 0x49, 0xAA, 0x93, 0xAF, 0xCA, 0x19, 0xFC, 0x91, 0xFE, 0xA0, 0xAF, 0xE1, 0xAA, 0xAF,
+    0xAA, 0xFF, 0x4A, 0xEA, 0xDA, 0x0A, 0xF4, 0xFD, 0xA1, 0x9F, 0x4F, 0xD2, 0xAE, 0xA3, 0x9F, 0xC3,
+    0xF9, 0x3A, 0xFA, 0x3F, 0x4F, 0xC3, 0x9F, 0x4F, 0xA3, 0xAE, 0xA3, 0x9F, 0x93, 0xF9, 0x39, 0xF3,
+    0x9F, 0x4A, 0xF3, 0x9F, 0x1C, 0x1F, 0xA3, 0xAF, 0xAD, 0x90, 0xF9, 0x3F, 0xF0, 0x9F, 0x4A, 0xFD,
+    0x90, 0xAE, 0xA4, 0x9F, 0xA7, 0x69, 0x94, 0x4F, 0xE6, 0xFF, 0xC4, 0xAF, 0xE9, 0x49, 0xFF, 0xC5,
+    0xFF, 0x5A, 0xFD, 0xA7, 0x0F, 0xD9, 0x6F, 0x71, 0x9F, 0xDA, 0x6E, 0xA7, 0x1A, 0xFE, 0x59, 0xE9,
+    0x71, 0xFF, 0xA4, 0xAE, 0x97, 0x1F, 0xFC, 0x4F, 0x72, 0xEA, 0xFC, 0x93, 0xF7, 0x19, 0xE9, 0x9F,
+    0xC3, 0xEA, 0x71, 0xAE, 0x1F, 0xC9, 0x19, 0xE9, 0x71, 0xF1, 0x9F, 0xC1, 0xAE, 0x72, 0xF2, 0xFC,
+    0x1F, 0x71, 0x9E, 0xA2, 0xAF, 0xA0, 0xF7, 0x1A, 0xE9, 0x3F, 0xC9, 0xEA, 0x71, 0xAE, 0x4A, 0xFF,
+    0x97, 0x1F, 0x5F, 0xF7, 0x2E, 0xA5, 0xAF, 0xE7, 0x19, 0xE9, 0x59, 0xFD, 0xA7, 0x1A, 0xE9, 0x6F,
+    0xDA, 0x70, 0xAF, 0xCA, 0x59, 0xFC, 0x96, 0x9F, 0xFA, 0x5F, 0xC7, 0xFF, 0xC9, 0x59, 0xF7, 0x77,
+    0x09, 0x97, 0x74, 0x99, 0x77, 0x71, 0xF7, 0x77, 0x0F, 0x77, 0x70, 0xAE, 0x77, 0x70, 0xEA, 0x77,
+    0x79, 0xE7, 0x77, 0xAE, 0x77, 0x70, 0x9A, 0x97, 0x71, 0x39, 0xA9, 0x49, 0xAA, 0x93, 0xAF, 0xCA,
+    0x19, 0xFC, 0x91, 0xFE, 0xA0, 0xAF, 0xE1, 0xAA, 0xAF, 0xAA, 0xFF, 0x4A, 0xEA, 0xDA, 0x0A, 0xF4,
+    0xFD, 0xA1, 0x9F, 0x4F, 0xD2, 0xAE, 0xA3, 0x9F, 0xC3, 0xF9, 0x3A, 0xFA, 0x3F, 0x4F, 0xC3, 0x9F,
+    0x4F, 0xA3, 0xAE, 0xA3, 0x9F, 0x93, 0xF9, 0x39, 0xF3, 0x9F, 0x4A, 0xF3, 0x9F, 0x1C, 0x1F, 0xA3,
+    0xAF, 0xAD, 0x90, 0xF9, 0x3F, 0xF0, 0x9F, 0x4A, 0xFD, 0x90, 0xAE, 0xA4, 0x9F, 0xA7, 0x69, 0x97,
+    0x39, 0x77, 0x0E, 0x97, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0x76, 0x9D, 0x97, 0x59, 0xD9, 0x76, 0x9A,
+    0x74, 0x72, 0x9A, 0x95, 0xAC, 0xA7, 0x70, 0xE4, 0xF7, 0x70, 0xAE, 0x19, 0xEA, 0x77, 0x2F, 0x9E,
+    0xA7, 0x73, 0x9F, 0xD9, 0x77, 0x59, 0xF9, 0x77, 0x7A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x71, 0xFE,
+    0x6F, 0xFC, 0x4A, 0xFE, 0x94, 0x9F, 0xFC, 0x5F, 0xF5, 0xAF, 0xDA, 0x70, 0xFD, 0x96, 0xF7, 0x19,
+    0xFD, 0xA6, 0xEA, 0x71, 0xAF, 0xE5, 0x9E, 0x97, 0x1F, 0xFA, 0x4A, 0xE9, 0x71, 0xFF, 0xC4, 0xF7,
+    0x2E, 0xAF, 0xC9, 0x3F, 0x71, 0x9E, 0x99, 0xFC, 0x3E, 0xA7, 0x1A, 0xE1, 0xFC, 0x91, 0x9E, 0x97,
+    0x1F, 0x19, 0xFC, 0x1A, 0xE7, 0x2F, 0x2F, 0xC1, 0xF7, 0x19, 0xEA, 0x2A, 0xFA, 0x0F, 0x71, 0xAE,
+    0x93, 0xFC, 0x9E, 0xA7, 0x1A, 0xE4, 0xAF, 0xF9, 0x71, 0xF5, 0xFF, 0x72, 0xEA, 0x5A, 0xFE, 0x71,
+    0x9E, 0x95, 0x9F, 0xDA, 0x71, 0xAE, 0x96, 0xFD, 0xA7, 0x0A, 0xFC, 0xA5, 0x9F, 0xC9, 0x69, 0xFF,
+    0xA5, 0xFC, 0x7F, 0xFC, 0x95, 0x9F, 0x77, 0x70, 0x99, 0x71, 0x69, 0x95, 0xA9, 0x7A, 0xD3, 0x9E,
+    0x7A, 0xDA, 0x19, 0xE7, 0x1E, 0x09, 0xE7, 0x2F, 0xE9, 0x72, 0x9F, 0xC9, 0x74, 0xAE, 0xA7, 0x6D,
+    0xA7, 0x77, 0x77, 0x70, 0x9A, 0x94, 0x9A, 0xA9, 0x3A, 0xFC, 0xA1, 0x9F, 0xC9, 0x1F, 0xEA, 0x0A,
+    0xFE, 0x1A, 0xAA, 0xFA, 0xAF, 0xF4, 0xAE, 0xAD, 0xA0, 0xAF, 0x4F, 0xDA, 0x19, 0xF4, 0xFD, 0x2A,
+    0xEA, 0x39, 0xFC, 0x3F, 0x93, 0xAF, 0xA3, 0xF4, 0xFC, 0x39, 0xF4, 0xFA, 0x3A, 0xEA, 0x39, 0xF9,
+    0x3F, 0x93, 0x9F, 0x39, 0xF4, 0xAF, 0x39, 0xF1, 0xC1, 0xFA, 0x3A, 0xFA, 0xD9, 0x0F, 0x93, 0xFF,
+    0x09, 0xF4, 0xAF, 0xD9, 0x0A, 0xEA, 0x49, 0xFA, 0x76, 0x99, 0x40, 0x29, 0xAA, 0x77, 0x49, 0xF7,
+    0x73, 0x9F, 0x77, 0x4F, 0x77, 0x4F, 0x77, 0x39, 0xE9, 0x77, 0x3F, 0x77, 0x39, 0xE9, 0x29, 0x9A,
+    0x94, 0x9A, 0xA9, 0x3E, 0xA1, 0xAF, 0xCA, 0x19, 0xFC, 0x91, 0xAD, 0xA1, 0xFE, 0xA0, 0xAF, 0xE2,
+    0x93, 0xAA, 0xAF, 0xAA, 0xFF, 0x72, 0xAE, 0xAD, 0xA0, 0xAF, 0x72, 0xFD, 0xA1, 0x9F, 0x72, 0xFC,
+    0xA2, 0xAE, 0xA7, 0x19, 0xFC, 0x3F, 0x97, 0x1A, 0xFA, 0x3F, 0x72, 0xFC, 0x3A, 0xF7, 0x2F, 0xA3,
+    0xFA, 0x71, 0x9F, 0x93, 0xF9, 0x71, 0xAF, 0x39, 0xF7, 0x2F, 0xC3, 0xAF, 0x1C, 0x7F, 0xA3, 0xAF,
+    0xAD, 0x96, 0xF9, 0x3F, 0xF6, 0x9F, 0x4F, 0xE9, 0x6A, 0xEA, 0x49, 0xFA, 0x77, 0x49, 0x94, 0x4F,
+    0xE6, 0xFF, 0xC4, 0xAF, 0xE9, 0x49, 0xFF, 0xC5, 0xFF, 0x5A, 0xFD, 0xA7, 0x0F, 0xD9, 0x6F, 0x71,
+    0x9F, 0xDA, 0x6E, 0xA7, 0x1A, 0xFE, 0x59, 0xE9, 0x71, 0xFF, 0xA4, 0xAE, 0x97, 0x1F, 0xFC, 0x4F,
+    0x72, 0xEA, 0xFC, 0x93, 0xF7, 0x19, 0xE9, 0x9F, 0xC3, 0xEA, 0x71, 0xAE, 0x1F, 0xC9, 0x19, 0xE9,
+    0x71, 0xF1, 0x9F, 0xC1, 0xAE, 0x72, 0xF2, 0xFC, 0x1F, 0x71, 0x9E, 0xA2, 0xAF, 0xA0, 0xF7, 0x1A,
+    0xE9, 0x3F, 0xC9, 0xEA, 0x71, 0xAE, 0x4A, 0xFF, 0x97, 0x1F, 0x5F, 0xF7, 0x2E, 0xA5, 0xAF, 0xE7,
+    0x19, 0xE9, 0x59, 0xFD, 0xA7, 0x1A, 0xE9, 0x6F, 0xDA, 0x70, 0xAF, 0xCA, 0x59, 0xFC, 0x96, 0x9F,
+    0xFA, 0x5F, 0xC7, 0xFF, 0xC9, 0x59, 0xF7, 0x77, 0x9E, 0x97, 0x71, 0x9A, 0x3F, 0x77, 0x2E, 0x1A,
+    0xEA, 0x77, 0x1A, 0xFF, 0xC7, 0x72, 0xAF, 0xF7, 0x74, 0xFD, 0xA7, 0x76, 0x99, 0x99, 0x75, 0x39,
+    0xA9, 0x49, 0xAA, 0x92, 0xAF, 0xCA, 0x19, 0xFC, 0x90, 0xFE, 0xA0, 0xAF, 0xE0, 0xAA, 0xAF, 0xAA,
+    0xFF, 0x3A, 0xEA, 0xDA, 0x0A, 0xF3, 0xFD, 0xA1, 0x9F, 0x3F, 0xD2, 0xAE, 0xA2, 0x9F, 0xC3, 0xFA,
+    0x2A, 0xFA, 0x3F, 0x92, 0xFC, 0x39, 0xF3, 0xFA, 0x3A, 0xF2, 0x9F, 0x93, 0xFA, 0x29, 0xF4, 0xF9,
+    0x2A, 0xF3, 0x9F, 0x3F, 0xA3, 0xAF, 0x3F, 0x93, 0xFA, 0x29, 0xF4, 0xF9, 0x2A, 0xEA, 0x39, 0xF7,
+    0x4F, 0xA7, 0x4F, 0x74, 0xAF, 0x7D, 0x91, 0xF7, 0xAF, 0xFA, 0x7A, 0xFF, 0x71, 0xFD, 0xA7, 0x3A,
+    0xAA, 0xA9, 0x70, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x75, 0xFF, 0xD7, 0x49, 0xFF, 0xD7, 0x5A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x79, 0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF,
+    0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC,
+    0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09,
+    0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71,
+    0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F,
+    0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96,
+    0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x69, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA7, 0xFF, 0xD9, 0x6F, 0xFD, 0x79, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x59, 0xAA,
+    0x97, 0x29, 0xFE, 0xA7, 0xAF, 0xFD, 0x5F, 0xDA, 0xFC, 0x93, 0xAF, 0x29, 0xFA, 0x29, 0xF4, 0xFC,
+    0x2F, 0xA4, 0xAF, 0x2F, 0x94, 0xAF, 0x1A, 0xF5, 0xAF, 0x1F, 0xC5, 0xFA, 0x1F, 0xA5, 0xF9, 0x1F,
+    0xA4, 0x9F, 0x2F, 0xA4, 0xFA, 0x2F, 0xC3, 0xAF, 0x3A, 0xF9, 0x1A, 0xF9, 0x39, 0xFF, 0xE9, 0x5A,
+    0xFF, 0xC9, 0x79, 0xFD, 0xA7, 0x49, 0x97, 0x10, 0x77, 0x77, 0x1A, 0xCA, 0x5C, 0x75, 0xE3, 0x9D,
+    0x75, 0xFC, 0xAE, 0xA7, 0x5A, 0xFE, 0xA7, 0x7A, 0xFC, 0x97, 0x73, 0x97, 0x77, 0x77, 0x49, 0x99,
+    0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD,
+    0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC,
+    0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC,
+    0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC,
+    0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD,
+    0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19,
+    0x97, 0x40, 0x79, 0x96, 0x96, 0xAD, 0x5C, 0x96, 0xF2, 0x9D, 0x96, 0xAF, 0xFA, 0x70, 0xFE, 0xA7,
+    0x2A, 0xEA, 0x97, 0x77, 0x77, 0x79, 0xAA, 0x97, 0x29, 0xFE, 0xA7, 0xAF, 0xFD, 0x5F, 0xDA, 0xFC,
+    0x93, 0xAF, 0x29, 0xFA, 0x29, 0xF4, 0xFC, 0x2F, 0xA4, 0xAF, 0x2F, 0x94, 0xAF, 0x1A, 0xF5, 0xAF,
+    0x1F, 0xC5, 0xFA, 0x1F, 0xA5, 0xF9, 0x1F, 0xA4, 0x9F, 0x2F, 0xA4, 0xFA, 0x2F, 0xC3, 0xAF, 0x3A,
+    0xF9, 0x1A, 0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0xC9, 0x79, 0xFD, 0xA7, 0x49, 0x97, 0x10, 0x77,
+    0x77, 0x69, 0xC9, 0x4A, 0xC7, 0x5A, 0xE3, 0xEA, 0x73, 0xFC, 0x19, 0xFA, 0x71, 0x9F, 0xC9, 0x0A,
+    0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x97, 0x2E, 0xA2, 0x9E, 0x97, 0x4A, 0xA5, 0xA9, 0x77, 0x77, 0x72,
+    0x99, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x74, 0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xE9, 0x7F, 0xDA, 0x99,
+    0x9A, 0xFD, 0x6F, 0xD5, 0x9F, 0xCA, 0x4A, 0xFC, 0x7F, 0xD4, 0xFC, 0x97, 0x9F, 0xC3, 0xAF, 0xC7,
+    0x09, 0xFC, 0x92, 0xFC, 0x97, 0x1F, 0xC9, 0x19, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x19, 0xFC,
+    0x91, 0xFC, 0xA7, 0x19, 0xFC, 0x2F, 0xCA, 0x71, 0xAF, 0xC2, 0xFC, 0xA7, 0x1F, 0xCA, 0x2F, 0xCA,
+    0x71, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x3F, 0xD7, 0x0F, 0xC9, 0x3A, 0xFC, 0x96, 0xFD, 0x5F,
+    0xD5, 0xFD, 0x6A, 0xFD, 0xA9, 0x9A, 0xFD, 0x97, 0xFF, 0xFE, 0x72, 0xFF, 0xFA, 0x74, 0x9F, 0xFA,
+    0x77, 0x29, 0x97, 0x50, 0x77, 0x75, 0x9C, 0xA2, 0xAC, 0x97, 0x2E, 0x90, 0x9E, 0x71, 0xF1, 0xF7,
+    0x0A, 0xE9, 0x0A, 0xE9, 0x70, 0xE9, 0x09, 0xE9, 0x70, 0xE9, 0x1E, 0x72, 0xD9, 0x2D, 0x77, 0x77,
+    0x77, 0x59, 0xAA, 0x97, 0x49, 0xFE, 0xA7, 0x1A, 0xFF, 0xD7, 0xFD, 0xAF, 0xC9, 0x5A, 0xF2, 0x9F,
+    0xA4, 0x9F, 0x4F, 0xC4, 0xFA, 0x4A, 0xF4, 0xF9, 0x4A, 0xF3, 0xAF, 0x5A, 0xF3, 0xFC, 0x5F, 0xA3,
+    0xFA, 0x5F, 0x93, 0xFA, 0x49, 0xF4, 0xFA, 0x4F, 0xA4, 0xFC, 0x3A, 0xF5, 0xAF, 0x91, 0xAF, 0x95,
+    0x9F, 0xFE, 0x97, 0xAF, 0xFC, 0x97, 0x19, 0xFD, 0xA7, 0x69, 0x97, 0x30, 0x77, 0x77, 0x72, 0xAF,
+    0xFF, 0xFF, 0xCA, 0x7A, 0xFF, 0xFF, 0xFE, 0xA5, 0x9F, 0xFF, 0xFF, 0xFC, 0x94, 0xAF, 0xDA, 0x93,
+    0xFA, 0x39, 0x9E, 0x93, 0xAF, 0xCA, 0x59, 0xF9, 0x5E, 0x39, 0xFC, 0x96, 0x9F, 0x6E, 0x3F, 0xCA,
+    0x7A, 0xF6, 0xD3, 0x9F, 0xC7, 0x0F, 0xC7, 0x4F, 0xC9, 0x70, 0xFA, 0x74, 0xFC, 0x70, 0x9F, 0x97,
+    0x3A, 0xFA, 0x70, 0xAF, 0xFF, 0x4F, 0xC9, 0x70, 0xAF, 0xFE, 0xA4, 0xFC, 0x71, 0xFF, 0xF5, 0xFC,
+    0x71, 0xFA, 0x74, 0xFC, 0x70, 0x9F, 0x97, 0x4F, 0xC9, 0x7A, 0xF7, 0x5F, 0xCA, 0x7F, 0xC6, 0xAD,
+    0x3A, 0xFC, 0x7F, 0xA6, 0xE4, 0xFD, 0x6F, 0x95, 0xAE, 0x4A, 0xFD, 0xA9, 0x99, 0xAF, 0xC9, 0x39,
+    0x9E, 0xA5, 0xFF, 0xFF, 0xFF, 0xD9, 0x6A, 0xFF, 0xFF, 0xFF, 0x70, 0x9A, 0xFF, 0xFF, 0xFC, 0xA7,
+    0x49, 0x99, 0x97, 0x73, 0x79, 0x9A, 0xA9, 0x69, 0xAA, 0x97, 0x09, 0xFE, 0x3A, 0xFD, 0x95, 0xFF,
+    0xD1, 0xFF, 0xC4, 0xFD, 0xAF, 0xAF, 0x99, 0xF3, 0xAF, 0x29, 0xFD, 0xA2, 0xF2, 0x9F, 0x4F, 0xD3,
+    0xF2, 0xFA, 0x4A, 0xF9, 0x2A, 0xE9, 0x19, 0xF9, 0x4A, 0xF2, 0x9E, 0xA2, 0xAF, 0x5A, 0xEA, 0x1F,
+    0xA3, 0xFC, 0x5F, 0xAA, 0xF9, 0x4F, 0xA5, 0xFF, 0xA6, 0xFA, 0x49, 0xFD, 0x97, 0x0F, 0xA4, 0xFC,
+    0x95, 0x9A, 0x2F, 0xC3, 0xAF, 0xCA, 0x4A, 0xD2, 0xAF, 0x91, 0xAF, 0xEA, 0x99, 0xAF, 0x29, 0xFF,
+    0xFF, 0xFD, 0x93, 0xAF, 0xFA, 0x0A, 0xFF, 0xC6, 0x9F, 0xD9, 0x29, 0xFD, 0x97, 0x29, 0x97, 0x09,
+    0x70, 0x77, 0x77, 0x70, 0x9C, 0x77, 0x4A, 0xD9, 0x77, 0x19, 0xFA, 0x77, 0x0A, 0xFC, 0x97, 0x7F,
+    0xD9, 0x77, 0xAE, 0xA9, 0x77, 0x19, 0xA9, 0x77, 0x77, 0x73, 0x99, 0x99, 0x99, 0x75, 0x9A, 0xFF,
+    0xDA, 0x70, 0x9F, 0xFF, 0xE7, 0xAF, 0xFA, 0xFE, 0x69, 0x99, 0x9F, 0xA1, 0x9F, 0xCA, 0x70, 0x9F,
+    0x92, 0x9F, 0xC7, 0x0A, 0xF4, 0xFC, 0x70, 0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFA, 0x79, 0xFA, 0x3A,
+    0xF9, 0x79, 0xF9, 0x29, 0xFA, 0x70, 0xAF, 0x19, 0xAF, 0xC7, 0x1F, 0xFF, 0xA7, 0x2F, 0xFD, 0xA7,
+    0x39, 0xFF, 0xD7, 0x4A, 0xF1, 0xF9, 0x73, 0xFC, 0x1F, 0xC7, 0x3F, 0xC1, 0x9F, 0xA7, 0x2F, 0xA2,
+    0xFC, 0xA7, 0x09, 0xF9, 0x3F, 0xC9, 0x7A, 0xF4, 0xAF, 0xCA, 0x49, 0xFE, 0xA3, 0xFD, 0xA2, 0xAF,
+    0xFC, 0xA3, 0xFE, 0x1F, 0xFD, 0x5A, 0xFA, 0x77, 0x39, 0x92, 0x77, 0x73, 0xAA, 0x74, 0x9E, 0x73,
+    0xF7, 0x2A, 0xEA, 0x71, 0x9F, 0x72, 0xF7, 0x3E, 0x74, 0xAA, 0x77, 0x77, 0x70, 0x9A, 0x93, 0x9A,
+    0xA2, 0xAF, 0xCA, 0x1A, 0xF0, 0xFE, 0xA0, 0xAF, 0xC0, 0xAA, 0xAF, 0xA9, 0xFD, 0x39, 0xE9, 0xFD,
+    0xA3, 0xAE, 0xAD, 0x91, 0x94, 0xFD, 0x97, 0x0F, 0xCA, 0x70, 0x9F, 0xC7, 0x1A, 0xFA, 0x71, 0xFC,
+    0x72, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF7, 0x2F, 0xC7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x20,
+    0x71, 0x99, 0x99, 0x99, 0x75, 0x9A, 0xFF, 0xDA, 0x70, 0x9F, 0xFF, 0xE7, 0xAF, 0xFA, 0xFE, 0x69,
+    0x99, 0x9F, 0xA1, 0x9F, 0xCA, 0x70, 0x9F, 0x92, 0x9F, 0xC7, 0x0A, 0xF4, 0xFC, 0x70, 0xFC, 0x4F,
+    0xC7, 0x0F, 0xA4, 0xFA, 0x79, 0xFA, 0x3A, 0xF9, 0x79, 0xF9, 0x29, 0xFA, 0x70, 0xAF, 0x19, 0xAF,
+    0xC7, 0x1F, 0xFF, 0xA7, 0x2F, 0xFD, 0xA7, 0x39, 0xFF, 0xD7, 0x4A, 0xF1, 0xF9, 0x73, 0xFC, 0x1F,
+    0xC7, 0x3F, 0xC1, 0x9F, 0xA7, 0x2F, 0xA2, 0xFC, 0xA7, 0x09, 0xF9, 0x3F, 0xC9, 0x7A, 0xF4, 0xAF,
+    0xCA, 0x49, 0xFE, 0xA3, 0xFD, 0xA2, 0xAF, 0xFC, 0xA3, 0xFE, 0x1F, 0xFD, 0x5A, 0xFA, 0x77, 0x39,
+    0x97, 0x59, 0x97, 0x74, 0xF7, 0x73, 0xF7, 0x73, 0xAE, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0x77, 0x2A,
+    0xE7, 0x73, 0x9A, 0x97, 0x40, 0x59, 0xA9, 0x39, 0xAA, 0x4A, 0xFC, 0xA1, 0xAF, 0x2F, 0xEA, 0x0A,
+    0xFC, 0x2A, 0xAA, 0xFA, 0x9F, 0xD5, 0x9E, 0x9F, 0xDA, 0x5A, 0xEA, 0xD9, 0x19, 0x6F, 0xD9, 0x72,
+    0xFC, 0xA7, 0x29, 0xFC, 0x73, 0xAF, 0xA7, 0x3F, 0xC7, 0x4F, 0xA7, 0x39, 0xF9, 0x73, 0xAF, 0x74,
+    0xFC, 0x74, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x77, 0x77, 0x09, 0x76, 0xAE, 0x75, 0xF7, 0x59, 0xE7,
+    0x5A, 0xDA, 0x75, 0xE7, 0x5D, 0xA7, 0x6A, 0x97, 0x60, 0x70, 0x9A, 0x95, 0xAC, 0xA7, 0x3E, 0x4F,
+    0x73, 0xAE, 0x19, 0xEA, 0x75, 0xF9, 0xEA, 0x76, 0x9F, 0xD9, 0x77, 0x09, 0xF9, 0x77, 0x2A, 0xD9,
+    0x77, 0x77, 0x71, 0x99, 0x99, 0x99, 0x75, 0x9A, 0xFF, 0xDA, 0x70, 0x9F, 0xFF, 0xE7, 0xAF, 0xFA,
+    0xFE, 0x69, 0x99, 0x9F, 0xA1, 0x9F, 0xCA, 0x70, 0x9F, 0x92, 0x9F, 0xC7, 0x0A, 0xF4, 0xFC, 0x70,
+    0xFC, 0x4F, 0xC7, 0x0F, 0xA4, 0xFA, 0x79, 0xFA, 0x3A, 0xF9, 0x79, 0xF9, 0x29, 0xFA, 0x70, 0xAF,
+    0x19, 0xAF, 0xC7, 0x1F, 0xFF, 0xA7, 0x2F, 0xFD, 0xA7, 0x39, 0xFF, 0xD7, 0x4A, 0xF1, 0xF9, 0x73,
+    0xFC, 0x1F, 0xC7, 0x3F, 0xC1, 0x9F, 0xA7, 0x2F, 0xA2, 0xFC, 0xA7, 0x09, 0xF9, 0x3F, 0xC9, 0x7A,
+    0xF4, 0xAF, 0xCA, 0x49, 0xFE, 0xA3, 0xFD, 0xA2, 0xAF, 0xFC, 0xA3, 0xFE, 0x1F, 0xFD, 0x5A, 0xFA,
+    0x77, 0x39, 0x92, 0x59, 0x59, 0xA6, 0xDA, 0x3A, 0xDA, 0x5E, 0x2A, 0xDA, 0x6A, 0xE0, 0xAE, 0x70,
+    0xFE, 0x71, 0xAF, 0xC7, 0x3F, 0x97, 0x39, 0xD9, 0x77, 0x77, 0x73, 0x9A, 0x93, 0x9A, 0xA3, 0xAF,
+    0xCA, 0x1A, 0xF1, 0xFE, 0xA0, 0xAF, 0xC1, 0xAA, 0xAF, 0xA9, 0xFD, 0x49, 0xE9, 0xFD, 0xA4, 0xAE,
+    0xAD, 0x91, 0x95, 0xFD, 0x97, 0x1F, 0xCA, 0x71, 0x9F, 0xC7, 0x2A, 0xFA, 0x72, 0xFC, 0x73, 0xFA,
+    0x72, 0x9F, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x30, 0x77, 0x77,
+    0x2A, 0x97, 0x69, 0xDA, 0x75, 0xFC, 0x73, 0xAF, 0xCA, 0x72, 0xFD, 0xA7, 0x29, 0xF9, 0x75, 0xA9,
+    0x77, 0x77, 0x39, 0x99, 0x99, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xA3, 0x9F,
+    0xA3, 0x9E, 0x93, 0xAF, 0x5E, 0x4F, 0xC5, 0xE4, 0xFC, 0x49, 0xD9, 0x4F, 0xCA, 0x74, 0xFE, 0x73,
+    0x9F, 0xE9, 0x72, 0xAF, 0xF7, 0x2A, 0xFF, 0x72, 0x9F, 0xF7, 0x3A, 0xFD, 0xA7, 0x39, 0xFD, 0x3E,
+    0x59, 0xFC, 0x29, 0xE6, 0xFC, 0x2A, 0xE6, 0xFC, 0x2F, 0x94, 0x9F, 0xA2, 0xFC, 0x92, 0xAF, 0xC3,
+    0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0x96, 0x9F, 0xF9, 0x74, 0x99, 0x71, 0x77, 0x75, 0x9C, 0x76, 0xE7,
+    0x4A, 0xE9, 0x72, 0x9F, 0x73, 0xF7, 0x3A, 0xE7, 0x4E, 0x75, 0x9C, 0x77, 0x77, 0x76, 0x99, 0xAA,
+    0x97, 0x19, 0xFE, 0x96, 0xFF, 0xCA, 0x5A, 0xEA, 0xAA, 0xEA, 0x49, 0xF3, 0xAC, 0x5A, 0xF7, 0x39,
+    0xFC, 0x73, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x2F, 0xD7, 0x3F, 0xCA, 0x4D, 0x4F,
+    0xA3, 0xAE, 0x3A, 0xEA, 0x3F, 0xC2, 0xF4, 0xFF, 0xEA, 0x49, 0xFF, 0xCA, 0x7A, 0xFD, 0x97, 0x39,
+    0x97, 0x00, 0x73, 0xAA, 0xC7, 0x6A, 0xF7, 0x4A, 0xFD, 0x72, 0xAE, 0xAE, 0xA7, 0x0F, 0x90, 0x9E,
+    0x96, 0xF9, 0x29, 0xD9, 0x69, 0xAA, 0x5A, 0x97, 0x77, 0x59, 0x99, 0x99, 0x72, 0x9F, 0xFC, 0x96,
+    0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xA3, 0x9F, 0xA3, 0x9E, 0x93, 0xAF, 0x5E, 0x4F, 0xC5, 0xE4, 0xFC,
+    0x49, 0xD9, 0x4F, 0xCA, 0x74, 0xFE, 0x73, 0x9F, 0xE9, 0x72, 0xAF, 0xF7, 0x2A, 0xFF, 0x72, 0x9F,
+    0xF7, 0x3A, 0xFD, 0xA7, 0x39, 0xFD, 0x3E, 0x59, 0xFC, 0x29, 0xE6, 0xFC, 0x2A, 0xE6, 0xFC, 0x2F,
+    0x94, 0x9F, 0xA2, 0xFC, 0x92, 0xAF, 0xC3, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0x96, 0x9F, 0xF9, 0x74,
+    0x99, 0x71, 0x77, 0x71, 0xAD, 0x97, 0x2F, 0xC7, 0x1A, 0xFC, 0xA7, 0x9E, 0xAE, 0x69, 0xE1, 0xE9,
+    0x5E, 0x92, 0xDA, 0x4A, 0xD9, 0x3A, 0xC9, 0x77, 0x77, 0x79, 0x9A, 0xA9, 0x70, 0x9F, 0xE9, 0x5F,
+    0xFC, 0xA4, 0xAE, 0xAA, 0xAE, 0xA3, 0x9F, 0x3A, 0xC4, 0xAF, 0x72, 0x9F, 0xC7, 0x2F, 0xD9, 0x70,
+    0x9F, 0xD9, 0x70, 0x9F, 0xD9, 0x71, 0xFD, 0x72, 0xFC, 0xA3, 0xD4, 0xFA, 0x2A, 0xE3, 0xAE, 0xA2,
+    0xFC, 0x2F, 0x3F, 0xFE, 0xA3, 0x9F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x70, 0x71, 0x99, 0x99,
+    0x97, 0x29, 0xFF, 0xC9, 0x6A, 0xFF, 0xEA, 0x4A, 0xFF, 0xFA, 0x39, 0xFA, 0x39, 0xE9, 0x3A, 0xF5,
+    0xE4, 0xFC, 0x5E, 0x4F, 0xC4, 0x9D, 0x94, 0xFC, 0xA7, 0x4F, 0xE7, 0x39, 0xFE, 0x97, 0x2A, 0xFF,
+    0x72, 0xAF, 0xF7, 0x29, 0xFF, 0x73, 0xAF, 0xDA, 0x73, 0x9F, 0xD3, 0xE5, 0x9F, 0xC2, 0x9E, 0x6F,
+    0xC2, 0xAE, 0x6F, 0xC2, 0xF9, 0x49, 0xFA, 0x2F, 0xC9, 0x2A, 0xFC, 0x3F, 0xFF, 0xD9, 0x39, 0xFF,
+    0xF9, 0x69, 0xFF, 0x97, 0x49, 0x97, 0x70, 0x99, 0x97, 0x6F, 0xC7, 0x5F, 0xC7, 0x7E, 0x76, 0xAD,
+    0xA7, 0x5A, 0xE7, 0x49, 0xF7, 0x6A, 0xA9, 0x72, 0x79, 0x9A, 0xA9, 0x79, 0xFE, 0x94, 0xFF, 0xCA,
+    0x3A, 0xEA, 0xAA, 0xEA, 0x29, 0xF3, 0xAC, 0x3A, 0xF7, 0x19, 0xFC, 0x71, 0xFD, 0x97, 0x9F, 0xD9,
+    0x79, 0xFD, 0x97, 0x0F, 0xD7, 0x1F, 0xCA, 0x2D, 0x4F, 0xA1, 0xAE, 0x3A, 0xEA, 0x1F, 0xC2, 0xF2,
+    0xFF, 0xEA, 0x29, 0xFF, 0xCA, 0x5A, 0xFD, 0x97, 0x19, 0x97, 0x39, 0x99, 0x72, 0xAF, 0x71, 0xAF,
+    0x73, 0xE7, 0x29, 0xDA, 0x71, 0x9E, 0x71, 0xF7, 0x2A, 0xA9, 0x70, 0x7A, 0xA5, 0x9C, 0xA7, 0xAD,
+    0x93, 0xAE, 0x79, 0xE9, 0x1F, 0x71, 0xF9, 0xF7, 0x3F, 0xDA, 0x75, 0xFA, 0x76, 0x9D, 0xA7, 0x77,
+    0x73, 0x99, 0x99, 0x97, 0x39, 0xFF, 0xC9, 0x7A, 0xFF, 0xEA, 0x5A, 0xFF, 0xFA, 0x49, 0xFA, 0x39,
+    0xE9, 0x4A, 0xF5, 0xE5, 0xFC, 0x5E, 0x5F, 0xC4, 0x9D, 0x95, 0xFC, 0xA7, 0x5F, 0xE7, 0x49, 0xFE,
+    0x97, 0x3A, 0xFF, 0x73, 0xAF, 0xF7, 0x39, 0xFF, 0x74, 0xAF, 0xDA, 0x74, 0x9F, 0xD4, 0xE5, 0x9F,
+    0xC3, 0x9E, 0x6F, 0xC3, 0xAE, 0x6F, 0xC3, 0xF9, 0x49, 0xFA, 0x3F, 0xC9, 0x2A, 0xFC, 0x4F, 0xFF,
+    0xD9, 0x49, 0xFF, 0xF9, 0x79, 0xFF, 0x97, 0x59, 0x97, 0x20, 0x69, 0x94, 0x9A, 0x7A, 0xD3, 0xAE,
+    0x6A, 0xD9, 0x1A, 0xE7, 0x9E, 0x09, 0xE7, 0x1F, 0xE7, 0x29, 0xFC, 0x97, 0x3F, 0x97, 0x5D, 0xA7,
+    0x77, 0x77, 0x71, 0x99, 0xAA, 0x97, 0x29, 0xFE, 0x97, 0xFF, 0xCA, 0x6A, 0xEA, 0xAA, 0xEA, 0x59,
+    0xF3, 0xAC, 0x6A, 0xF7, 0x49, 0xFC, 0x74, 0xFD, 0x97, 0x29, 0xFD, 0x97, 0x29, 0xFD, 0x97, 0x3F,
+    0xD7, 0x4F, 0xCA, 0x5D, 0x4F, 0xA4, 0xAE, 0x3A, 0xEA, 0x4F, 0xC2, 0xF5, 0xFF, 0xEA, 0x59, 0xFF,
+    0xCA, 0x70, 0xAF, 0xD9, 0x74, 0x99, 0x71, 0x0A, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
+    0xF0, 0x9E, 0xA9, 0x99, 0xFC, 0x99, 0x99, 0xEA, 0x0A, 0xE3, 0xFC, 0x3E, 0x90, 0xAD, 0xA2, 0x9F,
+    0xA3, 0xE1, 0xAD, 0x92, 0xAF, 0x92, 0x9D, 0xA2, 0xAA, 0x3F, 0xC3, 0x9A, 0xA7, 0x1F, 0xC7, 0x70,
+    0xFA, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97,
+    0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x75, 0x9A, 0xFD, 0xA9, 0x72, 0xAF, 0xFD,
+    0x72, 0xFF, 0xDA, 0x77, 0x77, 0x39, 0x99, 0x77, 0x1F, 0xC7, 0x70, 0xFC, 0x77, 0x2E, 0x77, 0x19,
+    0xE7, 0x70, 0xAE, 0x77, 0x9F, 0x77, 0x1A, 0xA9, 0x77, 0x00, 0x69, 0xAA, 0x72, 0xAE, 0x71, 0x9F,
+    0x71, 0xFA, 0x71, 0xFA, 0x69, 0xAF, 0xFD, 0x1A, 0xFF, 0xEA, 0x1F, 0xFF, 0x5F, 0xA7, 0x1F, 0x97,
+    0x09, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF3, 0x99, 0x3F,
+    0xC2, 0xAD, 0x3F, 0xCA, 0xAF, 0x3F, 0xFD, 0x93, 0xAF, 0xF9, 0x5F, 0xD9, 0x71, 0x99, 0x73, 0x99,
+    0x73, 0xF9, 0x71, 0xAF, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x71, 0xAD, 0xA7, 0x09, 0xEA, 0x71, 0x9A,
+    0xA7, 0x20, 0x6A, 0xA5, 0x9D, 0x71, 0x9D, 0xA3, 0xAE, 0x97, 0x1E, 0x91, 0xAE, 0x73, 0xAE, 0x9F,
+    0x75, 0xFE, 0x77, 0xFC, 0x77, 0x1D, 0xA7, 0x77, 0x77, 0x75, 0xAF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFF, 0x09, 0xEA, 0x99, 0x9F, 0xC9, 0x99, 0x9E, 0xA0, 0xAE, 0x3F, 0xC3, 0xE9, 0x0A,
+    0xDA, 0x29, 0xFA, 0x3E, 0x1A, 0xD9, 0x2A, 0xF9, 0x29, 0xDA, 0x2A, 0xA3, 0xFC, 0x39, 0xAA, 0x71,
+    0xFC, 0x77, 0x0F, 0xA7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7,
+    0x7A, 0xF9, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x59, 0xAF, 0xDA, 0x97,
+    0x2A, 0xFF, 0xD7, 0x2F, 0xFD, 0xA7, 0x10, 0x77, 0x75, 0xDA, 0x75, 0xE7, 0x4A, 0xDA, 0x74, 0xE7,
+    0x09, 0xAA, 0x1D, 0xA7, 0xAE, 0x09, 0xD7, 0x9F, 0x09, 0xC9, 0x7F, 0xA7, 0x3F, 0xA7, 0x09, 0xAF,
+    0xFD, 0x3A, 0xFF, 0xEA, 0x3F, 0xFF, 0x7F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xF7, 0x3F, 0xC7,
+    0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xF3, 0x99, 0x5F, 0xC2, 0xAD, 0x5F, 0xCA, 0xAF, 0x5F,
+    0xFD, 0x95, 0xAF, 0xF9, 0x7F, 0xD9, 0x73, 0x99, 0x71, 0x0A, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xF0, 0x9E, 0xA9, 0x99, 0xFC, 0x99, 0x99, 0xEA, 0x0A, 0xE3, 0xFC, 0x3E, 0x90, 0xAD,
+    0xA2, 0x9F, 0xA3, 0xE1, 0xAD, 0x92, 0xAF, 0x92, 0x9D, 0xA2, 0xAA, 0x3F, 0xC3, 0x9A, 0xA7, 0x1F,
+    0xC7, 0x79, 0xFA, 0x74, 0xAA, 0xAF, 0xDA, 0xAA, 0x71, 0xFF, 0xF7, 0x09, 0xFF, 0xEA, 0x74, 0xFC,
+    0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x59,
+    0xAF, 0xDA, 0x97, 0x2A, 0xFF, 0xD7, 0x2F, 0xFD, 0xA7, 0x10, 0x69, 0xAA, 0x72, 0xAE, 0x71, 0x9F,
+    0x71, 0xFA, 0x71, 0xFA, 0x69, 0xAF, 0xFD, 0x1A, 0xFF, 0xEA, 0x1F, 0xFF, 0x5F, 0xA7, 0x1F, 0x97,
+    0x09, 0xF7, 0x99, 0xAF, 0x99, 0x99, 0x2A, 0xFF, 0xE2, 0xAF, 0xFD, 0xA5, 0xF9, 0x70, 0x9F, 0x71,
+    0xAF, 0x39, 0x93, 0xFC, 0x2A, 0xD3, 0xFC, 0xAA, 0xF3, 0xFF, 0xD9, 0x3A, 0xFF, 0x95, 0xFD, 0x97,
+    0x19, 0x97, 0x77, 0x77, 0x39, 0xE9, 0x19, 0xC9, 0x76, 0xAF, 0xC9, 0x9E, 0x76, 0xFF, 0xDA, 0x76,
+    0xD9, 0x0A, 0xFC, 0x77, 0xAA, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xFF, 0xCA, 0x2A,
+    0xFF, 0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF,
+    0x70, 0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA,
+    0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97,
+    0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA,
+    0x49, 0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A,
+    0xFF, 0x97, 0x72, 0x99, 0x97, 0x70, 0x79, 0xDA, 0x29, 0xA7, 0x1A, 0xFA, 0x1D, 0xA7, 0x0F, 0xDA,
+    0xE9, 0x79, 0xD9, 0x0F, 0xD7, 0x1C, 0xA1, 0x9F, 0x77, 0x09, 0x77, 0x77, 0x77, 0x19, 0x9A, 0x96,
+    0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA, 0xAF, 0xA3, 0xAF, 0x5F, 0x93,
+    0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x49, 0xF3, 0x9F,
+    0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49, 0xF1, 0x9D, 0xAF, 0x09, 0xC9,
+    0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2, 0xFD, 0x92, 0xAF, 0xA3, 0x9E,
+    0xA6, 0x99, 0x79, 0x40, 0x71, 0x99, 0x99, 0x99, 0x99, 0x97, 0x7A, 0xFF, 0xCA, 0x76, 0xFF, 0xD9,
+    0x76, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xCA, 0x2A, 0xFF,
+    0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70,
+    0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F,
+    0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE,
+    0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49,
+    0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF,
+    0x97, 0x72, 0x99, 0x97, 0x70, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x1F, 0xFD, 0x70, 0x9F, 0xFD,
+    0x71, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x79, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94,
+    0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA, 0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F,
+    0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9,
+    0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA,
+    0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2, 0xFD, 0x92, 0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x77,
+    0x77, 0x29, 0xD5, 0xAA, 0x76, 0xEA, 0x3D, 0x97, 0x6A, 0xFA, 0xF7, 0x79, 0xFF, 0x77, 0x19, 0xFC,
+    0xA7, 0x75, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xFC, 0xA2, 0xAF, 0xFC, 0x1F, 0xFD, 0x92, 0xFF,
+    0xD1, 0xAF, 0xF9, 0x3A, 0xFE, 0x94, 0xAF, 0x97, 0xAF, 0x6A, 0xF7, 0x0F, 0xA6, 0xFC, 0x70, 0xF9,
+    0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7,
+    0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96,
+    0xFC, 0x70, 0xF7, 0xFC, 0x7A, 0xF7, 0xFC, 0x7F, 0x97, 0xFC, 0xA4, 0x9F, 0xC7, 0x0F, 0xEA, 0xAA,
+    0xFD, 0x97, 0x09, 0xFF, 0xFD, 0x97, 0x29, 0xFF, 0xF9, 0x75, 0xAF, 0xF9, 0x77, 0x29, 0x99, 0x77,
+    0x7A, 0x69, 0x71, 0xDA, 0x49, 0xC7, 0x1E, 0xA2, 0xAD, 0x71, 0xFF, 0xC9, 0x71, 0x9F, 0xE9, 0x74,
+    0xAE, 0xA7, 0x77, 0x77, 0x71, 0x99, 0xA9, 0x69, 0x99, 0x91, 0x9F, 0xD9, 0x4F, 0x91, 0xFE, 0xA3,
+    0xAF, 0x2A, 0xAA, 0xFA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA5, 0xF4, 0xF9, 0x49, 0xF3, 0x9F, 0x5A, 0xEA,
+    0x3A, 0xF5, 0xF9, 0x3F, 0xA4, 0x9F, 0x39, 0xF9, 0x4A, 0xF3, 0xFC, 0x5F, 0x92, 0xAF, 0xC5, 0xF2,
+    0x9F, 0xD4, 0x9F, 0x19, 0xDA, 0xF0, 0x9C, 0x90, 0x9F, 0x9A, 0xE0, 0xFE, 0xA0, 0x9F, 0xF1, 0xFE,
+    0x19, 0xFE, 0x2F, 0xD9, 0x2A, 0xFA, 0x39, 0xEA, 0x69, 0x97, 0x94, 0x74, 0x99, 0x97, 0x74, 0x9F,
+    0xC9, 0x77, 0x2F, 0xE7, 0x71, 0xAD, 0x2D, 0x97, 0x70, 0xD9, 0x2D, 0x97, 0x70, 0xDA, 0x19, 0xD7,
+    0x71, 0xAF, 0xE7, 0x72, 0xFD, 0x77, 0x49, 0x99, 0x77, 0x77, 0x59, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1,
+    0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA,
+    0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7,
+    0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6,
+    0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC,
+    0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97,
+    0x72, 0x99, 0x97, 0x70, 0x72, 0x9A, 0x97, 0x6A, 0xFC, 0x97, 0x39, 0xEA, 0xE7, 0x3D, 0xA1, 0x9D,
+    0x73, 0xD2, 0x9D, 0x73, 0xD9, 0x1A, 0xD7, 0x3E, 0x9A, 0xD9, 0x73, 0x9F, 0xCA, 0x75, 0x9A, 0xCA,
+    0x97, 0x77, 0x59, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA,
+    0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F,
+    0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49,
+    0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2,
+    0xFD, 0x92, 0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x77, 0x77, 0x7C, 0xA4, 0x9C, 0x97, 0x59,
+    0xE9, 0x2A, 0xE7, 0x4A, 0xF9, 0x1F, 0xC7, 0x3F, 0xCA, 0x09, 0xFC, 0x97, 0x2F, 0xC9, 0x0A, 0xFA,
+    0x73, 0xAE, 0x92, 0xEA, 0x75, 0x9A, 0x5A, 0x97, 0x77, 0x77, 0x77, 0x49, 0xFF, 0xCA, 0x2A, 0xFF,
+    0xC1, 0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70,
+    0xFA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F,
+    0xC7, 0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE,
+    0xA6, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49,
+    0xFC, 0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF,
+    0x97, 0x72, 0x99, 0x97, 0x70, 0x77, 0x75, 0xAC, 0x92, 0xD7, 0x29, 0xE1, 0xAE, 0x71, 0xF0, 0x9E,
+    0xA7, 0x0F, 0x1F, 0x70, 0xAE, 0x1A, 0xE7, 0x1E, 0x19, 0xE7, 0x2D, 0x29, 0xCA, 0x77, 0x77, 0x77,
+    0x09, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA, 0xAF, 0xA3,
+    0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F, 0x93, 0xFA,
+    0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49, 0xF1, 0x9D,
+    0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2, 0xFD, 0x92,
+    0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x40, 0x09, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9, 0x2F,
+    0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7, 0x0F,
+    0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96, 0xFC,
+    0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70, 0xF9,
+    0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE, 0xAA,
+    0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0xAF, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x72, 0x9E, 0x97,
+    0x74, 0xAD, 0x77, 0x5A, 0xDA, 0x77, 0x5E, 0x97, 0x75, 0xFA, 0xAA, 0x77, 0x2A, 0xFD, 0x77, 0x39,
+    0xEA, 0x75, 0x39, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F, 0xEA, 0x3A, 0xF2, 0xAA,
+    0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5, 0xAE, 0xA3, 0xAF, 0x5F,
+    0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC, 0x5F, 0x29, 0xFD, 0x49,
+    0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF, 0x1F, 0xE1, 0x9F, 0xE2,
+    0xFD, 0x3A, 0xFA, 0x39, 0xF6, 0x99, 0x7D, 0x77, 0x0D, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xEA,
+    0x99, 0x75, 0xFD, 0x76, 0xAE, 0x20, 0x77, 0x1A, 0xCA, 0x77, 0x74, 0xFA, 0x77, 0x72, 0xFD, 0xA7,
+    0x77, 0x0F, 0xF9, 0x77, 0x59, 0xF1, 0xAE, 0x77, 0x49, 0xEA, 0x3E, 0x77, 0x5A, 0xA9, 0x5A, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0xFF, 0xD4, 0xAA, 0x94, 0xFF, 0xAA, 0xFF, 0xCA, 0x3A, 0xDA, 0x39, 0xFF,
+    0x90, 0xAF, 0xE9, 0x4F, 0x4A, 0xFD, 0xA2, 0x9F, 0xA5, 0xAF, 0x59, 0xF4, 0x9F, 0xA5, 0xFC, 0x5F,
+    0x94, 0x9F, 0xA4, 0xAF, 0xC4, 0x9F, 0x6F, 0xC4, 0xFD, 0x4F, 0x96, 0xFC, 0x3A, 0xFD, 0x4F, 0x7F,
+    0xC3, 0xFE, 0x3A, 0xE9, 0x7F, 0xC2, 0xAF, 0xE3, 0xF7, 0x0A, 0xF2, 0xE9, 0xF2, 0xAE, 0x97, 0x0A,
+    0xF1, 0x9E, 0x0A, 0xE2, 0xF7, 0x1A, 0xF1, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9, 0x71, 0x9F, 0x09, 0xE1,
+    0xAE, 0x90, 0xF7, 0x29, 0xF0, 0xE9, 0x19, 0xE9, 0xAE, 0x97, 0x3F, 0x9E, 0x29, 0xEA, 0xEA, 0x74,
+    0xFE, 0xA2, 0x9F, 0xE7, 0x5F, 0xE4, 0xFD, 0xA7, 0x5F, 0xDA, 0x4F, 0xD7, 0x6F, 0xD5, 0xFC, 0xA7,
+    0x6A, 0xFA, 0x5F, 0xC7, 0x7A, 0xF6, 0xFA, 0x77, 0x9E, 0xA6, 0xF7, 0x77, 0x77, 0x50, 0x77, 0x77,
+    0x49, 0xAD, 0x77, 0x4F, 0xC7, 0x72, 0xFD, 0x97, 0x70, 0xAE, 0xAE, 0x77, 0x9E, 0x1E, 0x97, 0x59,
+    0xE2, 0x9D, 0xA7, 0x5E, 0x4D, 0x97, 0x77, 0x77, 0x77, 0x29, 0x99, 0x5A, 0xA9, 0x49, 0xAA, 0x2A,
+    0xFC, 0x3F, 0x92, 0xFC, 0x09, 0xFD, 0x92, 0xAF, 0x29, 0xF9, 0x9A, 0xFD, 0x3F, 0x3F, 0x92, 0x9F,
+    0x3F, 0x92, 0xAE, 0x93, 0xF9, 0x2F, 0xA2, 0xAE, 0x4F, 0x92, 0xFA, 0x2F, 0x4A, 0xEA, 0x19, 0xFC,
+    0x2E, 0xA4, 0x9E, 0xA1, 0xAF, 0xC1, 0x9E, 0x6E, 0xA1, 0xFD, 0x1A, 0xE6, 0xF0, 0x9F, 0xD1, 0xE9,
+    0x6F, 0x0E, 0xAE, 0x0A, 0xE7, 0xFA, 0xD9, 0x9E, 0x9E, 0x70, 0xFE, 0x09, 0xFD, 0xA7, 0x0A, 0xFC,
+    0x19, 0xFD, 0x71, 0xAF, 0x91, 0x9F, 0xC7, 0x2A, 0xE9, 0x29, 0xF7, 0x39, 0xD9, 0x4E, 0x77, 0x77,
+    0x00, 0x73, 0x9A, 0xC9, 0x77, 0x19, 0xF9, 0x77, 0x9F, 0xD7, 0x69, 0xEA, 0xF7, 0x4A, 0xEA, 0x1E,
+    0xA7, 0x2F, 0x92, 0x9D, 0xA7, 0x29, 0xAA, 0x59, 0xA7, 0x77, 0x77, 0x73, 0xAF, 0xFC, 0x2F, 0xFA,
+    0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE, 0x93, 0x9F, 0xD9, 0x3F, 0xC6, 0xAE, 0xA5, 0xAF, 0x59,
+    0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE, 0x97, 0x0A, 0xF2, 0x9E, 0xA7, 0x19, 0xF9, 0x1F, 0x73,
+    0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F, 0xEA, 0x76, 0xFE, 0x77, 0x9F, 0xC7, 0x70, 0x9F, 0xA7,
+    0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x76, 0x9A, 0xFD,
+    0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA, 0x71, 0x77, 0x77, 0x3A, 0xD9, 0x77, 0x0F, 0xC7, 0x7A,
+    0xFC, 0x97, 0x5A, 0xEA, 0xE7, 0x49, 0xE1, 0xE9, 0x72, 0x9E, 0x92, 0xDA, 0x72, 0xE9, 0x3A, 0xC9,
+    0x77, 0x77, 0x77, 0x59, 0x9A, 0x59, 0xAA, 0x7A, 0xFC, 0x3F, 0xC9, 0x49, 0xFD, 0xA2, 0x9F, 0xA4,
+    0x9A, 0xFD, 0x3F, 0xC7, 0x9F, 0x3A, 0xEA, 0x70, 0xF9, 0x2A, 0xEA, 0x70, 0xF9, 0x2F, 0x97, 0x0A,
+    0xEA, 0x2F, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x2F, 0x1A, 0xE7, 0x3F, 0x1E, 0xA7, 0x3F, 0x09, 0xE7,
+    0x4F, 0x0E, 0xA7, 0x4F, 0x9E, 0x75, 0xAF, 0xD9, 0x75, 0xAF, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xC7,
+    0x70, 0xF9, 0x77, 0xAE, 0x97, 0x79, 0xE9, 0x71, 0xD9, 0x19, 0xAE, 0x97, 0x19, 0xFF, 0xC9, 0x72,
+    0xAF, 0xF9, 0x74, 0xFD, 0xA7, 0x7A, 0xCA, 0xA7, 0x70, 0x71, 0x94, 0x99, 0x74, 0xAE, 0x2E, 0xA7,
+    0x29, 0xF9, 0x0F, 0xC7, 0x29, 0xF1, 0xFA, 0x73, 0xE9, 0x1A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAF, 0xFC, 0x2F, 0xFA, 0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE, 0x93, 0x9F, 0xD9, 0x3F, 0xC6,
+    0xAE, 0xA5, 0xAF, 0x59, 0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE, 0x97, 0x0A, 0xF2, 0x9E, 0xA7,
+    0x19, 0xF9, 0x1F, 0x73, 0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F, 0xEA, 0x76, 0xFE, 0x77, 0x9F,
+    0xC7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09,
+    0xFA, 0x76, 0x9A, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA, 0x71, 0x77, 0x77, 0x4A, 0xA7,
+    0x70, 0x9E, 0x77, 0xAF, 0x75, 0x9F, 0xD7, 0x4A, 0xFC, 0xA7, 0x5F, 0xA7, 0x7A, 0x97, 0x77, 0x77,
+    0x76, 0x9F, 0xFF, 0xE9, 0x3A, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x3E, 0xA9, 0x93, 0xAF, 0xC9, 0x29,
+    0xE5, 0x9F, 0xCA, 0x39, 0xE5, 0xFC, 0xA5, 0xD9, 0x4F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49,
+    0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F,
+    0xC9, 0x49, 0xA9, 0x49, 0xFC, 0xA5, 0xE4, 0xFC, 0xA5, 0x9E, 0x3F, 0xD6, 0xF2, 0xAF, 0xC5, 0x9A,
+    0xF1, 0x9F, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xEA, 0x77, 0x70, 0x77, 0x75, 0xAA,
+    0x75, 0x9D, 0xA7, 0x4F, 0x73, 0xAE, 0xA7, 0x29, 0xF7, 0x3F, 0x74, 0xDA, 0x75, 0xAA, 0x77, 0x77,
+    0x73, 0x99, 0x94, 0x9A, 0xA4, 0xFD, 0x91, 0xF2, 0xFF, 0xCA, 0xF2, 0xFF, 0xFC, 0x91, 0x9E, 0xA9,
+    0xAF, 0xD9, 0x29, 0xE3, 0xAE, 0x94, 0xD9, 0x2A, 0xEA, 0x72, 0xAE, 0xA7, 0x29, 0xEA, 0x72, 0x9E,
+    0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xF4, 0xCA, 0x39, 0xF4, 0xAD, 0x92, 0xFE, 0xAA, 0xAE,
+    0xA1, 0xFF, 0xFD, 0xA0, 0x9F, 0xAF, 0xFC, 0x2A, 0xD9, 0x1A, 0xFD, 0x97, 0x49, 0x40, 0x77, 0x77,
+    0x0A, 0xD7, 0x70, 0xFA, 0x76, 0x9F, 0xA7, 0x69, 0xF7, 0x70, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0x9F, 0xFF, 0xE9, 0x3A, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x3E, 0xA9, 0x93, 0xAF, 0xC9, 0x29, 0xE5,
+    0x9F, 0xCA, 0x39, 0xE5, 0xFC, 0xA5, 0xD9, 0x4F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC,
+    0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xC9,
+    0x49, 0xA9, 0x49, 0xFC, 0xA5, 0xE4, 0xFC, 0xA5, 0x9E, 0x3F, 0xD6, 0xF2, 0xAF, 0xC5, 0x9A, 0xF1,
+    0x9F, 0xFF, 0xFC, 0xA2, 0xFF, 0xFF, 0xC3, 0xAF, 0xFF, 0xEA, 0x77, 0x70, 0x71, 0xAA, 0x97, 0x4F,
+    0x73, 0xAF, 0x73, 0xAF, 0x73, 0x9E, 0x76, 0x97, 0x77, 0x77, 0x49, 0x99, 0x49, 0xAA, 0x4F, 0xD9,
+    0x1F, 0x2F, 0xFC, 0xAF, 0x2F, 0xFF, 0xC9, 0x19, 0xEA, 0x9A, 0xFD, 0x92, 0x9E, 0x3A, 0xE9, 0x4D,
+    0x92, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72,
+    0x9F, 0x4C, 0xA3, 0x9F, 0x4A, 0xD9, 0x2F, 0xEA, 0xAA, 0xEA, 0x1F, 0xFF, 0xDA, 0x09, 0xFA, 0xFF,
+    0xC2, 0xAD, 0x91, 0xAF, 0xD9, 0x74, 0x94, 0x7A, 0xA5, 0x9D, 0x70, 0x9D, 0xA3, 0xAE, 0x97, 0x0E,
+    0x91, 0xAE, 0x97, 0x1A, 0xE9, 0xF7, 0x4F, 0xE7, 0x6F, 0xC7, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x49,
+    0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xEA, 0x99, 0x3A, 0xFC, 0x92, 0x9E, 0x59,
+    0xFC, 0xA3, 0x9E, 0x5F, 0xCA, 0x5D, 0x94, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xC9,
+    0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0x94,
+    0x9A, 0x94, 0x9F, 0xCA, 0x5E, 0x4F, 0xCA, 0x59, 0xE3, 0xFD, 0x6F, 0x2A, 0xFC, 0x59, 0xAF, 0x19,
+    0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0xA7, 0x77, 0x69, 0x59, 0xA6, 0xDA, 0x3E,
+    0xA5, 0xE2, 0xEA, 0x6A, 0xDA, 0x0A, 0xDA, 0x70, 0xFE, 0x71, 0xAF, 0xC7, 0x3F, 0x74, 0x9D, 0x97,
+    0x77, 0x77, 0x39, 0x99, 0x49, 0xAA, 0x4F, 0xD9, 0x1F, 0x2F, 0xFC, 0xAF, 0x2F, 0xFF, 0xC9, 0x19,
+    0xEA, 0x9A, 0xFD, 0x92, 0x9E, 0x3A, 0xE9, 0x4D, 0x92, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0x9E, 0xA7,
+    0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0x9F, 0x4C, 0xA3, 0x9F, 0x4A, 0xD9, 0x2F, 0xEA,
+    0xAA, 0xEA, 0x1F, 0xFF, 0xDA, 0x09, 0xFA, 0xFF, 0xC2, 0xAD, 0x91, 0xAF, 0xD9, 0x74, 0x94, 0x77,
+    0x0A, 0xAC, 0xAA, 0x77, 0x0A, 0xFE, 0x97, 0x5A, 0xFF, 0xC7, 0x4A, 0xF9, 0xAE, 0xA7, 0x4F, 0x29,
+    0xD7, 0x4A, 0xEA, 0x77, 0x2F, 0x97, 0x71, 0x9F, 0x77, 0x2A, 0xF7, 0x72, 0xFC, 0x77, 0x2F, 0xA7,
+    0x72, 0xF9, 0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77, 0x2F, 0xA7, 0x72, 0xFA, 0x77, 0x2F, 0x97, 0x71,
+    0x9F, 0x77, 0x2A, 0xF7, 0x72, 0xFA, 0x77, 0x2F, 0x97, 0x71, 0x9F, 0x97, 0x71, 0x9F, 0x77, 0x2A,
+    0xF7, 0x72, 0xFA, 0x77, 0x2F, 0x97, 0x71, 0x9F, 0x77, 0x2A, 0xF7, 0x72, 0xFA, 0x74, 0xD2, 0x9F,
+    0x74, 0xAE, 0xAA, 0xFA, 0x74, 0xFF, 0xCA, 0x75, 0xAF, 0xEA, 0x77, 0x9A, 0xDA, 0x97, 0x70, 0x77,
+    0x77, 0x77, 0x1E, 0xA7, 0x75, 0x9F, 0x77, 0x5A, 0xF7, 0x39, 0x99, 0x99, 0x4F, 0x97, 0x0A, 0xFF,
+    0xA1, 0xAE, 0xA7, 0xAF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD, 0xA9, 0x99, 0xAF, 0xD7, 0x0F,
+    0xD5, 0x9F, 0xCA, 0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x97, 0x9F, 0xC5, 0xAF, 0xC7, 0x09, 0xFC, 0x94,
+    0xFC, 0x97, 0x1F, 0xC9, 0x39, 0xFC, 0x72, 0xFC, 0x93, 0xAF, 0xC7, 0x19, 0xFC, 0x93, 0xFC, 0xA7,
+    0x19, 0xFC, 0x4F, 0xCA, 0x71, 0xAF, 0xC4, 0xFC, 0xA7, 0x1F, 0xCA, 0x4F, 0xCA, 0x71, 0xFC, 0x94,
+    0xFC, 0xA7, 0x0A, 0xFC, 0x5F, 0xD7, 0x0F, 0xC9, 0x5A, 0xFC, 0x96, 0xFD, 0x7F, 0xD5, 0xFD, 0x70,
+    0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFE, 0x74, 0xFF, 0xFA, 0x76, 0x9F, 0xFA, 0x77, 0x49,
+    0x97, 0x70, 0x77, 0x9D, 0xA7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x19, 0xAA, 0x92, 0xE9, 0x69, 0xFE,
+    0xAE, 0xA6, 0xAF, 0xFE, 0xA6, 0xFD, 0xAF, 0xCA, 0x6A, 0xF2, 0x9F, 0xA5, 0x9F, 0x4F, 0xC5, 0xFA,
+    0x4A, 0xF5, 0xF9, 0x4A, 0xF4, 0xAF, 0x5A, 0xF4, 0xFC, 0x5F, 0xA4, 0xFA, 0x5F, 0x94, 0xFA, 0x49,
+    0xF5, 0xFA, 0x4F, 0xA5, 0xFC, 0x3A, 0xF6, 0xAF, 0x91, 0xAF, 0x96, 0x9F, 0xFE, 0x97, 0x0A, 0xFF,
+    0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x99, 0x74, 0x70, 0x99, 0x99, 0x99, 0x97, 0x19, 0xAF, 0xFF, 0x95,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE1, 0xAE, 0xA0, 0x9F, 0x91, 0xAF, 0xC9, 0x0A, 0xE1, 0xAF, 0x3A,
+    0xFA, 0x09, 0xDA, 0x1F, 0xC3, 0x9F, 0xC2, 0x92, 0xFC, 0x39, 0xFC, 0x6F, 0xA3, 0x9F, 0xA5, 0x9F,
+    0x93, 0xAF, 0x95, 0xAF, 0x4F, 0xC6, 0xFC, 0x3F, 0xC9, 0x6F, 0xC9, 0x9A, 0xFC, 0xA6, 0x9F, 0xFF,
+    0x97, 0x9F, 0xFD, 0x97, 0x1A, 0xFA, 0xAA, 0x97, 0x4F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A,
+    0xF9, 0x77, 0xFC, 0x76, 0x9F, 0xFA, 0x72, 0xFF, 0xE7, 0x2F, 0xFE, 0x71, 0x74, 0x9A, 0xDA, 0x97,
+    0x5F, 0xEA, 0x73, 0xFF, 0xC7, 0x2F, 0x99, 0xEA, 0x71, 0x9E, 0x92, 0xAA, 0x72, 0xF7, 0x70, 0xEA,
+    0x77, 0xAE, 0x97, 0x7F, 0x3A, 0xA9, 0x71, 0xEA, 0x1A, 0xFC, 0x79, 0xE9, 0x0F, 0xE9, 0x6A, 0xE9,
+    0xFF, 0xA6, 0xFE, 0x90, 0xFC, 0x6F, 0xD2, 0xAF, 0x59, 0xFC, 0x92, 0xAF, 0x59, 0xFA, 0x3F, 0xC5,
+    0xAF, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xF4, 0x9F, 0x59, 0xF4, 0xFA, 0x5A, 0xEA, 0x39, 0xF9, 0x5F,
+    0x93, 0xFA, 0x6F, 0xA2, 0xFC, 0x69, 0xFF, 0xF7, 0xAF, 0xFE, 0x70, 0xFF, 0xDA, 0x71, 0xF9, 0x19,
+    0x97, 0x3F, 0x77, 0x9F, 0x77, 0xAF, 0x77, 0xFC, 0x97, 0x4A, 0xFF, 0xC7, 0x2F, 0xFD, 0x72, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x71, 0x69, 0xAA, 0x72, 0xAE, 0x71, 0x9F, 0x71, 0xFA, 0x71, 0xFA, 0x69,
+    0xAF, 0xFD, 0x1A, 0xFF, 0xEA, 0x1F, 0xFF, 0x5F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1F,
+    0xC7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF2, 0x9A, 0x4F, 0xC1, 0xAD, 0x93, 0xFC, 0xAF,
+    0xA3, 0xFF, 0xD9, 0x3A, 0xFF, 0xC5, 0xFF, 0xC7, 0x91, 0xEA, 0x72, 0xE7, 0x29, 0xE5, 0x9C, 0x2E,
+    0x94, 0x9D, 0xA9, 0xAE, 0x5A, 0xFE, 0x69, 0xFD, 0x70, 0x9A, 0xCA, 0x97, 0x39, 0xAF, 0xFF, 0xEA,
+    0x1A, 0xFF, 0xFF, 0xDA, 0x0F, 0xFF, 0xFF, 0x99, 0xFA, 0x99, 0xAF, 0xA9, 0x99, 0xAE, 0x0A, 0xEA,
+    0x2A, 0xF9, 0x2A, 0xE0, 0xAE, 0x92, 0xFC, 0x3A, 0xDA, 0x09, 0xE9, 0x2F, 0xC3, 0xAD, 0x92, 0xAA,
+    0x3F, 0xA3, 0xAA, 0x97, 0x09, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7,
+    0x79, 0xF9, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC,
+    0x76, 0x9F, 0xEA, 0x73, 0xFF, 0xDA, 0x72, 0xFF, 0xD9, 0x70, 0x71, 0x9A, 0xDA, 0x97, 0x1F, 0xEA,
+    0x7F, 0xFC, 0x6F, 0xA9, 0xEA, 0x5A, 0xEA, 0x2C, 0xA6, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9,
+    0x70, 0x9A, 0xFF, 0xD3, 0xAF, 0xFE, 0xA3, 0xFF, 0xF7, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAF,
+    0x73, 0xFC, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xAF, 0x39, 0x95, 0xFC, 0x2A, 0xD5, 0xFC,
+    0xAA, 0xF5, 0xFF, 0xD9, 0x5A, 0xFF, 0x97, 0xFD, 0x97, 0x39, 0x97, 0x10, 0x0A, 0xFF, 0xFF, 0xE1,
+    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x9E, 0xA9, 0x99, 0xFC, 0x99, 0x99, 0xEA, 0x0A, 0xE3, 0xFC,
+    0x3E, 0x90, 0xAD, 0xA2, 0x9F, 0xA3, 0xE1, 0xAD, 0x92, 0xAF, 0x92, 0x9D, 0xA2, 0xAA, 0x3F, 0xC3,
+    0x9A, 0xA7, 0x1F, 0xC7, 0x70, 0xFA, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7,
+    0x79, 0xFA, 0x77, 0x9F, 0x97, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF,
+    0x97, 0x7A, 0xF7, 0x70, 0xFC, 0x77, 0x0F, 0xC2, 0x97, 0x4F, 0xC1, 0x9C, 0x97, 0x3F, 0xC9, 0x9D,
+    0xA7, 0x3A, 0xFF, 0xA7, 0x4F, 0xF9, 0x74, 0x9F, 0xD9, 0x77, 0x99, 0x99, 0x72, 0x77, 0x77, 0x77,
+    0x49, 0xE9, 0x77, 0x79, 0xF7, 0x77, 0xAE, 0xA7, 0x76, 0xAF, 0x19, 0xFF, 0xCA, 0x2A, 0xFF, 0xE9,
+    0x1F, 0xFD, 0x92, 0xFF, 0xDA, 0x3A, 0xFF, 0x93, 0xAF, 0xDA, 0x97, 0xAF, 0x97, 0xAF, 0x71, 0xAF,
+    0x70, 0xFA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9,
+    0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA,
+    0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF7, 0x2F, 0xC7,
+    0xAF, 0x72, 0xFC, 0x7F, 0x97, 0x2F, 0xCA, 0x49, 0xFC, 0x73, 0xFE, 0xAA, 0xAF, 0xD9, 0x73, 0x9F,
+    0xFF, 0xD9, 0x75, 0x9F, 0xFF, 0x97, 0x70, 0xAF, 0xF9, 0x77, 0x59, 0x99, 0x77, 0x20, 0x77, 0x29,
+    0xDA, 0x77, 0x3A, 0xE7, 0x73, 0xF4, 0x99, 0xA9, 0x69, 0x9A, 0xF2, 0x9F, 0xD9, 0x4F, 0xDA, 0x3F,
+    0xEA, 0x3A, 0xF9, 0x5A, 0xAA, 0xFA, 0x3A, 0xF7, 0x1F, 0x93, 0xFA, 0x71, 0xF4, 0xF7, 0x19, 0xF3,
+    0x9F, 0x71, 0xAE, 0xA3, 0xAF, 0x71, 0xF9, 0x3F, 0xA7, 0x09, 0xF3, 0x9F, 0x97, 0x0A, 0xF3, 0xFC,
+    0x71, 0xF9, 0x2A, 0xFC, 0x71, 0xF2, 0x9F, 0xD7, 0x09, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x49, 0xF9,
+    0xAE, 0x0F, 0xEA, 0x49, 0xFF, 0x1F, 0xE5, 0x9F, 0xE2, 0xFD, 0x96, 0xAF, 0xA3, 0x9E, 0xA7, 0x29,
+    0x97, 0x97, 0x00, 0x19, 0x4D, 0x92, 0xAE, 0x2A, 0xF2, 0xF9, 0x19, 0xF3, 0xEA, 0x3A, 0xC9, 0x60,
+    0x71, 0x9C, 0x4E, 0x2A, 0xE9, 0x09, 0xF1, 0xF1, 0xAE, 0x91, 0xE3, 0x9C, 0x73, 0x77, 0x1A, 0xD9,
+    0x6F, 0xC5, 0xAF, 0xCA, 0x3A, 0xEA, 0xE2, 0x9E, 0x1E, 0x90, 0x9E, 0x92, 0xDA, 0x0E, 0x93, 0xAC,
+    0x97, 0x30, 0x19, 0xDA, 0x29, 0xA1, 0xAF, 0xA1, 0xDA, 0x0F, 0xDA, 0xE9, 0x9D, 0x90, 0xFD, 0x1C,
+    0xA1, 0x9F, 0x70, 0x93, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD0, 0x9F, 0xFD, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x10, 0x1A, 0x95, 0x91, 0xDA, 0x49, 0xC1, 0xEA, 0x2A, 0xD1, 0xFF, 0xC9, 0x19,
+    0xFE, 0x94, 0xAE, 0xA3, 0x19, 0xAA, 0x1F, 0x99, 0xF9, 0x9F, 0x1E, 0x92, 0x92, 0x74, 0x9E, 0x2E,
+    0x1F, 0x1F, 0x99, 0xF1, 0xF9, 0x9E, 0x91, 0xEA, 0x29, 0x49, 0x20, 0x19, 0xAD, 0xA9, 0x1F, 0xE9,
+    0xAD, 0xA9, 0xEA, 0xDA, 0x1A, 0xDA, 0x0A, 0x91, 0xE4, 0xE9, 0x2F, 0x4D, 0xA5, 0xD9, 0x74, 0x39,
+    0xA9, 0x4A, 0xFC, 0x91, 0x9E, 0xAE, 0x1D, 0xA1, 0x9D, 0x1D, 0x92, 0xD1, 0xD9, 0x1A, 0xD1, 0xE9,
+    0xAD, 0xA1, 0x9F, 0xCA, 0x39, 0xAC, 0xA9, 0x20, 0x77, 0x0A, 0xC9, 0x2D, 0x39, 0xE1, 0xAE, 0x2F,
+    0x09, 0xEA, 0x1F, 0x1F, 0x1A, 0xE1, 0xAE, 0x2E, 0x19, 0xE3, 0xD2, 0x9C, 0xA7, 0x70, 0x09, 0x59,
+    0xA1, 0xAD, 0x3A, 0xE0, 0xAD, 0x91, 0xAE, 0x19, 0xE0, 0xAE, 0x3F, 0xE4, 0x9F, 0xC9, 0x5F, 0x96,
+    0x9D, 0xA5, 0x74, 0xA9, 0x2A, 0x92, 0xE1, 0xE2, 0xE1, 0xE2, 0xE9, 0x0E, 0x91, 0x9E, 0x09, 0xE2,
+    0xAD, 0x1A, 0xD3, 0xD2, 0xD7, 0x30, 0x4A, 0xAA, 0x93, 0x9F, 0xE1, 0x9F, 0xFA, 0x0E, 0x99, 0x9F,
+    0x9C, 0xA4, 0xE9, 0x95, 0xAA, 0x73, 0x71, 0x9D, 0x2A, 0xD2, 0x9D, 0x92, 0xE2, 0xAD, 0xA2, 0xEA,
+    0x2F, 0x2A, 0xE9, 0x2A, 0xA9, 0x20, 0x19, 0xE2, 0xFA, 0x19, 0xF2, 0xEA, 0x19, 0xE2, 0xAD, 0xA1,
+    0x9E, 0x19, 0xE2, 0x9C, 0xA3, 0x1E, 0x1F, 0x9A, 0xE9, 0x0F, 0x1E, 0xA1, 0xAD, 0xA1, 0x9E, 0x2A,
+    0xD9, 0x2A, 0xA1, 0x19, 0x4E, 0x19, 0xE1, 0xAE, 0x1E, 0x91, 0xE2, 0xD9, 0x19, 0xD3, 0x93, 0x1A,
+    0xD9, 0x1F, 0x1E, 0xA0, 0x9E, 0x90, 0xE9, 0x0A, 0xD9, 0x1C, 0xA7, 0x10, 0x29, 0x29, 0xE1, 0xF9,
+    0x9F, 0x99, 0xEA, 0x19, 0xA9, 0x10, 0x1D, 0xA2, 0xAD, 0x1F, 0x1F, 0x99, 0xF1, 0xF9, 0x9E, 0x91,
+    0xEA, 0x19, 0x94, 0x99, 0x10, 0x29, 0x94, 0xFA, 0x1D, 0xAA, 0xD9, 0x9C, 0xA1, 0xAC, 0xAA, 0xCA,
+    0x1A, 0xCA, 0x9D, 0x99, 0xD1, 0xFC, 0x92, 0x9A, 0xA2, 0x39, 0x39, 0xE2, 0x9E, 0x92, 0xE9, 0x2E,
+    0x2A, 0xD2, 0xAD, 0x92, 0x99, 0x30, 0x29, 0x99, 0x3A, 0xF2, 0xAF, 0x4E, 0x39, 0xE2, 0x9E, 0x2F,
+    0x3A, 0xA9, 0x30, 0x39, 0x93, 0x9D, 0x4D, 0x4D, 0xA4, 0xDA, 0x39, 0xE9, 0x99, 0x1F, 0xD1, 0x9E,
+    0xA1, 0x69, 0xE9, 0x0A, 0xE1, 0xF1, 0xEA, 0x1E, 0x90, 0x9E, 0x1A, 0xE1, 0x9A, 0xA9, 0x10, 0x77,
+    0x2A, 0xD9, 0x7A, 0xF9, 0x5A, 0xFD, 0x4A, 0xEA, 0xEA, 0x2F, 0x19, 0xE1, 0xEA, 0x3A, 0xD2, 0xA9,
+    0x59, 0x10, 0x1A, 0x69, 0x1D, 0xA4, 0x9C, 0x1E, 0xA2, 0xAD, 0x1F, 0xFC, 0x91, 0x9F, 0xEA, 0x4A,
+    0xEA, 0x30, 0x75, 0xAE, 0x2A, 0xC1, 0xAF, 0xC1, 0xDA, 0x9F, 0xFD, 0x99, 0xD1, 0xFC, 0xA1, 0xAA,
+    0x2E, 0xA7, 0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD0, 0x9F, 0xFD, 0x1A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x90, 0x49, 0xAA, 0x95, 0xAF, 0xD9, 0x2F, 0xFC, 0x1E, 0xA9, 0x9A, 0xE1, 0xD4, 0xE1,
+    0xA5, 0x9C, 0x97, 0x40, 0x71, 0x97, 0x2A, 0xCA, 0x70, 0x9E, 0x97, 0xF7, 0xF9, 0x6A, 0xE7, 0x0E,
+    0x71, 0xAA, 0x79, 0x49, 0x92, 0x9E, 0x91, 0xEA, 0x1F, 0x90, 0xAE, 0xA1, 0xF1, 0xF9, 0x1E, 0x91,
+    0x9D, 0xA7, 0x60, 0x0A, 0xAA, 0x19, 0xDA, 0x1A, 0xD9, 0x1F, 0x99, 0xFC, 0x99, 0xE9, 0x60, 0x77,
+    0x09, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9, 0x77, 0x1F, 0xEA,
+    0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F, 0x97, 0x5F, 0x2F,
+    0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F, 0x99, 0x99, 0x9A,
+    0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xAE,
+    0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9, 0x6A, 0xFE, 0x90,
+    0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x71, 0x99, 0x99, 0x99, 0x73, 0xAF,
+    0xFE, 0x96, 0x9F, 0xFF, 0xDA, 0x5A, 0xFF, 0xAF, 0xD9, 0x49, 0x99, 0x9F, 0x91, 0x9F, 0xC7, 0x9F,
+    0x92, 0xAF, 0x7A, 0xF3, 0x9F, 0x7F, 0xC3, 0x9F, 0x7F, 0xA3, 0xAE, 0xA6, 0x9F, 0x93, 0xF7, 0x9F,
+    0xA9, 0x90, 0xF9, 0x7A, 0xFF, 0xE9, 0x70, 0xFF, 0xFC, 0x97, 0xFC, 0xAA, 0xFE, 0x69, 0xF9, 0x3F,
+    0xCA, 0x5A, 0xF4, 0x9F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFA, 0x5F, 0xA4, 0x9F, 0x94,
+    0xAF, 0x5A, 0xF4, 0xAF, 0xA3, 0x9F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0x94, 0xFF, 0xFC, 0xA9, 0x77,
+    0x73, 0x5F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF5, 0x9F, 0xFF, 0xF7, 0x0F, 0xC0, 0x99, 0x99, 0xF7, 0x9F,
+    0xA4, 0xEA, 0x7A, 0xF9, 0x4E, 0x97, 0xFC, 0x5E, 0x70, 0xFC, 0x5D, 0x97, 0x9F, 0xA5, 0x97, 0x19,
+    0xF9, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x0A, 0xF9, 0x77,
+    0x0F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x69, 0xFF, 0xA7,
+    0x3A, 0xFF, 0xD9, 0x72, 0xFF, 0xE7, 0x20, 0x76, 0x99, 0x77, 0x1A, 0xEA, 0x77, 0xAF, 0xC7, 0x69,
+    0xFD, 0x76, 0xFE, 0x75, 0xAF, 0xE9, 0x74, 0xE9, 0xFA, 0x73, 0xF0, 0xAF, 0x72, 0x9E, 0x90, 0x9F,
+    0x72, 0xF1, 0x9F, 0x71, 0xAE, 0x92, 0xF9, 0x70, 0xEA, 0x3F, 0xA7, 0xAE, 0x4F, 0xC6, 0x9E, 0xA4,
+    0xAF, 0x6F, 0x5A, 0xF5, 0xAE, 0xA5, 0x9F, 0x94, 0xF6, 0x9F, 0xA3, 0xAE, 0x97, 0xFC, 0x29, 0xF7,
+    0x0F, 0xC2, 0xF9, 0x70, 0xFC, 0x19, 0xF9, 0x70, 0xFC, 0x90, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF,
+    0xA0, 0xFF, 0xFF, 0xF0, 0x5F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2,
+    0x99, 0xAE, 0x79, 0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09,
+    0xFA, 0x77, 0x09, 0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA,
+    0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E,
+    0xA6, 0xAF, 0x93, 0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x30,
+    0x39, 0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0xEA, 0x99, 0x3A, 0xFC, 0x92, 0x9E,
+    0x59, 0xFC, 0xA3, 0x9E, 0x5F, 0xCA, 0x5D, 0x94, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F,
+    0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC,
+    0x94, 0x9A, 0x94, 0x9F, 0xCA, 0x5E, 0x4F, 0xCA, 0x59, 0xE3, 0xFD, 0x6F, 0x2A, 0xFC, 0x59, 0xAF,
+    0x19, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFC, 0x3A, 0xFF, 0xFE, 0xA7, 0x77, 0x5F, 0xFD, 0x2A, 0xFF,
+    0xC9, 0x4A, 0xFF, 0xCA, 0x2F, 0xFD, 0x59, 0xFF, 0xA3, 0xAF, 0xEA, 0x97, 0x0F, 0xC7, 0xAF, 0x97,
+    0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7, 0x2F, 0xC7, 0x9F, 0xA7, 0x2F, 0xC7, 0xAF, 0x97,
+    0x19, 0xFA, 0x7A, 0xF7, 0x29, 0xFA, 0x7F, 0xC7, 0x2A, 0xFF, 0xFF, 0xD7, 0x2F, 0xFF, 0xFD, 0xA7,
+    0x2F, 0xFF, 0xFD, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7, 0x2F, 0xC7, 0x0F, 0xA7,
+    0x2F, 0xC7, 0x9F, 0x97, 0x2F, 0xC7, 0xAF, 0x97, 0x19, 0xFA, 0x7F, 0xC7, 0x2A, 0xF9, 0x7F, 0xC7,
+    0x09, 0xFE, 0xA9, 0x3A, 0xFE, 0xA5, 0xAF, 0xFC, 0xA2, 0xFF, 0xD5, 0xFF, 0xD9, 0x19, 0xFF, 0xD4,
+    0x73, 0x99, 0x99, 0x97, 0x7A, 0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0x96, 0xFD, 0x92,
+    0xAF, 0xD5, 0xFC, 0xA5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7A, 0xFC, 0x3F, 0xC7, 0x1F, 0xC2, 0xAF, 0xA7,
+    0x1F, 0xC9, 0x1F, 0xC7, 0x2F, 0xC9, 0x09, 0xFC, 0x79, 0x90, 0xFC, 0x90, 0xAF, 0xA0, 0x9F, 0xEA,
+    0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xF9, 0x0F, 0xC1, 0xFC, 0x90, 0xFE, 0xA1, 0xFC, 0x1F, 0xC7, 0x29,
+    0xFA, 0x1F, 0xC9, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC2, 0xFC, 0xA7, 0x0F, 0xC9, 0x2A, 0xFC,
+    0x7A, 0xFC, 0x4F, 0xCA, 0x5A, 0xFC, 0x5A, 0xFD, 0x90, 0x99, 0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF,
+    0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x5F, 0xFD, 0x5A, 0xFF, 0xD5, 0x9F, 0xFA, 0x71,
+    0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A,
+    0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC,
+    0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x70, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x40, 0x5F,
+    0xFD, 0x1F, 0xFA, 0x4A, 0xFF, 0xCA, 0x09, 0xFF, 0x94, 0x9F, 0xFA, 0x29, 0xFD, 0x97, 0x0F, 0xA4,
+    0x9F, 0xA7, 0x19, 0xF9, 0x3A, 0xF9, 0x72, 0xAF, 0x3A, 0xF9, 0x73, 0xFC, 0x2A, 0xF7, 0x5F, 0xC1,
+    0xAF, 0x75, 0x9F, 0xA0, 0xFC, 0x76, 0x9F, 0x9F, 0xA7, 0x7A, 0xFF, 0xA7, 0x70, 0xFF, 0xC7, 0x71,
+    0xFF, 0xCA, 0x77, 0x9F, 0xAF, 0xC9, 0x76, 0xAF, 0x99, 0xFC, 0x76, 0xFC, 0x1A, 0xFC, 0x75, 0xFC,
+    0x2F, 0xCA, 0x74, 0xFA, 0x29, 0xFC, 0x97, 0x29, 0xF9, 0x3F, 0xD9, 0x71, 0xAF, 0x5F, 0xD9, 0x69,
+    0xFE, 0xA3, 0x9F, 0xDA, 0x4A, 0xFF, 0xCA, 0x39, 0xFE, 0x3F, 0xFD, 0x94, 0x9F, 0xC7, 0x77, 0x95,
+    0x77, 0x99, 0x97, 0x73, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x2F, 0xD7, 0x71, 0x9F, 0xD9, 0x77, 0x0F,
+    0xE9, 0x77, 0xAE, 0xAE, 0xA7, 0x7E, 0xA9, 0xF7, 0x6A, 0xE0, 0x9F, 0x75, 0x9E, 0x91, 0xF7, 0x5F,
+    0x2F, 0x97, 0x39, 0xE9, 0x2F, 0xA7, 0x3F, 0x3F, 0xC7, 0x2A, 0xE9, 0x3A, 0xF7, 0x2F, 0x4A, 0xF7,
+    0x1F, 0x94, 0x9F, 0x97, 0x9E, 0xA6, 0xFA, 0x7F, 0x7F, 0xA6, 0xAE, 0xA7, 0xFC, 0x6F, 0x70, 0xFC,
+    0x5A, 0xEA, 0x70, 0xAF, 0x92, 0x9A, 0xFA, 0x95, 0x9A, 0xFD, 0xA9, 0xAF, 0xF9, 0x3A, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xDA, 0x69, 0xFF, 0x7A, 0xFE, 0x7A, 0xFF, 0x69, 0xFF, 0x70, 0xAF, 0xE6, 0xFE, 0xA7,
+    0x2A, 0xFD, 0x94, 0x9F, 0xD9, 0x73, 0xFE, 0x94, 0xFE, 0x97, 0x29, 0xFE, 0x93, 0x9F, 0xE9, 0x72,
+    0xAE, 0xAE, 0xA3, 0xE9, 0xF7, 0x3E, 0xAA, 0xEA, 0x29, 0xE0, 0xF7, 0x3E, 0x09, 0xF2, 0xE9, 0x0F,
+    0x72, 0xAE, 0x09, 0xF1, 0xAE, 0x09, 0xF7, 0x2E, 0xA1, 0xF1, 0xE1, 0x9F, 0x72, 0xE9, 0x1F, 0x9A,
+    0xDA, 0x1A, 0xF7, 0x19, 0xE2, 0xFA, 0xE2, 0xAF, 0x71, 0xF2, 0xAF, 0xDA, 0x2A, 0xF7, 0x1E, 0x92,
+    0x9F, 0xD3, 0xFA, 0x70, 0x9E, 0x39, 0xFC, 0xA3, 0xFA, 0x70, 0xAE, 0x4F, 0xC4, 0xFA, 0x70, 0xEA,
+    0x4F, 0x94, 0xFA, 0x79, 0xE9, 0x4A, 0xE5, 0xFA, 0x7A, 0xE5, 0xAD, 0x95, 0xF9, 0x59, 0xAF, 0xA9,
+    0x72, 0x9A, 0xFE, 0x92, 0xAF, 0xF7, 0x19, 0xFF, 0xCA, 0x2F, 0xFC, 0x71, 0xAF, 0xFC, 0x91, 0x4F,
+    0xE6, 0xFF, 0xC4, 0xAF, 0xE9, 0x49, 0xFF, 0xC5, 0xFF, 0x5A, 0xFD, 0xA7, 0x0F, 0xD9, 0x6F, 0x71,
+    0x9F, 0xDA, 0x6E, 0xA7, 0x1A, 0xFE, 0x59, 0xE9, 0x71, 0xFF, 0xA4, 0xAE, 0x97, 0x1F, 0xFC, 0x4F,
+    0x72, 0xEA, 0xFC, 0x93, 0xF7, 0x19, 0xE9, 0x9F, 0xC3, 0xEA, 0x71, 0xAE, 0x1F, 0xC9, 0x19, 0xE9,
+    0x71, 0xF1, 0x9F, 0xC1, 0xAE, 0x72, 0xF2, 0xFC, 0x1F, 0x71, 0x9E, 0xA2, 0xAF, 0xA0, 0xF7, 0x1A,
+    0xE9, 0x3F, 0xC9, 0xEA, 0x71, 0xAE, 0x4A, 0xFF, 0x97, 0x1F, 0x5F, 0xF7, 0x2E, 0xA5, 0xAF, 0xE7,
+    0x19, 0xE9, 0x59, 0xFD, 0xA7, 0x1A, 0xE9, 0x6F, 0xDA, 0x70, 0xAF, 0xCA, 0x59, 0xFC, 0x96, 0x9F,
+    0xFA, 0x5F, 0xC7, 0xFF, 0xC9, 0x59, 0xF7, 0x77, 0x09, 0x97, 0x10, 0x4A, 0xFF, 0xFF, 0x94, 0xFF,
+    0xFF, 0xC5, 0xFF, 0xFF, 0xC4, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF4, 0xAE, 0x71, 0xAD, 0xA4,
+    0xAD, 0xA7, 0x1E, 0x94, 0xAD, 0x72, 0xE6, 0x99, 0x72, 0x99, 0x77, 0x77, 0x70, 0x99, 0x74, 0xFF,
+    0xD7, 0x4F, 0xFD, 0x73, 0xAF, 0xFC, 0xA7, 0x49, 0x77, 0x77, 0x71, 0x97, 0x39, 0x95, 0xE7, 0x29,
+    0xDA, 0x39, 0xE7, 0x2A, 0xDA, 0x3A, 0xE7, 0x2E, 0xA3, 0xFA, 0xAA, 0x99, 0x99, 0xAA, 0xAA, 0xE9,
+    0x3F, 0xFF, 0xFD, 0x93, 0xFF, 0xFF, 0xD3, 0x9F, 0xFF, 0xFD, 0x30, 0x73, 0x99, 0x99, 0x97, 0x7A,
+    0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0x96, 0xFD, 0xA9, 0x99, 0xAF, 0xD5, 0xFD, 0x59,
+    0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xC9, 0x79, 0xFC, 0x2A, 0xFC, 0x70, 0x9F, 0xC9, 0x1F, 0xC9,
+    0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFC, 0x71, 0x9F, 0xC9, 0x0F, 0xCA, 0x71, 0x9F,
+    0xC1, 0xFC, 0xA7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0xFC, 0xA1, 0xFC, 0xA7, 0x1F, 0xC9, 0x1F, 0xCA,
+    0x70, 0xAF, 0xC2, 0xFD, 0x70, 0xFC, 0x92, 0xAF, 0xC9, 0x6F, 0xD4, 0xFD, 0x5F, 0xD5, 0xAF, 0xDA,
+    0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xE7, 0x1F, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x71, 0x99, 0x74, 0x5F,
+    0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xFD, 0x94, 0x9F, 0xFF, 0xFF, 0xC9, 0x70, 0xFC, 0x99, 0x99,
+    0x99, 0x9F, 0xC9, 0x71, 0x9F, 0xA6, 0xFC, 0x72, 0xAF, 0x96, 0xFC, 0x72, 0xFC, 0x7F, 0xC7, 0x2F,
+    0xC6, 0x9F, 0xA7, 0x19, 0xFA, 0x6A, 0xF9, 0x71, 0x9F, 0x96, 0xFC, 0x72, 0xAF, 0x96, 0xFC, 0x72,
+    0xFC, 0x69, 0xFA, 0x72, 0xFC, 0x69, 0xF9, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x1A, 0xF9, 0x6F, 0xC7,
+    0x2F, 0xC7, 0xFC, 0x72, 0xFC, 0x69, 0xFA, 0x72, 0xFC, 0x6A, 0xF9, 0x71, 0x9F, 0xA6, 0xFC, 0x72,
+    0xAF, 0x96, 0xFC, 0x70, 0x9F, 0xEA, 0x92, 0xAF, 0xEA, 0x5A, 0xFF, 0xCA, 0x1F, 0xFD, 0x94, 0xFF,
+    0xD9, 0x09, 0xFF, 0xD4, 0x71, 0x99, 0x99, 0x99, 0x74, 0xAF, 0xFE, 0xA7, 0x9F, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xF5, 0x9A, 0x99, 0xFA, 0x1A, 0xFC, 0xA7, 0x9F, 0x92, 0xAF, 0xC7, 0xAF, 0x4F, 0xC7, 0xFC,
+    0x4F, 0xC7, 0xFC, 0x4F, 0xC6, 0x9F, 0xA3, 0x9F, 0xA6, 0x9F, 0x93, 0xFC, 0x7A, 0xF3, 0xFC, 0xA7,
+    0xFC, 0x99, 0xAF, 0xCA, 0x70, 0xFF, 0xF9, 0x70, 0x9F, 0xFD, 0xA7, 0x2A, 0xFC, 0xAA, 0x97, 0x5F,
+    0xC7, 0x71, 0xFC, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x69, 0xFF, 0xA7, 0x3A,
+    0xFF, 0xD9, 0x72, 0xFF, 0xE7, 0x20, 0x4A, 0xFF, 0xFE, 0x5F, 0xFF, 0xF4, 0xAF, 0xFF, 0xF5, 0xFC,
+    0x6E, 0xA5, 0xAF, 0xA5, 0xE9, 0x6F, 0xC5, 0xAD, 0x79, 0xFA, 0x4A, 0xCA, 0x70, 0xFC, 0x97, 0x79,
+    0xFC, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x70, 0xFA, 0x77, 0xFA, 0x77, 0xFC, 0x77, 0xAF, 0x77,
+    0xAF, 0x5D, 0x96, 0xAF, 0x59, 0xDA, 0x5A, 0xF6, 0xEA, 0x4A, 0xF6, 0x9E, 0x93, 0xAF, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xF3, 0x9F, 0xFF, 0xFC, 0x39, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x77, 0x72, 0x0A, 0xFF,
+    0xFF, 0xE1, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x9E, 0xA9, 0x99, 0xFC, 0x99, 0x99, 0xEA, 0x0A,
+    0xE3, 0xFC, 0x3E, 0x90, 0xAD, 0xA2, 0x9F, 0xA3, 0xE1, 0xAD, 0x92, 0xAF, 0x92, 0x9D, 0xA2, 0xAA,
+    0x3F, 0xC3, 0x9A, 0xA7, 0x1F, 0xC7, 0x70, 0xFA, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77,
+    0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA,
+    0x75, 0x9A, 0xFD, 0xA9, 0x72, 0xAF, 0xFD, 0x72, 0xFF, 0xDA, 0x71, 0x49, 0x97, 0x29, 0x94, 0x9F,
+    0x97, 0x0A, 0xE9, 0x1F, 0xE7, 0xFD, 0x0A, 0xFE, 0x95, 0xAF, 0xC9, 0x19, 0x0A, 0xFA, 0x5F, 0xC9,
+    0x5F, 0xC4, 0xFC, 0x7F, 0xC3, 0x9F, 0x97, 0x9F, 0x92, 0xF9, 0x71, 0xFA, 0x1A, 0xEA, 0x72, 0xFA,
+    0x1F, 0x73, 0x9F, 0x0A, 0xE7, 0x5F, 0x0E, 0x97, 0x5F, 0xF7, 0x6A, 0xFD, 0x77, 0xAF, 0xCA, 0x77,
+    0x9F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x76,
+    0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xD7, 0x3A, 0xFF, 0xD7, 0x10, 0x71, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x74, 0x9F, 0xFC, 0xA7, 0x5A, 0xFE, 0xA7, 0x70, 0xFA, 0x77, 0x19, 0xF9, 0x75, 0x9A, 0xFF, 0xDA,
+    0x97, 0xAF, 0xFF, 0xF4, 0x9F, 0xDA, 0xFC, 0xAF, 0xD2, 0x9F, 0xC2, 0xF9, 0x1F, 0xC9, 0x1F, 0xC2,
+    0x9F, 0x3F, 0xC0, 0xAF, 0x92, 0x9F, 0x3F, 0xC0, 0xFC, 0x3A, 0xF3, 0xFC, 0x0F, 0xA3, 0xFA, 0x3F,
+    0xC0, 0xFA, 0x3F, 0x93, 0xFA, 0x0F, 0xC2, 0x9F, 0x3A, 0xF1, 0xFC, 0x2A, 0xF2, 0xAF, 0xA1, 0x9F,
+    0xC9, 0x0F, 0xA1, 0xAF, 0xA3, 0xFF, 0xFF, 0xDA, 0x5A, 0xFF, 0xFD, 0xA7, 0x19, 0xAF, 0xEA, 0xA9,
+    0x76, 0xAF, 0x77, 0x2F, 0xC7, 0x79, 0xFF, 0xC7, 0x5F, 0xFD, 0x75, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x70, 0x4A, 0xFF, 0xC2, 0xFF, 0xA4, 0xFF, 0xCA, 0x19, 0xFF, 0x94, 0xAF, 0xE9, 0x39, 0xFC, 0xA9,
+    0x7A, 0xFA, 0x5F, 0x97, 0x2F, 0xC4, 0xF9, 0x73, 0xAF, 0xA2, 0xAE, 0x97, 0x5F, 0xC1, 0xAE, 0xA7,
+    0x6A, 0xF9, 0x9E, 0xA7, 0x70, 0xFF, 0xA7, 0x71, 0xAF, 0xE7, 0x73, 0xFD, 0x77, 0x4F, 0xC9, 0x77,
+    0x3A, 0xFD, 0x77, 0x2A, 0xFE, 0x97, 0x70, 0x9E, 0xAF, 0xC7, 0x79, 0xEA, 0x0A, 0xF9, 0x75, 0x9F,
+    0x2F, 0xC7, 0x5F, 0x3F, 0xC9, 0x73, 0xF9, 0x39, 0xFC, 0x72, 0xF9, 0x5F, 0xC9, 0x7A, 0xFC, 0xA9,
+    0x39, 0xFD, 0xA9, 0x4F, 0xFC, 0x91, 0xFF, 0xD3, 0x9F, 0xFC, 0x19, 0xFF, 0xCA, 0x30, 0x19, 0x77,
+    0x49, 0x1A, 0xEA, 0x29, 0xFF, 0xC3, 0xFA, 0x0F, 0x91, 0xAF, 0xFC, 0x2F, 0xC1, 0xFA, 0x19, 0xFE,
+    0xA2, 0xAF, 0x2F, 0xA3, 0xAF, 0x4F, 0xA2, 0xFA, 0x3F, 0xC3, 0xAF, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3,
+    0xFA, 0x3F, 0x93, 0xF9, 0x3F, 0x92, 0x9F, 0x39, 0xF4, 0xF9, 0x2A, 0xF3, 0xFA, 0x4F, 0xA2, 0xFC,
+    0x3F, 0x5F, 0xA2, 0xFA, 0x2A, 0xEA, 0x5A, 0xF2, 0xF9, 0x19, 0xF6, 0x9F, 0xA0, 0x9F, 0x1A, 0xF9,
+    0x7F, 0xFE, 0xAF, 0xCA, 0x70, 0x9F, 0xFF, 0xE9, 0x73, 0xAF, 0xFE, 0x97, 0x79, 0xAF, 0xA9, 0x77,
+    0x3A, 0xF7, 0x75, 0xAF, 0x77, 0x5F, 0xA7, 0x73, 0xAF, 0xEA, 0x77, 0x0F, 0xFD, 0x77, 0x9F, 0xFD,
+    0x74, 0x75, 0x99, 0x99, 0x97, 0x71, 0x9F, 0xFC, 0xA7, 0x49, 0xFF, 0xFC, 0x72, 0xAF, 0xFF, 0xE7,
+    0x0F, 0xDA, 0x3A, 0xFC, 0xA6, 0xAF, 0xC6, 0x9F, 0xC5, 0x9F, 0xC7, 0x0F, 0xC9, 0x4F, 0xC9, 0x70,
+    0xAF, 0x94, 0xFC, 0x71, 0xAF, 0xA3, 0x9F, 0xA7, 0x1A, 0xF9, 0x3A, 0xF9, 0x71, 0xAF, 0x93, 0xAF,
+    0x97, 0x1F, 0xC4, 0xAF, 0x97, 0x1F, 0xA4, 0xAF, 0x97, 0x09, 0xF9, 0x49, 0xF9, 0x70, 0xFA, 0x6F,
+    0x97, 0xAF, 0x7F, 0xA7, 0xF4, 0x9D, 0x1F, 0x6F, 0x90, 0x9C, 0xA0, 0xE1, 0xAE, 0x94, 0xF9, 0x1E,
+    0x0E, 0x2F, 0x29, 0xF2, 0x9E, 0x9E, 0x99, 0x99, 0xE9, 0x1F, 0x99, 0x99, 0xEA, 0x9F, 0xFD, 0x2F,
+    0xFE, 0x9A, 0xFF, 0xCA, 0x2F, 0xFE, 0x0F, 0xFD, 0x3F, 0xFE, 0x00, 0x79, 0xAA, 0x93, 0x9A, 0x7A,
+    0xFC, 0xA2, 0xE5, 0xFF, 0x90, 0xAE, 0xA3, 0xFF, 0xD0, 0xF3, 0xFC, 0x91, 0xEA, 0xEA, 0x29, 0xF9,
+    0x2A, 0xFD, 0x3F, 0xA3, 0x9F, 0xC9, 0x29, 0xF9, 0x4F, 0xC3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F,
+    0xA4, 0xAE, 0x94, 0xFA, 0x39, 0xF5, 0xFA, 0x3F, 0xC9, 0x4F, 0xC2, 0xFD, 0x91, 0x99, 0x0F, 0xCA,
+    0xAF, 0x9E, 0xAA, 0xCA, 0x09, 0xFF, 0xC9, 0x0F, 0xDA, 0x1F, 0xF9, 0x1F, 0xD3, 0xAF, 0xA3, 0x9E,
+    0xA6, 0x99, 0x79, 0x30, 0x72, 0x9A, 0xDA, 0x97, 0x29, 0xFE, 0xA7, 0x0A, 0xFF, 0xC9, 0x6A, 0xF9,
+    0x9F, 0xA5, 0x9F, 0x29, 0xEA, 0x5F, 0x93, 0xEA, 0x5F, 0x39, 0xEA, 0x4A, 0xEA, 0x39, 0xE9, 0x4F,
+    0x93, 0xF5, 0xF3, 0x9E, 0x95, 0xF3, 0xF5, 0x9F, 0x2F, 0x6A, 0xEA, 0x09, 0xFA, 0x6F, 0x90, 0xAF,
+    0xCA, 0x5F, 0x29, 0x9F, 0x94, 0xF4, 0xAF, 0x39, 0xF4, 0x9F, 0x3A, 0xEA, 0x49, 0xF3, 0xAE, 0xA4,
+    0x9F, 0x3F, 0x94, 0x9F, 0x3F, 0x5F, 0xA3, 0xF4, 0x9F, 0x39, 0xF9, 0x29, 0xFA, 0x3A, 0xFF, 0xFC,
+    0x4F, 0xFF, 0xA5, 0xFA, 0xFD, 0x96, 0xF2, 0x99, 0x70, 0x9F, 0x75, 0xAF, 0x75, 0xAE, 0xA7, 0x5F,
+    0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x59, 0xCA, 0x97, 0x60, 0x29, 0x9A, 0x59, 0xAA, 0x2A, 0xFC, 0x3F,
+    0xC9, 0x9F, 0xDA, 0x29, 0xFA, 0x9F, 0xE3, 0xFC, 0x29, 0xF3, 0xAE, 0xA3, 0xF9, 0x2A, 0xEA, 0x3F,
+    0x92, 0xF4, 0xAE, 0xA2, 0xF4, 0xAE, 0xA1, 0x9E, 0x94, 0x9F, 0x1F, 0x59, 0xF0, 0x9E, 0x96, 0xF0,
+    0xEA, 0x7F, 0xAE, 0x70, 0xFE, 0x97, 0x0F, 0xDA, 0x71, 0xAF, 0xC7, 0x2A, 0xF7, 0x3A, 0xE7, 0x4E,
+    0x97, 0x39, 0xE9, 0x73, 0xAE, 0x74, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF7, 0x4C, 0xAA, 0x72,
+    0x72, 0x9A, 0xCA, 0xA7, 0x3A, 0xFE, 0x71, 0xFF, 0xD7, 0xAE, 0x99, 0x9F, 0x7E, 0xA3, 0xE6, 0x9E,
+    0xA4, 0xCA, 0x69, 0xF9, 0x75, 0xFC, 0x75, 0xAF, 0xC7, 0x5F, 0xCA, 0x73, 0xAF, 0xD9, 0x70, 0xAF,
+    0xFC, 0x7F, 0xCA, 0xAF, 0xA5, 0xAF, 0x91, 0xFC, 0x49, 0xF9, 0x29, 0xF9, 0x3F, 0xA4, 0xFA, 0x29,
+    0xF5, 0xFA, 0x2A, 0xF5, 0xFA, 0x2F, 0xA5, 0xFA, 0x2F, 0xA5, 0xF9, 0x2F, 0xA4, 0xAF, 0x3F, 0xC4,
+    0xFA, 0x3A, 0xFA, 0x19, 0xFC, 0x5F, 0xFF, 0x95, 0xAF, 0xFD, 0x70, 0x9F, 0xE9, 0x74, 0x99, 0x72,
+    0x79, 0xAA, 0xA9, 0x70, 0xAF, 0xEA, 0x49, 0xFF, 0xD4, 0xFC, 0xAA, 0xF3, 0xAE, 0xA3, 0x9C, 0x93,
+    0xF9, 0x72, 0xF9, 0x72, 0x9F, 0x99, 0x97, 0x0A, 0xFD, 0x79, 0xFE, 0x6A, 0xFA, 0xAA, 0x95, 0x9F,
+    0x72, 0xFA, 0x72, 0xFA, 0x59, 0xA2, 0xFC, 0x99, 0x99, 0xAE, 0x2A, 0xFF, 0xEA, 0x3F, 0xFD, 0xA5,
+    0xAF, 0xDA, 0x97, 0x19, 0x97, 0x77, 0x3A, 0xDA, 0x72, 0xAE, 0x94, 0xA9, 0x3F, 0x39, 0xE3, 0xF9,
+    0x1A, 0xF3, 0xFF, 0xF4, 0xAF, 0xFC, 0x96, 0xAF, 0xA9, 0x70, 0xF7, 0x2F, 0x72, 0xAE, 0x97, 0x2F,
+    0x72, 0xF9, 0x71, 0x9E, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A,
+    0xF7, 0x2A, 0xF7, 0x2A, 0xFA, 0x71, 0x9F, 0xCA, 0x71, 0xFE, 0x97, 0x9F, 0xF9, 0x69, 0xFF, 0xC7,
+    0xAF, 0xF7, 0x0A, 0xFD, 0x72, 0xAF, 0x73, 0xF7, 0x2A, 0xEA, 0x69, 0xAF, 0xD7, 0xFE, 0x70, 0xFC,
+    0x97, 0x29, 0x97, 0x00, 0x39, 0xA9, 0x49, 0xA9, 0x2A, 0xFC, 0xA1, 0x9F, 0xC0, 0xFE, 0xA0, 0xAF,
+    0xD9, 0xAA, 0xAF, 0xAA, 0xFE, 0xA2, 0xAE, 0xAD, 0x99, 0xFA, 0x2F, 0xD9, 0x1F, 0x92, 0xFC, 0xA2,
+    0xF9, 0x19, 0xFC, 0x29, 0xF2, 0xAF, 0x92, 0x9F, 0x2F, 0xC3, 0xAF, 0x2F, 0xA3, 0xFA, 0x19, 0xF9,
+    0x3F, 0x91, 0x9F, 0x39, 0xF2, 0xAF, 0x3A, 0xF2, 0xFA, 0x3A, 0xEA, 0x2F, 0x93, 0xFA, 0x19, 0xF4,
+    0xF9, 0x1A, 0xEA, 0x39, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x3F,
+    0x97, 0x2A, 0xF7, 0x3A, 0xAA, 0xA5, 0x70, 0x9A, 0xDA, 0x97, 0x3F, 0xEA, 0x70, 0x9F, 0xFC, 0xA6,
+    0x9F, 0xAA, 0xFC, 0x6F, 0x92, 0xFA, 0x4F, 0xA3, 0xFC, 0x39, 0xF4, 0xAF, 0x3F, 0x94, 0x9F, 0x29,
+    0xF5, 0x9F, 0x2A, 0xEA, 0x59, 0xF2, 0xF9, 0x59, 0xF1, 0x9F, 0xA9, 0x99, 0x99, 0x9A, 0xF1, 0xAF,
+    0xFF, 0xF1, 0xFF, 0xFF, 0xA1, 0xFF, 0xAA, 0xAA, 0xFA, 0x1F, 0x96, 0xF9, 0x1F, 0x95, 0x9F, 0x2F,
+    0x95, 0xAE, 0xA2, 0xF9, 0x5F, 0x3F, 0x94, 0xAE, 0xA3, 0xFA, 0x4F, 0x4A, 0xF3, 0xFA, 0x49, 0xFA,
+    0x1F, 0xC6, 0xFF, 0xE7, 0x0F, 0xFA, 0x72, 0xFD, 0x97, 0x59, 0x97, 0x20, 0x59, 0xA3, 0x9F, 0x3F,
+    0xA2, 0x9F, 0x92, 0x9F, 0x3A, 0xF3, 0xFA, 0x3F, 0x92, 0x9F, 0x3A, 0xF3, 0xAF, 0x3F, 0xA3, 0xF9,
+    0x29, 0xF1, 0x90, 0xAF, 0xAA, 0xCA, 0xAF, 0xE9, 0xAF, 0xDA, 0x09, 0xFA, 0x49, 0x94, 0x39, 0xA9,
+    0x79, 0xA9, 0x1A, 0xFC, 0xA4, 0xAF, 0x0F, 0xEA, 0x3F, 0xD0, 0xAA, 0xAF, 0xA2, 0xFE, 0x3A, 0xE9,
+    0x1F, 0xA9, 0x94, 0xF1, 0xAE, 0x97, 0xF0, 0x9F, 0x79, 0xE9, 0x0F, 0xA7, 0xAE, 0x0F, 0xC9, 0x7F,
+    0x9F, 0xC7, 0x0E, 0xAD, 0x9E, 0x79, 0xFC, 0xA0, 0xE7, 0x9F, 0xC0, 0x9E, 0x7A, 0xF1, 0x9E, 0x92,
+    0xA2, 0xFA, 0x19, 0xFA, 0xAD, 0x2F, 0x3F, 0xF1, 0x9E, 0xA3, 0xFE, 0x2A, 0xE5, 0xFA, 0x76, 0x99,
+    0x50, 0x69, 0xAC, 0xAA, 0x75, 0xAF, 0xD9, 0x72, 0x9F, 0xF7, 0x29, 0xCA, 0xFD, 0x97, 0x6F, 0xA7,
+    0x7F, 0x77, 0xF7, 0x7F, 0x77, 0xAE, 0x77, 0xAE, 0x77, 0xF9, 0x75, 0xAF, 0x97, 0x49, 0xFC, 0x97,
+    0x4F, 0xDA, 0x73, 0x9F, 0xDA, 0x73, 0xE9, 0xEA, 0x72, 0xAE, 0x0E, 0xA7, 0x19, 0xE9, 0x0F, 0x71,
+    0xF1, 0xF7, 0x0A, 0xE9, 0x1F, 0x7A, 0xF2, 0xF6, 0x9F, 0x92, 0xAE, 0x29, 0x19, 0xFC, 0x3A, 0xFA,
+    0xD0, 0x9F, 0xC4, 0xAF, 0xDA, 0x0F, 0xC9, 0x49, 0xFD, 0x2E, 0xA6, 0xF9, 0x49, 0x71, 0x94, 0x69,
+    0x99, 0x95, 0x99, 0xA7, 0xF9, 0x3A, 0xF6, 0x9F, 0x4F, 0xA6, 0xAF, 0x4F, 0x96, 0xFA, 0x39, 0xF7,
+    0xF9, 0x3A, 0xF7, 0xF4, 0xAE, 0xA6, 0x9F, 0x4F, 0x96, 0x9E, 0xA4, 0xF7, 0xAE, 0xA3, 0x9F, 0x7F,
+    0x93, 0xAF, 0x7F, 0x93, 0xFA, 0x7F, 0x92, 0xAF, 0xA6, 0x9F, 0x91, 0x9F, 0xCA, 0x29, 0x2A, 0xFC,
+    0xAA, 0xEA, 0xEA, 0xAD, 0x2A, 0xFF, 0xC9, 0x9F, 0xDA, 0x2F, 0xFC, 0xA1, 0xFD, 0x3E, 0x9F, 0x92,
+    0x9E, 0xA3, 0x9E, 0x19, 0x96, 0x95, 0xAE, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x09, 0xF7, 0x70, 0xAE,
+    0xA7, 0x70, 0xF7, 0x71, 0xCA, 0xA7, 0x71, 0x29, 0x9A, 0x59, 0xAA, 0x2A, 0xFC, 0x3F, 0xC9, 0x9F,
+    0xDA, 0x29, 0xFA, 0x9F, 0xE3, 0xFC, 0x29, 0xF3, 0xAE, 0xA3, 0xF9, 0x2A, 0xEA, 0x3F, 0x92, 0xF4,
+    0xAE, 0xA2, 0xF4, 0xAE, 0xA1, 0x9E, 0x94, 0x9F, 0x1F, 0x6F, 0x09, 0xE9, 0x6F, 0x0E, 0xA7, 0xFA,
+    0xE7, 0x0F, 0xE9, 0x70, 0xFD, 0x97, 0x1F, 0xCA, 0x72, 0xFA, 0x73, 0xAD, 0xA7, 0x77, 0x00, 0x77,
+    0x19, 0xDA, 0x71, 0x9E, 0xA7, 0x1A, 0xE5, 0x9A, 0x2A, 0xEA, 0x19, 0xF3, 0xFF, 0xE4, 0xAF, 0xFA,
+    0x4A, 0xE9, 0x99, 0x95, 0xAE, 0xA7, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0x9F, 0x97, 0x1F, 0xCA,
+    0x97, 0x0F, 0xF6, 0x9F, 0xDA, 0x49, 0xFF, 0x93, 0x9F, 0xC9, 0x7F, 0xA7, 0x09, 0xF7, 0x1A, 0xF7,
+    0x1F, 0xC7, 0x1A, 0xFA, 0x70, 0x9F, 0xD9, 0x7F, 0xF9, 0x6F, 0xFC, 0x69, 0xFF, 0x79, 0xFD, 0x97,
+    0x09, 0xF9, 0x71, 0xAE, 0x97, 0x0A, 0xF5, 0x9A, 0xFD, 0x6F, 0xE9, 0x6A, 0xFA, 0x71, 0x99, 0x97,
+    0x70, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6A, 0xFF, 0xD4, 0xFD, 0xAF, 0xC9, 0x2A, 0xF2, 0x9F, 0xA1,
+    0x9F, 0x4F, 0xC1, 0xFA, 0x4A, 0xF1, 0xF9, 0x4A, 0xF0, 0xAF, 0x5A, 0xF0, 0xFC, 0x5F, 0xA0, 0xFA,
+    0x5F, 0x90, 0xFA, 0x49, 0xF1, 0xFA, 0x4F, 0xA1, 0xFC, 0x3A, 0xF2, 0xAF, 0x91, 0xAF, 0x92, 0x9F,
+    0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x73, 0x99, 0x70, 0x77, 0x19, 0x9A, 0x4A, 0xFF, 0xFF,
+    0x3F, 0xFF, 0xFD, 0x2A, 0xFF, 0xFF, 0xC9, 0x2E, 0xAA, 0xE9, 0x99, 0xF9, 0x94, 0xA9, 0x19, 0xE2,
+    0xEA, 0x72, 0xAD, 0xA1, 0x9E, 0x97, 0x2E, 0x91, 0xAE, 0x72, 0x9E, 0x2F, 0x72, 0xF2, 0xEA, 0x71,
+    0x9E, 0xA1, 0x9E, 0x97, 0x1F, 0x2A, 0xE9, 0x70, 0x9F, 0x2F, 0x71, 0xF9, 0x2F, 0x91, 0x94, 0xAF,
+    0x29, 0xFC, 0xAD, 0x39, 0xFA, 0x29, 0xFF, 0x3F, 0xC4, 0xFE, 0x39, 0xF9, 0x4A, 0xF9, 0x69, 0x97,
+    0x09, 0x70, 0x71, 0x9A, 0xAA, 0x97, 0x3A, 0xFE, 0x70, 0x9F, 0xFD, 0x7F, 0xCA, 0xFC, 0xA5, 0xFA,
+    0x2F, 0xC4, 0x9F, 0x39, 0xF9, 0x3A, 0xEA, 0x39, 0xF9, 0x3F, 0x49, 0xF9, 0x29, 0xF4, 0x9F, 0x3A,
+    0xEA, 0x49, 0xF3, 0xAE, 0xA4, 0xAF, 0x3F, 0x94, 0xFA, 0x3F, 0x49, 0xF4, 0xF4, 0xFA, 0x39, 0xFC,
+    0x2F, 0xC4, 0xAF, 0xFF, 0x5F, 0xFF, 0x6F, 0xAF, 0xCA, 0x7F, 0x29, 0x71, 0x9F, 0x75, 0xAF, 0x75,
+    0xAE, 0xA7, 0x5F, 0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x59, 0xCA, 0x97, 0x60, 0x79, 0x9A, 0xA9, 0x79,
+    0xFD, 0xA5, 0xFF, 0xC9, 0x3F, 0xFD, 0x3F, 0xC9, 0x09, 0xDA, 0x29, 0xF4, 0x93, 0xF9, 0x70, 0x9F,
+    0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xC7, 0x1F, 0xD7, 0x0A, 0xFD, 0xA7, 0xFF, 0xA6,
+    0xFF, 0xC6, 0x9F, 0xF7, 0x9F, 0xD7, 0x19, 0xF7, 0x2F, 0x71, 0xAE, 0xA5, 0x9A, 0xFD, 0x6F, 0xE7,
+    0xFC, 0x97, 0x19, 0x97, 0x77, 0x09, 0x9A, 0x79, 0xFF, 0xF5, 0x9F, 0xFF, 0xCA, 0x4A, 0xFF, 0xFD,
+    0x4A, 0xFA, 0x90, 0xAE, 0x99, 0x94, 0x9F, 0x93, 0xF6, 0xFC, 0x4F, 0x6F, 0x94, 0xF9, 0x4A, 0xF5,
+    0xF9, 0x4F, 0xA5, 0xF9, 0x4F, 0xA5, 0xF5, 0xFA, 0x4A, 0xF5, 0xFA, 0x4F, 0xA5, 0xFC, 0x3A, 0xF6,
+    0xAF, 0xA1, 0xAF, 0x97, 0xFF, 0xEA, 0x70, 0xAF, 0xFC, 0x97, 0x29, 0xFD, 0xA7, 0x79, 0x97, 0x40,
+    0x74, 0x99, 0xA2, 0xAF, 0xFF, 0xC1, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xD1, 0xEA, 0x99, 0xF9, 0x99,
+    0x92, 0xAA, 0x29, 0xE9, 0x73, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73,
+    0xAE, 0xA7, 0x3F, 0xA2, 0xC7, 0xFC, 0xAA, 0xD9, 0x6F, 0xFC, 0x7A, 0xFE, 0x71, 0xFC, 0x97, 0x49,
+    0x71, 0x39, 0x9A, 0x49, 0xA9, 0x2A, 0xFD, 0x2F, 0xA0, 0x9F, 0xE2, 0x9F, 0x09, 0xAA, 0xFC, 0x3F,
+    0x92, 0xAE, 0xA3, 0xFA, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0xA1, 0xAE, 0xA4, 0xF9, 0x1F, 0x94, 0xF2,
+    0xF5, 0xF1, 0x9F, 0x4A, 0xEA, 0x1A, 0xEA, 0x4F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2A, 0xEA, 0x29, 0xF3,
+    0xAF, 0x99, 0xAF, 0x93, 0x9F, 0xFD, 0x95, 0xFF, 0xC9, 0x7F, 0xDA, 0x73, 0x99, 0x71, 0x69, 0xA9,
+    0x4A, 0xAA, 0x97, 0x0A, 0xF2, 0xAF, 0xD6, 0xAF, 0x2F, 0xFC, 0x4A, 0xF2, 0xAE, 0xAA, 0xF9, 0x29,
+    0xF3, 0xEA, 0x1A, 0xF2, 0xF9, 0x2A, 0xE9, 0x19, 0xF1, 0x9F, 0x3F, 0x3F, 0x1A, 0xEA, 0x29, 0xF3,
+    0xF1, 0xF9, 0x2A, 0xEA, 0x29, 0xF1, 0xF9, 0x2F, 0x92, 0x9E, 0xA1, 0xF9, 0x2F, 0x3F, 0x91, 0xF9,
+    0x2F, 0x3F, 0x2F, 0xA1, 0x9F, 0x2F, 0x92, 0xAF, 0x1A, 0xEA, 0x1A, 0xF4, 0xFC, 0x9F, 0x99, 0xFC,
+    0x59, 0xFF, 0xFE, 0x70, 0xFF, 0xF9, 0x72, 0x9A, 0xFD, 0xA9, 0x76, 0xAE, 0xA7, 0x71, 0xF9, 0x77,
+    0x1F, 0x77, 0x19, 0xF7, 0x71, 0xAF, 0x77, 0x1F, 0xA7, 0x70, 0x9F, 0x77, 0x19, 0xAA, 0x97, 0x50,
+    0x59, 0x9A, 0x96, 0xAA, 0x94, 0xAF, 0xC9, 0x4F, 0xA2, 0xFE, 0xA3, 0xFC, 0x3A, 0xAA, 0xFC, 0x29,
+    0xF7, 0x9F, 0x2F, 0x97, 0x0F, 0x19, 0xEA, 0x71, 0xF9, 0x0F, 0x72, 0x9E, 0xAA, 0xE7, 0x4F, 0xE9,
+    0x74, 0xFD, 0xA7, 0x5A, 0xFC, 0x76, 0x9F, 0x77, 0x0F, 0x77, 0xAF, 0x77, 0xFC, 0x76, 0xFD, 0x97,
+    0x4A, 0xFD, 0xA7, 0x39, 0xE9, 0xF7, 0x3E, 0xA0, 0xF7, 0x2A, 0xE1, 0xFA, 0x70, 0x9E, 0xA1, 0xAF,
+    0x70, 0xF2, 0x9F, 0x99, 0xAC, 0x3F, 0xA3, 0xFF, 0x2A, 0xF4, 0xFE, 0x91, 0xAF, 0x94, 0xAF, 0xC4,
+    0xAA, 0xC9, 0x6A, 0xCA, 0x94, 0x76, 0x99, 0x97, 0x72, 0xAE, 0x97, 0x72, 0xF7, 0x72, 0x9F, 0x77,
+    0x2A, 0xEA, 0x77, 0x2F, 0x97, 0x29, 0x9A, 0x4F, 0x29, 0xA9, 0x2A, 0xFD, 0x3F, 0x1F, 0x90, 0x9F,
+    0xE2, 0x9F, 0x1A, 0xF0, 0x9A, 0xAF, 0xA2, 0xAE, 0xA2, 0xF9, 0x2A, 0xE9, 0x2F, 0x92, 0xF9, 0x2F,
+    0x3F, 0x3F, 0x91, 0x9F, 0x29, 0xF3, 0xF9, 0x1A, 0xEA, 0x2A, 0xEA, 0x3F, 0x2F, 0x92, 0xAE, 0x93,
+    0xF2, 0xF3, 0xF9, 0x29, 0xF1, 0x9F, 0x3F, 0x3A, 0xE9, 0x19, 0xF2, 0x9F, 0x3F, 0x29, 0xF2, 0xAE,
+    0xA2, 0xF9, 0x3F, 0xA1, 0xF9, 0x1A, 0xEA, 0x4A, 0xFC, 0x9F, 0x9A, 0xFC, 0x6F, 0xFF, 0xEA, 0x70,
+    0xFF, 0xFC, 0x97, 0x29, 0xAF, 0xEA, 0x97, 0x7F, 0x97, 0x72, 0xF7, 0x72, 0x9F, 0x77, 0x2A, 0xEA,
+    0x77, 0x2F, 0xA7, 0x72, 0xF9, 0x77, 0x19, 0xEA, 0x77, 0x2A, 0xA9, 0x76, 0x79, 0xAA, 0x69, 0xA7,
+    0x19, 0xFA, 0x4F, 0x96, 0xAF, 0x69, 0xF5, 0xAF, 0x70, 0xF9, 0x39, 0xF7, 0x1A, 0xF3, 0xF9, 0x29,
+    0xE2, 0x9F, 0x2A, 0xF2, 0x9F, 0x3F, 0x2F, 0x92, 0xAE, 0xA3, 0xF1, 0x9F, 0x3A, 0xE9, 0x3F, 0x1A,
+    0xEA, 0x3F, 0x39, 0xF1, 0xFA, 0x3E, 0xA3, 0x9E, 0xA1, 0xF9, 0x3E, 0x93, 0xAE, 0x91, 0xF9, 0x3E,
+    0x93, 0xF2, 0xFA, 0x2F, 0x92, 0x9E, 0xA2, 0xFC, 0x99, 0xAF, 0xC9, 0x0A, 0xF3, 0xAF, 0xFC, 0xAF,
+    0xF9, 0x4F, 0xF1, 0xFE, 0x96, 0xFC, 0xA2, 0x9F, 0xA7, 0x29, 0x79, 0x70, 0x77, 0x09, 0x97, 0x75,
+    0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9, 0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA,
+    0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F, 0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9,
+    0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F, 0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF,
+    0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F,
+    0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9, 0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39,
+    0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x77, 0x77, 0x77, 0x76, 0x9A, 0x97, 0x75, 0xAE, 0x97, 0x74,
+    0xFA, 0x77, 0x39, 0xF9, 0x77, 0x39, 0xEA, 0x77, 0x59, 0xA9, 0x75, 0x79, 0xAA, 0x92, 0x99, 0x97,
+    0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4,
+    0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA,
+    0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F,
+    0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96,
+    0x97, 0x77, 0x70, 0x97, 0x70, 0x9E, 0x97, 0x6F, 0xA7, 0x59, 0xF9, 0x75, 0x9F, 0x77, 0x9A, 0x97,
+    0x30, 0x77, 0x09, 0x97, 0x74, 0x9F, 0xC9, 0x77, 0x1A, 0xFE, 0x77, 0x09, 0xDA, 0x1E, 0x97, 0x70,
+    0xD2, 0xE7, 0x75, 0xAD, 0xA7, 0x73, 0xAE, 0x97, 0x73, 0xAD, 0x97, 0x75, 0x9D, 0x77, 0x79, 0x97,
+    0x77, 0x19, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9, 0x77, 0x1F,
+    0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F, 0x97, 0x5F,
+    0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F, 0x99, 0x99,
+    0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7,
+    0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9, 0x6A, 0xFE,
+    0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x71, 0x9A, 0xE9, 0x74, 0xAF,
+    0xD9, 0x72, 0x9D, 0xA9, 0xAE, 0x72, 0xAD, 0x19, 0xDA, 0x73, 0xA9, 0x1A, 0xD9, 0x76, 0xAD, 0xA7,
+    0x5A, 0xE9, 0x76, 0xDA, 0x77, 0x0A, 0xCA, 0x77, 0x77, 0x77, 0x69, 0xAA, 0x92, 0x99, 0x97, 0x9F,
+    0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF,
+    0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F,
+    0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1,
+    0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95,
+    0x77, 0x77, 0x77, 0x2C, 0xA7, 0x77, 0xAD, 0x97, 0x75, 0xAE, 0x97, 0x74, 0x9E, 0x97, 0x79, 0xE1,
+    0xE7, 0x70, 0x9F, 0xC0, 0xAA, 0x77, 0x09, 0xFD, 0xA7, 0x71, 0x9E, 0x99, 0xE9, 0x77, 0x9E, 0x91,
+    0x9D, 0xA7, 0x79, 0xD4, 0xAA, 0x77, 0x69, 0x97, 0x76, 0xF7, 0x75, 0xFC, 0x77, 0x4A, 0xFC, 0x97,
+    0x72, 0x9F, 0xD9, 0x77, 0x2F, 0xEA, 0x77, 0x19, 0xEA, 0xF7, 0x71, 0xEA, 0x9F, 0x77, 0x0A, 0xE1,
+    0xF7, 0x70, 0xEA, 0x1F, 0x97, 0x6F, 0x2F, 0xA7, 0x59, 0xE9, 0x2A, 0xF7, 0x5F, 0x3A, 0xF7, 0x4A,
+    0xE9, 0x39, 0xF7, 0x4F, 0x99, 0x99, 0x9A, 0xF9, 0x72, 0xFF, 0xFE, 0xA7, 0x19, 0xFF, 0xFF, 0x71,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0x0A, 0xEA, 0x7A, 0xF7, 0x0F, 0x70, 0xAF, 0x96, 0xAE, 0xA7,
+    0x09, 0xFA, 0x49, 0xAF, 0xA9, 0x6A, 0xFE, 0x91, 0xAF, 0xF9, 0x39, 0xFF, 0xD1, 0xFF, 0xC4, 0xAF,
+    0xFD, 0x10, 0x77, 0x29, 0x77, 0x39, 0xD7, 0x72, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x9E, 0xA7, 0x70,
+    0xEA, 0x77, 0x09, 0xD9, 0x75, 0x9A, 0x91, 0xA7, 0x6F, 0x97, 0x7F, 0xD9, 0x75, 0xEA, 0xAE, 0x73,
+    0x9E, 0xA1, 0xEA, 0x72, 0xEA, 0x3D, 0x97, 0x39, 0x77, 0x77, 0x73, 0x9A, 0xA9, 0x29, 0x99, 0x71,
+    0x9F, 0xD0, 0xF7, 0x0A, 0xFF, 0xF7, 0xAF, 0xCA, 0xFD, 0x96, 0x9F, 0xA2, 0xAF, 0x7F, 0xA3, 0xAF,
+    0x6A, 0xF4, 0xFA, 0x6F, 0xA4, 0xF6, 0x9F, 0x49, 0xF6, 0xAF, 0x4F, 0xC6, 0xFA, 0x39, 0xFA, 0x6F,
+    0xA3, 0xFC, 0x96, 0xFA, 0x2A, 0xFC, 0x96, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x3F, 0xC9, 0xAD, 0xA9,
+    0xFE, 0x3A, 0xFE, 0xA0, 0x9F, 0xDA, 0x39, 0xFD, 0xA1, 0x9F, 0xCA, 0x5A, 0xFA, 0x3F, 0x97, 0x09,
+    0x96, 0x97, 0x77, 0x77, 0x74, 0x9C, 0x97, 0x76, 0xE7, 0x76, 0xEA, 0x77, 0x6E, 0x77, 0x19, 0xDA,
+    0x1D, 0xA7, 0x79, 0xFA, 0x1A, 0x77, 0x9F, 0xD9, 0x77, 0x09, 0xE9, 0x9E, 0x77, 0x9E, 0x91, 0x9D,
+    0x97, 0x69, 0xD4, 0xAA, 0x77, 0x59, 0x97, 0x75, 0xF7, 0x74, 0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71,
+    0x9F, 0xD9, 0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70, 0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77,
+    0xEA, 0x1F, 0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7, 0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39,
+    0xF7, 0x3F, 0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7, 0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF, 0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39,
+    0xAF, 0xA9, 0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0, 0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x77,
+    0x77, 0x0A, 0xC7, 0x70, 0x9E, 0x77, 0x9E, 0x97, 0x7A, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0x74,
+    0x9A, 0x91, 0xAA, 0x73, 0xF9, 0x75, 0xFD, 0x97, 0x3E, 0xAA, 0xE7, 0x19, 0xEA, 0x1E, 0xA7, 0x0E,
+    0xA3, 0xD9, 0x71, 0x97, 0x77, 0x77, 0x9A, 0xA9, 0x29, 0x99, 0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5,
+    0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4,
+    0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC,
+    0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA,
+    0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69, 0x50, 0x77, 0x69, 0x77, 0x69,
+    0xFC, 0x77, 0x39, 0xEA, 0xD9, 0x77, 0x2A, 0xCA, 0x1D, 0x97, 0x76, 0xAD, 0x77, 0x9D, 0xA1, 0x9E,
+    0x77, 0x9F, 0xA0, 0xAC, 0xA7, 0x79, 0xFD, 0x90, 0x97, 0x79, 0xE9, 0x9E, 0x77, 0x09, 0xE9, 0x19,
+    0xD9, 0x77, 0x9D, 0x4A, 0xA7, 0x76, 0x99, 0x77, 0x6F, 0x77, 0x5F, 0xC7, 0x74, 0xAF, 0xC9, 0x77,
+    0x29, 0xFD, 0x97, 0x72, 0xFE, 0xA7, 0x71, 0x9E, 0xAF, 0x77, 0x1E, 0xA9, 0xF7, 0x70, 0xAE, 0x1F,
+    0x77, 0x0E, 0xA1, 0xF9, 0x76, 0xF2, 0xFA, 0x75, 0x9E, 0x92, 0xAF, 0x75, 0xF3, 0xAF, 0x74, 0xAE,
+    0x93, 0x9F, 0x74, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x2F, 0xFF, 0xEA, 0x71, 0x9F, 0xFF, 0xF7, 0x1F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x70, 0xAE, 0xA7, 0xAF, 0x70, 0xF7, 0x0A, 0xF9, 0x6A, 0xEA, 0x70,
+    0x9F, 0xA4, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x1A, 0xFF, 0x93, 0x9F, 0xFD, 0x1F, 0xFC, 0x4A, 0xFF,
+    0xD1, 0x77, 0x77, 0x6A, 0xEA, 0x77, 0x0F, 0xE7, 0x6A, 0xD1, 0xE7, 0x69, 0xCA, 0x1E, 0x77, 0x2A,
+    0xD7, 0x71, 0xAD, 0xA7, 0x59, 0xA9, 0x1D, 0x97, 0x5F, 0x90, 0xD7, 0x5F, 0xD9, 0x76, 0xEA, 0xAE,
+    0x74, 0x9E, 0xA1, 0xEA, 0x73, 0xEA, 0x3D, 0x97, 0x49, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x29, 0x99,
+    0x72, 0x9F, 0xD0, 0xF7, 0x1A, 0xFF, 0xF7, 0x0A, 0xFC, 0xAF, 0xD9, 0x79, 0xFA, 0x2A, 0xF7, 0x0F,
+    0xA3, 0xAF, 0x7A, 0xF4, 0xFA, 0x7F, 0xA4, 0xF7, 0x9F, 0x49, 0xF7, 0xAF, 0x4F, 0xC7, 0xFA, 0x39,
+    0xFA, 0x7F, 0xA3, 0xFC, 0x97, 0xFA, 0x2A, 0xFC, 0x97, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x4F, 0xC9,
+    0xAD, 0xA9, 0xFE, 0x4A, 0xFE, 0xA0, 0x9F, 0xDA, 0x49, 0xFD, 0xA1, 0x9F, 0xCA, 0x6A, 0xFA, 0x3F,
+    0x97, 0x19, 0x96, 0x97, 0x00, 0x77, 0x77, 0x6A, 0xEA, 0x1A, 0xC7, 0x79, 0xFF, 0xC7, 0x7A, 0xCA,
+    0x0A, 0xFA, 0x77, 0x0A, 0x29, 0xAA, 0x97, 0x74, 0x99, 0x77, 0x6F, 0x77, 0x39, 0xFD, 0x77, 0x19,
+    0xE9, 0xAE, 0x77, 0xAE, 0x2A, 0xD9, 0x76, 0x9C, 0xA4, 0xAA, 0x77, 0x59, 0x97, 0x75, 0xF7, 0x74,
+    0xFC, 0x77, 0x3A, 0xFC, 0x97, 0x71, 0x9F, 0xD9, 0x77, 0x1F, 0xEA, 0x77, 0x09, 0xEA, 0xF7, 0x70,
+    0xEA, 0x9F, 0x77, 0xAE, 0x1F, 0x77, 0xEA, 0x1F, 0x97, 0x5F, 0x2F, 0xA7, 0x49, 0xE9, 0x2A, 0xF7,
+    0x4F, 0x3A, 0xF7, 0x3A, 0xE9, 0x39, 0xF7, 0x3F, 0x99, 0x99, 0x9A, 0xF9, 0x71, 0xFF, 0xFE, 0xA7,
+    0x09, 0xFF, 0xFF, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xAE, 0xA7, 0xAF, 0x7F, 0x70, 0xAF,
+    0x95, 0xAE, 0xA7, 0x09, 0xFA, 0x39, 0xAF, 0xA9, 0x6A, 0xFE, 0x90, 0xAF, 0xF9, 0x39, 0xFF, 0xD0,
+    0xFF, 0xC4, 0xAF, 0xFD, 0x00, 0x70, 0x9A, 0x93, 0x97, 0x2F, 0xA1, 0x9C, 0xA7, 0x09, 0xFD, 0x9D,
+    0xA7, 0x0A, 0xD9, 0xAF, 0xCA, 0x70, 0x9C, 0xA1, 0x9F, 0x77, 0x09, 0x97, 0x69, 0x99, 0x77, 0xFA,
+    0x75, 0xFD, 0xA7, 0x3E, 0xAA, 0xE9, 0x70, 0x9E, 0xA1, 0xAE, 0x70, 0xEA, 0x3A, 0xC9, 0x71, 0x97,
+    0x77, 0x77, 0x9A, 0xA9, 0x29, 0x99, 0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94,
+    0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF,
+    0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA,
+    0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F,
+    0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69, 0x50, 0x77, 0xAA, 0xA7, 0x75, 0xFC, 0x77, 0x3F, 0xDA,
+    0x77, 0x1F, 0xAE, 0x97, 0x7F, 0x1A, 0xE7, 0x59, 0xF3, 0xAD, 0x76, 0xAA, 0x95, 0xA9, 0x77, 0x77,
+    0x76, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE,
+    0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2,
+    0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99,
+    0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A,
+    0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9,
+    0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x69, 0xA9, 0x77,
+    0x5A, 0xE9, 0x77, 0x4F, 0xA7, 0x73, 0x9F, 0x97, 0x73, 0x9E, 0xA7, 0x75, 0x9A, 0x97, 0x50, 0x77,
+    0x76, 0xAD, 0xA7, 0x6A, 0xF7, 0x59, 0xFC, 0xA7, 0x39, 0xEA, 0xE7, 0x3E, 0x90, 0xAD, 0xA7, 0x1E,
+    0x92, 0xE7, 0x0A, 0xD9, 0x39, 0xCA, 0x77, 0x77, 0x77, 0x29, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0,
+    0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA, 0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F,
+    0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC, 0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9,
+    0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A, 0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF,
+    0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3, 0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x97, 0x77,
+    0x70, 0x97, 0x70, 0x9E, 0x97, 0x6F, 0xA7, 0x59, 0xF9, 0x75, 0x9F, 0x77, 0x9A, 0x97, 0x30, 0x77,
+    0x77, 0x73, 0xD7, 0x76, 0xAD, 0x97, 0x74, 0x9E, 0x77, 0x5E, 0x77, 0x2C, 0xA0, 0x9C, 0xA1, 0x9A,
+    0x76, 0xAD, 0x19, 0x19, 0xCA, 0x76, 0xAE, 0xA9, 0xAE, 0x77, 0x9F, 0xF9, 0x77, 0x09, 0xFC, 0xA7,
+    0x77, 0x77, 0x71, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97,
+    0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9,
+    0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9,
+    0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96,
+    0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0, 0x77, 0x77, 0x19, 0xA7,
+    0x71, 0xDA, 0x77, 0xF7, 0x6F, 0x76, 0xAE, 0x77, 0xDA, 0x75, 0xA1, 0x99, 0x29, 0x71, 0xD9, 0x4A,
+    0xC7, 0x09, 0xE3, 0xAD, 0x71, 0xFF, 0xC9, 0x71, 0xAF, 0xE9, 0x73, 0x9A, 0xEA, 0x77, 0x77, 0x77,
+    0x59, 0xAA, 0x92, 0x99, 0x97, 0x9F, 0xD0, 0xF6, 0xAF, 0xFF, 0x5A, 0xFC, 0xAF, 0xD9, 0x49, 0xFA,
+    0x2A, 0xF5, 0xFA, 0x3A, 0xF4, 0xAF, 0x4F, 0xA4, 0xFA, 0x4F, 0x49, 0xF4, 0x9F, 0x4A, 0xF4, 0xFC,
+    0x4F, 0xA3, 0x9F, 0xA4, 0xFA, 0x3F, 0xC9, 0x4F, 0xA2, 0xAF, 0xC9, 0x4F, 0xA1, 0xAD, 0xAE, 0x1A,
+    0xC1, 0xFC, 0x9A, 0xDA, 0x9F, 0xE1, 0xAF, 0xEA, 0x09, 0xFD, 0xA1, 0x9F, 0xDA, 0x19, 0xFC, 0xA3,
+    0xAF, 0xA3, 0xF9, 0x69, 0x96, 0x95, 0x77, 0x77, 0x70, 0xAC, 0x77, 0x69, 0xD9, 0x77, 0x6E, 0x77,
+    0x69, 0xD7, 0x73, 0xCA, 0x1A, 0xC1, 0x9A, 0x76, 0xAD, 0x29, 0x09, 0xCA, 0x76, 0xAE, 0xA9, 0xAE,
+    0x77, 0x9F, 0xF9, 0x77, 0x09, 0xFC, 0xA7, 0x77, 0x77, 0x71, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7,
+    0x73, 0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9,
+    0xF7, 0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3,
+    0xAF, 0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F,
+    0xFF, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A,
+    0xEA, 0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC,
+    0x4A, 0xFF, 0xD0, 0x71, 0x99, 0x77, 0x0A, 0xD7, 0x70, 0xEA, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x70,
+    0xE7, 0x5A, 0x2C, 0xA1, 0x97, 0x1D, 0x94, 0xAC, 0x70, 0x9E, 0x3A, 0xD7, 0x1F, 0xFC, 0x97, 0x1A,
+    0xFE, 0x97, 0x39, 0xAE, 0xA7, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x29, 0x99, 0x79, 0xFD, 0x0F, 0x6A,
+    0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A, 0xF4, 0xFA, 0x4F,
+    0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3, 0xFC, 0x94, 0xFA,
+    0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE, 0x1A, 0xFE, 0xA0,
+    0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69, 0x50, 0x77, 0x09,
+    0x97, 0x75, 0xAF, 0x97, 0x72, 0xE9, 0xE7, 0x72, 0xD1, 0xDA, 0x77, 0x5A, 0xD7, 0x74, 0x9D, 0xA7,
+    0x72, 0xC9, 0x09, 0xCA, 0x1A, 0x77, 0xAD, 0x19, 0x1A, 0xC7, 0x79, 0xEA, 0x9A, 0xDA, 0x77, 0x0F,
+    0xEA, 0x77, 0x29, 0xAA, 0xA9, 0x77, 0x70, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73, 0xAF, 0xC9,
+    0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7, 0x7A, 0xE1,
+    0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF, 0x73, 0xAE,
+    0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF, 0xF7, 0x0F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA, 0x70, 0x9F,
+    0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A, 0xFF, 0xD0,
+    0x74, 0x97, 0x79, 0xFC, 0x74, 0x9F, 0xDA, 0x73, 0xAC, 0xA1, 0xDA, 0x74, 0xA1, 0x9D, 0x97, 0x6A,
+    0xD9, 0x75, 0x9D, 0xA7, 0x59, 0x1D, 0x29, 0x71, 0xD1, 0x99, 0x19, 0xC7, 0x09, 0xDA, 0x3A, 0xD7,
+    0x1F, 0xAF, 0x97, 0x1A, 0xFE, 0x97, 0x39, 0xAE, 0xA7, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x29, 0x99,
+    0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF,
+    0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F,
+    0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9,
+    0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99,
+    0x69, 0x50, 0x77, 0x77, 0x59, 0xF9, 0x1D, 0x77, 0xFD, 0xAE, 0x76, 0x9D, 0x1F, 0xC9, 0x77, 0xA9,
+    0x2A, 0xAA, 0x97, 0x70, 0x96, 0x9A, 0x76, 0xAC, 0xA4, 0x9C, 0xA7, 0x6A, 0xDA, 0x99, 0x9E, 0x77,
+    0x9F, 0xF9, 0x77, 0x0A, 0xFC, 0xA7, 0x77, 0x77, 0x71, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73,
+    0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7,
+    0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF,
+    0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF,
+    0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA,
+    0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A,
+    0xFF, 0xD0, 0x70, 0xAD, 0x92, 0xC7, 0x2F, 0xC9, 0x0A, 0xCA, 0x70, 0xAF, 0xFC, 0x97, 0x0A, 0xC9,
+    0x1F, 0xA7, 0x2A, 0x3A, 0xA9, 0x73, 0x96, 0x97, 0x1D, 0x59, 0xC7, 0x09, 0xDA, 0x3A, 0xD7, 0x1F,
+    0xAF, 0x97, 0x1A, 0xFE, 0x97, 0x39, 0xAE, 0xA7, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x29, 0x99, 0x79,
+    0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF, 0x4A,
+    0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F, 0xA3,
+    0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9, 0xFE,
+    0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99, 0x69,
+    0x50, 0x74, 0x97, 0x77, 0xD9, 0x5C, 0x76, 0x9E, 0x39, 0xD7, 0x69, 0xFA, 0xAE, 0x97, 0x7F, 0xFA,
+    0x77, 0x1A, 0xFC, 0x97, 0x75, 0x97, 0x77, 0x77, 0x73, 0x99, 0x77, 0x5F, 0x77, 0x4F, 0xC7, 0x73,
+    0xAF, 0xC9, 0x77, 0x19, 0xFD, 0x97, 0x71, 0xFE, 0xA7, 0x70, 0x9E, 0xAF, 0x77, 0x0E, 0xA9, 0xF7,
+    0x7A, 0xE1, 0xF7, 0x7E, 0xA1, 0xF9, 0x75, 0xF2, 0xFA, 0x74, 0x9E, 0x92, 0xAF, 0x74, 0xF3, 0xAF,
+    0x73, 0xAE, 0x93, 0x9F, 0x73, 0xF9, 0x99, 0x99, 0xAF, 0x97, 0x1F, 0xFF, 0xEA, 0x70, 0x9F, 0xFF,
+    0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7A, 0xEA, 0x7A, 0xF7, 0xF7, 0x0A, 0xF9, 0x5A, 0xEA,
+    0x70, 0x9F, 0xA3, 0x9A, 0xFA, 0x96, 0xAF, 0xE9, 0x0A, 0xFF, 0x93, 0x9F, 0xFD, 0x0F, 0xFC, 0x4A,
+    0xFF, 0xD7, 0x77, 0x77, 0x77, 0x69, 0xA9, 0x77, 0x5A, 0xE9, 0x77, 0x4F, 0xA7, 0x73, 0x9F, 0x97,
+    0x73, 0x9E, 0xA7, 0x75, 0x9A, 0x97, 0x50, 0x79, 0x97, 0x70, 0xAD, 0x5C, 0x97, 0x0E, 0xA2, 0xAD,
+    0x71, 0xFF, 0xCA, 0x72, 0xFE, 0xA7, 0x4A, 0xEA, 0x97, 0x77, 0x77, 0x74, 0x9A, 0xA9, 0x29, 0x99,
+    0x79, 0xFD, 0x0F, 0x6A, 0xFF, 0xF5, 0xAF, 0xCA, 0xFD, 0x94, 0x9F, 0xA2, 0xAF, 0x5F, 0xA3, 0xAF,
+    0x4A, 0xF4, 0xFA, 0x4F, 0xA4, 0xF4, 0x9F, 0x49, 0xF4, 0xAF, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x4F,
+    0xA3, 0xFC, 0x94, 0xFA, 0x2A, 0xFC, 0x94, 0xFA, 0x1A, 0xDA, 0xE1, 0xAC, 0x1F, 0xC9, 0xAD, 0xA9,
+    0xFE, 0x1A, 0xFE, 0xA0, 0x9F, 0xDA, 0x19, 0xFD, 0xA1, 0x9F, 0xCA, 0x3A, 0xFA, 0x3F, 0x96, 0x99,
+    0x69, 0x77, 0x77, 0x09, 0x77, 0x09, 0xE9, 0x76, 0xFA, 0x75, 0x9F, 0x97, 0x59, 0xF7, 0x79, 0xA9,
+    0x73, 0x5F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xF7, 0x0F, 0xA2, 0x99, 0xAE, 0x79,
+    0xF9, 0x49, 0xE7, 0xAF, 0x59, 0xDA, 0x7F, 0xC5, 0x9D, 0x70, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x09,
+    0xF9, 0x77, 0x0A, 0xFF, 0xEA, 0x71, 0xFF, 0xF9, 0x71, 0xFF, 0xF7, 0x19, 0xFA, 0x77, 0x0A, 0xF9,
+    0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x6A, 0xCA, 0x7F, 0xA5, 0x9E, 0x69, 0xF9, 0x5E, 0xA6, 0xAF, 0x93,
+    0x9A, 0xE9, 0x49, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC9, 0x77, 0x77, 0x77, 0x72,
+    0x99, 0x77, 0x3F, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x1F, 0x77, 0x29, 0xAA, 0x74, 0x70, 0x9A,
+    0xA9, 0x79, 0xFE, 0x5A, 0xFF, 0xA3, 0xAE, 0xA9, 0xAF, 0x29, 0xE9, 0x2F, 0x2E, 0xA2, 0x9E, 0xA1,
+    0xAE, 0x3F, 0x2E, 0xA2, 0xAE, 0x91, 0x9E, 0x90, 0x9F, 0x92, 0xAE, 0xAF, 0xC9, 0x3F, 0xFA, 0x5F,
+    0xD9, 0x7F, 0x95, 0xA9, 0x1F, 0x93, 0x9E, 0x1F, 0xC9, 0x99, 0xFA, 0x19, 0xFF, 0xE3, 0xFF, 0xCA,
+    0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x77, 0x39, 0x97, 0x3A, 0xE7, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0x97,
+    0x2A, 0xA7, 0x00, 0x77, 0x99, 0x77, 0x19, 0xFC, 0xA7, 0x6A, 0xFE, 0x97, 0x5E, 0x1E, 0x97, 0x5D,
+    0x2E, 0x97, 0x71, 0xAD, 0xA7, 0x70, 0xAE, 0x97, 0x70, 0x9D, 0x97, 0x72, 0x9D, 0x77, 0x49, 0x97,
+    0x77, 0x73, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7,
+    0x9F, 0x94, 0x9E, 0x7A, 0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70,
+    0x9F, 0x97, 0x70, 0xAF, 0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF,
+    0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9,
+    0x39, 0xAE, 0x94, 0x9F, 0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x70, 0x9E, 0xA7,
+    0x1F, 0xE7, 0xEA, 0x9E, 0x96, 0xDA, 0x1A, 0xD9, 0x69, 0xA2, 0xE7, 0x3E, 0x97, 0x1F, 0x73, 0xD9,
+    0x74, 0xD9, 0x77, 0x77, 0x74, 0x9A, 0xA9, 0x70, 0x9F, 0xE6, 0xAF, 0xFA, 0x4A, 0xEA, 0x9A, 0xF3,
+    0x9E, 0x92, 0xF3, 0xEA, 0x29, 0xEA, 0x2A, 0xE3, 0xF3, 0xEA, 0x2A, 0xE9, 0x29, 0xE9, 0x09, 0xF9,
+    0x3A, 0xEA, 0xFC, 0x94, 0xFF, 0xA6, 0xFD, 0x97, 0x0F, 0x95, 0xA9, 0x2F, 0x93, 0x9E, 0x2F, 0xC9,
+    0x99, 0xFA, 0x29, 0xFF, 0xE4, 0xFF, 0xCA, 0x6A, 0xFC, 0xA7, 0x29, 0x97, 0x00, 0x77, 0x77, 0x2A,
+    0xDA, 0x2A, 0xC7, 0x4F, 0xD0, 0xAD, 0x97, 0x2A, 0xFF, 0xD7, 0x3A, 0xD1, 0xFC, 0xA7, 0x4C, 0x92,
+    0xE9, 0x77, 0x77, 0x77, 0x77, 0x75, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70,
+    0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A, 0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7,
+    0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71,
+    0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F,
+    0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F, 0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC,
+    0x93, 0x69, 0xDA, 0x29, 0xA6, 0xAF, 0xA1, 0xD9, 0x49, 0xFD, 0xAE, 0x94, 0xAD, 0x90, 0xFD, 0x59,
+    0xCA, 0x19, 0xEA, 0x75, 0x97, 0x77, 0x77, 0x69, 0xAA, 0x97, 0x19, 0xFE, 0x7A, 0xFF, 0xA5, 0xAE,
+    0xA9, 0xAF, 0x49, 0xE9, 0x2F, 0x4E, 0xA2, 0x9E, 0xA3, 0xAE, 0x3F, 0x4E, 0xA2, 0xAE, 0x93, 0x9E,
+    0x90, 0x9F, 0x94, 0xAE, 0xAF, 0xC9, 0x5F, 0xFA, 0x7F, 0xD9, 0x71, 0xF9, 0x5A, 0x93, 0xF9, 0x39,
+    0xE3, 0xFC, 0x99, 0x9F, 0xA3, 0x9F, 0xFE, 0x5F, 0xFC, 0xA7, 0xAF, 0xCA, 0x73, 0x99, 0x71, 0x77,
+    0x77, 0x77, 0x0D, 0x77, 0x6A, 0xDA, 0x77, 0x49, 0xE9, 0x77, 0x4E, 0x97, 0x69, 0xE1, 0xAD, 0x97,
+    0x69, 0xFC, 0x09, 0xC7, 0x79, 0xFE, 0x77, 0x09, 0xE9, 0x9E, 0xA7, 0x69, 0xE9, 0x19, 0xE7, 0x69,
+    0xD9, 0x3A, 0xA7, 0x77, 0x75, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xF9, 0x79, 0xFF, 0xFF, 0x73, 0xFA,
+    0x29, 0x9A, 0xE7, 0x29, 0xF9, 0x49, 0xE7, 0x2A, 0xF5, 0x9D, 0xA7, 0x2F, 0xC5, 0x9D, 0x73, 0xFC,
+    0x77, 0x39, 0xFA, 0x77, 0x39, 0xF9, 0x77, 0x3A, 0xFF, 0xEA, 0x74, 0xFF, 0xF9, 0x74, 0xFF, 0xF7,
+    0x49, 0xFA, 0x77, 0x3A, 0xF9, 0x77, 0x3F, 0xC7, 0x74, 0xFC, 0x6A, 0xCA, 0x72, 0xFA, 0x59, 0xE7,
+    0x19, 0xF9, 0x5E, 0xA7, 0x1A, 0xF9, 0x39, 0xAE, 0x97, 0x9F, 0xFF, 0xF7, 0xAF, 0xFF, 0xFC, 0x7F,
+    0xFF, 0xFC, 0x96, 0x77, 0x19, 0x77, 0x2A, 0xCA, 0x77, 0x09, 0xE9, 0x77, 0xF7, 0x7F, 0x97, 0x69,
+    0xE9, 0x77, 0xE7, 0x49, 0xAA, 0x2A, 0x74, 0x9F, 0x76, 0x9F, 0xD7, 0x49, 0xE9, 0xF7, 0x2A, 0xE9,
+    0x1E, 0x71, 0x9E, 0x92, 0x9D, 0x73, 0x95, 0x97, 0x77, 0x74, 0x9A, 0xA9, 0x75, 0x9F, 0xE7, 0x3A,
+    0xFF, 0xA7, 0x1A, 0xEA, 0x9A, 0xF7, 0x09, 0xE9, 0x2F, 0x70, 0xEA, 0x29, 0xEA, 0x7A, 0xE3, 0xF7,
+    0x0E, 0xA2, 0xAE, 0x97, 0x9E, 0x90, 0x9F, 0x97, 0x0A, 0xEA, 0xFC, 0x97, 0x1F, 0xFA, 0x73, 0xFD,
+    0x97, 0x5F, 0x95, 0xA9, 0x7F, 0x93, 0x9E, 0x7F, 0xC9, 0x99, 0xFA, 0x79, 0xFF, 0xE7, 0x1F, 0xFC,
+    0xA7, 0x3A, 0xFC, 0xA7, 0x79, 0x97, 0x50, 0x77, 0x77, 0x70, 0x9C, 0x97, 0x73, 0xE7, 0x73, 0xEA,
+    0x77, 0x3E, 0x97, 0x59, 0xE1, 0xDA, 0x74, 0x9F, 0xA1, 0xA7, 0x49, 0xFD, 0xA7, 0x59, 0xE9, 0x9E,
+    0x97, 0x39, 0xE9, 0x19, 0xDA, 0x73, 0x9D, 0x93, 0xAA, 0x77, 0x77, 0xFF, 0xFF, 0x94, 0xAF, 0xFF,
+    0xF9, 0x49, 0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A, 0xF5, 0x9D, 0xA7,
+    0xFC, 0x59, 0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0xFE, 0xA7, 0x1F,
+    0xFF, 0x97, 0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC6, 0xAC,
+    0xA7, 0xFA, 0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F, 0xFF, 0xF4, 0xAF,
+    0xFF, 0xFC, 0x4F, 0xFF, 0xFC, 0x93, 0x77, 0x74, 0xD7, 0x5A, 0xD9, 0x74, 0xAE, 0x75, 0xEA, 0x75,
+    0xE9, 0x75, 0xE7, 0x09, 0xAA, 0x2C, 0x97, 0x9F, 0x72, 0x9F, 0xD7, 0x09, 0xE9, 0xF6, 0xAE, 0x91,
+    0xE5, 0x9E, 0x92, 0x9D, 0x79, 0x59, 0x77, 0x74, 0x9A, 0xA9, 0x71, 0x9F, 0xE7, 0xAF, 0xFA, 0x5A,
+    0xEA, 0x9A, 0xF4, 0x9E, 0x92, 0xF4, 0xEA, 0x29, 0xEA, 0x3A, 0xE3, 0xF4, 0xEA, 0x2A, 0xE9, 0x39,
+    0xE9, 0x09, 0xF9, 0x4A, 0xEA, 0xFC, 0x95, 0xFF, 0xA7, 0xFD, 0x97, 0x1F, 0x95, 0xA9, 0x3F, 0x93,
+    0x9E, 0x3F, 0xC9, 0x99, 0xFA, 0x39, 0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39, 0x97, 0x10,
+    0x77, 0x59, 0x77, 0x6F, 0xC7, 0x73, 0xEA, 0xDA, 0x77, 0x19, 0xD1, 0xDA, 0x77, 0x5A, 0xD7, 0x69,
+    0xE1, 0x9E, 0x76, 0x9F, 0xA0, 0x9C, 0xA7, 0x69, 0xFD, 0xA0, 0x97, 0x69, 0xE9, 0x9E, 0x97, 0x69,
+    0xE9, 0x19, 0xDA, 0x76, 0x9D, 0x93, 0xAA, 0x77, 0x77, 0x5F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFF, 0x97,
+    0x9F, 0xFF, 0xF7, 0x3F, 0xA2, 0x99, 0xAE, 0x72, 0x9F, 0x94, 0x9E, 0x72, 0xAF, 0x59, 0xDA, 0x72,
+    0xFC, 0x59, 0xD7, 0x3F, 0xC7, 0x73, 0x9F, 0xA7, 0x73, 0x9F, 0x97, 0x73, 0xAF, 0xFE, 0xA7, 0x4F,
+    0xFF, 0x97, 0x4F, 0xFF, 0x74, 0x9F, 0xA7, 0x73, 0xAF, 0x97, 0x73, 0xFC, 0x77, 0x4F, 0xC6, 0xAC,
+    0xA7, 0x2F, 0xA5, 0x9E, 0x71, 0x9F, 0x95, 0xEA, 0x71, 0xAF, 0x93, 0x9A, 0xE9, 0x79, 0xFF, 0xFF,
+    0x7A, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC9, 0x60, 0x77, 0x77, 0x3A, 0xEA, 0x75, 0x9F, 0xDA, 0x74,
+    0xE1, 0xE7, 0x4A, 0xC9, 0x1D, 0xA7, 0x79, 0xE7, 0x69, 0xEA, 0x72, 0x9A, 0xA1, 0x9D, 0x73, 0x9F,
+    0x1C, 0xA7, 0x29, 0xFD, 0x74, 0x9E, 0x9F, 0x72, 0xAE, 0x91, 0xE7, 0x19, 0xE9, 0x29, 0xD7, 0x39,
+    0x59, 0x77, 0x77, 0x49, 0xAA, 0x97, 0x59, 0xFE, 0x73, 0xAF, 0xFA, 0x71, 0xAE, 0xA9, 0xAF, 0x70,
+    0x9E, 0x92, 0xF7, 0x0E, 0xA2, 0x9E, 0xA7, 0xAE, 0x3F, 0x70, 0xEA, 0x2A, 0xE9, 0x79, 0xE9, 0x09,
+    0xF9, 0x70, 0xAE, 0xAF, 0xC9, 0x71, 0xFF, 0xA7, 0x3F, 0xD9, 0x75, 0xF9, 0x5A, 0x97, 0xF9, 0x39,
+    0xE7, 0xFC, 0x99, 0x9F, 0xA7, 0x9F, 0xFE, 0x71, 0xFF, 0xCA, 0x73, 0xAF, 0xCA, 0x77, 0x99, 0x75,
+    0x77, 0x77, 0x29, 0xEA, 0x1A, 0xC7, 0x5F, 0xDA, 0xD9, 0x73, 0x9D, 0x0A, 0xFC, 0x75, 0x93, 0xAA,
+    0xA7, 0x71, 0x99, 0x77, 0x3F, 0x77, 0x1F, 0xD9, 0x75, 0x9E, 0x9A, 0xE7, 0x49, 0xE9, 0x1A, 0xDA,
+    0x73, 0x9C, 0xA4, 0xAA, 0x77, 0x77, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x49, 0xFF, 0xFF, 0x70,
+    0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A, 0xF5, 0x9D, 0xA7, 0xFC, 0x59, 0xD7, 0x0F, 0xC7,
+    0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0xFE, 0xA7, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x71,
+    0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC6, 0xAC, 0xA7, 0xFA, 0x59, 0xE6, 0x9F,
+    0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F, 0xFF, 0xF4, 0xAF, 0xFF, 0xFC, 0x4F, 0xFF, 0xFC,
+    0x93, 0x7A, 0x97, 0x5F, 0x91, 0xAC, 0x6A, 0xFC, 0xA9, 0xD9, 0x5D, 0xA9, 0xFD, 0x6A, 0xC2, 0xAE,
+    0xA7, 0x59, 0x97, 0x39, 0xA9, 0x73, 0x9F, 0x97, 0x19, 0xFD, 0x97, 0x9E, 0x9F, 0x6A, 0xE9, 0x1E,
+    0xA4, 0x9E, 0x93, 0xD7, 0x97, 0x77, 0x73, 0x9A, 0xA9, 0x71, 0x9F, 0xE7, 0xAF, 0xFA, 0x5A, 0xEA,
+    0x9A, 0xF4, 0x9E, 0x92, 0xF4, 0xEA, 0x29, 0xEA, 0x3A, 0xE3, 0xF4, 0xEA, 0x2A, 0xE9, 0x39, 0xE9,
+    0x09, 0xF9, 0x4A, 0xEA, 0xFC, 0x95, 0xFF, 0xA7, 0xFD, 0x97, 0x1F, 0x95, 0xA9, 0x3F, 0x93, 0x9E,
+    0x3F, 0xC9, 0x99, 0xFA, 0x39, 0xFF, 0xE5, 0xFF, 0xCA, 0x7A, 0xFC, 0xA7, 0x39, 0x97, 0x10, 0x76,
+    0xAA, 0xC7, 0x72, 0xAF, 0x77, 0x0A, 0xFD, 0x76, 0xAE, 0xAE, 0xA7, 0x4F, 0x90, 0x9E, 0x73, 0xF3,
+    0xAD, 0x97, 0x2A, 0xAA, 0x5A, 0x97, 0x77, 0x77, 0x75, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x49,
+    0xFF, 0xFF, 0x70, 0xFA, 0x29, 0x9A, 0xE7, 0x9F, 0x94, 0x9E, 0x7A, 0xF5, 0x9D, 0xA7, 0xFC, 0x59,
+    0xD7, 0x0F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0x9F, 0x97, 0x70, 0xAF, 0xFE, 0xA7, 0x1F, 0xFF, 0x97,
+    0x1F, 0xFF, 0x71, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x77, 0x1F, 0xC6, 0xAC, 0xA7, 0xFA,
+    0x59, 0xE6, 0x9F, 0x95, 0xEA, 0x6A, 0xF9, 0x39, 0xAE, 0x94, 0x9F, 0xFF, 0xF4, 0xAF, 0xFF, 0xFC,
+    0x4F, 0xFF, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x29, 0x97, 0x73, 0xF7, 0x71, 0xFC, 0x77, 0x1F, 0xC7,
+    0x71, 0xF7, 0x72, 0x9A, 0xA7, 0x40, 0x77, 0x71, 0xAD, 0x73, 0xFC, 0x71, 0xFD, 0x97, 0xAE, 0xAE,
+    0x69, 0xE1, 0xE9, 0x49, 0xE2, 0x9D, 0xA4, 0xE4, 0xD9, 0x77, 0x77, 0x70, 0x9A, 0xA9, 0x70, 0x9F,
+    0xE6, 0xAF, 0xFA, 0x4A, 0xEA, 0x9A, 0xF3, 0x9E, 0x92, 0xF3, 0xEA, 0x29, 0xEA, 0x2A, 0xE3, 0xF3,
+    0xEA, 0x2A, 0xE9, 0x29, 0xE9, 0x09, 0xF9, 0x3A, 0xEA, 0xFC, 0x94, 0xFF, 0xA6, 0xFD, 0x97, 0x0F,
+    0x95, 0xA9, 0x2F, 0x93, 0x9E, 0x2F, 0xC9, 0x99, 0xFA, 0x29, 0xFF, 0xE4, 0xFF, 0xCA, 0x6A, 0xFC,
+    0xA7, 0x29, 0x97, 0x77, 0x59, 0x97, 0x4A, 0xE7, 0x2A, 0xF7, 0x2F, 0xC7, 0x2F, 0x97, 0x3A, 0xA7,
+    0x10, 0x73, 0x99, 0x73, 0xAF, 0xC9, 0x70, 0xFF, 0x79, 0xDA, 0x1E, 0x79, 0xD2, 0xE7, 0x4A, 0xD9,
+    0x71, 0x9A, 0xE9, 0x72, 0xAD, 0x97, 0x4A, 0xCA, 0x76, 0x97, 0x77, 0x4F, 0xFD, 0x5A, 0xFF, 0xD5,
+    0x9F, 0xFA, 0x71, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72,
+    0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72,
+    0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x70, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xD5, 0xFF,
+    0xDA, 0x40, 0x49, 0xAE, 0x94, 0xFE, 0x92, 0xAD, 0xA9, 0xAD, 0xA2, 0xAD, 0x19, 0xDA, 0x3A, 0x91,
+    0xE9, 0x6A, 0xDA, 0x5A, 0xE9, 0x6D, 0xA7, 0x0A, 0xCA, 0x77, 0x77, 0x9A, 0xA5, 0xAF, 0xD3, 0xAF,
+    0xE3, 0xAA, 0xAF, 0xA6, 0xAE, 0x96, 0xF6, 0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x6F, 0xA6,
+    0xF9, 0x59, 0xF1, 0xA9, 0x29, 0xFA, 0xDA, 0x2A, 0xFE, 0x92, 0xAF, 0xDA, 0x4F, 0xA9, 0x69, 0x97,
+    0x5F, 0xFD, 0x5A, 0xFF, 0xD5, 0x9F, 0xFA, 0x71, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC,
+    0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72,
+    0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x70, 0x9A, 0xFD,
+    0xA9, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA, 0x77, 0x77, 0x72, 0x9A, 0x97, 0x4A, 0xE7, 0x39, 0xF9, 0x72,
+    0xAF, 0x73, 0xAE, 0xA7, 0x4A, 0xA9, 0x72, 0x77, 0x09, 0xE9, 0x5F, 0xC4, 0xAF, 0xC4, 0xAF, 0x94,
+    0x9E, 0xA7, 0x77, 0x39, 0xAA, 0x4A, 0xFD, 0x2A, 0xFE, 0x2A, 0xAA, 0xFA, 0x5A, 0xE9, 0x5F, 0x59,
+    0xF5, 0xAE, 0xA5, 0xF9, 0x5F, 0x59, 0xF5, 0xFA, 0x5F, 0x94, 0x9F, 0x1A, 0x91, 0x9F, 0xAD, 0xA1,
+    0xAF, 0xE9, 0x1A, 0xFD, 0xA3, 0xFA, 0x95, 0x99, 0x77, 0x39, 0x7A, 0xE5, 0x9F, 0x5A, 0xF5, 0xAE,
+    0x96, 0xAA, 0x96, 0x73, 0x99, 0x99, 0x97, 0x7A, 0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE,
+    0x96, 0xFD, 0xA9, 0x99, 0xAF, 0xD5, 0xFD, 0x59, 0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xC9, 0x79,
+    0xFC, 0x2A, 0xFC, 0x70, 0x9F, 0xC9, 0x1F, 0xC9, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x2F, 0xC9, 0x0A,
+    0xFC, 0x71, 0x9F, 0xC9, 0x0F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0xA7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71,
+    0xFC, 0xA1, 0xFC, 0xA7, 0x1F, 0xC9, 0x1F, 0xCA, 0x70, 0xAF, 0xC2, 0xFD, 0x70, 0xFC, 0x92, 0xAF,
+    0xC9, 0x6F, 0xD4, 0xFD, 0x5F, 0xD5, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xE7, 0x1F, 0xFF,
+    0xA7, 0x39, 0xFF, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x74, 0x99, 0x77, 0x4E, 0xA7, 0x72, 0xFC, 0x77,
+    0x2F, 0xA7, 0x72, 0xF7, 0x73, 0x9A, 0xA7, 0x60, 0x70, 0x9A, 0xA9, 0x71, 0x9F, 0xEA, 0x6A, 0xFF,
+    0xD4, 0xFD, 0xAF, 0xC9, 0x2A, 0xF2, 0x9F, 0xA1, 0x9F, 0x4F, 0xC1, 0xFA, 0x4A, 0xF1, 0xF9, 0x4A,
+    0xF0, 0xAF, 0x5A, 0xF0, 0xFC, 0x5F, 0xA0, 0xFA, 0x5F, 0x90, 0xFA, 0x49, 0xF1, 0xFA, 0x4F, 0xA1,
+    0xFC, 0x3A, 0xF2, 0xAF, 0x91, 0xAF, 0x92, 0x9F, 0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x73,
+    0x99, 0x77, 0x77, 0x97, 0x5A, 0xE7, 0x39, 0xF7, 0x3F, 0xC7, 0x3A, 0xE9, 0x74, 0xAA, 0x72, 0x76,
+    0x99, 0x77, 0x29, 0xFC, 0xA7, 0x7A, 0xFE, 0x97, 0x6E, 0x1A, 0xDA, 0x76, 0xD9, 0x1E, 0x97, 0x72,
+    0x9D, 0xA7, 0x71, 0xAE, 0xA7, 0x71, 0x9D, 0x97, 0x73, 0x9D, 0x77, 0x59, 0x97, 0x74, 0x99, 0x99,
+    0x97, 0x7A, 0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0x96, 0xFD, 0xA9, 0x99, 0xAF, 0xD5,
+    0xFD, 0x59, 0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xC9, 0x79, 0xFC, 0x2A, 0xFC, 0x70, 0x9F, 0xC9,
+    0x1F, 0xC9, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFC, 0x71, 0x9F, 0xC9, 0x0F, 0xCA,
+    0x71, 0x9F, 0xC1, 0xFC, 0xA7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0xFC, 0xA1, 0xFC, 0xA7, 0x1F, 0xC9,
+    0x1F, 0xCA, 0x70, 0xAF, 0xC2, 0xFD, 0x70, 0xFC, 0x92, 0xAF, 0xC9, 0x6F, 0xD4, 0xFD, 0x5F, 0xD5,
+    0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xE7, 0x1F, 0xFF, 0xA7, 0x39, 0xFF, 0xA7, 0x71, 0x99,
+    0x74, 0x71, 0x9A, 0xE9, 0x71, 0xAF, 0xDA, 0x79, 0xE9, 0xAE, 0x7A, 0xD1, 0x9E, 0x70, 0xA9, 0x1A,
+    0xD9, 0x73, 0xAD, 0xA7, 0x2A, 0xE9, 0x73, 0xE7, 0x5A, 0xD7, 0x77, 0x77, 0x69, 0xAA, 0x97, 0x19,
+    0xFE, 0xA6, 0xAF, 0xFD, 0x4F, 0xDA, 0xFC, 0x92, 0xAF, 0x29, 0xFA, 0x19, 0xF4, 0xFC, 0x1F, 0xA4,
+    0xAF, 0x1F, 0x94, 0xAF, 0x0A, 0xF5, 0xAF, 0x0F, 0xC5, 0xFA, 0x0F, 0xA5, 0xF9, 0x0F, 0xA4, 0x9F,
+    0x1F, 0xA4, 0xFA, 0x1F, 0xC3, 0xAF, 0x2A, 0xF9, 0x1A, 0xF9, 0x29, 0xFF, 0xE9, 0x4A, 0xFF, 0xC9,
+    0x69, 0xFD, 0xA7, 0x39, 0x97, 0x00, 0x77, 0x77, 0x76, 0xD7, 0x75, 0xAD, 0xA7, 0x73, 0x9E, 0x97,
+    0x73, 0xEA, 0x75, 0x9E, 0x1A, 0xD9, 0x75, 0x9F, 0xC0, 0x9C, 0x77, 0xFE, 0x77, 0x9E, 0x99, 0xEA,
+    0x75, 0x9E, 0x91, 0x9E, 0x76, 0xD9, 0x3A, 0xA7, 0x71, 0x99, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x74,
+    0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xE9, 0x7F, 0xDA, 0x99, 0x9A, 0xFD, 0x6F, 0xD5, 0x9F, 0xCA, 0x4A,
+    0xFC, 0x7F, 0xD4, 0xFC, 0x97, 0x9F, 0xC3, 0xAF, 0xC7, 0x09, 0xFC, 0x92, 0xFC, 0x97, 0x1F, 0xC9,
+    0x19, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x19, 0xFC, 0x91, 0xFC, 0xA7, 0x19, 0xFC, 0x2F, 0xCA,
+    0x71, 0xAF, 0xC2, 0xFC, 0xA7, 0x1F, 0xCA, 0x2F, 0xCA, 0x71, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC,
+    0x3F, 0xD7, 0x0F, 0xC9, 0x3A, 0xFC, 0x96, 0xFD, 0x5F, 0xD5, 0xFD, 0x6A, 0xFD, 0xA9, 0x9A, 0xFD,
+    0x97, 0xFF, 0xFE, 0x72, 0xFF, 0xFA, 0x74, 0x9F, 0xFA, 0x77, 0x29, 0x97, 0x50, 0x77, 0x29, 0x77,
+    0x4D, 0x77, 0x2E, 0xA7, 0x70, 0xAE, 0xA7, 0x79, 0xEA, 0x77, 0x0E, 0xA7, 0x70, 0x9D, 0x97, 0x59,
+    0xAA, 0x1A, 0x97, 0x5F, 0xA7, 0x7F, 0xD9, 0x75, 0xEA, 0xAE, 0x73, 0x9E, 0xA1, 0xAD, 0xA7, 0x2E,
+    0xA3, 0xD9, 0x73, 0x97, 0x77, 0x77, 0x49, 0xAA, 0x97, 0x69, 0xFE, 0xA7, 0x3A, 0xFF, 0xD7, 0x1F,
+    0xDA, 0xFC, 0x97, 0xAF, 0x29, 0xFA, 0x69, 0xF4, 0xFC, 0x6F, 0xA4, 0xAF, 0x6F, 0x94, 0xAF, 0x5A,
+    0xF5, 0xAF, 0x5F, 0xC5, 0xFA, 0x5F, 0xA5, 0xF9, 0x5F, 0xA4, 0x9F, 0x6F, 0xA4, 0xFA, 0x6F, 0xC3,
+    0xAF, 0x7A, 0xF9, 0x1A, 0xF9, 0x79, 0xFF, 0xE9, 0x71, 0xAF, 0xFC, 0x97, 0x39, 0xFD, 0xA7, 0x70,
+    0x99, 0x75, 0x77, 0x77, 0x70, 0x9C, 0xA7, 0x74, 0xE7, 0x74, 0xAD, 0xA7, 0x74, 0xE9, 0x76, 0x9E,
+    0x1A, 0xCA, 0x75, 0x9F, 0xA1, 0xA7, 0x6F, 0xDA, 0x76, 0x9E, 0xA9, 0xE9, 0x74, 0x9E, 0xA1, 0x9D,
+    0xA7, 0x5D, 0x93, 0x9A, 0x77, 0x09, 0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F,
+    0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A, 0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC,
+    0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09, 0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC,
+    0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC,
+    0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71, 0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9,
+    0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5, 0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71,
+    0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77, 0x19, 0x97, 0x40, 0x77, 0x77, 0xAC, 0x77, 0x9E, 0x77, 0xEA,
+    0x76, 0xAE, 0x77, 0xAE, 0x77, 0xAD, 0x73, 0x9A, 0xA1, 0x9A, 0x72, 0xFA, 0x74, 0xFD, 0x97, 0x2E,
+    0xAA, 0xE7, 0x09, 0xEA, 0x1A, 0xDA, 0x7E, 0xA3, 0xD9, 0x70, 0x97, 0x77, 0x76, 0x9A, 0xA9, 0x73,
+    0x9F, 0xEA, 0x70, 0xAF, 0xFD, 0x6F, 0xDA, 0xFC, 0x94, 0xAF, 0x29, 0xFA, 0x39, 0xF4, 0xFC, 0x3F,
+    0xA4, 0xAF, 0x3F, 0x94, 0xAF, 0x2A, 0xF5, 0xAF, 0x2F, 0xC5, 0xFA, 0x2F, 0xA5, 0xF9, 0x2F, 0xA4,
+    0x9F, 0x3F, 0xA4, 0xFA, 0x3F, 0xC3, 0xAF, 0x4A, 0xF9, 0x1A, 0xF9, 0x49, 0xFF, 0xE9, 0x6A, 0xFF,
+    0xC9, 0x70, 0x9F, 0xDA, 0x75, 0x99, 0x72, 0x77, 0x49, 0x77, 0x5F, 0xC7, 0x72, 0xEA, 0xDA, 0x77,
+    0x09, 0xD1, 0xDA, 0x77, 0x49, 0xD7, 0x59, 0xE1, 0x9E, 0x75, 0x9F, 0xA0, 0x9D, 0x76, 0xFD, 0xA0,
+    0x97, 0x59, 0xEA, 0x9E, 0x97, 0x59, 0xEA, 0x19, 0xDA, 0x76, 0xD9, 0x39, 0xA7, 0x71, 0x99, 0x99,
+    0x97, 0x70, 0xAF, 0xFA, 0x74, 0xAF, 0xFF, 0x97, 0x1F, 0xFF, 0xE9, 0x7F, 0xDA, 0x99, 0x9A, 0xFD,
+    0x6F, 0xD5, 0x9F, 0xCA, 0x4A, 0xFC, 0x7F, 0xD4, 0xFC, 0x97, 0x9F, 0xC3, 0xAF, 0xC7, 0x09, 0xFC,
+    0x92, 0xFC, 0x97, 0x1F, 0xC9, 0x19, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0xC7, 0x19, 0xFC, 0x91, 0xFC,
+    0xA7, 0x19, 0xFC, 0x2F, 0xCA, 0x71, 0xAF, 0xC2, 0xFC, 0xA7, 0x1F, 0xCA, 0x2F, 0xCA, 0x71, 0xFC,
+    0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x3F, 0xD7, 0x0F, 0xC9, 0x3A, 0xFC, 0x96, 0xFD, 0x5F, 0xD5, 0xFD,
+    0x6A, 0xFD, 0xA9, 0x9A, 0xFD, 0x97, 0xFF, 0xFE, 0x72, 0xFF, 0xFA, 0x74, 0x9F, 0xFA, 0x77, 0x29,
+    0x97, 0x50, 0x77, 0x77, 0x69, 0xF7, 0x70, 0xFE, 0x76, 0x9D, 0x90, 0xE7, 0x69, 0xCA, 0x1E, 0x77,
+    0x2A, 0xD9, 0x77, 0x0A, 0xE7, 0x59, 0xAA, 0x1D, 0x97, 0x5F, 0xA0, 0xD7, 0x5F, 0xD9, 0x76, 0xEA,
+    0xAE, 0x74, 0x9E, 0xA1, 0xAD, 0xA7, 0x3E, 0xA3, 0xD9, 0x74, 0x97, 0x77, 0x77, 0x69, 0xAA, 0x97,
+    0x79, 0xFE, 0xA7, 0x4A, 0xFF, 0xD7, 0x2F, 0xDA, 0xFC, 0x97, 0x0A, 0xF2, 0x9F, 0xA7, 0x9F, 0x4F,
+    0xC7, 0xFA, 0x4A, 0xF7, 0xF9, 0x4A, 0xF6, 0xAF, 0x5A, 0xF6, 0xFC, 0x5F, 0xA6, 0xFA, 0x5F, 0x96,
+    0xFA, 0x49, 0xF7, 0xFA, 0x4F, 0xA7, 0xFC, 0x3A, 0xF7, 0x0A, 0xF9, 0x1A, 0xF9, 0x70, 0x9F, 0xFE,
+    0x97, 0x2A, 0xFF, 0xC9, 0x74, 0x9F, 0xDA, 0x77, 0x19, 0x97, 0x60, 0x77, 0x77, 0x29, 0xEA, 0x1A,
+    0xC7, 0x6F, 0xDA, 0xD9, 0x74, 0x9D, 0x0A, 0xFC, 0x76, 0x99, 0x2A, 0xAA, 0x77, 0x29, 0x97, 0x74,
+    0xF7, 0x72, 0xFD, 0x97, 0x69, 0xE9, 0xAE, 0x97, 0x49, 0xE9, 0x1A, 0xDA, 0x74, 0x9D, 0x4A, 0xA7,
+    0x70, 0x99, 0x99, 0x97, 0x7A, 0xFF, 0xA7, 0x3A, 0xFF, 0xF9, 0x70, 0xFF, 0xFE, 0x96, 0xFD, 0xA9,
+    0x99, 0xAF, 0xD5, 0xFD, 0x59, 0xFC, 0xA3, 0xAF, 0xC7, 0xFD, 0x3F, 0xC9, 0x79, 0xFC, 0x2A, 0xFC,
+    0x70, 0x9F, 0xC9, 0x1F, 0xC9, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x2F, 0xC9, 0x0A, 0xFC, 0x71, 0x9F,
+    0xC9, 0x0F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0xA7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0xFC, 0xA1, 0xFC,
+    0xA7, 0x1F, 0xC9, 0x1F, 0xCA, 0x70, 0xAF, 0xC2, 0xFD, 0x70, 0xFC, 0x92, 0xAF, 0xC9, 0x6F, 0xD4,
+    0xFD, 0x5F, 0xD5, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x6F, 0xFF, 0xE7, 0x1F, 0xFF, 0xA7, 0x39, 0xFF,
+    0xA7, 0x71, 0x99, 0x74, 0x70, 0x9A, 0x93, 0x97, 0x0A, 0xEA, 0x2C, 0xA6, 0x9F, 0xD9, 0xE6, 0xAD,
+    0x9A, 0xFC, 0xA6, 0x9C, 0xA1, 0x9F, 0x76, 0x99, 0x74, 0x99, 0x97, 0x5F, 0xA7, 0x3F, 0xDA, 0x71,
+    0xEA, 0x9E, 0x96, 0x9E, 0xA1, 0x9E, 0x6E, 0xA3, 0xAC, 0xA7, 0x97, 0x77, 0x74, 0x9A, 0xA9, 0x72,
+    0x9F, 0xEA, 0x7A, 0xFF, 0xD5, 0xFD, 0xAF, 0xC9, 0x3A, 0xF2, 0x9F, 0xA2, 0x9F, 0x4F, 0xC2, 0xFA,
+    0x4A, 0xF2, 0xF9, 0x4A, 0xF1, 0xAF, 0x5A, 0xF1, 0xFC, 0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA, 0x49,
+    0xF2, 0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3, 0xAF, 0x91, 0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFC,
+    0x97, 0x9F, 0xDA, 0x74, 0x99, 0x71, 0x75, 0xAA, 0xC7, 0x73, 0xAF, 0x77, 0x1A, 0xFD, 0x77, 0xAE,
+    0xAE, 0xA7, 0x5F, 0x90, 0x9E, 0x74, 0xF9, 0x2A, 0xD9, 0x73, 0xAA, 0xA5, 0xA9, 0x77, 0x77, 0x79,
+    0x99, 0x99, 0x77, 0xAF, 0xFA, 0x73, 0xAF, 0xFF, 0x97, 0x0F, 0xFF, 0xE9, 0x6F, 0xDA, 0x99, 0x9A,
+    0xFD, 0x5F, 0xD5, 0x9F, 0xCA, 0x3A, 0xFC, 0x7F, 0xD3, 0xFC, 0x97, 0x9F, 0xC2, 0xAF, 0xC7, 0x09,
+    0xFC, 0x91, 0xFC, 0x97, 0x1F, 0xC9, 0x09, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x19, 0xFC, 0x90,
+    0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x1F, 0xCA, 0x1F, 0xCA, 0x71,
+    0xFC, 0x91, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xD7, 0x0F, 0xC9, 0x2A, 0xFC, 0x96, 0xFD, 0x4F, 0xD5,
+    0xFD, 0x5A, 0xFD, 0xA9, 0x9A, 0xFD, 0x96, 0xFF, 0xFE, 0x71, 0xFF, 0xFA, 0x73, 0x9F, 0xFA, 0x77,
+    0x19, 0x97, 0x77, 0x77, 0x49, 0x97, 0x74, 0xEA, 0x77, 0x2F, 0xC7, 0x72, 0xFA, 0x77, 0x2F, 0x77,
+    0x39, 0xAA, 0x76, 0x77, 0x74, 0xAD, 0xA7, 0x4A, 0xF9, 0x72, 0x9F, 0xD7, 0x2E, 0xAE, 0x97, 0x0E,
+    0x90, 0xAD, 0xA7, 0xEA, 0x2E, 0x69, 0xDA, 0x39, 0xCA, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x72, 0x9F,
+    0xEA, 0x7A, 0xFF, 0xD5, 0xFD, 0xAF, 0xC9, 0x3A, 0xF2, 0x9F, 0xA2, 0x9F, 0x4F, 0xC2, 0xFA, 0x4A,
+    0xF2, 0xF9, 0x4A, 0xF1, 0xAF, 0x5A, 0xF1, 0xFC, 0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA, 0x49, 0xF2,
+    0xFA, 0x4F, 0xA2, 0xFC, 0x3A, 0xF3, 0xAF, 0x91, 0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFC, 0x97,
+    0x9F, 0xDA, 0x74, 0x99, 0x77, 0x77, 0x19, 0x76, 0xAE, 0x74, 0x9F, 0x74, 0xFC, 0x74, 0xAE, 0x97,
+    0x5A, 0xA7, 0x30, 0x77, 0x77, 0x74, 0xC9, 0x77, 0x69, 0xDA, 0x77, 0x5F, 0xC7, 0x73, 0xAF, 0xCA,
+    0x77, 0x2F, 0xDA, 0x77, 0x29, 0xF9, 0x5E, 0xA7, 0x3A, 0x97, 0x9F, 0x77, 0x5A, 0xF7, 0x39, 0x99,
+    0x99, 0x4F, 0x97, 0x0A, 0xFF, 0xA1, 0xAE, 0xA7, 0xAF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD,
+    0xA9, 0x99, 0xAF, 0xD7, 0x0F, 0xD5, 0x9F, 0xCA, 0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x97, 0x9F, 0xC5,
+    0xAF, 0xC7, 0x09, 0xFC, 0x94, 0xFC, 0x97, 0x1F, 0xC9, 0x39, 0xFC, 0x72, 0xFC, 0x93, 0xAF, 0xC7,
+    0x19, 0xFC, 0x93, 0xFC, 0xA7, 0x19, 0xFC, 0x4F, 0xCA, 0x71, 0xAF, 0xC4, 0xFC, 0xA7, 0x1F, 0xCA,
+    0x4F, 0xCA, 0x71, 0xFC, 0x94, 0xFC, 0xA7, 0x0A, 0xFC, 0x5F, 0xD7, 0x0F, 0xC9, 0x5A, 0xFC, 0x96,
+    0xFD, 0x7F, 0xD5, 0xFD, 0x70, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFE, 0x74, 0xFF, 0xFA,
+    0x76, 0x9F, 0xFA, 0x77, 0x49, 0x97, 0x70, 0x77, 0x77, 0x1A, 0xC7, 0x72, 0xE7, 0x70, 0xF7, 0x79,
+    0xF7, 0x7F, 0x77, 0xAE, 0x77, 0x0E, 0x77, 0x1A, 0xA3, 0x9D, 0xA7, 0x70, 0xAE, 0x77, 0x0A, 0xE7,
+    0x19, 0xAA, 0x92, 0xE9, 0x69, 0xFE, 0xAE, 0xA6, 0xAF, 0xFE, 0xA6, 0xFD, 0xAF, 0xCA, 0x6A, 0xF2,
+    0x9F, 0xA5, 0x9F, 0x4F, 0xC5, 0xFA, 0x4A, 0xF5, 0xF9, 0x4A, 0xF4, 0xAF, 0x5A, 0xF4, 0xFC, 0x5F,
+    0xA4, 0xFA, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xFA, 0x4F, 0xA5, 0xFC, 0x3A, 0xF6, 0xAF, 0x91, 0xAF,
+    0x96, 0x9F, 0xFE, 0x97, 0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x99, 0x74, 0x77, 0x77, 0x49,
+    0xC7, 0x77, 0x0E, 0x97, 0x75, 0x9F, 0xA7, 0x75, 0xFC, 0xA7, 0x75, 0xAF, 0xC7, 0x76, 0xAE, 0x94,
+    0xEA, 0x76, 0x9A, 0x49, 0xF7, 0x75, 0xAF, 0x73, 0x99, 0x99, 0x94, 0xF9, 0x70, 0xAF, 0xFA, 0x1A,
+    0xEA, 0x7A, 0xFF, 0xFF, 0x97, 0xFF, 0xFF, 0xC9, 0x7F, 0xDA, 0x99, 0x9A, 0xFD, 0x70, 0xFD, 0x59,
+    0xFC, 0xA6, 0xAF, 0xC7, 0xFD, 0x6F, 0xC9, 0x79, 0xFC, 0x5A, 0xFC, 0x70, 0x9F, 0xC9, 0x4F, 0xC9,
+    0x71, 0xFC, 0x93, 0x9F, 0xC7, 0x2F, 0xC9, 0x3A, 0xFC, 0x71, 0x9F, 0xC9, 0x3F, 0xCA, 0x71, 0x9F,
+    0xC4, 0xFC, 0xA7, 0x1A, 0xFC, 0x4F, 0xCA, 0x71, 0xFC, 0xA4, 0xFC, 0xA7, 0x1F, 0xC9, 0x4F, 0xCA,
+    0x70, 0xAF, 0xC5, 0xFD, 0x70, 0xFC, 0x95, 0xAF, 0xC9, 0x6F, 0xD7, 0xFD, 0x5F, 0xD7, 0x0A, 0xFD,
+    0xA9, 0x9A, 0xFD, 0x97, 0x1F, 0xFF, 0xE7, 0x4F, 0xFF, 0xA7, 0x69, 0xFF, 0xA7, 0x74, 0x99, 0x77,
+    0x79, 0x77, 0x2D, 0x97, 0x70, 0xAE, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x71, 0xEA,
+    0x77, 0x1A, 0xC9, 0x29, 0xDA, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x71, 0x9A, 0xA9, 0x2E, 0x96, 0x9F,
+    0xEA, 0xEA, 0x6A, 0xFF, 0xEA, 0x6F, 0xDA, 0xFC, 0xA6, 0xAF, 0x29, 0xFA, 0x59, 0xF4, 0xFC, 0x5F,
+    0xA4, 0xAF, 0x5F, 0x94, 0xAF, 0x4A, 0xF5, 0xAF, 0x4F, 0xC5, 0xFA, 0x4F, 0xA5, 0xF9, 0x4F, 0xA4,
+    0x9F, 0x5F, 0xA4, 0xFA, 0x5F, 0xC3, 0xAF, 0x6A, 0xF9, 0x1A, 0xF9, 0x69, 0xFF, 0xE9, 0x70, 0xAF,
+    0xFC, 0x97, 0x29, 0xFD, 0xA7, 0x79, 0x97, 0x40, 0x76, 0x99, 0x77, 0x59, 0xFC, 0xA7, 0x72, 0xAF,
+    0xE9, 0x77, 0x1E, 0x1A, 0xDA, 0x77, 0x1D, 0x91, 0xE9, 0x77, 0x59, 0xDA, 0x77, 0x4A, 0xEA, 0x77,
+    0x49, 0xD9, 0x6E, 0xA7, 0x39, 0xD6, 0x9F, 0x74, 0x99, 0x6A, 0xF7, 0x39, 0x99, 0x99, 0x4F, 0x97,
+    0x0A, 0xFF, 0xA1, 0xAE, 0xA7, 0xAF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD, 0xA9, 0x99, 0xAF,
+    0xD7, 0x0F, 0xD5, 0x9F, 0xCA, 0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x97, 0x9F, 0xC5, 0xAF, 0xC7, 0x09,
+    0xFC, 0x94, 0xFC, 0x97, 0x1F, 0xC9, 0x39, 0xFC, 0x72, 0xFC, 0x93, 0xAF, 0xC7, 0x19, 0xFC, 0x93,
+    0xFC, 0xA7, 0x19, 0xFC, 0x4F, 0xCA, 0x71, 0xAF, 0xC4, 0xFC, 0xA7, 0x1F, 0xCA, 0x4F, 0xCA, 0x71,
+    0xFC, 0x94, 0xFC, 0xA7, 0x0A, 0xFC, 0x5F, 0xD7, 0x0F, 0xC9, 0x5A, 0xFC, 0x96, 0xFD, 0x7F, 0xD5,
+    0xFD, 0x70, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFE, 0x74, 0xFF, 0xFA, 0x76, 0x9F, 0xFA,
+    0x77, 0x49, 0x97, 0x70, 0x70, 0x9A, 0xDA, 0x97, 0x5F, 0xE7, 0x4A, 0xDA, 0x9E, 0xA7, 0x3D, 0xA1,
+    0xAD, 0x97, 0x4A, 0x91, 0xE7, 0x70, 0xE9, 0x76, 0xF7, 0x70, 0xDA, 0x77, 0x1D, 0x93, 0x9D, 0xA7,
+    0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x19, 0xAA, 0x92, 0xE9, 0x69, 0xFE, 0xAE, 0xA6, 0xAF, 0xFE, 0xA6,
+    0xFD, 0xAF, 0xCA, 0x6A, 0xF2, 0x9F, 0xA5, 0x9F, 0x4F, 0xC5, 0xFA, 0x4A, 0xF5, 0xF9, 0x4A, 0xF4,
+    0xAF, 0x5A, 0xF4, 0xFC, 0x5F, 0xA4, 0xFA, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xFA, 0x4F, 0xA5, 0xFC,
+    0x3A, 0xF6, 0xAF, 0x91, 0xAF, 0x96, 0x9F, 0xFE, 0x97, 0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77,
+    0x99, 0x74, 0x77, 0x77, 0x5A, 0xDA, 0x2A, 0xC7, 0x70, 0xFD, 0x0A, 0xD9, 0x76, 0x9F, 0xFD, 0x77,
+    0xAD, 0x1F, 0xCA, 0x77, 0x0C, 0x92, 0xE9, 0x3E, 0xA7, 0x75, 0x9F, 0x77, 0x5A, 0xF7, 0x39, 0x99,
+    0x99, 0x4F, 0x97, 0x0A, 0xFF, 0xA1, 0xAE, 0xA7, 0xAF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD,
+    0xA9, 0x99, 0xAF, 0xD7, 0x0F, 0xD5, 0x9F, 0xCA, 0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x97, 0x9F, 0xC5,
+    0xAF, 0xC7, 0x09, 0xFC, 0x94, 0xFC, 0x97, 0x1F, 0xC9, 0x39, 0xFC, 0x72, 0xFC, 0x93, 0xAF, 0xC7,
+    0x19, 0xFC, 0x93, 0xFC, 0xA7, 0x19, 0xFC, 0x4F, 0xCA, 0x71, 0xAF, 0xC4, 0xFC, 0xA7, 0x1F, 0xCA,
+    0x4F, 0xCA, 0x71, 0xFC, 0x94, 0xFC, 0xA7, 0x0A, 0xFC, 0x5F, 0xD7, 0x0F, 0xC9, 0x5A, 0xFC, 0x96,
+    0xFD, 0x7F, 0xD5, 0xFD, 0x70, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFE, 0x74, 0xFF, 0xFA,
+    0x76, 0x9F, 0xFA, 0x77, 0x49, 0x97, 0x70, 0x69, 0xDA, 0x29, 0xA7, 0x2A, 0xFA, 0x1D, 0xA7, 0x1F,
+    0xDA, 0xE9, 0x70, 0x9D, 0x90, 0xFD, 0x72, 0xCA, 0x19, 0xF7, 0x71, 0x92, 0x9D, 0xA7, 0x70, 0xAE,
+    0x77, 0x0A, 0xE7, 0x19, 0xAA, 0x92, 0xE9, 0x69, 0xFE, 0xAE, 0xA6, 0xAF, 0xFE, 0xA6, 0xFD, 0xAF,
+    0xCA, 0x6A, 0xF2, 0x9F, 0xA5, 0x9F, 0x4F, 0xC5, 0xFA, 0x4A, 0xF5, 0xF9, 0x4A, 0xF4, 0xAF, 0x5A,
+    0xF4, 0xFC, 0x5F, 0xA4, 0xFA, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xFA, 0x4F, 0xA5, 0xFC, 0x3A, 0xF6,
+    0xAF, 0x91, 0xAF, 0x96, 0x9F, 0xFE, 0x97, 0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x99, 0x74,
+    0x77, 0x77, 0x77, 0x1E, 0xA7, 0x75, 0x9F, 0x77, 0x5A, 0xF7, 0x39, 0x99, 0x99, 0x4F, 0x97, 0x0A,
+    0xFF, 0xA1, 0xAE, 0xA7, 0xAF, 0xFF, 0xF9, 0x7F, 0xFF, 0xFC, 0x97, 0xFD, 0xA9, 0x99, 0xAF, 0xD7,
+    0x0F, 0xD5, 0x9F, 0xCA, 0x6A, 0xFC, 0x7F, 0xD6, 0xFC, 0x97, 0x9F, 0xC5, 0xAF, 0xC7, 0x09, 0xFC,
+    0x94, 0xFC, 0x97, 0x1F, 0xC9, 0x39, 0xFC, 0x72, 0xFC, 0x93, 0xAF, 0xC7, 0x19, 0xFC, 0x93, 0xFC,
+    0xA7, 0x19, 0xFC, 0x4F, 0xCA, 0x71, 0xAF, 0xC4, 0xFC, 0xA7, 0x1F, 0xCA, 0x4F, 0xCA, 0x71, 0xFC,
+    0x94, 0xFC, 0xA7, 0x0A, 0xFC, 0x5F, 0xD7, 0x0F, 0xC9, 0x5A, 0xFC, 0x96, 0xFD, 0x7F, 0xD5, 0xFD,
+    0x70, 0xAF, 0xDA, 0x99, 0xAF, 0xD9, 0x71, 0xFF, 0xFE, 0x74, 0xFF, 0xFA, 0x76, 0x9F, 0xFA, 0x77,
+    0x49, 0x97, 0x77, 0x77, 0x72, 0x99, 0x77, 0x7E, 0xA7, 0x75, 0xFC, 0x77, 0x5F, 0xA7, 0x75, 0xF7,
+    0x76, 0x9A, 0xA7, 0x71, 0x77, 0x9D, 0xA7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x19, 0xAA, 0x92, 0xE9,
+    0x69, 0xFE, 0xAE, 0xA6, 0xAF, 0xFE, 0xA6, 0xFD, 0xAF, 0xCA, 0x6A, 0xF2, 0x9F, 0xA5, 0x9F, 0x4F,
+    0xC5, 0xFA, 0x4A, 0xF5, 0xF9, 0x4A, 0xF4, 0xAF, 0x5A, 0xF4, 0xFC, 0x5F, 0xA4, 0xFA, 0x5F, 0x94,
+    0xFA, 0x49, 0xF5, 0xFA, 0x4F, 0xA5, 0xFC, 0x3A, 0xF6, 0xAF, 0x91, 0xAF, 0x96, 0x9F, 0xFE, 0x97,
+    0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x99, 0x77, 0x77, 0x79, 0x77, 0x1A, 0xE7, 0x79, 0xF7,
+    0x7F, 0xC7, 0x7A, 0xE9, 0x77, 0x0A, 0xA7, 0x60, 0x09, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1, 0xFF, 0xD9,
+    0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA, 0x6F, 0xC7,
+    0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7, 0x0F, 0x96,
+    0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6, 0xFC, 0x70,
+    0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC, 0x70, 0xFE,
+    0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97, 0x72, 0x99,
+    0x97, 0x77, 0x77, 0x70, 0x9A, 0x97, 0x75, 0xAE, 0x97, 0x73, 0x9F, 0x97, 0x73, 0xAF, 0x97, 0x73,
+    0x9E, 0xA7, 0x75, 0xAA, 0x97, 0x70, 0x39, 0x9A, 0x96, 0x99, 0x99, 0x19, 0xFD, 0x94, 0xF9, 0x1F,
+    0xEA, 0x3A, 0xF2, 0xAA, 0xAF, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x5F, 0x4F, 0x94, 0x9F, 0x39, 0xF5,
+    0xAE, 0xA3, 0xAF, 0x5F, 0x93, 0xFA, 0x49, 0xF3, 0x9F, 0x94, 0xAF, 0x3F, 0xC5, 0xF9, 0x2A, 0xFC,
+    0x5F, 0x29, 0xFD, 0x49, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x09, 0xF9, 0xAE, 0x0F, 0xEA, 0x09, 0xFF,
+    0x1F, 0xE1, 0x9F, 0xE2, 0xFD, 0x92, 0xAF, 0xA3, 0x9E, 0xA6, 0x99, 0x79, 0x77, 0x77, 0x99, 0x77,
+    0x0F, 0x76, 0xAF, 0x76, 0xFC, 0x76, 0xF9, 0x77, 0xAA, 0x73, 0x75, 0x99, 0x77, 0x5A, 0xFC, 0x77,
+    0x2F, 0xEA, 0x77, 0x0A, 0xD9, 0x09, 0xE7, 0x70, 0xAC, 0xA1, 0x9D, 0xA7, 0x75, 0xE7, 0x73, 0x9E,
+    0xA7, 0x74, 0xDA, 0x77, 0x6D, 0x97, 0x76, 0x99, 0x77, 0x77, 0x69, 0xFF, 0xCA, 0x2A, 0xFF, 0xC1,
+    0xFF, 0xD9, 0x2F, 0xFD, 0x1A, 0xFF, 0x93, 0xAF, 0xE9, 0x4A, 0xF9, 0x7A, 0xF6, 0xAF, 0x70, 0xFA,
+    0x6F, 0xC7, 0x0F, 0x96, 0xFC, 0x79, 0xF6, 0x9F, 0xA7, 0x9F, 0x6A, 0xF9, 0x7A, 0xEA, 0x6F, 0xC7,
+    0x0F, 0x96, 0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x9F, 0x69, 0xFA, 0x79, 0xF6, 0xAF, 0x97, 0xAE, 0xA6,
+    0xFC, 0x70, 0xF9, 0x6F, 0xC7, 0x0F, 0x7F, 0xC7, 0xAF, 0x7F, 0xC7, 0xF9, 0x7F, 0xCA, 0x49, 0xFC,
+    0x70, 0xFE, 0xAA, 0xAF, 0xD9, 0x70, 0x9F, 0xFF, 0xD9, 0x72, 0x9F, 0xFF, 0x97, 0x5A, 0xFF, 0x97,
+    0x72, 0x99, 0x97, 0x70, 0x71, 0x9A, 0xDA, 0x97, 0x4F, 0xE7, 0x3A, 0xDA, 0x9E, 0xA7, 0x2D, 0xA1,
+    0xAD, 0x97, 0x3A, 0x91, 0xE7, 0x7E, 0x97, 0x5F, 0x77, 0xDA, 0x77, 0x0D, 0x97, 0x77, 0x77, 0x72,
+    0x99, 0xA9, 0x69, 0x99, 0x91, 0x9F, 0xD9, 0x4F, 0x91, 0xFE, 0xA3, 0xAF, 0x2A, 0xAA, 0xFA, 0x3A,
+    0xF5, 0xF9, 0x3F, 0xA5, 0xF4, 0xF9, 0x49, 0xF3, 0x9F, 0x5A, 0xEA, 0x3A, 0xF5, 0xF9, 0x3F, 0xA4,
+    0x9F, 0x39, 0xF9, 0x4A, 0xF3, 0xFC, 0x5F, 0x92, 0xAF, 0xC5, 0xF2, 0x9F, 0xD4, 0x9F, 0x19, 0xDA,
+    0xF0, 0x9C, 0x90, 0x9F, 0x9A, 0xE0, 0xFE, 0xA0, 0x9F, 0xF1, 0xFE, 0x19, 0xFE, 0x2F, 0xD9, 0x2A,
+    0xFA, 0x39, 0xEA, 0x69, 0x97, 0x94, 0x77, 0x77, 0x75, 0xAA, 0x77, 0x71, 0xE7, 0x77, 0xAF, 0x77,
+    0x59, 0xFD, 0x77, 0x4A, 0xFD, 0x77, 0x5F, 0xA7, 0x9E, 0x97, 0x2A, 0x97, 0x29, 0xF7, 0x77, 0xAE,
+    0xA7, 0x76, 0xAF, 0x19, 0xFF, 0xCA, 0x2A, 0xFF, 0xE9, 0x1F, 0xFD, 0x92, 0xFF, 0xDA, 0x3A, 0xFF,
+    0x93, 0xAF, 0xDA, 0x97, 0xAF, 0x97, 0xAF, 0x71, 0xAF, 0x70, 0xFA, 0x71, 0xFC, 0x70, 0xF9, 0x71,
+    0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71,
+    0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71,
+    0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF7, 0x2F, 0xC7, 0xAF, 0x72, 0xFC, 0x7F, 0x97, 0x2F, 0xCA,
+    0x49, 0xFC, 0x73, 0xFE, 0xAA, 0xAF, 0xD9, 0x73, 0x9F, 0xFF, 0xD9, 0x75, 0x9F, 0xFF, 0x97, 0x70,
+    0xAF, 0xF9, 0x77, 0x59, 0x99, 0x77, 0x20, 0x77, 0x77, 0x5A, 0xC7, 0x75, 0xE7, 0x73, 0xF7, 0x72,
+    0x9F, 0x77, 0x2F, 0x77, 0x2A, 0xE7, 0x73, 0xE7, 0x74, 0xAA, 0x59, 0xDA, 0x77, 0x3A, 0xE7, 0x73,
+    0xF4, 0x99, 0xA9, 0x69, 0x9A, 0xF2, 0x9F, 0xD9, 0x4F, 0xDA, 0x3F, 0xEA, 0x3A, 0xF9, 0x5A, 0xAA,
+    0xFA, 0x3A, 0xF7, 0x1F, 0x93, 0xFA, 0x71, 0xF4, 0xF7, 0x19, 0xF3, 0x9F, 0x71, 0xAE, 0xA3, 0xAF,
+    0x71, 0xF9, 0x3F, 0xA7, 0x09, 0xF3, 0x9F, 0x97, 0x0A, 0xF3, 0xFC, 0x71, 0xF9, 0x2A, 0xFC, 0x71,
+    0xF2, 0x9F, 0xD7, 0x09, 0xF1, 0x9D, 0xAF, 0x09, 0xC9, 0x49, 0xF9, 0xAE, 0x0F, 0xEA, 0x49, 0xFF,
+    0x1F, 0xE5, 0x9F, 0xE2, 0xFD, 0x96, 0xAF, 0xA3, 0x9E, 0xA7, 0x29, 0x97, 0x97, 0x00, 0x77, 0x77,
+    0x6C, 0x97, 0x77, 0x1A, 0xDA, 0x77, 0x70, 0xFC, 0x77, 0x7A, 0xFC, 0x97, 0x76, 0xAF, 0xC9, 0x77,
+    0x79, 0xF6, 0x9E, 0x97, 0x6A, 0x79, 0xF7, 0x77, 0xAE, 0xA7, 0x76, 0xAF, 0x19, 0xFF, 0xCA, 0x2A,
+    0xFF, 0xE9, 0x1F, 0xFD, 0x92, 0xFF, 0xDA, 0x3A, 0xFF, 0x93, 0xAF, 0xDA, 0x97, 0xAF, 0x97, 0xAF,
+    0x71, 0xAF, 0x70, 0xFA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7,
+    0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7,
+    0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF7,
+    0x2F, 0xC7, 0xAF, 0x72, 0xFC, 0x7F, 0x97, 0x2F, 0xCA, 0x49, 0xFC, 0x73, 0xFE, 0xAA, 0xAF, 0xD9,
+    0x73, 0x9F, 0xFF, 0xD9, 0x75, 0x9F, 0xFF, 0x97, 0x70, 0xAF, 0xF9, 0x77, 0x59, 0x99, 0x77, 0x20,
+    0x70, 0x97, 0x75, 0xD9, 0x77, 0x3A, 0xE7, 0x73, 0xAE, 0xA7, 0x73, 0xF9, 0x77, 0x29, 0xF7, 0x74,
+    0xEA, 0x77, 0x4A, 0xC9, 0x49, 0xDA, 0x77, 0x3A, 0xE7, 0x73, 0xF4, 0x99, 0xA9, 0x69, 0x9A, 0xF2,
+    0x9F, 0xD9, 0x4F, 0xDA, 0x3F, 0xEA, 0x3A, 0xF9, 0x5A, 0xAA, 0xFA, 0x3A, 0xF7, 0x1F, 0x93, 0xFA,
+    0x71, 0xF4, 0xF7, 0x19, 0xF3, 0x9F, 0x71, 0xAE, 0xA3, 0xAF, 0x71, 0xF9, 0x3F, 0xA7, 0x09, 0xF3,
+    0x9F, 0x97, 0x0A, 0xF3, 0xFC, 0x71, 0xF9, 0x2A, 0xFC, 0x71, 0xF2, 0x9F, 0xD7, 0x09, 0xF1, 0x9D,
+    0xAF, 0x09, 0xC9, 0x49, 0xF9, 0xAE, 0x0F, 0xEA, 0x49, 0xFF, 0x1F, 0xE5, 0x9F, 0xE2, 0xFD, 0x96,
+    0xAF, 0xA3, 0x9E, 0xA7, 0x29, 0x97, 0x97, 0x00, 0x75, 0x99, 0x77, 0x70, 0xAF, 0xC7, 0x75, 0xFE,
+    0xA7, 0x73, 0xAD, 0x90, 0x9E, 0x77, 0x3A, 0xCA, 0x19, 0xDA, 0x77, 0x70, 0xE7, 0x76, 0x9E, 0xA7,
+    0x77, 0xDA, 0x70, 0x9E, 0x97, 0x3D, 0x97, 0x09, 0xF7, 0x39, 0x97, 0x1A, 0xEA, 0x77, 0x6A, 0xF1,
+    0x9F, 0xFC, 0xA2, 0xAF, 0xFE, 0x91, 0xFF, 0xD9, 0x2F, 0xFD, 0xA3, 0xAF, 0xF9, 0x3A, 0xFD, 0xA9,
+    0x7A, 0xF9, 0x7A, 0xF7, 0x1A, 0xF7, 0x0F, 0xA7, 0x1F, 0xC7, 0x0F, 0x97, 0x1F, 0xC7, 0x9F, 0x71,
+    0x9F, 0xA7, 0x9F, 0x71, 0xAF, 0x97, 0xAE, 0xA7, 0x1F, 0xC7, 0x0F, 0x97, 0x1F, 0xC7, 0x0F, 0x97,
+    0x1F, 0xC7, 0x9F, 0x71, 0x9F, 0xA7, 0x9F, 0x71, 0xAF, 0x97, 0xAE, 0xA7, 0x1F, 0xC7, 0x0F, 0x97,
+    0x1F, 0xC7, 0x0F, 0x72, 0xFC, 0x7A, 0xF7, 0x2F, 0xC7, 0xF9, 0x72, 0xFC, 0xA4, 0x9F, 0xC7, 0x3F,
+    0xEA, 0xAA, 0xFD, 0x97, 0x39, 0xFF, 0xFD, 0x97, 0x59, 0xFF, 0xF9, 0x77, 0x0A, 0xFF, 0x97, 0x75,
+    0x99, 0x97, 0x72, 0x71, 0x9A, 0xDA, 0x97, 0x70, 0xFE, 0x77, 0xAD, 0xA9, 0xEA, 0x76, 0xDA, 0x1A,
+    0xD9, 0x77, 0xA9, 0x1E, 0x77, 0x3E, 0x97, 0x71, 0xF7, 0x73, 0xDA, 0x77, 0x4D, 0x95, 0x9D, 0xA7,
+    0x73, 0xAE, 0x77, 0x3F, 0x49, 0x9A, 0x96, 0x99, 0xAF, 0x29, 0xFD, 0x94, 0xFD, 0xA3, 0xFE, 0xA3,
+    0xAF, 0x95, 0xAA, 0xAF, 0xA3, 0xAF, 0x71, 0xF9, 0x3F, 0xA7, 0x1F, 0x4F, 0x71, 0x9F, 0x39, 0xF7,
+    0x1A, 0xEA, 0x3A, 0xF7, 0x1F, 0x93, 0xFA, 0x70, 0x9F, 0x39, 0xF9, 0x70, 0xAF, 0x3F, 0xC7, 0x1F,
+    0x92, 0xAF, 0xC7, 0x1F, 0x29, 0xFD, 0x70, 0x9F, 0x19, 0xDA, 0xF0, 0x9C, 0x94, 0x9F, 0x9A, 0xE0,
+    0xFE, 0xA4, 0x9F, 0xF1, 0xFE, 0x59, 0xFE, 0x2F, 0xD9, 0x6A, 0xFA, 0x39, 0xEA, 0x72, 0x99, 0x79,
+    0x70, 0x77, 0x77, 0x69, 0xE9, 0x19, 0xC9, 0x77, 0x1A, 0xFC, 0x99, 0xE7, 0x71, 0xFF, 0xDA, 0x77,
+    0x1D, 0x90, 0xAF, 0xC7, 0x72, 0xAA, 0x2A, 0xDA, 0x59, 0xE9, 0x77, 0x79, 0xF7, 0x77, 0xAE, 0xA7,
+    0x76, 0xAF, 0x19, 0xFF, 0xCA, 0x2A, 0xFF, 0xE9, 0x1F, 0xFD, 0x92, 0xFF, 0xDA, 0x3A, 0xFF, 0x93,
+    0xAF, 0xDA, 0x97, 0xAF, 0x97, 0xAF, 0x71, 0xAF, 0x70, 0xFA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC,
+    0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC,
+    0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC,
+    0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF7, 0x2F, 0xC7, 0xAF, 0x72, 0xFC, 0x7F, 0x97, 0x2F, 0xCA, 0x49,
+    0xFC, 0x73, 0xFE, 0xAA, 0xAF, 0xD9, 0x73, 0x9F, 0xFF, 0xD9, 0x75, 0x9F, 0xFF, 0x97, 0x70, 0xAF,
+    0xF9, 0x77, 0x59, 0x99, 0x77, 0x20, 0x79, 0xDA, 0x29, 0xA7, 0x5A, 0xFA, 0x1D, 0xA7, 0x4F, 0xDA,
+    0xE9, 0x73, 0x9D, 0x90, 0xFD, 0x75, 0xCA, 0x19, 0xF7, 0x74, 0x94, 0x9D, 0xA7, 0x73, 0xAE, 0x77,
+    0x3F, 0x49, 0x9A, 0x96, 0x99, 0xAF, 0x29, 0xFD, 0x94, 0xFD, 0xA3, 0xFE, 0xA3, 0xAF, 0x95, 0xAA,
+    0xAF, 0xA3, 0xAF, 0x71, 0xF9, 0x3F, 0xA7, 0x1F, 0x4F, 0x71, 0x9F, 0x39, 0xF7, 0x1A, 0xEA, 0x3A,
+    0xF7, 0x1F, 0x93, 0xFA, 0x70, 0x9F, 0x39, 0xF9, 0x70, 0xAF, 0x3F, 0xC7, 0x1F, 0x92, 0xAF, 0xC7,
+    0x1F, 0x29, 0xFD, 0x70, 0x9F, 0x19, 0xDA, 0xF0, 0x9C, 0x94, 0x9F, 0x9A, 0xE0, 0xFE, 0xA4, 0x9F,
+    0xF1, 0xFE, 0x59, 0xFE, 0x2F, 0xD9, 0x6A, 0xFA, 0x39, 0xEA, 0x72, 0x99, 0x79, 0x70, 0x77, 0x77,
+    0x77, 0x49, 0xE9, 0x77, 0x79, 0xF7, 0x77, 0xAE, 0xA7, 0x76, 0xAF, 0x19, 0xFF, 0xCA, 0x2A, 0xFF,
+    0xE9, 0x1F, 0xFD, 0x92, 0xFF, 0xDA, 0x3A, 0xFF, 0x93, 0xAF, 0xDA, 0x97, 0xAF, 0x97, 0xAF, 0x71,
+    0xAF, 0x70, 0xFA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19, 0xFA, 0x79, 0xF7, 0x1A,
+    0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x79, 0xF7, 0x19,
+    0xFA, 0x79, 0xF7, 0x1A, 0xF9, 0x7A, 0xEA, 0x71, 0xFC, 0x70, 0xF9, 0x71, 0xFC, 0x70, 0xF7, 0x2F,
+    0xC7, 0xAF, 0x72, 0xFC, 0x7F, 0x97, 0x2F, 0xCA, 0x49, 0xFC, 0x73, 0xFE, 0xAA, 0xAF, 0xD9, 0x73,
+    0x9F, 0xFF, 0xD9, 0x75, 0x9F, 0xFF, 0x97, 0x70, 0xAF, 0xF9, 0x77, 0x59, 0x99, 0x77, 0x77, 0x77,
+    0x69, 0xA9, 0x77, 0x70, 0xAE, 0x97, 0x76, 0x9F, 0x97, 0x76, 0xAF, 0x97, 0x76, 0x9E, 0xA7, 0x77,
+    0x0A, 0xA9, 0x77, 0x30, 0x77, 0x29, 0xDA, 0x77, 0x3A, 0xE7, 0x73, 0xF4, 0x99, 0xA9, 0x69, 0x9A,
+    0xF2, 0x9F, 0xD9, 0x4F, 0xDA, 0x3F, 0xEA, 0x3A, 0xF9, 0x5A, 0xAA, 0xFA, 0x3A, 0xF7, 0x1F, 0x93,
+    0xFA, 0x71, 0xF4, 0xF7, 0x19, 0xF3, 0x9F, 0x71, 0xAE, 0xA3, 0xAF, 0x71, 0xF9, 0x3F, 0xA7, 0x09,
+    0xF3, 0x9F, 0x97, 0x0A, 0xF3, 0xFC, 0x71, 0xF9, 0x2A, 0xFC, 0x71, 0xF2, 0x9F, 0xD7, 0x09, 0xF1,
+    0x9D, 0xAF, 0x09, 0xC9, 0x49, 0xF9, 0xAE, 0x0F, 0xEA, 0x49, 0xFF, 0x1F, 0xE5, 0x9F, 0xE2, 0xFD,
+    0x96, 0xAF, 0xA3, 0x9E, 0xA7, 0x29, 0x97, 0x97, 0x77, 0x77, 0x99, 0x77, 0x4F, 0x77, 0x2A, 0xF7,
+    0x72, 0xFC, 0x77, 0x2F, 0x97, 0x73, 0xAA, 0x77, 0x77, 0x77, 0xC9, 0x77, 0x3A, 0xDA, 0x77, 0x2F,
+    0xC7, 0x71, 0xFD, 0x77, 0x1A, 0xFC, 0x97, 0x71, 0x9E, 0xA7, 0x74, 0xA7, 0x77, 0x77, 0x76, 0xAF,
+    0xFC, 0x2F, 0xFA, 0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE, 0x93, 0x9F, 0xD9, 0x3F, 0xC6, 0xAE,
+    0xA5, 0xAF, 0x59, 0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE, 0x97, 0x0A, 0xF2, 0x9E, 0xA7, 0x19,
+    0xF9, 0x1F, 0x73, 0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F, 0xEA, 0x76, 0xFE, 0x77, 0x9F, 0xC7,
+    0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFA,
+    0x76, 0x9A, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA, 0x71, 0x73, 0x97, 0x73, 0xD9, 0x77,
+    0x1A, 0xE7, 0x71, 0xAE, 0xA7, 0x71, 0xF9, 0x77, 0x09, 0xF7, 0x72, 0xEA, 0x77, 0x2A, 0xC9, 0x77,
+    0x77, 0x77, 0x70, 0x99, 0xA5, 0x9A, 0xA7, 0xAF, 0xC3, 0xFC, 0x94, 0x9F, 0xDA, 0x29, 0xFA, 0x49,
+    0xAF, 0xD3, 0xFC, 0x79, 0xF3, 0xAE, 0xA7, 0x0F, 0x92, 0xAE, 0xA7, 0x0F, 0x92, 0xF9, 0x70, 0xAE,
+    0xA2, 0xF7, 0x19, 0xEA, 0x19, 0xEA, 0x72, 0xF1, 0xAE, 0x73, 0xF1, 0xEA, 0x73, 0xF0, 0x9E, 0x74,
+    0xF0, 0xEA, 0x74, 0xF9, 0xE7, 0x5A, 0xFD, 0x97, 0x5A, 0xFC, 0xA7, 0x6A, 0xFC, 0x77, 0xFC, 0x77,
+    0x0F, 0x97, 0x7A, 0xE9, 0x77, 0x9E, 0x97, 0x1D, 0x91, 0x9A, 0xE9, 0x71, 0x9F, 0xFC, 0x97, 0x2A,
+    0xFF, 0x97, 0x4F, 0xDA, 0x77, 0xAC, 0xAA, 0x77, 0x0A, 0xFF, 0xC2, 0xFF, 0xA0, 0xFF, 0xCA, 0x19,
+    0xFF, 0xA0, 0xAF, 0xE9, 0x39, 0xFD, 0x93, 0xFC, 0x6A, 0xEA, 0x5A, 0xF5, 0x9F, 0x69, 0xF9, 0x4F,
+    0x70, 0xFC, 0x3A, 0xE9, 0x70, 0xAF, 0x29, 0xEA, 0x71, 0x9F, 0x91, 0xF7, 0x3F, 0xC0, 0xF7, 0x4A,
+    0xFA, 0xE9, 0x75, 0xFE, 0xA7, 0x6F, 0xE7, 0x79, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x0A, 0xF9, 0x77,
+    0x0A, 0xF7, 0x71, 0xFC, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xA7, 0x69, 0xAF, 0xDA, 0x97, 0x3A, 0xFF,
+    0xD7, 0x3F, 0xFD, 0xA7, 0x77, 0x77, 0x77, 0x49, 0xA9, 0x77, 0x2A, 0xE9, 0x77, 0x1F, 0xA7, 0x70,
+    0xAF, 0x97, 0x70, 0x9E, 0xA7, 0x72, 0xAA, 0x97, 0x70, 0x79, 0x9A, 0x59, 0xAA, 0x7A, 0xFC, 0x3F,
+    0xC9, 0x49, 0xFD, 0xA2, 0x9F, 0xA4, 0x9A, 0xFD, 0x3F, 0xC7, 0x9F, 0x3A, 0xEA, 0x70, 0xF9, 0x2A,
+    0xEA, 0x70, 0xF9, 0x2F, 0x97, 0x0A, 0xEA, 0x2F, 0x71, 0x9E, 0xA1, 0x9E, 0xA7, 0x2F, 0x1A, 0xE7,
+    0x3F, 0x1E, 0xA7, 0x3F, 0x09, 0xE7, 0x4F, 0x0E, 0xA7, 0x4F, 0x9E, 0x75, 0xAF, 0xD9, 0x75, 0xAF,
+    0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xC7, 0x70, 0xF9, 0x77, 0xAE, 0x97, 0x79, 0xE9, 0x49, 0x92, 0xD9,
+    0x19, 0xAE, 0x94, 0xF0, 0x9F, 0xFC, 0x94, 0xAF, 0x0A, 0xFF, 0x95, 0xFC, 0x1F, 0xDA, 0x7F, 0x92,
+    0xAC, 0xAA, 0x72, 0xAA, 0x20, 0x74, 0x99, 0x77, 0x2A, 0xFC, 0x76, 0x9F, 0xEA, 0x75, 0xE1, 0x9E,
+    0x75, 0xAC, 0xA1, 0x9D, 0xA7, 0x71, 0x9E, 0x77, 0x09, 0xEA, 0x77, 0x1D, 0xA7, 0x73, 0xD9, 0x77,
+    0x39, 0x97, 0x77, 0x71, 0xAF, 0xFC, 0x2F, 0xFA, 0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE, 0x93,
+    0x9F, 0xD9, 0x3F, 0xC6, 0xAE, 0xA5, 0xAF, 0x59, 0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE, 0x97,
+    0x0A, 0xF2, 0x9E, 0xA7, 0x19, 0xF9, 0x1F, 0x73, 0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F, 0xEA,
+    0x76, 0xFE, 0x77, 0x9F, 0xC7, 0x70, 0x9F, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7,
+    0x71, 0xFC, 0x77, 0x09, 0xFA, 0x76, 0x9A, 0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA, 0x71,
+    0x74, 0x9A, 0xDA, 0x97, 0x6F, 0xE7, 0x5A, 0xDA, 0x9E, 0xA7, 0x4D, 0xA1, 0xAD, 0x97, 0x49, 0xA2,
+    0xE7, 0x71, 0xE9, 0x77, 0xF7, 0x71, 0xDA, 0x77, 0x2D, 0x97, 0x77, 0x77, 0x77, 0x19, 0x9A, 0x59,
+    0xAA, 0x7A, 0xFC, 0x3F, 0xC9, 0x49, 0xFD, 0xA2, 0x9F, 0xA4, 0x9A, 0xFD, 0x3F, 0xC7, 0x9F, 0x3A,
+    0xEA, 0x70, 0xF9, 0x2A, 0xEA, 0x70, 0xF9, 0x2F, 0x97, 0x0A, 0xEA, 0x2F, 0x71, 0x9E, 0xA1, 0x9E,
+    0xA7, 0x2F, 0x1A, 0xE7, 0x3F, 0x1E, 0xA7, 0x3F, 0x09, 0xE7, 0x4F, 0x0E, 0xA7, 0x4F, 0x9E, 0x75,
+    0xAF, 0xD9, 0x75, 0xAF, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xC7, 0x70, 0xF9, 0x77, 0xAE, 0x97, 0x79,
+    0xE9, 0x71, 0xD9, 0x19, 0xAE, 0x97, 0x19, 0xFF, 0xC9, 0x72, 0xAF, 0xF9, 0x74, 0xFD, 0xA7, 0x7A,
+    0xCA, 0xA7, 0x70, 0x77, 0x77, 0xAE, 0x29, 0xC9, 0x73, 0xAF, 0xC9, 0x9D, 0xA7, 0x3F, 0xFD, 0x97,
+    0x29, 0xD9, 0x0A, 0xFC, 0x74, 0xAA, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAF, 0xFC, 0x2F,
+    0xFA, 0x0F, 0xFC, 0xA1, 0x9F, 0xFA, 0x0A, 0xFE, 0x93, 0x9F, 0xD9, 0x3F, 0xC6, 0xAE, 0xA5, 0xAF,
+    0x59, 0xF6, 0x9F, 0x94, 0xF7, 0x0F, 0xC3, 0xAE, 0x97, 0x0A, 0xF2, 0x9E, 0xA7, 0x19, 0xF9, 0x1F,
+    0x73, 0xFC, 0x0F, 0x74, 0xAF, 0xAE, 0x97, 0x5F, 0xEA, 0x76, 0xFE, 0x77, 0x9F, 0xC7, 0x70, 0x9F,
+    0xA7, 0x70, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x76, 0x9A,
+    0xFD, 0xA9, 0x73, 0xAF, 0xFD, 0x73, 0xFF, 0xDA, 0x71, 0x72, 0x9D, 0xA2, 0x9A, 0x73, 0xAF, 0xA1,
+    0xDA, 0x72, 0xFD, 0xAE, 0x97, 0x19, 0xD9, 0x0F, 0xD7, 0x3C, 0xA1, 0x9F, 0x77, 0x29, 0x77, 0x77,
+    0x77, 0x70, 0x99, 0xA5, 0x9A, 0xA7, 0xAF, 0xC3, 0xFC, 0x94, 0x9F, 0xDA, 0x29, 0xFA, 0x49, 0xAF,
+    0xD3, 0xFC, 0x79, 0xF3, 0xAE, 0xA7, 0x0F, 0x92, 0xAE, 0xA7, 0x0F, 0x92, 0xF9, 0x70, 0xAE, 0xA2,
+    0xF7, 0x19, 0xEA, 0x19, 0xEA, 0x72, 0xF1, 0xAE, 0x73, 0xF1, 0xEA, 0x73, 0xF0, 0x9E, 0x74, 0xF0,
+    0xEA, 0x74, 0xF9, 0xE7, 0x5A, 0xFD, 0x97, 0x5A, 0xFC, 0xA7, 0x6A, 0xFC, 0x77, 0xFC, 0x77, 0x0F,
+    0x97, 0x7A, 0xE9, 0x77, 0x9E, 0x97, 0x1D, 0x91, 0x9A, 0xE9, 0x71, 0x9F, 0xFC, 0x97, 0x2A, 0xFF,
+    0x97, 0x4F, 0xDA, 0x77, 0xAC, 0xAA, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA1, 0x70, 0xCA, 0x1A, 0xC1, 0x9C, 0xAA, 0xC9, 0x29, 0xD9, 0x3A, 0xD9, 0x2A, 0xF9, 0x1C,
+    0x9A, 0xA9, 0xC3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA7, 0x20, 0x49, 0xC7, 0x2A, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x1F, 0xFD,
+    0x09, 0xC9, 0x99, 0x99, 0x9A, 0xCA, 0x09, 0xC5, 0xCA, 0x19, 0xC4, 0xCA, 0x29, 0xC3, 0xCA, 0x39,
+    0xC2, 0x99, 0x49, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x75, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C,
+    0xA7, 0x9C, 0xA7, 0x0F, 0xFD, 0x1A, 0xCA, 0x99, 0x99, 0x99, 0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4,
+    0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73,
+    0x09, 0x99, 0x99, 0x99, 0x91, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x09, 0x99, 0x99, 0x99, 0x91, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFE, 0x0A,
+    0xFF, 0xFE, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x0F, 0xFF, 0xFA, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xFA, 0x77, 0x00, 0x77, 0x77, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x77, 0x77, 0x00, 0x77, 0x77, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x77, 0x77, 0x00, 0x0A, 0xAA, 0x92, 0xAA, 0xA9, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x09,
+    0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF,
+    0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x1F, 0xFF, 0xFA, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xFA, 0x59, 0x49, 0xDA, 0x29, 0xE3, 0xE9, 0x2F, 0x29, 0xE9, 0x2F, 0x3F, 0x3F,
+    0x92, 0xFA, 0x29, 0xAA, 0x92, 0x39, 0x93, 0x9F, 0x29, 0xF3, 0xF3, 0xF2, 0x9E, 0xA2, 0xAE, 0x3E,
+    0xA2, 0xF2, 0xAE, 0x4C, 0xA4, 0x39, 0x49, 0xEA, 0x2A, 0xF2, 0x9F, 0x3F, 0x29, 0xE9, 0x2F, 0x29,
+    0xE9, 0x2E, 0xA2, 0xAE, 0x39, 0xCA, 0x40, 0x29, 0x49, 0xF2, 0xFC, 0x2F, 0x92, 0xF3, 0xF3, 0x9E,
+    0x93, 0xF4, 0xE9, 0x39, 0xE4, 0x9D, 0x70, 0x59, 0x59, 0x49, 0xDA, 0x29, 0xDA, 0x29, 0xE2, 0xAE,
+    0x3E, 0x91, 0x9E, 0x92, 0xF2, 0xF2, 0x9E, 0x91, 0x9E, 0x92, 0xF2, 0xF3, 0xF2, 0xF3, 0xF9, 0x1F,
+    0x3F, 0xA1, 0xF9, 0x29, 0xAA, 0x92, 0x9A, 0xA9, 0x20, 0x77, 0x1A, 0xDA, 0x2A, 0xDA, 0x2A, 0xF1,
+    0xAF, 0x3F, 0x2F, 0x3F, 0x2F, 0x3E, 0xA1, 0x9E, 0xA2, 0xAE, 0x91, 0xAE, 0x3E, 0xA2, 0xEA, 0x2A,
+    0xE2, 0xAE, 0x29, 0xE2, 0x9E, 0x39, 0xD3, 0xAD, 0x77, 0x30, 0x39, 0x59, 0x39, 0xEA, 0x1A, 0xE9,
+    0x1A, 0xF1, 0xFA, 0x19, 0xF1, 0xAE, 0xA2, 0xF1, 0xAE, 0x91, 0x9E, 0x91, 0xF2, 0xF2, 0xEA, 0x19,
+    0xE9, 0x1A, 0xE2, 0xEA, 0x19, 0xE9, 0x1A, 0xE2, 0xE9, 0x29, 0xCA, 0x3A, 0xC9, 0x30, 0x29, 0x49,
+    0x94, 0x9F, 0x1F, 0xA2, 0xFC, 0x09, 0xFA, 0x2F, 0x90, 0xAF, 0x3F, 0x19, 0xEA, 0x3F, 0x2F, 0x39,
+    0xE9, 0x1F, 0x4F, 0x2E, 0x94, 0xE9, 0x1A, 0xE4, 0x9E, 0x2E, 0xA4, 0x9D, 0x3E, 0x77, 0x77, 0x5F,
+    0x71, 0x9E, 0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0x9D, 0xA5, 0xA9, 0x91, 0xAD, 0x91, 0x99, 0x99,
+    0xFF, 0xFC, 0xA9, 0xFF, 0xFC, 0x9A, 0xDA, 0x99, 0xDA, 0x9A, 0xAD, 0x6D, 0x97, 0x29, 0xD7, 0x3E,
+    0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xF7, 0x2F, 0x72,
+    0x9A, 0xA9, 0x70, 0x77, 0x71, 0xF7, 0x39, 0xEA, 0x73, 0x9E, 0x97, 0x39, 0xE7, 0x49, 0xDA, 0x7A,
+    0x99, 0x1A, 0xD9, 0x19, 0x99, 0x19, 0xFF, 0xFC, 0xA1, 0x9F, 0xFF, 0xC9, 0x1A, 0xDA, 0x99, 0xDA,
+    0x9A, 0xAD, 0x79, 0xDA, 0x74, 0xAD, 0xA7, 0x4E, 0xA7, 0x39, 0xE9, 0x73, 0x9E, 0x74, 0x9D, 0xA7,
+    0xA9, 0x91, 0x9D, 0x29, 0x99, 0x2F, 0xFF, 0xCA, 0x19, 0xFF, 0xFC, 0xA1, 0x9D, 0xAA, 0x9D, 0xA9,
+    0xAA, 0xD7, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x3A, 0xE9, 0x73, 0x9A, 0xA9,
+    0x70, 0x71, 0xFA, 0x1F, 0xD9, 0xAF, 0xDA, 0xAF, 0xDA, 0xAF, 0xD9, 0x9F, 0xCA, 0x19, 0xAC, 0xA9,
+    0x10, 0x0A, 0xA7, 0x1E, 0xA7, 0xFC, 0xA5, 0xFE, 0xA3, 0xFF, 0xCA, 0x1F, 0xFD, 0xA0, 0xFF, 0xD9,
+    0x0F, 0xF9, 0x2F, 0xD9, 0x4F, 0x96, 0xAC, 0x97, 0x73, 0x19, 0xAA, 0x91, 0xAF, 0x90, 0xFC, 0xA0,
+    0xFC, 0xA0, 0xAF, 0x91, 0x99, 0x91, 0x19, 0xAA, 0x49, 0xAA, 0x2F, 0xA2, 0xAF, 0x09, 0xFA, 0x2F,
+    0xC0, 0x9F, 0xA1, 0x9F, 0xC0, 0x9F, 0x3F, 0x29, 0x99, 0x59, 0x92, 0x19, 0xAA, 0x79, 0xAA, 0x79,
+    0xAA, 0x2A, 0xF5, 0xAF, 0x5A, 0xF1, 0xFC, 0x5F, 0xC5, 0xFC, 0x1F, 0xC5, 0xFC, 0x5F, 0xC1, 0xF6,
+    0xF6, 0xF3, 0x99, 0x70, 0x99, 0x70, 0x99, 0x20, 0x19, 0xAA, 0x91, 0xAF, 0x90, 0xFC, 0xA0, 0xFC,
+    0xA0, 0xAF, 0x29, 0x99, 0x10, 0x49, 0xC7, 0x2A, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x1C, 0xA1,
+    0x9F, 0xC0, 0x9C, 0x92, 0x99, 0xAC, 0xA0, 0x9C, 0x5C, 0xA1, 0x9C, 0x4C, 0xA2, 0x9C, 0x3C, 0xA3,
+    0x9C, 0x29, 0x94, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C,
+    0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C,
+    0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x77, 0x50, 0x4C, 0xA7, 0x0C, 0xA7,
+    0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xC9, 0x19, 0xC1, 0xAC, 0xA9, 0x93, 0xC9, 0x1A, 0xC5, 0xC9, 0x2A,
+    0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9,
+    0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9,
+    0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9,
+    0x73, 0x39, 0x96, 0x9D, 0x94, 0x9F, 0x4C, 0xAA, 0xA9, 0xC2, 0xCA, 0x0A, 0xA0, 0xAC, 0x0A, 0xA1,
+    0xAA, 0x1A, 0xA9, 0x2A, 0xA2, 0x93, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x75, 0x3A, 0xA1, 0xC9, 0x70, 0xD0, 0x9C, 0xA7,
+    0x0D, 0x1C, 0xA7, 0x0D, 0x1C, 0xA0, 0xAF, 0xFC, 0x1C, 0xAA, 0xC9, 0x99, 0x99, 0xAC, 0x90, 0xAC,
+    0x0A, 0xA3, 0x9C, 0x90, 0xAC, 0x1A, 0xA2, 0x9C, 0x90, 0xAC, 0x2A, 0xA1, 0x9C, 0x90, 0xAC, 0x3A,
+    0xA1, 0x92, 0x94, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x77, 0x71, 0x39, 0xC1, 0xAA, 0x6A,
+    0xC9, 0x0D, 0x6A, 0xC9, 0x0D, 0x6A, 0xC1, 0xD6, 0xAC, 0x1F, 0xFC, 0xA0, 0xCA, 0x09, 0xCA, 0x99,
+    0x99, 0x9C, 0xA1, 0xCA, 0x09, 0xC9, 0x3A, 0xA2, 0xCA, 0x09, 0xC9, 0x2A, 0xA3, 0xCA, 0x09, 0xC9,
+    0x1A, 0xA4, 0x92, 0x91, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x75, 0x77, 0x77,
+    0x77, 0x77, 0x1C, 0xA7, 0x77, 0x1A, 0xE9, 0x71, 0xAE, 0x77, 0x6A, 0xFE, 0x70, 0xF7, 0x75, 0xAF,
+    0xFA, 0x6F, 0x77, 0x5A, 0xE9, 0x1F, 0x5A, 0xE9, 0x77, 0x5E, 0xA2, 0xAE, 0x49, 0xEA, 0x77, 0x5A,
+    0xE3, 0xAE, 0x4E, 0xA7, 0x76, 0xF3, 0xF3, 0xAE, 0x77, 0x7E, 0xA3, 0xF2, 0x9E, 0x97, 0x77, 0xEA,
+    0x3E, 0xA2, 0xE9, 0x77, 0x79, 0xEA, 0x2A, 0xE2, 0xAD, 0xA5, 0x97, 0x49, 0x4E, 0xA2, 0xEA, 0x19,
+    0xE2, 0x9F, 0xCA, 0x69, 0xFC, 0xA2, 0xFA, 0xAF, 0x2E, 0x2A, 0xFF, 0x4A, 0xFF, 0x19, 0xFF, 0x2E,
+    0x91, 0xAE, 0xA9, 0xF9, 0x2A, 0xEA, 0x9F, 0x91, 0x9F, 0xC9, 0x2A, 0xDA, 0x19, 0xEA, 0x19, 0xEA,
+    0x19, 0xEA, 0x2E, 0xA7, 0x29, 0xE2, 0xF3, 0xEA, 0x1F, 0x3E, 0xA7, 0x2E, 0x92, 0xEA, 0x3E, 0xA1,
+    0xEA, 0x3E, 0xA7, 0x1E, 0xA2, 0x9E, 0x92, 0x9E, 0xA0, 0x9E, 0x93, 0xEA, 0x70, 0xAE, 0x3A, 0xE3,
+    0x9E, 0x90, 0xAE, 0x39, 0xE9, 0x79, 0xE9, 0x3A, 0xE3, 0xF1, 0xAE, 0x3F, 0x70, 0xEA, 0x4A, 0xE2,
+    0x9E, 0xA1, 0xAE, 0x29, 0xEA, 0x7F, 0x5A, 0xE9, 0x1F, 0x2A, 0xE9, 0x1F, 0x7A, 0xE9, 0x6F, 0xFC,
+    0x4F, 0xFC, 0x79, 0xEA, 0x79, 0xFD, 0xA5, 0x9F, 0xE7, 0x09, 0xE7, 0x2A, 0xAA, 0xA7, 0x1A, 0xAA,
+    0xA7, 0x4C, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xA5, 0xE9, 0x29, 0xEA, 0x2F, 0x91, 0x9F, 0x2A,
+    0xEA, 0x2F, 0x2A, 0xE9, 0x2E, 0xA3, 0xE5, 0xA4, 0x3A, 0xA4, 0xA9, 0x5E, 0x91, 0xAD, 0xA3, 0x9E,
+    0xA1, 0xF3, 0xF9, 0x09, 0xF2, 0x9F, 0x1F, 0xA2, 0xAE, 0xA0, 0x9F, 0x3F, 0x1A, 0xE9, 0x2A, 0xE9,
+    0x1F, 0x3E, 0xA1, 0x9E, 0x4E, 0x29, 0xD9, 0x5A, 0x49, 0xA4, 0x3A, 0xA4, 0x9A, 0x5A, 0x95, 0xE9,
+    0x2E, 0x92, 0xAD, 0xA3, 0x9E, 0xA1, 0x9F, 0x2F, 0x3F, 0x91, 0xAE, 0xA1, 0x9F, 0x29, 0xF2, 0xF9,
+    0x1F, 0x92, 0xAE, 0xA1, 0xAF, 0x19, 0xF3, 0xF2, 0xF2, 0xAE, 0x92, 0xAE, 0x91, 0x9E, 0xA2, 0xF3,
+    0xEA, 0x2A, 0xE2, 0xAE, 0x4E, 0x3A, 0xD3, 0x9D, 0x95, 0xA5, 0x99, 0x49, 0x94, 0x19, 0xA4, 0xE9,
+    0x29, 0xF3, 0xF9, 0x2A, 0xEA, 0x3F, 0x3A, 0xEA, 0x3F, 0x39, 0xE9, 0x3A, 0xD9, 0x4A, 0x90, 0x19,
+    0xA4, 0x9A, 0x4E, 0x92, 0xAD, 0xA2, 0x9F, 0x2F, 0x3F, 0x91, 0xF9, 0x2A, 0xEA, 0x19, 0xF3, 0xF2,
+    0xF9, 0x2A, 0xEA, 0x19, 0xEA, 0x3F, 0x2F, 0x39, 0xE9, 0x2E, 0xA3, 0xAD, 0x92, 0x9D, 0x94, 0xA9,
+    0x49, 0x90, 0x19, 0xA4, 0x9A, 0x5A, 0x93, 0xE9, 0x2A, 0xDA, 0x29, 0xE2, 0x9F, 0x2F, 0x2F, 0x3F,
+    0x91, 0xF9, 0x1A, 0xEA, 0x2A, 0xEA, 0x19, 0xF1, 0x9F, 0x3F, 0x2F, 0x91, 0xF9, 0x2A, 0xEA, 0x19,
+    0xEA, 0x2F, 0x3F, 0x2F, 0x2A, 0xE9, 0x29, 0xE9, 0x2E, 0xA2, 0xEA, 0x3A, 0xD9, 0x29, 0xD9, 0x3D,
+    0xA4, 0xA9, 0x49, 0x94, 0x99, 0x00, 0x59, 0xA7, 0x29, 0xDA, 0x70, 0x9F, 0xA6, 0x9F, 0xDA, 0x49,
+    0xEA, 0x0E, 0xA2, 0x9E, 0xA2, 0xEA, 0x1A, 0xDA, 0x4E, 0x90, 0x6A, 0x95, 0x9E, 0x93, 0xAF, 0x3F,
+    0xC2, 0x9F, 0xA2, 0x9F, 0xA3, 0xAF, 0x4A, 0xF9, 0x4F, 0xC5, 0xF9, 0x49, 0xF6, 0xEA, 0x6A, 0xA2,
+    0x3A, 0x97, 0xF6, 0x9F, 0x6F, 0xC6, 0xFA, 0x5A, 0xF9, 0x5F, 0x94, 0xFC, 0x4F, 0xC4, 0xFA, 0x4F,
+    0xA4, 0xF9, 0x6A, 0xA6, 0x77, 0x5C, 0xA7, 0x59, 0xCA, 0x0A, 0xDA, 0x4D, 0xA4, 0xE1, 0xAD, 0xA2,
+    0xAE, 0x3E, 0x3A, 0xDA, 0x1A, 0xE2, 0xE9, 0x4E, 0x91, 0xD9, 0x1E, 0x96, 0xE9, 0x4E, 0x97, 0x0E,
+    0x92, 0xAD, 0x97, 0x2E, 0x90, 0xAD, 0xA7, 0x9A, 0x2E, 0xAD, 0xA1, 0x9A, 0x3A, 0xE1, 0x9F, 0xA1,
+    0x9E, 0x2F, 0x2A, 0xE2, 0xAE, 0x91, 0x9E, 0x19, 0xFC, 0x19, 0xE3, 0x99, 0x19, 0xE9, 0xE2, 0x97,
+    0x9E, 0x19, 0xDA, 0x72, 0xE3, 0xAD, 0xA7, 0x0E, 0x5A, 0xDA, 0x6E, 0x91, 0xDA, 0x1A, 0xDA, 0x4E,
+    0x91, 0xAE, 0x2E, 0x92, 0xE9, 0x2A, 0xE3, 0xE9, 0x0A, 0xD9, 0x4A, 0xC9, 0x4E, 0x1A, 0xA7, 0x6C,
+    0x97, 0x75, 0x59, 0xAA, 0xA4, 0x9A, 0xAA, 0x5A, 0xF3, 0xAF, 0x49, 0xF9, 0x29, 0xF9, 0x4F, 0xC3,
+    0xFC, 0x5F, 0xA3, 0xFA, 0x49, 0xF9, 0x29, 0xF9, 0x49, 0xF3, 0x9F, 0x5A, 0xEA, 0x3A, 0xF5, 0xF9,
+    0x3F, 0x95, 0xF4, 0xF6, 0xF4, 0xF6, 0xEA, 0x4E, 0xA5, 0x9E, 0x93, 0x9E, 0x95, 0x9E, 0x49, 0xE6,
+    0xAE, 0x4A, 0xE6, 0xAD, 0xA4, 0xAD, 0xA6, 0xAD, 0x94, 0xAD, 0x96, 0xE5, 0xE7, 0xA9, 0x6A, 0x97,
+    0x77, 0x49, 0x99, 0x59, 0x99, 0x6A, 0xE9, 0x3A, 0xE9, 0x5F, 0xA3, 0xFA, 0x49, 0xF9, 0x29, 0xF9,
+    0x5E, 0xA4, 0xF6, 0x99, 0x95, 0x99, 0x96, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F,
+    0xFF, 0xFA, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x09, 0x99, 0x99,
+    0x19, 0xFD, 0x9A, 0xFD, 0xAA, 0xFD, 0x90, 0x99, 0x99, 0x99, 0x00, 0x77, 0x77, 0x59, 0xC9, 0x77,
+    0x1E, 0xA7, 0x7A, 0xE9, 0x76, 0x9E, 0xA7, 0x7F, 0x77, 0xF7, 0x79, 0xE9, 0x77, 0xEA, 0x77, 0xEA,
+    0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0xA7,
+    0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xF7, 0x7A, 0xE7, 0x79, 0xE9, 0x77, 0xF7, 0x7F, 0x77,
+    0x0E, 0x97, 0x71, 0x9A, 0x77, 0x77, 0x50, 0x2A, 0xEA, 0x95, 0x9A, 0xE9, 0x4F, 0xEA, 0x3A, 0xFE,
+    0x2A, 0xFF, 0x92, 0xFF, 0xC1, 0xAF, 0xFC, 0x19, 0xFF, 0xC1, 0xAD, 0x99, 0x9F, 0x2D, 0xA9, 0x9F,
+    0x91, 0x93, 0xAE, 0x29, 0x4E, 0xA6, 0xAE, 0x70, 0xE9, 0x6E, 0xA7, 0xAE, 0x6F, 0x79, 0xE9, 0x5F,
+    0x79, 0xEA, 0x5F, 0x7A, 0xEA, 0x5F, 0x7A, 0xE9, 0x5F, 0x7A, 0xE9, 0x5A, 0xDA, 0x70, 0xE9, 0x6E,
+    0xA9, 0x99, 0x4A, 0xE9, 0x99, 0x4F, 0xDA, 0x4A, 0xFD, 0x4A, 0xFC, 0x6F, 0xC9, 0x59, 0xAA, 0x97,
+    0x0A, 0xA9, 0x77, 0x77, 0x99, 0x97, 0x19, 0x97, 0xAE, 0x97, 0xF6, 0xFA, 0x6A, 0xF5, 0x9F, 0x96,
+    0xFC, 0x6F, 0x7A, 0xE9, 0x79, 0x97, 0x19, 0x97, 0x77, 0x09, 0xAA, 0xA3, 0xAE, 0xA9, 0x6F, 0xC2,
+    0xFE, 0xA4, 0x9F, 0x91, 0xAF, 0xF9, 0x3F, 0xC2, 0xAF, 0xFC, 0x3F, 0xA2, 0xAD, 0x99, 0x9F, 0x29,
+    0xF9, 0x39, 0x3A, 0xE2, 0xAF, 0x71, 0xAE, 0x2A, 0xEA, 0x71, 0xEA, 0x2F, 0x97, 0x0F, 0x3F, 0x70,
+    0xF4, 0xF7, 0xF4, 0x9E, 0xA6, 0xF5, 0x9E, 0x95, 0xF6, 0x9E, 0x5A, 0xDA, 0x7A, 0xE5, 0xEA, 0x99,
+    0x94, 0xAD, 0xA5, 0xFD, 0xA4, 0xE9, 0x5A, 0xFC, 0x5E, 0x79, 0xAA, 0x96, 0xA9, 0x77, 0x76, 0x99,
+    0x97, 0x99, 0x96, 0xAE, 0x95, 0xAE, 0x95, 0xFA, 0x49, 0xFA, 0x49, 0xF9, 0x49, 0xF9, 0x5F, 0x6E,
+    0xA7, 0x99, 0x79, 0x99, 0x60, 0x59, 0xAA, 0xA7, 0x70, 0xAF, 0x29, 0xAE, 0xA6, 0x9F, 0x91, 0x9F,
+    0xE5, 0xFC, 0x2F, 0xFC, 0x4F, 0xA2, 0xFF, 0xC9, 0x29, 0xF9, 0x2D, 0xA9, 0x9A, 0xEA, 0x29, 0xF3,
+    0x94, 0xEA, 0x2A, 0xEA, 0x71, 0xEA, 0x2F, 0x97, 0x09, 0xE3, 0xF7, 0x09, 0xEA, 0x3F, 0x79, 0xEA,
+    0x4E, 0xA6, 0x9E, 0xA4, 0x9E, 0x95, 0x9E, 0xA5, 0x9E, 0x59, 0xE9, 0x6A, 0xE5, 0xE9, 0x7A, 0xDA,
+    0x49, 0xEA, 0x99, 0x5A, 0xD9, 0x49, 0xFD, 0x5E, 0x6F, 0xCA, 0x5A, 0x97, 0x09, 0xAA, 0x77, 0x75,
+    0x99, 0x97, 0x99, 0x7A, 0xE9, 0x5F, 0x6F, 0xA4, 0xAF, 0x59, 0xF9, 0x4A, 0xF6, 0xEA, 0x5A, 0xE9,
+    0x69, 0x99, 0x79, 0x97, 0x77, 0x69, 0xFC, 0xA9, 0x5D, 0x2A, 0xFF, 0xC9, 0x2F, 0x09, 0xFF, 0xFF,
+    0xC9, 0x0E, 0xA2, 0x9F, 0xFC, 0xA2, 0xCA, 0x6A, 0xFC, 0x97, 0x75, 0x3A, 0xA4, 0x9A, 0x5A, 0x94,
+    0xA9, 0x5E, 0x92, 0xE9, 0x2A, 0xDA, 0x29, 0xE3, 0x9E, 0xA1, 0x9F, 0x2F, 0x2F, 0x92, 0xF9, 0x1A,
+    0xEA, 0x19, 0xF1, 0x9F, 0x29, 0xF2, 0xF9, 0x1F, 0x91, 0xAE, 0xA2, 0xAE, 0xA1, 0xAF, 0x19, 0xF2,
+    0xF3, 0xF2, 0xF2, 0xAE, 0x91, 0xAE, 0xA2, 0xAE, 0x91, 0x9E, 0xA2, 0xF2, 0xF3, 0xEA, 0x2A, 0xE2,
+    0xAE, 0x29, 0xE9, 0x3E, 0x3A, 0xD3, 0x9D, 0x92, 0x9D, 0xA5, 0xA5, 0x99, 0x49, 0x94, 0x9A, 0x40,
+    0x77, 0x3A, 0xFA, 0x59, 0xFF, 0x39, 0xFA, 0xF9, 0x2E, 0xA2, 0xEA, 0x1F, 0x3F, 0x1E, 0xA3, 0xF0,
+    0xAE, 0x93, 0xEA, 0x0F, 0x4E, 0xA0, 0xF3, 0xAE, 0x90, 0xEA, 0x3F, 0x1E, 0xA2, 0x9E, 0x91, 0xF2,
+    0xF2, 0xAF, 0xAF, 0x4F, 0xF6, 0xAF, 0x97, 0x72, 0x77, 0x7E, 0x71, 0xF7, 0x0F, 0xC7, 0xFC, 0xA6,
+    0xEA, 0xD9, 0x5E, 0x0E, 0x5E, 0x1E, 0x4E, 0x19, 0xE3, 0xE9, 0x1A, 0xDA, 0x2F, 0xFF, 0xA0, 0xFF,
+    0xFA, 0x0A, 0xAF, 0xFD, 0x79, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x30, 0x39, 0xFE, 0xA3, 0xFF, 0xA3,
+    0xFF, 0x39, 0xDA, 0x70, 0xE9, 0x70, 0xFC, 0xA5, 0x9F, 0xE7, 0x9A, 0xEA, 0x70, 0xF7, 0x0A, 0xE7,
+    0x0E, 0xA7, 0xF2, 0x99, 0x99, 0xFC, 0x92, 0xFF, 0x93, 0xAF, 0xC9, 0x77, 0x20, 0x77, 0x49, 0xAF,
+    0x59, 0xFE, 0x93, 0xAF, 0xA9, 0x5A, 0xEA, 0x7A, 0xE9, 0x70, 0xFA, 0xAA, 0x5A, 0xFF, 0xA3, 0xEA,
+    0xAA, 0xF9, 0x19, 0xE3, 0xEA, 0x19, 0xE3, 0xAD, 0xA1, 0x9E, 0x3A, 0xDA, 0x19, 0xE3, 0xE9, 0x2E,
+    0xA9, 0x9F, 0x39, 0xFF, 0x59, 0xFC, 0xA7, 0x72, 0x1A, 0xFE, 0xAA, 0x19, 0xFF, 0xD9, 0x0F, 0xFE,
+    0x1D, 0xA2, 0x9E, 0x91, 0xD9, 0x2E, 0xA3, 0x92, 0xEA, 0x7A, 0xE7, 0x9E, 0x97, 0xEA, 0x7F, 0x79,
+    0xE9, 0x7F, 0x7A, 0xE9, 0x7A, 0xE7, 0x09, 0xD9, 0x77, 0x40, 0x77, 0x1A, 0xFA, 0x49, 0xFF, 0x29,
+    0xE9, 0x09, 0xE9, 0x1A, 0xDA, 0x2E, 0x91, 0xEA, 0x19, 0xE2, 0x9E, 0x99, 0xE9, 0x3A, 0xFD, 0x94,
+    0xAF, 0xCA, 0x39, 0xE9, 0xAE, 0xA2, 0xE2, 0xAE, 0x1A, 0xDA, 0x3E, 0x90, 0xAD, 0xA2, 0x9E, 0x1A,
+    0xE9, 0x09, 0xEA, 0x2F, 0xFA, 0x4A, 0xFA, 0x97, 0x70, 0x77, 0x2A, 0xFC, 0x95, 0xFF, 0x93, 0xF9,
+    0x9F, 0x29, 0xE3, 0xE9, 0x1A, 0xE3, 0xE9, 0x1A, 0xDA, 0x3E, 0x91, 0xAE, 0x3E, 0x91, 0x9F, 0xAA,
+    0xF3, 0xAF, 0xFA, 0x49, 0xAA, 0xAF, 0x70, 0x9E, 0xA7, 0xAE, 0xA4, 0x9A, 0xFC, 0xA3, 0x9F, 0xE9,
+    0x5F, 0xA9, 0x77, 0x40, 0x75, 0xAE, 0x90, 0x9E, 0x90, 0x9F, 0xAA, 0xFC, 0x29, 0xDA, 0xCA, 0xAE,
+    0x2A, 0xEA, 0x09, 0xDA, 0x2F, 0x1A, 0xD9, 0x2E, 0x91, 0xE2, 0x9E, 0x2D, 0xA2, 0xAD, 0xA1, 0x9D,
+    0x90, 0x90, 0xE9, 0x1A, 0xDA, 0xD0, 0xE2, 0xFC, 0x99, 0xDA, 0x2A, 0xE7, 0x60, 0x69, 0x9A, 0x97,
+    0xAF, 0xD9, 0x4F, 0xFC, 0x3F, 0x90, 0xAE, 0xA1, 0x9E, 0x92, 0xF1, 0xF3, 0xF0, 0x9E, 0x93, 0xF0,
+    0xAE, 0x4E, 0xA0, 0xF3, 0x9E, 0x90, 0xEA, 0x3A, 0xE1, 0xEA, 0x3F, 0x1F, 0x2A, 0xE9, 0x1F, 0x90,
+    0x9E, 0xA2, 0xAF, 0xFA, 0x4A, 0xFD, 0xA6, 0x9A, 0xAA, 0x95, 0x69, 0xA5, 0x9A, 0xF2, 0x9F, 0xDA,
+    0x3F, 0xD9, 0x59, 0xE9, 0x59, 0xE6, 0xAE, 0x6E, 0xA6, 0xE9, 0x59, 0xE6, 0xAE, 0x6A, 0xE6, 0xEA,
+    0x39, 0xFE, 0xA1, 0xFF, 0xA1, 0x99, 0x99, 0x99, 0x99, 0x10, 0x69, 0xA9, 0x97, 0xFE, 0x5F, 0xFC,
+    0x3F, 0x90, 0xAE, 0x92, 0xDA, 0x3E, 0x92, 0x9C, 0x3A, 0xE7, 0x1E, 0xA7, 0x0E, 0xA7, 0x9E, 0xA7,
+    0x9E, 0xA7, 0xAE, 0x97, 0xEA, 0x79, 0xF9, 0x99, 0x99, 0x92, 0xFF, 0xE9, 0x1F, 0xFE, 0x39, 0x99,
+    0x99, 0x99, 0x93, 0x59, 0xA9, 0x95, 0xAF, 0xD3, 0xFF, 0xA1, 0x9D, 0xA1, 0xAE, 0x2C, 0xA2, 0x9E,
+    0x7E, 0x95, 0x9E, 0xA3, 0x9F, 0xCA, 0x49, 0xFD, 0xA4, 0x91, 0xAE, 0x79, 0xE7, 0xAE, 0x59, 0xF9,
+    0x09, 0xAA, 0xFD, 0x91, 0xAF, 0xE9, 0x3A, 0xAA, 0xA9, 0x50, 0x72, 0x99, 0x71, 0xAE, 0x70, 0xAF,
+    0x7A, 0xFC, 0x6A, 0xFC, 0xA5, 0x9D, 0xAA, 0xD9, 0x49, 0xDA, 0x0E, 0x49, 0xDA, 0x1E, 0x39, 0xDA,
+    0x19, 0xDA, 0x29, 0xE2, 0xAD, 0xA2, 0xFF, 0xFA, 0x0F, 0xFF, 0x91, 0x99, 0x99, 0x9A, 0xE9, 0x97,
+    0xAD, 0xA7, 0x1E, 0x97, 0x19, 0x99, 0x30, 0x77, 0x0A, 0xFE, 0xA3, 0xFF, 0x92, 0x9E, 0x99, 0x99,
+    0x93, 0xAD, 0x97, 0x0E, 0xA9, 0x7F, 0xD9, 0x5A, 0xAF, 0xC9, 0x79, 0xF7, 0x0A, 0xE7, 0x0F, 0x79,
+    0xE9, 0x6A, 0xF2, 0xAA, 0xFE, 0x3F, 0xEA, 0x5A, 0xAA, 0xA9, 0x60, 0x70, 0x99, 0xA9, 0x69, 0xFD,
+    0x5F, 0xEA, 0x4F, 0xA9, 0x6F, 0x70, 0xF7, 0x09, 0xFE, 0xA4, 0xFF, 0xD3, 0xE9, 0x1A, 0xE9, 0x19,
+    0xE3, 0xEA, 0x19, 0xE3, 0xAD, 0xA1, 0x9E, 0x3E, 0xA1, 0x9E, 0x91, 0x9E, 0x3F, 0xAF, 0xA4, 0xFE,
+    0xA6, 0x9A, 0xAA, 0x95, 0x76, 0xFF, 0xD9, 0x0A, 0xFF, 0xD9, 0x0E, 0x99, 0x99, 0xF1, 0xDA, 0x2A,
+    0xE2, 0xAC, 0x29, 0xE7, 0x0E, 0x97, 0xEA, 0x7A, 0xE7, 0x9E, 0x97, 0xEA, 0x7A, 0xE7, 0x0E, 0xA7,
+    0xAE, 0x70, 0xAD, 0xA7, 0x1A, 0xC9, 0x70, 0x59, 0xAA, 0x96, 0xAF, 0xD9, 0x3F, 0xAF, 0x91, 0xAE,
+    0x2E, 0xA1, 0xEA, 0x2E, 0x91, 0xAE, 0x1A, 0xE3, 0xFA, 0xE4, 0x9F, 0xCA, 0x4A, 0xFE, 0x3A, 0xDA,
+    0x1F, 0x19, 0xE2, 0x9E, 0x90, 0xAD, 0xA3, 0xE9, 0x0A, 0xE2, 0xAE, 0x19, 0xFA, 0xF9, 0x2A, 0xFE,
+    0x95, 0x9A, 0xA9, 0x94, 0x59, 0x9A, 0x97, 0x9F, 0xDA, 0x49, 0xFF, 0xA3, 0xEA, 0x19, 0xE2, 0x9E,
+    0x3E, 0x91, 0xAE, 0x3E, 0x91, 0xAE, 0x3E, 0x91, 0x9E, 0x91, 0x9E, 0x3F, 0xFD, 0x4F, 0xF9, 0x69,
+    0x9F, 0x70, 0xAE, 0x7A, 0xF9, 0x3A, 0xAF, 0xD5, 0xFD, 0x96, 0x9A, 0xA9, 0x70, 0x59, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFF, 0xEA, 0x4A, 0xFF, 0xFE, 0xA6, 0x9F, 0xCA, 0xAA,
+    0xAF, 0x96, 0x9F, 0xA4, 0xE7, 0x9F, 0x94, 0xE7, 0xAF, 0x5D, 0x97, 0xFC, 0x77, 0x0F, 0xA7, 0x79,
+    0xF9, 0x77, 0xAF, 0xFE, 0x71, 0xFF, 0xF7, 0x1F, 0xFE, 0x97, 0x1F, 0xA7, 0x79, 0xF9, 0x75, 0xAA,
+    0xFC, 0xA9, 0xA9, 0x72, 0xFF, 0xDA, 0x71, 0x9A, 0xFD, 0xAA, 0xA9, 0x73, 0x9F, 0xA7, 0x79, 0xF9,
+    0x75, 0x9A, 0xFE, 0xA7, 0x2A, 0xFF, 0xD9, 0x71, 0xFF, 0xE7, 0x10, 0x74, 0x9A, 0xEA, 0x97, 0x5F,
+    0xF9, 0x73, 0xFF, 0xD7, 0x2F, 0xA9, 0x9F, 0x97, 0x0A, 0xEA, 0x2A, 0xE9, 0x79, 0xF3, 0x9E, 0x70,
+    0xF9, 0x3A, 0xD7, 0x09, 0xF7, 0x70, 0xAE, 0xA7, 0x5F, 0xFA, 0xF9, 0x69, 0xFF, 0xFC, 0x79, 0xAA,
+    0xFC, 0xAA, 0xAA, 0xA9, 0x72, 0xFA, 0x75, 0xDA, 0xFC, 0xAA, 0xE7, 0x9F, 0xFF, 0xA7, 0xAA, 0xAF,
+    0xCA, 0xAA, 0xAA, 0x97, 0x2F, 0x97, 0x70, 0xF7, 0x70, 0x9E, 0xA7, 0x5D, 0xAF, 0xA9, 0x99, 0x9A,
+    0xAA, 0xE9, 0x19, 0xFF, 0xFF, 0xD2, 0x9F, 0xFF, 0xFD, 0x29, 0xFA, 0x29, 0xAF, 0xE4, 0xAA, 0x97,
+    0x71, 0x69, 0xAA, 0xAE, 0xAA, 0x97, 0x77, 0x59, 0xFF, 0xFC, 0x97, 0x77, 0x29, 0xFF, 0xFE, 0x97,
+    0x77, 0x19, 0xDA, 0xFC, 0x9A, 0xFD, 0x77, 0x75, 0xFA, 0x2F, 0xCA, 0x77, 0x73, 0x9F, 0x92, 0x9F,
+    0xA7, 0x77, 0x3A, 0xF4, 0xFC, 0x3E, 0x77, 0x4F, 0xC4, 0xFA, 0x2F, 0x77, 0x4F, 0xA3, 0x9F, 0x92,
+    0xF7, 0x74, 0xFA, 0x3F, 0xC2, 0xAF, 0xAA, 0xA4, 0x9F, 0xA5, 0x9F, 0x92, 0xAF, 0xA0, 0xFF, 0xD2,
+    0x9F, 0xE9, 0x4A, 0xF1, 0x9F, 0xCA, 0x09, 0xFF, 0xCA, 0x2E, 0xA9, 0xAD, 0x5F, 0xFF, 0xA4, 0xF5,
+    0xAE, 0x3A, 0x5F, 0xFE, 0x94, 0x9F, 0x5A, 0xEA, 0x70, 0x9F, 0xEA, 0xA7, 0xAE, 0xA5, 0x9F, 0xA7,
+    0x9F, 0x74, 0xF9, 0x6A, 0xFC, 0x6A, 0xF7, 0x4F, 0x70, 0xAF, 0xC5, 0xFC, 0x74, 0xF7, 0x1A, 0xF9,
+    0x4F, 0xA7, 0x39, 0xF2, 0xA1, 0xA9, 0x2A, 0xEA, 0x39, 0xF9, 0x73, 0xAF, 0x09, 0xD0, 0xAD, 0x29,
+    0xEA, 0x2A, 0xFE, 0xA7, 0x1A, 0xFF, 0x0F, 0xA9, 0xF1, 0x9F, 0xFD, 0x97, 0x09, 0xFE, 0x90, 0x9F,
+    0xF9, 0x1A, 0xFF, 0xD7, 0x2F, 0xCA, 0x39, 0xFC, 0xA7, 0x77, 0x39, 0x71, 0x96, 0x74, 0x9A, 0xFA,
+    0x97, 0x49, 0xFF, 0xD9, 0x71, 0xFF, 0xF9, 0x79, 0xFD, 0xAA, 0xAA, 0xE7, 0x0F, 0xC9, 0x39, 0xE7,
+    0xFC, 0x59, 0xDA, 0x6A, 0xF6, 0x9C, 0xA7, 0xF7, 0x79, 0x9A, 0xF9, 0x99, 0xAA, 0xAA, 0x70, 0xFF,
+    0xFD, 0x7A, 0xFF, 0xFC, 0x97, 0x19, 0xF7, 0x79, 0x9A, 0xF9, 0x99, 0x99, 0x99, 0x7A, 0xFF, 0xFC,
+    0xA7, 0xFF, 0xFD, 0x73, 0xAF, 0x77, 0x1A, 0xF9, 0x77, 0x09, 0xFA, 0x77, 0x1F, 0xCA, 0x69, 0xC7,
+    0xAF, 0xDA, 0x99, 0x9A, 0xE9, 0x7F, 0xFF, 0xD7, 0x1F, 0xFF, 0x73, 0x9F, 0xEA, 0x97, 0x70, 0x99,
+    0x70, 0x59, 0x77, 0x29, 0xD7, 0x70, 0x9F, 0x76, 0x9F, 0x97, 0x59, 0xEA, 0x76, 0x9E, 0xA7, 0x99,
+    0x99, 0x99, 0x1F, 0xFF, 0xFE, 0xAA, 0xFF, 0xFF, 0xEA, 0x9F, 0xFF, 0xFE, 0xA0, 0x9E, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9E, 0xA7, 0x70, 0x9F, 0x77, 0x0A, 0xF7, 0x70, 0xAD, 0x77,
+    0x2A, 0x75, 0x5A, 0xC9, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xAF, 0xEA, 0x4A, 0xFF, 0xCA, 0x2A,
+    0xE9, 0xE9, 0xEA, 0x0A, 0xE9, 0x0E, 0x09, 0xEA, 0x0D, 0xA1, 0xE1, 0xAD, 0x2A, 0x19, 0xE2, 0xA6,
+    0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97,
+    0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x40, 0x75, 0x97, 0x72,
+    0xD9, 0x77, 0x0F, 0x97, 0x79, 0xF9, 0x77, 0x0A, 0xE9, 0x29, 0x99, 0x99, 0x97, 0xAE, 0x90, 0xAF,
+    0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xEA, 0xAF, 0xFF, 0xFE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xAE, 0x97, 0x6A, 0xE9, 0x76, 0xF9, 0x76, 0xF9, 0x77, 0x0D, 0xA7, 0x72, 0xA5, 0x49, 0xE9,
+    0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71,
+    0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE7, 0x29, 0xE7, 0xA1, 0x9E, 0x2A, 0x2A, 0xCA,
+    0x1E, 0x1A, 0xCA, 0x0A, 0xE9, 0x0E, 0x09, 0xEA, 0x0F, 0x9E, 0x9F, 0x2F, 0xFE, 0x4F, 0xFC, 0x6F,
+    0xDA, 0x70, 0xAE, 0xA7, 0x2A, 0xCA, 0x50, 0x77, 0x71, 0xAC, 0x6C, 0xA7, 0x0A, 0xE4, 0xEA, 0x6A,
+    0xF4, 0xFA, 0x4A, 0xEA, 0x6A, 0xEA, 0x2A, 0xE9, 0x70, 0x9E, 0x90, 0x9F, 0xFF, 0xFE, 0x9F, 0xFF,
+    0xFF, 0xCA, 0xFF, 0xFF, 0xEA, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xEA, 0x2A, 0xE9, 0x69,
+    0xEA, 0x4A, 0xEA, 0x4A, 0xEA, 0x6F, 0x4E, 0xA7, 0x0D, 0x6D, 0x77, 0x71, 0x77, 0x4E, 0x72, 0xFC,
+    0x70, 0xFE, 0x6F, 0xFC, 0x4F, 0xFE, 0x2F, 0x9E, 0x0F, 0x1A, 0xD1, 0xE0, 0x9D, 0xA2, 0xA9, 0x1E,
+    0x1A, 0xA7, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0xA9, 0x1E, 0x19, 0xA2, 0xAD, 0x1E, 0x1D,
+    0xA1, 0xF0, 0xE0, 0xF1, 0x9E, 0xAE, 0xAE, 0x4F, 0xFC, 0x6F, 0xE7, 0x0F, 0xC7, 0x2E, 0x74, 0x96,
+    0x59, 0xA9, 0x72, 0x9E, 0x97, 0x0A, 0xFC, 0xA6, 0xAF, 0xEA, 0x4A, 0xFF, 0xCA, 0x2F, 0x9E, 0x9F,
+    0x1E, 0x90, 0xE0, 0x9E, 0x2C, 0xA1, 0xE1, 0xAC, 0x7E, 0x73, 0xE7, 0x3E, 0x79, 0x2E, 0x29, 0x29,
+    0xD1, 0xE1, 0xD9, 0x1F, 0x0E, 0x0F, 0x19, 0xFF, 0xE9, 0x29, 0xFF, 0xC9, 0x49, 0xFE, 0x97, 0xFC,
+    0x72, 0xE5, 0xFF, 0xFD, 0xAF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFC, 0xA0, 0x72, 0xAA, 0xA9, 0x71,
+    0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x72, 0xE9,
+    0x5A, 0x3E, 0x94, 0xAD, 0x2E, 0x93, 0xAF, 0x1E, 0x92, 0xAF, 0x2E, 0x91, 0x9E, 0xA3, 0xE9, 0x09,
+    0xEA, 0x99, 0x99, 0x9E, 0x99, 0xFF, 0xFC, 0x9A, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x19, 0xEA, 0x72,
+    0x9E, 0xA7, 0x29, 0xF9, 0x71, 0x9F, 0x72, 0x9D, 0x74, 0x97, 0x9A, 0xAA, 0x72, 0xAE, 0x97, 0x1A,
+    0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x29, 0xA5,
+    0x9E, 0x19, 0xDA, 0x49, 0xE1, 0xFA, 0x39, 0xE2, 0xF9, 0x29, 0xE3, 0xAE, 0x91, 0x9E, 0x99, 0x99,
+    0x9A, 0xE9, 0x09, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0xA9, 0xFF, 0xFC, 0x71, 0xAE, 0x71, 0xF9, 0x79,
+    0xF9, 0x70, 0xF9, 0x72, 0xD9, 0x74, 0x95, 0x75, 0x9E, 0xA7, 0x59, 0xEA, 0x76, 0xE9, 0x49, 0xCA,
+    0x6E, 0x94, 0xEA, 0x5E, 0x93, 0xF9, 0x5E, 0x92, 0xF7, 0xE9, 0x1E, 0xA7, 0x0E, 0x90, 0xFF, 0xFF,
+    0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x0A, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x2A, 0xE9, 0x76, 0xAE, 0xA7, 0x6A, 0xF7, 0x6E, 0x97, 0x7C, 0x97, 0x77, 0x50, 0x77, 0x73, 0xAC,
+    0x77, 0x1A, 0xE7, 0x7A, 0xE9, 0x76, 0xAE, 0x97, 0x69, 0xE9, 0x29, 0x99, 0x99, 0x9A, 0xAA, 0x91,
+    0x9F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFD, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xAD, 0x97, 0x70, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xFF,
+    0xDA, 0x1A, 0xFF, 0xFF, 0xCA, 0x2A, 0xEA, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAC, 0xA3, 0xAE, 0x77,
+    0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1D, 0x77, 0x77, 0x00, 0x79, 0xA9, 0x76, 0x9E, 0x97, 0x49, 0xFC,
+    0x97, 0x29, 0xE9, 0xE9, 0x70, 0xAE, 0x90, 0x9E, 0xA6, 0xAF, 0x90, 0x9F, 0xA4, 0xAF, 0xC9, 0x09,
+    0xFC, 0xA2, 0xAE, 0xAD, 0x90, 0x9D, 0xAE, 0xA1, 0xE9, 0x9D, 0x90, 0x9D, 0x99, 0xE2, 0xC9, 0x09,
+    0xD9, 0x09, 0xD9, 0x09, 0xC6, 0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x71, 0x9D, 0x90,
+    0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x71, 0xAD, 0x90, 0x9D, 0x97, 0x1A, 0xD9, 0x09, 0xDA, 0x71,
+    0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09,
+    0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA4, 0x77, 0x77, 0x0C, 0xA7, 0x71, 0xEA, 0x77, 0x09, 0xEA, 0x77,
+    0x09, 0xEA, 0x39, 0xAA, 0xA9, 0x99, 0x99, 0x92, 0x9E, 0x92, 0xAF, 0xFF, 0xFC, 0x91, 0xAF, 0xFF,
+    0xFD, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x97, 0x70, 0x9D, 0xA0, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0xAF, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFC, 0xA1,
+    0xAC, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0xEA, 0x77, 0xEA, 0x77, 0xEA, 0x77, 0xEA, 0x77, 0x1D,
+    0x77, 0x73, 0x49, 0xAA, 0x2A, 0xA9, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71,
+    0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xDA, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x1A, 0xD9, 0x09,
+    0xD9, 0x71, 0x9D, 0x90, 0x9D, 0x97, 0x19, 0xD9, 0x09, 0xD9, 0x71, 0x9D, 0x90, 0x9D, 0x97, 0x19,
+    0xD9, 0x09, 0xD9, 0x6C, 0x19, 0xD9, 0x09, 0xD9, 0x09, 0xC2, 0xE0, 0x9D, 0x90, 0x9D, 0x90, 0xE1,
+    0xF9, 0xD9, 0x09, 0xD9, 0xF2, 0xAF, 0xC9, 0x09, 0xFC, 0xA4, 0xAF, 0x90, 0x9F, 0xA6, 0xAE, 0x90,
+    0x9E, 0xA7, 0x0A, 0xE9, 0xEA, 0x72, 0xAF, 0xCA, 0x74, 0xAE, 0xA7, 0x69, 0xC9, 0x70, 0x77, 0x72,
+    0xAC, 0x4C, 0xA7, 0x2A, 0xE2, 0xEA, 0x70, 0xAE, 0x92, 0x9E, 0xA6, 0xAE, 0x94, 0x9E, 0xA4, 0xAF,
+    0xFF, 0xEA, 0x2A, 0xFF, 0xFF, 0xC9, 0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0xE9,
+    0x74, 0x9E, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA0, 0xAF, 0xFF, 0xFC, 0xA2, 0xAF,
+    0xFF, 0xEA, 0x4A, 0xE9, 0x49, 0xEA, 0x6F, 0x4E, 0xA7, 0x0F, 0x2F, 0x72, 0xD9, 0x29, 0xD7, 0x49,
+    0x49, 0x60, 0xAF, 0xC7, 0x3F, 0x90, 0xFC, 0xA7, 0x2F, 0x1F, 0xD7, 0x1A, 0xEA, 0x1A, 0xFC, 0x71,
+    0xF9, 0x2F, 0xC9, 0x79, 0xF3, 0xFD, 0x7A, 0xE9, 0x39, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xF5, 0xFF,
+    0xFF, 0xA5, 0xAF, 0xFF, 0xE6, 0x9F, 0xFF, 0xE7, 0xFC, 0x93, 0xAE, 0x97, 0xAF, 0xC3, 0xF7, 0x1F,
+    0xC3, 0xEA, 0x71, 0xFC, 0x91, 0xAE, 0x72, 0x9F, 0xC1, 0xEA, 0x73, 0xFC, 0x09, 0xE7, 0x4A, 0xF9,
+    0xAE, 0x74, 0x9F, 0xF9, 0x75, 0xFF, 0x76, 0xAF, 0xDA, 0x77, 0xFD, 0x77, 0x0F, 0xCA, 0x77, 0x09,
+    0xF7, 0x72, 0xA9, 0x73, 0x69, 0xAD, 0xA9, 0x71, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x5E, 0x99, 0x9A,
+    0xFC, 0x5A, 0x94, 0xAF, 0xA7, 0x4F, 0xC7, 0x4A, 0xF7, 0x49, 0xF7, 0x49, 0xF9, 0x6A, 0xFA, 0xF9,
+    0x49, 0xFF, 0xE9, 0x3A, 0xFF, 0xF9, 0x2A, 0xF9, 0x2F, 0xC3, 0xF9, 0x39, 0xF2, 0xAE, 0xA4, 0x9F,
+    0x2F, 0x5A, 0xF1, 0x9F, 0x5F, 0xA1, 0xAE, 0xA5, 0xF2, 0xFA, 0x49, 0xF2, 0xFA, 0x4F, 0xA2, 0xFA,
+    0x4F, 0x3F, 0xC3, 0xF9, 0x3A, 0xF9, 0x1F, 0xA4, 0x9F, 0xFE, 0x6A, 0xFF, 0xA7, 0x09, 0xFD, 0x97,
+    0x49, 0x97, 0x10, 0x0F, 0xFF, 0xDA, 0x1F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x0F, 0xCA, 0xAA, 0xAA,
+    0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x09, 0x99,
+    0x99, 0x99, 0x2F, 0xC9, 0x0A, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFD, 0x97, 0x2F,
+    0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x99, 0xCA, 0xAA,
+    0xAA, 0xAA, 0x99, 0xFC, 0x99, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x00, 0x77, 0x77,
+    0x29, 0x9A, 0xA9, 0x95, 0xAA, 0x79, 0xAF, 0xFC, 0x91, 0xAD, 0xA5, 0xFF, 0xFC, 0xAA, 0xE5, 0xFF,
+    0xFF, 0xD5, 0xFD, 0xA3, 0xAF, 0xD5, 0xFC, 0xA7, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xD3, 0xFC, 0x79,
+    0xFE, 0x91, 0x9F, 0x96, 0x9E, 0x0F, 0xA1, 0xAF, 0x69, 0xE1, 0xAF, 0x1F, 0xC5, 0x9E, 0x91, 0xAF,
+    0x1F, 0xA5, 0xE9, 0x2A, 0xF1, 0xFA, 0x4E, 0x93, 0xAF, 0x1F, 0xA3, 0xE9, 0x4A, 0xF1, 0xFA, 0x2E,
+    0x95, 0xFC, 0x1F, 0xA1, 0xE9, 0x6F, 0xA1, 0xAF, 0x0E, 0xA6, 0x9F, 0x91, 0x9F, 0xEA, 0x7F, 0xC3,
+    0xFD, 0xA7, 0xAF, 0x93, 0x9F, 0xC7, 0xAF, 0xC5, 0xFD, 0x93, 0x9F, 0xD5, 0xAF, 0xFF, 0xFC, 0x94,
+    0xAF, 0xFF, 0xFC, 0x5A, 0xE1, 0x9F, 0xFD, 0x97, 0xD5, 0x9A, 0xAA, 0x99, 0x77, 0x77, 0x20, 0x73,
+    0x99, 0x77, 0x09, 0xF7, 0x70, 0xFC, 0xA7, 0x6A, 0xFD, 0x76, 0xFE, 0x97, 0x49, 0xFE, 0xA7, 0x4E,
+    0xAF, 0xC7, 0x39, 0xE0, 0xFC, 0x97, 0x2A, 0xE0, 0x9F, 0xC7, 0x2E, 0x91, 0xFC, 0x71, 0xAE, 0x2F,
+    0xCA, 0x70, 0xEA, 0x29, 0xFC, 0x79, 0xE9, 0x3F, 0xC9, 0x6F, 0x4F, 0xCA, 0x6E, 0xA4, 0x9F, 0xC5,
+    0xAE, 0x6F, 0xC9, 0x4F, 0x6F, 0xCA, 0x39, 0xEA, 0x69, 0xFC, 0x3F, 0x70, 0xFC, 0x91, 0x9F, 0x70,
+    0xFD, 0x1F, 0x97, 0x09, 0xFC, 0x1F, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xFA, 0x9F, 0xFF, 0xFF, 0xA0,
+    0x0F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA9, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0xF9, 0x0F, 0xCA, 0x79, 0xF1, 0xAF, 0xC7, 0xAE, 0x91, 0x9F, 0xC7, 0xF3, 0xFC, 0xA5, 0x9E, 0xA3,
+    0xAF, 0xC5, 0xF4, 0x9F, 0xC5, 0xF5, 0xFC, 0xA3, 0xAE, 0x95, 0xAF, 0xC3, 0xF7, 0xFC, 0x3E, 0xA7,
+    0xFC, 0xA1, 0xAE, 0x70, 0x9F, 0xC1, 0xEA, 0x71, 0xFC, 0x09, 0xE9, 0x71, 0xAF, 0xAA, 0xE7, 0x29,
+    0xFF, 0x97, 0x3F, 0xF7, 0x4A, 0xFD, 0xA7, 0x5F, 0xD7, 0x6F, 0xCA, 0x76, 0x9F, 0x77, 0x0A, 0x97,
+    0x20, 0x79, 0xAA, 0xFF, 0xE9, 0x5A, 0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xFD,
+    0x91, 0x9F, 0xCA, 0x97, 0x6F, 0xC9, 0x77, 0x9F, 0xA7, 0x70, 0xFC, 0x77, 0x1F, 0xA7, 0x70, 0x9F,
+    0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF,
+    0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFA,
+    0x77, 0x1F, 0xC7, 0x71, 0xAF, 0x97, 0x71, 0xFC, 0x97, 0x70, 0x9F, 0xCA, 0x77, 0x0A, 0xFF, 0xFF,
+    0xD9, 0x3A, 0xFF, 0xFF, 0xC9, 0x5A, 0xFF, 0xFE, 0x97, 0x9A, 0xFF, 0xF9, 0x77, 0x9A, 0xAA, 0x77,
+    0x2F, 0x77, 0x2F, 0x72, 0x9A, 0xAF, 0xFE, 0x95, 0xAF, 0xFF, 0xE9, 0x39, 0xFF, 0xFF, 0xC9, 0x29,
+    0xFF, 0xFF, 0xD9, 0x19, 0xFC, 0xA9, 0x3F, 0x6F, 0xC9, 0x49, 0xEA, 0x59, 0xFA, 0x5A, 0xE9, 0x5F,
+    0xC6, 0xF6, 0xFA, 0x59, 0xEA, 0x59, 0xFA, 0x09, 0x99, 0x99, 0xFA, 0x99, 0x99, 0x90, 0x9F, 0xFF,
+    0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xA9, 0x99, 0x9A, 0xF9, 0x99,
+    0x99, 0x99, 0x1F, 0xA3, 0xAE, 0x97, 0x0F, 0xC3, 0xF7, 0x1A, 0xF9, 0x19, 0xEA, 0x72, 0xFC, 0x90,
+    0xAE, 0x97, 0x29, 0xFC, 0xAF, 0x74, 0xAF, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xFC, 0x94, 0x9F, 0xFF,
+    0xF9, 0x6A, 0xFF, 0xFD, 0x96, 0xF7, 0x71, 0x9E, 0xA7, 0x71, 0x9E, 0x97, 0x30, 0x69, 0xAF, 0xFF,
+    0xC9, 0x4A, 0xFF, 0xFF, 0x92, 0x9F, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xFE, 0x91, 0xFD, 0x97, 0x6A,
+    0xFA, 0x77, 0x0F, 0xC7, 0x71, 0xFA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF,
+    0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFF, 0xC9, 0x9F, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xFC, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xCA, 0x77, 0x09, 0xFF, 0xFF, 0xE9,
+    0x29, 0xFF, 0xFF, 0xD9, 0x4F, 0xFF, 0xFC, 0x96, 0xAA, 0xFF, 0xFC, 0x97, 0x76, 0x9F, 0xFE, 0xAA,
+    0x97, 0x9F, 0xFF, 0xEA, 0x59, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFF, 0xD9, 0x77, 0x9A, 0xFC, 0x97,
+    0x70, 0x9F, 0xC7, 0x71, 0xAF, 0x97, 0x71, 0xFC, 0x77, 0x1A, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xAF, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xFC,
+    0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x97, 0x70, 0xAF, 0x77, 0x1F, 0xC7,
+    0x70, 0x9F, 0xA7, 0x79, 0xFC, 0x77, 0xAF, 0xC9, 0x19, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xCA,
+    0x39, 0xFF, 0xFE, 0xA5, 0x9F, 0xFF, 0xA9, 0x70, 0x19, 0xAA, 0xA9, 0x77, 0x2F, 0x77, 0x2F, 0x77,
+    0x9F, 0xFE, 0xAA, 0x97, 0x9F, 0xFF, 0xEA, 0x59, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFF, 0xD9, 0x7F,
+    0x39, 0xAF, 0xC9, 0x6A, 0xE9, 0x49, 0xFC, 0x69, 0xEA, 0x5A, 0xF9, 0x6F, 0x6F, 0xC6, 0xAE, 0x95,
+    0xAF, 0x19, 0x99, 0x99, 0xAF, 0x99, 0x99, 0x90, 0xAF, 0x99, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF,
+    0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x9F, 0xA9, 0x99, 0x9A, 0xF9, 0x79, 0xEA,
+    0x3A, 0xF7, 0x1F, 0x3F, 0xC7, 0x1A, 0xE9, 0x19, 0xFA, 0x71, 0x9E, 0xA0, 0x9F, 0xC7, 0x3F, 0xAF,
+    0xC9, 0x19, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xCA, 0x39, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xDA,
+    0x77, 0x2F, 0x77, 0x2A, 0xE9, 0x77, 0x19, 0xE9, 0x50, 0x9F, 0xFF, 0xCA, 0x96, 0x9F, 0xFF, 0xFA,
+    0x49, 0xFF, 0xFF, 0xD9, 0x29, 0xFF, 0xFF, 0xE9, 0x77, 0x9F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xFC,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0x09, 0xFF, 0xFF, 0xFC, 0x99, 0xFF, 0xFF,
+    0xFC, 0x99, 0xFF, 0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x97,
+    0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0xAF, 0xC1, 0x9F, 0xFF, 0xFE, 0x91, 0x9F, 0xFF, 0xFD, 0x92,
+    0x9F, 0xFF, 0xFC, 0x49, 0xFF, 0xFC, 0xAA, 0x77, 0x75, 0xAF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
+    0xC9, 0xAF, 0xFF, 0xFF, 0xE9, 0x3F, 0xCA, 0x99, 0x99, 0x99, 0x99, 0xFC, 0xA5, 0xFC, 0x97, 0xFC,
+    0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC,
+    0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC,
+    0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC,
+    0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC,
+    0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC, 0x95, 0xFC, 0x97, 0xFC,
+    0x93, 0x9F, 0xFA, 0x39, 0xFF, 0xA0, 0xAF, 0xFD, 0x91, 0xAF, 0xFD, 0x9F, 0xFE, 0x91, 0xFF, 0xE9,
+    0x77, 0x71, 0x09, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xD1, 0x9F, 0xFF, 0xFD, 0x2F, 0xD9, 0x99, 0x99,
+    0x99, 0x9F, 0x29, 0xFC, 0x96, 0x9E, 0x3A, 0xFC, 0x7E, 0x4F, 0xCA, 0x6A, 0xD4, 0x9F, 0xC9, 0x76,
+    0xAF, 0xC7, 0x7F, 0xCA, 0x76, 0x9F, 0xC9, 0x76, 0xAF, 0xC7, 0x7F, 0xCA, 0x76, 0x9F, 0xC7, 0x7F,
+    0xC7, 0x6F, 0xC7, 0x6A, 0xF9, 0x75, 0x9F, 0xA7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6A, 0xF7, 0x0D, 0xA2,
+    0x9F, 0x97, 0x9E, 0x2F, 0xA7, 0x0F, 0x1F, 0xC7, 0x09, 0xF0, 0xAF, 0xFF, 0xFD, 0xA0, 0xFF, 0xFF,
+    0xE9, 0x0A, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xD7, 0x72, 0x92, 0xFF, 0xFD, 0x9F, 0xFF, 0xDA, 0xFF,
+    0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0xEA, 0x77, 0xAE, 0x97, 0x69, 0xEA,
+    0x77, 0xF7, 0x7A, 0xEA, 0x77, 0xF7, 0x7A, 0xE9, 0x76, 0x9E, 0xA7, 0x7F, 0x77, 0x9E, 0xA7, 0x7F,
+    0x77, 0xAE, 0x97, 0x69, 0xEA, 0x77, 0xF7, 0x79, 0xEA, 0x77, 0xF7, 0x7A, 0xE9, 0x76, 0x9E, 0xA7,
+    0x7F, 0x77, 0x9E, 0xA7, 0x7F, 0x77, 0xAE, 0x97, 0x69, 0xF7, 0x7F, 0x77, 0x9E, 0xA7, 0x79, 0x99,
+    0x97, 0x70, 0xAE, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xF7, 0x3F, 0x73, 0xAE, 0xA7, 0x3F, 0x73,
+    0xFA, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0xAE, 0xA7, 0x3F, 0x73, 0xAE, 0xA7,
+    0x29, 0xF7, 0x3F, 0x97, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xEA, 0x73, 0xF7, 0x3A, 0xEA, 0x72, 0x9F,
+    0x73, 0xF9, 0x72, 0x9F, 0x73, 0x99, 0x99, 0x00, 0x59, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0xD2, 0xE1,
+    0x9C, 0xA1, 0xAE, 0x90, 0xDA, 0x0F, 0x1F, 0xFF, 0xD9, 0x19, 0xFF, 0xDA, 0x59, 0xFD, 0xA7, 0xAF,
+    0xE9, 0x4A, 0xFF, 0xE9, 0x1F, 0xCA, 0xFF, 0x90, 0x9E, 0x1D, 0xA0, 0x9E, 0x2C, 0x91, 0x9E, 0x2C,
+    0x96, 0x9E, 0x73, 0x9E, 0x74, 0x99, 0x95, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x92, 0x9F, 0xFC, 0x91,
+    0xF9, 0x9A, 0xF0, 0x9E, 0x3A, 0xE0, 0xAE, 0x39, 0xE0, 0xAE, 0x4E, 0x0A, 0xE3, 0xAE, 0x1F, 0x99,
+    0xAE, 0xA1, 0xAF, 0xFC, 0x3F, 0xF5, 0x9A, 0xDA, 0x93, 0x09, 0xAA, 0xA1, 0x9F, 0xC0, 0xAF, 0xC0,
+    0xAF, 0xC0, 0x9F, 0xA2, 0x99, 0x91, 0x77, 0x1A, 0xAA, 0x77, 0x1A, 0xE7, 0x71, 0xF7, 0x71, 0xE9,
+    0x77, 0x09, 0xE7, 0x71, 0xF7, 0x71, 0xEA, 0x77, 0x09, 0xE7, 0x71, 0xAE, 0x77, 0x1E, 0xA7, 0x71,
+    0xE9, 0x77, 0x0A, 0xE7, 0x71, 0xEA, 0x39, 0xFD, 0x95, 0xE9, 0x39, 0xFD, 0xA4, 0x9E, 0x49, 0xFE,
+    0x4A, 0xDA, 0x59, 0x9A, 0xF4, 0xE9, 0x70, 0xF9, 0x29, 0xE7, 0x1A, 0xEA, 0x2A, 0xE7, 0x19, 0xF2,
+    0xE9, 0x72, 0xF2, 0xE7, 0x3F, 0x90, 0x9E, 0x73, 0x9E, 0xA0, 0xEA, 0x74, 0xF0, 0xE7, 0x5F, 0x9E,
+    0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x97, 0x6F, 0xD7, 0x7A, 0xFA, 0x77, 0x9F, 0x97, 0x70, 0xAE, 0x71,
+    0x49, 0x70, 0x93, 0xFC, 0x93, 0x9D, 0x2F, 0xE9, 0x1A, 0xE1, 0xFF, 0xC0, 0xAE, 0xA1, 0xEA, 0x1A,
+    0xFD, 0x29, 0xE3, 0xFC, 0x3A, 0xDA, 0x4E, 0xA3, 0xAE, 0x3A, 0xF9, 0x29, 0xE9, 0x1A, 0xFD, 0x92,
+    0xFF, 0xC0, 0xFA, 0x1A, 0xFE, 0x2F, 0x2A, 0xFA, 0x4E, 0x49, 0x97, 0x9A, 0x00, 0x49, 0x70, 0x99,
+    0x59, 0xFC, 0x4A, 0xF9, 0x29, 0xFE, 0x2F, 0xE9, 0x1F, 0xFC, 0x0F, 0xFC, 0x09, 0xE9, 0x1F, 0xDA,
+    0x1A, 0xE0, 0xAE, 0x3F, 0xA3, 0xE0, 0xAD, 0xA3, 0xAE, 0x4E, 0x0A, 0xDA, 0x3F, 0xC3, 0xE0, 0x9E,
+    0x2F, 0xDA, 0x1A, 0xE1, 0xFF, 0xA9, 0xFF, 0xA1, 0xAF, 0xDA, 0x19, 0xFE, 0x3A, 0xFA, 0x39, 0xFC,
+    0x69, 0x97, 0x09, 0x40, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7,
+    0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79,
+    0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9E, 0xA7, 0x79, 0xEA,
+    0x77, 0x9E, 0xA7, 0x79, 0xFF, 0xFF, 0xE9, 0x9F, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xE9, 0x9F, 0xFF,
+    0xFE, 0x90, 0x77, 0x1A, 0x97, 0x75, 0x9D, 0x97, 0x73, 0x9F, 0xA7, 0x72, 0xFC, 0x77, 0x2F, 0xC9,
+    0x77, 0x1A, 0xFA, 0x77, 0x19, 0xFA, 0x77, 0x19, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x97, 0x71,
+    0xAF, 0x97, 0x71, 0x9F, 0xA7, 0x71, 0x9F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xAF, 0x97,
+    0x71, 0x9F, 0xA7, 0x71, 0x9F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xFF, 0xFF, 0xCA, 0x1A, 0xFF, 0xFF,
+    0xFC, 0xA0, 0x9F, 0xFF, 0xFF, 0xDA, 0x9F, 0xFF, 0xFF, 0xEA, 0x9A, 0xAA, 0x0F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+    0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x99, 0x99, 0x90, 0x0A,
+    0xAA, 0x92, 0xAA, 0xA9, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA,
+    0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F,
+    0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19, 0xEA, 0x0F, 0x19,
+    0xEA, 0x0F, 0x19, 0xEA, 0x09, 0x99, 0x92, 0x99, 0x99, 0x70, 0x9E, 0xA7, 0x71, 0xAF, 0x77, 0x1F,
+    0xC9, 0x77, 0xAF, 0xD7, 0x7F, 0xE7, 0x69, 0xFE, 0xA7, 0x5F, 0xAF, 0x75, 0xF0, 0xF9, 0x73, 0xAE,
+    0xA0, 0x9F, 0x73, 0xF9, 0x1F, 0x97, 0x19, 0xF2, 0xAE, 0xA7, 0x1F, 0xA3, 0xF7, 0x1F, 0x4F, 0x97,
+    0xAF, 0x49, 0xF7, 0xF9, 0x5F, 0x95, 0x9F, 0x6A, 0xEA, 0x5F, 0xA6, 0x9F, 0x5F, 0x70, 0xFA, 0x3A,
+    0xF7, 0x0A, 0xF3, 0xF9, 0x71, 0xF9, 0x19, 0xF7, 0x2A, 0xF1, 0xFA, 0x72, 0x9F, 0x09, 0xF9, 0x73,
+    0xFA, 0x9F, 0x74, 0xFA, 0x0F, 0xA7, 0x29, 0xF1, 0xAF, 0x72, 0xAF, 0x2F, 0x97, 0x1F, 0x92, 0xAF,
+    0x70, 0x9F, 0x39, 0xF7, 0x0F, 0xA4, 0xFA, 0x7F, 0x59, 0xF6, 0xAF, 0x6F, 0x95, 0xF9, 0x6A, 0xEA,
+    0x49, 0xF7, 0x9F, 0x4F, 0xA7, 0x0F, 0xA3, 0xF7, 0x19, 0xF2, 0xAE, 0xA7, 0x2F, 0x91, 0xF9, 0x72,
+    0xAE, 0xA0, 0x9F, 0x74, 0xF0, 0xAE, 0xA7, 0x4F, 0xAF, 0x75, 0x9F, 0xEA, 0x76, 0xFE, 0x97, 0x6A,
+    0xFD, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0x9E, 0xA7, 0x00, 0x69, 0x9A, 0x99, 0x72, 0x9F,
+    0xFC, 0x96, 0xFF, 0xFC, 0x4F, 0xFF, 0xE2, 0xAF, 0xCA, 0x99, 0x9A, 0xFC, 0xA1, 0xFA, 0x6A, 0xF0,
+    0x9F, 0x70, 0xF9, 0x9E, 0xA7, 0x0A, 0xE9, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0xAE,
+    0x97, 0x09, 0xEA, 0xAE, 0x97, 0x09, 0xEA, 0x9E, 0xA7, 0x0A, 0xE9, 0x9F, 0x70, 0xF9, 0x0F, 0xA6,
+    0xAF, 0x1A, 0xFC, 0xA9, 0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xE4, 0xFF, 0xFC, 0x69, 0xFF, 0xC9, 0x72,
+    0x99, 0xA9, 0x96, 0x72, 0xAA, 0xCA, 0xA7, 0x39, 0xFE, 0xA7, 0x0A, 0xFF, 0xC7, 0x0F, 0xCA, 0xF7,
+    0xAF, 0x19, 0xD9, 0x7F, 0xC2, 0x97, 0x1F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74,
+    0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F,
+    0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7,
+    0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFA, 0x70, 0x92, 0x9F, 0x97,
+    0xE1, 0xAF, 0x7A, 0xFA, 0xFA, 0x7A, 0xFF, 0xC7, 0x1F, 0xF7, 0x39, 0xAA, 0xAA, 0x97, 0x20, 0x77,
+    0x77, 0xAE, 0xA7, 0x70, 0x9F, 0xC9, 0x77, 0x9F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0xAE, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xA9, 0x72, 0x9A, 0xAA,
+    0x2A, 0xFA, 0x70, 0x9F, 0xA1, 0xFD, 0x70, 0xFD, 0x1F, 0xD7, 0x0F, 0xD1, 0xAF, 0x97, 0x09, 0xFA,
+    0x29, 0x99, 0x73, 0x99, 0x92, 0x77, 0x70, 0xF9, 0x71, 0xF9, 0x1F, 0xD7, 0x0A, 0xFC, 0x1F, 0xD7,
+    0x0F, 0xD1, 0xFC, 0xA7, 0x0A, 0xFC, 0x2E, 0xA7, 0x2E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xA9, 0x77, 0x1F, 0xC7, 0x70, 0x9F, 0xC9, 0x77, 0x9F,
+    0xC9, 0x77, 0x0F, 0xC7, 0x72, 0x99, 0x97, 0x10, 0x3A, 0xCA, 0x3F, 0xA1, 0x9F, 0xC1, 0x9F, 0xA2,
+    0xEA, 0x49, 0x77, 0x77, 0x77, 0x59, 0x49, 0xE9, 0x2F, 0xC1, 0x9F, 0xA1, 0x9F, 0x3A, 0xCA, 0x30,
+    0x77, 0x70, 0xF9, 0x71, 0xF9, 0x1F, 0xD7, 0x0A, 0xFC, 0x1F, 0xD7, 0x0F, 0xD1, 0xFC, 0xA7, 0x0A,
+    0xFC, 0x2E, 0xA7, 0x2E, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x39, 0xAA, 0x97, 0x29, 0xAA, 0xA2, 0xAF, 0xA7, 0x09, 0xFA, 0x1F, 0xD7, 0x0F, 0xD1, 0xFD, 0x70,
+    0xFD, 0x1A, 0xF9, 0x70, 0x9F, 0xA2, 0x99, 0x97, 0x39, 0x99, 0x20, 0x77, 0x69, 0xFC, 0xA9, 0x5D,
+    0x2A, 0xFF, 0xC9, 0x2F, 0x09, 0xFF, 0xFF, 0xC9, 0x0E, 0xA2, 0x9F, 0xFC, 0xA2, 0xCA, 0x6A, 0xFC,
+    0x97, 0x75, 0x39, 0xAA, 0xA9, 0x79, 0x93, 0xFE, 0xA4, 0x9D, 0x91, 0xFF, 0xDA, 0x99, 0xAE, 0xA0,
+    0xAE, 0xA9, 0xAF, 0xFE, 0x1A, 0xD9, 0x39, 0xFF, 0x3A, 0xA6, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x39,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xFC, 0x90, 0xAF, 0xFF, 0xFC,
+    0x90, 0x9F, 0xFF, 0xFC, 0x97, 0x77, 0x77, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x1A, 0xFF, 0xFF, 0xC9, 0x0A, 0xFF, 0xFF, 0xC9, 0x09, 0xFF, 0xFF, 0xC9, 0x29, 0xAA, 0x95, 0x99,
+    0x3F, 0xD9, 0x3E, 0x1F, 0xFA, 0x1A, 0xE0, 0x9F, 0xFF, 0xE0, 0xAE, 0x2F, 0xF9, 0x1D, 0x93, 0x9F,
+    0xC9, 0x39, 0x69, 0x99, 0x6A, 0xDA, 0x59, 0xA3, 0xFD, 0xA3, 0xE1, 0xFF, 0xC9, 0x0A, 0xE0, 0x9F,
+    0xAF, 0xFD, 0x0A, 0xDA, 0x2A, 0xFE, 0x2A, 0xC4, 0x9F, 0xC7, 0x73, 0x77, 0x3C, 0xA9, 0x72, 0x9A,
+    0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC2, 0xAF, 0xFF, 0xCA, 0x70, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xAF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFC, 0x1F, 0xAA, 0x99,
+    0x99, 0x9A, 0xAF, 0x1A, 0x76, 0xA0, 0x71, 0xA7, 0x49, 0xD9, 0x72, 0xE2, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFA, 0xA9, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xA9, 0x5E, 0x72, 0xAD,
+    0xA5, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xFF, 0xFD, 0xAA, 0xAA, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x1A, 0xDA, 0x72, 0xAD, 0x74, 0x99, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFC, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x77, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xAF, 0xFF, 0xFC, 0x9A, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x97, 0x77, 0x76, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFC, 0x9A, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC,
+    0x90, 0x73, 0x97, 0x39, 0xDA, 0x70, 0xAF, 0xC6, 0xAF, 0xD9, 0x4A, 0xFC, 0xA9, 0x4A, 0xFC, 0xA5,
+    0xAF, 0xCA, 0x7F, 0xC7, 0x1A, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7,
+    0x09, 0xFD, 0x97, 0x09, 0xF7, 0x3A, 0xC9, 0x77, 0x76, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD,
+    0xA0, 0x77, 0xCA, 0x73, 0x9E, 0xA7, 0x1A, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x09, 0xFD, 0xA7, 0x09,
+    0xFD, 0x97, 0x09, 0xFD, 0x97, 0x0A, 0xFA, 0x7A, 0xFC, 0x94, 0x9A, 0xFC, 0xA4, 0x9F, 0xD9, 0x49,
+    0xFD, 0x95, 0xAF, 0xC9, 0x70, 0xE9, 0x72, 0xA9, 0x77, 0x77, 0x71, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA,
+    0xFF, 0xFD, 0xA0, 0x73, 0x97, 0x29, 0x97, 0x29, 0xDA, 0x79, 0xE7, 0x09, 0xFC, 0x59, 0xFC, 0x95,
+    0x9F, 0xD9, 0x39, 0xFD, 0xA4, 0x9F, 0xD9, 0x39, 0xFD, 0x94, 0x9F, 0xD9, 0x39, 0xFD, 0x94, 0x9F,
+    0xCA, 0x93, 0x9F, 0xD9, 0x6F, 0xC6, 0xFC, 0x97, 0x0A, 0xFC, 0xA4, 0xAF, 0xCA, 0x70, 0x9F, 0xDA,
+    0x39, 0xFD, 0xA7, 0x09, 0xFD, 0xA3, 0x9F, 0xDA, 0x70, 0x9F, 0xDA, 0x39, 0xFD, 0xA7, 0x09, 0xFD,
+    0x93, 0x9F, 0xD9, 0x70, 0xAF, 0x69, 0xF7, 0x3A, 0xCA, 0x70, 0x9C, 0xA7, 0x77, 0x30, 0x09, 0x97,
+    0x29, 0x74, 0xE9, 0x7E, 0x97, 0x19, 0xFC, 0x95, 0xFC, 0x97, 0x0A, 0xFD, 0x93, 0x9F, 0xD9, 0x70,
+    0x9F, 0xD9, 0x39, 0xFD, 0x97, 0x09, 0xFD, 0x93, 0x9F, 0xD9, 0x70, 0x9F, 0xD9, 0x39, 0xAF, 0xC9,
+    0x70, 0x9F, 0xA5, 0x9F, 0xC7, 0xAF, 0xCA, 0x4A, 0xFC, 0xA5, 0xAF, 0xD4, 0xAF, 0xD9, 0x4A, 0xFD,
+    0x93, 0xAF, 0xD9, 0x4A, 0xFD, 0x93, 0xAF, 0xD9, 0x49, 0xFD, 0x93, 0x9F, 0xD9, 0x7F, 0x96, 0xF9,
+    0x71, 0xAC, 0x97, 0x0A, 0xCA, 0x77, 0x77, 0x50, 0x9F, 0xFF, 0xCA, 0x96, 0x9F, 0xFF, 0xFA, 0x49,
+    0xFF, 0xFF, 0xD9, 0x29, 0xFF, 0xFF, 0xE9, 0x77, 0x9F, 0xD7, 0x71, 0xAF, 0xA7, 0x71, 0xFC, 0x77,
+    0x19, 0xF7, 0x72, 0xF9, 0x77, 0x1F, 0x97, 0x71, 0xF9, 0x77, 0x09, 0xF9, 0x77, 0x0F, 0xC7, 0x70,
+    0x9F, 0xA7, 0x7A, 0xFC, 0x19, 0xFF, 0xFF, 0xE9, 0x19, 0xFF, 0xFF, 0xD9, 0x29, 0xFF, 0xFF, 0xC4,
+    0x9F, 0xFF, 0xCA, 0xA7, 0x77, 0x50, 0x77, 0x09, 0x99, 0x77, 0x2F, 0x77, 0x2F, 0x77, 0x1A, 0xEA,
+    0x77, 0x1F, 0x72, 0x9A, 0xAF, 0xFF, 0x94, 0xAF, 0xFF, 0xF9, 0x29, 0xFF, 0xFF, 0xD9, 0x19, 0xFF,
+    0xFF, 0xE9, 0x1F, 0xD9, 0x3A, 0xE9, 0x5A, 0xFA, 0x5F, 0x6F, 0xC5, 0x9E, 0xA6, 0xF9, 0x5F, 0x69,
+    0xF6, 0xF6, 0x9F, 0x5A, 0xE9, 0x69, 0xF5, 0xF7, 0x9F, 0x93, 0x9F, 0x70, 0xFA, 0x3A, 0xE9, 0x70,
+    0xAF, 0x92, 0xF7, 0x2F, 0xCA, 0x09, 0xEA, 0x72, 0xAF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0xAF,
+    0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xFC, 0x95, 0x9A, 0xFF, 0xFD, 0x97, 0xF7, 0x71, 0xAE, 0x97, 0x71,
+    0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xE9, 0x73, 0x74, 0xAA, 0xA9, 0x77, 0x1A, 0xE9, 0x77, 0x1F, 0x77,
+    0x19, 0xEA, 0x77, 0x1F, 0x96, 0x9F, 0xFF, 0xD9, 0x69, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xFD, 0x92,
+    0x9F, 0xFF, 0xFE, 0x97, 0x2A, 0xEA, 0x9F, 0xD7, 0x2F, 0x2A, 0xFA, 0x70, 0x9E, 0xA3, 0xFC, 0x70,
+    0xAE, 0x93, 0x9F, 0x70, 0xF5, 0xF9, 0x69, 0xEA, 0x5F, 0x96, 0xF9, 0x5F, 0x96, 0xF5, 0x9F, 0x95,
+    0x9E, 0xA5, 0xFC, 0x6F, 0x59, 0xFA, 0x6F, 0x4A, 0xFC, 0x19, 0xAA, 0xAA, 0xFC, 0xAA, 0xAF, 0xE9,
+    0x19, 0xFF, 0xFF, 0xDA, 0x29, 0xFF, 0xFF, 0xC9, 0x39, 0xFF, 0xFD, 0xA9, 0x71, 0xF7, 0x71, 0x9E,
+    0xA7, 0x71, 0xF9, 0x77, 0x1F, 0x77, 0x19, 0xAA, 0xA9, 0x77, 0x59, 0xAA, 0xFF, 0xF3, 0xAF, 0xFF,
+    0xF1, 0x9F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFE, 0x0F, 0xD9, 0x74, 0x9F, 0xA7, 0x6A, 0xF7, 0x7F, 0xC7,
+    0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xC7, 0x79, 0xFA, 0x77, 0xFC, 0xA7, 0x69, 0xFF, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA1, 0x9F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x5A, 0xFF, 0xFD, 0x77, 0x77, 0x72, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFA, 0xA9, 0x5F, 0xFF,
+    0xFA, 0x3F, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xE7, 0x69, 0xFD, 0x77, 0xAF, 0x97, 0x7F, 0xA7, 0x7F,
+    0xC7, 0x7A, 0xF7, 0x7A, 0xF7, 0x7F, 0xA7, 0x6A, 0xF9, 0x75, 0xAF, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xF9, 0x0F, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0xA7, 0x77, 0x77, 0x7F,
+    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x77, 0x77, 0x9A, 0xFE,
+    0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19, 0xFA, 0x9E, 0x9A, 0xF9, 0x69, 0xEA, 0x2E, 0x2A, 0xE9, 0x5E,
+    0x93, 0xE3, 0x9E, 0x4E, 0x94, 0xE4, 0x9E, 0x29, 0xDA, 0x5E, 0x5A, 0xD9, 0x1A, 0xD6, 0xE6, 0xDA,
+    0x1D, 0xA6, 0xE6, 0xE1, 0xDA, 0x6E, 0x6A, 0xD0, 0x9E, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xAE, 0x99, 0xFF, 0xFF, 0xFE, 0x99, 0xFF, 0xFF, 0xFE, 0x90, 0xD9, 0x6E, 0x69, 0xD1, 0xDA, 0x6E,
+    0x6A, 0xD1, 0xE6, 0xE6, 0xE1, 0x9D, 0x95, 0xE5, 0x9D, 0x92, 0xE5, 0xE5, 0xE3, 0x9E, 0x4E, 0x4E,
+    0x94, 0xAE, 0x3E, 0x3E, 0xA6, 0xAE, 0xA9, 0x0E, 0x09, 0xAE, 0xA7, 0x09, 0xFF, 0xFC, 0x97, 0x3A,
+    0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xFE, 0xA7,
+    0x19, 0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x4E, 0x4E, 0x97, 0x49, 0xE2,
+    0x9D, 0xA7, 0x6A, 0xD9, 0x1A, 0xD7, 0x70, 0xDA, 0x1E, 0x77, 0x0E, 0x1D, 0xA7, 0x70, 0xAD, 0x09,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFF, 0xE9, 0x9F, 0xFF,
+    0xFF, 0xE9, 0x0D, 0x97, 0x70, 0x9D, 0x1D, 0xA7, 0x70, 0xAD, 0x1E, 0x77, 0x0E, 0x19, 0xD9, 0x76,
+    0x9D, 0x92, 0xE7, 0x6E, 0x39, 0xE7, 0x4E, 0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA, 0x94, 0x9A, 0xEA,
+    0x70, 0x9F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x77, 0x77, 0x9A,
+    0xFE, 0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19, 0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xEA, 0x70, 0x9E, 0x95,
+    0xF7, 0x19, 0xF4, 0xFD, 0x79, 0xFD, 0x29, 0xDA, 0xAE, 0x59, 0xE9, 0xAD, 0x91, 0xAD, 0x1A, 0xE3,
+    0x9E, 0x91, 0xDA, 0x1E, 0x2A, 0xE1, 0x9E, 0x92, 0xE1, 0xDA, 0x3A, 0xE9, 0xE9, 0x3A, 0xD0, 0x9D,
+    0x94, 0xAF, 0xC9, 0x49, 0xD9, 0x9D, 0x95, 0xAE, 0xA5, 0x9D, 0x99, 0xD9, 0x49, 0xFC, 0x59, 0xD9,
+    0x0D, 0x93, 0x9F, 0xE4, 0x9D, 0x1D, 0xA2, 0x9E, 0x90, 0xAE, 0x3A, 0xD1, 0xE1, 0x9E, 0x92, 0xAE,
+    0x2E, 0x19, 0xD9, 0x9E, 0x94, 0xAE, 0x09, 0xD9, 0x2F, 0xD9, 0x6A, 0xFD, 0x39, 0xF9, 0x70, 0xAF,
+    0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA, 0x94, 0x9A, 0xEA, 0x70, 0x9F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC,
+    0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19,
+    0xFA, 0x92, 0x9A, 0xF9, 0x69, 0xE9, 0x70, 0x9E, 0x95, 0xE9, 0x71, 0x9F, 0x4E, 0x97, 0x19, 0xFD,
+    0x29, 0xDA, 0x71, 0x9E, 0x9A, 0xD9, 0x1A, 0xD7, 0x19, 0xE9, 0x1D, 0xA1, 0xE7, 0x09, 0xE9, 0x2E,
+    0x1D, 0xA7, 0x9E, 0x93, 0xAD, 0x09, 0xD9, 0x69, 0xE9, 0x49, 0xD9, 0x9D, 0x95, 0x9E, 0x95, 0x9D,
+    0x99, 0xD9, 0x49, 0xE9, 0x69, 0xD9, 0x0D, 0x93, 0x9E, 0x97, 0x9D, 0x1D, 0xA2, 0x9E, 0x97, 0x0A,
+    0xD1, 0xE1, 0x9E, 0x97, 0x1E, 0x19, 0xD9, 0x9E, 0x97, 0x19, 0xD9, 0x2F, 0xD9, 0x72, 0xE3, 0x9F,
+    0x97, 0x2E, 0x94, 0xAE, 0x72, 0xEA, 0x6A, 0xEA, 0x94, 0x9A, 0xEA, 0x70, 0x9F, 0xFF, 0xC9, 0x73,
+    0xAF, 0xFC, 0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x69, 0xE9, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75,
+    0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE,
+    0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7,
+    0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x5A, 0xEA, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x09, 0xAA, 0xA1, 0x9F, 0xC0, 0xAF, 0xC0, 0xAF, 0xC0, 0x9F, 0xA2, 0x99, 0x91, 0x1A, 0xAA,
+    0x96, 0xAA, 0xA9, 0x6A, 0xAA, 0x91, 0xFC, 0x5F, 0xC5, 0xFC, 0x09, 0xFC, 0x93, 0x9F, 0xC9, 0x39,
+    0xFC, 0x99, 0xFC, 0x93, 0x9F, 0xC9, 0x39, 0xFC, 0x90, 0xFC, 0x5F, 0xC5, 0xFC, 0x29, 0x99, 0x79,
+    0x99, 0x79, 0x99, 0x10, 0x77, 0x77, 0x75, 0xC7, 0x77, 0x4E, 0x77, 0x72, 0xFC, 0x77, 0x70, 0xFE,
+    0x77, 0x6E, 0xAF, 0xC7, 0x74, 0xD4, 0x9E, 0x77, 0x2D, 0x7A, 0xD7, 0x70, 0xE7, 0x0A, 0xD7, 0x6F,
+    0xA9, 0xAD, 0xA9, 0x2E, 0x74, 0xFF, 0xFA, 0x19, 0xE7, 0x2F, 0xFF, 0xD9, 0x1F, 0x70, 0xFF, 0xFE,
+    0xA1, 0xFC, 0x6F, 0xFF, 0xFC, 0x1A, 0xFC, 0x4F, 0xFF, 0xFC, 0x91, 0xFE, 0x2F, 0xFF, 0xEA, 0x93,
+    0xFF, 0x09, 0xFF, 0xF9, 0x6A, 0xFF, 0x90, 0x9F, 0xFD, 0xA6, 0xAF, 0xF9, 0x29, 0xFF, 0xCA, 0x49,
+    0xFF, 0xC9, 0x49, 0xFF, 0xA2, 0xAF, 0xFD, 0x96, 0x9F, 0xF1, 0xAF, 0xFD, 0x97, 0x09, 0xFE, 0x19,
+    0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x9F, 0xFC, 0x97, 0x49, 0xFF, 0xFE, 0x97, 0x69, 0xFC, 0x90, 0x9F,
+    0xC9, 0x77, 0x09, 0xEA, 0x2F, 0x97, 0x72, 0x9D, 0xA2, 0xE9, 0x77, 0x49, 0xD9, 0x0A, 0xD9, 0x77,
+    0x69, 0xFC, 0x97, 0x77, 0x09, 0xE9, 0x77, 0x72, 0x9C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 11, 26, 13, 1, 25, 72, 0 }, // !
-    { 13, 12, 15, 1, 24, 39, 72 }, // "
-    { 21, 21, 22, 0, 19, 111, 111 }, // #
-    { 18, 34, 21, 1, 27, 153, 222 }, // $
-    { 30, 28, 32, 1, 25, 210, 375 }, // %
-    { 27, 27, 29, 1, 25, 183, 585 }, // &
-    { 7, 12, 9, 1, 24, 21, 768 }, // '
-    { 15, 34, 17, 1, 27, 128, 789 }, // (
-    { 15, 34, 14, -2, 27, 128, 917 }, // )
-    { 13, 12, 15, 1, 25, 39, 1045 }, // *
-    { 15, 16, 21, 3, 19, 60, 1084 }, // +
-    { 10, 11, 10, -2, 5, 28, 1144 }, // ,
-    { 11, 5, 13, 1, 11, 14, 1172 }, // -
-    { 7, 6, 10, 1, 5, 11, 1186 }, // .
-    { 21, 26, 20, -2, 24, 137, 1197 }, // /
-    { 20, 24, 21, 0, 23, 120, 1334 }, // 0
-    { 15, 24, 21, 2, 24, 90, 1454 }, // 1
-    { 20, 23, 21, 0, 23, 115, 1544 }, // 2
-    { 19, 24, 21, 0, 23, 114, 1659 }, // 3
-    { 20, 23, 21, 0, 23, 115, 1773 }, // 4
-    { 19, 24, 21, 1, 23, 114, 1888 }, // 5
-    { 20, 24, 22, 1, 23, 120, 2002 }, // 6
-    { 19, 24, 23, 3, 23, 114, 2122 }, // 7
-    { 19, 24, 21, 1, 23, 114, 2236 }, // 8
-    { 21, 24, 21, -1, 23, 126, 2350 }, // 9
-    { 9, 19, 11, 1, 18, 43, 2476 }, // :
-    { 12, 24, 11, -2, 18, 72, 2519 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2591 }, // <
-    { 15, 10, 21, 3, 16, 38, 2651 }, // =
-    { 15, 16, 21, 3, 19, 60, 2689 }, // >
-    { 12, 25, 15, 2, 24, 75, 2749 }, // ?
-    { 31, 30, 33, 1, 23, 233, 2824 }, // @
-    { 26, 24, 25, -2, 24, 156, 3057 }, // A
-    { 22, 25, 21, -2, 24, 138, 3213 }, // B
-    { 21, 25, 23, 1, 24, 132, 3351 }, // C
-    { 26, 25, 25, -2, 24, 163, 3483 }, // D
-    { 23, 23, 22, -2, 23, 133, 3646 }, // E
-    { 22, 23, 21, -2, 23, 127, 3779 }, // F
-    { 22, 25, 24, 1, 24, 138, 3906 }, // G
-    { 30, 23, 29, -2, 23, 173, 4044 }, // H
-    { 17, 23, 16, -2, 23, 98, 4217 }, // I
-    { 21, 30, 16, -6, 23, 158, 4315 }, // J
-    { 27, 24, 26, -2, 23, 162, 4473 }, // K
-    { 20, 23, 19, -2, 23, 115, 4635 }, // L
-    { 33, 23, 31, -3, 23, 190, 4750 }, // M
-    { 29, 24, 29, -1, 23, 174, 4940 }, // N
-    { 24, 25, 25, 0, 24, 150, 5114 }, // O
-    { 23, 24, 22, -2, 24, 138, 5264 }, // P
-    { 28, 32, 29, 0, 24, 224, 5402 }, // Q
-    { 24, 25, 23, -2, 24, 150, 5626 }, // R
-    { 19, 25, 19, -1, 24, 119, 5776 }, // S
-    { 22, 23, 25, 2, 23, 127, 5895 }, // T
-    { 26, 24, 29, 2, 23, 156, 6022 }, // U
-    { 25, 24, 28, 2, 23, 150, 6178 }, // V
-    { 33, 24, 36, 2, 23, 198, 6328 }, // W
-    { 27, 23, 25, -3, 23, 156, 6526 }, // X
-    { 23, 23, 25, 1, 23, 133, 6682 }, // Y
-    { 21, 24, 21, -1, 23, 126, 6815 }, // Z
-    { 15, 32, 14, -2, 26, 120, 6941 }, // [
-    { 15, 26, 17, 1, 24, 98, 7061 }, // <backslash>
-    { 15, 32, 14, -2, 26, 120, 7159 }, // ]
-    { 17, 17, 21, 2, 22, 73, 7279 }, // ^
-    { 17, 4, 18, 0, -1, 17, 7352 }, // _
-    { 7, 9, 20, 7, 28, 16, 7369 }, // `
-    { 20, 19, 21, 0, 18, 95, 7385 }, // a
-    { 18, 27, 19, 0, 26, 122, 7480 }, // b
-    { 15, 19, 16, 0, 18, 72, 7602 }, // c
-    { 20, 27, 21, 0, 26, 135, 7674 }, // d
-    { 15, 19, 16, 0, 18, 72, 7809 }, // e
-    { 24, 34, 19, -6, 26, 204, 7881 }, // f
-    { 23, 26, 21, -3, 18, 150, 8085 }, // g
-    { 19, 27, 20, 0, 26, 129, 8235 }, // h
-    { 10, 27, 12, 1, 26, 68, 8364 }, // i
-    { 19, 34, 13, -7, 26, 162, 8432 }, // j
-    { 17, 27, 18, 0, 26, 115, 8594 }, // k
-    { 10, 27, 12, 1, 26, 68, 8709 }, // l
-    { 27, 19, 29, 1, 18, 129, 8777 }, // m
-    { 19, 19, 21, 1, 18, 91, 8906 }, // n
-    { 17, 19, 18, 0, 18, 81, 8997 }, // o
-    { 21, 26, 19, -3, 18, 137, 9078 }, // p
-    { 19, 26, 20, 0, 18, 124, 9215 }, // q
-    { 16, 18, 18, 1, 18, 72, 9339 }, // r
-    { 15, 19, 15, -1, 18, 72, 9411 }, // s
-    { 15, 23, 16, 0, 22, 87, 9483 }, // t
-    { 20, 19, 21, 0, 18, 95, 9570 }, // u
-    { 17, 19, 18, 0, 18, 81, 9665 }, // v
-    { 25, 19, 26, 0, 18, 119, 9746 }, // w
-    { 21, 19, 21, -1, 18, 100, 9865 }, // x
-    { 22, 26, 18, -5, 18, 143, 9965 }, // y
-    { 17, 19, 17, -1, 18, 81, 10108 }, // z
-    { 15, 33, 17, 1, 27, 124, 10189 }, // {
-    { 11, 30, 11, -1, 26, 83, 10313 }, // |
-    { 15, 33, 14, -2, 27, 124, 10396 }, // }
-    { 17, 8, 21, 2, 15, 34, 10520 }, // ~
-    { 0, 0, 7, 0, 0, 0, 10554 }, //  
-    { 11, 26, 11, -1, 18, 72, 10554 }, // ¡
-    { 17, 33, 21, 2, 26, 141, 10626 }, // ¢
-    { 22, 24, 22, -1, 23, 132, 10767 }, // £
-    { 21, 16, 22, 0, 19, 84, 10899 }, // ¤
-    { 23, 23, 25, 1, 23, 133, 10983 }, // ¥
-    { 11, 30, 11, -1, 26, 83, 11116 }, // ¦
-    { 17, 26, 17, -1, 23, 111, 11199 }, // §
-    { 12, 6, 20, 4, 26, 18, 11310 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 11328 }, // ©
-    { 14, 17, 16, 1, 24, 60, 11485 }, // ª
-    { 19, 13, 21, 1, 15, 62, 11545 }, // «
-    { 15, 9, 21, 3, 16, 34, 11607 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 11641 }, // ­
-    { 19, 18, 20, 0, 26, 86, 11655 }, // ®
-    { 12, 4, 20, 4, 24, 12, 11741 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 11753 }, // °
-    { 15, 21, 21, 3, 20, 79, 11792 }, // ±
-    { 14, 16, 15, 0, 28, 56, 11871 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11927 }, // ³
-    { 7, 10, 20, 7, 29, 18, 11978 }, // ´
-    { 22, 26, 21, -2, 18, 143, 11996 }, // µ
-    { 22, 28, 22, -1, 23, 154, 12139 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 12293 }, // ·
-    { 8, 8, 20, 6, -1, 16, 12302 }, // ¸
-    { 11, 16, 15, 1, 28, 44, 12318 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 12362 }, // º
-    { 19, 13, 20, 0, 15, 62, 12418 }, // »
-    { 34, 28, 36, 1, 25, 238, 12480 }, // ¼
-    { 34, 28, 36, 1, 25, 238, 12718 }, // ½
-    { 34, 28, 36, 1, 25, 238, 12956 }, // ¾
-    { 11, 25, 13, 0, 18, 69, 13194 }, // ¿
-    { 26, 33, 25, -2, 33, 215, 13263 }, // À
-    { 26, 33, 25, -2, 33, 215, 13478 }, // Á
-    { 26, 32, 25, -2, 32, 208, 13693 }, // Â
-    { 26, 32, 25, -2, 32, 208, 13901 }, // Ã
-    { 26, 31, 25, -2, 31, 202, 14109 }, // Ä
-    { 26, 33, 25, -2, 33, 215, 14311 }, // Å
-    { 34, 23, 32, -3, 23, 196, 14526 }, // Æ
-    { 21, 33, 23, 1, 24, 174, 14722 }, // Ç
-    { 23, 33, 22, -2, 33, 190, 14896 }, // È
-    { 23, 33, 22, -2, 33, 190, 15086 }, // É
-    { 23, 32, 22, -2, 32, 184, 15276 }, // Ê
-    { 23, 31, 22, -2, 31, 179, 15460 }, // Ë
-    { 17, 33, 16, -2, 33, 141, 15639 }, // Ì
-    { 17, 33, 16, -2, 33, 141, 15780 }, // Í
-    { 18, 32, 17, -2, 32, 144, 15921 }, // Î
-    { 18, 31, 17, -2, 31, 140, 16065 }, // Ï
-    { 26, 25, 25, -2, 24, 163, 16205 }, // Ð
-    { 29, 33, 29, -1, 32, 240, 16368 }, // Ñ
-    { 24, 34, 25, 0, 33, 204, 16608 }, // Ò
-    { 24, 34, 25, 0, 33, 204, 16812 }, // Ó
-    { 24, 33, 25, 0, 32, 198, 17016 }, // Ô
-    { 24, 33, 25, 0, 32, 198, 17214 }, // Õ
-    { 24, 32, 25, 0, 31, 192, 17412 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 17604 }, // ×
-    { 27, 25, 27, -1, 24, 169, 17661 }, // Ø
-    { 26, 34, 29, 2, 33, 221, 17830 }, // Ù
-    { 26, 34, 29, 2, 33, 221, 18051 }, // Ú
-    { 26, 33, 29, 2, 32, 215, 18272 }, // Û
-    { 26, 32, 29, 2, 31, 208, 18487 }, // Ü
-    { 23, 33, 25, 1, 33, 190, 18695 }, // Ý
-    { 22, 23, 21, -2, 23, 127, 18885 }, // Þ
-    { 27, 34, 22, -6, 26, 230, 19012 }, // ß
-    { 20, 29, 21, 0, 28, 145, 19242 }, // à
-    { 20, 30, 21, 0, 29, 150, 19387 }, // á
-    { 20, 29, 21, 0, 28, 145, 19537 }, // â
-    { 20, 27, 21, 0, 26, 135, 19682 }, // ã
-    { 20, 27, 21, 0, 26, 135, 19817 }, // ä
-    { 20, 29, 21, 0, 28, 145, 19952 }, // å
-    { 26, 19, 27, 0, 18, 124, 20097 }, // æ
-    { 15, 27, 16, 0, 18, 102, 20221 }, // ç
-    { 15, 29, 16, 0, 28, 109, 20323 }, // è
-    { 17, 30, 18, 0, 29, 128, 20432 }, // é
-    { 16, 29, 17, 0, 28, 116, 20560 }, // ê
-    { 17, 27, 18, 0, 26, 115, 20676 }, // ë
-    { 9, 29, 11, 1, 28, 66, 20791 }, // ì
-    { 13, 30, 15, 1, 29, 98, 20857 }, // í
-    { 12, 29, 14, 1, 28, 87, 20955 }, // î
-    { 13, 27, 15, 1, 26, 88, 21042 }, // ï
-    { 18, 28, 19, 0, 27, 126, 21130 }, // ð
-    { 19, 27, 21, 1, 26, 129, 21256 }, // ñ
-    { 17, 29, 18, 0, 28, 124, 21385 }, // ò
-    { 18, 30, 19, 0, 29, 135, 21509 }, // ó
-    { 18, 29, 19, 0, 28, 131, 21644 }, // ô
-    { 18, 27, 19, 0, 26, 122, 21775 }, // õ
-    { 18, 27, 19, 0, 26, 122, 21897 }, // ö
-    { 15, 16, 21, 3, 19, 60, 22019 }, // ÷
-    { 22, 19, 21, -2, 18, 105, 22079 }, // ø
-    { 20, 29, 21, 0, 28, 145, 22184 }, // ù
-    { 20, 30, 21, 0, 29, 150, 22329 }, // ú
-    { 20, 29, 21, 0, 28, 145, 22479 }, // û
-    { 20, 27, 21, 0, 26, 135, 22624 }, // ü
-    { 22, 37, 18, -5, 29, 204, 22759 }, // ý
-    { 22, 34, 19, -4, 26, 187, 22963 }, // þ
-    { 22, 34, 18, -5, 26, 187, 23150 }, // ÿ
-    { 26, 30, 25, -2, 30, 195, 23337 }, // Ā
-    { 20, 25, 21, 0, 24, 125, 23532 }, // ā
-    { 26, 32, 25, -2, 32, 208, 23657 }, // Ă
-    { 20, 27, 21, 0, 26, 135, 23865 }, // ă
-    { 26, 31, 25, -2, 24, 202, 24000 }, // Ą
-    { 20, 25, 21, 0, 18, 125, 24202 }, // ą
-    { 21, 34, 23, 1, 33, 179, 24327 }, // Ć
-    { 17, 30, 18, 0, 29, 128, 24506 }, // ć
-    { 21, 33, 23, 1, 32, 174, 24634 }, // Ĉ
-    { 16, 29, 17, 0, 28, 116, 24808 }, // ĉ
-    { 21, 33, 23, 1, 32, 174, 24924 }, // Ċ
-    { 15, 27, 16, 0, 26, 102, 25098 }, // ċ
-    { 21, 33, 23, 1, 32, 174, 25200 }, // Č
-    { 18, 29, 19, 0, 28, 131, 25374 }, // č
-    { 26, 33, 25, -2, 32, 215, 25505 }, // Ď
-    { 25, 27, 26, 0, 26, 169, 25720 }, // ď
-    { 26, 25, 25, -2, 24, 163, 25889 }, // Đ
-    { 22, 27, 23, 0, 26, 149, 26052 }, // đ
-    { 23, 30, 22, -2, 30, 173, 26201 }, // Ē
-    { 17, 25, 18, 0, 24, 107, 26374 }, // ē
-    { 23, 32, 22, -2, 32, 184, 26481 }, // Ĕ
-    { 17, 27, 18, 0, 26, 115, 26665 }, // ĕ
-    { 23, 32, 22, -2, 32, 184, 26780 }, // Ė
-    { 15, 27, 16, 0, 26, 102, 26964 }, // ė
-    { 23, 30, 22, -2, 23, 173, 27066 }, // Ę
-    { 15, 25, 16, 0, 18, 94, 27239 }, // ę
-    { 23, 32, 22, -2, 32, 184, 27333 }, // Ě
-    { 18, 29, 19, 0, 28, 131, 27517 }, // ě
-    { 22, 33, 24, 1, 32, 182, 27648 }, // Ĝ
-    { 23, 36, 21, -3, 28, 207, 27830 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 28037 }, // Ğ
-    { 23, 34, 21, -3, 26, 196, 28219 }, // ğ
-    { 22, 33, 24, 1, 32, 182, 28415 }, // Ġ
-    { 23, 34, 21, -3, 26, 196, 28597 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 28793 }, // Ģ
-    { 23, 37, 21, -3, 29, 213, 28975 }, // ģ
-    { 30, 32, 29, -2, 32, 240, 29188 }, // Ĥ
-    { 19, 35, 20, 0, 34, 167, 29428 }, // ĥ
-    { 30, 23, 29, -2, 23, 173, 29595 }, // Ħ
-    { 19, 27, 20, 0, 26, 129, 29768 }, // ħ
-    { 18, 32, 17, -2, 32, 144, 29897 }, // Ĩ
-    { 13, 27, 15, 1, 26, 88, 30041 }, // ĩ
-    { 18, 30, 17, -2, 30, 135, 30129 }, // Ī
-    { 13, 25, 15, 1, 24, 82, 30264 }, // ī
-    { 17, 32, 16, -2, 32, 136, 30346 }, // Ĭ
-    { 13, 27, 15, 1, 26, 88, 30482 }, // ĭ
-    { 17, 30, 16, -2, 23, 128, 30570 }, // Į
-    { 10, 33, 12, 1, 26, 83, 30698 }, // į
-    { 17, 32, 16, -2, 32, 136, 30781 }, // İ
-    { 9, 19, 11, 1, 18, 43, 30917 }, // ı
-    { 30, 30, 29, -2, 23, 225, 30960 }, // Ĳ
-    { 22, 34, 24, 1, 26, 187, 31185 }, // ĳ
-    { 22, 39, 17, -6, 32, 215, 31372 }, // Ĵ
-    { 21, 36, 15, -7, 28, 189, 31587 }, // ĵ
-    { 27, 32, 26, -2, 23, 216, 31776 }, // Ķ
-    { 17, 35, 18, 0, 26, 149, 31992 }, // ķ
-    { 18, 19, 20, 1, 18, 86, 32141 }, // ĸ
-    { 20, 33, 19, -2, 33, 165, 32227 }, // Ĺ
-    { 12, 35, 14, 1, 34, 105, 32392 }, // ĺ
-    { 20, 32, 19, -2, 23, 160, 32497 }, // Ļ
-    { 12, 35, 12, -1, 26, 105, 32657 }, // ļ
-    { 22, 26, 21, -2, 26, 143, 32762 }, // Ľ
-    { 15, 27, 17, 1, 26, 102, 32905 }, // ľ
-    { 21, 23, 20, -2, 23, 121, 33007 }, // Ŀ
-    { 14, 27, 16, 1, 26, 95, 33128 }, // ŀ
-    { 20, 23, 19, -2, 23, 115, 33223 }, // Ł
-    { 13, 27, 13, -1, 26, 88, 33338 }, // ł
-    { 29, 34, 29, -1, 33, 247, 33426 }, // Ń
-    { 19, 30, 21, 1, 29, 143, 33673 }, // ń
-    { 29, 32, 29, -1, 23, 232, 33816 }, // Ņ
-    { 19, 27, 21, 1, 18, 129, 34048 }, // ņ
-    { 29, 33, 29, -1, 32, 240, 34177 }, // Ň
-    { 19, 29, 21, 1, 28, 138, 34417 }, // ň
-    { 25, 26, 28, 2, 25, 163, 34555 }, // ŉ
-    { 29, 30, 29, -1, 23, 218, 34718 }, // Ŋ
-    { 18, 26, 20, 1, 18, 117, 34936 }, // ŋ
-    { 24, 31, 25, 0, 30, 186, 35053 }, // Ō
-    { 18, 25, 19, 0, 24, 113, 35239 }, // ō
-    { 24, 33, 25, 0, 32, 198, 35352 }, // Ŏ
-    { 18, 27, 19, 0, 26, 122, 35550 }, // ŏ
-    { 25, 34, 26, 0, 33, 213, 35672 }, // Ő
-    { 20, 29, 21, 0, 28, 145, 35885 }, // ő
-    { 33, 25, 34, 0, 24, 207, 36030 }, // Œ
-    { 27, 19, 28, 0, 18, 129, 36237 }, // œ
-    { 24, 34, 23, -2, 33, 204, 36366 }, // Ŕ
-    { 16, 29, 18, 1, 29, 116, 36570 }, // ŕ
-    { 24, 33, 23, -2, 24, 198, 36686 }, // Ŗ
-    { 18, 27, 18, -1, 18, 122, 36884 }, // ŗ
-    { 24, 33, 23, -2, 32, 198, 37006 }, // Ř
-    { 17, 28, 19, 1, 28, 119, 37204 }, // ř
-    { 19, 34, 19, -1, 33, 162, 37323 }, // Ś
-    { 17, 30, 17, -1, 29, 128, 37485 }, // ś
-    { 19, 33, 19, -1, 32, 157, 37613 }, // Ŝ
-    { 16, 29, 16, -1, 28, 116, 37770 }, // ŝ
-    { 19, 33, 19, -1, 24, 157, 37886 }, // Ş
-    { 15, 27, 15, -1, 18, 102, 38043 }, // ş
-    { 20, 33, 20, -1, 32, 165, 38145 }, // Š
-    { 18, 29, 18, -1, 28, 131, 38310 }, // š
-    { 22, 32, 25, 2, 23, 176, 38441 }, // Ţ
-    { 15, 31, 16, 0, 22, 117, 38617 }, // ţ
-    { 22, 32, 25, 2, 32, 176, 38734 }, // Ť
-    { 17, 28, 18, 0, 27, 119, 38910 }, // ť
-    { 22, 23, 25, 2, 23, 127, 39029 }, // Ŧ
-    { 15, 23, 16, 0, 22, 87, 39156 }, // ŧ
-    { 26, 33, 29, 2, 32, 215, 39243 }, // Ũ
-    { 20, 27, 21, 0, 26, 135, 39458 }, // ũ
-    { 26, 31, 29, 2, 30, 202, 39593 }, // Ū
-    { 20, 25, 21, 0, 24, 125, 39795 }, // ū
-    { 26, 33, 29, 2, 32, 215, 39920 }, // Ŭ
-    { 20, 27, 21, 0, 26, 135, 40135 }, // ŭ
-    { 26, 34, 29, 2, 33, 221, 40270 }, // Ů
-    { 20, 29, 21, 0, 28, 145, 40491 }, // ů
-    { 26, 34, 29, 2, 33, 221, 40636 }, // Ű
-    { 20, 29, 21, 0, 28, 145, 40857 }, // ű
-    { 26, 30, 29, 2, 23, 195, 41002 }, // Ų
-    { 20, 25, 21, 0, 18, 125, 41197 }, // ų
-    { 33, 33, 36, 2, 32, 273, 41322 }, // Ŵ
-    { 25, 29, 26, 0, 28, 182, 41595 }, // ŵ
-    { 23, 32, 25, 1, 32, 184, 41777 }, // Ŷ
-    { 22, 36, 18, -5, 28, 198, 41961 }, // ŷ
-    { 23, 31, 25, 1, 31, 179, 42159 }, // Ÿ
-    { 21, 34, 21, -1, 33, 179, 42338 }, // Ź
-    { 17, 30, 17, -1, 29, 128, 42517 }, // ź
-    { 21, 33, 21, -1, 32, 174, 42645 }, // Ż
-    { 17, 27, 17, -1, 26, 115, 42819 }, // ż
-    { 21, 33, 21, -1, 32, 174, 42934 }, // Ž
-    { 17, 29, 17, -1, 28, 124, 43108 }, // ž
-    { 24, 34, 19, -6, 26, 204, 43232 }, // ſ
-    { 27, 29, 28, 0, 28, 196, 43436 }, // Ơ
-    { 21, 22, 22, 0, 21, 116, 43632 }, // ơ
-    { 22, 24, 23, 0, 24, 132, 43748 }, // Ƥ
-    { 21, 34, 19, -3, 26, 179, 43880 }, // ƥ
-    { 15, 30, 16, 0, 22, 113, 44059 }, // ƫ
-    { 22, 23, 25, 2, 23, 127, 44172 }, // Ƭ
-    { 17, 27, 18, 0, 26, 115, 44299 }, // ƭ
-    { 22, 30, 25, 2, 23, 165, 44414 }, // Ʈ
-    { 29, 29, 32, 2, 28, 211, 44579 }, // Ư
-    { 24, 22, 25, 0, 21, 132, 44790 }, // ư
-    { 7, 9, 3, -5, 28, 16, 44922 }, // ̀
-    { 7, 10, 6, -2, 29, 18, 44938 }, // ́
-    { 12, 9, 6, -7, 28, 27, 44956 }, // ̂
-    { 12, 6, 7, -6, 26, 18, 44983 }, // ̃
-    { 12, 4, 7, -6, 24, 12, 45001 }, // ̄
-    { 12, 6, 7, -6, 26, 18, 45013 }, // ̆
-    { 6, 6, 4, -3, 26, 9, 45031 }, // ̇
-    { 12, 6, 7, -6, 26, 18, 45040 }, // ̈
-    { 9, 10, 6, -4, 29, 23, 45058 }, // ̉
-    { 10, 9, 6, -5, 28, 23, 45081 }, // ̊
-    { 13, 9, 8, -6, 28, 30, 45104 }, // ̋
-    { 12, 8, 8, -5, 28, 24, 45134 }, // ̌
-    { 11, 9, 5, -7, 28, 25, 45158 }, // ̏
-    { 11, 7, 6, -6, 26, 20, 45183 }, // ̑
-    { 7, 10, 5, -3, 29, 18, 45203 }, // ̒
-    { 7, 9, 5, -3, 29, 16, 45221 }, // ̓
-    { 6, 9, 3, -4, 29, 14, 45237 }, // ̔
-    { 6, 9, 4, -3, 29, 14, 45251 }, // ̕
-    { 6, 8, 4, -3, 21, 12, 45265 }, // ̛
-    { 6, 6, 4, -3, -2, 9, 45277 }, // ̣
-    { 12, 5, 7, -6, -3, 15, 45286 }, // ̤
-    { 8, 8, 5, -4, -1, 16, 45301 }, // ̥
-    { 7, 8, 4, -4, -1, 14, 45317 }, // ̦
-    { 8, 8, 5, -4, -1, 16, 45331 }, // ̧
-    { 8, 8, 5, -4, 1, 16, 45347 }, // ̨
-    { 6, 9, 9, -1, -1, 14, 45363 }, // ̩
-    { 13, 8, 7, -7, -1, 26, 45377 }, // ̭
-    { 12, 6, 7, -6, -2, 18, 45403 }, // ̮
-    { 12, 7, 7, -6, -2, 21, 45421 }, // ̰
-    { 12, 4, 7, -6, -3, 12, 45442 }, // ̱
-    { 12, 7, 7, -6, 26, 21, 45454 }, // ͂
-    { 13, 14, 7, -7, 34, 46, 45475 }, // ̈́
-    { 6, 7, 5, -2, -2, 11, 45521 }, // ͅ
-    { 26, 24, 25, -2, 24, 156, 45532 }, // Α
-    { 22, 25, 21, -2, 24, 138, 45688 }, // Β
-    { 23, 23, 22, -2, 23, 133, 45826 }, // Γ
-    { 22, 24, 23, -1, 24, 132, 45959 }, // Δ
-    { 23, 23, 22, -2, 23, 133, 46091 }, // Ε
-    { 21, 24, 21, -1, 23, 126, 46224 }, // Ζ
-    { 30, 23, 29, -2, 23, 173, 46350 }, // Η
-    { 24, 25, 25, 0, 24, 150, 46523 }, // Θ
-    { 17, 23, 16, -2, 23, 98, 46673 }, // Ι
-    { 27, 24, 26, -2, 23, 162, 46771 }, // Κ
-    { 25, 24, 24, -2, 24, 150, 46933 }, // Λ
-    { 33, 23, 31, -3, 23, 190, 47083 }, // Μ
-    { 29, 24, 29, -1, 23, 174, 47273 }, // Ν
-    { 23, 23, 23, -1, 23, 133, 47447 }, // Ξ
-    { 24, 25, 25, 0, 24, 150, 47580 }, // Ο
-    { 29, 23, 28, -2, 23, 167, 47730 }, // Π
-    { 23, 24, 22, -2, 24, 138, 47897 }, // Ρ
-    { 22, 24, 22, -1, 23, 132, 48035 }, // Σ
-    { 22, 23, 25, 2, 23, 127, 48167 }, // Τ
-    { 23, 24, 25, 1, 24, 138, 48294 }, // Υ
-    { 24, 25, 25, 0, 24, 150, 48432 }, // Φ
-    { 27, 23, 25, -3, 23, 156, 48582 }, // Χ
-    { 27, 24, 30, 2, 24, 162, 48738 }, // Ψ
-    { 26, 24, 28, -1, 24, 156, 48900 }, // Ω
-    { 20, 19, 21, 0, 18, 95, 49056 }, // α
-    { 19, 34, 19, -1, 26, 162, 49151 }, // β
-    { 17, 26, 18, 0, 18, 111, 49313 }, // γ
-    { 19, 27, 20, 0, 26, 129, 49424 }, // δ
-    { 16, 19, 17, 0, 18, 76, 49553 }, // ε
-    { 16, 35, 18, 1, 28, 140, 49629 }, // ζ
-    { 17, 26, 19, 1, 18, 111, 49769 }, // η
-    { 19, 27, 21, 1, 26, 129, 49880 }, // θ
-    { 9, 19, 11, 1, 18, 43, 50009 }, // ι
-    { 19, 19, 21, 1, 18, 91, 50052 }, // κ
-    { 20, 27, 19, -2, 26, 135, 50143 }, // λ
-    { 22, 26, 21, -2, 18, 143, 50278 }, // μ
-    { 17, 19, 18, 0, 18, 81, 50421 }, // ν
-    { 15, 35, 17, 1, 28, 132, 50502 }, // ξ
-    { 17, 19, 18, 0, 18, 81, 50634 }, // ο
-    { 22, 19, 23, 0, 18, 105, 50715 }, // π
-    { 19, 26, 19, -1, 18, 124, 50820 }, // ρ
-    { 15, 25, 16, 0, 18, 94, 50944 }, // ς
-    { 21, 19, 22, 0, 18, 100, 51038 }, // σ
-    { 17, 19, 19, 1, 18, 81, 51138 }, // τ
-    { 17, 19, 19, 1, 18, 81, 51219 }, // υ
-    { 23, 26, 24, 0, 18, 150, 51300 }, // φ
-    { 21, 26, 20, -2, 18, 137, 51450 }, // χ
-    { 24, 32, 26, 1, 24, 192, 51587 }, // ψ
-    { 24, 19, 25, 0, 18, 114, 51779 }, // ω
-    { 26, 32, 25, -2, 24, 208, 51893 }, // Ạ
-    { 20, 26, 21, 0, 18, 130, 52101 }, // ạ
-    { 26, 34, 25, -2, 34, 221, 52231 }, // Ả
-    { 20, 30, 21, 0, 29, 150, 52452 }, // ả
-    { 27, 35, 26, -2, 35, 237, 52602 }, // Ấ
-    { 22, 34, 23, 0, 33, 187, 52839 }, // ấ
-    { 26, 35, 25, -2, 35, 228, 53026 }, // Ầ
-    { 20, 34, 21, 0, 33, 170, 53254 }, // ầ
-    { 27, 35, 26, -2, 35, 237, 53424 }, // Ẩ
-    { 23, 34, 24, 0, 33, 196, 53661 }, // ẩ
-    { 26, 35, 25, -2, 35, 228, 53857 }, // Ẫ
-    { 20, 33, 21, 0, 32, 165, 54085 }, // ẫ
-    { 26, 40, 25, -2, 32, 260, 54250 }, // Ậ
-    { 20, 36, 21, 0, 28, 180, 54510 }, // ậ
-    { 26, 35, 25, -2, 35, 228, 54690 }, // Ắ
-    { 20, 34, 21, 0, 33, 170, 54918 }, // ắ
-    { 26, 35, 25, -2, 35, 228, 55088 }, // Ằ
-    { 20, 33, 21, 0, 32, 165, 55316 }, // ằ
-    { 26, 35, 25, -2, 35, 228, 55481 }, // Ẳ
-    { 20, 34, 21, 0, 33, 170, 55709 }, // ẳ
-    { 26, 35, 25, -2, 35, 228, 55879 }, // Ẵ
-    { 20, 32, 21, 0, 31, 160, 56107 }, // ẵ
-    { 26, 40, 25, -2, 32, 260, 56267 }, // Ặ
-    { 20, 34, 21, 0, 26, 170, 56527 }, // ặ
-    { 23, 31, 22, -2, 23, 179, 56697 }, // Ẹ
-    { 15, 26, 16, 0, 18, 98, 56876 }, // ẹ
-    { 23, 34, 22, -2, 34, 196, 56974 }, // Ẻ
-    { 16, 30, 17, 0, 29, 120, 57170 }, // ẻ
-    { 23, 32, 22, -2, 32, 184, 57290 }, // Ẽ
-    { 17, 27, 18, 0, 26, 115, 57474 }, // ẽ
-    { 26, 35, 25, -2, 35, 228, 57589 }, // Ế
-    { 21, 34, 22, 0, 33, 179, 57817 }, // ế
-    { 23, 35, 22, -2, 35, 202, 57996 }, // Ề
-    { 17, 34, 18, 0, 33, 145, 58198 }, // ề
-    { 26, 35, 25, -2, 35, 228, 58343 }, // Ể
-    { 21, 34, 22, 0, 33, 179, 58571 }, // ể
-    { 23, 35, 22, -2, 35, 202, 58750 }, // Ễ
-    { 17, 33, 18, 0, 32, 141, 58952 }, // ễ
-    { 23, 40, 22, -2, 32, 230, 59093 }, // Ệ
-    { 16, 36, 17, 0, 28, 144, 59323 }, // ệ
-    { 17, 34, 16, -2, 34, 145, 59467 }, // Ỉ
-    { 12, 30, 14, 1, 29, 90, 59612 }, // ỉ
-    { 17, 31, 16, -2, 23, 132, 59702 }, // Ị
-    { 11, 34, 12, 0, 26, 94, 59834 }, // ị
-    { 24, 32, 25, 0, 24, 192, 59928 }, // Ọ
-    { 17, 26, 18, 0, 18, 111, 60120 }, // ọ
-    { 24, 35, 25, 0, 34, 210, 60231 }, // Ỏ
-    { 17, 30, 18, 0, 29, 128, 60441 }, // ỏ
-    { 25, 36, 26, 0, 35, 225, 60569 }, // Ố
-    { 22, 34, 23, 0, 33, 187, 60794 }, // ố
-    { 24, 36, 25, 0, 35, 216, 60981 }, // Ồ
-    { 19, 34, 20, 0, 33, 162, 61197 }, // ồ
-    { 25, 36, 26, 0, 35, 225, 61359 }, // Ổ
-    { 23, 34, 24, 0, 33, 196, 61584 }, // ổ
-    { 24, 36, 25, 0, 35, 216, 61780 }, // Ỗ
-    { 18, 33, 19, 0, 32, 149, 61996 }, // ỗ
-    { 24, 40, 25, 0, 32, 240, 62145 }, // Ộ
-    { 18, 36, 19, 0, 28, 162, 62385 }, // ộ
-    { 27, 34, 28, 0, 33, 230, 62547 }, // Ớ
-    { 21, 30, 22, 0, 29, 158, 62777 }, // ớ
-    { 27, 34, 28, 0, 33, 230, 62935 }, // Ờ
-    { 21, 29, 22, 0, 28, 153, 63165 }, // ờ
-    { 27, 35, 28, 0, 34, 237, 63318 }, // Ở
-    { 21, 30, 22, 0, 29, 158, 63555 }, // ở
-    { 27, 33, 28, 0, 32, 223, 63713 }, // Ỡ
-    { 21, 27, 22, 0, 26, 142, 63936 }, // ỡ
-    { 27, 36, 28, 0, 28, 243, 64078 }, // Ợ
-    { 21, 29, 22, 0, 21, 153, 64321 }, // ợ
-    { 26, 31, 29, 2, 23, 202, 64474 }, // Ụ
-    { 20, 26, 21, 0, 18, 130, 64676 }, // ụ
-    { 26, 35, 29, 2, 34, 228, 64806 }, // Ủ
-    { 20, 30, 21, 0, 29, 150, 65034 }, // ủ
-    { 29, 34, 32, 2, 33, 247, 65184 }, // Ứ
-    { 24, 30, 25, 0, 29, 180, 65431 }, // ứ
-    { 29, 34, 32, 2, 33, 247, 65611 }, // Ừ
-    { 24, 29, 25, 0, 28, 174, 65858 }, // ừ
-    { 29, 35, 32, 2, 34, 254, 66032 }, // Ử
-    { 24, 30, 25, 0, 29, 180, 66286 }, // ử
-    { 29, 33, 32, 2, 32, 240, 66466 }, // Ữ
-    { 24, 27, 25, 0, 26, 162, 66706 }, // ữ
-    { 29, 36, 32, 2, 28, 261, 66868 }, // Ự
-    { 24, 29, 25, 0, 21, 174, 67129 }, // ự
-    { 23, 33, 25, 1, 33, 190, 67303 }, // Ỳ
-    { 22, 36, 18, -5, 28, 198, 67493 }, // ỳ
-    { 23, 31, 25, 1, 23, 179, 67691 }, // Ỵ
-    { 22, 26, 18, -5, 18, 143, 67870 }, // ỵ
-    { 23, 34, 25, 1, 34, 196, 68013 }, // Ỷ
-    { 22, 37, 18, -5, 29, 204, 68209 }, // ỷ
-    { 23, 32, 25, 1, 32, 184, 68413 }, // Ỹ
-    { 22, 34, 18, -5, 26, 187, 68597 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 68784 }, //  
-    { 0, 0, 33, 0, 0, 0, 68784 }, //  
-    { 0, 0, 17, 0, 0, 0, 68784 }, //  
-    { 0, 0, 33, 0, 0, 0, 68784 }, //  
-    { 0, 0, 11, 0, 0, 0, 68784 }, //  
-    { 0, 0, 8, 0, 0, 0, 68784 }, //  
-    { 0, 0, 5, 0, 0, 0, 68784 }, //  
-    { 0, 0, 21, 0, 0, 0, 68784 }, //  
-    { 0, 0, 10, 0, 0, 0, 68784 }, //  
-    { 0, 0, 7, 0, 0, 0, 68784 }, //  
-    { 0, 0, 2, 0, 0, 0, 68784 }, //  
-    { 0, 0, 1, 0, 0, 0, 68784 }, // ​
-    { 2, 28, 2, -1, 20, 14, 68784 }, // ‌
-    { 8, 30, 5, -4, 22, 60, 68798 }, // ‍
-    { 12, 31, 7, -6, 23, 93, 68858 }, // ‎
-    { 12, 31, 7, -6, 23, 93, 68951 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 69044 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 69058 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 69072 }, // ‒
-    { 17, 5, 18, 0, 11, 22, 69089 }, // –
-    { 33, 5, 34, 0, 11, 42, 69111 }, // —
-    { 33, 5, 34, 0, 11, 42, 69153 }, // ―
-    { 12, 34, 17, 2, 26, 102, 69195 }, // ‖
-    { 17, 9, 18, 0, -1, 39, 69297 }, // ‗
-    { 8, 11, 11, 2, 25, 22, 69336 }, // ‘
-    { 8, 11, 11, 2, 25, 22, 69358 }, // ’
-    { 8, 11, 10, 0, 5, 22, 69380 }, // ‚
-    { 8, 12, 10, 1, 25, 24, 69402 }, // ‛
-    { 15, 11, 18, 2, 25, 42, 69426 }, // “
-    { 15, 12, 18, 2, 25, 45, 69468 }, // ”
-    { 14, 11, 17, 0, 5, 39, 69513 }, // „
-    { 15, 12, 17, 1, 25, 45, 69552 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 69597 }, // †
-    { 17, 26, 17, -1, 24, 111, 69680 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 69791 }, // •
-    { 12, 12, 21, 4, 17, 36, 69807 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 69843 }, // ․
-    { 15, 6, 17, 1, 5, 23, 69854 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 69877 }, // …
-    { 7, 6, 10, 1, 12, 11, 69921 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 69932 }, //  
-    { 0, 0, 1, 0, 0, 0, 69932 }, //  
-    { 12, 31, 7, -6, 23, 93, 69932 }, // ‪
-    { 12, 31, 7, -6, 23, 93, 70025 }, // ‫
-    { 10, 31, 6, -5, 23, 78, 70118 }, // ‬
-    { 14, 31, 8, -7, 23, 109, 70196 }, // ‭
-    { 14, 31, 8, -7, 23, 109, 70305 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 70414 }, //  
-    { 44, 28, 46, 1, 25, 308, 70414 }, // ‰
-    { 8, 11, 9, 0, 23, 22, 70722 }, // ′
-    { 15, 11, 16, 0, 23, 42, 70744 }, // ″
-    { 23, 11, 24, 0, 23, 64, 70786 }, // ‴
-    { 8, 11, 9, 0, 23, 22, 70850 }, // ‵
-    { 15, 11, 16, 0, 23, 42, 70872 }, // ‶
-    { 22, 11, 23, 0, 23, 61, 70914 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 70975 }, // ‸
-    { 10, 13, 12, 1, 15, 33, 71000 }, // ‹
-    { 11, 13, 12, 0, 15, 36, 71033 }, // ›
-    { 21, 23, 22, 0, 22, 121, 71069 }, // ※
-    { 20, 26, 22, 1, 25, 130, 71190 }, // ‼
-    { 17, 4, 18, 0, 28, 17, 71320 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 71337 }, // ⁃
-    { 21, 28, 16, -6, 25, 147, 71347 }, // ⁄
-    { 24, 25, 27, 2, 24, 150, 71494 }, // ⁇
-    { 22, 26, 25, 2, 25, 143, 71644 }, // ⁈
-    { 22, 26, 24, 1, 25, 143, 71787 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 71930 }, // ⁓
-    { 30, 11, 31, 0, 23, 83, 71965 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 72048 }, //  
-    { 0, 0, 1, 0, 0, 0, 72048 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 72048 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 72048 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 72048 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 72048 }, // ⁤
-    { 14, 17, 15, 0, 28, 60, 72048 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 72108 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 72164 }, // ⁵
-    { 14, 17, 16, 1, 28, 60, 72216 }, // ⁶
-    { 13, 16, 16, 2, 27, 52, 72276 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 72328 }, // ⁸
-    { 14, 17, 15, 0, 28, 60, 72384 }, // ⁹
-    { 13, 13, 19, 3, 24, 43, 72444 }, // ⁿ
-    { 14, 16, 15, 0, 11, 56, 72487 }, // ₀
-    { 11, 16, 15, 1, 11, 44, 72543 }, // ₁
-    { 14, 16, 15, 0, 11, 56, 72587 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 72643 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 72691 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 72747 }, // ₅
-    { 14, 16, 16, 1, 11, 56, 72799 }, // ₆
-    { 13, 16, 16, 2, 11, 52, 72855 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 72907 }, // ₈
-    { 14, 16, 15, 0, 11, 56, 72959 }, // ₉
-    { 22, 23, 22, -1, 23, 127, 73015 }, // ₣
-    { 22, 24, 22, -1, 23, 132, 73142 }, // ₤
-    { 43, 24, 44, 0, 23, 258, 73274 }, // ₧
-    { 23, 24, 23, -1, 23, 138, 73532 }, // €
-    { 21, 15, 33, 6, 19, 79, 73670 }, // ←
-    { 15, 21, 33, 9, 22, 79, 73749 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 73828 }, // →
-    { 15, 21, 33, 9, 22, 79, 73907 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 73986 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 74065 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 74152 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 74239 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 74326 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 74413 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 74499 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 74599 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 74699 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 74799 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 74899 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 74989 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 75127 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 75249 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 75347 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 75516 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 75648 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 75774 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 75907 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 76074 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 76189 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 76322 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 76489 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 76604 }, // ∏
-    { 21, 29, 23, 1, 23, 153, 76793 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 76946 }, // −
-    { 21, 26, 20, -2, 24, 137, 76961 }, // ∕
-    { 16, 26, 18, 1, 24, 104, 77098 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 77202 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 77266 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 77305 }, // ∙
-    { 22, 31, 22, -1, 27, 171, 77316 }, // √
-    { 17, 13, 21, 2, 17, 56, 77487 }, // ∝
-    { 21, 13, 22, 0, 17, 69, 77543 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 77612 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 77733 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 77877 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 77920 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 78022 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 78155 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 78288 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 78402 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 78516 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 78678 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 78793 }, // ∵
-    { 8, 18, 10, 1, 20, 36, 78908 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 78944 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 79059 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 79094 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 79184 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 79244 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 79306 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 79366 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 79442 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 79517 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 79596 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 79704 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 79812 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 79927 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 80094 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 80261 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 80382 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 80503 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 80660 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 80817 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 80974 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 81131 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 81241 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 81252 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 81296 }, // �
+    { 11, 26, 13, 1, 25, 44, 0 }, // !
+    { 13, 12, 15, 1, 24, 36, 44 }, // "
+    { 21, 21, 22, 0, 19, 86, 80 }, // #
+    { 18, 34, 21, 1, 27, 100, 166 }, // $
+    { 30, 28, 32, 1, 25, 134, 266 }, // %
+    { 27, 27, 29, 1, 25, 115, 400 }, // &
+    { 7, 12, 9, 1, 24, 19, 515 }, // '
+    { 15, 34, 17, 1, 27, 70, 534 }, // (
+    { 15, 34, 14, -2, 27, 69, 604 }, // )
+    { 13, 12, 15, 1, 25, 32, 673 }, // *
+    { 15, 16, 21, 3, 19, 41, 705 }, // +
+    { 10, 11, 10, -2, 5, 18, 746 }, // ,
+    { 11, 5, 13, 1, 11, 18, 764 }, // -
+    { 7, 6, 10, 1, 5, 10, 782 }, // .
+    { 21, 26, 20, -2, 24, 57, 792 }, // /
+    { 20, 24, 21, 0, 23, 81, 849 }, // 0
+    { 15, 24, 21, 2, 24, 58, 930 }, // 1
+    { 20, 23, 21, 0, 23, 68, 988 }, // 2
+    { 19, 24, 21, 0, 23, 70, 1056 }, // 3
+    { 20, 23, 21, 0, 23, 66, 1126 }, // 4
+    { 19, 24, 21, 1, 23, 68, 1192 }, // 5
+    { 20, 24, 22, 1, 23, 77, 1260 }, // 6
+    { 19, 24, 23, 3, 23, 68, 1337 }, // 7
+    { 19, 24, 21, 1, 23, 77, 1405 }, // 8
+    { 21, 24, 21, -1, 23, 78, 1482 }, // 9
+    { 9, 19, 11, 1, 18, 23, 1560 }, // :
+    { 12, 24, 11, -2, 18, 34, 1583 }, // ;
+    { 15, 16, 21, 3, 19, 38, 1617 }, // <
+    { 15, 10, 21, 3, 16, 42, 1655 }, // =
+    { 15, 16, 21, 3, 19, 40, 1697 }, // >
+    { 12, 25, 15, 2, 24, 47, 1737 }, // ?
+    { 31, 30, 33, 1, 23, 154, 1784 }, // @
+    { 26, 24, 25, -2, 24, 91, 1938 }, // A
+    { 22, 25, 21, -2, 24, 87, 2029 }, // B
+    { 21, 25, 23, 1, 24, 77, 2116 }, // C
+    { 26, 25, 25, -2, 24, 97, 2193 }, // D
+    { 23, 23, 22, -2, 23, 76, 2290 }, // E
+    { 22, 23, 21, -2, 23, 71, 2366 }, // F
+    { 22, 25, 24, 1, 24, 90, 2437 }, // G
+    { 30, 23, 29, -2, 23, 100, 2527 }, // H
+    { 17, 23, 16, -2, 23, 55, 2627 }, // I
+    { 21, 30, 16, -6, 23, 77, 2682 }, // J
+    { 27, 24, 26, -2, 23, 97, 2759 }, // K
+    { 20, 23, 19, -2, 23, 64, 2856 }, // L
+    { 33, 23, 31, -3, 23, 124, 2920 }, // M
+    { 29, 24, 29, -1, 23, 108, 3044 }, // N
+    { 24, 25, 25, 0, 24, 100, 3152 }, // O
+    { 23, 24, 22, -2, 24, 82, 3252 }, // P
+    { 28, 32, 29, 0, 24, 130, 3334 }, // Q
+    { 24, 25, 23, -2, 24, 97, 3464 }, // R
+    { 19, 25, 19, -1, 24, 74, 3561 }, // S
+    { 22, 23, 25, 2, 23, 77, 3635 }, // T
+    { 26, 24, 29, 2, 23, 90, 3712 }, // U
+    { 25, 24, 28, 2, 23, 82, 3802 }, // V
+    { 33, 24, 36, 2, 23, 122, 3884 }, // W
+    { 27, 23, 25, -3, 23, 93, 4006 }, // X
+    { 23, 23, 25, 1, 23, 77, 4099 }, // Y
+    { 21, 24, 21, -1, 23, 76, 4176 }, // Z
+    { 15, 32, 14, -2, 26, 65, 4252 }, // [
+    { 15, 26, 17, 1, 24, 54, 4317 }, // <backslash>
+    { 15, 32, 14, -2, 26, 65, 4371 }, // ]
+    { 17, 17, 21, 2, 22, 44, 4436 }, // ^
+    { 17, 4, 18, 0, -1, 22, 4480 }, // _
+    { 7, 9, 20, 7, 28, 12, 4502 }, // `
+    { 20, 19, 21, 0, 18, 70, 4514 }, // a
+    { 18, 27, 19, 0, 26, 80, 4584 }, // b
+    { 15, 19, 16, 0, 18, 48, 4664 }, // c
+    { 20, 27, 21, 0, 26, 88, 4712 }, // d
+    { 15, 19, 16, 0, 18, 55, 4800 }, // e
+    { 24, 34, 19, -6, 26, 99, 4855 }, // f
+    { 23, 26, 21, -3, 18, 91, 4954 }, // g
+    { 19, 27, 20, 0, 26, 84, 5045 }, // h
+    { 10, 27, 12, 1, 26, 49, 5129 }, // i
+    { 19, 34, 13, -7, 26, 77, 5178 }, // j
+    { 17, 27, 18, 0, 26, 79, 5255 }, // k
+    { 10, 27, 12, 1, 26, 47, 5334 }, // l
+    { 27, 19, 29, 1, 18, 103, 5381 }, // m
+    { 19, 19, 21, 1, 18, 71, 5484 }, // n
+    { 17, 19, 18, 0, 18, 58, 5555 }, // o
+    { 21, 26, 19, -3, 18, 85, 5613 }, // p
+    { 19, 26, 20, 0, 18, 87, 5698 }, // q
+    { 16, 18, 18, 1, 18, 51, 5785 }, // r
+    { 15, 19, 15, -1, 18, 50, 5836 }, // s
+    { 15, 23, 16, 0, 22, 53, 5886 }, // t
+    { 20, 19, 21, 0, 18, 71, 5939 }, // u
+    { 17, 19, 18, 0, 18, 56, 6010 }, // v
+    { 25, 19, 26, 0, 18, 88, 6066 }, // w
+    { 21, 19, 21, -1, 18, 65, 6154 }, // x
+    { 22, 26, 18, -5, 18, 86, 6219 }, // y
+    { 17, 19, 17, -1, 18, 61, 6305 }, // z
+    { 15, 33, 17, 1, 27, 68, 6366 }, // {
+    { 11, 30, 11, -1, 26, 45, 6434 }, // |
+    { 15, 33, 14, -2, 27, 68, 6479 }, // }
+    { 17, 8, 21, 2, 15, 25, 6547 }, // ~
+    { 0, 0, 7, 0, 0, 0, 6572 }, //  
+    { 11, 26, 11, -1, 18, 44, 6572 }, // ¡
+    { 17, 33, 21, 2, 26, 89, 6616 }, // ¢
+    { 22, 24, 22, -1, 23, 83, 6705 }, // £
+    { 21, 16, 22, 0, 19, 60, 6788 }, // ¤
+    { 23, 23, 25, 1, 23, 88, 6848 }, // ¥
+    { 11, 30, 11, -1, 26, 43, 6936 }, // ¦
+    { 17, 26, 17, -1, 23, 79, 6979 }, // §
+    { 12, 6, 20, 4, 26, 16, 7058 }, // ¨
+    { 25, 25, 26, 0, 24, 118, 7074 }, // ©
+    { 14, 17, 16, 1, 24, 52, 7192 }, // ª
+    { 19, 13, 21, 1, 15, 43, 7244 }, // «
+    { 15, 9, 21, 3, 16, 20, 7287 }, // ¬
+    { 11, 5, 13, 1, 11, 18, 7307 }, // ­
+    { 19, 18, 20, 0, 26, 85, 7325 }, // ®
+    { 12, 4, 20, 4, 24, 16, 7410 }, // ¯
+    { 13, 12, 17, 2, 23, 34, 7426 }, // °
+    { 15, 21, 21, 3, 20, 52, 7460 }, // ±
+    { 14, 16, 15, 0, 28, 39, 7512 }, // ²
+    { 12, 17, 15, 1, 28, 38, 7551 }, // ³
+    { 7, 10, 20, 7, 29, 13, 7589 }, // ´
+    { 22, 26, 21, -2, 18, 88, 7602 }, // µ
+    { 22, 28, 22, -1, 23, 103, 7690 }, // ¶
+    { 6, 6, 10, 2, 12, 8, 7793 }, // ·
+    { 8, 8, 20, 6, -1, 15, 7801 }, // ¸
+    { 11, 16, 15, 1, 28, 34, 7816 }, // ¹
+    { 13, 17, 15, 1, 24, 45, 7850 }, // º
+    { 19, 13, 20, 0, 15, 42, 7895 }, // »
+    { 34, 28, 36, 1, 25, 123, 7937 }, // ¼
+    { 34, 28, 36, 1, 25, 128, 8060 }, // ½
+    { 34, 28, 36, 1, 25, 130, 8188 }, // ¾
+    { 11, 25, 13, 0, 18, 50, 8318 }, // ¿
+    { 26, 33, 25, -2, 33, 113, 8368 }, // À
+    { 26, 33, 25, -2, 33, 115, 8481 }, // Á
+    { 26, 32, 25, -2, 32, 114, 8596 }, // Â
+    { 26, 32, 25, -2, 32, 114, 8710 }, // Ã
+    { 26, 31, 25, -2, 31, 112, 8824 }, // Ä
+    { 26, 33, 25, -2, 33, 121, 8936 }, // Å
+    { 34, 23, 32, -3, 23, 106, 9057 }, // Æ
+    { 21, 33, 23, 1, 24, 97, 9163 }, // Ç
+    { 23, 33, 22, -2, 33, 100, 9260 }, // È
+    { 23, 33, 22, -2, 33, 99, 9360 }, // É
+    { 23, 32, 22, -2, 32, 101, 9459 }, // Ê
+    { 23, 31, 22, -2, 31, 97, 9560 }, // Ë
+    { 17, 33, 16, -2, 33, 74, 9657 }, // Ì
+    { 17, 33, 16, -2, 33, 76, 9731 }, // Í
+    { 18, 32, 17, -2, 32, 76, 9807 }, // Î
+    { 18, 31, 17, -2, 31, 74, 9883 }, // Ï
+    { 26, 25, 25, -2, 24, 105, 9957 }, // Ð
+    { 29, 33, 29, -1, 32, 136, 10062 }, // Ñ
+    { 24, 34, 25, 0, 33, 123, 10198 }, // Ò
+    { 24, 34, 25, 0, 33, 123, 10321 }, // Ó
+    { 24, 33, 25, 0, 32, 125, 10444 }, // Ô
+    { 24, 33, 25, 0, 32, 124, 10569 }, // Õ
+    { 24, 32, 25, 0, 31, 121, 10693 }, // Ö
+    { 15, 15, 21, 3, 19, 40, 10814 }, // ×
+    { 27, 25, 27, -1, 24, 112, 10854 }, // Ø
+    { 26, 34, 29, 2, 33, 114, 10966 }, // Ù
+    { 26, 34, 29, 2, 33, 113, 11080 }, // Ú
+    { 26, 33, 29, 2, 32, 118, 11193 }, // Û
+    { 26, 32, 29, 2, 31, 112, 11311 }, // Ü
+    { 23, 33, 25, 1, 33, 98, 11423 }, // Ý
+    { 22, 23, 21, -2, 23, 77, 11521 }, // Þ
+    { 27, 34, 22, -6, 26, 130, 11598 }, // ß
+    { 20, 29, 21, 0, 28, 91, 11728 }, // à
+    { 20, 30, 21, 0, 29, 92, 11819 }, // á
+    { 20, 29, 21, 0, 28, 96, 11911 }, // â
+    { 20, 27, 21, 0, 26, 92, 12007 }, // ã
+    { 20, 27, 21, 0, 26, 92, 12099 }, // ä
+    { 20, 29, 21, 0, 28, 99, 12191 }, // å
+    { 26, 19, 27, 0, 18, 91, 12290 }, // æ
+    { 15, 27, 16, 0, 18, 66, 12381 }, // ç
+    { 15, 29, 16, 0, 28, 73, 12447 }, // è
+    { 17, 30, 18, 0, 29, 74, 12520 }, // é
+    { 16, 29, 17, 0, 28, 78, 12594 }, // ê
+    { 17, 27, 18, 0, 26, 74, 12672 }, // ë
+    { 9, 29, 11, 1, 28, 50, 12746 }, // ì
+    { 13, 30, 15, 1, 29, 55, 12796 }, // í
+    { 12, 29, 14, 1, 28, 59, 12851 }, // î
+    { 13, 27, 15, 1, 26, 55, 12910 }, // ï
+    { 18, 28, 19, 0, 27, 82, 12965 }, // ð
+    { 19, 27, 21, 1, 26, 91, 13047 }, // ñ
+    { 17, 29, 18, 0, 28, 76, 13138 }, // ò
+    { 18, 30, 19, 0, 29, 79, 13214 }, // ó
+    { 18, 29, 19, 0, 28, 82, 13293 }, // ô
+    { 18, 27, 19, 0, 26, 78, 13375 }, // õ
+    { 18, 27, 19, 0, 26, 76, 13453 }, // ö
+    { 15, 16, 21, 3, 19, 43, 13529 }, // ÷
+    { 22, 19, 21, -2, 18, 70, 13572 }, // ø
+    { 20, 29, 21, 0, 28, 92, 13642 }, // ù
+    { 20, 30, 21, 0, 29, 90, 13734 }, // ú
+    { 20, 29, 21, 0, 28, 96, 13824 }, // û
+    { 20, 27, 21, 0, 26, 90, 13920 }, // ü
+    { 22, 37, 18, -5, 29, 108, 14010 }, // ý
+    { 22, 34, 19, -4, 26, 109, 14118 }, // þ
+    { 22, 34, 18, -5, 26, 105, 14227 }, // ÿ
+    { 26, 30, 25, -2, 30, 113, 14332 }, // Ā
+    { 20, 25, 21, 0, 24, 90, 14445 }, // ā
+    { 26, 32, 25, -2, 32, 113, 14535 }, // Ă
+    { 20, 27, 21, 0, 26, 91, 14648 }, // ă
+    { 26, 31, 25, -2, 24, 110, 14739 }, // Ą
+    { 20, 25, 21, 0, 18, 88, 14849 }, // ą
+    { 21, 34, 23, 1, 33, 97, 14937 }, // Ć
+    { 17, 30, 18, 0, 29, 66, 15034 }, // ć
+    { 21, 33, 23, 1, 32, 101, 15100 }, // Ĉ
+    { 16, 29, 17, 0, 28, 70, 15201 }, // ĉ
+    { 21, 33, 23, 1, 32, 93, 15271 }, // Ċ
+    { 15, 27, 16, 0, 26, 63, 15364 }, // ċ
+    { 21, 33, 23, 1, 32, 99, 15427 }, // Č
+    { 18, 29, 19, 0, 28, 73, 15526 }, // č
+    { 26, 33, 25, -2, 32, 123, 15599 }, // Ď
+    { 25, 27, 26, 0, 26, 111, 15722 }, // ď
+    { 26, 25, 25, -2, 24, 105, 15833 }, // Đ
+    { 22, 27, 23, 0, 26, 95, 15938 }, // đ
+    { 23, 30, 22, -2, 30, 98, 16033 }, // Ē
+    { 17, 25, 18, 0, 24, 74, 16131 }, // ē
+    { 23, 32, 22, -2, 32, 99, 16205 }, // Ĕ
+    { 17, 27, 18, 0, 26, 75, 16304 }, // ĕ
+    { 23, 32, 22, -2, 32, 94, 16379 }, // Ė
+    { 15, 27, 16, 0, 26, 70, 16473 }, // ė
+    { 23, 30, 22, -2, 23, 95, 16543 }, // Ę
+    { 15, 25, 16, 0, 18, 71, 16638 }, // ę
+    { 23, 32, 22, -2, 32, 100, 16709 }, // Ě
+    { 18, 29, 19, 0, 28, 82, 16809 }, // ě
+    { 22, 33, 24, 1, 32, 112, 16891 }, // Ĝ
+    { 23, 36, 21, -3, 28, 119, 17003 }, // ĝ
+    { 22, 33, 24, 1, 32, 112, 17122 }, // Ğ
+    { 23, 34, 21, -3, 26, 112, 17234 }, // ğ
+    { 22, 33, 24, 1, 32, 107, 17346 }, // Ġ
+    { 23, 34, 21, -3, 26, 110, 17453 }, // ġ
+    { 22, 33, 24, 1, 24, 110, 17563 }, // Ģ
+    { 23, 37, 21, -3, 29, 117, 17673 }, // ģ
+    { 30, 32, 29, -2, 32, 129, 17790 }, // Ĥ
+    { 19, 35, 20, 0, 34, 106, 17919 }, // ĥ
+    { 30, 23, 29, -2, 23, 106, 18025 }, // Ħ
+    { 19, 27, 20, 0, 26, 92, 18131 }, // ħ
+    { 18, 32, 17, -2, 32, 75, 18223 }, // Ĩ
+    { 13, 27, 15, 1, 26, 57, 18298 }, // ĩ
+    { 18, 30, 17, -2, 30, 75, 18355 }, // Ī
+    { 13, 25, 15, 1, 24, 55, 18430 }, // ī
+    { 17, 32, 16, -2, 32, 75, 18485 }, // Ĭ
+    { 13, 27, 15, 1, 26, 55, 18560 }, // ĭ
+    { 17, 30, 16, -2, 23, 72, 18615 }, // Į
+    { 10, 33, 12, 1, 26, 60, 18687 }, // į
+    { 17, 32, 16, -2, 32, 70, 18747 }, // İ
+    { 9, 19, 11, 1, 18, 36, 18817 }, // ı
+    { 30, 30, 29, -2, 23, 123, 18853 }, // Ĳ
+    { 22, 34, 24, 1, 26, 114, 18976 }, // ĳ
+    { 22, 39, 17, -6, 32, 106, 19090 }, // Ĵ
+    { 21, 36, 15, -7, 28, 87, 19196 }, // ĵ
+    { 27, 32, 26, -2, 23, 119, 19283 }, // Ķ
+    { 17, 35, 18, 0, 26, 96, 19402 }, // ķ
+    { 18, 19, 20, 1, 18, 65, 19498 }, // ĸ
+    { 20, 33, 19, -2, 33, 87, 19563 }, // Ĺ
+    { 12, 35, 14, 1, 34, 62, 19650 }, // ĺ
+    { 20, 32, 19, -2, 23, 83, 19712 }, // Ļ
+    { 12, 35, 12, -1, 26, 62, 19795 }, // ļ
+    { 22, 26, 21, -2, 26, 77, 19857 }, // Ľ
+    { 15, 27, 17, 1, 26, 68, 19934 }, // ľ
+    { 21, 23, 20, -2, 23, 70, 20002 }, // Ŀ
+    { 14, 27, 16, 1, 26, 62, 20072 }, // ŀ
+    { 20, 23, 19, -2, 23, 71, 20134 }, // Ł
+    { 13, 27, 13, -1, 26, 54, 20205 }, // ł
+    { 29, 34, 29, -1, 33, 136, 20259 }, // Ń
+    { 19, 30, 21, 1, 29, 92, 20395 }, // ń
+    { 29, 32, 29, -1, 23, 130, 20487 }, // Ņ
+    { 19, 27, 21, 1, 18, 88, 20617 }, // ņ
+    { 29, 33, 29, -1, 32, 137, 20705 }, // Ň
+    { 19, 29, 21, 1, 28, 97, 20842 }, // ň
+    { 25, 26, 28, 2, 25, 100, 20939 }, // ŉ
+    { 29, 30, 29, -1, 23, 128, 21039 }, // Ŋ
+    { 18, 26, 20, 1, 18, 84, 21167 }, // ŋ
+    { 24, 31, 25, 0, 30, 121, 21251 }, // Ō
+    { 18, 25, 19, 0, 24, 76, 21372 }, // ō
+    { 24, 33, 25, 0, 32, 122, 21448 }, // Ŏ
+    { 18, 27, 19, 0, 26, 77, 21570 }, // ŏ
+    { 25, 34, 26, 0, 33, 133, 21647 }, // Ő
+    { 20, 29, 21, 0, 28, 88, 21780 }, // ő
+    { 33, 25, 34, 0, 24, 120, 21868 }, // Œ
+    { 27, 19, 28, 0, 18, 93, 21988 }, // œ
+    { 24, 34, 23, -2, 33, 121, 22081 }, // Ŕ
+    { 16, 29, 18, 1, 29, 70, 22202 }, // ŕ
+    { 24, 33, 23, -2, 24, 117, 22272 }, // Ŗ
+    { 18, 27, 18, -1, 18, 68, 22389 }, // ŗ
+    { 24, 33, 23, -2, 32, 122, 22457 }, // Ř
+    { 17, 28, 19, 1, 28, 75, 22579 }, // ř
+    { 19, 34, 19, -1, 33, 93, 22654 }, // Ś
+    { 17, 30, 17, -1, 29, 71, 22747 }, // ś
+    { 19, 33, 19, -1, 32, 96, 22818 }, // Ŝ
+    { 16, 29, 16, -1, 28, 75, 22914 }, // ŝ
+    { 19, 33, 19, -1, 24, 91, 22989 }, // Ş
+    { 15, 27, 15, -1, 18, 67, 23080 }, // ş
+    { 20, 33, 20, -1, 32, 95, 23147 }, // Š
+    { 18, 29, 18, -1, 28, 77, 23242 }, // š
+    { 22, 32, 25, 2, 23, 99, 23319 }, // Ţ
+    { 15, 31, 16, 0, 22, 72, 23418 }, // ţ
+    { 22, 32, 25, 2, 32, 101, 23490 }, // Ť
+    { 17, 28, 18, 0, 27, 66, 23591 }, // ť
+    { 22, 23, 25, 2, 23, 81, 23657 }, // Ŧ
+    { 15, 23, 16, 0, 22, 56, 23738 }, // ŧ
+    { 26, 33, 29, 2, 32, 116, 23794 }, // Ũ
+    { 20, 27, 21, 0, 26, 94, 23910 }, // ũ
+    { 26, 31, 29, 2, 30, 113, 24004 }, // Ū
+    { 20, 25, 21, 0, 24, 90, 24117 }, // ū
+    { 26, 33, 29, 2, 32, 113, 24207 }, // Ŭ
+    { 20, 27, 21, 0, 26, 91, 24320 }, // ŭ
+    { 26, 34, 29, 2, 33, 121, 24411 }, // Ů
+    { 20, 29, 21, 0, 28, 101, 24532 }, // ů
+    { 26, 34, 29, 2, 33, 124, 24633 }, // Ű
+    { 20, 29, 21, 0, 28, 98, 24757 }, // ű
+    { 26, 30, 29, 2, 23, 107, 24855 }, // Ų
+    { 20, 25, 21, 0, 18, 84, 24962 }, // ų
+    { 33, 33, 36, 2, 32, 152, 25046 }, // Ŵ
+    { 25, 29, 26, 0, 28, 115, 25198 }, // ŵ
+    { 23, 32, 25, 1, 32, 103, 25313 }, // Ŷ
+    { 22, 36, 18, -5, 28, 113, 25416 }, // ŷ
+    { 23, 31, 25, 1, 31, 99, 25529 }, // Ÿ
+    { 21, 34, 21, -1, 33, 97, 25628 }, // Ź
+    { 17, 30, 17, -1, 29, 81, 25725 }, // ź
+    { 21, 33, 21, -1, 32, 94, 25806 }, // Ż
+    { 17, 27, 17, -1, 26, 75, 25900 }, // ż
+    { 21, 33, 21, -1, 32, 100, 25975 }, // Ž
+    { 17, 29, 17, -1, 28, 84, 26075 }, // ž
+    { 24, 34, 19, -6, 26, 96, 26159 }, // ſ
+    { 27, 29, 28, 0, 28, 115, 26255 }, // Ơ
+    { 21, 22, 22, 0, 21, 69, 26370 }, // ơ
+    { 22, 24, 23, 0, 24, 85, 26439 }, // Ƥ
+    { 21, 34, 19, -3, 26, 105, 26524 }, // ƥ
+    { 15, 30, 16, 0, 22, 71, 26629 }, // ƫ
+    { 22, 23, 25, 2, 23, 78, 26700 }, // Ƭ
+    { 17, 27, 18, 0, 26, 66, 26778 }, // ƭ
+    { 22, 30, 25, 2, 23, 97, 26844 }, // Ʈ
+    { 29, 29, 32, 2, 28, 113, 26941 }, // Ư
+    { 24, 22, 25, 0, 21, 85, 27054 }, // ư
+    { 7, 9, 3, -5, 28, 13, 27139 }, // ̀
+    { 7, 10, 6, -2, 29, 13, 27152 }, // ́
+    { 12, 9, 6, -7, 28, 21, 27165 }, // ̂
+    { 12, 6, 7, -6, 26, 18, 27186 }, // ̃
+    { 12, 4, 7, -6, 24, 16, 27204 }, // ̄
+    { 12, 6, 7, -6, 26, 16, 27220 }, // ̆
+    { 6, 6, 4, -3, 26, 9, 27236 }, // ̇
+    { 12, 6, 7, -6, 26, 14, 27245 }, // ̈
+    { 9, 10, 6, -4, 29, 20, 27259 }, // ̉
+    { 10, 9, 6, -5, 28, 25, 27279 }, // ̊
+    { 13, 9, 8, -6, 28, 22, 27304 }, // ̋
+    { 12, 8, 8, -5, 28, 20, 27326 }, // ̌
+    { 11, 9, 5, -7, 28, 20, 27346 }, // ̏
+    { 11, 7, 6, -6, 26, 16, 27366 }, // ̑
+    { 7, 10, 5, -3, 29, 16, 27382 }, // ̒
+    { 7, 9, 5, -3, 29, 15, 27398 }, // ̓
+    { 6, 9, 3, -4, 29, 14, 27413 }, // ̔
+    { 6, 9, 4, -3, 29, 12, 27427 }, // ̕
+    { 6, 8, 4, -3, 21, 13, 27439 }, // ̛
+    { 6, 6, 4, -3, -2, 10, 27452 }, // ̣
+    { 12, 5, 7, -6, -3, 15, 27462 }, // ̤
+    { 8, 8, 5, -4, -1, 20, 27477 }, // ̥
+    { 7, 8, 4, -4, -1, 13, 27497 }, // ̦
+    { 8, 8, 5, -4, -1, 13, 27510 }, // ̧
+    { 8, 8, 5, -4, 1, 14, 27523 }, // ̨
+    { 6, 9, 9, -1, -1, 14, 27537 }, // ̩
+    { 13, 8, 7, -7, -1, 19, 27551 }, // ̭
+    { 12, 6, 7, -6, -2, 16, 27570 }, // ̮
+    { 12, 7, 7, -6, -2, 17, 27586 }, // ̰
+    { 12, 4, 7, -6, -3, 16, 27603 }, // ̱
+    { 12, 7, 7, -6, 26, 17, 27619 }, // ͂
+    { 13, 14, 7, -7, 34, 31, 27636 }, // ̈́
+    { 6, 7, 5, -2, -2, 12, 27667 }, // ͅ
+    { 26, 24, 25, -2, 24, 91, 27679 }, // Α
+    { 22, 25, 21, -2, 24, 87, 27770 }, // Β
+    { 23, 23, 22, -2, 23, 70, 27857 }, // Γ
+    { 22, 24, 23, -1, 24, 77, 27927 }, // Δ
+    { 23, 23, 22, -2, 23, 76, 28004 }, // Ε
+    { 21, 24, 21, -1, 23, 76, 28080 }, // Ζ
+    { 30, 23, 29, -2, 23, 100, 28156 }, // Η
+    { 24, 25, 25, 0, 24, 104, 28256 }, // Θ
+    { 17, 23, 16, -2, 23, 55, 28360 }, // Ι
+    { 27, 24, 26, -2, 23, 97, 28415 }, // Κ
+    { 25, 24, 24, -2, 24, 83, 28512 }, // Λ
+    { 33, 23, 31, -3, 23, 124, 28595 }, // Μ
+    { 29, 24, 29, -1, 23, 108, 28719 }, // Ν
+    { 23, 23, 23, -1, 23, 80, 28827 }, // Ξ
+    { 24, 25, 25, 0, 24, 100, 28907 }, // Ο
+    { 29, 23, 28, -2, 23, 101, 29007 }, // Π
+    { 23, 24, 22, -2, 24, 82, 29108 }, // Ρ
+    { 22, 24, 22, -1, 23, 72, 29190 }, // Σ
+    { 22, 23, 25, 2, 23, 77, 29262 }, // Τ
+    { 23, 24, 25, 1, 24, 79, 29339 }, // Υ
+    { 24, 25, 25, 0, 24, 103, 29418 }, // Φ
+    { 27, 23, 25, -3, 23, 93, 29521 }, // Χ
+    { 27, 24, 30, 2, 24, 99, 29614 }, // Ψ
+    { 26, 24, 28, -1, 24, 106, 29713 }, // Ω
+    { 20, 19, 21, 0, 18, 73, 29819 }, // α
+    { 19, 34, 19, -1, 26, 101, 29892 }, // β
+    { 17, 26, 18, 0, 18, 71, 29993 }, // γ
+    { 19, 27, 20, 0, 26, 80, 30064 }, // δ
+    { 16, 19, 17, 0, 18, 53, 30144 }, // ε
+    { 16, 35, 18, 1, 28, 79, 30197 }, // ζ
+    { 17, 26, 19, 1, 18, 82, 30276 }, // η
+    { 19, 27, 21, 1, 26, 86, 30358 }, // θ
+    { 9, 19, 11, 1, 18, 34, 30444 }, // ι
+    { 19, 19, 21, 1, 18, 67, 30478 }, // κ
+    { 20, 27, 19, -2, 26, 78, 30545 }, // λ
+    { 22, 26, 21, -2, 18, 88, 30623 }, // μ
+    { 17, 19, 18, 0, 18, 56, 30711 }, // ν
+    { 15, 35, 17, 1, 28, 81, 30767 }, // ξ
+    { 17, 19, 18, 0, 18, 58, 30848 }, // ο
+    { 22, 19, 23, 0, 18, 72, 30906 }, // π
+    { 19, 26, 19, -1, 18, 74, 30978 }, // ρ
+    { 15, 25, 16, 0, 18, 56, 31052 }, // ς
+    { 21, 19, 22, 0, 18, 60, 31108 }, // σ
+    { 17, 19, 19, 1, 18, 49, 31168 }, // τ
+    { 17, 19, 19, 1, 18, 61, 31217 }, // υ
+    { 23, 26, 24, 0, 18, 98, 31278 }, // φ
+    { 21, 26, 20, -2, 18, 85, 31376 }, // χ
+    { 24, 32, 26, 1, 24, 119, 31461 }, // ψ
+    { 24, 19, 25, 0, 18, 80, 31580 }, // ω
+    { 26, 32, 25, -2, 24, 111, 31660 }, // Ạ
+    { 20, 26, 21, 0, 18, 86, 31771 }, // ạ
+    { 26, 34, 25, -2, 34, 122, 31857 }, // Ả
+    { 20, 30, 21, 0, 29, 101, 31979 }, // ả
+    { 27, 35, 26, -2, 35, 130, 32080 }, // Ấ
+    { 22, 34, 23, 0, 33, 112, 32210 }, // ấ
+    { 26, 35, 25, -2, 35, 125, 32322 }, // Ầ
+    { 20, 34, 21, 0, 33, 109, 32447 }, // ầ
+    { 27, 35, 26, -2, 35, 133, 32556 }, // Ẩ
+    { 23, 34, 24, 0, 33, 116, 32689 }, // ẩ
+    { 26, 35, 25, -2, 35, 128, 32805 }, // Ẫ
+    { 20, 33, 21, 0, 32, 115, 32933 }, // ẫ
+    { 26, 40, 25, -2, 32, 135, 33048 }, // Ậ
+    { 20, 36, 21, 0, 28, 112, 33183 }, // ậ
+    { 26, 35, 25, -2, 35, 125, 33295 }, // Ắ
+    { 20, 34, 21, 0, 33, 106, 33420 }, // ắ
+    { 26, 35, 25, -2, 35, 125, 33526 }, // Ằ
+    { 20, 33, 21, 0, 32, 107, 33651 }, // ằ
+    { 26, 35, 25, -2, 35, 130, 33758 }, // Ẳ
+    { 20, 34, 21, 0, 33, 114, 33888 }, // ẳ
+    { 26, 35, 25, -2, 35, 128, 34002 }, // Ẵ
+    { 20, 32, 21, 0, 31, 111, 34130 }, // ẵ
+    { 26, 40, 25, -2, 32, 134, 34241 }, // Ặ
+    { 20, 34, 21, 0, 26, 106, 34375 }, // ặ
+    { 23, 31, 22, -2, 23, 93, 34481 }, // Ẹ
+    { 15, 26, 16, 0, 18, 69, 34574 }, // ẹ
+    { 23, 34, 22, -2, 34, 106, 34643 }, // Ẻ
+    { 16, 30, 17, 0, 29, 80, 34749 }, // ẻ
+    { 23, 32, 22, -2, 32, 100, 34829 }, // Ẽ
+    { 17, 27, 18, 0, 26, 78, 34929 }, // ẽ
+    { 26, 35, 25, -2, 35, 116, 35007 }, // Ế
+    { 21, 34, 22, 0, 33, 100, 35123 }, // ế
+    { 23, 35, 22, -2, 35, 111, 35223 }, // Ề
+    { 17, 34, 18, 0, 33, 90, 35334 }, // ề
+    { 26, 35, 25, -2, 35, 120, 35424 }, // Ể
+    { 21, 34, 22, 0, 33, 104, 35544 }, // ể
+    { 23, 35, 22, -2, 35, 113, 35648 }, // Ễ
+    { 17, 33, 18, 0, 32, 94, 35761 }, // ễ
+    { 23, 40, 22, -2, 32, 119, 35855 }, // Ệ
+    { 16, 36, 17, 0, 28, 91, 35974 }, // ệ
+    { 17, 34, 16, -2, 34, 81, 36065 }, // Ỉ
+    { 12, 30, 14, 1, 29, 62, 36146 }, // ỉ
+    { 17, 31, 16, -2, 23, 71, 36208 }, // Ị
+    { 11, 34, 12, 0, 26, 60, 36279 }, // ị
+    { 24, 32, 25, 0, 24, 117, 36339 }, // Ọ
+    { 17, 26, 18, 0, 18, 71, 36456 }, // ọ
+    { 24, 35, 25, 0, 34, 130, 36527 }, // Ỏ
+    { 17, 30, 18, 0, 29, 85, 36657 }, // ỏ
+    { 25, 36, 26, 0, 35, 135, 36742 }, // Ố
+    { 22, 34, 23, 0, 33, 101, 36877 }, // ố
+    { 24, 36, 25, 0, 35, 135, 36978 }, // Ồ
+    { 19, 34, 20, 0, 33, 94, 37113 }, // ồ
+    { 25, 36, 26, 0, 35, 139, 37207 }, // Ổ
+    { 23, 34, 24, 0, 33, 105, 37346 }, // ổ
+    { 24, 36, 25, 0, 35, 137, 37451 }, // Ỗ
+    { 18, 33, 19, 0, 32, 98, 37588 }, // ỗ
+    { 24, 40, 25, 0, 32, 141, 37686 }, // Ộ
+    { 18, 36, 19, 0, 28, 96, 37827 }, // ộ
+    { 27, 34, 28, 0, 33, 132, 37923 }, // Ớ
+    { 21, 30, 22, 0, 29, 86, 38055 }, // ớ
+    { 27, 34, 28, 0, 33, 131, 38141 }, // Ờ
+    { 21, 29, 22, 0, 28, 88, 38272 }, // ờ
+    { 27, 35, 28, 0, 34, 140, 38360 }, // Ở
+    { 21, 30, 22, 0, 29, 94, 38500 }, // ở
+    { 27, 33, 28, 0, 32, 133, 38594 }, // Ỡ
+    { 21, 27, 22, 0, 26, 89, 38727 }, // ỡ
+    { 27, 36, 28, 0, 28, 132, 38816 }, // Ợ
+    { 21, 29, 22, 0, 21, 84, 38948 }, // ợ
+    { 26, 31, 29, 2, 23, 110, 39032 }, // Ụ
+    { 20, 26, 21, 0, 18, 84, 39142 }, // ụ
+    { 26, 35, 29, 2, 34, 122, 39226 }, // Ủ
+    { 20, 30, 21, 0, 29, 98, 39348 }, // ủ
+    { 29, 34, 32, 2, 33, 129, 39446 }, // Ứ
+    { 24, 30, 25, 0, 29, 103, 39575 }, // ứ
+    { 29, 34, 32, 2, 33, 130, 39678 }, // Ừ
+    { 24, 29, 25, 0, 28, 104, 39808 }, // ừ
+    { 29, 35, 32, 2, 34, 139, 39912 }, // Ử
+    { 24, 30, 25, 0, 29, 110, 40051 }, // ử
+    { 29, 33, 32, 2, 32, 133, 40161 }, // Ữ
+    { 24, 27, 25, 0, 26, 104, 40294 }, // ữ
+    { 29, 36, 32, 2, 28, 134, 40398 }, // Ự
+    { 24, 29, 25, 0, 21, 100, 40532 }, // ự
+    { 23, 33, 25, 1, 33, 99, 40632 }, // Ỳ
+    { 22, 36, 18, -5, 28, 109, 40731 }, // ỳ
+    { 23, 31, 25, 1, 23, 97, 40840 }, // Ỵ
+    { 22, 26, 18, -5, 18, 92, 40937 }, // ỵ
+    { 23, 34, 25, 1, 34, 107, 41029 }, // Ỷ
+    { 22, 37, 18, -5, 29, 115, 41136 }, // ỷ
+    { 23, 32, 25, 1, 32, 102, 41251 }, // Ỹ
+    { 22, 34, 18, -5, 26, 110, 41353 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 41463 }, //  
+    { 0, 0, 33, 0, 0, 0, 41463 }, //  
+    { 0, 0, 17, 0, 0, 0, 41463 }, //  
+    { 0, 0, 33, 0, 0, 0, 41463 }, //  
+    { 0, 0, 11, 0, 0, 0, 41463 }, //  
+    { 0, 0, 8, 0, 0, 0, 41463 }, //  
+    { 0, 0, 5, 0, 0, 0, 41463 }, //  
+    { 0, 0, 21, 0, 0, 0, 41463 }, //  
+    { 0, 0, 10, 0, 0, 0, 41463 }, //  
+    { 0, 0, 7, 0, 0, 0, 41463 }, //  
+    { 0, 0, 2, 0, 0, 0, 41463 }, //  
+    { 0, 0, 1, 0, 0, 0, 41463 }, // ​
+    { 2, 28, 2, -1, 20, 27, 41463 }, // ‌
+    { 8, 30, 5, -4, 22, 51, 41490 }, // ‍
+    { 12, 31, 7, -6, 23, 70, 41541 }, // ‎
+    { 12, 31, 7, -6, 23, 69, 41611 }, // ‏
+    { 11, 5, 13, 1, 11, 18, 41680 }, // ‐
+    { 11, 5, 13, 1, 11, 18, 41698 }, // ‑
+    { 17, 4, 21, 2, 13, 23, 41716 }, // ‒
+    { 17, 5, 18, 0, 11, 11, 41739 }, // –
+    { 33, 5, 34, 0, 11, 18, 41750 }, // —
+    { 33, 5, 34, 0, 11, 18, 41768 }, // ―
+    { 12, 34, 17, 2, 26, 106, 41786 }, // ‖
+    { 17, 9, 18, 0, -1, 32, 41892 }, // ‗
+    { 8, 11, 11, 2, 25, 17, 41924 }, // ‘
+    { 8, 11, 11, 2, 25, 16, 41941 }, // ’
+    { 8, 11, 10, 0, 5, 18, 41957 }, // ‚
+    { 8, 12, 10, 1, 25, 16, 41975 }, // ‛
+    { 15, 11, 18, 2, 25, 34, 41991 }, // “
+    { 15, 12, 18, 2, 25, 33, 42025 }, // ”
+    { 14, 11, 17, 0, 5, 36, 42058 }, // „
+    { 15, 12, 17, 1, 25, 32, 42094 }, // ‟
+    { 15, 22, 17, 1, 24, 53, 42126 }, // †
+    { 17, 26, 17, -1, 24, 78, 42179 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 42257 }, // •
+    { 12, 12, 21, 4, 17, 24, 42273 }, // ‣
+    { 7, 6, 10, 1, 5, 13, 42297 }, // ․
+    { 15, 6, 17, 1, 5, 21, 42310 }, // ‥
+    { 29, 6, 33, 2, 5, 29, 42331 }, // …
+    { 7, 6, 10, 1, 12, 13, 42360 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 42373 }, //  
+    { 0, 0, 1, 0, 0, 0, 42373 }, //  
+    { 12, 31, 7, -6, 23, 71, 42373 }, // ‪
+    { 12, 31, 7, -6, 23, 69, 42444 }, // ‫
+    { 10, 31, 6, -5, 23, 56, 42513 }, // ‬
+    { 14, 31, 8, -7, 23, 83, 42569 }, // ‭
+    { 14, 31, 8, -7, 23, 82, 42652 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 42734 }, //  
+    { 44, 28, 46, 1, 25, 185, 42734 }, // ‰
+    { 8, 11, 9, 0, 23, 17, 42919 }, // ′
+    { 15, 11, 16, 0, 23, 34, 42936 }, // ″
+    { 23, 11, 24, 0, 23, 51, 42970 }, // ‴
+    { 8, 11, 9, 0, 23, 18, 43021 }, // ‵
+    { 15, 11, 16, 0, 23, 35, 43039 }, // ‶
+    { 22, 11, 23, 0, 23, 52, 43074 }, // ‷
+    { 14, 7, 16, 1, 0, 20, 43126 }, // ‸
+    { 10, 13, 12, 1, 15, 22, 43146 }, // ‹
+    { 11, 13, 12, 0, 15, 20, 43168 }, // ›
+    { 21, 23, 22, 0, 22, 94, 43188 }, // ※
+    { 20, 26, 22, 1, 25, 85, 43282 }, // ‼
+    { 17, 4, 18, 0, 28, 22, 43367 }, // ‾
+    { 8, 5, 10, 1, 11, 14, 43389 }, // ⁃
+    { 21, 28, 16, -6, 25, 60, 43403 }, // ⁄
+    { 24, 25, 27, 2, 24, 97, 43463 }, // ⁇
+    { 22, 26, 25, 2, 25, 93, 43560 }, // ⁈
+    { 22, 26, 24, 1, 25, 95, 43653 }, // ⁉
+    { 20, 7, 33, 6, 13, 23, 43748 }, // ⁓
+    { 30, 11, 31, 0, 23, 69, 43771 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 43840 }, //  
+    { 0, 0, 1, 0, 0, 0, 43840 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 43840 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 43840 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 43840 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 43840 }, // ⁤
+    { 14, 17, 15, 0, 28, 40, 43840 }, // ⁰
+    { 14, 16, 15, 0, 28, 35, 43880 }, // ⁴
+    { 13, 16, 15, 1, 27, 34, 43915 }, // ⁵
+    { 14, 17, 16, 1, 28, 43, 43949 }, // ⁶
+    { 13, 16, 16, 2, 27, 34, 43992 }, // ⁷
+    { 13, 17, 15, 1, 28, 47, 44026 }, // ⁸
+    { 14, 17, 15, 0, 28, 43, 44073 }, // ⁹
+    { 13, 13, 19, 3, 24, 41, 44116 }, // ⁿ
+    { 14, 16, 15, 0, 11, 45, 44157 }, // ₀
+    { 11, 16, 15, 1, 11, 32, 44202 }, // ₁
+    { 14, 16, 15, 0, 11, 41, 44234 }, // ₂
+    { 12, 16, 15, 1, 11, 39, 44275 }, // ₃
+    { 14, 16, 15, 0, 11, 45, 44314 }, // ₄
+    { 13, 16, 15, 1, 11, 36, 44359 }, // ₅
+    { 14, 16, 16, 1, 11, 41, 44395 }, // ₆
+    { 13, 16, 16, 2, 11, 35, 44436 }, // ₇
+    { 13, 16, 15, 1, 11, 45, 44471 }, // ₈
+    { 14, 16, 15, 0, 11, 41, 44516 }, // ₉
+    { 22, 23, 22, -1, 23, 78, 44557 }, // ₣
+    { 22, 24, 22, -1, 23, 86, 44635 }, // ₤
+    { 43, 24, 44, 0, 23, 156, 44721 }, // ₧
+    { 23, 24, 23, -1, 23, 84, 44877 }, // €
+    { 21, 15, 33, 6, 19, 49, 44961 }, // ←
+    { 15, 21, 33, 9, 22, 59, 45010 }, // ↑
+    { 21, 15, 33, 6, 19, 49, 45069 }, // →
+    { 15, 21, 33, 9, 22, 57, 45118 }, // ↓
+    { 21, 15, 33, 6, 19, 53, 45175 }, // ↔
+    { 15, 23, 33, 9, 23, 52, 45228 }, // ↕
+    { 15, 23, 33, 9, 23, 60, 45280 }, // ↨
+    { 15, 23, 33, 9, 23, 62, 45340 }, // ↲
+    { 15, 23, 33, 9, 23, 61, 45402 }, // ↳
+    { 19, 18, 33, 7, 20, 54, 45463 }, // ↵
+    { 21, 19, 33, 6, 21, 76, 45517 }, // ⇐
+    { 19, 21, 33, 7, 22, 93, 45593 }, // ⇑
+    { 21, 19, 33, 6, 21, 76, 45686 }, // ⇒
+    { 19, 21, 33, 7, 22, 92, 45762 }, // ⇓
+    { 21, 17, 33, 6, 20, 68, 45854 }, // ⇔
+    { 23, 24, 33, 5, 23, 82, 45922 }, // ∀
+    { 18, 27, 21, 1, 26, 79, 46004 }, // ∂
+    { 17, 23, 33, 8, 23, 75, 46083 }, // ∃
+    { 25, 27, 33, 4, 25, 113, 46158 }, // ∅
+    { 22, 24, 23, 0, 24, 81, 46271 }, // ∆
+    { 21, 24, 33, 6, 23, 81, 46352 }, // ∇
+    { 23, 23, 33, 5, 23, 91, 46433 }, // ∈
+    { 23, 29, 33, 5, 26, 113, 46524 }, // ∉
+    { 23, 20, 33, 5, 21, 80, 46637 }, // ∊
+    { 23, 23, 33, 5, 23, 91, 46717 }, // ∋
+    { 23, 29, 33, 5, 26, 113, 46808 }, // ∌
+    { 23, 20, 33, 5, 21, 80, 46921 }, // ∍
+    { 26, 29, 28, 1, 23, 121, 47001 }, // ∏
+    { 21, 29, 23, 1, 23, 88, 47122 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 47210 }, // −
+    { 21, 26, 20, -2, 24, 57, 47225 }, // ∕
+    { 16, 26, 18, 1, 24, 54, 47282 }, // ∖
+    { 16, 16, 21, 2, 19, 47, 47336 }, // ∗
+    { 13, 12, 21, 4, 17, 34, 47383 }, // ∘
+    { 7, 6, 21, 7, 12, 13, 47417 }, // ∙
+    { 22, 31, 22, -1, 27, 90, 47430 }, // √
+    { 17, 13, 21, 2, 17, 45, 47520 }, // ∝
+    { 21, 13, 22, 0, 17, 55, 47565 }, // ∞
+    { 21, 23, 33, 6, 23, 62, 47620 }, // ∟
+    { 25, 23, 33, 4, 23, 72, 47682 }, // ∠
+    { 5, 34, 17, 6, 26, 37, 47754 }, // ∣
+    { 12, 34, 17, 2, 26, 106, 47791 }, // ∥
+    { 23, 23, 33, 5, 23, 72, 47897 }, // ∧
+    { 23, 23, 33, 5, 23, 74, 47969 }, // ∨
+    { 19, 24, 33, 7, 24, 92, 48043 }, // ∩
+    { 19, 24, 33, 7, 23, 92, 48135 }, // ∪
+    { 19, 34, 21, 1, 26, 92, 48227 }, // ∫
+    { 23, 20, 33, 5, 19, 54, 48319 }, // ∴
+    { 23, 20, 33, 5, 19, 51, 48373 }, // ∵
+    { 8, 18, 10, 1, 20, 24, 48424 }, // ∶
+    { 23, 20, 33, 5, 19, 59, 48448 }, // ∷
+    { 20, 7, 33, 6, 13, 23, 48507 }, // ∼
+    { 20, 18, 33, 6, 20, 74, 48530 }, // ≅
+    { 17, 14, 21, 2, 18, 47, 48604 }, // ≈
+    { 19, 13, 33, 7, 16, 43, 48651 }, // ≍
+    { 15, 16, 21, 3, 19, 52, 48694 }, // ≠
+    { 19, 16, 33, 7, 18, 71, 48746 }, // ≡
+    { 15, 20, 21, 3, 20, 48, 48817 }, // ≤
+    { 15, 21, 21, 3, 21, 50, 48865 }, // ≥
+    { 27, 16, 33, 3, 19, 75, 48915 }, // ≪
+    { 27, 16, 33, 3, 19, 74, 48990 }, // ≫
+    { 23, 20, 33, 5, 21, 62, 49064 }, // ⊃
+    { 23, 29, 33, 5, 26, 97, 49126 }, // ⊄
+    { 23, 29, 33, 5, 26, 99, 49223 }, // ⊅
+    { 21, 23, 33, 6, 23, 65, 49322 }, // ⊆
+    { 21, 23, 33, 6, 23, 65, 49387 }, // ⊇
+    { 25, 25, 33, 4, 24, 107, 49452 }, // ⊕
+    { 25, 25, 33, 4, 24, 102, 49559 }, // ⊖
+    { 25, 25, 33, 4, 24, 121, 49661 }, // ⊗
+    { 25, 25, 33, 4, 24, 114, 49782 }, // ⊘
+    { 19, 23, 33, 7, 23, 57, 49896 }, // ⊥
+    { 7, 6, 21, 7, 12, 13, 49953 }, // ⋅
+    { 29, 6, 33, 2, 12, 38, 49966 }, // ⋯
+    { 31, 32, 33, 1, 28, 137, 50004 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
@@ -5866,4 +3903,5 @@ static const EpdFontData bookerly_16_bolditalic = {
     36,
     -9,
     true,
+    true,
 };
@@ -2,5417 +2,3635 @@
  * generated by fontconvert.py
  * name: bookerly_16_italic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_italicBitmaps[75599] = {
-    0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xE0,
-    0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x74, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x80, 0x18, 0x07, 0xC0, 0xBC, 0x0F, 0xC0, 0xF8, 0x0F, 0x81, 0xF4, 0x1F, 0x42, 0xF0,
-    0x1F, 0x02, 0xF0, 0x2F, 0x03, 0xE0, 0x2E, 0x03, 0xC0, 0x3D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x55, 0xF5, 0x57,
-    0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xBF, 0xAA, 0xFE, 0xA4, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x02, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x03, 0xF9, 0xBB, 0xFD, 0x00, 0xBD, 0x0F, 0x4B, 0xF0, 0x0F, 0xC0, 0xF0, 0x3F, 0x01, 0xF8,
-    0x1E, 0x03, 0xE0, 0x1F, 0xC2, 0xD0, 0x10, 0x00, 0xFD, 0x2C, 0x00, 0x00, 0x0F, 0xFB, 0xC0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x01, 0xE7, 0xFC, 0x00, 0x40, 0x2D, 0x0F, 0xE0, 0x7C, 0x03, 0xC0, 0xFF, 0x0B,
-    0xC0, 0x3C, 0x0B, 0xE0, 0xFD, 0x07, 0x80, 0xFE, 0x0B, 0xF0, 0xB4, 0x1F, 0xC0, 0x7F, 0xEF, 0x5B,
-    0xF4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0x00,
-    0xBC, 0x00, 0xF8, 0x0B, 0xC0, 0x05, 0x40, 0xBC, 0x01, 0xF0, 0x1F, 0x00, 0xBF, 0xF0, 0x7E, 0x07,
-    0xD0, 0x3D, 0x03, 0xFA, 0xFC, 0x2F, 0xFF, 0x40, 0xB8, 0x0F, 0xC0, 0x7D, 0x0B, 0xF8, 0x01, 0xF0,
-    0x1F, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x3D, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x0B, 0xC0,
-    0x00, 0x7C, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x04, 0x00, 0x0B, 0xDB, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xBF, 0xD0, 0x0B, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xF7,
-    0xF0, 0x0B, 0xFF, 0x90, 0x00, 0xF8, 0x3F, 0x02, 0xFE, 0xE0, 0x00, 0x2F, 0x01, 0xF8, 0x2D, 0x2E,
-    0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x03, 0xF8, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x0F, 0xE2, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x2F, 0xFF, 0x90, 0x00, 0x05, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x40, 0x00, 0x80, 0x7C, 0x0F, 0xC0, 0xF8, 0x1F,
-    0x41, 0xF0, 0x2F, 0x02, 0xE0, 0x3D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x08, 0x0F, 0xC0,
-    0x2F, 0x0F, 0x40, 0x3F, 0xCE, 0x00, 0x07, 0xFD, 0xBD, 0x00, 0xBF, 0xFD, 0x0B, 0xED, 0x6D, 0x3F,
-    0x8E, 0x00, 0x1F, 0x0F, 0x00, 0x04, 0x0F, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC,
-    0x02, 0xF0, 0x07, 0xE0, 0x1F, 0x80, 0xBD, 0x00, 0x10, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xCB, 0xF7, 0xFD, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x02, 0xFC,
-    0x00, 0xBE, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x07,
-    0xF0, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x2F,
-    0x80, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xF9, 0x6F, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x6F, 0xE0, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0xD0, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x00,
-    0x07, 0xF4, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x07, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0xF0, 0x07,
-    0x80, 0x00, 0xBE, 0x00, 0x10, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x5B, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x02, 0xF8, 0x00,
-    0x7E, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x5F, 0xE5, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x16, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x6F, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE5, 0x1B, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x2F,
-    0x80, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03,
-    0xFC, 0x00, 0x0F, 0xF4, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xBD, 0x55, 0x56, 0xFC, 0x3E, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFD, 0x07,
-    0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x0F, 0xF9, 0xBF, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xBE,
-    0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x0F, 0xE0, 0x01, 0xFC,
-    0x00, 0xBF, 0x40, 0x7F, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x7F, 0xBF, 0xF0, 0x00, 0x2F, 0xC0, 0xBF, 0xC0, 0x0B, 0xE0, 0x02, 0xFD, 0x01,
-    0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0x40, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00,
-    0xFE, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0xF4, 0x1F, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0xD0, 0x02,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0x57, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0xFD, 0x03, 0xFD,
-    0x03, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x2F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x10, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xF0, 0x0F, 0xEB, 0xF8, 0x08, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xA8, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x7F,
-    0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xE0, 0x00, 0x69, 0x05, 0x00, 0x7E, 0x01,
-    0xF8, 0x00, 0x3F, 0xFE, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x0F, 0xE7, 0xFF, 0x00, 0x3E, 0x07, 0xD0,
-    0x03, 0xF0, 0x0B, 0xE0, 0x03, 0xE0, 0xFC, 0x00, 0xBD, 0x00, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x0F,
-    0x80, 0x07, 0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x2F, 0x00, 0x3F, 0x00,
-    0x0F, 0x40, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0xF4, 0x3F, 0x00, 0x3E, 0x00, 0x7F,
-    0x00, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0xF0, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0x03, 0xDF, 0x02,
-    0xF4, 0x03, 0xF0, 0x03, 0xFE, 0xF1, 0xFB, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x0F, 0xFF, 0x00,
-    0x02, 0xF4, 0x00, 0x69, 0x00, 0x29, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x55, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xA6, 0xF8, 0x0B, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x07, 0xE0,
-    0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x40, 0x1F, 0xF4,
-    0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x51, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D,
-    0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0,
-    0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xFE,
-    0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00,
-    0x34, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xDA, 0xAA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xE9, 0x6B, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0x00, 0x7F, 0x40, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0x02, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xFF, 0xDB,
-    0xF0, 0x00, 0x0B, 0xFF, 0xF6, 0xFC, 0x00, 0x00, 0x1B, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x0F,
-    0xF8, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xE9, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x28, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F,
-    0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40, 0x3F,
-    0x00, 0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x1F,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0xBC,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x02, 0xF0,
-    0x3F, 0x00, 0x00, 0x03, 0xE0, 0xBD, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x7E, 0x0B, 0xC0,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x3E, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x7C, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0xF4, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0xBE, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F,
-    0x83, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07,
-    0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xA6, 0xF8, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x1F,
-    0xC5, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80,
-    0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00,
-    0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F,
-    0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07,
-    0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00,
-    0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC,
-    0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x0B, 0xF9,
-    0x00, 0x00, 0x7F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x64, 0x00, 0x2F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x0F, 0x80,
-    0x03, 0xFF, 0xFD, 0x07, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x03, 0xFF, 0xC0, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x0F, 0xCB, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x7D, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x3F, 0x07, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x7E, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0xFC, 0x03, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x3F, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x3F, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x03, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x2F,
-    0xBC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00,
-    0x0B, 0xF0, 0x00, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC,
-    0x00, 0x00, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA,
-    0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0,
-    0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xBC, 0x2E, 0x00,
-    0x00, 0x3D, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x01, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0x2F, 0xC0, 0x2F, 0x80, 0x1F, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02,
-    0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F,
-    0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0,
-    0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2,
-    0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40,
-    0x00, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x40, 0x07, 0xD1,
-    0xFF, 0xF0, 0x02, 0xF2, 0xFA, 0xFE, 0x00, 0xFD, 0xF0, 0x2F, 0xC0, 0x3E, 0xF0, 0x07, 0xF0, 0x0F,
-    0xF0, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0xBF, 0x90, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xAF, 0xFE,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0xFC,
-    0x03, 0xF9, 0xBE, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x87, 0xF0, 0x01, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xD0,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0xE3,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xF5, 0xBF, 0xE0, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00,
-    0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC,
-    0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07, 0xD0,
-    0xBC, 0x00, 0xBD, 0x0F, 0x80, 0x1F, 0xC2, 0xF0, 0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB, 0xFE,
-    0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x7F,
-    0x00, 0x1F, 0x43, 0xFE, 0x6F, 0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x56, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0x40, 0xFD, 0x90, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F,
-    0x40, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00,
-    0x2F, 0xD0, 0x02, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80,
-    0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0xC0, 0x01, 0xF4, 0x3F, 0xFE, 0x00, 0x2F, 0x0F,
-    0xEF, 0xF0, 0x03, 0xF3, 0xE0, 0x3F, 0x00, 0x3E, 0xB8, 0x03, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00,
-    0xBF, 0xC0, 0x0B, 0xC0, 0x0F, 0xF4, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01,
-    0xF4, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F,
-    0x00, 0x07, 0xD2, 0xD7, 0xE0, 0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x03, 0xFC,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x3F,
-    0xFD, 0x01, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x20, 0x3F, 0x4F, 0x03,
-    0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x5F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x04, 0x03, 0xF0, 0x00, 0x07, 0x96, 0xF4, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x1F, 0xF8, 0x00, 0xF8, 0xBF, 0xFD, 0x00, 0xFB, 0xE0, 0xBD, 0x01, 0xFF, 0x40, 0x7D, 0x02,
-    0xFD, 0x00, 0xBC, 0x03, 0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x7F, 0x80, 0x0B,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x1F,
-    0x43, 0xF8, 0x00, 0x2F, 0x01, 0xFE, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x3F, 0x00, 0x2F, 0xFF, 0x7D,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x15, 0x02, 0xFF, 0xD0, 0xFF, 0xF4, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC1, 0x43, 0xF1, 0xE1, 0xFF, 0xF4, 0x7F, 0xF4, 0x0F,
-    0xF0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x02, 0xFD, 0x00,
-    0x7F, 0xC0, 0x7F, 0xF8, 0x1F, 0xFF, 0x02, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x0F, 0xEF, 0xE0,
-    0x01, 0xF5, 0xF4, 0x3F, 0x3E, 0x07, 0xE0, 0x01, 0xF7, 0xD0, 0x3E, 0xB8, 0x0B, 0xD0, 0x02, 0xFB,
-    0x40, 0x3F, 0xF0, 0x0B, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0x0F, 0x80, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x2F,
-    0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x7D, 0x08, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xBC, 0x3C, 0x2F, 0x00, 0x07,
-    0xE0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xE0, 0x3E, 0x00, 0x0F, 0xC0, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x0B, 0xF8, 0x07, 0xFF, 0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F,
-    0x40, 0x07, 0xDF, 0x40, 0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03,
-    0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F,
-    0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE,
-    0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC,
-    0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0,
-    0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xFC, 0x00,
-    0x57, 0xD3, 0xFB, 0xFC, 0x00, 0x07, 0xDB, 0x80, 0xFD, 0x00, 0x07, 0xEE, 0x00, 0xBE, 0x00, 0x0B,
-    0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x90, 0xBF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFA, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x14, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xF9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x82, 0xE0, 0x03, 0xFF, 0xFE, 0xF0, 0x03,
-    0xF9, 0x6F, 0xFC, 0x03, 0xF4, 0x01, 0xFE, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x7F,
-    0x01, 0xF8, 0x00, 0x3F, 0x80, 0xBD, 0x00, 0x2F, 0xD0, 0x2F, 0x80, 0x1F, 0xF4, 0x0B, 0xF0, 0x1F,
-    0x7C, 0x01, 0xFE, 0x7F, 0x2F, 0x00, 0x3F, 0xFF, 0x0F, 0x80, 0x07, 0xFE, 0x03, 0xE0, 0x00, 0x14,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0xFD, 0x7F, 0xFC, 0x3F, 0xE1, 0x5F, 0x8F, 0xFD, 0x00,
-    0xF5, 0xF5, 0x80, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x07, 0xE5, 0x7E, 0x03, 0xF0, 0x01,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBE, 0x0D, 0x00, 0x1F, 0x8B, 0xC0, 0x07,
-    0xC2, 0xFE, 0x47, 0xE0, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x1A, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFE, 0x56, 0xF9, 0x54, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0x2F, 0x40, 0x38, 0x2F, 0x41, 0xF8, 0x2F, 0xEF, 0xF0, 0x2F, 0xFF, 0xC0, 0x0F, 0xFD, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01,
-    0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4,
-    0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0x87, 0xFF, 0x40, 0x0B, 0xF0, 0x5B, 0xE0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x02, 0xF4, 0x02, 0xF0,
-    0x00, 0x7E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC7, 0xFF, 0x40, 0x0F, 0xD0,
-    0x03, 0xF8, 0x5B, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x0B, 0xD0, 0x0B, 0xF0, 0x02, 0xF0, 0x01, 0xF8, 0x03, 0xFD, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0xBF, 0xE0, 0x2F, 0x00, 0x02, 0xF0,
-    0x3D, 0xF8, 0x0F, 0x40, 0x00, 0xBC, 0x2F, 0x2F, 0x0B, 0xC0, 0x00, 0x1F, 0x0F, 0x0B, 0xC3, 0xD0,
-    0x00, 0x07, 0xCB, 0x81, 0xF3, 0xE0, 0x00, 0x01, 0xFB, 0xC0, 0x7E, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFD,
-    0x03, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xEF, 0xE0, 0x2F, 0xEC, 0x00, 0x07, 0xF0, 0x7D, 0x00, 0x00,
-    0x03, 0xF4, 0xF8, 0x00, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x00, 0x0F, 0x4B, 0xD0, 0x00, 0x00, 0x3E, 0x07, 0xF0,
-    0x00, 0x3A, 0xFC, 0x03, 0xFA, 0xF4, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x40,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01,
-    0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D,
-    0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00,
-    0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B,
-    0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F,
-    0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F,
-    0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7C,
-    0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00,
-    0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x06, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x08, 0x0F, 0xFF, 0x80, 0x2E, 0x2F, 0xFF,
-    0xF4, 0xBE, 0x3E, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
-    0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x1D, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xD3, 0xC1, 0xE0, 0x0F, 0xC0,
-    0xF0, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x07, 0xE0, 0x2D, 0x00, 0x02, 0xF0, 0x0B, 0x00, 0x00, 0xFC,
-    0x03, 0xC0, 0x00, 0x3F, 0x00, 0xE0, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x03, 0xF0, 0x2D, 0x00, 0x00,
-    0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x83, 0xC0, 0x3C, 0x07, 0xF9, 0xE0, 0x7E, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xAB, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x00,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xFE, 0xAA, 0xAF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFC, 0x1A, 0xFF, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00,
-    0xF4, 0x01, 0x50, 0x0B, 0xC0, 0x2F, 0x0B, 0xFF, 0x8F, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0x80, 0x3F, 0x40, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0x80, 0x0B, 0xD0, 0x00, 0x07, 0xF8, 0x1B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x82,
-    0xFF, 0x82, 0xF0, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x50, 0x15, 0x55, 0x47, 0xFF, 0xFD, 0x03, 0xFF, 0xFC, 0x2F, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x7C, 0x00, 0x0B,
-    0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x03, 0xFA, 0xFF, 0x40, 0x3D, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0xF4, 0x2F, 0xC0, 0x03, 0xC0, 0xFB,
-    0x80, 0x00, 0x07, 0x8F, 0x40, 0x00, 0x2D, 0x1F, 0x80, 0x00, 0xB4, 0x1F, 0x80, 0x02, 0xD0, 0x1F,
-    0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x1F, 0xD0, 0x1F,
-    0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x0F, 0xD0, 0xF0, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x0F, 0xCF, 0x00,
-    0x00, 0x0F, 0xB8, 0x3C, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0xFE, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xE5,
-    0xBF, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1A, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x14, 0x2F, 0xC0, 0xFD,
-    0x3F, 0xC2, 0xFD, 0x3F, 0x41, 0xFC, 0x04, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x7F, 0xF4, 0x03, 0xC0, 0x3D, 0x00, 0xFF, 0xFE, 0x00, 0xB8, 0x1F, 0x00, 0xF8, 0x03, 0x80,
-    0x0F, 0x0B, 0x40, 0x7C, 0x00, 0xE0, 0x02, 0xD3, 0xC0, 0x2E, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F,
-    0x40, 0x00, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xCF, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xE3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x78, 0xB4, 0x0B, 0xC0, 0x00, 0x00, 0x2D, 0x1E, 0x01, 0xFD,
-    0x00, 0x40, 0x0F, 0x03, 0xC0, 0x2F, 0xFF, 0xF0, 0x07, 0xC0, 0xB8, 0x01, 0xFF, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x0F, 0x41, 0xF0, 0x0B, 0x80, 0xB8, 0x03, 0xC0, 0x3D, 0x01, 0xF0, 0x0F, 0x00, 0xB8, 0x0B, 0xC0,
-    0x2E, 0x07, 0xE1, 0x0B, 0xDB, 0xB9, 0xC1, 0xFF, 0x8F, 0xE0, 0x2F, 0x43, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x1F,
-    0x40, 0xBC, 0x00, 0xBE, 0x03, 0xF0, 0x03, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x00, 0x3F, 0x82,
-    0xFC, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x10, 0x01, 0x40, 0xBF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F,
-    0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x06, 0xA8, 0x03, 0xC0, 0x78, 0x2F, 0xBD,
-    0x07, 0x42, 0xC0, 0x38, 0x78, 0x0F, 0x0F, 0x00, 0xE1, 0xE0, 0x2C, 0x3C, 0x03, 0xEF, 0x00, 0xB0,
-    0xE0, 0x0F, 0xF0, 0x02, 0xC3, 0xC0, 0x38, 0xF0, 0x0B, 0x0B, 0x00, 0xE1, 0xF0, 0x3C, 0x1D, 0x0F,
-    0xE1, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xE0, 0x3F, 0x47, 0xF4, 0x7C,
-    0x00, 0xFC, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0xBC, 0x7E, 0x00, 0xF8, 0x3F, 0xEB,
-    0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0xF9,
-    0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0xD1, 0xFC, 0x0B,
-    0x80, 0x2F, 0x01, 0xC0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x00,
-    0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xEA, 0xAA, 0x0F,
-    0xFF, 0xFF, 0x80, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xFC, 0x03,
-    0xE0, 0xBC, 0x03, 0x40, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x6F, 0xC0, 0x01, 0xFF,
-    0xE0, 0x00, 0x97, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xD0,
-    0x7F, 0xFF, 0x40, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0B, 0xC0, 0x7F, 0x03, 0xF4,
-    0x3F, 0x42, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07,
-    0xE0, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x02, 0xF4,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x2E, 0xF0, 0x10, 0x0F, 0xFD, 0x7F, 0x3F, 0xBD, 0x07, 0xFF, 0xFF, 0x0F, 0xFE,
-    0x02, 0xE7, 0xFE, 0x01, 0xFD, 0x00, 0xF8, 0x14, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x7E, 0x40,
-    0x00, 0x7F, 0xFF, 0x4F, 0x00, 0x00, 0x3F, 0xFF, 0xC3, 0xC0, 0x00, 0x2F, 0xFF, 0xF1, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFC, 0xB4, 0x00, 0x07, 0xFF, 0xFE, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
-    0xBF, 0xFF, 0xC3, 0xC0, 0x00, 0x2F, 0xFF, 0xF1, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0xB4, 0x00, 0x00,
-    0xFF, 0xFE, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xB7, 0xC3, 0xC0, 0x00, 0x00,
-    0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x3D, 0x00, 0x00, 0x00,
-    0x0B, 0x4F, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x00, 0x00,
-    0x78, 0xF4, 0x00, 0x00, 0x00, 0x2D, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x10, 0x0F,
-    0xFD, 0x00, 0x00, 0x2E, 0x5F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x01, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x50, 0x03, 0xFC,
-    0x06, 0xFD, 0x00, 0x7C, 0x00, 0xFC, 0x03, 0xF0, 0x2F, 0xC0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBC, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x2F,
-    0xFF, 0x42, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xD0,
-    0xBC, 0x03, 0xE0, 0x1F, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x2F, 0x00, 0xFC, 0x0B, 0xC0,
-    0x7D, 0x02, 0xF0, 0x7E, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xD0, 0x01, 0x00, 0x04, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x2F, 0xC0, 0xFE,
-    0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0xFD, 0x0B, 0xF0, 0x03, 0xF4, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x7E, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2C, 0x00, 0xBC, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x00,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x3D, 0xB8, 0x1F, 0xFF, 0x40, 0x07,
-    0xC0, 0x00, 0xF8, 0xF4, 0x3F, 0xFF, 0x40, 0x0F, 0x40, 0x03, 0xE0, 0xF4, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0xFD, 0x57, 0xF5, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x6A, 0xAB, 0xE9, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x40, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x1B, 0xA0, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x01, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x07, 0xF9, 0xFE, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x0F, 0x80, 0x3F, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x0B, 0x00, 0x3E, 0x1F, 0xFF, 0x40, 0x2F,
-    0x00, 0x00, 0x00, 0x7D, 0x3F, 0xFF, 0x40, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x55, 0x50, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0x80, 0x7C,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3A, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x3D, 0x00, 0x03, 0xDB, 0x86,
-    0xBF, 0xF8, 0x00, 0x3E, 0x00, 0x03, 0xE3, 0xD1, 0xFF, 0xE0, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0xF4,
-    0x15, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF5, 0x5F, 0xD4, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x1A, 0xAA, 0xFA, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFD, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xAF, 0xC0, 0x00,
-    0x2F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7E, 0x00, 0x10, 0xFF, 0xAF, 0xC1,
-    0xFF, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40,
-    0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B,
-    0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00,
-    0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF6, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x80, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xEA, 0xAB, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xAA, 0xA8, 0x00, 0x00, 0x00,
-    0x0F, 0xEA, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xEA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x40, 0x00,
-    0x03, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x74, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xFD, 0x55, 0xAF, 0xC0,
-    0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03,
-    0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F,
-    0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA,
-    0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xBE,
-    0x00, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F,
-    0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00,
-    0xBF, 0x43, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x2D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x05,
-    0x6F, 0xD5, 0x50, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x0A, 0xBF, 0xEA, 0xA0, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xD1, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B,
-    0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x28, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-    0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD,
-    0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0x07, 0xF8, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x7D, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x02, 0xF8, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0x0B, 0xD0,
-    0x0F, 0xD0, 0x2F, 0x43, 0xF4, 0x00, 0xBD, 0x0D, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x2C, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xCB, 0xC0, 0x00, 0x1F, 0xF9, 0x57, 0xFF, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x03,
-    0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x07, 0xF0, 0x03,
-    0xF4, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xF8,
-    0x00, 0xBF, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x1F, 0x80, 0x00, 0xFD, 0x00,
-    0xBF, 0x07, 0xD0, 0x00, 0x1F, 0xC0, 0x0B, 0xF1, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xBD, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x2F, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80,
-    0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xF0,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00,
-    0x01, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81,
-    0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x06, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0x50, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFA, 0xBF, 0xF0, 0x00, 0x0B, 0xD0, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xFD, 0x54,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2E,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xD1, 0xD0, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x7E, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x01, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE,
-    0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00,
-    0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0,
-    0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00,
-    0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0,
-    0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0x7E,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B,
-    0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F,
-    0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0,
-    0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xB0, 0x00, 0x07,
-    0xFF, 0x4F, 0x00, 0x00, 0xF9, 0xFF, 0xF0, 0x00, 0x0F, 0x07, 0xFC, 0x00, 0x00, 0x10, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00,
-    0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01,
-    0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD,
-    0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E,
-    0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x05, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xFD, 0x07,
-    0xF0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF,
-    0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80,
-    0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F,
-    0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00,
-    0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x3C, 0x00, 0x00, 0x3D, 0x03, 0xC0, 0x00,
-    0x02, 0xF0, 0xB8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F,
-    0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-    0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08,
-    0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80,
-    0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x1F, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0xBF, 0x96, 0xFF, 0x80, 0xBD, 0x02,
-    0xFC, 0x00, 0x7E, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x01, 0xF4, 0x01,
-    0xFC, 0x1F, 0x80, 0x03, 0xF0, 0x0B, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x7F, 0xC0, 0x3F, 0x00, 0x0B,
-    0xEB, 0xFD, 0x00, 0x7E, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7E, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBD,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0xFF, 0xD0, 0x00, 0x20, 0xBF, 0x03, 0xDB, 0xF0, 0x01,
-    0xF4, 0x7F, 0xAF, 0x83, 0xFD, 0x6F, 0xE0, 0x3F, 0xFE, 0x02, 0xFF, 0xFF, 0x40, 0x1F, 0xF4, 0x00,
-    0xBF, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFC, 0x03, 0xF9, 0xBE, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x87, 0xF0, 0x01, 0xF0, 0xFF, 0x9B, 0xF4, 0x2F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xAF, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x3E,
-    0x00, 0x7D, 0x0B, 0xC0, 0x0B, 0xD0, 0xF8, 0x01, 0xFC, 0x2F, 0x00, 0xBF, 0x03, 0xF0, 0x7F, 0xC0,
-    0x7F, 0xBF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x02, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0xE6, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0x40, 0xBC, 0x00, 0xBD, 0x03, 0xE0, 0x07, 0xF0, 0x2F,
-    0x00, 0xBF, 0x00, 0xFC, 0x1F, 0xF0, 0x07, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x1F, 0xC0, 0x07, 0xD0, 0x3F, 0xE6, 0xFE,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x0B, 0xC3, 0xF0, 0x00,
-    0xBD, 0x07, 0xC0, 0x07, 0xD0, 0x0F, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0x80, 0x1F,
-    0x40, 0xBC, 0x00, 0xBD, 0x03, 0xE0, 0x07, 0xF0, 0x2F, 0x00, 0xBF, 0x00, 0xFC, 0x1F, 0xF0, 0x07,
-    0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x20, 0x1F, 0xC0, 0x07, 0xD0, 0x3F, 0xE6, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x7F, 0x82,
-    0xFC, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xB4, 0x00, 0x3F, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0xFF, 0xF4, 0x15, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B,
-    0xD0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xF8,
-    0x20, 0xFD, 0x3C, 0x3F, 0xFE, 0x0F, 0xFE, 0x03, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x3F, 0xFD, 0x00,
-    0x15, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x82,
-    0x00, 0x3F, 0x4F, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7E, 0xFC, 0x01, 0xF4, 0xBC, 0x03,
-    0xE0, 0x3E, 0x0F, 0x80, 0x2E, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x3F, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x82, 0x00, 0x3F, 0x4F, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0,
-    0x00, 0x04, 0x00, 0x00, 0x01, 0x40, 0x05, 0x02, 0xFC, 0x0F, 0xD0, 0xFF, 0x07, 0xF4, 0x3F, 0x41,
-    0xFC, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC,
-    0x00, 0x0F, 0xFF, 0x40, 0x01, 0x5F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x82, 0x00, 0x0F, 0xD3, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x08, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x0B, 0x42, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x1B, 0xFE, 0x7C, 0x00, 0xBF, 0xFF, 0xFD, 0x02, 0xFD, 0x07, 0xFD, 0x0B, 0xF0, 0x01,
-    0xFE, 0x0F, 0xC0, 0x00, 0xFE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00,
-    0xBD, 0xBE, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x01, 0xF4, 0xFD, 0x00, 0x02,
-    0xF0, 0xFD, 0x00, 0x07, 0xE0, 0xBF, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x2C, 0x00, 0x00, 0x7F, 0xF4, 0xF0, 0x00, 0x03, 0xE7, 0xFF, 0xC0, 0x00, 0x0F, 0x07, 0xFC,
-    0x00, 0x00, 0x04, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF8, 0x07, 0xFF, 0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F,
-    0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x07, 0xDF, 0x40, 0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0,
-    0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF,
-    0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F, 0x0B, 0xC0, 0x00, 0xFE, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80,
-    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x7F, 0x81, 0xC0, 0x00, 0x7F, 0xF4, 0xF4, 0x00, 0x3F, 0x3F, 0xFC, 0x00, 0x0F, 0x03, 0xFC, 0x00,
-    0x00, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xF9, 0x1F, 0xF0, 0x03, 0xF4, 0x00,
-    0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x07, 0xE0, 0xBE,
-    0x00, 0x03, 0xF4, 0x2F, 0x80, 0x02, 0xF8, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x02, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x05, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x01,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xE4, 0x7F, 0xC0, 0x0F, 0xD0, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x02,
-    0xF4, 0x7F, 0x00, 0x00, 0xFD, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x1F, 0x82, 0xF8, 0x00,
-    0x0F, 0xD0, 0xBE, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x07, 0xF0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x81, 0xD0, 0x00, 0x0F, 0xFF, 0xFE, 0xF4, 0x00, 0x0F, 0xE4, 0x7F, 0xF0, 0x00, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xFF, 0x80, 0x02, 0xF4, 0x03,
-    0xEB, 0xE0, 0x00, 0xFC, 0x07, 0xD2, 0xF4, 0x00, 0x7F, 0x07, 0xD0, 0xFD, 0x00, 0x1F, 0x8B, 0xC0,
-    0x3F, 0x00, 0x0B, 0xEB, 0xC0, 0x1F, 0x80, 0x02, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B,
-    0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xF8, 0x0B, 0xF4, 0x00, 0x2F, 0xBF, 0xFF, 0xF0,
-    0x00, 0x0F, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC,
-    0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00,
-    0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7,
-    0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8, 0x02, 0xEF, 0x42, 0x07, 0xE0,
-    0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xE0, 0x0F,
-    0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0x0F,
-    0xC0, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFC, 0x00, 0x0B, 0xC1, 0xFF, 0xF0, 0x00, 0x7F, 0x01, 0x5F, 0xC0, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x7E,
-    0x02, 0xF3, 0xC3, 0xC1, 0xFD, 0x7F, 0x1F, 0xBE, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0xFE, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00,
-    0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00,
-    0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xF4, 0x00, 0x01, 0xF4, 0xBF, 0xFC, 0x00, 0x02, 0xF2,
-    0xFA, 0xFE, 0x00, 0x03, 0xE7, 0xC0, 0xBF, 0x00, 0x03, 0xEF, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0xD0, 0x7F, 0x40, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xFA, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00,
-    0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4,
-    0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00,
-    0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF7, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFE, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8,
-    0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00,
-    0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7,
-    0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x24, 0x00, 0x0B, 0xD0, 0x0F, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0,
-    0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07,
-    0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3,
-    0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00,
-    0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0,
-    0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF,
-    0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xC0, 0x01, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00,
-    0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFE, 0x6F, 0x80, 0x0F, 0xC0, 0x04,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x20, 0x1F, 0xC0, 0x07, 0xC0, 0x3F, 0xE6, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x7D, 0x00, 0x00, 0x78, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B,
-    0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01, 0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C,
-    0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBD, 0x07,
-    0xC0, 0x07, 0xD0, 0x0F, 0x00, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFE, 0x6F, 0x80, 0x0F, 0xC0, 0x04, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x20,
-    0x1F, 0xC0, 0x07, 0xC0, 0x3F, 0xE6, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFA, 0x5B, 0xFE, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x01,
-    0xFD, 0x00, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x00, 0x7C, 0x0B, 0xE0, 0x00, 0x00, 0x74, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xD0, 0x0B,
-    0xFF, 0xAA, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x0F, 0xFF, 0xF0, 0x0F, 0xE6, 0xF8, 0x0F, 0xC0, 0x04, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x02, 0x1F, 0xC0, 0x07, 0xC3, 0xFE, 0x6F, 0xD0, 0xBF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x0F,
-    0x80, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xE9, 0x6F, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x7D, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xC0, 0x2F, 0x80, 0x00, 0x01, 0xD0, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0x80, 0x1F, 0xF8, 0x00, 0x0B, 0xD0,
-    0x02, 0xFF, 0xEA, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x1F,
-    0x02, 0xF4, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFE, 0x6F, 0x80, 0x03, 0xF0, 0x01, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x02, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x3F, 0xE6, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x0F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02,
-    0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD, 0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0xBC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0x5B, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x7B, 0xD0,
-    0x80, 0x00, 0xBF, 0x02, 0xF3, 0xD2, 0xD0, 0x00, 0x7F, 0xEF, 0xC3, 0xEF, 0xC0, 0x00, 0x3F, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xA6, 0xF8, 0x06, 0xFF, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFE, 0x05, 0x6F, 0xD5, 0x50, 0x00, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x0A, 0xBF,
-    0xEA, 0xA0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFD,
-    0x01, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0A, 0xAF, 0xE9, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x01, 0xB8, 0x3F, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0x00, 0x00, 0x7F, 0xEF,
-    0xFE, 0x00, 0x01, 0xFC, 0x02, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x00, 0xBE,
-    0x00, 0x7B, 0xD0, 0x80, 0xBF, 0x02, 0xF3, 0xD2, 0xD0, 0x7F, 0xEF, 0xC3, 0xEF, 0xC0, 0x3F, 0xFF,
-    0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15,
-    0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xAA,
-    0xAF, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00,
-    0x0E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x40, 0x00, 0xBE, 0x00, 0x00, 0xF0,
-    0x00, 0x3F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xF5, 0x6A, 0xBF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xF0, 0x2F,
-    0x40, 0x3E, 0x00, 0x7D, 0x02, 0xF0, 0x02, 0xF4, 0x0F, 0x80, 0x1F, 0xC0, 0xBC, 0x02, 0xFC, 0x03,
-    0xF0, 0x7F, 0xC0, 0x1F, 0xEF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x80, 0x7F, 0x00, 0x1F, 0x40, 0xFF, 0x9B, 0xF8, 0x02, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xD6, 0xF4, 0x00, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA, 0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC,
-    0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03,
-    0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x2F, 0xEB,
-    0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B,
-    0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x10,
-    0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80,
-    0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xFF, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x3E, 0x00, 0x7D, 0x0B, 0xC0, 0x0B, 0xD0, 0xF8, 0x01,
-    0xFC, 0x2F, 0x00, 0xBF, 0x03, 0xF0, 0x7F, 0xC0, 0x7F, 0xBF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0xBF,
-    0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0xE6, 0xFE,
-    0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07, 0xD0, 0xBC, 0x00, 0xBD, 0x0F, 0x80,
-    0x1F, 0xC2, 0xF0, 0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB, 0xFE, 0x00, 0x7F, 0xFD, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x7F, 0x00, 0x1F, 0x43, 0xFE, 0x6F,
-    0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x06, 0x40, 0x00, 0x01, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0xBE, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xEA, 0xAB, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x0E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFE, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x1F, 0xD5, 0xAA, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x1F, 0x02, 0xF4, 0x00, 0x0F, 0x8B,
-    0xD0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F, 0x80, 0x1F,
-    0xC0, 0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x1F,
-    0x40, 0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x3E,
-    0x00, 0x00, 0x0F, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0,
-    0x3F, 0x40, 0x00, 0x00, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0xFF, 0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF,
-    0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF,
-    0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0,
-    0x00, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x90, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xD9, 0x00, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x07,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE,
-    0x7F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0xFE, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0x00, 0x00, 0x07, 0xD0, 0x07, 0x80,
-    0x00, 0x01, 0xFE, 0x5F, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC, 0x00,
-    0xBF, 0x40, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0, 0x3F,
-    0x40, 0x00, 0x00, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0xFF, 0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF, 0x00,
-    0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x34, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00,
-    0x00, 0xBF, 0xAF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0xFD, 0x90,
-    0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00, 0x2F, 0xD0, 0x02,
-    0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00,
-    0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xA5, 0xBF, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0xFD, 0x00, 0x00, 0x03, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x6F, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xE0, 0x00, 0x01,
-    0x6F, 0xD2, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0xBD, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xFF, 0x96, 0xBF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF4, 0x0F, 0xD9, 0x00, 0x00, 0xBD,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x40,
-    0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFE, 0xAF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x6A, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xE9, 0x6F, 0xFC, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x03, 0xD0, 0x3F, 0x40, 0x00, 0x00,
-    0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xFF,
-    0xDB, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x5B, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0xFC,
-    0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xF4, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x40,
-    0xFD, 0x90, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x01, 0xFC,
-    0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE7, 0xFF, 0xC0, 0x00, 0x2F,
-    0xD0, 0x02, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x0B,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xEA, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1B, 0xF4, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0x1F, 0x80, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0x01, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x7F, 0xC0, 0x01, 0xF4, 0x3F, 0xFE, 0x00, 0x2F, 0x0F, 0xEF, 0xF0, 0x03, 0xF3, 0xE0,
-    0x3F, 0x00, 0x3E, 0xB8, 0x03, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00, 0xBF, 0xC0, 0x0B, 0xC0, 0x0F,
-    0xF4, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x2F,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07, 0xD2, 0xD7, 0xE0,
-    0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x6F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xAF,
-    0xFA, 0x90, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2A, 0x40, 0x01, 0xF4, 0x1F, 0xFD, 0x00, 0x2F, 0x0B, 0xFF, 0xF0, 0x03, 0xF2,
-    0xF4, 0x7F, 0x00, 0x3E, 0xBC, 0x07, 0xE0, 0x07, 0xEF, 0x00, 0x7D, 0x00, 0xBF, 0xC0, 0x0B, 0xD0,
-    0x0F, 0xF8, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0x80, 0x0F, 0xD0, 0x01, 0xF4, 0x01, 0xFC, 0x00,
-    0x2F, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x08, 0x3F, 0x00, 0x07, 0xD2, 0xD7,
-    0xE0, 0x00, 0xBF, 0xFC, 0xBD, 0x00, 0x0B, 0xFF, 0x0F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x0D, 0x00, 0x0B, 0xFD, 0x1E, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x1E,
-    0x0F, 0xFC, 0x00, 0x0C, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x7F, 0x81, 0xC0, 0x7F, 0xF4, 0xF4, 0x3F, 0x3F, 0xFC, 0x0F, 0x03, 0xFC, 0x00, 0x40,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x57, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x80, 0x03, 0xF4, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x01, 0x55,
-    0x55, 0x02, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x08, 0x00, 0x3F,
-    0x4F, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0x00, 0x0F, 0x80, 0x0E, 0x00, 0x0F, 0xE5, 0xBD,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x90, 0x7D, 0x00, 0xB4, 0x1F, 0xFB, 0xF8, 0x02, 0xFF, 0xF8,
-    0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x57, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x80, 0x03, 0xF4, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0x54,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xC0, 0x3F, 0xFD, 0x01, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x20,
-    0x3F, 0x4F, 0x03, 0xFF, 0xE0, 0x3F, 0xF8, 0x03, 0xFE, 0x00, 0x0B, 0x80, 0x01, 0xE0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x03, 0xFF, 0xD0, 0x57, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x83, 0xF4, 0xF0, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xF4, 0x00, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xD0, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x0F, 0xC0, 0x00,
-    0xBF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0xFD, 0x01, 0xFF, 0xF0, 0x15, 0xFC,
-    0x00, 0x57, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00,
-    0x2F, 0x82, 0x00, 0x7E, 0x00, 0x3F, 0x4F, 0x00, 0xBD, 0x00, 0x3F, 0xFE, 0x00, 0xFC, 0x00, 0x3F,
-    0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xF4, 0x00, 0x04, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x10, 0x0F, 0xC0, 0x00, 0x00, 0xB8, 0x7F,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x7F,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x28, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x0B, 0xD3, 0xF0,
-    0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x07, 0xD0, 0x0B, 0x40, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x57, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x1E, 0x5B, 0xD0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x00, 0x6F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xF8, 0x00,
-    0xF8, 0xBF, 0xFD, 0x00, 0xFB, 0xE0, 0xBD, 0x01, 0xFF, 0x40, 0x7D, 0x02, 0xFD, 0x00, 0xBC, 0x03,
-    0xF8, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x07, 0xD0, 0x7F, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x1F, 0x43, 0xF8, 0x00, 0x2F,
-    0x01, 0xFE, 0x00, 0x3F, 0x00, 0xBF, 0xD0, 0x3F, 0x00, 0x2F, 0xFF, 0x7D, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x3F, 0xC7, 0xFF, 0x80, 0x7F, 0xF0,
-    0x57, 0xE0, 0x7F, 0xFC, 0x01, 0xF4, 0x7E, 0x00, 0x00, 0x7C, 0x7D, 0x00, 0x00, 0x2F, 0x3D, 0x00,
-    0x00, 0x0F, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xBE, 0xF8,
-    0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x07, 0xE0, 0xFD, 0x00, 0x42, 0xF4,
-    0x1F, 0xC0, 0xE0, 0xBC, 0x03, 0xFE, 0xF4, 0x3F, 0x00, 0x3F, 0xF8, 0x0F, 0x80, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xE0,
-    0x0B, 0xE0, 0x00, 0x0B, 0x80, 0x3F, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x07, 0xF5,
-    0x6A, 0xAF, 0x82, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF4, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x05, 0x00, 0x3F, 0x1E, 0x00, 0x7F, 0xFD, 0x00, 0x7F, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x6F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40,
-    0x3F, 0x00, 0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC1, 0x40, 0x3F, 0x1E, 0x01, 0xFF, 0xF4, 0x07,
-    0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0xFF,
-    0xF0, 0xBC, 0x00, 0x3F, 0xFF, 0xE0, 0xF8, 0x00, 0x06, 0xFD, 0x00, 0xF4, 0x00, 0x02, 0xF4, 0x00,
-    0xF0, 0x00, 0x03, 0xF4, 0x01, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x38, 0x00, 0xBE, 0x00, 0x00, 0xB8, 0x00, 0xFD, 0x00, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x02,
-    0xF0, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x05, 0x40, 0xBC, 0x0B,
-    0xFF, 0x43, 0xE0, 0x3F, 0xFD, 0x0F, 0x00, 0x02, 0xF0, 0x78, 0x00, 0x0F, 0xC1, 0xC0, 0x00, 0x3F,
-    0x01, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x05, 0x00, 0x00, 0xFC, 0x78,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x14, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x38, 0x00, 0xBE, 0x00, 0x00, 0xB8, 0x00, 0xFD, 0x00, 0x00, 0xF4,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x10, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x03, 0xFC, 0x03, 0xE0, 0x3F, 0xC0, 0x7D, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x50,
-    0x00, 0x3F, 0x1E, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xE0, 0x00, 0x00, 0x3F,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x38, 0x02, 0xF8, 0x00, 0x02, 0xE0, 0x0F, 0xD0, 0x00, 0x0F, 0x40, 0x3F, 0x00,
-    0x00, 0xBC, 0x01, 0xFD, 0x5A, 0xAB, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF9, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x14, 0x00, 0x3F, 0x1E, 0x00, 0x1F, 0xFF, 0x40, 0x07,
-    0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0,
-    0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x2F, 0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x80, 0x07, 0xD7,
-    0xD0, 0xBD, 0x00, 0x1F, 0x7D, 0x02, 0xF4, 0x00, 0xBE, 0xD0, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0x3F,
-    0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x42, 0x0B, 0xD0, 0x00,
-    0xFC, 0x7C, 0x2F, 0x00, 0x03, 0xFB, 0xE0, 0xFC, 0x00, 0x0F, 0xFE, 0x03, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x0B, 0xF8, 0x07, 0xFF,
-    0x81, 0xFF, 0xF4, 0x05, 0x7E, 0x1F, 0xEF, 0xE0, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x07, 0xDF, 0x40,
-    0xBD, 0x00, 0x2F, 0xB4, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x7E, 0x00,
-    0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x82, 0xF4, 0x00, 0x3F, 0x1F, 0x0B, 0xC0, 0x00, 0xFE,
-    0xF8, 0x3F, 0x00, 0x03, 0xFF, 0x80, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x06, 0x40, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x01, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x2F,
-    0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0xD0, 0x15, 0xF8, 0x7F, 0xBF, 0x80, 0x07, 0xD7, 0xD0, 0xBD, 0x00,
-    0x1F, 0x7D, 0x02, 0xF4, 0x00, 0xBE, 0xD0, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0x00, 0x0F, 0xF0,
-    0x01, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x2F, 0x42, 0x0B, 0xD0, 0x00, 0xFC, 0x7C, 0x2F,
-    0x00, 0x03, 0xFB, 0xE0, 0xFC, 0x00, 0x0F, 0xFE, 0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x01, 0xBF, 0x40, 0x2F, 0xE0, 0x1F, 0x01, 0xFF, 0xE0, 0x7F, 0xFD,
-    0x01, 0x00, 0x15, 0xF8, 0x7F, 0xBF, 0x40, 0x00, 0x00, 0x7D, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x7D, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x2F, 0x02, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x3F, 0x00, 0x03,
-    0xFB, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x83, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xBF, 0x87,
-    0xFF, 0x81, 0xFF, 0xF4, 0x57, 0xE1, 0xFE, 0xFE, 0x01, 0xF5, 0xF4, 0x2F, 0x40, 0x7D, 0xF4, 0x0B,
-    0xD0, 0x2F, 0xB4, 0x03, 0xF0, 0x0F, 0xF8, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x7E, 0x01, 0xFD, 0x00,
-    0x2F, 0x40, 0xBF, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x07, 0xE0,
-    0x00, 0xBD, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xE0, 0x0F,
-    0x80, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x2D, 0x1F, 0xC0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE5, 0x5F, 0xFC, 0x00,
-    0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x01, 0xFF,
-    0x00, 0x02, 0xFF, 0x41, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x3F, 0x91, 0xFF, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x2F, 0x80, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x0B, 0xD1, 0xFC, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00,
-    0xFC, 0x2F, 0x80, 0x00, 0x7E, 0x0B, 0xE0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x2F, 0x80, 0x7F, 0x00,
-    0x1F, 0xC0, 0x0F, 0xF0, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x20, 0x00,
-    0x00, 0x03, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xF5, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x07,
-    0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x90, 0x00, 0x7D, 0x00, 0xB4, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x03, 0xF9, 0x1F, 0xF0, 0x03, 0xF4, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x3F, 0x41, 0xFC, 0x00,
-    0x0B, 0xE0, 0xBD, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x00, 0x3F, 0x47, 0xE0,
-    0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x02, 0xF8, 0x07,
-    0xF0, 0x01, 0xFC, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x0B,
-    0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF9,
-    0x57, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x3F, 0x43, 0xF4, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xF4,
-    0x0F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x47, 0xFC, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x00,
-    0xBE, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0x00,
-    0xBE, 0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFA, 0x5B, 0xFA, 0xAA, 0xBF, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x0F, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x07, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xEA, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x04, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x38, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xE0, 0x07, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x0B, 0xFE, 0x00, 0x7F, 0xD5, 0xAA, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0x07, 0xFF, 0xF8, 0x03, 0xF9, 0x1F, 0xEB, 0xD0, 0x7F, 0x03, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xC2,
-    0xF8, 0x00, 0x3F, 0xD0, 0x07, 0xE1, 0xFC, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0xBD, 0x00, 0x02, 0xF8,
-    0x03, 0xF8, 0x3F, 0x00, 0x00, 0xBC, 0x0B, 0xF4, 0x1F, 0xC0, 0x00, 0x3F, 0x7F, 0xE0, 0x07, 0xE0,
-    0x00, 0x0F, 0xFF, 0x80, 0x02, 0xF8, 0x00, 0x07, 0xF9, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xFF, 0x00, 0x01, 0x47, 0xF0, 0x01, 0xFF, 0xD0, 0x02, 0xF0, 0xFF, 0x02,
-    0xFF, 0xFE, 0x6F, 0xF0, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xF4, 0x07, 0xFF, 0xD0,
-    0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00,
-    0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02,
-    0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x0F, 0xD7, 0xFF, 0xC3, 0xFE, 0x15, 0xF8, 0xFF, 0xD0, 0x0F, 0x5F, 0x58, 0x01, 0xF7,
-    0xC0, 0x00, 0x1F, 0xB4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80,
-    0xBF, 0x80, 0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD,
-    0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBD, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0xFD, 0x07, 0xFF, 0xC3, 0xFE, 0x01, 0x5F,
-    0x8F, 0xFD, 0x00, 0x0F, 0x5F, 0x58, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x1F, 0xB4, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x28, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0x6F, 0x80, 0xBF, 0x80,
-    0x00, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x9B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x08, 0x00, 0x24, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x0F, 0xD0,
-    0x7F, 0xFC, 0x3F, 0xE0, 0x15, 0xF8, 0xFF, 0xD0, 0x00, 0xF5, 0xF5, 0x80, 0x01, 0xF7, 0xC0, 0x00,
-    0x01, 0xFB, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0,
-    0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xF9, 0x5F, 0x80, 0x0F, 0xC0,
-    0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x03,
-    0x40, 0x07, 0xE0, 0x2F, 0x00, 0x1F, 0x00, 0xBF, 0x91, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF0,
-    0x00, 0xB4, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0xBD, 0x00,
-    0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x18, 0x00, 0x02, 0xFC,
-    0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x03,
-    0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xC0, 0x0F, 0x00, 0x18, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0,
-    0x01, 0xF9, 0x5F, 0x80, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x02, 0xF8, 0x03, 0x40, 0x07, 0xE0, 0x2F, 0x00, 0x1F, 0x00, 0xBF, 0x91, 0xF8,
-    0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00,
-    0x1F, 0x40, 0xBD, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x0F, 0xD0, 0x00, 0x60, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0,
-    0x18, 0x00, 0x02, 0xFC, 0x0F, 0x00, 0x00, 0x3F, 0x07, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07,
-    0xE0, 0xBE, 0x00, 0x03, 0xF0, 0x2F, 0xE4, 0x07, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x07, 0xFF, 0xF8, 0x07, 0xE5, 0x7E, 0x03, 0xF0, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xBE, 0x0D, 0x00, 0x1F, 0x8B, 0xC0, 0x07, 0xC2, 0xFE, 0x47, 0xE0, 0x7F, 0xFF, 0xE0,
-    0x07, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xAF, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x01, 0x90, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00,
-    0x3F, 0x8F, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x0B, 0xF4, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0x2F, 0x40, 0x01, 0xF0,
-    0x03, 0xF0, 0x00, 0x1E, 0x00, 0x3F, 0x40, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x18, 0x00, 0x02,
-    0xFC, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0xBE,
-    0x00, 0x03, 0xF0, 0x0B, 0xF9, 0x01, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x0F, 0xEF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xF9, 0x5F, 0x80, 0x03, 0xF0, 0x01, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x34, 0x00,
-    0x7E, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0xBF, 0x91, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C,
-    0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF8, 0x56, 0xF9, 0x54,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x03,
-    0x80, 0xBD, 0x07, 0xE0, 0x2F, 0xEF, 0xF0, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xA0,
-    0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x7E, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00,
-    0x3C, 0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x11, 0xF0,
-    0x00, 0x1F, 0x2D, 0x00, 0x03, 0xE2, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1A, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x56, 0xF9, 0x54, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x38, 0x02, 0xF4, 0x1F, 0x80, 0x2F,
-    0xEF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00,
-    0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00, 0xFC, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x57, 0xF9, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xAF, 0xFA, 0x80, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF8, 0x56, 0xF9, 0x54, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x5B, 0xF5, 0x54, 0xBF, 0xFF, 0xFE, 0x15, 0xFE, 0x55, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x03, 0x80, 0xBD, 0x07, 0xE0, 0x2F, 0xEF,
-    0xF0, 0x0B, 0xFF, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x1D, 0x00, 0x00, 0x3F, 0xF8, 0xF4, 0x00, 0x02, 0xF6, 0xFF, 0xC0, 0x00, 0x0B,
-    0x43, 0xFD, 0x00, 0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05,
-    0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E,
-    0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9,
-    0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F,
-    0xC0, 0x57, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40,
-    0x07, 0xE0, 0x0B, 0xBD, 0x08, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x7F, 0x5F, 0xC7, 0xEF, 0x80, 0xFF,
-    0xFC, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0xBF, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F,
-    0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x7E, 0x00,
-    0xB4, 0x00, 0x00, 0xFF, 0xAF, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0,
-    0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-    0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F,
-    0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x3D, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x1F, 0x07,
-    0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x02, 0xF0, 0x7F, 0xFC, 0x00, 0x1F, 0xC0, 0x57, 0xF0,
-    0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B,
-    0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xE0, 0x0B,
-    0xBD, 0x08, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x7F, 0x5F, 0xC7, 0xEF, 0x80, 0xFF, 0xFC, 0x0F, 0xFC,
-    0x02, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x02,
-    0xF8, 0x03, 0xF4, 0x00, 0x00, 0x01, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03,
-    0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9,
-    0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x7C, 0x0B, 0xC0,
-    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x1F,
-    0x81, 0xF8, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBC, 0x1F, 0xFF, 0x00, 0x07, 0xF0, 0x15,
-    0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-    0x02, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0xD0, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x07, 0xE0, 0x2F, 0x3C, 0x3C, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x3F, 0xFF, 0x03,
-    0xFF, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x10, 0x00, 0x04, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD5,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x05, 0x7F, 0x00,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x7E, 0x00, 0xBB,
-    0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0xC0,
-    0x2F, 0xF8, 0x03, 0xFC, 0x00, 0x04, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x06, 0x40, 0x02, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0xF8,
-    0x00, 0x3F, 0xFF, 0xD0, 0x7F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xD0, 0x02, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x3F, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x07, 0xDB, 0xD0, 0x03, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0xBD, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x7E, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x07, 0xE0, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC7, 0xD0, 0x03, 0xF1,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x02,
-    0xFB, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBF, 0x00,
-    0x1F, 0xC0, 0x07, 0xF1, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0xFE, 0x16, 0xF8, 0x00, 0xFE, 0x00, 0x3F,
-    0x80, 0x3F, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x0F, 0xC0, 0x07, 0xF0, 0x02, 0xF4, 0x02, 0xF4, 0x02,
-    0xFC, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0xFF, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x3F, 0xD0, 0x0F, 0x40,
-    0x03, 0xF0, 0x2F, 0xF8, 0x0B, 0xC0, 0x00, 0xBC, 0x0F, 0x7E, 0x03, 0xD0, 0x00, 0x2F, 0x0B, 0xCB,
-    0xC2, 0xF0, 0x00, 0x07, 0xC3, 0xC2, 0xF0, 0xF4, 0x00, 0x01, 0xF2, 0xE0, 0x7C, 0xF8, 0x00, 0x00,
-    0x7E, 0xF0, 0x1F, 0xBC, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFB, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x7D, 0x00, 0x00,
-    0x07, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x7F, 0x80,
-    0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xEF, 0x80, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x7E, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x02,
-    0xE0, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00,
-    0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00,
-    0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F,
-    0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x7F,
-    0x81, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07,
-    0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB,
-    0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBE, 0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07,
-    0xF0, 0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x7F, 0xE0, 0x0E, 0x00, 0x0F,
-    0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF, 0xFF, 0xF0, 0xB8, 0x1B, 0xFF,
-    0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x90, 0x00, 0x64, 0x00, 0x01, 0xF4, 0x02, 0xF8, 0x00,
-    0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0xAA, 0xAA,
-    0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07, 0xF0, 0x00, 0x02,
-    0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x2E,
-    0x00, 0xFC, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x40, 0x7C, 0x0B, 0xFF, 0xF4, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00,
-    0x7F, 0xE0, 0x0E, 0x00, 0x0F, 0xC0, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x50, 0x2F, 0xD0, 0x00, 0xF0, 0x7F, 0xFF, 0xFB, 0xF0, 0xFD, 0xFF,
-    0xFF, 0xF0, 0xB8, 0x1B, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x0A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x0B, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFE, 0xF8, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
-    0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x5F, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0x9F, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xE4, 0x7F, 0xC0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x7F, 0x00,
-    0x02, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7F, 0x00, 0x00, 0xFD,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBE,
-    0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF7, 0xF4, 0x07,
-    0xFC, 0x0F, 0xD0, 0xFC, 0x00, 0x3F, 0x43, 0xE0, 0x3F, 0x00, 0x0B, 0xE0, 0x64, 0x1F, 0xC0, 0x02,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x0B, 0xE1, 0x6F, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x42, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xF0, 0x00, 0x03, 0xE0, 0xBF,
-    0xFC, 0x00, 0x07, 0xE3, 0xFB, 0xFC, 0x00, 0x0B, 0xDB, 0x80, 0xFD, 0x00, 0x0B, 0xDE, 0x00, 0xBE,
-    0x00, 0x0F, 0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xE0, 0x00, 0xFD, 0x00,
-    0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x90,
-    0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFA, 0xFF, 0xD0, 0x00, 0x01, 0xF4, 0x14, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x55,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xBC, 0x00, 0x1A, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x56, 0xF9, 0x54, 0x02, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x38, 0x2F, 0x41, 0xF8, 0x2F, 0xEF, 0xF8,
-    0x2F, 0xFF, 0xF4, 0x0F, 0xFD, 0xF0, 0x00, 0x41, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x0F, 0x80, 0x7C, 0x2F, 0x00, 0xFF, 0xFD, 0x00, 0xBF, 0xF4, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xEA, 0xBF, 0xAA, 0xBE, 0xBF, 0x00, 0xBE,
-    0x00, 0x3D, 0xBD, 0x00, 0xBD, 0x00, 0x3C, 0xBC, 0x00, 0xFD, 0x00, 0x3C, 0x14, 0x00, 0xFC, 0x00,
-    0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x01, 0xF4, 0x3E,
-    0x00, 0x0F, 0x40, 0x10, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xE0, 0x15, 0xBE, 0x55, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0xE0, 0x02, 0xF4, 0x1F, 0x80, 0x0B, 0xFB, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C,
-    0x3C, 0x00, 0xFC, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0x80, 0x00, 0x00, 0x7F, 0x5F, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x96, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x1B, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x1F, 0x80,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF,
-    0x40, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x01, 0xF8, 0x0B, 0xCF, 0x0F, 0x00, 0x1F, 0xD7, 0xF1,
-    0xFB, 0xE0, 0x00, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00,
-    0x01, 0x00, 0x00, 0x04, 0x00, 0xF0, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x0F, 0xC0, 0x0F, 0x40,
-    0x08, 0x00, 0x90, 0x0B, 0xC0, 0x7F, 0x03, 0xF4, 0x3F, 0x42, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBE, 0xF8, 0x0B, 0xD3, 0xF0, 0x7D, 0x07, 0xD7,
-    0xD0, 0x0F, 0x49, 0x00, 0x04, 0x00, 0x40, 0x00, 0x0B, 0xF4, 0x2C, 0x2F, 0xFC, 0x7C, 0x3E, 0x7F,
-    0xF8, 0x3C, 0x1F, 0xF0, 0x00, 0x06, 0x40, 0x15, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xCB, 0xC0, 0x1F, 0x2F, 0xEB, 0xF4, 0x3F, 0xFF, 0x40, 0x2F,
-    0xE0, 0x00, 0x0B, 0x82, 0xFC, 0x3F, 0xC3, 0xF4, 0x04, 0x00, 0x05, 0x00, 0x14, 0x2F, 0x80, 0xFC,
-    0x3F, 0x82, 0xFC, 0x3F, 0x02, 0xF8, 0x04, 0x00, 0x50, 0x01, 0x54, 0x03, 0xFF, 0x83, 0xF7, 0xF1,
-    0xF0, 0x7C, 0x34, 0x2F, 0x00, 0x2F, 0x40, 0x3F, 0x40, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xFD, 0xBC, 0x2F, 0xF4, 0x1F, 0xF4, 0x1F, 0xF8, 0x3D, 0x7F, 0xFC,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x3E, 0x03, 0xD0, 0x2F, 0x82, 0xF8, 0x1F, 0xC1,
-    0xFC, 0x0F, 0xD0, 0xFD, 0x0F, 0xD0, 0xFD, 0x03, 0xC0, 0x7C, 0x00, 0x40, 0x04, 0x00, 0x14, 0x00,
-    0x61, 0xF0, 0x0B, 0xD7, 0xD0, 0xBD, 0x0F, 0xC7, 0xD0, 0x1F, 0xBE, 0x00, 0x3F, 0xE0, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x02, 0xE0, 0xB8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x1F, 0x47,
-    0xD0, 0xF8, 0x3E, 0x03, 0xC0, 0xF0, 0x10, 0x04, 0x00, 0x15, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0xFF,
-    0x4F, 0xD0, 0xBE, 0x74, 0x00, 0xF8, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x7D, 0x0F,
-    0x82, 0xF0, 0x3D, 0x0B, 0xD0, 0xFE, 0x0B, 0xF0, 0x3E, 0x00, 0x01, 0x90, 0x2F, 0xC0, 0x3F, 0x80,
-    0xFD, 0x03, 0xF0, 0x0F, 0x80, 0xBC, 0x07, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x06, 0x42, 0xFD, 0x3F,
-    0x87, 0xE0, 0x7D, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xFC, 0x3D,
-    0x1F, 0x0B, 0x83, 0xC0, 0xE0, 0x10, 0x00, 0x06, 0xC0, 0xBE, 0x0B, 0xE0, 0xFC, 0x3F, 0x47, 0xC0,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0x40, 0x78, 0x3F,
-    0x81, 0xFD, 0x7F, 0x42, 0xFC, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0F, 0xF8, 0x3E,
-    0x7C, 0x78, 0x2D, 0x78, 0x2D, 0x7C, 0x7C, 0x2F, 0xF4, 0x06, 0x40, 0x00, 0x40, 0x0F, 0xC0, 0x3F,
-    0x40, 0xFC, 0x03, 0xE0, 0x2F, 0x02, 0xF0, 0x05, 0x00, 0x00, 0x40, 0x07, 0xF8, 0x06, 0xFC, 0x00,
-    0xBC, 0x00, 0xF8, 0x03, 0xF0, 0x2F, 0x80, 0x18, 0x00, 0x00, 0x50, 0x0E, 0x00, 0xF0, 0x0B, 0x40,
-    0x3D, 0x00, 0xF9, 0x03, 0xFF, 0x82, 0xF8, 0x00, 0x03, 0xF0, 0xF8, 0x3D, 0x1F, 0x0B, 0xC3, 0xF0,
-    0xA4, 0x00, 0x16, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFE, 0x01, 0xFD, 0xFD, 0x1F, 0xC0, 0xFA, 0xF8,
-    0x01, 0xF1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x23, 0xD0, 0x03, 0x8F, 0xE5, 0xBD,
-    0x2F, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xF4, 0x2C, 0x2F,
-    0xFC, 0x7C, 0x3E, 0x7F, 0xF8, 0x3C, 0x1F, 0xF0, 0x00, 0x06, 0x40, 0x55, 0x55, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x0B, 0xFF, 0x80, 0xFF, 0xFF, 0x4F, 0xD0, 0xBE, 0x74, 0x00,
-    0xF8, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF,
-    0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x28, 0x3F, 0xC0, 0xFD, 0x7F, 0x82, 0xFD, 0x3F, 0x01, 0xFC, 0x04, 0x00, 0x50, 0x2A, 0x03,
-    0xD0, 0x7D, 0x0B, 0xE0, 0x7F, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF,
-    0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC,
-    0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xA6, 0xF8, 0x0B,
-    0xFC, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0x40, 0x1F, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x51, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x50, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x40, 0x00, 0x00, 0xF4, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0xF8,
-    0x00, 0x07, 0xF0, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x03, 0xF4, 0x1F, 0x40, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x55, 0x55, 0x56,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xBE,
-    0xAA, 0xAA, 0xFE, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xB0, 0x02, 0xFC, 0x00, 0x00, 0xF0, 0x07, 0xF0,
-    0x00, 0x02, 0xF0, 0x1F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0xEA, 0xAA, 0xAF, 0xD0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xD0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x56, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80,
-    0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x00, 0x02,
-    0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0x0F, 0xC0, 0x2F, 0xFF, 0x81, 0xFC, 0x7F, 0x03, 0xFF, 0xFD, 0x0B, 0xF2, 0xFC, 0x0F,
-    0xAA, 0x90, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xBF,
-    0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4, 0x17, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x00, 0x6F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xD0,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x02, 0xFE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC3,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xBF, 0x40, 0x00, 0x00,
-    0xBD, 0xF8, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x01,
-    0xF4, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0xBD, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0xBD, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x07,
-    0xC0, 0x7E, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0x80, 0x3F, 0x3E, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0x7C, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x00, 0x2F, 0xF4, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7D,
-    0x00, 0x1F, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F,
-    0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x7D, 0x00, 0x00,
-    0x0B, 0xCF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83,
-    0xF4, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x42, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x3F, 0x83, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x0F, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFB, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00,
-    0x0F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x34, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x34, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x40, 0x3F, 0xFF, 0xAB, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xEA, 0xAA, 0xBF, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xA6, 0xF8, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x1F, 0xC5,
-    0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFE, 0xAA, 0xAB, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xBC, 0x00, 0x0F,
-    0xE0, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x2F, 0x80, 0x01, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x74, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xAA, 0xBF, 0xAA, 0xBE, 0x3E, 0x00, 0xBE, 0x00, 0x3D, 0x3C, 0x00, 0xBD, 0x00, 0x3C,
-    0x3C, 0x00, 0xFD, 0x00, 0x3C, 0x38, 0x00, 0xFC, 0x00, 0x74, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x02, 0xF4, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xC7, 0xFF, 0xD0, 0x00, 0x2F, 0xF0,
-    0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xC0,
-    0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x80,
-    0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFE, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xE6, 0xFD, 0xBF, 0xE0, 0x01, 0xFE, 0x01, 0xF4, 0x0B, 0xF4, 0x07, 0xF0,
-    0x02, 0xF0, 0x02, 0xF8, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x07, 0xD0, 0x01, 0xFC, 0x3F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF8, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x3F, 0x80, 0x0F, 0xC0, 0x0B, 0xE0, 0x2F, 0xC0,
-    0x1F, 0x80, 0x2F, 0xC0, 0x0F, 0xF4, 0x1F, 0x42, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x3F,
-    0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFF, 0xE0, 0x0B, 0xD3, 0xF0, 0x1F, 0xFF,
-    0xF4, 0x0B, 0xE0, 0xFC, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xBE, 0x00,
-    0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0,
-    0x03, 0xF0, 0x03, 0xF4, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0xFD,
-    0x00, 0x0B, 0xF0, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0xFF, 0x4F, 0xC2, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x55, 0xBF, 0xD0,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0D, 0x0B, 0xC0, 0x00, 0x3F,
-    0x03, 0x42, 0xD0, 0x3F, 0x00, 0x1F, 0xC0, 0xB4, 0x3D, 0x00, 0xF8, 0x0B, 0xE0, 0x0F, 0x43, 0xFA,
-    0x9B, 0x80, 0xFD, 0xAB, 0xF0, 0x3F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x0F, 0x40, 0x07, 0xFF, 0xF0, 0x7F,
-    0x00, 0x7F, 0xAF, 0xE2, 0xF4, 0x03, 0xF0, 0x0B, 0xCF, 0xC0, 0x2F, 0x00, 0x0F, 0xBD, 0x01, 0xF8,
-    0x00, 0x3F, 0xF0, 0x0B, 0xC0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x07,
-    0xC0, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x1F, 0xE0, 0x02,
-    0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xF0, 0x1F, 0xDF, 0x01, 0x0F, 0xFB, 0xFC, 0x3F, 0xBD, 0x3F, 0xFF,
-    0xC0, 0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xF4, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x0B,
-    0xC0, 0x1F, 0x80, 0x07, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-    0x7D, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x7F, 0x00,
-    0x00, 0xF8, 0x7F, 0xF0, 0x00, 0x3E, 0x0A, 0xFF, 0x00, 0x1F, 0x40, 0x0F, 0xE0, 0x0B, 0xC0, 0x01,
-    0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xF0, 0x1F, 0x40,
-    0x00, 0xFC, 0x07, 0xD0, 0x00, 0x7E, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x3F,
-    0x90, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xEF, 0xFF, 0x40, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0x47, 0xFF, 0x80, 0x0B, 0xF0, 0x5B, 0xF0, 0x01, 0xFC, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0F, 0x80, 0x0B, 0xD0, 0x07, 0xD0, 0x01, 0xF8, 0x02, 0xF0,
-    0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xBC, 0x2F,
-    0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0x7F, 0x00, 0x0B,
-    0xC0, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0xFD, 0x0F, 0xE0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x0B,
-    0xE0, 0x3F, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0x07, 0xE0, 0x00, 0x1F, 0x82, 0xF8, 0x00,
-    0x07, 0xE0, 0xBE, 0x00, 0x02, 0xF4, 0x2F, 0xC0, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0xFF,
-    0x41, 0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x2F, 0xD4, 0x7E, 0x03, 0xE0,
-    0x00, 0x40, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0x00, 0x0F, 0xE9, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0x83, 0xFE, 0x56, 0xF8, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x40, 0x3F, 0x00,
-    0x2D, 0x03, 0xF4, 0x0F, 0xE0, 0x2F, 0xE7, 0xFE, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x07, 0xFC, 0x7F, 0xF8, 0x2F, 0xFE, 0x15, 0xF8, 0xBE, 0xFF, 0x01, 0xF5,
-    0xE0, 0x3F, 0x01, 0xF7, 0x80, 0x3F, 0x02, 0xFF, 0x00, 0x3E, 0x03, 0xFD, 0x00, 0x7E, 0x03, 0xF8,
-    0x00, 0x7D, 0x07, 0xF0, 0x00, 0xBC, 0x0B, 0xE0, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0xF8, 0x1F, 0x80, 0x01, 0xF4, 0x2F, 0x40, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x03, 0xE0, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xBF, 0xC0, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x3E, 0x00, 0x02, 0xF4, 0x2F, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xE5, 0x54, 0x03, 0xF2, 0xF4, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0x83, 0xF4, 0x00, 0x0B, 0xC0, 0xBD, 0x00, 0x03, 0xE0, 0x1F,
-    0x80, 0x03, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xBF, 0x47, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xF4, 0x03,
-    0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x40, 0x2F,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x08, 0x7F, 0xBC, 0x7F, 0xF8, 0x3F, 0xD0, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x01, 0xFC, 0x7F, 0xF8, 0x00, 0xFF, 0xD1, 0x5F, 0x80, 0x3F,
-    0xE8, 0x01, 0xF4, 0x0F, 0xD0, 0x00, 0x1F, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3E,
-    0x1F, 0xC0, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x7C, 0xBF, 0x80, 0x00, 0x0B, 0xDF, 0xB4, 0x00,
-    0x00, 0xFB, 0xCB, 0x80, 0x00, 0x0F, 0xF4, 0xB8, 0x00, 0x01, 0xFF, 0x0B, 0xC0, 0x00, 0x2F, 0xC0,
-    0x7D, 0x02, 0x03, 0xF8, 0x07, 0xFA, 0xF0, 0x3F, 0x00, 0x3F, 0xFE, 0x07, 0xD0, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x00, 0x2F, 0x3E,
-    0x00, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00,
-    0x07, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0x02, 0xF0, 0x00, 0x2F, 0xC0,
-    0x0B, 0xC0, 0x42, 0xFC, 0x00, 0x1F, 0xEF, 0x2F, 0xD0, 0x00, 0x7F, 0xF4, 0xBE, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x7D,
-    0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x2E, 0xF0, 0x10, 0x0F, 0xFD, 0x7F, 0x3F, 0xBD, 0x07, 0xFF, 0xFF, 0x0F, 0xFE, 0x02,
-    0xE7, 0xFE, 0x01, 0xFD, 0x00, 0xF8, 0x14, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x3F, 0x87, 0xFF, 0x40, 0x0B, 0xF0, 0x5B, 0xE0, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xE0, 0x02, 0xF4, 0x02,
-    0xF0, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0xFC,
-    0x2F, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4,
-    0x1B, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xE8, 0x00, 0xBF, 0x40, 0x00, 0x1F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xF8, 0x03, 0xF4, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xFD, 0x2F, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFC, 0x7F,
-    0x00, 0x00, 0xFC, 0x7E, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x03, 0xF0, 0xBE,
-    0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x2F, 0xC0, 0x3F, 0xC1, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0x43, 0xC0, 0x7C, 0x00,
-    0x04, 0x07, 0xC0, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x00,
-    0x1F, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x00, 0xBC,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x0B,
-    0xD0, 0x50, 0x0B, 0xD0, 0x0F, 0xFB, 0xD0, 0x1F, 0xC0, 0x0B, 0xFF, 0x80, 0x3F, 0x40, 0x03, 0xFD,
-    0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x01, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0x42, 0xFD, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x7D, 0x00, 0x07, 0xF0, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F,
-    0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x1F,
-    0x80, 0x3F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x3F, 0xD0, 0x3F, 0x80, 0x07, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBE, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x07, 0xFF, 0xF4, 0x0B, 0xFA, 0xBD, 0x07, 0xE0, 0x01, 0x03, 0xF0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xEA, 0xFF, 0xE4,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x07, 0xD0, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xD0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x1F,
-    0x80, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x07,
-    0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x78, 0x0B, 0xC0, 0x00, 0x10, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x0A, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0x03, 0xFF, 0xC0, 0x0B,
-    0xE0, 0x57, 0xF0, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0xF8, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xD6, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0B, 0xFD, 0x00,
-    0x0B, 0xE0, 0x0F, 0xFF, 0xD0, 0x0B, 0xD0, 0x0B, 0xC2, 0xFC, 0x07, 0xE0, 0x07, 0xC0, 0x2F, 0x43,
-    0xF0, 0x02, 0xF0, 0x07, 0xE1, 0xF4, 0x00, 0xF8, 0x00, 0xFC, 0xFC, 0x00, 0x7D, 0x00, 0x3F, 0x3F,
-    0x00, 0x2F, 0x00, 0x0F, 0x8F, 0xC0, 0x0F, 0xC0, 0x07, 0xD7, 0xF0, 0x03, 0xE0, 0x02, 0xF1, 0xFC,
-    0x00, 0xF4, 0x00, 0xF8, 0x3F, 0x00, 0x7C, 0x00, 0xBC, 0x0F, 0xD0, 0x2F, 0x00, 0x7D, 0x02, 0xFD,
-    0x0F, 0xC0, 0xBE, 0x00, 0x3F, 0xE7, 0xE6, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFD, 0x01, 0xFF, 0xE0, 0x02, 0xF8, 0x00, 0x57, 0xF0,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x3E,
-    0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xDF, 0x40, 0x00, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0xB0, 0x1F, 0xC0, 0x03, 0xFF, 0xE0, 0x7F, 0x00, 0x02, 0xFF, 0x40, 0x68, 0x00, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0x03, 0xF0, 0x3F, 0xFD,
-    0x00, 0xF8, 0x0B, 0xD0, 0x57, 0xF0, 0x03, 0xE0, 0x1F, 0xC0, 0x0F, 0xC0, 0x1F, 0x40, 0x3F, 0x00,
-    0x7E, 0x00, 0xBC, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F,
-    0xC0, 0x3E, 0x00, 0x7D, 0x00, 0x3F, 0x01, 0xF4, 0x02, 0xF0, 0x01, 0xF8, 0x0B, 0xD0, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x2F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0xF8, 0x02, 0xF4, 0x02, 0xF8, 0x07,
-    0xD0, 0x1F, 0x80, 0x07, 0xF4, 0x2F, 0x02, 0xFC, 0x00, 0x0F, 0xF9, 0xFD, 0xBF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x28, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4,
-    0x01, 0xF8, 0x00, 0xFC, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF0, 0x00, 0xFC, 0x7E,
-    0x00, 0x2E, 0x00, 0x0F, 0xCB, 0xE0, 0x03, 0xD0, 0x00, 0xF8, 0xBD, 0x00, 0x3D, 0x00, 0x1F, 0x0B,
-    0xE0, 0x0B, 0xD0, 0x03, 0xF0, 0x7F, 0x00, 0xFF, 0x00, 0x7D, 0x03, 0xF8, 0x7D, 0xF8, 0x2F, 0x80,
-    0x2F, 0xFF, 0x8B, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF,
-    0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00,
-    0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01,
-    0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD,
-    0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E,
-    0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF7,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFE, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xFF, 0x40, 0x01, 0xBF, 0xFF, 0x2F, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0xFD,
-    0x00, 0x00, 0x0F, 0x07, 0xD0, 0x00, 0x00, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF,
-    0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03,
-    0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE,
-    0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F,
-    0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0B, 0xEA, 0xAA, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFA, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xFD, 0x00, 0x06, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xD0,
-    0x00, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2E, 0x00, 0x00, 0x2F, 0xFF, 0xEF, 0x00,
-    0x00, 0x3F, 0xD6, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF8, 0x00, 0x0B,
-    0xD0, 0x02, 0xFE, 0x00, 0x02, 0xF8, 0x01, 0xEF, 0x42, 0x00, 0xBF, 0x02, 0xF3, 0xD2, 0xD0, 0x1F,
-    0xFB, 0xF0, 0xFB, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x0F, 0xE0, 0x00, 0x01,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x43,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x02, 0xFC, 0x04, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x0B, 0xF0,
-    0xBD, 0x00, 0x02, 0xF8, 0x03, 0xE0, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF,
-    0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0,
-    0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02,
-    0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80,
-    0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x1B,
-    0xFF, 0xF0, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x6A, 0x07, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x7F,
-    0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xF4, 0x00, 0x00, 0x19, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x2E, 0x00, 0x00, 0x2F, 0xFF,
-    0xEF, 0x00, 0x00, 0x3F, 0xD6, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x1F,
-    0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xF8,
-    0x00, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0x02, 0xF8, 0x01, 0xEF, 0x42, 0x00, 0xBF, 0x02, 0xF3, 0xD2,
-    0xD0, 0x1F, 0xFB, 0xF0, 0xFB, 0xF0, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x0F, 0xE0,
-    0x00, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x2C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x01, 0xE1, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x20, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x1F, 0xF4, 0x3C, 0x00, 0x03, 0xFF, 0xEB, 0xC0,
-    0x00, 0x3C, 0x3F, 0xF4, 0x00, 0x02, 0x40, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x3D, 0x00, 0x01, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F,
-    0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8,
-    0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00,
-    0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D,
-    0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB,
-    0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x01,
-    0xF4, 0xBC, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x50, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF,
-    0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03,
-    0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE,
-    0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F,
-    0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3C, 0x04, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x70, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0xFF,
-    0xAF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF,
-    0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0,
-    0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF,
-    0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x1D, 0x04, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xB0, 0x00, 0x70, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0xFF,
-    0xAF, 0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8, 0x00, 0x2F, 0xFF,
-    0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F, 0xE0, 0x0B, 0xE0,
-    0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F, 0xFF, 0x03, 0xFF,
-    0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x6F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xCB, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xBE, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x10, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00, 0xF4,
-    0x01, 0xE0, 0x00, 0x0F, 0xE6, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x0B, 0x80, 0x02, 0xFF, 0xFE, 0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07,
-    0xF0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F,
-    0x40, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0,
-    0x02, 0xFE, 0x00, 0xBE, 0x00, 0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF,
-    0xC3, 0xFF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xAF,
-    0x00, 0x00, 0x00, 0x03, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x6F, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBD,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0xAA, 0xAF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFF, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFF, 0xD0, 0x00,
-    0x6F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x2F,
-    0xF0, 0x78, 0x00, 0x07, 0xFF, 0xEF, 0x40, 0x00, 0xB4, 0x7F, 0xF0, 0x00, 0x02, 0x01, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x02, 0x00, 0x01, 0xF4, 0x01, 0xE0, 0x00, 0x0F, 0xE6,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0x80, 0x02, 0xFF, 0xFE,
-    0xF0, 0x00, 0xFF, 0x5B, 0xFF, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x0B, 0xD0, 0x02, 0xFE, 0x00, 0xBE, 0x00,
-    0x7B, 0xD0, 0x8B, 0xF0, 0x2F, 0x3D, 0x2D, 0x7F, 0xEF, 0xC3, 0xEF, 0xC3, 0xFF, 0xF0, 0x3F, 0xF0,
-    0x1F, 0xF8, 0x03, 0xF8, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0x6F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBD,
-    0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0xF2, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x24, 0x00, 0x0B, 0xD0, 0x0F,
-    0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xB8,
-    0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x0F, 0xF5, 0xBF, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x01, 0xF4, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x2F,
-    0xE0, 0x0B, 0xE0, 0x07, 0xBD, 0x08, 0xBF, 0x02, 0xF3, 0xD2, 0xD7, 0xFE, 0xFC, 0x3E, 0xFC, 0x3F,
-    0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x3D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x07,
-    0xD0, 0xBC, 0x00, 0xBD, 0x0F, 0x80, 0x1F, 0xC2, 0xF0, 0x0B, 0xF0, 0x3F, 0x07, 0xFC, 0x07, 0xFB,
-    0xFE, 0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20,
-    0x7F, 0x00, 0x1F, 0x43, 0xFE, 0x6F, 0xE0, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x00, 0x01, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xBF, 0xAA, 0xAF, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x03,
-    0xF0, 0x00, 0x0E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAF, 0xE0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x40, 0x00, 0xBE, 0x00,
-    0x00, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x07, 0xF5, 0x6A,
-    0xBF, 0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3E, 0x7F, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x07, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0xF8, 0x01, 0xF4, 0x0B, 0xC0, 0x0B, 0xD0, 0x3E, 0x00, 0x7F,
-    0x02, 0xF0, 0x0B, 0xF0, 0x0F, 0xC1, 0xFF, 0x00, 0x7F, 0xBF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x01, 0xFC, 0x00, 0x7D, 0x03, 0xFE,
-    0x6F, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x09, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x3C, 0x3F, 0xF0, 0x00, 0x00, 0x09, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAB,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0xF0, 0x02, 0xFF, 0xC7, 0xC0, 0x0F, 0x5F, 0xFE,
-    0x00, 0x38, 0x2F, 0xF0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x02, 0xF4, 0x03, 0xE0,
-    0x07, 0xD0, 0x2F, 0x00, 0x2F, 0x40, 0xF8, 0x01, 0xFC, 0x0B, 0xC0, 0x2F, 0xC0, 0x3F, 0x07, 0xFC,
-    0x01, 0xFE, 0xFF, 0x80, 0x07, 0xFF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x08, 0x07, 0xF0, 0x01, 0xF4, 0x0F, 0xF9, 0xBF, 0x80, 0x2F, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0xB8, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x14, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xEA,
-    0xAA, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xFD, 0x5A, 0xAF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xBF,
-    0x80, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x3C, 0x00, 0x00, 0xA0, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x02, 0xF4,
-    0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x7F, 0xC0, 0x00, 0x1F,
-    0xEF, 0xF8, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0x9B, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x54, 0x3C,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x0A, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0xAA,
-    0xBF, 0x40, 0x00, 0x2F, 0x40, 0x00, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xBF, 0x80, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01,
-    0xFD, 0x5A, 0xAF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBE, 0x04,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0xFD, 0x00, 0xF0,
-    0x00, 0xA0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0,
-    0x0F, 0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00,
-    0x7F, 0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3E, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFE, 0xAA, 0xBF, 0x40, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0E, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xBF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x7D, 0xBE, 0x00, 0x00, 0x00, 0x74, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6E, 0x0A, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0xF0, 0x00, 0x00, 0xA0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x03, 0xE0, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x00, 0x2F,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02,
-    0x00, 0x00, 0x7F, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xE6, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x81, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x00, 0x0E, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x3E, 0x00,
-    0x00, 0x01, 0xD0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x6F, 0xEA, 0xAB, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3D, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0xAB, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0x80, 0x01, 0xFD, 0x5A, 0xAF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x04, 0x00, 0x0B, 0xFC, 0x0E, 0x00, 0x1F, 0xFF, 0xBE, 0x00,
-    0x2E, 0x1F, 0xFC, 0x00, 0x08, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x3F, 0x47, 0xF0, 0x00, 0xFD, 0x01, 0xF0, 0x00,
-    0xA0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0F,
-    0x80, 0x1F, 0xC0, 0x2F, 0x00, 0xBF, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x7F, 0xBF, 0xE0, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x02, 0x00, 0x7F,
-    0x00, 0x1F, 0x40, 0x3F, 0xE6, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x07,
-    0xF0, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFA,
-    0xAA, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFA, 0xAA, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x0F,
-    0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x7F, 0x56, 0xAB, 0xF4,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFE, 0xF4, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBD, 0x07, 0xC0, 0x07, 0xD0, 0x0F, 0x00,
-    0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0x80, 0x1F, 0x40, 0xBC, 0x00, 0xBD, 0x03, 0xE0, 0x07,
-    0xF0, 0x2F, 0x00, 0xBF, 0x00, 0xFC, 0x1F, 0xF0, 0x07, 0xFB, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0xBF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x20, 0x1F, 0xC0, 0x07, 0xD0, 0x3F,
-    0xE6, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xF8, 0x3F, 0x00, 0x02, 0xC0, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x90, 0x00, 0x2F, 0xFC, 0x00,
-    0xFD, 0xFD, 0x00, 0xF0, 0x3D, 0x00, 0xE0, 0x7C, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00,
-    0x3F, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x2F, 0x82, 0x00, 0x3F, 0x4F, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0x40, 0x03, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFC, 0x00, 0xFF, 0xF4, 0x01, 0x5F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0x82, 0x00, 0xFD, 0x3C, 0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4,
-    0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00,
-    0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00,
-    0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7F, 0xE5, 0x5F, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x40, 0x00,
-    0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x41, 0x7F, 0xE0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0xF0, 0x3D,
-    0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47, 0xFC, 0x03, 0xF4, 0x00, 0xFD,
-    0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xBD,
-    0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01, 0xF8, 0xBE, 0x00, 0x03, 0xF4,
-    0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x45, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x28, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF9, 0x57,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0xB8, 0x00, 0x00,
-    0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x91, 0xFF, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xD0,
-    0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x7E, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x54, 0x3C,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x02, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xFC,
-    0x04, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x0B, 0xF0, 0xBD, 0x00, 0x02,
-    0xFC, 0x02, 0xE0, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0xE4, 0x7F, 0xC0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0B, 0xE0,
-    0x3F, 0x00, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00,
-    0x1F, 0x80, 0xBE, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x03,
-    0xFC, 0x0B, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x4B, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xF8, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xF9, 0x57, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x38, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x6A, 0x07, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00,
-    0x7F, 0x0B, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0xF8, 0x00, 0x00, 0x19, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x91, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x00, 0x2F, 0x80,
-    0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00,
-    0x0B, 0xD0, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00,
-    0x7E, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x70, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xC0, 0x00, 0x00, 0x03, 0x87, 0xFE, 0x00, 0x00,
-    0x00, 0x04, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0x80, 0x00, 0x00, 0x07, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80,
-    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-    0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x3C,
-    0x00, 0x03, 0xFF, 0xEB, 0xC0, 0x00, 0x3C, 0x2F, 0xF4, 0x00, 0x02, 0x40, 0x79, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x3D, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-    0xFE, 0x47, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x0B,
-    0xE0, 0x2F, 0x40, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0xFD, 0x07, 0xE0,
-    0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xD2, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF2,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x17, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x01, 0xF4,
-    0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFE, 0x47,
-    0xFC, 0x03, 0xF4, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0xBE, 0x2F, 0x40, 0x00,
-    0xBE, 0x3F, 0x00, 0x00, 0xBD, 0x7F, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x01,
-    0xF8, 0xBE, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0xBF,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0xFC,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0xF8,
-    0x00, 0x01, 0xFF, 0x95, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0,
-    0x00, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x5F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0xF9, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x47, 0xFC, 0x00, 0x0F, 0xD0,
-    0x03, 0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x00, 0xBE,
-    0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xBE,
-    0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x02, 0xFF, 0xFD, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x01, 0xFF, 0x95,
-    0x7F, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x5F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x1A, 0x00, 0x00, 0x02,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF9, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0x47, 0xFC, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x01, 0xF8, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0xC0,
-    0xBF, 0x40, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x0B, 0xF0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x5F, 0xF8, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x3E, 0x7F, 0x00, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x07, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xA0,
-    0x00, 0x01, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xFF, 0x9F, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE4, 0x7F, 0xC0, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x0F,
-    0xC0, 0x00, 0x2F, 0x40, 0x7F, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00,
-    0x1F, 0x80, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00,
-    0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x90, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0xBF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xEF, 0x80, 0x00, 0x1F, 0xF9, 0x57, 0xFF, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x07,
-    0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x05, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xF0, 0x00, 0x02, 0xFF,
-    0xC7, 0xC0, 0x00, 0x0F, 0x9F, 0xFE, 0x00, 0x00, 0x3C, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x19, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xFE, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x91, 0xFF, 0x00, 0x03, 0xF4, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x2F, 0x80,
-    0x3F, 0x00, 0x00, 0xBD, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x80,
-    0x00, 0x7E, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x01, 0xFC,
-    0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFD, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFE, 0xF8, 0x00, 0x01, 0xFF, 0x95, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x5F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xFF, 0x9F, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xE4, 0x7F, 0xC0,
-    0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x02, 0xF4,
-    0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7F, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x01,
-    0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF,
-    0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x2F, 0x07, 0xFF, 0xC0, 0x01,
-    0xFC, 0x05, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x0B, 0xF4,
-    0x00, 0x7E, 0x00, 0xBB, 0xD0, 0x81, 0xF8, 0x0B, 0xCF, 0x0F, 0x07, 0xF5, 0xFC, 0x7E, 0xF8, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xF8, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x07, 0xF4, 0x00,
-    0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00,
-    0x01, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00,
-    0x00, 0x3C, 0x0F, 0x80, 0x00, 0x00, 0xA0, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x0B, 0xC1, 0xFF,
-    0xF0, 0x00, 0x7F, 0x01, 0x5F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00,
-    0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0,
-    0x02, 0xFD, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x7E, 0x02, 0xF3, 0xC3, 0xC1, 0xFD, 0x7F, 0x1F,
-    0xBE, 0x03, 0xFF, 0xF0, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xD0, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x96, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x1B, 0xFC,
-    0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x0F,
-    0xC0, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x00,
-    0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x01, 0xF8, 0x0B, 0xCF, 0x0F, 0x00, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0,
-    0x00, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x96,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0x80, 0x00,
-    0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x1B,
-    0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x40,
-    0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x01, 0xF8, 0x0B, 0xCF, 0x0F, 0x00, 0x1F, 0xD7, 0xF1, 0xFB,
-    0xE0, 0x00, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0,
-    0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x96, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x1B, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xC0,
-    0x01, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x01,
-    0xF8, 0x0B, 0xCF, 0x0F, 0x00, 0x1F, 0xD7, 0xF1, 0xFB, 0xE0, 0x00, 0xFF, 0xFC, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x0B, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0xF9, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x74, 0x00, 0x00, 0x03, 0xFF, 0x8F, 0x40, 0x00, 0x00, 0xBD, 0xBF, 0xF0,
-    0x00, 0x00, 0x0B, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xBF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x7F, 0xFC, 0x00, 0x1F, 0xD0, 0x01, 0x5F, 0xC0, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0x40, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0,
-    0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x00, 0x01, 0xF8,
-    0x02, 0xEF, 0x42, 0x00, 0x1F, 0x80, 0xBC, 0xF0, 0xF0, 0x01, 0xFD, 0x7F, 0x1F, 0xBE, 0x00, 0x0F,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x47, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xD0, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x40,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x96, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x1B, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x15, 0xFC, 0x00, 0x1F, 0x80,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF,
-    0x40, 0x00, 0x1F, 0x80, 0x2E, 0xF4, 0x20, 0x01, 0xF8, 0x0B, 0xCF, 0x0F, 0x00, 0x1F, 0xD7, 0xF1,
-    0xFB, 0xE0, 0x00, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01,
-    0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E,
-    0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00,
-    0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00,
-    0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E,
-    0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x5F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00,
-    0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00,
-    0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0xFC, 0x74, 0x7F, 0x40, 0x03, 0xFC, 0xBF, 0xFD, 0x00, 0x03, 0xFC, 0xFF, 0xE0, 0x00, 0x03,
-    0xF4, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x81, 0xFF, 0x40,
-    0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x02, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFD, 0x01, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x00, 0x1F, 0x07, 0xD0, 0x00, 0x00, 0x0D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0,
-    0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00,
-    0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0xBC,
-    0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00,
-    0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x00,
-    0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x80, 0x00,
-    0x00, 0x0F, 0xFC, 0x3D, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3D, 0x2F, 0xF8, 0x00,
-    0x00, 0x01, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xDF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xF8, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x1F,
-    0x80, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x5F,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xB0, 0x00,
-    0x00, 0x7F, 0xF5, 0xF0, 0x00, 0x00, 0xF9, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x7F, 0xC0, 0x00, 0x00,
-    0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x5B, 0xF0, 0x00,
-    0xBE, 0x00, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x7C,
-    0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00,
-    0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x74, 0x7F, 0x40, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x38,
-    0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03,
-    0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0,
-    0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x15, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
-    0x68, 0x01, 0xA2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F,
-    0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40,
-    0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4,
-    0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F,
-    0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2,
-    0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF1, 0x50, 0x05, 0x40, 0x55, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x07, 0xC0, 0x3D, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x0B, 0xE0, 0x3F, 0x80, 0xFF, 0x02,
-    0xFC, 0x01, 0x40, 0x00, 0x01, 0xE0, 0x2F, 0xD0, 0x7F, 0x80, 0xFD, 0x03, 0xF0, 0x1F, 0x40, 0xFC,
-    0x07, 0xD0, 0x3D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x2F, 0xD0, 0x7F, 0x40, 0xFC, 0x07,
-    0xF0, 0x2F, 0x00, 0xF8, 0x0B, 0xC0, 0x7C, 0x01, 0x80, 0x00, 0x05, 0x03, 0xFC, 0x7F, 0x87, 0xF0,
-    0x7F, 0x03, 0xF0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x3D, 0x00, 0x40, 0x00, 0x10, 0x01, 0x00, 0x7C,
-    0x02, 0xE0, 0x3D, 0x02, 0xF0, 0x3F, 0x01, 0xF4, 0x2F, 0x40, 0xFC, 0x0F, 0xC0, 0x7E, 0x0B, 0xE0,
-    0x3F, 0x43, 0xF8, 0x1F, 0xD0, 0xFF, 0x07, 0xF8, 0x2F, 0xC0, 0xFE, 0x01, 0x40, 0x04, 0x00, 0x00,
-    0x40, 0x01, 0x00, 0x7F, 0x43, 0xFC, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0x42, 0xFC, 0x03, 0xF0, 0x2F,
-    0x80, 0x7E, 0x02, 0xF4, 0x0B, 0xC0, 0x3E, 0x00, 0xF8, 0x0B, 0xC0, 0x2F, 0x00, 0xF4, 0x07, 0xC0,
-    0x3E, 0x00, 0x10, 0x01, 0x00, 0x00, 0x06, 0xF0, 0x1F, 0x40, 0xBF, 0x43, 0xFC, 0x07, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x02, 0xFC, 0x07, 0xF0, 0x3F, 0x40, 0xBC, 0x03, 0xF0, 0x0F, 0x80, 0x7D, 0x02, 0xF0,
-    0x0F, 0x80, 0x7C, 0x02, 0xF0, 0x06, 0x00, 0x28, 0x00, 0x05, 0x00, 0x10, 0x0F, 0xF0, 0x3F, 0x47,
-    0xF8, 0x2F, 0xD1, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0xC0, 0xBE, 0x02, 0xF0, 0x0F, 0x80,
-    0x3D, 0x02, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x07, 0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x40, 0x7C, 0x05, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xE5,
-    0x3D, 0x1A, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0x01, 0xF0, 0x14, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x0E, 0x53, 0xD1, 0xA4, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x10, 0x1F, 0x00, 0x40, 0xBF, 0xBF, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xE9, 0x3D, 0x5B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x02, 0x90, 0x1F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x3F, 0xF4, 0x0B, 0x90, 0x28, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD,
-    0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0xFF, 0xFE, 0xFD, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x03, 0xFC, 0x3F,
-    0x40, 0x3F, 0x80, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xCB, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x50, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x1F, 0xDB, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x74, 0x38, 0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70,
-    0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
-    0x3F, 0xF4, 0x1C, 0x2E, 0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00,
-    0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A,
-    0x40, 0xA0, 0x10, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0,
-    0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA0, 0xD0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0,
-    0xEB, 0x55, 0x6D, 0x2C, 0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04,
-    0x04, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00,
-    0x2D, 0x3C, 0x00, 0x0B, 0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95,
-    0x5E, 0x0E, 0x1D, 0x00, 0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0x80, 0xBC, 0x00, 0x54, 0x00, 0x00, 0x15, 0x02, 0xF0, 0x07, 0xC0, 0x7C, 0x02, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0x7E, 0x07, 0xD0, 0x3D, 0x03, 0xFA, 0xFC, 0x00, 0xFE, 0xBF, 0x0B, 0xFF,
-    0xD0, 0x2E, 0x03, 0xF0, 0x1F, 0x40, 0xBC, 0x07, 0xD0, 0xBF, 0x80, 0x1F, 0x01, 0xF0, 0x03, 0xE0,
-    0x7C, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0xF8, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x80, 0x3D, 0x00, 0x3E, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x0F, 0x47, 0xC0,
-    0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x03, 0xD2, 0xF0, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x02,
-    0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xF4, 0x2F, 0x00, 0x3D,
-    0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0xFC, 0x07, 0xD0, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xFA,
-    0xFC, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0B, 0xD0, 0x3F, 0x41, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4,
-    0x0F, 0x80, 0xBC, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00, 0xBD, 0x03, 0xE0, 0x3F,
-    0x42, 0xFC, 0x1F, 0xC0, 0xFE, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x43, 0xF4, 0x1F, 0xC0, 0xF8,
-    0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00,
-    0x60, 0x02, 0xF4, 0x0F, 0x80, 0xBC, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x82, 0xFC,
-    0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x1F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x3E,
-    0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x02, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFD, 0x00,
-    0xFC, 0x01, 0xF0, 0x02, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x60, 0x0B, 0xC0, 0x1F, 0x40, 0xFE, 0x02,
-    0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0x80,
-    0x3F, 0x00, 0xFC, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x60, 0x01, 0x80, 0x2F, 0x00, 0x7D, 0x01, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
-    0xF4, 0x0F, 0xD0, 0x3F, 0x80, 0xFE, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0xFD, 0x02,
-    0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x80, 0x2C, 0x00,
-    0x70, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x07, 0xE0, 0x3E, 0x01, 0xF8, 0x00, 0xF8, 0x2E, 0x00, 0x03,
-    0xD0, 0x00, 0x01, 0x00, 0x07, 0xD0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0B, 0xF0,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x1F,
-    0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0x40, 0x02, 0xE0,
-    0x3C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x7F, 0x01, 0xE0, 0x00, 0x7C, 0x0B, 0x41, 0xF0, 0x00,
-    0x07, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x00,
-    0x40, 0xB8, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x1F, 0x40, 0x3F, 0x00, 0xF8, 0x0B, 0xE0, 0x0B,
-    0x80, 0xFF, 0x40, 0xF0, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x40, 0xF0, 0x00, 0x78,
-    0x07, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x1C, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x01, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x1D, 0x00, 0x07, 0x80, 0x00, 0xA0,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06,
-    0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55,
-    0x55, 0x50, 0x7F, 0xF9, 0xBF, 0xFE, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1A, 0x40,
-    0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xAF, 0xE0,
-    0x0F, 0xEB, 0xFC, 0x08, 0x00, 0xFC, 0x02, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7E, 0xA0, 0x00, 0x1F, 0xE8, 0x00, 0x1F, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x01, 0x90, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x90, 0x00,
-    0x00, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xEB, 0xF8,
-    0x00, 0x7F, 0x00, 0x80, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00, 0x0B,
-    0xD0, 0x02, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xE0, 0x00, 0x3F,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x1F,
-    0xA8, 0x00, 0x07, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x78, 0x00, 0x0B, 0xE0, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x64, 0x00,
-    0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x01, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x06,
-    0x90, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0x00,
-    0x3F, 0xAF, 0xE0, 0x02, 0xF8, 0x00, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x7E, 0xA0, 0x00, 0x1D, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xA0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x00, 0xA4, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C,
-    0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x90, 0x0A, 0x00, 0x60, 0x02, 0x40,
-    0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x7E, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x0B, 0xE0, 0x7F, 0x03, 0xF8,
-    0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x2F, 0xC1, 0xFC, 0x0F, 0xD0, 0x7F, 0x03, 0xF4,
-    0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x7E, 0x03, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0,
-    0x2F, 0x01, 0xF4, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xD1, 0xFC, 0x0B, 0xC0,
-    0x2F, 0x03, 0xD0, 0x07, 0xC2, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xBC, 0x3D, 0x00, 0x2F, 0x1F, 0x00,
-    0x0F, 0x87, 0xC0, 0x07, 0xD2, 0xF0, 0x03, 0xF0, 0x7D, 0x01, 0xF4, 0x0F, 0xD2, 0xF8, 0x02, 0xFF,
-    0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xEF, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x3D,
-    0x2E, 0x00, 0x0F, 0x83, 0xD0, 0x03, 0xE0, 0x3D, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0xAA, 0xFE, 0x83,
-    0xFF, 0xFF, 0xFC, 0x05, 0x55, 0xF9, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1A,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x0B, 0xEA, 0xA0, 0x03, 0xD0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x6F, 0xC0, 0x1F, 0xFF, 0x80, 0x03, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xA0, 0x03,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF6, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0x7D,
-    0x57, 0xF0, 0x2F, 0x00, 0x7D, 0x0B, 0x80, 0x0F, 0x43, 0xE0, 0x03, 0xD0, 0xBC, 0x02, 0xF0, 0x1F,
-    0x82, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFC, 0x3D, 0x55, 0xF8, 0x78, 0x02, 0xF0, 0x30, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x0F, 0xEF, 0xE0, 0x0F, 0x80, 0xBC, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x0F,
-    0x80, 0x3F, 0x0F, 0xC0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x02, 0xE0, 0xFC, 0x02, 0xF0, 0x0F,
-    0x80, 0xF4, 0x03, 0xF0, 0x3D, 0x00, 0xF8, 0x0F, 0x80, 0xBC, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0xF0, 0x07,
-    0xE0, 0x7E, 0x03, 0xE0, 0x0B, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x0F, 0x80, 0x2F, 0x02,
-    0xF9, 0x6F, 0x80, 0x2F, 0xFF, 0xC0, 0x00, 0x57, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x1B, 0xF0, 0x02, 0xBF, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0xFC,
-    0x0B, 0xF5, 0xFF, 0x40, 0x3D, 0xE7, 0xD0, 0x0F, 0xD0, 0xF4, 0x07, 0xE0, 0x7C, 0x02, 0xF0, 0x2F,
-    0x00, 0xF8, 0x0F, 0x40, 0x3C, 0x03, 0xC0, 0x1F, 0x01, 0xF3, 0x4B, 0x80, 0x7F, 0xC3, 0xD0, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xEF, 0xE0, 0x1F, 0x80,
-    0xFC, 0x0F, 0xC0, 0x2F, 0x07, 0xD0, 0x07, 0xC3, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xBC, 0x7D, 0x00,
-    0x3F, 0x1F, 0x00, 0x0F, 0x8B, 0xC0, 0x07, 0xC2, 0xF0, 0x03, 0xE0, 0x7E, 0x02, 0xF0, 0x0F, 0xEB,
-    0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x01, 0x40, 0x06, 0xFC, 0x07, 0xFF, 0x80,
-    0x1A, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0x41, 0x55, 0x50,
-    0x00, 0x06, 0x50, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xEF, 0xE0, 0x1F, 0x40, 0xFC, 0x0B, 0x40, 0x2F,
-    0x00, 0x40, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF,
-    0x80, 0x55, 0x55, 0x00, 0x00, 0x06, 0x40, 0x00, 0xBF, 0xF4, 0x02, 0xFA, 0xFC, 0x03, 0xC0, 0x7C,
-    0x02, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0xF0, 0x00,
-    0x02, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x15, 0xBF, 0xC0, 0x7F, 0xFE,
-    0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x1F, 0x03, 0xD0,
-    0x07, 0xC0, 0x3C, 0x01, 0xF4, 0x07, 0xC0, 0x3F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x01, 0x7F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x05, 0xAF, 0xE0, 0x07, 0xFF, 0xD0, 0x00, 0x69, 0x00, 0x00,
-    0x00, 0x00, 0x58, 0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x80, 0x7C, 0x02, 0xF0, 0x2F, 0x00, 0x3D,
-    0x0F, 0x80, 0x0F, 0x42, 0xF0, 0x07, 0xC0, 0xBC, 0x03, 0xF0, 0x0F, 0xDB, 0xF0, 0x01, 0xFF, 0xF0,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0xF4,
-    0x74, 0x03, 0xE0, 0x10, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x02,
-    0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x97, 0xF0, 0x0F, 0x40,
-    0xBC, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x1F, 0x40, 0x2F, 0x9F, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xEF,
-    0xE0, 0x03, 0xD0, 0xBD, 0x03, 0xE0, 0x0F, 0xC0, 0xF0, 0x03, 0xF0, 0x3D, 0x00, 0xF8, 0x0F, 0xD1,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x06, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x0B, 0xFF, 0x80, 0x0F,
-    0xEB, 0xF4, 0x0B, 0xC0, 0x3E, 0x03, 0xE0, 0x0B, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xBC, 0x0F,
-    0xC0, 0x3E, 0x01, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xE0, 0x00,
-    0x0B, 0xE0, 0x00, 0x6F, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x29, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x55, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0xF8, 0x00, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x54, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xAF, 0xEA, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xAB, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xBE, 0x00, 0x50, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x66, 0xFD, 0x56, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0A, 0xBF, 0xAA, 0xA4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x40, 0x3F, 0xFE,
-    0xAA, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFD, 0x5A, 0xFF, 0xFD, 0x00, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0xBE, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x02, 0xF8, 0x1B, 0xFA, 0x80, 0x0B, 0xFC, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFE, 0x00, 0x1F, 0x80, 0xBF, 0xC0, 0xAF, 0xEA, 0x40, 0xF4, 0x1D, 0x00, 0x2F, 0xFF, 0xFE, 0x00,
-    0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x01, 0x00, 0x00,
-    0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x07, 0x4D, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x6F, 0x2F, 0x40, 0xF0, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x1F, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x20, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x55, 0x68, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xAF, 0xFA, 0xAA, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0xFE, 0x56, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x01, 0xF9, 0x56, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xAA,
-    0xAA, 0xAB, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0x6D, 0x7D, 0x2F, 0x4B, 0x47, 0xD7, 0x42,
-    0xE0, 0x74, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xAA, 0xAA, 0xA5, 0x5B, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFA, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x03, 0x42, 0xE0, 0x72, 0xF4,
-    0xB4, 0x7E, 0x2F, 0x2D, 0x7E, 0x02, 0xFB, 0xBE, 0x00, 0x2F, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0x00, 0x0B, 0xC0,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x0B, 0xE5, 0x55,
-    0x55, 0x6F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA, 0xAA, 0xF8, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xEE, 0xF8, 0x0F, 0xCB, 0x8F, 0xCB, 0xC2, 0xE0, 0xF8, 0xC0,
-    0xB8, 0x0C, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x80, 0xB8, 0x08, 0xBC, 0x2E, 0x0F, 0x8F,
-    0xCB, 0x8F, 0xC0, 0xFE, 0xEF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBE,
-    0xEF, 0x80, 0x0B, 0xDB, 0x9F, 0x80, 0xBD, 0x2E, 0x1F, 0x80, 0xD0, 0xB8, 0x1C, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x0D, 0x0B, 0x81, 0xC0, 0xBD, 0x2E, 0x1F, 0x80, 0xBD, 0xB9, 0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2E,
-    0x00, 0x20, 0x0B, 0x80, 0x2F, 0x02, 0xE0, 0x2F, 0x40, 0xB8, 0x2F, 0x40, 0x2E, 0x1F, 0x40, 0x0B,
-    0x9F, 0x95, 0x57, 0xEF, 0xFF, 0xFF, 0xF9, 0xFA, 0xAA, 0xA9, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x02, 0x00, 0x2E, 0x03, 0xE0, 0x0B, 0x80, 0x7E, 0x02, 0xE0,
-    0x07, 0xD0, 0xB8, 0x00, 0x7D, 0x2F, 0x55, 0x5B, 0xDB, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xFD, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x80, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x2F, 0x07, 0xE5, 0x55, 0x55, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBE, 0xAA, 0xAA, 0xAA, 0x40,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x55,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x7D, 0x1F, 0x40, 0x07,
-    0xF4, 0x7F, 0x40, 0x7F, 0xD1, 0xFF, 0x47, 0xDF, 0x47, 0xDF, 0x49, 0x3D, 0x1F, 0x18, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C,
-    0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFE, 0xBF, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xAA, 0xAA, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x55, 0x55,
-    0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00,
-    0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4,
-    0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x05, 0x3D, 0x1F, 0x14, 0x7C, 0xF4, 0x7C,
-    0xF4, 0xBF, 0xD1, 0xFF, 0x80, 0xBF, 0x47, 0xF8, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0xBD, 0xF8, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x0F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x03, 0xFA, 0xAA,
-    0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xAA, 0xAA, 0xAB, 0xE1, 0xF0, 0x00, 0x00,
-    0x00, 0x3D, 0x3E, 0x55, 0x55, 0x55, 0x6F, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xE0, 0x00,
-    0x7F, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAA, 0xAF, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x07, 0xF2, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0x80,
-    0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xAF, 0x9F, 0xC0, 0x02, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFD, 0x5F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07,
-    0xE0, 0xBD, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xF0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x02, 0xF0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xEA, 0xBF, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF3, 0xFF, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x3A, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xBA,
-    0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xFF, 0xF9, 0x02, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x3F, 0xFA, 0x5B, 0xFF, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0xFC, 0x0B, 0xE0,
-    0xBE, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x1F, 0x83, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x2F,
-    0x80, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF,
-    0x80, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFE, 0x41, 0x7F, 0xF0, 0x00, 0x7E, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7E, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x0A, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xEF,
-    0xD0, 0x00, 0x00, 0x07, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0x43, 0xF8,
-    0x00, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0xFE, 0x00,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0x1F, 0x80,
-    0x00, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x95, 0x55,
-    0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0xAA, 0x5A, 0xAB, 0xF0, 0xFF, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0x1F,
-    0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0xBF, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00,
-    0x00, 0x0F, 0xE1, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0xAA, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0xEA, 0xAA, 0xFF, 0xBF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xBD, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x00,
-    0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xEB, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0xAA,
-    0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xF9, 0x55, 0x55,
-    0x54, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFA, 0xAA, 0xAA, 0xAB, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0x55, 0x55,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xEB, 0xFF, 0xEA, 0xAA, 0xAB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xAA, 0xAA, 0xAB, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xAF, 0xFB, 0xFE,
-    0xAA, 0xAF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF4,
-    0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0xFA,
-    0xFF, 0x02, 0xAA, 0xAA, 0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xD1, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xAA, 0xAA, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0xBC,
-    0x03, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xC0, 0x00, 0x18, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x1E, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x0B,
-    0xF0, 0x00, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x55, 0x55,
-    0x52, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x03, 0xD0, 0x14, 0x7E, 0x0B, 0x43, 0xF0, 0xFF, 0x6D, 0xBF,
-    0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x07,
-    0xF8, 0xB5, 0xFF, 0x0F, 0x43, 0xD0, 0xB8, 0x10, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x1F,
-    0x40, 0xFC, 0x3E, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x3D, 0x00, 0x3E, 0x3E, 0x00, 0x3D, 0x2F, 0x40,
-    0xFC, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xC0, 0x03,
-    0xF0, 0x02, 0xAB, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x42, 0xF0,
-    0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x00,
-    0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xB9, 0x00, 0x2F, 0x0F, 0xFF,
-    0x80, 0xBE, 0x2F, 0x9B, 0xE1, 0xF4, 0x3D, 0x01, 0xFB, 0xC0, 0x7C, 0x00, 0x7F, 0x40, 0xBC, 0x00,
-    0x3E, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xFB, 0xC0, 0x3F, 0x9B, 0xD2, 0xF4, 0x1F, 0xFF,
-    0x40, 0xFE, 0x02, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x0B, 0xE0, 0x02,
-    0xFF, 0xE0, 0x1F, 0xFF, 0x02, 0xF9, 0xBE, 0x1F, 0x9F, 0xE0, 0xF8, 0x07, 0xEF, 0x00, 0xBC, 0x3C,
-    0x00, 0xBF, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC7, 0xC0, 0x07, 0xF4, 0x01, 0xF0, 0xF4,
-    0x07, 0xEF, 0x00, 0xBC, 0x3F, 0x9B, 0xD3, 0xF9, 0xBD, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x00, 0x2F,
-    0x80, 0x01, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x29, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x15, 0x29, 0x02, 0x93, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07,
-    0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3,
-    0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0,
-    0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E,
-    0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F,
-    0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE1, 0x50, 0x15, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01,
-    0xF7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x02, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x07,
-    0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x7D,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0B, 0xD0,
-    0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x95, 0xBF, 0xF0, 0x1F, 0xD0,
-    0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF,
-    0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00,
-    0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07,
-    0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4,
-    0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00,
-    0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E,
-    0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40,
-    0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00,
-    0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB,
-    0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00,
-    0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF9, 0x45, 0xBF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xE0,
-    0x7D, 0x00, 0x00, 0xFD, 0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00,
-    0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00,
-    0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0xA4, 0x0F, 0xF0, 0x7F, 0xC1, 0xFD, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFC, 0x1F, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5,
-    0xFF, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF,
-    0x40, 0x1F, 0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C, 0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0x80, 0xFF, 0xFF, 0x80, 0x1F, 0x0F,
-    0xD1, 0xBF, 0xFB, 0xF4, 0x3C, 0x00, 0x2F, 0xFF, 0x40, 0x50, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x04, 0x0B, 0xFF, 0x40, 0x2E, 0x2F,
-    0xFF, 0xF4, 0x7E, 0x3F, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0xBF, 0xF4, 0x04, 0x00, 0x05, 0x40, 0x02,
-    0xF8, 0x00, 0x08, 0x0F, 0xFF, 0x80, 0x3E, 0x3F, 0xFF, 0xF9, 0xBE, 0x3E, 0x02, 0xFF, 0xFC, 0x3C,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x5B,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xEA, 0xAA, 0xFF, 0xC2, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x01, 0xF0, 0x05, 0x55, 0x5F, 0x94, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x55, 0xF9,
-    0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA,
-    0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00,
-    0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
-    0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x2F,
-    0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF,
-    0x40, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFD, 0x00,
-    0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00,
-    0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x56, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x95, 0xBE, 0x55, 0x47, 0xF8,
-    0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00,
-    0x2F, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0xBE, 0x55, 0x55, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x55, 0x55, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x55, 0x55, 0x6F, 0xAF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xE0,
-    0x0B, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00,
-    0x07, 0xE0, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x80, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x0B,
-    0xF4, 0x15, 0x5F, 0x95, 0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x01, 0x56, 0xF9, 0x55, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFE, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x07, 0x41, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xD0,
-    0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x74, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x1D, 0x00, 0x0B, 0xC0, 0x7C,
-    0x00, 0x07, 0x40, 0x00, 0xF4, 0x2D, 0x00, 0x01, 0xD0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x74, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x5B, 0x95, 0x55, 0x7D, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xAA, 0xAA, 0xFE, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x3D, 0x00, 0x01, 0xD0, 0x00, 0x1F, 0x07, 0x80, 0x00,
-    0x74, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0x1D, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x07, 0x40, 0x03, 0xD0,
-    0x02, 0xF0, 0x01, 0xD0, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x74, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x6E,
-    0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA,
-    0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0xFB, 0xE0, 0x00, 0x03, 0xFB, 0xC0, 0x7C, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x2D,
-    0x03, 0xE0, 0x03, 0xF0, 0x1E, 0x0F, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0xC3, 0xC0, 0x03, 0xE3, 0xF0,
-    0x00, 0xF1, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0x5E, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xD3, 0xC0, 0x03, 0xF7, 0xE0, 0x00, 0xF0, 0xF0, 0x03, 0xF0, 0x3E, 0x00,
-    0x3C, 0x3D, 0x03, 0xF0, 0x03, 0xE0, 0x1F, 0x07, 0x83, 0xF0, 0x00, 0x3E, 0x0B, 0x40, 0xF7, 0xF0,
-    0x00, 0x03, 0xE7, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0xF4, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0xF4, 0x2D, 0x00, 0x00, 0x02,
-    0xF0, 0x1E, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xC3, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xF1, 0xE0,
-    0x00, 0x02, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x5E, 0x00, 0x02, 0xF0, 0x00,
-    0x02, 0xD3, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x07, 0x82, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0xF6, 0xF0, 0x00, 0x00, 0x07,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE, 0x2F, 0xC0, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xDB, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4,
-    0x10, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9,
-    0xBE, 0x40, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_italicBitmaps[47078] = {
+    0x69, 0x96, 0xE5, 0xEA, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6,
+    0xAD, 0x6D, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0x9C, 0xA6, 0x9C, 0x96, 0xAA, 0x77, 0x73, 0x9A, 0x95,
+    0xAE, 0x5F, 0x5E, 0x96, 0x96, 0x3A, 0x39, 0xA2, 0x9D, 0x2A, 0xD2, 0xE2, 0xDA, 0x2D, 0xA1, 0x9D,
+    0x91, 0x9D, 0x91, 0xAD, 0x29, 0xD2, 0xAD, 0x2A, 0xD2, 0xDA, 0x2A, 0xCA, 0x2D, 0x3D, 0x92, 0xD3,
+    0xD2, 0x9C, 0xA7, 0x60, 0x79, 0x94, 0x99, 0x73, 0xD4, 0xD7, 0x29, 0xD3, 0x9C, 0xA7, 0x2A, 0xCA,
+    0x3A, 0xC9, 0x72, 0xD9, 0x3D, 0x79, 0x99, 0x9D, 0x99, 0x99, 0x9D, 0x99, 0x99, 0x2A, 0xFF, 0xFF,
+    0xC2, 0xAA, 0xAA, 0xEA, 0xAA, 0xAE, 0xAA, 0xA9, 0x6D, 0x93, 0xD9, 0x72, 0xD4, 0xD7, 0x29, 0xD3,
+    0x9D, 0x72, 0xAC, 0xA3, 0xAC, 0xA7, 0x2D, 0x93, 0xD9, 0x6F, 0xFF, 0xFC, 0x91, 0x9F, 0xFF, 0xFC,
+    0x6A, 0xD3, 0xAC, 0xA7, 0x2A, 0xC9, 0x3D, 0x97, 0x2D, 0x93, 0xD7, 0x3D, 0x39, 0xD7, 0x29, 0xD3,
+    0xAC, 0xA7, 0x39, 0x59, 0x70, 0x77, 0x75, 0xD7, 0x69, 0xD7, 0x6A, 0xC9, 0x76, 0xD7, 0x39, 0xAF,
+    0xC9, 0x70, 0xFF, 0xD9, 0x5E, 0xA9, 0xAC, 0xAF, 0x93, 0xAD, 0x91, 0xD9, 0x0A, 0xE3, 0xE2, 0xD2,
+    0xE2, 0x9D, 0xA1, 0x9C, 0xA2, 0xDA, 0x29, 0xE1, 0xAC, 0x92, 0x95, 0xE9, 0x0A, 0xC7, 0x2F, 0xAD,
+    0x73, 0xFD, 0x74, 0xFD, 0x74, 0xAF, 0xC9, 0x73, 0xFD, 0xA7, 0x19, 0xCA, 0x9F, 0x49, 0x3A, 0xC9,
+    0x1E, 0xA1, 0x9D, 0x3D, 0x2F, 0x1A, 0xD3, 0xD2, 0xAD, 0xA1, 0xE9, 0x19, 0xCA, 0x2E, 0xA1, 0xAE,
+    0x1A, 0xC9, 0x19, 0xE2, 0x9F, 0xAD, 0x99, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xAF, 0xEA, 0x72, 0xAC,
+    0xA7, 0x6D, 0x97, 0x6D, 0x76, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x97, 0x77, 0x40, 0x77, 0x49, 0x97,
+    0x1A, 0xDA, 0x97, 0x2D, 0x96, 0x9F, 0xDA, 0x70, 0xE6, 0x9D, 0xA1, 0xAD, 0x7A, 0xD7, 0xDA, 0x3D,
+    0x95, 0x9D, 0x96, 0xAD, 0x4D, 0xA5, 0xDA, 0x7D, 0x94, 0xDA, 0x4A, 0xD7, 0x9D, 0x5D, 0xA3, 0x9D,
+    0x70, 0xAD, 0x5D, 0x93, 0xD9, 0x70, 0xAD, 0x49, 0xD3, 0xDA, 0x71, 0xAD, 0x4D, 0xA2, 0xAD, 0x49,
+    0x99, 0x2A, 0xD3, 0x9D, 0x29, 0xD3, 0xAF, 0xC1, 0x9D, 0xA1, 0x9D, 0x92, 0xD9, 0x2E, 0xAA, 0xE1,
+    0xAF, 0xD9, 0x2A, 0xCA, 0x2E, 0x29, 0xD9, 0x1A, 0xEA, 0x39, 0xD2, 0x9D, 0x4D, 0xA7, 0x2D, 0x92,
+    0xDA, 0x4D, 0xA7, 0x1D, 0xA3, 0xD9, 0x4D, 0xA7, 0x0A, 0xD3, 0x9D, 0x5D, 0x97, 0x9D, 0x4A, 0xD5,
+    0xD9, 0x7D, 0x94, 0xAD, 0x4A, 0xD7, 0xE5, 0xAD, 0x4D, 0x96, 0xAD, 0x69, 0xD3, 0xE6, 0x9D, 0x97,
+    0xEA, 0xAE, 0x7D, 0xA7, 0x09, 0xFC, 0xA7, 0x9D, 0x73, 0x99, 0x97, 0x77, 0x71, 0x72, 0xAE, 0x97,
+    0x72, 0x9F, 0xD9, 0x77, 0x0A, 0xDA, 0x09, 0xE7, 0x70, 0xD9, 0x2A, 0xD7, 0x7A, 0xD3, 0xAD, 0x77,
+    0xDA, 0x3D, 0xA7, 0x69, 0xD9, 0x2A, 0xD7, 0x7A, 0xD2, 0xE7, 0x09, 0x6A, 0xD9, 0xAD, 0xA7, 0x1C,
+    0xA5, 0xAF, 0xC9, 0x71, 0xAD, 0x49, 0xEA, 0x70, 0x9A, 0xF9, 0x3A, 0xFA, 0x5A, 0xFE, 0x4E, 0x9E,
+    0x3A, 0xFC, 0xA9, 0x5D, 0xA1, 0xE2, 0xAE, 0xAC, 0xA6, 0xAD, 0x29, 0xDA, 0x1A, 0xC9, 0x0A, 0xCA,
+    0x6D, 0x93, 0xE9, 0x4D, 0x95, 0x9D, 0x49, 0xE3, 0x9D, 0x6A, 0xD5, 0xEA, 0x2D, 0xA6, 0xAD, 0x6E,
+    0xA0, 0xAD, 0x7A, 0xD6, 0x9F, 0xD9, 0x79, 0xE6, 0x9F, 0xA7, 0x1F, 0xA9, 0x99, 0x9A, 0xFD, 0xA7,
+    0x1F, 0xFE, 0xAF, 0xCA, 0x70, 0xAF, 0xEA, 0x2A, 0xFD, 0xA9, 0x79, 0x97, 0x0A, 0xFD, 0x77, 0x49,
+    0x9A, 0x92, 0x3A, 0x29, 0xD2, 0xE2, 0xDA, 0x19, 0xD9, 0x19, 0xD2, 0xAD, 0x2A, 0xCA, 0x2D, 0x92,
+    0xD7, 0x00, 0x77, 0x71, 0x9D, 0x72, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x19, 0xDA, 0x72, 0xE7,
+    0x2E, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x73, 0xDA, 0x72, 0xAD, 0x73,
+    0xE7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0x9D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7,
+    0x3E, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3E, 0x73, 0x9D, 0x97, 0x3E, 0x74, 0xDA, 0x73, 0x9D, 0x97,
+    0x3A, 0xD9, 0x73, 0xAC, 0x97, 0x74, 0x77, 0x49, 0xC9, 0x73, 0x9D, 0x97, 0x3A, 0xD9, 0x73, 0xAD,
+    0x74, 0xE7, 0x39, 0xD9, 0x73, 0xE7, 0x3A, 0xD7, 0x4D, 0xA7, 0x3E, 0x73, 0xE7, 0x3A, 0xD7, 0x3A,
+    0xD9, 0x72, 0x9D, 0x97, 0x2A, 0xD9, 0x72, 0xAD, 0x73, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xD9,
+    0x72, 0xE7, 0x3D, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0xAD, 0x72, 0xAD, 0x97, 0x1A, 0xD9,
+    0x71, 0xAD, 0x97, 0x1E, 0x97, 0x09, 0xE7, 0x2D, 0xA7, 0x77, 0x10, 0x5A, 0xC9, 0x4A, 0x2E, 0x3A,
+    0xD1, 0xD9, 0x3F, 0x0C, 0xA5, 0x9F, 0x9A, 0xD9, 0x3A, 0xFD, 0x91, 0xAD, 0xAC, 0x99, 0xAC, 0x90,
+    0xEA, 0x0C, 0xA4, 0x9D, 0x1D, 0x59, 0x2D, 0xA7, 0x0A, 0xA3, 0x69, 0x74, 0xDA, 0x73, 0xDA, 0x73,
+    0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x69, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xC6, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xD9, 0x50, 0x73, 0xE3,
+    0x9E, 0x93, 0xE9, 0x3E, 0x4E, 0x3A, 0xD3, 0x9D, 0xA2, 0x9D, 0xA2, 0xAD, 0x94, 0x95, 0x9F, 0xFA,
+    0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00, 0x5A, 0xD0, 0xAE, 0x9F, 0x9E, 0xA1, 0x99, 0x10, 0x76, 0xAC,
+    0xA7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76,
+    0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76,
+    0x9D, 0x97, 0x6E, 0x76, 0x9D, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0x9D, 0x77,
+    0xDA, 0x77, 0x99, 0x77, 0x71, 0x9A, 0xEA, 0x73, 0xAF, 0xF9, 0x70, 0xFF, 0xE9, 0x6E, 0xA3, 0x9F,
+    0x5E, 0xA5, 0xAE, 0x4A, 0xDA, 0x7E, 0x92, 0x9E, 0x70, 0xE9, 0x2E, 0x97, 0x0E, 0xA1, 0x9E, 0x71,
+    0xE9, 0x1A, 0xDA, 0x71, 0xE9, 0x1E, 0x97, 0x1E, 0x19, 0xE7, 0x19, 0xE1, 0xAE, 0x71, 0xAE, 0x1E,
+    0xA7, 0x1E, 0x91, 0xEA, 0x71, 0xE2, 0xE9, 0x70, 0xAD, 0xA2, 0xEA, 0x70, 0xE3, 0xEA, 0x7A, 0xDA,
+    0x3F, 0x69, 0xE4, 0xAE, 0x94, 0xAE, 0x95, 0xFA, 0x99, 0xAF, 0x96, 0x9F, 0xFD, 0x71, 0x9F, 0xE9,
+    0x75, 0x99, 0x73, 0x71, 0x9A, 0x96, 0x9A, 0xEA, 0x39, 0xFE, 0x93, 0xFF, 0x69, 0x99, 0xE7, 0x09,
+    0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0xA7, 0x0E, 0x97,
+    0x0E, 0x70, 0x9E, 0x70, 0xAD, 0xA7, 0x0E, 0x97, 0x0E, 0x71, 0xE7, 0x09, 0xE7, 0x9F, 0x93, 0x9F,
+    0xFD, 0x1F, 0xFD, 0xA0, 0x70, 0x9A, 0xEA, 0x72, 0xAF, 0xFA, 0x7F, 0xFE, 0xA5, 0xF9, 0x3F, 0x4A,
+    0xE5, 0x9E, 0x93, 0xE6, 0x9E, 0x93, 0x9C, 0x96, 0x9E, 0x97, 0x5A, 0xE7, 0x6E, 0xA7, 0x5F, 0x75,
+    0xAE, 0x75, 0xAE, 0x97, 0x4A, 0xE9, 0x74, 0xAE, 0x97, 0x4F, 0x75, 0xF7, 0x49, 0xEA, 0x74, 0xAE,
+    0x97, 0x4F, 0x74, 0x9E, 0xA7, 0x49, 0xFF, 0xFE, 0x91, 0xAF, 0xFF, 0xE2, 0x9F, 0xFF, 0xD9, 0x20,
+    0x70, 0x9A, 0xEA, 0x71, 0xAF, 0xF9, 0x59, 0xFF, 0xE5, 0xEA, 0x39, 0xEA, 0x39, 0xDA, 0x5A, 0xE3,
+    0x9C, 0xA6, 0xAD, 0xA4, 0x97, 0xE9, 0x74, 0x9E, 0x74, 0xAE, 0x73, 0x9F, 0x72, 0x9F, 0xA7, 0x1F,
+    0xF9, 0x70, 0xAF, 0xFA, 0x74, 0x9F, 0x75, 0x9E, 0x97, 0x5E, 0x97, 0x49, 0xE7, 0x5F, 0x74, 0xF9,
+    0x72, 0xAF, 0x96, 0x99, 0xAF, 0xD9, 0x4F, 0xFD, 0xA6, 0xAF, 0xE9, 0x72, 0x99, 0x74, 0x76, 0xAC,
+    0xA7, 0x6F, 0x75, 0xFA, 0x74, 0xFC, 0xA7, 0x3E, 0xAD, 0x97, 0x2E, 0x9E, 0x72, 0xE9, 0x0E, 0x71,
+    0xE9, 0x09, 0xDA, 0x70, 0xE9, 0x1A, 0xD9, 0x7E, 0x92, 0xE7, 0xEA, 0x3E, 0x6A, 0xDA, 0x4E, 0x5A,
+    0xDA, 0x49, 0xDA, 0x4A, 0xDA, 0x5A, 0xD9, 0x3A, 0xE6, 0xE3, 0x9F, 0xFF, 0xFC, 0xAA, 0xFF, 0xFF,
+    0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9E, 0xA9, 0x99, 0x73, 0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A,
+    0xDA, 0x76, 0xAD, 0x94, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x94,
+    0x9E, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAF, 0xCA, 0x72, 0xFF, 0xA7, 0x19,
+    0x9A, 0xFC, 0xA7, 0x49, 0xF9, 0x74, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0xAD, 0xA7, 0x5E, 0x97,
+    0x4A, 0xE7, 0x4A, 0xE9, 0x72, 0x9F, 0xA7, 0x99, 0xAF, 0xCA, 0x5A, 0xFF, 0xC7, 0x9F, 0xDA, 0x73,
+    0x99, 0x75, 0x74, 0x9A, 0xE9, 0x73, 0xAF, 0xE7, 0x1A, 0xFC, 0xA9, 0x72, 0xFC, 0x97, 0x39, 0xF9,
+    0x74, 0x9F, 0x76, 0xF7, 0x6F, 0x76, 0xAE, 0x77, 0xFF, 0xCA, 0x97, 0xAF, 0xFE, 0xA6, 0xEA, 0x99,
+    0x09, 0xAF, 0x94, 0x9E, 0x6F, 0x4A, 0xDA, 0x69, 0xE4, 0xE9, 0x7E, 0x4E, 0x97, 0xE4, 0xE9, 0x69,
+    0xE4, 0xE9, 0x6A, 0xDA, 0x4A, 0xDA, 0x6E, 0x94, 0x9E, 0x5F, 0x6F, 0x91, 0x9F, 0x70, 0xFF, 0xD7,
+    0x2A, 0xFD, 0x97, 0x69, 0x97, 0x20, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFD,
+    0xA0, 0x9F, 0xFF, 0xDA, 0x0A, 0xD9, 0x99, 0x99, 0x99, 0x9A, 0xE1, 0xDA, 0x7E, 0x2D, 0x7E, 0x91,
+    0x9C, 0xA6, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3E, 0xA7, 0x3A, 0xE7,
+    0x39, 0xE7, 0x4E, 0xA7, 0x3A, 0xE7, 0x39, 0xE9, 0x73, 0xF7, 0x39, 0xE9, 0x73, 0xF7, 0x39, 0xE9,
+    0x73, 0xAE, 0x74, 0x9D, 0x97, 0x59, 0x97, 0x50, 0x70, 0x9A, 0xEA, 0x71, 0xAF, 0xF9, 0x6F, 0xA9,
+    0xAF, 0x94, 0xEA, 0x4E, 0xA3, 0xAD, 0xA5, 0x9E, 0x3E, 0x95, 0x9D, 0xA3, 0xE9, 0x5A, 0xD9, 0x3E,
+    0xA4, 0x9E, 0x4A, 0xE9, 0x29, 0xE6, 0xFA, 0x9F, 0x70, 0xFE, 0x97, 0x1A, 0xFC, 0xA7, 0x09, 0xEA,
+    0xFC, 0x6A, 0xE2, 0xAF, 0x4A, 0xDA, 0x4A, 0xE9, 0x29, 0xE6, 0xF2, 0xE9, 0x6A, 0xE2, 0xE7, 0xAE,
+    0x19, 0xE7, 0xEA, 0x2E, 0xA5, 0xAE, 0x3A, 0xF9, 0x19, 0xF9, 0x4F, 0xFE, 0x7A, 0xFE, 0x97, 0x39,
+    0x97, 0x10, 0x70, 0xAE, 0xA9, 0x72, 0xAF, 0xF7, 0x0F, 0xAA, 0xAF, 0x6F, 0x4F, 0x49, 0xE5, 0x9E,
+    0x4E, 0x96, 0xE9, 0x3E, 0x7E, 0x92, 0x9E, 0x7E, 0xA2, 0xAE, 0x7E, 0x92, 0xAE, 0x7E, 0x92, 0x9E,
+    0x95, 0x9E, 0x4F, 0x94, 0xAE, 0x49, 0xFF, 0xF9, 0x59, 0xFF, 0xE7, 0x09, 0x9A, 0x99, 0x9E, 0x97,
+    0x5F, 0x75, 0xAE, 0x75, 0xAE, 0x97, 0x4F, 0x97, 0x3A, 0xF9, 0x71, 0x9A, 0xFC, 0x79, 0xAF, 0xE9,
+    0x70, 0x9F, 0xD9, 0x74, 0x99, 0x97, 0x50, 0x49, 0x93, 0x9E, 0x92, 0xF9, 0x2F, 0x3A, 0xD7, 0x77,
+    0x77, 0x77, 0x72, 0xAD, 0x3A, 0xE9, 0x2F, 0x92, 0xEA, 0x49, 0x94, 0x79, 0x96, 0x9E, 0x95, 0xF9,
+    0x5F, 0x6A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xE6, 0x9E, 0x96, 0xE9, 0x6E, 0x7E, 0x6A,
+    0xD6, 0x9D, 0xA5, 0x9D, 0xA5, 0xAD, 0x97, 0x97, 0x00, 0x73, 0x97, 0x39, 0xD9, 0x70, 0x9F, 0xC6,
+    0x9F, 0xC9, 0x59, 0xFC, 0x95, 0x9F, 0xC9, 0x59, 0xFC, 0x97, 0xAE, 0x97, 0x19, 0xFA, 0x72, 0x9F,
+    0xA7, 0x2A, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xF7, 0x39, 0xC9, 0x77, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x77, 0x77, 0x75, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x00, 0x09, 0x75, 0xD9, 0x72, 0x9F,
+    0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xF7, 0x19, 0xF7,
+    0x9F, 0xA6, 0x9F, 0xA6, 0xAF, 0xA6, 0xAF, 0xA7, 0x0E, 0xA7, 0x2A, 0xA7, 0x77, 0x20, 0x39, 0xAA,
+    0x95, 0x9F, 0xD4, 0xFF, 0x3E, 0xAA, 0xEA, 0x2A, 0x4E, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x7E,
+    0x7A, 0xD9, 0x6E, 0x96, 0xE9, 0x6E, 0x7E, 0x79, 0xD7, 0x09, 0xDA, 0xAA, 0x59, 0xFA, 0x6A, 0xDA,
+    0x77, 0x77, 0xAA, 0x97, 0xAE, 0x7E, 0xA7, 0xE9, 0x79, 0x97, 0x00, 0x77, 0x99, 0x99, 0x99, 0x77,
+    0x39, 0xAF, 0xFD, 0xA7, 0x6A, 0xFF, 0xFE, 0x97, 0x29, 0xFA, 0x96, 0x9F, 0xA7, 0x0A, 0xEA, 0x73,
+    0x9E, 0x96, 0xF7, 0x69, 0xE5, 0xEA, 0x77, 0x0A, 0xD4, 0xAD, 0xA5, 0x9A, 0xA9, 0x19, 0x93, 0x9D,
+    0xA2, 0x9D, 0xA5, 0xFD, 0xAD, 0x4D, 0xA2, 0xE5, 0xEA, 0x9F, 0xC4, 0xDA, 0x19, 0xD9, 0x4E, 0x3A,
+    0xDA, 0x4D, 0xA1, 0xE4, 0xAD, 0x94, 0xD5, 0xDA, 0x1D, 0xA4, 0xDA, 0x49, 0xD5, 0xD9, 0x09, 0xD4,
+    0x9D, 0x94, 0xAC, 0xA4, 0x9D, 0x1A, 0xD4, 0xE5, 0xD9, 0x4E, 0x1E, 0x4E, 0x4A, 0xD5, 0xD9, 0x1E,
+    0x4D, 0xA3, 0x9E, 0x4E, 0x2E, 0x4D, 0xA3, 0xF3, 0xAD, 0x92, 0xE4, 0xE2, 0xD9, 0xD2, 0xAD, 0x93,
+    0xE4, 0xFA, 0xD0, 0x9D, 0xAF, 0x94, 0xE4, 0xAF, 0xC2, 0xFD, 0x6A, 0xD9, 0x49, 0xAA, 0x94, 0xAA,
+    0x97, 0x09, 0xE7, 0x77, 0x2E, 0x97, 0x77, 0x19, 0xE9, 0x77, 0x71, 0xAE, 0xA7, 0x29, 0xCA, 0x73,
+    0xAF, 0xCA, 0x99, 0x99, 0x9A, 0xF9, 0x74, 0x9F, 0xFF, 0xCA, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0x77,
+    0x77, 0x10, 0x77, 0x09, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A,
+    0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD,
+    0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD,
+    0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D,
+    0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3,
+    0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x77, 0x70, 0x9A, 0xFF, 0xCA, 0x6A,
+    0xFF, 0xFC, 0x5A, 0xA9, 0xAD, 0xA2, 0xAF, 0x7E, 0x94, 0xE9, 0x6E, 0x5A, 0xDA, 0x6E, 0x5A, 0xDA,
+    0x59, 0xDA, 0x5A, 0xD9, 0x5A, 0xD9, 0x5E, 0x6E, 0x94, 0xAD, 0x96, 0xE9, 0x3A, 0xDA, 0x7F, 0xFD,
+    0x97, 0x9F, 0xFE, 0x96, 0xAD, 0x93, 0x9F, 0x95, 0xE6, 0xAE, 0x5E, 0x7E, 0x49, 0xE7, 0xE4, 0x9D,
+    0xA7, 0xE4, 0xAD, 0x96, 0x9E, 0x4E, 0x7E, 0x94, 0xE6, 0xAE, 0x49, 0xE9, 0x99, 0x09, 0x9F, 0x3A,
+    0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA9, 0x77, 0x71, 0x77, 0x73, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xEA,
+    0x49, 0xFA, 0xA9, 0x9A, 0xFA, 0x39, 0xEA, 0x69, 0xD9, 0x29, 0xE9, 0x79, 0xD3, 0xE9, 0x70, 0x9D,
+    0x2A, 0xDA, 0x71, 0x9C, 0x92, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x79, 0xE7,
+    0x7A, 0xE7, 0x7A, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xEA, 0x77, 0xF9, 0x71, 0xCA, 0x29, 0xFA,
+    0x6A, 0xD9, 0x3A, 0xFC, 0xAA, 0xAA, 0xFA, 0x5A, 0xFF, 0xE9, 0x79, 0xAF, 0xE9, 0x75, 0x99, 0x71,
+    0x77, 0x74, 0x9A, 0xFF, 0xDA, 0x71, 0xAF, 0xFF, 0xDA, 0x7A, 0xA9, 0xAD, 0xA2, 0x9A, 0xFC, 0x71,
+    0xAD, 0x95, 0xAF, 0x70, 0xE7, 0x9E, 0xA7, 0xE7, 0x0A, 0xE6, 0x9E, 0x70, 0x9E, 0x95, 0xAD, 0xA7,
+    0x1E, 0xA5, 0xE9, 0x71, 0xEA, 0x5E, 0x72, 0xEA, 0x5E, 0x72, 0xEA, 0x49, 0xDA, 0x72, 0xE9, 0x4A,
+    0xDA, 0x72, 0xE9, 0x4E, 0x97, 0x19, 0xE5, 0xE7, 0x2E, 0xA4, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x1E,
+    0xA5, 0xAD, 0x97, 0x0A, 0xE6, 0xE9, 0x7A, 0xE7, 0xE7, 0xF9, 0x69, 0xE9, 0x29, 0x9F, 0xC6, 0xAF,
+    0xFF, 0xD9, 0x6A, 0xFF, 0xEA, 0x97, 0x77, 0x71, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD,
+    0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA,
+    0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA,
+    0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3,
+    0xAF, 0xFF, 0xEA, 0x30, 0x4F, 0xFF, 0xDA, 0x4F, 0xFF, 0xDA, 0x59, 0xAE, 0xAA, 0xAA, 0xAE, 0x96,
+    0xAD, 0x95, 0xD7, 0xE6, 0xD7, 0xE6, 0xC9, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x70,
+    0xE9, 0xAA, 0xAA, 0xAA, 0x70, 0x9F, 0xFD, 0x70, 0xAE, 0xAA, 0xAA, 0xAA, 0xA7, 0x0E, 0x97, 0x7E,
+    0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x5A, 0xFF, 0x71,
+    0xAF, 0xFC, 0x71, 0x77, 0x74, 0x9A, 0xFE, 0xA9, 0x70, 0xFF, 0xFC, 0x94, 0x9F, 0xAA, 0x99, 0xAA,
+    0xF9, 0x39, 0xEA, 0x7A, 0xD3, 0x9E, 0x97, 0x0A, 0xD3, 0xE9, 0x71, 0xAC, 0xA2, 0xAD, 0xA7, 0x2D,
+    0x3E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x9F, 0xE9,
+    0xAE, 0x7A, 0xFE, 0x9A, 0xE7, 0x19, 0xAE, 0x90, 0x9E, 0x73, 0xE1, 0x9E, 0x73, 0xE2, 0xEA, 0x71,
+    0x9D, 0xA2, 0xF9, 0x70, 0xAD, 0x93, 0xFA, 0x7E, 0x49, 0xFC, 0xAA, 0x9A, 0xAF, 0xC5, 0x9F, 0xFF,
+    0xCA, 0x7A, 0xFF, 0xA9, 0x75, 0x99, 0x71, 0x4F, 0xFA, 0x4A, 0xFF, 0x5F, 0xF9, 0x4F, 0xFA, 0x69,
+    0xAE, 0x97, 0x0A, 0xE9, 0x71, 0xAD, 0x97, 0x1A, 0xDA, 0x72, 0xE9, 0x71, 0xE9, 0x72, 0xE7, 0x2E,
+    0x72, 0x9E, 0x72, 0xE7, 0x2A, 0xDA, 0x71, 0x9D, 0xA7, 0x2E, 0x97, 0x1A, 0xDA, 0x72, 0xE7, 0x2E,
+    0x97, 0x2F, 0xFF, 0xFC, 0x72, 0x9F, 0xFF, 0xFC, 0x72, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9A,
+    0xDA, 0x72, 0xE9, 0x71, 0xAD, 0x97, 0x2E, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x29, 0xDA, 0x71,
+    0x9E, 0x72, 0xAD, 0xA7, 0x1A, 0xDA, 0x72, 0xE9, 0x71, 0xE9, 0x72, 0xE7, 0x2E, 0x72, 0x9E, 0x71,
+    0x9E, 0x97, 0xAF, 0xE9, 0x4A, 0xFE, 0xA4, 0xAF, 0xF4, 0x9F, 0xF9, 0x40, 0x4F, 0xFC, 0x5F, 0xF9,
+    0x69, 0xAE, 0x97, 0x1A, 0xD9, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72,
+    0xE7, 0x3E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x2A,
+    0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x0A, 0xFE, 0x94, 0xAF, 0xF9, 0x40, 0x71, 0xFF, 0xC7,
+    0x2F, 0xFA, 0x73, 0x9A, 0xE9, 0x76, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7,
+    0x7A, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E,
+    0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E,
+    0x77, 0x9D, 0xA7, 0x1A, 0xA3, 0xE7, 0x19, 0xEA, 0xF9, 0x71, 0x9F, 0xEA, 0x73, 0xAF, 0xA7, 0x77,
+    0x70, 0x4F, 0xFA, 0x2F, 0xF4, 0xFF, 0x91, 0x9F, 0xE9, 0x59, 0xAE, 0x95, 0xF9, 0x70, 0xAD, 0x95,
+    0xEA, 0x72, 0xE9, 0x4E, 0xA7, 0x3E, 0x4E, 0x97, 0x39, 0xE2, 0x9E, 0x97, 0x4A, 0xDA, 0x19, 0xE7,
+    0x6E, 0x90, 0xAD, 0xA7, 0x7E, 0x0A, 0xDA, 0x77, 0x0F, 0xD9, 0x77, 0x09, 0xFD, 0x97, 0x70, 0xAD,
+    0xAA, 0xE7, 0x70, 0xE9, 0x0E, 0xA7, 0x7E, 0x19, 0xE9, 0x75, 0x9E, 0x2A, 0xE7, 0x59, 0xDA, 0x3F,
+    0x74, 0xAD, 0xA3, 0x9E, 0xA7, 0x3E, 0x94, 0xAE, 0xA7, 0x2E, 0x6F, 0xA7, 0x09, 0xE7, 0xFC, 0x5A,
+    0xFF, 0x5F, 0xC9, 0x2A, 0xFF, 0xC6, 0xAF, 0x77, 0x59, 0x93, 0x4F, 0xFC, 0x71, 0xFF, 0xA7, 0x29,
+    0xAE, 0x97, 0x5A, 0xD9, 0x76, 0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE7,
+    0x7E, 0x76, 0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0x97, 0x6E, 0x76, 0x9E, 0x76, 0x9D, 0xA7, 0x0C, 0xA3,
+    0xAD, 0xA7, 0xAC, 0xA3, 0xE9, 0x7D, 0x93, 0xE7, 0xAD, 0x39, 0xE9, 0x99, 0xAA, 0xAA, 0xAD, 0xA1,
+    0xAF, 0xFF, 0xE9, 0x0A, 0xFF, 0xFF, 0x10, 0x6F, 0xE7, 0x1A, 0xFD, 0x96, 0xFE, 0x70, 0x9F, 0xDA,
+    0x71, 0xFC, 0x97, 0xFC, 0xA7, 0x3F, 0xC9, 0x69, 0xFC, 0x97, 0x29, 0xDA, 0xDA, 0x6D, 0xAE, 0x97,
+    0x2A, 0xD9, 0xDA, 0x59, 0xD0, 0xE7, 0x3D, 0xA0, 0xE5, 0xDA, 0x0E, 0x72, 0x9D, 0x90, 0xE4, 0xAD,
+    0x1E, 0x72, 0xAD, 0x1E, 0x4D, 0x91, 0xE7, 0x2E, 0x1A, 0xD9, 0x2A, 0xD2, 0xE7, 0x2D, 0xA1, 0xAD,
+    0x92, 0xD9, 0x2E, 0x71, 0x9D, 0x29, 0xDA, 0x1A, 0xD2, 0x9D, 0xA7, 0x1E, 0x3E, 0x1D, 0x39, 0xDA,
+    0x71, 0xDA, 0x3E, 0x0D, 0xA3, 0x9D, 0xA7, 0x09, 0xD9, 0x3E, 0x9D, 0x4A, 0xDA, 0x70, 0xAD, 0x4A,
+    0xF9, 0x4A, 0xD9, 0x70, 0xE4, 0xAF, 0x5A, 0xD9, 0x79, 0xD9, 0x49, 0xE9, 0x5A, 0xD9, 0x7A, 0xD6,
+    0xE6, 0xE7, 0x0E, 0x6D, 0x7E, 0x79, 0xDA, 0x77, 0x0E, 0x94, 0xAF, 0xE7, 0x39, 0xFE, 0x91, 0x9F,
+    0xF7, 0x3F, 0xF9, 0x10, 0x4F, 0xC9, 0x7F, 0xF5, 0xFC, 0xA7, 0xFE, 0xA6, 0x9F, 0x71, 0xAD, 0x97,
+    0x1F, 0xA7, 0x0E, 0x72, 0xFC, 0x70, 0xDA, 0x72, 0xFC, 0xA7, 0xDA, 0x71, 0x9D, 0xAE, 0x69, 0xD9,
+    0x71, 0xAD, 0x0E, 0x95, 0xAD, 0x72, 0xE0, 0xAE, 0x5E, 0x72, 0xDA, 0x1E, 0x94, 0xDA, 0x71, 0x9D,
+    0x91, 0xAD, 0xA4, 0xD9, 0x71, 0x9D, 0x3E, 0x39, 0xD9, 0x71, 0xAD, 0x3A, 0xDA, 0x2A, 0xD7, 0x2E,
+    0x4E, 0x2E, 0x72, 0xDA, 0x4E, 0xA1, 0xDA, 0x71, 0x9D, 0x94, 0x9E, 0x1D, 0x97, 0x1A, 0xD6, 0xE9,
+    0x9D, 0x72, 0xE6, 0x9E, 0xAD, 0x72, 0xE7, 0xFD, 0x72, 0xDA, 0x79, 0xFA, 0x71, 0x9D, 0x97, 0x0F,
+    0x97, 0xAF, 0xDA, 0x6A, 0xE7, 0xAF, 0xEA, 0x7E, 0x77, 0x70, 0x97, 0x10, 0x77, 0x77, 0xAF, 0xE9,
+    0x73, 0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A,
+    0xE4, 0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97,
+    0x49, 0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A,
+    0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA,
+    0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70,
+    0x99, 0x74, 0x77, 0x70, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFC, 0x94, 0xAA, 0x9A, 0xDA, 0x29, 0xF7,
+    0xAD, 0x94, 0xEA, 0x6E, 0x59, 0xE6, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x5A, 0xDA, 0x59, 0xDA, 0x5E,
+    0x95, 0xE9, 0x5E, 0x5A, 0xDA, 0x6E, 0x4A, 0xE6, 0x9E, 0x09, 0x9A, 0xF7, 0xAF, 0xFC, 0x97, 0x0F,
+    0xEA, 0x97, 0x2E, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7,
+    0x5A, 0xFF, 0x71, 0xAF, 0xFC, 0x71, 0x77, 0x77, 0x4A, 0xFD, 0xA9, 0x77, 0x0A, 0xFF, 0xDA, 0x75,
+    0x9F, 0xA9, 0x99, 0x9F, 0xC7, 0x39, 0xEA, 0x69, 0xEA, 0x71, 0x9E, 0xA7, 0x0A, 0xE7, 0x1E, 0xA7,
+    0x2E, 0x97, 0xAE, 0x73, 0xF7, 0xE9, 0x73, 0xAE, 0x6A, 0xE7, 0x49, 0xE6, 0xE9, 0x74, 0x9E, 0x6E,
+    0x75, 0xAE, 0x59, 0xE7, 0x5A, 0xDA, 0x5A, 0xE7, 0x5E, 0x95, 0xAD, 0xA7, 0x5E, 0x6A, 0xDA, 0x74,
+    0xAE, 0x6A, 0xE7, 0x4E, 0x96, 0x9E, 0x73, 0xAE, 0x70, 0xE9, 0x71, 0x9E, 0x71, 0xF7, 0x09, 0xEA,
+    0x72, 0xEA, 0x69, 0xEA, 0x73, 0xAF, 0x91, 0x9A, 0xF9, 0x75, 0xAF, 0xFE, 0x77, 0x09, 0xFE, 0xA7,
+    0x74, 0xFA, 0x77, 0x79, 0xFA, 0x77, 0x7A, 0xFC, 0x97, 0x76, 0xFE, 0x99, 0x77, 0x4A, 0xFF, 0xCA,
+    0xAA, 0xA7, 0x7A, 0xFF, 0xDA, 0x77, 0x19, 0xAF, 0xDA, 0x77, 0x75, 0x77, 0x72, 0x9A, 0xFF, 0xA9,
+    0x70, 0xAF, 0xFF, 0xC7, 0xAA, 0x9A, 0xDA, 0x2A, 0xEA, 0x71, 0xE9, 0x39, 0xE7, 0x1E, 0x5E, 0x97,
+    0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x97, 0xAD, 0xA5, 0xE7, 0x0E, 0x94, 0xAD, 0xA7, 0x0E, 0x4A,
+    0xE7, 0x1E, 0x29, 0xF9, 0x70, 0x9F, 0xFC, 0xA7, 0x2A, 0xFE, 0xA7, 0x4E, 0xA9, 0xAD, 0x97, 0x4E,
+    0x2E, 0x73, 0x9E, 0x2E, 0x97, 0x29, 0xDA, 0x29, 0xE7, 0x2A, 0xD9, 0x3F, 0x71, 0xE5, 0xEA, 0x70,
+    0xE5, 0x9E, 0xA6, 0x9E, 0x6A, 0xEA, 0x3A, 0xFE, 0xA4, 0xAF, 0x90, 0xAF, 0xFA, 0x59, 0xF7, 0x72,
+    0x99, 0x10, 0x77, 0x7A, 0xFD, 0xA9, 0x5A, 0xFF, 0xDA, 0x3A, 0xE9, 0x29, 0xE9, 0x29, 0xE5, 0x9D,
+    0x92, 0xAD, 0x95, 0x9D, 0x3E, 0x69, 0xCA, 0x3E, 0x95, 0x9A, 0x4F, 0x74, 0xAE, 0xA7, 0x4F, 0xC9,
+    0x73, 0xFC, 0xA7, 0x3A, 0xFC, 0x97, 0x29, 0xFC, 0x97, 0x3A, 0xF9, 0x73, 0x9F, 0x29, 0xA7, 0xAE,
+    0x2D, 0x70, 0xE1, 0x9D, 0x70, 0xE1, 0xAD, 0x96, 0x9D, 0xA1, 0xAD, 0xA6, 0xE2, 0xAE, 0xA9, 0x29,
+    0xEA, 0x29, 0xFF, 0xEA, 0x59, 0xFE, 0xA7, 0x39, 0x97, 0x00, 0x09, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF,
+    0xFD, 0x0E, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAD, 0xA0, 0xDA, 0x3A, 0xDA, 0x4D, 0x90, 0xD4, 0xAD,
+    0x94, 0xD1, 0xD4, 0xE9, 0x4D, 0x1C, 0xA4, 0xE4, 0x9C, 0x97, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97,
+    0x7E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7,
+    0x7A, 0xDA, 0x77, 0xE9, 0x76, 0x9E, 0x97, 0x4A, 0xFF, 0x71, 0xAF, 0xFC, 0x70, 0x9F, 0xF5, 0xFF,
+    0x0A, 0xFE, 0xA5, 0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9, 0x5E, 0x72, 0xE5, 0x9E, 0x72, 0xDA, 0x5A,
+    0xDA, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7,
+    0x2D, 0xA5, 0xAD, 0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD6, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5,
+    0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A, 0xDA, 0x71, 0xAD, 0x6A, 0xDA, 0x71, 0xDA,
+    0x6A, 0xE7, 0x0E, 0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA, 0x99, 0xAF, 0xA7, 0x2F, 0xFE, 0x97, 0x4A,
+    0xFE, 0xA7, 0x71, 0x99, 0x77, 0x0F, 0xFA, 0x39, 0xFF, 0x09, 0xFF, 0x4A, 0xFE, 0xA2, 0xAE, 0xA9,
+    0x79, 0xE9, 0x5E, 0x97, 0x09, 0xDA, 0x6E, 0x97, 0x0E, 0x7E, 0x97, 0xAD, 0xA7, 0xAD, 0xA7, 0xE7,
+    0x0A, 0xDA, 0x6A, 0xD9, 0x70, 0x9E, 0x6E, 0x72, 0xE5, 0xAD, 0x97, 0x2E, 0x5E, 0x73, 0xE4, 0xAD,
+    0x74, 0xAD, 0x92, 0x9D, 0xA7, 0x4A, 0xD9, 0x2E, 0x75, 0x9D, 0xA1, 0x9D, 0xA7, 0x59, 0xDA, 0x1E,
+    0x77, 0xE0, 0x9D, 0x97, 0x7E, 0x0E, 0x77, 0x0E, 0x9D, 0x97, 0x70, 0xAF, 0xC7, 0x71, 0x9F, 0x77,
+    0x29, 0xEA, 0x77, 0x3E, 0x77, 0x77, 0x60, 0x0A, 0xFF, 0x59, 0xA9, 0x5A, 0xFE, 0xA0, 0xFF, 0xA5,
+    0xDA, 0x5F, 0xF9, 0x19, 0xF9, 0x6A, 0xE7, 0xAE, 0x94, 0xAD, 0xA7, 0xF7, 0xAD, 0x95, 0xAD, 0xA6,
+    0x9F, 0x7E, 0x6A, 0xE6, 0xFC, 0x6A, 0xD9, 0x69, 0xE5, 0x9F, 0xC6, 0xE7, 0x9E, 0x5F, 0xD5, 0x9D,
+    0x97, 0x9E, 0x49, 0xD9, 0xAD, 0x94, 0xE7, 0x09, 0xE4, 0xE0, 0xAD, 0x93, 0x9D, 0x97, 0x1E, 0x39,
+    0xD9, 0x09, 0xD9, 0x3E, 0x72, 0xE3, 0xE1, 0x9D, 0xA3, 0xD9, 0x72, 0xE2, 0x9D, 0x91, 0x9D, 0xA2,
+    0xAD, 0x73, 0xE2, 0xE3, 0xDA, 0x2D, 0x97, 0x3E, 0x19, 0xD9, 0x3E, 0x1A, 0xD7, 0x4E, 0x1E, 0x4E,
+    0x1D, 0x97, 0x4A, 0xD0, 0x9D, 0x94, 0xE0, 0x9D, 0x75, 0xAD, 0x0E, 0x5E, 0x0D, 0xA7, 0x5A, 0xDA,
+    0xD6, 0xAD, 0xAD, 0x76, 0x9F, 0xA6, 0xAF, 0xA7, 0x69, 0xF7, 0x9F, 0x77, 0x9E, 0xA7, 0x9E, 0xA7,
+    0x70, 0xE7, 0x09, 0xE7, 0x77, 0x77, 0x60, 0x5F, 0xFA, 0x2F, 0xF5, 0x9F, 0xF3, 0xFE, 0xA7, 0x9F,
+    0x96, 0xEA, 0x72, 0xAE, 0x6A, 0xD9, 0x74, 0xE9, 0x4A, 0xDA, 0x75, 0xAE, 0x39, 0xDA, 0x77, 0xE3,
+    0xDA, 0x77, 0x0A, 0xDA, 0x1E, 0x77, 0x2E, 0x0E, 0x77, 0x3A, 0xFC, 0x77, 0x5F, 0x77, 0x6F, 0x77,
+    0x5F, 0xC9, 0x77, 0x3E, 0x9E, 0x77, 0x2A, 0xD1, 0xE9, 0x77, 0x0A, 0xD9, 0x19, 0xE7, 0x7A, 0xD9,
+    0x3E, 0x97, 0x59, 0xDA, 0x49, 0xE7, 0x49, 0xE6, 0xE9, 0x73, 0xE7, 0x9E, 0x71, 0x9E, 0x97, 0x0E,
+    0xA6, 0xAF, 0xE9, 0x39, 0xFF, 0x92, 0x9F, 0xF9, 0x3F, 0xFC, 0x30, 0xAF, 0xF3, 0xFF, 0x9F, 0xFA,
+    0x3F, 0xEA, 0x19, 0xF9, 0x69, 0xEA, 0x4A, 0xE7, 0x9D, 0xA6, 0xE9, 0x6E, 0x7A, 0xDA, 0x5E, 0x70,
+    0x9E, 0x4A, 0xD9, 0x71, 0xE9, 0x29, 0xDA, 0x72, 0xAD, 0xA2, 0xE7, 0x4E, 0x1A, 0xD7, 0x5E, 0x99,
+    0xD9, 0x75, 0x9F, 0xCA, 0x77, 0xFC, 0x77, 0x0A, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71,
+    0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xEA, 0x76, 0xAF, 0xF9, 0x72, 0x9F,
+    0xFC, 0x97, 0x10, 0x4F, 0xFF, 0xD9, 0x39, 0xFF, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA,
+    0x3D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x5D, 0x6A, 0xE6, 0xA9, 0x59, 0xE7, 0x69, 0xE9, 0x76, 0xE9,
+    0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7,
+    0xAC, 0x4A, 0xE7, 0x0D, 0x39, 0xE7, 0x0A, 0xD2, 0x9E, 0x97, 0x0E, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAE, 0x91, 0x9F, 0xFF, 0xF3, 0xFF, 0xFE, 0xA7, 0x76, 0x7F, 0xC9, 0x69, 0xFC, 0x7A, 0xD7, 0x2E,
+    0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A,
+    0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19,
+    0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xAF, 0xA7, 0xFC, 0xA7, 0x74, 0x9C, 0xA7, 0x19, 0xD9, 0x71, 0xDA, 0x71,
+    0xAD, 0x72, 0xD9, 0x71, 0xE7, 0x19, 0xD7, 0x2D, 0xA7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xDA, 0x71,
+    0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xDA, 0x71,
+    0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0x99, 0x00, 0x7F, 0xC9,
+    0x69, 0xFC, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA,
+    0x71, 0x9D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D,
+    0xA7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72,
+    0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x7A, 0xFA, 0x7F, 0xCA, 0x77, 0x40, 0x59,
+    0xE7, 0x3A, 0xE9, 0x72, 0xFA, 0x71, 0xAD, 0xAD, 0x71, 0xDA, 0x0D, 0xA7, 0x9D, 0x90, 0xE7, 0xAD,
+    0x19, 0xD9, 0x6D, 0xA2, 0xDA, 0x5A, 0xD3, 0xAD, 0x5E, 0x4D, 0xA3, 0x9D, 0x94, 0xE3, 0xE5, 0x9D,
+    0x92, 0xDA, 0x6E, 0x1A, 0xD7, 0xAD, 0x1A, 0xCA, 0x70, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0x90, 0x69, 0xD3, 0xE9, 0x2A, 0xE3, 0xAE, 0x3A, 0xDA,
+    0x39, 0xD5, 0x90, 0x77, 0x79, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD,
+    0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E,
+    0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9,
+    0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F,
+    0xA3, 0xEA, 0x59, 0x96, 0x94, 0x59, 0x99, 0x72, 0xAF, 0xC9, 0x71, 0xFD, 0x97, 0x4E, 0x75, 0xE7,
+    0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA1, 0x9F, 0x94, 0x9D, 0x90, 0x9F, 0xD4,
+    0xAD, 0x0A, 0xDA, 0xAE, 0xA3, 0xE9, 0xD2, 0xAE, 0x3D, 0xAD, 0x39, 0xE3, 0xF4, 0x9E, 0x29, 0xEA,
+    0x49, 0xE2, 0xAE, 0x59, 0xDA, 0x2E, 0x95, 0xAD, 0x92, 0xE6, 0xE2, 0x9D, 0xA6, 0xE2, 0xAD, 0x95,
+    0xAD, 0x92, 0xE5, 0x9E, 0x3D, 0xA5, 0xE3, 0xAE, 0xA9, 0x19, 0xE9, 0x3F, 0xFE, 0x94, 0xDA, 0xAF,
+    0xCA, 0x74, 0x99, 0x70, 0x77, 0x29, 0xFC, 0x94, 0xFF, 0x3E, 0xA9, 0xAD, 0xA2, 0xE4, 0x92, 0xAD,
+    0x71, 0xDA, 0x70, 0xAD, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7,
+    0x0A, 0xE6, 0xA0, 0x9E, 0x49, 0xD1, 0xFA, 0x9A, 0xE9, 0x1A, 0xFF, 0x4A, 0xFC, 0x97, 0x99, 0x60,
+    0x75, 0x99, 0x97, 0x39, 0xFC, 0xA7, 0x2F, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA7,
+    0x59, 0xDA, 0x75, 0xAD, 0x96, 0x9F, 0xA0, 0xE6, 0xAF, 0xFD, 0x5A, 0xE9, 0x9A, 0xFA, 0x49, 0xDA,
+    0x4E, 0x94, 0xE5, 0xAD, 0x4E, 0x6E, 0x4D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0xE6, 0xE4, 0xDA,
+    0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A,
+    0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA,
+    0x59, 0x96, 0x94, 0x77, 0x39, 0xFC, 0x95, 0xFF, 0x4E, 0x2A, 0xD9, 0x2D, 0xA3, 0x9D, 0x91, 0xAD,
+    0x4A, 0xD9, 0x1D, 0xA3, 0x9E, 0x1A, 0xD3, 0xAE, 0x2E, 0x19, 0xF2, 0x9E, 0xAF, 0xA3, 0x9F, 0xD9,
+    0x5A, 0xE9, 0x70, 0xAD, 0x97, 0x1A, 0xD9, 0x6A, 0x19, 0xE4, 0x9D, 0x91, 0xFA, 0x9A, 0xEA, 0x2A,
+    0xFF, 0xA4, 0xAF, 0xCA, 0x70, 0x99, 0x70, 0x77, 0x29, 0x77, 0x39, 0xFC, 0x97, 0x7A, 0xFE, 0x76,
+    0xAD, 0x91, 0xAD, 0x76, 0xDA, 0x39, 0x76, 0xAD, 0x77, 0x4E, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9,
+    0x77, 0x1A, 0xAF, 0xEA, 0x73, 0xAF, 0xFD, 0xA7, 0x39, 0x99, 0xAD, 0xA9, 0x99, 0x97, 0x79, 0xD9,
+    0x77, 0x3A, 0xD7, 0x74, 0xE7, 0x74, 0xE7, 0x73, 0x9D, 0xA7, 0x73, 0xAD, 0x97, 0x73, 0xE7, 0x74,
+    0xE7, 0x74, 0xDA, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x39, 0xDA,
+    0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x39, 0xD9, 0x75, 0xD9, 0x2E, 0x75, 0x9F, 0xAE,
+    0x77, 0xFE, 0x77, 0x1A, 0xAA, 0xA9, 0x77, 0x00, 0x77, 0x76, 0x9F, 0xFE, 0x70, 0xFF, 0xFA, 0x7E,
+    0x92, 0xE9, 0xA9, 0x7A, 0xD9, 0x3A, 0xD7, 0x2D, 0xA4, 0x9D, 0x71, 0x9D, 0x94, 0xAD, 0x71, 0xAD,
+    0x5E, 0x71, 0xAD, 0x93, 0xAD, 0x97, 0x19, 0xE2, 0xAD, 0x97, 0x3F, 0xF9, 0x75, 0xAF, 0xA7, 0x79,
+    0xD9, 0x77, 0x0A, 0xD7, 0x72, 0xE9, 0x77, 0x1F, 0xC9, 0x75, 0x9A, 0xFE, 0x97, 0x19, 0xFA, 0x9F,
+    0xD7, 0xAE, 0x94, 0xAF, 0x59, 0xE7, 0x9E, 0xA4, 0xAD, 0x97, 0x09, 0xDA, 0x4A, 0xDA, 0x70, 0xAD,
+    0x94, 0x9E, 0x96, 0xAE, 0x6F, 0xDA, 0xAA, 0xFC, 0x70, 0xAF, 0xFD, 0xA7, 0x39, 0xAA, 0xAA, 0xA9,
+    0x97, 0x10, 0x49, 0x99, 0x73, 0xAF, 0xC9, 0x72, 0xFD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75,
+    0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA2, 0x9F, 0x59, 0xD9, 0x1F, 0xDA, 0x4A, 0xD1, 0xEA, 0xF4,
+    0xE0, 0xDA, 0x2E, 0x4D, 0xAA, 0xCA, 0x3D, 0xA3, 0x9D, 0xAD, 0x39, 0xD9, 0x3A, 0xF4, 0xAD, 0x4F,
+    0x94, 0xE4, 0xF5, 0xDA, 0x4E, 0x59, 0xD9, 0x39, 0xE5, 0xAD, 0x4A, 0xD9, 0x5E, 0x4E, 0x6D, 0xA1,
+    0xA1, 0xE5, 0x9D, 0x90, 0xAC, 0x99, 0xDA, 0x5A, 0xFD, 0x0A, 0xD9, 0x5A, 0xFC, 0x1E, 0x69, 0xEA,
+    0x76, 0x94, 0x69, 0x7E, 0x5A, 0xE9, 0x4F, 0x5A, 0xD9, 0x77, 0x77, 0x71, 0x9A, 0xF3, 0xFD, 0x92,
+    0x99, 0x9E, 0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x59, 0xE5,
+    0xAD, 0xA1, 0xA2, 0xE9, 0x0D, 0x2F, 0xDA, 0x2F, 0xCA, 0x3F, 0x95, 0x96, 0x75, 0x97, 0x59, 0xE7,
+    0x4F, 0x74, 0xF7, 0x4E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAF, 0x72, 0xFD, 0x72, 0x99, 0x9E,
+    0x75, 0xE7, 0x49, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD,
+    0x97, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x74, 0xAD, 0x97, 0x4E,
+    0x74, 0x9D, 0xA7, 0x93, 0xE7, 0x9C, 0xA9, 0x9A, 0xD9, 0x7F, 0xEA, 0x70, 0xAF, 0xCA, 0x72, 0x9A,
+    0xA9, 0x73, 0x49, 0x99, 0x71, 0x9F, 0xD7, 0x0A, 0xFC, 0xA7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E,
+    0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x74, 0xAD, 0x19, 0xFA, 0x4D, 0xA0, 0xAF, 0xD9, 0x3D, 0xAD,
+    0xA1, 0xAD, 0x92, 0x9F, 0x92, 0x9D, 0x92, 0xAE, 0x93, 0xAD, 0x3E, 0xA3, 0x9D, 0xA3, 0xE3, 0x9E,
+    0x39, 0xD9, 0x19, 0xEA, 0x4A, 0xFF, 0x95, 0xFE, 0x97, 0xE0, 0xE7, 0x0D, 0xA0, 0x9D, 0xA6, 0x9D,
+    0x91, 0xEA, 0x5A, 0xD2, 0x9E, 0xA4, 0xE3, 0xAF, 0x92, 0xE4, 0xAF, 0xD9, 0xD9, 0x59, 0xF9, 0x73,
+    0x99, 0x10, 0x49, 0x99, 0x2A, 0xFC, 0x91, 0xFD, 0x94, 0xAD, 0x5E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9,
+    0x4E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9, 0x4E, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5E, 0x5E, 0x49,
+    0xDA, 0x4A, 0xD9, 0x4E, 0x19, 0x91, 0xE0, 0x9C, 0xA0, 0x9F, 0xD9, 0x09, 0xFC, 0x92, 0xF5, 0x95,
+    0x77, 0x74, 0x9A, 0xEA, 0x3A, 0xE9, 0x39, 0xF2, 0x9F, 0xCA, 0x19, 0xFD, 0x2A, 0xFC, 0x92, 0x99,
+    0x9D, 0xA0, 0x9E, 0xAE, 0x1E, 0xAE, 0xA4, 0x9D, 0x99, 0xD9, 0x1E, 0x0D, 0xA1, 0x9D, 0xA4, 0x9D,
+    0x9D, 0x92, 0xDA, 0xAC, 0xA2, 0xAD, 0x94, 0xAD, 0xAC, 0x93, 0xFC, 0x3A, 0xD5, 0xFA, 0x39, 0xF4,
+    0xE5, 0xF4, 0xAE, 0x94, 0xDA, 0x49, 0xE9, 0x4F, 0x49, 0xD9, 0x4A, 0xE5, 0xE9, 0x4A, 0xD5, 0xE9,
+    0x49, 0xE5, 0xE5, 0xE5, 0xAD, 0x95, 0xDA, 0x49, 0xDA, 0x5E, 0x59, 0xD9, 0x1A, 0x1A, 0xD9, 0x5E,
+    0x5A, 0xD1, 0xD1, 0xAD, 0x59, 0xDA, 0x5E, 0xAD, 0xA1, 0xE5, 0xAD, 0x95, 0xFC, 0xA2, 0xDA, 0x5E,
+    0x6A, 0xE9, 0x77, 0x79, 0x50, 0x77, 0x39, 0xAE, 0xA3, 0xAE, 0xA2, 0x9F, 0xCA, 0x19, 0xFD, 0x92,
+    0x99, 0x9D, 0xA0, 0x9E, 0xAE, 0xA4, 0x9D, 0x99, 0xD9, 0x1A, 0xD9, 0x49, 0xD9, 0xD9, 0x2A, 0xD9,
+    0x4A, 0xDA, 0xC9, 0x3E, 0x5F, 0xA4, 0xE5, 0xF4, 0x9D, 0xA4, 0x9E, 0x94, 0xAD, 0x94, 0xAE, 0x5E,
+    0x5E, 0x95, 0xE5, 0xE5, 0x9D, 0xA4, 0x9D, 0xA5, 0xAD, 0x91, 0xA1, 0xAD, 0x95, 0xE0, 0x9D, 0x1A,
+    0xD6, 0xEA, 0xDA, 0x1E, 0x6F, 0xCA, 0x2D, 0xA6, 0xAE, 0x97, 0x69, 0x50, 0x77, 0x59, 0xFC, 0xA7,
+    0xFF, 0xC5, 0xEA, 0x90, 0x9F, 0x3E, 0x94, 0xE9, 0x1A, 0xDA, 0x5E, 0x90, 0x9E, 0x6A, 0xDA, 0x0A,
+    0xD9, 0x6A, 0xDA, 0x0E, 0x7A, 0xD9, 0x9E, 0x7E, 0x99, 0xDA, 0x7E, 0x0A, 0xDA, 0x69, 0xDA, 0x0A,
+    0xDA, 0x6E, 0x90, 0xAD, 0xA5, 0xAD, 0xA1, 0x9E, 0x49, 0xE3, 0xF2, 0xAE, 0x49, 0xFF, 0xC6, 0x9F,
+    0xD9, 0x72, 0x99, 0x70, 0x77, 0x79, 0xAE, 0x92, 0x9F, 0x49, 0xFC, 0xA1, 0xFE, 0x49, 0x99, 0xD9,
+    0x0E, 0xAF, 0x69, 0xD9, 0xAC, 0xA2, 0xE9, 0x59, 0xDA, 0xCA, 0x3A, 0xDA, 0x5A, 0xF4, 0xAD, 0xA5,
+    0xF5, 0xAD, 0x95, 0xEA, 0x5E, 0x94, 0x9E, 0x6E, 0x5A, 0xDA, 0x6E, 0x5A, 0xD6, 0xAD, 0x95, 0xE6,
+    0xE6, 0xDA, 0x5A, 0xD9, 0x59, 0xD9, 0x49, 0xE6, 0xAE, 0xA9, 0x1A, 0xE7, 0xFF, 0xE7, 0x0D, 0xAA,
+    0xFC, 0x97, 0x09, 0xD9, 0x19, 0x97, 0x3A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xDA, 0x76, 0x9F,
+    0xA9, 0x97, 0x2A, 0xFF, 0x97, 0x19, 0x99, 0x99, 0x99, 0x99, 0x72, 0x77, 0x69, 0xFA, 0x1A, 0xCA,
+    0x4F, 0xFA, 0xD4, 0xEA, 0x99, 0xAF, 0xC3, 0xE9, 0x39, 0xEA, 0x29, 0xDA, 0x5A, 0xD3, 0xE6, 0xE2,
+    0x9D, 0x96, 0xDA, 0x2E, 0x69, 0xD9, 0x2E, 0x6E, 0x29, 0xDA, 0x59, 0xE2, 0x9D, 0xA5, 0xEA, 0x2A,
+    0xD9, 0x4A, 0xE9, 0x2A, 0xDA, 0x39, 0xF9, 0x2A, 0xE2, 0x9D, 0x9D, 0x39, 0xEA, 0x9E, 0x0A, 0xD4,
+    0xFE, 0x1D, 0xA4, 0x9F, 0xA2, 0xDA, 0x69, 0x93, 0x9D, 0x97, 0x4A, 0xD7, 0x5A, 0xD7, 0x5E, 0x75,
+    0xE7, 0x3A, 0xFA, 0x97, 0xAF, 0xF7, 0x99, 0x99, 0x99, 0x99, 0x92, 0x76, 0x9A, 0xEA, 0x2E, 0x99,
+    0xFD, 0x1F, 0xA0, 0x99, 0x9D, 0xA0, 0xFC, 0x93, 0xD9, 0x9D, 0x99, 0xA3, 0x9D, 0x9D, 0x79, 0xDA,
+    0xC9, 0x7A, 0xEA, 0x70, 0xF7, 0x1E, 0xA7, 0x09, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x2E, 0x71, 0x9D,
+    0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x77, 0x2A, 0xFC, 0x49, 0xFE, 0xA2, 0x9D, 0xA9, 0x99,
+    0xDA, 0x2E, 0x49, 0x3E, 0x71, 0xE9, 0x70, 0xAE, 0xA7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0A, 0xF7, 0x09,
+    0xE9, 0x70, 0xAD, 0xA1, 0xC9, 0x49, 0xDA, 0x0A, 0xD4, 0x9D, 0x1A, 0xEA, 0x90, 0x9D, 0xA1, 0x9F,
+    0xFA, 0x39, 0xFD, 0x97, 0x09, 0x60, 0x69, 0x70, 0x9D, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD5, 0x9A,
+    0xAF, 0xFA, 0xFF, 0xDA, 0x99, 0x9A, 0xDA, 0x99, 0x99, 0x3A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7,
+    0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x3C, 0xA1, 0xAD, 0x91, 0x9D, 0xA1,
+    0xAE, 0xAF, 0x2A, 0xFE, 0x4F, 0xC9, 0x79, 0x60, 0x77, 0x39, 0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E,
+    0x29, 0x99, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D,
+    0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9E, 0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94,
+    0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA1, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA,
+    0xDA, 0x2F, 0xE2, 0xFC, 0x3A, 0xFA, 0x3E, 0xA6, 0x97, 0x94, 0x77, 0x19, 0xAE, 0x5E, 0xA0, 0x9F,
+    0xC9, 0x4A, 0xE1, 0x99, 0xAD, 0xA5, 0xE3, 0x9E, 0x5E, 0x4E, 0x5E, 0x4A, 0xD9, 0x4D, 0xA4, 0xAD,
+    0x93, 0xAD, 0x59, 0xDA, 0x3D, 0xA6, 0xDA, 0x29, 0xD7, 0xE2, 0xDA, 0x7E, 0x1A, 0xD7, 0x0A, 0xD0,
+    0x9D, 0x97, 0x0A, 0xD0, 0xDA, 0x71, 0xAF, 0xC7, 0x29, 0xF7, 0x39, 0xE7, 0x49, 0xCA, 0x77, 0x71,
+    0x77, 0x59, 0x29, 0xAE, 0x49, 0xE4, 0x9E, 0x09, 0xFC, 0x94, 0xE9, 0x4E, 0xA0, 0x99, 0xAD, 0xA4,
+    0xEA, 0x4E, 0xA3, 0xE4, 0xAE, 0x4A, 0xDA, 0x3E, 0x49, 0xE4, 0xAD, 0x93, 0xAD, 0x93, 0xAE, 0x4A,
+    0xD4, 0x9D, 0xA3, 0xF9, 0x3E, 0x5E, 0x3F, 0x93, 0xD9, 0x5E, 0x2A, 0xFA, 0x2A, 0xD6, 0xAD, 0x2D,
+    0x9D, 0xA2, 0xD9, 0x6A, 0xD1, 0xAD, 0x0A, 0xD1, 0xAD, 0x79, 0xD1, 0xD1, 0xAD, 0x1D, 0x97, 0x9D,
+    0x0A, 0xCA, 0x19, 0xD0, 0xDA, 0x70, 0x9D, 0xAD, 0x29, 0xDA, 0xD7, 0x19, 0xF3, 0x9F, 0x72, 0x9E,
+    0x49, 0xE7, 0x4D, 0x6D, 0x77, 0x77, 0x00, 0x77, 0x79, 0xE9, 0x59, 0xE9, 0x2F, 0xD4, 0xAF, 0x92,
+    0xDA, 0xEA, 0x2A, 0xEA, 0xC6, 0x9E, 0x19, 0xD9, 0x72, 0xE9, 0x0D, 0xA7, 0x39, 0xDA, 0xAD, 0x75,
+    0xFC, 0x76, 0xAE, 0x97, 0x69, 0xE7, 0x7F, 0x97, 0x5A, 0xFA, 0x74, 0x9D, 0x0E, 0x74, 0xD9, 0x0A,
+    0xD9, 0x72, 0xDA, 0x19, 0xE6, 0xCA, 0xAE, 0x3E, 0xAA, 0xD9, 0x1F, 0xC4, 0xAF, 0xD2, 0xF6, 0xEA,
+    0x94, 0x97, 0x70, 0x77, 0x79, 0xAE, 0x59, 0xE4, 0xFD, 0x5E, 0xA3, 0x99, 0xAE, 0x5A, 0xDA, 0x6E,
+    0x94, 0x9D, 0xA6, 0x9E, 0x49, 0xD9, 0x7E, 0x49, 0xD7, 0x0E, 0x4A, 0xD7, 0x09, 0xD9, 0x3D, 0x97,
+    0x09, 0xDA, 0x29, 0xD7, 0x2D, 0xA2, 0xDA, 0x72, 0xDA, 0x19, 0xD7, 0x3E, 0x1D, 0xA7, 0x3E, 0x09,
+    0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x4A, 0xCA, 0xAC, 0xA7, 0x5F, 0xC7, 0x6F, 0x77, 0xE9, 0x76, 0x9D,
+    0xA7, 0x7D, 0xA7, 0x69, 0xDA, 0x71, 0x9C, 0x90, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xCA, 0x76,
+    0xAA, 0xA7, 0x70, 0x77, 0x2A, 0xEA, 0x92, 0x9D, 0x2A, 0xFE, 0x90, 0xE2, 0xFF, 0xFA, 0x2D, 0x39,
+    0xFA, 0x3C, 0xA5, 0xE4, 0x95, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3A, 0xD9, 0x72, 0xAD,
+    0x97, 0x2A, 0xD9, 0x59, 0x92, 0xAE, 0x95, 0xD1, 0x9F, 0xFC, 0xAE, 0x1E, 0x9F, 0xFD, 0x1A, 0xCA,
+    0x19, 0xAF, 0xD7, 0x39, 0x94, 0x77, 0x49, 0xF6, 0x9F, 0x96, 0xDA, 0x70, 0xAD, 0x71, 0xDA, 0x70,
+    0x9D, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x9D, 0xA7, 0xEA, 0x70, 0xE9, 0x71, 0xE7, 0x19, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09,
+    0xD9, 0x70, 0xE7, 0x1D, 0xA7, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0x71, 0xAE,
+    0xAA, 0x7F, 0xA7, 0x09, 0x99, 0x60, 0x77, 0xAD, 0x6D, 0xA6, 0xD9, 0x6D, 0x95, 0x9D, 0x6A, 0xD6,
+    0xDA, 0x6D, 0x95, 0x9D, 0x69, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6A, 0xD6, 0xDA,
+    0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x6D,
+    0x95, 0x9D, 0x60, 0x77, 0x2A, 0xEA, 0x7F, 0xCA, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1E, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1E, 0x71, 0xAE,
+    0x71, 0xE9, 0x7E, 0xA7, 0xE7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x09, 0xDA, 0x59, 0xAF, 0x6F, 0xA7, 0x99,
+    0x97, 0x10, 0x29, 0xAC, 0xA6, 0xA2, 0xFD, 0xA3, 0xAC, 0xA0, 0xAF, 0xF9, 0x0A, 0xDA, 0x0D, 0xA1,
+    0x9F, 0xF1, 0xD4, 0x9F, 0xC7, 0x39, 0x99, 0x20, 0x69, 0x69, 0xE5, 0xF5, 0xEA, 0x59, 0xC9, 0x77,
+    0x73, 0xA9, 0x69, 0xC9, 0x6A, 0xC9, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xD6, 0xDA, 0x6D, 0xA5, 0x9D,
+    0x95, 0xAD, 0x6E, 0x6E, 0x5A, 0xDA, 0x5E, 0x95, 0xE5, 0xAE, 0x5E, 0x6A, 0x96, 0x77, 0x73, 0xD9,
+    0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x4A, 0xFC, 0x97, 0xAF, 0xFC, 0x49,
+    0xFF, 0xE3, 0x9E, 0x90, 0xD1, 0x9C, 0xA3, 0xE2, 0xD7, 0xE2, 0x9C, 0xA6, 0x9D, 0xA2, 0xAC, 0x96,
+    0xAD, 0x3A, 0xC7, 0xE3, 0xD7, 0xE3, 0xCA, 0x7E, 0x29, 0xCA, 0x7E, 0x2A, 0xC9, 0x7E, 0x2D, 0x70,
+    0xEA, 0x1D, 0x3D, 0x29, 0xEA, 0x9C, 0xA1, 0x9D, 0xA3, 0xFF, 0xEA, 0x5F, 0xFC, 0x97, 0x9F, 0xA9,
+    0x72, 0x9C, 0xA7, 0x5A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x59, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x77,
+    0x72, 0x74, 0x9A, 0xEA, 0x75, 0xFF, 0x73, 0xEA, 0xAA, 0xEA, 0x71, 0xE3, 0x9E, 0x70, 0x9D, 0x94,
+    0xE7, 0x0E, 0x5D, 0x97, 0x9D, 0x95, 0x97, 0x1E, 0x77, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x0E, 0x97,
+    0x5F, 0xFF, 0xA6, 0x9F, 0xFF, 0x97, 0x1A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0x9D, 0xA7,
+    0x70, 0xAD, 0x97, 0x70, 0xE7, 0x70, 0x9D, 0x97, 0x09, 0x3F, 0xDA, 0xAA, 0xAA, 0xAA, 0xF9, 0x2F,
+    0xFF, 0xFC, 0x3F, 0x19, 0xAA, 0xFE, 0x93, 0xAA, 0x97, 0x70, 0x39, 0x74, 0x94, 0xD9, 0x39, 0x99,
+    0x3A, 0xD3, 0xAD, 0x1A, 0xFC, 0xA0, 0xE5, 0xAF, 0xFF, 0xA7, 0xAD, 0xA3, 0xE9, 0x70, 0xDA, 0x5D,
+    0xA7, 0xAD, 0x6D, 0xA7, 0xDA, 0x6D, 0xA7, 0xD9, 0x59, 0xD9, 0x7D, 0x95, 0xAD, 0x70, 0xDA, 0x4A,
+    0xD9, 0x79, 0xEA, 0x19, 0xAE, 0x7F, 0xFF, 0xD4, 0x9D, 0xA1, 0xAF, 0xA1, 0xAD, 0x4C, 0x97, 0x3C,
+    0xA7, 0x77, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x29, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xF9, 0x2F,
+    0xF1, 0xAF, 0xCA, 0x49, 0xAF, 0xA4, 0xE7, 0x0E, 0x6E, 0xA6, 0xAD, 0x96, 0x9E, 0x59, 0xDA, 0x70,
+    0xE5, 0xE7, 0x1A, 0xDA, 0x3E, 0x73, 0xE2, 0xAD, 0x97, 0x3E, 0x90, 0x9D, 0xA7, 0x1F, 0xDA, 0x0F,
+    0xE6, 0xFE, 0xAF, 0xD9, 0x72, 0xAF, 0x97, 0x79, 0xEA, 0x74, 0xFF, 0xFC, 0xA7, 0xFF, 0xFC, 0x74,
+    0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x72, 0xE7, 0x71, 0xAE, 0x76, 0x9A, 0xFE, 0xA7, 0x3F,
+    0xFC, 0xA7, 0x10, 0x77, 0xAD, 0x6D, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x59,
+    0xD6, 0x9D, 0x6A, 0xD6, 0x99, 0x77, 0x77, 0x77, 0x70, 0xAA, 0x69, 0xD6, 0xAD, 0x6D, 0xA6, 0xDA,
+    0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x6D, 0x96, 0xD9, 0x59, 0xD6, 0x79, 0x9A, 0x97, 0x09, 0xFD,
+    0xA5, 0xEA, 0xAF, 0x93, 0xD9, 0x3A, 0xDA, 0x2E, 0x5D, 0x91, 0xAE, 0x5D, 0x2D, 0xAC, 0xA7, 0x09,
+    0xCA, 0x0D, 0x97, 0xAC, 0x90, 0x9D, 0xA6, 0xAC, 0x91, 0x9D, 0xA5, 0xAC, 0x92, 0x9E, 0x49, 0xD4,
+    0xE4, 0xE4, 0xE3, 0x9E, 0x4D, 0xA3, 0x9E, 0x92, 0x9D, 0x49, 0xE9, 0x2D, 0x6E, 0x91, 0xD7, 0xAD,
+    0x1D, 0x70, 0xE0, 0xD7, 0x1D, 0xAC, 0xA1, 0xD5, 0xAE, 0x1E, 0x5E, 0xA1, 0xE9, 0x39, 0xE2, 0xAE,
+    0xA9, 0x9A, 0xE4, 0xFF, 0xA6, 0x9A, 0xAC, 0xA9, 0x60, 0x19, 0x94, 0x99, 0x1A, 0xE2, 0xE9, 0x0F,
+    0x1A, 0xE9, 0x0E, 0x91, 0x9E, 0x29, 0x49, 0x91, 0x77, 0x77, 0x09, 0xFE, 0xA9, 0x74, 0xAF, 0xAA,
+    0xAA, 0xF9, 0x71, 0xEA, 0x7A, 0xDA, 0x7E, 0x73, 0xDA, 0x5D, 0xA7, 0x5D, 0xA3, 0x9D, 0x49, 0xFC,
+    0x93, 0xD3, 0xD9, 0x3F, 0xEA, 0x3A, 0xCA, 0x19, 0xD3, 0xDA, 0x3C, 0xA4, 0xD1, 0xAC, 0x92, 0x9D,
+    0x4C, 0xA4, 0xAC, 0x90, 0xD3, 0xAC, 0xA4, 0x95, 0x9C, 0xA0, 0xD3, 0xD9, 0x73, 0x9C, 0xA0, 0xD3,
+    0xD9, 0x73, 0x9D, 0x0D, 0x3D, 0x97, 0x39, 0xCA, 0x0D, 0x3D, 0xA7, 0x39, 0xCA, 0x0A, 0xC9, 0x2A,
+    0xD7, 0x3A, 0xC9, 0x09, 0xCA, 0x29, 0xE9, 0x39, 0x4D, 0x2D, 0x3A, 0xFF, 0x39, 0xD2, 0xAC, 0xA3,
+    0x9F, 0xD9, 0x3D, 0x93, 0xD9, 0x75, 0xAD, 0x5D, 0x97, 0x3A, 0xD6, 0x9D, 0xA7, 0x09, 0xE7, 0x1F,
+    0xA9, 0x99, 0x9A, 0xEA, 0x73, 0x9F, 0xFC, 0xA7, 0x70, 0x99, 0xAA, 0x99, 0x70, 0x77, 0x1F, 0x9D,
+    0x39, 0xFE, 0x93, 0xD9, 0x19, 0xD3, 0xAC, 0xA2, 0xAC, 0xA3, 0xD3, 0xD9, 0x29, 0xD3, 0xD3, 0xAC,
+    0xA2, 0xAD, 0x3A, 0xCA, 0x19, 0xDA, 0x09, 0x1A, 0xD9, 0xAC, 0xAC, 0xA9, 0xC1, 0x9F, 0xA0, 0xEA,
+    0x2A, 0xD9, 0x1D, 0xA7, 0x77, 0x09, 0x2F, 0xFD, 0x1A, 0xFF, 0xC9, 0x10, 0x69, 0x49, 0x95, 0x9D,
+    0x92, 0xAD, 0x4A, 0xDA, 0x2E, 0x4E, 0xA1, 0x9E, 0x4E, 0xA1, 0x9E, 0x4E, 0xA1, 0xAE, 0x4A, 0xE2,
+    0xE9, 0x4A, 0xE2, 0xEA, 0x5E, 0x91, 0x9E, 0x6E, 0x29, 0xDA, 0x6D, 0xA2, 0x9D, 0x96, 0xD9, 0x29,
+    0xD7, 0x94, 0x99, 0x20, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD,
+    0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x77, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA,
+    0x00, 0x69, 0x99, 0x99, 0x73, 0xAF, 0xEA, 0x70, 0xDA, 0x93, 0xAD, 0x95, 0xD9, 0x7D, 0x4A, 0xC1,
+    0x9A, 0xAA, 0xA3, 0xD2, 0x9C, 0xA1, 0xAD, 0xAD, 0x91, 0x9C, 0x91, 0xAC, 0x3C, 0xA0, 0x9C, 0xA2,
+    0xD1, 0xD3, 0xCA, 0x09, 0xCA, 0x2A, 0xC1, 0xD3, 0xDA, 0xD3, 0xAC, 0x1C, 0xA3, 0xF4, 0xAC, 0x1D,
+    0x3C, 0xA0, 0xD3, 0xAC, 0x1A, 0xC3, 0xCA, 0x09, 0xD2, 0xD1, 0x9C, 0x91, 0xEA, 0x09, 0xD0, 0x9C,
+    0xA2, 0xD1, 0x99, 0x99, 0x19, 0x90, 0xD4, 0xD7, 0x0A, 0xC9, 0x49, 0xD9, 0x49, 0xD9, 0x7A, 0xFF,
+    0x97, 0x29, 0xAA, 0xAA, 0x60, 0x09, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0x0A, 0xFF, 0xC7, 0x30,
+    0x29, 0xAD, 0xA9, 0x4F, 0xEA, 0x2E, 0x90, 0x9E, 0x90, 0x9D, 0x4E, 0x0A, 0xD4, 0x9D, 0x0A, 0xD4,
+    0x9D, 0x0A, 0xD4, 0xAD, 0x09, 0xDA, 0x3D, 0xA1, 0xFA, 0xAE, 0x3A, 0xFD, 0x69, 0xA9, 0x40, 0x77,
+    0x4D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA6, 0x99, 0x99, 0x9D, 0xA9, 0x99, 0x99,
+    0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x6D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7,
+    0x3D, 0x97, 0x77, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF,
+    0xC0, 0x77, 0x1A, 0xF9, 0x49, 0xFE, 0x93, 0xE9, 0x09, 0xE2, 0xAC, 0xA3, 0xAD, 0x29, 0xC4, 0xE7,
+    0x09, 0xD9, 0x70, 0xDA, 0x79, 0xE7, 0x9D, 0xA7, 0xAD, 0xA7, 0xE9, 0x7E, 0x79, 0xEA, 0xAA, 0xAA,
+    0xAA, 0x1F, 0xFD, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0x77, 0x0A, 0xF4, 0x9F, 0xE3, 0xDA, 0x1A,
+    0xD3, 0xC9, 0x29, 0xD7, 0x0A, 0xD7, 0xAD, 0x59, 0xAE, 0x59, 0xFC, 0xA5, 0xA9, 0x9E, 0x70, 0x9D,
+    0x97, 0x9D, 0x97, 0xE6, 0xAE, 0x91, 0x9F, 0xE9, 0x29, 0xFA, 0x97, 0x70, 0x3A, 0x93, 0xAD, 0x29,
+    0xE2, 0xE9, 0x1E, 0x91, 0xAD, 0x3D, 0x73, 0x77, 0x71, 0x9D, 0x95, 0x9D, 0x96, 0xAD, 0x6E, 0x7E,
+    0x6E, 0x7D, 0xA5, 0x9D, 0xA6, 0x9D, 0xA5, 0xAD, 0x96, 0x9D, 0x95, 0xAD, 0x7A, 0xD6, 0xE7, 0xE6,
+    0xDA, 0x7D, 0xA5, 0x9D, 0xA7, 0xDA, 0x5A, 0xD9, 0x69, 0xD9, 0x5E, 0x7A, 0xD9, 0x49, 0xE7, 0xEA,
+    0x4F, 0x7F, 0x3A, 0xCA, 0xD2, 0x93, 0xFC, 0x99, 0xE0, 0xEA, 0xD9, 0x19, 0xFF, 0xC1, 0xFC, 0xA2,
+    0xAC, 0xA9, 0xFA, 0x29, 0xE9, 0x3D, 0xA1, 0x99, 0x69, 0x5D, 0xA7, 0x71, 0xDA, 0x77, 0x09, 0xD9,
+    0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1E, 0x77, 0x1C, 0xA9, 0x77, 0x00, 0x71, 0x9A, 0xFF, 0x97,
+    0xAF, 0xFE, 0x69, 0xFE, 0x9D, 0xA9, 0x69, 0xFE, 0x90, 0xD7, 0x0F, 0xF1, 0xD7, 0xAF, 0xF0, 0x9C,
+    0xA7, 0xFF, 0xC0, 0xAC, 0x96, 0x9F, 0xFA, 0x0D, 0x96, 0xAF, 0xF9, 0x0D, 0x7A, 0xFF, 0x1D, 0x7A,
+    0xFF, 0x09, 0xCA, 0x79, 0xFF, 0x0A, 0xC9, 0x70, 0xFE, 0xA0, 0xD9, 0x71, 0xFD, 0x90, 0xD7, 0x3A,
+    0xC9, 0xD1, 0xD7, 0x6D, 0x09, 0xCA, 0x76, 0xD0, 0xAC, 0x97, 0x59, 0xCA, 0x0D, 0x97, 0x5A, 0xC9,
+    0x0D, 0x76, 0xD1, 0xD7, 0x6D, 0x09, 0xCA, 0x75, 0x9C, 0xA0, 0xD9, 0x75, 0xAC, 0x99, 0xD7, 0x6D,
+    0x0D, 0x97, 0x09, 0x3F, 0xC9, 0x70, 0xAC, 0xA9, 0x9F, 0xA7, 0x2A, 0xFC, 0xA7, 0x69, 0xAA, 0x97,
+    0x70, 0x29, 0x29, 0xE1, 0xF1, 0xF1, 0xE7, 0x39, 0x94, 0xF2, 0x9A, 0xE9, 0x39, 0xD4, 0xE3, 0xE2,
+    0xAE, 0x39, 0xA9, 0x30, 0x76, 0x9A, 0xD3, 0xAF, 0xC3, 0xFC, 0x95, 0x9D, 0x95, 0xAD, 0x6E, 0x6D,
+    0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0xA3, 0xAF, 0xD9, 0x1A, 0xAA, 0xAA, 0xAA,
+    0x10, 0x77, 0x19, 0xFA, 0x59, 0xFD, 0xA3, 0x9D, 0x91, 0xAD, 0x3D, 0xA2, 0x9D, 0x29, 0xD3, 0x9D,
+    0x2A, 0xD3, 0xAD, 0x2A, 0xD3, 0xE2, 0xAD, 0x29, 0xD9, 0x2A, 0xD1, 0x9D, 0xA4, 0xFE, 0x59, 0xF9,
+    0x77, 0x72, 0x92, 0xAF, 0xFC, 0x2F, 0xFC, 0x91, 0x29, 0x59, 0x7D, 0x92, 0x9D, 0x69, 0xD9, 0x2A,
+    0xD6, 0xAD, 0x92, 0xE6, 0xE9, 0x1A, 0xE5, 0xAE, 0x2E, 0xA4, 0x9E, 0x2E, 0xA4, 0xEA, 0x1A, 0xE4,
+    0xE9, 0x1A, 0xE4, 0xE9, 0x19, 0xE4, 0xE2, 0x9D, 0xA4, 0xDA, 0x29, 0xD9, 0x59, 0x94, 0x96, 0x77,
+    0x79, 0xA7, 0x39, 0xCA, 0x76, 0xDA, 0x79, 0xAF, 0x75, 0xE7, 0x9F, 0xCA, 0x74, 0x9D, 0x97, 0x29,
+    0xD9, 0x74, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0x4A, 0xD7, 0x3A, 0xD7, 0x5D, 0xA7, 0x29, 0xD9, 0x75,
+    0xD9, 0x72, 0xDA, 0x75, 0x9D, 0x97, 0x1A, 0xD7, 0xAC, 0x4A, 0xD7, 0x19, 0xD7, 0xE9, 0x3E, 0x71,
+    0xD9, 0x6F, 0x4D, 0xA7, 0x0D, 0xA6, 0xFC, 0x4D, 0x97, 0xAD, 0x6D, 0x9A, 0xCA, 0x19, 0xFD, 0x94,
+    0x9D, 0x6D, 0xA0, 0xD9, 0x1F, 0xE9, 0x4D, 0x95, 0xDA, 0x1D, 0x97, 0x5D, 0xA5, 0xDA, 0x19, 0xD7,
+    0x5A, 0xD5, 0xDA, 0x2A, 0xD7, 0x49, 0xD9, 0x4E, 0x99, 0x99, 0xE9, 0x97, 0x2D, 0xA4, 0x9F, 0xFF,
+    0x71, 0xE6, 0x9A, 0xAA, 0xAA, 0xAD, 0xAA, 0x97, 0x0A, 0xD7, 0x59, 0xD7, 0x29, 0xD9, 0x75, 0xAD,
+    0x72, 0xE7, 0x6D, 0xA7, 0x2D, 0x77, 0x76, 0x97, 0x75, 0x77, 0x6A, 0x97, 0x49, 0xCA, 0x74, 0x9D,
+    0x97, 0x09, 0xAF, 0x74, 0xE7, 0x09, 0xFC, 0xA7, 0x3E, 0x74, 0x9D, 0x97, 0x29, 0xD9, 0x74, 0xAD,
+    0x73, 0xDA, 0x75, 0xAD, 0x72, 0xE7, 0x6D, 0xA7, 0x1A, 0xD7, 0x7D, 0x97, 0x09, 0xD9, 0x76, 0x9D,
+    0x97, 0x0D, 0xA4, 0x9A, 0xCA, 0xA5, 0xAD, 0x70, 0xAD, 0x39, 0xFE, 0x4E, 0x79, 0xD3, 0x9E, 0xA9,
+    0xEA, 0x3D, 0xA7, 0xD9, 0x3D, 0xA3, 0xE3, 0xD9, 0x6D, 0xA4, 0xAC, 0x4D, 0xA0, 0x9F, 0xD9, 0x3A,
+    0xD7, 0x39, 0xD9, 0x0F, 0xE9, 0x29, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x3E, 0x74, 0xDA, 0x72, 0x9D,
+    0xA7, 0x4A, 0xD7, 0x2A, 0xDA, 0x74, 0x9D, 0x97, 0x1A, 0xD9, 0x75, 0xDA, 0x71, 0xE7, 0x6E, 0x70,
+    0x9E, 0x99, 0x99, 0x99, 0x70, 0xAD, 0x71, 0xFF, 0xDA, 0x69, 0xD9, 0x71, 0xAF, 0xFC, 0x79, 0xD7,
+    0x77, 0x77, 0x76, 0x77, 0x70, 0xA7, 0x39, 0xAD, 0x97, 0x5A, 0xD7, 0x1F, 0xDA, 0x73, 0x9D, 0xA7,
+    0x0E, 0x99, 0xE7, 0x3E, 0x71, 0xCA, 0x29, 0xD7, 0x2A, 0xD7, 0x79, 0xD7, 0x19, 0xD9, 0x76, 0x9D,
+    0x97, 0x1D, 0xA7, 0x59, 0xAD, 0x97, 0x1E, 0x74, 0x9F, 0xC9, 0x70, 0xAD, 0x76, 0xCA, 0xAE, 0x70,
+    0xD9, 0x7A, 0xC7, 0x9D, 0x96, 0xDA, 0x7E, 0x96, 0x9D, 0x95, 0xAD, 0x7F, 0x7E, 0x59, 0xD7, 0xFC,
+    0x59, 0xE9, 0x5D, 0x96, 0xD9, 0xAC, 0xA0, 0x9A, 0xAF, 0xCA, 0x5D, 0xA6, 0xDA, 0x0D, 0x90, 0x9F,
+    0xCA, 0x6A, 0xD6, 0xDA, 0x1D, 0x91, 0x99, 0x97, 0x09, 0xD6, 0xDA, 0x19, 0xD7, 0x6D, 0xA5, 0xDA,
+    0x2A, 0xD7, 0x5E, 0x5E, 0x99, 0x99, 0xE9, 0x97, 0x2A, 0xD5, 0x9F, 0xFF, 0x71, 0x9D, 0x96, 0x9A,
+    0xAA, 0xAA, 0xAD, 0xAA, 0x97, 0x1D, 0xA7, 0x59, 0xD7, 0x3E, 0x76, 0xAD, 0x72, 0xAD, 0x97, 0x6D,
+    0xA7, 0x2A, 0xCA, 0x77, 0x76, 0x97, 0x76, 0x70, 0x97, 0x9E, 0x6F, 0x6E, 0x96, 0xAA, 0x97, 0x77,
+    0x4A, 0xD6, 0xFC, 0x5A, 0xAE, 0x7A, 0xD6, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0xAD, 0xA5, 0x9D,
+    0xA5, 0x9D, 0xA6, 0xE7, 0xD9, 0x69, 0xD9, 0x69, 0xDA, 0x49, 0x1F, 0xAA, 0xE1, 0x9F, 0xEA, 0x29,
+    0xFD, 0x59, 0xAA, 0x92, 0x77, 0x77, 0x5C, 0xA7, 0x75, 0xAD, 0xA7, 0x74, 0xAF, 0x77, 0x4A, 0xF7,
+    0x75, 0xAE, 0x77, 0x69, 0x97, 0x77, 0x77, 0x79, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77,
+    0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91,
+    0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74,
+    0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA,
+    0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x77, 0x39,
+    0x77, 0x6A, 0xC9, 0x77, 0x39, 0xEA, 0x77, 0x2F, 0xC9, 0x77, 0x0A, 0xFC, 0x97, 0x70, 0x9E, 0xA9,
+    0x77, 0x39, 0x77, 0x77, 0x77, 0x39, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9,
+    0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D,
+    0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E,
+    0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9,
+    0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x77, 0x77, 0x70, 0xE7,
+    0x74, 0xFC, 0x77, 0x2F, 0xE7, 0x79, 0xE1, 0xAD, 0xA7, 0x59, 0xE3, 0xAD, 0x75, 0xAC, 0xA5, 0xA9,
+    0x77, 0x77, 0x74, 0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD,
+    0x9D, 0xA7, 0x71, 0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9,
+    0x75, 0x9D, 0x3A, 0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9,
+    0x79, 0xE7, 0x0E, 0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A,
+    0xFD, 0x95, 0x9A, 0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC0, 0x74, 0x9D, 0xA2, 0xA9, 0x76, 0xAF, 0xA0,
+    0x9D, 0x76, 0xFF, 0xCA, 0x75, 0x9D, 0x1F, 0xC7, 0x7C, 0x91, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71,
+    0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A,
+    0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E,
+    0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A,
+    0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC0, 0x77, 0x77, 0x4E, 0x3E, 0x75, 0xAE, 0x91, 0xF7, 0x5F, 0x2F,
+    0x75, 0x9D, 0x92, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x69, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9,
+    0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D,
+    0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E,
+    0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72,
+    0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x77,
+    0x99, 0x77, 0x4A, 0xF9, 0x77, 0x19, 0xDA, 0xAD, 0x97, 0x70, 0xD2, 0xAC, 0xA7, 0x70, 0xD2, 0x9C,
+    0xA7, 0x70, 0xD2, 0xAC, 0x97, 0x70, 0xE9, 0xAD, 0x77, 0x2F, 0xC7, 0x74, 0x99, 0x97, 0x77, 0x97,
+    0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71, 0xD9,
+    0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A, 0xDA,
+    0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E, 0x71,
+    0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A, 0xFE,
+    0x0A, 0xFE, 0xA5, 0xFF, 0xC0, 0x76, 0xAF, 0xFF, 0xF7, 0x7A, 0xFF, 0xFF, 0x77, 0x1A, 0xFC, 0xAA,
+    0xAA, 0xAA, 0xE7, 0x71, 0xFC, 0x95, 0xAC, 0xA7, 0x70, 0xDA, 0xE6, 0xAC, 0x97, 0x7E, 0x0E, 0x6A,
+    0xC7, 0x7A, 0xD0, 0x9D, 0xA7, 0x77, 0x9D, 0x90, 0xAD, 0xA7, 0x77, 0xDA, 0x1E, 0x97, 0x76, 0xE2,
+    0xE7, 0x76, 0xAD, 0x3E, 0xAF, 0xD7, 0x69, 0xD9, 0x29, 0xFF, 0xD7, 0x59, 0xD9, 0x3A, 0xDA, 0xAA,
+    0xAA, 0xAA, 0x76, 0xEA, 0xAA, 0xAA, 0xE9, 0x77, 0x3F, 0xFF, 0x77, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA,
+    0xE7, 0x72, 0x9D, 0x95, 0xAD, 0xA7, 0x97, 0x1D, 0xA6, 0xAD, 0x96, 0x9C, 0x97, 0xE7, 0xE7, 0xD9,
+    0x6A, 0xD7, 0x0E, 0x6A, 0xD6, 0xAD, 0xA7, 0xAE, 0x99, 0x99, 0x9A, 0xAE, 0x49, 0xFD, 0x93, 0xAF,
+    0xFF, 0xD9, 0x4F, 0xE9, 0x2A, 0xFF, 0xFE, 0x40, 0x77, 0x73, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xEA,
+    0x49, 0xFA, 0xA9, 0x9A, 0xFA, 0x39, 0xEA, 0x69, 0xD9, 0x29, 0xE9, 0x79, 0xD3, 0xE9, 0x70, 0x9D,
+    0x2A, 0xDA, 0x71, 0x9C, 0x92, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x79, 0xE7,
+    0x7A, 0xE7, 0x7A, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xEA, 0x77, 0xF9, 0x71, 0xCA, 0x29, 0xFA,
+    0x6A, 0xD9, 0x3A, 0xFC, 0xAA, 0xAA, 0xFA, 0x5A, 0xFF, 0xE9, 0x79, 0xAF, 0xE9, 0x75, 0x99, 0x77,
+    0x19, 0x97, 0x70, 0xF7, 0x7A, 0xEA, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x7A, 0xD9, 0x75, 0x9E, 0x97,
+    0x7A, 0x97, 0x30, 0x77, 0x77, 0xCA, 0x77, 0x19, 0xE7, 0x70, 0x9F, 0x77, 0x0A, 0xF9, 0x77, 0x0A,
+    0xE7, 0x72, 0x99, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70,
+    0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA,
+    0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E,
+    0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF,
+    0xEA, 0x30, 0x77, 0x77, 0x5A, 0xC9, 0x77, 0x9E, 0xA7, 0x6A, 0xF9, 0x74, 0x9F, 0xC9, 0x75, 0xEA,
+    0x97, 0x79, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9,
+    0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA,
+    0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96,
+    0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA,
+    0x30, 0x77, 0x77, 0x2E, 0x77, 0x0F, 0xC7, 0x6F, 0xE7, 0x4E, 0x90, 0xAD, 0xA7, 0x19, 0xE3, 0xAD,
+    0x71, 0xAC, 0xA5, 0xAA, 0x77, 0x77, 0x77, 0xFF, 0xFE, 0xA4, 0xFF, 0xFE, 0xA5, 0x9A, 0xEA, 0xAA,
+    0xAA, 0xAE, 0x96, 0xAD, 0x96, 0xD9, 0x6E, 0x7D, 0x7E, 0x7C, 0xA6, 0x9E, 0x77, 0x0A, 0xDA, 0x77,
+    0x0E, 0x97, 0x70, 0xE7, 0x71, 0xEA, 0xAA, 0xAE, 0xA7, 0x09, 0xFF, 0xD9, 0x70, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x1E, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xDA, 0x70, 0x96, 0xAD, 0xA7, 0xD6,
+    0xE9, 0x69, 0xD6, 0xE7, 0xDA, 0x59, 0xE9, 0x99, 0xAA, 0xAA, 0xE9, 0x3A, 0xFF, 0xFE, 0x3A, 0xFF,
+    0xFE, 0xA3, 0x77, 0x76, 0xAD, 0x92, 0xE7, 0x19, 0xEA, 0x1A, 0xE9, 0x70, 0xAE, 0x91, 0xF7, 0x19,
+    0xD9, 0x29, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7,
+    0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D,
+    0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF,
+    0xFF, 0xEA, 0x30, 0x77, 0x5C, 0xA7, 0x3A, 0xDA, 0x72, 0xAF, 0x72, 0xFC, 0x72, 0x9A, 0xDA, 0x74,
+    0x97, 0x77, 0x75, 0xFF, 0xC5, 0xFF, 0x96, 0x9A, 0xE9, 0x71, 0xAD, 0x97, 0x2E, 0x97, 0x2E, 0x72,
+    0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72,
+    0xE7, 0x29, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x70, 0xAF, 0xE9,
+    0x4A, 0xFF, 0x94, 0x75, 0x97, 0x5A, 0xC7, 0x39, 0xE9, 0x71, 0xFC, 0x70, 0xAF, 0xC9, 0x79, 0xEA,
+    0x73, 0x97, 0x77, 0x77, 0x3F, 0xFC, 0x6F, 0xF9, 0x79, 0xAE, 0x97, 0x2A, 0xD9, 0x73, 0xE9, 0x73,
+    0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E,
+    0x97, 0x3E, 0x73, 0x9E, 0x73, 0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x1A,
+    0xFE, 0x95, 0xAF, 0xF9, 0x50, 0x77, 0x70, 0x9E, 0x72, 0x9F, 0xC7, 0x09, 0xFD, 0xA6, 0x9E, 0x1E,
+    0x94, 0x9E, 0x3E, 0x4A, 0xC9, 0x5C, 0x97, 0x77, 0x74, 0xFF, 0xC6, 0xFF, 0x97, 0x9A, 0xE9, 0x72,
+    0xAD, 0x97, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x74, 0xE7, 0x39,
+    0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0x97,
+    0x3E, 0x73, 0x9E, 0x71, 0xAF, 0xE9, 0x5A, 0xFF, 0x95, 0x77, 0x6E, 0x3E, 0x5A, 0xE9, 0x1F, 0x5F,
+    0x2F, 0x59, 0xD9, 0x2A, 0xCA, 0x77, 0x77, 0x77, 0x71, 0xFF, 0xC7, 0xFF, 0x97, 0x09, 0xAE, 0x97,
+    0x3A, 0xD9, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xE7, 0x4A, 0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x5E, 0x74,
+    0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0x9E, 0x74, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xE9,
+    0x74, 0xE7, 0x49, 0xE7, 0x2A, 0xFE, 0x96, 0xAF, 0xF9, 0x60, 0x77, 0x74, 0x9A, 0xFF, 0xDA, 0x71,
+    0xAF, 0xFF, 0xDA, 0x7A, 0xA9, 0xAD, 0xA2, 0x9A, 0xFC, 0x71, 0xAD, 0x95, 0xAF, 0x70, 0xE7, 0x9E,
+    0xA7, 0xE7, 0x0A, 0xE6, 0x9E, 0x70, 0x9E, 0x95, 0xAD, 0xA7, 0x1E, 0xA5, 0xE9, 0x71, 0xEA, 0x5E,
+    0x72, 0xEA, 0x19, 0x99, 0xAE, 0x99, 0x99, 0x95, 0xEA, 0x1F, 0xFF, 0x5E, 0x91, 0xAA, 0xAF, 0xAA,
+    0xAA, 0xA5, 0xE9, 0x4E, 0x97, 0x19, 0xE5, 0xE7, 0x2E, 0xA4, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x1E,
+    0xA5, 0xAD, 0xA7, 0x0A, 0xE6, 0xE9, 0x7A, 0xE7, 0xE7, 0xF9, 0x69, 0xE9, 0x29, 0x9F, 0xC6, 0xAF,
+    0xFF, 0xD9, 0x6A, 0xFF, 0xEA, 0x97, 0x77, 0x71, 0x74, 0xAD, 0x92, 0xC7, 0x72, 0xFC, 0x1A, 0xCA,
+    0x77, 0x0A, 0xFF, 0xC9, 0x77, 0x0A, 0xC9, 0x09, 0xFA, 0x77, 0x19, 0xC2, 0x9D, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xFC, 0x97, 0xFF, 0x5F, 0xCA, 0x7F, 0xEA, 0x69, 0xF7, 0x1A, 0xD9, 0x71,
+    0xFA, 0x70, 0xE7, 0x2F, 0xC7, 0x0D, 0xA7, 0x2F, 0xCA, 0x7D, 0xA7, 0x19, 0xDA, 0xE6, 0x9D, 0x97,
+    0x1A, 0xD0, 0xE9, 0x5A, 0xD7, 0x2E, 0x0A, 0xE5, 0xE7, 0x2D, 0xA1, 0xE9, 0x4D, 0xA7, 0x19, 0xD9,
+    0x1A, 0xDA, 0x4D, 0x97, 0x19, 0xD3, 0xE3, 0x9D, 0x97, 0x1A, 0xD3, 0xAD, 0xA2, 0xAD, 0x72, 0xE4,
+    0xE2, 0xE7, 0x2D, 0xA4, 0xEA, 0x1D, 0xA7, 0x19, 0xD9, 0x49, 0xE1, 0xD9, 0x71, 0xAD, 0x6E, 0x99,
+    0xD7, 0x2E, 0x69, 0xEA, 0xD7, 0x2E, 0x7F, 0xD7, 0x2D, 0xA7, 0x9F, 0xA7, 0x19, 0xD9, 0x70, 0xF9,
+    0x7A, 0xFD, 0xA6, 0xAE, 0x7A, 0xFE, 0xA7, 0xE7, 0x77, 0x09, 0x71, 0x77, 0x77, 0x0C, 0xA7, 0x73,
+    0x9E, 0x77, 0x29, 0xF7, 0x72, 0xAF, 0x97, 0x72, 0xAE, 0x77, 0x49, 0x97, 0x77, 0x77, 0x77, 0x5A,
+    0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x09, 0xFA, 0x99, 0x99, 0xFC, 0x69, 0xEA, 0x69, 0xEA, 0x49, 0xE9,
+    0x70, 0xAE, 0x4E, 0xA7, 0x2E, 0xA2, 0xAE, 0x73, 0xAE, 0x2E, 0x74, 0xAE, 0x1A, 0xE7, 0x49, 0xE1,
+    0xE9, 0x74, 0x9E, 0x1E, 0x75, 0x9E, 0x09, 0xE7, 0x5A, 0xE0, 0xAE, 0x75, 0xEA, 0x0A, 0xE7, 0x5E,
+    0x90, 0xAE, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0xA1, 0x9E, 0x73, 0x9E, 0x3E, 0x97, 0x2E, 0x93, 0xF7,
+    0x1E, 0xA4, 0x9E, 0xA6, 0x9F, 0x6A, 0xF9, 0x19, 0x9F, 0xA7, 0x0A, 0xFF, 0xE9, 0x72, 0x9F, 0xF9,
+    0x77, 0x09, 0x97, 0x40, 0x77, 0x77, 0x6A, 0xCA, 0x77, 0x19, 0xEA, 0x77, 0x0A, 0xF9, 0x76, 0x9F,
+    0xC9, 0x77, 0xEA, 0x97, 0x71, 0x97, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70,
+    0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA,
+    0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1, 0xE7, 0x59,
+    0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE,
+    0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6,
+    0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x74, 0x77, 0x77,
+    0x3E, 0x97, 0x71, 0xFC, 0x77, 0x0E, 0xAE, 0x76, 0xE9, 0x0A, 0xDA, 0x73, 0x9E, 0x3A, 0xD7, 0x3A,
+    0xCA, 0x5A, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x09, 0xFA, 0x99, 0x99,
+    0xFC, 0x69, 0xEA, 0x69, 0xEA, 0x49, 0xE9, 0x70, 0xAE, 0x4E, 0xA7, 0x2E, 0xA2, 0xAE, 0x73, 0xAE,
+    0x2E, 0x74, 0xAE, 0x1A, 0xE7, 0x49, 0xE1, 0xE9, 0x74, 0x9E, 0x1E, 0x75, 0x9E, 0x09, 0xE7, 0x5A,
+    0xE0, 0xAE, 0x75, 0xEA, 0x0A, 0xE7, 0x5E, 0x90, 0xAE, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0xA1, 0x9E,
+    0x73, 0x9E, 0x3E, 0x97, 0x2E, 0x93, 0xF7, 0x1E, 0xA4, 0x9E, 0xA6, 0x9F, 0x6A, 0xF9, 0x19, 0x9F,
+    0xA7, 0x0A, 0xFF, 0xE9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x40, 0x71, 0x9D, 0xA2, 0xAA, 0x74,
+    0x9F, 0xA1, 0xD7, 0x4F, 0xFD, 0x74, 0xD1, 0xFC, 0x75, 0xA9, 0x2E, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x3A, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x09, 0xFA, 0x99, 0x99, 0xFC, 0x69, 0xEA, 0x69, 0xEA, 0x49,
+    0xE9, 0x70, 0xAE, 0x4E, 0xA7, 0x2E, 0xA2, 0xAE, 0x73, 0xAE, 0x2E, 0x74, 0xAE, 0x1A, 0xE7, 0x49,
+    0xE1, 0xE9, 0x74, 0x9E, 0x1E, 0x75, 0x9E, 0x09, 0xE7, 0x5A, 0xE0, 0xAE, 0x75, 0xEA, 0x0A, 0xE7,
+    0x5E, 0x90, 0xAE, 0x74, 0x9E, 0x1A, 0xE7, 0x4E, 0xA1, 0x9E, 0x73, 0x9E, 0x3E, 0x97, 0x2E, 0x93,
+    0xF7, 0x1E, 0xA4, 0x9E, 0xA6, 0x9F, 0x6A, 0xF9, 0x19, 0x9F, 0xA7, 0x0A, 0xFF, 0xE9, 0x72, 0x9F,
+    0xF9, 0x77, 0x09, 0x97, 0x40, 0x77, 0x77, 0xAD, 0x92, 0xAD, 0x73, 0x9E, 0xA1, 0xAE, 0x97, 0x2A,
+    0xE9, 0x1F, 0x73, 0x9D, 0x92, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xE9, 0x73, 0xAF,
+    0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA,
+    0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1,
+    0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49,
+    0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA,
+    0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x74,
+    0x19, 0x73, 0xAC, 0xA6, 0xD1, 0x9D, 0xA4, 0xE2, 0xAD, 0xA2, 0xE4, 0xAD, 0xA0, 0xE6, 0xAF, 0xC7,
+    0x0A, 0xE7, 0x1F, 0xA7, 0xEA, 0xD9, 0x5E, 0x1A, 0xD9, 0x3E, 0x92, 0xAD, 0x91, 0xE9, 0x4A, 0xD9,
+    0x1C, 0x96, 0xAA, 0x76, 0x77, 0x77, 0x4A, 0xFE, 0x92, 0xAC, 0x71, 0xAF, 0xFE, 0x0A, 0xD7, 0x9F,
+    0xA9, 0x99, 0x9F, 0xE7, 0x9E, 0xA6, 0x9F, 0x79, 0xEA, 0x70, 0xF7, 0xEA, 0x70, 0xFC, 0xA5, 0xAE,
+    0x70, 0xEA, 0xE5, 0xE7, 0x0E, 0x09, 0xE4, 0xAE, 0x7D, 0xA1, 0x9E, 0x4E, 0x96, 0xDA, 0x29, 0xE3,
+    0x9E, 0x6D, 0xA3, 0x9E, 0x39, 0xE4, 0x9D, 0xA4, 0xAE, 0x3A, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xE2,
+    0x9D, 0xA6, 0xE9, 0x3A, 0xE1, 0x9D, 0x96, 0x9E, 0x4A, 0xE0, 0x9D, 0x97, 0xEA, 0x49, 0xEA, 0xD9,
+    0x79, 0xE5, 0x9F, 0xC9, 0x70, 0xE9, 0x6F, 0x97, 0x0E, 0xA7, 0xAE, 0xA6, 0x9F, 0x7A, 0xFD, 0x91,
+    0x99, 0xFA, 0x7A, 0xD0, 0xAF, 0xFE, 0x97, 0x0D, 0x29, 0xFF, 0x97, 0x73, 0x99, 0x75, 0x77, 0x77,
+    0x0A, 0xC7, 0x74, 0x9E, 0x77, 0x39, 0xF9, 0x77, 0x2A, 0xF9, 0x77, 0x3A, 0xE7, 0x76, 0x97, 0x77,
+    0x77, 0x77, 0x09, 0xFF, 0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7,
+    0x2E, 0x59, 0xE7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD,
+    0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E,
+    0x72, 0xAD, 0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7,
+    0x1A, 0xD6, 0xAD, 0xA7, 0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A,
+    0xFA, 0x72, 0xFF, 0xE9, 0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x77, 0x77, 0x69, 0xCA, 0x77,
+    0x3F, 0x77, 0x1A, 0xFA, 0x77, 0x9F, 0xCA, 0x77, 0x0E, 0xA9, 0x77, 0x29, 0x97, 0x77, 0x77, 0x77,
+    0x39, 0xFF, 0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x2E, 0x59,
+    0xE7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD, 0x59, 0xE7,
+    0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E, 0x72, 0xAD,
+    0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7, 0x1A, 0xD6,
+    0xAD, 0xA7, 0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A, 0xFA, 0x72,
+    0xFF, 0xE9, 0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x77, 0x77, 0x3E, 0x97, 0x72, 0xFC, 0x97,
+    0x70, 0xEA, 0xE7, 0x7E, 0x90, 0x9E, 0x75, 0xE9, 0x29, 0xD7, 0x49, 0xCA, 0x5A, 0xA7, 0x77, 0x77,
+    0x75, 0x9F, 0xF5, 0xFF, 0x0A, 0xFE, 0xA5, 0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9, 0x5E, 0x72, 0xE5,
+    0x9E, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7, 0x2A, 0xD5, 0x9E,
+    0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD6, 0xE7, 0x2A,
+    0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A, 0xDA, 0x71, 0xAD,
+    0x6A, 0xDA, 0x71, 0xDA, 0x6A, 0xE7, 0x0E, 0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA, 0x99, 0xAF, 0xA7,
+    0x2F, 0xFE, 0x97, 0x4A, 0xFE, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x77, 0xAD, 0x92, 0xAD, 0x97, 0x39,
+    0xEA, 0x19, 0xEA, 0x73, 0x9E, 0x91, 0xAE, 0x97, 0x4D, 0xA2, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x59, 0xFF, 0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x2E, 0x59,
+    0xE7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD, 0x59, 0xE7,
+    0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E, 0x72, 0xAD,
+    0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7, 0x1A, 0xD6,
+    0xAD, 0xA7, 0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A, 0xFA, 0x72,
+    0xFF, 0xE9, 0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x77, 0x77, 0x39, 0xD7, 0x71, 0xAE, 0x77,
+    0xAF, 0xA7, 0x6F, 0xCA, 0x76, 0xF9, 0x77, 0x09, 0x97, 0x77, 0x77, 0x76, 0xAF, 0xF3, 0xFF, 0x9F,
+    0xFA, 0x3F, 0xEA, 0x19, 0xF9, 0x69, 0xEA, 0x4A, 0xE7, 0x9D, 0xA6, 0xE9, 0x6E, 0x7A, 0xDA, 0x5E,
+    0x70, 0x9E, 0x4A, 0xD9, 0x71, 0xE9, 0x29, 0xDA, 0x72, 0xAD, 0xA2, 0xE7, 0x4E, 0x1A, 0xD7, 0x5E,
+    0x99, 0xD9, 0x75, 0x9F, 0xCA, 0x77, 0xFC, 0x77, 0x0A, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xAD, 0x97,
+    0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xEA, 0x76, 0xAF, 0xF9, 0x72,
+    0x9F, 0xFC, 0x97, 0x10, 0x4F, 0xFA, 0x72, 0xFE, 0xA7, 0x49, 0xAD, 0xA7, 0x7A, 0xD9, 0x77, 0xEA,
+    0xA9, 0x97, 0x4F, 0xFC, 0xA7, 0x09, 0xEA, 0xAA, 0xFC, 0x7A, 0xD9, 0x39, 0xF6, 0xE5, 0x9E, 0x6E,
+    0x6E, 0x95, 0xE6, 0xE9, 0x49, 0xDA, 0x6E, 0x5A, 0xD9, 0x6E, 0x5E, 0x6A, 0xD9, 0x5E, 0x5A, 0xE5,
+    0x9E, 0x39, 0xF6, 0x9E, 0xAF, 0xDA, 0x7A, 0xFF, 0xA7, 0x1E, 0x99, 0x99, 0x74, 0xE7, 0x79, 0xE7,
+    0x5A, 0xFE, 0x72, 0xAF, 0xF7, 0x20, 0x77, 0x09, 0xAA, 0xCA, 0x77, 0x19, 0xFE, 0xA7, 0x6A, 0xEA,
+    0xAF, 0x97, 0x49, 0xDA, 0x3A, 0xDA, 0x74, 0xE5, 0xE7, 0x3A, 0xD9, 0x5D, 0xA7, 0x3E, 0x59, 0xD9,
+    0x72, 0x9D, 0xA5, 0xAC, 0xA7, 0x3A, 0xD9, 0x5D, 0x74, 0xE5, 0xD9, 0x74, 0xE4, 0xD9, 0x75, 0xDA,
+    0x3A, 0xCA, 0x75, 0x9D, 0xA3, 0xD9, 0x75, 0xAD, 0x92, 0x9D, 0x97, 0x5E, 0x39, 0xE7, 0x5E, 0x4F,
+    0x73, 0x9D, 0xA5, 0xF7, 0x2A, 0xD9, 0x6E, 0xA7, 0x1A, 0xD7, 0x9E, 0x97, 0x0E, 0x70, 0xAD, 0xA7,
+    0x0E, 0x70, 0x9E, 0x79, 0xDA, 0x71, 0xDA, 0x7A, 0xD9, 0x09, 0xC9, 0x49, 0xD7, 0x0E, 0x1E, 0xA2,
+    0x9D, 0x97, 0x0E, 0x1A, 0xFF, 0x97, 0x09, 0xDA, 0x2A, 0xFC, 0xA7, 0x2A, 0xD9, 0x59, 0x97, 0x4E,
+    0x77, 0x5E, 0x77, 0x49, 0xD9, 0x76, 0x9C, 0x92, 0xE7, 0x7A, 0xEA, 0xE9, 0x77, 0xAF, 0xD9, 0x77,
+    0x19, 0xAA, 0xA9, 0x77, 0x20, 0x79, 0x77, 0xAC, 0x97, 0x6E, 0x76, 0xF7, 0x6E, 0x97, 0x6E, 0x77,
+    0xAC, 0xA7, 0x79, 0x77, 0x77, 0x77, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A, 0xFC,
+    0x4A, 0xDA, 0x4E, 0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93,
+    0xE6, 0xE3, 0x9D, 0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3, 0x9C,
+    0xAD, 0x91, 0xA0, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2, 0xFC,
+    0x29, 0xFA, 0x3E, 0xA5, 0x99, 0x69, 0x40, 0x74, 0xAA, 0x76, 0x9D, 0x97, 0x5E, 0x97, 0x4E, 0x97,
+    0x4A, 0xDA, 0x74, 0x9D, 0x97, 0x5A, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFA, 0x1A, 0xCA, 0x5A,
+    0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA,
+    0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9,
+    0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA,
+    0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94, 0x72, 0x99, 0x76, 0xEA,
+    0x74, 0xAF, 0x97, 0x2A, 0xDA, 0xE7, 0x19, 0xD9, 0x0A, 0xD7, 0x09, 0xDA, 0x2D, 0xA7, 0xDA, 0x3A,
+    0xCA, 0x79, 0x95, 0x97, 0x77, 0x77, 0x49, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF,
+    0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9,
+    0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39,
+    0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F,
+    0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94, 0x70, 0x97, 0x6A, 0xE9, 0x1A, 0xC7, 0x9F, 0xC9, 0x0D,
+    0x7D, 0xA9, 0xFD, 0x7D, 0x19, 0xF7, 0x19, 0x3A, 0x97, 0x77, 0x77, 0x77, 0x79, 0xFA, 0x1A, 0xCA,
+    0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39,
+    0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A,
+    0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99,
+    0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94, 0x69, 0x94, 0x99,
+    0x7A, 0xE2, 0xE9, 0x6F, 0x19, 0xE9, 0x6E, 0x91, 0x9E, 0x70, 0x94, 0x99, 0x77, 0x77, 0x77, 0x76,
+    0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A, 0xFC, 0x4A, 0xDA, 0x4E, 0xA3, 0x9E, 0x5A,
+    0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0xE6, 0xE3, 0x9D, 0xA5, 0x9E, 0x39,
+    0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA0, 0xAE, 0x2A, 0xD0,
+    0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2, 0xFC, 0x29, 0xFA, 0x3E, 0xA5, 0x99, 0x69,
+    0x40, 0x77, 0x72, 0xAE, 0xA7, 0x3A, 0xFC, 0xA7, 0x19, 0xD1, 0x9D, 0x71, 0xAC, 0xA2, 0xD7, 0x1D,
+    0x92, 0xD7, 0x1A, 0xD1, 0xAC, 0xA7, 0x19, 0xFD, 0x73, 0x9E, 0xA7, 0x77, 0x77, 0x69, 0xFA, 0x1A,
+    0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E,
+    0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA,
+    0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC,
+    0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94, 0x77, 0x76,
+    0xAF, 0xA2, 0x9F, 0xC9, 0x59, 0xFF, 0xAF, 0xF4, 0xAE, 0xA9, 0x9A, 0xFA, 0x2A, 0xD9, 0x2A, 0xE4,
+    0x9D, 0xA3, 0x9D, 0x92, 0xE5, 0xE4, 0xE2, 0xE5, 0x9D, 0x93, 0x9E, 0x19, 0xDA, 0x5E, 0x3A, 0xE2,
+    0xAD, 0x6E, 0x19, 0xF3, 0xE5, 0xAD, 0xAA, 0xF9, 0x39, 0xDA, 0x5F, 0xE9, 0x59, 0xDA, 0x4A, 0xF9,
+    0x70, 0xAD, 0x93, 0x9F, 0x72, 0xAD, 0xA3, 0xFC, 0x96, 0xA1, 0xAE, 0x2D, 0x9A, 0xE4, 0x9D, 0x90,
+    0x9E, 0xAA, 0xDA, 0x1F, 0x99, 0xAE, 0xA2, 0xFD, 0xA2, 0xAF, 0xF9, 0x39, 0xF9, 0x4A, 0xFC, 0xA7,
+    0x97, 0x19, 0x97, 0x77, 0x29, 0xFC, 0x94, 0xFF, 0x3E, 0xA9, 0xAD, 0xA2, 0xE4, 0x92, 0xAD, 0x71,
+    0xDA, 0x70, 0xAD, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xE6, 0xA0, 0x9E, 0x49, 0xD1, 0xFA, 0x9A, 0xE9, 0x1A, 0xFF, 0x4A, 0xFC, 0x97, 0x99, 0x73, 0x97,
+    0x1A, 0xE9, 0x7A, 0xAE, 0x71, 0xDA, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0xE9, 0x70, 0xA9, 0x70, 0x69,
+    0x73, 0xD7, 0x29, 0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x29, 0xE7, 0x3D, 0x97, 0x3A, 0x77, 0x77, 0x49,
+    0xFC, 0x95, 0xFF, 0x4E, 0x2A, 0xD9, 0x2D, 0xA3, 0x9D, 0x91, 0xAD, 0x4A, 0xD9, 0x1D, 0xA3, 0x9E,
+    0x1A, 0xD3, 0xAE, 0x2E, 0x19, 0xF2, 0x9E, 0xAF, 0xA3, 0x9F, 0xD9, 0x5A, 0xE9, 0x70, 0xAD, 0x97,
+    0x1A, 0xD9, 0x6A, 0x19, 0xE4, 0x9D, 0x91, 0xFA, 0x9A, 0xEA, 0x2A, 0xFF, 0xA4, 0xAF, 0xCA, 0x70,
+    0x99, 0x70, 0x73, 0xC9, 0x73, 0xAD, 0x72, 0x9E, 0x72, 0xE7, 0x2E, 0x97, 0x1A, 0xD7, 0x3D, 0x77,
+    0x77, 0x77, 0x79, 0xFC, 0x96, 0xFF, 0x5E, 0x2A, 0xD9, 0x3D, 0xA3, 0x9D, 0x92, 0xAD, 0x4A, 0xD9,
+    0x2D, 0xA3, 0x9E, 0x2A, 0xD3, 0xAE, 0x3E, 0x19, 0xF3, 0x9E, 0xAF, 0xA4, 0x9F, 0xD9, 0x6A, 0xE9,
+    0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x6A, 0x29, 0xE4, 0x9D, 0x92, 0xFA, 0x9A, 0xEA, 0x3A, 0xFF, 0xA5,
+    0xAF, 0xCA, 0x71, 0x99, 0x70, 0x71, 0x99, 0x72, 0x9E, 0x97, 0x1F, 0xC7, 0x0E, 0xAD, 0x96, 0xAD,
+    0x1E, 0x5A, 0xD9, 0x19, 0xD4, 0x9D, 0x93, 0xD5, 0xA5, 0x99, 0x77, 0x77, 0x49, 0xFC, 0x96, 0xFF,
+    0x5E, 0x2A, 0xD9, 0x3D, 0xA3, 0x9D, 0x92, 0xAD, 0x4A, 0xD9, 0x2D, 0xA3, 0x9E, 0x2A, 0xD3, 0xAE,
+    0x3E, 0x19, 0xF3, 0x9E, 0xAF, 0xA4, 0x9F, 0xD9, 0x6A, 0xE9, 0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x6A,
+    0x29, 0xE4, 0x9D, 0x92, 0xFA, 0x9A, 0xEA, 0x3A, 0xFF, 0xA5, 0xAF, 0xCA, 0x71, 0x99, 0x70, 0x59,
+    0x94, 0x99, 0x5E, 0xA1, 0x9E, 0x49, 0xEA, 0x1A, 0xE4, 0x9E, 0x2A, 0xDA, 0x59, 0x94, 0x97, 0x77,
+    0x77, 0x77, 0x09, 0xFC, 0x97, 0xFF, 0x6E, 0x2A, 0xD9, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4A, 0xD9,
+    0x3D, 0xA3, 0x9E, 0x3A, 0xD3, 0xAE, 0x4E, 0x19, 0xF4, 0x9E, 0xAF, 0xA5, 0x9F, 0xD9, 0x7A, 0xE9,
+    0x72, 0xAD, 0x97, 0x3A, 0xD9, 0x6A, 0x39, 0xE4, 0x9D, 0x93, 0xFA, 0x9A, 0xEA, 0x4A, 0xFF, 0xA6,
+    0xAF, 0xCA, 0x72, 0x99, 0x71, 0x39, 0x6A, 0xC9, 0x5E, 0x5F, 0x5E, 0xA5, 0xE6, 0xAC, 0xA6, 0x97,
+    0x73, 0x9A, 0xF2, 0xFD, 0x91, 0x99, 0x9E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9, 0x4E, 0x5E, 0x49, 0xDA,
+    0x4A, 0xD9, 0x4E, 0x49, 0xE4, 0xAD, 0xA1, 0xA1, 0xE9, 0x0D, 0x1F, 0xDA, 0x1F, 0xCA, 0x2F, 0x94,
+    0x95, 0x70, 0xAA, 0x70, 0x9D, 0x97, 0xE9, 0x6E, 0xA6, 0xAD, 0xA6, 0x9D, 0x97, 0xAC, 0x97, 0x77,
+    0x77, 0x09, 0xAF, 0x5F, 0xD9, 0x49, 0x99, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7,
+    0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x1A, 0x4E, 0x90, 0xD4, 0xFD, 0xA4, 0xFC, 0xA5,
+    0xF9, 0x79, 0x70, 0x79, 0x70, 0xF6, 0xAF, 0x94, 0x9D, 0xAE, 0x39, 0xD9, 0x0A, 0xD3, 0xDA, 0x2D,
+    0xA1, 0xDA, 0x3A, 0xCA, 0x19, 0x95, 0x97, 0x77, 0x19, 0xAF, 0x5F, 0xD9, 0x49, 0x99, 0xE7, 0x0E,
+    0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x1A,
+    0x4E, 0x90, 0xD4, 0xFD, 0xA4, 0xFC, 0xA5, 0xF9, 0x79, 0x70, 0x29, 0x94, 0x99, 0x2A, 0xE2, 0xE9,
+    0x1F, 0x19, 0xE9, 0x1E, 0x91, 0x9E, 0x39, 0x49, 0x97, 0x77, 0x77, 0x19, 0xAF, 0x6F, 0xD9, 0x59,
+    0x99, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9,
+    0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA, 0x1A, 0x5E, 0x90, 0xD5, 0xFD, 0xA5, 0xFC, 0xA6, 0xF9, 0x70,
+    0x97, 0x10, 0x77, 0x69, 0xCA, 0x3A, 0x7E, 0xA0, 0x9D, 0x97, 0xFD, 0x97, 0x1F, 0x72, 0xAF, 0x70,
+    0x9D, 0xA9, 0xDA, 0x7A, 0xC9, 0x1A, 0xD7, 0x5D, 0x97, 0x4A, 0xD5, 0x9A, 0xFA, 0x9D, 0x4A, 0xFF,
+    0xD9, 0x2A, 0xE9, 0x19, 0xF9, 0x1A, 0xE4, 0x9E, 0xA1, 0xE6, 0xEA, 0x0A, 0xD9, 0x6A, 0xDA, 0x0E,
+    0x7A, 0xD9, 0x9D, 0xA7, 0xAD, 0x9A, 0xDA, 0x7A, 0xD0, 0xAD, 0x97, 0xE0, 0xE9, 0x69, 0xD9, 0x0E,
+    0x96, 0xAD, 0x1E, 0x95, 0x9D, 0xA1, 0xAE, 0x49, 0xE3, 0xEA, 0x2A, 0xE4, 0x9F, 0xFC, 0x69, 0xFD,
+    0x97, 0x29, 0x97, 0x00, 0x70, 0x97, 0x7A, 0xE9, 0x1A, 0xC7, 0x09, 0xFC, 0x90, 0xD7, 0x0D, 0xA9,
+    0xFD, 0x70, 0xD1, 0x9F, 0x72, 0x93, 0xA9, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x3A, 0xEA, 0x29,
+    0xFC, 0xA1, 0x9F, 0xD9, 0x29, 0x99, 0xDA, 0x09, 0xEA, 0xEA, 0x49, 0xD9, 0x9D, 0x91, 0xAD, 0x94,
+    0x9D, 0x9D, 0x92, 0xAD, 0x94, 0xAD, 0xAC, 0x93, 0xE5, 0xFA, 0x4E, 0x5F, 0x49, 0xDA, 0x49, 0xE9,
+    0x4A, 0xD9, 0x4A, 0xE5, 0xE5, 0xE9, 0x5E, 0x5E, 0x59, 0xDA, 0x49, 0xDA, 0x5A, 0xD9, 0x1A, 0x1A,
+    0xD9, 0x5E, 0x09, 0xD1, 0xAD, 0x6E, 0xAD, 0xA1, 0xE6, 0xFC, 0xA2, 0xDA, 0x6A, 0xE9, 0x76, 0x95,
+    0x79, 0x75, 0xAC, 0x97, 0x4E, 0x74, 0xF7, 0x4E, 0xA7, 0x4E, 0x75, 0xAC, 0xA7, 0x59, 0x77, 0x77,
+    0x71, 0x9F, 0xCA, 0x7F, 0xFC, 0x5E, 0xA9, 0x09, 0xF3, 0xE9, 0x4E, 0x91, 0xAD, 0xA5, 0xE9, 0x09,
+    0xE6, 0xAD, 0xA0, 0xAD, 0x96, 0xAD, 0xA0, 0xE7, 0xAD, 0x99, 0xE7, 0xE9, 0x9D, 0xA7, 0xE0, 0xAD,
+    0xA6, 0x9D, 0xA0, 0xAD, 0xA6, 0xE9, 0x0A, 0xDA, 0x5A, 0xDA, 0x19, 0xE4, 0x9E, 0x3F, 0x2A, 0xE4,
+    0x9F, 0xFC, 0x69, 0xFD, 0x97, 0x29, 0x97, 0x00, 0x74, 0xAA, 0x74, 0x9D, 0x97, 0x3E, 0x97, 0x2E,
+    0xA7, 0x2A, 0xDA, 0x72, 0x9D, 0x97, 0x3A, 0xC9, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xCA, 0x7F, 0xFC,
+    0x5E, 0xA9, 0x09, 0xF3, 0xE9, 0x4E, 0x91, 0xAD, 0xA5, 0xE9, 0x09, 0xE6, 0xAD, 0xA0, 0xAD, 0x96,
+    0xAD, 0xA0, 0xE7, 0xAD, 0x99, 0xE7, 0xE9, 0x9D, 0xA7, 0xE0, 0xAD, 0xA6, 0x9D, 0xA0, 0xAD, 0xA6,
+    0xE9, 0x0A, 0xDA, 0x5A, 0xDA, 0x19, 0xE4, 0x9E, 0x3F, 0x2A, 0xE4, 0x9F, 0xFC, 0x69, 0xFD, 0x97,
+    0x29, 0x97, 0x00, 0x73, 0x97, 0x4F, 0x72, 0xAF, 0x97, 0x09, 0xDA, 0xE7, 0x9D, 0x90, 0xAD, 0x7D,
+    0xA2, 0xDA, 0x5D, 0xA3, 0xAC, 0xA5, 0x99, 0x59, 0x77, 0x77, 0x69, 0xFC, 0xA7, 0xFF, 0xC5, 0xEA,
+    0x90, 0x9F, 0x3E, 0x94, 0xE9, 0x1A, 0xDA, 0x5E, 0x90, 0x9E, 0x6A, 0xDA, 0x0A, 0xD9, 0x6A, 0xDA,
+    0x0E, 0x7A, 0xD9, 0x9E, 0x7E, 0x99, 0xDA, 0x7E, 0x0A, 0xDA, 0x69, 0xDA, 0x0A, 0xDA, 0x6E, 0x90,
+    0xAD, 0xA5, 0xAD, 0xA1, 0x9E, 0x49, 0xE3, 0xF2, 0xAE, 0x49, 0xFF, 0xC6, 0x9F, 0xD9, 0x72, 0x99,
+    0x70, 0x70, 0x97, 0x59, 0xEA, 0x19, 0xC6, 0x9F, 0xC9, 0x0D, 0x95, 0xE0, 0xFD, 0x6D, 0x2F, 0x70,
+    0x93, 0xA9, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xCA, 0x70, 0xFF, 0xC6, 0xEA, 0x90, 0x9F, 0x4E, 0x94,
+    0xE9, 0x2A, 0xDA, 0x5E, 0x91, 0x9E, 0x6A, 0xDA, 0x1A, 0xD9, 0x6A, 0xDA, 0x1E, 0x7A, 0xD9, 0x09,
+    0xE7, 0xE9, 0x09, 0xDA, 0x7E, 0x1A, 0xDA, 0x69, 0xDA, 0x1A, 0xDA, 0x6E, 0x91, 0xAD, 0xA5, 0xAD,
+    0xA2, 0x9E, 0x49, 0xE4, 0xF2, 0xAE, 0x59, 0xFF, 0xC7, 0x9F, 0xD9, 0x73, 0x99, 0x71, 0x69, 0x94,
+    0x99, 0x6A, 0xE2, 0xE9, 0x5F, 0x19, 0xE9, 0x5E, 0x91, 0x9E, 0x79, 0x49, 0x97, 0x77, 0x77, 0x77,
+    0x29, 0xFC, 0xA7, 0x0F, 0xFC, 0x6E, 0xA9, 0x09, 0xF4, 0xE9, 0x4E, 0x92, 0xAD, 0xA5, 0xE9, 0x19,
+    0xE6, 0xAD, 0xA1, 0xAD, 0x96, 0xAD, 0xA1, 0xE7, 0xAD, 0x90, 0x9E, 0x7E, 0x90, 0x9D, 0xA7, 0xE1,
+    0xAD, 0xA6, 0x9D, 0xA1, 0xAD, 0xA6, 0xE9, 0x1A, 0xDA, 0x5A, 0xDA, 0x29, 0xE4, 0x9E, 0x4F, 0x2A,
+    0xE5, 0x9F, 0xFC, 0x79, 0xFD, 0x97, 0x39, 0x97, 0x10, 0x59, 0xA9, 0x72, 0xAE, 0x72, 0xAE, 0x97,
+    0x19, 0xE7, 0x49, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF,
+    0xFC, 0x77, 0x77, 0x49, 0xA9, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x19, 0xDA, 0x77, 0x40, 0x77, 0x75,
+    0x9F, 0xCA, 0x19, 0xC9, 0x7F, 0xFC, 0xAD, 0x96, 0xEA, 0x90, 0x9F, 0xC7, 0xE9, 0x4E, 0x96, 0xAD,
+    0xA4, 0xF9, 0x59, 0xE4, 0xFC, 0xA5, 0xAD, 0x93, 0xDA, 0xAD, 0xA5, 0xE2, 0x9D, 0x90, 0xAD, 0x94,
+    0x9E, 0x19, 0xD9, 0x1E, 0x94, 0x9D, 0xA0, 0xAD, 0x3E, 0x5A, 0xDA, 0xAD, 0x39, 0xDA, 0x5A, 0xFA,
+    0x4E, 0x95, 0xAE, 0xA4, 0xAE, 0x69, 0xE4, 0x9E, 0x69, 0xFA, 0x2A, 0xE9, 0x5A, 0xDA, 0xFF, 0xC7,
+    0xD1, 0x9F, 0xD9, 0x77, 0x99, 0x72, 0x79, 0x77, 0x09, 0xCA, 0x77, 0xE9, 0x76, 0xAE, 0x77, 0xEA,
+    0x77, 0xAD, 0x97, 0x7A, 0xD7, 0x70, 0x99, 0x77, 0x77, 0x74, 0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59,
+    0xE2, 0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59,
+    0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9,
+    0x49, 0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D,
+    0xAD, 0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x74, 0x9A, 0x77, 0x0D, 0xA7,
+    0x6E, 0x97, 0x5A, 0xDA, 0x75, 0x9D, 0xA7, 0x6D, 0xA7, 0x69, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x09,
+    0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E, 0x29, 0x99, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5,
+    0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9E,
+    0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94, 0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA1, 0x9D, 0xA2, 0xAD, 0x0D,
+    0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x2F, 0xE2, 0xFC, 0x3A, 0xFA, 0x3E, 0xA6, 0x97, 0x94,
+    0x73, 0x97, 0x7A, 0xE7, 0x59, 0xFA, 0x73, 0x9D, 0xAE, 0x73, 0xDA, 0x09, 0xD9, 0x71, 0xE2, 0xDA,
+    0x70, 0xE3, 0x9D, 0x70, 0x99, 0x59, 0x77, 0x77, 0x72, 0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59, 0xE2,
+    0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59, 0xDA,
+    0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9, 0x49,
+    0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D, 0xAD,
+    0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x79, 0x93, 0x99, 0x70, 0x9E, 0x2A,
+    0xDA, 0x7F, 0x2E, 0xA7, 0xAD, 0xA2, 0xE7, 0x19, 0x59, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xF6, 0xAD,
+    0x19, 0xFD, 0x59, 0xE2, 0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9,
+    0x5E, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA,
+    0x5E, 0x4A, 0xE9, 0x49, 0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E,
+    0x99, 0xE0, 0x9D, 0xAD, 0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x76, 0xA9,
+    0x77, 0x09, 0xD9, 0x77, 0xE7, 0x7E, 0x97, 0x6A, 0xD9, 0x76, 0x9D, 0x97, 0x7A, 0xC9, 0x77, 0x77,
+    0x77, 0x77, 0x59, 0xAE, 0x59, 0xE4, 0xFD, 0x5E, 0xA3, 0x99, 0xAE, 0x5A, 0xDA, 0x6E, 0x94, 0x9D,
+    0xA6, 0x9E, 0x49, 0xD9, 0x7E, 0x49, 0xD7, 0x0E, 0x4A, 0xD7, 0x09, 0xD9, 0x3D, 0x97, 0x09, 0xDA,
+    0x29, 0xD7, 0x2D, 0xA2, 0xDA, 0x72, 0xDA, 0x19, 0xD7, 0x3E, 0x1D, 0xA7, 0x3E, 0x09, 0xD7, 0x4A,
+    0xCA, 0x0D, 0x97, 0x4A, 0xCA, 0xAC, 0xA7, 0x5F, 0xC7, 0x6F, 0x77, 0xE9, 0x76, 0x9D, 0xA7, 0x7D,
+    0xA7, 0x69, 0xDA, 0x71, 0x9C, 0x90, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xCA, 0x76, 0xAA, 0xA7,
+    0x70, 0x70, 0x99, 0x97, 0x5A, 0xFC, 0x97, 0x4F, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77,
+    0xAD, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x19, 0xF9, 0x79, 0xD9, 0x0A, 0xFD, 0x7A, 0xD0,
+    0xAD, 0xAA, 0xEA, 0x6D, 0xA9, 0xD2, 0xAE, 0x6D, 0xAD, 0x39, 0xE5, 0x9F, 0x49, 0xE5, 0xAE, 0xA4,
+    0x9E, 0x5A, 0xE5, 0x9D, 0xA5, 0xE9, 0x5A, 0xD9, 0x5E, 0x6E, 0x59, 0xDA, 0x59, 0xE5, 0xAD, 0x6A,
+    0xD9, 0x5E, 0x59, 0xDA, 0x6E, 0x5E, 0x69, 0xF9, 0x19, 0xE9, 0x6A, 0xFF, 0xD9, 0x7E, 0x9F, 0xCA,
+    0x71, 0xE2, 0x97, 0x4D, 0xA7, 0x79, 0xD9, 0x77, 0xAD, 0x77, 0x0E, 0x77, 0xAE, 0xAA, 0x97, 0x3F,
+    0xFA, 0x72, 0x99, 0x99, 0x99, 0x99, 0x72, 0x70, 0x99, 0x49, 0x97, 0x1A, 0xE2, 0xE9, 0x70, 0xF1,
+    0x9E, 0x97, 0x0E, 0x91, 0x9E, 0x72, 0x94, 0x99, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAE, 0x59, 0xE4,
+    0xFD, 0x5E, 0xA3, 0x99, 0xAE, 0x5A, 0xDA, 0x6E, 0x94, 0x9D, 0xA6, 0x9E, 0x49, 0xD9, 0x7E, 0x49,
+    0xD7, 0x0E, 0x4A, 0xD7, 0x09, 0xD9, 0x3D, 0x97, 0x09, 0xDA, 0x29, 0xD7, 0x2D, 0xA2, 0xDA, 0x72,
+    0xDA, 0x19, 0xD7, 0x3E, 0x1D, 0xA7, 0x3E, 0x09, 0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x4A, 0xCA, 0xAC,
+    0xA7, 0x5F, 0xC7, 0x6F, 0x77, 0xE9, 0x76, 0x9D, 0xA7, 0x7D, 0xA7, 0x69, 0xDA, 0x71, 0x9C, 0x90,
+    0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xCA, 0x76, 0xAA, 0xA7, 0x70, 0x77, 0x77, 0x4F, 0xFC, 0xA7,
+    0x6F, 0xFC, 0x97, 0x69, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x69, 0x77, 0x5E, 0x77,
+    0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70,
+    0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3,
+    0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF,
+    0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9,
+    0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA,
+    0x5F, 0xFC, 0x00, 0x69, 0x99, 0x99, 0x99, 0x99, 0x7A, 0xFF, 0xC7, 0xAF, 0xFC, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A, 0xFC, 0x4A, 0xDA, 0x4E, 0xA3,
+    0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0xE6, 0xE3, 0x9D, 0xA5,
+    0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA0, 0xAE,
+    0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2, 0xFC, 0x29, 0xFA, 0x3E, 0xA5,
+    0x99, 0x69, 0x40, 0x77, 0x77, 0x49, 0xC6, 0xC7, 0x6D, 0xA4, 0xD7, 0x6E, 0xA9, 0x9A, 0xD9, 0x76,
+    0x9F, 0xE9, 0x77, 0x09, 0xFC, 0x97, 0x74, 0x97, 0x77, 0x77, 0x71, 0x97, 0x75, 0xE7, 0x74, 0xF7,
+    0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71, 0xD9, 0x0E, 0x77, 0x0A, 0xD1,
+    0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A, 0xDA, 0x75, 0xDA, 0x39, 0xE7,
+    0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xE9, 0x72, 0xFF, 0xFC, 0xA7,
+    0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E, 0x71, 0xE7, 0xAD, 0x97, 0x1E,
+    0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A, 0xFE, 0x0A, 0xFE, 0xA5, 0xFF,
+    0xC0, 0x77, 0x70, 0xCA, 0x5A, 0x96, 0xAD, 0x93, 0xD7, 0x9F, 0xAE, 0xA7, 0x0F, 0xEA, 0x72, 0x9E,
+    0xA9, 0x77, 0x77, 0x77, 0x77, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A, 0xFC, 0x4A,
+    0xDA, 0x4E, 0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0xE6,
+    0xE3, 0x9D, 0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3, 0x9C, 0xAD,
+    0x91, 0xA0, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2, 0xFC, 0x29,
+    0xFA, 0x3E, 0xA5, 0x99, 0x69, 0x40, 0x77, 0x09, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77,
+    0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91,
+    0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74,
+    0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA,
+    0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x77, 0x3A, 0xCA,
+    0x77, 0x4D, 0x97, 0x74, 0xDA, 0x77, 0x5D, 0x97, 0x75, 0xEA, 0x99, 0x77, 0x2F, 0xD7, 0x73, 0xAD,
+    0xA2, 0x77, 0x79, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA,
+    0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA,
+    0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A,
+    0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xF5,
+    0x99, 0x6D, 0x76, 0xD7, 0x6A, 0xCA, 0x76, 0xD9, 0x76, 0xE9, 0x75, 0xFD, 0x74, 0xAD, 0xA2, 0x77,
+    0x77, 0x39, 0xCA, 0x77, 0xF7, 0x5A, 0xFA, 0x73, 0x9F, 0xCA, 0x74, 0xEA, 0x97, 0x69, 0x97, 0x77,
+    0x77, 0x76, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xEA, 0x49, 0xFA, 0xA9, 0x9A, 0xFA, 0x39, 0xEA, 0x69,
+    0xD9, 0x29, 0xE9, 0x79, 0xD3, 0xE9, 0x70, 0x9D, 0x2A, 0xDA, 0x71, 0x9C, 0x92, 0xE7, 0x7A, 0xDA,
+    0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x7A, 0xE7, 0x7A, 0xE7, 0x79, 0xE7, 0x79, 0xE7,
+    0x70, 0xEA, 0x77, 0xF9, 0x71, 0xCA, 0x29, 0xFA, 0x6A, 0xD9, 0x3A, 0xFC, 0xAA, 0xAA, 0xFA, 0x5A,
+    0xFF, 0xE9, 0x79, 0xAF, 0xE9, 0x75, 0x99, 0x71, 0x73, 0xC9, 0x73, 0xAD, 0x72, 0x9E, 0x72, 0xE7,
+    0x2E, 0x97, 0x1A, 0xD7, 0x3D, 0x77, 0x77, 0x77, 0x79, 0xFC, 0x96, 0xFF, 0x5E, 0xA9, 0xAD, 0xA4,
+    0xE4, 0x94, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x2A, 0xDA,
+    0x72, 0xAD, 0xA7, 0x2A, 0xE6, 0xA2, 0x9E, 0x49, 0xD3, 0xFA, 0x9A, 0xE9, 0x3A, 0xFF, 0x6A, 0xFC,
+    0x97, 0x19, 0x97, 0x00, 0x77, 0x77, 0x0E, 0x97, 0x6F, 0xC9, 0x74, 0xEA, 0xE7, 0x3E, 0x90, 0x9E,
+    0x71, 0xE9, 0x29, 0xD9, 0x79, 0xCA, 0x5A, 0xA7, 0x77, 0x77, 0x70, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF,
+    0xEA, 0x49, 0xFA, 0xA9, 0x9A, 0xFA, 0x39, 0xEA, 0x69, 0xD9, 0x29, 0xE9, 0x79, 0xD3, 0xE9, 0x70,
+    0x9D, 0x2A, 0xDA, 0x71, 0x9C, 0x92, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x79,
+    0xE7, 0x7A, 0xE7, 0x7A, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xEA, 0x77, 0xF9, 0x71, 0xCA, 0x29,
+    0xFA, 0x6A, 0xD9, 0x3A, 0xFC, 0xAA, 0xAA, 0xFA, 0x5A, 0xFF, 0xE9, 0x79, 0xAF, 0xE9, 0x75, 0x99,
+    0x71, 0x71, 0x99, 0x72, 0x9E, 0x97, 0x1F, 0xC7, 0x0E, 0xAD, 0x96, 0xAD, 0x1E, 0x5A, 0xD9, 0x19,
+    0xD4, 0x9D, 0x93, 0xD5, 0xA5, 0x99, 0x77, 0x77, 0x49, 0xFC, 0x96, 0xFF, 0x5E, 0xA9, 0xAD, 0xA4,
+    0xE4, 0x94, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x2A, 0xDA,
+    0x72, 0xAD, 0xA7, 0x2A, 0xE6, 0xA2, 0x9E, 0x49, 0xD3, 0xFA, 0x9A, 0xE9, 0x3A, 0xFF, 0x6A, 0xFC,
+    0x97, 0x19, 0x97, 0x00, 0x74, 0x9A, 0xA7, 0x7A, 0xE9, 0x76, 0xF7, 0x7F, 0x77, 0x9A, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0xAF, 0xFE, 0xA4, 0x9F, 0xAA, 0x99, 0xAF, 0xA3, 0x9E,
+    0xA6, 0x9D, 0x92, 0x9E, 0x97, 0x9D, 0x3E, 0x97, 0x09, 0xD2, 0xAD, 0xA7, 0x19, 0xC9, 0x2E, 0x77,
+    0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0xAE, 0x77, 0xAE, 0x77, 0x9E, 0x77,
+    0x9E, 0x77, 0x0E, 0xA7, 0x7F, 0x97, 0x1C, 0xA2, 0x9F, 0xA6, 0xAD, 0x93, 0xAF, 0xCA, 0xAA, 0xAF,
+    0xA5, 0xAF, 0xFE, 0x97, 0x9A, 0xFE, 0x97, 0x59, 0x97, 0x10, 0x70, 0xAC, 0x97, 0x0F, 0x70, 0xF7,
+    0x0E, 0x97, 0x19, 0x77, 0x77, 0x77, 0x9F, 0xC9, 0x4F, 0xF3, 0xEA, 0x9A, 0xDA, 0x2E, 0x49, 0x2A,
+    0xD7, 0x1D, 0xA7, 0x0A, 0xD7, 0x1E, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x70, 0xAE, 0x6A, 0x09, 0xE4, 0x9D, 0x1F, 0xA9, 0xAE, 0x91, 0xAF, 0xF4, 0xAF, 0xC9, 0x79, 0x96,
+    0x70, 0x9A, 0x6A, 0xA7, 0x1D, 0xA3, 0x9E, 0x71, 0xE9, 0x19, 0xE7, 0x29, 0xE0, 0xAD, 0xA7, 0x4A,
+    0xFC, 0xA7, 0x6F, 0xA7, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xEA, 0x97, 0x0A, 0xFF, 0xEA,
+    0x59, 0xFA, 0xA9, 0x9A, 0xFA, 0x49, 0xEA, 0x69, 0xD9, 0x39, 0xE9, 0x79, 0xD4, 0xE9, 0x70, 0x9D,
+    0x3A, 0xDA, 0x71, 0x9C, 0x93, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7,
+    0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x1E, 0xA7, 0x70,
+    0xF9, 0x71, 0xCA, 0x39, 0xFA, 0x6A, 0xD9, 0x4A, 0xFC, 0xAA, 0xAA, 0xFA, 0x6A, 0xFF, 0xE9, 0x70,
+    0x9A, 0xFE, 0x97, 0x69, 0x97, 0x20, 0x59, 0x59, 0xA5, 0xAC, 0xA3, 0xAD, 0x59, 0xD2, 0xAD, 0x96,
+    0xDA, 0x0A, 0xD9, 0x7A, 0xDA, 0xD9, 0x71, 0xFA, 0x72, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x29, 0xFC,
+    0x97, 0xFF, 0x6E, 0xA9, 0xAD, 0xA5, 0xE4, 0x95, 0xAD, 0x74, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0x39,
+    0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xE6, 0xA3, 0x9E, 0x49, 0xD4, 0xFA,
+    0x9A, 0xE9, 0x4A, 0xFF, 0x7A, 0xFC, 0x97, 0x29, 0x97, 0x10, 0x72, 0xA9, 0x59, 0xA7, 0x4A, 0xD4,
+    0xE9, 0x73, 0x9D, 0xA2, 0xE9, 0x75, 0xEA, 0x0E, 0x77, 0x0F, 0xD7, 0x71, 0x9F, 0x77, 0x39, 0xD7,
+    0x77, 0x77, 0x77, 0x49, 0xAF, 0xFD, 0xA7, 0x1A, 0xFF, 0xFD, 0xA7, 0xAA, 0x9A, 0xDA, 0x29, 0xAF,
+    0xC7, 0x1A, 0xD9, 0x5A, 0xF7, 0x0E, 0x79, 0xEA, 0x7E, 0x70, 0xAE, 0x69, 0xE7, 0x09, 0xE9, 0x5A,
+    0xDA, 0x71, 0xEA, 0x5E, 0x97, 0x1E, 0xA5, 0xE7, 0x2E, 0xA5, 0xE7, 0x2E, 0xA4, 0x9D, 0xA7, 0x2E,
+    0x94, 0xAD, 0xA7, 0x2E, 0x94, 0xE9, 0x71, 0x9E, 0x5E, 0x72, 0xEA, 0x49, 0xE7, 0x2E, 0x59, 0xDA,
+    0x71, 0xEA, 0x5A, 0xD9, 0x70, 0xAE, 0x6E, 0x97, 0xAE, 0x7E, 0x7F, 0x96, 0x9E, 0x92, 0x99, 0xFC,
+    0x6A, 0xFF, 0xFD, 0x96, 0xAF, 0xFE, 0xA9, 0x77, 0x77, 0x10, 0x77, 0x49, 0x77, 0x6D, 0x97, 0x73,
+    0x9D, 0x97, 0x59, 0x99, 0x2A, 0xD7, 0x39, 0xFC, 0xA1, 0xDA, 0x73, 0xFD, 0xA1, 0xD9, 0x76, 0xAD,
+    0x91, 0xD7, 0x7E, 0x19, 0xC9, 0x77, 0xE2, 0x97, 0x70, 0xDA, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9,
+    0x74, 0x9F, 0xA0, 0xE7, 0x4A, 0xFF, 0xD7, 0x3A, 0xE9, 0x9A, 0xFA, 0x72, 0x9D, 0xA4, 0xE9, 0x72,
+    0xE5, 0xAD, 0x72, 0xE6, 0xE7, 0x2D, 0xA6, 0xDA, 0x71, 0xAD, 0x69, 0xD9, 0x71, 0xE6, 0xE7, 0x2D,
+    0xA5, 0x9E, 0x71, 0x9D, 0xA5, 0xEA, 0x71, 0xAD, 0x94, 0xAE, 0xA7, 0x1A, 0xDA, 0x39, 0xCA, 0xD9,
+    0x1A, 0x6A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x95, 0x9F, 0xAE, 0x1D, 0xAE, 0x7F, 0xE2, 0xFC, 0x70,
+    0x9F, 0xA3, 0xEA, 0x73, 0x99, 0x69, 0x72, 0x77, 0x74, 0x9A, 0xFF, 0xDA, 0x71, 0xAF, 0xFF, 0xDA,
+    0x7A, 0xA9, 0xAD, 0xA2, 0x9A, 0xFC, 0x71, 0xAD, 0x95, 0xAF, 0x70, 0xE7, 0x9E, 0xA7, 0xE7, 0x0A,
+    0xE6, 0x9E, 0x70, 0x9E, 0x95, 0xAD, 0xA7, 0x1E, 0xA5, 0xE9, 0x71, 0xEA, 0x5E, 0x72, 0xEA, 0x19,
+    0x99, 0xAE, 0x99, 0x99, 0x95, 0xEA, 0x1F, 0xFF, 0x5E, 0x91, 0xAA, 0xAF, 0xAA, 0xAA, 0xA5, 0xE9,
+    0x4E, 0x97, 0x19, 0xE5, 0xE7, 0x2E, 0xA4, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x1E, 0xA5, 0xAD, 0xA7,
+    0x0A, 0xE6, 0xE9, 0x7A, 0xE7, 0xE7, 0xF9, 0x69, 0xE9, 0x29, 0x9F, 0xC6, 0xAF, 0xFF, 0xD9, 0x6A,
+    0xFF, 0xEA, 0x97, 0x77, 0x71, 0x75, 0x99, 0x97, 0x59, 0xFC, 0xA7, 0x4F, 0xDA, 0x77, 0xAD, 0x97,
+    0x7E, 0x74, 0xAA, 0xAA, 0xEA, 0xA9, 0x70, 0xAF, 0xFC, 0x75, 0x9D, 0xA7, 0x7A, 0xD9, 0x71, 0x9A,
+    0xCA, 0x1E, 0x70, 0x9F, 0xDA, 0xE7, 0x9F, 0xAF, 0xCA, 0x69, 0xE3, 0xAE, 0x96, 0xE5, 0xE6, 0xAD,
+    0x95, 0xE6, 0xDA, 0x6D, 0xA5, 0xAD, 0x69, 0xD9, 0x5E, 0x6E, 0x6D, 0xA5, 0x9E, 0x59, 0xDA, 0x5E,
+    0xA5, 0xAD, 0x94, 0xAE, 0xA5, 0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA2, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A,
+    0xC9, 0x19, 0xFA, 0xE1, 0xDA, 0xE3, 0xFE, 0x2F, 0xC4, 0x9F, 0xA3, 0xEA, 0x79, 0x96, 0x96, 0x77,
+    0x76, 0xFF, 0xD7, 0x2F, 0xFC, 0xA7, 0x29, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x5F,
+    0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7,
+    0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA,
+    0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09,
+    0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99,
+    0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x30, 0x59, 0x99, 0x99, 0x99, 0x95,
+    0xFF, 0xD4, 0xFF, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x19, 0xFC, 0x96, 0xFF, 0x5E, 0x2A, 0xD9, 0x3D,
+    0xA3, 0x9D, 0x92, 0xAD, 0x4A, 0xD9, 0x2D, 0xA3, 0x9E, 0x2A, 0xD3, 0xAE, 0x3E, 0x19, 0xF3, 0x9E,
+    0xAF, 0xA4, 0x9F, 0xD9, 0x6A, 0xE9, 0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x6A, 0x29, 0xE4, 0x9D, 0x92,
+    0xFA, 0x9A, 0xEA, 0x3A, 0xFF, 0xA5, 0xAF, 0xCA, 0x71, 0x99, 0x70, 0x77, 0x76, 0x9C, 0x95, 0xA7,
+    0x2E, 0x4D, 0x72, 0xF9, 0x9A, 0xD9, 0x72, 0x9F, 0xEA, 0x74, 0x9F, 0xC9, 0x77, 0x09, 0x77, 0x77,
+    0x77, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D,
+    0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E,
+    0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E,
+    0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5,
+    0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x30, 0x77, 0x49, 0xC9,
+    0x5C, 0x5E, 0x39, 0xD5, 0xAE, 0xAA, 0xE9, 0x6F, 0xE9, 0x70, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x19,
+    0xFC, 0x97, 0xFF, 0x6E, 0x2A, 0xD9, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4A, 0xD9, 0x3D, 0xA3, 0x9E,
+    0x3A, 0xD3, 0xAE, 0x4E, 0x19, 0xF4, 0x9E, 0xAF, 0xA5, 0x9F, 0xD9, 0x7A, 0xE9, 0x72, 0xAD, 0x97,
+    0x3A, 0xD9, 0x6A, 0x39, 0xE4, 0x9D, 0x93, 0xFA, 0x9A, 0xEA, 0x4A, 0xFF, 0xA6, 0xAF, 0xCA, 0x72,
+    0x99, 0x71, 0x75, 0xAA, 0x97, 0x70, 0xF7, 0x79, 0xF7, 0x79, 0xEA, 0x77, 0x0A, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0xFF, 0xFE, 0xA4, 0xFF, 0xFE, 0xA5, 0x9A, 0xEA, 0xAA, 0xAA, 0xAE, 0x96, 0xAD,
+    0x96, 0xD9, 0x6E, 0x7D, 0x7E, 0x7C, 0xA6, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7,
+    0x71, 0xEA, 0xAA, 0xAE, 0xA7, 0x09, 0xFF, 0xD9, 0x70, 0xAE, 0xAA, 0xAA, 0xAA, 0xA7, 0x1E, 0x97,
+    0x70, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xDA, 0x70, 0x96, 0xAD, 0xA7, 0xD6, 0xE9, 0x69, 0xD6, 0xE7,
+    0xDA, 0x59, 0xE9, 0x99, 0xAA, 0xAA, 0xE9, 0x3A, 0xFF, 0xFE, 0x3A, 0xFF, 0xFE, 0xA3, 0x70, 0xAC,
+    0x97, 0x1F, 0x71, 0xF7, 0x1E, 0x97, 0x29, 0x77, 0x77, 0x77, 0x39, 0xFC, 0x95, 0xFF, 0x4E, 0x2A,
+    0xD9, 0x2D, 0xA3, 0x9D, 0x91, 0xAD, 0x4A, 0xD9, 0x1D, 0xA3, 0x9E, 0x1A, 0xD3, 0xAE, 0x2E, 0x19,
+    0xF2, 0x9E, 0xAF, 0xA3, 0x9F, 0xD9, 0x5A, 0xE9, 0x70, 0xAD, 0x97, 0x1A, 0xD9, 0x6A, 0x19, 0xE4,
+    0x9D, 0x91, 0xFA, 0x9A, 0xEA, 0x2A, 0xFF, 0xA4, 0xAF, 0xCA, 0x70, 0x99, 0x70, 0x4F, 0xFF, 0xEA,
+    0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7,
+    0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70,
+    0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70,
+    0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA,
+    0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x77, 0x0D, 0x97, 0x70, 0xD7, 0x71, 0xDA, 0x77,
+    0x1D, 0x97, 0x71, 0xEA, 0x99, 0x76, 0xFD, 0x77, 0xAD, 0xA4, 0x77, 0x39, 0xFC, 0x95, 0xFF, 0x4E,
+    0x2A, 0xD9, 0x2D, 0xA3, 0x9D, 0x91, 0xAD, 0x4A, 0xD9, 0x1D, 0xA3, 0x9E, 0x1A, 0xD3, 0xAE, 0x2E,
+    0x19, 0xF2, 0x9E, 0xAF, 0xA3, 0x9F, 0xD9, 0x5A, 0xE9, 0x70, 0xAD, 0x97, 0x1A, 0xD9, 0x6A, 0x19,
+    0xE4, 0x9D, 0x91, 0xFA, 0x9A, 0xEA, 0x2A, 0xFF, 0xA4, 0xAF, 0xD9, 0x79, 0x9D, 0x97, 0x1A, 0xCA,
+    0x72, 0xD7, 0x2A, 0xD7, 0x2A, 0xD9, 0x71, 0x9F, 0xC9, 0x79, 0xE9, 0x30, 0x71, 0xAA, 0x59, 0xA9,
+    0x71, 0x9D, 0x93, 0xAD, 0xA7, 0x2E, 0x2A, 0xDA, 0x73, 0xAE, 0x0A, 0xD9, 0x75, 0xFD, 0x97, 0x7F,
+    0x97, 0x71, 0xD9, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xEA, 0x5F, 0xFF, 0xEA, 0x69, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x7A, 0xD9, 0x6D, 0x97, 0xE7, 0xD7, 0x0E, 0x7C, 0xA7, 0x9E, 0x77, 0x1A, 0xDA, 0x77,
+    0x1E, 0x97, 0x71, 0xE7, 0x72, 0xEA, 0xAA, 0xAE, 0xA7, 0x19, 0xFF, 0xD9, 0x71, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x2E, 0x97, 0x71, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xDA, 0x70, 0x97, 0xAD, 0xA7, 0xD7,
+    0xE9, 0x69, 0xD7, 0xE7, 0xDA, 0x69, 0xE9, 0x99, 0xAA, 0xAA, 0xE9, 0x4A, 0xFF, 0xFE, 0x4A, 0xFF,
+    0xFE, 0xA4, 0x59, 0x59, 0xA5, 0xAC, 0xA3, 0xAD, 0x59, 0xD2, 0xAD, 0x96, 0xDA, 0x0A, 0xD9, 0x7A,
+    0xDA, 0xD9, 0x71, 0xFA, 0x72, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x29, 0xFC, 0x97, 0xFF, 0x6E, 0x2A,
+    0xD9, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4A, 0xD9, 0x3D, 0xA3, 0x9E, 0x3A, 0xD3, 0xAE, 0x4E, 0x19,
+    0xF4, 0x9E, 0xAF, 0xA5, 0x9F, 0xD9, 0x7A, 0xE9, 0x72, 0xAD, 0x97, 0x3A, 0xD9, 0x6A, 0x39, 0xE4,
+    0x9D, 0x93, 0xFA, 0x9A, 0xEA, 0x4A, 0xFF, 0xA6, 0xAF, 0xCA, 0x72, 0x99, 0x71, 0x77, 0x77, 0x09,
+    0xDA, 0x77, 0x9F, 0xA7, 0x59, 0xFD, 0xA7, 0x3A, 0xDA, 0x1E, 0x72, 0xAD, 0xA3, 0xDA, 0x71, 0xD9,
+    0x5C, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xEA, 0x97, 0x9F, 0xFF, 0xC5, 0xAF, 0xAA, 0x99, 0xAF, 0xC4,
+    0xAE, 0x97, 0xE3, 0xAE, 0x71, 0xDA, 0x29, 0xE7, 0x2D, 0x92, 0xE9, 0x72, 0xCA, 0x29, 0xE7, 0x70,
+    0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0xA7, 0xAF, 0xE9, 0xAD, 0xA7,
+    0xFF, 0x0E, 0xA7, 0x09, 0x9A, 0xE9, 0x0A, 0xE7, 0x3E, 0x1A, 0xE7, 0x29, 0xDA, 0x19, 0xEA, 0x71,
+    0xAD, 0x92, 0xF7, 0x1E, 0x39, 0xF9, 0x7E, 0x4A, 0xFC, 0xA9, 0x9A, 0xAF, 0xC5, 0xAF, 0xFF, 0xC9,
+    0x7A, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x10, 0x76, 0x99, 0x77, 0x2E, 0xA7, 0x70, 0xFC, 0x77, 0xAD,
+    0xAD, 0xA7, 0x5A, 0xD9, 0x0E, 0x74, 0x9D, 0x91, 0x9D, 0x97, 0x29, 0xD9, 0x3D, 0x97, 0x3A, 0x95,
+    0x97, 0x77, 0x77, 0x77, 0x9F, 0xFE, 0x70, 0xFF, 0xFA, 0x7E, 0x92, 0xE9, 0xA9, 0x7A, 0xD9, 0x3A,
+    0xD7, 0x2D, 0xA4, 0x9D, 0x71, 0x9D, 0x94, 0xAD, 0x71, 0xAD, 0x5E, 0x71, 0xAD, 0x93, 0xAD, 0x97,
+    0x19, 0xE2, 0xAD, 0x97, 0x3F, 0xF9, 0x75, 0xAF, 0xA7, 0x79, 0xD9, 0x77, 0x0A, 0xD7, 0x72, 0xE9,
+    0x77, 0x1F, 0xC9, 0x75, 0x9A, 0xFE, 0x97, 0x19, 0xFA, 0x9F, 0xD7, 0xAE, 0x94, 0xAF, 0x59, 0xE7,
+    0x9E, 0xA4, 0xAD, 0x97, 0x09, 0xDA, 0x4A, 0xDA, 0x70, 0xAD, 0x94, 0x9E, 0x96, 0xAE, 0x6F, 0xDA,
+    0xAA, 0xFC, 0x70, 0xAF, 0xFD, 0xA7, 0x39, 0xAA, 0xAA, 0xA9, 0x97, 0x10, 0x77, 0x75, 0xAC, 0x6A,
+    0x71, 0x9D, 0x93, 0x9C, 0xA7, 0x19, 0xEA, 0x99, 0xE7, 0x3F, 0xF7, 0x5A, 0xFA, 0x77, 0x09, 0x77,
+    0x77, 0x77, 0x71, 0x9A, 0xFE, 0xA9, 0x79, 0xFF, 0xFC, 0x5A, 0xFA, 0xA9, 0x9A, 0xFC, 0x4A, 0xE9,
+    0x7E, 0x3A, 0xE7, 0x1D, 0xA2, 0x9E, 0x72, 0xD9, 0x2E, 0x97, 0x2C, 0xA2, 0x9E, 0x77, 0x0E, 0x97,
+    0x70, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xDA, 0x7A, 0xFE, 0x9A, 0xDA, 0x7F, 0xF0,
+    0xEA, 0x70, 0x99, 0xAE, 0x90, 0xAE, 0x73, 0xE1, 0xAE, 0x72, 0x9D, 0xA1, 0x9E, 0xA7, 0x1A, 0xD9,
+    0x2F, 0x71, 0xE3, 0x9F, 0x97, 0xE4, 0xAF, 0xCA, 0x99, 0xAA, 0xFC, 0x5A, 0xFF, 0xFC, 0x97, 0xAF,
+    0xFA, 0x97, 0x49, 0x99, 0x71, 0x77, 0x77, 0x9C, 0xA5, 0xC9, 0x72, 0xAD, 0x39, 0xD7, 0x3A, 0xEA,
+    0xAE, 0x97, 0x4F, 0xE9, 0x76, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x79, 0xFF, 0xE7, 0x0F, 0xFF,
+    0xA7, 0xE9, 0x2E, 0x9A, 0x97, 0xAD, 0x93, 0xAD, 0x72, 0xDA, 0x49, 0xD7, 0x19, 0xD9, 0x4A, 0xD7,
+    0x1A, 0xD5, 0xE7, 0x1A, 0xD9, 0x3A, 0xD9, 0x71, 0x9E, 0x2A, 0xD9, 0x73, 0xFF, 0x97, 0x5A, 0xFA,
+    0x77, 0x9D, 0x97, 0x70, 0xAD, 0x77, 0x2E, 0x97, 0x71, 0xFC, 0x97, 0x59, 0xAF, 0xE9, 0x71, 0x9F,
+    0xA9, 0xFD, 0x7A, 0xE9, 0x4A, 0xF5, 0x9E, 0x79, 0xEA, 0x4A, 0xD9, 0x70, 0x9D, 0xA4, 0xAD, 0xA7,
+    0x0A, 0xD9, 0x49, 0xE9, 0x6A, 0xE6, 0xFD, 0xAA, 0xAF, 0xC7, 0x0A, 0xFF, 0xDA, 0x73, 0x9A, 0xAA,
+    0xAA, 0x99, 0x71, 0x73, 0x9A, 0xA7, 0x70, 0x9E, 0xA7, 0x7A, 0xEA, 0x77, 0xF7, 0x71, 0xAA, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x9A, 0xFE, 0xA9, 0x79, 0xFF, 0xFC, 0x5A, 0xFA, 0xA9, 0x9A, 0xFC, 0x4A,
+    0xE9, 0x7E, 0x3A, 0xE7, 0x1D, 0xA2, 0x9E, 0x72, 0xD9, 0x2E, 0x97, 0x2C, 0xA2, 0x9E, 0x77, 0x0E,
+    0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xDA, 0x7A, 0xFE, 0x9A, 0xDA, 0x7F,
+    0xF0, 0xEA, 0x70, 0x99, 0xAE, 0x90, 0xAE, 0x73, 0xE1, 0xAE, 0x72, 0x9D, 0xA1, 0x9E, 0xA7, 0x1A,
+    0xD9, 0x2F, 0x71, 0xE3, 0x9F, 0x97, 0xE4, 0xAF, 0xCA, 0x99, 0xAA, 0xFC, 0x5A, 0xFF, 0xFC, 0x97,
+    0xAF, 0xFA, 0x97, 0x49, 0x99, 0x71, 0x75, 0xAC, 0xA7, 0x71, 0xAE, 0x77, 0x1F, 0x77, 0x1E, 0x97,
+    0x72, 0x97, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xFE, 0x70, 0xFF, 0xFA, 0x7E, 0x92, 0xE9, 0xA9,
+    0x7A, 0xD9, 0x3A, 0xD7, 0x2D, 0xA4, 0x9D, 0x71, 0x9D, 0x94, 0xAD, 0x71, 0xAD, 0x5E, 0x71, 0xAD,
+    0x93, 0xAD, 0x97, 0x19, 0xE2, 0xAD, 0x97, 0x3F, 0xF9, 0x75, 0xAF, 0xA7, 0x79, 0xD9, 0x77, 0x0A,
+    0xD7, 0x72, 0xE9, 0x77, 0x1F, 0xC9, 0x75, 0x9A, 0xFE, 0x97, 0x19, 0xFA, 0x9F, 0xD7, 0xAE, 0x94,
+    0xAF, 0x59, 0xE7, 0x9E, 0xA4, 0xAD, 0x97, 0x09, 0xDA, 0x4A, 0xDA, 0x70, 0xAD, 0x94, 0x9E, 0x96,
+    0xAE, 0x6F, 0xDA, 0xAA, 0xFC, 0x70, 0xAF, 0xFD, 0xA7, 0x39, 0xAA, 0xAA, 0xA9, 0x97, 0x10, 0x77,
+    0x74, 0x9A, 0xFE, 0xA9, 0x79, 0xFF, 0xFC, 0x5A, 0xFA, 0xA9, 0x9A, 0xFC, 0x4A, 0xE9, 0x7E, 0x3A,
+    0xE7, 0x1D, 0xA2, 0x9E, 0x72, 0xD9, 0x2E, 0x97, 0x2C, 0xA2, 0x9E, 0x77, 0x0E, 0x97, 0x70, 0xE7,
+    0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xDA, 0x7A, 0xFE, 0x9A, 0xDA, 0x7F, 0xF0, 0xEA, 0x70,
+    0x99, 0xAE, 0x90, 0xAE, 0x73, 0xE1, 0xAE, 0x72, 0x9D, 0xA1, 0x9E, 0xA7, 0x1A, 0xD9, 0x2F, 0x71,
+    0xE3, 0x9F, 0x97, 0xE4, 0xAF, 0xCA, 0x99, 0xAA, 0xFC, 0x5A, 0xFF, 0xFC, 0x97, 0xAF, 0xFA, 0x97,
+    0x49, 0x99, 0x77, 0x77, 0x5E, 0x97, 0x70, 0xAE, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xD7, 0x70, 0x9D,
+    0xA7, 0x70, 0xD9, 0x77, 0x09, 0xA7, 0x50, 0x77, 0xAA, 0x77, 0x19, 0xD9, 0x77, 0x1D, 0xA7, 0x71,
+    0xAD, 0x77, 0x2D, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xEA, 0x77, 0x1A, 0xE7, 0x72, 0xDA, 0x77, 0x77,
+    0x77, 0x72, 0x9F, 0xFE, 0x70, 0xFF, 0xFA, 0x7E, 0x92, 0xE9, 0xA9, 0x7A, 0xD9, 0x3A, 0xD7, 0x2D,
+    0xA4, 0x9D, 0x71, 0x9D, 0x94, 0xAD, 0x71, 0xAD, 0x5E, 0x71, 0xAD, 0x93, 0xAD, 0x97, 0x19, 0xE2,
+    0xAD, 0x97, 0x3F, 0xF9, 0x75, 0xAF, 0xA7, 0x79, 0xD9, 0x77, 0x0A, 0xD7, 0x72, 0xE9, 0x77, 0x1F,
+    0xC9, 0x75, 0x9A, 0xFE, 0x97, 0x19, 0xFA, 0x9F, 0xD7, 0xAE, 0x94, 0xAF, 0x59, 0xE7, 0x9E, 0xA4,
+    0xAD, 0x97, 0x09, 0xDA, 0x4A, 0xDA, 0x70, 0xAD, 0x94, 0x9E, 0x96, 0xAE, 0x6F, 0xDA, 0xAA, 0xFC,
+    0x70, 0xAF, 0xFD, 0xA7, 0x39, 0xAA, 0xAA, 0xA9, 0x97, 0x10, 0x77, 0x77, 0x74, 0x9E, 0x77, 0x79,
+    0xFC, 0x77, 0x59, 0xFD, 0xA7, 0x73, 0x9E, 0x1E, 0x97, 0x71, 0x9E, 0x3E, 0x77, 0x1A, 0xCA, 0x5C,
+    0x97, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xA4, 0xAF, 0xF5, 0xFF, 0x94, 0xFF, 0xA6, 0x9A, 0xE9, 0x70,
+    0xAE, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0xA7, 0x2E, 0x97, 0x1E, 0x97, 0x2E, 0x72, 0xE7, 0x29, 0xE7,
+    0x2E, 0x72, 0xAD, 0xA7, 0x19, 0xDA, 0x72, 0xE9, 0x71, 0xAD, 0xA7, 0x2E, 0x72, 0xE9, 0x72, 0xFF,
+    0xFF, 0xC7, 0x29, 0xFF, 0xFF, 0xC7, 0x2A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA7, 0x2E,
+    0x97, 0x1A, 0xD9, 0x72, 0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x19, 0xE7, 0x2A,
+    0xDA, 0x71, 0xAD, 0xA7, 0x2E, 0x97, 0x1E, 0x97, 0x2E, 0x72, 0xE7, 0x29, 0xE7, 0x19, 0xE9, 0x7A,
+    0xFE, 0x94, 0xAF, 0xEA, 0x4A, 0xFF, 0x49, 0xFF, 0x94, 0x69, 0x9A, 0x75, 0x9E, 0xA7, 0x39, 0xFC,
+    0xA7, 0x19, 0xE9, 0xE7, 0x0A, 0xE1, 0x9D, 0xA6, 0xAD, 0xA3, 0x9D, 0x79, 0x69, 0x77, 0x74, 0x99,
+    0x97, 0x3A, 0xFC, 0x97, 0x2F, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7,
+    0x6E, 0x76, 0xDA, 0x29, 0xF5, 0x9D, 0x91, 0xFD, 0xA4, 0xAD, 0x1E, 0xAF, 0x4E, 0x0D, 0xA2, 0xE4,
+    0xDA, 0xAC, 0xA3, 0xDA, 0x39, 0xDA, 0xD3, 0x9D, 0x93, 0xAF, 0x4A, 0xD4, 0xF9, 0x4E, 0x4F, 0x5D,
+    0xA4, 0xE5, 0x9D, 0x93, 0x9E, 0x5A, 0xD4, 0xAD, 0x95, 0xE4, 0xE6, 0xDA, 0x1A, 0x1E, 0x59, 0xD9,
+    0x0A, 0xC9, 0x9D, 0xA5, 0xAF, 0xD0, 0xAD, 0x95, 0xAF, 0xC1, 0xE6, 0x9E, 0xA7, 0x69, 0x40, 0x4F,
+    0xFA, 0x4A, 0xFF, 0x5F, 0xF9, 0x4F, 0xFA, 0x69, 0xAE, 0x97, 0x0A, 0xE9, 0x71, 0xAD, 0x97, 0x1A,
+    0xDA, 0x72, 0xE7, 0x2E, 0x96, 0x9F, 0xFF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFF, 0xFE, 0x96, 0xAD, 0xA7,
+    0x19, 0xDA, 0x72, 0xE9, 0x71, 0xAD, 0xA7, 0x2E, 0x72, 0xE9, 0x72, 0xFF, 0xFF, 0xC7, 0x29, 0xFF,
+    0xFF, 0xC7, 0x2A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA7, 0x2E, 0x97, 0x1A, 0xD9, 0x72,
+    0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0x72, 0x9D, 0xA7, 0x19, 0xE7, 0x2A, 0xDA, 0x71, 0xAD, 0xA7,
+    0x2E, 0x97, 0x1E, 0x97, 0x2E, 0x72, 0xE7, 0x29, 0xE7, 0x19, 0xE9, 0x7A, 0xFE, 0x94, 0xAF, 0xEA,
+    0x4A, 0xFF, 0x49, 0xFF, 0x94, 0x49, 0x99, 0x73, 0xAF, 0xC9, 0x72, 0xFD, 0x97, 0x5E, 0x76, 0xE7,
+    0x2A, 0xAA, 0xFA, 0xAA, 0x96, 0xFF, 0xD9, 0x71, 0xE7, 0x6E, 0x76, 0xDA, 0x3A, 0xAA, 0x95, 0x9D,
+    0x91, 0x9F, 0xC9, 0x4A, 0xD1, 0xAF, 0xE4, 0xE0, 0xAD, 0x90, 0x9E, 0x4D, 0xAA, 0xD2, 0x9D, 0xA3,
+    0x9D, 0xAD, 0x39, 0xD9, 0x3A, 0xF4, 0xAD, 0x93, 0xFA, 0x4E, 0x4F, 0x5D, 0xA4, 0xE9, 0x49, 0xD9,
+    0x39, 0xE5, 0xAD, 0x4A, 0xD9, 0x5E, 0x4E, 0x6D, 0xA1, 0xA1, 0xE5, 0x9D, 0x90, 0xAC, 0x99, 0xDA,
+    0x5A, 0xFD, 0x0A, 0xD9, 0x5A, 0xFC, 0x1E, 0x69, 0xEA, 0x76, 0x94, 0x6A, 0xD9, 0x2C, 0x95, 0xAF,
+    0x90, 0x9C, 0xA4, 0x9F, 0xFC, 0xA4, 0x9C, 0xA1, 0xFC, 0x6C, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x6F,
+    0xFC, 0x6F, 0xF9, 0x79, 0xAE, 0x97, 0x2A, 0xD9, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA,
+    0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x1A, 0xFE, 0x95, 0xAF, 0xF9, 0x50,
+    0x49, 0x71, 0x9E, 0xA1, 0x9C, 0x29, 0xFC, 0x90, 0xD9, 0x1E, 0x0F, 0xD2, 0xD2, 0xF4, 0x93, 0xA9,
+    0x77, 0x77, 0x72, 0x9A, 0xF6, 0xFD, 0x95, 0x99, 0x9E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97,
+    0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAD, 0xA1, 0xA5, 0xE9,
+    0x0D, 0x5F, 0xDA, 0x5F, 0xCA, 0x6F, 0x97, 0x09, 0x71, 0x77, 0x5F, 0xFC, 0xA4, 0x9F, 0xFC, 0x95,
+    0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x75, 0xFF, 0xC6, 0xFF, 0x97, 0x9A, 0xE9, 0x72, 0xAD,
+    0x97, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x74, 0xE7, 0x39, 0xE7,
+    0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E,
+    0x73, 0x9E, 0x71, 0xAF, 0xE9, 0x5A, 0xFF, 0x95, 0x29, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xC2,
+    0xAF, 0xFC, 0x77, 0x77, 0x77, 0x59, 0xAF, 0x6F, 0xD9, 0x59, 0x99, 0xE7, 0x1E, 0x70, 0x9D, 0xA7,
+    0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xDA,
+    0x1A, 0x5E, 0x90, 0xD5, 0xFD, 0xA5, 0xFC, 0xA6, 0xF9, 0x70, 0x97, 0x10, 0x77, 0x5A, 0xC6, 0xC5,
+    0xDA, 0x4C, 0xA5, 0xEA, 0x99, 0xAD, 0x95, 0xAF, 0xE9, 0x7A, 0xFC, 0x73, 0x97, 0x77, 0x77, 0x2F,
+    0xFC, 0x6F, 0xF9, 0x79, 0xAE, 0x97, 0x2A, 0xD9, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA,
+    0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x1A, 0xFE, 0x95, 0xAF, 0xF9, 0x50,
+    0x77, 0xD5, 0xA9, 0x19, 0xD9, 0x3A, 0xC9, 0x19, 0xFA, 0xEA, 0x3A, 0xFD, 0xA5, 0x9E, 0xA9, 0x77,
+    0x77, 0x72, 0x9A, 0xF6, 0xFD, 0x95, 0x99, 0x9E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E,
+    0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAD, 0xA1, 0xA5, 0xE9, 0x0D,
+    0x5F, 0xDA, 0x5F, 0xCA, 0x6F, 0x97, 0x09, 0x71, 0x4F, 0xFC, 0x5F, 0xF9, 0x69, 0xAE, 0x97, 0x1A,
+    0xD9, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x3E, 0x72, 0x9E,
+    0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x2A, 0xDA, 0x72, 0xE9, 0x72,
+    0xE7, 0x29, 0xE7, 0x0A, 0xFE, 0x94, 0xAF, 0xF9, 0x71, 0x9C, 0xA7, 0x2A, 0xCA, 0x73, 0xD7, 0x3A,
+    0xD7, 0x3A, 0xE9, 0x99, 0x70, 0xFC, 0xA7, 0x09, 0xEA, 0x50, 0x69, 0x7E, 0x5A, 0xE9, 0x4F, 0x5A,
+    0xD9, 0x77, 0x77, 0x71, 0x9A, 0xF3, 0xFD, 0x92, 0x99, 0x9E, 0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E,
+    0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x59, 0xE5, 0xAD, 0xA1, 0xA2, 0xE9, 0x0D, 0x2F, 0xDA, 0x2F,
+    0xCA, 0x3F, 0xA5, 0xAC, 0xA5, 0x9C, 0xA6, 0xD6, 0x9D, 0x69, 0xDA, 0x6F, 0xC9, 0x39, 0xE9, 0x30,
+    0x71, 0xAA, 0x73, 0xF7, 0x1A, 0xF7, 0x1A, 0xE9, 0x72, 0xAA, 0x97, 0x77, 0x77, 0x74, 0xFF, 0xC5,
+    0xFF, 0x96, 0x9A, 0xE9, 0x71, 0xAD, 0x97, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E,
+    0x97, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x29, 0xDA,
+    0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x70, 0xAF, 0xE9, 0x4A, 0xFF, 0x94, 0x71, 0x9A,
+    0xF2, 0xFD, 0x91, 0x99, 0x9E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9, 0x4E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9,
+    0x4E, 0x49, 0xE4, 0xAD, 0xA1, 0xA1, 0xE9, 0x0D, 0x1F, 0xDA, 0x1F, 0xCA, 0x2F, 0x94, 0x95, 0x4F,
+    0xFC, 0x2A, 0xFF, 0x94, 0xFF, 0x92, 0xFF, 0xC6, 0x9A, 0xE9, 0x69, 0xEA, 0x71, 0xAD, 0x97, 0x0E,
+    0x72, 0xE9, 0x79, 0xE7, 0x2E, 0x70, 0xAD, 0xA7, 0x19, 0xE7, 0x0E, 0x97, 0x1A, 0xDA, 0x70, 0xE7,
+    0x2E, 0x97, 0x0E, 0x72, 0xE7, 0x09, 0xE7, 0x2E, 0x70, 0xAD, 0xA7, 0x19, 0xE7, 0x0E, 0x97, 0x1A,
+    0xDA, 0x70, 0xE7, 0x2E, 0x97, 0x9E, 0x72, 0xE7, 0x09, 0xDA, 0x71, 0x9E, 0x70, 0xAD, 0xA7, 0x19,
+    0xDA, 0x70, 0xE9, 0x71, 0xAD, 0xA7, 0x0E, 0x72, 0xE9, 0x79, 0xE7, 0x2E, 0x70, 0xAD, 0xA7, 0x19,
+    0xE7, 0x0E, 0x97, 0xAF, 0xE9, 0x5E, 0x7A, 0xFF, 0x94, 0x9E, 0x77, 0x6A, 0xD9, 0x77, 0x6E, 0x77,
+    0x09, 0xC3, 0xEA, 0x77, 0x0F, 0xAF, 0x77, 0x1F, 0xF7, 0x72, 0x9F, 0xC9, 0x77, 0x77, 0x60, 0x69,
+    0x71, 0x96, 0xE6, 0xAE, 0x4A, 0xE9, 0x5F, 0x4F, 0x59, 0xEA, 0x4A, 0xD9, 0x6E, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x19, 0xAF, 0x49, 0xAE, 0xA2, 0xFD, 0x92, 0x9F, 0xD2, 0x99, 0x9E, 0x49, 0x99, 0xDA,
+    0x5E, 0x69, 0xD9, 0x49, 0xDA, 0x6A, 0xD9, 0x4A, 0xD9, 0x6E, 0x5E, 0x7E, 0x5E, 0x7D, 0xA4, 0x9D,
+    0xA6, 0x9D, 0x94, 0xAD, 0x96, 0xAD, 0x5E, 0x7E, 0x49, 0xE7, 0xE4, 0xAD, 0xA1, 0xA3, 0x9D, 0xA4,
+    0xE9, 0x0D, 0x3A, 0xD9, 0x4F, 0xDA, 0x3E, 0x5F, 0xCA, 0x4E, 0x5F, 0x94, 0xAD, 0x96, 0x97, 0xE7,
+    0x70, 0xDA, 0x77, 0xAD, 0x97, 0x29, 0x3E, 0x72, 0xAC, 0xA0, 0x9E, 0x73, 0xFE, 0x97, 0x3F, 0xD9,
+    0x75, 0xAA, 0xA9, 0x72, 0x77, 0x77, 0x4E, 0x77, 0x1F, 0xC7, 0x7F, 0xE7, 0x5E, 0x90, 0xAD, 0xA7,
+    0x29, 0xE3, 0xAD, 0x72, 0xAC, 0xA5, 0xAA, 0x77, 0x77, 0x77, 0x6F, 0xFC, 0x74, 0xFF, 0xA7, 0x59,
+    0xAE, 0x97, 0x70, 0x9D, 0xA7, 0x71, 0xAD, 0xA7, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71,
+    0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71,
+    0xE9, 0x77, 0x1E, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE9, 0x77, 0x1E, 0x77,
+    0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE7, 0x71, 0x9D, 0xA7, 0x3A, 0xA3, 0xE7, 0x39, 0xEA, 0xF9,
+    0x73, 0x9F, 0xEA, 0x75, 0xAF, 0xA7, 0x77, 0x74, 0x75, 0x99, 0x77, 0xEA, 0x75, 0xFC, 0x74, 0xAD,
+    0xAD, 0xA7, 0x2A, 0xD9, 0x0E, 0x71, 0x9D, 0x91, 0x9D, 0x97, 0x9D, 0x93, 0xAC, 0x97, 0x0A, 0x95,
+    0x97, 0x77, 0x77, 0x69, 0xAF, 0x74, 0xFD, 0x74, 0x99, 0x9E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0x9D,
+    0x97, 0x6A, 0xD7, 0x7E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xDA,
+    0x76, 0xAD, 0x97, 0x6E, 0x77, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x76, 0x9D, 0xA7, 0x19, 0x3E, 0x71,
+    0x9C, 0xA9, 0x9A, 0xD9, 0x71, 0xFE, 0xA7, 0x2A, 0xFC, 0xA7, 0x49, 0xAA, 0x97, 0x50, 0x4F, 0xFA,
+    0x2F, 0xF4, 0xFF, 0x91, 0x9F, 0xE9, 0x59, 0xAE, 0x95, 0xF9, 0x70, 0xAD, 0x95, 0xEA, 0x72, 0xE9,
+    0x4E, 0xA7, 0x3E, 0x4E, 0x97, 0x39, 0xE2, 0x9E, 0x97, 0x4A, 0xDA, 0x19, 0xE7, 0x6E, 0x90, 0xAD,
+    0xA7, 0x7E, 0x0A, 0xDA, 0x77, 0x0F, 0xD9, 0x77, 0x09, 0xFD, 0x97, 0x70, 0xAD, 0xAA, 0xE7, 0x70,
+    0xE9, 0x0E, 0xA7, 0x7E, 0x19, 0xE9, 0x75, 0x9E, 0x2A, 0xE7, 0x59, 0xDA, 0x3F, 0x74, 0xAD, 0xA3,
+    0x9E, 0xA7, 0x3E, 0x94, 0xAE, 0xA7, 0x2E, 0x6F, 0xA7, 0x09, 0xE7, 0xFC, 0x5A, 0xFF, 0x5F, 0xC9,
+    0x2A, 0xFF, 0xC6, 0xAF, 0x77, 0x59, 0x97, 0x69, 0x77, 0x6E, 0x77, 0x5E, 0x97, 0x74, 0xE9, 0x77,
+    0x4E, 0x77, 0x4A, 0xD7, 0x74, 0x9D, 0x77, 0x59, 0x97, 0x60, 0x49, 0x99, 0x71, 0x9F, 0xD7, 0x0A,
+    0xFC, 0xA7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x74, 0xAD,
+    0x19, 0xFA, 0x4D, 0xA0, 0xAF, 0xD9, 0x3D, 0xAD, 0xA1, 0xAD, 0x92, 0x9F, 0x92, 0x9D, 0x92, 0xAE,
+    0x93, 0xAD, 0x3E, 0xA3, 0x9D, 0xA3, 0xE3, 0x9E, 0x39, 0xD9, 0x19, 0xEA, 0x4A, 0xFF, 0x95, 0xFE,
+    0x97, 0xE0, 0xE7, 0x0D, 0xA0, 0x9D, 0xA6, 0x9D, 0x91, 0xEA, 0x5A, 0xD2, 0x9E, 0xA4, 0xE3, 0xAF,
+    0x92, 0xE4, 0xAF, 0xD9, 0xD9, 0x59, 0xF9, 0x73, 0x99, 0x70, 0x97, 0x4A, 0xDA, 0x73, 0x9E, 0x73,
+    0x9D, 0xA7, 0x39, 0xD9, 0x73, 0xDA, 0x73, 0xDA, 0x74, 0xA9, 0x71, 0x77, 0x19, 0xAE, 0xA4, 0xF0,
+    0x9F, 0xCA, 0x29, 0xFC, 0x19, 0x99, 0xDA, 0x19, 0xFD, 0x39, 0xD9, 0x09, 0xDA, 0x79, 0xD0, 0x9D,
+    0x97, 0x0A, 0xD0, 0xD9, 0x71, 0xDA, 0xD9, 0x72, 0xFC, 0x72, 0x9F, 0xC9, 0x71, 0xAD, 0xAD, 0xA7,
+    0x1E, 0x0A, 0xD7, 0x1E, 0x1D, 0xA7, 0x9D, 0xA1, 0xE9, 0x39, 0x1A, 0xD9, 0x19, 0xE2, 0xCA, 0x1A,
+    0xD3, 0xFA, 0xD9, 0x1E, 0x4F, 0xCA, 0x2D, 0xA4, 0x9E, 0xA7, 0x59, 0x40, 0x75, 0x97, 0x70, 0xAC,
+    0x76, 0x9E, 0x97, 0x4F, 0xC7, 0x3A, 0xFC, 0x97, 0x29, 0xEA, 0x76, 0x97, 0x77, 0x77, 0x74, 0xFF,
+    0xC7, 0x1F, 0xFA, 0x72, 0x9A, 0xE9, 0x75, 0xAD, 0x97, 0x6E, 0x97, 0x6E, 0x76, 0x9E, 0x76, 0xAD,
+    0xA7, 0x6E, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE7, 0x69, 0xE7,
+    0x69, 0xDA, 0x70, 0xCA, 0x3A, 0xDA, 0x7A, 0xCA, 0x3E, 0x97, 0xD9, 0x3E, 0x7A, 0xD3, 0x9E, 0x99,
+    0x9A, 0xAA, 0xAA, 0xDA, 0x1A, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xF1, 0x77, 0x4A, 0xC7, 0xAE, 0x94,
+    0xAF, 0xC9, 0x29, 0xFD, 0x93, 0xEA, 0x97, 0x77, 0x70, 0x99, 0x95, 0xAF, 0xC9, 0x4F, 0xD9, 0x7A,
+    0xD7, 0x0E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70,
+    0xE7, 0x0D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x19, 0x94,
+    0xE0, 0x9C, 0xA3, 0x9F, 0xD9, 0x39, 0xFC, 0x95, 0xF7, 0x09, 0x70, 0x4F, 0xFC, 0x71, 0xFF, 0xA7,
+    0x29, 0xAE, 0x97, 0x5A, 0xD9, 0x76, 0xE9, 0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76,
+    0xE7, 0x7E, 0x76, 0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0x97, 0x6E, 0x76, 0x9E, 0x76, 0x9D, 0xA7, 0x0C,
+    0xA3, 0xAD, 0xA7, 0xAC, 0xA3, 0xE9, 0x7D, 0x93, 0xE7, 0xAD, 0x39, 0xE9, 0x99, 0xAA, 0xAA, 0xAD,
+    0xA1, 0xAF, 0xFF, 0xE9, 0x0A, 0xFF, 0xFF, 0x77, 0x75, 0x97, 0x7A, 0xE7, 0x69, 0xE7, 0x7E, 0x76,
+    0x9D, 0x97, 0x6E, 0x76, 0xDA, 0x77, 0xA9, 0x72, 0x69, 0x99, 0x4A, 0xFC, 0x93, 0xFD, 0x96, 0xAD,
+    0x7E, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E, 0x7D, 0xA6,
+    0x9D, 0x96, 0xAD, 0x7E, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x19, 0x93, 0xE0, 0x9C, 0xA2, 0x9F,
+    0xD9, 0x29, 0xFC, 0x94, 0xF7, 0x97, 0x19, 0x7E, 0x96, 0xAD, 0xA6, 0x9D, 0xA6, 0xAD, 0x69, 0xD9,
+    0x6D, 0x96, 0x9A, 0x70, 0x77, 0x09, 0x97, 0x71, 0xD9, 0x77, 0x9D, 0x94, 0xFF, 0xC1, 0xAD, 0x5F,
+    0xFA, 0x1D, 0xA6, 0x9A, 0xE9, 0x3D, 0x97, 0xAD, 0x94, 0xD7, 0x0E, 0x93, 0x9C, 0x97, 0x0E, 0x59,
+    0x70, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E,
+    0x97, 0x7E, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x0C, 0xA4, 0xAD, 0xA7, 0xAC, 0xA4, 0xE9, 0x7D, 0x94,
+    0xE7, 0xAD, 0x49, 0xE9, 0x99, 0xAA, 0xAA, 0xAD, 0xA2, 0xAF, 0xFF, 0xE9, 0x1A, 0xFF, 0xFF, 0x20,
+    0x73, 0x97, 0x49, 0xD7, 0x39, 0xD9, 0x49, 0x99, 0x2A, 0xD2, 0xAF, 0xC9, 0x1D, 0xA2, 0xFD, 0x91,
+    0xD6, 0xAD, 0x19, 0xCA, 0x6E, 0x19, 0xC7, 0xE2, 0x96, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E,
+    0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E,
+    0x73, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x19, 0x97, 0xE0, 0x9C, 0xA6, 0x9F, 0xD9, 0x69,
+    0xFC, 0x97, 0x0F, 0x73, 0x97, 0x30, 0x4F, 0xFC, 0x72, 0xFF, 0xA7, 0x39, 0xAE, 0x97, 0x6A, 0xD9,
+    0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x69, 0x96, 0xE9, 0x5E, 0x95, 0xE5, 0xF9, 0x5E,
+    0x5F, 0x59, 0xE5, 0x9D, 0x95, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x0C,
+    0xA4, 0xAD, 0xA7, 0xAC, 0xA4, 0xE9, 0x7D, 0x94, 0xE7, 0xAD, 0x49, 0xE9, 0x99, 0xAA, 0xAA, 0xAD,
+    0xA2, 0xAF, 0xFF, 0xE9, 0x1A, 0xFF, 0xFF, 0x20, 0x49, 0x99, 0x7A, 0xFC, 0x96, 0xFD, 0x97, 0x1A,
+    0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD,
+    0x93, 0x94, 0xE3, 0xE3, 0xE2, 0xF3, 0xDA, 0x2F, 0x29, 0xD9, 0x2A, 0xD3, 0xAD, 0x72, 0xE7, 0x2E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE1, 0x99, 0x6E, 0x09, 0xCA, 0x59, 0xFD, 0x95, 0x9F, 0xC9,
+    0x7F, 0x72, 0x97, 0x20, 0x4F, 0xFC, 0x71, 0xFF, 0xA7, 0x29, 0xAE, 0x97, 0x5A, 0xD9, 0x76, 0xE9,
+    0x76, 0xE7, 0x69, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x09, 0xCA, 0x72, 0xEA, 0xEA, 0x72, 0xFC, 0xA7,
+    0x3A, 0xEA, 0x72, 0x9A, 0xFA, 0x72, 0xFE, 0x97, 0x2A, 0xC9, 0x0E, 0x76, 0x9E, 0x76, 0x9D, 0xA7,
+    0x0C, 0xA3, 0xAD, 0xA7, 0xAC, 0xA3, 0xE9, 0x7D, 0x93, 0xE7, 0xAD, 0x39, 0xE9, 0x99, 0xAA, 0xAA,
+    0xAD, 0xA1, 0xAF, 0xFF, 0xE9, 0x0A, 0xFF, 0xFF, 0x10, 0x69, 0x99, 0x6A, 0xFC, 0x95, 0xFD, 0x97,
+    0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x9C,
+    0xA5, 0xAF, 0xC9, 0x5F, 0xA6, 0x9E, 0x96, 0xAE, 0xA5, 0xAF, 0xC9, 0x5D, 0x9A, 0xD7, 0x1E, 0x71,
+    0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x19, 0x95, 0xE0, 0x9C, 0xA4, 0x9F, 0xD9, 0x49, 0xFC,
+    0x96, 0xF7, 0x19, 0x70, 0x77, 0x39, 0x77, 0x71, 0xD7, 0x77, 0xAE, 0x77, 0x59, 0xFC, 0x77, 0x4A,
+    0xFA, 0x77, 0x4A, 0xEA, 0x77, 0x69, 0x97, 0x77, 0x77, 0x77, 0x77, 0x1F, 0xC9, 0x7F, 0xF5, 0xFC,
+    0xA7, 0xFE, 0xA6, 0x9F, 0x71, 0xAD, 0x97, 0x1F, 0xA7, 0x0E, 0x72, 0xFC, 0x70, 0xDA, 0x72, 0xFC,
+    0xA7, 0xDA, 0x71, 0x9D, 0xAE, 0x69, 0xD9, 0x71, 0xAD, 0x0E, 0x95, 0xAD, 0x72, 0xE0, 0xAE, 0x5E,
+    0x72, 0xDA, 0x1E, 0x94, 0xDA, 0x71, 0x9D, 0x91, 0xAD, 0xA4, 0xD9, 0x71, 0x9D, 0x3E, 0x39, 0xD9,
+    0x71, 0xAD, 0x3A, 0xDA, 0x2A, 0xD7, 0x2E, 0x4E, 0x2E, 0x72, 0xDA, 0x4E, 0xA1, 0xDA, 0x71, 0x9D,
+    0x94, 0x9E, 0x1D, 0x97, 0x1A, 0xD6, 0xE9, 0x9D, 0x72, 0xE6, 0x9E, 0xAD, 0x72, 0xE7, 0xFD, 0x72,
+    0xDA, 0x79, 0xFA, 0x71, 0x9D, 0x97, 0x0F, 0x97, 0xAF, 0xDA, 0x6A, 0xE7, 0xAF, 0xEA, 0x7E, 0x77,
+    0x70, 0x97, 0x10, 0x74, 0xA9, 0x77, 0x9D, 0x97, 0x6E, 0x76, 0xE9, 0x75, 0xAD, 0x97, 0x59, 0xD9,
+    0x76, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x3A, 0xEA, 0x29, 0xFC, 0xA1, 0x9F, 0xD9,
+    0x29, 0x99, 0xDA, 0x09, 0xEA, 0xEA, 0x49, 0xD9, 0x9D, 0x91, 0xAD, 0x94, 0x9D, 0x9D, 0x92, 0xAD,
+    0x94, 0xAD, 0xAC, 0x93, 0xE5, 0xFA, 0x4E, 0x5F, 0x49, 0xDA, 0x49, 0xE9, 0x4A, 0xD9, 0x4A, 0xE5,
+    0xE5, 0xE9, 0x5E, 0x5E, 0x59, 0xDA, 0x49, 0xDA, 0x5A, 0xD9, 0x1A, 0x1A, 0xD9, 0x5E, 0x09, 0xD1,
+    0xAD, 0x6E, 0xAD, 0xA1, 0xE6, 0xFC, 0xA2, 0xDA, 0x6A, 0xE9, 0x76, 0x95, 0x4F, 0xC9, 0x7F, 0xF5,
+    0xFC, 0xA7, 0xFE, 0xA6, 0x9F, 0x71, 0xAD, 0x97, 0x1F, 0xA7, 0x0E, 0x72, 0xFC, 0x70, 0xDA, 0x72,
+    0xFC, 0xA7, 0xDA, 0x71, 0x9D, 0xAE, 0x69, 0xD9, 0x71, 0xAD, 0x0E, 0x95, 0xAD, 0x72, 0xE0, 0xAE,
+    0x5E, 0x72, 0xDA, 0x1E, 0x94, 0xDA, 0x71, 0x9D, 0x91, 0xAD, 0xA4, 0xD9, 0x71, 0x9D, 0x3E, 0x39,
+    0xD9, 0x71, 0xAD, 0x3A, 0xDA, 0x2A, 0xD7, 0x2E, 0x4E, 0x2E, 0x72, 0xDA, 0x4E, 0xA1, 0xDA, 0x71,
+    0x9D, 0x94, 0x9E, 0x1D, 0x97, 0x1A, 0xD6, 0xE9, 0x9D, 0x72, 0xE6, 0x9E, 0xAD, 0x72, 0xE7, 0xFD,
+    0x72, 0xDA, 0x79, 0xFA, 0x71, 0x9D, 0x97, 0x0F, 0x97, 0xAF, 0xDA, 0x6A, 0xE7, 0xAF, 0xEA, 0x7E,
+    0x77, 0x70, 0x97, 0x74, 0x97, 0x77, 0x1E, 0x77, 0x70, 0xEA, 0x77, 0x7E, 0x97, 0x77, 0xE7, 0x77,
+    0xAD, 0x97, 0x76, 0x9D, 0x97, 0x77, 0x99, 0x77, 0x10, 0x77, 0x39, 0xAE, 0xA3, 0xAE, 0xA2, 0x9F,
+    0xCA, 0x19, 0xFD, 0x92, 0x99, 0x9D, 0xA0, 0x9E, 0xAE, 0xA4, 0x9D, 0x99, 0xD9, 0x1A, 0xD9, 0x49,
+    0xD9, 0xD9, 0x2A, 0xD9, 0x4A, 0xDA, 0xC9, 0x3E, 0x5F, 0xA4, 0xE5, 0xF4, 0x9D, 0xA4, 0x9E, 0x94,
+    0xAD, 0x94, 0xAE, 0x5E, 0x5E, 0x95, 0xE5, 0xE5, 0x9D, 0xA4, 0x9D, 0xA5, 0xAD, 0x91, 0xA1, 0xAD,
+    0x95, 0xE0, 0x9D, 0x1A, 0xD6, 0xEA, 0xDA, 0x1E, 0x6F, 0xCA, 0x2D, 0xA6, 0xAE, 0x97, 0x69, 0x74,
+    0x97, 0x70, 0xE7, 0x7E, 0x97, 0x6A, 0xD9, 0x76, 0xE7, 0x69, 0xD9, 0x75, 0x9D, 0x97, 0x69, 0x97,
+    0x40, 0x73, 0xA6, 0xAA, 0x77, 0x0E, 0x4E, 0x97, 0x7A, 0xDA, 0x2E, 0x77, 0x2E, 0x99, 0xE7, 0x73,
+    0x9F, 0xD7, 0x75, 0x9F, 0x77, 0x7A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0xFC, 0x97, 0xFF, 0x5F, 0xCA,
+    0x7F, 0xEA, 0x69, 0xF7, 0x1A, 0xD9, 0x71, 0xFA, 0x70, 0xE7, 0x2F, 0xC7, 0x0D, 0xA7, 0x2F, 0xCA,
+    0x7D, 0xA7, 0x19, 0xDA, 0xE6, 0x9D, 0x97, 0x1A, 0xD0, 0xE9, 0x5A, 0xD7, 0x2E, 0x0A, 0xE5, 0xE7,
+    0x2D, 0xA1, 0xE9, 0x4D, 0xA7, 0x19, 0xD9, 0x1A, 0xDA, 0x4D, 0x97, 0x19, 0xD3, 0xE3, 0x9D, 0x97,
+    0x1A, 0xD3, 0xAD, 0xA2, 0xAD, 0x72, 0xE4, 0xE2, 0xE7, 0x2D, 0xA4, 0xEA, 0x1D, 0xA7, 0x19, 0xD9,
+    0x49, 0xE1, 0xD9, 0x71, 0xAD, 0x6E, 0x99, 0xD7, 0x2E, 0x69, 0xEA, 0xD7, 0x2E, 0x7F, 0xD7, 0x2D,
+    0xA7, 0x9F, 0xA7, 0x19, 0xD9, 0x70, 0xF9, 0x7A, 0xFD, 0xA6, 0xAE, 0x7A, 0xFE, 0xA7, 0xE7, 0x77,
+    0x09, 0x71, 0x69, 0x94, 0x9A, 0x97, 0x9D, 0x39, 0xD9, 0x70, 0xD9, 0x19, 0xDA, 0x71, 0xE0, 0x9D,
+    0xA7, 0x29, 0xDA, 0xDA, 0x74, 0xAF, 0x76, 0xE7, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x3A, 0xEA,
+    0x29, 0xFC, 0xA1, 0x9F, 0xD9, 0x29, 0x99, 0xDA, 0x09, 0xEA, 0xEA, 0x49, 0xD9, 0x9D, 0x91, 0xAD,
+    0x94, 0x9D, 0x9D, 0x92, 0xAD, 0x94, 0xAD, 0xAC, 0x93, 0xE5, 0xFA, 0x4E, 0x5F, 0x49, 0xDA, 0x49,
+    0xE9, 0x4A, 0xD9, 0x4A, 0xE5, 0xE5, 0xE9, 0x5E, 0x5E, 0x59, 0xDA, 0x49, 0xDA, 0x5A, 0xD9, 0x1A,
+    0x1A, 0xD9, 0x5E, 0x09, 0xD1, 0xAD, 0x6E, 0xAD, 0xA1, 0xE6, 0xFC, 0xA2, 0xDA, 0x6A, 0xE9, 0x76,
+    0x95, 0x39, 0x77, 0x59, 0xE9, 0x77, 0x39, 0xEA, 0x77, 0x4E, 0x97, 0x74, 0xE7, 0x74, 0x9D, 0xA7,
+    0x74, 0xAD, 0x77, 0x5D, 0xA7, 0x74, 0xAD, 0x29, 0xAE, 0x93, 0xAE, 0xA2, 0x9D, 0x29, 0xFC, 0xA1,
+    0x9F, 0xD9, 0x29, 0x49, 0x99, 0xDA, 0x09, 0xEA, 0xE9, 0x72, 0x9D, 0x99, 0xD9, 0x1A, 0xD9, 0x72,
+    0xAD, 0x9D, 0x92, 0xAD, 0x97, 0x2F, 0xC9, 0x3E, 0x73, 0xFA, 0x4E, 0x73, 0xF4, 0x9D, 0xA7, 0x29,
+    0xE9, 0x4A, 0xD9, 0x72, 0xAE, 0x5E, 0x73, 0xE9, 0x5E, 0x73, 0xE5, 0x9D, 0x97, 0x29, 0xDA, 0x5A,
+    0xD2, 0xA7, 0xAD, 0x95, 0xE0, 0x9D, 0x7E, 0x6E, 0xAD, 0xA7, 0xE6, 0xFC, 0xA7, 0x9D, 0xA6, 0xF9,
+    0x77, 0x49, 0x50, 0x4F, 0xC9, 0x7F, 0xF5, 0xFC, 0xA7, 0xFE, 0xA6, 0x9F, 0x71, 0xAD, 0x97, 0x1F,
+    0xA7, 0x0E, 0x72, 0xFC, 0x70, 0xDA, 0x72, 0xFC, 0xA7, 0xDA, 0x71, 0x9D, 0xAE, 0x69, 0xD9, 0x71,
+    0xAD, 0x0E, 0x95, 0xAD, 0x72, 0xE0, 0x9E, 0x5E, 0x72, 0xDA, 0x1E, 0x94, 0xDA, 0x71, 0x9D, 0x91,
+    0xAD, 0xA4, 0xD9, 0x71, 0x9D, 0x3E, 0x39, 0xD9, 0x71, 0xAD, 0x3A, 0xDA, 0x2A, 0xD7, 0x2E, 0x4E,
+    0x2E, 0x72, 0xDA, 0x4A, 0xDA, 0x1D, 0xA7, 0x19, 0xD9, 0x5E, 0x1D, 0x97, 0x1A, 0xD6, 0xE9, 0x9D,
+    0x72, 0xE6, 0x9E, 0xAD, 0x72, 0xE7, 0xFD, 0x72, 0xDA, 0x79, 0xFA, 0x71, 0x9D, 0x97, 0x0F, 0x97,
+    0xAF, 0xDA, 0x69, 0xE7, 0xAF, 0xEA, 0x7D, 0xA7, 0x77, 0x0D, 0x97, 0x77, 0xAD, 0x77, 0x2A, 0xA2,
+    0x9D, 0x97, 0x72, 0xEA, 0xEA, 0x77, 0x3F, 0xDA, 0x77, 0x4A, 0xF9, 0x77, 0x77, 0x70, 0x77, 0x19,
+    0xAE, 0xA3, 0xAE, 0xA0, 0x9F, 0xCA, 0x19, 0xFD, 0x90, 0x99, 0x9D, 0xA0, 0x9E, 0xAE, 0xA2, 0x9D,
+    0x99, 0xD9, 0x1A, 0xD9, 0x29, 0xD9, 0xD9, 0x2A, 0xD9, 0x2A, 0xDA, 0xC9, 0x3E, 0x3F, 0xA4, 0xE3,
+    0xF4, 0x9D, 0xA2, 0x9E, 0x94, 0xAD, 0x92, 0xAE, 0x5E, 0x3E, 0x95, 0xE3, 0xE5, 0x9D, 0xA2, 0x9D,
+    0xA5, 0xAD, 0x92, 0xAD, 0x95, 0xE3, 0xAD, 0x6E, 0x3E, 0x59, 0xDA, 0x3D, 0xA5, 0xAD, 0x97, 0x4E,
+    0x74, 0x9D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0xAC, 0x90, 0x9E, 0x70, 0xFE, 0x71, 0xFD, 0x73, 0xAA,
+    0xA9, 0x70, 0x77, 0x77, 0xFF, 0xD7, 0x4F, 0xFC, 0xA7, 0x59, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6,
+    0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1,
+    0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E,
+    0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9,
+    0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE,
+    0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x74, 0x69, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xFF, 0xC6, 0xAF,
+    0xFC, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xCA, 0x70, 0xFF, 0xC6, 0xEA, 0x90, 0x9F, 0x4E, 0x94,
+    0xE9, 0x2A, 0xDA, 0x5E, 0x91, 0x9E, 0x6A, 0xDA, 0x1A, 0xD9, 0x6A, 0xDA, 0x1E, 0x7A, 0xD9, 0x09,
+    0xE7, 0xE9, 0x09, 0xDA, 0x7E, 0x1A, 0xDA, 0x69, 0xDA, 0x1A, 0xDA, 0x6E, 0x91, 0xAD, 0xA5, 0xAD,
+    0xA2, 0x9E, 0x49, 0xE4, 0xF2, 0xAE, 0x59, 0xFF, 0xC7, 0x9F, 0xD9, 0x73, 0x99, 0x71, 0x77, 0x77,
+    0x9C, 0x95, 0xA7, 0x4E, 0x4D, 0x74, 0xF9, 0x9A, 0xDA, 0x74, 0x9F, 0xEA, 0x76, 0x9F, 0xC9, 0x77,
+    0x29, 0x77, 0x77, 0x77, 0x77, 0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6,
+    0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7,
+    0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A,
+    0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39,
+    0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70,
+    0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x74, 0x77, 0x7D, 0x5A, 0x95, 0x9D, 0x93, 0xAC,
+    0x95, 0x9F, 0xAE, 0xA7, 0xAF, 0xDA, 0x71, 0x9E, 0xA9, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xCA, 0x70,
+    0xFF, 0xC6, 0xEA, 0x90, 0x9F, 0x4E, 0x94, 0xE9, 0x2A, 0xDA, 0x5E, 0x91, 0x9E, 0x6A, 0xDA, 0x1A,
+    0xD9, 0x6A, 0xDA, 0x1E, 0x7A, 0xD9, 0x09, 0xE7, 0xE9, 0x09, 0xDA, 0x7E, 0x1A, 0xDA, 0x69, 0xDA,
+    0x1A, 0xDA, 0x6E, 0x91, 0xAD, 0xA5, 0xAD, 0xA2, 0x9E, 0x49, 0xE4, 0xF2, 0xAE, 0x59, 0xFF, 0xC7,
+    0x9F, 0xD9, 0x73, 0x99, 0x71, 0x77, 0x77, 0x5C, 0x59, 0xA7, 0x49, 0xDA, 0x3A, 0xD9, 0x72, 0xAF,
+    0x2F, 0x97, 0x1A, 0xF1, 0x9F, 0xA7, 0x1F, 0xA1, 0x9F, 0x97, 0x1E, 0xA3, 0xE9, 0x73, 0xAA, 0x5A,
+    0x97, 0x77, 0x77, 0x77, 0x6A, 0xFE, 0x97, 0x4A, 0xFF, 0xE7, 0x19, 0xFA, 0x99, 0x99, 0xFC, 0x79,
+    0xEA, 0x69, 0xEA, 0x59, 0xE9, 0x70, 0xAE, 0x5E, 0xA7, 0x2E, 0xA3, 0xAE, 0x73, 0xAE, 0x3E, 0x74,
+    0xAE, 0x2A, 0xE7, 0x49, 0xE2, 0xE9, 0x74, 0x9E, 0x2E, 0x75, 0x9E, 0x19, 0xE7, 0x5A, 0xE1, 0xAE,
+    0x75, 0xEA, 0x1A, 0xE7, 0x5E, 0x91, 0xAE, 0x74, 0x9E, 0x2A, 0xE7, 0x4E, 0xA2, 0x9E, 0x73, 0x9E,
+    0x4E, 0x97, 0x2E, 0x94, 0xF7, 0x1E, 0xA5, 0x9E, 0xA6, 0x9F, 0x7A, 0xF9, 0x19, 0x9F, 0xA7, 0x1A,
+    0xFF, 0xE9, 0x73, 0x9F, 0xF9, 0x77, 0x19, 0x97, 0x50, 0x71, 0x94, 0x97, 0x2A, 0xD2, 0xDA, 0x70,
+    0x9E, 0x1A, 0xE7, 0x0E, 0x91, 0xE9, 0x7E, 0xA1, 0xEA, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xD9, 0x2D,
+    0x97, 0x19, 0x49, 0x77, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x2F, 0xFC, 0x70, 0xEA, 0x90, 0x9F, 0x6E,
+    0x94, 0xE9, 0x4A, 0xDA, 0x5E, 0x93, 0x9E, 0x6A, 0xDA, 0x3A, 0xD9, 0x6A, 0xDA, 0x3E, 0x7A, 0xD9,
+    0x29, 0xE7, 0xE9, 0x29, 0xDA, 0x7E, 0x3A, 0xDA, 0x69, 0xDA, 0x3A, 0xDA, 0x6E, 0x93, 0xAD, 0xA5,
+    0xAD, 0xA4, 0x9E, 0x49, 0xE6, 0xF2, 0xAE, 0x79, 0xFF, 0xC7, 0x19, 0xFD, 0x97, 0x59, 0x97, 0x30,
+    0x70, 0x9A, 0xFF, 0xFF, 0xE9, 0x69, 0xFF, 0xFF, 0xFD, 0x95, 0xAF, 0xCA, 0xA9, 0x9A, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xE5, 0xFA, 0x6E, 0x69, 0xD4, 0xF7, 0x9E, 0x69, 0xCA, 0x3F, 0x70, 0x9D, 0xA6, 0x9C,
+    0x39, 0xE7, 0x1A, 0xD9, 0x74, 0xE9, 0x71, 0xE9, 0x73, 0x9E, 0x72, 0xE7, 0x4E, 0x97, 0x19, 0xE7,
+    0x4E, 0x72, 0xAE, 0xAA, 0xAA, 0xE4, 0x9E, 0x72, 0xAF, 0xFD, 0x4A, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x4A, 0xE7, 0x2E, 0x74, 0xAE, 0x71, 0x9E, 0x74, 0xAE, 0x71, 0xAD, 0xA7, 0x4A, 0xE7, 0x1E,
+    0x97, 0x93, 0x9E, 0x97, 0x0E, 0x70, 0xCA, 0x3F, 0x70, 0xE7, 0xAC, 0xA3, 0x9F, 0x69, 0xDA, 0x69,
+    0xD9, 0x4A, 0xFA, 0x39, 0xF9, 0x99, 0xAA, 0xAA, 0xE6, 0xAF, 0xFF, 0xFF, 0xDA, 0x79, 0xFF, 0xFF,
+    0xFC, 0x97, 0x39, 0x99, 0x97, 0x72, 0x77, 0x76, 0x9F, 0xCA, 0x4A, 0xFA, 0x5F, 0xFC, 0x19, 0xFE,
+    0xA3, 0xEA, 0x90, 0x9E, 0xAA, 0xD9, 0x19, 0xE2, 0xE9, 0x4F, 0xC4, 0xE1, 0xAD, 0xA5, 0xF9, 0x39,
+    0xDA, 0x09, 0xE6, 0xAE, 0x4E, 0x90, 0xAD, 0x96, 0xAD, 0xA3, 0xEA, 0x1E, 0x7A, 0xD2, 0xAE, 0x91,
+    0x9E, 0x7E, 0x9F, 0xA3, 0x9D, 0xA7, 0xFD, 0xA5, 0xAD, 0xA6, 0x9E, 0xA9, 0x7A, 0xDA, 0x6E, 0xA7,
+    0x1A, 0xDA, 0x5A, 0xF6, 0x99, 0x09, 0xE4, 0x9F, 0xC9, 0x4A, 0xD1, 0xF2, 0xAF, 0xEA, 0x9A, 0xF2,
+    0x9F, 0xFC, 0x1F, 0xFC, 0x49, 0xFD, 0x92, 0x9F, 0xD9, 0x70, 0x99, 0x70, 0x97, 0x77, 0x77, 0x49,
+    0xD7, 0x71, 0xAE, 0x77, 0x9F, 0xC7, 0x6F, 0xCA, 0x76, 0xF9, 0x77, 0x09, 0x97, 0x77, 0x77, 0x77,
+    0x29, 0xAF, 0xFA, 0x97, 0x0A, 0xFF, 0xFC, 0x7A, 0xA9, 0xAD, 0xA2, 0xAE, 0xA7, 0x1E, 0x93, 0x9E,
+    0x71, 0xE5, 0xE9, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE9, 0x7A, 0xDA, 0x5E, 0x70, 0xE9, 0x4A,
+    0xDA, 0x70, 0xE4, 0xAE, 0x71, 0xE2, 0x9F, 0x97, 0x09, 0xFF, 0xCA, 0x72, 0xAF, 0xEA, 0x74, 0xEA,
+    0x9A, 0xD9, 0x74, 0xE2, 0xE7, 0x39, 0xE2, 0xE9, 0x72, 0x9D, 0xA2, 0x9E, 0x72, 0xAD, 0x93, 0xF7,
+    0x1E, 0x5E, 0xA7, 0x0E, 0x59, 0xEA, 0x69, 0xE6, 0xAE, 0xA3, 0xAF, 0xEA, 0x4A, 0xF9, 0x0A, 0xFF,
+    0xA5, 0x9F, 0x77, 0x29, 0x91, 0x72, 0x9A, 0x73, 0xDA, 0x71, 0xEA, 0x70, 0xAE, 0x70, 0x9E, 0x71,
+    0xDA, 0x72, 0xCA, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x2E, 0x99, 0xFD, 0x1F, 0xA0, 0x99, 0x9D, 0xA0,
+    0xFC, 0x93, 0xD9, 0x9D, 0x99, 0xA3, 0x9D, 0x9D, 0x79, 0xDA, 0xC9, 0x7A, 0xEA, 0x70, 0xF7, 0x1E,
+    0xA7, 0x09, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E,
+    0x71, 0x77, 0x72, 0x9A, 0xFF, 0xA9, 0x70, 0xAF, 0xFF, 0xC7, 0xAA, 0x9A, 0xDA, 0x2A, 0xEA, 0x71,
+    0xE9, 0x39, 0xE7, 0x1E, 0x5E, 0x97, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x97, 0xAD, 0xA5, 0xE7,
+    0x0E, 0x94, 0xAD, 0xA7, 0x0E, 0x4A, 0xE7, 0x1E, 0x29, 0xF9, 0x70, 0x9F, 0xFC, 0xA7, 0x2A, 0xFE,
+    0xA7, 0x4E, 0xA9, 0xAD, 0x97, 0x4E, 0x2E, 0x73, 0x9E, 0x2E, 0x97, 0x29, 0xDA, 0x29, 0xE7, 0x2A,
+    0xD9, 0x3F, 0x71, 0xE5, 0xEA, 0x70, 0xE5, 0x9E, 0xA6, 0x9E, 0x6A, 0xEA, 0x3A, 0xFE, 0xA4, 0xAF,
+    0x90, 0xAF, 0xFA, 0x59, 0xF7, 0x72, 0x99, 0x73, 0x97, 0x72, 0x9E, 0x77, 0x2E, 0x97, 0x71, 0xE7,
+    0x72, 0xE7, 0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x72, 0x99, 0x74, 0x77, 0x29, 0xAE, 0xA2, 0xE9, 0x19,
+    0xFD, 0x1F, 0xA2, 0x99, 0x9D, 0xA0, 0xFC, 0x95, 0xD9, 0x9D, 0x99, 0xA5, 0x9D, 0x9D, 0x71, 0x9D,
+    0xAC, 0x97, 0x1A, 0xEA, 0x72, 0xF7, 0x3E, 0xA7, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x4E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x77, 0x77, 0x73, 0xE9, 0x73, 0xAD, 0xA7, 0x3A, 0xD9,
+    0x73, 0xE7, 0x39, 0xD9, 0x72, 0x9D, 0x97, 0x39, 0xA7, 0x50, 0x79, 0xA6, 0xAA, 0x72, 0xDA, 0x39,
+    0xE7, 0x2E, 0x91, 0x9E, 0x74, 0xE9, 0x9E, 0x75, 0x9F, 0xCA, 0x77, 0xAE, 0xA7, 0x71, 0xAC, 0xA7,
+    0x77, 0x77, 0x77, 0x09, 0xAF, 0xFA, 0x97, 0x0A, 0xFF, 0xFC, 0x7A, 0xA9, 0xAD, 0xA2, 0xAE, 0xA7,
+    0x1E, 0x93, 0x9E, 0x71, 0xE5, 0xE9, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE9, 0x7A, 0xDA, 0x5E,
+    0x70, 0xE9, 0x4A, 0xDA, 0x70, 0xE4, 0xAE, 0x71, 0xE2, 0x9F, 0x97, 0x09, 0xFF, 0xCA, 0x72, 0xAF,
+    0xEA, 0x74, 0xEA, 0x9A, 0xD9, 0x74, 0xE2, 0xE7, 0x39, 0xE2, 0xE9, 0x72, 0x9D, 0xA2, 0x9E, 0x72,
+    0xAD, 0x93, 0xF7, 0x1E, 0x5E, 0xA7, 0x0E, 0x59, 0xEA, 0x69, 0xE6, 0xAE, 0xA3, 0xAF, 0xEA, 0x4A,
+    0xF9, 0x0A, 0xFF, 0xA5, 0x9F, 0x77, 0x29, 0x91, 0x5A, 0x5A, 0x95, 0xD9, 0x3E, 0x5E, 0x2E, 0x69,
+    0xD9, 0x0E, 0x70, 0xFD, 0x71, 0x9F, 0x73, 0xE9, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA2, 0xE9, 0x19,
+    0xFD, 0x1F, 0xA2, 0x99, 0x9D, 0xA0, 0xFC, 0x95, 0xD9, 0x9D, 0x99, 0xA5, 0x9D, 0x9D, 0x71, 0x9D,
+    0xAC, 0x97, 0x1A, 0xEA, 0x72, 0xF7, 0x3E, 0xA7, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x4E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0x76, 0x97, 0x6A, 0xC7, 0x49, 0xE9, 0x72, 0xFC,
+    0x71, 0xAF, 0xC9, 0x70, 0x9E, 0xA7, 0x49, 0x77, 0x77, 0x77, 0xAF, 0xDA, 0x95, 0xAF, 0xFD, 0xA3,
+    0xAE, 0x92, 0x9E, 0x92, 0x9E, 0x59, 0xD9, 0x2A, 0xD9, 0x59, 0xD3, 0xE6, 0x9C, 0xA3, 0xE9, 0x59,
+    0xA4, 0xF7, 0x4A, 0xEA, 0x74, 0xFC, 0x97, 0x3F, 0xCA, 0x73, 0xAF, 0xC9, 0x72, 0x9F, 0xC9, 0x73,
+    0xAF, 0x97, 0x39, 0xF2, 0x9A, 0x7A, 0xE2, 0xD7, 0x0E, 0x19, 0xD7, 0x0E, 0x1A, 0xD9, 0x69, 0xDA,
+    0x1A, 0xDA, 0x6E, 0x2A, 0xEA, 0x92, 0x9E, 0xA2, 0x9F, 0xFE, 0xA5, 0x9F, 0xEA, 0x73, 0x99, 0x70,
+    0x73, 0xC7, 0x4E, 0x72, 0xAE, 0x71, 0x9E, 0x72, 0xE7, 0x2E, 0x73, 0xCA, 0x77, 0x77, 0x77, 0x7A,
+    0xFC, 0x69, 0xFE, 0xA4, 0x9D, 0xA9, 0x99, 0xDA, 0x4E, 0x49, 0x5E, 0x73, 0xE9, 0x72, 0xAE, 0xA7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2A, 0xF7, 0x29, 0xE9, 0x72, 0xAD, 0xA3, 0xC9, 0x49, 0xDA, 0x2A, 0xD4,
+    0x9D, 0x3A, 0xEA, 0x90, 0x9D, 0xA3, 0x9F, 0xFA, 0x59, 0xFD, 0x97, 0x29, 0x70, 0x77, 0x72, 0x9E,
+    0x73, 0x9F, 0xC7, 0x19, 0xFD, 0xA7, 0x9E, 0x1E, 0x95, 0x9E, 0x3E, 0x5A, 0xC9, 0x5C, 0x97, 0x77,
+    0x77, 0x0A, 0xFD, 0xA9, 0x5A, 0xFF, 0xDA, 0x3A, 0xE9, 0x29, 0xE9, 0x29, 0xE5, 0x9D, 0x92, 0xAD,
+    0x95, 0x9D, 0x3E, 0x69, 0xCA, 0x3E, 0x95, 0x9A, 0x4F, 0x74, 0xAE, 0xA7, 0x4F, 0xC9, 0x73, 0xFC,
+    0xA7, 0x3A, 0xFC, 0x97, 0x29, 0xFC, 0x97, 0x3A, 0xF9, 0x73, 0x9F, 0x29, 0xA7, 0xAE, 0x2D, 0x70,
+    0xE1, 0x9D, 0x70, 0xE1, 0xAD, 0x96, 0x9D, 0xA1, 0xAD, 0xA6, 0xE2, 0xAE, 0xA9, 0x29, 0xEA, 0x29,
+    0xFF, 0xEA, 0x59, 0xFE, 0xA7, 0x39, 0x97, 0x00, 0x71, 0x99, 0x72, 0x9E, 0x72, 0xFC, 0x70, 0xFD,
+    0x96, 0xE1, 0xDA, 0x5A, 0xD2, 0xAD, 0x4A, 0xD4, 0xD4, 0x9A, 0x59, 0x77, 0x77, 0x5A, 0xFC, 0x69,
+    0xFE, 0xA4, 0x9D, 0xA9, 0x99, 0xDA, 0x4E, 0x49, 0x5E, 0x73, 0xE9, 0x72, 0xAE, 0xA7, 0x2F, 0xC7,
+    0x2F, 0xC7, 0x2A, 0xF7, 0x29, 0xE9, 0x72, 0xAD, 0xA3, 0xC9, 0x49, 0xDA, 0x2A, 0xD4, 0x9D, 0x3A,
+    0xEA, 0x90, 0x9D, 0xA3, 0x9F, 0xFA, 0x59, 0xFD, 0x97, 0x29, 0x70, 0x77, 0x7A, 0xFD, 0xA9, 0x5A,
+    0xFF, 0xDA, 0x3A, 0xE9, 0x29, 0xE9, 0x29, 0xE5, 0x9D, 0x92, 0xAD, 0x95, 0x9D, 0x3E, 0x69, 0xCA,
+    0x3E, 0x95, 0x9A, 0x4F, 0x74, 0xAE, 0xA7, 0x4F, 0xC9, 0x73, 0xFC, 0xA7, 0x3A, 0xFC, 0x97, 0x29,
+    0xFC, 0x97, 0x3A, 0xF9, 0x73, 0x9F, 0x29, 0xA7, 0xAE, 0x2D, 0x70, 0xE1, 0x9D, 0x70, 0xE1, 0xAD,
+    0x96, 0x9D, 0xA1, 0xAD, 0xA6, 0xE2, 0xAE, 0xA9, 0x29, 0xEA, 0x29, 0xFF, 0xEA, 0x59, 0xFE, 0xA7,
+    0x39, 0x97, 0x69, 0x97, 0x5F, 0x74, 0xAE, 0xA7, 0x5D, 0xA7, 0x4A, 0xD7, 0x4A, 0xD9, 0x72, 0x9E,
+    0x97, 0x4A, 0x97, 0x20, 0x77, 0x2A, 0xFC, 0x49, 0xFE, 0xA2, 0x9D, 0xA9, 0x99, 0xDA, 0x2E, 0x49,
+    0x3E, 0x71, 0xE9, 0x70, 0xAE, 0xA7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0A, 0xF7, 0x09, 0xE9, 0x70, 0xAD,
+    0xA1, 0xC9, 0x49, 0xDA, 0x0A, 0xD4, 0x9D, 0x1A, 0xEA, 0x90, 0x9D, 0xA1, 0x9F, 0xFA, 0x39, 0xFD,
+    0x97, 0x09, 0x73, 0x97, 0x1F, 0x97, 0xAA, 0xDA, 0x71, 0xDA, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0xE9,
+    0x70, 0xA9, 0x70, 0x6A, 0x95, 0x9A, 0x95, 0xAD, 0x4A, 0xD9, 0x59, 0xE2, 0xE9, 0x7E, 0xA0, 0xE9,
+    0x71, 0xFD, 0x73, 0x9F, 0x75, 0x9D, 0x77, 0x77, 0x77, 0x0A, 0xFD, 0xA9, 0x6A, 0xFF, 0xDA, 0x4A,
+    0xE9, 0x29, 0xE9, 0x39, 0xE5, 0x9D, 0x93, 0xAD, 0x95, 0x9D, 0x4E, 0x69, 0xCA, 0x4E, 0x95, 0x9A,
+    0x5F, 0x75, 0xAE, 0xA7, 0x5F, 0xC9, 0x74, 0xFC, 0xA7, 0x4A, 0xFC, 0x97, 0x39, 0xFC, 0x97, 0x4A,
+    0xF9, 0x74, 0x9F, 0x39, 0xA7, 0xAE, 0x3D, 0x70, 0xE2, 0x9D, 0x70, 0xE2, 0xAD, 0x96, 0x9D, 0xA2,
+    0xAD, 0xA6, 0xE3, 0xAE, 0xA9, 0x29, 0xEA, 0x39, 0xFF, 0xEA, 0x69, 0xFE, 0xA7, 0x49, 0x97, 0x10,
+    0x59, 0x5A, 0xA5, 0xAC, 0xA3, 0xE5, 0xAD, 0x2E, 0x69, 0xDA, 0x0A, 0xD7, 0x0E, 0xAD, 0x97, 0x1F,
+    0x97, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xC7, 0x9F, 0xEA, 0x59, 0xDA, 0x99, 0x9D, 0xA5,
+    0xE4, 0x96, 0xE7, 0x4E, 0x97, 0x3A, 0xEA, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xAF, 0x73, 0x9E, 0x97,
+    0x3A, 0xDA, 0x4C, 0x94, 0x9D, 0xA3, 0xAD, 0x49, 0xD4, 0xAE, 0xA9, 0x09, 0xDA, 0x49, 0xFF, 0xA6,
+    0x9F, 0xD9, 0x73, 0x97, 0x10, 0x09, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x0E, 0xAA, 0xAA, 0xAE,
+    0xAA, 0xAA, 0xAD, 0xA0, 0xDA, 0x3A, 0xDA, 0x4D, 0x90, 0xD4, 0xAD, 0x94, 0xD1, 0xD4, 0xE9, 0x4D,
+    0x1C, 0xA4, 0xE4, 0x9C, 0x97, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9E,
+    0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x76,
+    0x9E, 0x97, 0x4A, 0xFF, 0x71, 0xAF, 0xFC, 0x77, 0x77, 0x19, 0x77, 0x0A, 0xEA, 0x76, 0xAF, 0x77,
+    0x0E, 0x77, 0x9D, 0xA7, 0x69, 0xE7, 0x6A, 0xDA, 0x77, 0xA9, 0x77, 0x79, 0x71, 0x9D, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD6, 0x9A, 0xAF, 0xF0, 0xAF, 0xFD, 0xA0, 0x99, 0x9A, 0xDA, 0x99, 0x99,
+    0x4A, 0xD9, 0x70, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1E, 0x70,
+    0x9D, 0xA7, 0x0A, 0xD9, 0x3C, 0xA2, 0xAD, 0x91, 0x9D, 0xA2, 0xAE, 0xAF, 0x3A, 0xFE, 0x5F, 0xC9,
+    0x70, 0x97, 0x29, 0x71, 0x9F, 0x79, 0xAE, 0x71, 0x9D, 0x71, 0xDA, 0x70, 0xE7, 0xAD, 0xA7, 0x09,
+    0xA9, 0x70, 0x69, 0xA6, 0xAA, 0x70, 0xDA, 0x39, 0xE7, 0x0E, 0x91, 0x9E, 0x71, 0x9E, 0x09, 0xDA,
+    0x73, 0xAF, 0xCA, 0x75, 0xAE, 0xA7, 0x7A, 0xCA, 0x77, 0x77, 0x77, 0x9F, 0xFF, 0xFD, 0x0A, 0xFF,
+    0xFF, 0xD0, 0xEA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xDA, 0x0D, 0xA3, 0xAD, 0xA4, 0xD9, 0x0D, 0x4A,
+    0xD9, 0x4D, 0x1D, 0x4E, 0x94, 0xD1, 0xCA, 0x4E, 0x49, 0xC9, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xE9,
+    0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xDA,
+    0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x69, 0xE9, 0x74, 0xAF, 0xF7, 0x1A, 0xFF, 0xC7, 0x00, 0x77, 0x79,
+    0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xD9, 0x79, 0x09, 0xD6, 0x9D, 0x0A, 0xC9, 0x6D, 0xA0, 0xAC, 0x69,
+    0xD9, 0x71, 0xAD, 0x79, 0xAA, 0xFF, 0x1A, 0xFF, 0xDA, 0x19, 0x99, 0xAD, 0xA9, 0x99, 0x95, 0xAD,
+    0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA,
+    0x71, 0xAD, 0x93, 0xCA, 0x3A, 0xD9, 0x19, 0xDA, 0x3A, 0xEA, 0xF4, 0xAF, 0xE6, 0xFC, 0x97, 0x19,
+    0x70, 0x09, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x0E, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAD, 0xA0,
+    0xDA, 0x3A, 0xDA, 0x4D, 0x90, 0xD4, 0xAD, 0x94, 0xD1, 0xD4, 0xE5, 0xD1, 0xCA, 0x4E, 0x49, 0xC9,
+    0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x74, 0x99, 0x9E, 0xA9, 0x97, 0x1A, 0xFF, 0xC9, 0x70, 0x9A,
+    0xAF, 0xAA, 0xA7, 0x4A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0xA7,
+    0x7E, 0x97, 0x69, 0xE9, 0x74, 0xAF, 0xF7, 0x1A, 0xFF, 0xC7, 0x00, 0x79, 0x71, 0x9D, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD6, 0x9A, 0xAF, 0xF0, 0xAF, 0xFD, 0xA0, 0x99, 0x9A, 0xDA, 0x99, 0x99,
+    0x4A, 0xD9, 0x70, 0xE7, 0x1E, 0x69, 0x9A, 0xE9, 0x99, 0x99, 0x0A, 0xFF, 0xDA, 0x09, 0x99, 0xEA,
+    0x99, 0x99, 0x4E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x93, 0xCA, 0x2A, 0xD9, 0x19, 0xDA, 0x2A,
+    0xEA, 0xF3, 0xAF, 0xE5, 0xFC, 0x97, 0x09, 0x60, 0x70, 0x9D, 0xA2, 0x9A, 0x75, 0x9F, 0xC1, 0xD7,
+    0x5F, 0xFD, 0x75, 0xD1, 0xFC, 0x97, 0x5A, 0xA2, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x69, 0xFF,
+    0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x2E, 0x59, 0xE7, 0x2D,
+    0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD, 0x59, 0xE7, 0x2E, 0x59,
+    0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E, 0x72, 0xAD, 0x59, 0xE7,
+    0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7, 0x1A, 0xD6, 0xAD, 0xA7,
+    0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A, 0xFA, 0x72, 0xFF, 0xE9,
+    0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x70, 0x99, 0x76, 0x9E, 0xA1, 0x9C, 0x97, 0x0F, 0xCA,
+    0x0D, 0x97, 0xAD, 0x9A, 0xFC, 0x70, 0xAC, 0x91, 0xF9, 0x71, 0x93, 0x9A, 0x77, 0x77, 0x77, 0x76,
+    0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59, 0xE2, 0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA,
+    0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49,
+    0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9, 0x49, 0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0,
+    0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D, 0xAD, 0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79,
+    0x40, 0x77, 0x77, 0xAF, 0xFC, 0x75, 0xFF, 0xD7, 0x69, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x69, 0xFF, 0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x2E,
+    0x59, 0xE7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD, 0x59,
+    0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E, 0x72,
+    0xAD, 0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7, 0x1A,
+    0xD6, 0xAD, 0xA7, 0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A, 0xFA,
+    0x72, 0xFF, 0xE9, 0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x69, 0x99, 0x99, 0x99, 0x99, 0x70,
+    0x9F, 0xFC, 0x97, 0x9F, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59,
+    0xE2, 0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59,
+    0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9,
+    0x49, 0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D,
+    0xAD, 0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x77, 0x77, 0x0C, 0xA5, 0xA9,
+    0x74, 0xAD, 0x4A, 0xC7, 0x5A, 0xE9, 0x9A, 0xDA, 0x76, 0xFE, 0xA7, 0x79, 0xFC, 0x97, 0x73, 0x97,
+    0x77, 0x77, 0x77, 0x29, 0xFF, 0x5F, 0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95,
+    0xE7, 0x2E, 0x59, 0xE7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72,
+    0xAD, 0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D,
+    0x6E, 0x72, 0xAD, 0x59, 0xE7, 0x2E, 0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD,
+    0xA7, 0x1A, 0xD6, 0xAD, 0xA7, 0x1D, 0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9,
+    0x9A, 0xFA, 0x72, 0xFF, 0xE9, 0x74, 0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x77, 0x71, 0xD5, 0x9A,
+    0x79, 0xDA, 0x3A, 0xC9, 0x70, 0xFA, 0xAE, 0x71, 0xAF, 0xE7, 0x39, 0xAE, 0x97, 0x77, 0x77, 0x77,
+    0x69, 0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E, 0x29, 0x99, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D,
+    0xA5, 0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x94,
+    0x9E, 0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94, 0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA1, 0x9D, 0xA2, 0xAD,
+    0x0D, 0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x2F, 0xE2, 0xFC, 0x3A, 0xFA, 0x3E, 0xA6, 0x97,
+    0x94, 0x73, 0x99, 0x97, 0x72, 0x9F, 0xA7, 0x71, 0xDA, 0xAD, 0xA7, 0x7A, 0xCA, 0x19, 0xD7, 0x7D,
+    0x3D, 0x77, 0xD9, 0x19, 0xD7, 0x7A, 0xDA, 0xAD, 0x97, 0x70, 0xFC, 0x97, 0x72, 0x99, 0x97, 0x77,
+    0x71, 0x9F, 0xF5, 0xFF, 0x0A, 0xFE, 0xA5, 0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9, 0x5E, 0x72, 0xE5,
+    0x9E, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7, 0x2A, 0xD5, 0x9E,
+    0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD6, 0xE7, 0x2A,
+    0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A, 0xDA, 0x71, 0xAD,
+    0x6A, 0xDA, 0x71, 0xDA, 0x6A, 0xE7, 0x0E, 0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA, 0x99, 0xAF, 0xA7,
+    0x2F, 0xFE, 0x97, 0x4A, 0xFE, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x73, 0x9F, 0x74, 0x9F, 0xD7, 0x3D,
+    0x91, 0xD9, 0x71, 0x9D, 0x2D, 0x97, 0x1A, 0xCA, 0x2D, 0x97, 0x19, 0xD1, 0x9D, 0x73, 0xFD, 0x97,
+    0x4F, 0x97, 0x77, 0x77, 0x39, 0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E, 0x29, 0x99, 0xE5, 0x9D, 0xA5,
+    0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D,
+    0xA5, 0xE5, 0xAD, 0x94, 0x9E, 0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94, 0x9D, 0xA3, 0xAC, 0xAD, 0x91,
+    0xA1, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x2F, 0xE2, 0xFC, 0x3A,
+    0xFA, 0x3E, 0xA6, 0x97, 0x94, 0x77, 0x77, 0x4A, 0x95, 0xC7, 0x5E, 0x39, 0xD9, 0x72, 0x9F, 0x2A,
+    0xEA, 0x71, 0xAF, 0x91, 0xFC, 0x71, 0xFA, 0x19, 0xF9, 0x71, 0xAD, 0xA3, 0xE9, 0x73, 0x9A, 0x5A,
+    0x97, 0x77, 0x77, 0x76, 0x9F, 0xF5, 0xFF, 0x0A, 0xFE, 0xA5, 0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9,
+    0x5E, 0x72, 0xE5, 0x9E, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7,
+    0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19,
+    0xD6, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A,
+    0xDA, 0x71, 0xAD, 0x6A, 0xDA, 0x71, 0xDA, 0x6A, 0xE7, 0x0E, 0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA,
+    0x99, 0xAF, 0xA7, 0x2F, 0xFE, 0x97, 0x4A, 0xFE, 0xA7, 0x71, 0x99, 0x77, 0x71, 0x94, 0x97, 0x29,
+    0xD2, 0xAD, 0x71, 0xE1, 0x9E, 0x70, 0xEA, 0x1E, 0xA7, 0xAE, 0x1E, 0xA7, 0x9D, 0xA1, 0x9D, 0xA7,
+    0x0A, 0xCA, 0x2D, 0xA7, 0x29, 0x49, 0x77, 0x77, 0x73, 0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59, 0xE2,
+    0x99, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59, 0xDA,
+    0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9, 0x49,
+    0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D, 0xAD,
+    0xA2, 0xFE, 0x2F, 0xC3, 0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x9F, 0xF5, 0xFF, 0x0A, 0xFE, 0xA5,
+    0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9, 0x5E, 0x72, 0xE5, 0x9E, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D,
+    0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD,
+    0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD6, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D, 0xA7, 0x2D,
+    0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A, 0xDA, 0x71, 0xAD, 0x6A, 0xDA, 0x71, 0xDA, 0x6A, 0xE7, 0x0E,
+    0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA, 0x99, 0xAF, 0x97, 0x2F, 0xFE, 0x97, 0x4A, 0xFE, 0xA7, 0x71,
+    0x9E, 0x77, 0x3A, 0xD7, 0x74, 0xD7, 0x74, 0xAD, 0x77, 0x4A, 0xE9, 0x99, 0x77, 0x1F, 0xCA, 0x77,
+    0x19, 0xEA, 0x74, 0x77, 0x39, 0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E, 0x29, 0x99, 0xE5, 0x9D, 0xA5,
+    0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D,
+    0xA5, 0xE5, 0xAD, 0x94, 0x9E, 0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94, 0x9D, 0xA3, 0xAC, 0xAD, 0x91,
+    0xA1, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x2F, 0xE2, 0xFC, 0x3A,
+    0xFA, 0x3F, 0x69, 0x69, 0xD7, 0x7D, 0x77, 0xD9, 0x77, 0xD7, 0x79, 0xDA, 0x77, 0xFC, 0xA7, 0x49,
+    0xEA, 0x20, 0x77, 0x77, 0x77, 0x29, 0xE7, 0x77, 0x49, 0xFC, 0x77, 0x72, 0x9F, 0xDA, 0x77, 0x70,
+    0x9E, 0x1E, 0x97, 0x76, 0xAE, 0x3D, 0xA7, 0x76, 0xAC, 0x95, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x76,
+    0xAF, 0xF5, 0x9A, 0x95, 0xAF, 0xEA, 0x0F, 0xFA, 0x5D, 0xA5, 0xFF, 0x91, 0x9F, 0x96, 0xAE, 0x7A,
+    0xE9, 0x4A, 0xDA, 0x7F, 0x7A, 0xD9, 0x5A, 0xDA, 0x69, 0xF7, 0xE6, 0xAE, 0x6F, 0xC6, 0xAD, 0x96,
+    0x9E, 0x59, 0xFC, 0x6E, 0x79, 0xE5, 0xFD, 0x59, 0xD9, 0x79, 0xE4, 0x9D, 0x9A, 0xD9, 0x4E, 0x70,
+    0x9E, 0x4E, 0x0A, 0xD9, 0x39, 0xD9, 0x71, 0xE3, 0x9D, 0x90, 0x9D, 0x93, 0xE7, 0x2E, 0x3E, 0x19,
+    0xDA, 0x3D, 0x97, 0x2E, 0x29, 0xD9, 0x19, 0xDA, 0x2A, 0xD7, 0x3E, 0x2E, 0x3D, 0xA2, 0xD9, 0x73,
+    0xE1, 0x9D, 0x93, 0xE1, 0xAD, 0x74, 0xE1, 0xE4, 0xE1, 0xD9, 0x74, 0xAD, 0x09, 0xD9, 0x4E, 0x09,
+    0xD7, 0x5A, 0xD0, 0xE5, 0xE0, 0xDA, 0x75, 0xAD, 0xAD, 0x6A, 0xDA, 0xD7, 0x69, 0xFA, 0x6A, 0xFA,
+    0x76, 0x9F, 0x79, 0xF7, 0x79, 0xEA, 0x79, 0xEA, 0x77, 0x0E, 0x70, 0x9E, 0x77, 0x77, 0x76, 0x75,
+    0x99, 0x77, 0x5E, 0x97, 0x73, 0xFC, 0x77, 0x2A, 0xDA, 0xDA, 0x77, 0x0A, 0xD9, 0x0E, 0x77, 0x9D,
+    0x91, 0x9D, 0x97, 0x59, 0xD9, 0x3D, 0x97, 0x6A, 0x95, 0x97, 0x77, 0x77, 0x75, 0x92, 0x9A, 0xE4,
+    0x9E, 0x49, 0xE0, 0x9F, 0xC9, 0x4E, 0x94, 0xEA, 0x09, 0x9A, 0xDA, 0x4E, 0xA4, 0xEA, 0x3E, 0x4A,
+    0xE4, 0xAD, 0xA3, 0xE4, 0x9E, 0x4A, 0xD9, 0x3A, 0xD9, 0x3A, 0xE4, 0xAD, 0x49, 0xDA, 0x3F, 0x93,
+    0xE5, 0xE3, 0xF9, 0x3D, 0x95, 0xE2, 0xAF, 0xA2, 0xAD, 0x6A, 0xD2, 0xD9, 0xDA, 0x2D, 0x96, 0xAD,
+    0x1A, 0xD0, 0xAD, 0x1A, 0xD7, 0x9D, 0x1D, 0x1A, 0xD1, 0xD9, 0x79, 0xD0, 0xAC, 0xA1, 0x9D, 0x0D,
+    0xA7, 0x09, 0xDA, 0xD2, 0x9D, 0xAD, 0x71, 0x9F, 0x39, 0xF7, 0x29, 0xE4, 0x9E, 0x74, 0xD6, 0xD7,
+    0x77, 0x70, 0x77, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xF9, 0x76, 0xAD, 0xAE, 0x97, 0x4A, 0xDA, 0x09,
+    0xE7, 0x3E, 0x92, 0x9D, 0x97, 0x19, 0xD5, 0x9A, 0x77, 0x77, 0x77, 0x0A, 0xFF, 0x3F, 0xF9, 0xFF,
+    0xA3, 0xFE, 0xA1, 0x9F, 0x96, 0x9E, 0xA4, 0xAE, 0x79, 0xDA, 0x6E, 0x96, 0xE7, 0xAD, 0xA5, 0xE7,
+    0x09, 0xE4, 0xAD, 0x97, 0x1E, 0x92, 0x9D, 0xA7, 0x2A, 0xDA, 0x2E, 0x74, 0xE1, 0xAD, 0x75, 0xE9,
+    0x9D, 0x97, 0x59, 0xFC, 0xA7, 0x7F, 0xC7, 0x70, 0xAE, 0x77, 0x1A, 0xDA, 0x77, 0x1A, 0xD9, 0x77,
+    0x1E, 0x97, 0x71, 0xE7, 0x71, 0x9E, 0x77, 0x1A, 0xDA, 0x77, 0x1E, 0xA7, 0x6A, 0xFF, 0x97, 0x29,
+    0xFF, 0xC9, 0x71, 0x74, 0x99, 0x77, 0x0E, 0xA7, 0x6A, 0xF7, 0x5A, 0xDA, 0xDA, 0x73, 0x9D, 0x90,
+    0xE7, 0x29, 0xDA, 0x2D, 0x97, 0x1D, 0xA3, 0xAC, 0xA7, 0x19, 0x95, 0x97, 0x77, 0x77, 0x69, 0xAE,
+    0x59, 0xE4, 0xFD, 0x5E, 0xA3, 0x99, 0xAE, 0x5A, 0xDA, 0x6E, 0x94, 0x9D, 0xA6, 0x9E, 0x49, 0xD9,
+    0x7E, 0x49, 0xD7, 0x0E, 0x4A, 0xD7, 0x09, 0xD9, 0x3D, 0x97, 0x09, 0xDA, 0x29, 0xD7, 0x2D, 0xA2,
+    0xDA, 0x72, 0xDA, 0x19, 0xD7, 0x3E, 0x1D, 0xA7, 0x3E, 0x09, 0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x4A,
+    0xCA, 0xAC, 0xA7, 0x5F, 0xC7, 0x6F, 0x77, 0xE9, 0x76, 0x9D, 0xA7, 0x7D, 0xA7, 0x69, 0xDA, 0x71,
+    0x9C, 0x90, 0x9E, 0x97, 0x2A, 0xFD, 0x97, 0x3F, 0xCA, 0x76, 0xAA, 0xA7, 0x70, 0x77, 0x74, 0x9D,
+    0xA2, 0xAD, 0x97, 0x2F, 0x19, 0xEA, 0x71, 0x9E, 0xA1, 0x9E, 0x97, 0x2D, 0xA3, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x6A, 0xFF, 0x3F, 0xF9, 0xFF, 0xA3, 0xFE, 0xA1, 0x9F, 0x96, 0x9E, 0xA4, 0xAE, 0x79,
+    0xDA, 0x6E, 0x96, 0xE7, 0xAD, 0xA5, 0xE7, 0x09, 0xE4, 0xAD, 0x97, 0x1E, 0x92, 0x9D, 0xA7, 0x2A,
+    0xDA, 0x2E, 0x74, 0xE1, 0xAD, 0x75, 0xE9, 0x9D, 0x97, 0x59, 0xFC, 0xA7, 0x7F, 0xC7, 0x70, 0xAE,
+    0x77, 0x1A, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x97, 0x71, 0xE7, 0x71, 0x9E, 0x77, 0x1A, 0xDA,
+    0x77, 0x1E, 0xA7, 0x6A, 0xFF, 0x97, 0x29, 0xFF, 0xC9, 0x71, 0x77, 0x77, 0x2A, 0xC9, 0x76, 0x9E,
+    0xA7, 0x5A, 0xF9, 0x73, 0x9F, 0xC9, 0x74, 0xEA, 0x97, 0x69, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0xD9,
+    0x39, 0xFF, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x3D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE,
+    0x5D, 0x6A, 0xE6, 0xA9, 0x59, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xE7,
+    0x69, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0xAC, 0x4A, 0xE7, 0x0D, 0x39, 0xE7,
+    0x0A, 0xD2, 0x9E, 0x97, 0x0E, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x91, 0x9F, 0xFF, 0xF3, 0xFF,
+    0xFE, 0xA7, 0x76, 0x73, 0xC7, 0x5E, 0x73, 0xAE, 0x72, 0x9E, 0x73, 0xE7, 0x3E, 0x74, 0xD7, 0x77,
+    0x77, 0x77, 0x0A, 0xEA, 0x92, 0x9D, 0x2A, 0xFE, 0x90, 0xE2, 0xFF, 0xFA, 0x2D, 0x39, 0xFA, 0x3C,
+    0xA5, 0xE4, 0x95, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3A, 0xD9, 0x72, 0xAD, 0x97, 0x2A,
+    0xD9, 0x59, 0x92, 0xAE, 0x95, 0xD1, 0x9F, 0xFC, 0xAE, 0x1E, 0x9F, 0xFD, 0x1A, 0xCA, 0x19, 0xAF,
+    0xD7, 0x39, 0x94, 0x73, 0xAA, 0x97, 0x7F, 0x76, 0x9F, 0x76, 0x9E, 0xA7, 0x7A, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x6F, 0xFF, 0xD9, 0x39, 0xFF, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x3D,
+    0xA7, 0xEA, 0x4D, 0x96, 0xAE, 0x5D, 0x6A, 0xE6, 0xA9, 0x59, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76,
+    0xEA, 0x76, 0xF7, 0x6A, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0xAC,
+    0x4A, 0xE7, 0x0D, 0x39, 0xE7, 0x0A, 0xD2, 0x9E, 0x97, 0x0E, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x91, 0x9F, 0xFF, 0xF3, 0xFF, 0xFE, 0xA7, 0x76, 0x70, 0xAC, 0x97, 0x3F, 0x72, 0x9F, 0x72, 0x9E,
+    0x74, 0x99, 0x77, 0x77, 0x77, 0x70, 0xAE, 0xA9, 0x29, 0xD2, 0xAF, 0xE9, 0x0E, 0x2F, 0xFF, 0xA2,
+    0xD3, 0x9F, 0xA3, 0xCA, 0x5E, 0x49, 0x5E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xAD, 0x97,
+    0x2A, 0xD9, 0x72, 0xAD, 0x95, 0x99, 0x2A, 0xE9, 0x5D, 0x19, 0xFF, 0xCA, 0xE1, 0xE9, 0xFF, 0xD1,
+    0xAC, 0xA1, 0x9A, 0xFD, 0x73, 0x99, 0x40, 0x7A, 0x95, 0x9A, 0x97, 0x9D, 0x93, 0xAD, 0xA7, 0x0E,
+    0x2A, 0xDA, 0x71, 0xAE, 0x0E, 0x97, 0x3F, 0xD9, 0x75, 0xF9, 0x77, 0xD9, 0x77, 0x77, 0x77, 0x2F,
+    0xFF, 0xD9, 0x39, 0xFF, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x3D, 0xA7, 0xEA, 0x4D,
+    0x96, 0xAE, 0x5D, 0x6A, 0xE6, 0xA9, 0x59, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7,
+    0x6A, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0xAC, 0x4A, 0xE7, 0x0D,
+    0x39, 0xE7, 0x0A, 0xD2, 0x9E, 0x97, 0x0E, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x91, 0x9F, 0xFF,
+    0xF3, 0xFF, 0xFE, 0xA7, 0x76, 0x59, 0x5A, 0xA5, 0xAC, 0xA3, 0xE5, 0xAD, 0x2E, 0x7D, 0xA0, 0xAD,
+    0x70, 0xAD, 0xAD, 0x97, 0x1F, 0x97, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x7A, 0xEA, 0x92, 0x9D, 0x2A,
+    0xFE, 0x90, 0xE2, 0xFF, 0xFA, 0x2D, 0x39, 0xFA, 0x3C, 0xA5, 0xE4, 0x95, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3A, 0xD9, 0x72, 0xAD, 0x97, 0x2A, 0xD9, 0x59, 0x92, 0xAE, 0x95, 0xD1, 0x9F,
+    0xFC, 0xAE, 0x1E, 0x9F, 0xFD, 0x1A, 0xCA, 0x19, 0xAF, 0xD7, 0x39, 0x94, 0x77, 0x29, 0x77, 0x39,
+    0xFC, 0x97, 0x7A, 0xFE, 0x76, 0xAD, 0x91, 0xAD, 0x76, 0xDA, 0x39, 0x76, 0xAD, 0x77, 0x4E, 0x77,
+    0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x4D, 0xA7, 0x73, 0x9D, 0xA7, 0x73,
+    0xAD, 0x97, 0x73, 0xE7, 0x74, 0xE7, 0x73, 0x9D, 0xA7, 0x73, 0xAD, 0x97, 0x73, 0xAD, 0x77, 0x4E,
+    0x77, 0x4E, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x4D, 0xA7, 0x73,
+    0x9D, 0x97, 0x73, 0xE7, 0x74, 0xE7, 0x73, 0x9D, 0x97, 0x5D, 0x92, 0xE7, 0x59, 0xFA, 0xE9, 0x76,
+    0xFE, 0x97, 0x70, 0xAA, 0xAA, 0x97, 0x70, 0x77, 0x77, 0x77, 0xE7, 0x76, 0xE9, 0x77, 0x49, 0xE7,
+    0x75, 0xEA, 0x71, 0xAF, 0xE9, 0x1A, 0xE7, 0x0A, 0xFF, 0xEA, 0xDA, 0x79, 0xFA, 0x99, 0x99, 0xFD,
+    0x97, 0x9E, 0xA6, 0x9E, 0xA7, 0x9E, 0x97, 0x0A, 0xE9, 0x6E, 0xA7, 0x2E, 0xA5, 0xAE, 0x73, 0xAE,
+    0x5E, 0x74, 0xAE, 0x4A, 0xE7, 0x49, 0xE4, 0xE9, 0x74, 0x9E, 0x4E, 0x75, 0x9E, 0x39, 0xE7, 0x5A,
+    0xE3, 0xAE, 0x75, 0xEA, 0x3A, 0xE7, 0x5E, 0x93, 0xAE, 0x74, 0x9E, 0x4A, 0xE7, 0x4E, 0xA4, 0x9E,
+    0x73, 0x9E, 0x6E, 0x97, 0x2E, 0x96, 0xF7, 0x1E, 0xA7, 0x9E, 0xA6, 0x9F, 0x71, 0xAF, 0x91, 0x99,
+    0xFA, 0x73, 0xAF, 0xFE, 0x97, 0x59, 0xFF, 0x97, 0x73, 0x99, 0x77, 0x76, 0x9A, 0xA7, 0x7E, 0x97,
+    0x6E, 0x97, 0x59, 0xE6, 0x9F, 0xCA, 0x9E, 0x6F, 0xFE, 0x6E, 0xA9, 0x09, 0xF6, 0xE9, 0x4E, 0x5A,
+    0xDA, 0x5A, 0xD9, 0x39, 0xE6, 0xAD, 0xA3, 0xAD, 0x96, 0xAD, 0xA3, 0xE7, 0xAD, 0x92, 0x9E, 0x7E,
+    0x92, 0x9D, 0xA7, 0xE3, 0xAD, 0xA6, 0x9D, 0xA3, 0xAD, 0xA6, 0xE9, 0x3A, 0xDA, 0x5A, 0xE4, 0x9E,
+    0x49, 0xE6, 0xF2, 0xAE, 0x96, 0x9F, 0xFC, 0x71, 0x9F, 0xD9, 0x75, 0x99, 0x73, 0x77, 0x72, 0xAF,
+    0xFC, 0xA9, 0x59, 0xFF, 0xFE, 0x39, 0xF9, 0xE9, 0x29, 0xF2, 0xE9, 0x1E, 0x5E, 0x91, 0xDA, 0x2E,
+    0x5A, 0xDA, 0x19, 0xA9, 0x19, 0xE5, 0xAD, 0xA6, 0xAD, 0xA5, 0xAD, 0xA6, 0xE9, 0x5A, 0xD9, 0x6E,
+    0x6E, 0x7E, 0x5A, 0xD9, 0x69, 0xDA, 0x4E, 0xA7, 0xAD, 0xA0, 0x99, 0xAE, 0xA7, 0x0F, 0xFD, 0x97,
+    0x1F, 0xEA, 0x73, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1E, 0x77, 0x09,
+    0xE7, 0x70, 0xAE, 0x75, 0x9F, 0xFC, 0x72, 0xFF, 0xCA, 0x71, 0x75, 0x97, 0x79, 0xFC, 0x97, 0x3A,
+    0xFE, 0x72, 0xAD, 0x91, 0xAC, 0xA7, 0x19, 0xD9, 0x39, 0x72, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97,
+    0x7A, 0xD7, 0x70, 0xE2, 0x9F, 0x70, 0xDA, 0x1A, 0xFD, 0x69, 0xDA, 0x0E, 0xAF, 0x6A, 0xD9, 0xAC,
+    0xA2, 0xE9, 0x5A, 0xD9, 0xCA, 0x3A, 0xDA, 0x5F, 0xC4, 0xAD, 0xA5, 0xF5, 0xAD, 0x94, 0x9E, 0xA5,
+    0xE9, 0x4A, 0xE6, 0xE5, 0xAD, 0xA6, 0xE5, 0xE6, 0xAD, 0x95, 0xE6, 0xE5, 0x9D, 0xA5, 0xAD, 0x95,
+    0xAD, 0x94, 0x9D, 0xA6, 0xFA, 0x91, 0xAE, 0x7F, 0xFD, 0xA7, 0x0D, 0xAA, 0xFC, 0x97, 0x09, 0xD9,
+    0x19, 0x97, 0x3A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xDA, 0x76, 0x9F, 0xA9, 0x97, 0x2A, 0xFF,
+    0x97, 0x19, 0x99, 0x99, 0x99, 0x99, 0x72, 0x69, 0x70, 0x9D, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD5,
+    0x9A, 0xAF, 0xFA, 0xFF, 0xDA, 0x99, 0x9A, 0xDA, 0x99, 0x99, 0x3A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D,
+    0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x3C, 0xA1, 0xAD, 0x91, 0x9D,
+    0xA1, 0xAE, 0xAF, 0xA1, 0xAF, 0xF9, 0x2F, 0xC9, 0xD5, 0x91, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x70,
+    0xDA, 0x29, 0xD1, 0xAD, 0x3F, 0xE9, 0x3A, 0xFC, 0x95, 0x9A, 0xA9, 0x60, 0x29, 0xAF, 0xFF, 0xE0,
+    0x9F, 0xFF, 0xFD, 0x0F, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xDA, 0xAE, 0x3A, 0xDA, 0x4D, 0x9A, 0xD9,
+    0x3A, 0xD9, 0x4D, 0x0A, 0xD4, 0xE9, 0x4D, 0x19, 0x94, 0xE4, 0x9C, 0x97, 0x9E, 0x77, 0xAD, 0xA7,
+    0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77,
+    0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x76, 0x9E, 0x97, 0x4A, 0xFF, 0x71, 0xAF, 0xFC, 0x70, 0x72,
+    0x97, 0x29, 0xFC, 0x96, 0xAF, 0xE5, 0x9D, 0x91, 0xDA, 0x5D, 0x93, 0x95, 0xAD, 0x73, 0xDA, 0x72,
+    0x9D, 0x97, 0x2A, 0xD7, 0x09, 0xAF, 0xFC, 0x2A, 0xFF, 0xDA, 0x29, 0x99, 0xAD, 0xA9, 0x99, 0x96,
+    0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xE7, 0x29,
+    0xDA, 0x72, 0xAD, 0x93, 0xCA, 0x4A, 0xD9, 0x19, 0xDA, 0x4A, 0xEA, 0xF5, 0xAF, 0xE7, 0xFC, 0x97,
+    0x29, 0x71, 0x09, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFD, 0x0E, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAD,
+    0xA0, 0xDA, 0x3A, 0xDA, 0x4D, 0x90, 0xD4, 0xAD, 0x94, 0xD1, 0xD4, 0xE5, 0xD1, 0xCA, 0x4E, 0x49,
+    0xC9, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77,
+    0xE9, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x9E, 0x77,
+    0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xAD, 0x97, 0x79, 0xD9, 0x2C, 0xA7, 0x29, 0xE9, 0x9E, 0x73, 0xFE,
+    0xA7, 0x4F, 0xCA, 0x76, 0x99, 0x97, 0x10, 0x77, 0x77, 0x76, 0x9D, 0xA7, 0x75, 0x9E, 0x77, 0x59,
+    0xE7, 0x74, 0x9E, 0x90, 0x9F, 0xF5, 0xFF, 0x91, 0xAF, 0xEA, 0x5F, 0xDA, 0x59, 0xE9, 0x70, 0x9E,
+    0x70, 0xE7, 0x2E, 0x79, 0xE7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7E, 0x97, 0x19, 0xD9, 0x7E,
+    0x72, 0xAD, 0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72, 0xDA, 0x7A, 0xD9, 0x71, 0x9D, 0x97, 0xE9, 0x71,
+    0x9D, 0x70, 0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7, 0x9D, 0xA7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9,
+    0x7A, 0xDA, 0x71, 0xAD, 0x70, 0xAD, 0xA7, 0x1D, 0xA7, 0x0A, 0xE7, 0x0E, 0x71, 0x9E, 0xA6, 0xE9,
+    0x72, 0xFC, 0xA9, 0x9A, 0xFA, 0x74, 0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x77,
+    0x1A, 0xCA, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x70, 0x9E, 0x91, 0x9A, 0xF6, 0xAF, 0x91, 0x9F, 0xD5,
+    0x9E, 0x94, 0x99, 0x9E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x5E,
+    0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x70, 0xAD, 0x94, 0x9E, 0x70, 0xE5,
+    0xEA, 0x70, 0xE4, 0xAE, 0x97, 0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA4, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D,
+    0x49, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x5F, 0xE2, 0xFC, 0x6A, 0xFA, 0x3E, 0xA7, 0x19, 0x79, 0x70,
+    0x19, 0x4D, 0x39, 0xE3, 0xEA, 0x29, 0xE9, 0x3E, 0x4D, 0x94, 0xA0, 0x3A, 0x93, 0xAD, 0x29, 0xE2,
+    0xE9, 0x1E, 0x91, 0xAD, 0x92, 0xD7, 0x30, 0x59, 0x97, 0xEA, 0x5F, 0xC4, 0xAD, 0xAD, 0xA2, 0xAD,
+    0x90, 0xE1, 0x9D, 0x91, 0x9D, 0x99, 0xD9, 0x3D, 0x90, 0xA9, 0x59, 0x00, 0x39, 0x70, 0xAE, 0x91,
+    0xAC, 0x1A, 0xFC, 0x09, 0xD1, 0xDA, 0x9F, 0xCA, 0x1D, 0x19, 0xF7, 0x9A, 0x92, 0x09, 0x99, 0x99,
+    0x99, 0x90, 0xFF, 0xFF, 0xEA, 0x71, 0x72, 0x9C, 0xA5, 0xC0, 0xAD, 0x39, 0xD0, 0xAE, 0xAA, 0xE9,
+    0x1F, 0xE9, 0x3A, 0xEA, 0x30, 0x1A, 0xCA, 0x1A, 0xE1, 0xF1, 0xE9, 0x29, 0x20, 0x19, 0x94, 0x99,
+    0x1A, 0xDA, 0x2E, 0x1E, 0xA1, 0xAE, 0x1E, 0x2A, 0xDA, 0x29, 0x49, 0x91, 0x29, 0x99, 0x93, 0xFC,
+    0xA1, 0xE9, 0xE0, 0x9D, 0x19, 0xD1, 0xC9, 0x1A, 0xD4, 0xAD, 0x93, 0xE9, 0x3E, 0x5D, 0x79, 0x40,
+    0x71, 0xAE, 0xA1, 0xFD, 0x9A, 0xD1, 0xAF, 0x91, 0x9F, 0x91, 0x9F, 0xA1, 0xD9, 0x9F, 0xD1, 0xAE,
+    0xA7, 0x10, 0x49, 0x39, 0x94, 0xDA, 0x2D, 0x92, 0xAD, 0xA1, 0xAD, 0xA1, 0x9E, 0x19, 0xE2, 0xE9,
+    0x1E, 0x91, 0xE9, 0x1E, 0x92, 0xD2, 0x9D, 0x49, 0x49, 0x40, 0x09, 0x94, 0x9A, 0x09, 0xD3, 0xAD,
+    0x99, 0xD9, 0x1A, 0xD9, 0x1E, 0x09, 0xD9, 0x29, 0xDA, 0xDA, 0x4F, 0xA5, 0x9E, 0x77, 0x19, 0x39,
+    0x2A, 0xCA, 0x1A, 0xCA, 0x1E, 0x1E, 0x1E, 0x1E, 0x19, 0xD9, 0x09, 0xD9, 0x1D, 0xA1, 0xDA, 0x2D,
+    0x2D, 0x29, 0x39, 0x00, 0x49, 0x99, 0x5A, 0xFC, 0xA2, 0xFF, 0x90, 0xE9, 0x1A, 0xDA, 0x9C, 0x94,
+    0xDA, 0x09, 0x59, 0xA7, 0x30, 0x3A, 0xA1, 0x9D, 0x91, 0xDA, 0x1A, 0xD2, 0xD9, 0x1A, 0xD9, 0x1E,
+    0xA1, 0xAE, 0x2D, 0xA1, 0x29, 0xA9, 0x2A, 0xE3, 0xEA, 0x2E, 0x92, 0xE3, 0xDA, 0x2A, 0xD2, 0x9D,
+    0x92, 0xD9, 0x71, 0x19, 0xA9, 0x1A, 0xE9, 0x0E, 0xA0, 0x9D, 0xA1, 0x9D, 0x91, 0x9D, 0x3D, 0x92,
+    0xAC, 0xA3, 0xD7, 0x6D, 0xA1, 0xE1, 0xD9, 0x09, 0xD1, 0xAC, 0xA1, 0xD2, 0xCA, 0x29, 0x20, 0x19,
+    0xAC, 0x2A, 0xDA, 0x1A, 0xDA, 0x1E, 0x1E, 0x90, 0x9D, 0x2A, 0xA7, 0x10, 0x7E, 0x1F, 0x1F, 0x1E,
+    0x70, 0x1A, 0xC9, 0x29, 0xCA, 0x1E, 0xA1, 0x9E, 0x99, 0xE9, 0x1A, 0xE1, 0xDA, 0x29, 0xD9, 0x74,
+    0x39, 0x4F, 0xA1, 0xDA, 0x9D, 0x09, 0xCA, 0x1A, 0xC9, 0x9C, 0xA1, 0xAC, 0x99, 0xD0, 0x9D, 0x1A,
+    0xF9, 0x29, 0xA9, 0x20, 0x39, 0x4E, 0x3E, 0x92, 0xE3, 0xDA, 0x2A, 0xD2, 0xAD, 0x39, 0x93, 0x39,
+    0x49, 0xEA, 0x29, 0xAE, 0x4A, 0xD4, 0xDA, 0x3E, 0x2A, 0xDA, 0x39, 0xA4, 0x39, 0x93, 0xCA, 0x3D,
+    0x3A, 0xC9, 0x3D, 0x93, 0xDA, 0x92, 0xFC, 0xA1, 0xAD, 0xA0, 0x6E, 0x1D, 0xA1, 0xD9, 0x09, 0xD1,
+    0xAD, 0x1E, 0x1A, 0xA9, 0x00, 0x49, 0x9A, 0x69, 0xF4, 0x9F, 0xCA, 0x29, 0xE9, 0xE9, 0x09, 0xE2,
+    0xDA, 0xAD, 0xA3, 0x9D, 0x09, 0x69, 0x00, 0x73, 0x9C, 0x6A, 0x0D, 0x94, 0xCA, 0x0E, 0xA9, 0x9A,
+    0xD9, 0x0A, 0xFE, 0x92, 0xAF, 0xC9, 0x59, 0x94, 0x29, 0x97, 0x0A, 0xE9, 0x1A, 0xC1, 0xAF, 0xC0,
+    0x9D, 0x1D, 0xA9, 0xFC, 0xA1, 0xD1, 0x9F, 0x79, 0xA9, 0x20, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF,
+    0xFF, 0xEA, 0x49, 0x99, 0x5A, 0xFC, 0xA2, 0xFF, 0x90, 0xE9, 0x1A, 0xDA, 0x9C, 0x94, 0xDA, 0x09,
+    0x59, 0xA7, 0x30, 0x70, 0x9A, 0x71, 0xE7, 0xAE, 0x69, 0xE7, 0xE7, 0xAD, 0x70, 0xD7, 0x71, 0x9A,
+    0x4A, 0xA1, 0xF2, 0xE9, 0x9E, 0xA1, 0xAE, 0x90, 0xE2, 0x9E, 0x29, 0x49, 0x91, 0x0A, 0xAA, 0x2D,
+    0x91, 0x9D, 0x91, 0xAD, 0xA1, 0x9F, 0x90, 0xAD, 0x90, 0x77, 0x09, 0x77, 0x5E, 0x77, 0x4F, 0x77,
+    0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E,
+    0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74,
+    0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9,
+    0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC,
+    0x00, 0x77, 0x70, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFC, 0x5A, 0xA9, 0xAD, 0xA2, 0xAF, 0x7E, 0x94,
+    0xE9, 0x6E, 0x5A, 0xDA, 0x6E, 0x5A, 0xDA, 0x59, 0xDA, 0x5A, 0xD9, 0x5A, 0xD9, 0x5E, 0x6E, 0x94,
+    0xAD, 0x96, 0xE9, 0x3A, 0xDA, 0x7F, 0xFD, 0x97, 0x9F, 0xFE, 0x96, 0xAD, 0x93, 0x9F, 0x95, 0xE6,
+    0xAE, 0x5E, 0x7E, 0x49, 0xE7, 0xE4, 0x9D, 0xA7, 0xE4, 0xAD, 0x96, 0x9E, 0x4E, 0x7E, 0x94, 0xE6,
+    0xAE, 0x49, 0xE9, 0x99, 0x09, 0x9F, 0x3A, 0xFF, 0xFC, 0xA3, 0xAF, 0xFE, 0xA9, 0x77, 0x71, 0x4F,
+    0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x5A, 0xD7, 0xE6,
+    0xAD, 0x7E, 0x6A, 0xD6, 0x9E, 0x6A, 0xC9, 0x6A, 0xDA, 0x69, 0x97, 0xE9, 0x77, 0x0E, 0x77, 0x1E,
+    0x77, 0x09, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7,
+    0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x6A, 0xFF, 0x72, 0xAF, 0xFA, 0x72,
+    0x75, 0x97, 0x70, 0xAD, 0x77, 0xAE, 0x97, 0x6F, 0xA7, 0x5A, 0xCA, 0xDA, 0x74, 0x9D, 0x0E, 0x74,
+    0xDA, 0x0A, 0xD7, 0x39, 0xD1, 0xAD, 0x97, 0x2D, 0x91, 0x9D, 0x97, 0x1A, 0xD2, 0x9D, 0xA7, 0x1D,
+    0x93, 0xE7, 0x0E, 0x4E, 0x79, 0xD9, 0x4E, 0x7D, 0xA5, 0xAD, 0x95, 0xAD, 0x69, 0xDA, 0x5D, 0xA6,
+    0x9E, 0x4A, 0xD7, 0x0E, 0x4D, 0xA7, 0x0E, 0x3E, 0x71, 0xE9, 0x19, 0xD9, 0x71, 0xAD, 0xA1, 0xE7,
+    0x29, 0xE0, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE0, 0xFF, 0xFF, 0xE0, 0x9F, 0xFF, 0xFC,
+    0x90, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D,
+    0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E,
+    0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E,
+    0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5,
+    0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x30, 0x4F, 0xFF, 0xD9,
+    0x39, 0xFF, 0xFE, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x3D, 0xA7, 0xEA, 0x4D, 0x96, 0xAE,
+    0x5D, 0x6A, 0xE6, 0xA9, 0x59, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xE7,
+    0x69, 0xE7, 0x69, 0xE9, 0x76, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0xAC, 0x4A, 0xE7, 0x0D, 0x39, 0xE7,
+    0x0A, 0xD2, 0x9E, 0x97, 0x0E, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x91, 0x9F, 0xFF, 0xF3, 0xFF,
+    0xFE, 0xA7, 0x76, 0x4F, 0xFA, 0x4A, 0xFF, 0x5F, 0xF9, 0x4F, 0xFA, 0x69, 0xAE, 0x97, 0x0A, 0xE9,
+    0x71, 0xAD, 0x97, 0x1A, 0xDA, 0x72, 0xE9, 0x71, 0xE9, 0x72, 0xE7, 0x2E, 0x72, 0x9E, 0x72, 0xE7,
+    0x2A, 0xDA, 0x71, 0x9D, 0xA7, 0x2E, 0x97, 0x1A, 0xDA, 0x72, 0xE7, 0x2E, 0x97, 0x2F, 0xFF, 0xFC,
+    0x72, 0x9F, 0xFF, 0xFC, 0x72, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x72, 0xE9, 0x71,
+    0xAD, 0x97, 0x2E, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x29, 0xDA, 0x71, 0x9E, 0x72, 0xAD, 0xA7,
+    0x1A, 0xDA, 0x72, 0xE9, 0x71, 0xE9, 0x72, 0xE7, 0x2E, 0x72, 0x9E, 0x71, 0x9E, 0x97, 0xAF, 0xE9,
+    0x4A, 0xFE, 0xA4, 0xAF, 0xF4, 0x9F, 0xF9, 0x40, 0x77, 0x77, 0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70,
+    0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA,
+    0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1, 0xE3, 0xAF,
+    0xDA, 0x19, 0xE0, 0x9E, 0x2F, 0xF9, 0x1A, 0xE0, 0xAE, 0x2D, 0xAA, 0xAA, 0xA9, 0x2E, 0xA0, 0xAE,
+    0x75, 0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9,
+    0x3F, 0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29,
+    0xFF, 0x97, 0x70, 0x99, 0x74, 0x4F, 0xFC, 0x5F, 0xF9, 0x69, 0xAE, 0x97, 0x1A, 0xD9, 0x72, 0xE9,
+    0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0xAD, 0xA7,
+    0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7,
+    0x0A, 0xFE, 0x94, 0xAF, 0xF9, 0x40, 0x4F, 0xFA, 0x2F, 0xF4, 0xFF, 0x91, 0x9F, 0xE9, 0x59, 0xAE,
+    0x95, 0xF9, 0x70, 0xAD, 0x95, 0xEA, 0x72, 0xE9, 0x4E, 0xA7, 0x3E, 0x4E, 0x97, 0x39, 0xE2, 0x9E,
+    0x97, 0x4A, 0xDA, 0x19, 0xE7, 0x6E, 0x90, 0xAD, 0xA7, 0x7E, 0x0A, 0xDA, 0x77, 0x0F, 0xD9, 0x77,
+    0x09, 0xFD, 0x97, 0x70, 0xAD, 0xAA, 0xE7, 0x70, 0xE9, 0x0E, 0xA7, 0x7E, 0x19, 0xE9, 0x75, 0x9E,
+    0x2A, 0xE7, 0x59, 0xDA, 0x3F, 0x74, 0xAD, 0xA3, 0x9E, 0xA7, 0x3E, 0x94, 0xAE, 0xA7, 0x2E, 0x6F,
+    0xA7, 0x09, 0xE7, 0xFC, 0x5A, 0xFF, 0x5F, 0xC9, 0x2A, 0xFF, 0xC6, 0xAF, 0x77, 0x59, 0x93, 0x77,
+    0x09, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF7, 0x73, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71,
+    0xD9, 0x9D, 0xA7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x2E, 0x77, 0xAC, 0xA2, 0xE9, 0x75, 0x9D, 0x3A,
+    0xD9, 0x75, 0xDA, 0x3A, 0xDA, 0x74, 0x9D, 0x49, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xD6, 0xE7, 0x3D,
+    0xA6, 0xE9, 0x71, 0xAD, 0x7E, 0xA7, 0x1D, 0xA7, 0xAD, 0xA7, 0x0E, 0x70, 0x9E, 0x79, 0xD9, 0x70,
+    0x9E, 0x7E, 0x72, 0xE9, 0x59, 0xD9, 0x72, 0xEA, 0x3A, 0xFD, 0xA5, 0x9F, 0xF0, 0x9F, 0xF5, 0xFF,
+    0xC0, 0x6F, 0xE7, 0x1A, 0xFD, 0x96, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFC, 0x97, 0xFC, 0xA7, 0x3F,
+    0xC9, 0x69, 0xFC, 0x97, 0x29, 0xDA, 0xDA, 0x6D, 0xAE, 0x97, 0x2A, 0xD9, 0xDA, 0x59, 0xD0, 0xE7,
+    0x3D, 0xA0, 0xE5, 0xDA, 0x0E, 0x72, 0x9D, 0x90, 0xE4, 0xAD, 0x1E, 0x72, 0xAD, 0x1E, 0x4D, 0x91,
+    0xE7, 0x2E, 0x1A, 0xD9, 0x2A, 0xD2, 0xE7, 0x2D, 0xA1, 0xAD, 0x92, 0xD9, 0x2E, 0x71, 0x9D, 0x29,
+    0xDA, 0x1A, 0xD2, 0x9D, 0xA7, 0x1E, 0x3E, 0x1D, 0x39, 0xDA, 0x71, 0xDA, 0x3E, 0x0D, 0xA3, 0x9D,
+    0xA7, 0x09, 0xD9, 0x3E, 0x9D, 0x4A, 0xDA, 0x70, 0xAD, 0x4A, 0xF9, 0x4A, 0xD9, 0x70, 0xE4, 0xAF,
+    0x5A, 0xD9, 0x79, 0xD9, 0x49, 0xE9, 0x5A, 0xD9, 0x7A, 0xD6, 0xE6, 0xE7, 0x0E, 0x6D, 0x7E, 0x79,
+    0xDA, 0x77, 0x0E, 0x94, 0xAF, 0xE7, 0x39, 0xFE, 0x91, 0x9F, 0xF7, 0x3F, 0xF9, 0x10, 0x4F, 0xC9,
+    0x7F, 0xF5, 0xFC, 0xA7, 0xFE, 0xA6, 0x9F, 0x71, 0xAD, 0x97, 0x1F, 0xA7, 0x0E, 0x72, 0xFC, 0x70,
+    0xDA, 0x72, 0xFC, 0xA7, 0xDA, 0x71, 0x9D, 0xAE, 0x69, 0xD9, 0x71, 0xAD, 0x0E, 0x95, 0xAD, 0x72,
+    0xE0, 0xAE, 0x5E, 0x72, 0xDA, 0x1E, 0x94, 0xDA, 0x71, 0x9D, 0x91, 0xAD, 0xA4, 0xD9, 0x71, 0x9D,
+    0x3E, 0x39, 0xD9, 0x71, 0xAD, 0x3A, 0xDA, 0x2A, 0xD7, 0x2E, 0x4E, 0x2E, 0x72, 0xDA, 0x4E, 0xA1,
+    0xDA, 0x71, 0x9D, 0x94, 0x9E, 0x1D, 0x97, 0x1A, 0xD6, 0xE9, 0x9D, 0x72, 0xE6, 0x9E, 0xAD, 0x72,
+    0xE7, 0xFD, 0x72, 0xDA, 0x79, 0xFA, 0x71, 0x9D, 0x97, 0x0F, 0x97, 0xAF, 0xDA, 0x6A, 0xE7, 0xAF,
+    0xEA, 0x7E, 0x77, 0x70, 0x97, 0x10, 0x4A, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0x5F, 0xFF, 0xF4, 0x9D,
+    0x97, 0x1E, 0x49, 0xD7, 0x2D, 0xA4, 0x9D, 0x72, 0xD9, 0x5C, 0x97, 0x2C, 0xA7, 0x77, 0x77, 0x77,
+    0x77, 0x2F, 0xFC, 0x97, 0x2A, 0xFF, 0xC7, 0x3A, 0xCA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xC9, 0x73, 0xC9, 0x4D, 0x97, 0x2A, 0xCA, 0x39, 0xD7, 0x3D, 0xA3, 0xAD, 0x73, 0xD9,
+    0x3F, 0xEA, 0xAA, 0xFE, 0x93, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xC3, 0x77, 0x77, 0xAF, 0xE9, 0x73,
+    0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4,
+    0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49,
+    0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7,
+    0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49,
+    0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99,
+    0x74, 0x4F, 0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFF, 0xC6, 0x9A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA7,
+    0x1A, 0xD9, 0x70, 0xE7, 0x2E, 0x97, 0x9E, 0x72, 0xE7, 0x09, 0xDA, 0x71, 0x9E, 0x70, 0xAD, 0xA7,
+    0x1A, 0xDA, 0x70, 0xE9, 0x71, 0xE9, 0x70, 0xE7, 0x2E, 0x70, 0x9E, 0x72, 0xE7, 0x0A, 0xDA, 0x71,
+    0x9E, 0x70, 0xAD, 0x97, 0x1A, 0xDA, 0x70, 0xE7, 0x2E, 0x97, 0x0E, 0x72, 0xE7, 0x09, 0xE7, 0x19,
+    0xE7, 0x0A, 0xDA, 0x71, 0x9D, 0xA7, 0x0E, 0x97, 0x1A, 0xDA, 0x70, 0xE7, 0x2E, 0x97, 0x0E, 0x72,
+    0xE7, 0x09, 0xE7, 0x19, 0xE7, 0x0A, 0xDA, 0x7A, 0xFE, 0x92, 0x9F, 0xF4, 0xAF, 0xF3, 0xFF, 0xC4,
+    0x77, 0x70, 0x9A, 0xFF, 0xCA, 0x6A, 0xFF, 0xFC, 0x94, 0xAA, 0x9A, 0xDA, 0x29, 0xF7, 0xAD, 0x94,
+    0xEA, 0x6E, 0x59, 0xE6, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x5A, 0xDA, 0x59, 0xDA, 0x5E, 0x95, 0xE9,
+    0x5E, 0x5A, 0xDA, 0x6E, 0x4A, 0xE6, 0x9E, 0x09, 0x9A, 0xF7, 0xAF, 0xFC, 0x97, 0x0F, 0xEA, 0x97,
+    0x2E, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE7, 0x79, 0xE7, 0x5A, 0xFF,
+    0x71, 0xAF, 0xFC, 0x71, 0x49, 0xFF, 0xFD, 0x94, 0xFF, 0xFE, 0x94, 0xFA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x94, 0x9E, 0x7A, 0xD6, 0xEA, 0x6A, 0xD6, 0x9E, 0x69, 0xCA, 0x7A, 0xDA, 0x59, 0xA7, 0x1E, 0x77,
+    0x1A, 0xE7, 0x71, 0xE9, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77,
+    0x9E, 0x77, 0x9E, 0x79, 0xC9, 0x49, 0xE7, 0x0D, 0x94, 0xE7, 0x09, 0xD4, 0xE9, 0x70, 0xE3, 0xFF,
+    0xFF, 0xA2, 0x9F, 0xFF, 0xF4, 0xFF, 0xFE, 0xA7, 0x77, 0x00, 0x09, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF,
+    0xFD, 0x0E, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAD, 0xA0, 0xDA, 0x3A, 0xDA, 0x4D, 0x90, 0xD4, 0xAD,
+    0x94, 0xD1, 0xD4, 0xE9, 0x4D, 0x1C, 0xA4, 0xE4, 0x9C, 0x97, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97,
+    0x7E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7,
+    0x7A, 0xDA, 0x77, 0xE9, 0x76, 0x9E, 0x97, 0x4A, 0xFF, 0x71, 0xAF, 0xFC, 0x70, 0x77, 0x70, 0xAD,
+    0xA7, 0x1A, 0xD9, 0x1A, 0xFC, 0x70, 0xAF, 0x09, 0xFD, 0x96, 0xAF, 0x5F, 0x59, 0xF6, 0xAE, 0x5F,
+    0x70, 0xE9, 0x3A, 0xE7, 0x1E, 0x93, 0xE7, 0x29, 0xDA, 0x2E, 0x97, 0x3E, 0x19, 0xDA, 0x74, 0xE1,
+    0xE7, 0x5A, 0xD0, 0x9D, 0x76, 0x9D, 0x9D, 0xA7, 0x7D, 0xAD, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x71,
+    0xE9, 0x77, 0x1E, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xEA, 0x76, 0xAF, 0xF9,
+    0x72, 0xAF, 0xFC, 0x97, 0x00, 0x71, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x6F, 0xF7, 0x71, 0xAD, 0xA7,
+    0x73, 0xAD, 0x97, 0x70, 0x9A, 0xAE, 0xAA, 0xA9, 0x72, 0xAF, 0xFF, 0xC9, 0x69, 0xFA, 0x9A, 0xE9,
+    0xAF, 0xA4, 0x9E, 0xA2, 0x9D, 0x92, 0xAE, 0x92, 0x9E, 0x4A, 0xD4, 0xAD, 0xA2, 0xE9, 0x4E, 0x49,
+    0xE1, 0x9E, 0x5E, 0x5E, 0x1A, 0xD9, 0x49, 0xDA, 0x5E, 0x1E, 0x94, 0x9D, 0x94, 0x9E, 0x1E, 0x5A,
+    0xD5, 0xAD, 0xA1, 0xE9, 0x4E, 0x5E, 0x91, 0xEA, 0x4E, 0x4A, 0xDA, 0x2A, 0xE3, 0x9D, 0xA3, 0xAE,
+    0x4F, 0x91, 0x9D, 0x91, 0xAF, 0x6F, 0xFF, 0xEA, 0x70, 0x9F, 0xFD, 0xA9, 0x76, 0x9E, 0x77, 0x39,
+    0xDA, 0x77, 0x29, 0xAD, 0xA9, 0x77, 0x9F, 0xF7, 0x69, 0xAA, 0xAA, 0xAA, 0xA9, 0x71, 0x5F, 0xFA,
+    0x2F, 0xF5, 0x9F, 0xF3, 0xFE, 0xA7, 0x9F, 0x96, 0xEA, 0x72, 0xAE, 0x6A, 0xD9, 0x74, 0xE9, 0x4A,
+    0xDA, 0x75, 0xAE, 0x39, 0xDA, 0x77, 0xE3, 0xDA, 0x77, 0x0A, 0xDA, 0x1E, 0x77, 0x2E, 0x0E, 0x77,
+    0x3A, 0xFC, 0x77, 0x5F, 0x77, 0x6F, 0x77, 0x5F, 0xC9, 0x77, 0x3E, 0x9E, 0x77, 0x2A, 0xD1, 0xE9,
+    0x77, 0x0A, 0xD9, 0x19, 0xE7, 0x7A, 0xD9, 0x3E, 0x97, 0x59, 0xDA, 0x49, 0xE7, 0x49, 0xE6, 0xE9,
+    0x73, 0xE7, 0x9E, 0x71, 0x9E, 0x97, 0x0E, 0xA6, 0xAF, 0xE9, 0x39, 0xFF, 0x92, 0x9F, 0xF9, 0x3F,
+    0xFC, 0x30, 0x77, 0x70, 0x9D, 0xA3, 0xFF, 0xA3, 0xAD, 0x90, 0xE2, 0x9F, 0xF9, 0x2A, 0xDA, 0x1E,
+    0x49, 0xEA, 0x49, 0xE2, 0xE5, 0xE5, 0xAD, 0xA2, 0xE5, 0xE5, 0xE3, 0xE4, 0x9D, 0xA4, 0x9E, 0x3E,
+    0x4A, 0xDA, 0x4A, 0xD9, 0x3E, 0x4E, 0x94, 0xE4, 0xE4, 0xE4, 0x9D, 0xA4, 0xE4, 0xE4, 0xE9, 0x4E,
+    0x39, 0xDA, 0x39, 0xE5, 0xE9, 0x2A, 0xD9, 0x3E, 0x95, 0xAE, 0x2E, 0x92, 0xEA, 0x7F, 0x90, 0xE1,
+    0xAE, 0xA7, 0x09, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xC9, 0x77, 0x0E, 0xA7, 0x74, 0xE7, 0x75, 0xE7,
+    0x74, 0x9E, 0x77, 0x4A, 0xDA, 0x77, 0x19, 0xFF, 0x77, 0xFF, 0xC7, 0x40, 0x77, 0x77, 0x49, 0xAF,
+    0xEA, 0x76, 0xFF, 0xF9, 0x72, 0x9F, 0xA9, 0x99, 0x9A, 0xF9, 0x70, 0xAE, 0xA7, 0xF7, 0x9E, 0x97,
+    0x1E, 0xA6, 0xEA, 0x72, 0xF5, 0x9E, 0x73, 0xAE, 0x5E, 0xA7, 0x39, 0xE5, 0xE9, 0x73, 0xAE, 0x49,
+    0xE7, 0x4A, 0xE4, 0x9E, 0x74, 0xEA, 0x49, 0xE7, 0x4E, 0x59, 0xE7, 0x39, 0xE6, 0xE7, 0x3E, 0x96,
+    0xE7, 0x2A, 0xDA, 0x7A, 0xD9, 0x70, 0x9E, 0x71, 0xE7, 0x0E, 0x6C, 0x91, 0xAD, 0x7E, 0x2C, 0x91,
+    0xAC, 0x92, 0xE4, 0x9E, 0x2A, 0xC9, 0x1D, 0x93, 0xDA, 0x2A, 0xDA, 0x3D, 0x91, 0xEA, 0xAA, 0x9A,
+    0xCA, 0x2E, 0x9A, 0xAA, 0xE2, 0xFF, 0xC9, 0x2F, 0xFD, 0x19, 0xFF, 0xA3, 0xFF, 0xCA, 0x10, 0x77,
+    0x70, 0xAF, 0x3D, 0x94, 0x9F, 0xE1, 0x9E, 0x39, 0xEA, 0xAE, 0xA0, 0xAD, 0x93, 0xE3, 0xAD, 0x0E,
+    0x3A, 0xD5, 0xDA, 0xD9, 0x29, 0xDA, 0x5F, 0xC3, 0xAD, 0x6A, 0xE9, 0x3E, 0x69, 0xDA, 0x39, 0xDA,
+    0x69, 0xD4, 0x9D, 0x96, 0xDA, 0x4A, 0xD9, 0x5A, 0xDA, 0x4A, 0xD9, 0x49, 0xEA, 0x4A, 0xDA, 0x4F,
+    0xC4, 0x9E, 0x29, 0xE9, 0xD2, 0x91, 0xFA, 0xF1, 0xEA, 0xD9, 0x0F, 0xF2, 0xFC, 0xA2, 0xFC, 0xA3,
+    0x9E, 0xA5, 0x97, 0x09, 0x30, 0x72, 0xAA, 0xA9, 0x72, 0xAF, 0xD7, 0x0E, 0xAF, 0x96, 0xE2, 0xAD,
+    0xA5, 0xAD, 0x39, 0xDA, 0x49, 0xD9, 0x4D, 0xA4, 0xAD, 0x49, 0xD5, 0xDA, 0x4E, 0x49, 0xD9, 0x39,
+    0xD9, 0x49, 0xD4, 0xDA, 0x5A, 0xD3, 0xE6, 0xE1, 0x9E, 0x7D, 0xA0, 0x9F, 0xC6, 0xDA, 0x1A, 0xAF,
+    0x49, 0xD9, 0x4E, 0xA3, 0xAD, 0x59, 0xE3, 0xE6, 0xE3, 0xE6, 0xE3, 0xDA, 0x6E, 0x29, 0xD9, 0x6E,
+    0x29, 0xD9, 0x59, 0xDA, 0x2A, 0xD6, 0xAD, 0x3E, 0x59, 0xDA, 0x3E, 0xA9, 0x2A, 0xE4, 0xFF, 0xDA,
+    0x49, 0xDA, 0xFD, 0x95, 0xAD, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0x9D, 0x97,
+    0x4A, 0xD7, 0x5A, 0xA7, 0x60, 0x77, 0x19, 0xAE, 0x5E, 0x90, 0x9F, 0xCA, 0x4A, 0xE1, 0x99, 0xAE,
+    0x49, 0xE4, 0xE5, 0xE4, 0xE9, 0x4D, 0xA4, 0xAD, 0x93, 0x9D, 0x94, 0x9D, 0xA3, 0xAD, 0x6D, 0xA3,
+    0xDA, 0x6E, 0x29, 0xD9, 0x6E, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x0A, 0xD1, 0xD9, 0x70, 0x9D, 0x0D,
+    0xA7, 0x19, 0xDA, 0xD7, 0x29, 0xF7, 0x39, 0xE9, 0x74, 0xD9, 0x74, 0x9C, 0xA7, 0x5D, 0xA7, 0x49,
+    0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x5A, 0xA7, 0x30, 0x72, 0x9A, 0x97, 0x3F,
+    0xDA, 0x79, 0xFF, 0xA6, 0xD9, 0x29, 0xE5, 0xAD, 0x49, 0xD5, 0xE5, 0xA9, 0x5E, 0x97, 0x4A, 0xE7,
+    0x5E, 0xA7, 0x5E, 0xA7, 0x3A, 0xF9, 0x70, 0xAF, 0xE7, 0xE9, 0x1E, 0xA5, 0xE3, 0x9E, 0x4E, 0x5E,
+    0x92, 0x9D, 0xA5, 0xAD, 0xA2, 0xE6, 0x9E, 0x2E, 0x69, 0xE1, 0x9D, 0xA6, 0x9D, 0xA1, 0xAD, 0xA6,
+    0x9D, 0xA1, 0xAD, 0xA6, 0xAD, 0x91, 0xAE, 0x6E, 0x29, 0xE5, 0xE9, 0x3F, 0x91, 0x9E, 0xA4, 0x9F,
+    0xFC, 0xA7, 0xFE, 0x73, 0x99, 0x97, 0x00, 0x77, 0x3A, 0xFD, 0x4A, 0xFF, 0xA2, 0xAE, 0x99, 0x09,
+    0xDA, 0x2D, 0xA5, 0x92, 0x9D, 0x97, 0x19, 0xD9, 0x72, 0xDA, 0x72, 0x9F, 0xD6, 0xAF, 0xD5, 0xEA,
+    0xA9, 0x95, 0xAD, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xE6, 0x9A, 0x1F, 0xA9, 0x99, 0xAD, 0xA1,
+    0xAF, 0xFD, 0x39, 0xFE, 0x97, 0x99, 0x60, 0x77, 0x1A, 0xCA, 0x71, 0x9D, 0x94, 0x93, 0xE4, 0xAC,
+    0x92, 0xE9, 0x2E, 0xA2, 0xAE, 0xA9, 0xFA, 0x39, 0xFE, 0xA7, 0xD9, 0x71, 0xDA, 0x71, 0xAC, 0xA7,
+    0x19, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE7,
+    0x2E, 0x72, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x2E, 0xA7, 0x1F, 0xA7, 0x1F, 0xCA, 0x70, 0xFD, 0xA7,
+    0x9F, 0xD7, 0x09, 0xFA, 0x71, 0x9E, 0x72, 0xDA, 0x71, 0xAD, 0x97, 0x0A, 0xDA, 0x6A, 0xFA, 0x7F,
+    0x97, 0x19, 0x70, 0x77, 0x09, 0xAE, 0xA2, 0x9F, 0x09, 0xFC, 0xA1, 0xAF, 0xCA, 0x09, 0x99, 0xDA,
+    0x0A, 0xDA, 0xF2, 0x9D, 0x99, 0xCA, 0x2E, 0x29, 0xD9, 0xCA, 0x3E, 0x2A, 0xF4, 0xDA, 0x2F, 0x93,
+    0x9D, 0xA2, 0xEA, 0x49, 0xD9, 0x19, 0xE5, 0xAD, 0x2A, 0xDA, 0x5E, 0x2E, 0x95, 0xE2, 0xE6, 0xDA,
+    0x19, 0xDA, 0x59, 0xD9, 0x1A, 0xD9, 0x5A, 0xD2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x59, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x39,
+    0x95, 0x79, 0xAA, 0xA9, 0x72, 0xFE, 0x70, 0xFA, 0xF6, 0xE3, 0xEA, 0x4E, 0x5E, 0x3A, 0xD9, 0x5E,
+    0x3D, 0xA6, 0xAD, 0x91, 0xAD, 0x7A, 0xDA, 0x1E, 0x79, 0xDA, 0x09, 0xD9, 0x79, 0xDA, 0x0E, 0x70,
+    0xAD, 0x90, 0xE7, 0x0A, 0xD9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE0, 0xAD, 0xA9, 0x99, 0x99, 0x3E,
+    0x0A, 0xD9, 0x70, 0xDA, 0x0E, 0x70, 0xAD, 0x90, 0xE7, 0x0E, 0x1E, 0x70, 0xDA, 0x1E, 0x96, 0xAD,
+    0x2A, 0xD9, 0x6D, 0xA2, 0x9D, 0xA5, 0xE4, 0xE4, 0xAD, 0x94, 0xAE, 0x90, 0x9E, 0x96, 0xFF, 0x97,
+    0x0F, 0xCA, 0x74, 0x99, 0x71, 0x72, 0x9D, 0xA3, 0xE9, 0x3E, 0x4E, 0x39, 0xDA, 0x3A, 0xD9, 0x3E,
+    0x4E, 0x39, 0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xE4, 0xDA, 0x39, 0xDA, 0x1A, 0x09, 0xEA, 0xD0, 0x9F,
+    0xCA, 0x1F, 0x93, 0x94, 0x77, 0x29, 0xAE, 0x95, 0x9E, 0x09, 0xFC, 0xA4, 0xFC, 0x90, 0x99, 0x9D,
+    0xA3, 0xFA, 0xA3, 0x9D, 0x92, 0xE9, 0x69, 0xD2, 0xE7, 0x0A, 0xD1, 0xAD, 0x71, 0xDA, 0x09, 0xE7,
+    0x1D, 0x90, 0xEA, 0x70, 0x9D, 0x0A, 0xEA, 0x70, 0xAD, 0x9D, 0xAC, 0x97, 0x0D, 0xAD, 0x0A, 0xCA,
+    0x70, 0xF9, 0x0A, 0xCA, 0x79, 0xF1, 0xAD, 0x7A, 0xE2, 0x9D, 0x92, 0xA2, 0xEA, 0x29, 0xEA, 0xAD,
+    0x2E, 0x4F, 0xDA, 0x19, 0xD9, 0x49, 0xF9, 0x75, 0x95, 0x69, 0xAA, 0xA7, 0x5F, 0xD9, 0x72, 0x9F,
+    0xE7, 0x69, 0xE9, 0x76, 0x9D, 0xA7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xE9,
+    0x75, 0xAE, 0x97, 0x5F, 0x97, 0x4A, 0xF9, 0x74, 0xD9, 0xDA, 0x73, 0xAD, 0x0D, 0xA7, 0x29, 0xD9,
+    0x0D, 0xA7, 0x2E, 0x1E, 0x71, 0xAD, 0x91, 0xE7, 0x09, 0xDA, 0x2E, 0x70, 0xE3, 0xAD, 0x7E, 0xA3,
+    0xAD, 0x6A, 0xE4, 0xAD, 0x29, 0x1A, 0xE5, 0x9E, 0xAD, 0x0A, 0xE9, 0x59, 0xFC, 0x90, 0xAD, 0xA7,
+    0xF7, 0x79, 0x30, 0x77, 0x71, 0x9D, 0x95, 0x9D, 0x96, 0xAD, 0x6E, 0x7E, 0x6E, 0x7D, 0xA5, 0x9D,
+    0xA6, 0x9D, 0xA5, 0xAD, 0x96, 0x9D, 0x95, 0xAD, 0x7A, 0xD6, 0xE7, 0xE6, 0xDA, 0x7D, 0xA5, 0x9D,
+    0xA7, 0xDA, 0x5A, 0xD9, 0x69, 0xD9, 0x5E, 0x7A, 0xD9, 0x49, 0xE7, 0xEA, 0x4F, 0x7F, 0x3A, 0xCA,
+    0xD2, 0x93, 0xFC, 0x99, 0xE0, 0xEA, 0xD9, 0x19, 0xFF, 0xC1, 0xFC, 0xA2, 0xAC, 0xA9, 0xFA, 0x29,
+    0xE9, 0x3D, 0xA1, 0x99, 0x69, 0x5D, 0xA7, 0x71, 0xDA, 0x77, 0x09, 0xD9, 0x77, 0x0A, 0xD9, 0x77,
+    0x0E, 0x77, 0x1E, 0x77, 0x1C, 0xA9, 0x77, 0x00, 0x77, 0x19, 0xAE, 0x5E, 0xA0, 0x9F, 0xC9, 0x4A,
+    0xE1, 0x99, 0xAD, 0xA5, 0xE3, 0x9E, 0x5E, 0x4E, 0x5E, 0x4A, 0xD9, 0x4D, 0xA4, 0xAD, 0x93, 0xAD,
+    0x59, 0xDA, 0x3D, 0xA6, 0xDA, 0x29, 0xD7, 0xE2, 0xDA, 0x7E, 0x1A, 0xD7, 0x0A, 0xD0, 0x9D, 0x97,
+    0x0A, 0xD0, 0xDA, 0x71, 0xAF, 0xC7, 0x29, 0xF7, 0x39, 0xE7, 0x49, 0xCA, 0x77, 0x71, 0x77, 0x1A,
+    0xCA, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x91, 0x9A, 0xDA, 0x3F, 0xFC, 0xA4, 0xAF, 0xDA, 0x49, 0xD9,
+    0x71, 0xDA, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0x97, 0x19, 0xFC, 0xA7, 0xAF,
+    0xC5, 0x9F, 0xCA, 0xA4, 0xAE, 0x97, 0x9D, 0xA7, 0x1E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0x71, 0xFA,
+    0x71, 0xFC, 0xA7, 0x0F, 0xDA, 0x79, 0xFD, 0x70, 0x9F, 0xA7, 0x19, 0xE7, 0x2D, 0xA7, 0x1A, 0xD9,
+    0x70, 0xAD, 0xA6, 0xAF, 0xA7, 0xF9, 0x71, 0x97, 0x77, 0x59, 0xFC, 0xA7, 0xFF, 0xC5, 0xEA, 0x90,
+    0x9E, 0xA3, 0xE9, 0x39, 0xE2, 0xAD, 0xA5, 0xE9, 0x09, 0xE6, 0xE9, 0x0A, 0xD9, 0x6E, 0x90, 0xE7,
+    0xE0, 0x9E, 0x7E, 0x09, 0xDA, 0x69, 0xE0, 0xAD, 0xA6, 0xAD, 0xA0, 0xAD, 0xA6, 0xE1, 0xAD, 0xA5,
+    0xAD, 0xA1, 0x9E, 0x4A, 0xE3, 0xF1, 0x9F, 0x49, 0xFF, 0xC6, 0x9F, 0xD9, 0x72, 0x97, 0x10, 0x77,
+    0x79, 0xAF, 0xFF, 0xC9, 0x2F, 0xFF, 0xF2, 0xFF, 0xFF, 0x92, 0xD9, 0x1D, 0x29, 0xD6, 0x92, 0x9D,
+    0x2A, 0xCA, 0x72, 0xAC, 0xA2, 0xD9, 0x72, 0xD2, 0x9D, 0x72, 0x9D, 0x2A, 0xD7, 0x2D, 0xA2, 0xDA,
+    0x72, 0xD9, 0x2D, 0x97, 0x1A, 0xD3, 0xD9, 0x71, 0xDA, 0x29, 0xD7, 0x1A, 0xD3, 0xAD, 0x71, 0xE3,
+    0xAD, 0x91, 0x99, 0x3A, 0xD9, 0x3F, 0xAD, 0x92, 0x9E, 0x4A, 0xFC, 0xA3, 0xE9, 0x5F, 0x95, 0x97,
+    0x09, 0x60, 0x77, 0x72, 0xAF, 0xC9, 0x70, 0x9F, 0xFA, 0x6A, 0xE9, 0x1A, 0xE9, 0x49, 0xDA, 0x4E,
+    0xA4, 0xE5, 0x9E, 0x39, 0xD9, 0x59, 0xE3, 0xAD, 0x7E, 0x3E, 0x69, 0xE3, 0xDA, 0x69, 0xDA, 0x29,
+    0xD9, 0x6A, 0xD9, 0x29, 0xD9, 0x6E, 0x3A, 0xD6, 0x9D, 0xA3, 0xE6, 0xE4, 0xE5, 0xAD, 0xA4, 0xF9,
+    0x2E, 0xA4, 0x9F, 0xFD, 0xA5, 0xAD, 0xAF, 0xCA, 0x7A, 0xD2, 0x97, 0x2D, 0xA7, 0x6D, 0xA7, 0x59,
+    0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6A, 0xA7, 0x60, 0x77, 0x2A, 0xFC, 0x49, 0xFE,
+    0x92, 0xAE, 0xAA, 0xAD, 0x91, 0x9D, 0xA4, 0x92, 0xE7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xDA, 0x70,
+    0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xE7, 0x1F, 0x97, 0xAF, 0xC9, 0x6A, 0xFD, 0x69,
+    0xFD, 0x96, 0x9A, 0xF7, 0x1E, 0x71, 0xAD, 0x70, 0x9D, 0xA7, 0xAE, 0x5A, 0xFC, 0x6F, 0xA7, 0x09,
+    0x96, 0x77, 0x71, 0x9A, 0xFF, 0xC9, 0x4A, 0xFF, 0xF4, 0xFA, 0xAA, 0xFC, 0xA9, 0x3E, 0xA3, 0xE6,
+    0xEA, 0x49, 0xD9, 0x49, 0xE6, 0xE4, 0xE9, 0x6E, 0x4E, 0x7E, 0x39, 0xDA, 0x7E, 0x3A, 0xDA, 0x69,
+    0xDA, 0x3A, 0xD9, 0x6A, 0xD9, 0x3A, 0xD9, 0x6E, 0x4A, 0xDA, 0x5A, 0xDA, 0x49, 0xE4, 0x9E, 0x6E,
+    0xA2, 0xAE, 0x79, 0xFF, 0xC7, 0x19, 0xFD, 0x97, 0x59, 0x97, 0x30, 0x77, 0x2A, 0xFF, 0xE9, 0x0A,
+    0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x09, 0xCA, 0x2A, 0xD7, 0x93, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x4D,
+    0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x4E, 0x2A, 0xA7, 0xEA, 0xAD, 0xA7,
+    0xFD, 0xA7, 0x0A, 0xEA, 0x97, 0x39, 0x70, 0x77, 0x2A, 0xF4, 0xE2, 0xFD, 0x4A, 0xDA, 0x19, 0x99,
+    0xE4, 0x9E, 0x4D, 0xA5, 0xE3, 0xAD, 0x95, 0xE3, 0xE6, 0xE3, 0xE6, 0xE2, 0x9D, 0xA5, 0x9D, 0xA2,
+    0xAD, 0x95, 0x9D, 0x92, 0xE6, 0xE3, 0xE6, 0xE2, 0x9E, 0x5A, 0xD9, 0x29, 0xE5, 0xDA, 0x39, 0xE4,
+    0xE5, 0xF9, 0x9A, 0xE6, 0xAF, 0xF7, 0x0A, 0xFC, 0x97, 0x39, 0x97, 0x10, 0x77, 0x71, 0x9E, 0x92,
+    0xAF, 0x95, 0xAD, 0xA3, 0xFE, 0x93, 0xAD, 0x93, 0xAD, 0x1A, 0xE2, 0x9D, 0xA3, 0x9D, 0x3A, 0xD9,
+    0x1E, 0x4A, 0xD3, 0x9D, 0xA0, 0x9D, 0x94, 0xDA, 0x4E, 0x0E, 0x49, 0xD9, 0x4E, 0x0E, 0x4A, 0xD5,
+    0xDA, 0x0E, 0x4E, 0x49, 0xD9, 0x9E, 0x4D, 0xA4, 0xAD, 0x09, 0xE4, 0xD9, 0x4D, 0xA1, 0xE3, 0x9D,
+    0x4A, 0xD2, 0xE9, 0x2A, 0xD3, 0x9D, 0x92, 0xAE, 0x91, 0xE2, 0xAD, 0xA4, 0xFA, 0x9D, 0xA9, 0xAE,
+    0x96, 0xAF, 0xFD, 0xA7, 0x19, 0xAF, 0xCA, 0x97, 0x6A, 0xD7, 0x71, 0xDA, 0x77, 0x1D, 0xA7, 0x70,
+    0x9D, 0x97, 0x70, 0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7, 0x70, 0x9A, 0x97, 0x40, 0x77, 0x79, 0xF6,
+    0xE9, 0x29, 0xFC, 0xA4, 0xAD, 0xA4, 0x99, 0x9E, 0x39, 0xE7, 0x0E, 0x3E, 0x71, 0xAD, 0x91, 0x9D,
+    0x97, 0x19, 0xDA, 0x1D, 0xA7, 0x3E, 0x0A, 0xD7, 0x4E, 0x0D, 0x75, 0xAF, 0x97, 0x59, 0xEA, 0x77,
+    0xE7, 0x70, 0xDA, 0x77, 0x9E, 0x77, 0xF7, 0x6F, 0xC7, 0x59, 0xD9, 0xD9, 0x74, 0xD1, 0xDA, 0x73,
+    0xDA, 0x1E, 0x72, 0xAD, 0x2E, 0x71, 0x9D, 0xA2, 0xAD, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4E,
+    0x1A, 0xC2, 0x9E, 0x5F, 0xDA, 0x19, 0xE6, 0xAF, 0x92, 0x9A, 0xA7, 0x0A, 0xA9, 0x40, 0x77, 0x77,
+    0x4D, 0x97, 0x72, 0xAD, 0x77, 0x3E, 0x77, 0x3D, 0xA7, 0x72, 0x9D, 0x97, 0x72, 0xAD, 0x71, 0xAF,
+    0x4E, 0x2E, 0x2F, 0xD9, 0x3D, 0xA2, 0xAD, 0x91, 0x99, 0x9E, 0x4D, 0xA2, 0x9E, 0x4E, 0x39, 0xD9,
+    0x3E, 0x39, 0xDA, 0x3A, 0xD4, 0xE3, 0xAD, 0x4E, 0x4E, 0x3E, 0x4D, 0xA4, 0xE3, 0xDA, 0x39, 0xD9,
+    0x4E, 0x29, 0xD9, 0x3A, 0xD4, 0x9D, 0xA2, 0xAD, 0x93, 0xE4, 0xAD, 0x92, 0xAD, 0x4E, 0x4E, 0x3A,
+    0xD9, 0x3D, 0xA3, 0xAD, 0x93, 0xAD, 0xA2, 0x9D, 0x92, 0x9D, 0xA4, 0x9E, 0x91, 0xAD, 0x2A, 0xE6,
+    0xFA, 0x9E, 0x9A, 0xF7, 0x0F, 0xFF, 0x97, 0x29, 0xFE, 0xA9, 0x77, 0xAD, 0x97, 0x72, 0xAD, 0x77,
+    0x3E, 0x77, 0x3D, 0xA7, 0x72, 0x9D, 0x97, 0x72, 0xAD, 0x77, 0x3E, 0x77, 0x3A, 0x97, 0x50, 0x77,
+    0x73, 0xAE, 0x59, 0xD9, 0x6E, 0x97, 0xE5, 0xE7, 0x19, 0xDA, 0x3E, 0x97, 0x2E, 0x29, 0xDA, 0x4A,
+    0xA4, 0xE2, 0xE4, 0xE4, 0xE1, 0xAD, 0x93, 0x9D, 0xA4, 0xE1, 0xE4, 0x9D, 0x94, 0xE1, 0xE4, 0xAD,
+    0x5E, 0x09, 0xDA, 0x4A, 0xCA, 0x5E, 0x0A, 0xDA, 0x4D, 0x95, 0xDA, 0x0A, 0xD9, 0x4D, 0x94, 0x9D,
+    0x1A, 0xDA, 0x3A, 0xD9, 0x4E, 0x19, 0xE3, 0xF3, 0x9D, 0x92, 0xEA, 0x09, 0xD9, 0xDA, 0x1A, 0xDA,
+    0x3A, 0xFD, 0xA0, 0xAF, 0xDA, 0x5A, 0xF9, 0x2A, 0xF9, 0x70, 0x97, 0x97, 0x77, 0x09, 0x77, 0x5E,
+    0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7,
+    0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D,
+    0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F,
+    0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A,
+    0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF,
+    0xEA, 0x5F, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x4F, 0x77, 0x4E, 0x97,
+    0x75, 0x97, 0x50, 0x77, 0x79, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD,
+    0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E,
+    0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9,
+    0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F,
+    0xA3, 0xEA, 0x59, 0x96, 0x97, 0x77, 0x77, 0x5E, 0x75, 0xF7, 0x5F, 0x75, 0xE9, 0x77, 0x73, 0x77,
+    0x77, 0x7F, 0xC7, 0x71, 0x9F, 0xDA, 0x77, 0x0A, 0xCA, 0x1E, 0x77, 0x0A, 0xC2, 0xDA, 0x77, 0x39,
+    0xE7, 0x73, 0xAD, 0x97, 0x73, 0x9D, 0x77, 0x6D, 0x77, 0x77, 0x77, 0x19, 0x77, 0x5E, 0x77, 0x4F,
+    0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD,
+    0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E,
+    0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA,
+    0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71,
+    0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F,
+    0xFC, 0x00, 0x72, 0x9A, 0x97, 0x4A, 0xFC, 0x72, 0xE9, 0xE9, 0x71, 0xD1, 0x9D, 0x97, 0x1C, 0xA1,
+    0xAD, 0x75, 0x9D, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x76, 0xAC, 0x97, 0x79, 0x77, 0x77, 0x77, 0x09,
+    0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD,
+    0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D,
+    0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D,
+    0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94,
+    0x77, 0x77, 0x77, 0x2C, 0xA7, 0x77, 0xAD, 0x77, 0x6A, 0xDA, 0x77, 0x59, 0xDA, 0x77, 0x19, 0x99,
+    0x1D, 0x97, 0x71, 0xF9, 0x0A, 0x77, 0x2F, 0xD7, 0x73, 0xE1, 0xE7, 0x71, 0xE2, 0x9D, 0x97, 0x79,
+    0xAA, 0x49, 0xA7, 0x76, 0x97, 0x77, 0xE7, 0x76, 0xF7, 0x75, 0x9F, 0x97, 0x74, 0xFC, 0x97, 0x73,
+    0xAD, 0x9D, 0xA7, 0x73, 0xD9, 0x0E, 0x77, 0x2A, 0xD1, 0xE7, 0x72, 0xD9, 0x1E, 0x77, 0x1D, 0xA2,
+    0xAD, 0x97, 0x79, 0xD3, 0xAD, 0xA7, 0x7D, 0xA3, 0x9E, 0x76, 0xAD, 0x5E, 0x76, 0xDA, 0x5E, 0x75,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x4F, 0xFF, 0xCA, 0x73, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x72,
+    0x9D, 0x97, 0x9E, 0x72, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x1E, 0x97, 0x0E, 0x72, 0xEA, 0x7A, 0xD9,
+    0x72, 0xF5, 0xAF, 0xD9, 0x59, 0xAF, 0xE2, 0xAF, 0xEA, 0x5F, 0xFC, 0x20, 0x77, 0x19, 0x77, 0x29,
+    0xD7, 0x71, 0xE7, 0x70, 0xAD, 0xA7, 0x79, 0xDA, 0x77, 0x0D, 0xA7, 0x70, 0x9C, 0x97, 0x4A, 0xE7,
+    0x7A, 0xFC, 0x75, 0xAE, 0xAE, 0x73, 0xAE, 0x1A, 0xD9, 0x71, 0xAD, 0xA3, 0xDA, 0x71, 0x9A, 0x95,
+    0xA7, 0x77, 0x77, 0x75, 0x9F, 0xA1, 0xAC, 0xA7, 0x0A, 0xFE, 0xAD, 0x70, 0xF9, 0x9A, 0xFC, 0x7A,
+    0xDA, 0x4E, 0xA6, 0x9E, 0x5A, 0xD7, 0xE6, 0xE6, 0x9D, 0xA6, 0xDA, 0x6A, 0xD6, 0x9D, 0x96, 0xE6,
+    0xE6, 0x9D, 0xA5, 0x9E, 0x69, 0xDA, 0x5E, 0xA6, 0xAD, 0x94, 0xAE, 0xA6, 0xAD, 0xA3, 0x9C, 0xAD,
+    0x91, 0xA3, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x29, 0xFA, 0xE1, 0xDA, 0xE4, 0xFE, 0x2F, 0xC5,
+    0x9F, 0xA3, 0xEA, 0x70, 0x99, 0x69, 0x70, 0x77, 0x77, 0x73, 0xCA, 0x77, 0x5A, 0xD9, 0x77, 0x5E,
+    0x77, 0x59, 0xD9, 0x77, 0x19, 0x91, 0x9D, 0x77, 0x0F, 0x91, 0x97, 0x7F, 0xD7, 0x71, 0xE1, 0xE7,
+    0x7E, 0x3D, 0x97, 0x59, 0xAA, 0x49, 0xA7, 0x74, 0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97,
+    0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71, 0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9,
+    0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A, 0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7,
+    0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E, 0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E,
+    0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A, 0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC0, 0x74, 0x97,
+    0x7D, 0x76, 0x9D, 0xA7, 0x6E, 0x97, 0x6E, 0x77, 0xDA, 0x77, 0xD7, 0x1A, 0xE2, 0x97, 0x0A, 0xFC,
+    0x72, 0xAE, 0xAE, 0x70, 0xAE, 0x1A, 0xD9, 0x6A, 0xDA, 0x3D, 0xA6, 0x9A, 0x95, 0xA7, 0x77, 0x77,
+    0x49, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5,
+    0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3,
+    0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD,
+    0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96,
+    0x94, 0x77, 0x69, 0x77, 0x59, 0xF9, 0x77, 0x3D, 0x9A, 0xD7, 0x73, 0xC9, 0x09, 0xCA, 0x77, 0x59,
+    0xD7, 0x75, 0xDA, 0x77, 0x0A, 0xE1, 0xD7, 0x70, 0xFD, 0x77, 0x2E, 0x99, 0xE7, 0x70, 0xE3, 0xD9,
+    0x77, 0xAA, 0x49, 0xA7, 0x75, 0x97, 0x76, 0xE7, 0x75, 0xF7, 0x74, 0x9F, 0x97, 0x73, 0xFC, 0x97,
+    0x72, 0xAD, 0x9D, 0xA7, 0x72, 0xD9, 0x0E, 0x77, 0x1A, 0xD1, 0xE7, 0x71, 0xD9, 0x1E, 0x77, 0x0D,
+    0xA2, 0xAD, 0x97, 0x69, 0xD3, 0xAD, 0xA7, 0x6D, 0xA3, 0x9E, 0x75, 0xAD, 0x5E, 0x75, 0xDA, 0x5E,
+    0x74, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x3F, 0xFF, 0xCA, 0x72, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x71, 0x9D, 0x97, 0x9E, 0x71, 0xE7, 0x1E, 0x70, 0xAD, 0x97, 0x1E, 0x97, 0xE7, 0x2E, 0xA6, 0xAD,
+    0x97, 0x2F, 0x4A, 0xFD, 0x95, 0x9A, 0xFE, 0x1A, 0xFE, 0xA5, 0xFF, 0xC1, 0x77, 0x99, 0x97, 0x79,
+    0xFC, 0x97, 0x5D, 0xA9, 0xE7, 0x5C, 0xA1, 0xAD, 0x77, 0x09, 0xD9, 0x76, 0x9A, 0xD9, 0x77, 0xAC,
+    0xA7, 0x39, 0xAA, 0xA1, 0x9C, 0x97, 0x29, 0xFC, 0x75, 0x9E, 0xAE, 0x73, 0x9E, 0x1A, 0xD9, 0x71,
+    0xAD, 0xA3, 0xD9, 0x71, 0x9A, 0x94, 0x9A, 0x77, 0x77, 0x77, 0x59, 0xFA, 0x1A, 0xCA, 0x70, 0xAF,
+    0xEA, 0xD7, 0x0F, 0x99, 0xAF, 0xC7, 0xAD, 0xA4, 0xEA, 0x69, 0xE5, 0xAD, 0x7E, 0x6E, 0x69, 0xDA,
+    0x6D, 0xA6, 0xAD, 0x69, 0xD9, 0x6E, 0x6E, 0x69, 0xDA, 0x59, 0xE6, 0x9D, 0xA5, 0xEA, 0x6A, 0xD9,
+    0x4A, 0xEA, 0x6A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x3A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x92, 0x9F,
+    0xAE, 0x1D, 0xAE, 0x4F, 0xE2, 0xFC, 0x59, 0xFA, 0x3E, 0xA7, 0x09, 0x96, 0x97, 0x76, 0x97, 0x75,
+    0x9E, 0x91, 0xAC, 0x77, 0xFC, 0xAA, 0xD7, 0x69, 0xCA, 0x09, 0xF9, 0x77, 0xA3, 0xAA, 0x97, 0x77,
+    0x77, 0x3E, 0x97, 0x73, 0xFC, 0x97, 0x70, 0x9E, 0x0E, 0x77, 0x9D, 0xA2, 0xDA, 0x76, 0xAC, 0x94,
+    0xA7, 0x75, 0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D,
+    0xA7, 0x71, 0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75,
+    0x9D, 0x3A, 0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79,
+    0xE7, 0x0E, 0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD,
+    0x95, 0x9A, 0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC0, 0x70, 0x99, 0x39, 0x70, 0x9F, 0x91, 0xD7, 0xFD,
+    0xAA, 0xD7, 0xD1, 0xFC, 0x97, 0xA9, 0x29, 0xCA, 0x97, 0x77, 0x49, 0xAA, 0xA7, 0x49, 0xFA, 0x72,
+    0x9F, 0xDA, 0x70, 0xAD, 0xA1, 0xE9, 0x6A, 0xDA, 0x3D, 0x96, 0x9A, 0x59, 0x97, 0x77, 0x77, 0x49,
+    0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD,
+    0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D,
+    0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D,
+    0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x94,
+    0x77, 0x77, 0x70, 0xE7, 0x74, 0xFC, 0x77, 0x2F, 0xE7, 0x79, 0xE1, 0xAD, 0xA7, 0x59, 0xE3, 0xAD,
+    0x75, 0xAC, 0xA5, 0xA9, 0x77, 0x77, 0x74, 0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72,
+    0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71, 0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E,
+    0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A, 0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D,
+    0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA, 0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E, 0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5,
+    0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A, 0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC7, 0x77, 0x77, 0x77,
+    0x77, 0x75, 0xE7, 0x74, 0xF7, 0x74, 0xF7, 0x74, 0xE9, 0x77, 0x59, 0x75, 0x72, 0x99, 0x76, 0xEA,
+    0x74, 0xAF, 0x97, 0x2A, 0xDA, 0xE7, 0x19, 0xD9, 0x0A, 0xD7, 0x09, 0xDA, 0x2D, 0xA7, 0xDA, 0x3A,
+    0xCA, 0x79, 0x95, 0x97, 0x77, 0x77, 0x49, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF,
+    0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5, 0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9,
+    0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3, 0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39,
+    0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD, 0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F,
+    0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96, 0x97, 0x77, 0x77, 0x5E, 0x75, 0xF7, 0x5F, 0x75, 0xE9, 0x77,
+    0x73, 0x77, 0x77, 0x72, 0x9C, 0x77, 0x6D, 0x97, 0x74, 0xE9, 0x77, 0x3A, 0xD9, 0x77, 0x0A, 0x91,
+    0xD2, 0x97, 0x59, 0xD4, 0x9C, 0x97, 0x59, 0xE9, 0x99, 0xE7, 0x7F, 0xF7, 0x71, 0xAF, 0xA7, 0x77,
+    0x77, 0x79, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA,
+    0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59,
+    0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E,
+    0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9,
+    0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x77, 0x76, 0xAC, 0x76, 0x9D, 0xA7, 0x5E, 0x97,
+    0x4E, 0x97, 0x4A, 0xD9, 0x75, 0x9A, 0x73, 0xAC, 0x59, 0xC7, 0xDA, 0x3A, 0xCA, 0x7F, 0xAA, 0xE7,
+    0x09, 0xFE, 0x73, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5,
+    0xF9, 0x9A, 0xFC, 0x4A, 0xDA, 0x4E, 0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A,
+    0xD6, 0x9D, 0x93, 0xE6, 0xE3, 0x9D, 0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3,
+    0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA0, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE,
+    0x1F, 0xE2, 0xFC, 0x29, 0xFA, 0x3E, 0xA5, 0x99, 0x69, 0x40, 0x77, 0x77, 0x70, 0xC9, 0x77, 0x5D,
+    0xA7, 0x75, 0xE7, 0x76, 0xD9, 0x77, 0x1A, 0x91, 0x9C, 0x91, 0x97, 0x59, 0xD4, 0x9C, 0x97, 0x59,
+    0xE9, 0x99, 0xE7, 0x7F, 0xF7, 0x71, 0xAF, 0xA7, 0x77, 0x77, 0x79, 0x77, 0x5E, 0x77, 0x4F, 0x77,
+    0x39, 0xF9, 0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E,
+    0x77, 0x0D, 0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74,
+    0xAD, 0x5E, 0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9,
+    0x6E, 0x72, 0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC,
+    0x00, 0x77, 0x73, 0xAA, 0x76, 0x9D, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xD7, 0x79, 0xA7, 0x2A, 0xC5,
+    0x9C, 0x7D, 0xA3, 0xAC, 0xA7, 0xFA, 0xAE, 0x70, 0x9F, 0xE7, 0x3A, 0xE9, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xFA, 0x1A, 0xCA, 0x5A, 0xFE, 0xAD, 0x5F, 0x99, 0xAF, 0xC4, 0xAD, 0xA4, 0xEA, 0x39, 0xE5,
+    0xAD, 0x4E, 0x6E, 0x39, 0xDA, 0x6D, 0xA3, 0xAD, 0x69, 0xD9, 0x3E, 0x6E, 0x39, 0xDA, 0x59, 0xE3,
+    0x9D, 0xA5, 0xEA, 0x3A, 0xD9, 0x4A, 0xEA, 0x3A, 0xDA, 0x39, 0xCA, 0xD9, 0x1A, 0x0A, 0xE2, 0xAD,
+    0x0D, 0x90, 0xAC, 0x99, 0xFA, 0xE1, 0xDA, 0xE1, 0xFE, 0x2F, 0xC2, 0x9F, 0xA3, 0xEA, 0x59, 0x96,
+    0x94, 0x77, 0x77, 0x79, 0xF7, 0x72, 0x9D, 0x9D, 0xA7, 0x71, 0x9C, 0x1D, 0x97, 0x74, 0x9C, 0xA7,
+    0x74, 0xD9, 0x77, 0x29, 0x1C, 0xA1, 0x97, 0x7D, 0x4A, 0xC7, 0x7E, 0xA9, 0xAD, 0x97, 0x70, 0xFD,
+    0x97, 0x72, 0x9A, 0xA9, 0x77, 0x79, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9, 0x77, 0x2F, 0xC9,
+    0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D, 0x91, 0xE7, 0x7D,
+    0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E, 0x74, 0xDA, 0x5E,
+    0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72, 0xEA, 0x5A, 0xD9,
+    0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x73, 0x99, 0x75, 0xFC,
+    0x73, 0xEA, 0xDA, 0x71, 0x9D, 0x1D, 0xA7, 0x29, 0x2D, 0x75, 0xAD, 0x97, 0x4D, 0xA7, 0x6A, 0xC7,
+    0x3C, 0xA5, 0x9A, 0x7D, 0x93, 0x9C, 0xA7, 0xEA, 0x9A, 0xE7, 0x09, 0xFE, 0x73, 0xAE, 0x97, 0x77,
+    0x77, 0x77, 0x70, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A, 0xFC, 0x4A, 0xDA, 0x4E,
+    0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0xE6, 0xE3, 0x9D,
+    0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA0,
+    0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2, 0xFC, 0x29, 0xFA, 0x3E,
+    0xA5, 0x99, 0x69, 0x40, 0x77, 0x77, 0x5A, 0xE9, 0x1D, 0x76, 0xFD, 0xAA, 0xD7, 0x6D, 0x1F, 0xC9,
+    0x76, 0x99, 0x29, 0xA9, 0x77, 0x09, 0x79, 0x75, 0xAC, 0x94, 0x9C, 0x97, 0x5A, 0xDA, 0x19, 0xAD,
+    0x77, 0xFF, 0x77, 0x09, 0xFC, 0xA7, 0x77, 0x77, 0x79, 0x77, 0x5E, 0x77, 0x4F, 0x77, 0x39, 0xF9,
+    0x77, 0x2F, 0xC9, 0x77, 0x1A, 0xD9, 0xDA, 0x77, 0x1D, 0x90, 0xE7, 0x70, 0xAD, 0x1E, 0x77, 0x0D,
+    0x91, 0xE7, 0x7D, 0xA2, 0xAD, 0x97, 0x59, 0xD3, 0xAD, 0xA7, 0x5D, 0xA3, 0x9E, 0x74, 0xAD, 0x5E,
+    0x74, 0xDA, 0x5E, 0x73, 0xAD, 0xAA, 0xAA, 0xAA, 0xAE, 0x97, 0x2F, 0xFF, 0xCA, 0x71, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0x70, 0x9D, 0x97, 0x9E, 0x70, 0xE7, 0x1E, 0x7A, 0xD9, 0x71, 0xE9, 0x6E, 0x72,
+    0xEA, 0x5A, 0xD9, 0x72, 0xF3, 0xAF, 0xD9, 0x59, 0xAF, 0xE0, 0xAF, 0xEA, 0x5F, 0xFC, 0x00, 0x79,
+    0xAA, 0x3A, 0x70, 0xAF, 0x19, 0xCA, 0x69, 0xFD, 0xAD, 0x96, 0xAC, 0x90, 0x9F, 0xC7, 0x0A, 0x29,
+    0xAC, 0x97, 0x77, 0x2C, 0xA6, 0xA6, 0x9D, 0x93, 0x9C, 0xA7, 0xEA, 0x9A, 0xE7, 0x0A, 0xFE, 0x97,
+    0x19, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x70, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5, 0xF9, 0x9A,
+    0xFC, 0x4A, 0xDA, 0x4E, 0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A, 0xD6, 0x9D,
+    0x93, 0xE6, 0xE3, 0x9D, 0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3, 0xAD, 0xA3,
+    0x9C, 0xAD, 0x91, 0xA0, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE, 0x1F, 0xE2,
+    0xFC, 0x29, 0xFA, 0x3E, 0xA5, 0x99, 0x69, 0x40, 0x77, 0x77, 0x49, 0xC6, 0xC7, 0x6D, 0xA4, 0xD7,
+    0x6E, 0xA9, 0x9A, 0xD9, 0x76, 0x9F, 0xE9, 0x77, 0x09, 0xFC, 0x97, 0x74, 0x97, 0x77, 0x77, 0x71,
+    0x97, 0x75, 0xE7, 0x74, 0xF7, 0x73, 0x9F, 0x97, 0x72, 0xFC, 0x97, 0x71, 0xAD, 0x9D, 0xA7, 0x71,
+    0xD9, 0x0E, 0x77, 0x0A, 0xD1, 0xE7, 0x70, 0xD9, 0x1E, 0x77, 0xDA, 0x2A, 0xD9, 0x75, 0x9D, 0x3A,
+    0xDA, 0x75, 0xDA, 0x39, 0xE7, 0x4A, 0xD5, 0xE7, 0x4D, 0xA5, 0xE7, 0x3A, 0xDA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x72, 0xFF, 0xFC, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x09, 0xD9, 0x79, 0xE7, 0x0E,
+    0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x96, 0xE7, 0x2E, 0xA5, 0xAD, 0x97, 0x2F, 0x3A, 0xFD, 0x95, 0x9A,
+    0xFE, 0x0A, 0xFE, 0xA5, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE7, 0x74, 0xF7, 0x74, 0xF7,
+    0x74, 0xE9, 0x77, 0x59, 0x75, 0x77, 0x70, 0xCA, 0x5A, 0x96, 0xAD, 0x93, 0xD7, 0x9F, 0xAE, 0xA7,
+    0x0F, 0xEA, 0x72, 0x9E, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x9F, 0xA1, 0xAC, 0xA5, 0xAF, 0xEA, 0xD5,
+    0xF9, 0x9A, 0xFC, 0x4A, 0xDA, 0x4E, 0xA3, 0x9E, 0x5A, 0xD4, 0xE6, 0xE3, 0x9D, 0xA6, 0xDA, 0x3A,
+    0xD6, 0x9D, 0x93, 0xE6, 0xE3, 0x9D, 0xA5, 0x9E, 0x39, 0xDA, 0x5E, 0xA3, 0xAD, 0x94, 0xAE, 0xA3,
+    0xAD, 0xA3, 0x9C, 0xAD, 0x91, 0xA0, 0xAE, 0x2A, 0xD0, 0xD9, 0x0A, 0xC9, 0x9F, 0xAE, 0x1D, 0xAE,
+    0x1F, 0xE2, 0xFC, 0x29, 0xFA, 0x3E, 0xA5, 0x99, 0x69, 0x77, 0x77, 0x75, 0xE7, 0x5F, 0x75, 0xF7,
+    0x5E, 0x97, 0x77, 0x30, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77,
+    0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71,
+    0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D,
+    0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0xAD, 0x97, 0x79, 0xEA, 0x77, 0xF9, 0x77, 0xAD, 0xA7, 0x71, 0x97, 0x40,
+    0x77, 0x39, 0xFC, 0x95, 0xFF, 0x4E, 0x2A, 0xD9, 0x2D, 0xA3, 0x9D, 0x91, 0xAD, 0x4A, 0xD9, 0x1D,
+    0xA3, 0x9E, 0x1A, 0xD3, 0xAE, 0x2E, 0x19, 0xF2, 0x9E, 0xAF, 0xA3, 0x9F, 0xD9, 0x5A, 0xE9, 0x70,
+    0xAD, 0x97, 0x1A, 0xD9, 0x6A, 0x19, 0xE4, 0x9D, 0x91, 0xFA, 0x9A, 0xEA, 0x2A, 0xFF, 0xA4, 0xAF,
+    0xCA, 0x70, 0x99, 0x77, 0x77, 0x6A, 0xD9, 0x70, 0x9E, 0xA7, 0x0A, 0xEA, 0x70, 0x9D, 0xA7, 0x75,
+    0x77, 0x77, 0x1A, 0xF7, 0x6F, 0xE7, 0x4A, 0xD1, 0xAD, 0x74, 0x9C, 0x2E, 0x77, 0x0E, 0x77, 0xAD,
+    0x97, 0x70, 0xD7, 0x72, 0xD7, 0x77, 0x77, 0x74, 0xFF, 0xFE, 0xA4, 0xFF, 0xFE, 0xA5, 0x9A, 0xEA,
+    0xAA, 0xAA, 0xAE, 0x96, 0xAD, 0x96, 0xD9, 0x6E, 0x7D, 0x7E, 0x7C, 0xA6, 0x9E, 0x77, 0x0A, 0xDA,
+    0x77, 0x0E, 0x97, 0x70, 0xE7, 0x71, 0xEA, 0xAA, 0xAE, 0xA7, 0x09, 0xFF, 0xD9, 0x70, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xA7, 0x1E, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xDA, 0x70, 0x96, 0xAD, 0xA7,
+    0xD6, 0xE9, 0x69, 0xD6, 0xE7, 0xDA, 0x59, 0xE9, 0x99, 0xAA, 0xAA, 0xE9, 0x3A, 0xFF, 0xFE, 0x3A,
+    0xFF, 0xFE, 0xA3, 0x70, 0x9A, 0x97, 0x19, 0xFC, 0x97, 0xDA, 0x9E, 0x6A, 0xCA, 0x1A, 0xD6, 0x9C,
+    0x2E, 0x72, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x3D, 0x74, 0x99, 0x77, 0x77, 0x70, 0x9F, 0xC9, 0x6F,
+    0xF5, 0xE2, 0xAD, 0x93, 0xDA, 0x39, 0xD9, 0x2A, 0xD4, 0xAD, 0x92, 0xDA, 0x39, 0xE2, 0xAD, 0x3A,
+    0xE3, 0xE1, 0x9F, 0x39, 0xEA, 0xFA, 0x49, 0xFD, 0x96, 0xAE, 0x97, 0x1A, 0xD9, 0x72, 0xAD, 0x96,
+    0xA2, 0x9E, 0x49, 0xD9, 0x2F, 0xA9, 0xAE, 0xA3, 0xAF, 0xFA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x00,
+    0x72, 0x9D, 0xA2, 0xA9, 0x72, 0x9F, 0xA1, 0xD7, 0x2F, 0xFD, 0x72, 0xD1, 0xFC, 0x73, 0xA9, 0x2E,
+    0x77, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xEA, 0x4F, 0xFF, 0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9,
+    0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77,
+    0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71,
+    0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7, 0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D,
+    0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93, 0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x30,
+    0x69, 0x97, 0x3F, 0x2D, 0x4A, 0xFC, 0x09, 0xD4, 0xD9, 0x9F, 0xCA, 0x4C, 0xA1, 0xAF, 0x72, 0x9A,
+    0x97, 0x77, 0x77, 0x74, 0x9F, 0xC9, 0x6F, 0xF5, 0xE2, 0xAD, 0x93, 0xDA, 0x39, 0xD9, 0x2A, 0xD4,
+    0xAD, 0x92, 0xDA, 0x39, 0xE2, 0xAD, 0x3A, 0xE3, 0xE1, 0x9F, 0x39, 0xEA, 0xFA, 0x49, 0xFD, 0x96,
+    0xAE, 0x97, 0x1A, 0xD9, 0x72, 0xAD, 0x96, 0xA2, 0x9E, 0x49, 0xD9, 0x2F, 0xA9, 0xAE, 0xA3, 0xAF,
+    0xFA, 0x5A, 0xFC, 0xA7, 0x19, 0x97, 0x00, 0x77, 0x77, 0x76, 0xCA, 0x77, 0x5A, 0xD7, 0x74, 0x9E,
+    0x77, 0x4E, 0x77, 0x99, 0x91, 0xAC, 0xA7, 0x7F, 0x90, 0x99, 0x77, 0xFD, 0x97, 0x70, 0xE1, 0xE7,
+    0x7E, 0x3D, 0x97, 0x6A, 0xA4, 0x9A, 0x77, 0x77, 0x3F, 0xFF, 0xEA, 0x70, 0xFF, 0xFE, 0xA7, 0x19,
+    0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x72, 0xAD, 0x96, 0xD9, 0x72, 0xE7, 0xD7, 0x3E, 0x7C, 0xA7, 0x29,
+    0xE7, 0x74, 0xAD, 0xA7, 0x74, 0xE9, 0x77, 0x4E, 0x77, 0x5E, 0xAA, 0xAA, 0xEA, 0x74, 0x9F, 0xFD,
+    0x97, 0x4A, 0xEA, 0xAA, 0xAA, 0xAA, 0x75, 0xE9, 0x77, 0x4E, 0x77, 0x49, 0xE7, 0x74, 0x9D, 0xA7,
+    0x09, 0x72, 0xAD, 0xA7, 0xD7, 0x2E, 0x96, 0x9D, 0x72, 0xE7, 0xDA, 0x71, 0x9E, 0x99, 0x9A, 0xAA,
+    0xAE, 0x97, 0xAF, 0xFF, 0xE7, 0xAF, 0xFF, 0xEA, 0x70, 0x77, 0x09, 0x77, 0x0A, 0xCA, 0x76, 0x9E,
+    0x76, 0xE9, 0x75, 0xAD, 0x97, 0x59, 0xD9, 0x76, 0xD7, 0x3A, 0xDA, 0x75, 0xFC, 0xA7, 0x3E, 0xAE,
+    0xA7, 0x1E, 0xA1, 0xE7, 0x0E, 0x93, 0xD7, 0x0A, 0xA5, 0x99, 0x77, 0x77, 0x77, 0x09, 0xFC, 0x97,
+    0x2F, 0xF7, 0x1E, 0x2A, 0xD9, 0x7D, 0xA3, 0x9D, 0x96, 0xAD, 0x4A, 0xD9, 0x6D, 0xA3, 0x9E, 0x6A,
+    0xD3, 0xAE, 0x7E, 0x19, 0xF7, 0x9E, 0xAF, 0xA7, 0x09, 0xFD, 0x97, 0x2A, 0xE9, 0x75, 0xAD, 0x97,
+    0x6A, 0xD9, 0x6A, 0x69, 0xE4, 0x9D, 0x96, 0xFA, 0x9A, 0xEA, 0x7A, 0xFF, 0xA7, 0x1A, 0xFC, 0xA7,
+    0x59, 0x97, 0x40, 0x77, 0x77, 0x6A, 0xC7, 0x72, 0x9D, 0x97, 0x72, 0xE7, 0x73, 0xDA, 0x76, 0x99,
+    0x91, 0xD7, 0x5F, 0x91, 0x97, 0x4F, 0xD9, 0x75, 0xE1, 0xE7, 0x4E, 0x3D, 0x97, 0x3A, 0xA4, 0x9A,
+    0x77, 0x75, 0xFF, 0xFE, 0xA5, 0xFF, 0xFE, 0xA6, 0x9A, 0xEA, 0xAA, 0xAA, 0xAE, 0x97, 0xAD, 0x96,
+    0xD9, 0x7E, 0x7D, 0x70, 0xE7, 0xCA, 0x79, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE9, 0x77, 0x1E, 0x77,
+    0x2E, 0xAA, 0xAA, 0xEA, 0x71, 0x9F, 0xFD, 0x97, 0x1A, 0xEA, 0xAA, 0xAA, 0xAA, 0x72, 0xE9, 0x77,
+    0x1E, 0x77, 0x19, 0xE7, 0x71, 0x9D, 0xA7, 0x09, 0x7A, 0xDA, 0x7D, 0x7E, 0x96, 0x9D, 0x7E, 0x7D,
+    0xA6, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x94, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xEA, 0x40, 0x77, 0x71,
+    0x9C, 0xA7, 0x4E, 0x97, 0x39, 0xE7, 0x49, 0xDA, 0x74, 0x9D, 0x75, 0x9C, 0xA7, 0xAD, 0xA1, 0x97,
+    0xFC, 0xA7, 0x0E, 0xAE, 0xA6, 0xEA, 0x1E, 0x5E, 0x93, 0xD5, 0xAA, 0x59, 0x97, 0x77, 0x77, 0x9F,
+    0xC9, 0x7F, 0xF6, 0xE2, 0xAD, 0x94, 0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xAD, 0x93, 0xDA, 0x39, 0xE3,
+    0xAD, 0x3A, 0xE4, 0xE1, 0x9F, 0x49, 0xEA, 0xFA, 0x59, 0xFD, 0x97, 0xAE, 0x97, 0x2A, 0xD9, 0x73,
+    0xAD, 0x96, 0xA3, 0x9E, 0x49, 0xD9, 0x3F, 0xA9, 0xAE, 0xA4, 0xAF, 0xFA, 0x6A, 0xFC, 0xA7, 0x29,
+    0x97, 0x10, 0x77, 0x49, 0x77, 0x4F, 0x97, 0x71, 0xD9, 0xAD, 0x77, 0x1C, 0xA0, 0x9D, 0x77, 0x4D,
+    0x97, 0x72, 0xAC, 0xA7, 0x6A, 0xE9, 0x0A, 0xC7, 0x6A, 0xFC, 0x77, 0x0A, 0xD9, 0x0E, 0x76, 0xE9,
+    0x2D, 0xA7, 0x5A, 0xA5, 0xA7, 0x77, 0x71, 0xFF, 0xFE, 0xA7, 0xFF, 0xFE, 0xA7, 0x09, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xE9, 0x71, 0xAD, 0x96, 0xD9, 0x71, 0xE7, 0xD7, 0x2E, 0x7C, 0xA7, 0x19, 0xE7, 0x73,
+    0xAD, 0xA7, 0x73, 0xE9, 0x77, 0x3E, 0x77, 0x4E, 0xAA, 0xAA, 0xEA, 0x73, 0x9F, 0xFD, 0x97, 0x3A,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x74, 0xE9, 0x77, 0x3E, 0x77, 0x39, 0xE7, 0x73, 0x9D, 0xA7, 0x09, 0x71,
+    0xAD, 0xA7, 0xD7, 0x1E, 0x96, 0x9D, 0x71, 0xE7, 0xDA, 0x70, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x96,
+    0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xEA, 0x60, 0x76, 0x9A, 0x97, 0x6A, 0xFC, 0x74, 0x9D, 0x9A, 0xDA,
+    0x73, 0x9C, 0x91, 0xD9, 0x77, 0xAD, 0x76, 0x9E, 0x77, 0xD9, 0x72, 0x9A, 0xCA, 0x1A, 0xA7, 0x2A,
+    0xFA, 0x74, 0xAD, 0xAE, 0x97, 0x2A, 0xDA, 0x1E, 0x71, 0xE9, 0x3D, 0x71, 0xAA, 0x59, 0x97, 0x77,
+    0x77, 0x73, 0x9F, 0xC9, 0x73, 0xFF, 0x72, 0xE2, 0xAD, 0x97, 0x0D, 0xA3, 0x9D, 0x97, 0xAD, 0x4A,
+    0xD9, 0x7D, 0xA3, 0x9E, 0x7A, 0xD3, 0xAE, 0x70, 0xE1, 0x9F, 0x70, 0x9E, 0xAF, 0xA7, 0x19, 0xFD,
+    0x97, 0x3A, 0xE9, 0x76, 0xAD, 0x97, 0x7A, 0xD9, 0x6A, 0x79, 0xE4, 0x9D, 0x97, 0xFA, 0x9A, 0xEA,
+    0x70, 0xAF, 0xFA, 0x72, 0xAF, 0xCA, 0x76, 0x99, 0x75, 0x74, 0x97, 0x71, 0x9E, 0xA1, 0x9C, 0x73,
+    0xFD, 0xAD, 0x73, 0xCA, 0x09, 0xFA, 0x73, 0xA3, 0xAA, 0x97, 0x77, 0x73, 0xE9, 0x77, 0xFC, 0x97,
+    0x5E, 0x9E, 0x97, 0x29, 0xE2, 0xDA, 0x72, 0x9C, 0x94, 0xA7, 0x77, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF,
+    0xEA, 0x59, 0xAE, 0xAA, 0xAA, 0xAA, 0xE9, 0x6A, 0xD9, 0x6D, 0x96, 0xE7, 0xD7, 0xE7, 0xCA, 0x69,
+    0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x77, 0x1E, 0xAA, 0xAA, 0xEA, 0x70, 0x9F, 0xFD,
+    0x97, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0x71, 0xE9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x70, 0x9D, 0xA7,
+    0x09, 0x6A, 0xDA, 0x7D, 0x6E, 0x96, 0x9D, 0x6E, 0x7D, 0xA5, 0x9E, 0x99, 0x9A, 0xAA, 0xAE, 0x93,
+    0xAF, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x30, 0x69, 0x99, 0x39, 0x6A, 0xF2, 0xCA, 0x49, 0xFD, 0xAD,
+    0xA4, 0xAC, 0xA0, 0x9F, 0xC6, 0xA3, 0xAC, 0xA7, 0x77, 0x19, 0xAA, 0x97, 0x2A, 0xF9, 0x70, 0xAD,
+    0xAE, 0x96, 0xE9, 0x09, 0xE5, 0xE9, 0x29, 0xD5, 0xAA, 0x5A, 0x97, 0x77, 0x77, 0x9F, 0xC9, 0x7F,
+    0xF6, 0xE2, 0xAD, 0x94, 0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xAD, 0x93, 0xDA, 0x39, 0xE3, 0xAD, 0x3A,
+    0xE4, 0xE1, 0x9F, 0x49, 0xEA, 0xFA, 0x59, 0xFD, 0x97, 0xAE, 0x97, 0x2A, 0xD9, 0x73, 0xAD, 0x96,
+    0xA3, 0x9E, 0x49, 0xD9, 0x3F, 0xA9, 0xAE, 0xA4, 0xAF, 0xFA, 0x6A, 0xFC, 0xA7, 0x29, 0x97, 0x10,
+    0x77, 0x77, 0x2E, 0x77, 0x0F, 0xC7, 0x6F, 0xE7, 0x4E, 0x90, 0xAD, 0xA7, 0x19, 0xE3, 0xAD, 0x71,
+    0xAC, 0xA5, 0xAA, 0x77, 0x77, 0x77, 0xFF, 0xFE, 0xA4, 0xFF, 0xFE, 0xA5, 0x9A, 0xEA, 0xAA, 0xAA,
+    0xAE, 0x96, 0xAD, 0x96, 0xD9, 0x6E, 0x7D, 0x7E, 0x7C, 0xA6, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x0E,
+    0x97, 0x70, 0xE7, 0x71, 0xEA, 0xAA, 0xAE, 0xA7, 0x09, 0xFF, 0xD9, 0x70, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x1E, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xDA, 0x70, 0x96, 0xAD, 0xA7, 0xD6, 0xE9,
+    0x69, 0xD6, 0xE7, 0xDA, 0x59, 0xE9, 0x99, 0xAA, 0xAA, 0xE9, 0x3A, 0xFF, 0xFE, 0x3A, 0xFF, 0xFE,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xD9, 0x77, 0x9E, 0xA7, 0x7F, 0x97, 0x7A, 0xDA, 0x77, 0x19,
+    0x74, 0x71, 0x99, 0x72, 0x9E, 0x97, 0x1F, 0xC7, 0x0E, 0xAD, 0x96, 0xAD, 0x1E, 0x5A, 0xD9, 0x19,
+    0xD4, 0x9D, 0x93, 0xD5, 0xA5, 0x99, 0x77, 0x77, 0x49, 0xFC, 0x96, 0xFF, 0x5E, 0x2A, 0xD9, 0x3D,
+    0xA3, 0x9D, 0x92, 0xAD, 0x4A, 0xD9, 0x2D, 0xA3, 0x9E, 0x2A, 0xD3, 0xAE, 0x3E, 0x19, 0xF3, 0x9E,
+    0xAF, 0xA4, 0x9F, 0xD9, 0x6A, 0xE9, 0x71, 0xAD, 0x97, 0x2A, 0xD9, 0x6A, 0x29, 0xE4, 0x9D, 0x92,
+    0xFA, 0x9A, 0xEA, 0x3A, 0xFF, 0xA5, 0xAF, 0xCA, 0x71, 0x99, 0x77, 0x77, 0x71, 0xAD, 0x97, 0x19,
+    0xEA, 0x71, 0xAE, 0xA7, 0x19, 0xDA, 0x77, 0x70, 0x77, 0x69, 0xFC, 0x79, 0xFD, 0xA6, 0xDA, 0x1E,
+    0x6A, 0xC2, 0xDA, 0x71, 0x9D, 0xA7, 0x1E, 0x97, 0x19, 0xD7, 0x4C, 0xA7, 0x77, 0x76, 0xFF, 0xC5,
+    0xFF, 0x96, 0x9A, 0xE9, 0x71, 0xAD, 0x97, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E,
+    0x97, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x29, 0xDA,
+    0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x70, 0xAF, 0xE9, 0x4A, 0xFF, 0x94, 0x69, 0xA9,
+    0x6A, 0xFC, 0x4E, 0x9E, 0x93, 0xD2, 0xD9, 0x3C, 0xA1, 0x9D, 0x79, 0xDA, 0x6A, 0xD9, 0x6A, 0xD7,
+    0x0A, 0xC9, 0x71, 0x97, 0x77, 0x59, 0xAF, 0x5F, 0xD9, 0x49, 0x99, 0xE7, 0x0E, 0x79, 0xDA, 0x7A,
+    0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x1A, 0x4E, 0x90, 0xD4,
+    0xFD, 0xA4, 0xFC, 0xA5, 0xF9, 0x79, 0x70, 0x4F, 0xFC, 0x5F, 0xF9, 0x69, 0xAE, 0x97, 0x1A, 0xD9,
+    0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x3E, 0x72, 0x9E, 0x72,
+    0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7,
+    0x29, 0xE7, 0x0A, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x77, 0x77, 0x39, 0xDA, 0x72, 0xF7, 0x19, 0xF7,
+    0x19, 0xE7, 0x49, 0x72, 0x79, 0x70, 0xE6, 0xAE, 0x95, 0xF6, 0xAD, 0x97, 0x77, 0x77, 0x69, 0xAF,
+    0x4F, 0xD9, 0x39, 0x99, 0xE7, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA6, 0xAD, 0x96,
+    0xE6, 0x9E, 0x6A, 0xDA, 0x1A, 0x3E, 0x90, 0xD3, 0xFD, 0xA3, 0xFC, 0xA4, 0xF9, 0x69, 0x77, 0x75,
+    0x9D, 0xA6, 0xF5, 0x9E, 0xA6, 0xDA, 0x77, 0x10, 0x77, 0x77, 0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70,
+    0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA,
+    0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1, 0xE7, 0x59,
+    0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE,
+    0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6,
+    0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x0A, 0xD9, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0x97, 0x71, 0xAD, 0xA7, 0x73, 0x97, 0x70, 0x77,
+    0x59, 0xFC, 0xA7, 0xFF, 0xC5, 0xEA, 0x90, 0x9F, 0x3E, 0x94, 0xE9, 0x1A, 0xDA, 0x5E, 0x90, 0x9E,
+    0x6A, 0xDA, 0x0A, 0xD9, 0x6A, 0xDA, 0x0E, 0x7A, 0xD9, 0x9E, 0x7E, 0x99, 0xDA, 0x7E, 0x0A, 0xDA,
+    0x69, 0xDA, 0x0A, 0xDA, 0x6E, 0x90, 0xAD, 0xA5, 0xAD, 0xA1, 0x9E, 0x49, 0xE3, 0xF2, 0xAE, 0x49,
+    0xFF, 0xC6, 0x9F, 0xD9, 0x72, 0x99, 0x77, 0x77, 0x73, 0xAD, 0x97, 0x29, 0xEA, 0x72, 0xAE, 0xA7,
+    0x29, 0xDA, 0x77, 0x71, 0x77, 0x77, 0x2A, 0xF9, 0x77, 0xFE, 0x76, 0xAD, 0x1A, 0xD7, 0x69, 0xC9,
+    0x1E, 0x77, 0x2E, 0x77, 0x1A, 0xDA, 0x77, 0x2D, 0x77, 0x4D, 0x77, 0x77, 0x77, 0x77, 0xAF, 0xE9,
+    0x73, 0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A,
+    0xE4, 0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97,
+    0x49, 0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A,
+    0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA,
+    0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70,
+    0x99, 0x74, 0x72, 0x9A, 0x97, 0x2A, 0xFC, 0x70, 0xE9, 0xE9, 0x7D, 0x2D, 0x97, 0xCA, 0x19, 0xD7,
+    0x39, 0xDA, 0x72, 0xAD, 0x97, 0x2A, 0xD7, 0x4A, 0xC9, 0x75, 0x97, 0x77, 0x77, 0x29, 0xFC, 0xA7,
+    0xFF, 0xC5, 0xEA, 0x90, 0x9F, 0x3E, 0x94, 0xE9, 0x1A, 0xDA, 0x5E, 0x90, 0x9E, 0x6A, 0xDA, 0x0A,
+    0xD9, 0x6A, 0xDA, 0x0E, 0x7A, 0xD9, 0x9E, 0x7E, 0x99, 0xDA, 0x7E, 0x0A, 0xDA, 0x69, 0xDA, 0x0A,
+    0xDA, 0x6E, 0x90, 0xAD, 0xA5, 0xAD, 0xA1, 0x9E, 0x49, 0xE3, 0xF2, 0xAE, 0x49, 0xFF, 0xC6, 0x9F,
+    0xD9, 0x72, 0x99, 0x70, 0x77, 0x77, 0x74, 0xCA, 0x77, 0x4A, 0xD9, 0x77, 0x29, 0xE7, 0x73, 0xE7,
+    0x69, 0x99, 0x1A, 0xCA, 0x76, 0xF9, 0x09, 0x97, 0x6F, 0xD9, 0x77, 0xE9, 0x0E, 0x76, 0xE3, 0xD9,
+    0x75, 0xAA, 0x49, 0xA7, 0x77, 0x76, 0xAF, 0xE9, 0x74, 0xAF, 0xFE, 0x71, 0x9F, 0xA9, 0x99, 0x9F,
+    0xC7, 0x9E, 0xA6, 0x9E, 0xA5, 0x9E, 0x97, 0x0A, 0xE5, 0xEA, 0x72, 0xEA, 0x3A, 0xE7, 0x3A, 0xE3,
+    0xE7, 0x4A, 0xE2, 0xAE, 0x74, 0x9E, 0x2E, 0x97, 0x49, 0xE2, 0xE7, 0x59, 0xE1, 0x9E, 0x75, 0xAE,
+    0x1A, 0xE7, 0x5E, 0xA1, 0xAE, 0x75, 0xE9, 0x1A, 0xE7, 0x49, 0xE2, 0xAE, 0x74, 0xEA, 0x29, 0xE7,
+    0x39, 0xE4, 0xE9, 0x72, 0xE9, 0x4F, 0x71, 0xEA, 0x59, 0xEA, 0x69, 0xF7, 0xAF, 0x91, 0x99, 0xFA,
+    0x71, 0xAF, 0xFE, 0x97, 0x39, 0xFF, 0x97, 0x71, 0x99, 0x75, 0x77, 0x19, 0x77, 0x3D, 0x77, 0x1E,
+    0x77, 0x0A, 0xE7, 0x79, 0xDA, 0x77, 0x0D, 0xA7, 0x70, 0x9C, 0x97, 0x4A, 0xE7, 0x7A, 0xFC, 0x75,
+    0xAE, 0xAE, 0x73, 0xAE, 0x1A, 0xD9, 0x71, 0xAE, 0x3A, 0xCA, 0x71, 0x9A, 0x95, 0xA7, 0x77, 0x77,
+    0x75, 0x9F, 0xCA, 0x74, 0xFF, 0xC7, 0x2E, 0xA9, 0x09, 0xF7, 0x0E, 0x94, 0xE9, 0x6A, 0xDA, 0x5E,
+    0x95, 0x9E, 0x6A, 0xDA, 0x5A, 0xD9, 0x6A, 0xDA, 0x5E, 0x7A, 0xD9, 0x49, 0xE7, 0xE9, 0x49, 0xDA,
+    0x7E, 0x5A, 0xDA, 0x69, 0xDA, 0x5A, 0xDA, 0x6E, 0x95, 0xAD, 0xA5, 0xAD, 0xA6, 0x9E, 0x49, 0xE7,
+    0x0F, 0x2A, 0xE7, 0x19, 0xFF, 0xC7, 0x39, 0xFD, 0x97, 0x79, 0x97, 0x50, 0x77, 0x77, 0x6A, 0xC7,
+    0x73, 0x9D, 0x97, 0x73, 0xE7, 0x74, 0xDA, 0x77, 0x99, 0x91, 0xD7, 0x6F, 0x91, 0x97, 0x5F, 0xD9,
+    0x76, 0xE9, 0x0E, 0x75, 0xE3, 0xD9, 0x74, 0xAA, 0x49, 0xA7, 0x77, 0x74, 0xAF, 0xE9, 0x73, 0xAF,
+    0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E, 0x97, 0x0A, 0xE4, 0xEA,
+    0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E, 0x1E, 0x97, 0x49, 0xE1,
+    0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75, 0xE9, 0x0A, 0xE7, 0x49,
+    0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F, 0x71, 0xEA, 0x49, 0xEA,
+    0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x74,
+    0x74, 0x97, 0x7D, 0x76, 0x9D, 0xA7, 0x6E, 0x97, 0x6E, 0x77, 0xDA, 0x77, 0xD7, 0x1A, 0xE2, 0x97,
+    0x0A, 0xFC, 0x72, 0xAE, 0xAE, 0x70, 0xAE, 0x1A, 0xD9, 0x6A, 0xE3, 0xAC, 0xA6, 0x9A, 0x95, 0xA7,
+    0x77, 0x77, 0x49, 0xFC, 0xA7, 0x1F, 0xFC, 0x7E, 0xA9, 0x09, 0xF5, 0xE9, 0x4E, 0x93, 0xAD, 0xA5,
+    0xE9, 0x29, 0xE6, 0xAD, 0xA2, 0xAD, 0x96, 0xAD, 0xA2, 0xE7, 0xAD, 0x91, 0x9E, 0x7E, 0x91, 0x9D,
+    0xA7, 0xE2, 0xAD, 0xA6, 0x9D, 0xA2, 0xAD, 0xA6, 0xE9, 0x2A, 0xDA, 0x5A, 0xDA, 0x39, 0xE4, 0x9E,
+    0x5F, 0x2A, 0xE6, 0x9F, 0xFC, 0x70, 0x9F, 0xD9, 0x74, 0x99, 0x72, 0x77, 0x39, 0x77, 0x4F, 0x97,
+    0x71, 0xD9, 0xAD, 0x77, 0x1C, 0xA0, 0x9D, 0x77, 0x4D, 0x97, 0x72, 0xAC, 0xA7, 0x6A, 0xE9, 0x0A,
+    0xC7, 0x6A, 0xFC, 0x97, 0x7A, 0xD9, 0x0E, 0x76, 0xE9, 0x2D, 0xA7, 0x5A, 0xA5, 0xA7, 0x77, 0x76,
+    0xAF, 0xE9, 0x74, 0xAF, 0xFE, 0x71, 0x9F, 0xA9, 0x99, 0x9F, 0xC7, 0x9E, 0xA6, 0x9E, 0xA5, 0x9E,
+    0x97, 0x0A, 0xE5, 0xEA, 0x72, 0xEA, 0x3A, 0xE7, 0x3A, 0xE3, 0xE7, 0x4A, 0xE2, 0xAE, 0x74, 0x9E,
+    0x2E, 0x97, 0x49, 0xE2, 0xE7, 0x59, 0xE1, 0x9E, 0x75, 0xAE, 0x1A, 0xE7, 0x5E, 0xA1, 0xAE, 0x75,
+    0xE9, 0x1A, 0xE7, 0x49, 0xE2, 0xAE, 0x74, 0xEA, 0x29, 0xE7, 0x39, 0xE4, 0xE9, 0x72, 0xE9, 0x4F,
+    0x71, 0xEA, 0x59, 0xEA, 0x69, 0xF7, 0xAF, 0x91, 0x99, 0xFA, 0x71, 0xAF, 0xFE, 0x97, 0x39, 0xFF,
+    0x97, 0x71, 0x99, 0x75, 0x77, 0x99, 0x97, 0x79, 0xFC, 0x97, 0x5D, 0xA9, 0xE7, 0x5C, 0xA1, 0xAD,
+    0x77, 0x09, 0xD9, 0x76, 0x9A, 0xD9, 0x77, 0xAC, 0xA7, 0x39, 0xAA, 0xA1, 0x9C, 0x97, 0x29, 0xFC,
+    0x75, 0x9E, 0xAE, 0x73, 0x9E, 0x1A, 0xD9, 0x71, 0xAD, 0xA3, 0xDA, 0x71, 0x9A, 0x95, 0xA7, 0x77,
+    0x77, 0x75, 0x9F, 0xCA, 0x74, 0xFF, 0xC7, 0x2E, 0xA9, 0x09, 0xF7, 0x0E, 0x94, 0xE9, 0x6A, 0xDA,
+    0x5E, 0x95, 0x9E, 0x6A, 0xDA, 0x5A, 0xD9, 0x6A, 0xDA, 0x5E, 0x7A, 0xD9, 0x49, 0xE7, 0xE9, 0x49,
+    0xDA, 0x7E, 0x5A, 0xDA, 0x69, 0xDA, 0x5A, 0xDA, 0x6E, 0x95, 0xAD, 0xA5, 0xAD, 0xA6, 0x9E, 0x49,
+    0xE7, 0x0F, 0x2A, 0xE7, 0x19, 0xFF, 0xC7, 0x39, 0xFD, 0x97, 0x79, 0x97, 0x50, 0x77, 0x77, 0x1E,
+    0xA1, 0x9C, 0x75, 0xFD, 0xAD, 0x75, 0xCA, 0x09, 0xFA, 0x75, 0x93, 0xAA, 0x97, 0x77, 0x77, 0xEA,
+    0x77, 0x1F, 0xC9, 0x77, 0xE9, 0xAD, 0x97, 0x49, 0xE2, 0xDA, 0x74, 0x9C, 0xA4, 0xA7, 0x77, 0x75,
+    0xAF, 0xE9, 0x73, 0xAF, 0xFE, 0x70, 0x9F, 0xA9, 0x99, 0x9F, 0xC6, 0x9E, 0xA6, 0x9E, 0xA4, 0x9E,
+    0x97, 0x0A, 0xE4, 0xEA, 0x72, 0xEA, 0x2A, 0xE7, 0x3A, 0xE2, 0xE7, 0x4A, 0xE1, 0xAE, 0x74, 0x9E,
+    0x1E, 0x97, 0x49, 0xE1, 0xE7, 0x59, 0xE0, 0x9E, 0x75, 0xAE, 0x0A, 0xE7, 0x5E, 0xA0, 0xAE, 0x75,
+    0xE9, 0x0A, 0xE7, 0x49, 0xE1, 0xAE, 0x74, 0xEA, 0x19, 0xE7, 0x39, 0xE3, 0xE9, 0x72, 0xE9, 0x3F,
+    0x71, 0xEA, 0x49, 0xEA, 0x69, 0xF6, 0xAF, 0x91, 0x99, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x29, 0xFF,
+    0x97, 0x70, 0x99, 0x74, 0x70, 0x99, 0x75, 0x9F, 0x91, 0xD7, 0xFD, 0xAA, 0xD7, 0xD1, 0xAF, 0x97,
+    0xA9, 0x29, 0xCA, 0x97, 0x77, 0x49, 0xAA, 0xA7, 0x49, 0xFC, 0x72, 0x9F, 0xDA, 0x70, 0xAD, 0xA1,
+    0xE9, 0x6A, 0xDA, 0x3D, 0x96, 0x9A, 0x59, 0xA7, 0x77, 0x77, 0x49, 0xFC, 0xA7, 0x1F, 0xFC, 0x7E,
+    0xA9, 0x09, 0xF5, 0xE9, 0x4E, 0x93, 0xAD, 0xA5, 0xE9, 0x29, 0xE6, 0xAD, 0xA2, 0xAD, 0x96, 0xAD,
+    0xA2, 0xE7, 0xAD, 0x91, 0x9E, 0x7E, 0x91, 0x9D, 0xA7, 0xE2, 0xAD, 0xA6, 0x9D, 0xA2, 0xAD, 0xA6,
+    0xE9, 0x2A, 0xDA, 0x5A, 0xDA, 0x39, 0xE4, 0x9E, 0x5F, 0x2A, 0xE6, 0x9F, 0xFC, 0x70, 0x9F, 0xD9,
+    0x74, 0x99, 0x72, 0x77, 0x77, 0x3E, 0x97, 0x71, 0xFC, 0x77, 0x0E, 0xAE, 0x76, 0xE9, 0x0A, 0xDA,
+    0x73, 0x9E, 0x3A, 0xD7, 0x3A, 0xCA, 0x5A, 0xA7, 0x77, 0x77, 0x77, 0x2A, 0xFE, 0x97, 0x3A, 0xFF,
+    0xE7, 0x09, 0xFA, 0x99, 0x99, 0xFC, 0x69, 0xEA, 0x69, 0xEA, 0x49, 0xE9, 0x70, 0xAE, 0x4E, 0xA7,
+    0x2E, 0xA2, 0xAE, 0x73, 0xAE, 0x2E, 0x74, 0xAE, 0x1A, 0xE7, 0x49, 0xE1, 0xE9, 0x74, 0x9E, 0x1E,
+    0x75, 0x9E, 0x09, 0xE7, 0x5A, 0xE0, 0xAE, 0x75, 0xEA, 0x0A, 0xE7, 0x5E, 0x90, 0xAE, 0x74, 0x9E,
+    0x1A, 0xE7, 0x4E, 0xA1, 0x9E, 0x73, 0x9E, 0x3E, 0x97, 0x2E, 0x93, 0xF7, 0x1E, 0xA4, 0x9E, 0xA6,
+    0x9F, 0x6A, 0xF9, 0x19, 0x9F, 0xA7, 0x0A, 0xFF, 0xE9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x77,
+    0x77, 0x77, 0x70, 0xAD, 0x97, 0x71, 0xAE, 0xA7, 0x71, 0xF9, 0x77, 0x1A, 0xDA, 0x77, 0x39, 0x77,
+    0x73, 0x97, 0x4F, 0x72, 0xAF, 0x97, 0x09, 0xDA, 0xE7, 0x9D, 0x90, 0xAD, 0x7D, 0xA2, 0xDA, 0x5D,
+    0xA3, 0xAC, 0xA5, 0x99, 0x59, 0x77, 0x77, 0x69, 0xFC, 0xA7, 0xFF, 0xC5, 0xEA, 0x90, 0x9F, 0x3E,
+    0x94, 0xE9, 0x1A, 0xDA, 0x5E, 0x90, 0x9E, 0x6A, 0xDA, 0x0A, 0xD9, 0x6A, 0xDA, 0x0E, 0x7A, 0xD9,
+    0x9E, 0x7E, 0x99, 0xDA, 0x7E, 0x0A, 0xDA, 0x69, 0xDA, 0x0A, 0xDA, 0x6E, 0x90, 0xAD, 0xA5, 0xAD,
+    0xA1, 0x9E, 0x49, 0xE3, 0xF2, 0xAE, 0x49, 0xFF, 0xC6, 0x9F, 0xD9, 0x72, 0x99, 0x77, 0x77, 0x73,
+    0xAD, 0x97, 0x29, 0xEA, 0x72, 0xAE, 0xA7, 0x29, 0xDA, 0x77, 0x71, 0x77, 0x77, 0x70, 0xAC, 0xA7,
+    0x74, 0x9E, 0xA7, 0x73, 0xAF, 0x97, 0x71, 0x9F, 0xC9, 0x77, 0x2E, 0xA9, 0x6E, 0x72, 0x97, 0x2E,
+    0x97, 0x74, 0x9E, 0x77, 0x5E, 0xA7, 0x1A, 0xFE, 0x91, 0xAE, 0x70, 0xAF, 0xFE, 0xAD, 0xA7, 0x9F,
+    0xA9, 0x99, 0x9F, 0xD9, 0x79, 0xEA, 0x69, 0xEA, 0x79, 0xE9, 0x70, 0xAE, 0x96, 0xEA, 0x72, 0xEA,
+    0x5A, 0xE7, 0x3A, 0xE5, 0xE7, 0x4A, 0xE4, 0xAE, 0x74, 0x9E, 0x4E, 0x97, 0x49, 0xE4, 0xE7, 0x59,
+    0xE3, 0x9E, 0x75, 0xAE, 0x3A, 0xE7, 0x5E, 0xA3, 0xAE, 0x75, 0xE9, 0x3A, 0xE7, 0x49, 0xE4, 0xAE,
+    0x74, 0xEA, 0x49, 0xE7, 0x39, 0xE6, 0xE9, 0x72, 0xE9, 0x6F, 0x71, 0xEA, 0x79, 0xEA, 0x69, 0xF7,
+    0x1A, 0xF9, 0x19, 0x9F, 0xA7, 0x3A, 0xFF, 0xE9, 0x75, 0x9F, 0xF9, 0x77, 0x39, 0x97, 0x70, 0x73,
+    0xC9, 0x77, 0xAD, 0x76, 0x9E, 0x76, 0xE7, 0x6E, 0x97, 0x5A, 0xD7, 0x7D, 0x49, 0xAA, 0x77, 0xE9,
+    0x76, 0xE9, 0x75, 0x9E, 0x69, 0xFC, 0xA9, 0xE6, 0xFF, 0xE6, 0xEA, 0x90, 0x9F, 0x6E, 0x94, 0xE5,
+    0xAD, 0xA5, 0xAD, 0x93, 0x9E, 0x6A, 0xDA, 0x3A, 0xD9, 0x6A, 0xDA, 0x3E, 0x7A, 0xD9, 0x29, 0xE7,
+    0xE9, 0x29, 0xDA, 0x7E, 0x3A, 0xDA, 0x69, 0xDA, 0x3A, 0xDA, 0x6E, 0x93, 0xAD, 0xA5, 0xAE, 0x49,
+    0xE4, 0x9E, 0x6F, 0x2A, 0xE9, 0x69, 0xFF, 0xC7, 0x19, 0xFD, 0x97, 0x59, 0x97, 0x30, 0x77, 0x77,
+    0x2C, 0xA7, 0x76, 0x9E, 0x77, 0x59, 0xF7, 0x75, 0xAF, 0x97, 0x75, 0xAE, 0x6E, 0x75, 0x99, 0x6E,
+    0x97, 0x74, 0x9E, 0x77, 0x5E, 0xA7, 0x1A, 0xFE, 0x91, 0xAE, 0x70, 0xAF, 0xFE, 0xAD, 0xA7, 0x9F,
+    0xA9, 0x99, 0x9F, 0xD9, 0x79, 0xEA, 0x69, 0xEA, 0x79, 0xE9, 0x70, 0xAE, 0x96, 0xEA, 0x72, 0xEA,
+    0x5A, 0xE7, 0x3A, 0xE5, 0xE7, 0x4A, 0xE4, 0xAE, 0x74, 0x9E, 0x4E, 0x97, 0x49, 0xE4, 0xE7, 0x59,
+    0xE3, 0x9E, 0x75, 0xAE, 0x3A, 0xE7, 0x5E, 0xA3, 0xAE, 0x75, 0xE9, 0x3A, 0xE7, 0x49, 0xE4, 0xAE,
+    0x74, 0xEA, 0x49, 0xE7, 0x39, 0xE6, 0xE9, 0x72, 0xE9, 0x6F, 0x71, 0xEA, 0x79, 0xEA, 0x69, 0xF7,
+    0x1A, 0xF9, 0x19, 0x9F, 0xA7, 0x3A, 0xFF, 0xE9, 0x75, 0x9F, 0xF9, 0x77, 0x39, 0x97, 0x70, 0x69,
+    0x77, 0x0D, 0x77, 0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0x9E, 0x77, 0x0D, 0x92, 0x9A, 0xA7, 0x2A,
+    0x3E, 0x97, 0x6E, 0x97, 0x59, 0xE6, 0x9F, 0xCA, 0x9E, 0x6F, 0xFE, 0x6E, 0xA9, 0x09, 0xF6, 0xE9,
+    0x4E, 0x5A, 0xDA, 0x5A, 0xD9, 0x39, 0xE6, 0xAD, 0xA3, 0xAD, 0x96, 0xAD, 0xA3, 0xE7, 0xAD, 0x92,
+    0x9E, 0x7E, 0x92, 0x9D, 0xA7, 0xE3, 0xAD, 0xA6, 0x9D, 0xA3, 0xAD, 0xA6, 0xE9, 0x3A, 0xDA, 0x5A,
+    0xE4, 0x9E, 0x49, 0xE6, 0xF2, 0xAE, 0x96, 0x9F, 0xFC, 0x71, 0x9F, 0xD9, 0x75, 0x99, 0x73, 0x77,
+    0x77, 0x4A, 0xF9, 0x77, 0x2F, 0xE7, 0x71, 0xAD, 0x1A, 0xD7, 0x71, 0x9C, 0x91, 0xE7, 0x75, 0xE7,
+    0x74, 0xAD, 0xA7, 0x75, 0xD7, 0x0E, 0x73, 0xD7, 0x0E, 0x97, 0x74, 0x9E, 0x77, 0x5E, 0xA7, 0x1A,
+    0xFE, 0x91, 0xAE, 0x70, 0xAF, 0xFE, 0xAD, 0xA7, 0x9F, 0xA9, 0x99, 0x9F, 0xD9, 0x79, 0xEA, 0x69,
+    0xEA, 0x79, 0xE9, 0x70, 0xAE, 0x96, 0xEA, 0x72, 0xEA, 0x5A, 0xE7, 0x3A, 0xE5, 0xE7, 0x4A, 0xE4,
+    0xAE, 0x74, 0x9E, 0x4E, 0x97, 0x49, 0xE4, 0xE7, 0x59, 0xE3, 0x9E, 0x75, 0xAE, 0x3A, 0xE7, 0x5E,
+    0xA3, 0xAE, 0x75, 0xE9, 0x3A, 0xE7, 0x49, 0xE4, 0xAE, 0x74, 0xEA, 0x49, 0xE7, 0x39, 0xE6, 0xE9,
+    0x72, 0xE9, 0x6F, 0x71, 0xEA, 0x79, 0xEA, 0x69, 0xF7, 0x1A, 0xF9, 0x19, 0x9F, 0xA7, 0x3A, 0xFF,
+    0xE9, 0x75, 0x9F, 0xF9, 0x77, 0x39, 0x97, 0x70, 0x70, 0x9A, 0x97, 0x6F, 0xCA, 0x73, 0xDA, 0x9E,
+    0x72, 0xAC, 0xA1, 0xAD, 0x72, 0x9C, 0x91, 0xE7, 0x6A, 0xD7, 0x6E, 0x76, 0xDA, 0x77, 0xD4, 0x9A,
+    0xA7, 0x09, 0x94, 0xE9, 0x76, 0xE9, 0x75, 0x9E, 0x69, 0xFC, 0xA9, 0xE6, 0xFF, 0xE6, 0xEA, 0x90,
+    0x9F, 0x6E, 0x94, 0xE5, 0xAD, 0xA5, 0xAD, 0x93, 0x9E, 0x6A, 0xDA, 0x3A, 0xD9, 0x6A, 0xDA, 0x3E,
+    0x7A, 0xD9, 0x29, 0xE7, 0xE9, 0x29, 0xDA, 0x7E, 0x3A, 0xDA, 0x69, 0xDA, 0x3A, 0xDA, 0x6E, 0x93,
+    0xAD, 0xA5, 0xAE, 0x49, 0xE4, 0x9E, 0x6F, 0x2A, 0xE9, 0x69, 0xFF, 0xC7, 0x19, 0xFD, 0x97, 0x59,
+    0x97, 0x30, 0x70, 0x9D, 0xA2, 0xAA, 0x77, 0x9F, 0xA1, 0xD7, 0x7F, 0xFD, 0x77, 0xD1, 0xFC, 0x77,
+    0x0A, 0x92, 0xE5, 0xE7, 0x76, 0xE9, 0x77, 0x49, 0xE7, 0x75, 0xEA, 0x71, 0xAF, 0xE9, 0x1A, 0xE7,
+    0x0A, 0xFF, 0xEA, 0xDA, 0x79, 0xFA, 0x99, 0x99, 0xFD, 0x97, 0x9E, 0xA6, 0x9E, 0xA7, 0x9E, 0x97,
+    0x0A, 0xE9, 0x6E, 0xA7, 0x2E, 0xA5, 0xAE, 0x73, 0xAE, 0x5E, 0x74, 0xAE, 0x4A, 0xE7, 0x49, 0xE4,
+    0xE9, 0x74, 0x9E, 0x4E, 0x75, 0x9E, 0x39, 0xE7, 0x5A, 0xE3, 0xAE, 0x75, 0xEA, 0x3A, 0xE7, 0x5E,
+    0x93, 0xAE, 0x74, 0x9E, 0x4A, 0xE7, 0x4E, 0xA4, 0x9E, 0x73, 0x9E, 0x6E, 0x97, 0x2E, 0x96, 0xF7,
+    0x1E, 0xA7, 0x9E, 0xA6, 0x9F, 0x71, 0xAF, 0x91, 0x99, 0xFA, 0x73, 0xAF, 0xFE, 0x97, 0x59, 0xFF,
+    0x97, 0x73, 0x99, 0x77, 0x69, 0x97, 0x7A, 0xE2, 0xD7, 0x0A, 0xFC, 0x09, 0xD7, 0x0D, 0xA9, 0xFC,
+    0xA7, 0x0D, 0x1A, 0xF7, 0x69, 0xA9, 0x19, 0xAA, 0x77, 0xE9, 0x76, 0xE9, 0x75, 0x9E, 0x69, 0xFC,
+    0xA9, 0xE6, 0xFF, 0xE6, 0xEA, 0x90, 0x9F, 0x6E, 0x94, 0xE5, 0xAD, 0xA5, 0xAD, 0x93, 0x9E, 0x6A,
+    0xDA, 0x3A, 0xD9, 0x6A, 0xDA, 0x3E, 0x7A, 0xD9, 0x29, 0xE7, 0xE9, 0x29, 0xDA, 0x7E, 0x3A, 0xDA,
+    0x69, 0xDA, 0x3A, 0xDA, 0x6E, 0x93, 0xAD, 0xA5, 0xAE, 0x49, 0xE4, 0x9E, 0x6F, 0x2A, 0xE9, 0x69,
+    0xFF, 0xC7, 0x19, 0xFD, 0x97, 0x59, 0x97, 0x30, 0x77, 0x77, 0x77, 0xE7, 0x76, 0xE9, 0x77, 0x49,
+    0xE7, 0x75, 0xEA, 0x71, 0xAF, 0xE9, 0x1A, 0xE7, 0x0A, 0xFF, 0xEA, 0xDA, 0x79, 0xFA, 0x99, 0x99,
+    0xFD, 0x97, 0x9E, 0xA6, 0x9E, 0xA7, 0x9E, 0x97, 0x0A, 0xE9, 0x6E, 0xA7, 0x2E, 0xA5, 0xAE, 0x73,
+    0xAE, 0x5E, 0x74, 0xAE, 0x4A, 0xE7, 0x49, 0xE4, 0xE9, 0x74, 0x9E, 0x4E, 0x75, 0x9E, 0x39, 0xE7,
+    0x5A, 0xE3, 0xAE, 0x75, 0xEA, 0x3A, 0xE7, 0x5E, 0x93, 0xAE, 0x74, 0x9E, 0x4A, 0xE7, 0x4E, 0xA4,
+    0x9E, 0x73, 0x9E, 0x6E, 0x97, 0x2E, 0x96, 0xF7, 0x1E, 0xA7, 0x9E, 0xA6, 0x9F, 0x71, 0xAF, 0x91,
+    0x99, 0xFA, 0x73, 0xAF, 0xFE, 0x97, 0x59, 0xFF, 0x97, 0x73, 0x99, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xAD, 0x97, 0x74, 0xAE, 0xA7, 0x74, 0xF9, 0x77, 0x4A, 0xDA, 0x77, 0x69, 0x77, 0x20, 0x76, 0x9A,
+    0xA7, 0x7E, 0x97, 0x6E, 0x97, 0x59, 0xE6, 0x9F, 0xCA, 0x9E, 0x6F, 0xFE, 0x6E, 0xA9, 0x09, 0xF6,
+    0xE9, 0x4E, 0x5A, 0xDA, 0x5A, 0xD9, 0x39, 0xE6, 0xAD, 0xA3, 0xAD, 0x96, 0xAD, 0xA3, 0xE7, 0xAD,
+    0x92, 0x9E, 0x7E, 0x92, 0x9D, 0xA7, 0xE3, 0xAD, 0xA6, 0x9D, 0xA3, 0xAD, 0xA6, 0xE9, 0x3A, 0xDA,
+    0x5A, 0xE4, 0x9E, 0x49, 0xE6, 0xF2, 0xAE, 0x96, 0x9F, 0xFC, 0x71, 0x9F, 0xD9, 0x75, 0x99, 0x77,
+    0x77, 0x77, 0x4A, 0xD9, 0x75, 0x9E, 0xA7, 0x5A, 0xEA, 0x75, 0x9D, 0xA7, 0x77, 0x70, 0x9F, 0xF5,
+    0xFF, 0x0A, 0xFE, 0xA5, 0xFE, 0xA2, 0x9E, 0x97, 0x09, 0xE9, 0x5E, 0x72, 0xE5, 0x9E, 0x72, 0xDA,
+    0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x95, 0xE7, 0x2A, 0xD5, 0x9E, 0x72, 0xE5, 0x9D,
+    0xA7, 0x2D, 0xA5, 0xAD, 0x97, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD6, 0xE7, 0x2A, 0xD5, 0x9E, 0x72,
+    0xE5, 0x9D, 0xA7, 0x2D, 0xA5, 0xAD, 0xA7, 0x19, 0xD9, 0x5A, 0xDA, 0x71, 0xAD, 0x6A, 0xDA, 0x71,
+    0xDA, 0x6A, 0xE7, 0x0E, 0x79, 0xEA, 0x6E, 0x97, 0x0F, 0xCA, 0x99, 0xAF, 0xA7, 0x2F, 0xFE, 0x97,
+    0x4A, 0xFE, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x77, 0x77, 0x49, 0xDA, 0x77, 0x3F, 0x77, 0x2A, 0xEA,
+    0x77, 0x29, 0xE7, 0x77, 0x77, 0x77, 0x39, 0xAF, 0x6A, 0xD1, 0x9F, 0xD5, 0x9E, 0x29, 0x99, 0xE5,
+    0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x95, 0xE5, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD,
+    0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9E, 0x5E, 0x5E, 0xA5, 0xE4, 0xAE, 0x94, 0x9D, 0xA3, 0xAC,
+    0xAD, 0x91, 0xA1, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x19, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x2F, 0xE2,
+    0xFC, 0x3A, 0xFA, 0x3E, 0xA6, 0x97, 0x97, 0x77, 0x77, 0x70, 0xE7, 0x6F, 0x76, 0xF7, 0x6E, 0x77,
+    0x75, 0x77, 0x77, 0x2A, 0xF9, 0x77, 0x0F, 0xE7, 0x79, 0xD1, 0x9D, 0x77, 0x0C, 0x91, 0xAD, 0x77,
+    0x3A, 0xD7, 0x72, 0x9D, 0xA7, 0x73, 0xD9, 0x77, 0x4A, 0xC7, 0x77, 0x77, 0x77, 0x29, 0xFF, 0x5F,
+    0xF0, 0xAF, 0xEA, 0x5F, 0xEA, 0x29, 0xE9, 0x70, 0x9E, 0x95, 0xE7, 0x2E, 0x59, 0xE7, 0x2D, 0xA5,
+    0xAD, 0xA7, 0x19, 0xD9, 0x5E, 0x97, 0x19, 0xD9, 0x5E, 0x72, 0xAD, 0x59, 0xE7, 0x2E, 0x59, 0xDA,
+    0x72, 0xDA, 0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xE9, 0x71, 0x9D, 0x6E, 0x72, 0xAD, 0x59, 0xE7, 0x2E,
+    0x59, 0xDA, 0x72, 0xDA, 0x5A, 0xDA, 0x71, 0x9D, 0x95, 0xAD, 0xA7, 0x1A, 0xD6, 0xAD, 0xA7, 0x1D,
+    0xA6, 0xAE, 0x70, 0xE7, 0x9E, 0xA6, 0xE9, 0x70, 0xFC, 0xA9, 0x9A, 0xFA, 0x72, 0xFF, 0xE9, 0x74,
+    0xAF, 0xEA, 0x77, 0x19, 0x97, 0x70, 0x72, 0x9A, 0x97, 0x5A, 0xFC, 0x73, 0xAD, 0xAA, 0xDA, 0x72,
+    0xD2, 0xDA, 0x72, 0xAA, 0x19, 0xD9, 0x75, 0x9D, 0xA7, 0x5A, 0xDA, 0x75, 0xAD, 0x97, 0x69, 0xCA,
+    0x77, 0x09, 0x77, 0x77, 0x76, 0x9A, 0xF6, 0xAD, 0x19, 0xFD, 0x59, 0xE2, 0x99, 0x9E, 0x59, 0xDA,
+    0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x5E, 0x5A, 0xD9, 0x5E, 0x5E, 0x59, 0xDA, 0x5E, 0x5A, 0xD9, 0x49,
+    0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xE5, 0xE5, 0xEA, 0x5E, 0x4A, 0xE9, 0x49, 0xDA, 0x3A, 0xCA, 0xD9,
+    0x1A, 0x19, 0xDA, 0x2A, 0xD0, 0xD1, 0xD1, 0x9E, 0x99, 0xE0, 0x9D, 0xAD, 0xA2, 0xFE, 0x2F, 0xC3,
+    0xAF, 0xA3, 0xEA, 0x69, 0x79, 0x40, 0x77, 0x77, 0x70, 0x9C, 0xA7, 0x75, 0xF7, 0x73, 0xAF, 0xA7,
+    0x71, 0x9F, 0xCA, 0x77, 0x2E, 0xA9, 0x59, 0xDA, 0x72, 0x99, 0x70, 0x9E, 0x77, 0x59, 0xE7, 0x74,
+    0x9E, 0x90, 0x9F, 0xF5, 0xFF, 0x91, 0xAF, 0xEA, 0x5F, 0xDA, 0x59, 0xE9, 0x70, 0x9E, 0x70, 0xE7,
+    0x2E, 0x79, 0xE7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7E, 0x97, 0x19, 0xD9, 0x7E, 0x72, 0xAD,
+    0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72, 0xDA, 0x7A, 0xD9, 0x71, 0x9D, 0x97, 0xE9, 0x71, 0x9D, 0x70,
+    0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7, 0x9D, 0xA7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7A, 0xDA,
+    0x71, 0xAD, 0x70, 0xAD, 0xA7, 0x1D, 0xA7, 0x0A, 0xE7, 0x0E, 0x71, 0x9E, 0xA6, 0xE9, 0x72, 0xFC,
+    0xA9, 0x9A, 0xFA, 0x74, 0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x74, 0x9A, 0x77,
+    0x3D, 0xA7, 0x71, 0xE9, 0x77, 0x0A, 0xDA, 0x77, 0x09, 0xDA, 0x77, 0x1D, 0xA7, 0x71, 0x9C, 0xA5,
+    0xAC, 0xA7, 0x72, 0xE7, 0x71, 0x9E, 0x77, 0x09, 0xE9, 0x19, 0xAF, 0x6A, 0xF9, 0x19, 0xFD, 0x59,
+    0xE9, 0x49, 0x99, 0xE5, 0x9D, 0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x70, 0xAD, 0x95, 0xE7,
+    0x0E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x49, 0xE7, 0x0E, 0x5E,
+    0xA7, 0x0E, 0x4A, 0xE9, 0x79, 0xDA, 0x3A, 0xCA, 0xD9, 0x1A, 0x49, 0xDA, 0x2A, 0xD0, 0xD1, 0xD4,
+    0x9E, 0x99, 0xE0, 0x9D, 0xAD, 0xA5, 0xFE, 0x2F, 0xC6, 0xAF, 0xA3, 0xEA, 0x71, 0x97, 0x97, 0x77,
+    0x77, 0x2A, 0xC7, 0x76, 0x9E, 0x77, 0x59, 0xF9, 0x77, 0x4A, 0xF9, 0x77, 0x5A, 0xE5, 0x9D, 0xA7,
+    0x69, 0x59, 0xE7, 0x75, 0x9E, 0x77, 0x49, 0xE9, 0x09, 0xFF, 0x5F, 0xF9, 0x1A, 0xFE, 0xA5, 0xFD,
+    0xA5, 0x9E, 0x97, 0x09, 0xE7, 0x0E, 0x72, 0xE7, 0x9E, 0x72, 0xDA, 0x7A, 0xDA, 0x71, 0x9D, 0x97,
+    0xE9, 0x71, 0x9D, 0x97, 0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7, 0x9D, 0xA7, 0x2D, 0xA7, 0xAD, 0x97,
+    0x19, 0xD9, 0x7E, 0x97, 0x19, 0xD7, 0x0E, 0x72, 0xAD, 0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72, 0xDA,
+    0x7A, 0xDA, 0x71, 0x9D, 0x97, 0xAD, 0xA7, 0x1A, 0xD7, 0x0A, 0xDA, 0x71, 0xDA, 0x70, 0xAE, 0x70,
+    0xE7, 0x19, 0xEA, 0x6E, 0x97, 0x2F, 0xCA, 0x99, 0xAF, 0xA7, 0x4F, 0xFE, 0x97, 0x6A, 0xFE, 0xA7,
+    0x73, 0x99, 0x77, 0x10, 0x79, 0x77, 0x39, 0xCA, 0x77, 0x2E, 0x97, 0x71, 0xAE, 0x77, 0x2E, 0xA7,
+    0x72, 0xAD, 0x97, 0x72, 0xAD, 0x4A, 0xCA, 0x73, 0x99, 0x4E, 0x77, 0x19, 0xE7, 0x70, 0x9E, 0x91,
+    0x9A, 0xF6, 0xAF, 0x91, 0x9F, 0xD5, 0x9E, 0x94, 0x99, 0x9E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97,
+    0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x5E, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E,
+    0x70, 0xAD, 0x94, 0x9E, 0x70, 0xE5, 0xEA, 0x70, 0xE4, 0xAE, 0x97, 0x9D, 0xA3, 0xAC, 0xAD, 0x91,
+    0xA4, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x49, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x5F, 0xE2, 0xFC, 0x6A,
+    0xFA, 0x3E, 0xA7, 0x19, 0x79, 0x70, 0x77, 0x77, 0x4A, 0xF9, 0x77, 0x2F, 0xE7, 0x71, 0x9D, 0x19,
+    0xD7, 0x72, 0xC9, 0x1A, 0xD7, 0x75, 0xAD, 0x77, 0x49, 0xDA, 0x77, 0x5D, 0x96, 0x9D, 0xA7, 0x3A,
+    0xC7, 0x9E, 0x77, 0x59, 0xE7, 0x74, 0x9E, 0x90, 0x9F, 0xF5, 0xFF, 0x91, 0xAF, 0xEA, 0x5F, 0xDA,
+    0x59, 0xE9, 0x70, 0x9E, 0x70, 0xE7, 0x2E, 0x79, 0xE7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7E,
+    0x97, 0x19, 0xD9, 0x7E, 0x72, 0xAD, 0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72, 0xDA, 0x7A, 0xD9, 0x71,
+    0x9D, 0x97, 0xE9, 0x71, 0x9D, 0x70, 0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7, 0x9D, 0xA7, 0x2D, 0xA7,
+    0xAD, 0xA7, 0x19, 0xD9, 0x7A, 0xDA, 0x71, 0xAD, 0x70, 0xAD, 0xA7, 0x1D, 0xA7, 0x0A, 0xE7, 0x0E,
+    0x71, 0x9E, 0xA6, 0xE9, 0x72, 0xFC, 0xA9, 0x9A, 0xFA, 0x74, 0xFF, 0xE9, 0x76, 0xAF, 0xEA, 0x77,
+    0x39, 0x97, 0x71, 0x72, 0x9A, 0x97, 0x70, 0xAF, 0xC7, 0x6A, 0xDA, 0xAD, 0xA7, 0x5D, 0x2D, 0xA7,
+    0x5A, 0xA1, 0x9D, 0x97, 0x70, 0x9D, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0x97, 0x71, 0x9C, 0xA5,
+    0xAC, 0xA7, 0x29, 0x6E, 0x77, 0x19, 0xE7, 0x70, 0x9E, 0x91, 0x9A, 0xF6, 0xAF, 0x91, 0x9F, 0xD5,
+    0x9E, 0x94, 0x99, 0x9E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x5E,
+    0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x70, 0xAD, 0x94, 0x9E, 0x70, 0xE5,
+    0xEA, 0x70, 0xE4, 0xAE, 0x97, 0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA4, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D,
+    0x49, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x5F, 0xE2, 0xFC, 0x6A, 0xFA, 0x3E, 0xA7, 0x19, 0x79, 0x70,
+    0x70, 0x9D, 0xA2, 0x9A, 0x77, 0x9F, 0xC1, 0xD7, 0x7F, 0xFD, 0x77, 0xD1, 0xFC, 0x97, 0x7A, 0xA2,
+    0xAD, 0x93, 0x9D, 0xA7, 0x75, 0x9E, 0x77, 0x59, 0xE7, 0x74, 0x9E, 0x90, 0x9F, 0xF5, 0xFF, 0x91,
+    0xAF, 0xEA, 0x5F, 0xDA, 0x59, 0xE9, 0x70, 0x9E, 0x70, 0xE7, 0x2E, 0x79, 0xE7, 0x2D, 0xA7, 0xAD,
+    0xA7, 0x19, 0xD9, 0x7E, 0x97, 0x19, 0xD9, 0x7E, 0x72, 0xAD, 0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72,
+    0xDA, 0x7A, 0xD9, 0x71, 0x9D, 0x97, 0xE9, 0x71, 0x9D, 0x70, 0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7,
+    0x9D, 0xA7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7A, 0xDA, 0x71, 0xAD, 0x70, 0xAD, 0xA7, 0x1D,
+    0xA7, 0x0A, 0xE7, 0x0E, 0x71, 0x9E, 0xA6, 0xE9, 0x72, 0xFC, 0xA9, 0x9A, 0xFA, 0x74, 0xFF, 0xE9,
+    0x76, 0xAF, 0xEA, 0x77, 0x39, 0x97, 0x71, 0x70, 0x99, 0x77, 0x19, 0xEA, 0x19, 0xC9, 0x73, 0xFC,
+    0xA0, 0xD9, 0x72, 0xAD, 0x9A, 0xFC, 0x73, 0xAC, 0x91, 0xF9, 0x74, 0x93, 0x9A, 0x3A, 0xCA, 0x77,
+    0x2E, 0x77, 0x19, 0xE7, 0x70, 0x9E, 0x91, 0x9A, 0xF6, 0xAF, 0x91, 0x9F, 0xD5, 0x9E, 0x94, 0x99,
+    0x9E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97, 0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x5E, 0x70, 0xE5, 0x9D,
+    0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E, 0x70, 0xAD, 0x94, 0x9E, 0x70, 0xE5, 0xEA, 0x70, 0xE4,
+    0xAE, 0x97, 0x9D, 0xA3, 0xAC, 0xAD, 0x91, 0xA4, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x49, 0xE9, 0x9E,
+    0x09, 0xDA, 0xDA, 0x5F, 0xE2, 0xFC, 0x6A, 0xFA, 0x3E, 0xA7, 0x19, 0x79, 0x70, 0x77, 0x77, 0x76,
+    0x9D, 0xA7, 0x75, 0x9E, 0x77, 0x59, 0xE7, 0x74, 0x9E, 0x90, 0x9F, 0xF5, 0xFF, 0x91, 0xAF, 0xEA,
+    0x5F, 0xDA, 0x59, 0xE9, 0x70, 0x9E, 0x70, 0xE7, 0x2E, 0x79, 0xE7, 0x2D, 0xA7, 0xAD, 0xA7, 0x19,
+    0xD9, 0x7E, 0x97, 0x19, 0xD9, 0x7E, 0x72, 0xAD, 0x79, 0xE7, 0x2E, 0x79, 0xDA, 0x72, 0xDA, 0x7A,
+    0xD9, 0x71, 0x9D, 0x97, 0xE9, 0x71, 0x9D, 0x70, 0xE7, 0x2A, 0xD7, 0x9E, 0x72, 0xE7, 0x9D, 0xA7,
+    0x2D, 0xA7, 0xAD, 0xA7, 0x19, 0xD9, 0x7A, 0xDA, 0x71, 0xAD, 0x70, 0xAD, 0xA7, 0x1D, 0xA7, 0x0A,
+    0xE7, 0x0E, 0x71, 0x9E, 0xA6, 0xE9, 0x72, 0xFC, 0xA9, 0x9A, 0xFA, 0x74, 0xFF, 0xE9, 0x76, 0xAF,
+    0xEA, 0x77, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x77, 0x5F, 0x77, 0x4A, 0xEA, 0x77,
+    0x49, 0xE7, 0x77, 0x77, 0x30, 0x77, 0x1A, 0xCA, 0x77, 0x2E, 0x77, 0x19, 0xE7, 0x70, 0x9E, 0x91,
+    0x9A, 0xF6, 0xAF, 0x91, 0x9F, 0xD5, 0x9E, 0x94, 0x99, 0x9E, 0x59, 0xDA, 0x70, 0xE5, 0xAD, 0x97,
+    0x9D, 0xA5, 0xE7, 0x0A, 0xD9, 0x5E, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x5A, 0xD9, 0x79, 0xDA, 0x5E,
+    0x70, 0xAD, 0x94, 0x9E, 0x70, 0xE5, 0xEA, 0x70, 0xE4, 0xAE, 0x97, 0x9D, 0xA3, 0xAC, 0xAD, 0x91,
+    0xA4, 0x9D, 0xA2, 0xAD, 0x0D, 0x1D, 0x49, 0xE9, 0x9E, 0x09, 0xDA, 0xDA, 0x5F, 0xE2, 0xFC, 0x6A,
+    0xFA, 0x3E, 0xA7, 0x19, 0x79, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x71, 0xF7, 0x71, 0xF7, 0x71, 0xE7,
+    0x77, 0x73, 0x77, 0x75, 0xAC, 0x77, 0x3E, 0x97, 0x71, 0xF9, 0x77, 0x09, 0xFA, 0x77, 0x19, 0xE7,
+    0x74, 0x97, 0x77, 0x77, 0x73, 0xAF, 0xF3, 0xFF, 0x9F, 0xFA, 0x3F, 0xEA, 0x19, 0xF9, 0x69, 0xEA,
+    0x4A, 0xE7, 0x9D, 0xA6, 0xE9, 0x6E, 0x7A, 0xDA, 0x5E, 0x70, 0x9E, 0x4A, 0xD9, 0x71, 0xE9, 0x29,
+    0xDA, 0x72, 0xAD, 0xA2, 0xE7, 0x4E, 0x1A, 0xD7, 0x5E, 0x99, 0xD9, 0x75, 0x9F, 0xCA, 0x77, 0xFC,
+    0x77, 0x0A, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7,
+    0x71, 0xAD, 0xA7, 0x71, 0xEA, 0x76, 0xAF, 0xF9, 0x72, 0x9F, 0xFC, 0x97, 0x10, 0x71, 0x97, 0x71,
+    0xAC, 0x97, 0x70, 0xE7, 0x70, 0xEA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x71, 0xAC, 0xA7, 0x71, 0x97,
+    0x77, 0x77, 0x71, 0x9A, 0xE5, 0x9E, 0x4F, 0xD5, 0xEA, 0x39, 0x9A, 0xE5, 0xAD, 0xA6, 0xE9, 0x49,
+    0xDA, 0x69, 0xE4, 0x9D, 0x97, 0xE4, 0x9D, 0x70, 0xE4, 0xAD, 0x70, 0x9D, 0x93, 0xD9, 0x70, 0x9D,
+    0xA2, 0x9D, 0x72, 0xDA, 0x2D, 0xA7, 0x2D, 0xA1, 0x9D, 0x73, 0xE1, 0xDA, 0x73, 0xE0, 0x9D, 0x74,
+    0xAC, 0xA0, 0xD9, 0x74, 0xAC, 0xAA, 0xCA, 0x75, 0xFC, 0x76, 0xF7, 0x7E, 0x97, 0x69, 0xDA, 0x77,
+    0xDA, 0x76, 0x9D, 0xA7, 0x19, 0xC9, 0x09, 0xE9, 0x72, 0xAF, 0xD9, 0x73, 0xFC, 0xA7, 0x6A, 0xAA,
+    0x77, 0xAF, 0xF3, 0xFF, 0x9F, 0xFA, 0x3F, 0xEA, 0x19, 0xF9, 0x69, 0xEA, 0x4A, 0xE7, 0x9D, 0xA6,
+    0xE9, 0x6E, 0x7A, 0xDA, 0x5E, 0x70, 0x9E, 0x4A, 0xD9, 0x71, 0xE9, 0x29, 0xDA, 0x72, 0xAD, 0xA2,
+    0xE7, 0x4E, 0x1A, 0xD7, 0x5E, 0x99, 0xD9, 0x75, 0x9F, 0xCA, 0x77, 0xFC, 0x77, 0x0A, 0xE7, 0x71,
+    0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71,
+    0xEA, 0x76, 0xAF, 0xF9, 0x72, 0x9F, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x7E, 0x77, 0x1A, 0xE9,
+    0x77, 0x0F, 0x97, 0x70, 0xEA, 0x77, 0x29, 0x77, 0x00, 0x77, 0x79, 0xAE, 0x59, 0xE4, 0xFD, 0x5E,
+    0xA3, 0x99, 0xAE, 0x5A, 0xDA, 0x6E, 0x94, 0x9D, 0xA6, 0x9E, 0x49, 0xD9, 0x7E, 0x49, 0xD7, 0x0E,
+    0x4A, 0xD7, 0x09, 0xD9, 0x3D, 0x97, 0x09, 0xDA, 0x29, 0xD7, 0x2D, 0xA2, 0xDA, 0x72, 0xDA, 0x19,
+    0xD7, 0x3E, 0x1D, 0xA7, 0x3E, 0x09, 0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x4A, 0xCA, 0xAC, 0xA7, 0x5F,
+    0xC7, 0x6F, 0x77, 0xE9, 0x76, 0x9D, 0xA7, 0x7D, 0xA7, 0x69, 0xDA, 0x5E, 0x09, 0xC9, 0x09, 0xE9,
+    0x5F, 0x0A, 0xFD, 0x96, 0xF0, 0xFC, 0xA7, 0x0E, 0x91, 0xAA, 0xA7, 0x70, 0x77, 0x77, 0xAF, 0x97,
+    0x6A, 0xFD, 0x76, 0xD1, 0x9D, 0x97, 0x5C, 0xA1, 0xAD, 0x77, 0x1A, 0xD9, 0x77, 0x9D, 0xA7, 0x71,
+    0xDA, 0x77, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x4A, 0xFF, 0x3F, 0xF9, 0xFF, 0xA3, 0xFE, 0xA1, 0x9F,
+    0x96, 0x9E, 0xA4, 0xAE, 0x79, 0xDA, 0x6E, 0x96, 0xE7, 0xAD, 0xA5, 0xE7, 0x09, 0xE4, 0xAD, 0x97,
+    0x1E, 0x92, 0x9D, 0xA7, 0x2A, 0xDA, 0x2E, 0x74, 0xE1, 0xAD, 0x75, 0xE9, 0x9D, 0x97, 0x59, 0xFC,
+    0xA7, 0x7F, 0xC7, 0x70, 0xAE, 0x77, 0x1A, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x97, 0x71, 0xE7,
+    0x71, 0x9E, 0x77, 0x1A, 0xDA, 0x77, 0x1E, 0xA7, 0x6A, 0xFF, 0x97, 0x29, 0xFF, 0xC9, 0x71, 0x74,
+    0x9A, 0x97, 0x6F, 0xCA, 0x74, 0xE9, 0xE7, 0x39, 0xD1, 0x9D, 0x97, 0x3C, 0x91, 0xAD, 0x77, 0x9D,
+    0x97, 0x6A, 0xD9, 0x76, 0xE7, 0x70, 0xAC, 0x97, 0x71, 0x97, 0x77, 0x77, 0x72, 0x9A, 0xE5, 0x9E,
+    0x4F, 0xD5, 0xEA, 0x39, 0x9A, 0xE5, 0xAD, 0xA6, 0xE9, 0x49, 0xDA, 0x69, 0xE4, 0x9D, 0x97, 0xE4,
+    0x9D, 0x70, 0xE4, 0xAD, 0x70, 0x9D, 0x93, 0xD9, 0x70, 0x9D, 0xA2, 0x9D, 0x72, 0xDA, 0x2D, 0xA7,
+    0x2D, 0xA1, 0x9D, 0x73, 0xE1, 0xDA, 0x73, 0xE0, 0x9D, 0x74, 0xAC, 0xA0, 0xD9, 0x74, 0xAC, 0xAA,
+    0xCA, 0x75, 0xFC, 0x76, 0xF7, 0x7E, 0x97, 0x69, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0xA7, 0x19, 0xC9,
+    0x09, 0xE9, 0x72, 0xAF, 0xD9, 0x73, 0xFC, 0xA7, 0x6A, 0xAA, 0x77, 0x70, 0xE2, 0x9A, 0x74, 0xFC,
+    0x1D, 0x97, 0x2A, 0xFF, 0xC7, 0x3D, 0x90, 0xAF, 0xA7, 0x39, 0xA2, 0xAD, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0xAF, 0xF3, 0xFF, 0x9F, 0xFA, 0x3F, 0xEA, 0x19, 0xF9, 0x69, 0xEA, 0x4A, 0xE7, 0x9D, 0xA6,
+    0xE9, 0x6E, 0x7A, 0xDA, 0x5E, 0x70, 0x9E, 0x4A, 0xD9, 0x71, 0xE9, 0x29, 0xDA, 0x72, 0xAD, 0xA2,
+    0xE7, 0x4E, 0x1A, 0xD7, 0x5E, 0x99, 0xD9, 0x75, 0x9F, 0xCA, 0x77, 0xFC, 0x77, 0x0A, 0xE7, 0x71,
+    0xAD, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA7, 0x71,
+    0xEA, 0x76, 0xAF, 0xF9, 0x72, 0x9F, 0xFC, 0x97, 0x10, 0x72, 0x97, 0x70, 0xAE, 0x91, 0xAC, 0x71,
+    0x9F, 0xC9, 0x9D, 0x71, 0xDA, 0x9F, 0xD7, 0x1D, 0x19, 0xF7, 0x39, 0x3A, 0x97, 0x77, 0x77, 0x77,
+    0x73, 0x9A, 0xE5, 0x9E, 0x4F, 0xD5, 0xEA, 0x39, 0x9A, 0xE5, 0xAD, 0xA6, 0xE9, 0x49, 0xDA, 0x69,
+    0xE4, 0x9D, 0x97, 0xE4, 0x9D, 0x70, 0xE4, 0xAD, 0x70, 0x9D, 0x93, 0xD9, 0x70, 0x9D, 0xA2, 0x9D,
+    0x72, 0xDA, 0x2D, 0xA7, 0x2D, 0xA1, 0x9D, 0x73, 0xE1, 0xDA, 0x73, 0xE0, 0x9D, 0x74, 0xAC, 0xA0,
+    0xD9, 0x74, 0xAC, 0xAA, 0xCA, 0x75, 0xFC, 0x76, 0xF7, 0x7E, 0x97, 0x69, 0xDA, 0x77, 0xDA, 0x76,
+    0x9D, 0xA7, 0x19, 0xC9, 0x09, 0xE9, 0x72, 0xAF, 0xD9, 0x73, 0xFC, 0xA7, 0x6A, 0xAA, 0x77, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x70, 0xCA, 0x1A, 0xC1, 0x9C, 0xAA,
+    0xC9, 0x29, 0xD9, 0x3A, 0xD9, 0x2A, 0xF9, 0x1C, 0x9A, 0xA9, 0xC3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA7, 0x20, 0x49, 0xC7, 0x2A,
+    0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x99, 0x99, 0x9A, 0xCA, 0x09, 0xC5,
+    0xCA, 0x19, 0xC4, 0xCA, 0x29, 0xC3, 0xCA, 0x39, 0xC2, 0x99, 0x49, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x75, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xFD, 0x1A, 0xCA, 0x99,
+    0x99, 0x99, 0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00,
+    0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9A, 0xA3, 0x9A, 0xA0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD,
+    0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92,
+    0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0,
+    0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD,
+    0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92,
+    0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0,
+    0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0x99, 0x93, 0x99, 0x90, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0x97, 0x77, 0x71, 0xFF, 0xFF, 0xAF,
+    0xFF, 0xFA, 0x77, 0x00, 0x49, 0x39, 0xD3, 0xD9, 0x2E, 0x2A, 0xD9, 0x2E, 0x2A, 0xDA, 0x2E, 0xA2,
+    0xF2, 0xAE, 0x39, 0x93, 0x29, 0xCA, 0x2A, 0xE9, 0x19, 0xEA, 0x2E, 0x92, 0xE2, 0x9D, 0x92, 0xE2,
+    0x9D, 0x92, 0xD9, 0x29, 0xC9, 0x72, 0x19, 0xAD, 0x2A, 0xE9, 0x19, 0xE9, 0x2E, 0x29, 0xE2, 0xAD,
+    0x3D, 0xA2, 0xAD, 0x29, 0xD3, 0x9A, 0x40, 0x19, 0x92, 0xF0, 0x9E, 0xA0, 0x9E, 0x19, 0xE2, 0xE2,
+    0xAD, 0x3D, 0x92, 0xAD, 0x3D, 0x93, 0x90, 0x49, 0x49, 0x39, 0xD3, 0xAC, 0xA2, 0xD9, 0x2A, 0xD2,
+    0xE2, 0x9D, 0x91, 0xAD, 0x92, 0xE2, 0xE2, 0x9D, 0xA1, 0xAD, 0xA2, 0xE9, 0x1E, 0xA1, 0x9E, 0x91,
+    0xF1, 0x9E, 0xA1, 0xAE, 0x2E, 0xA2, 0x99, 0x49, 0x30, 0x39, 0x59, 0x39, 0xE9, 0x1F, 0x29, 0xEA,
+    0x1F, 0x3E, 0x91, 0xAE, 0x3E, 0x2A, 0xDA, 0x29, 0xDA, 0x2A, 0xD9, 0x2A, 0xD3, 0xDA, 0x3D, 0xA2,
+    0xAD, 0x3A, 0xD3, 0xD9, 0x29, 0xD3, 0xDA, 0x49, 0x49, 0x50, 0x19, 0xAD, 0x29, 0xD9, 0x2A, 0xE9,
+    0x1F, 0x29, 0xE9, 0x1F, 0x3E, 0x2A, 0xE2, 0x9E, 0x2E, 0x92, 0xAD, 0x3E, 0x3D, 0xA2, 0x9D, 0x92,
+    0xAD, 0x3D, 0xA2, 0x9D, 0x3A, 0xD3, 0x9A, 0x4A, 0xA4, 0x19, 0x94, 0x93, 0xF2, 0xE9, 0x09, 0xEA,
+    0x1A, 0xE9, 0x09, 0xE2, 0xEA, 0x19, 0xE2, 0xE9, 0x2E, 0x2A, 0xDA, 0x2A, 0xD3, 0xDA, 0x3D, 0x92,
+    0xAD, 0x3A, 0xD3, 0xDA, 0x3D, 0x92, 0x9D, 0x49, 0x59, 0x00, 0x77, 0x5E, 0x97, 0x2E, 0x73, 0xE7,
+    0x3D, 0xA7, 0x3D, 0x96, 0x92, 0x9D, 0x29, 0x91, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xCA, 0x99, 0x0D,
+    0x90, 0x9A, 0xA9, 0x6D, 0x74, 0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD9,
+    0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xDA, 0x72, 0x9A, 0xA7, 0x00, 0x77, 0x7E, 0x97, 0x3E,
+    0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x92, 0x9D, 0x29, 0x92, 0xFF, 0xFC, 0x2F, 0xFF, 0xC2, 0xCA,
+    0x99, 0x0D, 0x90, 0x9A, 0xA9, 0x7D, 0x97, 0x3A, 0xD9, 0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x73, 0x9D,
+    0x97, 0x92, 0x9D, 0x39, 0x2A, 0xEA, 0xEA, 0xF2, 0xFF, 0xFC, 0x2C, 0xAA, 0x90, 0xD9, 0x99, 0xAC,
+    0xA7, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x39, 0xE7, 0x4A, 0xA9, 0x70, 0x2A, 0xA9, 0x29,
+    0xFC, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFC, 0x92, 0xAC, 0xA9, 0x10, 0x0A, 0xA7, 0x1E, 0xA7, 0xFC,
+    0xA5, 0xFE, 0xA3, 0xFF, 0xCA, 0x1F, 0xFD, 0xA0, 0xFF, 0xD9, 0x0F, 0xF9, 0x2F, 0xD9, 0x4F, 0x96,
+    0xAC, 0x97, 0x73, 0x0A, 0xD0, 0xAF, 0xFC, 0xAE, 0x90, 0x99, 0x10, 0x77, 0xE4, 0xAD, 0x1F, 0x3A,
+    0xE9, 0x0F, 0x3F, 0x1E, 0x93, 0xEA, 0x29, 0x69, 0x20, 0x77, 0x73, 0xAD, 0x7A, 0xD7, 0xAD, 0x0A,
+    0xE9, 0x5A, 0xE9, 0x5A, 0xE9, 0xF9, 0x5F, 0x95, 0xF9, 0xEA, 0x6E, 0xA6, 0xAD, 0xA1, 0x99, 0x70,
+    0x99, 0x70, 0x99, 0x10, 0x49, 0xE9, 0xAF, 0xAF, 0x9E, 0x50, 0x49, 0xC7, 0x2A, 0xC9, 0x71, 0xAC,
+    0x97, 0x19, 0xC9, 0x1C, 0xA1, 0x9F, 0xC0, 0x9C, 0x92, 0x99, 0xAC, 0xA0, 0x9C, 0x5C, 0xA1, 0x9C,
+    0x4C, 0xA2, 0x9C, 0x3C, 0xA3, 0x9C, 0x29, 0x94, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x77,
+    0x50, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xC9, 0x19, 0xC1, 0xAC, 0xA9, 0x93,
+    0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73, 0x39, 0x96, 0x9D, 0x94, 0x9F, 0x4C, 0xAA, 0xA9, 0xC2, 0xCA,
+    0x0A, 0xA0, 0xAC, 0x0A, 0xA1, 0xAA, 0x1A, 0xA9, 0x2A, 0xA2, 0x93, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x75, 0x3A, 0xA1,
+    0xC9, 0x70, 0xD0, 0x9C, 0xA7, 0x0D, 0x1C, 0xA7, 0x0D, 0x1C, 0xA0, 0xAF, 0xFC, 0x1C, 0xAA, 0xC9,
+    0x99, 0x99, 0xAC, 0x90, 0xAC, 0x0A, 0xA3, 0x9C, 0x90, 0xAC, 0x1A, 0xA2, 0x9C, 0x90, 0xAC, 0x2A,
+    0xA1, 0x9C, 0x90, 0xAC, 0x3A, 0xA1, 0x92, 0x94, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x77,
+    0x71, 0x39, 0xC1, 0xAA, 0x6A, 0xC9, 0x0D, 0x6A, 0xC9, 0x0D, 0x6A, 0xC1, 0xD6, 0xAC, 0x1F, 0xFC,
+    0xA0, 0xCA, 0x09, 0xCA, 0x99, 0x99, 0x9C, 0xA1, 0xCA, 0x09, 0xC9, 0x3A, 0xA2, 0xCA, 0x09, 0xC9,
+    0x2A, 0xA3, 0xCA, 0x09, 0xC9, 0x1A, 0xA4, 0x92, 0x91, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x75, 0x77, 0x49, 0x97, 0x76, 0xAD, 0xA9, 0x72, 0xD9, 0x77, 0x39, 0xFD, 0xA7, 0x0E,
+    0x77, 0x39, 0xDA, 0x1A, 0xD7, 0xAD, 0x77, 0x4D, 0xA3, 0xD9, 0x59, 0xD9, 0x77, 0x3A, 0xD4, 0xDA,
+    0x5D, 0xA7, 0x74, 0xD9, 0x4D, 0xA4, 0xAD, 0x77, 0x49, 0xD5, 0xDA, 0x39, 0xD7, 0x75, 0xAD, 0x5D,
+    0x93, 0xD9, 0x77, 0x5A, 0xD4, 0x9D, 0x3D, 0xA7, 0x76, 0xAD, 0x4D, 0xA2, 0xAD, 0x49, 0x99, 0x71,
+    0x99, 0x92, 0xAD, 0x39, 0xD2, 0x9D, 0x3A, 0xFC, 0x6A, 0xFC, 0x19, 0xDA, 0x19, 0xD9, 0x2D, 0x92,
+    0xEA, 0xAE, 0x4E, 0xAA, 0xE1, 0xAF, 0xD9, 0x2A, 0xCA, 0x2E, 0x29, 0xD9, 0x2A, 0xD2, 0x9D, 0x91,
+    0xAE, 0xA3, 0x9D, 0x29, 0xD4, 0xDA, 0x19, 0xD4, 0xDA, 0x72, 0xD9, 0x2D, 0xA4, 0xDA, 0x1D, 0xA4,
+    0xDA, 0x71, 0xDA, 0x3D, 0x94, 0xDA, 0x1D, 0x94, 0xDA, 0x70, 0xAD, 0x39, 0xD5, 0xD9, 0x09, 0xD5,
+    0xDA, 0x79, 0xD4, 0xAD, 0x5D, 0x90, 0xAD, 0x5D, 0x97, 0xD9, 0x4A, 0xD4, 0xAD, 0x1A, 0xD4, 0xAD,
+    0x7E, 0x5A, 0xD4, 0xD9, 0x1A, 0xD4, 0xD9, 0x6A, 0xD6, 0x9D, 0x3E, 0x29, 0xD9, 0x2E, 0x69, 0xD9,
+    0x7E, 0xAA, 0xE4, 0xEA, 0xAE, 0x7D, 0xA7, 0x09, 0xFC, 0xA5, 0x9F, 0xCA, 0x79, 0xD7, 0x39, 0x99,
+    0x71, 0x99, 0x97, 0x77, 0x77, 0x60, 0x3A, 0x93, 0xAD, 0x92, 0xE9, 0x19, 0xE2, 0xEA, 0x19, 0xE2,
+    0xE9, 0x2D, 0xA2, 0xAD, 0x39, 0xC7, 0x30, 0x3A, 0x93, 0xAA, 0x3A, 0xD9, 0x2D, 0xA2, 0xE9, 0x1A,
+    0xE1, 0x9E, 0x2E, 0xA1, 0xEA, 0x19, 0xE1, 0x9E, 0x2E, 0x91, 0xE9, 0x19, 0xE2, 0xDA, 0x2E, 0x2A,
+    0xD3, 0xD9, 0x29, 0xC4, 0xCA, 0x77, 0x00, 0x3A, 0x93, 0xAA, 0x39, 0xA4, 0xAD, 0x92, 0xDA, 0x2A,
+    0xD3, 0xE9, 0x1A, 0xE2, 0xE9, 0x19, 0xE2, 0xEA, 0x1A, 0xE2, 0xEA, 0x19, 0xE2, 0xE9, 0x19, 0xE2,
+    0xE9, 0x19, 0xE2, 0xE9, 0x19, 0xE2, 0xE9, 0x2D, 0xA2, 0xE2, 0x9D, 0xA2, 0xAD, 0x3D, 0x92, 0xAD,
+    0x39, 0xC4, 0xCA, 0x39, 0xC7, 0x77, 0x00, 0x09, 0xA3, 0xAD, 0x3E, 0xA2, 0x9E, 0x3E, 0xA2, 0x9E,
+    0x3E, 0x93, 0xE3, 0x9D, 0x4A, 0xC7, 0x09, 0xA4, 0x9A, 0x3A, 0xD3, 0x9D, 0x92, 0xEA, 0x2A, 0xE2,
+    0x9E, 0x29, 0xE9, 0x2E, 0xA2, 0xEA, 0x29, 0xE3, 0xE3, 0xE9, 0x2A, 0xDA, 0x3E, 0x3E, 0x39, 0xD4,
+    0xD9, 0x3A, 0xC4, 0x9C, 0x76, 0x09, 0xA4, 0x9A, 0x49, 0xA3, 0xAD, 0x39, 0xD9, 0x29, 0xDA, 0x2E,
+    0xA2, 0xAE, 0x29, 0xE2, 0x9E, 0x29, 0xE9, 0x2E, 0x92, 0xEA, 0x2E, 0xA2, 0xAE, 0x29, 0xE3, 0xE3,
+    0xE9, 0x2E, 0x92, 0xAD, 0xA2, 0x9E, 0x3E, 0x3E, 0x3A, 0xD3, 0x9D, 0x4D, 0x93, 0xDA, 0x3A, 0xC4,
+    0x9C, 0x5C, 0x97, 0x74, 0x59, 0xA7, 0x29, 0xDA, 0x70, 0x9F, 0xA6, 0x9D, 0xA0, 0xDA, 0x49, 0xDA,
+    0x2D, 0xA2, 0x9D, 0xA4, 0xDA, 0x1A, 0xCA, 0x6D, 0x90, 0x69, 0x59, 0xD9, 0x3A, 0xDA, 0x3E, 0xA3,
+    0xEA, 0x3E, 0xA3, 0xAE, 0x4A, 0xE5, 0xE9, 0x5E, 0x6D, 0xA6, 0xD9, 0x69, 0x20, 0x29, 0x70, 0xD9,
+    0x69, 0xD9, 0x6A, 0xD9, 0x6E, 0x95, 0xAE, 0x59, 0xE5, 0xEA, 0x4E, 0x94, 0xE9, 0x4E, 0x5D, 0xA6,
+    0x99, 0x60, 0x77, 0x49, 0xC7, 0x7A, 0xC1, 0xD6, 0x95, 0xAC, 0xA2, 0xD4, 0xDA, 0x3A, 0xCA, 0x4D,
+    0x29, 0xE2, 0x9C, 0xA5, 0x9D, 0x2A, 0xC9, 0x19, 0xD7, 0x9D, 0x59, 0xD7, 0x19, 0xCA, 0x4D, 0x73,
+    0x9C, 0xA2, 0xD7, 0x19, 0x2A, 0xCA, 0x0D, 0x71, 0xE2, 0xAE, 0x29, 0xD9, 0x3E, 0x3D, 0xA2, 0xAD,
+    0xA3, 0xAC, 0xA2, 0xF9, 0x2D, 0x71, 0xAC, 0x90, 0xD9, 0x74, 0xAC, 0x92, 0xD7, 0x3A, 0xCA, 0x4D,
+    0x71, 0xAC, 0xA6, 0xD7, 0x9C, 0xA2, 0xD9, 0x2D, 0x59, 0xCA, 0x29, 0xE2, 0x9D, 0x39, 0xD4, 0xDA,
+    0x39, 0xD2, 0xD7, 0x59, 0xCA, 0x09, 0xC7, 0x79, 0xC7, 0x75, 0x69, 0x96, 0x99, 0x6E, 0x5E, 0x5E,
+    0xA4, 0xEA, 0x5E, 0x5E, 0x94, 0x9E, 0x49, 0xE5, 0xAD, 0xA4, 0xAD, 0xA5, 0xE5, 0xE9, 0x5E, 0x5E,
+    0x6D, 0xA5, 0xDA, 0x59, 0xD9, 0x49, 0xD9, 0x5A, 0xD5, 0xAD, 0x6A, 0xD5, 0xAD, 0x6D, 0xA5, 0xDA,
+    0x6D, 0x95, 0xD9, 0x6D, 0x6D, 0x69, 0xD5, 0x9D, 0x69, 0xCA, 0x59, 0xCA, 0x69, 0xC9, 0x59, 0xCA,
+    0x6A, 0xA6, 0x9A, 0x77, 0x77, 0x75, 0x9A, 0x95, 0x9A, 0x95, 0xAE, 0x4A, 0xE5, 0xF4, 0xF5, 0xE9,
+    0x4E, 0x96, 0x97, 0x96, 0xFF, 0xFF, 0x9F, 0xFF, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x00, 0x9F, 0xCA, 0x9A, 0xFD, 0xA9, 0xFD, 0x90, 0x77, 0x0A, 0x97, 0x70, 0x9D, 0x97, 0x7E,
+    0x77, 0xAD, 0x77, 0x9D, 0x97, 0x7D, 0xA7, 0x7E, 0x77, 0xAD, 0x77, 0x9D, 0x97, 0x7D, 0xA7, 0x7A,
+    0xD7, 0x79, 0xD7, 0x70, 0xD9, 0x77, 0xDA, 0x77, 0xAD, 0x77, 0x9D, 0x77, 0x0D, 0x97, 0x7E, 0x77,
+    0xAD, 0x77, 0x9D, 0x97, 0x7D, 0xA7, 0x7E, 0x77, 0xAD, 0x97, 0x69, 0xDA, 0x77, 0x9D, 0x77, 0x77,
+    0x40, 0x39, 0xAA, 0x97, 0x09, 0xAA, 0x95, 0x9F, 0xD5, 0x9F, 0xD9, 0x3F, 0xF4, 0xFF, 0x3E, 0xAA,
+    0xEA, 0x3E, 0xAA, 0xF2, 0xA4, 0xE3, 0xA9, 0x3E, 0x70, 0xAD, 0x71, 0x9D, 0x70, 0xAD, 0x71, 0x9D,
+    0x70, 0xDA, 0x71, 0xDA, 0x7E, 0x71, 0xAD, 0x7A, 0xD9, 0x70, 0xAD, 0x96, 0xE9, 0x70, 0xAD, 0x96,
+    0xE9, 0x70, 0xE9, 0x6E, 0x71, 0xE9, 0x6E, 0x71, 0xAD, 0x96, 0x9D, 0x72, 0xD9, 0x79, 0xDA, 0xAA,
+    0x69, 0xEA, 0xA5, 0x9F, 0xA7, 0xFC, 0x6A, 0xDA, 0x70, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x1A, 0xA9,
+    0x71, 0x9A, 0x97, 0xAE, 0x70, 0xAE, 0x7E, 0xA7, 0x0F, 0x7E, 0x97, 0x0E, 0x97, 0x99, 0x73, 0x97,
+    0x00, 0x77, 0x29, 0x94, 0x9A, 0xA9, 0x71, 0xE2, 0x9F, 0xD7, 0xAD, 0xA2, 0xFF, 0x6E, 0x92, 0xEA,
+    0xAE, 0xA4, 0x9E, 0x3A, 0x4E, 0x4A, 0xDA, 0x71, 0xAD, 0x4E, 0x97, 0x1A, 0xD4, 0xE7, 0x2D, 0xA4,
+    0xDA, 0x71, 0xE4, 0x9D, 0x97, 0x0A, 0xD9, 0x4A, 0xD7, 0x0E, 0x95, 0xAD, 0x7E, 0x96, 0xDA, 0x6E,
+    0x70, 0xD9, 0x5E, 0x71, 0xD5, 0x9D, 0x72, 0xD5, 0x9D, 0xAA, 0xA6, 0x9C, 0xA5, 0x9F, 0xA6, 0x9C,
+    0xA6, 0xAD, 0xA7, 0x9A, 0x77, 0x77, 0x77, 0x3A, 0xA9, 0x70, 0x9A, 0x95, 0xAE, 0x7A, 0xE5, 0xEA,
+    0x7F, 0x5E, 0x97, 0xE9, 0x59, 0x97, 0x29, 0x60, 0x69, 0x97, 0x73, 0xE5, 0x9A, 0xA9, 0x70, 0xEA,
+    0x39, 0xFD, 0x7E, 0x4F, 0xF5, 0x9E, 0x4E, 0xAA, 0xEA, 0x4A, 0xDA, 0x4A, 0x4E, 0x4E, 0x73, 0xAD,
+    0x4E, 0x73, 0xAD, 0x4D, 0xA7, 0x3D, 0xA3, 0x9D, 0x97, 0x2E, 0x4A, 0xD7, 0x2A, 0xD9, 0x4A, 0xD7,
+    0x1E, 0x95, 0xDA, 0x70, 0xE9, 0x6D, 0x97, 0xE7, 0x0D, 0x7E, 0x70, 0x9D, 0x69, 0xD7, 0x19, 0xCA,
+    0x69, 0xDA, 0xAA, 0x69, 0xC9, 0x69, 0xFA, 0x6A, 0xA7, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x59, 0xA9,
+    0x7A, 0xA9, 0x7A, 0xE6, 0xAE, 0x7F, 0x6E, 0xA7, 0xE9, 0x6E, 0x97, 0x09, 0x70, 0x99, 0x70, 0x77,
+    0x59, 0xAD, 0xA9, 0x69, 0xA2, 0xFF, 0x93, 0x9D, 0x1A, 0xDA, 0x99, 0xFC, 0xAA, 0xEA, 0x1D, 0x49,
+    0xAF, 0xDA, 0x29, 0x97, 0x9A, 0xAA, 0x30, 0x3A, 0x93, 0xAA, 0x39, 0xA4, 0xA9, 0x3A, 0xD9, 0x2D,
+    0xA2, 0xAD, 0x29, 0xDA, 0x2E, 0x91, 0xAE, 0x2E, 0x91, 0xAD, 0xA1, 0x9E, 0x2E, 0xA1, 0xAE, 0x2E,
+    0x91, 0xEA, 0x19, 0xE2, 0xE9, 0x1A, 0xE1, 0x9E, 0x2E, 0x91, 0x9E, 0x2E, 0x91, 0xE9, 0x19, 0xE2,
+    0xE9, 0x19, 0xDA, 0x2D, 0xA2, 0xE2, 0x9D, 0xA2, 0xE2, 0xAD, 0x3D, 0x92, 0xAD, 0x29, 0xD9, 0x29,
+    0xC4, 0xCA, 0x39, 0xC4, 0xCA, 0x77, 0x75, 0x77, 0x1A, 0xF9, 0x5F, 0xE9, 0x3E, 0x90, 0x9E, 0x2A,
+    0xD3, 0xAD, 0x2D, 0x93, 0x9D, 0x1A, 0xD4, 0x9D, 0x1D, 0xA4, 0xAD, 0x1D, 0x94, 0xAD, 0x09, 0xD5,
+    0xDA, 0x09, 0xD4, 0x9D, 0x90, 0xAD, 0x4E, 0x19, 0xD9, 0x29, 0xD9, 0x2E, 0x90, 0xAD, 0xA3, 0xAF,
+    0xDA, 0x5A, 0xF9, 0x77, 0x10, 0x77, 0x7D, 0xA7, 0x1E, 0xA7, 0x0F, 0x97, 0xDA, 0xD7, 0xD9, 0x9D,
+    0x6D, 0x90, 0xAC, 0xA5, 0xDA, 0x1D, 0x94, 0xDA, 0x2D, 0x93, 0xDA, 0x29, 0xD3, 0xEA, 0xAA, 0xAE,
+    0xAA, 0x1F, 0xFF, 0x29, 0x99, 0x99, 0x9D, 0xA9, 0x71, 0xD7, 0x29, 0xD7, 0x29, 0xAA, 0x30, 0x4F,
+    0xE9, 0x39, 0xFE, 0x4A, 0xDA, 0xAA, 0xAA, 0x4D, 0x97, 0x09, 0xD7, 0x1A, 0xF9, 0x6A, 0xAF, 0xA7,
+    0x1E, 0x97, 0x1D, 0xA7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xE6, 0x9A, 0xE3, 0x9F, 0xDA, 0x5F, 0xA9,
+    0x77, 0x20, 0x77, 0x3A, 0xF5, 0xAF, 0xAA, 0x4E, 0xA7, 0xE9, 0x7E, 0x70, 0x9D, 0x9A, 0xA9, 0x5F,
+    0xF3, 0x9D, 0x99, 0x99, 0xE2, 0xAD, 0x39, 0xD9, 0x1A, 0xCA, 0x4D, 0x91, 0xDA, 0x4D, 0x91, 0xAD,
+    0x3A, 0xD2, 0x9D, 0xA1, 0xAD, 0x93, 0xAF, 0xDA, 0x5A, 0xEA, 0x97, 0x71, 0x09, 0xFF, 0xA1, 0xFF,
+    0xD1, 0xD9, 0x99, 0x99, 0xDA, 0x09, 0xCA, 0x3A, 0xD2, 0xC3, 0x9D, 0x70, 0xD9, 0x7D, 0xA7, 0xAD,
+    0x79, 0xD7, 0x0D, 0xA7, 0xAD, 0x70, 0xDA, 0x7A, 0xD7, 0x0D, 0xA7, 0x0A, 0xC7, 0x74, 0x77, 0x19,
+    0xFA, 0x5E, 0xAE, 0xA3, 0xDA, 0x2A, 0xD3, 0xD3, 0xAD, 0x3D, 0x92, 0xDA, 0x3E, 0x1E, 0x5F, 0xCA,
+    0x59, 0xFC, 0x5A, 0xCA, 0x1E, 0x3A, 0xD3, 0xDA, 0x2D, 0x93, 0xE2, 0xD9, 0x3D, 0xA2, 0xDA, 0x2A,
+    0xD3, 0xAF, 0xE9, 0x49, 0xFA, 0x77, 0x10, 0x77, 0x19, 0xFC, 0x5A, 0xFE, 0x39, 0xDA, 0x19, 0xDA,
+    0x2D, 0xA3, 0xAD, 0x2D, 0x93, 0x9D, 0x2D, 0x93, 0xAD, 0x2D, 0xA3, 0xAD, 0x2A, 0xDA, 0x99, 0xAD,
+    0xA3, 0xAF, 0xE6, 0x99, 0x9D, 0xA7, 0x0E, 0x79, 0xE6, 0x9A, 0xE4, 0xAA, 0xFA, 0x5A, 0xEA, 0x77,
+    0x30, 0x09, 0xAD, 0x2E, 0x2A, 0xE9, 0x9F, 0x93, 0xD9, 0xCA, 0x9D, 0x93, 0xE9, 0x1D, 0x92, 0x9D,
+    0xA1, 0x9D, 0x3A, 0xD2, 0xAD, 0x3D, 0xA2, 0xD9, 0x3D, 0x3D, 0x39, 0xD2, 0x9D, 0x0C, 0x90, 0xAC,
+    0xA2, 0x9F, 0x1D, 0x92, 0x9D, 0xA7, 0x60, 0x59, 0xAA, 0x96, 0x9F, 0xD4, 0x9E, 0xAE, 0xA2, 0x9D,
+    0xA2, 0xE2, 0xE3, 0xAD, 0x19, 0xD9, 0x39, 0xD1, 0xE4, 0x9D, 0x1D, 0xA4, 0xAD, 0x09, 0xD9, 0x4E,
+    0x09, 0xD5, 0xDA, 0x0A, 0xD4, 0x9D, 0x1A, 0xD4, 0xDA, 0x19, 0xDA, 0x2A, 0xD3, 0xEA, 0xAE, 0x93,
+    0x9F, 0xD9, 0x6A, 0xAA, 0x95, 0x69, 0x94, 0x9A, 0xE2, 0x9F, 0xCA, 0x39, 0xAA, 0xD9, 0x59, 0xD6,
+    0xAD, 0x6E, 0x6D, 0xA5, 0x9D, 0x95, 0xAD, 0x6A, 0xD6, 0xDA, 0x6D, 0x94, 0xAF, 0xA2, 0xFE, 0x91,
+    0x99, 0x99, 0x99, 0x91, 0x59, 0xA9, 0x96, 0xAF, 0xD4, 0xFA, 0xEA, 0x29, 0xD9, 0x2E, 0x2A, 0xC9,
+    0x3A, 0xD3, 0x94, 0xDA, 0x70, 0xAD, 0x70, 0xAD, 0x97, 0xAD, 0x97, 0xE9, 0x7E, 0x79, 0xDA, 0x7A,
+    0xD9, 0x7A, 0xFF, 0xD1, 0xAF, 0xFC, 0xA2, 0x99, 0x99, 0x99, 0x99, 0x30, 0x59, 0xA9, 0x6A, 0xFC,
+    0x93, 0xAD, 0xAA, 0xE3, 0xD2, 0x9D, 0x3A, 0x39, 0xD7, 0x0D, 0xA6, 0x9D, 0xA5, 0xAF, 0x59, 0xFD,
+    0x70, 0xAD, 0x97, 0x9D, 0x97, 0xAD, 0x79, 0xDA, 0x29, 0x99, 0xAF, 0x29, 0xFD, 0xA4, 0xAA, 0xAA,
+    0x95, 0x72, 0x97, 0x2A, 0xDA, 0x70, 0xAE, 0x97, 0x9F, 0x79, 0xD9, 0xD6, 0x9D, 0x0A, 0xD5, 0x9D,
+    0x1D, 0xA4, 0x9D, 0x2D, 0x93, 0x9D, 0x3D, 0x39, 0xD9, 0x29, 0xD3, 0xFF, 0xF1, 0xAF, 0xFD, 0xA7,
+    0x0D, 0x97, 0x2D, 0x72, 0x9D, 0x73, 0x94, 0x77, 0x09, 0xFE, 0x93, 0xAF, 0xE4, 0xDA, 0x71, 0xD7,
+    0x19, 0xD9, 0x70, 0xAF, 0xA7, 0x99, 0xF7, 0x1A, 0xD9, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x70,
+    0xAD, 0xA3, 0x99, 0xAA, 0xEA, 0x39, 0xFD, 0x95, 0x9A, 0xA9, 0x70, 0x79, 0x9A, 0x7A, 0xFC, 0x49,
+    0xF9, 0x5A, 0xE7, 0x9D, 0xA7, 0x0D, 0x97, 0x0A, 0xFD, 0x94, 0xFF, 0xA2, 0x9D, 0x3A, 0xD2, 0xAD,
+    0x4D, 0x91, 0xDA, 0x4D, 0x91, 0xAD, 0x39, 0xD2, 0xAD, 0x3E, 0x3E, 0x9A, 0xE4, 0x9F, 0xD7, 0x9A,
+    0xA9, 0x50, 0x74, 0xAF, 0xFC, 0x1F, 0xFD, 0x1D, 0x4D, 0x90, 0x9C, 0x93, 0xDA, 0x29, 0x3A, 0xCA,
+    0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7A, 0xD7, 0x9D, 0x97, 0xE7, 0x9D, 0x97, 0xE7, 0x0D, 0x97, 0x09,
+    0xA7, 0x00, 0x59, 0xAA, 0x96, 0x9F, 0xD4, 0x9D, 0xA9, 0x9E, 0x3D, 0x92, 0xAD, 0x3D, 0x3A, 0xD3,
+    0xD9, 0x19, 0xD9, 0x3A, 0xDA, 0x9D, 0x95, 0xFC, 0x6D, 0xAE, 0xA4, 0xD9, 0x1A, 0xD9, 0x2D, 0xA3,
+    0xE2, 0xD4, 0xE2, 0xD9, 0x3D, 0xA2, 0xE9, 0x09, 0xE3, 0x9F, 0xDA, 0x69, 0xAA, 0x95, 0x69, 0xA9,
+    0x7A, 0xFC, 0xA4, 0xEA, 0xAE, 0x92, 0xAD, 0x3D, 0xA2, 0xDA, 0x3A, 0xD2, 0xD9, 0x39, 0xD2, 0xD9,
+    0x3A, 0xD2, 0xE3, 0xDA, 0x29, 0xFF, 0x93, 0x9F, 0xE7, 0x09, 0xD9, 0x79, 0xDA, 0x7A, 0xDA, 0x59,
+    0xAE, 0xA4, 0xFD, 0x7A, 0xA9, 0x70, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFF,
+    0xE5, 0x9A, 0xFF, 0xFC, 0x79, 0xE5, 0xDA, 0x7A, 0xDA, 0x5D, 0x97, 0xAD, 0x95, 0xD7, 0x0E, 0x69,
+    0x71, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xFF, 0xE7, 0x1F, 0xFD, 0x97, 0x1E, 0x77,
+    0x09, 0xDA, 0x77, 0x0A, 0xD9, 0x76, 0x90, 0xE9, 0x99, 0x97, 0x2F, 0xFD, 0x72, 0x9A, 0xAE, 0xAA,
+    0xA9, 0x74, 0xAD, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE9, 0x75, 0xAF, 0xF9, 0x71, 0x9F, 0xFC, 0x97,
+    0x10, 0x74, 0x9A, 0xEA, 0x75, 0xAF, 0xE7, 0x3E, 0xAA, 0xAE, 0xA7, 0x1E, 0x39, 0xE7, 0x0A, 0xD9,
+    0x4E, 0x70, 0xE5, 0xD9, 0x7A, 0xD9, 0x59, 0x71, 0xE7, 0x71, 0xE7, 0x69, 0x0A, 0xDA, 0x39, 0x97,
+    0xAF, 0xFF, 0x7A, 0xFF, 0xEA, 0x71, 0x9E, 0x75, 0x9A, 0x9A, 0xE9, 0x99, 0x9A, 0xA7, 0xFF, 0xFC,
+    0x7A, 0xAA, 0xEA, 0xAA, 0xAA, 0xA9, 0x71, 0x9D, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x70, 0x9D,
+    0x97, 0x09, 0x3F, 0xDA, 0xAA, 0xAA, 0xAF, 0xC9, 0x2F, 0xFF, 0xFC, 0x3F, 0x99, 0x9A, 0xAF, 0xE9,
+    0x3A, 0xA9, 0x77, 0x00, 0x59, 0xAA, 0xAF, 0xA9, 0x77, 0x73, 0x9F, 0xFF, 0xA7, 0x77, 0x1F, 0xDA,
+    0x99, 0x9F, 0xA7, 0x77, 0x3A, 0xD9, 0x39, 0xE7, 0x77, 0x3E, 0x5E, 0xA7, 0x77, 0x2E, 0x5A, 0xDA,
+    0x77, 0x71, 0x9D, 0xA5, 0xAD, 0xA3, 0xD7, 0x73, 0xAD, 0xA5, 0xAD, 0x92, 0xAD, 0x77, 0x3E, 0x95,
+    0xE3, 0xDA, 0x77, 0x3E, 0x5A, 0xDA, 0x19, 0xAE, 0xAA, 0xA4, 0xAF, 0x6E, 0x4A, 0xE1, 0xFF, 0xC9,
+    0x19, 0xFD, 0xA4, 0x9D, 0xA2, 0xAF, 0x2A, 0xAE, 0xAA, 0xA9, 0x2D, 0x91, 0x9C, 0x94, 0xAF, 0xFC,
+    0xA5, 0xE5, 0x9D, 0x72, 0xFE, 0xA9, 0x7D, 0xA5, 0xAD, 0x97, 0x1E, 0x75, 0xD9, 0x6E, 0x97, 0x9E,
+    0x74, 0x9D, 0x79, 0xEA, 0x6A, 0xDA, 0x74, 0xAD, 0x70, 0x9F, 0x5A, 0xD9, 0x74, 0xE7, 0x2E, 0x94,
+    0xE7, 0x5D, 0xA2, 0x97, 0xDA, 0x4E, 0x75, 0xD9, 0x19, 0xC9, 0x0C, 0x93, 0xDA, 0x3A, 0xE7, 0x49,
+    0xDA, 0x9A, 0xD0, 0xAD, 0x92, 0xD2, 0xAF, 0xF7, 0x2F, 0xD9, 0x09, 0xFE, 0x91, 0xAF, 0xFC, 0x72,
+    0xAE, 0xA3, 0x9F, 0xA7, 0x77, 0x77, 0x30, 0x74, 0x9A, 0xEA, 0xA9, 0x74, 0xAF, 0xFD, 0x71, 0x9F,
+    0xDA, 0xAF, 0x70, 0x9E, 0xA9, 0x4E, 0x79, 0xE9, 0x6D, 0x97, 0xE7, 0x0D, 0x7E, 0x97, 0x0A, 0x79,
+    0xDA, 0x77, 0x2A, 0xD9, 0x77, 0x9F, 0xFF, 0xC7, 0x0A, 0xFF, 0xFC, 0x72, 0xAD, 0x97, 0x70, 0x99,
+    0xEA, 0x99, 0x99, 0x9A, 0xA7, 0x0A, 0xFF, 0xFC, 0x70, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0x97, 0x3E,
+    0x97, 0x72, 0xAD, 0xA7, 0x72, 0x9E, 0x77, 0x3E, 0xA7, 0x72, 0xAE, 0xA7, 0xAC, 0x70, 0xFC, 0xA9,
+    0x99, 0xAF, 0x71, 0xFF, 0xF7, 0x39, 0xFF, 0x97, 0x70, 0x99, 0x70, 0x49, 0x77, 0x09, 0xD7, 0x69,
+    0xD9, 0x75, 0x9D, 0x97, 0x59, 0xD9, 0x75, 0x9D, 0xA9, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xE9, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x09, 0xD9, 0x77, 0xAD, 0x97, 0x7A,
+    0xD9, 0x77, 0xAD, 0x77, 0x0A, 0x97, 0x30, 0x49, 0xC9, 0x70, 0x9E, 0x96, 0x9F, 0xC9, 0x49, 0xFE,
+    0x92, 0x9D, 0x9A, 0xC9, 0x9D, 0x90, 0xAD, 0x90, 0xAC, 0x90, 0x9D, 0x99, 0xC9, 0x1A, 0xCA, 0x19,
+    0xC9, 0x4A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1D,
+    0xA7, 0x1A, 0xCA, 0x40, 0x74, 0x97, 0x70, 0xD9, 0x77, 0x9D, 0x97, 0x79, 0xD9, 0x77, 0x9D, 0x90,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0xD9, 0xFF, 0xFF, 0xEA, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xD9, 0x75, 0x9D, 0x97, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x6D, 0xA7, 0x79, 0xA4, 0x4A,
+    0xCA, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xCA, 0x5C, 0x91, 0xAC, 0xA1, 0x9C, 0x0A, 0xD9, 0x0A, 0xC9, 0x09, 0xDA, 0x0A, 0xD0, 0xAC, 0x99,
+    0xDA, 0x2A, 0xDA, 0xCA, 0xDA, 0x4A, 0xFC, 0xA6, 0xAE, 0x97, 0x09, 0xC9, 0x40, 0x5A, 0x6A, 0x72,
+    0xDA, 0x4A, 0xCA, 0x70, 0xAD, 0x6D, 0xA6, 0xAD, 0x70, 0xDA, 0x4A, 0xD7, 0x2D, 0xA2, 0xAD, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA1, 0xFF, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xDA, 0x2E, 0x72, 0xE4, 0xE7, 0x0E, 0x6E, 0x6E, 0x70, 0xDA, 0x4A, 0xD7, 0x2A, 0x6A, 0x50,
+    0x77, 0x1A, 0xCA, 0x70, 0xAE, 0xA6, 0xAF, 0xCA, 0x4A, 0xDA, 0xCA, 0xDA, 0x2E, 0x0A, 0xCA, 0x0E,
+    0x0A, 0xD1, 0xAC, 0xA1, 0xDA, 0x0C, 0x2A, 0xCA, 0x2C, 0x5A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA,
+    0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x5A, 0x2A, 0xCA, 0x2A, 0x0A, 0xD1,
+    0xAC, 0xA1, 0xDA, 0x0E, 0x0A, 0xCA, 0x0E, 0x2E, 0xAC, 0xAE, 0x4F, 0xE6, 0xFC, 0x70, 0xE7, 0x29,
+    0x50, 0x59, 0xC9, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xAD, 0xAC, 0xAD, 0xA4, 0xAD, 0x9A, 0xCA,
+    0x9D, 0xA2, 0xAD, 0x90, 0xAC, 0xA0, 0x9D, 0xA2, 0xC9, 0x1A, 0xCA, 0x19, 0xC7, 0xAC, 0xA7, 0x3A,
+    0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0xC9, 0x1A, 0xCA, 0x19, 0xC2, 0xAD, 0x90,
+    0xAC, 0xA0, 0x9D, 0xA2, 0xAD, 0x9A, 0xCA, 0x9D, 0xA4, 0xAF, 0xEA, 0x69, 0xFC, 0x97, 0x09, 0xE9,
+    0x72, 0xAC, 0xA5, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x76, 0x71, 0xAC, 0xA7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1A, 0xCA, 0x4A, 0x3A, 0xCA, 0x3A, 0xD2, 0xAC, 0xA2, 0xAD,
+    0x92, 0xAC, 0xA1, 0xAD, 0x93, 0xAC, 0xA0, 0x9D, 0x94, 0xAC, 0xA9, 0xDA, 0x99, 0x99, 0x99, 0xDA,
+    0xFF, 0xFA, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71,
+    0xAD, 0x72, 0xA6, 0xAC, 0xA7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA3, 0xA4, 0xAC, 0xA2, 0xDA, 0x3A, 0xCA, 0x29, 0xDA, 0x2A, 0xCA, 0x39, 0xD9, 0x1A,
+    0xCA, 0x49, 0xD9, 0x0A, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0xAF, 0xFF, 0x9A, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x97, 0x9D, 0x97, 0x9D, 0xA7, 0x9D, 0xA7, 0x0D, 0xA7, 0x2A, 0x40, 0x76, 0xAD, 0x77, 0xAD, 0x6A,
+    0x7A, 0xD5, 0xAD, 0x6A, 0xD4, 0xAD, 0x96, 0xAD, 0x3A, 0xD9, 0x7A, 0xD2, 0xAD, 0x71, 0xAD, 0x19,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0x1F, 0xFF, 0xFC, 0x1A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x92, 0xAD, 0x77, 0x0A, 0xD7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xA7, 0x30, 0x77, 0x79,
+    0xC9, 0x76, 0x9D, 0x97, 0x59, 0xD9, 0x75, 0x9E, 0xAA, 0xFF, 0xE0, 0x9F, 0xFF, 0xFC, 0x9D, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x77, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xF2, 0xAD, 0x77, 0x0A, 0xD9, 0x77, 0xAC, 0xA7,
+    0x70, 0x97, 0x30, 0x59, 0xC9, 0x72, 0x9E, 0x97, 0x09, 0xDA, 0xD9, 0x69, 0xD9, 0x09, 0xD9, 0x49,
+    0xE9, 0x09, 0xE9, 0x29, 0xF9, 0x09, 0xF9, 0x09, 0xD9, 0xD9, 0x09, 0xD9, 0xD9, 0x0A, 0x90, 0xD9,
+    0x09, 0xD0, 0x9A, 0x4D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D,
+    0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90,
+    0x9D, 0x7D, 0x90, 0x9D, 0x30, 0x77, 0x75, 0x9C, 0x97, 0x79, 0xD9, 0x77, 0x9D, 0x92, 0xFF, 0xEA,
+    0xAE, 0x91, 0xFF, 0xFF, 0xC9, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x97, 0x79,
+    0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x9F, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xA7,
+    0x6D, 0xA7, 0x59, 0xDA, 0x76, 0xAC, 0xA7, 0x70, 0x95, 0x3D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D,
+    0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90,
+    0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x49, 0x90, 0xD9, 0x09, 0xD0, 0x99,
+    0x09, 0xD0, 0xD9, 0x09, 0xD0, 0xD9, 0x0A, 0xF9, 0x09, 0xFA, 0x2A, 0xE9, 0x09, 0xEA, 0x4A, 0xD9,
+    0x09, 0xDA, 0x6A, 0xD9, 0xDA, 0x70, 0x9E, 0x97, 0x29, 0xC9, 0x50, 0x77, 0x72, 0xD4, 0xD7, 0x2E,
+    0x4E, 0x70, 0xDA, 0x6A, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xFF, 0xFF, 0xC2, 0xAD, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA0, 0x9D, 0x76, 0xD9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xAD, 0x2F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE6, 0xDA, 0x6A, 0xD7, 0x0D, 0xA4, 0xAD, 0x72,
+    0xD4, 0xD7, 0x77, 0x20, 0x0E, 0xA7, 0x5E, 0x1A, 0xE7, 0x4A, 0xDA, 0x19, 0xE9, 0x73, 0xE3, 0xF7,
+    0x29, 0xE3, 0xAE, 0x72, 0xAD, 0x94, 0xEA, 0x71, 0xE5, 0xAE, 0x70, 0x9D, 0xA5, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x7F, 0xFF, 0xDA, 0x7A, 0xFA, 0xAA, 0xAA, 0xAE, 0x97, 0x0E, 0x95, 0xE7, 0x1F,
+    0x49, 0xD9, 0x71, 0x9E, 0x4E, 0x73, 0xEA, 0x3D, 0xA7, 0x3A, 0xE2, 0xAD, 0x75, 0xE9, 0x1E, 0x75,
+    0xEA, 0x09, 0xD9, 0x75, 0x9E, 0x0A, 0xD7, 0x7E, 0x9D, 0xA7, 0x7A, 0xFC, 0x77, 0x09, 0xFA, 0x77,
+    0x1F, 0x97, 0x71, 0xAD, 0x97, 0x73, 0x97, 0x30, 0x69, 0x99, 0x97, 0x2A, 0xFD, 0xA7, 0xFF, 0xD5,
+    0x9C, 0xA3, 0x9E, 0xA7, 0x49, 0xE7, 0x5E, 0x97, 0x49, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0xAA, 0xDA,
+    0x9E, 0x5A, 0xFF, 0xD4, 0xF9, 0x99, 0xFC, 0x3E, 0x94, 0xAE, 0x2A, 0xD9, 0x6E, 0x2E, 0x69, 0xDA,
+    0x1A, 0xD9, 0x69, 0xD9, 0x1E, 0x7A, 0xD9, 0x1E, 0x7E, 0x19, 0xE7, 0xDA, 0x19, 0xDA, 0x6A, 0xD9,
+    0x19, 0xDA, 0x6E, 0x29, 0xE5, 0xAD, 0x4E, 0x49, 0xDA, 0x4F, 0x91, 0xAD, 0xA6, 0xFF, 0xA7, 0x0F,
+    0xD9, 0x73, 0x99, 0x71, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xCA, 0x9F, 0xDA, 0xAA, 0xAF, 0x72, 0xAE,
+    0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x0F, 0xFC, 0xAF, 0x0F,
+    0xFF, 0xD0, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7,
+    0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xEA, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xDA, 0xFF, 0xFD,
+    0x00, 0x77, 0x77, 0x76, 0xAA, 0x70, 0x9F, 0xEA, 0x92, 0xAD, 0x95, 0xAF, 0xFF, 0x09, 0xDA, 0x5F,
+    0xCA, 0xA9, 0x9A, 0xFE, 0xA5, 0xFA, 0x7F, 0xC5, 0xAE, 0x97, 0x09, 0xF5, 0xE9, 0x70, 0x9F, 0xCA,
+    0x3A, 0xDA, 0x71, 0xE9, 0xE3, 0xE7, 0x1E, 0x1E, 0x91, 0x9E, 0x70, 0xE2, 0xAD, 0xA1, 0xAD, 0xA7,
+    0xE3, 0x9D, 0xA1, 0xAD, 0x96, 0xE4, 0x9D, 0xA1, 0xAD, 0x95, 0xE5, 0x9D, 0xA1, 0xE9, 0x4E, 0x69,
+    0xDA, 0x1A, 0xD9, 0x3E, 0x96, 0xAD, 0xA1, 0xAD, 0xA2, 0xE9, 0x7E, 0x91, 0x9E, 0x1A, 0xD9, 0x70,
+    0xE3, 0xE0, 0xAD, 0x97, 0x0A, 0xE3, 0xAF, 0xC9, 0x71, 0xE9, 0x4F, 0xA7, 0x1F, 0x5A, 0xEA, 0x79,
+    0xF5, 0x9F, 0xDA, 0x91, 0x99, 0xFC, 0x59, 0xDA, 0x9F, 0xFF, 0xC5, 0x9D, 0xA2, 0xAF, 0xFA, 0x97,
+    0xAA, 0x69, 0x99, 0x99, 0x77, 0x77, 0x20, 0x77, 0x74, 0xAD, 0x77, 0xAE, 0x97, 0x6F, 0xA7, 0x5A,
+    0xFC, 0x75, 0xDA, 0xE9, 0x73, 0x9D, 0x9A, 0xE7, 0x3E, 0x1E, 0x73, 0xD9, 0x1E, 0xA7, 0x1A, 0xD2,
+    0xAE, 0x71, 0xDA, 0x3E, 0x70, 0x9D, 0x93, 0xEA, 0x7E, 0x49, 0xE7, 0xDA, 0x5E, 0x95, 0xAD, 0x6E,
+    0xA5, 0xE6, 0x9E, 0x49, 0xD9, 0x7E, 0x93, 0xE7, 0x0F, 0x29, 0xDA, 0x70, 0x9E, 0x2A, 0xD9, 0x71,
+    0xEA, 0x1E, 0x72, 0xAE, 0x0A, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xF0, 0xFF, 0xFF, 0xEA, 0xFF,
+    0xFF, 0xEA, 0x0F, 0xFF, 0xFE, 0x09, 0xFF, 0xFF, 0xE9, 0x9F, 0xAA, 0xAA, 0xA9, 0x9A, 0xAA, 0xAA,
+    0xE1, 0xF7, 0x29, 0xE1, 0xAE, 0x72, 0xAD, 0x92, 0xEA, 0x71, 0xE3, 0xAE, 0x70, 0x9D, 0xA3, 0x9E,
+    0x97, 0xE5, 0xEA, 0x7D, 0xA5, 0xAE, 0x6A, 0xD9, 0x6E, 0x95, 0xE7, 0xF4, 0x9D, 0x97, 0x9E, 0x4A,
+    0xD7, 0x1E, 0xA3, 0xDA, 0x71, 0xAE, 0x2A, 0xD7, 0x3E, 0x91, 0xE7, 0x3E, 0xA0, 0x9D, 0x97, 0x39,
+    0xE0, 0xAD, 0x75, 0xE9, 0xDA, 0x75, 0xAF, 0xC7, 0x69, 0xFA, 0x77, 0xF9, 0x77, 0xAD, 0x97, 0x71,
+    0x97, 0x20, 0x79, 0xAF, 0xFD, 0xA4, 0x9F, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x2F, 0xA7, 0x6A, 0xE9,
+    0x76, 0x9E, 0x77, 0x0E, 0xA7, 0x70, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xAF, 0xFF, 0xFF, 0xAA, 0xEA, 0xFF, 0xFE, 0xAA, 0xD9, 0x77, 0x09,
+    0xDA, 0x77, 0x1E, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xFE, 0x69, 0xAF, 0xFF, 0x77, 0x77, 0x3A, 0xD7, 0x71,
+    0xDA, 0x72, 0x9A, 0xFF, 0xDA, 0x49, 0xFF, 0xFE, 0x3A, 0xFF, 0xFE, 0xA2, 0xFA, 0x5D, 0x95, 0xAE,
+    0x95, 0xAD, 0x59, 0xE7, 0xE5, 0xEA, 0x7D, 0x95, 0xE7, 0xAD, 0x59, 0xDA, 0x7E, 0x5A, 0xDA, 0x7D,
+    0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAF, 0xAF, 0xAF, 0xFF, 0xFF, 0xAA, 0xEA, 0xFF, 0xFE, 0xAA, 0xD9,
+    0x59, 0xD7, 0x9D, 0xA5, 0xE7, 0x0E, 0x5D, 0xA7, 0x0E, 0x93, 0x9D, 0x71, 0x9E, 0x3E, 0x72, 0xF2,
+    0xDA, 0x73, 0xFA, 0xAD, 0x97, 0x4F, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xC6, 0xAD, 0x77, 0x1D, 0xA7, 0x70, 0x9D, 0x97, 0x20, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x4A, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xC1, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0x9E, 0xA7, 0x7E, 0xA7, 0x79, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xAF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+    0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x0A, 0xDA, 0x77, 0x09, 0xE7, 0x71, 0xEA,
+    0x77, 0x09, 0xEA, 0x77, 0x0A, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFF, 0xFC,
+    0x49, 0xFF, 0xFE, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0xAF, 0xFD, 0xA9, 0x7F, 0xFF, 0xE9,
+    0x4A, 0xFF, 0xFE, 0xA7, 0x70, 0xAF, 0x77, 0x09, 0xEA, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E,
+    0x77, 0x1A, 0xD9, 0x77, 0x0A, 0xDA, 0xAF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xFF, 0xFF,
+    0xFA, 0xFF, 0xFE, 0xAE, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77,
+    0x0E, 0x97, 0x7E, 0xA7, 0x6A, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xD3, 0xFF, 0xFE, 0x94,
+    0xFF, 0xFA, 0x96, 0x77, 0x7D, 0xA7, 0x71, 0xAD, 0x76, 0xAF, 0xFD, 0xA9, 0x7F, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFE, 0xA7, 0x9D, 0x5A, 0xF7, 0xDA, 0x59, 0xEA, 0x6E, 0x7E, 0x95, 0x9D, 0x7A, 0xE6, 0xDA,
+    0x7E, 0x6E, 0x7A, 0xD9, 0x5A, 0xD7, 0xAD, 0xAA, 0xFA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAF, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xEA, 0xEA, 0x7D, 0x95, 0x9D, 0xA7, 0xE5, 0xAD, 0x97, 0xAD, 0x5E, 0x71, 0xD9,
+    0x39, 0xE7, 0x1E, 0x3E, 0x97, 0x1A, 0xD2, 0xF7, 0x29, 0xDA, 0xAF, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xE3, 0xFF, 0xFE, 0x94, 0xFF, 0xFC, 0xA7, 0x71, 0xDA, 0x77, 0x1A, 0xD7, 0x71, 0x9D, 0x95,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFE, 0xA4, 0xFF, 0xFF, 0xC9, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xFA, 0x77, 0x0A, 0xE9, 0x77, 0x0A, 0xE7, 0x71, 0xE9, 0x77, 0x0A, 0xDA,
+    0x0F, 0xFF, 0xFE, 0xA0, 0xFF, 0xFF, 0xF0, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7,
+    0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0xAE, 0x77, 0xAE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9A, 0xFA, 0x1F, 0xFF, 0xFC, 0x92, 0xFF, 0xFE, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71, 0x9F,
+    0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE1, 0x99, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA5, 0xAE,
+    0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9,
+    0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7,
+    0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95,
+    0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72,
+    0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x71, 0x9E, 0x93,
+    0xAF, 0xEA, 0x49, 0xFF, 0x0A, 0xFF, 0xC4, 0xFF, 0xC9, 0x77, 0x70, 0x1F, 0xFF, 0xFC, 0x19, 0xFF,
+    0xFF, 0xC1, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE2, 0xAE, 0xA7, 0x0A, 0xD3, 0xF9, 0x79, 0xD4,
+    0xF7, 0x0D, 0x49, 0xF7, 0x9A, 0x5A, 0xEA, 0x77, 0xF9, 0x77, 0xF7, 0x79, 0xEA, 0x77, 0xAE, 0x97,
+    0x7F, 0x77, 0x9E, 0x77, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76,
+    0x9E, 0x71, 0x94, 0xE9, 0x70, 0x9C, 0xA2, 0xEA, 0x71, 0xDA, 0x1A, 0xE7, 0x2D, 0xA0, 0x9E, 0x72,
+    0xAD, 0x90, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xD1, 0xAF, 0xFF, 0xFA, 0x77, 0x19, 0x10, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x00, 0x76, 0xAC, 0xA7, 0x69,
+    0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0xAD, 0x77,
+    0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97,
+    0x6E, 0x76, 0x9D, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x76, 0x9D, 0x77, 0xDA, 0x77,
+    0x99, 0x77, 0x9C, 0xA7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1E, 0x71, 0x9D, 0x72,
+    0xDA, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1E, 0x71, 0x9D, 0x72,
+    0xDA, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x19, 0xD7,
+    0x2D, 0x97, 0x1A, 0xD7, 0x29, 0x90, 0x5A, 0xC9, 0x73, 0xD9, 0x73, 0xD9, 0x6A, 0x3D, 0x92, 0x99,
+    0x09, 0xDA, 0x1A, 0xC9, 0x1E, 0x1F, 0x9A, 0xC9, 0xAE, 0xA2, 0x9F, 0xFA, 0x69, 0xFA, 0x70, 0xAF,
+    0xC9, 0x5A, 0xFF, 0xC9, 0x19, 0xEA, 0x0A, 0xC9, 0x9F, 0x1D, 0x91, 0xD9, 0x1A, 0xCA, 0x19, 0x3D,
+    0x97, 0x3D, 0x97, 0x3D, 0x97, 0x39, 0x96, 0x76, 0x9F, 0xC9, 0x3A, 0xFE, 0x91, 0x9D, 0x92, 0xE1,
+    0xDA, 0x4D, 0x90, 0xD9, 0x4D, 0xA0, 0xD9, 0x4D, 0xA0, 0xDA, 0x4D, 0x90, 0xAD, 0x92, 0xE2, 0xFF,
+    0x93, 0xAF, 0xA7, 0x60, 0x69, 0xE1, 0xFA, 0x0F, 0xA0, 0xAE, 0x60, 0x77, 0x09, 0xAA, 0x77, 0x1E,
+    0x77, 0x09, 0xDA, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1E, 0x77, 0x09, 0xD9, 0x77, 0x0E, 0x77,
+    0x1E, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x70, 0x9D, 0xA3, 0xFD, 0xA5, 0xAD, 0x93,
+    0xFE, 0x5E, 0x4A, 0xAA, 0xAE, 0x5D, 0xA7, 0x0E, 0x93, 0x9D, 0x97, 0x0A, 0xDA, 0x3E, 0x71, 0x9E,
+    0x3D, 0xA7, 0x2E, 0x29, 0xD9, 0x72, 0xAD, 0x91, 0xAD, 0x73, 0x9D, 0xA1, 0xE7, 0x4E, 0x1D, 0x97,
+    0x4E, 0x9A, 0xD7, 0x59, 0xDA, 0xE7, 0x6F, 0xCA, 0x76, 0xFC, 0x77, 0xAF, 0x77, 0x0E, 0xA7, 0x70,
+    0xE9, 0x77, 0x09, 0xCA, 0x71, 0x76, 0x92, 0x9A, 0xCA, 0x94, 0xAD, 0x1F, 0xDA, 0x2A, 0xDA, 0x0A,
+    0xDA, 0x9A, 0xDA, 0x09, 0xD9, 0x1D, 0x92, 0x9D, 0xAD, 0x29, 0xD4, 0x9E, 0x92, 0xAD, 0x5D, 0xA3,
+    0xAD, 0x5E, 0x39, 0xD9, 0x3D, 0xAD, 0x3E, 0xA9, 0xAD, 0x90, 0xAD, 0x91, 0x9F, 0xD9, 0x2E, 0xA2,
+    0xAD, 0xA5, 0xAC, 0xA7, 0x70, 0x29, 0xAC, 0xA9, 0x5A, 0xDA, 0x4A, 0xFC, 0xA2, 0x9F, 0xD2, 0xAD,
+    0xA9, 0xAD, 0xA0, 0x9D, 0xA9, 0xEA, 0x1D, 0xA2, 0x9D, 0xAD, 0x3A, 0xD1, 0xD4, 0xAE, 0x49, 0xD0,
+    0x9D, 0x5D, 0xA5, 0xD0, 0x9D, 0x49, 0xE9, 0x39, 0xD1, 0xD9, 0x29, 0xDA, 0xD3, 0xAD, 0x1E, 0xA9,
+    0xAD, 0x90, 0xEA, 0x9A, 0xD9, 0x2F, 0xD9, 0x2A, 0xFC, 0xA4, 0xAD, 0xA5, 0x9A, 0xD9, 0x20, 0xAD,
+    0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97,
+    0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70,
+    0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD,
+    0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAF, 0xFF, 0xFE, 0x0A, 0xFF,
+    0xFF, 0xE0, 0xAF, 0xFF, 0xFE, 0x00, 0x77, 0x1A, 0x77, 0x4E, 0x77, 0x2F, 0x77, 0x1A, 0xE7, 0x71,
+    0x9E, 0x97, 0x71, 0xEA, 0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x71, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x1F,
+    0x77, 0x1A, 0xE7, 0x71, 0x9E, 0x97, 0x70, 0x9E, 0xA7, 0x71, 0xF7, 0x71, 0xF7, 0x71, 0xAE, 0x97,
+    0x70, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x1F, 0x77, 0x1A, 0xFF, 0xFF, 0xEA, 0x09, 0xFF, 0xFF, 0xFA,
+    0x0F, 0xFF, 0xFF, 0xCA, 0x0A, 0xA9, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x09, 0x99, 0x0A, 0xA9, 0x2A, 0xA9, 0x0E, 0x19, 0xDA, 0x0E,
+    0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19,
+    0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA,
+    0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E,
+    0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19,
+    0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA,
+    0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x09, 0x99, 0x29, 0x99,
+    0x70, 0xE7, 0x70, 0x9E, 0xA7, 0x7A, 0xF7, 0x7F, 0xC9, 0x75, 0x9D, 0x9E, 0x75, 0xE0, 0xAD, 0x75,
+    0xDA, 0x09, 0xDA, 0x73, 0xAD, 0x2E, 0x73, 0xE2, 0xAD, 0x97, 0x19, 0xDA, 0x3D, 0xA7, 0x1A, 0xD4,
+    0xE7, 0x1E, 0x4A, 0xD9, 0x7A, 0xD9, 0x5E, 0x7E, 0x6E, 0x69, 0xDA, 0x69, 0xDA, 0x5A, 0xD9, 0x7E,
+    0x5E, 0x70, 0xAD, 0x93, 0x9D, 0xA7, 0x09, 0xDA, 0x3E, 0x72, 0xE3, 0xE7, 0x2A, 0xDA, 0x1A, 0xD9,
+    0x73, 0xE1, 0xE7, 0x4E, 0x99, 0xDA, 0x74, 0x9D, 0xA0, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x74, 0xAD,
+    0x90, 0xAD, 0x97, 0x3E, 0x19, 0xE7, 0x29, 0xDA, 0x2E, 0x72, 0xE3, 0x9D, 0xA7, 0x1E, 0x4E, 0x70,
+    0xAD, 0x94, 0xAD, 0x70, 0xE5, 0x9D, 0xA6, 0x9D, 0xA6, 0xE6, 0xAD, 0x96, 0xAD, 0x95, 0xE7, 0x0D,
+    0xA4, 0x9D, 0x97, 0x0E, 0x4E, 0x71, 0x9D, 0x93, 0xDA, 0x72, 0xE2, 0xAD, 0x97, 0x2A, 0xD2, 0xE7,
+    0x39, 0xDA, 0x09, 0xDA, 0x74, 0xE0, 0xAD, 0x75, 0x9D, 0x9E, 0x76, 0xFC, 0x97, 0x6A, 0xF7, 0x79,
+    0xEA, 0x77, 0x0E, 0x97, 0x69, 0x99, 0x99, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFE, 0xA4, 0xFC, 0xA9,
+    0x99, 0xAF, 0xC2, 0x9E, 0x96, 0x9E, 0x91, 0xE9, 0x70, 0x9E, 0x09, 0xE7, 0x2E, 0x09, 0xDA, 0x72,
+    0xAD, 0x9A, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72,
+    0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72,
+    0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72,
+    0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72,
+    0x9D, 0xA0, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97,
+    0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97,
+    0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97,
+    0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97,
+    0x29, 0xDA, 0x9D, 0xA7, 0x2A, 0xD9, 0x9E, 0x72, 0xE9, 0x0E, 0x97, 0x09, 0xE1, 0xAE, 0x70, 0xEA,
+    0x2F, 0xA9, 0x90, 0x99, 0xAF, 0x4F, 0xFF, 0xC6, 0x9F, 0xFC, 0x97, 0x29, 0x9A, 0x99, 0x60, 0x72,
+    0x9A, 0xAA, 0x97, 0x3F, 0xE7, 0x1F, 0xFA, 0x79, 0xDA, 0x19, 0xD9, 0x7E, 0x92, 0x99, 0x70, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5A, 0xDA, 0x70, 0xA3,
+    0xE9, 0x7E, 0x19, 0xE7, 0x0F, 0xF9, 0x70, 0x9F, 0xD9, 0x73, 0x9A, 0xA9, 0x72, 0x71, 0x99, 0x77,
+    0x09, 0xEA, 0x77, 0xFC, 0x77, 0xAE, 0xA7, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xDA, 0x72, 0x9D, 0xA1, 0xF7, 0x2F, 0x99, 0xF9, 0x71, 0xF9,
+    0x0F, 0x72, 0xF2, 0x99, 0x74, 0x99, 0x10, 0x19, 0x97, 0x49, 0x92, 0xF7, 0x2F, 0x09, 0xF9, 0x71,
+    0xF9, 0x9F, 0x72, 0xF9, 0x0A, 0xD9, 0x72, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0xAD, 0x77, 0x0A, 0xF7, 0x7F, 0xC7, 0x7A, 0xE9, 0x77, 0x09, 0x97,
+    0x10, 0x3A, 0xA9, 0x2F, 0x19, 0xF1, 0x9E, 0x92, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x1A, 0xDA, 0x19,
+    0xF1, 0x9E, 0xA1, 0x9E, 0x71, 0x19, 0x97, 0x49, 0x92, 0xF7, 0x2F, 0x09, 0xF9, 0x71, 0xF9, 0x9F,
+    0x72, 0xF9, 0x0A, 0xD9, 0x72, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x69, 0xDA, 0x72, 0x9D, 0xA1, 0xF7, 0x2F, 0x99, 0xF9, 0x71, 0xF9, 0x0F, 0x72, 0xF2,
+    0x99, 0x74, 0x99, 0x10, 0x77, 0x59, 0xAD, 0xA9, 0x69, 0xA2, 0xFF, 0x93, 0x9D, 0x1A, 0xDA, 0x99,
+    0xFC, 0xAA, 0xEA, 0x1D, 0x49, 0xAF, 0xDA, 0x29, 0x97, 0x9A, 0xAA, 0x30, 0x77, 0x5A, 0xEA, 0x96,
+    0xAA, 0x2F, 0xFA, 0x39, 0xD1, 0xE9, 0x09, 0xAF, 0xCA, 0xE9, 0x1D, 0x5A, 0xFD, 0x92, 0x99, 0x79,
+    0x9A, 0x97, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x72, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC7, 0x73, 0x29,
+    0xAA, 0x96, 0x92, 0xAF, 0xC9, 0x3A, 0xCA, 0x0A, 0xFF, 0x90, 0x9D, 0xA0, 0xE1, 0x9F, 0xF1, 0xD4,
+    0xAF, 0xC9, 0x29, 0x69, 0x99, 0x5A, 0xDA, 0x6A, 0x2F, 0xDA, 0x3D, 0xA0, 0xFF, 0xCA, 0x9A, 0xDA,
+    0x0D, 0xA2, 0xAF, 0xE1, 0xD4, 0x9F, 0xA7, 0x49, 0x30, 0x77, 0x3D, 0xA9, 0x96, 0x99, 0xAD, 0x1F,
+    0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0xA7, 0x09, 0x99, 0x99, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x4A, 0xFF, 0xFE, 0xA1, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF, 0xC1, 0xA9, 0x74, 0x9A, 0x00,
+    0x77, 0x70, 0xAA, 0x73, 0x9D, 0x39, 0x99, 0x99, 0x99, 0x9D, 0xA9, 0x90, 0xAF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xC7, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xFC, 0x09, 0xFF, 0xFC, 0x3D, 0x97, 0x29, 0xCA, 0x74, 0xA7, 0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x77, 0x77, 0x77, 0x72, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x77, 0x30, 0x73, 0x97,
+    0x39, 0xD9, 0x70, 0x9F, 0xC6, 0x9F, 0xCA, 0x59, 0xFC, 0x95, 0x9F, 0xC9, 0x59, 0xFC, 0x97, 0xAE,
+    0x97, 0x19, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xF7, 0x39,
+    0xC9, 0x77, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0,
+    0x77, 0xD9, 0x72, 0x9F, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72,
+    0xAF, 0x71, 0x9F, 0x79, 0xFA, 0x69, 0xFA, 0x6A, 0xFA, 0x6A, 0xFA, 0x70, 0xEA, 0x72, 0xAA, 0x77,
+    0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x77,
+    0x77, 0x5A, 0xCA, 0x70, 0xAC, 0xA7, 0x1A, 0xF6, 0xAF, 0x7A, 0xFA, 0x5A, 0xFA, 0x6A, 0xFA, 0x5A,
+    0xFA, 0x6A, 0xF9, 0x5A, 0xF9, 0x6A, 0xF9, 0x5A, 0xF9, 0x79, 0xEA, 0x69, 0xEA, 0x72, 0xFC, 0x95,
+    0xFC, 0x97, 0x19, 0xFC, 0x94, 0x9F, 0xC9, 0x71, 0x9F, 0xC9, 0x49, 0xFC, 0x97, 0x1A, 0xFA, 0x5A,
+    0xFC, 0x72, 0xAF, 0xA5, 0xAF, 0xA7, 0x2A, 0xE7, 0xAE, 0x74, 0xAA, 0x71, 0xAA, 0x77, 0x73, 0x77,
+    0x73, 0xAC, 0xA7, 0x0A, 0xCA, 0x73, 0xFA, 0x6F, 0xA7, 0x2A, 0xFA, 0x5A, 0xFA, 0x72, 0xAF, 0xA5,
+    0xAF, 0xA7, 0x29, 0xFA, 0x59, 0xFA, 0x72, 0x9F, 0xA5, 0x9F, 0xA7, 0x2A, 0xE9, 0x6A, 0xE9, 0x79,
+    0xFC, 0x59, 0xFC, 0x69, 0xFC, 0x94, 0x9F, 0xC9, 0x59, 0xFC, 0x94, 0x9F, 0xC9, 0x59, 0xFC, 0x95,
+    0xFC, 0x96, 0xAF, 0xA5, 0xAF, 0xA7, 0x0E, 0xA7, 0xEA, 0x72, 0xAA, 0x71, 0xAA, 0x77, 0x77, 0x60,
+    0x77, 0x4F, 0xFF, 0xDA, 0x94, 0xFF, 0xFF, 0xC9, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAF,
+    0x97, 0x70, 0xAE, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0x9D, 0xA7, 0x70,
+    0x9E, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x7A, 0xE7, 0x7A, 0xE9, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0xFA, 0x1F, 0xFF, 0xFC, 0x92, 0xFF, 0xFE, 0xA4, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x76, 0x99, 0x77, 0x2D, 0x97, 0x70, 0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7,
+    0x70, 0xAD, 0x97, 0x09, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xC1, 0x9F, 0xAA, 0x99, 0x9A, 0xDA, 0x99,
+    0x99, 0x90, 0x9E, 0xA5, 0xE6, 0xEA, 0x6D, 0xA5, 0x9E, 0x69, 0xD9, 0x5A, 0xDA, 0x6A, 0xD6, 0xAD,
+    0x96, 0xDA, 0x6E, 0x95, 0x9D, 0x96, 0xAD, 0x95, 0xAD, 0x7A, 0xDA, 0x5D, 0xA7, 0x9E, 0x49, 0xD9,
+    0x70, 0xEA, 0x3A, 0xD7, 0x19, 0xEA, 0x2D, 0xA7, 0x2A, 0xFA, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x93,
+    0xAF, 0xFF, 0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xD7, 0x71,
+    0xE7, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xAC, 0xA7, 0x30, 0x73, 0x99, 0x77, 0x2D, 0x97, 0x70,
+    0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x7F, 0xFF, 0xDA, 0x94, 0xFF, 0xFF, 0xC9, 0x29,
+    0x99, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xF9, 0x72, 0xE2, 0xF9, 0x71, 0xDA, 0x3A, 0xE7, 0x09, 0xD5,
+    0xE9, 0x7E, 0x5A, 0xDA, 0x7D, 0xA5, 0x9D, 0xA6, 0x9D, 0x95, 0x9E, 0x6A, 0xD6, 0x9D, 0xA6, 0xDA,
+    0x6A, 0xDA, 0x59, 0xD9, 0x6E, 0x95, 0xAD, 0x6A, 0xE6, 0xDA, 0x5A, 0xE9, 0x19, 0x99, 0x99, 0xDA,
+    0x99, 0x99, 0xAF, 0xA1, 0xFF, 0xFF, 0xC9, 0x2F, 0xFF, 0xEA, 0x49, 0x99, 0x9A, 0xDA, 0x99, 0x99,
+    0x97, 0x3A, 0xD7, 0x71, 0xE7, 0x70, 0x9D, 0x97, 0x70, 0xAD, 0x77, 0x1A, 0xCA, 0x76, 0x59, 0xAF,
+    0xFF, 0xA3, 0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xCA, 0x1F, 0x97, 0x6A, 0xE7, 0x70, 0xE9, 0x77, 0x9E,
+    0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0A, 0xDA, 0x77, 0x09, 0xE7, 0x71, 0xE9,
+    0x77, 0x0A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xF5, 0x9A, 0xAA, 0xAF,
+    0xFC, 0xA7, 0x77, 0x77, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF,
+    0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xA9, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC7, 0x70,
+    0x9F, 0x77, 0x1E, 0xA7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0x9E, 0x77, 0x09,
+    0xDA, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xEA, 0x76, 0xAF, 0x1A, 0xFF, 0xFF,
+    0xC2, 0xFF, 0xFF, 0x93, 0xAF, 0xFC, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x77, 0x77, 0x9A, 0xFE,
+    0xA9, 0x74, 0xAF, 0xFE, 0xA7, 0x19, 0xE9, 0x19, 0xC9, 0x19, 0xE9, 0x69, 0xD9, 0x39, 0xC9, 0x3A,
+    0xD9, 0x5D, 0x94, 0x9C, 0x94, 0x9D, 0x4D, 0x95, 0x9C, 0x95, 0xAD, 0x29, 0xD6, 0x9C, 0x96, 0xD9,
+    0x1A, 0xC9, 0x69, 0xC9, 0x69, 0xCA, 0x1D, 0x79, 0xC9, 0x7D, 0x1D, 0x79, 0xC9, 0x7D, 0x09, 0xD9,
+    0x99, 0x99, 0x99, 0x9A, 0xCA, 0x99, 0x99, 0x99, 0x99, 0xD9, 0x9F, 0xFF, 0xFF, 0xE9, 0x9D, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAD, 0x90, 0xD7, 0x9C, 0x97, 0xD1, 0xD7, 0x9C, 0x97,
+    0xD1, 0xD9, 0x69, 0xC9, 0x69, 0xD1, 0x9C, 0xA6, 0x9C, 0x96, 0xD9, 0x2D, 0x95, 0x9C, 0x95, 0x9D,
+    0x39, 0xD5, 0x9C, 0x95, 0xD9, 0x4A, 0xD4, 0x9C, 0x94, 0xDA, 0x6A, 0xDA, 0x29, 0xC9, 0x2A, 0xDA,
+    0x70, 0x9E, 0xA9, 0xAC, 0xA9, 0xAE, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71, 0x77,
+    0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19, 0xE9, 0x69, 0xE9, 0x69, 0xDA, 0x72,
+    0xAD, 0x95, 0xD9, 0x74, 0x9D, 0x4D, 0xA7, 0x6A, 0xD2, 0x9D, 0x77, 0x0D, 0x91, 0xAC, 0x97, 0x70,
+    0x9C, 0xA1, 0xD7, 0x72, 0xD1, 0xD7, 0x72, 0xD0, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x9D, 0x99, 0xFF, 0xFF, 0xFE, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xD9, 0x0D, 0x77, 0x2D, 0x1D, 0x77, 0x2D, 0x1D, 0x97, 0x70, 0x9D, 0x19, 0xCA, 0x77,
+    0x0A, 0xC9, 0x2D, 0x97, 0x69, 0xD3, 0x9D, 0x76, 0xD9, 0x4A, 0xD7, 0x4D, 0xA6, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0x9E, 0xA9, 0x99, 0x99, 0xAE, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71,
+    0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19, 0xE9, 0x69, 0xE9, 0x69, 0xD9,
+    0x72, 0xAD, 0x95, 0xEA, 0x72, 0xF4, 0xDA, 0xDA, 0x70, 0xEA, 0xD2, 0x9D, 0x1D, 0xA6, 0xE1, 0xD9,
+    0x1A, 0xC9, 0x2D, 0xA4, 0xE2, 0x9C, 0xA1, 0xD4, 0xDA, 0x2E, 0x4D, 0x1D, 0x5D, 0xA0, 0xE5, 0xD0,
+    0x9C, 0xA6, 0xFC, 0x6A, 0xC9, 0x9C, 0xA6, 0x9E, 0x7A, 0xC9, 0x9C, 0xA6, 0xFA, 0x6A, 0xC9, 0x0D,
+    0x5E, 0x9D, 0xA5, 0xD1, 0xD4, 0xE2, 0xDA, 0x4D, 0x1D, 0x92, 0xE4, 0xDA, 0x29, 0xD1, 0x9C, 0xA1,
+    0xE6, 0xDA, 0x1A, 0xC9, 0x2D, 0x9E, 0x70, 0xDA, 0x9D, 0x39, 0xF7, 0x2F, 0x94, 0xAD, 0x97, 0x29,
+    0xDA, 0x6A, 0xDA, 0x70, 0xAD, 0xA7, 0x09, 0xEA, 0x99, 0x99, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA7,
+    0x70, 0x99, 0xA9, 0x97, 0x10, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19,
+    0xE9, 0x69, 0xE9, 0x69, 0xD9, 0x72, 0xAD, 0x95, 0xD9, 0x73, 0xAE, 0x4D, 0x97, 0x3A, 0xDA, 0xD2,
+    0x9D, 0x73, 0xAD, 0x1D, 0x91, 0xAC, 0x97, 0x2A, 0xD2, 0x9C, 0xA1, 0xD7, 0x2A, 0xD4, 0xD1, 0xD7,
+    0x1A, 0xD5, 0xD0, 0x9C, 0xA7, 0x0A, 0xD6, 0xAC, 0x99, 0xCA, 0x7A, 0xD7, 0xAC, 0x99, 0xCA, 0x6A,
+    0xD7, 0x0A, 0xC9, 0x0D, 0x5A, 0xD7, 0x1D, 0x1D, 0x4A, 0xD7, 0x2D, 0x1D, 0x92, 0xAD, 0x72, 0x9D,
+    0x19, 0xCA, 0x1A, 0xD7, 0x3A, 0xC9, 0x2D, 0x9A, 0xD7, 0x39, 0xD3, 0x9F, 0x74, 0xD9, 0x4A, 0xD9,
+    0x73, 0xDA, 0x6A, 0xDA, 0x70, 0xAD, 0xA7, 0x09, 0xEA, 0x99, 0x99, 0x9A, 0xE9, 0x73, 0xAF, 0xFC,
+    0xA7, 0x70, 0x99, 0xA9, 0x97, 0x10, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x69, 0xE1, 0xFA, 0x0F,
+    0xA0, 0xAE, 0x29, 0x91, 0x77, 0x73, 0xAD, 0x96, 0xE7, 0xAD, 0x9A, 0xF5, 0xAF, 0x5A, 0xFF, 0xC5,
+    0xFC, 0x5F, 0xC9, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x19, 0x71, 0x97, 0x19, 0x10, 0x77, 0x77, 0x75,
+    0xC7, 0x77, 0x4E, 0x77, 0x72, 0xFC, 0x77, 0x70, 0xFE, 0x77, 0x6E, 0xAF, 0xC7, 0x74, 0xD4, 0x9E,
+    0x77, 0x2D, 0x7A, 0xD7, 0x70, 0xE7, 0x0A, 0xD7, 0x6F, 0xA9, 0xAD, 0xA9, 0x2E, 0x74, 0xFF, 0xFA,
+    0x19, 0xE7, 0x2F, 0xFF, 0xD9, 0x1F, 0x70, 0xFF, 0xFE, 0xA1, 0xFC, 0x6F, 0xFF, 0xFC, 0x1A, 0xFC,
+    0x4F, 0xFF, 0xFC, 0x91, 0xFE, 0x2F, 0xFF, 0xEA, 0x93, 0xFF, 0x09, 0xFF, 0xF9, 0x6A, 0xFF, 0x90,
+    0x9F, 0xFD, 0xA6, 0xAF, 0xF9, 0x29, 0xFF, 0xCA, 0x49, 0xFF, 0xC9, 0x49, 0xFF, 0xA2, 0xAF, 0xFD,
+    0x96, 0x9F, 0xF1, 0xAF, 0xFD, 0x97, 0x09, 0xFE, 0x19, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x9F, 0xFC,
+    0x97, 0x49, 0xFF, 0xFE, 0x97, 0x69, 0xFC, 0x90, 0x9F, 0xC9, 0x77, 0x09, 0xEA, 0x2F, 0x97, 0x72,
+    0x9D, 0xA2, 0xE9, 0x77, 0x49, 0xD9, 0x0A, 0xD9, 0x77, 0x69, 0xFC, 0x97, 0x77, 0x09, 0xE9, 0x77,
+    0x72, 0x9C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 10, 26, 12, 1, 25, 65, 0 }, // !
-    { 12, 11, 14, 1, 24, 33, 65 }, // "
-    { 21, 21, 22, 0, 19, 111, 98 }, // #
-    { 18, 34, 21, 1, 27, 153, 209 }, // $
-    { 28, 26, 32, 2, 24, 182, 362 }, // %
-    { 26, 26, 30, 2, 24, 169, 544 }, // &
-    { 6, 11, 8, 1, 24, 17, 713 }, // '
-    { 15, 34, 17, 1, 27, 128, 730 }, // (
-    { 15, 34, 13, -3, 27, 128, 858 }, // )
-    { 12, 11, 14, 1, 24, 33, 986 }, // *
-    { 15, 15, 21, 3, 19, 57, 1019 }, // +
-    { 8, 11, 10, -1, 5, 22, 1076 }, // ,
-    { 11, 3, 13, 1, 10, 9, 1098 }, // -
-    { 5, 6, 10, 2, 5, 8, 1107 }, // .
-    { 19, 26, 19, -1, 24, 124, 1115 }, // /
-    { 20, 24, 21, 0, 23, 120, 1239 }, // 0
-    { 13, 23, 21, 2, 23, 75, 1359 }, // 1
-    { 19, 23, 21, 0, 23, 110, 1434 }, // 2
-    { 18, 24, 21, 0, 23, 108, 1544 }, // 3
-    { 19, 23, 21, 0, 23, 110, 1652 }, // 4
-    { 18, 24, 21, 1, 23, 108, 1762 }, // 5
-    { 20, 24, 22, 1, 23, 120, 1870 }, // 6
-    { 17, 24, 22, 4, 23, 102, 1990 }, // 7
-    { 18, 24, 21, 1, 23, 108, 2092 }, // 8
-    { 19, 24, 21, 0, 23, 114, 2200 }, // 9
-    { 8, 18, 11, 2, 17, 36, 2314 }, // :
-    { 11, 23, 11, -1, 17, 64, 2350 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2414 }, // <
-    { 15, 9, 21, 3, 16, 34, 2474 }, // =
-    { 15, 16, 21, 3, 19, 60, 2508 }, // >
-    { 12, 25, 15, 2, 24, 75, 2568 }, // ?
-    { 30, 30, 32, 1, 23, 225, 2643 }, // @
-    { 25, 24, 24, -2, 24, 150, 2868 }, // A
-    { 20, 25, 20, -1, 24, 125, 3018 }, // B
-    { 20, 25, 22, 1, 24, 125, 3143 }, // C
-    { 24, 25, 24, -1, 24, 150, 3268 }, // D
-    { 21, 23, 21, -1, 23, 121, 3418 }, // E
-    { 20, 23, 20, -1, 23, 115, 3539 }, // F
-    { 21, 25, 23, 1, 24, 132, 3654 }, // G
-    { 29, 23, 29, -1, 23, 167, 3786 }, // H
-    { 15, 23, 15, -1, 23, 87, 3953 }, // I
-    { 20, 30, 15, -6, 23, 150, 4040 }, // J
-    { 25, 24, 25, -1, 23, 150, 4190 }, // K
-    { 19, 23, 19, -1, 23, 110, 4340 }, // L
-    { 32, 23, 31, -2, 23, 184, 4450 }, // M
-    { 28, 24, 28, -1, 23, 168, 4634 }, // N
-    { 23, 25, 25, 1, 24, 144, 4802 }, // O
-    { 20, 24, 20, -1, 24, 120, 4946 }, // P
-    { 28, 32, 30, 1, 24, 224, 5066 }, // Q
-    { 22, 25, 22, -1, 24, 138, 5290 }, // R
-    { 17, 25, 18, 0, 24, 107, 5428 }, // S
-    { 20, 23, 23, 2, 23, 115, 5535 }, // T
-    { 24, 24, 28, 3, 23, 144, 5650 }, // U
-    { 24, 24, 27, 2, 23, 144, 5794 }, // V
-    { 34, 24, 37, 2, 23, 204, 5938 }, // W
-    { 27, 23, 25, -3, 23, 156, 6142 }, // X
-    { 22, 23, 25, 2, 23, 127, 6298 }, // Y
-    { 20, 24, 20, -1, 23, 120, 6425 }, // Z
-    { 14, 32, 13, -2, 26, 112, 6545 }, // [
-    { 13, 26, 16, 2, 24, 85, 6657 }, // <backslash>
-    { 14, 32, 13, -2, 26, 112, 6742 }, // ]
-    { 16, 15, 21, 2, 21, 60, 6854 }, // ^
-    { 17, 3, 18, 0, -1, 13, 6914 }, // _
-    { 7, 8, 20, 7, 27, 14, 6927 }, // `
-    { 18, 19, 20, 1, 18, 86, 6941 }, // a
-    { 17, 27, 18, 0, 26, 115, 7027 }, // b
-    { 13, 19, 15, 1, 18, 62, 7142 }, // c
-    { 18, 27, 20, 1, 26, 122, 7204 }, // d
-    { 14, 19, 16, 1, 18, 67, 7326 }, // e
-    { 24, 34, 19, -6, 26, 204, 7393 }, // f
-    { 22, 26, 20, -3, 18, 143, 7597 }, // g
-    { 18, 27, 20, 1, 26, 122, 7740 }, // h
-    { 10, 27, 12, 1, 26, 68, 7862 }, // i
-    { 17, 34, 12, -6, 26, 145, 7930 }, // j
-    { 16, 27, 18, 1, 26, 108, 8075 }, // k
-    { 9, 27, 11, 1, 26, 61, 8183 }, // l
-    { 28, 19, 30, 1, 18, 133, 8244 }, // m
-    { 19, 19, 21, 1, 18, 91, 8377 }, // n
-    { 16, 19, 18, 1, 18, 76, 8468 }, // o
-    { 20, 26, 19, -2, 18, 130, 8544 }, // p
-    { 17, 26, 19, 1, 18, 111, 8674 }, // q
-    { 14, 18, 16, 1, 18, 63, 8785 }, // r
-    { 13, 19, 14, 0, 18, 62, 8848 }, // s
-    { 12, 23, 14, 1, 22, 69, 8910 }, // t
-    { 19, 19, 21, 1, 18, 91, 8979 }, // u
-    { 17, 19, 18, 0, 18, 81, 9070 }, // v
-    { 25, 19, 26, 0, 18, 119, 9151 }, // w
-    { 20, 19, 20, -1, 18, 95, 9270 }, // x
-    { 20, 26, 18, -3, 18, 130, 9365 }, // y
-    { 16, 19, 17, 0, 18, 76, 9495 }, // z
-    { 13, 33, 15, 1, 27, 108, 9571 }, // {
-    { 10, 30, 11, 0, 26, 75, 9679 }, // |
-    { 13, 33, 13, -1, 27, 108, 9754 }, // }
-    { 16, 6, 21, 2, 14, 24, 9862 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9886 }, //  
-    { 10, 26, 10, -1, 18, 65, 9886 }, // ¡
-    { 17, 33, 21, 2, 26, 141, 9951 }, // ¢
-    { 21, 24, 21, -1, 23, 126, 10092 }, // £
-    { 21, 16, 22, 0, 19, 84, 10218 }, // ¤
-    { 22, 23, 24, 1, 23, 127, 10302 }, // ¥
-    { 10, 30, 11, 0, 26, 75, 10429 }, // ¦
-    { 15, 26, 16, 0, 23, 98, 10504 }, // §
-    { 12, 5, 20, 4, 25, 15, 10602 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 10617 }, // ©
-    { 13, 16, 15, 1, 24, 52, 10774 }, // ª
-    { 16, 13, 18, 1, 15, 52, 10826 }, // «
-    { 15, 8, 21, 3, 15, 30, 10878 }, // ¬
-    { 11, 3, 13, 1, 10, 9, 10908 }, // ­
-    { 19, 18, 20, 0, 26, 86, 10917 }, // ®
-    { 11, 4, 20, 5, 24, 11, 11003 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 11014 }, // °
-    { 15, 20, 21, 3, 20, 75, 11047 }, // ±
-    { 13, 16, 15, 1, 28, 52, 11122 }, // ²
-    { 12, 17, 15, 1, 28, 51, 11174 }, // ³
-    { 7, 8, 20, 7, 27, 14, 11225 }, // ´
-    { 21, 26, 21, -1, 18, 137, 11239 }, // µ
-    { 21, 28, 21, -1, 23, 147, 11376 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 11523 }, // ·
-    { 8, 8, 20, 6, -1, 16, 11532 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 11548 }, // ¹
-    { 13, 16, 15, 1, 24, 52, 11588 }, // º
-    { 16, 13, 17, 0, 15, 52, 11640 }, // »
-    { 32, 26, 36, 2, 24, 208, 11692 }, // ¼
-    { 32, 26, 36, 2, 24, 208, 11900 }, // ½
-    { 33, 26, 36, 1, 24, 215, 12108 }, // ¾
-    { 11, 25, 14, 0, 18, 69, 12323 }, // ¿
-    { 25, 32, 24, -2, 32, 200, 12392 }, // À
-    { 25, 32, 24, -2, 32, 200, 12592 }, // Á
-    { 25, 32, 24, -2, 32, 200, 12792 }, // Â
-    { 25, 31, 24, -2, 31, 194, 12992 }, // Ã
-    { 25, 31, 24, -2, 31, 194, 13186 }, // Ä
-    { 25, 33, 24, -2, 33, 207, 13380 }, // Å
-    { 33, 23, 31, -3, 23, 190, 13587 }, // Æ
-    { 20, 33, 22, 1, 24, 165, 13777 }, // Ç
-    { 21, 32, 21, -1, 32, 168, 13942 }, // È
-    { 21, 32, 21, -1, 32, 168, 14110 }, // É
-    { 21, 32, 21, -1, 32, 168, 14278 }, // Ê
-    { 21, 31, 21, -1, 31, 163, 14446 }, // Ë
-    { 15, 32, 15, -1, 32, 120, 14609 }, // Ì
-    { 16, 32, 16, -1, 32, 128, 14729 }, // Í
-    { 16, 32, 16, -1, 32, 128, 14857 }, // Î
-    { 17, 31, 17, -1, 31, 132, 14985 }, // Ï
-    { 24, 25, 24, -1, 24, 150, 15117 }, // Ð
-    { 28, 32, 28, -1, 31, 224, 15267 }, // Ñ
-    { 23, 33, 25, 1, 32, 190, 15491 }, // Ò
-    { 23, 33, 25, 1, 32, 190, 15681 }, // Ó
-    { 23, 33, 25, 1, 32, 190, 15871 }, // Ô
-    { 23, 32, 25, 1, 31, 184, 16061 }, // Õ
-    { 23, 32, 25, 1, 31, 184, 16245 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 16429 }, // ×
-    { 26, 25, 26, -1, 24, 163, 16478 }, // Ø
-    { 24, 33, 28, 3, 32, 198, 16641 }, // Ù
-    { 24, 33, 28, 3, 32, 198, 16839 }, // Ú
-    { 24, 33, 28, 3, 32, 198, 17037 }, // Û
-    { 24, 32, 28, 3, 31, 192, 17235 }, // Ü
-    { 22, 32, 25, 2, 32, 176, 17427 }, // Ý
-    { 20, 23, 20, -1, 23, 115, 17603 }, // Þ
-    { 25, 34, 21, -5, 26, 213, 17718 }, // ß
-    { 18, 28, 20, 1, 27, 126, 17931 }, // à
-    { 18, 28, 20, 1, 27, 126, 18057 }, // á
-    { 18, 28, 20, 1, 27, 126, 18183 }, // â
-    { 18, 27, 20, 1, 26, 122, 18309 }, // ã
-    { 18, 26, 20, 1, 25, 117, 18431 }, // ä
-    { 18, 29, 20, 1, 28, 131, 18548 }, // å
-    { 24, 19, 26, 1, 18, 114, 18679 }, // æ
-    { 13, 27, 15, 1, 18, 88, 18793 }, // ç
-    { 14, 28, 16, 1, 27, 98, 18881 }, // è
-    { 15, 28, 17, 1, 27, 105, 18979 }, // é
-    { 15, 28, 17, 1, 27, 105, 19084 }, // ê
-    { 16, 26, 18, 1, 25, 104, 19189 }, // ë
-    { 9, 28, 11, 1, 27, 63, 19293 }, // ì
-    { 12, 28, 14, 1, 27, 84, 19356 }, // í
-    { 12, 28, 14, 1, 27, 84, 19440 }, // î
-    { 13, 26, 15, 1, 25, 85, 19524 }, // ï
-    { 16, 28, 18, 1, 27, 112, 19609 }, // ð
-    { 19, 27, 21, 1, 26, 129, 19721 }, // ñ
-    { 16, 28, 18, 1, 27, 112, 19850 }, // ò
-    { 16, 28, 18, 1, 27, 112, 19962 }, // ó
-    { 16, 28, 18, 1, 27, 112, 20074 }, // ô
-    { 17, 27, 19, 1, 26, 115, 20186 }, // õ
-    { 17, 26, 19, 1, 25, 111, 20301 }, // ö
-    { 15, 16, 21, 3, 19, 60, 20412 }, // ÷
-    { 21, 19, 20, -2, 18, 100, 20472 }, // ø
-    { 19, 28, 21, 1, 27, 133, 20572 }, // ù
-    { 19, 28, 21, 1, 27, 133, 20705 }, // ú
-    { 19, 28, 21, 1, 27, 133, 20838 }, // û
-    { 19, 26, 21, 1, 25, 124, 20971 }, // ü
-    { 20, 35, 18, -3, 27, 175, 21095 }, // ý
-    { 20, 34, 18, -3, 26, 170, 21270 }, // þ
-    { 20, 33, 18, -3, 25, 165, 21440 }, // ÿ
-    { 25, 30, 24, -2, 30, 188, 21605 }, // Ā
-    { 18, 25, 20, 1, 24, 113, 21793 }, // ā
-    { 25, 32, 24, -2, 32, 200, 21906 }, // Ă
-    { 18, 27, 20, 1, 26, 122, 22106 }, // ă
-    { 25, 31, 24, -2, 24, 194, 22228 }, // Ą
-    { 18, 25, 20, 1, 18, 113, 22422 }, // ą
-    { 20, 33, 22, 1, 32, 165, 22535 }, // Ć
-    { 15, 28, 17, 1, 27, 105, 22700 }, // ć
-    { 20, 33, 22, 1, 32, 165, 22805 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 22970 }, // ĉ
-    { 20, 32, 22, 1, 31, 160, 23075 }, // Ċ
-    { 13, 26, 15, 1, 25, 85, 23235 }, // ċ
-    { 21, 33, 23, 1, 32, 174, 23320 }, // Č
-    { 16, 28, 18, 1, 27, 112, 23494 }, // č
-    { 24, 33, 24, -1, 32, 198, 23606 }, // Ď
-    { 24, 30, 26, 1, 29, 180, 23804 }, // ď
-    { 24, 25, 24, -1, 24, 150, 23984 }, // Đ
-    { 20, 27, 22, 1, 26, 135, 24134 }, // đ
-    { 21, 30, 21, -1, 30, 158, 24269 }, // Ē
-    { 15, 25, 17, 1, 24, 94, 24427 }, // ē
-    { 21, 32, 21, -1, 32, 168, 24521 }, // Ĕ
-    { 16, 27, 18, 1, 26, 108, 24689 }, // ĕ
-    { 21, 31, 21, -1, 31, 163, 24797 }, // Ė
-    { 14, 26, 16, 1, 25, 91, 24960 }, // ė
-    { 21, 30, 21, -1, 23, 158, 25051 }, // Ę
-    { 14, 25, 16, 1, 18, 88, 25209 }, // ę
-    { 22, 32, 22, -1, 32, 176, 25297 }, // Ě
-    { 16, 28, 18, 1, 27, 112, 25473 }, // ě
-    { 21, 33, 24, 2, 32, 174, 25585 }, // Ĝ
-    { 22, 35, 20, -3, 27, 193, 25759 }, // ĝ
-    { 21, 33, 24, 2, 32, 174, 25952 }, // Ğ
-    { 22, 34, 20, -3, 26, 187, 26126 }, // ğ
-    { 21, 32, 24, 2, 31, 168, 26313 }, // Ġ
-    { 22, 33, 20, -3, 25, 182, 26481 }, // ġ
-    { 21, 33, 24, 2, 24, 174, 26663 }, // Ģ
-    { 22, 36, 20, -3, 28, 198, 26837 }, // ģ
-    { 29, 32, 29, -1, 32, 232, 27035 }, // Ĥ
-    { 18, 35, 20, 1, 34, 158, 27267 }, // ĥ
-    { 29, 23, 29, -1, 23, 167, 27425 }, // Ħ
-    { 18, 27, 20, 1, 26, 122, 27592 }, // ħ
-    { 16, 31, 16, -1, 31, 124, 27714 }, // Ĩ
-    { 13, 27, 15, 1, 26, 88, 27838 }, // ĩ
-    { 16, 30, 16, -1, 30, 120, 27926 }, // Ī
-    { 13, 25, 15, 1, 24, 82, 28046 }, // ī
-    { 16, 32, 16, -1, 32, 128, 28128 }, // Ĭ
-    { 13, 27, 15, 1, 26, 88, 28256 }, // ĭ
-    { 15, 30, 15, -1, 23, 113, 28344 }, // Į
-    { 10, 33, 12, 1, 26, 83, 28457 }, // į
-    { 15, 31, 15, -1, 31, 117, 28540 }, // İ
-    { 9, 19, 11, 1, 18, 43, 28657 }, // ı
-    { 27, 30, 27, -1, 23, 203, 28700 }, // Ĳ
-    { 20, 34, 22, 1, 26, 170, 28903 }, // ĳ
-    { 22, 39, 17, -6, 32, 215, 29073 }, // Ĵ
-    { 19, 35, 14, -6, 27, 167, 29288 }, // ĵ
-    { 25, 32, 25, -1, 23, 200, 29455 }, // Ķ
-    { 16, 35, 18, 1, 26, 140, 29655 }, // ķ
-    { 17, 19, 19, 1, 18, 81, 29795 }, // ĸ
-    { 19, 32, 19, -1, 32, 152, 29876 }, // Ĺ
-    { 12, 35, 14, 1, 34, 105, 30028 }, // ĺ
-    { 19, 32, 19, -1, 23, 152, 30133 }, // Ļ
-    { 11, 35, 11, -1, 26, 97, 30285 }, // ļ
-    { 20, 26, 20, -1, 26, 130, 30382 }, // Ľ
-    { 15, 30, 17, 1, 29, 113, 30512 }, // ľ
-    { 20, 23, 20, -1, 23, 115, 30625 }, // Ŀ
-    { 14, 27, 16, 1, 26, 95, 30740 }, // ŀ
-    { 19, 23, 19, -1, 23, 110, 30835 }, // Ł
-    { 13, 27, 13, -1, 26, 88, 30945 }, // ł
-    { 28, 33, 28, -1, 32, 231, 31033 }, // Ń
-    { 19, 28, 21, 1, 27, 133, 31264 }, // ń
-    { 28, 32, 28, -1, 23, 224, 31397 }, // Ņ
-    { 19, 27, 21, 1, 18, 129, 31621 }, // ņ
-    { 28, 33, 28, -1, 32, 231, 31750 }, // Ň
-    { 19, 28, 21, 1, 27, 133, 31981 }, // ň
-    { 25, 26, 28, 2, 25, 163, 32114 }, // ŉ
-    { 28, 30, 28, -1, 23, 210, 32277 }, // Ŋ
-    { 17, 26, 19, 1, 18, 111, 32487 }, // ŋ
-    { 23, 31, 25, 1, 30, 179, 32598 }, // Ō
-    { 17, 25, 19, 1, 24, 107, 32777 }, // ō
-    { 23, 33, 25, 1, 32, 190, 32884 }, // Ŏ
-    { 17, 27, 19, 1, 26, 115, 33074 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 33189 }, // Ő
-    { 19, 28, 21, 1, 27, 133, 33393 }, // ő
-    { 31, 24, 33, 1, 23, 186, 33526 }, // Œ
-    { 25, 19, 27, 1, 18, 119, 33712 }, // œ
-    { 22, 33, 22, -1, 32, 182, 33831 }, // Ŕ
-    { 14, 27, 16, 1, 27, 95, 34013 }, // ŕ
-    { 22, 33, 22, -1, 24, 182, 34108 }, // Ŗ
-    { 16, 27, 16, -1, 18, 108, 34290 }, // ŗ
-    { 22, 33, 22, -1, 32, 182, 34398 }, // Ř
-    { 16, 27, 18, 1, 27, 108, 34580 }, // ř
-    { 17, 33, 18, 0, 32, 141, 34688 }, // Ś
-    { 15, 28, 16, 0, 27, 105, 34829 }, // ś
-    { 17, 33, 18, 0, 32, 141, 34934 }, // Ŝ
-    { 15, 28, 16, 0, 27, 105, 35075 }, // ŝ
-    { 17, 33, 18, 0, 24, 141, 35180 }, // Ş
-    { 13, 27, 14, 0, 18, 88, 35321 }, // ş
-    { 18, 33, 19, 0, 32, 149, 35409 }, // Š
-    { 16, 28, 17, 0, 27, 112, 35558 }, // š
-    { 20, 32, 23, 2, 23, 160, 35670 }, // Ţ
-    { 13, 31, 14, 0, 22, 101, 35830 }, // ţ
-    { 20, 32, 23, 2, 32, 160, 35931 }, // Ť
-    { 14, 28, 16, 1, 27, 98, 36091 }, // ť
-    { 20, 23, 23, 2, 23, 115, 36189 }, // Ŧ
-    { 13, 23, 14, 0, 22, 75, 36304 }, // ŧ
-    { 24, 32, 28, 3, 31, 192, 36379 }, // Ũ
-    { 19, 27, 21, 1, 26, 129, 36571 }, // ũ
-    { 24, 31, 28, 3, 30, 186, 36700 }, // Ū
-    { 19, 25, 21, 1, 24, 119, 36886 }, // ū
-    { 24, 33, 28, 3, 32, 198, 37005 }, // Ŭ
-    { 19, 27, 21, 1, 26, 129, 37203 }, // ŭ
-    { 24, 34, 28, 3, 33, 204, 37332 }, // Ů
-    { 19, 29, 21, 1, 28, 138, 37536 }, // ů
-    { 24, 34, 28, 3, 33, 204, 37674 }, // Ű
-    { 19, 28, 21, 1, 27, 133, 37878 }, // ű
-    { 24, 30, 28, 3, 23, 180, 38011 }, // Ų
-    { 19, 25, 21, 1, 18, 119, 38191 }, // ų
-    { 34, 33, 37, 2, 32, 281, 38310 }, // Ŵ
-    { 25, 28, 26, 0, 27, 175, 38591 }, // ŵ
-    { 22, 32, 25, 2, 32, 176, 38766 }, // Ŷ
-    { 20, 35, 18, -3, 27, 175, 38942 }, // ŷ
-    { 22, 31, 25, 2, 31, 171, 39117 }, // Ÿ
-    { 20, 33, 20, -1, 32, 165, 39288 }, // Ź
-    { 16, 28, 17, 0, 27, 112, 39453 }, // ź
-    { 20, 32, 20, -1, 31, 160, 39565 }, // Ż
-    { 16, 26, 17, 0, 25, 104, 39725 }, // ż
-    { 20, 33, 20, -1, 32, 165, 39829 }, // Ž
-    { 16, 28, 17, 0, 27, 112, 39994 }, // ž
-    { 24, 34, 19, -6, 26, 204, 40106 }, // ſ
-    { 26, 29, 28, 1, 28, 189, 40310 }, // Ơ
-    { 19, 22, 21, 1, 21, 105, 40499 }, // ơ
-    { 21, 24, 22, 0, 24, 126, 40604 }, // Ƥ
-    { 20, 34, 19, -2, 26, 170, 40730 }, // ƥ
-    { 12, 30, 14, 1, 22, 90, 40900 }, // ƫ
-    { 20, 23, 23, 2, 23, 115, 40990 }, // Ƭ
-    { 15, 27, 17, 1, 26, 102, 41105 }, // ƭ
-    { 20, 30, 23, 2, 23, 150, 41207 }, // Ʈ
-    { 26, 29, 30, 3, 28, 189, 41357 }, // Ư
-    { 22, 22, 24, 1, 21, 121, 41546 }, // ư
-    { 7, 8, 3, -5, 27, 14, 41667 }, // ̀
-    { 7, 8, 6, -2, 27, 14, 41681 }, // ́
-    { 11, 8, 6, -6, 27, 22, 41695 }, // ̂
-    { 12, 6, 7, -6, 26, 18, 41717 }, // ̃
-    { 10, 4, 6, -5, 24, 10, 41735 }, // ̄
-    { 11, 6, 7, -5, 26, 17, 41745 }, // ̆
-    { 6, 5, 4, -3, 25, 8, 41762 }, // ̇
-    { 12, 5, 7, -6, 25, 15, 41770 }, // ̈
-    { 9, 10, 6, -4, 29, 23, 41785 }, // ̉
-    { 8, 10, 5, -4, 28, 20, 41808 }, // ̊
-    { 13, 8, 8, -6, 27, 26, 41828 }, // ̋
-    { 11, 8, 7, -5, 27, 22, 41854 }, // ̌
-    { 10, 8, 4, -7, 27, 20, 41876 }, // ̏
-    { 11, 7, 6, -6, 26, 20, 41896 }, // ̑
-    { 6, 9, 4, -3, 28, 14, 41916 }, // ̒
-    { 7, 10, 5, -3, 29, 18, 41930 }, // ̓
-    { 6, 10, 3, -4, 29, 15, 41948 }, // ̔
-    { 5, 9, 3, -3, 29, 12, 41963 }, // ̕
-    { 6, 8, 4, -3, 21, 12, 41975 }, // ̛
-    { 6, 6, 4, -3, -2, 9, 41987 }, // ̣
-    { 12, 5, 7, -6, -3, 15, 41996 }, // ̤
-    { 8, 8, 5, -4, -1, 16, 42011 }, // ̥
-    { 7, 8, 4, -4, -1, 14, 42027 }, // ̦
-    { 8, 8, 5, -4, -1, 16, 42041 }, // ̧
-    { 7, 8, 4, -4, 1, 14, 42057 }, // ̨
-    { 5, 8, 9, -1, -1, 10, 42071 }, // ̩
-    { 11, 7, 6, -6, -2, 20, 42081 }, // ̭
-    { 11, 7, 6, -6, -1, 20, 42101 }, // ̮
-    { 12, 6, 7, -6, -2, 18, 42121 }, // ̰
-    { 10, 3, 6, -5, -3, 8, 42139 }, // ̱
-    { 11, 7, 6, -6, 26, 20, 42147 }, // ͂
-    { 12, 13, 6, -7, 33, 39, 42167 }, // ̈́
-    { 6, 6, 5, -2, -2, 9, 42206 }, // ͅ
-    { 25, 24, 24, -2, 24, 150, 42215 }, // Α
-    { 20, 25, 20, -1, 24, 125, 42365 }, // Β
-    { 21, 23, 21, -1, 23, 121, 42490 }, // Γ
-    { 20, 24, 22, 0, 24, 120, 42611 }, // Δ
-    { 21, 23, 21, -1, 23, 121, 42731 }, // Ε
-    { 20, 24, 20, -1, 23, 120, 42852 }, // Ζ
-    { 29, 23, 29, -1, 23, 167, 42972 }, // Η
-    { 23, 25, 25, 1, 24, 144, 43139 }, // Θ
-    { 15, 23, 15, -1, 23, 87, 43283 }, // Ι
-    { 25, 24, 25, -1, 23, 150, 43370 }, // Κ
-    { 25, 24, 24, -2, 24, 150, 43520 }, // Λ
-    { 32, 23, 31, -2, 23, 184, 43670 }, // Μ
-    { 28, 24, 28, -1, 23, 168, 43854 }, // Ν
-    { 22, 23, 22, -1, 23, 127, 44022 }, // Ξ
-    { 23, 25, 25, 1, 24, 144, 44149 }, // Ο
-    { 27, 23, 27, -1, 23, 156, 44293 }, // Π
-    { 20, 24, 20, -1, 24, 120, 44449 }, // Ρ
-    { 21, 24, 21, -1, 23, 126, 44569 }, // Σ
-    { 20, 23, 23, 2, 23, 115, 44695 }, // Τ
-    { 22, 24, 24, 1, 24, 132, 44810 }, // Υ
-    { 24, 25, 25, 0, 24, 150, 44942 }, // Φ
-    { 27, 23, 25, -3, 23, 156, 45092 }, // Χ
-    { 25, 24, 28, 2, 24, 150, 45248 }, // Ψ
-    { 26, 24, 26, -1, 24, 156, 45398 }, // Ω
-    { 19, 19, 21, 1, 18, 91, 45554 }, // α
-    { 17, 34, 18, 0, 26, 145, 45645 }, // β
-    { 17, 26, 18, 0, 18, 111, 45790 }, // γ
-    { 17, 27, 19, 1, 26, 115, 45901 }, // δ
-    { 14, 19, 16, 1, 18, 67, 46016 }, // ε
-    { 14, 35, 16, 1, 28, 123, 46083 }, // ζ
-    { 16, 26, 19, 1, 18, 104, 46206 }, // η
-    { 17, 27, 20, 2, 26, 115, 46310 }, // θ
-    { 8, 19, 10, 1, 18, 38, 46425 }, // ι
-    { 18, 19, 20, 1, 18, 86, 46463 }, // κ
-    { 19, 27, 18, -2, 26, 129, 46549 }, // λ
-    { 21, 26, 21, -1, 18, 137, 46678 }, // μ
-    { 17, 19, 18, 0, 18, 81, 46815 }, // ν
-    { 14, 35, 16, 1, 28, 123, 46896 }, // ξ
-    { 16, 19, 18, 1, 18, 76, 47019 }, // ο
-    { 20, 19, 21, 0, 18, 95, 47095 }, // π
-    { 18, 26, 18, -1, 18, 117, 47190 }, // ρ
-    { 13, 25, 15, 1, 18, 82, 47307 }, // ς
-    { 19, 19, 21, 1, 18, 91, 47389 }, // σ
-    { 16, 19, 18, 1, 18, 76, 47480 }, // τ
-    { 17, 19, 19, 1, 18, 81, 47556 }, // υ
-    { 21, 26, 23, 1, 18, 137, 47637 }, // φ
-    { 20, 26, 19, -2, 18, 130, 47774 }, // χ
-    { 23, 32, 25, 1, 24, 184, 47904 }, // ψ
-    { 22, 19, 24, 1, 18, 105, 48088 }, // ω
-    { 25, 32, 24, -2, 24, 200, 48193 }, // Ạ
-    { 18, 26, 20, 1, 18, 117, 48393 }, // ạ
-    { 25, 34, 24, -2, 34, 213, 48510 }, // Ả
-    { 18, 30, 20, 1, 29, 135, 48723 }, // ả
-    { 27, 35, 26, -2, 35, 237, 48858 }, // Ấ
-    { 21, 33, 23, 1, 32, 174, 49095 }, // ấ
-    { 25, 35, 24, -2, 35, 219, 49269 }, // Ầ
-    { 18, 33, 20, 1, 32, 149, 49488 }, // ầ
-    { 26, 35, 25, -2, 35, 228, 49637 }, // Ẩ
-    { 21, 33, 23, 1, 32, 174, 49865 }, // ẩ
-    { 25, 35, 24, -2, 35, 219, 50039 }, // Ẫ
-    { 18, 32, 20, 1, 31, 144, 50258 }, // ẫ
-    { 25, 40, 24, -2, 32, 250, 50402 }, // Ậ
-    { 18, 35, 20, 1, 27, 158, 50652 }, // ậ
-    { 25, 35, 24, -2, 35, 219, 50810 }, // Ắ
-    { 18, 33, 20, 1, 32, 149, 51029 }, // ắ
-    { 25, 35, 24, -2, 35, 219, 51178 }, // Ằ
-    { 18, 33, 20, 1, 32, 149, 51397 }, // ằ
-    { 25, 35, 24, -2, 35, 219, 51546 }, // Ẳ
-    { 18, 34, 20, 1, 33, 153, 51765 }, // ẳ
-    { 25, 35, 24, -2, 35, 219, 51918 }, // Ẵ
-    { 18, 32, 20, 1, 31, 144, 52137 }, // ẵ
-    { 25, 40, 24, -2, 32, 250, 52281 }, // Ặ
-    { 18, 34, 20, 1, 26, 153, 52531 }, // ặ
-    { 21, 31, 21, -1, 23, 163, 52684 }, // Ẹ
-    { 14, 26, 16, 1, 18, 91, 52847 }, // ẹ
-    { 21, 34, 21, -1, 34, 179, 52938 }, // Ẻ
-    { 15, 30, 17, 1, 29, 113, 53117 }, // ẻ
-    { 21, 31, 21, -1, 31, 163, 53230 }, // Ẽ
-    { 15, 27, 17, 1, 26, 102, 53393 }, // ẽ
-    { 25, 35, 25, -1, 35, 219, 53495 }, // Ế
-    { 19, 33, 21, 1, 32, 157, 53714 }, // ế
-    { 22, 35, 22, -1, 35, 193, 53871 }, // Ề
-    { 16, 33, 18, 1, 32, 132, 54064 }, // ề
-    { 24, 35, 24, -1, 35, 210, 54196 }, // Ể
-    { 20, 33, 22, 1, 32, 165, 54406 }, // ể
-    { 21, 35, 21, -1, 35, 184, 54571 }, // Ễ
-    { 16, 32, 18, 1, 31, 128, 54755 }, // ễ
-    { 21, 40, 21, -1, 32, 210, 54883 }, // Ệ
-    { 15, 35, 17, 1, 27, 132, 55093 }, // ệ
-    { 15, 34, 15, -1, 34, 128, 55225 }, // Ỉ
-    { 12, 30, 14, 1, 29, 90, 55353 }, // ỉ
-    { 15, 31, 15, -1, 23, 117, 55443 }, // Ị
-    { 11, 34, 12, 0, 26, 94, 55560 }, // ị
-    { 23, 32, 25, 1, 24, 184, 55654 }, // Ọ
-    { 16, 26, 18, 1, 18, 104, 55838 }, // ọ
-    { 23, 35, 25, 1, 34, 202, 55942 }, // Ỏ
-    { 16, 30, 18, 1, 29, 120, 56144 }, // ỏ
-    { 24, 36, 26, 1, 35, 216, 56264 }, // Ố
-    { 21, 33, 23, 1, 32, 174, 56480 }, // ố
-    { 23, 36, 25, 1, 35, 207, 56654 }, // Ồ
-    { 18, 33, 20, 1, 32, 149, 56861 }, // ồ
-    { 24, 36, 26, 1, 35, 216, 57010 }, // Ổ
-    { 21, 33, 23, 1, 32, 174, 57226 }, // ổ
-    { 23, 36, 25, 1, 35, 207, 57400 }, // Ỗ
-    { 18, 32, 20, 1, 31, 144, 57607 }, // ỗ
-    { 23, 40, 25, 1, 32, 230, 57751 }, // Ộ
-    { 16, 35, 18, 1, 27, 140, 57981 }, // ộ
-    { 26, 33, 28, 1, 32, 215, 58121 }, // Ớ
-    { 19, 28, 21, 1, 27, 133, 58336 }, // ớ
-    { 26, 33, 28, 1, 32, 215, 58469 }, // Ờ
-    { 19, 28, 21, 1, 27, 133, 58684 }, // ờ
-    { 26, 35, 28, 1, 34, 228, 58817 }, // Ở
-    { 19, 30, 21, 1, 29, 143, 59045 }, // ở
-    { 26, 32, 28, 1, 31, 208, 59188 }, // Ỡ
-    { 19, 27, 21, 1, 26, 129, 59396 }, // ỡ
-    { 26, 36, 28, 1, 28, 234, 59525 }, // Ợ
-    { 19, 29, 21, 1, 21, 138, 59759 }, // ợ
-    { 24, 31, 28, 3, 23, 186, 59897 }, // Ụ
-    { 19, 26, 21, 1, 18, 124, 60083 }, // ụ
-    { 24, 35, 28, 3, 34, 210, 60207 }, // Ủ
-    { 19, 30, 21, 1, 29, 143, 60417 }, // ủ
-    { 26, 33, 30, 3, 32, 215, 60560 }, // Ứ
-    { 22, 28, 24, 1, 27, 154, 60775 }, // ứ
-    { 26, 33, 30, 3, 32, 215, 60929 }, // Ừ
-    { 22, 28, 24, 1, 27, 154, 61144 }, // ừ
-    { 26, 35, 30, 3, 34, 228, 61298 }, // Ử
-    { 22, 30, 24, 1, 29, 165, 61526 }, // ử
-    { 26, 32, 30, 3, 31, 208, 61691 }, // Ữ
-    { 22, 27, 24, 1, 26, 149, 61899 }, // ữ
-    { 26, 36, 30, 3, 28, 234, 62048 }, // Ự
-    { 22, 29, 24, 1, 21, 160, 62282 }, // ự
-    { 22, 32, 25, 2, 32, 176, 62442 }, // Ỳ
-    { 20, 35, 18, -3, 27, 175, 62618 }, // ỳ
-    { 22, 31, 25, 2, 23, 171, 62793 }, // Ỵ
-    { 20, 26, 18, -3, 18, 130, 62964 }, // ỵ
-    { 22, 34, 25, 2, 34, 187, 63094 }, // Ỷ
-    { 20, 37, 18, -3, 29, 185, 63281 }, // ỷ
-    { 22, 31, 25, 2, 31, 171, 63466 }, // Ỹ
-    { 20, 34, 18, -3, 26, 170, 63637 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 63807 }, //  
-    { 0, 0, 33, 0, 0, 0, 63807 }, //  
-    { 0, 0, 17, 0, 0, 0, 63807 }, //  
-    { 0, 0, 33, 0, 0, 0, 63807 }, //  
-    { 0, 0, 11, 0, 0, 0, 63807 }, //  
-    { 0, 0, 8, 0, 0, 0, 63807 }, //  
-    { 0, 0, 5, 0, 0, 0, 63807 }, //  
-    { 0, 0, 21, 0, 0, 0, 63807 }, //  
-    { 0, 0, 9, 0, 0, 0, 63807 }, //  
-    { 0, 0, 7, 0, 0, 0, 63807 }, //  
-    { 0, 0, 2, 0, 0, 0, 63807 }, //  
-    { 0, 0, 1, 0, 0, 0, 63807 }, // ​
-    { 2, 28, 2, -1, 20, 14, 63807 }, // ‌
-    { 8, 30, 5, -4, 22, 60, 63821 }, // ‍
-    { 12, 31, 7, -6, 23, 93, 63881 }, // ‎
-    { 12, 31, 7, -6, 23, 93, 63974 }, // ‏
-    { 11, 3, 13, 1, 10, 9, 64067 }, // ‐
-    { 11, 3, 13, 1, 10, 9, 64076 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 64085 }, // ‒
-    { 17, 3, 18, 0, 10, 13, 64097 }, // –
-    { 33, 3, 34, 0, 10, 25, 64110 }, // —
-    { 33, 3, 34, 0, 10, 25, 64135 }, // ―
-    { 11, 34, 17, 3, 26, 94, 64160 }, // ‖
-    { 17, 8, 18, 0, -1, 34, 64254 }, // ‗
-    { 7, 11, 11, 3, 25, 20, 64288 }, // ‘
-    { 7, 11, 10, 2, 25, 20, 64308 }, // ’
-    { 7, 10, 10, 1, 4, 18, 64328 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 64346 }, // ‛
-    { 13, 11, 17, 3, 25, 36, 64363 }, // “
-    { 14, 11, 17, 2, 25, 39, 64399 }, // ”
-    { 14, 10, 17, 1, 4, 35, 64438 }, // „
-    { 13, 11, 15, 1, 25, 36, 64473 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 64509 }, // †
-    { 16, 26, 17, 0, 24, 104, 64592 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 64696 }, // •
-    { 12, 12, 21, 4, 17, 36, 64710 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 64746 }, // ․
-    { 14, 6, 17, 1, 5, 21, 64753 }, // ‥
-    { 27, 6, 33, 3, 5, 41, 64774 }, // …
-    { 5, 6, 9, 2, 12, 8, 64815 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 64823 }, //  
-    { 0, 0, 1, 0, 0, 0, 64823 }, //  
-    { 12, 31, 7, -6, 23, 93, 64823 }, // ‪
-    { 12, 31, 7, -6, 23, 93, 64916 }, // ‫
-    { 10, 31, 6, -5, 23, 78, 65009 }, // ‬
-    { 14, 31, 8, -7, 23, 109, 65087 }, // ‭
-    { 14, 31, 8, -7, 23, 109, 65196 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 65305 }, //  
-    { 41, 26, 45, 2, 24, 267, 65305 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 65572 }, // ′
-    { 13, 11, 15, 1, 23, 36, 65592 }, // ″
-    { 20, 11, 22, 1, 23, 55, 65628 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 65683 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 65703 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 65742 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 65800 }, // ‸
-    { 9, 13, 11, 1, 15, 30, 65825 }, // ‹
-    { 10, 13, 11, 0, 15, 33, 65855 }, // ›
-    { 21, 23, 22, 0, 22, 121, 65888 }, // ※
-    { 19, 26, 21, 1, 25, 124, 66009 }, // ‼
-    { 17, 3, 18, 0, 27, 13, 66133 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 66146 }, // ⁃
-    { 20, 26, 15, -6, 24, 130, 66152 }, // ⁄
-    { 25, 25, 28, 2, 24, 157, 66282 }, // ⁇
-    { 22, 26, 25, 2, 25, 143, 66439 }, // ⁈
-    { 23, 26, 25, 1, 25, 150, 66582 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 66732 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 66761 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 66833 }, //  
-    { 0, 0, 1, 0, 0, 0, 66833 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 66833 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 66833 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 66833 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 66833 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 66833 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 66889 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 66945 }, // ⁵
-    { 13, 17, 16, 2, 28, 56, 66997 }, // ⁶
-    { 12, 16, 16, 3, 27, 48, 67053 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 67101 }, // ⁸
-    { 13, 17, 15, 0, 28, 56, 67157 }, // ⁹
-    { 13, 12, 19, 3, 23, 39, 67213 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 67252 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 67304 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 67344 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 67396 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 67444 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 67500 }, // ₅
-    { 13, 16, 16, 2, 11, 52, 67552 }, // ₆
-    { 12, 16, 16, 3, 11, 48, 67604 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 67652 }, // ₈
-    { 13, 16, 15, 0, 11, 52, 67704 }, // ₉
-    { 21, 23, 22, 0, 23, 121, 67756 }, // ₣
-    { 21, 24, 21, -1, 23, 126, 67877 }, // ₤
-    { 40, 24, 41, 0, 23, 240, 68003 }, // ₧
-    { 23, 24, 23, -1, 23, 138, 68243 }, // €
-    { 19, 13, 33, 7, 18, 62, 68381 }, // ←
-    { 13, 21, 33, 10, 22, 69, 68443 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 68512 }, // →
-    { 13, 21, 33, 10, 22, 69, 68574 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 68643 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 68712 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 68787 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 68870 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 68939 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 69008 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 69080 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 69152 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 69224 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 69296 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 69368 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 69447 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 69585 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 69700 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 69787 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 69956 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 70076 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 70202 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 70323 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 70476 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 70576 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 70697 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 70850 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 70950 }, // ∏
-    { 20, 29, 21, 0, 23, 145, 71132 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 71277 }, // −
-    { 19, 26, 19, -1, 24, 124, 71289 }, // ∕
-    { 13, 26, 16, 2, 24, 85, 71413 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 71498 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 71558 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 71594 }, // ∙
-    { 21, 31, 22, 0, 27, 163, 71603 }, // √
-    { 16, 13, 21, 2, 17, 52, 71766 }, // ∝
-    { 21, 11, 22, 0, 16, 58, 71818 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 71876 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 71997 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 72130 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 72164 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 72249 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 72370 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 72491 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 72605 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 72719 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 72872 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 72972 }, // ∵
-    { 7, 18, 10, 1, 20, 32, 73072 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 73104 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 73204 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 73233 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 73319 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 73367 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 73420 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 73477 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 73549 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 73624 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 73699 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 73807 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 73915 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 74015 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 74168 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 74321 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 74442 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 74563 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 74720 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 74877 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 75034 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 75191 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 75301 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 75310 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 75351 }, // �
+    { 10, 26, 12, 1, 25, 37, 0 }, // !
+    { 12, 11, 14, 1, 24, 31, 37 }, // "
+    { 21, 21, 22, 0, 19, 81, 68 }, // #
+    { 18, 34, 21, 1, 27, 104, 149 }, // $
+    { 28, 26, 32, 2, 24, 128, 253 }, // %
+    { 26, 26, 30, 2, 24, 117, 381 }, // &
+    { 6, 11, 8, 1, 24, 16, 498 }, // '
+    { 15, 34, 17, 1, 27, 68, 514 }, // (
+    { 15, 34, 13, -3, 27, 69, 582 }, // )
+    { 12, 11, 14, 1, 24, 31, 651 }, // *
+    { 15, 15, 21, 3, 19, 36, 682 }, // +
+    { 8, 11, 10, -1, 5, 16, 718 }, // ,
+    { 11, 3, 13, 1, 10, 8, 734 }, // -
+    { 5, 6, 10, 2, 5, 8, 742 }, // .
+    { 19, 26, 19, -1, 24, 54, 750 }, // /
+    { 20, 24, 21, 0, 23, 79, 804 }, // 0
+    { 13, 23, 21, 2, 23, 49, 883 }, // 1
+    { 19, 23, 21, 0, 23, 60, 932 }, // 2
+    { 18, 24, 21, 0, 23, 62, 992 }, // 3
+    { 19, 23, 21, 0, 23, 70, 1054 }, // 4
+    { 18, 24, 21, 1, 23, 62, 1124 }, // 5
+    { 20, 24, 22, 1, 23, 68, 1186 }, // 6
+    { 17, 24, 22, 4, 23, 66, 1254 }, // 7
+    { 18, 24, 21, 1, 23, 74, 1320 }, // 8
+    { 19, 24, 21, 0, 23, 69, 1394 }, // 9
+    { 8, 18, 11, 2, 17, 20, 1463 }, // :
+    { 11, 23, 11, -1, 17, 30, 1483 }, // ;
+    { 15, 16, 21, 3, 19, 36, 1513 }, // <
+    { 15, 9, 21, 3, 16, 30, 1549 }, // =
+    { 15, 16, 21, 3, 19, 35, 1579 }, // >
+    { 12, 25, 15, 2, 24, 45, 1614 }, // ?
+    { 30, 30, 32, 1, 23, 151, 1659 }, // @
+    { 25, 24, 24, -2, 24, 88, 1810 }, // A
+    { 20, 25, 20, -1, 24, 78, 1898 }, // B
+    { 20, 25, 22, 1, 24, 72, 1976 }, // C
+    { 24, 25, 24, -1, 24, 88, 2048 }, // D
+    { 21, 23, 21, -1, 23, 76, 2136 }, // E
+    { 20, 23, 20, -1, 23, 63, 2212 }, // F
+    { 21, 25, 23, 1, 24, 84, 2275 }, // G
+    { 29, 23, 29, -1, 23, 101, 2359 }, // H
+    { 15, 23, 15, -1, 23, 49, 2460 }, // I
+    { 20, 30, 15, -6, 23, 68, 2509 }, // J
+    { 25, 24, 25, -1, 23, 89, 2577 }, // K
+    { 19, 23, 19, -1, 23, 61, 2666 }, // L
+    { 32, 23, 31, -2, 23, 125, 2727 }, // M
+    { 28, 24, 28, -1, 23, 104, 2852 }, // N
+    { 23, 25, 25, 1, 24, 86, 2956 }, // O
+    { 20, 24, 20, -1, 24, 68, 3042 }, // P
+    { 28, 32, 30, 1, 24, 117, 3110 }, // Q
+    { 22, 25, 22, -1, 24, 87, 3227 }, // R
+    { 17, 25, 18, 0, 24, 72, 3314 }, // S
+    { 20, 23, 23, 2, 23, 67, 3386 }, // T
+    { 24, 24, 28, 3, 23, 88, 3453 }, // U
+    { 24, 24, 27, 2, 23, 82, 3541 }, // V
+    { 34, 24, 37, 2, 23, 128, 3623 }, // W
+    { 27, 23, 25, -3, 23, 84, 3751 }, // X
+    { 22, 23, 25, 2, 23, 72, 3835 }, // Y
+    { 20, 24, 20, -1, 23, 70, 3907 }, // Z
+    { 14, 32, 13, -2, 26, 64, 3977 }, // [
+    { 13, 26, 16, 2, 24, 53, 4041 }, // <backslash>
+    { 14, 32, 13, -2, 26, 65, 4094 }, // ]
+    { 16, 15, 21, 2, 21, 43, 4159 }, // ^
+    { 17, 3, 18, 0, -1, 14, 4202 }, // _
+    { 7, 8, 20, 7, 27, 11, 4216 }, // `
+    { 18, 19, 20, 1, 18, 66, 4227 }, // a
+    { 17, 27, 18, 0, 26, 79, 4293 }, // b
+    { 13, 19, 15, 1, 18, 44, 4372 }, // c
+    { 18, 27, 20, 1, 26, 83, 4416 }, // d
+    { 14, 19, 16, 1, 18, 52, 4499 }, // e
+    { 24, 34, 19, -6, 26, 97, 4551 }, // f
+    { 22, 26, 20, -3, 18, 90, 4648 }, // g
+    { 18, 27, 20, 1, 26, 80, 4738 }, // h
+    { 10, 27, 12, 1, 26, 42, 4818 }, // i
+    { 17, 34, 12, -6, 26, 70, 4860 }, // j
+    { 16, 27, 18, 1, 26, 80, 4930 }, // k
+    { 9, 27, 11, 1, 26, 46, 5010 }, // l
+    { 28, 19, 30, 1, 18, 101, 5056 }, // m
+    { 19, 19, 21, 1, 18, 71, 5157 }, // n
+    { 16, 19, 18, 1, 18, 56, 5228 }, // o
+    { 20, 26, 19, -2, 18, 87, 5284 }, // p
+    { 17, 26, 19, 1, 18, 80, 5371 }, // q
+    { 14, 18, 16, 1, 18, 44, 5451 }, // r
+    { 13, 19, 14, 0, 18, 47, 5495 }, // s
+    { 12, 23, 14, 1, 22, 50, 5542 }, // t
+    { 19, 19, 21, 1, 18, 66, 5592 }, // u
+    { 17, 19, 18, 0, 18, 54, 5658 }, // v
+    { 25, 19, 26, 0, 18, 87, 5712 }, // w
+    { 20, 19, 20, -1, 18, 60, 5799 }, // x
+    { 20, 26, 18, -3, 18, 80, 5859 }, // y
+    { 16, 19, 17, 0, 18, 50, 5939 }, // z
+    { 13, 33, 15, 1, 27, 65, 5989 }, // {
+    { 10, 30, 11, 0, 26, 45, 6054 }, // |
+    { 13, 33, 13, -1, 27, 63, 6099 }, // }
+    { 16, 6, 21, 2, 14, 22, 6162 }, // ~
+    { 0, 0, 7, 0, 0, 0, 6184 }, //  
+    { 10, 26, 10, -1, 18, 37, 6184 }, // ¡
+    { 17, 33, 21, 2, 26, 84, 6221 }, // ¢
+    { 21, 24, 21, -1, 23, 73, 6305 }, // £
+    { 21, 16, 22, 0, 19, 57, 6378 }, // ¤
+    { 22, 23, 24, 1, 23, 80, 6435 }, // ¥
+    { 10, 30, 11, 0, 26, 40, 6515 }, // ¦
+    { 15, 26, 16, 0, 23, 78, 6555 }, // §
+    { 12, 5, 20, 4, 25, 15, 6633 }, // ¨
+    { 25, 25, 26, 0, 24, 117, 6648 }, // ©
+    { 13, 16, 15, 1, 24, 47, 6765 }, // ª
+    { 16, 13, 18, 1, 15, 40, 6812 }, // «
+    { 15, 8, 21, 3, 15, 21, 6852 }, // ¬
+    { 11, 3, 13, 1, 10, 8, 6873 }, // ­
+    { 19, 18, 20, 0, 26, 84, 6881 }, // ®
+    { 11, 4, 20, 5, 24, 11, 6965 }, // ¯
+    { 12, 11, 17, 3, 23, 31, 6976 }, // °
+    { 15, 20, 21, 3, 20, 50, 7007 }, // ±
+    { 13, 16, 15, 1, 28, 40, 7057 }, // ²
+    { 12, 17, 15, 1, 28, 35, 7097 }, // ³
+    { 7, 8, 20, 7, 27, 11, 7132 }, // ´
+    { 21, 26, 21, -1, 18, 85, 7143 }, // µ
+    { 21, 28, 21, -1, 23, 101, 7228 }, // ¶
+    { 6, 6, 10, 2, 12, 6, 7329 }, // ·
+    { 8, 8, 20, 6, -1, 13, 7335 }, // ¸
+    { 10, 16, 15, 2, 28, 29, 7348 }, // ¹
+    { 13, 16, 15, 1, 24, 39, 7377 }, // º
+    { 16, 13, 17, 0, 15, 39, 7416 }, // »
+    { 32, 26, 36, 2, 24, 122, 7455 }, // ¼
+    { 32, 26, 36, 2, 24, 122, 7577 }, // ½
+    { 33, 26, 36, 1, 24, 132, 7699 }, // ¾
+    { 11, 25, 14, 0, 18, 45, 7831 }, // ¿
+    { 25, 32, 24, -2, 32, 106, 7876 }, // À
+    { 25, 32, 24, -2, 32, 110, 7982 }, // Á
+    { 25, 32, 24, -2, 32, 109, 8092 }, // Â
+    { 25, 31, 24, -2, 31, 109, 8201 }, // Ã
+    { 25, 31, 24, -2, 31, 105, 8310 }, // Ä
+    { 25, 33, 24, -2, 33, 118, 8415 }, // Å
+    { 33, 23, 31, -3, 23, 115, 8533 }, // Æ
+    { 20, 33, 22, 1, 24, 91, 8648 }, // Ç
+    { 21, 32, 21, -1, 32, 95, 8739 }, // È
+    { 21, 32, 21, -1, 32, 95, 8834 }, // É
+    { 21, 32, 21, -1, 32, 97, 8929 }, // Ê
+    { 21, 31, 21, -1, 31, 97, 9026 }, // Ë
+    { 15, 32, 15, -1, 32, 64, 9123 }, // Ì
+    { 16, 32, 16, -1, 32, 66, 9187 }, // Í
+    { 16, 32, 16, -1, 32, 68, 9253 }, // Î
+    { 17, 31, 17, -1, 31, 65, 9321 }, // Ï
+    { 24, 25, 24, -1, 24, 94, 9386 }, // Ð
+    { 28, 32, 28, -1, 31, 131, 9480 }, // Ñ
+    { 23, 33, 25, 1, 32, 105, 9611 }, // Ò
+    { 23, 33, 25, 1, 32, 106, 9716 }, // Ó
+    { 23, 33, 25, 1, 32, 109, 9822 }, // Ô
+    { 23, 32, 25, 1, 31, 106, 9931 }, // Õ
+    { 23, 32, 25, 1, 31, 107, 10037 }, // Ö
+    { 14, 14, 21, 3, 18, 36, 10144 }, // ×
+    { 26, 25, 26, -1, 24, 106, 10180 }, // Ø
+    { 24, 33, 28, 3, 32, 109, 10286 }, // Ù
+    { 24, 33, 28, 3, 32, 110, 10395 }, // Ú
+    { 24, 33, 28, 3, 32, 112, 10505 }, // Û
+    { 24, 32, 28, 3, 31, 112, 10617 }, // Ü
+    { 22, 32, 25, 2, 32, 91, 10729 }, // Ý
+    { 20, 23, 20, -1, 23, 66, 10820 }, // Þ
+    { 25, 34, 21, -5, 26, 127, 10886 }, // ß
+    { 18, 28, 20, 1, 27, 82, 11013 }, // à
+    { 18, 28, 20, 1, 27, 85, 11095 }, // á
+    { 18, 28, 20, 1, 27, 91, 11180 }, // â
+    { 18, 27, 20, 1, 26, 86, 11271 }, // ã
+    { 18, 26, 20, 1, 25, 84, 11357 }, // ä
+    { 18, 29, 20, 1, 28, 93, 11441 }, // å
+    { 24, 19, 26, 1, 18, 85, 11534 }, // æ
+    { 13, 27, 15, 1, 18, 60, 11619 }, // ç
+    { 14, 28, 16, 1, 27, 67, 11679 }, // è
+    { 15, 28, 17, 1, 27, 67, 11746 }, // é
+    { 15, 28, 17, 1, 27, 74, 11813 }, // ê
+    { 16, 26, 18, 1, 25, 70, 11887 }, // ë
+    { 9, 28, 11, 1, 27, 44, 11957 }, // ì
+    { 12, 28, 14, 1, 27, 50, 12001 }, // í
+    { 12, 28, 14, 1, 27, 55, 12051 }, // î
+    { 13, 26, 15, 1, 25, 56, 12106 }, // ï
+    { 16, 28, 18, 1, 27, 82, 12162 }, // ð
+    { 19, 27, 21, 1, 26, 92, 12244 }, // ñ
+    { 16, 28, 18, 1, 27, 72, 12336 }, // ò
+    { 16, 28, 18, 1, 27, 75, 12408 }, // ó
+    { 16, 28, 18, 1, 27, 78, 12483 }, // ô
+    { 17, 27, 19, 1, 26, 77, 12561 }, // õ
+    { 17, 26, 19, 1, 25, 75, 12638 }, // ö
+    { 15, 16, 21, 3, 19, 37, 12713 }, // ÷
+    { 21, 19, 20, -2, 18, 72, 12750 }, // ø
+    { 19, 28, 21, 1, 27, 85, 12822 }, // ù
+    { 19, 28, 21, 1, 27, 85, 12907 }, // ú
+    { 19, 28, 21, 1, 27, 90, 12992 }, // û
+    { 19, 26, 21, 1, 25, 84, 13082 }, // ü
+    { 20, 35, 18, -3, 27, 99, 13166 }, // ý
+    { 20, 34, 18, -3, 26, 102, 13265 }, // þ
+    { 20, 33, 18, -3, 25, 100, 13367 }, // ÿ
+    { 25, 30, 24, -2, 30, 104, 13467 }, // Ā
+    { 18, 25, 20, 1, 24, 80, 13571 }, // ā
+    { 25, 32, 24, -2, 32, 110, 13651 }, // Ă
+    { 18, 27, 20, 1, 26, 85, 13761 }, // ă
+    { 25, 31, 24, -2, 24, 107, 13846 }, // Ą
+    { 18, 25, 20, 1, 18, 78, 13953 }, // ą
+    { 20, 33, 22, 1, 32, 89, 14031 }, // Ć
+    { 15, 28, 17, 1, 27, 60, 14120 }, // ć
+    { 20, 33, 22, 1, 32, 93, 14180 }, // Ĉ
+    { 15, 28, 17, 1, 27, 67, 14273 }, // ĉ
+    { 20, 32, 22, 1, 31, 86, 14340 }, // Ċ
+    { 13, 26, 15, 1, 25, 54, 14426 }, // ċ
+    { 21, 33, 23, 1, 32, 102, 14480 }, // Č
+    { 16, 28, 18, 1, 27, 68, 14582 }, // č
+    { 24, 33, 24, -1, 32, 112, 14650 }, // Ď
+    { 24, 30, 26, 1, 29, 109, 14762 }, // ď
+    { 24, 25, 24, -1, 24, 94, 14871 }, // Đ
+    { 20, 27, 22, 1, 26, 90, 14965 }, // đ
+    { 21, 30, 21, -1, 30, 92, 15055 }, // Ē
+    { 15, 25, 17, 1, 24, 64, 15147 }, // ē
+    { 21, 32, 21, -1, 32, 98, 15211 }, // Ĕ
+    { 16, 27, 18, 1, 26, 69, 15309 }, // ĕ
+    { 21, 31, 21, -1, 31, 92, 15378 }, // Ė
+    { 14, 26, 16, 1, 25, 63, 15470 }, // ė
+    { 21, 30, 21, -1, 23, 93, 15533 }, // Ę
+    { 14, 25, 16, 1, 18, 66, 15626 }, // ę
+    { 22, 32, 22, -1, 32, 102, 15692 }, // Ě
+    { 16, 28, 18, 1, 27, 75, 15794 }, // ě
+    { 21, 33, 24, 2, 32, 106, 15869 }, // Ĝ
+    { 22, 35, 20, -3, 27, 117, 15975 }, // ĝ
+    { 21, 33, 24, 2, 32, 105, 16092 }, // Ğ
+    { 22, 34, 20, -3, 26, 110, 16197 }, // ğ
+    { 21, 32, 24, 2, 31, 99, 16307 }, // Ġ
+    { 22, 33, 20, -3, 25, 105, 16406 }, // ġ
+    { 21, 33, 24, 2, 24, 104, 16511 }, // Ģ
+    { 22, 36, 20, -3, 28, 115, 16615 }, // ģ
+    { 29, 32, 29, -1, 32, 127, 16730 }, // Ĥ
+    { 18, 35, 20, 1, 34, 102, 16857 }, // ĥ
+    { 29, 23, 29, -1, 23, 102, 16959 }, // Ħ
+    { 18, 27, 20, 1, 26, 86, 17061 }, // ħ
+    { 16, 31, 16, -1, 31, 69, 17147 }, // Ĩ
+    { 13, 27, 15, 1, 26, 57, 17216 }, // ĩ
+    { 16, 30, 16, -1, 30, 63, 17273 }, // Ī
+    { 13, 25, 15, 1, 24, 52, 17336 }, // ī
+    { 16, 32, 16, -1, 32, 68, 17388 }, // Ĭ
+    { 13, 27, 15, 1, 26, 56, 17456 }, // ĭ
+    { 15, 30, 15, -1, 23, 66, 17512 }, // Į
+    { 10, 33, 12, 1, 26, 54, 17578 }, // į
+    { 15, 31, 15, -1, 31, 62, 17632 }, // İ
+    { 9, 19, 11, 1, 18, 33, 17694 }, // ı
+    { 27, 30, 27, -1, 23, 112, 17727 }, // Ĳ
+    { 20, 34, 22, 1, 26, 101, 17839 }, // ĳ
+    { 22, 39, 17, -6, 32, 100, 17940 }, // Ĵ
+    { 19, 35, 14, -6, 27, 86, 18040 }, // ĵ
+    { 25, 32, 25, -1, 23, 108, 18126 }, // Ķ
+    { 16, 35, 18, 1, 26, 97, 18234 }, // ķ
+    { 17, 19, 19, 1, 18, 65, 18331 }, // ĸ
+    { 19, 32, 19, -1, 32, 79, 18396 }, // Ĺ
+    { 12, 35, 14, 1, 34, 64, 18475 }, // ĺ
+    { 19, 32, 19, -1, 23, 77, 18539 }, // Ļ
+    { 11, 35, 11, -1, 26, 60, 18616 }, // ļ
+    { 20, 26, 20, -1, 26, 76, 18676 }, // Ľ
+    { 15, 30, 17, 1, 29, 70, 18752 }, // ľ
+    { 20, 23, 20, -1, 23, 66, 18822 }, // Ŀ
+    { 14, 27, 16, 1, 26, 60, 18888 }, // ŀ
+    { 19, 23, 19, -1, 23, 69, 18948 }, // Ł
+    { 13, 27, 13, -1, 26, 59, 19017 }, // ł
+    { 28, 33, 28, -1, 32, 127, 19076 }, // Ń
+    { 19, 28, 21, 1, 27, 89, 19203 }, // ń
+    { 28, 32, 28, -1, 23, 125, 19292 }, // Ņ
+    { 19, 27, 21, 1, 18, 88, 19417 }, // ņ
+    { 28, 33, 28, -1, 32, 129, 19505 }, // Ň
+    { 19, 28, 21, 1, 27, 95, 19634 }, // ň
+    { 25, 26, 28, 2, 25, 98, 19729 }, // ŉ
+    { 28, 30, 28, -1, 23, 123, 19827 }, // Ŋ
+    { 17, 26, 19, 1, 18, 84, 19950 }, // ŋ
+    { 23, 31, 25, 1, 30, 101, 20034 }, // Ō
+    { 17, 25, 19, 1, 24, 71, 20135 }, // ō
+    { 23, 33, 25, 1, 32, 107, 20206 }, // Ŏ
+    { 17, 27, 19, 1, 26, 76, 20313 }, // ŏ
+    { 24, 34, 26, 1, 33, 116, 20389 }, // Ő
+    { 19, 28, 21, 1, 27, 87, 20505 }, // ő
+    { 31, 24, 33, 1, 23, 118, 20592 }, // Œ
+    { 25, 19, 27, 1, 18, 87, 20710 }, // œ
+    { 22, 33, 22, -1, 32, 104, 20797 }, // Ŕ
+    { 14, 27, 16, 1, 27, 60, 20901 }, // ŕ
+    { 22, 33, 22, -1, 24, 105, 20961 }, // Ŗ
+    { 16, 27, 16, -1, 18, 64, 21066 }, // ŗ
+    { 22, 33, 22, -1, 32, 110, 21130 }, // Ř
+    { 16, 27, 18, 1, 27, 64, 21240 }, // ř
+    { 17, 33, 18, 0, 32, 88, 21304 }, // Ś
+    { 15, 28, 16, 0, 27, 61, 21392 }, // ś
+    { 17, 33, 18, 0, 32, 91, 21453 }, // Ŝ
+    { 15, 28, 16, 0, 27, 67, 21544 }, // ŝ
+    { 17, 33, 18, 0, 24, 89, 21611 }, // Ş
+    { 13, 27, 14, 0, 18, 63, 21700 }, // ş
+    { 18, 33, 19, 0, 32, 93, 21763 }, // Š
+    { 16, 28, 17, 0, 27, 69, 21856 }, // š
+    { 20, 32, 23, 2, 23, 86, 21925 }, // Ţ
+    { 13, 31, 14, 0, 22, 71, 22011 }, // ţ
+    { 20, 32, 23, 2, 32, 92, 22082 }, // Ť
+    { 14, 28, 16, 1, 27, 67, 22174 }, // ť
+    { 20, 23, 23, 2, 23, 74, 22241 }, // Ŧ
+    { 13, 23, 14, 0, 22, 61, 22315 }, // ŧ
+    { 24, 32, 28, 3, 31, 111, 22376 }, // Ũ
+    { 19, 27, 21, 1, 26, 90, 22487 }, // ũ
+    { 24, 31, 28, 3, 30, 105, 22577 }, // Ū
+    { 19, 25, 21, 1, 24, 81, 22682 }, // ū
+    { 24, 33, 28, 3, 32, 113, 22763 }, // Ŭ
+    { 19, 27, 21, 1, 26, 85, 22876 }, // ŭ
+    { 24, 34, 28, 3, 33, 120, 22961 }, // Ů
+    { 19, 29, 21, 1, 28, 92, 23081 }, // ů
+    { 24, 34, 28, 3, 33, 119, 23173 }, // Ű
+    { 19, 28, 21, 1, 27, 94, 23292 }, // ű
+    { 24, 30, 28, 3, 23, 105, 23386 }, // Ų
+    { 19, 25, 21, 1, 18, 79, 23491 }, // ų
+    { 34, 33, 37, 2, 32, 157, 23570 }, // Ŵ
+    { 25, 28, 26, 0, 27, 115, 23727 }, // ŵ
+    { 22, 32, 25, 2, 32, 97, 23842 }, // Ŷ
+    { 20, 35, 18, -3, 27, 106, 23939 }, // ŷ
+    { 22, 31, 25, 2, 31, 93, 24045 }, // Ÿ
+    { 20, 33, 20, -1, 32, 89, 24138 }, // Ź
+    { 16, 28, 17, 0, 27, 64, 24227 }, // ź
+    { 20, 32, 20, -1, 31, 85, 24291 }, // Ż
+    { 16, 26, 17, 0, 25, 63, 24376 }, // ż
+    { 20, 33, 20, -1, 32, 94, 24439 }, // Ž
+    { 16, 28, 17, 0, 27, 71, 24533 }, // ž
+    { 24, 34, 19, -6, 26, 91, 24604 }, // ſ
+    { 26, 29, 28, 1, 28, 100, 24695 }, // Ơ
+    { 19, 22, 21, 1, 21, 66, 24795 }, // ơ
+    { 21, 24, 22, 0, 24, 77, 24861 }, // Ƥ
+    { 20, 34, 19, -2, 26, 109, 24938 }, // ƥ
+    { 12, 30, 14, 1, 22, 69, 25047 }, // ƫ
+    { 20, 23, 23, 2, 23, 67, 25116 }, // Ƭ
+    { 15, 27, 17, 1, 26, 67, 25183 }, // ƭ
+    { 20, 30, 23, 2, 23, 85, 25250 }, // Ʈ
+    { 26, 29, 30, 3, 28, 104, 25335 }, // Ư
+    { 22, 22, 24, 1, 21, 81, 25439 }, // ư
+    { 7, 8, 3, -5, 27, 11, 25520 }, // ̀
+    { 7, 8, 6, -2, 27, 12, 25531 }, // ́
+    { 11, 8, 6, -6, 27, 21, 25543 }, // ̂
+    { 12, 6, 7, -6, 26, 17, 25564 }, // ̃
+    { 10, 4, 6, -5, 24, 9, 25581 }, // ̄
+    { 11, 6, 7, -5, 26, 15, 25590 }, // ̆
+    { 6, 5, 4, -3, 25, 8, 25605 }, // ̇
+    { 12, 5, 7, -6, 25, 15, 25613 }, // ̈
+    { 9, 10, 6, -4, 29, 20, 25628 }, // ̉
+    { 8, 10, 5, -4, 28, 18, 25648 }, // ̊
+    { 13, 8, 8, -6, 27, 24, 25666 }, // ̋
+    { 11, 8, 7, -5, 27, 20, 25690 }, // ̌
+    { 10, 8, 4, -7, 27, 22, 25710 }, // ̏
+    { 11, 7, 6, -6, 26, 17, 25732 }, // ̑
+    { 6, 9, 4, -3, 28, 15, 25749 }, // ̒
+    { 7, 10, 5, -3, 29, 15, 25764 }, // ̓
+    { 6, 10, 3, -4, 29, 16, 25779 }, // ̔
+    { 5, 9, 3, -3, 29, 12, 25795 }, // ̕
+    { 6, 8, 4, -3, 21, 13, 25807 }, // ̛
+    { 6, 6, 4, -3, -2, 5, 25820 }, // ̣
+    { 12, 5, 7, -6, -3, 15, 25825 }, // ̤
+    { 8, 8, 5, -4, -1, 20, 25840 }, // ̥
+    { 7, 8, 4, -4, -1, 11, 25860 }, // ̦
+    { 8, 8, 5, -4, -1, 13, 25871 }, // ̧
+    { 7, 8, 4, -4, 1, 14, 25884 }, // ̨
+    { 5, 8, 9, -1, -1, 11, 25898 }, // ̩
+    { 11, 7, 6, -6, -2, 18, 25909 }, // ̭
+    { 11, 7, 6, -6, -1, 17, 25927 }, // ̮
+    { 12, 6, 7, -6, -2, 18, 25944 }, // ̰
+    { 10, 3, 6, -5, -3, 8, 25962 }, // ̱
+    { 11, 7, 6, -6, 26, 17, 25970 }, // ͂
+    { 12, 13, 6, -7, 33, 26, 25987 }, // ̈́
+    { 6, 6, 5, -2, -2, 12, 26013 }, // ͅ
+    { 25, 24, 24, -2, 24, 88, 26025 }, // Α
+    { 20, 25, 20, -1, 24, 78, 26113 }, // Β
+    { 21, 23, 21, -1, 23, 65, 26191 }, // Γ
+    { 20, 24, 22, 0, 24, 81, 26256 }, // Δ
+    { 21, 23, 21, -1, 23, 76, 26337 }, // Ε
+    { 20, 24, 20, -1, 23, 70, 26413 }, // Ζ
+    { 29, 23, 29, -1, 23, 101, 26483 }, // Η
+    { 23, 25, 25, 1, 24, 93, 26584 }, // Θ
+    { 15, 23, 15, -1, 23, 49, 26677 }, // Ι
+    { 25, 24, 25, -1, 23, 89, 26726 }, // Κ
+    { 25, 24, 24, -2, 24, 82, 26815 }, // Λ
+    { 32, 23, 31, -2, 23, 125, 26897 }, // Μ
+    { 28, 24, 28, -1, 23, 104, 27022 }, // Ν
+    { 22, 23, 22, -1, 23, 69, 27126 }, // Ξ
+    { 23, 25, 25, 1, 24, 86, 27195 }, // Ο
+    { 27, 23, 27, -1, 23, 95, 27281 }, // Π
+    { 20, 24, 20, -1, 24, 68, 27376 }, // Ρ
+    { 21, 24, 21, -1, 23, 70, 27444 }, // Σ
+    { 20, 23, 23, 2, 23, 67, 27514 }, // Τ
+    { 22, 24, 24, 1, 24, 72, 27581 }, // Υ
+    { 24, 25, 25, 0, 24, 105, 27653 }, // Φ
+    { 27, 23, 25, -3, 23, 84, 27758 }, // Χ
+    { 25, 24, 28, 2, 24, 90, 27842 }, // Ψ
+    { 26, 24, 26, -1, 24, 99, 27932 }, // Ω
+    { 19, 19, 21, 1, 18, 70, 28031 }, // α
+    { 17, 34, 18, 0, 26, 96, 28101 }, // β
+    { 17, 26, 18, 0, 18, 71, 28197 }, // γ
+    { 17, 27, 19, 1, 26, 75, 28268 }, // δ
+    { 14, 19, 16, 1, 18, 48, 28343 }, // ε
+    { 14, 35, 16, 1, 28, 76, 28391 }, // ζ
+    { 16, 26, 19, 1, 18, 78, 28467 }, // η
+    { 17, 27, 20, 2, 26, 84, 28545 }, // θ
+    { 8, 19, 10, 1, 18, 31, 28629 }, // ι
+    { 18, 19, 20, 1, 18, 69, 28660 }, // κ
+    { 19, 27, 18, -2, 26, 74, 28729 }, // λ
+    { 21, 26, 21, -1, 18, 85, 28803 }, // μ
+    { 17, 19, 18, 0, 18, 54, 28888 }, // ν
+    { 14, 35, 16, 1, 28, 74, 28942 }, // ξ
+    { 16, 19, 18, 1, 18, 55, 29016 }, // ο
+    { 20, 19, 21, 0, 18, 67, 29071 }, // π
+    { 18, 26, 18, -1, 18, 73, 29138 }, // ρ
+    { 13, 25, 15, 1, 18, 54, 29211 }, // ς
+    { 19, 19, 21, 1, 18, 58, 29265 }, // σ
+    { 16, 19, 18, 1, 18, 44, 29323 }, // τ
+    { 17, 19, 19, 1, 18, 53, 29367 }, // υ
+    { 21, 26, 23, 1, 18, 97, 29420 }, // φ
+    { 20, 26, 19, -2, 18, 81, 29517 }, // χ
+    { 23, 32, 25, 1, 24, 113, 29598 }, // ψ
+    { 22, 19, 24, 1, 18, 77, 29711 }, // ω
+    { 25, 32, 24, -2, 24, 103, 29788 }, // Ạ
+    { 18, 26, 20, 1, 18, 76, 29891 }, // ạ
+    { 25, 34, 24, -2, 34, 115, 29967 }, // Ả
+    { 18, 30, 20, 1, 29, 94, 30082 }, // ả
+    { 27, 35, 26, -2, 35, 124, 30176 }, // Ấ
+    { 21, 33, 23, 1, 32, 107, 30300 }, // ấ
+    { 25, 35, 24, -2, 35, 119, 30407 }, // Ầ
+    { 18, 33, 20, 1, 32, 99, 30526 }, // ầ
+    { 26, 35, 25, -2, 35, 123, 30625 }, // Ẩ
+    { 21, 33, 23, 1, 32, 113, 30748 }, // ẩ
+    { 25, 35, 24, -2, 35, 123, 30861 }, // Ẫ
+    { 18, 32, 20, 1, 31, 104, 30984 }, // ẫ
+    { 25, 40, 24, -2, 32, 124, 31088 }, // Ậ
+    { 18, 35, 20, 1, 27, 101, 31212 }, // ậ
+    { 25, 35, 24, -2, 35, 119, 31313 }, // Ắ
+    { 18, 33, 20, 1, 32, 98, 31432 }, // ắ
+    { 25, 35, 24, -2, 35, 119, 31530 }, // Ằ
+    { 18, 33, 20, 1, 32, 96, 31649 }, // ằ
+    { 25, 35, 24, -2, 35, 123, 31745 }, // Ẳ
+    { 18, 34, 20, 1, 33, 104, 31868 }, // ẳ
+    { 25, 35, 24, -2, 35, 123, 31972 }, // Ẵ
+    { 18, 32, 20, 1, 31, 105, 32095 }, // ẵ
+    { 25, 40, 24, -2, 32, 125, 32200 }, // Ặ
+    { 18, 34, 20, 1, 26, 95, 32325 }, // ặ
+    { 21, 31, 21, -1, 23, 92, 32420 }, // Ẹ
+    { 14, 26, 16, 1, 18, 64, 32512 }, // ẹ
+    { 21, 34, 21, -1, 34, 99, 32576 }, // Ẻ
+    { 15, 30, 17, 1, 29, 77, 32675 }, // ẻ
+    { 21, 31, 21, -1, 31, 96, 32752 }, // Ẽ
+    { 15, 27, 17, 1, 26, 71, 32848 }, // ẽ
+    { 25, 35, 25, -1, 35, 114, 32919 }, // Ế
+    { 19, 33, 21, 1, 32, 90, 33033 }, // ế
+    { 22, 35, 22, -1, 35, 107, 33123 }, // Ề
+    { 16, 33, 18, 1, 32, 84, 33230 }, // ề
+    { 24, 35, 24, -1, 35, 117, 33314 }, // Ể
+    { 20, 33, 22, 1, 32, 98, 33431 }, // ể
+    { 21, 35, 21, -1, 35, 110, 33529 }, // Ễ
+    { 16, 32, 18, 1, 31, 89, 33639 }, // ễ
+    { 21, 40, 21, -1, 32, 113, 33728 }, // Ệ
+    { 15, 35, 17, 1, 27, 87, 33841 }, // ệ
+    { 15, 34, 15, -1, 34, 70, 33928 }, // Ỉ
+    { 12, 30, 14, 1, 29, 57, 33998 }, // ỉ
+    { 15, 31, 15, -1, 23, 61, 34055 }, // Ị
+    { 11, 34, 12, 0, 26, 52, 34116 }, // ị
+    { 23, 32, 25, 1, 24, 103, 34168 }, // Ọ
+    { 16, 26, 18, 1, 18, 69, 34271 }, // ọ
+    { 23, 35, 25, 1, 34, 110, 34340 }, // Ỏ
+    { 16, 30, 18, 1, 29, 82, 34450 }, // ỏ
+    { 24, 36, 26, 1, 35, 118, 34532 }, // Ố
+    { 21, 33, 23, 1, 32, 98, 34650 }, // ố
+    { 23, 36, 25, 1, 35, 116, 34748 }, // Ồ
+    { 18, 33, 20, 1, 32, 91, 34864 }, // ồ
+    { 24, 36, 26, 1, 35, 121, 34955 }, // Ổ
+    { 21, 33, 23, 1, 32, 105, 35076 }, // ổ
+    { 23, 36, 25, 1, 35, 119, 35181 }, // Ỗ
+    { 18, 32, 20, 1, 31, 95, 35300 }, // ỗ
+    { 23, 40, 25, 1, 32, 125, 35395 }, // Ộ
+    { 16, 35, 18, 1, 27, 91, 35520 }, // ộ
+    { 26, 33, 28, 1, 32, 116, 35611 }, // Ớ
+    { 19, 28, 21, 1, 27, 79, 35727 }, // ớ
+    { 26, 33, 28, 1, 32, 113, 35806 }, // Ờ
+    { 19, 28, 21, 1, 27, 80, 35919 }, // ờ
+    { 26, 35, 28, 1, 34, 121, 35999 }, // Ở
+    { 19, 30, 21, 1, 29, 90, 36120 }, // ở
+    { 26, 32, 28, 1, 31, 114, 36210 }, // Ỡ
+    { 19, 27, 21, 1, 26, 84, 36324 }, // ỡ
+    { 26, 36, 28, 1, 28, 118, 36408 }, // Ợ
+    { 19, 29, 21, 1, 21, 80, 36526 }, // ợ
+    { 24, 31, 28, 3, 23, 103, 36606 }, // Ụ
+    { 19, 26, 21, 1, 18, 76, 36709 }, // ụ
+    { 24, 35, 28, 3, 34, 117, 36785 }, // Ủ
+    { 19, 30, 21, 1, 29, 96, 36902 }, // ủ
+    { 26, 33, 30, 3, 32, 119, 36998 }, // Ứ
+    { 22, 28, 24, 1, 27, 98, 37117 }, // ứ
+    { 26, 33, 30, 3, 32, 117, 37215 }, // Ừ
+    { 22, 28, 24, 1, 27, 98, 37332 }, // ừ
+    { 26, 35, 30, 3, 34, 125, 37430 }, // Ử
+    { 22, 30, 24, 1, 29, 109, 37555 }, // ử
+    { 26, 32, 30, 3, 31, 119, 37664 }, // Ữ
+    { 22, 27, 24, 1, 26, 102, 37783 }, // ữ
+    { 26, 36, 30, 3, 28, 120, 37885 }, // Ự
+    { 22, 29, 24, 1, 21, 93, 38005 }, // ự
+    { 22, 32, 25, 2, 32, 91, 38098 }, // Ỳ
+    { 20, 35, 18, -3, 27, 100, 38189 }, // ỳ
+    { 22, 31, 25, 2, 23, 88, 38289 }, // Ỵ
+    { 20, 26, 18, -3, 18, 83, 38377 }, // ỵ
+    { 22, 34, 25, 2, 34, 99, 38460 }, // Ỷ
+    { 20, 37, 18, -3, 29, 108, 38559 }, // ỷ
+    { 22, 31, 25, 2, 31, 94, 38667 }, // Ỹ
+    { 20, 34, 18, -3, 26, 102, 38761 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 38863 }, //  
+    { 0, 0, 33, 0, 0, 0, 38863 }, //  
+    { 0, 0, 17, 0, 0, 0, 38863 }, //  
+    { 0, 0, 33, 0, 0, 0, 38863 }, //  
+    { 0, 0, 11, 0, 0, 0, 38863 }, //  
+    { 0, 0, 8, 0, 0, 0, 38863 }, //  
+    { 0, 0, 5, 0, 0, 0, 38863 }, //  
+    { 0, 0, 21, 0, 0, 0, 38863 }, //  
+    { 0, 0, 9, 0, 0, 0, 38863 }, //  
+    { 0, 0, 7, 0, 0, 0, 38863 }, //  
+    { 0, 0, 2, 0, 0, 0, 38863 }, //  
+    { 0, 0, 1, 0, 0, 0, 38863 }, // ​
+    { 2, 28, 2, -1, 20, 27, 38863 }, // ‌
+    { 8, 30, 5, -4, 22, 51, 38890 }, // ‍
+    { 12, 31, 7, -6, 23, 70, 38941 }, // ‎
+    { 12, 31, 7, -6, 23, 69, 39011 }, // ‏
+    { 11, 3, 13, 1, 10, 8, 39080 }, // ‐
+    { 11, 3, 13, 1, 10, 8, 39088 }, // ‑
+    { 16, 3, 21, 2, 13, 13, 39096 }, // ‒
+    { 17, 3, 18, 0, 10, 20, 39109 }, // –
+    { 33, 3, 34, 0, 10, 38, 39129 }, // —
+    { 33, 3, 34, 0, 10, 38, 39167 }, // ―
+    { 11, 34, 17, 3, 26, 104, 39205 }, // ‖
+    { 17, 8, 18, 0, -1, 23, 39309 }, // ‗
+    { 7, 11, 11, 3, 25, 16, 39332 }, // ‘
+    { 7, 11, 10, 2, 25, 18, 39348 }, // ’
+    { 7, 10, 10, 1, 4, 17, 39366 }, // ‚
+    { 6, 11, 8, 1, 25, 16, 39383 }, // ‛
+    { 13, 11, 17, 3, 25, 34, 39399 }, // “
+    { 14, 11, 17, 2, 25, 33, 39433 }, // ”
+    { 14, 10, 17, 1, 4, 31, 39466 }, // „
+    { 13, 11, 15, 1, 25, 33, 39497 }, // ‟
+    { 15, 22, 17, 1, 24, 50, 39530 }, // †
+    { 16, 26, 17, 0, 24, 65, 39580 }, // ‡
+    { 8, 7, 10, 1, 12, 14, 39645 }, // •
+    { 12, 12, 21, 4, 17, 24, 39659 }, // ‣
+    { 5, 5, 9, 2, 4, 8, 39683 }, // ․
+    { 14, 6, 17, 1, 5, 14, 39691 }, // ‥
+    { 27, 6, 33, 3, 5, 27, 39705 }, // …
+    { 5, 6, 9, 2, 12, 6, 39732 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 39738 }, //  
+    { 0, 0, 1, 0, 0, 0, 39738 }, //  
+    { 12, 31, 7, -6, 23, 71, 39738 }, // ‪
+    { 12, 31, 7, -6, 23, 69, 39809 }, // ‫
+    { 10, 31, 6, -5, 23, 56, 39878 }, // ‬
+    { 14, 31, 8, -7, 23, 83, 39934 }, // ‭
+    { 14, 31, 8, -7, 23, 82, 40017 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 40099 }, //  
+    { 41, 26, 45, 2, 24, 179, 40099 }, // ‰
+    { 7, 11, 9, 1, 23, 17, 40278 }, // ′
+    { 13, 11, 15, 1, 23, 32, 40295 }, // ″
+    { 20, 11, 22, 1, 23, 48, 40327 }, // ‴
+    { 7, 11, 9, 1, 23, 15, 40375 }, // ‵
+    { 14, 11, 16, 1, 23, 31, 40390 }, // ‶
+    { 21, 11, 23, 1, 23, 47, 40421 }, // ‷
+    { 14, 7, 16, 1, 0, 21, 40468 }, // ‸
+    { 9, 13, 11, 1, 15, 20, 40489 }, // ‹
+    { 10, 13, 11, 0, 15, 21, 40509 }, // ›
+    { 21, 23, 22, 0, 22, 88, 40530 }, // ※
+    { 19, 26, 21, 1, 25, 74, 40618 }, // ‼
+    { 17, 3, 18, 0, 27, 14, 40692 }, // ‾
+    { 8, 3, 10, 1, 10, 7, 40706 }, // ⁃
+    { 20, 26, 15, -6, 24, 56, 40713 }, // ⁄
+    { 25, 25, 28, 2, 24, 96, 40769 }, // ⁇
+    { 22, 26, 25, 2, 25, 87, 40865 }, // ⁈
+    { 23, 26, 25, 1, 25, 87, 40952 }, // ⁉
+    { 19, 6, 33, 7, 13, 24, 41039 }, // ⁓
+    { 26, 11, 28, 1, 23, 64, 41063 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 41127 }, //  
+    { 0, 0, 1, 0, 0, 0, 41127 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 41127 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 41127 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 41127 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 41127 }, // ⁤
+    { 13, 17, 15, 1, 28, 46, 41127 }, // ⁰
+    { 14, 16, 15, 0, 28, 42, 41173 }, // ⁴
+    { 13, 16, 15, 1, 27, 35, 41215 }, // ⁵
+    { 13, 17, 16, 2, 28, 42, 41250 }, // ⁶
+    { 12, 16, 16, 3, 27, 34, 41292 }, // ⁷
+    { 13, 17, 15, 1, 28, 41, 41326 }, // ⁸
+    { 13, 17, 15, 0, 28, 42, 41367 }, // ⁹
+    { 13, 12, 19, 3, 23, 38, 41409 }, // ⁿ
+    { 13, 16, 15, 1, 11, 46, 41447 }, // ₀
+    { 10, 16, 15, 2, 11, 31, 41493 }, // ₁
+    { 13, 16, 15, 1, 11, 40, 41524 }, // ₂
+    { 12, 16, 15, 1, 11, 37, 41564 }, // ₃
+    { 14, 16, 15, 0, 11, 38, 41601 }, // ₄
+    { 13, 16, 15, 1, 11, 36, 41639 }, // ₅
+    { 13, 16, 16, 2, 11, 39, 41675 }, // ₆
+    { 12, 16, 16, 3, 11, 32, 41714 }, // ₇
+    { 13, 16, 15, 1, 11, 44, 41746 }, // ₈
+    { 13, 16, 15, 0, 11, 40, 41790 }, // ₉
+    { 21, 23, 22, 0, 23, 75, 41830 }, // ₣
+    { 21, 24, 21, -1, 23, 83, 41905 }, // ₤
+    { 40, 24, 41, 0, 23, 147, 41988 }, // ₧
+    { 23, 24, 23, -1, 23, 84, 42135 }, // €
+    { 19, 13, 33, 7, 18, 44, 42219 }, // ←
+    { 13, 21, 33, 10, 22, 61, 42263 }, // ↑
+    { 19, 13, 33, 7, 18, 43, 42324 }, // →
+    { 13, 21, 33, 10, 22, 62, 42367 }, // ↓
+    { 21, 13, 33, 6, 18, 51, 42429 }, // ↔
+    { 13, 23, 33, 10, 23, 65, 42480 }, // ↕
+    { 15, 22, 33, 9, 22, 73, 42545 }, // ↨
+    { 13, 21, 33, 10, 22, 57, 42618 }, // ↲
+    { 13, 21, 33, 10, 22, 56, 42675 }, // ↳
+    { 19, 15, 33, 7, 19, 51, 42731 }, // ↵
+    { 19, 15, 33, 7, 19, 53, 42782 }, // ⇐
+    { 15, 19, 33, 9, 21, 66, 42835 }, // ⇑
+    { 19, 15, 33, 7, 19, 52, 42901 }, // ⇒
+    { 15, 19, 33, 9, 21, 66, 42953 }, // ⇓
+    { 21, 15, 33, 6, 19, 57, 43019 }, // ⇔
+    { 23, 24, 33, 5, 23, 84, 43076 }, // ∀
+    { 17, 27, 21, 2, 26, 76, 43160 }, // ∂
+    { 15, 23, 33, 9, 23, 61, 43236 }, // ∃
+    { 25, 27, 33, 4, 25, 118, 43297 }, // ∅
+    { 20, 24, 22, 1, 24, 75, 43415 }, // ∆
+    { 21, 24, 33, 6, 23, 80, 43490 }, // ∇
+    { 21, 23, 33, 6, 23, 73, 43570 }, // ∈
+    { 21, 29, 33, 6, 26, 95, 43643 }, // ∉
+    { 21, 19, 33, 6, 21, 80, 43738 }, // ∊
+    { 21, 23, 33, 6, 23, 73, 43818 }, // ∋
+    { 21, 29, 33, 6, 26, 93, 43891 }, // ∌
+    { 21, 19, 33, 6, 21, 79, 43984 }, // ∍
+    { 25, 29, 27, 1, 23, 108, 44063 }, // ∏
+    { 20, 29, 21, 0, 23, 83, 44171 }, // ∑
+    { 15, 3, 21, 3, 13, 14, 44254 }, // −
+    { 19, 26, 19, -1, 24, 54, 44268 }, // ∕
+    { 13, 26, 16, 2, 24, 52, 44322 }, // ∖
+    { 15, 16, 21, 3, 19, 49, 44374 }, // ∗
+    { 12, 12, 21, 4, 17, 29, 44423 }, // ∘
+    { 6, 6, 21, 7, 12, 7, 44452 }, // ∙
+    { 21, 31, 22, 0, 27, 90, 44459 }, // √
+    { 16, 13, 21, 2, 17, 48, 44549 }, // ∝
+    { 21, 11, 22, 0, 16, 58, 44597 }, // ∞
+    { 21, 23, 33, 6, 23, 71, 44655 }, // ∟
+    { 23, 23, 33, 4, 23, 62, 44726 }, // ∠
+    { 4, 34, 17, 6, 26, 52, 44788 }, // ∣
+    { 10, 34, 17, 3, 26, 104, 44840 }, // ∥
+    { 21, 23, 33, 6, 23, 73, 44944 }, // ∧
+    { 21, 23, 33, 6, 23, 75, 45017 }, // ∨
+    { 19, 24, 33, 7, 24, 94, 45092 }, // ∩
+    { 19, 24, 33, 7, 23, 93, 45186 }, // ∪
+    { 18, 34, 21, 1, 26, 78, 45279 }, // ∫
+    { 21, 19, 33, 6, 18, 42, 45357 }, // ∴
+    { 21, 19, 33, 6, 18, 42, 45399 }, // ∵
+    { 7, 18, 10, 1, 20, 20, 45441 }, // ∶
+    { 21, 19, 33, 6, 18, 47, 45461 }, // ∷
+    { 19, 6, 33, 7, 13, 24, 45508 }, // ∼
+    { 19, 18, 33, 7, 20, 51, 45532 }, // ≅
+    { 16, 12, 21, 2, 17, 42, 45583 }, // ≈
+    { 19, 11, 33, 7, 15, 39, 45625 }, // ≍
+    { 15, 15, 21, 3, 19, 43, 45664 }, // ≠
+    { 19, 15, 33, 7, 17, 51, 45707 }, // ≡
+    { 15, 20, 21, 3, 20, 50, 45758 }, // ≤
+    { 15, 20, 21, 3, 20, 47, 45808 }, // ≥
+    { 27, 16, 33, 3, 19, 64, 45855 }, // ≪
+    { 27, 16, 33, 3, 19, 65, 45919 }, // ≫
+    { 21, 19, 33, 6, 21, 68, 45984 }, // ⊃
+    { 21, 29, 33, 6, 26, 102, 46052 }, // ⊄
+    { 21, 29, 33, 6, 26, 100, 46154 }, // ⊅
+    { 21, 23, 33, 6, 23, 71, 46254 }, // ⊆
+    { 21, 23, 33, 6, 23, 71, 46325 }, // ⊇
+    { 25, 25, 33, 4, 24, 131, 46396 }, // ⊕
+    { 25, 25, 33, 4, 24, 113, 46527 }, // ⊖
+    { 25, 25, 33, 4, 24, 117, 46640 }, // ⊗
+    { 25, 25, 33, 4, 24, 113, 46757 }, // ⊘
+    { 19, 23, 33, 7, 23, 38, 46870 }, // ⊥
+    { 6, 6, 21, 7, 12, 8, 46908 }, // ⋅
+    { 27, 6, 33, 3, 12, 25, 46916 }, // ⋯
+    { 31, 32, 33, 1, 28, 137, 46941 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_italicIntervals[] = {
@@ -5494,4 +3712,5 @@ static const EpdFontData bookerly_16_italic = {
     36,
     -9,
     true,
+    true,
 };
@@ -2,5301 +2,3615 @@
  * generated by fontconvert.py
  * name: bookerly_16_regular
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_regularBitmaps[73739] = {
-    0x0A, 0x83, 0xF8, 0x3F, 0x47, 0xF4, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
-    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x04, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x3F, 0xC3, 0xFC, 0x3F, 0xC0, 0x50, 0x05, 0x01, 0x93, 0xE0, 0x7D, 0x7E, 0x0B, 0xD7, 0xE0,
-    0xBD, 0x7E, 0x0B, 0xC3, 0xD0, 0xBC, 0x3D, 0x0B, 0xC3, 0xD0, 0x7C, 0x3D, 0x07, 0xC3, 0xC0, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x55, 0xF5,
-    0x57, 0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xBF, 0xAA, 0xFE, 0xA4, 0x00, 0x0F, 0x40,
-    0x3D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x02,
-    0xE0, 0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFB, 0xFC, 0x03, 0xF0, 0xF0, 0xFE, 0x0B, 0xC0, 0xF0, 0x3E, 0x0F, 0xC0, 0xF0, 0x3D, 0x0F, 0xC0,
-    0xF0, 0x24, 0x0F, 0xD0, 0xF0, 0x00, 0x0B, 0xF4, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xE3, 0xFC, 0x00, 0x01,
-    0xD0, 0xFD, 0x0E, 0x01, 0xD0, 0x7E, 0x3F, 0x02, 0xD0, 0x7E, 0x3F, 0x02, 0xD0, 0xBD, 0x3F, 0x82,
-    0xD0, 0xFC, 0x2F, 0xF6, 0xD7, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00,
-    0x2F, 0x87, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x7D,
-    0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0xB8, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x3C,
-    0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x2D, 0x00, 0x64, 0x00, 0xBD, 0x00, 0xF8, 0x1F, 0x02, 0xFF,
-    0xE0, 0x0F, 0xC0, 0xFC, 0x0F, 0x02, 0xFA, 0xFF, 0x02, 0xFF, 0xFD, 0x07, 0x81, 0xF4, 0x0B, 0xD0,
-    0x1F, 0xFC, 0x03, 0xC0, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x3E, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF0, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x0F,
-    0xC0, 0x1F, 0x40, 0x00, 0x1F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xAF,
-    0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x07,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x03, 0xF4, 0xFD, 0x00, 0x2F, 0x40, 0x02, 0xF8,
-    0x1F, 0xC0, 0x07, 0xD0, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x3D,
-    0x00, 0x0F, 0xC0, 0x03, 0xFD, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0xEB, 0xC0, 0x00, 0xFE, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xE0, 0x1F, 0xFD, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x14, 0x00, 0x05, 0x3E, 0x7E, 0x7E, 0x7E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0B,
-    0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x08, 0x0F, 0xC0, 0x2F, 0x0F, 0x40, 0x3F, 0xDE,
-    0x00, 0x07, 0xFD, 0xBC, 0x00, 0xBF, 0xFD, 0x0B, 0xEC, 0x6C, 0x3F, 0x8E, 0x00, 0x1E, 0x0F, 0x00,
-    0x04, 0x0F, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x01, 0x55, 0xF9, 0x55,
-    0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
-    0x40, 0x2D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x2F, 0x2F,
-    0xEF, 0xFE, 0xFD, 0x14, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x06, 0xBE, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0x00, 0x7F, 0xD0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00,
-    0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0xBF, 0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x0F,
-    0xD0, 0xFF, 0x00, 0x00, 0x7F, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x07,
-    0xFD, 0x07, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x1B, 0xF0, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xBF, 0xE5, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xEB, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xE0, 0x3F, 0x00,
-    0x03, 0xFC, 0x1F, 0x80, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0x2F, 0xC0, 0x64, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1B, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFE, 0xBF, 0xE0, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0x00, 0x03, 0xF0, 0x1C, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBA, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01,
-    0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xBF, 0xAA,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x55, 0x55, 0x54, 0x01,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x7F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x55, 0xBF, 0xD0, 0x7F, 0x00,
-    0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x7F, 0x87, 0xF0, 0x00, 0x0F, 0xF1, 0xFC, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x07, 0xF0,
-    0x0F, 0xFD, 0x0B, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xBE, 0xAA, 0xAA,
-    0xFD, 0xBC, 0x00, 0x03, 0xF8, 0xBC, 0x00, 0x07, 0xF0, 0xB8, 0x00, 0x0F, 0xD0, 0x10, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xEA, 0xFF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x07, 0xF0, 0x0B, 0xF8, 0x07, 0xF0, 0x00, 0xFF, 0xDB, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFE, 0xFF, 0xE0, 0x02, 0xFC, 0x07, 0xFE, 0x01, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x03, 0xF4, 0x2F, 0xF4, 0x0B, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xD0, 0x1F, 0xF4, 0x3F, 0x40, 0x03, 0xFC, 0x7F, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE, 0x3F,
-    0xC0, 0x00, 0xFE, 0x2F, 0xF0, 0x00, 0xFE, 0x0F, 0xFF, 0xEF, 0xFD, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1A, 0xAB, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x04, 0x1F, 0xDF, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xFB, 0xFF, 0xBF, 0x45, 0x00, 0x00, 0x50,
-    0x03, 0xFC, 0x07, 0xFD, 0x07, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x01, 0xFC,
-    0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x10, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x3F, 0xFF, 0x40, 0x7F, 0xFF,
-    0xD0, 0x3E, 0xAF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x1B, 0xFD, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x0F,
-    0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x6A, 0x40, 0x00, 0xFC, 0x0F, 0xD0, 0x02,
-    0xFF, 0xF8, 0x00, 0x2F, 0x43, 0xF0, 0x03, 0xF9, 0x7F, 0x40, 0x07, 0xE2, 0xF8, 0x01, 0xF4, 0x07,
-    0xE0, 0x00, 0xFC, 0xFC, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0xDF, 0xC0, 0x00, 0x00, 0x5F, 0x80, 0x03, 0xF7, 0xE0, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xF9,
-    0xF8, 0x00, 0x2F, 0xE6, 0xF8, 0x00, 0x7D, 0x7E, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x2F, 0x1F, 0xC0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x83, 0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x1F, 0xC0, 0xFC, 0x00, 0xBF,
-    0x5F, 0xFF, 0xFF, 0xC0, 0x2F, 0x40, 0x0F, 0xFF, 0x8F, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0xBE, 0x40,
-    0x69, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x01, 0xFF, 0xF9, 0x55, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x05, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0xBE, 0x00,
-    0x2F, 0xC0, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF0, 0x56, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x0B, 0xF5, 0x5B, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00,
-    0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF,
-    0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xF0,
-    0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0xBF,
-    0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF5, 0x56, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D,
-    0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE1, 0x7F, 0xEA, 0xAF, 0xF8, 0x0B, 0xF0, 0x00, 0x3E,
-    0x02, 0xFC, 0x00, 0x0B, 0x80, 0xBF, 0x00, 0x01, 0xD0, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD5, 0x6A, 0x80, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40,
-    0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x43, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x0B,
-    0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x5F, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF2,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFE,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00,
-    0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40, 0xBF,
-    0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x03, 0xCF, 0xD0, 0x00, 0x7C, 0xFC, 0x00, 0x00,
-    0x7C, 0xBE, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC,
-    0x3F, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x0B, 0xC2, 0xF8, 0x03, 0xE0, 0xFD, 0x00, 0x00, 0xBC, 0x1F,
-    0xC0, 0x3C, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0,
-    0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xF4, 0x03, 0xF2, 0xF0,
-    0x07, 0xE0, 0x00, 0x0F, 0x40, 0x2F, 0x7D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x03,
-    0xF0, 0x00, 0x1F, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF0,
-    0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xF8, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00,
-    0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00,
-    0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0,
-    0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02,
-    0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0,
-    0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4,
-    0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F,
-    0xC0, 0x6F, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC0, 0x00, 0xBE, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xFD, 0x02, 0xFC,
-    0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x07, 0xF4, 0x02, 0xFD, 0x5B, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF9, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0,
-    0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02,
-    0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B,
-    0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00,
-    0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE,
-    0x00, 0x00, 0x5A, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E,
-    0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF,
-    0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFE,
-    0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x07,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFE, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xFB, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xF7, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x07, 0xC2, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC1, 0xFC, 0x02, 0xF4, 0x00,
-    0x00, 0x07, 0xF0, 0x0F, 0x80, 0xFD, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0xBE, 0x03,
-    0xE0, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x00, 0x7F, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x3E, 0x00,
-    0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFD,
-    0xBC, 0x00, 0x1F, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0x3D, 0x00, 0x01,
-    0xFD, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0xBF, 0x40, 0x00, 0x3D, 0x1F, 0xE0, 0x00, 0x03,
-    0xD3, 0xFC, 0x00, 0x00, 0xBD, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF6, 0xFF, 0xDB, 0xD0, 0x2F, 0x00, 0xBC, 0x02,
-    0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B,
-    0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF, 0xDB, 0xFF, 0x40, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x15, 0x3F, 0xF8, 0xFF, 0xE0, 0x0F, 0x80,
-    0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00,
-    0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03,
-    0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0xFF, 0xE7, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xBC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF8,
-    0x0F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x01, 0xF4, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0x3D, 0x55, 0x55,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1C, 0x00, 0x3F,
-    0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x50, 0x00,
-    0x00, 0xFC, 0x2F, 0xFF, 0x40, 0x00, 0xFD, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0xBF, 0xF0, 0x00,
-    0xFF, 0x40, 0x0B, 0xF8, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC, 0x0F, 0xC0, 0x03, 0xF4, 0xBD, 0x00, 0x0B,
-    0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x54, 0x7F, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xF9, 0x01, 0xFF, 0x00, 0x0F, 0xD0,
-    0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F,
-    0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF9, 0x1B, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFD, 0x01,
-    0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0x0B, 0xE3,
-    0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xDB, 0xE0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x2F, 0x80,
-    0x3E, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x6A, 0xFE, 0xAA,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0xFE, 0x00, 0xBF, 0x09, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xF4, 0x0B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFD,
-    0x00, 0x01, 0xBF, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00,
-    0x2F, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x01, 0x54, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0x57, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03,
-    0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x0B, 0xFF, 0x80, 0x1B, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x02, 0xFD, 0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0x90,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x02,
-    0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00,
-    0x01, 0xFC, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x01,
-    0xFC, 0x01, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0xC0,
-    0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFE, 0x0B, 0xFF, 0xD0, 0x2F, 0xFF, 0x40,
-    0x03, 0xFF, 0xCF, 0xFF, 0xFC, 0x3F, 0xFF, 0xF4, 0x00, 0xAF, 0xFF, 0xE5, 0xFF, 0xFF, 0x97, 0xFF,
-    0x00, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00,
-    0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0,
-    0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0x80, 0xBF, 0xFF, 0x0F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF, 0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8,
-    0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40,
-    0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x6F, 0xC1, 0xFF, 0xF8, 0x0B, 0xFF, 0x6F, 0xFF, 0xFC, 0x1B, 0xFF, 0xF9, 0x6F,
-    0xF8, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x2F, 0x80, 0x00, 0x3F, 0x80,
-    0xBE, 0x00, 0x00, 0xBF, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x0B, 0xF0, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x1F,
-    0xC0, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xBF, 0x90, 0x6F, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x7F, 0xC0, 0x0F, 0xD0, 0x00,
-    0x7F, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x1F, 0xC0,
-    0xBF, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x2F,
-    0xF0, 0x07, 0xFE, 0x5B, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x7F, 0x00, 0x07, 0xFF, 0xE1, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x01, 0x50, 0x2F, 0xE0, 0x7F, 0xE3, 0xFF, 0xC7,
-    0xFF, 0x8A, 0xFF, 0x7F, 0xFD, 0x00, 0xFF, 0xD0, 0x20, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x1F, 0xFF,
-    0xF4, 0x07, 0xFF, 0xFF, 0x80, 0xF8, 0x01, 0xF8, 0x1F, 0x40, 0x0B, 0x82, 0xF4, 0x00, 0x70, 0x1F,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFC, 0x1C, 0x00, 0x1F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00, 0x0F, 0xC3, 0xF4,
-    0x02, 0xF8, 0x3F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80,
-    0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50,
-    0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0,
-    0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3,
-    0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0x00,
-    0x1F, 0xFF, 0x8F, 0xFF, 0xD0, 0x07, 0xD0, 0x07, 0xFF, 0xE0, 0xBF, 0x40, 0x02, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xF4, 0x00,
-    0x7F, 0x00, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x03, 0xF8,
-    0x07, 0xCF, 0xD0, 0x2F, 0x00, 0x00, 0x7F, 0x02, 0xF1, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xF4,
-    0x3F, 0x03, 0xD0, 0x00, 0x02, 0xF4, 0x7C, 0x0B, 0xD1, 0xF0, 0x00, 0x00, 0x7E, 0x2E, 0x01, 0xF8,
-    0xF8, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x3F, 0x3D, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x0B, 0xEF, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xF7, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x0F, 0x87, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xFE, 0x01, 0xFF, 0xFC, 0xBF, 0xFF,
-    0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00,
-    0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00,
-    0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0xFE, 0x1F, 0x00, 0x0F, 0xF0, 0x78,
-    0x00, 0xBF, 0x00, 0x90, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x0D, 0x0F, 0xE0, 0x00,
-    0xB8, 0xBF, 0x00, 0x03, 0xD7, 0xF5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0xC0, 0x7F, 0x40, 0x0B, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x03, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00,
-    0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x03,
-    0xFF, 0xA0, 0x0B, 0xFF, 0x00, 0x05, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0x7E, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0,
-    0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x01, 0xFC,
-    0x01, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x05, 0x40, 0x00, 0x01, 0xB8, 0x00, 0x08, 0x0F, 0xFF, 0x80,
-    0x2E, 0x2F, 0xFF, 0xF4, 0xBE, 0x3E, 0x07, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x05,
-    0x40, 0x05, 0x03, 0xFC, 0x3F, 0xC3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xD0, 0xFD, 0x0F,
-    0xD0, 0xFD, 0x1F, 0xD1, 0xFC, 0x2F, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x07, 0xFA, 0xE7, 0xFC,
-    0x0F, 0xC1, 0xE0, 0xFC, 0x2F, 0x41, 0xE0, 0xB8, 0x3F, 0x01, 0xD0, 0x60, 0x7E, 0x01, 0xD0, 0x00,
-    0xBD, 0x01, 0xD0, 0x00, 0xBD, 0x01, 0xD0, 0x00, 0xFD, 0x01, 0xD0, 0x00, 0xBD, 0x02, 0xD0, 0x00,
-    0xBE, 0x02, 0xC0, 0x00, 0x7F, 0x02, 0xC0, 0x00, 0x3F, 0x82, 0xC0, 0x00, 0x3F, 0xE2, 0xC0, 0x18,
-    0x0F, 0xFF, 0xEB, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0xFE, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00,
-    0x07, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x01, 0x40,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2B, 0xFA, 0xAA, 0xAA, 0xD1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFE, 0xBF, 0xFF, 0xFC, 0x07, 0x80, 0x00, 0x15, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x80, 0xF4, 0x01, 0x50, 0x0F, 0x82, 0xF5, 0xFF, 0xFD, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x2F, 0x40,
-    0x0F, 0xC0, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x2F, 0xF8, 0x2F,
-    0x83, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x40, 0x01, 0x55, 0x47,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x2F, 0xFD, 0x00, 0x01, 0xBF, 0x40, 0x3F, 0x80, 0x00, 0x0B, 0xD0,
-    0x02, 0xFD, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xE0,
-    0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x7F, 0x03, 0xF0,
-    0x00, 0x00, 0xFF, 0xF4, 0x7F, 0xF8, 0x00, 0x0B, 0xFF, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x06, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x06, 0xA4, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x2F, 0xAB, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0F,
-    0x80, 0x07, 0x80, 0xBE, 0x00, 0x04, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xB9, 0xFE,
-    0x00, 0x02, 0xE2, 0xFF, 0x40, 0x0B, 0xC1, 0xFF, 0xC0, 0x1F, 0x00, 0x7F, 0xC0, 0x3F, 0x00, 0x2F,
-    0xC0, 0x7F, 0x00, 0x1F, 0x80, 0xBF, 0x80, 0x2F, 0x00, 0xBF, 0xD0, 0x3C, 0x00, 0x7F, 0xE0, 0xF4,
-    0x00, 0x2F, 0xF3, 0xD0, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x0B, 0xFC, 0x18, 0x00, 0x0F, 0xE0, 0xF8,
-    0x00, 0x3F, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xF4, 0x1F, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x05, 0x00, 0x14, 0x7F, 0x40, 0xFD, 0xBF, 0x81, 0xFE, 0x7F, 0x40, 0xFD, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF,
-    0xEA, 0xBF, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7F, 0xF4, 0x03, 0xC0, 0x3D, 0x00, 0xFF,
-    0xFE, 0x00, 0xB8, 0x1F, 0x00, 0xF8, 0x03, 0x80, 0x0F, 0x0B, 0x40, 0x7C, 0x00, 0xE0, 0x02, 0xD3,
-    0xC0, 0x2E, 0x00, 0x10, 0x00, 0x78, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xCF, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x78, 0xB4,
-    0x0B, 0xC0, 0x00, 0x00, 0x2D, 0x1E, 0x01, 0xFD, 0x00, 0x40, 0x0F, 0x03, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x07, 0xC0, 0xB8, 0x01, 0xFF, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xF4,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x03, 0xF6, 0xF4, 0x1F, 0x03, 0xE0, 0x28, 0x0F, 0x80, 0x01, 0x7E, 0x01, 0xFF,
-    0xF8, 0x1F, 0x93, 0xE0, 0xFC, 0x0F, 0x83, 0xF0, 0x3F, 0x07, 0xFF, 0xFF, 0xC7, 0xF4, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4, 0x00, 0x04, 0x00, 0x04, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xE0, 0x2F,
-    0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x1F, 0xD0,
-    0x01, 0xFC, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x05, 0x00,
-    0x05, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x0F, 0x90, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x06, 0xA8, 0x03,
-    0xC0, 0x78, 0x2F, 0xBD, 0x07, 0x42, 0xC0, 0x38, 0x78, 0x0F, 0x0F, 0x00, 0xE1, 0xE0, 0x2C, 0x3C,
-    0x03, 0xEF, 0x00, 0xB0, 0xE0, 0x0F, 0xF0, 0x02, 0xC3, 0xC0, 0x38, 0xF0, 0x0B, 0x0B, 0x00, 0xE1,
-    0xF0, 0x3C, 0x1D, 0x0F, 0xE1, 0xF1, 0xE0, 0x3C, 0x15, 0x41, 0x4F, 0x00, 0x3C, 0x00, 0x00, 0xB4,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF,
-    0xE0, 0x3F, 0x47, 0xF4, 0x7C, 0x00, 0xFC, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0x7C, 0xBC, 0x00, 0xBC,
-    0x7E, 0x00, 0xF8, 0x3F, 0xEB, 0xF0, 0x0B, 0xFF, 0xC0, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x2F, 0xFF, 0xE0,
-    0x7F, 0x07, 0xF0, 0xBC, 0x02, 0xF4, 0x7C, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0xFD, 0x2F,
-    0x41, 0xF8, 0x74, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x01, 0xBF, 0xC0, 0x0B, 0xFF, 0xC0,
-    0x15, 0x6F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x01, 0xBF, 0x4B, 0xFF, 0xF4,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0F, 0xC0, 0xBF, 0x03, 0xF8, 0x3F, 0x82, 0xF8,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0xBF, 0x7F, 0x04, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0x1F, 0x6F, 0xFF,
-    0x02, 0xFF, 0x47, 0xE0, 0x54, 0x00, 0x15, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xBF, 0x40, 0x3F, 0xFF, 0xCB, 0x80, 0x2F, 0xFF,
-    0xF2, 0xE0, 0x0F, 0xFF, 0xFC, 0xB8, 0x03, 0xFF, 0xFF, 0x2E, 0x01, 0xFF, 0xFF, 0xCB, 0x80, 0x7F,
-    0xFF, 0xF2, 0xE0, 0x0F, 0xFF, 0xFC, 0xB8, 0x03, 0xFF, 0xFF, 0x2E, 0x00, 0x7F, 0xFF, 0xCB, 0x80,
-    0x0B, 0xFF, 0xF2, 0xE0, 0x00, 0xBF, 0xFC, 0xB8, 0x00, 0x06, 0xDF, 0x2E, 0x00, 0x00, 0x07, 0xCB,
-    0x80, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x07,
-    0xCB, 0x80, 0x00, 0x01, 0xF2, 0xE0, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x00,
-    0x07, 0xCB, 0x40, 0x00, 0x01, 0xF2, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x04, 0x07, 0xFC, 0x7F,
-    0xF0, 0x3F, 0x07, 0xE0, 0xFC, 0x7F, 0x02, 0x40, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x1B, 0xFD, 0x03,
-    0xFF, 0xC0, 0x05, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0xD0, 0x1F, 0xFF, 0xF2, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xEF, 0xF0, 0x3E, 0x02, 0xF8, 0xBC, 0x00, 0xFC, 0xFC,
-    0x00, 0xFC, 0xF8, 0x00, 0xBC, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xF8, 0x7F, 0x02, 0xF0, 0x2F, 0xFF,
-    0xD0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0,
-    0x10, 0x00, 0x04, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x0F,
-    0xC0, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xFC,
-    0x02, 0xFD, 0x02, 0xFD, 0x01, 0xFD, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1A, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x01, 0x90, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0xD0,
-    0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0xD0,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0xFB, 0xD0, 0x1B, 0xFF, 0xE0, 0x0B, 0x80, 0x03, 0xF3, 0xD0,
-    0x3F, 0xFF, 0xF0, 0x0F, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x43, 0xD0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x07, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x06, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x1A, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x6F, 0x80,
-    0x00, 0xBC, 0x00, 0x00, 0xF4, 0x07, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0xD7, 0xFC,
-    0x00, 0xBC, 0x00, 0x03, 0xC0, 0x3F, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x0B, 0x80, 0x3E, 0x00, 0xFC,
-    0x1B, 0xFF, 0xE0, 0x0F, 0x00, 0x05, 0x00, 0xFC, 0x3F, 0xFF, 0xF0, 0x2E, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xD5, 0x55,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x01, 0xBE, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x02, 0xF9, 0x2F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x01, 0xAB, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0x68, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xC0,
-    0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x01, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0xF0, 0x00, 0x3F, 0xF8, 0x06, 0xBF, 0xF8, 0x00, 0xB8,
-    0x00, 0x2F, 0x3E, 0x02, 0xFF, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x4F, 0x80, 0x15, 0x40, 0x00, 0x2E,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBF, 0xE0, 0x02, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFC, 0x02, 0xFF, 0x90, 0x00, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFF, 0x9B, 0xC0, 0x2F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00,
-    0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFD, 0x03, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x42, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFB,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0xAA, 0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xEA, 0xAA, 0xBF, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xAA, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEF,
-    0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF2, 0xFC,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x1F, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x2F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xAA, 0xA8, 0x00, 0x00, 0x07, 0xFA, 0xAB, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xAA, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x10, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xD0,
-    0x07, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7D, 0x02,
-    0xF8, 0x00, 0x00, 0xFF, 0x56, 0xAB, 0xF0, 0xBF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40,
-    0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5,
-    0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F,
-    0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00,
-    0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0x83, 0xF4, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00,
-    0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40,
-    0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5,
-    0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x00,
-    0xBD, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00,
-    0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x10, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFE, 0x05, 0xFF,
-    0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xFF,
-    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFE, 0x05, 0xFF, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF4, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFB, 0xF4, 0x0F, 0xD1, 0xFC, 0x2F,
-    0x80, 0x7E, 0x2D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xF8, 0x05, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7F, 0x81, 0xFF, 0x7F, 0x81, 0xFF, 0x2F, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x05,
-    0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x15,
-    0xFF, 0x55, 0x40, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x2A, 0xFF, 0xAA, 0x80, 0x02,
-    0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0x6F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x02, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3C, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2,
-    0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02,
-    0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x7F, 0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07,
-    0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00,
-    0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F,
-    0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x80,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xE0,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x1F, 0x80, 0x0F, 0xC0,
-    0xBE, 0x03, 0xF0, 0x02, 0xF8, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFE, 0xF4, 0x00, 0x3F, 0x0B, 0xD0, 0x0F, 0xD0, 0x2F, 0x43, 0xF4, 0x00, 0xBD, 0x0D,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFD, 0x01, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xF4, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0xF4, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xFF, 0xC0, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xF0, 0x00, 0x02, 0xF5, 0xFE, 0x03, 0xF8,
-    0x00, 0x02, 0xF4, 0x3F, 0xC0, 0xFD, 0x00, 0x02, 0xF4, 0x0F, 0xF0, 0x7F, 0x40, 0x02, 0xF4, 0x03,
-    0xFC, 0x1F, 0xD0, 0x02, 0xF4, 0x00, 0xBF, 0x07, 0xF4, 0x02, 0xF4, 0x00, 0x2F, 0xC1, 0xFE, 0x02,
-    0xF4, 0x00, 0x0F, 0xF0, 0x7F, 0x82, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xF2, 0xF4, 0x00, 0x00, 0xFD,
-    0x03, 0xFE, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x00,
-    0x00, 0x2F, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xE0, 0x02,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xF4, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x16, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xF7, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF7,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F,
-    0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x00,
-    0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x02, 0xFD, 0xA5, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xBF, 0xFF, 0x40,
-    0x2F, 0x80, 0x07, 0xFC, 0x02, 0xF8, 0x00, 0x1F, 0xE0, 0x2F, 0x80, 0x00, 0xBF, 0x02, 0xF8, 0x00,
-    0x07, 0xF0, 0x2F, 0x80, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00, 0xFE, 0x02,
-    0xF8, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x0B, 0xF4, 0x02, 0xFE, 0xAF, 0xFD, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFD, 0x54, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xEF, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xE0, 0x00, 0x03, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x03, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x05, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xC0, 0x03,
-    0xF0, 0x07, 0xF0, 0xFC, 0x02, 0xF4, 0x1F, 0xFC, 0x3F, 0xFB, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0,
-    0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F,
-    0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF,
-    0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x2F, 0x02,
-    0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x24, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE,
-    0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF,
-    0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x74, 0x00, 0x0B, 0xFF,
-    0x4F, 0x80, 0x00, 0xFD, 0xBF, 0xF8, 0x00, 0x0B, 0x42, 0xFF, 0x00, 0x00, 0x10, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02,
-    0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F,
-    0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF,
-    0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x01,
-    0x40, 0x05, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xFE, 0x03, 0xF8,
-    0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00,
-    0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00,
-    0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x1F, 0x07, 0xD0, 0x00, 0x02, 0xE0, 0x3E, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x00, 0x01,
-    0xF4, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD,
-    0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00,
-    0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD,
-    0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x05, 0x50, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF,
-    0x41, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0x40, 0xBF, 0xF8, 0x07, 0xF8,
-    0x3F, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0x0B, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x50, 0x00, 0xBF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC5, 0xAB, 0xFD, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xEA, 0x54, 0x00, 0xFF, 0xE5, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0xFF, 0x55, 0xBC, 0x2F, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x05, 0x50, 0x00, 0x05, 0x54, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x07, 0xFC, 0x0F, 0xC0, 0x03,
-    0xF4, 0xBD, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x14, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6E, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1, 0xF8, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE,
-    0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFD, 0xBE,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x3F, 0x40, 0x03, 0xF0, 0x3F,
-    0x00, 0x3F, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0, 0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x81, 0xFE, 0x01, 0xFD,
-    0x03, 0xF4, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD,
-    0x3F, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x07, 0xE7, 0xF5, 0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00,
-    0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x3F, 0xFD, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFC, 0x00, 0x02, 0x40, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x0F, 0xFF, 0x40, 0x1B, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0x00,
-    0x07, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xF0, 0x0F, 0xCB, 0xE0, 0xFC, 0x0B, 0xCB, 0xD0, 0x0F,
-    0x48, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x0F, 0xFF, 0x40, 0x1B, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x05, 0x00, 0x14, 0x3F, 0x80, 0xFF, 0x7F, 0xC0,
-    0xFF, 0x3F, 0x80, 0xFE, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x06, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0x7F, 0x8F, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xBD,
-    0x2F, 0x80, 0x00, 0x07, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0xFD, 0xBD, 0x00, 0x1F, 0xFF, 0xFB, 0xF0, 0x07, 0xF9, 0x5B, 0xFF, 0x00, 0xFD, 0x00,
-    0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xC7, 0xF4, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x3F, 0x03, 0xFD, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x02, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0x4F,
-    0x40, 0x00, 0x00, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF,
-    0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F,
-    0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01,
-    0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F,
-    0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06,
-    0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00,
-    0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x1F, 0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-    0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4,
-    0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00,
-    0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x0E, 0x00, 0x00, 0xFF, 0xE2, 0xF0, 0x00, 0x1F, 0x6F, 0xFF,
-    0x00, 0x01, 0xE0, 0x7F, 0xD0, 0x00, 0x05, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00,
-    0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x2F, 0xC0,
-    0x7F, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x2F,
-    0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01,
-    0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7, 0xF4,
-    0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD1, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0x40, 0x7F, 0xF4, 0x03, 0xF0, 0x00,
-    0x3F, 0xD0, 0x2F, 0x40, 0x02, 0xFF, 0x80, 0xFC, 0x00, 0x2F, 0xFF, 0x07, 0xF0, 0x02, 0xF5, 0xFC,
-    0x2F, 0x80, 0x2F, 0x43, 0xF4, 0xBE, 0x02, 0xF4, 0x0F, 0xC2, 0xF8, 0x2F, 0x40, 0x3F, 0x0B, 0xF2,
-    0xF4, 0x00, 0xFC, 0x1F, 0xEF, 0x40, 0x07, 0xF0, 0x3F, 0xF4, 0x00, 0x2F, 0x40, 0xFF, 0x40, 0x01,
-    0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xF4, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1A, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06,
-    0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F,
-    0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00,
-    0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF,
-    0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF,
-    0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F,
-    0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x03,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00,
-    0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02,
-    0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF,
-    0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F,
-    0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x01, 0x50, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0x00, 0x01, 0xFD, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xF9, 0xBF, 0xF0, 0x01, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x01,
-    0xFC, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF8,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x01, 0xFE, 0x51, 0xBF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00,
-    0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0x82, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xEA, 0xAB, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x07, 0xFA, 0xAA, 0xAF, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x02, 0xAA, 0xA9, 0x40, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x30, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xE5, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x28, 0x00, 0x0F, 0xD0, 0x0B, 0x80, 0x00, 0x7F, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0,
-    0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00,
-    0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0,
-    0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00,
-    0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00,
-    0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B,
-    0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFC, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x40, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B,
-    0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07,
-    0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xBF,
-    0x40, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0xB4, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7E, 0x2F, 0x80, 0x03, 0xF0,
-    0x3F, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2,
-    0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFE, 0x56, 0xFF, 0x00, 0x7F, 0x80, 0x00, 0xFC, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x3F, 0x80, 0x00, 0x0F, 0x81, 0xFC, 0x00, 0x00, 0x2D, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x05, 0x02, 0xFF, 0xFE, 0xAB, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF,
-    0xFF, 0xC0, 0x7F, 0x41, 0xFF, 0x03, 0xF0, 0x00, 0xFD, 0x2F, 0x40, 0x02, 0xF0, 0xFC, 0x00, 0x05,
-    0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xE5, 0x5B, 0x81, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x04,
-    0x00, 0x01, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x02, 0xFD, 0x7F,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xF9, 0x5B, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F,
-    0xC0, 0xFE, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x14, 0x0B, 0xFF, 0xFA, 0xAF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0x40, 0x01, 0x80, 0x0F,
-    0x40, 0x2F, 0x40, 0x3F, 0x41, 0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x1F, 0xF0, 0x3F, 0x00, 0x0F, 0xD2,
-    0xF4, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x50, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB8, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF5, 0x56, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x0B, 0x80, 0x00, 0x01,
-    0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xC0,
-    0x00, 0x01, 0x54, 0x7F, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFE, 0x40, 0x7F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x01,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x46, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x00, 0x07, 0xFF, 0xF4, 0xBF, 0xF0, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x05, 0xFF, 0x05, 0xAF, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x15, 0xFF, 0x55, 0x40, 0x02, 0xFC, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFC, 0x2A, 0xFF, 0xAA, 0x80,
-    0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x55, 0x6F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x6A,
-    0xFF, 0xA8, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x06, 0xBA, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xF9, 0x1B, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFD, 0x01, 0xFF, 0xFD, 0x2F, 0xFC, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x5F, 0xFA, 0xAA, 0xBF, 0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x00,
-    0xBF, 0x00, 0x00, 0xB8, 0x02, 0xFC, 0x00, 0x01, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xAA, 0xAA, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x04, 0x02, 0xFC, 0x00,
-    0x00, 0xB4, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x1F, 0x40, 0xBF, 0x56, 0xAA, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xAA, 0x40, 0x0F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1,
-    0xF8, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF,
-    0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFD, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x50, 0x00, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x3F, 0xE5, 0xBD, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA, 0xAB,
-    0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA, 0xA4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC, 0x00,
-    0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0xFF, 0xAB, 0xF0, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03,
-    0xF4, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02,
-    0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x07, 0xE7, 0xF5,
-    0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF6, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xE5, 0x5B,
-    0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02,
-    0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x50, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00,
-    0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x5B, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0xE5, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x40, 0x00, 0x14, 0x00, 0x07, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x1F, 0xD3, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFE, 0x05, 0xFF, 0xAA,
-    0xAB, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80, 0x2F, 0xC0, 0x00, 0x1D,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xAA,
-    0xA4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00, 0x00, 0x3E, 0x02, 0xFC,
-    0x00, 0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0x40, 0x01, 0x80, 0x0F, 0x40, 0x2F, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00,
-    0x7E, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF,
-    0x40, 0x00, 0x03, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x0F,
-    0x40, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x01, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xF8, 0x02, 0xFC, 0x24, 0x0F, 0xC0,
-    0x02, 0xF8, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x03, 0xF4, 0x00, 0x06, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xBD, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xAF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x08, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xD0, 0x00, 0x00, 0x3F, 0xD5, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F,
-    0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD,
-    0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03,
-    0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0xD0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x2F, 0xFA, 0xFC, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0xFE, 0x00, 0xBF, 0x09, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00,
-    0xBE, 0x00, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x0F, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFD, 0x00, 0x01, 0xBF, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0x43, 0xFC, 0x00, 0x07, 0xF8,
-    0x07, 0xFF, 0xEB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF9, 0x56, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0x07,
-    0xE0, 0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0x00,
-    0x2C, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBF, 0xFF, 0xD7, 0xF4, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0x1A, 0xFF, 0x83, 0xF8, 0x00,
-    0x00, 0x03, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x42, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0xBF, 0xE0, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0xF9, 0x56, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x14, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0x80, 0x2F, 0xC2, 0x40, 0xFC, 0x00, 0x2F, 0x80, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xFD, 0x02, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x40, 0x00, 0x6F, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0xFF, 0x00, 0x01, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x95,
-    0x6F, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0xFF, 0xD7, 0xF4,
-    0x00, 0x01, 0xAF, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0x40,
-    0x2F, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x05, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xE0, 0x0B, 0xF0, 0x90, 0x3F, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x3F, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFF, 0x40, 0xBF,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0xA4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x0F, 0xD0, 0x00, 0x1B, 0xF0, 0xBD, 0x00, 0x00, 0x0F,
-    0xC3, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x7F,
-    0xFE, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40,
-    0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x55, 0x00, 0x00, 0x01,
-    0xFC, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x57, 0xFE, 0x00,
-    0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x07, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x5F,
-    0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAA, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xEA, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x6F, 0x90, 0x00, 0x01, 0xFC, 0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xD0, 0x2F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
-    0x40, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x0B, 0xE0, 0x28, 0x2F,
-    0xFC, 0x3D, 0x3F, 0xFF, 0xFD, 0x3D, 0x1F, 0xFC, 0x1C, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x01, 0x00, 0x00, 0xFF, 0x42, 0xCB, 0xFF,
-    0x4F, 0xBF, 0x7F, 0xFD, 0xB4, 0x3F, 0xF0, 0x40, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xC0, 0x05, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x2A, 0xAA, 0x96, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x40, 0x3F, 0xFD, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x09, 0x3E, 0x00, 0x1D, 0x3F, 0xD5, 0xBC, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xD0, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x05, 0xFF,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x40, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0xDF, 0xD0, 0x0B, 0x6F, 0xFA, 0xFC, 0x3F, 0xFF, 0xD0, 0x1B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03,
-    0xFE, 0x50, 0x0B, 0xFF, 0xC0, 0x06, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xF4, 0x03, 0xFF, 0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0,
-    0x02, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xE5, 0x00, 0x3F, 0xFD,
-    0x00, 0x1F, 0xE0, 0x00, 0xA4, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F,
-    0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF,
-    0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x17, 0xFD, 0x00, 0x17, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x03, 0xF8, 0x07, 0xFF,
-    0xFF, 0x00, 0x3F, 0x80, 0xBF, 0xFF, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x01, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xE0,
-    0x03, 0xFE, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x0B, 0xFD, 0x3F, 0xFD, 0x03,
-    0xFF, 0xD1, 0xBF, 0xD0, 0x1B, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0xFD, 0x1F, 0xFF, 0xF0, 0x0F,
-    0xD3, 0xFF, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0xFD, 0x1F, 0xC0, 0x3F, 0x40, 0x7E, 0x02, 0xD0,
-    0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80,
-    0x05, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0xD0, 0x02,
-    0xF4, 0xFC, 0x01, 0xF8, 0x1F, 0x80, 0xF8, 0x01, 0xF0, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x81,
-    0x7F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x07, 0xFF, 0xFC, 0x01, 0xFC,
-    0x07, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x40, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00,
-    0x01, 0xFC, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0x40, 0x01,
-    0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0x00, 0xFF, 0xFF, 0x43, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x6F, 0xF0, 0x00, 0xFE, 0x40,
-    0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00,
-    0x03, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xCB, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x40, 0x00, 0x00, 0xFC, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xC0, 0x1F, 0xF4, 0x00, 0x03, 0xF4, 0x01, 0xFF, 0x80, 0x1B,
-    0xFF, 0xD0, 0x1F, 0xFC, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80,
-    0xBF, 0x00, 0x00, 0x3D, 0x02, 0xFC, 0x00, 0x02, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x02, 0xFD, 0x00,
-    0xBF, 0xF4, 0x1F, 0xFF, 0x40, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0xBF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40,
-    0xBF, 0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0xBF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x2F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xFF, 0xFC, 0x0F,
-    0xC0, 0xBF, 0xFF, 0xE0, 0x3D, 0x00, 0x5F, 0xF4, 0x01, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0x80, 0x00,
-    0xBF, 0x00, 0x1C, 0x00, 0x02, 0xFC, 0x00, 0x10, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1D, 0x02, 0xFC, 0x00,
-    0x00, 0xF8, 0x0B, 0xF0, 0x00, 0x03, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0x40, 0xBF, 0x56, 0xAA, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x54, 0x01, 0x02, 0xFF, 0xC0,
-    0xBC, 0x7F, 0xFC, 0x0B, 0xC0, 0x6F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x1F, 0xC0, 0xF4, 0x01,
-    0xFC, 0x0F, 0x00, 0x1F, 0xC0, 0xD0, 0x01, 0xFC, 0x04, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x74, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00, 0x0F, 0x40,
-    0xBF, 0x00, 0x00, 0xBD, 0x02, 0xFD, 0x5A, 0xAB, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x06,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x10, 0x01, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x01,
-    0xFC, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x40, 0x00, 0x00, 0x2F, 0xC2, 0xF0, 0x00, 0x00, 0x0B, 0xFB, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x02, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0xF4, 0x00,
-    0xBF, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xD5, 0xAA, 0xBF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x06, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x1F, 0xC2, 0x40, 0x07, 0xF3, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x7F, 0x00, 0x0A, 0x1F, 0xC0, 0x00, 0x07,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x01, 0x7F, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x2F, 0xC0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x07, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0,
-    0x2F, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x07, 0xF8, 0x02,
-    0xF0, 0x00, 0x2F, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x03, 0xF8, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xD2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0xFF,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x1F, 0xF0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xCF, 0xFF,
-    0xFE, 0x00, 0x2B, 0xFF, 0xF9, 0x6F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0xFD, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x2F, 0x00, 0x02, 0xF2, 0xFC, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00,
-    0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F,
-    0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFD, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x2F, 0x00, 0x02, 0xF0, 0x00,
-    0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0xBF, 0x82, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFC, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xFF, 0x96, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xD3, 0xFF, 0xFE, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0x80, 0x7F, 0xF4, 0x00, 0x01, 0x7F, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x2F, 0xC0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x07, 0xF4, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x2F, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x07, 0xF8,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x2F, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x03, 0xF8, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0xD2, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0xFF, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF0, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0xFF, 0xCF,
-    0xFF, 0xFE, 0x00, 0x2B, 0xFF, 0xF9, 0x6F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0xFD, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x3D, 0x00, 0x2F, 0xD0, 0xBF, 0xFD, 0x00, 0x2E, 0x00, 0x7F, 0xF9, 0xFF, 0xFF, 0xD0, 0x01, 0x00,
-    0x0B, 0xFF, 0xFD, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x17, 0xF4, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x2F, 0x00, 0x02, 0xF3, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xE0, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F,
-    0xE0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x40, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFC, 0x02, 0xF0,
-    0x00, 0x2F, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x42, 0xF0, 0x00, 0x2F, 0x00,
-    0x01, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xE2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x6F,
-    0x00, 0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x2F, 0xE0, 0xBF, 0xFE, 0x03, 0xFF, 0xCF, 0xFF, 0xFE, 0x0A, 0xFF, 0xFE,
-    0x5B, 0xFC, 0x00, 0xFF, 0x80, 0x07, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x0F,
-    0xD0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0xBE, 0x1B, 0xFF, 0xE0, 0x02, 0xF8,
-    0xFF, 0xFF, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0,
-    0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xF9, 0x5F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x07, 0x00, 0x01, 0xF8, 0x01, 0xF0, 0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40,
-    0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00,
-    0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F,
-    0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x03, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00,
-    0xBF, 0x81, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xD0, 0x00,
-    0x00, 0x02, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0xBE, 0x00,
-    0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x3C, 0x07,
-    0x80, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F,
-    0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8,
-    0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFA, 0x5B, 0xFE, 0xAA, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xBC, 0x03, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x38, 0x1F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x03, 0xFE, 0xAA,
-    0xA4, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x80,
-    0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1E, 0x0B, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x3F,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x3E, 0x00, 0xFF, 0xF5, 0x03, 0xF9, 0x5A, 0xAF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x2F,
-    0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x1B, 0xFB, 0xF8, 0x07, 0xFC,
-    0x1F, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x3F, 0xD5, 0x55, 0xFE, 0xBF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFD, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x07,
-    0xFF, 0xFF, 0x95, 0xAC, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xE0, 0x00, 0x16, 0x90, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0xBF, 0x81, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x2B, 0xFD, 0xFF, 0xF4,
-    0x03, 0xFF, 0x40, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE,
-    0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02, 0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x2F,
-    0xE0, 0x7F, 0xE3, 0xFF, 0xC7, 0xFF, 0x8A, 0xFF, 0x7F, 0xFD, 0x00, 0xFF, 0xD0, 0x20, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xC0,
-    0x6F, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0xC0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x2F, 0xE0, 0x00, 0x02,
-    0xFE, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x00,
-    0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0x8B, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x02, 0x00, 0x02, 0x40, 0x3F, 0x00, 0x7E, 0x00, 0x7E,
-    0x03, 0xF0, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0xBF, 0x81, 0xFF,
-    0x8F, 0xFF, 0x1F, 0xFE, 0x2B, 0xFD, 0xFF, 0xF4, 0x03, 0xFF, 0x40, 0x80, 0x0F, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00,
-    0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02,
-    0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03,
-    0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4,
-    0x00, 0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00,
-    0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF, 0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xBE, 0x1F, 0xD0, 0x02, 0xF8, 0x03, 0xF0, 0x02, 0xD0, 0x00, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F,
-    0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xF8, 0xFD, 0x00, 0x3E, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0x00,
-    0x60, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF,
-    0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4, 0x00, 0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF,
-    0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF,
-    0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD, 0x3C, 0x00, 0x00,
-    0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x7F, 0xD0, 0x1F,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x80, 0xF8, 0x01, 0xF8, 0x1F, 0x40, 0x0B, 0x82, 0xF4,
-    0x00, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x1C, 0x00, 0x1F, 0xC3, 0xC0, 0x00, 0xFC, 0x3E, 0x00,
-    0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x3F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50,
-    0x0B, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xFD, 0x3F, 0x40, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFC, 0x07, 0xFD, 0x5B, 0xFC, 0x0F, 0xD0, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0xB0, 0x2F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x04, 0x00, 0x02, 0xFD,
-    0x3C, 0x00, 0x00, 0xFD, 0x7D, 0x00, 0x00, 0xFD, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC,
-    0x7F, 0xD0, 0x1F, 0xF0, 0x7F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x5A, 0x90, 0x00,
-    0x05, 0x00, 0x09, 0x01, 0xF0, 0x03, 0xF0, 0x0F, 0xC0, 0xBD, 0x00, 0x7F, 0x1F, 0x80, 0x02, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xF8, 0x0F, 0x80, 0x1F, 0x81, 0xF4, 0x00,
-    0xB8, 0x2F, 0x40, 0x07, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xC1, 0xC0, 0x01, 0xFC, 0x3C, 0x00, 0x0F,
-    0xC3, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x83, 0xFF, 0xBF, 0xF0, 0x1F, 0xFF, 0xF8, 0x00, 0x05,
-    0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA,
-    0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0,
-    0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFE, 0xAB, 0xFE, 0xAB, 0xFC, 0xBC, 0x00,
-    0xBF, 0x00, 0x2F, 0x2F, 0x00, 0x2F, 0xC0, 0x0B, 0xCB, 0x80, 0x0B, 0xF0, 0x01, 0xF1, 0xD0, 0x02,
-    0xFC, 0x00, 0x74, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x04, 0x1F, 0x00, 0x0F, 0x87, 0x80, 0x07, 0xE1,
-    0xC0, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xBF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFD, 0xAB, 0xFE,
-    0xAA, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x55, 0x80, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xF0, 0x00,
-    0x15, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA,
-    0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0,
-    0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x5F, 0xF5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x2A, 0xFF, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xF6, 0xAF, 0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B,
-    0xE0, 0x00, 0x6B, 0xFE, 0xA8, 0x2F, 0xFF, 0xFF, 0x45, 0x7F, 0x95, 0x40, 0x0B, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xC0, 0x00, 0x55, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x3C, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xA0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x3D, 0x00, 0x00, 0x03,
-    0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x81, 0xBF, 0x40, 0x00, 0x06,
-    0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x5B,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF,
-    0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x0B,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF7, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xF8, 0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xFF, 0xAF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x06, 0xFD,
-    0x00, 0x00, 0x1B, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01,
-    0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F,
-    0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8,
-    0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0C, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xC0, 0x3F, 0x40, 0x00, 0x00, 0x02, 0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFE, 0x06, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x01, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xC3, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B,
-    0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE,
-    0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83,
-    0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8,
-    0x01, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF,
-    0xC0, 0x02, 0xFF, 0xF8, 0x2F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF9, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFE,
-    0x07, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80,
-    0x02, 0xFB, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF7, 0xF0, 0x00, 0xBD, 0x00, 0x00,
-    0x1F, 0xC0, 0x03, 0xD3, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xC2, 0xF8, 0x01, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x0F, 0xC1, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0xFD,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x2F,
-    0x00, 0x7F, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x7D, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0xBC, 0x00, 0x1F, 0xCF, 0x40, 0x00,
-    0x00, 0x00, 0x7E, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0xF0, 0x01, 0xFF, 0xF8, 0xFF, 0xFD, 0x00, 0x7D, 0x00, 0x7F, 0xFE, 0x0B, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x07, 0xFD,
-    0x00, 0x2F, 0x40, 0x07, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFB, 0xF0, 0x03,
-    0xE0, 0x00, 0x3F, 0x80, 0x7C, 0xFD, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x1F, 0x80, 0xFC, 0x00,
-    0x00, 0xFC, 0x0F, 0x43, 0xF0, 0x3D, 0x00, 0x00, 0x2F, 0x47, 0xC0, 0xBD, 0x1F, 0x00, 0x00, 0x07,
-    0xE2, 0xE0, 0x1F, 0x8F, 0x80, 0x00, 0x00, 0xFC, 0xF4, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0x2F, 0xBC,
-    0x00, 0xBE, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x7E, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0x06, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE,
-    0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03,
-    0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0x00, 0x00, 0xBF, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x03, 0xF8, 0x01, 0x80,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C,
-    0x0B, 0xF4, 0x00, 0x03, 0xD1, 0xFE, 0x00, 0x00, 0x3D, 0x3F, 0xC0, 0x00, 0x0B, 0xDB, 0xFA, 0xAA,
-    0xAA, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x55, 0x5F,
-    0xE1, 0xF0, 0x00, 0xFF, 0x07, 0x80, 0x0B, 0xF0, 0x09, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0xD0, 0xFE, 0x00, 0x0B, 0x8B, 0xF0, 0x00, 0x3D, 0x7F, 0x55, 0x57, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0x3D,
-    0x00, 0x01, 0xFD, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0xBF, 0x40, 0x00, 0x3D, 0x1F, 0xE0,
-    0x00, 0x03, 0xD3, 0xFC, 0x00, 0x00, 0xBD, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xE5,
-    0x55, 0xFE, 0x1F, 0x00, 0x0F, 0xF0, 0x78, 0x00, 0xBF, 0x00, 0x90, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x0D, 0x0F, 0xE0, 0x00, 0xB8, 0xBF, 0x00, 0x03, 0xD7, 0xF5, 0x55, 0x7F, 0x7F,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00,
-    0x3D, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0xE2, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x3F, 0x00, 0x00, 0xBF, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3C, 0x00, 0x03, 0xF8, 0x01, 0x80,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1C,
-    0x0B, 0xF4, 0x00, 0x03, 0xD1, 0xFE, 0x00, 0x00, 0x3D, 0x3F, 0xC0, 0x00, 0x0B, 0xDB, 0xFA, 0xAA,
-    0xAA, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x06, 0x40, 0x3E, 0x00, 0x7E, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0xFE, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x3E, 0x55, 0x5F,
-    0xE1, 0xF0, 0x00, 0xFF, 0x07, 0x80, 0x0B, 0xF0, 0x09, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0xD0, 0xFE, 0x00, 0x0B, 0x8B, 0xF0, 0x00, 0x3D, 0x7F, 0x55, 0x57, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x3F, 0x00, 0x08, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x50, 0x00, 0x3F,
-    0x40, 0x00, 0xBF, 0xFF, 0xE4, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x02, 0xFF, 0x90,
-    0x6F, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xF4,
-    0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x55, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0xD3, 0xF0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x40, 0x7F, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0x80, 0x00,
-    0x3F, 0x80, 0xFC, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0,
-    0xBF, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x1F, 0xD0,
-    0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0x2F,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0x6F, 0xC0, 0x6F, 0xF8, 0xBE, 0x0B, 0xF0, 0x00, 0xFF, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xDB,
-    0xD0, 0xBF, 0x00, 0x03, 0xF8, 0x50, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00,
-    0x0B, 0xF5, 0x6F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0x2F, 0x80,
-    0x3E, 0x00, 0x00, 0x3F, 0x00, 0x08, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x50, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0x40,
-    0x00, 0xFD, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xF9, 0xBF, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xF8, 0x00,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x00, 0xFC, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0x50, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF6, 0xAF,
-    0xFA, 0xA8, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF9, 0x56, 0x00, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0,
-    0x00, 0x55, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x04, 0x03, 0xD0, 0x0B, 0x82, 0xF0,
-    0x03, 0xFF, 0xF4, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0x90, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xEA, 0xBF, 0xEA, 0xBF, 0xCB, 0xF0, 0x03, 0xF8, 0x00, 0xFC,
-    0xFE, 0x00, 0x3F, 0x80, 0x0F, 0x8B, 0xF0, 0x03, 0xF8, 0x00, 0xF8, 0x3F, 0x80, 0x3F, 0x80, 0x0B,
-    0x00, 0x64, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x20, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xAB, 0xFE, 0xAA, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x55, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xBF, 0x00, 0x2F, 0x2E,
-    0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x7C, 0x00, 0x00, 0x01,
-    0xFE, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xE0, 0x01, 0xBF, 0x40, 0x00, 0x06, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0x5B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2B, 0xF8, 0x00,
-    0xAF, 0xFF, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00,
-    0x00, 0x00, 0xA0, 0x07, 0xE0, 0x2F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0x80, 0x1F, 0x00, 0x00,
-    0x00, 0xD0, 0x0B, 0xD0, 0x7F, 0x43, 0xF8, 0x2F, 0xC1, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x0B, 0xD3, 0xF4, 0x0F, 0x80, 0xFC,
-    0x3F, 0x00, 0x7C, 0x18, 0x00, 0x14, 0x01, 0x00, 0x00, 0x1F, 0xF0, 0x3C, 0x3F, 0xFC, 0x7C, 0x3E,
-    0x7F, 0xFC, 0x3C, 0x1F, 0xF8, 0x04, 0x02, 0x90, 0x1A, 0xAA, 0xA4, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0C, 0x3F, 0x00, 0x3C, 0x3F, 0xEA, 0xF8,
-    0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0x40, 0x1F, 0x43, 0xFC, 0x3F, 0xC3, 0xFC, 0x05, 0x00, 0x15, 0x00,
-    0x14, 0x7F, 0x41, 0xFD, 0xBF, 0x82, 0xFE, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x01, 0x54, 0x00,
-    0xFF, 0xF4, 0x3F, 0xAF, 0xC3, 0xD0, 0xBD, 0x3C, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F,
-    0x40, 0x01, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0x83, 0xE0, 0xBC,
-    0x3C, 0x07, 0xC3, 0xD0, 0x3C, 0x3F, 0x0B, 0xC1, 0xFF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x80, 0x14, 0x02, 0xF0, 0x3E, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0xFD, 0x0F, 0xC2, 0xF8, 0x2F, 0x03,
-    0xF0, 0x3C, 0x07, 0xC0, 0x00, 0x01, 0x00, 0x14, 0x00, 0x24, 0x7C, 0x00, 0xFC, 0x3F, 0x02, 0xF4,
-    0x1F, 0xC7, 0xE0, 0x0B, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x02, 0x00, 0xBC, 0x0F, 0x80, 0xFD, 0x0F, 0xC0, 0x7F, 0x0B, 0xE0, 0x2F, 0x83, 0xF0, 0x0F, 0xC0,
-    0xF8, 0x03, 0xD0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8,
-    0x3F, 0x46, 0xFC, 0x38, 0x00, 0xBC, 0x20, 0x00, 0x24, 0x02, 0x80, 0xBC, 0x1F, 0x43, 0xF0, 0x7E,
-    0x0B, 0xE0, 0xBF, 0x07, 0xFC, 0x1F, 0x80, 0x19, 0x07, 0xF8, 0x3F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8,
-    0x2F, 0x03, 0xE0, 0xB8, 0x00, 0x00, 0x06, 0x42, 0xFD, 0x3F, 0xC3, 0xF0, 0x3F, 0x02, 0xF0, 0x0F,
-    0x80, 0xBC, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x3F, 0x3F, 0x3D, 0x7C, 0x78, 0x70, 0x10, 0x0B, 0x40,
-    0xFC, 0x0F, 0xD0, 0xFC, 0x3F, 0x47, 0xD0, 0x60, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0xC3, 0xFC,
-    0x2F, 0x80, 0x00, 0x2E, 0x00, 0xB8, 0xBF, 0x41, 0xFE, 0xBF, 0x42, 0xFE, 0x3F, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x1F, 0xF4, 0x3E, 0xBC, 0xB8, 0x2E, 0xB8, 0x2E, 0x7D, 0x7D, 0x2F, 0xF8,
-    0x06, 0x40, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0xFC, 0x0F, 0xC1, 0xF4, 0x3E, 0x02, 0x40, 0x04, 0x07,
-    0xFC, 0x7F, 0xF0, 0x3F, 0x07, 0xE0, 0xFC, 0x7F, 0x02, 0x40, 0x00, 0x10, 0x07, 0xC0, 0x2F, 0x00,
-    0x3E, 0x00, 0x7E, 0x00, 0x7F, 0x94, 0x3F, 0xFD, 0x07, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA,
-    0x00, 0x19, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x03, 0xF7, 0xF0, 0x0F, 0xC0, 0xFC, 0x3F,
-    0x00, 0x7C, 0x04, 0x00, 0x10, 0x14, 0x00, 0x08, 0x3D, 0x00, 0x2C, 0x3F, 0x80, 0xBC, 0x2F, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x69, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xF0, 0x3C, 0x3F, 0xFC, 0x7C,
-    0x3E, 0x7F, 0xFC, 0x3C, 0x0F, 0xF8, 0x04, 0x01, 0x90, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x3F, 0x46,
-    0xFC, 0x38, 0x00, 0xBC, 0x20, 0x00, 0x24, 0x00, 0x00, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x19,
-    0x00, 0x64, 0xBF, 0x41, 0xFE, 0xBF, 0x82, 0xFE, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x68, 0x0B,
-    0xC0, 0xBC, 0x0B, 0xE0, 0x7F, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8,
-    0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0xFF, 0x00, 0xBF, 0xC0,
-    0x02, 0xFC, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0xBF,
-    0x00, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0B,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xF0, 0x56, 0xFF, 0x40,
-    0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x0B, 0xF0,
-    0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F,
-    0xE0, 0x0B, 0xF5, 0x5B, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1, 0x7F, 0xEA, 0xBF,
-    0xFC, 0x0B, 0xF0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x03, 0xD0, 0x2F, 0xC0,
-    0x00, 0xF4, 0x0B, 0xF0, 0x00, 0x18, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xEF, 0xD0, 0x00, 0x00, 0x07, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F,
-    0x43, 0xF8, 0x00, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00,
-    0xFE, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x3F,
-    0x80, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x1F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0xBF,
-    0x95, 0x55, 0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00,
-    0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B,
-    0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A,
-    0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xAA, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF0, 0x3D, 0x00,
-    0x01, 0xFD, 0x03, 0xC0, 0x00, 0x3F, 0x80, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xC0, 0xBF, 0x40, 0x00, 0x3D, 0x1F, 0xE0, 0x00,
-    0x03, 0xD3, 0xFC, 0x00, 0x00, 0xBD, 0xBF, 0xAA, 0xAA, 0xAF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x17, 0xFD, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xAB, 0xF0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4,
-    0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x41, 0xFF, 0xFF, 0x02, 0xFC, 0x7F, 0x42, 0xFF, 0xFF, 0x02, 0xFC, 0x7F, 0x41, 0xFF, 0xFE,
-    0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x5A, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x81,
-    0x7F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF3, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFE,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xDB, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0xC0, 0x00,
-    0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x07,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7E,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00,
-    0x7F, 0xD0, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF4,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3E, 0xFC, 0x00,
-    0x03, 0xEF, 0xC0, 0x00, 0x03, 0xCF, 0xD0, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x7C, 0xBE, 0x00, 0x0F,
-    0x8F, 0xC0, 0x00, 0x07, 0xC7, 0xF0, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x2F, 0x0F,
-    0xC0, 0x00, 0x0B, 0xC2, 0xF8, 0x03, 0xE0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x3C, 0x0B, 0xD0,
-    0x00, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0xF8, 0x0B, 0xE0, 0x00,
-    0x0F, 0x80, 0x3F, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xF4, 0x03, 0xF2, 0xF0, 0x07, 0xE0, 0x00, 0x0F,
-    0x40, 0x2F, 0x7D, 0x00, 0x7F, 0x00, 0x01, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x40,
-    0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2E, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x00, 0x17, 0xF4, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBF, 0x40, 0x00,
-    0x2F, 0x00, 0x02, 0xF2, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x0F, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x7F, 0x40, 0x02, 0xF0, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0xF0,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x7F, 0x80, 0x2F, 0x00, 0x02, 0xF0, 0x02, 0xFD, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x0F, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x82, 0xF0, 0x00, 0x2F, 0x00, 0x01,
-    0xFD, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xF2, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xAF, 0x00,
-    0x02, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xB8,
-    0x00, 0x00, 0x03, 0xC1, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x71, 0xF0, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x00,
-    0x0B, 0xEF, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xE4, 0x1F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xFE, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0x01, 0x7F, 0xC0, 0x6F, 0xFC, 0x02, 0xFC, 0x00,
-    0x3F, 0xD0, 0x2F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xBE, 0x02,
-    0xFC, 0x00, 0x0F, 0xE0, 0x2F, 0xC0, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x07,
-    0xF4, 0x02, 0xFD, 0x5B, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFE, 0xAA, 0xAA, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xF4, 0x07, 0xF8, 0x00, 0x03, 0xD0, 0x0B,
-    0xF8, 0x00, 0x0F, 0x40, 0x0B, 0xF4, 0x00, 0x18, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xC0, 0xFE, 0x00, 0x00,
-    0x2F, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAF, 0xFA, 0xAF, 0xF2, 0xF0, 0x02, 0xFC, 0x00, 0xBC, 0xBC, 0x00,
-    0xBF, 0x00, 0x2F, 0x2E, 0x00, 0x2F, 0xC0, 0x07, 0xC7, 0x40, 0x0B, 0xF0, 0x01, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x3F, 0xFC, 0x00,
-    0x00, 0x7F, 0xDB, 0xFF, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xF4,
-    0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x00,
-    0x1F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x5B, 0xF5, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xEF, 0xFB, 0xFF, 0xC0,
-    0x0B, 0xF8, 0x07, 0xE0, 0x1F, 0xF0, 0x2F, 0xD0, 0x07, 0xE0, 0x03, 0xFC, 0x3F, 0x80, 0x07, 0xE0,
-    0x01, 0xFD, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xBF, 0x00,
-    0x07, 0xE0, 0x00, 0xFF, 0xBF, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x7F, 0x40, 0x07, 0xE0, 0x00, 0xFD,
-    0x3F, 0xC0, 0x07, 0xE0, 0x03, 0xFC, 0x1F, 0xF0, 0x07, 0xE0, 0x0B, 0xF4, 0x0B, 0xFE, 0x07, 0xE0,
-    0x7F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x06, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xC2, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x7F, 0x80, 0x03,
-    0xF4, 0x0F, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0xBF,
-    0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xF0,
-    0x00, 0xBF, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x03, 0xFC,
-    0x03, 0xF0, 0x0F, 0xF0, 0x00, 0x07, 0xFE, 0x4F, 0xD1, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x90, 0x1F, 0xFD,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x03, 0x43, 0xF4, 0x00, 0x0B, 0xE0, 0xB2, 0xE0,
-    0x3F, 0x40, 0x0B, 0xE0, 0x3D, 0xBC, 0x03, 0xF4, 0x0B, 0xE0, 0x0F, 0x6F, 0xA9, 0xBF, 0x03, 0xF6,
-    0xAB, 0xDB, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0xFD, 0x00, 0x1F, 0xE0,
-    0xBE, 0x3F, 0x00, 0x0F, 0xD0, 0x0B, 0xDF, 0xC0, 0x0B, 0xF0, 0x00, 0xFF, 0xE0, 0x03, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00,
-    0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0xD0, 0x02, 0xFD, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0xD0, 0xBE,
-    0x7F, 0x40, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0x00, 0x3F, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x54, 0x00,
-    0x15, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x2F,
-    0x80, 0x3F, 0xC0, 0x1F, 0xC0, 0x07, 0xF4, 0x0B, 0xD0, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x3F, 0x40,
-    0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0xFC, 0x06, 0xBC, 0x00, 0x3F, 0x07, 0xFF, 0x80, 0x0F, 0xC0, 0xFF, 0xFC, 0x03, 0xF0, 0x00,
-    0x7F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x2F, 0xC3,
-    0xF0, 0x00, 0x2F, 0xD0, 0xFE, 0x50, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xEF, 0xFF, 0x80,
-    0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0xFF, 0xF0, 0x00, 0x1F,
-    0xC0, 0xBF, 0x80, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0xFE,
-    0x00, 0x3F, 0x80, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x0B, 0xD0,
-    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0x80, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0x3E,
-    0x3E, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x50, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD0, 0x06, 0xFC, 0x03, 0xF0, 0x00, 0x09, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0xBF, 0xE0, 0x0B, 0xF0, 0x03, 0xFD, 0x03,
-    0xF0, 0x00, 0x3F, 0xC2, 0xF8, 0x00, 0x07, 0xF4, 0xFD, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x2F,
-    0xDF, 0xC0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00,
-    0x3F, 0x8F, 0xF0, 0x00, 0x0F, 0xC2, 0xFE, 0x00, 0x0F, 0xE0, 0x3F, 0xE0, 0x0F, 0xF0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B,
-    0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xC0, 0xFE, 0x00, 0x7C, 0x2F, 0x80, 0x00, 0x43, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xF5,
-    0x50, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x23,
-    0xFE, 0x41, 0xBF, 0x1F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF4, 0x00, 0x15, 0x50, 0x00, 0x04, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x06, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xC1,
-    0xBE, 0x97, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0xBF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x5B, 0xFF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x02, 0xFD, 0x03, 0xFF, 0xE0, 0xFF, 0xF1,
-    0xFF, 0xFF, 0x85, 0xBF, 0x3F, 0x9B, 0xFC, 0x02, 0xFB, 0xC0, 0x0F, 0xD0, 0x1F, 0xF0, 0x00, 0xBE,
-    0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0x7F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xD0, 0x1F, 0xF0, 0x0F, 0xD0, 0x01, 0xFD, 0x03,
-    0xF0, 0x00, 0x3F, 0xC2, 0xF4, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x3F,
-    0x8F, 0xC0, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x01, 0xFD, 0xFD, 0x55, 0x55, 0xBF, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x7F, 0x7F, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x02, 0xF4, 0xFE, 0x00, 0x00, 0xFC, 0x2F,
-    0xC0, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x1F, 0x80, 0xFF, 0x00, 0x0F, 0xC0, 0x0F, 0xF4, 0x1F, 0xE0,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xFF,
-    0x41, 0x3F, 0xFF, 0xC7, 0xFF, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x3F, 0x00, 0x0F, 0xFC, 0x03, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0x00, 0xFF, 0x40, 0x03, 0xF0,
-    0x2F, 0xC0, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0x00,
-    0x03, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xF7, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0x00, 0x00, 0x3F, 0x82,
-    0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x07, 0xFD, 0x04,
-    0x3F, 0x00, 0x2F, 0xFF, 0xC3, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x02, 0xA4,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0x6F, 0x80, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x7E,
-    0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x03,
-    0xF4, 0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x94, 0x3F, 0xC0, 0x00, 0x7F, 0xFD, 0x7F, 0x00, 0x00, 0x3F, 0xF4,
-    0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x07, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFD,
-    0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xE0, 0xBF, 0x7F, 0x04, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0x1F, 0x6F,
-    0xFF, 0x02, 0xFF, 0x47, 0xE0, 0x54, 0x00, 0x15, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0xFF, 0xF0, 0x00, 0x1F, 0xC0, 0xBF, 0x80, 0x02, 0xFC,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x07, 0xF0,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x00, 0xFD, 0x0F, 0x80, 0x00, 0x07, 0xE2, 0xF0, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x03, 0xFB,
-    0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x06, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x40, 0x69, 0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x90, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xE0, 0x2F, 0xF4, 0x0F, 0xD0, 0x01, 0xFF,
-    0x0B, 0xE0, 0x00, 0x2F, 0xD3, 0xF4, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0xBE, 0x3F, 0x80,
-    0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x0F, 0xC2, 0xFE, 0x00, 0x0B, 0xE0, 0x3F, 0xE0, 0x0B, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3D, 0x0B, 0xC0, 0x0F, 0x40, 0x0E, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0,
-    0x00, 0x01, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40,
-    0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xEA,
-    0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF4, 0x1F, 0xF4,
-    0x2F, 0xC0, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0xFE,
-    0xBF, 0x00, 0x00, 0xBF, 0xBE, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0xFD,
-    0xBE, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x02, 0xFC, 0xBE, 0x00, 0x07, 0xF0, 0xBF, 0x95, 0x6F, 0xE0,
-    0xBF, 0xFF, 0xFF, 0x40, 0xBE, 0xFF, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0xFD, 0x02, 0xFD, 0x0F, 0xD0, 0x03, 0xF8, 0x7E, 0x00, 0x07, 0xC3, 0xF4,
-    0x00, 0x04, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xD4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xAB, 0xFE, 0xFC, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x3F,
-    0x01, 0xFC, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x3F,
-    0x40, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x01,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3C, 0x03, 0xF0, 0x00, 0x0E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x10, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xF0, 0x7F, 0xF8, 0x00, 0x1F, 0x80,
-    0x6F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0xFE, 0x03, 0xF4, 0x00,
-    0x0B, 0xE0, 0x3F, 0x40, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0xBF, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x3F, 0x80, 0x00, 0xBE, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x2F, 0x80, 0x0B, 0xF4, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x7F, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0x90, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x7F, 0xC0, 0x7F, 0x00, 0x0F,
-    0xC0, 0x07, 0xF4, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0xFF, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x7F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0xBF,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xF4, 0x03, 0xF0, 0x07, 0xF8, 0x01, 0xFF, 0x90, 0xFC, 0x1B,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0x03, 0xFF, 0x80, 0x03, 0xF8, 0x01, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x02, 0xFC, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x0B, 0xE1, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xEF, 0xD0, 0x00, 0x00, 0x1F, 0x1F, 0xC0,
-    0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xD0, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x00,
-    0x1F, 0xF9, 0x7F, 0x80, 0x00, 0x3F, 0xF8, 0x68, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x0B, 0xE0, 0x07, 0xD0,
-    0x7F, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x03, 0xF4, 0x02, 0xF8, 0x00,
-    0xBE, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x2F,
-    0xC0, 0x3F, 0x40, 0x0B, 0xE0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x3F, 0x80,
-    0x0B, 0xE0, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xE0, 0x03,
-    0xF8, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x0B, 0xF0, 0x00, 0xBF,
-    0x40, 0xBE, 0x02, 0xFC, 0x00, 0x03, 0xFE, 0x4B, 0xE1, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x05, 0x00, 0x1F, 0xC2, 0xF8,
-    0x00, 0xFD, 0x00, 0x3F, 0x4F, 0xD0, 0x03, 0xF4, 0x00, 0xFE, 0x3F, 0x40, 0x0F, 0xD0, 0x02, 0xFC,
-    0xFC, 0x00, 0x3F, 0x40, 0x0B, 0xF7, 0xF0, 0x00, 0xBD, 0x00, 0x2F, 0xDF, 0xC0, 0x02, 0xF4, 0x00,
-    0xBF, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xF8, 0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xD2, 0xFC, 0x01, 0xFF,
-    0x00, 0x3F, 0x03, 0xFC, 0x0F, 0xBF, 0x03, 0xF8, 0x0B, 0xFF, 0xFC, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xC0, 0x7F, 0xF8, 0x00, 0x01, 0x94, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE,
-    0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE,
-    0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF,
-    0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x82, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xEA,
-    0xAB, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFA, 0xAA, 0xAF, 0xE0, 0x00,
-    0x02, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x7F,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x3F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x01, 0xD0,
-    0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x03,
-    0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x3F,
-    0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFE,
-    0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00, 0x05,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB,
-    0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0xF8, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB,
-    0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0xF8, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB,
-    0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x01, 0xD0, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xAD,
-    0x0A, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x02, 0xF8, 0x3F, 0x80, 0x00,
-    0xBD, 0x00, 0xFC, 0x00, 0x06, 0x40, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD,
-    0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-    0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB,
-    0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x70, 0x00, 0x0B, 0xFF, 0x9F, 0x00, 0x00, 0xB4, 0xBF, 0xF0, 0x00,
-    0x07, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00, 0x2F, 0x83, 0xFC, 0x00, 0x0B, 0xD0, 0x0B, 0xC0, 0x00,
-    0x60, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F,
-    0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE,
-    0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0,
-    0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9,
-    0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x2F,
-    0x02, 0xF4, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x24, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0,
-    0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE,
-    0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07,
-    0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1,
-    0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x0F, 0xE5, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01,
-    0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x24, 0x00, 0x0F, 0xC0, 0x0B, 0x80, 0x00, 0x7F, 0x9B, 0xF0, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02,
-    0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF,
-    0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F,
-    0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x78, 0x20, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x0F, 0xE5, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01,
-    0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x70, 0x00, 0x24, 0x00, 0x0F, 0xC0, 0x0B, 0x80, 0x00, 0x7F, 0x9B, 0xF0, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFD, 0x02,
-    0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xEF,
-    0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0, 0xBF, 0xFD, 0x1F,
-    0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3C, 0x08,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xAF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01,
-    0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x0F,
-    0x43, 0xE0, 0x00, 0x00, 0x10, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x00, 0x02, 0x40, 0x00, 0xFC, 0x00, 0xB8, 0x00, 0x07, 0xF9,
-    0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00,
-    0x50, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F,
-    0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F,
-    0xFC, 0x0B, 0xFF, 0xD1, 0xFF, 0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x4B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xAA, 0xAB, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xCF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xB0, 0x00, 0x07, 0xFF,
-    0x4F, 0x00, 0x00, 0xB4, 0xFF, 0xF0, 0x00, 0x07, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x0A, 0x00, 0x02, 0x40, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x0F, 0xF9, 0xBF, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x50, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x15, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0xFE,
-    0x00, 0x3F, 0xD0, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xF9, 0x42, 0xFF, 0xFF, 0x7F, 0xFC, 0x0B, 0xFF, 0xD1, 0xFF,
-    0x00, 0x05, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xE5, 0x7F, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2F,
-    0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFE, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xFE,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF8,
-    0x07, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x28, 0x00, 0x0F, 0xD0, 0x0B, 0x80, 0x00, 0x7F, 0xEB, 0xF0,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFD, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBE, 0x00, 0x05, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x1B, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xEF, 0xE0, 0x03, 0xFD, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x07, 0xFF, 0x94, 0x2F, 0xFF, 0xF7, 0xFF, 0xC0,
-    0xBF, 0xFD, 0x1F, 0xF0, 0x00, 0x54, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0,
-    0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0,
-    0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC,
-    0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55, 0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
-    0xFF, 0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xC1, 0xFC,
-    0x00, 0x00, 0x2D, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x5F, 0xFA, 0xAA, 0xBF,
-    0xC0, 0x2F, 0xC0, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x00, 0xB8, 0x02, 0xFC, 0x00, 0x01, 0xD0, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xAA, 0xAA, 0x40,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x04, 0x02, 0xFC, 0x00, 0x00, 0xB4, 0x0B, 0xF0, 0x00, 0x03, 0xE0, 0x2F, 0xC0, 0x00,
-    0x1F, 0x40, 0xBF, 0x56, 0xAA, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x05, 0x90, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x3D, 0x07, 0xD0, 0x00,
-    0xF0, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0xFF, 0x07, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x02, 0xF8,
-    0xFC, 0x00, 0x07, 0xE7, 0xF5, 0x55, 0x6F, 0xAF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xF6, 0xF8,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x42, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x1F, 0x80, 0x60, 0x00, 0x01, 0xFF, 0xC2, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x3E, 0x1F, 0xFD, 0x00, 0x00, 0x30, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B,
-    0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00,
-    0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFC, 0x0B, 0x00, 0x3F, 0xFC, 0x7D,
-    0x00, 0xF9, 0xFF, 0xF0, 0x03, 0xC0, 0xFF, 0x80, 0x01, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xF8,
-    0x03, 0xFC, 0x1F, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x1F, 0x9F, 0xD5, 0x55,
-    0xBE, 0xBF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xDB, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x95, 0x6D, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0x50, 0x78, 0x00, 0x00, 0x1F, 0xF0, 0x40, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x07, 0x80, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA,
-    0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07,
-    0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA,
-    0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF,
-    0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x1F, 0xC1, 0xFC,
-    0x00, 0x1F, 0xC0, 0x1F, 0x40, 0x02, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xF8, 0x03, 0xFC, 0x01, 0xF8,
-    0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x01, 0xF8, 0x1F, 0xD5, 0x55, 0xBE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xD0, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x95,
-    0x6D, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x50, 0xB8, 0x00, 0x00, 0x1F, 0xF0, 0x40,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x07,
-    0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0,
-    0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0,
-    0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1E,
-    0x00, 0x02, 0xFC, 0x10, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x1F, 0xC1, 0xFC, 0x01,
-    0xFC, 0x01, 0xF4, 0x02, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x3F, 0xC1, 0xF8, 0x00, 0x3F, 0x4F, 0xC0, 0x00,
-    0xBE, 0x3F, 0x00, 0x01, 0xF9, 0xFD, 0x55, 0x5B, 0xEB, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFD,
-    0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x56, 0xD0, 0xBF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0x9F,
-    0x80, 0x00, 0x00, 0x1C, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x1F, 0xE0, 0x74, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x07, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC,
-    0x00, 0x02, 0xE0, 0x0B, 0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02,
-    0xD0, 0x2F, 0xC0, 0x00, 0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x6B, 0x03, 0x40, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x02,
-    0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0x80, 0x03, 0xF4, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xF5, 0x55, 0x6F, 0x80, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE5, 0x5B, 0x40,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xC0, 0x00, 0x03, 0xFF, 0x8B, 0x40, 0x00, 0x0E, 0x1F, 0xFC,
-    0x00, 0x00, 0x20, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x07, 0x80,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x81, 0x7F, 0xEA, 0xAA, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x02, 0xE0, 0x0B,
-    0xF0, 0x00, 0x07, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x02, 0xFE, 0xAA, 0xA9, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x02, 0xD0, 0x2F, 0xC0, 0x00,
-    0x0F, 0x80, 0xBF, 0x00, 0x00, 0x7D, 0x02, 0xFD, 0x5A, 0xAB, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFD, 0x0A, 0x00, 0x3F, 0xFD, 0x7C,
-    0x00, 0xF0, 0xFF, 0xE0, 0x02, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x3F, 0xBF, 0x80, 0x03, 0xF0, 0x7F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0xA0,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xE0, 0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E,
-    0x7F, 0x55, 0x56, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE,
-    0x55, 0xB4, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0x83, 0xF4, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0B, 0x80, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x05, 0xFF, 0xAA, 0xAB, 0xFC, 0x02, 0xFC, 0x00, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0B, 0x80,
-    0x2F, 0xC0, 0x00, 0x1D, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFA, 0xAA, 0xA4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x0B, 0x40, 0xBF, 0x00,
-    0x00, 0x3E, 0x02, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xF5, 0x6A, 0xAF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x7E, 0x3F, 0x40, 0x03, 0xF0,
-    0x3F, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x60, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xE0, 0x0F, 0xF0, 0x7E, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x7E, 0x7F, 0x55, 0x56, 0xFA, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF,
-    0xFF, 0xFF, 0x6F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x55, 0xB4, 0x2F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xFD, 0x0F, 0x82, 0xF8, 0x3C, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-    0x0B, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xE0, 0x5F, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x40, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC0, 0x00, 0x64, 0x00,
-    0x2F, 0xFE, 0x02, 0xFE, 0xFD, 0x0F, 0x80, 0xF8, 0x2D, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xF4,
-    0x00, 0x7D, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF2,
-    0xFF, 0xFF, 0x81, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFD, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x03, 0xFF,
-    0xD0, 0x06, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02,
-    0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00,
-    0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4,
-    0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xF0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0,
-    0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4,
-    0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00,
-    0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7,
-    0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0x90, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02,
-    0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFB, 0xFC, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x01, 0x90, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03,
-    0xF8, 0x3F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F,
-    0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x50, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0x90, 0x02, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x3F, 0x81, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFB, 0xF8,
-    0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x2F, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x40, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0x7F, 0x40, 0x00, 0x1F, 0xC3, 0xF8, 0x00,
-    0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x83,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x38, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4,
-    0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xAE, 0x06, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBC, 0x00, 0x01, 0x90, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xD0, 0x1F, 0xF8, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x0B, 0xE0, 0x00, 0x0F, 0xE0,
-    0x3F, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0xC0,
-    0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0x00, 0x01,
-    0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0xE0, 0x0B, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC7, 0xC0, 0x00,
-    0x00, 0x03, 0xC3, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x80, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0x80, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF,
-    0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0D, 0x00, 0x00,
-    0xFF, 0xF6, 0xE0, 0x00, 0x1E, 0x1F, 0xFD, 0x00, 0x00, 0xD0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07,
-    0xF0, 0xBF, 0x00, 0x01, 0xF8, 0x01, 0xF4, 0x00, 0x19, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4,
-    0x07, 0xFE, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00,
-    0x00, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43,
-    0xFD, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xE4, 0x1B, 0xFF, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x07, 0xE0, 0x7E,
-    0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xF4, 0x07, 0xFE,
-    0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0xFC,
-    0xBF, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x43, 0xFD, 0x00,
-    0x07, 0xF0, 0x0F, 0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x69, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x50, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xFF,
-    0xE4, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x02, 0xFF, 0x90, 0x6F, 0xFF, 0x80, 0x02,
-    0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x05,
-    0x50, 0x0B, 0xE0, 0x02, 0xFF, 0xFD, 0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0x00, 0x03, 0xFD, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00,
-    0x03, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC1, 0xFD, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x03, 0xF4,
-    0x0F, 0xF4, 0x00, 0x1F, 0xC0, 0x0F, 0xF8, 0x02, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05, 0x50, 0x00, 0x3F,
-    0x40, 0x00, 0xBF, 0xFF, 0xE4, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x02, 0xFF, 0x90,
-    0x6F, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0xF4,
-    0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x15, 0x40, 0x2F, 0x80, 0x0B, 0xFF, 0xF4, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xD0, 0x1F, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xF4, 0x0B, 0xE0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x7F, 0x07,
-    0xF4, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0xE0,
-    0x0B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0x94, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x55, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x41, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFE, 0xFC, 0x00, 0x2F, 0xF9, 0x06, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0x00, 0x02,
-    0xFD, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x40,
-    0x00, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xC0,
-    0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xD0, 0x00,
-    0x0B, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x00,
-    0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xA0, 0x00, 0x01, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x55, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0xD3, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0x40, 0x7F, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0x80, 0x00, 0x3F, 0x80, 0xFC, 0x00, 0x00,
-    0xBF, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x0F, 0xC2,
-    0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x3F, 0x80,
-    0x00, 0x3F, 0x40, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x80, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0x90, 0x7F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x0B, 0xFE, 0x41, 0xBF, 0xFE, 0x00,
-    0x0B, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x6A,
-    0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0x80, 0x00, 0x0F, 0xFE, 0x2F,
-    0x00, 0x00, 0x7D, 0xBF, 0xFC, 0x00, 0x01, 0xE0, 0x7F, 0xD0, 0x00, 0x01, 0x40, 0x29, 0x06, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x54, 0x02, 0xF8, 0x00, 0xBF,
-    0xFF, 0x4F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x02, 0xFD, 0x01, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0xFF,
-    0x40, 0xBE, 0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0xBF,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00,
-    0x07, 0xF0, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0xFD, 0x03, 0xFD, 0x00, 0x07, 0xF0,
-    0x03, 0xFE, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x69, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xFF, 0xE4, 0x1F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0,
-    0x02, 0xFF, 0x90, 0x6F, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x55, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0xD3, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0x40, 0x7F, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0x80, 0x00, 0x3F, 0x80,
-    0xFC, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00,
-    0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x1F, 0xD0, 0x00, 0x07,
-    0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0x2F, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x6F, 0xD0, 0x00, 0x01,
-    0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xF9, 0x56,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x0B, 0xFF, 0x00, 0xBF, 0xF8, 0x01, 0xFF,
-    0xF0, 0x01, 0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC,
-    0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0x81, 0xBF, 0x40, 0x00, 0x06, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xE5, 0x5B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF8, 0x00,
-    0xBF, 0xF0, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xBF, 0x40, 0x00, 0x06, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2B, 0xF8, 0x00, 0xAF, 0xFF, 0x0B, 0xFF, 0x80, 0x1F, 0xFF,
-    0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0,
-    0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F,
-    0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xE0, 0x01, 0xBF, 0x40, 0x00, 0x06, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xE5,
-    0x5B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC2, 0xBF, 0x80, 0x0A, 0xFF, 0xF0, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01,
-    0xBF, 0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F,
-    0xE0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8,
-    0x3F, 0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00,
-    0x1B, 0xF4, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x55, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2B, 0xF8, 0x00, 0xAF, 0xFF, 0x0B, 0xFF, 0x80, 0x1F,
-    0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00,
-    0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00,
-    0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15, 0x40, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xA0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x83, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x6F, 0xD0,
-    0x00, 0x01, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x3D, 0x00, 0x00, 0x03, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x40,
-    0x19, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC2, 0xBF, 0x80, 0x0A, 0xFF, 0xF0, 0xBF, 0xF8, 0x01, 0xFF, 0xF0, 0x01, 0xBF,
-    0x80, 0x06, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03,
-    0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00,
-    0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xE0,
-    0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x3F,
-    0xFC, 0x00, 0x01, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x01, 0xBF, 0x40, 0x00, 0x06, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0xE5, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x2B, 0xF8, 0x00, 0xAF, 0xFF, 0x0B, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x1B, 0xF8, 0x00, 0x6F, 0xE0,
-    0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE,
-    0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x41,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x15,
-    0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xCB, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x06, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x01,
-    0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x7D,
-    0x00, 0x00, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xC1, 0xBF, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xCB, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF,
-    0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x0F, 0xC0, 0x01, 0xFF, 0xC0, 0x2F, 0xE0, 0xBF, 0xFF, 0x00, 0x2F, 0xD0, 0xBF, 0xFC, 0x00, 0x1F,
-    0xC0, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xF0, 0x6F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x7E, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFE,
-    0x00, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xEF, 0xE0, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x1E,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD,
-    0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01,
-    0xFC, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3D, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xC2, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF2, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xC1, 0xBF, 0xD0, 0x00,
-    0x0B, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFD,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x74, 0x00,
-    0x00, 0x7F, 0xF4, 0xF8, 0x00, 0x00, 0xBD, 0xBF, 0xF8, 0x00, 0x00, 0xB4, 0x2F, 0xF0, 0x00, 0x00,
-    0x10, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFE, 0x7F, 0xFF, 0x80, 0xBF, 0xFD, 0x0B, 0xF4, 0x00,
-    0x07, 0xF0, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00,
-    0x07, 0xE3, 0xD0, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00,
-    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
-    0x38, 0x2C, 0x1E, 0xB4, 0x07, 0xD0, 0x0B, 0xD0, 0x2F, 0xF4, 0x36, 0x9C, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x74, 0x3F, 0xFF, 0xFC, 0x75, 0x55, 0xB8, 0x70, 0x00, 0xE0, 0x70,
-    0x03, 0x80, 0x70, 0x0E, 0x00, 0x70, 0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00,
-    0x1E, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2E, 0x55, 0x5D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00,
-    0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE2,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x15, 0x55, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x68, 0x01, 0xA2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4,
-    0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F,
-    0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2,
-    0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F,
-    0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03,
-    0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0x40, 0xFC, 0xBD, 0x03, 0xF1, 0x50, 0x05, 0x40, 0x55,
-    0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x3E, 0x0B, 0xC0, 0xF4, 0x2F, 0x03, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x83, 0xFC,
-    0x05, 0x00, 0x05, 0x03, 0xF8, 0x3F, 0xC1, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0x42, 0xF0, 0x3D, 0x0B,
-    0x80, 0x10, 0x00, 0x2F, 0x43, 0xFC, 0x2F, 0xC0, 0xFC, 0x0F, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C,
-    0x0A, 0x00, 0x05, 0x03, 0xFC, 0x7F, 0x87, 0xF0, 0x7F, 0x03, 0xF0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0,
-    0x3D, 0x00, 0x40, 0x00, 0x40, 0x01, 0x00, 0xF8, 0x03, 0xC0, 0xBC, 0x03, 0xE0, 0x3D, 0x02, 0xF0,
-    0x2F, 0x00, 0xF8, 0x0F, 0xC0, 0x7E, 0x07, 0xF0, 0x2F, 0x41, 0xFC, 0x0F, 0xE0, 0x7F, 0x82, 0xFC,
-    0x0F, 0xF0, 0x3F, 0x80, 0x50, 0x01, 0x00, 0x05, 0x00, 0x10, 0x3F, 0x81, 0xFC, 0x3F, 0xC1, 0xFE,
-    0x1F, 0xC0, 0xBF, 0x0F, 0xC0, 0xBF, 0x0F, 0xC0, 0xBD, 0x1F, 0x40, 0xBC, 0x2F, 0x00, 0xF8, 0x3D,
-    0x01, 0xF0, 0xB8, 0x03, 0xD0, 0x10, 0x01, 0x00, 0x2F, 0x40, 0xB8, 0x3F, 0xC2, 0xFE, 0x2F, 0xC0,
-    0xFF, 0x0F, 0xC0, 0xBF, 0x0F, 0xC0, 0x7E, 0x0F, 0x80, 0xBD, 0x1F, 0x00, 0xFC, 0x3E, 0x01, 0xF4,
-    0x7C, 0x03, 0xE0, 0xA0, 0x03, 0x80, 0x05, 0x00, 0x10, 0x0F, 0xF0, 0x3F, 0x47, 0xF8, 0x2F, 0xD1,
-    0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0xC0, 0xBE, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x02, 0xF0,
-    0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x07, 0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00,
-    0x05, 0x40, 0xF4, 0x06, 0x3F, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xE5, 0x3D, 0x1A, 0xC0,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x3E, 0x00, 0x05, 0x40, 0xF4, 0x06, 0x3F, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0xE5,
-    0x3E, 0x1A, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x50, 0x0F, 0x80, 0x63, 0xFF, 0xBF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x6E, 0x93, 0xE1, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x29, 0x00, 0x00, 0x06,
-    0x90, 0x2F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFD, 0x7F, 0xFC, 0x3F, 0xF8, 0x0B, 0x90, 0x28, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x3F, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x2F, 0xFF, 0xFE, 0xFD, 0x14, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xFD, 0x03, 0xFE, 0x3F,
-    0xD0, 0x3F, 0xE3, 0xFC, 0x02, 0xFD, 0x05, 0x00, 0x05, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF2, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xEF, 0xD0,
-    0x00, 0xBF, 0x40, 0x02, 0xFD, 0x14, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x1F, 0xDB, 0xFE,
-    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x74,
-    0x38, 0x1F, 0xFC, 0x74, 0x05, 0xB8, 0x70, 0x00, 0xE0, 0x70, 0x03, 0x80, 0x70, 0x0E, 0x00, 0x70,
-    0x14, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0xF4, 0x1C,
-    0x2E, 0x50, 0x0D, 0x0B, 0x00, 0x0D, 0x02, 0xC0, 0x0D, 0x00, 0xB0, 0x0D, 0x00, 0x14, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xEA, 0x70, 0x38, 0xA2, 0xCA, 0x0A, 0x0A, 0x40, 0xA0, 0x10,
-    0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A,
-    0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00,
-    0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00,
-    0xA0, 0x00, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xD0, 0x00,
-    0x03, 0xC7, 0x80, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x3C, 0x38, 0xBF, 0xFF, 0xF0, 0xEB, 0x55, 0x6D,
-    0x2C, 0xA0, 0x07, 0x4B, 0x0A, 0x01, 0xD2, 0xC0, 0xA0, 0x74, 0xB0, 0x0A, 0x04, 0x04, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xA0, 0x00, 0x2D, 0x3C, 0x00,
-    0x0B, 0x4F, 0x00, 0x02, 0xC3, 0xC0, 0x00, 0xB0, 0xFF, 0xFF, 0xE3, 0x87, 0x95, 0x5E, 0x0E, 0x1D,
-    0x00, 0xA0, 0x38, 0x74, 0x0A, 0x00, 0xE1, 0xD0, 0xA0, 0x01, 0x01, 0x0A, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBE, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x7F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x40,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x02, 0xF0, 0x2D, 0x00, 0x64, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xD0, 0x0F, 0x81,
-    0xF0, 0x2F, 0xFE, 0x00, 0x07, 0xFF, 0xD0, 0x0F, 0xC0, 0xFC, 0x0F, 0x02, 0xFA, 0xFF, 0x00, 0x7F,
-    0xAF, 0xD0, 0x2F, 0xFF, 0xD0, 0x78, 0x1F, 0x40, 0xBD, 0x03, 0xF0, 0x0F, 0xC0, 0x1F, 0xFC, 0x03,
-    0xC0, 0xFC, 0x00, 0xF8, 0x1F, 0x40, 0x2F, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xE0, 0x03, 0xF0, 0xBC,
-    0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0x40, 0x0F, 0xC3, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x0F,
-    0x40, 0x7D, 0x00, 0x2F, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0xFC, 0x3F,
-    0x00, 0x1F, 0x40, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xE0, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x0F, 0xC0, 0x1F, 0x42, 0xF4, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x03,
-    0xF0, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xAF, 0xD0, 0x0B, 0xFA, 0xF8, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x0B, 0xD0, 0x3F, 0x41, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x0F, 0x80, 0xBC, 0x01, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x90, 0x0A, 0x00, 0xBD, 0x03, 0xE0, 0x3F, 0x42, 0xFC, 0x1F, 0xC0, 0xFE, 0x0F,
-    0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x43, 0xF4, 0x1F, 0xC0, 0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x1C,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x00, 0x60, 0x02, 0xF4, 0x0F, 0x80, 0xBC,
-    0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x82, 0xFC, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x1F,
-    0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x3E, 0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03,
-    0xD0, 0x2F, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0xF0,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xBD, 0x00, 0xFC, 0x01, 0xF0, 0x02, 0xC0, 0x00,
-    0x00, 0x18, 0x00, 0x60, 0x0B, 0xC0, 0x1F, 0x40, 0xFE, 0x02, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x3F,
-    0x80, 0xFE, 0x01, 0xFC, 0x03, 0xF0, 0x0B, 0xD0, 0x2F, 0x80, 0x3F, 0x00, 0xFC, 0x01, 0xF0, 0x03,
-    0xD0, 0x0B, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x2F, 0x00, 0x7D,
-    0x01, 0xF8, 0x0F, 0xE0, 0x2F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-    0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0xBD, 0x02, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F,
-    0x00, 0xBD, 0x01, 0xF0, 0x03, 0xD0, 0x0F, 0x80, 0x2C, 0x00, 0x70, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0x8F, 0x80,
-    0x07, 0xE0, 0x3E, 0x01, 0xF8, 0x00, 0xF8, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x04, 0x00, 0x3E, 0x00,
-    0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0xBF, 0x80, 0xFF, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x01,
-    0xF8, 0x00, 0x3E, 0x00, 0x05, 0x10, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x02, 0xFC,
-    0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xF8, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x02, 0xC3, 0xC0, 0x00,
-    0x40, 0x02, 0xE0, 0x3C, 0x00, 0xF8, 0x02, 0xE0, 0x03, 0xC0, 0x7F, 0x01, 0xE0, 0x00, 0x7C, 0x0B,
-    0x41, 0xF0, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80,
-    0xF0, 0x00, 0x00, 0x00, 0xB8, 0xF0, 0x00, 0x00, 0xFC, 0x0B, 0xF0, 0x1F, 0x40, 0x3F, 0x00, 0xF8,
-    0x0B, 0xE0, 0x0B, 0x80, 0xFF, 0x40, 0xF4, 0x00, 0x00, 0xB4, 0xF4, 0x00, 0x00, 0x00, 0xB4, 0x0F,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x40,
-    0xF0, 0x00, 0x78, 0x07, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x00,
-    0x1E, 0x1C, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0xA0,
-    0xFE, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0xFD, 0x1F, 0xD0, 0x07, 0xF4, 0x7F, 0x00, 0x1F, 0xC1, 0xFC,
-    0x00, 0x7F, 0x07, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x07, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x00,
-    0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x43, 0xFC,
-    0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0x14, 0x00, 0x05, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x50, 0x7F, 0xF9, 0xBF, 0xFE, 0x7F,
-    0xFD, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00,
-    0x01, 0xFE, 0x40, 0x03, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFC,
-    0x03, 0xEA, 0xFF, 0x00, 0x7E, 0xAF, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x1B,
-    0xFD, 0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x46, 0xF9, 0x00, 0x00, 0x0F, 0xD3, 0xFF, 0xF4, 0x00, 0x0B, 0xF1,
-    0xFF, 0xFF, 0x40, 0x02, 0xFC, 0x3E, 0xAF, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x2E, 0x00, 0xBE, 0x00,
-    0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x6F, 0xF4, 0x01, 0xF4, 0x07,
-    0xFF, 0xF8, 0x00, 0x7D, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0x40, 0xFF, 0xD0, 0x00, 0x03, 0xD0, 0x2F,
-    0x40, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x10,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x06, 0x80, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x07, 0xF8,
-    0x00, 0x00, 0x7F, 0x40, 0x54, 0x00, 0x00, 0x05, 0x40, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xBE, 0x40, 0x03, 0xF4, 0x00, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x7F, 0x00,
-    0x0F, 0xAB, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x1B, 0xFD, 0x3F, 0x00, 0x01, 0xFF, 0xFE, 0x0F, 0xC0, 0x00,
-    0xFF, 0xFE, 0x03, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1A, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F,
-    0x0B, 0xE5, 0xFF, 0xEB, 0xF8, 0x3C, 0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00,
-    0x90, 0x0A, 0x00, 0x60, 0x02, 0x40, 0x2F, 0x40, 0xF8, 0x0B, 0xC0, 0x7E, 0x03, 0xF4, 0x2F, 0xC0,
-    0xFD, 0x0B, 0xE0, 0x7F, 0x03, 0xF8, 0x2F, 0xC0, 0xFD, 0x0F, 0xE0, 0x7F, 0x03, 0xF4, 0x2F, 0xC1,
-    0xFC, 0x0F, 0xD0, 0x7F, 0x03, 0xF4, 0x3F, 0x41, 0xFC, 0x0F, 0xD0, 0x7E, 0x03, 0xE0, 0x3F, 0x01,
-    0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x2F, 0x01, 0xF4, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xFF,
-    0xC0, 0x7F, 0x47, 0xF8, 0x3F, 0x00, 0x3F, 0x1F, 0x80, 0x0B, 0xDB, 0xD0, 0x01, 0xF7, 0xF0, 0x00,
-    0x7E, 0xFC, 0x00, 0x1F, 0xBF, 0x00, 0x07, 0xEF, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0xFC, 0x7F, 0x00,
-    0x7F, 0x0F, 0xE0, 0x7F, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-    0x3F, 0xBC, 0x00, 0x2F, 0x2F, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0x82, 0xF0, 0x0F, 0xC0, 0xBC, 0x0B,
-    0xE5, 0x7F, 0x52, 0xFF, 0xFF, 0xFE, 0x2A, 0xAB, 0xFA, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0xFF, 0xFE, 0x0F, 0xAA, 0x90, 0xF4,
-    0x00, 0x0F, 0x00, 0x01, 0xFF, 0x90, 0x1F, 0xFF, 0x80, 0x06, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x7F, 0xCF, 0xFF, 0xF0, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0xBF, 0xE4, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0xB9, 0x00, 0xBF, 0xFF, 0xD0, 0xFE, 0x5B, 0xF4, 0xFC, 0x01, 0xFC, 0xFC, 0x00, 0xFC,
-    0xFC, 0x00, 0xFC, 0xBD, 0x00, 0xFC, 0x7F, 0x42, 0xF4, 0x2F, 0xFF, 0xF0, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3E, 0xAA, 0xFC, 0x3C, 0x01, 0xF4, 0x34, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0x80, 0xBC, 0x7D, 0x01, 0xF4,
-    0xF8, 0x07, 0xC3, 0xF8, 0x7E, 0x03, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0xBD, 0x7F, 0xCB, 0xD0, 0x2F,
-    0x7F, 0x00, 0x3E, 0xFC, 0x00, 0xFA, 0xF4, 0x0B, 0xD3, 0xFF, 0xFE, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xC1, 0xFC, 0xBC, 0x01, 0xFB, 0xF0,
-    0x03, 0xFF, 0xC0, 0x0F, 0xEF, 0x80, 0x3F, 0x3F, 0xE6, 0xFC, 0x3F, 0xFF, 0xE0, 0x1B, 0xBF, 0x00,
-    0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x02, 0xFD, 0x06, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xC7, 0xF8, 0x01, 0xFF, 0xBF, 0xF8, 0x01, 0xBF, 0x43, 0xF0, 0x01, 0xF4, 0x07, 0xC0, 0x07,
-    0xD0, 0x1F, 0x40, 0x1F, 0x40, 0x7D, 0x00, 0x7D, 0x01, 0xF4, 0x01, 0xF4, 0x07, 0xD0, 0x07, 0xD0,
-    0x1F, 0x40, 0x7F, 0xD0, 0xFF, 0x83, 0xFF, 0x8B, 0xFF, 0x00, 0x00, 0x19, 0x40, 0x00, 0xBF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xD0, 0xBE, 0x02, 0xFC, 0x3F, 0x00, 0x3F, 0x1F, 0x40, 0x0B, 0xDB, 0xC0, 0x01,
-    0xFB, 0xF0, 0x00, 0x7E, 0xFC, 0x00, 0x1F, 0xBF, 0x00, 0x07, 0xDB, 0xC0, 0x02, 0xF6, 0xF8, 0x00,
-    0xFC, 0x3F, 0x00, 0xBE, 0x0B, 0xFA, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x04,
-    0x00, 0x1B, 0xD0, 0x3F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x6F,
-    0xF9, 0x3F, 0xFF, 0xF0, 0x55, 0x54, 0x00, 0x69, 0x00, 0x0B, 0xFF, 0xC0, 0x3F, 0xEF, 0xF0, 0xBD,
-    0x03, 0xF4, 0xBC, 0x02, 0xF4, 0x28, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x2F,
-    0x40, 0x00, 0xBE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x01, 0x64, 0x00, 0x7F, 0xFE, 0x07, 0xFA, 0xFE, 0x2E, 0x00,
-    0xFC, 0x20, 0x03, 0xE0, 0x00, 0x2F, 0x40, 0x07, 0xF4, 0x02, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x5A, 0xFF, 0x0B, 0xFF, 0xE0, 0x0B,
-    0xA4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0xF0, 0x00, 0x3E, 0xBC, 0x00, 0x3F, 0x2F, 0x00, 0x2F, 0x0B, 0xC0, 0x1F, 0x42, 0xF0, 0x0F,
-    0x80, 0xBC, 0x0B, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFE, 0x05, 0x56, 0xF5, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xF4, 0x00,
-    0x0F, 0x00, 0x01, 0xF9, 0x00, 0x1F, 0xFE, 0x01, 0xBF, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xD5, 0x6F, 0xF8, 0xFF, 0xFD, 0x02, 0xE9, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0xFC, 0x07, 0xF8, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0xFC, 0xFC,
-    0x00, 0xFC, 0xBE, 0x00, 0xF8, 0x3F, 0xDB, 0xF4, 0x0F, 0xFF, 0xD0, 0x01, 0xB9, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0xF8, 0x38, 0x02, 0xF0, 0x24, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x65,
-    0x00, 0x2F, 0xFF, 0x42, 0xF9, 0xBF, 0x0F, 0x40, 0x7D, 0x7D, 0x01, 0xF0, 0xFC, 0x0B, 0xC1, 0xFD,
-    0xFC, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0xFC, 0x2F, 0xCB, 0xC0, 0x1F, 0xBE, 0x00, 0x3E, 0xFC,
-    0x00, 0xFA, 0xF9, 0x1F, 0xC3, 0xFF, 0xFC, 0x01, 0xAE, 0x40, 0x00, 0x64, 0x00, 0x3F, 0xFE, 0x03,
-    0xFE, 0xFE, 0x1F, 0x40, 0xBD, 0xFC, 0x00, 0xFB, 0xF0, 0x03, 0xFB, 0xC0, 0x0F, 0xDF, 0xC0, 0x3F,
-    0x2F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x05, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x0B, 0xFC,
-    0x07, 0xFF, 0x80, 0x0B, 0xA0, 0x00, 0x15, 0x55, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x07, 0xC0, 0x0F, 0xD0, 0x00,
-    0x3C, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFE, 0x55, 0x54,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x01, 0xAF, 0xEA, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0xFD, 0x01,
-    0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x2F, 0x40, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x04, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x50, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x55, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0A, 0xAF, 0xEA, 0xA4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2B, 0xFA, 0xAA,
-    0xAA, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFE, 0xBF, 0xFF, 0xFC, 0x07, 0x80, 0x00, 0x15, 0x40,
-    0x16, 0xAF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xFA, 0xA4, 0x02,
-    0xFE, 0x40, 0x3F, 0x40, 0x1F, 0xE2, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0xFE, 0x5B, 0xFE, 0x06,
-    0xBF, 0xAA, 0x03, 0xE0, 0x2E, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x74, 0x0F,
-    0xFF, 0xE4, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x40, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0x80, 0x3F, 0x07, 0xF9, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x1E, 0x00, 0xF9, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xFC, 0xBE, 0xAF, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x7D, 0x00, 0x0F,
-    0xF0, 0x00, 0x3D, 0x00, 0x2F, 0xC0, 0x00, 0x3C, 0x00, 0x3F, 0x40, 0x00, 0x20, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x16, 0xFD, 0x55, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x6B, 0xFE, 0xAA, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x55, 0xBD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF9, 0x56, 0xAA, 0xAA, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xAA, 0xAA, 0xAB, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0x6D, 0x7D,
-    0x2F, 0x4B, 0x47, 0xD7, 0x42, 0xE0, 0x74, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xAA, 0xAA, 0xA5,
-    0x5B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFA, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x60, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0x03, 0x42, 0xE0, 0x72, 0xF4, 0xB4, 0x7E, 0x2F, 0x2D, 0x7E, 0x02, 0xFB, 0xBE, 0x00, 0x2F, 0xFE,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x0F, 0x80,
-    0x0B, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00,
-    0x00, 0xF8, 0x0B, 0xE5, 0x55, 0x55, 0x6F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA,
-    0xAA, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x0B, 0xEE, 0xF8, 0x0F, 0xCB, 0x8F,
-    0xCB, 0xC2, 0xE0, 0xF8, 0xC0, 0xB8, 0x0C, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x80, 0xB8,
-    0x08, 0xBC, 0x2E, 0x0F, 0x8F, 0xCB, 0x8F, 0xC0, 0xFE, 0xEF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0xBE, 0xEF, 0x80, 0x0B, 0xDB, 0x9F, 0x80, 0xBD, 0x2E, 0x1F, 0x80, 0xD0,
-    0xB8, 0x1C, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x0D, 0x0B, 0x81, 0xC0, 0xBD, 0x2E, 0x1F, 0x80, 0xBD, 0xB9, 0xF8,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x20, 0x0B, 0x80, 0x2F, 0x02, 0xE0, 0x2F, 0x40, 0xB8, 0x2F,
-    0x40, 0x2E, 0x1F, 0x40, 0x0B, 0x9F, 0x95, 0x57, 0xEF, 0xFF, 0xFF, 0xF9, 0xFA, 0xAA, 0xA9, 0x2F,
-    0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x02, 0x00, 0x2E, 0x03, 0xE0,
-    0x0B, 0x80, 0x7E, 0x02, 0xE0, 0x07, 0xD0, 0xB8, 0x00, 0x7D, 0x2F, 0x55, 0x5B, 0xDB, 0xFF, 0xFF,
-    0xFD, 0xAA, 0xAA, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x80, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x2F, 0x07, 0xE5, 0x55, 0x55, 0xBC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBE, 0xAA, 0xAA, 0xAA, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xFA, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA, 0xAA, 0xAA, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x55, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xEF, 0x40,
-    0x00, 0x7D, 0x1F, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x7F, 0xD1, 0xFF, 0x47, 0xDF, 0x47, 0xDF, 0x49,
-    0x3D, 0x1F, 0x18, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D,
-    0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0xFF, 0xFF, 0xFE, 0xBF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0xAA, 0xAA, 0xAA, 0xAF, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0x55, 0x55, 0x55, 0x55, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00,
-    0x3D, 0x1F, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x05, 0x3D,
-    0x1F, 0x14, 0x7C, 0xF4, 0x7C, 0xF4, 0xBF, 0xD1, 0xFF, 0x80, 0xBF, 0x47, 0xF8, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0xBD, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFA, 0xAA, 0xAA,
-    0xAB, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x3E, 0x55, 0x55, 0x55, 0x6F, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0xC0, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xAA, 0xAF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7D, 0x00, 0x00, 0x00, 0x07,
-    0xF2, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x07, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xAF, 0x9F,
-    0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x5F, 0xFC, 0x03, 0xF4, 0x00, 0xBF, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0,
-    0x00, 0x3F, 0x07, 0xF0, 0x00, 0x0F, 0x81, 0xF8, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x02, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFF, 0x42, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xEA, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF3, 0xFF,
-    0xFF, 0xBF, 0xCF, 0xFF, 0xFF, 0xFF, 0x3A, 0xAA, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xBF, 0xBA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x07, 0xFF,
-    0xF9, 0x02, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF1, 0xF8, 0x00, 0x3F, 0xFA, 0x5B, 0xFF, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFF, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x41, 0xFC,
-    0x00, 0x00, 0xFC, 0x0B, 0xE0, 0xBE, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x7E, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x83, 0xF4, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xBD, 0x00,
-    0xFD, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFE, 0x41, 0x7F, 0xF0, 0x00,
-    0x7E, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x0A, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x00, 0x07, 0xDB, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0x0F, 0x43, 0xF8, 0x00, 0x00, 0x2F, 0x02, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00,
-    0x00, 0x7D, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x02,
-    0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00,
-    0x02, 0xFC, 0xBF, 0x95, 0x55, 0x5B, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFE, 0xAA, 0x5A, 0xAB,
-    0xF0, 0xFF, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0xBF, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0xBF, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x7D, 0x00,
-    0x00, 0x7F, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xC0, 0x00,
-    0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x0F, 0xE1, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xAA, 0x80, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0xF4, 0x00, 0x2F, 0xD0, 0x00,
-    0xBC, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0xEA, 0xAA, 0xFF,
-    0xBF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xBD, 0x00, 0x07, 0xC0,
-    0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7C, 0x00,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xEB, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xFA, 0xAA, 0xAA, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xF9, 0x55, 0x55, 0x54, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFA, 0xAA, 0xAA, 0xAB, 0xE2, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF9, 0x55, 0x55, 0x55, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xFF, 0xEA, 0xAA, 0xAB, 0xFA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0xAA, 0xAA,
-    0xAB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0,
-    0x02, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0xC0, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0xAF, 0xFB, 0xFE, 0xAA, 0xAF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFE, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xC0,
-    0xFF, 0x00, 0x00, 0x01, 0xFA, 0xFF, 0x02, 0xAA, 0xAA, 0xBF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xAB,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD1, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x7F, 0xFA, 0xAA, 0xAB, 0xFE, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF4, 0x02, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xAA, 0xAA, 0xFC,
-    0x0B, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xFD, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00,
-    0x7F, 0xC0, 0x00, 0x18, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x1E, 0x03,
-    0xF8, 0x00, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x08, 0x03, 0xD0, 0x14, 0x7E, 0x0B, 0x43, 0xF0, 0xFF, 0x6D,
-    0xBF, 0x80, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD,
-    0x07, 0xF8, 0xB5, 0xFF, 0x0F, 0x43, 0xD0, 0xB8, 0x10, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4,
-    0x1F, 0x40, 0xFC, 0x3E, 0x00, 0x3D, 0x3D, 0x00, 0x3E, 0x3D, 0x00, 0x3E, 0x3E, 0x00, 0x3D, 0x2F,
-    0x40, 0xFC, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xE3,
-    0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFE, 0x00, 0x0B, 0xD0, 0x0F, 0xFF, 0xC0,
-    0x03, 0xF0, 0x02, 0xAB, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80,
-    0x3F, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x42,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0x6F,
-    0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xB9, 0x00, 0x2F, 0x0F,
-    0xFF, 0x80, 0xBE, 0x2F, 0x9B, 0xE1, 0xF4, 0x3D, 0x01, 0xFB, 0xC0, 0x7C, 0x00, 0x7F, 0x40, 0xBC,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xFB, 0xC0, 0x3F, 0x9B, 0xD2, 0xF4, 0x1F,
-    0xFF, 0x40, 0xFE, 0x02, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x00, 0x0B, 0xE0,
-    0x02, 0xFF, 0xE0, 0x1F, 0xFF, 0x02, 0xF9, 0xBE, 0x1F, 0x9F, 0xE0, 0xF8, 0x07, 0xEF, 0x00, 0xBC,
-    0x3C, 0x00, 0xBF, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x80, 0x03, 0xC7, 0xC0, 0x07, 0xF4, 0x01, 0xF0,
-    0xF4, 0x07, 0xEF, 0x00, 0xBC, 0x3F, 0x9B, 0xD3, 0xF9, 0xBD, 0x03, 0xFF, 0xD0, 0x2F, 0xFE, 0x00,
-    0x2F, 0x80, 0x01, 0xBD, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x29, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x15, 0x29, 0x02, 0x93, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F,
-    0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07,
-    0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3,
-    0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0,
-    0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE3, 0xF0, 0x7E,
-    0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x07, 0xE1, 0x50, 0x15, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0x80, 0x00, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD7, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x0B, 0xD2, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x95, 0xBF, 0xF0, 0x1F,
-    0xD0, 0x00, 0x1F, 0xD0, 0xFD, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0x00, 0xBD, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F,
-    0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0,
-    0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00,
-    0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA,
-    0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00,
-    0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00,
-    0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF,
-    0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00,
-    0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0x07,
-    0xEB, 0xD0, 0x00, 0x00, 0x1F, 0xAF, 0x40, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x02, 0xF5, 0xFC,
-    0x00, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xF9, 0x45,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07,
-    0xE0, 0x7D, 0x00, 0x00, 0xFD, 0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0xD0, 0x00,
-    0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00,
-    0x00, 0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x06, 0x43, 0xFC, 0x3F, 0xD3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0xD3, 0xFD, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x14, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x03,
-    0xFD, 0x2F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0x40, 0x1F, 0x0B, 0xE5,
-    0xFF, 0xEB, 0xF8, 0x3C, 0x00, 0x6F, 0xFF, 0x80, 0x50, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0x80, 0xFF, 0xFF, 0x80, 0x1F, 0x0F, 0xD1, 0xBF, 0xFB, 0xF4,
-    0x3C, 0x00, 0x2F, 0xFF, 0x40, 0x50, 0x00, 0x05, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x05, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x04, 0x0B, 0xFF, 0x40, 0x2E, 0x2F, 0xFF, 0xF4, 0x7E, 0x3F,
-    0x07, 0xFF, 0xFC, 0x3C, 0x00, 0xBF, 0xF0, 0x04, 0x00, 0x05, 0x40, 0x02, 0xF8, 0x00, 0x08, 0x0F,
-    0xFF, 0x80, 0x3E, 0x3F, 0xFF, 0xF9, 0xBE, 0x3E, 0x02, 0xFF, 0xFC, 0x3C, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x40, 0x00, 0x5B, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA9, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xEA,
-    0xAA, 0xFF, 0xC2, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x01, 0xF0, 0x05, 0x55, 0x5F, 0x94, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x55, 0xF9, 0x55, 0x4B, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xFD, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xE0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xE0,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x07,
-    0xFF, 0x40, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x56, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x55, 0x55, 0x55, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFE, 0x95, 0xBE, 0x55, 0x47, 0xF8, 0x00, 0x3F, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0xBE, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x40, 0x00, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0xBE,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x7F,
-    0x80, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0xBE, 0x55, 0x55, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x55, 0x55, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x55, 0x55,
-    0x6F, 0xAF, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0x0B, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x40, 0x01, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xF4, 0x15, 0x5F, 0x95,
-    0x6F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x56, 0xF9, 0x55,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFE, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xFD, 0x07, 0x41, 0xFD, 0x00, 0x01, 0xF4, 0x01, 0xD0, 0x0B, 0xD0, 0x00, 0xF4,
-    0x00, 0x74, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x1D, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x07, 0x40, 0x00,
-    0xF4, 0x2D, 0x00, 0x01, 0xD0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC3, 0xC0, 0x00,
-    0x1D, 0x00, 0x00, 0xF1, 0xF5, 0x55, 0x5B, 0x95, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5F, 0xAA, 0xAA, 0xFE, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07,
-    0x40, 0x00, 0x3C, 0x3D, 0x00, 0x01, 0xD0, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x74, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x1D, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x07, 0x40, 0x03, 0xD0, 0x02, 0xF0, 0x01, 0xD0,
-    0x03, 0xE0, 0x00, 0x2F, 0x80, 0x74, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x6E, 0x6F, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01,
-    0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF1, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAB, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01,
-    0xFD, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFB,
-    0xE0, 0x00, 0x03, 0xFB, 0xC0, 0x7C, 0x3E, 0x00, 0x03, 0xF0, 0xF4, 0x2D, 0x03, 0xE0, 0x03, 0xF0,
-    0x1E, 0x0F, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0xC3, 0xC0, 0x03, 0xE3, 0xF0, 0x00, 0xF1, 0xE0, 0x00,
-    0x3F, 0xF0, 0x00, 0x2D, 0x78, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0x5E, 0x00, 0x03, 0xFE, 0x00, 0x02,
-    0xD3, 0xC0, 0x03, 0xF7, 0xE0, 0x00, 0xF0, 0xF0, 0x03, 0xF0, 0x3E, 0x00, 0x3C, 0x3D, 0x03, 0xF0,
-    0x03, 0xE0, 0x1F, 0x07, 0x83, 0xF0, 0x00, 0x3E, 0x0B, 0x40, 0xF7, 0xF0, 0x00, 0x03, 0xE7, 0xC0,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00,
-    0x0B, 0xE0, 0x00, 0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xFB, 0xC0, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0xF4, 0x2D, 0x00, 0x00, 0x02, 0xF0, 0x1E, 0x0F, 0x00,
-    0x00, 0x02, 0xF0, 0x03, 0xC3, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0xF1, 0xE0, 0x00, 0x02, 0xF0, 0x00,
-    0x2D, 0x78, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0x5E, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xD3, 0xC0, 0x02,
-    0xF0, 0x00, 0x00, 0xF0, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x3D, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x07, 0x82, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0xF6, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x01, 0xFE, 0x55, 0x6F, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFE, 0x2F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xDB, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x10, 0x00, 0x00, 0x40,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xBE, 0x40, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x43, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFE, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t bookerly_16_regularBitmaps[46756] = {
+    0x1A, 0xAA, 0x1E, 0xA1, 0xE9, 0x09, 0xE9, 0x09, 0xE1, 0x9E, 0x19, 0xE1, 0x9E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2A, 0xD2, 0xAD, 0x39, 0x77, 0x9A, 0xA9, 0x1F, 0x1F, 0x1F, 0x29,
+    0x91, 0x19, 0x92, 0x9A, 0x90, 0xDA, 0x19, 0xD9, 0x9D, 0xA1, 0xAD, 0x99, 0xDA, 0x1A, 0xD9, 0x9D,
+    0xA1, 0xAD, 0x1D, 0x91, 0xAD, 0x1D, 0x91, 0xAD, 0x1D, 0x91, 0x9D, 0x1D, 0x91, 0x9D, 0x1D, 0x29,
+    0xD7, 0x20, 0x79, 0x94, 0x99, 0x73, 0xD4, 0xD7, 0x29, 0xD3, 0x9C, 0xA7, 0x2A, 0xCA, 0x3A, 0xC9,
+    0x72, 0xD9, 0x3D, 0x79, 0x99, 0x9D, 0x99, 0x99, 0x9D, 0x99, 0x99, 0x2A, 0xFF, 0xFF, 0xC2, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xAE, 0xAA, 0xA9, 0x6D, 0x93, 0xD9, 0x72, 0xD4, 0xD7, 0x29, 0xD3, 0x9D, 0x72,
+    0xAC, 0xA3, 0xAC, 0xA7, 0x2D, 0x93, 0xD9, 0x6F, 0xFF, 0xFC, 0x91, 0x9F, 0xFF, 0xFC, 0x6A, 0xD3,
+    0xAC, 0xA7, 0x2A, 0xC9, 0x3D, 0x97, 0x2D, 0x93, 0xD7, 0x3D, 0x39, 0xD7, 0x29, 0xD3, 0xAC, 0xA7,
+    0x39, 0x59, 0x70, 0x77, 0x7D, 0x97, 0x4D, 0x97, 0x4D, 0x75, 0xD7, 0x39, 0x9D, 0xA9, 0x79, 0xFF,
+    0xC4, 0x9F, 0xDA, 0xF3, 0xE1, 0xD1, 0xEA, 0x1A, 0xD2, 0xD2, 0xDA, 0x1E, 0x2D, 0x2D, 0x91, 0xE2,
+    0xD2, 0xA9, 0x2E, 0x91, 0xD7, 0xAE, 0x90, 0xD7, 0x0F, 0xDA, 0x71, 0xAF, 0xCA, 0x97, 0x09, 0xFE,
+    0x71, 0x9F, 0xD9, 0x79, 0xCA, 0x0F, 0x79, 0xC9, 0x1E, 0x91, 0xCA, 0x29, 0xC9, 0x19, 0xDA, 0x0E,
+    0x2A, 0xC9, 0x19, 0xDA, 0x0E, 0x2A, 0xC9, 0x1A, 0xD9, 0x0E, 0xA1, 0xAC, 0x91, 0xE1, 0xAF, 0x9A,
+    0xC9, 0x9E, 0x92, 0xAF, 0xFD, 0x94, 0x9A, 0xFD, 0xA7, 0x2D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D,
+    0x75, 0xD7, 0x76, 0x77, 0x4A, 0x72, 0x9A, 0xDA, 0x97, 0x1A, 0xD7, 0x0A, 0xFD, 0xA7, 0x9D, 0x97,
+    0xAD, 0xA0, 0x9E, 0x96, 0xDA, 0x70, 0xDA, 0x3E, 0x59, 0xD7, 0x0A, 0xD4, 0xAD, 0x5D, 0xA7, 0x0E,
+    0x4A, 0xD4, 0x9D, 0x71, 0xE4, 0x9D, 0x93, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x2A, 0xCA, 0x72, 0xE4,
+    0xAD, 0x3D, 0x73, 0xE4, 0xAD, 0x2A, 0xC9, 0x39, 0xA9, 0x4A, 0xD9, 0x3D, 0xA1, 0x9D, 0x2A, 0xFC,
+    0xA3, 0xE2, 0xE2, 0xD2, 0xAD, 0xAA, 0xF2, 0xAF, 0xE9, 0x19, 0xCA, 0x19, 0xD9, 0x2A, 0xD9, 0x29,
+    0xFC, 0x3D, 0x2E, 0x4D, 0xA7, 0x3A, 0xCA, 0x2D, 0xA4, 0xE7, 0x29, 0xD2, 0x9D, 0x94, 0xE7, 0x2D,
+    0x92, 0x9D, 0x94, 0xAD, 0x71, 0xAD, 0x39, 0xD9, 0x4E, 0x71, 0xD9, 0x4D, 0xA4, 0xDA, 0x70, 0xDA,
+    0x5E, 0x39, 0xD9, 0x79, 0xD6, 0xAD, 0x92, 0xE7, 0x0D, 0xA7, 0xEA, 0xAE, 0x97, 0xAD, 0x71, 0xFD,
+    0x97, 0x0A, 0xC9, 0x72, 0x99, 0x99, 0x73, 0x97, 0x73, 0x79, 0xF9, 0x77, 0x09, 0xFF, 0x77, 0xE9,
+    0x99, 0xE9, 0x75, 0xE3, 0x9D, 0xA7, 0x5E, 0x4D, 0xA7, 0x49, 0xDA, 0x4D, 0xA7, 0x49, 0xDA, 0x39,
+    0xD7, 0x59, 0xDA, 0x3D, 0xA7, 0x59, 0xE2, 0xAD, 0x77, 0xE2, 0xCA, 0x77, 0x0E, 0xA7, 0x73, 0xFC,
+    0x4A, 0xFE, 0x5F, 0xDA, 0x3F, 0xF4, 0xE9, 0x0E, 0x94, 0xAD, 0x95, 0xAD, 0xA1, 0x9E, 0x49, 0xD9,
+    0x5E, 0x3A, 0xE4, 0xD9, 0x5E, 0x4F, 0x3D, 0x95, 0xE5, 0xF9, 0x09, 0xD9, 0x5E, 0x6F, 0xAA, 0xD6,
+    0xEA, 0x6A, 0xFC, 0xA6, 0xAE, 0x96, 0x9F, 0xC9, 0x6F, 0xA5, 0xAF, 0xE9, 0x5F, 0xFF, 0xCA, 0xFE,
+    0xA3, 0xAF, 0xFC, 0xA2, 0x9F, 0xC9, 0x69, 0x99, 0x99, 0x70, 0x99, 0x10, 0x19, 0x90, 0xDA, 0x9D,
+    0xA9, 0xDA, 0x9D, 0xA0, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD4, 0x77, 0x19, 0xC9, 0x69, 0xDA,
+    0x59, 0xDA, 0x6E, 0x6E, 0x69, 0xDA, 0x6E, 0x69, 0xD9, 0x6E, 0x7D, 0xA6, 0xAD, 0x96, 0xE7, 0xE6,
+    0x9E, 0x69, 0xDA, 0x69, 0xDA, 0x69, 0xDA, 0x69, 0xE6, 0x9E, 0x7E, 0x7E, 0x96, 0xAD, 0xA6, 0x9E,
+    0x7E, 0x96, 0xAE, 0x7E, 0x96, 0x9E, 0x7F, 0x7E, 0xA7, 0xEA, 0x7E, 0x70, 0x91, 0x73, 0xAC, 0xA7,
+    0xEA, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xE9, 0x6A, 0xE7, 0xE9, 0x6A, 0xDA, 0x69, 0xE7,
+    0xE7, 0xE9, 0x6E, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0xE7, 0xE7, 0xE6, 0x9D,
+    0x96, 0xE7, 0xDA, 0x6A, 0xD7, 0xDA, 0x6E, 0x6A, 0xD9, 0x59, 0xDA, 0x6E, 0x6A, 0xD7, 0x09, 0x70,
+    0x5D, 0x94, 0xA2, 0xE3, 0xAD, 0x1D, 0x93, 0xF9, 0xCA, 0x59, 0xF9, 0xAD, 0x4A, 0xFD, 0x91, 0xAD,
+    0xAC, 0x09, 0xAC, 0x1E, 0xA0, 0xCA, 0x49, 0xCA, 0x1D, 0x59, 0x2D, 0xA7, 0x0A, 0xA3, 0x69, 0x74,
+    0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x69, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x90,
+    0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC6, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73,
+    0xD9, 0x50, 0x29, 0xDA, 0x3F, 0x3A, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x39, 0xDA, 0x3E, 0x39, 0xD9,
+    0x3A, 0xC9, 0x73, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00, 0x0A, 0xD0, 0xAE, 0xAF, 0xCA,
+    0xE9, 0x09, 0x91, 0x72, 0xAC, 0xA7, 0x19, 0xD9, 0x71, 0xE7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7,
+    0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0xAD,
+    0x72, 0xE7, 0x19, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xE7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7,
+    0x19, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0x99, 0x97, 0x20, 0x59, 0xAA, 0xDA, 0x97, 0x2F, 0xFC,
+    0x96, 0x9F, 0xFE, 0xA5, 0xF3, 0x9F, 0x93, 0xAE, 0x6F, 0x3E, 0x96, 0xAE, 0x2A, 0xE7, 0x0E, 0xA1,
+    0xEA, 0x70, 0xEA, 0x1E, 0x97, 0x0A, 0xE0, 0x9E, 0x71, 0xAE, 0x09, 0xE7, 0x1A, 0xE0, 0x9E, 0x71,
+    0x9E, 0x0A, 0xE7, 0x1A, 0xE0, 0x9E, 0x71, 0xAE, 0x09, 0xE7, 0x1A, 0xE0, 0x9E, 0x97, 0x0E, 0xA1,
+    0xEA, 0x70, 0xE9, 0x1F, 0x79, 0xE2, 0xAE, 0x96, 0xEA, 0x3F, 0x5A, 0xE4, 0x9F, 0x91, 0x9F, 0x95,
+    0xAF, 0xFD, 0x97, 0x9F, 0xEA, 0x74, 0x99, 0x99, 0x70, 0x6A, 0x97, 0x9A, 0xE4, 0x9F, 0xDA, 0x3F,
+    0xFA, 0x39, 0xFE, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7,
+    0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7,
+    0x0E, 0xA6, 0x9A, 0xFA, 0x99, 0x1F, 0xFE, 0x99, 0xFF, 0xE9, 0x49, 0xAE, 0xA9, 0x7A, 0xFF, 0xC5,
+    0xFC, 0xAA, 0xFC, 0x3A, 0xE4, 0xFA, 0x2E, 0x6F, 0x19, 0xDA, 0x6F, 0x19, 0xDA, 0x6A, 0xE2, 0x9A,
+    0x96, 0xF7, 0x4E, 0xA7, 0x39, 0xE7, 0x4E, 0xA7, 0x3F, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x97,
+    0x2A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x39, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1,
+    0xFF, 0xFD, 0x90, 0x49, 0xAE, 0xA9, 0x6A, 0xFF, 0xA4, 0xFC, 0xAA, 0xFA, 0x2F, 0x4F, 0x2E, 0x6E,
+    0x29, 0xC7, 0xE9, 0x72, 0x9E, 0x73, 0xAD, 0xA7, 0x2A, 0xE7, 0x19, 0xF7, 0x9A, 0xFC, 0x97, 0xFF,
+    0xC6, 0xAC, 0xAA, 0xAF, 0xC7, 0x39, 0xEA, 0x73, 0xF7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x2A,
+    0xE9, 0x71, 0xFA, 0x79, 0xFD, 0x3F, 0xFD, 0xA4, 0xAF, 0xEA, 0x70, 0x99, 0x99, 0x70, 0x72, 0x9A,
+    0xC7, 0x5F, 0x74, 0xFC, 0x73, 0xAF, 0xC7, 0x29, 0xFD, 0x72, 0xEA, 0xE7, 0x1A, 0xDA, 0x0E, 0x70,
+    0x9E, 0x1E, 0x70, 0xE2, 0xE7, 0xE9, 0x2E, 0x6A, 0xDA, 0x3E, 0x59, 0xE4, 0xE5, 0xE5, 0xE4, 0xAD,
+    0x95, 0xE3, 0x9E, 0x59, 0xE3, 0xAF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x09, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAE, 0xAA, 0xAA, 0x72, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6A, 0xA9, 0x30, 0x39, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0xE3, 0x9F, 0xFE, 0x3A, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74,
+    0xE7, 0x4E, 0x74, 0xFD, 0xA7, 0x0F, 0xFA, 0x6F, 0xFD, 0x70, 0x9A, 0xFD, 0x72, 0x9F, 0x97, 0x29,
+    0xEA, 0x73, 0xF7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2F, 0x71, 0x9F, 0x97, 0x9F, 0xC9, 0x29,
+    0xFF, 0xD9, 0x4F, 0xF9, 0x79, 0x99, 0x99, 0x70, 0x71, 0xAE, 0xA7, 0x09, 0xFF, 0x6A, 0xFC, 0xA9,
+    0x7F, 0xC9, 0x71, 0xFA, 0x72, 0xAE, 0x97, 0x29, 0xE9, 0x73, 0xF7, 0x39, 0xE7, 0x4A, 0xFF, 0xCA,
+    0x5F, 0xFF, 0x93, 0xEA, 0x99, 0x99, 0xAF, 0x91, 0x9E, 0x6F, 0x19, 0xE6, 0x9E, 0xA0, 0x9E, 0x7F,
+    0x09, 0xE7, 0xAE, 0x09, 0xE9, 0x6A, 0xE1, 0xEA, 0x6A, 0xE1, 0xF6, 0xEA, 0x19, 0xEA, 0x49, 0xE3,
+    0xFC, 0x91, 0xAE, 0xA4, 0xFF, 0xDA, 0x6A, 0xFE, 0x97, 0x19, 0x99, 0x96, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x9A, 0xD7, 0xEA, 0x0A, 0xD6, 0x9E, 0x1A, 0xCA, 0x6E, 0x92, 0x96, 0xAD, 0xA7, 0x29, 0xE7, 0x3E,
+    0x97, 0x29, 0xE7, 0x3E, 0x97, 0x29, 0xE7, 0x3E, 0x97, 0x29, 0xE7, 0x3E, 0xA7, 0x3E, 0x73, 0xAE,
+    0x73, 0xEA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0x9E, 0x74, 0xDA, 0x75, 0x99, 0x70, 0x5A, 0xEA, 0xA7,
+    0x0A, 0xFF, 0xA5, 0xFA, 0xAA, 0xF9, 0x3A, 0xE4, 0xF3, 0xE6, 0xE9, 0x19, 0xE6, 0xE9, 0x19, 0xE6,
+    0xE3, 0xE9, 0x49, 0xE3, 0xAE, 0xA2, 0x9E, 0x5F, 0xC9, 0xAE, 0x96, 0xAF, 0xDA, 0x71, 0xFE, 0x96,
+    0x9E, 0xAF, 0xCA, 0x4A, 0xE2, 0x9F, 0xA2, 0x9E, 0x5F, 0x91, 0xE9, 0x6F, 0x09, 0xE7, 0xAE, 0x09,
+    0xE7, 0x9E, 0x09, 0xE7, 0xAE, 0x1E, 0xA6, 0xE9, 0x1A, 0xF9, 0x2A, 0xF3, 0xAF, 0xFE, 0x59, 0xFF,
+    0x97, 0x19, 0x99, 0x96, 0x4A, 0xEA, 0x97, 0xAF, 0xF9, 0x4F, 0xFE, 0xA2, 0xAE, 0x92, 0x9F, 0x91,
+    0xE9, 0x5F, 0x09, 0xE6, 0xAE, 0x0A, 0xE7, 0xE9, 0xAE, 0x7E, 0xAA, 0xE7, 0xEA, 0x9E, 0x7E, 0xA0,
+    0xF6, 0xEA, 0x0A, 0xF5, 0xEA, 0x1F, 0xEA, 0xFC, 0x92, 0xAF, 0xFE, 0x59, 0xAA, 0xAA, 0xAF, 0x73,
+    0xE9, 0x72, 0xF7, 0x2A, 0xE9, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x9A, 0xFA, 0x49, 0xAF, 0xE9, 0x59,
+    0xFD, 0x97, 0x19, 0x99, 0x72, 0x19, 0x19, 0xE9, 0xFF, 0xCA, 0x0E, 0x77, 0x77, 0x71, 0xAD, 0x0A,
+    0xEA, 0xFC, 0xAE, 0x90, 0x99, 0x10, 0x39, 0x94, 0xF2, 0x9F, 0x91, 0x9F, 0x3A, 0xD9, 0x77, 0x77,
+    0x77, 0x77, 0x39, 0xDA, 0x3F, 0x3A, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x39, 0xDA, 0x3E, 0x39, 0xD9,
+    0x3A, 0xC9, 0x73, 0x73, 0x97, 0x39, 0xD9, 0x70, 0x9F, 0xC6, 0x9F, 0xC9, 0x59, 0xFC, 0x95, 0x9F,
+    0xC9, 0x59, 0xFC, 0x97, 0xAE, 0x97, 0x19, 0xFA, 0x72, 0x9F, 0xA7, 0x2A, 0xFA, 0x72, 0xAF, 0xA7,
+    0x2A, 0xFA, 0x72, 0xF7, 0x39, 0xC9, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xFC, 0x0A, 0xFF, 0xFC, 0x77, 0x77, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xFC, 0x09, 0xFF, 0xFC, 0x00, 0x09, 0x75, 0xD9, 0x72, 0x9F, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC,
+    0x97, 0x19, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xF7, 0x19, 0xF7, 0x9F, 0xA6, 0x9F, 0xA6, 0xAF, 0xA6,
+    0xAF, 0xA7, 0x0E, 0xA7, 0x2A, 0xA7, 0x77, 0x20, 0x09, 0xAD, 0xA9, 0x5F, 0xE9, 0x29, 0xFF, 0x92,
+    0xDA, 0xAA, 0xF7, 0x0A, 0xE7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xAC, 0xA7, 0x0E, 0x7A, 0xDA, 0x49,
+    0xAF, 0x91, 0x9F, 0xEA, 0x2F, 0xEA, 0x3F, 0xC9, 0x5A, 0xD9, 0x79, 0xD7, 0x1D, 0x71, 0x97, 0x77,
+    0x72, 0x9A, 0xA7, 0x9E, 0xA6, 0xAF, 0x69, 0xEA, 0x79, 0x99, 0x50, 0x75, 0x99, 0x99, 0x97, 0x73,
+    0xAF, 0xFD, 0xA9, 0x75, 0xAF, 0xFF, 0xE7, 0x29, 0xFA, 0x95, 0x9A, 0xF9, 0x7A, 0xEA, 0x73, 0xAE,
+    0x95, 0xAE, 0x76, 0xAE, 0x4A, 0xE7, 0x70, 0xAD, 0xA3, 0xE6, 0x9A, 0xAA, 0x96, 0xE2, 0xE9, 0x4A,
+    0xFD, 0xA5, 0xAD, 0x91, 0xE4, 0xEA, 0x99, 0xE9, 0x49, 0xDA, 0x0A, 0xDA, 0x39, 0xD9, 0x29, 0xDA,
+    0x5E, 0x0E, 0x5D, 0x4D, 0xA5, 0xE0, 0xE7, 0x4D, 0xA5, 0xE9, 0xE7, 0x29, 0x9D, 0xA5, 0xE9, 0xDA,
+    0x69, 0xAF, 0xDA, 0x5D, 0xA9, 0xDA, 0x5A, 0xEA, 0x9A, 0xDA, 0x49, 0xD9, 0x9D, 0xA4, 0x9D, 0x93,
+    0xDA, 0x4A, 0xD0, 0x9E, 0x4E, 0x4D, 0xA3, 0x9D, 0xA1, 0xE4, 0xE3, 0xAE, 0x29, 0xE2, 0xE4, 0xAE,
+    0x99, 0xFF, 0xE3, 0xAD, 0x94, 0xFD, 0xA0, 0xFD, 0xA4, 0x9E, 0x5A, 0xDA, 0x92, 0x9A, 0xA9, 0x7E,
+    0xA7, 0x77, 0x09, 0xE9, 0x77, 0x70, 0xAE, 0xA7, 0x77, 0x0A, 0xF9, 0x72, 0x9D, 0x71, 0x9F, 0xDA,
+    0x99, 0x99, 0x9A, 0xFC, 0x73, 0xAF, 0xFF, 0xDA, 0x76, 0x9A, 0xFF, 0xA9, 0x77, 0x77, 0x40, 0x77,
+    0x77, 0x39, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7,
+    0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E,
+    0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA,
+    0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7,
+    0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9,
+    0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x70, 0x97, 0x09, 0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xD9,
+    0x39, 0x9F, 0x3A, 0xF5, 0xAE, 0x49, 0xEA, 0x4A, 0xE5, 0xAD, 0xA4, 0xAE, 0x59, 0xE4, 0xAE, 0x59,
+    0xDA, 0x4A, 0xE5, 0xAD, 0x94, 0xAE, 0x5E, 0x5A, 0xE4, 0xAD, 0x95, 0xAF, 0xFE, 0x6A, 0xFF, 0xF9,
+    0x4A, 0xE1, 0x99, 0x9A, 0xF9, 0x3A, 0xE6, 0xF3, 0xAE, 0x69, 0xE3, 0xAE, 0x7E, 0x92, 0xAE, 0x7E,
+    0x92, 0xAE, 0x7E, 0x3A, 0xE6, 0xAE, 0x3A, 0xE5, 0xAE, 0xA3, 0xAE, 0x99, 0x99, 0xAF, 0xC1, 0x9F,
+    0xFF, 0xDA, 0x2A, 0xFF, 0xFA, 0x77, 0x70, 0x77, 0x71, 0x9A, 0xFE, 0xA9, 0x59, 0xFF, 0xEA, 0x49,
+    0xFA, 0x99, 0x9A, 0xF3, 0x9E, 0xA6, 0xE3, 0xE9, 0x7E, 0x2E, 0xA7, 0x0D, 0xA1, 0x9E, 0x71, 0xAC,
+    0x91, 0xAE, 0x76, 0xEA, 0x76, 0xE9, 0x75, 0x9E, 0x97, 0x59, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x75,
+    0x9E, 0x97, 0x6E, 0xA7, 0x6F, 0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x5A, 0xFC, 0x97, 0x99, 0x2A, 0xFE,
+    0xAA, 0xAA, 0xEA, 0x3A, 0xFF, 0xFC, 0x6A, 0xFF, 0xCA, 0x72, 0x99, 0x99, 0x94, 0x70, 0x97, 0x49,
+    0xAF, 0xFF, 0xA9, 0x6A, 0xFF, 0xFF, 0x95, 0x99, 0xF1, 0x99, 0xAA, 0xFC, 0xA6, 0xAE, 0x6A, 0xFA,
+    0x5A, 0xE7, 0x0F, 0x94, 0xAE, 0x71, 0xF4, 0xAE, 0x71, 0xAE, 0x93, 0xAE, 0x72, 0xEA, 0x3A, 0xE7,
+    0x2F, 0x3A, 0xE7, 0x2A, 0xE3, 0xAE, 0x72, 0xAE, 0x3A, 0xE7, 0x2A, 0xE3, 0xAE, 0x72, 0xAE, 0x3A,
+    0xE7, 0x2A, 0xE3, 0xAE, 0x72, 0xEA, 0x3A, 0xE7, 0x2E, 0x93, 0xAE, 0x71, 0xAE, 0x4A, 0xE7, 0x1E,
+    0xA4, 0xAE, 0x70, 0xF5, 0xAE, 0x69, 0xF6, 0xAE, 0x99, 0x99, 0x9A, 0xFC, 0x49, 0xFF, 0xFE, 0x95,
+    0xAF, 0xFF, 0xA9, 0x77, 0x76, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE,
+    0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A,
+    0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0,
+    0x9F, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x09, 0x9F, 0xAA, 0xAA, 0xAF, 0xA2, 0xAE, 0x6D, 0xA2, 0xAE,
+    0x6A, 0xCA, 0x2A, 0xE6, 0x9C, 0x92, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x99,
+    0x99, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4, 0xAF, 0xFE, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7,
+    0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE9, 0x70, 0x9F, 0xFC, 0xA5, 0xAF, 0xFC, 0xA5, 0x74,
+    0x97, 0x7A, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0xA6, 0xFC, 0xA9, 0x99, 0x9A, 0xEA, 0x49, 0xF9, 0x69,
+    0xDA, 0x4E, 0xA7, 0x1D, 0xA3, 0xAE, 0x72, 0xDA, 0x3E, 0x97, 0x2A, 0xC3, 0xAE, 0x77, 0x1E, 0xA7,
+    0x71, 0xE9, 0x77, 0x09, 0xE9, 0x77, 0x09, 0xE7, 0x71, 0x9E, 0x7A, 0xFF, 0x99, 0xE9, 0x6A, 0xFF,
+    0x99, 0xE9, 0x79, 0xAA, 0xFA, 0x1E, 0xA7, 0x3E, 0x91, 0xF7, 0x3E, 0x91, 0xAE, 0xA7, 0x2E, 0x92,
+    0xF9, 0x71, 0xE9, 0x2A, 0xFA, 0x70, 0xE9, 0x3A, 0xFD, 0xA9, 0x99, 0x9A, 0xF9, 0x4A, 0xFF, 0xFE,
+    0x7A, 0xFF, 0xEA, 0x73, 0x99, 0x99, 0x99, 0x60, 0x9F, 0xFA, 0x5F, 0xFC, 0x0A, 0xFF, 0x94, 0x9F,
+    0xFA, 0x19, 0x9F, 0x97, 0x09, 0xAE, 0x95, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72,
+    0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A,
+    0xFF, 0xFF, 0xD6, 0xAF, 0xFF, 0xFD, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x6A, 0xE7,
+    0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6,
+    0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x97, 0x1A, 0xE9, 0x29, 0xFF, 0xC5, 0xAF, 0xF0,
+    0xAF, 0xFC, 0x49, 0xFF, 0xC0, 0x9F, 0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6,
+    0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x2A, 0xFF, 0xC3,
+    0xFF, 0xCA, 0x49, 0x9F, 0x97, 0x0A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09,
+    0xE7, 0x1E, 0xA7, 0x0F, 0x7A, 0xF9, 0x6F, 0xC9, 0x79, 0xAA, 0x97, 0x00, 0x9F, 0xFC, 0x29, 0xFF,
+    0x0A, 0xFF, 0xA2, 0x9F, 0xEA, 0x19, 0x9F, 0x96, 0x9E, 0xA5, 0xAE, 0x69, 0xEA, 0x6A, 0xE5, 0x9E,
+    0x97, 0xAE, 0x4A, 0xE9, 0x70, 0xAE, 0x3A, 0xE7, 0x2A, 0xE2, 0xAE, 0x73, 0xAE, 0x1A, 0xE7, 0x4A,
+    0xE0, 0xEA, 0x75, 0xAF, 0xDA, 0x76, 0xAF, 0xDA, 0x76, 0xAE, 0xAE, 0xA7, 0x5A, 0xE0, 0xFA, 0x74,
+    0xAE, 0x1F, 0xA7, 0x3A, 0xE2, 0xFA, 0x72, 0xAE, 0x3F, 0xA7, 0x1A, 0xE4, 0xFA, 0x70, 0xAE, 0x5F,
+    0xA7, 0xAE, 0x6F, 0xC6, 0xAE, 0x96, 0xFC, 0x91, 0x9F, 0xFC, 0x5F, 0xD9, 0xAF, 0xFC, 0x6A, 0xFA,
+    0x77, 0x19, 0xAA, 0x90, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x71, 0x99, 0xF9, 0x75, 0xAE, 0x76, 0xAE,
+    0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE,
+    0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x70, 0x9C, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7,
+    0x0D, 0x92, 0xAE, 0x7A, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x09, 0xFF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xFA, 0x00, 0x1A, 0xFE, 0x71, 0xAF, 0xD9, 0x3A, 0xFE, 0x71, 0xFE, 0x69, 0xFC, 0x97, 0x9F,
+    0xC9, 0x70, 0xFC, 0xA7, 0xFC, 0xA7, 0x1D, 0xAE, 0x7D, 0xAE, 0x71, 0xD0, 0xE9, 0x59, 0xD0, 0xE7,
+    0x09, 0xD0, 0xAD, 0xA5, 0xDA, 0x0E, 0x70, 0x9D, 0x09, 0xE5, 0xD9, 0x0E, 0x70, 0xAD, 0x1E, 0x4A,
+    0xD1, 0xE7, 0x0A, 0xD1, 0xAD, 0xA3, 0xDA, 0x1E, 0x97, 0xAD, 0x19, 0xE3, 0xD2, 0xAD, 0x97, 0xDA,
+    0x2E, 0x2A, 0xD2, 0xAD, 0x97, 0xDA, 0x2A, 0xD9, 0x1D, 0xA2, 0xAD, 0xA7, 0xDA, 0x3E, 0x1D, 0x39,
+    0xDA, 0x7D, 0x93, 0xE0, 0xAD, 0x39, 0xDA, 0x7D, 0x93, 0xAD, 0x9D, 0x93, 0x9E, 0x69, 0xD9, 0x4F,
+    0xC5, 0xE6, 0x9D, 0x94, 0xFA, 0x5E, 0x6A, 0xD5, 0x9E, 0x95, 0xE6, 0xAD, 0x6E, 0x6E, 0x6E, 0x95,
+    0xAC, 0xA6, 0xEA, 0x29, 0xFF, 0x72, 0x9F, 0xF0, 0xAF, 0xF7, 0x2F, 0xFC, 0x00, 0x9F, 0xD7, 0x0F,
+    0xFC, 0x09, 0xFD, 0xA7, 0xFF, 0xA2, 0x9F, 0xC9, 0x79, 0x9E, 0x95, 0xAF, 0xC7, 0x1A, 0xD6, 0xAF,
+    0xCA, 0x70, 0xAD, 0x6A, 0xDA, 0xE9, 0x7A, 0xD6, 0xAD, 0x0A, 0xE7, 0xAD, 0x6A, 0xD1, 0xF6, 0xAD,
+    0x6A, 0xD1, 0x9E, 0x95, 0xAD, 0x6A, 0xD2, 0xAE, 0x5A, 0xD6, 0xAD, 0x3F, 0x4A, 0xD6, 0xAD, 0x39,
+    0xEA, 0x3A, 0xD6, 0xAD, 0x4A, 0xE9, 0x2A, 0xD6, 0xAD, 0x5F, 0x2A, 0xD6, 0xAD, 0x6E, 0xA1, 0xAD,
+    0x6A, 0xD6, 0x9E, 0x90, 0xAD, 0x6A, 0xD7, 0xF0, 0xAD, 0x6A, 0xD7, 0x0E, 0xAA, 0xD6, 0xAD, 0x70,
+    0x9F, 0xD6, 0xAD, 0x71, 0xAF, 0xC6, 0xAD, 0x97, 0x1F, 0xC3, 0x9F, 0xF9, 0x69, 0xF3, 0xAF, 0xF9,
+    0x7A, 0xE7, 0x76, 0x95, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7, 0x0A,
+    0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29, 0xE9,
+    0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75, 0xAE,
+    0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1,
+    0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A,
+    0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA,
+    0x97, 0x10, 0x77, 0x19, 0xAF, 0xFE, 0xA9, 0x2A, 0xFF, 0xFE, 0x29, 0x9F, 0x29, 0xAF, 0xC3, 0xAE,
+    0x5F, 0x92, 0xAE, 0x6E, 0xA2, 0xAE, 0x6E, 0xA2, 0xAE, 0x6A, 0xDA, 0x2A, 0xE6, 0xEA, 0x2A, 0xE6,
+    0xE9, 0x2A, 0xE5, 0x9E, 0x3A, 0xE4, 0x9E, 0x93, 0xAE, 0x99, 0x9A, 0xFA, 0x4A, 0xFF, 0xD9, 0x5A,
+    0xFE, 0xA9, 0x7A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE9,
+    0x71, 0x9F, 0xFC, 0x96, 0xAF, 0xFC, 0x96, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x75, 0x9F, 0xFF, 0xA7,
+    0x2A, 0xFA, 0x99, 0x9A, 0xFD, 0x70, 0xAE, 0xA6, 0x9F, 0xC6, 0x9E, 0xA7, 0x1F, 0xA5, 0xF7, 0x29,
+    0xF4, 0x9E, 0x97, 0x3A, 0xE9, 0x3A, 0xE7, 0x49, 0xEA, 0x3E, 0xA7, 0x5F, 0x3E, 0xA7, 0x5F, 0x29,
+    0xE9, 0x75, 0xAE, 0x29, 0xE9, 0x75, 0xAE, 0x29, 0xE9, 0x75, 0xAE, 0x29, 0xE9, 0x75, 0xF2, 0x9E,
+    0xA7, 0x5E, 0xA3, 0xF7, 0x5E, 0x93, 0xF9, 0x73, 0xAE, 0x49, 0xF7, 0x3E, 0xA5, 0xF9, 0x71, 0xF6,
+    0x9F, 0xA7, 0xF9, 0x79, 0xFC, 0x92, 0x9A, 0xF9, 0x71, 0x9F, 0xFF, 0xC7, 0x59, 0xFF, 0xA9, 0x77,
+    0x1A, 0xEA, 0x77, 0x59, 0xF9, 0x77, 0x5F, 0xC9, 0x77, 0x49, 0xFD, 0xA9, 0x99, 0x97, 0x7A, 0xFF,
+    0xC7, 0x71, 0xAF, 0xD9, 0x77, 0x49, 0xA9, 0x20, 0x79, 0x74, 0x9A, 0xFF, 0xEA, 0x7A, 0xFF, 0xFD,
+    0xA6, 0x99, 0xF2, 0x9A, 0xFA, 0x7A, 0xE5, 0xF7, 0xAE, 0x59, 0xE9, 0x6A, 0xE6, 0xEA, 0x6A, 0xE6,
+    0xEA, 0x6A, 0xE6, 0xE9, 0x6A, 0xE5, 0x9E, 0x7A, 0xE5, 0xEA, 0x7A, 0xE3, 0xAE, 0xA7, 0x0A, 0xEA,
+    0xFD, 0x97, 0x1A, 0xFF, 0xA7, 0x3A, 0xE9, 0x9E, 0xA7, 0x3A, 0xE1, 0x9E, 0x97, 0x2A, 0xE2, 0xAE,
+    0x72, 0xAE, 0x3F, 0x71, 0xAE, 0x39, 0xF7, 0x0A, 0xE4, 0xAF, 0x7A, 0xE5, 0xFC, 0x6A, 0xE9, 0x5F,
+    0xC9, 0x19, 0xFF, 0xC4, 0xFC, 0xA0, 0xAF, 0xFC, 0x5A, 0xFA, 0x77, 0x1A, 0xA9, 0x00, 0x77, 0x4A,
+    0xFE, 0x94, 0xAF, 0xFE, 0x29, 0xF9, 0x99, 0xAF, 0x2E, 0x95, 0xE1, 0x9E, 0x6E, 0x1A, 0xDA, 0x6D,
+    0xA1, 0xAE, 0x6A, 0xC2, 0xAE, 0xA7, 0x3F, 0xA7, 0x2A, 0xFC, 0x97, 0x1A, 0xFD, 0x97, 0x09, 0xFE,
+    0x97, 0x09, 0xFD, 0xA7, 0x19, 0xFC, 0xA7, 0x2A, 0xF2, 0x97, 0xAE, 0x90, 0xD7, 0x0E, 0x99, 0xD9,
+    0x7E, 0x99, 0xDA, 0x69, 0xE0, 0x9E, 0x6F, 0x09, 0xF9, 0x29, 0xF1, 0x9F, 0xFF, 0x92, 0x9F, 0xFC,
+    0xA7, 0x99, 0xAA, 0xA9, 0x50, 0x9F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xE0, 0xAE, 0xAA, 0xAA, 0xFA,
+    0xAA, 0xAF, 0x0A, 0xD4, 0xAE, 0x4A, 0xD0, 0xAD, 0x4A, 0xE4, 0xAD, 0x0A, 0xCA, 0x4A, 0xE4, 0x9D,
+    0x09, 0xC9, 0x4A, 0xE4, 0x9C, 0x97, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A,
+    0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x74, 0xAF, 0xFC, 0x97, 0x09, 0xFF, 0xD9, 0x40,
+    0x0F, 0xFC, 0x5A, 0xFF, 0x9F, 0xFA, 0x5F, 0xFA, 0x19, 0xAE, 0x97, 0x09, 0xAE, 0x94, 0x9E, 0x73,
+    0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5,
+    0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E,
+    0x73, 0xE5, 0x9E, 0x73, 0xE6, 0xE9, 0x71, 0x9E, 0x6E, 0xA7, 0x1A, 0xDA, 0x6F, 0x71, 0xE9, 0x69,
+    0xF7, 0xF7, 0x0F, 0xCA, 0x99, 0x99, 0xAF, 0x72, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09,
+    0x99, 0x99, 0x71, 0x9F, 0xFC, 0x93, 0xFF, 0xAA, 0xFF, 0xC4, 0xFF, 0xA1, 0xAF, 0xA7, 0x09, 0xE9,
+    0x4A, 0xE7, 0x19, 0xE5, 0x9E, 0xA7, 0x0E, 0x96, 0xF7, 0x0E, 0x7A, 0xE7, 0x9D, 0xA7, 0x0E, 0x96,
+    0xE9, 0x70, 0xF6, 0xE7, 0x19, 0xE5, 0x9D, 0xA7, 0x2E, 0x94, 0xE7, 0x3A, 0xDA, 0x4E, 0x73, 0x9E,
+    0x39, 0xD9, 0x74, 0xE9, 0x2E, 0x75, 0xAD, 0xA2, 0xDA, 0x76, 0xE1, 0x9D, 0x97, 0x6E, 0x90, 0xE7,
+    0x79, 0xDA, 0x0D, 0xA7, 0x70, 0xEA, 0xD7, 0x71, 0xFD, 0x77, 0x19, 0xFA, 0x77, 0x2F, 0x77, 0x3A,
+    0xE7, 0x77, 0x71, 0x0F, 0xFD, 0x77, 0xFF, 0xC0, 0xFF, 0xC9, 0x5E, 0x6F, 0xFA, 0x19, 0xFC, 0x97,
+    0xE7, 0x09, 0xE9, 0x5E, 0xA7, 0x9E, 0xA7, 0x9E, 0x6F, 0x7A, 0xF7, 0xAD, 0xA6, 0xAE, 0x7F, 0xC7,
+    0xE9, 0x69, 0xE9, 0x59, 0xFC, 0x96, 0xE7, 0x0E, 0xA5, 0xAD, 0xAE, 0x59, 0xDA, 0x70, 0xAE, 0x5E,
+    0x9E, 0x5A, 0xD9, 0x70, 0x9E, 0x5D, 0x90, 0xE9, 0x4E, 0x72, 0xE9, 0x39, 0xD1, 0xAD, 0xA3, 0x9D,
+    0xA7, 0x2A, 0xDA, 0x3E, 0x19, 0xE3, 0xAD, 0x97, 0x29, 0xE3, 0xDA, 0x2E, 0x92, 0xE7, 0x4E, 0x91,
+    0x9D, 0x3A, 0xDA, 0x2D, 0xA7, 0x4A, 0xDA, 0x1A, 0xD3, 0x9E, 0x19, 0xD9, 0x74, 0x9E, 0x1D, 0xA4,
+    0xE1, 0xAD, 0x76, 0xE0, 0x9D, 0x94, 0xAD, 0x90, 0xE7, 0x6E, 0x9A, 0xD5, 0x9E, 0x0D, 0x97, 0x69,
+    0xDA, 0xDA, 0x6E, 0x9D, 0x77, 0x0F, 0xC9, 0x6A, 0xFC, 0x77, 0x0F, 0xC7, 0x9F, 0xA7, 0x70, 0x9E,
+    0xA7, 0x0F, 0x77, 0x2E, 0x97, 0x0A, 0xE7, 0x77, 0x77, 0x40, 0x0A, 0xFF, 0xC3, 0xFF, 0x1A, 0xFF,
+    0xA3, 0xFE, 0xA2, 0x9A, 0xF9, 0x69, 0xE9, 0x6A, 0xEA, 0x6A, 0xDA, 0x70, 0xF9, 0x49, 0xE7, 0x2F,
+    0x4E, 0x73, 0x9F, 0x2E, 0x97, 0x4A, 0xE9, 0x0A, 0xD9, 0x76, 0xF9, 0xDA, 0x77, 0x0F, 0xD7, 0x71,
+    0xAF, 0x77, 0x3F, 0x97, 0x71, 0xFD, 0x77, 0x0A, 0xDA, 0xF7, 0x69, 0xDA, 0x0A, 0xE9, 0x75, 0xE2,
+    0xF7, 0x4E, 0x4F, 0x72, 0xAD, 0xA4, 0x9E, 0xA7, 0x09, 0xE6, 0xF9, 0x7E, 0x70, 0xF5, 0x9E, 0xA7,
+    0x0A, 0xF9, 0x19, 0xFF, 0x4A, 0xFF, 0xAA, 0xFF, 0x4F, 0xFC, 0xA0, 0xAF, 0xFC, 0x3F, 0xF0, 0xAF,
+    0xFA, 0x3F, 0xF1, 0x9A, 0xF9, 0x7A, 0xE9, 0x49, 0xE9, 0x7E, 0x7F, 0x69, 0xDA, 0x79, 0xE9, 0x5E,
+    0x71, 0xAE, 0x49, 0xD9, 0x72, 0xEA, 0x3E, 0x73, 0xAE, 0x29, 0xD9, 0x74, 0xEA, 0x1E, 0x75, 0x9E,
+    0x0A, 0xD7, 0x7A, 0xDA, 0xDA, 0x77, 0x0F, 0xC7, 0x71, 0xAE, 0x97, 0x71, 0x9E, 0x77, 0x29, 0xE7,
+    0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x99, 0x75, 0x9F, 0xFD,
+    0x73, 0xFF, 0xE5, 0x0A, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0x1F, 0xCA, 0xAA, 0xAA, 0xAF, 0xC1, 0xE7,
+    0xAE, 0x2D, 0x96, 0x9E, 0x92, 0xD7, 0xEA, 0x39, 0xA6, 0xF7, 0x4A, 0xE9, 0x74, 0xEA, 0x74, 0xF7,
+    0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xEA, 0x74, 0xF7, 0x9C, 0x2A,
+    0xE9, 0x7D, 0x90, 0x9E, 0xA7, 0x0D, 0x90, 0xF7, 0x0A, 0xD9, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE0, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xEA, 0x77, 0x20, 0xAF, 0xC9, 0xAF, 0xC9, 0xAD, 0x92, 0xAD,
+    0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3,
+    0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAF, 0xC9, 0xAF, 0xC9, 0x60, 0x9D, 0x73, 0xDA, 0x72, 0xE7,
+    0x29, 0xD9, 0x72, 0xE7, 0x29, 0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xE7, 0x29, 0xD9,
+    0x72, 0xE7, 0x29, 0xD9, 0x72, 0xE7, 0x2A, 0xD7, 0x3D, 0xA7, 0x2A, 0xD7, 0x29, 0xDA, 0x72, 0xE7,
+    0x29, 0xD9, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0x99, 0x90, 0x0F,
+    0xCA, 0x0F, 0xCA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D,
+    0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3,
+    0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3D, 0xA0, 0xFC, 0xA9, 0xFC, 0xA6,
+    0x59, 0xE7, 0x3A, 0xE9, 0x72, 0xFA, 0x71, 0xAD, 0xAD, 0x71, 0xDA, 0x0D, 0xA7, 0x9D, 0x90, 0xE7,
+    0xAD, 0x19, 0xD9, 0x6D, 0xA2, 0xDA, 0x5A, 0xD3, 0xAD, 0x5E, 0x4D, 0xA3, 0x9D, 0x94, 0xE3, 0xE5,
+    0x9D, 0x92, 0xDA, 0x6E, 0x1A, 0xD7, 0xAD, 0x1A, 0xCA, 0x70, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0x90, 0x70, 0x9C, 0x5E, 0x39, 0xEA, 0x3F, 0x93,
+    0xAE, 0x49, 0xE5, 0xD7, 0x00, 0x59, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A,
+    0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99,
+    0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A,
+    0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09,
+    0xF5, 0x99, 0x95, 0x93, 0x39, 0x99, 0x75, 0x9F, 0xC7, 0x5F, 0xD7, 0x69, 0x9E, 0x77, 0x0E, 0x77,
+    0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x39, 0x99, 0x71, 0xE1, 0xAF, 0xD9, 0x6E, 0x9F, 0xFC,
+    0x95, 0xFD, 0xA9, 0xAF, 0xC5, 0xF9, 0x4A, 0xEA, 0x4E, 0x96, 0xF4, 0xE7, 0x9E, 0x4E, 0x70, 0xE9,
+    0x3E, 0x70, 0xE9, 0x3E, 0x70, 0xE9, 0x3E, 0x70, 0xE4, 0xE7, 0x9E, 0x4E, 0x7A, 0xE4, 0xE7, 0xE9,
+    0x4E, 0x6A, 0xE5, 0xEA, 0x39, 0xF5, 0x9F, 0xFF, 0x96, 0xAF, 0xFC, 0xA7, 0x39, 0x99, 0x99, 0x96,
+    0x69, 0x99, 0x97, 0x0A, 0xFD, 0xA4, 0x9F, 0xFD, 0x29, 0xE9, 0x19, 0xF2, 0xE5, 0xE9, 0x0A, 0xD9,
+    0x5A, 0xD1, 0xE6, 0x99, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7, 0x29,
+    0xE9, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xCA, 0x19, 0xFF, 0xE9, 0x3A, 0xFF,
+    0x96, 0x99, 0x99, 0x93, 0x74, 0x99, 0x97, 0x5A, 0xFC, 0x74, 0x9F, 0xD7, 0x69, 0xAE, 0x77, 0x9E,
+    0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x72, 0x99, 0x99, 0x09, 0xE7, 0x0A, 0xFF, 0xD6, 0xAF, 0xFF,
+    0x59, 0xEA, 0x92, 0x9F, 0x5E, 0x95, 0x9E, 0x4A, 0xDA, 0x69, 0xE4, 0xE7, 0x9E, 0x39, 0xE7, 0x9E,
+    0x3A, 0xE7, 0x9E, 0x3A, 0xE7, 0x9E, 0x3A, 0xE7, 0x9E, 0x3A, 0xE7, 0x9E, 0x39, 0xE7, 0x9E, 0x4E,
+    0xA6, 0x9E, 0x4F, 0x95, 0xF4, 0x9F, 0xA9, 0x09, 0xAF, 0xC5, 0xAF, 0xFC, 0x9F, 0xD9, 0x29, 0xFE,
+    0x90, 0xAF, 0xC5, 0x99, 0x99, 0x49, 0x93, 0x69, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA,
+    0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD,
+    0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F,
+    0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93,
+    0x70, 0x9A, 0xAA, 0x97, 0x0A, 0xFE, 0x6F, 0xAF, 0xC4, 0xAD, 0xA3, 0xDA, 0x4E, 0x5A, 0x49, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x1A, 0xFF, 0xD2, 0x9F, 0xFF, 0x29, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xA9, 0x6E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97,
+    0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x09, 0xFF, 0xC5, 0xFF, 0xD4, 0x69,
+    0x99, 0x94, 0x99, 0x5A, 0xFF, 0xFA, 0x3F, 0xFF, 0xDA, 0x2E, 0xA3, 0xAE, 0x1A, 0x92, 0xE5, 0xAD,
+    0xA4, 0x9D, 0xA5, 0x9E, 0x4A, 0xDA, 0x6E, 0x4A, 0xDA, 0x59, 0xE4, 0x9E, 0x5A, 0xDA, 0x5F, 0x92,
+    0xAE, 0x7F, 0xFD, 0x96, 0x9F, 0xFA, 0x70, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xDA, 0x76, 0xAF, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xFD, 0x4A, 0xFF, 0xFC, 0xA2, 0xE9, 0x69, 0xAE, 0x1A, 0xD9, 0x71,
+    0xE1, 0xE7, 0x2E, 0x1E, 0x71, 0xAD, 0x91, 0xF6, 0x9E, 0xA2, 0x9F, 0xDA, 0xAF, 0xCA, 0x49, 0xFF,
+    0xDA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9, 0x60, 0x39, 0x99, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x77, 0x09,
+    0xAE, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xE3, 0x99, 0x99,
+    0x71, 0x9E, 0x1A, 0xFD, 0x97, 0x9E, 0x9F, 0xFC, 0x79, 0xFD, 0x99, 0x9F, 0xA6, 0x9F, 0x94, 0xF6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E,
+    0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E, 0x95, 0x9E, 0x7E,
+    0x93, 0x9F, 0xE3, 0xAF, 0xE1, 0xFF, 0x3F, 0xF0, 0x49, 0x79, 0xE9, 0x5F, 0xA5, 0xFA, 0x59, 0xE7,
+    0x77, 0x77, 0x70, 0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC0,
+    0x59, 0x96, 0xF4, 0x9F, 0x49, 0xF5, 0xEA, 0x77, 0x77, 0x73, 0x9A, 0xEA, 0x2A, 0xFC, 0xA3, 0x9A,
+    0xEA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A,
+    0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5E,
+    0xA5, 0xE9, 0x4A, 0xE4, 0xAE, 0x92, 0x9F, 0xA2, 0xAF, 0x94, 0xAA, 0x95, 0x39, 0x99, 0x75, 0xAF,
+    0xC7, 0x49, 0xFD, 0x76, 0x9A, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7,
+    0x79, 0xE2, 0x9F, 0xF3, 0x9E, 0x29, 0xFF, 0x39, 0xE4, 0xAE, 0xA5, 0x9E, 0x3A, 0xE7, 0x9E, 0x2A,
+    0xE7, 0x09, 0xE1, 0xEA, 0x71, 0x9E, 0x0E, 0x97, 0x29, 0xFE, 0x73, 0x9E, 0x9E, 0x97, 0x29, 0xE0,
+    0xAE, 0x97, 0x19, 0xE1, 0xF7, 0x19, 0xE2, 0xF7, 0x09, 0xE3, 0xF7, 0x9E, 0x39, 0xF9, 0x59, 0xE4,
+    0x9F, 0xA2, 0x9F, 0xE3, 0x9F, 0xA1, 0xFF, 0x49, 0xFA, 0x77, 0x99, 0x90, 0x39, 0x99, 0x4A, 0xFC,
+    0x39, 0xFD, 0x59, 0xAE, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x93, 0xAF, 0xF0, 0x9F, 0xFC, 0x00, 0x72, 0x99, 0x99, 0x69, 0x99, 0x97, 0x0A, 0xEA,
+    0x1A, 0xFD, 0x92, 0xAF, 0xD9, 0x5F, 0xD0, 0xFF, 0xC1, 0xFF, 0xC9, 0x4A, 0xAF, 0xEA, 0x99, 0xFF,
+    0xA9, 0x9F, 0xC7, 0xF9, 0x4F, 0xC9, 0x4F, 0x7E, 0x95, 0x9E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E,
+    0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9,
+    0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0xA6, 0xEA, 0x39, 0xFE, 0xA2, 0xAF, 0xDA, 0x2A, 0xFE,
+    0x1F, 0xFA, 0x2F, 0xEA, 0x2F, 0xF0, 0x72, 0x99, 0x99, 0x70, 0xAE, 0xA1, 0xAF, 0xDA, 0x5F, 0xD0,
+    0xFF, 0xCA, 0x4A, 0xAF, 0xEA, 0x99, 0xAF, 0x7F, 0xA4, 0x9E, 0x96, 0xE9, 0x6E, 0xA6, 0xE9, 0x6E,
+    0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9,
+    0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA,
+    0x39, 0xFE, 0xA2, 0x9F, 0xE9, 0x0F, 0xFA, 0x2F, 0xF9, 0x69, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F,
+    0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7,
+    0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E,
+    0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF,
+    0xA7, 0x29, 0xAA, 0x99, 0x60, 0x72, 0x99, 0x95, 0x9A, 0xE1, 0x9F, 0xDA, 0x2A, 0xFC, 0x9A, 0xFF,
+    0xC1, 0x9A, 0xFE, 0xA9, 0x9A, 0xFA, 0x3A, 0xF5, 0xF3, 0xAE, 0x69, 0xE9, 0x2A, 0xDA, 0x7E, 0xA2,
+    0xAD, 0xA7, 0xAE, 0x2A, 0xDA, 0x7A, 0xE2, 0xAD, 0xA7, 0xAE, 0x2A, 0xDA, 0x7A, 0xDA, 0x2A, 0xDA,
+    0x7E, 0xA2, 0xAD, 0xA7, 0xE9, 0x2A, 0xDA, 0x69, 0xE3, 0xAD, 0xA6, 0xE9, 0x3A, 0xEA, 0x91, 0x9A,
+    0xEA, 0x4A, 0xFF, 0xEA, 0x5A, 0xFF, 0xCA, 0x7A, 0xDA, 0x76, 0xAD, 0xA7, 0x6A, 0xDA, 0x76, 0xAD,
+    0xA7, 0x6A, 0xDA, 0x75, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xC7, 0x09, 0x99, 0x99, 0x99, 0x99, 0x97,
+    0x00, 0x69, 0x99, 0x99, 0x73, 0xAF, 0xFA, 0x95, 0xAF, 0xFF, 0x4A, 0xEA, 0x92, 0x9F, 0x4E, 0x95,
+    0x9E, 0x3A, 0xDA, 0x69, 0xE3, 0xE7, 0x9E, 0x29, 0xE7, 0x9E, 0x2A, 0xE7, 0x9E, 0x2A, 0xE7, 0x9E,
+    0x2A, 0xE7, 0x9E, 0x2A, 0xE7, 0x9E, 0x29, 0xE7, 0x9E, 0x3E, 0xA6, 0xF3, 0xF9, 0x4A, 0xF3, 0x9F,
+    0xA9, 0x9A, 0xFD, 0x49, 0xFF, 0xC9, 0xE5, 0x9F, 0xDA, 0x09, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69,
+    0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x49, 0xAF, 0xCA, 0x71, 0xFF, 0xC9, 0x70, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x72, 0x99, 0x92, 0xAE, 0xA1, 0x9F, 0xA0, 0xFD, 0x09, 0xFC, 0xA0, 0xAA, 0xF9, 0xFD, 0x93,
+    0xFC, 0x92, 0xA4, 0xF9, 0x71, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9,
+    0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x79, 0xFF, 0xC9, 0x3F, 0xFD, 0x92, 0x59, 0x99,
+    0x96, 0x9F, 0xF9, 0x29, 0xFF, 0xCA, 0x2D, 0xA3, 0x9D, 0xA1, 0x9D, 0x94, 0xAC, 0xA1, 0xAD, 0x94,
+    0x9C, 0x29, 0xE9, 0x71, 0xFC, 0x97, 0xAF, 0xD9, 0x69, 0xFE, 0x96, 0xAF, 0xD9, 0x79, 0xFC, 0x19,
+    0xC5, 0x9E, 0x1D, 0x6E, 0x1D, 0xA5, 0xE1, 0xE9, 0x3A, 0xDA, 0x1F, 0xCA, 0xFC, 0x29, 0xFF, 0xA6,
+    0x99, 0x99, 0x94, 0x49, 0x72, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA6, 0x9A, 0xFF,
+    0xC0, 0xFF, 0xF9, 0xAA, 0xAF, 0xAA, 0xAA, 0xA3, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x70, 0xAE, 0x70, 0xAE, 0xA9, 0x99, 0x9A, 0x3F, 0xFC, 0x3A, 0xFE, 0x69, 0x99, 0x92, 0x77, 0x6A,
+    0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD,
+    0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD,
+    0x79, 0x99, 0x94, 0x99, 0x30, 0x9F, 0xEA, 0x2A, 0xFD, 0xA9, 0xFE, 0xA2, 0xAF, 0xD9, 0x1A, 0xE9,
+    0x69, 0xE4, 0xE9, 0x6A, 0xD9, 0x4E, 0xA6, 0xE5, 0x9E, 0x59, 0xDA, 0x6E, 0x94, 0xE7, 0xAE, 0x39,
+    0xDA, 0x70, 0xE3, 0xAD, 0x71, 0xAD, 0xA2, 0xE7, 0x2E, 0x19, 0xD9, 0x72, 0xE9, 0x0E, 0x73, 0x9D,
+    0xA0, 0xD9, 0x74, 0xEA, 0xD7, 0x5A, 0xFA, 0x76, 0xF7, 0x7A, 0xDA, 0x77, 0x73, 0x9F, 0xEA, 0x4D,
+    0x49, 0xFD, 0xA0, 0xFE, 0x93, 0x9D, 0x93, 0x9F, 0xDA, 0x1A, 0xE9, 0x5A, 0xDA, 0x6E, 0x4E, 0x95,
+    0xF5, 0x9D, 0xA4, 0xEA, 0x49, 0xF9, 0x4A, 0xD9, 0x49, 0xE4, 0xAF, 0xA4, 0xE6, 0xE4, 0xDA, 0xE4,
+    0xDA, 0x6E, 0xA2, 0x9D, 0x0E, 0x92, 0xAD, 0x79, 0xE2, 0xAD, 0x09, 0xDA, 0x2E, 0x70, 0xE2, 0xD9,
+    0x1E, 0x2D, 0x97, 0x0A, 0xD9, 0x09, 0xD2, 0xAD, 0x90, 0x9D, 0x71, 0x9D, 0xA0, 0xAC, 0xA2, 0x9D,
+    0xA0, 0xDA, 0x72, 0xE0, 0xD9, 0x3E, 0x0D, 0x97, 0x2A, 0xDA, 0xD4, 0xAD, 0xAD, 0x74, 0xFA, 0x49,
+    0xFA, 0x74, 0xF9, 0x5F, 0x97, 0x4A, 0xE6, 0xAE, 0x77, 0x77, 0x30, 0x0F, 0xEA, 0x2F, 0xE1, 0xFE,
+    0xA2, 0xFD, 0xA2, 0x9F, 0x5A, 0xDA, 0x6E, 0xA4, 0xE7, 0x9E, 0x92, 0xE7, 0x19, 0xE1, 0xAD, 0x73,
+    0xAE, 0x9D, 0x75, 0xAF, 0x97, 0x6F, 0x76, 0x9F, 0xA7, 0x5D, 0xAE, 0x97, 0x3D, 0xA0, 0x9E, 0x97,
+    0x1E, 0x2A, 0xE7, 0x0E, 0x4F, 0x6A, 0xD9, 0x5E, 0xA3, 0xAF, 0xCA, 0x29, 0xFE, 0x0A, 0xFE, 0x2F,
+    0xF0, 0x9F, 0xEA, 0x2A, 0xFD, 0xA9, 0xFE, 0xA2, 0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A,
+    0xD9, 0x4E, 0xA6, 0xE5, 0x9E, 0x59, 0xDA, 0x6E, 0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD,
+    0x71, 0xAD, 0xA2, 0xDA, 0x72, 0xE1, 0x9D, 0x97, 0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E,
+    0xAD, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA7,
+    0x49, 0xFC, 0x72, 0xAF, 0xE7, 0x3A, 0xFD, 0x75, 0x9A, 0xAA, 0x97, 0x50, 0x0F, 0xFF, 0xA1, 0xFF,
+    0xFC, 0x1D, 0xA9, 0x99, 0x99, 0x9E, 0xA0, 0x9D, 0x5F, 0x19, 0xCA, 0x4A, 0xE3, 0xA9, 0x39, 0xE9,
+    0x71, 0xE9, 0x71, 0xEA, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0x9E, 0x97, 0x1E, 0xA5, 0xC9, 0x1E, 0xA5,
+    0xAC, 0xA0, 0xAE, 0x6D, 0x99, 0xE9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFD, 0x0A, 0xFF, 0xFC, 0x77,
+    0x75, 0x9F, 0x3A, 0xFC, 0x29, 0xE9, 0x4A, 0xD9, 0x5E, 0x95, 0xE6, 0xAD, 0x95, 0xAD, 0x95, 0x9D,
+    0xA6, 0xE6, 0xE6, 0xE6, 0xE5, 0xAE, 0x4A, 0xE4, 0x9E, 0x6F, 0x6A, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5,
+    0x9D, 0xA5, 0xAD, 0x95, 0xAD, 0x95, 0xE6, 0xE6, 0xAD, 0x95, 0x9E, 0x6F, 0xCA, 0xA3, 0xAF, 0xC5,
+    0x99, 0x90, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0x73, 0xFA,
+    0x5F, 0xD9, 0x6A, 0xE7, 0xE9, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xD9, 0x6A, 0xD9, 0x6E, 0x7E, 0x69,
+    0xDA, 0x69, 0xDA, 0x69, 0xDA, 0x7E, 0x7A, 0xE9, 0x6A, 0xE5, 0x9F, 0x5E, 0x95, 0x9E, 0x69, 0xDA,
+    0x69, 0xDA, 0x7E, 0x7E, 0x7E, 0x7A, 0xD9, 0x6A, 0xD9, 0x6A, 0xDA, 0x6A, 0xD9, 0x59, 0xE3, 0x9A,
+    0xF9, 0x3A, 0xF9, 0x59, 0x99, 0x50, 0x29, 0xAC, 0xA6, 0xA2, 0xFD, 0xA3, 0xAC, 0xA0, 0xAF, 0xF9,
+    0x0A, 0xDA, 0x0D, 0xA1, 0x9F, 0xF1, 0xD4, 0x9F, 0xC7, 0x39, 0x99, 0x20, 0x19, 0x92, 0xF1, 0xF1,
+    0xF1, 0x9A, 0xA9, 0x77, 0x4D, 0xA2, 0xDA, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x09, 0xE9, 0x09, 0xE1, 0xAE, 0x1A, 0xCA, 0x10, 0x77, 0x7D, 0x75,
+    0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x29, 0xAF, 0xCA, 0x6F, 0xFD, 0x92, 0x9E, 0xAA, 0xCA,
+    0x9F, 0x2E, 0x19, 0xCA, 0x1E, 0x1A, 0xD9, 0x19, 0xCA, 0x1A, 0xCA, 0x1E, 0x29, 0xC9, 0x19, 0xA1,
+    0x9D, 0xA2, 0x9C, 0x95, 0xAD, 0x92, 0x9C, 0x95, 0xAD, 0x92, 0x9C, 0x95, 0xE9, 0x29, 0xC9, 0x5A,
+    0xD9, 0x2A, 0xC9, 0x5A, 0xDA, 0x2A, 0xC6, 0x9E, 0x2A, 0xC7, 0xEA, 0x1A, 0xC7, 0xFA, 0x0A, 0xC3,
+    0x9A, 0x2F, 0xEA, 0xAF, 0x3F, 0xFE, 0xA4, 0x9A, 0xFD, 0xA7, 0x1D, 0x75, 0xD7, 0x5D, 0x75, 0xD7,
+    0x5D, 0x75, 0xD7, 0x5D, 0x77, 0x60, 0x71, 0x9A, 0xDA, 0x97, 0x29, 0xFF, 0x70, 0x9F, 0xAA, 0xEA,
+    0x7E, 0x92, 0x9E, 0x69, 0xDA, 0x4A, 0xD6, 0xE5, 0xAC, 0xA6, 0xE6, 0x96, 0x9D, 0xA7, 0x6A, 0xDA,
+    0x76, 0xAD, 0x97, 0x6E, 0x93, 0x99, 0x49, 0xFF, 0xFC, 0x49, 0xFF, 0xFA, 0x70, 0xE7, 0x69, 0xE7,
+    0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xD9, 0x74, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAC, 0x90, 0x9F, 0xFF, 0xF9, 0x1F, 0xAA, 0xFF, 0xD2, 0x9C, 0xA7, 0x99, 0x99, 0x20, 0x09,
+    0x97, 0x4A, 0x2D, 0x93, 0x99, 0x93, 0xDA, 0x1A, 0xD9, 0x9F, 0xE9, 0xE3, 0x9F, 0xFF, 0xA5, 0x9E,
+    0x39, 0xE6, 0xAD, 0x5A, 0xD6, 0xDA, 0x6D, 0x95, 0xDA, 0x6D, 0xA5, 0xDA, 0x6D, 0x95, 0xE5, 0x9D,
+    0x95, 0xAD, 0x94, 0xE6, 0xAE, 0xA1, 0x9F, 0x5A, 0xFF, 0xFC, 0x92, 0xE1, 0xAF, 0xA1, 0xAD, 0xA1,
+    0xD7, 0x39, 0xC9, 0x77, 0x30, 0x09, 0x99, 0x99, 0x99, 0x95, 0x99, 0x99, 0x99, 0x09, 0xFE, 0xA4,
+    0x9F, 0xD9, 0x0A, 0xFC, 0x96, 0x9A, 0xE9, 0x3E, 0xA7, 0x0A, 0xD9, 0x4A, 0xE9, 0x7D, 0xA6, 0xF6,
+    0xAD, 0x79, 0xE9, 0x5D, 0xA7, 0x0A, 0xE4, 0xE7, 0x2E, 0x92, 0x9D, 0x97, 0x29, 0xE2, 0xE7, 0x1F,
+    0xD9, 0x09, 0xFC, 0xA6, 0xAF, 0xD0, 0xFD, 0x97, 0x2A, 0xFC, 0x77, 0x0F, 0xA7, 0x39, 0xFF, 0xFC,
+    0x70, 0xFF, 0xFA, 0x74, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0xAE, 0x97,
+    0x5A, 0xFF, 0xC7, 0x3F, 0xFD, 0x50, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x99, 0x97, 0x69, 0xA9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x59, 0xAA, 0xA9, 0x79, 0xFE, 0x5A, 0xDA, 0xAA, 0xF3, 0xAD, 0x93, 0xE3,
+    0xDA, 0x49, 0xCA, 0x2A, 0xDA, 0x59, 0x3F, 0x71, 0x9F, 0xC7, 0x0A, 0xCA, 0x9E, 0xA6, 0xAC, 0xA0,
+    0xAF, 0x94, 0xAD, 0x19, 0xFC, 0x39, 0xD3, 0x9F, 0x3E, 0x4A, 0xE2, 0x9E, 0x49, 0xDA, 0x2A, 0xEA,
+    0x3A, 0xD3, 0xAF, 0x92, 0xD4, 0x9F, 0xA1, 0xD9, 0x5A, 0xF0, 0xD9, 0x7E, 0xAD, 0x71, 0xAF, 0x19,
+    0xA6, 0xEA, 0x1D, 0xA5, 0xE1, 0x9E, 0x49, 0xDA, 0x2F, 0x91, 0x9D, 0xA3, 0x9F, 0xFA, 0x6A, 0xFA,
+    0x50, 0x19, 0x94, 0x99, 0x09, 0xE9, 0x2E, 0x9A, 0xEA, 0x19, 0xEA, 0x9E, 0x92, 0xE9, 0x19, 0x59,
+    0x10, 0x77, 0x77, 0x09, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAA, 0xF9, 0x71, 0xEA, 0x7A, 0xDA, 0x7E,
+    0x73, 0xDA, 0x5D, 0xA7, 0x5D, 0xA3, 0x9D, 0x49, 0xFC, 0x93, 0xD3, 0xD9, 0x3F, 0xEA, 0x3A, 0xCA,
+    0x19, 0xD3, 0xDA, 0x3C, 0xA4, 0xD1, 0xAC, 0x92, 0x9D, 0x4C, 0xA4, 0xAC, 0x90, 0xD3, 0xAC, 0xA4,
+    0x95, 0x9C, 0xA0, 0xD3, 0xD9, 0x73, 0x9C, 0xA0, 0xD3, 0xD9, 0x73, 0x9D, 0x0D, 0x3D, 0x97, 0x39,
+    0xCA, 0x0D, 0x3D, 0xA7, 0x39, 0xCA, 0x0A, 0xC9, 0x2A, 0xD7, 0x3A, 0xC9, 0x09, 0xCA, 0x29, 0xE9,
+    0x39, 0x4D, 0x2D, 0x3A, 0xFF, 0x39, 0xD2, 0xAC, 0xA3, 0x9F, 0xD9, 0x3D, 0x93, 0xD9, 0x75, 0xAD,
+    0x5D, 0x97, 0x3A, 0xD6, 0x9D, 0xA7, 0x09, 0xE7, 0x1F, 0xA9, 0x99, 0x9A, 0xEA, 0x73, 0x9F, 0xFC,
+    0xA7, 0x70, 0x99, 0xAA, 0x99, 0x70, 0x74, 0xAF, 0xA3, 0xE9, 0xAD, 0x91, 0x9D, 0x2D, 0xA2, 0xAA,
+    0x2D, 0xA5, 0x99, 0xDA, 0x29, 0xFD, 0xA1, 0x9D, 0xA9, 0x0D, 0xA1, 0xE2, 0xDA, 0x1E, 0x2E, 0x19,
+    0xFF, 0xD0, 0x9E, 0x90, 0xAC, 0xA7, 0x74, 0x90, 0xAF, 0xFC, 0x0F, 0xFC, 0x90, 0x59, 0x69, 0x6D,
+    0xA4, 0xAD, 0x4E, 0x4E, 0x39, 0xE4, 0xE9, 0x29, 0xE9, 0x29, 0xEA, 0x2A, 0xEA, 0x29, 0xEA, 0x3F,
+    0x3A, 0xE4, 0xAE, 0x39, 0xE9, 0x4A, 0xE3, 0x9E, 0x94, 0x9E, 0x39, 0xE5, 0x9D, 0xA4, 0xE6, 0xDA,
+    0x4A, 0xD6, 0x99, 0x59, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0xAD, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x77, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F,
+    0xFA, 0x00, 0x69, 0x99, 0x99, 0x73, 0xAF, 0xEA, 0x70, 0xDA, 0x93, 0xAD, 0x95, 0xD9, 0x7D, 0x4A,
+    0xC1, 0x9A, 0xAA, 0xA3, 0xD2, 0x9C, 0xA1, 0xAD, 0xAD, 0x91, 0x9C, 0x91, 0xAC, 0x3C, 0xA0, 0x9C,
+    0xA2, 0xD1, 0xD3, 0xCA, 0x09, 0xCA, 0x2A, 0xC1, 0xD3, 0xDA, 0xD3, 0xAC, 0x1C, 0xA3, 0xF4, 0xAC,
+    0x1D, 0x3C, 0xA0, 0xD3, 0xAC, 0x1A, 0xC3, 0xCA, 0x09, 0xD2, 0xD1, 0x9C, 0x91, 0xEA, 0x09, 0xD0,
+    0x9C, 0xA2, 0xD1, 0x99, 0x99, 0x19, 0x90, 0xD4, 0xD7, 0x0A, 0xC9, 0x49, 0xD9, 0x49, 0xD9, 0x7A,
+    0xFF, 0x97, 0x29, 0xAA, 0xAA, 0x60, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xD9, 0x0F, 0xFD,
+    0x74, 0x29, 0xAD, 0xA9, 0x4F, 0xEA, 0x2E, 0x90, 0x9E, 0x90, 0x9D, 0x4E, 0x0A, 0xD4, 0x9D, 0x0A,
+    0xD4, 0x9D, 0x0A, 0xD4, 0xAD, 0x09, 0xDA, 0x3D, 0xA1, 0xFA, 0xAE, 0x3A, 0xFD, 0x69, 0xA9, 0x40,
+    0x77, 0x4D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA6, 0x99, 0x99, 0x9D, 0xA9, 0x99,
+    0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x6D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D,
+    0xA7, 0x3D, 0x97, 0x77, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xC0, 0x76, 0xAF, 0xA3, 0xAF, 0xEA, 0x19, 0xE1, 0x9E, 0x1A, 0xD3, 0xAD, 0x90, 0x9D, 0x3A,
+    0xD9, 0x7E, 0x79, 0xDA, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9D, 0xA6, 0xAD, 0xA6, 0xAF, 0xFD, 0x0A,
+    0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x74, 0xAF, 0xC9, 0x2F, 0xF9, 0x0A, 0xD9, 0x19,
+    0xDA, 0x09, 0xC9, 0x3E, 0x69, 0xD9, 0x59, 0xE3, 0x9A, 0xF4, 0xAF, 0xD3, 0x99, 0x99, 0xAE, 0x7A,
+    0xD7, 0xAD, 0x7E, 0x49, 0xAE, 0x90, 0xAF, 0xE9, 0x19, 0xFC, 0xA7, 0x60, 0x3A, 0x4E, 0x2A, 0xE2,
+    0xEA, 0x1E, 0xA1, 0xAD, 0xA2, 0xAC, 0x97, 0x20, 0x77, 0x5A, 0xD9, 0x6A, 0xD9, 0x5E, 0x96, 0xE9,
+    0x5E, 0x96, 0xE9, 0x5E, 0x7E, 0x95, 0xE7, 0xE9, 0x5E, 0x7E, 0x95, 0xE7, 0xE9, 0x5E, 0x7E, 0x95,
+    0xE7, 0xE9, 0x5E, 0x7E, 0x95, 0xE6, 0x9E, 0x95, 0xE9, 0x5A, 0xE9, 0x5E, 0xA5, 0xFA, 0x5F, 0x93,
+    0x9F, 0xC5, 0xFC, 0xA1, 0xAE, 0x9E, 0x19, 0x1F, 0xFE, 0x1F, 0xD0, 0x9D, 0x9A, 0xFD, 0x2A, 0xF9,
+    0x09, 0xDA, 0x19, 0x99, 0x59, 0x99, 0x29, 0xDA, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7,
+    0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0x99, 0x97, 0x71, 0x59, 0xAF, 0xFA, 0x3F, 0xFF, 0x91, 0x9F,
+    0xEA, 0xE9, 0x3F, 0xF0, 0xAC, 0xA3, 0xAF, 0xF0, 0xAC, 0xA3, 0xFF, 0xC0, 0xAC, 0xA3, 0xFF, 0xC0,
+    0xAC, 0xA2, 0x9F, 0xFC, 0x0A, 0xCA, 0x29, 0xFF, 0xC0, 0xAC, 0xA3, 0xFF, 0xC0, 0xAC, 0xA3, 0xFF,
+    0xC0, 0xAC, 0xA3, 0x9F, 0xF0, 0xAC, 0xA4, 0xAF, 0xE0, 0xAC, 0xA5, 0xAF, 0xD0, 0xAC, 0xA6, 0x9A,
+    0xC9, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7,
+    0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0xA7,
+    0x19, 0xD0, 0xAC, 0xA7, 0x19, 0xD0, 0xAC, 0x97, 0x19, 0xD0, 0xAC, 0x72, 0x9D, 0x75, 0x9D, 0x76,
+    0xA7, 0x49, 0xE9, 0xFF, 0xCA, 0x9E, 0x50, 0x19, 0x29, 0xF0, 0x9F, 0xC2, 0xE1, 0x9D, 0xA1, 0xE0,
+    0x9E, 0x2A, 0x92, 0x75, 0x9A, 0xC3, 0x9A, 0xF9, 0x2F, 0xD4, 0x99, 0xE6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xE9, 0x29, 0xFF, 0x0A, 0xFE, 0xA0, 0x75, 0x9F,
+    0xCA, 0x39, 0xEA, 0xF2, 0xDA, 0x2A, 0xDA, 0x0A, 0xD4, 0xE0, 0xE4, 0xE0, 0xDA, 0x4A, 0xD0, 0xE4,
+    0xE0, 0xE4, 0xDA, 0x09, 0xE2, 0xAD, 0x2A, 0xFE, 0x93, 0x9F, 0xA7, 0x77, 0x09, 0x2A, 0xFF, 0x2F,
+    0xF9, 0x10, 0x09, 0x79, 0x6D, 0x94, 0xDA, 0x6D, 0xA4, 0xE5, 0x9E, 0x4E, 0x5A, 0xE3, 0x9E, 0x94,
+    0xAE, 0x39, 0xE9, 0x4E, 0x93, 0xEA, 0x3F, 0x3A, 0xE9, 0x2A, 0xE9, 0x29, 0xE9, 0x29, 0xE4, 0xE9,
+    0x3E, 0x4E, 0x4D, 0xA4, 0xE5, 0x99, 0x59, 0x95, 0x77, 0x5A, 0x75, 0x9A, 0x75, 0x9D, 0x71, 0x9A,
+    0xE9, 0x74, 0xDA, 0x70, 0xFD, 0x74, 0xAD, 0x71, 0x9A, 0xAE, 0x74, 0xD9, 0x74, 0xAD, 0x73, 0xAD,
+    0x75, 0xAD, 0x73, 0xD9, 0x75, 0xAD, 0x72, 0xAC, 0xA7, 0x6A, 0xD7, 0x2D, 0x77, 0xAD, 0x71, 0xAC,
+    0xA6, 0x9A, 0x95, 0xAD, 0x70, 0x9D, 0x6E, 0x95, 0xAD, 0x70, 0xD9, 0x5A, 0xE9, 0x5A, 0xD7, 0x9D,
+    0x59, 0xF9, 0x5A, 0xD7, 0xD6, 0xDA, 0xD9, 0x29, 0xAF, 0xDA, 0x3A, 0xCA, 0x5E, 0x0D, 0x92, 0xFF,
+    0xC3, 0xD5, 0xAD, 0x1D, 0x97, 0x6A, 0xCA, 0x49, 0xD9, 0x1D, 0x97, 0x59, 0xD5, 0xDA, 0x2D, 0x97,
+    0x5D, 0xA4, 0xE2, 0x9D, 0x97, 0x49, 0xD5, 0xFF, 0xF7, 0x2D, 0x95, 0xAF, 0xFE, 0x71, 0xAD, 0x75,
+    0xD9, 0x73, 0xD9, 0x75, 0xD9, 0x72, 0xE7, 0x6D, 0x97, 0x19, 0xD7, 0x79, 0x97, 0x39, 0xA7, 0x77,
+    0x77, 0x74, 0x77, 0x49, 0x97, 0x59, 0xA7, 0x5D, 0xA7, 0x19, 0xAE, 0x97, 0x3A, 0xD7, 0x1F, 0xD7,
+    0x4D, 0x97, 0x19, 0xAA, 0xE7, 0x3A, 0xD7, 0x5A, 0xD7, 0x3D, 0x97, 0x5A, 0xD7, 0x2A, 0xCA, 0x76,
+    0xAD, 0x71, 0x9D, 0x77, 0xAD, 0x71, 0xDA, 0x77, 0xAD, 0x70, 0x9D, 0x49, 0xAD, 0xA6, 0xAD, 0x70,
+    0xD9, 0x29, 0xFE, 0x94, 0xAD, 0x79, 0xD2, 0x9E, 0x99, 0xF4, 0xAD, 0x7D, 0x3E, 0x3E, 0x4A, 0xD6,
+    0xAC, 0xA3, 0xDA, 0x3E, 0x19, 0xAF, 0xDA, 0x3D, 0x59, 0x93, 0xE1, 0xFF, 0xC2, 0xAC, 0xA7, 0x29,
+    0xD9, 0x74, 0x9D, 0x73, 0xE7, 0x5D, 0x97, 0x2E, 0x75, 0x9D, 0x71, 0x9E, 0x76, 0xD9, 0x70, 0x9E,
+    0x76, 0xAD, 0x70, 0xAD, 0xA7, 0x7D, 0x97, 0xAE, 0x99, 0x99, 0x99, 0x97, 0x0D, 0xA7, 0x0F, 0xFE,
+    0x79, 0xD7, 0x1A, 0xFF, 0xC9, 0x7D, 0xA7, 0x77, 0x5C, 0x77, 0x77, 0x77, 0x50, 0x77, 0x5A, 0x73,
+    0x9A, 0xDA, 0xA7, 0x49, 0xD7, 0x1A, 0xFE, 0x73, 0xDA, 0x70, 0xAD, 0xA9, 0x0A, 0xDA, 0x71, 0xAD,
+    0x71, 0x9C, 0xA3, 0xE7, 0x1D, 0x97, 0x29, 0x4D, 0xA7, 0x0A, 0xD7, 0x70, 0xE7, 0x1D, 0x97, 0x59,
+    0xAE, 0x71, 0xAC, 0xA7, 0x5A, 0xFC, 0xA7, 0x0D, 0x76, 0x9A, 0xAA, 0xEA, 0x6A, 0xCA, 0x69, 0xAA,
+    0x71, 0xE5, 0x9D, 0x6A, 0xDA, 0x71, 0xAD, 0x5D, 0x95, 0x9E, 0xA7, 0x1E, 0x49, 0xD6, 0xFA, 0x79,
+    0xE9, 0x4D, 0x6F, 0xCA, 0x29, 0xAA, 0xFC, 0xA4, 0xAC, 0xA5, 0xAD, 0x0D, 0xA2, 0xAF, 0xD9, 0x5D,
+    0x59, 0xD9, 0x0D, 0xA3, 0x99, 0x99, 0x7A, 0xCA, 0x5D, 0xA1, 0xDA, 0x76, 0x9D, 0x5E, 0x2D, 0xA7,
+    0x6D, 0xA4, 0xAD, 0x92, 0xE7, 0x59, 0xD5, 0xFF, 0xF9, 0x72, 0xD9, 0x59, 0xFF, 0xE7, 0x2A, 0xD7,
+    0x5D, 0xA7, 0x4D, 0x97, 0x5D, 0xA7, 0x3E, 0x76, 0xDA, 0x72, 0x9D, 0x77, 0x99, 0x97, 0x39, 0xA7,
+    0x77, 0x77, 0x76, 0x69, 0x97, 0x1F, 0x70, 0xF7, 0x0F, 0x70, 0x9A, 0xA9, 0x77, 0x77, 0x59, 0x71,
+    0x9D, 0x72, 0xD7, 0x19, 0xD9, 0x6A, 0xFA, 0x4A, 0xFD, 0xA3, 0xFF, 0x3A, 0xFA, 0x95, 0xE9, 0x70,
+    0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xE9, 0x70, 0xAF, 0xA9, 0xAD, 0x3A, 0xFF, 0x4A,
+    0xFE, 0x6A, 0xEA, 0x10, 0x77, 0x77, 0xAC, 0xA7, 0x75, 0xF7, 0x74, 0xAF, 0xA7, 0x73, 0xAF, 0xC7,
+    0x74, 0x9E, 0xA7, 0x76, 0x99, 0x77, 0x77, 0x77, 0x77, 0x69, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC,
+    0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77,
+    0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E,
+    0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7,
+    0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x76,
+    0x97, 0x76, 0xD7, 0x74, 0x9E, 0xA7, 0x72, 0xFC, 0x97, 0x70, 0x9F, 0xC9, 0x77, 0x1E, 0xA9, 0x77,
+    0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x29, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC,
+    0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7,
+    0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E,
+    0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E,
+    0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x77, 0x77, 0x2A, 0xDA,
+    0x77, 0x39, 0xFC, 0x77, 0x19, 0xFE, 0x77, 0x0E, 0x1A, 0xDA, 0x76, 0xE3, 0xAD, 0x97, 0x5C, 0xA5,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x49, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97,
+    0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69,
+    0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7,
+    0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7,
+    0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72,
+    0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x7E, 0x92, 0xC9, 0x76, 0xFC,
+    0x90, 0x9D, 0x75, 0x9F, 0xFD, 0x75, 0x9D, 0x1F, 0xCA, 0x76, 0xAA, 0x2A, 0xDA, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x76, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA,
+    0xDA, 0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E,
+    0x76, 0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97,
+    0xAE, 0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29,
+    0xFE, 0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x77, 0x76, 0x9D, 0xA3, 0xE7, 0x5F, 0x91,
+    0xAE, 0xA7, 0x4F, 0x91, 0xAE, 0x97, 0x49, 0xDA, 0x3D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59,
+    0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA,
+    0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7,
+    0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72,
+    0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71,
+    0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF,
+    0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x72, 0x99, 0x77, 0x4A, 0xFA, 0x77, 0x1A, 0xDA, 0xAD, 0x97, 0x70,
+    0xD2, 0xAD, 0x77, 0x9D, 0x29, 0xD7, 0x70, 0xD9, 0x1A, 0xD7, 0x70, 0xEA, 0xAD, 0x97, 0x71, 0xFC,
+    0xA7, 0x73, 0x99, 0x97, 0x77, 0x77, 0x79, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC,
+    0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7,
+    0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E,
+    0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E,
+    0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x73, 0xFF, 0xFF, 0xC9,
+    0x74, 0xFF, 0xFF, 0xCA, 0x75, 0x9F, 0xDA, 0xAA, 0xAA, 0xAE, 0xA7, 0x5A, 0xDA, 0xE6, 0xDA, 0x74,
+    0x9D, 0x9A, 0xE6, 0xAC, 0xA7, 0x4E, 0x0A, 0xE6, 0x9C, 0x97, 0x39, 0xD1, 0xAE, 0x77, 0x5D, 0xA1,
+    0xAE, 0x77, 0x4A, 0xD2, 0xAE, 0x77, 0x4D, 0xA2, 0xAE, 0x77, 0x3A, 0xD3, 0xAF, 0xFD, 0xA7, 0x29,
+    0xD9, 0x3A, 0xFF, 0xDA, 0x72, 0xE4, 0xAE, 0xAA, 0xAA, 0xAA, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xF7,
+    0x71, 0xFF, 0xFC, 0x77, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0xF7, 0x70, 0xDA, 0x6A, 0xE7, 0x09, 0x5E,
+    0x7A, 0xE7, 0xAC, 0x93, 0x9D, 0xA7, 0xAE, 0x7D, 0x93, 0xE7, 0x0A, 0xE6, 0x9D, 0x92, 0xAD, 0xA7,
+    0x0F, 0x99, 0x9A, 0xAA, 0xAE, 0x1A, 0xFE, 0x92, 0x9F, 0xFF, 0xF1, 0xFF, 0x92, 0xAF, 0xFF, 0xEA,
+    0x00, 0x77, 0x71, 0x9A, 0xFE, 0xA9, 0x59, 0xFF, 0xEA, 0x49, 0xFA, 0x99, 0x9A, 0xF3, 0x9E, 0xA6,
+    0xE3, 0xE9, 0x7E, 0x2E, 0xA7, 0x0D, 0xA1, 0x9E, 0x71, 0xAC, 0x91, 0xAE, 0x76, 0xEA, 0x76, 0xE9,
+    0x75, 0x9E, 0x97, 0x59, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x75, 0x9E, 0x97, 0x6E, 0xA7, 0x6F, 0x76,
+    0xAE, 0xA7, 0x6F, 0xA7, 0x5A, 0xFC, 0x97, 0x99, 0x2A, 0xFE, 0xAA, 0xAA, 0xEA, 0x3A, 0xFF, 0xFC,
+    0x6A, 0xFF, 0xCA, 0x72, 0x99, 0x99, 0x97, 0x69, 0x77, 0x9F, 0x75, 0x9F, 0xC7, 0x69, 0xE7, 0x69,
+    0xDA, 0x75, 0x9E, 0x75, 0x9E, 0x97, 0x6A, 0x97, 0x77, 0x7D, 0x97, 0x69, 0xEA, 0x76, 0xFC, 0x76,
+    0xFC, 0xA7, 0x6A, 0xE7, 0x71, 0x97, 0x77, 0x77, 0x49, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xAF, 0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE,
+    0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A,
+    0xE7, 0x0D, 0xA2, 0xAE, 0x79, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0xFC, 0x00, 0x77, 0x75, 0x9D, 0x76, 0xAE, 0x74, 0x9F, 0xC7, 0x3A, 0xFA, 0x73, 0x9E,
+    0xA7, 0x69, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19, 0x9F, 0xAA, 0xAA,
+    0xAA, 0xAF, 0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A, 0xE7, 0x0D, 0xA2,
+    0xAE, 0x79, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC,
+    0x00, 0x77, 0x72, 0xE9, 0x75, 0xAF, 0x97, 0x3A, 0xFD, 0x97, 0x1A, 0xDA, 0x1E, 0x97, 0xAD, 0xA3,
+    0xE7, 0xAC, 0xA5, 0xAA, 0x77, 0x77, 0x71, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70,
+    0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF,
+    0xFF, 0xC0, 0x77, 0x6A, 0xD9, 0x29, 0xDA, 0x69, 0xF2, 0xF6, 0x9F, 0x2F, 0x7A, 0xD9, 0x29, 0xD9,
+    0x77, 0x77, 0x77, 0x74, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7,
+    0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7,
+    0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x09,
+    0x71, 0xD7, 0xAE, 0x95, 0x9F, 0xC5, 0x9F, 0xC9, 0x59, 0xAE, 0x70, 0x99, 0x77, 0x70, 0x9F, 0xFC,
+    0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6,
+    0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE,
+    0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x77, 0x1A, 0xCA, 0x6F, 0x49, 0xFC, 0x3F, 0xCA, 0x3A, 0xE9,
+    0x69, 0x77, 0x74, 0x9F, 0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE,
+    0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x77, 0x0E, 0x7F, 0xC9, 0x4E,
+    0xAE, 0x92, 0xE9, 0x09, 0xE1, 0xAD, 0xA2, 0x9D, 0xA0, 0xAC, 0x95, 0xC9, 0x77, 0x70, 0x9F, 0xFC,
+    0x1A, 0xFF, 0xA2, 0x99, 0xF9, 0x6A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7,
+    0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE,
+    0x93, 0x9F, 0xFC, 0x1A, 0xFF, 0xC0, 0x74, 0xE9, 0x2A, 0xD9, 0x9E, 0xA1, 0x9F, 0x9E, 0xA1, 0x9F,
+    0x0A, 0xD3, 0xAD, 0x97, 0x77, 0x74, 0x9F, 0xFC, 0x1A, 0xFF, 0xA2, 0x99, 0xF9, 0x6A, 0xE7, 0xAE,
+    0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A,
+    0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x93, 0x9F, 0xFC, 0x1A, 0xFF, 0xC0, 0x71, 0x97,
+    0x59, 0xAF, 0xFF, 0xA9, 0x7A, 0xFF, 0xFF, 0x96, 0x99, 0xF1, 0x99, 0xAA, 0xFC, 0xA7, 0xAE, 0x6A,
+    0xFA, 0x6A, 0xE7, 0x0F, 0x95, 0xAE, 0x71, 0xF5, 0xAE, 0x71, 0xAE, 0x94, 0xAE, 0x72, 0xEA, 0x4A,
+    0xE7, 0x2F, 0x4A, 0xE7, 0x2A, 0xE1, 0x99, 0x9F, 0x99, 0x99, 0x95, 0xAE, 0x1F, 0xFF, 0x94, 0xAE,
+    0x1A, 0xAA, 0xFA, 0xAA, 0xAA, 0x5A, 0xE4, 0xAE, 0x72, 0xAE, 0x4A, 0xE7, 0x2E, 0xA4, 0xAE, 0x72,
+    0xE9, 0x4A, 0xE7, 0x1A, 0xE5, 0xAE, 0x71, 0xEA, 0x5A, 0xE7, 0x0F, 0x6A, 0xE6, 0x9F, 0x7A, 0xE9,
+    0x99, 0x99, 0xAF, 0xC5, 0x9F, 0xFF, 0xE9, 0x6A, 0xFF, 0xFA, 0x97, 0x77, 0x70, 0x7A, 0xD9, 0x2A,
+    0xA7, 0x7F, 0xCA, 0x1D, 0x77, 0xFF, 0xD7, 0x7D, 0x1A, 0xFC, 0x77, 0xAA, 0x29, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x79, 0xFD, 0x70, 0xFF, 0xC0, 0x9F, 0xDA, 0x7F, 0xFA, 0x29, 0xFC, 0x97, 0x99,
+    0xE9, 0x5A, 0xFC, 0x71, 0xAD, 0x6A, 0xFC, 0xA7, 0x0A, 0xD6, 0xAD, 0xAE, 0x97, 0xAD, 0x6A, 0xD0,
+    0xAE, 0x7A, 0xD6, 0xAD, 0x1F, 0x6A, 0xD6, 0xAD, 0x19, 0xE9, 0x5A, 0xD6, 0xAD, 0x2A, 0xE5, 0xAD,
+    0x6A, 0xD3, 0xF4, 0xAD, 0x6A, 0xD3, 0x9E, 0xA3, 0xAD, 0x6A, 0xD4, 0xAE, 0x92, 0xAD, 0x6A, 0xD5,
+    0xF2, 0xAD, 0x6A, 0xD6, 0xEA, 0x1A, 0xD6, 0xAD, 0x69, 0xE9, 0x0A, 0xD6, 0xAD, 0x7F, 0x0A, 0xD6,
+    0xAD, 0x70, 0xEA, 0xAD, 0x6A, 0xD7, 0x09, 0xFD, 0x6A, 0xD7, 0x1A, 0xFC, 0x6A, 0xD9, 0x71, 0xFC,
+    0x39, 0xFF, 0x96, 0x9F, 0x3A, 0xFF, 0x97, 0xAE, 0x77, 0x69, 0x50, 0x77, 0x76, 0xAC, 0xA7, 0x74,
+    0xF7, 0x73, 0xAF, 0xA7, 0x72, 0xAF, 0xC7, 0x73, 0x9E, 0xA7, 0x75, 0x99, 0x77, 0x77, 0x72, 0x99,
+    0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA,
+    0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA,
+    0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9,
+    0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE,
+    0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7,
+    0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97, 0x10, 0x76, 0x97, 0x75, 0xD9,
+    0x77, 0x29, 0xEA, 0x77, 0x1A, 0xF9, 0x77, 0x9F, 0xC9, 0x77, 0x0E, 0xA9, 0x77, 0x29, 0x97, 0x77,
+    0x77, 0x69, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF, 0xFC, 0x70, 0xAF, 0xA9, 0x19, 0xAF,
+    0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73, 0xF2, 0x9E, 0x97, 0x3A, 0xE9, 0x1F,
+    0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A,
+    0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA, 0x75, 0xEA, 0x1F, 0x75, 0xE9, 0x1F,
+    0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4, 0x9F, 0x97, 0xAE, 0x95, 0xAF, 0xC9,
+    0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xAA, 0xA9, 0x71, 0x77, 0x77,
+    0x1A, 0xDA, 0x77, 0x29, 0xFC, 0x77, 0x1F, 0xE7, 0x7E, 0x1A, 0xE7, 0x5E, 0x3A, 0xD9, 0x74, 0xD5,
+    0x9A, 0x77, 0x77, 0x70, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA,
+    0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73,
+    0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75, 0xAE, 0x09,
+    0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7,
+    0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9,
+    0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97,
+    0x10, 0x7E, 0x92, 0xC9, 0x75, 0xFC, 0xA0, 0x9D, 0x74, 0x9F, 0xFD, 0x74, 0x9D, 0x1F, 0xCA, 0x75,
+    0xAA, 0x2A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF,
+    0xFC, 0x70, 0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73,
+    0xF2, 0x9E, 0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E,
+    0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA,
+    0x75, 0xEA, 0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4,
+    0x9F, 0x97, 0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76,
+    0x99, 0xAA, 0xA9, 0x71, 0x77, 0x75, 0x9E, 0x3E, 0x74, 0xF9, 0x1A, 0xEA, 0x73, 0xF9, 0x1A, 0xE9,
+    0x73, 0x9D, 0xA3, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29,
+    0xFF, 0xFC, 0x70, 0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F,
+    0x73, 0xF2, 0x9E, 0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0,
+    0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09,
+    0xEA, 0x75, 0xEA, 0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A,
+    0xE4, 0x9F, 0x97, 0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA,
+    0x76, 0x99, 0xAA, 0xA9, 0x71, 0x19, 0x73, 0xAC, 0xA6, 0xD1, 0x9D, 0xA4, 0xE2, 0xAD, 0xA2, 0xE4,
+    0xAD, 0xA0, 0xE6, 0xAF, 0xC7, 0x0A, 0xE7, 0x1F, 0xA7, 0xEA, 0xD9, 0x5E, 0x1A, 0xD9, 0x3E, 0x92,
+    0xAD, 0x91, 0xE9, 0x4A, 0xD9, 0x1C, 0x96, 0xAA, 0x76, 0x72, 0x99, 0x99, 0x77, 0x1A, 0xFF, 0xC9,
+    0x29, 0xC9, 0x59, 0xFF, 0xFC, 0x09, 0xD9, 0x4A, 0xFA, 0x91, 0x9A, 0xFE, 0x94, 0xAE, 0xA7, 0xFC,
+    0x94, 0x9E, 0xA7, 0x1F, 0xA4, 0xF7, 0x1A, 0xFC, 0x39, 0xE9, 0x70, 0xAF, 0xD9, 0x2F, 0x70, 0xAD,
+    0x99, 0xEA, 0x2E, 0xA7, 0xAD, 0x91, 0xF2, 0xE9, 0x6A, 0xD9, 0x2F, 0x19, 0xE9, 0x5A, 0xD9, 0x3F,
+    0x19, 0xE9, 0x4A, 0xD9, 0x4A, 0xE1, 0x9E, 0x93, 0xAD, 0x95, 0xAE, 0x19, 0xEA, 0x2A, 0xD9, 0x6F,
+    0x19, 0xEA, 0x1A, 0xD9, 0x7E, 0xA2, 0xF0, 0xAD, 0x97, 0x0E, 0x92, 0xFA, 0xD9, 0x70, 0xAE, 0x39,
+    0xFC, 0x97, 0x1E, 0xA4, 0xFA, 0x71, 0xAE, 0x5A, 0xF9, 0x7A, 0xE9, 0x4A, 0xFE, 0x93, 0x9F, 0xA4,
+    0xAD, 0x99, 0xFF, 0xFC, 0x95, 0xD9, 0x2A, 0xFF, 0xCA, 0x70, 0x95, 0x99, 0xAA, 0xA9, 0x71, 0x70,
+    0x97, 0x76, 0x9C, 0xA7, 0x75, 0xAE, 0x97, 0x73, 0xAF, 0xA7, 0x73, 0x9F, 0xC7, 0x74, 0x9A, 0xE7,
+    0x76, 0x99, 0x77, 0x77, 0x77, 0x73, 0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9,
+    0x70, 0x9A, 0xE9, 0x49, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71,
+    0xAD, 0xA6, 0xF7, 0x1E, 0x96, 0x9F, 0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9,
+    0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0x99, 0x97, 0x10, 0x77, 0x97, 0x76, 0xAC, 0x97, 0x73, 0x9E,
+    0xA7, 0x72, 0xAF, 0xA7, 0x71, 0xFC, 0x97, 0x71, 0xEA, 0x97, 0x73, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49, 0xE7, 0x3E,
+    0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E, 0x96, 0x9F,
+    0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99,
+    0x99, 0x97, 0x10, 0x77, 0x77, 0x39, 0xE7, 0x74, 0xFC, 0x77, 0x2F, 0xE7, 0x70, 0xE9, 0x0A, 0xE7,
+    0x6E, 0x92, 0x9D, 0xA7, 0x5A, 0xC5, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x0F, 0xFC, 0x5A, 0xFF, 0x9F,
+    0xFA, 0x5F, 0xFA, 0x19, 0xAE, 0x97, 0x09, 0xAE, 0x94, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E,
+    0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73,
+    0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE6,
+    0xE9, 0x71, 0x9E, 0x6E, 0xA7, 0x1A, 0xDA, 0x6F, 0x71, 0xE9, 0x69, 0xF7, 0xF7, 0x0F, 0xCA, 0x99,
+    0x99, 0xAF, 0x72, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x99, 0x99, 0x71, 0x77, 0x77,
+    0x0E, 0x3E, 0x97, 0x4A, 0xEA, 0x19, 0xEA, 0x74, 0xAE, 0x91, 0x9E, 0xA7, 0x5D, 0xA3, 0xAD, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x2F, 0xFC, 0x5A, 0xFF, 0x9F, 0xFA, 0x5F, 0xFA, 0x19, 0xAE, 0x97, 0x09,
+    0xAE, 0x94, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73,
+    0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5,
+    0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE6, 0xE9, 0x71, 0x9E, 0x6E, 0xA7, 0x1A, 0xDA,
+    0x6F, 0x71, 0xE9, 0x69, 0xF7, 0xF7, 0x0F, 0xCA, 0x99, 0x99, 0xAF, 0x72, 0xFF, 0xFC, 0x97, 0x3A,
+    0xFF, 0xCA, 0x77, 0x09, 0x99, 0x99, 0x71, 0x75, 0x97, 0x74, 0xAC, 0x97, 0x71, 0x9F, 0x77, 0x0A,
+    0xFA, 0x77, 0xFC, 0xA7, 0x7E, 0xA9, 0x77, 0x19, 0x97, 0x77, 0x77, 0x77, 0x2A, 0xFF, 0xC3, 0xFF,
+    0x0A, 0xFF, 0xA3, 0xFF, 0x19, 0xAF, 0x97, 0xAE, 0x94, 0x9E, 0x97, 0xE7, 0xF6, 0x9D, 0xA7, 0x9E,
+    0x95, 0xE7, 0x1A, 0xE4, 0x9D, 0x97, 0x2E, 0xA3, 0xE7, 0x3A, 0xE2, 0x9D, 0x97, 0x4E, 0xA1, 0xE7,
+    0x59, 0xE0, 0xAD, 0x77, 0xAD, 0xAD, 0xA7, 0x70, 0xFC, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE7, 0x72,
+    0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE9, 0x97, 0x59,
+    0xFF, 0xD7, 0x3F, 0xFE, 0x50, 0x9F, 0xFA, 0x79, 0xFE, 0xA9, 0x71, 0x9A, 0xDA, 0x75, 0xAD, 0xA7,
+    0x5A, 0xE9, 0xAA, 0x99, 0x70, 0xAF, 0xFD, 0xA5, 0xAF, 0xAF, 0xE9, 0x3A, 0xDA, 0x49, 0xF3, 0xAD,
+    0xA5, 0x9E, 0xA2, 0xAD, 0xA6, 0xAE, 0x2A, 0xDA, 0x69, 0xE2, 0xAD, 0xA6, 0x9E, 0x2A, 0xDA, 0x6A,
+    0xE2, 0xAD, 0xA6, 0xEA, 0x2A, 0xDA, 0x5A, 0xE3, 0xAD, 0xA4, 0xAE, 0x93, 0xAE, 0xAA, 0xAF, 0xC9,
+    0x4A, 0xFF, 0xCA, 0x6A, 0xE9, 0x99, 0x97, 0x1A, 0xDA, 0x75, 0xAD, 0xA7, 0x3A, 0xFE, 0xA7, 0xAF,
+    0xFC, 0x70, 0x70, 0x9A, 0xAA, 0xA9, 0x74, 0x9F, 0xF9, 0x71, 0xAF, 0xAF, 0xC9, 0x79, 0xE4, 0xF7,
+    0xE5, 0x9E, 0x69, 0xDA, 0x6E, 0x6E, 0x96, 0xE6, 0xE6, 0x9E, 0x6E, 0x59, 0xE7, 0xE4, 0x9D, 0xA7,
+    0x0E, 0x4D, 0xA7, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x97, 0x1E, 0x3F, 0xA7, 0x0E, 0x39,
+    0xFA, 0x7E, 0x49, 0xFC, 0x6E, 0x6F, 0xC5, 0xE7, 0xFA, 0x4E, 0x70, 0xF4, 0xE7, 0x1E, 0x4E, 0x19,
+    0x95, 0xE4, 0xE1, 0xD5, 0xE3, 0x9E, 0x1E, 0x3A, 0xD9, 0x19, 0xFC, 0x1F, 0xCA, 0xEA, 0x2F, 0xD2,
+    0xFE, 0x97, 0x59, 0x99, 0x95, 0x77, 0x5C, 0x77, 0xE7, 0x6E, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0x97,
+    0x59, 0xE7, 0x7A, 0xC7, 0x77, 0x77, 0x72, 0x99, 0x99, 0x73, 0xAF, 0xDA, 0x79, 0xFF, 0xD5, 0x9E,
+    0x92, 0xAE, 0x5E, 0xA4, 0xE9, 0x4A, 0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD, 0xA7, 0x5A, 0xDA, 0x72,
+    0x99, 0x9E, 0xA6, 0x9A, 0xFF, 0xA5, 0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0x5A, 0xDA, 0x39,
+    0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0xA4, 0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF, 0xF9, 0xFD, 0x2A, 0xFD,
+    0x90, 0x9F, 0x59, 0x99, 0x59, 0x30, 0x70, 0xAA, 0x77, 0xDA, 0x75, 0xF7, 0x4A, 0xE7, 0x5E, 0x97,
+    0x4E, 0x97, 0x5D, 0x77, 0x77, 0x77, 0x39, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9,
+    0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29,
+    0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E,
+    0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9,
+    0x09, 0xF5, 0x99, 0x95, 0x93, 0x79, 0x76, 0xE9, 0x74, 0xFC, 0x97, 0x29, 0xFD, 0x72, 0xE0, 0xAD,
+    0xA7, 0x0A, 0xD2, 0xAD, 0x96, 0x9D, 0x93, 0xDA, 0x7A, 0x95, 0x97, 0x77, 0x59, 0x99, 0x97, 0x3A,
+    0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99,
+    0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93,
+    0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99,
+    0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93, 0x49, 0x76, 0xF9, 0x19, 0xC9,
+    0x6A, 0xFC, 0x90, 0xDA, 0x6E, 0x9A, 0xFC, 0xA6, 0xAC, 0x91, 0xAF, 0x70, 0x93, 0x9A, 0xA7, 0x77,
+    0x77, 0x70, 0x99, 0x99, 0x73, 0xAF, 0xDA, 0x79, 0xFF, 0xD5, 0x9E, 0x92, 0xAE, 0x5E, 0xA4, 0xE9,
+    0x4A, 0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD, 0xA7, 0x5A, 0xDA, 0x72, 0x99, 0x9E, 0xA6, 0x9A, 0xFF,
+    0xA5, 0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E,
+    0xA4, 0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF, 0xF9, 0xFD, 0x2A, 0xFD, 0x90, 0x9F, 0x59, 0x99, 0x59,
+    0x30, 0x29, 0x94, 0x99, 0x7F, 0x2F, 0x6F, 0x2F, 0x6E, 0xA2, 0xEA, 0x79, 0x94, 0x99, 0x77, 0x77,
+    0x77, 0x99, 0x99, 0x73, 0xAF, 0xDA, 0x79, 0xFF, 0xD5, 0x9E, 0x92, 0xAE, 0x5E, 0xA4, 0xE9, 0x4A,
+    0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD, 0xA7, 0x5A, 0xDA, 0x72, 0x99, 0x9E, 0xA6, 0x9A, 0xFF, 0xA5,
+    0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0xA4,
+    0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF, 0xF9, 0xFD, 0x2A, 0xFD, 0x90, 0x9F, 0x59, 0x99, 0x59, 0x30,
+    0x77, 0x6A, 0xF7, 0x3F, 0xE7, 0x19, 0xD1, 0x9D, 0x97, 0x0A, 0xCA, 0x2D, 0xA7, 0x0A, 0xCA, 0x2D,
+    0xA7, 0x09, 0xD9, 0x1D, 0x97, 0x1F, 0xDA, 0x73, 0xFA, 0x77, 0x77, 0x99, 0x99, 0x73, 0xAF, 0xDA,
+    0x79, 0xFF, 0xD5, 0x9E, 0x92, 0xAE, 0x5E, 0xA4, 0xE9, 0x4A, 0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD,
+    0xA7, 0x5A, 0xDA, 0x72, 0x99, 0x9E, 0xA6, 0x9A, 0xFF, 0xA5, 0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA,
+    0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0xA4, 0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF,
+    0xF9, 0xFD, 0x2A, 0xFD, 0x90, 0x9F, 0x59, 0x99, 0x59, 0x30, 0x59, 0x99, 0x96, 0x99, 0x97, 0x0A,
+    0xFD, 0x91, 0x9F, 0xE4, 0x9F, 0xFC, 0x09, 0xFF, 0xC2, 0x9E, 0x92, 0xAF, 0xCA, 0x29, 0xEA, 0x1E,
+    0xA4, 0xFC, 0x49, 0xE1, 0xAD, 0x94, 0xAE, 0x95, 0xE9, 0x19, 0x95, 0xAE, 0x6E, 0x97, 0x1A, 0xE0,
+    0x99, 0xAA, 0xAF, 0x95, 0x9A, 0xAF, 0xFF, 0xE9, 0x29, 0xFF, 0xFA, 0xAA, 0x99, 0x94, 0xFC, 0xA9,
+    0x9A, 0xDA, 0x73, 0xF4, 0xAD, 0xA7, 0x3E, 0x59, 0xE7, 0x29, 0xE6, 0xE9, 0x71, 0x9E, 0x59, 0xF9,
+    0x71, 0xF9, 0x19, 0xFF, 0x99, 0x99, 0xAD, 0x1A, 0xFF, 0xC9, 0x9F, 0xFE, 0x2A, 0xFD, 0xA3, 0xFF,
+    0xA5, 0x99, 0x99, 0x79, 0x99, 0x99, 0x30, 0x69, 0x99, 0x97, 0x0A, 0xFD, 0xA4, 0x9F, 0xFD, 0x29,
+    0xE9, 0x19, 0xF2, 0xE5, 0xE9, 0x0A, 0xD9, 0x5A, 0xD1, 0xE6, 0x99, 0x19, 0xE7, 0x2A, 0xDA, 0x72,
+    0xAD, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFC, 0xA9, 0x99,
+    0x9A, 0xCA, 0x19, 0xFF, 0xE9, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x97, 0x29, 0x97, 0x3F, 0xA7, 0x1A,
+    0xF9, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x1E, 0x97, 0x29, 0xA6, 0x77, 0x29, 0xC7, 0x39,
+    0xDA, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xF7, 0x3A, 0xE7, 0x39, 0xD7, 0x77, 0x77, 0x19, 0x99, 0x70,
+    0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D,
+    0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD,
+    0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3,
+    0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93, 0x71, 0xA9, 0x73, 0xAD, 0x97, 0x2E, 0x97, 0x1F, 0x71, 0xAE,
+    0x72, 0xE7, 0x3C, 0xA7, 0x77, 0x77, 0x29, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F,
+    0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA,
+    0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97,
+    0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93, 0x79,
+    0x73, 0x9E, 0x72, 0xFC, 0x70, 0xFD, 0xA6, 0x9D, 0xA0, 0xE9, 0x5E, 0x2E, 0x4E, 0x4D, 0x93, 0x9A,
+    0x59, 0x97, 0x77, 0x99, 0x97, 0x09, 0xFE, 0x94, 0xFF, 0xD9, 0x2E, 0xA3, 0xF1, 0x9D, 0xA5, 0xE9,
+    0x0E, 0x6A, 0xDA, 0x0E, 0x69, 0xDA, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0xAF, 0xFF, 0xCA, 0xAF,
+    0xFF, 0xC9, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xF9, 0x71, 0x9F, 0xCA, 0x99,
+    0x99, 0xAC, 0x91, 0xAF, 0xFE, 0x39, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x30, 0x39, 0x94, 0x99, 0x4E,
+    0x92, 0xEA, 0x29, 0xEA, 0x19, 0xEA, 0x29, 0xE9, 0x2E, 0x94, 0x95, 0x97, 0x77, 0x77, 0x99, 0x97,
+    0x09, 0xFE, 0x94, 0xFF, 0xD9, 0x2E, 0xA3, 0xF1, 0x9D, 0xA5, 0xE9, 0x0E, 0x6A, 0xDA, 0x0E, 0x69,
+    0xDA, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0xAF, 0xFF, 0xCA, 0xAF, 0xFF, 0xC9, 0xAD, 0xA7, 0x2A,
+    0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xF9, 0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0x91, 0xAF, 0xFE,
+    0x39, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x30, 0x73, 0x9C, 0x70, 0xE6, 0x9E, 0xA6, 0xAE, 0x96, 0xAE,
+    0x96, 0x9E, 0x70, 0xD7, 0x77, 0x75, 0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F,
+    0xF1, 0xFF, 0xC0, 0x6A, 0x97, 0x9D, 0xA6, 0xEA, 0x5A, 0xE5, 0x9E, 0x6E, 0x7D, 0x77, 0x77, 0x69,
+    0xAF, 0x93, 0xFD, 0x93, 0x9A, 0xF9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E,
+    0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x39, 0xFF, 0x1F, 0xFC, 0x00, 0x59, 0x69, 0xE9,
+    0x5F, 0xC4, 0xAF, 0xD3, 0xE0, 0xAD, 0xA1, 0xE2, 0xAD, 0x0A, 0xD9, 0x3D, 0x90, 0xA6, 0x97, 0x77,
+    0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC0, 0x19, 0x94, 0x99,
+    0x1E, 0xA2, 0xF9, 0xF2, 0xF0, 0xEA, 0x2E, 0xA1, 0x99, 0x49, 0x97, 0x77, 0x76, 0x9A, 0xF9, 0x4F,
+    0xD9, 0x49, 0xAF, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97,
+    0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x94, 0x9F, 0xF2, 0xFF, 0xC0, 0x77, 0x6D, 0x3A, 0xCA, 0x79, 0xEA,
+    0x0E, 0x97, 0x1F, 0xCA, 0x74, 0xF7, 0x39, 0xFD, 0x71, 0xAD, 0x90, 0xAD, 0xA7, 0x09, 0xC3, 0xAD,
+    0xA7, 0x6E, 0x77, 0xE7, 0xAF, 0xC9, 0xAD, 0x94, 0x9F, 0xFA, 0xE3, 0x9E, 0xA9, 0x99, 0xAF, 0xC3,
+    0xE9, 0x5F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x71, 0xE0,
+    0xAE, 0x71, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x71, 0xE0, 0x9E, 0x97, 0x9D, 0xA1, 0xEA, 0x7E, 0x2F,
+    0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x49, 0xFF, 0xE9, 0x6F, 0xFA, 0x72, 0x9A, 0xA9, 0x96, 0x79, 0x97,
+    0x72, 0xF2, 0xAC, 0x73, 0xAF, 0xC9, 0x0D, 0x97, 0x2E, 0x9F, 0xD9, 0x72, 0xD2, 0xFC, 0x74, 0x93,
+    0x9A, 0x97, 0x77, 0x77, 0x77, 0x59, 0x99, 0x97, 0x0A, 0xEA, 0x1A, 0xFD, 0xA5, 0xFD, 0x0F, 0xFC,
+    0xA4, 0xAA, 0xFE, 0xA9, 0x9A, 0xF7, 0xFA, 0x49, 0xE9, 0x6E, 0x96, 0xEA, 0x6E, 0x96, 0xEA, 0x6E,
+    0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD,
+    0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA3, 0x9F,
+    0xEA, 0x29, 0xFE, 0x90, 0xFF, 0xA2, 0xFF, 0x90, 0x77, 0x6C, 0xA7, 0x6A, 0xD9, 0x75, 0xF7, 0x59,
+    0xF7, 0x59, 0xEA, 0x76, 0xE9, 0x76, 0x9C, 0xA7, 0x77, 0x77, 0x71, 0x99, 0x99, 0x73, 0xAF, 0xE9,
+    0x69, 0xFF, 0xE4, 0xAE, 0x92, 0x9F, 0xA3, 0xE6, 0xF9, 0x1A, 0xDA, 0x7E, 0xA1, 0xE7, 0x0A, 0xE0,
+    0x9E, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x70, 0x9E,
+    0x09, 0xE9, 0x79, 0xE1, 0xEA, 0x7E, 0x91, 0xF9, 0x59, 0xE3, 0xFA, 0x3A, 0xE9, 0x39, 0xFF, 0xE9,
+    0x6F, 0xFA, 0x72, 0x9A, 0xA9, 0x96, 0x72, 0xA7, 0x7E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0xEA, 0x74,
+    0xAD, 0xA7, 0x5A, 0xC9, 0x77, 0x77, 0x77, 0x29, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A,
+    0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0,
+    0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E,
+    0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29,
+    0xAA, 0x99, 0x60, 0x70, 0x97, 0x6F, 0x74, 0x9F, 0xA7, 0x3F, 0xD9, 0x71, 0xAD, 0x90, 0xE7, 0x09,
+    0xDA, 0x19, 0xDA, 0x7D, 0xA3, 0x9D, 0x79, 0x95, 0x97, 0x77, 0x59, 0x99, 0x97, 0x3A, 0xFE, 0x96,
+    0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09,
+    0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0,
+    0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96,
+    0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60, 0x59, 0x76, 0xAE, 0xA2, 0xCA, 0x7F, 0xCA, 0x0A, 0xD6, 0x9D,
+    0x9A, 0xFD, 0x69, 0xCA, 0x19, 0xF9, 0x79, 0x93, 0xAA, 0x97, 0x77, 0x77, 0x79, 0x99, 0x97, 0x3A,
+    0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70,
+    0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7,
+    0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F,
+    0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60, 0x39, 0x94, 0x99, 0x7A, 0xE2, 0x9E, 0x6F, 0x91,
+    0xAE, 0x95, 0xAE, 0x29, 0xE7, 0x99, 0x49, 0x97, 0x77, 0x77, 0x79, 0x99, 0x97, 0x3A, 0xFE, 0x96,
+    0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09,
+    0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0,
+    0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96,
+    0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60, 0x59, 0xA9, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x19, 0xE7, 0x49,
+    0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x77, 0x77,
+    0x49, 0xA9, 0x72, 0xAE, 0x72, 0xAE, 0x97, 0x19, 0xE7, 0x74, 0x79, 0x99, 0x97, 0x4A, 0xFE, 0x90,
+    0x9C, 0x93, 0x9F, 0xFF, 0xC9, 0x2A, 0xE9, 0x29, 0xFC, 0x93, 0xE6, 0xF9, 0x2A, 0xD9, 0x5A, 0xFA,
+    0x2E, 0x5A, 0xFD, 0x19, 0xE4, 0xAD, 0x99, 0xE1, 0xAD, 0xA3, 0xAD, 0x91, 0xE9, 0x0A, 0xDA, 0x2A,
+    0xD9, 0x2E, 0x1A, 0xDA, 0x1A, 0xD9, 0x3E, 0x1A, 0xE0, 0xAD, 0x94, 0xE1, 0x9E, 0xAD, 0x94, 0x9E,
+    0x2F, 0xC9, 0x5A, 0xD9, 0x2F, 0x95, 0x9E, 0x3A, 0xF9, 0x39, 0xE9, 0x2A, 0xFF, 0xFC, 0x93, 0xD9,
+    0x0F, 0xFA, 0x73, 0x9A, 0xA9, 0x96, 0x77, 0x73, 0x9C, 0x77, 0x29, 0xDA, 0x77, 0x1A, 0xE9, 0x77,
+    0x1F, 0x97, 0x71, 0xF7, 0x72, 0xAE, 0x77, 0x3D, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAA, 0xEA, 0x4A,
+    0xFC, 0x3A, 0xFC, 0xA3, 0x9F, 0xD4, 0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6,
+    0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5,
+    0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7, 0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99,
+    0x49, 0x93, 0x73, 0xA9, 0x77, 0x2A, 0xD9, 0x77, 0x1E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x77, 0x1E,
+    0x77, 0x2C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD,
+    0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A,
+    0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD,
+    0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x71, 0x97, 0x72,
+    0x9E, 0x77, 0x1F, 0xC7, 0x7A, 0xFC, 0xA7, 0x59, 0xDA, 0x0E, 0x97, 0x4E, 0x2E, 0x73, 0xAD, 0x4D,
+    0x97, 0x29, 0xA5, 0x99, 0x77, 0x77, 0x77, 0x3A, 0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD,
+    0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A,
+    0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD,
+    0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x59, 0x94, 0x99,
+    0x73, 0xEA, 0x2E, 0xA7, 0x19, 0xEA, 0x19, 0xEA, 0x72, 0xE9, 0x2E, 0x97, 0x39, 0x59, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0xAA, 0xEA, 0x4A, 0xFC, 0x3A, 0xFC, 0xA3, 0x9F, 0xD4, 0x9A, 0xEA, 0x49, 0xAE,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7, 0xAF, 0xFC, 0x9F, 0xD5,
+    0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x72, 0x9A, 0x77, 0x1E, 0x77, 0xF7, 0x6A, 0xE9,
+    0x76, 0xE9, 0x76, 0xE9, 0x77, 0xD7, 0x77, 0x77, 0x77, 0x75, 0x9F, 0xEA, 0x2A, 0xFD, 0xA9, 0xFE,
+    0xA2, 0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A, 0xD9, 0x4E, 0xA6, 0xE5, 0x9E, 0x59, 0xDA,
+    0x6E, 0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD, 0x71, 0xAD, 0xA2, 0xDA, 0x72, 0xE1, 0x9D,
+    0x97, 0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E, 0xAD, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0xAD,
+    0xA7, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA7, 0x49, 0xFC, 0x72, 0xAF, 0xE7, 0x3A, 0xFD,
+    0x75, 0x9A, 0xAA, 0x97, 0x50, 0x39, 0x99, 0x75, 0xAF, 0xC7, 0x49, 0xFD, 0x76, 0x9A, 0xE7, 0x79,
+    0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE3, 0x99, 0x97, 0x09, 0xE1, 0xFE, 0x69, 0xE9,
+    0xFF, 0xC5, 0x9F, 0xDA, 0x9A, 0xFC, 0x49, 0xF9, 0x4F, 0x93, 0x9E, 0x7E, 0xA3, 0x9E, 0x7A, 0xE3,
+    0x9E, 0x79, 0xE3, 0x9E, 0x79, 0xE3, 0x9E, 0x79, 0xE3, 0x9E, 0x79, 0xE3, 0x9E, 0x7A, 0xE3, 0x9E,
+    0x7E, 0xA3, 0x9E, 0x7E, 0x49, 0xE6, 0xEA, 0x49, 0xEA, 0x99, 0x09, 0xAF, 0x59, 0xFF, 0xF6, 0x9F,
+    0xFD, 0x97, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x76, 0x9F, 0xCA, 0xA7, 0x2F,
+    0xFC, 0x97, 0x19, 0x99, 0x99, 0x99, 0x99, 0x71, 0x49, 0x94, 0x99, 0x71, 0xF2, 0xF7, 0x0F, 0x2F,
+    0x70, 0xEA, 0x2F, 0x71, 0x99, 0x49, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xEA, 0x2A, 0xFD, 0xA9,
+    0xFE, 0xA2, 0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A, 0xD9, 0x4E, 0xA6, 0xE5, 0x9E, 0x59,
+    0xDA, 0x6E, 0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD, 0x71, 0xAD, 0xA2, 0xDA, 0x72, 0xE1,
+    0x9D, 0x97, 0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E, 0xAD, 0x75, 0x9F, 0x97, 0x6F, 0x77,
+    0xAD, 0xA7, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA7, 0x49, 0xFC, 0x72, 0xAF, 0xE7, 0x3A,
+    0xFD, 0x75, 0x9A, 0xAA, 0x97, 0x50, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0x6F, 0xFD, 0x75, 0x9F,
+    0xFD, 0x76, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xD7, 0x74, 0x9E,
+    0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A,
+    0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE,
+    0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97,
+    0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9,
+    0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49,
+    0xFF, 0xC0, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x96, 0xAF, 0xFC, 0xA6, 0xFF, 0xD9, 0x77, 0x77, 0x77,
+    0x77, 0x09, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94,
+    0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA,
+    0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA,
+    0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93,
+    0x77, 0x77, 0xA9, 0x6C, 0x75, 0x9D, 0x94, 0xD7, 0x59, 0xEA, 0x99, 0x9E, 0x76, 0xAF, 0xF7, 0x70,
+    0x9F, 0xCA, 0x77, 0x49, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7,
+    0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D,
+    0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9,
+    0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72,
+    0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x77,
+    0x39, 0xC9, 0x5A, 0xA6, 0xE9, 0x3A, 0xCA, 0x69, 0xFA, 0xAE, 0x70, 0xAF, 0xE9, 0x71, 0x9A, 0xEA,
+    0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA,
+    0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69,
+    0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39,
+    0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99,
+    0x95, 0x93, 0x77, 0x77, 0x39, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71,
+    0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9,
+    0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29,
+    0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A,
+    0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E,
+    0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC7, 0x71, 0x9D, 0xA7, 0x73, 0x9D, 0xA7,
+    0x74, 0xE7, 0x75, 0xE7, 0x75, 0xFA, 0x99, 0x77, 0x1A, 0xFD, 0x77, 0x29, 0xEA, 0x20, 0x59, 0x99,
+    0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD,
+    0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA,
+    0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F,
+    0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD1, 0x9F, 0x59, 0x99, 0x4D, 0xA7, 0x5D, 0xA7, 0x5A,
+    0xD7, 0x6E, 0x76, 0xAE, 0x99, 0x97, 0x3F, 0xD7, 0x4A, 0xE9, 0x00, 0x77, 0x77, 0xAC, 0xA7, 0x6F,
+    0x74, 0x9F, 0xC7, 0x3F, 0xCA, 0x73, 0xAE, 0x97, 0x69, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xEA, 0x95,
+    0x9F, 0xFE, 0xA4, 0x9F, 0xA9, 0x99, 0xAF, 0x39, 0xEA, 0x6E, 0x3E, 0x97, 0xE2, 0xEA, 0x70, 0xDA,
+    0x19, 0xE7, 0x1A, 0xC9, 0x1A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE9, 0x75, 0x9E, 0x76, 0x9E,
+    0x76, 0x9E, 0x97, 0x59, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xEA, 0x76, 0xFA, 0x75, 0xAF, 0xC9,
+    0x79, 0x92, 0xAF, 0xEA, 0xAA, 0xAE, 0xA3, 0xAF, 0xFF, 0xC6, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x99,
+    0x40, 0x71, 0xA9, 0x73, 0x9D, 0x97, 0x2E, 0xA7, 0x1F, 0x71, 0x9E, 0x72, 0xE7, 0x3D, 0x77, 0x77,
+    0x72, 0x99, 0x99, 0x70, 0xAF, 0xDA, 0x49, 0xFF, 0xD2, 0x9E, 0x91, 0x9F, 0x2E, 0x5E, 0x90, 0xAD,
+    0x95, 0xAD, 0x1E, 0x69, 0x91, 0x9E, 0x72, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x72,
+    0x9E, 0x97, 0x2F, 0x72, 0xFA, 0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0xA1, 0x9F, 0xFE, 0x93, 0xAF,
+    0xF9, 0x69, 0x99, 0x99, 0x30, 0x77, 0x74, 0xE7, 0x6F, 0xC9, 0x73, 0xEA, 0xE9, 0x71, 0xE9, 0x09,
+    0xE7, 0x0A, 0xDA, 0x29, 0xDA, 0x7A, 0xC9, 0x5C, 0x97, 0x77, 0x77, 0x69, 0xAF, 0xEA, 0x95, 0x9F,
+    0xFE, 0xA4, 0x9F, 0xA9, 0x99, 0xAF, 0x39, 0xEA, 0x6E, 0x3E, 0x97, 0xE2, 0xEA, 0x70, 0xDA, 0x19,
+    0xE7, 0x1A, 0xC9, 0x1A, 0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE9, 0x75, 0x9E, 0x76, 0x9E, 0x76,
+    0x9E, 0x97, 0x59, 0xE9, 0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xEA, 0x76, 0xFA, 0x75, 0xAF, 0xC9, 0x79,
+    0x92, 0xAF, 0xEA, 0xAA, 0xAE, 0xA3, 0xAF, 0xFF, 0xC6, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x99, 0x40,
+    0x79, 0x73, 0x9E, 0x72, 0xFC, 0x70, 0xAF, 0xD6, 0x9D, 0xA0, 0xAD, 0xA5, 0xE2, 0xE4, 0xAD, 0x4D,
+    0x93, 0x9A, 0x69, 0x77, 0x79, 0x99, 0x97, 0x0A, 0xFD, 0xA4, 0x9F, 0xFD, 0x29, 0xE9, 0x19, 0xF2,
+    0xE5, 0xE9, 0x0A, 0xD9, 0x5A, 0xD1, 0xE6, 0x99, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x2A,
+    0xE7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xCA, 0x19,
+    0xFF, 0xE9, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x93, 0x71, 0xAA, 0x97, 0x6F, 0x97, 0x5F, 0x97, 0x5F,
+    0x97, 0x6A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xEA, 0x95, 0x9F, 0xFE, 0xA4, 0x9F, 0xA9,
+    0x99, 0xAF, 0x39, 0xEA, 0x6E, 0x3E, 0x97, 0xE2, 0xEA, 0x70, 0xDA, 0x19, 0xE7, 0x1A, 0xC9, 0x1A,
+    0xE7, 0x6E, 0xA7, 0x6E, 0x97, 0x59, 0xE9, 0x75, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x97, 0x59, 0xE9,
+    0x76, 0xEA, 0x76, 0xF7, 0x6A, 0xEA, 0x76, 0xFA, 0x75, 0xAF, 0xC9, 0x79, 0x92, 0xAF, 0xEA, 0xAA,
+    0xAE, 0xA3, 0xAF, 0xFF, 0xC6, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x99, 0x40, 0x6D, 0xA7, 0x2F, 0x97,
+    0x1F, 0x97, 0x1A, 0xE7, 0x39, 0x97, 0x77, 0x77, 0x29, 0x99, 0x97, 0x0A, 0xFD, 0xA4, 0x9F, 0xFD,
+    0x29, 0xE9, 0x19, 0xF2, 0xE5, 0xE9, 0x0A, 0xD9, 0x5A, 0xD1, 0xE6, 0x99, 0x19, 0xE7, 0x2A, 0xDA,
+    0x72, 0xAD, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFC, 0xA9,
+    0x99, 0x9A, 0xCA, 0x19, 0xFF, 0xE9, 0x3A, 0xFF, 0x96, 0x99, 0x99, 0x93, 0x59, 0x79, 0x7A, 0xD4,
+    0x9E, 0x69, 0xE2, 0x9E, 0x70, 0xAE, 0x99, 0xE7, 0x2A, 0xFD, 0x74, 0xAF, 0x76, 0x9D, 0x97, 0x77,
+    0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x59, 0xFF, 0xEA, 0x49, 0xFA, 0x99, 0x9A, 0xF3, 0x9E, 0xA6, 0xE3,
+    0xE9, 0x7E, 0x2E, 0xA7, 0x0D, 0xA1, 0x9E, 0x71, 0xAC, 0x91, 0xAE, 0x76, 0xEA, 0x76, 0xE9, 0x75,
+    0x9E, 0x97, 0x59, 0xE7, 0x69, 0xE7, 0x69, 0xE9, 0x75, 0x9E, 0x97, 0x6E, 0xA7, 0x6F, 0x76, 0xAE,
+    0xA7, 0x6F, 0xA7, 0x5A, 0xFC, 0x97, 0x99, 0x2A, 0xFE, 0xAA, 0xAA, 0xEA, 0x3A, 0xFF, 0xFC, 0x6A,
+    0xFF, 0xCA, 0x72, 0x99, 0x99, 0x94, 0x29, 0x95, 0x9A, 0x4D, 0x93, 0xAD, 0x93, 0xE9, 0x19, 0xDA,
+    0x5E, 0x1E, 0x69, 0xFD, 0x70, 0x9F, 0x97, 0x1A, 0xDA, 0x77, 0x77, 0x71, 0x99, 0x99, 0x70, 0xAF,
+    0xDA, 0x49, 0xFF, 0xD2, 0x9E, 0x91, 0x9F, 0x2E, 0x5E, 0x90, 0xAD, 0x95, 0xAD, 0x1E, 0x69, 0x91,
+    0x9E, 0x72, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0x9E, 0x97, 0x2F, 0x72, 0xFA,
+    0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0xA1, 0x9F, 0xFE, 0x93, 0xAF, 0xF9, 0x69, 0x99, 0x99, 0x30,
+    0x49, 0x79, 0x73, 0xDA, 0x49, 0xE7, 0x29, 0xE2, 0x9E, 0x74, 0xAE, 0x09, 0xE7, 0x6A, 0xFD, 0x77,
+    0x0A, 0xF7, 0x72, 0x9D, 0x77, 0x77, 0x73, 0x97, 0x49, 0xAF, 0xFF, 0xA9, 0x6A, 0xFF, 0xFF, 0x95,
+    0x99, 0xF1, 0x99, 0xAA, 0xFC, 0xA6, 0xAE, 0x6A, 0xFA, 0x5A, 0xE7, 0x0F, 0x94, 0xAE, 0x71, 0xF4,
+    0xAE, 0x71, 0xAE, 0x93, 0xAE, 0x72, 0xEA, 0x3A, 0xE7, 0x2F, 0x3A, 0xE7, 0x2A, 0xE3, 0xAE, 0x72,
+    0xAE, 0x3A, 0xE7, 0x2A, 0xE3, 0xAE, 0x72, 0xAE, 0x3A, 0xE7, 0x2A, 0xE3, 0xAE, 0x72, 0xEA, 0x3A,
+    0xE7, 0x2E, 0x93, 0xAE, 0x71, 0xAE, 0x4A, 0xE7, 0x1E, 0xA4, 0xAE, 0x70, 0xF5, 0xAE, 0x69, 0xF6,
+    0xAE, 0x99, 0x99, 0x9A, 0xFC, 0x49, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xA9, 0x77, 0x76, 0x74, 0x99,
+    0x92, 0x99, 0x73, 0xAF, 0xC2, 0xAC, 0xA7, 0x19, 0xFD, 0x2E, 0x73, 0x9A, 0xE2, 0xE7, 0x49, 0xE2,
+    0xDA, 0x74, 0x9E, 0x2D, 0x75, 0x9E, 0x19, 0xCA, 0x75, 0x9E, 0x2C, 0x71, 0x99, 0x99, 0x09, 0xE2,
+    0x97, 0xAF, 0xFD, 0x71, 0xAF, 0xFF, 0x70, 0x9E, 0xA9, 0x29, 0xF7, 0x0E, 0x95, 0x9E, 0x7A, 0xDA,
+    0x69, 0xE7, 0xE7, 0x9E, 0x69, 0xE7, 0x9E, 0x6A, 0xE7, 0x9E, 0x6A, 0xE7, 0x9E, 0x6A, 0xE7, 0x9E,
+    0x6A, 0xE7, 0x9E, 0x69, 0xE7, 0x9E, 0x7E, 0xA6, 0x9E, 0x7F, 0x95, 0xF7, 0x9F, 0xA9, 0x09, 0xAF,
+    0xC7, 0x0A, 0xFF, 0xC9, 0xFD, 0x95, 0x9F, 0xE9, 0x0A, 0xFC, 0x70, 0x99, 0x99, 0x49, 0x96, 0x71,
+    0x97, 0x59, 0xAF, 0xFF, 0xA9, 0x7A, 0xFF, 0xFF, 0x96, 0x99, 0xF1, 0x99, 0xAA, 0xFC, 0xA7, 0xAE,
+    0x6A, 0xFA, 0x6A, 0xE7, 0x0F, 0x95, 0xAE, 0x71, 0xF5, 0xAE, 0x71, 0xAE, 0x94, 0xAE, 0x72, 0xEA,
+    0x4A, 0xE7, 0x2F, 0x4A, 0xE7, 0x2A, 0xE1, 0x99, 0x9F, 0x99, 0x99, 0x95, 0xAE, 0x1F, 0xFF, 0x94,
+    0xAE, 0x1A, 0xAA, 0xFA, 0xAA, 0xAA, 0x5A, 0xE4, 0xAE, 0x72, 0xAE, 0x4A, 0xE7, 0x2E, 0xA4, 0xAE,
+    0x72, 0xE9, 0x4A, 0xE7, 0x1A, 0xE5, 0xAE, 0x71, 0xEA, 0x5A, 0xE7, 0x0F, 0x6A, 0xE6, 0x9F, 0x7A,
+    0xE9, 0x99, 0x99, 0xAF, 0xC5, 0x9F, 0xFF, 0xE9, 0x6A, 0xFF, 0xFA, 0x97, 0x77, 0x70, 0x74, 0x99,
+    0x97, 0x5A, 0xFC, 0x74, 0x9F, 0xD7, 0x7A, 0xE7, 0x79, 0xE7, 0x39, 0xAA, 0xAF, 0xAA, 0xA7, 0x0A,
+    0xFF, 0xCA, 0x74, 0xAE, 0x77, 0x9E, 0x71, 0x9A, 0xAC, 0xAA, 0xAE, 0x7A, 0xFF, 0xE6, 0xFF, 0xFC,
+    0x5F, 0x94, 0xAE, 0x49, 0xE6, 0x9E, 0x4E, 0x96, 0x9E, 0x4E, 0x79, 0xE3, 0x9E, 0x79, 0xE3, 0xAE,
+    0x79, 0xE3, 0xAE, 0x79, 0xE3, 0xAE, 0x79, 0xE3, 0x9E, 0x79, 0xE3, 0x9E, 0xA6, 0x9E, 0x4F, 0x6F,
+    0x49, 0xFA, 0x90, 0x9A, 0xFC, 0x5A, 0xFF, 0xC9, 0xFD, 0x92, 0x9F, 0xE9, 0x0A, 0xFC, 0x59, 0x99,
+    0x94, 0x99, 0x30, 0x49, 0x99, 0x99, 0x99, 0x99, 0x70, 0xAF, 0xFC, 0xA7, 0xFF, 0xD9, 0x79, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xAF, 0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A, 0xE7,
+    0x0D, 0xA2, 0xAE, 0x79, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xFC, 0x00, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xD9, 0x3F, 0xFD, 0x77, 0x77, 0x77,
+    0x59, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD,
+    0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A,
+    0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9,
+    0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93, 0x77, 0x69, 0xC6, 0x99, 0x7E, 0x49, 0xCA,
+    0x7F, 0xA9, 0x9A, 0xD9, 0x70, 0xFF, 0xA7, 0x2A, 0xFC, 0x97, 0x69, 0x77, 0x77, 0x76, 0x9F, 0xFF,
+    0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC,
+    0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF,
+    0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71,
+    0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA,
+    0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x77, 0x1D, 0x6C, 0x4E, 0x4D, 0x4F, 0xAA,
+    0xAE, 0x5F, 0xF7, 0x9F, 0x97, 0x77, 0x77, 0x09, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA,
+    0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD,
+    0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F,
+    0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93,
+    0x7A, 0xAA, 0x76, 0xAE, 0xA7, 0x5F, 0xA7, 0x5A, 0xE9, 0x76, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x70,
+    0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A,
+    0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF,
+    0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99,
+    0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x59, 0xDA, 0x72, 0xF7, 0x2F,
+    0x97, 0x1F, 0x73, 0x99, 0x77, 0x77, 0x72, 0x99, 0x97, 0x09, 0xFE, 0x94, 0xFF, 0xD9, 0x2E, 0xA3,
+    0xF1, 0x9D, 0xA5, 0xE9, 0x0E, 0x6A, 0xDA, 0x0E, 0x69, 0xDA, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA,
+    0xAF, 0xFF, 0xCA, 0xAF, 0xFF, 0xC9, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xF9,
+    0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0x91, 0xAF, 0xFE, 0x39, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x30,
+    0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A,
+    0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF,
+    0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99,
+    0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC7, 0x4A, 0xD9, 0x75, 0xE7, 0x69,
+    0xD9, 0x76, 0xAD, 0xA7, 0x6A, 0xEA, 0x99, 0x74, 0xFD, 0x97, 0x4A, 0xE9, 0x10, 0x69, 0x99, 0x70,
+    0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D,
+    0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD,
+    0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3,
+    0x9F, 0xFC, 0x96, 0x99, 0xAE, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xEA, 0x99, 0x70,
+    0xFD, 0x97, 0x09, 0xEA, 0x00, 0x39, 0x79, 0x96, 0x9D, 0x5E, 0x7E, 0x92, 0xE9, 0x79, 0xE9, 0x0E,
+    0x97, 0x19, 0xFD, 0x97, 0x39, 0xF9, 0x76, 0xDA, 0x77, 0x77, 0x75, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF,
+    0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79,
+    0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70,
+    0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F,
+    0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x29, 0x95, 0x9A, 0x4D, 0x93, 0xAD, 0x4E, 0x2A, 0xD9, 0x5E,
+    0x09, 0xDA, 0x69, 0xFD, 0x70, 0xAF, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x19, 0x99, 0x70, 0x9F, 0xE9,
+    0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6, 0x9D, 0xA9, 0xE9,
+    0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72, 0xAD, 0xA7, 0x29,
+    0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF, 0xE3, 0x9F, 0xFC,
+    0x96, 0x99, 0x99, 0x93, 0x77, 0x77, 0x9E, 0x77, 0x1F, 0xC7, 0x7F, 0xE7, 0x5E, 0x90, 0xAE, 0x73,
+    0xE9, 0x29, 0xDA, 0x72, 0xAC, 0x94, 0x9C, 0x97, 0x77, 0x76, 0x97, 0x7A, 0xFF, 0xCA, 0x70, 0xAF,
+    0xFF, 0xA6, 0xFC, 0xA9, 0x99, 0x9A, 0xEA, 0x49, 0xF9, 0x69, 0xDA, 0x4E, 0xA7, 0x1D, 0xA3, 0xAE,
+    0x72, 0xDA, 0x3E, 0x97, 0x2A, 0xC3, 0xAE, 0x77, 0x1E, 0xA7, 0x71, 0xE9, 0x77, 0x09, 0xE9, 0x77,
+    0x09, 0xE7, 0x71, 0x9E, 0x7A, 0xFF, 0x99, 0xE9, 0x6A, 0xFF, 0x99, 0xE9, 0x79, 0xAA, 0xFA, 0x1E,
+    0xA7, 0x3E, 0x91, 0xF7, 0x3E, 0x91, 0xAE, 0xA7, 0x2E, 0x92, 0xF9, 0x71, 0xE9, 0x2A, 0xFA, 0x70,
+    0xE9, 0x3A, 0xFD, 0xA9, 0x99, 0x9A, 0xF9, 0x4A, 0xFF, 0xFE, 0x7A, 0xFF, 0xEA, 0x73, 0x99, 0x99,
+    0x99, 0x60, 0x70, 0x97, 0x79, 0xE7, 0x6F, 0xC7, 0x4A, 0xFD, 0x72, 0x9D, 0xA0, 0xAD, 0x97, 0x1E,
+    0x2E, 0x70, 0xAD, 0x4D, 0x97, 0x9A, 0x59, 0x97, 0x77, 0x69, 0x99, 0x94, 0x99, 0x5A, 0xFF, 0xFA,
+    0x3F, 0xFF, 0xDA, 0x2E, 0xA3, 0xAE, 0x1A, 0x92, 0xE5, 0xAD, 0xA4, 0x9D, 0xA5, 0x9E, 0x4A, 0xDA,
+    0x6E, 0x4A, 0xDA, 0x59, 0xE4, 0x9E, 0x5A, 0xDA, 0x5F, 0x92, 0xAE, 0x7F, 0xFD, 0x96, 0x9F, 0xFA,
+    0x70, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xDA, 0x76, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xFD,
+    0x4A, 0xFF, 0xFC, 0xA2, 0xE9, 0x69, 0xAE, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2E, 0x1E, 0x71, 0xAD,
+    0x91, 0xF6, 0x9E, 0xA2, 0x9F, 0xDA, 0xAF, 0xCA, 0x49, 0xFF, 0xDA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9,
+    0x60, 0x77, 0x74, 0xAA, 0x6A, 0x72, 0x9D, 0x94, 0xAC, 0x97, 0x2F, 0x99, 0x9E, 0x73, 0xAF, 0xF9,
+    0x74, 0x9F, 0xCA, 0x77, 0x19, 0x97, 0x77, 0x77, 0x39, 0x77, 0xAF, 0xFC, 0xA7, 0x0A, 0xFF, 0xFA,
+    0x6F, 0xCA, 0x99, 0x99, 0xAE, 0xA4, 0x9F, 0x96, 0x9D, 0xA4, 0xEA, 0x71, 0xDA, 0x3A, 0xE7, 0x2D,
+    0xA3, 0xE9, 0x72, 0xAC, 0x3A, 0xE7, 0x71, 0xEA, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x97, 0x70, 0x9E,
+    0x77, 0x19, 0xE7, 0xAF, 0xF9, 0x9E, 0x96, 0xAF, 0xF9, 0x9E, 0x97, 0x9A, 0xAF, 0xA1, 0xEA, 0x73,
+    0xE9, 0x1F, 0x73, 0xE9, 0x1A, 0xEA, 0x72, 0xE9, 0x2F, 0x97, 0x1E, 0x92, 0xAF, 0xA7, 0x0E, 0x93,
+    0xAF, 0xDA, 0x99, 0x99, 0xAF, 0x94, 0xAF, 0xFF, 0xE7, 0xAF, 0xFE, 0xA7, 0x39, 0x99, 0x99, 0x96,
+    0x77, 0x6A, 0xC6, 0xC9, 0x7E, 0x4D, 0x97, 0xAF, 0xAA, 0xE7, 0x1F, 0xF7, 0x39, 0xAE, 0x97, 0x77,
+    0x77, 0x73, 0x99, 0x99, 0x49, 0x95, 0xAF, 0xFF, 0xA3, 0xFF, 0xFD, 0xA2, 0xEA, 0x3A, 0xE1, 0xA9,
+    0x2E, 0x5A, 0xDA, 0x49, 0xDA, 0x59, 0xE4, 0xAD, 0xA6, 0xE4, 0xAD, 0xA5, 0x9E, 0x49, 0xE5, 0xAD,
+    0xA5, 0xF9, 0x2A, 0xE7, 0xFF, 0xD9, 0x69, 0xFF, 0xA7, 0x0D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0xA7,
+    0x6A, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xD4, 0xAF, 0xFF, 0xCA, 0x2E, 0x96, 0x9A, 0xE1,
+    0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xE1, 0xE7, 0x1A, 0xD9, 0x1F, 0x69, 0xEA, 0x29, 0xFD, 0xAA, 0xFC,
+    0xA4, 0x9F, 0xFD, 0xA7, 0x09, 0xAA, 0xAA, 0xAA, 0x96, 0x72, 0xAA, 0x97, 0x71, 0xF7, 0x71, 0xF9,
+    0x77, 0x0F, 0x77, 0x19, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x70, 0x97, 0x7A, 0xFF, 0xCA, 0x70, 0xAF,
+    0xFF, 0xA6, 0xFC, 0xA9, 0x99, 0x9A, 0xEA, 0x49, 0xF9, 0x69, 0xDA, 0x4E, 0xA7, 0x1D, 0xA3, 0xAE,
+    0x72, 0xDA, 0x3E, 0x97, 0x2A, 0xC3, 0xAE, 0x77, 0x1E, 0xA7, 0x71, 0xE9, 0x77, 0x09, 0xE9, 0x77,
+    0x09, 0xE7, 0x71, 0x9E, 0x7A, 0xFF, 0x99, 0xE9, 0x6A, 0xFF, 0x99, 0xE9, 0x79, 0xAA, 0xFA, 0x1E,
+    0xA7, 0x3E, 0x91, 0xF7, 0x3E, 0x91, 0xAE, 0xA7, 0x2E, 0x92, 0xF9, 0x71, 0xE9, 0x2A, 0xFA, 0x70,
+    0xE9, 0x3A, 0xFD, 0xA9, 0x99, 0x9A, 0xF9, 0x4A, 0xFF, 0xFE, 0x7A, 0xFF, 0xEA, 0x73, 0x99, 0x99,
+    0x99, 0x60, 0x7D, 0xA7, 0x6F, 0x97, 0x5F, 0x97, 0x5A, 0xE7, 0x79, 0x97, 0x77, 0x77, 0x75, 0x99,
+    0x99, 0x49, 0x95, 0xAF, 0xFF, 0xA3, 0xFF, 0xFD, 0xA2, 0xEA, 0x3A, 0xE1, 0xA9, 0x2E, 0x5A, 0xDA,
+    0x49, 0xDA, 0x59, 0xE4, 0xAD, 0xA6, 0xE4, 0xAD, 0xA5, 0x9E, 0x49, 0xE5, 0xAD, 0xA5, 0xF9, 0x2A,
+    0xE7, 0xFF, 0xD9, 0x69, 0xFF, 0xA7, 0x0D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0xA7, 0x6A, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x5F, 0xFF, 0xD4, 0xAF, 0xFF, 0xCA, 0x2E, 0x96, 0x9A, 0xE1, 0xAD, 0x97, 0x1E,
+    0x1E, 0x72, 0xE1, 0xE7, 0x1A, 0xD9, 0x1F, 0x69, 0xEA, 0x29, 0xFD, 0xAA, 0xFC, 0xA4, 0x9F, 0xFD,
+    0xA7, 0x09, 0xAA, 0xAA, 0xAA, 0x96, 0x74, 0x97, 0x7A, 0xFF, 0xCA, 0x70, 0xAF, 0xFF, 0xA6, 0xFC,
+    0xA9, 0x99, 0x9A, 0xEA, 0x49, 0xF9, 0x69, 0xDA, 0x4E, 0xA7, 0x1D, 0xA3, 0xAE, 0x72, 0xDA, 0x3E,
+    0x97, 0x2A, 0xC3, 0xAE, 0x77, 0x1E, 0xA7, 0x71, 0xE9, 0x77, 0x09, 0xE9, 0x77, 0x09, 0xE7, 0x71,
+    0x9E, 0x7A, 0xFF, 0x99, 0xE9, 0x6A, 0xFF, 0x99, 0xE9, 0x79, 0xAA, 0xFA, 0x1E, 0xA7, 0x3E, 0x91,
+    0xF7, 0x3E, 0x91, 0xAE, 0xA7, 0x2E, 0x92, 0xF9, 0x71, 0xE9, 0x2A, 0xFA, 0x70, 0xE9, 0x3A, 0xFD,
+    0xA9, 0x99, 0x9A, 0xF9, 0x4A, 0xFF, 0xFE, 0x7A, 0xFF, 0xEA, 0x73, 0x99, 0x99, 0x99, 0x77, 0x29,
+    0x77, 0x3E, 0x97, 0x71, 0xF7, 0x71, 0x9E, 0x77, 0x19, 0xDA, 0x77, 0x1E, 0x77, 0x19, 0xD9, 0x77,
+    0x19, 0xA7, 0x10, 0x70, 0x9A, 0x77, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xE7, 0x69,
+    0xE9, 0x76, 0xF7, 0x69, 0xDA, 0x77, 0x77, 0x19, 0x99, 0x94, 0x99, 0x5A, 0xFF, 0xFA, 0x3F, 0xFF,
+    0xDA, 0x2E, 0xA3, 0xAE, 0x1A, 0x92, 0xE5, 0xAD, 0xA4, 0x9D, 0xA5, 0x9E, 0x4A, 0xDA, 0x6E, 0x4A,
+    0xDA, 0x59, 0xE4, 0x9E, 0x5A, 0xDA, 0x5F, 0x92, 0xAE, 0x7F, 0xFD, 0x96, 0x9F, 0xFA, 0x70, 0xDA,
+    0x76, 0x9D, 0x97, 0x6A, 0xDA, 0x76, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xFD, 0x4A, 0xFF,
+    0xFC, 0xA2, 0xE9, 0x69, 0xAE, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2E, 0x1E, 0x71, 0xAD, 0x91, 0xF6,
+    0x9E, 0xA2, 0x9F, 0xDA, 0xAF, 0xCA, 0x49, 0xFF, 0xDA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9, 0x60, 0x77,
+    0x77, 0x4A, 0xDA, 0x77, 0x49, 0xFC, 0x77, 0x29, 0xFE, 0x77, 0x09, 0xE1, 0xAD, 0xA7, 0x7E, 0x3A,
+    0xD9, 0x75, 0x9C, 0xA5, 0xAA, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xFA, 0x5F, 0xFC, 0x0A, 0xFF, 0x94,
+    0x9F, 0xFA, 0x19, 0x9F, 0x97, 0x09, 0xAE, 0x95, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE,
+    0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E,
+    0x6A, 0xFF, 0xFF, 0xD6, 0xAF, 0xFF, 0xFD, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x6A,
+    0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29,
+    0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x97, 0x1A, 0xE9, 0x29, 0xFF, 0xC5, 0xAF,
+    0xF0, 0xAF, 0xFC, 0x49, 0xFF, 0xC0, 0x49, 0x99, 0x77, 0x2F, 0x97, 0x70, 0x9F, 0xC9, 0x77, 0xE9,
+    0xE7, 0x6E, 0x19, 0xE7, 0x4E, 0x39, 0xD7, 0x49, 0x95, 0x97, 0x77, 0x77, 0x09, 0x99, 0x77, 0x0A,
+    0xFC, 0x77, 0x9F, 0xD7, 0x71, 0x9A, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29,
+    0xE7, 0x72, 0x9E, 0x39, 0x99, 0x97, 0x29, 0xE1, 0xAF, 0xD9, 0x70, 0x9E, 0x9F, 0xFC, 0x70, 0x9F,
+    0xD9, 0x99, 0xFA, 0x79, 0xF9, 0x4F, 0x79, 0xE6, 0x9E, 0x79, 0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x69,
+    0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x69, 0xE7,
+    0xE9, 0x69, 0xE7, 0xE9, 0x69, 0xE7, 0xE9, 0x49, 0xFE, 0x3A, 0xFE, 0x2F, 0xF3, 0xFF, 0x00, 0x09,
+    0xFF, 0xA5, 0xFF, 0xC1, 0xAF, 0xF9, 0x49, 0xFF, 0xA2, 0x99, 0xF9, 0x70, 0x9A, 0xE9, 0x6A, 0xE7,
+    0x29, 0xE7, 0xAE, 0x72, 0x9E, 0x4F, 0xFF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xFF, 0xCA, 0x3A, 0xE7,
+    0x29, 0xE7, 0xAE, 0x72, 0x9E, 0x7A, 0xE7, 0x29, 0xE7, 0xAF, 0xFF, 0xFD, 0x7A, 0xFF, 0xFF, 0xD7,
+    0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE7, 0xAE, 0x72, 0x9E, 0x7A, 0xE7, 0x29, 0xE7, 0xAE,
+    0x72, 0x9E, 0x7A, 0xE7, 0x29, 0xE7, 0xAE, 0x72, 0x9E, 0x7A, 0xE7, 0x29, 0xE7, 0xAE, 0x72, 0x9E,
+    0x7A, 0xE9, 0x71, 0xAE, 0x93, 0x9F, 0xFC, 0x5A, 0xFF, 0x1A, 0xFF, 0xC4, 0x9F, 0xFC, 0x00, 0x39,
+    0x99, 0x77, 0xAF, 0xC7, 0x69, 0xFD, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0xAA, 0xFA, 0xAA, 0xA7,
+    0x3F, 0xFD, 0x75, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x29, 0xAD, 0xA9, 0x70, 0x9E, 0x0A, 0xFE,
+    0xA7, 0x9F, 0xFF, 0xC9, 0x69, 0xFC, 0x92, 0xAF, 0x69, 0xEA, 0x5A, 0xE6, 0x9E, 0x7E, 0x69, 0xE7,
+    0xE9, 0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9,
+    0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9, 0x59, 0xE7, 0xE9, 0x39, 0xFE, 0x3A, 0xFE, 0x1F, 0xF3, 0xFF,
+    0x00, 0x1A, 0xDA, 0x2A, 0xA1, 0xAF, 0xC1, 0xD9, 0x0F, 0xFD, 0x90, 0xD9, 0x09, 0xFC, 0x19, 0xC2,
+    0x9E, 0x97, 0x77, 0x75, 0x9F, 0xFC, 0x1A, 0xFF, 0xA2, 0x99, 0xF9, 0x6A, 0xE7, 0xAE, 0x7A, 0xE7,
+    0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE,
+    0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x93, 0x9F, 0xFC, 0x1A, 0xFF, 0xC0, 0x29, 0x7F, 0x91, 0xAC,
+    0x0A, 0xFC, 0x90, 0xDA, 0xE9, 0xFD, 0x9A, 0xC9, 0x1F, 0xC1, 0x93, 0x9A, 0x97, 0x77, 0x73, 0x9A,
+    0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9,
+    0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC0, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xFD, 0x90, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x59, 0xFF, 0xC1,
+    0xAF, 0xFA, 0x29, 0x9F, 0x96, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A,
+    0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE9,
+    0x39, 0xFF, 0xC1, 0xAF, 0xFC, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x9A, 0xFF, 0xCA, 0xFF, 0xD9,
+    0x77, 0x77, 0x74, 0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC0,
+    0x74, 0x9A, 0x6A, 0x90, 0xDA, 0x49, 0xC9, 0x0F, 0x99, 0x9A, 0xD1, 0x9F, 0xFA, 0x3A, 0xFC, 0x97,
+    0x97, 0x77, 0x59, 0xFF, 0xC1, 0xAF, 0xFA, 0x29, 0x9F, 0x96, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7,
+    0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE, 0x7A, 0xE7, 0xAE,
+    0x7A, 0xE7, 0xAE, 0x7A, 0xE9, 0x39, 0xFF, 0xC1, 0xAF, 0xFC, 0x00, 0x72, 0xAC, 0x95, 0xC9, 0xE9,
+    0x3A, 0xC9, 0xAF, 0xAA, 0xE1, 0xFF, 0x92, 0x9A, 0xEA, 0x77, 0x77, 0x49, 0xAF, 0x93, 0xFD, 0x93,
+    0x9A, 0xF9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x39, 0xFF, 0x1F, 0xFC, 0x00, 0x9F, 0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9,
+    0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF,
+    0xC4, 0xDA, 0x59, 0xD9, 0x6E, 0x7E, 0x7F, 0xA9, 0x93, 0xAF, 0xD4, 0x9A, 0xDA, 0x20, 0x49, 0x79,
+    0xE9, 0x5F, 0xA5, 0xFA, 0x59, 0xE7, 0x77, 0x77, 0x70, 0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9,
+    0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC5, 0xAD, 0xA5, 0xAD, 0x7D, 0xA6, 0x9D, 0xA6, 0x9E, 0xA9, 0x94,
+    0xFD, 0x94, 0x9E, 0xA0, 0x3A, 0xA9, 0x6F, 0x95, 0xF9, 0x5F, 0x96, 0xAA, 0x97, 0x77, 0x74, 0x9F,
+    0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6,
+    0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x73, 0x9A, 0xF9, 0x3F, 0xD9, 0x39, 0xAF, 0x96, 0xE9,
+    0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E,
+    0x93, 0x9F, 0xF1, 0xFF, 0xC0, 0x9F, 0xFC, 0x1F, 0xFD, 0xAF, 0xFA, 0x1F, 0xFC, 0xA0, 0x99, 0xF9,
+    0x49, 0x9F, 0x94, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE,
+    0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E,
+    0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5,
+    0xAE, 0x7E, 0xA5, 0xAE, 0x7E, 0xA5, 0xAE, 0x96, 0xEA, 0x29, 0xFF, 0xC4, 0xEA, 0x2A, 0xFF, 0xC4,
+    0xE9, 0x77, 0x1E, 0x77, 0x1A, 0xE7, 0x71, 0xE9, 0x77, 0x0F, 0x77, 0xAF, 0x76, 0x9F, 0xC7, 0x70,
+    0xAA, 0xA9, 0x70, 0x49, 0x70, 0x94, 0x9E, 0x94, 0x9E, 0x92, 0xFA, 0x4F, 0xA2, 0xFA, 0x4F, 0xA2,
+    0x9E, 0x59, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0x93, 0xAF, 0x90, 0xFD, 0x92, 0xFD, 0x90,
+    0x9A, 0xF9, 0x29, 0xAF, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E,
+    0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93,
+    0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x93, 0xE9, 0x5E, 0x90, 0x9F, 0xF3, 0xE9, 0x0F, 0xFC, 0x3E, 0x97,
+    0x5E, 0x76, 0xE7, 0x59, 0xE7, 0x5E, 0xA7, 0x4F, 0x73, 0xAF, 0x73, 0xFC, 0x74, 0x9A, 0xA9, 0x40,
+    0x77, 0x39, 0xE7, 0x1F, 0xC7, 0xEA, 0xE5, 0xE9, 0x09, 0xE3, 0xE9, 0x29, 0xDA, 0x2A, 0xC9, 0x49,
+    0xC9, 0x77, 0x76, 0xAF, 0xFC, 0x3F, 0xFC, 0xA4, 0x99, 0xF9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xAE,
+    0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE,
+    0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE,
+    0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xEA, 0x70, 0xF7, 0xAF, 0x96, 0xFC, 0x97, 0x9A, 0xA9,
+    0x70, 0x69, 0x71, 0xF7, 0x9F, 0xA6, 0xFD, 0x94, 0xAD, 0x90, 0xE3, 0x9D, 0xA1, 0x9D, 0xA2, 0xDA,
+    0x39, 0xD2, 0x99, 0x59, 0x77, 0x76, 0x9A, 0xEA, 0x5A, 0xFC, 0xA6, 0x9A, 0xEA, 0x70, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x70, 0xAD, 0xA7, 0x0E, 0xA7, 0x0E, 0x97, 0xAE, 0x7A, 0xE9, 0x59, 0xFA, 0x5A, 0xF9, 0x7A, 0xA9,
+    0x70, 0x9F, 0xFC, 0x29, 0xFF, 0x0A, 0xFF, 0xA2, 0x9F, 0xEA, 0x19, 0x9F, 0x96, 0x9E, 0xA5, 0xAE,
+    0x69, 0xEA, 0x6A, 0xE5, 0x9E, 0x97, 0xAE, 0x4A, 0xE9, 0x70, 0xAE, 0x3A, 0xE7, 0x2A, 0xE2, 0xAE,
+    0x73, 0xAE, 0x1A, 0xE7, 0x4A, 0xE0, 0xEA, 0x75, 0xAF, 0xDA, 0x76, 0xAF, 0xDA, 0x76, 0xAE, 0xAE,
+    0xA7, 0x5A, 0xE0, 0xFA, 0x74, 0xAE, 0x1F, 0xA7, 0x3A, 0xE2, 0xFA, 0x72, 0xAE, 0x3F, 0xA7, 0x1A,
+    0xE4, 0xFA, 0x70, 0xAE, 0x5F, 0xA7, 0xAE, 0x6F, 0xC6, 0xAE, 0x96, 0xFC, 0x91, 0x9F, 0xFC, 0x5F,
+    0xD9, 0xAF, 0xFC, 0x6A, 0xFA, 0x77, 0x19, 0xAA, 0x97, 0x77, 0x71, 0xEA, 0x77, 0x2A, 0xE7, 0x73,
+    0xE7, 0x73, 0xE7, 0x72, 0x9D, 0x97, 0x72, 0xDA, 0x77, 0x3A, 0x97, 0x20, 0x39, 0x99, 0x75, 0xAF,
+    0xC7, 0x49, 0xFD, 0x76, 0x9A, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7, 0x79, 0xE7,
+    0x79, 0xE2, 0x9F, 0xF3, 0x9E, 0x29, 0xFF, 0x39, 0xE4, 0xAE, 0xA5, 0x9E, 0x3A, 0xE7, 0x9E, 0x2A,
+    0xE7, 0x09, 0xE1, 0xEA, 0x71, 0x9E, 0x0E, 0x97, 0x29, 0xFE, 0x73, 0x9E, 0x9E, 0x97, 0x29, 0xE0,
+    0xAE, 0x97, 0x19, 0xE1, 0xF7, 0x19, 0xE2, 0xF7, 0x09, 0xE3, 0xF7, 0x9E, 0x39, 0xF9, 0x59, 0xE4,
+    0x9F, 0xA2, 0x9F, 0xE3, 0x9F, 0xA1, 0xFF, 0x49, 0xFA, 0x77, 0x99, 0x97, 0x77, 0x5E, 0xA7, 0x7A,
+    0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x79, 0xD9, 0x77, 0xDA, 0x77, 0x0A, 0x97, 0x00, 0x77, 0x59, 0xAF,
+    0x3F, 0xF9, 0x1F, 0xD3, 0xFF, 0x29, 0xAF, 0x5E, 0xA9, 0x6E, 0x4E, 0xA7, 0x0E, 0x3E, 0x97, 0x1E,
+    0x2E, 0x97, 0x2E, 0x09, 0xE9, 0x73, 0xEA, 0xE9, 0x74, 0xFE, 0x97, 0x4E, 0x0A, 0xE9, 0x73, 0xE1,
+    0xF9, 0x72, 0xE2, 0xF9, 0x71, 0xE2, 0x9F, 0x97, 0x0E, 0x39, 0xF9, 0x7E, 0x93, 0x9F, 0xA3, 0x9A,
+    0xFD, 0x92, 0x9F, 0xC2, 0xFF, 0xA4, 0xFC, 0x77, 0x09, 0x99, 0x10, 0x79, 0x77, 0x0A, 0xCA, 0x76,
+    0xF7, 0x4A, 0xFA, 0x73, 0xFC, 0xA7, 0x3A, 0xE9, 0x75, 0x99, 0x77, 0x77, 0x77, 0x49, 0xFF, 0xC7,
+    0x0A, 0xFF, 0xA7, 0x19, 0x9F, 0x97, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7,
+    0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7,
+    0x6A, 0xE7, 0x09, 0xC9, 0x2A, 0xE7, 0x0D, 0xA2, 0xAE, 0x70, 0xD9, 0x2A, 0xE7, 0xAD, 0x92, 0xAE,
+    0x99, 0x9A, 0xAA, 0xAA, 0xE0, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xA0, 0x77, 0x1A, 0xC6, 0xAE,
+    0x93, 0xAF, 0xC9, 0x19, 0xFD, 0x92, 0xAD, 0xA9, 0x77, 0x76, 0x99, 0x94, 0xAF, 0xC3, 0x9F, 0xD5,
+    0x9A, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE9,
+    0x3A, 0xFF, 0x09, 0xFF, 0xC0, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x71, 0x99, 0xF9, 0x75, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x70, 0x9C, 0x92, 0xAE, 0x70, 0xDA, 0x2A,
+    0xE7, 0x0D, 0x92, 0xAE, 0x7A, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x09, 0xFF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0xFA, 0x77, 0x73, 0x97, 0x70, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0xAD,
+    0x97, 0x6D, 0xA7, 0x7A, 0x97, 0x10, 0x39, 0x99, 0x4A, 0xFC, 0x39, 0xFD, 0x59, 0xAE, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x93, 0xAF, 0xF0, 0x9F,
+    0xFC, 0x77, 0x09, 0x79, 0xE7, 0xE9, 0x6A, 0xDA, 0x6A, 0xD9, 0x6D, 0xA6, 0xE7, 0xA9, 0x50, 0x74,
+    0x99, 0x77, 0x0D, 0xA7, 0x7E, 0x29, 0xFF, 0xC2, 0xE2, 0xAF, 0xFA, 0x2D, 0x93, 0x99, 0xF9, 0x39,
+    0xD6, 0xAE, 0x49, 0xCA, 0x6A, 0xE4, 0x9C, 0x7A, 0xE5, 0x97, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x70,
+    0x9C, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x0D, 0x92, 0xAE, 0x7A, 0xD9, 0x2A, 0xE9, 0x99, 0xAA,
+    0xAA, 0xAE, 0x09, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFA, 0x00, 0x39, 0x99, 0x39, 0x2A, 0xFC, 0x2A,
+    0xD0, 0x9F, 0xD2, 0xAD, 0x29, 0xAE, 0x2E, 0x39, 0xE2, 0xDA, 0x39, 0xE2, 0xD9, 0x39, 0xE2, 0xD4,
+    0x9E, 0x2C, 0x94, 0x9E, 0x29, 0x59, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19,
+    0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19,
+    0xE7, 0x19, 0xE9, 0x6A, 0xFF, 0x39, 0xFF, 0xC3, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x71, 0x99, 0xF9,
+    0x75, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x69, 0x95, 0xAE, 0x5F, 0x4A, 0xE4,
+    0x9F, 0x4A, 0xE4, 0x9F, 0x4A, 0xE5, 0xAD, 0x94, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x70, 0x9C, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x0D, 0x92, 0xAE, 0x7A, 0xD9, 0x2A, 0xE9,
+    0x99, 0xAA, 0xAA, 0xAE, 0x09, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFA, 0x00, 0x39, 0x99, 0x71, 0xAF,
+    0xC7, 0x09, 0xFD, 0x72, 0x9A, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE5, 0x94, 0x9E, 0x3A, 0xE3, 0x9E, 0x3F, 0x39, 0xE3, 0xF3, 0x9E,
+    0x39, 0xD9, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE9, 0x70, 0xAF, 0xF5, 0x9F, 0xFC, 0x50, 0x19, 0xFF, 0xC7, 0x2A, 0xFF, 0xA7, 0x39, 0x9F,
+    0x97, 0x7A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE3, 0x97, 0x3A, 0xE1,
+    0xAD, 0x73, 0xAE, 0xAE, 0xA7, 0x3A, 0xFC, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xD7, 0x4F, 0xF7, 0x4A,
+    0xC9, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x09, 0xC9, 0x4A, 0xE7, 0x0D, 0xA4, 0xAE, 0x70,
+    0xD9, 0x4A, 0xE7, 0xAD, 0x94, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE2, 0x9F, 0xFF, 0xFC, 0x2A, 0xFF,
+    0xFF, 0xA0, 0x49, 0x99, 0x6A, 0xFC, 0x59, 0xFD, 0x79, 0xAE, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E,
+    0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x1A, 0x94, 0x9E, 0x0E, 0x49, 0xFD, 0x59, 0xFA, 0x69, 0xE9,
+    0x6A, 0xF6, 0xFD, 0x5E, 0x9E, 0x5A, 0xA0, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E,
+    0x70, 0x9E, 0x70, 0x9E, 0x95, 0xAF, 0xF2, 0x9F, 0xFC, 0x10, 0x76, 0x97, 0x77, 0xAC, 0x97, 0x74,
+    0x9E, 0xA7, 0x73, 0xAF, 0xA7, 0x72, 0xFC, 0x97, 0x72, 0xEA, 0x97, 0x74, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0xFD, 0x70, 0xFF, 0xC0, 0x9F, 0xDA, 0x7F, 0xFA, 0x29, 0xFC, 0x97, 0x99, 0xE9, 0x5A,
+    0xFC, 0x71, 0xAD, 0x6A, 0xFC, 0xA7, 0x0A, 0xD6, 0xAD, 0xAE, 0x97, 0xAD, 0x6A, 0xD0, 0xAE, 0x7A,
+    0xD6, 0xAD, 0x1F, 0x6A, 0xD6, 0xAD, 0x19, 0xE9, 0x5A, 0xD6, 0xAD, 0x2A, 0xE5, 0xAD, 0x6A, 0xD3,
+    0xF4, 0xAD, 0x6A, 0xD3, 0x9E, 0xA3, 0xAD, 0x6A, 0xD4, 0xAE, 0x92, 0xAD, 0x6A, 0xD5, 0xF2, 0xAD,
+    0x6A, 0xD6, 0xEA, 0x1A, 0xD6, 0xAD, 0x69, 0xE9, 0x0A, 0xD6, 0xAD, 0x7F, 0x0A, 0xD6, 0xAD, 0x70,
+    0xEA, 0xAD, 0x6A, 0xD7, 0x09, 0xFD, 0x6A, 0xD7, 0x1A, 0xFC, 0x6A, 0xD9, 0x71, 0xFC, 0x39, 0xFF,
+    0x96, 0x9F, 0x3A, 0xFF, 0x97, 0xAE, 0x77, 0x69, 0x50, 0x74, 0xA9, 0x77, 0x29, 0xDA, 0x77, 0x1E,
+    0xA7, 0x70, 0xF7, 0x70, 0x9E, 0x77, 0x1E, 0x77, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99, 0x97,
+    0x0A, 0xEA, 0x1A, 0xFD, 0xA5, 0xFD, 0x0F, 0xFC, 0xA4, 0xAA, 0xFE, 0xA9, 0x9A, 0xF7, 0xFA, 0x49,
+    0xE9, 0x6E, 0x96, 0xEA, 0x6E, 0x96, 0xEA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96,
+    0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6,
+    0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA3, 0x9F, 0xEA, 0x29, 0xFE, 0x90, 0xFF, 0xA2, 0xFF, 0x90,
+    0x9F, 0xD7, 0x0F, 0xFC, 0x09, 0xFD, 0xA7, 0xFF, 0xA2, 0x9F, 0xC9, 0x79, 0x9E, 0x95, 0xAF, 0xC7,
+    0x1A, 0xD6, 0xAF, 0xCA, 0x70, 0xAD, 0x6A, 0xDA, 0xE9, 0x7A, 0xD6, 0xAD, 0x0A, 0xE7, 0xAD, 0x6A,
+    0xD1, 0xF6, 0xAD, 0x6A, 0xD1, 0x9E, 0x95, 0xAD, 0x6A, 0xD2, 0xAE, 0x5A, 0xD6, 0xAD, 0x3F, 0x4A,
+    0xD6, 0xAD, 0x39, 0xEA, 0x3A, 0xD6, 0xAD, 0x4A, 0xE9, 0x2A, 0xD6, 0xAD, 0x5F, 0x2A, 0xD6, 0xAD,
+    0x6E, 0xA1, 0xAD, 0x6A, 0xD6, 0x9E, 0x90, 0xAD, 0x6A, 0xD7, 0xF0, 0xAD, 0x6A, 0xD7, 0x0E, 0xAA,
+    0xD6, 0xAD, 0x70, 0x9F, 0xD6, 0xAD, 0x71, 0xAF, 0xC6, 0xAD, 0x97, 0x1F, 0xC3, 0x9F, 0xF9, 0x69,
+    0xF3, 0xAF, 0xF9, 0x7A, 0xE7, 0x76, 0x97, 0x71, 0x97, 0x77, 0xE9, 0x77, 0x5F, 0x77, 0x59, 0xE7,
+    0x75, 0x9D, 0xA7, 0x75, 0xAD, 0x77, 0x59, 0xD9, 0x77, 0x59, 0xA7, 0x50, 0x72, 0x99, 0x99, 0x70,
+    0xAE, 0xA1, 0xAF, 0xDA, 0x5F, 0xD0, 0xFF, 0xCA, 0x4A, 0xAF, 0xEA, 0x99, 0xAF, 0x7F, 0xA4, 0x9E,
+    0x96, 0xE9, 0x6E, 0xA6, 0xE9, 0x6E, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A,
+    0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E,
+    0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x39, 0xFE, 0xA2, 0x9F, 0xE9, 0x0F, 0xFA, 0x2F, 0xF9, 0x77,
+    0x77, 0x09, 0x77, 0x2A, 0xE7, 0x71, 0x9E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x77, 0x2D, 0xA7, 0x71,
+    0xDA, 0x77, 0x2A, 0x97, 0x20, 0x69, 0x79, 0x76, 0xDA, 0x49, 0xDA, 0x75, 0xAE, 0x2A, 0xE7, 0x7A,
+    0xE0, 0xAE, 0x77, 0x1A, 0xFD, 0x77, 0x3A, 0xF7, 0x75, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x09, 0xFD,
+    0x70, 0xFF, 0xC0, 0x9F, 0xDA, 0x7F, 0xFA, 0x29, 0xFC, 0x97, 0x99, 0xE9, 0x5A, 0xFC, 0x71, 0xAD,
+    0x6A, 0xFC, 0xA7, 0x0A, 0xD6, 0xAD, 0xAE, 0x97, 0xAD, 0x6A, 0xD0, 0xAE, 0x7A, 0xD6, 0xAD, 0x1F,
+    0x6A, 0xD6, 0xAD, 0x19, 0xE9, 0x5A, 0xD6, 0xAD, 0x2A, 0xE5, 0xAD, 0x6A, 0xD3, 0xF4, 0xAD, 0x6A,
+    0xD3, 0x9E, 0xA3, 0xAD, 0x6A, 0xD4, 0xAE, 0x92, 0xAD, 0x6A, 0xD5, 0xF2, 0xAD, 0x6A, 0xD6, 0xEA,
+    0x1A, 0xD6, 0xAD, 0x69, 0xE9, 0x0A, 0xD6, 0xAD, 0x7F, 0x0A, 0xD6, 0xAD, 0x70, 0xEA, 0xAD, 0x6A,
+    0xD7, 0x09, 0xFD, 0x6A, 0xD7, 0x1A, 0xFC, 0x6A, 0xD9, 0x71, 0xFC, 0x39, 0xFF, 0x96, 0x9F, 0x3A,
+    0xFF, 0x97, 0xAE, 0x77, 0x69, 0x50, 0x59, 0x95, 0x9A, 0x73, 0xD9, 0x3A, 0xD9, 0x72, 0xAD, 0x91,
+    0x9D, 0xA7, 0x4E, 0x1E, 0x75, 0x9F, 0xD7, 0x79, 0xF9, 0x77, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x77,
+    0x99, 0x99, 0x70, 0xAE, 0xA1, 0xAF, 0xDA, 0x5F, 0xD0, 0xFF, 0xCA, 0x4A, 0xAF, 0xEA, 0x99, 0xAF,
+    0x7F, 0xA4, 0x9E, 0x96, 0xE9, 0x6E, 0xA6, 0xE9, 0x6E, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD,
+    0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9,
+    0x6A, 0xDA, 0x6E, 0x96, 0xAD, 0xA6, 0xE9, 0x6A, 0xDA, 0x39, 0xFE, 0xA2, 0x9F, 0xE9, 0x0F, 0xFA,
+    0x2F, 0xF9, 0x19, 0x97, 0x77, 0x1E, 0xA7, 0x77, 0x0F, 0x77, 0x70, 0x9E, 0x77, 0x71, 0xE7, 0x77,
+    0x1E, 0x77, 0x70, 0x9D, 0x97, 0x77, 0x0A, 0xD7, 0x59, 0x99, 0x97, 0xD9, 0x4A, 0xE9, 0x1A, 0xFD,
+    0x94, 0xAC, 0xA3, 0x9F, 0xCA, 0x9F, 0xFC, 0x94, 0x95, 0xAF, 0xF9, 0x99, 0xFC, 0x75, 0x9F, 0x94,
+    0xAE, 0x75, 0x9E, 0x7E, 0x75, 0x9E, 0x7E, 0x97, 0x49, 0xE7, 0xE9, 0x74, 0x9E, 0x7E, 0x97, 0x49,
+    0xE7, 0xE9, 0x74, 0x9E, 0x7E, 0x97, 0x49, 0xE7, 0xE9, 0x74, 0x9E, 0x7E, 0x97, 0x49, 0xE7, 0xE9,
+    0x74, 0x9E, 0x7E, 0x97, 0x49, 0xE9, 0x6E, 0xA7, 0x29, 0xFE, 0x92, 0xAF, 0xE7, 0x0F, 0xF9, 0x2F,
+    0xF0, 0x9F, 0xD7, 0x0F, 0xFC, 0x09, 0xFD, 0xA7, 0xFF, 0xA2, 0x9F, 0xC7, 0x09, 0x9E, 0x95, 0xAF,
+    0xC7, 0x1A, 0xD6, 0xAF, 0xCA, 0x70, 0xAD, 0x6A, 0xDA, 0xE7, 0x0A, 0xD6, 0xAD, 0x0F, 0x7A, 0xD6,
+    0xAD, 0x1E, 0xA6, 0xAD, 0x6A, 0xD1, 0x9E, 0x95, 0xAD, 0x6A, 0xD2, 0xAE, 0x5A, 0xD6, 0xAD, 0x3E,
+    0xA4, 0xAD, 0x6A, 0xD3, 0x9E, 0x93, 0xAD, 0x6A, 0xD4, 0xAE, 0x3A, 0xD6, 0xAD, 0x5E, 0xA2, 0xAD,
+    0x6A, 0xD6, 0xE9, 0x1A, 0xD6, 0xAD, 0x69, 0xE1, 0xAD, 0x6A, 0xD7, 0xEA, 0x0A, 0xD6, 0xAD, 0x70,
+    0xE9, 0xAD, 0x6A, 0xD7, 0x09, 0xFD, 0x6A, 0xD7, 0x1A, 0xFC, 0x6A, 0xD9, 0x71, 0xFC, 0x39, 0xFF,
+    0x96, 0x9F, 0x3A, 0xFF, 0x97, 0xAE, 0x77, 0x6D, 0xA7, 0x70, 0x93, 0x9D, 0x97, 0x79, 0xCA, 0x2E,
+    0x77, 0x0F, 0xAA, 0xDA, 0x77, 0x0F, 0xF7, 0x72, 0xFD, 0x77, 0x49, 0x99, 0x70, 0x72, 0x99, 0x99,
+    0x5A, 0xEA, 0x1A, 0xFD, 0xA2, 0xFD, 0x0F, 0xFC, 0xA1, 0xAA, 0xFE, 0xA9, 0x9A, 0xF4, 0xFA, 0x49,
+    0xE9, 0x3E, 0x96, 0xEA, 0x3E, 0x96, 0xEA, 0x3E, 0x96, 0xAD, 0xA3, 0xE9, 0x6A, 0xDA, 0x3E, 0x96,
+    0xAD, 0xA3, 0xE9, 0x6A, 0xDA, 0x3E, 0x96, 0xAD, 0xA3, 0xE9, 0x6A, 0xDA, 0x3E, 0x96, 0xAD, 0xA3,
+    0xE9, 0x6A, 0xDA, 0x3E, 0x96, 0xAD, 0xA0, 0x9A, 0xFD, 0xA4, 0xAD, 0xA0, 0xFF, 0xA4, 0xAD, 0xA7,
+    0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE7, 0x6A, 0xE7, 0x5A, 0xE7, 0x4A, 0xF9, 0x73, 0xAF, 0x97, 0x5A,
+    0xA9, 0x40, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0x5F, 0xFD, 0x74, 0x9F, 0xFD, 0x75, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF,
+    0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F,
+    0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9,
+    0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7,
+    0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49,
+    0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69,
+    0x9A, 0xAA, 0x97, 0x10, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0x96, 0x9F, 0xFD, 0x69, 0xFF, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x09, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E,
+    0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A,
+    0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F,
+    0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60, 0x77,
+    0x76, 0xA9, 0x6C, 0x74, 0x9D, 0x94, 0xD7, 0x49, 0xEA, 0x99, 0x9E, 0x75, 0xAF, 0xF7, 0x79, 0xFC,
+    0xA7, 0x73, 0x97, 0x77, 0x77, 0x59, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF, 0xFC, 0x70,
+    0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73, 0xF2, 0x9E,
+    0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E, 0x97, 0x5A,
+    0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA, 0x75, 0xEA,
+    0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4, 0x9F, 0x97,
+    0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xAA,
+    0xA9, 0x71, 0x77, 0x5D, 0x59, 0xC6, 0x9D, 0xA3, 0x9D, 0x7F, 0xAA, 0xEA, 0x79, 0xFE, 0xA7, 0x2A,
+    0xEA, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA,
+    0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E,
+    0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9,
+    0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60,
+    0x77, 0x77, 0x29, 0xA5, 0xC7, 0x59, 0xDA, 0x3E, 0x73, 0xAE, 0xA2, 0xF7, 0x2A, 0xEA, 0x19, 0xF7,
+    0x2A, 0xE9, 0x19, 0xEA, 0x72, 0x9D, 0xA3, 0xE9, 0x74, 0xA9, 0x4A, 0x97, 0x77, 0x77, 0x19, 0x99,
+    0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF, 0xFC, 0x70, 0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7,
+    0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73, 0xF2, 0x9E, 0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1,
+    0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97,
+    0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA, 0x75, 0xEA, 0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2,
+    0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4, 0x9F, 0x97, 0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79,
+    0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xAA, 0xA9, 0x71, 0x69, 0x93, 0x97, 0x2D, 0xA2,
+    0xD9, 0x79, 0xE1, 0xAD, 0xA7, 0xE9, 0x1E, 0x79, 0xDA, 0x1A, 0xD9, 0x7E, 0x19, 0xDA, 0x70, 0xD2,
+    0x9C, 0xA7, 0x19, 0x49, 0x77, 0x76, 0x99, 0x99, 0x73, 0xAF, 0xE9, 0x69, 0xFF, 0xE4, 0xAE, 0x92,
+    0x9F, 0xA3, 0xE6, 0xF9, 0x1A, 0xDA, 0x7E, 0xA1, 0xE7, 0x0A, 0xE0, 0x9E, 0x70, 0x9E, 0x0A, 0xE7,
+    0x09, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x70, 0x9E, 0x09, 0xE9, 0x79, 0xE1, 0xEA,
+    0x7E, 0x91, 0xF9, 0x59, 0xE3, 0xFA, 0x3A, 0xE9, 0x39, 0xFF, 0xE9, 0x6F, 0xFA, 0x72, 0x9A, 0xA9,
+    0x96, 0x79, 0xAF, 0xFF, 0xFD, 0xA6, 0xAF, 0xFF, 0xFF, 0xD5, 0xFC, 0xAA, 0x99, 0xAF, 0xAA, 0xAA,
+    0xAA, 0xF3, 0x9F, 0x95, 0xE9, 0x6A, 0xD3, 0xF7, 0xE9, 0x69, 0xD2, 0xF7, 0x0E, 0x97, 0xCA, 0x19,
+    0xE9, 0x70, 0xE9, 0x73, 0xAE, 0x71, 0xE9, 0x73, 0xEA, 0x71, 0xE9, 0x73, 0xE9, 0x71, 0xE9, 0x72,
+    0x9E, 0x97, 0x1F, 0xFF, 0x29, 0xE7, 0x2F, 0xFF, 0x29, 0xE9, 0x71, 0xFA, 0xAA, 0xAA, 0xAA, 0x92,
+    0x9E, 0x97, 0x1E, 0x97, 0x3E, 0xA7, 0x1E, 0x97, 0x3F, 0x71, 0xE9, 0x73, 0xAE, 0x71, 0xE9, 0x70,
+    0xA2, 0xF7, 0x0E, 0x97, 0x9C, 0xA1, 0xAE, 0xA7, 0xE9, 0x7D, 0xA2, 0xFC, 0x6E, 0x97, 0xDA, 0x3F,
+    0xD9, 0x92, 0xEA, 0x99, 0x9A, 0xAA, 0xAE, 0x94, 0xAF, 0xFF, 0xFF, 0xE7, 0xAF, 0xFF, 0xFF, 0xC7,
+    0x39, 0x99, 0x99, 0x75, 0x69, 0x99, 0x97, 0x99, 0x99, 0x70, 0x9F, 0xEA, 0x3A, 0xFD, 0xA5, 0xAF,
+    0xFD, 0x1F, 0xFD, 0x3A, 0xE9, 0x19, 0xAE, 0xAE, 0xA2, 0x9F, 0x19, 0xE5, 0x9F, 0xCA, 0x5E, 0x1E,
+    0x96, 0xAF, 0x6E, 0x90, 0xE7, 0x0F, 0x6A, 0xDA, 0x9E, 0x70, 0xF9, 0x99, 0x99, 0x99, 0xEA, 0xAE,
+    0x70, 0xAF, 0xFF, 0xC9, 0xAE, 0x70, 0xAF, 0xFF, 0xC0, 0xAE, 0x70, 0xAD, 0xA7, 0x2A, 0xE7, 0x0A,
+    0xDA, 0x72, 0x9E, 0x70, 0xF7, 0x3E, 0xA6, 0x9F, 0xA7, 0x2F, 0x6F, 0xD9, 0x71, 0x9F, 0x92, 0x9F,
+    0xFC, 0xA9, 0x99, 0xAA, 0xC2, 0xAF, 0xFD, 0xA0, 0x9F, 0xFE, 0x39, 0xFF, 0x92, 0x9F, 0xFA, 0x69,
+    0x9A, 0xA9, 0x70, 0x99, 0x99, 0x93, 0x73, 0x97, 0x73, 0xD7, 0x71, 0x9E, 0xA7, 0x7F, 0xC9, 0x75,
+    0x9F, 0xC9, 0x76, 0xEA, 0x97, 0x70, 0x99, 0x77, 0x77, 0x73, 0x97, 0x49, 0xAF, 0xFE, 0xA7, 0xAF,
+    0xFF, 0xDA, 0x69, 0x9F, 0x29, 0xAF, 0xA7, 0xAE, 0x5F, 0x7A, 0xE5, 0x9E, 0x96, 0xAE, 0x6E, 0xA6,
+    0xAE, 0x6E, 0xA6, 0xAE, 0x6E, 0x96, 0xAE, 0x59, 0xE7, 0xAE, 0x5E, 0xA7, 0xAE, 0x3A, 0xEA, 0x70,
+    0xAE, 0xAF, 0xD9, 0x71, 0xAF, 0xFA, 0x73, 0xAE, 0x99, 0xEA, 0x73, 0xAE, 0x19, 0xE9, 0x72, 0xAE,
+    0x2A, 0xE7, 0x2A, 0xE3, 0xF7, 0x1A, 0xE3, 0x9F, 0x70, 0xAE, 0x4A, 0xF7, 0xAE, 0x5F, 0xC6, 0xAE,
+    0x95, 0xFC, 0x91, 0x9F, 0xFC, 0x4F, 0xCA, 0x0A, 0xFF, 0xC5, 0xAF, 0xA7, 0x71, 0xAA, 0x90, 0x70,
+    0x9A, 0x74, 0xE7, 0x2F, 0x71, 0x9E, 0x97, 0x1E, 0x97, 0x1A, 0xD9, 0x72, 0xD7, 0x77, 0x77, 0x79,
+    0x99, 0x2A, 0xEA, 0x19, 0xFA, 0x0F, 0xD0, 0x9F, 0xCA, 0x0A, 0xAF, 0x9F, 0xD9, 0x3F, 0xC9, 0x2A,
+    0x4F, 0x97, 0x1E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x9F, 0xFC, 0x93, 0xFF, 0xD9, 0x20, 0x79, 0x74, 0x9A, 0xFF,
+    0xEA, 0x7A, 0xFF, 0xFD, 0xA6, 0x99, 0xF2, 0x9A, 0xFA, 0x7A, 0xE5, 0xF7, 0xAE, 0x59, 0xE9, 0x6A,
+    0xE6, 0xEA, 0x6A, 0xE6, 0xEA, 0x6A, 0xE6, 0xE9, 0x6A, 0xE5, 0x9E, 0x7A, 0xE5, 0xEA, 0x7A, 0xE3,
+    0xAE, 0xA7, 0x0A, 0xEA, 0xFD, 0x97, 0x1A, 0xFF, 0xA7, 0x3A, 0xE9, 0x9E, 0xA7, 0x3A, 0xE1, 0x9E,
+    0x97, 0x2A, 0xE2, 0xAE, 0x72, 0xAE, 0x3F, 0x71, 0xAE, 0x39, 0xF7, 0x0A, 0xE4, 0xAF, 0x7A, 0xE5,
+    0xFC, 0x6A, 0xE9, 0x5F, 0xC9, 0x19, 0xFF, 0xC4, 0xFC, 0xA0, 0xAF, 0xFC, 0x5A, 0xFA, 0x77, 0x1A,
+    0xA9, 0x73, 0x97, 0x72, 0xAE, 0x77, 0x19, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE7, 0x71, 0x9D, 0xA7,
+    0x71, 0xE7, 0x72, 0xA9, 0x72, 0x72, 0x99, 0x92, 0xAE, 0xA1, 0x9F, 0xA0, 0xFD, 0x09, 0xFC, 0xA0,
+    0xAA, 0xF9, 0xFD, 0x93, 0xFC, 0x92, 0xA4, 0xF9, 0x71, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9,
+    0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x79, 0xFF, 0xC9, 0x3F,
+    0xFD, 0x97, 0x76, 0x97, 0x4E, 0x97, 0x2E, 0xA7, 0x29, 0xE7, 0x29, 0xDA, 0x72, 0xE7, 0x2A, 0xD7,
+    0x39, 0x97, 0x10, 0x39, 0x69, 0x97, 0x2D, 0xA4, 0xAD, 0xA7, 0x1A, 0xDA, 0x2A, 0xDA, 0x73, 0xEA,
+    0x0A, 0xDA, 0x75, 0xFD, 0xA7, 0x7F, 0xC7, 0x71, 0xAD, 0x77, 0x77, 0x71, 0x97, 0x49, 0xAF, 0xFE,
+    0xA7, 0xAF, 0xFF, 0xDA, 0x69, 0x9F, 0x29, 0xAF, 0xA7, 0xAE, 0x5F, 0x7A, 0xE5, 0x9E, 0x96, 0xAE,
+    0x6E, 0xA6, 0xAE, 0x6E, 0xA6, 0xAE, 0x6E, 0x96, 0xAE, 0x59, 0xE7, 0xAE, 0x5E, 0xA7, 0xAE, 0x3A,
+    0xEA, 0x70, 0xAE, 0xAF, 0xD9, 0x71, 0xAF, 0xFA, 0x73, 0xAE, 0x99, 0xEA, 0x73, 0xAE, 0x19, 0xE9,
+    0x72, 0xAE, 0x2A, 0xE7, 0x2A, 0xE3, 0xF7, 0x1A, 0xE3, 0x9F, 0x70, 0xAE, 0x4A, 0xF7, 0xAE, 0x5F,
+    0xC6, 0xAE, 0x95, 0xFC, 0x91, 0x9F, 0xFC, 0x4F, 0xCA, 0x0A, 0xFF, 0xC5, 0xAF, 0xA7, 0x71, 0xAA,
+    0x90, 0x2A, 0x6A, 0x93, 0xE3, 0x9D, 0xA3, 0x9D, 0xA2, 0xE5, 0xE9, 0x0E, 0x7E, 0xAD, 0x97, 0x0F,
+    0xA7, 0x19, 0xE7, 0x77, 0x77, 0x69, 0x99, 0x2A, 0xEA, 0x19, 0xFA, 0x0F, 0xD0, 0x9F, 0xCA, 0x0A,
+    0xAF, 0x9F, 0xD9, 0x3F, 0xC9, 0x2A, 0x4F, 0x97, 0x1E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x9F, 0xFC, 0x93, 0xFF,
+    0xD9, 0x20, 0x77, 0x71, 0x9D, 0x73, 0xF7, 0x19, 0xFC, 0x70, 0xAF, 0xA7, 0x09, 0xE9, 0x73, 0x97,
+    0x77, 0x77, 0x5A, 0xFE, 0x94, 0xAF, 0xFE, 0x29, 0xF9, 0x99, 0xAF, 0x2E, 0x95, 0xE1, 0x9E, 0x6E,
+    0x1A, 0xDA, 0x6D, 0xA1, 0xAE, 0x6A, 0xC2, 0xAE, 0xA7, 0x3F, 0xA7, 0x2A, 0xFC, 0x97, 0x1A, 0xFD,
+    0x97, 0x09, 0xFE, 0x97, 0x09, 0xFD, 0xA7, 0x19, 0xFC, 0xA7, 0x2A, 0xF2, 0x97, 0xAE, 0x90, 0xD7,
+    0x0E, 0x99, 0xD9, 0x7E, 0x99, 0xDA, 0x69, 0xE0, 0x9E, 0x6F, 0x09, 0xF9, 0x29, 0xF1, 0x9F, 0xFF,
+    0x92, 0x9F, 0xFC, 0xA7, 0x99, 0xAA, 0xA9, 0x50, 0x70, 0xC9, 0x72, 0xAD, 0x97, 0x09, 0xE9, 0x70,
+    0xF7, 0x0A, 0xE7, 0x09, 0xDA, 0x71, 0x9C, 0xA7, 0x77, 0x77, 0x99, 0x99, 0x69, 0xFF, 0x92, 0x9F,
+    0xFC, 0xA2, 0xDA, 0x39, 0xDA, 0x19, 0xD9, 0x4A, 0xCA, 0x1A, 0xD9, 0x49, 0xC2, 0x9E, 0x97, 0x1F,
+    0xC9, 0x7A, 0xFD, 0x96, 0x9F, 0xE9, 0x6A, 0xFD, 0x97, 0x9F, 0xC1, 0x9C, 0x59, 0xE1, 0xD6, 0xE1,
+    0xDA, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xFC, 0xAF, 0xC2, 0x9F, 0xFA, 0x69, 0x99, 0x99, 0x40, 0x77,
+    0x6E, 0x97, 0x2F, 0xC9, 0x70, 0xAF, 0xD9, 0x6A, 0xDA, 0x09, 0xE9, 0x4A, 0xDA, 0x3E, 0x4A, 0xC9,
+    0x5C, 0x97, 0x77, 0x76, 0xAF, 0xE9, 0x4A, 0xFF, 0xE2, 0x9F, 0x99, 0x9A, 0xF2, 0xE9, 0x5E, 0x19,
+    0xE6, 0xE1, 0xAD, 0xA6, 0xDA, 0x1A, 0xE6, 0xAC, 0x2A, 0xEA, 0x73, 0xFA, 0x72, 0xAF, 0xC9, 0x71,
+    0xAF, 0xD9, 0x70, 0x9F, 0xE9, 0x70, 0x9F, 0xDA, 0x71, 0x9F, 0xCA, 0x72, 0xAF, 0x29, 0x7A, 0xE9,
+    0x0D, 0x70, 0xE9, 0x9D, 0x97, 0xE9, 0x9D, 0xA6, 0x9E, 0x09, 0xE6, 0xF0, 0x9F, 0x92, 0x9F, 0x19,
+    0xFF, 0xF9, 0x29, 0xFF, 0xCA, 0x79, 0x9A, 0xAA, 0x95, 0x69, 0x72, 0xAE, 0x71, 0xFC, 0x7F, 0xDA,
+    0x5A, 0xDA, 0x0E, 0x94, 0xDA, 0x2E, 0x3E, 0x39, 0xD3, 0x9A, 0x59, 0x97, 0x75, 0x99, 0x99, 0x69,
+    0xFF, 0x92, 0x9F, 0xFC, 0xA2, 0xDA, 0x39, 0xDA, 0x19, 0xD9, 0x4A, 0xCA, 0x1A, 0xD9, 0x49, 0xC2,
+    0x9E, 0x97, 0x1F, 0xC9, 0x7A, 0xFD, 0x96, 0x9F, 0xE9, 0x6A, 0xFD, 0x97, 0x9F, 0xC1, 0x9C, 0x59,
+    0xE1, 0xD6, 0xE1, 0xDA, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xFC, 0xAF, 0xC2, 0x9F, 0xFA, 0x69, 0x99,
+    0x99, 0x40, 0x77, 0x4A, 0xFE, 0x94, 0xAF, 0xFE, 0x29, 0xF9, 0x99, 0xAF, 0x2E, 0x95, 0xE1, 0x9E,
+    0x6E, 0x1A, 0xDA, 0x6D, 0xA1, 0xAE, 0x6A, 0xC2, 0xAE, 0xA7, 0x3F, 0xA7, 0x2A, 0xFC, 0x97, 0x1A,
+    0xFD, 0x97, 0x09, 0xFE, 0x97, 0x09, 0xFD, 0xA7, 0x19, 0xFC, 0xA7, 0x2A, 0xF2, 0x97, 0xAE, 0x90,
+    0xD7, 0x0E, 0x99, 0xD9, 0x7E, 0x99, 0xDA, 0x69, 0xE0, 0x9E, 0x6F, 0x09, 0xF9, 0x29, 0xF1, 0x9F,
+    0xFF, 0x92, 0x9F, 0xFC, 0xA7, 0x99, 0xAA, 0xA9, 0x74, 0x99, 0x74, 0xF9, 0x72, 0xAF, 0x74, 0xE7,
+    0x4E, 0x73, 0xE9, 0x72, 0xE9, 0x73, 0x99, 0x70, 0x59, 0x99, 0x96, 0x9F, 0xF9, 0x29, 0xFF, 0xCA,
+    0x2D, 0xA3, 0x9D, 0xA1, 0x9D, 0x94, 0xAC, 0xA1, 0xAD, 0x94, 0x9C, 0x29, 0xE9, 0x71, 0xFC, 0x97,
+    0xAF, 0xD9, 0x69, 0xFE, 0x96, 0xAF, 0xD9, 0x79, 0xFC, 0x19, 0xC5, 0x9E, 0x1D, 0x6E, 0x1D, 0xA5,
+    0xE1, 0xE9, 0x3A, 0xDA, 0x1F, 0xCA, 0xFC, 0x29, 0xFF, 0xA6, 0x99, 0x99, 0x97, 0x29, 0x72, 0x9F,
+    0x70, 0x9F, 0xC7, 0x2E, 0x71, 0x9D, 0xA7, 0x1E, 0x70, 0x9E, 0x72, 0xA9, 0x60, 0x29, 0x79, 0x93,
+    0xAD, 0x5E, 0x4E, 0x3E, 0x59, 0xE9, 0x0E, 0x96, 0x9F, 0xD9, 0x70, 0x9F, 0x97, 0x3D, 0x97, 0x77,
+    0x77, 0x2A, 0xFE, 0x94, 0xAF, 0xFE, 0x29, 0xF9, 0x99, 0xAF, 0x2E, 0x95, 0xE1, 0x9E, 0x6E, 0x1A,
+    0xDA, 0x6D, 0xA1, 0xAE, 0x6A, 0xC2, 0xAE, 0xA7, 0x3F, 0xA7, 0x2A, 0xFC, 0x97, 0x1A, 0xFD, 0x97,
+    0x09, 0xFE, 0x97, 0x09, 0xFD, 0xA7, 0x19, 0xFC, 0xA7, 0x2A, 0xF2, 0x97, 0xAE, 0x90, 0xD7, 0x0E,
+    0x99, 0xD9, 0x7E, 0x99, 0xDA, 0x69, 0xE0, 0x9E, 0x6F, 0x09, 0xF9, 0x29, 0xF1, 0x9F, 0xFF, 0x92,
+    0x9F, 0xFC, 0xA7, 0x99, 0xAA, 0xA9, 0x50, 0x19, 0x95, 0xA9, 0x29, 0xD4, 0xE3, 0xE2, 0xAD, 0x93,
+    0x9E, 0x09, 0xDA, 0x5A, 0xFD, 0x7A, 0xF7, 0x1A, 0xD9, 0x77, 0x77, 0x69, 0x99, 0x96, 0x9F, 0xF9,
+    0x29, 0xFF, 0xCA, 0x2D, 0xA3, 0x9D, 0xA1, 0x9D, 0x94, 0xAC, 0xA1, 0xAD, 0x94, 0x9C, 0x29, 0xE9,
+    0x71, 0xFC, 0x97, 0xAF, 0xD9, 0x69, 0xFE, 0x96, 0xAF, 0xD9, 0x79, 0xFC, 0x19, 0xC5, 0x9E, 0x1D,
+    0x6E, 0x1D, 0xA5, 0xE1, 0xE9, 0x3A, 0xDA, 0x1F, 0xCA, 0xFC, 0x29, 0xFF, 0xA6, 0x99, 0x99, 0x94,
+    0x9F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xE0, 0xAE, 0xAA, 0xAA, 0xFA, 0xAA, 0xAF, 0x0A, 0xD4, 0xAE,
+    0x4A, 0xD0, 0xAD, 0x4A, 0xE4, 0xAD, 0x0A, 0xCA, 0x4A, 0xE4, 0x9D, 0x09, 0xC9, 0x4A, 0xE4, 0x9C,
+    0x97, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A,
+    0xE7, 0x70, 0xF9, 0x74, 0xAF, 0xFC, 0x97, 0x09, 0xFF, 0xD9, 0x77, 0x77, 0x29, 0x97, 0x70, 0x9F,
+    0x97, 0x69, 0xFC, 0x77, 0x1E, 0x77, 0x09, 0xE7, 0x70, 0xE7, 0x79, 0xE9, 0x77, 0x0A, 0x97, 0x20,
+    0x49, 0x72, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA6, 0x9A, 0xFF, 0xC0, 0xFF, 0xF9,
+    0xAA, 0xAF, 0xAA, 0xAA, 0xA3, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD,
+    0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAE, 0x70,
+    0xAE, 0xA9, 0x99, 0x9A, 0x3F, 0xFC, 0x3A, 0xFE, 0x69, 0x99, 0x97, 0x19, 0x71, 0xAF, 0x79, 0xFA,
+    0x71, 0xE7, 0x09, 0xDA, 0x70, 0xE7, 0x9E, 0x71, 0xA9, 0x40, 0x49, 0x79, 0x71, 0xE4, 0x9E, 0x70,
+    0x9E, 0x29, 0xE7, 0x2A, 0xE0, 0x9E, 0x74, 0xAF, 0xD7, 0x6A, 0xF7, 0x70, 0x9D, 0x97, 0x77, 0x77,
+    0x72, 0x9F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xE0, 0xAE, 0xAA, 0xAA, 0xFA, 0xAA, 0xAF, 0x0A, 0xD4,
+    0xAE, 0x4A, 0xD0, 0xAD, 0x4A, 0xE4, 0xAD, 0x0A, 0xCA, 0x4A, 0xE4, 0x9D, 0x09, 0xC9, 0x4A, 0xE4,
+    0x9C, 0x97, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE,
+    0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xF9, 0x74, 0xAF, 0xFC, 0x97, 0x09, 0xFF, 0xD9, 0x40, 0x77, 0x5D, 0x97, 0x1E,
+    0x71, 0xDA, 0x71, 0xD9, 0x59, 0x19, 0xD5, 0xDA, 0x09, 0xCA, 0x49, 0xDA, 0x09, 0xC5, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x69, 0xAF, 0xFC, 0x0F, 0xFF, 0x9A, 0xAA, 0xFA, 0xAA, 0xAA, 0x3A, 0xDA, 0x70, 0xAD,
+    0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xE7, 0x0A, 0xEA, 0x99, 0x99, 0xA3, 0xFF, 0xC3, 0xAF, 0xE6,
+    0x99, 0x99, 0x20, 0x9F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xE0, 0xAE, 0xAA, 0xAA, 0xFA, 0xAA, 0xAF,
+    0x0A, 0xD4, 0xAE, 0x4A, 0xD0, 0xAD, 0x4A, 0xE4, 0xAD, 0x0A, 0xCA, 0x4A, 0xE4, 0x9D, 0x09, 0xC9,
+    0x4A, 0xE4, 0x9C, 0x97, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x59, 0x99, 0xF9, 0x99, 0x72,
+    0xFF, 0xD9, 0x71, 0xAA, 0xAF, 0xAA, 0xA7, 0x5A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE,
+    0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x74, 0xAF, 0xFC, 0x97, 0x09, 0xFF,
+    0xD9, 0x40, 0x49, 0x72, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA6, 0x9A, 0xFF, 0xC0,
+    0xFF, 0xF9, 0xAA, 0xAF, 0xAA, 0xAA, 0xA3, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA,
+    0x59, 0xAA, 0xFA, 0xAA, 0xA1, 0xAF, 0xFD, 0x90, 0x99, 0x9E, 0xA9, 0x99, 0x94, 0xAD, 0xA7, 0x0A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xE7, 0x0A, 0xEA, 0x99, 0x99, 0xA3, 0xFF, 0xC3, 0xAF, 0xE6, 0x99,
+    0x99, 0x20, 0x70, 0xAD, 0x92, 0xAA, 0x76, 0xFC, 0xA1, 0xD7, 0x6F, 0xFD, 0x76, 0xD1, 0xAF, 0xC7,
+    0x6A, 0xA2, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x73, 0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF,
+    0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19,
+    0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E, 0x96, 0x9F, 0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7,
+    0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99, 0x99, 0x97, 0x10, 0x69, 0x97, 0x72, 0xF2,
+    0xAC, 0x73, 0xFD, 0x1D, 0x97, 0x2D, 0xA9, 0xFD, 0x73, 0xD2, 0xFA, 0x74, 0x93, 0x9A, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x2A, 0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A,
+    0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E,
+    0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD,
+    0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x79, 0x99, 0x99, 0x99, 0x99, 0x97, 0x6F,
+    0xFD, 0x97, 0x49, 0xFF, 0xD7, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49, 0xE7, 0x3E,
+    0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E, 0x96, 0x9F,
+    0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99,
+    0x99, 0x97, 0x10, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x3F, 0xFD, 0x97, 0x2F, 0xFD, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0xAA, 0xEA, 0x4A, 0xFC, 0x3A, 0xFC, 0xA3, 0x9F, 0xD4, 0x9A, 0xEA, 0x49,
+    0xAE, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A,
+    0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7, 0xAF, 0xFC, 0x9F,
+    0xD5, 0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x77, 0x77, 0x0A, 0xA6, 0xC7, 0x59, 0xD9,
+    0x4A, 0xC9, 0x75, 0xF9, 0x99, 0xE7, 0x6A, 0xFF, 0x97, 0x79, 0xFC, 0xA7, 0x74, 0x99, 0x77, 0x77,
+    0x77, 0x75, 0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E,
+    0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E,
+    0x96, 0x9F, 0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7,
+    0x70, 0x99, 0x99, 0x97, 0x10, 0x77, 0x72, 0xAC, 0x6C, 0x73, 0xE4, 0xD9, 0x72, 0xFC, 0xAA, 0xE7,
+    0x4F, 0xF7, 0x69, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xEA, 0x4A, 0xFC, 0x3A, 0xFC, 0xA3,
+    0x9F, 0xD4, 0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A,
+    0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E,
+    0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91,
+    0x9F, 0xD7, 0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x73, 0x99,
+    0x97, 0x73, 0xAF, 0xC7, 0x71, 0xAD, 0xAA, 0xDA, 0x77, 0x0D, 0x91, 0x9D, 0x77, 0x0D, 0x3D, 0x77,
+    0x0D, 0x91, 0x9D, 0x77, 0x0A, 0xDA, 0xAD, 0xA7, 0x71, 0xFC, 0xA7, 0x73, 0x99, 0x97, 0x77, 0x74,
+    0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49, 0xE7, 0x3E,
+    0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E, 0x96, 0x9F,
+    0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99,
+    0x99, 0x97, 0x10, 0x77, 0x75, 0xFA, 0x77, 0xFD, 0xA7, 0x5A, 0xCA, 0x1A, 0xD7, 0x5D, 0x92, 0xD9,
+    0x74, 0xD9, 0x2D, 0x75, 0xE1, 0x9D, 0x75, 0x9F, 0xD9, 0x76, 0x9F, 0x97, 0x77, 0x77, 0x75, 0xAA,
+    0xEA, 0x4A, 0xFC, 0x3A, 0xFC, 0xA3, 0x9F, 0xD4, 0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6,
+    0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA,
+    0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7, 0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA, 0x1F, 0xD7,
+    0x99, 0x99, 0x49, 0x93, 0x77, 0x77, 0x5C, 0x5A, 0x97, 0x59, 0xDA, 0x3E, 0x74, 0x9E, 0xA2, 0xF7,
+    0x39, 0xF2, 0xF9, 0x72, 0xAE, 0xA2, 0xF7, 0x39, 0xE3, 0xE9, 0x75, 0xA9, 0x4A, 0xA7, 0x77, 0x77,
+    0x77, 0x2F, 0xFC, 0x5A, 0xFF, 0x9F, 0xFA, 0x5F, 0xFA, 0x19, 0xAE, 0x97, 0x09, 0xAE, 0x94, 0x9E,
+    0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73,
+    0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5,
+    0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE6, 0xE9, 0x71, 0x9E, 0x6E, 0xA7, 0x1A, 0xDA, 0x6F, 0x71, 0xE9,
+    0x69, 0xF7, 0xF7, 0x0F, 0xCA, 0x99, 0x99, 0xAF, 0x72, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77,
+    0x09, 0x99, 0x99, 0x71, 0x70, 0xA4, 0x97, 0x59, 0xD2, 0xDA, 0x74, 0xE9, 0x09, 0xE7, 0x3A, 0xE1,
+    0xEA, 0x73, 0xE1, 0x9E, 0x73, 0xAD, 0x91, 0xE7, 0x4D, 0x92, 0xD7, 0x69, 0x39, 0x77, 0x77, 0x77,
+    0x5A, 0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6,
+    0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6,
+    0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6,
+    0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1,
+    0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x0F, 0xFC, 0x5A, 0xFF, 0x9F, 0xFA, 0x5F, 0xFA, 0x19, 0xAE,
+    0x97, 0x09, 0xAE, 0x94, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5,
+    0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E,
+    0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE6, 0xE9, 0x71, 0x9E, 0x6E, 0xA7,
+    0x1A, 0xDA, 0x6F, 0x71, 0xE9, 0x69, 0xF7, 0xF7, 0x0F, 0xCA, 0x99, 0x99, 0xAF, 0x72, 0xFF, 0xFC,
+    0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0xE7, 0x74, 0xE7, 0x74, 0xAD, 0x97, 0x74, 0xE9, 0x77,
+    0x4A, 0xEA, 0x99, 0x77, 0x19, 0xFD, 0x77, 0x3A, 0xE9, 0x60, 0x77, 0x6A, 0xAE, 0xA4, 0xAF, 0xC3,
+    0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6,
+    0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA,
+    0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xAF, 0xC7, 0x99, 0x99, 0x4A,
+    0xD9, 0x77, 0x0A, 0xD7, 0x72, 0xD9, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xEA, 0x99, 0x77, 0xFD, 0x77,
+    0x0A, 0xE9, 0x00, 0x77, 0x77, 0x77, 0x39, 0xE7, 0x77, 0x7F, 0xC7, 0x77, 0x5F, 0xE7, 0x77, 0x3E,
+    0x90, 0xAE, 0x77, 0x71, 0xE9, 0x29, 0xDA, 0x77, 0x70, 0xAC, 0x94, 0x9C, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0xFF, 0xD7, 0x7F, 0xFC, 0x0F, 0xFC, 0x95, 0xE6, 0xFF, 0xA1, 0x9F, 0xC9, 0x7E, 0x70,
+    0x9E, 0x95, 0xEA, 0x79, 0xEA, 0x79, 0xE6, 0xF7, 0xAF, 0x7A, 0xDA, 0x6A, 0xE7, 0xFC, 0x7E, 0x96,
+    0x9E, 0x95, 0x9F, 0xC9, 0x6E, 0x70, 0xEA, 0x5A, 0xDA, 0xE5, 0x9D, 0xA7, 0x0A, 0xE5, 0xE9, 0xE5,
+    0xAD, 0x97, 0x09, 0xE5, 0xD9, 0x0E, 0x94, 0xE7, 0x2E, 0x93, 0x9D, 0x1A, 0xDA, 0x39, 0xDA, 0x72,
+    0xAD, 0xA3, 0xE1, 0x9E, 0x3A, 0xD9, 0x72, 0x9E, 0x3D, 0xA2, 0xE9, 0x2E, 0x74, 0xE9, 0x19, 0xD3,
+    0xAD, 0xA2, 0xDA, 0x74, 0xAD, 0xA1, 0xAD, 0x39, 0xE1, 0x9D, 0x97, 0x49, 0xE1, 0xDA, 0x4E, 0x1A,
+    0xD7, 0x6E, 0x09, 0xD9, 0x4A, 0xD9, 0x0E, 0x76, 0xE9, 0xAD, 0x59, 0xE0, 0xD9, 0x76, 0x9D, 0xAD,
+    0xA6, 0xE9, 0xD7, 0x70, 0xFC, 0x96, 0xAF, 0xC7, 0x70, 0xFC, 0x79, 0xFA, 0x77, 0x09, 0xEA, 0x70,
+    0xF7, 0x72, 0xE9, 0x70, 0xAE, 0x77, 0x77, 0x74, 0x76, 0x97, 0x77, 0x09, 0xE9, 0x77, 0x7F, 0xC7,
+    0x76, 0xAF, 0xD7, 0x75, 0xE0, 0xAD, 0xA7, 0x73, 0xE2, 0xE7, 0x72, 0xAD, 0x93, 0xD9, 0x77, 0x2A,
+    0x69, 0x77, 0x77, 0x77, 0x77, 0x39, 0xFE, 0xA4, 0xD4, 0x9F, 0xDA, 0x0F, 0xE9, 0x39, 0xD9, 0x39,
+    0xFD, 0xA1, 0xAE, 0x95, 0xAD, 0xA6, 0xE4, 0xE9, 0x5F, 0x59, 0xDA, 0x4E, 0xA4, 0x9F, 0x94, 0xAD,
+    0x94, 0x9E, 0x4A, 0xFA, 0x4E, 0x6E, 0x4D, 0xAE, 0x4D, 0xA6, 0xEA, 0x29, 0xD0, 0xE9, 0x2A, 0xD7,
+    0x9E, 0x2A, 0xD0, 0x9D, 0xA2, 0xE7, 0x0E, 0x2D, 0x91, 0xE2, 0xD9, 0x70, 0xAD, 0x90, 0x9D, 0x2A,
+    0xD9, 0x09, 0xD7, 0x19, 0xDA, 0x0A, 0xCA, 0x29, 0xDA, 0x0D, 0xA7, 0x2E, 0x0D, 0x93, 0xE0, 0xD9,
+    0x72, 0xAD, 0xAD, 0x4A, 0xDA, 0xD7, 0x4F, 0xA4, 0x9F, 0xA7, 0x4F, 0x95, 0xF9, 0x74, 0xAE, 0x6A,
+    0xE7, 0x77, 0x73, 0x77, 0x77, 0x9E, 0x77, 0x2F, 0xC7, 0x70, 0xFE, 0x76, 0xE9, 0x09, 0xE7, 0x4E,
+    0x92, 0x9D, 0xA7, 0x3A, 0xC9, 0x49, 0xC9, 0x77, 0x77, 0x77, 0x3A, 0xFF, 0xC3, 0xFF, 0x0A, 0xFF,
+    0xA3, 0xFF, 0x19, 0xAF, 0x97, 0xAE, 0x94, 0x9E, 0x97, 0xE7, 0xF6, 0x9D, 0xA7, 0x9E, 0x95, 0xE7,
+    0x1A, 0xE4, 0x9D, 0x97, 0x2E, 0xA3, 0xE7, 0x3A, 0xE2, 0x9D, 0x97, 0x4E, 0xA1, 0xE7, 0x59, 0xE0,
+    0xAD, 0x77, 0xAD, 0xAD, 0xA7, 0x70, 0xFC, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0x9E, 0x77,
+    0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE9, 0x97, 0x59, 0xFF, 0xD7,
+    0x3F, 0xFE, 0x50, 0x71, 0x97, 0x70, 0xE9, 0x76, 0xAF, 0x97, 0x49, 0xFD, 0x74, 0xE0, 0x9E, 0x72,
+    0xAD, 0x91, 0xAD, 0x97, 0x09, 0xD9, 0x3D, 0xA7, 0x1A, 0x95, 0x97, 0x77, 0x77, 0x59, 0xFE, 0xA2,
+    0xAF, 0xDA, 0x9F, 0xEA, 0x2A, 0xFD, 0x91, 0xAE, 0x96, 0x9E, 0x4E, 0x96, 0xAD, 0x94, 0xEA, 0x6E,
+    0x59, 0xE5, 0x9D, 0xA6, 0xE9, 0x4E, 0x79, 0xE3, 0x9D, 0xA7, 0x0E, 0x3A, 0xD7, 0x1A, 0xDA, 0x2D,
+    0xA7, 0x2E, 0x19, 0xD9, 0x72, 0xE9, 0x0E, 0x73, 0x9D, 0xA0, 0xD9, 0x74, 0xEA, 0xD7, 0x59, 0xF9,
+    0x76, 0xF7, 0x7A, 0xDA, 0x77, 0xE7, 0x79, 0xDA, 0x77, 0xE7, 0x69, 0xEA, 0x74, 0x9F, 0xC7, 0x2A,
+    0xFE, 0x73, 0xAF, 0xD7, 0x59, 0xAA, 0xA9, 0x75, 0x77, 0x74, 0xE3, 0xE9, 0x72, 0xAE, 0xA1, 0x9F,
+    0x72, 0xAE, 0xA1, 0x9E, 0xA7, 0x3D, 0xA3, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAF, 0xFC, 0x3F,
+    0xF0, 0xAF, 0xFA, 0x3F, 0xF1, 0x9A, 0xF9, 0x7A, 0xE9, 0x49, 0xE9, 0x7E, 0x7F, 0x69, 0xDA, 0x79,
+    0xE9, 0x5E, 0x71, 0xAE, 0x49, 0xD9, 0x72, 0xEA, 0x3E, 0x73, 0xAE, 0x29, 0xD9, 0x74, 0xEA, 0x1E,
+    0x75, 0x9E, 0x0A, 0xD7, 0x7A, 0xDA, 0xDA, 0x77, 0x0F, 0xC7, 0x71, 0xAE, 0x97, 0x71, 0x9E, 0x77,
+    0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x99, 0x75,
+    0x9F, 0xFD, 0x73, 0xFF, 0xE5, 0x73, 0x97, 0x7D, 0x75, 0x9E, 0x97, 0x3F, 0xC9, 0x71, 0x9F, 0xC9,
+    0x72, 0xEA, 0x97, 0x49, 0x97, 0x77, 0x77, 0x6A, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0x1F, 0xCA, 0xAA,
+    0xAA, 0xAF, 0xC1, 0xE7, 0xAE, 0x2D, 0x96, 0x9E, 0x92, 0xD7, 0xEA, 0x39, 0xA6, 0xF7, 0x4A, 0xE9,
+    0x74, 0xEA, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xEA,
+    0x74, 0xF7, 0x9C, 0x2A, 0xE9, 0x7D, 0x90, 0x9E, 0xA7, 0x0D, 0x90, 0xF7, 0x0A, 0xD9, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xEA, 0x77, 0x20, 0x70, 0xAA, 0x74,
+    0xDA, 0x72, 0xF7, 0x1A, 0xE7, 0x2E, 0x97, 0x1E, 0x97, 0x2D, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xA1,
+    0xFF, 0xFC, 0x1D, 0xA9, 0x99, 0x99, 0x9E, 0xA0, 0x9D, 0x5F, 0x19, 0xCA, 0x4A, 0xE3, 0xA9, 0x39,
+    0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0x9E, 0x97, 0x1E, 0xA5, 0xC9, 0x1E,
+    0xA5, 0xAC, 0xA0, 0xAE, 0x6D, 0x99, 0xE9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFD, 0x0A, 0xFF, 0xFC,
+    0x77, 0x69, 0xAA, 0x75, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x75, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x6A,
+    0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0x1F, 0xCA, 0xAA, 0xAA, 0xAF, 0xC1, 0xE7, 0xAE, 0x2D, 0x96, 0x9E,
+    0x92, 0xD7, 0xEA, 0x39, 0xA6, 0xF7, 0x4A, 0xE9, 0x74, 0xEA, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9,
+    0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xEA, 0x74, 0xF7, 0x9C, 0x2A, 0xE9, 0x7D, 0x90, 0x9E,
+    0xA7, 0x0D, 0x90, 0xF7, 0x0A, 0xD9, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0xAF, 0xFF, 0xF0,
+    0x9F, 0xFF, 0xEA, 0x77, 0x20, 0x5A, 0xCA, 0x72, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0x9E, 0x97, 0x39,
+    0x77, 0x77, 0x77, 0x4F, 0xFF, 0xA1, 0xFF, 0xFC, 0x1D, 0xA9, 0x99, 0x99, 0x9E, 0xA0, 0x9D, 0x5F,
+    0x19, 0xCA, 0x4A, 0xE3, 0xA9, 0x39, 0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xAE, 0x71, 0xAE, 0x71,
+    0x9E, 0x97, 0x1E, 0xA5, 0xC9, 0x1E, 0xA5, 0xAC, 0xA0, 0xAE, 0x6D, 0x99, 0xE9, 0x99, 0x99, 0x99,
+    0xE9, 0xFF, 0xFD, 0x0A, 0xFF, 0xFC, 0x77, 0x39, 0x69, 0x96, 0xD9, 0x4A, 0xD9, 0x5E, 0xA2, 0xAD,
+    0xA7, 0xEA, 0x0A, 0xDA, 0x71, 0xFD, 0xA7, 0x3F, 0xA7, 0x5A, 0xD7, 0x77, 0x77, 0x4A, 0xFF, 0xFD,
+    0x91, 0xFF, 0xFF, 0x1F, 0xCA, 0xAA, 0xAA, 0xAF, 0xC1, 0xE7, 0xAE, 0x2D, 0x96, 0x9E, 0x92, 0xD7,
+    0xEA, 0x39, 0xA6, 0xF7, 0x4A, 0xE9, 0x74, 0xEA, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xF7,
+    0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xEA, 0x74, 0xF7, 0x9C, 0x2A, 0xE9, 0x7D, 0x90, 0x9E, 0xA7, 0x0D,
+    0x90, 0xF7, 0x0A, 0xD9, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF,
+    0xEA, 0x77, 0x20, 0x2A, 0x59, 0xA9, 0x3D, 0xA3, 0x9D, 0xA3, 0xAD, 0x92, 0xE5, 0xE9, 0x0E, 0x7E,
+    0xAD, 0x97, 0x9F, 0xA7, 0x19, 0xE7, 0x77, 0x77, 0x73, 0xFF, 0xFA, 0x1F, 0xFF, 0xC1, 0xDA, 0x99,
+    0x99, 0x99, 0xEA, 0x09, 0xD5, 0xF1, 0x9C, 0xA4, 0xAE, 0x3A, 0x93, 0x9E, 0x97, 0x1E, 0x97, 0x1E,
+    0xA7, 0x1A, 0xE7, 0x1A, 0xE7, 0x19, 0xE9, 0x71, 0xEA, 0x5C, 0x91, 0xEA, 0x5A, 0xCA, 0x0A, 0xE6,
+    0xD9, 0x9E, 0x99, 0x99, 0x99, 0x9E, 0x9F, 0xFF, 0xD0, 0xAF, 0xFF, 0xC7, 0x70, 0x70, 0x9A, 0xAA,
+    0x97, 0x0A, 0xFE, 0x6F, 0xAF, 0xC4, 0xAD, 0xA3, 0xDA, 0x4E, 0x5A, 0x4A, 0xDA, 0x73, 0xAD, 0x97,
+    0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97,
+    0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97,
+    0x3E, 0x97, 0x09, 0xFF, 0xC5, 0xFF, 0xD4, 0x77, 0x77, 0x75, 0xAD, 0x97, 0x74, 0xAE, 0x77, 0x4A,
+    0xE7, 0x19, 0x99, 0x96, 0xE9, 0x6A, 0xFF, 0xA9, 0x19, 0xE5, 0x9F, 0xFF, 0xCA, 0xE5, 0xAF, 0xA9,
+    0x19, 0xAF, 0xDA, 0x5A, 0xEA, 0x7F, 0xC5, 0x9E, 0xA7, 0x1F, 0xA4, 0xF7, 0x3F, 0x39, 0xE9, 0x73,
+    0xAE, 0x92, 0xF7, 0x49, 0xEA, 0x2E, 0xA7, 0x5F, 0x2E, 0x97, 0x5F, 0x19, 0xE9, 0x75, 0xAE, 0x19,
+    0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xF1, 0x9E, 0xA7, 0x5E, 0xA2, 0xF7,
+    0x5E, 0x92, 0xF9, 0x73, 0xAE, 0x39, 0xF7, 0x3E, 0xA4, 0xF9, 0x71, 0xAE, 0x59, 0xF9, 0x7A, 0xE9,
+    0x6A, 0xFC, 0x93, 0x9F, 0xA7, 0x09, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xAA, 0xA9,
+    0x72, 0x76, 0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3,
+    0x9F, 0xFF, 0xC3, 0xAE, 0x92, 0x9F, 0xC4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1,
+    0x9E, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E,
+    0x19, 0xE9, 0x79, 0xE2, 0xEA, 0x7E, 0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9,
+    0x7F, 0xFA, 0x73, 0x9A, 0xA9, 0x97, 0x71, 0x97, 0x49, 0xAF, 0xFE, 0xA5, 0xFF, 0xFF, 0xA2, 0xF9,
+    0xAE, 0x29, 0xAF, 0xA0, 0xAD, 0xA1, 0xAE, 0x5F, 0x0E, 0x91, 0xAE, 0x6E, 0x9A, 0xD9, 0x1A, 0xE6,
+    0xEA, 0x09, 0x92, 0xAE, 0x6E, 0xA5, 0xAE, 0x6E, 0xA5, 0xAE, 0x6E, 0x95, 0xAE, 0x5A, 0xE6, 0xAE,
+    0x49, 0xE9, 0x6A, 0xE9, 0x99, 0xAF, 0xA7, 0xAF, 0xFD, 0x97, 0x0A, 0xFE, 0xA9, 0x72, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x74, 0x9F,
+    0xFC, 0x97, 0x1A, 0xFF, 0xC9, 0x60, 0x70, 0x9A, 0xAA, 0x97, 0x4A, 0xFE, 0x72, 0xFA, 0xFC, 0x70,
+    0xAD, 0xA3, 0xDA, 0x70, 0xE5, 0xA7, 0x0A, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x97, 0x7E, 0x92, 0x99,
+    0x97, 0x1E, 0x1A, 0xFD, 0x96, 0xE9, 0xFF, 0xC9, 0x5F, 0xDA, 0x9A, 0xFC, 0x5F, 0x94, 0xAE, 0xA4,
+    0xE9, 0x6F, 0x4E, 0x96, 0x9E, 0x4E, 0x97, 0xE9, 0x3E, 0x97, 0xE9, 0x3E, 0x97, 0xE9, 0x3E, 0x97,
+    0xE9, 0x3E, 0x97, 0xE4, 0xE9, 0x69, 0xE4, 0xE9, 0x6E, 0x94, 0xE9, 0x5A, 0xE5, 0xF9, 0x91, 0x9F,
+    0x6F, 0xFF, 0x7F, 0xFD, 0x97, 0x0E, 0x77, 0x0E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x59,
+    0xAF, 0xCA, 0x72, 0xFF, 0xCA, 0x71, 0x99, 0x99, 0x99, 0x99, 0x97, 0x10, 0x49, 0x72, 0xDA, 0x70,
+    0x9D, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA6, 0x9A, 0xFF, 0xC0, 0xFF, 0xF9, 0xAA, 0xAF, 0xAA, 0xAA,
+    0xA3, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70,
+    0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAE, 0x70, 0xAE, 0xA9, 0x99, 0x9A,
+    0x3F, 0xFC, 0x3A, 0xFF, 0x59, 0x99, 0x9E, 0x71, 0xDA, 0x71, 0xDA, 0x49, 0x3D, 0x93, 0xAC, 0xA1,
+    0xAD, 0x4F, 0xE9, 0x4A, 0xFC, 0x97, 0xAA, 0x93, 0x29, 0xAF, 0xFF, 0xF1, 0xAF, 0xFF, 0xFE, 0x09,
+    0xFA, 0xAA, 0xAF, 0xAA, 0xAA, 0xF0, 0xAE, 0x4E, 0xA4, 0xE0, 0xEA, 0x4E, 0xA4, 0xDA, 0x0A, 0xE4,
+    0xEA, 0x4D, 0xA1, 0xEA, 0x3E, 0xA4, 0xAC, 0x39, 0xA9, 0x3E, 0xA7, 0x71, 0xEA, 0x77, 0x1E, 0xA7,
+    0x71, 0xEA, 0x77, 0x1E, 0xA7, 0x71, 0xEA, 0x77, 0x1E, 0xA7, 0x71, 0xEA, 0x77, 0x1E, 0xA7, 0x71,
+    0xEA, 0x77, 0x1E, 0xA7, 0x71, 0xEA, 0x77, 0x1E, 0xA7, 0x70, 0x9E, 0xA9, 0x74, 0x9A, 0xFF, 0xC7,
+    0x2A, 0xFF, 0xD5, 0x79, 0xAA, 0xA9, 0x70, 0x9F, 0xE9, 0x5A, 0xEA, 0xAF, 0x49, 0xE3, 0xE4, 0xE9,
+    0x4A, 0x5E, 0x73, 0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x19, 0xAF, 0xFC, 0x3F, 0xFF, 0x92,
+    0xAA, 0xAF, 0xAA, 0xAA, 0xA6, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xAD,
+    0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xAE, 0x73,
+    0xAE, 0xA9, 0x99, 0x9A, 0x6F, 0xFC, 0x6A, 0xFE, 0x71, 0x99, 0x99, 0x50, 0x9F, 0xFF, 0xFE, 0x0A,
+    0xFF, 0xFF, 0xE0, 0xAE, 0xAA, 0xAA, 0xFA, 0xAA, 0xAF, 0x0A, 0xD4, 0xAE, 0x4A, 0xD0, 0xAD, 0x4A,
+    0xE4, 0xAD, 0x0A, 0xCA, 0x4A, 0xE4, 0x9D, 0x09, 0xC9, 0x4A, 0xE4, 0x9C, 0x97, 0x0A, 0xE7, 0x70,
+    0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE,
+    0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xE7, 0x71, 0xE3, 0x97, 0x4E, 0x91, 0x9D, 0x73, 0x9E, 0xAA,
+    0xE9, 0x73, 0xAF, 0xE7, 0x5A, 0xFC, 0xA7, 0x79, 0x99, 0x40, 0x77, 0x77, 0x77, 0x0A, 0xDA, 0x77,
+    0x69, 0xE7, 0x76, 0x9E, 0x77, 0x6A, 0xE1, 0xFF, 0xC5, 0xAF, 0xF1, 0x9F, 0xFA, 0x5F, 0xEA, 0x49,
+    0xAE, 0x97, 0x09, 0xAE, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E,
+    0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79,
+    0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x70, 0xE9, 0x71, 0x9E, 0x70,
+    0xEA, 0x71, 0xAD, 0xA7, 0x0F, 0x71, 0xE9, 0x70, 0x9F, 0x7F, 0x72, 0xFC, 0xA9, 0x99, 0x9A, 0xF7,
+    0x4F, 0xFF, 0xC9, 0x75, 0xAF, 0xFC, 0xA7, 0x72, 0x99, 0x99, 0x97, 0x30, 0x77, 0x1A, 0xC9, 0x77,
+    0x2E, 0x77, 0x2E, 0x77, 0x1A, 0xE1, 0xAA, 0xEA, 0x4A, 0xAF, 0xD1, 0xAF, 0xCA, 0x39, 0xFD, 0x49,
+    0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A,
+    0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x7A, 0xA3, 0x9D, 0xA2,
+    0xAE, 0x92, 0xF3, 0xF3, 0xAD, 0xA3, 0x9D, 0x60, 0x3C, 0x93, 0xAD, 0x91, 0x9E, 0x91, 0xEA, 0x1A,
+    0xE1, 0x9D, 0xA2, 0x9C, 0xA7, 0x20, 0x59, 0x70, 0xAE, 0x7F, 0xC5, 0xFD, 0xA3, 0xAD, 0x90, 0xE9,
+    0x2D, 0xA2, 0xE1, 0xE3, 0x9D, 0x19, 0xA5, 0x99, 0x00, 0x29, 0x70, 0x9F, 0x2D, 0x1F, 0xD0, 0x9D,
+    0x1D, 0xA9, 0xFD, 0x1D, 0x19, 0xFA, 0x29, 0x3A, 0xA9, 0x10, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x91,
+    0xFF, 0xD0, 0x9F, 0xFD, 0x74, 0x74, 0xD6, 0xC1, 0xE4, 0xD1, 0xFA, 0xAA, 0xDA, 0x2F, 0xF4, 0x9F,
+    0x92, 0x09, 0xD9, 0x1F, 0x1F, 0x1F, 0x29, 0x91, 0x09, 0x99, 0x49, 0x90, 0x9E, 0x91, 0x9E, 0x9A,
+    0xEA, 0x1A, 0xEA, 0x9E, 0x29, 0xE9, 0x19, 0x59, 0x10, 0x29, 0x99, 0x94, 0xFD, 0x91, 0xEA, 0xAE,
+    0x1D, 0x91, 0xAD, 0x90, 0xD2, 0x9D, 0x95, 0xE4, 0x9E, 0x4E, 0x95, 0x9C, 0xA7, 0x94, 0x73, 0x9F,
+    0xA2, 0x9F, 0xDA, 0x1D, 0xA1, 0xAD, 0x1D, 0x29, 0xD1, 0xD9, 0x2D, 0x1E, 0x1A, 0xD1, 0x9F, 0xD9,
+    0x2A, 0xF9, 0x73, 0x3A, 0x39, 0x93, 0xAD, 0x2D, 0xA2, 0xE1, 0x9E, 0x1A, 0xDA, 0x1E, 0x91, 0xE1,
+    0xAD, 0xA1, 0xAD, 0x2E, 0x2D, 0x29, 0xD7, 0x19, 0x30, 0x09, 0x95, 0xA9, 0x09, 0xD4, 0xE1, 0xE2,
+    0xAD, 0x91, 0x9E, 0x09, 0xDA, 0x3A, 0xFD, 0x5A, 0xF7, 0xE9, 0x77, 0x09, 0x93, 0xA3, 0xAD, 0x2D,
+    0xA2, 0xE9, 0x1E, 0x29, 0xE1, 0xAD, 0xA2, 0xAD, 0xA1, 0xE3, 0xE2, 0xDA, 0x3D, 0x92, 0xD4, 0x96,
+    0x49, 0x97, 0xAF, 0xC9, 0x29, 0xFF, 0xA1, 0xE9, 0x09, 0xAE, 0x1C, 0xA4, 0xAD, 0x1A, 0x6A, 0x90,
+    0x2A, 0xA2, 0xAD, 0x19, 0xD9, 0x1E, 0x19, 0xDA, 0x1A, 0xDA, 0x1A, 0xE1, 0x9F, 0x19, 0xDA, 0x00,
+    0x09, 0xA9, 0x19, 0xEA, 0x1F, 0x2E, 0x2E, 0x2D, 0xA1, 0xAD, 0x2D, 0xA1, 0xAC, 0xA7, 0x00, 0x19,
+    0xA9, 0x1A, 0xE9, 0x0F, 0x1E, 0x2E, 0x2A, 0xD3, 0xDA, 0x2A, 0xD3, 0xAC, 0xA5, 0x4D, 0x90, 0xE0,
+    0xE0, 0xD9, 0x9D, 0x09, 0xCA, 0x09, 0xC2, 0x91, 0x1A, 0xC9, 0x2E, 0x2E, 0x91, 0xE1, 0xE9, 0x09,
+    0xD9, 0x19, 0xA7, 0x10, 0x6A, 0xDA, 0x1F, 0x1F, 0x1A, 0xDA, 0x60, 0x0A, 0xCA, 0x3A, 0xCA, 0x0A,
+    0xE9, 0x19, 0xEA, 0xAE, 0x91, 0xAE, 0xA0, 0xE3, 0xE7, 0x40, 0x39, 0x39, 0xF9, 0x1D, 0xAA, 0xD0,
+    0xAC, 0xA1, 0xAC, 0xAA, 0xCA, 0x1A, 0xCA, 0x9D, 0x99, 0xD9, 0x0A, 0xFA, 0x29, 0xA9, 0x20, 0x6E,
+    0xA1, 0xAE, 0x2E, 0x2E, 0x19, 0xD9, 0x1D, 0xA2, 0xA9, 0x20, 0x19, 0x29, 0xF0, 0x9F, 0xC2, 0xE1,
+    0x9D, 0xA1, 0xE0, 0x9E, 0x2A, 0x92, 0x49, 0x39, 0xD3, 0xAD, 0x4D, 0xA3, 0x9D, 0xA3, 0x9E, 0xA9,
+    0x91, 0xFD, 0x91, 0x9E, 0xA0, 0x2F, 0xFF, 0xFD, 0xAA, 0xA0, 0x49, 0xA9, 0x7F, 0x95, 0x9F, 0xC9,
+    0x4E, 0x9E, 0x3E, 0x2E, 0x1E, 0x39, 0xD2, 0x95, 0x91, 0x09, 0x96, 0xA1, 0xD9, 0x4A, 0xC1, 0xEA,
+    0x2A, 0xD1, 0xAF, 0xF9, 0x2A, 0xFD, 0x95, 0x9A, 0xA9, 0x30, 0x29, 0x97, 0x9F, 0x2D, 0x1F, 0xD0,
+    0x9D, 0x1D, 0xA9, 0xFD, 0x1D, 0x2F, 0xA2, 0x93, 0x9A, 0x91, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0xFF, 0xD9, 0x9F, 0xFD, 0x74, 0x49, 0x97, 0xAF, 0xC9, 0x29, 0xFF, 0xA1, 0xE9, 0x09, 0xAE, 0x1C,
+    0xA4, 0xAD, 0x1A, 0x6A, 0x90, 0x7C, 0x71, 0xAD, 0x70, 0xE7, 0xAD, 0xA7, 0xE7, 0xAD, 0x70, 0xAC,
+    0x77, 0x19, 0xA9, 0x39, 0xA9, 0x0A, 0xE9, 0x19, 0xEA, 0xAE, 0xA1, 0xAE, 0xA9, 0xE2, 0x9E, 0x91,
+    0x95, 0x91, 0x9A, 0xA2, 0xAD, 0x2A, 0xD2, 0xAD, 0xA1, 0x9F, 0xA0, 0xAD, 0xA0, 0x77, 0x77, 0x39,
+    0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA,
+    0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7,
+    0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72,
+    0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71,
+    0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF,
+    0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x70, 0x97, 0x09, 0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xD9, 0x39, 0x9F,
+    0x3A, 0xF5, 0xAE, 0x49, 0xEA, 0x4A, 0xE5, 0xAD, 0xA4, 0xAE, 0x59, 0xE4, 0xAE, 0x59, 0xDA, 0x4A,
+    0xE5, 0xAD, 0x94, 0xAE, 0x5E, 0x5A, 0xE4, 0xAD, 0x95, 0xAF, 0xFE, 0x6A, 0xFF, 0xF9, 0x4A, 0xE1,
+    0x99, 0x9A, 0xF9, 0x3A, 0xE6, 0xF3, 0xAE, 0x69, 0xE3, 0xAE, 0x7E, 0x92, 0xAE, 0x7E, 0x92, 0xAE,
+    0x7E, 0x3A, 0xE6, 0xAE, 0x3A, 0xE5, 0xAE, 0xA3, 0xAE, 0x99, 0x99, 0xAF, 0xC1, 0x9F, 0xFF, 0xDA,
+    0x2A, 0xFF, 0xFA, 0x77, 0x70, 0x9F, 0xFF, 0xFA, 0xFF, 0xFF, 0x09, 0x9F, 0xAA, 0xAA, 0xFD, 0x2A,
+    0xE5, 0x9D, 0xA2, 0xAE, 0x6D, 0xA2, 0xAE, 0x6D, 0x92, 0xAE, 0x6D, 0x92, 0xAE, 0x69, 0xA3, 0xAE,
+    0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE,
+    0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x97, 0x09, 0xFF, 0xCA, 0x5A, 0xFF, 0xCA, 0x50,
+    0x77, 0x74, 0xAD, 0x77, 0xAE, 0x97, 0x6F, 0xA7, 0x5A, 0xFC, 0x75, 0xDA, 0xE9, 0x73, 0x9D, 0x9A,
+    0xE7, 0x3E, 0x1E, 0x73, 0xD9, 0x1E, 0xA7, 0x1A, 0xD2, 0xAE, 0x71, 0xDA, 0x3E, 0x70, 0x9D, 0x93,
+    0xEA, 0x7E, 0x49, 0xE7, 0xDA, 0x5E, 0x95, 0xAD, 0x6E, 0xA5, 0xE6, 0x9E, 0x49, 0xD9, 0x7E, 0x93,
+    0xE7, 0x0F, 0x29, 0xDA, 0x70, 0x9E, 0x2A, 0xD9, 0x71, 0xEA, 0x1E, 0x72, 0xAE, 0x0A, 0xEA, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xF0, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xEA, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF,
+    0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79,
+    0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70,
+    0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F,
+    0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0x1F, 0xCA, 0xAA, 0xAA,
+    0xAF, 0xC1, 0xE7, 0xAE, 0x2D, 0x96, 0x9E, 0x92, 0xD7, 0xEA, 0x39, 0xA6, 0xF7, 0x4A, 0xE9, 0x74,
+    0xEA, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xF7, 0x4A, 0xE7, 0x49, 0xE9, 0x74, 0xEA, 0x74,
+    0xF7, 0x9C, 0x2A, 0xE9, 0x7D, 0x90, 0x9E, 0xA7, 0x0D, 0x90, 0xF7, 0x0A, 0xD9, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xE0, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xEA, 0x77, 0x20, 0x9F, 0xFA, 0x5F, 0xFC,
+    0x0A, 0xFF, 0x94, 0x9F, 0xFA, 0x19, 0x9F, 0x97, 0x09, 0xAE, 0x95, 0xAE, 0x72, 0x9E, 0x6A, 0xE7,
+    0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6,
+    0xAE, 0x72, 0x9E, 0x6A, 0xFF, 0xFF, 0xD6, 0xAF, 0xFF, 0xFD, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E,
+    0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x72, 0x9E, 0x6A, 0xE7, 0x29, 0xE6, 0xAE, 0x97, 0x1A, 0xE9, 0x29,
+    0xFF, 0xC5, 0xAF, 0xF0, 0xAF, 0xFC, 0x49, 0xFF, 0xC0, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9,
+    0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F,
+    0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97,
+    0x5F, 0x09, 0xE9, 0x19, 0xFF, 0x2A, 0xE0, 0x9E, 0x91, 0xAF, 0xF2, 0xAE, 0x09, 0xE9, 0x19, 0xFE,
+    0xA2, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE,
+    0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7,
+    0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97, 0x10, 0x9F, 0xFC, 0x0A, 0xFF,
+    0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x92, 0x9F,
+    0xFC, 0x0A, 0xFF, 0xC0, 0x9F, 0xFC, 0x29, 0xFF, 0x0A, 0xFF, 0xA2, 0x9F, 0xEA, 0x19, 0x9F, 0x96,
+    0x9E, 0xA5, 0xAE, 0x69, 0xEA, 0x6A, 0xE5, 0x9E, 0x97, 0xAE, 0x4A, 0xE9, 0x70, 0xAE, 0x3A, 0xE7,
+    0x2A, 0xE2, 0xAE, 0x73, 0xAE, 0x1A, 0xE7, 0x4A, 0xE0, 0xEA, 0x75, 0xAF, 0xDA, 0x76, 0xAF, 0xDA,
+    0x76, 0xAE, 0xAE, 0xA7, 0x5A, 0xE0, 0xFA, 0x74, 0xAE, 0x1F, 0xA7, 0x3A, 0xE2, 0xFA, 0x72, 0xAE,
+    0x3F, 0xA7, 0x1A, 0xE4, 0xFA, 0x70, 0xAE, 0x5F, 0xA7, 0xAE, 0x6F, 0xC6, 0xAE, 0x96, 0xFC, 0x91,
+    0x9F, 0xFC, 0x5F, 0xD9, 0xAF, 0xFC, 0x6A, 0xFA, 0x77, 0x19, 0xAA, 0x90, 0x77, 0x77, 0x2A, 0xD7,
+    0x73, 0xF7, 0x73, 0xFA, 0x77, 0x1A, 0xFC, 0x77, 0x1D, 0xAE, 0x97, 0x79, 0xD0, 0xAD, 0xA7, 0x7E,
+    0x09, 0xE7, 0x7D, 0x91, 0xE9, 0x75, 0xAD, 0x2A, 0xDA, 0x75, 0xDA, 0x29, 0xE7, 0x49, 0xD9, 0x3E,
+    0x97, 0x3E, 0x4A, 0xE7, 0x3D, 0xA4, 0x9E, 0x72, 0xAD, 0x95, 0xE9, 0x71, 0xE6, 0xF7, 0x09, 0xDA,
+    0x69, 0xE7, 0x0E, 0x70, 0xEA, 0x7E, 0x70, 0xF6, 0xAD, 0x97, 0x09, 0xE6, 0xE7, 0x2E, 0xA4, 0x9E,
+    0x71, 0x9F, 0x91, 0x9F, 0xE9, 0x4A, 0xFF, 0x9F, 0xF9, 0x4F, 0xFC, 0x90, 0x1A, 0xFE, 0x71, 0xAF,
+    0xD9, 0x3A, 0xFE, 0x71, 0xFE, 0x69, 0xFC, 0x97, 0x9F, 0xC9, 0x70, 0xFC, 0xA7, 0xFC, 0xA7, 0x1D,
+    0xAE, 0x7D, 0xAE, 0x71, 0xD0, 0xE9, 0x59, 0xD0, 0xE7, 0x09, 0xD0, 0xAD, 0xA5, 0xDA, 0x0E, 0x70,
+    0x9D, 0x09, 0xE5, 0xD9, 0x0E, 0x70, 0xAD, 0x1E, 0x4A, 0xD1, 0xE7, 0x0A, 0xD1, 0xAD, 0xA3, 0xDA,
+    0x1E, 0x97, 0xAD, 0x19, 0xE3, 0xD2, 0xAD, 0x97, 0xDA, 0x2E, 0x2A, 0xD2, 0xAD, 0x97, 0xDA, 0x2A,
+    0xD9, 0x1D, 0xA2, 0xAD, 0xA7, 0xDA, 0x3E, 0x1D, 0x39, 0xDA, 0x7D, 0x93, 0xE0, 0xAD, 0x39, 0xDA,
+    0x7D, 0x93, 0xAD, 0x9D, 0x93, 0x9E, 0x69, 0xD9, 0x4F, 0xC5, 0xE6, 0x9D, 0x94, 0xFA, 0x5E, 0x6A,
+    0xD5, 0x9E, 0x95, 0xE6, 0xAD, 0x6E, 0x6E, 0x6E, 0x95, 0xAC, 0xA6, 0xEA, 0x29, 0xFF, 0x72, 0x9F,
+    0xF0, 0xAF, 0xF7, 0x2F, 0xFC, 0x00, 0x9F, 0xD7, 0x0F, 0xFC, 0x09, 0xFD, 0xA7, 0xFF, 0xA2, 0x9F,
+    0xC9, 0x79, 0x9E, 0x95, 0xAF, 0xC7, 0x1A, 0xD6, 0xAF, 0xCA, 0x70, 0xAD, 0x6A, 0xDA, 0xE9, 0x7A,
+    0xD6, 0xAD, 0x0A, 0xE7, 0xAD, 0x6A, 0xD1, 0xF6, 0xAD, 0x6A, 0xD1, 0x9E, 0x95, 0xAD, 0x6A, 0xD2,
+    0xAE, 0x5A, 0xD6, 0xAD, 0x3F, 0x4A, 0xD6, 0xAD, 0x39, 0xEA, 0x3A, 0xD6, 0xAD, 0x4A, 0xE9, 0x2A,
+    0xD6, 0xAD, 0x5F, 0x2A, 0xD6, 0xAD, 0x6E, 0xA1, 0xAD, 0x6A, 0xD6, 0x9E, 0x90, 0xAD, 0x6A, 0xD7,
+    0xF0, 0xAD, 0x6A, 0xD7, 0x0E, 0xAA, 0xD6, 0xAD, 0x70, 0x9F, 0xD6, 0xAD, 0x71, 0xAF, 0xC6, 0xAD,
+    0x97, 0x1F, 0xC3, 0x9F, 0xF9, 0x69, 0xF3, 0xAF, 0xF9, 0x7A, 0xE7, 0x76, 0x95, 0x0A, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1E, 0x72, 0xAD, 0x1D, 0xA7, 0x29, 0xD1, 0xAC, 0xA7, 0x3D,
+    0x19, 0xC9, 0x73, 0xCA, 0x77, 0x77, 0x77, 0x76, 0xFF, 0xCA, 0x79, 0xFF, 0xD7, 0x0F, 0xFC, 0x97,
+    0x77, 0x77, 0x77, 0x5A, 0xA7, 0x49, 0xC0, 0x9D, 0x74, 0xAC, 0xA9, 0xD7, 0x4A, 0xDA, 0xD7, 0x4E,
+    0xAF, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9,
+    0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F,
+    0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97,
+    0x5F, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75,
+    0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9,
+    0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF,
+    0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97, 0x10, 0x9F, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE1, 0x99,
+    0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA5, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72,
+    0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A,
+    0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E,
+    0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE,
+    0x72, 0xE9, 0x5A, 0xE9, 0x70, 0x9E, 0xA9, 0x19, 0xFF, 0xC4, 0xAF, 0xF0, 0xAF, 0xFC, 0x4F, 0xFC,
+    0x00, 0x77, 0x19, 0xAF, 0xFE, 0xA9, 0x2A, 0xFF, 0xFE, 0x29, 0x9F, 0x29, 0xAF, 0xC3, 0xAE, 0x5F,
+    0x92, 0xAE, 0x6E, 0xA2, 0xAE, 0x6E, 0xA2, 0xAE, 0x6A, 0xDA, 0x2A, 0xE6, 0xEA, 0x2A, 0xE6, 0xE9,
+    0x2A, 0xE5, 0x9E, 0x3A, 0xE4, 0x9E, 0x93, 0xAE, 0x99, 0x9A, 0xFA, 0x4A, 0xFF, 0xD9, 0x5A, 0xFE,
+    0xA9, 0x7A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE9, 0x71,
+    0x9F, 0xFC, 0x96, 0xAF, 0xFC, 0x96, 0x0A, 0xFF, 0xFE, 0x2F, 0xFF, 0xF2, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x2F, 0x79, 0xD9, 0x29, 0xEA, 0x7D, 0x93, 0xAE, 0xA6, 0xD9, 0x4A, 0xE9, 0x59, 0xA6,
+    0xF7, 0x7F, 0x76, 0x9F, 0x76, 0x9E, 0xA7, 0x6A, 0xE7, 0x59, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x7D, 0x3E, 0xA7, 0x0D, 0x2E, 0xA7, 0x0A, 0xD1, 0xEA, 0x71, 0xE0, 0xFF,
+    0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xF7, 0x74, 0x9F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF,
+    0xE0, 0xAE, 0xAA, 0xAA, 0xFA, 0xAA, 0xAF, 0x0A, 0xD4, 0xAE, 0x4A, 0xD0, 0xAD, 0x4A, 0xE4, 0xAD,
+    0x0A, 0xCA, 0x4A, 0xE4, 0x9D, 0x09, 0xC9, 0x4A, 0xE4, 0x9C, 0x97, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A,
+    0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x74, 0xAF, 0xFC,
+    0x97, 0x09, 0xFF, 0xD9, 0x40, 0x77, 0x79, 0xE9, 0x71, 0x9E, 0x1F, 0xD7, 0x09, 0xF9, 0xAF, 0xD9,
+    0x7F, 0x5F, 0x6A, 0xE6, 0x9E, 0x94, 0x9E, 0x97, 0xEA, 0x4E, 0xA7, 0x09, 0xE3, 0x9E, 0x72, 0xE9,
+    0x2E, 0x97, 0x29, 0xE2, 0xE7, 0x4E, 0x1A, 0xD9, 0x74, 0x9D, 0x90, 0xE7, 0x6D, 0xA9, 0xD9, 0x76,
+    0xAD, 0xAD, 0x77, 0x9F, 0xA7, 0x70, 0xF7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A,
+    0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE9, 0x75, 0xAF, 0xFC, 0x97, 0x19, 0xFF, 0xD9, 0x40, 0x7A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x75, 0x9F, 0xFA, 0x76, 0x99, 0xAE, 0x97, 0x72, 0x9D, 0xA7, 0x71, 0x99, 0xAE,
+    0x99, 0x74, 0xAF, 0xFF, 0xA9, 0x6A, 0xFC, 0xAF, 0xAF, 0xD4, 0xAE, 0xA2, 0x9D, 0xA2, 0x9F, 0x2A,
+    0xE9, 0x39, 0xDA, 0x4F, 0x1E, 0xA4, 0x9D, 0xA4, 0x9E, 0x99, 0xE5, 0x9D, 0xA5, 0xEA, 0xAE, 0x59,
+    0xDA, 0x5F, 0xAE, 0x59, 0xDA, 0x5F, 0xAE, 0x59, 0xDA, 0x5E, 0xA9, 0xE9, 0x49, 0xDA, 0x5E, 0x90,
+    0xF4, 0x9D, 0xA4, 0xF1, 0x9F, 0x39, 0xDA, 0x3A, 0xE9, 0x2A, 0xFA, 0x19, 0xDA, 0x19, 0xF9, 0x49,
+    0xFF, 0xFF, 0x70, 0x9A, 0xFF, 0xDA, 0x77, 0xAD, 0xA7, 0x73, 0x9D, 0xA7, 0x72, 0x9F, 0xA9, 0x76,
+    0xAF, 0xFA, 0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xA7, 0x0A, 0xFF, 0xC3, 0xFF, 0x1A, 0xFF, 0xA3, 0xFE,
+    0xA2, 0x9A, 0xF9, 0x69, 0xE9, 0x6A, 0xEA, 0x6A, 0xDA, 0x70, 0xF9, 0x49, 0xE7, 0x2F, 0x4E, 0x73,
+    0x9F, 0x2E, 0x97, 0x4A, 0xE9, 0x0A, 0xD9, 0x76, 0xF9, 0xDA, 0x77, 0x0F, 0xD7, 0x71, 0xAF, 0x77,
+    0x3F, 0x97, 0x71, 0xFD, 0x77, 0x0A, 0xDA, 0xF7, 0x69, 0xDA, 0x0A, 0xE9, 0x75, 0xE2, 0xF7, 0x4E,
+    0x4F, 0x72, 0xAD, 0xA4, 0x9E, 0xA7, 0x09, 0xE6, 0xF9, 0x7E, 0x70, 0xF5, 0x9E, 0xA7, 0x0A, 0xF9,
+    0x19, 0xFF, 0x4A, 0xFF, 0xAA, 0xFF, 0x4F, 0xFC, 0xA0, 0x77, 0x73, 0xE9, 0x3F, 0xFC, 0x93, 0xE1,
+    0xAE, 0x3F, 0xFA, 0x3F, 0x2E, 0x94, 0x9E, 0xA5, 0xE9, 0x2E, 0xA5, 0xE5, 0x9E, 0x3E, 0xA5, 0xE5,
+    0xAE, 0x3A, 0xE5, 0xE5, 0xAE, 0x39, 0xE5, 0xE5, 0xEA, 0x39, 0xE5, 0xE5, 0xEA, 0x4E, 0x94, 0xE5,
+    0xE9, 0x4E, 0xA4, 0xE4, 0x9E, 0x5A, 0xE4, 0xE4, 0xAE, 0x59, 0xE9, 0x3E, 0x4E, 0x96, 0xF3, 0xE3,
+    0xF7, 0x9F, 0xA9, 0x0E, 0x90, 0x9F, 0x71, 0x9F, 0xFF, 0xE7, 0x4A, 0xFF, 0xDA, 0x97, 0x71, 0x9E,
+    0x97, 0x76, 0xE7, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xE9, 0x77, 0x39, 0xFF, 0x97, 0x70, 0xFF, 0xC9,
+    0x70, 0x71, 0x99, 0x99, 0x97, 0x70, 0xAF, 0xFC, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFA, 0x92,
+    0x9F, 0xC9, 0x6A, 0xF7, 0x9F, 0x95, 0xF7, 0x19, 0xF4, 0xAE, 0x97, 0x2A, 0xE9, 0x3F, 0x73, 0x9E,
+    0xA3, 0xF7, 0x4F, 0x3E, 0xA7, 0x4F, 0x3E, 0xA7, 0x4F, 0x3E, 0xA7, 0x4F, 0x3E, 0xA7, 0x4E, 0xA3,
+    0xAE, 0x74, 0xE9, 0x39, 0xE7, 0x39, 0xE5, 0xEA, 0x72, 0xEA, 0x59, 0xE7, 0x19, 0xE7, 0xAD, 0xA7,
+    0x0E, 0x94, 0xC9, 0x1E, 0x96, 0xAD, 0xA1, 0xAC, 0x0A, 0xCA, 0x2E, 0x94, 0xAD, 0xA2, 0xD9, 0xAD,
+    0x3E, 0x92, 0xAD, 0xA3, 0xD9, 0xAD, 0xAA, 0xA9, 0xAE, 0x2E, 0x9A, 0xAA, 0xAD, 0x9A, 0xFF, 0xCA,
+    0x2F, 0xFD, 0x9A, 0xFF, 0xC3, 0x9F, 0xFC, 0x90, 0x59, 0x99, 0x77, 0x9F, 0xCA, 0x29, 0xDA, 0x5A,
+    0xFF, 0x1E, 0x94, 0x9E, 0xA1, 0xAD, 0xA0, 0xE5, 0xE9, 0x3A, 0xD9, 0xE4, 0xAE, 0x5F, 0xCA, 0x4E,
+    0x96, 0xF9, 0x4E, 0x7A, 0xE4, 0x9E, 0x70, 0xE4, 0x9E, 0x70, 0xE4, 0x9E, 0x79, 0xE4, 0x9E, 0x7A,
+    0xE5, 0xE9, 0x6F, 0x5E, 0xA5, 0xAF, 0x94, 0xAE, 0x93, 0x9D, 0xAD, 0xA5, 0xF9, 0x1A, 0xDA, 0x9E,
+    0x94, 0x9F, 0xFA, 0x1F, 0xD4, 0xFD, 0xA2, 0xAF, 0xA6, 0x99, 0x95, 0x99, 0x92, 0x59, 0xAA, 0xA9,
+    0x71, 0xAF, 0xE9, 0x6F, 0xFD, 0x94, 0xAD, 0xA3, 0xF3, 0x9E, 0x49, 0xE9, 0x2A, 0xD9, 0x5E, 0x92,
+    0xE9, 0x5E, 0x92, 0xE6, 0xE9, 0x2E, 0x6E, 0x3E, 0x59, 0xDA, 0x3E, 0x5E, 0x4E, 0x29, 0xAA, 0xD5,
+    0xE1, 0x9F, 0xCA, 0x4E, 0x2F, 0xE3, 0xE5, 0x9F, 0x2E, 0x7E, 0xA1, 0xE7, 0x9E, 0x1E, 0x70, 0xE9,
+    0x0E, 0x70, 0xE9, 0x0E, 0x70, 0xE9, 0x0E, 0x79, 0xE1, 0xE7, 0xAE, 0x1E, 0x6A, 0xE9, 0x1E, 0xA9,
+    0x91, 0x9F, 0xA2, 0xFF, 0xFA, 0x29, 0xEA, 0xFD, 0xA4, 0x9D, 0xA7, 0x49, 0xE7, 0x49, 0xE7, 0x49,
+    0xE7, 0x49, 0xE7, 0x49, 0xE7, 0x4A, 0xE7, 0x49, 0x99, 0x75, 0x77, 0x19, 0xFA, 0x69, 0xDA, 0x0F,
+    0xD6, 0x9E, 0x2A, 0xEA, 0x5A, 0xE3, 0xF5, 0xAE, 0x39, 0xE9, 0x4A, 0xE4, 0xEA, 0x4E, 0xA4, 0x9E,
+    0x4E, 0x6E, 0x93, 0xE6, 0xAD, 0xA2, 0xAD, 0x97, 0xE2, 0xE7, 0x0E, 0x91, 0xDA, 0x70, 0x9D, 0xA0,
+    0xAD, 0x72, 0xDA, 0x0D, 0xA7, 0x2E, 0xAD, 0x73, 0xAF, 0x97, 0x4F, 0x75, 0xE7, 0x6A, 0xCA, 0x76,
+    0xAD, 0x76, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x59, 0xA9, 0x70, 0x69, 0xAA,
+    0xAA, 0x99, 0x7F, 0xFD, 0x5F, 0xFF, 0x3A, 0xD9, 0x39, 0xAE, 0x3E, 0x7A, 0x93, 0xE7, 0x5A, 0xE7,
+    0x5F, 0xA7, 0x39, 0xFC, 0x97, 0x3F, 0xD7, 0x09, 0xFF, 0x95, 0xAE, 0x1A, 0xFA, 0x3A, 0xE4, 0xF9,
+    0x2E, 0x6F, 0x1A, 0xDA, 0x69, 0xE9, 0x0E, 0x97, 0xEA, 0x9E, 0x70, 0xAE, 0x9E, 0x70, 0x9E, 0x9E,
+    0x70, 0x9E, 0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xEA, 0x0F, 0x7E, 0x1A, 0xEA, 0x5E, 0xA2, 0xFA, 0x3F,
+    0x4F, 0xFE, 0x6A, 0xFE, 0xA7, 0x19, 0xAA, 0x99, 0x50, 0x59, 0x99, 0x97, 0xAF, 0xE9, 0x29, 0xFF,
+    0xD2, 0xEA, 0x39, 0xD1, 0xAD, 0xA6, 0x91, 0xE9, 0x71, 0xE9, 0x71, 0x9E, 0x72, 0xAF, 0xE6, 0xFE,
+    0x5F, 0x99, 0x99, 0x4E, 0x97, 0x09, 0xE7, 0x19, 0xE7, 0x19, 0xE9, 0x7A, 0x0F, 0xA9, 0x19, 0xAE,
+    0x09, 0xFF, 0xE9, 0x19, 0xFF, 0xC9, 0x59, 0x99, 0x99, 0x30, 0x19, 0x73, 0xD7, 0x3D, 0xA5, 0x9A,
+    0xCA, 0x0F, 0xFF, 0xA0, 0xFF, 0xF1, 0x9A, 0xDA, 0xA9, 0x9E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E,
+    0xA7, 0x0A, 0xDA, 0x70, 0x9E, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xE9, 0x71, 0xE7, 0x1A,
+    0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x2E, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x1F, 0x71, 0xFA, 0x70, 0x9F,
+    0xCA, 0xA9, 0x5A, 0xFF, 0xCA, 0x39, 0xFF, 0xD5, 0x99, 0xAF, 0xC7, 0x1A, 0xE7, 0x19, 0xDA, 0x71,
+    0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x77, 0x72, 0x99, 0x94, 0xAE, 0x92, 0xFD, 0xA1, 0xFD, 0x09, 0xFF,
+    0xA0, 0x99, 0xAE, 0x0E, 0xA9, 0xAF, 0x3A, 0xDA, 0xD4, 0xE9, 0x29, 0xF5, 0xAD, 0xA3, 0xF5, 0xAE,
+    0x3E, 0x95, 0x9E, 0x3E, 0x95, 0x9E, 0x3E, 0x69, 0xE3, 0xE6, 0x9E, 0x3E, 0x69, 0xE3, 0xE6, 0x9E,
+    0x3E, 0x69, 0xE3, 0xE6, 0x9E, 0x3E, 0x69, 0xE3, 0xE6, 0x9E, 0x3E, 0x69, 0xE7, 0x59, 0xE7, 0x59,
+    0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5A, 0xE7, 0x5A, 0xDA, 0x75, 0x99, 0x90, 0x59, 0xAA,
+    0xAA, 0x71, 0x9F, 0xF6, 0x9F, 0xFD, 0x49, 0xE9, 0x29, 0xF3, 0xE9, 0x49, 0xE9, 0x2E, 0x6F, 0x1A,
+    0xD9, 0x69, 0xE1, 0xE7, 0x0E, 0x90, 0xE7, 0x0E, 0xA0, 0xE7, 0x0A, 0xDA, 0x9E, 0x70, 0x9E, 0x9E,
+    0x99, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0xE7, 0x09, 0xE9, 0xE7, 0x09,
+    0xE9, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE9, 0x7A, 0xD9, 0x0E, 0xA7, 0xE1, 0xAE, 0x7E,
+    0x2E, 0x95, 0x9D, 0xA2, 0xF5, 0xE4, 0xF9, 0x19, 0xEA, 0x49, 0xFF, 0xCA, 0x7F, 0xE9, 0x72, 0x99,
+    0x99, 0x50, 0x71, 0xE4, 0x9E, 0x49, 0xE4, 0x9E, 0x49, 0xE4, 0x9E, 0x49, 0xE4, 0x9E, 0x49, 0xE4,
+    0x9E, 0x49, 0xE4, 0x9E, 0x49, 0xE4, 0x9E, 0x5F, 0x91, 0x90, 0xFF, 0x09, 0xFD, 0x39, 0x99, 0x20,
+    0x77, 0x2E, 0x69, 0xE3, 0xE5, 0xFC, 0x3E, 0x4F, 0xC9, 0x3E, 0x3F, 0x95, 0xE2, 0xAE, 0x7E, 0x19,
+    0xE7, 0x0E, 0x1E, 0x71, 0xE0, 0xF7, 0x1E, 0xAF, 0x71, 0xFC, 0x9D, 0xA7, 0x0F, 0x90, 0xE7, 0x0E,
+    0xA1, 0xAD, 0x97, 0xE3, 0xE7, 0xE3, 0xF6, 0xE3, 0x9F, 0x91, 0x91, 0xE4, 0xAF, 0xE1, 0xDA, 0x5A,
+    0xFC, 0x97, 0x49, 0x99, 0x20, 0x2A, 0xAA, 0x97, 0x5A, 0xFD, 0x74, 0xFF, 0x77, 0xAE, 0x97, 0x7F,
+    0x77, 0x0E, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xE7, 0x79, 0xE9, 0x76, 0xFA, 0x76, 0xFC, 0x75,
+    0xAF, 0xC9, 0x74, 0xD9, 0xAD, 0xA7, 0x39, 0xD1, 0xE7, 0x3E, 0x1E, 0x72, 0x9D, 0xA1, 0xAD, 0xA7,
+    0x1E, 0x91, 0x9E, 0x71, 0xE3, 0xE7, 0x0A, 0xDA, 0x3E, 0x97, 0xE9, 0x3A, 0xDA, 0x6A, 0xE4, 0x9E,
+    0x6E, 0xA5, 0xEA, 0x4A, 0xE9, 0x5F, 0xA9, 0x91, 0xF6, 0x9F, 0xD9, 0x9E, 0x70, 0xFC, 0x92, 0x97,
+    0x29, 0x93, 0x77, 0x5A, 0xD9, 0x6A, 0xD9, 0x5E, 0x96, 0xE9, 0x5E, 0x96, 0xE9, 0x5E, 0x7E, 0x95,
+    0xE7, 0xE9, 0x5E, 0x7E, 0x95, 0xE7, 0xE9, 0x5E, 0x7E, 0x95, 0xE7, 0xE9, 0x5E, 0x7E, 0x95, 0xE6,
+    0x9E, 0x95, 0xE9, 0x5A, 0xE9, 0x5E, 0xA5, 0xFA, 0x5F, 0x93, 0x9F, 0xC5, 0xFC, 0xA1, 0xAE, 0x9E,
+    0x19, 0x1F, 0xFE, 0x1F, 0xD0, 0x9D, 0x9A, 0xFD, 0x2A, 0xF9, 0x09, 0xDA, 0x19, 0x99, 0x59, 0x99,
+    0x29, 0xDA, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x0A, 0xE7, 0x70,
+    0x99, 0x97, 0x71, 0x77, 0x19, 0xFA, 0x69, 0xDA, 0x0F, 0xD6, 0x9E, 0x2A, 0xEA, 0x5A, 0xE3, 0xF5,
+    0xAE, 0x39, 0xE9, 0x4A, 0xE4, 0xEA, 0x4E, 0xA4, 0x9E, 0x4E, 0x6E, 0x93, 0xE6, 0xAD, 0xA2, 0xAD,
+    0x97, 0xE2, 0xE7, 0x0E, 0x91, 0xDA, 0x70, 0x9D, 0xA0, 0xAD, 0x72, 0xDA, 0x0D, 0xA7, 0x2E, 0xAD,
+    0x73, 0xAF, 0x97, 0x4F, 0x75, 0xE7, 0x77, 0x00, 0x19, 0x73, 0xD7, 0x3D, 0x95, 0x9A, 0xC1, 0xFF,
+    0xF1, 0xFF, 0xE9, 0x29, 0xAA, 0x9A, 0xEA, 0x69, 0xEA, 0x79, 0xE7, 0x1E, 0x71, 0xAD, 0xA7, 0x1A,
+    0xDA, 0x71, 0x9E, 0x72, 0xEA, 0x72, 0xFC, 0xAA, 0x7F, 0xDA, 0x4A, 0xFE, 0x93, 0xAE, 0x97, 0x9E,
+    0x71, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0x2E, 0x97, 0x1F, 0xA7, 0x1F, 0xCA, 0xA9, 0x6F,
+    0xFC, 0xA4, 0x9F, 0xFA, 0x69, 0xAF, 0xA7, 0x1E, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71,
+    0xDA, 0x77, 0x69, 0x99, 0x97, 0x2A, 0xFE, 0x95, 0x9F, 0xFD, 0x93, 0x9E, 0xA2, 0xAF, 0x92, 0xE9,
+    0x49, 0xF1, 0xAD, 0xA6, 0xAE, 0x90, 0xE9, 0x7E, 0xA0, 0xE7, 0x0E, 0xA9, 0xE7, 0x0A, 0xE9, 0xE7,
+    0x0A, 0xE9, 0xE7, 0x0A, 0xDA, 0x9E, 0x70, 0xAD, 0xA0, 0xEA, 0x7E, 0x90, 0xF7, 0xE1, 0xAE, 0xA5,
+    0xAD, 0xA2, 0xFA, 0x3A, 0xE4, 0xFF, 0xE6, 0xAF, 0xEA, 0x71, 0x9A, 0xA9, 0x95, 0x77, 0x39, 0x1F,
+    0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xDA, 0x0F, 0xFF, 0xFE, 0x90, 0xD9, 0x1A, 0xD4, 0xD9, 0x4C, 0xA2,
+    0xAD, 0x39, 0xD7, 0x2E, 0x39, 0xD7, 0x2E, 0x39, 0xD7, 0x2D, 0xA3, 0xAD, 0x72, 0xDA, 0x3A, 0xD7,
+    0x19, 0xDA, 0x3A, 0xD7, 0x1A, 0xDA, 0x3A, 0xD7, 0x1A, 0xD9, 0x3A, 0xD9, 0x70, 0xE9, 0x3A, 0xDA,
+    0x70, 0xE4, 0xAE, 0x70, 0xE4, 0x9F, 0xAA, 0xA3, 0x9E, 0x5F, 0xE3, 0xAD, 0xA5, 0x9F, 0xA7, 0x75,
+    0x59, 0x99, 0x97, 0x1A, 0xFE, 0x95, 0xFF, 0xDA, 0x3F, 0x91, 0x9F, 0x91, 0xAE, 0x5F, 0x1E, 0x96,
+    0xE9, 0x9E, 0x7E, 0xA9, 0xE7, 0xEA, 0xAE, 0x7A, 0xEA, 0xDA, 0x7A, 0xDA, 0xAD, 0xA7, 0xAD, 0xAA,
+    0xDA, 0x7E, 0x9A, 0xDA, 0x7E, 0x0A, 0xDA, 0x6A, 0xE0, 0xAD, 0xA5, 0x9E, 0x1A, 0xEA, 0x99, 0x99,
+    0xAE, 0xA1, 0xAF, 0xFE, 0x92, 0xAD, 0xAF, 0xDA, 0x4A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xDA, 0x73,
+    0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x39, 0x99, 0x74, 0x79, 0x99, 0x70, 0xAF, 0xDA,
+    0x49, 0xFF, 0xD3, 0xE9, 0x2A, 0xE9, 0x1E, 0x94, 0xEA, 0x09, 0xDA, 0x59, 0xD1, 0xE9, 0x69, 0x2E,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x73, 0xEA, 0x72, 0xF7, 0x2A, 0xF7, 0x2F, 0xD9,
+    0x97, 0xFF, 0xCA, 0x5A, 0xFF, 0x97, 0x9A, 0xFA, 0x72, 0xE9, 0x72, 0xE7, 0x3D, 0xA7, 0x29, 0xD7,
+    0x3D, 0x97, 0x71, 0x77, 0x70, 0x9A, 0xFF, 0xDA, 0x3A, 0xFF, 0xFC, 0x92, 0xFA, 0xAA, 0xFA, 0xE2,
+    0xF4, 0xE9, 0x49, 0xE6, 0xE4, 0xEA, 0x6A, 0xDA, 0x3E, 0x79, 0xE2, 0x9E, 0x70, 0xE2, 0x9E, 0x70,
+    0xE9, 0x19, 0xE7, 0x0E, 0x91, 0x9E, 0x70, 0xE9, 0x2E, 0x97, 0xE3, 0xF6, 0xAE, 0x3A, 0xE9, 0x5E,
+    0x94, 0xFA, 0x29, 0xEA, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0x97, 0x39, 0xAA, 0x99, 0x70, 0x77, 0x2F,
+    0xFF, 0xD9, 0x0A, 0xFF, 0xFD, 0x90, 0xFF, 0xFE, 0x1D, 0x3E, 0x7C, 0xA3, 0xDA, 0x75, 0xDA, 0x74,
+    0x9D, 0x97, 0x49, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD,
+    0xA7, 0x4A, 0xE7, 0x49, 0xF9, 0x19, 0x70, 0xFF, 0x70, 0x9F, 0xD9, 0x72, 0x99, 0x94, 0x77, 0x2A,
+    0xFC, 0x5A, 0xD1, 0x9F, 0xCA, 0x59, 0xDA, 0x29, 0xAD, 0xA6, 0xE3, 0xAD, 0xA6, 0xE9, 0x2A, 0xDA,
+    0x6E, 0xA2, 0xE9, 0x6A, 0xDA, 0x2E, 0x96, 0xAD, 0xA2, 0xE9, 0x6A, 0xE2, 0xEA, 0x6A, 0xE2, 0xEA,
+    0x6A, 0xDA, 0x2E, 0xA6, 0xAD, 0xA2, 0xAE, 0x6E, 0x92, 0x9E, 0x6E, 0x4E, 0x94, 0xAD, 0xA4, 0xAE,
+    0x92, 0xAE, 0x6F, 0xFD, 0x70, 0xAF, 0xE7, 0x39, 0xAA, 0x95, 0x77, 0x77, 0x3A, 0xD7, 0x75, 0xE7,
+    0x75, 0xE7, 0x75, 0xE7, 0x75, 0xE7, 0x73, 0x99, 0xE9, 0x97, 0x6A, 0xFF, 0xEA, 0x97, 0x0A, 0xFF,
+    0xFF, 0x6F, 0xA9, 0x1E, 0x19, 0xFC, 0x4F, 0x4E, 0x39, 0xF2, 0x9E, 0x5E, 0x49, 0xE9, 0x1E, 0x95,
+    0xE5, 0xF1, 0xE6, 0xE5, 0x9E, 0x09, 0xE6, 0xE6, 0xE0, 0x9E, 0x6E, 0x6E, 0x09, 0xE6, 0xE6, 0xE0,
+    0x9E, 0x6E, 0x59, 0xE1, 0xEA, 0x5E, 0x5A, 0xDA, 0x1A, 0xE5, 0xE5, 0xE3, 0xF9, 0x3E, 0x39, 0xEA,
+    0x39, 0xFA, 0x91, 0xE1, 0x9A, 0xF5, 0x9F, 0xFF, 0xFA, 0x70, 0x9F, 0xFF, 0xA7, 0x69, 0xAE, 0x99,
+    0x77, 0x3E, 0x77, 0x5E, 0x77, 0x5E, 0x77, 0x5E, 0x77, 0x5E, 0x77, 0x49, 0xE7, 0x75, 0x99, 0x73,
+    0x77, 0x3A, 0xF6, 0x9E, 0x2F, 0xCA, 0x5E, 0xA3, 0x9F, 0x4A, 0xE6, 0xE9, 0x3E, 0x96, 0xAE, 0x2A,
+    0xDA, 0x70, 0xE2, 0xE7, 0x1A, 0xDA, 0x09, 0xD9, 0x72, 0xE0, 0xE7, 0x3A, 0xDA, 0xD7, 0x5F, 0xA7,
+    0x5F, 0x76, 0x9E, 0x76, 0xAE, 0x97, 0x5F, 0xC7, 0x4A, 0xCA, 0xE9, 0x72, 0x9D, 0x09, 0xE7, 0x2E,
+    0x1E, 0x97, 0x09, 0xD9, 0x19, 0xE7, 0x0E, 0x3E, 0x96, 0xAD, 0xA3, 0xAE, 0x59, 0xE5, 0xE9, 0x4E,
+    0xA5, 0xF3, 0xAE, 0x69, 0xFA, 0x99, 0xEA, 0x7F, 0xCA, 0x09, 0xAA, 0x70, 0x9A, 0xAA, 0x90, 0x77,
+    0x77, 0x6D, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75,
+    0xAD, 0xA7, 0x2A, 0xFC, 0x4A, 0xDA, 0x39, 0xD9, 0x19, 0xFC, 0xA4, 0xAD, 0xA4, 0xE4, 0xAD, 0xA4,
+    0xAD, 0xA4, 0xE9, 0x3A, 0xDA, 0x4A, 0xDA, 0x4E, 0xA3, 0xAD, 0xA4, 0xAD, 0xA4, 0xAE, 0x3E, 0x94,
+    0xAD, 0xA4, 0xAE, 0x3E, 0x94, 0xAD, 0xA4, 0x9E, 0x3E, 0x94, 0xAD, 0xA4, 0x9E, 0x3E, 0xA4, 0xAD,
+    0xA4, 0x9E, 0x3E, 0xA4, 0xAD, 0xA4, 0xAE, 0x3F, 0x4A, 0xDA, 0x4E, 0xA3, 0xAE, 0x4A, 0xDA, 0x4E,
+    0x5E, 0xA3, 0xAD, 0xA3, 0xAE, 0x5A, 0xE9, 0x2A, 0xDA, 0x2A, 0xE7, 0xFA, 0x90, 0xAD, 0xA0, 0x9F,
+    0x97, 0x0F, 0xFF, 0xE9, 0x72, 0x9F, 0xFE, 0x97, 0x79, 0x9F, 0x97, 0x74, 0xAD, 0xA7, 0x75, 0xAD,
+    0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0x97, 0x75, 0x99, 0x73,
+    0x77, 0x72, 0xAD, 0x70, 0x9D, 0xA5, 0xAD, 0x97, 0x1E, 0xA3, 0x9E, 0x73, 0xE9, 0x2E, 0x97, 0x3F,
+    0x19, 0xE5, 0x99, 0x49, 0xE1, 0xAD, 0xA4, 0xE9, 0x4E, 0x90, 0xE9, 0x4E, 0x94, 0xEA, 0x0E, 0x94,
+    0xE9, 0x4A, 0xE0, 0xE5, 0xE9, 0x4A, 0xE9, 0xE5, 0xAD, 0x94, 0xAE, 0x9E, 0x5A, 0xD9, 0x4A, 0xE0,
+    0xE9, 0x4E, 0xA4, 0xAD, 0xA0, 0xEA, 0x4F, 0x4E, 0x90, 0xAE, 0x39, 0xF4, 0xE2, 0xF2, 0xDA, 0xE2,
+    0xEA, 0x2A, 0xFF, 0x09, 0xFF, 0x4A, 0xFD, 0x29, 0xFC, 0xA7, 0x9A, 0x99, 0x59, 0xA9, 0x40, 0x77,
+    0x77, 0x39, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7,
+    0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E,
+    0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA,
+    0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7,
+    0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9,
+    0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xEA, 0x77, 0x39, 0xF7,
+    0x73, 0x9F, 0x77, 0x4E, 0xA7, 0x75, 0x97, 0x40, 0x59, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD,
+    0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD,
+    0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD,
+    0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2,
+    0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x97, 0x77, 0x77, 0x5A, 0xDA, 0x75, 0xF7, 0x5F, 0x75, 0xAD,
+    0x97, 0x77, 0x10, 0x77, 0x77, 0x1F, 0xCA, 0x77, 0x1F, 0xF7, 0x7A, 0xD9, 0x1E, 0x97, 0x69, 0xD2,
+    0xAD, 0x77, 0x49, 0xDA, 0x77, 0x29, 0xEA, 0x77, 0x3D, 0xA7, 0x75, 0xAC, 0x97, 0x76, 0x97, 0x77,
+    0x77, 0x70, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA,
+    0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76,
+    0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE,
+    0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE,
+    0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x59, 0xA9, 0x74, 0xAF, 0xCA, 0x71, 0x9E, 0xAE,
+    0xA7, 0x0E, 0x2E, 0x70, 0x9C, 0x92, 0xDA, 0x75, 0x9D, 0x97, 0x39, 0xAD, 0x97, 0x39, 0xDA, 0x76,
+    0xD7, 0x79, 0x97, 0x77, 0x71, 0x99, 0x99, 0x73, 0xAF, 0xDA, 0x79, 0xFF, 0xD5, 0x9E, 0x92, 0xAE,
+    0x5E, 0xA4, 0xE9, 0x4A, 0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD, 0xA7, 0x5A, 0xDA, 0x72, 0x99, 0x9E,
+    0xA6, 0x9A, 0xFF, 0xA5, 0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xAD,
+    0xA3, 0x9E, 0x5E, 0xA4, 0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF, 0xF9, 0xFD, 0x2A, 0xFD, 0x90, 0x9F,
+    0x59, 0x99, 0x59, 0x30, 0x77, 0x77, 0x72, 0xCA, 0x77, 0x59, 0xD9, 0x77, 0x4E, 0x77, 0x4A, 0xD7,
+    0x70, 0x99, 0x2D, 0x77, 0x0F, 0x90, 0x97, 0x70, 0xFD, 0x97, 0x70, 0xAD, 0x90, 0xE7, 0x7A, 0xD9,
+    0x2E, 0x76, 0xAA, 0x94, 0xA9, 0x77, 0x77, 0x73, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72,
+    0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1,
+    0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73,
+    0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E,
+    0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x75, 0x97,
+    0x7A, 0xCA, 0x76, 0xE7, 0x5A, 0xD9, 0x75, 0xDA, 0x75, 0xAD, 0x76, 0xD7, 0x19, 0xE9, 0x73, 0x9F,
+    0xCA, 0x72, 0xEA, 0xEA, 0x70, 0xE9, 0x1E, 0x96, 0xE9, 0x3D, 0xA6, 0xAA, 0x6A, 0x77, 0x75, 0x99,
+    0x99, 0x73, 0xAF, 0xDA, 0x79, 0xFF, 0xD5, 0x9E, 0x92, 0xAE, 0x5E, 0xA4, 0xE9, 0x4A, 0xD9, 0x4A,
+    0xDA, 0x59, 0x95, 0xAD, 0xA7, 0x5A, 0xDA, 0x72, 0x99, 0x9E, 0xA6, 0x9A, 0xFF, 0xA5, 0xFE, 0xAE,
+    0xA4, 0xF9, 0x3A, 0xDA, 0x4E, 0x5A, 0xDA, 0x39, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0xA4, 0xF9, 0x19,
+    0xFC, 0xA9, 0x91, 0xAF, 0xF9, 0xFD, 0x2A, 0xFD, 0x90, 0x9F, 0x59, 0x99, 0x59, 0x30, 0x77, 0x77,
+    0x6D, 0x77, 0x59, 0xD9, 0x77, 0x5E, 0x77, 0x6D, 0xA7, 0x71, 0x99, 0x2D, 0x77, 0x0F, 0x91, 0x97,
+    0x7F, 0xD9, 0x77, 0x0A, 0xD9, 0x0E, 0x77, 0xAD, 0x92, 0xE7, 0x6A, 0xA9, 0x4A, 0x97, 0x77, 0x77,
+    0x39, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71,
+    0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E,
+    0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF,
+    0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E,
+    0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A,
+    0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC0, 0x77, 0x71, 0xAC, 0xA7, 0x6E, 0x76, 0xAD, 0xA7, 0x6E, 0x77,
+    0xDA, 0x77, 0xD7, 0x19, 0xE9, 0x74, 0xFC, 0x97, 0x2E, 0xAE, 0x97, 0x0E, 0x91, 0xE9, 0x6E, 0x93,
+    0xDA, 0x6A, 0xA6, 0xA7, 0x77, 0x59, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A,
+    0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99,
+    0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A,
+    0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09,
+    0xF5, 0x99, 0x95, 0x93, 0x77, 0x77, 0x79, 0xF9, 0x77, 0x19, 0xD9, 0xAD, 0x77, 0x2C, 0xA1, 0xD7,
+    0x75, 0xAC, 0xA7, 0x73, 0x9D, 0x97, 0x6F, 0x2C, 0xA7, 0x6A, 0xFC, 0x97, 0x70, 0xAD, 0x90, 0xE9,
+    0x76, 0xAD, 0x92, 0xE7, 0x6A, 0xA5, 0xA9, 0x77, 0x77, 0x73, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F,
+    0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97,
+    0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5,
+    0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E,
+    0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00,
+    0x72, 0x99, 0x99, 0x74, 0xFD, 0x72, 0xAD, 0x99, 0xDA, 0x71, 0x9C, 0x91, 0xE7, 0x59, 0xD9, 0x74,
+    0xAD, 0x97, 0x49, 0xD7, 0x1A, 0xAC, 0x91, 0xAA, 0x70, 0xFC, 0xA7, 0x2E, 0xAE, 0xA7, 0x0A, 0xDA,
+    0x1E, 0xA6, 0xAD, 0x93, 0xE6, 0x9A, 0x95, 0xA9, 0x77, 0x74, 0x99, 0x99, 0x73, 0xAF, 0xDA, 0x79,
+    0xFF, 0xD5, 0x9E, 0x92, 0xAE, 0x5E, 0xA4, 0xE9, 0x4A, 0xD9, 0x4A, 0xDA, 0x59, 0x95, 0xAD, 0xA7,
+    0x5A, 0xDA, 0x72, 0x99, 0x9E, 0xA6, 0x9A, 0xFF, 0xA5, 0xFE, 0xAE, 0xA4, 0xF9, 0x3A, 0xDA, 0x4E,
+    0x5A, 0xDA, 0x39, 0xE5, 0xAD, 0xA3, 0x9E, 0x5E, 0xA4, 0xF9, 0x19, 0xFC, 0xA9, 0x91, 0xAF, 0xF9,
+    0xFD, 0x2A, 0xFD, 0x90, 0x9F, 0x59, 0x99, 0x59, 0x30, 0x77, 0x77, 0x9F, 0x2C, 0xA7, 0x6F, 0xD0,
+    0x9C, 0xA7, 0x6D, 0x1F, 0xCA, 0x76, 0x99, 0x2A, 0xDA, 0x77, 0x77, 0x73, 0xAE, 0x77, 0x3A, 0xFC,
+    0x77, 0x1A, 0xD9, 0x0E, 0x77, 0xAD, 0x92, 0xE7, 0x6A, 0xA5, 0xA9, 0x77, 0x77, 0x73, 0x9D, 0x77,
+    0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x1D, 0xA9, 0xE7,
+    0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3, 0xEA, 0x75, 0xDA,
+    0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF,
+    0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70, 0xE7, 0x1E, 0x96,
+    0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95, 0xAF, 0xF0, 0xFF,
+    0x94, 0x9F, 0xFC, 0x00, 0x39, 0x97, 0x6F, 0xA1, 0x9C, 0x7A, 0xFC, 0xA9, 0xD7, 0xAC, 0x90, 0xAF,
+    0xC7, 0x9C, 0x2A, 0xE9, 0x77, 0x75, 0x9A, 0xA9, 0x74, 0xFC, 0xA7, 0x2A, 0xDA, 0xF7, 0x0A, 0xDA,
+    0x1F, 0x6A, 0xD9, 0x3A, 0xD6, 0x9A, 0x6A, 0x97, 0x77, 0x49, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F,
+    0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75,
+    0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5,
+    0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F,
+    0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93, 0x77, 0x77, 0x2A, 0xDA, 0x77, 0x39, 0xFC, 0x77,
+    0x19, 0xFE, 0x77, 0x0E, 0x1A, 0xDA, 0x76, 0xE3, 0xAD, 0x97, 0x5C, 0xA5, 0xAA, 0x77, 0x77, 0x77,
+    0x77, 0x49, 0xD7, 0x74, 0x9E, 0xA7, 0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7,
+    0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1, 0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E,
+    0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74, 0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA,
+    0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7,
+    0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71, 0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9,
+    0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xEA, 0x77, 0x39, 0xF7,
+    0x73, 0x9F, 0x77, 0x4E, 0xA7, 0x75, 0x97, 0x40, 0x79, 0x76, 0xE9, 0x74, 0xFC, 0x97, 0x29, 0xFD,
+    0x72, 0xE0, 0xAD, 0xA7, 0x0A, 0xD2, 0xAD, 0x96, 0x9D, 0x93, 0xDA, 0x7A, 0x95, 0x97, 0x77, 0x59,
+    0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94,
+    0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA,
+    0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91,
+    0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x97, 0x77, 0x77,
+    0x5A, 0xDA, 0x75, 0xF7, 0x5F, 0x75, 0xAD, 0x97, 0x77, 0x10, 0x77, 0x77, 0x5C, 0x97, 0x75, 0xAD,
+    0x77, 0x5E, 0x77, 0x4E, 0x77, 0x1C, 0x91, 0xCA, 0x2A, 0x75, 0x9D, 0x94, 0xD7, 0x6E, 0xA9, 0x9A,
+    0xDA, 0x76, 0xAF, 0xF7, 0x70, 0x9A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x69, 0xD7, 0x74, 0x9E, 0xA7,
+    0x73, 0xFC, 0x77, 0x29, 0xFC, 0x97, 0x71, 0xAD, 0xAD, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x0A, 0xD1,
+    0xE9, 0x77, 0xDA, 0x1A, 0xE7, 0x69, 0xD9, 0x19, 0xE7, 0x6E, 0x3E, 0xA7, 0x5D, 0xA3, 0xAE, 0x74,
+    0xAD, 0x5E, 0x97, 0x3E, 0x5E, 0xA7, 0x29, 0xEA, 0xAA, 0xAA, 0xAF, 0x72, 0xFF, 0xFD, 0x97, 0x09,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7, 0x0A, 0xD9, 0x7A, 0xE7, 0x0E, 0x71, 0xE9, 0x6A, 0xD9, 0x71,
+    0xF6, 0xE7, 0x29, 0xE5, 0x9E, 0x72, 0x9E, 0xA2, 0x9F, 0xE9, 0x5A, 0xFF, 0x0F, 0xF9, 0x49, 0xFF,
+    0xC0, 0x77, 0x72, 0xC9, 0x76, 0xAD, 0x75, 0x9E, 0x75, 0xE9, 0x74, 0x9D, 0x97, 0x6A, 0x73, 0x9C,
+    0x6A, 0x96, 0xE4, 0xAC, 0xA6, 0x9E, 0xA9, 0xAE, 0x70, 0xAF, 0xE9, 0x71, 0x9A, 0xEA, 0x77, 0x77,
+    0x77, 0x19, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94,
+    0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA,
+    0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA,
+    0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93,
+    0x77, 0x77, 0x2A, 0xA7, 0x75, 0x9D, 0x77, 0x6E, 0x77, 0x59, 0xD9, 0x77, 0x1C, 0x91, 0x9C, 0xA1,
+    0xA7, 0x59, 0xD9, 0x4D, 0x76, 0xEA, 0x99, 0xAD, 0xA7, 0x6A, 0xFF, 0x77, 0x09, 0xAF, 0x97, 0x77,
+    0x77, 0x77, 0x76, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA,
+    0xDA, 0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E,
+    0x76, 0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97,
+    0xAE, 0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29,
+    0xFE, 0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x77, 0x6A, 0xC7, 0x69, 0xDA, 0x76, 0xE9,
+    0x75, 0x9E, 0x76, 0x9D, 0x97, 0x7A, 0x72, 0x9C, 0x6A, 0x96, 0xE4, 0xAC, 0xA6, 0x9E, 0xA9, 0xAE,
+    0x70, 0xAF, 0xE9, 0x71, 0x9A, 0xEA, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0x9F,
+    0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA, 0x75,
+    0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4, 0xE5,
+    0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF, 0x9F,
+    0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93, 0x73, 0x97, 0x74, 0x9F, 0x97, 0x72, 0xD9, 0xAD,
+    0x77, 0x2C, 0xA1, 0xD9, 0x77, 0x4A, 0xD7, 0x74, 0xDA, 0x77, 0x19, 0x91, 0xD2, 0xA7, 0x6D, 0x94,
+    0xD7, 0x6F, 0xAA, 0xAD, 0x97, 0x7F, 0xE9, 0x77, 0x19, 0xAA, 0xA9, 0x77, 0x77, 0x76, 0x9D, 0x77,
+    0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77, 0x1D, 0xA9, 0xE7,
+    0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3, 0xEA, 0x75, 0xDA,
+    0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xF7, 0x2F, 0xFF,
+    0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70, 0xE7, 0x1E, 0x96,
+    0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95, 0xAF, 0xF0, 0xFF,
+    0x94, 0x9F, 0xFC, 0x00, 0x69, 0x97, 0x5F, 0xCA, 0x72, 0xEA, 0xE9, 0x71, 0xD9, 0x1D, 0xA7, 0x29,
+    0x19, 0xD9, 0x74, 0xAD, 0xA7, 0x4A, 0xD7, 0x69, 0xCA, 0x72, 0x9C, 0x6A, 0x96, 0xE4, 0xAC, 0xA6,
+    0x9E, 0xA9, 0xAE, 0x70, 0xAF, 0xE9, 0x71, 0x9A, 0xEA, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A,
+    0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99,
+    0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93,
+    0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99,
+    0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93, 0x77, 0x77, 0x0F, 0x91, 0x9C,
+    0x76, 0x9F, 0xC9, 0x0D, 0x76, 0xAC, 0x90, 0xAF, 0xC7, 0x7A, 0x29, 0xE7, 0x77, 0x09, 0x76, 0xAC,
+    0x6C, 0xA7, 0x5E, 0x92, 0x9D, 0x97, 0x5A, 0xFF, 0xC7, 0x79, 0xFD, 0xA7, 0x73, 0x99, 0x77, 0x77,
+    0x77, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA, 0x77,
+    0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76, 0xE3,
+    0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE, 0x70,
+    0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE, 0x95,
+    0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x00, 0x39, 0x97, 0x6F, 0x91, 0xAC, 0x79, 0xFC, 0x90, 0xD7,
+    0xAC, 0x90, 0xFD, 0x79, 0xC2, 0xAE, 0x97, 0x69, 0x71, 0xAA, 0x6A, 0x96, 0xD9, 0x4A, 0xCA, 0x6F,
+    0xA9, 0xAE, 0x79, 0xFF, 0x97, 0x1A, 0xFA, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A, 0xFD, 0xA7,
+    0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99, 0x5A, 0xDA,
+    0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93, 0xAD, 0xA4,
+    0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99, 0x1A, 0xFF,
+    0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x93, 0x77, 0x77, 0xA9, 0x6C, 0x75, 0x9D, 0x94,
+    0xD7, 0x59, 0xEA, 0x99, 0x9E, 0x76, 0xAF, 0xF7, 0x70, 0x9F, 0xCA, 0x77, 0x49, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0x9D, 0x77, 0x49, 0xEA, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xC9, 0x77, 0x1A, 0xDA, 0xDA,
+    0x77, 0x1D, 0xA9, 0xE7, 0x70, 0xAD, 0x1E, 0x97, 0x7D, 0xA1, 0xAE, 0x76, 0x9D, 0x91, 0x9E, 0x76,
+    0xE3, 0xEA, 0x75, 0xDA, 0x3A, 0xE7, 0x4A, 0xD5, 0xE9, 0x73, 0xE5, 0xEA, 0x72, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xF7, 0x2F, 0xFF, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x70, 0xAD, 0x97, 0xAE,
+    0x70, 0xE7, 0x1E, 0x96, 0xAD, 0x97, 0x1F, 0x6E, 0x72, 0x9E, 0x59, 0xE7, 0x29, 0xEA, 0x29, 0xFE,
+    0x95, 0xAF, 0xF0, 0xFF, 0x94, 0x9F, 0xFC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0xA7, 0x73, 0x9F,
+    0x77, 0x39, 0xF7, 0x74, 0xEA, 0x77, 0x59, 0x74, 0x77, 0x39, 0xC9, 0x5A, 0xA6, 0xE9, 0x3A, 0xCA,
+    0x69, 0xFA, 0xAE, 0x70, 0xAF, 0xE9, 0x71, 0x9A, 0xEA, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A,
+    0xFD, 0xA7, 0x9F, 0xFD, 0x59, 0xE9, 0x2A, 0xE5, 0xEA, 0x4E, 0x94, 0xAD, 0x94, 0xAD, 0xA5, 0x99,
+    0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x29, 0x99, 0xEA, 0x69, 0xAF, 0xFA, 0x5F, 0xEA, 0xEA, 0x4F, 0x93,
+    0xAD, 0xA4, 0xE5, 0xAD, 0xA3, 0x9E, 0x5A, 0xDA, 0x39, 0xE5, 0xEA, 0x4F, 0x91, 0x9F, 0xCA, 0x99,
+    0x1A, 0xFF, 0x9F, 0xD2, 0xAF, 0xD9, 0x09, 0xF5, 0x99, 0x95, 0x97, 0x77, 0x77, 0x5A, 0xDA, 0x75,
+    0xF7, 0x5F, 0x75, 0xAD, 0x97, 0x77, 0x10, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70,
+    0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF,
+    0xFF, 0xC7, 0x77, 0x77, 0x77, 0x71, 0xE9, 0x75, 0xAF, 0x75, 0xAF, 0x75, 0x9E, 0x97, 0x79, 0x70,
+    0x69, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD,
+    0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A,
+    0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9,
+    0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x97, 0x77, 0x77, 0x9E, 0x72, 0xF9, 0x71, 0xF7,
+    0x2A, 0xDA, 0x77, 0x30, 0x77, 0x70, 0x9F, 0xCA, 0x72, 0xAF, 0xEA, 0x71, 0xE1, 0x9E, 0x71, 0xAC,
+    0x92, 0xE7, 0x6A, 0xD9, 0x74, 0x9E, 0x97, 0x49, 0xD9, 0x77, 0xD7, 0x77, 0x77, 0x69, 0xFF, 0xFF,
+    0xA0, 0xAF, 0xFF, 0xFA, 0x19, 0x9F, 0xAA, 0xAA, 0xAA, 0xAF, 0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA,
+    0x3A, 0xE7, 0x9C, 0x93, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF,
+    0xEA, 0x5A, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19,
+    0x3A, 0xE7, 0x0A, 0xC9, 0x2A, 0xE7, 0x0D, 0xA2, 0xAE, 0x79, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA,
+    0xAE, 0x99, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x00, 0x59, 0x9A, 0x97, 0x1F, 0xD9, 0x6E, 0xAA,
+    0xE6, 0xD9, 0x19, 0xD9, 0x5D, 0x29, 0xD9, 0x72, 0xE7, 0x19, 0xE7, 0x1A, 0xD9, 0x72, 0x9C, 0xA7,
+    0x49, 0x77, 0x74, 0x99, 0x97, 0x09, 0xFE, 0x94, 0xFF, 0xD9, 0x2E, 0xA3, 0xF1, 0x9D, 0xA5, 0xE9,
+    0x0E, 0x6A, 0xDA, 0x0E, 0x69, 0xDA, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0xAF, 0xFF, 0xCA, 0xAF,
+    0xFF, 0xC9, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xF9, 0x71, 0x9F, 0xCA, 0x99,
+    0x99, 0xAC, 0x91, 0xAF, 0xFE, 0x39, 0xFF, 0xC9, 0x69, 0x99, 0x99, 0x30, 0x49, 0xDA, 0x29, 0xA7,
+    0x09, 0xFC, 0x1A, 0xCA, 0x7F, 0xFD, 0xA7, 0xDA, 0x09, 0xFC, 0x97, 0x0C, 0x3E, 0x97, 0x77, 0x77,
+    0x77, 0x59, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19, 0x9F, 0xAA, 0xAA, 0xAA, 0xAF, 0x3A, 0xE7,
+    0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A, 0xE7, 0x0D, 0xA2, 0xAE, 0x79, 0xD9, 0x2A,
+    0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x00, 0x49, 0x97, 0x29,
+    0xF2, 0xAC, 0x4F, 0xD0, 0x9D, 0x93, 0xDA, 0x9F, 0xD4, 0xD2, 0xFA, 0x59, 0x3A, 0xA9, 0x77, 0x77,
+    0x79, 0x99, 0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD,
+    0xA0, 0xE6, 0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A,
+    0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9,
+    0x1A, 0xFF, 0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93, 0x77, 0x77, 0x19, 0xC9, 0x77, 0xE7, 0x69,
+    0xDA, 0x76, 0xDA, 0x71, 0x99, 0x91, 0x9C, 0xA7, 0x19, 0xF1, 0x97, 0x19, 0xFD, 0x73, 0xE0, 0x9E,
+    0x71, 0xE2, 0x9D, 0x97, 0x9C, 0xA4, 0x9A, 0x77, 0x79, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xAF, 0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE,
+    0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x5A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A,
+    0xE7, 0x0D, 0xA2, 0xAE, 0x79, 0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0xFC, 0x00, 0x75, 0x97, 0x7D, 0x75, 0x9D, 0x97, 0x4E, 0x74, 0xAD, 0x97, 0x4D, 0x97,
+    0x5C, 0xA7, 0x0A, 0xE7, 0x3A, 0xFC, 0x71, 0x9E, 0xAE, 0x79, 0xE1, 0x9E, 0x59, 0xE3, 0x9D, 0x95,
+    0xAA, 0x59, 0xA7, 0x77, 0x39, 0x99, 0x72, 0x9F, 0xE9, 0x6F, 0xFD, 0x94, 0xEA, 0x3F, 0x39, 0xDA,
+    0x5E, 0x92, 0xE6, 0xAD, 0xA2, 0xE6, 0x9D, 0xA1, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x1A, 0xFF,
+    0xFC, 0xA1, 0xAF, 0xFF, 0xC9, 0x1A, 0xDA, 0x74, 0xAD, 0xA7, 0x49, 0xE7, 0x5E, 0x97, 0x4F, 0x97,
+    0x39, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x3A, 0xFF, 0xE5, 0x9F, 0xFC, 0x97, 0x09, 0x99, 0x99, 0x50,
+    0x77, 0x75, 0x9C, 0x97, 0x7E, 0x77, 0x9D, 0xA7, 0x7A, 0xD7, 0x39, 0x99, 0x1A, 0xCA, 0x71, 0x9F,
+    0x19, 0x71, 0x9F, 0xD7, 0x3E, 0x09, 0xE7, 0x1E, 0x29, 0xD9, 0x79, 0xCA, 0x49, 0xA7, 0x77, 0x9F,
+    0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7,
+    0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5,
+    0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE,
+    0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A,
+    0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x71, 0x97, 0x4D, 0x97, 0x29, 0xE7,
+    0x3E, 0x97, 0x3E, 0x73, 0x9D, 0x97, 0x39, 0xCA, 0x6A, 0xE1, 0x96, 0xAF, 0xC7, 0x9E, 0xAE, 0x59,
+    0xE1, 0x9E, 0x39, 0xE3, 0x9D, 0x93, 0xAA, 0x59, 0xA7, 0x77, 0x99, 0x97, 0x09, 0xFE, 0x94, 0xFF,
+    0xD9, 0x2E, 0xA3, 0xF1, 0x9D, 0xA5, 0xE9, 0x0E, 0x6A, 0xDA, 0x0E, 0x69, 0xDA, 0x9E, 0x99, 0x99,
+    0x99, 0x9A, 0xDA, 0xAF, 0xFF, 0xCA, 0xAF, 0xFF, 0xC9, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0x9E, 0x73,
+    0xE9, 0x72, 0xF9, 0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0x91, 0xAF, 0xFE, 0x39, 0xFF, 0xC9, 0x69,
+    0x99, 0x99, 0x30, 0x76, 0x97, 0x7F, 0xC7, 0x4A, 0xCA, 0x9D, 0xA7, 0x39, 0xC1, 0xAC, 0xA7, 0x7D,
+    0x97, 0x5A, 0xD7, 0x09, 0xEA, 0x19, 0xC9, 0x70, 0xFD, 0x73, 0xE0, 0x9E, 0x71, 0xE2, 0x9D, 0xA7,
+    0x9C, 0xA5, 0xA7, 0x77, 0x9F, 0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3, 0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7,
+    0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76,
+    0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93, 0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7,
+    0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA, 0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0x73,
+    0x9A, 0x97, 0x49, 0xFC, 0xA7, 0x2D, 0xA0, 0xAD, 0x97, 0x1D, 0x2D, 0x97, 0x5A, 0xD7, 0x49, 0xE7,
+    0x5A, 0xCA, 0x70, 0x9A, 0xAC, 0x2C, 0x97, 0x9F, 0xC9, 0x72, 0xEA, 0xE9, 0x70, 0xE9, 0x09, 0xE7,
+    0xE4, 0xDA, 0x6A, 0xA5, 0x9A, 0x77, 0x75, 0x99, 0x97, 0x39, 0xFE, 0x97, 0xFF, 0xD9, 0x5E, 0xA3,
+    0xF4, 0x9D, 0xA5, 0xE9, 0x3E, 0x6A, 0xDA, 0x3E, 0x69, 0xDA, 0x29, 0xE9, 0x99, 0x99, 0x99, 0xAD,
+    0xA2, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xFC, 0x92, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0x9E, 0x76, 0xE9,
+    0x75, 0xF9, 0x74, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0x94, 0xAF, 0xFE, 0x69, 0xFF, 0xC9, 0x71, 0x99,
+    0x99, 0x96, 0x77, 0x7A, 0xE9, 0x2C, 0x71, 0xFC, 0xA0, 0xAC, 0x97, 0x0C, 0xA0, 0x9F, 0xC7, 0x1A,
+    0x29, 0xE9, 0x77, 0x77, 0xEA, 0x75, 0xFC, 0xA7, 0x3E, 0x09, 0xDA, 0x71, 0xE2, 0x9D, 0xA7, 0x9C,
+    0xA4, 0x9A, 0x77, 0x79, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xFA, 0x19, 0x9F, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x3A, 0xE7, 0xE3, 0xAE, 0x7A, 0xCA, 0x3A, 0xE7, 0x9C, 0x93, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76,
+    0xAE, 0x76, 0xAF, 0xFF, 0x5A, 0xFF, 0xEA, 0x5A, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x19, 0x3A, 0xE7, 0x0A, 0xC9, 0x2A, 0xE7, 0x0D, 0xA2, 0xAE, 0x79,
+    0xD9, 0x2A, 0xE9, 0x99, 0xAA, 0xAA, 0xAE, 0x99, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x00, 0x49,
+    0x97, 0x29, 0xF9, 0x1A, 0xA4, 0xFD, 0x99, 0xD4, 0xD1, 0xFC, 0xA4, 0xAA, 0x2F, 0x77, 0x70, 0xAA,
+    0xA7, 0x2F, 0xC9, 0x7E, 0xAE, 0xA5, 0xE1, 0x9E, 0x93, 0xE4, 0xE3, 0xAA, 0x6A, 0x77, 0x79, 0x99,
+    0x70, 0x9F, 0xE9, 0x4F, 0xFD, 0x92, 0xEA, 0x3F, 0x19, 0xDA, 0x5E, 0x90, 0xE6, 0xAD, 0xA0, 0xE6,
+    0x9D, 0xA9, 0xE9, 0x99, 0x99, 0x99, 0xAD, 0xAA, 0xFF, 0xFC, 0xAA, 0xFF, 0xFC, 0x9A, 0xDA, 0x72,
+    0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2F, 0x97, 0x19, 0xFC, 0xA9, 0x99, 0x9A, 0xC9, 0x1A, 0xFF,
+    0xE3, 0x9F, 0xFC, 0x96, 0x99, 0x99, 0x93, 0x77, 0x72, 0xE9, 0x75, 0xAF, 0x97, 0x3A, 0xFD, 0x97,
+    0x1A, 0xDA, 0x1E, 0x97, 0xAD, 0xA3, 0xE7, 0xAC, 0xA5, 0xAA, 0x77, 0x77, 0x71, 0x9F, 0xFF, 0xFA,
+    0x0A, 0xFF, 0xFF, 0xA1, 0x99, 0xFA, 0xAA, 0xAA, 0xAA, 0xF3, 0xAE, 0x7E, 0x3A, 0xE7, 0xAC, 0xA3,
+    0xAE, 0x79, 0xC9, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xFF, 0xF5, 0xAF, 0xFE,
+    0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0xAE, 0x71, 0x93,
+    0xAE, 0x70, 0xAC, 0x92, 0xAE, 0x70, 0xDA, 0x2A, 0xE7, 0x9D, 0x92, 0xAE, 0x99, 0x9A, 0xAA, 0xAA,
+    0xE9, 0x9F, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x71, 0xE9, 0x75, 0xAF, 0x75,
+    0xAF, 0x75, 0x9E, 0x97, 0x79, 0x70, 0x79, 0x73, 0x9E, 0x72, 0xFC, 0x70, 0xFD, 0xA6, 0x9D, 0xA0,
+    0xE9, 0x5E, 0x2E, 0x4E, 0x4D, 0x93, 0x9A, 0x59, 0x97, 0x77, 0x99, 0x97, 0x09, 0xFE, 0x94, 0xFF,
+    0xD9, 0x2E, 0xA3, 0xF1, 0x9D, 0xA5, 0xE9, 0x0E, 0x6A, 0xDA, 0x0E, 0x69, 0xDA, 0x9E, 0x99, 0x99,
+    0x99, 0x9A, 0xDA, 0xAF, 0xFF, 0xCA, 0xAF, 0xFF, 0xC9, 0xAD, 0xA7, 0x2A, 0xDA, 0x72, 0x9E, 0x73,
+    0xE9, 0x72, 0xF9, 0x71, 0x9F, 0xCA, 0x99, 0x99, 0xAC, 0x91, 0xAF, 0xFE, 0x39, 0xFF, 0xC9, 0x69,
+    0x99, 0x99, 0x77, 0x77, 0x79, 0xE7, 0x2F, 0x97, 0x1F, 0x72, 0xAD, 0xA7, 0x73, 0x74, 0xAF, 0xC9,
+    0x2A, 0xFE, 0x91, 0xDA, 0x1A, 0xDA, 0x1D, 0x29, 0xDA, 0x6E, 0x5A, 0xE5, 0xAD, 0x97, 0xCA, 0x70,
+    0x97, 0x70, 0x9F, 0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6,
+    0xAE, 0x6A, 0xE6, 0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x39, 0xA9, 0x5A, 0xFC, 0xA2, 0xAE,
+    0xAE, 0x91, 0xDA, 0x2D, 0xA1, 0xAC, 0x92, 0xDA, 0x6A, 0xD5, 0x9E, 0x94, 0x9D, 0x97, 0xD7, 0x09,
+    0x97, 0x77, 0x39, 0xAF, 0x93, 0xFD, 0x93, 0x9A, 0xF9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E,
+    0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x39, 0xFF, 0x1F, 0xFC, 0x00,
+    0x9F, 0xFC, 0x0A, 0xFF, 0xA1, 0x99, 0xF9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE,
+    0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x92, 0x9F, 0xFC, 0x0A, 0xFF, 0xC7, 0x77, 0x74, 0x9E, 0x6F, 0x95, 0xF9, 0x5A, 0xE7,
+    0x09, 0x40, 0x49, 0x79, 0xE9, 0x5F, 0xA5, 0xFA, 0x59, 0xE7, 0x77, 0x77, 0x70, 0x9A, 0xF9, 0x3F,
+    0xD9, 0x39, 0xAF, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x93, 0x9F, 0xF1, 0xFF, 0xC7, 0x77, 0x75, 0xE9, 0x59, 0xF5, 0xAE,
+    0xA6, 0xE7, 0x60, 0x71, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA,
+    0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73,
+    0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75, 0xAE, 0x09,
+    0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7,
+    0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9,
+    0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97,
+    0x77, 0x77, 0x77, 0x73, 0xEA, 0x77, 0x29, 0xF7, 0x72, 0x9F, 0x77, 0x3E, 0xA7, 0x74, 0x97, 0x30,
+    0x69, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD,
+    0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A,
+    0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F,
+    0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x77, 0x77, 0x77, 0x2E, 0x97,
+    0x4A, 0xEA, 0x74, 0xAE, 0xA7, 0x5E, 0x77, 0x70, 0x77, 0x77, 0x0A, 0xFA, 0x77, 0x0F, 0xF7, 0x69,
+    0xD9, 0x1E, 0x97, 0x59, 0xD2, 0xAD, 0x77, 0x39, 0xDA, 0x77, 0x19, 0xAD, 0xA7, 0x72, 0xDA, 0x77,
+    0x4A, 0xC9, 0x77, 0x59, 0x77, 0x59, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF, 0xFC, 0x70,
+    0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73, 0xF2, 0x9E,
+    0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E, 0x97, 0x5A,
+    0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA, 0x75, 0xEA,
+    0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4, 0x9F, 0x97,
+    0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xAA,
+    0xA9, 0x71, 0x69, 0x99, 0x97, 0x39, 0xFD, 0x72, 0xEA, 0xAE, 0x70, 0x9D, 0x2A, 0xD7, 0x1D, 0x2A,
+    0xD7, 0x6D, 0xA7, 0x4A, 0xDA, 0x74, 0xDA, 0x76, 0xAC, 0x97, 0x79, 0x77, 0x77, 0x19, 0x99, 0x97,
+    0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E,
+    0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A,
+    0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93,
+    0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x60, 0x77, 0x77, 0x71, 0xCA, 0x77, 0x49, 0xD9,
+    0x77, 0x3E, 0x77, 0x3A, 0xD7, 0x79, 0x99, 0x1D, 0x77, 0xF9, 0x09, 0x77, 0xFD, 0x97, 0x7A, 0xD9,
+    0x0E, 0x97, 0x5A, 0xD9, 0x2E, 0x75, 0xAA, 0x94, 0xA9, 0x77, 0x09, 0x99, 0x97, 0x70, 0xAF, 0xFA,
+    0x97, 0x29, 0xFF, 0xFC, 0x70, 0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71,
+    0xFA, 0x3F, 0x73, 0xF2, 0x9E, 0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9,
+    0x75, 0xF0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97,
+    0x5F, 0x09, 0xEA, 0x75, 0xEA, 0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F,
+    0x97, 0x1A, 0xE4, 0x9F, 0x97, 0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A,
+    0xFF, 0xCA, 0x76, 0x99, 0xAA, 0xA9, 0x71, 0x76, 0x97, 0x79, 0xD7, 0x6E, 0x75, 0x9E, 0x75, 0xE7,
+    0x59, 0xD7, 0x69, 0xC9, 0x71, 0xEA, 0x74, 0xFD, 0x72, 0xAD, 0xAF, 0x70, 0xAD, 0xA1, 0xAD, 0xA6,
+    0xAD, 0xA3, 0xAD, 0x69, 0xA9, 0x5A, 0x97, 0x77, 0x49, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE,
+    0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09,
+    0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97,
+    0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7,
+    0x29, 0xAA, 0x99, 0x60, 0x77, 0x77, 0x5A, 0xC7, 0x74, 0x9D, 0x97, 0x74, 0xE7, 0x75, 0xDA, 0x77,
+    0x09, 0x99, 0x1D, 0x77, 0xF9, 0x19, 0x76, 0xFD, 0x97, 0x7A, 0xD9, 0x0E, 0x97, 0x5A, 0xD9, 0x2E,
+    0x75, 0xAA, 0x94, 0xA9, 0x77, 0x09, 0x99, 0x97, 0x70, 0xAF, 0xFA, 0x97, 0x29, 0xFF, 0xFC, 0x70,
+    0xAF, 0xA9, 0x19, 0xAF, 0xC6, 0xAE, 0xA7, 0xFC, 0x49, 0xEA, 0x71, 0xFA, 0x3F, 0x73, 0xF2, 0x9E,
+    0x97, 0x3A, 0xE9, 0x1F, 0x74, 0x9E, 0xA1, 0xEA, 0x75, 0xF1, 0xE9, 0x75, 0xF0, 0x9E, 0x97, 0x5A,
+    0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5A, 0xE0, 0x9E, 0x97, 0x5F, 0x09, 0xEA, 0x75, 0xEA,
+    0x1F, 0x75, 0xE9, 0x1F, 0x97, 0x3A, 0xE2, 0x9F, 0x73, 0xEA, 0x3F, 0x97, 0x1A, 0xE4, 0x9F, 0x97,
+    0xAE, 0x95, 0xAF, 0xC9, 0x39, 0xFA, 0x79, 0xFF, 0xFC, 0x97, 0x2A, 0xFF, 0xCA, 0x76, 0x99, 0xAA,
+    0xA9, 0x71, 0x72, 0x97, 0x7D, 0x76, 0xAD, 0x97, 0x59, 0xE7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xAC,
+    0x72, 0xEA, 0x19, 0x71, 0xFC, 0xA7, 0x2A, 0xDA, 0xEA, 0x70, 0xAD, 0xA1, 0xAD, 0xA6, 0xAD, 0xA3,
+    0xAD, 0x69, 0xA9, 0x5A, 0x97, 0x77, 0x49, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9,
+    0x29, 0xFA, 0x3E, 0x6F, 0x91, 0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE,
+    0x70, 0x9E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E,
+    0xA7, 0xE9, 0x1F, 0x95, 0x9E, 0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA,
+    0x99, 0x60, 0x77, 0x77, 0x69, 0xF9, 0x77, 0x09, 0xD9, 0xAD, 0x77, 0x1C, 0xA1, 0xD7, 0x74, 0xAC,
+    0xA7, 0x73, 0xDA, 0x75, 0xF9, 0x1C, 0xA7, 0x5A, 0xFC, 0x97, 0x7A, 0xD9, 0x0E, 0x97, 0x5A, 0xD9,
+    0x2E, 0x75, 0xAA, 0x5A, 0x97, 0x70, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7,
+    0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29,
+    0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75,
+    0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E,
+    0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9,
+    0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A,
+    0xAA, 0x97, 0x10, 0x74, 0x9A, 0x97, 0x5A, 0xFC, 0x97, 0x29, 0xD9, 0x0E, 0x73, 0xD1, 0x9D, 0x77,
+    0xDA, 0x75, 0xAD, 0xA7, 0x6D, 0x97, 0x1A, 0xAC, 0xA1, 0x9A, 0x71, 0xAF, 0xC7, 0x39, 0xFE, 0x71,
+    0x9E, 0x1A, 0xE7, 0x9E, 0x3A, 0xD7, 0x9A, 0x95, 0x99, 0x77, 0x76, 0x99, 0x99, 0x74, 0xAF, 0xE9,
+    0x79, 0xFF, 0xE5, 0xAE, 0x92, 0x9F, 0xA4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1,
+    0x9E, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E,
+    0x19, 0xE9, 0x79, 0xE2, 0xEA, 0x7E, 0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9,
+    0x7F, 0xFA, 0x73, 0x9A, 0xA9, 0x97, 0x77, 0x76, 0x9F, 0x2C, 0xA7, 0x5F, 0xD0, 0x9D, 0x75, 0xD1,
+    0xFC, 0xA7, 0x59, 0xA2, 0xAD, 0xA7, 0x77, 0x77, 0x1A, 0xE7, 0x72, 0xAF, 0xC7, 0x70, 0xAD, 0x90,
+    0xE7, 0x6A, 0xD9, 0x2E, 0x75, 0xAA, 0x5A, 0x97, 0x70, 0x99, 0x99, 0x77, 0x0A, 0xFF, 0xA9, 0x72,
+    0x9F, 0xFF, 0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F, 0xC4, 0x9E, 0xA7, 0x1F, 0xA3,
+    0xF7, 0x3F, 0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E, 0xA7, 0x5F, 0x1E, 0x97, 0x5F,
+    0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xF0,
+    0x9E, 0xA7, 0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29, 0xF7, 0x3E, 0xA3, 0xF9, 0x71,
+    0xAE, 0x49, 0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F, 0xFF, 0xC9, 0x72, 0xAF, 0xFC,
+    0xA7, 0x69, 0x9A, 0xAA, 0x97, 0x10, 0x49, 0x99, 0x75, 0xAF, 0x2C, 0x97, 0xFD, 0x9A, 0xCA, 0x69,
+    0xCA, 0x09, 0xFC, 0x97, 0xC9, 0x19, 0xEA, 0x77, 0x75, 0x9A, 0xAA, 0x74, 0xAF, 0xC7, 0x29, 0xFE,
+    0x97, 0x9E, 0x1A, 0xE6, 0x9D, 0xA3, 0x9D, 0x95, 0x9A, 0x95, 0x9A, 0x77, 0x74, 0x99, 0x99, 0x73,
+    0xAF, 0xE9, 0x69, 0xFF, 0xE4, 0xAE, 0x92, 0x9F, 0xA3, 0xE6, 0xF9, 0x1A, 0xDA, 0x7E, 0xA1, 0xE7,
+    0x0A, 0xE0, 0x9E, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x71, 0xE0, 0xAE, 0x71, 0xE0, 0xAE,
+    0x70, 0x9E, 0x09, 0xE9, 0x79, 0xE1, 0xEA, 0x7E, 0x91, 0xF9, 0x59, 0xE3, 0xFA, 0x3A, 0xE9, 0x39,
+    0xFF, 0xE9, 0x6F, 0xFA, 0x72, 0x9A, 0xA9, 0x96, 0x77, 0x77, 0x1A, 0xDA, 0x77, 0x29, 0xFC, 0x77,
+    0x1F, 0xE7, 0x7E, 0x1A, 0xE7, 0x5E, 0x3A, 0xD9, 0x74, 0xD5, 0x9A, 0x77, 0x77, 0x70, 0x99, 0x99,
+    0x77, 0x0A, 0xFF, 0xA9, 0x72, 0x9F, 0xFF, 0xC7, 0x0A, 0xFA, 0x91, 0x9A, 0xFC, 0x6A, 0xEA, 0x7F,
+    0xC4, 0x9E, 0xA7, 0x1F, 0xA3, 0xF7, 0x3F, 0x29, 0xE9, 0x73, 0xAE, 0x91, 0xF7, 0x49, 0xEA, 0x1E,
+    0xA7, 0x5F, 0x1E, 0x97, 0x5F, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75, 0xAE, 0x09, 0xE9, 0x75,
+    0xAE, 0x09, 0xE9, 0x75, 0xF0, 0x9E, 0xA7, 0x5E, 0xA1, 0xF7, 0x5E, 0x91, 0xF9, 0x73, 0xAE, 0x29,
+    0xF7, 0x3E, 0xA3, 0xF9, 0x71, 0xAE, 0x49, 0xF9, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0x9F, 0xA7, 0x9F,
+    0xFF, 0xC9, 0x72, 0xAF, 0xFC, 0xA7, 0x69, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x73, 0xEA, 0x77,
+    0x29, 0xF7, 0x72, 0x9F, 0x77, 0x3E, 0xA7, 0x74, 0x97, 0x30, 0x70, 0x97, 0x6F, 0x74, 0x9F, 0xA7,
+    0x3F, 0xD9, 0x71, 0xAD, 0x90, 0xE7, 0x09, 0xDA, 0x19, 0xDA, 0x7D, 0xA3, 0x9D, 0x79, 0x95, 0x97,
+    0x77, 0x59, 0x99, 0x97, 0x3A, 0xFE, 0x96, 0x9F, 0xFE, 0x4A, 0xE9, 0x29, 0xFA, 0x3E, 0x6F, 0x91,
+    0xAD, 0xA7, 0xEA, 0x1E, 0x70, 0xAE, 0x09, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x1E,
+    0x0A, 0xE7, 0x1E, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0x9E, 0x1E, 0xA7, 0xE9, 0x1F, 0x95, 0x9E,
+    0x3F, 0xA3, 0xAE, 0x93, 0x9F, 0xFE, 0x96, 0xFF, 0xA7, 0x29, 0xAA, 0x99, 0x77, 0x77, 0x77, 0x2E,
+    0x97, 0x4A, 0xEA, 0x74, 0xAE, 0xA7, 0x5E, 0x77, 0x70, 0x76, 0x97, 0x76, 0xD9, 0x77, 0x39, 0xEA,
+    0x77, 0x2A, 0xF9, 0x77, 0x09, 0xFC, 0x97, 0x71, 0xEA, 0x96, 0xAD, 0x97, 0x09, 0x97, 0x1A, 0xE7,
+    0x74, 0xAE, 0x71, 0x99, 0x99, 0x6E, 0x96, 0xAF, 0xFA, 0x91, 0x9E, 0x59, 0xFF, 0xFC, 0xAE, 0x5A,
+    0xFA, 0x91, 0x9A, 0xFD, 0xA5, 0xAE, 0xA7, 0xFC, 0x59, 0xEA, 0x71, 0xFA, 0x4F, 0x73, 0xF3, 0x9E,
+    0x97, 0x3A, 0xE9, 0x2F, 0x74, 0x9E, 0xA2, 0xEA, 0x75, 0xF2, 0xE9, 0x75, 0xF1, 0x9E, 0x97, 0x5A,
+    0xE1, 0x9E, 0x97, 0x5A, 0xE1, 0x9E, 0x97, 0x5A, 0xE1, 0x9E, 0x97, 0x5F, 0x19, 0xEA, 0x75, 0xEA,
+    0x2F, 0x75, 0xE9, 0x2F, 0x97, 0x3A, 0xE3, 0x9F, 0x73, 0xEA, 0x4F, 0x97, 0x1A, 0xE5, 0x9F, 0x97,
+    0xAE, 0x96, 0xAF, 0xC9, 0x39, 0xFA, 0x70, 0x9F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7, 0x79, 0x9A,
+    0xAA, 0x97, 0x20, 0x72, 0xA7, 0x70, 0xE7, 0x6A, 0xE7, 0x6E, 0xA7, 0x5E, 0xA7, 0x5A, 0xDA, 0x76,
+    0xAC, 0x94, 0x9A, 0xA7, 0x7A, 0xE7, 0x69, 0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3,
+    0x9F, 0xFF, 0xC3, 0xAE, 0x92, 0x9F, 0xC4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1,
+    0x9E, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E,
+    0x19, 0xE9, 0x79, 0xE2, 0xEA, 0x7E, 0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9,
+    0x7F, 0xFA, 0x73, 0x9A, 0xA9, 0x97, 0x77, 0x77, 0xAC, 0xA7, 0x75, 0xF7, 0x74, 0xAF, 0xA7, 0x73,
+    0xAF, 0xC7, 0x74, 0x9E, 0xA5, 0xAD, 0x97, 0x49, 0x95, 0xAE, 0x77, 0x4A, 0xE7, 0x19, 0x99, 0x96,
+    0xE9, 0x6A, 0xFF, 0xA9, 0x19, 0xE5, 0x9F, 0xFF, 0xCA, 0xE5, 0xAF, 0xA9, 0x19, 0xAF, 0xDA, 0x5A,
+    0xEA, 0x7F, 0xC5, 0x9E, 0xA7, 0x1F, 0xA4, 0xF7, 0x3F, 0x39, 0xE9, 0x73, 0xAE, 0x92, 0xF7, 0x49,
+    0xEA, 0x2E, 0xA7, 0x5F, 0x2E, 0x97, 0x5F, 0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xAE, 0x19,
+    0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xF1, 0x9E, 0xA7, 0x5E, 0xA2, 0xF7, 0x5E, 0x92, 0xF9, 0x73,
+    0xAE, 0x39, 0xF7, 0x3E, 0xA4, 0xF9, 0x71, 0xAE, 0x59, 0xF9, 0x7A, 0xE9, 0x6A, 0xFC, 0x93, 0x9F,
+    0xA7, 0x09, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xAA, 0xA9, 0x72, 0x77, 0x7C, 0xA7,
+    0x7A, 0xD9, 0x76, 0xF7, 0x69, 0xF7, 0x69, 0xEA, 0x77, 0xE9, 0x77, 0x9C, 0xA3, 0x9A, 0xA7, 0x7A,
+    0xE7, 0x69, 0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3, 0x9F, 0xFF, 0xC3, 0xAE, 0x92,
+    0x9F, 0xC4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1, 0x9E, 0x70, 0x9E, 0x1A, 0xE7,
+    0x09, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E, 0x19, 0xE9, 0x79, 0xE2, 0xEA,
+    0x7E, 0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9, 0x7F, 0xFA, 0x73, 0x9A, 0xA9,
+    0x97, 0x77, 0x77, 0x1A, 0xFA, 0x77, 0x1F, 0xF7, 0x79, 0xD9, 0x1E, 0x97, 0x69, 0xD2, 0xAD, 0x77,
+    0x49, 0xDA, 0x77, 0x29, 0xAD, 0xA7, 0x73, 0xDA, 0x7A, 0xD9, 0x71, 0xAC, 0x97, 0xAE, 0x72, 0x97,
+    0x0A, 0xE7, 0x19, 0x99, 0x96, 0xE9, 0x6A, 0xFF, 0xA9, 0x19, 0xE5, 0x9F, 0xFF, 0xCA, 0xE5, 0xAF,
+    0xA9, 0x19, 0xAF, 0xDA, 0x5A, 0xEA, 0x7F, 0xC5, 0x9E, 0xA7, 0x1F, 0xA4, 0xF7, 0x3F, 0x39, 0xE9,
+    0x73, 0xAE, 0x92, 0xF7, 0x49, 0xEA, 0x2E, 0xA7, 0x5F, 0x2E, 0x97, 0x5F, 0x19, 0xE9, 0x75, 0xAE,
+    0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xF1, 0x9E, 0xA7, 0x5E, 0xA2,
+    0xF7, 0x5E, 0x92, 0xF9, 0x73, 0xAE, 0x39, 0xF7, 0x3E, 0xA4, 0xF9, 0x71, 0xAE, 0x59, 0xF9, 0x7A,
+    0xE9, 0x6A, 0xFC, 0x93, 0x9F, 0xA7, 0x09, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xAA,
+    0xA9, 0x72, 0x69, 0x99, 0x97, 0x49, 0xFD, 0x73, 0xEA, 0xAE, 0x71, 0x9D, 0x2A, 0xD7, 0x2D, 0x2A,
+    0xD7, 0x7D, 0xA7, 0x5A, 0xDA, 0x75, 0xDA, 0x77, 0xAC, 0x94, 0x9A, 0xA7, 0x09, 0x5A, 0xE7, 0x69,
+    0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3, 0x9F, 0xFF, 0xC3, 0xAE, 0x92, 0x9F, 0xC4,
+    0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1, 0x9E, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1,
+    0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E, 0x19, 0xE9, 0x79, 0xE2, 0xEA, 0x7E, 0x92,
+    0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9, 0x7F, 0xFA, 0x73, 0x9A, 0xA9, 0x97, 0x7E,
+    0x92, 0xC9, 0x76, 0xFC, 0xA0, 0x9D, 0x75, 0x9F, 0xFD, 0x75, 0x9D, 0x1F, 0xCA, 0x76, 0xAA, 0x2A,
+    0xDA, 0x4A, 0xD9, 0x77, 0x4A, 0xE7, 0x74, 0xAE, 0x71, 0x99, 0x99, 0x6E, 0x96, 0xAF, 0xFA, 0x91,
+    0x9E, 0x59, 0xFF, 0xFC, 0xAE, 0x5A, 0xFA, 0x91, 0x9A, 0xFD, 0xA5, 0xAE, 0xA7, 0xFC, 0x59, 0xEA,
+    0x71, 0xFA, 0x4F, 0x73, 0xF3, 0x9E, 0x97, 0x3A, 0xE9, 0x2F, 0x74, 0x9E, 0xA2, 0xEA, 0x75, 0xF2,
+    0xE9, 0x75, 0xF1, 0x9E, 0x97, 0x5A, 0xE1, 0x9E, 0x97, 0x5A, 0xE1, 0x9E, 0x97, 0x5A, 0xE1, 0x9E,
+    0x97, 0x5F, 0x19, 0xEA, 0x75, 0xEA, 0x2F, 0x75, 0xE9, 0x2F, 0x97, 0x3A, 0xE3, 0x9F, 0x73, 0xEA,
+    0x4F, 0x97, 0x1A, 0xE5, 0x9F, 0x97, 0xAE, 0x96, 0xAF, 0xC9, 0x39, 0xFA, 0x70, 0x9F, 0xFF, 0xC9,
+    0x73, 0xAF, 0xFC, 0xA7, 0x79, 0x9A, 0xAA, 0x97, 0x20, 0x59, 0x77, 0xAE, 0xA2, 0xCA, 0x70, 0xFC,
+    0xA0, 0xAD, 0x79, 0xD9, 0xAF, 0xD7, 0x9C, 0xA1, 0x9F, 0x97, 0x09, 0x93, 0xAA, 0x91, 0x9A, 0xA7,
+    0x7A, 0xE7, 0x69, 0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3, 0x9F, 0xFF, 0xC3, 0xAE,
+    0x92, 0x9F, 0xC4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1, 0x9E, 0x70, 0x9E, 0x1A,
+    0xE7, 0x09, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E, 0x19, 0xE9, 0x79, 0xE2,
+    0xEA, 0x7E, 0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9, 0x7F, 0xFA, 0x73, 0x9A,
+    0xA9, 0x97, 0x77, 0x77, 0x75, 0xAD, 0x97, 0x74, 0xAE, 0x77, 0x4A, 0xE7, 0x19, 0x99, 0x96, 0xE9,
+    0x6A, 0xFF, 0xA9, 0x19, 0xE5, 0x9F, 0xFF, 0xCA, 0xE5, 0xAF, 0xA9, 0x19, 0xAF, 0xDA, 0x5A, 0xEA,
+    0x7F, 0xC5, 0x9E, 0xA7, 0x1F, 0xA4, 0xF7, 0x3F, 0x39, 0xE9, 0x73, 0xAE, 0x92, 0xF7, 0x49, 0xEA,
+    0x2E, 0xA7, 0x5F, 0x2E, 0x97, 0x5F, 0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9, 0x75, 0xAE, 0x19, 0xE9,
+    0x75, 0xAE, 0x19, 0xE9, 0x75, 0xF1, 0x9E, 0xA7, 0x5E, 0xA2, 0xF7, 0x5E, 0x92, 0xF9, 0x73, 0xAE,
+    0x39, 0xF7, 0x3E, 0xA4, 0xF9, 0x71, 0xAE, 0x59, 0xF9, 0x7A, 0xE9, 0x6A, 0xFC, 0x93, 0x9F, 0xA7,
+    0x09, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x99, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x6E,
+    0xA7, 0x73, 0x9F, 0x77, 0x39, 0xF7, 0x74, 0xEA, 0x77, 0x59, 0x74, 0x76, 0x9A, 0xA7, 0x7A, 0xE7,
+    0x69, 0xE6, 0x99, 0x99, 0x3A, 0xDA, 0x4A, 0xFE, 0x90, 0xE3, 0x9F, 0xFF, 0xC3, 0xAE, 0x92, 0x9F,
+    0xC4, 0xE6, 0xF9, 0x2A, 0xDA, 0x7E, 0xA2, 0xE7, 0x0A, 0xE1, 0x9E, 0x70, 0x9E, 0x1A, 0xE7, 0x09,
+    0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x71, 0xE1, 0xAE, 0x70, 0x9E, 0x19, 0xE9, 0x79, 0xE2, 0xEA, 0x7E,
+    0x92, 0xF9, 0x59, 0xE4, 0xFA, 0x3A, 0xE9, 0x49, 0xFF, 0xE9, 0x7F, 0xFA, 0x73, 0x9A, 0xA9, 0x97,
+    0x77, 0x77, 0x74, 0xAD, 0xA7, 0x59, 0xF7, 0x59, 0xF7, 0x6E, 0x97, 0x77, 0x20, 0x0F, 0xFC, 0x5A,
+    0xFF, 0x9F, 0xFA, 0x5F, 0xFA, 0x19, 0xAE, 0x97, 0x09, 0xAE, 0x94, 0x9E, 0x73, 0xE5, 0x9E, 0x73,
+    0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5,
+    0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E, 0x73, 0xE5, 0x9E,
+    0x73, 0xE6, 0xE9, 0x71, 0x9E, 0x6E, 0xA7, 0x1A, 0xDA, 0x6F, 0x71, 0xE9, 0x69, 0xF7, 0xF7, 0x0F,
+    0xCA, 0x99, 0x99, 0xAF, 0x72, 0xFF, 0xFC, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x99, 0x99, 0x77,
+    0x77, 0x77, 0x77, 0x6A, 0xE7, 0x74, 0xF7, 0x74, 0xF7, 0x74, 0xF7, 0x75, 0x97, 0x30, 0x77, 0x6A,
+    0xAE, 0xA4, 0xAF, 0xC3, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD,
+    0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD,
+    0x79, 0x99, 0x94, 0x99, 0x77, 0x77, 0x77, 0x70, 0xE9, 0x77, 0x09, 0xF7, 0x70, 0x9F, 0x77, 0x1E,
+    0x97, 0x77, 0x60, 0x77, 0x77, 0x2A, 0xFC, 0x97, 0x70, 0xFF, 0x77, 0x9D, 0x91, 0xAD, 0x97, 0x7D,
+    0x2A, 0xD9, 0x77, 0x4E, 0x77, 0x29, 0xAD, 0xA7, 0x73, 0xAC, 0xA7, 0x75, 0x9C, 0xA7, 0x76, 0x97,
+    0x77, 0x75, 0xFF, 0xC5, 0xAF, 0xF9, 0xFF, 0xA5, 0xFF, 0xA1, 0x9A, 0xE9, 0x70, 0x9A, 0xE9, 0x49,
+    0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7,
+    0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E,
+    0x59, 0xE7, 0x3E, 0x59, 0xE7, 0x3E, 0x6E, 0x97, 0x19, 0xE6, 0xEA, 0x71, 0xAD, 0xA6, 0xF7, 0x1E,
+    0x96, 0x9F, 0x7F, 0x70, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x2F, 0xFF, 0xC9, 0x73, 0xAF, 0xFC, 0xA7,
+    0x70, 0x99, 0x99, 0x97, 0x10, 0x70, 0x9A, 0x97, 0x70, 0xFD, 0xA7, 0x5E, 0xAA, 0xE9, 0x74, 0xD9,
+    0x19, 0xDA, 0x74, 0xAC, 0x29, 0xD9, 0x77, 0x1A, 0xD7, 0x70, 0x9E, 0x77, 0x0A, 0xD9, 0x77, 0x19,
+    0xCA, 0x77, 0x39, 0x97, 0x77, 0x77, 0x77, 0xAA, 0xEA, 0x4A, 0xFC, 0x3A, 0xFC, 0xA3, 0x9F, 0xD4,
+    0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E,
+    0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7,
+    0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x77, 0x97, 0x77, 0x0A,
+    0xC9, 0x77, 0x59, 0xF7, 0x74, 0xAF, 0xA7, 0x73, 0xFC, 0xA7, 0x73, 0xEA, 0x96, 0xAD, 0xA7, 0x29,
+    0x97, 0x19, 0xE7, 0x76, 0x9E, 0x77, 0x6A, 0xE1, 0xFF, 0xC5, 0xAF, 0xF1, 0x9F, 0xFA, 0x5F, 0xEA,
+    0x49, 0xAE, 0x97, 0x09, 0xAE, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7,
+    0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E,
+    0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x70, 0xE9, 0x71, 0x9E,
+    0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0F, 0x71, 0xE9, 0x70, 0x9F, 0x7F, 0x72, 0xFC, 0xA9, 0x99, 0x9A,
+    0xF7, 0x4F, 0xFF, 0xC9, 0x75, 0xAF, 0xFC, 0xA7, 0x72, 0x99, 0x99, 0x97, 0x30, 0x73, 0xA9, 0x77,
+    0x2A, 0xD9, 0x77, 0x1E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x77, 0x1E, 0x77, 0x2C, 0xA6, 0xAC, 0x97,
+    0x72, 0xE7, 0x72, 0xE7, 0x71, 0xAE, 0x1A, 0xAE, 0xA4, 0xAA, 0xFD, 0x1A, 0xFC, 0xA3, 0x9F, 0xD4,
+    0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E,
+    0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7,
+    0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA, 0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x70, 0x97, 0x77, 0x09,
+    0xCA, 0x77, 0x7A, 0xE9, 0x77, 0x5A, 0xFA, 0x77, 0x59, 0xFC, 0x77, 0x69, 0xAE, 0x5A, 0xDA, 0x76,
+    0x99, 0x59, 0xE7, 0x76, 0x9E, 0x77, 0x6A, 0xE1, 0xFF, 0xC5, 0xAF, 0xF1, 0x9F, 0xFA, 0x5F, 0xEA,
+    0x49, 0xAE, 0x97, 0x09, 0xAE, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7,
+    0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E,
+    0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x70, 0xE9, 0x71, 0x9E,
+    0x70, 0xEA, 0x71, 0xAD, 0xA7, 0x0F, 0x71, 0xE9, 0x70, 0x9F, 0x7F, 0x72, 0xFC, 0xA9, 0x99, 0x9A,
+    0xF7, 0x4F, 0xFF, 0xC9, 0x75, 0xAF, 0xFC, 0xA7, 0x72, 0x99, 0x99, 0x97, 0x30, 0x77, 0x73, 0x9C,
+    0x77, 0x29, 0xDA, 0x77, 0x1A, 0xE9, 0x77, 0x1F, 0x97, 0x71, 0xF7, 0x72, 0xAE, 0x77, 0x3D, 0x5A,
+    0xC9, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x1A, 0xE1, 0xAA, 0xEA, 0x4A, 0xAF, 0xD1, 0xAF, 0xCA, 0x39,
+    0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19,
+    0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x30, 0x77, 0x77,
+    0x4A, 0xFC, 0x97, 0x72, 0xFF, 0x77, 0x19, 0xD9, 0x1A, 0xD9, 0x77, 0x1D, 0x2A, 0xD9, 0x77, 0x6E,
+    0x77, 0x49, 0xAD, 0xA7, 0x75, 0xAD, 0x7A, 0xDA, 0x73, 0x9C, 0xA7, 0x9E, 0x74, 0x97, 0x09, 0xE7,
+    0x76, 0xAE, 0x1F, 0xFC, 0x5A, 0xFF, 0x19, 0xFF, 0xA5, 0xFE, 0xA4, 0x9A, 0xE9, 0x70, 0x9A, 0xE7,
+    0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E,
+    0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73,
+    0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x0E, 0x97, 0x19, 0xE7, 0x0E, 0xA7, 0x1A, 0xDA, 0x70,
+    0xF7, 0x1E, 0x97, 0x09, 0xF7, 0xF7, 0x2F, 0xCA, 0x99, 0x99, 0xAF, 0x74, 0xFF, 0xFC, 0x97, 0x5A,
+    0xFF, 0xCA, 0x77, 0x29, 0x99, 0x99, 0x73, 0x70, 0x9A, 0x97, 0x70, 0xFD, 0xA7, 0x5E, 0xAA, 0xE9,
+    0x74, 0xD9, 0x19, 0xDA, 0x74, 0xAC, 0x29, 0xD9, 0x77, 0x1A, 0xD7, 0x70, 0x9E, 0x77, 0x0A, 0xD9,
+    0x77, 0x19, 0xCA, 0x6A, 0xC9, 0x71, 0x99, 0x6E, 0x77, 0x2E, 0x77, 0x1A, 0xE1, 0xAA, 0xEA, 0x4A,
+    0xAF, 0xD1, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD, 0xA6, 0xAE,
+    0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD, 0xA1, 0xFD, 0x79, 0x99,
+    0x94, 0x99, 0x30, 0x70, 0xAD, 0x92, 0xAA, 0x77, 0x0F, 0xCA, 0x1D, 0x97, 0x7F, 0xFD, 0x77, 0x0D,
+    0x1A, 0xFC, 0x77, 0x0A, 0xA2, 0x9D, 0xA4, 0xAD, 0xA7, 0x76, 0x9E, 0x77, 0x69, 0xE7, 0x76, 0xAE,
+    0x1F, 0xFC, 0x5A, 0xFF, 0x19, 0xFF, 0xA5, 0xFE, 0xA4, 0x9A, 0xE9, 0x70, 0x9A, 0xE7, 0x9E, 0x73,
+    0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7,
+    0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x9E,
+    0x73, 0xE7, 0x9E, 0x73, 0xE7, 0x0E, 0x97, 0x19, 0xE7, 0x0E, 0xA7, 0x1A, 0xDA, 0x70, 0xF7, 0x1E,
+    0x97, 0x09, 0xF7, 0xF7, 0x2F, 0xCA, 0x99, 0x99, 0xAF, 0x74, 0xFF, 0xFC, 0x97, 0x5A, 0xFF, 0xCA,
+    0x77, 0x29, 0x99, 0x99, 0x73, 0x69, 0x97, 0x72, 0xF2, 0xAC, 0x73, 0xFD, 0x1D, 0x97, 0x2D, 0xA9,
+    0xFD, 0x73, 0xD2, 0xFA, 0x74, 0x93, 0x9A, 0x93, 0xAC, 0x97, 0x72, 0xE7, 0x72, 0xE7, 0x71, 0xAE,
+    0x1A, 0xAE, 0xA4, 0xAA, 0xFD, 0x1A, 0xFC, 0xA3, 0x9F, 0xD4, 0x9A, 0xEA, 0x49, 0xAE, 0xA6, 0xEA,
+    0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA,
+    0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6A, 0xDA,
+    0x6A, 0xDA, 0x6A, 0xE5, 0xAE, 0xA6, 0x9F, 0x91, 0x9F, 0xD7, 0xAF, 0xFC, 0x9F, 0xD5, 0xAF, 0xDA,
+    0x1F, 0xD7, 0x99, 0x99, 0x49, 0x93, 0x77, 0x77, 0x77, 0x0A, 0xDA, 0x77, 0x69, 0xE7, 0x76, 0x9E,
+    0x77, 0x6A, 0xE1, 0xFF, 0xC5, 0xAF, 0xF1, 0x9F, 0xFA, 0x5F, 0xEA, 0x49, 0xAE, 0x97, 0x09, 0xAE,
+    0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79,
+    0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7,
+    0x3E, 0x79, 0xE7, 0x3E, 0x79, 0xE7, 0x3E, 0x70, 0xE9, 0x71, 0x9E, 0x70, 0xEA, 0x71, 0xAD, 0xA7,
+    0x0F, 0x71, 0xE9, 0x70, 0x9F, 0x7F, 0x72, 0xFC, 0xA9, 0x99, 0x9A, 0xF7, 0x4F, 0xFF, 0xC9, 0x75,
+    0xAF, 0xFC, 0xA7, 0x72, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xE7, 0x76, 0xF9, 0x77,
+    0x5F, 0x97, 0x75, 0xF7, 0x77, 0x97, 0x50, 0x77, 0x1A, 0xC9, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x1A,
+    0xE1, 0xAA, 0xEA, 0x4A, 0xAF, 0xD1, 0xAF, 0xCA, 0x39, 0xFD, 0x49, 0xAE, 0xA4, 0x9A, 0xEA, 0x6E,
+    0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD,
+    0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xEA, 0x6A, 0xDA, 0x6E, 0xA6, 0xAD, 0xA6, 0xAD,
+    0xA6, 0xAD, 0xA6, 0xAE, 0x5A, 0xEA, 0x69, 0xF9, 0x19, 0xFD, 0x7A, 0xFF, 0xC9, 0xFD, 0x5A, 0xFD,
+    0xA1, 0xFD, 0x79, 0x99, 0x94, 0x99, 0x77, 0x77, 0x77, 0x70, 0xE9, 0x77, 0x09, 0xF7, 0x70, 0x9F,
+    0x77, 0x1E, 0x97, 0x77, 0x60, 0x69, 0x77, 0x49, 0xCA, 0x77, 0x3A, 0xE9, 0x77, 0x19, 0xFA, 0x77,
+    0x19, 0xFC, 0x97, 0x71, 0x9A, 0xE7, 0x74, 0x99, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xC3, 0xFF, 0x0A,
+    0xFF, 0xA3, 0xFF, 0x19, 0xAF, 0x97, 0xAE, 0x94, 0x9E, 0x97, 0xE7, 0xF6, 0x9D, 0xA7, 0x9E, 0x95,
+    0xE7, 0x1A, 0xE4, 0x9D, 0x97, 0x2E, 0xA3, 0xE7, 0x3A, 0xE2, 0x9D, 0x97, 0x4E, 0xA1, 0xE7, 0x59,
+    0xE0, 0xAD, 0x77, 0xAD, 0xAD, 0xA7, 0x70, 0xFC, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0x9E,
+    0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE9, 0x97, 0x59, 0xFF,
+    0xD7, 0x3F, 0xFE, 0x50, 0x77, 0x71, 0xC7, 0x71, 0xE7, 0x70, 0xF7, 0x7A, 0xEA, 0x77, 0xAE, 0x97,
+    0x79, 0xE7, 0x71, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xEA, 0x2A, 0xFD, 0xA9, 0xFE, 0xA2,
+    0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A, 0xD9, 0x4E, 0xA6, 0xE5, 0x9E, 0x59, 0xDA, 0x6E,
+    0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD, 0x71, 0xAD, 0xA2, 0xDA, 0x72, 0xE1, 0x9D, 0x97,
+    0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E, 0xAD, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0xAD, 0xA7,
+    0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA7, 0x49, 0xFC, 0x72, 0xAF, 0xE7, 0x3A, 0xFD, 0x75,
+    0x9A, 0xAA, 0x97, 0x50, 0xAF, 0xFC, 0x3F, 0xF0, 0xAF, 0xFA, 0x3F, 0xF1, 0x9A, 0xF9, 0x7A, 0xE9,
+    0x49, 0xE9, 0x7E, 0x7F, 0x69, 0xDA, 0x79, 0xE9, 0x5E, 0x71, 0xAE, 0x49, 0xD9, 0x72, 0xEA, 0x3E,
+    0x73, 0xAE, 0x29, 0xD9, 0x74, 0xEA, 0x1E, 0x75, 0x9E, 0x0A, 0xD7, 0x7A, 0xDA, 0xDA, 0x77, 0x0F,
+    0xC7, 0x71, 0xAE, 0x97, 0x71, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E,
+    0x77, 0x29, 0xE7, 0x72, 0x9E, 0x99, 0x75, 0x9F, 0xFD, 0x73, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0xAE, 0x77, 0x2F, 0x97, 0x71, 0xF9, 0x77, 0x1F, 0x77, 0x49, 0x72, 0x9F, 0xEA, 0x2A, 0xFD,
+    0xA9, 0xFE, 0xA2, 0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A, 0xD9, 0x4E, 0xA6, 0xE5, 0x9E,
+    0x59, 0xDA, 0x6E, 0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD, 0x71, 0xAD, 0xA2, 0xDA, 0x72,
+    0xE1, 0x9D, 0x97, 0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E, 0xAD, 0x75, 0x9F, 0x97, 0x6F,
+    0x77, 0xAD, 0xA7, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA3, 0xE5, 0x9F, 0xC3, 0xAE, 0xA1,
+    0xAF, 0xE4, 0xAE, 0x91, 0xAF, 0xD5, 0x9E, 0x39, 0xAA, 0xA9, 0x75, 0x77, 0x76, 0xAF, 0xC9, 0x76,
+    0xFF, 0x75, 0x9D, 0xA1, 0xAD, 0xA7, 0x5D, 0x29, 0xD9, 0x77, 0x2E, 0x77, 0x09, 0xAD, 0xA7, 0x71,
+    0xAD, 0x77, 0x39, 0xCA, 0x77, 0x49, 0x77, 0x77, 0x2A, 0xFF, 0xC3, 0xFF, 0x0A, 0xFF, 0xA3, 0xFF,
+    0x19, 0xAF, 0x97, 0xAE, 0x94, 0x9E, 0x97, 0xE7, 0xF6, 0x9D, 0xA7, 0x9E, 0x95, 0xE7, 0x1A, 0xE4,
+    0x9D, 0x97, 0x2E, 0xA3, 0xE7, 0x3A, 0xE2, 0x9D, 0x97, 0x4E, 0xA1, 0xE7, 0x59, 0xE0, 0xAD, 0x77,
+    0xAD, 0xAD, 0xA7, 0x70, 0xFC, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7,
+    0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE9, 0x97, 0x59, 0xFF, 0xD7, 0x3F, 0xFE,
+    0x50, 0x79, 0xA9, 0x76, 0xAF, 0xCA, 0x73, 0x9E, 0xAE, 0xA7, 0x2A, 0xD2, 0xE7, 0x29, 0xCA, 0x2E,
+    0x77, 0x9D, 0x97, 0x59, 0xAD, 0x97, 0x59, 0xDA, 0x77, 0x0D, 0x77, 0x19, 0x97, 0x77, 0x77, 0x71,
+    0x9F, 0xEA, 0x2A, 0xFD, 0xA9, 0xFE, 0xA2, 0xAF, 0xD9, 0x1A, 0xE9, 0x69, 0xE4, 0xE9, 0x6A, 0xD9,
+    0x4E, 0xA6, 0xE5, 0x9E, 0x59, 0xDA, 0x6E, 0x94, 0xE7, 0x9E, 0x39, 0xDA, 0x70, 0xE3, 0xAD, 0x71,
+    0xAD, 0xA2, 0xDA, 0x72, 0xE1, 0x9D, 0x97, 0x2E, 0x90, 0xE7, 0x39, 0xDA, 0x0D, 0x97, 0x4E, 0xAD,
+    0x75, 0x9F, 0x97, 0x6F, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0x9D, 0xA7, 0x7E, 0x76, 0x9E, 0xA7, 0x49,
+    0xFC, 0x72, 0xAF, 0xE7, 0x3A, 0xFD, 0x75, 0x9A, 0xAA, 0x97, 0x50, 0x6A, 0xDA, 0x2A, 0xA7, 0x4F,
+    0xCA, 0x1D, 0x97, 0x3F, 0xFD, 0x97, 0x3D, 0x1A, 0xFC, 0x74, 0x9A, 0x29, 0xDA, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0xAF, 0xFC, 0x3F, 0xF0, 0xAF, 0xFA, 0x3F, 0xF1, 0x9A, 0xF9, 0x7A, 0xE9, 0x49, 0xE9,
+    0x7E, 0x7F, 0x69, 0xDA, 0x79, 0xE9, 0x5E, 0x71, 0xAE, 0x49, 0xD9, 0x72, 0xEA, 0x3E, 0x73, 0xAE,
+    0x29, 0xD9, 0x74, 0xEA, 0x1E, 0x75, 0x9E, 0x0A, 0xD7, 0x7A, 0xDA, 0xDA, 0x77, 0x0F, 0xC7, 0x71,
+    0xAE, 0x97, 0x71, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29, 0xE7, 0x72, 0x9E, 0x77, 0x29,
+    0xE7, 0x72, 0x9E, 0x99, 0x75, 0x9F, 0xFD, 0x73, 0xFF, 0xE5, 0x69, 0x77, 0x0F, 0x91, 0x9C, 0x97,
+    0x09, 0xFC, 0x90, 0xDA, 0x70, 0xAD, 0x9A, 0xFC, 0xA7, 0x0A, 0xC9, 0x1A, 0xF7, 0x29, 0x39, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x29, 0xFE, 0xA2, 0xAF, 0xDA, 0x9F, 0xEA, 0x2A, 0xFD, 0x91, 0xAE, 0x96,
+    0x9E, 0x4E, 0x96, 0xAD, 0x94, 0xEA, 0x6E, 0x59, 0xE5, 0x9D, 0xA6, 0xE9, 0x4E, 0x79, 0xE3, 0x9D,
+    0xA7, 0x0E, 0x3A, 0xD7, 0x1A, 0xDA, 0x2D, 0xA7, 0x2E, 0x19, 0xD9, 0x72, 0xE9, 0x0E, 0x73, 0x9D,
+    0xA0, 0xD9, 0x74, 0xEA, 0xD7, 0x59, 0xF9, 0x76, 0xF7, 0x7A, 0xDA, 0x77, 0xE7, 0x79, 0xDA, 0x77,
+    0xE7, 0x69, 0xEA, 0x74, 0x9F, 0xC7, 0x2A, 0xFE, 0x73, 0xAF, 0xD7, 0x59, 0xAA, 0xA9, 0x75, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x70, 0xCA, 0x1A, 0xC1, 0x9C, 0xAA,
+    0xC9, 0x29, 0xD9, 0x3A, 0xD9, 0x2A, 0xF9, 0x1C, 0x9A, 0xA9, 0xC3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA7, 0x20, 0x49, 0xC7, 0x2A,
+    0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x99, 0x99, 0x9A, 0xCA, 0x09, 0xC5,
+    0xCA, 0x19, 0xC4, 0xCA, 0x29, 0xC3, 0xCA, 0x39, 0xC2, 0x99, 0x49, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7, 0x19, 0xC7,
+    0x19, 0xC7, 0x75, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xFD, 0x1A, 0xCA, 0x99,
+    0x99, 0x99, 0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73, 0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00,
+    0x9F, 0xFA, 0x0A, 0xFF, 0xC0, 0x9F, 0xFA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9A, 0xA3, 0x9A, 0xA0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD,
+    0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92,
+    0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0,
+    0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD,
+    0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92,
+    0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0,
+    0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0x99, 0x93, 0x99, 0x90, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xFA, 0xFF, 0xFF, 0x97, 0x77, 0x71, 0xFF, 0xFF, 0xAF,
+    0xFF, 0xFA, 0x77, 0x00, 0x39, 0x3D, 0xA1, 0xAD, 0x2D, 0x91, 0xAD, 0x2E, 0x19, 0xE1, 0x9E, 0x19,
+    0xEA, 0x1F, 0x29, 0x91, 0x19, 0x92, 0xEA, 0x1F, 0x19, 0xE2, 0xE2, 0xE1, 0x9D, 0x91, 0xAD, 0x2D,
+    0x91, 0xAC, 0xA3, 0x93, 0x0A, 0xD9, 0x1F, 0x1A, 0xE2, 0xE2, 0xE2, 0xDA, 0x19, 0xD2, 0xDA, 0x19,
+    0xD2, 0xAA, 0x30, 0x19, 0x92, 0xF0, 0x9E, 0xA0, 0x9E, 0x19, 0xE2, 0xE2, 0xAD, 0x3D, 0x92, 0xAD,
+    0x3D, 0x93, 0x90, 0x39, 0x59, 0x3D, 0xA3, 0xD2, 0xAD, 0x3D, 0xA2, 0xD9, 0x2A, 0xD2, 0xAD, 0x3D,
+    0xA2, 0xE2, 0x9D, 0xA1, 0x9E, 0x2A, 0xD9, 0x19, 0xE2, 0xEA, 0x19, 0xEA, 0x1A, 0xE2, 0xF2, 0xEA,
+    0x29, 0x94, 0x92, 0x19, 0x94, 0x92, 0xEA, 0x19, 0xE1, 0xF1, 0x9E, 0xA0, 0x9E, 0x2A, 0xE1, 0xE2,
+    0xAE, 0x1E, 0x2A, 0xD9, 0x09, 0xD9, 0x2A, 0xD1, 0xAD, 0x3D, 0xA1, 0xD9, 0x29, 0xD1, 0xAC, 0xA3,
+    0xD9, 0x29, 0x49, 0x30, 0x0A, 0xD9, 0x2A, 0xCA, 0x1F, 0x1A, 0xEA, 0x0A, 0xE2, 0xF1, 0xE2, 0xAE,
+    0x1E, 0x29, 0xDA, 0x1D, 0xA2, 0xAD, 0x90, 0x9D, 0x3E, 0x1D, 0xA2, 0x9D, 0x90, 0x9D, 0x3D, 0xA1,
+    0xAA, 0x4C, 0xA2, 0x19, 0x94, 0x93, 0xF2, 0xE9, 0x09, 0xEA, 0x1A, 0xE9, 0x09, 0xE2, 0xEA, 0x19,
+    0xE2, 0xE9, 0x2E, 0x2A, 0xDA, 0x2A, 0xD3, 0xDA, 0x3D, 0x92, 0xAD, 0x3A, 0xD3, 0xDA, 0x3D, 0x92,
+    0x9D, 0x49, 0x59, 0x00, 0x77, 0x3A, 0xE7, 0x2A, 0xE7, 0x29, 0xE7, 0x29, 0xDA, 0x73, 0xDA, 0x59,
+    0x99, 0x2D, 0x92, 0x9A, 0x0F, 0xCA, 0xFF, 0x9F, 0xFF, 0xD9, 0xAC, 0xA9, 0x90, 0xD9, 0x09, 0xAA,
+    0xC6, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA, 0x73, 0xDA,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x73, 0xAA, 0x95, 0x77, 0x3A, 0xE7, 0x2A, 0xE7, 0x29, 0xE7,
+    0x29, 0xDA, 0x73, 0xDA, 0x59, 0x99, 0x2D, 0x92, 0x9A, 0x0F, 0xCA, 0xFF, 0x9F, 0xFF, 0xD9, 0xAC,
+    0xA9, 0x90, 0xDA, 0x09, 0xAA, 0xC6, 0xDA, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x73,
+    0xDA, 0x59, 0x93, 0xDA, 0x29, 0xA0, 0xFC, 0xAF, 0xF9, 0xFF, 0xFD, 0x9A, 0xCA, 0xA9, 0x0D, 0xA0,
+    0x9A, 0xD6, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xE7, 0x29, 0xE7, 0x2A, 0xE7, 0x3A, 0xA9, 0x50, 0x19,
+    0xAA, 0x92, 0xAF, 0xA1, 0xFD, 0x09, 0xFD, 0x99, 0xFD, 0x1F, 0xCA, 0x2A, 0xCA, 0x91, 0x0A, 0xA7,
+    0x1E, 0xA7, 0xFC, 0xA5, 0xFE, 0xA3, 0xFF, 0xCA, 0x1F, 0xFD, 0xA0, 0xFF, 0xD9, 0x0F, 0xF9, 0x2F,
+    0xD9, 0x4F, 0x96, 0xAC, 0x97, 0x73, 0x0A, 0xD0, 0xAF, 0xFC, 0xAE, 0x90, 0x99, 0x10, 0x09, 0xDA,
+    0x4E, 0x1F, 0x92, 0xFA, 0x0F, 0x92, 0xFA, 0x0F, 0x3A, 0xE9, 0x19, 0x95, 0x99, 0x10, 0x0A, 0xD7,
+    0xAD, 0x7A, 0xD0, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xAF, 0xC5, 0xFC, 0x5F, 0xCA, 0xE9, 0x5A, 0xE9,
+    0x5A, 0xE9, 0x09, 0x97, 0x09, 0x97, 0x09, 0x91, 0x49, 0xE9, 0xAF, 0xAF, 0x9E, 0x50, 0x49, 0xC7,
+    0x2A, 0xC9, 0x71, 0xAC, 0x97, 0x19, 0xC9, 0x1C, 0xA1, 0x9F, 0xC0, 0x9C, 0x92, 0x99, 0xAC, 0xA0,
+    0x9C, 0x5C, 0xA1, 0x9C, 0x4C, 0xA2, 0x9C, 0x3C, 0xA3, 0x9C, 0x29, 0x94, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71, 0x9C, 0x71,
+    0x9C, 0x71, 0x9C, 0x77, 0x50, 0x4C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA7, 0x9C, 0xA7, 0x0F, 0xC9, 0x19,
+    0xC1, 0xAC, 0xA9, 0x93, 0xC9, 0x1A, 0xC5, 0xC9, 0x2A, 0xC4, 0xC9, 0x3A, 0xC3, 0xC9, 0x49, 0x92,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x73, 0x39, 0x96, 0x9D, 0x94, 0x9F, 0x4C,
+    0xAA, 0xA9, 0xC2, 0xCA, 0x0A, 0xA0, 0xAC, 0x0A, 0xA1, 0xAA, 0x1A, 0xA9, 0x2A, 0xA2, 0x93, 0xAA,
+    0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A,
+    0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7, 0xAA, 0x7A, 0xA7,
+    0xAA, 0x75, 0x3A, 0xA1, 0xC9, 0x70, 0xD0, 0x9C, 0xA7, 0x0D, 0x1C, 0xA7, 0x0D, 0x1C, 0xA0, 0xAF,
+    0xFC, 0x1C, 0xAA, 0xC9, 0x99, 0x99, 0xAC, 0x90, 0xAC, 0x0A, 0xA3, 0x9C, 0x90, 0xAC, 0x1A, 0xA2,
+    0x9C, 0x90, 0xAC, 0x2A, 0xA1, 0x9C, 0x90, 0xAC, 0x3A, 0xA1, 0x92, 0x94, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73,
+    0xAA, 0x73, 0xAA, 0x77, 0x71, 0x39, 0xC1, 0xAA, 0x6A, 0xC9, 0x0D, 0x6A, 0xC9, 0x0D, 0x6A, 0xC1,
+    0xD6, 0xAC, 0x1F, 0xFC, 0xA0, 0xCA, 0x09, 0xCA, 0x99, 0x99, 0x9C, 0xA1, 0xCA, 0x09, 0xC9, 0x3A,
+    0xA2, 0xCA, 0x09, 0xC9, 0x2A, 0xA3, 0xCA, 0x09, 0xC9, 0x1A, 0xA4, 0x92, 0x91, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA,
+    0x73, 0xAA, 0x73, 0xAA, 0x73, 0xAA, 0x75, 0x77, 0x4A, 0x77, 0x70, 0x9A, 0xDA, 0x97, 0x1A, 0xD7,
+    0x76, 0xAF, 0xDA, 0x79, 0xD9, 0x77, 0x5A, 0xDA, 0x09, 0xE9, 0x6D, 0xA7, 0x76, 0xDA, 0x3E, 0x59,
+    0xD7, 0x76, 0xAD, 0x4A, 0xD5, 0xDA, 0x77, 0x6E, 0x4A, 0xD4, 0x9D, 0x77, 0x7E, 0x49, 0xD9, 0x3D,
+    0x97, 0x77, 0xDA, 0x49, 0xD9, 0x2A, 0xCA, 0x77, 0x70, 0xE4, 0xAD, 0x3D, 0x77, 0x71, 0xE4, 0xAD,
+    0x2A, 0xC9, 0x39, 0xA9, 0x71, 0x9A, 0xA9, 0x4A, 0xD9, 0x3D, 0xA1, 0x9D, 0x2A, 0xFC, 0xA5, 0x9F,
+    0xD9, 0x3E, 0x2E, 0x2D, 0x2A, 0xDA, 0xAF, 0x39, 0xEA, 0xAE, 0x92, 0xAF, 0xE9, 0x19, 0xCA, 0x19,
+    0xD9, 0x2A, 0xD9, 0x2E, 0x3E, 0x39, 0xFC, 0x3D, 0x2E, 0x4D, 0xA1, 0x9D, 0x93, 0xAD, 0x74, 0xAC,
+    0xA2, 0xDA, 0x4E, 0x1A, 0xD4, 0x9D, 0x97, 0x29, 0xD2, 0x9D, 0x94, 0xE1, 0xE4, 0x9D, 0x97, 0x2D,
+    0x92, 0x9D, 0x94, 0xAD, 0x1E, 0x49, 0xD9, 0x71, 0xAD, 0x39, 0xD9, 0x4E, 0x1E, 0x49, 0xD9, 0x71,
+    0xD9, 0x4D, 0xA4, 0xDA, 0x1E, 0x4A, 0xD7, 0x1D, 0xA5, 0xE3, 0x9D, 0x91, 0xAD, 0x93, 0xE7, 0x09,
+    0xD6, 0xAD, 0x92, 0xE3, 0xE2, 0x9D, 0x97, 0x0D, 0xA7, 0xEA, 0xAE, 0x93, 0xAE, 0xAA, 0xDA, 0x70,
+    0xAD, 0x71, 0xFD, 0x95, 0xAF, 0xCA, 0x71, 0xAC, 0x97, 0x29, 0x99, 0x97, 0x19, 0x99, 0x74, 0x97,
+    0x77, 0x71, 0x3A, 0x93, 0xAD, 0x92, 0xE9, 0x19, 0xE2, 0xEA, 0x19, 0xE2, 0xE9, 0x2D, 0xA2, 0xAD,
+    0x39, 0xC7, 0x30, 0x3A, 0x93, 0xAA, 0x3A, 0xD9, 0x2D, 0xA2, 0xE9, 0x1A, 0xE1, 0x9E, 0x2E, 0xA1,
+    0xEA, 0x19, 0xE1, 0x9E, 0x2E, 0x91, 0xE9, 0x19, 0xE2, 0xDA, 0x2E, 0x2A, 0xD3, 0xD9, 0x29, 0xC4,
+    0xCA, 0x77, 0x00, 0x3A, 0x93, 0xAA, 0x39, 0xA4, 0xAD, 0x92, 0xDA, 0x2A, 0xD3, 0xE9, 0x1A, 0xE2,
+    0xE9, 0x19, 0xE2, 0xEA, 0x1A, 0xE2, 0xEA, 0x19, 0xE2, 0xE9, 0x19, 0xE2, 0xE9, 0x19, 0xE2, 0xE9,
+    0x19, 0xE2, 0xE9, 0x2D, 0xA2, 0xE2, 0x9D, 0xA2, 0xAD, 0x3D, 0x92, 0xAD, 0x39, 0xC4, 0xCA, 0x39,
+    0xC7, 0x77, 0x00, 0x09, 0xA3, 0xAD, 0x3E, 0xA2, 0x9E, 0x3E, 0xA2, 0x9E, 0x3A, 0xD9, 0x3E, 0x39,
+    0xD4, 0xAC, 0x70, 0x09, 0xA4, 0x9A, 0x3A, 0xD3, 0x9D, 0x92, 0xEA, 0x2A, 0xE2, 0x9E, 0x29, 0xE9,
+    0x2E, 0xA2, 0xEA, 0x29, 0xE3, 0xE3, 0xAD, 0x92, 0xAD, 0xA3, 0xE3, 0xE3, 0x9D, 0x4D, 0x93, 0xAC,
+    0x49, 0xC7, 0x60, 0x09, 0xA4, 0x9A, 0x49, 0xA3, 0xAD, 0x39, 0xD9, 0x29, 0xDA, 0x2E, 0xA2, 0xAE,
+    0x29, 0xE2, 0x9E, 0x29, 0xE9, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xAE, 0x29, 0xE3, 0xE3, 0xE9, 0x2A,
+    0xD9, 0x2A, 0xDA, 0x29, 0xE3, 0xE3, 0xE3, 0xAD, 0x92, 0x9D, 0x4D, 0x93, 0xDA, 0x3A, 0xC4, 0x9C,
+    0x5C, 0x97, 0x74, 0x59, 0xA7, 0x29, 0xDA, 0x70, 0x9F, 0xA6, 0x9D, 0xA0, 0xDA, 0x49, 0xDA, 0x2D,
+    0xA2, 0x9D, 0xA4, 0xDA, 0x1A, 0xCA, 0x6D, 0x90, 0x59, 0x5D, 0xA3, 0xE2, 0x9E, 0x29, 0xE9, 0x1A,
+    0xEA, 0x2F, 0x3A, 0xE4, 0xAE, 0x49, 0xE4, 0x9D, 0xA5, 0xDA, 0x59, 0x90, 0x09, 0x7D, 0x96, 0xDA,
+    0x59, 0xE5, 0xAE, 0x5A, 0xE5, 0xE9, 0x3F, 0x3A, 0xE9, 0x29, 0xE4, 0xE4, 0xDA, 0x59, 0x95, 0x77,
+    0x49, 0xC7, 0x7A, 0xC1, 0xD6, 0x95, 0xAC, 0xA2, 0xD4, 0xDA, 0x3A, 0xCA, 0x4D, 0x29, 0xE2, 0x9C,
+    0xA5, 0x9D, 0x2A, 0xC9, 0x19, 0xD7, 0x9D, 0x59, 0xD7, 0x19, 0xCA, 0x4D, 0x73, 0x9C, 0xA2, 0xD7,
+    0x5A, 0xCA, 0x0D, 0x71, 0xE2, 0xAE, 0x29, 0xD9, 0x3E, 0x3D, 0xA2, 0xAD, 0xA3, 0xAC, 0xA2, 0xF9,
+    0x2D, 0x97, 0x0A, 0xC9, 0x0D, 0x97, 0x4A, 0xC9, 0x2D, 0x73, 0xAC, 0xA4, 0xD7, 0x1A, 0xCA, 0x6D,
+    0x79, 0xCA, 0x2D, 0x92, 0xD5, 0x9C, 0xA2, 0x9E, 0x29, 0xD3, 0x9D, 0x4D, 0xA3, 0x9D, 0x2D, 0x75,
+    0x9C, 0xA0, 0x9C, 0x77, 0x9C, 0x77, 0x50, 0x1A, 0xAA, 0x5A, 0xAA, 0x1E, 0xA4, 0xEA, 0x1E, 0x94,
+    0xE9, 0x09, 0xE9, 0x39, 0xE9, 0x09, 0xE4, 0x9E, 0x19, 0xE4, 0x9E, 0x19, 0xE4, 0x9E, 0x19, 0xE4,
+    0x9E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E, 0x5E, 0x2E,
+    0x5A, 0xD2, 0xAD, 0x5A, 0xD2, 0xAD, 0x5A, 0xD3, 0x97, 0x97, 0x77, 0x71, 0x9A, 0xA9, 0x5A, 0xA9,
+    0x1F, 0x4F, 0x1F, 0x4F, 0x1F, 0x4F, 0x29, 0x96, 0x99, 0x10, 0xFF, 0xFF, 0x9F, 0xFF, 0xFA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9F, 0xCA, 0x9A, 0xFD, 0xA9, 0xFD, 0x90, 0x74,
+    0x9A, 0x75, 0xDA, 0x73, 0x9D, 0x74, 0xDA, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD9, 0x73,
+    0xAD, 0x74, 0xD7, 0x4A, 0xCA, 0x74, 0xD7, 0x4A, 0xC9, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0x9D, 0x74,
+    0xD7, 0x4A, 0xCA, 0x74, 0xD7, 0x4D, 0xA7, 0x39, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x4D, 0x97, 0x3A,
+    0xD7, 0x5A, 0x97, 0x77, 0x40, 0x09, 0xAD, 0xA9, 0x79, 0xEA, 0x95, 0xFE, 0x94, 0x9F, 0xE3, 0x9F,
+    0xF9, 0x3A, 0xFF, 0x3D, 0xAA, 0xAF, 0x39, 0xDA, 0xAA, 0xF7, 0x0A, 0xE7, 0x1E, 0xA7, 0x0A, 0xD9,
+    0x71, 0xE7, 0x1D, 0xA7, 0x2D, 0x97, 0x0A, 0xCA, 0x72, 0xDA, 0x70, 0xE7, 0x2D, 0xA7, 0xAD, 0xA7,
+    0x1A, 0xD9, 0x49, 0xAF, 0x96, 0xAF, 0xC2, 0x9F, 0xEA, 0x4A, 0xFE, 0xA2, 0xFE, 0xA5, 0xFE, 0x93,
+    0xFC, 0x97, 0xFC, 0x95, 0xAD, 0x97, 0x1E, 0x70, 0x9D, 0x72, 0xAC, 0xA7, 0x1D, 0x72, 0x9D, 0x71,
+    0x97, 0x49, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xA7, 0x2A, 0xAA, 0x79, 0xEA, 0x70, 0xAE, 0xA6, 0xAF,
+    0x70, 0xAE, 0xA6, 0x9E, 0xA7, 0x0A, 0xE9, 0x79, 0x99, 0x72, 0x99, 0x60, 0x77, 0x09, 0xAA, 0x90,
+    0x9A, 0xDA, 0x97, 0x1E, 0x90, 0xFE, 0x96, 0xAE, 0x09, 0xFF, 0x95, 0xAE, 0x1D, 0xAA, 0xAF, 0x5A,
+    0xE7, 0xAE, 0x4A, 0xE7, 0x0A, 0xD9, 0x3A, 0xDA, 0x71, 0xDA, 0x3A, 0xDA, 0x71, 0xAC, 0xA3, 0xAD,
+    0xA7, 0x1E, 0x3A, 0xDA, 0x70, 0xAD, 0xA3, 0xAD, 0x95, 0x9A, 0xF9, 0x39, 0xD9, 0x29, 0xFE, 0xA4,
+    0x9D, 0x92, 0xFE, 0xA5, 0x9D, 0x92, 0xFC, 0x97, 0x0D, 0x92, 0xAD, 0x97, 0x2D, 0x92, 0x9D, 0x73,
+    0xD9, 0x3D, 0x73, 0xD9, 0x39, 0x74, 0x97, 0x77, 0x77, 0x79, 0xAA, 0x72, 0x9A, 0xA2, 0x9E, 0xA7,
+    0x09, 0xEA, 0x1A, 0xF7, 0x0A, 0xF1, 0x9E, 0xA7, 0x09, 0xE9, 0x29, 0x99, 0x72, 0x99, 0x90, 0x1A,
+    0xAA, 0x77, 0x0E, 0xA4, 0x9A, 0xDA, 0x95, 0xE9, 0x4F, 0xE9, 0x29, 0xE9, 0x39, 0xFF, 0x91, 0x9E,
+    0x5D, 0xAA, 0xAF, 0x19, 0xE7, 0x3A, 0xE0, 0x9E, 0x74, 0xAD, 0x99, 0xE7, 0x5D, 0xA0, 0xE7, 0x5A,
+    0xD0, 0xE7, 0x5E, 0x0E, 0x74, 0xAD, 0xA0, 0xE7, 0x19, 0xAF, 0x90, 0xE6, 0x9F, 0xEA, 0x1E, 0x6F,
+    0xEA, 0x2E, 0x6F, 0xC9, 0x4E, 0x6A, 0xD9, 0x6A, 0xD6, 0x9D, 0x7A, 0xD7, 0xD7, 0x09, 0x70, 0x97,
+    0x77, 0x77, 0x72, 0x9A, 0xA9, 0x69, 0xAA, 0x6F, 0x59, 0xEA, 0x5F, 0x59, 0xF5, 0xF5, 0x9E, 0xA6,
+    0x99, 0x79, 0x99, 0x50, 0x77, 0x59, 0xAD, 0xA9, 0x69, 0xA2, 0xFF, 0x93, 0x9D, 0x1A, 0xDA, 0x99,
+    0xFC, 0xAA, 0xEA, 0x1D, 0x49, 0xAF, 0xDA, 0x29, 0x97, 0x9A, 0xAA, 0x30, 0x3A, 0x93, 0xAA, 0x39,
+    0xA4, 0xA9, 0x3A, 0xD9, 0x2D, 0xA2, 0xAD, 0x29, 0xDA, 0x2E, 0x91, 0xAE, 0x2E, 0x91, 0xAD, 0xA1,
+    0x9E, 0x2E, 0xA1, 0xAE, 0x2E, 0x91, 0xEA, 0x19, 0xE2, 0xE9, 0x1A, 0xE1, 0x9E, 0x2E, 0x91, 0x9E,
+    0x2E, 0x91, 0xE9, 0x19, 0xE2, 0xE9, 0x19, 0xDA, 0x2D, 0xA2, 0xE2, 0x9D, 0xA2, 0xE2, 0xAD, 0x3D,
+    0x92, 0xAD, 0x29, 0xD9, 0x29, 0xC4, 0xCA, 0x39, 0xC4, 0xCA, 0x77, 0x75, 0x77, 0x9F, 0xCA, 0x4A,
+    0xFF, 0x29, 0xE9, 0x09, 0xEA, 0x1E, 0x4E, 0x09, 0xDA, 0x4A, 0xD9, 0xAD, 0x94, 0x9D, 0x9E, 0x59,
+    0xDA, 0xE5, 0x9D, 0xAE, 0x59, 0xDA, 0xE5, 0xAD, 0x9A, 0xD9, 0x4E, 0x09, 0xE3, 0x9E, 0x1E, 0xA1,
+    0x9E, 0x29, 0xFF, 0x94, 0xAF, 0xA7, 0x70, 0x77, 0x3A, 0xD7, 0x0A, 0xE7, 0x9F, 0x7F, 0xC6, 0xEA,
+    0xD5, 0xAD, 0x0A, 0xD4, 0x9D, 0x90, 0xAD, 0x4D, 0xA1, 0xAD, 0x3E, 0x2A, 0xD2, 0xAD, 0xA9, 0x99,
+    0xE9, 0x90, 0xAF, 0xFE, 0xA0, 0xAA, 0xAA, 0xAA, 0xEA, 0xA9, 0x6A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7,
+    0x70, 0x1A, 0xFD, 0x91, 0xFE, 0xA1, 0xDA, 0xAA, 0xAA, 0x91, 0xD9, 0x6D, 0x69, 0xFA, 0x92, 0x9F,
+    0xDA, 0x49, 0xAE, 0x96, 0xE6, 0xE6, 0xE5, 0x9D, 0xA3, 0x9F, 0x0F, 0xF1, 0x9F, 0xC9, 0x74, 0x77,
+    0x09, 0xAE, 0x5A, 0xFA, 0x93, 0xEA, 0x6E, 0x96, 0xAD, 0x97, 0xEA, 0xCA, 0x93, 0xAF, 0xF9, 0x1E,
+    0xA9, 0x9A, 0xE9, 0x0E, 0x39, 0xE0, 0xE4, 0xE0, 0xE4, 0xE0, 0xAD, 0x93, 0xE0, 0x9E, 0x91, 0xAD,
+    0x91, 0xAF, 0xF3, 0x9F, 0xC9, 0x76, 0x0A, 0xFF, 0xA1, 0xFF, 0xD1, 0xDA, 0xAA, 0xAA, 0xE1, 0xD3,
+    0x9D, 0x91, 0xC9, 0x3D, 0xA7, 0xE7, 0x9D, 0x97, 0xDA, 0x79, 0xD9, 0x7E, 0x79, 0xD9, 0x7A, 0xD7,
+    0x0E, 0x70, 0xDA, 0x70, 0xD9, 0x77, 0x10, 0x75, 0xAF, 0xA2, 0x9F, 0xEA, 0x1D, 0xA2, 0xAD, 0x09,
+    0xD9, 0x29, 0xD9, 0x0D, 0xA2, 0x9D, 0x1E, 0xA0, 0x9D, 0xA2, 0xFD, 0x93, 0x9F, 0xCA, 0x2A, 0xD9,
+    0x9F, 0x0A, 0xD9, 0x2A, 0xD9, 0xE4, 0xDA, 0xE4, 0xDA, 0xAD, 0x92, 0xAD, 0x90, 0xFF, 0xA2, 0xAF,
+    0xC9, 0x74, 0x74, 0x9F, 0xC9, 0x2A, 0xFE, 0x90, 0x9E, 0x19, 0xE0, 0xAD, 0x39, 0xDA, 0xE4, 0xFD,
+    0x4E, 0xAD, 0xA3, 0xE0, 0xFA, 0x9A, 0xE1, 0xFF, 0xA2, 0x9A, 0xCA, 0xE6, 0x9D, 0xA6, 0xE5, 0xAE,
+    0x91, 0x9A, 0xFC, 0x93, 0xFA, 0x77, 0x1A, 0xAC, 0x09, 0xEA, 0x39, 0xFA, 0xFC, 0xA3, 0x9A, 0xE9,
+    0x1E, 0x49, 0xD9, 0x29, 0xD4, 0x9D, 0x92, 0x9D, 0x93, 0x9D, 0x92, 0x9D, 0x93, 0x9D, 0x92, 0x9D,
+    0x93, 0x9D, 0x92, 0x9D, 0x93, 0x9D, 0x92, 0x9D, 0x92, 0x9F, 0x91, 0xFA, 0x1F, 0xCA, 0x0A, 0xFC,
+    0x00, 0x49, 0xA9, 0x96, 0xAF, 0xD9, 0x3F, 0xFC, 0x91, 0xAD, 0xA2, 0xAE, 0x1E, 0x4E, 0x09, 0xD9,
+    0x4A, 0xD9, 0xAD, 0x59, 0xDA, 0xE5, 0x9D, 0xAE, 0x59, 0xDA, 0xE5, 0x9D, 0x9A, 0xD5, 0xAD, 0x9A,
+    0xDA, 0x4E, 0x1E, 0x3A, 0xDA, 0x1A, 0xEA, 0xAF, 0x3A, 0xFE, 0x59, 0xAA, 0xAA, 0x93, 0x59, 0x59,
+    0xAD, 0x92, 0xFD, 0x3A, 0xFC, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6,
+    0xAD, 0x6A, 0xD4, 0x9A, 0xFA, 0x90, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x90, 0x39, 0xAA, 0x95, 0xAF,
+    0xD3, 0xFA, 0xF1, 0xAD, 0x92, 0xE9, 0x0A, 0xD3, 0xAD, 0x91, 0xAA, 0x3A, 0xD9, 0x7E, 0x7A, 0xD9,
+    0x6A, 0xD9, 0x6A, 0xDA, 0x6A, 0xD9, 0x6E, 0x96, 0xE9, 0x6A, 0xFF, 0xD0, 0xAF, 0xFD, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x10, 0x29, 0x9A, 0x94, 0x9F, 0xDA, 0x19, 0xEA, 0xAE, 0xA0, 0xAC, 0xA3, 0xE1,
+    0xA4, 0xDA, 0x6A, 0xD9, 0x49, 0xE9, 0x3A, 0xFC, 0x93, 0xAF, 0xD9, 0x7E, 0x7A, 0xD7, 0xE6, 0xAD,
+    0xA1, 0x99, 0xAA, 0xF1, 0xAF, 0xDA, 0x3A, 0xCA, 0xA9, 0x40, 0x79, 0x97, 0x1E, 0x70, 0xF7, 0xAF,
+    0x69, 0xFC, 0x6D, 0xAA, 0xD5, 0xE0, 0xAD, 0x4A, 0xD1, 0xAD, 0x39, 0xD9, 0x1A, 0xD3, 0xDA, 0x2A,
+    0xD2, 0xAF, 0xFE, 0x99, 0xFF, 0xEA, 0x19, 0x99, 0x99, 0xAD, 0x99, 0x7A, 0xD7, 0x1A, 0xD7, 0x19,
+    0xCA, 0x20, 0x73, 0xFE, 0xA1, 0xFE, 0xA1, 0xD9, 0x6D, 0x69, 0xDA, 0x94, 0x9F, 0xCA, 0x29, 0xAF,
+    0xD6, 0xAD, 0xA6, 0xE6, 0xE6, 0xDA, 0x5E, 0x99, 0x99, 0xAF, 0xA0, 0xFE, 0x92, 0xAC, 0xAA, 0x93,
+    0x69, 0xA9, 0x6A, 0xF9, 0x39, 0xF9, 0x4A, 0xE9, 0x59, 0xE7, 0xE9, 0x69, 0xFE, 0x92, 0xAF, 0xFC,
+    0x1E, 0x29, 0xEA, 0x0E, 0x4E, 0x0E, 0x4E, 0x0E, 0x4E, 0x0A, 0xDA, 0x3D, 0xA1, 0xF9, 0xAE, 0x92,
+    0xFE, 0x94, 0x9A, 0xCA, 0x93, 0x74, 0xFF, 0xD1, 0xFF, 0xD1, 0xD4, 0xDA, 0x1C, 0xA3, 0xAD, 0x2A,
+    0x92, 0x9D, 0x97, 0xDA, 0x7A, 0xD7, 0x0D, 0xA7, 0xAD, 0x70, 0xDA, 0x79, 0xD9, 0x7E, 0x70, 0xDA,
+    0x70, 0xD9, 0x70, 0x9C, 0x60, 0x39, 0xA9, 0x94, 0xAF, 0xD9, 0x1A, 0xDA, 0x9A, 0xE1, 0xD9, 0x29,
+    0xD9, 0x9D, 0x92, 0x9D, 0x1E, 0x2A, 0xD1, 0x9E, 0x9E, 0x39, 0xFC, 0x4F, 0xE9, 0x1E, 0x1A, 0xE0,
+    0xAD, 0x39, 0xDA, 0xDA, 0x4D, 0xAE, 0x4D, 0xAA, 0xDA, 0x90, 0x9E, 0x1F, 0xF3, 0x9A, 0xAC, 0xA9,
+    0x20, 0x39, 0xA9, 0x5F, 0xDA, 0x2F, 0xAE, 0xA0, 0x9D, 0x92, 0xAD, 0x9E, 0x4D, 0xAE, 0x4E, 0xAD,
+    0x4E, 0x9E, 0x3E, 0x0A, 0xFF, 0xA1, 0xAF, 0xE9, 0x39, 0x99, 0xE6, 0xAD, 0xA5, 0xAE, 0x4A, 0xF2,
+    0x9F, 0xCA, 0x4A, 0xCA, 0xA5, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF,
+    0x19, 0xAF, 0xFF, 0xD4, 0xE9, 0x5A, 0xD4, 0xE9, 0x59, 0xD4, 0xE9, 0x6D, 0x4E, 0x96, 0x95, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x75, 0xFF, 0xEA, 0x5F, 0xFE, 0x95, 0xEA, 0x99, 0x99, 0x99, 0x96, 0xE9,
+    0x75, 0xE9, 0x72, 0x99, 0x9E, 0xA9, 0x99, 0x7F, 0xFD, 0x96, 0x9A, 0xAE, 0xAA, 0xAA, 0x72, 0xE9,
+    0x75, 0xE9, 0x75, 0xEA, 0x97, 0x1A, 0xFF, 0xC7, 0xFF, 0xD6, 0x71, 0x9A, 0xDA, 0x97, 0x29, 0xFF,
+    0x71, 0xFA, 0xAE, 0xA7, 0xE9, 0x29, 0xE6, 0x9D, 0xA4, 0xAD, 0x6A, 0xD9, 0x4A, 0xCA, 0x6E, 0x69,
+    0x7D, 0xA7, 0x69, 0xDA, 0x76, 0xAD, 0x93, 0x99, 0x5F, 0xFF, 0xA5, 0xFF, 0xF9, 0x70, 0xE7, 0x49,
+    0x99, 0xE9, 0x99, 0x99, 0x95, 0xAF, 0xFF, 0x5A, 0xAA, 0xAE, 0xAA, 0xAA, 0xA9, 0x70, 0xAD, 0x97,
+    0x6E, 0x77, 0xE7, 0x69, 0xD9, 0x74, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0x90, 0x9F, 0xFF,
+    0xF9, 0x1F, 0xAA, 0xFF, 0xD2, 0x9C, 0xA7, 0x99, 0x99, 0x20, 0x09, 0x9A, 0xAA, 0xFC, 0xA9, 0x77,
+    0x71, 0xFF, 0xFD, 0x97, 0x77, 0x9F, 0xCA, 0x99, 0x9A, 0xFA, 0x77, 0x71, 0xE9, 0x4A, 0xE7, 0x77,
+    0x1E, 0x95, 0xEA, 0x77, 0x70, 0xE9, 0x5A, 0xE7, 0x77, 0x0E, 0x95, 0x9E, 0x3D, 0x77, 0x2E, 0x95,
+    0x9D, 0xA2, 0x9D, 0x77, 0x2E, 0x95, 0xAD, 0xA2, 0xAD, 0x77, 0x2E, 0x95, 0xE2, 0x9E, 0xAA, 0xAA,
+    0x93, 0xAE, 0xA9, 0x3E, 0x93, 0x9E, 0xA0, 0xAF, 0xFC, 0xA1, 0x9F, 0xEA, 0x2E, 0xA9, 0x9A, 0xFA,
+    0x19, 0xAA, 0xEA, 0xAA, 0xA2, 0xDA, 0x2A, 0xCA, 0x2F, 0xFD, 0x95, 0xE5, 0x9D, 0x39, 0xC9, 0x2F,
+    0xEA, 0x97, 0xE5, 0x9D, 0x97, 0x0E, 0x97, 0x4E, 0x6E, 0xA7, 0xE9, 0x74, 0xE6, 0xAF, 0xC9, 0x4E,
+    0x97, 0x4E, 0x79, 0xFD, 0x3E, 0x97, 0x4E, 0x72, 0xAE, 0xA2, 0xE9, 0x74, 0xE6, 0x94, 0xE2, 0xE9,
+    0x74, 0xE5, 0x9C, 0xA3, 0xE1, 0x9E, 0xA9, 0x73, 0xAD, 0xA4, 0x9C, 0xA3, 0xDA, 0x9F, 0xFC, 0x71,
+    0x9F, 0xE0, 0xAD, 0xAA, 0xAE, 0x0F, 0xFD, 0x72, 0xAF, 0xC9, 0x09, 0xFE, 0x77, 0x70, 0x99, 0x95,
+    0x99, 0x93, 0x72, 0x9A, 0xEA, 0x97, 0x2A, 0xFF, 0xCA, 0x7F, 0xFE, 0xA6, 0xF9, 0x39, 0xD9, 0x5F,
+    0x6D, 0x94, 0xAE, 0x7D, 0x5E, 0x97, 0xA5, 0xAE, 0x77, 0xE9, 0x74, 0xAF, 0xFF, 0x95, 0xFF, 0xFC,
+    0x70, 0x9E, 0x75, 0x99, 0xAE, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0x95, 0x9A, 0xAF, 0xAA, 0xAA,
+    0xAA, 0x72, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0xA7, 0x7A, 0xEA, 0x77, 0xFC, 0xA9, 0x99,
+    0x9A, 0xD9, 0x6F, 0xFF, 0x70, 0x9F, 0xFA, 0x74, 0x99, 0x99, 0x93, 0x49, 0x77, 0x09, 0xD7, 0x69,
+    0xD9, 0x75, 0x9D, 0x97, 0x59, 0xD9, 0x75, 0x9D, 0xA9, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xE9, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x09, 0xD9, 0x77, 0xAD, 0x97, 0x7A,
+    0xD9, 0x77, 0xAD, 0x77, 0x0A, 0x97, 0x30, 0x49, 0xC9, 0x70, 0x9E, 0x96, 0x9F, 0xC9, 0x49, 0xFE,
+    0x92, 0x9D, 0x9A, 0xC9, 0x9D, 0x90, 0xAD, 0x90, 0xAC, 0x90, 0x9D, 0x99, 0xC9, 0x1A, 0xCA, 0x19,
+    0xC9, 0x4A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1D,
+    0xA7, 0x1A, 0xCA, 0x40, 0x74, 0x97, 0x70, 0xD9, 0x77, 0x9D, 0x97, 0x79, 0xD9, 0x77, 0x9D, 0x90,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x9A, 0xD9, 0xFF, 0xFF, 0xEA, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xD9, 0x75, 0x9D, 0x97, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x6D, 0xA7, 0x79, 0xA4, 0x4A,
+    0xCA, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xCA, 0x5C, 0x91, 0xAC, 0xA1, 0x9C, 0x0A, 0xD9, 0x0A, 0xC9, 0x09, 0xDA, 0x0A, 0xD0, 0xAC, 0x99,
+    0xDA, 0x2A, 0xDA, 0xCA, 0xDA, 0x4A, 0xFC, 0xA6, 0xAE, 0x97, 0x09, 0xC9, 0x40, 0x5A, 0x6A, 0x72,
+    0xDA, 0x4A, 0xCA, 0x70, 0xAD, 0x6D, 0xA6, 0xAD, 0x70, 0xDA, 0x4A, 0xD7, 0x2D, 0xA2, 0xAD, 0xA9,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA1, 0xFF, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xDA, 0x2E, 0x72, 0xE4, 0xE7, 0x0E, 0x6E, 0x6E, 0x70, 0xDA, 0x4A, 0xD7, 0x2A, 0x6A, 0x50,
+    0x77, 0x1A, 0xCA, 0x70, 0xAE, 0xA6, 0xAF, 0xCA, 0x4A, 0xDA, 0xCA, 0xDA, 0x2E, 0x0A, 0xCA, 0x0E,
+    0x0A, 0xD1, 0xAC, 0xA1, 0xDA, 0x0C, 0x2A, 0xCA, 0x2C, 0x5A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA,
+    0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x5A, 0x2A, 0xCA, 0x2A, 0x0A, 0xD1,
+    0xAC, 0xA1, 0xDA, 0x0E, 0x0A, 0xCA, 0x0E, 0x2E, 0xAC, 0xAE, 0x4F, 0xE6, 0xFC, 0x70, 0xE7, 0x29,
+    0x50, 0x59, 0xC9, 0x72, 0xAE, 0xA7, 0x0A, 0xFC, 0xA6, 0xAD, 0xAC, 0xAD, 0xA4, 0xAD, 0x9A, 0xCA,
+    0x9D, 0xA2, 0xAD, 0x90, 0xAC, 0xA0, 0x9D, 0xA2, 0xC9, 0x1A, 0xCA, 0x19, 0xC7, 0xAC, 0xA7, 0x3A,
+    0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0xC9, 0x1A, 0xCA, 0x19, 0xC2, 0xAD, 0x90,
+    0xAC, 0xA0, 0x9D, 0xA2, 0xAD, 0x9A, 0xCA, 0x9D, 0xA4, 0xAF, 0xEA, 0x69, 0xFC, 0x97, 0x09, 0xE9,
+    0x72, 0xAC, 0xA5, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x76, 0x71, 0xAC, 0xA7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1A, 0xCA, 0x4A, 0x3A, 0xCA, 0x3A, 0xD2, 0xAC, 0xA2, 0xAD,
+    0x92, 0xAC, 0xA1, 0xAD, 0x93, 0xAC, 0xA0, 0x9D, 0x94, 0xAC, 0xA9, 0xDA, 0x99, 0x99, 0x99, 0xDA,
+    0xFF, 0xFA, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD9, 0x71,
+    0xAD, 0x72, 0xA6, 0xAC, 0xA7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA3, 0xA4, 0xAC, 0xA2, 0xDA, 0x3A, 0xCA, 0x29, 0xDA, 0x2A, 0xCA, 0x39, 0xD9, 0x1A,
+    0xCA, 0x49, 0xD9, 0x0A, 0xD9, 0x99, 0x99, 0x9A, 0xD9, 0xAF, 0xFF, 0x9A, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x97, 0x9D, 0x97, 0x9D, 0xA7, 0x9D, 0xA7, 0x0D, 0xA7, 0x2A, 0x40, 0x76, 0xAD, 0x77, 0xAD, 0x6A,
+    0x7A, 0xD5, 0xAD, 0x6A, 0xD4, 0xAD, 0x96, 0xAD, 0x3A, 0xD9, 0x7A, 0xD2, 0xAD, 0x71, 0xAD, 0x19,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0x1F, 0xFF, 0xFC, 0x1A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x92, 0xAD, 0x77, 0x0A, 0xD7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xA7, 0x30, 0x77, 0x79,
+    0xC9, 0x76, 0x9D, 0x97, 0x59, 0xD9, 0x75, 0x9E, 0xAA, 0xFF, 0xE0, 0x9F, 0xFF, 0xFC, 0x9D, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x77, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x09, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xF2, 0xAD, 0x77, 0x0A, 0xD9, 0x77, 0xAC, 0xA7,
+    0x70, 0x97, 0x30, 0x59, 0xC9, 0x72, 0x9E, 0x97, 0x09, 0xDA, 0xD9, 0x69, 0xD9, 0x09, 0xD9, 0x49,
+    0xE9, 0x09, 0xE9, 0x29, 0xF9, 0x09, 0xF9, 0x09, 0xD9, 0xD9, 0x09, 0xD9, 0xD9, 0x0A, 0x90, 0xD9,
+    0x09, 0xD0, 0x9A, 0x4D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D,
+    0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90,
+    0x9D, 0x7D, 0x90, 0x9D, 0x30, 0x77, 0x75, 0x9C, 0x97, 0x79, 0xD9, 0x77, 0x9D, 0x92, 0xFF, 0xEA,
+    0xAE, 0x91, 0xFF, 0xFF, 0xC9, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x97, 0x79,
+    0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x9F, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xA7,
+    0x6D, 0xA7, 0x59, 0xDA, 0x76, 0xAC, 0xA7, 0x70, 0x95, 0x3D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D,
+    0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90,
+    0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x7D, 0x90, 0x9D, 0x49, 0x90, 0xD9, 0x09, 0xD0, 0x99,
+    0x09, 0xD0, 0xD9, 0x09, 0xD0, 0xD9, 0x0A, 0xF9, 0x09, 0xFA, 0x2A, 0xE9, 0x09, 0xEA, 0x4A, 0xD9,
+    0x09, 0xDA, 0x6A, 0xD9, 0xDA, 0x70, 0x9E, 0x97, 0x29, 0xC9, 0x50, 0x77, 0x72, 0xD4, 0xD7, 0x2E,
+    0x4E, 0x70, 0xDA, 0x6A, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xFF, 0xFF, 0xC2, 0xAD, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA0, 0x9D, 0x76, 0xD9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xAD, 0x2F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE6, 0xDA, 0x6A, 0xD7, 0x0D, 0xA4, 0xAD, 0x72,
+    0xD4, 0xD7, 0x77, 0x20, 0x0E, 0xA7, 0x5E, 0x1A, 0xE7, 0x4A, 0xDA, 0x19, 0xE9, 0x73, 0xE3, 0xF7,
+    0x29, 0xE3, 0xAE, 0x72, 0xAD, 0x94, 0xEA, 0x71, 0xE5, 0xAE, 0x70, 0x9D, 0xA5, 0x9E, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x7F, 0xFF, 0xDA, 0x7A, 0xFA, 0xAA, 0xAA, 0xAE, 0x97, 0x0E, 0x95, 0xE7, 0x1F,
+    0x49, 0xD9, 0x71, 0x9E, 0x4E, 0x73, 0xEA, 0x3D, 0xA7, 0x3A, 0xE2, 0xAD, 0x75, 0xE9, 0x1E, 0x75,
+    0xEA, 0x09, 0xD9, 0x75, 0x9E, 0x0A, 0xD7, 0x7E, 0x9D, 0xA7, 0x7A, 0xFC, 0x77, 0x09, 0xFA, 0x77,
+    0x1F, 0x97, 0x71, 0xAD, 0x97, 0x73, 0x97, 0x30, 0x69, 0x99, 0x97, 0x2A, 0xFD, 0xA7, 0xFF, 0xD5,
+    0x9C, 0xA3, 0x9E, 0xA7, 0x49, 0xE7, 0x5E, 0x97, 0x49, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0xAA, 0xDA,
+    0x9E, 0x5A, 0xFF, 0xD4, 0xF9, 0x99, 0xFC, 0x3E, 0x94, 0xAE, 0x2A, 0xD9, 0x6E, 0x2E, 0x69, 0xDA,
+    0x1A, 0xD9, 0x69, 0xD9, 0x1E, 0x7A, 0xD9, 0x1E, 0x7E, 0x19, 0xE7, 0xDA, 0x19, 0xDA, 0x6A, 0xD9,
+    0x19, 0xDA, 0x6E, 0x29, 0xE5, 0xAD, 0x4E, 0x49, 0xDA, 0x4F, 0x91, 0xAD, 0xA6, 0xFF, 0xA7, 0x0F,
+    0xD9, 0x73, 0x99, 0x71, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xCA, 0x9F, 0xDA, 0xAA, 0xAF, 0x72, 0xAE,
+    0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x0F, 0xFC, 0xAF, 0x0F,
+    0xFF, 0xD0, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7,
+    0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xEA, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xDA, 0xFF, 0xFD,
+    0x00, 0x77, 0x77, 0x76, 0xAA, 0x70, 0x9F, 0xEA, 0x92, 0xAD, 0x95, 0xAF, 0xFF, 0x09, 0xDA, 0x5F,
+    0xCA, 0xA9, 0x9A, 0xFE, 0xA5, 0xFA, 0x7F, 0xC5, 0xAE, 0x97, 0x09, 0xF5, 0xE9, 0x70, 0x9F, 0xCA,
+    0x3A, 0xDA, 0x71, 0xE9, 0xE3, 0xE7, 0x1E, 0x1E, 0x91, 0x9E, 0x70, 0xE2, 0xAD, 0xA1, 0xAD, 0xA7,
+    0xE3, 0x9D, 0xA1, 0xAD, 0x96, 0xE4, 0x9D, 0xA1, 0xAD, 0x95, 0xE5, 0x9D, 0xA1, 0xE9, 0x4E, 0x69,
+    0xDA, 0x1A, 0xD9, 0x3E, 0x96, 0xAD, 0xA1, 0xAD, 0xA2, 0xE9, 0x7E, 0x91, 0x9E, 0x1A, 0xD9, 0x70,
+    0xE3, 0xE0, 0xAD, 0x97, 0x0A, 0xE3, 0xAF, 0xC9, 0x71, 0xE9, 0x4F, 0xA7, 0x1F, 0x5A, 0xEA, 0x79,
+    0xF5, 0x9F, 0xDA, 0x91, 0x99, 0xFC, 0x59, 0xDA, 0x9F, 0xFF, 0xC5, 0x9D, 0xA2, 0xAF, 0xFA, 0x97,
+    0xAA, 0x69, 0x99, 0x99, 0x77, 0x77, 0x20, 0x77, 0x74, 0xAD, 0x77, 0xAE, 0x97, 0x6F, 0xA7, 0x5A,
+    0xFC, 0x75, 0xDA, 0xE9, 0x73, 0x9D, 0x9A, 0xE7, 0x3E, 0x1E, 0x73, 0xD9, 0x1E, 0xA7, 0x1A, 0xD2,
+    0xAE, 0x71, 0xDA, 0x3E, 0x70, 0x9D, 0x93, 0xEA, 0x7E, 0x49, 0xE7, 0xDA, 0x5E, 0x95, 0xAD, 0x6E,
+    0xA5, 0xE6, 0x9E, 0x49, 0xD9, 0x7E, 0x93, 0xE7, 0x0F, 0x29, 0xDA, 0x70, 0x9E, 0x2A, 0xD9, 0x71,
+    0xEA, 0x1E, 0x72, 0xAE, 0x0A, 0xEA, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xF0, 0xFF, 0xFF, 0xEA, 0xFF,
+    0xFF, 0xEA, 0x0F, 0xFF, 0xFE, 0x09, 0xFF, 0xFF, 0xE9, 0x9F, 0xAA, 0xAA, 0xA9, 0x9A, 0xAA, 0xAA,
+    0xE1, 0xF7, 0x29, 0xE1, 0xAE, 0x72, 0xAD, 0x92, 0xEA, 0x71, 0xE3, 0xAE, 0x70, 0x9D, 0xA3, 0x9E,
+    0x97, 0xE5, 0xEA, 0x7D, 0xA5, 0xAE, 0x6A, 0xD9, 0x6E, 0x95, 0xE7, 0xF4, 0x9D, 0x97, 0x9E, 0x4A,
+    0xD7, 0x1E, 0xA3, 0xDA, 0x71, 0xAE, 0x2A, 0xD7, 0x3E, 0x91, 0xE7, 0x3E, 0xA0, 0x9D, 0x97, 0x39,
+    0xE0, 0xAD, 0x75, 0xE9, 0xDA, 0x75, 0xAF, 0xC7, 0x69, 0xFA, 0x77, 0xF9, 0x77, 0xAD, 0x97, 0x71,
+    0x97, 0x20, 0x79, 0xAF, 0xFD, 0xA4, 0x9F, 0xFF, 0xE3, 0xAF, 0xFF, 0xEA, 0x2F, 0xA7, 0x6A, 0xE9,
+    0x76, 0x9E, 0x77, 0x0E, 0xA7, 0x70, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xAE, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xAF, 0xFF, 0xFF, 0xAA, 0xEA, 0xFF, 0xFE, 0xAA, 0xD9, 0x77, 0x09,
+    0xDA, 0x77, 0x1E, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xFE, 0x69, 0xAF, 0xFF, 0x77, 0x77, 0x3A, 0xD7, 0x71,
+    0xDA, 0x72, 0x9A, 0xFF, 0xDA, 0x49, 0xFF, 0xFE, 0x3A, 0xFF, 0xFE, 0xA2, 0xFA, 0x5D, 0x95, 0xAE,
+    0x95, 0xAD, 0x59, 0xE7, 0xE5, 0xEA, 0x7D, 0x95, 0xE7, 0xAD, 0x59, 0xDA, 0x7E, 0x5A, 0xDA, 0x7D,
+    0xA5, 0xAE, 0xAA, 0xAA, 0xAA, 0xAF, 0xAF, 0xAF, 0xFF, 0xFF, 0xAA, 0xEA, 0xFF, 0xFE, 0xAA, 0xD9,
+    0x59, 0xD7, 0x9D, 0xA5, 0xE7, 0x0E, 0x5D, 0xA7, 0x0E, 0x93, 0x9D, 0x71, 0x9E, 0x3E, 0x72, 0xF2,
+    0xDA, 0x73, 0xFA, 0xAD, 0x97, 0x4F, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xC6, 0xAD, 0x77, 0x1D, 0xA7, 0x70, 0x9D, 0x97, 0x20, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x4A, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xC1, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
+    0x9E, 0xA7, 0x7E, 0xA7, 0x79, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xAF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+    0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x0A, 0xDA, 0x77, 0x09, 0xE7, 0x71, 0xEA,
+    0x77, 0x09, 0xEA, 0x77, 0x0A, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFF, 0xFC,
+    0x49, 0xFF, 0xFE, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0xAF, 0xFD, 0xA9, 0x7F, 0xFF, 0xE9,
+    0x4A, 0xFF, 0xFE, 0xA7, 0x70, 0xAF, 0x77, 0x09, 0xEA, 0x77, 0x1E, 0x97, 0x70, 0xAE, 0x77, 0x1E,
+    0x77, 0x1A, 0xD9, 0x77, 0x0A, 0xDA, 0xAF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xFF, 0xFF,
+    0xFA, 0xFF, 0xFE, 0xAE, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x70, 0x9E, 0x77,
+    0x0E, 0x97, 0x7E, 0xA7, 0x6A, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xD3, 0xFF, 0xFE, 0x94,
+    0xFF, 0xFA, 0x96, 0x77, 0x7D, 0xA7, 0x71, 0xAD, 0x76, 0xAF, 0xFD, 0xA9, 0x7F, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFE, 0xA7, 0x9D, 0x5A, 0xF7, 0xDA, 0x59, 0xEA, 0x6E, 0x7E, 0x95, 0x9D, 0x7A, 0xE6, 0xDA,
+    0x7E, 0x6E, 0x7A, 0xD9, 0x5A, 0xD7, 0xAD, 0xAA, 0xFA, 0xFA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAF, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xEA, 0xEA, 0x7D, 0x95, 0x9D, 0xA7, 0xE5, 0xAD, 0x97, 0xAD, 0x5E, 0x71, 0xD9,
+    0x39, 0xE7, 0x1E, 0x3E, 0x97, 0x1A, 0xD2, 0xF7, 0x29, 0xDA, 0xAF, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xE3, 0xFF, 0xFE, 0x94, 0xFF, 0xFC, 0xA7, 0x71, 0xDA, 0x77, 0x1A, 0xD7, 0x71, 0x9D, 0x95,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF, 0xFE, 0xA4, 0xFF, 0xFF, 0xC9, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xFA, 0x77, 0x0A, 0xE9, 0x77, 0x0A, 0xE7, 0x71, 0xE9, 0x77, 0x0A, 0xDA,
+    0x0F, 0xFF, 0xFE, 0xA0, 0xFF, 0xFF, 0xF0, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA7,
+    0x70, 0xAD, 0xA7, 0x70, 0xE9, 0x77, 0xAE, 0x77, 0xAE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9A, 0xFA, 0x1F, 0xFF, 0xFC, 0x92, 0xFF, 0xFE, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71, 0x9F,
+    0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE1, 0x99, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA5, 0xAE,
+    0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9,
+    0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7,
+    0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95,
+    0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72,
+    0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x72, 0xE9, 0x5A, 0xE7, 0x2E, 0x95, 0xAE, 0x71, 0x9E, 0x93,
+    0xAF, 0xEA, 0x49, 0xFF, 0x0A, 0xFF, 0xC4, 0xFF, 0xC9, 0x77, 0x70, 0x1F, 0xFF, 0xFC, 0x19, 0xFF,
+    0xFF, 0xC1, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE2, 0xAE, 0xA7, 0x0A, 0xD3, 0xF9, 0x79, 0xD4,
+    0xF7, 0x0D, 0x49, 0xF7, 0x9A, 0x5A, 0xEA, 0x77, 0xF9, 0x77, 0xF7, 0x79, 0xEA, 0x77, 0xAE, 0x97,
+    0x7F, 0x77, 0x9E, 0x77, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76,
+    0x9E, 0x71, 0x94, 0xE9, 0x70, 0x9C, 0xA2, 0xEA, 0x71, 0xDA, 0x1A, 0xE7, 0x2D, 0xA0, 0x9E, 0x72,
+    0xAD, 0x90, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xD1, 0xAF, 0xFF, 0xFA, 0x77, 0x19, 0x10, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x00, 0x72, 0xAC, 0xA7, 0x19,
+    0xD9, 0x71, 0xE7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71,
+    0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xD9, 0x71, 0xE7, 0x19,
+    0xD9, 0x71, 0xE7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71,
+    0x99, 0x97, 0x20, 0x9D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x39, 0xD9, 0x73,
+    0xE7, 0x39, 0xD9, 0x73, 0xE7, 0x3A, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x39, 0xDA, 0x73, 0xE7, 0x39,
+    0xD9, 0x73, 0xE7, 0x3A, 0xD9, 0x73, 0xDA, 0x73, 0xAD, 0x74, 0xDA, 0x73, 0xE7, 0x39, 0xD9, 0x73,
+    0xE7, 0x39, 0xD9, 0x73, 0xE7, 0x39, 0x99, 0x00, 0x5A, 0xC9, 0x73, 0xD9, 0x73, 0xD9, 0x6A, 0x3D,
+    0x92, 0x99, 0x09, 0xDA, 0x1A, 0xC9, 0x1E, 0x1F, 0x9A, 0xC9, 0xAE, 0xA2, 0x9F, 0xFA, 0x69, 0xFA,
+    0x70, 0xAF, 0xC9, 0x5A, 0xFF, 0xC9, 0x19, 0xEA, 0x0A, 0xC9, 0x9F, 0x1D, 0x91, 0xD9, 0x1A, 0xCA,
+    0x19, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x39, 0x96, 0x76, 0x9F, 0xC9, 0x3A, 0xFE, 0x91, 0x9D,
+    0x92, 0xE1, 0xDA, 0x4D, 0x90, 0xD9, 0x4D, 0xA0, 0xD9, 0x4D, 0xA0, 0xDA, 0x4D, 0x90, 0xAD, 0x92,
+    0xE2, 0xFF, 0x93, 0xAF, 0xA7, 0x60, 0x69, 0xE1, 0xFA, 0x0F, 0xA0, 0xAE, 0x60, 0x77, 0x09, 0xAA,
+    0x77, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1E, 0x77, 0x09, 0xD9, 0x77,
+    0x0E, 0x77, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x70, 0x9D, 0xA3, 0xFD, 0xA5,
+    0xAD, 0x93, 0xFE, 0x5E, 0x4A, 0xAA, 0xAE, 0x5D, 0xA7, 0x0E, 0x93, 0x9D, 0x97, 0x0A, 0xDA, 0x3E,
+    0x71, 0x9E, 0x3D, 0xA7, 0x2E, 0x29, 0xD9, 0x72, 0xAD, 0x91, 0xAD, 0x73, 0x9D, 0xA1, 0xE7, 0x4E,
+    0x1D, 0x97, 0x4E, 0x9A, 0xD7, 0x59, 0xDA, 0xE7, 0x6F, 0xCA, 0x76, 0xFC, 0x77, 0xAF, 0x77, 0x0E,
+    0xA7, 0x70, 0xE9, 0x77, 0x09, 0xCA, 0x71, 0x76, 0x92, 0x9A, 0xCA, 0x94, 0xAD, 0x1F, 0xDA, 0x2A,
+    0xDA, 0x0A, 0xDA, 0x9A, 0xDA, 0x09, 0xD9, 0x1D, 0x92, 0x9D, 0xAD, 0x29, 0xD4, 0x9E, 0x92, 0xAD,
+    0x5D, 0xA3, 0xAD, 0x5E, 0x39, 0xD9, 0x3D, 0xAD, 0x3E, 0xA9, 0xAD, 0x90, 0xAD, 0x91, 0x9F, 0xD9,
+    0x2E, 0xA2, 0xAD, 0xA5, 0xAC, 0xA7, 0x70, 0x29, 0xAC, 0xA9, 0x5A, 0xDA, 0x4A, 0xFC, 0xA2, 0x9F,
+    0xD2, 0xAD, 0xA9, 0xAD, 0xA0, 0x9D, 0xA9, 0xEA, 0x1D, 0xA2, 0x9D, 0xAD, 0x3A, 0xD1, 0xD4, 0xAE,
+    0x49, 0xD0, 0x9D, 0x5D, 0xA5, 0xD0, 0x9D, 0x49, 0xE9, 0x39, 0xD1, 0xD9, 0x29, 0xDA, 0xD3, 0xAD,
+    0x1E, 0xA9, 0xAD, 0x90, 0xEA, 0x9A, 0xD9, 0x2F, 0xD9, 0x2A, 0xFC, 0xA4, 0xAD, 0xA5, 0x9A, 0xD9,
+    0x20, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70,
+    0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD,
+    0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97,
+    0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAF, 0xFF, 0xFE,
+    0x0A, 0xFF, 0xFF, 0xE0, 0xAF, 0xFF, 0xFE, 0x00, 0x77, 0x1A, 0x77, 0x4E, 0x77, 0x2F, 0x77, 0x1A,
+    0xE7, 0x71, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x71, 0x9E, 0x97, 0x71, 0xEA,
+    0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x71, 0x9E, 0x97, 0x70, 0x9E, 0xA7, 0x71, 0xF7, 0x71, 0xF7, 0x71,
+    0xAE, 0x97, 0x70, 0x9E, 0x97, 0x71, 0xEA, 0x77, 0x1F, 0x77, 0x1A, 0xFF, 0xFF, 0xEA, 0x09, 0xFF,
+    0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xCA, 0x0A, 0xA9, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x09, 0x99, 0x0A, 0xA9, 0x2A, 0xA9, 0x0E, 0x19,
+    0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA,
+    0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E,
+    0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19,
+    0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA,
+    0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E,
+    0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x19, 0xDA, 0x09, 0x99,
+    0x29, 0x99, 0x70, 0xE7, 0x70, 0x9E, 0xA7, 0x7A, 0xF7, 0x7F, 0xC9, 0x75, 0x9D, 0x9E, 0x75, 0xE0,
+    0xAD, 0x75, 0xDA, 0x09, 0xDA, 0x73, 0xAD, 0x2E, 0x73, 0xE2, 0xAD, 0x97, 0x19, 0xDA, 0x3D, 0xA7,
+    0x1A, 0xD4, 0xE7, 0x1E, 0x4A, 0xD9, 0x7A, 0xD9, 0x5E, 0x7E, 0x6E, 0x69, 0xDA, 0x69, 0xDA, 0x5A,
+    0xD9, 0x7E, 0x5E, 0x70, 0xAD, 0x93, 0x9D, 0xA7, 0x09, 0xDA, 0x3E, 0x72, 0xE3, 0xE7, 0x2A, 0xDA,
+    0x1A, 0xD9, 0x73, 0xE1, 0xE7, 0x4E, 0x99, 0xDA, 0x74, 0x9D, 0xA0, 0x9D, 0xA7, 0x49, 0xDA, 0x0E,
+    0x74, 0xAD, 0x90, 0xAD, 0x97, 0x3E, 0x19, 0xE7, 0x29, 0xDA, 0x2E, 0x72, 0xE3, 0x9D, 0xA7, 0x1E,
+    0x4E, 0x70, 0xAD, 0x94, 0xAD, 0x70, 0xE5, 0x9D, 0xA6, 0x9D, 0xA6, 0xE6, 0xAD, 0x96, 0xAD, 0x95,
+    0xE7, 0x0D, 0xA4, 0x9D, 0x97, 0x0E, 0x4E, 0x71, 0x9D, 0x93, 0xDA, 0x72, 0xE2, 0xAD, 0x97, 0x2A,
+    0xD2, 0xE7, 0x39, 0xDA, 0x09, 0xDA, 0x74, 0xE0, 0xAD, 0x75, 0x9D, 0x9E, 0x76, 0xFC, 0x97, 0x6A,
+    0xF7, 0x79, 0xEA, 0x77, 0x0E, 0x97, 0x69, 0x99, 0x99, 0x72, 0x9F, 0xFC, 0x96, 0xAF, 0xFE, 0xA4,
+    0xFC, 0xA9, 0x99, 0xAF, 0xC2, 0x9E, 0x96, 0x9E, 0x91, 0xE9, 0x70, 0x9E, 0x09, 0xE7, 0x2E, 0x09,
+    0xDA, 0x72, 0xAD, 0x9A, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA,
+    0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA,
+    0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA,
+    0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA, 0xD9, 0x72, 0x9D, 0xAA,
+    0xD9, 0x72, 0x9D, 0xA0, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA,
+    0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA,
+    0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA,
+    0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA, 0xAD, 0x97, 0x29, 0xDA,
+    0xAD, 0x97, 0x29, 0xDA, 0x9D, 0xA7, 0x2A, 0xD9, 0x9E, 0x72, 0xE9, 0x0E, 0x97, 0x09, 0xE1, 0xAE,
+    0x70, 0xEA, 0x2F, 0xA9, 0x90, 0x99, 0xAF, 0x4F, 0xFF, 0xC6, 0x9F, 0xFC, 0x97, 0x29, 0x9A, 0x99,
+    0x60, 0x72, 0x9A, 0xAA, 0x97, 0x3F, 0xE7, 0x1F, 0xFA, 0x79, 0xDA, 0x19, 0xD9, 0x7E, 0x92, 0x99,
+    0x70, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5A, 0xDA,
+    0x70, 0xA3, 0xE9, 0x7E, 0x19, 0xE7, 0x0F, 0xF9, 0x70, 0x9F, 0xD9, 0x73, 0x9A, 0xA9, 0x72, 0x71,
+    0x99, 0x77, 0x09, 0xEA, 0x77, 0xFC, 0x77, 0xAE, 0xA7, 0x70, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xDA, 0x72, 0x9D, 0xA1, 0xF7, 0x2F, 0x99, 0xF9,
+    0x71, 0xF9, 0x0F, 0x72, 0xF2, 0x99, 0x74, 0x99, 0x10, 0x19, 0x97, 0x49, 0x92, 0xF7, 0x2F, 0x09,
+    0xF9, 0x71, 0xF9, 0x9F, 0x72, 0xF9, 0x0A, 0xD9, 0x72, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAD, 0x77, 0x0A, 0xF7, 0x7F, 0xC7, 0x7A, 0xE9, 0x77,
+    0x09, 0x97, 0x10, 0x19, 0xA9, 0x1F, 0x1F, 0x90, 0xF1, 0x9A, 0xA9, 0x77, 0x77, 0x77, 0x19, 0xE1,
+    0xF9, 0x0F, 0x90, 0xF6, 0x19, 0x97, 0x49, 0x92, 0xF7, 0x2F, 0x09, 0xF9, 0x71, 0xF9, 0x9F, 0x72,
+    0xF9, 0x0A, 0xD9, 0x72, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x69, 0xDA, 0x72, 0x9D, 0xA1, 0xF7, 0x2F, 0x99, 0xF9, 0x71, 0xF9, 0x0F, 0x72, 0xF2, 0x99,
+    0x74, 0x99, 0x10, 0x77, 0x59, 0xAD, 0xA9, 0x69, 0xA2, 0xFF, 0x93, 0x9D, 0x1A, 0xDA, 0x99, 0xFC,
+    0xAA, 0xEA, 0x1D, 0x49, 0xAF, 0xDA, 0x29, 0x97, 0x9A, 0xAA, 0x30, 0x77, 0x5A, 0xEA, 0x96, 0xAA,
+    0x2F, 0xFA, 0x39, 0xD1, 0xE9, 0x09, 0xAF, 0xCA, 0xE9, 0x1D, 0x5A, 0xFD, 0x92, 0x99, 0x79, 0x9A,
+    0x97, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x72, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC7, 0x73, 0x29, 0xAA,
+    0x96, 0x92, 0xAF, 0xC9, 0x3A, 0xCA, 0x0A, 0xFF, 0x90, 0x9D, 0xA0, 0xE1, 0x9F, 0xF1, 0xD4, 0xAF,
+    0xC3, 0x96, 0x99, 0x95, 0xAD, 0xA6, 0xA2, 0xFD, 0xA3, 0xDA, 0x0F, 0xFC, 0xA9, 0xAD, 0xA0, 0xDA,
+    0x2A, 0xFE, 0x1D, 0x49, 0xFA, 0x74, 0x93, 0x77, 0x3D, 0xA9, 0x96, 0x99, 0xAD, 0x1F, 0xFF, 0xFC,
+    0x2A, 0xFF, 0xFC, 0xA7, 0x09, 0x99, 0x99, 0x77, 0x77, 0x77, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x4A, 0xFF, 0xFE, 0xA1, 0xFC, 0xAA, 0xAA, 0xAA, 0xAF, 0xC1, 0xA9, 0x74, 0x9A, 0x00, 0x77, 0x70,
+    0xAA, 0x73, 0x9D, 0x39, 0x99, 0x99, 0x99, 0x9D, 0xA9, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC7,
+    0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x09,
+    0xFF, 0xFC, 0x3D, 0x97, 0x29, 0xCA, 0x74, 0xA7, 0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77,
+    0x77, 0x72, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x77, 0x30, 0x73, 0x97, 0x39, 0xD9,
+    0x70, 0x9F, 0xC6, 0x9F, 0xCA, 0x59, 0xFC, 0x95, 0x9F, 0xC9, 0x59, 0xFC, 0x97, 0xAE, 0x97, 0x19,
+    0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xF7, 0x39, 0xC9, 0x77,
+    0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x77, 0xD9,
+    0x72, 0x9F, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0xAF, 0x71,
+    0x9F, 0x79, 0xFA, 0x69, 0xFA, 0x6A, 0xFA, 0x6A, 0xFA, 0x70, 0xEA, 0x72, 0xAA, 0x77, 0x77, 0x72,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x77, 0x77, 0x5A,
+    0xCA, 0x70, 0xAC, 0xA7, 0x1A, 0xF6, 0xAF, 0x7A, 0xFA, 0x5A, 0xFA, 0x6A, 0xFA, 0x5A, 0xFA, 0x6A,
+    0xF9, 0x5A, 0xF9, 0x6A, 0xF9, 0x5A, 0xF9, 0x79, 0xEA, 0x69, 0xEA, 0x72, 0xFC, 0x95, 0xFC, 0x97,
+    0x19, 0xFC, 0x94, 0x9F, 0xC9, 0x71, 0x9F, 0xC9, 0x49, 0xFC, 0x97, 0x1A, 0xFA, 0x5A, 0xFC, 0x72,
+    0xAF, 0xA5, 0xAF, 0xA7, 0x2A, 0xE7, 0xAE, 0x74, 0xAA, 0x71, 0xAA, 0x77, 0x73, 0x77, 0x73, 0xAC,
+    0xA7, 0x0A, 0xCA, 0x73, 0xFA, 0x6F, 0xA7, 0x2A, 0xFA, 0x5A, 0xFA, 0x72, 0xAF, 0xA5, 0xAF, 0xA7,
+    0x29, 0xFA, 0x59, 0xFA, 0x72, 0x9F, 0xA5, 0x9F, 0xA7, 0x2A, 0xE9, 0x6A, 0xE9, 0x79, 0xFC, 0x59,
+    0xFC, 0x69, 0xFC, 0x94, 0x9F, 0xC9, 0x59, 0xFC, 0x94, 0x9F, 0xC9, 0x59, 0xFC, 0x95, 0xFC, 0x96,
+    0xAF, 0xA5, 0xAF, 0xA7, 0x0E, 0xA7, 0xEA, 0x72, 0xAA, 0x71, 0xAA, 0x77, 0x77, 0x60, 0x77, 0x4F,
+    0xFF, 0xDA, 0x94, 0xFF, 0xFF, 0xC9, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xAF, 0x97, 0x70,
+    0xAE, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0x9D, 0xA7, 0x70, 0x9E, 0x77,
+    0x09, 0xDA, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x7A, 0xE7, 0x7A, 0xE9, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x9A, 0xFA, 0x1F, 0xFF, 0xFC, 0x92, 0xFF, 0xFE, 0xA4, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0x76, 0x99, 0x77, 0x2D, 0x97, 0x70, 0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7, 0x70, 0xAD,
+    0x97, 0x09, 0xFF, 0xFE, 0x29, 0xFF, 0xFF, 0xC1, 0x9F, 0xAA, 0x99, 0x9A, 0xDA, 0x99, 0x99, 0x90,
+    0x9E, 0xA5, 0xE6, 0xEA, 0x6D, 0xA5, 0x9E, 0x69, 0xD9, 0x5A, 0xDA, 0x6A, 0xD6, 0xAD, 0x96, 0xDA,
+    0x6E, 0x95, 0x9D, 0x96, 0xAD, 0x95, 0xAD, 0x7A, 0xDA, 0x5D, 0xA7, 0x9E, 0x49, 0xD9, 0x70, 0xEA,
+    0x3A, 0xD7, 0x19, 0xEA, 0x2D, 0xA7, 0x2A, 0xFA, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x93, 0xAF, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFE, 0x69, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xD7, 0x71, 0xE7, 0x71,
+    0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xAC, 0xA7, 0x30, 0x73, 0x99, 0x77, 0x2D, 0x97, 0x70, 0xAD, 0x77,
+    0x1E, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x7F, 0xFF, 0xDA, 0x94, 0xFF, 0xFF, 0xC9, 0x29, 0x99, 0x99,
+    0x99, 0x99, 0xAD, 0xAA, 0xF9, 0x72, 0xE2, 0xF9, 0x71, 0xDA, 0x3A, 0xE7, 0x09, 0xD5, 0xE9, 0x7E,
+    0x5A, 0xDA, 0x7D, 0xA5, 0x9D, 0xA6, 0x9D, 0x95, 0x9E, 0x6A, 0xD6, 0x9D, 0xA6, 0xDA, 0x6A, 0xDA,
+    0x59, 0xD9, 0x6E, 0x95, 0xAD, 0x6A, 0xE6, 0xDA, 0x5A, 0xE9, 0x19, 0x99, 0x99, 0xDA, 0x99, 0x99,
+    0xAF, 0xA1, 0xFF, 0xFF, 0xC9, 0x2F, 0xFF, 0xEA, 0x49, 0x99, 0x9A, 0xDA, 0x99, 0x99, 0x97, 0x3A,
+    0xD7, 0x71, 0xE7, 0x70, 0x9D, 0x97, 0x70, 0xAD, 0x77, 0x1A, 0xCA, 0x76, 0x59, 0xAF, 0xFF, 0xA3,
+    0xAF, 0xFF, 0xF2, 0xFF, 0xFF, 0xCA, 0x1F, 0x97, 0x6A, 0xE7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A,
+    0xD9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0A, 0xDA, 0x77, 0x09, 0xE7, 0x71, 0xE9, 0x77, 0x0A,
+    0xE7, 0x71, 0xFA, 0x77, 0x0F, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xF5, 0x9A, 0xAA, 0xAF, 0xFC, 0xA7,
+    0x77, 0x77, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xF0,
+    0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xA9, 0x5F, 0xFF, 0xFA, 0x3A, 0xFF, 0xFF, 0xC7, 0x70, 0x9F, 0x77,
+    0x1E, 0xA7, 0x70, 0x9E, 0x77, 0x1E, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0x9E, 0x77, 0x09, 0xDA, 0x77,
+    0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xEA, 0x76, 0xAF, 0x1A, 0xFF, 0xFF, 0xC2, 0xFF,
+    0xFF, 0x93, 0xAF, 0xFC, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74,
+    0xAF, 0xFE, 0xA7, 0x19, 0xE9, 0x19, 0xC9, 0x19, 0xE9, 0x69, 0xD9, 0x39, 0xC9, 0x3A, 0xD9, 0x5D,
+    0x94, 0x9C, 0x94, 0x9D, 0x4D, 0x95, 0x9C, 0x95, 0xAD, 0x29, 0xD6, 0x9C, 0x96, 0xD9, 0x1A, 0xC9,
+    0x69, 0xC9, 0x69, 0xCA, 0x1D, 0x79, 0xC9, 0x7D, 0x1D, 0x79, 0xC9, 0x7D, 0x09, 0xD9, 0x99, 0x99,
+    0x99, 0x9A, 0xCA, 0x99, 0x99, 0x99, 0x99, 0xD9, 0x9F, 0xFF, 0xFF, 0xE9, 0x9D, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAD, 0x90, 0xD7, 0x9C, 0x97, 0xD1, 0xD7, 0x9C, 0x97, 0xD1, 0xD9,
+    0x69, 0xC9, 0x69, 0xD1, 0x9C, 0xA6, 0x9C, 0x96, 0xD9, 0x2D, 0x95, 0x9C, 0x95, 0x9D, 0x39, 0xD5,
+    0x9C, 0x95, 0xD9, 0x4A, 0xD4, 0x9C, 0x94, 0xDA, 0x6A, 0xDA, 0x29, 0xC9, 0x2A, 0xDA, 0x70, 0x9E,
+    0xA9, 0xAC, 0xA9, 0xAE, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71, 0x77, 0x77, 0x9A,
+    0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19, 0xE9, 0x69, 0xE9, 0x69, 0xDA, 0x72, 0xAD, 0x95,
+    0xD9, 0x74, 0x9D, 0x4D, 0xA7, 0x6A, 0xD2, 0x9D, 0x77, 0x0D, 0x91, 0xAC, 0x97, 0x70, 0x9C, 0xA1,
+    0xD7, 0x72, 0xD1, 0xD7, 0x72, 0xD0, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x9D, 0x99, 0xFF, 0xFF, 0xFE, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xD9, 0x0D, 0x77, 0x2D, 0x1D, 0x77, 0x2D, 0x1D, 0x97, 0x70, 0x9D, 0x19, 0xCA, 0x77, 0x0A, 0xC9,
+    0x2D, 0x97, 0x69, 0xD3, 0x9D, 0x76, 0xD9, 0x4A, 0xD7, 0x4D, 0xA6, 0xAD, 0xA7, 0x0A, 0xDA, 0x70,
+    0x9E, 0xA9, 0x99, 0x99, 0xAE, 0x97, 0x3A, 0xFF, 0xCA, 0x77, 0x09, 0x9A, 0x99, 0x71, 0x77, 0x77,
+    0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19, 0xE9, 0x69, 0xE9, 0x69, 0xD9, 0x72, 0xAD,
+    0x95, 0xEA, 0x72, 0xF4, 0xDA, 0xDA, 0x70, 0xEA, 0xD2, 0x9D, 0x1D, 0xA6, 0xE1, 0xD9, 0x1A, 0xC9,
+    0x2D, 0xA4, 0xE2, 0x9C, 0xA1, 0xD4, 0xDA, 0x2E, 0x4D, 0x1D, 0x5D, 0xA0, 0xE5, 0xD0, 0x9C, 0xA6,
+    0xFC, 0x6A, 0xC9, 0x9C, 0xA6, 0x9E, 0x7A, 0xC9, 0x9C, 0xA6, 0xFA, 0x6A, 0xC9, 0x0D, 0x5E, 0x9D,
+    0xA5, 0xD1, 0xD4, 0xE2, 0xDA, 0x4D, 0x1D, 0x92, 0xE4, 0xDA, 0x29, 0xD1, 0x9C, 0xA1, 0xE6, 0xDA,
+    0x1A, 0xC9, 0x2D, 0x9E, 0x70, 0xDA, 0x9D, 0x39, 0xF7, 0x2F, 0x94, 0xAD, 0x97, 0x29, 0xDA, 0x6A,
+    0xDA, 0x70, 0xAD, 0xA7, 0x09, 0xEA, 0x99, 0x99, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA7, 0x70, 0x99,
+    0xA9, 0x97, 0x10, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x74, 0xAF, 0xAA, 0xAF, 0xA7, 0x19, 0xE9, 0x69,
+    0xE9, 0x69, 0xD9, 0x72, 0xAD, 0x95, 0xD9, 0x73, 0xAE, 0x4D, 0x97, 0x3A, 0xDA, 0xD2, 0x9D, 0x73,
+    0xAD, 0x1D, 0x91, 0xAC, 0x97, 0x2A, 0xD2, 0x9C, 0xA1, 0xD7, 0x2A, 0xD4, 0xD1, 0xD7, 0x1A, 0xD5,
+    0xD0, 0x9C, 0xA7, 0x0A, 0xD6, 0xAC, 0x99, 0xCA, 0x7A, 0xD7, 0xAC, 0x99, 0xCA, 0x6A, 0xD7, 0x0A,
+    0xC9, 0x0D, 0x5A, 0xD7, 0x1D, 0x1D, 0x4A, 0xD7, 0x2D, 0x1D, 0x92, 0xAD, 0x72, 0x9D, 0x19, 0xCA,
+    0x1A, 0xD7, 0x3A, 0xC9, 0x2D, 0x9A, 0xD7, 0x39, 0xD3, 0x9F, 0x74, 0xD9, 0x4A, 0xD9, 0x73, 0xDA,
+    0x6A, 0xDA, 0x70, 0xAD, 0xA7, 0x09, 0xEA, 0x99, 0x99, 0x9A, 0xE9, 0x73, 0xAF, 0xFC, 0xA7, 0x70,
+    0x99, 0xA9, 0x97, 0x10, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x69, 0xE1, 0xFA, 0x0F, 0xA0, 0xAE,
+    0x29, 0x91, 0x77, 0x73, 0xAD, 0x96, 0xE7, 0xAD, 0x9A, 0xF5, 0xAF, 0x5A, 0xFF, 0xC5, 0xFC, 0x5F,
+    0xC9, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x19, 0x71, 0x97, 0x19, 0x10, 0x77, 0x77, 0x75, 0xC7, 0x77,
+    0x4E, 0x77, 0x72, 0xFC, 0x77, 0x70, 0xFE, 0x77, 0x6E, 0xAF, 0xC7, 0x74, 0xD4, 0x9E, 0x77, 0x2D,
+    0x7A, 0xD7, 0x70, 0xE7, 0x0A, 0xD7, 0x6F, 0xA9, 0xAD, 0xA9, 0x2E, 0x74, 0xFF, 0xFA, 0x19, 0xE7,
+    0x2F, 0xFF, 0xD9, 0x1F, 0x70, 0xFF, 0xFE, 0xA1, 0xFC, 0x6F, 0xFF, 0xFC, 0x1A, 0xFC, 0x4F, 0xFF,
+    0xFC, 0x91, 0xFE, 0x2F, 0xFF, 0xEA, 0x93, 0xFF, 0x09, 0xFF, 0xF9, 0x6A, 0xFF, 0x90, 0x9F, 0xFD,
+    0xA6, 0xAF, 0xF9, 0x29, 0xFF, 0xCA, 0x49, 0xFF, 0xC9, 0x49, 0xFF, 0xA2, 0xAF, 0xFD, 0x96, 0x9F,
+    0xF1, 0xAF, 0xFD, 0x97, 0x09, 0xFE, 0x19, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x9F, 0xFC, 0x97, 0x49,
+    0xFF, 0xFE, 0x97, 0x69, 0xFC, 0x90, 0x9F, 0xC9, 0x77, 0x09, 0xEA, 0x2F, 0x97, 0x72, 0x9D, 0xA2,
+    0xE9, 0x77, 0x49, 0xD9, 0x0A, 0xD9, 0x77, 0x69, 0xFC, 0x97, 0x77, 0x09, 0xE9, 0x77, 0x72, 0x9C,
+    0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 1, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 6, 26, 9, 2, 25, 39, 0 }, // !
-    { 10, 11, 12, 1, 24, 28, 39 }, // "
-    { 21, 21, 22, 0, 19, 111, 67 }, // #
-    { 16, 34, 21, 2, 27, 136, 178 }, // $
-    { 29, 26, 32, 1, 24, 189, 314 }, // %
-    { 25, 25, 27, 1, 24, 157, 503 }, // &
-    { 4, 11, 6, 1, 24, 11, 660 }, // '
-    { 11, 33, 13, 1, 27, 91, 671 }, // (
-    { 11, 33, 12, 0, 27, 91, 762 }, // )
-    { 12, 11, 13, 0, 24, 33, 853 }, // *
-    { 15, 15, 21, 3, 19, 57, 886 }, // +
-    { 8, 11, 9, 0, 4, 22, 943 }, // ,
-    { 11, 3, 13, 1, 10, 9, 965 }, // -
-    { 5, 5, 9, 2, 4, 7, 974 }, // .
-    { 14, 26, 16, 1, 24, 91, 981 }, // /
-    { 19, 24, 21, 1, 23, 114, 1072 }, // 0
-    { 13, 23, 21, 4, 23, 75, 1186 }, // 1
-    { 17, 23, 21, 2, 23, 98, 1261 }, // 2
-    { 16, 24, 21, 2, 23, 96, 1359 }, // 3
-    { 18, 24, 21, 1, 23, 108, 1455 }, // 4
-    { 16, 24, 21, 2, 23, 96, 1563 }, // 5
-    { 17, 24, 21, 2, 23, 102, 1659 }, // 6
-    { 16, 24, 21, 3, 23, 96, 1761 }, // 7
-    { 17, 24, 21, 2, 23, 102, 1857 }, // 8
-    { 16, 24, 21, 2, 23, 96, 1959 }, // 9
-    { 5, 18, 9, 2, 17, 23, 2055 }, // :
-    { 8, 24, 9, 0, 17, 48, 2078 }, // ;
-    { 15, 16, 21, 3, 19, 60, 2126 }, // <
-    { 15, 9, 21, 3, 16, 34, 2186 }, // =
-    { 15, 16, 21, 3, 19, 60, 2220 }, // >
-    { 12, 25, 16, 2, 24, 75, 2280 }, // ?
-    { 29, 30, 32, 1, 23, 218, 2355 }, // @
-    { 25, 24, 26, 0, 24, 150, 2573 }, // A
-    { 19, 25, 21, 1, 24, 119, 2723 }, // B
-    { 19, 25, 21, 1, 24, 119, 2842 }, // C
-    { 23, 25, 25, 1, 24, 144, 2961 }, // D
-    { 19, 23, 21, 1, 23, 110, 3105 }, // E
-    { 17, 23, 19, 1, 23, 98, 3215 }, // F
-    { 22, 25, 24, 1, 24, 138, 3313 }, // G
-    { 26, 23, 28, 1, 23, 150, 3451 }, // H
-    { 11, 23, 13, 1, 23, 64, 3601 }, // I
-    { 14, 30, 13, -2, 23, 105, 3665 }, // J
-    { 23, 24, 25, 1, 23, 138, 3770 }, // K
-    { 19, 23, 21, 1, 23, 110, 3908 }, // L
-    { 30, 23, 31, 0, 23, 173, 4018 }, // M
-    { 26, 24, 28, 1, 23, 156, 4191 }, // N
-    { 24, 25, 26, 1, 24, 150, 4347 }, // O
-    { 18, 24, 20, 1, 24, 108, 4497 }, // P
-    { 26, 31, 28, 1, 24, 202, 4605 }, // Q
-    { 22, 25, 24, 1, 24, 138, 4807 }, // R
-    { 16, 25, 18, 1, 24, 100, 4945 }, // S
-    { 21, 23, 23, 1, 23, 121, 5045 }, // T
-    { 25, 24, 26, 0, 23, 150, 5166 }, // U
-    { 24, 24, 25, 0, 23, 144, 5316 }, // V
-    { 36, 24, 37, 0, 23, 216, 5460 }, // W
-    { 24, 23, 25, 0, 23, 138, 5676 }, // X
-    { 23, 23, 24, 0, 23, 133, 5814 }, // Y
-    { 18, 24, 20, 1, 23, 108, 5947 }, // Z
-    { 7, 32, 10, 2, 26, 56, 6055 }, // [
-    { 14, 26, 16, 1, 24, 91, 6111 }, // <backslash>
-    { 7, 32, 10, 1, 26, 56, 6202 }, // ]
-    { 16, 15, 21, 2, 21, 60, 6258 }, // ^
-    { 17, 3, 18, 0, -1, 13, 6318 }, // _
-    { 8, 9, 22, 7, 28, 18, 6331 }, // `
-    { 18, 19, 20, 1, 18, 86, 6349 }, // a
-    { 20, 27, 20, -1, 26, 135, 6435 }, // b
-    { 15, 19, 17, 1, 18, 72, 6570 }, // c
-    { 20, 27, 22, 1, 26, 135, 6642 }, // d
-    { 15, 19, 17, 1, 18, 72, 6777 }, // e
-    { 16, 26, 17, 0, 26, 104, 6849 }, // f
-    { 19, 26, 20, 0, 18, 124, 6953 }, // g
-    { 22, 26, 23, 0, 26, 143, 7077 }, // h
-    { 11, 26, 12, 0, 26, 72, 7220 }, // i
-    { 10, 34, 9, -2, 26, 85, 7292 }, // j
-    { 20, 27, 21, 0, 26, 135, 7377 }, // k
-    { 11, 26, 12, 0, 26, 72, 7512 }, // l
-    { 33, 18, 34, 0, 18, 149, 7584 }, // m
-    { 22, 18, 23, 0, 18, 99, 7733 }, // n
-    { 18, 19, 20, 1, 18, 86, 7832 }, // o
-    { 19, 26, 20, 0, 18, 124, 7918 }, // p
-    { 19, 26, 21, 1, 18, 124, 8042 }, // q
-    { 15, 18, 16, 0, 18, 68, 8166 }, // r
-    { 14, 19, 16, 1, 18, 67, 8234 }, // s
-    { 13, 23, 14, 0, 22, 75, 8301 }, // t
-    { 22, 19, 23, 0, 18, 105, 8376 }, // u
-    { 20, 18, 21, 0, 17, 90, 8481 }, // v
-    { 29, 18, 30, 0, 17, 131, 8571 }, // w
-    { 20, 17, 21, 0, 17, 85, 8702 }, // x
-    { 20, 25, 21, 0, 17, 125, 8787 }, // y
-    { 15, 18, 17, 1, 17, 68, 8912 }, // z
-    { 10, 33, 13, 2, 27, 83, 8980 }, // {
-    { 3, 30, 9, 3, 26, 23, 9063 }, // |
-    { 11, 33, 13, 0, 27, 91, 9086 }, // }
-    { 16, 6, 21, 2, 14, 24, 9177 }, // ~
-    { 0, 0, 7, 0, 0, 0, 9201 }, //  
-    { 6, 26, 9, 1, 18, 39, 9201 }, // ¡
-    { 16, 33, 21, 2, 26, 132, 9240 }, // ¢
-    { 19, 24, 21, 1, 23, 114, 9372 }, // £
-    { 19, 16, 21, 1, 19, 76, 9486 }, // ¤
-    { 22, 23, 22, -1, 23, 127, 9562 }, // ¥
-    { 3, 30, 9, 3, 26, 23, 9689 }, // ¦
-    { 15, 26, 17, 1, 23, 98, 9712 }, // §
-    { 12, 5, 22, 5, 25, 15, 9810 }, // ¨
-    { 25, 25, 26, 0, 24, 157, 9825 }, // ©
-    { 11, 16, 15, 2, 24, 44, 9982 }, // ª
-    { 17, 13, 19, 1, 15, 56, 10026 }, // «
-    { 15, 8, 21, 3, 15, 30, 10082 }, // ¬
-    { 11, 3, 13, 1, 10, 9, 10112 }, // ­
-    { 19, 18, 20, 0, 26, 86, 10121 }, // ®
-    { 12, 4, 22, 5, 24, 12, 10207 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 10219 }, // °
-    { 15, 20, 21, 3, 20, 75, 10252 }, // ±
-    { 12, 16, 15, 2, 28, 48, 10327 }, // ²
-    { 11, 17, 15, 2, 28, 47, 10375 }, // ³
-    { 7, 8, 22, 8, 27, 14, 10422 }, // ´
-    { 21, 26, 24, 2, 18, 137, 10436 }, // µ
-    { 17, 28, 18, 0, 23, 119, 10573 }, // ¶
-    { 5, 6, 9, 2, 12, 8, 10692 }, // ·
-    { 6, 8, 22, 8, -1, 12, 10700 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 10712 }, // ¹
-    { 12, 16, 15, 2, 24, 48, 10752 }, // º
-    { 17, 13, 19, 1, 15, 56, 10800 }, // »
-    { 32, 27, 36, 2, 24, 216, 10856 }, // ¼
-    { 32, 27, 36, 2, 24, 216, 11072 }, // ½
-    { 33, 27, 36, 2, 24, 223, 11288 }, // ¾
-    { 13, 25, 16, 1, 18, 82, 11511 }, // ¿
-    { 25, 32, 26, 0, 32, 200, 11593 }, // À
-    { 25, 32, 26, 0, 32, 200, 11793 }, // Á
-    { 25, 32, 26, 0, 32, 200, 11993 }, // Â
-    { 25, 31, 26, 0, 31, 194, 12193 }, // Ã
-    { 25, 31, 26, 0, 31, 194, 12387 }, // Ä
-    { 25, 33, 26, 0, 33, 207, 12581 }, // Å
-    { 31, 23, 31, -1, 23, 179, 12788 }, // Æ
-    { 19, 33, 21, 1, 24, 157, 12967 }, // Ç
-    { 19, 32, 21, 1, 32, 152, 13124 }, // È
-    { 19, 32, 21, 1, 32, 152, 13276 }, // É
-    { 19, 32, 21, 1, 32, 152, 13428 }, // Ê
-    { 19, 31, 21, 1, 31, 148, 13580 }, // Ë
-    { 11, 32, 13, 1, 32, 88, 13728 }, // Ì
-    { 11, 32, 13, 1, 32, 88, 13816 }, // Í
-    { 12, 32, 13, 0, 32, 96, 13904 }, // Î
-    { 12, 31, 13, 0, 31, 93, 14000 }, // Ï
-    { 24, 25, 25, 0, 24, 150, 14093 }, // Ð
-    { 26, 32, 28, 1, 31, 208, 14243 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 14451 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 14649 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 14847 }, // Ô
-    { 24, 32, 26, 1, 31, 192, 15045 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 15237 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 15429 }, // ×
-    { 25, 25, 26, 0, 24, 157, 15478 }, // Ø
-    { 25, 33, 26, 0, 32, 207, 15635 }, // Ù
-    { 25, 33, 26, 0, 32, 207, 15842 }, // Ú
-    { 25, 33, 26, 0, 32, 207, 16049 }, // Û
-    { 25, 32, 26, 0, 31, 200, 16256 }, // Ü
-    { 23, 32, 24, 0, 32, 184, 16456 }, // Ý
-    { 18, 23, 21, 1, 23, 104, 16640 }, // Þ
-    { 21, 27, 22, 0, 26, 142, 16744 }, // ß
-    { 18, 29, 20, 1, 28, 131, 16886 }, // à
-    { 18, 28, 20, 1, 27, 126, 17017 }, // á
-    { 18, 28, 20, 1, 27, 126, 17143 }, // â
-    { 18, 27, 20, 1, 26, 122, 17269 }, // ã
-    { 18, 26, 20, 1, 25, 117, 17391 }, // ä
-    { 18, 29, 20, 1, 28, 131, 17508 }, // å
-    { 25, 19, 27, 1, 18, 119, 17639 }, // æ
-    { 15, 27, 17, 1, 18, 102, 17758 }, // ç
-    { 15, 29, 17, 1, 28, 109, 17860 }, // è
-    { 15, 28, 17, 1, 27, 105, 17969 }, // é
-    { 15, 28, 17, 1, 27, 105, 18074 }, // ê
-    { 15, 26, 17, 1, 25, 98, 18179 }, // ë
-    { 11, 28, 12, 0, 28, 77, 18277 }, // ì
-    { 11, 27, 12, 0, 27, 75, 18354 }, // í
-    { 11, 27, 12, 0, 27, 75, 18429 }, // î
-    { 12, 25, 12, -1, 25, 75, 18504 }, // ï
-    { 18, 28, 20, 1, 27, 126, 18579 }, // ð
-    { 22, 26, 23, 0, 26, 143, 18705 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 18848 }, // ò
-    { 18, 28, 20, 1, 27, 126, 18979 }, // ó
-    { 18, 28, 20, 1, 27, 126, 19105 }, // ô
-    { 18, 27, 20, 1, 26, 122, 19231 }, // õ
-    { 18, 26, 20, 1, 25, 117, 19353 }, // ö
-    { 15, 16, 21, 3, 19, 60, 19470 }, // ÷
-    { 19, 19, 20, 0, 18, 91, 19530 }, // ø
-    { 22, 29, 23, 0, 28, 160, 19621 }, // ù
-    { 22, 28, 23, 0, 27, 154, 19781 }, // ú
-    { 22, 28, 23, 0, 27, 154, 19935 }, // û
-    { 22, 26, 23, 0, 25, 143, 20089 }, // ü
-    { 20, 35, 21, 0, 27, 175, 20232 }, // ý
-    { 20, 34, 21, 0, 26, 170, 20407 }, // þ
-    { 20, 33, 21, 0, 25, 165, 20577 }, // ÿ
-    { 25, 30, 26, 0, 30, 188, 20742 }, // Ā
-    { 18, 25, 20, 1, 24, 113, 20930 }, // ā
-    { 25, 32, 26, 0, 32, 200, 21043 }, // Ă
-    { 18, 27, 20, 1, 26, 122, 21243 }, // ă
-    { 25, 31, 26, 0, 24, 194, 21365 }, // Ą
-    { 18, 25, 20, 1, 18, 113, 21559 }, // ą
-    { 19, 33, 21, 1, 32, 157, 21672 }, // Ć
-    { 15, 28, 17, 1, 27, 105, 21829 }, // ć
-    { 19, 33, 21, 1, 32, 157, 21934 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 22091 }, // ĉ
-    { 19, 32, 21, 1, 31, 152, 22196 }, // Ċ
-    { 15, 26, 17, 1, 25, 98, 22348 }, // ċ
-    { 19, 33, 21, 1, 32, 157, 22446 }, // Č
-    { 15, 28, 17, 1, 27, 105, 22603 }, // č
-    { 23, 33, 25, 1, 32, 190, 22708 }, // Ď
-    { 23, 27, 25, 1, 26, 156, 22898 }, // ď
-    { 24, 25, 25, 0, 24, 150, 23054 }, // Đ
-    { 20, 27, 22, 1, 26, 135, 23204 }, // đ
-    { 19, 30, 21, 1, 30, 143, 23339 }, // Ē
-    { 15, 25, 17, 1, 24, 94, 23482 }, // ē
-    { 19, 32, 21, 1, 32, 152, 23576 }, // Ĕ
-    { 15, 27, 17, 1, 26, 102, 23728 }, // ĕ
-    { 19, 31, 21, 1, 31, 148, 23830 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 23978 }, // ė
-    { 19, 30, 21, 1, 23, 143, 24076 }, // Ę
-    { 15, 25, 17, 1, 18, 94, 24219 }, // ę
-    { 19, 32, 21, 1, 32, 152, 24313 }, // Ě
-    { 15, 28, 17, 1, 27, 105, 24465 }, // ě
-    { 22, 33, 24, 1, 32, 182, 24570 }, // Ĝ
-    { 19, 35, 20, 0, 27, 167, 24752 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 24919 }, // Ğ
-    { 19, 34, 20, 0, 26, 162, 25101 }, // ğ
-    { 22, 32, 24, 1, 31, 176, 25263 }, // Ġ
-    { 19, 33, 20, 0, 25, 157, 25439 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 25596 }, // Ģ
-    { 19, 36, 20, 0, 28, 171, 25778 }, // ģ
-    { 26, 32, 28, 1, 32, 208, 25949 }, // Ĥ
-    { 23, 34, 23, -1, 34, 196, 26157 }, // ĥ
-    { 27, 23, 28, 0, 23, 156, 26353 }, // Ħ
-    { 22, 26, 23, 0, 26, 143, 26509 }, // ħ
-    { 12, 31, 13, 0, 31, 93, 26652 }, // Ĩ
-    { 11, 26, 12, 0, 26, 72, 26745 }, // ĩ
-    { 12, 30, 13, 0, 30, 90, 26817 }, // Ī
-    { 11, 24, 12, 0, 24, 66, 26907 }, // ī
-    { 12, 32, 13, 0, 32, 96, 26973 }, // Ĭ
-    { 11, 26, 12, 0, 26, 72, 27069 }, // ĭ
-    { 11, 30, 13, 1, 23, 83, 27141 }, // Į
-    { 11, 33, 12, 0, 26, 91, 27224 }, // į
-    { 11, 31, 13, 1, 31, 86, 27315 }, // İ
-    { 11, 18, 12, 0, 18, 50, 27401 }, // ı
-    { 22, 30, 24, 1, 23, 165, 27451 }, // Ĳ
-    { 18, 34, 20, 0, 26, 153, 27616 }, // ĳ
-    { 14, 39, 13, -2, 32, 137, 27769 }, // Ĵ
-    { 13, 35, 12, -2, 27, 114, 27906 }, // ĵ
-    { 23, 32, 25, 1, 23, 184, 28020 }, // Ķ
-    { 20, 35, 21, 0, 26, 175, 28204 }, // ķ
-    { 21, 19, 22, 0, 18, 100, 28379 }, // ĸ
-    { 19, 32, 21, 1, 32, 152, 28479 }, // Ĺ
-    { 11, 34, 12, 0, 34, 94, 28631 }, // ĺ
-    { 19, 32, 21, 1, 23, 152, 28725 }, // Ļ
-    { 11, 35, 12, 0, 26, 97, 28877 }, // ļ
-    { 19, 26, 21, 1, 26, 124, 28974 }, // Ľ
-    { 14, 26, 15, 0, 26, 91, 29098 }, // ľ
-    { 19, 23, 21, 1, 23, 110, 29189 }, // Ŀ
-    { 16, 26, 17, 0, 26, 104, 29299 }, // ŀ
-    { 21, 23, 21, -1, 23, 121, 29403 }, // Ł
-    { 13, 26, 13, -1, 26, 85, 29524 }, // ł
-    { 26, 33, 28, 1, 32, 215, 29609 }, // Ń
-    { 22, 27, 23, 0, 27, 149, 29824 }, // ń
-    { 26, 32, 28, 1, 23, 208, 29973 }, // Ņ
-    { 22, 27, 23, 0, 18, 149, 30181 }, // ņ
-    { 26, 33, 28, 1, 32, 215, 30330 }, // Ň
-    { 22, 27, 23, 0, 27, 149, 30545 }, // ň
-    { 29, 25, 31, 1, 25, 182, 30694 }, // ŉ
-    { 26, 30, 28, 1, 23, 195, 30876 }, // Ŋ
-    { 19, 26, 21, 0, 18, 124, 31071 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 31195 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 31381 }, // ō
-    { 24, 33, 26, 1, 32, 198, 31494 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 31692 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 31814 }, // Ő
-    { 18, 28, 20, 1, 27, 126, 32018 }, // ő
-    { 30, 24, 32, 1, 23, 180, 32144 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 32324 }, // œ
-    { 22, 33, 24, 1, 32, 182, 32457 }, // Ŕ
-    { 15, 27, 16, 0, 27, 102, 32639 }, // ŕ
-    { 22, 33, 24, 1, 24, 182, 32741 }, // Ŗ
-    { 15, 27, 16, 0, 18, 102, 32923 }, // ŗ
-    { 22, 33, 24, 1, 32, 182, 33025 }, // Ř
-    { 15, 27, 16, 0, 27, 102, 33207 }, // ř
-    { 16, 33, 18, 1, 32, 132, 33309 }, // Ś
-    { 14, 28, 16, 1, 27, 98, 33441 }, // ś
-    { 16, 33, 18, 1, 32, 132, 33539 }, // Ŝ
-    { 14, 28, 16, 1, 27, 98, 33671 }, // ŝ
-    { 16, 33, 18, 1, 24, 132, 33769 }, // Ş
-    { 14, 27, 16, 1, 18, 95, 33901 }, // ş
-    { 16, 33, 18, 1, 32, 132, 33996 }, // Š
-    { 14, 28, 16, 1, 27, 98, 34128 }, // š
-    { 21, 32, 23, 1, 23, 168, 34226 }, // Ţ
-    { 13, 31, 14, 0, 22, 101, 34394 }, // ţ
-    { 21, 32, 23, 1, 32, 168, 34495 }, // Ť
-    { 13, 28, 14, 0, 27, 91, 34663 }, // ť
-    { 21, 23, 23, 1, 23, 121, 34754 }, // Ŧ
-    { 13, 23, 14, 0, 22, 75, 34875 }, // ŧ
-    { 25, 32, 26, 0, 31, 200, 34950 }, // Ũ
-    { 22, 27, 23, 0, 26, 149, 35150 }, // ũ
-    { 25, 31, 26, 0, 30, 194, 35299 }, // Ū
-    { 22, 25, 23, 0, 24, 138, 35493 }, // ū
-    { 25, 33, 26, 0, 32, 207, 35631 }, // Ŭ
-    { 22, 27, 23, 0, 26, 149, 35838 }, // ŭ
-    { 25, 34, 26, 0, 33, 213, 35987 }, // Ů
-    { 22, 29, 23, 0, 28, 160, 36200 }, // ů
-    { 25, 34, 26, 0, 33, 213, 36360 }, // Ű
-    { 22, 28, 23, 0, 27, 154, 36573 }, // ű
-    { 25, 30, 26, 0, 23, 188, 36727 }, // Ų
-    { 22, 25, 23, 0, 18, 138, 36915 }, // ų
-    { 36, 33, 37, 0, 32, 297, 37053 }, // Ŵ
-    { 29, 28, 30, 0, 27, 203, 37350 }, // ŵ
-    { 23, 32, 24, 0, 32, 184, 37553 }, // Ŷ
-    { 20, 35, 21, 0, 27, 175, 37737 }, // ŷ
-    { 23, 31, 24, 0, 31, 179, 37912 }, // Ÿ
-    { 18, 33, 20, 1, 32, 149, 38091 }, // Ź
-    { 15, 28, 17, 1, 27, 105, 38240 }, // ź
-    { 18, 32, 20, 1, 31, 144, 38345 }, // Ż
-    { 15, 26, 17, 1, 25, 98, 38489 }, // ż
-    { 18, 33, 20, 1, 32, 149, 38587 }, // Ž
-    { 15, 28, 17, 1, 27, 105, 38736 }, // ž
-    { 16, 26, 17, 0, 26, 104, 38841 }, // ſ
-    { 25, 29, 27, 1, 28, 182, 38945 }, // Ơ
-    { 19, 22, 21, 1, 21, 105, 39127 }, // ơ
-    { 21, 24, 22, 0, 24, 126, 39232 }, // Ƥ
-    { 20, 34, 21, 0, 26, 170, 39358 }, // ƥ
-    { 13, 30, 14, 0, 22, 98, 39528 }, // ƫ
-    { 22, 23, 23, 0, 23, 127, 39626 }, // Ƭ
-    { 16, 27, 17, 0, 26, 108, 39753 }, // ƭ
-    { 21, 30, 23, 1, 23, 158, 39861 }, // Ʈ
-    { 27, 29, 28, 0, 28, 196, 40019 }, // Ư
-    { 22, 22, 23, 0, 21, 121, 40215 }, // ư
-    { 7, 9, 3, -5, 28, 16, 40336 }, // ̀
-    { 7, 8, 6, -2, 27, 14, 40352 }, // ́
-    { 12, 8, 7, -6, 27, 24, 40366 }, // ̂
-    { 12, 6, 7, -6, 26, 18, 40390 }, // ̃
-    { 12, 4, 7, -6, 24, 12, 40408 }, // ̄
-    { 12, 6, 7, -6, 26, 18, 40420 }, // ̆
-    { 6, 5, 4, -3, 25, 8, 40438 }, // ̇
-    { 12, 5, 7, -6, 25, 15, 40446 }, // ̈
-    { 10, 10, 6, -5, 29, 25, 40461 }, // ̉
-    { 10, 10, 6, -5, 28, 25, 40486 }, // ̊
-    { 12, 8, 8, -5, 27, 24, 40511 }, // ̋
-    { 12, 8, 7, -6, 27, 24, 40535 }, // ̌
-    { 12, 8, 6, -7, 27, 24, 40559 }, // ̏
-    { 12, 6, 7, -6, 26, 18, 40583 }, // ̑
-    { 6, 9, 4, -3, 28, 14, 40601 }, // ̒
-    { 6, 10, 5, -2, 29, 15, 40615 }, // ̓
-    { 6, 10, 3, -4, 29, 15, 40630 }, // ̔
-    { 4, 9, 3, -2, 29, 9, 40645 }, // ̕
-    { 6, 8, 4, -3, 21, 12, 40654 }, // ̛
-    { 6, 6, 4, -3, -2, 9, 40666 }, // ̣
-    { 12, 5, 7, -6, -3, 15, 40675 }, // ̤
-    { 8, 8, 5, -4, -1, 16, 40690 }, // ̥
-    { 6, 8, 4, -3, -1, 12, 40706 }, // ̦
-    { 6, 8, 4, -3, -1, 12, 40718 }, // ̧
-    { 8, 8, 5, -4, 1, 16, 40730 }, // ̨
-    { 3, 8, 9, 3, -1, 6, 40746 }, // ̩
-    { 12, 7, 7, -6, -2, 21, 40752 }, // ̭
-    { 12, 6, 7, -6, -2, 18, 40773 }, // ̮
-    { 12, 6, 7, -6, -2, 18, 40791 }, // ̰
-    { 12, 4, 7, -6, -3, 12, 40809 }, // ̱
-    { 12, 6, 7, -6, 26, 18, 40821 }, // ͂
-    { 12, 13, 7, -6, 33, 39, 40839 }, // ̈́
-    { 6, 6, 5, -2, -2, 9, 40878 }, // ͅ
-    { 25, 24, 26, 0, 24, 150, 40887 }, // Α
-    { 19, 25, 21, 1, 24, 119, 41037 }, // Β
-    { 17, 23, 19, 1, 23, 98, 41156 }, // Γ
-    { 20, 24, 22, 1, 24, 120, 41254 }, // Δ
-    { 19, 23, 21, 1, 23, 110, 41374 }, // Ε
-    { 18, 24, 20, 1, 23, 108, 41484 }, // Ζ
-    { 26, 23, 28, 1, 23, 150, 41592 }, // Η
-    { 24, 25, 26, 1, 24, 150, 41742 }, // Θ
-    { 11, 23, 13, 1, 23, 64, 41892 }, // Ι
-    { 23, 24, 25, 1, 23, 138, 41956 }, // Κ
-    { 24, 24, 25, 0, 24, 144, 42094 }, // Λ
-    { 30, 23, 31, 0, 23, 173, 42238 }, // Μ
-    { 26, 24, 28, 1, 23, 156, 42411 }, // Ν
-    { 19, 23, 21, 1, 23, 110, 42567 }, // Ξ
-    { 24, 25, 26, 1, 24, 150, 42677 }, // Ο
-    { 25, 23, 27, 1, 23, 144, 42827 }, // Π
-    { 18, 24, 20, 1, 24, 108, 42971 }, // Ρ
-    { 19, 24, 21, 1, 23, 114, 43079 }, // Σ
-    { 21, 23, 23, 1, 23, 121, 43193 }, // Τ
-    { 22, 24, 23, 0, 24, 132, 43314 }, // Υ
-    { 24, 25, 26, 1, 24, 150, 43446 }, // Φ
-    { 24, 23, 25, 0, 23, 138, 43596 }, // Χ
-    { 27, 24, 28, 0, 24, 162, 43734 }, // Ψ
-    { 25, 24, 27, 1, 24, 150, 43896 }, // Ω
-    { 21, 19, 23, 1, 18, 100, 44046 }, // α
-    { 17, 34, 20, 2, 26, 145, 44146 }, // β
-    { 18, 26, 19, 0, 18, 117, 44291 }, // γ
-    { 17, 27, 20, 1, 26, 115, 44408 }, // δ
-    { 14, 19, 16, 1, 18, 67, 44523 }, // ε
-    { 14, 34, 16, 1, 27, 119, 44590 }, // ζ
-    { 18, 26, 20, 0, 18, 117, 44709 }, // η
-    { 17, 27, 19, 1, 26, 115, 44826 }, // θ
-    { 9, 19, 12, 2, 18, 43, 44941 }, // ι
-    { 18, 19, 21, 2, 18, 86, 44984 }, // κ
-    { 20, 27, 21, 0, 26, 135, 45070 }, // λ
-    { 21, 26, 24, 2, 18, 137, 45205 }, // μ
-    { 18, 19, 19, 0, 18, 86, 45342 }, // ν
-    { 14, 34, 16, 1, 27, 119, 45428 }, // ξ
-    { 17, 19, 19, 1, 18, 81, 45547 }, // ο
-    { 21, 19, 22, 0, 18, 100, 45628 }, // π
-    { 16, 26, 19, 2, 18, 104, 45728 }, // ρ
-    { 15, 25, 17, 1, 18, 94, 45832 }, // ς
-    { 19, 19, 21, 1, 18, 91, 45926 }, // σ
-    { 17, 19, 18, 0, 18, 81, 46017 }, // τ
-    { 18, 19, 20, 0, 18, 86, 46098 }, // υ
-    { 25, 32, 27, 1, 24, 200, 46184 }, // φ
-    { 19, 26, 20, 0, 18, 124, 46384 }, // χ
-    { 26, 32, 27, 0, 24, 208, 46508 }, // ψ
-    { 23, 19, 26, 1, 18, 110, 46716 }, // ω
-    { 25, 32, 26, 0, 24, 200, 46826 }, // Ạ
-    { 18, 26, 20, 1, 18, 117, 47026 }, // ạ
-    { 25, 34, 26, 0, 34, 213, 47143 }, // Ả
-    { 18, 30, 20, 1, 29, 135, 47356 }, // ả
-    { 25, 35, 26, 0, 35, 219, 47491 }, // Ấ
-    { 18, 33, 20, 1, 32, 149, 47710 }, // ấ
-    { 25, 35, 26, 0, 35, 219, 47859 }, // Ầ
-    { 18, 33, 20, 1, 32, 149, 48078 }, // ầ
-    { 25, 35, 26, 0, 35, 219, 48227 }, // Ẩ
-    { 18, 33, 20, 1, 32, 149, 48446 }, // ẩ
-    { 25, 35, 26, 0, 35, 219, 48595 }, // Ẫ
-    { 18, 32, 20, 1, 31, 144, 48814 }, // ẫ
-    { 25, 40, 26, 0, 32, 250, 48958 }, // Ậ
-    { 18, 35, 20, 1, 27, 158, 49208 }, // ậ
-    { 25, 35, 26, 0, 35, 219, 49366 }, // Ắ
-    { 18, 33, 20, 1, 32, 149, 49585 }, // ắ
-    { 25, 35, 26, 0, 35, 219, 49734 }, // Ằ
-    { 18, 33, 20, 1, 32, 149, 49953 }, // ằ
-    { 25, 35, 26, 0, 35, 219, 50102 }, // Ẳ
-    { 18, 34, 20, 1, 33, 153, 50321 }, // ẳ
-    { 25, 35, 26, 0, 35, 219, 50474 }, // Ẵ
-    { 18, 32, 20, 1, 31, 144, 50693 }, // ẵ
-    { 25, 40, 26, 0, 32, 250, 50837 }, // Ặ
-    { 18, 34, 20, 1, 26, 153, 51087 }, // ặ
-    { 19, 31, 21, 1, 23, 148, 51240 }, // Ẹ
-    { 15, 26, 17, 1, 18, 98, 51388 }, // ẹ
-    { 19, 34, 21, 1, 34, 162, 51486 }, // Ẻ
-    { 15, 30, 17, 1, 29, 113, 51648 }, // ẻ
-    { 19, 31, 21, 1, 31, 148, 51761 }, // Ẽ
-    { 15, 27, 17, 1, 26, 102, 51909 }, // ẽ
-    { 19, 35, 21, 1, 35, 167, 52011 }, // Ế
-    { 17, 33, 19, 1, 32, 141, 52178 }, // ế
-    { 19, 35, 21, 1, 35, 167, 52319 }, // Ề
-    { 15, 33, 17, 1, 32, 124, 52486 }, // ề
-    { 19, 35, 21, 1, 35, 167, 52610 }, // Ể
-    { 18, 33, 20, 1, 32, 149, 52777 }, // ể
-    { 19, 35, 21, 1, 35, 167, 52926 }, // Ễ
-    { 15, 32, 17, 1, 31, 120, 53093 }, // ễ
-    { 19, 40, 21, 1, 32, 190, 53213 }, // Ệ
-    { 15, 35, 17, 1, 27, 132, 53403 }, // ệ
-    { 11, 34, 13, 1, 34, 94, 53535 }, // Ỉ
-    { 11, 29, 12, 0, 29, 80, 53629 }, // ỉ
-    { 11, 31, 13, 1, 23, 86, 53709 }, // Ị
-    { 11, 34, 12, 0, 26, 94, 53795 }, // ị
-    { 24, 32, 26, 1, 24, 192, 53889 }, // Ọ
-    { 18, 26, 20, 1, 18, 117, 54081 }, // ọ
-    { 24, 35, 26, 1, 34, 210, 54198 }, // Ỏ
-    { 18, 30, 20, 1, 29, 135, 54408 }, // ỏ
-    { 24, 36, 26, 1, 35, 216, 54543 }, // Ố
-    { 18, 33, 20, 1, 32, 149, 54759 }, // ố
-    { 24, 36, 26, 1, 35, 216, 54908 }, // Ồ
-    { 18, 33, 20, 1, 32, 149, 55124 }, // ồ
-    { 24, 36, 26, 1, 35, 216, 55273 }, // Ổ
-    { 19, 33, 21, 1, 32, 157, 55489 }, // ổ
-    { 24, 36, 26, 1, 35, 216, 55646 }, // Ỗ
-    { 18, 32, 20, 1, 31, 144, 55862 }, // ỗ
-    { 24, 40, 26, 1, 32, 240, 56006 }, // Ộ
-    { 18, 35, 20, 1, 27, 158, 56246 }, // ộ
-    { 25, 33, 27, 1, 32, 207, 56404 }, // Ớ
-    { 19, 28, 21, 1, 27, 133, 56611 }, // ớ
-    { 25, 33, 27, 1, 32, 207, 56744 }, // Ờ
-    { 19, 29, 21, 1, 28, 138, 56951 }, // ờ
-    { 25, 35, 27, 1, 34, 219, 57089 }, // Ở
-    { 19, 30, 21, 1, 29, 143, 57308 }, // ở
-    { 25, 32, 27, 1, 31, 200, 57451 }, // Ỡ
-    { 19, 27, 21, 1, 26, 129, 57651 }, // ỡ
-    { 25, 36, 27, 1, 28, 225, 57780 }, // Ợ
-    { 19, 29, 21, 1, 21, 138, 58005 }, // ợ
-    { 25, 31, 26, 0, 23, 194, 58143 }, // Ụ
-    { 22, 26, 23, 0, 18, 143, 58337 }, // ụ
-    { 25, 35, 26, 0, 34, 219, 58480 }, // Ủ
-    { 22, 30, 23, 0, 29, 165, 58699 }, // ủ
-    { 27, 33, 28, 0, 32, 223, 58864 }, // Ứ
-    { 22, 28, 23, 0, 27, 154, 59087 }, // ứ
-    { 27, 33, 28, 0, 32, 223, 59241 }, // Ừ
-    { 22, 29, 23, 0, 28, 160, 59464 }, // ừ
-    { 27, 35, 28, 0, 34, 237, 59624 }, // Ử
-    { 22, 30, 23, 0, 29, 165, 59861 }, // ử
-    { 27, 32, 28, 0, 31, 216, 60026 }, // Ữ
-    { 22, 27, 23, 0, 26, 149, 60242 }, // ữ
-    { 27, 36, 28, 0, 28, 243, 60391 }, // Ự
-    { 22, 29, 23, 0, 21, 160, 60634 }, // ự
-    { 23, 32, 24, 0, 32, 184, 60794 }, // Ỳ
-    { 20, 36, 21, 0, 28, 180, 60978 }, // ỳ
-    { 23, 31, 24, 0, 23, 179, 61158 }, // Ỵ
-    { 20, 25, 21, 0, 17, 125, 61337 }, // ỵ
-    { 23, 34, 24, 0, 34, 196, 61462 }, // Ỷ
-    { 20, 37, 21, 0, 29, 185, 61658 }, // ỷ
-    { 23, 31, 24, 0, 31, 179, 61843 }, // Ỹ
-    { 20, 34, 21, 0, 26, 170, 62022 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 62192 }, //  
-    { 0, 0, 33, 0, 0, 0, 62192 }, //  
-    { 0, 0, 17, 0, 0, 0, 62192 }, //  
-    { 0, 0, 33, 0, 0, 0, 62192 }, //  
-    { 0, 0, 11, 0, 0, 0, 62192 }, //  
-    { 0, 0, 8, 0, 0, 0, 62192 }, //  
-    { 0, 0, 5, 0, 0, 0, 62192 }, //  
-    { 0, 0, 21, 0, 0, 0, 62192 }, //  
-    { 0, 0, 9, 0, 0, 0, 62192 }, //  
-    { 0, 0, 7, 0, 0, 0, 62192 }, //  
-    { 0, 0, 2, 0, 0, 0, 62192 }, //  
-    { 0, 0, 1, 0, 0, 0, 62192 }, // ​
-    { 2, 28, 2, -1, 20, 14, 62192 }, // ‌
-    { 8, 30, 5, -4, 22, 60, 62206 }, // ‍
-    { 12, 31, 7, -6, 23, 93, 62266 }, // ‎
-    { 12, 31, 7, -6, 23, 93, 62359 }, // ‏
-    { 11, 3, 13, 1, 10, 9, 62452 }, // ‐
-    { 11, 3, 13, 1, 10, 9, 62461 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 62470 }, // ‒
-    { 17, 3, 18, 0, 10, 13, 62482 }, // –
-    { 33, 3, 34, 0, 10, 25, 62495 }, // —
-    { 33, 3, 34, 0, 10, 25, 62520 }, // ―
-    { 11, 34, 17, 3, 26, 94, 62545 }, // ‖
-    { 17, 8, 18, 0, -1, 34, 62639 }, // ‗
-    { 6, 11, 8, 1, 25, 17, 62673 }, // ‘
-    { 6, 11, 8, 1, 25, 17, 62690 }, // ’
-    { 6, 10, 8, 1, 4, 15, 62707 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 62722 }, // ‛
-    { 13, 11, 15, 1, 25, 36, 62739 }, // “
-    { 12, 11, 14, 1, 25, 33, 62775 }, // ”
-    { 12, 10, 14, 1, 4, 30, 62808 }, // „
-    { 13, 11, 15, 1, 25, 36, 62838 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 62874 }, // †
-    { 15, 26, 17, 1, 24, 98, 62957 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 63055 }, // •
-    { 12, 12, 21, 4, 17, 36, 63069 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 63105 }, // ․
-    { 14, 5, 17, 1, 4, 18, 63112 }, // ‥
-    { 27, 5, 33, 3, 4, 34, 63130 }, // …
-    { 5, 6, 9, 2, 12, 8, 63164 }, // ‧
-    { 0, 0, 1, 0, 0, 0, 63172 }, //  
-    { 0, 0, 1, 0, 0, 0, 63172 }, //  
-    { 12, 31, 7, -6, 23, 93, 63172 }, // ‪
-    { 12, 31, 7, -6, 23, 93, 63265 }, // ‫
-    { 10, 31, 6, -5, 23, 78, 63358 }, // ‬
-    { 14, 31, 8, -7, 23, 109, 63436 }, // ‭
-    { 14, 31, 8, -7, 23, 109, 63545 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 63654 }, //  
-    { 43, 26, 45, 1, 24, 280, 63654 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 63934 }, // ′
-    { 13, 11, 15, 1, 23, 36, 63954 }, // ″
-    { 20, 11, 22, 1, 23, 55, 63990 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 64045 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 64065 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 64104 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 64162 }, // ‸
-    { 8, 13, 11, 1, 15, 26, 64187 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 64213 }, // ›
-    { 21, 23, 22, 0, 22, 121, 64243 }, // ※
-    { 15, 26, 18, 2, 25, 98, 64364 }, // ‼
-    { 17, 3, 18, 0, 27, 13, 64462 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 64475 }, // ⁃
-    { 16, 27, 12, -5, 24, 108, 64481 }, // ⁄
-    { 26, 25, 29, 2, 24, 163, 64589 }, // ⁇
-    { 21, 26, 25, 2, 25, 137, 64752 }, // ⁈
-    { 21, 26, 25, 2, 25, 137, 64889 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 65026 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 65055 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 65127 }, //  
-    { 0, 0, 1, 0, 0, 0, 65127 }, // ⁠
-    { 0, 0, 1, 0, 0, 0, 65127 }, // ⁡
-    { 0, 0, 1, 0, 0, 0, 65127 }, // ⁢
-    { 0, 0, 1, 0, 0, 0, 65127 }, // ⁣
-    { 0, 0, 1, 0, 0, 0, 65127 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 65127 }, // ⁰
-    { 13, 17, 15, 1, 28, 56, 65183 }, // ⁴
-    { 10, 16, 15, 2, 27, 40, 65239 }, // ⁵
-    { 12, 17, 15, 2, 28, 51, 65279 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 65330 }, // ⁷
-    { 11, 17, 15, 2, 28, 47, 65378 }, // ⁸
-    { 11, 17, 15, 2, 28, 47, 65425 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 65472 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 65514 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 65566 }, // ₁
-    { 12, 16, 15, 2, 11, 48, 65606 }, // ₂
-    { 11, 16, 15, 2, 11, 44, 65654 }, // ₃
-    { 13, 16, 15, 1, 11, 52, 65698 }, // ₄
-    { 10, 16, 15, 2, 11, 40, 65750 }, // ₅
-    { 12, 16, 15, 2, 11, 48, 65790 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 65838 }, // ₇
-    { 11, 16, 15, 2, 11, 44, 65886 }, // ₈
-    { 11, 16, 15, 2, 11, 44, 65930 }, // ₉
-    { 18, 23, 21, 1, 23, 104, 65974 }, // ₣
-    { 19, 24, 21, 1, 23, 114, 66078 }, // ₤
-    { 39, 24, 41, 1, 23, 234, 66192 }, // ₧
-    { 20, 24, 21, 0, 23, 120, 66426 }, // €
-    { 19, 13, 33, 7, 18, 62, 66546 }, // ←
-    { 13, 21, 33, 10, 22, 69, 66608 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 66677 }, // →
-    { 13, 21, 33, 10, 22, 69, 66739 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 66808 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 66877 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 66952 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 67035 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 67104 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 67173 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 67245 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 67317 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 67389 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 67461 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 67533 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 67612 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 67750 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 67865 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 67952 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 68121 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 68241 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 68367 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 68488 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 68641 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 68741 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 68862 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 69015 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 69115 }, // ∏
-    { 20, 29, 21, 0, 23, 145, 69297 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 69442 }, // −
-    { 14, 26, 16, 1, 24, 91, 69454 }, // ∕
-    { 15, 26, 18, 2, 24, 98, 69545 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 69643 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 69703 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 69739 }, // ∙
-    { 21, 31, 22, 0, 27, 163, 69748 }, // √
-    { 16, 13, 21, 2, 17, 52, 69911 }, // ∝
-    { 21, 11, 22, 0, 16, 58, 69963 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 70021 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 70142 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 70275 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 70309 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 70394 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 70515 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 70636 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 70750 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 70864 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 71017 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 71117 }, // ∵
-    { 6, 18, 10, 2, 20, 27, 71217 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 71244 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 71344 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 71373 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 71459 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 71507 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 71560 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 71617 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 71689 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 71764 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 71839 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 71947 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 72055 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 72155 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 72308 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 72461 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 72582 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 72703 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 72860 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 73017 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 73174 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 73331 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 73441 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 73450 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 73491 }, // �
+    { 6, 26, 9, 2, 25, 33, 0 }, // !
+    { 10, 11, 12, 1, 24, 33, 33 }, // "
+    { 21, 21, 22, 0, 19, 81, 66 }, // #
+    { 16, 34, 21, 2, 27, 96, 147 }, // $
+    { 29, 26, 32, 1, 24, 134, 243 }, // %
+    { 25, 25, 27, 1, 24, 99, 377 }, // &
+    { 4, 11, 6, 1, 24, 15, 476 }, // '
+    { 11, 33, 13, 1, 27, 50, 491 }, // (
+    { 11, 33, 12, 0, 27, 51, 541 }, // )
+    { 12, 11, 13, 0, 24, 30, 592 }, // *
+    { 15, 15, 21, 3, 19, 36, 622 }, // +
+    { 8, 11, 9, 0, 4, 17, 658 }, // ,
+    { 11, 3, 13, 1, 10, 8, 675 }, // -
+    { 5, 5, 9, 2, 4, 8, 683 }, // .
+    { 14, 26, 16, 1, 24, 55, 691 }, // /
+    { 19, 24, 21, 1, 23, 79, 746 }, // 0
+    { 13, 23, 21, 4, 23, 49, 825 }, // 1
+    { 17, 23, 21, 2, 23, 57, 874 }, // 2
+    { 16, 24, 21, 2, 23, 59, 931 }, // 3
+    { 18, 24, 21, 1, 23, 64, 990 }, // 4
+    { 16, 24, 21, 2, 23, 58, 1054 }, // 5
+    { 17, 24, 21, 2, 23, 68, 1112 }, // 6
+    { 16, 24, 21, 3, 23, 65, 1180 }, // 7
+    { 17, 24, 21, 2, 23, 71, 1245 }, // 8
+    { 16, 24, 21, 2, 23, 65, 1316 }, // 9
+    { 5, 18, 9, 2, 17, 17, 1381 }, // :
+    { 8, 24, 9, 0, 17, 29, 1398 }, // ;
+    { 15, 16, 21, 3, 19, 36, 1427 }, // <
+    { 15, 9, 21, 3, 16, 30, 1463 }, // =
+    { 15, 16, 21, 3, 19, 35, 1493 }, // >
+    { 12, 25, 16, 2, 24, 51, 1528 }, // ?
+    { 29, 30, 32, 1, 23, 148, 1579 }, // @
+    { 25, 24, 26, 0, 24, 88, 1727 }, // A
+    { 19, 25, 21, 1, 24, 80, 1815 }, // B
+    { 19, 25, 21, 1, 24, 70, 1895 }, // C
+    { 23, 25, 25, 1, 24, 88, 1965 }, // D
+    { 19, 23, 21, 1, 23, 75, 2053 }, // E
+    { 17, 23, 19, 1, 23, 63, 2128 }, // F
+    { 22, 25, 24, 1, 24, 89, 2191 }, // G
+    { 26, 23, 28, 1, 23, 93, 2280 }, // H
+    { 11, 23, 13, 1, 23, 40, 2373 }, // I
+    { 14, 30, 13, -2, 23, 63, 2413 }, // J
+    { 23, 24, 25, 1, 23, 88, 2476 }, // K
+    { 19, 23, 21, 1, 23, 63, 2564 }, // L
+    { 30, 23, 31, 0, 23, 122, 2627 }, // M
+    { 26, 24, 28, 1, 23, 103, 2749 }, // N
+    { 24, 25, 26, 1, 24, 94, 2852 }, // O
+    { 18, 24, 20, 1, 24, 69, 2946 }, // P
+    { 26, 31, 28, 1, 24, 113, 3015 }, // Q
+    { 22, 25, 24, 1, 24, 86, 3128 }, // R
+    { 16, 25, 18, 1, 24, 71, 3214 }, // S
+    { 21, 23, 23, 1, 23, 75, 3285 }, // T
+    { 25, 24, 26, 0, 23, 83, 3360 }, // U
+    { 24, 24, 25, 0, 23, 80, 3443 }, // V
+    { 36, 24, 37, 0, 23, 135, 3523 }, // W
+    { 24, 23, 25, 0, 23, 81, 3658 }, // X
+    { 23, 23, 24, 0, 23, 72, 3739 }, // Y
+    { 18, 24, 20, 1, 23, 70, 3811 }, // Z
+    { 7, 32, 10, 2, 26, 50, 3881 }, // [
+    { 14, 26, 16, 1, 24, 52, 3931 }, // <backslash>
+    { 7, 32, 10, 1, 26, 49, 3983 }, // ]
+    { 16, 15, 21, 2, 21, 43, 4032 }, // ^
+    { 17, 3, 18, 0, -1, 14, 4075 }, // _
+    { 8, 9, 22, 7, 28, 12, 4089 }, // `
+    { 18, 19, 20, 1, 18, 63, 4101 }, // a
+    { 20, 27, 20, -1, 26, 76, 4164 }, // b
+    { 15, 19, 17, 1, 18, 52, 4240 }, // c
+    { 20, 27, 22, 1, 26, 83, 4292 }, // d
+    { 15, 19, 17, 1, 18, 57, 4375 }, // e
+    { 16, 26, 17, 0, 26, 63, 4432 }, // f
+    { 19, 26, 20, 0, 18, 88, 4495 }, // g
+    { 22, 26, 23, 0, 26, 81, 4583 }, // h
+    { 11, 26, 12, 0, 26, 40, 4664 }, // i
+    { 10, 34, 9, -2, 26, 60, 4704 }, // j
+    { 20, 27, 21, 0, 26, 80, 4764 }, // k
+    { 11, 26, 12, 0, 26, 44, 4844 }, // l
+    { 33, 18, 34, 0, 18, 94, 4888 }, // m
+    { 22, 18, 23, 0, 18, 67, 4982 }, // n
+    { 18, 19, 20, 1, 18, 60, 5049 }, // o
+    { 19, 26, 20, 0, 18, 92, 5109 }, // p
+    { 19, 26, 21, 1, 18, 80, 5201 }, // q
+    { 15, 18, 16, 0, 18, 45, 5281 }, // r
+    { 14, 19, 16, 1, 18, 53, 5326 }, // s
+    { 13, 23, 14, 0, 22, 59, 5379 }, // t
+    { 22, 19, 23, 0, 18, 71, 5438 }, // u
+    { 20, 18, 21, 0, 17, 56, 5509 }, // v
+    { 29, 18, 30, 0, 17, 94, 5565 }, // w
+    { 20, 17, 21, 0, 17, 54, 5659 }, // x
+    { 20, 25, 21, 0, 17, 75, 5713 }, // y
+    { 15, 18, 17, 1, 17, 52, 5788 }, // z
+    { 10, 33, 13, 2, 27, 50, 5840 }, // {
+    { 3, 30, 9, 3, 26, 12, 5890 }, // |
+    { 11, 33, 13, 0, 27, 56, 5902 }, // }
+    { 16, 6, 21, 2, 14, 22, 5958 }, // ~
+    { 0, 0, 7, 0, 0, 0, 5980 }, //  
+    { 6, 26, 9, 1, 18, 33, 5980 }, // ¡
+    { 16, 33, 21, 2, 26, 89, 6013 }, // ¢
+    { 19, 24, 21, 1, 23, 73, 6102 }, // £
+    { 19, 16, 21, 1, 19, 54, 6175 }, // ¤
+    { 22, 23, 22, -1, 23, 81, 6229 }, // ¥
+    { 3, 30, 9, 3, 26, 14, 6310 }, // ¦
+    { 15, 26, 17, 1, 23, 77, 6324 }, // §
+    { 12, 5, 22, 5, 25, 16, 6401 }, // ¨
+    { 25, 25, 26, 0, 24, 117, 6417 }, // ©
+    { 11, 16, 15, 2, 24, 39, 6534 }, // ª
+    { 17, 13, 19, 1, 15, 40, 6573 }, // «
+    { 15, 8, 21, 3, 15, 21, 6613 }, // ¬
+    { 11, 3, 13, 1, 10, 8, 6634 }, // ­
+    { 19, 18, 20, 0, 26, 84, 6642 }, // ®
+    { 12, 4, 22, 5, 24, 11, 6726 }, // ¯
+    { 12, 11, 17, 3, 23, 31, 6737 }, // °
+    { 15, 20, 21, 3, 20, 50, 6768 }, // ±
+    { 12, 16, 15, 2, 28, 38, 6818 }, // ²
+    { 11, 17, 15, 2, 28, 36, 6856 }, // ³
+    { 7, 8, 22, 8, 27, 12, 6892 }, // ´
+    { 21, 26, 24, 2, 18, 81, 6904 }, // µ
+    { 17, 28, 18, 0, 23, 104, 6985 }, // ¶
+    { 5, 6, 9, 2, 12, 6, 7089 }, // ·
+    { 6, 8, 22, 8, -1, 12, 7095 }, // ¸
+    { 10, 16, 15, 2, 28, 27, 7107 }, // ¹
+    { 12, 16, 15, 2, 24, 36, 7134 }, // º
+    { 17, 13, 19, 1, 15, 38, 7170 }, // »
+    { 32, 27, 36, 2, 24, 122, 7208 }, // ¼
+    { 32, 27, 36, 2, 24, 123, 7330 }, // ½
+    { 33, 27, 36, 2, 24, 134, 7453 }, // ¾
+    { 13, 25, 16, 1, 18, 49, 7587 }, // ¿
+    { 25, 32, 26, 0, 32, 107, 7636 }, // À
+    { 25, 32, 26, 0, 32, 109, 7743 }, // Á
+    { 25, 32, 26, 0, 32, 111, 7852 }, // Â
+    { 25, 31, 26, 0, 31, 110, 7963 }, // Ã
+    { 25, 31, 26, 0, 31, 108, 8073 }, // Ä
+    { 25, 33, 26, 0, 33, 119, 8181 }, // Å
+    { 31, 23, 31, -1, 23, 117, 8300 }, // Æ
+    { 19, 33, 21, 1, 24, 87, 8417 }, // Ç
+    { 19, 32, 21, 1, 32, 92, 8504 }, // È
+    { 19, 32, 21, 1, 32, 93, 8596 }, // É
+    { 19, 32, 21, 1, 32, 97, 8689 }, // Ê
+    { 19, 31, 21, 1, 31, 93, 8786 }, // Ë
+    { 11, 32, 13, 1, 32, 55, 8879 }, // Ì
+    { 11, 32, 13, 1, 32, 53, 8934 }, // Í
+    { 12, 32, 13, 0, 32, 59, 8987 }, // Î
+    { 12, 31, 13, 0, 31, 56, 9046 }, // Ï
+    { 24, 25, 25, 0, 24, 95, 9102 }, // Ð
+    { 26, 32, 28, 1, 31, 126, 9197 }, // Ñ
+    { 24, 33, 26, 1, 32, 113, 9323 }, // Ò
+    { 24, 33, 26, 1, 32, 114, 9436 }, // Ó
+    { 24, 33, 26, 1, 32, 115, 9550 }, // Ô
+    { 24, 32, 26, 1, 31, 115, 9665 }, // Õ
+    { 24, 32, 26, 1, 31, 113, 9780 }, // Ö
+    { 14, 14, 21, 3, 18, 36, 9893 }, // ×
+    { 25, 25, 26, 0, 24, 118, 9929 }, // Ø
+    { 25, 33, 26, 0, 32, 106, 10047 }, // Ù
+    { 25, 33, 26, 0, 32, 106, 10153 }, // Ú
+    { 25, 33, 26, 0, 32, 107, 10259 }, // Û
+    { 25, 32, 26, 0, 31, 105, 10366 }, // Ü
+    { 23, 32, 24, 0, 32, 94, 10471 }, // Ý
+    { 18, 23, 21, 1, 23, 77, 10565 }, // Þ
+    { 21, 27, 22, 0, 26, 83, 10642 }, // ß
+    { 18, 29, 20, 1, 28, 81, 10725 }, // à
+    { 18, 28, 20, 1, 27, 79, 10806 }, // á
+    { 18, 28, 20, 1, 27, 86, 10885 }, // â
+    { 18, 27, 20, 1, 26, 86, 10971 }, // ã
+    { 18, 26, 20, 1, 25, 79, 11057 }, // ä
+    { 18, 29, 20, 1, 28, 90, 11136 }, // å
+    { 25, 19, 27, 1, 18, 93, 11226 }, // æ
+    { 15, 27, 17, 1, 18, 69, 11319 }, // ç
+    { 15, 29, 17, 1, 28, 74, 11388 }, // è
+    { 15, 28, 17, 1, 27, 73, 11462 }, // é
+    { 15, 28, 17, 1, 27, 77, 11535 }, // ê
+    { 15, 26, 17, 1, 25, 75, 11612 }, // ë
+    { 11, 28, 12, 0, 28, 44, 11687 }, // ì
+    { 11, 27, 12, 0, 27, 42, 11731 }, // í
+    { 11, 27, 12, 0, 27, 48, 11773 }, // î
+    { 12, 25, 12, -1, 25, 45, 11821 }, // ï
+    { 18, 28, 20, 1, 27, 84, 11866 }, // ð
+    { 22, 26, 23, 0, 26, 90, 11950 }, // ñ
+    { 18, 29, 20, 1, 28, 78, 12040 }, // ò
+    { 18, 28, 20, 1, 27, 77, 12118 }, // ó
+    { 18, 28, 20, 1, 27, 83, 12195 }, // ô
+    { 18, 27, 20, 1, 26, 82, 12278 }, // õ
+    { 18, 26, 20, 1, 25, 78, 12360 }, // ö
+    { 15, 16, 21, 3, 19, 36, 12438 }, // ÷
+    { 19, 19, 20, 0, 18, 76, 12474 }, // ø
+    { 22, 29, 23, 0, 28, 92, 12550 }, // ù
+    { 22, 28, 23, 0, 27, 91, 12642 }, // ú
+    { 22, 28, 23, 0, 27, 96, 12733 }, // û
+    { 22, 26, 23, 0, 25, 91, 12829 }, // ü
+    { 20, 35, 21, 0, 27, 93, 12920 }, // ý
+    { 20, 34, 21, 0, 26, 99, 13013 }, // þ
+    { 20, 33, 21, 0, 25, 94, 13112 }, // ÿ
+    { 25, 30, 26, 0, 30, 108, 13206 }, // Ā
+    { 18, 25, 20, 1, 24, 78, 13314 }, // ā
+    { 25, 32, 26, 0, 32, 111, 13392 }, // Ă
+    { 18, 27, 20, 1, 26, 83, 13503 }, // ă
+    { 25, 31, 26, 0, 24, 108, 13586 }, // Ą
+    { 18, 25, 20, 1, 18, 77, 13694 }, // ą
+    { 19, 33, 21, 1, 32, 86, 13771 }, // Ć
+    { 15, 28, 17, 1, 27, 68, 13857 }, // ć
+    { 19, 33, 21, 1, 32, 91, 13925 }, // Ĉ
+    { 15, 28, 17, 1, 27, 72, 14016 }, // ĉ
+    { 19, 32, 21, 1, 31, 84, 14088 }, // Ċ
+    { 15, 26, 17, 1, 25, 64, 14172 }, // ċ
+    { 19, 33, 21, 1, 32, 90, 14236 }, // Č
+    { 15, 28, 17, 1, 27, 74, 14326 }, // č
+    { 23, 33, 25, 1, 32, 110, 14400 }, // Ď
+    { 23, 27, 25, 1, 26, 97, 14510 }, // ď
+    { 24, 25, 25, 0, 24, 95, 14607 }, // Đ
+    { 20, 27, 22, 1, 26, 85, 14702 }, // đ
+    { 19, 30, 21, 1, 30, 96, 14787 }, // Ē
+    { 15, 25, 17, 1, 24, 70, 14883 }, // ē
+    { 19, 32, 21, 1, 32, 96, 14953 }, // Ĕ
+    { 15, 27, 17, 1, 26, 71, 15049 }, // ĕ
+    { 19, 31, 21, 1, 31, 91, 15120 }, // Ė
+    { 15, 26, 17, 1, 25, 69, 15211 }, // ė
+    { 19, 30, 21, 1, 23, 93, 15280 }, // Ę
+    { 15, 25, 17, 1, 18, 72, 15373 }, // ę
+    { 19, 32, 21, 1, 32, 97, 15445 }, // Ě
+    { 15, 28, 17, 1, 27, 78, 15542 }, // ě
+    { 22, 33, 24, 1, 32, 110, 15620 }, // Ĝ
+    { 19, 35, 20, 0, 27, 111, 15730 }, // ĝ
+    { 22, 33, 24, 1, 32, 111, 15841 }, // Ğ
+    { 19, 34, 20, 0, 26, 105, 15952 }, // ğ
+    { 22, 32, 24, 1, 31, 105, 16057 }, // Ġ
+    { 19, 33, 20, 0, 25, 100, 16162 }, // ġ
+    { 22, 33, 24, 1, 24, 109, 16262 }, // Ģ
+    { 19, 36, 20, 0, 28, 108, 16371 }, // ģ
+    { 26, 32, 28, 1, 32, 119, 16479 }, // Ĥ
+    { 23, 34, 23, -1, 34, 105, 16598 }, // ĥ
+    { 27, 23, 28, 0, 23, 96, 16703 }, // Ħ
+    { 22, 26, 23, 0, 26, 82, 16799 }, // ħ
+    { 12, 31, 13, 0, 31, 59, 16881 }, // Ĩ
+    { 11, 26, 12, 0, 26, 48, 16940 }, // ĩ
+    { 12, 30, 13, 0, 30, 58, 16988 }, // Ī
+    { 11, 24, 12, 0, 24, 42, 17046 }, // ī
+    { 12, 32, 13, 0, 32, 59, 17088 }, // Ĭ
+    { 11, 26, 12, 0, 26, 46, 17147 }, // ĭ
+    { 11, 30, 13, 1, 23, 53, 17193 }, // Į
+    { 11, 33, 12, 0, 26, 54, 17246 }, // į
+    { 11, 31, 13, 1, 31, 51, 17300 }, // İ
+    { 11, 18, 12, 0, 18, 30, 17351 }, // ı
+    { 22, 30, 24, 1, 23, 94, 17381 }, // Ĳ
+    { 18, 34, 20, 0, 26, 93, 17475 }, // ĳ
+    { 14, 39, 13, -2, 32, 81, 17568 }, // Ĵ
+    { 13, 35, 12, -2, 27, 80, 17649 }, // ĵ
+    { 23, 32, 25, 1, 23, 107, 17729 }, // Ķ
+    { 20, 35, 21, 0, 26, 97, 17836 }, // ķ
+    { 21, 19, 22, 0, 18, 62, 17933 }, // ĸ
+    { 19, 32, 21, 1, 32, 81, 17995 }, // Ĺ
+    { 11, 34, 12, 0, 34, 57, 18076 }, // ĺ
+    { 19, 32, 21, 1, 23, 81, 18133 }, // Ļ
+    { 11, 35, 12, 0, 26, 57, 18214 }, // ļ
+    { 19, 26, 21, 1, 26, 75, 18271 }, // Ľ
+    { 14, 26, 15, 0, 26, 62, 18346 }, // ľ
+    { 19, 23, 21, 1, 23, 68, 18408 }, // Ŀ
+    { 16, 26, 17, 0, 26, 60, 18476 }, // ŀ
+    { 21, 23, 21, -1, 23, 74, 18536 }, // Ł
+    { 13, 26, 13, -1, 26, 56, 18610 }, // ł
+    { 26, 33, 28, 1, 32, 127, 18666 }, // Ń
+    { 22, 27, 23, 0, 27, 87, 18793 }, // ń
+    { 26, 32, 28, 1, 23, 124, 18880 }, // Ņ
+    { 22, 27, 23, 0, 18, 89, 19004 }, // ņ
+    { 26, 33, 28, 1, 32, 129, 19093 }, // Ň
+    { 22, 27, 23, 0, 27, 92, 19222 }, // ň
+    { 29, 25, 31, 1, 25, 95, 19314 }, // ŉ
+    { 26, 30, 28, 1, 23, 124, 19409 }, // Ŋ
+    { 19, 26, 21, 0, 18, 85, 19533 }, // ŋ
+    { 24, 31, 26, 1, 30, 114, 19618 }, // Ō
+    { 18, 25, 20, 1, 24, 75, 19732 }, // ō
+    { 24, 33, 26, 1, 32, 115, 19807 }, // Ŏ
+    { 18, 27, 20, 1, 26, 78, 19922 }, // ŏ
+    { 24, 34, 26, 1, 33, 123, 20000 }, // Ő
+    { 18, 28, 20, 1, 27, 86, 20123 }, // ő
+    { 30, 24, 32, 1, 23, 115, 20209 }, // Œ
+    { 28, 19, 30, 1, 18, 98, 20324 }, // œ
+    { 22, 33, 24, 1, 32, 105, 20422 }, // Ŕ
+    { 15, 27, 16, 0, 27, 61, 20527 }, // ŕ
+    { 22, 33, 24, 1, 24, 105, 20588 }, // Ŗ
+    { 15, 27, 16, 0, 18, 62, 20693 }, // ŗ
+    { 22, 33, 24, 1, 32, 110, 20755 }, // Ř
+    { 15, 27, 16, 0, 27, 65, 20865 }, // ř
+    { 16, 33, 18, 1, 32, 86, 20930 }, // Ś
+    { 14, 28, 16, 1, 27, 71, 21016 }, // ś
+    { 16, 33, 18, 1, 32, 90, 21087 }, // Ŝ
+    { 14, 28, 16, 1, 27, 73, 21177 }, // ŝ
+    { 16, 33, 18, 1, 24, 86, 21250 }, // Ş
+    { 14, 27, 16, 1, 18, 69, 21336 }, // ş
+    { 16, 33, 18, 1, 32, 90, 21405 }, // Š
+    { 14, 28, 16, 1, 27, 73, 21495 }, // š
+    { 21, 32, 23, 1, 23, 96, 21568 }, // Ţ
+    { 13, 31, 14, 0, 22, 74, 21664 }, // ţ
+    { 21, 32, 23, 1, 32, 98, 21738 }, // Ť
+    { 13, 28, 14, 0, 27, 71, 21836 }, // ť
+    { 21, 23, 23, 1, 23, 79, 21907 }, // Ŧ
+    { 13, 23, 14, 0, 22, 64, 21986 }, // ŧ
+    { 25, 32, 26, 0, 31, 106, 22050 }, // Ũ
+    { 22, 27, 23, 0, 26, 93, 22156 }, // ũ
+    { 25, 31, 26, 0, 30, 106, 22249 }, // Ū
+    { 22, 25, 23, 0, 24, 86, 22355 }, // ū
+    { 25, 33, 26, 0, 32, 108, 22441 }, // Ŭ
+    { 22, 27, 23, 0, 26, 89, 22549 }, // ŭ
+    { 25, 34, 26, 0, 33, 117, 22638 }, // Ů
+    { 22, 29, 23, 0, 28, 97, 22755 }, // ů
+    { 25, 34, 26, 0, 33, 112, 22852 }, // Ű
+    { 22, 28, 23, 0, 27, 98, 22964 }, // ű
+    { 25, 30, 26, 0, 23, 100, 23062 }, // Ų
+    { 22, 25, 23, 0, 18, 89, 23162 }, // ų
+    { 36, 33, 37, 0, 32, 165, 23251 }, // Ŵ
+    { 29, 28, 30, 0, 27, 123, 23416 }, // ŵ
+    { 23, 32, 24, 0, 32, 96, 23539 }, // Ŷ
+    { 20, 35, 21, 0, 27, 101, 23635 }, // ŷ
+    { 23, 31, 24, 0, 31, 93, 23736 }, // Ÿ
+    { 18, 33, 20, 1, 32, 88, 23829 }, // Ź
+    { 15, 28, 17, 1, 27, 68, 23917 }, // ź
+    { 18, 32, 20, 1, 31, 84, 23985 }, // Ż
+    { 15, 26, 17, 1, 25, 66, 24069 }, // ż
+    { 18, 33, 20, 1, 32, 92, 24135 }, // Ž
+    { 15, 28, 17, 1, 27, 74, 24227 }, // ž
+    { 16, 26, 17, 0, 26, 58, 24301 }, // ſ
+    { 25, 29, 27, 1, 28, 106, 24359 }, // Ơ
+    { 19, 22, 21, 1, 21, 69, 24465 }, // ơ
+    { 21, 24, 22, 0, 24, 80, 24534 }, // Ƥ
+    { 20, 34, 21, 0, 26, 102, 24614 }, // ƥ
+    { 13, 30, 14, 0, 22, 76, 24716 }, // ƫ
+    { 22, 23, 23, 0, 23, 75, 24792 }, // Ƭ
+    { 16, 27, 17, 0, 26, 73, 24867 }, // ƭ
+    { 21, 30, 23, 1, 23, 94, 24940 }, // Ʈ
+    { 27, 29, 28, 0, 28, 98, 25034 }, // Ư
+    { 22, 22, 23, 0, 21, 80, 25132 }, // ư
+    { 7, 9, 3, -5, 28, 12, 25212 }, // ̀
+    { 7, 8, 6, -2, 27, 14, 25224 }, // ́
+    { 12, 8, 7, -6, 27, 19, 25238 }, // ̂
+    { 12, 6, 7, -6, 26, 17, 25257 }, // ̃
+    { 12, 4, 7, -6, 24, 11, 25274 }, // ̄
+    { 12, 6, 7, -6, 26, 12, 25285 }, // ̆
+    { 6, 5, 4, -3, 25, 7, 25297 }, // ̇
+    { 12, 5, 7, -6, 25, 17, 25304 }, // ̈
+    { 10, 10, 6, -5, 29, 21, 25321 }, // ̉
+    { 10, 10, 6, -5, 28, 21, 25342 }, // ̊
+    { 12, 8, 8, -5, 27, 22, 25363 }, // ̋
+    { 12, 8, 7, -6, 27, 18, 25385 }, // ̌
+    { 12, 8, 6, -7, 27, 21, 25403 }, // ̏
+    { 12, 6, 7, -6, 26, 16, 25424 }, // ̑
+    { 6, 9, 4, -3, 28, 16, 25440 }, // ̒
+    { 6, 10, 5, -2, 29, 15, 25456 }, // ̓
+    { 6, 10, 3, -4, 29, 14, 25471 }, // ̔
+    { 4, 9, 3, -2, 29, 11, 25485 }, // ̕
+    { 6, 8, 4, -3, 21, 12, 25496 }, // ̛
+    { 6, 6, 4, -3, -2, 7, 25508 }, // ̣
+    { 12, 5, 7, -6, -3, 15, 25515 }, // ̤
+    { 8, 8, 5, -4, -1, 21, 25530 }, // ̥
+    { 6, 8, 4, -3, -1, 11, 25551 }, // ̦
+    { 6, 8, 4, -3, -1, 12, 25562 }, // ̧
+    { 8, 8, 5, -4, 1, 15, 25574 }, // ̨
+    { 3, 8, 9, 3, -1, 5, 25589 }, // ̩
+    { 12, 7, 7, -6, -2, 15, 25594 }, // ̭
+    { 12, 6, 7, -6, -2, 17, 25609 }, // ̮
+    { 12, 6, 7, -6, -2, 16, 25626 }, // ̰
+    { 12, 4, 7, -6, -3, 11, 25642 }, // ̱
+    { 12, 6, 7, -6, 26, 16, 25653 }, // ͂
+    { 12, 13, 7, -6, 33, 29, 25669 }, // ̈́
+    { 6, 6, 5, -2, -2, 11, 25698 }, // ͅ
+    { 25, 24, 26, 0, 24, 88, 25709 }, // Α
+    { 19, 25, 21, 1, 24, 80, 25797 }, // Β
+    { 17, 23, 19, 1, 23, 59, 25877 }, // Γ
+    { 20, 24, 22, 1, 24, 75, 25936 }, // Δ
+    { 19, 23, 21, 1, 23, 75, 26011 }, // Ε
+    { 18, 24, 20, 1, 23, 70, 26086 }, // Ζ
+    { 26, 23, 28, 1, 23, 93, 26156 }, // Η
+    { 24, 25, 26, 1, 24, 99, 26249 }, // Θ
+    { 11, 23, 13, 1, 23, 40, 26348 }, // Ι
+    { 23, 24, 25, 1, 23, 88, 26388 }, // Κ
+    { 24, 24, 25, 0, 24, 80, 26476 }, // Λ
+    { 30, 23, 31, 0, 23, 122, 26556 }, // Μ
+    { 26, 24, 28, 1, 23, 103, 26678 }, // Ν
+    { 19, 23, 21, 1, 23, 60, 26781 }, // Ξ
+    { 24, 25, 26, 1, 24, 94, 26841 }, // Ο
+    { 25, 23, 27, 1, 23, 90, 26935 }, // Π
+    { 18, 24, 20, 1, 24, 69, 27025 }, // Ρ
+    { 19, 24, 21, 1, 23, 68, 27094 }, // Σ
+    { 21, 23, 23, 1, 23, 75, 27162 }, // Τ
+    { 22, 24, 23, 0, 24, 73, 27237 }, // Υ
+    { 24, 25, 26, 1, 24, 106, 27310 }, // Φ
+    { 24, 23, 25, 0, 23, 81, 27416 }, // Χ
+    { 27, 24, 28, 0, 24, 88, 27497 }, // Ψ
+    { 25, 24, 27, 1, 24, 103, 27585 }, // Ω
+    { 21, 19, 23, 1, 18, 69, 27688 }, // α
+    { 17, 34, 20, 2, 26, 93, 27757 }, // β
+    { 18, 26, 19, 0, 18, 68, 27850 }, // γ
+    { 17, 27, 20, 1, 26, 75, 27918 }, // δ
+    { 14, 19, 16, 1, 18, 49, 27993 }, // ε
+    { 14, 34, 16, 1, 27, 76, 28042 }, // ζ
+    { 18, 26, 20, 0, 18, 72, 28118 }, // η
+    { 17, 27, 19, 1, 26, 84, 28190 }, // θ
+    { 9, 19, 12, 2, 18, 30, 28274 }, // ι
+    { 18, 19, 21, 2, 18, 53, 28304 }, // κ
+    { 20, 27, 21, 0, 26, 77, 28357 }, // λ
+    { 21, 26, 24, 2, 18, 81, 28434 }, // μ
+    { 18, 19, 19, 0, 18, 53, 28515 }, // ν
+    { 14, 34, 16, 1, 27, 74, 28568 }, // ξ
+    { 17, 19, 19, 1, 18, 59, 28642 }, // ο
+    { 21, 19, 22, 0, 18, 67, 28701 }, // π
+    { 16, 26, 19, 2, 18, 75, 28768 }, // ρ
+    { 15, 25, 17, 1, 18, 56, 28843 }, // ς
+    { 19, 19, 21, 1, 18, 59, 28899 }, // σ
+    { 17, 19, 18, 0, 18, 48, 28958 }, // τ
+    { 18, 19, 20, 0, 18, 60, 29006 }, // υ
+    { 25, 32, 27, 1, 24, 102, 29066 }, // φ
+    { 19, 26, 20, 0, 18, 79, 29168 }, // χ
+    { 26, 32, 27, 0, 24, 129, 29247 }, // ψ
+    { 23, 19, 26, 1, 18, 79, 29376 }, // ω
+    { 25, 32, 26, 0, 24, 105, 29455 }, // Ạ
+    { 18, 26, 20, 1, 18, 75, 29560 }, // ạ
+    { 25, 34, 26, 0, 34, 117, 29635 }, // Ả
+    { 18, 30, 20, 1, 29, 92, 29752 }, // ả
+    { 25, 35, 26, 0, 35, 122, 29844 }, // Ấ
+    { 18, 33, 20, 1, 32, 96, 29966 }, // ấ
+    { 25, 35, 26, 0, 35, 120, 30062 }, // Ầ
+    { 18, 33, 20, 1, 32, 94, 30182 }, // ầ
+    { 25, 35, 26, 0, 35, 124, 30276 }, // Ẩ
+    { 18, 33, 20, 1, 32, 105, 30400 }, // ẩ
+    { 25, 35, 26, 0, 35, 123, 30505 }, // Ẫ
+    { 18, 32, 20, 1, 31, 100, 30628 }, // ẫ
+    { 25, 40, 26, 0, 32, 128, 30728 }, // Ậ
+    { 18, 35, 20, 1, 27, 98, 30856 }, // ậ
+    { 25, 35, 26, 0, 35, 119, 30954 }, // Ắ
+    { 18, 33, 20, 1, 32, 95, 31073 }, // ắ
+    { 25, 35, 26, 0, 35, 121, 31168 }, // Ằ
+    { 18, 33, 20, 1, 32, 95, 31289 }, // ằ
+    { 25, 35, 26, 0, 35, 124, 31384 }, // Ẳ
+    { 18, 34, 20, 1, 33, 103, 31508 }, // ẳ
+    { 25, 35, 26, 0, 35, 124, 31611 }, // Ẵ
+    { 18, 32, 20, 1, 31, 98, 31735 }, // ẵ
+    { 25, 40, 26, 0, 32, 127, 31833 }, // Ặ
+    { 18, 34, 20, 1, 26, 95, 31960 }, // ặ
+    { 19, 31, 21, 1, 23, 89, 32055 }, // Ẹ
+    { 15, 26, 17, 1, 18, 68, 32144 }, // ẹ
+    { 19, 34, 21, 1, 34, 101, 32212 }, // Ẻ
+    { 15, 30, 17, 1, 29, 83, 32313 }, // ẻ
+    { 19, 31, 21, 1, 31, 97, 32396 }, // Ẽ
+    { 15, 27, 17, 1, 26, 76, 32493 }, // ẽ
+    { 19, 35, 21, 1, 35, 107, 32569 }, // Ế
+    { 17, 33, 19, 1, 32, 92, 32676 }, // ế
+    { 19, 35, 21, 1, 35, 106, 32768 }, // Ề
+    { 15, 33, 17, 1, 32, 89, 32874 }, // ề
+    { 19, 35, 21, 1, 35, 108, 32963 }, // Ể
+    { 18, 33, 20, 1, 32, 99, 33071 }, // ể
+    { 19, 35, 21, 1, 35, 109, 33170 }, // Ễ
+    { 15, 32, 17, 1, 31, 88, 33279 }, // ễ
+    { 19, 40, 21, 1, 32, 111, 33367 }, // Ệ
+    { 15, 35, 17, 1, 27, 87, 33478 }, // ệ
+    { 11, 34, 13, 1, 34, 61, 33565 }, // Ỉ
+    { 11, 29, 12, 0, 29, 54, 33626 }, // ỉ
+    { 11, 31, 13, 1, 23, 50, 33680 }, // Ị
+    { 11, 34, 12, 0, 26, 49, 33730 }, // ị
+    { 24, 32, 26, 1, 24, 109, 33779 }, // Ọ
+    { 18, 26, 20, 1, 18, 72, 33888 }, // ọ
+    { 24, 35, 26, 1, 34, 122, 33960 }, // Ỏ
+    { 18, 30, 20, 1, 29, 87, 34082 }, // ỏ
+    { 24, 36, 26, 1, 35, 126, 34169 }, // Ố
+    { 18, 33, 20, 1, 32, 93, 34295 }, // ố
+    { 24, 36, 26, 1, 35, 126, 34388 }, // Ồ
+    { 18, 33, 20, 1, 32, 96, 34514 }, // ồ
+    { 24, 36, 26, 1, 35, 129, 34610 }, // Ổ
+    { 19, 33, 21, 1, 32, 99, 34739 }, // ổ
+    { 24, 36, 26, 1, 35, 128, 34838 }, // Ỗ
+    { 18, 32, 20, 1, 31, 98, 34966 }, // ỗ
+    { 24, 40, 26, 1, 32, 130, 35064 }, // Ộ
+    { 18, 35, 20, 1, 27, 95, 35194 }, // ộ
+    { 25, 33, 27, 1, 32, 122, 35289 }, // Ớ
+    { 19, 28, 21, 1, 27, 83, 35411 }, // ớ
+    { 25, 33, 27, 1, 32, 119, 35494 }, // Ờ
+    { 19, 29, 21, 1, 28, 84, 35613 }, // ờ
+    { 25, 35, 27, 1, 34, 129, 35697 }, // Ở
+    { 19, 30, 21, 1, 29, 93, 35826 }, // ở
+    { 25, 32, 27, 1, 31, 122, 35919 }, // Ỡ
+    { 19, 27, 21, 1, 26, 89, 36041 }, // ỡ
+    { 25, 36, 27, 1, 28, 121, 36130 }, // Ợ
+    { 19, 29, 21, 1, 21, 82, 36251 }, // ợ
+    { 25, 31, 26, 0, 23, 97, 36333 }, // Ụ
+    { 22, 26, 23, 0, 18, 85, 36430 }, // ụ
+    { 25, 35, 26, 0, 34, 114, 36515 }, // Ủ
+    { 22, 30, 23, 0, 29, 103, 36629 }, // ủ
+    { 27, 33, 28, 0, 32, 113, 36732 }, // Ứ
+    { 22, 28, 23, 0, 27, 95, 36845 }, // ứ
+    { 27, 33, 28, 0, 32, 113, 36940 }, // Ừ
+    { 22, 29, 23, 0, 28, 97, 37053 }, // ừ
+    { 27, 35, 28, 0, 34, 121, 37150 }, // Ử
+    { 22, 30, 23, 0, 29, 108, 37271 }, // ử
+    { 27, 32, 28, 0, 31, 114, 37379 }, // Ữ
+    { 22, 27, 23, 0, 26, 97, 37493 }, // ữ
+    { 27, 36, 28, 0, 28, 113, 37590 }, // Ự
+    { 22, 29, 23, 0, 21, 94, 37703 }, // ự
+    { 23, 32, 24, 0, 32, 95, 37797 }, // Ỳ
+    { 20, 36, 21, 0, 28, 96, 37892 }, // ỳ
+    { 23, 31, 24, 0, 23, 88, 37988 }, // Ỵ
+    { 20, 25, 21, 0, 17, 79, 38076 }, // ỵ
+    { 23, 34, 24, 0, 34, 102, 38155 }, // Ỷ
+    { 20, 37, 21, 0, 29, 106, 38257 }, // ỷ
+    { 23, 31, 24, 0, 31, 95, 38363 }, // Ỹ
+    { 20, 34, 21, 0, 26, 101, 38458 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 38559 }, //  
+    { 0, 0, 33, 0, 0, 0, 38559 }, //  
+    { 0, 0, 17, 0, 0, 0, 38559 }, //  
+    { 0, 0, 33, 0, 0, 0, 38559 }, //  
+    { 0, 0, 11, 0, 0, 0, 38559 }, //  
+    { 0, 0, 8, 0, 0, 0, 38559 }, //  
+    { 0, 0, 5, 0, 0, 0, 38559 }, //  
+    { 0, 0, 21, 0, 0, 0, 38559 }, //  
+    { 0, 0, 9, 0, 0, 0, 38559 }, //  
+    { 0, 0, 7, 0, 0, 0, 38559 }, //  
+    { 0, 0, 2, 0, 0, 0, 38559 }, //  
+    { 0, 0, 1, 0, 0, 0, 38559 }, // ​
+    { 2, 28, 2, -1, 20, 27, 38559 }, // ‌
+    { 8, 30, 5, -4, 22, 51, 38586 }, // ‍
+    { 12, 31, 7, -6, 23, 70, 38637 }, // ‎
+    { 12, 31, 7, -6, 23, 69, 38707 }, // ‏
+    { 11, 3, 13, 1, 10, 8, 38776 }, // ‐
+    { 11, 3, 13, 1, 10, 8, 38784 }, // ‑
+    { 16, 3, 21, 2, 13, 13, 38792 }, // ‒
+    { 17, 3, 18, 0, 10, 20, 38805 }, // –
+    { 33, 3, 34, 0, 10, 38, 38825 }, // —
+    { 33, 3, 34, 0, 10, 38, 38863 }, // ―
+    { 11, 34, 17, 3, 26, 104, 38901 }, // ‖
+    { 17, 8, 18, 0, -1, 23, 39005 }, // ‗
+    { 6, 11, 8, 1, 25, 16, 39028 }, // ‘
+    { 6, 11, 8, 1, 25, 16, 39044 }, // ’
+    { 6, 10, 8, 1, 4, 15, 39060 }, // ‚
+    { 6, 11, 8, 1, 25, 16, 39075 }, // ‛
+    { 13, 11, 15, 1, 25, 32, 39091 }, // “
+    { 12, 11, 14, 1, 25, 33, 39123 }, // ”
+    { 12, 10, 14, 1, 4, 31, 39156 }, // „
+    { 13, 11, 15, 1, 25, 33, 39187 }, // ‟
+    { 15, 22, 17, 1, 24, 53, 39220 }, // †
+    { 15, 26, 17, 1, 24, 70, 39273 }, // ‡
+    { 8, 7, 10, 1, 12, 15, 39343 }, // •
+    { 12, 12, 21, 4, 17, 24, 39358 }, // ‣
+    { 5, 5, 9, 2, 4, 8, 39382 }, // ․
+    { 14, 5, 17, 1, 4, 16, 39390 }, // ‥
+    { 27, 5, 33, 3, 4, 26, 39406 }, // …
+    { 5, 6, 9, 2, 12, 6, 39432 }, // ‧
+    { 0, 0, 1, 0, 0, 0, 39438 }, //  
+    { 0, 0, 1, 0, 0, 0, 39438 }, //  
+    { 12, 31, 7, -6, 23, 71, 39438 }, // ‪
+    { 12, 31, 7, -6, 23, 69, 39509 }, // ‫
+    { 10, 31, 6, -5, 23, 56, 39578 }, // ‬
+    { 14, 31, 8, -7, 23, 83, 39634 }, // ‭
+    { 14, 31, 8, -7, 23, 82, 39717 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 39799 }, //  
+    { 43, 26, 45, 1, 24, 187, 39799 }, // ‰
+    { 7, 11, 9, 1, 23, 17, 39986 }, // ′
+    { 13, 11, 15, 1, 23, 32, 40003 }, // ″
+    { 20, 11, 22, 1, 23, 48, 40035 }, // ‴
+    { 7, 11, 9, 1, 23, 16, 40083 }, // ‵
+    { 14, 11, 16, 1, 23, 32, 40099 }, // ‶
+    { 21, 11, 23, 1, 23, 48, 40131 }, // ‷
+    { 14, 7, 16, 1, 0, 21, 40179 }, // ‸
+    { 8, 13, 11, 1, 15, 20, 40200 }, // ‹
+    { 9, 13, 11, 1, 15, 19, 40220 }, // ›
+    { 21, 23, 22, 0, 22, 88, 40239 }, // ※
+    { 15, 26, 18, 2, 25, 67, 40327 }, // ‼
+    { 17, 3, 18, 0, 27, 14, 40394 }, // ‾
+    { 8, 3, 10, 1, 10, 7, 40408 }, // ⁃
+    { 16, 27, 12, -5, 24, 54, 40415 }, // ⁄
+    { 26, 25, 29, 2, 24, 103, 40469 }, // ⁇
+    { 21, 26, 25, 2, 25, 99, 40572 }, // ⁈
+    { 21, 26, 25, 2, 25, 85, 40671 }, // ⁉
+    { 19, 6, 33, 7, 13, 24, 40756 }, // ⁓
+    { 26, 11, 28, 1, 23, 64, 40780 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 40844 }, //  
+    { 0, 0, 1, 0, 0, 0, 40844 }, // ⁠
+    { 0, 0, 1, 0, 0, 0, 40844 }, // ⁡
+    { 0, 0, 1, 0, 0, 0, 40844 }, // ⁢
+    { 0, 0, 1, 0, 0, 0, 40844 }, // ⁣
+    { 0, 0, 1, 0, 0, 0, 40844 }, // ⁤
+    { 13, 17, 15, 1, 28, 43, 40844 }, // ⁰
+    { 13, 17, 15, 1, 28, 42, 40887 }, // ⁴
+    { 10, 16, 15, 2, 27, 30, 40929 }, // ⁵
+    { 12, 17, 15, 2, 28, 39, 40959 }, // ⁶
+    { 12, 16, 15, 2, 27, 33, 40998 }, // ⁷
+    { 11, 17, 15, 2, 28, 43, 41031 }, // ⁸
+    { 11, 17, 15, 2, 28, 36, 41074 }, // ⁹
+    { 15, 11, 19, 2, 23, 43, 41110 }, // ⁿ
+    { 13, 16, 15, 1, 11, 45, 41153 }, // ₀
+    { 10, 16, 15, 2, 11, 30, 41198 }, // ₁
+    { 12, 16, 15, 2, 11, 40, 41228 }, // ₂
+    { 11, 16, 15, 2, 11, 38, 41268 }, // ₃
+    { 13, 16, 15, 1, 11, 40, 41306 }, // ₄
+    { 10, 16, 15, 2, 11, 30, 41346 }, // ₅
+    { 12, 16, 15, 2, 11, 37, 41376 }, // ₆
+    { 12, 16, 15, 2, 11, 32, 41413 }, // ₇
+    { 11, 16, 15, 2, 11, 44, 41445 }, // ₈
+    { 11, 16, 15, 2, 11, 36, 41489 }, // ₉
+    { 18, 23, 21, 1, 23, 69, 41525 }, // ₣
+    { 19, 24, 21, 1, 23, 80, 41594 }, // ₤
+    { 39, 24, 41, 1, 23, 152, 41674 }, // ₧
+    { 20, 24, 21, 0, 23, 73, 41826 }, // €
+    { 19, 13, 33, 7, 18, 44, 41899 }, // ←
+    { 13, 21, 33, 10, 22, 61, 41943 }, // ↑
+    { 19, 13, 33, 7, 18, 43, 42004 }, // →
+    { 13, 21, 33, 10, 22, 62, 42047 }, // ↓
+    { 21, 13, 33, 6, 18, 51, 42109 }, // ↔
+    { 13, 23, 33, 10, 23, 65, 42160 }, // ↕
+    { 15, 22, 33, 9, 22, 73, 42225 }, // ↨
+    { 13, 21, 33, 10, 22, 57, 42298 }, // ↲
+    { 13, 21, 33, 10, 22, 56, 42355 }, // ↳
+    { 19, 15, 33, 7, 19, 51, 42411 }, // ↵
+    { 19, 15, 33, 7, 19, 53, 42462 }, // ⇐
+    { 15, 19, 33, 9, 21, 66, 42515 }, // ⇑
+    { 19, 15, 33, 7, 19, 52, 42581 }, // ⇒
+    { 15, 19, 33, 9, 21, 66, 42633 }, // ⇓
+    { 21, 15, 33, 6, 19, 57, 42699 }, // ⇔
+    { 23, 24, 33, 5, 23, 84, 42756 }, // ∀
+    { 17, 27, 21, 2, 26, 76, 42840 }, // ∂
+    { 15, 23, 33, 9, 23, 61, 42916 }, // ∃
+    { 25, 27, 33, 4, 25, 118, 42977 }, // ∅
+    { 20, 24, 22, 1, 24, 75, 43095 }, // ∆
+    { 21, 24, 33, 6, 23, 80, 43170 }, // ∇
+    { 21, 23, 33, 6, 23, 73, 43250 }, // ∈
+    { 21, 29, 33, 6, 26, 95, 43323 }, // ∉
+    { 21, 19, 33, 6, 21, 80, 43418 }, // ∊
+    { 21, 23, 33, 6, 23, 73, 43498 }, // ∋
+    { 21, 29, 33, 6, 26, 93, 43571 }, // ∌
+    { 21, 19, 33, 6, 21, 79, 43664 }, // ∍
+    { 25, 29, 27, 1, 23, 108, 43743 }, // ∏
+    { 20, 29, 21, 0, 23, 83, 43851 }, // ∑
+    { 15, 3, 21, 3, 13, 14, 43934 }, // −
+    { 14, 26, 16, 1, 24, 55, 43948 }, // ∕
+    { 15, 26, 18, 2, 24, 53, 44003 }, // ∖
+    { 15, 16, 21, 3, 19, 49, 44056 }, // ∗
+    { 12, 12, 21, 4, 17, 29, 44105 }, // ∘
+    { 6, 6, 21, 7, 12, 7, 44134 }, // ∙
+    { 21, 31, 22, 0, 27, 90, 44141 }, // √
+    { 16, 13, 21, 2, 17, 48, 44231 }, // ∝
+    { 21, 11, 22, 0, 16, 58, 44279 }, // ∞
+    { 21, 23, 33, 6, 23, 71, 44337 }, // ∟
+    { 23, 23, 33, 4, 23, 62, 44408 }, // ∠
+    { 4, 34, 17, 6, 26, 52, 44470 }, // ∣
+    { 10, 34, 17, 3, 26, 104, 44522 }, // ∥
+    { 21, 23, 33, 6, 23, 73, 44626 }, // ∧
+    { 21, 23, 33, 6, 23, 75, 44699 }, // ∨
+    { 19, 24, 33, 7, 24, 94, 44774 }, // ∩
+    { 19, 24, 33, 7, 23, 93, 44868 }, // ∪
+    { 18, 34, 21, 1, 26, 78, 44961 }, // ∫
+    { 21, 19, 33, 6, 18, 42, 45039 }, // ∴
+    { 21, 19, 33, 6, 18, 42, 45081 }, // ∵
+    { 6, 18, 10, 2, 20, 17, 45123 }, // ∶
+    { 21, 19, 33, 6, 18, 47, 45140 }, // ∷
+    { 19, 6, 33, 7, 13, 24, 45187 }, // ∼
+    { 19, 18, 33, 7, 20, 51, 45211 }, // ≅
+    { 16, 12, 21, 2, 17, 41, 45262 }, // ≈
+    { 19, 11, 33, 7, 15, 39, 45303 }, // ≍
+    { 15, 15, 21, 3, 19, 43, 45342 }, // ≠
+    { 19, 15, 33, 7, 17, 51, 45385 }, // ≡
+    { 15, 20, 21, 3, 20, 50, 45436 }, // ≤
+    { 15, 20, 21, 3, 20, 47, 45486 }, // ≥
+    { 27, 16, 33, 3, 19, 64, 45533 }, // ≪
+    { 27, 16, 33, 3, 19, 65, 45597 }, // ≫
+    { 21, 19, 33, 6, 21, 68, 45662 }, // ⊃
+    { 21, 29, 33, 6, 26, 102, 45730 }, // ⊄
+    { 21, 29, 33, 6, 26, 100, 45832 }, // ⊅
+    { 21, 23, 33, 6, 23, 71, 45932 }, // ⊆
+    { 21, 23, 33, 6, 23, 71, 46003 }, // ⊇
+    { 25, 25, 33, 4, 24, 131, 46074 }, // ⊕
+    { 25, 25, 33, 4, 24, 113, 46205 }, // ⊖
+    { 25, 25, 33, 4, 24, 117, 46318 }, // ⊗
+    { 25, 25, 33, 4, 24, 113, 46435 }, // ⊘
+    { 19, 23, 33, 7, 23, 38, 46548 }, // ⊥
+    { 6, 6, 21, 7, 12, 8, 46586 }, // ⋅
+    { 27, 6, 33, 3, 12, 25, 46594 }, // ⋯
+    { 31, 32, 33, 1, 28, 137, 46619 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_regularIntervals[] = {
@@ -5378,4 +3692,5 @@ static const EpdFontData bookerly_16_regular = {
     36,
     -9,
     true,
+    true,
 };
@@ -8119,4 +8119,5 @@ static const EpdFontData bookerly_20_regular = {
     45,
     -11,
     true,
+    false,
 };
@@ -2,3514 +2,2762 @@
  * generated by fontconvert.py
  * name: notosans_12_bold
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_12_bold 12 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_boldBitmaps[43527] = {
-    0x7F, 0xAF, 0xE7, 0xF9, 0xFD, 0x7F, 0x5F, 0xD7, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x00,
-    0x00, 0x02, 0xE2, 0xFE, 0xBF, 0x9F, 0xD0, 0x40, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x7F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xE0, 0xBC, 0x29, 0x06, 0x80, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x1F,
-    0x47, 0xD0, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x3F, 0x0F, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x1A, 0xFE, 0xBF, 0xE9, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x15, 0xFD, 0x7F, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xF0,
-    0xBC, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x07, 0xD1,
-    0xF4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFD, 0x3F, 0xCB, 0x06, 0x0F, 0xF2, 0xC0, 0x02, 0xFE, 0xF0, 0x00, 0x7F, 0xFD, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x2D, 0xFF, 0x00, 0x0B, 0x1F, 0xDE,
-    0x42, 0xCB, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x06, 0xFF, 0xE4, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x7D, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xC0, 0x03, 0xFA, 0xF8, 0x02, 0xF4, 0x00, 0x3F, 0x0F, 0xC0,
-    0x3F, 0x00, 0x03, 0xE0, 0xFC, 0x0B, 0xD0, 0x00, 0x3E, 0x0B, 0xC1, 0xF8, 0x00, 0x03, 0xE0, 0xFC,
-    0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC7, 0xE1, 0xFD, 0x02, 0xFA, 0xFC, 0xFC, 0xBF, 0xF8, 0x0F, 0xFF,
-    0x1F, 0x4F, 0xEF, 0xC0, 0x7F, 0xD3, 0xF1, 0xF4, 0x7E, 0x00, 0x00, 0xBD, 0x2F, 0x43, 0xE0, 0x00,
-    0x0F, 0xC2, 0xF4, 0x3F, 0x00, 0x02, 0xF4, 0x2F, 0x43, 0xF0, 0x00, 0x7E, 0x02, 0xF4, 0x7E, 0x00,
-    0x0F, 0xC0, 0x0F, 0xCF, 0xD0, 0x01, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-    0x1F, 0xD1, 0xFD, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF8,
-    0x02, 0xA8, 0x2F, 0xFF, 0xC0, 0x3F, 0x87, 0xFE, 0xFF, 0x0B, 0xF4, 0xFF, 0x47, 0xFC, 0xFF, 0x0F,
-    0xF0, 0x1F, 0xFF, 0xD0, 0xFF, 0x00, 0x7F, 0xF8, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xE4, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x1F, 0xC7, 0xF0, 0xFC, 0x3F, 0x0F, 0x82, 0x90, 0x02, 0xF4, 0x1F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F,
-    0x40, 0xFC, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4,
-    0x0B, 0xE0, 0x2F, 0xC0, 0x3F, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xD0, 0x3F,
-    0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02,
-    0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x0B, 0xD0, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF, 0x8F, 0xFF, 0xFF, 0xE1, 0x6B,
-    0xFE, 0x54, 0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7E, 0x0F, 0x80, 0x01,
-    0x01, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7E, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF1, 0xAA, 0xFE, 0xA8, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFD,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC,
-    0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00,
-    0x0B, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0xBF, 0x42, 0xFC, 0x03,
-    0xFC, 0x3F, 0xC0, 0x2F, 0xC3, 0xFC, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0xC0, 0x1F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC0, 0xFE, 0x07, 0xF8, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xFD, 0x02, 0xFF, 0xD0, 0xFF, 0xFD, 0x3F, 0xEF, 0xD3, 0xF1,
-    0xFD, 0x08, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD,
-    0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xD0, 0xBF,
-    0xC0, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x2F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF4,
-    0x0F, 0x40, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0xAB,
-    0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0x40, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xEF, 0xE0, 0x00, 0xFC, 0xFE,
-    0x00, 0x2F, 0x4F, 0xE0, 0x07, 0xE0, 0xFE, 0x00, 0xFC, 0x0F, 0xE0, 0x3F, 0x40, 0xFE, 0x07, 0xFA,
-    0xAF, 0xFA, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0xFF, 0x50, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xC0, 0xFE, 0x55, 0x50, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF5, 0x50, 0x01, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFC, 0x0B, 0xEB, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x3F, 0xC9, 0x00, 0x2F, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xF9, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x69,
-    0x00, 0x3F, 0x6F, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xF5, 0xBF, 0xC3, 0xFC, 0x02, 0xFD, 0x3F,
-    0x80, 0x0F, 0xD3, 0xF8, 0x00, 0xFD, 0x2F, 0xC0, 0x1F, 0xD1, 0xFE, 0x03, 0xFC, 0x0F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xD1, 0x55, 0x57, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F,
-    0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xEF, 0xF4, 0x2F, 0xD0, 0x3F, 0xC2, 0xFC, 0x02, 0xFC, 0x1F,
-    0xD0, 0x3F, 0x80, 0xFF, 0x4F, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0xFF, 0x6F, 0xF4, 0x2F, 0xC0, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x3F, 0x40, 0x0F, 0xD3, 0xFC,
-    0x02, 0xFD, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0,
-    0xBF, 0x83, 0xF8, 0x03, 0xFC, 0x3F, 0x40, 0x1F, 0xC3, 0xF4, 0x01, 0xFD, 0x3F, 0x80, 0x2F, 0xD3,
-    0xFD, 0x0B, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFD, 0xFC, 0x01, 0xBE, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xF0, 0x0E, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE2, 0xFE, 0xBF, 0x9F, 0xD0, 0x40, 0x0B, 0x81, 0xFE, 0x2F, 0xE0, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xD1, 0xFC, 0x2F, 0x83,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xF9,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x6F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF4, 0x0B, 0xFF, 0x90, 0x03,
-    0xFE, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0xBF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x39, 0x02, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0xBF, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xF9, 0x56, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x05, 0x40, 0xFD,
-    0x0B, 0xD0, 0x7F, 0xFF, 0x0F, 0x83, 0xF0, 0xBF, 0xFF, 0xC2, 0xF1, 0xF4, 0x7F, 0x03, 0xF0, 0x7C,
-    0xBC, 0x2F, 0x40, 0xFC, 0x1F, 0x7F, 0x0F, 0xC0, 0x3F, 0x07, 0xDF, 0xC3, 0xF0, 0x0F, 0xC2, 0xF3,
-    0xF0, 0xFC, 0x07, 0xF0, 0xFC, 0xBC, 0x2F, 0x83, 0xFC, 0x7E, 0x2F, 0x43, 0xFF, 0xFF, 0xFF, 0x03,
-    0xF0, 0x3F, 0xE1, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0x00, 0x01,
-    0xFF, 0x95, 0x6F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0xBF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x4F, 0xF0, 0x1F, 0xFC, 0xFF, 0x00,
-    0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0xBF, 0x8F, 0xFA, 0xBF, 0xE0, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xBF, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0x2F, 0xDF, 0xF0, 0x03,
-    0xFD, 0xFF, 0x00, 0xBF, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD,
-    0x02, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x24, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x3F, 0xD5, 0x7F, 0xF8, 0xFF, 0x00, 0x2F, 0xF3, 0xFC, 0x00, 0x3F,
-    0xDF, 0xF0, 0x00, 0x7F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFE, 0xFF, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0xBF, 0xCF, 0xF0,
-    0x1F, 0xFD, 0x3F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0,
-    0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x7F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40,
-    0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8,
-    0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00,
-    0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0xFF, 0xFD, 0x3F, 0xFE,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xBF, 0x4F, 0xF0, 0x0B, 0xF8,
-    0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x0F, 0xF2, 0xFE, 0x00, 0x3F,
-    0xDF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x3F, 0xD2,
-    0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x1F,
-    0xF0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xD0, 0x00, 0x0F, 0xFD, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0xFE, 0xFC, 0x00, 0xBD, 0xFD, 0xFE, 0xBD, 0x00,
-    0xFC, 0xFD, 0xFE, 0x7E, 0x00, 0xF8, 0xFD, 0xFE, 0x3F, 0x02, 0xF4, 0xFD, 0xFE, 0x3F, 0x43, 0xF0,
-    0xFD, 0xFE, 0x2F, 0x83, 0xE0, 0xFD, 0xFE, 0x0F, 0xCB, 0xD0, 0xFD, 0xFE, 0x0F, 0xCF, 0xC0, 0xFD,
-    0xFE, 0x0B, 0xEF, 0xC0, 0xFD, 0xFE, 0x07, 0xFF, 0x40, 0xFD, 0xFE, 0x03, 0xFF, 0x00, 0xFD, 0xFE,
-    0x02, 0xFF, 0x00, 0xFD, 0xFE, 0x01, 0xFD, 0x00, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFC, 0x00,
-    0x1F, 0xCF, 0xFF, 0x40, 0x07, 0xF3, 0xFF, 0xF0, 0x01, 0xFC, 0xFF, 0xFE, 0x00, 0x7F, 0x3F, 0x7F,
-    0xC0, 0x1F, 0xCF, 0xE7, 0xF8, 0x07, 0xF3, 0xF8, 0xFF, 0x41, 0xFC, 0xFE, 0x0F, 0xF0, 0x7F, 0x3F,
-    0x82, 0xFD, 0x1F, 0xCF, 0xE0, 0x3F, 0xC7, 0xF3, 0xF8, 0x07, 0xF8, 0xFC, 0xFE, 0x00, 0xFF, 0x7F,
-    0x3F, 0x80, 0x1F, 0xFF, 0xCF, 0xE0, 0x02, 0xFF, 0xF3, 0xF8, 0x00, 0x3F, 0xFC, 0xFE, 0x00, 0x0B,
-    0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4,
-    0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x80, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3, 0xFD, 0x5B, 0xFC, 0xFF, 0x00, 0xBF,
-    0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x07, 0xF7, 0xFC, 0x03, 0xFC, 0xFF, 0x5B, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0x43, 0xFE, 0xA9, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02,
-    0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x54, 0xBF, 0xFE, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xD0, 0xFF, 0x00, 0xBF, 0x83, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x07,
-    0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xC2, 0xFC, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-    0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F, 0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x2F, 0xD0, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x0B, 0xF0, 0x2F,
-    0xC0, 0x03, 0xFC, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0,
-    0x03, 0xF4, 0x0F, 0xD0, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0xFD,
-    0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC7, 0xF4, 0x01, 0xFF, 0x40, 0x0F, 0xE0, 0xFE, 0x00,
-    0xBF, 0xE0, 0x07, 0xF4, 0x3F, 0x80, 0x3F, 0xFC, 0x02, 0xFC, 0x0B, 0xF0, 0x0F, 0xEF, 0x40, 0xFF,
-    0x01, 0xFC, 0x07, 0xEB, 0xE0, 0x3F, 0x80, 0x3F, 0x42, 0xF9, 0xFC, 0x1F, 0xD0, 0x0F, 0xE0, 0xFD,
-    0x3F, 0x0B, 0xF0, 0x02, 0xFC, 0x3F, 0x0F, 0xD2, 0xFC, 0x00, 0x7F, 0x1F, 0xC2, 0xF8, 0xFE, 0x00,
-    0x0F, 0xDB, 0xE0, 0x7F, 0x3F, 0x40, 0x03, 0xFB, 0xF4, 0x0F, 0xDF, 0xC0, 0x00, 0xBE, 0xFC, 0x03,
-    0xFB, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x1F, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x01, 0xFF,
-    0x0B, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFD, 0x2F,
-    0xD0, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01,
-    0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x3F, 0xD0, 0x02, 0xFE, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F,
-    0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57, 0xFC, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xF9, 0xFF, 0xE7, 0xFA, 0x5F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01,
-    0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07,
-    0xF0, 0x1F, 0xE9, 0x7F, 0xF8, 0xFF, 0xE0, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF5, 0xFF, 0xE6,
-    0xBF, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80,
-    0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x8A, 0xFE, 0x7F,
-    0xF9, 0xFF, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xFB, 0xF0, 0x00, 0x2F, 0x1F, 0x80, 0x03, 0xE0, 0xFC, 0x00, 0xBD, 0x07, 0xE0, 0x0F,
-    0xC0, 0x3F, 0x01, 0xF4, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC2, 0x90, 0x00, 0x29, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0xBC, 0x01, 0xBF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F,
-    0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0xBF, 0x40, 0x3F, 0xBF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0x02,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x01, 0xFE, 0x3F,
-    0xC0, 0x2F, 0xD3, 0xFD, 0x03, 0xFC, 0x3F, 0xFF, 0xFF, 0x83, 0xFB, 0xFF, 0xF0, 0x3F, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60,
-    0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0xBF, 0x4F, 0xF0, 0xFF, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0x7F, 0xD1, 0xFF, 0xEF, 0xE0,
-    0x0F, 0xFB, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFB, 0xF4,
-    0x03, 0xFD, 0xFF, 0x01, 0xFF, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFB, 0xF0, 0x7F, 0xF0, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F,
-    0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10, 0xBF, 0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xFF, 0x40, 0xFF, 0xFC, 0x07, 0xF8,
-    0x00, 0x1F, 0xD0, 0x00, 0xBF, 0xE9, 0x1F, 0xFF, 0xF8, 0xBF, 0xFF, 0xE0, 0x2F, 0xD0, 0x00, 0x7F,
-    0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x02, 0xFD, 0x0A, 0x83, 0xFF, 0xFB,
-    0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0x42, 0xFF, 0xBF, 0x80, 0x3F, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xEF, 0xD0, 0x0F, 0xF7, 0xFC, 0x07, 0xFC, 0xFF, 0xEF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xCF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x34, 0x00,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xD0, 0x6F, 0xFF, 0x40, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0x80,
-    0x3F, 0xBF, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x7F, 0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0,
-    0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD0, 0x00, 0x0B,
-    0xD7, 0xFC, 0xFE, 0x1A, 0x00, 0x02, 0xA4, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xFF, 0x00, 0xFE, 0x00,
-    0x68, 0x00, 0x00, 0x00, 0xA9, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00,
-    0xFE, 0x00, 0xFE, 0x02, 0xFD, 0x7F, 0xFC, 0x7F, 0xF8, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x2A, 0x83, 0xF8, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0xC0, 0x3F, 0x83, 0xFD, 0x00, 0xFE, 0x3F, 0xD0,
-    0x03, 0xFA, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0xBF, 0x80, 0xFE, 0x00, 0xFF, 0x43, 0xF8,
-    0x00, 0xFF, 0x00, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0x2A, 0x0B, 0xF8, 0x06, 0xF9,
-    0x03, 0xF7, 0xFF, 0xF2, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x0B, 0xFF, 0x43,
-    0xFD, 0x3F, 0xC0, 0x3F, 0xE0, 0x1F, 0xE3, 0xFC, 0x02, 0xFD, 0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0,
-    0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC,
-    0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F,
-    0xC0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F,
-    0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00,
-    0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2,
-    0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0B,
-    0xF4, 0x03, 0xF7, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFE, 0x07, 0xFC, 0x3F, 0xC0, 0x2F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x1F, 0xE3, 0xFC, 0x02,
-    0xFD, 0x3F, 0xD0, 0x3F, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xF9, 0xFF, 0xC0, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x0A, 0x83, 0xFF, 0xFB, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0x42,
-    0xFF, 0xBF, 0x80, 0x3F, 0xEF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x00,
-    0x2F, 0xEF, 0xD0, 0x0F, 0xF7, 0xFC, 0x07, 0xFC, 0xFF, 0xEF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF,
-    0xCF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x2A, 0x07, 0xE3, 0xF2, 0xFE, 0x3F, 0xBF, 0xE3, 0xFF, 0xE9, 0x3F,
-    0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x06, 0xFE, 0x40, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0x3F, 0xC0, 0x14, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x7F,
-    0xF4, 0x00, 0x1F, 0xD4, 0x00, 0x3F, 0x7F, 0xAB, 0xFC, 0xFF, 0xFF, 0xE1, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x0A, 0xA2, 0xFD, 0x00, 0x3F,
-    0xC3, 0xF8, 0x01, 0xFD, 0x0F, 0xF0, 0x0B, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x00,
-    0xBF, 0x0B, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xF9, 0xFC, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6A, 0x00,
-    0x6A, 0x80, 0x1A, 0x87, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x3F, 0x80, 0xFF, 0xD0, 0x3F, 0x83, 0xFC,
-    0x0F, 0xFE, 0x07, 0xF0, 0x2F, 0xC1, 0xF7, 0xF0, 0xBF, 0x01, 0xFD, 0x2F, 0x2F, 0x0F, 0xE0, 0x0F,
-    0xE3, 0xF1, 0xF4, 0xFD, 0x00, 0xBF, 0x3E, 0x1F, 0x9F, 0xC0, 0x07, 0xF7, 0xD0, 0xFA, 0xFC, 0x00,
-    0x3F, 0xBC, 0x0F, 0xEF, 0x80, 0x03, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0x2F, 0xF8, 0x07, 0xFF, 0x00,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x6A, 0x80, 0x0A, 0xA0, 0xFF,
-    0x40, 0xFF, 0x40, 0xFF, 0x07, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0xBF, 0x8F, 0xF0, 0x03, 0xFC, 0x1F, 0xE0, 0x3F, 0xD0, 0x3F, 0xD2, 0xFE, 0x00, 0x3F, 0xC0,
-    0xAA, 0x00, 0x06, 0xA2, 0xFD, 0x00, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x0B, 0xF0, 0x0B, 0xF0, 0x1F,
-    0xD0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0xFD, 0x3F, 0x80, 0x02, 0xF9,
-    0xFC, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x1B, 0x80, 0x3F, 0xF0, 0x1F, 0xFC, 0x07, 0xF0, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x03, 0xF8, 0x17, 0xFD, 0x0B, 0xFD, 0x02, 0xFE, 0x40,
-    0x6F, 0xF4, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xC0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xF0, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x68,
-    0xF9, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFE, 0x40, 0x2F, 0xF4, 0x07, 0xFD, 0x0B, 0xFE, 0x43, 0xF8, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F,
-    0x80, 0x00, 0x2F, 0xE0, 0x01, 0x3F, 0xFF, 0xA6, 0xCF, 0xFF, 0xFF, 0xF3, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x1F, 0xEB, 0xF9, 0xFD, 0x15, 0x00, 0x01, 0x50, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFD, 0x7F, 0x5F, 0xD7, 0xF5, 0xFD, 0x7F, 0xAF, 0xE6, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x01, 0xBF, 0xF9, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x2F, 0xE0, 0x04,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x2F, 0xF0, 0x19, 0x0F, 0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0xE4, 0x00, 0x0F,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x2F, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xF8, 0x0B, 0xF4, 0x04, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0xAF, 0xFA, 0xA4, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x69, 0x3C, 0x7F, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xF8, 0x1F, 0x81, 0xF8, 0x2F, 0x00, 0xFC, 0x3F, 0x00, 0xBC, 0x2F, 0x40, 0xF8, 0x1F, 0xEB, 0xF4,
-    0x3F, 0xFF, 0xFC, 0x7E, 0xFF, 0xBD, 0x14, 0x00, 0x14, 0xBF, 0x00, 0x0B, 0xF1, 0xFE, 0x00, 0x3F,
-    0x42, 0xFC, 0x02, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF4, 0x00,
-    0x2F, 0x9F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x1B, 0xFF, 0xE8, 0x00, 0xBF,
-    0xFF, 0xF0, 0x01, 0x5F, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x5B, 0xF5, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x68, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x3F, 0xFF, 0xE7, 0xF4, 0x6C,
-    0xBE, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xF4, 0x3F, 0x7F, 0xD7, 0xD0, 0x7F, 0xBD,
-    0x03, 0xF7, 0xF4, 0x3F, 0x2F, 0xFB, 0xD0, 0x7F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0x00, 0x03,
-    0xFA, 0x40, 0xBE, 0xBF, 0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x7F, 0x87, 0xFB,
-    0xD1, 0xFC, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0B, 0xE9,
-    0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x69, 0x0B, 0xC0, 0xB4, 0x1F, 0xFF, 0x0B,
-    0x43, 0x81, 0xF4, 0x14, 0x0F, 0x1D, 0x0F, 0x40, 0x00, 0x2C, 0xB0, 0x3C, 0x00, 0x00, 0x77, 0xC1,
-    0xF0, 0x00, 0x00, 0xEF, 0x07, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x1D, 0x74, 0x3D, 0x00,
-    0x00, 0xB4, 0xE0, 0xBC, 0x00, 0x03, 0xC2, 0xC0, 0xBF, 0xF8, 0x2E, 0x03, 0xC0, 0x6F, 0x81, 0xF0,
-    0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x41, 0xFF, 0xF0, 0x10, 0x3D, 0x06, 0xAF, 0x4F, 0xFF,
-    0xD7, 0xD0, 0xF5, 0xF4, 0xBD, 0x3F, 0xFF, 0x42, 0xE0, 0x90, 0x00, 0x10, 0x01, 0x00, 0x01, 0xF4,
-    0x0F, 0x80, 0x0F, 0xE0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x40, 0xBF, 0x47, 0xF8,
-    0x03, 0xFC, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xF4, 0x3F, 0x80,
-    0x0B, 0xE0, 0x7F, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF1, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x0A, 0x94, 0x0B,
-    0xC0, 0xB4, 0x3F, 0xFD, 0x0B, 0x43, 0x80, 0xF1, 0xBC, 0x0F, 0x1D, 0x03, 0xC0, 0xF0, 0x2C, 0xB0,
-    0x0F, 0x03, 0xC0, 0x77, 0xC0, 0x3D, 0x7E, 0x00, 0xEF, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xDB,
-    0x80, 0x1D, 0x74, 0x0F, 0x0F, 0x40, 0xB4, 0xE0, 0x3C, 0x1F, 0x03, 0xC2, 0xC0, 0xF0, 0x3D, 0x2E,
-    0x03, 0xC2, 0x40, 0x25, 0xF0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xE2, 0xF4, 0xBD, 0xF8, 0x0F, 0xBD, 0x03,
-    0xEF, 0xC1, 0xF5, 0xFF, 0xFC, 0x1F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0x00, 0x50,
-    0x07, 0xFF, 0x43, 0xFF, 0xF0, 0x60, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
-    0x1F, 0xC0, 0x0F, 0xFF, 0xD7, 0xFF, 0xF8, 0xAA, 0xA9, 0x00, 0x50, 0x0B, 0xFF, 0x43, 0xFF, 0xF0,
-    0x50, 0x7D, 0x00, 0x1F, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x9E, 0x5B, 0xE7,
-    0xFF, 0xF0, 0x6F, 0x90, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xE0, 0x3F, 0x40, 0xBC, 0x00, 0x2A, 0x40,
-    0x0A, 0x93, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x02,
-    0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xEF, 0xD3, 0xFB, 0xFC, 0xBD, 0x3F,
-    0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xD7, 0xC7, 0xFF,
-    0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C,
-    0x7F, 0xFF, 0xC3, 0xC3, 0xFF, 0xFC, 0x3C, 0x2F, 0xFF, 0xC3, 0xC0, 0xBF, 0xFC, 0x3C, 0x00, 0x57,
-    0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0,
-    0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x0F, 0x00, 0x7F, 0x00,
-    0x3F, 0x00, 0xFC, 0xBF, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xCB, 0xFF, 0x2E, 0xFC,
-    0x13, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2A, 0x00, 0x00, 0x01, 0xFE,
-    0x02, 0xFF, 0xF0, 0xF8, 0x3E, 0x7D, 0x0B, 0xDF, 0x02, 0xF3, 0xD0, 0xBC, 0xFD, 0x7E, 0x1F, 0xFF,
-    0x00, 0xBE, 0x00, 0x01, 0x00, 0x10, 0x00, 0x7E, 0x07, 0xE0, 0x02, 0xFD, 0x1F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x00, 0xBF, 0x0B,
-    0xF4, 0x0B, 0xF4, 0x7F, 0x80, 0x7F, 0x83, 0xFC, 0x02, 0xF8, 0x1F, 0xC0, 0x00, 0x80, 0x08, 0x00,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFE, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x80, 0x0B, 0xD0, 0x00,
-    0xFB, 0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0xBC, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x01, 0xF8, 0x3F, 0x02, 0xFC, 0x00,
-    0x7E, 0x1F, 0x81, 0xFF, 0x00, 0x1F, 0x4F, 0xC0, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0xB7, 0xF0, 0x00,
-    0x03, 0xF0, 0x78, 0xFC, 0x00, 0x02, 0xF4, 0x3C, 0x3F, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBC, 0x0B, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFE, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0xFB,
-    0xE0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0xBC, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x1F, 0xE4, 0x01, 0xF8, 0x3F, 0x2F, 0xFF, 0x00, 0x7E,
-    0x1F, 0x87, 0xDF, 0xE0, 0x1F, 0x4F, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBC,
-    0x00, 0x7F, 0x55, 0x00, 0x7E, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0x40, 0xBF, 0xFC, 0x00, 0x3F, 0x00, 0x24, 0x7D, 0x00,
-    0xBD, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x0A, 0xF8, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x07, 0xE0,
-    0x00, 0x05, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x1F, 0x82, 0xF4, 0xD0, 0x7F, 0x3F, 0x07, 0xF4,
-    0xFF, 0xFD, 0xBD, 0x0F, 0xF4, 0x7F, 0xF4, 0xFC, 0x2E, 0xF4, 0x00, 0x02, 0xF4, 0x7E, 0xF4, 0x00,
-    0x03, 0xF0, 0xF2, 0xF4, 0x00, 0x0B, 0xC2, 0xD2, 0xF4, 0x00, 0x1F, 0x83, 0xFF, 0xFF, 0x00, 0x3F,
-    0x03, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xD0,
-    0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x14, 0x7F, 0xEA, 0xFC, 0x3F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03,
-    0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0,
-    0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9,
-    0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00,
-    0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE,
-    0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF,
-    0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00,
-    0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0xE0, 0x00, 0x0B,
-    0xFF, 0xBE, 0x00, 0x00, 0xFA, 0xFF, 0xC0, 0x00, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00,
-    0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95,
-    0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x38, 0x0B, 0x40, 0x00, 0x0B, 0xE1, 0xFC, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00,
-    0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00,
-    0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF,
-    0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF,
-    0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F,
-    0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFD, 0xBF, 0x95, 0x54, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0x00, 0x00,
-    0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0x01, 0xFF, 0xFF,
-    0xF0, 0x03, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xE5, 0x6F, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x7F, 0x40, 0x01, 0xFF, 0xFF, 0xF7, 0xFC,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x02, 0xD0, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x24, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xF4, 0x00, 0x7F, 0x40,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55,
-    0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xF8, 0x0B,
-    0xE3, 0xF4, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB,
-    0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x1E, 0x02, 0xD0, 0xFD, 0x2F, 0xC3, 0xF4,
-    0x7E, 0x01, 0x40, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0x3F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFE, 0x00,
-    0x0F, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x2F, 0xFF, 0x40, 0xFF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFF, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x40, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x01, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xFC, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x40, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x2D, 0x0B, 0x8B,
-    0xF0, 0xFC, 0x7E, 0x0F, 0xC1, 0x40, 0x10, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xFF,
-    0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x1F,
-    0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xD5, 0x7F, 0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x00, 0x07, 0xF8, 0x7F, 0xD5, 0x00, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xDF, 0xFF, 0xF4,
-    0x0F, 0xF7, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x43, 0xFC,
-    0x00, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2E, 0x02, 0xC0, 0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x2F, 0xBF, 0xF8,
-    0x00, 0x0B, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xCF, 0xFF, 0x00,
-    0x07, 0xF3, 0xFF, 0xD0, 0x01, 0xFC, 0xFF, 0xFC, 0x00, 0x7F, 0x3F, 0xFF, 0x80, 0x1F, 0xCF, 0xDF,
-    0xF0, 0x07, 0xF3, 0xF9, 0xFE, 0x01, 0xFC, 0xFE, 0x3F, 0xD0, 0x7F, 0x3F, 0x83, 0xFC, 0x1F, 0xCF,
-    0xE0, 0xBF, 0x47, 0xF3, 0xF8, 0x0F, 0xF1, 0xFC, 0xFE, 0x01, 0xFE, 0x3F, 0x3F, 0x80, 0x3F, 0xDF,
-    0xCF, 0xE0, 0x07, 0xFF, 0xF3, 0xF8, 0x00, 0xBF, 0xFC, 0xFE, 0x00, 0x0F, 0xFF, 0x3F, 0x80, 0x02,
-    0xFF, 0xCF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F,
-    0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40,
-    0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8,
-    0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00,
-    0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF,
-    0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B,
-    0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80,
-    0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00,
-    0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x07, 0xFF,
-    0xBF, 0x00, 0x00, 0xFE, 0xFF, 0xD0, 0x00, 0x0F, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07,
-    0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02,
-    0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x7F,
-    0x0F, 0xC0, 0x00, 0x01, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB,
-    0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x38, 0x3F, 0x40, 0xFD, 0x1F, 0xD3, 0xF8, 0x07, 0xFF, 0xE0,
-    0x01, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xD0, 0x0F, 0xE7, 0xF4, 0x3F, 0x81, 0xFD, 0x2E,
-    0x00, 0x7C, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x7F, 0xF8,
-    0x3F, 0xC0, 0x0F, 0xFF, 0xC7, 0xF8, 0x03, 0xF3, 0xFC, 0xBF, 0x80, 0x7D, 0x3F, 0xDB, 0xF4, 0x0F,
-    0x82, 0xFD, 0xBF, 0x42, 0xF0, 0x2F, 0xDB, 0xF4, 0x7D, 0x02, 0xFD, 0x7F, 0x8F, 0x80, 0x3F, 0xC3,
-    0xFE, 0xF0, 0x03, 0xFC, 0x3F, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xEF, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F,
-    0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F,
-    0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBE, 0x3F, 0x40, 0x07,
-    0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x2C, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xEB, 0xF4, 0x00, 0x7F, 0x9F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xCF, 0xF0, 0x1F, 0xF7, 0xFC,
-    0x01, 0xFD, 0xFF, 0x00, 0x7F, 0xBF, 0xC0, 0x1F, 0xEF, 0xF0, 0x0F, 0xF7, 0xFE, 0xAF, 0xFC, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xF5, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x1F, 0xF0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F, 0x80, 0x0F, 0xF0, 0x3F,
-    0x80, 0x7F, 0xC0, 0x3F, 0x81, 0xFF, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x3F,
-    0x83, 0xFF, 0x40, 0x3F, 0x81, 0xFF, 0xE0, 0x3F, 0x80, 0x2F, 0xFC, 0x3F, 0x80, 0x07, 0xFD, 0x3F,
-    0x80, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFE, 0x3F, 0x8B, 0x9B, 0xFD, 0x3F, 0x8B, 0xFF, 0xFC, 0x3F,
-    0x87, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x7F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xFA,
-    0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x01, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC,
-    0xFF, 0x00, 0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0x8B, 0xE0, 0x1F, 0x40,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4,
-    0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F,
-    0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1E, 0x02, 0xFF, 0xEF, 0x40, 0xFB, 0xFF, 0xC0,
-    0x74, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8,
-    0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF,
-    0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF, 0xDF,
-    0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x03, 0xF4, 0x7F, 0x00, 0xFD, 0x1F,
-    0xC0, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE,
-    0xFF, 0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF,
-    0xDF, 0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x2D,
-    0x2E, 0x00, 0x0B, 0x4B, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x90, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x56, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0xF3, 0xFD, 0x02, 0xFC, 0xFF, 0x00, 0xBF, 0x3F,
-    0xC0, 0x3F, 0xCF, 0xFE, 0xBF, 0xF1, 0xFF, 0xFD, 0xFC, 0x1F, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x7F, 0x90, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x14, 0x03, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x15, 0x7F, 0xD5, 0x5F, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0x40, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x1F, 0xFC, 0x00, 0x12, 0xFF, 0x6F, 0xFF, 0xEA, 0xBC, 0x7F,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x07, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18,
-    0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD,
-    0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F,
-    0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F,
-    0x8B, 0xE0, 0x1F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x03, 0xF4, 0x7F,
-    0x00, 0xFD, 0x1F, 0xC0, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFC, 0x3F, 0xC0, 0xBF, 0x5F, 0xD0, 0x0F, 0xEB, 0xF5, 0x57, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x2F, 0xFA,
-    0xAF, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0xBF, 0x40, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0F, 0xE0, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x1F, 0xC0,
-    0x3E, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xF8, 0x3E, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x2C, 0x0B, 0x4B, 0xE0, 0xFC, 0xBE, 0x0F, 0xC1, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xC0, 0x01, 0xFE,
-    0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xE0, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x02, 0xFF, 0xBF, 0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0xFA, 0xFF, 0xC7, 0xF8, 0x03,
-    0xFD, 0xBF, 0x00, 0x2F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFC, 0x7F,
-    0x80, 0x3F, 0xC3, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x0B, 0x00, 0x3F, 0xFE, 0xF0, 0x0B, 0xEF, 0xFE, 0x00, 0xB0, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x7F, 0x80, 0x3F, 0x3F, 0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x7F,
-    0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00,
-    0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2,
-    0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B,
-    0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF,
-    0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x7F, 0x1F, 0xC0, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0,
-    0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC,
-    0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x0F, 0x00, 0x7F, 0xFB, 0xE0, 0x0F, 0xEF, 0xFD, 0x00, 0xF0, 0x2E, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0,
-    0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB,
-    0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07, 0xFC, 0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xB8, 0x00, 0xBF, 0x0F, 0xC0, 0x07,
-    0xE0, 0xFC, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF, 0xF0,
-    0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07, 0xFC,
-    0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xA8, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0xE0,
-    0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD1, 0xFF, 0x8B, 0xF4, 0x2F, 0xFC, 0xBF, 0x07,
-    0xFF, 0xCF, 0xF0, 0xF9, 0xFD, 0xFF, 0x2F, 0x1F, 0xDF, 0xF7, 0xD2, 0xFD, 0xBF, 0xF8, 0x3F, 0xC7,
-    0xFF, 0x07, 0xF8, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF0, 0x00, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x3F, 0x4F, 0xC0, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01,
-    0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F,
-    0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x78, 0x00, 0x3F, 0x0F, 0xD0, 0x03, 0xF0, 0xFD, 0x00, 0x04, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xA4, 0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF,
-    0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x6A, 0x2F,
-    0xD0, 0x03, 0xFC, 0x3F, 0x80, 0x1F, 0xD0, 0xBF, 0x00, 0xBF, 0x01, 0xFD, 0x03, 0xF8, 0x03, 0xF8,
-    0x1F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x3F, 0xBF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0xC3, 0xFC, 0x02, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x00,
-    0xFE, 0x3F, 0x80, 0x0F, 0xE3, 0xF8, 0x01, 0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFE, 0x03, 0xFC, 0x3F,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0x3F, 0x9F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xD0, 0x78, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x10, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x00, 0x1A, 0x8B, 0xF4, 0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F,
-    0xC0, 0x7F, 0x40, 0xFE, 0x00, 0xFE, 0x07, 0xF4, 0x02, 0xFC, 0x2F, 0xC0, 0x03, 0xF4, 0xFE, 0x00,
-    0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x6A, 0xAA,
-    0x40, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0x06, 0xAA, 0xA4, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF,
-    0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F,
-    0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x40, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x05, 0x00, 0x04, 0x03, 0xD0, 0x0F,
-    0x40, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00,
-    0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xE8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xB8, 0x01, 0xBF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF,
-    0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x7E, 0x50, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4,
-    0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x2F, 0x8F, 0xD0, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0xD0,
-    0x0F, 0xD3, 0xF4, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9,
-    0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F,
-    0xE0, 0x60, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x07, 0xF3, 0xF8, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x3F, 0xF4, 0x0B, 0x42, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x90, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x0B, 0xF3, 0xF8, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F, 0xE0, 0x60, 0x7F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x7F, 0xC0, 0x18, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x2F, 0xDF, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFD, 0x57, 0xFF, 0x8F, 0xF0, 0x02, 0xFF, 0x3F, 0xC0, 0x03, 0xFD, 0xFF, 0x00, 0x07,
-    0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x1F, 0xEF, 0xF0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xFC, 0xFF, 0x01, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x00, 0xFF, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0xBC, 0x00, 0x00, 0x0F, 0xF3, 0xE0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0xFF, 0xFA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD1, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x03, 0xFC,
-    0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xBF, 0x00, 0x00,
-    0x7F, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xD5, 0x7F, 0xF8, 0x0F, 0xF0, 0x02, 0xFF, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x07, 0xF8, 0x7F, 0xD5, 0x00, 0xFF, 0x7F, 0xFF, 0xD0, 0x3F, 0xDF,
-    0xFF, 0xF4, 0x0F, 0xF7, 0xFF, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFE, 0x0F, 0xF0, 0x00, 0xFF,
-    0x43, 0xFC, 0x00, 0xBF, 0xC0, 0xFF, 0x01, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x15, 0x7F, 0xD4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xE2, 0xFC,
-    0x07, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0xC1, 0xFF, 0x42, 0xFF, 0x0B, 0xF8, 0x03, 0xFC, 0x3F,
-    0xD0, 0x0B, 0xF0, 0xFF, 0x40, 0x2F, 0xC3, 0xFD, 0x00, 0xBF, 0x0B, 0xF8, 0x03, 0xFC, 0x1F, 0xF0,
-    0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0xFF, 0x00, 0x7F, 0xE1, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0x90, 0xBF, 0xFF, 0x82, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x06, 0xAA,
-    0xA4, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10, 0xBF,
-    0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0xF4,
-    0x03, 0xD2, 0xFF, 0xFF, 0x03, 0xFF, 0xF4, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x05, 0x00,
-    0x04, 0x03, 0xD0, 0x0F, 0x40, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4,
-    0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF,
-    0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x00, 0x3D, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x50, 0x00, 0xFF, 0x80, 0x00, 0xB9, 0x00, 0xBF, 0x90, 0x02,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xD5, 0x5F, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x10,
-    0xBF, 0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x0B, 0xE1, 0xFD, 0xBE, 0x02, 0xFF, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x7F, 0x6F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0, 0x2F, 0xD7,
-    0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC,
-    0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC,
-    0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x1F,
-    0xFF, 0x00, 0x1F, 0xCB, 0xE0, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F,
-    0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF,
-    0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3,
-    0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00,
-    0x50, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF,
-    0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x04, 0x02, 0xE0, 0x0B, 0x80, 0x7F, 0xFF, 0xD0, 0x0B, 0xFF, 0xD0, 0x00, 0x6F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4,
-    0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0,
-    0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x00, 0x70, 0x2F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40,
-    0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0xA8, 0x3F, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00,
-    0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0,
-    0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFE, 0x00, 0x70, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0xBF, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0x7F,
-    0x80, 0x02, 0xFC, 0x3F, 0xC0, 0x02, 0xFC, 0x3F, 0xE0, 0x02, 0xFC, 0x1F, 0xF8, 0x02, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xA8, 0x3F, 0xFF, 0x7F, 0x3F, 0xFF, 0xFF,
-    0xCF, 0xF4, 0x2F, 0xFB, 0xF8, 0x03, 0xFE, 0xFC, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xF0, 0x02, 0xFE, 0xFD, 0x00, 0xFF, 0x7F, 0xC0, 0x7F, 0xCF, 0xFE, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF3, 0x40, 0x0F, 0xF8, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0xBE, 0x2F, 0x80, 0x07, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x57, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F,
-    0x2F, 0xC0, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD,
-    0x1F, 0xF4, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xD0, 0x0F,
-    0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xD0,
-    0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x5F, 0xF9, 0x55, 0x7F, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF5, 0x55, 0x7F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x5F, 0xF5, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F,
-    0xF4, 0x03, 0xFB, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xE0, 0x3F, 0xD0, 0xFF, 0x00, 0x7F,
-    0x83, 0xFC, 0x00, 0xFE, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0x83,
-    0xF8, 0x00, 0xFE, 0x0F, 0xE0, 0x03, 0xF8, 0x3F, 0x80, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0x80, 0x0B,
-    0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFE, 0x2C, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0xFF, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x07,
-    0xE0, 0x3C, 0x7F, 0xFB, 0xE3, 0xEB, 0xFF, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8,
-    0x00, 0x0F, 0xE0, 0x00, 0x2A, 0xAA, 0x9F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
-    0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x2A, 0xAA, 0x9F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-    0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x10,
-    0x00, 0x4B, 0x80, 0x2E, 0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0x40, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x03, 0xFC, 0x01, 0xFF, 0xF4, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x10, 0x00, 0x4B, 0x80, 0x2E,
-    0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
-    0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x02, 0xE0, 0x02, 0xF0, 0x00, 0xF4, 0x00, 0x3F, 0x50, 0x0F,
-    0xFC, 0x00, 0xBD, 0x00, 0x0B, 0xD7, 0xFC, 0xFE, 0x1A, 0x00, 0x02, 0xA4, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x2E, 0x1F, 0x0F, 0x83,
-    0xF6, 0xBF, 0xC6, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xA0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x2F, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x07, 0xFF, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0x2A, 0x4F, 0xE3, 0xF8, 0xFE, 0x3F,
-    0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE0, 0x3F, 0xFF, 0xC0, 0xBF,
-    0x0F, 0xFF, 0xF0, 0x2F, 0xC2, 0xFF, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00,
-    0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFC,
-    0x00, 0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFC, 0x03,
-    0xFC, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x7F, 0xFD, 0x02, 0xFC,
-    0x3F, 0xFF, 0xC0, 0xBF, 0x0F, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC7, 0xFC, 0x0B, 0xF4, 0xFE, 0x02, 0xFD, 0x1A,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x06, 0xA0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F,
-    0xE0, 0x2F, 0xC3, 0xF8, 0x0B, 0xF0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F, 0xE0, 0x2F, 0xC3,
-    0xF8, 0x0B, 0xF0, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0xBF, 0x0F, 0xE0, 0x2F, 0xC3, 0xF8, 0x0B, 0xF0,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xFC,
-    0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xC0,
-    0x0F, 0xD7, 0xF0, 0x2F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xFC, 0x07, 0xF2, 0xF8, 0x3E, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x0A, 0x90, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xD0,
-    0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xBF,
-    0x4F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x0F,
-    0xF2, 0xFE, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFE,
-    0xFF, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x2A, 0x83, 0xF8, 0x03, 0xFC, 0x0F, 0xE0, 0x3F,
-    0xC0, 0x3F, 0x83, 0xFD, 0x00, 0xFE, 0x3F, 0xD0, 0x03, 0xFA, 0xFD, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xE0, 0x7F, 0xC0, 0x3F,
-    0x80, 0xBF, 0x80, 0xFE, 0x00, 0xFF, 0x43, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x2A, 0x40, 0x0A, 0xA0, 0xFE, 0x00, 0xFF, 0x03, 0xF8, 0x0B, 0xF4, 0x0F, 0xE0, 0x7F, 0x40,
-    0x3F, 0x87, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0xFF, 0x4F, 0xF0, 0x03, 0xF8, 0x1F, 0xF0, 0x0F, 0xE0, 0x2F, 0xE0, 0x3F, 0x80,
-    0x3F, 0xD0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0xF4, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80,
-    0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x90, 0x00, 0x3F, 0x8F,
-    0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3,
-    0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0x00, 0x15, 0x4F, 0xE3, 0xF0, 0xF8, 0x28, 0x00, 0xBF, 0x00,
-    0xBE, 0xFF, 0x00, 0xFD, 0xFF, 0x00, 0xFC, 0xFF, 0x01, 0xF0, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0x8B, 0xF3, 0xF8, 0xBD, 0x3F, 0x8F, 0xC3, 0xF8, 0xF0, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xF0, 0xFF, 0x07, 0xF8, 0xFF,
-    0x07, 0xF4, 0xFF, 0x01, 0x90, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x9F,
-    0xC3, 0xFA, 0xFD, 0x3F, 0xAF, 0xD3, 0xF8, 0xA4, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x03, 0xFF, 0x40, 0xFF, 0xE0,
-    0xFF, 0xD0, 0xFF, 0xE0, 0x2F, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x07, 0xF3, 0xFF, 0xC0, 0x01, 0xFC, 0xFF, 0xF4, 0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x1F, 0xCF, 0xFF,
-    0xE0, 0x07, 0xF3, 0xF7, 0xFC, 0x01, 0xFC, 0xFE, 0x7F, 0x80, 0x7F, 0x3F, 0x8F, 0xF4, 0x1F, 0xCF,
-    0xE0, 0xFF, 0x07, 0xF3, 0xF8, 0x2F, 0xD1, 0xFC, 0xFE, 0x03, 0xFC, 0x7F, 0x3F, 0x80, 0x7F, 0x8F,
-    0xCF, 0xE0, 0x0F, 0xF7, 0xF3, 0xF8, 0x01, 0xFF, 0xFC, 0xFE, 0x00, 0x2F, 0xFF, 0x3F, 0x80, 0x03,
-    0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F,
-    0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFC, 0x00, 0x1F, 0xCF, 0xFF, 0x40, 0x07, 0xF3, 0xFF, 0xF0, 0x01,
-    0xFC, 0xFF, 0xFE, 0x00, 0x7F, 0x3F, 0x7F, 0xC0, 0x1F, 0xCF, 0xE7, 0xF8, 0x07, 0xF3, 0xF8, 0xFF,
-    0x41, 0xFC, 0xFE, 0x0F, 0xF0, 0x7F, 0x3F, 0x82, 0xFD, 0x1F, 0xCF, 0xE0, 0x3F, 0xC7, 0xF3, 0xF8,
-    0x07, 0xF8, 0xFC, 0xFE, 0x00, 0xFF, 0x7F, 0x3F, 0x80, 0x1F, 0xFF, 0xCF, 0xE0, 0x02, 0xFF, 0xF3,
-    0xF8, 0x00, 0x3F, 0xFC, 0xFE, 0x00, 0x0B, 0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0B, 0xE7, 0xF4, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x07, 0xF3, 0xFF, 0xC0, 0x01, 0xFC, 0xFF, 0xF4,
-    0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x1F, 0xCF, 0xFF, 0xE0, 0x07, 0xF3, 0xF7, 0xFC, 0x01, 0xFC, 0xFE,
-    0x7F, 0x80, 0x7F, 0x3F, 0x8F, 0xF4, 0x1F, 0xCF, 0xE0, 0xFF, 0x07, 0xF3, 0xF8, 0x2F, 0xD1, 0xFC,
-    0xFE, 0x03, 0xFC, 0x7F, 0x3F, 0x80, 0x7F, 0x8F, 0xCF, 0xE0, 0x0F, 0xF7, 0xF3, 0xF8, 0x01, 0xFF,
-    0xFC, 0xFE, 0x00, 0x2F, 0xFF, 0x3F, 0x80, 0x03, 0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x02, 0xFD, 0xFD, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x07, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0x47, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x4A, 0x81, 0xFE, 0x40,
-    0xFC, 0x3F, 0x7F, 0xFF, 0x41, 0x40, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x47, 0xFD, 0x00, 0x0F,
-    0xF0, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0xBF, 0xD0,
-    0x00, 0x7F, 0x3F, 0xFC, 0x00, 0x1F, 0xCF, 0xFF, 0x80, 0x07, 0xF3, 0xFF, 0xF4, 0x01, 0xFC, 0xFF,
-    0xFF, 0x00, 0x7F, 0x3F, 0x7F, 0xF0, 0x1F, 0xCF, 0xE3, 0xFE, 0x07, 0xF3, 0xF8, 0x7F, 0xC1, 0xFC,
-    0xFE, 0x0B, 0xFC, 0x7F, 0x3F, 0x80, 0xFF, 0x8F, 0xCF, 0xE0, 0x1F, 0xFB, 0xF3, 0xF8, 0x02, 0xFF,
-    0xFC, 0xFE, 0x00, 0x3F, 0xFF, 0x3F, 0x80, 0x07, 0xFF, 0xCF, 0xE0, 0x00, 0xBF, 0xF3, 0xF8, 0x00,
-    0x0F, 0xFC, 0xFE, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xEB, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x0B, 0xF8, 0x03, 0xF3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0x47, 0xFD, 0x3F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD,
-    0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80,
-    0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40,
-    0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB,
-    0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80,
-    0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB,
-    0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00,
-    0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F,
-    0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0xB8, 0x02, 0xE0, 0x07, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD,
-    0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0,
-    0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xE0, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF,
-    0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03,
-    0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xE0, 0x07, 0xF2, 0xFC, 0x00, 0xFC, 0x7E, 0x00, 0x2E,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0,
-    0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4,
-    0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xF8, 0x07, 0xFD, 0x55, 0x43, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xFC,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xDB, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFD, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0xD7, 0xF4, 0x00, 0x3F, 0xD5, 0x54, 0x7F, 0x80, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x40,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x1B, 0xF8, 0x00, 0x2F,
-    0xFF, 0xF7, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xF4, 0x2F, 0xFD, 0x03, 0xFC,
-    0xBF, 0x40, 0x3F, 0xE0, 0x07, 0xF2, 0xFC, 0x00, 0xBF, 0x95, 0x5F, 0xDF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFD, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0xFF,
-    0x80, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0x40, 0x01, 0x0B, 0xFF, 0xFF, 0xFF, 0xAA, 0xF8, 0x0F, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x80, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFC, 0x07, 0xFD, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F,
-    0x43, 0xFC, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFC, 0x2F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0x00, 0xFF, 0x03, 0xFC,
-    0x01, 0xFF, 0x0F, 0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x7E, 0x0F, 0xCB, 0xF8,
-    0x3F, 0xBF, 0xE0, 0xFF, 0xFA, 0x43, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0xFE, 0x80, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xD0,
-    0xFF, 0x00, 0xBF, 0x83, 0xFC, 0x01, 0xFE, 0x0F, 0xF0, 0x07, 0xF4, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0xFF, 0x03,
-    0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x3F,
-    0xD3, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2A, 0x07, 0xE3, 0xF2, 0xFE,
-    0x3F, 0xBF, 0xE3, 0xFF, 0xE9, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-    0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x02, 0xF4, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xFC,
-    0x07, 0xFD, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x43, 0xFC, 0x03,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x2F, 0xC0,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFF, 0x0F,
-    0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD2, 0xFC, 0xFE, 0x02,
-    0xFF, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x7E, 0x0F, 0xCB, 0xF8, 0x3F, 0xBF, 0xE0,
-    0xFF, 0xFA, 0x43, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBE, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03,
-    0xF8, 0x00, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x0F, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xF3, 0xFC, 0x01, 0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xFF, 0x80,
-    0x07, 0xFF, 0x40, 0x01, 0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xC0, 0x0F, 0xD7, 0xF0, 0x2E,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80,
-    0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80,
-    0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4,
-    0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF4, 0x0F, 0xD3, 0xF4, 0xBC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF, 0xF3, 0xFC, 0x01, 0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F,
-    0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x01, 0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F, 0xFF,
-    0x80, 0x00, 0xB8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0x03, 0xFF, 0x00,
-    0x03, 0xFD, 0x00, 0x06, 0xFE, 0x40, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x3F, 0xC0, 0x14, 0xFF, 0x40,
-    0x02, 0xFF, 0xD0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0xD4, 0x00,
-    0x3F, 0x7F, 0xAB, 0xFC, 0xFF, 0xFF, 0xE1, 0xFF, 0xFD, 0x00, 0x1F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFD,
-    0x0F, 0xE7, 0xF4, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x7F, 0x80, 0x68, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x02, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD2, 0xFC, 0xFE, 0x02, 0xFF, 0xE0,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x0F, 0xFF, 0xFC, 0xBF, 0xFF, 0xF3, 0xFC, 0x01,
-    0x4F, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0x40, 0x01,
-    0xFD, 0x40, 0x03, 0xF7, 0xFA, 0xBF, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF,
-    0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x02, 0xFF, 0x80,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x02, 0xFC, 0xFE, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x0A,
-    0x00, 0xBC, 0x00, 0xBC, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xEA, 0x80, 0x03, 0xFF, 0xFF,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x57, 0xFD, 0x50, 0x0B, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xC0, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xFA, 0x80, 0xFF, 0xFF, 0x43, 0xFF, 0xFD, 0x02,
-    0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x0E, 0x00, 0x2F, 0xFE, 0xF8, 0x00, 0xFA, 0xFF, 0xC0, 0x03, 0x80,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xEB, 0xF4, 0x00, 0x7F, 0x9F, 0xF4, 0x07, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B,
-    0x00, 0x3F, 0xFE, 0xF0, 0x0B, 0xEF, 0xFE, 0x00, 0xB0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xA4,
-    0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x3F, 0x80,
-    0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF, 0x8B, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xA9, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F, 0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x3F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F,
-    0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF,
-    0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x00, 0x0F, 0x00, 0x3D, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F, 0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x7C,
-    0x01, 0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3,
-    0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0x0F, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFE,
-    0xBF, 0x40, 0x07, 0xF9, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xF0,
-    0xF0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA4, 0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01,
-    0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFE, 0xFD, 0x07, 0xFF, 0x8B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x3F, 0x8F, 0xD0, 0x02,
-    0xF4, 0xBD, 0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xBF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xAF, 0xD0, 0x01, 0xFE, 0x7F,
-    0xD0, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x03, 0xF5, 0xFC, 0x00, 0xFC, 0x3F, 0x00,
-    0x1E, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7,
-    0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB,
-    0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F,
-    0xE7, 0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F,
-    0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8,
-    0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0x40,
-    0x1F, 0xF4, 0x00, 0xFE, 0x0F, 0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0x43, 0xF8, 0x03, 0xFF, 0xC0, 0x2F,
-    0xC0, 0xBF, 0x00, 0xFE, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x7E, 0xBE, 0x03, 0xF8, 0x03, 0xF4, 0x2F,
-    0x9F, 0xC1, 0xFD, 0x00, 0xFE, 0x0F, 0xD3, 0xF0, 0xBF, 0x00, 0x2F, 0xC3, 0xF0, 0xFD, 0x2F, 0xC0,
-    0x07, 0xF1, 0xFC, 0x2F, 0x8F, 0xE0, 0x00, 0xFD, 0xBE, 0x07, 0xF3, 0xF4, 0x00, 0x3F, 0xBF, 0x40,
-    0xFD, 0xFC, 0x00, 0x0B, 0xEF, 0xC0, 0x3F, 0xBF, 0x00, 0x01, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00,
-    0x3F, 0xF4, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0x6A, 0x80, 0x1A, 0x87, 0xF4, 0x0B, 0xFC, 0x03, 0xFC, 0x3F, 0x80,
-    0xFF, 0xD0, 0x3F, 0x83, 0xFC, 0x0F, 0xFE, 0x07, 0xF0, 0x2F, 0xC1, 0xF7, 0xF0, 0xBF, 0x01, 0xFD,
-    0x2F, 0x2F, 0x0F, 0xE0, 0x0F, 0xE3, 0xF1, 0xF4, 0xFD, 0x00, 0xBF, 0x3E, 0x1F, 0x9F, 0xC0, 0x07,
-    0xF7, 0xD0, 0xFA, 0xFC, 0x00, 0x3F, 0xBC, 0x0F, 0xEF, 0x80, 0x03, 0xFF, 0xC0, 0xBF, 0xF0, 0x00,
-    0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x0B,
-    0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x6A, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0x80,
-    0x1F, 0xD0, 0xBF, 0x00, 0xBF, 0x01, 0xFD, 0x03, 0xF8, 0x03, 0xF8, 0x1F, 0xD0, 0x0B, 0xF0, 0xBF,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xB4, 0x2E, 0x00, 0x02, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x50,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD,
-    0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x02, 0xF4, 0x02, 0xFC, 0xFE, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x0B, 0xF3, 0xF8, 0x02, 0xFF, 0xE0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0B,
-    0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF, 0xF4, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03,
-    0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8,
-    0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0xC0, 0x2F, 0xFF, 0xFF, 0x4F, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF8, 0x07, 0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x2F,
-    0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x7F,
-    0x80, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F,
-    0xE0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x0B, 0xF9, 0x07, 0xF4, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4,
-    0x2F, 0xF8, 0x07, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x1F, 0xD0, 0x3F,
-    0xC0, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0x80, 0x02,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xF9, 0x07, 0xFF,
-    0x80, 0xBF, 0xC3, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0xBF, 0x80, 0x3F, 0xC7,
-    0xFC, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0xCB, 0xF8, 0x00, 0x03,
-    0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0x03, 0xFC,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0xC3, 0xFC, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x3F, 0xE0, 0x00,
-    0xFF, 0x00, 0x3F, 0xC1, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x2F, 0xE0, 0x02, 0xFF, 0xFE, 0x7F, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0x47, 0xFF, 0x07, 0xFC, 0xBF, 0x40, 0x7F, 0x40, 0xBF, 0x6F, 0xC0,
-    0x0F, 0xE0, 0x1F, 0xDF, 0xF0, 0x03, 0xFC, 0x07, 0xF7, 0xFC, 0x00, 0xFF, 0x01, 0xFD, 0xFF, 0x00,
-    0x3F, 0xC0, 0x7F, 0x6F, 0xC0, 0x1F, 0xE0, 0x1F, 0xD7, 0xFC, 0x0F, 0xF4, 0x07, 0xF4, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFD, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0x40, 0xBF, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xA4, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF7, 0xFD, 0x5B, 0xFC, 0xFD,
-    0x3F, 0xC0, 0x2F, 0xD6, 0x93, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x03,
-    0xFD, 0x00, 0x3F, 0xEA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03,
-    0xFE, 0xA9, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x87, 0xF8, 0x03, 0xFA, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0x47,
-    0xFC, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFE, 0x3F, 0xC0, 0x0F, 0xF3, 0xFC, 0x00, 0xFF, 0x3F,
-    0xC0, 0x0F, 0xE3, 0xFC, 0x01, 0xFE, 0x3F, 0xE0, 0x3F, 0xD3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0x43, 0xF9, 0xFF, 0xD0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xF5, 0x40, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x83, 0xFC, 0x02, 0xFD, 0x0F, 0xF9,
-    0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0xBF, 0xC0, 0x0F, 0xF0, 0x7F,
-    0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x7F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFC, 0x2E, 0x42, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFE,
-    0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF4, 0x1F, 0xFF, 0x80, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x1E, 0x7F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x41, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x0A, 0x01, 0xFD, 0x00,
-    0x0B, 0xF4, 0x02, 0xFF, 0xC0, 0xBF, 0xFE, 0x0F, 0xFF, 0xD0, 0xBF, 0xE4, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x01, 0x3F, 0xFA, 0xBC, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0x05, 0x54, 0x0B, 0xF8, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x00, 0xF0, 0xFE, 0x00, 0x3D, 0x3F, 0x80, 0x0B, 0xFF, 0xF0,
-    0x00, 0x6B, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0xBF, 0xD0, 0x00, 0xA0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0xA8, 0x3F, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x07,
-    0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0xFD,
-    0x55, 0xFC, 0x0B, 0xF0, 0x02, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xFD, 0x01, 0xFF,
-    0xF4, 0x0B, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0xAA, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x2F,
-    0xD0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0xFE, 0x2F, 0xCF, 0xF0,
-    0x00, 0x3F, 0xCF, 0xE3, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xC0,
-    0x00, 0xFF, 0x90, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xA4, 0x00, 0xA9, 0x7F, 0x5F, 0xE0, 0x07, 0xFB, 0xFC,
-    0x7F, 0x80, 0x1F, 0xFF, 0xC1, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x1F, 0xE0,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x02, 0xFD,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x7F, 0x40, 0x7F,
-    0x40, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x03, 0xF1, 0xFC, 0x3E,
-    0x00, 0xF8, 0x0B, 0xD0, 0x74, 0xFF, 0xFB, 0xD7, 0xEF, 0xFF, 0x1D, 0x06, 0xE0, 0x2A, 0xAA, 0x83,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA,
-    0xA8, 0x10, 0x00, 0x51, 0xF0, 0x07, 0xC3, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x02, 0xF9, 0x00, 0x00,
-    0x02, 0xF8, 0x3F, 0xC3, 0xFC, 0x0A, 0x00, 0x2D, 0x07, 0x87, 0xF0, 0xFD, 0x7F, 0x0F, 0xC1, 0x40,
-    0x14, 0x6A, 0x41, 0xFF, 0x81, 0x7F, 0x00, 0xFC, 0x1F, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0xFF, 0xD3, 0x83, 0xCE, 0x0F, 0x3F, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE2, 0xF8,
-    0xFE, 0x1F, 0x87, 0xE0, 0xB4, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x0F, 0xE7, 0xF4,
-    0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x80, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x14, 0x14, 0x7C, 0x3D,
-    0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xD0, 0x0F, 0xC7,
-    0xF0, 0x03, 0xE1, 0xF8, 0x00, 0xF0, 0x7C, 0x00, 0x40, 0x00, 0x1F, 0x40, 0x12, 0xF4, 0x47, 0x8A,
-    0x2D, 0x3E, 0x5B, 0xC1, 0xFF, 0xF4, 0x06, 0xF8, 0x00, 0x00, 0x10, 0x00, 0xBF, 0xF0, 0x3F, 0xFF,
-    0xC7, 0xE5, 0x7E, 0xB4, 0x01, 0xE0, 0x07, 0xD0, 0xFC, 0x0F, 0xC2, 0xF8, 0x3F, 0x87, 0xF4, 0x15,
-    0x00, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F, 0x03, 0xE0, 0x14, 0x00, 0x7F, 0x03, 0xF4, 0x3F,
-    0x81, 0xFC, 0x0F, 0xC0, 0xBD, 0x01, 0x40, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F, 0x03, 0xE0,
-    0x14, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0x40, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0x80, 0x7D, 0x00, 0x00, 0x40, 0x1C, 0x2B, 0xC3, 0xFC, 0x01, 0xC0,
-    0x04, 0x10, 0x03, 0x40, 0x3E, 0x83, 0xFC, 0x34, 0x01, 0x00, 0xBF, 0xF9, 0xAA, 0xE0, 0x03, 0x80,
-    0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xF8, 0x1F, 0xD0, 0xFF, 0x0F, 0xF4, 0x7F, 0x40, 0x40, 0x00,
-    0x09, 0x3E, 0x78, 0xB4, 0x3D, 0x1D, 0x0A, 0x00, 0xF0, 0x1F, 0x4B, 0xFE, 0x00, 0x00, 0xBF, 0xE6,
-    0xF9, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x9B, 0xFE, 0x0F, 0x00, 0xA0, 0x15,
-    0x4B, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF6, 0xFF, 0xBF, 0xD7, 0xF4,
-    0x54, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xF9, 0x7F, 0xE1, 0xFD, 0x04, 0x1F, 0xDB, 0xF8,
-    0xFD, 0x04, 0x00, 0x2D, 0x07, 0x87, 0xF0, 0xFD, 0x7F, 0x0F, 0xC1, 0x40, 0x14, 0x0B, 0xD0, 0xFF,
-    0xD3, 0x83, 0xCE, 0x0F, 0x3F, 0xF4, 0x2F, 0x40, 0x05, 0x41, 0xFC, 0x2F, 0x43, 0xF0, 0x28, 0x00,
-    0x1E, 0x02, 0xF8, 0x07, 0xE0, 0x3F, 0xFF, 0xDB, 0xF4, 0x01, 0x00, 0xF4, 0x3D, 0x07, 0xC0, 0x7E,
-    0x53, 0xFE, 0x0B, 0x90, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x7F, 0xFF, 0xD7, 0xEA, 0xBD, 0x70,
-    0x00, 0xD7, 0x00, 0x0D, 0x10, 0x00, 0x40, 0x50, 0x50, 0x5B, 0x0F, 0x0E, 0x3F, 0xFF, 0xC0, 0x50,
-    0x50, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xD2, 0xF9, 0xFD, 0x03, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xFC, 0x03, 0xF5, 0xFC, 0x2E, 0x00, 0xF8, 0x10, 0x00, 0x4B,
-    0x80, 0x2E, 0x7F, 0xFF, 0xD2, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x10, 0x00, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xC7, 0xE5, 0x7E, 0xB4, 0x01, 0xE0, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xFC, 0x3F, 0xBF, 0xF4,
-    0x3C, 0x0B, 0x90, 0x2A, 0xAA, 0x83, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xAA,
-    0xAA, 0x90, 0x0B, 0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFE, 0x2C, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x1F, 0xF8, 0x03, 0xFC, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x60, 0xBC, 0x2D, 0x1D, 0x7C, 0x74, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x70, 0x00, 0xD7, 0xFF, 0xFD,
-    0x15, 0x55, 0x40, 0x15, 0x55, 0x4B, 0xFF, 0xFE, 0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA, 0xAA, 0xEA,
-    0xAA, 0xAA, 0x05, 0x05, 0x03, 0xFF, 0xFC, 0xB0, 0xF0, 0xE5, 0x05, 0x05, 0x00, 0x07, 0x5D, 0x2F,
-    0x81, 0xF4, 0x7A, 0xD1, 0x04, 0x09, 0x7D, 0xB0, 0x38, 0x2D, 0x0E, 0x7C, 0x50, 0x55, 0x55, 0x53,
-    0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0x90, 0x00, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x2F, 0xC0,
-    0x7E, 0x00, 0x1F, 0x80, 0xB0, 0xFF, 0xFB, 0xCB, 0xEF, 0xFD, 0x3C, 0x07, 0xD0, 0x15, 0x1F, 0xD1,
-    0xF8, 0x3D, 0x0E, 0x00, 0x00, 0x00, 0x05, 0x50, 0x01, 0xE1, 0xFE, 0x28, 0x3F, 0x1F, 0xCB, 0xE3,
-    0xF2, 0xF4, 0xBE, 0x04, 0x3E, 0x01, 0x40, 0xA8, 0x3F, 0x0F, 0xD3, 0xFD, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFD, 0x79, 0x55, 0x6D, 0x70, 0x00, 0x0D, 0x70, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x53, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA,
-    0x90, 0x14, 0x14, 0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x7C, 0x3D, 0x00, 0x00, 0x2A, 0x87, 0xFD,
-    0x01, 0xD0, 0x1D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x13, 0x84, 0x2F, 0xF5, 0xD7, 0xAF, 0xFC, 0x72,
-    0xEE, 0x00, 0x14, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x55, 0x09, 0x3F, 0xE6,
-    0xD7, 0xFF, 0xFC, 0xB0, 0x2F, 0x40, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x82, 0xFF, 0x7C, 0x39, 0xBF, 0x81, 0x00, 0x40, 0x1F, 0xD1, 0xD3, 0xFF, 0xFC, 0x34,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x1F, 0xAF, 0x43, 0xFF, 0xFC, 0x0A, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x90,
-    0x1A, 0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05, 0x40,
-    0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2, 0x00,
-    0x00, 0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01, 0x80,
-    0x00, 0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x20, 0x0F, 0x80, 0x7C, 0x7F,
-    0x38, 0x00, 0x00, 0x00, 0x1E, 0x3E, 0x78, 0x3C, 0x2E, 0x05, 0x00, 0x50, 0x00, 0xBF, 0xE0, 0x2F,
-    0xFF, 0x83, 0xC0, 0x3C, 0x75, 0xF5, 0xD0, 0x2F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x5C, 0x2F,
-    0xC1, 0xF4, 0x3E, 0xC0, 0x04, 0x01, 0xCB, 0xE3, 0xD0, 0xBE, 0x01, 0xC0, 0x34, 0x0B, 0xD0, 0x7C,
-    0xBE, 0x34, 0x00, 0xA0, 0x06, 0x07, 0xE0, 0xF8, 0x0F, 0x8E, 0xC7, 0xE2, 0xCD, 0xA0, 0x34, 0xA0,
-    0x00, 0x78, 0x3E, 0x0F, 0x2E, 0x7C, 0x20, 0x00, 0x0F, 0xCB, 0xF6, 0xFD, 0x19, 0x00, 0x00, 0x00,
-    0xF0, 0x7F, 0xD6, 0xF9, 0x2F, 0x81, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0xB0, 0xF0, 0xEE, 0x0A,
-    0x0B, 0xB5, 0xF5, 0xE2, 0xF5, 0xF8, 0x14, 0x03, 0x40, 0x3F, 0xC1, 0x6C, 0x02, 0x80, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0F, 0xFE, 0x96, 0xBF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00,
-    0x02, 0xFC, 0x0F, 0xFE, 0x96, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA,
-    0xA9, 0x0B, 0xFF, 0x94, 0x00, 0x1F, 0x3F, 0xFF, 0xFF, 0xFA, 0xFE, 0xBE, 0x6A, 0xFF, 0xFF, 0xFC,
-    0xB0, 0x00, 0x05, 0xAF, 0x90, 0x00, 0x06, 0xFF, 0xA4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xAA, 0xFF, 0xF0, 0x3F, 0x90, 0x00, 0x07, 0xFC, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x06, 0xAA, 0xAA,
-    0xAA, 0xAF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x02, 0xFD, 0x00, 0xF2, 0xFF, 0xB4, 0xFB, 0xAF, 0x19, 0x10, 0x00, 0x00,
-    0xBF, 0x47, 0x4B, 0x2F, 0xFC, 0x74, 0x00, 0xFA, 0x80, 0x69, 0x00, 0x02, 0xC1, 0x2C, 0xB2, 0xCB,
-    0x2C, 0x60, 0x00, 0x00, 0xBF, 0x07, 0x4F, 0x2C, 0x2C, 0xB0, 0xB0, 0xFB, 0x80, 0xA4, 0x00, 0xB0,
-    0xB2, 0xC2, 0xCB, 0x0B, 0x2C, 0x3C, 0x7E, 0xF0, 0x64, 0x80, 0x00, 0x00, 0xFE, 0x3D, 0x03, 0x80,
-    0x38, 0x02, 0xEA, 0x06, 0x80, 0x00, 0x00, 0x0B, 0x00, 0xB3, 0xFF, 0xB4, 0xFF, 0x0B, 0xB0, 0xB7,
-    0xEF, 0x19, 0x20, 0x00, 0x02, 0xC0, 0x0B, 0x00, 0x2E, 0xF8, 0xB8, 0xF2, 0xC2, 0xCB, 0x0B, 0x2C,
-    0x2C, 0x60, 0x60, 0x00, 0x00, 0x07, 0xBE, 0xBD, 0x78, 0xF8, 0xF7, 0x4B, 0x0F, 0x74, 0xB0, 0xF7,
-    0x4B, 0x0F, 0x20, 0x60, 0x50, 0x00, 0x1D, 0xE7, 0xD1, 0xD0, 0x74, 0x1D, 0x02, 0x00, 0x00, 0x0A,
-    0x0B, 0xF4, 0xE0, 0x38, 0x0E, 0x03, 0xE4, 0x28, 0xB0, 0x75, 0xD3, 0xC3, 0x8D, 0x07, 0xB0, 0x0F,
-    0x80, 0x18, 0x00, 0x2D, 0x3C, 0x0F, 0xB0, 0x03, 0xE0, 0x0B, 0xF0, 0x1E, 0x38, 0x14, 0x18, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0,
-    0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F,
-    0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0,
-    0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC,
-    0xBF, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x4F, 0xF0, 0x1F, 0xFC, 0xFF, 0x00,
-    0x3F, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0xBF, 0x8F, 0xFA, 0xBF, 0xE0, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xF0, 0xFF, 0x01, 0xBF, 0xCF, 0xF0, 0x03, 0xFC, 0xFF, 0x00, 0x2F, 0xDF, 0xF0, 0x03,
-    0xFD, 0xFF, 0x00, 0xBF, 0xCF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x40, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x54, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0xBF, 0x3F,
-    0x40, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x1F, 0xD2, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x03, 0xF8,
-    0x0F, 0xF0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x0F, 0xF0, 0x1F,
-    0xD0, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x7F, 0x83, 0xFC, 0x00, 0x0F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE1, 0x55, 0x57, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xE0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x03, 0xFB, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0x7F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00,
-    0x03, 0xFC, 0xBF, 0x8A, 0xAA, 0x3F, 0xDB, 0xF4, 0xFF, 0xF2, 0xFD, 0xBF, 0x4F, 0xFF, 0x2F, 0xDB,
-    0xF4, 0x55, 0x52, 0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00,
-    0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF,
-    0xF0, 0xBF, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0xBF, 0x4F, 0xF0, 0x0B, 0xF8, 0x3F, 0xC0, 0x7F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x03, 0xFC, 0x3F, 0xD0, 0x0F, 0xF2, 0xFE, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0xFF, 0x03,
-    0xFC, 0x03, 0xFC, 0x0B, 0xFC, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x1F, 0xF0, 0xFF, 0x00, 0x2F,
-    0xE3, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x3F, 0x8F, 0xD0, 0x00, 0x0F,
-    0xD2, 0xFC, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0xFE, 0x03, 0xFC, 0x00,
-    0xBF, 0x40, 0xBF, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xE0, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0xBF,
-    0x03, 0xFC, 0x00, 0x1F, 0xE0, 0xFF, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0xFF, 0x3F, 0xD0, 0x00,
-    0x2F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xFD, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFD, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0xFE, 0xFC, 0x00, 0xBD, 0xFD,
-    0xFE, 0xBD, 0x00, 0xFC, 0xFD, 0xFE, 0x7E, 0x00, 0xF8, 0xFD, 0xFE, 0x3F, 0x02, 0xF4, 0xFD, 0xFE,
-    0x3F, 0x43, 0xF0, 0xFD, 0xFE, 0x2F, 0x83, 0xE0, 0xFD, 0xFE, 0x0F, 0xCB, 0xD0, 0xFD, 0xFE, 0x0F,
-    0xCF, 0xC0, 0xFD, 0xFE, 0x0B, 0xEF, 0xC0, 0xFD, 0xFE, 0x07, 0xFF, 0x40, 0xFD, 0xFE, 0x03, 0xFF,
-    0x00, 0xFD, 0xFE, 0x02, 0xFF, 0x00, 0xFD, 0xFE, 0x01, 0xFD, 0x00, 0xFD, 0xBF, 0xC0, 0x00, 0x7F,
-    0x3F, 0xFC, 0x00, 0x1F, 0xCF, 0xFF, 0x40, 0x07, 0xF3, 0xFF, 0xF0, 0x01, 0xFC, 0xFF, 0xFE, 0x00,
-    0x7F, 0x3F, 0x7F, 0xC0, 0x1F, 0xCF, 0xE7, 0xF8, 0x07, 0xF3, 0xF8, 0xFF, 0x41, 0xFC, 0xFE, 0x0F,
-    0xF0, 0x7F, 0x3F, 0x82, 0xFD, 0x1F, 0xCF, 0xE0, 0x3F, 0xC7, 0xF3, 0xF8, 0x07, 0xF8, 0xFC, 0xFE,
-    0x00, 0xFF, 0x7F, 0x3F, 0x80, 0x1F, 0xFF, 0xCF, 0xE0, 0x02, 0xFF, 0xF3, 0xF8, 0x00, 0x3F, 0xFC,
-    0xFE, 0x00, 0x0B, 0xFF, 0x3F, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0x81, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x05, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F,
-    0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xBF, 0xD5, 0x55,
-    0xFE, 0xFF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFE,
-    0xFF, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFE, 0xFF,
-    0x00, 0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x3F, 0xBF, 0xC0, 0x00, 0xFE, 0xFF, 0x00,
-    0x03, 0xFB, 0xFC, 0x00, 0x0F, 0xE0, 0xBF, 0xFE, 0x80, 0x3F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE3,
-    0xFD, 0x5B, 0xFC, 0xFF, 0x00, 0xBF, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x07, 0xF7, 0xFC, 0x03, 0xFC,
-    0xFF, 0x5B, 0xFF, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0x43, 0xFE, 0xA9, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0x05, 0x54, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x55, 0x00, 0x2F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0xBF,
-    0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B,
-    0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xF4, 0x2F, 0xC0, 0xFF, 0x8B, 0xF4, 0x0B, 0xF0, 0x0F, 0xF3, 0xFC, 0x02, 0xFC, 0x01,
-    0xFD, 0xFF, 0x00, 0xBF, 0x00, 0x7F, 0x7F, 0xC0, 0x2F, 0xC0, 0x1F, 0xDB, 0xF0, 0x0B, 0xF0, 0x0B,
-    0xF5, 0xFE, 0x02, 0xFC, 0x03, 0xFC, 0x3F, 0xF5, 0xBF, 0x5B, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x0B,
-    0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x3F, 0xC0, 0x03, 0xFD, 0x2F, 0xD0,
-    0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0xFE,
-    0x3F, 0xC0, 0x00, 0xFF, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0xFF, 0x40, 0x7F, 0xC0, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x02, 0xFE, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0xBE, 0x02, 0xF8, 0x0B, 0xEF, 0xE0, 0x2F, 0x80,
-    0xBF, 0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0, 0x2F, 0x80, 0xBF, 0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0,
-    0x2F, 0x80, 0xBF, 0xFE, 0x02, 0xF8, 0x0B, 0xFF, 0xE0, 0x2F, 0x80, 0xFF, 0xBF, 0x02, 0xF8, 0x0F,
-    0xE7, 0xF8, 0x2F, 0x82, 0xFD, 0x3F, 0xFB, 0xFE, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0x7F, 0xD4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF,
-    0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x0B, 0xF0, 0x00,
-    0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x3F, 0xFF, 0x07, 0xFF, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xFF,
-    0xF0, 0x7F, 0xFF, 0x00, 0x02, 0xFD, 0x0A, 0x80, 0x3F, 0xFF, 0x7F, 0x03, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xF4, 0x2F, 0xF0, 0xBF, 0x80, 0x3F, 0xC2, 0xFC, 0x00, 0xBF, 0x0F, 0xF0, 0x02, 0xFC, 0x3F, 0xC0,
-    0x0B, 0xF0, 0xFF, 0x00, 0x2F, 0xC2, 0xFD, 0x00, 0xFF, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xFE, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xDF, 0xF8, 0x1F, 0xFC, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x40, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0xBF, 0x43, 0xF8,
-    0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x83, 0xF8, 0x07, 0xF0, 0x3F, 0x85, 0xFE, 0x03, 0xF8, 0xFF, 0x40,
-    0x3F, 0x8F, 0xF9, 0x03, 0xF8, 0xAF, 0xF4, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x01, 0xFD, 0x3F, 0x80,
-    0x0F, 0xE3, 0xF8, 0x01, 0xFE, 0x3F, 0xC0, 0x3F, 0xD3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x43,
-    0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xAA, 0x00, 0x1A, 0x8B, 0xF0, 0x01, 0xFD, 0x3F,
-    0x80, 0x1F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x2F, 0xC0, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
-    0x80, 0x7F, 0x07, 0xF4, 0x03, 0xF4, 0xBF, 0x00, 0x2F, 0x8F, 0xD0, 0x01, 0xFE, 0xFC, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0xFF, 0xAB, 0xF0, 0x03, 0xF8, 0x02,
-    0x80, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0x8B, 0xFC, 0x07, 0xF4, 0x07, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0xFE,
-    0x00, 0x2F, 0xC3, 0xF8, 0x00, 0xBF, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x2F, 0xE0, 0x7F, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4,
-    0x0B, 0xFF, 0xFE, 0x0F, 0xFF, 0xFD, 0x1F, 0xD0, 0x18, 0x1F, 0xC0, 0x00, 0x0F, 0xE5, 0x40, 0x02,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xC0, 0x2F, 0xE5, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFA,
-    0xBD, 0x1F, 0xFF, 0xFD, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFC, 0x00, 0x1B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x0B, 0xF8, 0x03, 0xF3, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0x07, 0xFC, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F,
-    0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xBF, 0xE0, 0x3F, 0xC0, 0xBF, 0x03, 0xF4, 0x03, 0xF8,
-    0x7F, 0x00, 0x3F, 0xCB, 0xF0, 0x02, 0xFC, 0xBF, 0x00, 0x2F, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xBF, 0x00, 0x2F, 0xCB, 0xF0, 0x02, 0xFC, 0x7F, 0x00, 0x3F, 0xC3,
-    0xF4, 0x03, 0xF8, 0x3F, 0xC0, 0x7F, 0x41, 0xFF, 0x6F, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-    0x0F, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xFC, 0x00, 0xFF, 0xFC,
-    0x1F, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0xA0, 0xFE, 0x00, 0xFF, 0x03, 0xF8,
-    0x0B, 0xF4, 0x0F, 0xE0, 0x7F, 0x40, 0x3F, 0x87, 0xF8, 0x00, 0xFE, 0x3F, 0x80, 0x03, 0xFB, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0x4F, 0xF0, 0x03, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xE0, 0x2F, 0xE0, 0x3F, 0x80, 0x3F, 0xD0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x07, 0xF2, 0xFC, 0x00, 0x2F, 0xC7, 0xF4,
-    0x00, 0xFE, 0x0F, 0xE0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 0xD7,
-    0xF8, 0x02, 0xFF, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x1A, 0x80, 0x3F,
-    0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F,
-    0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0x80, 0x2F, 0xD0, 0x3F,
-    0x80, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xEF, 0xFC, 0x3F,
-    0xBF, 0xC3, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x1A, 0x8B, 0xF0,
-    0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x2F, 0xC0, 0xFD, 0x03, 0xFC,
-    0x0F, 0xF0, 0x3F, 0x80, 0x7F, 0x07, 0xF4, 0x03, 0xF4, 0xBF, 0x00, 0x2F, 0x8F, 0xD0, 0x01, 0xFE,
-    0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFD, 0x3B, 0xFF, 0xA8, 0x0B, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xF5, 0x50, 0x0B, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x2F, 0xFA, 0xA4, 0x7F, 0x80, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0x80, 0x1F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF,
-    0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF,
-    0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA,
-    0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xD0, 0x3F, 0xC0, 0x02, 0xFC,
-    0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x2F, 0xC0,
-    0x2F, 0xFE, 0x02, 0xFC, 0x01, 0xFF, 0xF0, 0x2F, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x3F, 0x80,
-    0x3F, 0xC7, 0xF4, 0x02, 0xFC, 0xBF, 0x40, 0x2F, 0xCB, 0xF4, 0x02, 0xFC, 0xBF, 0x40, 0x2F, 0xCB,
-    0xF4, 0x03, 0xFC, 0xBF, 0x80, 0x7F, 0x8B, 0xFF, 0xAF, 0xF4, 0xBF, 0xFF, 0xFE, 0x0B, 0xF7, 0xFF,
-    0x40, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x3F,
-    0xD0, 0x60, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xFE, 0x40, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x1F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0x4F, 0xF8, 0x2F,
-    0x80, 0x7F, 0x80, 0x3F, 0x42, 0xFC, 0x00, 0xFE, 0x0F, 0xF0, 0x02, 0xFC, 0x3F, 0xC0, 0x0B, 0xF0,
-    0xFF, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x0B, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x5F, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFF, 0xB8, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x2A, 0x43,
-    0xF8, 0x03, 0xFC, 0x3F, 0x80, 0x2F, 0xC3, 0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01,
-    0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFC, 0x3F,
-    0xC0, 0x7F, 0xC2, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xE2, 0xFC, 0xBF, 0xC1, 0xFF, 0x0B, 0xF0, 0x7F,
-    0x8B, 0xF0, 0x2F, 0xC0, 0xFF, 0x3F, 0xC0, 0xBF, 0x02, 0xFC, 0xFF, 0x02, 0xFC, 0x0B, 0xF2, 0xFC,
-    0x0B, 0xF0, 0x3F, 0xC7, 0xF8, 0x2F, 0xC0, 0xFF, 0x0F, 0xF4, 0xBF, 0x0F, 0xF4, 0x1F, 0xFF, 0xFE,
-    0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xA9, 0xFF, 0xC0, 0x02, 0xFC,
-    0xFF, 0xF0, 0x03, 0xF4, 0x5B, 0xF4, 0x0B, 0xF0, 0x03, 0xFC, 0x1F, 0xD0, 0x01, 0xFD, 0x3F, 0x80,
-    0x00, 0xFF, 0x7F, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x01, 0xFC, 0xFF, 0x00, 0x03, 0xF8, 0x7F, 0x80, 0x0B, 0xF0, 0x3F, 0xD0, 0x0F, 0xD0, 0x0F, 0xFE,
-    0x3F, 0xC0, 0x0B, 0xFE, 0x7F, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0xA8, 0x07, 0xF0, 0x2A, 0x07, 0xF4, 0x1F, 0xC0, 0xFE, 0x1F, 0xD0, 0x7F,
-    0x03, 0xFC, 0x7F, 0x41, 0xFC, 0x0B, 0xF1, 0xFD, 0x07, 0xF0, 0x2F, 0xC7, 0xF4, 0x1F, 0xC0, 0x7F,
-    0x1F, 0xD0, 0x7F, 0x01, 0xFC, 0x3F, 0x41, 0xFC, 0x07, 0xF0, 0xFD, 0x07, 0xF0, 0x2F, 0xC3, 0xF8,
-    0x1F, 0xC0, 0xFF, 0x0F, 0xF4, 0x7F, 0x0B, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x0A, 0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x2F, 0x80, 0x00,
-    0x03, 0xF4, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x54, 0x01, 0xFC, 0xBF, 0x00, 0xFE, 0x00,
-    0xFC, 0xBF, 0x00, 0xFE, 0x00, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFC,
-    0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x3F, 0x81, 0xFF, 0x03, 0xFC, 0x2F, 0xFB, 0xFF, 0xEF, 0xF4, 0x0F,
-    0xFF, 0xDB, 0xFF, 0xE0, 0x02, 0xFF, 0x42, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00,
-    0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0,
-    0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00,
-    0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x07, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF, 0xAF,
-    0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xBD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0xAA, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x05, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x90, 0x0F, 0xF0,
-    0x00, 0x02, 0xFC, 0x00, 0x56, 0xFF, 0x03, 0xFF, 0xFF, 0xC3, 0xFF, 0xEF, 0xF3, 0xFD, 0x02, 0xFC,
-    0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCF, 0xFE, 0xBF, 0xF1, 0xFF, 0xFD, 0xFC, 0x1F, 0xFD, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFC,
-    0x7C, 0x00, 0x01, 0xFF, 0xE5, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x0A, 0x40, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F,
-    0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4,
-    0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC,
-    0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xF8, 0xBC,
-    0x00, 0xBF, 0xF5, 0x40, 0x07, 0xE2, 0xF0, 0x00, 0x3D, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF4, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x90, 0x0F, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x56, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xF0, 0x3F, 0xD0, 0x2F,
-    0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xFE, 0xBF, 0xF0, 0x1F, 0xFF, 0xDF, 0xC0,
-    0x1F, 0xFD, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0x8B, 0xFC, 0x00, 0x00, 0x15, 0xFF, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x0A,
-    0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF,
-    0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00,
-    0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47,
-    0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF4, 0xBF, 0x80, 0x00, 0x57, 0xFF, 0x40, 0x00, 0x3E, 0x2F, 0x40, 0x03, 0xD0, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x09,
-    0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x05, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE,
-    0xFF, 0x03, 0xFD, 0x02, 0xFC, 0x0F, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFF, 0xEB, 0xFF,
-    0x01, 0xFF, 0xFD, 0xFC, 0x01, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xBF, 0xCB, 0x80, 0x00, 0x1F,
-    0xFE, 0x10, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0xA4, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB,
-    0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00,
-    0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xD0, 0x0B, 0xF8, 0xB8, 0x01,
-    0xFF, 0xD6, 0x00, 0x3E, 0x2F, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x90, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x05,
-    0x6F, 0xF0, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xEF, 0xF0, 0xFF, 0x40, 0xBF, 0x0F, 0xF0, 0x0B, 0xF0,
-    0xFF, 0x00, 0xFF, 0x0F, 0xFE, 0xBF, 0xF0, 0x7F, 0xFF, 0x7F, 0x01, 0xFF, 0xD2, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0xFF, 0x5E, 0x00, 0x00, 0x3D, 0xBF, 0xD0, 0x00,
-    0x02, 0x40, 0x60, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0x8B,
-    0xC0, 0x00, 0x02, 0x80, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F,
-    0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x97, 0x80, 0x3E, 0xFF, 0xC0, 0x09, 0x06, 0x80, 0x00, 0x1A, 0x80, 0x00, 0x1F, 0xFC, 0x00,
-    0x1F, 0x9F, 0x80, 0x0F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xF8, 0x09, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFE, 0xFF, 0x3F, 0xD0, 0x2F, 0xCF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF,
-    0x1F, 0xFF, 0xDF, 0xC1, 0xFF, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00,
-    0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00,
-    0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x1F, 0x8B, 0xE0, 0x1F, 0x80,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4,
-    0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F,
-    0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0B, 0x49, 0x2C, 0x00, 0x00, 0x3E, 0x5B, 0xC0, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80,
-    0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00,
-    0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x2C, 0x64, 0xF0, 0x07, 0xD1, 0xBC, 0x00, 0xFF, 0xFC, 0x00, 0x06,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF,
-    0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07,
-    0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x0B, 0x46, 0x3C, 0x00, 0x00, 0x3E, 0x5B, 0xC0, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x3F, 0x80,
-    0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0, 0xFE, 0x00, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00,
-    0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x2C, 0x28, 0xF0, 0x07, 0xD1, 0xBC, 0x00, 0xFF, 0xFC, 0x00, 0x06,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x24,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFC, 0xFF,
-    0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF, 0xAF, 0xFC, 0x7F, 0xFF, 0x7F, 0x07,
-    0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0x78, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xB4, 0x83, 0xC0, 0x00, 0x07, 0xD5, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xBF, 0x00,
-    0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x01, 0xFD,
-    0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x95, 0xBF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFD, 0x00,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xC0,
-    0x00, 0x3E, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x3C, 0x70, 0xF0, 0x0B, 0xD1, 0xF8,
-    0x00, 0xFF, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x07, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xE0, 0x24, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x15, 0xBF, 0xC0, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFB, 0xFC, 0xFF, 0x40, 0xBF, 0x3F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF3, 0xFF, 0xAF,
-    0xFC, 0x7F, 0xFF, 0x7F, 0x07, 0xFF, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00,
-    0x00, 0xFF, 0x5F, 0x00, 0x00, 0x2E, 0xBF, 0xD0, 0x00, 0x01, 0x40, 0x64, 0x00, 0x00, 0x3C, 0x00,
-    0xE0, 0x00, 0x02, 0xF5, 0x7D, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x0F,
-    0xE1, 0xFC, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF4,
-    0x00, 0x7F, 0x95, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0x07, 0xFC,
-    0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x93, 0x80, 0x3E, 0xFF, 0xD0, 0x09,
-    0x06, 0x90, 0x03, 0x80, 0x0D, 0x00, 0xF9, 0x1F, 0x40, 0x1F, 0xFF, 0xC0, 0x00, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x09, 0x00, 0xFF, 0x00,
-    0x00, 0x2F, 0xC0, 0x05, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x3F, 0xFE, 0xFF, 0x3F, 0xD0, 0x2F, 0xCF,
-    0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xFF, 0xEB, 0xFF, 0x1F, 0xFF, 0xDF, 0xC1, 0xFF, 0xD2, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00,
-    0x00, 0x7F, 0x3F, 0x80, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x1F, 0xD0,
-    0xFE, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF9, 0x5B, 0xF8, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xD0, 0x00,
-    0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x7F, 0xCF, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x04, 0x03, 0xD0, 0x0F,
-    0x80, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x02, 0x40, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x5B,
-    0xFC, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xBF, 0xCF, 0xF4, 0x0B, 0xF3, 0xFC, 0x02, 0xFC, 0xFF, 0x00,
-    0xFF, 0x3F, 0xFA, 0xFF, 0xC7, 0xFF, 0xF7, 0xF0, 0x7F, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF5, 0x55, 0x3F, 0xC0, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0xFF, 0x02, 0xFD, 0x7F, 0x40,
-    0x3F, 0xAF, 0xD5, 0x5F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xFC, 0x00, 0x10, 0xBF, 0xEA, 0xBC, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x2F, 0xF8, 0x00, 0x57, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xFD, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xF5, 0x55,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xF3, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0x00, 0x6A, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x05, 0x7F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x40, 0x0B, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xC3, 0xFC, 0x0B, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x55,
-    0x7F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0,
-    0x00, 0x42, 0xFF, 0xAA, 0xF0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x74, 0xFF, 0xFB, 0xD7, 0xEF, 0xFF, 0x1D, 0x06, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x80, 0x02,
-    0xF4, 0x1E, 0x02, 0xFF, 0xEF, 0x40, 0xFB, 0xFF, 0xC0, 0x74, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x3F, 0xC0, 0xBF, 0x5F, 0xD0, 0x0F, 0xEB,
-    0xF5, 0x57, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0xFF, 0x00, 0x04, 0x2F, 0xFA, 0xAF, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x0B, 0xC0, 0xBF, 0xC7, 0xC0, 0x7F, 0xF9, 0x40, 0x3E, 0x1F, 0x40,
-    0x29, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE,
-    0x0F, 0xF5, 0x55, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x3F, 0xD5, 0x54, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFC, 0x7D, 0x00, 0x7F, 0xF9,
-    0x40, 0x03, 0xF2, 0xF4, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFC, 0x0B, 0xF4, 0x1F, 0xD0, 0x0F, 0xE0, 0xBF,
-    0x55, 0x7F, 0x83, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x04, 0x02, 0xFF, 0xAA, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xC0,
-    0x00, 0x5B, 0xFF, 0x80, 0x00, 0x7E, 0x2F, 0x40, 0x02, 0x90, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF5, 0x55, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x55, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0xF8, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xC0, 0x00, 0x57,
-    0xFF, 0x80, 0x00, 0x3F, 0x2F, 0x40, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0xBF, 0x41, 0xFD, 0x00, 0xFE,
-    0x0B, 0xF5, 0x57, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC2, 0xFC, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x40, 0x2F, 0xFA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1E, 0x0B,
-    0xFC, 0xB8, 0x1F, 0xFE, 0x10, 0x3E, 0x1F, 0x40, 0xA4, 0x02, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0x55, 0x50, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0x55, 0x50, 0xFF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xE0, 0x0B,
-    0xFC, 0xB8, 0x01, 0xFF, 0xE6, 0x00, 0x3F, 0x2F, 0x40, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFC, 0x0B, 0xF4, 0x7F, 0x40,
-    0x3F, 0x8B, 0xF5, 0x57, 0xF8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xBF, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x02, 0xFF, 0xAA, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x3F, 0xD7, 0xC2, 0xEB, 0xFD, 0x05, 0x01, 0x80,
-    0x01, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0xF8, 0xBC, 0x0A, 0x00, 0x68, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xD5, 0x54, 0xFF, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD3, 0xC0, 0x2E, 0xFF, 0xD0, 0x09, 0x02, 0x90, 0x00, 0x1A, 0x90,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0x8F, 0xC0, 0x0F, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFC, 0x3F, 0xC0, 0xBF, 0x5F, 0xD0, 0x0F, 0xEB, 0xF5, 0x57,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00,
-    0x04, 0x2F, 0xFA, 0xAF, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xF4, 0x0B, 0xE3, 0xF4, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFB, 0xFD, 0x55, 0x4F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0x55, 0x53, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFE, 0x00, 0x2F, 0x8B, 0xE0, 0x1F, 0x40,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x0F, 0xF0,
-    0x2F, 0xD7, 0xF4, 0x03, 0xFA, 0xFD, 0x55, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF0,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0x0B, 0xFE, 0xAB, 0xC0, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xFF, 0x00, 0x4F, 0xD0, 0x02, 0xF0, 0x03,
-    0xF8, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xCB, 0xFF, 0xD0, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0xF4, 0xFF, 0xFF, 0x3F, 0xFF, 0xC0, 0x6A,
-    0x4B, 0xFE, 0x57, 0xF0, 0x3F, 0x1F, 0xD1, 0xF0, 0x00, 0x02, 0xA4, 0x3F, 0x83, 0xF8, 0x3F, 0x83,
-    0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8, 0x3F, 0x80, 0x3F,
-    0xFF, 0xCF, 0xFF, 0xF2, 0xFF, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0xC0, 0x7F, 0xFD, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xF0, 0x03, 0xFC,
-    0x00, 0xBF, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xD7, 0xFC, 0xFE, 0x1A, 0x00, 0x02, 0xA4, 0xFE, 0x3F,
-    0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x3F, 0x8F, 0xE3, 0xF8, 0xFE, 0x00, 0x01,
-    0x43, 0xF9, 0xFF, 0x3F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4,
-    0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F,
-    0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF,
-    0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF,
-    0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F,
-    0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x57, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x2F, 0xDF,
-    0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3, 0xFC, 0x07,
-    0xFC, 0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xFC, 0x7D, 0x00, 0x01, 0xFF, 0xF5,
-    0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x0A, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80,
-    0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD,
-    0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80,
-    0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xFC, 0x7D, 0x00,
-    0x7F, 0xF9, 0x40, 0x03, 0xF2, 0xF4, 0x00, 0x2E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x03, 0xFD, 0x0B, 0xF8, 0x1F, 0xD0, 0x0F,
-    0xF0, 0xBF, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x7F, 0x4F, 0xF0, 0x01, 0xFD, 0x2F, 0xC0, 0x0B, 0xF4,
-    0xBF, 0x40, 0x2F, 0xC0, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0xAF, 0xF4, 0x03, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xC7, 0xFC, 0x00, 0x00, 0x15, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x06, 0x80,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0, 0x00,
-    0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF,
-    0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x03,
-    0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xFC, 0x00, 0x01, 0x5F, 0xFE, 0x00, 0x00, 0x3F, 0x1F, 0x40,
-    0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x07, 0xF4, 0x03, 0xFC, 0x0B, 0xF0, 0x02, 0xFD,
-    0x0F, 0xF0, 0x01, 0xFD, 0x0F, 0xF0, 0x01, 0xFD, 0x0B, 0xF0, 0x02, 0xFD, 0x0B, 0xF4, 0x02, 0xFC,
-    0x03, 0xFC, 0x07, 0xFC, 0x02, 0xFF, 0xAF, 0xF4, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0xBF, 0xC7, 0x80, 0x00, 0x1F, 0xFF, 0x10, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00,
-    0xA4, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0, 0x00, 0xFF, 0x83, 0xFC,
-    0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD, 0xBF, 0x40, 0x00, 0x2F,
-    0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x03, 0xFC, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xFC, 0x78, 0x01, 0xFF, 0xE2, 0x00,
-    0x3F, 0x2F, 0x40, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0, 0x02, 0xFD, 0xFF,
-    0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC, 0x3F, 0xC0, 0x7F,
-    0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x10, 0x00, 0x00, 0xFF, 0x9F, 0x00, 0x00, 0x2E, 0xBF, 0xD0, 0x00, 0x01, 0x40, 0x64,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x02,
-    0x90, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x3F, 0xC0,
-    0x00, 0x7F, 0xC7, 0xF8, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xDB, 0xF4, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0x7F, 0x80, 0x00, 0x3F, 0xC3, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0xE0, 0x00, 0xBF, 0x81, 0xFF, 0x80, 0x2F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0xF0, 0x02, 0xEB, 0xFD, 0x00, 0x28, 0x0A, 0x40, 0x00, 0x0A, 0x90, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00,
-    0x0B, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0x87, 0xF4, 0x03, 0xFC, 0xBF, 0x00,
-    0x2F, 0xDF, 0xF0, 0x01, 0xFD, 0xFF, 0x00, 0x1F, 0xDB, 0xF0, 0x02, 0xFD, 0xBF, 0x40, 0x2F, 0xC3,
-    0xFC, 0x07, 0xFC, 0x2F, 0xFA, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03,
-    0xF5, 0xFC, 0x00, 0x00, 0xB8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x83, 0xFC, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x03, 0xFD,
-    0xBF, 0x40, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0x2F, 0xD7, 0xF8, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0x1F, 0xC0, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xF8, 0x7F, 0x40, 0x3F, 0xCB, 0xF0,
-    0x02, 0xFD, 0xFF, 0x00, 0x1F, 0xDF, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x2F, 0xDB, 0xF4, 0x02, 0xFC,
-    0x3F, 0xC0, 0x7F, 0xC2, 0xFF, 0xAF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x02, 0xFF, 0xF8, 0x0B, 0xF0, 0x0B, 0xFF, 0xFF, 0xD3, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFE, 0x01, 0xFF, 0xFD, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x02,
-    0xFD, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0x0F,
-    0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x1F, 0xF8, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x0B, 0xF9, 0x07, 0xF4, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x2F,
-    0xF8, 0x07, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xC0,
-    0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x02, 0xFF, 0xF8, 0x0B, 0xF0, 0x0B, 0xFF, 0xFF, 0xD3, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFE, 0x01, 0xFF, 0xFD, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x02,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2A, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x0B,
-    0xF9, 0x07, 0xF4, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF4, 0x2F, 0xF8, 0x07,
-    0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x07, 0xF4,
-    0x0B, 0xF0, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x5B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0xFE, 0x02, 0xFC, 0x02, 0xFF, 0xFF, 0xF4, 0xFE, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xFF, 0x40, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x0B, 0xF8, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00,
-    0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x2F, 0xD0, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x07, 0xF8, 0x00,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x07, 0xFE, 0x00,
-    0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x05, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0x80,
-    0x0A, 0xA0, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFE, 0x41, 0xFD, 0x0B, 0xFF, 0xFD, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFD, 0x0B, 0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x3F,
-    0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0xFC, 0x00,
-    0x00, 0x0B, 0xEF, 0xFD, 0x00, 0x00, 0x03, 0xC0, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0xC0, 0x2F, 0xFF, 0xFF, 0x4F, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xF8, 0x07, 0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x01,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0x00, 0x01, 0xFF, 0xEF, 0x80, 0x00, 0xFE, 0xFF, 0xD0,
-    0x00, 0x3C, 0x0B, 0x90, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xE4, 0x1F, 0xD0, 0xBF, 0xFF,
-    0xDF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F, 0xD0, 0xBF, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x02, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x1F, 0xD0, 0x2F, 0xC0, 0x0B, 0xF4, 0x0B,
-    0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x0B,
-    0xFF, 0xE0, 0x2F, 0xC0, 0x2F, 0xFF, 0xFF, 0x4F, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF8,
-    0x07, 0xFF, 0xF4, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x01, 0xFE, 0x00,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00,
-    0x02, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF9, 0x07, 0xF4, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xF4, 0x2F, 0xF8, 0x07, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0xFF, 0x00,
-    0x3F, 0xC0, 0x7F, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xFB, 0xFC,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x1F, 0xE7,
-    0xFD, 0x01, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x2A, 0x40, 0x0A, 0x97, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7,
-    0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01,
-    0xFD, 0x7F, 0x80, 0x1F, 0xD3, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x7F, 0xD3, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xEF, 0xD0, 0x7F, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFE, 0xBF, 0x40, 0x07, 0xF9, 0xFF, 0x40, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x17, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0xA9, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD,
-    0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80, 0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x7F, 0x80,
-    0x1F, 0xD7, 0xF8, 0x01, 0xFD, 0x3F, 0x80, 0x2F, 0xD3, 0xFC, 0x07, 0xFD, 0x3F, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFE, 0xFD, 0x07, 0xFF, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0x3F, 0x8B, 0xF3, 0xFC,
-    0x00, 0x0F, 0xF3, 0xF8, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0xFC, 0x0F, 0xF0,
-    0x00, 0x3F, 0xE4, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xA4, 0x00, 0xA9, 0x7F, 0x5F,
-    0xE0, 0x07, 0xFB, 0xFC, 0x7F, 0x80, 0x1F, 0xFF, 0xC1, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xF8, 0x01,
-    0xFD, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x7F, 0x40,
-    0x07, 0xF8, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x7F, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xDB, 0xF0, 0x00, 0x3F, 0x8B, 0xF3, 0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0xFF, 0x00, 0x03, 0xFF,
-    0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xE4, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xD0, 0x1F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xA8, 0x00, 0x00,
-    0x00, 0x0F, 0xE2, 0xA4, 0x00, 0xA9, 0x7F, 0x5F, 0xE0, 0x07, 0xFB, 0xFC, 0x7F, 0x80, 0x1F, 0xFF,
-    0xC1, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x7F,
-    0x80, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0xFD, 0x00,
-    0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0xFC,
-    0x00, 0x0F, 0xE2, 0xFC, 0xFF, 0x00, 0x03, 0xFC, 0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0xFF, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF9, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x0F, 0xE0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x1F, 0xF4, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x3F, 0x8A, 0x90, 0x02, 0xA5, 0xFD, 0x7F, 0x80, 0x1F, 0xEF, 0xF1, 0xFE, 0x00,
-    0x7F, 0xFF, 0x07, 0xF8, 0x01, 0xFF, 0xE0, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xD0,
-    0x01, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x0B, 0xF4, 0x00, 0x3F,
-    0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x01, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFB,
-    0xF4, 0x00, 0x07, 0xFF, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x07, 0x40,
-    0x00, 0x00, 0xFF, 0xFB, 0xC0, 0x00, 0x00, 0x7E, 0xFF, 0xE0, 0x00, 0x00, 0x1D, 0x06, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0xFE, 0x2F, 0xCF, 0xF0, 0x00, 0x3F, 0xCF,
-    0xE3, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x90,
-    0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x01,
-    0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x00, 0x0F,
-    0xFF, 0xBC, 0x00, 0x00, 0xBE, 0xFF, 0xE0, 0x00, 0x02, 0xC0, 0x7D, 0x00, 0xAA, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0xA9, 0x00, 0x2A, 0x5F, 0xD7, 0xF8, 0x01, 0xFE, 0xFF, 0x1F, 0xE0, 0x07, 0xFF, 0xF0,
-    0x7F, 0x80, 0x1F, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x1F, 0xE0,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0xBF, 0x40, 0x03, 0xF8, 0x03, 0xFD,
-    0x00, 0x0F, 0xF0, 0x1F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xBF, 0x40, 0x00,
-    0x7F, 0xF4, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xC0,
-    0x00, 0xFE, 0x2F, 0xCF, 0xF0, 0x00, 0x3F, 0xCF, 0xE3, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0x00,
-    0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x90, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xA4, 0x00, 0xA9, 0x7F, 0x5F, 0xE0, 0x07, 0xFB, 0xFC,
-    0x7F, 0x80, 0x1F, 0xFF, 0xC1, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x1F, 0xE0,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x02, 0xFD,
-    0x00, 0x0F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x6A,
-    0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0x80, 0x1F, 0xD0, 0xBF, 0x00, 0xBF, 0x01, 0xFD, 0x03, 0xF8, 0x03,
-    0xF8, 0x1F, 0xD0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xAA, 0x00, 0x06, 0xA2, 0xFD, 0x00, 0x3F, 0xC3,
-    0xF8, 0x01, 0xFD, 0x0B, 0xF0, 0x0B, 0xF0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0x81, 0xFD, 0x00, 0xBF,
-    0x0B, 0xF0, 0x00, 0xFD, 0x3F, 0x80, 0x02, 0xF9, 0xFC, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x1F, 0xE0, 0x40, 0x01, 0xFF, 0x0F, 0xD0, 0xFF, 0xF8, 0x7F, 0x83, 0xFF, 0x80, 0xFD, 0x0F,
-    0xF4, 0x00, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B,
-    0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x80, 0x01, 0xA8, 0xBF, 0x40, 0x0F, 0xF0, 0xFE, 0x00, 0x7F, 0x42, 0xFC, 0x02, 0xFC,
-    0x07, 0xF4, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x40, 0x2F, 0xC2, 0xFC, 0x00, 0x3F, 0x4F, 0xE0, 0x00,
-    0xBE, 0x7F, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03,
-    0xC0, 0x01, 0xFF, 0xEF, 0x80, 0x03, 0xEB, 0xFF, 0x00, 0x03, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFD, 0x7F, 0xC0, 0x03, 0xFC, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x0B, 0xF4, 0x2F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xB8, 0x0B, 0x00, 0x0F, 0xFF, 0xBC,
-    0x00, 0xBE, 0xFF, 0xE0, 0x02, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x1A, 0x8B,
-    0xF4, 0x00, 0xFF, 0x0F, 0xE0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F, 0xC0, 0x7F, 0x40, 0xFE, 0x00, 0xFE,
-    0x07, 0xF4, 0x02, 0xFC, 0x2F, 0xC0, 0x03, 0xF4, 0xFE, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x2F, 0xFC, 0xA0, 0xD2,
-    0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFC, 0x15, 0x54, 0x7F,
-    0xFD, 0x7F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF6, 0xAA,
-    0xAA, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x2A, 0xAA, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
-    0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC,
-    0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03,
-    0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB,
-    0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0x68, 0x02, 0x90, 0x15,
-    0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2A, 0xAA,
-    0xA8, 0x0B, 0xC0, 0xFC, 0x2F, 0x83, 0xF4, 0x7F, 0x0B, 0xF0, 0x15, 0x00, 0x1F, 0xC2, 0xFC, 0x3F,
-    0x43, 0xF0, 0x7E, 0x0B, 0xD0, 0x14, 0x00, 0x0F, 0xD1, 0xFC, 0x2F, 0xC3, 0xF4, 0x3F, 0x03, 0xE0,
-    0x14, 0x00, 0xBF, 0x07, 0xF0, 0x3F, 0x42, 0xF8, 0x1F, 0x80, 0xFC, 0x01, 0x40, 0x0B, 0xC0, 0xF8,
-    0x3F, 0x07, 0xE2, 0xF8, 0x3F, 0x4F, 0xD0, 0xFC, 0x7F, 0x0B, 0xF2, 0xFC, 0x3F, 0x81, 0x50, 0x54,
-    0x00, 0x1F, 0xC2, 0xF8, 0xBF, 0x0F, 0xE3, 0xF4, 0x3F, 0x0F, 0xC1, 0xFC, 0x7E, 0x0B, 0xD2, 0xF4,
-    0x3F, 0x01, 0x40, 0x50, 0x00, 0x0F, 0xD1, 0xFC, 0x0F, 0xD2, 0xFC, 0x1F, 0xC2, 0xF8, 0x2F, 0x83,
-    0xF4, 0x3F, 0x03, 0xF0, 0x3F, 0x07, 0xD0, 0x14, 0x01, 0x40, 0xBF, 0x0F, 0xE1, 0xFC, 0x2F, 0xC3,
-    0xF4, 0x7F, 0x0B, 0xE0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x03, 0xE0, 0x14, 0x05, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x02, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x5A, 0x7E, 0x69, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x69, 0xFD,
-    0xA6, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2E, 0x00, 0xBF, 0xFF, 0xFA, 0xFF, 0xFF, 0xE6, 0x9F, 0xEA, 0x40, 0x2E, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x3F, 0xF8, 0xBF, 0xFC, 0xFF, 0xFC,
-    0xFF, 0xFC, 0xBF, 0xFC, 0x3F, 0xF4, 0x0A, 0x90, 0x50, 0x00, 0x2E, 0x00, 0x0B, 0xF4, 0x02, 0xFF,
-    0xD0, 0xBF, 0xFE, 0x2F, 0xFE, 0x0B, 0xFD, 0x02, 0xF4, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x3F, 0xDF, 0xF6, 0xFC, 0x04, 0x00, 0x2E, 0x00, 0x7D, 0x2F, 0xE0, 0x3F, 0xCB, 0xF8, 0x0F, 0xF1,
-    0xFD, 0x03, 0xF8, 0x04, 0x00, 0x10, 0x00, 0x2E, 0x00, 0xB8, 0x02, 0xE2, 0xFE, 0x07, 0xF8, 0x1F,
-    0xFB, 0xF8, 0x1F, 0xF0, 0x7F, 0xDF, 0xD0, 0x3F, 0x40, 0xFE, 0x04, 0x00, 0x10, 0x00, 0x40, 0x2E,
-    0x2F, 0xEB, 0xF9, 0xFD, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0x80, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x0F, 0xC7, 0xE1, 0xFD, 0x00, 0x2F, 0x80, 0x2F, 0xAF, 0xCF, 0xCB, 0xFF, 0x80, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x1F, 0x4F, 0xEF, 0xC2, 0xFA, 0xF8, 0x07, 0xFD, 0x3F, 0x1F, 0x47, 0xE3, 0xF0, 0xFC, 0x00,
-    0x00, 0xBD, 0x2F, 0x43, 0xE3, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x2F, 0x43, 0xF3, 0xE0, 0xBC, 0x00,
-    0x02, 0xF4, 0x2F, 0x43, 0xF3, 0xE0, 0xBC, 0x00, 0x07, 0xE0, 0x2F, 0x47, 0xE3, 0xF0, 0xFC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xCF, 0xD3, 0xF5, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xFF, 0xC1, 0xFF, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xBD, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x0F, 0xC7, 0xE1, 0xFE, 0x00, 0x2F, 0x80, 0x07, 0xF8, 0x0F, 0xEB, 0xF3, 0xF2, 0xFF,
-    0xF0, 0x3F, 0xFD, 0x0B, 0xFF, 0x80, 0xFF, 0xF5, 0xF8, 0xFE, 0xFD, 0x2F, 0xEF, 0xC3, 0xFB, 0xF4,
-    0x1F, 0xF4, 0xFC, 0x7E, 0x1F, 0x8F, 0xC3, 0xF1, 0xF8, 0x7E, 0x00, 0x00, 0xBD, 0x2F, 0x43, 0xF3,
-    0xF0, 0xBD, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x0B, 0xD0, 0xFC, 0xFC, 0x2F, 0x6F, 0x43, 0xF0, 0x00,
-    0x2F, 0x42, 0xF4, 0x3F, 0x3F, 0x0B, 0xDB, 0xD0, 0xFC, 0x00, 0x0F, 0xC0, 0x7E, 0x0F, 0xCF, 0xC2,
-    0xF5, 0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0x0F, 0xDB, 0xE2, 0xF9, 0xFC, 0x3F, 0x6F, 0x80, 0x07, 0xE0,
-    0x02, 0xFF, 0xF0, 0x3F, 0xFE, 0x0B, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xF0, 0x07, 0xFE, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0xC0,
-    0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF4, 0x06, 0x40, 0x00, 0x02, 0xF4, 0x7F, 0x01, 0xFC, 0x3F, 0x40,
-    0xFC, 0x1F, 0xC0, 0x7E, 0x0F, 0xC0, 0x3F, 0x07, 0xD0, 0x1F, 0x43, 0xF0, 0x06, 0x40, 0xA0, 0x00,
-    0x02, 0xF4, 0x7F, 0x0B, 0xD0, 0x7F, 0x0F, 0xD1, 0xFC, 0x0F, 0xC1, 0xFC, 0x3F, 0x41, 0xF8, 0x3F,
-    0x07, 0xE0, 0x3F, 0x07, 0xD0, 0xFC, 0x07, 0xD0, 0xFC, 0x1F, 0x40, 0x64, 0x0A, 0x01, 0x90, 0x00,
-    0x7E, 0x00, 0xFD, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xD0, 0x06, 0x40, 0x7E, 0x0B, 0xD0,
-    0x0F, 0xD1, 0xFC, 0x00, 0xFC, 0x2F, 0x40, 0x2F, 0x43, 0xF0, 0x03, 0xF0, 0x7D, 0x00, 0x3D, 0x0B,
-    0xC0, 0x06, 0x40, 0xA0, 0x7E, 0x0B, 0xD1, 0xFC, 0x03, 0xF4, 0x7F, 0x0F, 0xD0, 0x0F, 0xC2, 0xF4,
-    0x3F, 0x00, 0xBD, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0x7D, 0x0F, 0xC0, 0x0F, 0x42, 0xF0, 0x3D, 0x00,
-    0x64, 0x0A, 0x01, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xAD,
-    0x00, 0xF0, 0xF0, 0x1E, 0x0B, 0x43, 0xC0, 0x3C, 0x7C, 0x02, 0xD0, 0x00, 0x10, 0x00, 0x1F, 0x40,
-    0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-    0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x90, 0x01, 0x00, 0x07, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF0, 0x0B, 0xF4, 0x07, 0xF8, 0x02, 0xF8, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x01, 0x02, 0xF0, 0x0F, 0xD0, 0x2F, 0x0F,
-    0xF0, 0x3F, 0x42, 0xFC, 0x0F, 0xF0, 0x68, 0x2F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x29, 0x0F, 0xFF, 0xC0, 0xA2, 0xFC, 0x0F, 0xFC, 0x0F,
-    0xFB, 0xF0, 0x2F, 0xF0, 0x3F, 0xDF, 0x82, 0xFF, 0xF0, 0x7E, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x02,
-    0xFC, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x02, 0xFC, 0x04, 0x0F, 0xE0, 0x2F, 0xC0, 0xFC,
-    0x0F, 0xE0, 0xFC, 0x03, 0xF8, 0x0F, 0xC0, 0x80, 0x0F, 0xD0, 0x0C, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x7F, 0x81, 0xFE, 0xBF, 0x81, 0xFE, 0x7F, 0x81, 0xFE, 0x7F, 0x41, 0xFE, 0x7F, 0x40, 0xFE, 0x7F,
-    0x40, 0xFE, 0x7F, 0x40, 0xFD, 0x3F, 0x40, 0xFD, 0x3F, 0x00, 0xFD, 0x3F, 0x00, 0xFD, 0x3F, 0x00,
-    0xFC, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0xB8, 0xBF, 0x81, 0xFE,
-    0xBF, 0x81, 0xFF, 0x7F, 0x40, 0xFD, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0xBF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x3B, 0xF1, 0xFC, 0x03, 0xF0, 0xFD, 0x03, 0xF0, 0xFC, 0x03, 0xF3,
-    0xFC, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB4, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x10, 0x00, 0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0x00, 0x0B, 0x03, 0xD0, 0x00, 0xF4, 0x03,
-    0xFA, 0xBF, 0x40, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x2B, 0xA4, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xF8,
-    0x00, 0x7C, 0x0B, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x3C, 0x00, 0x01,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0x00, 0x07,
-    0x9D, 0x00, 0x3C, 0x3C, 0x01, 0xE0, 0xB4, 0x0B, 0x00, 0xF0, 0x38, 0x02, 0xD0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x7C, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBE, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x01, 0x01, 0x40, 0xFC,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x50,
-    0x3D, 0x06, 0x00, 0x90, 0xBC, 0x18, 0xBF, 0xBE, 0xFF, 0x00, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFE, 0x5A, 0xFF, 0xA5, 0x00, 0x5B, 0xFF, 0xA4, 0x01, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x03, 0xFB, 0xD0, 0x00, 0x0B, 0xDF, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x1F, 0xCB, 0xE0,
-    0x0F, 0xC2, 0xF4, 0x00, 0x2F, 0x43, 0xE0, 0x01, 0x40, 0x40, 0x00, 0x02, 0x01, 0x00, 0x15, 0x52,
-    0xFF, 0xFB, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xE7, 0xFA, 0x5F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0,
-    0x1F, 0xC0, 0x7F, 0x01, 0xFD, 0x47, 0xFF, 0x9F, 0xFE, 0x7F, 0x51, 0xFC, 0x07, 0xF0, 0x1F, 0xC0,
-    0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xE9, 0x7F, 0xF8, 0xFF, 0xE0, 0x7F, 0xF5, 0xFF, 0xE6, 0xBF,
-    0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x5B, 0xE7, 0xFF, 0x9F, 0xFE,
-    0x17, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0xBE, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x8A, 0xFE, 0x7F, 0xF9,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x1B, 0xFF, 0x80, 0xBF, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x39, 0x02, 0xFD, 0x38, 0x03, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x07, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFE,
-    0x00, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01,
-    0xF4, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x02, 0xFD, 0xBF, 0xFF, 0xF4, 0x2F, 0xE7, 0xFF, 0xFF, 0xC2, 0xFD, 0x39, 0x02, 0xFD, 0x2F,
-    0xD0, 0x00, 0x0F, 0xD1, 0xFD, 0x00, 0x01, 0xFD, 0x1F, 0xD0, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x1F,
-    0xF0, 0x1F, 0xC0, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0xB8, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x3F, 0xD0, 0x02, 0xFE, 0x02, 0xFC, 0x00, 0x1F, 0xC0,
-    0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xFF, 0xD0, 0xBF, 0x87, 0xFF,
-    0xFF, 0x87, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0x42, 0x90, 0x2F, 0xD7, 0xF4, 0x00, 0x00, 0xFE, 0x7F,
-    0x40, 0x00, 0x0F, 0xD7, 0xF4, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x01, 0xFF, 0x43, 0xF0, 0x00, 0x7F,
-    0xD0, 0x3F, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0xBF, 0x80, 0x2F, 0xD0,
-    0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x00, 0x40, 0x00, 0x10, 0x00, 0xAA, 0xAA,
-    0xAA, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F,
-    0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xF4, 0x3D, 0x7F, 0xFF, 0xC3, 0xC3, 0xFF, 0xFD, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF,
-    0xFF, 0x3C, 0x3F, 0xFF, 0xF3, 0xC3, 0xFF, 0xFE, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFD, 0x3C,
-    0x3F, 0xFF, 0xC3, 0xC3, 0xFF, 0xE0, 0x3C, 0x3D, 0x50, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3,
-    0xC0, 0x00, 0x3C, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA,
-    0x80, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x3C, 0x7F, 0xFF, 0xC3, 0xCB, 0xFF,
-    0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xC7, 0xFF, 0xFC, 0x3C,
-    0x3F, 0xFF, 0xEB, 0xC0, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0xAA, 0xAA, 0x90, 0x0F, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFC,
-    0xF0, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xFC, 0xF0, 0xFF, 0xFF, 0xCF, 0x0F, 0xFF, 0xF8, 0xFA, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF, 0x8F, 0xFF, 0xFF, 0xE1, 0x6B, 0xFE, 0x54,
-    0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7E, 0x0F, 0x80, 0x01, 0x01, 0x00,
-    0x2E, 0x07, 0xF8, 0xBF, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x3F, 0x43, 0xF8, 0x1F, 0xC0, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x2B, 0xA4, 0x00, 0x0B,
-    0xFF, 0xFC, 0x00, 0xF8, 0x00, 0x7C, 0x0B, 0x00, 0x00, 0x3C, 0x70, 0x00, 0x00, 0x34, 0x40, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE3, 0xC0, 0x00,
-    0x0B, 0x03, 0xD0, 0x00, 0xF4, 0x03, 0xFA, 0xBF, 0x40, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x90, 0x7C, 0x09, 0x3F, 0xFF, 0xBF, 0x8F, 0xFF, 0xFF,
-    0xE1, 0x6B, 0xFE, 0x54, 0x03, 0xFF, 0x40, 0x02, 0xFB, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x7E, 0x0F,
-    0x80, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x24, 0x1F, 0x02, 0x4F, 0xFF, 0xEF, 0xE3, 0xFF, 0xFF, 0xF8, 0x5A, 0xFF, 0x95, 0x00, 0xFF,
-    0xD0, 0x00, 0xBE, 0xFC, 0x00, 0x7F, 0x1F, 0xC0, 0x1F, 0x83, 0xE0, 0x00, 0x40, 0x40, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x0B, 0xDF, 0xF4, 0x3F, 0x3F, 0xC1, 0xF4, 0x3E, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xB8, 0x3F, 0x0B, 0xF5, 0xF8, 0x2F,
-    0xDB, 0xD0, 0x7F, 0x00, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x40,
-    0x00, 0x3C, 0x3F, 0xFF, 0xFF, 0xFF, 0xAA, 0xF8, 0xBD, 0x01, 0xAF, 0xFF, 0xFF, 0xE0, 0xA0, 0x00,
-    0x00, 0x5B, 0xFE, 0x40, 0x00, 0x05, 0x50, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBD, 0x01, 0xB8, 0x07,
-    0x40, 0x00, 0x78, 0x34, 0x00, 0x00, 0x34, 0x80, 0x00, 0x00, 0x50, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0x4F, 0x1E, 0x00, 0xBD, 0xF7, 0xE0, 0x02, 0xFF, 0xF8, 0x01, 0x5F, 0xFF, 0x54,
-    0x7F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x0F, 0x8F,
-    0x2F, 0x00, 0x20, 0xF0, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xA0, 0x02, 0xF4, 0x7E, 0x0F, 0xC3, 0xF4,
-    0x1F, 0xC3, 0xF0, 0xFD, 0x2F, 0x80, 0xFC, 0x2F, 0x87, 0xF0, 0xFC, 0x07, 0xE0, 0xFC, 0x3F, 0x0B,
-    0xD0, 0x3F, 0x0B, 0xC1, 0xF4, 0x3E, 0x01, 0xF4, 0x3E, 0x0F, 0xC2, 0xF0, 0x06, 0x40, 0xA0, 0x28,
-    0x0A, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8,
-    0x7F, 0x80, 0x00, 0x03, 0xFD, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x7F, 0x40, 0x00, 0x02,
-    0xFC, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x19, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x03,
-    0xFD, 0x7F, 0x80, 0x00, 0x02, 0xFC, 0x19, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0F, 0xDB, 0xFA, 0xFE,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x7F,
-    0xAF, 0xE3, 0xF4, 0x10, 0x00, 0x06, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x00, 0x01, 0xA1, 0xFE, 0x00, 0x0F, 0xFB, 0xF8, 0x00, 0x7F, 0xDF, 0xD0, 0x00,
-    0xFE, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x43,
-    0xF0, 0x3F, 0x40, 0x2F, 0xE0, 0xFC, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0x07, 0xFC, 0x00, 0xBC, 0x0F,
-    0xC0, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x15, 0x55, 0x7F,
-    0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0xFD,
-    0x55, 0x54, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2E, 0x03, 0xF0,
-    0x2E, 0x00, 0x1F, 0xE0, 0xFC, 0x1F, 0xF0, 0x0B, 0xF8, 0x3F, 0x07, 0xFC, 0x00, 0xFD, 0x0F, 0xC0,
-    0xFE, 0x00, 0x04, 0x03, 0xF0, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x1F, 0xE7, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x5F, 0xF7, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x7F, 0xAF, 0xE7, 0xF4, 0x14, 0x04, 0x1F, 0xDB, 0xF9, 0xFD, 0x19, 0x01, 0x07, 0xF6, 0xFE, 0x7F,
-    0x46, 0x40, 0x41, 0xFD, 0xBF, 0x9F, 0xE1, 0x90, 0x10, 0x7F, 0x6F, 0xE7, 0xF8, 0x64, 0x00, 0x0B,
-    0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x42, 0xFF, 0xF0, 0xFD, 0xBE, 0x7E, 0x0F, 0xDF,
-    0x83, 0xF7, 0xE0, 0xFD, 0xF8, 0x3F, 0x3F, 0x1F, 0x8F, 0xFF, 0xD1, 0xFF, 0xF0, 0x0B, 0xE0, 0x63,
-    0xE6, 0x14, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xAE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00,
-    0x3F, 0xF0, 0x0B, 0xBF, 0x00, 0xF3, 0xF0, 0x3D, 0x3F, 0x0B, 0xD7, 0xF4, 0xBF, 0xFF, 0xD6, 0xAB,
-    0xF8, 0x00, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0xB8, 0x00, 0xB9, 0x40,
-    0xBF, 0xF8, 0x6A, 0xFD, 0x00, 0x3E, 0x00, 0x3E, 0xE5, 0xBD, 0xFF, 0xFC, 0x6F, 0x90, 0x00, 0x15,
-    0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFD, 0x00, 0x3E, 0x10, 0x1F, 0xBF, 0xC7, 0xFA, 0xF9, 0xF4, 0x3F,
-    0x7D, 0x0F, 0xCF, 0xDB, 0xE1, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0xFF, 0xFC,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0xBD, 0x00, 0x2A, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x83, 0xFB, 0xF4, 0xF8, 0x3E, 0x3F, 0x1F, 0x43,
-    0xFF, 0x41, 0xFF, 0xE0, 0xF8, 0xBE, 0x7C, 0x0B, 0xDF, 0x87, 0xF3, 0xFF, 0xF4, 0x1B, 0xE0, 0x00,
-    0x50, 0x03, 0xFF, 0x43, 0xFF, 0xF1, 0xF4, 0x3E, 0x7D, 0x0F, 0xDF, 0x87, 0xF3, 0xFF, 0xFC, 0x2E,
-    0x3E, 0x00, 0x1F, 0x45, 0x6F, 0xC2, 0xFF, 0xD0, 0x7E, 0x80, 0x01, 0x90, 0x00, 0xB4, 0x00, 0x2D,
-    0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0x06, 0x40, 0x3F, 0xFF, 0x0F, 0xFF,
-    0xC0, 0x15, 0x55, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x55, 0x54, 0x3F, 0xFF, 0x05, 0x55, 0x40, 0x06,
-    0x83, 0xD2, 0xF0, 0xF4, 0x3C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x03, 0xC0, 0xF8, 0x1F, 0x03,
-    0xD0, 0x14, 0x64, 0x0F, 0x02, 0xE0, 0x7C, 0x0F, 0x03, 0xD0, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF0,
-    0x7C, 0x3D, 0x1F, 0x05, 0x00, 0x50, 0x64, 0x3E, 0xFF, 0xCF, 0xE6, 0xF7, 0xF0, 0x3D, 0xF8, 0x0F,
-    0x7E, 0x03, 0xDF, 0x80, 0xF7, 0xE0, 0x3D, 0xB8, 0x0F, 0x40, 0x00, 0x50, 0x03, 0xFF, 0x42, 0xFF,
-    0xF0, 0xFD, 0xBE, 0x7E, 0x0F, 0xDF, 0x83, 0xF7, 0xE0, 0xFD, 0xF8, 0x3F, 0x3F, 0x1F, 0x8F, 0xFF,
-    0xD1, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0xCB, 0xFF, 0x2E, 0xFC, 0x13, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2A, 0x00, 0x50, 0x07, 0xFF, 0x43, 0xFF,
-    0xF0, 0x60, 0xFD, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x0F, 0xFF,
-    0xD7, 0xFF, 0xF8, 0xAA, 0xA9, 0x00, 0x50, 0x0B, 0xFF, 0x43, 0xFF, 0xF0, 0x50, 0x7D, 0x00, 0x1F,
-    0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0x9E, 0x5B, 0xE7, 0xFF, 0xF0, 0x6F, 0x90,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xBF, 0x00, 0xF3, 0xF0, 0x3D,
-    0x3F, 0x0B, 0xD7, 0xF4, 0xBF, 0xFF, 0xD6, 0xAB, 0xF8, 0x00, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x7F, 0xFC, 0x7F, 0xFC, 0xB8, 0x00, 0xB9, 0x40, 0xBF, 0xF8, 0x6A, 0xFD, 0x00, 0x3E, 0x00, 0x3E,
-    0xE5, 0xBD, 0xFF, 0xFC, 0x6F, 0x90, 0x00, 0x15, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFD, 0x00, 0x3E,
-    0x10, 0x1F, 0xBF, 0xC7, 0xFA, 0xF9, 0xF4, 0x3F, 0x7D, 0x0F, 0xCF, 0xDB, 0xE1, 0xFF, 0xF0, 0x0B,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B,
-    0xC0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x2A, 0x00, 0x00, 0x50, 0x03, 0xFF,
-    0x83, 0xFB, 0xF4, 0xF8, 0x3E, 0x3F, 0x1F, 0x43, 0xFF, 0x41, 0xFF, 0xE0, 0xF8, 0xBE, 0x7C, 0x0B,
-    0xDF, 0x87, 0xF3, 0xFF, 0xF4, 0x1B, 0xE0, 0x00, 0x50, 0x03, 0xFF, 0x43, 0xFF, 0xF1, 0xF4, 0x3E,
-    0x7D, 0x0F, 0xDF, 0x87, 0xF3, 0xFF, 0xFC, 0x2E, 0x3E, 0x00, 0x1F, 0x45, 0x6F, 0xC2, 0xFF, 0xD0,
-    0x7E, 0x80, 0x01, 0x90, 0x00, 0xB4, 0x00, 0x2D, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0xB4, 0x00,
-    0x2D, 0x00, 0x06, 0x40, 0x3F, 0xFF, 0x0F, 0xFF, 0xC0, 0x15, 0x55, 0x0F, 0xFF, 0xC1, 0x55, 0x50,
-    0x55, 0x54, 0x3F, 0xFF, 0x05, 0x55, 0x40, 0x06, 0x83, 0xD2, 0xF0, 0xF4, 0x3C, 0x1F, 0x07, 0xC1,
-    0xF0, 0x7C, 0x1F, 0x03, 0xC0, 0xF8, 0x1F, 0x03, 0xD0, 0x14, 0x64, 0x0F, 0x02, 0xE0, 0x7C, 0x0F,
-    0x03, 0xD0, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF0, 0x7C, 0x3D, 0x1F, 0x05, 0x00, 0x0B, 0xFD, 0x03,
-    0xEF, 0xC0, 0x00, 0xF8, 0x1A, 0xBE, 0x3F, 0xAF, 0x9F, 0x43, 0xE7, 0xD1, 0xF8, 0xFF, 0xEE, 0x06,
-    0x41, 0x00, 0x06, 0xF9, 0x07, 0xFF, 0xD3, 0xE0, 0xBC, 0xFE, 0xBF, 0x3F, 0xFF, 0xCF, 0x40, 0x02,
-    0xF4, 0x14, 0x3F, 0xFD, 0x01, 0x65, 0x00, 0x06, 0xFD, 0x01, 0xFF, 0xF4, 0x3E, 0x0B, 0xC3, 0xD0,
-    0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x7C, 0x2F, 0x4F, 0xC0, 0xFF, 0xF0, 0x01, 0xA4, 0x00, 0x7C, 0x0B,
-    0x83, 0xF1, 0xF4, 0x0F, 0xBE, 0x00, 0x7F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0x2F, 0x07,
-    0xD0, 0xF8, 0x54, 0x01, 0x40, 0x1B, 0xF8, 0x0F, 0xFF, 0xC0, 0x00, 0xF8, 0x55, 0x6F, 0x7F, 0xFF,
-    0xCF, 0x43, 0xF3, 0xE1, 0xF4, 0x7F, 0xF8, 0x01, 0x90, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-    0x03, 0xEB, 0xF0, 0xFF, 0xFF, 0x3F, 0x07, 0xDF, 0xC0, 0xF7, 0xE0, 0x3D, 0xF8, 0x0F, 0x7E, 0x03,
-    0xDF, 0x80, 0xF5, 0x50, 0x14, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0xF4, 0xB8,
-    0x3E, 0x0B, 0x8F, 0x80, 0xBB, 0xE0, 0x0B, 0xFF, 0x00, 0xBD, 0xF8, 0x0B, 0x83, 0xE0, 0xB8, 0x1F,
-    0x45, 0x40, 0x54, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0x95, 0xB2, 0xF8, 0x7F, 0x4F,
-    0xFF, 0xFF, 0xFD, 0xFC, 0x2F, 0x83, 0xEF, 0x81, 0xF0, 0x3E, 0xF8, 0x1F, 0x03, 0xEF, 0x81, 0xF0,
-    0x3E, 0xF8, 0x1F, 0x03, 0xEF, 0x81, 0xF0, 0x3E, 0x54, 0x05, 0x01, 0x50, 0xB2, 0xFD, 0x3F, 0xFF,
-    0xCF, 0xC1, 0xF7, 0xF0, 0x3D, 0xF8, 0x0F, 0x7E, 0x03, 0xDF, 0x80, 0xF7, 0xE0, 0x3D, 0x54, 0x05,
-    0x00, 0xB5, 0xF8, 0x3F, 0xFF, 0xCF, 0xC1, 0xF7, 0xE0, 0x3D, 0xF8, 0x0F, 0x7F, 0x03, 0xDF, 0xE7,
-    0xF3, 0xFF, 0xF4, 0xF8, 0x60, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x0B, 0xF8, 0x3F, 0xBC,
-    0x7D, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0x7D, 0x24, 0x3D, 0x7F, 0xFC, 0x16, 0x90, 0x06, 0x00,
-    0x3C, 0x02, 0xFF, 0x6F, 0xFD, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x50, 0x3F, 0xE0,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xFF, 0xFE, 0x00,
-    0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x01, 0x55, 0x57, 0xF0, 0xBF, 0xFE, 0x7F, 0x0B,
-    0xFF, 0xE7, 0xF4, 0xBF, 0x55, 0x3F, 0x8B, 0xF0, 0x02, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xF0, 0xE0, 0x00, 0x03, 0xC7, 0x40, 0x01, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xEF, 0x1E, 0x81, 0xFE, 0x3C, 0x74, 0x0F,
-    0xF0, 0xE2, 0xC0, 0x3F, 0xC7, 0x4F, 0x00, 0xFE, 0x2C, 0x38, 0x03, 0xF8, 0xF1, 0xE0, 0x0F, 0xE3,
-    0x87, 0x40, 0x3F, 0xDE, 0x2C, 0x00, 0xBF, 0xF4, 0xF0, 0x01, 0xFF, 0xC3, 0x80, 0x02, 0xFF, 0xEF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x07, 0x5F, 0x50, 0x00, 0x2C, 0x38, 0x00,
-    0x00, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0xFC, 0x0B, 0xFC, 0x01, 0x80, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xC2, 0xE3, 0xE3, 0xF8, 0x3F, 0xBD, 0x3F, 0x83, 0xFF, 0xD3, 0xF8, 0x3F, 0xD0, 0x3F, 0xC3,
-    0xF8, 0x02, 0xFC, 0x3F, 0x80, 0x1F, 0xE3, 0xF8, 0x00, 0xFF, 0x7F, 0x84, 0x07, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xD5, 0x54, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xEA, 0xA9, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0x55, 0x50, 0x3F, 0xC0,
-    0x00, 0x1F, 0xF5, 0x50, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x2F, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xF8, 0x0B, 0xF4, 0x04, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xBF, 0xEA, 0x80, 0xFF,
-    0xFF, 0xF4, 0x2B, 0xFE, 0xA8, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x02, 0xA0, 0xBF, 0x87, 0xFF, 0x90, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0xBF, 0xF4, 0x3F, 0xD3, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0x3F,
-    0xC0, 0x2F, 0xD0, 0x0F, 0xE3, 0xF8, 0x02, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE3,
-    0xF8, 0x03, 0xFC, 0x00, 0xFE, 0x3F, 0x80, 0xBF, 0xC0, 0x0F, 0xE3, 0xF8, 0x0F, 0xFC, 0x00, 0xFE,
-    0x3F, 0x81, 0xFF, 0xC0, 0x0F, 0xE3, 0xF8, 0x3F, 0xFC, 0x00, 0xFE, 0x3F, 0x87, 0xFF, 0xC0, 0x0F,
-    0xE0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x0F, 0x80, 0x7F, 0xC0, 0x3E, 0x01, 0xFF, 0x40, 0xF8, 0x07, 0xFE, 0x03, 0xE0,
-    0x1F, 0xBC, 0x0F, 0x80, 0x7D, 0xF4, 0x3E, 0x0B, 0xFF, 0xFA, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0x9F, 0x5F, 0x80, 0x7D, 0x3D, 0x3E, 0x0F, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x1F, 0x43,
-    0xDF, 0x80, 0x7D, 0x0B, 0xBE, 0x01, 0xF4, 0x1F, 0xF8, 0x07, 0xD0, 0x3F, 0xE0, 0x1F, 0x40, 0xFF,
-    0x80, 0x7D, 0x01, 0xFE, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x2F, 0xC1, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0xBC, 0x00, 0xFE, 0x03, 0xFC, 0x3F, 0x54, 0x3F,
-    0x9B, 0xFE, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xC3, 0xFF, 0xFF, 0x06, 0xFD, 0x50, 0xFF,
-    0xA4, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xF8,
-    0x00, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0xE9, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0x4F, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF9, 0x7F, 0xC0, 0x00, 0x00, 0x3F,
-    0x41, 0xFC, 0x06, 0xFE, 0x03, 0xF4, 0x1F, 0xC2, 0xFF, 0xFC, 0x3F, 0x41, 0xFC, 0x7F, 0xFF, 0x83,
-    0xF4, 0x3F, 0xCB, 0xF0, 0x10, 0x3F, 0xFF, 0xF4, 0xBF, 0x00, 0x03, 0xFF, 0xFD, 0x07, 0xFD, 0x00,
-    0x3F, 0xFF, 0xC0, 0x2F, 0xFD, 0x03, 0xF9, 0xFD, 0x00, 0xBF, 0xF4, 0x3F, 0x4F, 0xF0, 0x00, 0xBF,
-    0xC3, 0xF4, 0xBF, 0x40, 0x02, 0xFC, 0x3F, 0x43, 0xF8, 0x00, 0x1F, 0xC3, 0xF4, 0x2F, 0xCB, 0x97,
-    0xFC, 0x3F, 0x40, 0xFE, 0xBF, 0xFF, 0x43, 0xF4, 0x0F, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x01, 0xFC, 0x03, 0xE1, 0xF8, 0x0B, 0xF0, 0x0F, 0x83, 0xF0, 0x3F, 0xC0, 0x7E,
-    0x0F, 0xC0, 0xFF, 0x41, 0xF4, 0x3F, 0x03, 0xEE, 0x0B, 0xC0, 0xBC, 0x1F, 0xB8, 0x2F, 0x02, 0xF4,
-    0x7D, 0xF0, 0xFC, 0x07, 0xD2, 0xE3, 0xC3, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFC, 0xF4, 0xF9, 0xF4, 0x02, 0xF7, 0xC2, 0xEB, 0xC0, 0x0B, 0xDF, 0x0B, 0xEF, 0x00,
-    0x1F, 0xBC, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x03, 0xFD,
-    0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0xFF, 0xE4, 0x01, 0xFB, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x40, 0x0B, 0xF0, 0x7F, 0xFD, 0x05, 0x0F, 0xD1, 0xFF,
-    0xF4, 0xBE, 0x2F, 0x87, 0xFF, 0xD2, 0xF8, 0xBE, 0x1F, 0xFF, 0x4B, 0xE2, 0xF8, 0x7F, 0xFD, 0x2F,
-    0x8B, 0xE1, 0xFF, 0xF4, 0xBE, 0x2F, 0x87, 0xFF, 0xD2, 0xF8, 0xBE, 0x1F, 0xFF, 0x4B, 0xE2, 0xF8,
-    0x7F, 0xFD, 0x2F, 0x8B, 0xE2, 0xFF, 0xF4, 0xBE, 0x15, 0x4F, 0xEF, 0xD2, 0xF8, 0x00, 0x7F, 0x7F,
-    0x4B, 0xFA, 0xAF, 0xFC, 0xFD, 0x2F, 0xFF, 0xFF, 0xC3, 0xF4, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x15, 0x7F,
-    0xD4, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xE2, 0xFC, 0x07, 0xFF, 0xFB, 0xF0, 0x3F, 0xFF, 0xFF, 0xC1,
-    0xFF, 0x42, 0xFF, 0x0B, 0xF8, 0x03, 0xFC, 0x3F, 0xD0, 0x0B, 0xF0, 0xFF, 0x40, 0x2F, 0xC3, 0xFD,
-    0x00, 0xBF, 0x0B, 0xF8, 0x03, 0xFC, 0x1F, 0xF0, 0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE,
-    0xFF, 0x00, 0x7F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xD0, 0x60, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFF, 0xAA, 0x80, 0x0F,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x04, 0x00, 0x3F, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0B,
-    0xF0, 0x3F, 0x80, 0x7F, 0x40, 0xFE, 0x03, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0x0F, 0xE0, 0xFE, 0x00,
-    0x3F, 0x8B, 0xF0, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFB, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0x94, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x3F, 0x83,
-    0xF8, 0x00, 0xFE, 0x0B, 0xF4, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xE0, 0x2F, 0xD0, 0x3F, 0x80, 0x3F,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF1, 0x57, 0xFD, 0x54, 0x00,
-    0x2F, 0xC5, 0x00, 0x02, 0xFE, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0xFC, 0xF0, 0x0B, 0xFF, 0xFE, 0x00, 0x22, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x76, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x6A, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xE0,
-    0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x3F, 0x80, 0x69, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0xF4, 0x0F, 0xE0, 0x0B, 0xF0, 0xFF,
-    0xFF, 0x03, 0xF4, 0x03, 0xFC, 0xBE, 0x0B, 0xD1, 0xFC, 0x03, 0xFD, 0x3F, 0x01, 0xF4, 0xBF, 0x0B,
-    0xFE, 0x0F, 0xC0, 0xBD, 0x3F, 0xFF, 0xFE, 0x07, 0xF4, 0x7F, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0x87, 0xFF, 0xE4, 0x00, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x4B, 0xE0, 0x07,
-    0xF4, 0x7E, 0x00, 0x7F, 0x4B, 0xE0, 0x03, 0xF8, 0xBE, 0x00, 0x3F, 0xCF, 0xC0, 0x01, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x01, 0x03, 0xFD, 0x00, 0x3C, 0x3F, 0xE0, 0x0B, 0xDB,
-    0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0x3F, 0xC3, 0xD7, 0xD1, 0xFD, 0xBC, 0x38, 0x0F, 0xE0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0,
-    0x07, 0xF4, 0x2F, 0xE0, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC1, 0xFD, 0x02, 0xFC, 0x1B,
-    0xFA, 0xAF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x42, 0xFE, 0x01, 0xFE, 0xAF, 0xF0, 0x07, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1B, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0xF0, 0x70, 0x2F, 0xF1, 0xF0,
-    0x00, 0x3F, 0xD1, 0xF0, 0x00, 0x7F, 0xC1, 0xF0, 0x00, 0x7F, 0x81, 0xF0, 0x00, 0xBF, 0x41, 0xFF,
-    0xFC, 0xBF, 0x41, 0xFF, 0xFC, 0x7F, 0x41, 0xFF, 0xFC, 0x7F, 0x81, 0xF2, 0xFC, 0x3F, 0xC1, 0xF2,
-    0xFC, 0x3F, 0xE1, 0xF2, 0xFC, 0x1F, 0xF9, 0xF2, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xBE, 0x00, 0x00, 0x3F, 0x9F, 0xC0, 0x00, 0x0F, 0xE7, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0xAB,
-    0xFE, 0xBF, 0xEA, 0x00, 0xFD, 0x03, 0xF4, 0x06, 0xBF, 0xAA, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xE5, 0x57, 0xF9, 0x07, 0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x07,
-    0xF4, 0x7F, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x2A, 0xAA, 0xBF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x0B, 0xF8, 0x01, 0xA0, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xF9, 0xF6, 0xC0, 0xBF, 0x87, 0xC0, 0x03, 0xFC, 0x1F, 0x00, 0x1F,
-    0xE0, 0x7C, 0x00, 0x7F, 0x41, 0xF0, 0x02, 0xFD, 0x07, 0xC0, 0x0B, 0xF4, 0x1F, 0x00, 0x1F, 0xD0,
-    0x7C, 0x00, 0x7F, 0x81, 0xF0, 0x00, 0xFF, 0x07, 0xC0, 0x03, 0xFD, 0x1F, 0x00, 0x07, 0xFE, 0x7C,
-    0x64, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xA0, 0x06, 0x40, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xF8,
-    0x00, 0x2F, 0xEA, 0xFF, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0x07,
-    0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0xBF,
-    0x03, 0xF8, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x0F, 0xF0, 0x00,
-    0xBF, 0x03, 0xFF, 0xB8, 0x2F, 0xC0, 0x7F, 0xFE, 0x0B, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x1B, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC2, 0x92, 0xE1, 0xE1, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xCF, 0xD7, 0x7C, 0x3C, 0x3C, 0xFC, 0x3F, 0xC3, 0xC3, 0xEF, 0x80, 0xBF, 0xFE,
-    0xBF, 0xF0, 0x03, 0xEF, 0xFF, 0xF4, 0x00, 0x38, 0x3C, 0x3C, 0x00, 0x03, 0x83, 0xC3, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x55, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x15, 0x7F, 0xD5, 0x50,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x7F,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x80, 0x6B, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF1, 0xB0, 0x00,
-    0x7F, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF6, 0xF0, 0x04, 0x7F, 0xFF,
-    0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0x00, 0xBE, 0xEB, 0xF0, 0x0F, 0xE0, 0x7F, 0x00, 0xFD, 0x07,
-    0xF0, 0x0F, 0xD0, 0x7F, 0x03, 0xFC, 0x07, 0xF0, 0xBF, 0x40, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xF8,
-    0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x38, 0xBC, 0x00, 0x00, 0x00, 0xB0, 0x3D, 0x00, 0x00, 0x00, 0xB4, 0x3E, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0x7E, 0x55, 0x55, 0xBE, 0x00, 0x3E, 0x04, 0x00, 0x0F, 0x00, 0x3E, 0x2E, 0x3C, 0x0F, 0x00,
-    0x3F, 0xFF, 0xFF, 0x1E, 0x00, 0x2F, 0xD3, 0xEB, 0xFC, 0x00, 0x3F, 0x01, 0x81, 0xA0, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xDF, 0xE4, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0xFE, 0x1F, 0xF8, 0x3F, 0xC0, 0xFE, 0x03, 0xFC, 0x7F, 0x40,
-    0xFE, 0x01, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFD, 0xBF, 0x00, 0xFE, 0x00, 0xFE, 0xBF, 0x00, 0xBD,
-    0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00,
-    0xFE, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFD, 0x5B, 0xFD, 0x0F, 0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F,
-    0x43, 0xFD, 0x1B, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x90, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFD,
-    0x54, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
-    0xB5, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xF5, 0xFF, 0xF0, 0x2F, 0xDB, 0x5E, 0xBF, 0x43, 0xFC, 0xB5, 0xE3, 0xFC, 0x7F, 0x8B,
-    0x5E, 0x2F, 0xCB, 0xF4, 0xB5, 0xE2, 0xFD, 0xBF, 0x4B, 0x5E, 0x1F, 0xDB, 0xF4, 0x10, 0x40, 0x54,
-    0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0x42,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0x05, 0x00, 0x03, 0x8F, 0x00, 0x03, 0x8F, 0x00, 0xBF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0x5B, 0xFC, 0xFF, 0x03, 0xFC, 0xFF, 0x03, 0xFC, 0xFF,
-    0x03, 0xFC, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0xFF, 0x07, 0xFC, 0xFF, 0x02,
-    0xFD, 0xFF, 0x01, 0xFD, 0xFF, 0x02, 0xFD, 0xFF, 0x07, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0x40, 0x03, 0x8F, 0x00, 0x03, 0x8F, 0x00, 0x01, 0x05, 0x00, 0x00, 0xBF, 0xE0, 0x0B,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xF4, 0x3F, 0xD0, 0x60, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x14, 0x3F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFC, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF5, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00,
-    0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F,
-    0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_boldBitmaps[31500] = {
+    0x9E, 0xAA, 0xEA, 0x9E, 0xA9, 0xE9, 0x9E, 0x99, 0xE9, 0x9E, 0x90, 0xE9, 0x0E, 0x1E, 0x1E, 0x1E,
+    0x73, 0xAC, 0xA0, 0xAE, 0xAA, 0xEA, 0x9E, 0x91, 0x91, 0x9E, 0x1E, 0x99, 0xE1, 0xE9, 0x9E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0xA1, 0xAD, 0x1A, 0xA9, 0x19, 0xAA, 0x00, 0x5D, 0x91, 0xD9, 0x69,
+    0xD9, 0x09, 0xD9, 0x6A, 0xD1, 0x9D, 0x7A, 0xD1, 0xAD, 0x7E, 0x1E, 0x39, 0xFF, 0xFC, 0xA0, 0xAF,
+    0xFF, 0xCA, 0x09, 0xAA, 0xEA, 0xAF, 0xAA, 0x93, 0xAD, 0x1A, 0xD7, 0xE1, 0xE4, 0x99, 0x9E, 0x99,
+    0xE9, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x3A, 0xD1, 0xAD, 0x7E, 0x1E, 0x7D, 0xA1, 0xDA,
+    0x7D, 0x91, 0xD9, 0x69, 0xD9, 0x09, 0xD9, 0x40, 0x4A, 0xC7, 0x2A, 0xC7, 0x9F, 0xEA, 0x2A, 0xFF,
+    0xD0, 0xAF, 0xFD, 0x90, 0xF0, 0xAC, 0x19, 0xA1, 0xF0, 0xAC, 0x5A, 0xEA, 0xD5, 0x9F, 0xD9, 0x59,
+    0xFE, 0x95, 0xAF, 0xE6, 0xFE, 0x5A, 0xC9, 0xF5, 0xAC, 0x09, 0xE9, 0xCA, 0x91, 0xAC, 0x0A, 0xE0,
+    0xFF, 0xF0, 0xFF, 0xE2, 0x9A, 0xFC, 0xA9, 0x7A, 0xC7, 0x2A, 0xC7, 0x29, 0x95, 0x77, 0x79, 0xF9,
+    0x59, 0xD9, 0x49, 0xFD, 0x5E, 0x5E, 0xAA, 0xDA, 0x3A, 0xD9, 0x5E, 0x1E, 0x3E, 0x6D, 0xA1, 0xE2,
+    0xAD, 0x96, 0xDA, 0x1A, 0xD1, 0x9D, 0xA7, 0xDA, 0x1E, 0x1E, 0x70, 0xE1, 0xE0, 0x9D, 0xA0, 0x9E,
+    0x92, 0xAD, 0xAA, 0xE0, 0xE0, 0xAF, 0xCA, 0x2F, 0xD0, 0x9D, 0x90, 0xEA, 0xE2, 0x9F, 0x90, 0xE0,
+    0x9D, 0x90, 0x9D, 0xA7, 0xAD, 0x90, 0xAD, 0x91, 0xDA, 0x7E, 0x1A, 0xD9, 0x1E, 0x6A, 0xD9, 0x1A,
+    0xD9, 0x1E, 0x59, 0xDA, 0x2A, 0xD9, 0x09, 0xDA, 0x5E, 0x4E, 0x0E, 0x94, 0x9D, 0xA4, 0xAF, 0xD5,
+    0xE6, 0xAF, 0x77, 0x70, 0x77, 0x49, 0xFC, 0xA7, 0x1A, 0xFF, 0x70, 0xFF, 0xCA, 0x69, 0xE2, 0xEA,
+    0x69, 0xE2, 0xEA, 0x69, 0xE9, 0x09, 0xE9, 0x7F, 0xAF, 0x71, 0xFE, 0x71, 0x9F, 0xCA, 0x3A, 0xAA,
+    0xA1, 0xAF, 0xE3, 0xEA, 0x09, 0xFA, 0xF1, 0xAE, 0x90, 0xF9, 0x09, 0xF0, 0xF1, 0xF2, 0x9F, 0xE9,
+    0x1F, 0x39, 0xFC, 0xA2, 0xFA, 0x3F, 0xC9, 0x29, 0xFF, 0xFD, 0x3A, 0xFF, 0xFD, 0x92, 0x9F, 0xDA,
+    0x90, 0x9F, 0x97, 0x71, 0x9E, 0x09, 0xE0, 0x9E, 0x1E, 0x1E, 0x1D, 0xA1, 0xAA, 0x90, 0x2A, 0xD9,
+    0x19, 0xE2, 0xE9, 0x19, 0xE2, 0xE9, 0x2E, 0x29, 0xE2, 0xAD, 0xA2, 0xE9, 0x2E, 0x92, 0xE9, 0x2E,
+    0x92, 0xE9, 0x2E, 0x92, 0xAD, 0xA2, 0xAE, 0x3E, 0x3E, 0x92, 0xAE, 0x3E, 0x39, 0xE3, 0xAD, 0x90,
+    0x0E, 0x49, 0xE4, 0xE9, 0x39, 0xE4, 0xE9, 0x3A, 0xDA, 0x39, 0xE4, 0xE4, 0xE9, 0x3E, 0x93, 0xE9,
+    0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x92, 0x9E, 0x3A, 0xD9, 0x29, 0xE3,
+    0xE3, 0x4E, 0x97, 0x0A, 0xD7, 0x1A, 0xD5, 0xA9, 0x19, 0xD2, 0xA9, 0x0F, 0xEA, 0xEA, 0x0F, 0xFE,
+    0xA0, 0x99, 0xAA, 0xFA, 0x99, 0x93, 0xFC, 0x95, 0xAD, 0xAE, 0x49, 0xE0, 0x9E, 0x39, 0xDA, 0x1D,
+    0xA5, 0x92, 0x93, 0x4D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xDA, 0x4F, 0xFF, 0x0F,
+    0xFF, 0x09, 0xAA, 0xAA, 0xEA, 0xAA, 0xA5, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x77, 0x10,
+    0x1E, 0x91, 0xE9, 0x09, 0xE1, 0xAD, 0xA1, 0xE2, 0xE7, 0x09, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x9F,
+    0xD9, 0x9F, 0xD0, 0x0A, 0xCA, 0x0A, 0xEA, 0xAE, 0xA9, 0xE9, 0x19, 0x10, 0x59, 0xE6, 0xAD, 0xA6,
+    0xE9, 0x59, 0xE6, 0xEA, 0x6E, 0x6A, 0xE6, 0xEA, 0x59, 0xE6, 0xAE, 0x6E, 0x95, 0x9E, 0x6E, 0xA6,
+    0xE9, 0x59, 0xE6, 0xEA, 0x6E, 0x6A, 0xE7, 0x71, 0x77, 0x1A, 0xFA, 0x6F, 0xF4, 0xFF, 0xD2, 0x9E,
+    0xA1, 0xAE, 0x91, 0xAE, 0x3F, 0x1F, 0x3A, 0xE1, 0xF3, 0xAE, 0x1E, 0xA3, 0x9E, 0x90, 0xEA, 0x39,
+    0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0F, 0x39, 0xE1, 0xF3, 0xAE, 0x1A, 0xE3, 0xF2,
+    0xEA, 0x19, 0xEA, 0x2F, 0xFD, 0x4F, 0xF9, 0x5A, 0xFC, 0x97, 0x70, 0x49, 0xE9, 0x39, 0xF9, 0x2A,
+    0xFC, 0x91, 0xFE, 0x90, 0xFA, 0xE9, 0x0E, 0x09, 0xE9, 0x1A, 0x19, 0xE9, 0x49, 0xE9, 0x49, 0xE9,
+    0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9, 0x49, 0xE9,
+    0x49, 0xE9, 0x77, 0x09, 0xAF, 0xC9, 0x4A, 0xFF, 0xA2, 0xFF, 0xE9, 0x2E, 0x91, 0xAF, 0x29, 0xA4,
+    0xF7, 0x1F, 0x71, 0xEA, 0x70, 0xAE, 0x97, 0x9E, 0xA7, 0x9F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F,
+    0x70, 0xF7, 0x0F, 0xFF, 0x90, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0x77, 0x0A, 0xFC, 0xA9, 0x3A, 0xFF,
+    0xCA, 0x29, 0xFF, 0xD9, 0x2D, 0x92, 0xAE, 0xA7, 0x1F, 0x71, 0xEA, 0x70, 0xAE, 0x5A, 0xAA, 0xF9,
+    0x49, 0xFC, 0xA6, 0x9F, 0xEA, 0x59, 0x99, 0xAF, 0xA7, 0x1F, 0x71, 0xAE, 0x97, 0x0F, 0x1A, 0x94,
+    0x9F, 0x1F, 0xFE, 0xA1, 0xFF, 0xDA, 0x29, 0xFF, 0x97, 0x70, 0x7E, 0xA7, 0x0A, 0xEA, 0x79, 0xFA,
+    0x7F, 0xCA, 0x6A, 0xFC, 0xA5, 0x9D, 0xAE, 0xA5, 0xE0, 0xEA, 0x4A, 0xD9, 0x0E, 0xA3, 0x9D, 0xA1,
+    0xEA, 0x3E, 0x2E, 0xA2, 0xE9, 0x2E, 0xA1, 0x9E, 0xAA, 0xAA, 0xFA, 0xAA, 0xFF, 0xFC, 0xAF, 0xFF,
+    0xC0, 0x99, 0x99, 0x99, 0x9F, 0x99, 0x7E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA1, 0x0A, 0xFF, 0xC2, 0xFF,
+    0xD2, 0xFF, 0xD2, 0xEA, 0x99, 0x99, 0x99, 0x2E, 0x97, 0x0E, 0x97, 0x0E, 0x99, 0x99, 0x49, 0xFF,
+    0xA2, 0x9F, 0xFD, 0x2A, 0xDA, 0xAF, 0xCA, 0x79, 0xF7, 0x0F, 0x70, 0xAE, 0x70, 0xF0, 0xA9, 0x4A,
+    0xEA, 0x0F, 0xFE, 0x1F, 0xFD, 0x91, 0x9F, 0xEA, 0x77, 0x00, 0x77, 0x3A, 0xFC, 0x5A, 0xFE, 0x4F,
+    0xFC, 0x3A, 0xEA, 0x97, 0xEA, 0x70, 0x9E, 0x71, 0xAD, 0xA0, 0x9A, 0xA9, 0x4E, 0x9A, 0xFC, 0xA2,
+    0xFF, 0xEA, 0x1F, 0xC9, 0x9A, 0xF1, 0xF3, 0xAE, 0x90, 0xEA, 0x4E, 0x90, 0xEA, 0x4E, 0x90, 0xAE,
+    0x39, 0xE9, 0x09, 0xEA, 0x2F, 0x2F, 0xFD, 0xA3, 0xFF, 0xC5, 0xAF, 0xCA, 0x77, 0x00, 0x9F, 0xFF,
+    0x99, 0xFF, 0xF9, 0x9F, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x1E, 0xA7, 0x0A, 0xE7, 0x1E,
+    0xA7, 0x09, 0xE9, 0x70, 0xF7, 0x09, 0xE9, 0x70, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x71, 0xEA, 0x70,
+    0xAE, 0x71, 0xF7, 0x0A, 0xE9, 0x70, 0xF6, 0x77, 0x1A, 0xFC, 0x94, 0x9F, 0xFA, 0x3F, 0xCA, 0xF9,
+    0x1A, 0xE9, 0x2F, 0x1A, 0xE3, 0xAE, 0x19, 0xE9, 0x2E, 0xA2, 0xF9, 0x0F, 0x4F, 0xF9, 0x5F, 0xD6,
+    0xFF, 0x4F, 0x9A, 0xF9, 0x1A, 0xE3, 0xF1, 0xEA, 0x39, 0xE9, 0x0E, 0x94, 0xE9, 0x0F, 0x3A, 0xE9,
+    0x0A, 0xFA, 0xAF, 0xC2, 0xFF, 0xD4, 0xAF, 0xDA, 0x77, 0x00, 0x77, 0x1A, 0xFA, 0x59, 0xFF, 0x39,
+    0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x1E, 0xA3, 0xF1, 0xE9, 0x39, 0xE1, 0xE9, 0x39, 0xE9, 0x0E, 0xA3,
+    0xAE, 0x90, 0xF9, 0x1A, 0xF9, 0x09, 0xFF, 0xE9, 0x1A, 0xFD, 0x9E, 0x39, 0xAD, 0xA0, 0x9E, 0x71,
+    0xAE, 0x71, 0xE9, 0x79, 0xF3, 0xCA, 0xAF, 0xD9, 0x3F, 0xF9, 0x4F, 0xDA, 0x77, 0x20, 0x0A, 0xCA,
+    0x0A, 0xEA, 0xAE, 0xA9, 0xE9, 0x19, 0x77, 0x73, 0xAC, 0xA0, 0xAE, 0xAA, 0xEA, 0x9E, 0x91, 0x91,
+    0x1A, 0xCA, 0x19, 0xEA, 0x0A, 0xEA, 0x1E, 0x97, 0x77, 0x77, 0x3E, 0x91, 0xE9, 0x09, 0xE1, 0xAD,
+    0xA1, 0xE2, 0xE7, 0x72, 0x97, 0x19, 0xD7, 0x9F, 0x59, 0xFC, 0xA3, 0x9F, 0xCA, 0x39, 0xFC, 0x94,
+    0xAF, 0x96, 0xFA, 0x79, 0xFC, 0xA9, 0x7A, 0xFC, 0xA7, 0xAF, 0xCA, 0x79, 0xF7, 0x19, 0xD7, 0x50,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x77, 0x72, 0xAF, 0xFE, 0x0F, 0xFF,
+    0x0F, 0xFF, 0x00, 0x97, 0x3D, 0x97, 0x1F, 0x97, 0x9F, 0xC9, 0x79, 0xFC, 0x97, 0x9F, 0xC9, 0x79,
+    0xAF, 0x79, 0xF5, 0xAF, 0xC9, 0x29, 0xFD, 0x92, 0xAF, 0xCA, 0x94, 0xFA, 0x7D, 0x97, 0x19, 0x73,
+    0x75, 0xAF, 0xCA, 0x2A, 0xFF, 0xC9, 0x09, 0xFF, 0xD1, 0xCA, 0x92, 0xAE, 0x97, 0xE9, 0x69, 0xE9,
+    0x6F, 0x59, 0xF5, 0x9F, 0x6E, 0xA6, 0x9E, 0x79, 0xDA, 0x77, 0x77, 0x0A, 0xC9, 0x7F, 0x7F, 0x96,
+    0xAE, 0x71, 0x95, 0x6A, 0xAF, 0xA9, 0x72, 0xAF, 0xFD, 0x96, 0x9F, 0xA9, 0x99, 0x9A, 0xEA, 0x49,
+    0xE9, 0x7E, 0xA3, 0xE4, 0x99, 0x92, 0xE9, 0x1A, 0xD9, 0x19, 0xFE, 0x1D, 0xA1, 0xE1, 0xAF, 0xF1,
+    0xAD, 0x09, 0xD9, 0x09, 0xE2, 0xE1, 0x9D, 0x0A, 0xD1, 0xAD, 0x92, 0xE1, 0x9D, 0x9E, 0x1E, 0x3E,
+    0x19, 0xD9, 0xE1, 0xE3, 0xE1, 0xAD, 0x0E, 0x1E, 0x29, 0xE1, 0xE0, 0xAD, 0x1A, 0xDA, 0x1F, 0x09,
+    0xDA, 0x0A, 0xD9, 0x1F, 0xFF, 0xC2, 0xE2, 0xFA, 0x09, 0xEA, 0x3E, 0x97, 0x71, 0xEA, 0x70, 0x96,
+    0x9F, 0xA9, 0x99, 0x9A, 0xE7, 0x0F, 0xFF, 0x72, 0xAF, 0xDA, 0x95, 0x5F, 0xC7, 0x4F, 0xC9, 0x72,
+    0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E,
+    0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F,
+    0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9,
+    0x7F, 0x00, 0xAF, 0xEA, 0x93, 0xFF, 0xEA, 0x1F, 0xFF, 0x90, 0xF2, 0x9F, 0xC0, 0xF4, 0xF0, 0xF4,
+    0xF0, 0xF3, 0xAE, 0xA0, 0xFA, 0xAA, 0xFA, 0x1F, 0xFD, 0xA2, 0xFF, 0xF1, 0xF2, 0x9A, 0xF0, 0xF4,
+    0xF0, 0xF4, 0xAE, 0x9F, 0x4F, 0x9F, 0x3A, 0xF0, 0xFF, 0xFA, 0x0F, 0xFE, 0xA1, 0xFF, 0xCA, 0x92,
+    0x77, 0x39, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9F, 0xFD, 0xA2, 0xFC, 0x92, 0xAC, 0x91, 0xAE, 0xA7,
+    0x1F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x19, 0xEA,
+    0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFA, 0x4A, 0x92, 0xFF, 0xEA, 0x3A, 0xFF, 0xCA, 0x49, 0xFE, 0xA7,
+    0x70, 0xAF, 0xEA, 0x94, 0xFF, 0xE9, 0x2F, 0xFF, 0xA1, 0xF9, 0x99, 0x9F, 0xCA, 0x0F, 0x4A, 0xF0,
+    0xF5, 0xF9, 0xF5, 0x9E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x59, 0xEA, 0xF5, 0xF9, 0xF4,
+    0xAF, 0x0F, 0x29, 0xFC, 0x90, 0xFF, 0xFA, 0x1F, 0xFE, 0x92, 0xFF, 0xA9, 0x40, 0xAF, 0xFC, 0x9F,
+    0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD,
+    0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0xAF,
+    0xFC, 0x9F, 0xFD, 0x9F, 0xFD, 0x9F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F,
+    0xFD, 0x0F, 0xFD, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x60, 0x77, 0x49, 0xAF, 0xDA, 0x5F,
+    0xFE, 0x3F, 0xFE, 0x92, 0xFC, 0xA3, 0x9C, 0x2A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xEA, 0x72,
+    0xAE, 0x92, 0xFE, 0x0A, 0xE9, 0x2F, 0xE0, 0x9E, 0x92, 0xFE, 0x09, 0xEA, 0x5A, 0xE1, 0xF5, 0xAE,
+    0x1F, 0xA4, 0xAE, 0x19, 0xFA, 0x3A, 0xE2, 0xAF, 0xFF, 0x3A, 0xFF, 0xE4, 0x9F, 0xFA, 0x97, 0x70,
+    0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x99, 0x99, 0x99, 0x9F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xF0, 0x0F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x3A, 0xE4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF3, 0xAE, 0xA0, 0xFE, 0x90,
+    0xFD, 0xA1, 0xFC, 0x97, 0x30, 0xAE, 0x5F, 0x0F, 0x4A, 0xE9, 0x0F, 0x3A, 0xEA, 0x1F, 0x29, 0xF2,
+    0xF2, 0xF3, 0xF1, 0xF9, 0x3F, 0x0A, 0xEA, 0x4F, 0x9E, 0xA5, 0xFF, 0xA5, 0xFF, 0xC5, 0xFC, 0xAF,
+    0x4F, 0x90, 0xAE, 0xA3, 0xF2, 0xF3, 0xF2, 0xAF, 0x2F, 0x3F, 0x91, 0xF3, 0x9F, 0x1F, 0x4A, 0xEA,
+    0x0F, 0x5F, 0x90, 0xAE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x00, 0xAF, 0x97, 0xFC, 0x9F, 0xD6, 0x9F, 0xC9,
+    0xFD, 0x6A, 0xFC, 0x9F, 0xD9, 0x5F, 0xD9, 0xFD, 0xA4, 0x9F, 0xD9, 0xEA, 0xE4, 0xAD, 0x9E, 0x9E,
+    0xAA, 0xD9, 0x3E, 0x0E, 0x9E, 0xA9, 0xDA, 0x3D, 0xA0, 0xE9, 0xEA, 0x0E, 0x2A, 0xD9, 0x0E, 0x9E,
+    0xA0, 0xE9, 0x1E, 0x1E, 0x9E, 0xA0, 0xAD, 0xA1, 0xDA, 0x1E, 0x9E, 0xA1, 0xE0, 0xAD, 0x91, 0xE9,
+    0xEA, 0x1E, 0x0E, 0x2E, 0x9E, 0xA1, 0xAD, 0xAE, 0x2E, 0x9E, 0xA1, 0x9F, 0xC9, 0x2E, 0x9E, 0xA2,
+    0xFC, 0x3E, 0x9E, 0xA2, 0xAF, 0x3E, 0x9E, 0xA2, 0x9E, 0x93, 0xE9, 0xAF, 0x69, 0xE0, 0xFD, 0x59,
+    0xE0, 0xFD, 0x94, 0x9E, 0x0F, 0xE4, 0x9E, 0x0F, 0xEA, 0x39, 0xE0, 0xE9, 0xF3, 0x9E, 0x0E, 0xA9,
+    0xEA, 0x29, 0xE0, 0xEA, 0x0F, 0x91, 0x9E, 0x0E, 0xA1, 0xF1, 0x9E, 0x0E, 0xA1, 0xAE, 0x90, 0x9E,
+    0x0E, 0xA2, 0xF0, 0x9E, 0x0E, 0xA2, 0x9E, 0xA0, 0xE0, 0xEA, 0x3F, 0x9E, 0x0E, 0xA3, 0x9F, 0xE0,
+    0xEA, 0x4A, 0xFD, 0x0E, 0xA5, 0xFD, 0x0E, 0xA5, 0xAF, 0xC0, 0xEA, 0x6F, 0xC0, 0x77, 0x6A, 0xFD,
+    0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F,
+    0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A,
+    0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94,
+    0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0xAF, 0xDA, 0xA3, 0xFF, 0xDA, 0x1F, 0xFE, 0xA0, 0xF9,
+    0x99, 0xAF, 0x0F, 0x3A, 0xE9, 0xF3, 0x9E, 0x9F, 0x39, 0xE9, 0xF3, 0xF0, 0xF9, 0x9A, 0xFC, 0x0F,
+    0xFE, 0x90, 0xFF, 0xD9, 0x1F, 0xAA, 0xAA, 0x93, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F,
+    0x70, 0x77, 0x6A, 0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA,
+    0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97,
+    0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A,
+    0xF3, 0xAF, 0xFF, 0xA4, 0xAF, 0xFD, 0xA6, 0x9A, 0xFE, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x5F, 0xA7,
+    0x5F, 0xA7, 0x59, 0x99, 0x90, 0xAF, 0xDA, 0xA5, 0xFF, 0xDA, 0x3F, 0xFF, 0x2F, 0x29, 0xF9, 0x1F,
+    0x3A, 0xEA, 0x1F, 0x39, 0xEA, 0x1F, 0x39, 0xE9, 0x1F, 0x3F, 0x2F, 0xFE, 0x92, 0xFF, 0xD9, 0x3F,
+    0xFC, 0xA4, 0xF1, 0xAE, 0x4F, 0x2F, 0x3F, 0x2A, 0xEA, 0x2F, 0x3F, 0x2F, 0x39, 0xF1, 0xF4, 0xF9,
+    0x0F, 0x5F, 0x00, 0x76, 0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0xA0, 0xFF, 0xD0, 0x9E, 0xA2, 0x9A, 0xA0,
+    0xAE, 0x7A, 0xE7, 0x9F, 0x96, 0xFD, 0x95, 0xFD, 0xA5, 0xAF, 0xD9, 0x49, 0xFD, 0x69, 0xFA, 0x7E,
+    0xA7, 0xFD, 0x93, 0xAE, 0xAF, 0xFE, 0x0F, 0xFD, 0x90, 0x9A, 0xFD, 0xA7, 0x60, 0x9F, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE4, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9,
+    0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F, 0xE9, 0x77, 0x10, 0xAE, 0x7A, 0xE0, 0xAE, 0x96,
+    0xF1, 0xEA, 0x59, 0xE9, 0x1F, 0x5A, 0xE2, 0xAE, 0x5F, 0x3E, 0xA3, 0x9E, 0x93, 0xF3, 0xAE, 0x4A,
+    0xE3, 0xF5, 0xE9, 0x2E, 0x95, 0xF1, 0xAE, 0x69, 0xE1, 0xEA, 0x7E, 0x90, 0xE9, 0x7E, 0xA9, 0xE7,
+    0x09, 0xEA, 0xDA, 0x71, 0xFD, 0x97, 0x1F, 0xD7, 0x29, 0xFA, 0x73, 0xF9, 0x50, 0xEA, 0x5A, 0xE5,
+    0xAE, 0x0A, 0xE5, 0xF5, 0xF0, 0x9E, 0x93, 0x9F, 0x94, 0xEA, 0x1E, 0xA3, 0xAF, 0xA3, 0x9E, 0x91,
+    0xEA, 0x3F, 0xD3, 0xAE, 0x2A, 0xE3, 0xEA, 0xD9, 0x2F, 0x29, 0xE2, 0x9D, 0xAA, 0xDA, 0x2E, 0xA3,
+    0xE9, 0x1A, 0xDA, 0x9E, 0x19, 0xE9, 0x3E, 0xA1, 0xE9, 0x0E, 0x1A, 0xE4, 0xAE, 0x1E, 0x1E, 0x90,
+    0xAE, 0x49, 0xE0, 0x9E, 0x1A, 0xDA, 0x0E, 0xA5, 0xE9, 0xAD, 0xA1, 0x9E, 0x0E, 0x95, 0xEA, 0xE9,
+    0x2E, 0x9E, 0x6A, 0xDA, 0xE3, 0xEA, 0xE6, 0x9F, 0xD3, 0xAF, 0xCA, 0x7F, 0xC9, 0x39, 0xFC, 0x97,
+    0xFC, 0x5F, 0xC7, 0x0A, 0xF5, 0xFC, 0x40, 0x9F, 0x59, 0xF1, 0xAE, 0x94, 0xF9, 0x2F, 0x39, 0xEA,
+    0x39, 0xEA, 0x2F, 0x5F, 0x90, 0xAE, 0x96, 0xF9, 0xF7, 0x9F, 0xE7, 0x1F, 0xDA, 0x72, 0xFC, 0x72,
+    0x9F, 0xC7, 0x2F, 0xDA, 0x70, 0xAF, 0xE9, 0x69, 0xEA, 0x0F, 0x6F, 0x1A, 0xEA, 0x4A, 0xE9, 0x2F,
+    0x92, 0x9F, 0x39, 0xF2, 0xF9, 0x4A, 0xEA, 0x0A, 0xEA, 0x6F, 0x90, 0xAE, 0x95, 0xAE, 0x99, 0xF5,
+    0xF1, 0xAE, 0x93, 0xAE, 0x92, 0xF3, 0xF3, 0xAE, 0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7,
+    0xFE, 0xA7, 0xAF, 0xD7, 0x1F, 0xCA, 0x71, 0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF5, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x0F, 0xFF, 0xA0, 0x99, 0x99, 0x99, 0x99, 0xF7,
+    0x0A, 0xE9, 0x79, 0xEA, 0x70, 0xF7, 0x0F, 0x70, 0x9E, 0xA7, 0x0F, 0x70, 0xF7, 0x0A, 0xE9, 0x79,
+    0xEA, 0x70, 0xF7, 0x0A, 0xE9, 0x79, 0xFF, 0xFC, 0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x0F, 0xCA, 0x9F,
+    0xCA, 0x9E, 0xAA, 0x99, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29,
+    0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xEA, 0xA9, 0x9F, 0xCA,
+    0x0F, 0xCA, 0xAD, 0xA6, 0x9E, 0x7E, 0x96, 0xAE, 0x7E, 0x7E, 0xA6, 0x9E, 0x7E, 0x96, 0xAD, 0xA6,
+    0x9E, 0x7E, 0x96, 0xAE, 0x69, 0xE7, 0xEA, 0x6A, 0xE7, 0xE7, 0xEA, 0x69, 0xE7, 0x30, 0x9F, 0xC9,
+    0x9F, 0xCA, 0x9A, 0xAE, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD,
+    0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD,
+    0xA2, 0xAD, 0xA2, 0xAD, 0xA0, 0xAA, 0xEA, 0x9F, 0xCA, 0x9F, 0xCA, 0x49, 0xD7, 0x2A, 0xD9, 0x71,
+    0xF7, 0x0A, 0xF9, 0x7D, 0xAE, 0x6A, 0xD0, 0x9D, 0xA5, 0xDA, 0x1E, 0x4A, 0xD9, 0x19, 0xDA, 0x3E,
+    0x3E, 0x29, 0xD9, 0x39, 0xDA, 0x1E, 0x5E, 0x1A, 0xA9, 0x6A, 0xA9, 0x0F, 0xFD, 0x1F, 0xFD, 0x90,
+    0x7A, 0xEA, 0x39, 0xE9, 0x39, 0xE9, 0x4A, 0xD0, 0x29, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2,
+    0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3,
+    0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x0E,
+    0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA0, 0xAE, 0x93, 0xEA, 0xFE, 0x2F,
+    0xFE, 0xA1, 0xFA, 0x19, 0xF1, 0xF3, 0xAE, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA4, 0xEA, 0x0E, 0xA4,
+    0xEA, 0x0E, 0xA3, 0x9E, 0xA0, 0xF3, 0xAE, 0x90, 0xF9, 0x2F, 0x1F, 0xFE, 0xA1, 0xEA, 0xFE, 0x2E,
+    0x09, 0xFC, 0x77, 0x00, 0x3A, 0xFA, 0x92, 0xAF, 0xF1, 0x9F, 0xFA, 0x1F, 0xA1, 0x9A, 0x19, 0xEA,
+    0x6A, 0xE7, 0xF7, 0xF7, 0xF7, 0xAE, 0x96, 0x9F, 0x39, 0xA1, 0xFF, 0xD2, 0xFF, 0xC3, 0xAF, 0xD9,
+    0x74, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF2, 0xAE, 0x90, 0xF1, 0xFD, 0xAA, 0xE0, 0xFF,
+    0xF9, 0xF9, 0x09, 0xFC, 0xAE, 0xA3, 0xFA, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAE, 0xAE,
+    0x93, 0xF9, 0xF2, 0x9F, 0x0F, 0xFF, 0x09, 0xFE, 0xAE, 0x19, 0xFC, 0x1E, 0x74, 0x3A, 0xEA, 0x94,
+    0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF,
+    0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE,
+    0xA7, 0x50, 0x76, 0xAF, 0xCA, 0x2A, 0xFD, 0x92, 0xFE, 0x29, 0xEA, 0x59, 0xE9, 0x5A, 0xFA, 0xA9,
+    0x09, 0xFF, 0xA0, 0xAF, 0xFA, 0x2A, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59,
+    0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x30, 0x2A, 0xE9, 0x1A, 0xAA,
+    0x1F, 0xEA, 0xE0, 0xFF, 0xF0, 0xF9, 0x1A, 0xFA, 0xEA, 0x3F, 0xAE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A,
+    0xFE, 0x4A, 0xEA, 0xE9, 0x3F, 0x9F, 0x29, 0xF0, 0xFC, 0xAF, 0xD0, 0x9F, 0xFE, 0x19, 0xFC, 0x0F,
+    0x70, 0xF7, 0x0F, 0x0C, 0x94, 0xFA, 0x0F, 0xFE, 0x1F, 0xFD, 0x91, 0x9A, 0xFD, 0x92, 0x0E, 0xA7,
+    0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA0, 0x9E, 0xA3, 0xEA, 0xFE, 0x91, 0xFF,
+    0xF1, 0xFC, 0x90, 0x9F, 0x90, 0xF3, 0xAE, 0x90, 0xF3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3,
+    0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90,
+    0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0x5A, 0xD9, 0x9F, 0x0E, 0xA0, 0x9A, 0xA6, 0xAA, 0xA9,
+    0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E,
+    0xA0, 0xEA, 0x0E, 0xA0, 0x73, 0xAD, 0x92, 0x9F, 0x3E, 0xA3, 0x9A, 0xA7, 0x4A, 0xAA, 0x93, 0xEA,
+    0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E,
+    0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x2A, 0xE9, 0x9F, 0xD0, 0x9F, 0xCA, 0x1F, 0x91, 0x0E, 0xA7, 0x2E,
+    0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA4, 0xAA, 0xAA, 0x1E, 0xA3, 0xF2, 0xEA, 0x2F,
+    0x3E, 0xA1, 0xF9, 0x3E, 0xA0, 0xF9, 0x4E, 0xAA, 0xE9, 0x5F, 0xF6, 0xFF, 0xA5, 0xFF, 0xC9, 0x4F,
+    0x1F, 0x4E, 0xA1, 0x9F, 0x3E, 0xA2, 0xAE, 0xA2, 0xEA, 0x3F, 0x91, 0xEA, 0x4F, 0x00, 0x0E, 0xA0,
+    0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA,
+    0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0x0A, 0xAA, 0x1A, 0xEA, 0x29,
+    0xAD, 0xA9, 0x2E, 0x9F, 0xE0, 0xAF, 0xDA, 0x1F, 0xFF, 0xFF, 0x1F, 0xC1, 0xAF, 0xC9, 0x1F, 0x90,
+    0xF3, 0xFA, 0x29, 0xEA, 0x0F, 0x3A, 0xE9, 0x3E, 0xA0, 0xEA, 0x3A, 0xE4, 0xEA, 0x0E, 0xA3, 0xAE,
+    0x4E, 0xA0, 0xEA, 0x3A, 0xE4, 0xEA, 0x0E, 0xA3, 0xAE, 0x4E, 0xA0, 0xEA, 0x3A, 0xE4, 0xEA, 0x0E,
+    0xA3, 0xAE, 0x4E, 0xA0, 0xEA, 0x3A, 0xE4, 0xEA, 0x0E, 0xA3, 0xAE, 0x4E, 0xA0, 0x0A, 0xAA, 0x19,
+    0xEA, 0x3E, 0x0F, 0xE9, 0x1F, 0xFF, 0x1F, 0xC9, 0x09, 0xF9, 0x0F, 0x3A, 0xE9, 0x0F, 0x39, 0xE9,
+    0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3,
+    0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x3A, 0xEA, 0x95, 0xAF,
+    0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F,
+    0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC,
+    0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x0A, 0xAA, 0x1A, 0xE9, 0x3E, 0x9F, 0xE2, 0xFF, 0xEA, 0x1F, 0xA1,
+    0x9F, 0x1F, 0x3A, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x4E, 0xA0, 0xEA, 0x4E, 0xA0, 0xEA, 0x39,
+    0xEA, 0x0F, 0x3A, 0xE9, 0x0F, 0x92, 0xF1, 0xFF, 0xEA, 0x1F, 0xFE, 0x2E, 0xA9, 0xFC, 0x3E, 0xA7,
+    0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x00, 0x2A, 0xE9, 0x1A, 0xAA, 0x1F,
+    0xEA, 0xE0, 0xFF, 0xF0, 0xF9, 0x1A, 0xFA, 0xEA, 0x3F, 0xAE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE,
+    0x4A, 0xEA, 0xE9, 0x3F, 0x9F, 0x29, 0xF0, 0xFC, 0xAF, 0xD0, 0x9F, 0xFE, 0x19, 0xFC, 0x0F, 0x70,
+    0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x0A, 0xAA, 0x19, 0xDA, 0x0E, 0x0A, 0xEA, 0x0E,
+    0xAF, 0xA0, 0xFD, 0xAA, 0x90, 0xFA, 0x4F, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA,
+    0x5E, 0xA5, 0xEA, 0x40, 0x19, 0xAE, 0xA9, 0x2F, 0xFC, 0x0A, 0xFF, 0xC0, 0xF3, 0x99, 0x0F, 0x95,
+    0xAF, 0xC9, 0x4F, 0xE9, 0x3A, 0xFD, 0xA4, 0x9F, 0xC9, 0x59, 0xE9, 0x95, 0xE9, 0xEA, 0xAA, 0xF0,
+    0xFF, 0xCA, 0x09, 0xFE, 0x97, 0x40, 0x3A, 0xA7, 0xAD, 0x7E, 0x6A, 0xEA, 0xAA, 0xA1, 0xFF, 0xC0,
+    0x9F, 0xFC, 0x2A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x95, 0x9F,
+    0xE3, 0xFE, 0x4F, 0xD7, 0x30, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39,
+    0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E,
+    0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09,
+    0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A, 0xD9, 0x75, 0xAA, 0xAA, 0x5A, 0xAA, 0xA0, 0xAE, 0x94, 0xF1,
+    0xEA, 0x39, 0xE9, 0x1F, 0x3A, 0xE2, 0x9E, 0x92, 0xEA, 0x3E, 0xA1, 0x9E, 0x93, 0xAE, 0x1A, 0xE4,
+    0x9E, 0x1E, 0xA5, 0xEA, 0x9E, 0x6A, 0xEA, 0xE7, 0xFD, 0x97, 0xFD, 0x70, 0x9F, 0xA7, 0x1F, 0x94,
+    0x9A, 0xAA, 0x39, 0xAA, 0xAA, 0x39, 0xAA, 0xA0, 0x9E, 0x92, 0xAF, 0x3F, 0x1E, 0xA2, 0xFC, 0x92,
+    0xEA, 0x1F, 0x2F, 0xCA, 0x19, 0xE2, 0xAE, 0x19, 0xD9, 0xE1, 0xAE, 0x29, 0xE9, 0x0A, 0xD0, 0xAD,
+    0x1E, 0xA3, 0xEA, 0x0E, 0x09, 0xD9, 0x0E, 0x93, 0xAE, 0x0D, 0xA0, 0x9D, 0xA9, 0xE4, 0x9E, 0x9D,
+    0x91, 0xDA, 0xAE, 0x5E, 0xAD, 0x2E, 0xAD, 0xA5, 0xFD, 0x2A, 0xFC, 0x6A, 0xFA, 0x29, 0xFC, 0x69,
+    0xF9, 0x3F, 0xA7, 0xF4, 0xF9, 0x30, 0x9A, 0xAA, 0xA4, 0xAA, 0xAA, 0x1F, 0x92, 0xF9, 0x2F, 0x19,
+    0xEA, 0x3A, 0xE9, 0x0F, 0x5F, 0xAE, 0x95, 0x9F, 0xDA, 0x7A, 0xFC, 0x70, 0xAF, 0xC7, 0x0F, 0xDA,
+    0x6F, 0xF9, 0x4A, 0xEA, 0x0F, 0x4F, 0x19, 0xEA, 0x2F, 0x92, 0xF9, 0x0A, 0xEA, 0x4F, 0x00, 0xAA,
+    0xAA, 0x59, 0xAA, 0xA0, 0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE, 0x29, 0xE9, 0x2E,
+    0xA3, 0xEA, 0x19, 0xE9, 0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E, 0x69, 0xEA, 0xE7,
+    0xFD, 0x97, 0xAF, 0xC7, 0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x70, 0x9F, 0x7F, 0xDA,
+    0x7F, 0xCA, 0x70, 0xF9, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD9, 0x0F, 0xFD, 0x95,
+    0x9F, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0xFD, 0x99, 0xFF,
+    0xDA, 0x9F, 0xFD, 0xA0, 0x49, 0xAC, 0xA3, 0xFC, 0x29, 0xFC, 0x29, 0xE4, 0xAD, 0xA4, 0xAD, 0xA4,
+    0xAD, 0xA4, 0xAD, 0xA4, 0xEA, 0x19, 0x9F, 0x91, 0xAF, 0x92, 0xAE, 0xA9, 0x29, 0xAF, 0x94, 0xEA,
+    0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x49, 0xE4, 0x9F, 0xA3, 0xFC, 0x4A, 0xE0, 0x9D,
+    0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9A, 0xA0, 0xDA, 0x94, 0xFC, 0x3F, 0xC4, 0x9E, 0x94, 0xE9, 0x4E, 0x94, 0xE9,
+    0x4E, 0x94, 0xEA, 0x4A, 0xEA, 0x93, 0xAF, 0x92, 0x9F, 0x91, 0xAF, 0xA9, 0x1E, 0xA4, 0xE9, 0x4E,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x2F, 0xC3, 0xFC, 0x3E, 0xA4, 0x0A, 0xEA, 0x49, 0x0F, 0xEA, 0xA9,
+    0xAC, 0x0F, 0xFF, 0x0C, 0x39, 0xFC, 0xA7, 0x50, 0x09, 0xA9, 0x09, 0xEA, 0xAE, 0xA9, 0xE9, 0x09,
+    0x99, 0x69, 0x99, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x99, 0xE9, 0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xEA,
+    0xAE, 0xA9, 0xAA, 0xA9, 0x77, 0x1D, 0x71, 0xD6, 0x9A, 0xFC, 0xA9, 0x19, 0xFF, 0x90, 0x9F, 0xFC,
+    0x1A, 0xEA, 0x39, 0x1F, 0x7E, 0xA7, 0xEA, 0x7E, 0xA7, 0xEA, 0x7F, 0x7A, 0xF2, 0x9A, 0x91, 0xFF,
+    0xC9, 0x19, 0xFF, 0x93, 0xAF, 0xA9, 0x6D, 0x71, 0xD7, 0x19, 0x93, 0x77, 0x09, 0xFC, 0xA9, 0x3A,
+    0xFF, 0x29, 0xFF, 0xA2, 0xAE, 0x92, 0x93, 0xF7, 0x0F, 0x70, 0xF6, 0xAA, 0xFA, 0xAA, 0xA9, 0x1F,
+    0xFD, 0x91, 0xFF, 0xD9, 0x3F, 0x70, 0xF7, 0x0F, 0x70, 0xE9, 0x69, 0xEA, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x74, 0xD9, 0x9A, 0xA9, 0x0D, 0x09, 0xFF, 0xD9, 0x09, 0xFF, 0xA1, 0x9D, 0xA1, 0x9D,
+    0xA1, 0xAD, 0x3E, 0x1E, 0x3A, 0xD1, 0xAD, 0x92, 0xDA, 0x19, 0xEA, 0xAE, 0x91, 0xFF, 0xD0, 0x9D,
+    0xAF, 0xAD, 0x90, 0x99, 0x59, 0x90, 0xAE, 0x5A, 0xE0, 0x9E, 0xA4, 0xE9, 0x1A, 0xE3, 0xAE, 0x3E,
+    0x92, 0xE9, 0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xE9, 0x5A, 0xDA, 0x9E, 0x7F, 0xD9, 0x7A, 0xFC, 0x69,
+    0xAF, 0xDA, 0xA4, 0xAF, 0xFC, 0x49, 0x99, 0xF9, 0x99, 0x7A, 0xE7, 0xAF, 0xFC, 0x4A, 0xFF, 0xC5,
+    0x99, 0xAE, 0x99, 0x97, 0xAE, 0x72, 0xAE, 0x50, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD7, 0x71, 0x99, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9A, 0xA0, 0x73, 0xAF, 0xCA, 0x1F, 0xFA, 0x9E, 0x90,
+    0x9A, 0xC0, 0xAD, 0xA5, 0x9E, 0x95, 0xAF, 0x93, 0x9F, 0xD9, 0x1E, 0x9F, 0x99, 0xD9, 0x19, 0xEA,
+    0xD9, 0x2E, 0x9E, 0x91, 0xE0, 0xAF, 0xAD, 0x91, 0x9F, 0xCA, 0x49, 0xF9, 0x5A, 0xE6, 0xEA, 0xA9,
+    0x2A, 0xDA, 0xAF, 0xF0, 0x9F, 0xDA, 0x73, 0x9C, 0xA2, 0xAC, 0x9E, 0xA0, 0x9E, 0xAD, 0x90, 0x9E,
+    0x09, 0x92, 0x99, 0x00, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xAD, 0xAA, 0x9A, 0xEA, 0x6D, 0xA6, 0xAD,
+    0x4D, 0x39, 0xAA, 0x91, 0xAD, 0x2A, 0xC9, 0x19, 0xFD, 0x1A, 0xC9, 0x1C, 0xA1, 0x9D, 0x91, 0x99,
+    0x2D, 0x09, 0xC9, 0x1D, 0x97, 0xAC, 0x0A, 0xC2, 0xD7, 0x09, 0xC9, 0xD1, 0x9D, 0x71, 0xCA, 0xD1,
+    0x9D, 0x71, 0xCA, 0xAC, 0x2D, 0x70, 0x9C, 0x99, 0xC9, 0x1D, 0x97, 0xAC, 0x90, 0xCA, 0x1A, 0xD7,
+    0xD1, 0xAC, 0x2A, 0xFC, 0xA1, 0xAC, 0xA2, 0xD2, 0x9A, 0xDA, 0x19, 0xD3, 0x9D, 0x96, 0xAD, 0x59,
+    0xEA, 0x99, 0x9A, 0xE7, 0x09, 0xFE, 0x97, 0x77, 0x71, 0x9A, 0xF9, 0x19, 0xFD, 0x29, 0x2D, 0x91,
+    0x9A, 0xAA, 0xD9, 0x0F, 0xE9, 0x9D, 0x91, 0xD9, 0x9D, 0x90, 0xAD, 0x90, 0xFE, 0x91, 0xAC, 0xA1,
+    0xA9, 0x49, 0x49, 0x69, 0xD9, 0x2D, 0xA4, 0xEA, 0x1F, 0x3F, 0x1F, 0x3F, 0x1A, 0xE9, 0x2A, 0xE9,
+    0x09, 0xEA, 0x3F, 0x1A, 0xE9, 0x4F, 0x1F, 0x49, 0xEA, 0x1F, 0x49, 0xE9, 0x1E, 0xA4, 0xAD, 0xA1,
+    0x9E, 0x5A, 0x93, 0xA9, 0x10, 0x74, 0xFF, 0xF0, 0xFF, 0xF0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAE, 0x71,
+    0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x00, 0x09, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x9F, 0xD9,
+    0x9F, 0xD0, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xAD, 0xAA, 0x9A, 0xEA, 0x6D, 0xA6, 0xAD, 0x4D, 0x1A,
+    0xAA, 0x99, 0x2A, 0xD2, 0xAC, 0x91, 0xFD, 0x91, 0xAC, 0x91, 0xCA, 0x2D, 0x09, 0xAD, 0x2D, 0x09,
+    0xC9, 0x2D, 0x2D, 0x2A, 0xC0, 0xAC, 0x3D, 0x2D, 0x29, 0xC9, 0xD3, 0xD9, 0x9D, 0xA3, 0xCA, 0xD3,
+    0xFC, 0xA4, 0xCA, 0xAC, 0x3D, 0x9A, 0xCA, 0x39, 0xC9, 0x9C, 0x92, 0xD1, 0xD9, 0x2A, 0xC9, 0x0C,
+    0xA2, 0xD1, 0x9D, 0x2D, 0x1A, 0xC2, 0xD2, 0xD9, 0x0A, 0xCA, 0x2D, 0x1A, 0x93, 0xA9, 0x9D, 0x39,
+    0xD9, 0x6A, 0xD5, 0x9E, 0xA9, 0x99, 0xAE, 0x70, 0x9F, 0xE9, 0x77, 0x70, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x72, 0xAE, 0xA2, 0xFD, 0xA0, 0xAD, 0x90, 0xAD,
+    0x9D, 0xA2, 0xDA, 0xD9, 0x2D, 0xAE, 0x19, 0xD9, 0x9F, 0xE1, 0x9F, 0xC4, 0x99, 0x30, 0x4A, 0xA9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x4F, 0xFF, 0x0F, 0xFF, 0x0A, 0xFF, 0xE5, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0x99, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF,
+    0xF0, 0xFF, 0xF0, 0x39, 0x93, 0x9F, 0xC9, 0x1F, 0xE1, 0x9A, 0x1E, 0x94, 0xE4, 0x9E, 0x39, 0xE3,
+    0x9E, 0x39, 0xE4, 0xFE, 0x99, 0xFE, 0xA0, 0xAA, 0xAA, 0xAA, 0xA9, 0x39, 0x93, 0xAF, 0xC9, 0x1F,
+    0xE1, 0x99, 0x19, 0xD9, 0x49, 0xD2, 0x9F, 0x92, 0x9F, 0xA5, 0x9D, 0x95, 0xDA, 0x9C, 0xA9, 0x9A,
+    0xDA, 0x9F, 0xE1, 0x9A, 0xDA, 0x91, 0x71, 0xAE, 0xA1, 0x9E, 0xA2, 0xE9, 0x2A, 0xD4, 0x0A, 0xAA,
+    0x94, 0xAA, 0xA9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39,
+    0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E,
+    0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x0F, 0xFA, 0xE9, 0x0E, 0xAF, 0x0A, 0xD9, 0x0E,
+    0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x00, 0x2A, 0xFF, 0xC1, 0x9F,
+    0xFE, 0x1F, 0xF9, 0x9D, 0x09, 0xFF, 0x1D, 0x0A, 0xFF, 0x1D, 0x0A, 0xFF, 0x1D, 0x0A, 0xFF, 0x1D,
+    0x0A, 0xFF, 0x1D, 0x09, 0xFF, 0x1D, 0x1F, 0xF1, 0xD1, 0xAF, 0xE1, 0xD2, 0xAF, 0xD1, 0xD4, 0x99,
+    0x9D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D,
+    0x7D, 0x1D, 0x7D, 0x1D, 0x76, 0x0A, 0xCA, 0x0A, 0xEA, 0xAE, 0xA9, 0xE9, 0x19, 0x10, 0x1D, 0x39,
+    0xE4, 0xE3, 0xE0, 0xAF, 0xC0, 0x9E, 0xA1, 0x71, 0x9E, 0x19, 0xF0, 0xAF, 0xC0, 0xAC, 0xAE, 0x19,
+    0x0E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3A, 0xAA, 0x72, 0x9E, 0xA2, 0xAF, 0xD1, 0xDA, 0x1D, 0xA9,
+    0xD9, 0x1A, 0xD9, 0xD2, 0xAD, 0x0D, 0x91, 0xAD, 0x0E, 0x99, 0xDA, 0x09, 0xFD, 0x3A, 0xDA, 0x10,
+    0x29, 0x49, 0x59, 0xDA, 0x19, 0xDA, 0x4A, 0xE9, 0x09, 0xEA, 0x4F, 0x1A, 0xE9, 0x4F, 0x1F, 0x5F,
+    0x1F, 0x4F, 0x1A, 0xE3, 0xAE, 0x1A, 0xE9, 0x2A, 0xE9, 0x09, 0xEA, 0x29, 0xEA, 0x1F, 0x3A, 0xDA,
+    0x19, 0xE6, 0xA4, 0xA4, 0x29, 0xD9, 0x59, 0xD9, 0x59, 0xEA, 0x5E, 0x5A, 0xFA, 0x4A, 0xD9, 0x5D,
+    0xAD, 0xA4, 0xE7, 0x09, 0xDA, 0x3A, 0xD9, 0x70, 0x9D, 0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xD7, 0x29,
+    0xDA, 0x19, 0xDA, 0x2E, 0x49, 0xDA, 0x1E, 0x2A, 0xE4, 0x9D, 0xA0, 0x9D, 0xA1, 0x9F, 0x49, 0xD9,
+    0x0E, 0x2F, 0xC7, 0x09, 0xD9, 0x1A, 0xC9, 0xE7, 0x0E, 0x19, 0xCA, 0x0E, 0x7A, 0xD9, 0x1D, 0x1E,
+    0x7E, 0x1A, 0xFF, 0x94, 0xAD, 0x2A, 0xFF, 0xA3, 0x9D, 0xA7, 0xE5, 0xE7, 0x0E, 0x10, 0x29, 0xD9,
+    0x59, 0xD9, 0x59, 0xEA, 0x5E, 0x5A, 0xFA, 0x4A, 0xD9, 0x5D, 0xAD, 0xA4, 0xE7, 0x09, 0xDA, 0x3A,
+    0xD9, 0x70, 0x9D, 0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xD7, 0x29, 0xDA, 0x19, 0xDA, 0x09, 0xEA, 0x93,
+    0x9D, 0xA1, 0xE0, 0xAF, 0xD3, 0x9D, 0xA0, 0x9D, 0xA0, 0x9D, 0x9E, 0xA2, 0x9D, 0x90, 0xE5, 0x9D,
+    0xA6, 0x9D, 0x95, 0xAD, 0x96, 0xE5, 0x9D, 0xA6, 0xAD, 0x94, 0x9E, 0x7E, 0x49, 0xE7, 0xAD, 0x49,
+    0xE9, 0x99, 0x93, 0x9D, 0xA4, 0xFF, 0x3E, 0x5F, 0xF0, 0x77, 0x4A, 0xF9, 0x59, 0xD9, 0x2A, 0xFD,
+    0x5E, 0x4A, 0x90, 0x9D, 0x93, 0xAD, 0x97, 0x0D, 0x93, 0xDA, 0x6A, 0xAD, 0xA3, 0xAD, 0x69, 0xF9,
+    0x29, 0xDA, 0x79, 0x9A, 0xD9, 0x1E, 0x73, 0xE0, 0x9D, 0xA1, 0xAD, 0x90, 0xC9, 0x19, 0xE0, 0xE1,
+    0x9E, 0x90, 0xFE, 0x9A, 0xD9, 0x1F, 0x90, 0x9F, 0xC9, 0x0E, 0x1A, 0xCA, 0xD9, 0x7A, 0xD9, 0x09,
+    0xDA, 0xD9, 0x7E, 0x1D, 0x0A, 0xD9, 0x6A, 0xD1, 0xAC, 0x90, 0xAD, 0x95, 0x9D, 0xA1, 0xFF, 0xC4,
+    0xE2, 0xFF, 0xC3, 0x9D, 0xA6, 0xAD, 0x94, 0xE7, 0xAD, 0x90, 0x4A, 0xD7, 0x9F, 0x69, 0xF7, 0xE9,
+    0x77, 0x77, 0x9D, 0x97, 0xE9, 0x69, 0xE6, 0xAE, 0xA5, 0xFA, 0x5A, 0xE9, 0x6E, 0xA6, 0x9E, 0x79,
+    0xE9, 0x39, 0x90, 0x9F, 0xAA, 0xAE, 0x1F, 0xFD, 0xA1, 0xAF, 0xEA, 0x49, 0x99, 0x93, 0x77, 0x6A,
+    0xE9, 0x75, 0xAE, 0x97, 0x59, 0xE7, 0x7D, 0xA7, 0x77, 0x5F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7,
+    0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA,
+    0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9,
+    0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x00,
+    0x77, 0x72, 0xF9, 0x73, 0xAE, 0x74, 0xAE, 0x75, 0xDA, 0x77, 0x77, 0xFC, 0x74, 0xFC, 0x97, 0x2A,
+    0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9,
+    0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97,
+    0xF0, 0x77, 0x7A, 0xF7, 0x3A, 0xFD, 0x71, 0x9E, 0x0A, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x77, 0x73,
+    0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7,
+    0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A,
+    0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90,
+    0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x49, 0xDA, 0x2C, 0xA7, 0xAF, 0xCA, 0xDA, 0x7D, 0xAA, 0xFC,
+    0x70, 0xCA, 0x2A, 0xCA, 0x77, 0x75, 0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19,
+    0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F,
+    0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA,
+    0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x4C, 0xA2, 0xAC, 0x97,
+    0x0A, 0xDA, 0x09, 0xE7, 0x0A, 0xDA, 0x1E, 0x71, 0x99, 0x29, 0x97, 0x77, 0x5F, 0xC7, 0x4F, 0xC9,
+    0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7,
+    0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF,
+    0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0,
+    0xF9, 0x7F, 0x00, 0x59, 0xE9, 0x74, 0xFC, 0x97, 0x29, 0xCA, 0x09, 0xCA, 0x72, 0x9C, 0xA0, 0x9C,
+    0xA7, 0x3F, 0xC9, 0x73, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE,
+    0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA,
+    0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6,
+    0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x7F, 0xFF, 0xD9, 0x6A, 0xFF, 0xFD, 0x96, 0xFF,
+    0xFE, 0x95, 0xAE, 0x9A, 0xEA, 0x99, 0x99, 0x99, 0x6E, 0xA0, 0x9E, 0x97, 0x39, 0xE1, 0x9E, 0x97,
+    0x3F, 0x19, 0xE9, 0x72, 0x9E, 0x91, 0x9F, 0xFC, 0xA4, 0xAE, 0x29, 0xFF, 0xD4, 0xEA, 0x29, 0xFF,
+    0xD3, 0xAE, 0xA9, 0x99, 0xAE, 0xA9, 0x99, 0x99, 0x4F, 0xFF, 0x97, 0x0A, 0xFF, 0xF9, 0x70, 0xFF,
+    0xFC, 0x97, 0x9E, 0x94, 0x9E, 0xA7, 0xF5, 0x9F, 0xFD, 0x99, 0xE9, 0x59, 0xFF, 0xD9, 0xF6, 0x9F,
+    0xFD, 0x90, 0x77, 0x39, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9F, 0xFD, 0xA2, 0xFC, 0x92, 0xAC, 0x91,
+    0xAE, 0xA7, 0x1F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0x97,
+    0x19, 0xEA, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFA, 0x4A, 0x92, 0xFF, 0xEA, 0x3A, 0xFF, 0xCA, 0x49,
+    0xFE, 0xA7, 0x0D, 0x97, 0x29, 0xE9, 0x73, 0xE7, 0x3E, 0x70, 0x9F, 0xC7, 0x09, 0xEA, 0x40, 0x73,
+    0xAE, 0xA6, 0xAE, 0x96, 0x9E, 0x70, 0xE7, 0x5A, 0xFF, 0xC9, 0xFF, 0xDA, 0xFF, 0xDA, 0xF9, 0x99,
+    0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xD0, 0xF9, 0x99, 0x99, 0x90, 0xF6,
+    0xF6, 0xF6, 0xF6, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xDA, 0x77, 0xAE, 0xA4, 0x9E, 0x94, 0x9E, 0x95,
+    0xDA, 0x77, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F,
+    0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF,
+    0xFD, 0xAF, 0xFD, 0xA0, 0x75, 0xFC, 0x4A, 0xFC, 0xA2, 0xAD, 0xA0, 0xE9, 0x09, 0xD9, 0x2A, 0xD7,
+    0x3A, 0xFF, 0xC9, 0xFF, 0xDA, 0xFF, 0xDA, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xFF, 0xD0,
+    0xFF, 0xD0, 0xFF, 0xD0, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xF6, 0xFF, 0xDA, 0xFF, 0xDA,
+    0xFF, 0xDA, 0x09, 0xCA, 0x2A, 0xC9, 0x1E, 0x90, 0xAE, 0x1E, 0x90, 0x9D, 0xA2, 0x99, 0x29, 0x97,
+    0x4A, 0xFF, 0xC9, 0xFF, 0xDA, 0xFF, 0xDA, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xFF, 0xD0,
+    0xFF, 0xD0, 0xFF, 0xD0, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xF6, 0xFF, 0xDA, 0xFF, 0xDA,
+    0xFF, 0xDA, 0x70, 0x9F, 0x5E, 0xA5, 0xEA, 0x5A, 0xD7, 0x3F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF,
+    0x75, 0x9F, 0x4E, 0xA4, 0xEA, 0x4A, 0xD9, 0x76, 0xFF, 0x1F, 0xF1, 0xAF, 0xD9, 0x3F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x39, 0xFD, 0x91, 0xFF, 0x1F, 0xF0, 0x75,
+    0xAF, 0x49, 0xFD, 0x29, 0xE0, 0xAE, 0x1D, 0xA2, 0x9D, 0xA7, 0x4F, 0xF2, 0xFF, 0x2A, 0xFD, 0x94,
+    0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF4, 0x9F, 0xD9, 0x2F, 0xF2,
+    0xFF, 0x00, 0x0A, 0xC9, 0x1A, 0xCA, 0x0A, 0xE1, 0xE0, 0x9D, 0xA1, 0xE1, 0x99, 0x39, 0x74, 0xFF,
+    0x1F, 0xF1, 0xAF, 0xD9, 0x3F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x39, 0xFD, 0x91, 0xFF, 0x1F, 0xF0, 0x1A, 0xFE, 0xA9, 0x6F, 0xFE, 0x94, 0xFF, 0xFA, 0x3F, 0x99,
+    0x99, 0xFC, 0xA2, 0xF4, 0xAF, 0x2F, 0x5F, 0x91, 0xF5, 0x9E, 0xA0, 0x9F, 0x99, 0x93, 0xF9, 0xFF,
+    0x92, 0xF9, 0xFF, 0x92, 0xF9, 0xFF, 0x3F, 0x1F, 0x59, 0xEA, 0x1F, 0x5F, 0x91, 0xF4, 0xAF, 0x2F,
+    0x29, 0xFC, 0x92, 0xFF, 0xFA, 0x3F, 0xFE, 0x94, 0xFF, 0xA9, 0x40, 0x4A, 0xCA, 0x2A, 0xC7, 0xFD,
+    0xAD, 0x6A, 0xDA, 0xFC, 0xA6, 0xAC, 0x29, 0xD9, 0x77, 0x5A, 0xF6, 0x9E, 0x0F, 0xD5, 0x9E, 0x0F,
+    0xD9, 0x49, 0xE0, 0xFE, 0x49, 0xE0, 0xFE, 0xA3, 0x9E, 0x0E, 0x9F, 0x39, 0xE0, 0xEA, 0x9E, 0xA2,
+    0x9E, 0x0E, 0xA0, 0xF9, 0x19, 0xE0, 0xEA, 0x1F, 0x19, 0xE0, 0xEA, 0x1A, 0xE9, 0x09, 0xE0, 0xEA,
+    0x2F, 0x09, 0xE0, 0xEA, 0x29, 0xEA, 0x0E, 0x0E, 0xA3, 0xF9, 0xE0, 0xEA, 0x39, 0xFE, 0x0E, 0xA4,
+    0xAF, 0xD0, 0xEA, 0x5F, 0xD0, 0xEA, 0x5A, 0xFC, 0x0E, 0xA6, 0xFC, 0x00, 0x77, 0x6A, 0xEA, 0x75,
+    0x9E, 0x97, 0x6E, 0x97, 0x6A, 0xD7, 0x77, 0x4A, 0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92,
+    0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A,
+    0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA,
+    0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76,
+    0x77, 0x72, 0xAE, 0xA7, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x4D, 0xA7, 0x77, 0x6A, 0xFD, 0xA7, 0xAF,
+    0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA,
+    0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E,
+    0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD,
+    0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0x77, 0x79, 0xF9, 0x72, 0x9F, 0xD7, 0x2E, 0x09, 0xE7, 0x0D, 0xA3,
+    0xDA, 0x77, 0x72, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29, 0xFC, 0x2F,
+    0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9,
+    0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1, 0x9F, 0xA3,
+    0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77, 0x60, 0x49, 0xDA, 0x2D, 0x79,
+    0xFC, 0xAE, 0x7E, 0xAF, 0xC9, 0x7D, 0x2A, 0xCA, 0x97, 0x77, 0x3A, 0xFD, 0xA7, 0xAF, 0xFD, 0x94,
+    0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA, 0x7F, 0x0A,
+    0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E, 0xA7, 0xF1,
+    0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9A,
+    0xFD, 0xA7, 0x76, 0x4A, 0xC9, 0x19, 0xCA, 0x70, 0x9E, 0x1E, 0x97, 0x9E, 0x1E, 0x71, 0x99, 0x39,
+    0x77, 0x74, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29, 0xFC, 0x2F, 0xA5,
+    0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A,
+    0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1, 0x9F, 0xA3, 0xAF,
+    0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77, 0x60, 0x74, 0x9C, 0x94, 0xCA, 0x1E,
+    0x92, 0xE9, 0x09, 0xE9, 0x0E, 0xA2, 0x9F, 0xDA, 0x49, 0xFA, 0x6F, 0x95, 0xFD, 0x93, 0xEA, 0x9E,
+    0x91, 0xEA, 0x19, 0xE9, 0x0A, 0xCA, 0x39, 0xD2, 0x95, 0x91, 0x75, 0xA7, 0xAF, 0xDA, 0xE4, 0xAF,
+    0xFE, 0x93, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x39, 0xFC, 0xA1, 0xF4, 0xFE, 0x09,
+    0xEA, 0x3E, 0x0F, 0x0A, 0xEA, 0x29, 0xD9, 0x0F, 0x9A, 0xE9, 0x2D, 0xA1, 0xAE, 0x9A, 0xE9, 0x1A,
+    0xD2, 0xAE, 0x9A, 0xE9, 0x09, 0xD9, 0x2A, 0xE9, 0x9E, 0xA0, 0xDA, 0x3F, 0x1F, 0xAD, 0x4F, 0x1F,
+    0xD9, 0x3A, 0xEA, 0x19, 0xFC, 0x3A, 0xF3, 0xAF, 0xFF, 0x93, 0x9F, 0xFE, 0xA4, 0xEA, 0xFD, 0xA6,
+    0x9C, 0x77, 0x77, 0x77, 0x1A, 0xEA, 0x72, 0xAE, 0x97, 0x29, 0xE7, 0x4D, 0xA7, 0x73, 0xAE, 0x6E,
+    0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF,
+    0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F,
+    0xE9, 0x77, 0x10, 0x77, 0x5A, 0xE9, 0x70, 0xAE, 0x97, 0x09, 0xE7, 0x2D, 0xA7, 0x75, 0xAE, 0x6E,
+    0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF,
+    0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F,
+    0xE9, 0x77, 0x10, 0x77, 0x3F, 0xA7, 0x0F, 0xDA, 0x6A, 0xDA, 0x0E, 0x94, 0x9D, 0x92, 0xAD, 0x77,
+    0x1A, 0xE6, 0xEA, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xFF, 0x6E, 0xAA, 0xE9, 0x49, 0xEA, 0x9F, 0x92, 0x9F, 0x1F, 0xFF, 0xA2, 0xFF,
+    0xDA, 0x49, 0xFE, 0x97, 0x71, 0x29, 0xCA, 0x2A, 0xC6, 0xE9, 0x0A, 0xE5, 0xE9, 0x09, 0xDA, 0x69,
+    0x92, 0x99, 0x77, 0x2A, 0xE6, 0xEA, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6E, 0xAA, 0xE9, 0x49, 0xEA, 0x9F, 0x92, 0x9F, 0x1F,
+    0xFF, 0xA2, 0xFF, 0xDA, 0x49, 0xFE, 0x97, 0x71, 0x77, 0x7A, 0xE9, 0x71, 0xAE, 0x97, 0x19, 0xE7,
+    0x3D, 0xA7, 0x76, 0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93, 0xAE, 0x92, 0xF3, 0xF3, 0xAE,
+    0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF, 0xD7, 0x1F, 0xCA, 0x71, 0x9F,
+    0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0xAE, 0x70, 0xF7, 0x0F, 0x70,
+    0xFF, 0xC9, 0x2F, 0xFE, 0x1F, 0xFF, 0x0F, 0x29, 0xF9, 0xF3, 0x9E, 0x9F, 0x39, 0xEA, 0xF3, 0x9E,
+    0xAF, 0x3F, 0x9F, 0xAA, 0xAF, 0xC0, 0xFF, 0xE9, 0x0F, 0xFD, 0x2F, 0x99, 0x99, 0x4F, 0x70, 0xF7,
+    0x0F, 0x70, 0x77, 0x29, 0xAF, 0xD9, 0x5A, 0xFF, 0xD3, 0x9F, 0xFE, 0xA2, 0xF9, 0x29, 0xF2, 0xEA,
+    0x4F, 0x2E, 0xA4, 0xF2, 0xEA, 0x29, 0xF3, 0xEA, 0x19, 0xF4, 0xEA, 0x1F, 0x5E, 0xA1, 0xF5, 0xEA,
+    0x1F, 0xC9, 0x3E, 0xA1, 0x9F, 0xCA, 0x2E, 0xA3, 0xAF, 0xC1, 0xEA, 0x49, 0xF9, 0x0E, 0xA5, 0x9E,
+    0xA0, 0xEA, 0x59, 0xEA, 0x0E, 0xA0, 0xAC, 0xA9, 0xAF, 0x90, 0xEA, 0x0A, 0xFF, 0x1E, 0xA0, 0x9F,
+    0xDA, 0x77, 0x10, 0x77, 0xF9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0x9D, 0xA7, 0x72, 0x9A, 0xF9, 0x39,
+    0xFF, 0xC3, 0xFF, 0xCA, 0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99, 0x9A, 0xF2, 0xFF, 0xD1, 0xFD, 0xAF,
+    0x0F, 0x92, 0xAE, 0x0F, 0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA, 0xFC, 0x09, 0xFE, 0x9E, 0x19, 0xFC,
+    0x90, 0xAD, 0x75, 0x77, 0x3F, 0x7F, 0x7A, 0xDA, 0x79, 0xD9, 0x77, 0x49, 0xAF, 0x93, 0x9F, 0xFC,
+    0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9,
+    0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A,
+    0xD7, 0x50, 0x77, 0x0F, 0xC6, 0xAF, 0xCA, 0x4A, 0xDA, 0x0A, 0xDA, 0x29, 0xD9, 0x2A, 0xD9, 0x77,
+    0x09, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F,
+    0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F,
+    0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x2A, 0xD9, 0x19, 0xCA, 0x2A, 0xFC, 0xAD, 0x92, 0xDA,
+    0xFD, 0x29, 0xC9, 0x2A, 0xCA, 0x77, 0x29, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F,
+    0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F,
+    0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x19, 0xCA, 0x2A,
+    0xC9, 0x3E, 0x90, 0x9E, 0x3E, 0x90, 0x9E, 0x49, 0x92, 0x99, 0x77, 0x29, 0xAF, 0x93, 0x9F, 0xFC,
+    0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9,
+    0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A,
+    0xD7, 0x50, 0x39, 0xE9, 0x7F, 0xC6, 0xAC, 0x90, 0xAC, 0xA5, 0xAC, 0x90, 0xAC, 0xA6, 0xFC, 0x79,
+    0xAC, 0xA7, 0x74, 0x9A, 0xF9, 0x39, 0xFF, 0xC3, 0xFF, 0xCA, 0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99,
+    0x9A, 0xF2, 0xFF, 0xD1, 0xFD, 0xAF, 0x0F, 0x92, 0xAE, 0x0F, 0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA,
+    0xFC, 0x09, 0xFE, 0x9E, 0x19, 0xFC, 0x90, 0xAD, 0x75, 0x2A, 0xFA, 0x29, 0xEA, 0x93, 0x9F, 0xFA,
+    0xFF, 0x3F, 0xFF, 0xFD, 0x29, 0x93, 0xFC, 0x29, 0xE9, 0x7A, 0xE9, 0x3E, 0xA3, 0x99, 0x99, 0xF9,
+    0x99, 0x99, 0xF0, 0x9F, 0xFF, 0xFE, 0x0F, 0xCA, 0xAF, 0xFF, 0xCA, 0xE9, 0x2A, 0xE7, 0x0F, 0x3F,
+    0x97, 0xF2, 0x9F, 0xC5, 0x90, 0xAF, 0x9A, 0xFE, 0xAA, 0xAA, 0xD0, 0x9F, 0xF0, 0x9F, 0xFC, 0x19,
+    0xFC, 0xA3, 0xFE, 0xA7, 0x75, 0x3A, 0xFA, 0x92, 0xAF, 0xF1, 0x9F, 0xFA, 0x1F, 0xA1, 0x9A, 0x19,
+    0xEA, 0x6A, 0xE7, 0xF7, 0xF7, 0xF7, 0xAE, 0x96, 0x9F, 0x39, 0xA1, 0xFF, 0xD2, 0xFF, 0xC3, 0xAF,
+    0xD9, 0x5D, 0x97, 0x0E, 0x97, 0x0E, 0x70, 0xAD, 0x94, 0x9F, 0xC6, 0xEA, 0x30, 0x77, 0xF9, 0x70,
+    0xAE, 0x71, 0xAE, 0x71, 0x9D, 0xA7, 0x73, 0xAE, 0xA9, 0x4A, 0xFF, 0x2A, 0xFF, 0xD1, 0xF2, 0xAE,
+    0x99, 0xE9, 0x3E, 0xAA, 0xE9, 0x99, 0x99, 0xEA, 0xFF, 0xFF, 0xFF, 0xDA, 0xE7, 0x0A, 0xE9, 0x70,
+    0xF5, 0x91, 0xAF, 0xAA, 0xAA, 0xD2, 0xFF, 0xD3, 0x9F, 0xEA, 0x75, 0x77, 0x3F, 0x7F, 0x7A, 0xDA,
+    0x79, 0xD9, 0x77, 0x5A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA,
+    0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA,
+    0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x77, 0x0F, 0xC6, 0xAF, 0xCA, 0x4A, 0xDA, 0x0A,
+    0xDA, 0x29, 0xD9, 0x2A, 0xD9, 0x77, 0x1A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9,
+    0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F,
+    0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x19, 0xCA, 0x2A, 0xC9, 0x3E,
+    0x90, 0x9E, 0x3E, 0x90, 0x9E, 0x49, 0x92, 0x99, 0x77, 0x3A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD,
+    0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70,
+    0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x71, 0xAE,
+    0xA4, 0xAE, 0x94, 0x9E, 0x6D, 0xA7, 0x4A, 0xAA, 0x94, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA,
+    0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x10, 0x72, 0xF9, 0x1A,
+    0xE9, 0x19, 0xE3, 0xDA, 0x74, 0xAA, 0xA9, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA,
+    0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA2, 0x75, 0xAF, 0x49, 0xFD, 0x29,
+    0xE0, 0xAD, 0xA1, 0xDA, 0x29, 0xDA, 0x76, 0xAA, 0xA9, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E,
+    0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA2, 0x0A, 0xC2, 0xAC,
+    0x90, 0xAD, 0xA1, 0xE0, 0xAD, 0xA1, 0xE1, 0x99, 0x39, 0x76, 0xAA, 0xA9, 0x5E, 0xA5, 0xEA, 0x5E,
+    0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA2,
+    0x77, 0x1A, 0xC9, 0x19, 0xC5, 0x9E, 0xAE, 0xA5, 0x9F, 0xCA, 0x69, 0xFC, 0x69, 0xFE, 0x6C, 0xA1,
+    0xEA, 0x71, 0x9E, 0x93, 0xAF, 0xAE, 0xA2, 0xFF, 0xE1, 0xFC, 0xAA, 0xFC, 0x09, 0xEA, 0x3F, 0x9A,
+    0xE4, 0xAE, 0x9F, 0x49, 0xE9, 0xF4, 0x9E, 0x9A, 0xE4, 0xAE, 0x09, 0xEA, 0x3F, 0x1F, 0xCA, 0xAF,
+    0x92, 0xFF, 0xC9, 0x4A, 0xFD, 0x97, 0x70, 0x3A, 0xCA, 0x2A, 0xC4, 0xFD, 0xAD, 0x3A, 0xDA, 0xFC,
+    0xA3, 0xAC, 0x29, 0xD9, 0x77, 0x1A, 0xAA, 0x19, 0xEA, 0x3E, 0x0F, 0xE9, 0x1F, 0xFF, 0x1F, 0xC9,
+    0x09, 0xF9, 0x0F, 0x3A, 0xE9, 0x0F, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E,
+    0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E,
+    0x90, 0xEA, 0x39, 0xE9, 0x77, 0x0A, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE7, 0x3A, 0xD7, 0x75, 0xAE,
+    0xA9, 0x5A, 0xFF, 0x3A, 0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xAE, 0x9F,
+    0x49, 0xE9, 0xF4, 0x9E, 0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A, 0xFA, 0xAF,
+    0x92, 0xFF, 0xCA, 0x49, 0xFD, 0x97, 0x70, 0x77, 0x4A, 0xE9, 0x7A, 0xE9, 0x79, 0xE7, 0x1D, 0xA7,
+    0x77, 0xAE, 0xA9, 0x5A, 0xFF, 0x3A, 0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4,
+    0xAE, 0x9F, 0x49, 0xE9, 0xF4, 0x9E, 0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A,
+    0xFA, 0xAF, 0x92, 0xFF, 0xCA, 0x49, 0xFD, 0x97, 0x70, 0x77, 0x1A, 0xF7, 0x9F, 0xD5, 0x9E, 0x09,
+    0xE4, 0xDA, 0x29, 0xDA, 0x77, 0x3A, 0xEA, 0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0,
+    0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F, 0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93,
+    0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC, 0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x29, 0xDA,
+    0x2D, 0x39, 0xFC, 0xAD, 0xA3, 0xEA, 0xFC, 0x93, 0xD2, 0xAC, 0xA9, 0x77, 0x4A, 0xEA, 0x95, 0xAF,
+    0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F,
+    0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC,
+    0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x2A, 0xC9, 0x1A, 0xCA, 0x4A, 0xE1, 0xE4, 0x9D, 0xA1, 0xE5, 0x99,
+    0x39, 0x77, 0x5A, 0xEA, 0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93, 0xF0,
+    0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F, 0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F, 0x29,
+    0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC, 0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x4D, 0x97, 0x0A, 0xE7, 0x0A,
+    0xDA, 0x71, 0xAA, 0x77, 0x2F, 0xFF, 0x0F, 0xFF, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x99,
+    0x71, 0x9D, 0xA7, 0x0A, 0xE7, 0x09, 0xDA, 0x77, 0x10, 0x77, 0x1A, 0xEA, 0x9C, 0xA3, 0xAF, 0xFC,
+    0x2A, 0xFF, 0xD2, 0xF9, 0x09, 0xFA, 0x0A, 0xE9, 0x1A, 0xFC, 0x0A, 0xE1, 0x9F, 0xD0, 0xF1, 0xDA,
+    0x9E, 0x9F, 0x0A, 0xD0, 0x9E, 0x9F, 0x9D, 0x90, 0xAE, 0x9A, 0xFC, 0xA1, 0xF0, 0x9F, 0xC1, 0x9E,
+    0xA1, 0xAF, 0xFD, 0x3F, 0xFC, 0x92, 0xAF, 0xF5, 0xA9, 0x71, 0x77, 0x09, 0xF7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x2A, 0xD7, 0x72, 0xAA, 0xA9, 0x4A, 0xAA, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99,
+    0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39,
+    0xE9, 0x9E, 0xA3, 0x9E, 0x90, 0xEA, 0x3A, 0xE9, 0x0F, 0x29, 0xF9, 0x0F, 0xFF, 0x90, 0x9F, 0xEA,
+    0xE9, 0x19, 0xFC, 0xA0, 0xAD, 0x97, 0x50, 0x77, 0x49, 0xEA, 0x79, 0xEA, 0x70, 0xE9, 0x70, 0xAD,
+    0x77, 0x4A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E,
+    0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA,
+    0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F,
+    0xCA, 0x0A, 0xD9, 0x75, 0x77, 0x2F, 0x97, 0xFD, 0x95, 0xE9, 0x0E, 0x4A, 0xD3, 0xAD, 0x77, 0x0A,
+    0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA,
+    0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9,
+    0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A,
+    0xD9, 0x75, 0x2A, 0xC9, 0x19, 0xCA, 0x5E, 0x1E, 0x94, 0xE1, 0xE9, 0x59, 0x39, 0x97, 0x71, 0xAA,
+    0xA9, 0x4A, 0xAA, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3,
+    0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x90,
+    0xEA, 0x3A, 0xE9, 0x0F, 0x29, 0xF9, 0x0F, 0xFF, 0x90, 0x9F, 0xEA, 0xE9, 0x19, 0xFC, 0xA0, 0xAD,
+    0x97, 0x50, 0x77, 0x59, 0xEA, 0x70, 0x9E, 0xA7, 0x1E, 0x97, 0x1A, 0xD7, 0x75, 0xAA, 0xAA, 0x59,
+    0xAA, 0xA0, 0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE, 0x29, 0xE9, 0x2E, 0xA3, 0xEA,
+    0x19, 0xE9, 0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E, 0x69, 0xEA, 0xE7, 0xFD, 0x97,
+    0xAF, 0xC7, 0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x70, 0x9F, 0x7F, 0xDA, 0x7F, 0xCA,
+    0x70, 0xF9, 0x70, 0x0E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0xA0, 0x9E,
+    0x93, 0xEA, 0xFE, 0x2F, 0xFE, 0xA1, 0xFA, 0x19, 0xF1, 0xF3, 0xAE, 0x90, 0xEA, 0x39, 0xE9, 0x0E,
+    0xA4, 0xEA, 0x0E, 0xA4, 0xEA, 0x0E, 0xA3, 0x9E, 0xA0, 0xF3, 0xAE, 0x90, 0xFA, 0x2F, 0x1F, 0xFE,
+    0xA1, 0xFF, 0xE2, 0xEA, 0x9F, 0xC3, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71,
+    0xEA, 0x70, 0x2A, 0xC9, 0x19, 0xCA, 0x6E, 0x1E, 0xA5, 0xE1, 0xAD, 0x96, 0x93, 0x99, 0x77, 0x2A,
+    0xAA, 0xA5, 0x9A, 0xAA, 0x0A, 0xE9, 0x4F, 0x1E, 0xA3, 0x9E, 0x91, 0xAE, 0x3A, 0xE2, 0x9E, 0x92,
+    0xEA, 0x3E, 0xA1, 0x9E, 0x93, 0xAE, 0x1A, 0xE5, 0xE9, 0x0E, 0xA5, 0xAD, 0xA9, 0xE6, 0x9E, 0xAE,
+    0x7F, 0xD9, 0x7A, 0xFC, 0x71, 0xFA, 0x71, 0xAE, 0x97, 0x1F, 0x71, 0x9E, 0xA7, 0x09, 0xF7, 0xFD,
+    0xA7, 0xFC, 0xA7, 0x0F, 0x97, 0x00, 0x39, 0xAA, 0xAA, 0xAA, 0xA9, 0x70, 0xAF, 0xF7, 0x09, 0xFE,
+    0xA7, 0x77, 0x4F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A,
+    0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E,
+    0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F,
+    0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x00, 0x19, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0xFE,
+    0xA3, 0xAF, 0xEA, 0x77, 0x19, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE,
+    0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F,
+    0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x39, 0x95, 0x97, 0x0D, 0x93,
+    0xDA, 0x79, 0xFF, 0x71, 0xAF, 0xD9, 0x72, 0x9A, 0xDA, 0x77, 0x76, 0xFC, 0x74, 0xFC, 0x97, 0x2A,
+    0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9,
+    0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97,
+    0xF0, 0x19, 0x95, 0x93, 0xD9, 0x3D, 0x92, 0xAF, 0xF4, 0xFE, 0x95, 0x9A, 0xDA, 0x77, 0x39, 0xAF,
+    0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F,
+    0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1,
+    0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x5F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E,
+    0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2,
+    0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2,
+    0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x75, 0xAD, 0x75, 0x9D, 0x76,
+    0xDA, 0x76, 0xEA, 0xA7, 0x4A, 0xF7, 0x59, 0xAC, 0xA0, 0x29, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC,
+    0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0,
+    0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x1D,
+    0x97, 0x0D, 0x97, 0x09, 0xD7, 0x19, 0xDA, 0x99, 0x7F, 0xA7, 0x0A, 0xCA, 0x90, 0x77, 0x69, 0xF7,
+    0x1E, 0xA7, 0x1E, 0xA7, 0x1A, 0xD9, 0x77, 0x70, 0x9F, 0xDA, 0x93, 0x9F, 0xFD, 0x29, 0xFF, 0xDA,
+    0x2F, 0xC9, 0x2A, 0xC9, 0x1A, 0xEA, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71,
+    0xAE, 0x97, 0x1A, 0xE9, 0x71, 0x9E, 0xA7, 0x2F, 0x72, 0xFA, 0x71, 0x9F, 0xA4, 0xA9, 0x2F, 0xFE,
+    0xA3, 0xAF, 0xFC, 0xA4, 0x9F, 0xEA, 0x77, 0x00, 0x77, 0x19, 0xF6, 0xEA, 0x6E, 0xA6, 0xAD, 0x97,
+    0x73, 0xAF, 0xA9, 0x2A, 0xFF, 0x19, 0xFF, 0xA1, 0xFA, 0x19, 0xA1, 0x9E, 0xA6, 0xAE, 0x7F, 0x7F,
+    0x7F, 0x7A, 0xE9, 0x69, 0xF3, 0x9A, 0x1F, 0xFD, 0x2F, 0xFC, 0x3A, 0xFD, 0x97, 0x40, 0x77, 0x4F,
+    0xA7, 0x0F, 0xD9, 0x6A, 0xDA, 0x0E, 0x94, 0x9D, 0x92, 0xAD, 0x77, 0x59, 0xFD, 0xA9, 0x39, 0xFF,
+    0xD2, 0x9F, 0xFD, 0xA2, 0xFC, 0x92, 0xAC, 0x91, 0xAE, 0xA7, 0x1F, 0x71, 0x9E, 0xA7, 0x1A, 0xE9,
+    0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x19, 0xEA, 0x72, 0xF7, 0x2F, 0xA7, 0x19, 0xFA,
+    0x4A, 0x92, 0xFF, 0xEA, 0x3A, 0xFF, 0xCA, 0x49, 0xFE, 0xA7, 0x70, 0x77, 0xFA, 0x5F, 0xD9, 0x3E,
+    0x90, 0xE9, 0x1A, 0xD9, 0x2A, 0xD7, 0x70, 0xAF, 0xA9, 0x2A, 0xFF, 0x19, 0xFF, 0xA1, 0xFA, 0x19,
+    0xA1, 0x9E, 0xA6, 0xAE, 0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x69, 0xF3, 0x9A, 0x1F, 0xFD, 0x2F, 0xFC,
+    0x3A, 0xFD, 0x97, 0x40, 0x77, 0x49, 0xDA, 0x72, 0xAE, 0x97, 0x1A, 0xE7, 0x3A, 0xA9, 0x77, 0x70,
+    0x9F, 0xDA, 0x93, 0x9F, 0xFD, 0x29, 0xFF, 0xDA, 0x2F, 0xC9, 0x2A, 0xC9, 0x1A, 0xEA, 0x71, 0xF7,
+    0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0x9E, 0xA7, 0x2F,
+    0x72, 0xFA, 0x71, 0x9F, 0xA4, 0xA9, 0x2F, 0xFE, 0xA3, 0xAF, 0xFC, 0xA4, 0x9F, 0xEA, 0x77, 0x00,
+    0x77, 0x9D, 0xA7, 0xF9, 0x6A, 0xE7, 0x0A, 0xA9, 0x77, 0x3A, 0xFA, 0x92, 0xAF, 0xF1, 0x9F, 0xFA,
+    0x1F, 0xA1, 0x9A, 0x19, 0xEA, 0x6A, 0xE7, 0xF7, 0xF7, 0xF7, 0xAE, 0x96, 0x9F, 0x39, 0xA1, 0xFF,
+    0xD2, 0xFF, 0xC3, 0xAF, 0xD9, 0x74, 0x77, 0x19, 0xDA, 0x2A, 0xDA, 0x49, 0xE0, 0xEA, 0x6A, 0xFC,
+    0xA7, 0x0A, 0xF7, 0x77, 0x9F, 0xDA, 0x93, 0x9F, 0xFD, 0x29, 0xFF, 0xDA, 0x2F, 0xC9, 0x2A, 0xC9,
+    0x1A, 0xEA, 0x71, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9,
+    0x71, 0x9E, 0xA7, 0x2F, 0x72, 0xFA, 0x71, 0x9F, 0xA4, 0xA9, 0x2F, 0xFE, 0xA3, 0xAF, 0xFC, 0xA4,
+    0x9F, 0xEA, 0x77, 0x00, 0x74, 0x9D, 0xA2, 0xAD, 0x91, 0xAE, 0x0E, 0xA3, 0xAF, 0xCA, 0x5F, 0xC7,
+    0x72, 0xAF, 0xA9, 0x2A, 0xFF, 0x19, 0xFF, 0xA1, 0xFA, 0x19, 0xA1, 0x9E, 0xA6, 0xAE, 0x7F, 0x7F,
+    0x7F, 0x7A, 0xE9, 0x69, 0xF3, 0x9A, 0x1F, 0xFD, 0x2F, 0xFC, 0x3A, 0xFD, 0x97, 0x40, 0x77, 0x0A,
+    0xDA, 0x2A, 0xD9, 0x4A, 0xE9, 0xE9, 0x6F, 0xDA, 0x70, 0xFA, 0x77, 0x3A, 0xFE, 0xA9, 0x4F, 0xFE,
+    0x92, 0xFF, 0xFA, 0x1F, 0x99, 0x99, 0xFC, 0xA0, 0xF4, 0xAF, 0x0F, 0x5F, 0x9F, 0x59, 0xEA, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF5, 0x9E, 0xAF, 0x5F, 0x9F, 0x4A, 0xF0, 0xF2, 0x9F, 0xC9, 0x0F,
+    0xFF, 0xA1, 0xFF, 0xE9, 0x2F, 0xFA, 0x94, 0x70, 0xF1, 0xE7, 0x1F, 0x09, 0xDA, 0x71, 0xF0, 0xAD,
+    0x72, 0xF0, 0xDA, 0x72, 0xF7, 0x0A, 0xE9, 0x0F, 0x7F, 0xDA, 0xAE, 0x6F, 0xFF, 0x59, 0xF9, 0x09,
+    0xFC, 0x5A, 0xEA, 0x3F, 0x5A, 0xE4, 0xAE, 0x5F, 0x4A, 0xE5, 0xF4, 0xAE, 0x5F, 0x4A, 0xE5, 0xAE,
+    0x93, 0xF5, 0x9F, 0x29, 0xF6, 0xFF, 0xF6, 0x9F, 0xEA, 0xE7, 0x9F, 0xC1, 0xE7, 0x77, 0x00, 0x1A,
+    0xFE, 0xA9, 0x6F, 0xFE, 0x94, 0xFF, 0xFA, 0x3F, 0x99, 0x99, 0xFC, 0xA2, 0xF4, 0xAF, 0x2F, 0x5F,
+    0x91, 0xF5, 0x9E, 0xA0, 0x9F, 0x99, 0x93, 0xF9, 0xFF, 0x92, 0xF9, 0xFF, 0x92, 0xF9, 0xFF, 0x3F,
+    0x1F, 0x59, 0xEA, 0x1F, 0x5F, 0x91, 0xF4, 0xAF, 0x2F, 0x29, 0xFC, 0x92, 0xFF, 0xFA, 0x3F, 0xFE,
+    0x94, 0xFF, 0xA9, 0x40, 0x70, 0xF7, 0x2F, 0x6A, 0xFF, 0xC4, 0xAF, 0xFC, 0x49, 0x99, 0x9F, 0x99,
+    0x70, 0xF4, 0xFA, 0x0A, 0xE2, 0x9F, 0xEA, 0xE2, 0xFF, 0xF1, 0x9F, 0x91, 0xAF, 0x1A, 0xEA, 0x3F,
+    0x1F, 0x93, 0xAE, 0x1F, 0x93, 0xAE, 0x1F, 0x93, 0xAE, 0x1A, 0xEA, 0x3F, 0x19, 0xF2, 0x9F, 0x2F,
+    0xFF, 0x29, 0xFD, 0xAF, 0x39, 0xFA, 0x09, 0xE7, 0x70, 0x09, 0xAA, 0xAA, 0xAA, 0xA9, 0x1A, 0xFE,
+    0xA1, 0xAF, 0xEA, 0x73, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F,
+    0x6F, 0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F,
+    0xFD, 0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0x19, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0xFE, 0xA3, 0xAF, 0xEA,
+    0x77, 0x2A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99,
+    0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD,
+    0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x09, 0x95, 0x91, 0xD9, 0x3D, 0x90, 0xAF, 0xF2, 0xFE, 0x93,
+    0x9A, 0xDA, 0x75, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F,
+    0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD,
+    0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0x19, 0x95, 0x93, 0xD9, 0x3D, 0x92, 0xAF, 0xF4, 0xFE, 0x95, 0x9A,
+    0xDA, 0x77, 0x4A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE,
+    0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA,
+    0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x76, 0xE6, 0x9E, 0xA5, 0x9E, 0x96, 0x9A, 0x97, 0x6A,
+    0xFF, 0xC9, 0xFF, 0xDA, 0xFF, 0xDA, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xFF, 0xD0, 0xFF,
+    0xD0, 0xFF, 0xD0, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xF6, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF,
+    0xDA, 0x77, 0x1E, 0x70, 0xAE, 0xA7, 0x9E, 0x97, 0x09, 0xA9, 0x77, 0x5A, 0xEA, 0x94, 0xAF, 0xF2,
+    0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD,
+    0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50,
+    0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F,
+    0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF,
+    0xFD, 0xA6, 0xD9, 0x6D, 0xA6, 0x9D, 0x79, 0xDA, 0x99, 0x5F, 0xA6, 0xAC, 0xA9, 0x3A, 0xEA, 0x94,
+    0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF,
+    0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE,
+    0xA7, 0x9D, 0xA7, 0x0A, 0xD7, 0x1D, 0x97, 0x1D, 0xA0, 0x97, 0xFA, 0x70, 0xEA, 0x00, 0x72, 0x9D,
+    0xA2, 0xAD, 0xA0, 0x9E, 0x9A, 0xDA, 0x2A, 0xFD, 0x4A, 0xF7, 0x5A, 0xFF, 0xC9, 0xFF, 0xDA, 0xFF,
+    0xDA, 0xF9, 0x99, 0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xFF, 0xD0, 0xFF, 0xD0, 0xFF, 0xD0, 0xF9, 0x99,
+    0x99, 0x90, 0xF6, 0xF6, 0xF6, 0xF6, 0xFF, 0xDA, 0xFF, 0xDA, 0xFF, 0xDA, 0x76, 0xE2, 0x9D, 0xA2,
+    0x9E, 0x9A, 0xE4, 0x9F, 0xD6, 0xAF, 0x77, 0x4A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A,
+    0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97,
+    0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x50, 0x77, 0x59, 0xF9, 0x70,
+    0x9F, 0xD7, 0x0E, 0x09, 0xE6, 0xDA, 0x3D, 0xA7, 0x76, 0x9A, 0xFD, 0xA5, 0xFF, 0xE3, 0xFF, 0xE9,
+    0x2F, 0xCA, 0x39, 0xC2, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x2F, 0xE0,
+    0xAE, 0x92, 0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0x9E, 0xA5, 0xAE, 0x1F, 0x5A, 0xE1, 0xFA, 0x4A, 0xE1,
+    0x9F, 0xA3, 0xAE, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE, 0x49, 0xFF, 0xA9, 0x77, 0x00, 0x77, 0x0A, 0xF6,
+    0x9F, 0xD4, 0x9E, 0x0A, 0xDA, 0x3D, 0xA2, 0x9D, 0x97, 0x70, 0xAE, 0x91, 0xAA, 0xA1, 0xFE, 0xAE,
+    0x0F, 0xFF, 0x0F, 0x91, 0xAF, 0xAE, 0xA3, 0xFA, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAE,
+    0xAE, 0x93, 0xF9, 0xF2, 0x9F, 0x0F, 0xCA, 0xFD, 0x09, 0xFF, 0xE1, 0x9F, 0xC0, 0xF7, 0x0F, 0x70,
+    0xF0, 0xC9, 0x4F, 0xA0, 0xFF, 0xE1, 0xFF, 0xD9, 0x19, 0xAF, 0xD9, 0x20, 0x49, 0x59, 0x95, 0x9D,
+    0x39, 0xD6, 0xFF, 0x96, 0x9F, 0xDA, 0x71, 0xAD, 0xA9, 0x77, 0x70, 0x9A, 0xFD, 0xA5, 0xFF, 0xE3,
+    0xFF, 0xE9, 0x2F, 0xCA, 0x39, 0xC2, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9,
+    0x2F, 0xE0, 0xAE, 0x92, 0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0x9E, 0xA5, 0xAE, 0x1F, 0x5A, 0xE1, 0xFA,
+    0x4A, 0xE1, 0x9F, 0xA3, 0xAE, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE, 0x49, 0xFF, 0xA9, 0x77, 0x00, 0x29,
+    0x59, 0x3A, 0xCA, 0x3A, 0xCA, 0x29, 0xFF, 0x93, 0xAF, 0xD9, 0x59, 0xAD, 0xA7, 0x73, 0xAE, 0x91,
+    0xAA, 0xA1, 0xFE, 0xAE, 0x0F, 0xFF, 0x0F, 0x91, 0xAF, 0xAE, 0xA3, 0xFA, 0xE4, 0xAF, 0xE4, 0xAF,
+    0xE4, 0xAF, 0xE4, 0xAE, 0xAE, 0x93, 0xF9, 0xF2, 0x9F, 0x0F, 0xCA, 0xFD, 0x09, 0xFF, 0xE1, 0x9F,
+    0xC0, 0xF7, 0x0F, 0x70, 0xF0, 0xC9, 0x4F, 0xA0, 0xFF, 0xE1, 0xFF, 0xD9, 0x19, 0xAF, 0xD9, 0x20,
+    0x77, 0x6A, 0xDA, 0x73, 0xF7, 0x3F, 0x74, 0xAA, 0x77, 0x72, 0x9A, 0xFD, 0xA5, 0xFF, 0xE3, 0xFF,
+    0xE9, 0x2F, 0xCA, 0x39, 0xC2, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x2F,
+    0xE0, 0xAE, 0x92, 0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0x9E, 0xA5, 0xAE, 0x1F, 0x5A, 0xE1, 0xFA, 0x4A,
+    0xE1, 0x9F, 0xA3, 0xAE, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE, 0x49, 0xFF, 0xA9, 0x77, 0x00, 0x77, 0x1A,
+    0xD9, 0x79, 0xEA, 0x70, 0xEA, 0x70, 0x9A, 0xA7, 0x74, 0xAE, 0x91, 0xAA, 0xA1, 0xFE, 0xAE, 0x0F,
+    0xFF, 0x0F, 0x91, 0xAF, 0xAE, 0xA3, 0xFA, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAF, 0xE4, 0xAE, 0xAE,
+    0x93, 0xF9, 0xF2, 0x9F, 0x0F, 0xCA, 0xFD, 0x09, 0xFF, 0xE1, 0x9F, 0xC0, 0xF7, 0x0F, 0x70, 0xF0,
+    0xC9, 0x4F, 0xA0, 0xFF, 0xE1, 0xFF, 0xD9, 0x19, 0xAF, 0xD9, 0x20, 0x77, 0x49, 0xAF, 0xDA, 0x5F,
+    0xFE, 0x3F, 0xFE, 0x92, 0xFC, 0xA3, 0x9C, 0x2A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xEA, 0x72,
+    0xAE, 0x92, 0xFE, 0x0A, 0xE9, 0x2F, 0xE0, 0x9E, 0x92, 0xFE, 0x09, 0xEA, 0x5A, 0xE1, 0xF5, 0xAE,
+    0x1F, 0xA4, 0xAE, 0x19, 0xFA, 0x3A, 0xE2, 0xAF, 0xFF, 0x3A, 0xFF, 0xE4, 0x9F, 0xFA, 0x97, 0x77,
+    0x99, 0x99, 0x73, 0xAD, 0xA7, 0x3E, 0x74, 0xDA, 0x74, 0xAA, 0x60, 0x77, 0x2A, 0xD7, 0x1D, 0xA7,
+    0x0A, 0xDA, 0x70, 0xE9, 0x77, 0x3A, 0xE9, 0x1A, 0xAA, 0x1F, 0xE9, 0xE0, 0xFF, 0xF0, 0xF9, 0x1A,
+    0xFA, 0xEA, 0x3F, 0xAE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xEA, 0xE9, 0x3F, 0x9F, 0x29,
+    0xF0, 0xFC, 0xAF, 0xD0, 0x9F, 0xFE, 0x19, 0xFC, 0x0F, 0x70, 0xF7, 0x0F, 0x0C, 0x94, 0xFA, 0x0F,
+    0xFE, 0x1F, 0xFD, 0x91, 0x9A, 0xFD, 0x92, 0x77, 0x3F, 0xC7, 0x0A, 0xFC, 0xA6, 0xAD, 0xA0, 0xAD,
+    0xA4, 0x9D, 0x92, 0xAD, 0x97, 0x70, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x99, 0x99, 0x99, 0x9F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xF0, 0x77, 0x3A, 0xF7, 0x29, 0xFD, 0x70, 0x9E, 0x0A, 0xE7,
+    0xDA, 0x29, 0xDA, 0x77, 0x72, 0xEA, 0x74, 0xEA, 0x74, 0xEA, 0x74, 0xEA, 0x74, 0xEA, 0x74, 0xEA,
+    0x09, 0xEA, 0x6E, 0xAF, 0xE9, 0x4F, 0xFF, 0x4F, 0xC9, 0x09, 0xF9, 0x3F, 0x3A, 0xE9, 0x3F, 0x39,
+    0xE9, 0x3E, 0xA3, 0x9E, 0x93, 0xEA, 0x39, 0xE9, 0x3E, 0xA3, 0x9E, 0x93, 0xEA, 0x39, 0xE9, 0x3E,
+    0xA3, 0x9E, 0x93, 0xEA, 0x39, 0xE9, 0x3E, 0xA3, 0x9E, 0x93, 0xEA, 0x39, 0xE9, 0x1A, 0xE6, 0xF4,
+    0xF6, 0xF2, 0x99, 0xFA, 0x99, 0x99, 0x99, 0xF9, 0x90, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE2, 0xF6,
+    0xF4, 0xF6, 0xF4, 0xFF, 0xFE, 0x4F, 0xFF, 0xE4, 0xFF, 0xFE, 0x4F, 0x99, 0x99, 0x99, 0x9F, 0x4F,
+    0x6F, 0x4F, 0x6F, 0x4F, 0x6F, 0x4F, 0x6F, 0x4F, 0x6F, 0x4F, 0x6F, 0x4F, 0x6F, 0x20, 0x1E, 0xA7,
+    0x2E, 0xA7, 0x0F, 0xFC, 0xA4, 0xFF, 0xCA, 0x49, 0x9F, 0x99, 0x97, 0xEA, 0x72, 0xEA, 0x0A, 0xF9,
+    0x3E, 0xAF, 0xEA, 0x2F, 0xFF, 0x2F, 0xA2, 0xF9, 0x1F, 0x39, 0xEA, 0x1F, 0x4E, 0xA1, 0xEA, 0x4E,
+    0xA1, 0xEA, 0x4E, 0xA1, 0xEA, 0x4E, 0xA1, 0xEA, 0x4E, 0xA1, 0xEA, 0x4E, 0xA1, 0xEA, 0x4E, 0xA1,
+    0xEA, 0x4E, 0xA0, 0x1A, 0xCA, 0x2A, 0xC1, 0xFD, 0xAD, 0x0A, 0xDA, 0xFC, 0xA0, 0xAC, 0x29, 0xD9,
+    0x76, 0xFF, 0x2F, 0xF2, 0xAF, 0xD9, 0x4F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+    0x6F, 0x6F, 0x49, 0xFD, 0x92, 0xFF, 0x2F, 0xF0, 0x19, 0xDA, 0x2D, 0x09, 0xFC, 0xAD, 0xA0, 0xDA,
+    0xAF, 0xC1, 0xCA, 0x2A, 0xCA, 0x77, 0x0A, 0xAA, 0x96, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA,
+    0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x20, 0x0A, 0xAA, 0xAA,
+    0xAA, 0xA9, 0xFF, 0x9F, 0xF7, 0x1F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xA9, 0xFF, 0x9F, 0xF7, 0x3A, 0xAA, 0x94, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4,
+    0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x10, 0x09, 0x59, 0x0A, 0xCA, 0x3A,
+    0xCA, 0x9F, 0xF9, 0x0A, 0xFD, 0xA2, 0x9A, 0xDA, 0x97, 0x4F, 0xF1, 0xFF, 0x1A, 0xFD, 0x93, 0xF5,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF3, 0x9F, 0xD9, 0x1F, 0xF1, 0xFF,
+    0x00, 0x09, 0x59, 0x0A, 0xCA, 0x3A, 0xCA, 0x9F, 0xF9, 0x0A, 0xFD, 0xA2, 0x9A, 0xDA, 0x97, 0x6A,
+    0xAA, 0x95, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E,
+    0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x20, 0x0F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x4A, 0xCA, 0x4A,
+    0xD5, 0xD9, 0x5E, 0x99, 0x3F, 0xC4, 0xAD, 0x90, 0x5A, 0xD9, 0x9F, 0x0E, 0xA0, 0x9A, 0xA6, 0xAA,
+    0xA9, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA,
+    0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xAC, 0xA0, 0x9D, 0x1D, 0xA1, 0xE9, 0xAA, 0xF0, 0x9A, 0xCA, 0x73,
+    0xAD, 0x94, 0xF4, 0xF4, 0x9A, 0xA7, 0x4F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x0A, 0xAA, 0x90,
+    0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA,
+    0x0E, 0xA0, 0xEA, 0x0F, 0xF2, 0xAE, 0x1F, 0xF2, 0xAE, 0x1A, 0xFD, 0x92, 0xAE, 0x3F, 0x4A, 0xE3,
+    0xF4, 0xAE, 0x3F, 0x4A, 0xE3, 0xF4, 0xAE, 0x3F, 0x4A, 0xE3, 0xF4, 0xAE, 0x3F, 0x4A, 0xE3, 0xF4,
+    0xAE, 0x3F, 0x4A, 0xE3, 0xF4, 0xAE, 0x3F, 0x4A, 0xE3, 0xF4, 0xAE, 0x19, 0xFD, 0x92, 0xAE, 0x1F,
+    0xF2, 0xAE, 0x1F, 0xF2, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x0F, 0xE9, 0x70, 0xFD, 0xA7, 0x1F, 0xCA,
+    0x77, 0x30, 0x75, 0xAD, 0x93, 0xE0, 0x9F, 0x2A, 0xE9, 0x0E, 0xA2, 0xAE, 0x90, 0x9A, 0xA4, 0xAA,
+    0x97, 0x6A, 0xAA, 0x92, 0x9A, 0xAA, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E,
+    0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2,
+    0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x1E, 0xA2, 0xAE, 0x70, 0xAE, 0x70,
+    0xAE, 0x70, 0xF5, 0xAF, 0xD5, 0xAF, 0xC9, 0x5A, 0xEA, 0x91, 0x76, 0x9F, 0x95, 0xFD, 0x4E, 0x99,
+    0xE2, 0xAD, 0x3A, 0xCA, 0x77, 0x0A, 0xE7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7,
+    0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xAE, 0xA3, 0xFE, 0x93, 0xFD, 0xA4, 0xFC,
+    0x97, 0x71, 0x75, 0xAF, 0x49, 0xFD, 0x29, 0xE0, 0xAD, 0xA1, 0xDA, 0x29, 0xD9, 0x76, 0xAA, 0xA9,
+    0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E,
+    0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA5, 0xAE, 0x92, 0x9F, 0xD3, 0x9F, 0xCA, 0x4F, 0x94, 0xAE,
+    0x5F, 0x0F, 0x4A, 0xE9, 0x0F, 0x3A, 0xEA, 0x1F, 0x29, 0xF2, 0xF2, 0xF3, 0xF1, 0xF9, 0x3F, 0x0A,
+    0xEA, 0x4F, 0x9E, 0xA5, 0xFF, 0xA5, 0xFF, 0xC5, 0xFC, 0xAF, 0x4F, 0x90, 0xAE, 0xA3, 0xF2, 0xF3,
+    0xF2, 0xAF, 0x2F, 0x3F, 0x91, 0xF3, 0x9F, 0x1F, 0x4A, 0xEA, 0x0F, 0x5F, 0x97, 0x73, 0x99, 0x99,
+    0x72, 0xEA, 0x72, 0xE7, 0x3D, 0xA7, 0x3A, 0xA7, 0x0E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x2E, 0xA7, 0x2E, 0xA4, 0xAA, 0xAA, 0x1E, 0xA3, 0xF2, 0xEA, 0x2F, 0x3E, 0xA1, 0xF9, 0x3E, 0xA0,
+    0xF9, 0x4E, 0xAA, 0xE9, 0x5F, 0xF6, 0xFF, 0xA5, 0xFF, 0xC9, 0x4F, 0x1F, 0x4E, 0xA1, 0x9F, 0x3E,
+    0xA2, 0xAE, 0xA2, 0xEA, 0x3F, 0x91, 0xEA, 0x4F, 0x77, 0x49, 0x99, 0x97, 0x2A, 0xDA, 0x72, 0xE7,
+    0x3D, 0xA7, 0x3A, 0xA7, 0x0A, 0xAA, 0x94, 0xAA, 0xAA, 0x1E, 0xA3, 0xF2, 0xEA, 0x2A, 0xE9, 0x2E,
+    0xA1, 0x9E, 0x93, 0xEA, 0x09, 0xEA, 0x4E, 0xA0, 0xEA, 0x5E, 0xAF, 0x6F, 0xF9, 0x5F, 0xFC, 0x94,
+    0xF9, 0x0F, 0x4E, 0xA1, 0x9F, 0x3E, 0xA2, 0xAE, 0xA2, 0xEA, 0x3F, 0x91, 0xEA, 0x4F, 0x00, 0x77,
+    0xAE, 0xA6, 0x9E, 0x97, 0xE9, 0x7D, 0xA7, 0x76, 0xAE, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70,
+    0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x72, 0xF9, 0x1A, 0xE9, 0x19, 0xE3, 0xDA, 0x74, 0xEA, 0x3E, 0xA3,
+    0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA,
+    0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x20, 0xAE, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x77,
+    0x09, 0x99, 0x97, 0xE9, 0x7E, 0x79, 0xD9, 0x70, 0xA9, 0x50, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA,
+    0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E,
+    0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA5, 0x99, 0x99, 0x0E, 0xA0, 0xE1, 0xDA, 0x1A, 0xA1, 0xAE,
+    0x3A, 0xDA, 0xF3, 0xE9, 0xF3, 0xE0, 0xF2, 0x9D, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x00, 0x0E, 0xA0, 0xAE, 0x0E, 0xA0, 0xAD,
+    0x90, 0xEA, 0x0E, 0x1E, 0xA0, 0xD2, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA,
+    0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x40, 0xAE, 0x7F, 0x7F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x2E, 0x1F, 0x19, 0xEA, 0x0F, 0x19, 0xE9, 0x0F, 0x29, 0xA9, 0x1F,
+    0x7F, 0x7F, 0x7F, 0x7F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x00, 0x0E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA,
+    0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA9, 0xE1, 0xEA, 0xAE, 0x90, 0xEA, 0xAE, 0x90, 0xEA,
+    0x0A, 0xA9, 0x1E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA4, 0x1A, 0xE7, 0x1F,
+    0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x09, 0x7F, 0xD9, 0x6F, 0xE6, 0xFD, 0x6F, 0xC9, 0x6A, 0xFC,
+    0x70, 0xFC, 0x70, 0x9F, 0x71, 0xF7, 0x1F, 0x71, 0xFF, 0xE9, 0x1F, 0xFE, 0x91, 0xFF, 0xE9, 0x2E,
+    0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xFA, 0x3F, 0xC9, 0x2F, 0xCA, 0x1F,
+    0xC9, 0x1F, 0xCA, 0x2A, 0xFA, 0x39, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA1, 0x77,
+    0x70, 0xAE, 0xA7, 0x29, 0xEA, 0x73, 0xE9, 0x73, 0xAD, 0x77, 0x70, 0xAF, 0x69, 0xE0, 0xFD, 0x59,
+    0xE0, 0xFD, 0x94, 0x9E, 0x0F, 0xE4, 0x9E, 0x0F, 0xEA, 0x39, 0xE0, 0xE9, 0xF3, 0x9E, 0x0E, 0xA9,
+    0xEA, 0x29, 0xE0, 0xEA, 0x0F, 0x91, 0x9E, 0x0E, 0xA1, 0xF1, 0x9E, 0x0E, 0xA1, 0xAE, 0x90, 0x9E,
+    0x0E, 0xA2, 0xF0, 0x9E, 0x0E, 0xA2, 0x9E, 0xA0, 0xE0, 0xEA, 0x3F, 0x9E, 0x0E, 0xA3, 0x9F, 0xE0,
+    0xEA, 0x4A, 0xFD, 0x0E, 0xA5, 0xFD, 0x0E, 0xA5, 0xAF, 0xC0, 0xEA, 0x6F, 0xC0, 0x77, 0x49, 0xEA,
+    0x79, 0xEA, 0x70, 0xE9, 0x70, 0xAD, 0x77, 0x4A, 0xAA, 0x19, 0xEA, 0x3E, 0x0F, 0xE9, 0x1F, 0xFF,
+    0x1F, 0xC9, 0x09, 0xF9, 0x0F, 0x3A, 0xE9, 0x0F, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39,
+    0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E,
+    0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0xAF, 0x69, 0xE0, 0xFD, 0x59, 0xE0, 0xFD, 0x94, 0x9E, 0x0F,
+    0xE4, 0x9E, 0x0F, 0xEA, 0x39, 0xE0, 0xE9, 0xF3, 0x9E, 0x0E, 0xA9, 0xEA, 0x29, 0xE0, 0xEA, 0x0F,
+    0x91, 0x9E, 0x0E, 0xA1, 0xF1, 0x9E, 0x0E, 0xA1, 0xAE, 0x90, 0x9E, 0x0E, 0xA2, 0xF0, 0x9E, 0x0E,
+    0xA2, 0x9E, 0xA0, 0xE0, 0xEA, 0x3F, 0x9E, 0x0E, 0xA3, 0x9F, 0xE0, 0xEA, 0x4A, 0xFD, 0x0E, 0xA5,
+    0xFD, 0x0E, 0xA5, 0xAF, 0xC0, 0xEA, 0x6F, 0xC7, 0x77, 0x09, 0x99, 0x74, 0x9E, 0x74, 0xAD, 0x97,
+    0x4E, 0x75, 0xAA, 0x70, 0x0A, 0xAA, 0x19, 0xEA, 0x3E, 0x0F, 0xE9, 0x1F, 0xFF, 0x1F, 0xC9, 0x09,
+    0xF9, 0x0F, 0x3A, 0xE9, 0x0F, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3,
+    0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90,
+    0xEA, 0x39, 0xE9, 0x77, 0x39, 0x99, 0x71, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xAA, 0x60, 0x77,
+    0x3A, 0xDA, 0x2A, 0xD9, 0x6A, 0xDA, 0x9E, 0x97, 0x0F, 0xDA, 0x72, 0xFA, 0x77, 0x6A, 0xF6, 0x9E,
+    0x0F, 0xD5, 0x9E, 0x0F, 0xD9, 0x49, 0xE0, 0xFE, 0x49, 0xE0, 0xFE, 0xA3, 0x9E, 0x0E, 0x9F, 0x39,
+    0xE0, 0xEA, 0x9E, 0xA2, 0x9E, 0x0E, 0xA0, 0xF9, 0x19, 0xE0, 0xEA, 0x1F, 0x19, 0xE0, 0xEA, 0x1A,
+    0xE9, 0x09, 0xE0, 0xEA, 0x2F, 0x09, 0xE0, 0xEA, 0x29, 0xEA, 0x0E, 0x0E, 0xA3, 0xF9, 0xE0, 0xEA,
+    0x39, 0xFE, 0x0E, 0xA4, 0xAF, 0xD0, 0xEA, 0x5F, 0xD0, 0xEA, 0x5A, 0xFC, 0x0E, 0xA6, 0xFC, 0x00,
+    0x77, 0xAD, 0xA2, 0xAD, 0x93, 0xAE, 0x9E, 0x95, 0xFD, 0xA7, 0xFA, 0x77, 0x2A, 0xAA, 0x19, 0xEA,
+    0x3E, 0x0F, 0xE9, 0x1F, 0xFF, 0x1F, 0xC9, 0x09, 0xF9, 0x0F, 0x3A, 0xE9, 0x0F, 0x39, 0xE9, 0x0E,
+    0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E,
+    0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x1E, 0xA7, 0x6E, 0x97, 0x59,
+    0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x90, 0xAA, 0xA1, 0x9E, 0xA9, 0x2E, 0x1E, 0x9F, 0xE9, 0x19, 0x92,
+    0xFF, 0xF6, 0xFC, 0x90, 0x9F, 0x95, 0xF3, 0x9E, 0xA5, 0xF4, 0xEA, 0x5F, 0x4E, 0xA5, 0xEA, 0x4E,
+    0xA5, 0xEA, 0x4E, 0xA5, 0xEA, 0x4E, 0xA5, 0xEA, 0x4E, 0xA5, 0xEA, 0x4E, 0xA5, 0xEA, 0x4E, 0xA5,
+    0xEA, 0x4E, 0xA0, 0xAF, 0x95, 0x9E, 0x0F, 0xD5, 0x9E, 0x0F, 0xDA, 0x49, 0xE0, 0xFE, 0x93, 0x9E,
+    0x0F, 0xF3, 0x9E, 0x0E, 0x9F, 0xC2, 0x9E, 0x0E, 0xA0, 0xFA, 0x19, 0xE0, 0xEA, 0x09, 0xF1, 0x9E,
+    0x0E, 0xA1, 0xAF, 0x09, 0xE0, 0xEA, 0x2F, 0xA0, 0xE0, 0xEA, 0x29, 0xFA, 0xE0, 0xEA, 0x3A, 0xFE,
+    0x0E, 0xA4, 0xFE, 0x0E, 0xA4, 0x9F, 0xD0, 0xEA, 0x5A, 0xFC, 0x0E, 0xA6, 0xFC, 0x0E, 0xA7, 0xF0,
+    0xEA, 0x7A, 0xE7, 0x49, 0xE7, 0x4A, 0xE7, 0x0C, 0xAA, 0xFA, 0x70, 0xFE, 0x71, 0xFC, 0xA7, 0x73,
+    0x0A, 0xAA, 0x1A, 0xEA, 0x3E, 0x0F, 0xE9, 0x1F, 0xFF, 0x1F, 0xC9, 0x09, 0xF9, 0x0F, 0x39, 0xE9,
+    0x0F, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39,
+    0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x70,
+    0x9E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x95, 0x9F, 0xD6, 0x9F, 0xCA, 0x7F, 0x91, 0x4A, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x09, 0xFF, 0x71, 0xFF, 0x77, 0x73, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9,
+    0x29, 0xFA, 0x29, 0xFC, 0x2F, 0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9,
+    0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F,
+    0xA5, 0xAE, 0xA1, 0x9F, 0xA3, 0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77,
+    0x60, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xF4, 0x9F, 0xF7, 0x74, 0xAE, 0xA9, 0x5A, 0xFF, 0x3A,
+    0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xAE, 0x9F, 0x49, 0xE9, 0xF4, 0x9E,
+    0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A, 0xFA, 0xAF, 0x92, 0xFF, 0xCA, 0x49,
+    0xFD, 0x97, 0x70, 0x49, 0x59, 0x97, 0xAC, 0xA3, 0xAD, 0x70, 0xFF, 0x97, 0x0A, 0xFD, 0xA7, 0x29,
+    0xAD, 0xA9, 0x77, 0x74, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29, 0xFC,
+    0x2F, 0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE, 0x9A,
+    0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1, 0x9F,
+    0xA3, 0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77, 0x60, 0x29, 0x59, 0x4A,
+    0xCA, 0x3A, 0xCA, 0x39, 0xFF, 0x94, 0xAF, 0xDA, 0x69, 0xAD, 0xA9, 0x77, 0x5A, 0xEA, 0x95, 0xAF,
+    0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F,
+    0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC,
+    0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x77, 0x6F, 0x0F, 0x79, 0xE0, 0xAE, 0x70, 0xE1, 0xDA, 0x70, 0xAC,
+    0xA1, 0xAC, 0xA7, 0x77, 0x5A, 0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F,
+    0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9,
+    0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19,
+    0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0x77, 0x0F, 0x0E,
+    0xA3, 0x9E, 0x0A, 0xE4, 0xE0, 0x9D, 0xA4, 0xAC, 0xA1, 0xAC, 0x97, 0x76, 0xAE, 0xA9, 0x5A, 0xFF,
+    0x3A, 0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xAE, 0x9F, 0x49, 0xE9, 0xF4,
+    0x9E, 0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A, 0xFA, 0xAF, 0x92, 0xFF, 0xCA,
+    0x49, 0xFD, 0x97, 0x70, 0x77, 0x71, 0x9A, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xFD, 0x1A, 0xFF, 0xFF,
+    0xE0, 0x9F, 0xA2, 0x9F, 0x99, 0x99, 0x99, 0x1F, 0x94, 0xF7, 0xF5, 0xF6, 0x9E, 0xA5, 0xF6, 0x9E,
+    0x95, 0xFF, 0xD9, 0xAE, 0x95, 0xFF, 0xD9, 0xAE, 0x95, 0xFF, 0xD9, 0x9E, 0x95, 0xF9, 0x99, 0x99,
+    0x90, 0x9E, 0xA5, 0xF7, 0xF5, 0xF7, 0xF9, 0x4F, 0x79, 0xF9, 0x3F, 0x70, 0xAF, 0xFF, 0xFE, 0x2F,
+    0xFF, 0xFE, 0x39, 0xFF, 0xFF, 0xC7, 0x75, 0x3A, 0xEA, 0x92, 0x9A, 0xEA, 0x5A, 0xFF, 0x9F, 0xF9,
+    0x2A, 0xFF, 0xFF, 0xE9, 0x1F, 0x91, 0xAF, 0xC9, 0x2F, 0x0A, 0xE9, 0x3F, 0xA3, 0x9E, 0x0A, 0xE4,
+    0xAE, 0xA9, 0x99, 0x99, 0xE9, 0xF4, 0x9F, 0xFF, 0x9F, 0x49, 0xFF, 0xF9, 0xF4, 0xAE, 0x97, 0x0A,
+    0xE9, 0x3F, 0xA7, 0x1F, 0x29, 0xFC, 0x95, 0x91, 0xAF, 0xFF, 0xCA, 0xAA, 0xAD, 0xA2, 0xFF, 0xCA,
+    0xFF, 0xCA, 0x3A, 0xFC, 0xA2, 0xAF, 0xDA, 0x77, 0x70, 0x77, 0x49, 0xF7, 0x1E, 0xA7, 0x1E, 0x97,
+    0x1A, 0xD9, 0x77, 0x5A, 0xFD, 0xAA, 0x5F, 0xFD, 0xA3, 0xFF, 0xF2, 0xF2, 0x9F, 0x91, 0xF3, 0xAE,
+    0xA1, 0xF3, 0x9E, 0xA1, 0xF3, 0x9E, 0x91, 0xF3, 0xF2, 0xFF, 0xE9, 0x2F, 0xFD, 0x93, 0xFF, 0xCA,
+    0x4F, 0x1A, 0xE4, 0xF2, 0xF3, 0xF2, 0xAE, 0xA2, 0xF3, 0xF2, 0xF3, 0x9F, 0x1F, 0x4F, 0x90, 0xF5,
+    0xF0, 0x77, 0x9F, 0x5E, 0xA5, 0xE9, 0x5A, 0xD7, 0x70, 0xAA, 0xA1, 0x9D, 0xA1, 0xE0, 0xAE, 0xA1,
+    0xEA, 0xFA, 0x1F, 0xDA, 0xA9, 0x1F, 0xA5, 0xF6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E,
+    0xA6, 0xEA, 0x6E, 0xA5, 0xAF, 0xDA, 0xA5, 0xFF, 0xDA, 0x3F, 0xFF, 0x2F, 0x29, 0xF9, 0x1F, 0x3A,
+    0xEA, 0x1F, 0x39, 0xEA, 0x1F, 0x39, 0xE9, 0x1F, 0x3F, 0x2F, 0xFE, 0x92, 0xFF, 0xD9, 0x3F, 0xFC,
+    0xA4, 0xF1, 0xAE, 0x4F, 0x2F, 0x3F, 0x2A, 0xEA, 0x2F, 0x3F, 0x2F, 0x39, 0xF1, 0xF4, 0xF9, 0x0F,
+    0x5F, 0x77, 0x49, 0x99, 0x97, 0x2E, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x29, 0xA9, 0x70, 0x0A, 0xAA,
+    0x19, 0xDA, 0x0E, 0x0A, 0xEA, 0x0E, 0xAF, 0xA0, 0xFD, 0xAA, 0x90, 0xFA, 0x4F, 0x5E, 0xA5, 0xEA,
+    0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x77, 0x99, 0x99, 0x5E, 0xA5, 0xE6, 0xDA,
+    0x6A, 0xA6, 0x77, 0x9D, 0xA2, 0xAD, 0x94, 0xAE, 0x0E, 0xA6, 0xAF, 0xCA, 0x70, 0xFC, 0x77, 0x4A,
+    0xFD, 0xAA, 0x5F, 0xFD, 0xA3, 0xFF, 0xF2, 0xF2, 0x9F, 0x91, 0xF3, 0xAE, 0xA1, 0xF3, 0x9E, 0xA1,
+    0xF3, 0x9E, 0x91, 0xF3, 0xF2, 0xFF, 0xE9, 0x2F, 0xFD, 0x93, 0xFF, 0xCA, 0x4F, 0x1A, 0xE4, 0xF2,
+    0xF3, 0xF2, 0xAE, 0xA2, 0xF3, 0xF2, 0xF3, 0x9F, 0x1F, 0x4F, 0x90, 0xF5, 0xF0, 0x72, 0xAD, 0xA2,
+    0xAD, 0x90, 0xAE, 0x0E, 0xA2, 0xAF, 0xCA, 0x4F, 0xA7, 0x6A, 0xAA, 0x19, 0xDA, 0x1E, 0x0A, 0xEA,
+    0x1E, 0xAF, 0xA1, 0xFD, 0xAA, 0x91, 0xFA, 0x5F, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA, 0x6E, 0xA6,
+    0xEA, 0x6E, 0xA6, 0xEA, 0x50, 0x77, 0x1F, 0x6F, 0x6A, 0xDA, 0x69, 0xD9, 0x77, 0x3A, 0xFC, 0xA9,
+    0x19, 0xFF, 0xCA, 0x0F, 0xFD, 0x09, 0xEA, 0x29, 0xAA, 0x0A, 0xE7, 0xAE, 0x79, 0xF9, 0x6F, 0xD9,
+    0x5F, 0xDA, 0x5A, 0xFD, 0x94, 0x9F, 0xD6, 0x9F, 0xA7, 0xEA, 0x7F, 0xD9, 0x3A, 0xEA, 0xFF, 0xE0,
+    0xFF, 0xD9, 0x09, 0xAF, 0xDA, 0x76, 0x77, 0x9F, 0x5E, 0xA5, 0xE9, 0x5A, 0xD7, 0x71, 0x9A, 0xEA,
+    0x92, 0xFF, 0xC0, 0xAF, 0xFC, 0x0F, 0x39, 0x90, 0xF9, 0x5A, 0xFC, 0x94, 0xFE, 0x93, 0xAF, 0xDA,
+    0x49, 0xFC, 0x95, 0x9E, 0x99, 0x5E, 0x9E, 0xAA, 0xAF, 0x0F, 0xFC, 0xA0, 0x9F, 0xE9, 0x74, 0x76,
+    0x9F, 0x95, 0xFD, 0x4E, 0x99, 0xE2, 0xAC, 0xA3, 0xDA, 0x77, 0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0xA0,
+    0xFF, 0xD0, 0x9E, 0xA2, 0x9A, 0xA0, 0xAE, 0x7A, 0xE7, 0x9F, 0x96, 0xFD, 0x95, 0xFD, 0xA5, 0xAF,
+    0xD9, 0x49, 0xFD, 0x69, 0xFA, 0x7E, 0xA7, 0xFD, 0x93, 0xAE, 0xAF, 0xFE, 0x0F, 0xFD, 0x90, 0x9A,
+    0xFD, 0xA7, 0x60, 0x75, 0xFA, 0x4F, 0xD9, 0x2E, 0x90, 0xE9, 0x0A, 0xD3, 0xAD, 0x75, 0x9A, 0xEA,
+    0x92, 0xFF, 0xC0, 0xAF, 0xFC, 0x0F, 0x39, 0x90, 0xF9, 0x5A, 0xFC, 0x94, 0xFE, 0x93, 0xAF, 0xDA,
+    0x49, 0xFC, 0x95, 0x9E, 0x99, 0x5E, 0x9E, 0xAA, 0xAF, 0x0F, 0xFC, 0xA0, 0x9F, 0xE9, 0x74, 0x76,
+    0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0xA0, 0xFF, 0xD0, 0x9E, 0xA2, 0x9A, 0xA0, 0xAE, 0x7A, 0xE7, 0x9F,
+    0x96, 0xFD, 0x95, 0xFD, 0xA5, 0xAF, 0xD9, 0x49, 0xFD, 0x69, 0xFA, 0x7E, 0xA7, 0xFD, 0x93, 0xAE,
+    0xAF, 0xFE, 0x0F, 0xFD, 0x90, 0x9A, 0xFD, 0xA6, 0xAC, 0xA7, 0x0E, 0xA7, 0x0A, 0xD9, 0x79, 0xD9,
+    0x5F, 0xC6, 0xF9, 0x30, 0x19, 0xAE, 0xA9, 0x2F, 0xFC, 0x0A, 0xFF, 0xC0, 0xF3, 0x99, 0x0F, 0x95,
+    0xAF, 0xC9, 0x4F, 0xE9, 0x3A, 0xFD, 0xA4, 0x9F, 0xC9, 0x59, 0xE9, 0x95, 0xE9, 0xEA, 0xAA, 0xF0,
+    0xFF, 0xCA, 0x09, 0xFE, 0x94, 0x9D, 0x7A, 0xE7, 0x0E, 0x7E, 0x4A, 0xFA, 0x4A, 0xEA, 0x30, 0x74,
+    0xAD, 0x92, 0xE9, 0x1E, 0xA9, 0xE9, 0x3F, 0xD9, 0x5F, 0xA7, 0x71, 0xAF, 0xCA, 0x91, 0x9F, 0xFC,
+    0xA0, 0xFF, 0xD0, 0x9E, 0xA2, 0x9A, 0xA0, 0xAE, 0x7A, 0xE7, 0x9F, 0x96, 0xFD, 0x95, 0xFD, 0xA5,
+    0xAF, 0xD9, 0x49, 0xFD, 0x69, 0xFA, 0x7E, 0xA7, 0xFD, 0x93, 0xAE, 0xAF, 0xFE, 0x0F, 0xFD, 0x90,
+    0x9A, 0xFD, 0xA7, 0x60, 0x72, 0xAD, 0xA2, 0xAD, 0x90, 0xAE, 0x0E, 0xA2, 0xAF, 0xCA, 0x4F, 0xA7,
+    0x79, 0xAE, 0xA9, 0x2F, 0xFC, 0x0A, 0xFF, 0xC0, 0xF3, 0x99, 0x0F, 0x95, 0xAF, 0xC9, 0x4F, 0xE9,
+    0x3A, 0xFD, 0xA4, 0x9F, 0xC9, 0x59, 0xE9, 0x95, 0xE9, 0xEA, 0xAA, 0xF0, 0xFF, 0xCA, 0x09, 0xFE,
+    0x97, 0x40, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x2D, 0x72, 0xAE, 0x73, 0xE7,
+    0x2E, 0x7A, 0xFA, 0x7A, 0xEA, 0x40, 0x3A, 0xA7, 0xAD, 0x7E, 0x6A, 0xEA, 0xAA, 0xA1, 0xFF, 0xC0,
+    0x9F, 0xFC, 0x2A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x95, 0x9F,
+    0xE3, 0xFE, 0x4F, 0xD5, 0x9D, 0x7A, 0xDA, 0x79, 0xE7, 0xE4, 0xAF, 0xA4, 0xAE, 0xA1, 0x77, 0x9D,
+    0xA2, 0xAD, 0x93, 0xAE, 0x0E, 0xA5, 0xAF, 0xCA, 0x7F, 0xC7, 0x71, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE4, 0x71, 0x9E, 0x72, 0x9D, 0xA4, 0xAA, 0x3A, 0xD4, 0xAD, 0x3D, 0xA4, 0xE7,
+    0x2A, 0xEA, 0xAA, 0xA5, 0xFF, 0xC4, 0x9F, 0xFC, 0x6A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7,
+    0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE9, 0x71, 0x9F, 0xE7, 0xFE, 0x70, 0xFD, 0x77, 0x30,
+    0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE6, 0x99, 0x9F, 0x99, 0x93, 0xAF, 0xFC, 0x3A, 0xFF, 0xC3, 0xAF, 0xFC, 0x6A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE4, 0x3A, 0xA7, 0xAD, 0x7E,
+    0x6A, 0xEA, 0xAA, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x2A, 0xE6, 0xAE, 0x5A, 0xFA, 0xAA, 0x2F, 0xF9,
+    0x1F, 0xF9, 0x2A, 0xE6, 0xAE, 0x6A, 0xE9, 0x59, 0xFE, 0x3F, 0xE4, 0xFD, 0x73, 0x29, 0xDA, 0x2C,
+    0xA4, 0xAF, 0xCA, 0xDA, 0x4D, 0xAA, 0xFC, 0x5C, 0xA2, 0xAC, 0xA7, 0x73, 0xAE, 0x6E, 0xAF, 0x6F,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F, 0xE9, 0x77,
+    0x10, 0x3A, 0xCA, 0x2A, 0xC4, 0xFD, 0xAD, 0x3A, 0xDA, 0xFC, 0xA3, 0xAC, 0x29, 0xD9, 0x77, 0x1A,
+    0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA,
+    0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9,
+    0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A,
+    0xD9, 0x75, 0x29, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A, 0xFE, 0xA5, 0xAF, 0xE9, 0x77, 0x1A, 0xE6, 0xEA,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xFF, 0x6E, 0xAA, 0xE9, 0x49, 0xEA, 0x9F, 0x92, 0x9F, 0x1F, 0xFF, 0xA2, 0xFF, 0xDA, 0x49, 0xFE,
+    0x97, 0x71, 0x2A, 0xAA, 0xAA, 0xAA, 0xA5, 0xFF, 0x94, 0xFF, 0x77, 0x1A, 0xAA, 0x94, 0xAA, 0xA9,
+    0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3,
+    0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90,
+    0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A, 0xD9, 0x75, 0x29, 0x95,
+    0x95, 0xD4, 0xD9, 0x4A, 0xFF, 0x6F, 0xE7, 0x09, 0xEA, 0x77, 0x3A, 0xE6, 0xEA, 0xF6, 0xFF, 0x6F,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6E, 0xAA,
+    0xE9, 0x49, 0xEA, 0x9F, 0x92, 0x9F, 0x1F, 0xFF, 0xA2, 0xFF, 0xDA, 0x49, 0xFE, 0x97, 0x71, 0x29,
+    0x59, 0x93, 0x9D, 0x39, 0xD4, 0xFF, 0xA4, 0x9F, 0xE7, 0xAD, 0xA9, 0x77, 0x2A, 0xAA, 0x94, 0xAA,
+    0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E,
+    0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE,
+    0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A, 0xD9, 0x75, 0x4A,
+    0xDA, 0x71, 0xAF, 0xC7, 0x0D, 0x1D, 0x70, 0xD1, 0xD7, 0x0A, 0xFC, 0x71, 0x9D, 0xA7, 0x74, 0xAE,
+    0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4,
+    0x9F, 0xE9, 0x77, 0x10, 0x4A, 0xDA, 0x70, 0xAF, 0xC7, 0xD1, 0xD7, 0xD1, 0xD7, 0xAF, 0xC7, 0x0A,
+    0xDA, 0x77, 0x3A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3,
+    0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99,
+    0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91,
+    0x9F, 0xCA, 0x0A, 0xD9, 0x75, 0x77, 0x2E, 0xA9, 0xE9, 0x4E, 0xA0, 0xE9, 0x4A, 0xD9, 0x0A, 0xD9,
+    0x5D, 0x91, 0xD7, 0x74, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF,
+    0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1,
+    0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F, 0xE9, 0x77, 0x10, 0x77, 0x0A, 0xE0, 0xAE, 0x4E, 0x99, 0xE4,
+    0xE1, 0xE4, 0x9C, 0xA1, 0x9C, 0xA7, 0x73, 0xAA, 0xA9, 0x4A, 0xAA, 0x99, 0xEA, 0x39, 0xE9, 0x9E,
+    0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E,
+    0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x90, 0xEA, 0x3A, 0xE9, 0x0F, 0x29, 0xF9, 0x0F, 0xFF,
+    0x90, 0x9F, 0xEA, 0xE9, 0x19, 0xFC, 0xA0, 0xAD, 0x97, 0x50, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF,
+    0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xEA, 0xAE,
+    0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFE, 0x49, 0xFE, 0xA7, 0x2A, 0xD7, 0x3D,
+    0x97, 0x29, 0xD7, 0x39, 0xDA, 0x97, 0x2F, 0xA7, 0x19, 0xE9, 0x10, 0x0A, 0xAA, 0x94, 0xAA, 0xA9,
+    0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3,
+    0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90,
+    0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F, 0xCA, 0x0A, 0xD9, 0x71, 0xD7, 0x2D,
+    0x97, 0x19, 0xD7, 0x2A, 0xDA, 0x97, 0x1F, 0x97, 0x09, 0xAC, 0xA0, 0x77, 0x77, 0x19, 0xF9, 0x77,
+    0x2F, 0xD7, 0x71, 0xE9, 0x9E, 0x77, 0xAC, 0xA3, 0xDA, 0x77, 0x77, 0x0E, 0xA5, 0xAE, 0x5A, 0xE0,
+    0xAE, 0x5F, 0x5F, 0x09, 0xE9, 0x39, 0xF9, 0x4E, 0xA1, 0xEA, 0x3A, 0xFA, 0x39, 0xE9, 0x1E, 0xA3,
+    0xFD, 0x3A, 0xE2, 0xAE, 0x3E, 0xAD, 0x92, 0xF2, 0x9E, 0x29, 0xDA, 0xAD, 0xA2, 0xEA, 0x3E, 0x91,
+    0xAD, 0xA9, 0xE1, 0x9E, 0x93, 0xEA, 0x1E, 0x90, 0xE1, 0xAE, 0x4A, 0xE1, 0xE1, 0xE9, 0x0A, 0xE4,
+    0x9E, 0x09, 0xE1, 0xAD, 0xA0, 0xEA, 0x5E, 0x9A, 0xDA, 0x19, 0xE0, 0xE9, 0x5E, 0xAE, 0x92, 0xE9,
+    0xE6, 0xAD, 0xAE, 0x3E, 0xAE, 0x69, 0xFD, 0x3A, 0xFC, 0xA7, 0xFC, 0x93, 0x9F, 0xC9, 0x7F, 0xC5,
+    0xFC, 0x70, 0xAF, 0x5F, 0xC4, 0x77, 0x75, 0xAF, 0x77, 0x9F, 0xD7, 0x59, 0xE0, 0xAE, 0x74, 0xDA,
+    0x29, 0xDA, 0x77, 0x73, 0x9A, 0xAA, 0x39, 0xAA, 0xAA, 0x39, 0xAA, 0xA0, 0x9E, 0x92, 0xAF, 0x3F,
+    0x1E, 0xA2, 0xFC, 0x92, 0xEA, 0x1F, 0x2F, 0xCA, 0x19, 0xE2, 0xAE, 0x19, 0xD9, 0xE1, 0xAE, 0x29,
+    0xE9, 0x0A, 0xD0, 0xAD, 0x1E, 0xA3, 0xEA, 0x0E, 0x09, 0xD9, 0x0E, 0x93, 0xAE, 0x0D, 0xA0, 0x9D,
+    0xA9, 0xE4, 0x9E, 0x9D, 0x91, 0xDA, 0xAE, 0x5E, 0xAD, 0x2E, 0xAD, 0xA5, 0xFD, 0x2A, 0xFC, 0x6A,
+    0xFA, 0x29, 0xFC, 0x69, 0xF9, 0x3F, 0xA7, 0xF4, 0xF9, 0x30, 0x77, 0x4A, 0xF7, 0x19, 0xFD, 0x79,
+    0xE0, 0x9E, 0x6D, 0xA2, 0x9D, 0xA7, 0x72, 0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93, 0xAE,
+    0x92, 0xF3, 0xF3, 0xAE, 0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF, 0xD7,
+    0x1F, 0xCA, 0x71, 0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x77,
+    0x3F, 0xA7, 0x0F, 0xD9, 0x6E, 0x90, 0xE5, 0xAD, 0x3A, 0xD7, 0x71, 0xAA, 0xAA, 0x59, 0xAA, 0xA0,
+    0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE, 0x29, 0xE9, 0x2E, 0xA3, 0xEA, 0x19, 0xE9,
+    0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E, 0x69, 0xEA, 0xE7, 0xFD, 0x97, 0xAF, 0xC7,
+    0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x70, 0x9F, 0x7F, 0xDA, 0x7F, 0xCA, 0x70, 0xF9,
+    0x70, 0x3A, 0xC9, 0x1A, 0xCA, 0x6A, 0xE1, 0xE6, 0x9D, 0xA1, 0xE7, 0x99, 0x39, 0x77, 0x4A, 0xE9,
+    0x5A, 0xE9, 0x9F, 0x5F, 0x1A, 0xE9, 0x3A, 0xE9, 0x2F, 0x3F, 0x3A, 0xE9, 0x1A, 0xE9, 0x4F, 0x1F,
+    0x5A, 0xE9, 0xAE, 0x7F, 0xEA, 0x7A, 0xFD, 0x71, 0xFC, 0xA7, 0x19, 0xF7, 0x3F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x50, 0x77, 0x4F, 0x97, 0xAE, 0x97, 0x9E, 0x71, 0xDA, 0x77,
+    0x4F, 0xFF, 0xA0, 0xFF, 0xFA, 0x0F, 0xFF, 0xA0, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x0A, 0xE9, 0x79,
+    0xEA, 0x70, 0xF7, 0x0F, 0x70, 0x9E, 0xA7, 0x0F, 0x70, 0xF7, 0x0A, 0xE9, 0x79, 0xEA, 0x70, 0xF7,
+    0x0A, 0xE9, 0x79, 0xFF, 0xFC, 0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x77, 0x19, 0xF6, 0xEA, 0x6E, 0x96,
+    0xAD, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD9, 0x0F, 0xFD, 0x95, 0x9F, 0x6F, 0x6A,
+    0xE9, 0x59, 0xEA, 0x6F, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0xFD, 0x99, 0xFF, 0xDA, 0x9F, 0xFD,
+    0xA0, 0x77, 0x3E, 0x71, 0xAE, 0x97, 0x0A, 0xE9, 0x71, 0x9A, 0x97, 0x73, 0xFF, 0xFA, 0x0F, 0xFF,
+    0xA0, 0xFF, 0xFA, 0x09, 0x99, 0x99, 0x99, 0x9F, 0x70, 0xAE, 0x97, 0x9E, 0xA7, 0x0F, 0x70, 0xF7,
+    0x09, 0xEA, 0x70, 0xF7, 0x0F, 0x70, 0xAE, 0x97, 0x9E, 0xA7, 0x0F, 0x70, 0xAE, 0x97, 0x9F, 0xFF,
+    0xC9, 0xFF, 0xFC, 0x9F, 0xFF, 0xC0, 0x77, 0x9D, 0xA7, 0xF7, 0xF7, 0x0A, 0xA9, 0x77, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD9, 0x0F, 0xFD, 0x95, 0x9F, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F,
+    0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0xFD, 0x99, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x77, 0x9D, 0xA2,
+    0xAD, 0x93, 0xAE, 0x0E, 0xA5, 0xAF, 0xCA, 0x7F, 0xC7, 0x72, 0xFF, 0xFA, 0x0F, 0xFF, 0xA0, 0xFF,
+    0xFA, 0x09, 0x99, 0x99, 0x99, 0x9F, 0x70, 0xAE, 0x97, 0x9E, 0xA7, 0x0F, 0x70, 0xF7, 0x09, 0xEA,
+    0x70, 0xF7, 0x0F, 0x70, 0xAE, 0x97, 0x9E, 0xA7, 0x0F, 0x70, 0xAE, 0x97, 0x9F, 0xFF, 0xC9, 0xFF,
+    0xFC, 0x9F, 0xFF, 0xC0, 0x74, 0xAD, 0xA2, 0xAD, 0x91, 0xAE, 0x0E, 0xA3, 0xAF, 0xCA, 0x5F, 0xA7,
+    0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD9, 0x0F, 0xFD, 0x95, 0x9F, 0x6F, 0x6A, 0xE9, 0x59,
+    0xEA, 0x6F, 0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0xFD, 0x99, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x73,
+    0x9F, 0xD1, 0x9F, 0xE1, 0xFE, 0x91, 0xF5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5,
+    0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x5E, 0xA5, 0xEA, 0x40, 0x77, 0xAE,
+    0x94, 0xAF, 0xDA, 0x2A, 0xE3, 0xAF, 0xFD, 0x90, 0xEA, 0x2A, 0xFF, 0xFF, 0x29, 0xFA, 0x29, 0xFE,
+    0x92, 0xFA, 0x5F, 0xC4, 0xF7, 0xF3, 0x9E, 0xA7, 0xF3, 0xAE, 0xA7, 0xAE, 0x92, 0xAE, 0x97, 0xAE,
+    0x92, 0xAE, 0x97, 0xAE, 0x92, 0xAE, 0xA7, 0xAE, 0x92, 0x9E, 0xA7, 0xF4, 0xF7, 0xF4, 0xFA, 0x5A,
+    0xEA, 0x49, 0xFA, 0x3A, 0xF6, 0xAF, 0xFF, 0x97, 0xAF, 0xFD, 0xA7, 0x19, 0xAF, 0xDA, 0x77, 0x74,
+    0x74, 0xAA, 0xAA, 0x74, 0xEA, 0x3A, 0xEA, 0x91, 0x9E, 0x91, 0xAF, 0xF9, 0xF1, 0xAF, 0xFF, 0xC2,
+    0xF9, 0x1A, 0xFA, 0x29, 0xEA, 0x3F, 0x3A, 0xE4, 0xAE, 0x92, 0xF4, 0x9E, 0x92, 0xF4, 0x9E, 0x92,
+    0xAE, 0x4A, 0xE9, 0x2A, 0xE9, 0x3F, 0x4F, 0x29, 0xF4, 0xAF, 0xFD, 0x95, 0xFF, 0xCA, 0x79, 0xFD,
+    0x97, 0x76, 0x77, 0x76, 0xAF, 0xD9, 0x29, 0xFC, 0xA5, 0xAF, 0xFD, 0x0A, 0xFF, 0x3A, 0xFF, 0xFF,
+    0xFC, 0x91, 0x9F, 0xA9, 0x19, 0xFC, 0xA2, 0xAF, 0x1F, 0xA5, 0xF4, 0xF1, 0xF6, 0xAE, 0xA3, 0xF0,
+    0x9F, 0x69, 0xF3, 0xF0, 0x9E, 0xA7, 0xF3, 0xF0, 0xAE, 0xA7, 0xF3, 0xF0, 0xAE, 0xA7, 0xF3, 0xF0,
+    0x9E, 0xA7, 0xF3, 0xF0, 0x9F, 0x69, 0xF3, 0xF1, 0xF6, 0xAE, 0xA3, 0xF1, 0xFA, 0x5F, 0x4F, 0x19,
+    0xFA, 0x29, 0xFC, 0x4F, 0x2A, 0xFF, 0xF5, 0xF3, 0xAF, 0xFD, 0x95, 0xF4, 0x9F, 0xEA, 0x7F, 0x77,
+    0x72, 0x29, 0xAE, 0xA9, 0x2A, 0xEA, 0x4A, 0xFE, 0xA9, 0xFE, 0x2A, 0xFF, 0xFF, 0xD1, 0xF9, 0x09,
+    0xFC, 0x19, 0xF0, 0xAE, 0x92, 0x9E, 0x92, 0xAE, 0x9A, 0xE4, 0xEA, 0x29, 0xE9, 0xF4, 0xF2, 0x9E,
+    0x9F, 0x4F, 0x29, 0xE9, 0xF4, 0xF2, 0x9E, 0x9A, 0xE3, 0x9E, 0xA2, 0x9E, 0x99, 0xF2, 0xF9, 0x29,
+    0xE9, 0x0F, 0xFE, 0x39, 0xE9, 0x1F, 0xFC, 0x49, 0xE9, 0x2A, 0xFC, 0xA5, 0x9E, 0x97, 0x79, 0xE9,
+    0x77, 0x9E, 0x97, 0x79, 0xE9, 0x77, 0x9E, 0x97, 0x79, 0xE9, 0x77, 0x9E, 0x90, 0x1A, 0xFF, 0xCA,
+    0xA9, 0x3F, 0xFF, 0xDA, 0x1A, 0xFF, 0xFE, 0xA0, 0xF9, 0xF9, 0x99, 0xAF, 0x0E, 0x90, 0xF3, 0xAE,
+    0x99, 0xAA, 0x90, 0xF3, 0x9E, 0xA4, 0xF3, 0x9E, 0xA4, 0xF3, 0xF9, 0x4F, 0xAA, 0xAF, 0xC5, 0xFF,
+    0xE9, 0x5F, 0xFD, 0x96, 0xFA, 0xAA, 0xA9, 0x70, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+    0x70, 0x77, 0x9F, 0x79, 0xFC, 0x7F, 0xD7, 0xF7, 0x1F, 0x71, 0xEA, 0x09, 0xEA, 0x3E, 0xAA, 0xFD,
+    0x2F, 0xFE, 0xA1, 0xFC, 0x90, 0x9F, 0x1F, 0x3A, 0xE9, 0x0F, 0x39, 0xEA, 0x0F, 0x4F, 0x0F, 0x4F,
+    0x0F, 0x4E, 0xA0, 0xF3, 0x9E, 0xA0, 0xFA, 0x2F, 0x90, 0xFF, 0xF1, 0xFF, 0xE9, 0x1E, 0xA9, 0xFC,
+    0x92, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x70, 0xAE, 0x72, 0xF7, 0x2F, 0x99, 0x97,
+    0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0xFF, 0xF2, 0xF3, 0xF9, 0x1F, 0x39, 0xEA, 0x1F, 0x39, 0xEA, 0x1F,
+    0x3A, 0xE9, 0x1F, 0xA9, 0xAF, 0xC2, 0xFF, 0xE3, 0xFF, 0xCA, 0x4F, 0xAA, 0xF4, 0xF1, 0x9E, 0xA3,
+    0xF2, 0xF3, 0xF3, 0xF2, 0xF3, 0xAE, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xAA, 0xA0, 0x75, 0xAF,
+    0xCA, 0x91, 0x9F, 0xFC, 0x91, 0xFF, 0xD1, 0xAC, 0xA9, 0x1A, 0xEA, 0x7E, 0xA6, 0x9E, 0xA5, 0x9F,
+    0xA3, 0x9F, 0xD2, 0x9F, 0xE9, 0x19, 0xFD, 0xA2, 0x9F, 0xCA, 0x4A, 0xF6, 0xF7, 0xF7, 0xF9, 0x39,
+    0xCA, 0x9F, 0xFD, 0xA0, 0xAF, 0xFC, 0xA1, 0x9F, 0xEA, 0x74, 0x09, 0xAF, 0xA9, 0x19, 0xFF, 0xA1,
+    0xFF, 0xC1, 0xAA, 0x29, 0xE9, 0x5A, 0xE9, 0x3A, 0xFC, 0x2A, 0xFD, 0xA1, 0xFE, 0x91, 0xAF, 0xA9,
+    0x3F, 0x6F, 0x49, 0x0F, 0xCA, 0xAA, 0xD0, 0x9F, 0xFC, 0x2F, 0xEA, 0x73, 0x0F, 0xFF, 0xA0, 0xFF,
+    0xFA, 0x0F, 0xFF, 0xA0, 0xAF, 0x19, 0x99, 0x99, 0x2A, 0xEA, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9,
+    0x71, 0xF7, 0x0A, 0xE9, 0x7A, 0xEA, 0x79, 0xEA, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x09, 0xFF, 0xFC,
+    0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x76, 0xFC, 0x95, 0xFE, 0x5D, 0x1E, 0xA4, 0xD9, 0x0E, 0xA4, 0xAF,
+    0xE5, 0x9A, 0xAF, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70,
+    0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xAF, 0xDA, 0x5F, 0xDA,
+    0x6A, 0xF9, 0x3A, 0xA7, 0xAD, 0x7E, 0x6A, 0xEA, 0xAA, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x2A, 0xE9,
+    0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A, 0xE9, 0x59, 0xFE, 0x3F, 0xE4, 0xFD,
+    0x69, 0xE7, 0xE7, 0xE4, 0x9F, 0xC4, 0x9F, 0xA4, 0x9E, 0xA1, 0x19, 0xAF, 0xFE, 0x0F, 0xFF, 0xDA,
+    0xFF, 0xFF, 0xCA, 0x99, 0xF9, 0x99, 0x99, 0xE2, 0xAE, 0x4A, 0xD2, 0xAE, 0x72, 0xAE, 0x72, 0xAE,
+    0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE, 0x72, 0xAE,
+    0x72, 0xAE, 0x72, 0xAE, 0x40, 0x76, 0xAF, 0x93, 0xFD, 0x92, 0x9F, 0xD9, 0x2A, 0xE9, 0x5A, 0xE6,
+    0xFA, 0xAA, 0xA1, 0xFF, 0xC0, 0x9F, 0xFC, 0x2A, 0xE9, 0x5A, 0xE6, 0xAE, 0x6A, 0xE6, 0xAE, 0x6A,
+    0xE6, 0xAE, 0x6A, 0xE9, 0x59, 0xFE, 0x3F, 0xE4, 0xFD, 0x73, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF,
+    0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A,
+    0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE9, 0x70, 0x9F, 0xD7, 0xFD, 0x70, 0xAE, 0xA1,
+    0x77, 0xAE, 0x9A, 0xE6, 0xEA, 0x0A, 0xE0, 0xF6, 0xF0, 0xEA, 0x0F, 0x6F, 0xF1, 0xF6, 0xFE, 0x2F,
+    0x6F, 0xA9, 0x3F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F,
+    0x5F, 0x6E, 0xA5, 0xAE, 0x94, 0x9E, 0xA5, 0x9F, 0x92, 0x9F, 0x7F, 0xFF, 0xA7, 0x0F, 0xFD, 0xA7,
+    0x29, 0xFE, 0x97, 0x77, 0x50, 0x76, 0xAA, 0xAA, 0x76, 0xEA, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E,
+    0x99, 0xEA, 0x39, 0xEA, 0xF0, 0x9E, 0xA3, 0x9F, 0xE1, 0x9E, 0xA3, 0x9F, 0xCA, 0x29, 0xEA, 0x39,
+    0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x3A,
+    0xE9, 0x5E, 0xA3, 0xF9, 0x5F, 0x29, 0xF9, 0x5F, 0xFF, 0x95, 0x9F, 0xEA, 0xE9, 0x69, 0xFC, 0x90,
+    0xAD, 0x97, 0x77, 0x70, 0xF9, 0x3A, 0xE4, 0xAE, 0x49, 0xDA, 0x73, 0xAE, 0xA2, 0x9E, 0x92, 0x9E,
+    0x93, 0xDA, 0x40, 0x75, 0x9F, 0x93, 0x9F, 0xD3, 0xE0, 0x9E, 0x1D, 0xA3, 0xDA, 0x1A, 0xD9, 0x19,
+    0xC9, 0x0F, 0xDA, 0xD9, 0x9D, 0xAF, 0xD0, 0x9C, 0x91, 0x9A, 0xCA, 0x10, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xA1, 0xFF, 0x1F, 0xF0, 0x74, 0xFF, 0xD1, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09,
+    0x59, 0x90, 0x9D, 0x39, 0xD1, 0xFF, 0xA1, 0x9F, 0xE4, 0xAD, 0xA9, 0x20, 0x6A, 0xDA, 0x1F, 0x1F,
+    0x2A, 0xA1, 0x0A, 0xC9, 0x19, 0xCA, 0x09, 0xE1, 0xE9, 0x9E, 0x1E, 0x19, 0x93, 0x99, 0x00, 0x9A,
+    0xAA, 0x91, 0x9F, 0xA1, 0x99, 0xE3, 0xE1, 0x9E, 0x91, 0x9D, 0x71, 0x1A, 0xD9, 0x1F, 0xC9, 0x0C,
+    0xA1, 0xD0, 0xCA, 0x1D, 0x0F, 0xC9, 0x1A, 0xD9, 0x00, 0x74, 0xEA, 0x0E, 0xA0, 0xAD, 0xA0, 0xEA,
+    0x09, 0xDA, 0x09, 0xDA, 0x1A, 0xC9, 0x1D, 0x92, 0x74, 0xAD, 0x92, 0xE2, 0xEA, 0x9E, 0x93, 0xFD,
+    0x95, 0xFA, 0x20, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x9D, 0x99, 0xD9, 0x30, 0x09, 0x91, 0x99, 0x09,
+    0xD1, 0xD9, 0x9D, 0x1D, 0x99, 0xD1, 0xD9, 0x9D, 0x1D, 0x97, 0x74, 0xEA, 0x0E, 0x93, 0xE0, 0x9E,
+    0x4D, 0xA0, 0x9D, 0xA4, 0xD1, 0x9D, 0x00, 0x39, 0x79, 0xD9, 0x39, 0x0A, 0xD9, 0x09, 0x09, 0xCA,
+    0x0A, 0xA0, 0xAC, 0x90, 0xDA, 0x99, 0xAD, 0x19, 0xFD, 0x92, 0x9A, 0xDA, 0x20, 0x49, 0x5A, 0xFC,
+    0x2F, 0xF0, 0x9D, 0xA9, 0x99, 0xDA, 0xAC, 0x93, 0x9C, 0xA0, 0x19, 0xD9, 0x1E, 0x2E, 0x1A, 0xDA,
+    0x1E, 0xA0, 0x9E, 0x91, 0x99, 0x91, 0x1E, 0x90, 0x9E, 0x1A, 0xE1, 0xE9, 0x1E, 0x2D, 0xA2, 0x99,
+    0x20, 0x9E, 0x2E, 0x91, 0xEA, 0x19, 0xE2, 0xE2, 0xAD, 0x92, 0x99, 0x00, 0x1E, 0x90, 0x9E, 0x1A,
+    0xE1, 0xE9, 0x1E, 0x2D, 0xA2, 0x99, 0x20, 0x71, 0xAE, 0xA4, 0x9E, 0x94, 0x9E, 0x6A, 0xD0, 0x72,
+    0xF2, 0xF2, 0xAD, 0xA2, 0x9D, 0x93, 0x39, 0x39, 0xC1, 0xAA, 0xD1, 0xF3, 0x9C, 0x49, 0x00, 0x09,
+    0x4C, 0x93, 0xDA, 0xA1, 0xF1, 0xC9, 0x39, 0x30, 0xAF, 0xCA, 0x9A, 0xAA, 0xAC, 0xA4, 0xCA, 0x4C,
+    0xA4, 0xCA, 0x4C, 0xA0, 0x2E, 0xA1, 0x9E, 0x91, 0xF1, 0xF9, 0x09, 0xE9, 0x29, 0x40, 0x1A, 0x90,
+    0xDA, 0x9C, 0xA0, 0xAC, 0x91, 0xD9, 0x09, 0xC9, 0x1A, 0xA3, 0xD2, 0x9D, 0x90, 0xAF, 0xA5, 0xAF,
+    0xA9, 0xAD, 0xA9, 0x1D, 0x3D, 0x70, 0x7D, 0x19, 0xAD, 0xA9, 0xAF, 0xA1, 0xD3, 0xAA, 0x10, 0x09,
+    0x99, 0x90, 0xAF, 0xA5, 0x29, 0x99, 0x2E, 0x2E, 0x2E, 0x2E, 0x9A, 0xFA, 0xF9, 0x9E, 0x90, 0x99,
+    0x92, 0xE2, 0xE2, 0xE2, 0xE2, 0xFA, 0x99, 0xFA, 0x09, 0xE9, 0x19, 0x19, 0xE9, 0xAE, 0xA0, 0xE9,
+    0x19, 0x10, 0x0A, 0xC9, 0x19, 0xCA, 0x09, 0xE1, 0xE9, 0x9E, 0x1E, 0x19, 0x93, 0x99, 0x00, 0x1A,
+    0xD9, 0x1F, 0xC9, 0x0C, 0xA1, 0xD0, 0xCA, 0x1D, 0x0F, 0xC9, 0x1A, 0xD9, 0x00, 0x19, 0x99, 0x19,
+    0xE1, 0xAD, 0x91, 0xE2, 0xAA, 0x20, 0x09, 0xCA, 0x2A, 0xDA, 0x29, 0xDA, 0x2F, 0xF9, 0xAE, 0x90,
+    0x29, 0x3D, 0x91, 0xD9, 0x19, 0xD2, 0x9D, 0xA9, 0x90, 0xFA, 0x1A, 0xCA, 0x90, 0x09, 0x90, 0x9D,
+    0x99, 0xD9, 0x9D, 0x99, 0xD9, 0x30, 0x9F, 0xF9, 0x9D, 0xAA, 0xAA, 0xD9, 0x9C, 0x5C, 0x99, 0xC5,
+    0xC9, 0x09, 0x59, 0x00, 0x99, 0x19, 0x91, 0x99, 0xAC, 0x1D, 0x1C, 0xA0, 0xFF, 0x29, 0x91, 0x99,
+    0x10, 0x72, 0xAD, 0x92, 0xAD, 0x90, 0xAD, 0xA9, 0xE9, 0x2F, 0xD9, 0x4F, 0xA2, 0x75, 0x9F, 0x94,
+    0xFD, 0x3E, 0x99, 0xE1, 0xAC, 0xA3, 0xDA, 0x09, 0x59, 0x0A, 0xCA, 0x3A, 0xCA, 0x9F, 0xF9, 0x0A,
+    0xFD, 0xA2, 0x9A, 0xDA, 0x91, 0x49, 0x5A, 0xFC, 0x2F, 0xF0, 0x9D, 0xA9, 0x99, 0xDA, 0xAC, 0x93,
+    0x9C, 0xA0, 0x19, 0xDA, 0x2D, 0x19, 0xFC, 0xAE, 0x1E, 0xAF, 0xC9, 0x1D, 0x2A, 0xCA, 0x91, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0x1F, 0xF0, 0xAF, 0xFD, 0xAF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x97, 0x3F, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x1A, 0xCA, 0x2A, 0xC1, 0xFD, 0xAD, 0x0A, 0xDA, 0xFC, 0xA0, 0xAC, 0x29, 0xD9, 0x10, 0x74, 0xFF,
+    0xD1, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x77, 0x4F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFD,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x9C, 0xA5, 0xF3, 0xAF, 0x91,
+    0x9F, 0xA3, 0xF5, 0xAC, 0x97, 0x70, 0x79, 0xD7, 0x0D, 0xA7, 0x0D, 0x70, 0xAD, 0x70, 0xD9, 0x79,
+    0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x7A, 0xD7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x9D,
+    0x70, 0xDA, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0x97, 0x9D, 0x70, 0xDA, 0x70, 0x99, 0x70, 0x9A, 0x1A,
+    0xD1, 0xAC, 0x90, 0x9C, 0x99, 0xD0, 0x9C, 0x90, 0x9C, 0x5C, 0x99, 0xC5, 0xC9, 0x9C, 0x5C, 0x99,
+    0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFA, 0xAA, 0x5A,
+    0xAA, 0xA5, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x19, 0x91, 0x99,
+    0x2F, 0xF0, 0xAC, 0x1D, 0x1C, 0xA9, 0x91, 0x99, 0x19, 0x90, 0x59, 0xC9, 0x9C, 0x90, 0xAD, 0xA1,
+    0x9D, 0x90, 0x9C, 0xAA, 0xC9, 0x09, 0x19, 0x00, 0x1A, 0x99, 0xD9, 0xAC, 0x2C, 0xA1, 0xAC, 0x91,
+    0xCA, 0x9D, 0x09, 0x91, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x3F, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x70, 0xF4, 0xF4, 0xAE, 0x49, 0xD9, 0x72,
+    0xF9, 0x1F, 0x2A, 0xE2, 0x9D, 0xA3, 0x09, 0xDA, 0x2A, 0xC1, 0xFD, 0xAD, 0x0A, 0xDA, 0xFC, 0x90,
+    0xD2, 0x9D, 0x91, 0x09, 0x99, 0x09, 0xE9, 0x09, 0xDA, 0x1D, 0x91, 0xCA, 0x50, 0x59, 0x99, 0x94,
+    0x9C, 0xA0, 0x9E, 0xA0, 0xAA, 0x1E, 0x09, 0xE0, 0xAD, 0xA0, 0xE0, 0xAD, 0x90, 0xAD, 0xA1, 0x91,
+    0xDA, 0x29, 0x90, 0xAA, 0xA1, 0xE1, 0xE9, 0x0F, 0x99, 0xE9, 0x73, 0x9F, 0xFD, 0x99, 0xCA, 0x99,
+    0x99, 0x99, 0xAC, 0x99, 0xC7, 0xC9, 0x9C, 0x7C, 0x97, 0x30, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x97, 0x3F, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x09,
+    0x91, 0x99, 0x09, 0xD1, 0xD9, 0x9D, 0x1D, 0x99, 0xD1, 0xD9, 0x9D, 0x1D, 0x97, 0x0A, 0xAA, 0xA0,
+    0x9F, 0x92, 0x9C, 0x92, 0x9C, 0x92, 0x9C, 0x90, 0x74, 0x90, 0xCA, 0x09, 0x1A, 0xF9, 0x9C, 0x99,
+    0xCA, 0xAF, 0xC0, 0x9C, 0x0A, 0xCA, 0xCA, 0x49, 0x94, 0x3A, 0xA6, 0x9D, 0x95, 0x9D, 0x94, 0x99,
+    0x99, 0x1A, 0x90, 0xFA, 0x9A, 0xC9, 0x9F, 0xF0, 0xAC, 0x2A, 0xD9, 0x4D, 0x6A, 0xDA, 0x59, 0xD9,
+    0x74, 0x19, 0x99, 0x2A, 0x1A, 0xF9, 0xD1, 0xCA, 0x9A, 0xEA, 0x19, 0x39, 0x39, 0xE9, 0x09, 0xC9,
+    0x0F, 0xF1, 0xC9, 0x1A, 0xCA, 0x10, 0x74, 0xA1, 0xA3, 0x9D, 0xAA, 0xD9, 0x1F, 0xF2, 0xAA, 0x1A,
+    0xA7, 0x30, 0x7D, 0x2F, 0x2D, 0x3D, 0x3D, 0x10, 0xF2, 0xF2, 0xFC, 0xAA, 0x92, 0x9A, 0xA9, 0x29,
+    0xAA, 0xD9, 0x75, 0x9D, 0x93, 0x99, 0xAA, 0x99, 0x39, 0xC4, 0x99, 0x91, 0x99, 0x97, 0x09, 0xA5,
+    0xA9, 0x69, 0x97, 0x99, 0x2C, 0x90, 0x99, 0x79, 0x90, 0x9D, 0x90, 0xA7, 0x1A, 0x09, 0xD9, 0x0A,
+    0x71, 0xA0, 0x9D, 0x97, 0x39, 0x09, 0xC2, 0xAA, 0x79, 0xA6, 0x99, 0x59, 0x97, 0x99, 0x93, 0x99,
+    0x93, 0xC9, 0x3A, 0x9A, 0xA9, 0xA3, 0x9D, 0x97, 0x59, 0xDA, 0x99, 0x29, 0x99, 0x92, 0x99, 0xAF,
+    0xC2, 0xF2, 0xF0, 0x0A, 0x3D, 0xA2, 0x9D, 0x09, 0xE0, 0xCA, 0x60, 0x49, 0xCA, 0x0D, 0xA9, 0xCA,
+    0x1D, 0x1A, 0xCA, 0x19, 0x90, 0x39, 0x95, 0xAF, 0xA2, 0xAF, 0xDA, 0x1D, 0x3D, 0x09, 0xC9, 0x9D,
+    0x99, 0xC9, 0x2A, 0xDA, 0x6A, 0xC3, 0x6C, 0x99, 0xC1, 0xAE, 0x19, 0xD9, 0x1D, 0xAC, 0x49, 0x00,
+    0x29, 0xC0, 0xAD, 0xA0, 0xD9, 0x1A, 0xDA, 0x29, 0xC0, 0x0C, 0x92, 0xAD, 0x91, 0x9D, 0x0A, 0xDA,
+    0x0C, 0x91, 0xAA, 0x39, 0xA1, 0x9D, 0xA1, 0xDA, 0x2D, 0xA0, 0xCA, 0xC0, 0x9D, 0xA0, 0xAC, 0x0C,
+    0x9A, 0xA2, 0xC9, 0x0A, 0xA0, 0x39, 0xCA, 0x1D, 0xA1, 0xD0, 0xAC, 0xA9, 0xD1, 0xA1, 0x5E, 0x0A,
+    0xE9, 0xAE, 0x90, 0x9A, 0x90, 0x7D, 0x19, 0xF9, 0x9A, 0xDA, 0x90, 0xAD, 0xA1, 0x99, 0x99, 0x00,
+    0x72, 0xFF, 0x0A, 0xC1, 0xD1, 0xCA, 0xCA, 0x1A, 0xA1, 0xAC, 0xAC, 0x99, 0xD9, 0x9C, 0xA0, 0xAD,
+    0x99, 0xDA, 0x00, 0x09, 0x93, 0xC9, 0x3F, 0x19, 0x9A, 0xC3, 0xAA, 0x60, 0xAD, 0x75, 0xDA, 0x0E,
+    0xA7, 0x1A, 0xE2, 0xFC, 0xAA, 0x99, 0xAA, 0xFC, 0x4A, 0xFF, 0xFA, 0x79, 0xAF, 0xDA, 0x94, 0xAD,
+    0x75, 0xDA, 0x0E, 0xA7, 0x1A, 0xE2, 0xFC, 0xAA, 0x99, 0xAA, 0xFC, 0x4A, 0xFF, 0xFA, 0x79, 0xAF,
+    0xDA, 0x94, 0x9F, 0xFF, 0xD9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xD9,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1A, 0xFC, 0xA9, 0x95, 0x9D, 0x0F, 0xFF, 0xCA,
+    0xAE, 0xAA, 0xDA, 0x9A, 0xAA, 0xFF, 0xE0, 0xAC, 0x79, 0x9A, 0xAD, 0xA9, 0x10, 0x59, 0xAF, 0xAA,
+    0x97, 0x9F, 0xFF, 0x94, 0xFD, 0xAA, 0xAA, 0xFD, 0x2E, 0xA9, 0x79, 0xF0, 0xAD, 0x97, 0x39, 0xDA,
+    0x77, 0x30, 0x77, 0x77, 0x5C, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x90, 0x9F,
+    0xFF, 0xFE, 0x77, 0x09, 0xCA, 0x77, 0x29, 0x20, 0x6A, 0xE9, 0x3D, 0x0A, 0xFA, 0xC9, 0x0D, 0xAC,
+    0xAA, 0xD0, 0x9A, 0x90, 0x90, 0x7A, 0xE9, 0x09, 0xC9, 0x0A, 0xC0, 0xAF, 0xC0, 0x9C, 0x94, 0xDA,
+    0xAA, 0x29, 0xAA, 0x90, 0x2A, 0xC1, 0x90, 0xAC, 0x0A, 0xC0, 0xAC, 0x0A, 0xC0, 0xAC, 0x09, 0xA0,
+    0x7A, 0xE1, 0x9C, 0x90, 0xD0, 0xAC, 0x1A, 0xC0, 0xAC, 0x1A, 0xC1, 0xDA, 0xCA, 0x2A, 0xA9, 0x10,
+    0xAC, 0x1A, 0xC0, 0xAC, 0x1A, 0xC0, 0xAC, 0x1A, 0xC0, 0xAC, 0x1D, 0x09, 0xDA, 0xD1, 0x9A, 0x90,
+    0xA0, 0x7E, 0xA0, 0xD9, 0x2C, 0xA3, 0xCA, 0x3A, 0xCA, 0xAA, 0x19, 0xAA, 0x00, 0x71, 0xAC, 0x3A,
+    0xC0, 0xFC, 0xAC, 0x90, 0xF1, 0xAC, 0xAC, 0x1A, 0xC9, 0xDA, 0xD0, 0x9A, 0x90, 0xA0, 0x6A, 0xC4,
+    0xAC, 0x4A, 0xCA, 0xDA, 0x0A, 0xCA, 0x0D, 0x0A, 0xC1, 0xAC, 0x0A, 0xC1, 0xAC, 0x0A, 0xC1, 0xAC,
+    0x09, 0xA1, 0x9A, 0x00, 0x71, 0x9C, 0xAD, 0xAA, 0xD9, 0x9C, 0xA0, 0xDA, 0x0D, 0x9C, 0x90, 0xAC,
+    0x1D, 0x9C, 0x90, 0xAC, 0x1D, 0x9C, 0x90, 0xAC, 0x1D, 0x0A, 0x19, 0xA1, 0x99, 0x49, 0xC9, 0xCA,
+    0x9D, 0x90, 0x9C, 0x91, 0x9C, 0x91, 0x9C, 0x92, 0xA2, 0x5A, 0xA1, 0xAE, 0x90, 0xCA, 0x2C, 0xA2,
+    0xCA, 0x2D, 0xA9, 0x1A, 0xA0, 0xAC, 0x19, 0xC9, 0x9C, 0x90, 0xD1, 0xCA, 0x0C, 0x91, 0x9C, 0xAC,
+    0x3D, 0xA3, 0x9A, 0x20, 0x0A, 0xC9, 0x0D, 0x2D, 0xAC, 0x4D, 0xA3, 0xAE, 0x29, 0xCA, 0x0C, 0xA1,
+    0x99, 0x19, 0xA0, 0x5F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7,
+    0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94,
+    0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F,
+    0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x00, 0xAF, 0xEA, 0x93, 0xFF, 0xEA, 0x1F,
+    0xFF, 0x90, 0xF2, 0x9F, 0xC0, 0xF4, 0xF0, 0xF4, 0xF0, 0xF3, 0xAE, 0xA0, 0xFA, 0xAA, 0xFA, 0x1F,
+    0xFD, 0xA2, 0xFF, 0xF1, 0xF2, 0x9A, 0xF0, 0xF4, 0xF0, 0xF4, 0xAE, 0x9F, 0x4F, 0x9F, 0x3A, 0xF0,
+    0xFF, 0xFA, 0x0F, 0xFE, 0xA1, 0xFF, 0xCA, 0x92, 0xAF, 0xFF, 0xFF, 0xFF, 0xFC, 0x99, 0x99, 0x90,
+    0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x5F, 0xC7,
+    0x29, 0xFC, 0x72, 0xFD, 0xA7, 0x1E, 0xAE, 0x70, 0xAE, 0x0E, 0x97, 0xEA, 0x0E, 0xA6, 0x9E, 0x90,
+    0xAE, 0x6A, 0xE2, 0xE9, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xAE, 0x4F, 0x4E, 0xA3, 0xEA, 0x4F, 0x29,
+    0xE9, 0x4A, 0xE2, 0xF5, 0x9E, 0xA1, 0xF6, 0xF0, 0xAF, 0xFF, 0xE9, 0xFF, 0xFF, 0xAF, 0xFF, 0xFA,
+    0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F,
+    0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF,
+    0xFD, 0xA0, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x0F, 0xFF, 0xA0, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x0A,
+    0xE9, 0x79, 0xEA, 0x70, 0xF7, 0x0F, 0x70, 0x9E, 0xA7, 0x0F, 0x70, 0xF7, 0x0A, 0xE9, 0x79, 0xEA,
+    0x70, 0xF7, 0x0A, 0xE9, 0x79, 0xFF, 0xFC, 0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0xAE, 0x6E, 0xAF, 0x6F,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x99, 0x99,
+    0x99, 0x9F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xF0, 0x77, 0x6A, 0xFD,
+    0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F,
+    0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x0A, 0xAA, 0xAA, 0xA0, 0xF9, 0xAE, 0x90, 0xFD, 0x0A, 0xE9, 0xAE,
+    0x90, 0xFD, 0x0A, 0xE9, 0xAE, 0x90, 0x99, 0x99, 0x99, 0x0A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1,
+    0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7,
+    0x76, 0x0F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0xAE, 0x5F, 0x0F, 0x4A, 0xE9, 0x0F, 0x3A, 0xEA,
+    0x1F, 0x29, 0xF2, 0xF2, 0xF3, 0xF1, 0xF9, 0x3F, 0x0A, 0xEA, 0x4F, 0x9E, 0xA5, 0xFF, 0xA5, 0xFF,
+    0xC5, 0xFC, 0xAF, 0x4F, 0x90, 0xAE, 0xA3, 0xF2, 0xF3, 0xF2, 0xAF, 0x2F, 0x3F, 0x91, 0xF3, 0x9F,
+    0x1F, 0x4A, 0xEA, 0x0F, 0x5F, 0x90, 0x5F, 0xC7, 0x2A, 0xFC, 0x72, 0xFD, 0x97, 0x1E, 0xAE, 0x70,
+    0xAE, 0x9E, 0x70, 0xEA, 0x0E, 0x97, 0xE9, 0x0A, 0xE6, 0xAE, 0x19, 0xE6, 0xF2, 0xEA, 0x5E, 0xA2,
+    0xF4, 0xAE, 0x92, 0xAE, 0x4F, 0x39, 0xEA, 0x3E, 0xA4, 0xF2, 0xAE, 0x94, 0xAE, 0x2F, 0x59, 0xEA,
+    0x1F, 0x6F, 0x0A, 0xEA, 0x6F, 0x0F, 0x96, 0xAE, 0xA0, 0xAF, 0x97, 0xFC, 0x9F, 0xD6, 0x9F, 0xC9,
+    0xFD, 0x6A, 0xFC, 0x9F, 0xD9, 0x5F, 0xD9, 0xFD, 0xA4, 0x9F, 0xD9, 0xEA, 0xE4, 0xAD, 0x9E, 0x9E,
+    0xAA, 0xD9, 0x3E, 0x0E, 0x9E, 0xA9, 0xDA, 0x3D, 0xA0, 0xE9, 0xEA, 0x0E, 0x2A, 0xD9, 0x0E, 0x9E,
+    0xA0, 0xE9, 0x1E, 0x1E, 0x9E, 0xA0, 0xAD, 0xA1, 0xDA, 0x1E, 0x9E, 0xA1, 0xE0, 0xAD, 0x91, 0xE9,
+    0xEA, 0x1E, 0x0E, 0x2E, 0x9E, 0xA1, 0xAD, 0xAE, 0x2E, 0x9E, 0xA1, 0x9F, 0xC9, 0x2E, 0x9E, 0xA2,
+    0xFC, 0x3E, 0x9E, 0xA2, 0xAF, 0x3E, 0x9E, 0xA2, 0x9E, 0x93, 0xE9, 0xAF, 0x69, 0xE0, 0xFD, 0x59,
+    0xE0, 0xFD, 0x94, 0x9E, 0x0F, 0xE4, 0x9E, 0x0F, 0xEA, 0x39, 0xE0, 0xE9, 0xF3, 0x9E, 0x0E, 0xA9,
+    0xEA, 0x29, 0xE0, 0xEA, 0x0F, 0x91, 0x9E, 0x0E, 0xA1, 0xF1, 0x9E, 0x0E, 0xA1, 0xAE, 0x90, 0x9E,
+    0x0E, 0xA2, 0xF0, 0x9E, 0x0E, 0xA2, 0x9E, 0xA0, 0xE0, 0xEA, 0x3F, 0x9E, 0x0E, 0xA3, 0x9F, 0xE0,
+    0xEA, 0x4A, 0xFD, 0x0E, 0xA5, 0xFD, 0x0E, 0xA5, 0xAF, 0xC0, 0xEA, 0x6F, 0xC0, 0x0F, 0xFE, 0xA1,
+    0xFF, 0xEA, 0x1F, 0xFE, 0xA1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x5F, 0xFC, 0xA3,
+    0xFF, 0xCA, 0x3F, 0xFC, 0xA3, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x2A, 0xFF, 0xF0,
+    0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0x77, 0x6A, 0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F,
+    0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9,
+    0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A,
+    0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0xAF,
+    0xFF, 0xCA, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xF9, 0x99, 0x99, 0x99, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA,
+    0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA,
+    0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xF6, 0xEA, 0xAF, 0xDA, 0xA3, 0xFF, 0xDA, 0x1F, 0xFE, 0xA0,
+    0xF9, 0x99, 0xAF, 0x0F, 0x3A, 0xE9, 0xF3, 0x9E, 0x9F, 0x39, 0xE9, 0xF3, 0xF0, 0xF9, 0x9A, 0xFC,
+    0x0F, 0xFE, 0x90, 0xFF, 0xD9, 0x1F, 0xAA, 0xAA, 0x93, 0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xF7,
+    0x0F, 0x70, 0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x0F, 0xFF, 0xA0, 0xAF, 0x19, 0x99, 0x99, 0x2A, 0xEA,
+    0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x0A, 0xE9, 0x7A, 0xEA, 0x79, 0xEA, 0x70, 0xF7,
+    0x0F, 0x70, 0xF7, 0x09, 0xFF, 0xFC, 0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x99, 0x4A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xE4, 0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93, 0xAE, 0x92, 0xF3, 0xF3,
+    0xAE, 0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF, 0xD7, 0x1F, 0xCA, 0x71,
+    0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x7A, 0xE7, 0x70, 0xAE,
+    0x97, 0x3A, 0xFF, 0xDA, 0x95, 0x9F, 0xFF, 0xE3, 0x9F, 0xFF, 0xFC, 0x2F, 0x91, 0xAE, 0x2F, 0xA0,
+    0xAE, 0x92, 0xAE, 0x3F, 0x0F, 0x3A, 0xE3, 0x9E, 0x9F, 0x3A, 0xE3, 0x9E, 0x9F, 0x3A, 0xE3, 0x9E,
+    0x9A, 0xE3, 0xAE, 0x3A, 0xE9, 0x9E, 0xA2, 0xAE, 0x3F, 0x1F, 0xC9, 0x9A, 0xE9, 0x9A, 0xF9, 0x2F,
+    0xFF, 0xFA, 0x4A, 0xFF, 0xFC, 0x97, 0x9A, 0xAF, 0xCA, 0xA9, 0x74, 0xAE, 0x77, 0x0A, 0xE7, 0x77,
+    0x50, 0x9F, 0x59, 0xF1, 0xAE, 0x94, 0xF9, 0x2F, 0x39, 0xEA, 0x39, 0xEA, 0x2F, 0x5F, 0x90, 0xAE,
+    0x96, 0xF9, 0xF7, 0x9F, 0xE7, 0x1F, 0xDA, 0x72, 0xFC, 0x72, 0x9F, 0xC7, 0x2F, 0xDA, 0x70, 0xAF,
+    0xE9, 0x69, 0xEA, 0x0F, 0x6F, 0x1A, 0xEA, 0x4A, 0xE9, 0x2F, 0x92, 0x9F, 0x39, 0xF2, 0xF9, 0x4A,
+    0xEA, 0x0A, 0xEA, 0x6F, 0x90, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xAE, 0xA2, 0xAD, 0xA2, 0xAF, 0xDA,
+    0x2A, 0xDA, 0x2A, 0xFD, 0xA2, 0xAD, 0xA2, 0xAF, 0xDA, 0x2A, 0xDA, 0x2A, 0xFD, 0xA2, 0xAD, 0xA2,
+    0xAF, 0xDA, 0x2A, 0xDA, 0x2A, 0xFD, 0xA2, 0xAD, 0xA2, 0xFA, 0xE2, 0xAD, 0xA2, 0xEA, 0x9E, 0xA1,
+    0xAD, 0xA1, 0xAE, 0x90, 0xFC, 0xAF, 0xAF, 0xC2, 0xFF, 0xFD, 0x4A, 0xFF, 0xDA, 0x79, 0x9F, 0x99,
+    0x73, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x60, 0x77, 0x79, 0xAF, 0xCA, 0x97,
+    0x0F, 0xFD, 0xA6, 0xFF, 0xFC, 0x4F, 0xC9, 0x29, 0xFA, 0x29, 0xF6, 0xF2, 0xAE, 0x96, 0xAE, 0xA1,
+    0xF7, 0x0F, 0x1F, 0x70, 0xF1, 0xF7, 0x0F, 0x1F, 0x70, 0xF1, 0xAE, 0x70, 0xEA, 0x19, 0xE9, 0x6A,
+    0xE9, 0x2F, 0x6E, 0xA4, 0xEA, 0x4F, 0x59, 0xF2, 0xF9, 0x3F, 0xE1, 0x9F, 0xE1, 0xFE, 0x19, 0xFE,
+    0x1F, 0xE1, 0x9F, 0xE0, 0x2A, 0xE9, 0x1A, 0xAA, 0x3F, 0xE9, 0xE2, 0xFF, 0xF1, 0x9F, 0x91, 0xAF,
+    0x1A, 0xEA, 0x3F, 0x1A, 0xE4, 0xAE, 0x1F, 0x4A, 0xE1, 0xF4, 0xAE, 0x1F, 0x4A, 0xE1, 0xAE, 0x93,
+    0xF1, 0x9F, 0x29, 0xF2, 0xFC, 0xAF, 0xEA, 0x09, 0xFE, 0x9F, 0xA1, 0x9F, 0xC1, 0x9E, 0xA7, 0x60,
+    0x77, 0x09, 0xFC, 0xA9, 0x4A, 0xFF, 0x92, 0x9F, 0xFD, 0x2F, 0x2A, 0xE9, 0x1E, 0xA3, 0xEA, 0x1E,
+    0xA3, 0xEA, 0x1E, 0xA2, 0x9E, 0x2E, 0xA0, 0x99, 0xEA, 0x2E, 0xA0, 0xF9, 0x3E, 0xA0, 0xFA, 0x92,
+    0xEA, 0x0A, 0xAF, 0x91, 0xEA, 0x3F, 0x1E, 0xA3, 0x9E, 0x90, 0xEA, 0x4E, 0xA0, 0xEA, 0x39, 0xEA,
+    0x0F, 0x3F, 0x90, 0xFF, 0xF1, 0xFF, 0xE9, 0x1F, 0xFC, 0xA3, 0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x71,
+    0xEA, 0x71, 0xEA, 0x71, 0xEA, 0x70, 0xAA, 0xAA, 0x49, 0xAA, 0xA0, 0xAE, 0x49, 0xE9, 0x0E, 0xA3,
+    0x9E, 0x1F, 0x3A, 0xE1, 0xAE, 0x3A, 0xE2, 0xE9, 0x2F, 0x2F, 0x2E, 0xA2, 0x9E, 0x19, 0xE9, 0x3E,
+    0x90, 0xAE, 0x4A, 0xDA, 0x0E, 0x94, 0x9E, 0xAE, 0x6F, 0xD9, 0x6A, 0xFA, 0x79, 0xEA, 0x70, 0x9E,
+    0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x19, 0x99, 0x50, 0x77, 0x3A,
+    0xFC, 0xA5, 0x9F, 0xFC, 0x93, 0xFA, 0xAA, 0xE4, 0xEA, 0x3A, 0xA4, 0xEA, 0x72, 0xFA, 0x72, 0xFC,
+    0x97, 0x09, 0xFD, 0x6A, 0xFF, 0x93, 0xAE, 0xA0, 0xAF, 0x29, 0xE9, 0x29, 0xEA, 0x1F, 0x4F, 0x1E,
+    0xA4, 0xAE, 0x1E, 0xA4, 0xAE, 0x1F, 0x4F, 0x1F, 0xA2, 0xAE, 0xA1, 0x9F, 0xFE, 0x39, 0xFF, 0xC9,
+    0x5A, 0xFC, 0xA9, 0x77, 0x10, 0x3A, 0xFA, 0x92, 0xAF, 0xFA, 0x1F, 0xFC, 0x90, 0x9E, 0x92, 0x9A,
+    0x19, 0xE7, 0x0E, 0xA9, 0x99, 0x5A, 0xFC, 0x4A, 0xFD, 0x3A, 0xEA, 0x99, 0x93, 0xF7, 0xF7, 0xFC,
+    0xAA, 0xAD, 0x90, 0x9F, 0xFC, 0x92, 0xAF, 0xDA, 0x74, 0x9F, 0xFD, 0x09, 0xFF, 0xD0, 0x9F, 0xFD,
+    0x6F, 0x6A, 0xE9, 0x59, 0xEA, 0x6F, 0x6F, 0x6F, 0x69, 0xEA, 0x6F, 0x69, 0xE9, 0x6A, 0xE7, 0xF7,
+    0xF7, 0xAF, 0x95, 0x9F, 0xDA, 0x93, 0x9F, 0xF4, 0xAF, 0xE5, 0x9A, 0xF7, 0xAE, 0x7A, 0xE7, 0xE9,
+    0x69, 0xE7, 0x50, 0x0A, 0xAA, 0x1A, 0xEA, 0x3E, 0x0F, 0xE2, 0xFF, 0xF1, 0xFC, 0x19, 0xF1, 0xF3,
+    0xAE, 0x90, 0xF3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E,
+    0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E,
+    0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x90,
+    0x77, 0x09, 0xFC, 0x95, 0xAF, 0xF3, 0x9F, 0xAF, 0xA2, 0xF2, 0xAE, 0x2E, 0x93, 0xEA, 0x09, 0xE4,
+    0xF0, 0xAE, 0x4A, 0xE0, 0xAE, 0x4A, 0xE0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0A, 0xE4,
+    0xAE, 0x0A, 0xE4, 0xAE, 0x09, 0xE4, 0xF1, 0xE9, 0x3E, 0xA1, 0xF2, 0x9E, 0x91, 0x9F, 0x9A, 0xF3,
+    0xAF, 0xF5, 0x9F, 0xCA, 0x77, 0x10, 0x0A, 0xAA, 0x94, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA,
+    0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4F, 0x4F, 0xE1, 0x9F, 0xD2, 0x9F, 0xC7, 0x10, 0x0A, 0xAA,
+    0x94, 0xAA, 0xAA, 0x1E, 0xA3, 0xF2, 0xEA, 0x2A, 0xE9, 0x2E, 0xA1, 0x9E, 0x93, 0xEA, 0x09, 0xEA,
+    0x4E, 0xA0, 0xEA, 0x5E, 0xAF, 0x6F, 0xF9, 0x5F, 0xFC, 0x94, 0xF9, 0x0F, 0x4E, 0xA1, 0x9F, 0x3E,
+    0xA2, 0xAE, 0xA2, 0xEA, 0x3F, 0x91, 0xEA, 0x4F, 0x00, 0x76, 0xAF, 0xA7, 0x0A, 0xFC, 0xA7, 0xAF,
+    0xD9, 0x72, 0xF7, 0x29, 0xE9, 0x72, 0xEA, 0x71, 0x9F, 0x71, 0xFC, 0x97, 0x0F, 0xD7, 0xAF, 0xD7,
+    0xE9, 0xEA, 0x59, 0xE0, 0xAE, 0x5A, 0xE0, 0x9E, 0x94, 0xEA, 0x1E, 0xA3, 0x9E, 0x91, 0xAE, 0x3A,
+    0xE2, 0x9E, 0xA2, 0xF3, 0xFC, 0x99, 0xEA, 0x3A, 0xF9, 0xF5, 0xF9, 0x76, 0x0A, 0xAA, 0x93, 0x9A,
+    0xAA, 0x3E, 0xA3, 0x9E, 0x92, 0xEA, 0x39, 0xE9, 0x2E, 0xA3, 0x9E, 0x92, 0xEA, 0x39, 0xE9, 0x2E,
+    0xA3, 0x9E, 0x92, 0xEA, 0x39, 0xE9, 0x2E, 0xA3, 0x9E, 0x92, 0xEA, 0x3A, 0xE9, 0x2E, 0xA3, 0xF9,
+    0x2F, 0x29, 0xF9, 0x2F, 0xFF, 0xD1, 0xFF, 0xAF, 0xC1, 0xEA, 0xF1, 0xF1, 0xEA, 0x73, 0xEA, 0x73,
+    0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0xAA, 0xAA, 0x49, 0xAA, 0xA0, 0xAE, 0x49, 0xE9,
+    0x0E, 0xA3, 0x9E, 0x1F, 0x3A, 0xE1, 0xAE, 0x3A, 0xE2, 0xE9, 0x2F, 0x2F, 0x2E, 0xA2, 0x9E, 0x19,
+    0xE9, 0x3E, 0x90, 0xAE, 0x4A, 0xDA, 0x0E, 0x94, 0x9E, 0xAE, 0x6F, 0xD9, 0x6A, 0xFA, 0x79, 0xEA,
+    0x40, 0x0F, 0xFD, 0x90, 0xFF, 0xD9, 0x0C, 0xAF, 0xCA, 0xAA, 0x2A, 0xD9, 0x6E, 0xA7, 0xEA, 0x7F,
+    0x7A, 0xF9, 0x99, 0x93, 0xAF, 0xEA, 0x29, 0xFE, 0xA1, 0xAF, 0xAA, 0xAA, 0x90, 0x9E, 0xA6, 0xAE,
+    0x7F, 0x7F, 0x7A, 0xF9, 0x6F, 0xEA, 0x39, 0xFF, 0x93, 0xAF, 0xE6, 0x9F, 0x79, 0xE7, 0x9E, 0x7E,
+    0xA7, 0xE9, 0x74, 0x3A, 0xEA, 0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93,
+    0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F, 0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F,
+    0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC, 0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x2A, 0xE9, 0x2F, 0x5A, 0xE3,
+    0xAE, 0x5A, 0xE3, 0xAE, 0x5A, 0xE3, 0xAE, 0x5A, 0xE3, 0xAE, 0x5A, 0xE3, 0xAE, 0x5A, 0xE3, 0xAE,
+    0x5A, 0xE3, 0xAE, 0x5A, 0xE3, 0xAF, 0xCA, 0x2A, 0xE3, 0x9F, 0xD2, 0xAE, 0x4A, 0xFA, 0x77, 0x10,
+    0x3A, 0xEA, 0x95, 0x9F, 0xF3, 0x9F, 0xFD, 0x2F, 0x91, 0xAE, 0xA1, 0xEA, 0x3F, 0x09, 0xE9, 0x3A,
+    0xE0, 0xAE, 0x93, 0xAE, 0x0A, 0xE9, 0x3A, 0xE0, 0xAE, 0x93, 0xAE, 0x0A, 0xE9, 0x3F, 0x0A, 0xEA,
+    0x29, 0xEA, 0x0A, 0xFC, 0xAA, 0xF9, 0x0A, 0xFF, 0xDA, 0x1A, 0xE9, 0xFC, 0x92, 0xAE, 0x71, 0xAE,
+    0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0x3A, 0xFA, 0x3A, 0xFF, 0x19, 0xFF, 0xA1,
+    0xF9, 0x19, 0xA1, 0x9E, 0x96, 0xAE, 0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x69, 0xF9, 0x6F, 0xDA, 0x94,
+    0xFF, 0x4A, 0xFE, 0x6A, 0xF7, 0xAE, 0x7A, 0xE7, 0xE9, 0x6A, 0xE7, 0x50, 0x39, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA2, 0x9F, 0xFE, 0x90, 0x9F, 0xFF, 0x90, 0xFA, 0x1A, 0xDA, 0x29, 0xEA, 0x3E, 0x91, 0xAE,
+    0x4E, 0xA1, 0xF4, 0xAE, 0x1F, 0x4A, 0xE1, 0xF4, 0xF1, 0xAE, 0x4F, 0x19, 0xF2, 0xAE, 0x92, 0xAF,
+    0xFD, 0x4F, 0xFC, 0x6A, 0xFC, 0xA7, 0x73, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA,
+    0x9F, 0xFE, 0xA3, 0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7,
+    0x0F, 0x70, 0xFC, 0xAC, 0xA4, 0x9F, 0xDA, 0x59, 0xFC, 0xA7, 0x50, 0x0A, 0xAA, 0x93, 0xAA, 0xA9,
+    0x1E, 0xA3, 0xF1, 0xEA, 0x3A, 0xE1, 0xEA, 0x3A, 0xE1, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90,
+    0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0x9E, 0x90, 0xEA, 0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x1F, 0x29, 0xF1,
+    0xAF, 0xFD, 0x92, 0xFF, 0xCA, 0x4A, 0xFD, 0x97, 0x70, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x49, 0xAF, 0xA9, 0x70, 0xAF, 0xFE, 0x5F, 0xFF, 0xD9, 0x2F, 0xA0, 0xAE, 0x0A,
+    0xF1, 0x9F, 0x1A, 0xE1, 0x9E, 0xA0, 0xAE, 0x2A, 0xE2, 0xF0, 0xF2, 0xAE, 0x2A, 0xE0, 0xF2, 0xAE,
+    0x2A, 0xE0, 0xAE, 0x2A, 0xE2, 0xF0, 0x9E, 0xA1, 0xAE, 0x2F, 0x1F, 0x90, 0xAE, 0x1F, 0x91, 0x9F,
+    0xFC, 0xAF, 0xA3, 0x9F, 0xFF, 0xA6, 0x9A, 0xFE, 0xA7, 0x3A, 0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0x6A,
+    0xE7, 0x6A, 0xE7, 0x6A, 0xE7, 0xAD, 0xA7, 0xAA, 0xA9, 0xFC, 0x5A, 0xE0, 0xFD, 0x4E, 0x90, 0x99,
+    0xAE, 0x92, 0xAE, 0x4F, 0x19, 0xE9, 0x49, 0xE9, 0x0E, 0xA6, 0xF9, 0xE7, 0x9F, 0xDA, 0x70, 0xFD,
+    0x71, 0x9F, 0x97, 0x2F, 0x72, 0xAF, 0x97, 0x1F, 0xD7, 0x0F, 0xEA, 0x69, 0xE0, 0xF6, 0xEA, 0x09,
+    0xEA, 0x4A, 0xE2, 0xF9, 0x3E, 0x93, 0xFC, 0xA0, 0xF4, 0xAF, 0xA9, 0xE9, 0x5A, 0xE9, 0x77, 0x69,
+    0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x0A, 0xAA, 0x29, 0xE2, 0xAA, 0xA1, 0x9E,
+    0x91, 0x9E, 0x2E, 0xA0, 0x9E, 0x91, 0x9E, 0x2F, 0x09, 0xE9, 0x19, 0xE2, 0xAE, 0x09, 0xE9, 0x19,
+    0xE2, 0xAE, 0x09, 0xE9, 0x19, 0xE2, 0x9E, 0x09, 0xE9, 0x19, 0xE2, 0x9E, 0x1E, 0x91, 0x9E, 0x29,
+    0xE1, 0xE9, 0x19, 0xE2, 0xAE, 0x1E, 0xA1, 0x9E, 0x2F, 0x1F, 0x90, 0x9E, 0x1A, 0xEA, 0x19, 0xFF,
+    0xFE, 0x3A, 0xFF, 0xFC, 0x6A, 0xFF, 0xC9, 0x72, 0xAE, 0x97, 0x59, 0xE7, 0x69, 0xE7, 0x69, 0xE7,
+    0x69, 0xE7, 0x69, 0xE7, 0x19, 0xAA, 0xA7, 0xAA, 0xA4, 0xE7, 0x0A, 0xE2, 0xAD, 0xA7, 0x1E, 0x91,
+    0xE9, 0x71, 0xAE, 0x09, 0xE3, 0x99, 0x93, 0x9E, 0x0A, 0xE3, 0xEA, 0x3E, 0x0A, 0xE3, 0xEA, 0x3E,
+    0x9A, 0xE3, 0xEA, 0x3E, 0x9A, 0xE3, 0xEA, 0x3E, 0x09, 0xE3, 0xEA, 0x29, 0xE1, 0xEA, 0x19, 0xF2,
+    0xF1, 0xAF, 0xAF, 0xDA, 0xF9, 0x2F, 0xE9, 0xAF, 0xDA, 0x4A, 0xF9, 0x1A, 0xFA, 0x77, 0x60, 0x5F,
+    0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70,
+    0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE,
+    0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09,
+    0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x77, 0x72, 0x97, 0x7E, 0x97, 0x49, 0xEA, 0x75, 0xE9, 0x76, 0x97,
+    0x00, 0x29, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF,
+    0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0,
+    0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x73, 0x97, 0x19, 0xE9, 0x7A, 0xEA, 0x79, 0xE7, 0x29,
+    0x50, 0x5A, 0xAA, 0xA7, 0x5F, 0xC7, 0x49, 0x9A, 0xD9, 0x75, 0x9D, 0x97, 0x4A, 0xE7, 0x5D, 0xA7,
+    0x77, 0x7F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0,
+    0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9,
+    0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A,
+    0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x00, 0x3A, 0xAA, 0xA7, 0x0F, 0xC7, 0x99, 0xE9, 0x70,
+    0xAD, 0x97, 0xEA, 0x70, 0xD9, 0x77, 0x49, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F,
+    0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F,
+    0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x50, 0x75, 0x99, 0x97,
+    0x5A, 0xD7, 0xAF, 0x09, 0xD7, 0x9F, 0xCA, 0x99, 0x70, 0xDA, 0x09, 0xD9, 0x70, 0xAA, 0x93, 0xAA,
+    0x77, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE,
+    0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA,
+    0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6,
+    0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x73, 0x99, 0x73, 0xE4, 0xAE, 0xA0, 0xAD, 0x4A,
+    0xFC, 0x99, 0x94, 0x9D, 0xA0, 0xAD, 0x6D, 0x92, 0x9C, 0xA7, 0x75, 0x9A, 0xF9, 0x59, 0xFF, 0xC5,
+    0xFF, 0xCA, 0x4A, 0x93, 0xF7, 0x2A, 0xE6, 0x99, 0x9A, 0xF4, 0xFF, 0xD3, 0xFD, 0xAF, 0x2F, 0x92,
+    0xAE, 0x2F, 0x3A, 0xE2, 0xF3, 0xF2, 0xFC, 0xAA, 0xFC, 0x29, 0xFE, 0x9E, 0x39, 0xFC, 0x90, 0xAD,
+    0x77, 0x10, 0x09, 0x97, 0x7E, 0x77, 0xAC, 0xA0, 0xAF, 0x71, 0x99, 0x9F, 0xCA, 0x72, 0xDA, 0x09,
+    0xD9, 0x70, 0xAA, 0x93, 0xAA, 0x77, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7,
+    0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F,
+    0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF,
+    0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x09, 0x97, 0x4E,
+    0x74, 0xD9, 0x0A, 0xEA, 0x69, 0x99, 0xFC, 0x97, 0xDA, 0x0A, 0xD9, 0x5D, 0x92, 0x9D, 0x77, 0x59,
+    0xAF, 0x95, 0x9F, 0xFC, 0x5F, 0xFC, 0xA4, 0xA9, 0x3F, 0x72, 0xAE, 0x69, 0x99, 0xAF, 0x4F, 0xFD,
+    0x3F, 0xDA, 0xF2, 0xF9, 0x2A, 0xE2, 0xF3, 0xAE, 0x2F, 0x3F, 0x2F, 0xCA, 0xAF, 0xC2, 0x9F, 0xE9,
+    0xE3, 0x9F, 0xC9, 0x0A, 0xD7, 0x70, 0x73, 0xDA, 0x76, 0xAD, 0xA7, 0x69, 0xCA, 0x7A, 0xF0, 0xAC,
+    0xA7, 0x9F, 0xCA, 0x09, 0x70, 0xDA, 0x09, 0xD9, 0x70, 0xAA, 0x93, 0xAA, 0x77, 0x74, 0xFC, 0x74,
+    0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0,
+    0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A,
+    0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6,
+    0x9F, 0x0F, 0x97, 0xF0, 0x71, 0xCA, 0xA7, 0x2E, 0x97, 0x29, 0xC9, 0x3A, 0xEA, 0x0A, 0xCA, 0x39,
+    0xFC, 0x99, 0xA4, 0xDA, 0x0A, 0xD5, 0xD9, 0x29, 0xD7, 0x73, 0x9A, 0xF9, 0x49, 0xFF, 0xC4, 0xFF,
+    0xCA, 0x3A, 0x93, 0xF7, 0x1A, 0xE5, 0x99, 0x9A, 0xF3, 0xFF, 0xD2, 0xFD, 0xAF, 0x1F, 0x92, 0xAE,
+    0x1F, 0x3A, 0xE1, 0xF3, 0xF1, 0xFC, 0xAA, 0xFC, 0x19, 0xFE, 0x9E, 0x29, 0xFC, 0x90, 0xAD, 0x77,
+    0x69, 0x49, 0x70, 0x9F, 0x99, 0xCA, 0x70, 0xD9, 0xAF, 0x97, 0x0A, 0x92, 0x9A, 0x74, 0x9E, 0x97,
+    0x39, 0xFC, 0x72, 0x9D, 0xA0, 0xAD, 0x71, 0xAA, 0x39, 0xAA, 0x77, 0x73, 0xFC, 0x74, 0xFC, 0x97,
+    0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79,
+    0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4,
+    0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F,
+    0x97, 0xF0, 0x77, 0x9E, 0xA9, 0x9C, 0xA3, 0xDA, 0xFC, 0x4A, 0x91, 0x9A, 0xA7, 0x9A, 0xAA, 0x79,
+    0xFC, 0x59, 0xDA, 0x9D, 0xA4, 0xD3, 0xAC, 0xA7, 0x70, 0x9A, 0xF9, 0x39, 0xFF, 0xC3, 0xFF, 0xCA,
+    0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99, 0x9A, 0xF2, 0xFF, 0xD1, 0xFD, 0xAF, 0x0F, 0x92, 0xAE, 0x0F,
+    0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA, 0xFC, 0x09, 0xFE, 0x9E, 0x19, 0xFC, 0x90, 0xAD, 0x75, 0x77,
+    0x7A, 0xF7, 0x39, 0xFD, 0x71, 0x9E, 0x0A, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x77, 0x73, 0xFC, 0x74,
+    0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0,
+    0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A,
+    0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6,
+    0x9F, 0x0F, 0x97, 0xF7, 0x77, 0x29, 0x77, 0xE9, 0x74, 0x9E, 0xA7, 0x5E, 0x97, 0x69, 0x70, 0x77,
+    0x0F, 0xC6, 0xAF, 0xCA, 0x49, 0xDA, 0x0A, 0xDA, 0x29, 0xDA, 0x29, 0xD9, 0x77, 0x09, 0xAF, 0x93,
+    0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA,
+    0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F,
+    0xC9, 0x0A, 0xD7, 0x73, 0x97, 0x19, 0xE7, 0x0A, 0xE9, 0x79, 0xE7, 0x29, 0x50, 0x77, 0x71, 0x9D,
+    0x97, 0x5D, 0x97, 0x2A, 0xC9, 0x0A, 0x90, 0xAC, 0x71, 0xDA, 0x99, 0xAD, 0x71, 0x9F, 0xD9, 0x73,
+    0xAA, 0xAA, 0x77, 0x76, 0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72, 0xEA, 0xE7, 0x19, 0xE0, 0xEA,
+    0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6, 0xAE, 0x2F, 0x6F, 0x29, 0xE9,
+    0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xCA, 0x2F, 0x95,
+    0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x77, 0x29, 0xD9, 0x70, 0xD9, 0x5A,
+    0xC0, 0x9A, 0x90, 0xD3, 0x9D, 0x90, 0x9A, 0xD4, 0xFE, 0x69, 0xAD, 0xA7, 0x73, 0x9A, 0xF9, 0x39,
+    0xFF, 0xC3, 0xFF, 0xCA, 0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99, 0x9A, 0xF2, 0xFF, 0xD1, 0xFD, 0xAF,
+    0x0F, 0x92, 0xAE, 0x0F, 0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA, 0xFC, 0x09, 0xFE, 0x9E, 0x19, 0xFC,
+    0x90, 0xAD, 0x75, 0x77, 0x7A, 0xD7, 0x7A, 0xCA, 0x73, 0xAC, 0x90, 0x9A, 0x0D, 0x71, 0xDA, 0x99,
+    0xAD, 0x71, 0x9F, 0xD9, 0x73, 0xAA, 0xAA, 0x77, 0x76, 0xFC, 0x74, 0xFC, 0x97, 0x2A, 0xFD, 0x72,
+    0xEA, 0xE7, 0x19, 0xE0, 0xEA, 0x70, 0xAE, 0x0A, 0xE7, 0x0E, 0xA0, 0x9E, 0x79, 0xE9, 0x1E, 0xA6,
+    0xAE, 0x2F, 0x6F, 0x29, 0xE9, 0x49, 0xEA, 0x99, 0x9A, 0xEA, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x92,
+    0x9F, 0xFF, 0xCA, 0x2F, 0x95, 0xF2, 0xF6, 0xAE, 0x90, 0x9E, 0xA6, 0x9F, 0x0F, 0x97, 0xF0, 0x77,
+    0x0D, 0xA7, 0x2D, 0x96, 0xAC, 0x1A, 0xA0, 0xD3, 0x9D, 0x90, 0x9A, 0xD4, 0xFE, 0x69, 0xAD, 0xA7,
+    0x73, 0x9A, 0xF9, 0x39, 0xFF, 0xC3, 0xFF, 0xCA, 0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99, 0x9A, 0xF2,
+    0xFF, 0xD1, 0xFD, 0xAF, 0x0F, 0x92, 0xAE, 0x0F, 0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA, 0xFC, 0x09,
+    0xFE, 0x9E, 0x19, 0xFC, 0x90, 0xAD, 0x75, 0x77, 0x70, 0xE7, 0x69, 0x9C, 0xA7, 0x6A, 0xC9, 0x72,
+    0xAC, 0x90, 0xA1, 0xD7, 0x09, 0xD9, 0x99, 0xE7, 0x1A, 0xFD, 0x73, 0x9A, 0xAA, 0x97, 0x77, 0x6F,
+    0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70,
+    0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE,
+    0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09,
+    0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x00, 0x4D, 0xA7, 0x19, 0xAC, 0x97, 0x1A, 0xC6, 0xD0, 0x9C, 0x1D,
+    0x3A, 0xD9, 0x09, 0xDA, 0x4F, 0xE6, 0x9E, 0xA7, 0x73, 0x9A, 0xF9, 0x39, 0xFF, 0xC3, 0xFF, 0xCA,
+    0x2A, 0x93, 0xF7, 0x0A, 0xE4, 0x99, 0x9A, 0xF2, 0xFF, 0xD1, 0xFD, 0xAF, 0x0F, 0x92, 0xAE, 0x0F,
+    0x3A, 0xE0, 0xF3, 0xF0, 0xFC, 0xAA, 0xFC, 0x09, 0xFE, 0x9E, 0x19, 0xFC, 0x90, 0xAD, 0x75, 0x69,
+    0x93, 0x97, 0x1F, 0x99, 0xD7, 0x0A, 0xCA, 0xAF, 0x97, 0x09, 0x92, 0x9A, 0x97, 0x1D, 0x4C, 0xA7,
+    0x0A, 0xD9, 0x99, 0xD9, 0x71, 0xFE, 0x73, 0x9A, 0xAA, 0x97, 0x77, 0x5F, 0xC7, 0x4F, 0xC9, 0x72,
+    0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A, 0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E,
+    0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E, 0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F,
+    0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F, 0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9,
+    0x7F, 0x00, 0x77, 0x0E, 0xA9, 0x0C, 0xA3, 0xDA, 0xFC, 0x93, 0xA9, 0x19, 0xAA, 0x94, 0xCA, 0x4C,
+    0x93, 0xDA, 0x90, 0x9D, 0x93, 0x9F, 0xE6, 0xAD, 0xA9, 0x77, 0x29, 0xAF, 0x93, 0x9F, 0xFC, 0x3F,
+    0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF, 0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A,
+    0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0, 0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7,
+    0x50, 0x49, 0x59, 0x70, 0xAC, 0xA3, 0xAC, 0xA7, 0x9F, 0xF9, 0x70, 0xAF, 0xDA, 0x72, 0x9A, 0xDA,
+    0x97, 0x77, 0x5F, 0xC7, 0x4F, 0xC9, 0x72, 0xAF, 0xD7, 0x2E, 0xAE, 0x71, 0x9E, 0x0E, 0xA7, 0x0A,
+    0xE0, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0x9E, 0x91, 0xEA, 0x6A, 0xE2, 0xF6, 0xF2, 0x9E, 0x94, 0x9E,
+    0xA9, 0x99, 0xAE, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xFF, 0xFC, 0xA2, 0xF9, 0x5F, 0x2F,
+    0x6A, 0xE9, 0x09, 0xEA, 0x69, 0xF0, 0xF9, 0x7F, 0x77, 0x72, 0x97, 0x7E, 0x97, 0x49, 0xEA, 0x75,
+    0xE9, 0x76, 0x97, 0x00, 0x19, 0x95, 0x93, 0xD9, 0x3D, 0xA2, 0xAF, 0xF4, 0xFE, 0x95, 0x9A, 0xDA,
+    0x77, 0x39, 0xAF, 0x93, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xA9, 0x3F, 0x70, 0xAE, 0x49, 0x99, 0xAF,
+    0x2F, 0xFD, 0x1F, 0xDA, 0xF0, 0xF9, 0x2A, 0xE0, 0xF3, 0xAE, 0x0F, 0x3F, 0x0F, 0xCA, 0xAF, 0xC0,
+    0x9F, 0xE9, 0xE1, 0x9F, 0xC9, 0x0A, 0xD7, 0x73, 0x97, 0x1A, 0xE7, 0x0A, 0xE9, 0x79, 0xE7, 0x29,
+    0x50, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD,
+    0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD,
+    0xAF, 0xFD, 0xA7, 0x69, 0x97, 0xEA, 0x6F, 0x6E, 0xA7, 0x60, 0x3A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF,
+    0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE,
+    0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x73, 0x99,
+    0x71, 0xF7, 0x0F, 0x70, 0xEA, 0x77, 0x00, 0x19, 0xAA, 0xA9, 0x5A, 0xFA, 0x49, 0x99, 0xE7, 0xE5,
+    0x9E, 0x95, 0x9D, 0x77, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F,
+    0x6F, 0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F,
+    0xFD, 0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0x39, 0xAA, 0xA9, 0x7A, 0xFA, 0x69, 0x99, 0xE7, 0x1E, 0x79,
+    0xE9, 0x79, 0xD7, 0x75, 0xAE, 0xA9, 0x4A, 0xFF, 0x2A, 0xFF, 0xD1, 0xF2, 0xAE, 0x99, 0xE9, 0x3E,
+    0xAA, 0xE9, 0x99, 0x99, 0xEA, 0xFF, 0xFF, 0xFF, 0xDA, 0xE7, 0x0A, 0xE9, 0x70, 0xF5, 0x91, 0xAF,
+    0xAA, 0xAA, 0xD2, 0xFF, 0xD3, 0x9F, 0xEA, 0x75, 0x1A, 0xD9, 0x19, 0xC9, 0x0F, 0xDA, 0xD9, 0x9D,
+    0xAF, 0xD0, 0x9C, 0x91, 0x9A, 0xCA, 0x74, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99,
+    0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F,
+    0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0x2A, 0xD9, 0x19, 0xCA, 0x2A, 0xFC, 0xAD,
+    0x92, 0xDA, 0xFD, 0x29, 0xC9, 0x19, 0xAC, 0xA7, 0x73, 0xAE, 0xA9, 0x4A, 0xFF, 0x2A, 0xFF, 0xD1,
+    0xF2, 0xAE, 0x99, 0xE9, 0x3E, 0xAA, 0xE9, 0x99, 0x99, 0xEA, 0xFF, 0xFF, 0xFF, 0xDA, 0xE7, 0x0A,
+    0xE9, 0x70, 0xF5, 0x91, 0xAF, 0xAA, 0xAA, 0xD2, 0xFF, 0xD3, 0x9F, 0xEA, 0x75, 0x71, 0x99, 0x97,
+    0x0A, 0xD2, 0xAF, 0x09, 0xD2, 0x9F, 0xCA, 0x99, 0x3D, 0xA0, 0x9D, 0x93, 0xAA, 0x93, 0xAA, 0x77,
+    0x0A, 0xFF, 0xC9, 0x1F, 0xFD, 0xA1, 0xFF, 0xDA, 0x1F, 0x99, 0x99, 0x99, 0x2F, 0x70, 0xF7, 0x0F,
+    0x70, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xD2, 0xF9, 0x99, 0x99, 0x92, 0xF7, 0x0F, 0x70, 0xF7, 0x0F,
+    0x70, 0xFF, 0xDA, 0x1F, 0xFD, 0xA1, 0xFF, 0xDA, 0x10, 0x73, 0x99, 0x73, 0xAD, 0x93, 0xAF, 0x09,
+    0xD9, 0x39, 0xFC, 0xA9, 0x95, 0xE0, 0xAD, 0x95, 0xAC, 0xA2, 0x9D, 0x77, 0x6A, 0xEA, 0x96, 0xAF,
+    0xF4, 0xAF, 0xFD, 0x3F, 0x2A, 0xE9, 0x19, 0xE9, 0x3E, 0xA1, 0xAE, 0x99, 0x99, 0x9E, 0xA1, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xC1, 0xAE, 0x72, 0xAE, 0x97, 0x2F, 0x59, 0x3A, 0xFA, 0xAA, 0xAD, 0x4F, 0xFD,
+    0x59, 0xFE, 0xA7, 0x71, 0x99, 0x97, 0x4E, 0x74, 0xDA, 0x0F, 0xC6, 0x99, 0xAF, 0xCA, 0x69, 0xDA,
+    0x0A, 0xD9, 0x5A, 0xA9, 0x29, 0xAA, 0x77, 0x4A, 0xFF, 0xC9, 0x3F, 0xFD, 0xA3, 0xFF, 0xDA, 0x3F,
+    0x99, 0x99, 0x99, 0x4F, 0x72, 0xF7, 0x2F, 0x72, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD4, 0xF9, 0x99,
+    0x99, 0x94, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xFF, 0xDA, 0x3F, 0xFD, 0xA3, 0xFF, 0xDA, 0x09,
+    0x97, 0x4E, 0x74, 0xDA, 0x0A, 0xF6, 0x99, 0x9F, 0xCA, 0x7E, 0x0A, 0xD9, 0x5A, 0xCA, 0x29, 0xD7,
+    0x76, 0xAE, 0xA9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF2, 0xAE, 0x91, 0x9E, 0x93, 0xEA, 0x1A, 0xE9,
+    0x99, 0x99, 0xEA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1A, 0xE7, 0x2A, 0xE9, 0x72, 0xF5, 0x93, 0xAF,
+    0xAA, 0xAA, 0xD4, 0xFF, 0xD5, 0x9F, 0xEA, 0x77, 0x7D, 0xA7, 0x0A, 0xDA, 0x70, 0x9C, 0xA1, 0xAF,
+    0x0A, 0xCA, 0x19, 0xFC, 0xA0, 0x92, 0xDA, 0x09, 0xD9, 0x2A, 0xA9, 0x3A, 0xA7, 0x6A, 0xFF, 0xC9,
+    0x0F, 0xFD, 0xA0, 0xFF, 0xDA, 0x0F, 0x99, 0x99, 0x99, 0x1F, 0x7F, 0x7F, 0x7F, 0xFD, 0x1F, 0xFD,
+    0x1F, 0xFD, 0x1F, 0x99, 0x99, 0x99, 0x1F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFD, 0xA0, 0xFF, 0xDA, 0x0F,
+    0xFD, 0xA0, 0x71, 0xAC, 0xA7, 0x2A, 0xDA, 0x72, 0x9C, 0xA3, 0xAF, 0x0A, 0xCA, 0x39, 0xFC, 0xA9,
+    0xA4, 0xE0, 0xAD, 0x94, 0xAC, 0xA2, 0x9D, 0x77, 0x4A, 0xEA, 0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F,
+    0x2A, 0xE9, 0x09, 0xE9, 0x3E, 0xA0, 0xAE, 0x99, 0x99, 0x9E, 0xA0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+    0xAE, 0x71, 0xAE, 0x97, 0x1F, 0x59, 0x2A, 0xFA, 0xAA, 0xAD, 0x3F, 0xFD, 0x49, 0xFE, 0xA7, 0x70,
+    0x29, 0x93, 0x92, 0xF9, 0x9D, 0x1A, 0xCA, 0xAF, 0x91, 0x99, 0x29, 0xA5, 0x9E, 0x94, 0x9F, 0xC4,
+    0xDA, 0x0A, 0xD2, 0xAA, 0x39, 0xAA, 0x73, 0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99,
+    0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F, 0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F,
+    0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF, 0xFD, 0xA0, 0x77, 0x0F, 0x90, 0xD3, 0xAC, 0xAF, 0xC9,
+    0x3A, 0x92, 0xAA, 0x96, 0x9A, 0xAA, 0x97, 0xFC, 0x6D, 0xA0, 0xE4, 0xD9, 0x29, 0xCA, 0x77, 0x1A,
+    0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E,
+    0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD,
+    0x39, 0xFE, 0xA7, 0x50, 0x75, 0xFA, 0x4F, 0xD9, 0x2A, 0xDA, 0x0E, 0x90, 0x9D, 0x92, 0xAD, 0x73,
+    0xAF, 0xFC, 0x9F, 0xFD, 0xAF, 0xFD, 0xAF, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0xFD, 0x0F,
+    0xFD, 0x0F, 0xFD, 0x0F, 0x99, 0x99, 0x99, 0x0F, 0x6F, 0x6F, 0x6F, 0x6F, 0xFD, 0xAF, 0xFD, 0xAF,
+    0xFD, 0xA7, 0x69, 0x97, 0xEA, 0x6F, 0x6E, 0xA7, 0x60, 0x77, 0x0F, 0xC6, 0xAF, 0xCA, 0x4A, 0xDA,
+    0x0A, 0xDA, 0x29, 0xD9, 0x29, 0xD9, 0x77, 0x1A, 0xEA, 0x94, 0xAF, 0xF2, 0xAF, 0xFD, 0x1F, 0x2A,
+    0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x99, 0x99, 0x9E, 0xAF, 0xFF, 0xFF, 0xFD, 0xAE, 0x70, 0xAE, 0x97,
+    0x0F, 0x59, 0x1A, 0xFA, 0xAA, 0xAD, 0x2F, 0xFD, 0x39, 0xFE, 0xA7, 0x73, 0x99, 0x71, 0xF7, 0x0F,
+    0x70, 0xEA, 0x77, 0x00, 0x1A, 0xDA, 0x4F, 0xC3, 0x90, 0xE9, 0x4A, 0xD4, 0xEA, 0x4D, 0x97, 0x4F,
+    0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4,
+    0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x9A, 0xAA, 0x90, 0xAF, 0xA9, 0x99, 0xE2, 0xE0, 0x9E, 0x90,
+    0x9D, 0x70, 0xAA, 0xA9, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA,
+    0x1E, 0xA1, 0xEA, 0x1E, 0xA1, 0xEA, 0x1E, 0xA0, 0x0F, 0xF0, 0xFF, 0x0A, 0xFD, 0x92, 0xF4, 0xF4,
+    0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF4, 0xF2, 0x9F, 0xD9, 0x0F, 0xF0, 0xFF, 0x73,
+    0x99, 0x5A, 0xE4, 0xF4, 0xAE, 0x69, 0x30, 0x5A, 0xD9, 0x9F, 0x0E, 0xA0, 0x9A, 0xA6, 0xAA, 0xA9,
+    0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xEA, 0x0E,
+    0xA0, 0xEA, 0x0E, 0xA6, 0x99, 0x1E, 0xA9, 0xF0, 0xEA, 0x19, 0x10, 0x77, 0x6A, 0xFD, 0xA7, 0xAF,
+    0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F, 0x09, 0xEA,
+    0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0x9E,
+    0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94, 0xAF, 0xFD,
+    0xA6, 0x9A, 0xFD, 0xA7, 0x77, 0x69, 0x97, 0x6E, 0xA7, 0x5F, 0x75, 0xEA, 0x77, 0x70, 0x3A, 0xEA,
+    0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE, 0xA0, 0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4,
+    0x9E, 0x9F, 0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE, 0x93, 0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9,
+    0x2F, 0xFC, 0xA4, 0x9F, 0xD9, 0x77, 0x69, 0x97, 0x2E, 0xA7, 0x09, 0xF7, 0x1E, 0x97, 0x29, 0x60,
+    0x59, 0xEA, 0x74, 0xAF, 0xA7, 0x59, 0xE7, 0x6E, 0x74, 0x9E, 0x97, 0x49, 0xD7, 0x77, 0x6A, 0xFD,
+    0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6, 0x9F,
+    0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A,
+    0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF, 0x94,
+    0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0x39, 0xAA, 0xA9, 0x70, 0xAF, 0xA7, 0x99, 0x9E, 0x72,
+    0xE7, 0x09, 0xE9, 0x70, 0x9D, 0x77, 0x7A, 0xEA, 0x95, 0xAF, 0xF3, 0xAF, 0xFD, 0x2F, 0x91, 0xAE,
+    0xA0, 0x9E, 0x93, 0xF0, 0xAE, 0x4A, 0xE9, 0xF4, 0x9E, 0x9F, 0x49, 0xE9, 0xAE, 0x4A, 0xE9, 0xAE,
+    0x93, 0xAE, 0x1F, 0x29, 0xF1, 0xAF, 0xAA, 0xF9, 0x2F, 0xFC, 0xA4, 0x9F, 0xD9, 0x77, 0x00, 0x75,
+    0x99, 0x97, 0x5A, 0xD9, 0x6A, 0xF0, 0x9D, 0x96, 0x9F, 0xD9, 0x97, 0x0E, 0x09, 0xDA, 0x70, 0xAA,
+    0x93, 0xAA, 0x77, 0x73, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29, 0xFC,
+    0x2F, 0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE, 0x9A,
+    0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1, 0x9F,
+    0xA3, 0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77, 0x60, 0x73, 0x99, 0x97,
+    0x2A, 0xD9, 0x39, 0xF0, 0x9D, 0x93, 0x9F, 0xCA, 0x99, 0x5E, 0x0A, 0xD9, 0x5A, 0xCA, 0x29, 0xD7,
+    0x76, 0xAE, 0xA9, 0x6A, 0xFF, 0x4A, 0xFF, 0xD3, 0xF9, 0x1A, 0xEA, 0x19, 0xE9, 0x3F, 0x1A, 0xE4,
+    0xAE, 0x90, 0xF4, 0x9E, 0x90, 0xF4, 0x9E, 0x90, 0xAE, 0x4A, 0xE9, 0x0A, 0xE9, 0x3A, 0xE2, 0xF2,
+    0x9F, 0x2A, 0xFA, 0xAF, 0x93, 0xFF, 0xCA, 0x59, 0xFD, 0x97, 0x72, 0x09, 0x99, 0x76, 0xAD, 0x77,
+    0xAD, 0x09, 0xF7, 0x19, 0x99, 0xFD, 0x72, 0xE0, 0x9D, 0xA7, 0x09, 0xAA, 0x3A, 0xA7, 0x77, 0x3A,
+    0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6,
+    0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9,
+    0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF,
+    0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0x09, 0x97, 0x5E, 0x75, 0xDA, 0x09, 0xF7, 0x99,
+    0x9F, 0xCA, 0x70, 0xE0, 0x9D, 0x96, 0xAC, 0xA2, 0x9D, 0x77, 0x70, 0xAE, 0xA9, 0x7A, 0xFF, 0x5A,
+    0xFF, 0xD4, 0xF9, 0x1A, 0xEA, 0x29, 0xE9, 0x3F, 0x2A, 0xE4, 0xAE, 0x91, 0xF4, 0x9E, 0x91, 0xF4,
+    0x9E, 0x91, 0xAE, 0x4A, 0xE9, 0x1A, 0xE9, 0x3A, 0xE3, 0xF2, 0x9F, 0x3A, 0xFA, 0xAF, 0x94, 0xFF,
+    0xCA, 0x69, 0xFD, 0x97, 0x72, 0x73, 0xAC, 0xA7, 0x6A, 0xAD, 0x77, 0xCA, 0x7A, 0xF0, 0x9C, 0xA7,
+    0x9F, 0xD0, 0x97, 0x0E, 0x09, 0xDA, 0x70, 0xAA, 0x93, 0xAA, 0x77, 0x73, 0xAF, 0xDA, 0x7A, 0xFF,
+    0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29, 0xFC, 0x2F, 0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7,
+    0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA,
+    0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1, 0x9F, 0xA3, 0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA,
+    0x69, 0xAF, 0xDA, 0x77, 0x60, 0x71, 0xAC, 0xA7, 0x2A, 0xDA, 0x73, 0xCA, 0x39, 0xF0, 0x9C, 0xA3,
+    0x9F, 0xCA, 0x0A, 0x4E, 0x0A, 0xD9, 0x4A, 0xCA, 0x29, 0xD7, 0x74, 0xAE, 0xA9, 0x5A, 0xFF, 0x3A,
+    0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xAE, 0x9F, 0x49, 0xE9, 0xF4, 0x9E,
+    0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A, 0xFA, 0xAF, 0x92, 0xFF, 0xCA, 0x49,
+    0xFD, 0x97, 0x70, 0x69, 0x93, 0x97, 0x1F, 0xA9, 0xD7, 0x0A, 0xCA, 0xAF, 0x97, 0x09, 0x92, 0x9A,
+    0x97, 0x39, 0xE9, 0x74, 0xFC, 0x97, 0x2D, 0xA0, 0xAD, 0x97, 0x0A, 0xA9, 0x3A, 0xA7, 0x77, 0x2A,
+    0xFD, 0xA7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x92, 0x9F, 0xA2, 0x9F, 0xC2, 0xFA, 0x5F, 0xA1, 0xF6,
+    0x9F, 0x09, 0xEA, 0x7F, 0x0A, 0xEA, 0x7F, 0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x9A, 0xE9,
+    0x7A, 0xE9, 0x9E, 0xA7, 0xF1, 0xF7, 0xF1, 0xFA, 0x5A, 0xEA, 0x19, 0xFA, 0x3A, 0xF3, 0xAF, 0xFF,
+    0x94, 0xAF, 0xFD, 0xA6, 0x9A, 0xFD, 0xA7, 0x76, 0x77, 0x1F, 0x90, 0xD4, 0xAC, 0xAA, 0xF9, 0x4A,
+    0xA2, 0xAA, 0x97, 0x0A, 0xAA, 0x97, 0x0F, 0xC7, 0xE0, 0xAD, 0x5A, 0xC9, 0x29, 0xD7, 0x73, 0xAE,
+    0xA9, 0x5A, 0xFF, 0x3A, 0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xAE, 0x9F,
+    0x49, 0xE9, 0xF4, 0x9E, 0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2, 0x9F, 0x1A, 0xFA, 0xAF,
+    0x92, 0xFF, 0xCA, 0x49, 0xFD, 0x97, 0x70, 0x77, 0x79, 0xF9, 0x73, 0xFD, 0x72, 0xE9, 0x9E, 0x70,
+    0xAC, 0xA3, 0xDA, 0x77, 0x72, 0xAF, 0xDA, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x29, 0xFA, 0x29,
+    0xFC, 0x2F, 0xA5, 0xFA, 0x1F, 0x69, 0xF0, 0x9E, 0xA7, 0xF0, 0xAE, 0xA7, 0xF9, 0xAE, 0x97, 0xAE,
+    0x9A, 0xE9, 0x7A, 0xE9, 0xAE, 0x97, 0xAE, 0x99, 0xEA, 0x7F, 0x1F, 0x7F, 0x1F, 0xA5, 0xAE, 0xA1,
+    0x9F, 0xA3, 0xAF, 0x3A, 0xFF, 0xF9, 0x4A, 0xFF, 0xDA, 0x69, 0xAF, 0xDA, 0x77, 0x76, 0x99, 0x76,
+    0xEA, 0x75, 0xF7, 0x5E, 0xA7, 0x77, 0x00, 0x77, 0x19, 0xF7, 0x9F, 0xD6, 0xE0, 0x9E, 0x4D, 0xA2,
+    0x9D, 0xA7, 0x73, 0xAE, 0xA9, 0x5A, 0xFF, 0x3A, 0xFF, 0xD2, 0xF9, 0x1A, 0xEA, 0x09, 0xE9, 0x3F,
+    0x0A, 0xE4, 0xAE, 0x9F, 0x49, 0xE9, 0xF4, 0x9E, 0x9A, 0xE4, 0xAE, 0x9A, 0xE9, 0x3A, 0xE1, 0xF2,
+    0x9F, 0x1A, 0xFA, 0xAF, 0x92, 0xFF, 0xCA, 0x49, 0xFD, 0x97, 0x76, 0x99, 0x72, 0xEA, 0x70, 0x9F,
+    0x71, 0xE9, 0x72, 0x96, 0x77, 0x75, 0xAE, 0xA7, 0x6A, 0xE9, 0x76, 0x9E, 0x77, 0x0D, 0xA7, 0x77,
+    0x2A, 0xE9, 0x4A, 0xFD, 0xA2, 0xAE, 0x3A, 0xFF, 0xD9, 0x0E, 0xA2, 0xAF, 0xFF, 0xF2, 0x9F, 0xA2,
+    0x9F, 0xE9, 0x2F, 0xA5, 0xFC, 0x4F, 0x7F, 0x39, 0xEA, 0x7F, 0x3A, 0xEA, 0x7A, 0xE9, 0x2A, 0xE9,
+    0x7A, 0xE9, 0x2A, 0xE9, 0x7A, 0xE9, 0x2A, 0xEA, 0x7A, 0xE9, 0x29, 0xEA, 0x7F, 0x4F, 0x7F, 0x4F,
+    0xA5, 0xAE, 0xA4, 0x9F, 0xA3, 0xAF, 0x6A, 0xFF, 0xF9, 0x7A, 0xFF, 0xDA, 0x71, 0x9A, 0xFD, 0xA7,
+    0x77, 0x40, 0x77, 0x7F, 0x97, 0x2A, 0xE9, 0x72, 0x9E, 0x74, 0xDA, 0x4A, 0xAA, 0xA7, 0x4E, 0xA3,
+    0xAE, 0xA9, 0x19, 0xE9, 0x1A, 0xFF, 0x9F, 0x1A, 0xFF, 0xFC, 0x2F, 0x91, 0xAF, 0xA2, 0x9E, 0xA3,
+    0xF3, 0xAE, 0x4A, 0xE9, 0x2F, 0x49, 0xE9, 0x2F, 0x49, 0xE9, 0x2A, 0xE4, 0xAE, 0x92, 0xAE, 0x93,
+    0xF4, 0xF2, 0x9F, 0x4A, 0xFF, 0xD9, 0x5F, 0xFC, 0xA7, 0x9F, 0xD9, 0x77, 0x60, 0x77, 0x71, 0xF7,
+    0x71, 0xF7, 0x71, 0xAD, 0xA7, 0x71, 0x9D, 0x97, 0x77, 0x0A, 0xE9, 0x4A, 0xFD, 0xA2, 0xAE, 0x3A,
+    0xFF, 0xD9, 0x0E, 0xA2, 0xAF, 0xFF, 0xF2, 0x9F, 0xA2, 0x9F, 0xE9, 0x2F, 0xA5, 0xFC, 0x4F, 0x7F,
+    0x39, 0xEA, 0x7F, 0x3A, 0xEA, 0x7A, 0xE9, 0x2A, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x7A, 0xE9, 0x2A,
+    0xEA, 0x7A, 0xE9, 0x29, 0xEA, 0x7F, 0x4F, 0x7F, 0x4F, 0xA5, 0xAE, 0xA4, 0x9F, 0xA3, 0xAF, 0x6A,
+    0xFF, 0xF9, 0x7A, 0xFF, 0xDA, 0x71, 0x9A, 0xFD, 0xA7, 0x77, 0x40, 0x77, 0x29, 0xF7, 0x5F, 0x75,
+    0xEA, 0x75, 0xAD, 0x92, 0xAA, 0xAA, 0x74, 0xEA, 0x3A, 0xEA, 0x91, 0x9E, 0x91, 0xAF, 0xF9, 0xF1,
+    0xAF, 0xFF, 0xC2, 0xF9, 0x1A, 0xFA, 0x29, 0xEA, 0x3F, 0x3A, 0xE4, 0xAE, 0x92, 0xF4, 0x9E, 0x92,
+    0xF4, 0x9E, 0x92, 0xAE, 0x4A, 0xE9, 0x2A, 0xE9, 0x3F, 0x4F, 0x29, 0xF4, 0xAF, 0xFD, 0x95, 0xFF,
+    0xCA, 0x79, 0xFD, 0x97, 0x76, 0x59, 0xAA, 0xA9, 0x77, 0xFC, 0x97, 0x69, 0x9A, 0xE7, 0x71, 0xDA,
+    0x77, 0x9E, 0x77, 0x0A, 0xD7, 0x77, 0x2A, 0xE9, 0x4A, 0xFD, 0xA2, 0xAE, 0x3A, 0xFF, 0xD9, 0x0E,
+    0xA2, 0xAF, 0xFF, 0xF2, 0x9F, 0xA2, 0x9F, 0xE9, 0x2F, 0xA5, 0xFC, 0x4F, 0x7F, 0x39, 0xEA, 0x7F,
+    0x3A, 0xEA, 0x7A, 0xE9, 0x2A, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x7A, 0xE9, 0x2A, 0xEA, 0x7A, 0xE9,
+    0x29, 0xEA, 0x7F, 0x4F, 0x7F, 0x4F, 0xA5, 0xAE, 0xA4, 0x9F, 0xA3, 0xAF, 0x6A, 0xFF, 0xF9, 0x7A,
+    0xFF, 0xDA, 0x71, 0x9A, 0xFD, 0xA7, 0x77, 0x40, 0x39, 0xAA, 0xA9, 0x73, 0xFC, 0x97, 0x29, 0x9A,
+    0xDA, 0x74, 0x9D, 0xA7, 0x3A, 0xE7, 0x4A, 0xCA, 0x4A, 0xAA, 0xA7, 0x4E, 0xA3, 0xAE, 0xA9, 0x19,
+    0xE9, 0x1A, 0xFF, 0x9F, 0x1A, 0xFF, 0xFC, 0x2F, 0x91, 0xAF, 0xA2, 0x9E, 0xA3, 0xF3, 0xAE, 0x4A,
+    0xE9, 0x2F, 0x49, 0xE9, 0x2F, 0x49, 0xE9, 0x2A, 0xE4, 0xAE, 0x92, 0xAE, 0x93, 0xF4, 0xF2, 0x9F,
+    0x4A, 0xFF, 0xD9, 0x5F, 0xFC, 0xA7, 0x9F, 0xD9, 0x77, 0x60, 0x49, 0xDA, 0x2D, 0x72, 0x9F, 0xCA,
+    0xE7, 0x2A, 0xDA, 0xFC, 0x97, 0x2D, 0x2A, 0xCA, 0x97, 0x77, 0xAE, 0x94, 0xAF, 0xDA, 0x2A, 0xE3,
+    0xAF, 0xFD, 0x90, 0xEA, 0x2A, 0xFF, 0xFF, 0x29, 0xFA, 0x29, 0xFE, 0x92, 0xFA, 0x5F, 0xC4, 0xF7,
+    0xF3, 0x9E, 0xA7, 0xF3, 0xAE, 0xA7, 0xAE, 0x92, 0xAE, 0x97, 0xAE, 0x92, 0xAE, 0x97, 0xAE, 0x92,
+    0xAE, 0xA7, 0xAE, 0x92, 0x9E, 0xA7, 0xF4, 0xF7, 0xF4, 0xFA, 0x5A, 0xEA, 0x49, 0xFA, 0x3A, 0xF6,
+    0xAF, 0xFF, 0x97, 0xAF, 0xFD, 0xA7, 0x19, 0xAF, 0xDA, 0x77, 0x74, 0x29, 0xDA, 0x2D, 0x69, 0xFC,
+    0xAD, 0xA6, 0xEA, 0xFC, 0x96, 0xD2, 0xAC, 0xA9, 0x1A, 0xAA, 0xA7, 0x4E, 0xA3, 0xAE, 0xA9, 0x19,
+    0xE9, 0x1A, 0xFF, 0x9F, 0x1A, 0xFF, 0xFC, 0x2F, 0x91, 0xAF, 0xA2, 0x9E, 0xA3, 0xF3, 0xAE, 0x4A,
+    0xE9, 0x2F, 0x49, 0xE9, 0x2F, 0x49, 0xE9, 0x2A, 0xE4, 0xAE, 0x92, 0xAE, 0x93, 0xF4, 0xF2, 0x9F,
+    0x4A, 0xFF, 0xD9, 0x5F, 0xFC, 0xA7, 0x9F, 0xD9, 0x77, 0x60, 0x77, 0xAE, 0x94, 0xAF, 0xDA, 0x2A,
+    0xE3, 0xAF, 0xFD, 0x90, 0xEA, 0x2A, 0xFF, 0xFF, 0x29, 0xFA, 0x29, 0xFE, 0x92, 0xFA, 0x5F, 0xC4,
+    0xF7, 0xF3, 0x9E, 0xA7, 0xF3, 0xAE, 0xA7, 0xAE, 0x92, 0xAE, 0x97, 0xAE, 0x92, 0xAE, 0x97, 0xAE,
+    0x92, 0xAE, 0xA7, 0xAE, 0x92, 0x9E, 0xA7, 0xF4, 0xF7, 0xF4, 0xFA, 0x5A, 0xEA, 0x49, 0xFA, 0x3A,
+    0xF6, 0xAF, 0xFF, 0x97, 0xAF, 0xFD, 0xA7, 0x19, 0xAF, 0xDA, 0x77, 0x77, 0x49, 0x97, 0x71, 0xEA,
+    0x77, 0x0F, 0x77, 0x0E, 0xA7, 0x77, 0x60, 0x74, 0xAA, 0xAA, 0x74, 0xEA, 0x3A, 0xEA, 0x91, 0x9E,
+    0x91, 0xAF, 0xF9, 0xF1, 0xAF, 0xFF, 0xC2, 0xF9, 0x1A, 0xFA, 0x29, 0xEA, 0x3F, 0x3A, 0xE4, 0xAE,
+    0x92, 0xF4, 0x9E, 0x92, 0xF4, 0x9E, 0x92, 0xAE, 0x4A, 0xE9, 0x2A, 0xE9, 0x3F, 0x4F, 0x29, 0xF4,
+    0xAF, 0xFD, 0x95, 0xFF, 0xCA, 0x79, 0xFD, 0x97, 0x77, 0x49, 0x97, 0x5E, 0xA7, 0x4F, 0x74, 0xEA,
+    0x75, 0x97, 0x10, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F,
+    0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xEA, 0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF,
+    0xFA, 0x2F, 0xFD, 0xA4, 0x9F, 0xE9, 0x77, 0x79, 0x97, 0x3E, 0xA7, 0x19, 0xF7, 0x2E, 0x97, 0x39,
+    0x70, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E,
+    0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA,
+    0x39, 0xE9, 0x0E, 0xA3, 0xAE, 0x90, 0xF2, 0x9F, 0x90, 0xFF, 0xF9, 0x09, 0xFE, 0xAE, 0x91, 0x9F,
+    0xCA, 0x0A, 0xD9, 0x77, 0x39, 0x97, 0x2E, 0xA7, 0x1F, 0x71, 0xEA, 0x77, 0x20, 0x39, 0xE9, 0x71,
+    0xAF, 0xA7, 0x29, 0xE7, 0x3D, 0xA7, 0x1A, 0xE7, 0x29, 0xD7, 0x75, 0xAE, 0x6E, 0xAF, 0x6F, 0xF6,
+    0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xFF, 0x6F, 0xF6, 0xEA,
+    0xAE, 0x94, 0x9E, 0xA9, 0xF9, 0x29, 0xF1, 0xFF, 0xFA, 0x2F, 0xFD, 0xA4, 0x9F, 0xE9, 0x77, 0x10,
+    0x4A, 0xAA, 0x97, 0x09, 0xFC, 0x70, 0x99, 0xE7, 0x2E, 0x71, 0xE9, 0x71, 0xD7, 0x74, 0xAA, 0xA9,
+    0x4A, 0xAA, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E,
+    0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x99, 0xEA, 0x39, 0xE9, 0x9E, 0xA3, 0x9E, 0x90, 0xEA,
+    0x3A, 0xE9, 0x0F, 0x29, 0xF9, 0x0F, 0xFF, 0x90, 0x9F, 0xEA, 0xE9, 0x19, 0xFC, 0xA0, 0xAD, 0x97,
+    0x50, 0x77, 0x73, 0x9F, 0x77, 0xEA, 0x77, 0xEA, 0x77, 0xAD, 0x97, 0x77, 0x3A, 0xE9, 0xAE, 0x6E,
+    0xA0, 0xAE, 0x0F, 0x6F, 0x0E, 0xA0, 0xF6, 0xFF, 0x1F, 0x6F, 0xE2, 0xF6, 0xFA, 0x93, 0xF6, 0xF5,
+    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xEA, 0x5A, 0xE9,
+    0x49, 0xEA, 0x59, 0xF9, 0x29, 0xF7, 0xFF, 0xFA, 0x70, 0xFF, 0xDA, 0x72, 0x9F, 0xE9, 0x77, 0x75,
+    0x77, 0x71, 0xAE, 0xA7, 0x49, 0xEA, 0x75, 0xE9, 0x75, 0xAC, 0xA6, 0xAA, 0xAA, 0x76, 0xEA, 0x0A,
+    0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0x99, 0xEA, 0x39, 0xEA, 0xF0, 0x9E, 0xA3, 0x9F, 0xE1, 0x9E, 0xA3,
+    0x9F, 0xCA, 0x29, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA,
+    0x39, 0xE9, 0x49, 0xEA, 0x3A, 0xE9, 0x5E, 0xA3, 0xF9, 0x5F, 0x29, 0xF9, 0x5F, 0xFF, 0x95, 0x9F,
+    0xEA, 0xE9, 0x69, 0xFC, 0x90, 0xAD, 0x97, 0x77, 0x77, 0x7F, 0x97, 0x70, 0xAE, 0x77, 0x1A, 0xE7,
+    0x71, 0x9D, 0xA7, 0x77, 0x2A, 0xE9, 0xAE, 0x6E, 0xA0, 0xAE, 0x0F, 0x6F, 0x0E, 0xA0, 0xF6, 0xFF,
+    0x1F, 0x6F, 0xE2, 0xF6, 0xFA, 0x93, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5,
+    0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xEA, 0x5A, 0xE9, 0x49, 0xEA, 0x59, 0xF9, 0x29, 0xF7, 0xFF, 0xFA,
+    0x70, 0xFF, 0xDA, 0x72, 0x9F, 0xE9, 0x77, 0x75, 0x77, 0x5F, 0x97, 0x6F, 0x77, 0xAE, 0x77, 0x9D,
+    0x94, 0xAA, 0xAA, 0x76, 0xEA, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0x99, 0xEA, 0x39, 0xEA, 0xF0,
+    0x9E, 0xA3, 0x9F, 0xE1, 0x9E, 0xA3, 0x9F, 0xCA, 0x29, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9,
+    0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x3A, 0xE9, 0x5E, 0xA3, 0xF9, 0x5F,
+    0x29, 0xF9, 0x5F, 0xFF, 0x95, 0x9F, 0xEA, 0xE9, 0x69, 0xFC, 0x90, 0xAD, 0x97, 0x77, 0x39, 0xEA,
+    0x77, 0xAF, 0xA7, 0x70, 0x9E, 0x77, 0x1E, 0x77, 0x9E, 0x77, 0x09, 0xD7, 0x77, 0x4A, 0xE9, 0xAE,
+    0x6E, 0xA0, 0xAE, 0x0F, 0x6F, 0x0E, 0xA0, 0xF6, 0xFF, 0x1F, 0x6F, 0xE2, 0xF6, 0xFA, 0x93, 0xF6,
+    0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xF5, 0xF6, 0xEA, 0x5A,
+    0xE9, 0x49, 0xEA, 0x59, 0xF9, 0x29, 0xF7, 0xFF, 0xFA, 0x70, 0xFF, 0xDA, 0x72, 0x9F, 0xE9, 0x77,
+    0x75, 0x4A, 0xAA, 0xA7, 0x59, 0xFC, 0x75, 0x99, 0xE7, 0x7E, 0x76, 0xEA, 0x76, 0xD6, 0xAA, 0xAA,
+    0x76, 0xEA, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0x99, 0xEA, 0x39, 0xEA, 0xF0, 0x9E, 0xA3, 0x9F,
+    0xE1, 0x9E, 0xA3, 0x9F, 0xCA, 0x29, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39,
+    0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x3A, 0xE9, 0x5E, 0xA3, 0xF9, 0x5F, 0x29, 0xF9, 0x5F,
+    0xFF, 0x95, 0x9F, 0xEA, 0xE9, 0x69, 0xFC, 0x90, 0xAD, 0x97, 0x77, 0x3A, 0xD9, 0x19, 0xC9, 0x72,
+    0xFD, 0xAD, 0x72, 0x9D, 0xAF, 0xCA, 0x72, 0x9C, 0x91, 0x9A, 0xCA, 0x77, 0x71, 0xAE, 0x9A, 0xE6,
+    0xEA, 0x0A, 0xE0, 0xF6, 0xF0, 0xEA, 0x0F, 0x6F, 0xF1, 0xF6, 0xFE, 0x2F, 0x6F, 0xA9, 0x3F, 0x6F,
+    0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6E, 0xA5, 0xAE,
+    0x94, 0x9E, 0xA5, 0x9F, 0x92, 0x9F, 0x7F, 0xFF, 0xA7, 0x0F, 0xFD, 0xA7, 0x29, 0xFE, 0x97, 0x77,
+    0x50, 0x3A, 0xCA, 0x2A, 0xC7, 0x1F, 0xDA, 0xD7, 0x0A, 0xDA, 0xFC, 0xA7, 0x0A, 0xC2, 0x9D, 0x93,
+    0xAA, 0xAA, 0x76, 0xEA, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0x99, 0xEA, 0x39, 0xEA, 0xF0, 0x9E,
+    0xA3, 0x9F, 0xE1, 0x9E, 0xA3, 0x9F, 0xCA, 0x29, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49,
+    0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x3A, 0xE9, 0x5E, 0xA3, 0xF9, 0x5F, 0x29,
+    0xF9, 0x5F, 0xFF, 0x95, 0x9F, 0xEA, 0xE9, 0x69, 0xFC, 0x90, 0xAD, 0x97, 0x77, 0x77, 0xAE, 0x9A,
+    0xE6, 0xEA, 0x0A, 0xE0, 0xF6, 0xF0, 0xEA, 0x0F, 0x6F, 0xF1, 0xF6, 0xFE, 0x2F, 0x6F, 0xA9, 0x3F,
+    0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6F, 0x5F, 0x6E, 0xA5,
+    0xAE, 0x94, 0x9E, 0xA5, 0x9F, 0x92, 0x9F, 0x7F, 0xFF, 0xA7, 0x0F, 0xFD, 0xA7, 0x29, 0xFE, 0x97,
+    0x77, 0x73, 0x97, 0x72, 0xEA, 0x77, 0x9E, 0xA7, 0x70, 0xE9, 0x77, 0x19, 0x75, 0x76, 0xAA, 0xAA,
+    0x76, 0xEA, 0x0A, 0xAA, 0x94, 0xAA, 0xA9, 0x9E, 0x99, 0xEA, 0x39, 0xEA, 0xF0, 0x9E, 0xA3, 0x9F,
+    0xE1, 0x9E, 0xA3, 0x9F, 0xCA, 0x29, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x39,
+    0xE9, 0x49, 0xEA, 0x39, 0xE9, 0x49, 0xEA, 0x3A, 0xE9, 0x5E, 0xA3, 0xF9, 0x5F, 0x29, 0xF9, 0x5F,
+    0xFF, 0x95, 0x9F, 0xEA, 0xE9, 0x69, 0xFC, 0x90, 0xAD, 0x97, 0x77, 0x59, 0x97, 0x7E, 0xA7, 0x6F,
+    0x76, 0xEA, 0x77, 0x97, 0x30, 0x77, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x39, 0xE7, 0x5A, 0xD7, 0x74,
+    0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93, 0xAE, 0x92, 0xF3, 0xF3, 0xAE, 0x91, 0xAE, 0x94,
+    0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF, 0xD7, 0x1F, 0xCA, 0x71, 0x9F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x77, 0x19, 0xF7, 0x3E, 0xA7, 0x3E, 0xA7, 0x3A,
+    0xD7, 0x73, 0xAA, 0xAA, 0x59, 0xAA, 0xA0, 0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE,
+    0x29, 0xE9, 0x2E, 0xA3, 0xEA, 0x19, 0xE9, 0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E,
+    0x69, 0xEA, 0xE7, 0xFD, 0x97, 0xAF, 0xC7, 0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x70,
+    0x9F, 0x7F, 0xDA, 0x7F, 0xCA, 0x70, 0xF9, 0x70, 0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93,
+    0xAE, 0x92, 0xF3, 0xF3, 0xAE, 0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF,
+    0xD7, 0x1F, 0xCA, 0x71, 0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x77, 0x49, 0x97, 0x4E, 0xA7, 0x29, 0xF7, 0x3E, 0xA7, 0x49, 0x70, 0xAA, 0xAA, 0x59, 0xAA, 0xA0,
+    0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE, 0x29, 0xE9, 0x2E, 0xA3, 0xEA, 0x19, 0xE9,
+    0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E, 0x69, 0xEA, 0xE7, 0xFD, 0x97, 0xAF, 0xC7,
+    0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x19, 0x59, 0xF1, 0xE9, 0x1F, 0xDA, 0x09, 0xEA,
+    0x1F, 0xCA, 0x2E, 0x91, 0xF9, 0x49, 0x20, 0x49, 0xE9, 0x72, 0xAF, 0xA7, 0x39, 0xE7, 0x4D, 0xA7,
+    0x2A, 0xE7, 0x39, 0xD7, 0x76, 0xAE, 0x95, 0xAE, 0x99, 0xF5, 0xF1, 0xAE, 0x93, 0xAE, 0x92, 0xF3,
+    0xF3, 0xAE, 0x91, 0xAE, 0x94, 0xF1, 0xF5, 0xAE, 0x9A, 0xE7, 0xFE, 0xA7, 0xAF, 0xD7, 0x1F, 0xCA,
+    0x71, 0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x4A, 0xAA, 0x97,
+    0x19, 0xFC, 0x71, 0x99, 0xE7, 0x3E, 0x72, 0xEA, 0x72, 0xD7, 0x75, 0xAA, 0xAA, 0x59, 0xAA, 0xA0,
+    0xAE, 0x94, 0xF1, 0xEA, 0x39, 0xE9, 0x1A, 0xE3, 0xAE, 0x29, 0xE9, 0x2E, 0xA3, 0xEA, 0x19, 0xE9,
+    0x3A, 0xE1, 0xAE, 0x5E, 0x90, 0xEA, 0x5A, 0xDA, 0x9E, 0x69, 0xEA, 0xE7, 0xFD, 0x97, 0xAF, 0xC7,
+    0x1F, 0xA7, 0x1A, 0xE9, 0x71, 0xF7, 0x19, 0xEA, 0x70, 0x9F, 0x7F, 0xDA, 0x7F, 0xCA, 0x70, 0xF9,
+    0x70, 0x39, 0xDA, 0x2D, 0x59, 0xFC, 0xAD, 0xA5, 0xDA, 0xAF, 0xC6, 0xCA, 0x2A, 0xCA, 0x77, 0x4A,
+    0xE9, 0x5A, 0xE9, 0x9F, 0x5F, 0x1A, 0xE9, 0x3A, 0xE9, 0x2F, 0x3F, 0x3A, 0xE9, 0x1A, 0xE9, 0x4F,
+    0x1F, 0x5A, 0xE9, 0xAE, 0x7F, 0xEA, 0x7A, 0xFD, 0x71, 0xFC, 0xA7, 0x19, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x50, 0x3A, 0xCA, 0x2A, 0xC5, 0xFD, 0xAD, 0x4A, 0xDA,
+    0xFC, 0xA4, 0xAC, 0x29, 0xD9, 0x77, 0x2A, 0xAA, 0xA5, 0x9A, 0xAA, 0x0A, 0xE9, 0x4F, 0x1E, 0xA3,
+    0x9E, 0x91, 0xAE, 0x3A, 0xE2, 0x9E, 0x92, 0xEA, 0x3E, 0xA1, 0x9E, 0x93, 0xAE, 0x1A, 0xE5, 0xE9,
+    0x0E, 0xA5, 0xAD, 0xA9, 0xE6, 0x9E, 0xAE, 0x7F, 0xD9, 0x7A, 0xFC, 0x71, 0xFA, 0x71, 0xAE, 0x97,
+    0x1F, 0x71, 0x9E, 0xA7, 0x09, 0xF7, 0xFD, 0xA7, 0xFC, 0xA7, 0x0F, 0x97, 0x00, 0x71, 0xC9, 0x5C,
+    0x90, 0xAF, 0xC0, 0xAA, 0x1C, 0x90, 0xAA, 0x0C, 0x2A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30,
+    0x70, 0x9C, 0x39, 0xC4, 0xFC, 0xA0, 0x9C, 0x1A, 0xA1, 0x9C, 0x0A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x60, 0x09, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x9F, 0xD9, 0x9F, 0xD0, 0x09, 0x99, 0x99,
+    0x90, 0x9F, 0xD9, 0x9F, 0xD9, 0x9F, 0xD0, 0x74, 0xFF, 0xF9, 0xFF, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x90, 0x74, 0xFF, 0xDA, 0x0F, 0xFD, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x77,
+    0x71, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x71, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D,
+    0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A,
+    0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3,
+    0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9,
+    0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0x9A, 0xA3, 0xAA, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x97, 0x5F, 0xFD, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x1A, 0xD2, 0xE1, 0xAD, 0xA1, 0xE9, 0x09, 0xE1, 0xAE, 0x29, 0x99, 0x10, 0x09, 0xE1, 0xAE, 0x1E,
+    0x91, 0xE1, 0x9D, 0xA1, 0xAD, 0x92, 0x99, 0x20, 0x1E, 0x90, 0x9E, 0x1A, 0xE1, 0xE9, 0x1E, 0x2D,
+    0xA2, 0x99, 0x20, 0xAE, 0x19, 0xE2, 0xE9, 0x1A, 0xDA, 0x19, 0xDA, 0x2E, 0x39, 0x90, 0x1A, 0xD2,
+    0xDA, 0x1E, 0x19, 0xDA, 0x0A, 0xDA, 0x1E, 0x90, 0xE9, 0x1E, 0x09, 0xE1, 0xAE, 0x0A, 0xE1, 0xEA,
+    0x19, 0x99, 0x19, 0x99, 0x10, 0x09, 0xE1, 0xAD, 0xA0, 0xAE, 0x1E, 0xA0, 0xE9, 0x1E, 0x1E, 0x19,
+    0xE0, 0x9D, 0xA1, 0xAD, 0x90, 0xAD, 0x91, 0xE2, 0x99, 0x29, 0x92, 0x1E, 0x90, 0x9E, 0x2E, 0x90,
+    0xAE, 0x19, 0xE1, 0xAD, 0xA1, 0xAD, 0xA1, 0xE9, 0x1E, 0x2E, 0x2E, 0x19, 0xD9, 0x29, 0x93, 0x99,
+    0x20, 0xAE, 0x1E, 0xA0, 0x9E, 0x1A, 0xE1, 0xE9, 0x09, 0xE1, 0xAD, 0xA1, 0xE1, 0x9D, 0xA1, 0xAD,
+    0x91, 0xE2, 0xDA, 0x29, 0x92, 0x99, 0x00, 0x29, 0xE7, 0xE7, 0xDA, 0x7D, 0xA7, 0xD9, 0x3A, 0xFF,
+    0xC9, 0xAF, 0xFC, 0x99, 0xAA, 0x9D, 0xA9, 0xAA, 0x93, 0xD9, 0x7D, 0x97, 0xDA, 0x7D, 0xA7, 0xDA,
+    0x7D, 0xA7, 0xDA, 0x7E, 0x69, 0xE6, 0x9E, 0x69, 0xE3, 0x3E, 0x7E, 0x7E, 0x7A, 0xCA, 0x39, 0xAA,
+    0x9E, 0x9A, 0xA9, 0xAF, 0xFC, 0xAA, 0xFF, 0xCA, 0x3A, 0xCA, 0x7E, 0x7E, 0x7E, 0x7A, 0xCA, 0x3A,
+    0xFF, 0xCA, 0xAF, 0xFC, 0xA9, 0xAA, 0x9E, 0xAA, 0xA9, 0x3A, 0xCA, 0x7E, 0x7E, 0x7E, 0x30, 0x09,
+    0xEA, 0x2F, 0xCA, 0x0A, 0xFD, 0x0F, 0xE0, 0xFE, 0x0A, 0xFD, 0x1F, 0xC9, 0x2A, 0xAA, 0x91, 0x99,
+    0x6A, 0xCA, 0x5A, 0xE9, 0x3A, 0xFC, 0x91, 0xAF, 0xDA, 0x0A, 0xFC, 0xA1, 0xAF, 0x92, 0xAD, 0x94,
+    0xAA, 0x77, 0x0A, 0xCA, 0x0F, 0x9F, 0x9A, 0xE2, 0x91, 0x0A, 0xCA, 0x39, 0xD9, 0x0A, 0xEA, 0x2F,
+    0x0A, 0xEA, 0x2F, 0x09, 0xE9, 0x2E, 0xA2, 0x95, 0x92, 0x0A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x0A,
+    0xEA, 0x19, 0xEA, 0x19, 0xFA, 0xEA, 0x19, 0xF1, 0x9F, 0x9E, 0x92, 0xE9, 0x2E, 0xA1, 0x95, 0x95,
+    0x91, 0x0A, 0xCA, 0x0A, 0xEA, 0xAE, 0xA9, 0xE9, 0x19, 0x10, 0x6A, 0xFC, 0x9A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x69, 0xFC, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x60, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70,
+    0x5F, 0xCA, 0xC4, 0xC4, 0xC4, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFC, 0x4C,
+    0x4C, 0x4F, 0xE1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x77, 0x77, 0x19, 0xF9, 0x59, 0xD9,
+    0x76, 0x9F, 0xD5, 0xE7, 0x7E, 0xAA, 0xDA, 0x3A, 0xD9, 0x77, 0xE1, 0xE3, 0xE7, 0x70, 0xDA, 0x1E,
+    0x2A, 0xD9, 0x77, 0x0D, 0xA1, 0xAD, 0x19, 0xDA, 0x77, 0x1D, 0xA1, 0xE1, 0xE7, 0x72, 0xE1, 0xE0,
+    0x9D, 0xA0, 0x9E, 0x94, 0xAD, 0xA3, 0xAD, 0xAA, 0xE0, 0xE0, 0xAF, 0xCA, 0x2F, 0xD3, 0xFD, 0x09,
+    0xD9, 0x0E, 0xAE, 0x1A, 0xDA, 0xAD, 0xA2, 0x9F, 0x90, 0xE0, 0x9D, 0x90, 0x9D, 0xA0, 0xE1, 0xE7,
+    0x0A, 0xD9, 0x0A, 0xD9, 0x1D, 0xA0, 0xE1, 0xE7, 0x0E, 0x1A, 0xD9, 0x1E, 0x0D, 0xA1, 0xAD, 0x7A,
+    0xD9, 0x1A, 0xD9, 0x1E, 0x0D, 0xA1, 0xAD, 0x69, 0xDA, 0x2A, 0xD9, 0x09, 0xDA, 0x0E, 0x1E, 0x6E,
+    0x4E, 0x0E, 0x90, 0xE9, 0x9E, 0x59, 0xDA, 0x4A, 0xFD, 0x19, 0xFD, 0x95, 0xE6, 0xAF, 0x39, 0xF9,
+    0x77, 0x77, 0x10, 0x77, 0x77, 0x72, 0x9F, 0x95, 0x9D, 0x97, 0x77, 0x9F, 0xD5, 0xE7, 0x77, 0x0E,
+    0xAA, 0xE3, 0xAD, 0x97, 0x77, 0x0E, 0x1E, 0x3E, 0x77, 0x71, 0xE1, 0xE2, 0xAD, 0x97, 0x77, 0x09,
+    0xDA, 0x1A, 0xD9, 0x1E, 0x77, 0x72, 0xE1, 0xE1, 0xAD, 0x77, 0x73, 0xE1, 0xE0, 0x9D, 0xA0, 0x9E,
+    0xA4, 0xAD, 0xA4, 0x9E, 0xA2, 0xEA, 0xAE, 0x0E, 0x0A, 0xFD, 0x2F, 0xD9, 0x1A, 0xFC, 0xA2, 0xFD,
+    0x99, 0xDA, 0x0E, 0xAE, 0x90, 0xAE, 0xAE, 0x1E, 0xAE, 0x91, 0x9F, 0x90, 0xE0, 0x9D, 0xA0, 0x9D,
+    0xA0, 0xE1, 0xE0, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0xAD, 0x91, 0xE0, 0xE1, 0xAD, 0x9A, 0xD9,
+    0x1E, 0x7E, 0x1A, 0xD9, 0x1E, 0x0E, 0x1A, 0xD9, 0xAD, 0x91, 0xE6, 0xAD, 0x91, 0xAD, 0x91, 0xE0,
+    0xE1, 0xAD, 0x9A, 0xD9, 0x1E, 0x6E, 0x29, 0xDA, 0x1E, 0x0E, 0x1A, 0xD9, 0x9D, 0xA1, 0xE5, 0xAD,
+    0x4E, 0x9A, 0xDA, 0x0A, 0xDA, 0x9E, 0x1E, 0x9A, 0xDA, 0x49, 0xDA, 0x4A, 0xFD, 0x2F, 0xDA, 0x1A,
+    0xFD, 0x5E, 0x6A, 0xF3, 0x9F, 0xA3, 0xAF, 0x77, 0x77, 0x72, 0x2A, 0xD9, 0x19, 0xE2, 0xE2, 0x9D,
+    0xA2, 0xE2, 0x9D, 0x92, 0x9A, 0x93, 0x2A, 0xD9, 0x09, 0xE2, 0x9E, 0x1E, 0x92, 0xE1, 0x9E, 0x29,
+    0xDA, 0x1E, 0x3E, 0x19, 0xD9, 0x29, 0xD9, 0x1E, 0x39, 0xA9, 0x2A, 0xA4, 0x2A, 0xD9, 0x09, 0xE1,
+    0xAD, 0x91, 0x9E, 0x1E, 0x90, 0x9E, 0x2E, 0x19, 0xE1, 0xE9, 0x19, 0xDA, 0x1E, 0x19, 0xDA, 0x2E,
+    0x19, 0xD9, 0x1E, 0x29, 0xD9, 0x1E, 0x19, 0xD9, 0x29, 0xA9, 0x2A, 0xA2, 0x9A, 0x93, 0x9D, 0xA3,
+    0xE9, 0x3E, 0x3A, 0xD9, 0x3E, 0x4D, 0x93, 0x9A, 0x90, 0x9D, 0xA1, 0xAD, 0x93, 0xE9, 0x09, 0xE4,
+    0xE1, 0xAD, 0x93, 0xAD, 0x91, 0xE4, 0xE1, 0x9D, 0x94, 0xD9, 0x1A, 0xD4, 0x9A, 0x92, 0xAA, 0x00,
+    0x9D, 0xA1, 0xAD, 0x90, 0x9E, 0x3E, 0x90, 0x9E, 0x1E, 0x93, 0xE1, 0xAD, 0x91, 0xE3, 0xAD, 0x91,
+    0xE1, 0x9D, 0x93, 0xE1, 0x9D, 0x91, 0xE4, 0xD9, 0x1A, 0xD2, 0xD9, 0x39, 0xA9, 0x2A, 0xA2, 0x9A,
+    0x90, 0x75, 0xD6, 0x9D, 0x95, 0xF4, 0x9C, 0xAA, 0xC9, 0x3D, 0x1D, 0x29, 0xCA, 0x1A, 0xC9, 0x1D,
+    0x3D, 0x09, 0xD3, 0xAC, 0x90, 0x49, 0x69, 0xD9, 0x4E, 0xA3, 0xF3, 0xF3, 0xAE, 0x93, 0xF5, 0xF4,
+    0x9E, 0xA4, 0x9E, 0x94, 0xAD, 0xA5, 0xA9, 0x10, 0x29, 0x59, 0xDA, 0x4A, 0xE9, 0x4F, 0x5F, 0x5F,
+    0x4F, 0x3A, 0xE3, 0xAE, 0x92, 0x9E, 0xA3, 0xAD, 0xA6, 0xA4, 0x77, 0x49, 0x4E, 0x49, 0x2A, 0xD3,
+    0xE9, 0x2A, 0xD1, 0xF2, 0xE9, 0x1A, 0xE2, 0xF1, 0x9A, 0xA1, 0xAE, 0x4F, 0x4A, 0xE6, 0xF2, 0xAE,
+    0x70, 0xF0, 0xAE, 0x5A, 0xA9, 0x1F, 0xE2, 0xAA, 0x0A, 0xE2, 0xFC, 0x2F, 0xAE, 0x2A, 0xF2, 0xF9,
+    0xDA, 0x1A, 0xFD, 0x19, 0xDA, 0x4A, 0xE9, 0xF7, 0x0A, 0xE2, 0xEA, 0x6A, 0xE4, 0xEA, 0x4A, 0xE2,
+    0x92, 0xEA, 0x2A, 0xE2, 0xE2, 0xEA, 0x1E, 0x3E, 0xA2, 0xE2, 0xA4, 0xE9, 0x3C, 0x71, 0x9A, 0x97,
+    0x9E, 0xA1, 0x9E, 0xAA, 0xEA, 0x19, 0xEA, 0x9E, 0xA1, 0x9E, 0xA9, 0xE9, 0x19, 0xEA, 0x9E, 0x92,
+    0xEA, 0x9E, 0x92, 0xEA, 0x9E, 0x92, 0xE9, 0x0E, 0x92, 0xE9, 0x0E, 0x3E, 0x90, 0xE3, 0xE9, 0x0E,
+    0x3E, 0x1E, 0x3E, 0x77, 0x71, 0xAC, 0xA3, 0xAC, 0xA0, 0xAE, 0xA1, 0x9E, 0xAA, 0xEA, 0x19, 0xF9,
+    0xE9, 0x2E, 0x91, 0x95, 0x91, 0x75, 0xAF, 0xCA, 0x2A, 0xFF, 0xC9, 0x09, 0xFF, 0xD1, 0xCA, 0xE0,
+    0x9E, 0x3E, 0x1E, 0x92, 0xE1, 0xE3, 0xE0, 0xF3, 0xFE, 0x4F, 0xD5, 0xFA, 0x6A, 0xE7, 0xAD, 0xA7,
+    0x77, 0x79, 0xAC, 0x97, 0xF7, 0xF7, 0xAE, 0x71, 0x95, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xFF, 0xA0, 0xFF, 0xFA, 0x76, 0x9C, 0x72, 0xCA, 0x0D, 0x70, 0xAC, 0x2D, 0x95, 0xD9, 0x3E,
+    0xAA, 0xAE, 0x95, 0x9A, 0xF9, 0x30, 0x4A, 0xAC, 0xAA, 0x96, 0xAF, 0xF4, 0xDA, 0x49, 0xD2, 0xAC,
+    0x70, 0xD0, 0x9C, 0x72, 0xC9, 0x09, 0x72, 0x90, 0x77, 0x2D, 0x7A, 0xC9, 0x7D, 0x7A, 0xC9, 0x7D,
+    0x79, 0xC9, 0x7D, 0x79, 0xCA, 0x7D, 0x79, 0xD9, 0x6F, 0x59, 0xCA, 0x9C, 0x94, 0xD1, 0xD3, 0x9C,
+    0xA1, 0xAC, 0x92, 0xAC, 0x3D, 0x2C, 0xA3, 0xAC, 0x90, 0x73, 0xAD, 0x97, 0x77, 0xAD, 0x97, 0x77,
+    0x9D, 0x77, 0x4A, 0x91, 0x9D, 0x29, 0x97, 0x7F, 0xAD, 0xAE, 0xA7, 0x7F, 0xFF, 0x77, 0x99, 0xAA,
+    0xFA, 0xA9, 0x97, 0x72, 0xAF, 0x97, 0x74, 0x9D, 0xAE, 0x77, 0x4E, 0x09, 0xE7, 0x72, 0x9D, 0xA1,
+    0xE7, 0x59, 0xDA, 0x29, 0x29, 0x92, 0xE7, 0x09, 0xDA, 0x73, 0xE7, 0x1D, 0x97, 0x3E, 0x49, 0x92,
+    0xD9, 0x19, 0xA3, 0xA9, 0x1A, 0xD1, 0x9A, 0x0A, 0xEA, 0xDA, 0xF3, 0xFE, 0xAE, 0x9F, 0xFF, 0x29,
+    0xFF, 0xEA, 0x99, 0xAA, 0xFA, 0xA9, 0x93, 0x99, 0xAF, 0xCA, 0xA9, 0x39, 0xFA, 0x71, 0xFC, 0x6E,
+    0xAD, 0x97, 0xAD, 0x9E, 0x4E, 0x90, 0xE6, 0x9E, 0x0A, 0xDA, 0x3E, 0x1A, 0xD9, 0x5A, 0xD9, 0x1D,
+    0xA4, 0x99, 0x29, 0x71, 0xA2, 0x93, 0x09, 0x99, 0x99, 0x0A, 0xFD, 0xAF, 0xDA, 0xFC, 0xA0, 0x71,
+    0xDA, 0x71, 0xAD, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7, 0x1E, 0x71,
+    0xAD, 0x97, 0x1E, 0x71, 0xAD, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7,
+    0x1E, 0x71, 0xAD, 0x97, 0x10, 0x0F, 0xCA, 0x9F, 0xCA, 0x9E, 0xAA, 0x99, 0xE2, 0x9E, 0x29, 0xE2,
+    0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xE9, 0x90, 0x9F, 0xCA, 0x9F, 0xCA, 0x9E, 0x99, 0x09, 0xE2, 0x9E,
+    0x29, 0xE2, 0x9E, 0x29, 0xE2, 0x9E, 0x29, 0xEA, 0xA9, 0x9F, 0xCA, 0x0F, 0xCA, 0x9F, 0xC9, 0x9F,
+    0xCA, 0x9A, 0xAE, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA0,
+    0x99, 0xAD, 0xA9, 0xFC, 0xA9, 0xFC, 0xA0, 0x99, 0xEA, 0x2A, 0xDA, 0x2A, 0xDA, 0x2A, 0xDA, 0x2A,
+    0xDA, 0x2A, 0xDA, 0x2A, 0xDA, 0x0A, 0xAE, 0xA9, 0xFC, 0xA9, 0xFC, 0xA0, 0x77, 0x71, 0xAF, 0xCA,
+    0x39, 0xAF, 0xCA, 0x2A, 0xFF, 0xC9, 0x0F, 0xFD, 0x19, 0xFF, 0xD0, 0xAF, 0xFD, 0x1C, 0xA9, 0x2A,
+    0xE9, 0x0C, 0xA3, 0xF7, 0x0E, 0x96, 0x9E, 0x79, 0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA5, 0x9F, 0x6A,
+    0xF5, 0x9F, 0x6A, 0xF6, 0xEA, 0x69, 0xEA, 0x69, 0xE7, 0xAD, 0xA7, 0x9D, 0xA7, 0xAD, 0x97, 0x77,
+    0x77, 0x77, 0x0A, 0xC9, 0x79, 0xD9, 0x7F, 0x7F, 0x7F, 0x96, 0xF7, 0xAE, 0x7E, 0xA7, 0x19, 0x71,
+    0x99, 0x50, 0x77, 0x3A, 0xFC, 0xA3, 0xAE, 0x9A, 0xFF, 0xC9, 0x1A, 0xEA, 0x9F, 0xFD, 0x1A, 0xE9,
+    0x0C, 0xA9, 0x2A, 0xE9, 0x0A, 0xE9, 0x7E, 0x90, 0x9E, 0x96, 0x9E, 0x90, 0x9E, 0x96, 0xF1, 0x9E,
+    0x59, 0xF2, 0x9E, 0x49, 0xF4, 0xE4, 0xEA, 0x5E, 0x39, 0xE6, 0xE3, 0x9D, 0xA6, 0xE7, 0x77, 0x77,
+    0x0A, 0xC9, 0x6A, 0xCA, 0x3F, 0x5A, 0xE9, 0x2F, 0x94, 0xAE, 0xA2, 0xAE, 0x59, 0xE5, 0x97, 0x09,
+    0x10, 0x77, 0x19, 0xEA, 0x2A, 0xFD, 0x91, 0xAE, 0xA0, 0x9F, 0xFC, 0xA0, 0x9E, 0xA1, 0xFF, 0xD0,
+    0x9E, 0x91, 0xAA, 0x92, 0xAE, 0x99, 0xE9, 0x70, 0xEA, 0x9E, 0x97, 0x0E, 0x99, 0xE9, 0x7F, 0x1E,
+    0x95, 0x9F, 0x91, 0xE5, 0x9F, 0x92, 0xE5, 0xF4, 0xE5, 0xE5, 0xE4, 0x9D, 0xA7, 0x77, 0x77, 0x1A,
+    0xCA, 0x5A, 0xCA, 0x4A, 0xEA, 0x3A, 0xE9, 0x3A, 0xEA, 0x3F, 0x93, 0x9E, 0x93, 0x9E, 0x69, 0x79,
+    0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0x0F, 0xFF, 0x70, 0xE9, 0x79, 0xE7, 0x0E,
+    0x97, 0xAE, 0x70, 0xE7, 0x0E, 0xA7, 0x9E, 0x70, 0xE9, 0x7A, 0xE7, 0x9E, 0x97, 0xEA, 0x60, 0x0F,
+    0xFC, 0xA3, 0xFF, 0xE9, 0x1D, 0x99, 0xFF, 0x1D, 0x1F, 0xF9, 0x0D, 0x1F, 0xFA, 0x0D, 0x1F, 0xFC,
+    0x0D, 0x1F, 0xFC, 0x0D, 0x1F, 0xFA, 0x0D, 0x1F, 0xFA, 0x0D, 0x1F, 0xF9, 0x0D, 0x1F, 0xF1, 0xD1,
+    0xFD, 0xA2, 0xD1, 0xD9, 0x99, 0x4D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D,
+    0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x7D, 0x1D, 0x77, 0x40, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF,
+    0xE1, 0xFF, 0xF1, 0xFF, 0x1D, 0x09, 0xFF, 0x1D, 0x0A, 0xFF, 0x1D, 0x0A, 0xFF, 0x1D, 0x0A, 0xFF,
+    0x1D, 0x0A, 0xFF, 0x1D, 0x09, 0xFF, 0x1D, 0x1F, 0xFA, 0xAD, 0x2F, 0xFE, 0x3A, 0xFF, 0xC0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x3F, 0xFE, 0x91, 0xFF, 0xF1, 0xD1, 0xFF, 0xA0, 0xD1, 0xFF, 0xC0, 0xD1,
+    0xFF, 0xC0, 0xD1, 0xFF, 0xC0, 0xD1, 0xFF, 0xC0, 0xD1, 0xFF, 0xC0, 0xD1, 0xFF, 0xA0, 0xDA, 0xAF,
+    0xF9, 0x0F, 0xFE, 0xA1, 0xFF, 0xCA, 0x92, 0x4E, 0x97, 0x0A, 0xD7, 0x1A, 0xD5, 0xA9, 0x19, 0xD2,
+    0xA9, 0x0F, 0xEA, 0xEA, 0x0F, 0xFE, 0xA0, 0x99, 0xAA, 0xFA, 0x99, 0x93, 0xFC, 0x95, 0xAD, 0xAE,
+    0x49, 0xE0, 0x9E, 0x39, 0xDA, 0x1D, 0xA5, 0x92, 0x93, 0x0A, 0xCA, 0x19, 0xEA, 0x0A, 0xEA, 0x1E,
+    0x97, 0x77, 0x77, 0x29, 0xE2, 0xE9, 0x1E, 0xA1, 0x9E, 0x2E, 0x2A, 0xD6, 0x4A, 0xAC, 0xAA, 0x96,
+    0xAF, 0xF4, 0xDA, 0x49, 0xD2, 0xAC, 0x70, 0xD0, 0x9C, 0x72, 0xC9, 0x09, 0x72, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9C, 0x72, 0xCA, 0x0D,
+    0x70, 0xAC, 0x2D, 0x95, 0xD9, 0x3E, 0xAA, 0xAE, 0x95, 0x9A, 0xF9, 0x30, 0x4E, 0x97, 0x0A, 0xD7,
+    0x1A, 0xD5, 0xA9, 0x19, 0xD2, 0xA9, 0x0F, 0xEA, 0xEA, 0x0F, 0xFE, 0xA0, 0x99, 0xAA, 0xFA, 0x99,
+    0x93, 0xFC, 0x95, 0xAD, 0xAE, 0x49, 0xE0, 0x9E, 0x39, 0xDA, 0x1D, 0xA5, 0x92, 0x97, 0x75, 0xE9,
+    0x70, 0xAD, 0x71, 0xAD, 0x5A, 0x91, 0x9D, 0x2A, 0x90, 0xFE, 0xAE, 0xA0, 0xFF, 0xEA, 0x09, 0x9A,
+    0xAF, 0xA9, 0x99, 0x3F, 0xC9, 0x5A, 0xDA, 0xE4, 0x9E, 0x09, 0xE3, 0x9D, 0xA1, 0xDA, 0x59, 0x29,
+    0x30, 0x72, 0x9E, 0x2A, 0xD9, 0xF9, 0x1E, 0x0F, 0x19, 0xD9, 0x1D, 0xA1, 0xE6, 0x9D, 0xA6, 0xAD,
+    0x7E, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x6E, 0x7E, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x1A, 0xCA, 0x1E,
+    0x1A, 0xE9, 0x9D, 0xA1, 0xAE, 0x9A, 0xD9, 0x19, 0xE7, 0x09, 0x10, 0x49, 0x97, 0x72, 0xAF, 0xFA,
+    0x97, 0xD1, 0xFF, 0xFE, 0xAA, 0xAA, 0xDA, 0x0A, 0xD9, 0x29, 0xAA, 0xFF, 0xEA, 0x1A, 0xA7, 0x19,
+    0x9A, 0xFA, 0x92, 0x59, 0x99, 0x97, 0x9F, 0xE9, 0x4A, 0xD9, 0x29, 0xAC, 0xA2, 0x9C, 0x96, 0x9C,
+    0xA1, 0xC9, 0x71, 0xC9, 0x0A, 0x72, 0x99, 0x5A, 0xA7, 0x3D, 0x7A, 0xC9, 0x0D, 0x09, 0xCA, 0x3A,
+    0xD9, 0xD9, 0xDA, 0x4A, 0xFD, 0xA3, 0x99, 0x9F, 0xD9, 0x99, 0x09, 0xFF, 0xF9, 0x0F, 0xFF, 0x39,
+    0xFD, 0x94, 0x9F, 0xF9, 0x3D, 0xA0, 0xD0, 0xAD, 0x4A, 0x1D, 0x1A, 0x70, 0xD5, 0x70, 0x99, 0x71,
+    0xF7, 0x0F, 0x70, 0xF7, 0x19, 0x97, 0x77, 0x77, 0x1A, 0xCA, 0x70, 0x9E, 0xA7, 0xAE, 0xA7, 0x0E,
+    0x77, 0x77, 0x77, 0x70, 0x97, 0x2E, 0xA7, 0x0F, 0x70, 0xF7, 0x1A, 0xA1, 0x2A, 0xD9, 0x09, 0xDA,
+    0x1E, 0x1E, 0x91, 0x9E, 0x1E, 0x1E, 0x90, 0xAD, 0xA2, 0xE1, 0xAD, 0xA0, 0x9E, 0x1E, 0x29, 0xDA,
+    0x1E, 0x1E, 0x1A, 0xD9, 0x2E, 0x1A, 0xD1, 0x9D, 0x91, 0xDA, 0x29, 0xD9, 0x1D, 0xA1, 0xE1, 0xAD,
+    0x39, 0xA9, 0x2A, 0xA2, 0xAA, 0x2A, 0xA9, 0x30, 0x70, 0x99, 0x77, 0x0F, 0x77, 0xF7, 0x7F, 0x77,
+    0x09, 0x97, 0x77, 0x77, 0x77, 0x75, 0xAC, 0xA7, 0x3A, 0xCA, 0x09, 0xEA, 0x71, 0xF9, 0xAE, 0xA7,
+    0x1F, 0x90, 0xE7, 0x29, 0xE7, 0x77, 0x77, 0x77, 0x75, 0x97, 0x71, 0xEA, 0x77, 0xF7, 0x7F, 0x77,
+    0x0A, 0xA7, 0x00, 0x19, 0x74, 0x99, 0x19, 0xE9, 0x71, 0xAE, 0x0A, 0xEA, 0x71, 0xF9, 0x9E, 0x97,
+    0x1A, 0xE1, 0x9A, 0x97, 0x39, 0xA7, 0x77, 0x77, 0x77, 0x75, 0x9D, 0x97, 0x7F, 0x77, 0xF7, 0x7A,
+    0xD9, 0x77, 0x77, 0x77, 0x77, 0x59, 0x75, 0x91, 0x9E, 0x97, 0x1A, 0xE0, 0xAE, 0xA7, 0x1F, 0x99,
+    0xEA, 0x71, 0xAE, 0x19, 0xA9, 0x73, 0x9A, 0x90, 0x5E, 0x9A, 0xEA, 0xAE, 0xA0, 0xE7, 0x77, 0x77,
+    0x73, 0xAC, 0xA0, 0x9E, 0xAA, 0xEA, 0x0E, 0x91, 0x91, 0x59, 0xAA, 0x72, 0x9E, 0xA7, 0x19, 0xF7,
+    0x2E, 0xA7, 0x39, 0x97, 0x77, 0x77, 0x73, 0xAA, 0xA6, 0x9A, 0xA0, 0x9E, 0xA5, 0xFA, 0xEA, 0x49,
+    0xF9, 0xE9, 0x5E, 0xA1, 0x97, 0x09, 0x97, 0x77, 0x77, 0x73, 0xAC, 0xA7, 0x29, 0xEA, 0x71, 0x9F,
+    0x72, 0xE9, 0x73, 0x96, 0x70, 0x9A, 0xA7, 0x71, 0xE7, 0x3E, 0x91, 0xE2, 0xE9, 0x3A, 0xEA, 0x1E,
+    0x19, 0xF3, 0xAE, 0xA1, 0xE1, 0x9F, 0x4A, 0xD2, 0xE2, 0xAD, 0x97, 0x2E, 0x77, 0x1E, 0x71, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0xE9, 0x0F, 0xFF, 0xFE, 0x90, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x97, 0x1E, 0x77, 0x1E, 0x73, 0xAC, 0xA2, 0xE2, 0xAC,
+    0xA4, 0x9E, 0xA1, 0xE1, 0x9F, 0x3A, 0xEA, 0x1E, 0x19, 0xF4, 0xE9, 0x1E, 0x2E, 0xA5, 0x93, 0xE3,
+    0x97, 0x4A, 0xD7, 0x00, 0x0A, 0xD0, 0x9E, 0xA9, 0xEA, 0x0E, 0x97, 0x70, 0x92, 0xE9, 0x9F, 0x9E,
+    0xA0, 0xAC, 0xA7, 0x70, 0x9A, 0xA0, 0x9E, 0xAA, 0xEA, 0x9E, 0x91, 0x99, 0x00, 0x19, 0x19, 0xE9,
+    0xAE, 0xA9, 0xE9, 0x09, 0xA9, 0x29, 0x19, 0xE9, 0xAE, 0xA9, 0xE9, 0x09, 0xA9, 0x29, 0x19, 0xE9,
+    0xAE, 0xA9, 0xEA, 0x09, 0xA9, 0x29, 0x19, 0xE9, 0xAE, 0xA9, 0xEA, 0x09, 0xA9, 0x00, 0x5A, 0xFA,
+    0x1A, 0xA3, 0xAA, 0x3A, 0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5F, 0xE3, 0xD3,
+    0xD3, 0xFE, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFA, 0x0F, 0x19, 0xD9, 0x2D, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x79, 0x93, 0xD2, 0xAD, 0xA1, 0xF0, 0xAF, 0xA1,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x7D, 0x2C, 0x99, 0xC0, 0xAA, 0x1A, 0xA0, 0xAA, 0xAA,
+    0x2A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5A, 0xDA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA1,
+    0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x39, 0x94, 0xFC, 0x91, 0xAF, 0xD1, 0xE9, 0xAD,
+    0xA9, 0xDA, 0x1E, 0x9D, 0xA1, 0xE9, 0xDA, 0x1E, 0x9D, 0xA1, 0xE0, 0xE0, 0x9D, 0xA0, 0xFE, 0x90,
+    0x9F, 0xD3, 0xAD, 0xA1, 0x9A, 0x0D, 0xA9, 0xA0, 0x99, 0x0D, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+    0xAA, 0xCA, 0x75, 0xAE, 0x49, 0xF4, 0xFC, 0x3A, 0xCA, 0xE3, 0xD0, 0xE2, 0xD9, 0x0E, 0x1A, 0xD9,
+    0x9E, 0x90, 0xAF, 0xF9, 0x9A, 0xAA, 0xAE, 0xA5, 0xE6, 0xAA, 0x91, 0x79, 0xFD, 0x09, 0xFD, 0x0A,
+    0xCA, 0x4A, 0xCA, 0x99, 0x2A, 0xFC, 0xA0, 0x9A, 0xAA, 0xE9, 0x4D, 0xA4, 0xDA, 0xCA, 0x99, 0xAD,
+    0x9F, 0xE0, 0x9A, 0xDA, 0x91, 0x49, 0x99, 0x3F, 0xC2, 0xFD, 0x1E, 0x94, 0xDA, 0x09, 0x29, 0xDA,
+    0xF0, 0x9E, 0xAA, 0xDA, 0x9D, 0x91, 0xE9, 0xD9, 0x1E, 0x0E, 0x9A, 0xDA, 0x09, 0xFD, 0x3A, 0xDA,
+    0x10, 0x70, 0x9F, 0xF9, 0xFF, 0x5D, 0xA4, 0xAD, 0x5D, 0xA4, 0xAD, 0x5E, 0x4A, 0xD9, 0x4E, 0x4A,
+    0xD9, 0x4A, 0xAA, 0x30, 0x39, 0x94, 0xFC, 0xA1, 0xEA, 0xE9, 0x0D, 0xA1, 0xDA, 0x0E, 0x09, 0xD9,
+    0x1F, 0xC9, 0x19, 0xFC, 0xA1, 0xDA, 0x0A, 0xDA, 0x9D, 0x2A, 0xD9, 0xDA, 0x09, 0xE0, 0xFE, 0x91,
+    0x9A, 0xDA, 0x10, 0x39, 0x94, 0xFC, 0x91, 0xFE, 0x09, 0xD9, 0x1D, 0xA9, 0xD9, 0x1E, 0x9D, 0xA0,
+    0x9E, 0x0F, 0xF1, 0xAC, 0xA0, 0xDA, 0x49, 0xD9, 0x09, 0x99, 0xAE, 0x1A, 0xFC, 0x91, 0x9D, 0xAA,
+    0x20, 0x29, 0xA9, 0x5A, 0xC9, 0x5A, 0xC9, 0x3F, 0xE1, 0xFE, 0x3A, 0xC9, 0x5A, 0xC9, 0x59, 0xA9,
+    0x20, 0x0F, 0xE1, 0xFE, 0x00, 0x09, 0x99, 0x99, 0x99, 0x1F, 0xE1, 0x99, 0x99, 0x99, 0x91, 0x99,
+    0x99, 0x99, 0x91, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x00, 0x19, 0xAA, 0x1D, 0x90, 0xAD, 0x1D, 0x91,
+    0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD1, 0x9D, 0x2D, 0x2D, 0xA1, 0x9D, 0x2D, 0x92, 0x99, 0x9A,
+    0x92, 0xD2, 0xAC, 0xA1, 0x9D, 0x2D, 0x2D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD1, 0x9D,
+    0x1D, 0x90, 0x9D, 0x19, 0x92, 0x99, 0x19, 0xA9, 0x1D, 0xAF, 0xC0, 0xEA, 0x9A, 0xD9, 0xE2, 0xD9,
+    0xDA, 0x2D, 0x9D, 0xA2, 0xD9, 0xDA, 0x2D, 0x9D, 0xA2, 0xD9, 0xAC, 0xA2, 0xD9, 0x39, 0x94, 0xFC,
+    0x91, 0xAF, 0xD1, 0xE9, 0xAD, 0xA9, 0xDA, 0x1E, 0x9D, 0xA1, 0xE9, 0xDA, 0x1E, 0x9D, 0xA1, 0xE0,
+    0xE0, 0x9D, 0xA0, 0xFE, 0x90, 0x9F, 0xD3, 0xAD, 0xA1, 0x71, 0x9E, 0x19, 0xF0, 0xAF, 0xC0, 0xAC,
+    0xAE, 0x19, 0x0E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3A, 0xAA, 0x39, 0x93, 0x9F, 0xC9, 0x1F, 0xE1,
+    0x9A, 0x1E, 0x94, 0xE4, 0x9E, 0x39, 0xE3, 0x9E, 0x39, 0xE4, 0xFE, 0x99, 0xFE, 0xA0, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x39, 0x93, 0xAF, 0xC9, 0x1F, 0xE1, 0x99, 0x19, 0xD9, 0x49, 0xD2, 0x9F, 0x92, 0x9F,
+    0xA5, 0x9D, 0x95, 0xDA, 0x9C, 0xA9, 0x9A, 0xDA, 0x9F, 0xE1, 0x9A, 0xDA, 0x91, 0x75, 0xAE, 0x49,
+    0xF4, 0xFC, 0x3A, 0xCA, 0xE3, 0xD0, 0xE2, 0xD9, 0x0E, 0x1A, 0xD9, 0x9E, 0x90, 0xAF, 0xF9, 0x9A,
+    0xAA, 0xAE, 0xA5, 0xE6, 0xAA, 0x91, 0x79, 0xFD, 0x09, 0xFD, 0x0A, 0xCA, 0x4A, 0xCA, 0x99, 0x2A,
+    0xFC, 0xA0, 0x9A, 0xAA, 0xE9, 0x4D, 0xA4, 0xDA, 0xCA, 0x99, 0xAD, 0x9F, 0xE0, 0x9A, 0xDA, 0x91,
+    0x49, 0x99, 0x3F, 0xC2, 0xFD, 0x1E, 0x94, 0xDA, 0x09, 0x29, 0xDA, 0xF0, 0x9E, 0xAA, 0xDA, 0x9D,
+    0x91, 0xE9, 0xD9, 0x1E, 0x0E, 0x9A, 0xDA, 0x09, 0xFD, 0x3A, 0xDA, 0x10, 0x70, 0x9F, 0xF9, 0xFF,
+    0x5D, 0xA4, 0xAD, 0x5D, 0xA4, 0xAD, 0x5E, 0x4A, 0xD9, 0x4E, 0x4A, 0xD9, 0x4A, 0xAA, 0x30, 0x39,
+    0x94, 0xFC, 0xA1, 0xEA, 0xE9, 0x0D, 0xA1, 0xDA, 0x0E, 0x09, 0xD9, 0x1F, 0xC9, 0x19, 0xFC, 0xA1,
+    0xDA, 0x0A, 0xDA, 0x9D, 0x2A, 0xD9, 0xDA, 0x09, 0xE0, 0xFE, 0x91, 0x9A, 0xDA, 0x10, 0x39, 0x94,
+    0xFC, 0x91, 0xFE, 0x09, 0xD9, 0x1D, 0xA9, 0xD9, 0x1E, 0x9D, 0xA0, 0x9E, 0x0F, 0xF1, 0xAC, 0xA0,
+    0xDA, 0x49, 0xD9, 0x09, 0x99, 0xAE, 0x1A, 0xFC, 0x91, 0x9D, 0xAA, 0x20, 0x29, 0xA9, 0x5A, 0xC9,
+    0x5A, 0xC9, 0x3F, 0xE1, 0xFE, 0x3A, 0xC9, 0x5A, 0xC9, 0x59, 0xA9, 0x20, 0x0F, 0xE1, 0xFE, 0x00,
+    0x09, 0x99, 0x99, 0x99, 0x1F, 0xE1, 0x99, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99, 0x91, 0xFE, 0x19,
+    0x99, 0x99, 0x99, 0x00, 0x19, 0xAA, 0x1D, 0x90, 0xAD, 0x1D, 0x91, 0xD1, 0x9D, 0x19, 0xD1, 0x9D,
+    0x19, 0xD1, 0x9D, 0x2D, 0x2D, 0xA1, 0x9D, 0x2D, 0x92, 0x99, 0x9A, 0x92, 0xD2, 0xAC, 0xA1, 0x9D,
+    0x2D, 0x2D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD1, 0x9D, 0x1D, 0x90, 0x9D, 0x19, 0x92,
+    0x1A, 0xF9, 0x2D, 0xAE, 0x6D, 0xA1, 0x9A, 0xAA, 0xDA, 0x0E, 0xAA, 0xDA, 0x9D, 0x91, 0xDA, 0x9D,
+    0x90, 0x9D, 0xA0, 0xFC, 0xAC, 0xA1, 0x9A, 0x91, 0x90, 0x19, 0xAD, 0xA9, 0x19, 0xFD, 0x90, 0xDA,
+    0x1A, 0xD0, 0xEA, 0xAE, 0x0F, 0xF0, 0xD9, 0x5A, 0xD9, 0x19, 0x91, 0xFD, 0x92, 0x99, 0xA9, 0x90,
+    0x19, 0xAE, 0x92, 0x9F, 0xD9, 0x1D, 0xA1, 0xAD, 0x1D, 0x92, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x91,
+    0x9D, 0x1A, 0xD9, 0x0E, 0x2F, 0xD4, 0x9A, 0xA9, 0x20, 0x9D, 0x2A, 0xCA, 0x1E, 0x09, 0xD9, 0x2D,
+    0xAD, 0xA3, 0x9F, 0x5E, 0xA4, 0xFC, 0x3A, 0xD0, 0xAD, 0x19, 0xD9, 0x1D, 0xA0, 0x99, 0x93, 0x99,
+    0x00, 0x09, 0xAE, 0xA2, 0xFE, 0x6D, 0xA0, 0x99, 0x99, 0x9A, 0xD9, 0xFF, 0x0D, 0x91, 0xE0, 0xDA,
+    0x09, 0xD9, 0x09, 0xFC, 0xA3, 0x9A, 0x92, 0xDA, 0x5D, 0xA5, 0xDA, 0x5D, 0xAA, 0xE1, 0xFF, 0x0E,
+    0x19, 0xD9, 0xE2, 0xD9, 0xDA, 0x2D, 0x9D, 0xA2, 0xD9, 0xDA, 0x2D, 0x9D, 0xA2, 0xD9, 0x99, 0x92,
+    0x99, 0x00, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA2, 0xD9, 0x0A, 0xCA, 0x1D, 0xA1, 0xAC,
+    0xA0, 0xDA, 0x2A, 0xCA, 0xDA, 0x3A, 0xFC, 0x3A, 0xD9, 0xDA, 0x2A, 0xCA, 0x1D, 0xA1, 0xAC, 0xA1,
+    0x9D, 0x90, 0x99, 0x92, 0x99, 0x90, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
+    0xDA, 0x99, 0x90, 0xAC, 0x0A, 0xDA, 0x09, 0xE9, 0x0F, 0xFF, 0xC9, 0xE1, 0xAD, 0xA1, 0xDA, 0xDA,
+    0x19, 0xD2, 0xDA, 0xDA, 0x19, 0xD2, 0xDA, 0xDA, 0x19, 0xD2, 0xDA, 0xDA, 0x19, 0xD2, 0xDA, 0xDA,
+    0x19, 0xD2, 0xDA, 0x99, 0x92, 0x99, 0x29, 0x99, 0xAC, 0x0A, 0xE9, 0x0F, 0xF0, 0xE1, 0x9D, 0x9E,
+    0x2D, 0x9D, 0xA2, 0xD9, 0xDA, 0x2D, 0x9D, 0xA2, 0xD9, 0xDA, 0x2D, 0x99, 0x99, 0x29, 0x90, 0xAC,
+    0x99, 0xDA, 0x1F, 0xF0, 0xE1, 0x9D, 0x9D, 0xA2, 0xD9, 0xDA, 0x2D, 0x9E, 0x2D, 0x9E, 0xA9, 0xE0,
+    0xFE, 0x90, 0xDA, 0x09, 0xA2, 0xDA, 0x5D, 0xA5, 0xDA, 0x50, 0x1A, 0xEA, 0x1E, 0xAD, 0x09, 0xD9,
+    0x4F, 0x93, 0xAF, 0x49, 0xD9, 0x0A, 0x91, 0xD9, 0x9F, 0xD1, 0x99, 0xAA, 0x91, 0x19, 0xA4, 0xD3,
+    0xAF, 0x9A, 0xFC, 0x90, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x99, 0x2F, 0xA2, 0x9A, 0x90,
+    0x77, 0x09, 0xFC, 0xA5, 0xAF, 0xE4, 0xAF, 0xEA, 0x4F, 0x70, 0x9E, 0x97, 0x09, 0xE2, 0x99, 0x99,
+    0x99, 0x99, 0xE1, 0xAF, 0xDA, 0x9E, 0x1A, 0xFD, 0xA9, 0xE9, 0x0A, 0xE9, 0x99, 0x90, 0xEA, 0x0A,
+    0xE4, 0xAF, 0xFE, 0x91, 0xFF, 0xE9, 0x29, 0xFF, 0xC9, 0x5A, 0xE7, 0x1A, 0xE7, 0x1A, 0xFD, 0xA5,
+    0xAF, 0xDA, 0x5A, 0xFD, 0xA0, 0x7D, 0x1C, 0xA7, 0x0D, 0x09, 0xC9, 0x59, 0xFE, 0xA4, 0xFF, 0xD9,
+    0x2F, 0xFE, 0x2F, 0xAD, 0x09, 0xCA, 0xA1, 0x9E, 0xA0, 0xD0, 0x9C, 0x92, 0xF1, 0xCA, 0x0A, 0xC3,
+    0xF0, 0x9C, 0x90, 0xD3, 0xEA, 0x0A, 0xC1, 0xCA, 0x3E, 0xA0, 0xD0, 0x9C, 0xA3, 0xEA, 0x0C, 0xA0,
+    0x9C, 0x93, 0xF9, 0xCA, 0x0A, 0xC4, 0xAF, 0xC9, 0x0D, 0x49, 0xFC, 0x1C, 0xA5, 0xAF, 0xCA, 0xFA,
+    0x3A, 0xFF, 0xCA, 0x4A, 0xFF, 0xA4, 0x9C, 0x99, 0xD9, 0x96, 0xAC, 0x1C, 0xA7, 0x09, 0x91, 0x95,
+    0x77, 0x29, 0xFD, 0xA4, 0xFF, 0xCA, 0x2F, 0xFD, 0x2A, 0xF3, 0x9A, 0x2F, 0x70, 0xAE, 0x97, 0x0F,
+    0x71, 0xF1, 0xAC, 0xA0, 0xDA, 0x0E, 0xA1, 0xEA, 0xD9, 0x0E, 0xA1, 0xFD, 0x90, 0xEA, 0x1F, 0x92,
+    0xF1, 0xEA, 0x3A, 0xE1, 0xEA, 0x39, 0xEA, 0x0E, 0xA4, 0xF9, 0xEA, 0x09, 0x29, 0xFF, 0xD3, 0xAF,
+    0xFC, 0x49, 0xFE, 0xA7, 0x60, 0x1A, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xE1, 0xF9, 0x99, 0x99, 0x92,
+    0xF7, 0x0F, 0x70, 0xF7, 0x0F, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xDA, 0x1F, 0xFD, 0xA1, 0xF9, 0x99,
+    0x99, 0x92, 0xF7, 0x9F, 0x99, 0x99, 0x2A, 0xFF, 0xC2, 0x9F, 0xFA, 0x4F, 0x70, 0xF7, 0x0F, 0x60,
+    0x77, 0x09, 0xFC, 0xA9, 0x3A, 0xFF, 0x29, 0xFF, 0xA2, 0xAE, 0x92, 0x93, 0xF7, 0x0F, 0x6A, 0xAF,
+    0xAA, 0xAA, 0x2F, 0xFD, 0x91, 0xAA, 0xFA, 0xAA, 0xA4, 0xF6, 0xFF, 0xD9, 0x1F, 0xFD, 0x93, 0xF7,
+    0x0E, 0x96, 0x9E, 0xA7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x75, 0xAA, 0x97, 0x71, 0x9D, 0x77, 0x2D,
+    0xA6, 0xAA, 0xA1, 0xAE, 0xA0, 0x9F, 0xCA, 0x92, 0xE9, 0xFF, 0xFE, 0xA1, 0xFF, 0xFF, 0xF1, 0xFC,
+    0x1A, 0xFC, 0x91, 0xF9, 0x0F, 0x3F, 0xA2, 0x9E, 0xA0, 0xF3, 0xAE, 0x93, 0xEA, 0x0E, 0xA3, 0xAE,
+    0x4E, 0xA0, 0xEA, 0x3A, 0xE4, 0xEA, 0x0E, 0xA3, 0xF4, 0xEA, 0x0E, 0xA2, 0xAF, 0x4E, 0xA0, 0xEA,
+    0x2F, 0xC4, 0xEA, 0x0E, 0xA1, 0x9F, 0xC4, 0xEA, 0x0E, 0xA1, 0xFD, 0x4E, 0xA0, 0xEA, 0x09, 0xFD,
+    0x4E, 0xA5, 0xDA, 0x77, 0x19, 0xD7, 0x72, 0xAC, 0xA7, 0x50, 0x09, 0xEA, 0x3D, 0xA2, 0x9F, 0x3D,
+    0xA2, 0x9F, 0x92, 0xDA, 0x29, 0xFA, 0x2D, 0xA2, 0x9D, 0xAD, 0x2D, 0xA2, 0x9D, 0x9D, 0x91, 0xDA,
+    0x1A, 0xFE, 0xAA, 0xEA, 0x0F, 0xFF, 0xD1, 0x9D, 0xA9, 0xD9, 0x9D, 0xA2, 0x9D, 0x90, 0xD9, 0x0D,
+    0xA1, 0xFF, 0xFD, 0x0A, 0xFF, 0xFC, 0x19, 0xD9, 0x1D, 0x9D, 0xA2, 0x9D, 0x91, 0xAC, 0xAD, 0xA2,
+    0x9D, 0x91, 0x9F, 0xA2, 0x9D, 0x92, 0xFA, 0x29, 0xD9, 0x2F, 0xA2, 0x9D, 0x92, 0x9E, 0xA1, 0x0F,
+    0xDA, 0x97, 0x4F, 0xFC, 0x97, 0x2F, 0xFD, 0x97, 0x1E, 0xA0, 0x9F, 0xC7, 0x1E, 0xA2, 0xF7, 0x1E,
+    0xA2, 0xAE, 0x19, 0xD4, 0xEA, 0x2A, 0xE1, 0xAD, 0x4E, 0xA2, 0xF1, 0xE9, 0x99, 0x1E, 0xA9, 0xAF,
+    0xA9, 0xFE, 0x1F, 0xFD, 0x0F, 0xF1, 0xFF, 0xC1, 0x9A, 0xE9, 0x99, 0x1F, 0xAA, 0x94, 0x9E, 0x4E,
+    0xA7, 0x9E, 0x4E, 0xA7, 0x9E, 0x4E, 0xA7, 0x9E, 0x4E, 0xA7, 0x9F, 0xAA, 0x90, 0xEA, 0x70, 0xFD,
+    0x90, 0xEA, 0x71, 0xFC, 0x77, 0x50, 0x0F, 0xDA, 0x97, 0x5F, 0xFC, 0x74, 0xFF, 0xCA, 0x73, 0xEA,
+    0x99, 0xF7, 0x3E, 0x91, 0x9E, 0x29, 0xAE, 0xA2, 0xE9, 0x19, 0xE1, 0xAF, 0xE1, 0xE9, 0x19, 0xE0,
+    0x9F, 0xEA, 0x1E, 0x91, 0xF0, 0xAE, 0x29, 0x2F, 0xFC, 0x90, 0xAE, 0x6F, 0xF9, 0x19, 0xF9, 0x4F,
+    0xF3, 0xAF, 0xC9, 0x2E, 0xA9, 0xE9, 0x3A, 0xFC, 0x91, 0xE9, 0x0F, 0x5A, 0xF1, 0xE9, 0x0A, 0xE9,
+    0x5A, 0xE1, 0xE9, 0x1E, 0xA5, 0x9E, 0x1E, 0x91, 0xAE, 0x0A, 0xCA, 0x99, 0xF1, 0xE9, 0x2E, 0xAA,
+    0xFE, 0x91, 0xE9, 0x2F, 0x9F, 0xD9, 0x77, 0x70, 0x9D, 0x92, 0x9E, 0x3D, 0xA0, 0x9D, 0xA2, 0xAE,
+    0x3D, 0xA1, 0xE2, 0xF2, 0x9D, 0xA1, 0xE2, 0xF9, 0x19, 0xD9, 0x1E, 0x2D, 0xAC, 0xA1, 0xAD, 0x2A,
+    0xD1, 0x9D, 0xAC, 0xA1, 0xAD, 0x2A, 0xD9, 0x09, 0xD9, 0xD1, 0xE2, 0x9D, 0x90, 0xAC, 0xA0, 0xD1,
+    0xDA, 0x1A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x2E, 0x0D, 0x90, 0xDA, 0x9D, 0x93, 0xAD, 0x9D,
+    0x1A, 0xCA, 0xAD, 0x4A, 0xD9, 0xD1, 0xAD, 0xAD, 0x49, 0xDA, 0xD1, 0x9F, 0xA5, 0xFA, 0x2F, 0xA5,
+    0xF9, 0x2F, 0x95, 0xF9, 0x2F, 0x6A, 0xE3, 0xAE, 0x30, 0xAF, 0xFA, 0x93, 0x9D, 0xAF, 0xFE, 0xA2,
+    0x9F, 0xFF, 0xEA, 0x19, 0xFD, 0x94, 0xAE, 0x19, 0xFD, 0x91, 0x99, 0x1E, 0x90, 0x9F, 0xD9, 0x0A,
+    0xDA, 0x0A, 0xDA, 0x09, 0xFD, 0x90, 0xAD, 0xA0, 0xAD, 0xA0, 0x9F, 0xD9, 0x0A, 0xDA, 0x0A, 0xDA,
+    0x09, 0xFD, 0x90, 0xAD, 0xA0, 0xAD, 0xA0, 0x9F, 0xD9, 0x0A, 0xDA, 0x0A, 0xDA, 0x09, 0xFD, 0x90,
+    0xAD, 0xA0, 0xAD, 0xA0, 0x9F, 0xD9, 0x0A, 0xDA, 0x0A, 0xDA, 0x09, 0xFD, 0x90, 0xAD, 0xA0, 0xAD,
+    0xA0, 0xAF, 0xD9, 0x0A, 0xDA, 0x09, 0x99, 0x90, 0xEA, 0xE9, 0x0A, 0xDA, 0x49, 0xE9, 0xE9, 0x0A,
+    0xEA, 0xAA, 0xAF, 0xC0, 0xE9, 0x0A, 0xFF, 0xE1, 0xE9, 0x0A, 0xFF, 0xC9, 0x20, 0x70, 0xF7, 0x2F,
+    0x6A, 0xFF, 0xC4, 0xAF, 0xFC, 0x49, 0x99, 0x9F, 0x99, 0x70, 0xF4, 0xFA, 0x0A, 0xE2, 0x9F, 0xEA,
+    0xE2, 0xFF, 0xF1, 0x9F, 0x91, 0xAF, 0x1A, 0xEA, 0x3F, 0x1F, 0x93, 0xAE, 0x1F, 0x93, 0xAE, 0x1F,
+    0x93, 0xAE, 0x1A, 0xEA, 0x3F, 0x19, 0xF2, 0x9F, 0x2F, 0xFF, 0x29, 0xFD, 0xAF, 0x39, 0xFA, 0x09,
+    0xE7, 0x77, 0x71, 0xFF, 0xD4, 0xFF, 0xD2, 0x59, 0xAF, 0xA6, 0xAF, 0xF4, 0xFF, 0xC9, 0x3A, 0xF9,
+    0x19, 0xA4, 0xF7, 0x19, 0xE9, 0x70, 0xAF, 0xAA, 0xAA, 0xA4, 0xFF, 0xD4, 0xAF, 0xAA, 0xAA, 0xA5,
+    0xF7, 0x1F, 0xFC, 0x94, 0xFF, 0xC9, 0x5A, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0xA3, 0x95, 0xFF, 0xC9,
+    0x49, 0xFF, 0x96, 0xAF, 0xD9, 0x77, 0x1E, 0x93, 0xAE, 0x2E, 0xA2, 0x9E, 0x92, 0xEA, 0x2F, 0x3E,
+    0xA1, 0xAE, 0x4E, 0xA1, 0xEA, 0x4E, 0xA0, 0xAE, 0x5E, 0xA9, 0xE9, 0x5E, 0xAE, 0xA4, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC1, 0x9A, 0xFF, 0xA9, 0x93, 0xEA, 0x0E, 0xA5, 0xEA, 0x0A, 0xE5, 0xEA, 0x1E, 0xA4,
+    0xEA, 0x1A, 0xE9, 0x3E, 0xA2, 0xF3, 0xEA, 0x2A, 0xE9, 0x2E, 0xA3, 0xF0, 0x9F, 0xFF, 0xAA, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xC0, 0x99, 0x99, 0xF9, 0x99, 0x95, 0xAE, 0x09, 0x96, 0xAE, 0xAD, 0x6A, 0xFC,
+    0x96, 0xAE, 0xA7, 0x0F, 0x7A, 0xFC, 0x0D, 0x3A, 0xFF, 0xA4, 0xA0, 0xAF, 0x97, 0xF7, 0x0A, 0xF6,
+    0x9F, 0xD6, 0x9C, 0x9A, 0xE7, 0x1A, 0xE7, 0x1A, 0xE4, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x75, 0x9F,
+    0xFE, 0x75, 0xFF, 0xF7, 0x49, 0x94, 0x9F, 0xC7, 0x59, 0xAA, 0xA2, 0xF9, 0x74, 0xAE, 0x29, 0xEA,
+    0x74, 0xEA, 0x3E, 0xA7, 0x4E, 0x93, 0xF7, 0x39, 0xE4, 0xF7, 0x3A, 0xE4, 0xEA, 0x29, 0xAA, 0x94,
+    0xF3, 0x9E, 0xA1, 0xFD, 0x92, 0xEA, 0x3A, 0xE1, 0xFF, 0x2E, 0x93, 0xF0, 0xAD, 0xA1, 0xAD, 0x90,
+    0x9E, 0x3F, 0x90, 0xE2, 0x9D, 0x90, 0xAE, 0x1A, 0xFA, 0x1E, 0x2A, 0xD9, 0x0F, 0xFD, 0xA1, 0x9E,
+    0x90, 0x9E, 0x1F, 0xFC, 0x92, 0xAF, 0xFA, 0x09, 0xFD, 0xA9, 0x4E, 0xAF, 0x97, 0x7E, 0x77, 0x49,
+    0xE7, 0x74, 0x9D, 0xA7, 0x74, 0xAD, 0x97, 0x74, 0xE7, 0x75, 0xE7, 0x00, 0x77, 0x39, 0xFA, 0x69,
+    0xFE, 0x5F, 0xF9, 0x4E, 0x90, 0xAD, 0xA3, 0x9E, 0x90, 0x9D, 0xA3, 0x9E, 0x90, 0xAD, 0xA4, 0xEA,
+    0x0A, 0xDA, 0x4F, 0x0E, 0x59, 0xFE, 0x6F, 0xD7, 0x9F, 0xA4, 0x92, 0xF9, 0x4D, 0x1F, 0xA3, 0xAD,
+    0x9A, 0xFC, 0x3F, 0xFD, 0xA1, 0xAF, 0xD0, 0xF1, 0xD9, 0x9D, 0x90, 0x9E, 0x9A, 0xD1, 0xCA, 0x2E,
+    0xA7, 0x1F, 0x71, 0xF7, 0x1F, 0x69, 0xFC, 0xA6, 0xAF, 0xC7, 0x9E, 0xA1, 0x09, 0xFD, 0xA9, 0x59,
+    0xFF, 0xC9, 0x39, 0xFF, 0xD3, 0x9E, 0x91, 0xAE, 0xA1, 0xFF, 0xFD, 0x0A, 0xFF, 0xFC, 0x19, 0xE9,
+    0x2A, 0xE1, 0x9A, 0xEA, 0xAA, 0xAF, 0xA0, 0xFF, 0xFD, 0x19, 0xE9, 0x1A, 0xEA, 0x29, 0xEA, 0xAA,
+    0xF3, 0x9F, 0xFC, 0x93, 0x9F, 0xEA, 0x59, 0xE9, 0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x97,
+    0x19, 0xE9, 0x70, 0x69, 0xD7, 0x29, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE, 0x92, 0xFC, 0xAD, 0x19,
+    0xC2, 0xAF, 0x09, 0xD6, 0xF9, 0x09, 0xD5, 0x9F, 0x19, 0xD5, 0x9E, 0xA1, 0x9D, 0x5A, 0xE9, 0x19,
+    0xFE, 0x0A, 0xE9, 0x19, 0xFE, 0x09, 0xE9, 0x19, 0xFE, 0x09, 0xEA, 0x19, 0xD0, 0xAE, 0x1F, 0x19,
+    0xD0, 0xAE, 0x1F, 0xA0, 0x9D, 0x0A, 0xE1, 0x9F, 0xA9, 0xD0, 0xAE, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE,
+    0x49, 0xFF, 0xA9, 0x79, 0xD7, 0x49, 0xD5, 0x5F, 0x97, 0x29, 0xFA, 0x72, 0xFD, 0x72, 0xFD, 0x97,
+    0x09, 0xEA, 0xDA, 0x70, 0xEA, 0x9E, 0x70, 0xEA, 0x9E, 0x93, 0xFF, 0xFF, 0x0A, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xA3, 0xE9, 0x2E, 0x92, 0x9A, 0xAE, 0xAA, 0xAA, 0xFA, 0xA0, 0xFF, 0xFF, 0x19, 0xEA, 0x99,
+    0x99, 0x9E, 0xA9, 0x19, 0xE5, 0xEA, 0x2F, 0x5A, 0xE2, 0xEA, 0x59, 0xE9, 0x09, 0xE9, 0x6E, 0xA0,
+    0xF7, 0xAE, 0x00, 0x77, 0x1A, 0xFD, 0x94, 0x9F, 0xFC, 0xA4, 0xFF, 0xD9, 0x3A, 0xC9, 0x29, 0xF7,
+    0x2F, 0x72, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xA0, 0xFF, 0xFD, 0x39, 0xFE, 0x95, 0xFD, 0xA4,
+    0xFF, 0xFD, 0x0A, 0xFF, 0xFC, 0x1A, 0xE7, 0x2A, 0xE7, 0x2A, 0xEA, 0x39, 0xAA, 0x3F, 0xFE, 0x3A,
+    0xFF, 0xD4, 0x9F, 0xEA, 0x97, 0x70, 0x69, 0xD7, 0x1A, 0xFD, 0x94, 0x9F, 0xFD, 0x29, 0xFF, 0xDA,
+    0x2F, 0xA9, 0xD9, 0xAC, 0x2A, 0xEA, 0x09, 0xD5, 0xF1, 0x9D, 0x49, 0xEA, 0x19, 0xD4, 0x9E, 0x91,
+    0x9D, 0x4A, 0xE9, 0x19, 0xD4, 0xAE, 0x91, 0x9D, 0x49, 0xE9, 0x19, 0xD4, 0x9E, 0xA1, 0x9D, 0x5F,
+    0x19, 0xD5, 0xF9, 0x09, 0xD5, 0x9F, 0xA9, 0xD0, 0x9A, 0x92, 0xFF, 0xE9, 0x3F, 0xFD, 0x94, 0x9F,
+    0xEA, 0x70, 0x9D, 0x73, 0x9D, 0x40, 0x3A, 0xA3, 0x9A, 0x96, 0xAD, 0x3D, 0xA6, 0xE2, 0xAD, 0xA5,
+    0xAE, 0xAA, 0xAF, 0xAA, 0xA9, 0x0F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x1A, 0xE1, 0x9E, 0xA5, 0xAE,
+    0x2E, 0xA5, 0xAE, 0x2E, 0xA5, 0xAE, 0x2E, 0xA5, 0xAE, 0x2E, 0xA5, 0xAE, 0x2E, 0xA5, 0xAE, 0x2E,
+    0xA5, 0xAE, 0x2F, 0x5A, 0xE2, 0xFC, 0xAC, 0xA1, 0xAE, 0x29, 0xFD, 0xA1, 0xAE, 0x3A, 0xFC, 0x97,
+    0x70, 0x77, 0x71, 0x9F, 0xD9, 0x70, 0xAF, 0xFC, 0x6A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xC7, 0xEA,
+    0x75, 0xEA, 0x75, 0xFA, 0x74, 0x9F, 0xCA, 0x73, 0xAF, 0xD9, 0x72, 0x9F, 0xDA, 0x73, 0x9F, 0xCA,
+    0x74, 0xAF, 0x1A, 0xA9, 0x0A, 0xCA, 0x09, 0xCA, 0x09, 0xE0, 0x9F, 0xFF, 0x0E, 0x99, 0xC9, 0xD1,
+    0xD1, 0xD0, 0xE1, 0xF1, 0xD1, 0xDA, 0xDA, 0x2A, 0xFD, 0xAA, 0xFC, 0x4D, 0xAF, 0xF9, 0x5C, 0xA1,
+    0xD1, 0xD7, 0xCA, 0x1D, 0x1D, 0x40, 0x9F, 0xFF, 0xA9, 0xFF, 0xFC, 0x9F, 0xFF, 0xC0, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x97, 0x59, 0xFF, 0xFA, 0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x09, 0x99, 0x9F,
+    0x99, 0x99, 0x94, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF4,
+    0x9F, 0xFE, 0x9F, 0xFE, 0x3A, 0xE9, 0x7F, 0x29, 0xFF, 0xDA, 0x9F, 0xFE, 0x4A, 0xE6, 0x9E, 0xA2,
+    0x9A, 0xAF, 0xC3, 0x9F, 0xCA, 0x5F, 0x7A, 0xE9, 0x7F, 0x79, 0xEA, 0x7F, 0x96, 0x9F, 0x7A, 0xEA,
+    0x7F, 0x91, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE0, 0x9A, 0xC5, 0x9F, 0xE5, 0xAF, 0xCA, 0x4F, 0xD9,
+    0x6F, 0xD9, 0xAD, 0x39, 0x09, 0xFE, 0x49, 0xFC, 0xA9, 0x4F, 0xD3, 0xAD, 0xAC, 0xAA, 0xE3, 0xEA,
+    0x19, 0xE3, 0xE9, 0x19, 0xE3, 0xE9, 0x19, 0xE2, 0xF2, 0x9E, 0x1A, 0xE9, 0x29, 0xFF, 0xA3, 0x9F,
+    0xEA, 0x49, 0xFC, 0xA9, 0x77, 0x10, 0x77, 0x49, 0xF7, 0x6C, 0xA0, 0xAD, 0x74, 0xAC, 0x2D, 0x97,
+    0x3A, 0xC9, 0x1D, 0xA7, 0x3A, 0xFF, 0xFE, 0xA3, 0xFF, 0xFF, 0xC9, 0x19, 0xFF, 0xFF, 0xC3, 0x99,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA4, 0xDA, 0x19, 0x6D, 0x4D, 0xA0, 0xAC, 0xA0, 0xD2, 0xD4,
+    0xFF, 0xE0, 0x9C, 0xA4, 0xAE, 0x90, 0xDA, 0xAF, 0x5E, 0x29, 0xA1, 0x9A, 0xA5, 0xFA, 0x75, 0xAC,
+    0x9E, 0xA9, 0x39, 0x72, 0xFF, 0xC7, 0x29, 0xFF, 0x74, 0xAF, 0xD7, 0x77, 0x7A, 0xDA, 0x77, 0xEA,
+    0x77, 0xEA, 0x77, 0xEA, 0x77, 0xEA, 0x74, 0xAF, 0xFA, 0x96, 0xAF, 0xFF, 0xA4, 0xFF, 0xFF, 0x2A,
+    0xF9, 0x0E, 0xA0, 0x9F, 0xA1, 0xF2, 0xEA, 0x2F, 0x09, 0xE9, 0x2E, 0xA2, 0x9E, 0x9A, 0xE3, 0xEA,
+    0x3E, 0x9A, 0xE3, 0xEA, 0x3E, 0xAA, 0xE3, 0xAD, 0x93, 0xEA, 0xAE, 0x73, 0xEA, 0xAE, 0x73, 0xEA,
+    0xAE, 0x73, 0xEA, 0xAE, 0x73, 0xEA, 0x1A, 0xFE, 0xA9, 0x4F, 0xFE, 0x3F, 0xFF, 0x2F, 0x99, 0x9A,
+    0xF9, 0x1F, 0x39, 0xEA, 0x1F, 0x39, 0xEA, 0x1F, 0x39, 0xE9, 0x1F, 0x90, 0x9A, 0xF0, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFA, 0x1A, 0xFF, 0xCA, 0x94, 0xF7, 0x2F, 0x70, 0xFF, 0xD4, 0xFF, 0xD5, 0x9F, 0x99,
+    0x99, 0x6F, 0x72, 0xF7, 0x00, 0x69, 0x19, 0x74, 0xAC, 0x99, 0xCA, 0x73, 0xFC, 0xA7, 0x1A, 0xFF,
+    0xA5, 0x9F, 0xFF, 0x4F, 0xD9, 0x9F, 0xD2, 0xAE, 0x9A, 0xC9, 0x9C, 0xAA, 0xE9, 0x1F, 0x0A, 0xC9,
+    0x9C, 0xA0, 0xF0, 0x9E, 0xA0, 0xAC, 0x99, 0xCA, 0x0A, 0xE0, 0xAE, 0x90, 0xAC, 0x99, 0xCA, 0x0A,
+    0xE9, 0xAE, 0x90, 0xAC, 0x99, 0xCA, 0x09, 0xE9, 0xAE, 0x91, 0x91, 0x92, 0x99, 0x90, 0x9E, 0x97,
+    0x5F, 0x75, 0xAE, 0x76, 0xF7, 0x6F, 0xA7, 0x29, 0xFF, 0xFD, 0x91, 0xAF, 0xFF, 0xD9, 0x1A, 0xFF,
+    0xFD, 0x90, 0x29, 0x19, 0x96, 0xCA, 0x0D, 0x6C, 0xA0, 0xD3, 0xAF, 0xE9, 0x2F, 0xFC, 0xA1, 0xFF,
+    0xDA, 0x0F, 0x99, 0xAF, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x0F, 0xFD, 0x90, 0xFF, 0xC9, 0x1F,
+    0xFD, 0x90, 0xF1, 0x9F, 0x0F, 0x2A, 0xE9, 0xF2, 0x9E, 0x9F, 0x2A, 0xE9, 0xF1, 0x9F, 0x9F, 0xFE,
+    0x0F, 0xFD, 0x1F, 0xF9, 0x5C, 0xA0, 0xD6, 0xCA, 0x0D, 0x69, 0x19, 0x93, 0x3A, 0xFA, 0x3A, 0xFF,
+    0x1A, 0xFF, 0x91, 0xF9, 0x19, 0xA1, 0xAE, 0x96, 0xF7, 0xF7, 0xF7, 0xF7, 0xAE, 0x96, 0x9F, 0x39,
+    0x91, 0xFF, 0xCA, 0x2F, 0xFA, 0x3A, 0xFD, 0x97, 0x77, 0x0F, 0xFE, 0x0F, 0xFE, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x00, 0x74, 0xFF, 0xF9, 0xFF, 0xF9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x72, 0xC7, 0x74, 0xE7, 0x72, 0xFC, 0x77, 0x0F, 0xE7, 0x6F, 0xFC, 0x74, 0xD9, 0x4A, 0xD7, 0x2D,
+    0xA6, 0xAD, 0x70, 0xF0, 0x9A, 0xC9, 0x19, 0xE6, 0xFF, 0xD1, 0x9F, 0x4F, 0xFD, 0xA1, 0x9F, 0xC2,
+    0xFF, 0xDA, 0x2F, 0xE0, 0xAF, 0xFC, 0xA2, 0xFF, 0xA0, 0xFF, 0xC2, 0xFF, 0xC2, 0xFE, 0xA1, 0xAF,
+    0xF4, 0xFE, 0x99, 0xFF, 0x6F, 0xFF, 0xE7, 0x0F, 0xC9, 0x9F, 0xD7, 0x2E, 0x91, 0x9F, 0x74, 0xD9,
+    0x19, 0xE7, 0x6D, 0xAA, 0xE7, 0x70, 0xFC, 0x77, 0x2E, 0x77, 0x4A, 0x72,
 };
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 5, 19, 7, 1, 18, 24, 0 }, // !
-    { 10, 7, 12, 1, 18, 18, 24 }, // "
-    { 16, 18, 17, 0, 18, 72, 42 }, // #
-    { 13, 21, 15, 1, 19, 69, 114 }, // $
-    { 22, 20, 23, 0, 19, 110, 183 }, // %
-    { 18, 20, 20, 1, 19, 90, 293 }, // &
-    { 5, 7, 7, 1, 18, 9, 383 }, // '
-    { 7, 22, 9, 1, 18, 39, 392 }, // (
-    { 8, 22, 9, 0, 18, 44, 431 }, // )
-    { 13, 12, 14, 0, 19, 39, 475 }, // *
-    { 13, 13, 15, 1, 15, 43, 514 }, // +
-    { 6, 7, 7, 0, 3, 11, 557 }, // ,
-    { 8, 4, 9, 0, 9, 8, 568 }, // -
-    { 5, 5, 7, 1, 4, 7, 576 }, // .
-    { 11, 19, 12, 0, 18, 53, 583 }, // /
-    { 14, 20, 15, 0, 19, 70, 636 }, // 0
-    { 10, 18, 14, 1, 18, 45, 706 }, // 1
-    { 14, 19, 15, 0, 19, 67, 751 }, // 2
-    { 14, 20, 15, 0, 19, 70, 818 }, // 3
-    { 14, 18, 15, 0, 18, 63, 888 }, // 4
-    { 13, 19, 15, 1, 18, 62, 951 }, // 5
-    { 14, 20, 15, 0, 19, 70, 1013 }, // 6
-    { 14, 18, 15, 0, 18, 63, 1083 }, // 7
-    { 14, 20, 15, 0, 19, 70, 1146 }, // 8
-    { 14, 20, 15, 0, 19, 70, 1216 }, // 9
-    { 5, 15, 7, 1, 14, 19, 1286 }, // :
-    { 6, 18, 7, 0, 14, 27, 1305 }, // ;
-    { 13, 14, 15, 1, 16, 46, 1332 }, // <
-    { 13, 8, 15, 1, 13, 26, 1378 }, // =
-    { 13, 14, 15, 1, 16, 46, 1404 }, // >
-    { 12, 20, 13, 0, 19, 60, 1450 }, // ?
-    { 21, 20, 23, 1, 18, 105, 1510 }, // @
-    { 18, 18, 19, 0, 18, 81, 1615 }, // A
-    { 14, 18, 17, 2, 18, 63, 1696 }, // B
-    { 15, 20, 17, 1, 19, 75, 1759 }, // C
-    { 15, 18, 18, 2, 18, 68, 1834 }, // D
-    { 11, 18, 14, 2, 18, 50, 1902 }, // E
-    { 11, 18, 14, 2, 18, 50, 1952 }, // F
-    { 16, 20, 18, 1, 19, 80, 2002 }, // G
-    { 15, 18, 19, 2, 18, 68, 2082 }, // H
-    { 9, 18, 10, 0, 18, 41, 2150 }, // I
-    { 9, 24, 8, -2, 18, 54, 2191 }, // J
-    { 15, 18, 18, 2, 18, 68, 2245 }, // K
-    { 12, 18, 15, 2, 18, 54, 2313 }, // L
-    { 20, 18, 24, 2, 18, 90, 2367 }, // M
-    { 17, 18, 20, 2, 18, 77, 2457 }, // N
-    { 18, 20, 20, 1, 19, 90, 2534 }, // O
-    { 13, 18, 16, 2, 18, 59, 2624 }, // P
-    { 18, 24, 20, 1, 19, 108, 2683 }, // Q
-    { 15, 18, 18, 2, 18, 68, 2791 }, // R
-    { 12, 20, 14, 1, 19, 60, 2859 }, // S
-    { 14, 18, 15, 0, 18, 63, 2919 }, // T
-    { 15, 19, 19, 2, 18, 72, 2982 }, // U
-    { 17, 18, 18, 0, 18, 77, 3054 }, // V
-    { 25, 18, 26, 0, 18, 113, 3131 }, // W
-    { 17, 18, 18, 0, 18, 77, 3244 }, // X
-    { 16, 18, 17, 0, 18, 72, 3321 }, // Y
-    { 14, 18, 15, 0, 18, 63, 3393 }, // Z
-    { 7, 22, 9, 1, 18, 39, 3456 }, // [
-    { 11, 19, 12, 0, 18, 53, 3495 }, // <backslash>
-    { 7, 22, 8, 0, 18, 39, 3548 }, // ]
-    { 14, 12, 15, 0, 18, 42, 3587 }, // ^
-    { 12, 2, 12, -1, -2, 6, 3629 }, // _
-    { 8, 5, 10, 1, 20, 10, 3635 }, // `
-    { 13, 15, 15, 1, 14, 49, 3645 }, // a
-    { 14, 20, 16, 1, 19, 70, 3694 }, // b
-    { 12, 15, 14, 1, 14, 45, 3764 }, // c
-    { 13, 20, 16, 1, 19, 65, 3809 }, // d
-    { 13, 15, 15, 1, 14, 49, 3874 }, // e
-    { 11, 20, 12, 0, 20, 55, 3923 }, // f
-    { 13, 20, 16, 1, 14, 65, 3978 }, // g
-    { 14, 19, 16, 1, 19, 67, 4043 }, // h
-    { 5, 20, 7, 1, 20, 25, 4110 }, // i
-    { 8, 26, 7, -2, 20, 52, 4135 }, // j
-    { 15, 19, 17, 1, 19, 72, 4187 }, // k
-    { 5, 19, 7, 1, 19, 24, 4259 }, // l
-    { 22, 14, 24, 1, 14, 77, 4283 }, // m
-    { 14, 14, 16, 1, 14, 49, 4360 }, // n
-    { 14, 15, 16, 1, 14, 53, 4409 }, // o
-    { 14, 20, 16, 1, 14, 70, 4462 }, // p
-    { 13, 20, 16, 1, 14, 65, 4532 }, // q
-    { 10, 14, 12, 1, 14, 35, 4597 }, // r
-    { 11, 15, 13, 1, 14, 42, 4632 }, // s
-    { 11, 18, 12, 0, 17, 50, 4674 }, // t
-    { 14, 15, 16, 1, 14, 53, 4724 }, // u
-    { 15, 14, 16, 0, 14, 53, 4777 }, // v
-    { 22, 14, 23, 0, 14, 77, 4830 }, // w
-    { 15, 14, 16, 0, 14, 53, 4907 }, // x
-    { 15, 20, 16, 0, 14, 75, 4960 }, // y
-    { 12, 14, 13, 0, 14, 42, 5035 }, // z
-    { 9, 22, 10, 0, 18, 50, 5077 }, // {
-    { 4, 25, 14, 5, 19, 25, 5127 }, // |
-    { 9, 22, 11, 1, 18, 50, 5152 }, // }
-    { 13, 5, 15, 1, 11, 17, 5202 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5219 }, //  
-    { 5, 19, 7, 1, 14, 24, 5219 }, // ¡
-    { 12, 20, 14, 1, 19, 60, 5243 }, // ¢
-    { 13, 19, 15, 1, 19, 62, 5303 }, // £
-    { 12, 12, 14, 1, 15, 36, 5365 }, // ¤
-    { 15, 18, 16, 0, 18, 68, 5401 }, // ¥
-    { 4, 25, 14, 5, 19, 25, 5469 }, // ¦
-    { 10, 21, 12, 1, 20, 53, 5494 }, // §
-    { 9, 4, 15, 3, 19, 9, 5547 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5556 }, // ©
-    { 9, 10, 10, 0, 19, 23, 5651 }, // ª
-    { 15, 12, 16, 0, 13, 45, 5674 }, // «
-    { 13, 8, 15, 1, 11, 26, 5719 }, // ¬
-    { 8, 4, 9, 0, 9, 8, 5745 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5753 }, // ®
-    { 14, 3, 14, -1, 22, 11, 5848 }, // ¯
-    { 9, 10, 11, 1, 19, 23, 5859 }, // °
-    { 13, 16, 15, 1, 16, 52, 5882 }, // ±
-    { 9, 12, 10, 0, 22, 27, 5934 }, // ²
-    { 9, 12, 10, 0, 22, 27, 5961 }, // ³
-    { 8, 5, 10, 1, 20, 10, 5988 }, // ´
-    { 14, 20, 16, 1, 14, 70, 5998 }, // µ
-    { 14, 23, 16, 1, 19, 81, 6068 }, // ¶
-    { 5, 5, 7, 1, 11, 7, 6149 }, // ·
-    { 7, 6, 8, 0, 0, 11, 6156 }, // ¸
-    { 7, 12, 10, 0, 22, 21, 6167 }, // ¹
-    { 9, 10, 10, 0, 19, 23, 6188 }, // º
-    { 15, 12, 16, 0, 13, 45, 6211 }, // »
-    { 21, 18, 22, 0, 18, 95, 6256 }, // ¼
-    { 21, 18, 22, 0, 18, 95, 6351 }, // ½
-    { 20, 19, 22, 1, 19, 95, 6446 }, // ¾
-    { 12, 19, 13, 0, 14, 57, 6541 }, // ¿
-    { 18, 24, 19, 0, 24, 108, 6598 }, // À
-    { 18, 24, 19, 0, 24, 108, 6706 }, // Á
-    { 18, 24, 19, 0, 24, 108, 6814 }, // Â
-    { 18, 23, 19, 0, 23, 104, 6922 }, // Ã
-    { 18, 23, 19, 0, 23, 104, 7026 }, // Ä
-    { 18, 22, 19, 0, 22, 99, 7130 }, // Å
-    { 23, 18, 24, 0, 18, 104, 7229 }, // Æ
-    { 15, 25, 17, 1, 19, 94, 7333 }, // Ç
-    { 11, 24, 14, 2, 24, 66, 7427 }, // È
-    { 11, 24, 14, 2, 24, 66, 7493 }, // É
-    { 11, 24, 14, 2, 24, 66, 7559 }, // Ê
-    { 11, 23, 14, 2, 23, 64, 7625 }, // Ë
-    { 9, 24, 10, 0, 24, 54, 7689 }, // Ì
-    { 10, 24, 11, 0, 24, 60, 7743 }, // Í
-    { 11, 24, 11, -1, 24, 66, 7803 }, // Î
-    { 10, 23, 11, 0, 23, 58, 7869 }, // Ï
-    { 17, 18, 18, 0, 18, 77, 7927 }, // Ð
-    { 17, 23, 20, 2, 23, 98, 8004 }, // Ñ
-    { 18, 25, 20, 1, 24, 113, 8102 }, // Ò
-    { 18, 25, 20, 1, 24, 113, 8215 }, // Ó
-    { 18, 25, 20, 1, 24, 113, 8328 }, // Ô
-    { 18, 24, 20, 1, 23, 108, 8441 }, // Õ
-    { 18, 24, 20, 1, 23, 108, 8549 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 8657 }, // ×
-    { 18, 21, 20, 1, 19, 95, 8693 }, // Ø
-    { 15, 25, 19, 2, 24, 94, 8788 }, // Ù
-    { 15, 25, 19, 2, 24, 94, 8882 }, // Ú
-    { 15, 25, 19, 2, 24, 94, 8976 }, // Û
-    { 15, 24, 19, 2, 23, 90, 9070 }, // Ü
-    { 16, 24, 17, 0, 24, 96, 9160 }, // Ý
-    { 13, 18, 16, 2, 18, 59, 9256 }, // Þ
-    { 16, 21, 18, 1, 20, 84, 9315 }, // ß
-    { 13, 21, 15, 1, 20, 69, 9399 }, // à
-    { 13, 21, 15, 1, 20, 69, 9468 }, // á
-    { 13, 21, 15, 1, 20, 69, 9537 }, // â
-    { 13, 20, 15, 1, 19, 65, 9606 }, // ã
-    { 13, 20, 15, 1, 19, 65, 9671 }, // ä
-    { 13, 22, 15, 1, 21, 72, 9736 }, // å
-    { 21, 15, 23, 1, 14, 79, 9808 }, // æ
-    { 12, 20, 14, 1, 14, 60, 9887 }, // ç
-    { 13, 21, 15, 1, 20, 69, 9947 }, // è
-    { 13, 21, 15, 1, 20, 69, 10016 }, // é
-    { 13, 21, 15, 1, 20, 69, 10085 }, // ê
-    { 13, 20, 15, 1, 19, 65, 10154 }, // ë
-    { 9, 20, 9, -1, 20, 45, 10219 }, // ì
-    { 8, 20, 10, 1, 20, 40, 10264 }, // í
-    { 11, 20, 10, -2, 20, 55, 10304 }, // î
-    { 10, 19, 10, -1, 19, 48, 10359 }, // ï
-    { 14, 21, 16, 1, 20, 74, 10407 }, // ð
-    { 14, 19, 16, 1, 19, 67, 10481 }, // ñ
-    { 14, 21, 16, 1, 20, 74, 10548 }, // ò
-    { 14, 21, 16, 1, 20, 74, 10622 }, // ó
-    { 14, 21, 16, 1, 20, 74, 10696 }, // ô
-    { 14, 20, 16, 1, 19, 70, 10770 }, // õ
-    { 14, 20, 16, 1, 19, 70, 10840 }, // ö
-    { 13, 13, 15, 1, 15, 43, 10910 }, // ÷
-    { 14, 16, 16, 1, 15, 56, 10953 }, // ø
-    { 14, 21, 16, 1, 20, 74, 11009 }, // ù
-    { 14, 21, 16, 1, 20, 74, 11083 }, // ú
-    { 14, 21, 16, 1, 20, 74, 11157 }, // û
-    { 14, 20, 16, 1, 19, 70, 11231 }, // ü
-    { 15, 26, 16, 0, 20, 98, 11301 }, // ý
-    { 14, 25, 16, 1, 19, 88, 11399 }, // þ
-    { 15, 25, 16, 0, 19, 94, 11487 }, // ÿ
-    { 18, 22, 19, 0, 22, 99, 11581 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 11680 }, // ā
-    { 18, 24, 19, 0, 24, 108, 11742 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 11850 }, // ă
-    { 18, 24, 19, 0, 18, 108, 11919 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 12027 }, // ą
-    { 15, 25, 17, 1, 24, 94, 12092 }, // Ć
-    { 12, 21, 14, 1, 20, 63, 12186 }, // ć
-    { 15, 25, 17, 1, 24, 94, 12249 }, // Ĉ
-    { 12, 21, 14, 1, 20, 63, 12343 }, // ĉ
-    { 15, 25, 17, 1, 24, 94, 12406 }, // Ċ
-    { 12, 21, 14, 1, 20, 63, 12500 }, // ċ
-    { 15, 25, 17, 1, 24, 94, 12563 }, // Č
-    { 12, 21, 14, 1, 20, 63, 12657 }, // č
-    { 15, 24, 18, 2, 24, 90, 12720 }, // Ď
-    { 19, 20, 21, 1, 19, 95, 12810 }, // ď
-    { 17, 18, 18, 0, 18, 77, 12905 }, // Đ
-    { 15, 20, 17, 1, 19, 75, 12982 }, // đ
-    { 11, 22, 14, 2, 22, 61, 13057 }, // Ē
-    { 13, 19, 15, 1, 18, 62, 13118 }, // ē
-    { 11, 24, 14, 2, 24, 66, 13180 }, // Ĕ
-    { 13, 21, 15, 1, 20, 69, 13246 }, // ĕ
-    { 11, 24, 14, 2, 24, 66, 13315 }, // Ė
-    { 13, 21, 15, 1, 20, 69, 13381 }, // ė
-    { 11, 24, 14, 2, 18, 66, 13450 }, // Ę
-    { 13, 20, 15, 1, 14, 65, 13516 }, // ę
-    { 11, 24, 14, 2, 24, 66, 13581 }, // Ě
-    { 13, 21, 15, 1, 20, 69, 13647 }, // ě
-    { 16, 25, 18, 1, 24, 100, 13716 }, // Ĝ
-    { 13, 26, 16, 1, 20, 85, 13816 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 13901 }, // Ğ
-    { 13, 26, 16, 1, 20, 85, 14001 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 14086 }, // Ġ
-    { 13, 26, 16, 1, 20, 85, 14186 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 14271 }, // Ģ
-    { 13, 26, 16, 1, 20, 85, 14371 }, // ģ
-    { 15, 24, 19, 2, 24, 90, 14456 }, // Ĥ
-    { 17, 25, 16, -2, 25, 107, 14546 }, // ĥ
-    { 20, 18, 21, 0, 18, 90, 14653 }, // Ħ
-    { 15, 19, 16, 0, 19, 72, 14743 }, // ħ
-    { 11, 23, 11, -1, 23, 64, 14815 }, // Ĩ
-    { 11, 19, 10, -2, 19, 53, 14879 }, // ĩ
-    { 9, 22, 10, 0, 22, 50, 14932 }, // Ī
-    { 9, 18, 9, -1, 18, 41, 14982 }, // ī
-    { 10, 24, 11, 0, 24, 60, 15023 }, // Ĭ
-    { 10, 20, 10, -1, 20, 50, 15083 }, // ĭ
-    { 9, 24, 10, 0, 18, 54, 15133 }, // Į
-    { 5, 26, 7, 1, 20, 33, 15187 }, // į
-    { 9, 24, 10, 0, 24, 54, 15220 }, // İ
-    { 5, 14, 7, 1, 14, 18, 15274 }, // ı
-    { 17, 24, 18, 0, 18, 102, 15292 }, // Ĳ
-    { 13, 26, 15, 1, 20, 85, 15394 }, // ĳ
-    { 12, 30, 11, -2, 24, 90, 15479 }, // Ĵ
-    { 11, 26, 10, -2, 20, 72, 15569 }, // ĵ
-    { 15, 24, 18, 2, 18, 90, 15641 }, // Ķ
-    { 15, 25, 17, 1, 19, 94, 15731 }, // ķ
-    { 15, 14, 17, 1, 14, 53, 15825 }, // ĸ
-    { 13, 24, 15, 1, 24, 78, 15878 }, // Ĺ
-    { 8, 25, 10, 1, 25, 50, 15956 }, // ĺ
-    { 12, 24, 15, 2, 18, 72, 16006 }, // Ļ
-    { 5, 25, 7, 1, 19, 32, 16078 }, // ļ
-    { 12, 18, 15, 2, 18, 54, 16110 }, // Ľ
-    { 10, 19, 12, 1, 19, 48, 16164 }, // ľ
-    { 12, 18, 15, 2, 18, 54, 16212 }, // Ŀ
-    { 10, 19, 12, 1, 19, 48, 16266 }, // ŀ
-    { 14, 18, 15, 0, 18, 63, 16314 }, // Ł
-    { 9, 19, 9, -1, 19, 43, 16377 }, // ł
-    { 17, 24, 20, 2, 24, 102, 16420 }, // Ń
-    { 14, 20, 16, 1, 20, 70, 16522 }, // ń
-    { 17, 24, 20, 2, 18, 102, 16592 }, // Ņ
-    { 14, 20, 16, 1, 14, 70, 16694 }, // ņ
-    { 17, 24, 20, 2, 24, 102, 16764 }, // Ň
-    { 14, 20, 16, 1, 20, 70, 16866 }, // ň
-    { 19, 18, 19, -1, 18, 86, 16936 }, // ŉ
-    { 17, 24, 20, 2, 18, 102, 17022 }, // Ŋ
-    { 14, 20, 16, 1, 14, 70, 17124 }, // ŋ
-    { 18, 23, 20, 1, 22, 104, 17194 }, // Ō
-    { 14, 19, 16, 1, 18, 67, 17298 }, // ō
-    { 18, 25, 20, 1, 24, 113, 17365 }, // Ŏ
-    { 14, 21, 16, 1, 20, 74, 17478 }, // ŏ
-    { 18, 25, 20, 1, 24, 113, 17552 }, // Ő
-    { 14, 21, 16, 1, 20, 74, 17665 }, // ő
-    { 22, 20, 24, 1, 19, 110, 17739 }, // Œ
-    { 23, 15, 25, 1, 14, 87, 17849 }, // œ
-    { 15, 24, 18, 2, 24, 90, 17936 }, // Ŕ
-    { 11, 20, 13, 1, 20, 55, 18026 }, // ŕ
-    { 15, 24, 18, 2, 18, 90, 18081 }, // Ŗ
-    { 10, 20, 12, 1, 14, 50, 18171 }, // ŗ
-    { 15, 24, 18, 2, 24, 90, 18221 }, // Ř
-    { 11, 20, 13, 1, 20, 55, 18311 }, // ř
-    { 12, 25, 14, 1, 24, 75, 18366 }, // Ś
-    { 11, 21, 13, 1, 20, 58, 18441 }, // ś
-    { 12, 25, 14, 1, 24, 75, 18499 }, // Ŝ
-    { 11, 21, 13, 1, 20, 58, 18574 }, // ŝ
-    { 12, 25, 14, 1, 19, 75, 18632 }, // Ş
-    { 11, 20, 13, 1, 14, 55, 18707 }, // ş
-    { 12, 25, 14, 1, 24, 75, 18762 }, // Š
-    { 11, 21, 13, 1, 20, 58, 18837 }, // š
-    { 14, 24, 15, 0, 18, 84, 18895 }, // Ţ
-    { 11, 23, 12, 0, 17, 64, 18979 }, // ţ
-    { 14, 24, 15, 0, 24, 84, 19043 }, // Ť
-    { 15, 20, 16, 0, 19, 75, 19127 }, // ť
-    { 14, 18, 15, 0, 18, 63, 19202 }, // Ŧ
-    { 11, 18, 12, 0, 17, 50, 19265 }, // ŧ
-    { 15, 24, 19, 2, 23, 90, 19315 }, // Ũ
-    { 14, 20, 16, 1, 19, 70, 19405 }, // ũ
-    { 15, 23, 19, 2, 22, 87, 19475 }, // Ū
-    { 14, 19, 16, 1, 18, 67, 19562 }, // ū
-    { 15, 25, 19, 2, 24, 94, 19629 }, // Ŭ
-    { 14, 21, 16, 1, 20, 74, 19723 }, // ŭ
-    { 15, 26, 19, 2, 25, 98, 19797 }, // Ů
-    { 14, 22, 16, 1, 21, 77, 19895 }, // ů
-    { 15, 25, 19, 2, 24, 94, 19972 }, // Ű
-    { 14, 21, 16, 1, 20, 74, 20066 }, // ű
-    { 15, 24, 19, 2, 18, 90, 20140 }, // Ų
-    { 14, 20, 16, 1, 14, 70, 20230 }, // ų
-    { 25, 24, 26, 0, 24, 150, 20300 }, // Ŵ
-    { 22, 20, 23, 0, 20, 110, 20450 }, // ŵ
-    { 16, 24, 17, 0, 24, 96, 20560 }, // Ŷ
-    { 15, 26, 16, 0, 20, 98, 20656 }, // ŷ
-    { 16, 23, 17, 0, 23, 92, 20754 }, // Ÿ
-    { 14, 24, 15, 0, 24, 84, 20846 }, // Ź
-    { 12, 20, 13, 0, 20, 60, 20930 }, // ź
-    { 14, 24, 15, 0, 24, 84, 20990 }, // Ż
-    { 12, 20, 13, 0, 20, 60, 21074 }, // ż
-    { 14, 24, 15, 0, 24, 84, 21134 }, // Ž
-    { 12, 20, 13, 0, 20, 60, 21218 }, // ž
-    { 10, 20, 12, 1, 20, 50, 21278 }, // ſ
-    { 21, 20, 23, 1, 19, 105, 21328 }, // Ơ
-    { 17, 17, 19, 1, 16, 73, 21433 }, // ơ
-    { 26, 20, 28, 1, 19, 130, 21506 }, // Ƣ
-    { 21, 20, 23, 1, 14, 105, 21636 }, // ƣ
-    { 18, 18, 19, 0, 18, 81, 21741 }, // Ƥ
-    { 14, 26, 16, 1, 20, 91, 21822 }, // ƥ
-    { 15, 21, 18, 2, 18, 79, 21913 }, // Ʀ
-    { 12, 20, 14, 1, 19, 60, 21992 }, // Ƨ
-    { 11, 15, 13, 1, 14, 42, 22052 }, // ƨ
-    { 14, 18, 15, 0, 18, 63, 22094 }, // Ʃ
-    { 13, 26, 13, -1, 20, 85, 22157 }, // ƪ
-    { 11, 23, 12, 0, 17, 64, 22242 }, // ƫ
-    { 15, 18, 16, 0, 18, 68, 22306 }, // Ƭ
-    { 11, 21, 12, 0, 20, 58, 22374 }, // ƭ
-    { 14, 24, 15, 0, 18, 84, 22432 }, // Ʈ
-    { 21, 20, 24, 2, 19, 105, 22516 }, // Ư
-    { 19, 17, 21, 1, 16, 81, 22621 }, // ư
-    { 8, 5, 0, -14, 20, 10, 22702 }, // ̀
-    { 9, 5, 0, -10, 20, 12, 22712 }, // ́
-    { 11, 5, 6, -6, 20, 14, 22724 }, // ̂
-    { 11, 4, 0, -14, 19, 11, 22738 }, // ̃
-    { 10, 3, 6, -5, 18, 8, 22749 }, // ̄
-    { 12, 4, 7, -6, 22, 12, 22757 }, // ̅
-    { 11, 5, 7, -5, 20, 14, 22769 }, // ̆
-    { 6, 5, 4, -3, 20, 8, 22783 }, // ̇
-    { 10, 4, 6, -5, 19, 10, 22791 }, // ̈
-    { 7, 7, 0, -11, 21, 13, 22801 }, // ̉
-    { 7, 6, 4, -4, 21, 11, 22814 }, // ̊
-    { 11, 5, 8, -4, 20, 14, 22825 }, // ̋
-    { 12, 5, 7, -6, 20, 15, 22839 }, // ̌
-    { 4, 6, 3, -2, 20, 6, 22854 }, // ̍
-    { 8, 6, 5, -4, 20, 12, 22860 }, // ̎
-    { 12, 5, 0, -15, 20, 15, 22872 }, // ̏
-    { 10, 7, 6, -5, 22, 18, 22887 }, // ̐
-    { 10, 5, 6, -5, 20, 13, 22905 }, // ̑
-    { 6, 7, 4, -3, 18, 11, 22918 }, // ̒
-    { 6, 7, 4, -3, 18, 11, 22929 }, // ̓
-    { 6, 7, 4, -3, 18, 11, 22940 }, // ̔
-    { 6, 7, 4, -3, 18, 11, 22951 }, // ̕
-    { 9, 5, 5, -5, 0, 12, 22962 }, // ̖
-    { 8, 5, 5, -4, 0, 10, 22974 }, // ̗
-    { 6, 6, 4, -3, 0, 9, 22984 }, // ̘
-    { 6, 6, 4, -3, 0, 9, 22993 }, // ̙
-    { 7, 6, 8, 0, 19, 11, 23002 }, // ̚
-    { 7, 6, 5, -3, 19, 11, 23013 }, // ̛
-    { 4, 6, 3, -2, 0, 6, 23024 }, // ̜
-    { 6, 5, 4, -3, -1, 8, 23030 }, // ̝
-    { 6, 5, 4, -3, -1, 8, 23038 }, // ̞
-    { 6, 6, 4, -3, 0, 9, 23046 }, // ̟
-    { 6, 3, 4, -3, -2, 5, 23055 }, // ̠
-    { 6, 8, 1, -6, 2, 12, 23060 }, // ̡
-    { 6, 8, 7, 0, 2, 12, 23072 }, // ̢
-    { 5, 5, 0, -11, -1, 7, 23084 }, // ̣
-    { 10, 4, 6, -5, -1, 10, 23091 }, // ̤
-    { 7, 6, 4, -4, 0, 11, 23101 }, // ̥
-    { 6, 5, 4, -3, -1, 8, 23112 }, // ̦
-    { 6, 6, 4, -3, 0, 9, 23120 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 23129 }, // ̨
-    { 4, 6, 3, -2, 0, 6, 23140 }, // ̩
-    { 10, 5, 6, -5, -1, 13, 23146 }, // ̪
-    { 10, 4, 6, -5, -1, 10, 23159 }, // ̫
-    { 11, 5, 7, -5, 0, 14, 23169 }, // ̬
-    { 11, 5, 6, -6, 0, 14, 23183 }, // ̭
-    { 10, 5, 6, -5, 0, 13, 23197 }, // ̮
-    { 10, 5, 6, -5, -1, 13, 23210 }, // ̯
-    { 12, 4, 7, -6, -1, 12, 23223 }, // ̰
-    { 10, 3, 6, -5, -2, 8, 23235 }, // ̱
-    { 12, 2, 7, -6, -2, 6, 23243 }, // ̲
-    { 11, 6, 6, -6, 0, 17, 23249 }, // ̳
-    { 11, 4, 7, -5, 9, 11, 23266 }, // ̴
-    { 12, 4, 7, -6, 9, 12, 23277 }, // ̵
-    { 20, 4, 11, -10, 9, 20, 23289 }, // ̶
-    { 10, 8, 6, -5, 11, 20, 23309 }, // ̷
-    { 12, 21, 7, -6, 19, 63, 23329 }, // ̸
-    { 4, 6, 3, -2, 0, 6, 23392 }, // ̹
-    { 10, 5, 6, -5, -1, 13, 23398 }, // ̺
-    { 10, 6, 6, -5, 0, 15, 23411 }, // ̻
-    { 10, 4, 6, -5, -1, 10, 23426 }, // ̼
-    { 6, 6, 4, -3, 20, 9, 23436 }, // ̽
-    { 4, 8, 3, -2, 22, 8, 23445 }, // ̾
-    { 11, 6, 6, -6, 25, 17, 23453 }, // ̿
-    { 8, 5, 3, -6, 20, 10, 23470 }, // ̀
-    { 8, 5, 7, -2, 20, 10, 23480 }, // ́
-    { 11, 4, 7, -5, 19, 11, 23490 }, // ͂
-    { 5, 6, 3, -3, 20, 8, 23501 }, // ̓
-    { 14, 5, 9, -6, 20, 18, 23509 }, // ̈́
-    { 5, 5, 5, -1, -1, 7, 23527 }, // ͅ
-    { 12, 6, 7, -6, 20, 18, 23534 }, // ͆
-    { 11, 6, 6, -6, 0, 17, 23552 }, // ͇
-    { 8, 6, 5, -4, 0, 12, 23569 }, // ͈
-    { 6, 5, 4, -3, -1, 8, 23581 }, // ͉
-    { 10, 6, 6, -5, 20, 15, 23589 }, // ͊
-    { 10, 11, 6, -5, 24, 28, 23604 }, // ͋
-    { 10, 7, 6, -5, 22, 18, 23632 }, // ͌
-    { 10, 6, 6, -5, 0, 15, 23650 }, // ͍
-    { 6, 6, 4, -3, 0, 9, 23665 }, // ͎
-    { 18, 18, 10, -9, 18, 81, 23674 }, // ͏
-    { 5, 6, 3, -3, 20, 8, 23755 }, // ͐
-    { 4, 7, 3, -2, 21, 7, 23763 }, // ͑
-    { 10, 7, 6, -5, 22, 18, 23770 }, // ͒
-    { 6, 6, 4, -3, 0, 9, 23788 }, // ͓
-    { 5, 5, 3, -3, -1, 7, 23797 }, // ͔
-    { 5, 5, 3, -3, -1, 7, 23804 }, // ͕
-    { 10, 5, 6, -5, -1, 13, 23811 }, // ͖
-    { 4, 7, 3, -2, 21, 7, 23824 }, // ͗
-    { 5, 5, 8, 2, 20, 7, 23831 }, // ͘
-    { 6, 6, 4, -3, 0, 9, 23838 }, // ͙
-    { 10, 6, 6, -5, 0, 15, 23847 }, // ͚
-    { 6, 6, 4, -3, 20, 9, 23862 }, // ͛
-    { 20, 5, 11, -10, -1, 25, 23871 }, // ͜
-    { 20, 5, 11, -10, 20, 25, 23896 }, // ͝
-    { 16, 2, 9, -8, 17, 8, 23921 }, // ͞
-    { 16, 2, 9, -8, -2, 8, 23929 }, // ͟
-    { 20, 4, 11, -10, 19, 20, 23937 }, // ͠
-    { 20, 6, 11, -10, 22, 30, 23957 }, // ͡
-    { 21, 6, 12, -10, 0, 32, 23987 }, // ͢
-    { 6, 7, 4, -3, 22, 11, 24019 }, // ͣ
-    { 7, 7, 5, -3, 22, 13, 24030 }, // ͤ
-    { 3, 9, 3, -1, 24, 7, 24043 }, // ͥ
-    { 7, 7, 5, -3, 22, 13, 24050 }, // ͦ
-    { 7, 6, 5, -3, 21, 11, 24063 }, // ͧ
-    { 6, 7, 4, -3, 22, 11, 24074 }, // ͨ
-    { 6, 9, 4, -3, 24, 14, 24085 }, // ͩ
-    { 7, 9, 5, -3, 24, 16, 24099 }, // ͪ
-    { 10, 7, 6, -5, 22, 18, 24115 }, // ͫ
-    { 5, 7, 4, -2, 22, 9, 24133 }, // ͬ
-    { 5, 8, 4, -2, 23, 10, 24142 }, // ͭ
-    { 7, 6, 5, -3, 21, 11, 24152 }, // ͮ
-    { 8, 6, 5, -4, 21, 12, 24163 }, // ͯ
-    { 18, 18, 19, 0, 18, 81, 24175 }, // Α
-    { 14, 18, 17, 2, 18, 63, 24256 }, // Β
-    { 10, 18, 13, 2, 18, 45, 24319 }, // Γ
-    { 17, 18, 18, 0, 18, 77, 24364 }, // Δ
-    { 11, 18, 14, 2, 18, 50, 24441 }, // Ε
-    { 14, 18, 15, 0, 18, 63, 24491 }, // Ζ
-    { 15, 18, 19, 2, 18, 68, 24554 }, // Η
-    { 18, 20, 20, 1, 19, 90, 24622 }, // Θ
-    { 9, 18, 10, 0, 18, 41, 24712 }, // Ι
-    { 15, 18, 18, 2, 18, 68, 24753 }, // Κ
-    { 17, 18, 18, 0, 18, 77, 24821 }, // Λ
-    { 20, 18, 24, 2, 18, 90, 24898 }, // Μ
-    { 17, 18, 20, 2, 18, 77, 24988 }, // Ν
-    { 14, 18, 16, 1, 18, 63, 25065 }, // Ξ
-    { 18, 20, 20, 1, 19, 90, 25128 }, // Ο
-    { 15, 18, 19, 2, 18, 68, 25218 }, // Π
-    { 13, 18, 16, 2, 18, 59, 25286 }, // Ρ
-    { 14, 18, 15, 0, 18, 63, 25345 }, // Σ
-    { 14, 18, 15, 0, 18, 63, 25408 }, // Τ
-    { 16, 18, 17, 0, 18, 72, 25471 }, // Υ
-    { 21, 19, 23, 1, 18, 100, 25543 }, // Φ
-    { 17, 18, 18, 0, 18, 77, 25643 }, // Χ
-    { 18, 18, 22, 2, 18, 81, 25720 }, // Ψ
-    { 19, 19, 20, 0, 19, 91, 25801 }, // Ω
-    { 15, 15, 17, 1, 14, 57, 25892 }, // α
-    { 14, 26, 16, 1, 20, 91, 25949 }, // β
-    { 14, 20, 15, 0, 14, 70, 26040 }, // γ
-    { 15, 21, 16, 0, 20, 79, 26110 }, // δ
-    { 12, 15, 13, 0, 14, 45, 26189 }, // ε
-    { 12, 25, 14, 1, 19, 75, 26234 }, // ζ
-    { 14, 20, 16, 1, 14, 70, 26309 }, // η
-    { 14, 21, 16, 1, 20, 74, 26379 }, // θ
-    { 9, 15, 11, 1, 14, 34, 26453 }, // ι
-    { 15, 14, 17, 1, 14, 53, 26487 }, // κ
-    { 15, 21, 16, 0, 20, 79, 26540 }, // λ
-    { 16, 20, 18, 1, 14, 80, 26619 }, // μ
-    { 14, 14, 15, 0, 14, 49, 26699 }, // ν
-    { 12, 25, 14, 1, 19, 75, 26748 }, // ξ
-    { 14, 15, 16, 1, 14, 53, 26823 }, // ο
-    { 18, 15, 19, 0, 14, 68, 26876 }, // π
-    { 14, 20, 16, 1, 14, 70, 26944 }, // ρ
-    { 12, 20, 14, 1, 14, 60, 27014 }, // ς
-    { 15, 15, 17, 1, 14, 57, 27074 }, // σ
-    { 13, 15, 14, 0, 14, 49, 27131 }, // τ
-    { 14, 15, 16, 1, 14, 53, 27180 }, // υ
-    { 19, 25, 21, 1, 19, 119, 27233 }, // φ
-    { 16, 21, 17, 0, 14, 84, 27352 }, // χ
-    { 19, 25, 21, 1, 19, 119, 27436 }, // ψ
-    { 20, 15, 22, 1, 14, 75, 27555 }, // ω
-    { 18, 24, 19, 0, 18, 108, 27630 }, // Ạ
-    { 13, 20, 15, 1, 14, 65, 27738 }, // ạ
-    { 18, 25, 19, 0, 25, 113, 27803 }, // Ả
-    { 13, 22, 15, 1, 21, 72, 27916 }, // ả
-    { 18, 25, 19, 0, 25, 113, 27988 }, // Ấ
-    { 15, 22, 17, 1, 21, 83, 28101 }, // ấ
-    { 18, 25, 19, 0, 25, 113, 28184 }, // Ầ
-    { 15, 22, 15, -1, 21, 83, 28297 }, // ầ
-    { 18, 26, 19, 0, 26, 117, 28380 }, // Ẩ
-    { 14, 23, 16, 1, 22, 81, 28497 }, // ẩ
-    { 18, 27, 19, 0, 27, 122, 28578 }, // Ẫ
-    { 13, 24, 15, 1, 23, 78, 28700 }, // ẫ
-    { 18, 30, 19, 0, 24, 135, 28778 }, // Ậ
-    { 13, 26, 15, 1, 20, 85, 28913 }, // ậ
-    { 18, 26, 19, 0, 26, 117, 28998 }, // Ắ
-    { 13, 23, 15, 1, 22, 75, 29115 }, // ắ
-    { 18, 26, 19, 0, 26, 117, 29190 }, // Ằ
-    { 13, 23, 15, 1, 22, 75, 29307 }, // ằ
-    { 18, 27, 19, 0, 27, 122, 29382 }, // Ẳ
-    { 13, 23, 15, 1, 22, 75, 29504 }, // ẳ
-    { 18, 27, 19, 0, 27, 122, 29579 }, // Ẵ
-    { 13, 24, 15, 1, 23, 78, 29701 }, // ẵ
-    { 18, 30, 19, 0, 24, 135, 29779 }, // Ặ
-    { 13, 26, 15, 1, 20, 85, 29914 }, // ặ
-    { 11, 24, 14, 2, 18, 66, 29999 }, // Ẹ
-    { 13, 20, 15, 1, 14, 65, 30065 }, // ẹ
-    { 11, 25, 14, 2, 25, 69, 30130 }, // Ẻ
-    { 13, 22, 15, 1, 21, 72, 30199 }, // ẻ
-    { 11, 23, 14, 2, 23, 64, 30271 }, // Ẽ
-    { 13, 20, 15, 1, 19, 65, 30335 }, // ẽ
-    { 13, 25, 16, 2, 25, 82, 30400 }, // Ế
-    { 15, 22, 17, 1, 21, 83, 30482 }, // ế
-    { 15, 25, 14, -2, 25, 94, 30565 }, // Ề
-    { 15, 22, 15, -1, 21, 83, 30659 }, // ề
-    { 12, 26, 15, 2, 26, 78, 30742 }, // Ể
-    { 14, 23, 16, 1, 22, 81, 30820 }, // ể
-    { 11, 27, 14, 2, 27, 75, 30901 }, // Ễ
-    { 13, 24, 15, 1, 23, 78, 30976 }, // ễ
-    { 11, 30, 14, 2, 24, 83, 31054 }, // Ệ
-    { 13, 26, 15, 1, 20, 85, 31137 }, // ệ
-    { 9, 25, 10, 0, 25, 57, 31222 }, // Ỉ
-    { 6, 21, 8, 1, 21, 32, 31279 }, // ỉ
-    { 9, 24, 10, 0, 18, 54, 31311 }, // Ị
-    { 5, 26, 7, 1, 20, 33, 31365 }, // ị
-    { 18, 25, 20, 1, 19, 113, 31398 }, // Ọ
-    { 14, 20, 16, 1, 14, 70, 31511 }, // ọ
-    { 18, 26, 20, 1, 25, 117, 31581 }, // Ỏ
-    { 14, 22, 16, 1, 21, 77, 31698 }, // ỏ
-    { 18, 26, 20, 1, 25, 117, 31775 }, // Ố
-    { 15, 22, 17, 1, 21, 83, 31892 }, // ố
-    { 18, 26, 20, 1, 25, 117, 31975 }, // Ồ
-    { 16, 22, 16, -1, 21, 88, 32092 }, // ồ
-    { 18, 27, 20, 1, 26, 122, 32180 }, // Ổ
-    { 14, 23, 16, 1, 22, 81, 32302 }, // ổ
-    { 18, 28, 20, 1, 27, 126, 32383 }, // Ỗ
-    { 14, 24, 16, 1, 23, 84, 32509 }, // ỗ
-    { 18, 30, 20, 1, 24, 135, 32593 }, // Ộ
-    { 14, 26, 16, 1, 20, 91, 32728 }, // ộ
-    { 21, 25, 23, 1, 24, 132, 32819 }, // Ớ
-    { 17, 21, 19, 1, 20, 90, 32951 }, // ớ
-    { 21, 25, 23, 1, 24, 132, 33041 }, // Ờ
-    { 17, 21, 19, 1, 20, 90, 33173 }, // ờ
-    { 21, 26, 23, 1, 25, 137, 33263 }, // Ở
-    { 17, 22, 19, 1, 21, 94, 33400 }, // ở
-    { 21, 24, 23, 1, 23, 126, 33494 }, // Ỡ
-    { 17, 20, 19, 1, 19, 85, 33620 }, // ỡ
-    { 21, 25, 23, 1, 19, 132, 33705 }, // Ợ
-    { 17, 22, 19, 1, 16, 94, 33837 }, // ợ
-    { 15, 24, 19, 2, 18, 90, 33931 }, // Ụ
-    { 14, 20, 16, 1, 14, 70, 34021 }, // ụ
-    { 15, 26, 19, 2, 25, 98, 34091 }, // Ủ
-    { 14, 22, 16, 1, 21, 77, 34189 }, // ủ
-    { 21, 25, 24, 2, 24, 132, 34266 }, // Ứ
-    { 19, 21, 21, 1, 20, 100, 34398 }, // ứ
-    { 21, 25, 24, 2, 24, 132, 34498 }, // Ừ
-    { 19, 21, 21, 1, 20, 100, 34630 }, // ừ
-    { 21, 26, 24, 2, 25, 137, 34730 }, // Ử
-    { 19, 22, 21, 1, 21, 105, 34867 }, // ử
-    { 21, 24, 24, 2, 23, 126, 34972 }, // Ữ
-    { 19, 20, 21, 1, 19, 95, 35098 }, // ữ
-    { 21, 25, 24, 2, 19, 132, 35193 }, // Ự
-    { 19, 22, 21, 1, 16, 105, 35325 }, // ự
-    { 16, 24, 17, 0, 24, 96, 35430 }, // Ỳ
-    { 15, 26, 16, 0, 20, 98, 35526 }, // ỳ
-    { 16, 24, 17, 0, 18, 96, 35624 }, // Ỵ
-    { 15, 20, 16, 0, 14, 75, 35720 }, // ỵ
-    { 16, 25, 17, 0, 25, 100, 35795 }, // Ỷ
-    { 15, 27, 16, 0, 21, 102, 35895 }, // ỷ
-    { 16, 23, 17, 0, 23, 92, 35997 }, // Ỹ
-    { 15, 25, 16, 0, 19, 94, 36089 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 36183 }, //  
-    { 0, 0, 25, 0, 0, 0, 36183 }, //  
-    { 0, 0, 13, 0, 0, 0, 36183 }, //  
-    { 0, 0, 25, 0, 0, 0, 36183 }, //  
-    { 0, 0, 8, 0, 0, 0, 36183 }, //  
-    { 0, 0, 6, 0, 0, 0, 36183 }, //  
-    { 0, 0, 4, 0, 0, 0, 36183 }, //  
-    { 0, 0, 14, 0, 0, 0, 36183 }, //  
-    { 0, 0, 7, 0, 0, 0, 36183 }, //  
-    { 0, 0, 4, 0, 0, 0, 36183 }, //  
-    { 0, 0, 3, 0, 0, 0, 36183 }, //  
-    { 0, 0, 1, 0, 0, 0, 36183 }, // ​
-    { 0, 0, 1, 0, 0, 0, 36183 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 36183 }, // ‍
-    { 7, 22, 7, -1, 18, 39, 36183 }, // ‎
-    { 7, 22, 2, -6, 18, 39, 36222 }, // ‏
-    { 8, 4, 9, 0, 9, 8, 36261 }, // ‐
-    { 8, 4, 9, 0, 9, 8, 36269 }, // ‑
-    { 13, 4, 15, 1, 11, 13, 36277 }, // ‒
-    { 12, 4, 13, 0, 9, 12, 36290 }, // –
-    { 25, 4, 26, 0, 9, 25, 36302 }, // —
-    { 25, 4, 26, 0, 9, 25, 36327 }, // ―
-    { 10, 25, 14, 2, 19, 63, 36352 }, // ‖
-    { 12, 6, 12, -1, 0, 18, 36415 }, // ‗
-    { 6, 7, 7, 0, 18, 11, 36433 }, // ‘
-    { 6, 7, 7, 0, 18, 11, 36444 }, // ’
-    { 6, 7, 7, 0, 4, 11, 36455 }, // ‚
-    { 6, 7, 7, 0, 18, 11, 36466 }, // ‛
-    { 11, 7, 12, 0, 18, 20, 36477 }, // “
-    { 11, 7, 12, 0, 18, 20, 36497 }, // ”
-    { 12, 7, 13, 0, 3, 21, 36517 }, // „
-    { 11, 7, 12, 0, 18, 20, 36538 }, // ‟
-    { 11, 19, 13, 1, 19, 53, 36558 }, // †
-    { 11, 19, 13, 1, 19, 53, 36611 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 36664 }, // •
-    { 9, 10, 11, 1, 14, 23, 36680 }, // ‣
-    { 5, 5, 13, 4, 4, 7, 36703 }, // ․
-    { 13, 5, 15, 1, 4, 17, 36710 }, // ‥
-    { 19, 5, 21, 1, 4, 24, 36727 }, // …
-    { 5, 5, 7, 1, 9, 7, 36751 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 36758 }, //  
-    { 0, 0, 15, 0, 0, 0, 36758 }, //  
-    { 7, 20, 7, -1, 16, 35, 36758 }, // ‪
-    { 7, 20, 2, -6, 16, 35, 36793 }, // ‫
-    { 6, 22, 4, -3, 18, 33, 36828 }, // ‬
-    { 6, 22, 4, -3, 18, 33, 36861 }, // ‭
-    { 6, 22, 4, -3, 18, 33, 36894 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 36927 }, //  
-    { 32, 20, 33, 0, 19, 160, 36927 }, // ‰
-    { 41, 20, 42, 0, 19, 205, 37087 }, // ‱
-    { 7, 7, 9, 1, 18, 13, 37292 }, // ′
-    { 13, 7, 15, 1, 18, 23, 37305 }, // ″
-    { 18, 7, 20, 1, 18, 32, 37328 }, // ‴
-    { 7, 7, 11, 1, 18, 13, 37360 }, // ‵
-    { 13, 7, 16, 1, 18, 23, 37373 }, // ‶
-    { 18, 7, 22, 1, 18, 32, 37396 }, // ‷
-    { 10, 9, 11, 0, 3, 23, 37428 }, // ‸
-    { 9, 12, 10, 0, 13, 27, 37451 }, // ‹
-    { 9, 12, 10, 0, 13, 27, 37478 }, // ›
-    { 19, 20, 21, 1, 19, 95, 37505 }, // ※
-    { 12, 19, 14, 1, 18, 57, 37600 }, // ‼
-    { 12, 20, 13, 0, 19, 60, 37657 }, // ‽
-    { 14, 3, 14, -1, 22, 11, 37717 }, // ‾
-    { 15, 6, 16, 0, 0, 23, 37728 }, // ‿
-    { 15, 6, 16, 0, 20, 23, 37751 }, // ⁀
-    { 11, 17, 12, 0, 11, 47, 37774 }, // ⁁
-    { 28, 23, 29, 0, 19, 161, 37821 }, // ⁂
-    { 7, 4, 9, 1, 9, 7, 37982 }, // ⁃
-    { 14, 18, 10, -5, 18, 63, 37989 }, // ⁄
-    { 7, 22, 9, 1, 18, 39, 38052 }, // ⁅
-    { 7, 22, 8, 0, 18, 39, 38091 }, // ⁆
-    { 24, 20, 25, 0, 19, 120, 38130 }, // ⁇
-    { 18, 20, 19, 0, 19, 90, 38250 }, // ⁈
-    { 18, 20, 20, 1, 19, 90, 38340 }, // ⁉
-    { 13, 14, 15, 1, 14, 46, 38430 }, // ⁊
-    { 14, 23, 16, 1, 19, 81, 38476 }, // ⁋
-    { 14, 13, 16, 1, 14, 46, 38557 }, // ⁌
-    { 14, 13, 17, 2, 14, 46, 38603 }, // ⁍
-    { 13, 12, 14, 0, 7, 39, 38649 }, // ⁎
-    { 6, 18, 8, 1, 14, 27, 38688 }, // ⁏
-    { 15, 26, 16, 0, 20, 98, 38715 }, // ⁐
-    { 13, 25, 14, 0, 19, 82, 38813 }, // ⁑
-    { 11, 20, 12, 0, 19, 55, 38895 }, // ⁒
-    { 24, 5, 26, 1, 10, 30, 38950 }, // ⁓
-    { 15, 6, 16, 0, 0, 23, 38980 }, // ⁔
-    { 14, 13, 15, 0, 13, 46, 39003 }, // ⁕
-    { 13, 20, 15, 1, 19, 65, 39049 }, // ⁖
-    { 23, 7, 25, 1, 18, 41, 39114 }, // ⁗
-    { 20, 20, 22, 1, 19, 100, 39155 }, // ⁘
-    { 20, 20, 22, 1, 19, 100, 39255 }, // ⁙
-    { 5, 20, 7, 1, 19, 25, 39355 }, // ⁚
-    { 15, 21, 17, 1, 20, 79, 39380 }, // ⁛
-    { 21, 20, 22, 0, 19, 105, 39459 }, // ⁜
-    { 5, 20, 7, 1, 19, 25, 39564 }, // ⁝
-    { 5, 20, 7, 1, 19, 25, 39589 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 39614 }, //  
-    { 0, 0, 15, 0, 0, 0, 39614 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 39614 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 39614 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 39614 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 39614 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 39614 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 39614 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 39614 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 39614 }, // ⁩
-    { 6, 22, 4, -3, 18, 33, 39614 }, // ⁪
-    { 6, 22, 4, -3, 18, 33, 39647 }, // ⁫
-    { 6, 22, 4, -3, 18, 33, 39680 }, // ⁬
-    { 6, 22, 4, -3, 18, 33, 39713 }, // ⁭
-    { 6, 22, 4, -3, 18, 33, 39746 }, // ⁮
-    { 6, 22, 4, -3, 18, 33, 39779 }, // ⁯
-    { 9, 12, 10, 0, 22, 27, 39812 }, // ⁰
-    { 3, 12, 5, 1, 19, 9, 39839 }, // ⁱ
-    { 10, 12, 11, 0, 22, 30, 39848 }, // ⁴
-    { 8, 12, 10, 1, 22, 24, 39878 }, // ⁵
-    { 9, 12, 10, 0, 22, 27, 39902 }, // ⁶
-    { 9, 12, 10, 0, 22, 27, 39929 }, // ⁷
-    { 9, 12, 10, 0, 22, 27, 39956 }, // ⁸
-    { 9, 12, 10, 0, 22, 27, 39983 }, // ⁹
-    { 9, 8, 10, 0, 19, 18, 40010 }, // ⁺
-    { 9, 2, 10, 0, 16, 5, 40028 }, // ⁻
-    { 9, 6, 10, 0, 18, 14, 40033 }, // ⁼
-    { 5, 15, 7, 1, 23, 19, 40047 }, // ⁽
-    { 5, 15, 6, 0, 23, 19, 40066 }, // ⁾
-    { 9, 9, 11, 1, 16, 21, 40085 }, // ⁿ
-    { 9, 12, 10, 0, 8, 27, 40106 }, // ₀
-    { 7, 12, 10, 0, 8, 21, 40133 }, // ₁
-    { 9, 12, 10, 0, 8, 27, 40154 }, // ₂
-    { 9, 12, 10, 0, 8, 27, 40181 }, // ₃
-    { 10, 12, 11, 0, 8, 30, 40208 }, // ₄
-    { 8, 12, 10, 1, 8, 24, 40238 }, // ₅
-    { 9, 12, 10, 0, 8, 27, 40262 }, // ₆
-    { 9, 12, 10, 0, 8, 27, 40289 }, // ₇
-    { 9, 12, 10, 0, 8, 27, 40316 }, // ₈
-    { 9, 12, 10, 0, 8, 27, 40343 }, // ₉
-    { 9, 8, 10, 0, 6, 18, 40370 }, // ₊
-    { 9, 2, 10, 0, 3, 5, 40388 }, // ₋
-    { 9, 6, 10, 0, 5, 14, 40393 }, // ₌
-    { 5, 15, 7, 1, 9, 19, 40407 }, // ₍
-    { 5, 15, 6, 0, 9, 19, 40426 }, // ₎
-    { 9, 9, 10, 0, 6, 21, 40445 }, // ₐ
-    { 9, 9, 10, 0, 6, 21, 40466 }, // ₑ
-    { 10, 9, 11, 0, 6, 23, 40487 }, // ₒ
-    { 10, 9, 11, 0, 6, 23, 40510 }, // ₓ
-    { 9, 9, 10, 0, 6, 21, 40533 }, // ₔ
-    { 9, 12, 11, 1, 9, 27, 40554 }, // ₕ
-    { 10, 12, 12, 1, 9, 30, 40581 }, // ₖ
-    { 3, 12, 5, 1, 9, 9, 40611 }, // ₗ
-    { 14, 9, 16, 1, 6, 32, 40620 }, // ₘ
-    { 9, 9, 11, 1, 6, 21, 40652 }, // ₙ
-    { 9, 12, 11, 1, 6, 27, 40673 }, // ₚ
-    { 8, 9, 9, 0, 6, 18, 40700 }, // ₛ
-    { 7, 11, 8, 0, 8, 20, 40718 }, // ₜ
-    { 14, 19, 15, 0, 19, 67, 40738 }, // ₠
-    { 15, 21, 16, 0, 19, 79, 40805 }, // ₡
-    { 14, 20, 15, 0, 19, 70, 40884 }, // ₢
-    { 13, 18, 14, 0, 18, 59, 40954 }, // ₣
-    { 13, 19, 15, 1, 19, 62, 41013 }, // ₤
-    { 22, 20, 24, 1, 17, 110, 41075 }, // ₥
-    { 15, 18, 16, 0, 18, 68, 41185 }, // ₦
-    { 21, 19, 23, 1, 18, 100, 41253 }, // ₧
-    { 22, 19, 24, 1, 18, 105, 41353 }, // ₨
-    { 19, 18, 20, 0, 18, 86, 41458 }, // ₩
-    { 19, 18, 23, 2, 18, 86, 41544 }, // ₪
-    { 15, 23, 17, 1, 19, 87, 41630 }, // ₫
-    { 15, 19, 16, 0, 18, 72, 41717 }, // €
-    { 15, 18, 16, 0, 18, 68, 41789 }, // ₭
-    { 14, 18, 15, 0, 18, 63, 41857 }, // ₮
-    { 25, 25, 26, 0, 19, 157, 41920 }, // ₯
-    { 14, 25, 15, 0, 19, 88, 42077 }, // ₰
-    { 15, 18, 16, 0, 18, 68, 42165 }, // ₱
-    { 16, 21, 18, 1, 19, 84, 42233 }, // ₲
-    { 17, 18, 18, 0, 18, 77, 42317 }, // ₳
-    { 15, 20, 16, 0, 19, 75, 42394 }, // ₴
-    { 15, 21, 17, 1, 19, 79, 42469 }, // ₵
-    { 17, 18, 18, 0, 17, 77, 42548 }, // ₶
-    { 18, 21, 19, 0, 19, 95, 42625 }, // ₷
-    { 14, 18, 15, 0, 18, 63, 42720 }, // ₸
-    { 12, 18, 14, 1, 18, 54, 42783 }, // ₹
-    { 14, 19, 15, 0, 18, 67, 42837 }, // ₺
-    { 20, 20, 21, 0, 19, 100, 42904 }, // ₻
-    { 20, 18, 22, 1, 18, 90, 43004 }, // ₼
-    { 15, 18, 16, 0, 18, 68, 43094 }, // ₽
-    { 18, 20, 20, 1, 20, 90, 43162 }, // ₾
-    { 12, 24, 15, 2, 21, 72, 43252 }, // ₿
-    { 12, 19, 14, 1, 14, 57, 43324 }, // ⃀
-    { 13, 4, 15, 1, 11, 13, 43381 }, // −
-    { 23, 23, 25, 1, 19, 133, 43394 }, // �
+    { 5, 19, 7, 1, 18, 25, 0 }, // !
+    { 10, 7, 12, 1, 18, 19, 25 }, // "
+    { 16, 18, 17, 0, 18, 60, 44 }, // #
+    { 13, 21, 15, 1, 19, 53, 104 }, // $
+    { 22, 20, 23, 0, 19, 87, 157 }, // %
+    { 18, 20, 20, 1, 19, 64, 244 }, // &
+    { 5, 7, 7, 1, 18, 10, 308 }, // '
+    { 7, 22, 9, 1, 18, 34, 318 }, // (
+    { 8, 22, 9, 0, 18, 33, 352 }, // )
+    { 13, 12, 14, 0, 19, 34, 385 }, // *
+    { 13, 13, 15, 1, 15, 29, 419 }, // +
+    { 6, 7, 7, 0, 3, 9, 448 }, // ,
+    { 8, 4, 9, 0, 9, 10, 457 }, // -
+    { 5, 5, 7, 1, 4, 9, 467 }, // .
+    { 11, 19, 12, 0, 18, 28, 476 }, // /
+    { 14, 20, 15, 0, 19, 51, 504 }, // 0
+    { 10, 18, 14, 1, 18, 39, 555 }, // 1
+    { 14, 19, 15, 0, 19, 40, 594 }, // 2
+    { 14, 20, 15, 0, 19, 48, 634 }, // 3
+    { 14, 18, 15, 0, 18, 50, 682 }, // 4
+    { 13, 19, 15, 1, 18, 46, 732 }, // 5
+    { 14, 20, 15, 0, 19, 52, 778 }, // 6
+    { 14, 18, 15, 0, 18, 41, 830 }, // 7
+    { 14, 20, 15, 0, 19, 51, 871 }, // 8
+    { 14, 20, 15, 0, 19, 52, 922 }, // 9
+    { 5, 15, 7, 1, 14, 18, 974 }, // :
+    { 6, 18, 7, 0, 14, 19, 992 }, // ;
+    { 13, 14, 15, 1, 16, 29, 1011 }, // <
+    { 13, 8, 15, 1, 13, 19, 1040 }, // =
+    { 13, 14, 15, 1, 16, 29, 1059 }, // >
+    { 12, 20, 13, 0, 19, 35, 1088 }, // ?
+    { 21, 20, 23, 1, 18, 88, 1123 }, // @
+    { 18, 18, 19, 0, 18, 55, 1211 }, // A
+    { 14, 18, 17, 2, 18, 46, 1266 }, // B
+    { 15, 20, 17, 1, 19, 49, 1312 }, // C
+    { 15, 18, 18, 2, 18, 44, 1361 }, // D
+    { 11, 18, 14, 2, 18, 34, 1405 }, // E
+    { 11, 18, 14, 2, 18, 28, 1439 }, // F
+    { 16, 20, 18, 1, 19, 53, 1467 }, // G
+    { 15, 18, 19, 2, 18, 33, 1520 }, // H
+    { 9, 18, 10, 0, 18, 23, 1553 }, // I
+    { 9, 24, 8, -2, 18, 29, 1576 }, // J
+    { 15, 18, 18, 2, 18, 46, 1605 }, // K
+    { 12, 18, 15, 2, 18, 22, 1651 }, // L
+    { 20, 18, 24, 2, 18, 82, 1673 }, // M
+    { 17, 18, 20, 2, 18, 66, 1755 }, // N
+    { 18, 20, 20, 1, 19, 58, 1821 }, // O
+    { 13, 18, 16, 2, 18, 42, 1879 }, // P
+    { 18, 24, 20, 1, 19, 68, 1921 }, // Q
+    { 15, 18, 18, 2, 18, 46, 1989 }, // R
+    { 12, 20, 14, 1, 19, 42, 2035 }, // S
+    { 14, 18, 15, 0, 18, 41, 2077 }, // T
+    { 15, 19, 19, 2, 18, 37, 2118 }, // U
+    { 17, 18, 18, 0, 18, 50, 2155 }, // V
+    { 25, 18, 26, 0, 18, 90, 2205 }, // W
+    { 17, 18, 18, 0, 18, 52, 2295 }, // X
+    { 16, 18, 17, 0, 18, 40, 2347 }, // Y
+    { 14, 18, 15, 0, 18, 42, 2387 }, // Z
+    { 7, 22, 9, 1, 18, 37, 2429 }, // [
+    { 11, 19, 12, 0, 18, 28, 2466 }, // <backslash>
+    { 7, 22, 8, 0, 18, 45, 2494 }, // ]
+    { 14, 12, 15, 0, 18, 32, 2539 }, // ^
+    { 12, 2, 12, -1, -2, 5, 2571 }, // _
+    { 8, 5, 10, 1, 20, 8, 2576 }, // `
+    { 13, 15, 15, 1, 14, 39, 2584 }, // a
+    { 14, 20, 16, 1, 19, 53, 2623 }, // b
+    { 12, 15, 14, 1, 14, 29, 2676 }, // c
+    { 13, 20, 16, 1, 19, 44, 2705 }, // d
+    { 13, 15, 15, 1, 14, 37, 2749 }, // e
+    { 11, 20, 12, 0, 20, 42, 2786 }, // f
+    { 13, 20, 16, 1, 14, 50, 2828 }, // g
+    { 14, 19, 16, 1, 19, 57, 2878 }, // h
+    { 5, 20, 7, 1, 20, 29, 2935 }, // i
+    { 8, 26, 7, -2, 20, 41, 2964 }, // j
+    { 15, 19, 17, 1, 19, 49, 3005 }, // k
+    { 5, 19, 7, 1, 19, 29, 3054 }, // l
+    { 22, 14, 24, 1, 14, 66, 3083 }, // m
+    { 14, 14, 16, 1, 14, 47, 3149 }, // n
+    { 14, 15, 16, 1, 14, 41, 3196 }, // o
+    { 14, 20, 16, 1, 14, 54, 3237 }, // p
+    { 13, 20, 16, 1, 14, 45, 3291 }, // q
+    { 10, 14, 12, 1, 14, 28, 3336 }, // r
+    { 11, 15, 13, 1, 14, 34, 3364 }, // s
+    { 11, 18, 12, 0, 17, 31, 3398 }, // t
+    { 14, 15, 16, 1, 14, 51, 3429 }, // u
+    { 15, 14, 16, 0, 14, 40, 3480 }, // v
+    { 22, 14, 23, 0, 14, 70, 3520 }, // w
+    { 15, 14, 16, 0, 14, 41, 3590 }, // x
+    { 15, 20, 16, 0, 14, 54, 3631 }, // y
+    { 12, 14, 13, 0, 14, 31, 3685 }, // z
+    { 9, 22, 10, 0, 18, 43, 3716 }, // {
+    { 4, 25, 14, 5, 19, 38, 3759 }, // |
+    { 9, 22, 11, 1, 18, 37, 3797 }, // }
+    { 13, 5, 15, 1, 11, 14, 3834 }, // ~
+    { 0, 0, 7, 0, 0, 0, 3848 }, //  
+    { 5, 19, 7, 1, 14, 28, 3848 }, // ¡
+    { 12, 20, 14, 1, 19, 39, 3876 }, // ¢
+    { 13, 19, 15, 1, 19, 39, 3915 }, // £
+    { 12, 12, 14, 1, 15, 36, 3954 }, // ¤
+    { 15, 18, 16, 0, 18, 50, 3990 }, // ¥
+    { 4, 25, 14, 5, 19, 33, 4040 }, // ¦
+    { 10, 21, 12, 1, 20, 46, 4073 }, // §
+    { 9, 4, 15, 3, 19, 13, 4119 }, // ¨
+    { 19, 20, 21, 1, 19, 84, 4132 }, // ©
+    { 9, 10, 10, 0, 19, 25, 4216 }, // ª
+    { 15, 12, 16, 0, 13, 36, 4241 }, // «
+    { 13, 8, 15, 1, 11, 19, 4277 }, // ¬
+    { 8, 4, 9, 0, 9, 10, 4296 }, // ­
+    { 19, 20, 21, 1, 19, 90, 4306 }, // ®
+    { 14, 3, 14, -1, 22, 12, 4396 }, // ¯
+    { 9, 10, 11, 1, 19, 22, 4408 }, // °
+    { 13, 16, 15, 1, 16, 37, 4430 }, // ±
+    { 9, 12, 10, 0, 22, 24, 4467 }, // ²
+    { 9, 12, 10, 0, 22, 27, 4491 }, // ³
+    { 8, 5, 10, 1, 20, 8, 4518 }, // ´
+    { 14, 20, 16, 1, 14, 62, 4526 }, // µ
+    { 14, 23, 16, 1, 19, 57, 4588 }, // ¶
+    { 5, 5, 7, 1, 11, 9, 4645 }, // ·
+    { 7, 6, 8, 0, 0, 9, 4654 }, // ¸
+    { 7, 12, 10, 0, 22, 17, 4663 }, // ¹
+    { 9, 10, 10, 0, 19, 24, 4680 }, // º
+    { 15, 12, 16, 0, 13, 36, 4704 }, // »
+    { 21, 18, 22, 0, 18, 74, 4740 }, // ¼
+    { 21, 18, 22, 0, 18, 75, 4814 }, // ½
+    { 20, 19, 22, 1, 19, 81, 4889 }, // ¾
+    { 12, 19, 13, 0, 14, 36, 4970 }, // ¿
+    { 18, 24, 19, 0, 24, 66, 5006 }, // À
+    { 18, 24, 19, 0, 24, 65, 5072 }, // Á
+    { 18, 24, 19, 0, 24, 69, 5137 }, // Â
+    { 18, 23, 19, 0, 23, 70, 5206 }, // Ã
+    { 18, 23, 19, 0, 23, 71, 5276 }, // Ä
+    { 18, 22, 19, 0, 22, 69, 5347 }, // Å
+    { 23, 18, 24, 0, 18, 74, 5416 }, // Æ
+    { 15, 25, 17, 1, 19, 61, 5490 }, // Ç
+    { 11, 24, 14, 2, 24, 42, 5551 }, // È
+    { 11, 24, 14, 2, 24, 43, 5593 }, // É
+    { 11, 24, 14, 2, 24, 46, 5636 }, // Ê
+    { 11, 23, 14, 2, 23, 48, 5682 }, // Ë
+    { 9, 24, 10, 0, 24, 30, 5730 }, // Ì
+    { 10, 24, 11, 0, 24, 31, 5760 }, // Í
+    { 11, 24, 11, -1, 24, 35, 5791 }, // Î
+    { 10, 23, 11, 0, 23, 36, 5826 }, // Ï
+    { 17, 18, 18, 0, 18, 53, 5862 }, // Ð
+    { 17, 23, 20, 2, 23, 81, 5915 }, // Ñ
+    { 18, 25, 20, 1, 24, 68, 5996 }, // Ò
+    { 18, 25, 20, 1, 24, 69, 6064 }, // Ó
+    { 18, 25, 20, 1, 24, 71, 6133 }, // Ô
+    { 18, 24, 20, 1, 23, 71, 6204 }, // Õ
+    { 18, 24, 20, 1, 23, 72, 6275 }, // Ö
+    { 12, 12, 14, 1, 15, 31, 6347 }, // ×
+    { 18, 21, 20, 1, 19, 73, 6378 }, // Ø
+    { 15, 25, 19, 2, 24, 48, 6451 }, // Ù
+    { 15, 25, 19, 2, 24, 48, 6499 }, // Ú
+    { 15, 25, 19, 2, 24, 50, 6547 }, // Û
+    { 15, 24, 19, 2, 23, 51, 6597 }, // Ü
+    { 16, 24, 17, 0, 24, 51, 6648 }, // Ý
+    { 13, 18, 16, 2, 18, 39, 6699 }, // Þ
+    { 16, 21, 18, 1, 20, 65, 6738 }, // ß
+    { 13, 21, 15, 1, 20, 48, 6803 }, // à
+    { 13, 21, 15, 1, 20, 47, 6851 }, // á
+    { 13, 21, 15, 1, 20, 53, 6898 }, // â
+    { 13, 20, 15, 1, 19, 54, 6951 }, // ã
+    { 13, 20, 15, 1, 19, 53, 7005 }, // ä
+    { 13, 22, 15, 1, 21, 55, 7058 }, // å
+    { 21, 15, 23, 1, 14, 60, 7113 }, // æ
+    { 12, 20, 14, 1, 14, 40, 7173 }, // ç
+    { 13, 21, 15, 1, 20, 46, 7213 }, // è
+    { 13, 21, 15, 1, 20, 45, 7259 }, // é
+    { 13, 21, 15, 1, 20, 51, 7304 }, // ê
+    { 13, 20, 15, 1, 19, 51, 7355 }, // ë
+    { 9, 20, 9, -1, 20, 31, 7406 }, // ì
+    { 8, 20, 10, 1, 20, 30, 7437 }, // í
+    { 11, 20, 10, -2, 20, 34, 7467 }, // î
+    { 10, 19, 10, -1, 19, 35, 7501 }, // ï
+    { 14, 21, 16, 1, 20, 55, 7536 }, // ð
+    { 14, 19, 16, 1, 19, 61, 7591 }, // ñ
+    { 14, 21, 16, 1, 20, 51, 7652 }, // ò
+    { 14, 21, 16, 1, 20, 50, 7703 }, // ó
+    { 14, 21, 16, 1, 20, 53, 7753 }, // ô
+    { 14, 20, 16, 1, 19, 55, 7806 }, // õ
+    { 14, 20, 16, 1, 19, 54, 7861 }, // ö
+    { 13, 13, 15, 1, 15, 30, 7915 }, // ÷
+    { 14, 16, 16, 1, 15, 49, 7945 }, // ø
+    { 14, 21, 16, 1, 20, 61, 7994 }, // ù
+    { 14, 21, 16, 1, 20, 61, 8055 }, // ú
+    { 14, 21, 16, 1, 20, 62, 8116 }, // û
+    { 14, 20, 16, 1, 19, 64, 8178 }, // ü
+    { 15, 26, 16, 0, 20, 65, 8242 }, // ý
+    { 14, 25, 16, 1, 19, 63, 8307 }, // þ
+    { 15, 25, 16, 0, 19, 68, 8370 }, // ÿ
+    { 18, 22, 19, 0, 22, 67, 8438 }, // Ā
+    { 13, 19, 15, 1, 18, 50, 8505 }, // ā
+    { 18, 24, 19, 0, 24, 70, 8555 }, // Ă
+    { 13, 21, 15, 1, 20, 52, 8625 }, // ă
+    { 18, 24, 19, 0, 18, 68, 8677 }, // Ą
+    { 13, 20, 15, 1, 14, 52, 8745 }, // ą
+    { 15, 25, 17, 1, 24, 59, 8797 }, // Ć
+    { 12, 21, 14, 1, 20, 38, 8856 }, // ć
+    { 15, 25, 17, 1, 24, 61, 8894 }, // Ĉ
+    { 12, 21, 14, 1, 20, 41, 8955 }, // ĉ
+    { 15, 25, 17, 1, 24, 60, 8996 }, // Ċ
+    { 12, 21, 14, 1, 20, 38, 9056 }, // ċ
+    { 15, 25, 17, 1, 24, 62, 9094 }, // Č
+    { 12, 21, 14, 1, 20, 42, 9156 }, // č
+    { 15, 24, 18, 2, 24, 57, 9198 }, // Ď
+    { 19, 20, 21, 1, 19, 56, 9255 }, // ď
+    { 17, 18, 18, 0, 18, 53, 9311 }, // Đ
+    { 15, 20, 17, 1, 19, 53, 9364 }, // đ
+    { 11, 22, 14, 2, 22, 45, 9417 }, // Ē
+    { 13, 19, 15, 1, 18, 48, 9462 }, // ē
+    { 11, 24, 14, 2, 24, 47, 9510 }, // Ĕ
+    { 13, 21, 15, 1, 20, 50, 9557 }, // ĕ
+    { 11, 24, 14, 2, 24, 42, 9607 }, // Ė
+    { 13, 21, 15, 1, 20, 47, 9649 }, // ė
+    { 11, 24, 14, 2, 18, 45, 9696 }, // Ę
+    { 13, 20, 15, 1, 14, 49, 9741 }, // ę
+    { 11, 24, 14, 2, 24, 46, 9790 }, // Ě
+    { 13, 21, 15, 1, 20, 48, 9836 }, // ě
+    { 16, 25, 18, 1, 24, 65, 9884 }, // Ĝ
+    { 13, 26, 16, 1, 20, 63, 9949 }, // ĝ
+    { 16, 25, 18, 1, 24, 67, 10012 }, // Ğ
+    { 13, 26, 16, 1, 20, 65, 10079 }, // ğ
+    { 16, 25, 18, 1, 24, 62, 10144 }, // Ġ
+    { 13, 26, 16, 1, 20, 61, 10206 }, // ġ
+    { 16, 25, 18, 1, 19, 64, 10267 }, // Ģ
+    { 13, 26, 16, 1, 20, 60, 10331 }, // ģ
+    { 15, 24, 19, 2, 24, 48, 10391 }, // Ĥ
+    { 17, 25, 16, -2, 25, 70, 10439 }, // ĥ
+    { 20, 18, 21, 0, 18, 49, 10509 }, // Ħ
+    { 15, 19, 16, 0, 19, 53, 10558 }, // ħ
+    { 11, 23, 11, -1, 23, 37, 10611 }, // Ĩ
+    { 11, 19, 10, -2, 19, 37, 10648 }, // ĩ
+    { 9, 22, 10, 0, 22, 31, 10685 }, // Ī
+    { 9, 18, 9, -1, 18, 31, 10716 }, // ī
+    { 10, 24, 11, 0, 24, 38, 10747 }, // Ĭ
+    { 10, 20, 10, -1, 20, 37, 10785 }, // ĭ
+    { 9, 24, 10, 0, 18, 34, 10822 }, // Į
+    { 5, 26, 7, 1, 20, 39, 10856 }, // į
+    { 9, 24, 10, 0, 24, 30, 10895 }, // İ
+    { 5, 14, 7, 1, 14, 22, 10925 }, // ı
+    { 17, 24, 18, 0, 18, 63, 10947 }, // Ĳ
+    { 13, 26, 15, 1, 20, 72, 11010 }, // ĳ
+    { 12, 30, 11, -2, 24, 40, 11082 }, // Ĵ
+    { 11, 26, 10, -2, 20, 45, 11122 }, // ĵ
+    { 15, 24, 18, 2, 18, 57, 11167 }, // Ķ
+    { 15, 25, 17, 1, 19, 60, 11224 }, // ķ
+    { 15, 14, 17, 1, 14, 43, 11284 }, // ĸ
+    { 13, 24, 15, 1, 24, 38, 11327 }, // Ĺ
+    { 8, 25, 10, 1, 25, 37, 11365 }, // ĺ
+    { 12, 24, 15, 2, 18, 32, 11402 }, // Ļ
+    { 5, 25, 7, 1, 19, 37, 11434 }, // ļ
+    { 12, 18, 15, 2, 18, 27, 11471 }, // Ľ
+    { 10, 19, 12, 1, 19, 35, 11498 }, // ľ
+    { 12, 18, 15, 2, 18, 29, 11533 }, // Ŀ
+    { 10, 19, 12, 1, 19, 35, 11562 }, // ŀ
+    { 14, 18, 15, 0, 18, 34, 11597 }, // Ł
+    { 9, 19, 9, -1, 19, 32, 11631 }, // ł
+    { 17, 24, 20, 2, 24, 78, 11663 }, // Ń
+    { 14, 20, 16, 1, 20, 57, 11741 }, // ń
+    { 17, 24, 20, 2, 18, 78, 11798 }, // Ņ
+    { 14, 20, 16, 1, 14, 59, 11876 }, // ņ
+    { 17, 24, 20, 2, 24, 81, 11935 }, // Ň
+    { 14, 20, 16, 1, 20, 59, 12016 }, // ň
+    { 19, 18, 19, -1, 18, 56, 12075 }, // ŉ
+    { 17, 24, 20, 2, 18, 77, 12131 }, // Ŋ
+    { 14, 20, 16, 1, 14, 61, 12208 }, // ŋ
+    { 18, 23, 20, 1, 22, 68, 12269 }, // Ō
+    { 14, 19, 16, 1, 18, 50, 12337 }, // ō
+    { 18, 25, 20, 1, 24, 74, 12387 }, // Ŏ
+    { 14, 21, 16, 1, 20, 56, 12461 }, // ŏ
+    { 18, 25, 20, 1, 24, 72, 12517 }, // Ő
+    { 14, 21, 16, 1, 20, 55, 12589 }, // ő
+    { 22, 20, 24, 1, 19, 67, 12644 }, // Œ
+    { 23, 15, 25, 1, 14, 66, 12711 }, // œ
+    { 15, 24, 18, 2, 24, 56, 12777 }, // Ŕ
+    { 11, 20, 13, 1, 20, 35, 12833 }, // ŕ
+    { 15, 24, 18, 2, 18, 58, 12868 }, // Ŗ
+    { 10, 20, 12, 1, 14, 36, 12926 }, // ŗ
+    { 15, 24, 18, 2, 24, 59, 12962 }, // Ř
+    { 11, 20, 13, 1, 20, 40, 13021 }, // ř
+    { 12, 25, 14, 1, 24, 49, 13061 }, // Ś
+    { 11, 21, 13, 1, 20, 41, 13110 }, // ś
+    { 12, 25, 14, 1, 24, 52, 13151 }, // Ŝ
+    { 11, 21, 13, 1, 20, 44, 13203 }, // ŝ
+    { 12, 25, 14, 1, 19, 53, 13247 }, // Ş
+    { 11, 20, 13, 1, 14, 43, 13300 }, // ş
+    { 12, 25, 14, 1, 24, 53, 13343 }, // Š
+    { 11, 21, 13, 1, 20, 46, 13396 }, // š
+    { 14, 24, 15, 0, 18, 52, 13442 }, // Ţ
+    { 11, 23, 12, 0, 17, 40, 13494 }, // ţ
+    { 14, 24, 15, 0, 24, 54, 13534 }, // Ť
+    { 15, 20, 16, 0, 19, 44, 13588 }, // ť
+    { 14, 18, 15, 0, 18, 44, 13632 }, // Ŧ
+    { 11, 18, 12, 0, 17, 33, 13676 }, // ŧ
+    { 15, 24, 19, 2, 23, 52, 13709 }, // Ũ
+    { 14, 20, 16, 1, 19, 65, 13761 }, // ũ
+    { 15, 23, 19, 2, 22, 48, 13826 }, // Ū
+    { 14, 19, 16, 1, 18, 60, 13874 }, // ū
+    { 15, 25, 19, 2, 24, 49, 13934 }, // Ŭ
+    { 14, 21, 16, 1, 20, 64, 13983 }, // ŭ
+    { 15, 26, 19, 2, 25, 53, 14047 }, // Ů
+    { 14, 22, 16, 1, 21, 65, 14100 }, // ů
+    { 15, 25, 19, 2, 24, 52, 14165 }, // Ű
+    { 14, 21, 16, 1, 20, 65, 14217 }, // ű
+    { 15, 24, 19, 2, 18, 49, 14282 }, // Ų
+    { 14, 20, 16, 1, 14, 64, 14331 }, // ų
+    { 25, 24, 26, 0, 24, 106, 14395 }, // Ŵ
+    { 22, 20, 23, 0, 20, 85, 14501 }, // ŵ
+    { 16, 24, 17, 0, 24, 53, 14586 }, // Ŷ
+    { 15, 26, 16, 0, 20, 66, 14639 }, // ŷ
+    { 16, 23, 17, 0, 23, 54, 14705 }, // Ÿ
+    { 14, 24, 15, 0, 24, 51, 14759 }, // Ź
+    { 12, 20, 13, 0, 20, 39, 14810 }, // ź
+    { 14, 24, 15, 0, 24, 53, 14849 }, // Ż
+    { 12, 20, 13, 0, 20, 39, 14902 }, // ż
+    { 14, 24, 15, 0, 24, 55, 14941 }, // Ž
+    { 12, 20, 13, 0, 20, 43, 14996 }, // ž
+    { 10, 20, 12, 1, 20, 31, 15039 }, // ſ
+    { 21, 20, 23, 1, 19, 66, 15070 }, // Ơ
+    { 17, 17, 19, 1, 16, 50, 15136 }, // ơ
+    { 26, 20, 28, 1, 19, 79, 15186 }, // Ƣ
+    { 21, 20, 23, 1, 14, 76, 15265 }, // ƣ
+    { 18, 18, 19, 0, 18, 52, 15341 }, // Ƥ
+    { 14, 26, 16, 1, 20, 57, 15393 }, // ƥ
+    { 15, 21, 18, 2, 18, 52, 15450 }, // Ʀ
+    { 12, 20, 14, 1, 19, 44, 15502 }, // Ƨ
+    { 11, 15, 13, 1, 14, 34, 15546 }, // ƨ
+    { 14, 18, 15, 0, 18, 41, 15580 }, // Ʃ
+    { 13, 26, 13, -1, 20, 45, 15621 }, // ƪ
+    { 11, 23, 12, 0, 17, 40, 15666 }, // ƫ
+    { 15, 18, 16, 0, 18, 43, 15706 }, // Ƭ
+    { 11, 21, 12, 0, 20, 37, 15749 }, // ƭ
+    { 14, 24, 15, 0, 18, 54, 15786 }, // Ʈ
+    { 21, 20, 24, 2, 19, 53, 15840 }, // Ư
+    { 19, 17, 21, 1, 16, 62, 15893 }, // ư
+    { 8, 5, 0, -14, 20, 7, 15955 }, // ̀
+    { 9, 5, 0, -10, 20, 9, 15962 }, // ́
+    { 11, 5, 6, -6, 20, 10, 15971 }, // ̂
+    { 11, 4, 0, -14, 19, 15, 15981 }, // ̃
+    { 10, 3, 6, -5, 18, 8, 15996 }, // ̄
+    { 12, 4, 7, -6, 22, 11, 16004 }, // ̅
+    { 11, 5, 7, -5, 20, 13, 16015 }, // ̆
+    { 6, 5, 4, -3, 20, 6, 16028 }, // ̇
+    { 10, 4, 6, -5, 19, 13, 16034 }, // ̈
+    { 7, 7, 0, -11, 21, 12, 16047 }, // ̉
+    { 7, 6, 4, -4, 21, 14, 16059 }, // ̊
+    { 11, 5, 8, -4, 20, 15, 16073 }, // ̋
+    { 12, 5, 7, -6, 20, 11, 16088 }, // ̌
+    { 4, 6, 3, -2, 20, 9, 16099 }, // ̍
+    { 8, 6, 5, -4, 20, 14, 16108 }, // ̎
+    { 12, 5, 0, -15, 20, 13, 16122 }, // ̏
+    { 10, 7, 6, -5, 22, 22, 16135 }, // ̐
+    { 10, 5, 6, -5, 20, 13, 16157 }, // ̑
+    { 6, 7, 4, -3, 18, 12, 16170 }, // ̒
+    { 6, 7, 4, -3, 18, 11, 16182 }, // ̓
+    { 6, 7, 4, -3, 18, 11, 16193 }, // ̔
+    { 6, 7, 4, -3, 18, 11, 16204 }, // ̕
+    { 9, 5, 5, -5, 0, 8, 16215 }, // ̖
+    { 8, 5, 5, -4, 0, 7, 16223 }, // ̗
+    { 6, 6, 4, -3, 0, 9, 16230 }, // ̘
+    { 6, 6, 4, -3, 0, 9, 16239 }, // ̙
+    { 7, 6, 8, 0, 19, 12, 16248 }, // ̚
+    { 7, 6, 5, -3, 19, 10, 16260 }, // ̛
+    { 4, 6, 3, -2, 0, 10, 16270 }, // ̜
+    { 6, 5, 4, -3, -1, 7, 16280 }, // ̝
+    { 6, 5, 4, -3, -1, 7, 16287 }, // ̞
+    { 6, 6, 4, -3, 0, 9, 16294 }, // ̟
+    { 6, 3, 4, -3, -2, 5, 16303 }, // ̠
+    { 6, 8, 1, -6, 2, 11, 16308 }, // ̡
+    { 6, 8, 7, 0, 2, 11, 16319 }, // ̢
+    { 5, 5, 0, -11, -1, 8, 16330 }, // ̣
+    { 10, 4, 6, -5, -1, 13, 16338 }, // ̤
+    { 7, 6, 4, -4, 0, 14, 16351 }, // ̥
+    { 6, 5, 4, -3, -1, 9, 16365 }, // ̦
+    { 6, 6, 4, -3, 0, 10, 16374 }, // ̧
+    { 6, 7, 4, -3, 1, 13, 16384 }, // ̨
+    { 4, 6, 3, -2, 0, 9, 16397 }, // ̩
+    { 10, 5, 6, -5, -1, 14, 16406 }, // ̪
+    { 10, 4, 6, -5, -1, 13, 16420 }, // ̫
+    { 11, 5, 7, -5, 0, 12, 16433 }, // ̬
+    { 11, 5, 6, -6, 0, 10, 16445 }, // ̭
+    { 10, 5, 6, -5, 0, 14, 16455 }, // ̮
+    { 10, 5, 6, -5, -1, 13, 16469 }, // ̯
+    { 12, 4, 7, -6, -1, 13, 16482 }, // ̰
+    { 10, 3, 6, -5, -2, 8, 16495 }, // ̱
+    { 12, 2, 7, -6, -2, 4, 16503 }, // ̲
+    { 11, 6, 6, -6, 0, 21, 16507 }, // ̳
+    { 11, 4, 7, -5, 9, 14, 16528 }, // ̴
+    { 12, 4, 7, -6, 9, 11, 16542 }, // ̵
+    { 20, 4, 11, -10, 9, 17, 16553 }, // ̶
+    { 10, 8, 6, -5, 11, 12, 16570 }, // ̷
+    { 12, 21, 7, -6, 19, 40, 16582 }, // ̸
+    { 4, 6, 3, -2, 0, 10, 16622 }, // ̹
+    { 10, 5, 6, -5, -1, 15, 16632 }, // ̺
+    { 10, 6, 6, -5, 0, 22, 16647 }, // ̻
+    { 10, 4, 6, -5, -1, 13, 16669 }, // ̼
+    { 6, 6, 4, -3, 20, 14, 16682 }, // ̽
+    { 4, 8, 3, -2, 22, 12, 16696 }, // ̾
+    { 11, 6, 6, -6, 25, 21, 16708 }, // ̿
+    { 8, 5, 3, -6, 20, 6, 16729 }, // ̀
+    { 8, 5, 7, -2, 20, 7, 16735 }, // ́
+    { 11, 4, 7, -5, 19, 13, 16742 }, // ͂
+    { 5, 6, 3, -3, 20, 10, 16755 }, // ̓
+    { 14, 5, 9, -6, 20, 22, 16765 }, // ̈́
+    { 5, 5, 5, -1, -1, 7, 16787 }, // ͅ
+    { 12, 6, 7, -6, 20, 16, 16794 }, // ͆
+    { 11, 6, 6, -6, 0, 21, 16810 }, // ͇
+    { 8, 6, 5, -4, 0, 14, 16831 }, // ͈
+    { 6, 5, 4, -3, -1, 11, 16845 }, // ͉
+    { 10, 6, 6, -5, 20, 17, 16856 }, // ͊
+    { 10, 11, 6, -5, 24, 24, 16873 }, // ͋
+    { 10, 7, 6, -5, 22, 21, 16897 }, // ͌
+    { 10, 6, 6, -5, 0, 12, 16918 }, // ͍
+    { 6, 6, 4, -3, 0, 6, 16930 }, // ͎
+    { 18, 18, 10, -9, 18, 75, 16936 }, // ͏
+    { 5, 6, 3, -3, 20, 8, 17011 }, // ͐
+    { 4, 7, 3, -2, 21, 10, 17019 }, // ͑
+    { 10, 7, 6, -5, 22, 17, 17029 }, // ͒
+    { 6, 6, 4, -3, 0, 10, 17046 }, // ͓
+    { 5, 5, 3, -3, -1, 9, 17056 }, // ͔
+    { 5, 5, 3, -3, -1, 9, 17065 }, // ͕
+    { 10, 5, 6, -5, -1, 19, 17074 }, // ͖
+    { 4, 7, 3, -2, 21, 9, 17093 }, // ͗
+    { 5, 5, 8, 2, 20, 7, 17102 }, // ͘
+    { 6, 6, 4, -3, 0, 11, 17109 }, // ͙
+    { 10, 6, 6, -5, 0, 19, 17120 }, // ͚
+    { 6, 6, 4, -3, 20, 9, 17139 }, // ͛
+    { 20, 5, 11, -10, -1, 19, 17148 }, // ͜
+    { 20, 5, 11, -10, 20, 19, 17167 }, // ͝
+    { 16, 2, 9, -8, 17, 11, 17186 }, // ͞
+    { 16, 2, 9, -8, -2, 11, 17197 }, // ͟
+    { 20, 4, 11, -10, 19, 21, 17208 }, // ͠
+    { 20, 6, 11, -10, 22, 21, 17229 }, // ͡
+    { 21, 6, 12, -10, 0, 22, 17250 }, // ͢
+    { 6, 7, 4, -3, 22, 13, 17272 }, // ͣ
+    { 7, 7, 5, -3, 22, 15, 17285 }, // ͤ
+    { 3, 9, 3, -1, 24, 12, 17300 }, // ͥ
+    { 7, 7, 5, -3, 22, 16, 17312 }, // ͦ
+    { 7, 6, 5, -3, 21, 17, 17328 }, // ͧ
+    { 6, 7, 4, -3, 22, 12, 17345 }, // ͨ
+    { 6, 9, 4, -3, 24, 17, 17357 }, // ͩ
+    { 7, 9, 5, -3, 24, 22, 17374 }, // ͪ
+    { 10, 7, 6, -5, 22, 25, 17396 }, // ͫ
+    { 5, 7, 4, -2, 22, 12, 17421 }, // ͬ
+    { 5, 8, 4, -2, 23, 12, 17433 }, // ͭ
+    { 7, 6, 5, -3, 21, 15, 17445 }, // ͮ
+    { 8, 6, 5, -4, 21, 15, 17460 }, // ͯ
+    { 18, 18, 19, 0, 18, 55, 17475 }, // Α
+    { 14, 18, 17, 2, 18, 46, 17530 }, // Β
+    { 10, 18, 13, 2, 18, 22, 17576 }, // Γ
+    { 17, 18, 18, 0, 18, 50, 17598 }, // Δ
+    { 11, 18, 14, 2, 18, 34, 17648 }, // Ε
+    { 14, 18, 15, 0, 18, 42, 17682 }, // Ζ
+    { 15, 18, 19, 2, 18, 33, 17724 }, // Η
+    { 18, 20, 20, 1, 19, 68, 17757 }, // Θ
+    { 9, 18, 10, 0, 18, 23, 17825 }, // Ι
+    { 15, 18, 18, 2, 18, 46, 17848 }, // Κ
+    { 17, 18, 18, 0, 18, 51, 17894 }, // Λ
+    { 20, 18, 24, 2, 18, 82, 17945 }, // Μ
+    { 17, 18, 20, 2, 18, 66, 18027 }, // Ν
+    { 14, 18, 16, 1, 18, 40, 18093 }, // Ξ
+    { 18, 20, 20, 1, 19, 58, 18133 }, // Ο
+    { 15, 18, 19, 2, 18, 41, 18191 }, // Π
+    { 13, 18, 16, 2, 18, 42, 18232 }, // Ρ
+    { 14, 18, 15, 0, 18, 41, 18274 }, // Σ
+    { 14, 18, 15, 0, 18, 41, 18315 }, // Τ
+    { 16, 18, 17, 0, 18, 40, 18356 }, // Υ
+    { 21, 19, 23, 1, 18, 69, 18396 }, // Φ
+    { 17, 18, 18, 0, 18, 52, 18465 }, // Χ
+    { 18, 18, 22, 2, 18, 70, 18517 }, // Ψ
+    { 19, 19, 20, 0, 19, 57, 18587 }, // Ω
+    { 15, 15, 17, 1, 14, 44, 18644 }, // α
+    { 14, 26, 16, 1, 20, 70, 18688 }, // β
+    { 14, 20, 15, 0, 14, 56, 18758 }, // γ
+    { 15, 21, 16, 0, 20, 55, 18814 }, // δ
+    { 12, 15, 13, 0, 14, 36, 18869 }, // ε
+    { 12, 25, 14, 1, 19, 42, 18905 }, // ζ
+    { 14, 20, 16, 1, 14, 61, 18947 }, // η
+    { 14, 21, 16, 1, 20, 54, 19008 }, // θ
+    { 9, 15, 11, 1, 14, 24, 19062 }, // ι
+    { 15, 14, 17, 1, 14, 43, 19086 }, // κ
+    { 15, 21, 16, 0, 20, 51, 19129 }, // λ
+    { 16, 20, 18, 1, 14, 60, 19180 }, // μ
+    { 14, 14, 15, 0, 14, 41, 19240 }, // ν
+    { 12, 25, 14, 1, 19, 50, 19281 }, // ξ
+    { 14, 15, 16, 1, 14, 41, 19331 }, // ο
+    { 18, 15, 19, 0, 14, 52, 19372 }, // π
+    { 14, 20, 16, 1, 14, 57, 19424 }, // ρ
+    { 12, 20, 14, 1, 14, 35, 19481 }, // ς
+    { 15, 15, 17, 1, 14, 43, 19516 }, // σ
+    { 13, 15, 14, 0, 14, 36, 19559 }, // τ
+    { 14, 15, 16, 1, 14, 46, 19595 }, // υ
+    { 19, 25, 21, 1, 19, 76, 19641 }, // φ
+    { 16, 21, 17, 0, 14, 58, 19717 }, // χ
+    { 19, 25, 21, 1, 19, 85, 19775 }, // ψ
+    { 20, 15, 22, 1, 14, 59, 19860 }, // ω
+    { 18, 24, 19, 0, 18, 66, 19919 }, // Ạ
+    { 13, 20, 15, 1, 14, 48, 19985 }, // ạ
+    { 18, 25, 19, 0, 25, 71, 20033 }, // Ả
+    { 13, 22, 15, 1, 21, 53, 20104 }, // ả
+    { 18, 25, 19, 0, 25, 75, 20157 }, // Ấ
+    { 15, 22, 17, 1, 21, 58, 20232 }, // ấ
+    { 18, 25, 19, 0, 25, 75, 20290 }, // Ầ
+    { 15, 22, 15, -1, 21, 57, 20365 }, // ầ
+    { 18, 26, 19, 0, 26, 78, 20422 }, // Ẩ
+    { 14, 23, 16, 1, 22, 60, 20500 }, // ẩ
+    { 18, 27, 19, 0, 27, 82, 20560 }, // Ẫ
+    { 13, 24, 15, 1, 23, 61, 20642 }, // ẫ
+    { 18, 30, 19, 0, 24, 80, 20703 }, // Ậ
+    { 13, 26, 15, 1, 20, 62, 20783 }, // ậ
+    { 18, 26, 19, 0, 26, 77, 20845 }, // Ắ
+    { 13, 23, 15, 1, 22, 57, 20922 }, // ắ
+    { 18, 26, 19, 0, 26, 76, 20979 }, // Ằ
+    { 13, 23, 15, 1, 22, 56, 21055 }, // ằ
+    { 18, 27, 19, 0, 27, 79, 21111 }, // Ẳ
+    { 13, 23, 15, 1, 22, 57, 21190 }, // ẳ
+    { 18, 27, 19, 0, 27, 83, 21247 }, // Ẵ
+    { 13, 24, 15, 1, 23, 63, 21330 }, // ẵ
+    { 18, 30, 19, 0, 24, 83, 21393 }, // Ặ
+    { 13, 26, 15, 1, 20, 61, 21476 }, // ặ
+    { 11, 24, 14, 2, 18, 41, 21537 }, // Ẹ
+    { 13, 20, 15, 1, 14, 45, 21578 }, // ẹ
+    { 11, 25, 14, 2, 25, 47, 21623 }, // Ẻ
+    { 13, 22, 15, 1, 21, 50, 21670 }, // ẻ
+    { 11, 23, 14, 2, 23, 49, 21720 }, // Ẽ
+    { 13, 20, 15, 1, 19, 52, 21769 }, // ẽ
+    { 13, 25, 16, 2, 25, 60, 21821 }, // Ế
+    { 15, 22, 17, 1, 21, 59, 21881 }, // ế
+    { 15, 25, 14, -2, 25, 59, 21940 }, // Ề
+    { 15, 22, 15, -1, 21, 57, 21999 }, // ề
+    { 12, 26, 15, 2, 26, 58, 22056 }, // Ể
+    { 14, 23, 16, 1, 22, 62, 22114 }, // ể
+    { 11, 27, 14, 2, 27, 57, 22176 }, // Ễ
+    { 13, 24, 15, 1, 23, 59, 22233 }, // ễ
+    { 11, 30, 14, 2, 24, 53, 22292 }, // Ệ
+    { 13, 26, 15, 1, 20, 59, 22345 }, // ệ
+    { 9, 25, 10, 0, 25, 34, 22404 }, // Ỉ
+    { 6, 21, 8, 1, 21, 34, 22438 }, // ỉ
+    { 9, 24, 10, 0, 18, 31, 22472 }, // Ị
+    { 5, 26, 7, 1, 20, 36, 22503 }, // ị
+    { 18, 25, 20, 1, 19, 67, 22539 }, // Ọ
+    { 14, 20, 16, 1, 14, 50, 22606 }, // ọ
+    { 18, 26, 20, 1, 25, 71, 22656 }, // Ỏ
+    { 14, 22, 16, 1, 21, 56, 22727 }, // ỏ
+    { 18, 26, 20, 1, 25, 78, 22783 }, // Ố
+    { 15, 22, 17, 1, 21, 62, 22861 }, // ố
+    { 18, 26, 20, 1, 25, 77, 22923 }, // Ồ
+    { 16, 22, 16, -1, 21, 61, 23000 }, // ồ
+    { 18, 27, 20, 1, 26, 80, 23061 }, // Ổ
+    { 14, 23, 16, 1, 22, 62, 23141 }, // ổ
+    { 18, 28, 20, 1, 27, 85, 23203 }, // Ỗ
+    { 14, 24, 16, 1, 23, 63, 23288 }, // ỗ
+    { 18, 30, 20, 1, 24, 80, 23351 }, // Ộ
+    { 14, 26, 16, 1, 20, 61, 23431 }, // ộ
+    { 21, 25, 23, 1, 24, 78, 23492 }, // Ớ
+    { 17, 21, 19, 1, 20, 59, 23570 }, // ớ
+    { 21, 25, 23, 1, 24, 78, 23629 }, // Ờ
+    { 17, 21, 19, 1, 20, 58, 23707 }, // ờ
+    { 21, 26, 23, 1, 25, 83, 23765 }, // Ở
+    { 17, 22, 19, 1, 21, 66, 23848 }, // ở
+    { 21, 24, 23, 1, 23, 81, 23914 }, // Ỡ
+    { 17, 20, 19, 1, 19, 63, 23995 }, // ỡ
+    { 21, 25, 23, 1, 19, 77, 24058 }, // Ợ
+    { 17, 22, 19, 1, 16, 60, 24135 }, // ợ
+    { 15, 24, 19, 2, 18, 46, 24195 }, // Ụ
+    { 14, 20, 16, 1, 14, 60, 24241 }, // ụ
+    { 15, 26, 19, 2, 25, 51, 24301 }, // Ủ
+    { 14, 22, 16, 1, 21, 65, 24352 }, // ủ
+    { 21, 25, 24, 2, 24, 63, 24417 }, // Ứ
+    { 19, 21, 21, 1, 20, 72, 24480 }, // ứ
+    { 21, 25, 24, 2, 24, 64, 24552 }, // Ừ
+    { 19, 21, 21, 1, 20, 70, 24616 }, // ừ
+    { 21, 26, 24, 2, 25, 67, 24686 }, // Ử
+    { 19, 22, 21, 1, 21, 74, 24753 }, // ử
+    { 21, 24, 24, 2, 23, 70, 24827 }, // Ữ
+    { 19, 20, 21, 1, 19, 76, 24897 }, // ữ
+    { 21, 25, 24, 2, 19, 64, 24973 }, // Ự
+    { 19, 22, 21, 1, 16, 72, 25037 }, // ự
+    { 16, 24, 17, 0, 24, 51, 25109 }, // Ỳ
+    { 15, 26, 16, 0, 20, 64, 25160 }, // ỳ
+    { 16, 24, 17, 0, 18, 51, 25224 }, // Ỵ
+    { 15, 20, 16, 0, 14, 60, 25275 }, // ỵ
+    { 16, 25, 17, 0, 25, 54, 25335 }, // Ỷ
+    { 15, 27, 16, 0, 21, 68, 25389 }, // ỷ
+    { 16, 23, 17, 0, 23, 55, 25457 }, // Ỹ
+    { 15, 25, 16, 0, 19, 69, 25512 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 25581 }, //  
+    { 0, 0, 25, 0, 0, 0, 25581 }, //  
+    { 0, 0, 13, 0, 0, 0, 25581 }, //  
+    { 0, 0, 25, 0, 0, 0, 25581 }, //  
+    { 0, 0, 8, 0, 0, 0, 25581 }, //  
+    { 0, 0, 6, 0, 0, 0, 25581 }, //  
+    { 0, 0, 4, 0, 0, 0, 25581 }, //  
+    { 0, 0, 14, 0, 0, 0, 25581 }, //  
+    { 0, 0, 7, 0, 0, 0, 25581 }, //  
+    { 0, 0, 4, 0, 0, 0, 25581 }, //  
+    { 0, 0, 3, 0, 0, 0, 25581 }, //  
+    { 0, 0, 1, 0, 0, 0, 25581 }, // ​
+    { 0, 0, 1, 0, 0, 0, 25581 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 25581 }, // ‍
+    { 7, 22, 7, -1, 18, 35, 25581 }, // ‎
+    { 7, 22, 2, -6, 18, 35, 25616 }, // ‏
+    { 8, 4, 9, 0, 9, 10, 25651 }, // ‐
+    { 8, 4, 9, 0, 9, 10, 25661 }, // ‑
+    { 13, 4, 15, 1, 11, 12, 25671 }, // ‒
+    { 12, 4, 13, 0, 9, 12, 25683 }, // –
+    { 25, 4, 26, 0, 9, 21, 25695 }, // —
+    { 25, 4, 26, 0, 9, 21, 25716 }, // ―
+    { 10, 25, 14, 2, 19, 64, 25737 }, // ‖
+    { 12, 6, 12, -1, 0, 23, 25801 }, // ‗
+    { 6, 7, 7, 0, 18, 12, 25824 }, // ‘
+    { 6, 7, 7, 0, 18, 12, 25836 }, // ’
+    { 6, 7, 7, 0, 4, 11, 25848 }, // ‚
+    { 6, 7, 7, 0, 18, 11, 25859 }, // ‛
+    { 11, 7, 12, 0, 18, 23, 25870 }, // “
+    { 11, 7, 12, 0, 18, 22, 25893 }, // ”
+    { 12, 7, 13, 0, 3, 22, 25915 }, // „
+    { 11, 7, 12, 0, 18, 22, 25937 }, // ‟
+    { 11, 19, 13, 1, 19, 34, 25959 }, // †
+    { 11, 19, 13, 1, 19, 38, 25993 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 26031 }, // •
+    { 9, 10, 11, 1, 14, 19, 26047 }, // ‣
+    { 5, 5, 13, 4, 4, 7, 26066 }, // ․
+    { 13, 5, 15, 1, 4, 16, 26073 }, // ‥
+    { 19, 5, 21, 1, 4, 24, 26089 }, // …
+    { 5, 5, 7, 1, 9, 9, 26113 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 26122 }, //  
+    { 0, 0, 15, 0, 0, 0, 26122 }, //  
+    { 7, 20, 7, -1, 16, 29, 26122 }, // ‪
+    { 7, 20, 2, -6, 16, 29, 26151 }, // ‫
+    { 6, 22, 4, -3, 18, 28, 26180 }, // ‬
+    { 6, 22, 4, -3, 18, 29, 26208 }, // ‭
+    { 6, 22, 4, -3, 18, 29, 26237 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 26266 }, //  
+    { 32, 20, 33, 0, 19, 121, 26266 }, // ‰
+    { 41, 20, 42, 0, 19, 151, 26387 }, // ‱
+    { 7, 7, 9, 1, 18, 12, 26538 }, // ′
+    { 13, 7, 15, 1, 18, 22, 26550 }, // ″
+    { 18, 7, 20, 1, 18, 34, 26572 }, // ‴
+    { 7, 7, 11, 1, 18, 11, 26606 }, // ‵
+    { 13, 7, 16, 1, 18, 23, 26617 }, // ‶
+    { 18, 7, 22, 1, 18, 33, 26640 }, // ‷
+    { 10, 9, 11, 0, 3, 20, 26673 }, // ‸
+    { 9, 12, 10, 0, 13, 19, 26693 }, // ‹
+    { 9, 12, 10, 0, 13, 18, 26712 }, // ›
+    { 19, 20, 21, 1, 19, 70, 26730 }, // ※
+    { 12, 19, 14, 1, 18, 53, 26800 }, // ‼
+    { 12, 20, 13, 0, 19, 36, 26853 }, // ‽
+    { 14, 3, 14, -1, 22, 12, 26889 }, // ‾
+    { 15, 6, 16, 0, 0, 17, 26901 }, // ‿
+    { 15, 6, 16, 0, 20, 18, 26918 }, // ⁀
+    { 11, 17, 12, 0, 11, 33, 26936 }, // ⁁
+    { 28, 23, 29, 0, 19, 109, 26969 }, // ⁂
+    { 7, 4, 9, 1, 9, 9, 27078 }, // ⁃
+    { 14, 18, 10, -5, 18, 38, 27087 }, // ⁄
+    { 7, 22, 9, 1, 18, 40, 27125 }, // ⁅
+    { 7, 22, 8, 0, 18, 47, 27165 }, // ⁆
+    { 24, 20, 25, 0, 19, 70, 27212 }, // ⁇
+    { 18, 20, 19, 0, 19, 63, 27282 }, // ⁈
+    { 18, 20, 20, 1, 19, 64, 27345 }, // ⁉
+    { 13, 14, 15, 1, 14, 30, 27409 }, // ⁊
+    { 14, 23, 16, 1, 19, 58, 27439 }, // ⁋
+    { 14, 13, 16, 1, 14, 38, 27497 }, // ⁌
+    { 14, 13, 17, 2, 14, 40, 27535 }, // ⁍
+    { 13, 12, 14, 0, 7, 34, 27575 }, // ⁎
+    { 6, 18, 8, 1, 14, 19, 27609 }, // ⁏
+    { 15, 26, 16, 0, 20, 48, 27628 }, // ⁐
+    { 13, 25, 14, 0, 19, 69, 27676 }, // ⁑
+    { 11, 20, 12, 0, 19, 42, 27745 }, // ⁒
+    { 24, 5, 26, 1, 10, 24, 27787 }, // ⁓
+    { 15, 6, 16, 0, 0, 20, 27811 }, // ⁔
+    { 14, 13, 15, 0, 13, 38, 27831 }, // ⁕
+    { 13, 20, 15, 1, 19, 31, 27869 }, // ⁖
+    { 23, 7, 25, 1, 18, 44, 27900 }, // ⁗
+    { 20, 20, 22, 1, 19, 43, 27944 }, // ⁘
+    { 20, 20, 22, 1, 19, 53, 27987 }, // ⁙
+    { 5, 20, 7, 1, 19, 17, 28040 }, // ⁚
+    { 15, 21, 17, 1, 20, 43, 28057 }, // ⁛
+    { 21, 20, 22, 0, 19, 80, 28100 }, // ⁜
+    { 5, 20, 7, 1, 19, 25, 28180 }, // ⁝
+    { 5, 20, 7, 1, 19, 33, 28205 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 28238 }, //  
+    { 0, 0, 15, 0, 0, 0, 28238 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 28238 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 28238 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 28238 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 28238 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 28238 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 28238 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 28238 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 28238 }, // ⁩
+    { 6, 22, 4, -3, 18, 31, 28238 }, // ⁪
+    { 6, 22, 4, -3, 18, 28, 28269 }, // ⁫
+    { 6, 22, 4, -3, 18, 31, 28297 }, // ⁬
+    { 6, 22, 4, -3, 18, 31, 28328 }, // ⁭
+    { 6, 22, 4, -3, 18, 34, 28359 }, // ⁮
+    { 6, 22, 4, -3, 18, 31, 28393 }, // ⁯
+    { 9, 12, 10, 0, 22, 28, 28424 }, // ⁰
+    { 3, 12, 5, 1, 19, 14, 28452 }, // ⁱ
+    { 10, 12, 11, 0, 22, 25, 28466 }, // ⁴
+    { 8, 12, 10, 1, 22, 26, 28491 }, // ⁵
+    { 9, 12, 10, 0, 22, 28, 28517 }, // ⁶
+    { 9, 12, 10, 0, 22, 19, 28545 }, // ⁷
+    { 9, 12, 10, 0, 22, 31, 28564 }, // ⁸
+    { 9, 12, 10, 0, 22, 30, 28595 }, // ⁹
+    { 9, 8, 10, 0, 19, 16, 28625 }, // ⁺
+    { 9, 2, 10, 0, 16, 4, 28641 }, // ⁻
+    { 9, 6, 10, 0, 18, 20, 28645 }, // ⁼
+    { 5, 15, 7, 1, 23, 22, 28665 }, // ⁽
+    { 5, 15, 6, 0, 23, 22, 28687 }, // ⁾
+    { 9, 9, 11, 1, 16, 24, 28709 }, // ⁿ
+    { 9, 12, 10, 0, 8, 28, 28733 }, // ₀
+    { 7, 12, 10, 0, 8, 17, 28761 }, // ₁
+    { 9, 12, 10, 0, 8, 24, 28778 }, // ₂
+    { 9, 12, 10, 0, 8, 27, 28802 }, // ₃
+    { 10, 12, 11, 0, 8, 25, 28829 }, // ₄
+    { 8, 12, 10, 1, 8, 26, 28854 }, // ₅
+    { 9, 12, 10, 0, 8, 28, 28880 }, // ₆
+    { 9, 12, 10, 0, 8, 19, 28908 }, // ₇
+    { 9, 12, 10, 0, 8, 31, 28927 }, // ₈
+    { 9, 12, 10, 0, 8, 30, 28958 }, // ₉
+    { 9, 8, 10, 0, 6, 16, 28988 }, // ₊
+    { 9, 2, 10, 0, 3, 4, 29004 }, // ₋
+    { 9, 6, 10, 0, 5, 20, 29008 }, // ₌
+    { 5, 15, 7, 1, 9, 22, 29028 }, // ₍
+    { 5, 15, 6, 0, 9, 22, 29050 }, // ₎
+    { 9, 9, 10, 0, 6, 25, 29072 }, // ₐ
+    { 9, 9, 10, 0, 6, 23, 29097 }, // ₑ
+    { 10, 9, 11, 0, 6, 25, 29120 }, // ₒ
+    { 10, 9, 11, 0, 6, 24, 29145 }, // ₓ
+    { 9, 9, 10, 0, 6, 22, 29169 }, // ₔ
+    { 9, 12, 11, 1, 9, 27, 29191 }, // ₕ
+    { 10, 12, 12, 1, 9, 36, 29218 }, // ₖ
+    { 3, 12, 5, 1, 9, 13, 29254 }, // ₗ
+    { 14, 9, 16, 1, 6, 37, 29267 }, // ₘ
+    { 9, 9, 11, 1, 6, 23, 29304 }, // ₙ
+    { 9, 12, 11, 1, 6, 27, 29327 }, // ₚ
+    { 8, 9, 9, 0, 6, 19, 29354 }, // ₛ
+    { 7, 11, 8, 0, 8, 19, 29373 }, // ₜ
+    { 14, 19, 15, 0, 19, 53, 29392 }, // ₠
+    { 15, 21, 16, 0, 19, 75, 29445 }, // ₡
+    { 14, 20, 15, 0, 19, 53, 29520 }, // ₢
+    { 13, 18, 14, 0, 18, 43, 29573 }, // ₣
+    { 13, 19, 15, 1, 19, 41, 29616 }, // ₤
+    { 22, 20, 24, 1, 17, 81, 29657 }, // ₥
+    { 15, 18, 16, 0, 18, 69, 29738 }, // ₦
+    { 21, 19, 23, 1, 18, 71, 29807 }, // ₧
+    { 22, 19, 24, 1, 18, 82, 29878 }, // ₨
+    { 19, 18, 20, 0, 18, 81, 29960 }, // ₩
+    { 19, 18, 23, 2, 18, 100, 30041 }, // ₪
+    { 15, 23, 17, 1, 19, 58, 30141 }, // ₫
+    { 15, 19, 16, 0, 18, 47, 30199 }, // €
+    { 15, 18, 16, 0, 18, 54, 30246 }, // ₭
+    { 14, 18, 15, 0, 18, 45, 30300 }, // ₮
+    { 25, 25, 26, 0, 19, 99, 30345 }, // ₯
+    { 14, 25, 15, 0, 19, 64, 30444 }, // ₰
+    { 15, 18, 16, 0, 18, 55, 30508 }, // ₱
+    { 16, 21, 18, 1, 19, 68, 30563 }, // ₲
+    { 17, 18, 18, 0, 18, 60, 30631 }, // ₳
+    { 15, 20, 16, 0, 19, 51, 30691 }, // ₴
+    { 15, 21, 17, 1, 19, 64, 30742 }, // ₵
+    { 17, 18, 18, 0, 17, 59, 30806 }, // ₶
+    { 18, 21, 19, 0, 19, 69, 30865 }, // ₷
+    { 14, 18, 15, 0, 18, 42, 30934 }, // ₸
+    { 12, 18, 14, 1, 18, 34, 30976 }, // ₹
+    { 14, 19, 15, 0, 18, 52, 31010 }, // ₺
+    { 20, 20, 21, 0, 19, 70, 31062 }, // ₻
+    { 20, 18, 22, 1, 18, 58, 31132 }, // ₼
+    { 15, 18, 16, 0, 18, 47, 31190 }, // ₽
+    { 18, 20, 20, 1, 20, 77, 31237 }, // ₾
+    { 12, 24, 15, 2, 21, 58, 31314 }, // ₿
+    { 12, 19, 14, 1, 14, 40, 31372 }, // ⃀
+    { 13, 4, 15, 1, 11, 12, 31412 }, // −
+    { 23, 23, 25, 1, 19, 76, 31424 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
@@ -3543,4 +2791,5 @@ static const EpdFontData notosans_12_bold = {
     27,
     -8,
     true,
+    true,
 };
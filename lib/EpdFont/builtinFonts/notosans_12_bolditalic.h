@@ -2,3704 +2,2847 @@
  * generated by fontconvert.py
  * name: notosans_12_bolditalic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_bolditalicBitmaps[46590] = {
-    0x01, 0xFE, 0x02, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x7F, 0x80,
-    0xBF, 0x80, 0x7F, 0x00, 0x04, 0x00, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xE0, 0xF8,
-    0x7D, 0x1F, 0x47, 0xC1, 0xF0, 0x68, 0x1A, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x01, 0xF4, 0x3D,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0x43, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x2A, 0xFE, 0xBF, 0xA8, 0x00, 0x7D, 0x0F, 0x40, 0x00, 0x2F,
-    0x0B, 0xC0, 0x02, 0xAF, 0xEB, 0xFA, 0x41, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBC, 0x2F, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x1F, 0x47, 0xD0, 0x00, 0x0B, 0xC2, 0xF0, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x7F, 0x9D, 0x14, 0x07, 0xF2, 0xC0, 0x00, 0x7F, 0xBC,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x0F, 0x7F, 0x80, 0x00, 0xE3, 0xF8, 0x74, 0x1D, 0xBF, 0x47, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC,
-    0x01, 0xBF, 0xF9, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xE0, 0x0F, 0xFF, 0x80, 0x0F, 0xC0, 0x1F, 0xEF,
-    0xC0, 0x2F, 0x00, 0x3F, 0x0F, 0xC0, 0x7D, 0x00, 0x7F, 0x0F, 0xC0, 0xF8, 0x00, 0x7E, 0x0F, 0xC3,
-    0xF0, 0x00, 0xBD, 0x1F, 0x8B, 0xD0, 0x00, 0xBD, 0x3F, 0x5F, 0x8B, 0xE0, 0x7F, 0xBF, 0x3F, 0x7F,
-    0xFC, 0x3F, 0xFD, 0xFC, 0xFE, 0xFD, 0x1F, 0xF2, 0xF5, 0xFC, 0xBD, 0x00, 0x07, 0xE3, 0xF4, 0xBD,
-    0x00, 0x0F, 0xC3, 0xF0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0xFC, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x01,
-    0xF8, 0x03, 0xF7, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0xFE,
-    0x0F, 0xE0, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xA8,
-    0x03, 0xFF, 0xF0, 0x2F, 0xC0, 0xFF, 0xBF, 0x83, 0xF4, 0x2F, 0xD2, 0xFD, 0xFF, 0x03, 0xFC, 0x0F,
-    0xFF, 0xD0, 0x3F, 0x80, 0x7F, 0xF8, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xD3,
-    0xF0, 0xF8, 0x7D, 0x1F, 0x06, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0x80, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0F, 0xD0,
-    0x01, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x80, 0xBC, 0x00, 0x7E, 0x2F, 0x00, 0x2F, 0xFF, 0x95,
-    0x81, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0x05, 0x07, 0xF7, 0xE0, 0x03, 0xF4, 0xFC,
-    0x00, 0x28, 0x2F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF5, 0xAA,
-    0xFE, 0xA8, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0xBF, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x2E, 0x2F, 0xEF, 0xFA, 0xFC, 0x14, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x03, 0xFC, 0x2F, 0xD0, 0xBF, 0x40, 0xFD, 0x0F, 0xF0, 0x0F, 0xE1,
-    0xFD, 0x00, 0xFE, 0x2F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0xC0, 0x2F, 0xC3, 0xF8, 0x03,
-    0xFC, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x07, 0xF4, 0x3F, 0x80, 0xFF, 0x03, 0xFC, 0x2F, 0xE0, 0x2F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xFE, 0x07, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0xFD, 0xBF, 0x01, 0x83, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE,
-    0x00, 0x07, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD,
-    0x0F, 0xF4, 0x01, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x81, 0xFF,
-    0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0xD0, 0x2F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x5B, 0xFF, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x6F,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x49, 0x00, 0x1F, 0xF0, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x3F, 0xBF, 0x40, 0x02, 0xFD, 0xFC, 0x00, 0x1F, 0xCB, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x0F,
-    0xD0, 0xFD, 0x00, 0xFD, 0x07, 0xF4, 0x0B, 0xFA, 0xBF, 0xE8, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0x81, 0x55, 0x5F, 0xE4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xD0, 0x1F, 0xD5, 0x54, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE,
-    0x00, 0x7E, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x0F, 0xF0, 0x90, 0x02, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x69, 0x00,
-    0x3F, 0x7F, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0xBF, 0xE6, 0xFE, 0x0F, 0xF4, 0x0F, 0xF0, 0xFF, 0x00,
-    0xFF, 0x0F, 0xE0, 0x0F, 0xE0, 0xFF, 0x01, 0xFD, 0x0B, 0xF0, 0x3F, 0xC0, 0x7F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0x40, 0x55, 0x5B, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x1F, 0xFB, 0xFD, 0x03, 0xFC, 0x0F, 0xE0,
-    0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x2F, 0xC3, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x5F, 0xF0, 0x3F, 0xC0, 0x7F, 0x43, 0xF4, 0x03, 0xF8, 0x7F,
-    0x40, 0x3F, 0x87, 0xF8, 0x07, 0xF4, 0x3F, 0xFA, 0xFF, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xF8, 0x2F, 0xD0, 0xFF, 0x0F, 0xE0, 0x1F, 0xD7, 0xF4, 0x07, 0xF5, 0xFC, 0x02, 0xFD, 0x7F, 0x40,
-    0xFF, 0x1F, 0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x7F, 0xFB, 0xF8, 0x02, 0xA4, 0xFD, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0xC0, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0xF0, 0xBF, 0x81, 0xFD, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x2F, 0xE0, 0xFF, 0x82, 0xFC, 0x01, 0x40, 0x00,
-    0x00, 0x1F, 0x40, 0x1F, 0xF0, 0x0B, 0xF8, 0x01, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x03, 0xF8, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x02,
-    0xFE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF,
-    0xFD, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFD, 0x00, 0x2F, 0xFE, 0x01, 0xBF,
-    0xF4, 0x07, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x2F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x0E, 0x02, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x03, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE9, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFE, 0x9A, 0xFF, 0x40, 0x0B, 0xF4, 0x00, 0x0B, 0xF0,
-    0x0B, 0xF0, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0xFE, 0x0F, 0xC3, 0xF0, 0x2F, 0xFF, 0xC2, 0xF0,
-    0xF8, 0x2F, 0x83, 0xF0, 0xBC, 0x7D, 0x1F, 0x80, 0xF8, 0x2F, 0x2F, 0x0B, 0xC0, 0x7D, 0x0B, 0xCF,
-    0xC3, 0xF0, 0x2F, 0x03, 0xF3, 0xF0, 0xF8, 0x0F, 0xC1, 0xF4, 0xFC, 0x3F, 0x0B, 0xE0, 0xFC, 0x2F,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x0B, 0xD0, 0xFF, 0x8F, 0xFD, 0x00, 0xFC, 0x05, 0x40, 0x54, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x1D, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC,
-    0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x57, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x03,
-    0xFC, 0x07, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x0F,
-    0xF0, 0x6F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4,
-    0x01, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x02,
-    0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x0B, 0xF4, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01,
-    0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC,
-    0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF4, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F,
-    0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-    0x0F, 0xF4, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x01, 0xFC, 0x1F, 0xF0, 0x00,
-    0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F,
-    0xE0, 0xFF, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x03, 0xF4, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03,
-    0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x0F,
-    0xFE, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x0B, 0xEF, 0x80,
-    0x2F, 0xBF, 0x00, 0x3F, 0x7E, 0x00, 0xFE, 0xFC, 0x00, 0xFC, 0xFC, 0x0B, 0xDF, 0xE0, 0x07, 0xF3,
-    0xF0, 0x3F, 0x3F, 0x40, 0x2F, 0xCF, 0xC2, 0xF1, 0xFC, 0x00, 0xFE, 0x3F, 0x1F, 0x8B, 0xF0, 0x03,
-    0xF4, 0xFC, 0xFC, 0x2F, 0x80, 0x0F, 0xC3, 0xF7, 0xE0, 0xFE, 0x00, 0x7F, 0x0B, 0xFF, 0x03, 0xF4,
-    0x02, 0xF8, 0x2F, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0xBF, 0xC0, 0xBF, 0x00, 0x3F, 0x42, 0xFE, 0x03,
-    0xF8, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0,
-    0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07,
-    0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0,
-    0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F,
-    0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0,
-    0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4,
-    0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B,
-    0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFE, 0x5B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03,
-    0xFC, 0x02, 0xFD, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0xF9, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFA, 0xA4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFE, 0x42, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01,
-    0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00,
-    0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0xBF, 0xC0, 0xFF,
-    0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0x40, 0x7F, 0x82, 0xFE, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80,
-    0xFE, 0x03, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xD0, 0x03, 0xFC,
-    0x7F, 0x40, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x42, 0xFD, 0x02, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x3F, 0x80, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x06, 0x40, 0x7F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x06, 0x40, 0x3F,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x7F, 0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B,
-    0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0,
-    0x2F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F,
-    0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0xFF, 0x1F, 0xC0, 0x07, 0xF4, 0x7F, 0x00,
-    0x3F, 0xC1, 0xFC, 0x01, 0xFD, 0x03, 0xF0, 0x0F, 0xF0, 0x0F, 0xD0, 0x7F, 0x00, 0x3F, 0x43, 0xF8,
-    0x00, 0xFD, 0x1F, 0xC0, 0x03, 0xF4, 0xFE, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x2F, 0xBF, 0x80, 0x00,
-    0xBE, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF6, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xCB, 0xF0,
-    0x07, 0xFC, 0x00, 0xFE, 0x2F, 0xC0, 0x2F, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0xFF, 0xC0, 0x3F, 0xC2,
-    0xFC, 0x0B, 0xFF, 0x01, 0xFD, 0x0B, 0xF0, 0x3F, 0xBC, 0x0B, 0xF0, 0x2F, 0xC2, 0xFA, 0xF4, 0x3F,
-    0x40, 0x7F, 0x0F, 0xCB, 0xD2, 0xFC, 0x01, 0xFC, 0x7E, 0x2F, 0x4F, 0xE0, 0x07, 0xF3, 0xF4, 0xBD,
-    0x7F, 0x00, 0x1F, 0xDF, 0xC2, 0xF7, 0xF8, 0x00, 0x7F, 0xBD, 0x0B, 0xDF, 0xC0, 0x01, 0xFF, 0xF0,
-    0x2F, 0xBF, 0x00, 0x07, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF8,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x3F, 0xD0, 0x00, 0x0F, 0xE0, 0x7F, 0x80, 0x00,
-    0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x0B, 0xF0,
-    0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0x3F, 0xC0, 0x01, 0xFE, 0x00, 0xBF, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0xBF, 0x43, 0xF8, 0x07, 0xFC,
-    0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFD, 0xFF, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFA, 0x40, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0xBE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xEA, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xD0, 0x2F, 0x40, 0x7E, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x40,
-    0xBD, 0x02, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x06, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x0A, 0xFE, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xBC, 0x00, 0x0B,
-    0xD7, 0xD0, 0x00, 0xF8, 0x3E, 0x00, 0x3F, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0x00, 0xFC, 0x00, 0xF8,
-    0x3F, 0x00, 0x0F, 0xC2, 0x90, 0x00, 0x68, 0x2F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xF8,
-    0x1F, 0xC0, 0xBD, 0x02, 0xE0, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1,
-    0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B,
-    0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xE0, 0x03,
-    0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFD, 0x07, 0xFD, 0x2F, 0xE0, 0xBF, 0x40, 0xFF, 0x0F, 0xF0, 0x0F,
-    0xF0, 0xFE, 0x00, 0xFE, 0x0F, 0xD0, 0x0F, 0xE1, 0xFC, 0x02, 0xFD, 0x2F, 0xC0, 0x3F, 0xC3, 0xFE,
-    0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x7D, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0xF8, 0x3F, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0xFF, 0xC0, 0xFF,
-    0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xC0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFB, 0xF0,
-    0x01, 0xFF, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF, 0xAB, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xFE, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x81, 0xA4, 0x03, 0xFF, 0xDF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0x4F, 0xFC,
-    0x0F, 0xF0, 0x1F, 0xE0, 0x7F, 0x80, 0x7F, 0x42, 0xFD, 0x01, 0xFC, 0x0F, 0xF0, 0x0B, 0xF0, 0x3F,
-    0xC0, 0x3F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x1F, 0xF4, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x1F, 0xF3, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x50, 0x07, 0xFC,
-    0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xE0, 0x03, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0F,
-    0xF0, 0x03, 0xF8, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x01, 0xFD,
-    0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F,
-    0xD0, 0x07, 0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x3F, 0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00,
-    0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07,
-    0xF4, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x02, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0xBE, 0x00, 0x3F, 0x3F,
-    0xFC, 0x7F, 0xF8, 0x03, 0xFB, 0xFF, 0xEF, 0xFF, 0xC0, 0x7F, 0xE1, 0xFF, 0xD2, 0xFD, 0x0B, 0xFC,
-    0x0F, 0xF4, 0x1F, 0xD0, 0xFF, 0x00, 0xFF, 0x01, 0xFC, 0x0F, 0xF0, 0x1F, 0xD0, 0x2F, 0xC0, 0xFE,
-    0x02, 0xFC, 0x03, 0xFC, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x82, 0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x3F,
-    0xC0, 0x3F, 0x80, 0x7F, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x3F, 0x40, 0xBF, 0x00, 0xFF, 0x07,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFB, 0xFF, 0xE0,
-    0x7F, 0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0, 0xFE, 0x01,
-    0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F,
-    0x40, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xC3, 0xFC, 0x3F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03, 0xF7, 0xFC, 0x01, 0xFD,
-    0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x2F, 0x80, 0x03, 0xF7, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x7F, 0xD2, 0xFE, 0x02, 0xFD, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0x80,
-    0x3F, 0x80, 0xFD, 0x00, 0xFE, 0x07, 0xF0, 0x0B, 0xF4, 0x2F, 0xC0, 0x3F, 0xC0, 0xFF, 0x82, 0xFE,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xEF, 0xFF, 0x00, 0x7F, 0x2F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x46, 0x80, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x0F, 0xFC,
-    0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x00, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00,
-    0xFE, 0x0F, 0xF0, 0x1F, 0xD0, 0xFF, 0x03, 0xFD, 0x0B, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x01,
-    0xFF, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xA0, 0xBD, 0x03, 0xF7, 0xFC, 0x03, 0xFF,
-    0xFC, 0x07, 0xFF, 0xA8, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xE0, 0x14, 0x1F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x40, 0x0B, 0xF0, 0xBE, 0xBF, 0xF0, 0xBF, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0xBF, 0xE9, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B,
-    0xF4, 0x00, 0xBF, 0xED, 0x07, 0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90,
-    0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
-    0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF,
-    0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x2A, 0x8B, 0xF0, 0x07, 0xF8, 0x7F, 0x00, 0xFF, 0x07, 0xF0, 0x1F, 0xE0, 0x3F,
-    0x03, 0xFC, 0x03, 0xF4, 0x7F, 0x40, 0x3F, 0x4F, 0xF0, 0x03, 0xF5, 0xFD, 0x00, 0x3F, 0x6F, 0xC0,
-    0x02, 0xFB, 0xF4, 0x00, 0x2F, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x6A, 0x00, 0xAA, 0x00, 0xAA, 0x7F, 0x01, 0xFF, 0x01, 0xFD, 0x7F, 0x03, 0xFF, 0x02,
-    0xFC, 0x7F, 0x07, 0xFF, 0x03, 0xF4, 0x7F, 0x0B, 0xEF, 0x0B, 0xF0, 0x3F, 0x0F, 0xAF, 0x0F, 0xE0,
-    0x3F, 0x2F, 0x6F, 0x1F, 0xC0, 0x3F, 0x3F, 0x2F, 0x3F, 0x80, 0x3F, 0x7D, 0x2F, 0x7F, 0x00, 0x3F,
-    0xBC, 0x2F, 0xBE, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x2F, 0xD0, 0xBF,
-    0x80, 0x07, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x1F, 0xE7, 0xF4, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x0F,
-    0xF4, 0x07, 0xF8, 0x00, 0x01, 0xA8, 0x00, 0xAA, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x3F,
-    0xC0, 0x07, 0xF0, 0x1F, 0xE0, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x0F, 0xE2,
-    0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x1F, 0xBF, 0x40, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x7F, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFD, 0x00,
-    0x02, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBE, 0x00, 0x1B, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x1B, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBD, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x68, 0x00, 0x79, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0x90, 0x00, 0xBF,
-    0xC0, 0x06, 0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8,
-    0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x6F, 0xFF, 0xE6, 0xDB, 0xFF, 0xFF, 0xF6, 0x40, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x01, 0xFE, 0x02, 0xFE, 0x01, 0xFD, 0x00, 0x50, 0x00, 0x00, 0x01, 0x50, 0x03, 0xF0,
-    0x07, 0xF0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80,
-    0x7F, 0x80, 0xBF, 0x40, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0xBF, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFE, 0xF4, 0x2F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0xC0,
-    0x7F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x08, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x1A, 0xFE, 0xA8, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x3D, 0x69, 0x3D, 0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x1F,
-    0x81, 0xF8, 0x2F, 0x00, 0xBC, 0x2F, 0x00, 0xBC, 0x1F, 0x40, 0xFC, 0x0F, 0xEB, 0xF8, 0x3F, 0xFF,
-    0xFD, 0x3E, 0xBF, 0xBD, 0x08, 0x00, 0x14, 0x1F, 0xC0, 0x07, 0xF4, 0x7F, 0x40, 0x3F, 0xC0, 0xFD,
-    0x02, 0xFC, 0x02, 0xF8, 0x0F, 0xD0, 0x07, 0xF0, 0xFF, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x3F, 0x7F,
-    0x40, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xAF, 0xFF, 0xA0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x05, 0xBF, 0x95, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x15,
-    0xFE, 0x50, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x0B, 0xF5,
-    0x7C, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xF7,
-    0xFC, 0x03, 0xF0, 0x3F, 0x40, 0xFC, 0x0B, 0xD0, 0x3F, 0x43, 0xF0, 0x0B, 0xFF, 0xF4, 0x00, 0xBF,
-    0xF4, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x3D, 0x07, 0xFC, 0x0F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x1E, 0x3F, 0x4F, 0xCF, 0xC3, 0xF0,
-    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x69, 0x0B, 0xC0, 0xB4, 0x1F, 0xFF, 0x0B, 0x43, 0x81,
-    0xF4, 0x14, 0x0F, 0x1D, 0x0F, 0x40, 0x00, 0x2C, 0xB0, 0x3C, 0x00, 0x00, 0x77, 0xC1, 0xF0, 0x00,
-    0x00, 0xEF, 0x07, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x1D, 0x74, 0x3D, 0x00, 0x00, 0xB4,
-    0xE0, 0xBC, 0x00, 0x03, 0xC2, 0xC0, 0xBF, 0xF8, 0x2E, 0x03, 0xC0, 0x6F, 0x81, 0xF0, 0x07, 0xD0,
-    0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x9E, 0x0F, 0xFF, 0xD1, 0xF4, 0xBC, 0x3F, 0x07, 0xC3, 0xE0, 0xBC,
-    0x3D, 0x0F, 0x83, 0xE2, 0xF4, 0x3F, 0xFF, 0x00, 0xB8, 0xA0, 0x00, 0x10, 0x01, 0x00, 0x00, 0xF4,
-    0x1F, 0x40, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF4, 0xFF, 0x40, 0xBF, 0x4B, 0xF4,
-    0x03, 0xFC, 0x3F, 0xC0, 0x0B, 0xF0, 0xBF, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x2F, 0xC2, 0xFC, 0x00,
-    0x7F, 0x07, 0xF0, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xF5, 0xAA, 0xAA, 0xBD, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x0B, 0xE9, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x0F, 0x0A, 0x94, 0x0B,
-    0xC0, 0xB4, 0x3F, 0xFD, 0x0B, 0x43, 0x80, 0xF1, 0xBC, 0x0F, 0x1D, 0x03, 0xC0, 0xF0, 0x2C, 0xB0,
-    0x0F, 0x03, 0xC0, 0x77, 0xC0, 0x3D, 0x7E, 0x00, 0xEF, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xDB,
-    0x80, 0x1D, 0x74, 0x0F, 0x0F, 0x40, 0xB4, 0xE0, 0x3C, 0x1F, 0x03, 0xC2, 0xC0, 0xF0, 0x3D, 0x2E,
-    0x03, 0xC2, 0x40, 0x25, 0xF0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x07, 0xF9, 0x5B, 0xF0, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xE2, 0xF4, 0xBD, 0xF8, 0x0F, 0xBD,
-    0x03, 0xEF, 0xC1, 0xF5, 0xFF, 0xFC, 0x1F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0x29, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x15, 0x00, 0x1A, 0xAA, 0xAA, 0x9B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x00,
-    0x14, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0xD0, 0x34, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x86, 0xAA, 0xA0, 0x00, 0x14, 0x00,
-    0x3F, 0xF8, 0x07, 0xFF, 0xD0, 0x10, 0x7E, 0x00, 0x07, 0xD0, 0x1F, 0xF4, 0x03, 0xFE, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0xC3, 0x97, 0xF8, 0x3F, 0xFF, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x0B,
-    0xF4, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x6A, 0x00, 0xA9, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x01,
-    0xFD, 0x01, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x03,
-    0xF8, 0x03, 0xF8, 0x07, 0xF4, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xC0, 0x1F, 0xEF, 0xCF, 0xC0, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xF6, 0xE3,
-    0xFF, 0xFE, 0x1E, 0x3F, 0xFF, 0xE1, 0xE3, 0xFF, 0xFE, 0x1E, 0x3F, 0xFF, 0xE1, 0xE3, 0xFF, 0xFE,
-    0x1E, 0x3F, 0xFF, 0xE1, 0xE2, 0xFF, 0xFE, 0x1E, 0x0F, 0xFF, 0xE1, 0xE0, 0x7F, 0xFE, 0x1E, 0x00,
-    0x55, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1,
-    0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1E, 0x00, 0x01, 0xE1, 0xE0, 0x00,
-    0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0xFC, 0x7F, 0xC3, 0xF4, 0x04, 0x00, 0x0B, 0x80,
-    0x3F, 0x80, 0x3F, 0x00, 0xFC, 0xBF, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x07, 0xFD, 0x3F,
-    0xFC, 0x7E, 0xFC, 0x25, 0xF8, 0x02, 0xF4, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x06,
-    0x90, 0x07, 0xF8, 0x2F, 0xFE, 0x7E, 0x3F, 0xBC, 0x2F, 0xF8, 0x2F, 0xF8, 0x3E, 0xFC, 0xBD, 0x7F,
-    0xF8, 0x1F, 0xD0, 0x00, 0x40, 0x04, 0x00, 0xBC, 0x0B, 0xC0, 0x0F, 0xE0, 0xFE, 0x00, 0xBF, 0x0B,
-    0xF0, 0x03, 0xF8, 0x3F, 0x40, 0x3F, 0xC3, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x2F,
-    0xD3, 0xFD, 0x0B, 0xF4, 0xBF, 0x40, 0x7E, 0x07, 0xE0, 0x00, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0x40, 0x2F, 0xF0, 0x00, 0xFC, 0x0B, 0xFF, 0x80, 0x0F, 0xC0,
-    0x3F, 0xFD, 0x00, 0xBD, 0x00, 0x63, 0xF0, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x2F, 0x42, 0xFC, 0x0B, 0xD1, 0xF8, 0x2F, 0xE0, 0x3F, 0x0F, 0xC1,
-    0xFF, 0x40, 0xA8, 0xFC, 0x1F, 0xFC, 0x00, 0x0B, 0xD0, 0xF7, 0xF0, 0x00, 0x7E, 0x0F, 0x8F, 0xC0,
-    0x03, 0xF0, 0xFD, 0xBE, 0x40, 0x2F, 0x03, 0xFF, 0xFF, 0x02, 0xF4, 0x0F, 0xFF, 0xF4, 0x1F, 0x80,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x01, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFD, 0x00,
-    0xBD, 0x00, 0x06, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x01, 0x40, 0x01, 0xF8, 0x2F, 0x5F, 0xFD, 0x00, 0xBD, 0x1F, 0x8F, 0xFF, 0xC0, 0x3F, 0x0F, 0xC1,
-    0x83, 0xF0, 0x0A, 0x8F, 0xC0, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00,
-    0xBE, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x01, 0xFF,
-    0xFD, 0x01, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0xFC, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x02, 0xF0, 0x0F, 0xFF, 0xC0, 0x07, 0xE0, 0x04, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xFE, 0x00, 0xBD, 0x00, 0x07, 0xFD, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0xFE, 0xE5, 0xBF, 0x2F, 0x43, 0xFD, 0xFF, 0xFD,
-    0x7E, 0x0B, 0xFC, 0x6F, 0xA0, 0xFC, 0x2F, 0xFC, 0x00, 0x03, 0xF0, 0x7D, 0xF8, 0x00, 0x0B, 0xD1,
-    0xF5, 0xF4, 0x00, 0x1F, 0x83, 0xE6, 0xF4, 0x00, 0x3F, 0x07, 0xFF, 0xFE, 0x00, 0xFC, 0x07, 0xFF,
-    0xFD, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x06, 0x90, 0x00, 0x02, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0x7F, 0x80, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x05, 0x2F, 0xFA, 0xFC, 0x3F, 0xFF, 0xF4, 0x7F, 0xFF, 0x40, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x0F, 0xD7, 0xF0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0,
-    0x00, 0xFE, 0x03, 0xF4, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x2F, 0xC2, 0xFC, 0x00,
-    0x0B, 0xF0, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC,
-    0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF,
-    0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x07, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
-    0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0x80, 0xF0, 0x00, 0x07, 0xFF, 0xBE, 0x00, 0x00, 0xFA, 0xFF, 0xC0, 0x00, 0x0E, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x80,
-    0xFD, 0x00, 0x0B, 0xF9, 0x5F, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x40, 0x00, 0x0F, 0xC7, 0xF0, 0x00,
-    0x03, 0xF1, 0xF8, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x0B, 0xF0,
-    0x3F, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x02, 0xFE, 0x57, 0xF4, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xC0, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x01, 0xFC, 0x3F, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x2F, 0xE5, 0x7F, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x3F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0xBF, 0x55, 0x50, 0x00, 0x00, 0x3F,
-    0xCB, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xC1, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE5, 0x7F, 0xD5, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9,
-    0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xF1, 0xFC, 0x00,
-    0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x82, 0xD0, 0x00, 0x3F,
-    0x5F, 0xC0, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFE, 0x55, 0x40, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xF0, 0x03, 0xFD, 0x55, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xE2, 0xF4, 0x02, 0xF4, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x2D, 0x0A, 0x00, 0x1F, 0xCB, 0xE0, 0x07, 0xE2, 0xF4, 0x00, 0x50, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4, 0x01, 0xFD, 0x01,
-    0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x5F, 0xF5, 0x02, 0xFC, 0x3F, 0xFF,
-    0xD0, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xC6, 0xFF, 0xA8, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B, 0xF4, 0x0F,
-    0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0, 0x00, 0x00,
-    0xBF, 0xFB, 0xD0, 0x00, 0x00, 0xFB, 0xFF, 0xC0, 0x00, 0x01, 0xD0, 0x6E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03,
-    0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0,
-    0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B,
-    0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0,
-    0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F,
-    0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F,
-    0xD0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD,
-    0xBF, 0x40, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80,
-    0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x4F, 0xF0,
-    0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0xFF, 0x2F,
-    0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x2F, 0xF4,
-    0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00,
-    0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4,
-    0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x0F, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0xBE, 0xFF, 0xD0, 0x00, 0x3C, 0x0B, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD,
-    0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03,
-    0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80,
-    0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xB8, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x01, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4,
-    0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47,
-    0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C, 0x3F,
-    0x80, 0xFE, 0x0F, 0xE3, 0xFC, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x03, 0xFF,
-    0xE0, 0x0F, 0xF7, 0xF8, 0x3F, 0xC0, 0xFE, 0x2F, 0x00, 0x3D, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x01, 0xFF, 0xE7, 0xD0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFE,
-    0x02, 0xFF, 0x03, 0xFD, 0x01, 0xFF, 0xD1, 0xFE, 0x00, 0xFF, 0xF4, 0xBF, 0x00, 0xFD, 0xFD, 0x3F,
-    0xC0, 0xBD, 0x3F, 0x4F, 0xE0, 0x7E, 0x1F, 0xD7, 0xF4, 0x3E, 0x07, 0xF1, 0xFC, 0x3F, 0x02, 0xFC,
-    0x7F, 0x3F, 0x00, 0xFE, 0x1F, 0xFF, 0x40, 0xBF, 0x47, 0xFF, 0x80, 0x7F, 0xC0, 0xFF, 0xC0, 0x7F,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xEF, 0xFF, 0x80, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00,
-    0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8,
-    0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F,
-    0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4,
-    0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F,
-    0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00,
-    0x3F, 0x80, 0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8,
-    0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFC, 0x03,
-    0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4,
-    0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x1F,
-    0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-    0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xA0, 0x00, 0x01, 0xFC, 0xFE,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x1F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B,
-    0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0,
-    0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x0B, 0xF4, 0x3F, 0x80, 0x7F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x02, 0xFC, 0x2F, 0xD0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x3F,
-    0xC1, 0xFF, 0x00, 0xFE, 0x02, 0xFD, 0x07, 0xF4, 0x0B, 0xF4, 0x2F, 0xC0, 0x3F, 0xC0, 0xFF, 0x01,
-    0xFF, 0x03, 0xFE, 0xBF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xE0, 0x02, 0xFE, 0x54, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFE,
-    0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFC, 0x01, 0xFE, 0x00,
-    0x03, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xF8, 0x3F, 0xF0, 0x00, 0x07, 0xF4, 0xFF, 0x40, 0x00, 0x0B,
-    0xF1, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0xBF, 0xD0, 0x00, 0x0F, 0xE0,
-    0x3F, 0xF4, 0x00, 0x1F, 0xD0, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x02,
-    0xFC, 0x00, 0x3F, 0xCE, 0xAB, 0xF8, 0x00, 0x3F, 0x8F, 0xFF, 0xF0, 0x00, 0x7F, 0x4F, 0xFF, 0x80,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F,
-    0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF,
-    0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC,
-    0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46,
-    0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8,
-    0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0,
-    0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xD3, 0xF0,
-    0x02, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F,
-    0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0,
-    0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0x80, 0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4,
-    0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F,
-    0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE,
-    0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2D, 0x1A, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0xBE, 0x3F, 0x00, 0x01, 0x40, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4,
-    0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF,
-    0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x2D, 0x2D, 0x00, 0x02, 0xD2, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC,
-    0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0,
-    0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x46, 0x5B, 0xE4, 0x00, 0xFF, 0xF7, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC3, 0xFF, 0x81, 0xFC, 0x3F, 0xC0, 0x7F, 0x80, 0xBF, 0x1F,
-    0xE0, 0x1F, 0xD0, 0x7F, 0xCB, 0xF0, 0x07, 0xFF, 0xFF, 0xC3, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0xFF,
-    0x00, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x3F, 0xF0, 0x01, 0x02, 0xFF,
-    0xFF, 0xFF, 0xAB, 0xC0, 0x3F, 0xFE, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x7D, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24,
-    0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x03, 0xE0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F,
-    0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50,
-    0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0xD0, 0x03, 0xF4, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07,
-    0xFC, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x10, 0x1F, 0xFA, 0xBD, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x1E, 0x00, 0x3F, 0x8F, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x1F, 0xE0, 0x7F, 0x4F, 0xF0, 0x1F, 0xC7,
-    0xF4, 0x1F, 0xF2, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x3F, 0xE9, 0x40, 0x0F, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x40, 0x7F, 0xEA, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xA8, 0x03, 0xFC,
-    0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFC,
-    0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8,
-    0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xFC, 0x0B, 0xE1, 0xF8, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0x82, 0xD0, 0xFC, 0xBE, 0x0F, 0xCB, 0xE0, 0x50, 0x14,
-    0x00, 0x00, 0x00, 0x1A, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x02, 0x40, 0x00, 0xBF,
-    0xBF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xE1, 0xFC,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0xDB, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xEF, 0xFE, 0x07,
-    0xFC, 0x0F, 0xF8, 0x3F, 0xC0, 0x2F, 0xD0, 0xFF, 0x00, 0xBF, 0x43, 0xF8, 0x03, 0xFC, 0x0F, 0xE0,
-    0x0F, 0xE0, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0xEF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x7F, 0xFB, 0xE0, 0x03, 0xEB, 0xFF,
-    0x00, 0x0E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x82, 0xF8, 0x00, 0x3F, 0x3F, 0xFC, 0x00,
-    0xFE, 0xFF, 0xF8, 0x07, 0xFE, 0x1F, 0xF0, 0x2F, 0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xFC,
-    0x03, 0xF4, 0x0F, 0xE0, 0x1F, 0xD0, 0x7F, 0x40, 0xBF, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x3F, 0x80, 0x3F, 0x40, 0xFD, 0x01, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07,
-    0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03,
-    0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x0B,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F, 0xC0, 0x1F, 0xDF,
-    0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0x03, 0xF4, 0xFC, 0x03, 0xE0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00,
-    0x3F, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xD0,
-    0x0F, 0xFF, 0xFC, 0x01, 0xFB, 0xFF, 0x40, 0x2C, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xF0, 0xFF, 0x03, 0xFC, 0x07, 0xF4, 0x7F,
-    0x40, 0x3F, 0x8B, 0xF0, 0x03, 0xF4, 0xFF, 0x00, 0x7F, 0x4F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFF,
-    0x0B, 0xF0, 0x2F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x1E, 0x00, 0x3F, 0x4F, 0xC0, 0x0F, 0xD3, 0xF0, 0x00, 0x50, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x2F, 0xF0, 0xFF, 0x0F,
-    0xF0, 0x1F, 0xD7, 0xF4, 0x03, 0xFA, 0xFC, 0x00, 0xFD, 0xFF, 0x00, 0x7F, 0x7F, 0xC0, 0x2F, 0xCF,
-    0xF0, 0x0F, 0xF2, 0xFC, 0x0B, 0xF4, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xA8, 0x00, 0x04, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xAC, 0x00, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0B, 0xF8, 0x3F, 0xC0,
-    0xFE, 0x0F, 0xFD, 0x1F, 0xD2, 0xFF, 0xE2, 0xFC, 0x7D, 0xFD, 0x3F, 0xDF, 0x5F, 0xD3, 0xFF, 0xE2,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xC2, 0xFF, 0x0B, 0xF4, 0x1F, 0xFB, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xE0, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0,
-    0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD,
-    0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80,
-    0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xE2, 0xF4, 0x02, 0xF4, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02,
-    0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F,
-    0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC,
-    0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0A, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0xBE, 0x3F, 0x40, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9, 0x0F, 0xE0, 0x0F,
-    0xD1, 0xFD, 0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8,
-    0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B, 0xF0, 0x3F, 0xE0,
-    0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A, 0xA0, 0x0B, 0xF0, 0x07, 0xF8,
-    0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x03, 0xF4, 0x3F,
-    0x80, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x01, 0xFB,
-    0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xFC, 0xBE, 0x00, 0x0F, 0xEF, 0xFF, 0x00, 0x3F, 0xFF, 0xFD, 0x01, 0xFF, 0x8B, 0xF8, 0x0B,
-    0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0xC0, 0xFE, 0x00, 0xFE, 0x03, 0xF4, 0x07, 0xF8, 0x1F, 0xC0,
-    0x2F, 0xD0, 0xBF, 0x00, 0xFF, 0x03, 0xFE, 0x0B, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xBF, 0xFD,
-    0x01, 0xFC, 0xBF, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x81, 0xE0, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x2A, 0x80, 0x2F, 0xC0, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x01, 0xFC, 0x07,
-    0xF8, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0xBE,
-    0x3F, 0x40, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0,
-    0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F,
-    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x2A, 0xAA, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC,
-    0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00,
-    0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01,
-    0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C,
-    0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0xBF, 0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xBF, 0xBF, 0x40, 0x03, 0xFF,
-    0xE0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F,
-    0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00,
-    0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02,
-    0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F,
-    0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x00,
-    0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xF8, 0x03, 0xF8, 0xFD, 0x0B, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x02, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x41, 0xB0,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xE4, 0x02, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x2F, 0xF4, 0x24, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x7F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xD0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x41, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x06, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xCF, 0xD0, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x0B, 0xFD, 0x09, 0x03,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x40, 0x1F, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x1F, 0x9F,
-    0xC0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x96, 0xFF, 0x40, 0x1F,
-    0xD0, 0x1F, 0xF0, 0x0B, 0xF0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x7F, 0x40, 0x0F, 0xF0, 0x2F, 0xC0, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0xE0, 0x2F, 0xD1, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00,
-    0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xF2, 0xF4, 0x00, 0x00, 0x0F, 0xF3, 0xD0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x0F, 0xD0, 0x00, 0x03, 0xFF, 0xDF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x7F, 0x40,
-    0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFE, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xF9, 0x6F, 0xF4, 0x01,
-    0xFD, 0x01, 0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x0B, 0xF0, 0x5F, 0xF5, 0x02, 0xFC,
-    0x3F, 0xFF, 0xD0, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xC6, 0xFF, 0xA8, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B,
-    0xF4, 0x0F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFE, 0x02, 0xFD, 0x1B, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x05, 0x5F, 0xE4, 0x00,
-    0x00, 0x0F, 0xD0, 0x01, 0xFF, 0x5F, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F,
-    0xE0, 0xBF, 0x80, 0x3F, 0x80, 0x7F, 0x40, 0xBF, 0x40, 0x7F, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0xFF,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFE, 0xFC, 0x00, 0x1F, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA0, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6A,
-    0xAA, 0x00, 0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF,
-    0xAB, 0xD0, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x03, 0xD0, 0x00, 0xFE, 0xBF, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9,
-    0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xE0, 0x0F, 0xEB, 0xF0,
-    0x01, 0xFF, 0xF4, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD,
-    0x03, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03,
-    0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF, 0xAB, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x55,
-    0x40, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xF5, 0x55, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD,
-    0x00, 0x7E, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x01, 0xFE, 0x07, 0xF4, 0x3F, 0xC0, 0x7F, 0x07,
-    0xF4, 0x1F, 0xF0, 0xBF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xA5, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x10, 0x07, 0xFE, 0xAF, 0x40, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x07, 0xF0, 0xFC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F,
-    0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE,
-    0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F,
-    0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x3E, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40,
-    0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07,
-    0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x02, 0xFE, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00,
-    0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05,
-    0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF, 0xFC, 0xBF,
-    0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F,
-    0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD,
-    0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF, 0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4,
-    0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F,
-    0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x40, 0x6C, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0xFF, 0xFC, 0x7F, 0x40, 0xFF,
-    0xFC, 0xBF, 0x40, 0xFF, 0xF8, 0xBF, 0x40, 0x07, 0xF4, 0x7F, 0x40, 0x0B, 0xF0, 0x7F, 0xC0, 0x0F,
-    0xF0, 0x3F, 0xE0, 0x0F, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x1A, 0x40, 0x3F, 0xFD, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xF4, 0xFF, 0xC0, 0xFF,
-    0x01, 0xFE, 0x07, 0xF8, 0x07, 0xF4, 0x2F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xBF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC1, 0xFF, 0x40, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x05, 0x00, 0x7F, 0xC0, 0x2F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xD0,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07,
-    0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC,
-    0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80,
-    0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x7F, 0x1F, 0x80, 0x1F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC7,
-    0xE0, 0x03, 0xFB, 0xFF, 0xC0, 0x3F, 0xFF, 0xFE, 0x07, 0xFE, 0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0x0F,
-    0xF0, 0x0F, 0xE0, 0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F,
-    0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x0A, 0xFF, 0xAA, 0xBF, 0xE8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xFC, 0x00,
-    0x7F, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xF5, 0x56, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x03, 0xFC, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x3F,
-    0x80, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x06, 0xFD, 0x54, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8,
-    0xFF, 0x40, 0x3F, 0xBF, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0xBF, 0xD0, 0xFE, 0x0B, 0xF4, 0x0F, 0xE0,
-    0xFF, 0x00, 0xFD, 0x0F, 0xE0, 0x1F, 0xD1, 0xFD, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
-    0xF8, 0x3F, 0x80, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x41, 0xE0,
-    0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0xC0, 0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0xE0, 0x3C,
-    0x1F, 0xFE, 0xF8, 0x3E, 0xBF, 0xF0, 0x38, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2A, 0xAA, 0x40, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x00, 0x0A, 0xAA,
-    0x90, 0xFF, 0xFD, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00,
-    0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0xBC, 0x00, 0xBF, 0xBF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x03, 0xC1, 0xFE, 0xBF, 0x03, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x80, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x90, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0,
-    0x01, 0xFD, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xD4, 0x00, 0xBF, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x07,
-    0xF4, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8,
-    0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x01, 0xA8, 0x03,
-    0xFC, 0x03, 0xF8, 0x07, 0xF4, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0x7F, 0x40, 0x00, 0xFF, 0xFE, 0x02, 0xFC, 0x00, 0xFF,
-    0xFE, 0x03, 0xFC, 0x00, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x00, 0x3F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x7F, 0x40, 0x1F,
-    0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x01, 0xFD, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0x40, 0xFE, 0x00, 0xBF, 0xFF,
-    0x41, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0x02,
-    0xFD, 0x00, 0x68, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA4, 0x03, 0xFC, 0x07,
-    0xF4, 0x03, 0xF8, 0x0B, 0xF0, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xD0, 0x0F, 0xE0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x2F, 0xC0, 0x3F,
-    0x80, 0x3F, 0xC0, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xE1, 0xF8,
-    0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0xFE, 0x02, 0xFE,
-    0x00, 0x1F, 0xD0, 0xBF, 0xC0, 0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC,
-    0xFF, 0x40, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x01, 0xFD, 0x0F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x03,
-    0xF4, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xD0, 0x07,
-    0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x01, 0xA8, 0x02, 0xA8, 0x03, 0xFC, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xD0, 0x07,
-    0xF4, 0xBF, 0x40, 0x0B, 0xF2, 0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0x81, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00,
-    0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x03,
-    0xFC, 0x2F, 0x80, 0x0F, 0xE0, 0xFC, 0x00, 0x7F, 0x47, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0x1F, 0xC0, 0x0F, 0xF2, 0xF8, 0x00, 0xFE, 0x3F, 0x00, 0x1F, 0xDB, 0xC0, 0x01, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0xBD, 0x07, 0xF4, 0x7F, 0x82,
-    0xFC, 0x1F, 0xD0, 0xFF, 0x02, 0x90, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0xBD, 0x0B, 0xF1, 0xFE, 0x0F, 0xF1, 0xFE, 0x0F, 0xF0,
-    0x64, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC4, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xE0,
-    0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xF8, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x7F, 0x40, 0x2F,
-    0xC0, 0x0F, 0xF8, 0x03, 0xFF, 0x41, 0xFF, 0xE2, 0xFF, 0xD3, 0xFF, 0xC0, 0x7F, 0xF0, 0x0B, 0xF8,
-    0x01, 0xFD, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x00,
-    0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF,
-    0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1, 0xFC,
-    0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F, 0x2F,
-    0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF, 0x40,
-    0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00, 0x7F,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xE0, 0x00, 0xFC,
-    0xFF, 0xF0, 0x03, 0xFB, 0xFF, 0xE0, 0x1F, 0xF8, 0x7F, 0xC0, 0xBF, 0xC0, 0xFF, 0x03, 0xFC, 0x03,
-    0xF8, 0x0F, 0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0x7F, 0x41, 0xFD, 0x02, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x3F, 0x80, 0xFE, 0x00, 0xFD, 0x03, 0xF4, 0x07, 0xF0, 0x1F, 0xC0, 0x2F, 0xC0, 0x00,
-    0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF,
-    0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC,
-    0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40,
-    0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F,
-    0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFB,
-    0xFF, 0xE0, 0x7F, 0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0,
-    0xFE, 0x01, 0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03,
-    0xF4, 0x3F, 0x40, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC,
-    0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0x03, 0xF4, 0x02,
-    0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC, 0x0B, 0xE0, 0x03, 0xF1,
-    0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F, 0xC0, 0x0F, 0xE0, 0x7F,
-    0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40, 0x1F, 0xC0, 0x1F, 0xFF,
-    0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0x0B, 0xFE, 0x00,
-    0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE,
-    0x00, 0x03, 0xF3, 0xFF, 0xC0, 0x03, 0xFB, 0xFF, 0xE0, 0x07, 0xFE, 0x1F, 0xF0, 0x0B, 0xFC, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xD0, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xD0, 0x2F,
-    0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x40, 0x7F,
-    0x00, 0x7F, 0x00, 0xBF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x4A, 0x42, 0xF8, 0x0F, 0xC7, 0xE7, 0xFF, 0x81, 0x42,
-    0xFB, 0xFF, 0xF0, 0x00, 0xFF, 0xD2, 0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0x40, 0x0F, 0xF0, 0x1F, 0xC0,
-    0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x7F,
-    0x40, 0x1F, 0xD0, 0x1F, 0xC0, 0x07, 0xF0, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x00,
-    0xFE, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xE0, 0x0F, 0xFD, 0x00, 0x3F,
-    0x80, 0x7F, 0xF8, 0x00, 0xFD, 0x01, 0xFF, 0xF0, 0x07, 0xF0, 0x0B, 0xDF, 0xE0, 0x2F, 0xC0, 0x3F,
-    0x6F, 0xC0, 0xFE, 0x00, 0xFC, 0x3F, 0x43, 0xF4, 0x07, 0xF0, 0xFE, 0x0F, 0xC0, 0x2F, 0xC1, 0xFC,
-    0x7F, 0x00, 0xFE, 0x03, 0xF6, 0xFC, 0x03, 0xF4, 0x0B, 0xFB, 0xE0, 0x0F, 0xC0, 0x1F, 0xFF, 0x40,
-    0x7F, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0xBF, 0xF0, 0x0F, 0xE0, 0x00, 0xFF, 0xC0, 0x3F, 0x40,
-    0x03, 0xFE, 0x00, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBE, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0, 0xFE, 0x01, 0xFD,
-    0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F, 0x40,
-    0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xAA, 0xA4, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xF8, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0xFF,
-    0x07, 0xFC, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x07, 0xF4, 0xFF, 0x00, 0x01, 0xFD, 0x3F, 0x80, 0x00,
-    0x7F, 0x5F, 0xD0, 0x00, 0x2F, 0xDB, 0xF4, 0x00, 0x0F, 0xF2, 0xFD, 0x00, 0x07, 0xFC, 0x7F, 0x40,
-    0x02, 0xFD, 0x1F, 0xF0, 0x01, 0xFF, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x00,
-    0x2F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xC3, 0xFC, 0x3F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03, 0xF7,
-    0xFC, 0x01, 0xFD, 0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x0F, 0x40, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00,
-    0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x02, 0xFD, 0xBF, 0x40,
-    0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF, 0x00, 0x1F, 0xF0, 0x3F,
-    0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x0F, 0xEB, 0xF0, 0x01,
-    0xFF, 0xF8, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC, 0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F,
-    0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC, 0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x07, 0xFC,
-    0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x07,
-    0xF4, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0xBF, 0x40, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x07, 0xFC, 0x07,
-    0xF4, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0xFC, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x7F, 0x40, 0x3F,
-    0x80, 0xBF, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0xBF, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFE, 0x02, 0xFE,
-    0x55, 0x40, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x07, 0xF4,
-    0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xD0, 0x03, 0xFD, 0x55, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x01,
-    0xFD, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x0B, 0xF0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x2F, 0xE4, 0x00, 0xFF, 0xFE,
-    0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0x83, 0xFF, 0xC0, 0xFD, 0x3F, 0xC0, 0xBF,
-    0xC0, 0x7F, 0x5F, 0xD0, 0x1F, 0xE0, 0x7F, 0xCB, 0xF0, 0x07, 0xFF, 0xFF, 0xD3, 0xFC, 0x02, 0xFF,
-    0xFF, 0xD0, 0xFF, 0x00, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xAB, 0xD0, 0x3F, 0xFF, 0xEF, 0xFF, 0xF4, 0x02, 0xFF, 0xD1, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0xFE, 0x0B, 0xF8, 0x01,
-    0xFD, 0x03, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x0F, 0xF4, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0x0F,
-    0xE0, 0xFF, 0x00, 0x1F, 0xD0, 0xBF, 0x40, 0x2F, 0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F,
-    0x80, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0B, 0xD0, 0x0F, 0xDF,
-    0xF0, 0x03, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0x82, 0xFE, 0x01, 0xFD, 0x03, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x3F, 0x80, 0xFE, 0x03, 0xFD, 0x07, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFC, 0x7F, 0x40, 0x0F, 0xE0, 0xFF, 0x00, 0x7F, 0x42, 0xFD, 0x02, 0xFC, 0x07, 0xF8,
-    0x0F, 0xF0, 0x0F, 0xF0, 0x3F, 0x80, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x68, 0x2F, 0x40, 0x3F, 0x7F, 0xC0, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xA8, 0x02,
-    0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x2F, 0x80, 0x00, 0x3F, 0x2F, 0x80,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x82, 0xFE, 0x00, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x03, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFC, 0x7F, 0x40, 0x00,
-    0xFE, 0x0F, 0xF0, 0x00, 0x7F, 0x42, 0xFD, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xF8, 0x02, 0xFE, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC,
-    0x00, 0xBD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0xBD, 0x00, 0x3F, 0x7F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFA, 0x80, 0x0B, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xD0, 0x64, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x64, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40, 0x0B, 0xF0, 0x2F, 0xAF,
-    0xFC, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF4, 0xFC, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xD0, 0x64, 0x07,
-    0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x64, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xE2,
-    0xF4, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF,
-    0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40, 0x0B, 0xF0, 0x2F, 0xAF, 0xFC, 0x0B, 0xFF,
-    0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x00, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x06, 0x40, 0x7F, 0x80, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFD, 0x06, 0x40, 0x3F,
-    0xD0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xE0, 0x14, 0x1F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x40,
-    0x0B, 0xF0, 0xBE, 0xBF, 0xF0, 0xBF, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x01, 0xFC, 0xFD, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF4, 0x19, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x64, 0x03, 0xFD, 0x02, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x0B, 0xE0, 0x0F, 0xCF, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xF8, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x40,
-    0x0B, 0xF0, 0x2F, 0xAF, 0xFC, 0x0B, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x05, 0x5F, 0xF5, 0x50, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x64, 0x00, 0x0F, 0x80, 0x02,
-    0xF4, 0x00, 0xBF, 0xE9, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0,
-    0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40, 0x0B, 0xF4, 0x00, 0xBF, 0xED, 0x07,
-    0xFF, 0xD0, 0x2F, 0xFC, 0x00, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x0F, 0xFE,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x02, 0xF8, 0x00, 0xFC, 0xFE, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x06,
-    0x4F, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF4, 0x00, 0x02, 0xFF, 0xA4, 0x07, 0xFF, 0xFD, 0x02, 0xFF,
-    0xFF, 0x40, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0xED, 0x00, 0x1F,
-    0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFE, 0x05, 0x5F, 0xF5, 0x50, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x01, 0x6F, 0xD5, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0xE9, 0x1F, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0x3F, 0x80,
-    0x01, 0xFD, 0x00, 0x2B, 0xFA, 0x41, 0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x1F, 0xD0,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xB4, 0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x1E, 0x00, 0x02, 0xFF, 0xEF, 0x00, 0x00, 0xFB, 0xFF, 0x80, 0x00, 0x74, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF0, 0x0F, 0xE0, 0x03,
-    0xFC, 0x07, 0xF4, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x1F, 0xD0, 0x3F, 0x80,
-    0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0xFF,
-    0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x0B, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xE0, 0x0B, 0xFF, 0xBD, 0x00, 0xFB, 0xFF, 0xC0,
-    0x1D, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9, 0x0F, 0xE0, 0x0F, 0xD1, 0xFD, 0x01,
-    0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F,
-    0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B, 0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0xFD,
-    0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA0, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00,
-    0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0,
-    0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F,
-    0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE,
-    0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8,
-    0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBF, 0xBF, 0x40, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0,
-    0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x0F, 0xE0, 0x3F,
-    0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80,
-    0xBF, 0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0x07, 0xF4, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFF,
-    0x01, 0xFE, 0x00, 0x7F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x7C, 0x00, 0xBF, 0xBF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B,
-    0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2D,
-    0x2D, 0x00, 0x00, 0x0B, 0x4B, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0,
-    0x7F, 0x40, 0x0F, 0xF0, 0x2F, 0xC0, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0xBF,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x01,
-    0xFD, 0x03, 0xF8, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xF4,
-    0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2D, 0x2D, 0x00, 0x02,
-    0xD2, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9,
-    0x0F, 0xE0, 0x0F, 0xD1, 0xFD, 0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0,
-    0x3F, 0x83, 0xF8, 0x07, 0xF4, 0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B,
-    0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F,
-    0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x0F, 0xE0, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x2F,
-    0x4B, 0xD0, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0x0F, 0xE0,
-    0x0F, 0xD0, 0x1F, 0xD0, 0x1F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x40, 0x7F, 0x40, 0xBF, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xBF, 0x01,
-    0xFE, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFD, 0xFC, 0x00, 0x1F, 0xF4,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F,
-    0x80, 0x0F, 0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40,
-    0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE,
-    0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07,
-    0xF8, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBE, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00, 0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F,
-    0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F, 0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF,
-    0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE, 0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF,
-    0x4F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF5, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x3F, 0x6F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0xBF, 0x00, 0x7F, 0xC0, 0x0F, 0xE2, 0xFC,
-    0x02, 0xFF, 0x00, 0x7F, 0x0B, 0xF0, 0x0F, 0xFC, 0x03, 0xFC, 0x2F, 0xC0, 0xBF, 0xF0, 0x1F, 0xD0,
-    0xBF, 0x03, 0xFB, 0xC0, 0xBF, 0x02, 0xFC, 0x2F, 0xAF, 0x43, 0xF4, 0x07, 0xF0, 0xFC, 0xBD, 0x2F,
-    0xC0, 0x1F, 0xC7, 0xE2, 0xF4, 0xFE, 0x00, 0x7F, 0x3F, 0x4B, 0xD7, 0xF0, 0x01, 0xFD, 0xFC, 0x2F,
-    0x7F, 0x80, 0x07, 0xFB, 0xD0, 0xBD, 0xFC, 0x00, 0x1F, 0xFF, 0x02, 0xFB, 0xF0, 0x00, 0x7F, 0xF4,
-    0x0B, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x00, 0xAA, 0x00, 0xAA, 0x7F, 0x01, 0xFF, 0x01, 0xFD, 0x7F, 0x03, 0xFF,
-    0x02, 0xFC, 0x7F, 0x07, 0xFF, 0x03, 0xF4, 0x7F, 0x0B, 0xEF, 0x0B, 0xF0, 0x3F, 0x0F, 0xAF, 0x0F,
-    0xE0, 0x3F, 0x2F, 0x6F, 0x1F, 0xC0, 0x3F, 0x3F, 0x2F, 0x3F, 0x80, 0x3F, 0x7D, 0x2F, 0x7F, 0x00,
-    0x3F, 0xBC, 0x2F, 0xBE, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x2F, 0xF0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xBE, 0x1F, 0x80, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x0B, 0xF4, 0x3F, 0x80, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x02, 0xFC,
-    0x2F, 0xD0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0xBF, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x0A,
-    0xA0, 0x0B, 0xF0, 0x07, 0xF8, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x0F, 0xD0,
-    0xBF, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B,
-    0xEB, 0xF0, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x03, 0xF2, 0xFC, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x14, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC7, 0xF4, 0x02, 0xFD, 0x0F, 0xE0, 0x1F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x0B, 0xF4, 0x01, 0xFD, 0x3F, 0x80, 0x03, 0xF7, 0xFC, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F,
-    0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0xAA, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x07, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x57, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x02, 0xF6,
-    0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8,
-    0x00, 0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0xBF, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xE4, 0x1F, 0xD0, 0x07, 0xFF,
-    0xFF, 0x8F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0xF0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x7F,
-    0xC0, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0x80, 0x3F, 0xFF, 0xDF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x5F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x07, 0xFE, 0x03, 0xFF, 0xD0, 0xBF, 0x83, 0xFD, 0x00, 0x3F, 0xC0, 0x0F, 0xE1, 0xFE,
-    0x00, 0x0B, 0xF0, 0x03, 0xF8, 0xFF, 0x00, 0x02, 0xFD, 0x01, 0xFD, 0x3F, 0x80, 0x00, 0xBF, 0x00,
-    0xBF, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x2F, 0xCB, 0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xE2, 0xFC, 0x00,
-    0x03, 0xFC, 0x03, 0xF4, 0xBF, 0x00, 0x01, 0xFE, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0xBF,
-    0x07, 0xF8, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xE0, 0x00, 0xFF, 0xFF, 0x7F, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xC3, 0xFF, 0x47, 0xFC, 0x3F, 0xC0, 0x7F, 0x40, 0xBF,
-    0x1F, 0xD0, 0x0F, 0xE0, 0x3F, 0xCB, 0xF0, 0x03, 0xF4, 0x0F, 0xE3, 0xFC, 0x01, 0xFD, 0x03, 0xF4,
-    0xFF, 0x00, 0xBF, 0x01, 0xFD, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x0B, 0xF0, 0x2F, 0xD0, 0x3F, 0xC1,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0x2F, 0xFF, 0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xE0, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x4B, 0xF6, 0xFD, 0x5B,
-    0xFC, 0xBC, 0x2F, 0xC0, 0x3F, 0xCB, 0xC3, 0xFC, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x07,
-    0xF4, 0x07, 0xFC, 0x00, 0xBF, 0x9B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFA, 0x90, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF2, 0xF8, 0x00, 0x3F, 0xBF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF4, 0x07, 0xFE, 0x2F, 0xE0, 0x2F, 0xE0, 0x3F, 0xC0, 0xFF, 0x00, 0xFF, 0x03, 0xF8, 0x03,
-    0xF8, 0x0F, 0xD0, 0x1F, 0xE0, 0x7F, 0x00, 0xBF, 0x42, 0xFC, 0x03, 0xFC, 0x0F, 0xF8, 0x2F, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0xF4, 0x07, 0xF2, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFB, 0xFF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xFC,
-    0x07, 0xF4, 0x0F, 0xF0, 0x2F, 0xC0, 0x7F, 0x80, 0xFF, 0x5B, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x7F, 0xAF, 0xD0, 0x02, 0xFC, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x40, 0x3F, 0x80,
-    0xFE, 0x01, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFC, 0x00,
-    0xD0, 0x2F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x1B, 0xFF,
-    0x40, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x80, 0x3F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFD,
-    0x02, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xFC, 0x02, 0xFF, 0xF4, 0x1F, 0xFF, 0xD0, 0x3F,
-    0xF8, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0xDA, 0xF0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0x45, 0x54, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF8,
-    0x3F, 0xFE, 0x78, 0xBF, 0x78, 0xBF, 0x3F, 0xFE, 0x0B, 0xFD, 0x01, 0xFC, 0x02, 0xFC, 0x03, 0xFC,
-    0x03, 0xF8, 0x03, 0xF4, 0x07, 0xF0, 0x0B, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xC0,
-    0x2F, 0xC0, 0x3F, 0x80, 0x3F, 0x40, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0xFE, 0x3F, 0xFE, 0x0B, 0xF9,
-    0x00, 0x64, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0xBF, 0xE9, 0x7F, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F,
-    0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x40,
-    0x0B, 0xF4, 0x00, 0xBF, 0xEE, 0x07, 0xFF, 0xD0, 0x2F, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x1F, 0x80, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0xBF, 0x5B, 0xF5, 0x50, 0xBC, 0x0F, 0xF0, 0x00, 0xBC, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0x03, 0xFC, 0x00, 0x3F,
-    0x40, 0x0B, 0xFE, 0x97, 0xFF, 0xFD, 0xBF, 0xFF, 0xD0, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x40, 0x0B, 0xFE, 0xD0, 0x7F,
-    0xFD, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0x85, 0x5F, 0xF5, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x0B, 0xF0, 0x01, 0xFD, 0x3F, 0x80, 0x3F, 0x80, 0x0B, 0xF2, 0xFC, 0x00, 0xFE, 0x00, 0x2F,
-    0xFF, 0xD0, 0x07, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x40, 0x00, 0xFF, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x7F,
-    0x40, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F, 0xE0, 0x0F,
-    0xEF, 0xF0, 0x1F, 0xD0, 0x1F, 0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00,
-    0x7F, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0xBD, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x0F,
-    0xE0, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFD, 0x03, 0xF4, 0xFC,
-    0x3E, 0x00, 0xF4, 0x0F, 0x80, 0xF0, 0xFF, 0xFF, 0xCB, 0xEF, 0xFD, 0x3C, 0x0B, 0xD0, 0x1A, 0xAA,
-    0x8F, 0xFF, 0xE3, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x5A, 0xAA, 0xA8,
-    0x00, 0x00, 0x03, 0xD0, 0x2E, 0x3F, 0xAF, 0xC1, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x0F, 0xCF,
-    0xF7, 0xFC, 0x28, 0x00, 0x28, 0x1E, 0x3F, 0x4F, 0xCF, 0xD3, 0xF0, 0x50, 0x50, 0x2A, 0x47, 0xFE,
-    0x17, 0xF0, 0x3E, 0x2F, 0xC3, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0xFF, 0xCB, 0x47, 0x6D, 0x2D, 0x3F,
-    0xF0, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xFE, 0x0F, 0xD3, 0xF4, 0x2F, 0x4B, 0xD0, 0x78,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC1, 0xF9, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00,
-    0x05, 0x07, 0xC2, 0xF0, 0xF8, 0x3D, 0x1F, 0x47, 0xC1, 0xA0, 0x04, 0x05, 0x0F, 0x8B, 0xC3, 0xD3,
-    0xE1, 0xF0, 0xF4, 0xBC, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x01, 0xFC, 0xBD,
-    0x02, 0xF0, 0xFC, 0x02, 0xD0, 0xF0, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x13, 0xCA, 0x5E, 0xB8,
-    0x1F, 0x0F, 0xFF, 0x40, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0xC3, 0xE5, 0xBD,
-    0x78, 0x03, 0xD0, 0x01, 0xF4, 0x0F, 0xC0, 0x7F, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x01, 0x50, 0x00,
-    0x03, 0xF4, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x01, 0x40, 0x00, 0xFD, 0xFD, 0xFD,
-    0xBD, 0x7D, 0x3D, 0x14, 0x03, 0xF4, 0x1F, 0xC0, 0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x3E, 0x00, 0x00, 0x40, 0x0E, 0x2B, 0xD3, 0xFC, 0x03, 0xC0, 0x14, 0x04, 0x03, 0xC0, 0x3E,
-    0x87, 0xFC, 0xB0, 0x05, 0x00, 0xBF, 0xFE, 0x6A, 0xAD, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x38, 0x00,
-    0x34, 0x00, 0x70, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x07, 0xF4, 0x3F, 0xE0, 0x7F, 0x40, 0x54,
-    0x00, 0x01, 0x07, 0xC3, 0xD0, 0xE0, 0x3D, 0x07, 0x40, 0x00, 0x01, 0xC0, 0x0B, 0x00, 0x7D, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xE6, 0xFA, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x70, 0x6F, 0x9B,
-    0xFE, 0x0E, 0x00, 0x90, 0x15, 0x50, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0xFC, 0x00, 0xFC,
-    0x01, 0xFC, 0x02, 0xF8, 0x2F, 0xF0, 0x3F, 0xE0, 0x3F, 0x80, 0x15, 0x03, 0xF0, 0x7F, 0x07, 0xE0,
-    0xBE, 0x0B, 0xFE, 0x3F, 0xE0, 0xA9, 0x05, 0x0F, 0xE7, 0xF8, 0xFD, 0x04, 0x00, 0x1E, 0x0B, 0x4F,
-    0xC7, 0xF3, 0xF1, 0xF8, 0x50, 0x14, 0x0B, 0xE0, 0xFF, 0xE3, 0xC3, 0xCF, 0x0F, 0x2F, 0xF8, 0x2F,
-    0x40, 0x05, 0x41, 0xFC, 0x3F, 0x43, 0xE0, 0x64, 0x00, 0x0B, 0x80, 0x7F, 0x40, 0x3F, 0x00, 0xFC,
-    0xBF, 0xE2, 0xFE, 0x00, 0x0B, 0xC2, 0xF0, 0x7D, 0x07, 0xE4, 0x7F, 0xD2, 0xFC, 0x00, 0x00, 0x05,
-    0x0B, 0xC3, 0xE0, 0xF4, 0x3D, 0x1F, 0x0B, 0xC2, 0x90, 0x3F, 0xFF, 0xE7, 0xEA, 0xBE, 0xB0, 0x01,
-    0xDF, 0x00, 0x2C, 0x50, 0x01, 0x40, 0x10, 0x10, 0x1B, 0x0F, 0x0F, 0x3F, 0xFF, 0xC0, 0x50, 0x50,
-    0x00, 0x00, 0x00, 0xF8, 0x0F, 0xC2, 0xF9, 0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFD, 0x07, 0xF0, 0xFC, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xD0,
-    0x3E, 0x3F, 0xAF, 0xC1, 0xFF, 0xF8, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF,
-    0xC3, 0xE5, 0xBD, 0x78, 0x03, 0xD0, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xF8, 0x3E, 0xBF, 0xF0, 0x38,
-    0x0B, 0x80, 0x1A, 0xAA, 0x8F, 0xFF, 0xE3, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x05,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xC0, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x0A,
-    0xAA, 0xAA, 0x00, 0x07, 0xE0, 0x3C, 0x1F, 0xFE, 0xF8, 0x3F, 0xBF, 0xF0, 0x3C, 0x0B, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x9A, 0xAA, 0xA8, 0x15, 0x55, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x2F, 0xF4, 0x03, 0xF8, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0x0F, 0x2E, 0xB8, 0x00, 0x34, 0x00, 0xA3,
-    0x40, 0x0E, 0x74, 0x00, 0xDB, 0xFF, 0xFC, 0x55, 0x55, 0x40, 0x05, 0x55, 0x43, 0xFF, 0xFE, 0x34,
-    0x00, 0xD7, 0x00, 0x1C, 0xBA, 0xAB, 0xCA, 0xAA, 0xA8, 0x01, 0x41, 0x42, 0xFF, 0xFE, 0x70, 0xB0,
-    0xB5, 0x01, 0x01, 0x00, 0x00, 0xB2, 0xC1, 0xFD, 0x03, 0xE0, 0x7A, 0xD0, 0x41, 0x00, 0x00, 0x90,
-    0x7D, 0x0F, 0x00, 0xF0, 0x07, 0x40, 0x38, 0x2F, 0x02, 0x40, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC,
-    0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA0, 0x00, 0x0B, 0xF0, 0x3F,
-    0x80, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0xD1, 0xFD, 0x0F, 0xD0, 0xBC, 0x00, 0x07, 0xE0, 0x3C,
-    0x1F, 0xFE, 0xF8, 0x3F, 0xBF, 0xF0, 0x3C, 0x0B, 0x80, 0x14, 0x2F, 0xC6, 0xF4, 0x3C, 0x1D, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x02, 0xD1, 0xFE, 0x28, 0x7F, 0x2F, 0xCF, 0xDB, 0xE3, 0xF0, 0xFC, 0x14,
-    0x7C, 0x01, 0x00, 0x05, 0x02, 0xF4, 0x3F, 0x43, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x3D, 0x55, 0x6D, 0x38, 0x00, 0x2C, 0x34, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54,
-    0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA0, 0x04,
-    0x04, 0x3D, 0x3E, 0x7C, 0x3D, 0xBC, 0x7C, 0xFC, 0x7C, 0x00, 0x00, 0x1A, 0x93, 0xFD, 0x01, 0xD0,
-    0x2C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x12, 0x85, 0x1F, 0xF4, 0xD3, 0xEF, 0xFC, 0x72, 0xDE, 0x00,
-    0x14, 0x00, 0x00, 0x14, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x55, 0x04, 0x0F, 0xF0, 0xF0,
-    0xB7, 0xFF, 0x43, 0x41, 0xB4, 0x00, 0x7C, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x01, 0x40,
-    0x20, 0x2F, 0xF7, 0xC1, 0xD7, 0xFC, 0x01, 0x01, 0x40, 0x0F, 0xD1, 0xD0, 0xFF, 0xFE, 0x03, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x1F, 0xAF, 0x83, 0xFF, 0xFC, 0x0A, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x87, 0xF4, 0xB0, 0x3C, 0x0E, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xFE, 0x90, 0x1A,
-    0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05, 0x40, 0x00,
-    0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2, 0x00, 0x00,
-    0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01, 0x80, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x80, 0x2E, 0x41, 0xF1, 0xFC, 0xE0,
-    0x00, 0x00, 0x05, 0x3E, 0x78, 0xB4, 0xBC, 0x3C, 0x00, 0x00, 0x14, 0x00, 0x7F, 0xF4, 0x1F, 0xEF,
-    0xC3, 0xD0, 0x2D, 0x38, 0xF9, 0xD0, 0x1F, 0x80, 0x00, 0xB0, 0x00, 0x00, 0x1C, 0xD7, 0xF4, 0xFC,
-    0xBB, 0x84, 0x40, 0x02, 0x5F, 0xCB, 0x81, 0xBC, 0x02, 0x40, 0x34, 0x0B, 0xE0, 0x7C, 0xBE, 0x34,
-    0x00, 0xD0, 0x0A, 0x07, 0xE0, 0xF4, 0x0F, 0x5F, 0x87, 0xE3, 0x9C, 0xD0, 0x70, 0xD0, 0x00, 0x0B,
-    0x81, 0xF0, 0x3C, 0x2F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF3, 0xFC, 0x28, 0x00, 0x00, 0x00,
-    0xB0, 0x3B, 0xD2, 0xF9, 0x2F, 0xC1, 0x98, 0x00, 0x01, 0x03, 0xFE, 0xFD, 0x70, 0xF0, 0xBA, 0x0B,
-    0x07, 0x75, 0xF5, 0xE2, 0xF9, 0xF8, 0x20, 0x1C, 0x0B, 0xF9, 0x5D, 0x03, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xFA, 0x5A, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x80, 0x00, 0x07,
-    0xF4, 0x0F, 0xFE, 0x56, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xA0, 0x00,
-    0x2A, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xD0, 0x2A, 0xAA, 0xAA, 0xA3, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xA4, 0x00, 0x0F, 0x03, 0xFF, 0xFF, 0xFE, 0xAF,
-    0x83, 0xF9, 0xAF, 0xFF, 0xFF, 0x80, 0xE0, 0x00, 0x06, 0xBE, 0x40, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x1B, 0xF0, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x28, 0x02, 0xAA, 0xAA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3E, 0xD3, 0xDB, 0x1D, 0x2C,
-    0x74, 0xF1, 0xFF, 0x81, 0x88, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xD7, 0x4F, 0xB8, 0x39, 0x00, 0xFA,
-    0x40, 0x64, 0x00, 0x00, 0x01, 0xD0, 0x10, 0x3C, 0x0E, 0x07, 0x42, 0xC0, 0xF0, 0x14, 0x00, 0x00,
-    0x00, 0x3F, 0x43, 0xCB, 0x1D, 0x2C, 0x74, 0xF0, 0xFB, 0x40, 0xA0, 0x00, 0x2C, 0x34, 0xF1, 0xD3,
-    0x8B, 0x1D, 0x3C, 0x7F, 0xE0, 0x61, 0x00, 0x00, 0x01, 0xFC, 0x78, 0x4B, 0x00, 0xF0, 0x0B, 0xA4,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x38, 0x0F, 0xB4, 0x3C, 0xB0, 0x74, 0xB0, 0x74, 0xF0,
-    0x7F, 0xE0, 0x18, 0x40, 0x00, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0xBC, 0x3D, 0xB0, 0xE2, 0xC7, 0x4F,
-    0x2C, 0x38, 0x50, 0x80, 0x00, 0x00, 0x01, 0xDF, 0x7E, 0x2E, 0x7C, 0xF3, 0xC7, 0x4F, 0x38, 0xB0,
-    0xE3, 0x4F, 0x1D, 0x20, 0x51, 0x80, 0x00, 0x02, 0xEC, 0x3E, 0x43, 0x80, 0x74, 0x0B, 0x00, 0x50,
-    0x00, 0x00, 0x03, 0x83, 0xFC, 0xB0, 0x3C, 0x0E, 0x03, 0xE0, 0x64, 0xE0, 0xEB, 0x2C, 0xB3, 0x47,
-    0xB0, 0x7C, 0x02, 0x40, 0x0B, 0x1E, 0x03, 0xB8, 0x02, 0xE0, 0x07, 0xF0, 0x1E, 0x74, 0x14, 0x24,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB,
-    0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F,
-    0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0,
-    0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFE,
-    0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFE, 0x57, 0xFC, 0x01, 0xFC, 0x02,
-    0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x6F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x0F, 0xF0, 0x2F, 0xC0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00,
-    0xFE, 0x3F, 0x40, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0x2F, 0xC0, 0xBF, 0x00,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x0B, 0xF0, 0x07, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x3F,
-    0x41, 0xFD, 0x00, 0x0F, 0xD0, 0xFF, 0x00, 0x03, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0x55, 0x50, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x5F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF4, 0x03, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xF5, 0x56, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF8,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B,
-    0xF4, 0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC6, 0xA8, 0x7F, 0x4F, 0xE3, 0xFF, 0x1F, 0xD7, 0xF4, 0xFF,
-    0xCB, 0xF6, 0xFD, 0x15, 0x53, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC,
-    0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF,
-    0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x1F, 0xD0, 0xBF, 0xC0,
-    0x01, 0xFC, 0x1F, 0xF0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x03, 0xFC, 0xFF, 0x40, 0x00, 0x3F, 0xBF,
-    0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x7F,
-    0x80, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x03, 0xF4, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x2F, 0xC3, 0xF8, 0x00, 0x3F, 0x82, 0xF8, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0xFE, 0x02, 0xFC, 0x02,
-    0xFC, 0x01, 0xFC, 0x03, 0xF8, 0x01, 0xFC, 0x0B, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x01, 0xFD, 0x2F,
-    0xC0, 0x00, 0xFD, 0x7F, 0x80, 0x00, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40,
-    0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0xBF, 0xF4, 0x01, 0xFF,
-    0xE0, 0x03, 0xFF, 0xC0, 0x0B, 0xEF, 0x80, 0x2F, 0xBF, 0x00, 0x3F, 0x7E, 0x00, 0xFE, 0xFC, 0x00,
-    0xFC, 0xFC, 0x0B, 0xDF, 0xE0, 0x07, 0xF3, 0xF0, 0x3F, 0x3F, 0x40, 0x2F, 0xCF, 0xC2, 0xF1, 0xFC,
-    0x00, 0xFE, 0x3F, 0x1F, 0x8B, 0xF0, 0x03, 0xF4, 0xFC, 0xFC, 0x2F, 0x80, 0x0F, 0xC3, 0xF7, 0xE0,
-    0xFE, 0x00, 0x7F, 0x0B, 0xFF, 0x03, 0xF4, 0x02, 0xF8, 0x2F, 0xF8, 0x1F, 0xC0, 0x0F, 0xE0, 0xBF,
-    0xC0, 0xBF, 0x00, 0x3F, 0x42, 0xFE, 0x03, 0xF8, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x00,
-    0xBF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xC0, 0x02, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xF8, 0x01, 0xFF,
-    0xF0, 0x03, 0xF4, 0x02, 0xFF, 0xF0, 0x07, 0xF0, 0x02, 0xFB, 0xF4, 0x0B, 0xF0, 0x03, 0xF6, 0xFC,
-    0x0B, 0xE0, 0x03, 0xF1, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFD, 0x0F, 0xD0, 0x0B, 0xF0, 0xFF, 0x1F,
-    0xC0, 0x0F, 0xE0, 0x7F, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x6F, 0x80, 0x0F, 0xC0, 0x3F, 0xFF, 0x40,
-    0x1F, 0xC0, 0x1F, 0xFF, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0x00, 0x3F,
-    0x40, 0x0B, 0xFE, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x05,
-    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE,
-    0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD, 0x3F,
-    0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03, 0xFC,
-    0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xE5, 0x57, 0xFC, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x07, 0xF8, 0x03, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x0F,
-    0xF0, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF8,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFE, 0x5B, 0xFC, 0x01, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x01, 0xFD, 0x03, 0xFC, 0x02, 0xFD, 0x03,
-    0xF8, 0x03, 0xFC, 0x07, 0xF9, 0x6F, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFA, 0xA4, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0x45, 0x54, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0xBF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x85, 0x5F, 0xF5,
-    0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0xBF, 0x43, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x3F,
-    0xC0, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFD, 0xFF, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0x42, 0xFC, 0x1F, 0xF0, 0xFF, 0x00, 0xFE, 0x02, 0xFC,
-    0x3F, 0x40, 0x3F, 0x40, 0x7F, 0x5F, 0xC0, 0x1F, 0xC0, 0x1F, 0xDB, 0xF0, 0x07, 0xF0, 0x07, 0xF2,
-    0xFC, 0x02, 0xF8, 0x03, 0xFC, 0x7F, 0x80, 0xFE, 0x02, 0xFD, 0x0F, 0xF9, 0x7F, 0x5B, 0xFE, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6B, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x3F, 0xD0, 0x00, 0x0F,
-    0xE0, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x07, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xEF, 0xD0, 0x00, 0x00, 0x7F, 0x8F, 0xF0, 0x00,
-    0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x1F,
-    0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x7F, 0x03, 0xF8,
-    0x0F, 0xE0, 0x2F, 0xC0, 0xFD, 0x03, 0xF4, 0x0F, 0xE0, 0x7F, 0x01, 0xFD, 0x03, 0xF4, 0x2F, 0xC0,
-    0xBF, 0x01, 0xFC, 0x0F, 0xE0, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0xFD, 0x03,
-    0xF4, 0x0F, 0xD0, 0x3F, 0x41, 0xFC, 0x0B, 0xF0, 0x0F, 0xF0, 0xBF, 0x0B, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFD,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x2F, 0xF0,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x01, 0xFD, 0x07, 0xF8,
-    0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x7F, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x03,
-    0xF8, 0x07, 0xF4, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00,
-    0x2F, 0xC0, 0xFE, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xE1, 0xFF, 0xF8, 0x2F, 0xFF, 0x47, 0xFF, 0xD0,
-    0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x46, 0x80, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0x0F,
-    0xF8, 0x3F, 0xC0, 0x7F, 0x47, 0xF4, 0x07, 0xF0, 0xBF, 0x00, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFE,
-    0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xD0, 0xFF, 0x03, 0xFD, 0x0B, 0xFE, 0xFF, 0xF8, 0x7F, 0xFE, 0xFF,
-    0x81, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x7F, 0x40, 0xFF,
-    0x00, 0xBF, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0xFE, 0x1B, 0xF8, 0x01, 0xFD, 0xBF, 0xD0,
-    0x02, 0xFC, 0xBF, 0x80, 0x03, 0xFC, 0x6F, 0xF0, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xFC,
-    0x07, 0xF4, 0x03, 0xFC, 0x0B, 0xF0, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x1F, 0xEF, 0xFF, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0xAA, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFE, 0x7F, 0x01, 0xFD, 0x7F, 0x02, 0xFC, 0x3F,
-    0x03, 0xFC, 0x3F, 0x03, 0xF4, 0x3F, 0x0B, 0xF0, 0x3F, 0x0F, 0xD0, 0x3F, 0x2F, 0xC0, 0x2F, 0xBF,
-    0x00, 0x2F, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x3F, 0x80, 0x30,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xD0, 0x2F, 0xD0,
-    0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80, 0x2F, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80,
-    0x2F, 0xFB, 0xFF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x02, 0xFF, 0xFE, 0x07, 0xFF, 0xFD, 0x0B, 0xF0, 0x08, 0x0B, 0xE0, 0x00, 0x07,
-    0xF5, 0x40, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x2F, 0xE5, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40,
-    0x10, 0x7F, 0xEB, 0xF0, 0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x7E, 0x00, 0x3F, 0x3F, 0xFC, 0x03, 0xFB, 0xFF, 0xE0,
-    0x7F, 0xE1, 0xFF, 0x0B, 0xFC, 0x0F, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x0F, 0xD0, 0xFE, 0x01,
-    0xFD, 0x1F, 0xD0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x03, 0xF4, 0x3F,
-    0x40, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFA, 0xFE, 0x07, 0xF4, 0x3F, 0xC3, 0xFC, 0x0B, 0xF1, 0xFD,
-    0x02, 0xFC, 0xBF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xDF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFD, 0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCF, 0xE0, 0x1F, 0xE3, 0xF8, 0x0B, 0xF0, 0xFF,
-    0x07, 0xF8, 0x1F, 0xEB, 0xFC, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA0, 0x0F, 0xE0, 0x1F, 0xD0, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x40,
-    0xBF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFC, 0xBF, 0xFC, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xA8,
-    0x02, 0xA8, 0x03, 0xF8, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xD0, 0x07, 0xF4, 0xFF, 0x40, 0x0B, 0xF2,
-    0xFD, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x2F, 0xD7, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x7F, 0x40,
-    0xFF, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0xFE, 0x2F, 0x80, 0x01, 0xFD,
-    0x2F, 0xC0, 0x03, 0xFC, 0x1F, 0xC0, 0x07, 0xF4, 0x1F, 0xD0, 0x0F, 0xF0, 0x0F, 0xFC, 0x2F, 0xD0,
-    0x0F, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xA9, 0x00, 0xFF,
-    0x00, 0xFE, 0x00, 0xFE, 0x01, 0xFD, 0x01, 0xFD, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFC,
-    0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF8, 0x07, 0xF4, 0x07, 0xF4, 0x0F, 0xF0, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xF0, 0x0F, 0xFE, 0xFF, 0xFC, 0x0F, 0xFF, 0xEB, 0xFC, 0x1F, 0xEF,
-    0x83, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xAA, 0xBF, 0x00, 0xFE,
-    0xBF, 0x00, 0xFE, 0x7F, 0x01, 0xFD, 0x7F, 0x02, 0xFC, 0x3F, 0x03, 0xFC, 0x3F, 0x03, 0xF4, 0x3F,
-    0x0B, 0xF0, 0x3F, 0x0F, 0xD0, 0x3F, 0x2F, 0xC0, 0x2F, 0xBF, 0x00, 0x2F, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xE9, 0x00,
-    0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0x90, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x7F, 0xE5, 0x40, 0x07, 0xF8, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xBF, 0xC3, 0xFC, 0x3F,
-    0xC0, 0x7F, 0x5F, 0xD0, 0x0F, 0xEB, 0xF0, 0x03, 0xF7, 0xFC, 0x01, 0xFD, 0xFF, 0x00, 0xBF, 0x3F,
-    0xC0, 0x3F, 0xCB, 0xF0, 0x2F, 0xD1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0x80, 0xFF, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFD, 0x03, 0xF8, 0x00,
-    0x2F, 0xC0, 0x7F, 0x40, 0x02, 0xFC, 0x07, 0xFE, 0xC0, 0x3F, 0xC0, 0x3F, 0xFC, 0x03, 0xF8, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x3F, 0xD3, 0xFC, 0x01, 0xFD, 0x07, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0x80,
-    0x7F, 0x40, 0xFE, 0x02, 0xFD, 0x07, 0xF4, 0x0F, 0xF0, 0x2F, 0xC0, 0x7F, 0xC0, 0xFF, 0x43, 0xFD,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0x7F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x02, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x1F, 0xF4, 0x14, 0x3F, 0xC0,
-    0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0xBF, 0xD0, 0x00, 0x3F, 0xF9, 0x00, 0x1F, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xE0, 0x00,
-    0x1F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAA, 0xA9, 0x00, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFD, 0x2F, 0x80, 0x0F, 0xF0,
-    0x1F, 0xC0, 0x1F, 0xD0, 0x0F, 0xD0, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0,
-    0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xC0, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xBF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFD, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x80, 0xFE, 0x01, 0xFD, 0x1F, 0xD0,
-    0x1F, 0xD1, 0xFC, 0x01, 0xFD, 0x2F, 0xC0, 0x1F, 0xD3, 0xFC, 0x01, 0xFD, 0x3F, 0x80, 0x2F, 0xC7,
-    0xF4, 0x03, 0xFC, 0xBF, 0x00, 0x3F, 0x8B, 0xF0, 0x0B, 0xF4, 0xBF, 0x01, 0xFF, 0x07, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xF4, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1B, 0xE4,
-    0x00, 0x3F, 0x47, 0xFF, 0xE0, 0x0F, 0xF8, 0xFF, 0xFF, 0x42, 0xFE, 0x1F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xF8, 0x2F, 0xC7, 0xF4, 0x3F, 0x82, 0xFC, 0xBF, 0x03, 0xF4, 0x2F, 0xCF, 0xF0, 0x7F, 0x03, 0xFC,
-    0xFF, 0x0B, 0xF0, 0x7F, 0x8B, 0xF0, 0xFE, 0x0F, 0xF4, 0x7F, 0x8F, 0xD3, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x0A, 0x90, 0x1F, 0xF4, 0x02, 0xFC, 0x02,
-    0xFF, 0xC0, 0x3F, 0x40, 0x16, 0xFC, 0x0F, 0xE0, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0xFE, 0x3F,
-    0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x03, 0xF8,
-    0x3F, 0xC0, 0x00, 0xBF, 0x02, 0xFF, 0xC0, 0x1F, 0xD0, 0x1F, 0xF8, 0x03, 0xF8, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2A, 0x81, 0xFC,
-    0x1A, 0x80, 0xFE, 0x0B, 0xF0, 0xBF, 0x07, 0xF4, 0x3F, 0x82, 0xFC, 0x1F, 0xC0, 0xFD, 0x0B, 0xF0,
-    0xBF, 0x07, 0xF4, 0x2F, 0xC3, 0xFC, 0x2F, 0xC0, 0xFF, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x7F, 0x43,
-    0xF8, 0x1F, 0xD2, 0xFC, 0x0F, 0xD0, 0xBF, 0x0B, 0xF0, 0x7F, 0x03, 0xFC, 0x2F, 0xD2, 0xFC, 0x3F,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x02,
-    0xA0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x2F, 0xC0, 0x15, 0x01, 0xFC, 0x3F, 0x40, 0x7E, 0x01, 0xFC, 0x7F, 0x00, 0xBD, 0x01, 0xFC, 0x7F,
-    0x00, 0xFD, 0x02, 0xFC, 0xBF, 0x00, 0xFC, 0x03, 0xF8, 0xBF, 0x01, 0xFC, 0x03, 0xF4, 0x7F, 0x03,
-    0xFC, 0x0F, 0xF0, 0x3F, 0xEF, 0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0x3F, 0xFF, 0x80, 0x0B, 0xFC, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x0F, 0xE0,
-    0x3F, 0x40, 0x0B, 0xF9, 0x5F, 0xD0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xBF, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F,
-    0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7E, 0x46,
-    0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8,
-    0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0,
-    0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x17, 0xF0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F,
-    0xEF, 0x80, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00,
-    0xFE, 0x0F, 0xC0, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x2F, 0xE5, 0x7F, 0x40,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xFC, 0x00, 0x2F,
-    0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x06,
-    0xA0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x05, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF,
-    0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7D, 0x00, 0x00, 0x01, 0xFF, 0xE1,
-    0x00, 0x00, 0x00, 0x7E, 0x1F, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x03, 0xF5,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x0B, 0xF9, 0x5F, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF,
-    0x8B, 0xC0, 0x00, 0xBF, 0xF1, 0x40, 0x00, 0x7E, 0x3E, 0x00, 0x00, 0x7D, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF9, 0x1A, 0x40, 0x03, 0xFF, 0xDF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x7F, 0x80, 0x7F, 0x40, 0x2F, 0xD0, 0x1F, 0xC0,
-    0x0F, 0xF0, 0x0B, 0xF0, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFB, 0xF0, 0x00, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0xC0,
-    0x00, 0x01, 0x7F, 0xF8, 0x00, 0x00, 0x7E, 0x1F, 0x00, 0x00, 0x29, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F,
-    0xEF, 0x80, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00,
-    0xFE, 0x0F, 0xC0, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x2F, 0xE5, 0x7F, 0x40,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x02, 0xFC, 0x00, 0x2F,
-    0xC0, 0xFE, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x15, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x8B, 0xF8, 0x00, 0x16, 0xFF, 0xC0, 0x00, 0x7E, 0x3E, 0x00,
-    0x1F, 0x40, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF,
-    0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0xFC, 0xB4, 0x00,
-    0x00, 0x1F, 0xFE, 0x10, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x03, 0xF5, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xE0,
-    0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0B, 0xF8, 0xF8, 0x00, 0x2F, 0xFC,
-    0x90, 0x00, 0xBE, 0x3E, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46,
-    0x90, 0x03, 0xFF, 0xDF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0xFF, 0xC0, 0x3F, 0xC0, 0x7F,
-    0x80, 0x7F, 0x80, 0x7F, 0x40, 0xBF, 0x40, 0x7F, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0xFE,
-    0x00, 0xFF, 0x01, 0xFE, 0x00, 0xFF, 0x03, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0xFC,
-    0x00, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01,
-    0xFE, 0x6D, 0x00, 0x00, 0x3E, 0xFF, 0xC0, 0x00, 0x02, 0x41, 0x90, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0A, 0x40, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x7F, 0x0F,
-    0xC0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x0B,
-    0xF9, 0x5F, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x80,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x3C, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0x07,
-    0xE0, 0x00, 0x06, 0xA4, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7E, 0x7E, 0x00, 0x1F, 0x41, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF,
-    0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4, 0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0,
-    0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0,
-    0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0xBF, 0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xD3, 0xF0, 0x02, 0xF0, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F,
-    0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF,
-    0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC,
-    0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x10, 0xF5, 0x40, 0x00, 0x07, 0x84, 0x3C, 0x00, 0x00, 0x3E, 0x6F, 0x40,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
-    0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x10, 0xF1, 0x00, 0x0B, 0x28, 0x78, 0x00, 0xBD, 0x2F, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x90, 0x3F, 0xFD,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF,
-    0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x11, 0xE1, 0x40, 0x00, 0x07, 0x85,
-    0x3C, 0x00, 0x00, 0x3E, 0x6F, 0x40, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07,
-    0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0xBF, 0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x13, 0xC1, 0x00, 0x0B,
-    0x09, 0x78, 0x00, 0x7D, 0x2F, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x06, 0x90, 0x3F, 0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0,
-    0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F,
-    0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x01, 0x0F, 0x54, 0x00, 0x00, 0x78, 0x83, 0xC0, 0x00, 0x03, 0xE6, 0xF4,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0xF8, 0x00,
-    0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xE0,
-    0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x0B, 0xF9, 0x5F, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x0F, 0xE0, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x1B, 0x40, 0x00, 0x11, 0xF1, 0x00, 0x0B, 0x28, 0x78, 0x00, 0xBD, 0x2F,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x90, 0x3F,
-    0xFD, 0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4,
-    0xBF, 0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0xFF, 0x6D, 0x00, 0x00, 0x3E, 0xBF, 0xC0, 0x00, 0x01,
-    0x40, 0x50, 0x00, 0x00, 0x74, 0x02, 0xC0, 0x00, 0x03, 0xE5, 0xBC, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x03, 0xF5, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0xFC, 0x00, 0x02, 0xFC, 0x0F,
-    0xC0, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x0B, 0xF9, 0x5F, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0xBF,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x2C, 0x00, 0x3E, 0xFF, 0x80, 0x06, 0x02, 0x90, 0x00, 0xA0, 0x02, 0x80, 0x0B, 0x91, 0xF8, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x69, 0x03, 0xFF, 0xDF,
-    0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xF4, 0xFF, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x4B, 0xF4,
-    0x07, 0xF0, 0xFF, 0x00, 0xBF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF, 0x01, 0xFE, 0x0F, 0xF0, 0x3F, 0xD0,
-    0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xEF, 0xC0, 0x1F, 0xF5, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xC0, 0x00, 0x2F, 0xC0,
-    0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xBF, 0x95, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x0B,
-    0xF0, 0x2F, 0xC0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xBF, 0xBF, 0x40,
-    0x03, 0xFF, 0xF0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x46, 0x90, 0x3F, 0xFD,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xC1, 0xFF, 0x4F, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x07, 0xF4, 0xBF,
-    0x40, 0x7F, 0x0F, 0xF0, 0x0B, 0xF0, 0xFF, 0x00, 0xFE, 0x0F, 0xF0, 0x1F, 0xE0, 0xFF, 0x03, 0xFD,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x3F, 0xFE, 0xFC, 0x01, 0xFF, 0x5F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0x95, 0x50, 0x01,
-    0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0x55, 0x50, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF,
-    0x40, 0xBF, 0xFF, 0xF0, 0x7F, 0x81, 0xFD, 0x3F, 0xC0, 0x7F, 0x1F, 0xD0, 0x7F, 0xCB, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0x80, 0xFF, 0xA5, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x01, 0x01, 0xFF, 0xAB,
-    0xD0, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xE5, 0x54, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0x54, 0x00, 0xFF,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x5F, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC1, 0xFE, 0x07, 0xF4, 0xFF, 0x01, 0xFC,
-    0x7F, 0x41, 0xFF, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFE, 0x03, 0xFE, 0x94, 0x00, 0xFF, 0x00, 0x00,
-    0x2F, 0xC0, 0x04, 0x07, 0xFE, 0xAF, 0x40, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xBF, 0xF4, 0x00, 0x3C, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFE, 0x55, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xF5, 0x55,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x2E, 0x03,
-    0xC0, 0x0F, 0xFF, 0xFC, 0x02, 0xFB, 0xFF, 0x40, 0x2C, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF0, 0x1F, 0xE0, 0x7F, 0x43, 0xFC, 0x07, 0xF0,
-    0x7F, 0x41, 0xFF, 0x0B, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x0F, 0xFA, 0x50, 0x00, 0xFF, 0x00,
-    0x00, 0x0B, 0xF0, 0x01, 0x00, 0x7F, 0xEA, 0xF4, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xF4,
-    0xF8, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0xA4, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xE5, 0x54, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xD5, 0x54, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0xFF, 0x4B, 0xC0, 0x00, 0xFF, 0xF1, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x00,
-    0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x07, 0xF4, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x7F, 0x41, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x94, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x04, 0x00, 0x07, 0xFE, 0xAF, 0x40, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x0F, 0x0F, 0xF4, 0x00, 0x05, 0xFF, 0xF0, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0xA4, 0x06, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xE5,
-    0x54, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0x54, 0x00, 0xFF, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0xFF, 0x40,
-    0x05, 0xFF, 0xF0, 0x00, 0xBD, 0x7D, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x02, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xC1, 0xFE, 0x07, 0xF4, 0xFF, 0x01, 0xFC, 0x7F, 0x41, 0xFF,
-    0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFE, 0x03, 0xFE, 0x94, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x04,
-    0x07, 0xFE, 0xAF, 0x40, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xF5, 0xE0,
-    0x00, 0x03, 0xFF, 0xC4, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x29, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xE5, 0x54, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xF5, 0x55, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x0F, 0xF4, 0xF4, 0x00, 0x3F, 0xFC, 0x80, 0x00, 0xFD, 0x7D, 0x00, 0x02, 0xE0, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x1F,
-    0xE0, 0x7F, 0x40, 0x3F, 0xC0, 0x7F, 0x00, 0x7F, 0x41, 0xFF, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xA5, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x00, 0x7F,
-    0xEA, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xE0, 0x00, 0xBB, 0xFF, 0x00, 0x02, 0x41, 0xA0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x0A, 0x40, 0x68, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFE, 0x55, 0x40,
-    0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x03, 0xFD, 0x55, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xE0, 0x0B, 0xFF, 0xF4, 0x03,
-    0xC2, 0xF4, 0x00, 0x0A, 0xA0, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xDB, 0xC0, 0x0B, 0x80, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0x2F, 0xFF, 0xFC, 0x1F, 0xE0, 0x7F, 0x4F,
-    0xF0, 0x1F, 0xC7, 0xF4, 0x1F, 0xF2, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x3F, 0xE9, 0x40, 0x0F,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x40, 0x7F, 0xEA, 0xF4, 0x0F, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07,
-    0xF1, 0xFC, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xF9, 0x55, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF5, 0x55, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xF4,
-    0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x0B, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0x07, 0xF8, 0x1F, 0xD3, 0xFC, 0x07, 0xF1, 0xFD, 0x07, 0xFC, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF8, 0x0F, 0xFA, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x10, 0x1F, 0xFA, 0xBD, 0x03, 0xFF,
-    0xFF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x7D, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80,
-    0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF,
-    0x40, 0xBF, 0xFF, 0x40, 0x00, 0xAA, 0x00, 0x0F, 0xFC, 0x00, 0x5F, 0xC0, 0x00, 0xFC, 0x00, 0x7F,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00,
-    0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFC,
-    0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00,
-    0xFF, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F,
-    0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0x40, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4,
-    0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B,
-    0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40, 0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00,
-    0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0xBF, 0xC3, 0xFC, 0x3F, 0xC0, 0x7F, 0x5F, 0xD0, 0x0F,
-    0xEB, 0xF0, 0x03, 0xF7, 0xFC, 0x01, 0xFD, 0xFF, 0x00, 0xBF, 0x3F, 0xC0, 0x3F, 0xCB, 0xF0, 0x2F,
-    0xD1, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xE0, 0x2F, 0xF0, 0x3F, 0xE0, 0x03,
-    0xFC, 0x1F, 0xF0, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x1F, 0xD3, 0xFC, 0x00, 0x07, 0xF4, 0xFE, 0x00,
-    0x01, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x1F, 0xF1, 0xFD,
-    0x00, 0x0B, 0xF4, 0x7F, 0xC0, 0x07, 0xFC, 0x0F, 0xF8, 0x0B, 0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0x0F,
-    0xF0, 0xFF, 0x01, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xC0, 0x0F, 0xDF, 0xF0, 0x07, 0xF7, 0xFC, 0x02,
-    0xFC, 0xFF, 0x00, 0xFF, 0x2F, 0xC0, 0xBF, 0x47, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x00, 0x0A,
-    0x40, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x3F, 0xC0, 0x00, 0x7F, 0x40,
-    0x3F, 0x80, 0x00, 0x7F, 0x40, 0x7F, 0x40, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0xBF,
-    0x40, 0x01, 0xFF, 0x00, 0x7F, 0x40, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xE0,
-    0x2F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0xFF, 0x4B, 0xC0, 0x00, 0xFF, 0xF1, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x00, 0xB8, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x2F, 0xC0,
-    0x0F, 0xD0, 0x0F, 0xF0, 0x07, 0xF4, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x2F,
-    0xC0, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xC7,
-    0xFD, 0x00, 0x00, 0x17, 0xFF, 0xC0, 0x00, 0x03, 0xF1, 0xF4, 0x00, 0x02, 0x90, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x3F, 0xE0, 0x2F, 0xF0, 0x3F, 0xE0, 0x03, 0xFC, 0x1F, 0xF0, 0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x1F,
-    0xD3, 0xFC, 0x00, 0x07, 0xF4, 0xFE, 0x00, 0x01, 0xFD, 0x7F, 0x40, 0x00, 0xBF, 0x6F, 0xD0, 0x00,
-    0x3F, 0xCB, 0xF4, 0x00, 0x1F, 0xF1, 0xFD, 0x00, 0x0B, 0xF4, 0x7F, 0xC0, 0x07, 0xFC, 0x0F, 0xF8,
-    0x0B, 0xFD, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF4, 0xFF, 0x40, 0x05, 0xFF,
-    0xF0, 0x00, 0xBD, 0x7D, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x03, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0x0F, 0xF0, 0xFF, 0x01, 0xFD, 0x7F, 0x40, 0x3F, 0xAF, 0xC0,
-    0x0F, 0xDF, 0xF0, 0x07, 0xF7, 0xFC, 0x02, 0xFC, 0xFF, 0x00, 0xFF, 0x2F, 0xC0, 0xBF, 0x47, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0xF1, 0xE0, 0x00,
-    0x01, 0xFF, 0xE1, 0x00, 0x00, 0x1F, 0x87, 0xD0, 0x00, 0x00, 0xA4, 0x06, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x02, 0xFD,
-    0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x3F, 0x80, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x02,
-    0xFD, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F, 0x40, 0x02, 0xFD, 0x01,
-    0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x0F, 0xF4, 0xF4, 0x00, 0x3F, 0xFC,
-    0x80, 0x00, 0xFD, 0x7D, 0x00, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x3F, 0xC0, 0x7F,
-    0x40, 0x7F, 0x40, 0x3F, 0x80, 0xBF, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0xBF,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F,
-    0x9B, 0x80, 0x00, 0x3E, 0xFF, 0xC0, 0x00, 0x09, 0x06, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x29, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF,
-    0x03, 0xFE, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x01, 0xFD, 0x3F, 0xC0, 0x00,
-    0x7F, 0x4F, 0xE0, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x03, 0xFC, 0xBF, 0x40,
-    0x01, 0xFF, 0x1F, 0xD0, 0x00, 0xBF, 0x47, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0xBF, 0xD0, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xF0, 0x07, 0xFF, 0xF4, 0x03, 0xC1, 0xF4, 0x00, 0x06, 0xA0,
-    0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xDB, 0xD0, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x2F, 0xF0, 0xFF, 0x0F, 0xF0, 0x1F, 0xD7, 0xF4, 0x03,
-    0xFA, 0xFC, 0x00, 0xFD, 0xFF, 0x00, 0x7F, 0x7F, 0xC0, 0x2F, 0xCF, 0xF0, 0x0F, 0xF2, 0xFC, 0x0B,
-    0xF4, 0x7F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x1F, 0x80, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x02,
-    0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x1F, 0xD3, 0xF8, 0x00, 0x07, 0xF5, 0xFD, 0x00,
-    0x02, 0xFD, 0xBF, 0x40, 0x00, 0xFF, 0x2F, 0xD0, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x2F, 0xD1, 0xFF,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x2F, 0xF4, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xF4, 0xFC, 0x03, 0xE0, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x0B, 0xFC, 0x3F, 0xC3, 0xFC,
-    0x07, 0xF5, 0xFD, 0x00, 0xFE, 0xBF, 0x00, 0x3F, 0x7F, 0xC0, 0x1F, 0xDF, 0xF0, 0x0B, 0xF3, 0xFC,
-    0x03, 0xFC, 0xBF, 0x02, 0xFD, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF9, 0x07, 0xF4, 0x01, 0xFF, 0xFF, 0xE3, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x01,
-    0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0x07,
-    0xF4, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0x80, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x2F, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1A, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0x80, 0x3F, 0xFF, 0xDF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F,
-    0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xBF,
-    0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF9, 0x07, 0xF4, 0x01, 0xFF, 0xFF, 0xE3, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x00,
-    0x7F, 0xC0, 0x01, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xD0, 0x03,
-    0xF8, 0x00, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x00, 0x1F,
-    0xD0, 0x00, 0x3F, 0x80, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1A,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0x80, 0x3F, 0xFF, 0xDF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x07, 0xF4, 0x03, 0xF8, 0x00,
-    0xBF, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xFE, 0x41, 0xFD, 0x00, 0x7F, 0xFF, 0xF8, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xE0,
-    0x2F, 0xFF, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x40, 0x0B, 0xF4, 0x00,
-    0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x00,
-    0xBF, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x0B,
-    0xF4, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x01, 0xA8, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x06, 0xFE, 0x03, 0xF8, 0x03, 0xFF, 0xFD, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xF0, 0xFF, 0xD0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF4,
-    0x00, 0xFF, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0B, 0xF0,
-    0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1E, 0x00, 0x00, 0x02, 0xFF, 0xEF, 0x40, 0x00,
-    0x00, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x74, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0xE4, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0x8F, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFE, 0x02, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xBF,
-    0x40, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x07, 0xF4,
-    0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFE, 0x00, 0x1F, 0xD0,
-    0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x42, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x01, 0xFB, 0xFF, 0x40,
-    0x00, 0x2C, 0x07, 0xD1, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x06, 0xFE, 0x03, 0xF8, 0x03, 0xFF,
-    0xFD, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF0, 0xFF, 0xD0, 0x03, 0xFC, 0x07, 0xF4, 0x00,
-    0x7F, 0x40, 0x3F, 0x80, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0B, 0xF0, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xE4, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0x8F, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x07,
-    0xF4, 0x00, 0xBF, 0x40, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x1F,
-    0xD0, 0x07, 0xF4, 0x00, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xFE,
-    0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x6F, 0xE0, 0x3F, 0x80, 0x3F,
-    0xFF, 0xDF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x7F, 0x40,
-    0x07, 0xF4, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x07, 0xF4, 0x00, 0xFF, 0x00,
-    0xBF, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xBF, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0xFF, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00,
-    0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x01, 0xFE, 0x03, 0xFC,
-    0x00, 0x7F, 0x40, 0xFE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x03,
-    0xFD, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0A, 0xA0, 0x0A, 0x90, 0xFE, 0x00,
-    0xFD, 0x1F, 0xD0, 0x1F, 0xC1, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x3F,
-    0x80, 0x7F, 0x47, 0xF4, 0x0B, 0xF0, 0x7F, 0x00, 0xFF, 0x0B, 0xF0, 0x1F, 0xE0, 0xBF, 0x03, 0xFE,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x3F, 0xFD, 0xFC, 0x01, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x01, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x03, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-    0xBF, 0x40, 0x0F, 0xE0, 0x2F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0xBF,
-    0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x1F, 0xE0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x05, 0xBE, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0xA9, 0x0F, 0xE0, 0x0F, 0xD1, 0xFD,
-    0x01, 0xFC, 0x1F, 0xC0, 0x2F, 0xC2, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0x83, 0xF8, 0x07, 0xF4,
-    0x7F, 0x40, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0xBF, 0x01, 0xFE, 0x0B, 0xF0, 0x3F, 0xE0, 0xBF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xDF, 0xC0, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x07, 0xF4, 0xFE, 0x00, 0xFE, 0x00, 0x2F, 0xCB, 0xF0, 0x03, 0xF8, 0x00, 0xBF, 0xFF, 0x40,
-    0x1F, 0xD0, 0x03, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xF9, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x3F,
-    0x80, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0xFE, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F,
-    0xE0, 0x0F, 0xEF, 0xF0, 0x1F, 0xD0, 0x1F, 0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF,
-    0x00, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x07, 0xF4, 0xFE, 0x00, 0xFE, 0x00,
-    0x2F, 0xCB, 0xF0, 0x03, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xD0, 0x03, 0xFF, 0xF4, 0x00, 0xBF,
-    0x00, 0x0F, 0xF9, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00,
-    0x7F, 0x40, 0x0F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xA8, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F, 0xE0, 0x0F, 0xEF, 0xF0, 0x1F, 0xD0, 0x1F,
-    0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0x80,
-    0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00,
-    0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x1F, 0xD3, 0xF8, 0x03, 0xF8, 0x00, 0xBF,
-    0x2F, 0xC0, 0x0F, 0xE0, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0x40, 0x0F, 0xFF, 0xD0, 0x02, 0xFC, 0x00,
-    0x3F, 0xE4, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x01, 0xFD,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00,
-    0xFF, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00,
-    0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x05,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F, 0xE0, 0x0F, 0xEF,
-    0xF0, 0x1F, 0xD0, 0x1F, 0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x7F,
-    0x00, 0xFF, 0x00, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x00, 0x01, 0xFB,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0x41, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0B,
-    0xF0, 0x01, 0xFD, 0x3F, 0x80, 0x3F, 0x80, 0x0B, 0xF2, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xFF, 0xD0,
-    0x07, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x40, 0x00, 0xFF, 0x00, 0x1F, 0xD0,
-    0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x0F,
-    0xE0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80,
-    0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xD0,
-    0x00, 0x00, 0xFF, 0xFB, 0xC0, 0x00, 0x01, 0xFB, 0xFF, 0x80, 0x00, 0x02, 0xD0, 0x7D, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F, 0xE0, 0x0F, 0xEF, 0xF0, 0x1F,
-    0xD0, 0x1F, 0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x3F, 0x80, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x7F, 0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x01, 0xFD, 0x3F, 0x80, 0x3F, 0x80, 0x0B, 0xF2,
-    0xFC, 0x00, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x07, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x03,
-    0xFE, 0x40, 0x00, 0xFF, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xD0,
-    0x03, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-    0xF0, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x00,
-    0x07, 0xF8, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x0A, 0xA0, 0x0A, 0x93, 0xF8, 0x0F,
-    0xE0, 0x0F, 0xEF, 0xF0, 0x1F, 0xD0, 0x1F, 0xFF, 0xC0, 0x1F, 0xC0, 0x2F, 0xF9, 0x00, 0x2F, 0xC0,
-    0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0xBF,
-    0x00, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x0B, 0xF4, 0x3F, 0x80, 0x7F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x02, 0xFC, 0x2F, 0xD0, 0x07, 0xF4, 0xFE, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x80, 0x0A, 0xA0, 0x0B, 0xF0, 0x07, 0xF8, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0x7F,
-    0x01, 0xFE, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x00, 0xFE, 0x2F, 0xC0, 0x00,
-    0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x01, 0xFB, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF1, 0xFD, 0x00, 0xBF, 0x43, 0xF8,
-    0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xC2, 0xFD, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFD, 0xFF,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0xA8, 0x00, 0xAA, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x07, 0xF0,
-    0x1F, 0xE0, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x3F, 0x43, 0xF8, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x02,
-    0xF8, 0xFD, 0x00, 0x00, 0xBE, 0xBF, 0x00, 0x00, 0x1F, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xFC, 0x14, 0x00, 0x02, 0xFE, 0x3F, 0x80, 0x2F, 0xFF, 0x1F, 0xE0, 0x0B, 0xFF, 0x03,
-    0xF4, 0x02, 0xFD, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0x2F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x03, 0xFC, 0x7F, 0x40, 0x2F, 0xD0, 0xFE, 0x01, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x0B,
-    0xF0, 0xBF, 0x40, 0x1F, 0xD3, 0xF8, 0x00, 0x3F, 0x7F, 0xC0, 0x00, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x05, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA0, 0x02, 0xA8, 0x02, 0xFC, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x1F,
-    0xC0, 0x7F, 0x80, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x3F, 0x8B, 0xF0, 0x00,
-    0x0B, 0xE3, 0xF4, 0x00, 0x02, 0xFA, 0xFC, 0x00, 0x00, 0x7E, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07, 0x80, 0x07, 0xFF, 0xBD, 0x00, 0x3E,
-    0xFF, 0xF0, 0x00, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC7, 0xF4, 0x02,
-    0xFD, 0x0F, 0xE0, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xBF, 0x0B, 0xF4, 0x01, 0xFD, 0x3F, 0x80,
-    0x03, 0xF7, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x3C, 0x00, 0x03, 0xFF, 0xBF, 0x00, 0x02, 0xFB, 0xFF, 0x40, 0x00, 0xF0, 0x2E, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x2A, 0x80, 0x2F, 0xC0, 0x1F, 0xE0, 0x07, 0xF0, 0x0F, 0xF0,
-    0x01, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x0F, 0xD0, 0xFE, 0x00, 0x03, 0xF8, 0xBF,
-    0x00, 0x00, 0xBE, 0x3F, 0x40, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x07, 0xEF, 0xD0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x2F, 0xFC,
-    0xA0, 0xD2, 0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0x00, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x05,
-    0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC2, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x6A, 0xAA,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D,
-    0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC,
-    0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03,
-    0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0xBC, 0x03, 0xDB, 0xC0, 0x3D, 0x68, 0x02, 0x90,
-    0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x6A,
-    0xAA, 0xA4, 0x02, 0xF0, 0x0F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x81, 0xFD, 0x01, 0x50, 0x00, 0x07,
-    0xF0, 0x3F, 0xC0, 0xFD, 0x0B, 0xE0, 0x3F, 0x01, 0xF8, 0x01, 0x40, 0x00, 0x03, 0xF8, 0x1F, 0xC0,
-    0xFE, 0x03, 0xF0, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B,
-    0xC0, 0x50, 0x02, 0xF0, 0x3E, 0x03, 0xF0, 0xFC, 0x0F, 0xD1, 0xFC, 0x1F, 0xC3, 0xF4, 0x3F, 0x87,
-    0xF0, 0x7F, 0x4F, 0xE0, 0x15, 0x05, 0x40, 0x07, 0xF0, 0xFE, 0x0F, 0xE1, 0xFC, 0x0F, 0xC2, 0xF8,
-    0x2F, 0x83, 0xF0, 0x3F, 0x0B, 0xE0, 0x7E, 0x0F, 0xC0, 0x14, 0x05, 0x00, 0x03, 0xF8, 0xBF, 0x01,
-    0xFC, 0x3F, 0x80, 0xFE, 0x1F, 0xC0, 0x3F, 0x0B, 0xE0, 0x2F, 0x83, 0xF0, 0x0F, 0xC1, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD7, 0xF0, 0xFD, 0x3F, 0x0F, 0xD3, 0xF0, 0xBD, 0x2F, 0x07, 0xE1,
-    0xF4, 0x3E, 0x05, 0x01, 0x40, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x5A, 0x7E, 0x68, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xAB, 0xEA, 0x80, 0x3F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xC0, 0x2A, 0xBD, 0xA8, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF4, 0x2F,
-    0xFC, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFD, 0x2F, 0xFC, 0x06, 0xA0, 0x08, 0x00, 0x0E,
-    0x00, 0x1F, 0xC0, 0x2F, 0xF0, 0x3F, 0xFC, 0x3F, 0xFD, 0x7F, 0xE0, 0xBE, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x0B, 0x83, 0xFD, 0x3F, 0xD3, 0xFC, 0x04, 0x00, 0x2E, 0x00, 0x7D, 0xBF, 0x81, 0xFF, 0xFF,
-    0x82, 0xFF, 0xBF, 0x01, 0xFD, 0x14, 0x00, 0x10, 0x2E, 0x00, 0xB8, 0x02, 0xE2, 0xFE, 0x0B, 0xF4,
-    0x3F, 0xCF, 0xF8, 0x3F, 0xD0, 0xFF, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x14, 0x00, 0x50, 0x01, 0x00,
-    0x0B, 0x83, 0xFC, 0x3F, 0xC3, 0xF8, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0x7D, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0x5F, 0x8B, 0xE0,
-    0x02, 0xF8, 0x1F, 0xEF, 0xCF, 0xDF, 0xFF, 0x03, 0xFF, 0xC3, 0xFF, 0xDF, 0xCF, 0xEF, 0xD3, 0xFB,
-    0xF4, 0x7F, 0xCB, 0xD7, 0xF2, 0xF5, 0xFC, 0x7E, 0x00, 0x07, 0xE3, 0xF4, 0xBD, 0xBD, 0x1F, 0x80,
-    0x03, 0xF0, 0xFC, 0x2F, 0x7F, 0x0B, 0xD0, 0x03, 0xF0, 0x3F, 0x0F, 0xCF, 0xC3, 0xF0, 0x02, 0xF4,
-    0x0F, 0xC3, 0xF3, 0xF0, 0xFC, 0x01, 0xF8, 0x03, 0xF7, 0xF4, 0xFD, 0xFD, 0x00, 0xFC, 0x00, 0xBF,
-    0xFC, 0x2F, 0xFF, 0x00, 0xFC, 0x00, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F,
-    0x5F, 0x8B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x07, 0xFB, 0xF3, 0xF7, 0xFF, 0xC0, 0xFF, 0xF0, 0x3F,
-    0xFC, 0x3F, 0xFD, 0xFC, 0xFE, 0xFD, 0x3F, 0xBF, 0x4F, 0xFF, 0xD1, 0xFF, 0x2F, 0x5F, 0xCB, 0xD7,
-    0xF1, 0xF9, 0xFC, 0x7E, 0x00, 0x07, 0xE3, 0xF4, 0xBD, 0xBD, 0x1F, 0xAF, 0x47, 0xE0, 0x00, 0xFC,
-    0x3F, 0x0B, 0xDF, 0xC2, 0xF7, 0xF0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0xFC, 0xFC, 0x3F, 0x3F, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x3F, 0x0F, 0xCF, 0xC3, 0xF3, 0xF0, 0xFC, 0x01, 0xF8, 0x03, 0xF7, 0xF4, 0xFD,
-    0xFD, 0x3F, 0x7F, 0x80, 0x3F, 0x00, 0x2F, 0xFF, 0x0B, 0xFF, 0xC2, 0xFF, 0xF0, 0x0F, 0xC0, 0x00,
-    0xFF, 0x80, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x01, 0xF8, 0x03, 0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x28, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x1F, 0x82, 0xF4, 0x03, 0xF0, 0x7F, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x03,
-    0xF0, 0x3E, 0x00, 0x28, 0x06, 0x80, 0x00, 0x00, 0xFD, 0x0F, 0xC1, 0xF8, 0x01, 0xF8, 0x2F, 0x43,
-    0xF0, 0x03, 0xF0, 0x7F, 0x0B, 0xE0, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x2F, 0x00,
-    0x3F, 0x03, 0xE0, 0x7D, 0x00, 0x28, 0x06, 0x80, 0x68, 0x00, 0x2F, 0x40, 0x7F, 0x00, 0xFD, 0x00,
-    0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x06, 0x40, 0x2F, 0x43, 0xF0, 0x07, 0xF0, 0xBE, 0x00, 0xFD, 0x0F,
-    0xC0, 0x0F, 0x81, 0xF4, 0x02, 0xF0, 0x3F, 0x00, 0x3D, 0x07, 0xC0, 0x06, 0x40, 0xA4, 0x2F, 0x43,
-    0xF0, 0x7F, 0x00, 0x7F, 0x0B, 0xE0, 0xFD, 0x00, 0xFD, 0x0F, 0xC1, 0xFC, 0x00, 0xF8, 0x1F, 0x42,
-    0xF0, 0x02, 0xF0, 0x3F, 0x03, 0xE0, 0x03, 0xD0, 0x7C, 0x0B, 0xC0, 0x06, 0x40, 0xA4, 0x0A, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x0F, 0x80, 0x07, 0xF0, 0x03, 0xDC, 0x02, 0xC7, 0x41, 0xE0, 0xE0,
-    0xF0, 0x38, 0xB4, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF4,
-    0x0B, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x09, 0x00,
-    0x00, 0x40, 0x0B, 0xC0, 0x0F, 0xE0, 0x0B, 0xF0, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF0,
-    0x2F, 0xD0, 0xBF, 0x40, 0x7E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x0F,
-    0xC0, 0x08, 0x00, 0xFC, 0x07, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0xFC, 0x0B, 0xF0, 0x03, 0xFC, 0x04,
-    0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xCB,
-    0xF0, 0x00, 0x1A, 0x03, 0xFF, 0xF0, 0x29, 0x0F, 0xE0, 0x3F, 0xF0, 0x1F, 0xC3, 0xF8, 0x0B, 0xFC,
-    0x07, 0xF4, 0xBC, 0x0B, 0xFF, 0xC0, 0xF8, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x3F,
-    0x80, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x2F, 0x03,
-    0xF8, 0x03, 0xF0, 0x1F, 0xD0, 0x3F, 0x00, 0x30, 0x07, 0xF4, 0x03, 0x40, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x01, 0xFE, 0x07, 0xF8, 0x0B, 0xF8, 0x2F, 0xD0, 0x2F, 0xD0, 0xFF, 0x00, 0xFF, 0x03, 0xFC,
-    0x03, 0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x40, 0x7F, 0x41, 0xFC, 0x02, 0xFC, 0x0B, 0xF0, 0x0B,
-    0xF0, 0x3F, 0x80, 0x3F, 0x80, 0xFD, 0x00, 0xFD, 0x03, 0xF0, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x1F, 0xE0, 0xBF, 0x40, 0xBF, 0x83, 0xFD,
-    0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x0B, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFC, 0x3F, 0xE7, 0xF4, 0x2F, 0x4F, 0xC0, 0xFC, 0x7F, 0x03, 0xF7, 0xF8, 0x0F,
-    0xFF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x40, 0x03, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x05, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x0C, 0x38, 0x00, 0x03, 0x81, 0xE0, 0x01, 0xE0, 0x0B, 0xEA, 0xF8, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x6F, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x01, 0xE0, 0xE0, 0x00, 0x1D, 0xA0, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0xF7, 0x40, 0x00, 0x3C, 0x34, 0x00, 0x07, 0x83, 0x80, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC1,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x0B, 0x0B, 0xE0, 0x64, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0xD0, 0x1F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0xE0, 0xF8, 0x00, 0x03, 0xD2, 0xF0, 0x00, 0xFF, 0xBD,
-    0x00, 0x02, 0xFE, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFD, 0xA8, 0x00, 0x3F, 0xF5, 0xA0, 0x1F, 0xEF, 0x00, 0x00, 0x3F,
-    0xBD, 0x00, 0x0F, 0xD3, 0xE0, 0x00, 0x3F, 0x8F, 0xC0, 0x01, 0xF0, 0xFC, 0x00, 0x03, 0xC2, 0xF4,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x3F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xFA, 0x40, 0x2F, 0x80, 0x00,
-    0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE4, 0x00,
-    0x3F, 0xF8, 0x00, 0xFF, 0xE0, 0x07, 0xF5, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xEA, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xD0, 0x06, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x05, 0xBE, 0x00, 0x7F, 0xF8, 0x01,
-    0xFF, 0xD0, 0x01, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0A, 0xFE, 0x00, 0x7F, 0xF4, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xFD, 0x02, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x0E, 0x02, 0xFD, 0x38, 0x0B, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0x80, 0x07, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0xD2, 0xFF, 0xFF, 0x80, 0xFF, 0x07,
-    0xFF, 0xFF, 0x03, 0xFC, 0x0E, 0x02, 0xFD, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x2F,
-    0xC2, 0xFC, 0x00, 0x02, 0xFE, 0x0B, 0xF0, 0x00, 0x7F, 0xE0, 0x3F, 0x80, 0x07, 0xFD, 0x00, 0xFD,
-    0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x3F, 0xC0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xFF, 0xD0, 0x02, 0xFE, 0x1F, 0xFF, 0xF8, 0x02,
-    0xFD, 0x0F, 0xFF, 0xFC, 0x03, 0xFC, 0x0E, 0x01, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x03, 0xF8,
-    0x00, 0x02, 0xFC, 0x07, 0xF4, 0x00, 0x0B, 0xF8, 0x0B, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xF0, 0x00,
-    0xFF, 0x80, 0x0F, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00,
-    0x7F, 0x80, 0x2F, 0xD0, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x04,
-    0x00, 0x05, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x79, 0xBF, 0xFF, 0x87, 0x87, 0xFF, 0xFC,
-    0x78, 0x7F, 0xFF, 0xD7, 0x87, 0xFF, 0xFD, 0x78, 0x7F, 0xFF, 0xD7, 0x87, 0xFF, 0xFD, 0x78, 0x7F,
-    0xFF, 0xC7, 0x87, 0xFF, 0xFC, 0x78, 0x7F, 0xFF, 0x47, 0x87, 0xFF, 0xD0, 0x78, 0x79, 0x50, 0x07,
-    0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80,
-    0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x78, 0x78, 0x00, 0x07, 0x87, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xEB, 0xC3, 0xFF, 0xFC,
-    0x3C, 0x7F, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF, 0xFF, 0xC3, 0xCB, 0xFF, 0xFC, 0x3C, 0xBF,
-    0xFF, 0xC3, 0xC7, 0xFF, 0xFC, 0x3C, 0x3F, 0xFF, 0xD7, 0xC1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xC0, 0x2A, 0xAA, 0xA4, 0x03, 0xFF, 0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xC3, 0xC3, 0xFF, 0xFD, 0x3C,
-    0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFE, 0x3C, 0x3F, 0xFF, 0xE3, 0xC3, 0xFF, 0xFE, 0x3C, 0x3F, 0xFF,
-    0xE3, 0xC3, 0xFF, 0xFD, 0x3D, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x40, 0x3D, 0x00, 0x3E, 0x1F, 0x00, 0x1F,
-    0xFF, 0xD5, 0x41, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x03, 0xFF, 0x45, 0x03, 0xFB, 0xF0, 0x02,
-    0xFC, 0xBD, 0x00, 0x1C, 0x1F, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x01, 0xF4, 0x0F, 0xF0, 0x7F, 0xC0,
-    0xFD, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x3F,
-    0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0xF4, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0xA0, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x03, 0x80, 0x00, 0x38, 0x00, 0x78, 0x00, 0x78, 0x00,
-    0x0B, 0xEA, 0xF8, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x80, 0xBC, 0x00, 0x01, 0xF8, 0xBC, 0x00, 0x02, 0xFF, 0xF9,
-    0x58, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0xFC, 0x14, 0x00, 0x7F, 0x7E,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x28, 0x2F, 0x40, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x14, 0x0F, 0x80, 0x00, 0x3F, 0x1F, 0x00,
-    0x00, 0x7F, 0xFF, 0x55, 0x40, 0x1B, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x45,
-    0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x1F, 0xCB, 0xD0, 0x00, 0x07, 0x03, 0xF0, 0x00, 0x00, 0x03, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xDF, 0xF4, 0x3F, 0x3F, 0xC1, 0xF4, 0x3E, 0x0F, 0xC0, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0xB8, 0x3F, 0x0B, 0xF5,
-    0xF8, 0x2F, 0xDB, 0xD0, 0x7F, 0x00, 0x00, 0x10, 0x00, 0xAA, 0x40, 0x00, 0x00, 0x14, 0x0B, 0xFF,
-    0xFF, 0x90, 0x00, 0x7C, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB, 0xF8, 0x7E, 0x41, 0xAF, 0xFF, 0xFF, 0xF0,
-    0xB8, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x0B, 0xFF, 0xC0, 0x03, 0xE4, 0x1F, 0x00, 0xE0, 0x00, 0x3C, 0x28, 0x00, 0x00, 0xC2, 0x00, 0x00,
-    0x08, 0x00, 0x0F, 0x00, 0x00, 0x10, 0xF4, 0x40, 0x0F, 0x8F, 0x5F, 0x00, 0xFE, 0xFB, 0xF0, 0x03,
-    0xFF, 0xFC, 0x01, 0x6F, 0xFF, 0x95, 0xBF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xDF, 0x7F, 0x40, 0x70, 0xF4, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x64, 0x00, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0x07, 0xE1, 0xF8, 0x7F, 0x1F, 0xC0, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x02,
-    0xF4, 0xBD, 0x2F, 0x4B, 0xD0, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x00, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0,
-    0x02, 0x80, 0xA0, 0x28, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x02, 0xF6, 0xFD, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xC0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x41, 0xFC, 0x00, 0x00, 0x0F, 0xEB,
-    0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0xFF, 0x19, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x14, 0x7F, 0x40, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x1F, 0xF7, 0xF4, 0x00, 0x00, 0x3F,
-    0x86, 0x40, 0x00, 0x00, 0x24, 0x04, 0x1F, 0xCB, 0xFA, 0xFD, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xBF, 0x6F, 0xE7, 0xF4, 0x50, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x54, 0x7F, 0x40, 0x01, 0xFD, 0xBF, 0x80, 0x02, 0xFE, 0x7F, 0x40, 0x01, 0xFD, 0x19, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0x02,
-    0xE0, 0x0B, 0xF4, 0x3F, 0x0B, 0xF4, 0x0B, 0xF4, 0x3F, 0x0B, 0xF4, 0x07, 0xF0, 0x3F, 0x07, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x15, 0x55, 0x7F, 0x55, 0x55, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x7F, 0x55, 0x55, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x07, 0xE0, 0x0B, 0xF4, 0x3F,
-    0x0F, 0xF4, 0x0B, 0xF4, 0x3F, 0x0F, 0xF4, 0x03, 0xF0, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x1F, 0xE7, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x3F, 0x5F, 0xF7, 0xF8, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x68, 0x7F, 0xAF, 0xE7, 0xF4, 0x14, 0x05,
-    0x0F, 0xE7, 0xFC, 0xFF, 0x09, 0x01, 0x43, 0xF9, 0xFF, 0x3F, 0xC2, 0x40, 0x40, 0xFE, 0x7F, 0xCF,
-    0xF0, 0x90, 0x10, 0x3F, 0x9F, 0xF3, 0xFC, 0x28, 0x00, 0x0B, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F,
-    0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0,
-    0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4,
-    0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x02,
-    0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x35,
-    0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0xFF, 0xC0, 0xFF, 0xF8, 0xBE, 0x7F, 0x3F, 0x0F, 0xDF, 0x83, 0xFB, 0xD1, 0xFE, 0xF4, 0xBE,
-    0xBD, 0x3F, 0x1F, 0xFF, 0x83, 0xFF, 0xC0, 0x2F, 0x80, 0x01, 0x80, 0x3E, 0x01, 0x80, 0x14, 0x0B,
-    0xC0, 0xF8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xF0, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x3F, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0xBD, 0xF8, 0x1F, 0x1F, 0x43, 0xE7, 0xF4, 0xBF,
-    0xFF, 0xDB, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x03, 0xFF,
-    0xD0, 0x7C, 0x00, 0x0F, 0x90, 0x00, 0xFF, 0xF0, 0x0A, 0xBF, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0x82,
-    0x57, 0xF4, 0x3F, 0xFE, 0x01, 0xBE, 0x40, 0x00, 0x05, 0x00, 0xBF, 0xF0, 0xFF, 0xF8, 0xBD, 0x00,
-    0x3E, 0x10, 0x1F, 0xBF, 0x8B, 0xFB, 0xF2, 0xF0, 0x7D, 0xBC, 0x1F, 0x5F, 0x9F, 0xC3, 0xFF, 0xD0,
-    0x2F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x02, 0x90, 0x00,
-    0x00, 0x14, 0x00, 0x1F, 0xFC, 0x07, 0xFB, 0xE0, 0xBC, 0x3E, 0x07, 0xE7, 0xD0, 0x3F, 0xF4, 0x07,
-    0xFF, 0x42, 0xF9, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0xFF, 0x40, 0x7F, 0x90, 0x00, 0x50,
-    0x02, 0xFF, 0x82, 0xFF, 0xF4, 0xFC, 0x3E, 0x3D, 0x0F, 0xCF, 0x87, 0xF3, 0xFF, 0xF8, 0x2E, 0xBD,
-    0x00, 0x3F, 0x15, 0xBF, 0x4B, 0xFF, 0x41, 0xF9, 0x00, 0x00, 0x80, 0x00, 0x74, 0x00, 0x1D, 0x00,
-    0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x2A, 0xAA, 0x0F, 0xFF, 0xC0,
-    0x55, 0x54, 0xFF, 0xFD, 0x55, 0x54, 0x55, 0x54, 0xFF, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x2D, 0x07,
-    0x80, 0xF0, 0x2D, 0x03, 0xC0, 0x78, 0x0B, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0xB4, 0x03,
-    0x80, 0x14, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-    0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xF0, 0x05, 0x00, 0x00, 0x01, 0x05,
-    0x00, 0xB7, 0xFC, 0x0F, 0xD7, 0xD0, 0xF8, 0x3C, 0x1F, 0x07, 0xC2, 0xF0, 0xBC, 0x3E, 0x0F, 0x83,
-    0xD0, 0xF4, 0x3C, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x82, 0xFD, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x0F, 0xC7, 0xE1, 0xF8, 0xBE, 0x3F, 0x47, 0xFF, 0xF0, 0x3F, 0xFC,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xF0, 0x7F, 0xFC, 0x2F, 0xBE, 0x02, 0x2F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x0A, 0x80, 0x00, 0x05,
-    0x00, 0x2F, 0xFC, 0x07, 0xFF, 0xF0, 0x24, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x07, 0xF0, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xAA, 0xA4, 0x00, 0x14, 0x00, 0x3F,
-    0xFC, 0x03, 0xFF, 0xE0, 0x10, 0x3E, 0x00, 0x07, 0xD0, 0x1F, 0xF4, 0x02, 0xFE, 0x00, 0x01, 0xF8,
-    0x00, 0x0F, 0xC3, 0x96, 0xF8, 0x3F, 0xFF, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x2F, 0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0xC0, 0x7D, 0xFC, 0x0F, 0x4F, 0x83, 0xF6, 0xF8, 0x3F, 0xFF,
-    0xE7, 0xFF, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x0F, 0xFF, 0x80,
-    0xF4, 0x00, 0x1F, 0x00, 0x02, 0xFF, 0xD0, 0x1A, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x0A, 0x5B,
-    0xE0, 0xFF, 0xFC, 0x06, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0xC1, 0xF8, 0x00,
-    0x3F, 0x14, 0x03, 0xFF, 0xF0, 0x7F, 0xAF, 0x87, 0xD0, 0xF8, 0x7D, 0x0F, 0x83, 0xE7, 0xF0, 0x2F,
-    0xFE, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x2F,
-    0x40, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x02,
-    0xA0, 0x00, 0x00, 0x10, 0x01, 0xFF, 0xC0, 0xFE, 0xFC, 0x7D, 0x3F, 0x1F, 0x9F, 0x82, 0xFF, 0x81,
-    0xFF, 0xD1, 0xF9, 0xFC, 0xFC, 0x2F, 0x7F, 0x0F, 0xC7, 0xFF, 0xE0, 0x6F, 0x90, 0x00, 0x10, 0x01,
-    0xFF, 0x81, 0xFF, 0xF8, 0xFC, 0x3F, 0x3E, 0x0B, 0xCF, 0xC7, 0xF3, 0xFF, 0xFC, 0x2F, 0x7E, 0x00,
-    0x3F, 0x15, 0xBF, 0x4B, 0xFF, 0x41, 0xFA, 0x00, 0x02, 0x40, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFD,
-    0xBF, 0xFD, 0x03, 0x80, 0x03, 0x80, 0x02, 0x40, 0xAA, 0xA8, 0xFF, 0xFD, 0x15, 0x54, 0xBF, 0xFE,
-    0x15, 0x54, 0x15, 0x54, 0xBF, 0xFE, 0x15, 0x54, 0x00, 0x00, 0x07, 0x80, 0x7C, 0x03, 0xC0, 0x1E,
-    0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2E, 0x00, 0x78, 0x00, 0xF0,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xB4, 0x01, 0x40, 0x00, 0x03, 0xE3,
-    0xC0, 0xFF, 0xFC, 0x3F, 0x0F, 0x87, 0xD0, 0xF4, 0x7C, 0x0F, 0x0B, 0xC2, 0xF0, 0x7D, 0xBE, 0x03,
-    0xFF, 0xD0, 0x09, 0x14, 0x00, 0x02, 0xFD, 0x03, 0xFB, 0xC3, 0xE0, 0xF5, 0xF5, 0xFC, 0xBF, 0xF8,
-    0x2F, 0x00, 0x07, 0xD0, 0x80, 0xFF, 0xF0, 0x06, 0x90, 0x00, 0x02, 0xF8, 0x07, 0xFF, 0xC3, 0xE0,
-    0xF5, 0xF0, 0x3D, 0xBC, 0x0F, 0x6F, 0x07, 0xC7, 0xD7, 0xE0, 0xFF, 0xE0, 0x06, 0x50, 0x00, 0x02,
-    0xE0, 0xB8, 0x02, 0xF2, 0xF0, 0x00, 0xFB, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xBE, 0x00, 0x02, 0xFF,
-    0x00, 0x07, 0xCF, 0x80, 0x1F, 0x4B, 0xC0, 0x15, 0x01, 0x40, 0x0B, 0xF8, 0x0B, 0xFF, 0x80, 0x02,
-    0xF0, 0x06, 0xBC, 0x3F, 0xFF, 0x2F, 0x0F, 0x8F, 0x8B, 0xC2, 0xFF, 0xD0, 0x1A, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7D, 0xF8, 0x07, 0xFF, 0xD0, 0xBC, 0x3E, 0x0F, 0x83,
-    0xD0, 0xF0, 0x3C, 0x1F, 0x07, 0xC2, 0xE0, 0xBC, 0x3E, 0x0F, 0x81, 0x40, 0x50, 0x02, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x0B, 0xC7, 0xD0, 0x3E, 0x7C, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x1F, 0xBD, 0x00, 0xB8, 0xBC, 0x03, 0xD0, 0xF4, 0x05, 0x01, 0x50, 0x02, 0xF0,
-    0x3E, 0x03, 0xD0, 0x7C, 0x07, 0xC0, 0xB8, 0x0F, 0x40, 0xF0, 0x1F, 0x02, 0xF0, 0x3E, 0x01, 0x40,
-    0x03, 0x5F, 0x87, 0xE0, 0x2F, 0xFF, 0xBF, 0xD0, 0xBC, 0x3F, 0x0F, 0x43, 0xE0, 0xF8, 0x3D, 0x0F,
-    0x03, 0xC0, 0xF0, 0x7C, 0x1F, 0x07, 0xC2, 0xF0, 0xB8, 0x2E, 0x0F, 0x83, 0xE0, 0xF4, 0x14, 0x05,
-    0x01, 0x40, 0x0E, 0x7E, 0x07, 0xFF, 0xE2, 0xF4, 0xF8, 0xF8, 0x3E, 0x3D, 0x0F, 0x5F, 0x07, 0xCB,
-    0xC1, 0xF3, 0xE0, 0xB8, 0x50, 0x14, 0x00, 0x03, 0x9F, 0x80, 0x7F, 0xFD, 0x0B, 0xC3, 0xE0, 0xF4,
-    0x3E, 0x0F, 0x03, 0xD1, 0xF0, 0x7C, 0x2F, 0x9F, 0x83, 0xFF, 0xF0, 0x3D, 0x64, 0x07, 0xC0, 0x00,
-    0x7C, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xF8, 0x1F, 0xBD, 0x2F, 0x00, 0x1F, 0xD0, 0x07, 0xF4, 0x00,
-    0xFC, 0x50, 0xFC, 0xBF, 0xF4, 0x1A, 0x40, 0x01, 0x40, 0x1E, 0x02, 0xFF, 0x5F, 0xFD, 0x1F, 0x00,
-    0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7D, 0x40, 0xFF, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xE0, 0x10, 0x03, 0xFC, 0x00, 0x00,
-    0x7F, 0x41, 0x55, 0x57, 0xF0, 0xBF, 0xFE, 0xBF, 0x0F, 0xFF, 0xDB, 0xF0, 0xFE, 0x54, 0x7F, 0x4F,
-    0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0x1D, 0x00, 0x00, 0x1E, 0x2C, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xF1, 0xF4, 0x0B, 0xFD, 0xE2, 0xC0, 0x0F, 0xF2, 0xC3, 0x80, 0x2F, 0xD3,
-    0x8B, 0x40, 0x3F, 0xCB, 0x4F, 0x00, 0x3F, 0xCF, 0x1E, 0x00, 0x3F, 0x9E, 0x2C, 0x00, 0x3F, 0xAC,
-    0x3C, 0x00, 0x3F, 0xFC, 0xB4, 0x00, 0x3F, 0xF4, 0xF1, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xDF, 0x90, 0x00, 0x07, 0x4F, 0x00, 0x00, 0x05, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0x40, 0xB4, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC1, 0xF1, 0xF0, 0x3F, 0xC2, 0xF7, 0xE0, 0x3F, 0xC3, 0xFF, 0xD0, 0x3F, 0x83,
-    0xF8, 0x00, 0x3F, 0x83, 0xF0, 0x00, 0x3F, 0xC7, 0xF0, 0x00, 0x3F, 0xCB, 0xE0, 0x00, 0x2F, 0xEF,
-    0xD6, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xD5,
-    0x54, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xAA, 0x90,
-    0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFD, 0x00, 0x7F, 0x95, 0x50, 0x02, 0xFC, 0x00, 0x00, 0x1F,
-    0xF5, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xF4, 0x08, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x0A, 0xFF, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xAF, 0xFA, 0xA0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x1A, 0x0B, 0xE0, 0xFF, 0xE0, 0x03, 0xF3, 0xFF,
-    0xEF, 0xFF, 0x80, 0x3F, 0xBF, 0xFF, 0xFF, 0xFC, 0x07, 0xFE, 0x1F, 0xFD, 0x2F, 0xD0, 0xBF, 0xC0,
-    0xFF, 0x41, 0xFD, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xC0, 0xFF, 0x01, 0xFD, 0x02, 0xFC, 0x0F, 0xE0,
-    0x2F, 0xC0, 0x3F, 0xC1, 0xFD, 0x03, 0xFC, 0x03, 0xF8, 0x2F, 0xC0, 0xFF, 0x80, 0x7F, 0x43, 0xFC,
-    0x2F, 0xF8, 0x07, 0xF0, 0x3F, 0x83, 0xFF, 0x40, 0xBF, 0x03, 0xF4, 0xFF, 0xF0, 0x0F, 0xF0, 0x7F,
-    0x2F, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBC, 0x00, 0xFF, 0x40, 0xF8, 0x01, 0xFF, 0x41,
-    0xF4, 0x01, 0xFF, 0x41, 0xF4, 0x02, 0xFF, 0x82, 0xF0, 0x03, 0xEB, 0x83, 0xF0, 0x1B, 0xFF, 0xEB,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFC, 0x0B, 0xDB, 0xCB, 0xD0, 0x0B, 0xC7, 0xCF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0x43, 0xDF, 0x40, 0x2F, 0x03, 0xEF, 0x00, 0x3F, 0x03, 0xFF,
-    0x00, 0x3F, 0x03, 0xFE, 0x00, 0x3E, 0x03, 0xFE, 0x00, 0x7D, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xD6,
-    0xFF, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x0B, 0x80, 0x03, 0xF8,
-    0x0F, 0xF1, 0xF4, 0x00, 0x3F, 0x41, 0xFE, 0x3F, 0x54, 0x07, 0xFA, 0xFF, 0xDF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xF7, 0xFF, 0xF8, 0x0B, 0xFF, 0xFD, 0x0F, 0xE0, 0x00, 0xFF, 0xA5, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x03,
-    0xF8, 0x00, 0x02, 0xFE, 0x90, 0x3F, 0x80, 0x00, 0x1F, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x1F,
-    0xD0, 0xBF, 0x90, 0x0F, 0xE0, 0x7F, 0x4F, 0xFF, 0xD0, 0x3F, 0x42, 0xFD, 0xFF, 0xFF, 0x01, 0xFC,
-    0x1F, 0xF3, 0xF4, 0x14, 0x0B, 0xFF, 0xFF, 0x4F, 0xD0, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xD0, 0x00,
-    0xFF, 0xFF, 0x40, 0xBF, 0xE0, 0x07, 0xF5, 0xFD, 0x00, 0xBF, 0xE0, 0x2F, 0xC3, 0xF8, 0x00, 0x7F,
-    0xC0, 0xBF, 0x0F, 0xF0, 0x00, 0x7F, 0x03, 0xF8, 0x2F, 0xC4, 0x01, 0xFC, 0x0F, 0xE0, 0x7F, 0x2E,
-    0x6F, 0xF0, 0x7F, 0x41, 0xFD, 0xBF, 0xFF, 0x42, 0xFC, 0x03, 0xF9, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x7D, 0x07, 0xD0, 0x3F, 0x80, 0xBC, 0x07, 0xD0,
-    0x3F, 0x80, 0xFC, 0x07, 0xD0, 0xBF, 0x81, 0xF4, 0x07, 0xC0, 0xFF, 0x43, 0xF0, 0x07, 0xC1, 0xFB,
-    0x43, 0xE0, 0x0B, 0xC3, 0xEF, 0x47, 0xD0, 0x0B, 0xC3, 0xCF, 0x4F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xDF, 0x0F, 0x3F, 0x00, 0x0F, 0xAF, 0x0F, 0x7D, 0x00,
-    0x0F, 0xBD, 0x0F, 0xBC, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x1F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x07, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0xBD, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x0F, 0xE0, 0xFC, 0x01, 0xFC, 0x14, 0x7F, 0x1F, 0xC0, 0x2F, 0x8F, 0xD7, 0xF2, 0xF8, 0x02,
-    0xF4, 0xFC, 0x7E, 0x3F, 0x40, 0x3F, 0x1F, 0xCB, 0xE3, 0xF0, 0x03, 0xF2, 0xF8, 0xFD, 0x3F, 0x00,
-    0x7F, 0x2F, 0x4F, 0xC7, 0xE0, 0x0B, 0xE3, 0xF1, 0xFC, 0xBD, 0x00, 0xFD, 0x3F, 0x1F, 0x8F, 0xD0,
-    0x0F, 0xC7, 0xF2, 0xF4, 0xFC, 0x00, 0xFC, 0xBE, 0x15, 0x2F, 0x80, 0x1F, 0x8F, 0xD0, 0x07, 0xF4,
-    0x02, 0xF4, 0xFF, 0xAB, 0xFE, 0x00, 0x3F, 0x4F, 0xFF, 0xFF, 0x80, 0x03, 0xF1, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x01, 0x57, 0xF9, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xFD, 0x7F, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x0B, 0xF8, 0x00, 0xFE, 0x01, 0xFD, 0x00,
-    0xBF, 0x40, 0x7F, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0, 0x0F, 0xE0, 0x03, 0xFC, 0x03, 0xF4,
-    0x00, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xEF, 0xC0, 0x00, 0x7F, 0xD3,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x3F, 0xD0, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0xA8, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1B, 0xFE, 0xA8, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07,
-    0xF8, 0x01, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x7F, 0xC0, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x07, 0xF4, 0x3F, 0xD0, 0x01, 0xFC, 0x2F, 0xE0, 0x00, 0xBF, 0x1F, 0xE0, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xD4, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x0F, 0xE1, 0xFD, 0x00, 0x07, 0xF4, 0x3F, 0xC0, 0x02, 0xFC,
-    0x0F, 0xF0, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x0F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x05, 0x5F, 0xF5, 0x50,
-    0x00, 0x0F, 0xF2, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0xDE, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x09, 0x7F, 0xE0, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2E, 0xFE, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x69, 0x00, 0x3F, 0xC0, 0x1F,
-    0xE1, 0xFF, 0xF4, 0x0F, 0xE0, 0x0B, 0xF0, 0xFF, 0xFF, 0x03, 0xF4, 0x03, 0xFC, 0xBE, 0x0B, 0xD1,
-    0xFC, 0x03, 0xFD, 0x3F, 0x01, 0xF4, 0xBF, 0x0B, 0xFE, 0x0F, 0xC0, 0xBD, 0x3F, 0xFF, 0xFE, 0x07,
-    0xF0, 0x7F, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x87, 0xFF, 0xE4, 0x00, 0xFE, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x1F, 0x80, 0x00, 0x7F, 0x47, 0xE0, 0x00,
-    0x1F, 0xD2, 0xF4, 0x00, 0x07, 0xF4, 0xFC, 0x00, 0x01, 0xFD, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x20, 0x7F, 0xC0, 0x00, 0x1D, 0x1F, 0xF0,
-    0x00, 0x0F, 0x9F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xCF, 0xE0, 0x07, 0xCB, 0xC3,
-    0xFC, 0x03, 0xD1, 0xC0, 0xFF, 0x00, 0x00, 0x10, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x2F, 0xD0,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x0F, 0xD0, 0x2F, 0xFA, 0xAF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xE0, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0x1B, 0x00, 0xFF, 0xCB, 0x80, 0x00, 0x7F, 0xC3, 0xD0, 0x00, 0x3F, 0xD0, 0xF0, 0x00, 0x0F, 0xF0,
-    0x3C, 0x00, 0x07, 0xF8, 0x1F, 0xFF, 0xC1, 0xFD, 0x0B, 0xFF, 0xF0, 0xBF, 0x43, 0xFF, 0xFC, 0x2F,
-    0xD0, 0xF0, 0xFE, 0x0B, 0xF4, 0x7C, 0x7F, 0x41, 0xFF, 0x1E, 0x2F, 0xC0, 0x3F, 0xEB, 0x4F, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x7F,
-    0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x06, 0xBF, 0xEB, 0xFE, 0x80, 0x03,
-    0xF8, 0x2F, 0x80, 0x06, 0xFF, 0xAB, 0xFE, 0x40, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFD, 0x56, 0xFD,
-    0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0B, 0xF0, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x2F, 0xC0,
-    0x00, 0xFD, 0x07, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0xA4, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0x0A, 0xAA, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x06, 0x80, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xBC, 0xB0, 0x0F, 0xF8, 0x78, 0x00, 0x1F, 0xF0, 0xB8, 0x00, 0x2F, 0xD0,
-    0xF4, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0x3F, 0x81, 0xF0, 0x00, 0x7F, 0x42, 0xE0, 0x00, 0x7F, 0x42,
-    0xD0, 0x00, 0x7F, 0x43, 0xD0, 0x00, 0x7F, 0x43, 0xC0, 0x00, 0x7F, 0xC7, 0xC0, 0x00, 0x3F, 0xEB,
-    0x86, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x19, 0x00, 0xA4, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00,
-    0xBD, 0x03, 0xF0, 0x00, 0x2F, 0xFA, 0xFF, 0xA8, 0x1F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x03, 0xF8, 0x2F, 0xD0, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0xC0, 0x00, 0xBF,
-    0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x1F, 0xD0, 0xBF, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0xFC, 0x03, 0xF8, 0x0B, 0xFF, 0xC0, 0x3F, 0x40,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x41, 0x90, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x78, 0x68, 0x78, 0xFD, 0x07, 0xFF, 0xFB, 0xF3, 0xF4, 0x2D, 0xF2,
-    0xF3, 0xDF, 0xC0, 0x7F, 0xCB, 0x4F, 0xFE, 0x00, 0xBF, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xC7, 0xCB, 0x40, 0x00, 0x1E, 0x2D, 0x2D, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xAF, 0xFA, 0x01, 0xFF, 0xFF, 0xF0, 0x05,
-    0x5F, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFE, 0x06, 0x00, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFC,
-    0x6C, 0x00, 0x3F, 0xFF, 0xC0, 0x1B, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0xAF, 0xF0, 0x0A, 0x90,
-    0xFE, 0x00, 0xFD, 0x0F, 0xE0, 0x2F, 0xC0, 0xFD, 0x07, 0xF8, 0x1F, 0xC2, 0xFF, 0x02, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00,
-    0x7F, 0xBE, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFA, 0xAA, 0xBF,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0xF2, 0xCD, 0x0E, 0x01, 0xFF, 0xFF, 0x2D, 0x02, 0xFE, 0xFB, 0xFC,
-    0x02, 0xF0, 0x81, 0xA0, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x04, 0x00, 0x04, 0xFF, 0xFD, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x9F, 0xE7, 0xFE, 0x03, 0xFC, 0x0F, 0xD0, 0xFF, 0x07, 0xF4,
-    0x1F, 0xC0, 0xBF, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x0F, 0xE0, 0x3F, 0x80, 0xFF, 0x0F, 0xD0, 0x3F,
-    0x40, 0xFE, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0xC0, 0x00, 0x02,
-    0xFC, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x3F, 0x40, 0xFF, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0xFF, 0x03, 0xFD, 0x0A, 0xFF, 0xBF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0x80, 0x07, 0xFD, 0x50, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2B, 0xFE, 0xA0, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFA, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x05, 0x00, 0x00, 0x00, 0x70, 0xF0, 0x00, 0x00, 0x0B, 0x0E, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFD, 0x7F, 0xC0, 0x0F, 0xFB,
-    0xC3, 0x80, 0x02, 0xFF, 0x38, 0x74, 0x00, 0x3F, 0xC3, 0x8B, 0x00, 0x03, 0xFC, 0x20, 0xA0, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x50, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x41,
-    0x00, 0x00, 0x38, 0xB0, 0x00, 0x03, 0x4F, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFD, 0x01, 0xFD, 0x6F, 0xE0, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0x82, 0xFD,
-    0x03, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0x1F, 0xF0, 0x0F, 0xE0,
-    0x7F, 0x80, 0xFD, 0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x42, 0xFC, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0x34, 0xF0, 0x00, 0x07, 0x0E, 0x00, 0x00, 0x50, 0x40,
-    0x00, 0x05, 0x54, 0x3F, 0xFD, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00,
-    0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_bolditalicBitmaps[32868] = {
+    0x29, 0xEA, 0x2A, 0xEA, 0x2A, 0xE9, 0x2F, 0x3F, 0x3E, 0xA2, 0x9E, 0x92, 0xAE, 0x3A, 0xE3, 0xEA,
+    0x3E, 0x93, 0xE7, 0x73, 0xAD, 0x39, 0xEA, 0x2A, 0xEA, 0x29, 0xE5, 0x94, 0x0A, 0xD9, 0x0A, 0xD9,
+    0x0E, 0x90, 0xE9, 0x0E, 0x1E, 0x1D, 0xA1, 0xDA, 0x09, 0xD9, 0x09, 0xD9, 0x09, 0xD1, 0x9D, 0x19,
+    0xAA, 0x19, 0xAA, 0x10, 0x6D, 0xA1, 0xDA, 0x79, 0xD9, 0x1D, 0x97, 0xAD, 0x1A, 0xD7, 0x0E, 0x1E,
+    0x70, 0xD9, 0x1D, 0xA4, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0xAA, 0xAE, 0xAA, 0xEA, 0xAA, 0x49, 0xD9,
+    0x1D, 0x97, 0xAD, 0x1A, 0xD5, 0xAA, 0xAE, 0xAA, 0xEA, 0xA9, 0x19, 0xFF, 0xFD, 0x19, 0xFF, 0xFD,
+    0x4A, 0xD1, 0xAD, 0x70, 0xDA, 0x1D, 0xA7, 0x9D, 0x90, 0x9D, 0x97, 0xAD, 0x1A, 0xD7, 0x0E, 0x1E,
+    0x60, 0x79, 0xC9, 0x72, 0xAC, 0x70, 0xAF, 0xDA, 0x4F, 0xFC, 0x92, 0xFF, 0xD2, 0x9E, 0xA9, 0xC9,
+    0x09, 0x92, 0x9E, 0x0A, 0xC6, 0x9E, 0xAD, 0x7F, 0xD7, 0x9F, 0xDA, 0x7F, 0xE7, 0xAF, 0xC9, 0x6D,
+    0x9E, 0xA6, 0xCA, 0x0E, 0xA0, 0x9C, 0x91, 0x9C, 0x9A, 0xE9, 0x09, 0xFF, 0xE1, 0x9F, 0xFD, 0x39,
+    0xAF, 0xCA, 0x97, 0x0C, 0xA7, 0x29, 0xC9, 0x73, 0x97, 0x77, 0x6A, 0xEA, 0x6D, 0xA3, 0xFD, 0xA4,
+    0xE3, 0x9E, 0xAE, 0x3A, 0xD4, 0xE1, 0xE2, 0x9D, 0x93, 0x9E, 0x1E, 0x2D, 0xA4, 0x9D, 0xA1, 0xE1,
+    0xE5, 0xAD, 0x90, 0x9D, 0xA0, 0xAD, 0x95, 0xAD, 0x90, 0xE9, 0x9D, 0xA0, 0xAD, 0xA1, 0x9E, 0xAE,
+    0x0E, 0x9F, 0xD1, 0xFD, 0x9E, 0x0E, 0xAE, 0x90, 0x9F, 0x0A, 0xD9, 0x9E, 0x0A, 0xD9, 0x59, 0xDA,
+    0x0E, 0x90, 0xAD, 0x95, 0xE1, 0xE1, 0xAD, 0x94, 0xE2, 0xE1, 0xE4, 0xAD, 0x92, 0xE1, 0xE3, 0x9D,
+    0xA3, 0xE9, 0xE9, 0x3E, 0x4A, 0xFD, 0x3E, 0x6F, 0xA7, 0x76, 0x77, 0x79, 0xFC, 0x97, 0x1A, 0xFE,
+    0x97, 0x9F, 0xFA, 0x7A, 0xE1, 0xAE, 0x7E, 0xA1, 0xAE, 0x7E, 0xA1, 0xEA, 0x7A, 0xE9, 0xF7, 0x1F,
+    0xE7, 0x1A, 0xFC, 0x92, 0xAA, 0xA3, 0xFE, 0x2A, 0xE2, 0xFA, 0xEA, 0x1E, 0x91, 0xAE, 0x90, 0xAE,
+    0x9F, 0x2F, 0x2F, 0xE9, 0x2E, 0xA2, 0x9F, 0xCA, 0x3F, 0x92, 0xFC, 0x4F, 0xFF, 0xC9, 0x39, 0xFF,
+    0xFC, 0x49, 0xFD, 0xA0, 0x9F, 0x77, 0x30, 0x0A, 0xD9, 0x0E, 0x90, 0xE1, 0xDA, 0x09, 0xD9, 0x09,
+    0xD1, 0x9A, 0xA1, 0x59, 0xDA, 0x6E, 0x6E, 0x95, 0xAD, 0xA5, 0x9E, 0x6E, 0x95, 0x9E, 0x6E, 0xA6,
+    0xE6, 0x9E, 0x6A, 0xDA, 0x6E, 0x96, 0xE9, 0x6E, 0x7E, 0x7E, 0x7E, 0x96, 0xE9, 0x6A, 0xDA, 0x69,
+    0xE7, 0xE7, 0x9D, 0x94, 0x76, 0xE6, 0xAD, 0xA5, 0x9E, 0x6E, 0x6E, 0x95, 0xE9, 0x5A, 0xDA, 0x5A,
+    0xDA, 0x5A, 0xDA, 0x5E, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x49, 0xE5, 0xE9, 0x49,
+    0xE5, 0xE9, 0x4E, 0xA4, 0xAE, 0x49, 0xE5, 0x77, 0x19, 0xD9, 0x70, 0x9D, 0xA4, 0xA2, 0xAD, 0x49,
+    0xDA, 0x0A, 0xD4, 0xAF, 0xDA, 0x99, 0x9A, 0x19, 0xFF, 0xD3, 0x9F, 0xF2, 0x9F, 0xC1, 0x99, 0x19,
+    0xE9, 0xDA, 0x4E, 0x90, 0xE5, 0xAA, 0x1A, 0xD9, 0x70, 0x9C, 0x93, 0x4D, 0xA7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1E, 0x4A, 0xFF, 0xE9, 0xAF, 0xFE, 0x99, 0xAA, 0xAA, 0xEA, 0xAA, 0xA5, 0xDA,
+    0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x77, 0x10, 0x2E, 0xA1, 0x9E, 0x91, 0xAE, 0x2E, 0x29, 0xDA,
+    0x2E, 0x71, 0x19, 0x99, 0x99, 0x1F, 0xD9, 0x9F, 0xD0, 0x9F, 0xD0, 0x0A, 0xCA, 0x0A, 0xEA, 0xFA,
+    0xAE, 0x19, 0x91, 0x71, 0x9E, 0x72, 0xEA, 0x71, 0x9E, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xE9, 0x71,
+    0xAE, 0x72, 0xE9, 0x71, 0xAD, 0xA7, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xE7, 0x2E, 0x97, 0x1A, 0xE7,
+    0x2E, 0x97, 0x1A, 0xE7, 0x2E, 0x72, 0xEA, 0x77, 0x70, 0x77, 0x3A, 0xF9, 0x59, 0xFE, 0x93, 0x9F,
+    0xFC, 0x3F, 0x1A, 0xE9, 0x1A, 0xE9, 0x2E, 0x91, 0xF3, 0xEA, 0x09, 0xE9, 0x3E, 0xA0, 0xAE, 0x39,
+    0xE9, 0x0F, 0x39, 0xE9, 0x0F, 0x3A, 0xE1, 0xEA, 0x3F, 0x1E, 0xA3, 0xF1, 0xEA, 0x29, 0xE9, 0x1E,
+    0xA2, 0xF2, 0xF1, 0xAE, 0xA2, 0xAF, 0xFC, 0x4F, 0xF6, 0xFC, 0xA7, 0x72, 0x59, 0xE5, 0xFC, 0x3A,
+    0xFC, 0xA1, 0x9F, 0xE9, 0x0A, 0xFF, 0x91, 0xE9, 0xAE, 0x29, 0xA1, 0xF6, 0xEA, 0x59, 0xE9, 0x59,
+    0xE6, 0xAE, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA6, 0xEA, 0x30, 0x77, 0x4A, 0xFC,
+    0x95, 0xAF, 0xF9, 0x3A, 0xFF, 0xD4, 0xE9, 0x1F, 0x93, 0x9A, 0x39, 0xE9, 0x71, 0x9E, 0x97, 0x1F,
+    0x71, 0xAE, 0x97, 0x09, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x70,
+    0xF9, 0x70, 0xFF, 0xEA, 0x19, 0xFF, 0xE9, 0x19, 0xFF, 0xE9, 0x10, 0x77, 0x19, 0xAF, 0xC9, 0x4F,
+    0xFC, 0xA3, 0xFF, 0xD4, 0xC9, 0x2A, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1F, 0x49, 0x9A, 0xFC,
+    0x5A, 0xFC, 0x96, 0xFD, 0xA7, 0x09, 0xAF, 0x71, 0x9E, 0x71, 0x9E, 0x97, 0x0A, 0xE9, 0x0A, 0x94,
+    0x9F, 0x1F, 0xFE, 0x91, 0xFF, 0xDA, 0x29, 0xFE, 0xA7, 0x72, 0x71, 0xAE, 0x97, 0x09, 0xF7, 0x09,
+    0xFC, 0x70, 0xFD, 0x7F, 0xDA, 0x6E, 0xAE, 0x95, 0xAE, 0x9E, 0x59, 0xE0, 0xAE, 0x49, 0xE1, 0xEA,
+    0x4E, 0x91, 0xE9, 0x3E, 0x91, 0x9E, 0x92, 0xAE, 0xAA, 0xAF, 0xAA, 0x1F, 0xFF, 0xC1, 0xFF, 0xFA,
+    0x19, 0x99, 0x99, 0x99, 0xEA, 0x97, 0x09, 0xE7, 0x2A, 0xE7, 0x2F, 0x30, 0x39, 0xFF, 0xA3, 0xFF,
+    0xC9, 0x3F, 0xFC, 0x92, 0x9E, 0x99, 0x99, 0x99, 0x3A, 0xE7, 0x1E, 0x97, 0x1E, 0x97, 0x0A, 0xFE,
+    0x94, 0xFF, 0xCA, 0x39, 0xDA, 0xAF, 0xC7, 0x1F, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x0F, 0x1A,
+    0x94, 0xAF, 0x1A, 0xFF, 0xD9, 0x1A, 0xFF, 0xC9, 0x29, 0xAF, 0xDA, 0x77, 0x20, 0x77, 0x39, 0xFD,
+    0x49, 0xFF, 0x39, 0xFF, 0xA2, 0x9F, 0x97, 0xF7, 0x09, 0xE7, 0x1E, 0xA0, 0x9A, 0xA9, 0x4E, 0x9F,
+    0xCA, 0x29, 0xFF, 0xD9, 0x1A, 0xFA, 0x9A, 0xEA, 0x1F, 0x92, 0xF1, 0xF3, 0xF1, 0xEA, 0x3E, 0xA1,
+    0xF2, 0x9E, 0x91, 0xAE, 0x2F, 0x29, 0xFF, 0xCA, 0x3A, 0xFE, 0xA5, 0xAF, 0xC9, 0x77, 0x20, 0x2F,
+    0xFE, 0xA1, 0x9F, 0xFE, 0xA1, 0xAF, 0xFE, 0x92, 0x99, 0x99, 0x99, 0xAF, 0x71, 0xF7, 0x19, 0xEA,
+    0x71, 0xF7, 0x1A, 0xE9, 0x71, 0xF7, 0x1F, 0x71, 0x9E, 0xA7, 0x1F, 0x71, 0xAE, 0x97, 0x09, 0xF7,
+    0x1F, 0x97, 0x0A, 0xEA, 0x71, 0xF7, 0x1A, 0xE9, 0x70, 0x77, 0x29, 0xFC, 0xA5, 0xAF, 0xF3, 0x9F,
+    0xAF, 0x92, 0xF2, 0xEA, 0x2E, 0x92, 0xEA, 0x2E, 0xA2, 0xEA, 0x2A, 0xE1, 0xF4, 0xFF, 0x59, 0xFC,
+    0x95, 0xFF, 0x4F, 0x99, 0xF2, 0xF2, 0x9E, 0x91, 0xE9, 0x3E, 0xA0, 0x9E, 0x93, 0xEA, 0x09, 0xEA,
+    0x29, 0xE9, 0x1F, 0xCA, 0xAF, 0x29, 0xFF, 0xC9, 0x39, 0xFD, 0xA7, 0x71, 0x77, 0x0A, 0xFA, 0x49,
+    0xFF, 0x3F, 0xFC, 0xA1, 0xAE, 0x91, 0xF1, 0xEA, 0x29, 0xE9, 0x9E, 0x92, 0x9E, 0x99, 0xE3, 0xAE,
+    0x99, 0xE9, 0x2F, 0x09, 0xF0, 0x9F, 0xC1, 0xFF, 0xE1, 0x9F, 0xCA, 0xEA, 0x3A, 0xAA, 0x90, 0xE9,
+    0x7A, 0xE7, 0x9E, 0xA6, 0x9F, 0x2F, 0xFC, 0x92, 0xFF, 0x93, 0xFD, 0xA7, 0x72, 0x29, 0xD9, 0x19,
+    0xF1, 0xAE, 0xA1, 0x9E, 0x93, 0x97, 0x77, 0x75, 0xAC, 0xA2, 0xAE, 0xA1, 0xFA, 0x1A, 0xE3, 0x99,
+    0x30, 0x49, 0xD9, 0x39, 0xF3, 0xAE, 0xA3, 0x9E, 0x95, 0x97, 0x77, 0x77, 0x77, 0x2E, 0x93, 0x9E,
+    0x4E, 0xA4, 0xE4, 0xAD, 0xA4, 0xE7, 0x50, 0x77, 0x6A, 0xC9, 0x7A, 0xE9, 0x5A, 0xFA, 0x4A, 0xFA,
+    0x4A, 0xFA, 0x49, 0xFA, 0x6A, 0xEA, 0x97, 0xAF, 0xC9, 0x7A, 0xFC, 0xA7, 0x9F, 0xD7, 0x9F, 0x97,
+    0x1A, 0xC9, 0x74, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xFF, 0xE9, 0xAF, 0xFE, 0x97, 0x77,
+    0x1A, 0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x97, 0x3A, 0xCA, 0x71, 0xAE, 0xA7, 0x9F, 0xCA,
+    0x79, 0xFC, 0xA7, 0x0A, 0xFA, 0x70, 0xAF, 0x96, 0x9F, 0x94, 0xAF, 0xCA, 0x29, 0xAF, 0xC9, 0x29,
+    0xFD, 0x94, 0xAE, 0xA7, 0xAC, 0xA7, 0x19, 0x73, 0x76, 0xAF, 0xC9, 0x2A, 0xFF, 0xA1, 0x9F, 0xFC,
+    0x2C, 0xA2, 0xAE, 0x96, 0x9E, 0x7A, 0xE6, 0xAE, 0xA4, 0x9F, 0xA4, 0x9F, 0x95, 0xF6, 0x9E, 0x7A,
+    0xDA, 0x77, 0x77, 0xAC, 0xA7, 0xF7, 0xF7, 0xEA, 0x70, 0x97, 0x00, 0x79, 0xAE, 0xAA, 0x97, 0x2A,
+    0xFF, 0xD7, 0x9F, 0xAA, 0x9A, 0xAF, 0x94, 0xAE, 0x96, 0xAE, 0x3A, 0xE7, 0x19, 0xDA, 0x2E, 0x29,
+    0xFC, 0xA1, 0xE1, 0xE2, 0xAF, 0xE1, 0xAD, 0x1D, 0xA1, 0xAD, 0xA1, 0xE1, 0xAD, 0x09, 0xD9, 0x09,
+    0xDA, 0x2D, 0xA1, 0xAD, 0x0A, 0xD1, 0xAD, 0x29, 0xD9, 0x1A, 0xD0, 0xE1, 0xE2, 0xAD, 0x2E, 0x0E,
+    0x1D, 0xA2, 0xE1, 0x9D, 0x90, 0xE1, 0xE1, 0xAD, 0xA1, 0xE1, 0xAD, 0x1F, 0xFF, 0xC9, 0x1A, 0xD9,
+    0x1F, 0xA0, 0xFC, 0x93, 0xE2, 0x99, 0x92, 0x99, 0x95, 0xAD, 0xA7, 0x71, 0xF9, 0x49, 0xC9, 0x70,
+    0xFF, 0xE9, 0x71, 0x9F, 0xFA, 0x76, 0x99, 0x72, 0x70, 0x9F, 0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA,
+    0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79, 0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2,
+    0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC,
+    0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E, 0xA6, 0x9E, 0x00, 0x3A, 0xFD, 0xA9,
+    0x6F, 0xFD, 0x94, 0xFF, 0xE3, 0x9E, 0xA9, 0x99, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A, 0xE3, 0xAE, 0x3F,
+    0x29, 0xEA, 0x3F, 0xFE, 0x39, 0xFF, 0xC9, 0x4A, 0xFF, 0xCA, 0x4F, 0x19, 0xAE, 0xA3, 0xF3, 0xF3,
+    0xEA, 0x3F, 0x29, 0xE9, 0x3F, 0x2A, 0xE2, 0x9F, 0xA2, 0xFF, 0xF3, 0xFF, 0xE4, 0xFF, 0xA9, 0x40,
+    0x77, 0x59, 0xFD, 0xA5, 0x9F, 0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x19, 0xAC, 0x3F, 0xA7, 0x19,
+    0xF7, 0x2A, 0xE9, 0x72, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0x9E,
+    0x97, 0x29, 0xF7, 0x3F, 0xA3, 0x9A, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x97, 0x73, 0x3A,
+    0xFD, 0xA7, 0x0F, 0xFC, 0xA6, 0xFF, 0xE4, 0x9E, 0xA9, 0x9A, 0xF9, 0x39, 0xE9, 0x29, 0xF3, 0xAE,
+    0x4F, 0x3F, 0x4A, 0xE3, 0xEA, 0x4A, 0xE2, 0x9E, 0x94, 0xF2, 0xAE, 0x5F, 0x2F, 0x5F, 0x2F, 0x4A,
+    0xE9, 0x2E, 0xA4, 0xF2, 0x9E, 0x93, 0xFA, 0x2A, 0xE9, 0x09, 0xAF, 0xC3, 0xFF, 0xF4, 0xFF, 0xDA,
+    0x5F, 0xEA, 0x96, 0x3A, 0xFF, 0xC9, 0x3F, 0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E,
+    0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99,
+    0x4F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD3, 0x3A,
+    0xFF, 0xC4, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7,
+    0x2E, 0xA7, 0x19, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0xFC, 0xA4, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71,
+    0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x2E, 0xA7, 0x10, 0x77, 0x59, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE,
+    0x92, 0xFC, 0x92, 0x9A, 0xC2, 0xAF, 0x71, 0x9F, 0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9E, 0xA2, 0xFE,
+    0x09, 0xE9, 0x2F, 0xE0, 0xAE, 0x92, 0xFD, 0xA0, 0xAE, 0x94, 0x9E, 0x90, 0x9E, 0x94, 0xAE, 0x19,
+    0xF4, 0xF2, 0xFA, 0x3E, 0xA2, 0x9F, 0xFE, 0x93, 0xAF, 0xFD, 0x94, 0x9F, 0xEA, 0x97, 0x72, 0x3A,
+    0xE5, 0xE9, 0x3F, 0x49, 0xE9, 0x3E, 0xA4, 0xAE, 0x39, 0xEA, 0x4F, 0x39, 0xE9, 0x4E, 0xA3, 0xAE,
+    0x49, 0xE9, 0x3F, 0x49, 0xE9, 0x3F, 0xFF, 0xC3, 0x9F, 0xFF, 0xC3, 0xAF, 0xFF, 0xA3, 0xF9, 0x99,
+    0x99, 0xAE, 0x93, 0xF4, 0xAE, 0x4E, 0xA4, 0xF3, 0x9E, 0x94, 0xF3, 0xAE, 0x5E, 0xA3, 0xF4, 0x9E,
+    0x93, 0xEA, 0x4A, 0xE4, 0xEA, 0x4F, 0x30, 0x3F, 0xEA, 0x3F, 0xEA, 0x3F, 0xDA, 0x5A, 0xE7, 0xF7,
+    0xEA, 0x7E, 0x96, 0x9E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0xF5, 0x9F,
+    0xCA, 0x39, 0xFE, 0x92, 0xAF, 0xE9, 0x20, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0x0E, 0xA7,
+    0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0xA7, 0xAE, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7,
+    0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0F, 0x79, 0xEA, 0x69, 0xF4, 0xFE, 0xA4, 0xFE, 0x5F, 0xCA, 0x70,
+    0x97, 0x10, 0x3A, 0xE4, 0xF4, 0xF3, 0xF9, 0x4E, 0xA2, 0xAE, 0xA4, 0x9E, 0x91, 0xAF, 0x59, 0xE1,
+    0x9F, 0x6A, 0xE1, 0xF7, 0xF0, 0xF9, 0x7E, 0xAF, 0x97, 0x9F, 0xEA, 0x70, 0xAF, 0xEA, 0x70, 0xFF,
+    0xC7, 0x0F, 0x0A, 0xE9, 0x7E, 0xA1, 0xF6, 0x9E, 0x91, 0xF6, 0xAE, 0x29, 0xEA, 0x5F, 0x3F, 0x5E,
+    0xA3, 0xAE, 0x94, 0xE9, 0x39, 0xEA, 0x30, 0x3A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x69, 0xE7, 0xAE,
+    0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0xFD, 0x1F,
+    0xFD, 0x1F, 0xFC, 0xA0, 0x3A, 0xF9, 0x6F, 0xC4, 0xFC, 0x95, 0xAF, 0xC4, 0xFC, 0x95, 0xFC, 0xA3,
+    0x9F, 0xCA, 0x4A, 0xFC, 0x93, 0x9F, 0xCA, 0x4F, 0xD4, 0xAD, 0xAD, 0xA3, 0xAD, 0xAE, 0x4E, 0x9D,
+    0xA3, 0xEA, 0xE4, 0xE0, 0xE2, 0xAD, 0x9E, 0xA3, 0x9E, 0x0E, 0x2E, 0x0E, 0x93, 0xAE, 0x0E, 0x1A,
+    0xD0, 0x9E, 0x4E, 0xA0, 0xE0, 0x9D, 0xA0, 0xAE, 0x4E, 0x90, 0xE0, 0xE1, 0xAD, 0xA4, 0xE1, 0xE9,
+    0xDA, 0x1E, 0xA3, 0x9E, 0x1A, 0xFC, 0x2E, 0x93, 0xAD, 0xA1, 0xAF, 0xA1, 0x9E, 0x4E, 0xA1, 0xAF,
+    0x2A, 0xE4, 0xE9, 0x1A, 0xEA, 0x2E, 0xA4, 0xE2, 0x9E, 0x3E, 0x93, 0x3A, 0xEA, 0x59, 0xE4, 0xFC,
+    0x5A, 0xE4, 0xFC, 0x94, 0xEA, 0x39, 0xFD, 0x4E, 0x93, 0xAF, 0xD3, 0x9E, 0x4A, 0xDA, 0xE9, 0x2A,
+    0xE4, 0xE9, 0xAE, 0x2A, 0xDA, 0x4E, 0x09, 0xE2, 0xEA, 0x39, 0xE1, 0xE9, 0x1E, 0x93, 0xAE, 0x1F,
+    0x09, 0xE4, 0xEA, 0x19, 0xE0, 0xAE, 0x4E, 0x92, 0xE9, 0xAD, 0xA4, 0xE3, 0xFE, 0x93, 0x9E, 0x39,
+    0xFD, 0x93, 0xAE, 0x4F, 0xD4, 0xEA, 0x4F, 0xD4, 0xE9, 0x4A, 0xFA, 0x39, 0xE6, 0xF9, 0x30, 0x77,
+    0x69, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F,
+    0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9,
+    0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF,
+    0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x3A, 0xFD, 0xA9, 0x6F, 0xFD,
+    0x5F, 0xFD, 0xA3, 0x9E, 0xA9, 0x9A, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A, 0xE3, 0x9E, 0x92, 0xF3, 0xAE,
+    0x92, 0xEA, 0x3F, 0x29, 0xEA, 0x99, 0xAF, 0xA2, 0xAF, 0xFD, 0xA3, 0xFF, 0xD9, 0x4F, 0xAA, 0xAA,
+    0x96, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0x77, 0x69, 0xFC,
+    0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA9, 0x1A, 0xF2, 0xFA, 0x4F, 0x19, 0xF5, 0xAE,
+    0x90, 0xAE, 0x95, 0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA, 0x69, 0xE9, 0x9E, 0x96, 0xAE, 0x9A, 0xE9,
+    0x6F, 0x0A, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0xF9, 0x09, 0xF4, 0xAF, 0x2F, 0xA2, 0xAF, 0x92, 0x9F,
+    0xFE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xE7, 0x4A, 0xEA, 0x74, 0xF7, 0x49, 0xF7, 0x4F, 0xA7, 0x49,
+    0x99, 0x30, 0x3A, 0xFC, 0xAA, 0x6F, 0xFC, 0x94, 0xFF, 0xD9, 0x29, 0xEA, 0x1A, 0xEA, 0x29, 0xE9,
+    0x2F, 0x2A, 0xE3, 0xF2, 0xF3, 0xEA, 0x2E, 0xA2, 0xF9, 0x19, 0xFF, 0xDA, 0x2A, 0xFF, 0xCA, 0x3F,
+    0xFC, 0x94, 0xF0, 0x9E, 0x94, 0xEA, 0x1F, 0x39, 0xE9, 0x1A, 0xE9, 0x2A, 0xE2, 0x9E, 0xA2, 0xF3,
+    0xF2, 0xEA, 0x3A, 0xEA, 0x1E, 0xA4, 0xF0, 0x77, 0x29, 0xFC, 0xA9, 0x4F, 0xFC, 0x92, 0xAF, 0xFC,
+    0x3F, 0x91, 0x9A, 0x92, 0x9E, 0xA7, 0x09, 0xE9, 0x70, 0x9F, 0x71, 0xFC, 0x97, 0x9F, 0xCA, 0x79,
+    0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0x97, 0x09, 0xEA, 0x70, 0x9E, 0x91, 0x9A, 0x93, 0xF9, 0x1A, 0xFF,
+    0xD2, 0xAF, 0xFC, 0x4A, 0xFD, 0xA7, 0x72, 0x9F, 0xFF, 0x0A, 0xFF, 0xF0, 0xFF, 0xFA, 0x09, 0x99,
+    0x9F, 0x99, 0x99, 0x5F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x1E, 0xA7,
+    0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1F, 0x70, 0x9E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x70, 0x2A,
+    0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E, 0x94, 0xF2, 0xAE, 0x5E, 0xA2, 0xF4, 0x9E,
+    0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94, 0xEA, 0x2A, 0xE4, 0x9E, 0xA2, 0xF4, 0x9E,
+    0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3, 0x9E, 0xA3, 0xF9, 0x19, 0xF4, 0xFF, 0xEA,
+    0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x60, 0xAD, 0xA6, 0xEA, 0xAE, 0x5A, 0xE9, 0xAE, 0x5F, 0x09,
+    0xE4, 0x9E, 0x90, 0x9E, 0x4F, 0x19, 0xE3, 0x9E, 0x92, 0xE3, 0xF3, 0xE9, 0x19, 0xE4, 0xE9, 0x1E,
+    0xA4, 0xE9, 0x09, 0xE5, 0xE9, 0x0E, 0xA5, 0xEA, 0x9E, 0x6A, 0xDA, 0xEA, 0x6A, 0xDA, 0xE7, 0xAF,
+    0xCA, 0x79, 0xFC, 0x70, 0x9F, 0xA7, 0x1F, 0x70, 0xAD, 0xA4, 0x9E, 0x5E, 0x9A, 0xE4, 0xF4, 0xAE,
+    0x0A, 0xE3, 0x9F, 0x4E, 0xA0, 0xAE, 0x3A, 0xF3, 0x9E, 0x1A, 0xE3, 0xFC, 0x3F, 0x1A, 0xE2, 0xAF,
+    0xC2, 0x9E, 0x91, 0xAE, 0x2E, 0xAD, 0x2A, 0xE2, 0xAE, 0x1A, 0xDA, 0xAD, 0x91, 0xE9, 0x29, 0xE1,
+    0xE0, 0xAD, 0x90, 0xAE, 0x39, 0xE0, 0x9D, 0xA0, 0xAD, 0x90, 0xEA, 0x39, 0xE0, 0xE9, 0x0A, 0xD9,
+    0x9E, 0x49, 0xE9, 0xE1, 0xAD, 0x9E, 0xA4, 0x9E, 0xAD, 0x91, 0xAD, 0x9E, 0x59, 0xFD, 0x2A, 0xDA,
+    0xE5, 0x9F, 0xC9, 0x2A, 0xFC, 0x95, 0x9F, 0xC3, 0x9F, 0xC6, 0x9F, 0xA3, 0x9F, 0x97, 0xF4, 0x9F,
+    0x70, 0x4E, 0xA4, 0x9E, 0xA5, 0xF4, 0xF6, 0x9E, 0x92, 0xF9, 0x7E, 0xA1, 0x9E, 0xA7, 0x0F, 0x1F,
+    0x71, 0x9E, 0x9F, 0x73, 0xFE, 0x97, 0x3F, 0xDA, 0x74, 0xAF, 0xC7, 0x5F, 0xD7, 0x4F, 0xE7, 0x3A,
+    0xEA, 0xE9, 0x71, 0x9E, 0xA0, 0xF7, 0x1F, 0x1A, 0xE7, 0x0F, 0x91, 0x9E, 0xA6, 0xAE, 0xA3, 0xF5,
+    0x9F, 0x4F, 0x94, 0xF5, 0x9E, 0xA3, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F,
+    0x2F, 0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F,
+    0xC7, 0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA,
+    0x70, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0x9F, 0xFE, 0x49, 0x99, 0x99, 0x9F, 0x97, 0x1A, 0xEA,
+    0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF7, 0x2F, 0x97,
+    0x1A, 0xEA, 0x71, 0x9F, 0x72, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x2A, 0xFF, 0xE9, 0x20, 0x4A, 0xFA,
+    0x4F, 0xCA, 0x39, 0xEA, 0xA9, 0x3A, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xE6, 0xAD, 0xA6, 0xE9,
+    0x6E, 0x7E, 0x69, 0xDA, 0x6A, 0xDA, 0x6E, 0x96, 0xE6, 0x9E, 0x6A, 0xDA, 0x6A, 0xD9, 0x6E, 0xAA,
+    0xA4, 0xFC, 0xA3, 0x9F, 0xC9, 0x30, 0x0E, 0x3E, 0x3E, 0x3E, 0x92, 0xAD, 0x92, 0x9D, 0xA2, 0x9E,
+    0x3E, 0x3E, 0x3E, 0x92, 0xAD, 0x92, 0xAD, 0xA2, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E, 0x92, 0xAD, 0xA6,
+    0x4F, 0xCA, 0x39, 0xFC, 0x93, 0x9A, 0xAE, 0x7E, 0x69, 0xE6, 0xAD, 0xA6, 0xE9, 0x6E, 0x7E, 0x69,
+    0xDA, 0x6A, 0xDA, 0x6E, 0x96, 0xE6, 0x9E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xE4, 0xAA,
+    0xEA, 0x39, 0xFC, 0x93, 0xAF, 0xC4, 0x69, 0xD7, 0x2E, 0x71, 0xAE, 0x97, 0x9F, 0xC7, 0xEA, 0xD6,
+    0xAD, 0x99, 0xD9, 0x5D, 0xA1, 0xDA, 0x4E, 0x2A, 0xD3, 0xAD, 0x92, 0x9D, 0x3E, 0x4D, 0xA1, 0xE5,
+    0xE1, 0xAA, 0x95, 0x9A, 0xA0, 0x0A, 0xFF, 0xA1, 0xFF, 0xD0, 0x6E, 0xA1, 0x9E, 0x2A, 0xD9, 0x2A,
+    0xCA, 0x39, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29,
+    0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E,
+    0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x3A, 0xE7, 0x1F,
+    0x71, 0xEA, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1A, 0xE0, 0xAD, 0xA4, 0xEA, 0xFD, 0x3F, 0xFD, 0x91,
+    0x9F, 0x90, 0xAE, 0xA1, 0xAE, 0x92, 0xF1, 0xF3, 0xF1, 0xEA, 0x3E, 0xA1, 0xE9, 0x3E, 0xA0, 0x9E,
+    0x3A, 0xE9, 0x0A, 0xE3, 0xF1, 0xFA, 0x1A, 0xEA, 0x1F, 0xFE, 0x2F, 0xFD, 0x29, 0xD9, 0x0F, 0xC7,
+    0x71, 0x39, 0xAE, 0xA9, 0x3A, 0xFE, 0x2F, 0xFA, 0x1A, 0xF9, 0x1A, 0x91, 0xF6, 0x9E, 0xA6, 0xAE,
+    0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x29, 0x29, 0xFF, 0x92, 0xFF, 0x93, 0xAF, 0xCA, 0x76, 0x72, 0xE9,
+    0x71, 0x9E, 0x72, 0xAE, 0x72, 0xF7, 0x2E, 0xA4, 0x9D, 0xA1, 0xE9, 0x3F, 0xD9, 0xE3, 0xFF, 0xE2,
+    0x9F, 0x1F, 0xC2, 0xF2, 0x9E, 0xA1, 0x9E, 0xA2, 0x9E, 0x91, 0xAE, 0x39, 0xE2, 0xF3, 0xAE, 0x2F,
+    0x3E, 0xA2, 0xF2, 0x9E, 0x92, 0xF2, 0xF9, 0x2A, 0xFF, 0xD4, 0xFD, 0xAE, 0x49, 0xF9, 0x0D, 0xA7,
+    0x72, 0x4A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E, 0x90, 0xF2, 0x9E, 0x09,
+    0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F, 0x70, 0xAE, 0x49, 0x29,
+    0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77, 0x77, 0x70, 0xAF, 0xC7, 0x0A, 0xFD, 0x70,
+    0xFD, 0x97, 0xAE, 0x97, 0x2F, 0x72, 0x9F, 0xAA, 0x69, 0xFF, 0x6A, 0xFF, 0x70, 0xF7, 0x3F, 0x73,
+    0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7,
+    0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2F, 0x70, 0xAF, 0xD7, 0x0A, 0xFC, 0x71, 0xAE, 0xA7, 0x20,
+    0x4A, 0xDA, 0x19, 0xAA, 0x93, 0xFD, 0x9E, 0x3F, 0xFE, 0x29, 0xF9, 0x0F, 0xC2, 0xF2, 0x9E, 0xA1,
+    0x9E, 0xA2, 0x9E, 0x91, 0xAE, 0x92, 0x9E, 0x2F, 0x3A, 0xE2, 0xF3, 0xEA, 0x2F, 0x29, 0xEA, 0x2F,
+    0x19, 0xF9, 0x2A, 0xFF, 0xD4, 0xFF, 0xD4, 0x9F, 0x0E, 0xA7, 0x2E, 0x97, 0x1A, 0xE3, 0x99, 0x39,
+    0xF3, 0xAF, 0xFC, 0x4A, 0xFF, 0x95, 0xAF, 0xCA, 0x60, 0x3A, 0xE7, 0x1F, 0x71, 0xEA, 0x70, 0x9E,
+    0x97, 0x09, 0xE7, 0x1A, 0xE0, 0x9D, 0xA4, 0xEA, 0xFD, 0x3F, 0xFD, 0xA1, 0x9F, 0xA0, 0x9F, 0x1A,
+    0xF2, 0xF1, 0xF3, 0xEA, 0x1F, 0x3E, 0x91, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F,
+    0x1F, 0x3E, 0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0x74, 0x9D, 0xA4, 0xF4,
+    0xF4, 0x9A, 0xA7, 0x59, 0xAA, 0xA4, 0xF4, 0xEA, 0x39, 0xE9, 0x3A, 0xE4, 0xF4, 0xF4, 0xEA, 0x39,
+    0xE9, 0x3A, 0xE4, 0xF4, 0xEA, 0x4E, 0x93, 0x9E, 0x93, 0x77, 0x49, 0xDA, 0x70, 0xF7, 0x0F, 0x70,
+    0x9A, 0xA7, 0x75, 0x9A, 0xAA, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xF7,
+    0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x7A,
+    0xEA, 0x5F, 0xD6, 0xFC, 0xA6, 0xF9, 0x60, 0x3A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x29,
+    0xE7, 0x3A, 0xE3, 0xAA, 0xAA, 0x3F, 0x2F, 0x93, 0xEA, 0x1F, 0x93, 0x9E, 0x90, 0xAE, 0x94, 0xAE,
+    0x0A, 0xE9, 0x5F, 0xAE, 0x96, 0xFE, 0xA7, 0xFF, 0x69, 0xFF, 0x95, 0xAE, 0x99, 0xEA, 0x5F, 0x1F,
+    0x5E, 0xA1, 0x9E, 0xA4, 0xE9, 0x2F, 0x39, 0xE3, 0x9E, 0xA2, 0x3A, 0xE4, 0xF4, 0xEA, 0x39, 0xE9,
+    0x39, 0xE9, 0x3A, 0xE4, 0xF4, 0xEA, 0x39, 0xE9, 0x3A, 0xE4, 0xF4, 0xF4, 0xEA, 0x39, 0xE9, 0x3A,
+    0xE4, 0xF4, 0xEA, 0x39, 0xE9, 0x39, 0xE9, 0x30, 0x29, 0xAA, 0x1A, 0xDA, 0x3A, 0xDA, 0x4E, 0x0F,
+    0xD0, 0x9F, 0xCA, 0x3E, 0xAF, 0xDA, 0xFE, 0x29, 0xFA, 0x09, 0xFC, 0x90, 0xAE, 0x91, 0xAF, 0x2F,
+    0x91, 0x9E, 0x91, 0xF3, 0xF2, 0x9E, 0x2F, 0x29, 0xE9, 0x2A, 0xE2, 0xEA, 0x2A, 0xE3, 0xF1, 0x9E,
+    0x92, 0xAE, 0x3E, 0xA1, 0xAE, 0x3E, 0xA2, 0x9E, 0x91, 0xF3, 0xEA, 0x29, 0xE2, 0xEA, 0x29, 0xE9,
+    0x2A, 0xE2, 0xE9, 0x2A, 0xE3, 0xF1, 0x9E, 0x3F, 0x3E, 0xA1, 0x29, 0xAA, 0x1A, 0xDA, 0x4E, 0x0F,
+    0xD3, 0xEA, 0xFD, 0xA1, 0x9F, 0xA0, 0x9F, 0x1A, 0xF2, 0xF1, 0xF3, 0xEA, 0x1F, 0x3E, 0x91, 0xEA,
+    0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29,
+    0xE1, 0x9E, 0x3A, 0xE1, 0x39, 0xAE, 0xA5, 0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99,
+    0xE9, 0x3E, 0xAA, 0xE4, 0xE9, 0xF3, 0x9E, 0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09,
+    0xFF, 0xD2, 0xAF, 0xF4, 0xAF, 0xCA, 0x77, 0x00, 0x39, 0xAA, 0x1A, 0xDA, 0x5E, 0x9F, 0xD4, 0xFF,
+    0xD9, 0x29, 0xF9, 0x0A, 0xEA, 0x2A, 0xE9, 0x2F, 0x2F, 0x3F, 0x2E, 0xA3, 0xEA, 0x2E, 0x93, 0xEA,
+    0x19, 0xE3, 0xAE, 0x91, 0xAE, 0x3F, 0x2F, 0xA1, 0xAE, 0xA2, 0xFF, 0xE3, 0xEA, 0xFD, 0x39, 0xE0,
+    0xAF, 0x4A, 0xE7, 0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2A, 0xE7, 0x20, 0x39, 0xE9,
+    0x09, 0xAA, 0x3F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x1F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E,
+    0x90, 0xAE, 0x39, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0x91, 0xF2, 0xF9, 0x1A, 0xFA,
+    0xFC, 0x3F, 0xFD, 0x39, 0xF0, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xF7, 0x1E, 0xA7,
+    0x09, 0xE9, 0x30, 0x29, 0xAA, 0x1A, 0xD9, 0x2E, 0x9F, 0x3F, 0xF2, 0x9F, 0xCA, 0xAA, 0x2A, 0xF6,
+    0xF9, 0x6F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7E, 0xA7, 0xE9, 0x69, 0xE9, 0x60, 0x3A, 0xFA,
+    0x39, 0xFF, 0x2F, 0xFC, 0x2E, 0xA2, 0x99, 0x19, 0xEA, 0x7F, 0xC6, 0xAF, 0xCA, 0x5A, 0xFC, 0xA6,
+    0xFC, 0x7F, 0x19, 0x4A, 0xE1, 0xAD, 0xAA, 0xFC, 0x1A, 0xFF, 0x29, 0xFD, 0xA7, 0x70, 0x39, 0xA9,
+    0x6D, 0xA5, 0xAD, 0x94, 0xAF, 0xAA, 0x99, 0xFF, 0x9A, 0xFF, 0x91, 0xEA, 0x49, 0xE9, 0x4A, 0xE5,
+    0xAE, 0x5F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x94, 0xAF, 0xAC, 0x91, 0x9F, 0xD9, 0x2A, 0xFC, 0x74,
+    0x1A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9, 0x09, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0xAE,
+    0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0x3F, 0x1A, 0xE2, 0x9E,
+    0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92, 0xFD, 0x9E, 0x39, 0xF9, 0x0E, 0x77, 0x00, 0x9A, 0xAA,
+    0x4A, 0xAA, 0xA0, 0xAE, 0x39, 0xEA, 0x09, 0xE3, 0xF1, 0x9E, 0x29, 0xEA, 0x2E, 0x2F, 0x3E, 0x90,
+    0x9E, 0x93, 0xE9, 0x0F, 0x4E, 0x99, 0xE9, 0x4E, 0x9A, 0xE5, 0xAD, 0xAE, 0x95, 0xAF, 0xD6, 0x9F,
+    0xC7, 0x9F, 0xA7, 0x0F, 0x70, 0x9A, 0xAA, 0x3A, 0xAA, 0xA3, 0xAA, 0xAA, 0x9E, 0x29, 0xF2, 0x9E,
+    0x99, 0xE2, 0xFC, 0x2A, 0xE0, 0x9E, 0x19, 0xFC, 0x2E, 0x90, 0x9E, 0x1A, 0xDA, 0xD1, 0xAE, 0x2E,
+    0x1D, 0xAA, 0xD1, 0xEA, 0x2E, 0x0A, 0xD9, 0xAD, 0x09, 0xE3, 0xE0, 0xE0, 0xAD, 0x0E, 0xA3, 0xE9,
+    0xD9, 0x0A, 0xD9, 0xE4, 0xEA, 0xD1, 0xAD, 0xAD, 0xA4, 0xFC, 0xA1, 0xAF, 0xC5, 0xFC, 0x2A, 0xFA,
+    0x5F, 0xA2, 0xAF, 0x6F, 0x92, 0xAE, 0xA5, 0x3A, 0xAA, 0xA3, 0xAA, 0xAA, 0x4A, 0xE9, 0x1A, 0xEA,
+    0x49, 0xEA, 0x09, 0xF6, 0xF0, 0xF7, 0x9F, 0xE7, 0x1F, 0xD9, 0x71, 0xAF, 0xA7, 0x2F, 0xC7, 0x2A,
+    0xFC, 0xA7, 0x0A, 0xFE, 0x79, 0xEA, 0x9E, 0x96, 0xF1, 0xF5, 0xF2, 0xAE, 0x4F, 0x92, 0x9E, 0xA2,
+    0x29, 0xAA, 0xA4, 0xAA, 0xAA, 0x3A, 0xE3, 0x9E, 0xA3, 0x9E, 0x3F, 0x49, 0xE2, 0x9E, 0xA5, 0xE9,
+    0x1A, 0xE6, 0xE9, 0x1E, 0xA6, 0xEA, 0x0A, 0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0xAE, 0x70, 0x9D,
+    0xAE, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x97, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x3A, 0xE7, 0x3A,
+    0xEA, 0x70, 0xAF, 0xD7, 0x1A, 0xFC, 0x72, 0xAE, 0x97, 0x30, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0x29,
+    0xFF, 0xA2, 0xAF, 0xFA, 0x69, 0xF7, 0xF7, 0xF9, 0x6A, 0xE9, 0x6A, 0xEA, 0x69, 0xEA, 0x7F, 0x7F,
+    0x7F, 0xFC, 0xA2, 0xFF, 0xCA, 0x19, 0xFF, 0xC9, 0x10, 0x7A, 0xD9, 0x59, 0xF6, 0xFC, 0x59, 0xE9,
+    0x6A, 0xDA, 0x7E, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x49, 0xAF, 0x5A, 0xF9, 0x5F, 0x96, 0x9A, 0xE7,
+    0x0E, 0x97, 0xE9, 0x7E, 0x70, 0xE7, 0x9E, 0x7A, 0xE7, 0x9F, 0x96, 0xF9, 0x7A, 0xD9, 0x30, 0x9D,
+    0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9A, 0xA0, 0x39, 0xCA, 0x96, 0x9F, 0x5A, 0xF7, 0xE9, 0x6E, 0x7E, 0x69, 0xE6,
+    0xAD, 0xA6, 0xAD, 0xA6, 0x9E, 0xA9, 0x5A, 0xF4, 0x9A, 0xEA, 0x39, 0xFA, 0x4E, 0xA6, 0xE6, 0x9E,
+    0x6A, 0xDA, 0x6E, 0x95, 0x9E, 0x5F, 0xC4, 0x9F, 0x94, 0x9D, 0xA6, 0x09, 0xEA, 0x59, 0xAF, 0xEA,
+    0x9A, 0xC9, 0xAF, 0xFE, 0x9A, 0x92, 0x9A, 0xFA, 0x75, 0x39, 0xAA, 0x39, 0xEA, 0x2A, 0xEA, 0x29,
+    0xE9, 0x39, 0x97, 0x49, 0x99, 0x4E, 0x39, 0xE3, 0xAD, 0xA3, 0xEA, 0x3E, 0x92, 0x9E, 0x3A, 0xE3,
+    0xF3, 0xEA, 0x29, 0xEA, 0x2A, 0xE9, 0x29, 0xAA, 0xA3, 0x77, 0x1A, 0xD7, 0x0D, 0xA6, 0xAF, 0xCA,
+    0x29, 0xFF, 0x2F, 0xCA, 0xD9, 0x1A, 0xEA, 0x6E, 0xA6, 0xAE, 0x96, 0xF7, 0xF7, 0xEA, 0x7F, 0x7F,
+    0xA1, 0x9C, 0x29, 0xFF, 0x3A, 0xFE, 0x49, 0xFA, 0x6D, 0x97, 0x0D, 0x71, 0x99, 0x60, 0x77, 0x70,
+    0x9F, 0xCA, 0x97, 0xAF, 0xF6, 0x9F, 0xF9, 0x6F, 0x92, 0xA7, 0xEA, 0x73, 0x9E, 0x97, 0x39, 0xE7,
+    0x4A, 0xE7, 0x2F, 0xFC, 0x95, 0x9F, 0xFC, 0x95, 0x9A, 0xAE, 0xAA, 0xAA, 0x70, 0xAE, 0x74, 0xF7,
+    0x39, 0xE9, 0x72, 0x9E, 0x97, 0x2A, 0xFF, 0xEA, 0x3F, 0xFF, 0x93, 0xFF, 0xF3, 0x19, 0x71, 0xD9,
+    0x9A, 0xA9, 0x0D, 0x99, 0xFF, 0xDA, 0x09, 0xFF, 0xA1, 0x9D, 0xA1, 0x9D, 0xA1, 0xAD, 0x3A, 0xD1,
+    0xAD, 0x3A, 0xD1, 0x9D, 0x92, 0xE2, 0xEA, 0xAE, 0xA1, 0xFF, 0xD9, 0x0D, 0xAA, 0xEA, 0xD9, 0x1A,
+    0x59, 0x90, 0x09, 0xE4, 0x9E, 0x90, 0x9E, 0x93, 0xF2, 0xE9, 0x2A, 0xE3, 0xAD, 0xA2, 0xE9, 0x39,
+    0xE1, 0xF5, 0xE0, 0x9E, 0x6E, 0x9E, 0x96, 0xAF, 0xD7, 0x9F, 0xC6, 0xAA, 0xFD, 0xAA, 0x4F, 0xFD,
+    0x49, 0x9A, 0xEA, 0x99, 0x96, 0x9E, 0x96, 0x9F, 0xFC, 0x4F, 0xFD, 0x49, 0x99, 0xEA, 0x99, 0x70,
+    0xE9, 0x71, 0x9E, 0x70, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD7, 0x71, 0x99, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9A, 0xA0, 0x77, 0x1A, 0xFC, 0xA4, 0xFF, 0x92, 0xAE, 0x99, 0x9D, 0x3E, 0x97,
+    0x0F, 0x70, 0x9F, 0xA6, 0x9F, 0xD9, 0x39, 0xE9, 0xF3, 0xE2, 0xE9, 0x2E, 0x2A, 0xD9, 0x2E, 0x91,
+    0xE3, 0xAF, 0xE9, 0x4A, 0xFC, 0x96, 0x9F, 0xA7, 0x0A, 0xE7, 0x09, 0xE2, 0xD9, 0x19, 0xF2, 0xFF,
+    0xC3, 0x9F, 0xDA, 0x77, 0x10, 0x0A, 0xA1, 0x9C, 0xA0, 0xE9, 0x0E, 0x0E, 0x1E, 0x19, 0x91, 0x99,
+    0x10, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xAD, 0xAA, 0x9A, 0xEA, 0x6D, 0xA6, 0xAD, 0x4D, 0x39, 0xAA,
+    0x91, 0xAD, 0x2A, 0xC9, 0x19, 0xFD, 0x1A, 0xC9, 0x1C, 0xA1, 0x9D, 0x91, 0x99, 0x2D, 0x09, 0xC9,
+    0x1D, 0x97, 0xAC, 0x0A, 0xC2, 0xD7, 0x09, 0xC9, 0xD1, 0x9D, 0x71, 0xCA, 0xD1, 0x9D, 0x71, 0xCA,
+    0xAC, 0x2D, 0x70, 0x9C, 0x99, 0xC9, 0x1D, 0x97, 0xAC, 0x90, 0xCA, 0x1A, 0xD7, 0xD1, 0xAC, 0x2A,
+    0xFC, 0xA1, 0xAC, 0xA2, 0xD2, 0x9A, 0xDA, 0x19, 0xD3, 0x9D, 0x96, 0xAD, 0x59, 0xEA, 0x99, 0x9A,
+    0xE7, 0x09, 0xFE, 0x97, 0x77, 0x74, 0xAD, 0xA9, 0xCA, 0x1F, 0xE9, 0x09, 0xD9, 0x0A, 0xD1, 0xE1,
+    0x9D, 0x1D, 0xA1, 0xAD, 0x1D, 0x91, 0xDA, 0x1D, 0xA0, 0xAD, 0x91, 0xFE, 0x3A, 0xCA, 0x0A, 0xA1,
+    0x49, 0x49, 0x7D, 0x91, 0x9D, 0x94, 0xF1, 0xF3, 0xF1, 0xF3, 0xF9, 0x0F, 0x92, 0xAE, 0x90, 0xAE,
+    0x93, 0xF1, 0xF4, 0xAE, 0x1A, 0xE5, 0xEA, 0x1E, 0xA4, 0xAE, 0x1A, 0xE4, 0x9E, 0x19, 0xE5, 0xA9,
+    0x3A, 0x93, 0x74, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x19, 0x99, 0x99, 0x1F, 0xD9, 0x9F, 0xD0, 0x9F, 0xD0, 0x77,
+    0x79, 0xAF, 0xCA, 0x71, 0xAD, 0xAA, 0x9A, 0xEA, 0x6D, 0xA6, 0xAD, 0x4D, 0x1A, 0xAA, 0x99, 0x2A,
+    0xD2, 0xAC, 0x91, 0xFD, 0x91, 0xAC, 0x91, 0xCA, 0x2D, 0x09, 0xAD, 0x2D, 0x09, 0xC9, 0x2D, 0x2D,
+    0x2A, 0xC0, 0xAC, 0x3D, 0x2D, 0x29, 0xC9, 0xD3, 0xD9, 0x9D, 0xA3, 0xCA, 0xD3, 0xFC, 0xA4, 0xCA,
+    0xAC, 0x3D, 0x9A, 0xCA, 0x39, 0xC9, 0x9C, 0x92, 0xD1, 0xD9, 0x2A, 0xC9, 0x0C, 0xA2, 0xD1, 0x9D,
+    0x2D, 0x1A, 0xC2, 0xD2, 0xD9, 0x0A, 0xCA, 0x2D, 0x1A, 0x93, 0xA9, 0x9D, 0x39, 0xD9, 0x6A, 0xD5,
+    0x9E, 0xA9, 0x99, 0xAE, 0x70, 0x9F, 0xE9, 0x77, 0x70, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFD, 0xA9, 0xFF, 0xD9, 0x73, 0x72, 0xAE, 0xA2, 0xFD, 0xA0, 0xAD, 0x90, 0xAD, 0x9D, 0xA2, 0xDA,
+    0xD9, 0x2D, 0xAE, 0x19, 0xD9, 0x9F, 0xE1, 0x9F, 0xC4, 0x99, 0x30, 0x4A, 0xA9, 0x71, 0xDA, 0x71,
+    0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x4A, 0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x4D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x19, 0x99, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFE,
+    0x9A, 0xFF, 0xE9, 0x49, 0x95, 0xFC, 0xA2, 0xAF, 0xD9, 0x2C, 0x90, 0xAD, 0xA5, 0xAD, 0x95, 0xE4,
+    0x9E, 0x4A, 0xE4, 0xAD, 0xA4, 0xFE, 0xA0, 0x9F, 0xEA, 0x09, 0xAA, 0xAA, 0xAA, 0xA1, 0x49, 0x95,
+    0xFC, 0xA2, 0x9F, 0xD9, 0x29, 0x19, 0xDA, 0x59, 0xD9, 0x29, 0xF9, 0x3F, 0xA6, 0x9D, 0xA6, 0xE1,
+    0xCA, 0x99, 0xEA, 0x1F, 0xE2, 0x9A, 0xDA, 0x92, 0x72, 0xF2, 0xAE, 0x91, 0x9E, 0x3D, 0xA3, 0x39,
+    0xAA, 0xA3, 0xAA, 0xA9, 0x3F, 0x3E, 0xA3, 0xEA, 0x29, 0xE9, 0x29, 0xE9, 0x2A, 0xE3, 0xAE, 0x3A,
+    0xE3, 0xF3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA2, 0x9E, 0x92, 0x9E, 0x92, 0xF3, 0xAE, 0x3F, 0x3F,
+    0x91, 0xFA, 0x3F, 0xFE, 0x93, 0xFF, 0xAD, 0x39, 0xEA, 0xE0, 0xE3, 0xAE, 0x73, 0xF7, 0x3E, 0xA7,
+    0x29, 0xE9, 0x72, 0xAE, 0x73, 0xAE, 0x73, 0x29, 0xFF, 0xCA, 0x1F, 0xFE, 0xA0, 0x9F, 0xF9, 0xAC,
+    0xA0, 0xFF, 0xA0, 0x9C, 0xA0, 0xFF, 0xA0, 0x9C, 0xA0, 0xFF, 0xA0, 0x9C, 0xA0, 0xFF, 0xA0, 0x9C,
+    0xA0, 0xFF, 0xA0, 0x9C, 0xA0, 0xFF, 0xA0, 0x9C, 0xA0, 0xAF, 0xEA, 0x09, 0xCA, 0x1F, 0xEA, 0x09,
+    0xCA, 0x19, 0xFD, 0xA0, 0x9C, 0xA3, 0x99, 0x99, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69,
+    0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69,
+    0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x75,
+    0x09, 0xD9, 0x1F, 0x09, 0xF1, 0xE9, 0x29, 0x20, 0x1A, 0xCA, 0x3E, 0xA3, 0xE3, 0xE0, 0xAF, 0xC0,
+    0x9E, 0xA1, 0x73, 0xAD, 0xA1, 0x9F, 0x90, 0xFD, 0x09, 0xDA, 0xE1, 0xA9, 0x9D, 0xA3, 0xAD, 0x93,
+    0xAD, 0x93, 0xE4, 0xE3, 0x9D, 0xA3, 0x9A, 0xA9, 0x10, 0x19, 0xEA, 0x1A, 0xFC, 0xA9, 0xDA, 0x0E,
+    0xAD, 0x1A, 0xFA, 0x1A, 0xFA, 0x1D, 0xAE, 0x0A, 0xD9, 0x9F, 0xCA, 0x19, 0xE9, 0x10, 0x39, 0x49,
+    0x4A, 0xD2, 0xAD, 0x4E, 0xA1, 0xEA, 0x3A, 0xE1, 0xAE, 0x4E, 0xA1, 0xE9, 0x3F, 0x1F, 0x3F, 0x1F,
+    0x2F, 0x1F, 0x2A, 0xE9, 0x0F, 0x91, 0xAE, 0x90, 0xAE, 0x92, 0x9D, 0xA1, 0x9D, 0xA5, 0xA3, 0x9A,
+    0x40, 0x77, 0x69, 0xE5, 0x9D, 0x93, 0xAF, 0x5E, 0x2A, 0xFC, 0xA4, 0xE3, 0xFD, 0x93, 0xAD, 0x93,
+    0x9A, 0x0E, 0x39, 0xDA, 0x7E, 0x3E, 0x70, 0xE2, 0xE7, 0x09, 0xDA, 0x1A, 0xD9, 0x1A, 0xE2, 0xAD,
+    0x90, 0x9D, 0xA1, 0xAE, 0xA2, 0xE1, 0xE1, 0x9F, 0x92, 0xAA, 0xA0, 0xE1, 0x9F, 0xC6, 0xAD, 0x91,
+    0xD9, 0xE5, 0x9D, 0xA1, 0xDA, 0x0E, 0x5E, 0x1E, 0x9A, 0xDA, 0x93, 0xAD, 0x2F, 0xFC, 0x2A, 0xD9,
+    0x2F, 0xF9, 0x19, 0xDA, 0x7E, 0x3E, 0x70, 0xAA, 0x91, 0x77, 0x70, 0x9E, 0x59, 0xD9, 0x5A, 0xF5,
+    0xE4, 0xAF, 0xCA, 0x4E, 0x5F, 0xD9, 0x3A, 0xD9, 0x59, 0xA0, 0xE3, 0x9D, 0xA7, 0x1E, 0x3E, 0x72,
+    0xE2, 0xE2, 0x99, 0x59, 0xDA, 0x1A, 0xD9, 0x9F, 0xC9, 0x3A, 0xD9, 0x09, 0xDA, 0x0F, 0xE3, 0xE1,
+    0xE1, 0x9A, 0x1E, 0x3A, 0xAA, 0x0E, 0x6E, 0x6A, 0xD9, 0x5A, 0xDA, 0x59, 0xDA, 0x5A, 0xDA, 0x6E,
+    0x5E, 0xA6, 0xE5, 0xE9, 0x6A, 0xD9, 0x39, 0xFE, 0x92, 0x9D, 0xA4, 0xAF, 0xE3, 0xE5, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x10, 0x49, 0x77, 0xAF, 0xC6, 0xAD, 0x3F, 0xE4, 0x9D, 0xA3, 0x92, 0xE4, 0xE7, 0x0D,
+    0xA3, 0xE6, 0xFA, 0x3A, 0xD9, 0x59, 0xF9, 0x29, 0xDA, 0x71, 0xE2, 0xE7, 0x2A, 0xD1, 0xE2, 0xEA,
+    0xCA, 0x99, 0xAE, 0x0A, 0xD9, 0x1F, 0x9F, 0xE9, 0x9D, 0xA1, 0xAF, 0x09, 0xAD, 0xAA, 0x1E, 0x1A,
+    0xFC, 0x7E, 0x19, 0xD9, 0xDA, 0x6A, 0xD9, 0x09, 0xD9, 0x9D, 0x95, 0x9D, 0xA1, 0xDA, 0x9A, 0xD9,
+    0x5E, 0x19, 0xFF, 0xA3, 0xE2, 0x9F, 0xF9, 0x2A, 0xD9, 0x69, 0xDA, 0x39, 0xDA, 0x79, 0xAA, 0x91,
+    0x6A, 0xD6, 0x9E, 0xA5, 0xAE, 0xA5, 0x9E, 0x77, 0x74, 0xAA, 0xA9, 0x6E, 0x6F, 0x49, 0xF4, 0xAF,
+    0x93, 0xAF, 0x49, 0xEA, 0x5A, 0xE6, 0xAE, 0x39, 0x90, 0xAF, 0xAA, 0xE1, 0xFF, 0xC9, 0x09, 0xFE,
+    0x93, 0x99, 0x99, 0x30, 0x77, 0x71, 0x9E, 0x97, 0x4A, 0xE7, 0x5E, 0x76, 0xD9, 0x77, 0x73, 0x9F,
+    0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79,
+    0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE,
+    0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E,
+    0xA6, 0x9E, 0x00, 0x77, 0x76, 0xF7, 0x4F, 0x74, 0xAD, 0xA7, 0x49, 0xD9, 0x77, 0x76, 0x9F, 0x97,
+    0x3F, 0xCA, 0x72, 0x9F, 0xCA, 0x72, 0xEA, 0xDA, 0x71, 0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E,
+    0x1E, 0x70, 0xEA, 0x1E, 0x7A, 0xE2, 0xE7, 0xEA, 0x2E, 0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE,
+    0xA4, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xE5, 0xAE, 0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E,
+    0xA6, 0x9E, 0x10, 0x77, 0x73, 0xAF, 0xA7, 0x29, 0xFD, 0x71, 0x9E, 0x09, 0xDA, 0x79, 0xDA, 0x2A,
+    0xD7, 0x77, 0x39, 0xF9, 0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x2E, 0xAD, 0xA7, 0x19, 0xE9, 0xE7,
+    0x1E, 0x99, 0xE7, 0x09, 0xE1, 0xE7, 0x0E, 0xA1, 0xE7, 0xAE, 0x2E, 0x7E, 0xA2, 0xE9, 0x5A, 0xEA,
+    0x99, 0x9E, 0x95, 0xFF, 0xEA, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC3, 0xAE, 0x5A, 0xE3, 0xEA, 0x5A,
+    0xE2, 0xAE, 0x6A, 0xE2, 0xEA, 0x69, 0xE1, 0x70, 0x9D, 0xA2, 0xD7, 0x9F, 0xCA, 0xDA, 0x7D, 0xAA,
+    0xFC, 0x70, 0xCA, 0x2A, 0xCA, 0x77, 0x74, 0x9F, 0x97, 0x3F, 0xCA, 0x72, 0x9F, 0xCA, 0x72, 0xEA,
+    0xDA, 0x71, 0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E, 0x1E, 0x70, 0xEA, 0x1E, 0x7A, 0xE2, 0xE7,
+    0xEA, 0x2E, 0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE, 0xA4, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A,
+    0xE5, 0xAE, 0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E, 0xA6, 0x9E, 0x10, 0x70, 0x9C, 0xA1, 0xAC,
+    0x97, 0x0E, 0x09, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0x99, 0x29, 0x97, 0x77, 0x29, 0xF9, 0x72, 0xFC,
+    0xA7, 0x19, 0xFC, 0xA7, 0x1E, 0xAD, 0xA7, 0x09, 0xE9, 0xE7, 0x0E, 0x99, 0xE7, 0x9E, 0x1E, 0x7E,
+    0xA1, 0xE6, 0xAE, 0x2E, 0x6E, 0xA2, 0xE9, 0x4A, 0xEA, 0x99, 0x9E, 0x94, 0xFF, 0xEA, 0x3A, 0xFF,
+    0xEA, 0x3F, 0xFF, 0xC2, 0xAE, 0x5A, 0xE2, 0xEA, 0x5A, 0xE1, 0xAE, 0x6A, 0xE1, 0xEA, 0x69, 0xE0,
+    0x72, 0xAD, 0x97, 0x3F, 0xCA, 0x72, 0xD1, 0xD7, 0x2D, 0x1D, 0x72, 0xFC, 0x97, 0x3A, 0xD9, 0x77,
+    0x73, 0x9F, 0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9,
+    0x9E, 0x79, 0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9,
+    0x4F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6,
+    0xAE, 0x1E, 0xA6, 0x9E, 0x00, 0x72, 0x9F, 0xFF, 0xC7, 0x3F, 0xFF, 0xD7, 0x2A, 0xFF, 0xFC, 0xA7,
+    0x19, 0xEA, 0xAE, 0x99, 0x99, 0x99, 0x72, 0xF0, 0xAE, 0x77, 0xAE, 0x90, 0xF7, 0x69, 0xEA, 0x1E,
+    0xA7, 0x6F, 0x19, 0xFF, 0xC7, 0x0A, 0xE9, 0x1A, 0xFF, 0xC7, 0x0F, 0x2A, 0xFF, 0xC7, 0xFA, 0x99,
+    0x9F, 0x99, 0x99, 0x97, 0x9F, 0xFE, 0xA7, 0x4F, 0xFF, 0x97, 0x3A, 0xFF, 0xF7, 0x39, 0xEA, 0x4F,
+    0x73, 0xF5, 0xFF, 0xD4, 0xAE, 0x95, 0xFF, 0xD4, 0xF5, 0x9F, 0xFC, 0xA3, 0x77, 0x59, 0xFD, 0xA5,
+    0x9F, 0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x19, 0xAC, 0x3F, 0xA7, 0x19, 0xF7, 0x2A, 0xE9, 0x72,
+    0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0x9E, 0x97, 0x29, 0xF7, 0x3F,
+    0xA3, 0x9A, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x97, 0x09, 0xD7, 0x4E, 0xA7, 0x4A, 0xD9,
+    0x73, 0xAD, 0x97, 0x09, 0xFC, 0x72, 0xEA, 0x70, 0x77, 0x49, 0xEA, 0x72, 0xAE, 0x73, 0xE7, 0x4D,
+    0xA7, 0x75, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71,
+    0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7,
+    0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x30, 0x77, 0x70,
+    0xF7, 0x1A, 0xE7, 0x19, 0xE7, 0x2D, 0xA7, 0x76, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E,
+    0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF,
+    0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F,
+    0xFD, 0x4F, 0xFD, 0x30, 0x77, 0x59, 0xFA, 0x79, 0xFD, 0x69, 0xE0, 0x9E, 0x5D, 0xA2, 0x9D, 0x97,
+    0x72, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71, 0xAE,
+    0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7, 0x2E,
+    0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x30, 0x59, 0xCA, 0x1A,
+    0xC9, 0x6E, 0x99, 0xE6, 0xE0, 0x9E, 0x79, 0x29, 0x97, 0x74, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF,
+    0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC,
+    0x4A, 0xFF, 0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F,
+    0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x30, 0x77, 0x0A, 0xE7, 0x0E, 0xA7, 0x0E, 0x70, 0x9D, 0x97, 0x70,
+    0xFE, 0xA3, 0xFE, 0xA3, 0xFD, 0xA5, 0xAE, 0x7F, 0x7E, 0xA7, 0xE9, 0x69, 0xE9, 0x6A, 0xE7, 0xF7,
+    0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xAE, 0x7F, 0x59, 0xFC, 0xA3, 0x9F, 0xE9, 0x2A, 0xFE, 0x92, 0x77,
+    0x59, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0x9D, 0x97, 0x75, 0xFE, 0xA5, 0xFE, 0xA5, 0xFD, 0xA7,
+    0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x09,
+    0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x9F, 0xCA, 0x59, 0xFE, 0x94, 0xAF, 0xE9, 0x40, 0x77,
+    0x3A, 0xF9, 0x6A, 0xFD, 0x5A, 0xDA, 0x0A, 0xD9, 0x3A, 0xD9, 0x2A, 0xD7, 0x72, 0xFE, 0xA5, 0xFE,
+    0xA5, 0xFD, 0xA7, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7,
+    0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x9F, 0xCA, 0x59, 0xFE, 0x94, 0xAF,
+    0xE9, 0x40, 0x4A, 0xC9, 0x1A, 0xA4, 0x9E, 0x0A, 0xDA, 0x39, 0xDA, 0x0A, 0xD9, 0x49, 0x92, 0x99,
+    0x77, 0x1F, 0xEA, 0x4F, 0xEA, 0x4F, 0xDA, 0x6A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9,
+    0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0A, 0xE7, 0x0F, 0x69, 0xFC, 0xA4, 0x9F,
+    0xE9, 0x3A, 0xFE, 0x93, 0x3A, 0xFD, 0xA7, 0x0F, 0xFC, 0xA6, 0xFF, 0xE4, 0x9E, 0xA9, 0x9A, 0xF9,
+    0x39, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x3F, 0x4A, 0xE1, 0x99, 0xF9, 0x92, 0xAE, 0x1F, 0xF9, 0x1F,
+    0x09, 0xFF, 0x2F, 0x09, 0xAF, 0xAA, 0xA2, 0xF2, 0xF4, 0xAE, 0x92, 0xEA, 0x4F, 0x29, 0xE9, 0x3F,
+    0xA2, 0xAE, 0x90, 0x9A, 0xFC, 0x3F, 0xFF, 0x4F, 0xFD, 0xA5, 0xFE, 0xA9, 0x60, 0x70, 0xAD, 0x91,
+    0x9C, 0xA7, 0x1A, 0xFC, 0xAD, 0x97, 0x1D, 0xAF, 0xD7, 0x19, 0xC9, 0x19, 0xAC, 0xA7, 0x77, 0x3A,
+    0xEA, 0x59, 0xE4, 0xFC, 0x5A, 0xE4, 0xFC, 0x94, 0xEA, 0x39, 0xFD, 0x4E, 0x93, 0xAF, 0xD3, 0x9E,
+    0x4A, 0xDA, 0xE9, 0x2A, 0xE4, 0xE9, 0xAE, 0x2A, 0xDA, 0x4E, 0x09, 0xE2, 0xEA, 0x39, 0xE1, 0xE9,
+    0x1E, 0x93, 0xAE, 0x1F, 0x09, 0xE4, 0xEA, 0x19, 0xE0, 0xAE, 0x4E, 0x92, 0xE9, 0xAD, 0xA4, 0xE3,
+    0xFE, 0x93, 0x9E, 0x39, 0xFD, 0x93, 0xAE, 0x4F, 0xD4, 0xEA, 0x4F, 0xD4, 0xE9, 0x4A, 0xFA, 0x39,
+    0xE6, 0xF9, 0x30, 0x77, 0x79, 0xE9, 0x74, 0xAE, 0x75, 0xE7, 0x6D, 0x97, 0x77, 0x29, 0xFC, 0xA9,
+    0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A,
+    0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0,
+    0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE,
+    0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x77, 0x73, 0xF7, 0x3A, 0xE7, 0x39, 0xE7, 0x4D,
+    0xA7, 0x77, 0x39, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4,
+    0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9,
+    0x6A, 0xE9, 0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F,
+    0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x77, 0x70, 0x9F,
+    0xA7, 0x19, 0xFD, 0x70, 0x9E, 0x09, 0xE6, 0x9D, 0xA2, 0x9D, 0x97, 0x77, 0x9F, 0xCA, 0x96, 0x9F,
+    0xFC, 0xA4, 0x9F, 0xFE, 0x93, 0xFA, 0x2A, 0xF2, 0xFA, 0x4F, 0x19, 0xF5, 0xAE, 0x90, 0xAE, 0x95,
+    0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA, 0x69, 0xE9, 0x9E, 0x96, 0xAE, 0x9A, 0xE9, 0x6F, 0x0A, 0xE9,
+    0x59, 0xF0, 0x9E, 0x95, 0xAE, 0x90, 0x9F, 0x49, 0xF2, 0xFA, 0x2A, 0xF9, 0x29, 0xFF, 0xEA, 0x4A,
+    0xFF, 0xCA, 0x69, 0xFD, 0xA7, 0x76, 0x69, 0xDA, 0x2D, 0x7F, 0xCA, 0xE6, 0xAD, 0xAF, 0xC9, 0x6D,
+    0x2A, 0xCA, 0x97, 0x77, 0x09, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF,
+    0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E,
+    0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4,
+    0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x69,
+    0xAA, 0x1A, 0xCA, 0x70, 0xE9, 0x0E, 0x70, 0xE1, 0xE7, 0x19, 0x91, 0x99, 0x77, 0x71, 0x9F, 0xCA,
+    0x96, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x93, 0xFA, 0x2A, 0xF2, 0xFA, 0x4F, 0x19, 0xF5, 0xAE, 0x90,
+    0xAE, 0x95, 0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA, 0x69, 0xE9, 0x9E, 0x96, 0xAE, 0x9A, 0xE9, 0x6F,
+    0x0A, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0xAE, 0x90, 0x9F, 0x49, 0xF2, 0xFA, 0x2A, 0xF9, 0x29, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xFD, 0xA7, 0x76, 0x75, 0xCA, 0x4D, 0x1E, 0xA2, 0xEA, 0x1E, 0xA0,
+    0xF3, 0xFE, 0x5F, 0xC6, 0xFA, 0x5F, 0xDA, 0x3F, 0x9E, 0xA1, 0xF2, 0xEA, 0x0A, 0xD4, 0xD9, 0x19,
+    0x69, 0x00, 0x75, 0x99, 0x69, 0xFC, 0xA9, 0xD9, 0x39, 0xFF, 0xE3, 0x9F, 0xFE, 0xA3, 0xFA, 0x2A,
+    0xF2, 0xF9, 0x29, 0xFC, 0x90, 0x9E, 0xA3, 0xFD, 0x90, 0xAE, 0x3E, 0x9E, 0x90, 0xF2, 0xAD, 0x90,
+    0xE9, 0x0E, 0xA1, 0x9D, 0xA0, 0x9E, 0x99, 0xE9, 0x1D, 0xA1, 0x9E, 0x09, 0xE1, 0xE2, 0xAE, 0x09,
+    0xE0, 0xE3, 0xEA, 0x09, 0xFD, 0x92, 0xAE, 0x90, 0x9F, 0xCA, 0x29, 0xF2, 0xFC, 0x29, 0xF9, 0x2A,
+    0xFF, 0xEA, 0x3F, 0xFE, 0x93, 0xAD, 0xAF, 0xDA, 0x6A, 0xA7, 0x77, 0x60, 0x77, 0x7F, 0x74, 0x9E,
+    0x75, 0x9D, 0xA7, 0x5A, 0xD7, 0x77, 0x0A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E,
+    0x94, 0xF2, 0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94,
+    0xEA, 0x2A, 0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3,
+    0x9E, 0xA3, 0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x60, 0x77, 0x72,
+    0xAE, 0x97, 0x29, 0xE9, 0x73, 0xE9, 0x73, 0xAD, 0x77, 0x71, 0xAE, 0x49, 0xE9, 0x2F, 0x4A, 0xE3,
+    0xEA, 0x4F, 0x29, 0xE9, 0x4F, 0x2A, 0xE5, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA,
+    0x4F, 0x2A, 0xE9, 0x4E, 0xA2, 0xAE, 0x49, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA,
+    0x4F, 0x29, 0xEA, 0x39, 0xEA, 0x3F, 0x91, 0x9F, 0x4F, 0xFE, 0xA5, 0xFF, 0xCA, 0x7A, 0xFD, 0x97,
+    0x76, 0x77, 0x70, 0xFC, 0x72, 0xFD, 0xA7, 0x0E, 0x90, 0xE7, 0xAD, 0x3D, 0xA7, 0x75, 0xAE, 0x49,
+    0xE9, 0x2F, 0x4A, 0xE3, 0xEA, 0x4F, 0x29, 0xE9, 0x4F, 0x2A, 0xE5, 0xEA, 0x2F, 0x49, 0xE9, 0x2E,
+    0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x2A, 0xE9, 0x4E, 0xA2, 0xAE, 0x49, 0xEA, 0x2F, 0x49, 0xE9, 0x2E,
+    0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x29, 0xEA, 0x39, 0xEA, 0x3F, 0x91, 0x9F, 0x4F, 0xFE, 0xA5, 0xFF,
+    0xCA, 0x7A, 0xFD, 0x97, 0x76, 0x6A, 0xC9, 0x1A, 0xA7, 0x09, 0xE0, 0xEA, 0x79, 0xDA, 0x0E, 0x97,
+    0x09, 0x92, 0x99, 0x77, 0x6A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E, 0x94, 0xF2,
+    0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94, 0xEA, 0x2A,
+    0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3, 0x9E, 0xA3,
+    0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x60, 0x77, 0x59, 0xF7, 0x1F,
+    0x71, 0xAD, 0xA7, 0x19, 0xD9, 0x77, 0x4A, 0xE5, 0xF0, 0x9E, 0x93, 0xAE, 0x91, 0xEA, 0x29, 0xF2,
+    0xF2, 0xF3, 0xAE, 0x1A, 0xE9, 0x39, 0xE9, 0x0E, 0xA5, 0xE9, 0xF6, 0xFE, 0x96, 0xAF, 0xCA, 0x79,
+    0xFC, 0x71, 0xF9, 0x71, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x2E,
+    0xA7, 0x00, 0x3A, 0xE7, 0x2F, 0x72, 0xEA, 0x71, 0x9F, 0xEA, 0x59, 0xFF, 0xC4, 0xAF, 0xFC, 0xA3,
+    0xF1, 0x9F, 0x3E, 0xA2, 0xAE, 0x91, 0x9E, 0x92, 0xAE, 0x91, 0xAE, 0x3F, 0x2F, 0x29, 0xF2, 0xFA,
+    0xAF, 0xC9, 0x2F, 0xFD, 0x92, 0x9F, 0xFA, 0x4A, 0xEA, 0x99, 0x96, 0xF7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x10, 0x77, 0x75, 0x9F, 0xDA, 0x72, 0xFF, 0xD7, 0x0A, 0xFF, 0xDA, 0x7F, 0x29, 0xF6, 0x9E, 0x93,
+    0xF6, 0xAE, 0x39, 0xEA, 0x6F, 0x2A, 0xF7, 0xEA, 0x1F, 0xC7, 0x9E, 0x90, 0xF9, 0x70, 0xAE, 0x09,
+    0xEA, 0x71, 0xAE, 0x1F, 0x97, 0x0F, 0x1A, 0xF9, 0x7E, 0xA2, 0xFC, 0x95, 0x9E, 0x93, 0xAF, 0x5A,
+    0xE5, 0xF5, 0xF5, 0xAE, 0x5F, 0x0C, 0xAA, 0xAA, 0xEA, 0x5E, 0xA0, 0xFF, 0x59, 0xE9, 0x0F, 0xDA,
+    0x6A, 0xE7, 0x7F, 0x76, 0xAE, 0xA7, 0x4F, 0xD7, 0x5F, 0xCA, 0x75, 0xF9, 0x75, 0x77, 0x2F, 0x71,
+    0x9E, 0x72, 0x9D, 0xA7, 0x2A, 0xD7, 0x75, 0x9D, 0xA9, 0x09, 0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE,
+    0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E, 0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A,
+    0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF, 0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99,
+    0xDA, 0x77, 0x00, 0x77, 0x5A, 0xEA, 0x79, 0xE9, 0x70, 0xE9, 0x70, 0xAD, 0x77, 0x69, 0xDA, 0x90,
+    0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29,
+    0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A,
+    0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x77, 0x3F, 0xC7, 0xFD, 0xA5, 0xE9, 0x0E,
+    0x4A, 0xD3, 0xDA, 0x77, 0x29, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90,
+    0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E,
+    0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70,
+    0x4A, 0xD9, 0x19, 0xCA, 0x3A, 0xFC, 0xAD, 0x93, 0xDA, 0xFC, 0xA3, 0x9C, 0x91, 0x9A, 0xCA, 0x77,
+    0x39, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA,
+    0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1,
+    0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x4A, 0xC9, 0x09, 0xAA,
+    0x5A, 0xDA, 0x0E, 0x94, 0xAD, 0xA0, 0xE6, 0x99, 0x29, 0x97, 0x73, 0x9D, 0xA9, 0x09, 0xAA, 0x92,
+    0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E, 0x90, 0xAE,
+    0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF, 0xFD, 0x3F,
+    0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x59, 0xDA, 0x70, 0x9F, 0xC7, 0xAC, 0x90, 0xAC, 0x96,
+    0xAC, 0x90, 0xAC, 0x96, 0x9F, 0xC7, 0x09, 0xDA, 0x77, 0x59, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9,
+    0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29,
+    0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE,
+    0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x39, 0xE9, 0x09, 0xA9, 0x9A, 0xDA, 0x94, 0xFD, 0x9F, 0xFC, 0x92,
+    0xFF, 0xFF, 0xD1, 0x9F, 0x1F, 0xCA, 0x19, 0xE1, 0xF2, 0x9E, 0xA2, 0xAE, 0x09, 0xEA, 0x29, 0xE9,
+    0x19, 0xF0, 0xAE, 0x39, 0xFF, 0xD1, 0xF3, 0xAF, 0xFA, 0x2F, 0x3F, 0xAA, 0x99, 0x4F, 0x29, 0xEA,
+    0x70, 0xF2, 0xFC, 0x49, 0x2A, 0xFF, 0xFA, 0xAA, 0xD3, 0xFD, 0xAF, 0xFD, 0x39, 0xF9, 0x9D, 0x9F,
+    0xD9, 0x77, 0x70, 0x39, 0xAE, 0xA9, 0x3A, 0xFE, 0x2F, 0xFA, 0x1A, 0xF9, 0x1A, 0x91, 0xF6, 0x9E,
+    0xA6, 0xAE, 0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x29, 0x29, 0xFF, 0x92, 0xFF, 0x93, 0xAF, 0xCA, 0x5D,
+    0xA7, 0x9E, 0x97, 0x0E, 0x70, 0xE5, 0xAF, 0xA5, 0xAE, 0xA5, 0x77, 0x1F, 0x70, 0x9E, 0x71, 0xAD,
+    0xA7, 0x1A, 0xD7, 0x74, 0xAE, 0xA9, 0x4A, 0xFE, 0x92, 0xAF, 0xFC, 0x19, 0xEA, 0x19, 0xE9, 0x0F,
+    0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A, 0xFF, 0xD9, 0x0F, 0xFC, 0xA2, 0xFA, 0xA9, 0x94, 0xF7, 0x0A,
+    0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92, 0xFF, 0xC9, 0x3A, 0xFD, 0xA7, 0x70, 0x77, 0x4F, 0x96, 0xAE,
+    0x96, 0x9E, 0x70, 0xDA, 0x77, 0x5A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E,
+    0x90, 0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F,
+    0x70, 0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77, 0x77, 0x2F, 0xC6,
+    0xFD, 0x94, 0xE9, 0x0E, 0x3D, 0xA3, 0xDA, 0x77, 0x1A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1,
+    0x9E, 0xA1, 0x9E, 0x90, 0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F,
+    0xAA, 0x99, 0x4F, 0x70, 0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77,
+    0x4A, 0xA1, 0x9C, 0xA4, 0xEA, 0x0E, 0x4E, 0x90, 0xE5, 0x99, 0x19, 0x97, 0x73, 0xAE, 0xA9, 0x4A,
+    0xFE, 0x92, 0xAF, 0xFC, 0x19, 0xEA, 0x19, 0xE9, 0x0F, 0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A, 0xFF,
+    0xD9, 0x0F, 0xFC, 0xA2, 0xFA, 0xA9, 0x94, 0xF7, 0x0A, 0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92, 0xFF,
+    0xC9, 0x3A, 0xFD, 0xA7, 0x70, 0x71, 0xAE, 0x4E, 0xA4, 0xE5, 0xD9, 0x72, 0x9A, 0xAA, 0x3F, 0x3E,
+    0xA2, 0x9E, 0x92, 0xAE, 0x3F, 0x3F, 0x3E, 0xA2, 0x9E, 0x92, 0xAE, 0x3F, 0x3E, 0xA3, 0xE9, 0x29,
+    0xE9, 0x20, 0x77, 0x9F, 0x5F, 0x5A, 0xDA, 0x59, 0xD9, 0x77, 0x19, 0xAA, 0xA6, 0xF6, 0xEA, 0x59,
+    0xE9, 0x5A, 0xE6, 0xF6, 0xF6, 0xEA, 0x59, 0xE9, 0x5A, 0xE6, 0xF6, 0xEA, 0x6E, 0x95, 0x9E, 0x95,
+    0x75, 0xAF, 0x93, 0xAF, 0xD2, 0xAD, 0xA0, 0x9D, 0xA0, 0x9D, 0x92, 0xAD, 0x76, 0x9A, 0xAA, 0x6F,
+    0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA6, 0xE9,
+    0x59, 0xE9, 0x50, 0x1A, 0xCA, 0x1A, 0xC9, 0x1E, 0x0A, 0xDA, 0x1E, 0x0A, 0xDA, 0x19, 0x92, 0x99,
+    0x75, 0x9A, 0xAA, 0x5F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE, 0x5F, 0x5F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE,
+    0x5F, 0x5E, 0xA5, 0xE9, 0x49, 0xE9, 0x40, 0x77, 0x5C, 0xA2, 0xA9, 0x6A, 0xEA, 0xE6, 0x9F, 0xCA,
+    0x79, 0xFC, 0x7A, 0xFD, 0xA6, 0x9C, 0xA0, 0x9E, 0x73, 0xE9, 0x4A, 0xF9, 0xAD, 0x93, 0xFF, 0xDA,
+    0x2F, 0xCA, 0xFC, 0xA1, 0x9F, 0x2F, 0xA1, 0xF3, 0xAE, 0x91, 0xF3, 0xAE, 0x91, 0xEA, 0x3F, 0x2E,
+    0xA3, 0xEA, 0x2F, 0x2F, 0x92, 0xAF, 0xAF, 0xA4, 0xFF, 0xC6, 0xAF, 0xC9, 0x77, 0x30, 0x59, 0xDA,
+    0x2D, 0x49, 0xFC, 0xAD, 0xA4, 0xDA, 0xAF, 0xC5, 0xCA, 0x2A, 0xCA, 0x77, 0x39, 0xAA, 0x1A, 0xDA,
+    0x5E, 0x0F, 0xD4, 0xEA, 0xFD, 0xA2, 0x9F, 0xA0, 0x9F, 0x2A, 0xF2, 0xF2, 0xF3, 0xEA, 0x2F, 0x3E,
+    0x92, 0xEA, 0x29, 0xE9, 0x19, 0xE9, 0x2A, 0xE2, 0xAE, 0x3F, 0x2F, 0x3E, 0xA2, 0xEA, 0x3E, 0x92,
+    0xE9, 0x29, 0xE2, 0x9E, 0x3A, 0xE2, 0x77, 0x1E, 0xA7, 0x0A, 0xE7, 0x1A, 0xD9, 0x71, 0xAC, 0xA7,
+    0x73, 0x9A, 0xEA, 0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9, 0x9E, 0x93, 0xEA, 0xAE,
+    0x4E, 0x9F, 0x39, 0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90, 0x9F, 0xFD, 0x2A, 0xFF,
+    0x4A, 0xFC, 0xA7, 0x70, 0x77, 0x4F, 0x96, 0xAE, 0x96, 0x9E, 0x70, 0xDA, 0x77, 0x49, 0xAE, 0xA5,
+    0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4, 0xE9, 0xF3, 0x9E,
+    0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4, 0xAF, 0xCA, 0x77,
+    0x00, 0x77, 0x2F, 0xC6, 0xFD, 0x94, 0xE9, 0x0E, 0x3D, 0xA3, 0xD9, 0x77, 0x09, 0xAE, 0xA5, 0xFF,
+    0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4, 0xE9, 0xF3, 0x9E, 0x9F,
+    0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4, 0xAF, 0xCA, 0x77, 0x00,
+    0x4A, 0xD9, 0x1A, 0xC9, 0x3F, 0xFC, 0x39, 0xDA, 0xFC, 0x93, 0xAC, 0x29, 0xD9, 0x77, 0x39, 0xAE,
+    0xA6, 0xFF, 0x4F, 0xFD, 0x2A, 0xF1, 0xF2, 0xF2, 0x9E, 0x90, 0x9E, 0x93, 0xEA, 0x0A, 0xE4, 0xE9,
+    0x0F, 0x39, 0xE9, 0x0F, 0x3A, 0xE1, 0xF3, 0xF1, 0xAE, 0x2A, 0xE9, 0x19, 0xFF, 0xD3, 0xAF, 0xF5,
+    0xAF, 0xCA, 0x77, 0x20, 0x4A, 0xA1, 0x9C, 0xA4, 0xE9, 0x0E, 0x4E, 0x90, 0xE5, 0x99, 0x19, 0x97,
+    0x72, 0x9A, 0xEA, 0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9, 0x9E, 0x93, 0xEA, 0xAE,
+    0x4E, 0x9F, 0x39, 0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90, 0x9F, 0xFD, 0x2A, 0xFF,
+    0x4A, 0xFC, 0xA7, 0x70, 0x4A, 0xC9, 0x70, 0x9E, 0x70, 0x9E, 0x71, 0xAC, 0x97, 0x71, 0xAF, 0xFE,
+    0x9A, 0xFF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x69, 0x72, 0xE7, 0x09, 0xE7, 0x1E, 0x72,
+    0x95, 0x77, 0x29, 0xAE, 0xAA, 0xC4, 0xFF, 0xC9, 0x2F, 0xFD, 0x2A, 0xEA, 0x1F, 0x2E, 0xA1, 0xFC,
+    0x90, 0x9E, 0x90, 0xAF, 0xCA, 0x0A, 0xE0, 0x9D, 0x9E, 0x90, 0xF9, 0xD9, 0x9E, 0x90, 0xFD, 0xA0,
+    0xAE, 0x1F, 0xD1, 0xF1, 0xAF, 0x1A, 0xE9, 0x19, 0xFA, 0xFC, 0x29, 0xFF, 0xC3, 0xFF, 0xA4, 0xAC,
+    0x77, 0x70, 0x77, 0x2F, 0x72, 0xE9, 0x71, 0x9D, 0xA7, 0x29, 0xD7, 0x73, 0xAA, 0xAA, 0x3A, 0xAA,
+    0x91, 0xEA, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x19, 0xE3, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3, 0xEA, 0x1E,
+    0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x19, 0xE3, 0xF1, 0xAE, 0x29, 0xEA, 0x1A, 0xE2, 0xFA, 0x1A,
+    0xFF, 0xD9, 0x2F, 0xD9, 0xE3, 0x9F, 0x90, 0xE7, 0x70, 0x77, 0x5A, 0xEA, 0x70, 0xEA, 0x70, 0xE9,
+    0x70, 0xAD, 0x97, 0x73, 0xAA, 0xAA, 0x3A, 0xAA, 0x91, 0xEA, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x19,
+    0xE3, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3, 0xEA, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x19, 0xE3,
+    0xF1, 0xAE, 0x29, 0xEA, 0x1A, 0xE2, 0xFA, 0x1A, 0xFF, 0xD9, 0x2F, 0xD9, 0xE3, 0x9F, 0x90, 0xE7,
+    0x70, 0x77, 0x3F, 0xC7, 0xFD, 0xA5, 0xEA, 0x0A, 0xD9, 0x3A, 0xD9, 0x2A, 0xD7, 0x70, 0xAA, 0xAA,
+    0x3A, 0xAA, 0x91, 0xEA, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x19, 0xE3, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3,
+    0xEA, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x19, 0xE3, 0xF1, 0xAE, 0x29, 0xEA, 0x1A, 0xE2,
+    0xFA, 0x1A, 0xFF, 0xD9, 0x2F, 0xD9, 0xE3, 0x9F, 0x90, 0xE7, 0x70, 0x4A, 0xC9, 0x1A, 0xA5, 0x9E,
+    0x0E, 0x94, 0xAD, 0xA0, 0xE9, 0x59, 0x92, 0x99, 0x77, 0x1A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3,
+    0xE9, 0x09, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9,
+    0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0x3F, 0x1A, 0xE2, 0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92,
+    0xFD, 0x9E, 0x39, 0xF9, 0x0E, 0x77, 0x00, 0x77, 0x72, 0xF7, 0x3A, 0xE7, 0x39, 0xE7, 0x4D, 0xA7,
+    0x77, 0x19, 0xAA, 0xA4, 0xAA, 0xAA, 0x3A, 0xE3, 0x9E, 0xA3, 0x9E, 0x3F, 0x49, 0xE2, 0x9E, 0xA5,
+    0xE9, 0x1A, 0xE6, 0xE9, 0x1E, 0xA6, 0xEA, 0x0A, 0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0xAE, 0x70,
+    0x9D, 0xAE, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x97, 0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x3A, 0xE7,
+    0x3A, 0xEA, 0x70, 0xAF, 0xD7, 0x1A, 0xFC, 0x72, 0xAE, 0x97, 0x30, 0x4A, 0xE7, 0x2F, 0x72, 0xEA,
+    0x71, 0x9E, 0x97, 0x19, 0xE7, 0x2A, 0xE0, 0xAD, 0xA5, 0xEA, 0xFD, 0x4F, 0xFD, 0x92, 0x9F, 0xA0,
+    0xAE, 0xA2, 0xAE, 0xA2, 0xF2, 0xF3, 0xF2, 0xEA, 0x3E, 0xA2, 0xE9, 0x29, 0xEA, 0x19, 0xE3, 0xAE,
+    0x91, 0xAE, 0x3F, 0x2F, 0xA1, 0xAE, 0xA2, 0xFF, 0xE3, 0xEA, 0xFD, 0x92, 0x9E, 0x0A, 0xF4, 0xAE,
+    0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xAE, 0x72, 0x59, 0xAA, 0x19, 0xCA, 0x70,
+    0xE9, 0x0E, 0x70, 0xE1, 0xE7, 0x19, 0x91, 0x99, 0x77, 0x79, 0xAA, 0xA4, 0xAA, 0xAA, 0x3A, 0xE3,
+    0x9E, 0xA3, 0x9E, 0x3F, 0x49, 0xE2, 0x9E, 0xA5, 0xE9, 0x1A, 0xE6, 0xE9, 0x1E, 0xA6, 0xEA, 0x0A,
+    0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0xAE, 0x70, 0x9D, 0xAE, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x97,
+    0x2F, 0xC7, 0x3F, 0x97, 0x3E, 0xA7, 0x3A, 0xE7, 0x3A, 0xEA, 0x70, 0xAF, 0xD7, 0x1A, 0xFC, 0x72,
+    0xAE, 0x97, 0x30, 0x70, 0xAA, 0xAA, 0xAA, 0xA9, 0x70, 0xFE, 0x97, 0x0F, 0xE9, 0x77, 0x71, 0x9F,
+    0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79,
+    0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE,
+    0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E,
+    0xA6, 0x9E, 0x00, 0x4A, 0xAA, 0xAA, 0xAA, 0x5A, 0xFE, 0x5A, 0xFD, 0xA7, 0x73, 0x9D, 0xA9, 0x09,
+    0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E,
+    0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF,
+    0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x77, 0x71, 0xAD, 0x29, 0xD7, 0x09, 0xEA,
+    0xEA, 0x71, 0xFE, 0x73, 0xAD, 0xA9, 0x77, 0x75, 0x9F, 0x97, 0x3F, 0xCA, 0x72, 0x9F, 0xCA, 0x72,
+    0xEA, 0xDA, 0x71, 0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E, 0x1E, 0x70, 0xEA, 0x1E, 0x7A, 0xE2,
+    0xE7, 0xEA, 0x2E, 0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE, 0xA4, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC,
+    0x3A, 0xE5, 0xAE, 0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E, 0xA6, 0x9E, 0x10, 0x77, 0x1D, 0xA2,
+    0xAD, 0x4A, 0xEA, 0xE9, 0x5F, 0xDA, 0x7A, 0xDA, 0x97, 0x74, 0x9D, 0xA9, 0x09, 0xAA, 0x92, 0xFD,
+    0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E, 0x90, 0xAE, 0x92,
+    0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF, 0xFD, 0x3F, 0xDA,
+    0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x70, 0x9F, 0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA,
+    0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79, 0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA,
+    0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5,
+    0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E, 0xA6, 0x9E, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x74,
+    0xE7, 0x5E, 0x97, 0x4F, 0xA7, 0x39, 0xEA, 0x77, 0x20, 0x39, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9,
+    0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29,
+    0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE,
+    0x39, 0xF9, 0x9D, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x1E, 0x72, 0xE9, 0x97, 0x0F, 0xA7, 0x1E, 0xA7,
+    0x71, 0x77, 0x71, 0xAE, 0xA7, 0x19, 0xEA, 0x72, 0xE9, 0x72, 0xAD, 0x97, 0x77, 0x19, 0xFD, 0xA5,
+    0x9F, 0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x19, 0xAC, 0x3F, 0xA7, 0x19, 0xF7, 0x2A, 0xE9, 0x72,
+    0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0x9E, 0x97, 0x29, 0xF7, 0x3F,
+    0xA3, 0x9A, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x97, 0x73, 0x77, 0x2A, 0xEA, 0x59, 0xEA,
+    0x6E, 0x96, 0xAD, 0x97, 0x72, 0x9A, 0xEA, 0x93, 0xAF, 0xE2, 0xFF, 0xA1, 0xAF, 0x91, 0xA9, 0x1F,
+    0x69, 0xEA, 0x6A, 0xE7, 0xF7, 0xF7, 0xF7, 0xAE, 0x92, 0x92, 0x9F, 0xF9, 0x2F, 0xF9, 0x3A, 0xFC,
+    0xA7, 0x60, 0x77, 0x7F, 0xC7, 0x1F, 0xDA, 0x7E, 0x90, 0xE9, 0x5A, 0xD3, 0xDA, 0x77, 0x69, 0xFD,
+    0xA5, 0x9F, 0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x19, 0xAC, 0x3F, 0xA7, 0x19, 0xF7, 0x2A, 0xE9,
+    0x72, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x97, 0x2A, 0xE9, 0x72, 0x9E, 0x97, 0x29, 0xF7,
+    0x3F, 0xA3, 0x9A, 0x49, 0xFF, 0xD5, 0xAF, 0xFC, 0x69, 0xFE, 0x97, 0x73, 0x77, 0x0F, 0xC5, 0xFD,
+    0xA3, 0xEA, 0x0E, 0x91, 0xAD, 0x92, 0xAC, 0xA7, 0x79, 0xAE, 0xA9, 0x3A, 0xFE, 0x2F, 0xFA, 0x1A,
+    0xF9, 0x1A, 0x91, 0xF6, 0x9E, 0xA6, 0xAE, 0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x29, 0x29, 0xFF, 0x92,
+    0xFF, 0x93, 0xAF, 0xCA, 0x76, 0x77, 0x70, 0xE7, 0x39, 0xEA, 0x72, 0xAE, 0x97, 0x3A, 0xA9, 0x77,
+    0x71, 0x9F, 0xDA, 0x59, 0xFF, 0xD3, 0x9F, 0xFD, 0xA3, 0xFC, 0x91, 0x9A, 0xC3, 0xFA, 0x71, 0x9F,
+    0x72, 0xAE, 0x97, 0x2F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x29, 0xE9,
+    0x72, 0x9F, 0x73, 0xFA, 0x39, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xC6, 0x9F, 0xE9, 0x77, 0x30, 0x77,
+    0x1E, 0x79, 0xEA, 0x6A, 0xE9, 0x7A, 0xA9, 0x77, 0x29, 0xAE, 0xA9, 0x3A, 0xFE, 0x2F, 0xFA, 0x1A,
+    0xF9, 0x1A, 0x91, 0xF6, 0x9E, 0xA6, 0xAE, 0x7F, 0x7F, 0x7F, 0x7A, 0xE9, 0x29, 0x29, 0xFF, 0x92,
+    0xFF, 0x93, 0xAF, 0xCA, 0x76, 0x77, 0x5E, 0x2A, 0xD9, 0x6E, 0x0E, 0x97, 0xAF, 0xC9, 0x71, 0xF9,
+    0x77, 0x70, 0x9F, 0xDA, 0x59, 0xFF, 0xD3, 0x9F, 0xFD, 0xA3, 0xFC, 0x91, 0x9A, 0xC3, 0xFA, 0x71,
+    0x9F, 0x72, 0xAE, 0x97, 0x2F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xAE, 0x97, 0x29,
+    0xE9, 0x72, 0x9F, 0x73, 0xFA, 0x39, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xC6, 0x9F, 0xE9, 0x77, 0x30,
+    0x77, 0xE2, 0xAD, 0x93, 0xE0, 0xE9, 0x4A, 0xFC, 0x96, 0xF9, 0x77, 0x39, 0xAE, 0xA9, 0x4A, 0xFE,
+    0x3F, 0xFA, 0x2A, 0xF9, 0x1A, 0x92, 0xF7, 0x9E, 0xA7, 0xAE, 0x70, 0xF7, 0x0F, 0x70, 0xF7, 0x0A,
+    0xE9, 0x29, 0x39, 0xFF, 0x93, 0xFF, 0x94, 0xAF, 0xCA, 0x77, 0x00, 0x77, 0x7E, 0x2E, 0x96, 0x9D,
+    0xA9, 0xE7, 0x1F, 0xD9, 0x71, 0x9F, 0x97, 0x77, 0xAF, 0xDA, 0x70, 0xFF, 0xCA, 0x6F, 0xFE, 0x49,
+    0xEA, 0x99, 0xAF, 0x93, 0x9E, 0x92, 0x9F, 0x3A, 0xE4, 0xF3, 0xF4, 0xAE, 0x3E, 0xA4, 0xAE, 0x29,
+    0xE9, 0x4F, 0x2A, 0xE5, 0xF2, 0xF5, 0xF2, 0xF4, 0xAE, 0x92, 0xEA, 0x4F, 0x29, 0xE9, 0x3F, 0xA2,
+    0xAE, 0x90, 0x9A, 0xFC, 0x3F, 0xFF, 0x4F, 0xFD, 0xA5, 0xFE, 0xA9, 0x60, 0x72, 0xE9, 0x0E, 0xA7,
+    0x19, 0xE1, 0xE7, 0x2A, 0xE0, 0xAD, 0x97, 0x2F, 0x0D, 0x97, 0x3E, 0xA7, 0x19, 0xDA, 0x1E, 0x97,
+    0x0F, 0xD9, 0xE7, 0x0F, 0xFE, 0x79, 0xF1, 0xFC, 0x7F, 0x29, 0xEA, 0x69, 0xEA, 0x29, 0xE9, 0x6A,
+    0xE3, 0x9E, 0x7F, 0x3A, 0xE7, 0xF3, 0xEA, 0x7F, 0x29, 0xE9, 0x7F, 0x2F, 0x97, 0xAF, 0xFD, 0x71,
+    0xFD, 0xAE, 0x71, 0x9F, 0x90, 0xDA, 0x77, 0x74, 0x3A, 0xFD, 0xA7, 0x0F, 0xFC, 0xA6, 0xFF, 0xE4,
+    0x9E, 0xA9, 0x9A, 0xF9, 0x39, 0xE9, 0x29, 0xF3, 0xAE, 0x4F, 0x3F, 0x4A, 0xE1, 0x99, 0xF9, 0x92,
+    0xAE, 0x1F, 0xF9, 0x1F, 0x09, 0xFF, 0x2F, 0x09, 0xAF, 0xAA, 0xA2, 0xF2, 0xF4, 0xAE, 0x92, 0xEA,
+    0x4F, 0x29, 0xE9, 0x3F, 0xA2, 0xAE, 0x90, 0x9A, 0xFC, 0x3F, 0xFF, 0x4F, 0xFD, 0xA5, 0xFE, 0xA9,
+    0x60, 0x72, 0xE9, 0x72, 0x9E, 0x96, 0x9F, 0xFC, 0x59, 0xFF, 0xA5, 0x99, 0x99, 0xEA, 0x97, 0x2E,
+    0x94, 0x9F, 0x99, 0xE4, 0x9F, 0xFD, 0x4F, 0xFD, 0xA3, 0xFA, 0x1A, 0xEA, 0x3E, 0xA2, 0x9E, 0x92,
+    0xAE, 0x92, 0x9E, 0x3A, 0xE3, 0x9E, 0x3F, 0x3E, 0xA3, 0xF3, 0xE9, 0x3F, 0x2F, 0x93, 0xAF, 0xFD,
+    0x5F, 0xDA, 0xE5, 0x9F, 0x90, 0xDA, 0x77, 0x40, 0x59, 0xAA, 0xAA, 0xAA, 0xA6, 0xFE, 0xA6, 0xFE,
+    0x97, 0x73, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71,
+    0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7,
+    0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x30, 0x39, 0xAA,
+    0xAA, 0xAA, 0xA4, 0xAF, 0xE4, 0xFE, 0xA7, 0x72, 0xAE, 0xA9, 0x4A, 0xFE, 0x92, 0xAF, 0xFC, 0x19,
+    0xEA, 0x19, 0xE9, 0x0F, 0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A, 0xFF, 0xD9, 0x0F, 0xFC, 0xA2, 0xFA,
+    0xA9, 0x94, 0xF7, 0x0A, 0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92, 0xFF, 0xC9, 0x3A, 0xFD, 0xA7, 0x70,
+    0x77, 0x4D, 0x3D, 0x95, 0xEA, 0xAE, 0x6A, 0xFD, 0x97, 0x9A, 0xDA, 0x77, 0x5A, 0xFF, 0xC9, 0x3F,
+    0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xFF, 0xC9,
+    0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99, 0x4F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A,
+    0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD3, 0x77, 0x0D, 0x3D, 0xA3, 0xEA, 0xAE, 0x49, 0xFD,
+    0x95, 0x9A, 0xDA, 0x77, 0x4A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E, 0x90,
+    0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F, 0x70,
+    0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77, 0x77, 0x69, 0xDA, 0x72,
+    0xF7, 0x2F, 0x72, 0x9A, 0xA7, 0x76, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99,
+    0x99, 0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9,
+    0x99, 0x99, 0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F,
+    0xFD, 0x30, 0x77, 0x3E, 0x70, 0xAE, 0x97, 0xF7, 0x1A, 0xA7, 0x75, 0xAE, 0xA9, 0x4A, 0xFE, 0x92,
+    0xAF, 0xFC, 0x19, 0xEA, 0x19, 0xE9, 0x0F, 0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A, 0xFF, 0xD9, 0x0F,
+    0xFC, 0xA2, 0xFA, 0xA9, 0x94, 0xF7, 0x0A, 0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92, 0xFF, 0xC9, 0x3A,
+    0xFD, 0xA7, 0x70, 0x3A, 0xFF, 0xC9, 0x3F, 0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E,
+    0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99,
+    0x4F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD7, 0x19,
+    0xD9, 0x71, 0x9D, 0x97, 0x2D, 0xA7, 0x3E, 0x97, 0x2F, 0xA7, 0x19, 0xE9, 0x77, 0x30, 0x4A, 0xEA,
+    0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E, 0x90, 0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0,
+    0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F, 0x70, 0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9,
+    0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x79, 0xD9, 0x79, 0xD9, 0x70, 0xE7, 0x1E, 0x97, 0x0F, 0xA7, 0x0E,
+    0xA3, 0x77, 0x49, 0xDA, 0x2E, 0x6A, 0xDA, 0x9E, 0x70, 0xFD, 0x71, 0x9F, 0x77, 0x7A, 0xFF, 0xC9,
+    0x4F, 0xFD, 0x5F, 0xFD, 0x49, 0xEA, 0x99, 0x99, 0x95, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xFF,
+    0xC9, 0x49, 0xFF, 0xC5, 0xAF, 0xFC, 0x5F, 0x99, 0x99, 0x99, 0x5F, 0x73, 0xEA, 0x72, 0x9E, 0x97,
+    0x2A, 0xE9, 0x72, 0xFF, 0xD5, 0xFF, 0xD5, 0xFF, 0xD4, 0x77, 0x1E, 0x2E, 0x93, 0x9D, 0xA9, 0xE6,
+    0xFD, 0x79, 0xF9, 0x77, 0x5A, 0xEA, 0x95, 0xAF, 0xE9, 0x3A, 0xFF, 0xC2, 0x9E, 0xA1, 0x9E, 0x91,
+    0xF2, 0x9E, 0x19, 0xE9, 0x19, 0xF1, 0xAF, 0xFD, 0x91, 0xFF, 0xCA, 0x3F, 0xAA, 0x99, 0x5F, 0x71,
+    0xAE, 0x49, 0x39, 0xFA, 0xAA, 0xD9, 0x3F, 0xFC, 0x94, 0xAF, 0xDA, 0x77, 0x10, 0x77, 0x79, 0xFA,
+    0x70, 0x9F, 0xD9, 0x69, 0xE1, 0xE6, 0xDA, 0x29, 0xD9, 0x77, 0x59, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F,
+    0xFE, 0x92, 0xFC, 0x92, 0x9A, 0xC2, 0xAF, 0x71, 0x9F, 0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9E, 0xA2,
+    0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0xAE, 0x92, 0xFD, 0xA0, 0xAE, 0x94, 0x9E, 0x90, 0x9E, 0x94, 0xAE,
+    0x19, 0xF4, 0xF2, 0xFA, 0x3E, 0xA2, 0x9F, 0xFE, 0x93, 0xAF, 0xFD, 0x94, 0x9F, 0xEA, 0x97, 0x72,
+    0x77, 0x5F, 0xC7, 0x0F, 0xDA, 0x6E, 0x90, 0xE5, 0xDA, 0x3D, 0xA7, 0x74, 0xAD, 0xA1, 0x9A, 0xA9,
+    0x3F, 0xD9, 0xE3, 0xFF, 0xE2, 0x9F, 0x90, 0xFC, 0x2F, 0x29, 0xEA, 0x19, 0xEA, 0x29, 0xE9, 0x1A,
+    0xE9, 0x29, 0xE2, 0xF3, 0xAE, 0x2F, 0x3E, 0xA2, 0xF2, 0x9E, 0xA2, 0xF1, 0x9F, 0x92, 0xAF, 0xFD,
+    0x4F, 0xFD, 0x49, 0xF0, 0xEA, 0x72, 0xE9, 0x71, 0xAE, 0x39, 0x93, 0x9F, 0x3A, 0xFF, 0xC4, 0xAF,
+    0xF9, 0x5A, 0xFC, 0xA6, 0x77, 0x6D, 0x3D, 0xA6, 0xEA, 0xAE, 0x79, 0xFD, 0x97, 0x09, 0xAD, 0xA7,
+    0x77, 0x09, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE, 0x92, 0xFC, 0x92, 0x9A, 0xC2, 0xAF, 0x71, 0x9F,
+    0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9E, 0xA2, 0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0xAE, 0x92, 0xFD, 0xA0,
+    0xAE, 0x94, 0x9E, 0x90, 0x9E, 0x94, 0xAE, 0x19, 0xF4, 0xF2, 0xFA, 0x3E, 0xA2, 0x9F, 0xFE, 0x93,
+    0xAF, 0xFD, 0x94, 0x9F, 0xEA, 0x97, 0x72, 0x77, 0x3D, 0x92, 0xAD, 0x5A, 0xEA, 0xE9, 0x59, 0xFD,
+    0xA7, 0x0A, 0xDA, 0x97, 0x76, 0xAD, 0xA1, 0x9A, 0xA9, 0x3F, 0xD9, 0xE3, 0xFF, 0xE2, 0x9F, 0x90,
+    0xFC, 0x2F, 0x29, 0xEA, 0x19, 0xEA, 0x29, 0xE9, 0x1A, 0xE9, 0x29, 0xE2, 0xF3, 0xAE, 0x2F, 0x3E,
+    0xA2, 0xF2, 0x9E, 0xA2, 0xF1, 0x9F, 0x92, 0xAF, 0xFD, 0x4F, 0xFD, 0x49, 0xF0, 0xEA, 0x72, 0xE9,
+    0x71, 0xAE, 0x39, 0x93, 0x9F, 0x3A, 0xFF, 0xC4, 0xAF, 0xF9, 0x5A, 0xFC, 0xA6, 0x77, 0x70, 0x9D,
+    0xA7, 0x3F, 0x73, 0xF7, 0x4A, 0xA7, 0x77, 0x19, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE, 0x92, 0xFC,
+    0x92, 0x9A, 0xC2, 0xAF, 0x71, 0x9F, 0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9E, 0xA2, 0xFE, 0x09, 0xE9,
+    0x2F, 0xE0, 0xAE, 0x92, 0xFD, 0xA0, 0xAE, 0x94, 0x9E, 0x90, 0x9E, 0x94, 0xAE, 0x19, 0xF4, 0xF2,
+    0xFA, 0x3E, 0xA2, 0x9F, 0xFE, 0x93, 0xAF, 0xFD, 0x94, 0x9F, 0xEA, 0x97, 0x72, 0x77, 0x6E, 0x72,
+    0xAE, 0x97, 0x1A, 0xE7, 0x3A, 0xA9, 0x77, 0x7A, 0xDA, 0x19, 0xAA, 0x93, 0xFD, 0x9E, 0x3F, 0xFE,
+    0x29, 0xF9, 0x0F, 0xC2, 0xF2, 0x9E, 0xA1, 0x9E, 0xA2, 0x9E, 0x91, 0xAE, 0x92, 0x9E, 0x2F, 0x3A,
+    0xE2, 0xF3, 0xEA, 0x2F, 0x29, 0xEA, 0x2F, 0x19, 0xF9, 0x2A, 0xFF, 0xD4, 0xFF, 0xD4, 0x9F, 0x0E,
+    0xA7, 0x2E, 0x97, 0x1A, 0xE3, 0x99, 0x39, 0xF3, 0xAF, 0xFC, 0x4A, 0xFF, 0x95, 0xAF, 0xCA, 0x60,
+    0x77, 0x59, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE, 0x92, 0xFC, 0x92, 0x9A, 0xC2, 0xAF, 0x71, 0x9F,
+    0x72, 0xAE, 0x97, 0x2F, 0x72, 0x9E, 0xA2, 0xFE, 0x09, 0xE9, 0x2F, 0xE0, 0xAE, 0x92, 0xFD, 0xA0,
+    0xAE, 0x94, 0x9E, 0x90, 0x9E, 0x94, 0xAE, 0x19, 0xF4, 0xF2, 0xFA, 0x3E, 0xA2, 0x9F, 0xFE, 0x93,
+    0xAF, 0xFD, 0x94, 0x9F, 0xEA, 0x97, 0x77, 0x99, 0x99, 0x73, 0xEA, 0x73, 0xE7, 0x3A, 0xD7, 0x4A,
+    0xA9, 0x70, 0x77, 0x7D, 0xA7, 0x2E, 0x72, 0x9E, 0x72, 0xE9, 0x77, 0x7A, 0xDA, 0x19, 0xAA, 0x93,
+    0xFD, 0x9E, 0x3F, 0xFE, 0x29, 0xF9, 0x0F, 0xC2, 0xF2, 0x9E, 0xA1, 0x9E, 0xA2, 0x9E, 0x91, 0xAE,
+    0x92, 0x9E, 0x2F, 0x3A, 0xE2, 0xF3, 0xEA, 0x2F, 0x29, 0xEA, 0x2F, 0x19, 0xF9, 0x2A, 0xFF, 0xD4,
+    0xFF, 0xD4, 0x9F, 0x0E, 0xA7, 0x2E, 0x97, 0x1A, 0xE3, 0x99, 0x39, 0xF3, 0xAF, 0xFC, 0x4A, 0xFF,
+    0x95, 0xAF, 0xCA, 0x60, 0x77, 0x72, 0xFC, 0x73, 0xFD, 0xA7, 0x1E, 0xA0, 0xAD, 0x97, 0xAD, 0x92,
+    0xAD, 0x77, 0x7A, 0xE5, 0xE9, 0x3F, 0x49, 0xE9, 0x3E, 0xA4, 0xAE, 0x39, 0xEA, 0x4F, 0x39, 0xE9,
+    0x4E, 0xA3, 0xAE, 0x49, 0xE9, 0x3F, 0x49, 0xE9, 0x3F, 0xFF, 0xC3, 0x9F, 0xFF, 0xC3, 0xAF, 0xFF,
+    0xA3, 0xF9, 0x99, 0x99, 0xAE, 0x93, 0xF4, 0xAE, 0x4E, 0xA4, 0xF3, 0x9E, 0x94, 0xF3, 0xAE, 0x5E,
+    0xA3, 0xF4, 0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xEA, 0x4F, 0x30, 0x77, 0x19, 0xFA, 0x69, 0xFD, 0x59,
+    0xE0, 0x9D, 0xA3, 0x9D, 0xA2, 0x9D, 0x77, 0x4A, 0xE7, 0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x09,
+    0xE7, 0x1A, 0xE0, 0x9D, 0xA4, 0xEA, 0xFD, 0x3F, 0xFD, 0xA1, 0x9F, 0xA0, 0x9F, 0x1A, 0xF2, 0xF1,
+    0xF3, 0xEA, 0x1F, 0x3E, 0x91, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E,
+    0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0x3A, 0xE5, 0xE9, 0x5F, 0x49, 0xE9,
+    0x3A, 0xAF, 0xAA, 0xAA, 0xAF, 0xAA, 0x19, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFC, 0x3A, 0xE4, 0x9E,
+    0xA5, 0xF4, 0x9E, 0x95, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0x99, 0x99, 0x9A,
+    0xE9, 0x5F, 0x4A, 0xE6, 0xEA, 0x4F, 0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xEA, 0x5F, 0x49, 0xE9, 0x5E,
+    0xA4, 0xAE, 0x6E, 0xA4, 0xF5, 0x3A, 0xE7, 0x1F, 0x7F, 0xFC, 0x93, 0xFF, 0xC4, 0x9A, 0xE9, 0x99,
+    0x95, 0xAE, 0x71, 0xEA, 0x0F, 0x93, 0xEA, 0xFD, 0x29, 0xFF, 0xDA, 0x1A, 0xF9, 0x1E, 0xA1, 0xAE,
+    0x92, 0xEA, 0x1F, 0x3E, 0x91, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E,
+    0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0x4A, 0xD9, 0x19, 0xCA, 0x3A, 0xFC,
+    0xAD, 0x93, 0xDA, 0xFD, 0x39, 0xC9, 0x19, 0xAC, 0xA7, 0x73, 0xFE, 0xA5, 0xFE, 0xA5, 0xFD, 0xA7,
+    0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x09,
+    0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x9F, 0xCA, 0x59, 0xFE, 0x94, 0xAF, 0xE9, 0x40, 0x19,
+    0xDA, 0x2D, 0x19, 0xFC, 0xAD, 0xA1, 0xDA, 0xAF, 0xC2, 0xCA, 0x2A, 0xCA, 0x77, 0x19, 0xAA, 0xA7,
+    0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x7E,
+    0x96, 0x9E, 0x96, 0x4A, 0xAA, 0xAA, 0xAA, 0x93, 0x9F, 0xE9, 0x39, 0xFE, 0x77, 0x1F, 0xEA, 0x4F,
+    0xEA, 0x4F, 0xDA, 0x6A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70,
+    0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0A, 0xE7, 0x0F, 0x69, 0xFC, 0xA4, 0x9F, 0xE9, 0x3A, 0xFE, 0x93,
+    0x1A, 0xAA, 0xAA, 0xAA, 0x91, 0xFE, 0x90, 0x9F, 0xE7, 0x59, 0xAA, 0xA5, 0xF5, 0xEA, 0x49, 0xE9,
+    0x4A, 0xE5, 0xF5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x5E, 0x94, 0x9E, 0x94, 0x77,
+    0x1A, 0xCA, 0x2A, 0xD4, 0xAE, 0xAE, 0xA5, 0xFE, 0x7A, 0xDA, 0x97, 0x74, 0xFE, 0xA5, 0xFE, 0xA5,
+    0xFD, 0xA7, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E,
+    0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x9F, 0xCA, 0x59, 0xFE, 0x94, 0xAF, 0xE9,
+    0x40, 0x73, 0x9D, 0x3D, 0x19, 0xEA, 0xAE, 0x2F, 0xE4, 0x9E, 0xA7, 0x70, 0x9A, 0xAA, 0x6F, 0x6E,
+    0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6F, 0x6E, 0xA5, 0x9E, 0x95, 0xAE, 0x6F, 0x6E, 0xA6, 0xE9, 0x59,
+    0xE9, 0x50, 0x3F, 0xEA, 0x3F, 0xEA, 0x3F, 0xDA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0x96, 0x9E, 0x96,
+    0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0xF5, 0x9F, 0xCA, 0x39, 0xFE, 0x92, 0xAF,
+    0xE9, 0x59, 0xD9, 0x69, 0xD7, 0x0D, 0xA7, 0x9D, 0xA9, 0x7F, 0x96, 0x9E, 0x97, 0x70, 0x76, 0x9D,
+    0xA5, 0xF5, 0xF5, 0x9A, 0xA7, 0x79, 0xAA, 0xA5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xF5,
+    0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x5E, 0x94, 0x9E, 0x95, 0xDA, 0x5D, 0xA5, 0xAD, 0x6E,
+    0x99, 0x4A, 0xF5, 0xEA, 0x76, 0x77, 0x2A, 0xD9, 0x69, 0xEA, 0x69, 0xE9, 0x79, 0xA9, 0x77, 0x1F,
+    0xEA, 0x3F, 0xEA, 0x3F, 0xDA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0x96, 0x9E, 0x96, 0xAE, 0x7F, 0x7E,
+    0xA6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0xF5, 0x9F, 0xCA, 0x39, 0xFE, 0x92, 0xAF, 0xE9, 0x20, 0x29,
+    0xAA, 0xA3, 0xF3, 0xEA, 0x29, 0xE9, 0x2A, 0xE3, 0xF3, 0xF3, 0xEA, 0x29, 0xE9, 0x2A, 0xE3, 0xF3,
+    0xEA, 0x3E, 0x92, 0x9E, 0x92, 0x3F, 0xEA, 0x2A, 0xE4, 0xFE, 0xA2, 0xF4, 0xFD, 0xA3, 0xEA, 0x5A,
+    0xE4, 0x9E, 0x95, 0xF4, 0xAE, 0x6E, 0xA4, 0xF6, 0xE9, 0x4E, 0xA5, 0x9E, 0x93, 0x9E, 0xA5, 0xAE,
+    0x49, 0xE9, 0x5F, 0x4A, 0xE6, 0xEA, 0x4F, 0x59, 0xE9, 0x4E, 0xA5, 0xAE, 0x49, 0xE9, 0x5A, 0xE4,
+    0xAE, 0x6F, 0x4F, 0x49, 0xFC, 0xA3, 0xF3, 0x9F, 0xE9, 0x2E, 0xA3, 0xAF, 0xE9, 0x19, 0xE9, 0x76,
+    0xF7, 0x6A, 0xF7, 0x29, 0xFE, 0x97, 0x29, 0xFD, 0xA7, 0x39, 0xFC, 0x97, 0x69, 0x97, 0x10, 0x77,
+    0x39, 0xDA, 0x3A, 0xD4, 0xF2, 0x9E, 0xA3, 0xF2, 0xAE, 0x93, 0x9A, 0xA4, 0xAA, 0x97, 0x73, 0x9A,
+    0xAA, 0x3A, 0xAA, 0x93, 0xF2, 0x9E, 0x93, 0xEA, 0x2A, 0xE3, 0x9E, 0x92, 0xF3, 0xAE, 0x3E, 0xA3,
+    0xF3, 0xEA, 0x3F, 0x29, 0xE9, 0x3E, 0xA2, 0xAE, 0x39, 0xE9, 0x2F, 0x3A, 0xE3, 0xEA, 0x3F, 0x29,
+    0xE9, 0x3E, 0xA2, 0xAE, 0x4E, 0x92, 0xAE, 0x39, 0xE9, 0x2F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2F,
+    0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xC7, 0x1A, 0xEA, 0x60, 0x77, 0x79, 0xFC, 0x70, 0x9F, 0xD9, 0x69,
+    0xE1, 0xE6, 0xDA, 0x29, 0xD9, 0x77, 0x79, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3F, 0x73, 0xEA, 0x72,
+    0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0xA7, 0x2A, 0xE9, 0x72, 0xAE, 0x73, 0xF7,
+    0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3F, 0x72, 0x9E, 0xA7, 0x19, 0xF7, 0xFE, 0xA7,
+    0xFE, 0x70, 0xFC, 0xA7, 0x39, 0x74, 0x77, 0x5A, 0xF9, 0x7A, 0xFD, 0x6A, 0xDA, 0x09, 0xDA, 0x49,
+    0xD9, 0x2A, 0xD7, 0x76, 0x9A, 0xAA, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0xAE,
+    0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97,
+    0x1A, 0xE7, 0x2F, 0x71, 0xAE, 0xA7, 0xFD, 0x70, 0xFC, 0xA7, 0x0F, 0x97, 0x00, 0x3A, 0xE4, 0xF4,
+    0xF3, 0xF9, 0x4E, 0xA2, 0xAE, 0xA4, 0x9E, 0x91, 0xAF, 0x59, 0xE1, 0x9F, 0x6A, 0xE1, 0xF7, 0xF0,
+    0xF9, 0x7E, 0xAF, 0x97, 0x9F, 0xEA, 0x70, 0xAF, 0xEA, 0x70, 0xFF, 0xC7, 0x0F, 0x0A, 0xE9, 0x7E,
+    0xA1, 0xF6, 0x9E, 0x91, 0xF6, 0xAE, 0x29, 0xEA, 0x5F, 0x3F, 0x5E, 0xA3, 0xAE, 0x94, 0xE9, 0x39,
+    0xEA, 0x77, 0x72, 0x99, 0x99, 0x75, 0xE7, 0x5A, 0xDA, 0x75, 0xDA, 0x76, 0xAA, 0x73, 0x3A, 0xE7,
+    0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x29, 0xE7, 0x3A, 0xE3, 0xAA, 0xAA, 0x3F, 0x2F, 0x93, 0xEA,
+    0x1F, 0x93, 0x9E, 0x90, 0xAE, 0x94, 0xAE, 0x0A, 0xE9, 0x5F, 0xAE, 0x96, 0xFE, 0xA7, 0xFF, 0x69,
+    0xFF, 0x95, 0xAE, 0x99, 0xEA, 0x5F, 0x1F, 0x5E, 0xA1, 0x9E, 0xA4, 0xE9, 0x2F, 0x39, 0xE3, 0x9E,
+    0xA7, 0x76, 0x99, 0x99, 0x73, 0xEA, 0x72, 0x9E, 0x73, 0xAD, 0x74, 0xAA, 0x72, 0x29, 0xAA, 0xA3,
+    0xAA, 0xAA, 0x3F, 0x2F, 0x93, 0xEA, 0x1F, 0x93, 0x9E, 0x90, 0xAE, 0x94, 0xAE, 0x0A, 0xE9, 0x5F,
+    0xAE, 0x96, 0xFE, 0xA7, 0xFF, 0x69, 0xFF, 0x95, 0xAE, 0x99, 0xEA, 0x5F, 0x1F, 0x5E, 0xA1, 0x9E,
+    0xA4, 0xE9, 0x2F, 0x39, 0xE3, 0x9E, 0xA2, 0x77, 0x39, 0xEA, 0x7E, 0xA7, 0xEA, 0x79, 0xD9, 0x77,
+    0x4A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9,
+    0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF,
+    0xCA, 0x10, 0x77, 0x2F, 0x6F, 0x6A, 0xE7, 0xDA, 0x77, 0x3A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x69,
+    0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7,
+    0xF7, 0xEA, 0x69, 0xE9, 0x69, 0xE9, 0x60, 0x3A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x69, 0xE7, 0xAE,
+    0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0xFD, 0x1F,
+    0xFD, 0x1F, 0xFC, 0xA7, 0x70, 0x99, 0x97, 0x9E, 0x7E, 0x97, 0xDA, 0x79, 0xA9, 0x60, 0x4A, 0xE5,
+    0xF5, 0xEA, 0x49, 0xE9, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xF5,
+    0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x49, 0xE9, 0x49, 0xE9, 0x76, 0x99, 0x99, 0x5E, 0xA5,
+    0xE5, 0xAD, 0x6A, 0xA9, 0x60, 0x3A, 0xE2, 0xE4, 0xF1, 0xAD, 0xA4, 0xEA, 0x1E, 0x49, 0xE9, 0x09,
+    0xD5, 0x9E, 0x72, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0x72,
+    0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFC, 0xA3, 0x3A, 0xE0, 0x9E,
+    0x4F, 0x0A, 0xDA, 0x4E, 0xA0, 0xE4, 0x9E, 0x9A, 0xD5, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xEA,
+    0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7,
+    0x1E, 0xA7, 0x09, 0xE9, 0x70, 0x9E, 0x97, 0x00, 0x3A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x79,
+    0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xEA, 0x1A, 0xD9, 0x19, 0xE9, 0x09, 0xEA, 0x1A, 0xE1, 0x9E, 0x91,
+    0xF2, 0xAA, 0x92, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xCA,
+    0x10, 0x3A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x0A,
+    0xD9, 0x1A, 0xE0, 0x9E, 0xA1, 0xF0, 0x9E, 0xA1, 0xF1, 0x9A, 0x92, 0xEA, 0x69, 0xE9, 0x6A, 0xE7,
+    0xF7, 0xEA, 0x69, 0xE9, 0x69, 0xE9, 0x60, 0x4A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x79, 0xE7,
+    0x0A, 0xE0, 0x96, 0xFD, 0x6F, 0xDA, 0x49, 0xFC, 0xA3, 0x9F, 0xCA, 0x5F, 0xD6, 0x9F, 0xA7, 0x9E,
+    0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xFF, 0xD2, 0xFF, 0xD2, 0xFF, 0xCA, 0x00, 0x39, 0xE9, 0x3A, 0xE4,
+    0xAE, 0x4E, 0xA4, 0xE9, 0x39, 0xE9, 0x3A, 0xE4, 0xFA, 0x3F, 0xC9, 0x19, 0xFC, 0xA0, 0xAF, 0xC9,
+    0x0F, 0xD2, 0x9F, 0xC3, 0xAE, 0xA3, 0x9E, 0x93, 0x9E, 0x4A, 0xE4, 0xEA, 0x4E, 0xA3, 0x77, 0x77,
+    0xAE, 0xA7, 0x6E, 0xA7, 0x6E, 0x97, 0x6A, 0xD9, 0x77, 0x75, 0xAE, 0xA5, 0x9E, 0x4F, 0xC5, 0xAE,
+    0x4F, 0xC9, 0x4E, 0xA3, 0x9F, 0xD4, 0xE9, 0x3A, 0xFD, 0x39, 0xE4, 0xAD, 0xAE, 0x92, 0xAE, 0x4E,
+    0x9A, 0xE2, 0xAD, 0xA4, 0xE0, 0x9E, 0x2E, 0xA3, 0x9E, 0x1E, 0x91, 0xE9, 0x3A, 0xE1, 0xF0, 0x9E,
+    0x4E, 0xA1, 0x9E, 0x0A, 0xE4, 0xE9, 0x2E, 0x9A, 0xDA, 0x4E, 0x3F, 0xE9, 0x39, 0xE3, 0x9F, 0xD9,
+    0x3A, 0xE4, 0xFD, 0x4E, 0xA4, 0xFD, 0x4E, 0x94, 0xAF, 0xA3, 0x9E, 0x6F, 0x93, 0x77, 0x79, 0xF7,
+    0x1E, 0xA7, 0x1A, 0xDA, 0x71, 0x9D, 0x97, 0x75, 0x9A, 0xA1, 0xAD, 0xA5, 0xE0, 0xFD, 0x4E, 0xAF,
+    0xDA, 0x29, 0xFA, 0x09, 0xF2, 0xAF, 0x2F, 0x2F, 0x3E, 0xA2, 0xF3, 0xE9, 0x2E, 0xA2, 0x9E, 0x91,
+    0x9E, 0x92, 0xAE, 0x2A, 0xE3, 0xF2, 0xF3, 0xEA, 0x2E, 0xA3, 0xE9, 0x2E, 0x92, 0x9E, 0x29, 0xE3,
+    0xAE, 0x20, 0x3A, 0xEA, 0x59, 0xE4, 0xFC, 0x5A, 0xE4, 0xFC, 0x94, 0xEA, 0x39, 0xFD, 0x4E, 0x93,
+    0xAF, 0xD3, 0x9E, 0x4A, 0xDA, 0xE9, 0x2A, 0xE4, 0xE9, 0xAE, 0x2A, 0xDA, 0x4E, 0x09, 0xE2, 0xEA,
+    0x39, 0xE1, 0xE9, 0x1E, 0x93, 0xAE, 0x1F, 0x09, 0xE4, 0xEA, 0x19, 0xE0, 0xAE, 0x4E, 0x92, 0xE9,
+    0xAD, 0xA4, 0xE3, 0xFE, 0x93, 0x9E, 0x39, 0xFD, 0x93, 0xAE, 0x4F, 0xD4, 0xEA, 0x4F, 0xD4, 0xE9,
+    0x4A, 0xFA, 0x39, 0xE6, 0xF9, 0x77, 0x75, 0x99, 0x99, 0x77, 0xE7, 0x7A, 0xDA, 0x77, 0xE7, 0x70,
+    0xAA, 0x74, 0x29, 0xAA, 0x1A, 0xDA, 0x4E, 0x0F, 0xD3, 0xEA, 0xFD, 0xA1, 0x9F, 0xA0, 0x9F, 0x1A,
+    0xF2, 0xF1, 0xF3, 0xEA, 0x1F, 0x3E, 0x91, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F,
+    0x1F, 0x3E, 0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE7, 0x73, 0x99, 0x99, 0x71,
+    0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x72, 0xAA, 0x70, 0x77, 0x73, 0xE2, 0xAD, 0xA7, 0x2E, 0x0E, 0x97,
+    0x3A, 0xFC, 0x97, 0x5F, 0xA7, 0x77, 0x4A, 0xEA, 0x59, 0xE4, 0xFC, 0x5A, 0xE4, 0xFC, 0x94, 0xEA,
+    0x39, 0xFD, 0x4E, 0x93, 0xAF, 0xD3, 0x9E, 0x4A, 0xDA, 0xE9, 0x2A, 0xE4, 0xE9, 0xAE, 0x2A, 0xDA,
+    0x4E, 0x09, 0xE2, 0xEA, 0x39, 0xE1, 0xE9, 0x1E, 0x93, 0xAE, 0x1F, 0x09, 0xE4, 0xEA, 0x19, 0xE0,
+    0xAE, 0x4E, 0x92, 0xE9, 0xAD, 0xA4, 0xE3, 0xFE, 0x93, 0x9E, 0x39, 0xFD, 0x93, 0xAE, 0x4F, 0xD4,
+    0xEA, 0x4F, 0xD4, 0xE9, 0x4A, 0xFA, 0x39, 0xE6, 0xF9, 0x30, 0x77, 0x4A, 0xD9, 0x19, 0xDA, 0x6E,
+    0x9A, 0xDA, 0x79, 0xFC, 0xA7, 0x1A, 0xEA, 0x77, 0x69, 0xAA, 0x1A, 0xDA, 0x6E, 0x0F, 0xD5, 0xEA,
+    0xFD, 0xA3, 0x9F, 0xA0, 0x9F, 0x3A, 0xF2, 0xF3, 0xF3, 0xEA, 0x3F, 0x3E, 0x93, 0xEA, 0x29, 0xE9,
+    0x29, 0xE9, 0x2A, 0xE3, 0xAE, 0x3F, 0x3F, 0x3E, 0xA3, 0xEA, 0x3E, 0x93, 0xE9, 0x29, 0xE3, 0x9E,
+    0x3A, 0xE3, 0x2E, 0x97, 0x39, 0xE7, 0x4E, 0xA7, 0x39, 0xE7, 0x4A, 0xD9, 0x0A, 0xA9, 0x1A, 0xDA,
+    0x2E, 0x09, 0xDA, 0x9F, 0xCA, 0x19, 0x91, 0xAD, 0xAF, 0xE5, 0xFC, 0x90, 0xAE, 0x94, 0xF9, 0x19,
+    0xE9, 0x4F, 0x29, 0xE4, 0x9E, 0x92, 0xAE, 0x4A, 0xE3, 0xF4, 0xF3, 0xEA, 0x4E, 0xA2, 0x9E, 0x93,
+    0x9E, 0x92, 0x9E, 0x49, 0xE3, 0xAE, 0x4A, 0xE3, 0xF4, 0xF3, 0xEA, 0x10, 0x3A, 0xEA, 0x59, 0xE3,
+    0xFC, 0x5A, 0xDA, 0x3F, 0xC9, 0x4E, 0xA2, 0x9F, 0xCA, 0x4E, 0x92, 0x9F, 0xD3, 0x9E, 0x3A, 0xD9,
+    0xEA, 0x2A, 0xE3, 0xE9, 0xAE, 0x2E, 0xA3, 0xE1, 0xE9, 0x1E, 0x92, 0x9E, 0x1E, 0xA1, 0xE3, 0xAE,
+    0x19, 0xE0, 0x9E, 0x3E, 0xA2, 0xE9, 0xAE, 0x3E, 0x92, 0xAE, 0xAD, 0xA3, 0xE3, 0x9F, 0xD9, 0x29,
+    0xE4, 0xFD, 0x3A, 0xDA, 0x4A, 0xFC, 0x3E, 0xA5, 0xFC, 0x3E, 0x95, 0xFA, 0x3E, 0x69, 0xE9, 0x75,
+    0x9E, 0x76, 0xF7, 0x19, 0xCA, 0xFC, 0x97, 0x19, 0xFD, 0x97, 0x29, 0xFC, 0x97, 0x77, 0x00, 0x29,
+    0xAA, 0x1A, 0xDA, 0x4E, 0x0F, 0xD3, 0xFF, 0xDA, 0x19, 0xFA, 0x09, 0xF1, 0xAF, 0x2F, 0x1F, 0x3E,
+    0xA1, 0xF3, 0xE9, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3, 0xEA, 0x1E,
+    0xA3, 0xE9, 0x1E, 0x92, 0x9E, 0x19, 0xE3, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x0A, 0xE9, 0x59, 0xFD,
+    0x69, 0xFC, 0x96, 0x9E, 0xA4, 0x69, 0xAA, 0xAA, 0xAA, 0x97, 0x0F, 0xEA, 0x70, 0xFE, 0x97, 0x77,
+    0x09, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F,
+    0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9,
+    0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF,
+    0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x39, 0xAA, 0xAA, 0xAA, 0xA4,
+    0xAF, 0xE4, 0xFE, 0xA7, 0x71, 0x9A, 0xEA, 0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9,
+    0x9E, 0x93, 0xEA, 0xAE, 0x4E, 0x9F, 0x39, 0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90,
+    0x9F, 0xFD, 0x2A, 0xFF, 0x4A, 0xFC, 0xA7, 0x70, 0x77, 0x7D, 0x3D, 0x97, 0xEA, 0xAE, 0x70, 0xAF,
+    0xD9, 0x71, 0x9A, 0xDA, 0x77, 0x72, 0x9F, 0xCA, 0x96, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x93, 0xFA,
+    0x2A, 0xF2, 0xFA, 0x4F, 0x19, 0xF5, 0xAE, 0x90, 0xAE, 0x95, 0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA,
+    0x69, 0xE9, 0x9E, 0x96, 0xAE, 0x9A, 0xE9, 0x6F, 0x0A, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0xAE, 0x90,
+    0x9F, 0x49, 0xF2, 0xFA, 0x2A, 0xF9, 0x29, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xFD, 0xA7, 0x76,
+    0x77, 0x0D, 0x92, 0xAC, 0xA3, 0xEA, 0xAE, 0x49, 0xFD, 0xA5, 0x9A, 0xDA, 0x97, 0x72, 0x9A, 0xEA,
+    0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x4E, 0x9F, 0x39,
+    0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90, 0x9F, 0xFD, 0x2A, 0xFF, 0x4A, 0xFC, 0xA7,
+    0x70, 0x77, 0x73, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0x9E, 0x71, 0xDA, 0x1D, 0xA7, 0x1D, 0x91, 0xAC,
+    0xA7, 0x77, 0x49, 0xFC, 0xA9, 0x70, 0x9F, 0xFC, 0xA6, 0x9F, 0xFE, 0x95, 0xFA, 0x2A, 0xF4, 0xFA,
+    0x4F, 0x39, 0xF5, 0xAE, 0x92, 0xAE, 0x95, 0x9E, 0x92, 0xF6, 0x9E, 0x92, 0xEA, 0x69, 0xE9, 0x19,
+    0xE9, 0x6A, 0xE9, 0x1A, 0xE9, 0x6F, 0x2A, 0xE9, 0x59, 0xF2, 0x9E, 0x95, 0xAE, 0x92, 0x9F, 0x49,
+    0xF4, 0xFA, 0x2A, 0xF9, 0x49, 0xFF, 0xEA, 0x6A, 0xFF, 0xCA, 0x70, 0x9F, 0xDA, 0x77, 0x72, 0x77,
+    0x5A, 0xE0, 0xAE, 0x59, 0xE1, 0xE6, 0xE1, 0xE6, 0xAC, 0xA1, 0xAC, 0xA7, 0x77, 0x9A, 0xEA, 0x70,
+    0xFF, 0x6F, 0xFD, 0x4A, 0xF1, 0xF4, 0xF2, 0x9E, 0x92, 0x9E, 0x93, 0xEA, 0x2A, 0xE4, 0xE9, 0x2F,
+    0x39, 0xE9, 0x2F, 0x3A, 0xE3, 0xF3, 0xF3, 0xAE, 0x2A, 0xE9, 0x39, 0xFF, 0xD5, 0xAF, 0xF7, 0xAF,
+    0xCA, 0x77, 0x60, 0x77, 0x74, 0x9F, 0xFF, 0xE4, 0x9F, 0xFF, 0xFC, 0x39, 0xFF, 0xFF, 0xD3, 0xFA,
+    0x2A, 0xEA, 0x99, 0x99, 0x93, 0xFA, 0x3A, 0xE7, 0x09, 0xF4, 0xAE, 0x70, 0xAE, 0x94, 0xF7, 0x0F,
+    0x5F, 0xFC, 0x92, 0xEA, 0x49, 0xFF, 0xC2, 0x9E, 0x94, 0xAF, 0xFC, 0x29, 0xE9, 0x4F, 0x99, 0x99,
+    0x93, 0x9E, 0x94, 0xEA, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0x9E, 0xA3, 0x9E, 0x97, 0x1F, 0xA2, 0xAE,
+    0x72, 0x9F, 0xFF, 0xFC, 0x5A, 0xFF, 0xFF, 0x69, 0xFF, 0xFD, 0xA7, 0x77, 0x20, 0x39, 0xAD, 0xA9,
+    0x2A, 0xEA, 0x94, 0xFE, 0xA9, 0xFE, 0xA2, 0xFF, 0xFF, 0xD1, 0xAE, 0xA1, 0xFD, 0x2E, 0x90, 0xF2,
+    0xAF, 0x29, 0xE9, 0x9E, 0x92, 0x9E, 0xA1, 0x9F, 0x0A, 0xE3, 0x9F, 0xFD, 0x90, 0xF3, 0xAF, 0xFC,
+    0x91, 0xF3, 0xFA, 0xA9, 0x94, 0xF3, 0xF7, 0x0A, 0xE2, 0xFC, 0x97, 0x9F, 0xFF, 0xAA, 0xAD, 0x92,
+    0xFF, 0xAF, 0xF9, 0x3A, 0xFC, 0x90, 0x9F, 0xDA, 0x77, 0x70, 0x77, 0x71, 0x9E, 0xA7, 0x2E, 0xA7,
+    0x2E, 0xA7, 0x29, 0xD9, 0x77, 0x7A, 0xFC, 0xAA, 0x7F, 0xFC, 0x95, 0xFF, 0xD9, 0x39, 0xEA, 0x1A,
+    0xEA, 0x39, 0xE9, 0x2F, 0x3A, 0xE3, 0xF3, 0xF3, 0xEA, 0x3E, 0xA2, 0xF9, 0x29, 0xFF, 0xDA, 0x3A,
+    0xFF, 0xCA, 0x4F, 0xFC, 0x95, 0xF0, 0x9E, 0x95, 0xEA, 0x1F, 0x49, 0xE9, 0x1A, 0xE9, 0x3A, 0xE2,
+    0x9E, 0xA3, 0xF3, 0xF3, 0xEA, 0x3A, 0xEA, 0x2E, 0xA4, 0xF1, 0x77, 0x4F, 0x7A, 0xE7, 0x9E, 0x70,
+    0xDA, 0x77, 0x39, 0xAA, 0x1A, 0xD9, 0x3E, 0x9F, 0x4F, 0xF3, 0x9F, 0xCA, 0xAA, 0x3A, 0xF7, 0xF9,
+    0x7F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x70, 0x3A,
+    0xFC, 0xAA, 0x6F, 0xFC, 0x94, 0xFF, 0xD9, 0x29, 0xEA, 0x1A, 0xEA, 0x29, 0xE9, 0x2F, 0x2A, 0xE3,
+    0xF2, 0xF3, 0xEA, 0x2E, 0xA2, 0xF9, 0x19, 0xFF, 0xDA, 0x2A, 0xFF, 0xCA, 0x3F, 0xFC, 0x94, 0xF0,
+    0x9E, 0x94, 0xEA, 0x1F, 0x39, 0xE9, 0x1A, 0xE9, 0x2A, 0xE2, 0x9E, 0xA2, 0xF3, 0xF2, 0xEA, 0x3A,
+    0xEA, 0x1E, 0xA4, 0xF7, 0x74, 0x99, 0x97, 0x29, 0xE7, 0x2E, 0x97, 0x19, 0xDA, 0x72, 0x9A, 0x97,
+    0x00, 0x39, 0xAA, 0x1A, 0xD9, 0x3E, 0x9F, 0x4F, 0xF3, 0x9F, 0xCA, 0xAA, 0x3A, 0xF7, 0xF9, 0x7F,
+    0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x77, 0x59, 0x99,
+    0x70, 0xAD, 0xA7, 0x0E, 0x70, 0xAD, 0x97, 0x09, 0xA9, 0x71, 0x77, 0x6A, 0xD9, 0x1A, 0xDA, 0x7E,
+    0x0A, 0xDA, 0x70, 0x9F, 0xCA, 0x72, 0xFA, 0x77, 0x70, 0xAF, 0xCA, 0xA7, 0x0F, 0xFC, 0x96, 0xFF,
+    0xD9, 0x49, 0xEA, 0x1A, 0xEA, 0x49, 0xE9, 0x2F, 0x4A, 0xE3, 0xF4, 0xF3, 0xEA, 0x4E, 0xA2, 0xF9,
+    0x39, 0xFF, 0xDA, 0x4A, 0xFF, 0xCA, 0x5F, 0xFC, 0x96, 0xF0, 0x9E, 0x96, 0xEA, 0x1F, 0x59, 0xE9,
+    0x1A, 0xE9, 0x4A, 0xE2, 0x9E, 0xA4, 0xF3, 0xF4, 0xEA, 0x3A, 0xEA, 0x3E, 0xA4, 0xF2, 0x77, 0x09,
+    0xDA, 0x19, 0xE4, 0xAD, 0x99, 0xE6, 0xFD, 0x7A, 0xF7, 0x74, 0x9A, 0xA1, 0xAD, 0x94, 0xE9, 0xF5,
+    0xFF, 0x49, 0xFC, 0xAA, 0xA4, 0xAF, 0x70, 0xF9, 0x70, 0xF7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE,
+    0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0x77, 0x6A, 0xE9, 0x79, 0xE9, 0x70, 0xE9,
+    0x70, 0xAD, 0x77, 0x69, 0xFC, 0xA9, 0x4F, 0xFC, 0x92, 0xAF, 0xFC, 0x3F, 0x91, 0x9A, 0x92, 0x9E,
+    0xA7, 0x09, 0xE9, 0x70, 0x9F, 0x71, 0xFC, 0x97, 0x9F, 0xCA, 0x79, 0xFC, 0x97, 0x0F, 0xC7, 0x1F,
+    0x97, 0x09, 0xEA, 0x70, 0x9E, 0x91, 0x9A, 0x93, 0xF9, 0x1A, 0xFF, 0xD2, 0xAF, 0xFC, 0x4A, 0xFD,
+    0xA7, 0x72, 0x77, 0x39, 0xEA, 0x7E, 0xA7, 0xE9, 0x7A, 0xD9, 0x77, 0x4A, 0xFA, 0x49, 0xFF, 0x3F,
+    0xFC, 0x3E, 0xA2, 0x99, 0x29, 0xEA, 0x70, 0xFC, 0x7A, 0xFC, 0xA6, 0xAF, 0xCA, 0x7F, 0xC7, 0x0F,
+    0x29, 0x4A, 0xE2, 0xAD, 0xAA, 0xFC, 0x2A, 0xFF, 0x39, 0xFD, 0xA7, 0x71, 0x77, 0x4F, 0xC7, 0xFD,
+    0xA5, 0xE9, 0x0E, 0x4A, 0xD3, 0xDA, 0x77, 0x29, 0xFC, 0xA9, 0x4F, 0xFC, 0x92, 0xAF, 0xFC, 0x3F,
+    0x91, 0x9A, 0x92, 0x9E, 0xA7, 0x09, 0xE9, 0x70, 0x9F, 0x71, 0xFC, 0x97, 0x9F, 0xCA, 0x79, 0xFC,
+    0x97, 0x0F, 0xC7, 0x1F, 0x97, 0x09, 0xEA, 0x70, 0x9E, 0x91, 0x9A, 0x93, 0xF9, 0x1A, 0xFF, 0xD2,
+    0xAF, 0xFC, 0x4A, 0xFD, 0xA7, 0x72, 0x77, 0x1F, 0xC6, 0xAF, 0xD4, 0xAD, 0xA0, 0xAD, 0x92, 0xAD,
+    0x92, 0xAD, 0x77, 0x1A, 0xFA, 0x49, 0xFF, 0x3F, 0xFC, 0x3E, 0xA2, 0x99, 0x29, 0xEA, 0x70, 0xFC,
+    0x7A, 0xFC, 0xA6, 0xAF, 0xCA, 0x7F, 0xC7, 0x0F, 0x29, 0x4A, 0xE2, 0xAD, 0xAA, 0xFC, 0x2A, 0xFF,
+    0x39, 0xFD, 0xA7, 0x71, 0x77, 0x29, 0xFC, 0xA9, 0x4F, 0xFC, 0x92, 0xAF, 0xFC, 0x3F, 0x91, 0x9A,
+    0x92, 0x9E, 0xA7, 0x09, 0xE9, 0x70, 0x9F, 0x71, 0xFC, 0x97, 0x9F, 0xCA, 0x79, 0xFC, 0x97, 0x0F,
+    0xC7, 0x1F, 0x97, 0x09, 0xEA, 0x70, 0x9E, 0x91, 0x9A, 0x93, 0xF9, 0x1A, 0xFF, 0xD2, 0xAF, 0xFC,
+    0x4A, 0xFD, 0xA7, 0x9D, 0x72, 0xF7, 0x2A, 0xDA, 0x71, 0xAD, 0xA7, 0xFC, 0x70, 0xF9, 0x60, 0x3A,
+    0xFA, 0x39, 0xFF, 0x2F, 0xFC, 0x2E, 0xA2, 0x99, 0x19, 0xEA, 0x7F, 0xC6, 0xAF, 0xCA, 0x5A, 0xFC,
+    0xA6, 0xFC, 0x7F, 0x19, 0x4A, 0xE1, 0xAD, 0xAA, 0xFC, 0x1A, 0xFF, 0x29, 0xFD, 0xA6, 0xDA, 0x79,
+    0xE9, 0x70, 0xE7, 0x9E, 0x5F, 0xCA, 0x5A, 0xE9, 0x50, 0x77, 0x3E, 0x2A, 0xD9, 0x49, 0xE0, 0xE9,
+    0x6A, 0xFC, 0x97, 0x0F, 0x97, 0x76, 0x9F, 0xCA, 0x95, 0xFF, 0xC9, 0x3A, 0xFF, 0xC4, 0xF9, 0x19,
+    0xA9, 0x39, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xF7, 0x2F, 0xC9, 0x70, 0x9F, 0xCA, 0x70, 0x9F, 0xC9,
+    0x71, 0xFC, 0x72, 0xF9, 0x71, 0x9E, 0xA7, 0x19, 0xE9, 0x29, 0xA9, 0x3F, 0x92, 0xAF, 0xFD, 0x3A,
+    0xFF, 0xC5, 0xAF, 0xDA, 0x77, 0x40, 0x77, 0xE2, 0xAD, 0xA3, 0xE0, 0xEA, 0x4A, 0xFC, 0xA6, 0xFA,
+    0x77, 0x3A, 0xFA, 0x49, 0xFF, 0x3F, 0xFC, 0x3E, 0xA2, 0x99, 0x29, 0xEA, 0x70, 0xFC, 0x7A, 0xFC,
+    0xA6, 0xAF, 0xCA, 0x7F, 0xC7, 0x0F, 0x29, 0x4A, 0xE2, 0xAD, 0xAA, 0xFC, 0x2A, 0xFF, 0x39, 0xFD,
+    0xA7, 0x71, 0x09, 0xFF, 0xF1, 0xAF, 0xFF, 0x1F, 0xFF, 0xA1, 0x99, 0x99, 0xF9, 0x99, 0x96, 0xF7,
+    0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7,
+    0x2F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x3D, 0x73, 0xAE, 0x73, 0xAD, 0xA7,
+    0x2A, 0xDA, 0x70, 0xFC, 0x97, 0x0F, 0x97, 0x00, 0x39, 0xA9, 0x6D, 0xA5, 0xAD, 0x94, 0xAF, 0xAA,
+    0x99, 0xFF, 0x9A, 0xFF, 0x91, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xAE, 0x5F, 0x5E, 0xA4, 0x9E, 0x94,
+    0xAE, 0x94, 0xAF, 0xAC, 0x91, 0x9F, 0xD9, 0x2A, 0xFC, 0x4D, 0xA5, 0x9E, 0x96, 0xE6, 0xE3, 0xFC,
+    0xA3, 0xAE, 0xA4, 0x77, 0x0A, 0xD2, 0xAD, 0xA4, 0xE0, 0xEA, 0x59, 0xFC, 0xA7, 0xFA, 0x77, 0x19,
+    0xFF, 0xF0, 0xAF, 0xFF, 0x0F, 0xFF, 0xA0, 0x99, 0x99, 0xF9, 0x99, 0x95, 0xF7, 0x1E, 0xA7, 0x09,
+    0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7,
+    0x09, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x00, 0x70, 0xE9, 0x79, 0xE4, 0x9A, 0x90, 0xE5, 0xDA,
+    0x0D, 0x94, 0xAD, 0x97, 0xAF, 0xAA, 0x92, 0x9F, 0xF9, 0x2A, 0xFF, 0x94, 0xEA, 0x79, 0xE9, 0x7A,
+    0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A, 0xE9, 0x7A, 0xFA, 0xC9, 0x49, 0xFD, 0x95,
+    0xAF, 0xC7, 0x72, 0x09, 0xFF, 0xF1, 0xAF, 0xFF, 0x1F, 0xFF, 0xA1, 0x99, 0x99, 0xF9, 0x99, 0x96,
+    0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x79, 0x9A, 0xE9, 0x99, 0x4A, 0xFF, 0xC4, 0xFF, 0xCA, 0x4F, 0xFC,
+    0x96, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x00,
+    0x49, 0xA9, 0x7D, 0xA6, 0xAD, 0x95, 0xAF, 0xAA, 0x90, 0x9F, 0xF9, 0x0A, 0xFF, 0x92, 0xEA, 0x59,
+    0xE9, 0x4A, 0xAE, 0xAA, 0x91, 0x9F, 0xF1, 0x9F, 0xEA, 0x3E, 0xA5, 0x9E, 0x95, 0xAE, 0x95, 0xAF,
+    0xAC, 0x92, 0x9F, 0xD9, 0x3A, 0xFC, 0x75, 0x6A, 0xD9, 0x19, 0xCA, 0x6A, 0xFC, 0xAD, 0x7D, 0xAF,
+    0xCA, 0x69, 0xC9, 0x19, 0xDA, 0x77, 0x6A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E,
+    0x94, 0xF2, 0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94,
+    0xEA, 0x2A, 0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3,
+    0x9E, 0xA3, 0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x60, 0x4A, 0xD9,
+    0x19, 0xCA, 0x3A, 0xFC, 0xAD, 0x93, 0xDA, 0xFD, 0x39, 0xC9, 0x19, 0xAC, 0xA7, 0x71, 0xAA, 0xAA,
+    0x3A, 0xAA, 0x91, 0xEA, 0x3E, 0x90, 0x9E, 0x92, 0x9E, 0x19, 0xE3, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3,
+    0xEA, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE, 0x19, 0xE3, 0xF1, 0xAE, 0x29, 0xEA, 0x1A, 0xE2,
+    0xFA, 0x1A, 0xFF, 0xD9, 0x2F, 0xD9, 0xE3, 0x9F, 0x90, 0xE7, 0x70, 0x6A, 0xAA, 0xAA, 0xAA, 0x70,
+    0xAF, 0xE7, 0x0A, 0xFD, 0xA7, 0x76, 0xAE, 0x49, 0xE9, 0x2F, 0x4A, 0xE3, 0xEA, 0x4F, 0x29, 0xE9,
+    0x4F, 0x2A, 0xE5, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x2A, 0xE9, 0x4E,
+    0xA2, 0xAE, 0x49, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x29, 0xEA, 0x39,
+    0xEA, 0x3F, 0x91, 0x9F, 0x4F, 0xFE, 0xA5, 0xFF, 0xCA, 0x7A, 0xFD, 0x97, 0x76, 0x4A, 0xAA, 0xAA,
+    0xAA, 0x59, 0xFE, 0x5A, 0xFE, 0x77, 0x1A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9, 0x09, 0xE9,
+    0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A,
+    0xE1, 0x9E, 0x3F, 0x1A, 0xE2, 0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92, 0xFD, 0x9E, 0x39,
+    0xF9, 0x0E, 0x77, 0x00, 0x77, 0x6D, 0xA2, 0xAD, 0x7A, 0xEA, 0xE9, 0x70, 0xFD, 0xA7, 0x2A, 0xDA,
+    0x97, 0x77, 0xAE, 0x49, 0xE9, 0x2F, 0x4A, 0xE3, 0xEA, 0x4F, 0x29, 0xE9, 0x4F, 0x2A, 0xE5, 0xEA,
+    0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x2A, 0xE9, 0x4E, 0xA2, 0xAE, 0x49, 0xEA,
+    0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE, 0x29, 0xEA, 0x4F, 0x29, 0xEA, 0x39, 0xEA, 0x3F, 0x91, 0x9F,
+    0x4F, 0xFE, 0xA5, 0xFF, 0xCA, 0x7A, 0xFD, 0x97, 0x76, 0x77, 0x1A, 0xCA, 0x29, 0xD4, 0xAE, 0xAE,
+    0xA5, 0xFE, 0x7A, 0xDA, 0x97, 0x72, 0xAA, 0xAA, 0x3A, 0xAA, 0x91, 0xEA, 0x3E, 0x90, 0x9E, 0x92,
+    0x9E, 0x19, 0xE3, 0xAE, 0x1A, 0xE3, 0xF1, 0xF3, 0xEA, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0x92, 0xAE,
+    0x19, 0xE3, 0xF1, 0xAE, 0x29, 0xEA, 0x1A, 0xE2, 0xFA, 0x1A, 0xFF, 0xD9, 0x2F, 0xD9, 0xE3, 0x9F,
+    0x90, 0xE7, 0x70, 0x79, 0xDA, 0x73, 0x9F, 0xC7, 0x2A, 0xC9, 0x0A, 0xC9, 0x71, 0xAC, 0x90, 0xAC,
+    0x97, 0x19, 0xFC, 0x73, 0x9D, 0xA7, 0x77, 0x0A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2,
+    0x9E, 0x94, 0xF2, 0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE,
+    0x94, 0xEA, 0x2A, 0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E,
+    0xA3, 0x9E, 0xA3, 0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x60, 0x59,
+    0xDA, 0x70, 0x9F, 0xC7, 0xAC, 0x90, 0xAC, 0x96, 0xAC, 0x90, 0xAC, 0x96, 0x9F, 0xC7, 0x09, 0xDA,
+    0x77, 0x3A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9, 0x09, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1,
+    0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0x3F, 0x1A, 0xE2,
+    0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92, 0xFD, 0x9E, 0x39, 0xF9, 0x0E, 0x77, 0x00, 0x77,
+    0x71, 0x9E, 0x99, 0xE9, 0x7E, 0x90, 0xE9, 0x7E, 0x1A, 0xD9, 0x79, 0xCA, 0x19, 0xCA, 0x77, 0x70,
+    0xAE, 0x49, 0xE9, 0x3F, 0x4A, 0xE4, 0xEA, 0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xEA, 0x3F, 0x49,
+    0xE9, 0x3E, 0xA4, 0xAE, 0x39, 0xEA, 0x4F, 0x3A, 0xE9, 0x4E, 0xA3, 0xAE, 0x49, 0xEA, 0x3F, 0x49,
+    0xE9, 0x3E, 0xA4, 0xAE, 0x39, 0xEA, 0x4F, 0x39, 0xEA, 0x39, 0xEA, 0x4F, 0x91, 0x9F, 0x5F, 0xFE,
+    0xA6, 0xFF, 0xCA, 0x70, 0xAF, 0xD9, 0x77, 0x70, 0x77, 0x6E, 0xA0, 0xEA, 0x5E, 0x90, 0xEA, 0x5A,
+    0xD9, 0x0A, 0xD9, 0x59, 0xCA, 0x2D, 0x77, 0x5A, 0xAA, 0xA3, 0xAA, 0xA9, 0x3E, 0xA3, 0xE9, 0x29,
+    0xE9, 0x29, 0xE3, 0x9E, 0x3A, 0xE3, 0xAE, 0x3F, 0x3F, 0x3E, 0xA3, 0xEA, 0x29, 0xE9, 0x29, 0xE9,
+    0x2A, 0xE3, 0x9E, 0x3F, 0x3A, 0xE2, 0x9E, 0xA3, 0xAE, 0x2F, 0xA3, 0xAF, 0xFD, 0x94, 0xFD, 0x9E,
+    0x59, 0xF9, 0x0E, 0x77, 0x40, 0x2A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E, 0x94,
+    0xF2, 0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94, 0xEA,
+    0x2A, 0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3, 0x9E,
+    0xA3, 0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x72, 0xE7, 0x4A, 0xD7, 0x49,
+    0xD9, 0x74, 0xAD, 0xA9, 0x73, 0x9F, 0x74, 0xAE, 0x77, 0x71, 0x1A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E,
+    0xA3, 0xE9, 0x09, 0xE9, 0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29,
+    0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0x3F, 0x1A, 0xE2, 0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD,
+    0x92, 0xFD, 0x9E, 0x39, 0xF9, 0x0E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xE9, 0x97, 0x0A,
+    0xF7, 0x1E, 0xA7, 0x71, 0x77, 0x77, 0x9F, 0xA7, 0x79, 0xFD, 0x76, 0x9E, 0x09, 0xE7, 0x5D, 0xA2,
+    0x9D, 0x97, 0x77, 0x4A, 0xDA, 0x49, 0xE5, 0xE9, 0xAE, 0x4F, 0x4A, 0xE0, 0xAE, 0x39, 0xF4, 0xEA,
+    0x0A, 0xE3, 0xAF, 0x39, 0xE1, 0xAE, 0x3F, 0xC3, 0xF1, 0xAE, 0x2A, 0xFC, 0x29, 0xE9, 0x1A, 0xE2,
+    0xEA, 0xD2, 0xAE, 0x2A, 0xE1, 0xAD, 0xAA, 0xD9, 0x1E, 0x92, 0x9E, 0x1E, 0x0A, 0xD9, 0x0A, 0xE3,
+    0x9E, 0x09, 0xDA, 0x0A, 0xD9, 0x0E, 0xA3, 0x9E, 0x0E, 0x90, 0xAD, 0x99, 0xE4, 0x9E, 0x9E, 0x1A,
+    0xD9, 0xEA, 0x49, 0xEA, 0xD9, 0x1A, 0xD9, 0xE5, 0x9F, 0xD2, 0xAD, 0xAE, 0x59, 0xFC, 0x92, 0xAF,
+    0xC9, 0x59, 0xFC, 0x39, 0xFC, 0x69, 0xFA, 0x39, 0xF9, 0x7F, 0x49, 0xF7, 0x77, 0x73, 0xAF, 0x97,
+    0x4A, 0xFD, 0x73, 0xAD, 0xA0, 0xAD, 0xA7, 0x19, 0xD9, 0x2A, 0xD7, 0x77, 0x09, 0xAA, 0xA3, 0xAA,
+    0xAA, 0x3A, 0xAA, 0xA9, 0xE2, 0x9F, 0x29, 0xE9, 0x9E, 0x2F, 0xC2, 0xAE, 0x09, 0xE1, 0x9F, 0xC2,
+    0xE9, 0x09, 0xE1, 0xAD, 0xAD, 0x1A, 0xE2, 0xE1, 0xDA, 0xAD, 0x1E, 0xA2, 0xE0, 0xAD, 0x9A, 0xD0,
+    0x9E, 0x3E, 0x0E, 0x0A, 0xD0, 0xEA, 0x3E, 0x9D, 0x90, 0xAD, 0x9E, 0x4E, 0xAD, 0x1A, 0xDA, 0xDA,
+    0x4F, 0xCA, 0x1A, 0xFC, 0x5F, 0xC2, 0xAF, 0xA5, 0xFA, 0x2A, 0xF6, 0xF9, 0x2A, 0xEA, 0x50, 0x77,
+    0x3A, 0xF9, 0x7A, 0xFD, 0x6A, 0xDA, 0x09, 0xDA, 0x49, 0xD9, 0x2A, 0xD7, 0x71, 0xAE, 0x5F, 0x09,
+    0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F, 0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E,
+    0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97,
+    0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x70, 0x77, 0x79, 0xFC, 0x72, 0xFD, 0x97, 0x9E, 0x1E,
+    0x7D, 0xA2, 0x9D, 0x97, 0x75, 0x9A, 0xAA, 0x4A, 0xAA, 0xA3, 0xAE, 0x39, 0xEA, 0x39, 0xE3, 0xF4,
+    0x9E, 0x29, 0xEA, 0x5E, 0x91, 0xAE, 0x6E, 0x91, 0xEA, 0x6E, 0xA0, 0xAE, 0x7A, 0xDA, 0x0E, 0x97,
+    0xAD, 0xAA, 0xE7, 0x09, 0xDA, 0xE9, 0x70, 0x9F, 0xD7, 0x2F, 0xC9, 0x72, 0xFC, 0x73, 0xF9, 0x73,
+    0xEA, 0x73, 0xAE, 0x73, 0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0xC7, 0x2A, 0xE9, 0x73, 0x39, 0xCA,
+    0x1A, 0xC9, 0x6E, 0x0A, 0xE6, 0xE0, 0xAD, 0xA6, 0x99, 0x29, 0x97, 0x72, 0xAE, 0x5F, 0x09, 0xE9,
+    0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F, 0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E, 0x9F,
+    0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A,
+    0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x70, 0x77, 0x71, 0x9E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x29,
+    0xD9, 0x77, 0x7A, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0x9F, 0xFE, 0x49, 0x99, 0x99, 0x9F, 0x97, 0x1A,
+    0xEA, 0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF7, 0x2F,
+    0x97, 0x1A, 0xEA, 0x71, 0x9F, 0x72, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x2A, 0xFF, 0xE9, 0x20, 0x77,
+    0x6F, 0x70, 0xF7, 0x0A, 0xE7, 0x1D, 0xA7, 0x75, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0x9F, 0xFA, 0x3A,
+    0xFF, 0xA7, 0x9F, 0x70, 0xF7, 0x0F, 0x97, 0xAE, 0x97, 0xAE, 0xA7, 0x9E, 0xA7, 0x0F, 0x70, 0xF7,
+    0x0F, 0xFC, 0xA3, 0xFF, 0xCA, 0x29, 0xFF, 0xC9, 0x20, 0x77, 0x70, 0xAD, 0x97, 0x3F, 0x72, 0x9E,
+    0xA7, 0x39, 0xAA, 0x77, 0x7A, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0x9F, 0xFE, 0x49, 0x99, 0x99, 0x9F,
+    0x97, 0x1A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0xFA, 0x71, 0xAF, 0x71, 0x9F, 0x72,
+    0xF7, 0x2F, 0x97, 0x1A, 0xEA, 0x71, 0x9F, 0x72, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x2A, 0xFF, 0xE9,
+    0x20, 0x77, 0x39, 0xDA, 0x70, 0xF7, 0x0F, 0x70, 0x9A, 0xA7, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2,
+    0x9F, 0xFA, 0x2A, 0xFF, 0xA6, 0x9F, 0x7F, 0x7F, 0x96, 0xAE, 0x96, 0xAE, 0xA6, 0x9E, 0xA7, 0xF7,
+    0xF7, 0xFF, 0xCA, 0x2F, 0xFC, 0xA1, 0x9F, 0xFC, 0x91, 0x77, 0x6A, 0xD9, 0x19, 0xDA, 0x7E, 0x9A,
+    0xDA, 0x70, 0x9F, 0xCA, 0x72, 0xAE, 0xA7, 0x77, 0x0A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x9F, 0xFE,
+    0x59, 0x99, 0x99, 0x9F, 0x97, 0x2A, 0xEA, 0x72, 0xAF, 0x72, 0x9F, 0x73, 0xF9, 0x72, 0xFA, 0x72,
+    0xAF, 0x72, 0x9F, 0x73, 0xF7, 0x3F, 0x97, 0x2A, 0xEA, 0x72, 0x9F, 0x73, 0xFF, 0xEA, 0x39, 0xFF,
+    0xEA, 0x3A, 0xFF, 0xE9, 0x30, 0x77, 0x29, 0xDA, 0x19, 0xE5, 0xAD, 0x9A, 0xE7, 0xFD, 0x70, 0xAF,
+    0x77, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xA4, 0xAF, 0xFA, 0x70, 0x9F, 0x71, 0xF7, 0x1F,
+    0x97, 0x0A, 0xE9, 0x70, 0xAE, 0xA7, 0x09, 0xEA, 0x71, 0xF7, 0x1F, 0x71, 0xFF, 0xCA, 0x4F, 0xFC,
+    0xA3, 0x9F, 0xFC, 0x93, 0x77, 0x7A, 0xF9, 0x7F, 0xD9, 0x6A, 0xFD, 0x7F, 0x72, 0xE9, 0x71, 0x9E,
+    0x72, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0xAE, 0x72, 0xEA, 0x72, 0xEA,
+    0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x19,
+    0xF7, 0xFD, 0x97, 0xFC, 0xA7, 0x0F, 0x97, 0x10, 0x77, 0x0F, 0x59, 0xFC, 0xA9, 0x19, 0xE9, 0x39,
+    0xFF, 0xCA, 0x0F, 0x39, 0xFF, 0xFE, 0x93, 0xFA, 0x2A, 0xFD, 0x4F, 0xA4, 0xFA, 0x49, 0xF5, 0x9E,
+    0x94, 0xAE, 0x95, 0x9E, 0x94, 0xF6, 0x9E, 0x94, 0xEA, 0x69, 0xE9, 0x39, 0xE9, 0x6A, 0xE4, 0x9E,
+    0x96, 0xF4, 0x9E, 0x96, 0xEA, 0x49, 0xE9, 0x5A, 0xE9, 0x49, 0xEA, 0x49, 0xF6, 0xFA, 0x2A, 0xF9,
+    0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFC, 0x97, 0x29, 0xFD, 0xA7, 0x77, 0x60, 0x74, 0x9A, 0xAA, 0x75,
+    0xAE, 0x49, 0xAE, 0xA2, 0xEA, 0x3F, 0xF9, 0xF3, 0xFF, 0xFC, 0x3A, 0xF1, 0xFC, 0x94, 0xF2, 0x9E,
+    0x94, 0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xE9, 0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF5, 0xAE,
+    0x2A, 0xE9, 0x59, 0xFF, 0xD7, 0xAF, 0xF7, 0x1A, 0xFC, 0xA7, 0x77, 0x20, 0x77, 0x76, 0xAF, 0xCA,
+    0x3A, 0xF9, 0x59, 0xFF, 0xC9, 0x9F, 0xEA, 0x3A, 0xFF, 0xFF, 0xF9, 0x19, 0xFA, 0x2F, 0xD9, 0x1A,
+    0xEA, 0x1F, 0x94, 0xF4, 0xEA, 0x09, 0xEA, 0x5A, 0xE4, 0xEA, 0x0F, 0x6A, 0xE9, 0x29, 0xE9, 0x0E,
+    0xA6, 0xAE, 0x3A, 0xE0, 0x9E, 0x96, 0xAE, 0x3A, 0xE0, 0xAE, 0x7F, 0x3E, 0xA0, 0xAE, 0x7F, 0x3E,
+    0x90, 0xAE, 0x69, 0xEA, 0x29, 0xE9, 0x0A, 0xE6, 0xF3, 0xAE, 0x19, 0xEA, 0x4A, 0xEA, 0x3F, 0x2F,
+    0x92, 0xAF, 0x4E, 0xA2, 0xAF, 0xFE, 0x94, 0xE9, 0x3F, 0xFD, 0x94, 0x9E, 0x5A, 0xFD, 0xA6, 0xAE,
+    0x77, 0x73, 0x39, 0xAE, 0xA2, 0x9E, 0xA5, 0xFF, 0x9F, 0xE3, 0xFF, 0xFF, 0xCA, 0x1A, 0xF1, 0xFC,
+    0x90, 0x9F, 0x1F, 0x29, 0xE9, 0x2A, 0xE0, 0x9E, 0x93, 0xEA, 0x2F, 0x0A, 0xE4, 0xE9, 0x2E, 0xA0,
+    0xF3, 0x9E, 0x92, 0xE9, 0x0F, 0x3A, 0xE2, 0x9E, 0x90, 0xF3, 0xF2, 0xAE, 0x1A, 0xE2, 0xAE, 0x92,
+    0xF1, 0x9F, 0xFD, 0x3E, 0xA2, 0xAF, 0xF4, 0xE9, 0x3A, 0xFC, 0xA4, 0x9E, 0x77, 0x0A, 0xE7, 0x70,
+    0xF7, 0x70, 0xEA, 0x77, 0x9E, 0x97, 0x7A, 0xE7, 0x70, 0xAE, 0x30, 0x2A, 0xFF, 0xCA, 0x49, 0xFF,
+    0xFC, 0xA2, 0xFF, 0xFE, 0x90, 0xAE, 0x9A, 0xE9, 0x99, 0xAF, 0x0A, 0xD1, 0xAE, 0x3F, 0x0A, 0xD1,
+    0xF3, 0xAE, 0x5E, 0xA3, 0xF4, 0x9E, 0x92, 0x9F, 0x4A, 0xEA, 0x9A, 0xFC, 0x94, 0xFF, 0xEA, 0x5F,
+    0xFD, 0x96, 0xFA, 0xAA, 0x97, 0x09, 0xE9, 0x74, 0xAE, 0x75, 0xF7, 0x5E, 0xA7, 0x49, 0xE9, 0x74,
+    0x9E, 0x73, 0x77, 0x49, 0xF7, 0x09, 0xFC, 0x70, 0xFD, 0x79, 0xEA, 0x71, 0x9E, 0x72, 0xAE, 0x0A,
+    0xDA, 0x5E, 0xAF, 0xD4, 0xFF, 0xD9, 0x29, 0xFA, 0x0A, 0xEA, 0x2A, 0xEA, 0x2F, 0x2F, 0x3F, 0x2E,
+    0xA3, 0xEA, 0x2E, 0x92, 0x9E, 0xA1, 0x9E, 0x3A, 0xE9, 0x1A, 0xE3, 0xF2, 0xFA, 0x1A, 0xEA, 0x2F,
+    0xFE, 0x3E, 0xAF, 0xD9, 0x29, 0xE0, 0xAF, 0x4A, 0xE7, 0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A,
+    0xE7, 0x2A, 0xE7, 0x20, 0x3A, 0xE7, 0x2F, 0x72, 0xF9, 0x97, 0x9F, 0xF5, 0xAF, 0xFC, 0x4A, 0xEA,
+    0xFC, 0xA3, 0xF2, 0xF3, 0xEA, 0x2F, 0x29, 0xE9, 0x2F, 0x2A, 0xE2, 0x9E, 0xA2, 0xF9, 0x9A, 0xF9,
+    0x2F, 0xFD, 0x93, 0xFF, 0xC9, 0x39, 0xEA, 0xAE, 0x94, 0xAE, 0x1F, 0x4F, 0x1A, 0xE9, 0x3E, 0xA2,
+    0xEA, 0x29, 0xEA, 0x2F, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0x9A, 0xAA, 0x10, 0x77, 0x19, 0xAF, 0xA5,
+    0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xC9, 0x2A, 0xE9, 0x70, 0x9E, 0x97, 0x0A, 0xE9, 0x7A, 0xF5, 0x9A,
+    0xFC, 0x93, 0x9F, 0xE9, 0x3A, 0xFD, 0xA4, 0xAF, 0xCA, 0x6F, 0x97, 0x9E, 0x97, 0x09, 0xE7, 0x19,
+    0xEA, 0x39, 0xA3, 0xFF, 0xD3, 0xAF, 0xFC, 0x49, 0xFD, 0xA9, 0x77, 0x00, 0x29, 0xAE, 0xA9, 0x3F,
+    0xFA, 0x2A, 0xFF, 0x92, 0xA3, 0xE9, 0x69, 0xE9, 0x49, 0xFC, 0x3A, 0xFD, 0x91, 0x9F, 0xE9, 0x2F,
+    0xCA, 0x4A, 0xE9, 0x6A, 0xE7, 0x9F, 0x9A, 0xAD, 0x2F, 0xFC, 0x3A, 0xFD, 0x97, 0x50, 0x39, 0xFF,
+    0xD9, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x4A, 0xE9, 0x09, 0x99, 0x99, 0x5E, 0x97, 0x3F, 0x73, 0x9E,
+    0x97, 0x3F, 0x73, 0xAE, 0x73, 0xEA, 0x72, 0xEA, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2A, 0xE9, 0x71,
+    0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0xAF, 0xFE, 0x92, 0x71, 0xFA, 0x1F, 0xDA, 0x9C, 0xA0, 0xAE,
+    0x9C, 0xA0, 0xAE, 0x0F, 0xDA, 0x1A, 0xF9, 0x29, 0xE3, 0xAE, 0x3F, 0x3E, 0xA3, 0xE9, 0x29, 0xE3,
+    0xAE, 0x3F, 0x3E, 0xA2, 0x9E, 0x92, 0x9E, 0x3A, 0xE3, 0xEA, 0x3E, 0x92, 0x9E, 0x92, 0x9E, 0x92,
+    0x9F, 0xDA, 0x0F, 0xDA, 0x1A, 0xEA, 0x90, 0x39, 0xA9, 0x6D, 0xA5, 0xAD, 0x94, 0xAF, 0xAA, 0x99,
+    0xFF, 0x9A, 0xFF, 0x91, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xAE, 0x5F, 0x5E, 0xA4, 0x9E, 0x94, 0xAE,
+    0x94, 0xAF, 0xAC, 0xA1, 0x9F, 0xD9, 0x2A, 0xFC, 0x95, 0xE6, 0xE5, 0x9D, 0xA3, 0xFC, 0x93, 0xFC,
+    0x4E, 0xA4, 0x2A, 0xFF, 0xE1, 0x9F, 0xFF, 0xC1, 0xFF, 0xFC, 0xA0, 0xAE, 0x99, 0xAE, 0x99, 0x99,
+    0x1A, 0xD2, 0xF5, 0xAD, 0x2E, 0xA7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x3E, 0xA7,
+    0x29, 0xE9, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x00,
+    0x76, 0xAF, 0x3F, 0xD2, 0xAF, 0xD2, 0xF5, 0xE9, 0x4A, 0xFA, 0xA9, 0x9F, 0xF9, 0xAF, 0xF9, 0x1E,
+    0xA4, 0x9E, 0x94, 0xAE, 0x5A, 0xE5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE9, 0x4A, 0xFA, 0xC9, 0x19,
+    0xFD, 0x92, 0xAF, 0xC7, 0x40, 0x9F, 0xFF, 0x0A, 0xFF, 0xF0, 0xFF, 0xFA, 0x09, 0x99, 0x9F, 0x99,
+    0x99, 0x5F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE9,
+    0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1E, 0xA7,
+    0x1E, 0xA7, 0x1F, 0xD7, 0xFD, 0x70, 0xAE, 0xA6, 0x77, 0x1F, 0x3A, 0xE4, 0x9E, 0x90, 0xEA, 0x3E,
+    0xA4, 0xAE, 0x0A, 0xE4, 0xEA, 0x4A, 0xFE, 0x93, 0x9E, 0x94, 0xFE, 0x94, 0xAE, 0x5F, 0xA9, 0x6F,
+    0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0xAE, 0x5E,
+    0xA7, 0x0F, 0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0xA3, 0x9E, 0xA7,
+    0x1F, 0x29, 0xF7, 0x2F, 0xFE, 0x97, 0x3F, 0xFC, 0x97, 0x5A, 0xFC, 0xA7, 0x77, 0x73, 0x76, 0x9A,
+    0xAA, 0x77, 0xAE, 0x2A, 0xAA, 0xA3, 0xAA, 0xA9, 0x0E, 0xA2, 0xEA, 0x3E, 0xAF, 0x29, 0xE9, 0x29,
+    0xFE, 0x39, 0xE3, 0xAF, 0xA9, 0x4A, 0xE3, 0xF7, 0xF3, 0xEA, 0x7E, 0xA2, 0x9E, 0x96, 0x9E, 0x92,
+    0xAE, 0x79, 0xE3, 0xF7, 0xAE, 0x29, 0xEA, 0x7A, 0xE2, 0xFA, 0x7A, 0xFF, 0xD9, 0x79, 0xFD, 0x9E,
+    0x71, 0x9F, 0x90, 0xE7, 0x77, 0x40, 0x6E, 0xA1, 0x9E, 0x2A, 0xD9, 0x2A, 0xCA, 0x71, 0xAE, 0xA2,
+    0xEA, 0x2E, 0x92, 0xAD, 0x93, 0x76, 0xFC, 0x4F, 0xD9, 0x2E, 0x90, 0xE1, 0xDA, 0x3D, 0x90, 0x1D,
+    0xA2, 0xD1, 0xFF, 0xC0, 0xAD, 0xAF, 0xC9, 0x0D, 0x2A, 0xD9, 0x10, 0x09, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xFE, 0xA0, 0xFE, 0x90, 0x72, 0x9F, 0xFC, 0xAA, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x72, 0xD9, 0x2A, 0xCA, 0x0E, 0xAA, 0xE1, 0x9F, 0xDA, 0x29, 0xAD, 0xA9, 0x10, 0x5E, 0x0F, 0x9F,
+    0x1A, 0xA1, 0x0A, 0xA1, 0x9C, 0xA0, 0xE9, 0x0E, 0x0E, 0x90, 0xE1, 0x99, 0x19, 0x91, 0x0A, 0xAA,
+    0x90, 0x9F, 0xA0, 0x99, 0xE2, 0xDA, 0x0A, 0xE1, 0xDA, 0x70, 0x09, 0xE9, 0x1F, 0xC0, 0xAC, 0x90,
+    0x9C, 0x9A, 0xC9, 0x0A, 0xC9, 0x0F, 0xC1, 0x9A, 0xCA, 0x10, 0x75, 0x9E, 0x90, 0xEA, 0x1E, 0x90,
+    0xE9, 0x1A, 0xD9, 0x0A, 0xD9, 0x19, 0xCA, 0x19, 0xD3, 0x73, 0xE2, 0xE1, 0x9D, 0xA9, 0xE3, 0xFD,
+    0x49, 0xF3, 0x19, 0x91, 0x9D, 0x1A, 0xD1, 0xDA, 0x1D, 0x90, 0x9D, 0x90, 0x9D, 0x19, 0xAA, 0x10,
+    0x19, 0x29, 0x91, 0xDA, 0x0A, 0xD1, 0xD9, 0x0D, 0xA0, 0x9D, 0x1D, 0x90, 0xAD, 0x09, 0xD9, 0x71,
+    0x73, 0xE9, 0x9E, 0x29, 0xE0, 0xAD, 0x92, 0xAD, 0x1E, 0x3A, 0xC9, 0x1D, 0x00, 0x39, 0x6E, 0x5E,
+    0x09, 0x0D, 0x0A, 0xA9, 0x9C, 0xAA, 0xCA, 0x19, 0xD1, 0xFD, 0x92, 0xAD, 0xA2, 0x73, 0x9F, 0xC2,
+    0xAF, 0xE1, 0xDA, 0x99, 0xAD, 0x99, 0xCA, 0x3D, 0x90, 0x29, 0xD9, 0x2E, 0x29, 0xE2, 0xE9, 0x1A,
+    0xE2, 0xEA, 0x29, 0x99, 0x20, 0x2E, 0x91, 0x9E, 0x2E, 0xA2, 0xE2, 0xAD, 0xA2, 0xE3, 0x99, 0x30,
+    0xE9, 0xE9, 0xE9, 0xAD, 0x99, 0xD9, 0x0D, 0x90, 0x99, 0x00, 0x2E, 0x91, 0x9E, 0x2E, 0xA2, 0xE2,
+    0xAD, 0xA2, 0xE3, 0x99, 0x30, 0x5A, 0xE2, 0xE9, 0x2E, 0x29, 0xD0, 0x72, 0xF2, 0xF2, 0xAE, 0x3D,
+    0xA3, 0x39, 0x4C, 0xA0, 0xAA, 0xD9, 0x0F, 0x3D, 0x39, 0x90, 0x19, 0x3D, 0x3D, 0xAA, 0x09, 0xF0,
+    0xAC, 0x39, 0x93, 0xAF, 0xDA, 0x9A, 0xAA, 0xAA, 0xC9, 0x4A, 0xC5, 0xD5, 0xCA, 0x5C, 0x94, 0x9C,
+    0x10, 0x72, 0xAE, 0x92, 0xF2, 0x9E, 0x91, 0xFA, 0x19, 0xE9, 0x29, 0x99, 0x40, 0x29, 0x19, 0xD1,
+    0xD9, 0x1C, 0xA2, 0xD9, 0x19, 0xC9, 0x50, 0x29, 0xC4, 0xAC, 0x39, 0xD9, 0x1F, 0xC9, 0x60, 0x0F,
+    0xA9, 0xAD, 0xAA, 0x1C, 0xA3, 0xCA, 0x70, 0x29, 0x39, 0xC1, 0x9A, 0xDA, 0x9A, 0xFA, 0x1C, 0xA3,
+    0xA9, 0x10, 0x09, 0x99, 0x99, 0x1F, 0xCA, 0x60, 0x49, 0x94, 0xE4, 0xE3, 0x9E, 0x3A, 0xDA, 0x1A,
+    0xF2, 0xFA, 0x2E, 0xA2, 0x09, 0x99, 0x2E, 0x19, 0xE1, 0x9D, 0xA1, 0xAD, 0xA1, 0xAF, 0xA0, 0xFA,
+    0x1A, 0xAA, 0x90, 0x19, 0x91, 0xEA, 0x9E, 0xA0, 0xE9, 0x19, 0x10, 0x09, 0xCA, 0x1A, 0xC9, 0x0E,
+    0x09, 0xE0, 0xE0, 0x9D, 0xA0, 0x99, 0x29, 0x90, 0x1A, 0xDA, 0x1F, 0xCA, 0x0D, 0x1D, 0x0D, 0x1D,
+    0x0A, 0xFA, 0x1A, 0xD9, 0x00, 0x19, 0x99, 0x19, 0xE1, 0xE9, 0x1D, 0xA1, 0x9A, 0x92, 0x1A, 0xCA,
+    0x29, 0xE9, 0x3E, 0x3E, 0x0A, 0xFA, 0x0A, 0xEA, 0x10, 0x1A, 0xD1, 0xAD, 0x19, 0xD9, 0x19, 0xDA,
+    0x90, 0x9F, 0x90, 0xAE, 0x60, 0x19, 0x91, 0xAD, 0x1D, 0xA1, 0xD9, 0x1D, 0x90, 0x9D, 0x1A, 0xD1,
+    0xAA, 0x91, 0x0F, 0xFA, 0x9D, 0xAA, 0xAA, 0xDA, 0xAC, 0x49, 0xC9, 0xD4, 0xAC, 0x09, 0x94, 0x99,
+    0x00, 0x09, 0x29, 0x29, 0xAC, 0x1D, 0x1D, 0x0F, 0xF2, 0x99, 0x19, 0x91, 0x73, 0xDA, 0x2E, 0x1A,
+    0xDA, 0x9E, 0x3F, 0xD4, 0x9F, 0x30, 0x75, 0x9F, 0xC4, 0xFD, 0x91, 0x9E, 0x1E, 0x1D, 0xA2, 0x9D,
+    0x90, 0x72, 0xD9, 0x2D, 0xA0, 0xEA, 0xAE, 0x19, 0xFD, 0xA2, 0x9A, 0xDA, 0x91, 0x73, 0x9F, 0xC2,
+    0xAF, 0xE1, 0xDA, 0x99, 0xAD, 0x99, 0xCA, 0x3D, 0x90, 0x19, 0xDA, 0x2D, 0x19, 0xFC, 0xAD, 0xA1,
+    0xDA, 0xAF, 0xC2, 0xCA, 0x2A, 0xCA, 0x20, 0x09, 0xAA, 0xAA, 0xAA, 0xA0, 0xFE, 0xA0, 0xFE, 0x90,
+    0x0F, 0xFD, 0xA9, 0xFF, 0xDA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xD2, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0x7F, 0xFD, 0x91, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x19, 0xDA, 0x2D, 0x19, 0xFC,
+    0xAD, 0xA1, 0xEA, 0xFC, 0x2D, 0x2A, 0xCA, 0x20, 0x72, 0x9F, 0xFD, 0xAF, 0xFC, 0xA9, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFF, 0xD1,
+    0xFF, 0xFF, 0xD7, 0x74, 0x77, 0xAC, 0xA4, 0x9F, 0x3A, 0xF2, 0xAF, 0x93, 0xEA, 0x59, 0xC7, 0x70,
+    0x73, 0xAD, 0x74, 0xD7, 0x4D, 0xA7, 0x39, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x4D, 0x97, 0x3A, 0xD7,
+    0x4D, 0x74, 0xDA, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD7, 0x4D,
+    0xA7, 0x39, 0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x49, 0x97, 0x40, 0x4D, 0x90, 0xAD, 0x1D, 0x0A, 0xCA,
+    0xAC, 0xA4, 0x0C, 0x94, 0xAA, 0x0C, 0x94, 0xCA, 0x9C, 0x94, 0xC9, 0xAF, 0xF0, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x19, 0x99, 0x99, 0x99, 0x1F, 0xFA, 0x0C, 0x94, 0xC9, 0x9C, 0x49, 0xC0, 0xAC, 0xAA,
+    0xAA, 0xAD, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0x91, 0x99, 0x1A, 0xFE, 0xA9, 0xC1, 0xAC,
+    0x1A, 0xC9, 0x92, 0x92, 0x90, 0x7A, 0xC0, 0xAC, 0x19, 0xE9, 0x2D, 0xA1, 0x9C, 0xAA, 0xC9, 0x19,
+    0x19, 0x10, 0x3A, 0x91, 0x9D, 0x91, 0xD3, 0xD3, 0x9C, 0x93, 0xCA, 0x1A, 0xD2, 0xA9, 0x20, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x97, 0x5A, 0xFF, 0xC9, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x5A, 0xE2, 0xEA, 0x2E, 0x29, 0xD9, 0x70, 0xAE, 0x90, 0x9E, 0x91,
+    0xE9, 0x1A, 0xD3, 0x19, 0xDA, 0x2D, 0x19, 0xFC, 0xAD, 0xA1, 0xEA, 0xFC, 0x2D, 0x2A, 0xCA, 0x20,
+    0x09, 0x91, 0xAE, 0x09, 0xAD, 0x91, 0xD1, 0x9C, 0x95, 0x59, 0x99, 0x94, 0xAC, 0x90, 0x9E, 0xA0,
+    0xAA, 0x09, 0xE0, 0xAE, 0x0E, 0x9A, 0xDA, 0x0E, 0x1E, 0x19, 0x90, 0x9D, 0x39, 0x10, 0x19, 0x92,
+    0xAD, 0x91, 0xE9, 0x1F, 0x19, 0xE0, 0x74, 0xAF, 0xFC, 0xA0, 0xD9, 0x99, 0x99, 0x9A, 0xC9, 0x0C,
+    0xA5, 0xAC, 0x1C, 0x95, 0xAC, 0x74, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD1, 0x99, 0x99,
+    0x99, 0x99, 0x97, 0x5A, 0xFF, 0xC9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x19, 0x29, 0x1D, 0x90,
+    0xDA, 0x9D, 0x1D, 0x9A, 0xD0, 0x9D, 0x0E, 0x09, 0xD7, 0x00, 0x09, 0xAA, 0xA9, 0x0F, 0x92, 0x9C,
+    0x92, 0xAC, 0x3D, 0x00, 0x74, 0x90, 0xAA, 0x09, 0x90, 0x9F, 0x90, 0xC9, 0x0D, 0xAF, 0xC0, 0x9C,
+    0x0A, 0xC9, 0xCA, 0x49, 0x94, 0x49, 0x97, 0x9D, 0xA6, 0x9D, 0xA5, 0x99, 0x99, 0x19, 0x2F, 0x1D,
+    0x1A, 0xC9, 0xFC, 0x91, 0xC9, 0x19, 0xAC, 0x94, 0x9D, 0x7E, 0x96, 0x9D, 0x40, 0x29, 0x93, 0xA2,
+    0xAF, 0x9D, 0x19, 0xC9, 0x9F, 0x39, 0x29, 0x94, 0xE9, 0x09, 0xC9, 0x1F, 0xEA, 0x2C, 0x2A, 0xCA,
+    0x20, 0x74, 0xA1, 0x9A, 0x29, 0xDA, 0xAD, 0xA1, 0xFF, 0x2A, 0xA1, 0xC9, 0x73, 0x59, 0xCA, 0x09,
+    0xE9, 0x0A, 0xC2, 0xD2, 0xCA, 0x10, 0xF2, 0xF2, 0xFC, 0xAA, 0x92, 0x9A, 0xA9, 0x29, 0xAA, 0xD9,
+    0x75, 0x9D, 0x93, 0x99, 0xAA, 0x99, 0x39, 0xC4, 0x99, 0x91, 0x99, 0x97, 0x09, 0xA5, 0xA9, 0x69,
+    0x97, 0x99, 0x2C, 0x90, 0x99, 0x79, 0x90, 0x9D, 0x90, 0xA7, 0x1A, 0x09, 0xD9, 0x0A, 0x71, 0xA0,
+    0x9D, 0x97, 0x39, 0x09, 0xC2, 0xAA, 0x79, 0xA6, 0x99, 0x59, 0x97, 0x99, 0x93, 0x99, 0x93, 0xC9,
+    0x3A, 0x9A, 0xA9, 0xA3, 0x9D, 0x97, 0x59, 0xDA, 0x99, 0x29, 0x99, 0x92, 0x99, 0xAF, 0xC2, 0xF2,
+    0xF0, 0xA3, 0xAC, 0xA9, 0x19, 0xD0, 0x9E, 0x0C, 0xA7, 0x19, 0x90, 0xDA, 0x9C, 0xA0, 0xAC, 0x90,
+    0xAD, 0x1D, 0x40, 0x49, 0x94, 0x9F, 0xC9, 0x19, 0xEA, 0xE1, 0xD9, 0x2A, 0xC9, 0x0C, 0xA0, 0xDA,
+    0x9C, 0x92, 0x9D, 0xA6, 0xAC, 0x30, 0x49, 0xC0, 0xC9, 0x9E, 0x90, 0xE0, 0xAC, 0xAC, 0xA0, 0x90,
+    0x90, 0x2A, 0x99, 0xE0, 0xAC, 0xA1, 0x9A, 0xD3, 0xA9, 0x0C, 0x92, 0xAD, 0xA1, 0x9D, 0x0A, 0xDA,
+    0x0C, 0x91, 0xC9, 0x3A, 0xA1, 0x9D, 0xA1, 0xD9, 0x2D, 0x99, 0xDA, 0x09, 0xDA, 0x0C, 0xA9, 0xC0,
+    0xC9, 0x19, 0xC1, 0xC9, 0x5A, 0xCA, 0x19, 0xD2, 0xD1, 0xAD, 0x09, 0xD6, 0x49, 0xE0, 0xF0, 0xF1,
+    0xAA, 0x10, 0x7A, 0xC2, 0xCA, 0xD9, 0x0A, 0xDA, 0x90, 0xAE, 0x19, 0xA9, 0xA0, 0x69, 0x2F, 0xAE,
+    0x99, 0xC1, 0xD1, 0xAC, 0xAA, 0x1A, 0xC1, 0x9C, 0x9C, 0x99, 0xD9, 0x9C, 0xA0, 0xAD, 0xA9, 0xDA,
+    0x00, 0x0A, 0x29, 0xC2, 0xAE, 0xA9, 0x99, 0xC9, 0x2C, 0x50, 0xDA, 0x74, 0xDA, 0x09, 0xE7, 0x1A,
+    0xE2, 0xAF, 0xAA, 0x99, 0xAA, 0xFA, 0x49, 0xFF, 0xF9, 0x79, 0xAF, 0xDA, 0x95, 0x0D, 0x97, 0x39,
+    0xD9, 0x0E, 0xA7, 0x09, 0xE9, 0x2F, 0xCA, 0x99, 0x9A, 0xAF, 0x94, 0xAF, 0xFE, 0xA7, 0x09, 0xAF,
+    0xCA, 0xA5, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xA9, 0xFF, 0xF9, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xA0, 0xFF, 0xF9, 0x2A, 0xFA, 0xA9, 0x6D, 0x2F, 0xFF,
+    0xAA, 0xAD, 0xA1, 0xEA, 0x9A, 0xAF, 0xFD, 0xA2, 0xCA, 0x79, 0xAA, 0xDA, 0x92, 0x79, 0x99, 0x99,
+    0x72, 0x9A, 0xFF, 0xCA, 0x6F, 0xFF, 0xD9, 0x3F, 0x95, 0x9A, 0xE2, 0xE7, 0x3E, 0x09, 0x99, 0x75,
+    0x99, 0x00, 0x77, 0x77, 0x4A, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x19, 0xFF,
+    0xFF, 0xDA, 0x77, 0x0A, 0xC9, 0x77, 0x19, 0x30, 0x70, 0xDA, 0xC9, 0x0D, 0x9A, 0xC0, 0x9C, 0x90,
+    0xAC, 0x09, 0xC9, 0x0D, 0x09, 0xFA, 0x19, 0xA0, 0xA1, 0x70, 0xAE, 0x1A, 0xC9, 0x9C, 0x90, 0xDA,
+    0xCA, 0x1C, 0xA9, 0x3D, 0xAA, 0x92, 0x9A, 0x91, 0x69, 0xC9, 0x29, 0x2D, 0x2C, 0xA1, 0x9C, 0x91,
+    0xAC, 0x2D, 0x29, 0x91, 0x70, 0xE9, 0x1D, 0x0A, 0xC0, 0x9C, 0x90, 0xAC, 0x09, 0xC9, 0x0D, 0x1D,
+    0xAC, 0x92, 0xAA, 0x20, 0x0A, 0xC1, 0xC9, 0x0D, 0x09, 0xC9, 0x0C, 0xA0, 0xAC, 0x09, 0xC9, 0x0D,
+    0x09, 0xFA, 0x19, 0xA0, 0x91, 0x69, 0xE0, 0x9C, 0xA0, 0x90, 0xAC, 0x3D, 0x3A, 0xCA, 0xA9, 0x19,
+    0xA9, 0x10, 0x74, 0xAC, 0x5C, 0xA2, 0xDA, 0xC9, 0x1D, 0x0A, 0xC1, 0x9C, 0x90, 0xAC, 0x19, 0xC9,
+    0x0D, 0x19, 0xFA, 0x29, 0xA0, 0x92, 0x70, 0xCA, 0x39, 0xC9, 0x3A, 0xCA, 0xD1, 0xD9, 0xAC, 0x1C,
+    0xA0, 0xAC, 0x09, 0xC9, 0x0D, 0x0A, 0xC1, 0xCA, 0x09, 0x91, 0xA1, 0x72, 0x9C, 0x9D, 0x9D, 0xA0,
+    0xAC, 0xA9, 0xD0, 0xD0, 0xD0, 0x9C, 0x90, 0xD0, 0xCA, 0x0A, 0xC1, 0xCA, 0x0C, 0x90, 0xD0, 0x9C,
+    0x90, 0xA1, 0x99, 0x09, 0xA0, 0x6A, 0xCA, 0xC1, 0xDA, 0x91, 0xCA, 0x29, 0xC9, 0x2A, 0xC3, 0x99,
+    0x30, 0x6C, 0xA1, 0xF0, 0xAC, 0x2D, 0x2C, 0xA2, 0xDA, 0x19, 0xA9, 0x00, 0xCA, 0x1C, 0xAA, 0xC0,
+    0xAC, 0x0A, 0xC0, 0xC9, 0x09, 0xCA, 0xC1, 0x9D, 0x3A, 0x92, 0x1A, 0xC0, 0x9C, 0xA2, 0xCA, 0xCA,
+    0x3A, 0xCA, 0x39, 0xE2, 0x9C, 0xA9, 0xC9, 0x19, 0x91, 0xA9, 0x00, 0x70, 0x9F, 0x97, 0x2F, 0xCA,
+    0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79, 0xE1, 0xE7, 0xEA,
+    0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE, 0xA3, 0xAF, 0xFE,
+    0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E, 0xA6, 0x9E, 0x00,
+    0x3A, 0xFD, 0xA9, 0x6F, 0xFD, 0x94, 0xFF, 0xE3, 0x9E, 0xA9, 0x99, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A,
+    0xE3, 0xAE, 0x3F, 0x29, 0xEA, 0x3F, 0xFE, 0x39, 0xFF, 0xC9, 0x4A, 0xFF, 0xCA, 0x4F, 0x19, 0xAE,
+    0xA3, 0xF3, 0xF3, 0xEA, 0x3F, 0x29, 0xE9, 0x3F, 0x2A, 0xE2, 0x9F, 0xA2, 0xFF, 0xF3, 0xFF, 0xE4,
+    0xFF, 0xA9, 0x40, 0x3A, 0xFF, 0xC4, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9,
+    0x71, 0xAE, 0x72, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0x72, 0xEA, 0x71,
+    0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x71, 0x71, 0xFA, 0x72, 0xAF, 0xC7, 0x2F,
+    0xD7, 0x1E, 0xAE, 0x70, 0x9E, 0x0E, 0x97, 0xEA, 0x0E, 0x96, 0x9E, 0x1E, 0xA6, 0xEA, 0x1A, 0xDA,
+    0x5A, 0xE2, 0xAE, 0x5E, 0xA2, 0xAE, 0x4A, 0xE3, 0x9E, 0x4E, 0x93, 0x9E, 0x3F, 0x5E, 0x91, 0x9E,
+    0x95, 0xE9, 0x1F, 0x6E, 0xA0, 0x9F, 0xFF, 0xE0, 0xFF, 0xFF, 0x0F, 0xFF, 0xEA, 0x3A, 0xFF, 0xC9,
+    0x3F, 0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xFF,
+    0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99, 0x4F, 0x72, 0xEA, 0x71, 0x9E, 0x97,
+    0x1A, 0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD3, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0x9F,
+    0xFE, 0x49, 0x99, 0x99, 0x9F, 0x97, 0x1A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0xFA,
+    0x71, 0xAF, 0x71, 0x9F, 0x72, 0xF7, 0x2F, 0x97, 0x1A, 0xEA, 0x71, 0x9F, 0x72, 0xFF, 0xEA, 0x29,
+    0xFF, 0xEA, 0x2A, 0xFF, 0xE9, 0x20, 0x3A, 0xE5, 0xE9, 0x3F, 0x49, 0xE9, 0x3E, 0xA4, 0xAE, 0x39,
+    0xEA, 0x4F, 0x39, 0xE9, 0x4E, 0xA3, 0xAE, 0x49, 0xE9, 0x3F, 0x49, 0xE9, 0x3F, 0xFF, 0xC3, 0x9F,
+    0xFF, 0xC3, 0xAF, 0xFF, 0xA3, 0xF9, 0x99, 0x99, 0xAE, 0x93, 0xF4, 0xAE, 0x4E, 0xA4, 0xF3, 0x9E,
+    0x94, 0xF3, 0xAE, 0x5E, 0xA3, 0xF4, 0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xEA, 0x4F, 0x30, 0x77, 0x69,
+    0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A,
+    0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x09, 0xAA, 0xAA, 0x09, 0xE9, 0x0E, 0xA0, 0xFC, 0x09, 0xE9,
+    0x9E, 0x90, 0xFC, 0x0A, 0xE9, 0xAE, 0x90, 0x99, 0x99, 0x90, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9,
+    0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F,
+    0xDA, 0x77, 0x60, 0x3F, 0xEA, 0x3F, 0xEA, 0x3F, 0xDA, 0x5A, 0xE7, 0xF7, 0xEA, 0x7E, 0x96, 0x9E,
+    0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0xF5, 0x9F, 0xCA, 0x39, 0xFE, 0x92,
+    0xAF, 0xE9, 0x20, 0x3A, 0xE4, 0xF4, 0xF3, 0xF9, 0x4E, 0xA2, 0xAE, 0xA4, 0x9E, 0x91, 0xAF, 0x59,
+    0xE1, 0x9F, 0x6A, 0xE1, 0xF7, 0xF0, 0xF9, 0x7E, 0xAF, 0x97, 0x9F, 0xEA, 0x70, 0xAF, 0xEA, 0x70,
+    0xFF, 0xC7, 0x0F, 0x0A, 0xE9, 0x7E, 0xA1, 0xF6, 0x9E, 0x91, 0xF6, 0xAE, 0x29, 0xEA, 0x5F, 0x3F,
+    0x5E, 0xA3, 0xAE, 0x94, 0xE9, 0x39, 0xEA, 0x30, 0x70, 0xAF, 0x72, 0xFC, 0x71, 0xAF, 0xC7, 0x1F,
+    0xD7, 0x0A, 0xFD, 0x70, 0xE9, 0xE9, 0x6A, 0xE0, 0xE9, 0x6E, 0xA0, 0xEA, 0x5A, 0xE1, 0xEA, 0x5E,
+    0xA1, 0xAD, 0xA4, 0xAE, 0x2A, 0xE4, 0xEA, 0x2A, 0xE3, 0xAE, 0x39, 0xE3, 0xEA, 0x39, 0xE2, 0xAE,
+    0x49, 0xE2, 0xEA, 0x49, 0xE9, 0x0A, 0xE6, 0xE9, 0x9E, 0xA6, 0xE9, 0x3A, 0xF9, 0x6F, 0xC4, 0xFC,
+    0x95, 0xAF, 0xC4, 0xFC, 0x95, 0xFC, 0xA3, 0x9F, 0xCA, 0x4A, 0xFC, 0x93, 0x9F, 0xCA, 0x4F, 0xD4,
+    0xAD, 0xAD, 0xA3, 0xAD, 0xAE, 0x4E, 0x9D, 0xA3, 0xEA, 0xE4, 0xE0, 0xE2, 0xAD, 0x9E, 0xA3, 0x9E,
+    0x0E, 0x2E, 0x0E, 0x93, 0xAE, 0x0E, 0x1A, 0xD0, 0x9E, 0x4E, 0xA0, 0xE0, 0x9D, 0xA0, 0xAE, 0x4E,
+    0x90, 0xE0, 0xE1, 0xAD, 0xA4, 0xE1, 0xE9, 0xDA, 0x1E, 0xA3, 0x9E, 0x1A, 0xFC, 0x2E, 0x93, 0xAD,
+    0xA1, 0xAF, 0xA1, 0x9E, 0x4E, 0xA1, 0xAF, 0x2A, 0xE4, 0xE9, 0x1A, 0xEA, 0x2E, 0xA4, 0xE2, 0x9E,
+    0x3E, 0x93, 0x3A, 0xEA, 0x59, 0xE4, 0xFC, 0x5A, 0xE4, 0xFC, 0x94, 0xEA, 0x39, 0xFD, 0x4E, 0x93,
+    0xAF, 0xD3, 0x9E, 0x4A, 0xDA, 0xE9, 0x2A, 0xE4, 0xE9, 0xAE, 0x2A, 0xDA, 0x4E, 0x09, 0xE2, 0xEA,
+    0x39, 0xE1, 0xE9, 0x1E, 0x93, 0xAE, 0x1F, 0x09, 0xE4, 0xEA, 0x19, 0xE0, 0xAE, 0x4E, 0x92, 0xE9,
+    0xAD, 0xA4, 0xE3, 0xFE, 0x93, 0x9E, 0x39, 0xFD, 0x93, 0xAE, 0x4F, 0xD4, 0xEA, 0x4F, 0xD4, 0xE9,
+    0x4A, 0xFA, 0x39, 0xE6, 0xF9, 0x30, 0x3A, 0xFF, 0xC4, 0xFF, 0xD4, 0xFF, 0xD4, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0x77, 0x77, 0x72, 0xFE, 0xA5, 0x9F, 0xEA, 0x5A, 0xFE, 0x96, 0x99, 0x99, 0x99, 0x97,
+    0x77, 0x77, 0x77, 0x79, 0xFF, 0xDA, 0x2A, 0xFF, 0xD9, 0x2F, 0xFE, 0x30, 0x77, 0x69, 0xFC, 0xA9,
+    0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A,
+    0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0,
+    0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE,
+    0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x3A, 0xFF, 0xF9, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF,
+    0xC3, 0x9E, 0xA9, 0x99, 0x99, 0xF3, 0x9E, 0x94, 0xEA, 0x3A, 0xE4, 0x9E, 0xA3, 0xF4, 0x9E, 0x93,
+    0xEA, 0x4A, 0xE3, 0x9E, 0x94, 0xF3, 0xAE, 0x5E, 0xA3, 0xF4, 0x9E, 0x93, 0xF4, 0xAE, 0x93, 0xEA,
+    0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xEA, 0x3F, 0x49, 0xE9, 0x3E, 0xA4, 0xAE, 0x4E, 0xA4, 0xF3,
+    0x3A, 0xFD, 0xA9, 0x6F, 0xFD, 0x5F, 0xFD, 0xA3, 0x9E, 0xA9, 0x9A, 0xF3, 0x9E, 0x3A, 0xE9, 0x2A,
+    0xE3, 0x9E, 0x92, 0xF3, 0xAE, 0x92, 0xEA, 0x3F, 0x29, 0xEA, 0x99, 0xAF, 0xA2, 0xAF, 0xFD, 0xA3,
+    0xFF, 0xD9, 0x4F, 0xAA, 0xAA, 0x96, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3F, 0x73, 0xEA, 0x73,
+    0xE9, 0x72, 0x39, 0xFF, 0xD9, 0x3A, 0xFF, 0xD9, 0x3F, 0xFE, 0x4A, 0xE9, 0x09, 0x99, 0x99, 0x5E,
+    0x97, 0x3F, 0x73, 0x9E, 0x97, 0x3F, 0x73, 0xAE, 0x73, 0xEA, 0x72, 0xEA, 0x72, 0xF7, 0x2F, 0x72,
+    0xF7, 0x2A, 0xE9, 0x71, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0xAF, 0xFE, 0x92, 0x9F, 0xFF, 0x0A,
+    0xFF, 0xF0, 0xFF, 0xFA, 0x09, 0x99, 0x9F, 0x99, 0x99, 0x5F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A,
+    0xE7, 0x1F, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x1F, 0x70, 0x9E, 0xA7,
+    0x09, 0xE9, 0x70, 0xAE, 0x70, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F,
+    0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7,
+    0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x70,
+    0x77, 0x76, 0xAE, 0x77, 0x0E, 0xA7, 0x39, 0xAF, 0xFC, 0xA6, 0x9F, 0xFF, 0xDA, 0x39, 0xFF, 0xFF,
+    0x91, 0x9F, 0x91, 0xAE, 0x19, 0xF1, 0xF3, 0xEA, 0x2A, 0xE1, 0xE9, 0x3E, 0x92, 0x9E, 0x99, 0xE3,
+    0x9E, 0x39, 0xE9, 0xAE, 0x39, 0xE3, 0x9E, 0x0A, 0xE3, 0xAD, 0xA3, 0xF0, 0x9E, 0xA2, 0xEA, 0x2A,
+    0xE9, 0x1F, 0xA9, 0x9E, 0x99, 0xAF, 0xA2, 0x9F, 0xFF, 0xEA, 0x49, 0xFF, 0xFC, 0x97, 0x9A, 0xAF,
+    0xAA, 0x97, 0x5E, 0x97, 0x70, 0xE7, 0x71, 0x99, 0x97, 0x20, 0x4E, 0xA4, 0x9E, 0xA5, 0xF4, 0xF6,
+    0x9E, 0x92, 0xF9, 0x7E, 0xA1, 0x9E, 0xA7, 0x0F, 0x1F, 0x71, 0x9E, 0x9F, 0x73, 0xFE, 0x97, 0x3F,
+    0xDA, 0x74, 0xAF, 0xC7, 0x5F, 0xD7, 0x4F, 0xE7, 0x3A, 0xEA, 0xE9, 0x71, 0x9E, 0xA0, 0xF7, 0x1F,
+    0x1A, 0xE7, 0x0F, 0x91, 0x9E, 0xA6, 0xAE, 0xA3, 0xF5, 0x9F, 0x4F, 0x94, 0xF5, 0x9E, 0xA3, 0x1A,
+    0xDA, 0x2A, 0xDA, 0x29, 0xE2, 0xEA, 0x2E, 0xA2, 0xAE, 0x2E, 0x92, 0xE9, 0x2E, 0xA1, 0x9E, 0x29,
+    0xE9, 0x2E, 0x91, 0xAE, 0x2A, 0xE2, 0x9E, 0x2E, 0xA2, 0xAE, 0x2A, 0xE2, 0xEA, 0x2E, 0xA2, 0xF2,
+    0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x91, 0x9E, 0x2A, 0xE3, 0xF1, 0xAE, 0x1A, 0xEA, 0x3F, 0xFF, 0xF4,
+    0x9F, 0xFF, 0xD9, 0x59, 0xFF, 0xEA, 0x72, 0x9A, 0xE9, 0x97, 0x6A, 0xE7, 0x70, 0xEA, 0x77, 0x0E,
+    0x97, 0x79, 0xE9, 0x72, 0x77, 0x71, 0x9A, 0xFC, 0xA9, 0x70, 0xAF, 0xFC, 0xA6, 0xFF, 0xF9, 0x4A,
+    0xF9, 0x2A, 0xF3, 0x9F, 0x5F, 0x92, 0xF6, 0xAE, 0x92, 0xF6, 0x9E, 0x91, 0x9E, 0xA6, 0x9E, 0x91,
+    0x9E, 0x96, 0x9E, 0x91, 0x9E, 0x7A, 0xE2, 0x9E, 0x7E, 0xA2, 0x9E, 0x95, 0x9E, 0x4E, 0xA5, 0xEA,
+    0x49, 0xE4, 0xAD, 0xA6, 0xAE, 0x2E, 0xA4, 0xFE, 0x19, 0xFD, 0xA0, 0x9F, 0xDA, 0x1A, 0xFD, 0x90,
+    0x9F, 0xD9, 0x1F, 0xE1, 0x3A, 0xDA, 0x90, 0x9A, 0xA3, 0xFD, 0x9E, 0x2F, 0xFE, 0x1A, 0xF1, 0xFA,
+    0x1F, 0x29, 0xE9, 0x09, 0xE9, 0x29, 0xE1, 0xAE, 0x39, 0xE1, 0xF3, 0xAE, 0x1E, 0xA3, 0xEA, 0x1F,
+    0x29, 0xE9, 0x1F, 0x2F, 0x91, 0xAF, 0xAF, 0xDA, 0x09, 0xFD, 0xAF, 0xA1, 0x9F, 0x1F, 0x97, 0x60,
+    0x77, 0x69, 0xFC, 0xA7, 0xAF, 0xF5, 0xAF, 0xFC, 0xA4, 0xF2, 0xF3, 0x9E, 0x92, 0xF3, 0xAE, 0x3E,
+    0xA3, 0xF2, 0x9E, 0x93, 0xEA, 0x09, 0xAE, 0xA3, 0x9E, 0x9A, 0xF9, 0x4A, 0xE0, 0xAE, 0xA5, 0xF0,
+    0x9A, 0xF4, 0xF3, 0xEA, 0x3E, 0xA3, 0xF2, 0x9E, 0x93, 0xF2, 0xAE, 0x4F, 0x2F, 0x3F, 0xA2, 0xFF,
+    0xF3, 0xFF, 0xE9, 0x29, 0xEA, 0xFD, 0x93, 0xAE, 0x73, 0xF7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0x9E,
+    0x73, 0xAE, 0x73, 0x9A, 0xAA, 0x3A, 0xAA, 0xAA, 0xE3, 0xFA, 0xE3, 0xEA, 0x9E, 0x29, 0xE9, 0x9E,
+    0x2A, 0xE1, 0xE2, 0xF1, 0xE2, 0xE9, 0x1E, 0x1A, 0xE2, 0xE1, 0xE9, 0x2E, 0x0A, 0xE3, 0xAD, 0xAE,
+    0x4A, 0xFC, 0x94, 0xAF, 0x95, 0xAE, 0x96, 0xF7, 0xEA, 0x7E, 0x96, 0x9E, 0x7A, 0xE7, 0x09, 0x97,
+    0x00, 0x77, 0x6A, 0xFC, 0xA7, 0xFF, 0xC5, 0xFC, 0xAE, 0xA5, 0xEA, 0x3C, 0x6E, 0xA7, 0x3F, 0x73,
+    0x9F, 0x97, 0x19, 0xFC, 0x97, 0xFF, 0x59, 0xF9, 0x9F, 0x4F, 0x2F, 0x3A, 0xE9, 0x2A, 0xE9, 0x2F,
+    0x39, 0xE9, 0x2E, 0xA3, 0xAE, 0x3E, 0xA3, 0xF3, 0xF2, 0xAE, 0xA3, 0xAF, 0xAF, 0xC5, 0xFF, 0xC9,
+    0x6A, 0xFC, 0xA7, 0x75, 0x39, 0xAE, 0xA9, 0x3A, 0xFE, 0xA1, 0x9F, 0xF9, 0x1A, 0xE3, 0xA2, 0xAD,
+    0xA7, 0x9E, 0x99, 0x95, 0x9F, 0xC4, 0x9F, 0xCA, 0x3A, 0xEA, 0x99, 0x4E, 0x96, 0x9E, 0x93, 0x91,
+    0x9F, 0xAA, 0xE2, 0xFF, 0xC3, 0xAF, 0xD9, 0x75, 0x2F, 0xFD, 0xA2, 0xFF, 0xD9, 0x2F, 0xFD, 0x70,
+    0xF7, 0x0F, 0x70, 0xF7, 0x9F, 0x79, 0xF7, 0x0F, 0x70, 0xF7, 0x09, 0xE9, 0x70, 0xF7, 0x1E, 0xA7,
+    0x09, 0xEA, 0x70, 0x9E, 0xA7, 0x1F, 0xA7, 0x0F, 0xD9, 0x7F, 0xE7, 0xAF, 0xCA, 0x70, 0xAF, 0x71,
+    0xF7, 0x1F, 0x71, 0xE9, 0x70, 0xAE, 0x77, 0x20, 0x29, 0xAA, 0x19, 0xDA, 0x4E, 0x0F, 0xD3, 0xEA,
+    0xFD, 0xA1, 0x9F, 0xA0, 0x9F, 0x1A, 0xF2, 0xF1, 0xF3, 0xEA, 0x1F, 0x3E, 0x91, 0xEA, 0x29, 0xE9,
+    0x09, 0xE9, 0x2A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x3E, 0x91, 0xE9, 0x29, 0xE1, 0x9E,
+    0x3A, 0xE7, 0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1F, 0x20, 0x77, 0x1A,
+    0xFA, 0x5F, 0xF3, 0xFA, 0xAE, 0xA1, 0x9E, 0x91, 0xF1, 0xF2, 0xAE, 0x09, 0xE9, 0x2A, 0xE0, 0xAE,
+    0x3A, 0xE0, 0xF3, 0xF9, 0xFF, 0xFA, 0xFF, 0xEA, 0xAF, 0xFE, 0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xEA,
+    0x29, 0xEA, 0x0E, 0xA2, 0xAE, 0x1F, 0x19, 0xEA, 0x19, 0xEA, 0xAF, 0x3F, 0xF9, 0x4F, 0xCA, 0x77,
+    0x10, 0x1A, 0xAA, 0xA3, 0xEA, 0x29, 0xE9, 0x29, 0xE9, 0x2A, 0xE3, 0xF3, 0xEA, 0x29, 0xE9, 0x2A,
+    0xE3, 0xF3, 0xF3, 0xFE, 0x0A, 0xFD, 0x1A, 0xFA, 0x70, 0x29, 0xAA, 0xA3, 0xAA, 0xAA, 0x3E, 0xA2,
+    0xF9, 0x3E, 0xA1, 0xF9, 0x39, 0xE9, 0x0F, 0x94, 0xAE, 0x0A, 0xE9, 0x5F, 0xAE, 0x96, 0xFE, 0x97,
+    0xFF, 0x69, 0xFF, 0x6A, 0xE9, 0x9E, 0xA5, 0xF1, 0xF5, 0xEA, 0x19, 0xEA, 0x39, 0xE9, 0x2F, 0x39,
+    0xE3, 0xAE, 0xA2, 0x77, 0x39, 0xFA, 0x71, 0xAF, 0xCA, 0x70, 0xAF, 0xD7, 0x39, 0xE9, 0x73, 0xE9,
+    0x73, 0xEA, 0x72, 0x9F, 0x72, 0xFC, 0x71, 0xAF, 0xC7, 0x1F, 0xD9, 0x7A, 0xDA, 0xE9, 0x7E, 0x0A,
+    0xDA, 0x6E, 0xA0, 0xAD, 0xA5, 0x9E, 0x90, 0xAE, 0x5F, 0x19, 0xE4, 0x9E, 0x91, 0x9E, 0x93, 0xF3,
+    0xFC, 0x1A, 0xE9, 0x3F, 0xC1, 0xF4, 0x9F, 0x77, 0x00, 0x39, 0xAA, 0xA3, 0xAA, 0xA9, 0x3F, 0x3E,
+    0xA3, 0xEA, 0x29, 0xE9, 0x29, 0xE9, 0x2A, 0xE3, 0xAE, 0x3A, 0xE3, 0xAE, 0x3E, 0xA3, 0xF3, 0xEA,
+    0x3E, 0xA2, 0x9E, 0x92, 0x9E, 0x92, 0xF3, 0xAE, 0x3F, 0x3F, 0x91, 0xFC, 0x3F, 0xCA, 0xFE, 0x2F,
+    0xEA, 0xAF, 0x19, 0xEA, 0xDA, 0x1F, 0x1A, 0xE7, 0x3F, 0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7,
+    0x3A, 0xE7, 0x30, 0x9A, 0xAA, 0x3A, 0xAA, 0xAA, 0xE3, 0xEA, 0xAE, 0x3E, 0xA9, 0xE2, 0x9E, 0x99,
+    0xE2, 0xAE, 0x1E, 0x2F, 0x1E, 0x2E, 0x91, 0xE1, 0xAE, 0x2E, 0x1E, 0x92, 0xE0, 0xAE, 0x3A, 0xDA,
+    0xE4, 0xAF, 0xC9, 0x49, 0xF9, 0x59, 0xE9, 0x50, 0x3F, 0xFD, 0x39, 0xFF, 0xD3, 0x9F, 0xEA, 0xA9,
+    0x49, 0xE9, 0x70, 0x9E, 0x72, 0xF7, 0x2F, 0x72, 0xAE, 0xA9, 0x71, 0xAF, 0xE6, 0xAF, 0xDA, 0x49,
+    0xFA, 0x99, 0x94, 0x9E, 0xA7, 0x1F, 0x72, 0xF7, 0x2F, 0x72, 0xFC, 0x71, 0x9F, 0xCA, 0x70, 0xAF,
+    0xD9, 0x79, 0xFD, 0x71, 0x9F, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0xF7, 0x19, 0xE7, 0x74, 0x39,
+    0xAE, 0xA5, 0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4, 0xE9,
+    0xF3, 0x9E, 0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4, 0xAF,
+    0xCA, 0x77, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF, 0xF0, 0xAF,
+    0xFF, 0xF3, 0xEA, 0x2F, 0x6E, 0x92, 0xEA, 0x59, 0xE9, 0x19, 0xE9, 0x5A, 0xE2, 0xAE, 0x6F, 0x2F,
+    0x6E, 0xA2, 0xEA, 0x59, 0xE9, 0x2E, 0xA5, 0xAE, 0x29, 0xE9, 0x5A, 0xE2, 0x9F, 0xAC, 0x3F, 0x3F,
+    0xD3, 0xEA, 0x39, 0xFA, 0x77, 0x40, 0x59, 0xAE, 0xA7, 0xAF, 0xE5, 0xAF, 0xFA, 0x4F, 0x90, 0xF3,
+    0x9E, 0x91, 0x9E, 0x92, 0xF2, 0x9E, 0x92, 0xEA, 0x29, 0xE9, 0x2E, 0xA2, 0xAE, 0x91, 0x9E, 0x92,
+    0xF2, 0xAE, 0x29, 0xF2, 0xF9, 0x1F, 0x92, 0xFF, 0xE3, 0xFF, 0xD9, 0x29, 0xE9, 0xFC, 0x4A, 0xE7,
+    0x2F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x20, 0x4A, 0xEA, 0x93, 0xAF, 0xE2,
+    0xAF, 0xF1, 0x9F, 0x91, 0x99, 0x1F, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xF7, 0xF9, 0x6A, 0xF9, 0x6F,
+    0xCA, 0x94, 0x9F, 0xDA, 0x5A, 0xFC, 0x96, 0xFA, 0x69, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xE9, 0x76,
+    0x59, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xAF, 0xFD, 0xA2, 0xAF, 0xFE, 0x91, 0xAF, 0x90, 0xAD, 0xA4,
+    0xF2, 0x9E, 0x39, 0xE9, 0x3E, 0x92, 0xAE, 0x4E, 0x92, 0xF3, 0x9E, 0x92, 0xF3, 0xAE, 0x3F, 0x3F,
+    0x3A, 0xE2, 0xAE, 0x93, 0x9F, 0xFD, 0x5A, 0xFF, 0x7A, 0xFC, 0x97, 0x75, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xFD, 0xAF, 0xFE, 0x92, 0xAE, 0x96, 0xAE, 0x7E, 0xA7, 0xEA, 0x69, 0xE9, 0x6A,
+    0xE7, 0xF7, 0xF7, 0xFE, 0x4F, 0xE5, 0xFC, 0xA7, 0x60, 0x1A, 0xAA, 0xA3, 0xAA, 0xA2, 0xEA, 0x29,
+    0xE9, 0x09, 0xE9, 0x29, 0xE9, 0x09, 0xE3, 0x9E, 0x90, 0xAE, 0x39, 0xE9, 0x0F, 0x39, 0xE9, 0x0E,
+    0xA3, 0xAE, 0x09, 0xE9, 0x3F, 0x0A, 0xE4, 0xEA, 0x0A, 0xE3, 0xAE, 0x90, 0xAE, 0x29, 0xF1, 0x9F,
+    0xFD, 0x3F, 0xFC, 0x94, 0xAF, 0xCA, 0x77, 0x20, 0x3A, 0x39, 0xAD, 0xA9, 0x5E, 0x90, 0x9F, 0xDA,
+    0x3F, 0xA0, 0xFF, 0x91, 0xAE, 0xA0, 0x9E, 0x1F, 0x1F, 0x1E, 0xA1, 0xAE, 0x09, 0xE9, 0x1E, 0xA1,
+    0xAE, 0x0A, 0xE2, 0xE9, 0x1A, 0xE0, 0xF1, 0x9E, 0x2F, 0x0F, 0x1A, 0xE1, 0x9E, 0xA0, 0xAE, 0x1E,
+    0xA1, 0xF9, 0x09, 0xEA, 0x0E, 0x90, 0xFC, 0x2F, 0xFF, 0xD3, 0x9F, 0xFE, 0xA6, 0xAF, 0xEA, 0x97,
+    0x1E, 0xA7, 0x5E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5F, 0x75, 0xEA, 0x71, 0x3A, 0xCA, 0x95, 0xAA,
+    0xA9, 0x29, 0xF9, 0x3A, 0xE3, 0xAF, 0xC3, 0xE9, 0x39, 0x9A, 0xE2, 0xEA, 0x7E, 0x90, 0x9E, 0x70,
+    0xEA, 0x0E, 0x97, 0x0A, 0xFD, 0xA7, 0x19, 0xFD, 0x73, 0xFC, 0x74, 0xF9, 0x74, 0xF7, 0x4A, 0xF7,
+    0x4F, 0xC9, 0x72, 0xFD, 0xA7, 0x1A, 0xEA, 0xE7, 0x09, 0xE0, 0x9E, 0x97, 0xEA, 0x1F, 0x6A, 0xE2,
+    0xAF, 0xC3, 0x9E, 0x92, 0x9F, 0xA3, 0xEA, 0x4A, 0xE9, 0x77, 0x40, 0x70, 0x9E, 0x76, 0xAE, 0x76,
+    0xF7, 0x6E, 0xA7, 0x6E, 0x97, 0xAA, 0xAA, 0x19, 0xE1, 0x9A, 0xAA, 0x2E, 0xA1, 0xAE, 0x1A, 0xE1,
+    0x9E, 0x91, 0xEA, 0x1A, 0xE1, 0x9E, 0x2E, 0x91, 0xAE, 0x1A, 0xE1, 0x9E, 0x91, 0xAE, 0x1F, 0x1A,
+    0xE2, 0xF1, 0xEA, 0x1A, 0xE2, 0xEA, 0x09, 0xE9, 0x1E, 0xA1, 0x9E, 0x90, 0xAE, 0x2E, 0x91, 0xAE,
+    0x1A, 0xE1, 0x9E, 0x2F, 0x1A, 0xE9, 0x0A, 0xE1, 0xF2, 0x9F, 0xFF, 0xD9, 0x3A, 0xFF, 0xF9, 0x59,
+    0xFF, 0xC9, 0x72, 0xAE, 0x97, 0x5A, 0xE7, 0x6E, 0xA7, 0x6E, 0xA7, 0x59, 0xE9, 0x75, 0x9E, 0x72,
+    0x3A, 0xAA, 0x96, 0xAA, 0xA4, 0xAD, 0xA7, 0xE9, 0x2A, 0xE7, 0x0A, 0xE2, 0xE9, 0x70, 0x9E, 0x1A,
+    0xE3, 0x99, 0x92, 0x9E, 0x1E, 0x92, 0x9D, 0xA2, 0x9E, 0x09, 0xE3, 0xAD, 0x92, 0x9E, 0x09, 0xE3,
+    0xE9, 0x2A, 0xE0, 0xAE, 0x3E, 0x3E, 0xA0, 0xAE, 0x29, 0xE3, 0xE9, 0x09, 0xE2, 0xF2, 0xF2, 0xFA,
+    0xFD, 0xAF, 0x92, 0xAF, 0xD0, 0xFE, 0xA4, 0xAF, 0x2F, 0xC9, 0x77, 0x70, 0x70, 0x9F, 0x97, 0x2F,
+    0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9, 0x9E, 0x79, 0xE1, 0xE7,
+    0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9, 0x4F, 0xFE, 0xA3, 0xAF,
+    0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6, 0xAE, 0x1E, 0xA6, 0x9E,
+    0x77, 0x70, 0x99, 0x75, 0xEA, 0x73, 0x9E, 0xA7, 0x4E, 0x97, 0x59, 0x70, 0x39, 0xDA, 0x90, 0x9A,
+    0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9,
+    0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF,
+    0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x74, 0x97, 0x29, 0xE7, 0x1F, 0x71, 0xAE, 0x73, 0x97,
+    0x00, 0x71, 0x9E, 0xA7, 0x39, 0xFA, 0x73, 0x99, 0xE7, 0x49, 0xDA, 0x73, 0xEA, 0x74, 0xD9, 0x77,
+    0x74, 0x9F, 0x97, 0x2F, 0xCA, 0x71, 0x9F, 0xCA, 0x71, 0xEA, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xE9,
+    0x9E, 0x79, 0xE1, 0xE7, 0xEA, 0x1E, 0x6A, 0xE2, 0xE6, 0xEA, 0x2E, 0x94, 0xAE, 0xA9, 0x99, 0xE9,
+    0x4F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x2A, 0xE5, 0xAE, 0x2E, 0xA5, 0xAE, 0x1A, 0xE6,
+    0xAE, 0x1E, 0xA6, 0x9E, 0x00, 0x59, 0xAA, 0xA7, 0x1F, 0xC7, 0x09, 0x9A, 0xD9, 0x71, 0xAD, 0x97,
+    0x0E, 0xA7, 0x09, 0xD7, 0x76, 0x9D, 0xA9, 0x09, 0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9,
+    0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E, 0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3,
+    0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF, 0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77,
+    0x00, 0x77, 0x19, 0xAA, 0x77, 0x1A, 0xD9, 0x72, 0x9F, 0x09, 0xD9, 0x72, 0x9F, 0xCA, 0x09, 0x73,
+    0x9D, 0xA0, 0x9D, 0x75, 0xAA, 0x92, 0x9A, 0x97, 0x77, 0x73, 0x9F, 0x97, 0x7F, 0xCA, 0x76, 0x9F,
+    0xCA, 0x76, 0xEA, 0xDA, 0x75, 0x9E, 0x9E, 0x75, 0xE9, 0x9E, 0x74, 0x9E, 0x1E, 0x74, 0xEA, 0x1E,
+    0x73, 0xAE, 0x2E, 0x73, 0xEA, 0x2E, 0x97, 0x1A, 0xEA, 0x99, 0x9E, 0x97, 0x1F, 0xFE, 0xA7, 0x0A,
+    0xFF, 0xEA, 0x70, 0xFF, 0xFC, 0x7A, 0xE5, 0xAE, 0x7E, 0xA5, 0xAE, 0x6A, 0xE6, 0xAE, 0x6E, 0xA6,
+    0x9E, 0x50, 0x75, 0x99, 0x97, 0x4A, 0xD9, 0x5A, 0xEA, 0x0A, 0xD6, 0xAF, 0xC0, 0x99, 0x69, 0xDA,
+    0x0D, 0xA7, 0x9D, 0x92, 0xD7, 0x77, 0x19, 0xDA, 0x90, 0x9A, 0xA9, 0x5F, 0xD9, 0xE5, 0xFF, 0xE4,
+    0x9F, 0x90, 0xFC, 0x4F, 0x29, 0xEA, 0x39, 0xEA, 0x29, 0xE9, 0x3A, 0xE9, 0x29, 0xE4, 0xF3, 0xAE,
+    0x4F, 0x3E, 0xA4, 0xF2, 0x9E, 0xA4, 0xF2, 0xF9, 0x4A, 0xFF, 0xD6, 0xFD, 0xAE, 0x69, 0xF9, 0x9D,
+    0xA7, 0x76, 0x49, 0xAA, 0x76, 0xDA, 0x75, 0x9D, 0x09, 0xF7, 0x19, 0x9F, 0xCA, 0x70, 0x9D, 0xA0,
+    0x9D, 0x70, 0xAA, 0x92, 0x9A, 0x97, 0x77, 0x19, 0xF9, 0x72, 0xFC, 0xA7, 0x19, 0xFC, 0xA7, 0x1E,
+    0xAD, 0xA7, 0x09, 0xE9, 0xE7, 0x0E, 0x99, 0xE7, 0x9E, 0x1E, 0x7E, 0xA1, 0xE6, 0xAE, 0x2E, 0x6E,
+    0xA2, 0xE9, 0x4A, 0xEA, 0x99, 0x9E, 0x94, 0xFF, 0xEA, 0x3A, 0xFF, 0xEA, 0x3F, 0xFF, 0xC2, 0xAE,
+    0x5A, 0xE2, 0xEA, 0x5A, 0xE1, 0xAE, 0x6A, 0xE1, 0xEA, 0x69, 0xE0, 0x09, 0x99, 0x72, 0xAD, 0x73,
+    0xAC, 0xA0, 0xAE, 0xA5, 0x99, 0xAF, 0xC6, 0x9D, 0xA0, 0xDA, 0x49, 0xD9, 0x2D, 0x77, 0x39, 0xDA,
+    0x90, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA,
+    0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9,
+    0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x77, 0xAD, 0x97, 0x79, 0xAD, 0x77,
+    0x09, 0xCA, 0x71, 0xAF, 0x0A, 0xC9, 0x71, 0x9F, 0xCA, 0x09, 0x71, 0x9D, 0xA0, 0xAD, 0x73, 0xAA,
+    0x3A, 0xA9, 0x77, 0x77, 0x9F, 0x97, 0x5F, 0xCA, 0x74, 0x9F, 0xCA, 0x74, 0xEA, 0xDA, 0x73, 0x9E,
+    0x9E, 0x73, 0xE9, 0x9E, 0x72, 0x9E, 0x1E, 0x72, 0xEA, 0x1E, 0x71, 0xAE, 0x2E, 0x71, 0xEA, 0x2E,
+    0x97, 0xAE, 0xA9, 0x99, 0xE9, 0x7F, 0xFE, 0xA6, 0xAF, 0xFE, 0xA6, 0xFF, 0xFC, 0x5A, 0xE5, 0xAE,
+    0x5E, 0xA5, 0xAE, 0x4A, 0xE6, 0xAE, 0x4E, 0xA6, 0x9E, 0x30, 0x73, 0xAC, 0xA7, 0x4E, 0x97, 0x49,
+    0xC9, 0x5A, 0xEA, 0x0D, 0xA5, 0xAF, 0xC0, 0xA9, 0x5A, 0xDA, 0x0D, 0xA6, 0x9D, 0x3D, 0x77, 0x79,
+    0xDA, 0x90, 0x9A, 0xA9, 0x4F, 0xD9, 0xE4, 0xFF, 0xE3, 0x9F, 0x90, 0xFC, 0x3F, 0x29, 0xEA, 0x29,
+    0xEA, 0x29, 0xE9, 0x2A, 0xE9, 0x29, 0xE3, 0xF3, 0xAE, 0x3F, 0x3E, 0xA3, 0xF2, 0x9E, 0xA3, 0xF2,
+    0xF9, 0x3A, 0xFF, 0xD5, 0xFD, 0xAE, 0x59, 0xF9, 0x9D, 0xA7, 0x74, 0x77, 0x97, 0x19, 0xEA, 0x9A,
+    0xC9, 0x70, 0xDA, 0xFC, 0x71, 0xA9, 0x19, 0xA9, 0x73, 0x9E, 0xA7, 0x39, 0xFC, 0x97, 0x19, 0xDA,
+    0x0E, 0x71, 0xAA, 0x92, 0xAA, 0x97, 0x77, 0x39, 0xF9, 0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x2E,
+    0xAD, 0xA7, 0x19, 0xE9, 0xE7, 0x1E, 0x99, 0xE7, 0x09, 0xE1, 0xE7, 0x0E, 0xA1, 0xE7, 0xAE, 0x2E,
+    0x7E, 0xA2, 0xE9, 0x5A, 0xEA, 0x99, 0x9E, 0x95, 0xFF, 0xEA, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC3,
+    0xAE, 0x5A, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x6A, 0xE2, 0xEA, 0x69, 0xE1, 0x77, 0x29, 0xE9, 0x0D,
+    0x5F, 0xEA, 0x4A, 0xC1, 0x9D, 0xA7, 0x9A, 0xAA, 0x97, 0x9F, 0xC6, 0x9D, 0xA9, 0xDA, 0x49, 0xD9,
+    0x19, 0xD7, 0x73, 0x9D, 0xA9, 0x09, 0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1,
+    0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E, 0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F,
+    0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF, 0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x77,
+    0x73, 0xAF, 0xA7, 0x29, 0xFD, 0x71, 0x9E, 0x09, 0xDA, 0x79, 0xDA, 0x2A, 0xD7, 0x77, 0x39, 0xF9,
+    0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x2E, 0xAD, 0xA7, 0x19, 0xE9, 0xE7, 0x1E, 0x99, 0xE7, 0x09,
+    0xE1, 0xE7, 0x0E, 0xA1, 0xE7, 0xAE, 0x2E, 0x7E, 0xA2, 0xE9, 0x5A, 0xEA, 0x99, 0x9E, 0x95, 0xFF,
+    0xEA, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC3, 0xAE, 0x5A, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x6A, 0xE2,
+    0xEA, 0x69, 0xE7, 0x77, 0x29, 0x97, 0x6E, 0xA7, 0x49, 0xEA, 0x75, 0xE9, 0x76, 0x97, 0x10, 0x77,
+    0x3F, 0xC7, 0xFD, 0xA5, 0xE9, 0x0E, 0x4A, 0xD3, 0xDA, 0x77, 0x29, 0xDA, 0x90, 0x9A, 0xA9, 0x2F,
+    0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9,
+    0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD,
+    0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x74, 0x97, 0x29, 0xE7, 0x1F, 0x71, 0xAE, 0x73, 0x97, 0x00, 0x75,
+    0x99, 0x76, 0xD9, 0x72, 0x91, 0xD9, 0x99, 0x70, 0x9C, 0xA0, 0x91, 0xD7, 0x1D, 0xA9, 0xAD, 0x97,
+    0x19, 0xFC, 0xA7, 0x39, 0xAA, 0xA7, 0x77, 0x69, 0xF9, 0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x2E,
+    0xAD, 0xA7, 0x19, 0xE9, 0xE7, 0x1E, 0x99, 0xE7, 0x09, 0xE1, 0xE7, 0x0E, 0xA1, 0xE7, 0xAE, 0x2E,
+    0x7E, 0xA2, 0xE9, 0x5A, 0xEA, 0x99, 0x9E, 0x95, 0xFF, 0xEA, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC3,
+    0xAE, 0x5A, 0xE3, 0xEA, 0x5A, 0xE2, 0xAE, 0x6A, 0xE2, 0xEA, 0x69, 0xE1, 0x77, 0x59, 0xD9, 0x69,
+    0x1D, 0x09, 0x5A, 0xC0, 0xAA, 0x09, 0xCA, 0x4A, 0xD9, 0x0A, 0xD6, 0xFD, 0x97, 0xAD, 0xA7, 0x75,
+    0x9D, 0xA1, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09,
+    0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2,
+    0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x72, 0x99, 0x76, 0x9D, 0x75,
+    0x90, 0x9C, 0xA0, 0x99, 0x70, 0x9C, 0xA0, 0x99, 0x0D, 0x71, 0xDA, 0x9A, 0xD9, 0x71, 0xAF, 0xCA,
+    0x73, 0x9A, 0xAA, 0x77, 0x76, 0x9F, 0x97, 0x3F, 0xCA, 0x72, 0x9F, 0xCA, 0x72, 0xEA, 0xDA, 0x71,
+    0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E, 0x1E, 0x70, 0xEA, 0x1E, 0x7A, 0xE2, 0xE7, 0xEA, 0x2E,
+    0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE, 0xA4, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xE5, 0xAE,
+    0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E, 0xA6, 0x9E, 0x10, 0x77, 0x3D, 0xA7, 0x19, 0x0D, 0x19,
+    0x5A, 0xC1, 0xA9, 0x9C, 0xA4, 0x9D, 0x90, 0xAD, 0x6F, 0xD9, 0x7A, 0xDA, 0x77, 0x59, 0xDA, 0x19,
+    0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E,
+    0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF,
+    0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x77, 0x74, 0x9D, 0x97, 0x7D, 0x73, 0x91,
+    0xD9, 0x99, 0x70, 0x9C, 0xA0, 0xA1, 0xD7, 0x1D, 0xA9, 0xAD, 0x97, 0x1A, 0xFC, 0xA7, 0x39, 0xAA,
+    0xA7, 0x77, 0x69, 0xF9, 0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x2E, 0xAD, 0xA7, 0x19, 0xE9, 0xE7,
+    0x1E, 0x99, 0xE7, 0x09, 0xE1, 0xE7, 0x0E, 0xA1, 0xE7, 0xAE, 0x2E, 0x7E, 0xA2, 0xE9, 0x5A, 0xEA,
+    0x99, 0x9E, 0x95, 0xFF, 0xEA, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC3, 0xAE, 0x5A, 0xE3, 0xEA, 0x5A,
+    0xE2, 0xAE, 0x6A, 0xE2, 0xEA, 0x69, 0xE1, 0x6A, 0xCA, 0x72, 0x9A, 0xC9, 0x79, 0x09, 0xD0, 0x95,
+    0xAC, 0x0A, 0xA0, 0x9C, 0xA4, 0xAD, 0x90, 0xAD, 0x6F, 0xD9, 0x7A, 0xDA, 0x77, 0x59, 0xDA, 0x19,
+    0xAA, 0x92, 0xFD, 0x9E, 0x2F, 0xFE, 0x19, 0xF9, 0x0F, 0xC1, 0xF2, 0x9E, 0xA0, 0x9E, 0xA2, 0x9E,
+    0x90, 0xAE, 0x92, 0x9E, 0x1F, 0x3A, 0xE1, 0xF3, 0xEA, 0x1F, 0x29, 0xEA, 0x1F, 0x2F, 0x91, 0xAF,
+    0xFD, 0x3F, 0xDA, 0xE3, 0x9F, 0x99, 0xDA, 0x77, 0x00, 0x72, 0x93, 0x97, 0x19, 0xF9, 0xAC, 0x97,
+    0x0D, 0xAA, 0xF7, 0x19, 0x92, 0x99, 0x71, 0x9C, 0x93, 0xAC, 0x71, 0xDA, 0x99, 0xAD, 0x71, 0xAF,
+    0xD7, 0x39, 0xAA, 0xA9, 0x77, 0x75, 0x9F, 0x97, 0x3F, 0xCA, 0x72, 0x9F, 0xCA, 0x72, 0xEA, 0xDA,
+    0x71, 0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E, 0x1E, 0x70, 0xEA, 0x1E, 0x7A, 0xE2, 0xE7, 0xEA,
+    0x2E, 0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE, 0xA4, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xE5,
+    0xAE, 0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E, 0xA6, 0x9E, 0x10, 0x77, 0x29, 0xE9, 0x0A, 0xC5,
+    0xDA, 0xFA, 0x49, 0xA2, 0xAA, 0x95, 0xAA, 0x4A, 0xA4, 0xAC, 0xA9, 0x09, 0xDA, 0x5F, 0xE7, 0xAD,
+    0xA9, 0x77, 0x49, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9, 0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F,
+    0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29, 0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2,
+    0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE, 0x39, 0xF9, 0x9D, 0xA7, 0x70, 0x77, 0x71,
+    0xAD, 0x29, 0xD7, 0x09, 0xEA, 0xEA, 0x71, 0xFE, 0x73, 0xAD, 0xA9, 0x77, 0x75, 0x9F, 0x97, 0x3F,
+    0xCA, 0x72, 0x9F, 0xCA, 0x72, 0xEA, 0xDA, 0x71, 0x9E, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0x9E, 0x1E,
+    0x70, 0xEA, 0x1E, 0x7A, 0xE2, 0xE7, 0xEA, 0x2E, 0x95, 0xAE, 0xA9, 0x99, 0xE9, 0x5F, 0xFE, 0xA4,
+    0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xE5, 0xAE, 0x3E, 0xA5, 0xAE, 0x2A, 0xE6, 0xAE, 0x2E, 0xA6,
+    0x9E, 0x77, 0x72, 0x99, 0x76, 0xEA, 0x74, 0x9E, 0xA7, 0x5E, 0x97, 0x69, 0x71, 0x77, 0x1D, 0xA2,
+    0xAD, 0x4A, 0xEA, 0xE9, 0x5F, 0xE7, 0xAD, 0xA9, 0x77, 0x49, 0xDA, 0x90, 0x9A, 0xA9, 0x2F, 0xD9,
+    0xE2, 0xFF, 0xE1, 0x9F, 0x90, 0xFC, 0x1F, 0x29, 0xEA, 0x09, 0xEA, 0x29, 0xE9, 0x0A, 0xE9, 0x29,
+    0xE1, 0xF3, 0xAE, 0x1F, 0x3E, 0xA1, 0xF2, 0x9E, 0xA1, 0xF2, 0xF9, 0x1A, 0xFF, 0xD3, 0xFD, 0xAE,
+    0x39, 0xF9, 0x9D, 0xA7, 0x74, 0x97, 0x29, 0xE7, 0x1F, 0x71, 0xAE, 0x73, 0x97, 0x00, 0x3A, 0xFF,
+    0xC9, 0x3F, 0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72,
+    0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99, 0x4F, 0x72, 0xEA, 0x71, 0x9E,
+    0x97, 0x1A, 0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD7, 0x77, 0x99, 0x73, 0xE9, 0x71, 0x9E,
+    0xA7, 0x19, 0xE7, 0x49, 0x70, 0x4A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E,
+    0x90, 0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F,
+    0x70, 0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77, 0x39, 0x71, 0x9E,
+    0x97, 0xAE, 0x97, 0x9E, 0x72, 0x97, 0x7E, 0xA7, 0x19, 0xFC, 0x71, 0x99, 0xE7, 0x3E, 0x71, 0xAD,
+    0xA7, 0x2D, 0x97, 0x76, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99, 0x49,
+    0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9, 0x99, 0x99,
+    0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD, 0x30,
+    0x5A, 0xAA, 0xA7, 0x0F, 0xC7, 0x99, 0xE9, 0x70, 0xAD, 0x79, 0xE9, 0x7A, 0xD7, 0x75, 0xAE, 0xA9,
+    0x4A, 0xFE, 0x92, 0xAF, 0xFC, 0x19, 0xEA, 0x19, 0xE9, 0x0F, 0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A,
+    0xFF, 0xD9, 0x0F, 0xFC, 0xA2, 0xFA, 0xA9, 0x94, 0xF7, 0x0A, 0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92,
+    0xFF, 0xC9, 0x3A, 0xFD, 0xA7, 0x70, 0x6D, 0xA2, 0xD6, 0xFF, 0xC5, 0xAD, 0xAF, 0xC9, 0x5D, 0x2A,
+    0xD9, 0x77, 0x5A, 0xFF, 0xC9, 0x4F, 0xFD, 0x5F, 0xFD, 0x49, 0xEA, 0x99, 0x99, 0x95, 0x9E, 0x97,
+    0x2A, 0xE7, 0x3F, 0x73, 0xFF, 0xC9, 0x49, 0xFF, 0xC5, 0xAF, 0xFC, 0x5F, 0x99, 0x99, 0x99, 0x5F,
+    0x73, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE9, 0x72, 0xFF, 0xD5, 0xFF, 0xD5, 0xFF, 0xD4, 0x4A, 0xCA,
+    0x2D, 0x4F, 0xFC, 0x3A, 0xDA, 0xFC, 0x93, 0xAC, 0x2A, 0xD9, 0x77, 0x4A, 0xEA, 0x95, 0xAF, 0xE9,
+    0x3A, 0xFF, 0xC2, 0x9E, 0xA1, 0x9E, 0x91, 0xF2, 0x9E, 0x19, 0xE9, 0x19, 0xF1, 0xAF, 0xFD, 0x91,
+    0xFF, 0xCA, 0x3F, 0xAA, 0x99, 0x5F, 0x71, 0xAE, 0x49, 0x39, 0xFA, 0xAA, 0xD9, 0x3F, 0xFC, 0x94,
+    0xAF, 0xDA, 0x77, 0x10, 0x76, 0x9A, 0xA7, 0x69, 0xDA, 0x70, 0xF9, 0x0D, 0xA7, 0x0F, 0xD0, 0x97,
+    0x1E, 0x1D, 0x97, 0x1A, 0xA9, 0x29, 0xAA, 0x77, 0x73, 0xAF, 0xFC, 0x97, 0xFF, 0xD7, 0x0F, 0xFD,
+    0x79, 0xEA, 0x99, 0x99, 0x97, 0x09, 0xE9, 0x75, 0xAE, 0x76, 0xF7, 0x6F, 0xFC, 0x97, 0x9F, 0xFC,
+    0x70, 0xAF, 0xFC, 0x70, 0xF9, 0x99, 0x99, 0x97, 0x0F, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE9,
+    0x75, 0xFF, 0xD7, 0x0F, 0xFD, 0x70, 0xFF, 0xD7, 0x75, 0x99, 0x75, 0xE6, 0xF9, 0x0A, 0xD6, 0xFD,
+    0x09, 0x96, 0xAD, 0x99, 0xD9, 0x7A, 0xCA, 0x29, 0xD7, 0x77, 0x2A, 0xEA, 0x97, 0x0A, 0xFE, 0x96,
+    0xAF, 0xFC, 0x59, 0xEA, 0x19, 0xE9, 0x4F, 0x29, 0xE4, 0x9E, 0x91, 0x9F, 0x4A, 0xFF, 0xD9, 0x4F,
+    0xFC, 0xA6, 0xFA, 0xA9, 0x97, 0x0F, 0x74, 0xAE, 0x49, 0x69, 0xFA, 0xAA, 0xD9, 0x6F, 0xFC, 0x97,
+    0xAF, 0xDA, 0x77, 0x70, 0x2A, 0xA9, 0x73, 0xE7, 0x4D, 0x1F, 0x96, 0x99, 0xFD, 0x7E, 0x1D, 0x95,
+    0xAA, 0x92, 0x9A, 0xA7, 0x73, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3, 0x9E, 0xA9, 0x99, 0x99,
+    0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xF9, 0x99,
+    0x99, 0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD, 0x4F, 0xFD, 0x4F, 0xFD,
+    0x30, 0x09, 0x97, 0x2E, 0x72, 0xD9, 0x0F, 0x94, 0x99, 0xFD, 0x5A, 0xD9, 0x9D, 0x93, 0xAC, 0xA2,
+    0x9D, 0x77, 0x2A, 0xEA, 0x94, 0xAF, 0xE9, 0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E, 0x90, 0xF2, 0x9E,
+    0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90, 0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F, 0x70, 0xAE, 0x49,
+    0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93, 0xAF, 0xDA, 0x77, 0x74, 0x9D, 0x97, 0x59, 0xAD, 0x77,
+    0xD7, 0x9F, 0x99, 0xCA, 0x70, 0xFD, 0x09, 0x70, 0xE0, 0x9D, 0x97, 0x0A, 0xA9, 0x29, 0xAA, 0x77,
+    0x71, 0xAF, 0xFC, 0x96, 0xFF, 0xD7, 0xFF, 0xD6, 0x9E, 0xA9, 0x99, 0x99, 0x79, 0xE9, 0x74, 0xAE,
+    0x75, 0xF7, 0x5F, 0xFC, 0x96, 0x9F, 0xFC, 0x7A, 0xFF, 0xC7, 0xF9, 0x99, 0x99, 0x97, 0xF7, 0x5E,
+    0xA7, 0x49, 0xE9, 0x74, 0xAE, 0x97, 0x4F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x60, 0x73, 0xAA, 0x97,
+    0x39, 0xE7, 0x5D, 0x6F, 0x90, 0xD9, 0x5F, 0xD0, 0xA6, 0xE9, 0x9D, 0x96, 0xAC, 0xA2, 0x9C, 0xA7,
+    0x77, 0x0A, 0xEA, 0x97, 0xAF, 0xE9, 0x5A, 0xFF, 0xC4, 0x9E, 0xA1, 0x9E, 0x93, 0xF2, 0x9E, 0x39,
+    0xE9, 0x19, 0xF3, 0xAF, 0xFD, 0x93, 0xFF, 0xCA, 0x5F, 0xAA, 0x99, 0x7F, 0x73, 0xAE, 0x49, 0x59,
+    0xFA, 0xAA, 0xD9, 0x5F, 0xFC, 0x96, 0xAF, 0xDA, 0x77, 0x50, 0x77, 0x5F, 0x99, 0xCA, 0x5A, 0xCA,
+    0xFC, 0x6A, 0x91, 0x9A, 0xA7, 0x1A, 0xE7, 0x1F, 0xCA, 0x7E, 0x0A, 0xD9, 0x5A, 0xA9, 0x29, 0xAA,
+    0x77, 0x3A, 0xFF, 0xC9, 0x3F, 0xFD, 0x4F, 0xFD, 0x39, 0xEA, 0x99, 0x99, 0x94, 0x9E, 0x97, 0x1A,
+    0xE7, 0x2F, 0x72, 0xFF, 0xC9, 0x39, 0xFF, 0xC4, 0xAF, 0xFC, 0x4F, 0x99, 0x99, 0x99, 0x4F, 0x72,
+    0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xFF, 0xD4, 0xFF, 0xD4, 0xFF, 0xD3, 0x77, 0x1A, 0xDA,
+    0x1C, 0xA3, 0xAF, 0xE9, 0x3D, 0x1A, 0xD9, 0x6A, 0xAA, 0xA7, 0xAF, 0xA5, 0xAD, 0x9A, 0xD4, 0xAC,
+    0xA2, 0xAC, 0xA7, 0x72, 0xAE, 0xA9, 0x4A, 0xFE, 0x92, 0xAF, 0xFC, 0x19, 0xEA, 0x19, 0xE9, 0x0F,
+    0x29, 0xE0, 0x9E, 0x91, 0x9F, 0x0A, 0xFF, 0xD9, 0x0F, 0xFC, 0xA2, 0xFA, 0xA9, 0x94, 0xF7, 0x0A,
+    0xE4, 0x92, 0x9F, 0xAA, 0xAD, 0x92, 0xFF, 0xC9, 0x3A, 0xFD, 0xA7, 0x70, 0x77, 0x59, 0xFA, 0x79,
+    0xFD, 0x69, 0xE0, 0x9E, 0x5D, 0xA2, 0x9D, 0x97, 0x72, 0xAF, 0xFC, 0x93, 0xFF, 0xD4, 0xFF, 0xD3,
+    0x9E, 0xA9, 0x99, 0x99, 0x49, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2F, 0xFC, 0x93, 0x9F, 0xFC, 0x4A,
+    0xFF, 0xC4, 0xF9, 0x99, 0x99, 0x94, 0xF7, 0x2E, 0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x97, 0x1F, 0xFD,
+    0x4F, 0xFD, 0x4F, 0xFD, 0x77, 0x79, 0x97, 0x3E, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0x74, 0x97, 0x00,
+    0x77, 0x2F, 0xC6, 0xFD, 0x94, 0xE9, 0x0E, 0x3D, 0xA3, 0xDA, 0x77, 0x1A, 0xEA, 0x94, 0xAF, 0xE9,
+    0x2A, 0xFF, 0xC1, 0x9E, 0xA1, 0x9E, 0x90, 0xF2, 0x9E, 0x09, 0xE9, 0x19, 0xF0, 0xAF, 0xFD, 0x90,
+    0xFF, 0xCA, 0x2F, 0xAA, 0x99, 0x4F, 0x70, 0xAE, 0x49, 0x29, 0xFA, 0xAA, 0xD9, 0x2F, 0xFC, 0x93,
+    0xAF, 0xDA, 0x77, 0x39, 0x71, 0x9E, 0x97, 0xAE, 0x97, 0x9E, 0x72, 0x97, 0x59, 0xE9, 0x6A, 0xF9,
+    0x79, 0xDA, 0x79, 0xD9, 0x6E, 0xA7, 0xD7, 0x72, 0xFE, 0xA3, 0xFE, 0xA3, 0xFD, 0xA5, 0xAE, 0x7F,
+    0x7E, 0xA7, 0xE9, 0x69, 0xE9, 0x6A, 0xE7, 0xF7, 0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xAE, 0x7F, 0x59,
+    0xFC, 0xA3, 0x9F, 0xE9, 0x2A, 0xFE, 0x92, 0x3A, 0xAA, 0xA5, 0xFC, 0x49, 0x9E, 0x6E, 0x49, 0xE5,
+    0xAC, 0xA7, 0x79, 0xAA, 0xA5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xF5, 0xEA, 0x49, 0xE9,
+    0x4A, 0xE5, 0xF5, 0xEA, 0x5E, 0x94, 0x9E, 0x94, 0x3F, 0xEA, 0x3F, 0xEA, 0x3F, 0xDA, 0x5A, 0xE7,
+    0xF7, 0xEA, 0x7E, 0x96, 0x9E, 0x96, 0xAE, 0x7F, 0x7E, 0xA6, 0x9E, 0x96, 0xAE, 0x7A, 0xE7, 0xF5,
+    0x9F, 0xCA, 0x39, 0xFE, 0x92, 0xAF, 0xE9, 0x77, 0x19, 0x97, 0x0E, 0xA6, 0x9E, 0xA6, 0x9E, 0x97,
+    0x09, 0x70, 0x76, 0x9D, 0xA5, 0xF5, 0xF5, 0x9A, 0xA7, 0x79, 0xAA, 0xA5, 0xF5, 0xEA, 0x49, 0xE9,
+    0x4A, 0xE5, 0xF5, 0xF5, 0xEA, 0x49, 0xE9, 0x4A, 0xE5, 0xF5, 0xEA, 0x5E, 0x94, 0x9E, 0x97, 0x79,
+    0x96, 0xE9, 0x49, 0xEA, 0x49, 0xE7, 0x96, 0x77, 0x69, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF,
+    0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69,
+    0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9,
+    0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F,
+    0xDA, 0x77, 0x74, 0x97, 0x59, 0xE9, 0x73, 0xAE, 0x97, 0x39, 0xE7, 0x69, 0x71, 0x39, 0xAE, 0xA5,
+    0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4, 0xE9, 0xF3, 0x9E,
+    0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4, 0xAF, 0xCA, 0x77,
+    0x49, 0x97, 0x1E, 0x97, 0xAE, 0xA7, 0x9E, 0x72, 0x97, 0x70, 0xEA, 0x73, 0x9F, 0xC7, 0x39, 0x9E,
+    0x75, 0xE7, 0x3A, 0xE7, 0x4D, 0xA7, 0x77, 0x39, 0xFC, 0xA9, 0x69, 0xFF, 0xCA, 0x49, 0xFF, 0xE9,
+    0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x59, 0xE9, 0x0F, 0x69, 0xE9,
+    0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0, 0xAE, 0x95, 0x9F, 0x09, 0xE9, 0x5A,
+    0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xDA,
+    0x77, 0x60, 0x5A, 0xAA, 0xA7, 0x0F, 0xC7, 0x99, 0xE7, 0x1E, 0x79, 0xE9, 0x7A, 0xD7, 0x74, 0x9A,
+    0xEA, 0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x4E, 0x9F,
+    0x39, 0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90, 0x9F, 0xFD, 0x2A, 0xFF, 0x4A, 0xFC,
+    0xA7, 0x70, 0x77, 0x9A, 0xA7, 0x79, 0xDA, 0x70, 0x9F, 0x90, 0xD9, 0x71, 0xFD, 0x09, 0x72, 0xE0,
+    0x9D, 0x97, 0x2A, 0xA9, 0x29, 0xAA, 0x77, 0x76, 0x9F, 0xCA, 0x97, 0x19, 0xFF, 0xCA, 0x79, 0xFF,
+    0xE9, 0x6F, 0xA2, 0xAF, 0x5F, 0xA4, 0xF4, 0x9F, 0x5A, 0xE9, 0x3A, 0xE9, 0x59, 0xE9, 0x3F, 0x69,
+    0xE9, 0x3E, 0xA6, 0x9E, 0x92, 0x9E, 0x96, 0xAE, 0x92, 0xAE, 0x96, 0xF3, 0xAE, 0x95, 0x9F, 0x39,
+    0xE9, 0x5A, 0xE9, 0x39, 0xF4, 0x9F, 0x5F, 0xA2, 0xAF, 0x95, 0x9F, 0xFE, 0xA7, 0xAF, 0xFC, 0xA7,
+    0x19, 0xFD, 0xA7, 0x77, 0x40, 0x75, 0x99, 0x75, 0xE6, 0xF9, 0x0A, 0xD6, 0xFD, 0x09, 0x96, 0xAD,
+    0x99, 0xD9, 0x7A, 0xCA, 0x29, 0xD7, 0x77, 0x19, 0xAE, 0xA7, 0x1F, 0xF7, 0xFF, 0xD5, 0xAF, 0x1F,
+    0x5F, 0x29, 0xE9, 0x39, 0xE9, 0x3E, 0xA3, 0xAE, 0x4E, 0x93, 0xF3, 0x9E, 0x93, 0xF3, 0xAE, 0x4F,
+    0x3F, 0x4A, 0xE2, 0xAE, 0x94, 0x9F, 0xFD, 0x6A, 0xFF, 0x70, 0xAF, 0xCA, 0x77, 0x70, 0x3A, 0xA9,
+    0x75, 0xDA, 0x76, 0xD0, 0x9F, 0x97, 0x09, 0x9F, 0xD7, 0x1E, 0x09, 0xD9, 0x7A, 0xA9, 0x29, 0xAA,
+    0x77, 0x70, 0x9F, 0xCA, 0x96, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x93, 0xFA, 0x2A, 0xF2, 0xFA, 0x4F,
+    0x19, 0xF5, 0xAE, 0x90, 0xAE, 0x95, 0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA, 0x69, 0xE9, 0x9E, 0x96,
+    0xAE, 0x9A, 0xE9, 0x6F, 0x0A, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0xAE, 0x90, 0x9F, 0x49, 0xF2, 0xFA,
+    0x2A, 0xF9, 0x29, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xFD, 0xA7, 0x76, 0x09, 0x97, 0x2E, 0x72,
+    0xD9, 0x0F, 0x94, 0x99, 0xFD, 0x5A, 0xD9, 0x9D, 0x93, 0xAC, 0xA2, 0x9D, 0x77, 0x19, 0xAE, 0xA5,
+    0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4, 0xE9, 0xF3, 0x9E,
+    0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4, 0xAF, 0xCA, 0x77,
+    0x00, 0x75, 0x9D, 0x97, 0x69, 0xAD, 0x77, 0x0D, 0x70, 0x9F, 0x09, 0xCA, 0x70, 0x9F, 0xCA, 0x09,
+    0x70, 0x9D, 0xA0, 0x9D, 0x97, 0x1A, 0xA9, 0x29, 0xA9, 0x77, 0x74, 0x9F, 0xCA, 0x97, 0x09, 0xFF,
+    0xCA, 0x69, 0xFF, 0xE9, 0x5F, 0xA2, 0xAF, 0x4F, 0xA4, 0xF3, 0x9F, 0x5A, 0xE9, 0x2A, 0xE9, 0x59,
+    0xE9, 0x2F, 0x69, 0xE9, 0x2E, 0xA6, 0x9E, 0x91, 0x9E, 0x96, 0xAE, 0x91, 0xAE, 0x96, 0xF2, 0xAE,
+    0x95, 0x9F, 0x29, 0xE9, 0x5A, 0xE9, 0x29, 0xF4, 0x9F, 0x4F, 0xA2, 0xAF, 0x94, 0x9F, 0xFE, 0xA6,
+    0xAF, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x77, 0x20, 0x73, 0xAA, 0x97, 0x39, 0xE7, 0x5A, 0xC6, 0xF9,
+    0x0D, 0x95, 0xFD, 0x0A, 0x6E, 0x99, 0xD9, 0x6A, 0xCA, 0x29, 0xD7, 0x77, 0x9A, 0xEA, 0x70, 0xFF,
+    0x6F, 0xFD, 0x4A, 0xF1, 0xF4, 0xF2, 0x9E, 0x92, 0x9E, 0x93, 0xEA, 0x2A, 0xE4, 0xE9, 0x2F, 0x39,
+    0xE9, 0x2F, 0x3A, 0xE3, 0xF3, 0xF3, 0xAE, 0x2A, 0xE9, 0x39, 0xFF, 0xD5, 0xAF, 0xF7, 0xAF, 0xCA,
+    0x77, 0x60, 0x75, 0x97, 0x1E, 0xA9, 0xAC, 0xA7, 0xDA, 0xFC, 0x70, 0xA9, 0x19, 0xAA, 0x73, 0xAD,
+    0xA7, 0x3F, 0xCA, 0x71, 0xE0, 0xAD, 0x70, 0xAA, 0x92, 0x9A, 0x97, 0x77, 0x09, 0xFC, 0xA9, 0x69,
+    0xFF, 0xCA, 0x49, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0x2F, 0xA4, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9,
+    0x59, 0xE9, 0x0F, 0x69, 0xE9, 0x0E, 0xA6, 0x9E, 0x99, 0xE9, 0x6A, 0xE9, 0xAE, 0x96, 0xF0, 0xAE,
+    0x95, 0x9F, 0x09, 0xE9, 0x5A, 0xE9, 0x09, 0xF4, 0x9F, 0x2F, 0xA2, 0xAF, 0x92, 0x9F, 0xFE, 0xA4,
+    0xAF, 0xFC, 0xA6, 0x9F, 0xDA, 0x77, 0x60, 0x77, 0x1A, 0xDA, 0x1D, 0x39, 0xFE, 0x93, 0xD1, 0x9D,
+    0x96, 0x9A, 0xAA, 0x7A, 0xFA, 0x5A, 0xD9, 0xAD, 0x93, 0xAC, 0xA2, 0xAC, 0xA7, 0x71, 0x9A, 0xEA,
+    0x5F, 0xF3, 0xFF, 0xD1, 0xAF, 0x1F, 0x1F, 0x29, 0xE9, 0x9E, 0x93, 0xEA, 0xAE, 0x4E, 0x9F, 0x39,
+    0xE9, 0xF3, 0xAE, 0x0F, 0x3F, 0x0A, 0xE2, 0xAE, 0x90, 0x9F, 0xFD, 0x2A, 0xFF, 0x4A, 0xFC, 0xA7,
+    0x70, 0x77, 0x70, 0x9F, 0xA7, 0x19, 0xFD, 0x70, 0x9E, 0x09, 0xE6, 0x9D, 0xA2, 0x9D, 0x97, 0x77,
+    0x9F, 0xCA, 0x96, 0x9F, 0xFC, 0xA4, 0x9F, 0xFE, 0x93, 0xFA, 0x2A, 0xF2, 0xFA, 0x4F, 0x19, 0xF5,
+    0xAE, 0x90, 0xAE, 0x95, 0x9E, 0x90, 0xF6, 0x9E, 0x90, 0xEA, 0x69, 0xE9, 0x9E, 0x96, 0xAE, 0x9A,
+    0xE9, 0x6F, 0x0A, 0xE9, 0x59, 0xF0, 0x9E, 0x95, 0xAE, 0x90, 0x9F, 0x49, 0xF2, 0xFA, 0x2A, 0xF9,
+    0x29, 0xFF, 0xEA, 0x4A, 0xFF, 0xCA, 0x69, 0xFD, 0xA7, 0x77, 0x49, 0x75, 0x9E, 0x97, 0x3A, 0xE9,
+    0x73, 0x9E, 0x76, 0x97, 0x10, 0x77, 0x2F, 0xC6, 0xFD, 0x94, 0xE9, 0x0E, 0x3D, 0xA3, 0xD9, 0x77,
+    0x09, 0xAE, 0xA5, 0xFF, 0x3F, 0xFD, 0x1A, 0xF1, 0xF1, 0xF2, 0x9E, 0x99, 0xE9, 0x3E, 0xAA, 0xE4,
+    0xE9, 0xF3, 0x9E, 0x9F, 0x3A, 0xE0, 0xF3, 0xF0, 0xAE, 0x2A, 0xE9, 0x09, 0xFF, 0xD2, 0xAF, 0xF4,
+    0xAF, 0xCA, 0x77, 0x49, 0x97, 0x1E, 0x97, 0xAE, 0xA7, 0x9E, 0x72, 0x97, 0x77, 0x76, 0xAE, 0xA7,
+    0x7E, 0xA7, 0x7E, 0x97, 0x7A, 0xD9, 0x77, 0x71, 0xF5, 0x9F, 0xCA, 0x91, 0x9E, 0x93, 0x9F, 0xFC,
+    0xA0, 0xF3, 0x9F, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0xD4, 0xFA, 0x4F, 0xA4, 0x9F, 0x59, 0xE9, 0x4A,
+    0xE9, 0x59, 0xE9, 0x4F, 0x69, 0xE9, 0x4E, 0xA6, 0x9E, 0x93, 0x9E, 0x96, 0xAE, 0x49, 0xE9, 0x6F,
+    0x49, 0xE9, 0x6E, 0xA4, 0x9E, 0x95, 0xAE, 0x94, 0x9E, 0xA4, 0x9F, 0x6F, 0xA2, 0xAF, 0x96, 0x9F,
+    0xFE, 0xA7, 0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x76, 0x77, 0x71, 0xF9, 0x73, 0xAE, 0x97,
+    0x39, 0xE7, 0x5D, 0xA3, 0x9A, 0xAA, 0x75, 0xAE, 0x49, 0xAE, 0xA2, 0xEA, 0x3F, 0xF9, 0xF3, 0xFF,
+    0xFC, 0x3A, 0xF1, 0xFC, 0x94, 0xF2, 0x9E, 0x94, 0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xE9, 0x4F, 0x39,
+    0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF5, 0xAE, 0x2A, 0xE9, 0x59, 0xFF, 0xD7, 0xAF, 0xF7, 0x1A, 0xFC,
+    0xA7, 0x77, 0x20, 0x77, 0x73, 0xAE, 0x77, 0x1E, 0x97, 0x71, 0xE7, 0x71, 0x9D, 0x97, 0x77, 0x0F,
+    0x59, 0xFC, 0xA9, 0x19, 0xE9, 0x39, 0xFF, 0xCA, 0x0F, 0x39, 0xFF, 0xFE, 0x93, 0xFA, 0x2A, 0xFD,
+    0x4F, 0xA4, 0xFA, 0x49, 0xF5, 0x9E, 0x94, 0xAE, 0x95, 0x9E, 0x94, 0xF6, 0x9E, 0x94, 0xEA, 0x69,
+    0xE9, 0x39, 0xE9, 0x6A, 0xE4, 0x9E, 0x96, 0xF4, 0x9E, 0x96, 0xEA, 0x49, 0xE9, 0x5A, 0xE9, 0x49,
+    0xEA, 0x49, 0xF6, 0xFA, 0x2A, 0xF9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFC, 0x97, 0x29, 0xFD, 0xA7,
+    0x77, 0x60, 0x77, 0x6E, 0xA7, 0x5A, 0xE7, 0x6A, 0xD9, 0x76, 0xAC, 0xA2, 0x9A, 0xAA, 0x75, 0xAE,
+    0x49, 0xAE, 0xA2, 0xEA, 0x3F, 0xF9, 0xF3, 0xFF, 0xFC, 0x3A, 0xF1, 0xFC, 0x94, 0xF2, 0x9E, 0x94,
+    0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xE9, 0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF5, 0xAE, 0x2A,
+    0xE9, 0x59, 0xFF, 0xD7, 0xAF, 0xF7, 0x1A, 0xFC, 0xA7, 0x77, 0x20, 0x70, 0xAD, 0xA7, 0x70, 0xFC,
+    0x77, 0x90, 0xE7, 0x71, 0xE7, 0x7A, 0xE7, 0x70, 0xAC, 0xA7, 0x77, 0x1F, 0x59, 0xFC, 0xA9, 0x19,
+    0xE9, 0x39, 0xFF, 0xCA, 0x0F, 0x39, 0xFF, 0xFE, 0x93, 0xFA, 0x2A, 0xFD, 0x4F, 0xA4, 0xFA, 0x49,
+    0xF5, 0x9E, 0x94, 0xAE, 0x95, 0x9E, 0x94, 0xF6, 0x9E, 0x94, 0xEA, 0x69, 0xE9, 0x39, 0xE9, 0x6A,
+    0xE4, 0x9E, 0x96, 0xF4, 0x9E, 0x96, 0xEA, 0x49, 0xE9, 0x5A, 0xE9, 0x49, 0xEA, 0x49, 0xF6, 0xFA,
+    0x2A, 0xF9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFC, 0x97, 0x29, 0xFD, 0xA7, 0x77, 0x60, 0x5A, 0xAA,
+    0xA7, 0x5F, 0xC7, 0x49, 0x9E, 0x76, 0xE7, 0x49, 0xE9, 0x74, 0xAD, 0x39, 0xAA, 0xA7, 0x5A, 0xE4,
+    0x9A, 0xEA, 0x2E, 0xA3, 0xFF, 0x9F, 0x3F, 0xFF, 0xC3, 0xAF, 0x1F, 0xC9, 0x4F, 0x29, 0xE9, 0x49,
+    0xE9, 0x3E, 0xA4, 0xAE, 0x4E, 0x94, 0xF3, 0x9E, 0x94, 0xF3, 0xAE, 0x5F, 0x3F, 0x5A, 0xE2, 0xAE,
+    0x95, 0x9F, 0xFD, 0x7A, 0xFF, 0x71, 0xAF, 0xCA, 0x77, 0x72, 0x6A, 0xD9, 0x19, 0xCA, 0x72, 0xAF,
+    0xCA, 0xD9, 0x72, 0xDA, 0xFC, 0xA7, 0x29, 0xC9, 0x19, 0xAC, 0xA7, 0x77, 0xF5, 0x9F, 0xCA, 0x91,
+    0x9E, 0x93, 0x9F, 0xFC, 0xA0, 0xF3, 0x9F, 0xFF, 0xE9, 0x3F, 0xA2, 0xAF, 0xD4, 0xFA, 0x4F, 0xA4,
+    0x9F, 0x59, 0xE9, 0x4A, 0xE9, 0x59, 0xE9, 0x4F, 0x69, 0xE9, 0x4E, 0xA6, 0x9E, 0x93, 0x9E, 0x96,
+    0xAE, 0x49, 0xE9, 0x6F, 0x49, 0xE9, 0x6E, 0xA4, 0x9E, 0x95, 0xAE, 0x94, 0x9E, 0xA4, 0x9F, 0x6F,
+    0xA2, 0xAF, 0x96, 0x9F, 0xFE, 0xA7, 0x0A, 0xFF, 0xC9, 0x72, 0x9F, 0xDA, 0x77, 0x76, 0x4A, 0xCA,
+    0x91, 0xAC, 0x97, 0xFF, 0xC7, 0x9D, 0xAF, 0xC9, 0x7A, 0xC2, 0x9D, 0x90, 0x9A, 0xAA, 0x75, 0xAE,
+    0x49, 0xAE, 0xA2, 0xEA, 0x3F, 0xF9, 0xF3, 0xFF, 0xFC, 0x3A, 0xF1, 0xFC, 0x94, 0xF2, 0x9E, 0x94,
+    0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xE9, 0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF5, 0xAE, 0x2A,
+    0xE9, 0x59, 0xFF, 0xD7, 0xAF, 0xF7, 0x1A, 0xFC, 0xA7, 0x77, 0x20, 0x77, 0x0F, 0x59, 0xFC, 0xA9,
+    0x19, 0xE9, 0x39, 0xFF, 0xCA, 0x0F, 0x39, 0xFF, 0xFE, 0x93, 0xFA, 0x2A, 0xFD, 0x4F, 0xA4, 0xFA,
+    0x49, 0xF5, 0x9E, 0x94, 0xAE, 0x95, 0x9E, 0x94, 0xF6, 0x9E, 0x94, 0xEA, 0x69, 0xE9, 0x39, 0xE9,
+    0x6A, 0xE4, 0x9E, 0x96, 0xF4, 0x9E, 0x96, 0xEA, 0x49, 0xE9, 0x5A, 0xE9, 0x49, 0xEA, 0x49, 0xF6,
+    0xFA, 0x2A, 0xF9, 0x69, 0xFF, 0xEA, 0x70, 0xAF, 0xFC, 0x97, 0x29, 0xFD, 0xA7, 0x77, 0x74, 0x99,
+    0x77, 0x09, 0xE9, 0x77, 0xAE, 0x97, 0x79, 0xE7, 0x72, 0x97, 0x50, 0x74, 0x9A, 0xAA, 0x75, 0xAE,
+    0x49, 0xAE, 0xA2, 0xEA, 0x3F, 0xF9, 0xF3, 0xFF, 0xFC, 0x3A, 0xF1, 0xFC, 0x94, 0xF2, 0x9E, 0x94,
+    0x9E, 0x93, 0xEA, 0x4A, 0xE4, 0xE9, 0x4F, 0x39, 0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF5, 0xAE, 0x2A,
+    0xE9, 0x59, 0xFF, 0xD7, 0xAF, 0xF7, 0x1A, 0xFC, 0xA7, 0x77, 0x69, 0x97, 0x6A, 0xE7, 0x5F, 0x75,
+    0xEA, 0x76, 0x97, 0x40, 0x2A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x3E, 0xA4, 0xF2, 0x9E, 0x94, 0xF2,
+    0xAE, 0x5E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0xAE, 0x94, 0xEA, 0x2A,
+    0xE4, 0x9E, 0xA2, 0xF4, 0x9E, 0x92, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xF2, 0x9E, 0xA3, 0x9E, 0xA3,
+    0xF9, 0x19, 0xF4, 0xFF, 0xEA, 0x5F, 0xFC, 0xA7, 0xAF, 0xD9, 0x77, 0x73, 0x99, 0x75, 0xE9, 0x73,
+    0x9E, 0xA7, 0x39, 0xE7, 0x69, 0x72, 0x1A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9, 0x09, 0xE9,
+    0x29, 0xE1, 0x9E, 0x3A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A,
+    0xE1, 0x9E, 0x3F, 0x1A, 0xE2, 0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92, 0xFD, 0x9E, 0x39,
+    0xF9, 0x0E, 0x77, 0x49, 0x72, 0x9E, 0x71, 0xF9, 0x70, 0xAE, 0x73, 0x97, 0x00, 0x79, 0xE9, 0x73,
+    0xAF, 0x97, 0x49, 0xDA, 0x74, 0x9D, 0x97, 0x3E, 0xA7, 0x4D, 0x77, 0x71, 0xAE, 0x49, 0xE9, 0x2F,
+    0x4A, 0xE3, 0xEA, 0x4F, 0x29, 0xE9, 0x4F, 0x2A, 0xE5, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE,
+    0x29, 0xEA, 0x4F, 0x2A, 0xE9, 0x4E, 0xA2, 0xAE, 0x49, 0xEA, 0x2F, 0x49, 0xE9, 0x2E, 0xA4, 0xAE,
+    0x29, 0xEA, 0x4F, 0x29, 0xEA, 0x39, 0xEA, 0x3F, 0x91, 0x9F, 0x4F, 0xFE, 0xA5, 0xFF, 0xCA, 0x7A,
+    0xFD, 0x97, 0x76, 0x59, 0xAA, 0xA9, 0x70, 0xAF, 0x97, 0x99, 0xAD, 0xA7, 0x19, 0xDA, 0x70, 0xEA,
+    0x71, 0xD9, 0x77, 0x3A, 0xAA, 0xA3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9, 0x09, 0xE9, 0x29, 0xE1, 0x9E,
+    0x3A, 0xE1, 0xAE, 0x3F, 0x1F, 0x3E, 0xA1, 0xEA, 0x29, 0xE9, 0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0x3F,
+    0x1A, 0xE2, 0x9E, 0xA1, 0xAE, 0x2F, 0xA1, 0xAF, 0xFD, 0x92, 0xFD, 0x9E, 0x39, 0xF9, 0x0E, 0x77,
+    0x00, 0x77, 0x77, 0x0A, 0xE9, 0x77, 0x09, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xAD, 0x77, 0x75, 0xF3,
+    0xAE, 0x49, 0xE9, 0x0E, 0xA3, 0xEA, 0x4A, 0xE0, 0xAE, 0x4E, 0xA4, 0xAF, 0xE9, 0x39, 0xE9, 0x4F,
+    0xE9, 0x4A, 0xE5, 0xFA, 0x96, 0xF4, 0x9E, 0x97, 0x0E, 0xA4, 0xAE, 0x70, 0x9E, 0x94, 0xF7, 0x09,
+    0xE9, 0x4E, 0xA7, 0x0A, 0xE5, 0xEA, 0x70, 0xF4, 0x9E, 0x97, 0x0E, 0xA4, 0xAE, 0x70, 0x9E, 0x94,
+    0xF7, 0x09, 0xEA, 0x39, 0xEA, 0x71, 0xF2, 0x9F, 0x72, 0xFF, 0xE9, 0x73, 0xFF, 0xC9, 0x75, 0xAF,
+    0xCA, 0x77, 0x77, 0x30, 0x77, 0x73, 0xAE, 0x97, 0x59, 0xE9, 0x76, 0xE9, 0x76, 0xAD, 0x59, 0xAA,
+    0xA7, 0x7A, 0xE2, 0xAA, 0xAA, 0x3A, 0xAA, 0x90, 0xEA, 0x2E, 0xA3, 0xEA, 0xF2, 0x9E, 0x92, 0x9F,
+    0xE3, 0x9E, 0x3A, 0xFA, 0x94, 0xAE, 0x3F, 0x7F, 0x3E, 0xA7, 0xEA, 0x29, 0xE9, 0x69, 0xE9, 0x2A,
+    0xE7, 0x9E, 0x3F, 0x7A, 0xE2, 0x9E, 0xA7, 0xAE, 0x2F, 0xA7, 0xAF, 0xFD, 0x97, 0x9F, 0xD9, 0xE7,
+    0x19, 0xF9, 0x0E, 0x77, 0x74, 0x77, 0x75, 0xF7, 0x73, 0xE9, 0x77, 0x29, 0xDA, 0x77, 0x39, 0xD7,
+    0x77, 0x4F, 0x3A, 0xE4, 0x9E, 0x90, 0xEA, 0x3E, 0xA4, 0xAE, 0x0A, 0xE4, 0xEA, 0x4A, 0xFE, 0x93,
+    0x9E, 0x94, 0xFE, 0x94, 0xAE, 0x5F, 0xA9, 0x6F, 0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9,
+    0x4F, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0xAE, 0x5E, 0xA7, 0x0F, 0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7,
+    0x09, 0xE9, 0x4F, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x2F, 0xFE, 0x97, 0x3F, 0xFC,
+    0x97, 0x5A, 0xFC, 0xA7, 0x77, 0x73, 0x77, 0x70, 0xF7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x09, 0xD4,
+    0x9A, 0xAA, 0x77, 0xAE, 0x2A, 0xAA, 0xA3, 0xAA, 0xA9, 0x0E, 0xA2, 0xEA, 0x3E, 0xAF, 0x29, 0xE9,
+    0x29, 0xFE, 0x39, 0xE3, 0xAF, 0xA9, 0x4A, 0xE3, 0xF7, 0xF3, 0xEA, 0x7E, 0xA2, 0x9E, 0x96, 0x9E,
+    0x92, 0xAE, 0x79, 0xE3, 0xF7, 0xAE, 0x29, 0xEA, 0x7A, 0xE2, 0xFA, 0x7A, 0xFF, 0xD9, 0x79, 0xFD,
+    0x9E, 0x71, 0x9F, 0x90, 0xE7, 0x77, 0x40, 0x79, 0xE9, 0x77, 0x1A, 0xF9, 0x77, 0x29, 0xDA, 0x77,
+    0x29, 0xD9, 0x77, 0x1E, 0xA7, 0x72, 0xD7, 0x77, 0x5F, 0x3A, 0xE4, 0x9E, 0x90, 0xEA, 0x3E, 0xA4,
+    0xAE, 0x0A, 0xE4, 0xEA, 0x4A, 0xFE, 0x93, 0x9E, 0x94, 0xFE, 0x94, 0xAE, 0x5F, 0xA9, 0x6F, 0x49,
+    0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0xAE, 0x5E, 0xA7,
+    0x0F, 0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x1F,
+    0x29, 0xF7, 0x2F, 0xFE, 0x97, 0x3F, 0xFC, 0x97, 0x5A, 0xFC, 0xA7, 0x77, 0x73, 0x59, 0xAA, 0xA9,
+    0x76, 0xAF, 0x97, 0x59, 0x9A, 0xDA, 0x77, 0x9D, 0xA7, 0x6E, 0xA7, 0x7D, 0x94, 0x9A, 0xAA, 0x77,
+    0xAE, 0x2A, 0xAA, 0xA3, 0xAA, 0xA9, 0x0E, 0xA2, 0xEA, 0x3E, 0xAF, 0x29, 0xE9, 0x29, 0xFE, 0x39,
+    0xE3, 0xAF, 0xA9, 0x4A, 0xE3, 0xF7, 0xF3, 0xEA, 0x7E, 0xA2, 0x9E, 0x96, 0x9E, 0x92, 0xAE, 0x79,
+    0xE3, 0xF7, 0xAE, 0x29, 0xEA, 0x7A, 0xE2, 0xFA, 0x7A, 0xFF, 0xD9, 0x79, 0xFD, 0x9E, 0x71, 0x9F,
+    0x90, 0xE7, 0x77, 0x40, 0x6A, 0xD9, 0x1A, 0xC9, 0x74, 0xFD, 0xAD, 0x74, 0x9D, 0xAF, 0xCA, 0x74,
+    0xAC, 0x91, 0x9D, 0x97, 0x77, 0x2F, 0x3A, 0xE4, 0x9E, 0x90, 0xEA, 0x3E, 0xA4, 0xAE, 0x0A, 0xE4,
+    0xEA, 0x4A, 0xFE, 0x93, 0x9E, 0x94, 0xFE, 0x94, 0xAE, 0x5F, 0xA9, 0x6F, 0x49, 0xE9, 0x70, 0xEA,
+    0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0xAE, 0x5E, 0xA7, 0x0F, 0x49, 0xE9,
+    0x70, 0xEA, 0x4A, 0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x2F,
+    0xFE, 0x97, 0x3F, 0xFC, 0x97, 0x5A, 0xFC, 0xA7, 0x77, 0x73, 0x4A, 0xD9, 0x1A, 0xC9, 0x71, 0xFD,
+    0xAD, 0x71, 0x9D, 0xAF, 0xCA, 0x71, 0xAC, 0x91, 0x9D, 0x92, 0x9A, 0xAA, 0x77, 0xAE, 0x2A, 0xAA,
+    0xA3, 0xAA, 0xA9, 0x0E, 0xA2, 0xEA, 0x3E, 0xAF, 0x29, 0xE9, 0x29, 0xFE, 0x39, 0xE3, 0xAF, 0xA9,
+    0x4A, 0xE3, 0xF7, 0xF3, 0xEA, 0x7E, 0xA2, 0x9E, 0x96, 0x9E, 0x92, 0xAE, 0x79, 0xE3, 0xF7, 0xAE,
+    0x29, 0xEA, 0x7A, 0xE2, 0xFA, 0x7A, 0xFF, 0xD9, 0x79, 0xFD, 0x9E, 0x71, 0x9F, 0x90, 0xE7, 0x77,
+    0x40, 0x77, 0x1F, 0x3A, 0xE4, 0x9E, 0x90, 0xEA, 0x3E, 0xA4, 0xAE, 0x0A, 0xE4, 0xEA, 0x4A, 0xFE,
+    0x93, 0x9E, 0x94, 0xFE, 0x94, 0xAE, 0x5F, 0xA9, 0x6F, 0x49, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x09,
+    0xE9, 0x4F, 0x70, 0x9E, 0x94, 0xEA, 0x70, 0xAE, 0x5E, 0xA7, 0x0F, 0x49, 0xE9, 0x70, 0xEA, 0x4A,
+    0xE7, 0x09, 0xE9, 0x4F, 0x70, 0x9E, 0xA3, 0x9E, 0xA7, 0x1F, 0x29, 0xF7, 0x2F, 0xFE, 0x97, 0x3F,
+    0xFC, 0x97, 0x5A, 0xFC, 0xA7, 0x77, 0x77, 0x09, 0x97, 0x73, 0xEA, 0x77, 0x19, 0xF7, 0x72, 0xE9,
+    0x77, 0x39, 0x77, 0x00, 0x76, 0x9A, 0xAA, 0x77, 0xAE, 0x2A, 0xAA, 0xA3, 0xAA, 0xA9, 0x0E, 0xA2,
+    0xEA, 0x3E, 0xAF, 0x29, 0xE9, 0x29, 0xFE, 0x39, 0xE3, 0xAF, 0xA9, 0x4A, 0xE3, 0xF7, 0xF3, 0xEA,
+    0x7E, 0xA2, 0x9E, 0x96, 0x9E, 0x92, 0xAE, 0x79, 0xE3, 0xF7, 0xAE, 0x29, 0xEA, 0x7A, 0xE2, 0xFA,
+    0x7A, 0xFF, 0xD9, 0x79, 0xFD, 0x9E, 0x71, 0x9F, 0x90, 0xE7, 0x77, 0x70, 0x99, 0x77, 0x0E, 0xA7,
+    0x69, 0xEA, 0x77, 0xE9, 0x77, 0x09, 0x76, 0x77, 0x29, 0xE9, 0x72, 0xEA, 0x73, 0xE7, 0x4D, 0x97,
+    0x73, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F, 0x3A, 0xE1, 0xAE, 0x93,
+    0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x72,
+    0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x70, 0x77, 0x7E, 0xA7, 0x49,
+    0xE7, 0x5A, 0xD9, 0x75, 0xAC, 0xA7, 0x77, 0x09, 0xAA, 0xA4, 0xAA, 0xAA, 0x3A, 0xE3, 0x9E, 0xA3,
+    0x9E, 0x3F, 0x49, 0xE2, 0x9E, 0xA5, 0xE9, 0x1A, 0xE6, 0xE9, 0x1E, 0xA6, 0xEA, 0x0A, 0xE7, 0xAD,
+    0xA0, 0xE9, 0x7A, 0xDA, 0xAE, 0x70, 0x9D, 0xAE, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x97, 0x2F, 0xC7,
+    0x3F, 0x97, 0x3E, 0xA7, 0x3A, 0xE7, 0x3A, 0xEA, 0x70, 0xAF, 0xD7, 0x1A, 0xFC, 0x72, 0xAE, 0x97,
+    0x30, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F, 0x3A, 0xE1, 0xAE, 0x93,
+    0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x72,
+    0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x77, 0x71, 0x99, 0x73, 0xF7,
+    0x2F, 0x72, 0xE9, 0x73, 0x97, 0x30, 0x29, 0xAA, 0xA4, 0xAA, 0xAA, 0x3A, 0xE3, 0x9E, 0xA3, 0x9E,
+    0x3F, 0x49, 0xE2, 0x9E, 0xA5, 0xE9, 0x1A, 0xE6, 0xE9, 0x1E, 0xA6, 0xEA, 0x0A, 0xE7, 0xAD, 0xA0,
+    0xE9, 0x7A, 0xDA, 0xAE, 0x70, 0x9D, 0xAE, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x97, 0x2F, 0xC7, 0x3F,
+    0x97, 0x3E, 0xA7, 0x3A, 0xE1, 0x99, 0x7A, 0xEA, 0x0E, 0xA3, 0xAF, 0xD0, 0x9E, 0xA3, 0xAF, 0xC2,
+    0xE9, 0x3A, 0xE9, 0x49, 0x50, 0x4A, 0xE9, 0x71, 0xFC, 0x97, 0x09, 0x0A, 0xDA, 0x72, 0xAD, 0x97,
+    0x1E, 0x97, 0x19, 0xD7, 0x75, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2, 0x9F, 0x2F, 0x2F,
+    0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7,
+    0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x72, 0xEA, 0x70,
+    0x7A, 0xAA, 0xA7, 0x4F, 0xC7, 0x39, 0x9E, 0x97, 0x4A, 0xD7, 0x39, 0xE9, 0x73, 0xAD, 0x77, 0x71,
+    0x9A, 0xAA, 0x4A, 0xAA, 0xA3, 0xAE, 0x39, 0xEA, 0x39, 0xE3, 0xF4, 0x9E, 0x29, 0xEA, 0x5E, 0x91,
+    0xAE, 0x6E, 0x91, 0xEA, 0x6E, 0xA0, 0xAE, 0x7A, 0xDA, 0x0E, 0x97, 0xAD, 0xAA, 0xE7, 0x09, 0xDA,
+    0xE9, 0x70, 0x9F, 0xD7, 0x2F, 0xC9, 0x72, 0xFC, 0x73, 0xF9, 0x73, 0xEA, 0x73, 0xAE, 0x73, 0xAE,
+    0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0xC7, 0x2A, 0xE9, 0x73, 0x39, 0xDA, 0x19, 0xCA, 0x49, 0xFC, 0xAD,
+    0x94, 0xDA, 0xFD, 0x5C, 0xA2, 0xAC, 0xA7, 0x72, 0xAE, 0x5F, 0x09, 0xE9, 0x3A, 0xE9, 0x1E, 0xA2,
+    0x9F, 0x2F, 0x2F, 0x3A, 0xE1, 0xAE, 0x93, 0x9E, 0x90, 0xEA, 0x5E, 0x9F, 0x6F, 0xE9, 0x6A, 0xFC,
+    0xA7, 0x9F, 0xC7, 0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA,
+    0x72, 0xEA, 0x70, 0x59, 0xDA, 0x2D, 0x7F, 0xCA, 0xE6, 0xAD, 0xAF, 0xC9, 0x6D, 0x2A, 0xCA, 0x97,
+    0x76, 0x9A, 0xAA, 0x4A, 0xAA, 0xA3, 0xAE, 0x39, 0xEA, 0x39, 0xE3, 0xF4, 0x9E, 0x29, 0xEA, 0x5E,
+    0x91, 0xAE, 0x6E, 0x91, 0xEA, 0x6E, 0xA0, 0xAE, 0x7A, 0xDA, 0x0E, 0x97, 0xAD, 0xAA, 0xE7, 0x09,
+    0xDA, 0xE9, 0x70, 0x9F, 0xD7, 0x2F, 0xC9, 0x72, 0xFC, 0x73, 0xF9, 0x73, 0xEA, 0x73, 0xAE, 0x73,
+    0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0xC7, 0x2A, 0xE9, 0x73, 0x71, 0xC9, 0x5C, 0x90, 0xAF, 0xC0,
+    0xAA, 0x1C, 0x90, 0xAA, 0x0C, 0x2A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x70, 0x9C, 0x39,
+    0xC4, 0xFC, 0xA0, 0x9C, 0x1A, 0xA1, 0x9C, 0x0A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x60,
+    0x19, 0x99, 0x99, 0x1F, 0xD9, 0x9F, 0xD0, 0x9F, 0xD0, 0x19, 0x99, 0x99, 0x1F, 0xD9, 0x9F, 0xD0,
+    0x9F, 0xD0, 0x76, 0xAF, 0xFE, 0x1F, 0xFF, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x74, 0xFF,
+    0xD9, 0x9F, 0xFD, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x77, 0x70, 0xFF, 0xFF, 0xFD, 0x99,
+    0xFF, 0xFF, 0xFD, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+    0x77, 0x70, 0xFF, 0xFF, 0xFD, 0x99, 0xFF, 0xFF, 0xFD, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9,
+    0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD,
+    0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D,
+    0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A, 0xD3, 0xD9, 0xAD, 0x3D, 0x9A,
+    0xD3, 0xD9, 0x9A, 0xA3, 0xAA, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD9, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x74, 0x9F, 0xFC, 0xA0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x2A, 0xD3, 0xE2,
+    0xE9, 0x19, 0xE2, 0xEA, 0x19, 0xE9, 0x29, 0x99, 0x20, 0x19, 0xE2, 0xF2, 0xE9, 0x1A, 0xDA, 0x2E,
+    0x29, 0xDA, 0x39, 0x93, 0x2E, 0xA1, 0x9E, 0x2E, 0xA2, 0xE2, 0xAD, 0xA2, 0xE7, 0x10, 0x0E, 0x1E,
+    0x1E, 0x1E, 0x1A, 0xD1, 0xAD, 0x29, 0x90, 0x2A, 0xD2, 0xDA, 0x2E, 0x1E, 0x2E, 0x90, 0x9E, 0x19,
+    0xE1, 0xE9, 0x1E, 0xA0, 0x9E, 0x19, 0xE9, 0x0E, 0xA2, 0x99, 0x91, 0x99, 0x92, 0x19, 0xE1, 0xEA,
+    0x1E, 0xA0, 0x9E, 0x2E, 0x1A, 0xDA, 0x1A, 0xDA, 0x1E, 0x2E, 0x1A, 0xDA, 0x19, 0xDA, 0x1E, 0x39,
+    0x92, 0x99, 0x30, 0x2E, 0xA0, 0xAE, 0x29, 0xE1, 0xEA, 0x2E, 0xA0, 0x9E, 0x3E, 0x1A, 0xDA, 0x2A,
+    0xDA, 0x1E, 0x3E, 0x19, 0xD9, 0x77, 0x9E, 0x1E, 0x99, 0xE1, 0xE9, 0x0E, 0x1E, 0x90, 0xE1, 0xAD,
+    0x90, 0xAD, 0x19, 0xDA, 0x09, 0xD9, 0x1D, 0xA1, 0x99, 0x29, 0x90, 0x4E, 0x96, 0xE7, 0xDA, 0x7D,
+    0x96, 0x9D, 0x4F, 0xFC, 0xA9, 0xFF, 0xC9, 0x9A, 0xA9, 0xDA, 0x9A, 0xA4, 0xD7, 0x9D, 0x7A, 0xD7,
+    0xDA, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xE6, 0xAD, 0xA6, 0xEA, 0x50, 0x6E, 0xA7, 0x1E,
+    0x72, 0xE7, 0x2D, 0x96, 0xAA, 0xAA, 0xDA, 0xAA, 0xA3, 0xFF, 0xD2, 0x9F, 0xFC, 0xA6, 0xDA, 0x71,
+    0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0x72, 0xAD, 0x6A, 0xFF, 0xC9, 0x2F, 0xFD, 0x3A, 0xAA, 0xAD,
+    0x9A, 0xAA, 0x6A, 0xD7, 0x2E, 0x71, 0x9E, 0x71, 0xAD, 0xA6, 0x1A, 0xE9, 0x1A, 0xFC, 0x1F, 0xDA,
+    0x9F, 0xDA, 0x9F, 0xDA, 0x0F, 0xD9, 0x0A, 0xFC, 0x29, 0xAA, 0xA1, 0x1A, 0x6C, 0xA4, 0x9E, 0x3A,
+    0xF2, 0xFD, 0x1F, 0xD9, 0x9F, 0xA1, 0xAD, 0xA3, 0xAA, 0x75, 0x1A, 0xCA, 0x1F, 0x90, 0xF9, 0x0F,
+    0x29, 0x20, 0x0A, 0xCA, 0x39, 0xD9, 0xAE, 0xA1, 0x9F, 0xFA, 0x1A, 0xFA, 0xE2, 0x9E, 0x90, 0x99,
+    0x59, 0x10, 0x0A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x0A, 0xEA, 0x1A, 0xE9, 0x1F, 0x0F, 0xA1, 0xF9,
+    0x1F, 0x0A, 0xE2, 0xAE, 0x2E, 0xA1, 0x99, 0x49, 0x94, 0x92, 0x1A, 0xCA, 0x1F, 0x1F, 0x1E, 0xA2,
+    0x92, 0x6A, 0xFC, 0x9A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x69, 0xFC,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x60, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5F, 0xCA, 0xC4, 0xC4, 0xC4, 0xFD, 0x1A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFC, 0x4C, 0x4C, 0x4F, 0xE1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x70, 0x77, 0x77, 0xAE, 0xA6, 0xDA, 0x74, 0xFD, 0xA4, 0xE7, 0x49, 0xEA, 0xE3, 0xAD, 0x75, 0xE1,
+    0xE2, 0x9D, 0x97, 0x49, 0xE1, 0xE2, 0xDA, 0x75, 0x9D, 0xA1, 0xE1, 0xE7, 0x6A, 0xD9, 0x09, 0xDA,
+    0x0A, 0xD9, 0x76, 0xAD, 0x90, 0xE9, 0x9D, 0xA0, 0xAD, 0xA4, 0xAD, 0xA1, 0x9E, 0xAE, 0x0E, 0x9F,
+    0xD2, 0xFD, 0x1F, 0xD9, 0xE0, 0xEA, 0xE9, 0x0E, 0xAE, 0x90, 0x9F, 0x0A, 0xD9, 0x9E, 0x0A, 0xD9,
+    0x9E, 0x09, 0xDA, 0x59, 0xDA, 0x0E, 0x90, 0xAD, 0x9A, 0xD9, 0x09, 0xDA, 0x5E, 0x1E, 0x1A, 0xD9,
+    0xE1, 0xAD, 0x94, 0xE2, 0xE1, 0xE0, 0xE1, 0xE4, 0xAD, 0x92, 0xE1, 0xE0, 0xE1, 0xE3, 0x9D, 0xA3,
+    0xE9, 0xE9, 0x0E, 0x9E, 0x93, 0xE4, 0xAF, 0xD1, 0xAF, 0xD3, 0xE6, 0xFA, 0x3F, 0xA7, 0x77, 0x70,
+    0x77, 0x77, 0x70, 0xAE, 0xA6, 0xDA, 0x77, 0x5F, 0xDA, 0x4E, 0x77, 0x59, 0xEA, 0xE3, 0xAD, 0x77,
+    0x6E, 0x1E, 0x29, 0xD9, 0x77, 0x59, 0xE1, 0xE2, 0xDA, 0x77, 0x69, 0xDA, 0x1E, 0x1E, 0x77, 0x7A,
+    0xD9, 0x09, 0xDA, 0x0A, 0xD9, 0x77, 0x7A, 0xD9, 0x0E, 0x99, 0xDA, 0x0A, 0xDA, 0x4A, 0xDA, 0x4A,
+    0xDA, 0x19, 0xEA, 0xE0, 0xE9, 0xFD, 0x2F, 0xD2, 0xFD, 0x1F, 0xD9, 0xE0, 0xEA, 0xE9, 0x0E, 0xAE,
+    0x90, 0xFE, 0x90, 0x9F, 0x0A, 0xD9, 0x9E, 0x0A, 0xD9, 0x9E, 0x09, 0xDA, 0x9E, 0x09, 0xDA, 0x59,
+    0xDA, 0x0E, 0x90, 0xAD, 0x9A, 0xD9, 0x09, 0xDA, 0xAD, 0x90, 0x9D, 0xA5, 0xE1, 0xE1, 0xAD, 0x9E,
+    0x1A, 0xD9, 0xE1, 0xAD, 0x94, 0xE2, 0xE1, 0xE0, 0xE1, 0xE0, 0xE1, 0xE9, 0x3A, 0xD9, 0x2E, 0x1E,
+    0x0E, 0x1E, 0x0E, 0x1E, 0x39, 0xDA, 0x3E, 0x9E, 0x90, 0xE9, 0xE9, 0x0E, 0x9E, 0xA3, 0xE4, 0xAF,
+    0xD1, 0xAF, 0xD1, 0xAF, 0xD3, 0xE6, 0xFA, 0x3F, 0xA3, 0xAE, 0xA7, 0x77, 0x77, 0x00, 0x3E, 0x92,
+    0x9D, 0xA3, 0xE3, 0xAD, 0x93, 0xDA, 0x3E, 0x4A, 0xA4, 0x3E, 0x91, 0xE3, 0x9D, 0xA1, 0xAD, 0x93,
+    0xE1, 0x9E, 0x3A, 0xD9, 0x1E, 0x4D, 0xA1, 0x9D, 0x93, 0xE2, 0xDA, 0x4A, 0xA2, 0x9A, 0xA4, 0x3E,
+    0x91, 0xE1, 0x9D, 0xA3, 0x9D, 0xA1, 0xAD, 0x91, 0xE4, 0xE1, 0x9E, 0x1A, 0xDA, 0x3A, 0xD9, 0x1E,
+    0x2E, 0x4D, 0xA1, 0x9D, 0x91, 0xAD, 0x4E, 0x2D, 0xA1, 0x9D, 0x94, 0xAA, 0x29, 0xAA, 0x29, 0xAA,
+    0x40, 0x0A, 0xD9, 0x29, 0xE3, 0xE9, 0x3D, 0xA3, 0xAD, 0x4D, 0x93, 0x9A, 0x90, 0x0A, 0xD9, 0x1E,
+    0x39, 0xE1, 0xAD, 0xA3, 0xE9, 0x1E, 0x4D, 0xA1, 0x9D, 0x93, 0xAD, 0x2E, 0x4D, 0x91, 0x9D, 0x49,
+    0xA9, 0x2A, 0xA9, 0x0A, 0xD9, 0x1E, 0x19, 0xE3, 0x9E, 0x1A, 0xDA, 0x1E, 0x93, 0xE9, 0x1E, 0x19,
+    0xE4, 0xDA, 0x19, 0xD9, 0x1A, 0xD4, 0xAD, 0x2E, 0x2D, 0xA4, 0xD9, 0x19, 0xD2, 0xAD, 0x49, 0xA9,
+    0x2A, 0xA9, 0x2A, 0xA0, 0x75, 0xC9, 0x5D, 0xA4, 0x9E, 0x4D, 0x9C, 0x3A, 0xC0, 0x9C, 0x91, 0x9C,
+    0xA1, 0xCA, 0x1D, 0x2C, 0xA0, 0xAC, 0x92, 0xD0, 0x49, 0x7D, 0x94, 0xF3, 0xF3, 0xF9, 0x2A, 0xEA,
+    0x3F, 0x4A, 0xE5, 0xEA, 0x4A, 0xE4, 0x9E, 0x5A, 0x93, 0x39, 0x4A, 0xD4, 0xEA, 0x3A, 0xE4, 0xEA,
+    0x3F, 0x3F, 0x2F, 0x2A, 0xE9, 0x1A, 0xE9, 0x29, 0xDA, 0x5A, 0x40, 0x71, 0x97, 0x4A, 0x4E, 0x4A,
+    0x4E, 0x29, 0xE9, 0x2A, 0xD3, 0xF2, 0xE2, 0xAE, 0x4F, 0x29, 0x2A, 0xE6, 0xF4, 0xAE, 0x70, 0xF2,
+    0xAE, 0x72, 0xF0, 0xAE, 0x69, 0xAA, 0x2F, 0xE2, 0xAA, 0x91, 0xEA, 0x2F, 0xC2, 0x9E, 0x1E, 0xA2,
+    0xAF, 0x29, 0xE9, 0x0A, 0xD2, 0xAF, 0xD2, 0xDA, 0x6A, 0xE9, 0xF7, 0x2A, 0xE2, 0xEA, 0x70, 0xAE,
+    0x4E, 0xA6, 0xAE, 0x6E, 0xA4, 0xAE, 0x2A, 0xD2, 0xEA, 0x3E, 0x29, 0xE9, 0x2E, 0x4C, 0x39, 0xE9,
+    0x3C, 0x97, 0x29, 0xA9, 0x70, 0x29, 0xEA, 0x19, 0xEA, 0x2A, 0xEA, 0x1A, 0xE9, 0x2A, 0xE9, 0x1F,
+    0x3F, 0x2F, 0x3F, 0x2E, 0xA3, 0xEA, 0x19, 0xE9, 0x29, 0xE9, 0x19, 0xE3, 0xAE, 0x2A, 0xE3, 0xAE,
+    0x2E, 0xA3, 0xEA, 0x2E, 0x93, 0xE9, 0x2E, 0x4E, 0x29, 0xE7, 0x77, 0x71, 0xAD, 0x3A, 0xCA, 0x39,
+    0xEA, 0x1A, 0xE9, 0x2A, 0xEA, 0x1F, 0x92, 0x9E, 0x2A, 0xE5, 0x94, 0x99, 0x40, 0x74, 0xAF, 0xC9,
+    0x1A, 0xFF, 0xA0, 0x9F, 0xFC, 0x1F, 0xA9, 0xE9, 0x1A, 0xD9, 0x0E, 0x2E, 0x09, 0xE2, 0xE9, 0xEA,
+    0x2F, 0xDA, 0x3F, 0xCA, 0x39, 0xF5, 0xAE, 0x6A, 0xD9, 0x77, 0x74, 0xAC, 0xA6, 0xAE, 0x95, 0xF9,
+    0x5A, 0xE7, 0x99, 0x70, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD, 0xA9, 0xFF, 0xD9, 0x73,
+    0x76, 0xC7, 0x1C, 0x1C, 0xA7, 0xCA, 0x19, 0xCA, 0x49, 0xCA, 0x3A, 0xDA, 0xAA, 0xDA, 0x59, 0xAE,
+    0xA9, 0x30, 0x39, 0xAD, 0xA9, 0x5F, 0xF3, 0xD9, 0x39, 0xCA, 0x1C, 0xA6, 0x9C, 0x9A, 0xA7, 0x0A,
+    0xA7, 0x40, 0x77, 0x70, 0xD7, 0x2D, 0x72, 0x9C, 0xA7, 0x2D, 0x72, 0xD9, 0x71, 0x9C, 0xA7, 0x2D,
+    0x72, 0xAC, 0x97, 0x19, 0xD7, 0x2E, 0x71, 0xAE, 0x71, 0xD9, 0xC9, 0x7D, 0x1C, 0x96, 0x9C, 0xA1,
+    0xCA, 0x6D, 0x2D, 0x5D, 0x92, 0xAC, 0x40, 0x77, 0x77, 0x72, 0x9D, 0xA7, 0x77, 0x09, 0xDA, 0x77,
+    0x4A, 0x29, 0xD7, 0x75, 0xDA, 0x0A, 0xD7, 0x74, 0xAF, 0xDA, 0x99, 0x99, 0x77, 0x19, 0xAF, 0xFC,
+    0x77, 0x4F, 0xF7, 0x72, 0x9F, 0xC1, 0x99, 0x77, 0x19, 0xE9, 0xDA, 0x77, 0x4E, 0xA0, 0xE7, 0x70,
+    0x9A, 0x91, 0xAC, 0x1A, 0xDA, 0x19, 0xA9, 0x72, 0xAD, 0x94, 0x9C, 0x92, 0x9D, 0xA7, 0x1A, 0xD7,
+    0x3A, 0xD9, 0x49, 0xCA, 0x1D, 0xA7, 0xD9, 0x0A, 0xD5, 0xFA, 0xD9, 0x6A, 0xEA, 0xDA, 0x5A, 0xFF,
+    0xE2, 0x9F, 0xFE, 0x4A, 0xFF, 0x59, 0xFF, 0x4F, 0xC9, 0xAA, 0xA5, 0xFC, 0x99, 0xAA, 0x29, 0xEA,
+    0xD7, 0x0E, 0xAD, 0x95, 0xE9, 0x0D, 0xA6, 0xEA, 0x0E, 0x59, 0xD1, 0xE7, 0xD1, 0xAD, 0x97, 0x1A,
+    0xCA, 0x73, 0x9D, 0x97, 0x77, 0x70, 0x70, 0xFD, 0x90, 0xFD, 0x09, 0xFD, 0x00, 0x74, 0x9D, 0x97,
+    0x39, 0xDA, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xD9, 0x74, 0xDA, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xD9,
+    0x74, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9D,
+    0xA7, 0x4E, 0x74, 0x4A, 0xFA, 0x4F, 0xCA, 0x39, 0xEA, 0xA9, 0x3A, 0xDA, 0x6A, 0xD9, 0x6E, 0x7E,
+    0x69, 0xE6, 0xAD, 0xA6, 0xEA, 0x95, 0xFC, 0xA4, 0xFC, 0xA3, 0x9E, 0x99, 0x4A, 0xDA, 0x6E, 0x96,
+    0xE6, 0x9E, 0x6A, 0xDA, 0x6A, 0xD9, 0x6E, 0xAA, 0xA4, 0xFC, 0xA3, 0x9F, 0xC9, 0x30, 0x4F, 0xCA,
+    0x39, 0xFC, 0x93, 0x9A, 0xAE, 0x7E, 0x69, 0xE6, 0xAD, 0xA6, 0xE9, 0x6E, 0x7E, 0x49, 0x9A, 0xDA,
+    0x39, 0xFC, 0xA3, 0x9F, 0xC9, 0x49, 0x9E, 0x69, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE6, 0x9E,
+    0x4A, 0xAE, 0xA3, 0x9F, 0xC9, 0x3A, 0xFC, 0x40, 0x77, 0x71, 0xAF, 0xC9, 0x3A, 0xFC, 0x92, 0xAF,
+    0xFA, 0x0A, 0xFF, 0xA1, 0x9F, 0xFC, 0x09, 0xFF, 0xC2, 0xCA, 0x2A, 0xE9, 0x0C, 0xA2, 0xAE, 0x96,
+    0x9E, 0x69, 0xE9, 0x6A, 0xE6, 0xAE, 0x6A, 0xEA, 0x5A, 0xEA, 0x49, 0xFA, 0x49, 0xFA, 0x49, 0xF9,
+    0x49, 0xF9, 0x5F, 0x6F, 0x69, 0xE6, 0x9E, 0x7A, 0xDA, 0x6A, 0xDA, 0x77, 0x77, 0x77, 0x5A, 0xCA,
+    0x7A, 0xCA, 0x7F, 0x6F, 0x7F, 0x6F, 0x7E, 0xA6, 0xEA, 0x70, 0x97, 0x19, 0x70, 0x77, 0x5A, 0xFC,
+    0x93, 0xAE, 0x90, 0xAF, 0xFA, 0x2F, 0x19, 0xFF, 0xC2, 0xF2, 0xCA, 0x2A, 0xE9, 0x1E, 0xA7, 0x9E,
+    0x19, 0xE9, 0x7A, 0xE1, 0xAE, 0x7A, 0xEA, 0x1A, 0xE5, 0x9F, 0xA2, 0xEA, 0x49, 0xF9, 0x3E, 0x94,
+    0xF5, 0xE4, 0x9E, 0x59, 0xE4, 0xAD, 0xA5, 0xAD, 0xA7, 0x77, 0x77, 0x2A, 0xCA, 0x6A, 0xCA, 0x4F,
+    0x5F, 0x4F, 0x5F, 0x4E, 0xA5, 0xEA, 0x59, 0x70, 0x95, 0x77, 0x69, 0xEA, 0x2A, 0xFC, 0x94, 0xAE,
+    0xA0, 0x9F, 0xFA, 0x3A, 0xE9, 0x1F, 0xFC, 0x3F, 0x2C, 0xA2, 0x9E, 0x92, 0xF7, 0x0E, 0x92, 0xEA,
+    0x7A, 0xE2, 0x9E, 0x96, 0xAE, 0xA2, 0xAE, 0x6F, 0xC3, 0xAE, 0x5F, 0xA4, 0xEA, 0x4F, 0x95, 0xE9,
+    0x39, 0xE7, 0xE4, 0xAD, 0xA7, 0x77, 0x77, 0x6A, 0xD5, 0xAC, 0xA6, 0x9E, 0xA3, 0xAE, 0x95, 0xAE,
+    0xA3, 0xF9, 0x59, 0xE4, 0xAE, 0x70, 0x96, 0x99, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99,
+    0xFF, 0xEA, 0x9F, 0xFE, 0xA7, 0x9E, 0x70, 0xE9, 0x79, 0xE7, 0x0E, 0x97, 0xAD, 0xA7, 0x9E, 0x70,
+    0xEA, 0x7A, 0xE7, 0x0E, 0x97, 0xAE, 0x79, 0xE6, 0x9F, 0xFC, 0xA2, 0x9F, 0xFE, 0x19, 0xCA, 0x9A,
+    0xFE, 0xA0, 0x9C, 0xA0, 0x9F, 0xF0, 0x9C, 0xA0, 0x9F, 0xF9, 0x9C, 0xA0, 0x9F, 0xF9, 0x9C, 0xA0,
+    0x9F, 0xF9, 0x9C, 0xA0, 0x9F, 0xF9, 0x9C, 0xA0, 0x9F, 0xF0, 0x9C, 0xA0, 0x9F, 0xF0, 0x9C, 0xA0,
+    0x9F, 0xE9, 0x09, 0xCA, 0x09, 0xFD, 0x91, 0x9C, 0xA0, 0x9C, 0xA9, 0x99, 0x39, 0xCA, 0x09, 0xCA,
+    0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA,
+    0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA, 0x69, 0xCA, 0x09, 0xCA,
+    0x77, 0x40, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xE1, 0xAF, 0xEA, 0xAD, 0x1F, 0xF1, 0xD0,
+    0x9F, 0xF1, 0xD0, 0xAF, 0xF1, 0xD0, 0xAF, 0xF1, 0xD0, 0xAF, 0xF1, 0xD0, 0xAF, 0xF1, 0xD0, 0x9F,
+    0xF1, 0xD1, 0xFF, 0x99, 0xD1, 0x9F, 0xFE, 0x3A, 0xFF, 0xC0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x93,
+    0xFF, 0xE2, 0xDA, 0xAF, 0xF1, 0xD1, 0xFF, 0x90, 0xD1, 0xFF, 0xA0, 0xD1, 0xFF, 0xA0, 0xD1, 0xFF,
+    0xA0, 0xD1, 0xFF, 0xA0, 0xD1, 0xFF, 0xA0, 0xD1, 0xFF, 0x90, 0xD9, 0x9F, 0xF1, 0xFF, 0xE9, 0x1F,
+    0xFC, 0xA2, 0x77, 0x2D, 0xA7, 0x1E, 0x49, 0x3D, 0x94, 0xDA, 0x09, 0xD4, 0x9F, 0xE9, 0x99, 0x91,
+    0x9A, 0xFF, 0xC9, 0x3F, 0xF9, 0x2F, 0xC9, 0x09, 0x92, 0xEA, 0xE4, 0xAE, 0x0A, 0xD9, 0x49, 0xC1,
+    0x9E, 0x71, 0xCA, 0x30, 0x29, 0xD9, 0x2F, 0x19, 0xF2, 0xE9, 0x39, 0x77, 0x77, 0x74, 0xE9, 0x2E,
+    0x3E, 0x3E, 0x3A, 0xD3, 0xAD, 0x71, 0x79, 0xAD, 0xA9, 0x71, 0xFF, 0x7D, 0x93, 0x9C, 0xA5, 0xCA,
+    0x69, 0xC9, 0x3A, 0xA7, 0x0A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xC7, 0x1C, 0x4C, 0xA7, 0xCA, 0x49, 0xCA, 0x49, 0xCA,
+    0x6A, 0xDA, 0xAA, 0xDA, 0x70, 0x9A, 0xEA, 0x96, 0x77, 0x79, 0xD9, 0x73, 0x9D, 0xA7, 0xA2, 0xAD,
+    0x79, 0xDA, 0x0A, 0xD7, 0xAF, 0xDA, 0x99, 0x9A, 0x49, 0xFF, 0xD6, 0x9F, 0xF5, 0x9F, 0xC1, 0x99,
+    0x49, 0xE9, 0xDA, 0x7E, 0x90, 0xE7, 0x0A, 0xA1, 0xAD, 0x97, 0x39, 0xC9, 0x77, 0x71, 0xDA, 0x74,
+    0xE7, 0x99, 0x2D, 0xA7, 0xE0, 0x9D, 0x79, 0xFE, 0x99, 0x99, 0x93, 0x9A, 0xFF, 0xC9, 0x6F, 0xF9,
+    0x5F, 0xC9, 0x09, 0x95, 0xEA, 0xE7, 0x9E, 0x0A, 0xD9, 0x79, 0xC2, 0xE7, 0x4C, 0xA9, 0x50, 0x72,
+    0x9E, 0x2A, 0xD9, 0xF9, 0x1E, 0x0F, 0x19, 0xD9, 0x1D, 0xA1, 0xE6, 0x9D, 0xA6, 0xAD, 0x7E, 0x6A,
+    0xD9, 0x6E, 0x69, 0xDA, 0x6E, 0x7E, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x1A, 0xCA, 0x1E, 0x1A, 0xE9,
+    0x9D, 0xA1, 0xAE, 0x9A, 0xD9, 0x19, 0xE7, 0x09, 0x10, 0x3A, 0xAA, 0xA9, 0x73, 0x99, 0x2A, 0xFF,
+    0xCA, 0x95, 0x9D, 0x1F, 0xFF, 0xFA, 0xAE, 0xA0, 0x9D, 0xA9, 0x19, 0xAA, 0xFF, 0xF1, 0xAC, 0xA7,
+    0x09, 0xAF, 0xDA, 0x77, 0x72, 0x59, 0x99, 0x97, 0xAF, 0xD5, 0xDA, 0x91, 0x9D, 0x3C, 0xA6, 0xD1,
+    0xAA, 0x70, 0xC1, 0xA7, 0x1A, 0x00, 0x5D, 0x70, 0x91, 0xD9, 0x09, 0x4D, 0xA0, 0xD9, 0x9D, 0x3E,
+    0xAD, 0xAE, 0x4F, 0xF3, 0x99, 0xAF, 0xDA, 0x99, 0x9A, 0xFF, 0xFA, 0x9F, 0xFF, 0xA2, 0x9F, 0xDA,
+    0x49, 0xFF, 0xA3, 0xE9, 0xD9, 0xE9, 0x29, 0xC1, 0xD9, 0x0C, 0xA7, 0xD9, 0x72, 0x99, 0x50, 0x70,
+    0x97, 0x09, 0xE9, 0x6A, 0xEA, 0x69, 0xEA, 0x79, 0xA9, 0x77, 0x77, 0x5A, 0xCA, 0x7A, 0xE9, 0x6A,
+    0xEA, 0x7E, 0x77, 0x77, 0x77, 0x39, 0x99, 0x79, 0xE9, 0x6A, 0xEA, 0x69, 0xE9, 0x79, 0xA9, 0x00,
+    0x3E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x29, 0xDA, 0x09, 0xDA, 0x09, 0xE0, 0x9E, 0x3E, 0x1E, 0x1E,
+    0x1E, 0x3A, 0xD9, 0x0A, 0xD9, 0x0A, 0xD9, 0x0A, 0xD9, 0x3D, 0xA1, 0xDA, 0x1D, 0xA1, 0xDA, 0x3E,
+    0x1E, 0x1E, 0x1E, 0x4A, 0xA2, 0xAA, 0x2A, 0xA2, 0xAA, 0x40, 0x70, 0x97, 0x79, 0xE9, 0x75, 0xAE,
+    0xA7, 0x59, 0xE9, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x71, 0xAC, 0xA7, 0x2A, 0xD9, 0xAE, 0x97,
+    0x1F, 0xAE, 0x97, 0x09, 0xF0, 0xE7, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x09, 0x99, 0x76, 0x9E,
+    0x97, 0x5A, 0xEA, 0x75, 0x9E, 0x97, 0x69, 0xA9, 0x70, 0x19, 0x74, 0x91, 0x9E, 0x72, 0xEA, 0xAE,
+    0xA7, 0x1F, 0xAE, 0x97, 0x1F, 0x09, 0xA9, 0x72, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x71, 0xAD, 0x76,
+    0x9E, 0xA7, 0x59, 0xEA, 0x76, 0xE7, 0x77, 0x77, 0x77, 0x71, 0x99, 0x97, 0x39, 0x90, 0x9E, 0x97,
+    0x1E, 0xAA, 0xEA, 0x70, 0x9F, 0x9E, 0x97, 0x1E, 0xA0, 0x9A, 0x97, 0x3A, 0x90, 0x19, 0x19, 0xE0,
+    0xAE, 0xAA, 0xE9, 0x0A, 0xAA, 0x77, 0x77, 0x77, 0x39, 0xA9, 0x0A, 0xE9, 0xAE, 0xA9, 0xE9, 0x09,
+    0x91, 0x69, 0x97, 0x4E, 0xA7, 0x3F, 0x73, 0xF7, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x99, 0x97, 0x99,
+    0x90, 0x9E, 0x95, 0x9E, 0x9A, 0xEA, 0x5A, 0xEA, 0x9E, 0x95, 0x9E, 0x90, 0x9A, 0x97, 0x9A, 0x97,
+    0x77, 0x77, 0x77, 0xAA, 0x74, 0xF7, 0x3F, 0x73, 0xEA, 0x74, 0x99, 0x60, 0x70, 0xAA, 0x97, 0x70,
+    0xE7, 0x2A, 0xCA, 0x2E, 0x2A, 0xCA, 0x3A, 0xE9, 0x1E, 0x1A, 0xE9, 0x2A, 0xE9, 0x1E, 0x1A, 0xE9,
+    0x29, 0xE2, 0xE1, 0x9E, 0x72, 0xE7, 0x70, 0xE7, 0x09, 0x99, 0x99, 0x99, 0x9E, 0x99, 0x99, 0x99,
+    0x99, 0x9F, 0xFF, 0xFE, 0x9F, 0xFF, 0xFE, 0x09, 0x99, 0x99, 0x99, 0x9E, 0x99, 0x99, 0x99, 0x99,
+    0x70, 0xE7, 0x70, 0xE7, 0x2E, 0x2E, 0x19, 0xDA, 0x3A, 0xE9, 0x1E, 0x1F, 0x92, 0xAE, 0x91, 0xE1,
+    0xF9, 0x3E, 0x2E, 0x19, 0xDA, 0x72, 0xE7, 0x70, 0xDA, 0x70, 0x0A, 0xD0, 0x9E, 0xA9, 0xEA, 0x0E,
+    0x97, 0x70, 0x92, 0xE9, 0x9F, 0x9E, 0xA0, 0xAC, 0xA7, 0x70, 0x9A, 0xA0, 0x9E, 0xAA, 0xEA, 0x9E,
+    0x91, 0x99, 0x00, 0x19, 0x91, 0xEA, 0x9F, 0x0F, 0x1A, 0x92, 0x99, 0x1E, 0xA9, 0xF0, 0xF1, 0xA9,
+    0x29, 0x2E, 0xA9, 0xF0, 0xF1, 0xA9, 0x29, 0x2E, 0xA9, 0xF0, 0xF1, 0xAA, 0x00, 0x5A, 0xFA, 0x1A,
+    0xA3, 0xAA, 0x3A, 0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5F, 0xE3, 0xD3, 0xD3,
+    0xFE, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFA, 0x0F, 0x19, 0xD9, 0x2D, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x79, 0x93, 0xD2, 0xAD, 0xA1, 0xF0, 0xAF, 0xA1, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x7D, 0x2C, 0x99, 0xC0, 0xAA, 0x1A, 0xA0, 0xAA, 0xAA, 0x2A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5A, 0xDA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA1, 0xFD,
+    0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x49, 0x5F, 0xC2, 0xFD, 0xA0, 0xAD, 0xA9, 0xE0, 0xE1,
+    0xE9, 0xDA, 0x1E, 0xAD, 0x90, 0x9E, 0xAD, 0x90, 0xAD, 0xAA, 0xD9, 0x0E, 0x09, 0xFD, 0xA1, 0xFD,
+    0x3A, 0xDA, 0x20, 0x29, 0xA3, 0xDA, 0x29, 0xA3, 0x99, 0x2A, 0xD2, 0xDA, 0x2D, 0x92, 0xD2, 0x9D,
+    0x2A, 0xD2, 0xDA, 0x2D, 0x91, 0x77, 0xE9, 0x4F, 0x4F, 0xC3, 0xAF, 0xC2, 0xAD, 0x9D, 0xA1, 0x9D,
+    0x09, 0xD9, 0x1D, 0xA9, 0xE9, 0x0A, 0xFF, 0x9A, 0xFF, 0x49, 0xDA, 0x59, 0xAA, 0x20, 0x74, 0xFD,
+    0xA2, 0xFD, 0x91, 0x9D, 0x6D, 0xA9, 0x5F, 0xD3, 0xAA, 0xAE, 0xA6, 0xE6, 0xDA, 0x1A, 0x99, 0x9E,
+    0x91, 0xFD, 0xA2, 0x9A, 0xDA, 0x92, 0x59, 0x93, 0xAF, 0xC1, 0xFD, 0xA0, 0xAD, 0x94, 0xDA, 0x09,
+    0x29, 0xDA, 0xEA, 0x0A, 0xEA, 0xE0, 0xAD, 0x19, 0xD9, 0xAD, 0x19, 0xD9, 0x9D, 0xA9, 0xE1, 0xFD,
+    0x92, 0xAD, 0xA2, 0x72, 0x9F, 0xEA, 0x0A, 0xFE, 0x94, 0x9E, 0x5E, 0x59, 0xDA, 0x5E, 0x5E, 0x59,
+    0xDA, 0x5E, 0x5E, 0x95, 0xAA, 0x95, 0x49, 0x95, 0x9F, 0xC2, 0x9E, 0xAD, 0xA1, 0xAD, 0x1D, 0xA1,
+    0x9D, 0xA9, 0xD9, 0x2F, 0xC9, 0x29, 0xFC, 0x91, 0xAD, 0xA9, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xAF,
+    0xD9, 0x29, 0xEA, 0x91, 0x39, 0x94, 0xAF, 0xA1, 0xAF, 0xD9, 0x0E, 0x1D, 0xA0, 0xD9, 0x1E, 0x0D,
+    0xA0, 0x9E, 0x0F, 0xEA, 0x1A, 0xCA, 0xAD, 0x94, 0xE0, 0x99, 0x9A, 0xE9, 0x0A, 0xFC, 0x91, 0x9D,
+    0xA9, 0x30, 0x3A, 0x69, 0xC9, 0x59, 0xC9, 0x3F, 0xE1, 0xFE, 0x39, 0xC9, 0x59, 0xC9, 0x6A, 0x30,
+    0x0A, 0xAA, 0xAA, 0xAA, 0x1F, 0xE0, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x99, 0x99, 0x99, 0x99, 0x09,
+    0x99, 0x99, 0x99, 0x0F, 0xE9, 0x99, 0x99, 0x99, 0x90, 0x70, 0xAC, 0x91, 0x9C, 0xA2, 0xD2, 0xAC,
+    0x92, 0xD2, 0x9C, 0xA2, 0xAC, 0x92, 0xD3, 0xD3, 0xD3, 0xD9, 0x2A, 0xC9, 0x3C, 0xA3, 0x99, 0x20,
+    0x71, 0xAC, 0x93, 0x9C, 0xA4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0xD3, 0xAC,
+    0xA3, 0xD3, 0xD3, 0x99, 0x40, 0x29, 0x19, 0x93, 0xAC, 0x9F, 0x2E, 0x99, 0xD9, 0x1D, 0xA1, 0xD1,
+    0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xD1, 0xDA, 0x1D, 0xA1, 0xD9, 0x1D, 0x91, 0xD2, 0xD1, 0x49, 0x6F,
+    0xC3, 0xFD, 0xA1, 0xAE, 0x9E, 0x1E, 0x1E, 0x1E, 0x1E, 0x09, 0xDA, 0x1E, 0x09, 0xDA, 0x09, 0xDA,
+    0x0A, 0xDA, 0x0E, 0x90, 0x9F, 0xE2, 0xFD, 0x4A, 0xDA, 0x30, 0x74, 0x9E, 0x3A, 0xF1, 0x9F, 0xD1,
+    0xAD, 0xAD, 0xA2, 0xA0, 0xAD, 0x94, 0xE5, 0xE4, 0x9D, 0xA4, 0x9D, 0xA4, 0xAD, 0x94, 0xAA, 0xA2,
+    0x59, 0x94, 0xAF, 0xC2, 0x9F, 0xE2, 0xA9, 0x1E, 0x6E, 0x5A, 0xD9, 0x4E, 0x94, 0xE9, 0x39, 0xE4,
+    0xAF, 0xE1, 0xFF, 0x1A, 0xAA, 0xAA, 0xAA, 0x90, 0x49, 0x95, 0xFD, 0x3F, 0xDA, 0x29, 0x2D, 0xA5,
+    0x9D, 0x92, 0x9F, 0x93, 0xAE, 0xA6, 0x9D, 0xA6, 0xE1, 0xCA, 0x99, 0xAD, 0xA1, 0xFE, 0x29, 0xAD,
+    0xA9, 0x20, 0x77, 0xF4, 0xAE, 0xA3, 0xAF, 0x92, 0x9F, 0xC2, 0x9D, 0x9E, 0x2D, 0x90, 0xDA, 0x1E,
+    0x9A, 0xDA, 0x1F, 0xFA, 0x9F, 0xF9, 0x4E, 0x6A, 0xA9, 0x10, 0x73, 0xAF, 0xD2, 0xFD, 0xA2, 0xD9,
+    0x59, 0xD6, 0xAF, 0xC9, 0x29, 0xAA, 0xAE, 0x6E, 0x6E, 0x1A, 0xA9, 0x9A, 0xDA, 0x1F, 0xE2, 0x9A,
+    0xDA, 0x93, 0x59, 0x94, 0x9F, 0xC2, 0xAF, 0xD1, 0x9D, 0xA5, 0xE0, 0x99, 0x3F, 0xE1, 0x9E, 0xAA,
+    0xDA, 0x09, 0xD9, 0x1D, 0xA0, 0x9D, 0x91, 0xDA, 0x1D, 0xA9, 0xE2, 0xAF, 0xCA, 0x39, 0xDA, 0x92,
+    0x72, 0x9F, 0xEA, 0x0A, 0xFE, 0x95, 0xE5, 0xAD, 0x94, 0x9D, 0xA5, 0xE5, 0xAD, 0x94, 0x9E, 0x5E,
+    0x5A, 0xD9, 0x5A, 0xAA, 0x50, 0x49, 0x49, 0xFC, 0x2E, 0xAE, 0x09, 0xD9, 0x0E, 0x09, 0xDA, 0x9D,
+    0xA1, 0xAF, 0xA1, 0x9F, 0xC9, 0x09, 0xDA, 0x9E, 0x0E, 0x1A, 0xD9, 0xE1, 0xE0, 0x9F, 0xDA, 0x19,
+    0xAD, 0xA9, 0x10, 0x49, 0x49, 0xFA, 0x19, 0xFD, 0xA0, 0xE1, 0xE0, 0xDA, 0x1A, 0xD0, 0xE0, 0x9E,
+    0x0F, 0xF1, 0xAD, 0x9D, 0xA4, 0xE0, 0x99, 0x9A, 0xE9, 0x0A, 0xFC, 0x91, 0x9D, 0xAA, 0x30, 0x2A,
+    0x95, 0xCA, 0x5C, 0xA2, 0xFE, 0x9A, 0xFD, 0x92, 0xCA, 0x5C, 0xA5, 0xA9, 0x20, 0xAA, 0xAA, 0xAA,
+    0xA0, 0xFE, 0x90, 0x09, 0x99, 0x99, 0x90, 0xAF, 0xDA, 0x09, 0x99, 0x99, 0x91, 0x99, 0x99, 0x99,
+    0x0A, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x00, 0x71, 0x9C, 0xA2, 0x9D, 0x3D, 0x39, 0xCA, 0x3D, 0x4D,
+    0x39, 0xCA, 0x3A, 0xC9, 0x3A, 0xC9, 0x3A, 0xC9, 0x3A, 0xCA, 0x39, 0xCA, 0x4D, 0x49, 0x93, 0x71,
+    0x9C, 0x94, 0xD4, 0xD4, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x39, 0xCA, 0x3D, 0x39, 0xCA, 0x3D,
+    0x3A, 0xC9, 0x39, 0x93, 0x2D, 0xA0, 0xD2, 0xFE, 0x1E, 0x1D, 0xA0, 0x9D, 0x91, 0xD9, 0x09, 0xD2,
+    0xD1, 0xAD, 0x1A, 0xD1, 0x9D, 0x9A, 0xDA, 0x2F, 0xD9, 0x3A, 0x90, 0x99, 0x20, 0x2A, 0xE9, 0x2E,
+    0xAD, 0x1D, 0xA1, 0xD9, 0x9D, 0x99, 0xE0, 0xAF, 0xCA, 0x1A, 0xD5, 0x9D, 0x91, 0xA2, 0xFD, 0x39,
+    0xAA, 0x92, 0x2A, 0xDA, 0x29, 0xFD, 0x1D, 0xA1, 0xD9, 0x9D, 0x2D, 0x9A, 0xD2, 0xD9, 0xAD, 0x19,
+    0xD0, 0x9D, 0x99, 0xDA, 0x1F, 0xCA, 0x39, 0xA9, 0x92, 0x2A, 0xCA, 0x1A, 0xCA, 0x3A, 0xD0, 0xAD,
+    0x5D, 0xAD, 0x6A, 0xE9, 0x6A, 0xDA, 0x6A, 0xF5, 0x9D, 0x0D, 0xA3, 0x9D, 0x90, 0xAD, 0x39, 0x99,
+    0x29, 0x92, 0x1A, 0xEA, 0x2A, 0xFC, 0xA5, 0xAD, 0x39, 0xAA, 0xD1, 0xFE, 0x0A, 0xD1, 0xDA, 0x0D,
+    0xA0, 0xAD, 0x1A, 0xFC, 0x92, 0x9A, 0xA9, 0x30, 0x2A, 0xD6, 0xDA, 0x6D, 0x95, 0x9D, 0x9D, 0xA2,
+    0x9F, 0xD9, 0x1A, 0xD1, 0xDA, 0x1D, 0xA1, 0xD9, 0x1D, 0x2D, 0x19, 0xD1, 0x9D, 0x1A, 0xCA, 0x1A,
+    0xD1, 0xDA, 0x1D, 0xA1, 0x99, 0x29, 0x91, 0x2A, 0xD7, 0xDA, 0x7D, 0x96, 0x9D, 0x19, 0xD2, 0xAD,
+    0x09, 0xD9, 0x2D, 0xA9, 0xD4, 0xFC, 0x5F, 0xC4, 0x9D, 0xAD, 0x93, 0xAC, 0xA0, 0xAD, 0x3D, 0x91,
+    0xD9, 0x29, 0x92, 0x99, 0x91, 0x2A, 0xD2, 0xDA, 0x2D, 0x91, 0x9D, 0x29, 0xD2, 0xAC, 0xA2, 0xD9,
+    0x2D, 0x29, 0xD2, 0xAD, 0x2D, 0xA2, 0x99, 0x20, 0x2C, 0x99, 0xDA, 0x09, 0xDA, 0x2A, 0xFD, 0xAF,
+    0x91, 0xAD, 0x1E, 0x1D, 0x91, 0xDA, 0x1D, 0xA1, 0xD9, 0x1D, 0x2D, 0x2D, 0x19, 0xD1, 0x9D, 0x19,
+    0xD1, 0xAD, 0x1A, 0xCA, 0x1A, 0xCA, 0x1D, 0xA1, 0xDA, 0x1D, 0x91, 0x99, 0x29, 0x92, 0x99, 0x10,
+    0x1C, 0xA9, 0xDA, 0x19, 0xFD, 0xA0, 0xAD, 0x90, 0xDA, 0x0D, 0xA1, 0xDA, 0x0D, 0x91, 0xD9, 0x9D,
+    0x19, 0xD0, 0xAD, 0x19, 0xD0, 0xDA, 0x1A, 0xCA, 0x09, 0x92, 0x99, 0x10, 0x2C, 0xA9, 0xDA, 0x29,
+    0xFD, 0x91, 0xAD, 0x1D, 0xA1, 0xD9, 0x1D, 0xA1, 0xD2, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xDA, 0x9D,
+    0xA1, 0xFE, 0x2D, 0x99, 0xA9, 0x29, 0xD6, 0x9D, 0x6A, 0xCA, 0x60, 0x19, 0xEA, 0x19, 0xDA, 0xD9,
+    0x0A, 0xD4, 0x9E, 0x93, 0x9E, 0x94, 0xE0, 0x99, 0x1E, 0x0A, 0xFC, 0x91, 0x9A, 0xA9, 0x20, 0x29,
+    0x93, 0x9C, 0xA2, 0xAF, 0x99, 0xFC, 0x90, 0x9D, 0x3A, 0xCA, 0x3D, 0x93, 0xD3, 0x9D, 0x99, 0x2F,
+    0x3A, 0xA9, 0x10, 0x77, 0x19, 0xFC, 0xA5, 0xFE, 0xA4, 0xFF, 0x93, 0x9E, 0xA2, 0x94, 0xF7, 0x09,
+    0xE9, 0x19, 0x99, 0x99, 0x99, 0x9E, 0x1A, 0xFD, 0xAA, 0xE1, 0xFE, 0x9A, 0xE1, 0xEA, 0x99, 0x90,
+    0x9E, 0x90, 0xE5, 0xFF, 0xE9, 0x1A, 0xFF, 0xD3, 0x9F, 0xFC, 0x6E, 0x71, 0x9E, 0x71, 0xAF, 0xD9,
+    0x5A, 0xFD, 0x95, 0xFE, 0x20, 0x71, 0xD0, 0x9C, 0x97, 0x09, 0xCA, 0x0A, 0xC6, 0x9A, 0xFE, 0x5F,
+    0xFD, 0x93, 0xFF, 0xE3, 0xFE, 0x09, 0xD9, 0x2A, 0xF9, 0xCA, 0x0A, 0xC4, 0xF0, 0xAC, 0x1C, 0xA3,
+    0xAE, 0x90, 0xCA, 0x0A, 0xC9, 0x3F, 0x0A, 0xC9, 0x0D, 0x4F, 0x0D, 0x09, 0xCA, 0x4E, 0xA9, 0xCA,
+    0x0A, 0xC5, 0xEA, 0xAC, 0x1D, 0x5F, 0xD0, 0xAC, 0x95, 0xFC, 0x90, 0xD0, 0x94, 0x9F, 0xCA, 0xF5,
+    0xFF, 0xD6, 0xFF, 0xC6, 0xD9, 0xDA, 0x97, 0x9C, 0x90, 0xD7, 0x19, 0x91, 0x99, 0x70, 0x77, 0x59,
+    0xAF, 0xCA, 0x95, 0xFF, 0xD4, 0xFF, 0xE3, 0xFC, 0x92, 0xAC, 0x92, 0x9F, 0x72, 0xF7, 0x29, 0xEA,
+    0x72, 0xAE, 0x19, 0xD0, 0x9D, 0x2F, 0x1A, 0xD9, 0xDA, 0x2F, 0x1F, 0xD9, 0x2E, 0xA1, 0xEA, 0x5E,
+    0xA1, 0xE6, 0xF0, 0x9E, 0x6F, 0x0A, 0xDA, 0x6A, 0xEA, 0xE9, 0x9A, 0x5F, 0xFD, 0x59, 0xFF, 0xC6,
+    0x9F, 0xE9, 0x77, 0x30, 0x4F, 0xFC, 0xA3, 0x9F, 0xFC, 0x93, 0xAF, 0xFC, 0x93, 0xF9, 0x99, 0x99,
+    0x94, 0xEA, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2A, 0xEA, 0xAA, 0xAA, 0x94, 0xFF, 0xCA, 0x4F, 0xFC,
+    0x93, 0x9E, 0xA9, 0x99, 0x99, 0x4A, 0xE7, 0x19, 0xF9, 0x99, 0x5A, 0xFF, 0x5A, 0xFE, 0xA6, 0x9E,
+    0x97, 0x1A, 0xE7, 0x2F, 0x71, 0x77, 0x70, 0x9F, 0xCA, 0x97, 0xAF, 0xF6, 0x9F, 0xF9, 0x6F, 0x92,
+    0xA7, 0xEA, 0x73, 0x9E, 0x97, 0x1A, 0xAF, 0xAA, 0xAA, 0x95, 0xFF, 0xD9, 0x5A, 0xAF, 0xAA, 0xAA,
+    0x70, 0xEA, 0x71, 0xAF, 0xFC, 0xA5, 0xFF, 0xD9, 0x7F, 0x73, 0x9E, 0x97, 0x29, 0xE9, 0x72, 0xAF,
+    0xFE, 0xA3, 0xFF, 0xF9, 0x3F, 0xFF, 0x30, 0x77, 0xAA, 0x97, 0x71, 0xAD, 0x77, 0x19, 0xD7, 0x9A,
+    0xA1, 0xAD, 0xA1, 0xFC, 0xA4, 0xE0, 0xFD, 0xAF, 0xDA, 0x3E, 0xAF, 0xFF, 0xD2, 0x9F, 0xA0, 0x9F,
+    0xC9, 0x0A, 0xE9, 0x1A, 0xF2, 0xF9, 0x19, 0xE9, 0x1F, 0x3F, 0x29, 0xE2, 0xF2, 0x9E, 0x92, 0xAE,
+    0x2E, 0xA2, 0xAE, 0x3F, 0x19, 0xE9, 0x2F, 0x3E, 0xA1, 0xAE, 0x2F, 0xA2, 0x9E, 0x91, 0xF1, 0xAF,
+    0xA2, 0x9E, 0x2E, 0xA1, 0xFC, 0x92, 0xAE, 0x2E, 0x90, 0xFD, 0x3F, 0x19, 0xE0, 0xAF, 0xD3, 0xEA,
+    0x6D, 0x97, 0x71, 0xDA, 0x77, 0x19, 0xCA, 0x77, 0x3A, 0xE3, 0xAD, 0x4F, 0x92, 0xDA, 0x39, 0xF9,
+    0x19, 0xD9, 0x39, 0xF9, 0x19, 0xD9, 0x3A, 0xFA, 0x1A, 0xD4, 0xDA, 0xAC, 0xA1, 0xE2, 0x9A, 0xFD,
+    0xAA, 0xEA, 0x1A, 0xFF, 0xFC, 0x2A, 0xD9, 0xAD, 0x0A, 0xD9, 0x3A, 0xD0, 0x9D, 0x0E, 0x29, 0xFF,
+    0xFC, 0x19, 0xFF, 0xFC, 0x29, 0xD9, 0x1D, 0x9D, 0x93, 0xAD, 0x2D, 0xAD, 0x4E, 0x2F, 0xC4, 0xE2,
+    0xFA, 0x4D, 0xA2, 0xFA, 0x39, 0xD9, 0x2F, 0x93, 0x39, 0xFC, 0xA7, 0x6F, 0xFA, 0x74, 0xFF, 0xC9,
+    0x73, 0xE9, 0x9A, 0xF7, 0x29, 0xE2, 0xAE, 0x72, 0xAE, 0x2A, 0xE1, 0xAC, 0xA5, 0xEA, 0x2F, 0x09,
+    0xD9, 0x5E, 0x91, 0x9E, 0xA0, 0xE9, 0x99, 0x29, 0xEA, 0xAF, 0xC9, 0xFE, 0x29, 0xFF, 0xC9, 0xFE,
+    0xA2, 0xAF, 0xF9, 0x1E, 0xA5, 0xFA, 0xA9, 0x93, 0xE9, 0x5E, 0x97, 0xE5, 0x9E, 0x79, 0xE5, 0xAE,
+    0x7A, 0xE5, 0xEA, 0x7A, 0xEA, 0xA9, 0x2E, 0xA7, 0x9F, 0xCA, 0x2E, 0x97, 0x0A, 0xF9, 0x77, 0x70,
+    0x3F, 0xCA, 0x97, 0x7F, 0xF7, 0x59, 0xFF, 0xC7, 0x4A, 0xE9, 0x9F, 0x97, 0x3F, 0x19, 0xE9, 0x1A,
+    0xEA, 0x93, 0xEA, 0x19, 0xE9, 0x0F, 0xE9, 0x2E, 0x91, 0xAE, 0x9F, 0xF2, 0x9E, 0x19, 0xF0, 0xE9,
+    0x19, 0x92, 0xAF, 0xFC, 0x90, 0xE9, 0x6F, 0xFC, 0x91, 0xF9, 0x5F, 0xF9, 0x2A, 0xFA, 0x39, 0xE9,
+    0x9E, 0x93, 0xAF, 0xA2, 0xAE, 0x1E, 0xA4, 0x9F, 0x2A, 0xE1, 0xF5, 0x9E, 0x2E, 0xA1, 0xAE, 0x09,
+    0x39, 0xE2, 0xEA, 0x19, 0xE0, 0xAC, 0xA9, 0xAF, 0x19, 0xE9, 0x19, 0xE9, 0xAF, 0xE9, 0x1A, 0xE3,
+    0xEA, 0x9F, 0xD9, 0x77, 0x71, 0x2D, 0x92, 0x9D, 0xA2, 0x9D, 0x91, 0x9D, 0x92, 0xEA, 0x2A, 0xD2,
+    0x9D, 0x92, 0xEA, 0x2E, 0x29, 0xD9, 0x1A, 0xEA, 0x19, 0xD9, 0x29, 0xD2, 0xF9, 0x1E, 0x39, 0xD1,
+    0x9D, 0xAC, 0x91, 0xDA, 0x3A, 0xD1, 0xDA, 0xD9, 0x09, 0xD9, 0x3A, 0xD1, 0xD0, 0xD9, 0x0E, 0x3F,
+    0xFF, 0xFC, 0x19, 0xFF, 0xFF, 0xC3, 0xE9, 0xD1, 0xD0, 0xE5, 0xDA, 0xAD, 0x1D, 0x9D, 0x95, 0xDA,
+    0xD9, 0x1D, 0xAD, 0x6F, 0xC2, 0xFA, 0x6F, 0xA1, 0x9F, 0x96, 0xF9, 0x19, 0xF7, 0xF2, 0x9E, 0xA7,
+    0xE9, 0x29, 0xE6, 0x39, 0xFE, 0xA4, 0x9D, 0x93, 0xAF, 0xFC, 0x92, 0xAD, 0x93, 0xFF, 0xE2, 0xE4,
+    0xE4, 0xEA, 0x1E, 0x39, 0xE1, 0x99, 0x09, 0xE0, 0x9E, 0x3A, 0xDA, 0x0E, 0x99, 0xE0, 0xAD, 0xA3,
+    0xAD, 0x90, 0xE0, 0x9D, 0xA0, 0xE9, 0x3E, 0x09, 0xE0, 0xAD, 0xA0, 0xE4, 0xE0, 0xAD, 0xA0, 0xE9,
+    0x0E, 0x39, 0xE0, 0xAD, 0x90, 0xE0, 0x9D, 0xA3, 0xAD, 0xA0, 0xE0, 0x9E, 0x0A, 0xD9, 0x3E, 0x90,
+    0xE0, 0x9D, 0xA0, 0xE9, 0x3E, 0x09, 0xE0, 0xAD, 0x90, 0xE4, 0xE0, 0xAD, 0xA0, 0x99, 0x90, 0xAD,
+    0xA3, 0x9D, 0xA0, 0xE9, 0x39, 0xE9, 0x3A, 0xD9, 0x0F, 0xAA, 0xAF, 0xA4, 0xE9, 0x0F, 0xFD, 0xA5,
+    0xE0, 0x9F, 0xFA, 0x95, 0x73, 0xE9, 0x73, 0x9E, 0x97, 0x9F, 0xFC, 0x69, 0xFF, 0xA6, 0x99, 0x99,
+    0xEA, 0x97, 0x3E, 0x95, 0x9F, 0x99, 0xE5, 0x9F, 0xFD, 0x5F, 0xFD, 0xA4, 0xFA, 0x1A, 0xEA, 0x4E,
+    0xA2, 0x9E, 0x93, 0xAE, 0x92, 0x9E, 0x4A, 0xE3, 0x9E, 0x4F, 0x3E, 0xA4, 0xF3, 0xE9, 0x4F, 0x2F,
+    0x94, 0xAF, 0xFD, 0x6F, 0xDA, 0xE6, 0x9F, 0x90, 0xDA, 0x77, 0x77, 0x69, 0xFF, 0xC9, 0x5A, 0xFF,
+    0xC9, 0x50, 0x77, 0x7A, 0xFA, 0x96, 0x9F, 0xF5, 0x9F, 0xF9, 0x5F, 0x91, 0x9A, 0x5F, 0x72, 0x9E,
+    0xA7, 0x1A, 0xFA, 0xAA, 0xA5, 0xAF, 0xFC, 0x59, 0xAF, 0xAA, 0xAA, 0x69, 0xE9, 0x71, 0xFF, 0xC5,
+    0x9F, 0xFA, 0x7A, 0xE7, 0x3A, 0xE7, 0x39, 0xEA, 0x39, 0x6F, 0xFC, 0x69, 0xFF, 0x79, 0xFD, 0xA7,
+    0x73, 0x3A, 0xE3, 0xAE, 0x93, 0xF2, 0x9F, 0x4E, 0xA2, 0xF4, 0x9E, 0x91, 0xF9, 0x49, 0xE1, 0xAE,
+    0xA5, 0xAE, 0x09, 0xEA, 0x6F, 0x0F, 0x7E, 0xAA, 0xE6, 0xFF, 0xFA, 0x29, 0xFF, 0xF9, 0x39, 0xFF,
+    0xC9, 0x95, 0xF0, 0xAE, 0x7E, 0xA0, 0x9E, 0x95, 0x9E, 0x91, 0xF5, 0xAE, 0x2F, 0x5F, 0x2A, 0xE9,
+    0x4E, 0xA2, 0x9E, 0xA4, 0xE9, 0x3F, 0x30, 0x19, 0xFF, 0xF2, 0xAF, 0xFF, 0x2F, 0xFF, 0xA2, 0x99,
+    0x99, 0xF9, 0x99, 0x97, 0xF0, 0xA7, 0x1F, 0xD9, 0x79, 0xFC, 0x97, 0x0A, 0xEA, 0x72, 0xF7, 0x1A,
+    0xFC, 0x9C, 0xA5, 0xFF, 0xC9, 0x5A, 0x99, 0xFA, 0x71, 0xAE, 0x97, 0x1A, 0xF7, 0x09, 0xFC, 0xA7,
+    0x0A, 0xCA, 0xEA, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x00, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x75, 0x9F,
+    0xFD, 0xA7, 0x5F, 0xFF, 0x74, 0x99, 0x49, 0xFA, 0x75, 0x9A, 0xAA, 0x2F, 0x75, 0xAE, 0x29, 0xEA,
+    0x74, 0xEA, 0x3F, 0x74, 0xE9, 0x3F, 0x73, 0x9E, 0x4F, 0x73, 0xAE, 0x4E, 0xA2, 0x9A, 0xA9, 0x4F,
+    0x39, 0xEA, 0x09, 0xFD, 0x92, 0xEA, 0x3A, 0xE1, 0xFF, 0x2E, 0x93, 0xF0, 0xAD, 0xA1, 0xAD, 0x90,
+    0x9E, 0x3F, 0x90, 0xE2, 0x9D, 0x90, 0xAE, 0x1A, 0xFA, 0x1E, 0x2A, 0xD9, 0x0F, 0xFD, 0xA1, 0x9E,
+    0x19, 0xE1, 0xFF, 0xC9, 0x2A, 0xFF, 0xA0, 0x9F, 0xDA, 0x94, 0xEA, 0xFA, 0x77, 0xE7, 0x74, 0x9E,
+    0x77, 0x49, 0xDA, 0x77, 0x4A, 0xD9, 0x77, 0x4E, 0x77, 0x5E, 0x70, 0x77, 0x72, 0xAF, 0x97, 0x1F,
+    0xE7, 0x0A, 0xFE, 0xA7, 0xF0, 0x9D, 0xA6, 0x9E, 0x90, 0x9D, 0xA6, 0x9E, 0x90, 0xAD, 0x96, 0x9E,
+    0x90, 0xE7, 0x9E, 0x9A, 0xDA, 0x70, 0xFE, 0x71, 0xFD, 0x72, 0xAF, 0x97, 0xA1, 0x9F, 0x79, 0xC9,
+    0x09, 0xF7, 0xDA, 0x9F, 0xC9, 0x5F, 0xFD, 0xA4, 0xAF, 0xD0, 0xEA, 0x39, 0xD0, 0xAD, 0x1F, 0x3D,
+    0x90, 0x9C, 0x2F, 0x70, 0x92, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x1F, 0xD9, 0x71, 0xFC, 0xA7, 0x2A,
+    0xE9, 0x40, 0x3F, 0xDA, 0x79, 0xFF, 0x95, 0xAF, 0xFC, 0x5F, 0x1A, 0xE9, 0x29, 0xFF, 0xFC, 0x1A,
+    0xFF, 0xFC, 0x29, 0xE3, 0xE9, 0x2A, 0xFA, 0xAA, 0xAE, 0xA2, 0xFF, 0xFC, 0x3E, 0xA1, 0xF9, 0x39,
+    0xFF, 0xD4, 0xAF, 0xFA, 0x5A, 0xFD, 0xA9, 0x6E, 0xA7, 0x3E, 0x97, 0x29, 0xE7, 0x3A, 0xE7, 0x3F,
+    0x73, 0x77, 0x71, 0x9C, 0xA7, 0x29, 0xAF, 0xDA, 0x6F, 0xFE, 0x39, 0xFF, 0xE9, 0x3F, 0xF0, 0x9A,
+    0xC3, 0xFC, 0x0A, 0xCA, 0x69, 0xF1, 0xD9, 0x6F, 0x91, 0xD7, 0xF2, 0xD6, 0x9E, 0xA1, 0x9F, 0xE1,
+    0x9E, 0x91, 0xAF, 0xE1, 0xAE, 0x91, 0xFF, 0x1A, 0xE9, 0x1D, 0x1E, 0xA1, 0xAE, 0x90, 0x9D, 0x09,
+    0xE9, 0x19, 0xF0, 0x9C, 0xA0, 0xAE, 0x3F, 0xAA, 0xC9, 0x0F, 0x3A, 0xFF, 0xEA, 0x4A, 0xFF, 0xDA,
+    0x59, 0xFF, 0xA7, 0x0A, 0xCA, 0x75, 0xAC, 0x97, 0x00, 0x70, 0xAF, 0x74, 0xFC, 0x73, 0xAF, 0xC7,
+    0x3F, 0xD7, 0x2A, 0xFD, 0x72, 0xE9, 0xE9, 0x70, 0xAE, 0x0E, 0x95, 0xFF, 0xFD, 0xA1, 0x9A, 0xAF,
+    0xAA, 0xFA, 0xA5, 0xEA, 0x1A, 0xDA, 0x49, 0xAF, 0xAA, 0xAF, 0xA9, 0x2F, 0xFF, 0xDA, 0x29, 0xF9,
+    0x99, 0x9A, 0xE9, 0x4E, 0xA3, 0x9E, 0x4A, 0xE4, 0x9E, 0x4E, 0xA4, 0x9E, 0x92, 0xAE, 0x6E, 0x91,
+    0x9E, 0xA6, 0xE9, 0x10, 0x77, 0x3A, 0xFC, 0xA5, 0x9F, 0xFC, 0x5F, 0xFC, 0xA4, 0xAA, 0x91, 0x9F,
+    0x72, 0xAE, 0x72, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0x90, 0xFF, 0xFC, 0x92, 0x9F, 0xF4, 0x9F,
+    0xE9, 0x3A, 0xFF, 0xFC, 0x0A, 0xFF, 0xFA, 0x1F, 0x72, 0xEA, 0x72, 0xF3, 0x9A, 0xA3, 0xAF, 0xFC,
+    0xA4, 0xFF, 0xCA, 0x5A, 0xFD, 0xA7, 0x72, 0x70, 0x9D, 0x71, 0x9F, 0xDA, 0x6F, 0xFD, 0x39, 0xFF,
+    0xDA, 0x3F, 0xCA, 0xD0, 0xAC, 0x3F, 0xA0, 0x9C, 0xA5, 0x9F, 0x1A, 0xCA, 0x5A, 0xE9, 0x1D, 0x95,
+    0xF2, 0xD6, 0xEA, 0x19, 0xD5, 0x9E, 0x91, 0xAC, 0xA5, 0x9E, 0x91, 0xAC, 0x95, 0x9E, 0x91, 0xD9,
+    0x59, 0xE9, 0x1D, 0x69, 0xF0, 0x9D, 0x7F, 0xAA, 0xCA, 0x09, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xC6,
+    0x9F, 0xE9, 0x70, 0x9D, 0x74, 0xAC, 0xA7, 0x49, 0xA9, 0x3A, 0xA9, 0x7D, 0xA2, 0x9D, 0x96, 0xAD,
+    0x92, 0xE6, 0xAF, 0xAA, 0xFA, 0xAA, 0x19, 0xFF, 0xFE, 0x1A, 0xFF, 0xFE, 0x3E, 0xA1, 0xAE, 0x95,
+    0x9E, 0x91, 0xAE, 0x69, 0xE2, 0xF6, 0xAE, 0x2E, 0xA6, 0xF1, 0x9E, 0x96, 0xEA, 0x19, 0xE6, 0x9E,
+    0x91, 0xAE, 0x6A, 0xE2, 0xF6, 0xF2, 0xFE, 0x3E, 0xA2, 0xAF, 0xD3, 0xE9, 0x3F, 0xCA, 0x77, 0x40,
+    0x77, 0x74, 0x9F, 0xCA, 0x97, 0x1F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xF9, 0x19, 0xA9, 0x79, 0xE9,
+    0x75, 0x9E, 0x97, 0x59, 0xF7, 0x6F, 0xC7, 0x59, 0xFC, 0x97, 0x49, 0xFC, 0x97, 0x5F, 0xC7, 0x6F,
+    0x92, 0x9C, 0xA0, 0x9A, 0xA0, 0x9C, 0xA0, 0xE9, 0x19, 0xFE, 0xAE, 0x0E, 0x91, 0xAC, 0x9D, 0x0A,
+    0xD0, 0xD9, 0xE2, 0x9F, 0x0A, 0xC9, 0x0F, 0xCA, 0x3A, 0xFD, 0xAA, 0xFA, 0x5F, 0xFE, 0x96, 0xD0,
+    0x9D, 0x0A, 0xC9, 0x79, 0xCA, 0x0A, 0xC9, 0x0A, 0xC9, 0x60, 0x09, 0xFF, 0xEA, 0x0A, 0xFF, 0xEA,
+    0x0A, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x69, 0xFF, 0xEA, 0x0A, 0xFF, 0xE9,
+    0x0F, 0xFF, 0x94, 0xF7, 0x1E, 0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xEA,
+    0x70, 0x9E, 0x97, 0x0A, 0xE9, 0x70, 0xAE, 0x70, 0x19, 0xFF, 0xD2, 0xAF, 0xFD, 0x2A, 0xFD, 0x72,
+    0xF5, 0xAA, 0xAA, 0xFA, 0xA2, 0x9F, 0xFD, 0x39, 0x99, 0x9F, 0x97, 0xAE, 0x94, 0xFE, 0xA5, 0xFD,
+    0xA6, 0xEA, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xF7, 0x1A, 0xE9, 0x71, 0xF5,
+    0x39, 0xE7, 0x1A, 0xE7, 0x1E, 0xA1, 0x9A, 0x5F, 0xEA, 0x4A, 0xFD, 0xA3, 0xAF, 0xC9, 0x6F, 0xD0,
+    0x9A, 0xC5, 0xFF, 0x39, 0xAF, 0xDA, 0x39, 0xFC, 0x96, 0xAA, 0xF3, 0xAA, 0xA9, 0x1E, 0xA3, 0xE9,
+    0x1E, 0xA2, 0xAE, 0x2E, 0x91, 0x9E, 0xA1, 0x9E, 0x1A, 0xF2, 0xAF, 0xFC, 0x92, 0xFF, 0xC4, 0xFE,
+    0x97, 0x72, 0x77, 0x1A, 0xE7, 0x2A, 0xDA, 0xD7, 0x1D, 0x1D, 0x70, 0x9D, 0x1D, 0x70, 0x9E, 0xAD,
+    0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xFD, 0x19, 0xFF, 0xFC, 0xA2, 0x9D, 0xAA, 0xAA, 0xAA, 0xAE, 0x3D,
+    0x7D, 0x3D, 0x0A, 0xC0, 0xC9, 0x1C, 0xA2, 0x9F, 0xF0, 0xAC, 0x92, 0xAE, 0xAD, 0xAF, 0x3A, 0xD1,
+    0xA1, 0x9A, 0xA3, 0xF7, 0x2F, 0xCA, 0x29, 0x69, 0x0F, 0xE9, 0x7A, 0xFD, 0x71, 0xAF, 0xC7, 0x74,
+    0x72, 0x9E, 0x77, 0xAE, 0x77, 0xAD, 0xA7, 0x7E, 0xA7, 0x7E, 0x97, 0x39, 0xAA, 0xFC, 0xA9, 0x79,
+    0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0x3A, 0xFA, 0x9E, 0xA9, 0xFA, 0x2F, 0x2E, 0x91, 0xF1, 0x9E, 0x91,
+    0x9E, 0x2A, 0xE1, 0xAE, 0x2A, 0xE2, 0xAE, 0x1E, 0xA2, 0xEA, 0x2F, 0x1E, 0x92, 0xE9, 0x2E, 0xA0,
+    0x9E, 0x71, 0x9E, 0x90, 0xAE, 0x71, 0x9E, 0x1F, 0x71, 0xAE, 0x1E, 0xA7, 0x1E, 0xA0, 0x49, 0xFD,
+    0xA9, 0x6A, 0xFF, 0xA5, 0xFF, 0xD9, 0x4E, 0xA9, 0x9A, 0xEA, 0x4E, 0x92, 0xF3, 0x9E, 0x3F, 0x3A,
+    0xE3, 0xEA, 0x3F, 0x2F, 0x91, 0xAA, 0xFA, 0xFD, 0x2F, 0xFF, 0x3F, 0xFD, 0xA4, 0x9F, 0x99, 0x97,
+    0x0E, 0xA7, 0x1A, 0xAF, 0xAA, 0xA6, 0xFF, 0xA6, 0xAF, 0xAA, 0xA9, 0x7F, 0x73, 0xEA, 0x71, 0x72,
+    0x91, 0x99, 0x73, 0x9C, 0x1D, 0x73, 0xAC, 0x1C, 0xA7, 0x2A, 0xFC, 0xA7, 0x0F, 0xFD, 0x59, 0xFF,
+    0xE4, 0x9F, 0xD9, 0x9F, 0x4F, 0xAD, 0x1C, 0xA5, 0xAF, 0x0C, 0xA0, 0x9C, 0x95, 0xF1, 0xCA, 0x0A,
+    0xC6, 0xF1, 0xA1, 0xAA, 0x59, 0xEA, 0x74, 0x9E, 0x97, 0x5E, 0xA7, 0x5F, 0x75, 0xAE, 0x76, 0xF7,
+    0x6F, 0xA9, 0x96, 0xFF, 0xFC, 0x93, 0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x69, 0x91, 0x97, 0x0C, 0xA0,
+    0xAC, 0x70, 0xC9, 0x0D, 0x5A, 0xFD, 0xA5, 0xFF, 0xC4, 0xFF, 0xC9, 0x29, 0xE9, 0x9A, 0xEA, 0x29,
+    0xE2, 0xF2, 0xAE, 0x2E, 0xA2, 0xEA, 0x1A, 0xE9, 0x2F, 0xFC, 0x92, 0x9F, 0xEA, 0x4A, 0xFF, 0x93,
+    0xF0, 0x9F, 0x3E, 0xA1, 0x9E, 0xA2, 0xE9, 0x2E, 0xA1, 0x9E, 0x29, 0xE9, 0x1A, 0xE1, 0x9F, 0x2F,
+    0xFD, 0xA2, 0xFF, 0xCA, 0x3F, 0xEA, 0x96, 0xC9, 0x0D, 0x79, 0xC1, 0xCA, 0x79, 0x91, 0x96, 0x19,
+    0x99, 0x99, 0x1F, 0xD9, 0x9F, 0xD0, 0x9F, 0xD0, 0x72, 0xC7, 0x74, 0xE7, 0x72, 0xFC, 0x77, 0x0F,
+    0xE7, 0x6F, 0xFC, 0x74, 0xD9, 0x4A, 0xD7, 0x2D, 0xA6, 0xAD, 0x70, 0xF0, 0x9A, 0xC9, 0x19, 0xE6,
+    0xFF, 0xD1, 0x9F, 0x4F, 0xFD, 0xA1, 0x9F, 0xC2, 0xFF, 0xDA, 0x2F, 0xE0, 0xAF, 0xFC, 0xA2, 0xFF,
+    0xA0, 0xFF, 0xC2, 0xFF, 0xC2, 0xFE, 0xA1, 0xAF, 0xF4, 0xFE, 0x99, 0xFF, 0x6F, 0xFF, 0xE7, 0x0F,
+    0xC9, 0x9F, 0xD7, 0x2E, 0x91, 0x9F, 0x74, 0xD9, 0x19, 0xE7, 0x6D, 0xAA, 0xE7, 0x70, 0xFC, 0x77,
+    0x2E, 0x77, 0x4A, 0x72,
 };
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 8, 19, 9, 0, 18, 38, 0 }, // !
-    { 10, 7, 13, 2, 18, 18, 38 }, // "
-    { 17, 18, 18, 0, 18, 77, 56 }, // #
-    { 14, 21, 15, 0, 19, 74, 133 }, // $
-    { 20, 20, 22, 1, 19, 100, 207 }, // %
-    { 18, 20, 19, 0, 19, 90, 307 }, // &
-    { 5, 7, 8, 2, 18, 9, 397 }, // '
-    { 11, 22, 12, 0, 18, 61, 406 }, // (
-    { 10, 23, 9, -2, 19, 58, 467 }, // )
-    { 13, 13, 16, 2, 20, 43, 525 }, // *
-    { 13, 13, 15, 1, 15, 43, 568 }, // +
-    { 7, 7, 7, -2, 3, 13, 611 }, // ,
-    { 8, 4, 9, 0, 9, 8, 624 }, // -
-    { 5, 5, 7, 0, 4, 7, 632 }, // .
-    { 15, 19, 14, -2, 18, 72, 639 }, // /
-    { 14, 20, 15, 0, 19, 70, 711 }, // 0
-    { 11, 18, 14, 2, 18, 50, 781 }, // 1
-    { 15, 19, 15, -1, 19, 72, 831 }, // 2
-    { 14, 20, 15, 0, 19, 70, 903 }, // 3
-    { 15, 18, 15, -1, 18, 68, 973 }, // 4
-    { 14, 19, 15, 0, 18, 67, 1041 }, // 5
-    { 14, 20, 16, 1, 19, 70, 1108 }, // 6
-    { 15, 18, 16, 0, 18, 68, 1178 }, // 7
-    { 14, 20, 15, 0, 19, 70, 1246 }, // 8
-    { 13, 20, 15, 1, 19, 65, 1316 }, // 9
-    { 7, 15, 8, 0, 14, 27, 1381 }, // :
-    { 9, 18, 8, -2, 14, 41, 1408 }, // ;
-    { 13, 14, 15, 1, 16, 46, 1449 }, // <
-    { 13, 8, 15, 1, 13, 26, 1495 }, // =
-    { 13, 14, 15, 1, 16, 46, 1521 }, // >
-    { 12, 20, 14, 1, 19, 60, 1567 }, // ?
-    { 21, 21, 23, 1, 18, 111, 1627 }, // @
-    { 17, 18, 16, -2, 18, 77, 1738 }, // A
-    { 16, 18, 17, 0, 18, 72, 1815 }, // B
-    { 16, 20, 18, 1, 19, 80, 1887 }, // C
-    { 17, 18, 18, 0, 18, 77, 1967 }, // D
-    { 15, 18, 16, 0, 18, 68, 2044 }, // E
-    { 15, 18, 16, 0, 18, 68, 2112 }, // F
-    { 16, 20, 18, 1, 19, 80, 2180 }, // G
-    { 18, 18, 19, 0, 18, 81, 2260 }, // H
-    { 12, 18, 12, -1, 18, 54, 2341 }, // I
-    { 13, 24, 10, -4, 18, 78, 2395 }, // J
-    { 18, 18, 19, 0, 18, 81, 2473 }, // K
-    { 12, 18, 13, 0, 18, 54, 2554 }, // L
-    { 23, 18, 24, 0, 18, 104, 2608 }, // M
-    { 20, 18, 21, 0, 18, 90, 2712 }, // N
-    { 17, 20, 19, 1, 19, 85, 2802 }, // O
-    { 16, 18, 17, 0, 18, 72, 2887 }, // P
-    { 17, 24, 19, 1, 19, 102, 2959 }, // Q
-    { 15, 18, 16, 0, 18, 68, 3061 }, // R
-    { 14, 20, 15, 0, 19, 70, 3129 }, // S
-    { 14, 18, 17, 2, 18, 63, 3199 }, // T
-    { 17, 19, 19, 1, 18, 81, 3262 }, // U
-    { 15, 18, 18, 2, 18, 68, 3343 }, // V
-    { 23, 18, 26, 2, 18, 104, 3411 }, // W
-    { 20, 18, 19, -2, 18, 90, 3515 }, // X
-    { 15, 18, 18, 2, 18, 68, 3605 }, // Y
-    { 16, 18, 16, -1, 18, 72, 3673 }, // Z
-    { 11, 22, 11, -1, 18, 61, 3745 }, // [
-    { 7, 19, 11, 2, 18, 34, 3806 }, // <backslash>
-    { 11, 22, 10, -2, 18, 61, 3840 }, // ]
-    { 14, 12, 15, 0, 18, 42, 3901 }, // ^
-    { 12, 2, 10, -3, -2, 6, 3943 }, // _
-    { 6, 5, 10, 3, 20, 8, 3949 }, // `
-    { 14, 15, 16, 1, 14, 53, 3957 }, // a
-    { 14, 20, 15, 0, 19, 70, 4010 }, // b
-    { 12, 15, 14, 1, 14, 45, 4080 }, // c
-    { 15, 20, 17, 1, 19, 75, 4125 }, // d
-    { 13, 15, 15, 1, 14, 49, 4200 }, // e
-    { 16, 26, 14, -3, 20, 104, 4249 }, // f
-    { 15, 20, 16, 0, 14, 75, 4353 }, // g
-    { 14, 19, 15, 0, 19, 67, 4428 }, // h
-    { 9, 20, 10, 0, 20, 45, 4495 }, // i
-    { 13, 26, 10, -4, 20, 85, 4540 }, // j
-    { 16, 19, 17, 0, 19, 76, 4625 }, // k
-    { 9, 19, 10, 0, 19, 43, 4701 }, // l
-    { 22, 14, 23, 0, 14, 77, 4744 }, // m
-    { 14, 14, 15, 0, 14, 49, 4821 }, // n
-    { 13, 15, 15, 1, 14, 49, 4870 }, // o
-    { 15, 20, 15, -1, 14, 75, 4919 }, // p
-    { 14, 20, 16, 1, 14, 70, 4994 }, // q
-    { 12, 14, 13, 0, 14, 42, 5064 }, // r
-    { 12, 15, 13, 0, 14, 45, 5106 }, // s
-    { 10, 18, 12, 1, 17, 45, 5151 }, // t
-    { 14, 15, 16, 1, 14, 53, 5196 }, // u
-    { 14, 14, 16, 1, 14, 49, 5249 }, // v
-    { 20, 14, 22, 1, 14, 70, 5298 }, // w
-    { 17, 14, 16, -2, 14, 60, 5368 }, // x
-    { 17, 20, 16, -2, 14, 85, 5428 }, // y
-    { 13, 14, 13, -1, 14, 46, 5513 }, // z
-    { 12, 22, 12, -1, 18, 66, 5559 }, // {
-    { 4, 25, 14, 5, 19, 25, 5625 }, // |
-    { 11, 22, 10, -2, 18, 61, 5650 }, // }
-    { 13, 5, 15, 1, 11, 17, 5711 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5728 }, //  
-    { 8, 19, 8, -1, 14, 38, 5728 }, // ¡
-    { 12, 20, 15, 2, 19, 60, 5766 }, // ¢
-    { 17, 19, 17, -1, 19, 81, 5826 }, // £
-    { 12, 12, 14, 1, 15, 36, 5907 }, // ¤
-    { 15, 18, 17, 1, 18, 68, 5943 }, // ¥
-    { 4, 25, 14, 5, 19, 25, 6011 }, // ¦
-    { 13, 21, 14, 0, 20, 69, 6036 }, // §
-    { 9, 4, 15, 5, 19, 9, 6105 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 6114 }, // ©
-    { 10, 10, 12, 1, 19, 25, 6209 }, // ª
-    { 15, 12, 16, 0, 13, 45, 6234 }, // «
-    { 13, 8, 15, 1, 11, 26, 6279 }, // ¬
-    { 8, 4, 9, 0, 9, 8, 6305 }, // ­
-    { 19, 20, 21, 1, 19, 95, 6313 }, // ®
-    { 12, 4, 15, 2, 22, 12, 6408 }, // ¯
-    { 9, 10, 11, 1, 19, 23, 6420 }, // °
-    { 13, 16, 15, 1, 16, 52, 6443 }, // ±
-    { 10, 12, 12, 1, 22, 30, 6495 }, // ²
-    { 10, 12, 12, 1, 22, 30, 6525 }, // ³
-    { 8, 5, 11, 2, 20, 10, 6555 }, // ´
-    { 16, 20, 16, -1, 14, 80, 6565 }, // µ
-    { 14, 23, 16, 1, 19, 81, 6645 }, // ¶
-    { 6, 5, 8, 1, 11, 8, 6726 }, // ·
-    { 7, 6, 5, -3, 0, 11, 6734 }, // ¸
-    { 8, 12, 11, 2, 22, 24, 6745 }, // ¹
-    { 8, 9, 11, 2, 18, 18, 6769 }, // º
-    { 14, 12, 15, 0, 13, 42, 6787 }, // »
-    { 19, 19, 21, 1, 19, 91, 6829 }, // ¼
-    { 21, 19, 23, 1, 19, 100, 6920 }, // ½
-    { 20, 19, 22, 1, 19, 95, 7020 }, // ¾
-    { 11, 19, 12, -1, 14, 53, 7115 }, // ¿
-    { 17, 24, 16, -2, 24, 102, 7168 }, // À
-    { 18, 24, 17, -2, 24, 108, 7270 }, // Á
-    { 18, 24, 17, -2, 24, 108, 7378 }, // Â
-    { 18, 23, 17, -2, 23, 104, 7486 }, // Ã
-    { 17, 23, 16, -2, 23, 98, 7590 }, // Ä
-    { 17, 25, 16, -2, 25, 107, 7688 }, // Å
-    { 26, 18, 25, -2, 18, 117, 7795 }, // Æ
-    { 16, 25, 18, 1, 19, 100, 7912 }, // Ç
-    { 15, 24, 16, 0, 24, 90, 8012 }, // È
-    { 15, 24, 16, 0, 24, 90, 8102 }, // É
-    { 15, 24, 16, 0, 24, 90, 8192 }, // Ê
-    { 15, 23, 16, 0, 23, 87, 8282 }, // Ë
-    { 12, 24, 12, -1, 24, 72, 8369 }, // Ì
-    { 14, 24, 14, -1, 24, 84, 8441 }, // Í
-    { 14, 24, 14, -1, 24, 84, 8525 }, // Î
-    { 13, 23, 13, -1, 23, 75, 8609 }, // Ï
-    { 17, 18, 18, 0, 18, 77, 8684 }, // Ð
-    { 20, 23, 21, 0, 23, 115, 8761 }, // Ñ
-    { 17, 25, 19, 1, 24, 107, 8876 }, // Ò
-    { 17, 25, 19, 1, 24, 107, 8983 }, // Ó
-    { 17, 25, 19, 1, 24, 107, 9090 }, // Ô
-    { 17, 24, 19, 1, 23, 102, 9197 }, // Õ
-    { 17, 24, 19, 1, 23, 102, 9299 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 9401 }, // ×
-    { 17, 21, 19, 1, 19, 90, 9437 }, // Ø
-    { 17, 25, 19, 1, 24, 107, 9527 }, // Ù
-    { 17, 25, 19, 1, 24, 107, 9634 }, // Ú
-    { 17, 25, 19, 1, 24, 107, 9741 }, // Û
-    { 17, 24, 19, 1, 23, 102, 9848 }, // Ü
-    { 15, 24, 18, 2, 24, 90, 9950 }, // Ý
-    { 15, 18, 16, 0, 18, 68, 10040 }, // Þ
-    { 20, 26, 17, -4, 20, 130, 10108 }, // ß
-    { 14, 21, 16, 1, 20, 74, 10238 }, // à
-    { 14, 21, 16, 1, 20, 74, 10312 }, // á
-    { 14, 21, 16, 1, 20, 74, 10386 }, // â
-    { 14, 20, 16, 1, 19, 70, 10460 }, // ã
-    { 14, 20, 16, 1, 19, 70, 10530 }, // ä
-    { 14, 22, 16, 1, 21, 77, 10600 }, // å
-    { 21, 15, 23, 1, 14, 79, 10677 }, // æ
-    { 12, 20, 14, 1, 14, 60, 10756 }, // ç
-    { 13, 21, 15, 1, 20, 69, 10816 }, // è
-    { 13, 21, 15, 1, 20, 69, 10885 }, // é
-    { 13, 21, 15, 1, 20, 69, 10954 }, // ê
-    { 13, 20, 15, 1, 19, 65, 11023 }, // ë
-    { 8, 20, 9, 0, 20, 40, 11088 }, // ì
-    { 11, 20, 12, 0, 20, 55, 11128 }, // í
-    { 11, 20, 12, 0, 20, 55, 11183 }, // î
-    { 10, 19, 11, 0, 19, 48, 11238 }, // ï
-    { 15, 21, 16, 0, 20, 79, 11286 }, // ð
-    { 15, 19, 16, 0, 19, 72, 11365 }, // ñ
-    { 13, 21, 15, 1, 20, 69, 11437 }, // ò
-    { 13, 21, 15, 1, 20, 69, 11506 }, // ó
-    { 13, 21, 15, 1, 20, 69, 11575 }, // ô
-    { 14, 20, 16, 1, 19, 70, 11644 }, // õ
-    { 13, 20, 15, 1, 19, 65, 11714 }, // ö
-    { 13, 13, 15, 1, 15, 43, 11779 }, // ÷
-    { 14, 17, 15, 0, 15, 60, 11822 }, // ø
-    { 14, 21, 16, 1, 20, 74, 11882 }, // ù
-    { 14, 21, 16, 1, 20, 74, 11956 }, // ú
-    { 14, 21, 16, 1, 20, 74, 12030 }, // û
-    { 14, 20, 16, 1, 19, 70, 12104 }, // ü
-    { 17, 26, 16, -2, 20, 111, 12174 }, // ý
-    { 15, 25, 15, -1, 19, 94, 12285 }, // þ
-    { 17, 25, 16, -2, 19, 107, 12379 }, // ÿ
-    { 17, 22, 16, -2, 22, 94, 12486 }, // Ā
-    { 14, 19, 16, 1, 18, 67, 12580 }, // ā
-    { 18, 24, 17, -2, 24, 108, 12647 }, // Ă
-    { 14, 21, 16, 1, 20, 74, 12755 }, // ă
-    { 17, 25, 16, -2, 18, 107, 12829 }, // Ą
-    { 14, 21, 16, 1, 14, 74, 12936 }, // ą
-    { 16, 25, 18, 1, 24, 100, 13010 }, // Ć
-    { 12, 21, 14, 1, 20, 63, 13110 }, // ć
-    { 16, 25, 18, 1, 24, 100, 13173 }, // Ĉ
-    { 12, 21, 14, 1, 20, 63, 13273 }, // ĉ
-    { 16, 25, 18, 1, 24, 100, 13336 }, // Ċ
-    { 12, 21, 14, 1, 20, 63, 13436 }, // ċ
-    { 16, 25, 18, 1, 24, 100, 13499 }, // Č
-    { 13, 21, 15, 1, 20, 69, 13599 }, // č
-    { 17, 24, 18, 0, 24, 102, 13668 }, // Ď
-    { 20, 20, 22, 1, 19, 100, 13770 }, // ď
-    { 17, 18, 18, 0, 18, 77, 13870 }, // Đ
-    { 16, 20, 18, 1, 19, 80, 13947 }, // đ
-    { 15, 22, 16, 0, 22, 83, 14027 }, // Ē
-    { 13, 19, 15, 1, 18, 62, 14110 }, // ē
-    { 15, 24, 16, 0, 24, 90, 14172 }, // Ĕ
-    { 13, 21, 15, 1, 20, 69, 14262 }, // ĕ
-    { 15, 24, 16, 0, 24, 90, 14331 }, // Ė
-    { 13, 21, 15, 1, 20, 69, 14421 }, // ė
-    { 15, 25, 16, 0, 18, 94, 14490 }, // Ę
-    { 13, 20, 15, 1, 14, 65, 14584 }, // ę
-    { 16, 24, 17, 0, 24, 96, 14649 }, // Ě
-    { 14, 21, 16, 1, 20, 74, 14745 }, // ě
-    { 16, 25, 18, 1, 24, 100, 14819 }, // Ĝ
-    { 15, 26, 16, 0, 20, 98, 14919 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 15017 }, // Ğ
-    { 15, 26, 16, 0, 20, 98, 15117 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 15215 }, // Ġ
-    { 15, 26, 16, 0, 20, 98, 15315 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 15413 }, // Ģ
-    { 15, 26, 16, 0, 20, 98, 15513 }, // ģ
-    { 18, 24, 19, 0, 24, 108, 15611 }, // Ĥ
-    { 14, 25, 15, 0, 25, 88, 15719 }, // ĥ
-    { 20, 18, 21, 0, 18, 90, 15807 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 15897 }, // ħ
-    { 14, 23, 14, -1, 23, 81, 15964 }, // Ĩ
-    { 12, 19, 13, 0, 19, 57, 16045 }, // ĩ
-    { 13, 22, 13, -1, 22, 72, 16102 }, // Ī
-    { 10, 18, 11, 0, 18, 45, 16174 }, // ī
-    { 14, 24, 14, -1, 24, 84, 16219 }, // Ĭ
-    { 11, 20, 12, 0, 20, 55, 16303 }, // ĭ
-    { 12, 25, 12, -1, 18, 75, 16358 }, // Į
-    { 10, 27, 10, -1, 20, 68, 16433 }, // į
-    { 12, 24, 12, -1, 24, 72, 16501 }, // İ
-    { 8, 14, 9, 0, 14, 28, 16573 }, // ı
-    { 20, 24, 20, -1, 18, 120, 16601 }, // Ĳ
-    { 16, 26, 17, 0, 20, 104, 16721 }, // ĳ
-    { 16, 30, 13, -4, 24, 120, 16825 }, // Ĵ
-    { 15, 26, 12, -4, 20, 98, 16945 }, // ĵ
-    { 18, 24, 19, 0, 18, 108, 17043 }, // Ķ
-    { 16, 25, 17, 0, 19, 100, 17151 }, // ķ
-    { 16, 14, 17, 0, 14, 56, 17251 }, // ĸ
-    { 13, 24, 14, 0, 24, 78, 17307 }, // Ĺ
-    { 12, 25, 13, 0, 25, 75, 17385 }, // ĺ
-    { 12, 24, 13, 0, 18, 72, 17460 }, // Ļ
-    { 10, 25, 10, -1, 19, 63, 17532 }, // ļ
-    { 15, 18, 16, 0, 18, 68, 17595 }, // Ľ
-    { 14, 19, 15, 0, 19, 67, 17663 }, // ľ
-    { 13, 18, 14, 0, 18, 59, 17730 }, // Ŀ
-    { 12, 19, 13, 0, 19, 57, 17789 }, // ŀ
-    { 13, 18, 13, -1, 18, 59, 17846 }, // Ł
-    { 9, 19, 10, 0, 19, 43, 17905 }, // ł
-    { 20, 24, 21, 0, 24, 120, 17948 }, // Ń
-    { 15, 20, 16, 0, 20, 75, 18068 }, // ń
-    { 20, 24, 21, 0, 18, 120, 18143 }, // Ņ
-    { 14, 20, 15, 0, 14, 70, 18263 }, // ņ
-    { 20, 24, 21, 0, 24, 120, 18333 }, // Ň
-    { 16, 20, 17, 0, 20, 80, 18453 }, // ň
-    { 17, 18, 18, 0, 18, 77, 18533 }, // ŉ
-    { 19, 24, 20, 0, 18, 114, 18610 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 18724 }, // ŋ
-    { 17, 23, 19, 1, 22, 98, 18794 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 18892 }, // ō
-    { 17, 25, 19, 1, 24, 107, 18954 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 19061 }, // ŏ
-    { 19, 25, 21, 1, 24, 119, 19130 }, // Ő
-    { 16, 21, 18, 1, 20, 84, 19249 }, // ő
-    { 23, 20, 25, 1, 19, 115, 19333 }, // Œ
-    { 21, 15, 23, 1, 14, 79, 19448 }, // œ
-    { 16, 24, 17, 0, 24, 96, 19527 }, // Ŕ
-    { 13, 20, 14, 0, 20, 65, 19623 }, // ŕ
-    { 15, 24, 16, 0, 18, 90, 19688 }, // Ŗ
-    { 13, 20, 13, -1, 14, 65, 19778 }, // ŗ
-    { 17, 24, 18, 0, 24, 102, 19843 }, // Ř
-    { 14, 20, 15, 0, 20, 70, 19945 }, // ř
-    { 14, 25, 15, 0, 24, 88, 20015 }, // Ś
-    { 13, 21, 14, 0, 20, 69, 20103 }, // ś
-    { 14, 25, 15, 0, 24, 88, 20172 }, // Ŝ
-    { 13, 21, 14, 0, 20, 69, 20260 }, // ŝ
-    { 14, 25, 15, 0, 19, 88, 20329 }, // Ş
-    { 12, 20, 13, 0, 14, 60, 20417 }, // ş
-    { 15, 25, 16, 0, 24, 94, 20477 }, // Š
-    { 13, 21, 14, 0, 20, 69, 20571 }, // š
-    { 15, 24, 17, 1, 18, 90, 20640 }, // Ţ
-    { 10, 23, 12, 1, 17, 58, 20730 }, // ţ
-    { 14, 24, 17, 2, 24, 84, 20788 }, // Ť
-    { 13, 20, 15, 1, 19, 65, 20872 }, // ť
-    { 15, 18, 17, 1, 18, 68, 20937 }, // Ŧ
-    { 11, 18, 12, 0, 17, 50, 21005 }, // ŧ
-    { 17, 24, 19, 1, 23, 102, 21055 }, // Ũ
-    { 14, 20, 16, 1, 19, 70, 21157 }, // ũ
-    { 17, 23, 19, 1, 22, 98, 21227 }, // Ū
-    { 14, 19, 16, 1, 18, 67, 21325 }, // ū
-    { 17, 25, 19, 1, 24, 107, 21392 }, // Ŭ
-    { 14, 21, 16, 1, 20, 74, 21499 }, // ŭ
-    { 17, 26, 19, 1, 25, 111, 21573 }, // Ů
-    { 14, 22, 16, 1, 21, 77, 21684 }, // ů
-    { 18, 25, 20, 1, 24, 113, 21761 }, // Ű
-    { 16, 21, 18, 1, 20, 84, 21874 }, // ű
-    { 17, 25, 19, 1, 18, 107, 21958 }, // Ų
-    { 14, 21, 16, 1, 14, 74, 22065 }, // ų
-    { 23, 24, 26, 2, 24, 138, 22139 }, // Ŵ
-    { 20, 20, 22, 1, 20, 100, 22277 }, // ŵ
-    { 15, 24, 18, 2, 24, 90, 22377 }, // Ŷ
-    { 17, 26, 16, -2, 20, 111, 22467 }, // ŷ
-    { 15, 23, 18, 2, 23, 87, 22578 }, // Ÿ
-    { 16, 24, 16, -1, 24, 96, 22665 }, // Ź
-    { 14, 20, 14, -1, 20, 70, 22761 }, // ź
-    { 16, 24, 16, -1, 24, 96, 22831 }, // Ż
-    { 13, 20, 13, -1, 20, 65, 22927 }, // ż
-    { 17, 24, 17, -1, 24, 102, 22992 }, // Ž
-    { 15, 20, 15, -1, 20, 75, 23094 }, // ž
-    { 15, 26, 13, -3, 20, 98, 23169 }, // ſ
-    { 21, 20, 23, 1, 19, 105, 23267 }, // Ơ
-    { 18, 17, 20, 1, 16, 77, 23372 }, // ơ
-    { 25, 20, 27, 1, 19, 125, 23449 }, // Ƣ
-    { 21, 20, 23, 1, 14, 105, 23574 }, // ƣ
-    { 18, 18, 20, 1, 18, 81, 23679 }, // Ƥ
-    { 15, 26, 15, -1, 20, 98, 23760 }, // ƥ
-    { 15, 21, 16, 0, 18, 79, 23858 }, // Ʀ
-    { 14, 20, 15, 0, 19, 70, 23937 }, // Ƨ
-    { 12, 15, 13, 0, 14, 45, 24007 }, // ƨ
-    { 16, 18, 16, -1, 18, 72, 24052 }, // Ʃ
-    { 8, 26, 9, 0, 20, 52, 24124 }, // ƪ
-    { 10, 23, 12, 1, 17, 58, 24176 }, // ƫ
-    { 16, 18, 18, 1, 18, 72, 24234 }, // Ƭ
-    { 10, 21, 12, 1, 20, 53, 24306 }, // ƭ
-    { 14, 24, 17, 2, 18, 84, 24359 }, // Ʈ
-    { 23, 20, 25, 1, 19, 115, 24443 }, // Ư
-    { 20, 17, 22, 1, 16, 85, 24558 }, // ư
-    { 6, 5, 0, -11, 20, 8, 24643 }, // ̀
-    { 8, 5, 3, -6, 20, 10, 24651 }, // ́
-    { 11, 5, 8, -4, 20, 14, 24661 }, // ̂
-    { 11, 4, 1, -11, 19, 11, 24675 }, // ̃
-    { 9, 3, 7, -3, 18, 7, 24686 }, // ̄
-    { 11, 4, 9, -3, 22, 11, 24693 }, // ̅
-    { 10, 5, 8, -3, 20, 13, 24704 }, // ̆
-    { 5, 5, 6, 0, 20, 7, 24717 }, // ̇
-    { 9, 4, 8, -2, 19, 9, 24724 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 24733 }, // ̉
-    { 7, 6, 7, -1, 21, 11, 24744 }, // ̊
-    { 12, 5, 10, -3, 20, 15, 24755 }, // ̋
-    { 11, 5, 9, -3, 20, 14, 24770 }, // ̌
-    { 5, 8, 6, 0, 20, 10, 24784 }, // ̍
-    { 9, 6, 8, -2, 20, 14, 24794 }, // ̎
-    { 11, 5, 0, -12, 20, 14, 24808 }, // ̏
-    { 9, 7, 8, -2, 22, 16, 24822 }, // ̐
-    { 10, 5, 8, -3, 20, 13, 24838 }, // ̑
-    { 7, 7, 6, -2, 18, 13, 24851 }, // ̒
-    { 7, 7, 6, -2, 18, 13, 24864 }, // ̓
-    { 4, 7, 5, 0, 18, 7, 24877 }, // ̔
-    { 7, 7, 6, -2, 18, 13, 24884 }, // ̕
-    { 6, 5, 2, -5, 0, 8, 24897 }, // ̖
-    { 8, 5, 3, -6, 0, 10, 24905 }, // ̗
-    { 6, 6, 2, -5, 0, 9, 24915 }, // ̘
-    { 6, 6, 2, -5, 0, 9, 24924 }, // ̙
-    { 8, 7, 11, 2, 19, 14, 24933 }, // ̚
-    { 8, 7, 7, -2, 20, 14, 24947 }, // ̛
-    { 5, 7, 4, -2, 0, 9, 24961 }, // ̜
-    { 7, 5, 2, -6, -1, 9, 24970 }, // ̝
-    { 6, 5, 2, -5, -1, 8, 24979 }, // ̞
-    { 6, 6, 2, -5, 0, 9, 24987 }, // ̟
-    { 7, 3, 2, -6, -2, 6, 24996 }, // ̠
-    { 8, 8, 3, -6, 2, 16, 25002 }, // ̡
-    { 6, 8, 4, -3, 2, 12, 25018 }, // ̢
-    { 5, 5, 0, -12, -1, 7, 25030 }, // ̣
-    { 9, 4, 3, -7, -1, 9, 25037 }, // ̤
-    { 7, 6, 2, -6, 0, 11, 25046 }, // ̥
-    { 6, 5, 8, 1, -1, 8, 25057 }, // ̦
-    { 7, 6, 3, -5, 0, 11, 25065 }, // ̧
-    { 6, 7, 2, -5, 0, 11, 25076 }, // ̨
-    { 5, 8, 2, -4, 0, 10, 25087 }, // ̩
-    { 10, 5, 4, -7, -1, 13, 25097 }, // ̪
-    { 10, 4, 4, -7, -1, 10, 25110 }, // ̫
-    { 11, 5, 5, -7, 0, 14, 25120 }, // ̬
-    { 11, 5, 4, -8, 0, 14, 25134 }, // ̭
-    { 10, 5, 4, -7, 0, 13, 25148 }, // ̮
-    { 10, 5, 4, -7, -1, 13, 25161 }, // ̯
-    { 12, 4, 5, -8, -1, 12, 25174 }, // ̰
-    { 9, 3, 3, -7, -2, 7, 25186 }, // ̱
-    { 12, 2, 5, -8, -2, 6, 25193 }, // ̲
-    { 13, 6, 5, -9, 0, 20, 25199 }, // ̳
-    { 12, 4, 7, -6, 9, 12, 25219 }, // ̴
-    { 11, 4, 6, -6, 9, 11, 25231 }, // ̵
-    { 20, 4, 11, -10, 9, 20, 25242 }, // ̶
-    { 10, 8, 6, -5, 11, 20, 25262 }, // ̷
-    { 16, 21, 9, -8, 19, 84, 25282 }, // ̸
-    { 4, 7, 3, -2, 0, 7, 25366 }, // ̹
-    { 10, 5, 4, -7, -1, 13, 25373 }, // ̺
-    { 10, 6, 4, -7, 0, 15, 25386 }, // ̻
-    { 10, 4, 4, -7, -1, 10, 25401 }, // ̼
-    { 7, 6, 7, -1, 20, 11, 25411 }, // ̽
-    { 6, 8, 6, -1, 22, 12, 25422 }, // ̾
-    { 12, 6, 10, -3, 25, 18, 25434 }, // ̿
-    { 6, 5, 5, -2, 20, 8, 25452 }, // ̀
-    { 7, 5, 8, 0, 20, 9, 25460 }, // ́
-    { 12, 4, 16, 3, 19, 12, 25469 }, // ͂
-    { 5, 6, 6, 0, 20, 8, 25481 }, // ̓
-    { 14, 5, 11, -4, 20, 18, 25489 }, // ̈́
-    { 6, 5, 3, -4, -1, 8, 25507 }, // ͅ
-    { 12, 6, 9, -4, 20, 18, 25515 }, // ͆
-    { 12, 6, 5, -8, 0, 18, 25533 }, // ͇
-    { 8, 6, 3, -6, 0, 12, 25551 }, // ͈
-    { 6, 5, 2, -5, -1, 8, 25563 }, // ͉
-    { 10, 6, 8, -3, 20, 15, 25571 }, // ͊
-    { 11, 10, 9, -3, 24, 28, 25586 }, // ͋
-    { 11, 7, 9, -3, 22, 20, 25614 }, // ͌
-    { 10, 6, 4, -7, 0, 15, 25634 }, // ͍
-    { 5, 6, 2, -4, 0, 8, 25649 }, // ͎
-    { 18, 18, 10, -9, 18, 81, 25657 }, // ͏
-    { 5, 6, 6, 0, 20, 8, 25738 }, // ͐
-    { 4, 7, 8, 3, 22, 7, 25746 }, // ͑
-    { 10, 7, 8, -3, 22, 18, 25753 }, // ͒
-    { 5, 6, 2, -4, 0, 8, 25771 }, // ͓
-    { 5, 5, 2, -4, -1, 7, 25779 }, // ͔
-    { 5, 5, 2, -4, -1, 7, 25786 }, // ͕
-    { 10, 5, 5, -6, -1, 13, 25793 }, // ͖
-    { 5, 7, 8, 2, 21, 9, 25806 }, // ͗
-    { 5, 5, 6, 0, 20, 7, 25815 }, // ͘
-    { 6, 6, 2, -5, 0, 9, 25822 }, // ͙
-    { 10, 6, 4, -7, 0, 15, 25831 }, // ͚
-    { 5, 6, 6, 0, 20, 8, 25846 }, // ͛
-    { 20, 5, 10, -11, -1, 25, 25854 }, // ͜
-    { 20, 5, 13, -8, 19, 25, 25879 }, // ͝
-    { 14, 3, 10, -5, 18, 11, 25904 }, // ͞
-    { 14, 3, 6, -9, -1, 11, 25915 }, // ͟
-    { 21, 4, 14, -8, 19, 21, 25926 }, // ͠
-    { 20, 6, 14, -7, 22, 30, 25947 }, // ͡
-    { 21, 6, 9, -13, 0, 32, 25977 }, // ͢
-    { 7, 7, 7, -1, 22, 13, 26009 }, // ͣ
-    { 7, 7, 7, -1, 22, 13, 26022 }, // ͤ
-    { 5, 9, 6, 0, 24, 12, 26035 }, // ͥ
-    { 7, 7, 7, -1, 22, 13, 26047 }, // ͦ
-    { 7, 6, 7, -1, 21, 11, 26060 }, // ͧ
-    { 6, 7, 7, 0, 22, 11, 26071 }, // ͨ
-    { 8, 9, 8, -1, 24, 18, 26082 }, // ͩ
-    { 7, 9, 7, -1, 24, 16, 26100 }, // ͪ
-    { 10, 7, 8, -3, 22, 18, 26116 }, // ͫ
-    { 6, 7, 7, 0, 22, 11, 26134 }, // ͬ
-    { 5, 8, 6, 0, 23, 10, 26145 }, // ͭ
-    { 6, 6, 7, 0, 21, 9, 26155 }, // ͮ
-    { 8, 6, 7, -2, 21, 12, 26164 }, // ͯ
-    { 17, 18, 16, -2, 18, 77, 26176 }, // Α
-    { 16, 18, 17, 0, 18, 72, 26253 }, // Β
-    { 15, 18, 16, 0, 18, 68, 26325 }, // Γ
-    { 17, 18, 16, -2, 18, 77, 26393 }, // Δ
-    { 15, 18, 16, 0, 18, 68, 26470 }, // Ε
-    { 16, 18, 16, -1, 18, 72, 26538 }, // Ζ
-    { 18, 18, 19, 0, 18, 81, 26610 }, // Η
-    { 17, 20, 19, 1, 19, 85, 26691 }, // Θ
-    { 12, 18, 12, -1, 18, 54, 26776 }, // Ι
-    { 18, 18, 19, 0, 18, 81, 26830 }, // Κ
-    { 16, 18, 15, -2, 18, 72, 26911 }, // Λ
-    { 23, 18, 24, 0, 18, 104, 26983 }, // Μ
-    { 20, 18, 21, 0, 18, 90, 27087 }, // Ν
-    { 15, 18, 16, 0, 18, 68, 27177 }, // Ξ
-    { 17, 20, 19, 1, 19, 85, 27245 }, // Ο
-    { 18, 18, 19, 0, 18, 81, 27330 }, // Π
-    { 16, 18, 17, 0, 18, 72, 27411 }, // Ρ
-    { 16, 18, 16, -1, 18, 72, 27483 }, // Σ
-    { 14, 18, 17, 2, 18, 63, 27555 }, // Τ
-    { 15, 18, 18, 2, 18, 68, 27618 }, // Υ
-    { 21, 20, 23, 1, 19, 105, 27686 }, // Φ
-    { 20, 18, 19, -2, 18, 90, 27791 }, // Χ
-    { 21, 18, 24, 2, 18, 95, 27881 }, // Ψ
-    { 19, 19, 19, -1, 19, 91, 27976 }, // Ω
-    { 14, 15, 16, 1, 14, 53, 28067 }, // α
-    { 16, 26, 16, -1, 20, 104, 28120 }, // β
-    { 12, 20, 14, 1, 14, 60, 28224 }, // γ
-    { 16, 21, 17, 0, 20, 84, 28284 }, // δ
-    { 12, 15, 13, 0, 14, 45, 28368 }, // ε
-    { 14, 25, 15, 0, 19, 88, 28413 }, // ζ
-    { 14, 20, 15, 0, 14, 70, 28501 }, // η
-    { 13, 21, 15, 1, 20, 69, 28571 }, // θ
-    { 8, 15, 10, 1, 14, 30, 28640 }, // ι
-    { 16, 14, 17, 0, 14, 56, 28670 }, // κ
-    { 16, 21, 15, -2, 20, 84, 28726 }, // λ
-    { 16, 20, 16, -1, 14, 80, 28810 }, // μ
-    { 12, 14, 14, 1, 14, 42, 28890 }, // ν
-    { 15, 25, 16, 0, 19, 94, 28932 }, // ξ
-    { 13, 15, 15, 1, 14, 49, 29026 }, // ο
-    { 18, 15, 20, 1, 14, 68, 29075 }, // π
-    { 15, 20, 15, -1, 14, 75, 29143 }, // ρ
-    { 12, 20, 14, 1, 14, 60, 29218 }, // ς
-    { 16, 15, 17, 0, 14, 60, 29278 }, // σ
-    { 12, 15, 14, 1, 14, 45, 29338 }, // τ
-    { 14, 15, 16, 1, 14, 53, 29383 }, // υ
-    { 18, 20, 20, 1, 14, 90, 29436 }, // φ
-    { 18, 21, 17, -2, 14, 95, 29526 }, // χ
-    { 19, 25, 21, 1, 19, 119, 29621 }, // ψ
-    { 20, 15, 22, 1, 14, 75, 29740 }, // ω
-    { 17, 24, 16, -2, 18, 102, 29815 }, // Ạ
-    { 14, 20, 16, 1, 14, 70, 29917 }, // ạ
-    { 17, 25, 16, -2, 25, 107, 29987 }, // Ả
-    { 14, 22, 16, 1, 21, 77, 30094 }, // ả
-    { 22, 25, 21, -2, 25, 138, 30171 }, // Ấ
-    { 17, 22, 19, 1, 21, 94, 30309 }, // ấ
-    { 17, 25, 16, -2, 25, 107, 30403 }, // Ầ
-    { 14, 22, 16, 1, 21, 77, 30510 }, // ầ
-    { 20, 26, 19, -2, 26, 130, 30587 }, // Ẩ
-    { 16, 23, 18, 1, 22, 92, 30717 }, // ẩ
-    { 18, 27, 17, -2, 27, 122, 30809 }, // Ẫ
-    { 14, 24, 16, 1, 23, 84, 30931 }, // ẫ
-    { 18, 30, 17, -2, 24, 135, 31015 }, // Ậ
-    { 14, 26, 16, 1, 20, 91, 31150 }, // ậ
-    { 18, 26, 17, -2, 26, 117, 31241 }, // Ắ
-    { 14, 23, 16, 1, 22, 81, 31358 }, // ắ
-    { 18, 26, 17, -2, 26, 117, 31439 }, // Ằ
-    { 14, 23, 16, 1, 22, 81, 31556 }, // ằ
-    { 18, 27, 17, -2, 27, 122, 31637 }, // Ẳ
-    { 14, 23, 16, 1, 22, 81, 31759 }, // ẳ
-    { 18, 27, 17, -2, 27, 122, 31840 }, // Ẵ
-    { 14, 24, 16, 1, 23, 84, 31962 }, // ẵ
-    { 18, 30, 17, -2, 24, 135, 32046 }, // Ặ
-    { 14, 26, 16, 1, 20, 91, 32181 }, // ặ
-    { 15, 24, 16, 0, 18, 90, 32272 }, // Ẹ
-    { 13, 20, 15, 1, 14, 65, 32362 }, // ẹ
-    { 15, 25, 16, 0, 25, 94, 32427 }, // Ẻ
-    { 13, 22, 15, 1, 21, 72, 32521 }, // ẻ
-    { 16, 23, 17, 0, 23, 92, 32593 }, // Ẽ
-    { 14, 20, 16, 1, 19, 70, 32685 }, // ẽ
-    { 19, 25, 20, 0, 25, 119, 32755 }, // Ế
-    { 17, 22, 19, 1, 21, 94, 32874 }, // ế
-    { 15, 25, 16, 0, 25, 94, 32968 }, // Ề
-    { 13, 22, 15, 1, 21, 72, 33062 }, // ề
-    { 18, 26, 19, 0, 26, 117, 33134 }, // Ể
-    { 16, 23, 18, 1, 22, 92, 33251 }, // ể
-    { 15, 27, 16, 0, 27, 102, 33343 }, // Ễ
-    { 13, 24, 15, 1, 23, 78, 33445 }, // ễ
-    { 15, 30, 16, 0, 24, 113, 33523 }, // Ệ
-    { 13, 26, 15, 1, 20, 85, 33636 }, // ệ
-    { 12, 25, 12, -1, 25, 75, 33721 }, // Ỉ
-    { 10, 21, 11, 0, 21, 53, 33796 }, // ỉ
-    { 12, 24, 12, -1, 18, 72, 33849 }, // Ị
-    { 10, 26, 10, -1, 20, 65, 33921 }, // ị
-    { 17, 25, 19, 1, 19, 107, 33986 }, // Ọ
-    { 13, 20, 15, 1, 14, 65, 34093 }, // ọ
-    { 17, 26, 19, 1, 25, 111, 34158 }, // Ỏ
-    { 13, 22, 15, 1, 21, 72, 34269 }, // ỏ
-    { 20, 26, 22, 1, 25, 130, 34341 }, // Ố
-    { 17, 22, 19, 1, 21, 94, 34471 }, // ố
-    { 17, 26, 19, 1, 25, 111, 34565 }, // Ồ
-    { 13, 22, 15, 1, 21, 72, 34676 }, // ồ
-    { 19, 27, 21, 1, 26, 129, 34748 }, // Ổ
-    { 16, 23, 18, 1, 22, 92, 34877 }, // ổ
-    { 17, 28, 19, 1, 27, 119, 34969 }, // Ỗ
-    { 13, 24, 15, 1, 23, 78, 35088 }, // ỗ
-    { 17, 30, 19, 1, 24, 128, 35166 }, // Ộ
-    { 13, 26, 15, 1, 20, 85, 35294 }, // ộ
-    { 21, 25, 23, 1, 24, 132, 35379 }, // Ớ
-    { 18, 21, 20, 1, 20, 95, 35511 }, // ớ
-    { 21, 25, 23, 1, 24, 132, 35606 }, // Ờ
-    { 18, 21, 20, 1, 20, 95, 35738 }, // ờ
-    { 21, 26, 23, 1, 25, 137, 35833 }, // Ở
-    { 18, 22, 20, 1, 21, 99, 35970 }, // ở
-    { 21, 24, 23, 1, 23, 126, 36069 }, // Ỡ
-    { 18, 20, 20, 1, 19, 90, 36195 }, // ỡ
-    { 21, 25, 23, 1, 19, 132, 36285 }, // Ợ
-    { 18, 22, 20, 1, 16, 99, 36417 }, // ợ
-    { 17, 24, 19, 1, 18, 102, 36516 }, // Ụ
-    { 14, 20, 16, 1, 14, 70, 36618 }, // ụ
-    { 17, 26, 19, 1, 25, 111, 36688 }, // Ủ
-    { 14, 22, 16, 1, 21, 77, 36799 }, // ủ
-    { 23, 25, 25, 1, 24, 144, 36876 }, // Ứ
-    { 20, 21, 22, 1, 20, 105, 37020 }, // ứ
-    { 23, 25, 25, 1, 24, 144, 37125 }, // Ừ
-    { 20, 21, 22, 1, 20, 105, 37269 }, // ừ
-    { 23, 26, 25, 1, 25, 150, 37374 }, // Ử
-    { 20, 22, 22, 1, 21, 110, 37524 }, // ử
-    { 23, 24, 25, 1, 23, 138, 37634 }, // Ữ
-    { 20, 20, 22, 1, 19, 100, 37772 }, // ữ
-    { 23, 25, 25, 1, 19, 144, 37872 }, // Ự
-    { 20, 22, 22, 1, 16, 110, 38016 }, // ự
-    { 15, 24, 18, 2, 24, 90, 38126 }, // Ỳ
-    { 17, 26, 16, -2, 20, 111, 38216 }, // ỳ
-    { 15, 24, 18, 2, 18, 90, 38327 }, // Ỵ
-    { 17, 20, 16, -2, 14, 85, 38417 }, // ỵ
-    { 15, 25, 18, 2, 25, 94, 38502 }, // Ỷ
-    { 17, 27, 16, -2, 21, 115, 38596 }, // ỷ
-    { 15, 23, 18, 2, 23, 87, 38711 }, // Ỹ
-    { 17, 25, 16, -2, 19, 107, 38798 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 38905 }, //  
-    { 0, 0, 25, 0, 0, 0, 38905 }, //  
-    { 0, 0, 13, 0, 0, 0, 38905 }, //  
-    { 0, 0, 25, 0, 0, 0, 38905 }, //  
-    { 0, 0, 8, 0, 0, 0, 38905 }, //  
-    { 0, 0, 6, 0, 0, 0, 38905 }, //  
-    { 0, 0, 4, 0, 0, 0, 38905 }, //  
-    { 0, 0, 14, 0, 0, 0, 38905 }, //  
-    { 0, 0, 7, 0, 0, 0, 38905 }, //  
-    { 0, 0, 4, 0, 0, 0, 38905 }, //  
-    { 0, 0, 3, 0, 0, 0, 38905 }, //  
-    { 0, 0, 1, 0, 0, 0, 38905 }, // ​
-    { 0, 0, 1, 0, 0, 0, 38905 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 38905 }, // ‍
-    { 7, 22, 7, -1, 18, 39, 38905 }, // ‎
-    { 7, 22, 2, -6, 18, 39, 38944 }, // ‏
-    { 8, 4, 9, 0, 9, 8, 38983 }, // ‐
-    { 8, 4, 9, 0, 9, 8, 38991 }, // ‑
-    { 14, 4, 15, 0, 11, 14, 38999 }, // ‒
-    { 12, 4, 13, 0, 9, 12, 39013 }, // –
-    { 24, 4, 25, 0, 9, 24, 39025 }, // —
-    { 24, 4, 25, 0, 9, 24, 39049 }, // ―
-    { 10, 25, 14, 2, 19, 63, 39073 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 39136 }, // ‗
-    { 7, 7, 9, 1, 18, 13, 39154 }, // ‘
-    { 7, 7, 9, 1, 18, 13, 39167 }, // ’
-    { 7, 7, 7, -2, 3, 13, 39180 }, // ‚
-    { 5, 7, 8, 2, 18, 9, 39193 }, // ‛
-    { 12, 7, 14, 1, 18, 21, 39202 }, // “
-    { 12, 7, 14, 1, 18, 21, 39223 }, // ”
-    { 13, 7, 12, -2, 3, 23, 39244 }, // „
-    { 10, 7, 13, 2, 18, 18, 39267 }, // ‟
-    { 11, 19, 14, 2, 19, 53, 39285 }, // †
-    { 14, 19, 15, 0, 19, 67, 39338 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 39405 }, // •
-    { 8, 10, 10, 1, 14, 20, 39421 }, // ‣
-    { 6, 5, 13, 2, 4, 8, 39441 }, // ․
-    { 12, 5, 14, 0, 4, 15, 39449 }, // ‥
-    { 19, 5, 21, 0, 4, 24, 39464 }, // …
-    { 6, 5, 8, 1, 9, 8, 39488 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 39496 }, //  
-    { 0, 0, 15, 0, 0, 0, 39496 }, //  
-    { 7, 20, 7, -1, 16, 35, 39496 }, // ‪
-    { 7, 20, 2, -6, 16, 35, 39531 }, // ‫
-    { 6, 22, 4, -3, 18, 33, 39566 }, // ‬
-    { 6, 22, 4, -3, 18, 33, 39599 }, // ‭
-    { 6, 22, 4, -3, 18, 33, 39632 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 39665 }, //  
-    { 29, 20, 31, 1, 19, 145, 39665 }, // ‰
-    { 38, 20, 40, 1, 19, 190, 39810 }, // ‱
-    { 8, 7, 10, 1, 18, 14, 40000 }, // ′
-    { 14, 7, 16, 1, 18, 25, 40014 }, // ″
-    { 20, 7, 22, 1, 18, 35, 40039 }, // ‴
-    { 7, 7, 9, 1, 18, 13, 40074 }, // ‵
-    { 13, 7, 15, 1, 18, 23, 40087 }, // ‶
-    { 19, 7, 21, 1, 18, 34, 40110 }, // ‷
-    { 9, 9, 9, -2, 3, 21, 40144 }, // ‸
-    { 9, 12, 10, 0, 13, 27, 40165 }, // ‹
-    { 8, 12, 9, 0, 13, 24, 40192 }, // ›
-    { 21, 20, 22, 0, 19, 105, 40216 }, // ※
-    { 15, 19, 16, 0, 18, 72, 40321 }, // ‼
-    { 11, 20, 14, 2, 19, 55, 40393 }, // ‽
-    { 12, 4, 15, 2, 22, 12, 40448 }, // ‾
-    { 14, 6, 13, -2, 0, 21, 40460 }, // ‿
-    { 13, 6, 16, 2, 20, 20, 40481 }, // ⁀
-    { 14, 17, 12, -3, 11, 60, 40501 }, // ⁁
-    { 29, 24, 29, -1, 20, 174, 40561 }, // ⁂
-    { 8, 4, 9, 0, 9, 8, 40735 }, // ⁃
-    { 17, 18, 11, -7, 18, 77, 40743 }, // ⁄
-    { 11, 22, 11, -1, 18, 61, 40820 }, // ⁅
-    { 11, 22, 10, -2, 18, 61, 40881 }, // ⁆
-    { 23, 20, 25, 1, 19, 115, 40942 }, // ⁇
-    { 19, 20, 21, 1, 19, 95, 41057 }, // ⁈
-    { 20, 20, 21, 0, 19, 100, 41152 }, // ⁉
-    { 13, 14, 15, 1, 14, 46, 41252 }, // ⁊
-    { 14, 23, 17, 2, 19, 81, 41298 }, // ⁋
-    { 14, 13, 16, 1, 14, 46, 41379 }, // ⁌
-    { 14, 13, 16, 1, 14, 46, 41425 }, // ⁍
-    { 13, 13, 14, -1, 8, 43, 41471 }, // ⁎
-    { 7, 18, 8, 0, 14, 32, 41514 }, // ⁏
-    { 17, 26, 16, -2, 20, 111, 41546 }, // ⁐
-    { 16, 26, 16, -1, 20, 104, 41657 }, // ⁑
-    { 11, 20, 12, 0, 19, 55, 41761 }, // ⁒
-    { 24, 6, 26, 1, 10, 36, 41816 }, // ⁓
-    { 14, 6, 13, -3, 0, 21, 41852 }, // ⁔
-    { 14, 14, 15, 0, 13, 49, 41873 }, // ⁕
-    { 12, 20, 14, 1, 19, 60, 41922 }, // ⁖
-    { 23, 7, 25, 1, 18, 41, 41982 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 42023 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 42118 }, // ⁙
-    { 5, 20, 7, 1, 19, 25, 42213 }, // ⁚
-    { 16, 21, 18, 1, 20, 84, 42238 }, // ⁛
-    { 20, 20, 21, 0, 19, 100, 42322 }, // ⁜
-    { 5, 20, 7, 1, 19, 25, 42422 }, // ⁝
-    { 5, 20, 7, 1, 19, 25, 42447 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 42472 }, //  
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 42472 }, // ⁩
-    { 6, 22, 4, -3, 18, 33, 42472 }, // ⁪
-    { 6, 22, 4, -3, 18, 33, 42505 }, // ⁫
-    { 6, 22, 4, -3, 18, 33, 42538 }, // ⁬
-    { 6, 22, 4, -3, 18, 33, 42571 }, // ⁭
-    { 6, 22, 4, -3, 18, 33, 42604 }, // ⁮
-    { 6, 22, 4, -3, 18, 33, 42637 }, // ⁯
-    { 9, 12, 12, 2, 22, 27, 42670 }, // ⁰
-    { 6, 12, 8, 1, 19, 18, 42697 }, // ⁱ
-    { 10, 12, 12, 1, 22, 30, 42715 }, // ⁴
-    { 10, 12, 12, 1, 22, 30, 42745 }, // ⁵
-    { 9, 12, 12, 2, 22, 27, 42775 }, // ⁶
-    { 10, 12, 13, 2, 22, 30, 42802 }, // ⁷
-    { 10, 12, 12, 1, 22, 30, 42832 }, // ⁸
-    { 9, 12, 12, 2, 22, 27, 42862 }, // ⁹
-    { 9, 8, 12, 2, 19, 18, 42889 }, // ⁺
-    { 9, 2, 12, 2, 16, 5, 42907 }, // ⁻
-    { 8, 6, 12, 3, 18, 12, 42912 }, // ⁼
-    { 6, 15, 10, 3, 23, 23, 42924 }, // ⁽
-    { 7, 15, 8, 0, 23, 27, 42947 }, // ⁾
-    { 10, 9, 12, 1, 16, 23, 42974 }, // ⁿ
-    { 10, 12, 10, -1, 8, 30, 42997 }, // ₀
-    { 9, 12, 9, -1, 8, 27, 43027 }, // ₁
-    { 10, 12, 9, -2, 8, 30, 43054 }, // ₂
-    { 10, 12, 9, -2, 8, 30, 43084 }, // ₃
-    { 10, 12, 9, -2, 8, 30, 43114 }, // ₄
-    { 10, 12, 10, -1, 8, 30, 43144 }, // ₅
-    { 10, 12, 10, -1, 8, 30, 43174 }, // ₆
-    { 10, 12, 10, -1, 8, 30, 43204 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 43234 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 43261 }, // ₉
-    { 8, 8, 9, 0, 6, 16, 43288 }, // ₊
-    { 8, 2, 9, 0, 3, 4, 43304 }, // ₋
-    { 8, 6, 10, 0, 5, 12, 43308 }, // ₌
-    { 7, 15, 8, 0, 10, 27, 43320 }, // ₍
-    { 7, 15, 6, -3, 10, 27, 43347 }, // ₎
-    { 10, 9, 10, -1, 6, 23, 43374 }, // ₐ
-    { 9, 9, 9, -1, 6, 21, 43397 }, // ₑ
-    { 9, 9, 10, -1, 6, 21, 43418 }, // ₒ
-    { 12, 9, 10, -3, 6, 27, 43439 }, // ₓ
-    { 9, 9, 9, -1, 6, 21, 43466 }, // ₔ
-    { 10, 12, 11, -1, 9, 30, 43487 }, // ₕ
-    { 11, 12, 11, -1, 9, 33, 43517 }, // ₖ
-    { 6, 12, 6, -1, 9, 18, 43550 }, // ₗ
-    { 15, 9, 16, -1, 6, 34, 43568 }, // ₘ
-    { 9, 9, 10, -1, 6, 21, 43602 }, // ₙ
-    { 10, 12, 10, -2, 6, 30, 43623 }, // ₚ
-    { 8, 9, 8, -1, 6, 18, 43653 }, // ₛ
-    { 7, 11, 7, -1, 8, 20, 43671 }, // ₜ
-    { 14, 19, 16, 1, 19, 67, 43691 }, // ₠
-    { 16, 21, 17, 0, 19, 84, 43758 }, // ₡
-    { 16, 20, 17, 0, 19, 80, 43842 }, // ₢
-    { 15, 18, 16, 0, 18, 68, 43922 }, // ₣
-    { 17, 19, 17, -1, 19, 81, 43990 }, // ₤
-    { 22, 20, 23, 0, 17, 110, 44071 }, // ₥
-    { 16, 18, 17, 0, 18, 72, 44181 }, // ₦
-    { 22, 19, 23, 0, 18, 105, 44253 }, // ₧
-    { 23, 19, 24, 0, 18, 110, 44358 }, // ₨
-    { 20, 18, 21, 0, 18, 90, 44468 }, // ₩
-    { 22, 18, 23, 0, 18, 99, 44558 }, // ₪
-    { 17, 23, 18, 0, 19, 98, 44657 }, // ₫
-    { 16, 20, 17, 0, 19, 80, 44755 }, // €
-    { 17, 18, 18, 0, 18, 77, 44835 }, // ₭
-    { 16, 18, 17, 0, 18, 72, 44912 }, // ₮
-    { 25, 25, 26, 0, 19, 157, 44984 }, // ₯
-    { 17, 25, 16, -2, 19, 107, 45141 }, // ₰
-    { 16, 18, 17, 0, 18, 72, 45248 }, // ₱
-    { 17, 22, 19, 1, 20, 94, 45320 }, // ₲
-    { 18, 18, 17, -2, 18, 81, 45414 }, // ₳
-    { 15, 20, 16, 0, 19, 75, 45495 }, // ₴
-    { 16, 21, 18, 1, 19, 84, 45570 }, // ₵
-    { 18, 18, 19, 0, 17, 81, 45654 }, // ₶
-    { 19, 21, 19, -1, 19, 100, 45735 }, // ₷
-    { 14, 18, 16, 1, 18, 63, 45835 }, // ₸
-    { 14, 18, 16, 1, 18, 63, 45898 }, // ₹
-    { 14, 19, 15, 0, 18, 67, 45961 }, // ₺
-    { 16, 20, 18, 1, 19, 80, 46028 }, // ₻
-    { 20, 18, 20, -1, 18, 90, 46108 }, // ₼
-    { 16, 18, 16, -1, 18, 72, 46198 }, // ₽
-    { 18, 21, 18, -1, 21, 95, 46270 }, // ₾
-    { 14, 24, 15, 0, 21, 84, 46365 }, // ₿
-    { 8, 4, 9, 0, 9, 8, 46449 }, // −
-    { 23, 23, 25, 1, 19, 133, 46457 }, // �
+    { 8, 19, 9, 0, 18, 28, 0 }, // !
+    { 10, 7, 13, 2, 18, 24, 28 }, // "
+    { 17, 18, 18, 0, 18, 61, 52 }, // #
+    { 14, 21, 15, 0, 19, 56, 113 }, // $
+    { 20, 20, 22, 1, 19, 81, 169 }, // %
+    { 18, 20, 19, 0, 19, 61, 250 }, // &
+    { 5, 7, 8, 2, 18, 12, 311 }, // '
+    { 11, 22, 12, 0, 18, 33, 323 }, // (
+    { 10, 23, 9, -2, 19, 35, 356 }, // )
+    { 13, 13, 16, 2, 20, 36, 391 }, // *
+    { 13, 13, 15, 1, 15, 29, 427 }, // +
+    { 7, 7, 7, -2, 3, 10, 456 }, // ,
+    { 8, 4, 9, 0, 9, 9, 466 }, // -
+    { 5, 5, 7, 0, 4, 8, 475 }, // .
+    { 15, 19, 14, -2, 18, 38, 483 }, // /
+    { 14, 20, 15, 0, 19, 51, 521 }, // 0
+    { 11, 18, 14, 2, 18, 33, 572 }, // 1
+    { 15, 19, 15, -1, 19, 46, 605 }, // 2
+    { 14, 20, 15, 0, 19, 47, 651 }, // 3
+    { 15, 18, 15, -1, 18, 50, 698 }, // 4
+    { 14, 19, 15, 0, 18, 49, 748 }, // 5
+    { 14, 20, 16, 1, 19, 50, 797 }, // 6
+    { 15, 18, 16, 0, 18, 42, 847 }, // 7
+    { 14, 20, 15, 0, 19, 51, 889 }, // 8
+    { 13, 20, 15, 1, 19, 49, 940 }, // 9
+    { 7, 15, 8, 0, 14, 20, 989 }, // :
+    { 9, 18, 8, -2, 14, 22, 1009 }, // ;
+    { 13, 14, 15, 1, 16, 28, 1031 }, // <
+    { 13, 8, 15, 1, 13, 21, 1059 }, // =
+    { 13, 14, 15, 1, 16, 32, 1080 }, // >
+    { 12, 20, 14, 1, 19, 35, 1112 }, // ?
+    { 21, 21, 23, 1, 18, 93, 1147 }, // @
+    { 17, 18, 16, -2, 18, 53, 1240 }, // A
+    { 16, 18, 17, 0, 18, 51, 1293 }, // B
+    { 16, 20, 18, 1, 19, 47, 1344 }, // C
+    { 17, 18, 18, 0, 18, 52, 1391 }, // D
+    { 15, 18, 16, 0, 18, 44, 1443 }, // E
+    { 15, 18, 16, 0, 18, 41, 1487 }, // F
+    { 16, 20, 18, 1, 19, 55, 1528 }, // G
+    { 18, 18, 19, 0, 18, 56, 1583 }, // H
+    { 12, 18, 12, -1, 18, 32, 1639 }, // I
+    { 13, 24, 10, -4, 18, 43, 1671 }, // J
+    { 18, 18, 19, 0, 18, 53, 1714 }, // K
+    { 12, 18, 13, 0, 18, 29, 1767 }, // L
+    { 23, 18, 24, 0, 18, 87, 1796 }, // M
+    { 20, 18, 21, 0, 18, 68, 1883 }, // N
+    { 17, 20, 19, 1, 19, 60, 1951 }, // O
+    { 16, 18, 17, 0, 18, 50, 2011 }, // P
+    { 17, 24, 19, 1, 19, 69, 2061 }, // Q
+    { 15, 18, 16, 0, 18, 53, 2130 }, // R
+    { 14, 20, 15, 0, 19, 48, 2183 }, // S
+    { 14, 18, 17, 2, 18, 40, 2231 }, // T
+    { 17, 19, 19, 1, 18, 56, 2271 }, // U
+    { 15, 18, 18, 2, 18, 49, 2327 }, // V
+    { 23, 18, 26, 2, 18, 89, 2376 }, // W
+    { 20, 18, 19, -2, 18, 53, 2465 }, // X
+    { 15, 18, 18, 2, 18, 43, 2518 }, // Y
+    { 16, 18, 16, -1, 18, 45, 2561 }, // Z
+    { 11, 22, 11, -1, 18, 40, 2606 }, // [
+    { 7, 19, 11, 2, 18, 26, 2646 }, // <backslash>
+    { 11, 22, 10, -2, 18, 38, 2672 }, // ]
+    { 14, 12, 15, 0, 18, 31, 2710 }, // ^
+    { 12, 2, 10, -3, -2, 5, 2741 }, // _
+    { 6, 5, 10, 3, 20, 7, 2746 }, // `
+    { 14, 15, 16, 1, 14, 44, 2753 }, // a
+    { 14, 20, 15, 0, 19, 52, 2797 }, // b
+    { 12, 15, 14, 1, 14, 29, 2849 }, // c
+    { 15, 20, 17, 1, 19, 51, 2878 }, // d
+    { 13, 15, 15, 1, 14, 40, 2929 }, // e
+    { 16, 26, 14, -3, 20, 55, 2969 }, // f
+    { 15, 20, 16, 0, 14, 57, 3024 }, // g
+    { 14, 19, 15, 0, 19, 51, 3081 }, // h
+    { 9, 20, 10, 0, 20, 29, 3132 }, // i
+    { 13, 26, 10, -4, 20, 46, 3161 }, // j
+    { 16, 19, 17, 0, 19, 51, 3207 }, // k
+    { 9, 19, 10, 0, 19, 30, 3258 }, // l
+    { 22, 14, 23, 0, 14, 66, 3288 }, // m
+    { 14, 14, 15, 0, 14, 42, 3354 }, // n
+    { 13, 15, 15, 1, 14, 36, 3396 }, // o
+    { 15, 20, 15, -1, 14, 54, 3432 }, // p
+    { 14, 20, 16, 1, 14, 53, 3486 }, // q
+    { 12, 14, 13, 0, 14, 27, 3539 }, // r
+    { 12, 15, 13, 0, 14, 32, 3566 }, // s
+    { 10, 18, 12, 1, 17, 34, 3598 }, // t
+    { 14, 15, 16, 1, 14, 46, 3632 }, // u
+    { 14, 14, 16, 1, 14, 39, 3678 }, // v
+    { 20, 14, 22, 1, 14, 66, 3717 }, // w
+    { 17, 14, 16, -2, 14, 41, 3783 }, // x
+    { 17, 20, 16, -2, 14, 58, 3824 }, // y
+    { 13, 14, 13, -1, 14, 31, 3882 }, // z
+    { 12, 22, 12, -1, 18, 38, 3913 }, // {
+    { 4, 25, 14, 5, 19, 38, 3951 }, // |
+    { 11, 22, 10, -2, 18, 38, 3989 }, // }
+    { 13, 5, 15, 1, 11, 14, 4027 }, // ~
+    { 0, 0, 7, 0, 0, 0, 4041 }, //  
+    { 8, 19, 8, -1, 14, 32, 4041 }, // ¡
+    { 12, 20, 15, 2, 19, 37, 4073 }, // ¢
+    { 17, 19, 17, -1, 19, 47, 4110 }, // £
+    { 12, 12, 14, 1, 15, 37, 4157 }, // ¤
+    { 15, 18, 17, 1, 18, 50, 4194 }, // ¥
+    { 4, 25, 14, 5, 19, 33, 4244 }, // ¦
+    { 13, 21, 14, 0, 20, 48, 4277 }, // §
+    { 9, 4, 15, 5, 19, 12, 4325 }, // ¨
+    { 19, 20, 21, 1, 19, 84, 4337 }, // ©
+    { 10, 10, 12, 1, 19, 27, 4421 }, // ª
+    { 15, 12, 16, 0, 13, 34, 4448 }, // «
+    { 13, 8, 15, 1, 11, 20, 4482 }, // ¬
+    { 8, 4, 9, 0, 9, 9, 4502 }, // ­
+    { 19, 20, 21, 1, 19, 90, 4511 }, // ®
+    { 12, 4, 15, 2, 22, 12, 4601 }, // ¯
+    { 9, 10, 11, 1, 19, 22, 4613 }, // °
+    { 13, 16, 15, 1, 16, 40, 4635 }, // ±
+    { 10, 12, 12, 1, 22, 27, 4675 }, // ²
+    { 10, 12, 12, 1, 22, 26, 4702 }, // ³
+    { 8, 5, 11, 2, 20, 7, 4728 }, // ´
+    { 16, 20, 16, -1, 14, 56, 4735 }, // µ
+    { 14, 23, 16, 1, 19, 89, 4791 }, // ¶
+    { 6, 5, 8, 1, 11, 8, 4880 }, // ·
+    { 7, 6, 5, -3, 0, 10, 4888 }, // ¸
+    { 8, 12, 11, 2, 22, 23, 4898 }, // ¹
+    { 8, 9, 11, 2, 18, 21, 4921 }, // º
+    { 14, 12, 15, 0, 13, 35, 4942 }, // »
+    { 19, 19, 21, 1, 19, 72, 4977 }, // ¼
+    { 21, 19, 23, 1, 19, 74, 5049 }, // ½
+    { 20, 19, 22, 1, 19, 77, 5123 }, // ¾
+    { 11, 19, 12, -1, 14, 36, 5200 }, // ¿
+    { 17, 24, 16, -2, 24, 63, 5236 }, // À
+    { 18, 24, 17, -2, 24, 64, 5299 }, // Á
+    { 18, 24, 17, -2, 24, 68, 5363 }, // Â
+    { 18, 23, 17, -2, 23, 69, 5431 }, // Ã
+    { 17, 23, 16, -2, 23, 68, 5500 }, // Ä
+    { 17, 25, 16, -2, 25, 69, 5568 }, // Å
+    { 26, 18, 25, -2, 18, 71, 5637 }, // Æ
+    { 16, 25, 18, 1, 19, 60, 5708 }, // Ç
+    { 15, 24, 16, 0, 24, 54, 5768 }, // È
+    { 15, 24, 16, 0, 24, 54, 5822 }, // É
+    { 15, 24, 16, 0, 24, 57, 5876 }, // Ê
+    { 15, 23, 16, 0, 23, 57, 5933 }, // Ë
+    { 12, 24, 12, -1, 24, 41, 5990 }, // Ì
+    { 14, 24, 14, -1, 24, 48, 6031 }, // Í
+    { 14, 24, 14, -1, 24, 51, 6079 }, // Î
+    { 13, 23, 13, -1, 23, 50, 6130 }, // Ï
+    { 17, 18, 18, 0, 18, 57, 6180 }, // Ð
+    { 20, 23, 21, 0, 23, 86, 6237 }, // Ñ
+    { 17, 25, 19, 1, 24, 69, 6323 }, // Ò
+    { 17, 25, 19, 1, 24, 69, 6392 }, // Ó
+    { 17, 25, 19, 1, 24, 73, 6461 }, // Ô
+    { 17, 24, 19, 1, 23, 73, 6534 }, // Õ
+    { 17, 24, 19, 1, 23, 73, 6607 }, // Ö
+    { 12, 12, 14, 1, 15, 26, 6680 }, // ×
+    { 17, 21, 19, 1, 19, 74, 6706 }, // Ø
+    { 17, 25, 19, 1, 24, 66, 6780 }, // Ù
+    { 17, 25, 19, 1, 24, 67, 6846 }, // Ú
+    { 17, 25, 19, 1, 24, 68, 6913 }, // Û
+    { 17, 24, 19, 1, 23, 71, 6981 }, // Ü
+    { 15, 24, 18, 2, 24, 54, 7052 }, // Ý
+    { 15, 18, 16, 0, 18, 47, 7106 }, // Þ
+    { 20, 26, 17, -4, 20, 76, 7153 }, // ß
+    { 14, 21, 16, 1, 20, 54, 7229 }, // à
+    { 14, 21, 16, 1, 20, 54, 7283 }, // á
+    { 14, 21, 16, 1, 20, 55, 7337 }, // â
+    { 14, 20, 16, 1, 19, 60, 7392 }, // ã
+    { 14, 20, 16, 1, 19, 59, 7452 }, // ä
+    { 14, 22, 16, 1, 21, 62, 7511 }, // å
+    { 21, 15, 23, 1, 14, 62, 7573 }, // æ
+    { 12, 20, 14, 1, 14, 39, 7635 }, // ç
+    { 13, 21, 15, 1, 20, 50, 7674 }, // è
+    { 13, 21, 15, 1, 20, 49, 7724 }, // é
+    { 13, 21, 15, 1, 20, 51, 7773 }, // ê
+    { 13, 20, 15, 1, 19, 53, 7824 }, // ë
+    { 8, 20, 9, 0, 20, 29, 7877 }, // ì
+    { 11, 20, 12, 0, 20, 30, 7906 }, // í
+    { 11, 20, 12, 0, 20, 35, 7936 }, // î
+    { 10, 19, 11, 0, 19, 36, 7971 }, // ï
+    { 15, 21, 16, 0, 20, 55, 8007 }, // ð
+    { 15, 19, 16, 0, 19, 56, 8062 }, // ñ
+    { 13, 21, 15, 1, 20, 46, 8118 }, // ò
+    { 13, 21, 15, 1, 20, 45, 8164 }, // ó
+    { 13, 21, 15, 1, 20, 47, 8209 }, // ô
+    { 14, 20, 16, 1, 19, 52, 8256 }, // õ
+    { 13, 20, 15, 1, 19, 48, 8308 }, // ö
+    { 13, 13, 15, 1, 15, 29, 8356 }, // ÷
+    { 14, 17, 15, 0, 15, 49, 8385 }, // ø
+    { 14, 21, 16, 1, 20, 55, 8434 }, // ù
+    { 14, 21, 16, 1, 20, 56, 8489 }, // ú
+    { 14, 21, 16, 1, 20, 58, 8545 }, // û
+    { 14, 20, 16, 1, 19, 60, 8603 }, // ü
+    { 17, 26, 16, -2, 20, 68, 8663 }, // ý
+    { 15, 25, 15, -1, 19, 64, 8731 }, // þ
+    { 17, 25, 16, -2, 19, 72, 8795 }, // ÿ
+    { 17, 22, 16, -2, 22, 64, 8867 }, // Ā
+    { 14, 19, 16, 1, 18, 54, 8931 }, // ā
+    { 18, 24, 17, -2, 24, 68, 8985 }, // Ă
+    { 14, 21, 16, 1, 20, 57, 9053 }, // ă
+    { 17, 25, 16, -2, 18, 67, 9110 }, // Ą
+    { 14, 21, 16, 1, 14, 56, 9177 }, // ą
+    { 16, 25, 18, 1, 24, 58, 9233 }, // Ć
+    { 12, 21, 14, 1, 20, 39, 9291 }, // ć
+    { 16, 25, 18, 1, 24, 58, 9330 }, // Ĉ
+    { 12, 21, 14, 1, 20, 41, 9388 }, // ĉ
+    { 16, 25, 18, 1, 24, 58, 9429 }, // Ċ
+    { 12, 21, 14, 1, 20, 38, 9487 }, // ċ
+    { 16, 25, 18, 1, 24, 59, 9525 }, // Č
+    { 13, 21, 15, 1, 20, 43, 9584 }, // č
+    { 17, 24, 18, 0, 24, 65, 9627 }, // Ď
+    { 20, 20, 22, 1, 19, 60, 9692 }, // ď
+    { 17, 18, 18, 0, 18, 57, 9752 }, // Đ
+    { 16, 20, 18, 1, 19, 55, 9809 }, // đ
+    { 15, 22, 16, 0, 22, 54, 9864 }, // Ē
+    { 13, 19, 15, 1, 18, 50, 9918 }, // ē
+    { 15, 24, 16, 0, 24, 56, 9968 }, // Ĕ
+    { 13, 21, 15, 1, 20, 52, 10024 }, // ĕ
+    { 15, 24, 16, 0, 24, 54, 10076 }, // Ė
+    { 13, 21, 15, 1, 20, 49, 10130 }, // ė
+    { 15, 25, 16, 0, 18, 59, 10179 }, // Ę
+    { 13, 20, 15, 1, 14, 51, 10238 }, // ę
+    { 16, 24, 17, 0, 24, 56, 10289 }, // Ě
+    { 14, 21, 16, 1, 20, 52, 10345 }, // ě
+    { 16, 25, 18, 1, 24, 67, 10397 }, // Ĝ
+    { 15, 26, 16, 0, 20, 68, 10464 }, // ĝ
+    { 16, 25, 18, 1, 24, 67, 10532 }, // Ğ
+    { 15, 26, 16, 0, 20, 70, 10599 }, // ğ
+    { 16, 25, 18, 1, 24, 64, 10669 }, // Ġ
+    { 15, 26, 16, 0, 20, 67, 10733 }, // ġ
+    { 16, 25, 18, 1, 19, 66, 10800 }, // Ģ
+    { 15, 26, 16, 0, 20, 66, 10866 }, // ģ
+    { 18, 24, 19, 0, 24, 70, 10932 }, // Ĥ
+    { 14, 25, 15, 0, 25, 64, 11002 }, // ĥ
+    { 20, 18, 21, 0, 18, 59, 11066 }, // Ħ
+    { 14, 19, 15, 0, 19, 53, 11125 }, // ħ
+    { 14, 23, 14, -1, 23, 53, 11178 }, // Ĩ
+    { 12, 19, 13, 0, 19, 36, 11231 }, // ĩ
+    { 13, 22, 13, -1, 22, 45, 11267 }, // Ī
+    { 10, 18, 11, 0, 18, 31, 11312 }, // ī
+    { 14, 24, 14, -1, 24, 50, 11343 }, // Ĭ
+    { 11, 20, 12, 0, 20, 33, 11393 }, // ĭ
+    { 12, 25, 12, -1, 18, 44, 11426 }, // Į
+    { 10, 27, 10, -1, 20, 39, 11470 }, // į
+    { 12, 24, 12, -1, 24, 42, 11509 }, // İ
+    { 8, 14, 9, 0, 14, 22, 11551 }, // ı
+    { 20, 24, 20, -1, 18, 74, 11573 }, // Ĳ
+    { 16, 26, 17, 0, 20, 74, 11647 }, // ĳ
+    { 16, 30, 13, -4, 24, 61, 11721 }, // Ĵ
+    { 15, 26, 12, -4, 20, 55, 11782 }, // ĵ
+    { 18, 24, 19, 0, 18, 65, 11837 }, // Ķ
+    { 16, 25, 17, 0, 19, 63, 11902 }, // ķ
+    { 16, 14, 17, 0, 14, 42, 11965 }, // ĸ
+    { 13, 24, 14, 0, 24, 43, 12007 }, // Ĺ
+    { 12, 25, 13, 0, 25, 37, 12050 }, // ĺ
+    { 12, 24, 13, 0, 18, 39, 12087 }, // Ļ
+    { 10, 25, 10, -1, 19, 39, 12126 }, // ļ
+    { 15, 18, 16, 0, 18, 40, 12165 }, // Ľ
+    { 14, 19, 15, 0, 19, 43, 12205 }, // ľ
+    { 13, 18, 14, 0, 18, 41, 12248 }, // Ŀ
+    { 12, 19, 13, 0, 19, 38, 12289 }, // ŀ
+    { 13, 18, 13, -1, 18, 37, 12327 }, // Ł
+    { 9, 19, 10, 0, 19, 34, 12364 }, // ł
+    { 20, 24, 21, 0, 24, 79, 12398 }, // Ń
+    { 15, 20, 16, 0, 20, 53, 12477 }, // ń
+    { 20, 24, 21, 0, 18, 80, 12530 }, // Ņ
+    { 14, 20, 15, 0, 14, 54, 12610 }, // ņ
+    { 20, 24, 21, 0, 24, 82, 12664 }, // Ň
+    { 16, 20, 17, 0, 20, 56, 12746 }, // ň
+    { 17, 18, 18, 0, 18, 58, 12802 }, // ŉ
+    { 19, 24, 20, 0, 18, 83, 12860 }, // Ŋ
+    { 14, 20, 15, 0, 14, 54, 12943 }, // ŋ
+    { 17, 23, 19, 1, 22, 70, 12997 }, // Ō
+    { 13, 19, 15, 1, 18, 45, 13067 }, // ō
+    { 17, 25, 19, 1, 24, 72, 13112 }, // Ŏ
+    { 13, 21, 15, 1, 20, 49, 13184 }, // ŏ
+    { 19, 25, 21, 1, 24, 78, 13233 }, // Ő
+    { 16, 21, 18, 1, 20, 52, 13311 }, // ő
+    { 23, 20, 25, 1, 19, 74, 13363 }, // Œ
+    { 21, 15, 23, 1, 14, 61, 13437 }, // œ
+    { 16, 24, 17, 0, 24, 64, 13498 }, // Ŕ
+    { 13, 20, 14, 0, 20, 37, 13562 }, // ŕ
+    { 15, 24, 16, 0, 18, 66, 13599 }, // Ŗ
+    { 13, 20, 13, -1, 14, 41, 13665 }, // ŗ
+    { 17, 24, 18, 0, 24, 68, 13706 }, // Ř
+    { 14, 20, 15, 0, 20, 43, 13774 }, // ř
+    { 14, 25, 15, 0, 24, 57, 13817 }, // Ś
+    { 13, 21, 14, 0, 20, 42, 13874 }, // ś
+    { 14, 25, 15, 0, 24, 58, 13916 }, // Ŝ
+    { 13, 21, 14, 0, 20, 46, 13974 }, // ŝ
+    { 14, 25, 15, 0, 19, 59, 14020 }, // Ş
+    { 12, 20, 13, 0, 14, 42, 14079 }, // ş
+    { 15, 25, 16, 0, 24, 61, 14121 }, // Š
+    { 13, 21, 14, 0, 20, 44, 14182 }, // š
+    { 15, 24, 17, 1, 18, 54, 14226 }, // Ţ
+    { 10, 23, 12, 1, 17, 43, 14280 }, // ţ
+    { 14, 24, 17, 2, 24, 53, 14323 }, // Ť
+    { 13, 20, 15, 1, 19, 43, 14376 }, // ť
+    { 15, 18, 17, 1, 18, 45, 14419 }, // Ŧ
+    { 11, 18, 12, 0, 17, 39, 14464 }, // ŧ
+    { 17, 24, 19, 1, 23, 71, 14503 }, // Ũ
+    { 14, 20, 16, 1, 19, 61, 14574 }, // ũ
+    { 17, 23, 19, 1, 22, 66, 14635 }, // Ū
+    { 14, 19, 16, 1, 18, 55, 14701 }, // ū
+    { 17, 25, 19, 1, 24, 69, 14756 }, // Ŭ
+    { 14, 21, 16, 1, 20, 58, 14825 }, // ŭ
+    { 17, 26, 19, 1, 25, 76, 14883 }, // Ů
+    { 14, 22, 16, 1, 21, 64, 14959 }, // ů
+    { 18, 25, 20, 1, 24, 73, 15023 }, // Ű
+    { 16, 21, 18, 1, 20, 61, 15096 }, // ű
+    { 17, 25, 19, 1, 18, 69, 15157 }, // Ų
+    { 14, 21, 16, 1, 14, 58, 15226 }, // ų
+    { 23, 24, 26, 2, 24, 104, 15284 }, // Ŵ
+    { 20, 20, 22, 1, 20, 83, 15388 }, // ŵ
+    { 15, 24, 18, 2, 24, 57, 15471 }, // Ŷ
+    { 17, 26, 16, -2, 20, 70, 15528 }, // ŷ
+    { 15, 23, 18, 2, 23, 57, 15598 }, // Ÿ
+    { 16, 24, 16, -1, 24, 56, 15655 }, // Ź
+    { 14, 20, 14, -1, 20, 42, 15711 }, // ź
+    { 16, 24, 16, -1, 24, 56, 15753 }, // Ż
+    { 13, 20, 13, -1, 20, 40, 15809 }, // ż
+    { 17, 24, 17, -1, 24, 60, 15849 }, // Ž
+    { 15, 20, 15, -1, 20, 47, 15909 }, // ž
+    { 15, 26, 13, -3, 20, 52, 15956 }, // ſ
+    { 21, 20, 23, 1, 19, 68, 16008 }, // Ơ
+    { 18, 17, 20, 1, 16, 48, 16076 }, // ơ
+    { 25, 20, 27, 1, 19, 86, 16124 }, // Ƣ
+    { 21, 20, 23, 1, 14, 73, 16210 }, // ƣ
+    { 18, 18, 20, 1, 18, 55, 16283 }, // Ƥ
+    { 15, 26, 15, -1, 20, 66, 16338 }, // ƥ
+    { 15, 21, 16, 0, 18, 56, 16404 }, // Ʀ
+    { 14, 20, 15, 0, 19, 48, 16460 }, // Ƨ
+    { 12, 15, 13, 0, 14, 34, 16508 }, // ƨ
+    { 16, 18, 16, -1, 18, 43, 16542 }, // Ʃ
+    { 8, 26, 9, 0, 20, 46, 16585 }, // ƪ
+    { 10, 23, 12, 1, 17, 43, 16631 }, // ƫ
+    { 16, 18, 18, 1, 18, 46, 16674 }, // Ƭ
+    { 10, 21, 12, 1, 20, 37, 16720 }, // ƭ
+    { 14, 24, 17, 2, 18, 51, 16757 }, // Ʈ
+    { 23, 20, 25, 1, 19, 70, 16808 }, // Ư
+    { 20, 17, 22, 1, 16, 56, 16878 }, // ư
+    { 6, 5, 0, -11, 20, 7, 16934 }, // ̀
+    { 8, 5, 3, -6, 20, 8, 16941 }, // ́
+    { 11, 5, 8, -4, 20, 10, 16949 }, // ̂
+    { 11, 4, 1, -11, 19, 12, 16959 }, // ̃
+    { 9, 3, 7, -3, 18, 9, 16971 }, // ̄
+    { 11, 4, 9, -3, 22, 12, 16980 }, // ̅
+    { 10, 5, 8, -3, 20, 13, 16992 }, // ̆
+    { 5, 5, 6, 0, 20, 5, 17005 }, // ̇
+    { 9, 4, 8, -2, 19, 12, 17010 }, // ̈
+    { 6, 7, 0, -8, 21, 12, 17022 }, // ̉
+    { 7, 6, 7, -1, 21, 16, 17034 }, // ̊
+    { 12, 5, 10, -3, 20, 15, 17050 }, // ̋
+    { 11, 5, 9, -3, 20, 9, 17065 }, // ̌
+    { 5, 8, 6, 0, 20, 14, 17074 }, // ̍
+    { 9, 6, 8, -2, 20, 16, 17088 }, // ̎
+    { 11, 5, 0, -12, 20, 13, 17104 }, // ̏
+    { 9, 7, 8, -2, 22, 16, 17117 }, // ̐
+    { 10, 5, 8, -3, 20, 12, 17133 }, // ̑
+    { 7, 7, 6, -2, 18, 12, 17145 }, // ̒
+    { 7, 7, 6, -2, 18, 11, 17157 }, // ̓
+    { 4, 7, 5, 0, 18, 10, 17168 }, // ̔
+    { 7, 7, 6, -2, 18, 11, 17178 }, // ̕
+    { 6, 5, 2, -5, 0, 6, 17189 }, // ̖
+    { 8, 5, 3, -6, 0, 6, 17195 }, // ̗
+    { 6, 6, 2, -5, 0, 9, 17201 }, // ̘
+    { 6, 6, 2, -5, 0, 9, 17210 }, // ̙
+    { 8, 7, 11, 2, 19, 14, 17219 }, // ̚
+    { 8, 7, 7, -2, 20, 12, 17233 }, // ̛
+    { 5, 7, 4, -2, 0, 10, 17245 }, // ̜
+    { 7, 5, 2, -6, -1, 8, 17255 }, // ̝
+    { 6, 5, 2, -5, -1, 8, 17263 }, // ̞
+    { 6, 6, 2, -5, 0, 11, 17271 }, // ̟
+    { 7, 3, 2, -6, -2, 6, 17282 }, // ̠
+    { 8, 8, 3, -6, 2, 12, 17288 }, // ̡
+    { 6, 8, 4, -3, 2, 15, 17300 }, // ̢
+    { 5, 5, 0, -12, -1, 8, 17315 }, // ̣
+    { 9, 4, 3, -7, -1, 13, 17323 }, // ̤
+    { 7, 6, 2, -6, 0, 13, 17336 }, // ̥
+    { 6, 5, 8, 1, -1, 9, 17349 }, // ̦
+    { 7, 6, 3, -5, 0, 11, 17358 }, // ̧
+    { 6, 7, 2, -5, 0, 12, 17369 }, // ̨
+    { 5, 8, 2, -4, 0, 13, 17381 }, // ̩
+    { 10, 5, 4, -7, -1, 15, 17394 }, // ̪
+    { 10, 4, 4, -7, -1, 11, 17409 }, // ̫
+    { 11, 5, 5, -7, 0, 10, 17420 }, // ̬
+    { 11, 5, 4, -8, 0, 11, 17430 }, // ̭
+    { 10, 5, 4, -7, 0, 12, 17441 }, // ̮
+    { 10, 5, 4, -7, -1, 12, 17453 }, // ̯
+    { 12, 4, 5, -8, -1, 14, 17465 }, // ̰
+    { 9, 3, 3, -7, -2, 9, 17479 }, // ̱
+    { 12, 2, 5, -8, -2, 5, 17488 }, // ̲
+    { 13, 6, 5, -9, 0, 22, 17493 }, // ̳
+    { 12, 4, 7, -6, 9, 13, 17515 }, // ̴
+    { 11, 4, 6, -6, 9, 11, 17528 }, // ̵
+    { 20, 4, 11, -10, 9, 17, 17539 }, // ̶
+    { 10, 8, 6, -5, 11, 12, 17556 }, // ̷
+    { 16, 21, 9, -8, 19, 42, 17568 }, // ̸
+    { 4, 7, 3, -2, 0, 8, 17610 }, // ̹
+    { 10, 5, 4, -7, -1, 16, 17618 }, // ̺
+    { 10, 6, 4, -7, 0, 22, 17634 }, // ̻
+    { 10, 4, 4, -7, -1, 13, 17656 }, // ̼
+    { 7, 6, 7, -1, 20, 13, 17669 }, // ̽
+    { 6, 8, 6, -1, 22, 13, 17682 }, // ̾
+    { 12, 6, 10, -3, 25, 22, 17695 }, // ̿
+    { 6, 5, 5, -2, 20, 6, 17717 }, // ̀
+    { 7, 5, 8, 0, 20, 8, 17723 }, // ́
+    { 12, 4, 16, 3, 19, 13, 17731 }, // ͂
+    { 5, 6, 6, 0, 20, 9, 17744 }, // ̓
+    { 14, 5, 11, -4, 20, 21, 17753 }, // ̈́
+    { 6, 5, 3, -4, -1, 8, 17774 }, // ͅ
+    { 12, 6, 9, -4, 20, 16, 17782 }, // ͆
+    { 12, 6, 5, -8, 0, 22, 17798 }, // ͇
+    { 8, 6, 3, -6, 0, 14, 17820 }, // ͈
+    { 6, 5, 2, -5, -1, 10, 17834 }, // ͉
+    { 10, 6, 8, -3, 20, 17, 17844 }, // ͊
+    { 11, 10, 9, -3, 24, 24, 17861 }, // ͋
+    { 11, 7, 9, -3, 22, 20, 17885 }, // ͌
+    { 10, 6, 4, -7, 0, 12, 17905 }, // ͍
+    { 5, 6, 2, -4, 0, 9, 17917 }, // ͎
+    { 18, 18, 10, -9, 18, 75, 17926 }, // ͏
+    { 5, 6, 6, 0, 20, 8, 18001 }, // ͐
+    { 4, 7, 8, 3, 22, 10, 18009 }, // ͑
+    { 10, 7, 8, -3, 22, 19, 18019 }, // ͒
+    { 5, 6, 2, -4, 0, 11, 18038 }, // ͓
+    { 5, 5, 2, -4, -1, 8, 18049 }, // ͔
+    { 5, 5, 2, -4, -1, 9, 18057 }, // ͕
+    { 10, 5, 5, -6, -1, 18, 18066 }, // ͖
+    { 5, 7, 8, 2, 21, 8, 18084 }, // ͗
+    { 5, 5, 6, 0, 20, 6, 18092 }, // ͘
+    { 6, 6, 2, -5, 0, 11, 18098 }, // ͙
+    { 10, 6, 4, -7, 0, 20, 18109 }, // ͚
+    { 5, 6, 6, 0, 20, 9, 18129 }, // ͛
+    { 20, 5, 10, -11, -1, 19, 18138 }, // ͜
+    { 20, 5, 13, -8, 19, 21, 18157 }, // ͝
+    { 14, 3, 10, -5, 18, 12, 18178 }, // ͞
+    { 14, 3, 6, -9, -1, 12, 18190 }, // ͟
+    { 21, 4, 14, -8, 19, 19, 18202 }, // ͠
+    { 20, 6, 14, -7, 22, 21, 18221 }, // ͡
+    { 21, 6, 9, -13, 0, 22, 18242 }, // ͢
+    { 7, 7, 7, -1, 22, 17, 18264 }, // ͣ
+    { 7, 7, 7, -1, 22, 15, 18281 }, // ͤ
+    { 5, 9, 6, 0, 24, 12, 18296 }, // ͥ
+    { 7, 7, 7, -1, 22, 16, 18308 }, // ͦ
+    { 7, 6, 7, -1, 21, 17, 18324 }, // ͧ
+    { 6, 7, 7, 0, 22, 13, 18341 }, // ͨ
+    { 8, 9, 8, -1, 24, 20, 18354 }, // ͩ
+    { 7, 9, 7, -1, 24, 21, 18374 }, // ͪ
+    { 10, 7, 8, -3, 22, 26, 18395 }, // ͫ
+    { 6, 7, 7, 0, 22, 12, 18421 }, // ͬ
+    { 5, 8, 6, 0, 23, 11, 18433 }, // ͭ
+    { 6, 6, 7, 0, 21, 14, 18444 }, // ͮ
+    { 8, 6, 7, -2, 21, 17, 18458 }, // ͯ
+    { 17, 18, 16, -2, 18, 53, 18475 }, // Α
+    { 16, 18, 17, 0, 18, 51, 18528 }, // Β
+    { 15, 18, 16, 0, 18, 39, 18579 }, // Γ
+    { 17, 18, 16, -2, 18, 51, 18618 }, // Δ
+    { 15, 18, 16, 0, 18, 44, 18669 }, // Ε
+    { 16, 18, 16, -1, 18, 45, 18713 }, // Ζ
+    { 18, 18, 19, 0, 18, 56, 18758 }, // Η
+    { 17, 20, 19, 1, 19, 69, 18814 }, // Θ
+    { 12, 18, 12, -1, 18, 32, 18883 }, // Ι
+    { 18, 18, 19, 0, 18, 53, 18915 }, // Κ
+    { 16, 18, 15, -2, 18, 51, 18968 }, // Λ
+    { 23, 18, 24, 0, 18, 87, 19019 }, // Μ
+    { 20, 18, 21, 0, 18, 68, 19106 }, // Ν
+    { 15, 18, 16, 0, 18, 38, 19174 }, // Ξ
+    { 17, 20, 19, 1, 19, 60, 19212 }, // Ο
+    { 18, 18, 19, 0, 18, 56, 19272 }, // Π
+    { 16, 18, 17, 0, 18, 50, 19328 }, // Ρ
+    { 16, 18, 16, -1, 18, 43, 19378 }, // Σ
+    { 14, 18, 17, 2, 18, 40, 19421 }, // Τ
+    { 15, 18, 18, 2, 18, 43, 19461 }, // Υ
+    { 21, 20, 23, 1, 19, 74, 19504 }, // Φ
+    { 20, 18, 19, -2, 18, 53, 19578 }, // Χ
+    { 21, 18, 24, 2, 18, 69, 19631 }, // Ψ
+    { 19, 19, 19, -1, 19, 64, 19700 }, // Ω
+    { 14, 15, 16, 1, 14, 44, 19764 }, // α
+    { 16, 26, 16, -1, 20, 67, 19808 }, // β
+    { 12, 20, 14, 1, 14, 46, 19875 }, // γ
+    { 16, 21, 17, 0, 20, 51, 19921 }, // δ
+    { 12, 15, 13, 0, 14, 36, 19972 }, // ε
+    { 14, 25, 15, 0, 19, 48, 20008 }, // ζ
+    { 14, 20, 15, 0, 14, 54, 20056 }, // η
+    { 13, 21, 15, 1, 20, 51, 20110 }, // θ
+    { 8, 15, 10, 1, 14, 24, 20161 }, // ι
+    { 16, 14, 17, 0, 14, 42, 20185 }, // κ
+    { 16, 21, 15, -2, 20, 54, 20227 }, // λ
+    { 16, 20, 16, -1, 14, 58, 20281 }, // μ
+    { 12, 14, 14, 1, 14, 37, 20339 }, // ν
+    { 15, 25, 16, 0, 19, 55, 20376 }, // ξ
+    { 13, 15, 15, 1, 14, 36, 20431 }, // ο
+    { 18, 15, 20, 1, 14, 51, 20467 }, // π
+    { 15, 20, 15, -1, 14, 53, 20518 }, // ρ
+    { 12, 20, 14, 1, 14, 37, 20571 }, // ς
+    { 16, 15, 17, 0, 14, 44, 20608 }, // σ
+    { 12, 15, 14, 1, 14, 29, 20652 }, // τ
+    { 14, 15, 16, 1, 14, 47, 20681 }, // υ
+    { 18, 20, 20, 1, 14, 68, 20728 }, // φ
+    { 18, 21, 17, -2, 14, 63, 20796 }, // χ
+    { 19, 25, 21, 1, 19, 85, 20859 }, // ψ
+    { 20, 15, 22, 1, 14, 60, 20944 }, // ω
+    { 17, 24, 16, -2, 18, 64, 21004 }, // Ạ
+    { 14, 20, 16, 1, 14, 53, 21068 }, // ạ
+    { 17, 25, 16, -2, 25, 68, 21121 }, // Ả
+    { 14, 22, 16, 1, 21, 60, 21189 }, // ả
+    { 22, 25, 21, -2, 25, 81, 21249 }, // Ấ
+    { 17, 22, 19, 1, 21, 64, 21330 }, // ấ
+    { 17, 25, 16, -2, 25, 73, 21394 }, // Ầ
+    { 14, 22, 16, 1, 21, 63, 21467 }, // ầ
+    { 20, 26, 19, -2, 26, 80, 21530 }, // Ẩ
+    { 16, 23, 18, 1, 22, 65, 21610 }, // ẩ
+    { 18, 27, 17, -2, 27, 81, 21675 }, // Ẫ
+    { 14, 24, 16, 1, 23, 67, 21756 }, // ẫ
+    { 18, 30, 17, -2, 24, 80, 21823 }, // Ậ
+    { 14, 26, 16, 1, 20, 64, 21903 }, // ậ
+    { 18, 26, 17, -2, 26, 77, 21967 }, // Ắ
+    { 14, 23, 16, 1, 22, 63, 22044 }, // ắ
+    { 18, 26, 17, -2, 26, 79, 22107 }, // Ằ
+    { 14, 23, 16, 1, 22, 63, 22186 }, // ằ
+    { 18, 27, 17, -2, 27, 78, 22249 }, // Ẳ
+    { 14, 23, 16, 1, 22, 66, 22327 }, // ẳ
+    { 18, 27, 17, -2, 27, 82, 22393 }, // Ẵ
+    { 14, 24, 16, 1, 23, 67, 22475 }, // ẵ
+    { 18, 30, 17, -2, 24, 79, 22542 }, // Ặ
+    { 14, 26, 16, 1, 20, 65, 22621 }, // ặ
+    { 15, 24, 16, 0, 18, 55, 22686 }, // Ẹ
+    { 13, 20, 15, 1, 14, 49, 22741 }, // ẹ
+    { 15, 25, 16, 0, 25, 58, 22790 }, // Ẻ
+    { 13, 22, 15, 1, 21, 54, 22848 }, // ẻ
+    { 16, 23, 17, 0, 23, 56, 22902 }, // Ẽ
+    { 14, 20, 16, 1, 19, 54, 22958 }, // ẽ
+    { 19, 25, 20, 0, 25, 68, 23012 }, // Ế
+    { 17, 22, 19, 1, 21, 60, 23080 }, // ế
+    { 15, 25, 16, 0, 25, 61, 23140 }, // Ề
+    { 13, 22, 15, 1, 21, 57, 23201 }, // ề
+    { 18, 26, 19, 0, 26, 67, 23258 }, // Ể
+    { 16, 23, 18, 1, 22, 61, 23325 }, // ể
+    { 15, 27, 16, 0, 27, 67, 23386 }, // Ễ
+    { 13, 24, 15, 1, 23, 63, 23453 }, // ễ
+    { 15, 30, 16, 0, 24, 68, 23516 }, // Ệ
+    { 13, 26, 15, 1, 20, 60, 23584 }, // ệ
+    { 12, 25, 12, -1, 25, 43, 23644 }, // Ỉ
+    { 10, 21, 11, 0, 21, 33, 23687 }, // ỉ
+    { 12, 24, 12, -1, 18, 42, 23720 }, // Ị
+    { 10, 26, 10, -1, 20, 37, 23762 }, // ị
+    { 17, 25, 19, 1, 19, 70, 23799 }, // Ọ
+    { 13, 20, 15, 1, 14, 44, 23869 }, // ọ
+    { 17, 26, 19, 1, 25, 73, 23913 }, // Ỏ
+    { 13, 22, 15, 1, 21, 48, 23986 }, // ỏ
+    { 20, 26, 22, 1, 25, 83, 24034 }, // Ố
+    { 17, 22, 19, 1, 21, 57, 24117 }, // ố
+    { 17, 26, 19, 1, 25, 78, 24174 }, // Ồ
+    { 13, 22, 15, 1, 21, 53, 24252 }, // ồ
+    { 19, 27, 21, 1, 26, 87, 24305 }, // Ổ
+    { 16, 23, 18, 1, 22, 58, 24392 }, // ổ
+    { 17, 28, 19, 1, 27, 85, 24450 }, // Ỗ
+    { 13, 24, 15, 1, 23, 58, 24535 }, // ỗ
+    { 17, 30, 19, 1, 24, 84, 24593 }, // Ộ
+    { 13, 26, 15, 1, 20, 55, 24677 }, // ộ
+    { 21, 25, 23, 1, 24, 78, 24732 }, // Ớ
+    { 18, 21, 20, 1, 20, 57, 24810 }, // ớ
+    { 21, 25, 23, 1, 24, 79, 24867 }, // Ờ
+    { 18, 21, 20, 1, 20, 57, 24946 }, // ờ
+    { 21, 26, 23, 1, 25, 83, 25003 }, // Ở
+    { 18, 22, 20, 1, 21, 60, 25086 }, // ở
+    { 21, 24, 23, 1, 23, 84, 25146 }, // Ỡ
+    { 18, 20, 20, 1, 19, 61, 25230 }, // ỡ
+    { 21, 25, 23, 1, 19, 80, 25291 }, // Ợ
+    { 18, 22, 20, 1, 16, 57, 25371 }, // ợ
+    { 17, 24, 19, 1, 18, 66, 25428 }, // Ụ
+    { 14, 20, 16, 1, 14, 55, 25494 }, // ụ
+    { 17, 26, 19, 1, 25, 70, 25549 }, // Ủ
+    { 14, 22, 16, 1, 21, 62, 25619 }, // ủ
+    { 23, 25, 25, 1, 24, 83, 25681 }, // Ứ
+    { 20, 21, 22, 1, 20, 65, 25764 }, // ứ
+    { 23, 25, 25, 1, 24, 81, 25829 }, // Ừ
+    { 20, 21, 22, 1, 20, 65, 25910 }, // ừ
+    { 23, 26, 25, 1, 25, 86, 25975 }, // Ử
+    { 20, 22, 22, 1, 21, 71, 26061 }, // ử
+    { 23, 24, 25, 1, 23, 86, 26132 }, // Ữ
+    { 20, 20, 22, 1, 19, 71, 26218 }, // ữ
+    { 23, 25, 25, 1, 19, 83, 26289 }, // Ự
+    { 20, 22, 22, 1, 16, 67, 26372 }, // ự
+    { 15, 24, 18, 2, 24, 53, 26439 }, // Ỳ
+    { 17, 26, 16, -2, 20, 69, 26492 }, // ỳ
+    { 15, 24, 18, 2, 18, 53, 26561 }, // Ỵ
+    { 17, 20, 16, -2, 14, 63, 26614 }, // ỵ
+    { 15, 25, 18, 2, 25, 59, 26677 }, // Ỷ
+    { 17, 27, 16, -2, 21, 73, 26736 }, // ỷ
+    { 15, 23, 18, 2, 23, 58, 26809 }, // Ỹ
+    { 17, 25, 16, -2, 19, 71, 26867 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 26938 }, //  
+    { 0, 0, 25, 0, 0, 0, 26938 }, //  
+    { 0, 0, 13, 0, 0, 0, 26938 }, //  
+    { 0, 0, 25, 0, 0, 0, 26938 }, //  
+    { 0, 0, 8, 0, 0, 0, 26938 }, //  
+    { 0, 0, 6, 0, 0, 0, 26938 }, //  
+    { 0, 0, 4, 0, 0, 0, 26938 }, //  
+    { 0, 0, 14, 0, 0, 0, 26938 }, //  
+    { 0, 0, 7, 0, 0, 0, 26938 }, //  
+    { 0, 0, 4, 0, 0, 0, 26938 }, //  
+    { 0, 0, 3, 0, 0, 0, 26938 }, //  
+    { 0, 0, 1, 0, 0, 0, 26938 }, // ​
+    { 0, 0, 1, 0, 0, 0, 26938 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 26938 }, // ‍
+    { 7, 22, 7, -1, 18, 35, 26938 }, // ‎
+    { 7, 22, 2, -6, 18, 35, 26973 }, // ‏
+    { 8, 4, 9, 0, 9, 9, 27008 }, // ‐
+    { 8, 4, 9, 0, 9, 9, 27017 }, // ‑
+    { 14, 4, 15, 0, 11, 12, 27026 }, // ‒
+    { 12, 4, 13, 0, 9, 12, 27038 }, // –
+    { 24, 4, 25, 0, 9, 22, 27050 }, // —
+    { 24, 4, 25, 0, 9, 22, 27072 }, // ―
+    { 10, 25, 14, 2, 19, 64, 27094 }, // ‖
+    { 12, 6, 10, -3, 0, 23, 27158 }, // ‗
+    { 7, 7, 9, 1, 18, 12, 27181 }, // ‘
+    { 7, 7, 9, 1, 18, 11, 27193 }, // ’
+    { 7, 7, 7, -2, 3, 10, 27204 }, // ‚
+    { 5, 7, 8, 2, 18, 9, 27214 }, // ‛
+    { 12, 7, 14, 1, 18, 22, 27223 }, // “
+    { 12, 7, 14, 1, 18, 22, 27245 }, // ”
+    { 13, 7, 12, -2, 3, 19, 27267 }, // „
+    { 10, 7, 13, 2, 18, 21, 27286 }, // ‟
+    { 11, 19, 14, 2, 19, 34, 27307 }, // †
+    { 14, 19, 15, 0, 19, 45, 27341 }, // ‡
+    { 8, 8, 10, 1, 13, 17, 27386 }, // •
+    { 8, 10, 10, 1, 14, 15, 27403 }, // ‣
+    { 6, 5, 13, 2, 4, 8, 27418 }, // ․
+    { 12, 5, 14, 0, 4, 16, 27426 }, // ‥
+    { 19, 5, 21, 0, 4, 24, 27442 }, // …
+    { 6, 5, 8, 1, 9, 7, 27466 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 27473 }, //  
+    { 0, 0, 15, 0, 0, 0, 27473 }, //  
+    { 7, 20, 7, -1, 16, 29, 27473 }, // ‪
+    { 7, 20, 2, -6, 16, 29, 27502 }, // ‫
+    { 6, 22, 4, -3, 18, 28, 27531 }, // ‬
+    { 6, 22, 4, -3, 18, 29, 27559 }, // ‭
+    { 6, 22, 4, -3, 18, 29, 27588 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 27617 }, //  
+    { 29, 20, 31, 1, 19, 111, 27617 }, // ‰
+    { 38, 20, 40, 1, 19, 142, 27728 }, // ‱
+    { 8, 7, 10, 1, 18, 11, 27870 }, // ′
+    { 14, 7, 16, 1, 18, 22, 27881 }, // ″
+    { 20, 7, 22, 1, 18, 34, 27903 }, // ‴
+    { 7, 7, 9, 1, 18, 12, 27937 }, // ‵
+    { 13, 7, 15, 1, 18, 22, 27949 }, // ‶
+    { 19, 7, 21, 1, 18, 33, 27971 }, // ‷
+    { 9, 9, 9, -2, 3, 20, 28004 }, // ‸
+    { 9, 12, 10, 0, 13, 17, 28024 }, // ‹
+    { 8, 12, 9, 0, 13, 18, 28041 }, // ›
+    { 21, 20, 22, 0, 19, 74, 28059 }, // ※
+    { 15, 19, 16, 0, 18, 56, 28133 }, // ‼
+    { 11, 20, 14, 2, 19, 39, 28189 }, // ‽
+    { 12, 4, 15, 2, 22, 12, 28228 }, // ‾
+    { 14, 6, 13, -2, 0, 18, 28240 }, // ‿
+    { 13, 6, 16, 2, 20, 16, 28258 }, // ⁀
+    { 14, 17, 12, -3, 11, 37, 28274 }, // ⁁
+    { 29, 24, 29, -1, 20, 111, 28311 }, // ⁂
+    { 8, 4, 9, 0, 9, 7, 28422 }, // ⁃
+    { 17, 18, 11, -7, 18, 38, 28429 }, // ⁄
+    { 11, 22, 11, -1, 18, 43, 28467 }, // ⁅
+    { 11, 22, 10, -2, 18, 42, 28510 }, // ⁆
+    { 23, 20, 25, 1, 19, 69, 28552 }, // ⁇
+    { 19, 20, 21, 1, 19, 60, 28621 }, // ⁈
+    { 20, 20, 21, 0, 19, 64, 28681 }, // ⁉
+    { 13, 14, 15, 1, 14, 31, 28745 }, // ⁊
+    { 14, 23, 17, 2, 19, 90, 28776 }, // ⁋
+    { 14, 13, 16, 1, 14, 40, 28866 }, // ⁌
+    { 14, 13, 16, 1, 14, 40, 28906 }, // ⁍
+    { 13, 13, 14, -1, 8, 34, 28946 }, // ⁎
+    { 7, 18, 8, 0, 14, 18, 28980 }, // ⁏
+    { 17, 26, 16, -2, 20, 50, 28998 }, // ⁐
+    { 16, 26, 16, -1, 20, 71, 29048 }, // ⁑
+    { 11, 20, 12, 0, 19, 42, 29119 }, // ⁒
+    { 24, 6, 26, 1, 10, 28, 29161 }, // ⁓
+    { 14, 6, 13, -3, 0, 17, 29189 }, // ⁔
+    { 14, 14, 15, 0, 13, 41, 29206 }, // ⁕
+    { 12, 20, 14, 1, 19, 33, 29247 }, // ⁖
+    { 23, 7, 25, 1, 18, 42, 29280 }, // ⁗
+    { 19, 20, 21, 1, 19, 47, 29322 }, // ⁘
+    { 19, 20, 21, 1, 19, 52, 29369 }, // ⁙
+    { 5, 20, 7, 1, 19, 20, 29421 }, // ⁚
+    { 16, 21, 18, 1, 20, 43, 29441 }, // ⁛
+    { 20, 20, 21, 0, 19, 78, 29484 }, // ⁜
+    { 5, 20, 7, 1, 19, 25, 29562 }, // ⁝
+    { 5, 20, 7, 1, 19, 26, 29587 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 29613 }, //  
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 29613 }, // ⁩
+    { 6, 22, 4, -3, 18, 31, 29613 }, // ⁪
+    { 6, 22, 4, -3, 18, 28, 29644 }, // ⁫
+    { 6, 22, 4, -3, 18, 31, 29672 }, // ⁬
+    { 6, 22, 4, -3, 18, 31, 29703 }, // ⁭
+    { 6, 22, 4, -3, 18, 34, 29734 }, // ⁮
+    { 6, 22, 4, -3, 18, 31, 29768 }, // ⁯
+    { 9, 12, 12, 2, 22, 28, 29799 }, // ⁰
+    { 6, 12, 8, 1, 19, 18, 29827 }, // ⁱ
+    { 10, 12, 12, 1, 22, 25, 29845 }, // ⁴
+    { 10, 12, 12, 1, 22, 24, 29870 }, // ⁵
+    { 9, 12, 12, 2, 22, 29, 29894 }, // ⁶
+    { 10, 12, 13, 2, 22, 19, 29923 }, // ⁷
+    { 10, 12, 12, 1, 22, 30, 29942 }, // ⁸
+    { 9, 12, 12, 2, 22, 30, 29972 }, // ⁹
+    { 9, 8, 12, 2, 19, 14, 30002 }, // ⁺
+    { 9, 2, 12, 2, 16, 6, 30016 }, // ⁻
+    { 8, 6, 12, 3, 18, 19, 30022 }, // ⁼
+    { 6, 15, 10, 3, 23, 23, 30041 }, // ⁽
+    { 7, 15, 8, 0, 23, 21, 30064 }, // ⁾
+    { 10, 9, 12, 1, 16, 25, 30085 }, // ⁿ
+    { 10, 12, 10, -1, 8, 28, 30110 }, // ₀
+    { 9, 12, 9, -1, 8, 22, 30138 }, // ₁
+    { 10, 12, 9, -2, 8, 24, 30160 }, // ₂
+    { 10, 12, 9, -2, 8, 26, 30184 }, // ₃
+    { 10, 12, 9, -2, 8, 24, 30210 }, // ₄
+    { 10, 12, 10, -1, 8, 24, 30234 }, // ₅
+    { 10, 12, 10, -1, 8, 30, 30258 }, // ₆
+    { 10, 12, 10, -1, 8, 21, 30288 }, // ₇
+    { 9, 12, 9, -1, 8, 30, 30309 }, // ₈
+    { 9, 12, 9, -1, 8, 28, 30339 }, // ₉
+    { 8, 8, 9, 0, 6, 14, 30367 }, // ₊
+    { 8, 2, 9, 0, 3, 6, 30381 }, // ₋
+    { 8, 6, 10, 0, 5, 20, 30387 }, // ₌
+    { 7, 15, 8, 0, 10, 24, 30407 }, // ₍
+    { 7, 15, 6, -3, 10, 21, 30431 }, // ₎
+    { 10, 9, 10, -1, 6, 25, 30452 }, // ₐ
+    { 9, 9, 9, -1, 6, 21, 30477 }, // ₑ
+    { 9, 9, 10, -1, 6, 23, 30498 }, // ₒ
+    { 12, 9, 10, -3, 6, 25, 30521 }, // ₓ
+    { 9, 9, 9, -1, 6, 22, 30546 }, // ₔ
+    { 10, 12, 11, -1, 9, 31, 30568 }, // ₕ
+    { 11, 12, 11, -1, 9, 30, 30599 }, // ₖ
+    { 6, 12, 6, -1, 9, 19, 30629 }, // ₗ
+    { 15, 9, 16, -1, 6, 40, 30648 }, // ₘ
+    { 9, 9, 10, -1, 6, 28, 30688 }, // ₙ
+    { 10, 12, 10, -2, 6, 31, 30716 }, // ₚ
+    { 8, 9, 8, -1, 6, 20, 30747 }, // ₛ
+    { 7, 11, 7, -1, 8, 20, 30767 }, // ₜ
+    { 14, 19, 16, 1, 19, 50, 30787 }, // ₠
+    { 16, 21, 17, 0, 19, 73, 30837 }, // ₡
+    { 16, 20, 17, 0, 19, 54, 30910 }, // ₢
+    { 15, 18, 16, 0, 18, 49, 30964 }, // ₣
+    { 17, 19, 17, -1, 19, 50, 31013 }, // ₤
+    { 22, 20, 23, 0, 17, 81, 31063 }, // ₥
+    { 16, 18, 17, 0, 18, 64, 31144 }, // ₦
+    { 22, 19, 23, 0, 18, 72, 31208 }, // ₧
+    { 23, 19, 24, 0, 18, 85, 31280 }, // ₨
+    { 20, 18, 21, 0, 18, 78, 31365 }, // ₩
+    { 22, 18, 23, 0, 18, 97, 31443 }, // ₪
+    { 17, 23, 18, 0, 19, 62, 31540 }, // ₫
+    { 16, 20, 17, 0, 19, 47, 31602 }, // €
+    { 17, 18, 18, 0, 18, 54, 31649 }, // ₭
+    { 16, 18, 17, 0, 18, 50, 31703 }, // ₮
+    { 25, 25, 26, 0, 19, 98, 31753 }, // ₯
+    { 17, 25, 16, -2, 19, 71, 31851 }, // ₰
+    { 16, 18, 17, 0, 18, 47, 31922 }, // ₱
+    { 17, 22, 19, 1, 20, 72, 31969 }, // ₲
+    { 18, 18, 17, -2, 18, 59, 32041 }, // ₳
+    { 15, 20, 16, 0, 19, 51, 32100 }, // ₴
+    { 16, 21, 18, 1, 19, 64, 32151 }, // ₵
+    { 18, 18, 19, 0, 17, 57, 32215 }, // ₶
+    { 19, 21, 19, -1, 19, 74, 32272 }, // ₷
+    { 14, 18, 16, 1, 18, 46, 32346 }, // ₸
+    { 14, 18, 16, 1, 18, 40, 32392 }, // ₹
+    { 14, 19, 15, 0, 18, 50, 32432 }, // ₺
+    { 16, 20, 18, 1, 19, 62, 32482 }, // ₻
+    { 20, 18, 20, -1, 18, 62, 32544 }, // ₼
+    { 16, 18, 16, -1, 18, 49, 32606 }, // ₽
+    { 18, 21, 18, -1, 21, 60, 32655 }, // ₾
+    { 14, 24, 15, 0, 21, 68, 32715 }, // ₿
+    { 8, 4, 9, 0, 9, 9, 32783 }, // −
+    { 23, 23, 25, 1, 19, 76, 32792 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
@@ -3733,4 +2876,5 @@ static const EpdFontData notosans_12_bolditalic = {
     27,
     -8,
     true,
+    true,
 };
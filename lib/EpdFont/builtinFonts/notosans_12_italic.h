@@ -2,3452 +2,2813 @@
  * generated by fontconvert.py
  * name: notosans_12_italic
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_italicBitmaps[42554] = {
-    0x00, 0xB8, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0,
-    0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x7E, 0x01, 0xF4, 0x01,
-    0x00, 0x00, 0x1E, 0x0F, 0x0B, 0x87, 0xC2, 0xD1, 0xE0, 0xF0, 0xB4, 0x38, 0x2C, 0x0D, 0x0E, 0x02,
-    0x02, 0x40, 0x00, 0x02, 0xC0, 0x34, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x00, 0x38, 0x0B, 0x00, 0x00,
-    0x1D, 0x03, 0x80, 0x00, 0x0B, 0x01, 0xD0, 0x01, 0xAB, 0xEA, 0xFA, 0x80, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0xB0, 0x1E, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x07, 0x40, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x74, 0x0F, 0x00, 0x00, 0x2C, 0x03,
-    0x80, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x01, 0xD0, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x0B, 0xFF, 0xFC, 0x01, 0xF5, 0xC2,
-    0x40, 0x3C, 0x2C, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x3D, 0x38, 0x00, 0x02, 0xFB, 0x40, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xEB, 0xD0, 0x00, 0x0D, 0x2E, 0x00, 0x01, 0xD2, 0xE0,
-    0x00, 0x2C, 0x3D, 0x03, 0x93, 0xDF, 0xC0, 0x3F, 0xFF, 0xE0, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x03, 0x81, 0xFB, 0xD0, 0x03, 0xC0, 0xF0, 0x78, 0x02, 0xD0, 0x78, 0x0E, 0x01, 0xE0, 0x2C, 0x03,
-    0x80, 0xF0, 0x0F, 0x01, 0xD0, 0xF0, 0x03, 0xC0, 0xB0, 0xB4, 0x00, 0xF0, 0x3C, 0x78, 0xBE, 0x3C,
-    0x1D, 0x3C, 0xFB, 0xDB, 0xAF, 0x3C, 0xB4, 0x3C, 0xBE, 0x2D, 0x3C, 0x0F, 0x00, 0x1E, 0x1D, 0x03,
-    0xC0, 0x0F, 0x0B, 0x00, 0xE0, 0x0F, 0x03, 0xC0, 0x74, 0x0B, 0x40, 0xF0, 0x2C, 0x07, 0x80, 0x3C,
-    0x0E, 0x03, 0xC0, 0x0B, 0x9F, 0x03, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00,
-    0xB8, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0xF1, 0xF8, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xBC, 0x00, 0x50, 0x3E, 0x0F, 0x80,
-    0xB8, 0x2E, 0x00, 0xF4, 0x3C, 0x0F, 0x00, 0x1F, 0x3E, 0x03, 0xC0, 0x02, 0xFE, 0x00, 0xF0, 0x00,
-    0x3F, 0x00, 0x3E, 0x00, 0x7F, 0xD0, 0x07, 0xFA, 0xFE, 0xBC, 0x00, 0x7F, 0xF8, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x2E, 0x2D, 0x3C, 0x38, 0x34, 0x20, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0F,
-    0x40, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x1F, 0x00,
-    0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-    0x3D, 0x00, 0x0B, 0x40, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x0B,
-    0x00, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x02, 0xE0,
-    0x00, 0xF0, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x40, 0x3C, 0x00, 0x3D, 0x0D, 0x00, 0x0B, 0xFB,
-    0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x02, 0xF9, 0xA8, 0x02, 0xDF, 0x00, 0x03, 0xE2, 0xD0, 0x01, 0xF0,
-    0x7C, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x0A, 0xAF, 0xEA, 0x97, 0xFF, 0xFF, 0xF8,
-    0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3D, 0x0B, 0xC0, 0xF4, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x2A,
-    0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x3D, 0x7E, 0x7D, 0x10, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x0F, 0xFF, 0xD0, 0x0F, 0xC0, 0xBC, 0x0B, 0xC0, 0x0F, 0x03, 0xD0, 0x03, 0xD1, 0xF0, 0x00, 0xF4,
-    0xF8, 0x00, 0x3D, 0x3D, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xC7, 0xC0, 0x01, 0xF1, 0xE0, 0x00, 0x7C,
-    0xB8, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC1, 0xF0, 0x03, 0xD0, 0x3D, 0x03, 0xF0,
-    0x0B, 0xEB, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xC0, 0xBF,
-    0xE0, 0xFD, 0xF4, 0x3C, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x01, 0xFF, 0xFF,
-    0x40, 0x0E, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xF4, 0x00, 0x01, 0xBD, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x50, 0x00,
-    0xBC, 0x07, 0xFA, 0xBF, 0x40, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xB4, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xF4,
-    0xF0, 0x00, 0x3D, 0x1F, 0x00, 0x0B, 0x82, 0xE0, 0x02, 0xE0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x1F,
-    0x00, 0x3C, 0x03, 0xC0, 0x07, 0xC0, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x02,
-    0x00, 0x0B, 0xC0, 0x3F, 0xAB, 0xF4, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xF4, 0x03, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x7F, 0xE0, 0x0F, 0xBE, 0xBF, 0x03, 0xF4,
-    0x03, 0xD1, 0xF4, 0x00, 0xF4, 0x7C, 0x00, 0x2D, 0x1F, 0x00, 0x0F, 0x47, 0xC0, 0x03, 0xC1, 0xF0,
-    0x01, 0xF0, 0x3E, 0x01, 0xF4, 0x07, 0xFB, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x80, 0x7D, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x02, 0xE0, 0x3C, 0x00,
-    0xF4, 0x0F, 0x80, 0xF8, 0x00, 0xFA, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xBE, 0x00, 0xBD, 0x07,
-    0xD0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC3, 0xE0, 0x01, 0xF0, 0xBC, 0x00,
-    0xF8, 0x0F, 0xEA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0x00, 0xF8, 0x0F, 0x00, 0x1F, 0x0B, 0x80, 0x03, 0xC2, 0xD0,
-    0x00, 0xF0, 0xF4, 0x00, 0x7C, 0x3D, 0x00, 0x2F, 0x0B, 0xC0, 0x1F, 0xC0, 0xFD, 0x6F, 0xE0, 0x1F,
-    0xFD, 0xF4, 0x00, 0x54, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x0B, 0xC0, 0x3E, 0xBF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x7E, 0x0B,
-    0xD0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7E, 0x07,
-    0xD0, 0x10, 0x00, 0x00, 0x28, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x0B, 0x80, 0x0F,
-    0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x02,
-    0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xAA, 0xAA, 0xA8, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xE4, 0x00,
-    0xBF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x01, 0xFF, 0xFE, 0x02, 0x40, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0xF4, 0x00, 0x07, 0x40,
-    0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xE8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7E,
-    0x40, 0x07, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x6F,
-    0xE4, 0x2D, 0x1E, 0x02, 0xFA, 0xF8, 0x1D, 0x3C, 0x0B, 0x80, 0xB4, 0x1E, 0x38, 0x1F, 0x00, 0xF0,
-    0x1E, 0x74, 0x2D, 0x00, 0xE0, 0x1D, 0xB4, 0x3C, 0x01, 0xD0, 0x2C, 0xB0, 0x3C, 0x03, 0xD0, 0x3C,
-    0xB0, 0x3C, 0x07, 0xC0, 0xB4, 0xB4, 0x2E, 0x1E, 0xE2, 0xF0, 0x78, 0x0F, 0xF4, 0xFF, 0x80, 0x3C,
-    0x01, 0x40, 0x14, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x03, 0xFA,
-    0x5A, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0xF8, 0x07, 0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40,
-    0x03, 0xD0, 0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xE0, 0x0B, 0xD0, 0x3D, 0x00, 0x3E, 0x03,
-    0xC0, 0x02, 0xE0, 0x7C, 0x00, 0x3E, 0x0B, 0x80, 0x07, 0xC0, 0xF9, 0x56, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFA, 0xAF, 0xC0, 0x1F, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0xF4, 0x3D, 0x00, 0x0F, 0x83, 0xC0,
-    0x00, 0xF4, 0x3C, 0x00, 0x1F, 0x07, 0xC0, 0x07, 0xE0, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x2E, 0x01, 0xFE, 0x00, 0xF4, 0x00, 0xBC, 0x03, 0xC0, 0x00, 0xF8, 0x1F, 0x00,
-    0x02, 0xF0, 0xB8, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0xBC, 0x3C, 0x00, 0x02,
-    0xE1, 0xF0, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x7C, 0x3D, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x2F, 0x43,
-    0xC0, 0x02, 0xF8, 0x1F, 0x00, 0x7F, 0x80, 0xBF, 0xFF, 0xF4, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F, 0xFF, 0xF8, 0x03, 0xEA, 0xA9, 0x01,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0xAA, 0xA4, 0x03, 0xFF, 0xFD, 0x01, 0xF5, 0x55, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F,
-    0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02,
-    0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x2E, 0x00,
-    0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8,
-    0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xEA, 0xAA, 0xBC, 0x01,
-    0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE4,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00,
-    0x46, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0, 0x02,
-    0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x2F, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0,
-    0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x00,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x02, 0xF0,
-    0x00, 0x3C, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xB4,
-    0x00, 0x0F, 0xB4, 0x03, 0xDD, 0x00, 0x0B, 0x7C, 0x01, 0xE7, 0x80, 0x03, 0xCF, 0x00, 0xB8, 0xE0,
-    0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x01, 0xE2, 0xE0, 0x0F, 0x0F, 0x00, 0xF0, 0xF4, 0x03, 0xC3, 0xC0,
-    0x78, 0x3C, 0x01, 0xE0, 0xB0, 0x3C, 0x1F, 0x00, 0xB4, 0x2D, 0x2E, 0x07, 0xC0, 0x3D, 0x07, 0x4F,
-    0x02, 0xE0, 0x0F, 0x01, 0xEB, 0x40, 0xF4, 0x07, 0xC0, 0x7F, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0xD0,
-    0x1F, 0x00, 0xB4, 0x03, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x03, 0xDF,
-    0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80, 0xB8, 0xB8, 0x02, 0xD0, 0x3D, 0x1F, 0x00, 0xF4, 0x0F,
-    0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0x1F, 0x01, 0xE0, 0x0F, 0x0B, 0x80, 0xB4, 0x03, 0xD2, 0xD0,
-    0x3D, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x0F, 0x3C, 0x07, 0xC0, 0x02, 0xEF, 0x01, 0xE0, 0x00, 0x7F,
-    0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F,
-    0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0x80, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03,
-    0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x40, 0x7F, 0x00, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x90, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C,
-    0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00,
-    0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00,
-    0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x3D,
-    0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8,
-    0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0xB8, 0x00, 0x3C, 0x0F,
-    0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xD0, 0x09,
-    0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xEF, 0xF8, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xB4,
-    0x07, 0xC0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x02,
-    0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBD, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0F, 0x47, 0x80, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x2F, 0x00, 0xF0, 0x00, 0xF4, 0x03, 0xC0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x3D, 0x02,
-    0xE0, 0x00, 0xB4, 0x0F, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x1E, 0x2E, 0x00,
-    0x00, 0x7C, 0xF0, 0x00, 0x00, 0xFB, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x02, 0xF4, 0x00, 0x7C, 0x3C,
-    0x00, 0x3F, 0x40, 0x0F, 0x83, 0xC0, 0x0B, 0xF4, 0x00, 0xF0, 0x3C, 0x00, 0xF7, 0x40, 0x2E, 0x03,
-    0xC0, 0x2D, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC7, 0x80, 0xB8, 0x03, 0xC0, 0x78, 0x78, 0x0F, 0x00,
-    0x3C, 0x0F, 0x07, 0x81, 0xF0, 0x03, 0xC1, 0xE0, 0x38, 0x3D, 0x00, 0x3C, 0x3C, 0x03, 0x87, 0xC0,
-    0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x00, 0x3C, 0xB4, 0x03, 0xCF, 0x00, 0x03, 0xDF, 0x00, 0x3D, 0xE0,
-    0x00, 0x2E, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C,
-    0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80,
-    0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x38, 0x03, 0xC0, 0x3C,
-    0x03, 0xC0, 0x2D, 0x02, 0xD0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xB4, 0x07, 0x80,
-    0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x2D, 0x00, 0x3F, 0xD0, 0x07, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-    0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0x6D, 0x00, 0x00, 0xF0, 0xF0, 0x00,
-    0x1E, 0x0B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x78, 0x02, 0xD0, 0x0B, 0x00, 0x0F, 0x00, 0xE0, 0x00,
-    0xB4, 0x2D, 0x00, 0x03, 0xC1, 0x40, 0x00, 0x04, 0x2F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0x02, 0xE0, 0x3C, 0x03, 0x80, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D,
-    0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07,
-    0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x06, 0x80, 0x02, 0xD7, 0xFF, 0x00, 0x3E,
-    0xE5, 0xFC, 0x03, 0xF4, 0x03, 0xC0, 0x7E, 0x00, 0x3C, 0x0B, 0xC0, 0x03, 0xC0, 0xB8, 0x00, 0x3C,
-    0x0F, 0x40, 0x07, 0xC0, 0xF0, 0x00, 0xBC, 0x1F, 0x00, 0x0F, 0x42, 0xF0, 0x01, 0xF0, 0x3F, 0x80,
-    0x7D, 0x03, 0xDF, 0xBF, 0x80, 0x38, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07,
-    0xFF, 0xD0, 0x7E, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAB, 0x80,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xA0, 0x7C, 0x01, 0xFF, 0xDB, 0x80, 0xBE,
-    0x5B, 0xF4, 0x0F, 0x40, 0x3F, 0x03, 0xE0, 0x02, 0xF0, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xD0,
-    0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xFC, 0x0B, 0x80, 0x1F, 0x80, 0xBC, 0x07,
-    0xF4, 0x03, 0xFB, 0xDB, 0x00, 0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x07,
-    0xFF, 0xC0, 0x7E, 0x1F, 0x83, 0xD0, 0x1E, 0x2E, 0x00, 0xB8, 0xF0, 0x0B, 0xC7, 0xEB, 0xFD, 0x2F,
-    0xFF, 0x80, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x10, 0x3F, 0xAB, 0xC0,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xEE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7D, 0x50,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1B, 0xD4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02,
-    0xF9, 0x6F, 0xD0, 0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F,
-    0x82, 0xE0, 0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0,
-    0x1F, 0xD0, 0x0F, 0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0xF0, 0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1E, 0x06, 0x80, 0x02, 0xD7, 0xFF, 0x40, 0x3E, 0xE5, 0xBC, 0x03, 0xF4, 0x03, 0xC0, 0x7E, 0x00,
-    0x3C, 0x0B, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0xF0, 0x1F,
-    0x00, 0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C,
-    0x00, 0x00, 0x10, 0x02, 0xE0, 0x0F, 0x80, 0x04, 0x00, 0x00, 0x01, 0x40, 0x2E, 0x00, 0xF4, 0x03,
-    0xC0, 0x1F, 0x00, 0x78, 0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0xF0,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00,
-    0x1F, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x02, 0xE0, 0x1F,
-    0x40, 0x3D, 0x07, 0xD0, 0x03, 0xC1, 0xF4, 0x00, 0x7C, 0x7D, 0x00, 0x0B, 0x9F, 0x40, 0x00, 0xBB,
-    0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00,
-    0x3D, 0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x02, 0xE0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x02, 0xD0,
-    0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x40, 0xA8,
-    0x01, 0xA4, 0x00, 0xB1, 0xFF, 0xC2, 0xFF, 0xC0, 0x3D, 0xE5, 0xF6, 0xD1, 0xF4, 0x0F, 0xD0, 0x2F,
-    0xC0, 0x3D, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0x41, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0xB8, 0x00, 0xF4,
-    0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x07, 0xC0, 0x0B, 0x80,
-    0x0F, 0x42, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3C, 0x00,
-    0x7C, 0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF,
-    0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80,
-    0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5,
-    0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E,
-    0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1A, 0x00, 0x02, 0xC7, 0xFF, 0x00, 0x0F, 0x79, 0x7F,
-    0x00, 0x3F, 0x40, 0x3C, 0x01, 0xF8, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xC0, 0x2E, 0x00, 0x0F, 0x00,
-    0xF4, 0x00, 0x7C, 0x03, 0xC0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x7C, 0x03, 0xF8,
-    0x07, 0xD0, 0x0F, 0x7E, 0xFE, 0x00, 0x3C, 0x7F, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xB4, 0x3D, 0x00, 0xFC, 0x2F, 0x00, 0x2F,
-    0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x00, 0x3F,
-    0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xF0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x40, 0xA4, 0x0B, 0x1F, 0xD0, 0x3D, 0xE5, 0x00, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xC0, 0xFD, 0x1A,
-    0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x10, 0x02, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x2F, 0x54, 0xBF, 0xFF, 0x07, 0xE5, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E,
-    0x00, 0x0B, 0x80, 0x01, 0xFA, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xD0,
-    0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x07, 0x83, 0xD0,
-    0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x7C, 0x1E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0,
-    0x1F, 0xD0, 0x7F, 0xBD, 0xB0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0xB4,
-    0x00, 0x3D, 0xB8, 0x00, 0x7C, 0x78, 0x00, 0xF4, 0x7C, 0x02, 0xF0, 0x3C, 0x03, 0xC0, 0x3C, 0x0B,
-    0x80, 0x3C, 0x0F, 0x00, 0x3C, 0x2E, 0x00, 0x3D, 0x3C, 0x00, 0x2D, 0xB8, 0x00, 0x2E, 0xF0, 0x00,
-    0x1F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x50, 0x00, 0x52, 0xE0, 0x0B, 0xD0, 0x0B, 0x8B,
-    0x80, 0x3F, 0x40, 0x3C, 0x1E, 0x01, 0xED, 0x02, 0xE0, 0x78, 0x0F, 0x78, 0x0F, 0x01, 0xE0, 0x78,
-    0xE0, 0x7C, 0x07, 0x83, 0xC3, 0x83, 0xD0, 0x1F, 0x1E, 0x0E, 0x1F, 0x00, 0x7C, 0xB0, 0x38, 0xF4,
-    0x00, 0xF3, 0x80, 0xF3, 0xC0, 0x03, 0xEC, 0x03, 0xED, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x3F,
-    0x40, 0x3F, 0x80, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x2E, 0x00, 0xBC,
-    0x00, 0xF0, 0x1F, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0x7C, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x3C, 0x00, 0x03, 0xD2, 0xE0, 0x00,
-    0xF8, 0x0F, 0x00, 0x2F, 0x00, 0xB8, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D,
-    0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFF,
-    0x00, 0x55, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAA,
-    0xA0, 0x7F, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0xFE, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x7F, 0x40, 0x0B,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2E, 0x00, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB,
-    0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB4, 0x00, 0x00,
-    0xB8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0xBD, 0x00, 0x7D, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0xB8,
-    0x00, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x05, 0x40, 0x00, 0x0F, 0xFF, 0x40, 0xA7, 0x96, 0xFF, 0xF4,
-    0x00, 0x0A, 0xE4, 0x00, 0x24, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x64, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0xD0, 0x01, 0xD0, 0x02, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x0B, 0x40, 0x0F, 0x40, 0x0F,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0x40, 0x00, 0x2F, 0xF8, 0x01, 0xFF, 0xF8, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x40, 0x80, 0x0F, 0xFF, 0xC0, 0x01, 0xFE, 0x40, 0x00, 0xD0, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x07, 0xD0, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xBE, 0xA9, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x02, 0xC1, 0x50, 0xDB, 0xFF, 0xFF, 0x0B, 0xD1, 0xF4, 0x3C, 0x00, 0xE0, 0xE0,
-    0x02, 0xC3, 0x40, 0x0B, 0x0F, 0x00, 0x3C, 0x2E, 0x03, 0xD0, 0xFF, 0xFF, 0xCB, 0x1B, 0x8B, 0x40,
-    0x00, 0x04, 0x0F, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x00, 0xF0, 0x03,
-    0xC0, 0x03, 0xC0, 0x3D, 0x00, 0x0B, 0x42, 0xE0, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x3C, 0xF4, 0x00,
-    0x00, 0xFB, 0x80, 0x00, 0x17, 0xFE, 0x50, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB5, 0x80, 0x00, 0x00,
-    0x00, 0x18, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x6D, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x0F, 0xEA, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x03, 0xFF, 0x80, 0x03, 0xC1, 0xF8, 0x02, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x3D, 0x01,
-    0xE0, 0x07, 0xE0, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0xF4, 0x07, 0xEA, 0xFC, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x3D, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00,
-    0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x55, 0x03, 0xC0, 0xB0,
-    0x1F, 0xFE, 0x07, 0x43, 0x40, 0xF4, 0x14, 0x0B, 0x1C, 0x0B, 0x40, 0x00, 0x1C, 0xB0, 0x3C, 0x00,
-    0x00, 0x37, 0x80, 0xF0, 0x00, 0x00, 0xEE, 0x03, 0xC0, 0x00, 0x03, 0xAC, 0x0F, 0x00, 0x00, 0x0D,
-    0x70, 0x3D, 0x00, 0x00, 0x34, 0xD0, 0x7C, 0x00, 0x02, 0xC2, 0xC0, 0xBF, 0xF8, 0x0E, 0x03, 0x80,
-    0x2A, 0x40, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD9, 0x2D, 0x7D, 0x74, 0x2C, 0xB0, 0x2C,
-    0xE0, 0x38, 0xE0, 0x34, 0xF0, 0xF4, 0x7F, 0x70, 0x14, 0x10, 0x00, 0x40, 0x10, 0x07, 0x82, 0xD0,
-    0x7C, 0x1E, 0x0B, 0xC1, 0xF0, 0xBC, 0x1F, 0x03, 0xD0, 0xF4, 0x07, 0xC2, 0xE0, 0x0F, 0x43, 0xC0,
-    0x1E, 0x0B, 0x40, 0x3C, 0x0F, 0x00, 0x10, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x34,
-    0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00,
-    0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x05, 0x54, 0x03, 0xC0, 0xB0, 0x3F,
-    0xFD, 0x07, 0x43, 0x40, 0xF1, 0xBC, 0x0B, 0x1C, 0x03, 0xC0, 0xF0, 0x1C, 0xB0, 0x0F, 0x03, 0xC0,
-    0x37, 0x80, 0x3D, 0x6E, 0x00, 0xEE, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03, 0xC7, 0x80, 0x0D, 0x70,
-    0x0F, 0x0F, 0x40, 0x34, 0xD0, 0x3C, 0x1F, 0x02, 0xC2, 0xC0, 0xF0, 0x2D, 0x0E, 0x03, 0x82, 0x40,
-    0x24, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA5, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x03,
-    0xD6, 0xE1, 0xD0, 0x2C, 0xB0, 0x07, 0x6C, 0x01, 0xD3, 0x80, 0xF0, 0x7F, 0xF4, 0x01, 0x90, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xF8, 0x00, 0x14, 0x00, 0xBF, 0xD0, 0x34, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x02,
-    0xD0, 0x02, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xF0, 0xAA, 0xA4, 0x00, 0x50, 0x0F, 0xFD,
-    0x09, 0x1F, 0x00, 0x0F, 0x00, 0x0E, 0x06, 0xF8, 0x0A, 0xF4, 0x00, 0x3C, 0x00, 0x2C, 0x40, 0x3C,
-    0xFA, 0xF4, 0x6F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xC0, 0x38, 0x00, 0x00, 0x14, 0x00,
-    0x14, 0x02, 0xE0, 0x01, 0xE0, 0x0F, 0x40, 0x0B, 0x80, 0x3C, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xF0,
-    0x07, 0x80, 0x07, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0xF4, 0x03, 0xC0, 0x03, 0xC0, 0x1F,
-    0x00, 0x2F, 0x00, 0xBC, 0x01, 0xFC, 0x03, 0xF0, 0x1F, 0xE0, 0x0F, 0xFB, 0xEB, 0x40, 0x3E, 0xFD,
-    0x2C, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xF8, 0x29, 0xFF, 0xFE, 0x0A, 0xBF, 0xFF, 0x82, 0xAF, 0xFF, 0xE0, 0xAB, 0xFF, 0xF8, 0x2A, 0xFF,
-    0xFE, 0x0A, 0x7F, 0xFF, 0x82, 0x8F, 0xFF, 0xE0, 0xA2, 0xFF, 0xF8, 0x28, 0x2F, 0xFE, 0x0A, 0x00,
-    0x57, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02, 0x82, 0x80,
-    0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02, 0x82, 0x80, 0x00, 0xA0, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0xFC, 0x10, 0x03, 0x80, 0x74, 0x02, 0xD0, 0x0E, 0x17, 0xD3,
-    0xF4, 0x00, 0x00, 0x2E, 0x1F, 0xD3, 0xAD, 0x02, 0xC0, 0x3C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xF0,
-    0x0F, 0x00, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x2D, 0x7C, 0x74, 0x1C, 0xB0, 0x0D, 0xE0, 0x1C, 0xE0,
-    0x2C, 0xB0, 0x74, 0x3F, 0xE0, 0x05, 0x00, 0x05, 0x02, 0x00, 0x3C, 0x0E, 0x00, 0x78, 0x2D, 0x00,
-    0xF0, 0x7C, 0x02, 0xE0, 0xF4, 0x0B, 0xC2, 0xF0, 0x7C, 0x1F, 0x43, 0xC0, 0xF4, 0x3D, 0x0F, 0x42,
-    0xD0, 0xF4, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x2C, 0x0F, 0xE0,
-    0x00, 0xB4, 0x3D, 0xD0, 0x01, 0xE0, 0x02, 0xD0, 0x03, 0xC0, 0x02, 0xC0, 0x0F, 0x00, 0x03, 0xC0,
-    0x2D, 0x00, 0x03, 0x80, 0x78, 0x00, 0x07, 0x40, 0xF0, 0x3C, 0x0B, 0x03, 0xC0, 0xFC, 0x0F, 0x0B,
-    0x42, 0xFC, 0x0A, 0x1E, 0x07, 0x78, 0x00, 0x3C, 0x1D, 0x74, 0x00, 0xF0, 0x38, 0xB0, 0x02, 0xD0,
-    0xF5, 0xF4, 0x07, 0x81, 0xFF, 0xFD, 0x0F, 0x00, 0x01, 0xE0, 0x2C, 0x00, 0x01, 0xD0, 0x74, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xC0, 0x0F, 0xE0, 0x00, 0xB4, 0x03,
-    0xDD, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x2D,
-    0x00, 0x00, 0x38, 0x07, 0x81, 0x40, 0x07, 0x40, 0xF2, 0xFF, 0x40, 0xB0, 0x2C, 0x34, 0x7C, 0x0F,
-    0x07, 0x40, 0x02, 0xC0, 0xA0, 0xE0, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x02,
-    0xE0, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x02, 0xD0,
-    0x03, 0xFF, 0xF0, 0x78, 0x00, 0x2A, 0xAA, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x1E, 0x09, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x2B,
-    0x80, 0x03, 0x80, 0x06, 0xF8, 0x00, 0xF0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x1D, 0x07, 0x81,
-    0xF0, 0x02, 0xD0, 0xF0, 0x7E, 0xBE, 0xF8, 0x3C, 0x0F, 0xD2, 0xB9, 0x0B, 0x43, 0xAC, 0x00, 0x01,
-    0xE0, 0xF3, 0xC0, 0x00, 0x3C, 0x2C, 0x38, 0x00, 0x0F, 0x07, 0x97, 0x90, 0x02, 0xD0, 0xFF, 0xFF,
-    0x00, 0x78, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x09, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x40,
-    0x00, 0xF0, 0x00, 0x2E, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x3D, 0x00, 0x07, 0xC0,
-    0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x06, 0xC2, 0xFF, 0xFC, 0x06, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xEF, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x2E, 0x0B, 0x80, 0x01, 0xF0, 0x1E, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x7E, 0xAA, 0xF0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x1F, 0x55, 0x5F, 0x00, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0xF4, 0x3D, 0x00, 0x02,
-    0xE2, 0xF0, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0,
-    0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0,
-    0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8,
-    0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7C, 0x38, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0,
-    0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0,
-    0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8,
-    0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x1F, 0xE0,
-    0xD0, 0x00, 0x0E, 0xBF, 0xF0, 0x00, 0x07, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00,
-    0x3C, 0xF0, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x0B, 0x82, 0xE0, 0x00,
-    0x07, 0xC0, 0x78, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x01, 0xFA, 0xAB, 0xC0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7D, 0x55, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00,
-    0xB8, 0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x2D, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00,
-    0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F,
-    0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5,
-    0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0x83, 0x80, 0x00, 0x0E, 0x0A, 0x00, 0x00, 0x1D, 0xB4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xBC, 0x00,
-    0x00, 0x3C, 0xF0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0xB8, 0x2E, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x3E, 0x01, 0xF0, 0x01, 0xFA, 0xAB, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7D, 0x55,
-    0x7C, 0x03, 0xD0, 0x00, 0xF4, 0x2F, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x2E,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x3D, 0x55, 0x40, 0x00, 0x07, 0xC0, 0x7F, 0xFF, 0xD0, 0x00, 0x0F, 0x40, 0x7E, 0xAA, 0x80,
-    0x00, 0x2F, 0xAA, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xF9, 0x56, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x80, 0x08, 0x02,
-    0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E,
-    0xAA, 0x90, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E, 0xAA, 0x90,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x78, 0x78, 0x00, 0x74, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00, 0xFF, 0xFF, 0x80, 0x3E, 0xAA, 0x90, 0x1F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x01,
-    0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x95, 0x50, 0x03, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x01,
-    0xBE, 0x40, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x02,
-    0xD0, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0,
-    0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1B,
-    0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x7C, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0xB8, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0x2F, 0x02, 0xE0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x1F, 0x2F, 0xFF, 0xC0, 0x2F, 0x3F, 0xFF,
-    0xC0, 0x2E, 0x07, 0xC0, 0x00, 0x3E, 0x0B, 0x80, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xFC, 0x0F, 0x00,
-    0x02, 0xF4, 0x0F, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x7F, 0x83, 0x40, 0x00, 0x3A, 0xFF, 0xC0, 0x00,
-    0x1C, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xE0, 0x2F, 0x80, 0x00, 0xB8,
-    0x0B, 0xF0, 0x00, 0x3D, 0x03, 0xFD, 0x00, 0x0F, 0x00, 0xF7, 0xC0, 0x07, 0xC0, 0x78, 0xF0, 0x01,
-    0xE0, 0x2E, 0x2E, 0x00, 0xB4, 0x0F, 0x47, 0xC0, 0x3D, 0x03, 0xC0, 0xF4, 0x0F, 0x00, 0xF0, 0x2E,
-    0x07, 0xC0, 0x78, 0x03, 0xC2, 0xE0, 0x2D, 0x00, 0xF4, 0xB4, 0x0F, 0x40, 0x1E, 0x3C, 0x03, 0xC0,
-    0x03, 0xCF, 0x01, 0xF0, 0x00, 0xBB, 0xC0, 0x78, 0x00, 0x1F, 0xE0, 0x2D, 0x00, 0x03, 0xF4, 0x0F,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3,
-    0xD0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00,
-    0x00, 0x3C, 0x1F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xF4,
-    0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x07, 0xD0,
-    0xF8, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x7F, 0xEF, 0xF4,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xC3, 0x80, 0x00, 0x03, 0x80, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00,
-    0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00,
-    0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x2F,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x7F, 0x83, 0x40, 0x00, 0x3A,
-    0xFF, 0xC0, 0x00, 0x1C, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03,
-    0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00,
-    0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF,
-    0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00,
-    0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C,
-    0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x38, 0x7D, 0x00, 0xF8, 0x1F, 0x43, 0xE0, 0x07, 0xDF, 0x80,
-    0x01, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xEF, 0x40, 0x0F, 0x87, 0xD0, 0x3E, 0x01, 0xF4, 0xB8,
-    0x00, 0x7C, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xE2, 0xE0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xFE, 0x02, 0xF0, 0x00, 0xFF, 0xC0, 0xF4,
-    0x00, 0xB8, 0xF0, 0x7C, 0x00, 0x7C, 0x3C, 0x2E, 0x00, 0x7C, 0x0F, 0x0F, 0x40, 0x3D, 0x03, 0xC3,
-    0xD0, 0x3D, 0x01, 0xF0, 0xF0, 0x2E, 0x00, 0xBC, 0x3C, 0x1F, 0x00, 0x3E, 0x0F, 0x5F, 0x00, 0x1F,
-    0x43, 0xEF, 0x40, 0x0F, 0xC0, 0xBF, 0x40, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xFF, 0xBF,
-    0xD0, 0x07, 0xDB, 0xFF, 0x80, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C,
-    0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00,
-    0xF0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x0B, 0x4F, 0x00, 0x00, 0x0B, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0B, 0x40,
-    0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40,
-    0x00, 0xB8, 0x03, 0xC0, 0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D,
-    0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D,
-    0x00, 0xF4, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0,
-    0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00,
-    0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0F, 0xFA, 0x40, 0x03, 0xFF, 0xFD, 0x01, 0xF0, 0x1F, 0xC0, 0xB8, 0x00,
-    0xF4, 0x3D, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x02, 0xF0, 0xB8, 0x02,
-    0xF4, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x2F, 0xEF, 0xD0, 0x00, 0x07, 0xC0, 0x2E, 0x00, 0x00, 0xF4, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x3E,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x3C,
-    0x2E, 0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0x0B, 0x40, 0xFD, 0x00,
-    0x00, 0xF4, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00,
-    0x07, 0xC0, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x3C, 0x7A, 0xBF, 0x00, 0x03, 0xC3, 0xFF, 0x80, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5, 0xBF, 0x43, 0xD0, 0x0F, 0xC2, 0xF0, 0x02, 0xF0, 0xF4, 0x00,
-    0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01,
-    0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB, 0xDB, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5, 0xBF, 0x43, 0xD0, 0x0F, 0xC2,
-    0xF0, 0x02, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC3,
-    0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB, 0xDB, 0x00, 0x7F, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF0,
-    0xF0, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x07, 0xFF, 0x5E, 0x07, 0xE5,
-    0xBF, 0x43, 0xD0, 0x0F, 0xC2, 0xF0, 0x02, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00, 0x2E, 0x2E, 0x00,
-    0x0F, 0x4B, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x03, 0xFB,
-    0xDB, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x1F, 0xE0, 0xD0,
-    0x0F, 0x7F, 0xF0, 0x03, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD, 0x78,
-    0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00, 0xB8,
-    0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4,
-    0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0B,
-    0x80, 0x03, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD,
-    0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00,
-    0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07,
-    0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x02, 0xC3, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x1E, 0xB4, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x05, 0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0, 0xF4, 0x03, 0xF0, 0xBC,
-    0x00, 0xBC, 0x3D, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4,
-    0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0, 0x1F, 0xF4, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x01, 0x0A, 0x80, 0x07, 0xFF, 0x3E, 0xFF, 0xD0, 0x7E, 0x5E, 0xFE,
-    0x4B, 0xC3, 0xD0, 0x1F, 0xE0, 0x1F, 0x2E, 0x00, 0x3F, 0x00, 0x7C, 0xF4, 0x00, 0xF4, 0x07, 0xD7,
-    0xC0, 0x03, 0xEB, 0xFD, 0x2E, 0x00, 0x1F, 0xFF, 0x80, 0xB8, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x07,
-    0xE0, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0x02, 0xFF, 0x40, 0x10, 0x3F, 0xBD, 0xFF, 0xEB,
-    0xD0, 0x7F, 0x87, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07, 0xFF,
-    0xD0, 0x7E, 0x46, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAB, 0x80, 0x2F,
-    0xFD, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x01, 0x6F, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x07, 0xE1, 0xF8, 0x3D, 0x01, 0xE2, 0xE0, 0x0B,
-    0x8F, 0x00, 0xBC, 0x7E, 0xBF, 0xD2, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0x01, 0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F, 0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C, 0x02, 0xF0,
-    0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C,
-    0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x02, 0xFE, 0x00, 0x2D, 0x3C, 0x02, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F,
-    0xFC, 0x07, 0xE1, 0xF8, 0x3D, 0x01, 0xE2, 0xE0, 0x0B, 0x8F, 0x00, 0xBC, 0x7E, 0xBF, 0xD2, 0xFF,
-    0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF0, 0x0F, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x01, 0xF8, 0x7E, 0x0F, 0x40, 0x78, 0xB8, 0x02,
-    0xE3, 0xC0, 0x2F, 0x1F, 0xAF, 0xF4, 0xBF, 0xFE, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00,
-    0x00, 0x7C, 0x00, 0x40, 0xFE, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0x05, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7C, 0x01,
-    0xE0, 0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B,
-    0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0,
-    0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0xD0, 0x3D, 0x3C, 0x28, 0x03, 0x40, 0x00, 0x00, 0x05, 0x00, 0x0B, 0x80, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-    0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0xF0, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-    0x78, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x90, 0x01, 0xFA, 0xF4, 0x00, 0x0F,
-    0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0x4F, 0x00, 0x01, 0x02, 0xD0, 0x00, 0x00, 0x78, 0x00, 0xAE,
-    0x4F, 0x01, 0xFF, 0xF7, 0xC1, 0xF8, 0x0B, 0xF0, 0xF4, 0x00, 0xFC, 0x7C, 0x00, 0x2F, 0x2E, 0x00,
-    0x0B, 0x8F, 0x40, 0x03, 0xD3, 0xD0, 0x00, 0xF0, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x7C, 0x03, 0xFA,
-    0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0xFE, 0x0E,
-    0x00, 0x2D, 0xFF, 0xC0, 0x03, 0x41, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x90, 0x02, 0xD7,
-    0xFF, 0x40, 0x3E, 0xF5, 0xFC, 0x03, 0xF8, 0x07, 0xC0, 0x7E, 0x00, 0x7C, 0x0B, 0xC0, 0x07, 0xC0,
-    0xF8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x80, 0xF0, 0x00, 0xF4, 0x1F, 0x00, 0x1F, 0x02, 0xE0, 0x02,
-    0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xD0, 0x03, 0xD0, 0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F,
-    0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C,
-    0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C,
-    0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01,
-    0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x2F, 0xF0, 0x00, 0xB8, 0xB4, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01,
-    0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00,
-    0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0,
-    0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x2F, 0xD2, 0xC0,
-    0x1E, 0xBF, 0xD0, 0x0A, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x40,
-    0x2F, 0x96, 0xF0, 0x1F, 0x40, 0x3E, 0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0x7C,
-    0xB8, 0x00, 0x2E, 0x3D, 0x00, 0x0F, 0x8F, 0x40, 0x03, 0xC2, 0xE0, 0x02, 0xE0, 0x7C, 0x01, 0xF0,
-    0x0B, 0xEB, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C,
-    0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B,
-    0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00,
-    0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0,
-    0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x97, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x1C, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0x96, 0xF4, 0x07, 0xC0, 0x3F, 0x80, 0xF4,
-    0x0B, 0xBC, 0x0F, 0x01, 0xE7, 0xC1, 0xE0, 0x7C, 0x7C, 0x2D, 0x0F, 0x07, 0x83, 0xD3, 0xC0, 0xB4,
-    0x3D, 0xB4, 0x0F, 0x02, 0xFE, 0x02, 0xE0, 0x1F, 0xC0, 0x7C, 0x00, 0xFE, 0xBF, 0x40, 0x3E, 0xFF,
-    0x80, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3D, 0x00, 0x2E, 0x0F,
-    0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0xB8, 0x00, 0x78, 0x3D, 0x00, 0x2E, 0x0F,
-    0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1, 0xE0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x07,
-    0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x14, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0x01, 0xF0, 0xB8, 0x00,
-    0x78, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1, 0xE0, 0x03, 0xF0, 0xB8, 0x01,
-    0xF8, 0x2F, 0x01, 0xFD, 0x07, 0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xF4, 0xF0, 0x00, 0xA0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xC1,
-    0xF0, 0x01, 0xF0, 0xB8, 0x00, 0x78, 0x3D, 0x00, 0x2E, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x07, 0xC1,
-    0xE0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01, 0xFD, 0x07, 0xFB, 0xDB, 0x00, 0xBF, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0x80, 0x03, 0xC2, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00,
-    0x0F, 0x07, 0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00,
-    0x1F, 0x07, 0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF,
-    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E,
-    0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x01, 0xE0, 0x68, 0x00, 0x0B, 0x5F, 0xFC, 0x00, 0x3E, 0xE5, 0xFC, 0x00, 0xFD, 0x00, 0xF0, 0x07,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x3C, 0x03, 0xD0, 0x01, 0xF0, 0x0F, 0x00,
-    0x0B, 0xC0, 0x7C, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF0, 0x0F, 0xE0, 0x1F, 0x40, 0x3D, 0xFB, 0xF8,
-    0x00, 0xF1, 0xFF, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD1, 0xF0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00,
-    0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03,
-    0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05,
-    0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0, 0xF4, 0x03, 0xF0, 0xBC, 0x00, 0xBC, 0x3D, 0x00, 0x2E,
-    0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4, 0x00, 0xFC, 0x2E, 0x00, 0x7E,
-    0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0, 0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x05, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B,
-    0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40,
-    0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x20, 0x05, 0x00, 0x0D, 0x07,
-    0x80, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x1F, 0xFD,
-    0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02, 0xE1, 0xF0, 0x00,
-    0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07,
-    0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0B,
-    0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF8, 0x07,
-    0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40, 0x03, 0xD0,
-    0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D,
-    0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07,
-    0xFD, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xE0, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFD, 0x07, 0xE4, 0x60, 0x3D, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFA, 0xB8, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xB8, 0xB4, 0x00, 0x07, 0x40,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20,
-    0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xFD, 0x00, 0x3D, 0x3C, 0x02, 0x80, 0x34, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x7F, 0xFD, 0x07, 0xE4, 0x60, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFA, 0xB8,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0x80, 0x3F, 0x80, 0x08, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x1F, 0xFF, 0x41, 0xF9, 0x18, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE,
-    0xAE, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x0F, 0x2E, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x20, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2C, 0x00, 0x78, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x01, 0xFF, 0xF4, 0x07, 0xE4, 0x60,
-    0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xAB, 0x80, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x1E, 0x3C, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0x7F,
-    0xFF, 0xE0, 0x02, 0xE0, 0x1F, 0xE0, 0x0F, 0x40, 0x0B, 0xC0, 0x3C, 0x00, 0x0F, 0x81, 0xF0, 0x00,
-    0x2F, 0x0B, 0x80, 0x00, 0x7C, 0x3D, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x2E,
-    0x1F, 0x00, 0x00, 0xF8, 0xB8, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x3F, 0x0F, 0x00, 0x02, 0xF4, 0x3C,
-    0x00, 0x2F, 0x81, 0xF0, 0x07, 0xF8, 0x0B, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0xF0, 0x00, 0x00, 0x0B, 0x8B, 0x40, 0x00, 0x00, 0x3D, 0x38, 0x00, 0x00, 0x00, 0xF2,
-    0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x68, 0x1F, 0x00, 0x00, 0x1F, 0xFD, 0xB8, 0x00, 0x02,
-    0xF9, 0x6F, 0xD0, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x02,
-    0xE0, 0x00, 0x1F, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x00, 0xFE,
-    0xF6, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xB8, 0x07, 0xF8, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xF0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x1F, 0x2F, 0xFF, 0xC0,
-    0x2F, 0x3F, 0xFF, 0xC0, 0x2E, 0x07, 0xC0, 0x00, 0x3E, 0x0B, 0x80, 0x00, 0x7C, 0x0F, 0x40, 0x00,
-    0xFC, 0x0F, 0x00, 0x02, 0xF4, 0x0F, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0x7F, 0x80, 0x2F, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2A, 0x07, 0xC0, 0x02, 0xFF, 0xDB,
-    0x80, 0x0B, 0xE0, 0xBF, 0x40, 0x1F, 0x40, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x2E,
-    0x00, 0x7C, 0x00, 0x2D, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0xFC,
-    0x00, 0xB8, 0x01, 0xF8, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x3F, 0xBD, 0xB0, 0x00, 0x1F, 0xF4, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xAA, 0xA4, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x01, 0xFF, 0xF0, 0x1F, 0x87, 0xE0, 0xF4, 0x07, 0x8B, 0x80, 0x2E,
-    0x3C, 0x02, 0xF1, 0xFA, 0xFF, 0x4B, 0xFF, 0xE0, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00,
-    0x07, 0xC0, 0x04, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40,
-    0x0B, 0x01, 0xD0, 0x00, 0xFF, 0xE0, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xF8, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x03, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x40, 0x08, 0x00, 0xE0, 0x2C, 0x00, 0xBF, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F,
-    0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C, 0x02, 0xF0, 0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x03, 0xFF, 0xFE,
-    0x00, 0xFA, 0xAA, 0x40, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1F,
-    0xFF, 0x01, 0xF8, 0x7E, 0x0F, 0x40, 0x78, 0xB8, 0x02, 0xE3, 0xC0, 0x2F, 0x1F, 0xAF, 0xF4, 0xBF,
-    0xFE, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x40, 0xFE, 0xAF, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F,
-    0xFF, 0xF8, 0x03, 0xEA, 0xA9, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x1A, 0x40, 0x07, 0xFF, 0xC0, 0x7E, 0x1F, 0x83, 0xD0, 0x1E, 0x2E, 0x00,
-    0xB8, 0xF0, 0x0B, 0xC7, 0xEB, 0xFD, 0x2F, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80,
-    0x00, 0x1F, 0x00, 0x10, 0x3F, 0xAB, 0xC0, 0x2F, 0xFE, 0x00, 0x02, 0xD0, 0x00, 0x1D, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x78, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF9, 0x55, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFA,
-    0xAA, 0x40, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x2D, 0x00, 0x3C, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF0, 0x07, 0xE1, 0xF8, 0x0F, 0x40, 0x78, 0x2E, 0x00, 0xB8, 0x3C,
-    0x02, 0xF0, 0x7E, 0xBF, 0xD0, 0xBF, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x7C, 0x00, 0x40, 0x3F, 0xAB, 0xC0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03, 0x80,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00,
-    0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A,
-    0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03,
-    0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xF0, 0xF0, 0x00,
-    0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02, 0xF9, 0x6F,
-    0xD0, 0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F, 0x82, 0xE0,
-    0x00, 0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0, 0x1F, 0xD0,
-    0x0F, 0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xF0, 0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x80, 0x04,
-    0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x40,
-    0x01, 0xD0, 0x74, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x05, 0x00, 0x7F, 0xF5, 0xE0, 0x2F, 0x96, 0xFD, 0x03, 0xD0, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x0F,
-    0x40, 0x0B, 0x81, 0xF0, 0x00, 0xF8, 0x2E, 0x00, 0x0F, 0x42, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x3F,
-    0x02, 0xE0, 0x07, 0xE0, 0x2F, 0x01, 0xFD, 0x00, 0xFE, 0xF7, 0xC0, 0x07, 0xFD, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x50, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4,
-    0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0,
-    0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x05, 0x00, 0x7F, 0xF5, 0xE0, 0x2F, 0x96, 0xFD,
-    0x03, 0xD0, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x00, 0xF8, 0x2E, 0x00,
-    0x0F, 0x42, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x3F, 0x02, 0xE0, 0x07, 0xE0, 0x2F, 0x01, 0xFD, 0x00,
-    0xFE, 0xF7, 0xC0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F,
-    0x00, 0x50, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x18, 0x02, 0xF4, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x15, 0x54, 0x3D, 0x00, 0x3F, 0xF4, 0x3C, 0x00, 0x2A, 0xF4, 0x3C, 0x00, 0x00, 0xF0,
-    0x3D, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x02, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x03, 0xC0,
-    0x07, 0xFE, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x50, 0x07, 0xFF, 0x5E, 0x02, 0xF9, 0x6F, 0xD0,
-    0x3D, 0x00, 0xFC, 0x0B, 0xC0, 0x0B, 0xC0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x0F, 0x82, 0xE0, 0x00,
-    0xF4, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x03, 0xF0, 0x2E, 0x00, 0x7E, 0x02, 0xF0, 0x1F, 0xD0, 0x0F,
-    0xEF, 0x7C, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x05, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x0B, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x7C, 0x02, 0xE0, 0x00,
-    0x2E, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80,
-    0x00, 0x7C, 0x02, 0xE5, 0x55, 0x6E, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3E, 0xAA, 0xAB, 0xC0, 0x1F,
-    0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x0F, 0x40,
-    0x3C, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x0B,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x68, 0x00, 0x2D,
-    0x7F, 0xF4, 0x03, 0xEE, 0x5B, 0xC0, 0x3F, 0x40, 0x3C, 0x07, 0xE0, 0x03, 0xC0, 0xBC, 0x00, 0x7C,
-    0x0B, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0xF0, 0x2E, 0x00,
-    0x1F, 0x03, 0xD0, 0x02, 0xE0, 0x3C, 0x00, 0x3D, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x1E, 0x00, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0x2E, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x07, 0xC0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0xF9, 0x55, 0x5F, 0x80,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0xFA, 0xAA, 0xAF, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x02, 0xE0, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x07,
-    0xC0, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-    0x05, 0x40, 0x02, 0xD3, 0xFF, 0x00, 0x3D, 0xF5, 0xFC, 0x03, 0xF8, 0x07, 0xC0, 0x7E, 0x00, 0x3C,
-    0x07, 0xC0, 0x07, 0xC0, 0xB8, 0x00, 0xB8, 0x0F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0xF0, 0x1F, 0x00,
-    0x0F, 0x02, 0xE0, 0x01, 0xF0, 0x3D, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x3C, 0x00,
-    0x00, 0x04, 0x01, 0x00, 0x1F, 0xE0, 0xD0, 0x0F, 0xBF, 0xF0, 0x07, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xC0, 0x00, 0x06, 0xF9, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0x00, 0x10, 0xFE, 0x0E,
-    0x3D, 0xFF, 0xC3, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03,
-    0xC0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00,
-    0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xC0, 0x00, 0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x02, 0xE0,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x10, 0x05, 0x00, 0x74, 0x1D, 0x00, 0x3F, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00,
-    0x1B, 0xE4, 0x00, 0x7F, 0xFC, 0x00, 0x08, 0x00, 0x40, 0xE0, 0x38, 0x0F, 0xFF, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-    0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00,
-    0x03, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x00,
-    0xB4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x02, 0xE0,
-    0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x0E, 0x00,
-    0x38, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0x40,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x03, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x6F, 0x90, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x50, 0x2E, 0x03, 0xD0, 0x3C,
-    0x07, 0xC0, 0x78, 0x0B, 0x80, 0xF4, 0x0F, 0x01, 0xF0, 0x2E, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x00,
-    0xBF, 0xF4, 0x0F, 0x00, 0x1F, 0xF8, 0x07, 0xC0, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0xF4,
-    0x00, 0x2E, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x01, 0xF0, 0x02,
-    0xE0, 0x00, 0x78, 0x00, 0xF4, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x03, 0xC0,
-    0x07, 0xC0, 0x01, 0xF0, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x1F, 0x00, 0x1B, 0xE4, 0x0B, 0x80, 0x1F, 0xFF, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x15, 0xBD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x10, 0x01, 0x40, 0x0B, 0x80, 0x7C, 0x00, 0xF8, 0x07, 0xC0, 0x01, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x02, 0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E,
-    0x00, 0x7C, 0x03, 0xD0, 0x07, 0x80, 0x3C, 0x00, 0xB8, 0x07, 0xC0, 0x0F, 0x40, 0x78, 0x00, 0xF0,
-    0x0B, 0x40, 0x1F, 0x00, 0xF4, 0x02, 0xE0, 0x0F, 0x00, 0x3D, 0x01, 0xF0, 0x03, 0xC0, 0x2E, 0x00,
-    0x3C, 0x02, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x0B, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x46, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3D, 0x3C, 0x00, 0x28, 0x03, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0, 0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0,
-    0x03, 0xD0, 0x2F, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00,
-    0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x00, 0x00, 0x1F, 0x4B, 0x80, 0x00,
-    0x2E, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x00, 0xF4, 0x00,
-    0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x54, 0x02, 0xE0, 0x1F, 0x40, 0x3D, 0x07, 0xD0,
-    0x03, 0xC1, 0xF4, 0x00, 0x7C, 0x7D, 0x00, 0x0B, 0x9F, 0x40, 0x00, 0xBB, 0xE0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xF8, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xF0, 0x03,
-    0xC0, 0x0F, 0x40, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40,
-    0x2E, 0x01, 0xF4, 0x03, 0xD0, 0x7D, 0x00, 0x3C, 0x1F, 0x40, 0x07, 0xC7, 0xD0, 0x00, 0xB9, 0xF4,
-    0x00, 0x0B, 0xBE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x8F, 0x40, 0x01, 0xF0, 0x7C, 0x00, 0x2E,
-    0x03, 0xD0, 0x03, 0xD0, 0x2F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E,
-    0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0xBC, 0x00, 0x07, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00,
-    0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x0B, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1F, 0x00,
-    0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01,
-    0xF0, 0x02, 0xE0, 0x02, 0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0x50, 0x00, 0x00,
-    0xF0, 0x0E, 0x01, 0xE0, 0x2D, 0x02, 0xE0, 0x38, 0x03, 0xD0, 0xB0, 0x03, 0xC0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x7C, 0x02, 0xE3, 0xD0, 0x0F, 0x5E, 0x00, 0x3C, 0xE0,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x02,
-    0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x04, 0x0F, 0x41,
-    0xF0, 0xF0, 0x2F, 0x1F, 0x00, 0x42, 0xE0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07,
-    0xC0, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC1, 0x01, 0xF2, 0xE0, 0xB8, 0xF8,
-    0x2D, 0x04, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF5, 0xE0, 0x03, 0xFF, 0x40, 0x1F, 0xD0, 0x02, 0xFC, 0x00,
-    0x2F, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0xF0,
-    0x02, 0xE0, 0x03, 0xD4, 0x03, 0xFC, 0x07, 0xF4, 0x2F, 0xC0, 0xBF, 0x40, 0x1F, 0x40, 0x0F, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x78, 0x0B, 0xE0, 0x00, 0x2E, 0x02, 0xFC, 0x00, 0x0F,
-    0x40, 0xFF, 0x40, 0x03, 0xC0, 0x3D, 0xF0, 0x01, 0xF0, 0x1E, 0x3C, 0x00, 0x78, 0x0B, 0x8B, 0x80,
-    0x2D, 0x03, 0xD1, 0xF0, 0x0F, 0x40, 0xF0, 0x3D, 0x03, 0xC0, 0x3C, 0x0B, 0x81, 0xF0, 0x1E, 0x00,
-    0xF0, 0xB8, 0x0B, 0x40, 0x3D, 0x2D, 0x03, 0xD0, 0x07, 0x8F, 0x00, 0xF0, 0x00, 0xF3, 0xC0, 0x7C,
-    0x00, 0x2E, 0xF0, 0x1E, 0x00, 0x07, 0xF8, 0x0B, 0x40, 0x00, 0xFD, 0x03, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0,
-    0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00,
-    0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D,
-    0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0xF4, 0x00, 0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F,
-    0xC0, 0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x03, 0xDF, 0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80,
-    0xB8, 0xB8, 0x02, 0xD0, 0x3D, 0x1F, 0x00, 0xF4, 0x0F, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0x1F,
-    0x01, 0xE0, 0x0F, 0x0B, 0x80, 0xB4, 0x03, 0xD2, 0xD0, 0x3D, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x0F,
-    0x3C, 0x07, 0xC0, 0x02, 0xEF, 0x01, 0xE0, 0x00, 0x7F, 0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9, 0x00,
-    0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00,
-    0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E,
-    0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1F, 0x00, 0x00, 0x0B, 0x5F, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x78,
-    0x0B, 0xE0, 0x00, 0x2E, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0xFF, 0x40, 0x03, 0xC0, 0x3D, 0xF0, 0x01,
-    0xF0, 0x1E, 0x3C, 0x00, 0x78, 0x0B, 0x8B, 0x80, 0x2D, 0x03, 0xD1, 0xF0, 0x0F, 0x40, 0xF0, 0x3D,
-    0x03, 0xC0, 0x3C, 0x0B, 0x81, 0xF0, 0x1E, 0x00, 0xF0, 0xB8, 0x0B, 0x40, 0x3D, 0x2D, 0x03, 0xD0,
-    0x07, 0x8F, 0x00, 0xF0, 0x00, 0xF3, 0xC0, 0x7C, 0x00, 0x2E, 0xF0, 0x1E, 0x00, 0x07, 0xF8, 0x0B,
-    0x40, 0x00, 0xFD, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2D, 0x00,
-    0x07, 0x8F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9,
-    0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xEF, 0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC,
-    0x00, 0x7C, 0x0F, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0,
-    0x2E, 0x00, 0x2F, 0x03, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x0B, 0xC0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x50, 0x2A,
-    0x42, 0xC3, 0xD7, 0xFF, 0x44, 0x0F, 0xB9, 0x7F, 0x00, 0x3F, 0x40, 0x7C, 0x01, 0xF8, 0x01, 0xF0,
-    0x0B, 0xC0, 0x07, 0xC0, 0x3E, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0xF4, 0x07, 0xC0, 0x03, 0xD0, 0x1F,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0xBC, 0x03, 0xD0, 0x03, 0xE0, 0x0F, 0x00, 0x0F, 0x40, 0x7C, 0x00,
-    0x3C, 0x00, 0x01, 0xF4, 0x00, 0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F, 0xC0, 0x00, 0xF4, 0x0F,
-    0xF4, 0x00, 0x3C, 0x03, 0xDF, 0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80, 0xB4, 0xB8, 0x02, 0xD0,
-    0x3D, 0x0F, 0x00, 0xF4, 0x0F, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0x78, 0x1F, 0x01, 0xE0, 0x0F, 0x0B,
-    0x80, 0xB4, 0x02, 0xD2, 0xD0, 0x3D, 0x00, 0x7C, 0xF0, 0x0F, 0x00, 0x0F, 0x7C, 0x07, 0xC0, 0x02,
-    0xFF, 0x01, 0xE0, 0x00, 0x3F, 0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x05, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x40, 0x69, 0x00, 0x2C, 0x7F, 0xF4, 0x03, 0xDE, 0x5B, 0xC0, 0x3F,
-    0x40, 0x3C, 0x07, 0xE0, 0x03, 0xC0, 0x7C, 0x00, 0x7C, 0x0B, 0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF4,
-    0x0F, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0xF0, 0x2E, 0x00, 0x1F, 0x03, 0xD0, 0x02, 0xE0, 0x3C, 0x00,
-    0x3D, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x0F,
-    0x07, 0xC0, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00,
-    0x1F, 0x0F, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x01, 0xF4, 0x3E, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xFB, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F,
-    0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8,
-    0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x14, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00,
-    0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00,
-    0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC,
-    0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0xB0, 0x2C, 0x00, 0x7F, 0xF8, 0x00, 0x1B, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E,
-    0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00,
-    0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xB8, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x07,
-    0x83, 0x80, 0x00, 0x00, 0xD0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x0F, 0x4B, 0x40, 0x02, 0xD1, 0xD0, 0x00,
-    0x70, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x0B, 0xE5, 0xBC,
-    0x01, 0xF4, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x1F, 0x0B, 0x80,
-    0x02, 0xE0, 0xF4, 0x00, 0x3E, 0x0F, 0x40, 0x03, 0xC0, 0xB8, 0x00, 0xB8, 0x07, 0xC0, 0x1F, 0x00,
-    0x2F, 0xAF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xD0, 0x0F, 0x00,
-    0x00, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xE0,
-    0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xD5, 0x54, 0x03, 0xD0, 0x00, 0x7F,
-    0xFF, 0xD0, 0x3D, 0x00, 0x0B, 0xEA, 0xA8, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x02,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x06, 0x90, 0x01, 0xFF,
-    0xF4, 0x3F, 0xFD, 0x0B, 0xE5, 0xBD, 0xF9, 0x2F, 0x1F, 0x40, 0x3F, 0xD0, 0x1F, 0x3E, 0x00, 0x1F,
-    0x80, 0x1F, 0x3C, 0x00, 0x1F, 0x00, 0x7D, 0x78, 0x00, 0x1F, 0xAF, 0xF4, 0xB8, 0x00, 0x2F, 0xFF,
-    0x80, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0xB8, 0x00, 0xBF, 0x00, 0x00,
-    0x7C, 0x01, 0xFF, 0x40, 0x10, 0x2F, 0xAF, 0xCB, 0xFA, 0xF4, 0x0B, 0xFE, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x02, 0xE0, 0x1F, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80,
-    0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B,
-    0xC0, 0xB8, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA4, 0x02, 0xC7, 0xF4,
-    0x03, 0xDE, 0x50, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0xC0, 0x3D,
-    0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8,
-    0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x02,
-    0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B, 0xC0, 0xB8, 0x00, 0x3C, 0x0F,
-    0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x29, 0x00, 0xB1, 0xFD, 0x00, 0xF7,
-    0x94, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x07, 0x9F, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xF0,
-    0x02, 0xE0, 0x1F, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00, 0x3C, 0x0B, 0x80,
-    0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x55, 0xBE, 0x00, 0xFF, 0xFF, 0x40, 0x1F, 0xAB, 0xC0, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x02, 0xE0, 0x03, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x07, 0xC0, 0x0B,
-    0xC0, 0xB8, 0x00, 0x3C, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07, 0x80, 0x03,
-    0xCB, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x40, 0x0B,
-    0x1F, 0xD0, 0x03, 0xDE, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4,
-    0x03, 0xFF, 0xFE, 0x02, 0xF4, 0x02, 0x40, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x14, 0x00, 0x7E,
-    0x0B, 0xFB, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0xFF,
-    0xFC, 0x0F, 0xD1, 0xA0, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x03,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC1, 0x00, 0x2F, 0x0F, 0xAB, 0xF4, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3C, 0x3C, 0x00, 0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x03, 0xFF, 0xFE, 0x02,
-    0xF4, 0x02, 0x40, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBC, 0x14, 0x00, 0x7E, 0x0B, 0xFB, 0xFE, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFD, 0x00,
-    0x3C, 0x3C, 0x03, 0x80, 0x34, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0xFF, 0xFC, 0x0F, 0xD1, 0xA0,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF8,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xC1, 0x00, 0x2F, 0x0F, 0xAB, 0xF4, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x0F, 0xFF, 0xF8, 0x0B, 0xD0, 0x09, 0x03, 0xD0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x02, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xEF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x03,
-    0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x16, 0xD0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xC0, 0xFD, 0x1A, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x3C, 0x10, 0x02, 0xF0, 0xFA, 0xBF, 0x42, 0xFF, 0xF4, 0x00, 0x38, 0x00, 0x01, 0xE0, 0x00, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x01, 0x6E, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x3C, 0x00, 0x0B, 0x5F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x40, 0x0F, 0xFF, 0xF8, 0x02, 0xF4, 0x02, 0x40, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xBC, 0x05, 0x00, 0x1F, 0x80, 0xBF, 0xBF, 0xE0, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x79, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x03, 0xFF, 0xF0, 0x0F, 0xD1, 0xA0, 0x0F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xC0, 0x40, 0x0B, 0xC0, 0xFA, 0xBF, 0x40, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x17, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x54, 0x2F,
-    0xFF, 0xC0, 0x7E, 0x50, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFA, 0x80, 0x0B, 0xF8, 0x00,
-    0x34, 0x00, 0x0B, 0x40, 0x00, 0x7D, 0x00, 0x01, 0xD0, 0x01, 0x7C, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x07, 0x8F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0B, 0x40, 0x04, 0x38, 0x00, 0x72, 0xC0, 0x03, 0xC0, 0x00, 0x2F, 0x54, 0x0B, 0xFF, 0xF0,
-    0x07, 0xE5, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xFA, 0x80, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x07, 0x00, 0x00, 0xF0, 0x00, 0x2F, 0x54, 0x2F, 0xFF, 0xC0, 0x7E, 0x50, 0x03, 0xC0,
-    0x00, 0x7C, 0x00, 0x2F, 0xE9, 0x07, 0xFF, 0xD0, 0x0F, 0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02,
-    0xE0, 0x00, 0x2E, 0x00, 0x01, 0xFA, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
-    0x00, 0x00, 0xFF, 0x4B, 0x00, 0x00, 0xBA, 0xFF, 0x40, 0x00, 0x34, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0,
-    0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F,
-    0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x0F, 0xE0, 0xE0, 0x0F, 0x7F, 0xF0, 0x03, 0x41, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07,
-    0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07,
-    0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x02,
-    0xD0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0, 0x00,
-    0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x02, 0xF0, 0x02,
-    0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x40,
-    0x0B, 0x83, 0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40,
-    0x0B, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0,
-    0x7F, 0x41, 0xFE, 0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0x00, 0x00, 0xE0, 0x2C, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0,
-    0x00, 0x2D, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x01, 0xF0, 0x0F,
-    0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x3D, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x2F, 0x40, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x0E, 0x03, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x07,
-    0xC0, 0x07, 0xC2, 0xE0, 0x01, 0xE0, 0xF4, 0x00, 0xB8, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x1F, 0x07,
-    0x80, 0x0F, 0xC2, 0xE0, 0x07, 0xE0, 0xBC, 0x07, 0xF4, 0x1F, 0xEF, 0x6C, 0x02, 0xFF, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1C, 0x1C, 0x00,
-    0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0xE7, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00,
-    0x02, 0xD0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0,
-    0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x03,
-    0xD0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x02, 0xF0,
-    0x02, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xC2, 0xC0, 0x00, 0xB0, 0x70, 0x00,
-    0x0E, 0x78, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x40, 0x0B, 0x83,
-    0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40, 0x0B, 0x83,
-    0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x41,
-    0xFE, 0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC3, 0xC0, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x02, 0x81, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E,
-    0x00, 0xF0, 0x00, 0x0B, 0x40, 0x7C, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00,
-    0x7C, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x03, 0xC0, 0x2E, 0x00,
-    0x00, 0xF0, 0x0F, 0x40, 0x00, 0x7C, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x3D,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xC0, 0x00, 0x7C, 0x3C,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x28, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x03,
-    0xD0, 0x02, 0xE0, 0x0F, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x3C, 0x01, 0xF0, 0x01, 0xF0, 0x0B, 0x80,
-    0x07, 0x80, 0x3D, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0xF4, 0x07, 0xC0, 0x07, 0xC0, 0x1E, 0x00, 0x3F,
-    0x00, 0xB8, 0x01, 0xF8, 0x02, 0xF0, 0x1F, 0xD0, 0x07, 0xFB, 0xDB, 0x00, 0x0B, 0xFD, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02,
-    0xE0, 0x0F, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x07, 0xC0, 0x3C, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x02, 0xE0,
-    0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xD0, 0x02,
-    0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x07, 0x83, 0xD0, 0x02,
-    0xE0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x7C, 0x1E, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F,
-    0xD0, 0x7F, 0xBD, 0xB0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x40,
-    0x00, 0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0F, 0x00,
-    0x03, 0xD7, 0xC0, 0x02, 0xF4, 0x00, 0x7C, 0x3C, 0x00, 0x3F, 0x40, 0x0F, 0x83, 0xC0, 0x0B, 0xF4,
-    0x00, 0xF0, 0x3C, 0x00, 0xF7, 0x40, 0x2E, 0x03, 0xC0, 0x2D, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC7,
-    0x80, 0xB8, 0x03, 0xC0, 0x78, 0x78, 0x0F, 0x00, 0x3C, 0x0F, 0x07, 0x81, 0xF0, 0x03, 0xC1, 0xE0,
-    0x38, 0x3D, 0x00, 0x3C, 0x3C, 0x03, 0x87, 0xC0, 0x03, 0xC7, 0x80, 0x3C, 0xB4, 0x00, 0x3C, 0xB4,
-    0x03, 0xCF, 0x00, 0x03, 0xDF, 0x00, 0x3D, 0xE0, 0x00, 0x2E, 0xD0, 0x03, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xE1,
-    0xE0, 0x00, 0x00, 0x1D, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05,
-    0x2E, 0x00, 0xBD, 0x00, 0xB8, 0xB8, 0x03, 0xF4, 0x03, 0xC1, 0xE0, 0x1E, 0xD0, 0x2E, 0x07, 0x80,
-    0xF7, 0x80, 0xF0, 0x1E, 0x07, 0x8E, 0x07, 0xC0, 0x78, 0x3C, 0x38, 0x3D, 0x01, 0xF1, 0xE0, 0xE1,
-    0xF0, 0x07, 0xCB, 0x03, 0x8F, 0x40, 0x0F, 0x38, 0x0F, 0x3C, 0x00, 0x3E, 0xC0, 0x3E, 0xD0, 0x00,
-    0xFE, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x4F, 0x00, 0x02, 0xC0, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B,
-    0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B,
-    0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xD3, 0xC0, 0x00, 0x0B, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D,
-    0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07,
-    0x80, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x7C,
-    0x00, 0x1F, 0x03, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0xB8, 0x02, 0xE0, 0x1F, 0x00, 0x1F, 0x03, 0xD0,
-    0x00, 0xF0, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x50, 0x07, 0xFF, 0xFC, 0x00, 0x55, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07,
-    0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0xFF, 0xFF, 0x00, 0x55, 0x7D,
-    0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0xAA, 0xA0, 0x7F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x78, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x02, 0xD0, 0x00, 0xF2, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x50, 0x07, 0xFF, 0xFC, 0x00, 0x55, 0x7D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFA, 0xAA, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFB, 0x40, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00, 0x3F,
-    0xFF, 0xF4, 0xBC, 0x00, 0xFD, 0x00, 0xFE, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00,
-    0x3C, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x1A, 0x40, 0x7C, 0x01, 0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x3E, 0x00,
-    0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00,
-    0xF4, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x01, 0xF0, 0x00,
-    0x2F, 0xAF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xF2, 0xFF, 0xFC, 0x00, 0xFD,
-    0x01, 0xFF, 0x80, 0x7D, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0x3D,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x1F,
-    0x00, 0x7C, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0xF4, 0x3C, 0x00,
-    0x00, 0x3E, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0xBC, 0x01, 0xF0,
-    0x3E, 0x00, 0x00, 0xF8, 0x02, 0xE0, 0x2F, 0x00, 0x03, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x0F, 0xD0,
-    0x03, 0xC0, 0x07, 0xFE, 0xFF, 0x40, 0x07, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x29, 0x00, 0x1F, 0xFF, 0x2F, 0xFC, 0x0B, 0xE5, 0xFF,
-    0x47, 0xD1, 0xF4, 0x03, 0xD0, 0x2E, 0x3E, 0x00, 0x3D, 0x02, 0xD3, 0xC0, 0x02, 0xE0, 0x3D, 0x7C,
-    0x00, 0x3D, 0x03, 0xCB, 0x80, 0x03, 0xD0, 0x7C, 0xF4, 0x00, 0x3C, 0x0B, 0x8F, 0x40, 0x07, 0xC0,
-    0xB4, 0xB8, 0x00, 0xF4, 0x0F, 0x47, 0xC0, 0x3F, 0x00, 0xF0, 0x3F, 0xAF, 0xC0, 0x1F, 0x00, 0xBF,
-    0xE0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0xFF,
-    0xF9, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0x8F, 0x40, 0xBE, 0x3C, 0x3C, 0x00, 0xBC, 0xA1, 0xF0, 0x01,
-    0xF0, 0x07, 0xC0, 0x07, 0xC0, 0x2E, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xF8, 0x03, 0xC0, 0x1F, 0xC0,
-    0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x81, 0xA0, 0x00, 0x2D, 0x7F, 0xF0,
-    0x00, 0xFB, 0x97, 0xF0, 0x03, 0xF4, 0x03, 0xC0, 0x1F, 0x80, 0x0F, 0x00, 0xBC, 0x00, 0x3C, 0x02,
-    0xE0, 0x00, 0xF0, 0x0F, 0x40, 0x07, 0xC0, 0x3C, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0xF4, 0x0B, 0xC0,
-    0x07, 0xC0, 0x3F, 0x80, 0x7D, 0x00, 0xF7, 0xEF, 0xE0, 0x03, 0xC7, 0xFD, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2E, 0x54, 0x00, 0x0F, 0xFF,
-    0xE0, 0x03, 0xEA, 0xFF, 0x01, 0xF0, 0x03, 0xD0, 0xB8, 0x00, 0xB8, 0x3D, 0x00, 0x2E, 0x0F, 0x40,
-    0x0F, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x07, 0xE0, 0xBF, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x0F, 0x42,
-    0xE0, 0x03, 0xC0, 0x7C, 0x01, 0xF0, 0x0F, 0x40, 0xB8, 0x02, 0xE0, 0x3D, 0x00, 0x7C, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x01,
-    0xFE, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x10, 0x02, 0xFE, 0xBF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0x39, 0x1F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xC0,
-    0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x3F, 0x40, 0x02, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0x2E, 0x00, 0x10,
-    0x3F, 0xAB, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC3, 0xEF, 0x9E, 0x1E, 0x7E, 0xB8, 0xBF, 0xD0, 0x1F, 0x00, 0x3C, 0x01,
-    0xF0, 0x0B, 0x80, 0x3D, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0xB8, 0x03, 0xD0, 0x0F, 0x00, 0x7C,
-    0x02, 0xE0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x3F, 0xF0, 0x7F, 0x80, 0x00,
-    0x40, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x2F, 0x54, 0xBF, 0xFF, 0x07, 0xE5, 0x00, 0xF0, 0x00, 0x7C,
-    0x00, 0x2E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0B, 0x80,
-    0x01, 0xFA, 0x80, 0x2F, 0xE0, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x2F, 0xD0,
-    0x07, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFD, 0xF8, 0x0F, 0x40, 0x0F, 0x00, 0xF0,
-    0x00, 0xA0, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF8, 0x0B, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-    0xBD, 0x52, 0xFF, 0xFC, 0x1F, 0x94, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0F,
-    0x40, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x07, 0xEA, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x78, 0x00, 0x03, 0xC3, 0xD0, 0x2E, 0x00, 0x01, 0xF2, 0xE0,
-    0x0F, 0x40, 0x00, 0xBF, 0xE0, 0x03, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03,
-    0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF4,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x3C, 0x05, 0x00, 0x01, 0x4B, 0xC0, 0xF4, 0x00, 0xB9, 0xF0, 0x0F, 0x00, 0x0F, 0xFC, 0x00,
-    0xF0, 0x00, 0xF9, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x2D,
-    0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x00, 0xB8,
-    0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xBD, 0xB0, 0x00, 0x02, 0xFF, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x3C, 0x07, 0x40, 0x00, 0x00, 0x3D,
-    0x0F, 0x42, 0xD0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xD0, 0x3D, 0x3C, 0x28, 0x03,
-    0x40, 0x01, 0x00, 0x11, 0xFE, 0x0D, 0x3D, 0xFF, 0xC3, 0x01, 0xE0, 0x7F, 0xFD, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0x40, 0x20, 0x01, 0x38, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0,
-    0x04, 0x3D, 0x3D, 0x04, 0x00, 0x00, 0x3C, 0x2E, 0x3C, 0x2D, 0x00, 0x00, 0x15, 0x03, 0xFC, 0x02,
-    0xC0, 0x7C, 0x3E, 0x03, 0x80, 0x10, 0x00, 0x01, 0x00, 0xBF, 0x83, 0x47, 0x1C, 0x0C, 0x39, 0xF0,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x0F, 0x4B, 0x82, 0xD1, 0xD0, 0x70, 0x34, 0x00, 0x00,
-    0x00, 0x0F, 0x02, 0xC1, 0xE3, 0xC0, 0x2F, 0xC0, 0x07, 0xD0, 0x00, 0x0F, 0x1E, 0x2D, 0x3C, 0x3C,
-    0x3C, 0x24, 0x1E, 0x1E, 0x1D, 0x2D, 0x2D, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3,
-    0xE0, 0x1E, 0x0F, 0x00, 0xB0, 0x74, 0x03, 0x82, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x2F, 0x00,
-    0x86, 0x04, 0x38, 0x0F, 0x0B, 0xFF, 0x00, 0xBE, 0x00, 0x01, 0x50, 0x1F, 0xFC, 0x39, 0x6D, 0x60,
-    0x0D, 0x02, 0xC0, 0x78, 0x0F, 0x01, 0xF0, 0x3D, 0x07, 0xC0, 0x10, 0x00, 0x07, 0xC0, 0xB8, 0x0F,
-    0x02, 0xE0, 0x3C, 0x07, 0x40, 0x10, 0x00, 0x78, 0x7C, 0x7C, 0x3C, 0x3C, 0x2C, 0x04, 0x07, 0xC0,
-    0xB8, 0x0F, 0x02, 0xE0, 0x3C, 0x07, 0x40, 0x10, 0x00, 0x00, 0x1F, 0x02, 0xD0, 0x3C, 0x03, 0x40,
-    0x00, 0x00, 0x7D, 0x0F, 0x42, 0xD0, 0x74, 0x00, 0x00, 0x40, 0x0E, 0x2A, 0xD3, 0xFC, 0x02, 0xC0,
-    0x14, 0x04, 0x03, 0xC0, 0x3E, 0x93, 0xFC, 0x74, 0x05, 0x00, 0x7F, 0xFE, 0x2A, 0xAD, 0x00, 0x2C,
-    0x00, 0x2C, 0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x03, 0xD0, 0x7C, 0x0F, 0x47, 0xE0, 0xF4, 0x00,
-    0x00, 0x06, 0x07, 0x83, 0x80, 0xD0, 0x2C, 0x02, 0x00, 0x07, 0x00, 0xB0, 0x1F, 0x4F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF1, 0xBE, 0x80, 0xF0, 0x03, 0x80, 0x00, 0x00, 0x01, 0x00, 0x74, 0x2F, 0x9B, 0xFE,
-    0x0E, 0x00, 0x90, 0x15, 0x4F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xD0, 0x3C, 0x03, 0xC0,
-    0xB8, 0xFF, 0x0B, 0xD0, 0x00, 0x0B, 0x43, 0xD0, 0xF0, 0x3C, 0x1F, 0x03, 0xFC, 0x7E, 0x14, 0x7C,
-    0x7C, 0x10, 0x00, 0x00, 0x3C, 0x2D, 0x7C, 0x3D, 0x00, 0x00, 0x05, 0x03, 0xFC, 0xB0, 0xEA, 0x0A,
-    0x7A, 0xD1, 0xF4, 0x01, 0x42, 0xD0, 0xE0, 0xB0, 0x20, 0x00, 0x03, 0x40, 0x74, 0x02, 0xD0, 0x1E,
-    0x17, 0xD3, 0xF4, 0x0B, 0x0F, 0x07, 0x42, 0xD0, 0x7F, 0x01, 0x40, 0x0F, 0x1E, 0x2D, 0x3C, 0x3C,
-    0x78, 0x64, 0x3F, 0xFF, 0xE3, 0xEA, 0xAE, 0x70, 0x00, 0xDB, 0x00, 0x1C, 0x50, 0x01, 0x40, 0x10,
-    0x10, 0x11, 0xC2, 0xC2, 0xC3, 0xFF, 0xFD, 0x01, 0x41, 0x40, 0x00, 0x00, 0x0E, 0x03, 0xC1, 0xE7,
-    0xC0, 0x3F, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xF4, 0x3D, 0x3C, 0xA0, 0x0E,
-    0x20, 0x01, 0x0E, 0x03, 0x83, 0xFF, 0xC0, 0x2F, 0x80, 0x01, 0x50, 0x1F, 0xFC, 0x3D, 0x6E, 0x70,
-    0x0A, 0x01, 0x00, 0x41, 0xFE, 0x1D, 0x3A, 0xFF, 0xC7, 0x02, 0xE0, 0x7F, 0xFD, 0x7F, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x05, 0x55, 0x54, 0x2F, 0xFF, 0xFD, 0x05, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xF8, 0x2A, 0xAA, 0xA4, 0x01, 0x00, 0x41, 0xFE, 0x1D, 0x3A, 0xFF, 0xC7, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xAA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x08, 0x00, 0xBD, 0x07, 0xF4, 0x3F, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x18, 0x1E, 0x0B, 0x0E, 0x7C, 0x10, 0x34, 0x00,
-    0xA3, 0x40, 0x0E, 0x74, 0x00, 0xDB, 0xFF, 0xFC, 0x55, 0x55, 0x40, 0x05, 0x55, 0x43, 0xFF, 0xFE,
-    0x34, 0x00, 0xD7, 0x00, 0x1C, 0xBA, 0xAB, 0xCA, 0xAA, 0xA8, 0x01, 0x41, 0x42, 0xFF, 0xFE, 0x70,
-    0xB0, 0xB5, 0x01, 0x01, 0x00, 0x00, 0xB2, 0xC1, 0xFD, 0x03, 0xE0, 0x7A, 0xD0, 0x41, 0x00, 0x00,
-    0x90, 0x7D, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0x38, 0x2F, 0x02, 0x40, 0x05, 0x55, 0x54, 0x1F, 0xFF,
-    0xFE, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA4, 0x00, 0x03, 0xE0,
-    0x0F, 0x00, 0x74, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xC0, 0x38, 0x00, 0x05, 0x00,
-    0x42, 0xFD, 0x1C, 0x7A, 0xFF, 0x8A, 0x02, 0xE0, 0x14, 0x0F, 0xC0, 0xB4, 0x2C, 0x0C, 0x00, 0x00,
-    0x15, 0x00, 0x03, 0xD0, 0x3D, 0xB9, 0xE3, 0xCF, 0x2D, 0x01, 0xC0, 0x00, 0x78, 0xB4, 0xBD, 0x7D,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x2D, 0x55, 0x6D, 0x38, 0x00, 0x1C, 0x38, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x05, 0x55, 0x55, 0x1F, 0xFF, 0xFE, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xA4, 0x2D, 0x2D, 0x2D, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x00, 0x00, 0x6A, 0x7F,
-    0xF0, 0x38, 0x1D, 0x07, 0x00, 0x00, 0x00, 0x00, 0x12, 0xC1, 0x0F, 0xF4, 0xE3, 0xDF, 0xFC, 0x31,
-    0xDE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x40, 0x04, 0x0F,
-    0xF4, 0xB0, 0xBA, 0xFF, 0x43, 0x41, 0xB4, 0x00, 0x38, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x40, 0x10, 0x2F, 0xE2, 0xC0, 0xD6, 0xFD, 0x01, 0x00, 0x40, 0x0B, 0x80, 0x90, 0xBB, 0xFF,
-    0x03, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0x1F, 0xAF, 0x83, 0xFF, 0xFC, 0x0A, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0xF4, 0xB0, 0x3C, 0x0E, 0x00, 0xFF, 0x03, 0xFC, 0x0F, 0xFE,
-    0x90, 0x1A, 0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15, 0x05,
-    0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47, 0xD2,
-    0x00, 0x00, 0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00, 0x01,
-    0x80, 0x00, 0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x80, 0x2E, 0x41, 0xF1,
-    0xFC, 0xE0, 0x00, 0x00, 0x09, 0x3C, 0xB0, 0xE0, 0x74, 0x14, 0x00, 0x00, 0x0B, 0xF8, 0x2F, 0xBD,
-    0x34, 0x0B, 0x12, 0xC0, 0x03, 0xD0, 0x02, 0x80, 0x00, 0x1C, 0xD7, 0xF4, 0xFC, 0xBB, 0x84, 0x40,
-    0x02, 0x5F, 0xCB, 0x81, 0xBC, 0x02, 0x40, 0x34, 0x0B, 0xE0, 0x7C, 0xBE, 0x34, 0x00, 0xD0, 0x0A,
-    0x07, 0xE0, 0xF4, 0x0F, 0x5F, 0x87, 0xE3, 0x9C, 0xD0, 0x70, 0xD0, 0x08, 0x0E, 0x07, 0x0B, 0x3D,
-    0x10, 0x04, 0x3D, 0x3D, 0x04, 0x00, 0x00, 0xB0, 0x3B, 0xD2, 0xF9, 0x2F, 0xC1, 0x98, 0x00, 0x01,
-    0x03, 0xFE, 0xFD, 0x70, 0xF0, 0xBA, 0x0B, 0x07, 0x75, 0xF5, 0xE2, 0xF9, 0xF8, 0x20, 0x1C, 0x0B,
-    0xF9, 0x5D, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0x1F, 0x40, 0xFD,
-    0x00, 0x07, 0xF4, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0xB4, 0x00, 0x00,
-    0x01, 0xE3, 0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x90, 0x01, 0xBE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00,
-    0x1A, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFC, 0x00, 0x54, 0x00, 0x00, 0x10, 0x7F, 0xFF, 0x90, 0x02, 0xC3, 0xD5, 0x6F, 0xFF, 0xFD,
-    0x28, 0x00, 0x01, 0xAF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xE5, 0x5B, 0xF4, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x40, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0xAA, 0xAA, 0xAA, 0xBE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x94, 0xA0, 0xC3, 0x03, 0x0C, 0x28, 0x31, 0xD0, 0x65, 0x00, 0x1F, 0x8C, 0x3A, 0xB7, 0x40, 0xA1,
-    0x06, 0x40, 0x0C, 0x00, 0x14, 0x24, 0x30, 0x30, 0x60, 0x40, 0x0B, 0xD0, 0x90, 0xC3, 0x03, 0x0C,
-    0x0C, 0x34, 0xD0, 0x28, 0x00, 0x18, 0x24, 0x90, 0xC3, 0x03, 0x0C, 0x28, 0x31, 0xD0, 0x61, 0x00,
-    0x0A, 0x83, 0x00, 0x60, 0x09, 0x00, 0x70, 0x01, 0x90, 0x00, 0x00, 0x00, 0x30, 0x01, 0x82, 0xE9,
-    0x28, 0x30, 0xC0, 0xC3, 0x0A, 0x0C, 0x74, 0x18, 0x40, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x06, 0xB8,
-    0x2C, 0x30, 0xD0, 0xC3, 0x06, 0x08, 0x24, 0x10, 0x40, 0x09, 0xB2, 0xD0, 0xC3, 0x86, 0x18, 0x30,
-    0x62, 0x43, 0x09, 0x30, 0x60, 0xC1, 0x04, 0x04, 0x1A, 0x82, 0xC0, 0x34, 0x03, 0x00, 0x20, 0x01,
-    0x00, 0x00, 0x14, 0x79, 0x30, 0x60, 0x90, 0xD0, 0x24, 0x50, 0x96, 0x1C, 0x63, 0x02, 0x60, 0x3C,
-    0x01, 0x40, 0x08, 0x20, 0x27, 0x00, 0x74, 0x02, 0xD0, 0x24, 0xC0, 0x41, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0xF8, 0x07, 0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40,
-    0x03, 0xD0, 0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01,
-    0xF0, 0x00, 0xFF, 0xF9, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xE0, 0x0B, 0xD0, 0x3D, 0x00, 0x3E, 0x03,
-    0xC0, 0x02, 0xE0, 0x7C, 0x00, 0x3E, 0x0B, 0x80, 0x07, 0xC0, 0xF9, 0x56, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x00, 0xFA, 0xAF, 0xC0, 0x1F, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0xF4, 0x3D, 0x00, 0x0F, 0x83, 0xC0,
-    0x00, 0xF4, 0x3C, 0x00, 0x1F, 0x07, 0xC0, 0x07, 0xE0, 0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xF9, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7D, 0xE0, 0x00, 0x00, 0xF5, 0xE0, 0x00,
-    0x01, 0xE0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x0F, 0x00, 0xF4, 0x00,
-    0x2D, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF4, 0x00, 0x78, 0x01, 0xF0, 0x00, 0x3C, 0x03,
-    0xD0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x3D, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F, 0xFF, 0xF8,
-    0x03, 0xEA, 0xA9, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x2E,
-    0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x07, 0xC0, 0x2E, 0x55, 0x56, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xEA, 0xAA, 0xBC,
-    0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0x00,
-    0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00,
-    0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x4F, 0xFF, 0xC3, 0xC3, 0xD3, 0xFF,
-    0xF1, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78,
-    0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D,
-    0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x01, 0xE0,
-    0x02, 0xF0, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x2F, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x07, 0xC2,
-    0xF0, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xEF,
-    0x00, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x02,
-    0xF0, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E,
-    0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8,
-    0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF8, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0x3D, 0x00, 0x3C, 0x01,
-    0xF0, 0x00, 0xF0, 0x0F, 0x40, 0x03, 0xD0, 0xBC, 0x00, 0x0B, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00,
-    0x00, 0xB8, 0xF4, 0x00, 0x01, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0xC0, 0x2F, 0xC0, 0x00, 0x2F, 0xE0, 0x0F, 0xB4, 0x00, 0x0F, 0xB4, 0x03, 0xDD, 0x00, 0x0B, 0x7C,
-    0x01, 0xE7, 0x80, 0x03, 0xCF, 0x00, 0xB8, 0xE0, 0x03, 0xD7, 0xC0, 0x3D, 0x3C, 0x01, 0xE2, 0xE0,
-    0x0F, 0x0F, 0x00, 0xF0, 0xF4, 0x03, 0xC3, 0xC0, 0x78, 0x3C, 0x01, 0xE0, 0xB0, 0x3C, 0x1F, 0x00,
-    0xB4, 0x2D, 0x2E, 0x07, 0xC0, 0x3D, 0x07, 0x4F, 0x02, 0xE0, 0x0F, 0x01, 0xEB, 0x40, 0xF4, 0x07,
-    0xC0, 0x7F, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0xD0, 0x1F, 0x00, 0xB4, 0x03, 0xF0, 0x0B, 0x80, 0x3C,
-    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x07, 0x80, 0xBE, 0x00, 0x02, 0xE0, 0x2F, 0xC0,
-    0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x03, 0xDF, 0x00, 0x1F, 0x01, 0xE3, 0xC0, 0x07, 0x80, 0xB8,
-    0xB8, 0x02, 0xD0, 0x3D, 0x1F, 0x00, 0xF4, 0x0F, 0x03, 0xD0, 0x3C, 0x03, 0xC0, 0xB8, 0x1F, 0x01,
-    0xE0, 0x0F, 0x0B, 0x80, 0xB4, 0x03, 0xD2, 0xD0, 0x3D, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x0F, 0x3C,
-    0x07, 0xC0, 0x02, 0xEF, 0x01, 0xE0, 0x00, 0x7F, 0x80, 0xB4, 0x00, 0x0F, 0xD0, 0x3C, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x6A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F,
-    0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2E, 0x00, 0x02, 0xE0, 0x0F, 0x40, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x2D, 0x00, 0x02,
-    0xE0, 0x0F, 0x40, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0xB8, 0x00,
-    0x0B, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x3C, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xF0, 0x02, 0xE0, 0x1F, 0x80, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xC0, 0x7C, 0x00,
-    0x3C, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF8, 0x0F, 0x40, 0x7F, 0x00, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0x90, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00,
-    0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01,
-    0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0xFF, 0xEF, 0xFF,
-    0xE0, 0x03, 0xF4, 0x0F, 0x02, 0xF8, 0x0F, 0x80, 0x1F, 0x00, 0x7C, 0x2F, 0x00, 0x2E, 0x00, 0x3D,
-    0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x3C, 0x00, 0x3C, 0x00, 0x3D, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x7C,
-    0x00, 0x7C, 0x00, 0xBC, 0x3C, 0x00, 0xB8, 0x00, 0xF4, 0x3F, 0x00, 0xF4, 0x03, 0xE0, 0x1F, 0xE5,
-    0xF0, 0x6F, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x6B, 0xFA, 0x40, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0x82, 0xF0, 0x00, 0x00, 0x3C,
-    0x7C, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xF2, 0xD0, 0x00, 0x00, 0x3D, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x2E, 0x00, 0xF4,
-    0x03, 0xD0, 0xF4, 0x03, 0xD0, 0x0F, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x1F, 0x00, 0x7C, 0x02, 0xE0,
-    0xB8, 0x02, 0xE0, 0x0F, 0x43, 0xE0, 0x0F, 0x40, 0x3C, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x3D, 0x01,
-    0xF0, 0x0F, 0x80, 0xF8, 0x0B, 0xC0, 0x7C, 0x01, 0xF4, 0x2E, 0x07, 0xD0, 0x03, 0xFE, 0xFE, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x02, 0xF8,
-    0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x2E, 0x00, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x7C, 0x00,
-    0x00, 0x3E, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0xF4, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00,
-    0x3D, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x07, 0xD0, 0x07, 0xFF, 0xC0, 0xFF, 0xF4, 0xBF,
-    0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x2A, 0x01, 0x40, 0xBF, 0xF4, 0xD0, 0xBE, 0x1F, 0xB4, 0x7D, 0x00,
-    0xFC, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x0B, 0x8B, 0xC0, 0x03, 0xD2, 0xE0, 0x00, 0xF0, 0xF4, 0x00,
-    0x7C, 0x3D, 0x00, 0x3F, 0x0F, 0x40, 0x2F, 0x82, 0xF0, 0x1F, 0xD0, 0x7F, 0xBD, 0xBD, 0x07, 0xFD,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0B, 0xFB,
-    0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xF0, 0xFF, 0x80, 0x01, 0xF1, 0xFE,
-    0x00, 0x01, 0xE0, 0x07, 0xC0, 0x02, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x01, 0xF0, 0x03, 0xC0, 0x00,
-    0xF0, 0x07, 0xC0, 0x01, 0xF0, 0x0B, 0x80, 0x02, 0xE0, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0xFA, 0xBF,
-    0x40, 0x0F, 0x2F, 0xFD, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x50, 0x00, 0x16,
-    0xD0, 0x01, 0xFB, 0x80, 0x0B, 0xAE, 0x00, 0x3D, 0x78, 0x00, 0xF1, 0xE0, 0x07, 0xC3, 0xC0, 0x2D,
-    0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x40, 0xF0, 0x7C, 0x03, 0xC3, 0xC0, 0x0F, 0x3C, 0x00, 0x2F, 0xD0,
-    0x00, 0xBD, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xAF, 0xC0, 0x0B,
-    0x80, 0x14, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x6F, 0xD0, 0x00, 0x3F, 0x5F, 0x40, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x03, 0xD0, 0x7C, 0x00,
-    0x2E, 0x0B, 0x80, 0x02, 0xE0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF8, 0x00, 0x7C, 0x0B,
-    0xC0, 0x1F, 0x40, 0x3F, 0xAF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x07, 0xFF, 0xE0, 0x3E, 0x46, 0x42, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0xF0, 0x01, 0xFF, 0x80, 0x2F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3F,
-    0xAB, 0xC0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0xAA, 0xAB, 0xD0, 0x00,
-    0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x02,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xA9, 0x00, 0x2D, 0x7F,
-    0xF4, 0x03, 0xEE, 0x5F, 0xC0, 0x3F, 0x80, 0x7C, 0x07, 0xE0, 0x07, 0xC0, 0xBC, 0x00, 0x7C, 0x0F,
-    0x80, 0x0B, 0x80, 0xF4, 0x00, 0xF8, 0x0F, 0x00, 0x0F, 0x41, 0xF0, 0x01, 0xF0, 0x2E, 0x00, 0x2F,
-    0x03, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xEF, 0xD0, 0x0B, 0xC0, 0xBC, 0x07, 0xC0, 0x0F,
-    0x03, 0xD0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0xB8, 0x00, 0x3C, 0x3D, 0x00, 0x0F, 0x0F, 0xAA, 0xAF,
-    0xC7, 0xFF, 0xFF, 0xE1, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x3C, 0x3D, 0x00, 0x1F, 0x0F, 0x40, 0x0B,
-    0x83, 0xD0, 0x03, 0xC0, 0xB4, 0x02, 0xE0, 0x2F, 0x01, 0xF0, 0x03, 0xFB, 0xF4, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xF4, 0x0F, 0x00, 0xF0, 0x1F, 0x02, 0xE0, 0x3D, 0x03,
-    0xC0, 0x7C, 0x07, 0x80, 0xB8, 0x0F, 0x80, 0xBE, 0x93, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40,
-    0x2E, 0x01, 0xF4, 0x03, 0xD0, 0x7D, 0x00, 0x3C, 0x1F, 0x40, 0x07, 0xC7, 0xD0, 0x00, 0xB9, 0xF4,
-    0x00, 0x0B, 0xBE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0x8F, 0x40, 0x01, 0xF0, 0x7C, 0x00, 0x2E,
-    0x03, 0xD0, 0x03, 0xD0, 0x2F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x2B, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xDB,
-    0x40, 0x00, 0xF2, 0xE0, 0x00, 0xB4, 0x78, 0x00, 0x7C, 0x1F, 0x00, 0x3D, 0x03, 0xC0, 0x1F, 0x00,
-    0xF0, 0x0F, 0x40, 0x3D, 0x0B, 0x80, 0x0B, 0x83, 0xC0, 0x02, 0xFA, 0xE0, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x02, 0xE0, 0x01, 0xE0, 0x0F, 0x40, 0x0B, 0x80, 0x3C, 0x00,
-    0x3D, 0x01, 0xF0, 0x00, 0xF0, 0x07, 0x80, 0x07, 0xC0, 0x2E, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0xF4,
-    0x03, 0xC0, 0x03, 0xC0, 0x1F, 0x00, 0x2F, 0x00, 0xBC, 0x01, 0xFC, 0x03, 0xF0, 0x1F, 0xE0, 0x0F,
-    0xFB, 0xE7, 0xE0, 0x3E, 0xFE, 0x0F, 0xC1, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x50, 0x00, 0x16,
-    0xD0, 0x01, 0xFB, 0x80, 0x0B, 0xAE, 0x00, 0x3D, 0x78, 0x00, 0xF1, 0xE0, 0x07, 0xC3, 0xC0, 0x2D,
-    0x0F, 0x00, 0xF0, 0x3C, 0x0B, 0x40, 0xF0, 0x7C, 0x03, 0xC3, 0xC0, 0x0F, 0x3C, 0x00, 0x2F, 0xD0,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x0A, 0xFF, 0xA8, 0x00, 0x2D, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01,
-    0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00,
-    0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0,
-    0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x56, 0xFF, 0xFF, 0xFF,
-    0xE5, 0xBD, 0x56, 0xF5, 0x01, 0xF0, 0x0B, 0x80, 0x0B, 0x80, 0x3D, 0x00, 0x3D, 0x00, 0xF4, 0x00,
-    0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x1F, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0xB4, 0x03, 0xD0, 0x03, 0xD0,
-    0x0F, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xFA, 0x02, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3E, 0x5B, 0xC0, 0x0F, 0x80, 0x3D,
-    0x00, 0xF0, 0x02, 0xE0, 0x1F, 0x00, 0x2E, 0x02, 0xD0, 0x02, 0xE0, 0x3D, 0x00, 0x3D, 0x03, 0xC0,
-    0x03, 0xD0, 0x7C, 0x00, 0x7C, 0x0B, 0x80, 0x0F, 0x80, 0xFC, 0x02, 0xF0, 0x0F, 0xFA, 0xFD, 0x00,
-    0xF2, 0xFF, 0x40, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x07, 0xFF, 0xD0, 0x7E, 0x46,
-    0x03, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x06,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x50, 0x1F, 0xFF, 0xFE, 0x0B, 0xF9, 0xBD, 0x41, 0xF4, 0x03, 0xD0, 0x3E, 0x00, 0x2E,
-    0x07, 0xC0, 0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x0B, 0x80, 0x01, 0xF0, 0xF8, 0x00, 0x2E, 0x0B, 0x80,
-    0x03, 0xD0, 0xBC, 0x00, 0x7C, 0x07, 0xD0, 0x1F, 0x40, 0x2F, 0xAF, 0xD0, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x52, 0xFF, 0xFF, 0xD5, 0x6F, 0x55, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xE9, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x05, 0x03, 0xD0, 0x03, 0xD0, 0xF0, 0x00, 0xB4, 0x3C, 0x00, 0x2D, 0x1F, 0x00, 0x0F, 0x4B, 0x80,
-    0x03, 0xD3, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x7C, 0x7C, 0x00, 0x2E, 0x1F, 0x00, 0x0F, 0x4B, 0x80,
-    0x0B, 0xC1, 0xF0, 0x0B, 0xC0, 0x3F, 0xAF, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x1A, 0x40, 0x03, 0xD0, 0xBF, 0xF0, 0x0F, 0xC1, 0xF5, 0xF8, 0x1F, 0x03, 0xD0, 0x7C, 0x3D,
-    0x03, 0xC0, 0x3C, 0x7C, 0x07, 0xC0, 0x3C, 0xB8, 0x0B, 0x80, 0x7C, 0xB8, 0x0B, 0x40, 0xB8, 0xB4,
-    0x0F, 0x00, 0xF4, 0xB8, 0x0F, 0x01, 0xF0, 0x7C, 0x1F, 0x03, 0xE0, 0x3D, 0x2E, 0x1F, 0xC0, 0x1F,
-    0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x03, 0xC0, 0x00, 0x7C, 0x03, 0xD0,
-    0x00, 0x0F, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0x1F, 0x78,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0x6E, 0x00, 0x00, 0x07, 0x87, 0xC0, 0x00, 0x03,
-    0xC0, 0xF0, 0x00, 0x02, 0xD0, 0x3D, 0x00, 0x01, 0xF0, 0x0B, 0x80, 0x00, 0xF0, 0x01, 0xFF, 0x00,
-    0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x05, 0x00, 0xF4, 0x14, 0x0F, 0x40, 0xF0, 0x2D,
-    0x0F, 0x00, 0xF0, 0x2E, 0x0F, 0x01, 0xE0, 0x2E, 0x1F, 0x02, 0xE0, 0x2D, 0x2E, 0x03, 0xD0, 0x3D,
-    0x3D, 0x03, 0xC0, 0x3C, 0x3C, 0x07, 0xC0, 0x3C, 0x3C, 0x07, 0x80, 0xB8, 0x7C, 0x0B, 0x40, 0xF4,
-    0x7C, 0x0F, 0x02, 0xE0, 0x3E, 0x0F, 0x0B, 0xC0, 0x2F, 0xEF, 0xBF, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x2E, 0x00, 0x00,
-    0x7C, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x03, 0xD3, 0xD0,
-    0x0B, 0x40, 0x3D, 0x3C, 0x00, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x00, 0x3D, 0x7C, 0x01, 0xF0, 0x03,
-    0xC7, 0x80, 0x2E, 0x00, 0x7C, 0x7C, 0x03, 0xE0, 0x0F, 0x43, 0xC0, 0x7F, 0x01, 0xF0, 0x3F, 0xBE,
-    0xBE, 0xFC, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x0B, 0x8F, 0x40, 0x00, 0x3C, 0x2D, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0xF8,
-    0x07, 0xC0, 0x07, 0xEA, 0xAF, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xF5, 0x55, 0xF0, 0x0F, 0x40, 0x03,
-    0xD0, 0xBC, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D, 0x00, 0xFC,
-    0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x7C,
-    0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07, 0xFD, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x02,
-    0xE3, 0xD0, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0xB8, 0x2E, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x3E, 0x01,
-    0xF0, 0x01, 0xFA, 0xAB, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7D, 0x55, 0x7C, 0x03, 0xD0, 0x00, 0xF4,
-    0x2F, 0x00, 0x03, 0xD0, 0xF4, 0x00, 0x0B, 0x8B, 0xC0, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x68, 0x05, 0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0,
-    0xF4, 0x03, 0xF0, 0xBC, 0x00, 0xBC, 0x3D, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2,
-    0xE0, 0x01, 0xF0, 0xF4, 0x00, 0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0,
-    0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x7E, 0x38, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x00,
-    0x00, 0x02, 0xE3, 0xD0, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xFA, 0xAB, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x7D, 0x55, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0x0B, 0x80, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x02, 0x92, 0xD0, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0x3D,
-    0x78, 0x00, 0x00, 0xA0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x40, 0x01, 0xFF,
-    0xD7, 0x80, 0x07, 0xE5, 0xBF, 0x40, 0x0F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x3D, 0x00,
-    0x2E, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0xFC, 0x00, 0xB8, 0x01, 0xF8, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x3F, 0xBD, 0xB0, 0x00, 0x1F, 0xF4,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01,
-    0xC7, 0xE0, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B,
-    0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40,
-    0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x05, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x2C, 0x29, 0x00, 0x01, 0x3F, 0xC0, 0x00, 0x3D, 0x78, 0x00, 0x28, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x05, 0x01, 0xFF, 0xD7, 0x81, 0xF9, 0x6F, 0xD0, 0xF4, 0x03, 0xF0, 0xBC, 0x00,
-    0xBC, 0x3D, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x03, 0xD2, 0xE0, 0x01, 0xF0, 0xF4, 0x00,
-    0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x40, 0xFE, 0xF6, 0xC0, 0x1F, 0xF4, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x01, 0xF8, 0xD0, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00,
-    0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x00, 0x0B, 0x8F, 0x40, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x02, 0xE0, 0xB8, 0x00, 0x00, 0x1F,
-    0x01, 0xE0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xEA, 0xAF, 0x00, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x01, 0xF5, 0x55, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x03,
-    0xD0, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0xA4, 0xF4, 0x00, 0x0F, 0xF1,
-    0x00, 0x00, 0xF5, 0xE0, 0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x40,
-    0x07, 0xFF, 0x5E, 0x00, 0x7E, 0x5B, 0xF4, 0x03, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0xF4,
-    0x00, 0xB8, 0x07, 0xC0, 0x02, 0xE0, 0x2E, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0x7C, 0x03, 0xD0, 0x03,
-    0xF0, 0x0B, 0x80, 0x1F, 0x80, 0x2F, 0x01, 0xFD, 0x00, 0x3F, 0xBD, 0xB0, 0x00, 0x7F, 0xD3, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x80, 0x00, 0x03, 0xFE, 0x78, 0x00, 0x00,
-    0x70, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xEF, 0x00,
-    0x00, 0x00, 0x74, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBB, 0xC0, 0x00,
-    0x00, 0x0F, 0x3C, 0x00, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x00, 0x3C, 0x2D, 0x00, 0x00, 0x0B, 0x82,
-    0xE0, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x07, 0xEA, 0xAF, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x55, 0x5F, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x0F,
-    0x40, 0x0F, 0x40, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF9, 0x1C, 0x00, 0x3A, 0xFF, 0x40, 0x06, 0x01, 0x90, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x0A, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x14, 0x01, 0xFF, 0xD7, 0x80, 0x7E, 0x5B, 0xF4, 0x0F, 0x40, 0x3F, 0x02, 0xF0, 0x02, 0xF0,
-    0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xE0, 0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00,
-    0xFC, 0x0B, 0x80, 0x1F, 0x80, 0xBC, 0x07, 0xF4, 0x03, 0xFB, 0xDB, 0x00, 0x1F, 0xF4, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x7C, 0x38, 0x00, 0x00, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03,
-    0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xF0, 0xF0, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x07, 0xFF,
-    0x5E, 0x07, 0xE5, 0xBF, 0x43, 0xD0, 0x0F, 0xC2, 0xF0, 0x02, 0xF0, 0xF4, 0x00, 0xB8, 0x7C, 0x00,
-    0x2E, 0x2E, 0x00, 0x0F, 0x4B, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xF8, 0x2F, 0x01,
-    0xFD, 0x03, 0xFB, 0xDB, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x60, 0x0A, 0x00, 0x00, 0x79, 0x7C, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3,
-    0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01,
-    0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00,
-    0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x42, 0x04, 0x00, 0x74,
-    0x0E, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x40, 0x7F,
-    0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D, 0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0,
-    0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0,
-    0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x60, 0x0A, 0x00, 0x00, 0x79, 0x7C,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0,
-    0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0,
-    0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x42,
-    0x04, 0x00, 0x74, 0x0E, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D, 0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40,
-    0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8, 0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80,
-    0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x61, 0x0A, 0x00, 0x00, 0x79, 0x7C, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xBB, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x0B, 0x82, 0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F,
-    0x40, 0x00, 0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x4A, 0x04, 0x00, 0x74, 0x0E, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x40, 0x7F, 0xF5, 0xE0, 0x7E, 0x5B, 0xF4, 0x3D,
-    0x00, 0xFC, 0x2F, 0x00, 0x2F, 0x0F, 0x40, 0x0B, 0x87, 0xC0, 0x02, 0xE2, 0xE0, 0x00, 0xF4, 0xB8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0x82, 0xF0, 0x1F, 0xD0, 0x3F, 0xBD, 0xB0, 0x07,
-    0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x40, 0x00, 0x0F, 0xF9, 0xE0, 0x00,
-    0x0B, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0A, 0x00, 0x00, 0x1E, 0x5B, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x00, 0x3C,
-    0xF0, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x0B, 0x82, 0xE0, 0x00, 0x07,
-    0xC0, 0x78, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x01, 0xFA, 0xAB, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7D, 0x55, 0x7C, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0xB8,
-    0x0B, 0xC0, 0x00, 0x2E, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x2C,
-    0x00, 0x7A, 0xFF, 0x40, 0x05, 0x01, 0x90, 0x00, 0x10, 0x01, 0x00, 0x07, 0x40, 0xE0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x14, 0x01, 0xFF, 0xD7, 0x80,
-    0x7E, 0x5B, 0xF4, 0x0F, 0x40, 0x3F, 0x02, 0xF0, 0x02, 0xF0, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x02,
-    0xE0, 0xB8, 0x00, 0x3D, 0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xFC, 0x0B, 0x80, 0x1F, 0x80, 0xBC,
-    0x07, 0xF4, 0x03, 0xFB, 0xDB, 0x00, 0x1F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x05, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBB,
-    0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x0B, 0x82,
-    0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x7E, 0xAA, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x01, 0xF5, 0x55, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x40, 0x00,
-    0xB8, 0x2F, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x05,
-    0x00, 0x0D, 0x07, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,
-    0x50, 0x1F, 0xFD, 0x78, 0x1F, 0x96, 0xFD, 0x0F, 0x40, 0x3F, 0x0B, 0xC0, 0x0B, 0xC3, 0xD0, 0x02,
-    0xE1, 0xF0, 0x00, 0xB8, 0xB8, 0x00, 0x3D, 0x2E, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0xC2, 0xE0, 0x07,
-    0xE0, 0xBC, 0x07, 0xF4, 0x0F, 0xEF, 0x6C, 0x01, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xE0, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x3E, 0x55, 0x40, 0x0F, 0xFF, 0xF8, 0x03, 0xEA, 0xA9, 0x01, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x07, 0xFF, 0xC0, 0x7E, 0x1F, 0x83, 0xD0,
-    0x1E, 0x2E, 0x00, 0xB8, 0xF0, 0x0B, 0xC7, 0xEB, 0xFD, 0x2F, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0xD0,
-    0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x10, 0x3F, 0xAB, 0xC0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0xAF, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xE4, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xE0, 0x0F,
-    0xAA, 0xA4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x01, 0xFF, 0xF0, 0x1F, 0x87, 0xE0, 0xF4, 0x07, 0x8B, 0x80, 0x2E, 0x3C, 0x02,
-    0xF1, 0xFA, 0xFF, 0x4B, 0xFF, 0xE0, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0,
-    0x04, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x02, 0xFD,
-    0x1C, 0x00, 0x3A, 0xFF, 0x80, 0x06, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xAA, 0xA4, 0x01, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x3F,
-    0xD2, 0xC0, 0x2E, 0xBF, 0xD0, 0x0D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F,
-    0xFF, 0x00, 0x1F, 0x87, 0xE0, 0x0F, 0x40, 0x78, 0x0B, 0x80, 0x2E, 0x03, 0xC0, 0x2F, 0x01, 0xFA,
-    0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C,
-    0x00, 0x40, 0x0F, 0xEA, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0xF5, 0xD0, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0x2D, 0x0E, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80,
-    0x02, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x0F, 0x95, 0x50, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xAA, 0xA4, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x68, 0x78, 0x00, 0x0B, 0xF5, 0x40, 0x00,
-    0xB8, 0xF0, 0x00, 0x06, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0xF4, 0x07, 0x80, 0x0B, 0x80, 0x2E, 0x00, 0x3C, 0x02, 0xF0,
-    0x01, 0xFA, 0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x07, 0xC0, 0x04, 0x00, 0x0F, 0xEA, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x2F, 0x40, 0x00, 0x2E, 0xF0,
-    0x00, 0x2D, 0x0E, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-    0x80, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xAA, 0xA4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x68, 0x00, 0x5B, 0xF4,
-    0x00, 0xB8, 0xF0, 0x06, 0x00, 0x90, 0x00, 0x00, 0x00, 0x06, 0x90, 0x01, 0xFF, 0xF0, 0x1F, 0x87,
-    0xE0, 0xF4, 0x07, 0x8B, 0x80, 0x2E, 0x3C, 0x02, 0xF1, 0xFA, 0xFF, 0x4B, 0xFF, 0xE0, 0x3E, 0x00,
-    0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x04, 0x0F, 0xEA, 0xF0, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0x80, 0x00, 0xBD,
-    0x30, 0x00, 0x0B, 0xBC, 0x00, 0x00, 0xB4, 0x38, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xE5, 0x54, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x3E, 0xAA, 0x90, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0xD0, 0x00,
-    0x68, 0xB4, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0x8F, 0x00, 0x01, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0xF4, 0x07, 0x80, 0x2E, 0x00,
-    0xB8, 0x03, 0xC0, 0x2F, 0x00, 0x7E, 0xBF, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x04, 0x00, 0x3F, 0xAB, 0xC0, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x00, 0xFF, 0x9E, 0x00, 0x2C, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x2D, 0x0E, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x95, 0x50,
-    0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xAA, 0xA4, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xD0, 0x0F, 0xBF, 0xF0, 0x02, 0x01,
-    0x90, 0x00, 0x06, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0x8F, 0x00, 0x06, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x87, 0xE0, 0x0F, 0x40, 0x78, 0x0B, 0x80,
-    0x2E, 0x03, 0xC0, 0x2F, 0x01, 0xFA, 0xFF, 0x40, 0xBF, 0xFE, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x40, 0x0F, 0xEA, 0xF0, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x78, 0x78, 0x00,
-    0x74, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xE5, 0x54, 0x00,
-    0xFF, 0xFF, 0x80, 0x3E, 0xAA, 0x90, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xFE, 0x00, 0x2D, 0x3C, 0x02, 0xC0, 0x28, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x00, 0x7F, 0xFC, 0x07, 0xE1, 0xF8, 0x3D, 0x01, 0xE2, 0xE0, 0x0B, 0x8F,
-    0x00, 0xBC, 0x7E, 0xBF, 0xD2, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00, 0x01,
-    0xF0, 0x01, 0x03, 0xFA, 0xBC, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x1B, 0xE0, 0x00, 0x03, 0xC0, 0x00,
-    0x2E, 0x00, 0x03, 0xD0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x7F, 0xE0, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x1E, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x3C, 0x00, 0x06, 0xF9, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x3F, 0xC0,
-    0x00, 0x74, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x40, 0x02, 0xE0, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x02, 0xE0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x01, 0xFF,
-    0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x1B, 0xE4, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2E, 0x00,
-    0x3E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x01,
-    0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00,
-    0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00,
-    0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F,
-    0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8,
-    0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x02, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00,
-    0x06, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00,
-    0x0F, 0x07, 0xC0, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x3D, 0x00,
-    0x00, 0x1F, 0x0F, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x01, 0xF4, 0x3E,
-    0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xFB, 0xFD, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0xB4, 0x00, 0x07, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F,
-    0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C,
-    0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x01, 0xD0,
-    0xF0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0x0F, 0x03, 0xD0,
-    0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x3C, 0x00, 0x00, 0x3E,
-    0x03, 0xD0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x68, 0x3C, 0x00, 0x07, 0xF9, 0x40, 0x00,
-    0x78, 0xB0, 0x00, 0x07, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x01, 0xFF,
-    0xF4, 0x00, 0x2F, 0x96, 0xF0, 0x01, 0xF4, 0x03, 0xE0, 0x0F, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x1F,
-    0x01, 0xF0, 0x00, 0x7C, 0x0B, 0x80, 0x02, 0xE0, 0x3D, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x3C, 0x02,
-    0xE0, 0x02, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x0B, 0xEB, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x71, 0xF8, 0x00,
-    0x00, 0x01, 0xEF, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x03, 0xC2, 0xE0,
-    0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x1F, 0x0F, 0x00, 0x00, 0x0B, 0xC3,
-    0xC0, 0x00, 0x03, 0xE0, 0xF4, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0xFC, 0x00, 0xBD, 0x00, 0x1F, 0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x46, 0x80, 0x00, 0x5F, 0xE0, 0x00, 0x78,
-    0xB0, 0x01, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC,
-    0x1F, 0x40, 0x3E, 0x3E, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4,
-    0x00, 0x3E, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x01, 0xF8, 0xD0, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x00, 0x1D, 0x0F, 0x00, 0x00,
-    0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0xF4,
-    0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x3D, 0x00, 0x00, 0x0F,
-    0x03, 0xD0, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x3D, 0x00,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0xBD, 0x00,
-    0x07, 0xFE, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x68, 0x78, 0x00, 0x1F, 0xE0, 0x00,
-    0x07, 0x8B, 0x00, 0x01, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x1F, 0xFF,
-    0x40, 0x0B, 0xE5, 0xBC, 0x01, 0xF4, 0x03, 0xE0, 0x3E, 0x00, 0x1F, 0x03, 0xC0, 0x01, 0xF0, 0x7C,
-    0x00, 0x1F, 0x0B, 0x80, 0x02, 0xE0, 0xF4, 0x00, 0x3E, 0x0F, 0x40, 0x03, 0xC0, 0xB8, 0x00, 0xB8,
-    0x07, 0xC0, 0x1F, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x02, 0x00, 0x00, 0x3F, 0xE7, 0x80, 0x00, 0x1C, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1E, 0xF0, 0x00, 0x00, 0x1D, 0x0F, 0x00, 0x00, 0x04, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xF4,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0xF0, 0x7C,
-    0x00, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x01, 0xF0,
-    0xF0, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0xE0, 0x0B, 0xAF, 0xF0,
-    0x02, 0x00, 0xA0, 0x00, 0x06, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x07, 0x8B, 0x00, 0x07, 0x40, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x1F, 0xFF, 0x40, 0x2F, 0x96, 0xF0, 0x1F, 0x40, 0x3E,
-    0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x01, 0xF1, 0xF0, 0x00, 0x7C, 0xB8, 0x00, 0x2E, 0x3D, 0x00, 0x0F,
-    0x8F, 0x40, 0x03, 0xC2, 0xE0, 0x02, 0xE0, 0x7C, 0x01, 0xF0, 0x0B, 0xEB, 0xF4, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x07, 0xC3, 0x80, 0x00, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x03, 0xC3,
-    0xD0, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x0F,
-    0x83, 0xD0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x7F, 0xEF, 0xF4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0xB8, 0xB4, 0x01, 0xD0, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xFF, 0xF4, 0x0B, 0xE5, 0xBC, 0x1F, 0x40, 0x3E, 0x3E, 0x00,
-    0x1F, 0x3C, 0x00, 0x1F, 0x7C, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xF4, 0x00, 0x3E, 0xF4, 0x00, 0x3C,
-    0xB8, 0x00, 0xB8, 0x7C, 0x01, 0xF0, 0x2F, 0xAF, 0xD0, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00, 0x3F,
-    0xFF, 0xF4, 0xBC, 0x00, 0xFD, 0x00, 0xFE, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00,
-    0x3C, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x1A, 0x40, 0x7C, 0x01, 0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x3E, 0x00,
-    0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00,
-    0xF4, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x01, 0xF0, 0x00,
-    0x2F, 0xAF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00,
-    0x3F, 0xFF, 0xF4, 0xBC, 0x00, 0xFD, 0x00, 0xFE, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0,
-    0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00,
-    0x0F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F,
-    0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0x80, 0x15, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x1A, 0x40, 0x7C, 0x01, 0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x3E,
-    0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E,
-    0x00, 0xF4, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x01, 0xF0,
-    0x00, 0x2F, 0xAF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00, 0x3F, 0xFF, 0xF4, 0xBC, 0x00, 0xFD, 0x00, 0xFE, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x1F, 0x00,
-    0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x7D,
-    0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00,
-    0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x1A, 0x40, 0x7C, 0x01,
-    0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x3E, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0xF4,
-    0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x03, 0xFD, 0x2C,
-    0x00, 0x00, 0x0B, 0xAF, 0xF4, 0x00, 0x00, 0x0D, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00, 0x3F, 0xFF, 0xF4, 0xBC, 0x00, 0xFD, 0x00, 0xFE, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x1F, 0x00,
-    0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x7D,
-    0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00,
-    0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x01, 0x00, 0x00, 0xBF, 0x4B, 0x00, 0x01, 0xEB, 0xFE, 0x00, 0x02, 0x80, 0xB8, 0x15, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x1A, 0x40, 0x7C, 0x01, 0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F,
-    0x40, 0x3E, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8,
-    0x00, 0x2E, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C,
-    0x01, 0xF0, 0x00, 0x2F, 0xAF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xFF, 0x80, 0x3D, 0x00, 0x3F, 0xFF, 0xF4, 0xBC, 0x00, 0xFD,
-    0x00, 0xFE, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x00,
-    0x0F, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x3D, 0x00, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x00, 0x07, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x1A, 0x40, 0x7C, 0x01, 0xFF, 0xF4, 0xF4, 0x0B, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x3E, 0x00, 0x3E,
-    0x00, 0x1F, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0xF4,
-    0x00, 0x3E, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0xB8, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x2F,
-    0xAF, 0xD0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00,
-    0xB8, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x3D,
-    0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x00,
-    0xF4, 0x07, 0xC0, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x02, 0xE0, 0x0F, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x0F,
-    0xFB, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01,
-    0x43, 0xD0, 0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x1F, 0x0B, 0x80, 0x07,
-    0x83, 0xD0, 0x02, 0xE0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x7C, 0x1E, 0x00, 0x3F, 0x0B, 0x80, 0x1F,
-    0x82, 0xF0, 0x1F, 0xD0, 0x7F, 0xBD, 0xB0, 0x0B, 0xFD, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x02, 0xE0, 0x00,
-    0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x02, 0xD0, 0x1F, 0x00, 0x00, 0xF4, 0x0B, 0x80,
-    0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x03, 0xD0, 0x1F,
-    0x00, 0x00, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x0B, 0x80,
-    0x3C, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x3F, 0xEF, 0xF4,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x14, 0x00, 0x05, 0x0F, 0x40, 0x0B, 0x83, 0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xF0, 0x7C, 0x00,
-    0x7C, 0x2E, 0x00, 0x1E, 0x0F, 0x40, 0x0B, 0x83, 0xC0, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x78, 0x00,
-    0xFC, 0x2E, 0x00, 0x7E, 0x0B, 0xC0, 0x7F, 0x41, 0xFE, 0xF6, 0xC0, 0x2F, 0xF4, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x1E, 0x00, 0x00, 0xF0, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0xB8, 0x03, 0xD0, 0x00, 0x2F,
-    0xF8, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00,
-    0x03, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00,
-    0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x3C, 0x05, 0x00, 0x01, 0x4B, 0xC0, 0xF4, 0x00, 0xB9, 0xF0, 0x0F, 0x00, 0x0F, 0xFC, 0x00, 0xF0,
-    0x00, 0xF9, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x3D, 0x00, 0x2D, 0x00,
-    0x03, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x00, 0xB8, 0x01,
-    0xF8, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xBD, 0xB0, 0x00, 0x02, 0xFF, 0x4F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x1E, 0x00, 0x00, 0xF0, 0xF4, 0x0B, 0x80, 0x00, 0x7C, 0xB8, 0x03,
-    0xD0, 0x00, 0x2F, 0xF8, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x2E,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40,
-    0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00,
-    0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x3C, 0x05, 0x00, 0x01, 0x4B, 0xC0, 0xF4, 0x00, 0xB9, 0xF0, 0x0F, 0x00, 0x0F,
-    0xFC, 0x00, 0xF0, 0x00, 0xF9, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x3D,
-    0x00, 0x2D, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x0F, 0xC0,
-    0x00, 0xB8, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xBD, 0xB0, 0x00, 0x02, 0xFF,
-    0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x80, 0x00,
-    0x3C, 0x3D, 0x02, 0xE0, 0x00, 0x1F, 0x2E, 0x00, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x3C, 0x00, 0x02,
-    0xFD, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x1F,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF0,
-    0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0x80,
-    0x00, 0x3C, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00,
-    0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x14, 0x00, 0x01, 0x00, 0x03,
-    0xC0, 0x50, 0x00, 0x14, 0xBC, 0x0F, 0x40, 0x0B, 0x9F, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0x00,
-    0x0F, 0x90, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x03, 0xD0, 0x02, 0xD0, 0x00,
-    0x3C, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x78, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x1F,
-    0x80, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x07, 0xFB, 0xDB, 0x00, 0x00, 0x2F, 0xF4, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x0E, 0x00, 0x00, 0x00,
-    0xF7, 0xFF, 0x00, 0x00, 0x00, 0x34, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x78,
-    0x00, 0x03, 0xC3, 0xD0, 0x2E, 0x00, 0x01, 0xF2, 0xE0, 0x0F, 0x40, 0x00, 0xBF, 0xE0, 0x03, 0xC0,
-    0x00, 0x2F, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x07, 0xF8, 0x34, 0x00, 0x00, 0xFB, 0xFF, 0x00, 0x00,
-    0x0C, 0x07, 0x80, 0x14, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x50, 0x00, 0x14, 0xBC, 0x0F, 0x40, 0x0B,
-    0x9F, 0x00, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0x00, 0x0F, 0x90, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x2E,
-    0x00, 0x1E, 0x00, 0x03, 0xD0, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x07, 0xC0,
-    0x00, 0x78, 0x00, 0xFC, 0x00, 0x0B, 0x80, 0x1F, 0x80, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x07, 0xFB,
-    0xDB, 0x00, 0x00, 0x2F, 0xF4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x78, 0x00, 0x03, 0xC3, 0xD0, 0x2E, 0x00, 0x01, 0xF2, 0xE0, 0x0F, 0x40, 0x00, 0xBF,
-    0xE0, 0x03, 0xC0, 0x00, 0x2F, 0xD0, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0,
-    0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x3C, 0x05, 0x00, 0x01, 0x4B, 0xC0, 0xF4, 0x00, 0xB9, 0xF0, 0x0F, 0x00, 0x0F, 0xFC,
-    0x00, 0xF0, 0x00, 0xF9, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x3D, 0x00,
-    0x2D, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x00,
-    0xB8, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x7F, 0xBD, 0xB0, 0x00, 0x02, 0xFF, 0x4F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03, 0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01,
-    0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B,
-    0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4,
-    0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x87, 0xC0, 0x01, 0xF0, 0x3C, 0x00, 0x3D, 0x03,
-    0xD0, 0x0B, 0x80, 0x2E, 0x01, 0xF0, 0x01, 0xF0, 0x3D, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0xF5, 0xF0,
-    0x00, 0x0B, 0xBD, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C,
-    0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E,
-    0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x7F, 0xF0,
-    0x04, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0xB8, 0x7C, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0xB8, 0x02, 0xE0, 0x1F, 0x00,
-    0x1F, 0x03, 0xD0, 0x00, 0xF0, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0xB8,
-    0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00, 0x3C, 0x02, 0xF0, 0x00, 0x3C,
-    0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1D,
-    0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0F, 0xF0,
-    0xE0, 0x02, 0xDB, 0xFC, 0x00, 0x34, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x7C,
-    0x00, 0x1F, 0x03, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0xB8, 0x02, 0xE0, 0x1F, 0x00, 0x1F, 0x03, 0xD0,
-    0x00, 0xF0, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-    0x03, 0xFC, 0x38, 0x00, 0x0B, 0x6F, 0xF0, 0x00, 0x0D, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xF4, 0x00,
-    0x3C, 0x02, 0xF0, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0x3D, 0x0F, 0x00, 0x00,
-    0x2D, 0x2E, 0x00, 0x00, 0x1D, 0x3C, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0D, 0x00, 0x0D, 0x2F, 0xFC, 0xA0, 0xD2, 0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02,
-    0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0x00, 0x2A, 0xA8, 0xFF,
-    0xE1, 0x55, 0x00, 0x2A, 0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x50, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x55, 0x50, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x55, 0x55, 0x50, 0x78, 0x0F, 0x1E,
-    0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78,
-    0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0,
-    0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80, 0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x80,
-    0xF1, 0xE0, 0x3C, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x55, 0x54, 0x2F, 0xFF, 0xFC, 0x05, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x6A, 0xAA, 0xA4, 0x01, 0xC0, 0x3C, 0x0B, 0x40, 0xF0,
-    0x3E, 0x07, 0xD0, 0x14, 0x00, 0x03, 0xD0, 0xBC, 0x0F, 0x41, 0xF0, 0x2D, 0x03, 0x80, 0x10, 0x00,
-    0x03, 0xE0, 0x7C, 0x0B, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x2C,
-    0x1D, 0x04, 0x01, 0xC0, 0xA0, 0x0F, 0x07, 0x40, 0xB4, 0x3C, 0x03, 0xC2, 0xE0, 0x3E, 0x0F, 0x01,
-    0xF4, 0xBC, 0x01, 0x40, 0x40, 0x00, 0x03, 0xD2, 0xF0, 0x2F, 0x0F, 0x80, 0xF4, 0x7C, 0x07, 0xC2,
-    0xD0, 0x2D, 0x0F, 0x00, 0xE0, 0xB0, 0x01, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x1F, 0x0B, 0xC0,
-    0xB8, 0x3C, 0x03, 0xC1, 0xE0, 0x1E, 0x0F, 0x00, 0xF0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3D,
-    0x3C, 0x3D, 0x3C, 0x2D, 0x3C, 0x2D, 0x2C, 0x1E, 0x1D, 0x0E, 0x04, 0x04, 0x00, 0x3E, 0x00, 0x03,
-    0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x03, 0xFF, 0xFF, 0x7A, 0xFA, 0xE0, 0x0E, 0x00,
-    0x00, 0xD0, 0x00, 0x1C, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x80, 0x00, 0xB8, 0x00, 0x0F,
-    0x40, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x02, 0xA7, 0xAA, 0x00, 0xFF, 0xFF, 0xC0,
-    0x10, 0xB0, 0x50, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x14, 0x38, 0x10, 0x0F, 0xFF, 0xFC, 0x02, 0xAB, 0x6A, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xFB, 0xFF,
-    0xBF, 0xF7, 0xFE, 0x1F, 0x80, 0x08, 0x00, 0x1F, 0x00, 0x1F, 0xD0, 0x2F, 0xF8, 0x3F, 0xFD, 0x3F,
-    0x90, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x7E, 0x7D, 0x10, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x7E,
-    0x03, 0xF7, 0xD0, 0x3E, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x7C, 0x03, 0xC7,
-    0xE0, 0x3F, 0x02, 0xF5, 0xF4, 0x0F, 0x80, 0xBC, 0x10, 0x00, 0x40, 0x04, 0x00, 0x00, 0x2E, 0x3F,
-    0x3E, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00,
-    0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02,
-    0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xC0, 0x0C, 0x00, 0xC0,
-    0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x30, 0x03,
-    0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0xBD, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC1,
-    0xE0, 0x0B, 0x40, 0x00, 0x00, 0x78, 0x0E, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0xE0, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x3C, 0x78, 0xBE, 0x00, 0xBE, 0x0F, 0x07, 0x4F, 0x3E, 0xF4, 0x3F, 0xF8, 0xBA, 0xF3, 0xCB, 0x43,
-    0xCB, 0x83, 0xC2, 0xF8, 0xB4, 0xF0, 0x3C, 0xF0, 0x3C, 0x00, 0x1E, 0x1D, 0x03, 0xDE, 0x03, 0xC0,
-    0x03, 0xC2, 0xC0, 0x39, 0xD0, 0x3C, 0x00, 0xF0, 0x3C, 0x07, 0x6C, 0x03, 0x80, 0x2D, 0x03, 0xC0,
-    0xB2, 0xC0, 0xB4, 0x07, 0x80, 0x3C, 0x0E, 0x2D, 0x0F, 0x00, 0xF0, 0x02, 0xE7, 0xC1, 0xF7, 0xD0,
-    0x3C, 0x00, 0x0F, 0xF4, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBD,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x0E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x1D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02, 0xC2, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x3C, 0x78, 0xBE, 0x00, 0xBE, 0x00, 0x7E, 0x0F, 0x07, 0x4F, 0x3E, 0xF4, 0x3F, 0xF8,
-    0x2F, 0xFC, 0xBA, 0xF3, 0xCB, 0x43, 0xCB, 0x83, 0xC7, 0x83, 0xC2, 0xF8, 0xB4, 0xF0, 0x3C, 0xF0,
-    0x3C, 0xF0, 0x2C, 0x00, 0x1E, 0x1D, 0x03, 0xDE, 0x03, 0xCF, 0x02, 0xC0, 0x03, 0xC2, 0xC0, 0x39,
-    0xD0, 0x3D, 0xE0, 0x3C, 0x00, 0xF0, 0x3C, 0x07, 0x6C, 0x03, 0x9D, 0x03, 0xC0, 0x2D, 0x03, 0xC0,
-    0xB2, 0xC0, 0xB5, 0xD0, 0x74, 0x07, 0x80, 0x3C, 0x0E, 0x2D, 0x0F, 0x1D, 0x0F, 0x00, 0xF0, 0x02,
-    0xE7, 0xC1, 0xF7, 0xD0, 0xF6, 0xD0, 0x3C, 0x00, 0x0F, 0xF4, 0x0B, 0xF4, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xC0, 0x1D, 0x00,
-    0xF0, 0x02, 0x00, 0x00, 0x01, 0xF0, 0xF0, 0x0F, 0x4B, 0x80, 0x7C, 0x3C, 0x03, 0xC2, 0xD0, 0x1D,
-    0x0E, 0x00, 0xF0, 0xB0, 0x02, 0x02, 0x40, 0x00, 0x01, 0xF0, 0xF0, 0xB4, 0x0F, 0x4B, 0x87, 0xC0,
-    0x7C, 0x3C, 0x3C, 0x03, 0xC2, 0xD1, 0xE0, 0x1D, 0x0E, 0x0F, 0x00, 0xF0, 0xB0, 0x74, 0x02, 0x02,
-    0x41, 0x40, 0x00, 0x74, 0x78, 0x3C, 0x2C, 0x1D, 0x0D, 0x05, 0x74, 0xB4, 0x78, 0x78, 0x3C, 0x3C,
-    0x2C, 0x3C, 0x1D, 0x2C, 0x0D, 0x0D, 0x05, 0x09, 0x74, 0xB4, 0xB0, 0x78, 0x78, 0xB4, 0x3C, 0x3C,
-    0x78, 0x2C, 0x3C, 0x3C, 0x1D, 0x2C, 0x2C, 0x0D, 0x0D, 0x1C, 0x05, 0x09, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0x70, 0x00, 0xE3, 0x80, 0x2C, 0x2C, 0x07, 0x01, 0xC0, 0xD0,
-    0x0D, 0x38, 0x00, 0xE0, 0x00, 0x40, 0x1E, 0x07, 0xC1, 0xF0, 0x7C, 0x0F, 0x40, 0x7C, 0x03, 0xD0,
-    0x1E, 0x00, 0xF0, 0x01, 0x00, 0x05, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x02, 0xE0, 0x07, 0xC0,
-    0x3E, 0x03, 0xE0, 0x3D, 0x02, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02,
-    0xD0, 0x00, 0x43, 0xC0, 0x0F, 0x80, 0x0F, 0x07, 0xC0, 0x2D, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x10,
-    0x07, 0xDF, 0x40, 0x12, 0xF0, 0x07, 0xF4, 0x03, 0xEB, 0xC0, 0x0F, 0xC0, 0x0F, 0x89, 0x00, 0xFB,
-    0xC0, 0x18, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x60, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0x07, 0xC2, 0x40,
-    0x0F, 0x80, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F,
-    0x41, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x2E, 0x00, 0xF8, 0x0F, 0x40, 0x3D, 0x03, 0xC0, 0x0F,
-    0x01, 0xF0, 0x07, 0xC0, 0x78, 0x01, 0xE0, 0x2D, 0x00, 0xB4, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x7E, 0x0B, 0xD0, 0x1F,
-    0x42, 0xF0, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x01, 0xFF, 0xFE, 0x02, 0x7D,
-    0x7C, 0x01, 0xF0, 0xF4, 0x07, 0xC3, 0xD0, 0x2E, 0x0F, 0x00, 0xF4, 0xF8, 0x03, 0xDF, 0xC0, 0x0F,
-    0xF8, 0x00, 0x7F, 0x40, 0x01, 0xF4, 0x00, 0x0B, 0x40, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x2A, 0xAA, 0xA5,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0C, 0x38, 0x00, 0x03, 0x81, 0xD0, 0x00,
-    0xE0, 0x0B, 0x95, 0xB8, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x6F, 0x90, 0x00, 0xFA, 0x6F, 0x00, 0xE0,
-    0x00, 0xE0, 0xD0, 0x00, 0x0C, 0xA0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x34, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x0B, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00,
-    0x02, 0xCC, 0x00, 0x03, 0x4D, 0x00, 0x0E, 0x0D, 0x00, 0x1C, 0x0A, 0x00, 0x34, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x96, 0x80, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x1D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x01, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x02, 0xD0, 0x01, 0x01, 0xC0,
-    0x00, 0x14, 0x0B, 0x00, 0x2F, 0x4B, 0x00, 0x00, 0xFD, 0x28, 0x00, 0x6F, 0xF9, 0x55, 0x01, 0xBF,
-    0xE5, 0x50, 0x03, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x1F, 0xC1, 0x50, 0x00, 0xBF, 0x05, 0x02,
-    0xE3, 0x40, 0x00, 0x0B, 0x5D, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0xB0, 0x2D, 0x00,
-    0x02, 0xC0, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xA4, 0xFF, 0xD1, 0x55, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80,
-    0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x07,
-    0xFD, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x01, 0xE0, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00,
-    0x78, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0x00, 0x7F, 0xD0,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x01, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xE0, 0xBF, 0xFF, 0x40, 0x90, 0x1F, 0x02, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00,
-    0x0F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x40, 0x00, 0x2C, 0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x03, 0xD1, 0xFF, 0xFE, 0x01, 0xF4, 0x24, 0x07,
-    0xC0, 0x7C, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x0F, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x1F, 0x80, 0x2E, 0x00, 0x1F, 0x80, 0x0B, 0x40,
-    0x0F, 0x40, 0x03, 0xC0, 0x07, 0x40, 0x00, 0xF0, 0x02, 0xC0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xE0, 0x00,
-    0xBC, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xBF, 0xF4, 0x00,
-    0xF8, 0x3F, 0xFF, 0xD0, 0x0F, 0x41, 0x40, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00,
-    0x1F, 0x03, 0xE0, 0x00, 0x02, 0xE0, 0x3D, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0x1F, 0x40, 0x7C,
-    0x00, 0x0B, 0xD0, 0x07, 0x80, 0x02, 0xF0, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE1, 0x55, 0x55, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7F, 0xFF,
-    0xE4, 0x1F, 0xFF, 0xFF, 0x87, 0x07, 0xFF, 0xF1, 0xC1, 0xFF, 0xFE, 0x70, 0x7F, 0xFF, 0xDC, 0x1F,
-    0xFF, 0xF7, 0x07, 0xFF, 0xFD, 0xC1, 0xFF, 0xFF, 0x70, 0x7F, 0xFF, 0xDC, 0x1F, 0xFF, 0xD7, 0x07,
-    0xFF, 0xF1, 0xC1, 0xFF, 0xF0, 0x70, 0x75, 0x40, 0x1C, 0x1C, 0x00, 0x07, 0x07, 0x00, 0x01, 0xC1,
-    0xC0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C, 0x00, 0x07, 0x07, 0x00, 0x01, 0xC1, 0xC0, 0x00, 0x70,
-    0x70, 0x00, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x42, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFD, 0x7C, 0xFF, 0xFF, 0x0F, 0x7F, 0xFF, 0xC3, 0xEF, 0xFF, 0xF0, 0xFB, 0xFF, 0xFC, 0x3E,
-    0xFF, 0xFF, 0x0F, 0xBF, 0xFF, 0xC3, 0xDF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFC, 0x3C, 0x7F, 0xFF, 0xAF,
-    0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFE, 0x0F, 0x5F, 0xFF,
-    0xE3, 0x83, 0xFF, 0xFC, 0xE0, 0xFF, 0xFF, 0x78, 0x3F, 0xFF, 0xEE, 0x0F, 0xFF, 0xFB, 0x83, 0xFF,
-    0xFE, 0xE0, 0xFF, 0xFF, 0xB8, 0x3F, 0xFF, 0xDE, 0x0F, 0xFF, 0xF3, 0xEB, 0xFF, 0xF4, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x2C, 0x00, 0x3E, 0x0E, 0x00, 0x0B, 0xFB, 0x40, 0x00, 0x0B, 0xFF, 0xF4, 0x01, 0xFD, 0x68, 0x01,
-    0xEB, 0x00, 0x02, 0xF0, 0xE0, 0x00, 0xF0, 0x3C, 0x00, 0x04, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x80, 0x7E, 0x0B, 0xD0, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x2C, 0x00, 0x40, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0xFA, 0x6F, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xD0, 0x00, 0x0C, 0x00, 0xA0, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x30, 0x03, 0x80, 0x00, 0x38, 0x00, 0x74, 0x00, 0x38,
-    0x00, 0x0B, 0x95, 0xB8, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x3C, 0x00, 0x03, 0xD0, 0xD0, 0x00, 0x0B, 0xFB, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x00, 0x02, 0xF9, 0xA8, 0x00, 0x2D, 0xF0, 0x00, 0x03, 0xE2, 0xD0, 0x00,
-    0x1F, 0x07, 0xC0, 0x00, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2C, 0x00, 0x02, 0xE0, 0xB0, 0x00, 0x0B, 0xFB, 0x80,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xFD, 0x69, 0x00, 0x1E, 0x70, 0x00, 0x01, 0xF0, 0xE0, 0x00,
-    0x0F, 0x03, 0xC0, 0x00, 0x04, 0x0B, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x3C, 0xFC, 0x07, 0x87, 0x80, 0xB0, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80,
-    0x00, 0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F,
-    0x00, 0x01, 0xD0, 0x00, 0x3C, 0x07, 0x83, 0x80, 0xBC, 0xB4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x0D, 0x2E, 0x56, 0xFF, 0xE4, 0x07, 0xC3, 0x40,
-    0x00, 0x6F, 0xFF, 0xF0, 0x60, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0B, 0xFF,
-    0xD0, 0x03, 0xD0, 0x0B, 0x40, 0xE0, 0x00, 0x2C, 0x28, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x04, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x7C, 0xB2, 0xD0, 0x01, 0xFF, 0xB4,
-    0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB, 0xFE, 0xA8, 0x00, 0xBF, 0xF0, 0x00, 0x2D,
-    0xB7, 0xC0, 0x0B, 0x4B, 0x1F, 0x00, 0x10, 0xB0, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
-    0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x14, 0x01, 0xF0, 0xF0, 0xF4, 0xB8, 0x0F, 0x4B, 0x87, 0xC3,
-    0xC0, 0x7C, 0x3C, 0x3C, 0x2D, 0x03, 0xC2, 0xD1, 0xD0, 0xE0, 0x1D, 0x0E, 0x0F, 0x0B, 0x00, 0xF0,
-    0xB0, 0x70, 0x34, 0x02, 0x02, 0x41, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x42, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x2F, 0x09, 0x00, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x07, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x4A, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x92, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00,
-    0x00, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBC, 0x7C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x01, 0x92, 0xF0, 0x00, 0x0F,
-    0xCB, 0xC0, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x02, 0xF0, 0x03, 0xF0, 0x3C, 0x0F, 0xC0, 0x0B, 0x40,
-    0xF0, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x18, 0x03, 0xC0, 0x60, 0x00, 0xF8, 0x0F,
-    0x03, 0xE0, 0x03, 0xE0, 0x3C, 0x0F, 0x80, 0x01, 0x00, 0xF0, 0x04, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x3F, 0x3F, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x7C, 0xBD, 0x7C, 0x00, 0x00, 0x7C, 0xBD,
-    0xBC, 0x00, 0x00, 0x7C, 0xBD, 0xBC, 0x10, 0x00, 0x7C, 0xBD, 0xBC, 0x10, 0x00, 0x0B, 0xFE, 0x0A,
-    0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0xFF, 0x40, 0xF4, 0xF0, 0xB4, 0x2C, 0x3C, 0x0B, 0x0E, 0x02, 0xC7,
-    0x40, 0xF1, 0xD0, 0x38, 0x74, 0x1D, 0x1E, 0x0F, 0x03, 0xFF, 0x40, 0x2E, 0x00, 0x00, 0x0B, 0x01,
-    0x00, 0x1C, 0x2C, 0x28, 0x34, 0x30, 0x70, 0xB0, 0x90, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xF4,
-    0x00, 0xFC, 0x00, 0xEB, 0x00, 0xF3, 0xC0, 0xB0, 0xE0, 0xB5, 0x78, 0x3F, 0xFF, 0x80, 0x0F, 0x00,
-    0x03, 0x80, 0x00, 0x90, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xB5, 0x50, 0x38, 0x00, 0x0D, 0x00, 0x07,
-    0xFD, 0x00, 0x57, 0xC0, 0x00, 0x74, 0x00, 0x1D, 0x00, 0x0F, 0x0B, 0xAF, 0x40, 0xBE, 0x00, 0x00,
-    0x04, 0x00, 0x7F, 0xC0, 0x79, 0x10, 0x38, 0x00, 0x2C, 0x00, 0x0F, 0xFF, 0x03, 0xD2, 0xD1, 0xE0,
-    0x38, 0x74, 0x0D, 0x0E, 0x0B, 0x03, 0xEF, 0x80, 0x2E, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x55,
-    0xF4, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1D, 0x00, 0x0F, 0x00, 0x0B, 0x00, 0x07, 0x80, 0x03, 0xC0,
-    0x02, 0xD0, 0x00, 0xA0, 0x00, 0x00, 0x50, 0x01, 0xFF, 0x40, 0xE0, 0xF0, 0x74, 0x2C, 0x0E, 0x0E,
-    0x01, 0xFE, 0x01, 0xFF, 0x41, 0xE0, 0xF0, 0xB0, 0x1D, 0x3C, 0x0B, 0x07, 0xEF, 0x80, 0x6E, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0x01, 0xF1, 0xE0, 0xB0, 0x2C, 0x3C, 0x0B, 0x0F, 0x03, 0xC2, 0xFB, 0xF0,
-    0x2E, 0x74, 0x00, 0x2C, 0x00, 0x2D, 0x0A, 0xBE, 0x01, 0xE8, 0x00, 0x01, 0x40, 0x02, 0x80, 0x02,
-    0x80, 0x7F, 0xFD, 0x2B, 0xE8, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x2A, 0xA8, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x15, 0x54, 0x7F, 0xFD, 0x00, 0x10, 0x03, 0x80, 0x3C, 0x01, 0xD0,
-    0x0F, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x2C, 0x00,
-    0x34, 0x00, 0x01, 0x00, 0x3C, 0x01, 0xC0, 0x1D, 0x00, 0xD0, 0x0D, 0x01, 0xD0, 0x1D, 0x02, 0xC0,
-    0x38, 0x0B, 0x40, 0xE0, 0x2C, 0x0B, 0x00, 0x00, 0x05, 0x02, 0xEF, 0xE0, 0xF8, 0x2C, 0x3C, 0x0F,
-    0x1D, 0x03, 0x8B, 0x00, 0xD2, 0xC0, 0x70, 0xE0, 0x2C, 0x34, 0x0A, 0x00, 0x00, 0x50, 0x00, 0xFF,
-    0x40, 0xF4, 0xF0, 0xB4, 0x2C, 0x3C, 0x0B, 0x0E, 0x02, 0xC7, 0x40, 0xB1, 0xD0, 0x3C, 0x74, 0x1E,
-    0x0E, 0x0F, 0x03, 0xFF, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0xE3, 0xDD, 0x02, 0xC0, 0x3C,
-    0x03, 0xC0, 0x38, 0x07, 0x40, 0xB0, 0x0F, 0x00, 0x90, 0x00, 0x14, 0x00, 0xBF, 0xD0, 0x34, 0x7C,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x03, 0xD0, 0x03, 0xC0, 0x03,
-    0xFF, 0xF0, 0xAA, 0xA4, 0x00, 0x50, 0x0F, 0xFD, 0x09, 0x1F, 0x00, 0x0F, 0x00, 0x0E, 0x06, 0xB8,
-    0x06, 0xF4, 0x00, 0x2C, 0x00, 0x2C, 0x40, 0x3C, 0xFA, 0xF4, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x03, 0xE0, 0x03, 0xF8, 0x02, 0xDD, 0x02, 0xCB, 0x01, 0xD3, 0xC1, 0xE5, 0xF4, 0xBF, 0xFF,
-    0x00, 0x2D, 0x00, 0x0B, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xB5, 0x50, 0x38, 0x00,
-    0x0D, 0x00, 0x07, 0xFD, 0x00, 0x57, 0xC0, 0x00, 0x74, 0x00, 0x1C, 0x00, 0x0F, 0x0B, 0xAF, 0x40,
-    0xBE, 0x00, 0x00, 0x04, 0x00, 0x7F, 0xD0, 0x7D, 0x10, 0x38, 0x00, 0x2C, 0x10, 0x0F, 0xFF, 0x03,
-    0xD1, 0xE0, 0xE0, 0x38, 0x34, 0x0E, 0x0E, 0x0B, 0x42, 0xFF, 0x80, 0x2E, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x55, 0xB4, 0x00, 0x38, 0x00, 0x2C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0B, 0x40, 0x03,
-    0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x10, 0x01, 0xFF, 0x80, 0xF0, 0xB0, 0x38,
-    0x1D, 0x0F, 0x0F, 0x01, 0xFE, 0x00, 0xFF, 0x40, 0xE0, 0xB4, 0xB0, 0x1D, 0x2C, 0x0B, 0x43, 0xEB,
-    0x80, 0x2E, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xF5, 0xF0, 0xB0, 0x2C, 0x3C, 0x0B, 0x0F, 0x03,
-    0xC1, 0xFB, 0xF0, 0x1E, 0x78, 0x00, 0x2C, 0x00, 0x1E, 0x06, 0xBE, 0x01, 0xB8, 0x00, 0x00, 0x40,
-    0x01, 0xC0, 0x01, 0xC0, 0x3F, 0xFD, 0x2A, 0xE9, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40, 0x3F, 0xFD,
-    0x2A, 0xA9, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x15, 0x54, 0x3F, 0xFE, 0x00, 0x40, 0x3C, 0x0B,
-    0x01, 0xD0, 0x3C, 0x07, 0x40, 0xB0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0B, 0x00, 0x70, 0x03,
-    0x40, 0x01, 0x00, 0x2C, 0x01, 0xD0, 0x0D, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1D, 0x02, 0xC0, 0x3C,
-    0x07, 0x40, 0xF0, 0x2C, 0x07, 0x40, 0x02, 0xE1, 0x43, 0xD7, 0xD2, 0xC0, 0xB0, 0xD0, 0x2C, 0x70,
-    0x0E, 0x2C, 0x03, 0x47, 0x03, 0xC0, 0xFB, 0x70, 0x09, 0x04, 0x00, 0x02, 0xE4, 0x0F, 0x6C, 0x2C,
-    0x0D, 0x34, 0x7C, 0x7F, 0x90, 0xB0, 0x00, 0x70, 0x00, 0x3E, 0xB4, 0x06, 0x40, 0x02, 0xA4, 0x03,
-    0xD7, 0x83, 0xC0, 0xB0, 0xD0, 0x1C, 0x70, 0x0B, 0x2C, 0x03, 0x87, 0x01, 0xC0, 0xFA, 0xD0, 0x06,
-    0x40, 0x00, 0x09, 0x02, 0x41, 0xC2, 0xC0, 0x36, 0xC0, 0x07, 0xC0, 0x01, 0xE0, 0x01, 0xEC, 0x00,
-    0xD3, 0x40, 0xE0, 0xB0, 0x50, 0x04, 0x00, 0x1B, 0x90, 0x96, 0xD0, 0x02, 0xC0, 0x0B, 0x1F, 0xFE,
-    0xD0, 0xEE, 0x0B, 0x2E, 0xF0, 0x19, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x35, 0xA4,
-    0x1E, 0x9B, 0x07, 0x81, 0xC2, 0xC0, 0x70, 0xD0, 0x2C, 0x30, 0x0E, 0x1C, 0x03, 0x4B, 0x01, 0xC1,
-    0x40, 0x10, 0x07, 0x00, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x34, 0x28, 0x1C, 0x2C, 0x0B, 0x2C, 0x02,
-    0xAC, 0x00, 0xFF, 0x00, 0x34, 0xD0, 0x1C, 0x2C, 0x0B, 0x03, 0x41, 0x40, 0x50, 0x07, 0x02, 0xC0,
-    0xE0, 0x34, 0x0C, 0x07, 0x02, 0x80, 0xD0, 0x34, 0x1C, 0x0B, 0x01, 0x40, 0x08, 0x78, 0x1E, 0x40,
-    0xE9, 0xEA, 0x7C, 0x1D, 0x07, 0x81, 0xC2, 0xC0, 0xB0, 0x2C, 0x38, 0x0E, 0x03, 0x83, 0x40, 0xD0,
-    0x34, 0x70, 0x1C, 0x07, 0x0B, 0x02, 0xC0, 0x70, 0x50, 0x14, 0x05, 0x00, 0x08, 0x7D, 0x07, 0xA6,
-    0xC2, 0xE0, 0x70, 0xF0, 0x1C, 0x38, 0x0B, 0x0D, 0x03, 0x87, 0x00, 0xD2, 0xC0, 0x70, 0x50, 0x04,
-    0x00, 0x02, 0x1A, 0x00, 0x7A, 0x6C, 0x07, 0x80, 0xD0, 0xB0, 0x0D, 0x0D, 0x01, 0xC0, 0xD0, 0x2C,
-    0x1D, 0x07, 0x42, 0xFA, 0xE0, 0x38, 0x60, 0x03, 0x40, 0x00, 0x70, 0x00, 0x0B, 0x00, 0x00, 0x06,
-    0xE4, 0x79, 0x62, 0xC0, 0x07, 0x80, 0x07, 0xD0, 0x02, 0xC0, 0x07, 0x2A, 0xB8, 0x19, 0x40, 0x01,
-    0x00, 0xA0, 0x2F, 0x92, 0xD4, 0x1C, 0x02, 0x80, 0x34, 0x03, 0x40, 0x70, 0x03, 0xA0, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFA, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x01, 0x55, 0x43, 0xC0, 0x7F, 0xFC, 0x3C, 0x0B, 0x40, 0x03,
-    0xC0, 0xF0, 0x00, 0x3D, 0x0F, 0x00, 0x02, 0xF6, 0xF5, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xE5,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0B, 0xEA, 0x80, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xB0, 0xD0, 0x00, 0x0E, 0x2C, 0x00, 0x06, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFE, 0x01, 0xFF, 0x4B, 0x80, 0x7D, 0xB0, 0xD0, 0x0F, 0x4E, 0x2C, 0x02, 0xF1, 0xC3, 0x80, 0x3D,
-    0x3C, 0x74, 0x03, 0xC3, 0x4B, 0x00, 0x7C, 0xB0, 0xD0, 0x0B, 0x8E, 0x2C, 0x00, 0xB9, 0xC3, 0x80,
-    0x07, 0xFC, 0x74, 0x00, 0x3F, 0x4B, 0x00, 0x03, 0xF0, 0xD0, 0x00, 0x1F, 0xFE, 0xF8, 0x01, 0xFF,
-    0xFF, 0x40, 0x3C, 0x74, 0x00, 0x03, 0x4B, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x1F, 0x80, 0x08, 0x03, 0xE0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x0B, 0x2F, 0x03, 0xC0, 0xFB, 0xF0,
-    0x7C, 0x0F, 0xC0, 0x07, 0xC0, 0xF4, 0x00, 0x7C, 0x1F, 0x00, 0x07, 0xC2, 0xD0, 0x00, 0x7C, 0x3C,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0x2F, 0xBC, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0xFA, 0xAA, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x1F, 0x55, 0x50, 0x00, 0xB4, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x07, 0xD0, 0x04, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x01, 0x7D, 0x54, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x05, 0xF9, 0x54, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0x02, 0xA0, 0x7A, 0x90, 0x02, 0xC7, 0xFF, 0x3F, 0xFF, 0x00, 0xF7, 0x97,
-    0xFF, 0x47, 0xD0, 0x3F, 0x40, 0xBF, 0x00, 0xF4, 0x1F, 0x80, 0x2F, 0x40, 0x3D, 0x07, 0xC0, 0x0F,
-    0xC0, 0x0F, 0x42, 0xE0, 0x07, 0xD0, 0x03, 0xC0, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x3C, 0x02, 0xFC,
-    0x00, 0xB8, 0x1F, 0x00, 0xFE, 0x00, 0x3D, 0x0B, 0x80, 0xFF, 0x40, 0x0F, 0x03, 0xD0, 0x77, 0xC0,
-    0x03, 0xC0, 0xF0, 0x38, 0xF0, 0x01, 0xF0, 0x3C, 0x2C, 0x7C, 0x00, 0xB8, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF0,
-    0x02, 0xF4, 0x03, 0x80, 0x0F, 0xD0, 0x1E, 0x00, 0x3F, 0x80, 0xB4, 0x01, 0xEE, 0x03, 0xC0, 0x0B,
-    0x7C, 0x0F, 0x01, 0xBE, 0xFA, 0xBE, 0x4B, 0xFF, 0xFF, 0xFC, 0x03, 0xCB, 0x4B, 0x00, 0x1E, 0x1D,
-    0x3C, 0x07, 0xFF, 0xFF, 0xFE, 0x1B, 0xEA, 0xFB, 0xE4, 0x0F, 0x03, 0xED, 0x00, 0x38, 0x0F, 0xB0,
-    0x01, 0xE0, 0x3F, 0xC0, 0x0B, 0x40, 0xBF, 0x00, 0x3C, 0x02, 0xF8, 0x00, 0xF0, 0x07, 0xD0, 0x00,
-    0x00, 0xBF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0x00,
-    0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0xF4, 0x70, 0x03, 0xD0, 0x0F, 0x0F, 0x00,
-    0x3C, 0x02, 0xF2, 0xE5, 0x07, 0xC0, 0xBE, 0xFF, 0xF0, 0xBF, 0xFF, 0x47, 0xD4, 0x0B, 0xFF, 0x40,
-    0x3C, 0x00, 0xF4, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x00, 0xB4, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x2E,
-    0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0xFA, 0x43, 0xC0, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x02, 0xA4,
-    0x00, 0xB4, 0x03, 0xC7, 0xFF, 0xC0, 0x3D, 0x01, 0xF3, 0xE1, 0x90, 0x0F, 0x00, 0xF9, 0xF0, 0x00,
-    0x07, 0xD5, 0xFC, 0x7C, 0x00, 0x02, 0xFF, 0xF8, 0x0F, 0x40, 0x00, 0xFE, 0xF8, 0x02, 0xF4, 0x00,
-    0x3C, 0x1F, 0x00, 0x2F, 0x80, 0x0F, 0x03, 0xC0, 0x01, 0xF4, 0x07, 0xC0, 0xF4, 0x00, 0x2E, 0x02,
-    0xE0, 0x2D, 0x00, 0x07, 0x80, 0xF4, 0x0B, 0x80, 0x03, 0xE0, 0x3C, 0x01, 0xF3, 0xEB, 0xF0, 0x0F,
-    0x00, 0x3C, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x01, 0xD0, 0x78,
-    0x07, 0xC0, 0x3C, 0x07, 0x80, 0xFC, 0x03, 0xC0, 0x74, 0x0E, 0xC0, 0xB4, 0x0B, 0x42, 0xDC, 0x0F,
-    0x00, 0xB4, 0x3A, 0xC0, 0xE0, 0x0B, 0x47, 0x6C, 0x2D, 0x00, 0xB0, 0xB2, 0xC3, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x06, 0xFB, 0xFB, 0xEF, 0xA0, 0x0F, 0x3C, 0x3C, 0xF0, 0x00, 0xF3, 0x83, 0x9D, 0x00,
-    0x0F, 0x70, 0x3A, 0xC0, 0x00, 0xEF, 0x03, 0xB8, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B,
-    0x00, 0x3F, 0xFF, 0xF4, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x03, 0xC0, 0x02, 0xD0, 0x78,
-    0x01, 0xE0, 0x50, 0x74, 0x2D, 0x00, 0xB4, 0x3C, 0x2D, 0x0F, 0x00, 0x3C, 0x1E, 0x0B, 0x43, 0xC0,
-    0x0F, 0x0B, 0x83, 0xC1, 0xF0, 0x07, 0x82, 0xD0, 0xF0, 0x78, 0x01, 0xE0, 0xF0, 0x78, 0x2D, 0x00,
-    0xB4, 0x3C, 0x2D, 0x0F, 0x00, 0x3C, 0x1E, 0x0F, 0x03, 0xC0, 0x0F, 0x0B, 0x43, 0xC1, 0xE0, 0x07,
-    0x83, 0xC0, 0x50, 0xB4, 0x02, 0xD0, 0xF0, 0x00, 0x3C, 0x00, 0xF4, 0x3C, 0x00, 0x7D, 0x00, 0x3C,
-    0x1F, 0xAA, 0xFE, 0x00, 0x0F, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x02, 0xA0, 0x7C, 0x00, 0x0B, 0xFF, 0x6E, 0x00, 0x0B, 0xE0, 0xBF, 0x40, 0x07, 0xD0, 0x0F, 0xC0,
-    0x03, 0xE0, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x0F,
-    0x40, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xD0, 0x03, 0xF0, 0x00, 0xB8, 0x01, 0xF8, 0x00, 0x2F, 0x01,
-    0xFD, 0x00, 0x03, 0xFB, 0xDB, 0x00, 0x00, 0x7F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x14, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0xF9, 0x54, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x07, 0xE5, 0x50, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xBE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x2E,
-    0x00, 0x1E, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x2F, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x00, 0xF0, 0x2F,
-    0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0A, 0xFF, 0xFE, 0xA0, 0x00, 0x7D, 0x2E, 0x00, 0x00, 0x2E, 0x07, 0xC0, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x03, 0xC0, 0x2F, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0xB8, 0x00,
-    0x2E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x08, 0x00, 0x02, 0xEB, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xCB, 0x00, 0x3D, 0xBF, 0xD0, 0x00,
-    0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBE, 0xF0, 0x00, 0x05, 0x2E, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xE0,
-    0x00, 0x00, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x01, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x7F, 0xF0,
-    0x07, 0x80, 0x03, 0xD0, 0xF9, 0xFC, 0x0B, 0x40, 0x0B, 0xC3, 0xE0, 0x3D, 0x0F, 0x40, 0x0F, 0x43,
-    0xC0, 0x3D, 0x0F, 0x00, 0x7E, 0x07, 0xC0, 0x3C, 0x1F, 0x06, 0xFC, 0x0B, 0x80, 0xBC, 0x2F, 0xFF,
-    0xE0, 0x0F, 0xEB, 0xF4, 0x2F, 0xF9, 0x00, 0x0F, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x2D, 0x0F, 0x00, 0x00,
-    0x3C, 0x0E, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00,
-    0x3C, 0xF0, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x30, 0x7E, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x02, 0xFB, 0xCF, 0x00, 0x07, 0xAF,
-    0x4F, 0x00, 0x0F, 0x1E, 0x0B, 0x40, 0x2D, 0x0C, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xF4, 0x0B, 0xC0, 0x05, 0xF5,
-    0x57, 0xD4, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xE0, 0x03, 0xC0, 0x02, 0xE0, 0x03, 0xC0, 0x2B, 0xFA,
-    0xAF, 0xE0, 0x2B, 0xEA, 0xAF, 0xA0, 0x07, 0xC0, 0x3E, 0x00, 0x0B, 0xEB, 0xFC, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xFE, 0x3C, 0x18, 0x02, 0xF4, 0x38, 0x00, 0x07, 0xD0,
-    0x74, 0x00, 0x0F, 0x80, 0x70, 0x00, 0x1F, 0x00, 0xB0, 0x00, 0x2F, 0x00, 0xE0, 0x00, 0x3D, 0x00,
-    0xE5, 0x54, 0x3D, 0x01, 0xFF, 0xF4, 0x3C, 0x02, 0xEA, 0xF4, 0x3C, 0x03, 0xC0, 0xF0, 0x3D, 0x03,
-    0x81, 0xF0, 0x3E, 0x03, 0x42, 0xE0, 0x2F, 0x07, 0x03, 0xD0, 0x0F, 0xCB, 0x03, 0xC0, 0x07, 0xFF,
-    0xBF, 0xC0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x00, 0x00,
-    0x00, 0xF3, 0xC0, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0x7D, 0x2E, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x01, 0x6F, 0x56, 0xF5, 0x40, 0x0F, 0x80, 0x7C, 0x00, 0x6B, 0xEA, 0xAF, 0xA0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x3D, 0x00,
-    0x02, 0xE0, 0x2F, 0x00, 0x00, 0xB8, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x1F, 0x02, 0xAA, 0xAA, 0xFE, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF4,
-    0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xEA, 0xAA, 0x90, 0x7C, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x04, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x02, 0xFF,
-    0xFF, 0x80, 0x3F, 0x8F, 0x08, 0x02, 0xF0, 0x38, 0x00, 0x1F, 0x40, 0xD0, 0x00, 0xF8, 0x07, 0x00,
-    0x07, 0xC0, 0x2C, 0x00, 0x2F, 0x00, 0xE0, 0x00, 0xF8, 0x03, 0x80, 0x03, 0xD0, 0x1D, 0x00, 0x0F,
-    0x00, 0xB0, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0xF4, 0x0E, 0x00, 0x03, 0xE0, 0x34, 0x00, 0x0B, 0xC1,
-    0xD0, 0x00, 0x0F, 0xCB, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x70, 0x0B, 0x00, 0x00, 0xF0, 0x0F,
-    0x00, 0x02, 0xF5, 0x6F, 0x54, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xE5, 0x7D, 0x50, 0x03, 0xC0, 0x3C,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x0F, 0x40, 0xF0,
-    0x00, 0x0F, 0x00, 0xF0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x3D, 0x02, 0xE0,
-    0x00, 0x3C, 0x01, 0xFA, 0x80, 0x3C, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x18, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xE2, 0x92, 0x81, 0xF0, 0x3B, 0x9B, 0x9B, 0x1F,
-    0x03, 0x74, 0x74, 0x72, 0xE0, 0x3F, 0x07, 0x0A, 0x7C, 0x01, 0xF9, 0xE0, 0xFF, 0x40, 0x0E, 0xFF,
-    0xFF, 0x80, 0x00, 0xC0, 0xD1, 0xC0, 0x00, 0x0C, 0x1C, 0x1C, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x47, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x42, 0xFF,
-    0xFF, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x1A, 0xAF, 0xE9, 0x0F, 0xFF, 0xFF, 0x40, 0x00,
-    0xF8, 0x00, 0x00, 0xBC, 0x00, 0x16, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x06,
-    0x00, 0x0F, 0x9B, 0xE0, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x3A, 0xF0, 0x6C, 0x00, 0x2F,
-    0xBF, 0x40, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x57, 0xC0, 0x02, 0xD0, 0x7C, 0x00, 0x3C,
-    0x0B, 0x80, 0x07, 0xC0, 0xF4, 0x00, 0xF4, 0x0F, 0x00, 0x3F, 0x01, 0xF0, 0x1F, 0xC0, 0x2F, 0xFF,
-    0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3D, 0xF0, 0x00, 0x00, 0x70, 0x74, 0x00, 0x00, 0xB0, 0x74, 0x00, 0x00, 0x79, 0xB5, 0x55,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x06, 0xFA, 0xAA, 0xBC, 0x00, 0xE0, 0x00, 0x0E, 0x01, 0xD0, 0x00,
-    0x0A, 0x02, 0xC3, 0x08, 0x0A, 0x03, 0xDF, 0xBF, 0x0E, 0x03, 0xF6, 0xF7, 0xAC, 0x03, 0xC0, 0x81,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x3B, 0xC0, 0x00, 0x00, 0x12, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0xBC,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x01, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xEB, 0xEB, 0xF4, 0x02,
-    0xF4, 0x1F, 0x02, 0xF0, 0x0F, 0x40, 0x7C, 0x03, 0xC0, 0x7C, 0x02, 0xE0, 0x0F, 0x03, 0xE0, 0x0F,
-    0x40, 0x3C, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x3C, 0x00, 0xF0, 0x0B, 0xC1, 0xF0, 0x00, 0x00, 0x2E,
-    0x0B, 0x80, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2E, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x2F, 0x00,
-    0x3C, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0xF4, 0x00, 0x7C, 0x00,
-    0xF4, 0x17, 0xF4, 0x1F, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xA8, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2B, 0xEA, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x03, 0x87, 0x00,
-    0x00, 0x00, 0xE1, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x0E,
-    0x90, 0x03, 0xF3, 0x87, 0x00, 0x02, 0xF0, 0xD2, 0xC0, 0x00, 0xF4, 0x34, 0xB0, 0x00, 0xBC, 0x1C,
-    0x38, 0x00, 0x3D, 0x06, 0x08, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x04, 0x00, 0x02, 0xC7, 0x00, 0x00, 0xE2, 0xC0, 0x03, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFE, 0x00, 0xB8, 0x0B, 0xD0, 0x3D, 0x00, 0xF8, 0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x0B, 0x82, 0xE0,
-    0x07, 0xC0, 0xF9, 0x5B, 0xD0, 0x3F, 0xFF, 0x80, 0x0F, 0xAB, 0xF4, 0x07, 0xC0, 0x1F, 0x02, 0xE0,
-    0x03, 0xD0, 0xF4, 0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x1F, 0x07, 0xC0, 0x1F, 0x82, 0xFF,
-    0xFF, 0x80, 0xFF, 0xFE, 0x40, 0x03, 0x8B, 0x00, 0x00, 0xD3, 0x80, 0x00, 0x10, 0x40, 0x00, 0x2A,
-    0xA8, 0xFF, 0xE1, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC6,
-    0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0x03, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_italicBitmaps[32322] = {
+    0x3A, 0xCA, 0x3D, 0xA3, 0xD9, 0x29, 0xD3, 0xAD, 0x3D, 0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0x9C, 0xA3,
+    0xAC, 0x93, 0xD4, 0xD7, 0x71, 0xD9, 0x29, 0xDA, 0x29, 0xD9, 0x39, 0x40, 0x09, 0xCA, 0x1D, 0x1A,
+    0xCA, 0x09, 0xD1, 0xAC, 0x90, 0x9C, 0xA1, 0xD1, 0xAC, 0x91, 0xCA, 0x1A, 0xC2, 0xC9, 0x1C, 0xA2,
+    0xA2, 0xA9, 0x10, 0x6A, 0xC3, 0xC9, 0x70, 0xD2, 0x9C, 0x97, 0x0C, 0xA2, 0xAC, 0x70, 0x9C, 0x92,
+    0xCA, 0x70, 0xAC, 0x29, 0xC9, 0x49, 0xAA, 0xAD, 0xAA, 0xAD, 0xAA, 0xA2, 0xAF, 0xFF, 0xC5, 0xAC,
+    0x29, 0xCA, 0x70, 0xD2, 0xAC, 0x71, 0xCA, 0x2D, 0x70, 0x9C, 0x92, 0xCA, 0x5F, 0xFF, 0xD2, 0xFF,
+    0xFC, 0xA4, 0x9C, 0x92, 0xD7, 0x0A, 0xC3, 0xCA, 0x70, 0xD2, 0xAC, 0x71, 0xCA, 0x2D, 0x70, 0x9C,
+    0x92, 0xCA, 0x60, 0x7A, 0xC7, 0x3D, 0x71, 0xAE, 0xA9, 0x5A, 0xFF, 0x39, 0xD9, 0x9C, 0x1A, 0x93,
+    0xD1, 0xAC, 0x7D, 0x1D, 0x7D, 0x90, 0xCA, 0x7A, 0xDA, 0xC9, 0x70, 0xAE, 0xA7, 0x2F, 0x97, 0x0C,
+    0xAA, 0xD9, 0x7C, 0x90, 0xAC, 0xA6, 0x9C, 0x90, 0xAC, 0xA6, 0xAC, 0x1D, 0x92, 0xCA, 0x90, 0xD9,
+    0xE3, 0xFF, 0xA5, 0x9A, 0xEA, 0x71, 0x9C, 0x73, 0xAC, 0x73, 0x99, 0x70, 0x77, 0x29, 0xEA, 0x6C,
+    0xA1, 0x9D, 0xAD, 0x94, 0xD2, 0xD1, 0x9C, 0xA3, 0xAC, 0x91, 0x9C, 0xA2, 0xCA, 0x29, 0xCA, 0x2A,
+    0xC3, 0xCA, 0x2D, 0x3D, 0x29, 0xC9, 0x1D, 0x4D, 0x2A, 0xC1, 0xAC, 0x94, 0xD2, 0xD0, 0x9C, 0xA0,
+    0xAD, 0xA0, 0xD1, 0x9C, 0x90, 0xD0, 0xDA, 0xD9, 0xAC, 0xAA, 0xD0, 0xD0, 0xAC, 0x91, 0xD0, 0xAD,
+    0xA0, 0xAC, 0x90, 0xD2, 0xD4, 0x9C, 0xA0, 0x9C, 0x92, 0xD4, 0xD1, 0xAC, 0x3C, 0xA3, 0xD2, 0xD2,
+    0x9C, 0x92, 0xAC, 0x92, 0xD2, 0xAC, 0x29, 0xCA, 0x3D, 0x2C, 0xA2, 0xD4, 0xAC, 0xA9, 0xD2, 0xD6,
+    0xF9, 0x77, 0x20, 0x77, 0x69, 0xFA, 0x71, 0xAD, 0xAA, 0xDA, 0x79, 0xD2, 0x9D, 0x7A, 0xCA, 0x3D,
+    0x7A, 0xC9, 0x3D, 0x7A, 0xCA, 0x2D, 0x97, 0x0D, 0x09, 0xDA, 0x71, 0xFC, 0x97, 0x19, 0xEA, 0x72,
+    0xAD, 0xAD, 0x49, 0x92, 0xDA, 0x1D, 0xA2, 0xAC, 0xA1, 0xAC, 0xA3, 0xD9, 0x1D, 0x2D, 0x49, 0xD0,
+    0xDA, 0x2D, 0x5A, 0xEA, 0x3D, 0x6E, 0x4D, 0xA3, 0x9F, 0x93, 0x9E, 0xAA, 0xEA, 0xAD, 0x49, 0xFC,
+    0xA2, 0xDA, 0x77, 0x20, 0x09, 0xCA, 0x0A, 0xCA, 0x0A, 0xC9, 0x0D, 0x1C, 0xA1, 0xC9, 0x1A, 0x10,
+    0x5C, 0xA5, 0xD5, 0xD9, 0x4A, 0xCA, 0x5D, 0x5D, 0x94, 0x9D, 0x5A, 0xC9, 0x5D, 0x59, 0xD5, 0xAC,
+    0xA5, 0xD9, 0x5D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x95, 0xAC, 0x95, 0x9C, 0xA6, 0xD6, 0x9C, 0x94,
+    0x4C, 0xA6, 0xAC, 0x69, 0xC9, 0x6C, 0xA6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD5, 0x9D, 0x5A,
+    0xCA, 0x5D, 0x95, 0xD5, 0xAC, 0xA5, 0xD5, 0xAC, 0xA4, 0x9D, 0x5D, 0x5A, 0xC9, 0x4A, 0xCA, 0x50,
+    0x77, 0x2D, 0x72, 0xD5, 0x93, 0xD5, 0xD9, 0x1C, 0x95, 0xAE, 0xAC, 0x70, 0x9A, 0xFE, 0x4A, 0xDA,
+    0x9A, 0xAA, 0x3A, 0xC9, 0xD6, 0xDA, 0x0A, 0xC9, 0x49, 0xD1, 0x9D, 0x59, 0x3D, 0x72, 0x94, 0x5C,
+    0x97, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA5, 0xAA, 0xAA, 0xEA, 0xAA, 0xA9,
+    0x9F, 0xFE, 0xA4, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x71,
+    0x2A, 0xCA, 0x2D, 0x91, 0xAD, 0x2D, 0x91, 0x9C, 0xA2, 0xD7, 0x00, 0x0A, 0xAA, 0xAA, 0xA0, 0xFC,
+    0xA0, 0x99, 0x99, 0x90, 0x4D, 0x99, 0xDA, 0x9D, 0x90, 0x91, 0x71, 0x9C, 0xA7, 0x2D, 0x97, 0x1A,
+    0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2D,
+    0x97, 0x1A, 0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x10,
+    0x77, 0x1A, 0xF9, 0x5F, 0xE9, 0x3E, 0x2A, 0xD2, 0xAD, 0x4D, 0x2D, 0x94, 0xD9, 0x09, 0xD5, 0xD9,
+    0x0D, 0xA5, 0xD9, 0x0D, 0x95, 0xD9, 0x0D, 0x6D, 0x09, 0xD5, 0x9D, 0x09, 0xCA, 0x59, 0xD0, 0xAC,
+    0xA5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0x9D, 0x4D, 0x92, 0xD9, 0x2E, 0x3A,
+    0xDA, 0xAE, 0x5A, 0xFA, 0x77, 0x10, 0x49, 0xD4, 0xF2, 0xAF, 0xA1, 0xE9, 0xD9, 0x1D, 0x1D, 0x59,
+    0xD5, 0x9C, 0xA5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x6D, 0x59, 0xD5,
+    0xAC, 0xA5, 0xD9, 0x30, 0x77, 0x29, 0xFC, 0x95, 0xFF, 0x94, 0xCA, 0x3E, 0x73, 0xD7, 0x3D, 0x73,
+    0xD7, 0x2A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x0A,
+    0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xE7, 0x1A, 0xFF, 0xD9, 0x1F, 0xFE, 0x20, 0x77, 0x2A, 0xFC,
+    0x94, 0x9F, 0xF9, 0x4C, 0xA3, 0xAD, 0x73, 0xD7, 0x3D, 0x72, 0x9D, 0x72, 0xD9, 0x79, 0xAD, 0x95,
+    0xAF, 0xA7, 0xAA, 0xF7, 0x3A, 0xD7, 0x3D, 0xA7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x91, 0x99,
+    0x5A, 0xD2, 0x9E, 0xAA, 0xAE, 0x93, 0xAF, 0xDA, 0x77, 0x20, 0x71, 0xAD, 0x71, 0xAE, 0x70, 0x9E,
+    0xA7, 0x9D, 0xAC, 0x97, 0xD0, 0xD7, 0xD9, 0x0D, 0x6D, 0x90, 0x9D, 0x5A, 0xCA, 0x1A, 0xCA, 0x4A,
+    0xCA, 0x2D, 0x93, 0x9D, 0x3D, 0x39, 0xD4, 0xD3, 0xD4, 0x9D, 0x2A, 0xFF, 0xF9, 0xAF, 0xFF, 0x70,
+    0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0x93, 0x4F, 0xF9, 0x4F, 0xF4, 0xAC, 0xA7, 0x2D, 0x97,
+    0x2D, 0x72, 0x9C, 0xA7, 0x2A, 0xC9, 0x72, 0xFD, 0xA6, 0xFF, 0x72, 0x9D, 0xA7, 0x29, 0xD7, 0x3D,
+    0x73, 0xD7, 0x29, 0xD7, 0x2D, 0xA2, 0xA5, 0xAD, 0x3E, 0xAA, 0xAE, 0x93, 0xAF, 0xDA, 0x77, 0x20,
+    0x77, 0x29, 0xAF, 0xA4, 0xAF, 0xD9, 0x3E, 0x97, 0xAD, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0x9D, 0x71,
+    0xAC, 0xA9, 0xFA, 0x3D, 0xAD, 0xAA, 0xE2, 0xE9, 0x3D, 0x90, 0x9D, 0x94, 0xD9, 0x09, 0xD5, 0xAC,
+    0x90, 0x9D, 0x5D, 0x90, 0x9D, 0x5D, 0x19, 0xD4, 0x9D, 0x2D, 0xA2, 0x9D, 0x92, 0x9E, 0xAE, 0xA4,
+    0x9F, 0xC9, 0x77, 0x00, 0x0F, 0xFE, 0x1F, 0xFE, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xD7, 0x1A, 0xCA,
+    0x71, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xCA, 0x71, 0xD7, 0x1D, 0xA7, 0x09, 0xD7,
+    0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0x97, 0x0A, 0xCA, 0x71, 0x77, 0x1A, 0xFA, 0x5F, 0xF3, 0xDA, 0x29,
+    0xD9, 0x2D, 0x4A, 0xCA, 0x19, 0xD4, 0xAC, 0xA2, 0xD4, 0xD9, 0x2D, 0xA2, 0xDA, 0x4D, 0xAA, 0xDA,
+    0x5A, 0xF5, 0x9E, 0xAD, 0xA3, 0xAD, 0x91, 0x9D, 0x91, 0x9D, 0x49, 0xD1, 0xAC, 0xA5, 0xD1, 0xD9,
+    0x5D, 0x1D, 0xA4, 0x9D, 0x1A, 0xD4, 0xDA, 0x2E, 0xAA, 0xAE, 0x4A, 0xFC, 0xA7, 0x70, 0x77, 0x09,
+    0xFA, 0x5A, 0xFE, 0x3A, 0xD3, 0xDA, 0x2D, 0x49, 0xD1, 0xAC, 0xA5, 0xD1, 0xAC, 0x95, 0xD1, 0xD9,
+    0x49, 0xD1, 0xD9, 0x4A, 0xD1, 0xAD, 0x39, 0xE2, 0xE9, 0x9A, 0xEA, 0x29, 0xFC, 0x9D, 0x94, 0x99,
+    0x91, 0xD7, 0x1A, 0xCA, 0x71, 0xD7, 0x1A, 0xCA, 0x70, 0xAD, 0x3D, 0xAA, 0xF4, 0xFD, 0xA7, 0x72,
+    0x2A, 0xA2, 0x9D, 0xA1, 0xAD, 0x92, 0xA9, 0x77, 0x77, 0x73, 0xD9, 0x19, 0xDA, 0x19, 0xD9, 0x29,
+    0x30, 0x4A, 0xA4, 0x9D, 0xA3, 0xAD, 0x94, 0xA9, 0x77, 0x77, 0x77, 0x73, 0xDA, 0x39, 0xD4, 0xAC,
+    0xA4, 0xD4, 0x9C, 0xA4, 0xD7, 0x40, 0x77, 0x7A, 0xA7, 0x0A, 0xD9, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A,
+    0xDA, 0x6A, 0xDA, 0x70, 0xDA, 0x71, 0x9A, 0xE9, 0x71, 0xAE, 0xA7, 0x19, 0xEA, 0x97, 0x09, 0xEA,
+    0x72, 0xAA, 0x74, 0x75, 0xFF, 0xE9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x70, 0xFF,
+    0xE9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x74, 0x9C, 0x97, 0x2E, 0x97, 0x1A, 0xE9, 0x71,
+    0xAE, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0x71, 0xAD, 0xA6, 0xAE, 0x94, 0x9E, 0xA9, 0x4A, 0xEA, 0x6E,
+    0x97, 0x9C, 0x97, 0x76, 0x74, 0x9A, 0xFA, 0x29, 0xFE, 0xA2, 0xA9, 0x29, 0xD7, 0x0D, 0x97, 0xD9,
+    0x7D, 0x7D, 0xA6, 0xE5, 0x9D, 0xA5, 0x9D, 0xA6, 0xD9, 0x69, 0xC9, 0x7A, 0xC7, 0x77, 0x59, 0xD7,
+    0xE7, 0xDA, 0x70, 0x97, 0x79, 0xAA, 0xDA, 0xA7, 0x2A, 0xFF, 0xCA, 0x69, 0xDA, 0x94, 0x9E, 0x49,
+    0xD9, 0x70, 0xAC, 0xA3, 0xD7, 0x3D, 0x2D, 0x39, 0xAE, 0xA9, 0x1A, 0xC9, 0x09, 0xCA, 0x2A, 0xDA,
+    0xAD, 0xA1, 0x9C, 0x90, 0xD2, 0xAC, 0xA2, 0xAC, 0x91, 0x9C, 0xA0, 0xCA, 0x19, 0xD3, 0xD2, 0x9C,
+    0xA9, 0xC9, 0x1A, 0xC9, 0x3C, 0xA2, 0x9C, 0x9A, 0xC9, 0x1D, 0x39, 0xC9, 0x2A, 0xC0, 0xAC, 0x2D,
+    0x3D, 0x92, 0xD0, 0xAC, 0x2D, 0x29, 0xD2, 0xAC, 0x90, 0xAC, 0x91, 0xAC, 0xA0, 0x9C, 0xAC, 0xA0,
+    0xAD, 0x19, 0xCA, 0x2F, 0x90, 0xFA, 0x3D, 0x39, 0x93, 0x99, 0x5A, 0xCA, 0x77, 0x1D, 0xA7, 0x97,
+    0x0E, 0xAA, 0x99, 0xAA, 0xD7, 0x19, 0xFE, 0xA9, 0x75, 0x97, 0x20, 0x71, 0xDA, 0x72, 0x9E, 0x72,
+    0xF7, 0x1A, 0xCA, 0xD7, 0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA, 0x1A,
+    0xCA, 0x59, 0xD2, 0x9C, 0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0xAA, 0xAA, 0xAD, 0x4F, 0xFD, 0x39, 0xD9,
+    0x99, 0x99, 0x9D, 0x3D, 0x95, 0xD9, 0x1A, 0xD6, 0xD9, 0x1D, 0x96, 0xAC, 0xA0, 0xAD, 0x7A, 0xCA,
+    0x0D, 0x97, 0x9D, 0x3F, 0xDA, 0x94, 0x9F, 0xFA, 0x3A, 0xCA, 0x3A, 0xD9, 0x2D, 0x94, 0xDA, 0x2D,
+    0x5A, 0xCA, 0x19, 0xD5, 0xDA, 0x1A, 0xCA, 0x49, 0xD2, 0xDA, 0x99, 0x99, 0xAD, 0x92, 0xFF, 0x94,
+    0xDA, 0xAA, 0xAE, 0x39, 0xD4, 0xAD, 0x2A, 0xCA, 0x5D, 0x91, 0xD9, 0x5D, 0xA1, 0xD6, 0xD9, 0x1D,
+    0x59, 0xD1, 0x9D, 0x49, 0xDA, 0x1A, 0xFF, 0xCA, 0x2F, 0xFA, 0x93, 0x77, 0x5A, 0xFC, 0xA5, 0xAF,
+    0xFA, 0x3E, 0xA4, 0xA3, 0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0x97,
+    0x3D, 0x97, 0x3D, 0x74, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7, 0x4E, 0x73, 0x9F, 0xAE, 0xA5,
+    0x9F, 0xE9, 0x77, 0x10, 0x3F, 0xCA, 0xA6, 0x9F, 0xFA, 0x4A, 0xCA, 0x29, 0xEA, 0x3D, 0x94, 0xAD,
+    0x3D, 0x6D, 0xA1, 0x9D, 0x6A, 0xD1, 0xAC, 0xA6, 0x9D, 0x1D, 0x96, 0x9D, 0x1D, 0x96, 0xAD, 0x1D,
+    0x7A, 0xCA, 0x09, 0xD7, 0xDA, 0x0A, 0xCA, 0x69, 0xD1, 0xD9, 0x6E, 0x1D, 0x6A, 0xD9, 0x1D, 0x5A,
+    0xDA, 0x19, 0xD3, 0x9E, 0xA2, 0xAF, 0xFC, 0x93, 0xFE, 0xA9, 0x50, 0x3F, 0xFA, 0x29, 0xFF, 0xA2,
+    0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA,
+    0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7,
+    0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x3F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71,
+    0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0x92, 0x9D, 0x99, 0x99,
+    0x99, 0x3A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x10,
+    0x77, 0x6A, 0xFD, 0x95, 0xAF, 0xFC, 0x93, 0xEA, 0x49, 0xA3, 0xAD, 0x97, 0x29, 0xD9, 0x73, 0xDA,
+    0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x94, 0x99, 0x99, 0x99, 0x1D, 0x94, 0xFC, 0x91, 0xD5, 0xAA,
+    0xAD, 0x91, 0xD7, 0x0D, 0x2D, 0x96, 0x9D, 0x2D, 0xA6, 0xAC, 0xA2, 0xAD, 0x6D, 0x93, 0xE5, 0xD4,
+    0x9F, 0xAF, 0xC6, 0xAF, 0xDA, 0x97, 0x72, 0x3D, 0x7D, 0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA,
+    0x3D, 0x96, 0xD9, 0x3D, 0x7D, 0x39, 0xD7, 0xD3, 0xAC, 0xA6, 0x9D, 0x3A, 0xCA, 0x99, 0x99, 0x99,
+    0x9A, 0xCA, 0x3F, 0xFF, 0x93, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A,
+    0xCA, 0x3D, 0x96, 0xAC, 0x93, 0xD7, 0xD9, 0x3D, 0x7D, 0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA,
+    0x3D, 0x96, 0xD9, 0x30, 0x3A, 0xFC, 0x93, 0x9F, 0xA6, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7,
+    0x9D, 0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD6, 0x9A, 0xDA,
+    0x93, 0x9F, 0xD3, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A,
+    0xCA, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x71,
+    0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x0A, 0xD4, 0x90, 0x9A, 0xD9, 0x4F, 0xCA,
+    0x5A, 0xAA, 0xA7, 0x3D, 0x5A, 0xCA, 0x39, 0xCA, 0x4A, 0xD4, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0xAD,
+    0x6D, 0x2A, 0xD6, 0x9D, 0x1A, 0xD7, 0xAC, 0xA0, 0xAD, 0x70, 0xD9, 0xAD, 0x71, 0xFC, 0xA7, 0x1E,
+    0xAD, 0x70, 0x9D, 0x90, 0xAC, 0xA7, 0xAC, 0xA1, 0x9D, 0x7D, 0x92, 0xD9, 0x6D, 0x3A, 0xD6, 0xD4,
+    0xD9, 0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0x9D, 0x4D, 0x95, 0xDA, 0x30, 0x3D, 0x69, 0xCA, 0x6A,
+    0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9,
+    0x6D, 0x7D, 0x69, 0xD6, 0xAF, 0xF9, 0xFF, 0xC0, 0x29, 0xE7, 0x09, 0xE3, 0xAE, 0x70, 0xF3, 0xAE,
+    0x7A, 0xEA, 0x3D, 0xAC, 0x96, 0xDA, 0xC9, 0x3D, 0x9C, 0x95, 0xAC, 0x9D, 0x39, 0xCA, 0x9C, 0xA5,
+    0xD0, 0xD3, 0xAC, 0xA0, 0xCA, 0x4D, 0x99, 0xD3, 0xD9, 0x0D, 0x39, 0xCA, 0x0A, 0xCA, 0x3D, 0x1D,
+    0x3D, 0x1D, 0x93, 0xD1, 0xD2, 0x9C, 0xA1, 0xD3, 0x9C, 0xA1, 0xAC, 0x2D, 0x19, 0xD3, 0xAC, 0x91,
+    0xAC, 0x90, 0xAC, 0xA1, 0x9D, 0x3D, 0x91, 0x9C, 0x90, 0xD2, 0xAC, 0xA3, 0xD2, 0x9C, 0xAA, 0xC9,
+    0x2D, 0x92, 0x9D, 0x29, 0xF3, 0xD3, 0x9C, 0xA3, 0xE9, 0x29, 0xD3, 0xAC, 0x93, 0xE3, 0xAC, 0xA3,
+    0xD4, 0xD4, 0xAC, 0xA3, 0x29, 0xD9, 0x69, 0xCA, 0x2A, 0xDA, 0x6A, 0xCA, 0x2A, 0xE6, 0xD9, 0x2F,
+    0x95, 0xD3, 0xD9, 0xD4, 0x9D, 0x29, 0xCA, 0x0D, 0x49, 0xCA, 0x2A, 0xCA, 0x0A, 0xCA, 0x3A, 0xC9,
+    0x2D, 0x90, 0x9D, 0x3D, 0x92, 0xD2, 0xD9, 0x2D, 0x3D, 0x2A, 0xCA, 0x19, 0xD2, 0x9C, 0xA3, 0xD1,
+    0xAC, 0xA2, 0xAC, 0x93, 0xD9, 0x0A, 0xC9, 0x2D, 0x93, 0x9C, 0xA0, 0xD3, 0xD5, 0xD0, 0xD2, 0x9D,
+    0x5A, 0xCA, 0xD2, 0x9C, 0xA5, 0x9E, 0xA2, 0xAC, 0x96, 0xE9, 0x2D, 0x7A, 0xD3, 0x77, 0x69, 0xFC,
+    0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D,
+    0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7,
+    0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF,
+    0x97, 0xAF, 0xCA, 0x77, 0x60, 0x3F, 0xCA, 0x95, 0x9F, 0xF4, 0xAC, 0xA2, 0x9D, 0xA3, 0xD9, 0x39,
+    0xD3, 0xD5, 0xD2, 0x9D, 0x5D, 0x2A, 0xCA, 0x49, 0xD2, 0xD9, 0x4D, 0xA2, 0xD9, 0x29, 0xE3, 0xFF,
+    0xC3, 0x9F, 0xDA, 0x94, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72,
+    0xD9, 0x72, 0x77, 0x69, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A,
+    0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97, 0x09,
+    0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD2, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD, 0x4E,
+    0x4A, 0xD9, 0x49, 0xFA, 0xF9, 0x7A, 0xFC, 0xA7, 0x49, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6E,
+    0x76, 0x99, 0x30, 0x3F, 0xCA, 0x95, 0x9F, 0xF4, 0xAC, 0xA2, 0x9E, 0x3D, 0x93, 0x9D, 0x3D, 0x5D,
+    0x29, 0xD5, 0xD2, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xDA, 0x2D, 0x99, 0x99, 0xAD, 0xA3, 0xFF, 0x93,
+    0x9D, 0xAA, 0xAD, 0x5A, 0xCA, 0x2D, 0x94, 0xD9, 0x2A, 0xCA, 0x4D, 0x39, 0xD4, 0xD4, 0xD9, 0x29,
+    0xD4, 0xAD, 0x2A, 0xCA, 0x5D, 0x2D, 0x95, 0xDA, 0x10, 0x77, 0x19, 0xFC, 0xA9, 0x3F, 0xFA, 0x2A,
+    0xD9, 0x3A, 0x92, 0xD9, 0x70, 0x9D, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xE9, 0x70,
+    0x9E, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0x72, 0xD7, 0x2D, 0x71, 0xAD, 0x19, 0x94, 0x9D, 0xA1, 0xAE,
+    0xAF, 0xA2, 0x9F, 0xE9, 0x77, 0x00, 0x9F, 0xFE, 0xAA, 0xFF, 0xE9, 0x4D, 0x97, 0x1D, 0x71, 0x9D,
+    0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D,
+    0x71, 0x9D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x70, 0x29, 0xCA, 0x7D, 0x3A, 0xCA,
+    0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D, 0x3D, 0x96,
+    0x9D, 0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D,
+    0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9, 0x7A, 0xFD,
+    0x97, 0x76, 0xAC, 0x97, 0xAC, 0xA0, 0xAC, 0xA7, 0xD9, 0x09, 0xCA, 0x6A, 0xD1, 0x9D, 0x6D, 0x92,
+    0xD5, 0xAD, 0x3D, 0x5D, 0x93, 0xD4, 0xAC, 0xA4, 0xD4, 0xD5, 0xD9, 0x2A, 0xCA, 0x5A, 0xC9, 0x2D,
+    0x6A, 0xCA, 0x1A, 0xCA, 0x69, 0xCA, 0x1D, 0x79, 0xCA, 0x0A, 0xCA, 0x79, 0xD0, 0xD7, 0x1D, 0xAC,
+    0x97, 0x1F, 0x72, 0xE9, 0x72, 0xE7, 0x10, 0x9C, 0xA6, 0xD6, 0xD9, 0x9D, 0x5A, 0xD9, 0x49, 0xD1,
+    0xD5, 0xE9, 0x4D, 0xA1, 0xD4, 0xAE, 0x94, 0xD2, 0xD4, 0xD9, 0xC9, 0x3A, 0xCA, 0x2D, 0x3A, 0xC9,
+    0x9C, 0xA3, 0xD3, 0xD3, 0xD0, 0x9C, 0xA2, 0xAC, 0xA3, 0xD2, 0x9C, 0xA0, 0x9C, 0xA2, 0xD4, 0xD2,
+    0xD1, 0x9C, 0xA1, 0x9D, 0x4D, 0x19, 0xCA, 0x2C, 0xA1, 0xD9, 0x4D, 0x1D, 0x3C, 0xA0, 0x9D, 0x5D,
+    0x09, 0xCA, 0x3D, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x3D, 0x0D, 0x6D, 0x9D, 0x4D, 0x9C, 0xA6, 0xAC,
+    0xAC, 0x94, 0xF7, 0xAE, 0x5E, 0xA7, 0xAD, 0x95, 0xE7, 0x0A, 0xD6, 0xDA, 0x70, 0x4D, 0x69, 0xCA,
+    0x5A, 0xCA, 0x49, 0xD6, 0x9D, 0x4D, 0x97, 0xD3, 0xDA, 0x70, 0xAC, 0xA1, 0xAD, 0x72, 0xD0, 0x9D,
+    0x73, 0xDA, 0xD7, 0x49, 0xE9, 0x75, 0xDA, 0x75, 0xF7, 0x4A, 0xF7, 0x39, 0xD0, 0xAC, 0x97, 0x2D,
+    0x90, 0x9D, 0x71, 0xDA, 0x2D, 0x70, 0xAD, 0x3A, 0xCA, 0x69, 0xD4, 0x9D, 0x6D, 0x95, 0xD9, 0x4D,
+    0xA6, 0xAC, 0xA3, 0xAC, 0xA6, 0xAC, 0xA0, 0x9D, 0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3,
+    0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9, 0x5D, 0x1A, 0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E,
+    0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D,
+    0x71, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x73, 0x9D, 0xA7, 0x3D, 0xA7, 0x3A, 0xD7, 0x39, 0xD7, 0x4D,
+    0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xDA, 0x73, 0xAD, 0x73, 0xAD,
+    0x73, 0x9D, 0x97, 0x3F, 0xFE, 0x4F, 0xFE, 0x30, 0x4A, 0xF5, 0xFC, 0x5D, 0x79, 0xD7, 0xAC, 0xA7,
+    0xAC, 0x97, 0xD7, 0x0D, 0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x0D, 0x79, 0xCA, 0x7A, 0xC9,
+    0x7D, 0x70, 0xD7, 0x9D, 0x79, 0xCA, 0x7A, 0xC9, 0x7F, 0xC5, 0xFA, 0x40, 0x0C, 0xA3, 0xD3, 0xD3,
+    0xD3, 0xAC, 0x92, 0xAC, 0x92, 0x9C, 0xA3, 0xD3, 0xD3, 0xD3, 0xD3, 0xAC, 0x92, 0x9C, 0xA2, 0x9C,
+    0xA3, 0xD3, 0xD3, 0xD3, 0xAC, 0x90, 0x4F, 0x93, 0x9F, 0x96, 0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0xA6,
+    0xD9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x69, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7,
+    0xD6, 0x9C, 0xA6, 0xAC, 0xA3, 0x9F, 0x93, 0xAF, 0x40, 0x5C, 0xA7, 0x29, 0xD9, 0x71, 0xF7, 0x09,
+    0xC9, 0xAC, 0x97, 0xD1, 0xD6, 0x9C, 0xA1, 0xAC, 0x95, 0xD3, 0xD4, 0x9C, 0xA3, 0xAC, 0x93, 0xAC,
+    0x5D, 0x3C, 0xA5, 0xAC, 0x91, 0xAC, 0x96, 0xD1, 0x99, 0x70, 0x90, 0x0A, 0xFF, 0xA0, 0xFF, 0xCA,
+    0x5D, 0x2A, 0xCA, 0x2D, 0x3C, 0xA0, 0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9,
+    0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC,
+    0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92,
+    0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x39, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x3D,
+    0x72, 0x9C, 0xA1, 0x9A, 0xA5, 0xAC, 0x99, 0xFC, 0x4D, 0xAC, 0xA9, 0x9E, 0x3E, 0x93, 0xD2, 0x9D,
+    0xA4, 0xD2, 0xAD, 0x5D, 0x2A, 0xCA, 0x5D, 0x2D, 0x94, 0x9D, 0x2D, 0x5A, 0xD1, 0x9D, 0x5D, 0x91,
+    0xAD, 0x49, 0xD2, 0xEA, 0x29, 0xD9, 0x2D, 0x9D, 0xAE, 0xA3, 0xCA, 0x09, 0xF9, 0x77, 0x10, 0x49,
+    0xAA, 0xA9, 0x39, 0xFD, 0x91, 0x9D, 0xA9, 0x09, 0xA2, 0xD9, 0x6D, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7D, 0x97, 0xD9, 0x7A, 0xCA, 0x79, 0xD7, 0x0E, 0xAA, 0xAC, 0xA3, 0xAF, 0xC9, 0x74, 0x72, 0x9D,
+    0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xD5, 0x9A, 0xA1, 0x9D, 0x39, 0xFC, 0x9A, 0xCA, 0x2A,
+    0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x3E, 0x2D, 0xA4, 0xAD, 0x2D, 0x94, 0xAC, 0xA1, 0x9D, 0x5A, 0xC9,
+    0x1A, 0xCA, 0x5D, 0x91, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xE2, 0xAC, 0xA3, 0x9D, 0xA2, 0xAD, 0x29,
+    0xE9, 0x3E, 0xAD, 0x9A, 0xC4, 0x9F, 0x90, 0xD7, 0x71, 0x49, 0xAA, 0x94, 0x9F, 0xD2, 0x9D, 0xA0,
+    0x9D, 0xA1, 0xD9, 0x29, 0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0x3A, 0xD0, 0x9D, 0xAA, 0xF9, 0x0A,
+    0xFD, 0xA2, 0xDA, 0x7D, 0x97, 0xAC, 0xA7, 0x9D, 0x49, 0x2E, 0xAA, 0xAD, 0x3A, 0xFC, 0xA7, 0x40,
+    0x77, 0x7A, 0xF7, 0x0A, 0xDA, 0xCA, 0x79, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x72, 0x9D, 0x99, 0x96,
+    0x9F, 0xE7, 0x9A, 0xD9, 0x97, 0x1A, 0xC9, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73,
+    0xD9, 0x73, 0xD7, 0x4D, 0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAC,
+    0xA7, 0x3D, 0x97, 0x0F, 0xC7, 0x1A, 0xDA, 0x72, 0x59, 0xAA, 0x29, 0x93, 0x9F, 0xC9, 0x9C, 0xA2,
+    0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0xE2, 0xAD, 0x4A, 0xD2, 0xD9, 0x4A, 0xCA, 0x19, 0xD5, 0xDA,
+    0x1A, 0xCA, 0x5D, 0x91, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xE2, 0xAC, 0xA3, 0x9D, 0xA2, 0xAD, 0x29,
+    0xE9, 0x3E, 0xAD, 0x9D, 0x49, 0xF9, 0x0D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x39, 0x94, 0xDA,
+    0x39, 0xFF, 0x5A, 0xFC, 0x95, 0x39, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x72, 0x9C,
+    0xA1, 0x9A, 0xA5, 0xAC, 0x99, 0xFC, 0x93, 0xDA, 0xCA, 0x99, 0xAD, 0x3E, 0x93, 0xD2, 0x9D, 0xA4,
+    0xD2, 0xAD, 0x49, 0xD2, 0xAC, 0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0x92, 0xD5, 0xD2, 0x9D, 0x5D, 0x2A,
+    0xCA, 0x49, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x5D, 0x92, 0xD5, 0xD2, 0x49, 0x4A, 0xCA, 0x3D, 0xA4,
+    0x97, 0x39, 0x93, 0xAC, 0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0x9C, 0xA3, 0xAC, 0xA3, 0xD9, 0x3D, 0x39,
+    0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x4D, 0x30, 0x70, 0x97, 0x0A, 0xCA, 0x7D, 0xA7, 0x09, 0x77, 0x39,
+    0x97, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0xD9, 0x7D, 0x79, 0xD7, 0xAC,
+    0xA7, 0xD9, 0x7D, 0x70, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x5F, 0x95, 0xE9, 0x50, 0x39,
+    0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x39, 0x99, 0x3A, 0xCA, 0x29,
+    0xD9, 0x3D, 0x91, 0x9D, 0x94, 0xD1, 0x9D, 0x94, 0x9D, 0x09, 0xD9, 0x5A, 0xCA, 0x9D, 0x96, 0xAC,
+    0xAD, 0xA7, 0xFD, 0x7D, 0xA0, 0xD9, 0x59, 0xD1, 0x9D, 0x5A, 0xCA, 0x2D, 0x94, 0xD9, 0x2A, 0xD4,
+    0xD4, 0xD9, 0x3D, 0x4A, 0xCA, 0x20, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0xAC,
+    0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0xAC, 0xA3, 0xAC, 0x93, 0xD9, 0x3D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9,
+    0x3D, 0x4D, 0x30, 0x39, 0x2A, 0xAA, 0x39, 0xAA, 0x94, 0xAC, 0x09, 0xFC, 0x1A, 0xFC, 0x3D, 0x9C,
+    0xA9, 0x9D, 0x9A, 0xC9, 0x09, 0xD9, 0x2E, 0x92, 0xAE, 0x3D, 0x91, 0x9D, 0xA3, 0xAD, 0x93, 0xD9,
+    0x19, 0xD4, 0xAD, 0x4D, 0x91, 0xAC, 0xA4, 0xD9, 0x4D, 0x2D, 0x94, 0xD4, 0x9D, 0x2D, 0x49, 0xD4,
+    0xAC, 0xA1, 0x9D, 0x4A, 0xCA, 0x4D, 0x91, 0xAC, 0xA4, 0xD9, 0x4D, 0x2D, 0x94, 0xD5, 0xD2, 0xD5,
+    0xD4, 0x9D, 0x2D, 0x49, 0xD4, 0xAC, 0xA1, 0x29, 0x92, 0xAA, 0xA9, 0x4A, 0xC9, 0x9F, 0xC9, 0x3D,
+    0xAD, 0x99, 0xE3, 0xEA, 0x29, 0xD2, 0x9D, 0xA3, 0x9D, 0x2A, 0xD4, 0x9D, 0x2D, 0xA4, 0xAC, 0xA2,
+    0xD9, 0x4D, 0xA2, 0xD5, 0xD9, 0x19, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D,
+    0x94, 0xD9, 0x19, 0xD5, 0xD2, 0x49, 0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9,
+    0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD,
+    0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x49,
+    0x29, 0xAA, 0x6A, 0xC0, 0x9F, 0xC5, 0xD9, 0xCA, 0x99, 0xE4, 0xE9, 0x3D, 0x39, 0xDA, 0x4D, 0x39,
+    0xD5, 0xD3, 0xAC, 0xA5, 0xD3, 0xD9, 0x49, 0xD3, 0xD5, 0xAD, 0x29, 0xD5, 0xD9, 0x2A, 0xD4, 0x9D,
+    0x3E, 0xA2, 0x9D, 0x93, 0xD9, 0xDA, 0xEA, 0x4D, 0x09, 0xF9, 0x49, 0xD7, 0x3A, 0xCA, 0x73, 0xD9,
+    0x73, 0xD7, 0x4D, 0x73, 0x9C, 0xA7, 0x30, 0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D,
+    0xA9, 0x9A, 0xCA, 0xC9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xD9,
+    0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D, 0x94, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29,
+    0xE9, 0x2E, 0xAD, 0x9D, 0x39, 0xF9, 0x0D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72,
+    0xD7, 0x19, 0xCA, 0x30, 0x39, 0x2A, 0xA9, 0x2A, 0xC0, 0x9E, 0x92, 0xD9, 0xCA, 0x99, 0x3E, 0x95,
+    0x9D, 0xA6, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x0D, 0x70,
+    0x39, 0xAA, 0xA9, 0x4F, 0xE2, 0xE9, 0x09, 0xAA, 0x2D, 0x79, 0xD7, 0x0D, 0xA7, 0x9E, 0x97, 0xEA,
+    0x79, 0xDA, 0x79, 0xD7, 0x0D, 0x19, 0x4A, 0xD1, 0xDA, 0xAA, 0xE9, 0x1A, 0xFD, 0x97, 0x50, 0x39,
+    0x69, 0xC6, 0xD5, 0xAD, 0x99, 0x90, 0xAF, 0xE1, 0x9D, 0xA9, 0x93, 0xD5, 0x9D, 0x5A, 0xCA, 0x5A,
+    0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5A, 0xCA, 0x59, 0xDA, 0xAA, 0x3A, 0xEA, 0x73, 0x19,
+    0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA, 0x49,
+    0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA, 0x39,
+    0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x99, 0x79, 0x9A,
+    0xC9, 0x5D, 0x9A, 0xCA, 0x49, 0xD0, 0x9C, 0xA4, 0xD9, 0x09, 0xD3, 0xAD, 0x2D, 0x3D, 0x3D, 0x2A,
+    0xCA, 0x3D, 0x2D, 0x4D, 0x1A, 0xCA, 0x4D, 0x90, 0xD5, 0xAC, 0x9A, 0xCA, 0x5A, 0xCA, 0xD6, 0x9E,
+    0x96, 0x9E, 0x60, 0x09, 0x59, 0x95, 0x99, 0x0A, 0xCA, 0x3A, 0xD9, 0x3A, 0xCA, 0x0A, 0xCA, 0x3E,
+    0x93, 0xD1, 0x9C, 0xA2, 0x9C, 0xAC, 0x92, 0xAC, 0xA1, 0x9C, 0xA2, 0xD9, 0xCA, 0x2D, 0x29, 0xCA,
+    0x19, 0xCA, 0x0C, 0xA1, 0x9D, 0x29, 0xCA, 0x1D, 0x1C, 0xA1, 0xD9, 0x29, 0xD0, 0x9C, 0xA1, 0xCA,
+    0x09, 0xD3, 0x9D, 0x0A, 0xC2, 0xCA, 0x0D, 0x94, 0xD0, 0xCA, 0x2D, 0x0D, 0x5D, 0xAC, 0x3D, 0xAC,
+    0x95, 0xEA, 0x3F, 0x6E, 0x93, 0xEA, 0x6E, 0x4E, 0x60, 0x29, 0x95, 0x99, 0x3A, 0xCA, 0x3A, 0xD4,
+    0xD2, 0x9D, 0x5A, 0xC9, 0x1D, 0x95, 0x9D, 0x0D, 0x97, 0xFA, 0x70, 0x9D, 0xA7, 0x19, 0xD9, 0x70,
+    0x9F, 0x70, 0xD0, 0xD7, 0xD9, 0x0A, 0xCA, 0x5D, 0xA2, 0xD4, 0xAD, 0x3A, 0xCA, 0x2A, 0xD5, 0xD2,
+    0x39, 0x97, 0x99, 0x3A, 0xCA, 0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0xD9, 0x5D, 0x3A, 0xD6,
+    0xD3, 0xD7, 0xD2, 0xAC, 0xA7, 0xD9, 0x1D, 0x70, 0xAC, 0x90, 0xAC, 0xA7, 0x09, 0xC9, 0x0D, 0x71,
+    0x9C, 0xAA, 0xC9, 0x72, 0xCA, 0xD7, 0x3E, 0x97, 0x3E, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD7, 0x4D,
+    0xA7, 0x09, 0xFC, 0x71, 0x9E, 0xA7, 0x20, 0x39, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xF3, 0x99, 0x99,
+    0x9D, 0x97, 0xDA, 0x7A, 0xD7, 0x9D, 0x70, 0xD9, 0x7D, 0x97, 0xDA, 0x7A, 0xD7, 0x9D, 0x79, 0xD7,
+    0x0E, 0xAA, 0xAA, 0xAA, 0x19, 0xFF, 0xA1, 0x6A, 0xD5, 0xEA, 0x4A, 0xCA, 0x6D, 0x7D, 0x69, 0xCA,
+    0x6A, 0xC9, 0x6D, 0x7D, 0x59, 0xD9, 0x39, 0xE9, 0x4A, 0xDA, 0x7A, 0xCA, 0x7D, 0x69, 0xCA, 0x69,
+    0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x7D, 0x7E, 0xA6, 0xAC, 0xA3, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9,
+    0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC,
+    0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x92,
+    0x3A, 0xCA, 0x6F, 0x69, 0xD7, 0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7, 0xD7, 0xAC, 0x97, 0xE9,
+    0x49, 0xAD, 0x93, 0x9D, 0x95, 0xD7, 0xD6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7, 0xD6, 0xAC, 0xA4, 0xF5,
+    0xDA, 0x60, 0x19, 0x99, 0x70, 0xFD, 0x92, 0xAA, 0x9C, 0xA9, 0x9A, 0xFD, 0x96, 0xAA, 0xCA, 0x90,
+    0x4A, 0x94, 0xE4, 0xE4, 0x9A, 0x97, 0x49, 0x6C, 0x94, 0x9C, 0x94, 0xAC, 0x5D, 0x5D, 0x49, 0xCA,
+    0x4A, 0xC9, 0x4D, 0x94, 0xD4, 0x9D, 0x4A, 0xD4, 0xDA, 0x4A, 0xA9, 0x30, 0x77, 0x2C, 0xA7, 0x1C,
+    0x97, 0xAF, 0xA3, 0x9F, 0xDA, 0x29, 0xDA, 0x7D, 0xA7, 0xAD, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7,
+    0x09, 0xD7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x2A, 0x4F, 0xE5, 0x9E, 0xA9, 0x6C, 0x97, 0x09,
+    0xC9, 0x71, 0x96, 0x77, 0x79, 0xFC, 0x97, 0xAF, 0xE6, 0x9D, 0x93, 0x96, 0xD9, 0x74, 0xD7, 0x49,
+    0xD7, 0x49, 0xCA, 0x74, 0xAC, 0xA7, 0x2A, 0xAD, 0xAA, 0xAA, 0x95, 0xAF, 0xFA, 0x79, 0xD7, 0x4A,
+    0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x4A, 0xCA, 0x73, 0xAC, 0xA7, 0x3F, 0xFE, 0xA3, 0xFF, 0xEA, 0x20,
+    0x72, 0xAC, 0x19, 0x99, 0x1C, 0x9A, 0xFF, 0xC1, 0xAD, 0x90, 0x9D, 0x91, 0xD4, 0xCA, 0x1C, 0xA4,
+    0xAC, 0x1C, 0x94, 0xAC, 0x1D, 0x4D, 0x1A, 0xCA, 0x2D, 0x91, 0xFF, 0xC0, 0xAC, 0x09, 0xAC, 0xA0,
+    0xAC, 0x97, 0x09, 0x00, 0x1D, 0x7D, 0x2D, 0x95, 0xD9, 0x2A, 0xCA, 0x4A, 0xD4, 0xD4, 0xD5, 0xD3,
+    0xD9, 0x5A, 0xC9, 0x1A, 0xCA, 0x69, 0xCA, 0x1D, 0x70, 0xD0, 0xD9, 0x70, 0xDA, 0xCA, 0x79, 0x9F,
+    0xA9, 0x94, 0xAF, 0xFA, 0x79, 0xD7, 0x39, 0xCA, 0x70, 0xFF, 0xC4, 0x9F, 0xFA, 0x70, 0xD7, 0x39,
+    0xCA, 0x73, 0xAC, 0x97, 0x00, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A,
+    0xC9, 0xAC, 0x99, 0xA7, 0x79, 0xA0, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC,
+    0x9A, 0xC9, 0xAC, 0x92, 0x77, 0x1A, 0xFC, 0xA4, 0xEA, 0xAA, 0xD3, 0x9D, 0x71, 0x9C, 0xA7, 0x2D,
+    0x97, 0x1A, 0xE9, 0x7F, 0xCA, 0x5D, 0x19, 0xDA, 0x3A, 0xC4, 0xD3, 0xD4, 0xD3, 0xD9, 0x29, 0xCA,
+    0x39, 0xDA, 0x1D, 0x59, 0xFA, 0x70, 0x9E, 0x72, 0xDA, 0x71, 0x9C, 0xA7, 0x1D, 0x92, 0x9D, 0xAA,
+    0xAE, 0x4A, 0xFC, 0x97, 0x71, 0x79, 0xD1, 0xD9, 0x9C, 0xA1, 0xD7, 0x00, 0x77, 0x79, 0xAF, 0xCA,
+    0x71, 0xDA, 0x99, 0x09, 0xAD, 0xA6, 0xD7, 0x9D, 0x4C, 0xA3, 0x99, 0x99, 0x2D, 0x2A, 0xC2, 0x9F,
+    0xCA, 0x19, 0xC9, 0x1C, 0x92, 0xD9, 0x19, 0x92, 0xAC, 0x09, 0xC2, 0xAC, 0x97, 0x9C, 0x0A, 0xC2,
+    0xD7, 0x1C, 0x9C, 0xA2, 0xD7, 0x1C, 0xAC, 0xA2, 0xD7, 0x1C, 0xAA, 0xC2, 0xD7, 0x1C, 0x99, 0xC2,
+    0xD9, 0x70, 0xC9, 0x0C, 0x91, 0x9D, 0x7A, 0xC1, 0xAC, 0x2A, 0xFC, 0xA2, 0xCA, 0x2C, 0xA3, 0xAA,
+    0xA9, 0x2D, 0x39, 0xCA, 0x70, 0xD5, 0x9D, 0xA9, 0x29, 0xAD, 0x70, 0x9F, 0xE9, 0x77, 0x70, 0x71,
+    0xAD, 0x9A, 0x90, 0xAC, 0x99, 0xD9, 0x9C, 0x91, 0xAC, 0x0A, 0xC2, 0xAC, 0x0C, 0xA2, 0xCA, 0x0C,
+    0xA2, 0xC9, 0x0D, 0x1D, 0x90, 0x9E, 0x9C, 0x29, 0x91, 0x91, 0x39, 0x39, 0x39, 0xCA, 0x1A, 0xC9,
+    0x19, 0xD1, 0x9C, 0xA1, 0xAD, 0x19, 0xD1, 0xAD, 0x19, 0xD2, 0xD9, 0x1D, 0x92, 0x9D, 0x1A, 0xCA,
+    0x3D, 0x91, 0xD3, 0x9C, 0xA1, 0xAC, 0x93, 0xD2, 0xD4, 0x92, 0x99, 0x10, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x72,
+    0xC9, 0x0A, 0xAA, 0xAA, 0xA0, 0xFC, 0xA0, 0x99, 0x99, 0x90, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xDA,
+    0x99, 0x09, 0xAD, 0xA6, 0xD7, 0x9D, 0x4C, 0xA1, 0x99, 0x99, 0x93, 0xD2, 0xAC, 0x2F, 0xD9, 0x19,
+    0xC9, 0x1C, 0x92, 0xD0, 0x9A, 0xD2, 0xAC, 0x09, 0xC3, 0xD2, 0xD2, 0x9C, 0x0A, 0xC3, 0xD2, 0xD3,
+    0xC9, 0xCA, 0x3D, 0x99, 0xAC, 0xA3, 0xCA, 0xCA, 0x3F, 0xCA, 0x4C, 0xAA, 0xC3, 0xD0, 0x9C, 0xA4,
+    0xC9, 0x9C, 0x3D, 0x1D, 0x93, 0xC9, 0x0C, 0x92, 0xD1, 0x9D, 0x2A, 0xC1, 0xAC, 0x2D, 0x2A, 0xC9,
+    0x1C, 0xA2, 0xCA, 0x1A, 0x93, 0xA9, 0x0D, 0x39, 0xCA, 0x70, 0xD5, 0x9D, 0xA9, 0x29, 0xAD, 0x70,
+    0x9F, 0xE9, 0x77, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xCA, 0x72, 0xAE, 0xA2, 0xD9,
+    0x9A, 0xCA, 0x09, 0xC9, 0x2A, 0xC0, 0xAC, 0x39, 0xC9, 0xAC, 0x39, 0xC9, 0x0C, 0xA2, 0xD1, 0x9F,
+    0xC9, 0x39, 0xA9, 0x20, 0x49, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA,
+    0x5F, 0xFE, 0x99, 0xFF, 0xEA, 0x49, 0xCA, 0x71, 0x9C, 0xA7, 0x19, 0xCA, 0x71, 0x9C, 0xA7, 0x19,
+    0xCA, 0x77, 0x2F, 0xFE, 0x99, 0xFF, 0xEA, 0x49, 0x94, 0xAF, 0x92, 0xC9, 0x09, 0xD6, 0xD6, 0xCA,
+    0x5A, 0xC5, 0xAC, 0x94, 0xAC, 0x94, 0xD5, 0xD5, 0xFE, 0x1A, 0xAA, 0xAA, 0xA9, 0x00, 0x39, 0x93,
+    0xFC, 0x91, 0xA9, 0x09, 0xD5, 0xD5, 0xCA, 0x19, 0xAD, 0xA2, 0xAA, 0xD9, 0x5D, 0x5A, 0xC0, 0x93,
+    0xD0, 0xDA, 0xAD, 0x90, 0x9A, 0xDA, 0x20, 0x71, 0xE2, 0x9D, 0x29, 0xD3, 0xCA, 0x30, 0x49, 0x95,
+    0x99, 0x3A, 0xCA, 0x49, 0xCA, 0x3D, 0x94, 0xAC, 0xA3, 0xD5, 0xD9, 0x29, 0xD5, 0xD3, 0x9C, 0xA4,
+    0x9D, 0x3A, 0xCA, 0x4A, 0xCA, 0x3D, 0x94, 0xD9, 0x3D, 0x5D, 0x39, 0xD4, 0xAD, 0x3A, 0xD3, 0x9E,
+    0x3E, 0x29, 0xEA, 0x3F, 0xAD, 0xAA, 0xC9, 0x3D, 0xAE, 0x90, 0xAC, 0x39, 0xCA, 0x73, 0xAC, 0xA7,
+    0x3D, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x73, 0x2A, 0xFF, 0xA1, 0xFF, 0xDA, 0x0F, 0xEA, 0x1A,
+    0xA9, 0xFE, 0xA1, 0xAA, 0xAF, 0xEA, 0x1A, 0xAA, 0xFE, 0xA1, 0xAA, 0xAF, 0xEA, 0x1A, 0xAA, 0xFE,
+    0xA1, 0xAA, 0x9F, 0xEA, 0x1A, 0xA0, 0xFE, 0xA1, 0xAA, 0x0A, 0xFD, 0xA1, 0xAA, 0x1A, 0xFC, 0xA1,
+    0xAA, 0x39, 0x99, 0xCA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA,
+    0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A, 0xA6, 0xAA, 0x1A,
+    0xA7, 0x40, 0x39, 0xD0, 0xE0, 0xE1, 0x91, 0x2C, 0xA2, 0x9C, 0x93, 0xAC, 0x93, 0xCA, 0x09, 0x9D,
+    0x90, 0xE9, 0x00, 0x70, 0xAC, 0xA0, 0x9E, 0x90, 0xCA, 0xAC, 0x92, 0xAC, 0x3D, 0x3C, 0xA2, 0x9C,
+    0x92, 0xAC, 0x3D, 0x3D, 0x3A, 0x91, 0x71, 0xAE, 0x2A, 0xC9, 0x9D, 0x09, 0xC9, 0x19, 0xC0, 0xAC,
+    0x3C, 0x9C, 0xA2, 0x9C, 0x0C, 0xA2, 0xAC, 0x0A, 0xC1, 0x9C, 0x91, 0xFA, 0x39, 0x93, 0x19, 0x92,
+    0xA4, 0xD2, 0xCA, 0x39, 0xCA, 0x1A, 0xC9, 0x3D, 0x19, 0xD3, 0xAC, 0xA1, 0xD9, 0x2A, 0xD1, 0xAD,
+    0x19, 0xD1, 0x9D, 0x91, 0xD2, 0xD9, 0x1D, 0x91, 0xD9, 0x1A, 0xC9, 0x1D, 0x93, 0x93, 0x93, 0x77,
+    0x29, 0xD6, 0xAC, 0x2E, 0xA5, 0xAC, 0x91, 0xD9, 0xC9, 0x49, 0xCA, 0x4A, 0xC9, 0x4D, 0x5A, 0xC4,
+    0xD6, 0xD3, 0xAC, 0x96, 0xCA, 0x29, 0xCA, 0x69, 0xC9, 0x2D, 0x2D, 0x2A, 0xC2, 0xD2, 0xE2, 0xD1,
+    0xAC, 0x91, 0xAE, 0x2A, 0xA0, 0x9C, 0xA1, 0x9C, 0x9C, 0xA5, 0xD1, 0x9C, 0x99, 0xC9, 0x4D, 0x2C,
+    0xA0, 0xAC, 0x4A, 0xC9, 0x1D, 0x99, 0xD9, 0x29, 0xCA, 0x19, 0xFE, 0x91, 0xD6, 0x9C, 0xA2, 0xAC,
+    0x79, 0xC9, 0x19, 0xC9, 0x79, 0xA2, 0x77, 0x49, 0xD6, 0xAC, 0x4E, 0xA5, 0xAC, 0x93, 0xD9, 0xC9,
+    0x49, 0xCA, 0x6A, 0xC9, 0x4D, 0x7A, 0xC4, 0xD7, 0x0D, 0x3A, 0xC9, 0x70, 0xCA, 0x29, 0xCA, 0x19,
+    0x94, 0x9C, 0x92, 0xD0, 0xAF, 0x92, 0xAC, 0x2A, 0xC1, 0xC9, 0x09, 0xD2, 0xD1, 0x9C, 0x95, 0xAC,
+    0x2A, 0xA1, 0xCA, 0x6D, 0x5D, 0x6A, 0xC9, 0x4A, 0xC9, 0x5A, 0xCA, 0x49, 0xCA, 0x5A, 0xC9, 0x5D,
+    0x5A, 0xC9, 0x5D, 0x5D, 0x6A, 0xC9, 0x4F, 0xE1, 0x9C, 0xA5, 0xAA, 0xAA, 0xAA, 0xA1, 0x39, 0x97,
+    0x5A, 0xFA, 0x69, 0xCA, 0x1A, 0x91, 0xD6, 0xD6, 0xAC, 0x5A, 0xC7, 0xD4, 0x9C, 0x94, 0xAA, 0xCA,
+    0x5C, 0xA4, 0x9A, 0xDA, 0x4D, 0x70, 0xAC, 0x92, 0xAC, 0x97, 0x09, 0xC9, 0x19, 0xCA, 0x19, 0xD4,
+    0xAC, 0x91, 0xD1, 0x9D, 0xAA, 0xDA, 0xDA, 0x1D, 0x2E, 0x90, 0xAA, 0xCA, 0x91, 0xAC, 0x91, 0xCA,
+    0xAC, 0x79, 0xCA, 0x1D, 0x0D, 0x7D, 0x1A, 0xC1, 0xCA, 0x6D, 0x19, 0xCA, 0x99, 0xCA, 0x94, 0xAC,
+    0x91, 0xFF, 0x39, 0xCA, 0x6A, 0xC5, 0xD7, 0xD4, 0xD7, 0x0A, 0x91, 0x69, 0xA9, 0x6E, 0x6D, 0xA6,
+    0xAA, 0x77, 0x19, 0x79, 0xC9, 0x6D, 0x6A, 0xCA, 0x5E, 0x49, 0xDA, 0x49, 0xD9, 0x5D, 0x95, 0x9D,
+    0x6A, 0xCA, 0x69, 0xD6, 0x9D, 0xA1, 0x9A, 0xC1, 0xAF, 0xE2, 0x9A, 0xDA, 0x91, 0x77, 0x7A, 0xCA,
+    0x74, 0xD7, 0x49, 0xCA, 0x74, 0x9C, 0x77, 0x72, 0xDA, 0x72, 0x9E, 0x72, 0xF7, 0x1A, 0xCA, 0xD7,
+    0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA, 0x1A, 0xCA, 0x59, 0xD2, 0x9C,
+    0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0xAA, 0xAA, 0xAD, 0x4F, 0xFD, 0x39, 0xD9, 0x99, 0x99, 0x9D, 0x3D,
+    0x95, 0xD9, 0x1A, 0xD6, 0xD9, 0x1D, 0x96, 0xAC, 0xA0, 0xAD, 0x7A, 0xCA, 0x0D, 0x97, 0x9D, 0x77,
+    0x74, 0xD9, 0x73, 0xD9, 0x73, 0xAC, 0x97, 0x39, 0xC9, 0x77, 0x74, 0xDA, 0x73, 0x9E, 0x73, 0xF7,
+    0x2A, 0xCA, 0xD7, 0x2D, 0x0D, 0x71, 0xAC, 0xA0, 0xD9, 0x70, 0xD1, 0xAC, 0x97, 0xAC, 0xA1, 0xAC,
+    0xA6, 0x9D, 0x29, 0xCA, 0x6D, 0xA2, 0x9D, 0x59, 0xDA, 0xAA, 0xAA, 0xD5, 0xFF, 0xD4, 0x9D, 0x99,
+    0x99, 0x99, 0xD4, 0xD9, 0x5D, 0x92, 0xAD, 0x6D, 0x92, 0xD9, 0x6A, 0xCA, 0x1A, 0xD7, 0xAC, 0xA1,
+    0xD9, 0x79, 0xD0, 0x77, 0x71, 0x9D, 0xA7, 0x29, 0xF7, 0x19, 0xD1, 0xCA, 0x70, 0xCA, 0x29, 0xC7,
+    0x77, 0x2D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97,
+    0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA,
+    0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D,
+    0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D, 0x00, 0x71, 0x93, 0x97, 0x09, 0xEA, 0x1C,
+    0x97, 0xCA, 0xAF, 0xC7, 0x9C, 0x29, 0xCA, 0x77, 0x74, 0xDA, 0x74, 0x9E, 0x74, 0xF7, 0x3A, 0xCA,
+    0xD7, 0x3D, 0x0D, 0x72, 0xAC, 0xA0, 0xD9, 0x71, 0xD1, 0xAC, 0x97, 0x0A, 0xCA, 0x1A, 0xCA, 0x79,
+    0xD2, 0x9C, 0xA7, 0xDA, 0x29, 0xD6, 0x9D, 0xAA, 0xAA, 0xAD, 0x6F, 0xFD, 0x59, 0xD9, 0x99, 0x99,
+    0x9D, 0x5D, 0x95, 0xD9, 0x3A, 0xD6, 0xD9, 0x3D, 0x96, 0xAC, 0xA2, 0xAD, 0x7A, 0xCA, 0x2D, 0x97,
+    0x9D, 0x10, 0x77, 0x70, 0xD1, 0xAC, 0x97, 0x9D, 0x1D, 0x97, 0x77, 0x77, 0x1D, 0xA7, 0x39, 0xE7,
+    0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA,
+    0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49,
+    0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A,
+    0xCA, 0x1D, 0x97, 0x9D, 0x00, 0x72, 0x99, 0x73, 0xF7, 0x1A, 0xA1, 0xCA, 0x70, 0xCA, 0x1A, 0xA7,
+    0x09, 0xC9, 0xAC, 0x97, 0x1A, 0xD9, 0x77, 0x71, 0xDA, 0x72, 0x9E, 0x72, 0xF7, 0x1A, 0xCA, 0xD7,
+    0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA, 0x1A, 0xCA, 0x59, 0xD2, 0x9C,
+    0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0xAA, 0xAA, 0xAD, 0x4F, 0xFD, 0x39, 0xD9, 0x99, 0x99, 0x9D, 0x3D,
+    0x95, 0xD9, 0x1A, 0xD6, 0xD9, 0x1D, 0x96, 0xAC, 0xA0, 0xAD, 0x7A, 0xCA, 0x0D, 0x97, 0x9D, 0x72,
+    0x9F, 0xFE, 0x97, 0x2F, 0xFF, 0x97, 0x1A, 0xD0, 0xD9, 0x77, 0x0D, 0x1D, 0x77, 0x0D, 0xA0, 0x9D,
+    0x77, 0x9D, 0x1A, 0xCA, 0x77, 0xD9, 0x1D, 0x97, 0x6A, 0xCA, 0x2D, 0x99, 0x99, 0x99, 0x70, 0x9D,
+    0x29, 0xFF, 0x97, 0xD9, 0x29, 0xDA, 0xAA, 0xAA, 0xA7, 0xAD, 0xAA, 0xAA, 0xDA, 0x74, 0x9F, 0xFC,
+    0x97, 0x4D, 0xA9, 0x99, 0x9A, 0xD7, 0x4A, 0xD4, 0x9D, 0x74, 0xD9, 0x4A, 0xD7, 0x3D, 0xA5, 0xAC,
+    0xA7, 0x29, 0xD6, 0xFF, 0xC4, 0xD9, 0x6F, 0xFC, 0x30, 0x77, 0x5A, 0xFC, 0xA5, 0xAF, 0xFA, 0x3E,
+    0xA4, 0xA3, 0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0x97, 0x3D, 0x97,
+    0x3D, 0x74, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7, 0x4E, 0x73, 0x9F, 0xAE, 0xA5, 0x9F, 0xE9,
+    0x70, 0xC9, 0x73, 0xAC, 0x97, 0x39, 0xD9, 0x73, 0x9C, 0x97, 0x19, 0x9D, 0x71, 0x9E, 0x96, 0x77,
+    0x2D, 0xA7, 0x2D, 0x72, 0x9C, 0x97, 0x2A, 0xC7, 0x73, 0xFF, 0xA2, 0x9F, 0xFA, 0x2A, 0xCA, 0x71,
+    0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xDA, 0x99, 0x99, 0x94, 0xFF, 0xA3, 0xDA, 0xAA,
+    0xAA, 0xA9, 0x29, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0xAF, 0xF9,
+    0x2F, 0xFC, 0x30, 0x77, 0x59, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0x9C, 0x77, 0x4F, 0xFA, 0x29,
+    0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99,
+    0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7,
+    0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x77, 0x39, 0xD9, 0x79, 0xF6, 0x9C, 0xA0, 0x9C, 0xA4,
+    0x9C, 0x92, 0x9C, 0x77, 0x1F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D,
+    0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71,
+    0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x77, 0x19,
+    0xCA, 0x1D, 0x59, 0xCA, 0x1D, 0x77, 0x76, 0xFF, 0xA2, 0x9F, 0xFA, 0x2A, 0xCA, 0x71, 0xD9, 0x71,
+    0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xDA, 0x99, 0x99, 0x94, 0xFF, 0xA3, 0xDA, 0xAA, 0xAA, 0xA9,
+    0x29, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0xAF, 0xF9, 0x2F, 0xFC,
+    0x30, 0x77, 0xAC, 0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x09, 0xC7, 0x70, 0xAF, 0xC9, 0x39, 0xFA, 0x6D,
+    0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0x9C, 0xA7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7,
+    0xAC, 0xA7, 0xD9, 0x7D, 0x69, 0xAD, 0xA9, 0x39, 0xFD, 0x30, 0x77, 0x4D, 0x97, 0xD9, 0x7A, 0xC9,
+    0x79, 0xC9, 0x77, 0x2A, 0xFC, 0x94, 0x9F, 0xA7, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70,
+    0xD7, 0x09, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7,
+    0x0D, 0x97, 0x0D, 0x79, 0xAD, 0xA9, 0x49, 0xFD, 0x40, 0x77, 0x19, 0xDA, 0x7F, 0x59, 0xD1, 0xD4,
+    0xCA, 0x29, 0xC9, 0x77, 0xAF, 0xC9, 0x49, 0xFA, 0x7D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97,
+    0x0D, 0x70, 0x9D, 0x70, 0x9C, 0xA7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA,
+    0x70, 0xD9, 0x70, 0xD7, 0x9A, 0xDA, 0x94, 0x9F, 0xD4, 0x77, 0x0D, 0x1A, 0xC9, 0x39, 0xD1, 0xD9,
+    0x77, 0x73, 0xAF, 0xC9, 0x49, 0xFA, 0x7D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70,
+    0x9D, 0x70, 0x9C, 0xA7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9,
+    0x70, 0xD7, 0x9A, 0xDA, 0x94, 0x9F, 0xD4, 0x4F, 0xCA, 0xA7, 0x9F, 0xFA, 0x5A, 0xCA, 0x29, 0xEA,
+    0x4D, 0x94, 0xAD, 0x4D, 0x6D, 0xA2, 0x9D, 0x6A, 0xD2, 0xAC, 0xA6, 0x9D, 0x2D, 0x96, 0x9D, 0x0A,
+    0xFE, 0x3A, 0xD0, 0xFF, 0x3A, 0xCA, 0x19, 0xD7, 0xDA, 0x1A, 0xCA, 0x69, 0xD2, 0xD9, 0x6E, 0x2D,
+    0x6A, 0xD9, 0x2D, 0x5A, 0xDA, 0x29, 0xD3, 0x9E, 0xA3, 0xAF, 0xFC, 0x94, 0xFE, 0xA9, 0x50, 0x70,
+    0x93, 0x97, 0x09, 0xEA, 0x1C, 0x97, 0xCA, 0xAF, 0xC7, 0x9C, 0x2A, 0xCA, 0x77, 0x69, 0xD9, 0x69,
+    0xCA, 0x2A, 0xDA, 0x6A, 0xCA, 0x2A, 0xE6, 0xD9, 0x2F, 0x95, 0xD3, 0xD9, 0xD4, 0x9D, 0x29, 0xCA,
+    0x0D, 0x49, 0xCA, 0x2A, 0xCA, 0x0A, 0xCA, 0x3A, 0xC9, 0x2D, 0x90, 0x9D, 0x3D, 0x92, 0xD2, 0xD9,
+    0x2D, 0x3D, 0x2A, 0xCA, 0x19, 0xD2, 0x9C, 0xA3, 0xD1, 0xAC, 0xA2, 0xAC, 0x93, 0xD9, 0x0A, 0xC9,
+    0x2D, 0x93, 0x9C, 0xA0, 0xD3, 0xD5, 0xD0, 0xD2, 0x9D, 0x5A, 0xCA, 0xD2, 0x9C, 0xA5, 0x9E, 0xA2,
+    0xAC, 0x96, 0xE9, 0x2D, 0x7A, 0xD3, 0x77, 0x70, 0xAC, 0xA7, 0x6D, 0x76, 0x9C, 0xA7, 0x69, 0xC7,
+    0x77, 0x39, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9,
+    0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7,
+    0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD,
+    0x94, 0x9F, 0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x60, 0x77, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xAC, 0x97,
+    0x49, 0xC9, 0x77, 0x73, 0x9F, 0xCA, 0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4, 0xE6, 0xDA, 0x2A, 0xD7,
+    0xAD, 0x2D, 0x97, 0x0D, 0x19, 0xD7, 0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9, 0x71, 0xD1, 0xD9, 0x70,
+    0x9D, 0x1D, 0x71, 0xAD, 0x1D, 0x71, 0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD,
+    0x4E, 0x4A, 0xD9, 0x49, 0xFA, 0xF9, 0x7A, 0xFC, 0xA7, 0x76, 0x77, 0x71, 0x9D, 0xA7, 0x39, 0xF7,
+    0x29, 0xD1, 0xCA, 0x71, 0xCA, 0x29, 0xC7, 0x77, 0x19, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E,
+    0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D,
+    0x97, 0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D,
+    0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x60, 0x70,
+    0x93, 0x97, 0x09, 0xEA, 0x1C, 0x97, 0xCA, 0xAF, 0xC7, 0x9C, 0x29, 0xCA, 0x77, 0x71, 0x9F, 0xCA,
+    0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4, 0xE6, 0xDA, 0x2A, 0xD7, 0xAD, 0x2D, 0x97, 0x0D, 0x19, 0xD7,
+    0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9, 0x71, 0xD1, 0xD9, 0x70, 0x9D, 0x1D, 0x71, 0xAD, 0x1D, 0x71,
+    0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD, 0x4E, 0x4A, 0xD9, 0x49, 0xFA, 0xF9,
+    0x7A, 0xFC, 0xA7, 0x76, 0x77, 0x70, 0xD1, 0xAC, 0xA7, 0x1D, 0x1A, 0xC9, 0x77, 0x77, 0x71, 0x9F,
+    0xCA, 0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4, 0xE6, 0xDA, 0x2A, 0xD7, 0xAD, 0x2D, 0x97, 0x0D, 0x19,
+    0xD7, 0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9, 0x71, 0xD1, 0xD9, 0x70, 0x9D, 0x1D, 0x71, 0xAD, 0x1D,
+    0x71, 0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD, 0x4E, 0x4A, 0xD9, 0x49, 0xFA,
+    0xF9, 0x7A, 0xFC, 0xA7, 0x76, 0x73, 0x9C, 0x95, 0xCA, 0x09, 0xD9, 0x3D, 0xA1, 0x9D, 0x91, 0xDA,
+    0x39, 0xD9, 0xDA, 0x59, 0xEA, 0x7E, 0x96, 0xDA, 0xD9, 0x4D, 0xA0, 0x9D, 0x92, 0xDA, 0x29, 0xD9,
+    0x0A, 0xCA, 0x49, 0xD1, 0x96, 0x91, 0x76, 0xA6, 0x9F, 0xCA, 0x0A, 0xCA, 0x4F, 0xFE, 0x4E, 0x93,
+    0xE4, 0xE5, 0xEA, 0x2A, 0xD5, 0xFC, 0x2D, 0x94, 0xAC, 0xA0, 0xD1, 0x9D, 0x49, 0xD1, 0xD1, 0xAC,
+    0xA3, 0x9D, 0x2D, 0x1D, 0x93, 0xD9, 0x2D, 0x1D, 0x92, 0xD9, 0x29, 0xD1, 0xD2, 0xAC, 0xA3, 0xAD,
+    0x1D, 0x19, 0xD4, 0xDA, 0x1D, 0x99, 0xD4, 0x9D, 0x91, 0xDA, 0xD9, 0x4E, 0x2A, 0xE9, 0x4A, 0xD4,
+    0xE4, 0xAD, 0x93, 0x9F, 0xCA, 0xF9, 0x39, 0xD9, 0xAF, 0xCA, 0x6A, 0x97, 0x77, 0x60, 0x77, 0x70,
+    0xD7, 0x6A, 0xCA, 0x76, 0xD7, 0x7C, 0x97, 0x77, 0x09, 0xCA, 0x7D, 0x3A, 0xCA, 0x69, 0xD3, 0xD9,
+    0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x7A,
+    0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x96, 0xAC, 0xA3,
+    0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9, 0x7A, 0xFD, 0x97, 0x76, 0x77,
+    0x73, 0xAD, 0x74, 0x9D, 0x75, 0xD7, 0x5C, 0xA7, 0x77, 0x19, 0xCA, 0x7D, 0x3A, 0xCA, 0x69, 0xD3,
+    0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D,
+    0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x96, 0xAC,
+    0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9, 0x7A, 0xFD, 0x97, 0x76,
+    0x77, 0x71, 0xE7, 0x4A, 0xEA, 0x72, 0xAC, 0x90, 0xD7, 0x1A, 0xC3, 0xAA, 0x77, 0x69, 0xCA, 0x7D,
+    0x3A, 0xCA, 0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D,
+    0x3D, 0x96, 0x9D, 0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96,
+    0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9,
+    0x7A, 0xFD, 0x97, 0x76, 0x77, 0x7A, 0xC9, 0x1D, 0x71, 0xAC, 0x91, 0xD7, 0x77, 0x77, 0x9C, 0xA7,
+    0xD3, 0xAC, 0xA6, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xAC, 0x92, 0x9D, 0x7D, 0x92, 0xAC, 0xA7,
+    0xD3, 0xD9, 0x69, 0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x29, 0xD7, 0xD3, 0xAC, 0xA7, 0xD3, 0xD9,
+    0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7D, 0x93, 0xD9, 0x5A, 0xD4, 0xAD, 0x4A, 0xD9, 0x5F, 0xAF,
+    0x97, 0xAF, 0xD9, 0x77, 0x60, 0x77, 0x5D, 0xA7, 0x1A, 0xD7, 0x19, 0xCA, 0x72, 0xCA, 0x77, 0x3A,
+    0xCA, 0x6A, 0xCA, 0x09, 0xD5, 0x9D, 0x2D, 0x5D, 0x92, 0xD9, 0x3A, 0xCA, 0x3A, 0xCA, 0x29, 0xD4,
+    0x9D, 0x2D, 0x95, 0xD1, 0xAC, 0xA6, 0xD9, 0x9D, 0x7A, 0xCA, 0xD9, 0x79, 0xEA, 0x71, 0xE7, 0x2D,
+    0x97, 0x2D, 0x72, 0x9D, 0x72, 0x9C, 0xA7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x10, 0x3D, 0x71,
+    0x9C, 0xA7, 0x1A, 0xCA, 0x71, 0xFA, 0xA9, 0x5F, 0xF9, 0x29, 0xD2, 0x9E, 0x2A, 0xCA, 0x4D, 0x91,
+    0xD9, 0x4D, 0xA1, 0xD5, 0xDA, 0x1D, 0x5D, 0x90, 0x9D, 0x4A, 0xD1, 0xAC, 0xA3, 0xAD, 0x91, 0xFF,
+    0xCA, 0x2F, 0xEA, 0x4D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x10, 0x77, 0x73, 0x9F, 0xC9,
+    0x71, 0xAE, 0xAE, 0x97, 0x9D, 0x3A, 0xCA, 0x7D, 0x93, 0x9D, 0x7D, 0x4D, 0xA6, 0x9D, 0x3A, 0xD7,
+    0xAC, 0xA2, 0xE7, 0x0D, 0x91, 0xDA, 0x71, 0xD1, 0xAC, 0xA7, 0x19, 0xD1, 0xD9, 0x71, 0xAC, 0xA1,
+    0xAD, 0x71, 0xAC, 0x92, 0xE9, 0x7D, 0x93, 0xAD, 0x7D, 0x5E, 0x59, 0xD5, 0x9D, 0x5A, 0xCA, 0x59,
+    0xD5, 0xD9, 0x5D, 0xA5, 0xD0, 0x9C, 0xAA, 0xAE, 0x6D, 0x1F, 0xCA, 0x69, 0xD7, 0x6A, 0xCA, 0x76,
+    0xD9, 0x75, 0x9D, 0x74, 0xF9, 0x74, 0xE9, 0x74, 0x77, 0x1A, 0xD7, 0x2D, 0x73, 0xCA, 0x72, 0x9C,
+    0x77, 0x59, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1,
+    0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49,
+    0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9,
+    0x0D, 0x77, 0x77, 0x5D, 0xA7, 0x0D, 0xA7, 0x0A, 0xCA, 0x71, 0xC9, 0x77, 0x59, 0xAA, 0x29, 0x92,
+    0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A,
+    0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x77, 0x3D, 0xA7,
+    0x0F, 0x96, 0xD1, 0xD5, 0xCA, 0x29, 0xC9, 0x77, 0x29, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1,
+    0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC,
+    0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2,
+    0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x59, 0x49, 0x39, 0xEA, 0x1C, 0x93, 0xD9,
+    0xFC, 0x4C, 0x29, 0xCA, 0x77, 0x39, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A,
+    0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5,
+    0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA,
+    0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x77, 0x1D, 0x1A, 0xCA, 0x5D, 0x1A, 0xC9, 0x77, 0x77, 0x9A,
+    0xA2, 0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9, 0x3E, 0x1A, 0xD4, 0xAD,
+    0x1D, 0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D, 0x94,
+    0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3, 0x9F, 0x90, 0xD7, 0x70,
+    0x69, 0x97, 0x1F, 0x7A, 0xC1, 0xCA, 0x6A, 0xA1, 0xAA, 0x69, 0xCA, 0xAC, 0x97, 0x9D, 0x97, 0x74,
+    0x9A, 0xA2, 0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9, 0x3E, 0x1A, 0xD4,
+    0xAD, 0x1D, 0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D,
+    0x94, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3, 0x9F, 0x90, 0xD7,
+    0x70, 0x4A, 0xAA, 0x29, 0x1A, 0xAA, 0x49, 0xFC, 0x0D, 0xAF, 0xC9, 0x19, 0xDA, 0x99, 0xCA, 0xEA,
+    0x90, 0xAD, 0x1D, 0x92, 0x9E, 0xA2, 0x9D, 0x0A, 0xCA, 0x4E, 0x39, 0xD0, 0xD9, 0x4D, 0x92, 0x9D,
+    0x99, 0xD5, 0xDA, 0xAF, 0x90, 0xAC, 0xA4, 0x9F, 0xDA, 0x2A, 0xCA, 0x4D, 0xA7, 0xD9, 0x39, 0xDA,
+    0x7D, 0xA3, 0xF7, 0xAD, 0x2A, 0xF9, 0x39, 0x2E, 0xAD, 0x9F, 0xCA, 0xAD, 0x91, 0x9E, 0xA0, 0x9C,
+    0x09, 0xFC, 0xA7, 0x74, 0x49, 0xAA, 0xA9, 0x39, 0xFD, 0x91, 0x9D, 0xA9, 0x09, 0xA2, 0xD9, 0x6D,
+    0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7A, 0xCA, 0x79, 0xD7, 0x0E, 0xAA, 0xAC, 0xA3,
+    0xAF, 0xC9, 0x49, 0xC7, 0x0D, 0x70, 0x9D, 0x70, 0xD5, 0x99, 0xAD, 0x5A, 0xDA, 0x50, 0x77, 0xD7,
+    0x0A, 0xCA, 0x70, 0xD7, 0x1C, 0x97, 0x71, 0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09, 0xDA, 0x1D,
+    0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0, 0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF, 0xDA, 0x2D,
+    0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92, 0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x74, 0x77, 0x3A, 0xD7,
+    0x9D, 0x70, 0xD7, 0x0C, 0xA7, 0x74, 0x9A, 0xA9, 0x59, 0xFD, 0x39, 0xDA, 0x09, 0xDA, 0x2D, 0x92,
+    0x9C, 0xA1, 0xAC, 0xA3, 0xAC, 0xA1, 0xD3, 0xAD, 0x19, 0xDA, 0xAF, 0x91, 0xAF, 0xDA, 0x3D, 0xA7,
+    0x0D, 0x97, 0x0A, 0xCA, 0x70, 0x9D, 0x49, 0x3E, 0xAA, 0xAD, 0x4A, 0xFC, 0xA7, 0x60, 0x77, 0x0E,
+    0x6A, 0xEA, 0x4A, 0xC9, 0x0D, 0x3A, 0xC3, 0xAA, 0x77, 0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09,
+    0xDA, 0x1D, 0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0, 0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF,
+    0xDA, 0x2D, 0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92, 0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x74, 0x76,
+    0xAC, 0x91, 0xD3, 0xD1, 0x9C, 0xA7, 0x77, 0x29, 0xAA, 0x94, 0x9F, 0xD2, 0x9D, 0xA0, 0x9D, 0xA1,
+    0xD9, 0x29, 0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0x3A, 0xD0, 0x9D, 0xAA, 0xF9, 0x0A, 0xFD, 0xA2,
+    0xDA, 0x7D, 0x97, 0xAC, 0xA7, 0x9D, 0x49, 0x2E, 0xAA, 0xAD, 0x3A, 0xFC, 0xA7, 0x40, 0x70, 0x9D,
+    0x4D, 0x94, 0xD4, 0x9C, 0x97, 0x29, 0x93, 0xAC, 0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0x9C, 0xA3, 0xAC,
+    0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x4D, 0x30, 0x76, 0xDA, 0x4A, 0xCA, 0x49,
+    0xCA, 0x5C, 0xA7, 0x79, 0x95, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0x9C, 0xA5, 0xAC, 0xA5, 0xD9,
+    0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x6D, 0x50, 0x74, 0xE4, 0xF9, 0x2D, 0x90, 0xD1, 0xAA,
+    0x3C, 0x97, 0x49, 0x95, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0x9C, 0xA5, 0xAC, 0xA5, 0xD9, 0x5D,
+    0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x6D, 0x50, 0x72, 0xD1, 0x9C, 0xA1, 0xD1, 0xAC, 0x97, 0x75,
+    0x99, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x59, 0xCA, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x5A,
+    0xCA, 0x5D, 0x95, 0xD6, 0xD5, 0x77, 0x2C, 0x92, 0xA9, 0x49, 0xDA, 0xAD, 0x96, 0xEA, 0x69, 0xF9,
+    0x59, 0xD9, 0x0D, 0x69, 0x2A, 0xC9, 0x71, 0x9C, 0xA4, 0xAA, 0xCA, 0x90, 0xD2, 0x9F, 0xD9, 0xD1,
+    0x9D, 0xA2, 0xAE, 0x1D, 0x94, 0xE0, 0x9D, 0x5A, 0xD0, 0xAC, 0xA5, 0xAC, 0xA0, 0xD9, 0x5D, 0x90,
+    0xD9, 0x5D, 0x1D, 0x94, 0xAC, 0xA1, 0xAD, 0x39, 0xD3, 0xEA, 0xAE, 0x94, 0xFC, 0xA7, 0x71, 0x69,
+    0x49, 0x5E, 0xA1, 0xCA, 0x4A, 0xC9, 0xFC, 0x5C, 0x91, 0x9A, 0xC9, 0x77, 0x19, 0x92, 0xAA, 0xA9,
+    0x4A, 0xC9, 0x9F, 0xC9, 0x3D, 0xAD, 0x99, 0xE3, 0xEA, 0x29, 0xD2, 0x9D, 0xA3, 0x9D, 0x2A, 0xD4,
+    0x9D, 0x2D, 0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0xA2, 0xD5, 0xD9, 0x19, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A,
+    0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x94, 0xD9, 0x19, 0xD5, 0xD2, 0x77, 0x0D, 0x97, 0x09, 0xD7, 0x1A,
+    0xC9, 0x71, 0xAA, 0x77, 0x39, 0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D,
+    0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95,
+    0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x77, 0x3A,
+    0xD7, 0x9D, 0x70, 0xD7, 0x0A, 0xA7, 0x74, 0x9A, 0xA9, 0x59, 0xFD, 0x92, 0xAD, 0xA9, 0x9A, 0xD1,
+    0x9D, 0x93, 0xDA, 0x0D, 0xA4, 0x9D, 0x0D, 0x59, 0xD9, 0xD5, 0x9D, 0xAC, 0xA5, 0xAC, 0xAD, 0x95,
+    0xDA, 0xD9, 0x5D, 0x0A, 0xCA, 0x4A, 0xCA, 0x09, 0xD3, 0x9D, 0x2A, 0xDA, 0xAE, 0x93, 0xAF, 0xA7,
+    0x70, 0x77, 0x1A, 0xD7, 0xAF, 0x5A, 0xCA, 0x0A, 0xC9, 0x39, 0xC9, 0x2A, 0xC7, 0x71, 0x9A, 0xA9,
+    0x59, 0xFD, 0x92, 0xAD, 0xA9, 0x9A, 0xD1, 0x9D, 0x93, 0xDA, 0x0D, 0xA4, 0x9D, 0x0D, 0x59, 0xD9,
+    0xD5, 0x9D, 0xAC, 0xA5, 0xAC, 0xAD, 0x95, 0xDA, 0xD9, 0x5D, 0x0A, 0xCA, 0x4A, 0xCA, 0x09, 0xD3,
+    0x9D, 0x2A, 0xDA, 0xAE, 0x93, 0xAF, 0xA7, 0x70, 0x49, 0x93, 0x94, 0xAE, 0x90, 0xAC, 0x39, 0xCA,
+    0xAF, 0x93, 0xAA, 0x2A, 0xCA, 0x77, 0x39, 0xAA, 0x96, 0x9F, 0xD9, 0x3A, 0xDA, 0x99, 0xAD, 0x29,
+    0xD9, 0x3D, 0xA1, 0xDA, 0x49, 0xD1, 0xD5, 0x9D, 0x09, 0xD5, 0x9D, 0x0A, 0xCA, 0x5A, 0xCA, 0x0D,
+    0x95, 0xDA, 0x0D, 0x95, 0xD1, 0xAC, 0xA4, 0xAC, 0xA1, 0x9D, 0x39, 0xD3, 0xAD, 0xAA, 0xE9, 0x4A,
+    0xFA, 0x77, 0x10, 0x77, 0xAC, 0xA1, 0xD4, 0xAC, 0x91, 0xD7, 0x77, 0x59, 0xAA, 0x95, 0x9F, 0xD9,
+    0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D, 0x59, 0xDA,
+    0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39, 0xD2, 0xAD,
+    0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x5A, 0x97, 0x1A, 0xD7, 0x1A, 0xD7, 0x29, 0x77, 0x3A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x77, 0x76, 0x9C, 0xA7, 0x1E, 0x71, 0x9C, 0xA4, 0x77, 0x39,
+    0xAA, 0x90, 0x9C, 0x49, 0xFE, 0xA3, 0xAD, 0xA9, 0x9A, 0xD9, 0x29, 0xD3, 0xEA, 0x2D, 0x92, 0xAC,
+    0xAD, 0x2D, 0x29, 0xCA, 0x9D, 0x19, 0xCA, 0x19, 0xD0, 0x9D, 0x1A, 0xC9, 0x1D, 0x19, 0xCA, 0x1D,
+    0x90, 0xD2, 0xAC, 0x91, 0xD9, 0xAC, 0x92, 0xD2, 0xAE, 0xA2, 0xAC, 0xA2, 0x9E, 0x29, 0xD4, 0xEA,
+    0xAE, 0x93, 0xDA, 0xFA, 0x5A, 0x97, 0x20, 0x77, 0x19, 0xD7, 0x2D, 0x97, 0x2D, 0x73, 0xC9, 0x77,
+    0x19, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA,
+    0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x77, 0x5D,
+    0xA7, 0x0A, 0xCA, 0x70, 0x9C, 0xA7, 0x1C, 0xA7, 0x72, 0x99, 0x69, 0x91, 0xD9, 0x4A, 0xCA, 0x1D,
+    0x5D, 0x91, 0xD5, 0xD1, 0x9D, 0x49, 0xD1, 0xAC, 0xA4, 0x9C, 0xA1, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D,
+    0x90, 0x9D, 0x49, 0xD1, 0x9C, 0xA4, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x19, 0xEA,
+    0xD9, 0xAC, 0x3A, 0xF9, 0x0D, 0x77, 0x77, 0x3E, 0x70, 0xF9, 0x6D, 0x90, 0xD5, 0xAA, 0x3C, 0x97,
+    0x79, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA,
+    0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x77, 0x1D,
+    0x19, 0xCA, 0x5D, 0x1A, 0xCA, 0x77, 0x74, 0x99, 0x69, 0x91, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x91,
+    0xD5, 0xD1, 0x9D, 0x49, 0xD1, 0xAC, 0xA4, 0x9C, 0xA1, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x90, 0x9D,
+    0x49, 0xD1, 0x9C, 0xA4, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x19, 0xEA, 0xD9, 0xAC,
+    0x3A, 0xF9, 0x0D, 0x77, 0x77, 0x72, 0xE7, 0x3A, 0xD7, 0x39, 0xD7, 0x4C, 0xA7, 0x77, 0x09, 0x97,
+    0x99, 0x3A, 0xCA, 0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0xD9, 0x5D, 0x3A, 0xD6, 0xD3, 0xD7,
+    0xD2, 0xAC, 0xA7, 0xD9, 0x1D, 0x70, 0xAC, 0x90, 0xAC, 0xA7, 0x09, 0xC9, 0x0D, 0x71, 0x9C, 0xAA,
+    0xC9, 0x72, 0xCA, 0xD7, 0x3E, 0x97, 0x3E, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD7, 0x4D, 0xA7, 0x09,
+    0xFC, 0x71, 0x9E, 0xA7, 0x20, 0x49, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x4D, 0x73, 0x9C,
+    0xA1, 0x9A, 0xA6, 0xAC, 0x99, 0xFC, 0x5D, 0xAC, 0xA9, 0x9E, 0x4E, 0x93, 0xD3, 0x9D, 0xA4, 0xD3,
+    0x9D, 0x5D, 0x3A, 0xCA, 0x5D, 0x3D, 0x94, 0x9D, 0x3D, 0x5A, 0xD2, 0x9D, 0x5D, 0x92, 0xAD, 0x49,
+    0xD3, 0xEA, 0x29, 0xD9, 0x3D, 0x9D, 0xAE, 0xA4, 0xD0, 0x9F, 0x94, 0x9D, 0x73, 0xAC, 0xA7, 0x3D,
+    0x97, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x73, 0x77, 0x6D, 0x90, 0x9D, 0x70, 0xD1, 0x9C, 0xA7, 0x77,
+    0x75, 0x99, 0x79, 0x93, 0xAC, 0xA5, 0xD9, 0x3A, 0xCA, 0x49, 0xD4, 0x9D, 0x4D, 0x95, 0xD3, 0xAD,
+    0x6D, 0x3D, 0x7D, 0x2A, 0xCA, 0x7D, 0x91, 0xD7, 0x0A, 0xC9, 0x0A, 0xCA, 0x70, 0x9C, 0x90, 0xD7,
+    0x19, 0xCA, 0xAC, 0x97, 0x2C, 0xAD, 0x73, 0xE9, 0x73, 0xE7, 0x4D, 0x97, 0x3A, 0xD7, 0x4D, 0x74,
+    0xDA, 0x70, 0x9F, 0xC7, 0x19, 0xEA, 0x72, 0x79, 0xFD, 0x97, 0xAF, 0xD7, 0x77, 0x2D, 0xA7, 0x39,
+    0xE7, 0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A,
+    0xCA, 0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD,
+    0x49, 0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD,
+    0x7A, 0xCA, 0x1D, 0x97, 0x9D, 0x00, 0x39, 0xFD, 0x94, 0x9F, 0xD7, 0x73, 0x9A, 0xA2, 0x99, 0x29,
+    0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9, 0x3E, 0x1A, 0xD4, 0xAD, 0x1D, 0x94, 0xAC,
+    0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D, 0x94, 0xE1, 0xAC, 0xA3,
+    0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3, 0x9F, 0x90, 0xD7, 0x70, 0x70, 0x93, 0x99,
+    0x79, 0xC9, 0x19, 0xC9, 0x70, 0xFD, 0x72, 0xAD, 0xA7, 0x77, 0x3D, 0xA7, 0x39, 0xE7, 0x3F, 0x72,
+    0xAC, 0xAD, 0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA,
+    0x69, 0xD2, 0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99,
+    0x99, 0x9D, 0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D,
+    0x97, 0x9D, 0x00, 0x4A, 0x39, 0x95, 0xC9, 0x19, 0xCA, 0x5F, 0xD7, 0xAD, 0xA7, 0x74, 0x9A, 0xA2,
+    0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9, 0x3E, 0x1A, 0xD4, 0xAD, 0x1D,
+    0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D, 0x94, 0xE1,
+    0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3, 0x9F, 0x90, 0xD7, 0x70, 0x71,
+    0xDA, 0x72, 0x9E, 0x72, 0xF7, 0x1A, 0xCA, 0xD7, 0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A,
+    0xC9, 0x6A, 0xCA, 0x1A, 0xCA, 0x59, 0xD2, 0x9C, 0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0xAA, 0xAA, 0xAD,
+    0x4F, 0xFD, 0x39, 0xD9, 0x99, 0x99, 0x9D, 0x3D, 0x95, 0xD9, 0x1A, 0xD6, 0xD9, 0x1D, 0x96, 0xAC,
+    0xA0, 0xAD, 0x7A, 0xCA, 0x0D, 0x97, 0x9D, 0x73, 0xCA, 0x73, 0xCA, 0x73, 0xD7, 0x4D, 0x74, 0xAD,
+    0xA7, 0x39, 0x91, 0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D,
+    0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A,
+    0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC,
+    0x39, 0xF9, 0x0D, 0x71, 0xAC, 0x71, 0xAC, 0x71, 0x9C, 0x97, 0x19, 0xC9, 0x72, 0xE7, 0x29, 0x93,
+    0x77, 0x71, 0x9D, 0x73, 0xD7, 0x3D, 0x73, 0xAC, 0x77, 0x71, 0xAF, 0xCA, 0x5A, 0xFF, 0xA3, 0xEA,
+    0x4A, 0x3A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xD9, 0x73, 0xD9, 0x73,
+    0xD7, 0x4D, 0x74, 0xD9, 0x73, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0x39, 0xFA, 0xEA, 0x59, 0xFE, 0x97,
+    0x71, 0x77, 0x2D, 0xA6, 0xAC, 0xA6, 0x9C, 0xA7, 0xCA, 0x77, 0x29, 0xAA, 0xA9, 0x39, 0xFD, 0x91,
+    0x9D, 0xA9, 0x09, 0xA2, 0xD9, 0x6D, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7A, 0xCA,
+    0x79, 0xD7, 0x0E, 0xAA, 0xAC, 0xA3, 0xAF, 0xC9, 0x74, 0x77, 0x7A, 0xD9, 0x71, 0xAF, 0x70, 0xAC,
+    0xA0, 0xAC, 0x96, 0x9C, 0x92, 0xAC, 0x77, 0x6A, 0xFC, 0xA5, 0xAF, 0xFA, 0x3E, 0xA4, 0xA3, 0xAD,
+    0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x74, 0xD7,
+    0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7, 0x4E, 0x73, 0x9F, 0xAE, 0xA5, 0x9F, 0xE9, 0x77, 0x10, 0x77,
+    0x0E, 0x6F, 0x94, 0xD9, 0x0D, 0x3A, 0xA3, 0xC9, 0x77, 0x9A, 0xAA, 0x93, 0x9F, 0xD9, 0x19, 0xDA,
+    0x90, 0x9A, 0x2D, 0x96, 0xDA, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x97, 0xAC, 0xA7, 0x9D,
+    0x70, 0xEA, 0xAA, 0xCA, 0x3A, 0xFC, 0x97, 0x40, 0x71, 0x99, 0x73, 0x9D, 0x73, 0x9D, 0x74, 0x97,
+    0x77, 0x1A, 0xFC, 0xA5, 0xAF, 0xFA, 0x3E, 0xA4, 0xA3, 0xAD, 0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x29,
+    0xD7, 0x3A, 0xD7, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x74, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7,
+    0x4E, 0x73, 0x9F, 0xAE, 0xA5, 0x9F, 0xE9, 0x77, 0x10, 0x69, 0x70, 0xDA, 0x7D, 0x97, 0x09, 0x77,
+    0x29, 0xAA, 0xA9, 0x39, 0xFD, 0x91, 0x9D, 0xA9, 0x09, 0xA2, 0xD9, 0x6D, 0xA7, 0xD7, 0x9D, 0x7A,
+    0xCA, 0x7D, 0x97, 0xD9, 0x7A, 0xCA, 0x79, 0xD7, 0x0E, 0xAA, 0xAC, 0xA3, 0xAF, 0xC9, 0x74, 0x77,
+    0x5A, 0xC9, 0x19, 0xCA, 0x7D, 0x0A, 0xCA, 0x70, 0x9E, 0xA7, 0x2A, 0xCA, 0x77, 0x70, 0xAF, 0xCA,
+    0x5A, 0xFF, 0xA3, 0xEA, 0x4A, 0x3A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x72, 0x9D, 0x73, 0xAD, 0x73,
+    0xD9, 0x73, 0xD9, 0x73, 0xD7, 0x4D, 0x74, 0xD9, 0x73, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0x39, 0xFA,
+    0xEA, 0x59, 0xFE, 0x97, 0x71, 0x77, 0xD2, 0xAC, 0x49, 0xCA, 0x0D, 0x6F, 0x79, 0xD9, 0x77, 0x39,
+    0xAA, 0xA9, 0x49, 0xFD, 0x92, 0x9D, 0xA9, 0x09, 0xA3, 0xD9, 0x7D, 0xA7, 0x0D, 0x70, 0x9D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x0A, 0xCA, 0x70, 0x9D, 0x71, 0xEA, 0xAA, 0xCA, 0x4A, 0xFC,
+    0x97, 0x60, 0x77, 0x5D, 0x2A, 0xC9, 0x69, 0xCA, 0x0D, 0x71, 0xAE, 0x73, 0xD9, 0x77, 0x5F, 0xCA,
+    0xA6, 0x9F, 0xFA, 0x4A, 0xCA, 0x29, 0xEA, 0x3D, 0x94, 0xAD, 0x3D, 0x6D, 0xA1, 0x9D, 0x6A, 0xD1,
+    0xAC, 0xA6, 0x9D, 0x1D, 0x96, 0x9D, 0x1D, 0x96, 0xAD, 0x1D, 0x7A, 0xCA, 0x09, 0xD7, 0xDA, 0x0A,
+    0xCA, 0x69, 0xD1, 0xD9, 0x6E, 0x1D, 0x6A, 0xD9, 0x1D, 0x5A, 0xDA, 0x19, 0xD3, 0x9E, 0xA2, 0xAF,
+    0xFC, 0x93, 0xFE, 0xA9, 0x50, 0x72, 0x9D, 0x1D, 0x73, 0xAC, 0xA0, 0xAC, 0x97, 0x3D, 0x90, 0xCA,
+    0x74, 0xD0, 0xAC, 0x75, 0xD7, 0x29, 0xAA, 0x19, 0xD7, 0x09, 0xFC, 0x9A, 0xCA, 0x7A, 0xDA, 0x99,
+    0xAE, 0x97, 0xD9, 0x3E, 0x7D, 0xA4, 0xAD, 0x7D, 0x94, 0xAC, 0xA6, 0x9D, 0x5A, 0xC9, 0x6A, 0xCA,
+    0x5D, 0x96, 0xAC, 0xA4, 0x9D, 0x7D, 0x94, 0xE7, 0xAC, 0xA3, 0x9D, 0xA7, 0xAD, 0x29, 0xE9, 0x70,
+    0xEA, 0xD9, 0xAC, 0x71, 0x9F, 0x90, 0xD7, 0x77, 0x30, 0x4F, 0xCA, 0xA7, 0x9F, 0xFA, 0x5A, 0xCA,
+    0x29, 0xEA, 0x4D, 0x94, 0xAD, 0x4D, 0x6D, 0xA2, 0x9D, 0x6A, 0xD2, 0xAC, 0xA6, 0x9D, 0x2D, 0x96,
+    0x9D, 0x0A, 0xFE, 0x3A, 0xD0, 0xFF, 0x3A, 0xCA, 0x19, 0xD7, 0xDA, 0x1A, 0xCA, 0x69, 0xD2, 0xD9,
+    0x6E, 0x2D, 0x6A, 0xD9, 0x2D, 0x5A, 0xDA, 0x29, 0xD3, 0x9E, 0xA3, 0xAF, 0xFC, 0x94, 0xFE, 0xA9,
+    0x50, 0x72, 0x9D, 0x74, 0xAC, 0xA7, 0x0F, 0xF6, 0x9F, 0xF7, 0x3D, 0x7A, 0xAA, 0x19, 0xD5, 0xAF,
+    0xC9, 0xAC, 0xA4, 0xAD, 0xA1, 0xAE, 0x93, 0x9D, 0x93, 0xE4, 0xDA, 0x4A, 0xD4, 0xD5, 0xAC, 0xA3,
+    0x9D, 0x5A, 0xC9, 0x3A, 0xCA, 0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x4D, 0x94, 0xE4, 0xAC, 0xA3, 0x9D,
+    0xA4, 0xAD, 0x29, 0xE9, 0x5E, 0xAD, 0x9A, 0xC6, 0x9F, 0x90, 0xD7, 0x75, 0x4A, 0xFD, 0x5A, 0xFD,
+    0x77, 0x1F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7,
+    0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D,
+    0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x3F, 0xDA, 0x3F, 0xD9, 0x77,
+    0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09, 0xDA, 0x1D, 0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0,
+    0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF, 0xDA, 0x2D, 0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92,
+    0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x74, 0x49, 0x93, 0x99, 0x4A, 0xC2, 0x9C, 0x95, 0xFC, 0xA6, 0x9A,
+    0xD9, 0x77, 0x2F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC,
+    0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7,
+    0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x39, 0x4A, 0x4C, 0xA2,
+    0xAC, 0x4A, 0xFC, 0x95, 0x9D, 0xA7, 0x73, 0x9A, 0xA9, 0x59, 0xFD, 0x39, 0xDA, 0x09, 0xDA, 0x2D,
+    0x92, 0x9C, 0xA1, 0xAC, 0xA3, 0xAC, 0xA1, 0xD3, 0xAD, 0x19, 0xDA, 0xAF, 0x91, 0xAF, 0xDA, 0x3D,
+    0xA7, 0x0D, 0x97, 0x0A, 0xCA, 0x70, 0x9D, 0x49, 0x3E, 0xAA, 0xAD, 0x4A, 0xFC, 0xA7, 0x60, 0x79,
+    0x97, 0x2D, 0x71, 0x9D, 0x72, 0x97, 0x74, 0xFF, 0xA2, 0x9F, 0xFA, 0x2A, 0xCA, 0x71, 0xD9, 0x71,
+    0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xDA, 0x99, 0x99, 0x94, 0xFF, 0xA3, 0xDA, 0xAA, 0xAA, 0xA9,
+    0x29, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0xAF, 0xF9, 0x2F, 0xFC,
+    0x30, 0x69, 0x70, 0xAD, 0x7A, 0xCA, 0x70, 0x97, 0x72, 0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09,
+    0xDA, 0x1D, 0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0, 0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF,
+    0xDA, 0x2D, 0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92, 0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x74, 0x3F,
+    0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9,
+    0x99, 0x99, 0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D,
+    0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1A, 0xC7, 0x2A,
+    0xC7, 0x29, 0xE7, 0x29, 0x94, 0x49, 0xAA, 0x94, 0x9F, 0xD2, 0x9D, 0xA0, 0x9D, 0xA1, 0xD9, 0x29,
+    0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0x3A, 0xD0, 0x9D, 0xAA, 0xF9, 0x0A, 0xFD, 0xA2, 0xDA, 0x7D,
+    0x97, 0xAC, 0xA7, 0x9D, 0x49, 0x2E, 0xAA, 0xAD, 0x3A, 0xFC, 0xA6, 0xAC, 0x96, 0x9C, 0x97, 0xD7,
+    0x0D, 0x70, 0xEA, 0x79, 0x93, 0x77, 0x29, 0xC9, 0x19, 0xCA, 0x6D, 0x9A, 0xCA, 0x70, 0xEA, 0x71,
+    0xAC, 0xA7, 0x75, 0xFF, 0xA3, 0x9F, 0xFA, 0x3A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2A,
+    0xCA, 0x72, 0xDA, 0x99, 0x99, 0x95, 0xFF, 0xA4, 0xDA, 0xAA, 0xAA, 0xA9, 0x39, 0xD7, 0x2A, 0xCA,
+    0x72, 0xD9, 0x72, 0xD7, 0x3D, 0x72, 0x9D, 0x72, 0xAF, 0xF9, 0x3F, 0xFC, 0x40, 0x77, 0xD2, 0xAC,
+    0x94, 0xD0, 0xD9, 0x5A, 0xE9, 0x7D, 0x97, 0x73, 0x9A, 0xA9, 0x59, 0xFD, 0x39, 0xDA, 0x09, 0xDA,
+    0x2D, 0x92, 0x9C, 0xA1, 0xAC, 0xA3, 0xAC, 0xA1, 0xD3, 0xAD, 0x19, 0xDA, 0xAF, 0x91, 0xAF, 0xDA,
+    0x3D, 0xA7, 0x0D, 0x97, 0x0A, 0xCA, 0x70, 0x9D, 0x49, 0x3E, 0xAA, 0xAD, 0x4A, 0xFC, 0xA7, 0x60,
+    0x77, 0x71, 0xE7, 0x3F, 0x97, 0x1D, 0x1D, 0x70, 0xCA, 0x3C, 0x97, 0x77, 0xAF, 0xD9, 0x5A, 0xFF,
+    0xC9, 0x3E, 0xA4, 0x9A, 0x3A, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x39, 0xD7, 0x4A, 0xCA, 0x74,
+    0xD9, 0x49, 0x99, 0x99, 0x91, 0xD9, 0x4F, 0xC9, 0x1D, 0x5A, 0xAA, 0xD9, 0x1D, 0x70, 0xD2, 0xD9,
+    0x69, 0xD2, 0xDA, 0x6A, 0xCA, 0x2A, 0xD6, 0xD9, 0x3E, 0x5D, 0x49, 0xFA, 0xFC, 0x6A, 0xFD, 0xA9,
+    0x77, 0x20, 0x77, 0x49, 0xDA, 0x71, 0xF7, 0x9D, 0x1D, 0x6C, 0xA2, 0x9C, 0x97, 0x74, 0x9A, 0xA2,
+    0x99, 0x39, 0xFC, 0x99, 0xCA, 0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x3E, 0x2A, 0xD4, 0xAD, 0x2D,
+    0x94, 0xAC, 0xA1, 0x9D, 0x5D, 0xA1, 0xAC, 0xA5, 0xD9, 0x1A, 0xCA, 0x49, 0xD2, 0xD9, 0x4E, 0x2A,
+    0xCA, 0x39, 0xDA, 0x2A, 0xD2, 0x9E, 0x93, 0xEA, 0xD9, 0xD4, 0x9F, 0x90, 0xD7, 0x29, 0xD7, 0x2A,
+    0xCA, 0x72, 0xD3, 0x99, 0x4D, 0xA3, 0x9F, 0xF5, 0xAF, 0xC9, 0x50, 0x7A, 0x49, 0x70, 0xCA, 0x2C,
+    0xA7, 0x0F, 0xD7, 0x2A, 0xDA, 0x77, 0x71, 0xAF, 0xD9, 0x5A, 0xFF, 0xC9, 0x3E, 0xA4, 0x9A, 0x3A,
+    0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x39, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x49, 0x99, 0x99, 0x91,
+    0xD9, 0x4F, 0xC9, 0x1D, 0x5A, 0xAA, 0xD9, 0x1D, 0x70, 0xD2, 0xD9, 0x69, 0xD2, 0xDA, 0x6A, 0xCA,
+    0x2A, 0xD6, 0xD9, 0x3E, 0x5D, 0x49, 0xFA, 0xFC, 0x6A, 0xFD, 0xA9, 0x77, 0x20, 0x59, 0x39, 0x95,
+    0x9C, 0x91, 0x9C, 0x96, 0xFD, 0x70, 0xAD, 0xA7, 0x76, 0x9A, 0xA2, 0x99, 0x39, 0xFC, 0x99, 0xCA,
+    0x2A, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x3E, 0x2A, 0xD4, 0xAD, 0x2D, 0x94, 0xAC, 0xA1, 0x9D, 0x5D,
+    0xA1, 0xAC, 0xA5, 0xD9, 0x1A, 0xCA, 0x49, 0xD2, 0xD9, 0x4E, 0x2A, 0xCA, 0x39, 0xDA, 0x2A, 0xD2,
+    0x9E, 0x93, 0xEA, 0xD9, 0xD4, 0x9F, 0x90, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD3, 0x99, 0x4D,
+    0xA3, 0x9F, 0xF5, 0xAF, 0xC9, 0x50, 0x72, 0x97, 0x5D, 0xA7, 0x4D, 0x97, 0x59, 0x77, 0x72, 0xAF,
+    0xD9, 0x5A, 0xFF, 0xC9, 0x3E, 0xA4, 0x9A, 0x3A, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x39, 0xD7,
+    0x4A, 0xCA, 0x74, 0xD9, 0x49, 0x99, 0x99, 0x91, 0xD9, 0x4F, 0xC9, 0x1D, 0x5A, 0xAA, 0xD9, 0x1D,
+    0x70, 0xD2, 0xD9, 0x69, 0xD2, 0xDA, 0x6A, 0xCA, 0x2A, 0xD6, 0xD9, 0x3E, 0x5D, 0x49, 0xFA, 0xFC,
+    0x6A, 0xFD, 0xA9, 0x77, 0x20, 0x70, 0x97, 0x3D, 0x97, 0x2D, 0x77, 0x77, 0x59, 0xAA, 0x29, 0x93,
+    0x9F, 0xC9, 0x9C, 0xA2, 0xAD, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0xE2, 0xAD, 0x4A, 0xD2, 0xD9, 0x4A,
+    0xCA, 0x19, 0xD5, 0xDA, 0x1A, 0xCA, 0x5D, 0x91, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xE2, 0xAC, 0xA3,
+    0x9D, 0xA2, 0xAD, 0x29, 0xE9, 0x3E, 0xAD, 0x9D, 0x49, 0xF9, 0x0D, 0x72, 0x9D, 0x72, 0xAC, 0xA7,
+    0x2D, 0x39, 0x94, 0xDA, 0x39, 0xFF, 0x5A, 0xFC, 0x95, 0x77, 0x6A, 0xFD, 0x95, 0xAF, 0xFC, 0x93,
+    0xEA, 0x49, 0xA3, 0xAD, 0x97, 0x29, 0xD9, 0x73, 0xDA, 0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x94,
+    0x99, 0x99, 0x99, 0x1D, 0x94, 0xFC, 0x91, 0xD5, 0xAA, 0xAD, 0x91, 0xD7, 0x0D, 0x2D, 0x96, 0x9D,
+    0x2D, 0xA6, 0xAC, 0xA2, 0xAD, 0x6D, 0x93, 0xE5, 0xD4, 0x9F, 0xAF, 0xC6, 0xAF, 0xDA, 0x97, 0x77,
+    0x09, 0x97, 0x5D, 0x74, 0xAC, 0x97, 0x4C, 0xA7, 0x5A, 0x71, 0x77, 0x69, 0xC7, 0x3C, 0xA7, 0x2D,
+    0x72, 0x9C, 0xA7, 0x77, 0x9A, 0xA2, 0x99, 0x39, 0xFC, 0x99, 0xCA, 0x2A, 0xDA, 0x99, 0xAE, 0x92,
+    0xD9, 0x3E, 0x2A, 0xD4, 0xAD, 0x2D, 0x94, 0xAC, 0xA1, 0x9D, 0x5D, 0xA1, 0xAC, 0xA5, 0xD9, 0x1A,
+    0xCA, 0x49, 0xD2, 0xD9, 0x4E, 0x2A, 0xCA, 0x39, 0xDA, 0x2A, 0xD2, 0x9E, 0x93, 0xEA, 0xD9, 0xD4,
+    0x9F, 0x90, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD3, 0x99, 0x4D, 0xA3, 0x9F, 0xF5, 0xAF, 0xC9,
+    0x50, 0x77, 0x71, 0xE7, 0x4F, 0xA7, 0x2D, 0x90, 0xD7, 0x1A, 0xC3, 0xCA, 0x77, 0x7D, 0x7D, 0x39,
+    0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xD9, 0x3D, 0x7D, 0x39, 0xD7, 0xD3, 0xAC, 0xA6,
+    0x9D, 0x3A, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xCA, 0x3F, 0xFF, 0x93, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xAC, 0x93, 0xD7, 0xD9, 0x3D, 0x7D, 0x39,
+    0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xD9, 0x30, 0x77, 0x2E, 0x71, 0xFA, 0x7D, 0x90,
+    0xD6, 0xAC, 0x3C, 0xA7, 0x77, 0x73, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xD7, 0x29,
+    0xCA, 0x19, 0xAA, 0x5A, 0xC9, 0x9F, 0xC9, 0x3D, 0xAC, 0xA9, 0x9A, 0xD3, 0xE9, 0x3D, 0x29, 0xDA,
+    0x4D, 0x2A, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A, 0xCA, 0x2D, 0x94, 0xD9, 0x2D, 0x5D, 0x29, 0xD5, 0xD2,
+    0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xAC, 0xA2, 0xD5, 0xD9, 0x2D, 0x5D, 0x20, 0x3D, 0x7D, 0x49, 0xCA,
+    0x69, 0xD4, 0xAC, 0xA6, 0xAC, 0xA2, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0x91, 0x9D, 0x69, 0xD4, 0xAC,
+    0xA6, 0x9D, 0x4D, 0xA9, 0x99, 0x99, 0x99, 0xDA, 0x4F, 0xFF, 0x94, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x49, 0xD6, 0x9D, 0x4A, 0xCA, 0x6A, 0xCA, 0x4D, 0x96, 0xDA, 0x4D, 0x7D, 0x94, 0xD7, 0xD4, 0x9D,
+    0x69, 0xD4, 0xAC, 0xA6, 0xAC, 0xA4, 0xD9, 0x6D, 0x94, 0x39, 0xD7, 0x2A, 0xCA, 0x70, 0x9F, 0xE9,
+    0x4F, 0xF9, 0x6D, 0x72, 0x9C, 0xA1, 0x99, 0x95, 0xAC, 0x90, 0xFC, 0x4D, 0x9D, 0x99, 0xE3, 0xEA,
+    0x29, 0xD2, 0x9D, 0xA4, 0xD2, 0x9D, 0x49, 0xD2, 0xAC, 0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0x92, 0xD5,
+    0xD2, 0x9D, 0x5D, 0x2A, 0xCA, 0x49, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x5D, 0x92, 0xD5, 0xD2, 0x59,
+    0x39, 0x49, 0xEA, 0x1C, 0x93, 0xDA, 0xFC, 0x39, 0xC2, 0x9C, 0xA7, 0x72, 0xAF, 0xC9, 0x59, 0xFA,
+    0x70, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x19, 0xCA, 0x71, 0xAC,
+    0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x70, 0x9A, 0xDA, 0x95,
+    0x9F, 0xD5, 0x29, 0x49, 0x1E, 0xA1, 0xCA, 0x0D, 0x9F, 0xC1, 0xC2, 0x9C, 0xA7, 0x79, 0x96, 0xAC,
+    0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0x9C, 0xA6, 0xAC, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9,
+    0x6D, 0x7D, 0x60, 0x39, 0xFD, 0x93, 0x9F, 0xD7, 0x70, 0xAF, 0xC9, 0x49, 0xFA, 0x7D, 0x70, 0x9D,
+    0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0x9C, 0xA7, 0x0A, 0xCA, 0x70, 0xD9, 0x70,
+    0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x9A, 0xDA, 0x94, 0x9F, 0xD4, 0x1F, 0xDA,
+    0x09, 0xFD, 0x97, 0x49, 0x95, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0x9C, 0xA5, 0xAC, 0xA5, 0xD9,
+    0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x6D, 0x50, 0x49, 0x39, 0x93, 0x9C, 0x91, 0x9C, 0x94,
+    0xFD, 0x6A, 0xDA, 0x77, 0x1A, 0xFC, 0x94, 0x9F, 0xA7, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9,
+    0x70, 0xD7, 0x09, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC,
+    0xA7, 0x0D, 0x97, 0x0D, 0x79, 0xAD, 0xA9, 0x49, 0xFD, 0x40, 0x1A, 0x49, 0x2C, 0xA2, 0xCA, 0x2F,
+    0xD4, 0xAD, 0xA7, 0x70, 0x99, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D,
+    0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD7, 0xD6, 0x3A, 0xFC, 0x93, 0x9F, 0xA6, 0xD7, 0x9D,
+    0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7D, 0x97, 0xD6, 0x9A, 0xDA, 0x93, 0x9F, 0xD6, 0xAC, 0x7D, 0x79, 0xC9, 0x7A, 0xC9, 0x79, 0xE7,
+    0x09, 0x95, 0x59, 0x5A, 0xCA, 0x4D, 0xA5, 0x97, 0x59, 0x94, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4,
+    0x9C, 0xA4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x5D, 0x5C, 0xA4, 0xCA,
+    0x4A, 0xC5, 0xD5, 0xAE, 0x49, 0x99, 0x30, 0x79, 0x70, 0xD9, 0x7D, 0x77, 0x73, 0xAF, 0xC9, 0x39,
+    0xFA, 0x6D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0x9C, 0xA7, 0xAC, 0xA7, 0xD9, 0x7D,
+    0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x69, 0xAD, 0xA9, 0x39, 0xFD, 0x30, 0x39, 0x92, 0xAC, 0xA2,
+    0xD9, 0x2D, 0x29, 0xD2, 0x9C, 0xA2, 0xAC, 0xA2, 0xD9, 0x2D, 0x29, 0xD2, 0xAC, 0xA2, 0xD9, 0x2D,
+    0x3D, 0x20, 0x3A, 0xFC, 0x92, 0xD4, 0x9F, 0xA2, 0x9D, 0x6D, 0x4A, 0xCA, 0x59, 0xD4, 0xD9, 0x5A,
+    0xCA, 0x4D, 0x6D, 0x94, 0xD6, 0xD4, 0x9D, 0x59, 0xD4, 0xAC, 0xA5, 0x9C, 0xA4, 0xD9, 0x5A, 0xCA,
+    0x4D, 0x6D, 0x93, 0x9D, 0x6D, 0x49, 0xD5, 0x9D, 0x4A, 0xCA, 0x5A, 0xCA, 0x4D, 0x95, 0xD9, 0x4D,
+    0x6D, 0x49, 0xD4, 0x9A, 0xDA, 0x92, 0xAC, 0xA3, 0x9F, 0xD2, 0xD9, 0x75, 0xD9, 0x74, 0xAD, 0x71,
+    0x99, 0x9A, 0xD9, 0x71, 0xFC, 0xA7, 0x29, 0xAA, 0xA9, 0x60, 0x49, 0x49, 0x94, 0xAC, 0xA2, 0x9D,
+    0x4D, 0xA2, 0x9D, 0x59, 0x49, 0x77, 0x39, 0x93, 0x99, 0x4A, 0xCA, 0x3D, 0x4D, 0x92, 0x9D, 0x4D,
+    0x3A, 0xCA, 0x39, 0xD3, 0xD9, 0x39, 0xCA, 0x3D, 0x4A, 0xCA, 0x29, 0xD4, 0xD9, 0x29, 0xCA, 0x4D,
+    0x3A, 0xC9, 0x39, 0xD3, 0xD9, 0x3A, 0xCA, 0x3D, 0x4D, 0x92, 0x9D, 0x4D, 0x3A, 0xCA, 0x4D, 0x3A,
+    0xC9, 0x72, 0xD7, 0x3D, 0x72, 0x9D, 0x72, 0xD9, 0x7A, 0xF7, 0x0A, 0xDA, 0x60, 0x77, 0x6E, 0x71,
+    0xFA, 0x7D, 0x90, 0xD6, 0xAC, 0x3C, 0xA7, 0x76, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72,
+    0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0xAC, 0xA7,
+    0x2D, 0x97, 0x2D, 0x73, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x2A, 0xD6, 0x90,
+    0x9A, 0xD9, 0x6F, 0xCA, 0x7A, 0xAA, 0xA7, 0x10, 0x77, 0x4E, 0x70, 0xF9, 0x6D, 0x90, 0xD5, 0xAA,
+    0x3C, 0x97, 0x74, 0x99, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0x9C, 0xA7, 0x1A,
+    0xC9, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D,
+    0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0xF9, 0x7E, 0x97, 0x3D, 0x5A, 0xCA, 0x39, 0xCA, 0x4A,
+    0xD4, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0xAD, 0x6D, 0x2A, 0xD6, 0x9D, 0x1A, 0xD7, 0xAC, 0xA0, 0xAD,
+    0x70, 0xD9, 0xAD, 0x71, 0xFC, 0xA7, 0x1E, 0xAD, 0x70, 0x9D, 0x90, 0xAC, 0xA7, 0xAC, 0xA1, 0x9D,
+    0x7D, 0x92, 0xD9, 0x6D, 0x3A, 0xD6, 0xD4, 0xD9, 0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0x9D, 0x4D,
+    0x95, 0xDA, 0x77, 0x79, 0x97, 0x5D, 0x74, 0xAC, 0x97, 0x4C, 0xA7, 0x59, 0x73, 0x39, 0xD7, 0x2A,
+    0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x39, 0x99, 0x3A, 0xCA, 0x29, 0xD9, 0x3D,
+    0x91, 0x9D, 0x94, 0xD1, 0x9D, 0x94, 0x9D, 0x09, 0xD9, 0x5A, 0xCA, 0x9D, 0x96, 0xAC, 0xAD, 0xA7,
+    0xFD, 0x7D, 0xA0, 0xD9, 0x59, 0xD1, 0x9D, 0x5A, 0xCA, 0x2D, 0x94, 0xD9, 0x2A, 0xD4, 0xD4, 0xD9,
+    0x3D, 0x4A, 0xCA, 0x77, 0x59, 0x97, 0x2D, 0x97, 0x19, 0xCA, 0x72, 0xD7, 0x3A, 0x71, 0x39, 0x93,
+    0x99, 0x93, 0xAC, 0xA2, 0x9D, 0x93, 0xD9, 0x19, 0xD9, 0x4D, 0x19, 0xD9, 0x49, 0xD0, 0x9D, 0x95,
+    0xAC, 0xA9, 0xD9, 0x6A, 0xCA, 0xDA, 0x7F, 0xD7, 0xDA, 0x0D, 0x95, 0x9D, 0x19, 0xD5, 0xAC, 0xA2,
+    0xD9, 0x4D, 0x92, 0xAD, 0x4D, 0x4D, 0x93, 0xD4, 0xAC, 0xA2, 0x77, 0x9D, 0x95, 0xD9, 0x5D, 0x95,
+    0x9C, 0x77, 0x1D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x96, 0xD9,
+    0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x7D, 0x69, 0xD6, 0xAF, 0xF9, 0xFF, 0xC0, 0x77, 0x1E,
+    0x6A, 0xD6, 0x9D, 0x7C, 0xA7, 0x77, 0x59, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x70, 0xD7, 0x9D, 0x7A,
+    0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xC9, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D,
+    0x97, 0xD7, 0x0D, 0x70, 0x3D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D,
+    0x96, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x7D, 0x69, 0xD6, 0xAF, 0xF9, 0xFF, 0xC7,
+    0x69, 0x96, 0xAC, 0x96, 0xCA, 0x6A, 0xC7, 0xA6, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x5D, 0x49,
+    0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0x94, 0xD9, 0x4D, 0x49, 0xD4, 0xAC,
+    0xA4, 0xD9, 0x4D, 0x5D, 0x75, 0x99, 0x49, 0xCA, 0x4D, 0x49, 0xC5, 0x99, 0x50, 0x3D, 0x3C, 0xA2,
+    0x9C, 0xA2, 0xAC, 0x92, 0xAC, 0xA2, 0xCA, 0x3D, 0x91, 0xAC, 0x4D, 0x70, 0x9D, 0x70, 0xAC, 0xA7,
+    0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x71, 0xD7, 0x09,
+    0xD7, 0x0A, 0xFF, 0x91, 0xFF, 0xC2, 0x39, 0xD0, 0x9D, 0x3A, 0xCA, 0x0D, 0x93, 0xD9, 0x9C, 0xA4,
+    0xD0, 0xCA, 0x5D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xAC, 0x97, 0xD9,
+    0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x70, 0xD7, 0x3D, 0x69, 0xCA, 0x6A, 0xCA, 0x6D, 0x96,
+    0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x92, 0x92, 0xD9, 0x19, 0xD1, 0xD2, 0xAD, 0x09, 0xD3, 0x91, 0xAC,
+    0xA6, 0xD9, 0x6D, 0x7D, 0x69, 0xD6, 0xAF, 0xF9, 0xFF, 0xC0, 0x39, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D,
+    0x6D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x19, 0x29, 0xD0, 0xAC, 0xA1, 0xAC, 0xA0, 0xDA, 0x1A,
+    0xC9, 0x19, 0x2D, 0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD6, 0xD5, 0x39, 0xD7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x9C, 0xA4, 0xFC, 0x93, 0x9E, 0x94, 0xAE,
+    0x5A, 0xEA, 0x69, 0xD9, 0x7D, 0x70, 0xD7, 0x9D, 0x7A, 0xFF, 0x90, 0xFF, 0xC0, 0x39, 0xD4, 0xAC,
+    0xA4, 0xD9, 0x4D, 0x5D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x93, 0xF2, 0x9E, 0x91, 0xAE, 0x2A, 0xE9,
+    0x39, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x5D, 0x40, 0x77, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xAC, 0x97, 0x49, 0xC9, 0x77, 0x70, 0x9D, 0x96, 0x9C, 0xA2, 0xAD, 0xA6, 0xAC, 0xA2, 0xAE,
+    0x6D, 0x92, 0xF9, 0x5D, 0x3D, 0x9D, 0x49, 0xD2, 0x9C, 0xA0, 0xD4, 0x9C, 0xA2, 0xAC, 0xA0, 0xAC,
+    0xA3, 0xAC, 0x92, 0xD9, 0x09, 0xD3, 0xD9, 0x2D, 0x2D, 0x92, 0xD3, 0xD2, 0xAC, 0xA1, 0x9D, 0x29,
+    0xCA, 0x3D, 0x1A, 0xCA, 0x2A, 0xC9, 0x3D, 0x90, 0xAC, 0x92, 0xD9, 0x39, 0xCA, 0x0D, 0x3D, 0x5D,
+    0x0D, 0x29, 0xD5, 0xAC, 0xAD, 0x29, 0xCA, 0x59, 0xEA, 0x2A, 0xC9, 0x6E, 0x92, 0xD7, 0xAD, 0x30,
+    0x77, 0x7D, 0xA7, 0x1A, 0xD7, 0x19, 0xCA, 0x72, 0xCA, 0x77, 0x49, 0x92, 0xAA, 0xA9, 0x4A, 0xC9,
+    0x9F, 0xC9, 0x3D, 0xAD, 0x99, 0xE3, 0xEA, 0x29, 0xD2, 0x9D, 0xA3, 0x9D, 0x2A, 0xD4, 0x9D, 0x2D,
+    0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0xA2, 0xD5, 0xD9, 0x19, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A, 0xD2, 0xD9,
+    0x4A, 0xCA, 0x2D, 0x94, 0xD9, 0x19, 0xD5, 0xD2, 0x29, 0xD9, 0x69, 0xCA, 0x2A, 0xDA, 0x6A, 0xCA,
+    0x2A, 0xE6, 0xD9, 0x2F, 0x95, 0xD3, 0xD9, 0xD4, 0x9D, 0x29, 0xCA, 0x0D, 0x49, 0xCA, 0x2A, 0xCA,
+    0x0A, 0xCA, 0x3A, 0xC9, 0x2D, 0x90, 0x9D, 0x3D, 0x92, 0xD2, 0xD9, 0x2D, 0x3D, 0x2A, 0xCA, 0x19,
+    0xD2, 0x9C, 0xA3, 0xD1, 0xAC, 0xA2, 0xAC, 0x93, 0xD9, 0x0A, 0xC9, 0x2D, 0x93, 0x9C, 0xA0, 0xD3,
+    0xD5, 0xD0, 0xD2, 0x9D, 0x5A, 0xCA, 0xD2, 0x9C, 0xA5, 0x9E, 0xA2, 0xAC, 0x96, 0xE9, 0x2D, 0x7A,
+    0xD7, 0x77, 0x19, 0x99, 0x75, 0xD7, 0x59, 0xCA, 0x75, 0xD7, 0x6A, 0x73, 0x29, 0x92, 0xAA, 0xA9,
+    0x4A, 0xC9, 0x9F, 0xC9, 0x3D, 0xAD, 0x99, 0xE3, 0xEA, 0x29, 0xD2, 0x9D, 0xA3, 0x9D, 0x2A, 0xD4,
+    0x9D, 0x2D, 0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0xA2, 0xD5, 0xD9, 0x19, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A,
+    0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x94, 0xD9, 0x19, 0xD5, 0xD7, 0x75, 0x99, 0x72, 0x9C, 0xA7, 0x2D,
+    0x72, 0x9C, 0x97, 0x29, 0x97, 0x00, 0x77, 0x79, 0xC9, 0x19, 0xD7, 0x1A, 0xC9, 0x9D, 0x73, 0xF7,
+    0x4A, 0xD7, 0x77, 0x09, 0xD9, 0x69, 0xCA, 0x2A, 0xDA, 0x6A, 0xCA, 0x2A, 0xE6, 0xD9, 0x2F, 0x95,
+    0xD3, 0xD9, 0xD4, 0x9D, 0x29, 0xCA, 0x0D, 0x49, 0xCA, 0x2A, 0xCA, 0x0A, 0xCA, 0x3A, 0xC9, 0x2D,
+    0x90, 0x9D, 0x3D, 0x92, 0xD2, 0xD9, 0x2D, 0x3D, 0x2A, 0xCA, 0x19, 0xD2, 0x9C, 0xA3, 0xD1, 0xAC,
+    0xA2, 0xAC, 0x93, 0xD9, 0x0A, 0xC9, 0x2D, 0x93, 0x9C, 0xA0, 0xD3, 0xD5, 0xD0, 0xD2, 0x9D, 0x5A,
+    0xCA, 0xD2, 0x9C, 0xA5, 0x9E, 0xA2, 0xAC, 0x96, 0xE9, 0x2D, 0x7A, 0xD3, 0x77, 0x3D, 0x2A, 0xC9,
+    0x59, 0xCA, 0x0D, 0x70, 0xAE, 0x72, 0xD9, 0x77, 0x39, 0x92, 0xAA, 0xA9, 0x4A, 0xC9, 0x9F, 0xC9,
+    0x3D, 0xAD, 0x99, 0xE3, 0xEA, 0x29, 0xD2, 0x9D, 0xA3, 0x9D, 0x2A, 0xD4, 0x9D, 0x2D, 0xA4, 0xAC,
+    0xA2, 0xD9, 0x4D, 0xA2, 0xD5, 0xD9, 0x19, 0xD4, 0x9D, 0x2A, 0xCA, 0x4A, 0xD2, 0xD9, 0x4A, 0xCA,
+    0x2D, 0x94, 0xD9, 0x19, 0xD5, 0xD2, 0x1A, 0xD7, 0x3D, 0x97, 0x29, 0xD7, 0x3D, 0x97, 0x3D, 0x09,
+    0x92, 0xAA, 0xA9, 0x1A, 0xC1, 0xD9, 0x9F, 0xC9, 0x09, 0x2D, 0xAC, 0xA9, 0x9E, 0x4E, 0x92, 0x9D,
+    0x39, 0xDA, 0x39, 0xD3, 0xAD, 0x49, 0xD3, 0xDA, 0x4A, 0xCA, 0x3D, 0x94, 0xD9, 0x29, 0xD5, 0xD9,
+    0x29, 0xD4, 0x9D, 0x3A, 0xCA, 0x4A, 0xD3, 0xD9, 0x4D, 0xA3, 0xD5, 0xD9, 0x29, 0xD5, 0xD2, 0x29,
+    0xD9, 0x69, 0xCA, 0x2A, 0xDA, 0x6A, 0xCA, 0x2A, 0xE6, 0xD9, 0x2F, 0x95, 0xD3, 0xD9, 0xD4, 0x9D,
+    0x29, 0xCA, 0x0D, 0x49, 0xCA, 0x2A, 0xC9, 0x0A, 0xCA, 0x3A, 0xC9, 0x2D, 0x91, 0xD3, 0xD9, 0x2D,
+    0x2D, 0x92, 0xD3, 0xD2, 0x9C, 0xA1, 0x9D, 0x29, 0xCA, 0x3D, 0x1A, 0xCA, 0x2A, 0xC9, 0x3A, 0xC9,
+    0x0A, 0xC9, 0x2D, 0x93, 0x9D, 0x0D, 0x3D, 0x5D, 0x9D, 0x29, 0xD5, 0xAF, 0x29, 0xCA, 0x6E, 0xA2,
+    0xAC, 0x96, 0xE9, 0x2D, 0x79, 0xD7, 0x59, 0xD7, 0x5D, 0xA7, 0x19, 0x99, 0xE7, 0x2F, 0xC9, 0x72,
+    0xAA, 0xA9, 0x60, 0x39, 0x29, 0xAA, 0x94, 0xAC, 0x09, 0xFC, 0x93, 0xD9, 0xCA, 0x99, 0xAD, 0x3E,
+    0x93, 0xD2, 0x9D, 0xA4, 0xD2, 0x9D, 0x49, 0xD2, 0xAC, 0xA4, 0xAC, 0xA2, 0xD9, 0x4D, 0x92, 0xD5,
+    0xD2, 0x9D, 0x5D, 0x2A, 0xCA, 0x49, 0xD2, 0xD9, 0x4A, 0xCA, 0x2D, 0x5D, 0x92, 0xD5, 0xD7, 0x29,
+    0xD7, 0x29, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x0F, 0xA7, 0x0E, 0xA4, 0x69, 0xFD, 0x97, 0x0A, 0xFD,
+    0x77, 0x71, 0x9F, 0xCA, 0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4, 0xE6, 0xDA, 0x2A, 0xD7, 0xAD, 0x2D,
+    0x97, 0x0D, 0x19, 0xD7, 0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9, 0x71, 0xD1, 0xD9, 0x70, 0x9D, 0x1D,
+    0x71, 0xAD, 0x1D, 0x71, 0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD, 0x4E, 0x4A,
+    0xD9, 0x49, 0xFA, 0xF9, 0x7A, 0xFC, 0xA7, 0x76, 0x3A, 0xFD, 0x4F, 0xDA, 0x77, 0x19, 0xAA, 0x95,
+    0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D,
+    0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39,
+    0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x79, 0x39, 0x97, 0x09, 0xC9, 0x19, 0xC9, 0x71, 0xFD,
+    0x73, 0xAD, 0xA7, 0x77, 0x29, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD,
+    0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97,
+    0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A,
+    0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x60, 0x39, 0x93, 0x94, 0xAC, 0x2A,
+    0xC4, 0x9F, 0xCA, 0x59, 0xAC, 0xA9, 0x77, 0x29, 0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD,
+    0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9,
+    0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA,
+    0x77, 0x77, 0x73, 0xD9, 0x0A, 0xCA, 0x71, 0xAC, 0xA0, 0x9D, 0x71, 0x9C, 0xA1, 0xCA, 0x72, 0xC9,
+    0x1A, 0xA7, 0x77, 0x39, 0xFC, 0xA7, 0x1F, 0xFC, 0x96, 0xE9, 0x3E, 0x5E, 0x6D, 0xA3, 0xAD, 0x7A,
+    0xD3, 0xD9, 0x70, 0xD2, 0x9D, 0x71, 0xD2, 0xAC, 0xA7, 0x1D, 0x2D, 0x97, 0x1D, 0x2D, 0x97, 0x09,
+    0xD2, 0xD7, 0x1A, 0xD2, 0xD7, 0x1D, 0xA2, 0xD9, 0x79, 0xD9, 0x2D, 0xA7, 0xE3, 0xAD, 0x6A, 0xD5,
+    0xE4, 0xAD, 0x95, 0x9F, 0xAF, 0x97, 0x0A, 0xFC, 0xA7, 0x77, 0x00, 0x77, 0x4D, 0x1D, 0x95, 0xD9,
+    0x0A, 0xC9, 0x5A, 0xC9, 0x09, 0xC9, 0x59, 0xC2, 0xC9, 0x77, 0x59, 0xAA, 0x97, 0x9F, 0xD9, 0x4A,
+    0xDA, 0x99, 0xAD, 0x39, 0xD9, 0x3D, 0xA2, 0xDA, 0x49, 0xD2, 0xD5, 0x9D, 0x19, 0xD5, 0x9D, 0x1A,
+    0xCA, 0x5A, 0xCA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xD2, 0xAC, 0xA4, 0xAC, 0xA2, 0x9D, 0x39, 0xD4,
+    0xAD, 0xAA, 0xE9, 0x5A, 0xFA, 0x77, 0x30, 0x77, 0x73, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xF4, 0xE9,
+    0x3D, 0x72, 0xE4, 0x9D, 0x71, 0xAD, 0x5A, 0xCA, 0x71, 0xD9, 0x5A, 0xCA, 0x70, 0x9D, 0x6D, 0x97,
+    0x0A, 0xCA, 0x6D, 0x99, 0x99, 0x99, 0x3D, 0x95, 0x9F, 0xF9, 0x2D, 0x95, 0xAD, 0xAA, 0xAA, 0xAA,
+    0x3D, 0x6D, 0x97, 0x1D, 0x6D, 0x72, 0xD9, 0x5D, 0x72, 0xDA, 0x49, 0xD7, 0x2A, 0xD4, 0xAC, 0xA7,
+    0x3E, 0x3D, 0x97, 0x39, 0xFA, 0xFF, 0xD7, 0xAF, 0xFF, 0xC7, 0x77, 0x10, 0x49, 0xAA, 0x94, 0x9A,
+    0xA9, 0x49, 0xFD, 0x91, 0xFD, 0x91, 0xAD, 0xA9, 0x9A, 0xD9, 0xDA, 0x90, 0xAD, 0x09, 0xD9, 0x3F,
+    0x92, 0x9D, 0x0D, 0xA4, 0x9D, 0xA3, 0x9D, 0x0D, 0x59, 0xD3, 0x9D, 0x99, 0xCA, 0x59, 0xDA, 0xAF,
+    0x90, 0xAC, 0xA5, 0xAF, 0xDA, 0x2D, 0x95, 0xAC, 0xA7, 0xD9, 0x5D, 0xA7, 0xAC, 0xA4, 0xAE, 0x79,
+    0xD3, 0x9F, 0x93, 0x92, 0xAD, 0xAA, 0xE0, 0xAE, 0xAA, 0xD9, 0x2A, 0xFA, 0x2A, 0xFC, 0xA7, 0x75,
+    0x77, 0x7D, 0xA7, 0x1D, 0xA7, 0x1A, 0xCA, 0x72, 0xC9, 0x77, 0x5F, 0xCA, 0x95, 0x9F, 0xF4, 0xAC,
+    0xA2, 0x9E, 0x3D, 0x93, 0x9D, 0x3D, 0x5D, 0x29, 0xD5, 0xD2, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xDA,
+    0x2D, 0x99, 0x99, 0xAD, 0xA3, 0xFF, 0x93, 0x9D, 0xAA, 0xAD, 0x5A, 0xCA, 0x2D, 0x94, 0xD9, 0x2A,
+    0xCA, 0x4D, 0x39, 0xD4, 0xD4, 0xD9, 0x29, 0xD4, 0xAD, 0x2A, 0xCA, 0x5D, 0x2D, 0x95, 0xDA, 0x10,
+    0x77, 0x39, 0xD7, 0x0D, 0x97, 0xD9, 0x7A, 0xC7, 0x73, 0x92, 0xAA, 0x93, 0xAC, 0x09, 0xE9, 0x3D,
+    0x9C, 0xA9, 0x94, 0xE9, 0x69, 0xDA, 0x79, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7,
+    0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x1D, 0x70, 0x3F, 0xCA, 0x95, 0x9F, 0xF4, 0xAC, 0xA2, 0x9E,
+    0x3D, 0x93, 0x9D, 0x3D, 0x5D, 0x29, 0xD5, 0xD2, 0xAC, 0xA4, 0x9D, 0x2D, 0x94, 0xDA, 0x2D, 0x99,
+    0x99, 0xAD, 0xA3, 0xFF, 0x93, 0x9D, 0xAA, 0xAD, 0x5A, 0xCA, 0x2D, 0x94, 0xD9, 0x2A, 0xCA, 0x4D,
+    0x39, 0xD4, 0xD4, 0xD9, 0x29, 0xD4, 0xAD, 0x2A, 0xCA, 0x5D, 0x2D, 0x95, 0xDA, 0x77, 0x39, 0x97,
+    0x3D, 0x72, 0xAC, 0x97, 0x2C, 0xA7, 0x3A, 0x71, 0x49, 0x2A, 0xA9, 0x3A, 0xC0, 0x9E, 0x93, 0xD9,
+    0xCA, 0x99, 0x4E, 0x96, 0x9D, 0xA7, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70,
+    0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x71, 0xD7, 0x75, 0x99, 0x70, 0x9C, 0xA7, 0x0D, 0x70, 0x9C, 0x97,
+    0x09, 0x97, 0x10, 0x77, 0x3C, 0xA2, 0xD6, 0x9C, 0xA9, 0xD7, 0x0F, 0x71, 0x9D, 0x77, 0x5F, 0xCA,
+    0x95, 0x9F, 0xF4, 0xAC, 0xA2, 0x9E, 0x3D, 0x93, 0x9D, 0x3D, 0x5D, 0x29, 0xD5, 0xD2, 0xAC, 0xA4,
+    0x9D, 0x2D, 0x94, 0xDA, 0x2D, 0x99, 0x99, 0xAD, 0xA3, 0xFF, 0x93, 0x9D, 0xAA, 0xAD, 0x5A, 0xCA,
+    0x2D, 0x94, 0xD9, 0x2A, 0xCA, 0x4D, 0x39, 0xD4, 0xD4, 0xD9, 0x29, 0xD4, 0xAD, 0x2A, 0xCA, 0x5D,
+    0x2D, 0x95, 0xDA, 0x10, 0x77, 0x09, 0xC9, 0x19, 0xCA, 0x5D, 0x0A, 0xCA, 0x7E, 0xA7, 0x0A, 0xCA,
+    0x77, 0x49, 0x2A, 0xA9, 0x4A, 0xC0, 0x9E, 0x94, 0xD9, 0xCA, 0x99, 0x5E, 0x97, 0x9D, 0xA7, 0x09,
+    0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D,
+    0x71, 0x77, 0x6D, 0x97, 0x0D, 0xA7, 0x0A, 0xCA, 0x70, 0x9C, 0x97, 0x74, 0x9F, 0xCA, 0x93, 0xFF,
+    0xA2, 0xAD, 0x93, 0xA9, 0x2D, 0x97, 0x09, 0xD7, 0x19, 0xD7, 0x2D, 0xA7, 0x1A, 0xDA, 0x71, 0xAE,
+    0x97, 0x09, 0xEA, 0x71, 0xAD, 0xA7, 0x1A, 0xD7, 0x2D, 0x72, 0xD7, 0x1A, 0xD1, 0x99, 0x49, 0xDA,
+    0x1A, 0xEA, 0xFA, 0x29, 0xFE, 0x97, 0x70, 0x77, 0x2D, 0xA6, 0xDA, 0x6A, 0xCA, 0x7C, 0x97, 0x71,
+    0x9A, 0xAA, 0x94, 0xFE, 0x2E, 0x90, 0x9A, 0xA2, 0xD7, 0x9D, 0x70, 0xDA, 0x79, 0xE9, 0x7E, 0xA7,
+    0x9D, 0xA7, 0x9D, 0x70, 0xD1, 0x94, 0xAD, 0x1D, 0xAA, 0xAE, 0x91, 0xAF, 0xD9, 0x75, 0x77, 0x39,
+    0xDA, 0x70, 0xF7, 0xD1, 0xD5, 0xCA, 0x29, 0xC9, 0x77, 0x19, 0xFC, 0xA9, 0x3F, 0xFA, 0x2A, 0xD9,
+    0x3A, 0x92, 0xD9, 0x70, 0x9D, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0xAD, 0xA7, 0x1A, 0xE9, 0x70, 0x9E,
+    0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0x72, 0xD7, 0x2D, 0x71, 0xAD, 0x19, 0x94, 0x9D, 0xA1, 0xAE, 0xAF,
+    0xA2, 0x9F, 0xE9, 0x77, 0x00, 0x77, 0x0D, 0xA6, 0xF9, 0x4D, 0x1D, 0x3C, 0xA3, 0xC9, 0x76, 0x9A,
+    0xAA, 0x94, 0xFE, 0x2E, 0x90, 0x9A, 0xA2, 0xD7, 0x9D, 0x70, 0xDA, 0x79, 0xE9, 0x7E, 0xA7, 0x9D,
+    0xA7, 0x9D, 0x70, 0xD1, 0x94, 0xAD, 0x1D, 0xAA, 0xAE, 0x91, 0xAF, 0xD9, 0x75, 0x77, 0x19, 0xFC,
+    0xA9, 0x3F, 0xFA, 0x2A, 0xD9, 0x3A, 0x92, 0xD9, 0x70, 0x9D, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0xAD,
+    0xA7, 0x1A, 0xE9, 0x70, 0x9E, 0xA7, 0x1A, 0xDA, 0x71, 0xAD, 0x72, 0xD7, 0x2D, 0x71, 0xAD, 0x19,
+    0x94, 0x9D, 0xA1, 0xAE, 0xAF, 0xA2, 0x9F, 0xE9, 0x7C, 0xA7, 0x19, 0xCA, 0x72, 0xAC, 0xA7, 0x2C,
+    0xA7, 0x99, 0xAC, 0x97, 0xE9, 0x60, 0x39, 0xAA, 0xA9, 0x4F, 0xE2, 0xE9, 0x09, 0xAA, 0x2D, 0x79,
+    0xD7, 0x0D, 0xA7, 0x9E, 0x97, 0xEA, 0x79, 0xDA, 0x79, 0xD7, 0x0D, 0x19, 0x4A, 0xD1, 0xDA, 0xAA,
+    0xE9, 0x1A, 0xFD, 0x95, 0xCA, 0x79, 0xCA, 0x70, 0xAC, 0xA7, 0x0D, 0x59, 0x9A, 0xCA, 0x5E, 0x95,
+    0x77, 0x3C, 0xA2, 0xD6, 0xAC, 0x99, 0xD7, 0x0F, 0x71, 0x9D, 0x77, 0x69, 0xFC, 0xA9, 0x4F, 0xFA,
+    0x3A, 0xD9, 0x3A, 0x93, 0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x73, 0xDA, 0x72, 0xAD, 0xA7, 0x2A, 0xE9,
+    0x71, 0x9E, 0xA7, 0x2A, 0xDA, 0x72, 0xAD, 0x73, 0xD7, 0x3D, 0x72, 0xAD, 0x29, 0x94, 0x9D, 0xA2,
+    0xAE, 0xAF, 0xA3, 0x9F, 0xE9, 0x77, 0x20, 0x77, 0xCA, 0x2D, 0x49, 0xCA, 0x9D, 0x6F, 0x79, 0xD7,
+    0x73, 0x9A, 0xAA, 0x95, 0xFE, 0x3E, 0x90, 0x9A, 0xA3, 0xD7, 0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xE9,
+    0x70, 0xEA, 0x70, 0x9D, 0xA7, 0x09, 0xD7, 0x1D, 0x29, 0x4A, 0xD2, 0xDA, 0xAA, 0xE9, 0x2A, 0xFD,
+    0x97, 0x70, 0x09, 0xFF, 0xEA, 0x0A, 0xFF, 0xE9, 0x5D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0xAC, 0xA7,
+    0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72,
+    0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xCA, 0x72, 0x9C, 0x97, 0x3A, 0xCA, 0x73, 0xCA,
+    0x70, 0x99, 0xD9, 0x70, 0xE9, 0x70, 0x49, 0x79, 0xC7, 0xD6, 0xAD, 0x99, 0x91, 0xAF, 0xE2, 0x9D,
+    0xA9, 0x94, 0xD6, 0x9D, 0x6A, 0xCA, 0x6A, 0xCA, 0x6D, 0x96, 0xD6, 0x9D, 0x6A, 0xCA, 0x6A, 0xCA,
+    0x69, 0xDA, 0xAA, 0x4A, 0xEA, 0x5C, 0x96, 0xAC, 0x96, 0x9D, 0x96, 0x9C, 0x94, 0x99, 0xD5, 0xE9,
+    0x40, 0x77, 0x0D, 0x2A, 0xC5, 0x9C, 0xA0, 0xD7, 0xF7, 0x09, 0xD9, 0x77, 0x09, 0xFF, 0xEA, 0xAF,
+    0xFE, 0x94, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD7, 0x19,
+    0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71,
+    0xD7, 0x00, 0x7D, 0x7A, 0xC9, 0x49, 0x1C, 0xA4, 0x9C, 0x0A, 0xC5, 0xD7, 0xAD, 0x99, 0x92, 0xAF,
+    0xE3, 0x9D, 0xA9, 0x95, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x79, 0xDA, 0xAA, 0x5A, 0xEA, 0x77, 0x9F, 0xFE, 0xAA, 0xFF, 0xE9, 0x4D, 0x97, 0x1D,
+    0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x95, 0xAF, 0xFA, 0x2A, 0xFF, 0x95, 0xAC, 0xA7,
+    0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x70, 0x49, 0x79,
+    0xC7, 0xD6, 0xAD, 0x99, 0x91, 0xAF, 0xE2, 0x9D, 0xA9, 0x94, 0xD6, 0x9D, 0x5A, 0xEA, 0xA9, 0x19,
+    0xFD, 0x93, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xAC, 0xA6, 0x9D, 0xAA, 0xA4, 0xAE, 0xA7, 0x40,
+    0x79, 0x49, 0x70, 0xF9, 0x0A, 0xC7, 0xAC, 0xAA, 0xF9, 0x7C, 0x92, 0xAC, 0x97, 0x76, 0x9C, 0xA7,
+    0xD3, 0xAC, 0xA6, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xAC, 0x92, 0x9D, 0x7D, 0x92, 0xAC, 0xA7,
+    0xD3, 0xD9, 0x69, 0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x29, 0xD7, 0xD3, 0xAC, 0xA7, 0xD3, 0xD9,
+    0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7D, 0x93, 0xD9, 0x5A, 0xD4, 0xAD, 0x4A, 0xD9, 0x5F, 0xAF,
+    0x97, 0xAF, 0xD9, 0x77, 0x60, 0x59, 0x49, 0x4E, 0xA1, 0xCA, 0x3D, 0x9F, 0xC4, 0xC9, 0x19, 0xD9,
+    0x77, 0x99, 0x69, 0x91, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x91, 0xD5, 0xD1, 0x9D, 0x49, 0xD1, 0xAC,
+    0xA4, 0x9C, 0xA1, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x90, 0x9D, 0x49, 0xD1, 0x9C, 0xA4, 0xE1, 0xAC,
+    0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x19, 0xEA, 0xD9, 0xAC, 0x3A, 0xF9, 0x0D, 0x77, 0x6F, 0xDA,
+    0x71, 0xFD, 0x97, 0x76, 0x9C, 0xA7, 0xD3, 0xAC, 0xA6, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xAC,
+    0x92, 0x9D, 0x7D, 0x92, 0xAC, 0xA7, 0xD3, 0xD9, 0x69, 0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x29,
+    0xD7, 0xD3, 0xAC, 0xA7, 0xD3, 0xD9, 0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7D, 0x93, 0xD9, 0x5A,
+    0xD4, 0xAD, 0x4A, 0xD9, 0x5F, 0xAF, 0x97, 0xAF, 0xD9, 0x77, 0x60, 0x4F, 0xDA, 0x49, 0xFD, 0x97,
+    0x79, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA,
+    0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x69, 0x4A,
+    0x71, 0xCA, 0x2A, 0xC7, 0x1A, 0xFC, 0x97, 0x29, 0xDA, 0x77, 0x70, 0x9C, 0xA7, 0xD3, 0xAC, 0xA6,
+    0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xAC, 0x92, 0x9D, 0x7D, 0x92, 0xAC, 0xA7, 0xD3, 0xD9, 0x69,
+    0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x29, 0xD7, 0xD3, 0xAC, 0xA7, 0xD3, 0xD9, 0x69, 0xD3, 0xD9,
+    0x6A, 0xCA, 0x3D, 0x7D, 0x93, 0xD9, 0x5A, 0xD4, 0xAD, 0x4A, 0xD9, 0x5F, 0xAF, 0x97, 0xAF, 0xD9,
+    0x77, 0x60, 0x4A, 0x49, 0x5C, 0xA2, 0xCA, 0x5A, 0xFC, 0x7A, 0xDA, 0x77, 0x19, 0x96, 0x99, 0x1D,
+    0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA, 0x49, 0xCA, 0x1D, 0x94,
+    0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2,
+    0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x71, 0x97, 0x5A, 0xE9, 0x72, 0x9C,
+    0x19, 0xC7, 0x29, 0xC1, 0x9C, 0x73, 0xCA, 0x9D, 0x74, 0xAC, 0xA7, 0x77, 0x09, 0xCA, 0x7D, 0x3A,
+    0xCA, 0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D, 0x3D,
+    0x96, 0x9D, 0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D,
+    0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9, 0x7A,
+    0xFD, 0x97, 0x76, 0x69, 0x97, 0x1F, 0x96, 0x9C, 0x1A, 0xC6, 0xAC, 0x19, 0xC7, 0xCA, 0x9C, 0xA7,
+    0x9D, 0xA7, 0x71, 0x99, 0x69, 0x91, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x91, 0xD5, 0xD1, 0x9D, 0x49,
+    0xD1, 0xAC, 0xA4, 0x9C, 0xA1, 0xD9, 0x4A, 0xCA, 0x1D, 0x5D, 0x90, 0x9D, 0x49, 0xD1, 0x9C, 0xA4,
+    0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x19, 0xEA, 0xD9, 0xAC, 0x3A, 0xF9, 0x0D, 0x77,
+    0x77, 0x71, 0x9D, 0x1D, 0x71, 0xD1, 0xD9, 0x70, 0xD1, 0xAC, 0x97, 0x0A, 0xA1, 0x9C, 0x77, 0x79,
+    0xCA, 0x7D, 0x3A, 0xCA, 0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A,
+    0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D,
+    0x3D, 0x96, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95,
+    0xFA, 0xF9, 0x7A, 0xFD, 0x97, 0x76, 0x77, 0x5A, 0xCA, 0x09, 0xD6, 0x9D, 0x1D, 0x7D, 0x1D, 0x7A,
+    0xA1, 0x9A, 0x77, 0x49, 0x96, 0x99, 0x3D, 0x94, 0xAC, 0xA3, 0xD5, 0xD9, 0x3D, 0x5D, 0x39, 0xD4,
+    0x9D, 0x3A, 0xCA, 0x49, 0xCA, 0x3D, 0x94, 0xAC, 0xA3, 0xD5, 0xD9, 0x29, 0xD4, 0x9D, 0x39, 0xCA,
+    0x4E, 0x3A, 0xCA, 0x39, 0xDA, 0x3A, 0xD2, 0x9E, 0x93, 0x9E, 0xAD, 0x9A, 0xC5, 0xAF, 0x90, 0xD7,
+    0x73, 0x29, 0xCA, 0x7D, 0x3A, 0xCA, 0x69, 0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7,
+    0xD9, 0x2A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A,
+    0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4,
+    0xAD, 0x95, 0xFA, 0xF9, 0x7A, 0xFD, 0x97, 0x29, 0xCA, 0x74, 0x9C, 0xA7, 0x5D, 0x76, 0xD7, 0x6A,
+    0xDA, 0x75, 0x99, 0x71, 0x19, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19,
+    0xD4, 0x9D, 0x1A, 0xCA, 0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19,
+    0xCA, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90,
+    0xD7, 0x1A, 0xC7, 0x1A, 0xC7, 0x19, 0xC9, 0x71, 0x9C, 0x97, 0x2E, 0x72, 0x99, 0x30, 0x77, 0x77,
+    0xAD, 0x97, 0x70, 0xAF, 0x77, 0xAC, 0xA0, 0xAC, 0x97, 0x59, 0xC9, 0x2A, 0xC7, 0x77, 0x49, 0xCA,
+    0x6D, 0x6D, 0x99, 0xD5, 0xAD, 0x94, 0x9D, 0x1D, 0x5E, 0x94, 0xDA, 0x1D, 0x4A, 0xE9, 0x4D, 0x2D,
+    0x4D, 0x9C, 0x93, 0xAC, 0xA2, 0xD3, 0xAC, 0x99, 0xCA, 0x3D, 0x3D, 0x3D, 0x09, 0xCA, 0x2A, 0xCA,
+    0x3D, 0x29, 0xCA, 0x09, 0xCA, 0x2D, 0x4D, 0x2D, 0x19, 0xCA, 0x19, 0xD4, 0xD1, 0x9C, 0xA2, 0xCA,
+    0x1D, 0x94, 0xD1, 0xD3, 0xCA, 0x09, 0xD5, 0xD0, 0x9C, 0xA3, 0xD0, 0xAC, 0x95, 0xD0, 0xAC, 0x93,
+    0xD0, 0xD6, 0xD9, 0xD4, 0xD9, 0xCA, 0x6A, 0xCA, 0xC9, 0x4F, 0x7A, 0xE5, 0xEA, 0x7A, 0xD9, 0x5E,
+    0x70, 0xAD, 0x6D, 0xA7, 0x77, 0x72, 0x9D, 0x97, 0x59, 0xF7, 0x49, 0xCA, 0x09, 0xCA, 0x72, 0x9C,
+    0x92, 0x9C, 0x77, 0x71, 0x95, 0x99, 0x59, 0x90, 0xAC, 0xA3, 0xAD, 0x93, 0xAC, 0xA0, 0xAC, 0xA3,
+    0xE9, 0x3D, 0x19, 0xCA, 0x29, 0xCA, 0xC9, 0x2A, 0xCA, 0x19, 0xCA, 0x2D, 0x9C, 0xA2, 0xD2, 0x9C,
+    0xA1, 0x9C, 0xA0, 0xCA, 0x19, 0xD2, 0x9C, 0xA1, 0xD1, 0xCA, 0x1D, 0x92, 0x9D, 0x09, 0xCA, 0x1C,
+    0xA0, 0x9D, 0x39, 0xD0, 0xAC, 0x2C, 0xA0, 0xD9, 0x4D, 0x0C, 0xA2, 0xD0, 0xD5, 0xDA, 0xC3, 0xDA,
+    0xC9, 0x5E, 0xA3, 0xF6, 0xE9, 0x3E, 0xA6, 0xE4, 0xE6, 0x77, 0x3E, 0x71, 0xF9, 0x7D, 0x90, 0xD6,
+    0xAC, 0x3C, 0xA7, 0x70, 0xAC, 0xA6, 0xAC, 0xA0, 0x9D, 0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC,
+    0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9, 0x5D, 0x1A, 0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97,
+    0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97,
+    0x2D, 0x71, 0x77, 0x70, 0xE7, 0x3F, 0xA7, 0x1D, 0x90, 0xD7, 0x0A, 0xC3, 0xCA, 0x77, 0x59, 0x97,
+    0x99, 0x3A, 0xCA, 0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0xD9, 0x5D, 0x3A, 0xD6, 0xD3, 0xD7,
+    0xD2, 0xAC, 0xA7, 0xD9, 0x1D, 0x70, 0xAC, 0x90, 0xAC, 0xA7, 0x09, 0xC9, 0x0D, 0x71, 0x9C, 0xAA,
+    0xC9, 0x72, 0xCA, 0xD7, 0x3E, 0x97, 0x3E, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xD7, 0x4D, 0xA7, 0x09,
+    0xFC, 0x71, 0x9E, 0xA7, 0x20, 0x77, 0x1D, 0x19, 0xCA, 0x6D, 0x19, 0xCA, 0x77, 0x76, 0xAC, 0xA6,
+    0xAC, 0xA0, 0x9D, 0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2,
+    0xD9, 0x5D, 0x1A, 0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72,
+    0xD7, 0x29, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x71, 0x77, 0x72, 0xAD, 0x73,
+    0x9D, 0x74, 0xD7, 0x4A, 0xA7, 0x77, 0x09, 0xFF, 0xD4, 0xAF, 0xFD, 0x73, 0x9D, 0xA7, 0x3D, 0xA7,
+    0x3A, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xD9, 0x73,
+    0xDA, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3F, 0xFE, 0x4F, 0xFE, 0x30, 0x77, 0x5A, 0xD7,
+    0x09, 0xD7, 0x1D, 0x71, 0xAA, 0x77, 0x49, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xF4, 0x99, 0x99, 0x9D,
+    0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09, 0xD7, 0x1D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09,
+    0xD7, 0x09, 0xD7, 0x1E, 0xAA, 0xAA, 0xAA, 0x29, 0xFF, 0xA2, 0x71, 0x97, 0x59, 0xD7, 0x4A, 0xD7,
+    0x59, 0x77, 0x70, 0x9F, 0xFD, 0x4A, 0xFF, 0xD7, 0x39, 0xDA, 0x73, 0xDA, 0x73, 0xAD, 0x73, 0x9D,
+    0x74, 0xD9, 0x73, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7,
+    0x3A, 0xD7, 0x39, 0xD9, 0x73, 0xFF, 0xE4, 0xFF, 0xE3, 0x79, 0x71, 0x9D, 0x70, 0xAD, 0x71, 0x97,
+    0x72, 0x99, 0x99, 0x99, 0x99, 0x29, 0xFF, 0x39, 0x99, 0x99, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xD7,
+    0x0D, 0x97, 0xD9, 0x7D, 0xA7, 0xAD, 0x79, 0xD7, 0x9D, 0x70, 0xEA, 0xAA, 0xAA, 0xA1, 0x9F, 0xFA,
+    0x10, 0x77, 0x6A, 0xC2, 0x9C, 0xA7, 0x0D, 0x0A, 0xCA, 0x71, 0x9E, 0xA7, 0x3D, 0xA7, 0x77, 0x9F,
+    0xFD, 0x4A, 0xFF, 0xD7, 0x39, 0xDA, 0x73, 0xDA, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xDA,
+    0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3A, 0xD7, 0x3A, 0xD7, 0x39, 0xD9,
+    0x73, 0xFF, 0xE4, 0xFF, 0xE3, 0x77, 0x1A, 0xC2, 0xAC, 0x95, 0xD0, 0xAC, 0x96, 0x9E, 0x97, 0x0D,
+    0xA7, 0x73, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFF, 0x49, 0x99, 0x99, 0xD9, 0x70, 0xDA, 0x70, 0xAD,
+    0x70, 0x9D, 0x71, 0xD9, 0x70, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x70, 0x9D, 0x71, 0xEA,
+    0xAA, 0xAA, 0xA2, 0x9F, 0xFA, 0x20, 0x77, 0x79, 0xF9, 0x70, 0xEA, 0xC9, 0x7A, 0xCA, 0x73, 0xD7,
+    0x39, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73, 0xAC,
+    0x97, 0x3D, 0x97, 0x3D, 0x73, 0x9D, 0x73, 0xAC, 0xA7, 0x3D, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xD7,
+    0x3A, 0xCA, 0x73, 0xD9, 0x72, 0xAD, 0x71, 0xF9, 0x71, 0xE9, 0x71, 0x77, 0x0A, 0xD5, 0x9F, 0xCA,
+    0x3D, 0x94, 0xFF, 0xC9, 0x0A, 0xD4, 0xE9, 0x3E, 0xAD, 0x4E, 0x6E, 0x94, 0xAD, 0x7A, 0xD5, 0xD9,
+    0x70, 0xD4, 0x9D, 0x71, 0xD4, 0xAC, 0xA7, 0x1D, 0x4D, 0x97, 0x1D, 0x4D, 0x97, 0x09, 0xD4, 0xD7,
+    0x1A, 0xD4, 0xD7, 0x1D, 0xA4, 0xD9, 0x79, 0xD9, 0x4D, 0xA7, 0xE5, 0xAD, 0x6A, 0xD7, 0xE4, 0xAD,
+    0x97, 0x9F, 0xAF, 0x97, 0x2A, 0xFC, 0xA7, 0x77, 0x40, 0x74, 0x99, 0x97, 0x4D, 0x94, 0x9A, 0xA9,
+    0x29, 0xD3, 0x9F, 0xD9, 0x0D, 0x92, 0xAD, 0xA9, 0x9A, 0xF9, 0x29, 0xD9, 0x3D, 0xA4, 0xDA, 0x49,
+    0xD4, 0xD5, 0x9D, 0x39, 0xD5, 0x9D, 0x3A, 0xCA, 0x5A, 0xCA, 0x3D, 0x95, 0xDA, 0x3D, 0x95, 0xD4,
+    0xAC, 0xA4, 0xAC, 0xA4, 0x9D, 0x39, 0xD6, 0xAD, 0xAA, 0xE9, 0x7A, 0xFA, 0x77, 0x70, 0x77, 0x75,
+    0x9F, 0xCA, 0x29, 0xFA, 0x6F, 0xFC, 0x0A, 0xFE, 0x4E, 0x92, 0x9F, 0xA2, 0x9D, 0x92, 0xE5, 0x9D,
+    0xA4, 0xD9, 0x1A, 0xD7, 0xAC, 0xA4, 0xD9, 0x1D, 0x97, 0x9D, 0x4D, 0x90, 0x9D, 0x70, 0x9D, 0x4D,
+    0x1A, 0xCA, 0x70, 0x9D, 0x39, 0xD1, 0xD9, 0x70, 0x9D, 0x3A, 0xCA, 0x1D, 0x97, 0x0A, 0xD3, 0xD9,
+    0x1D, 0x71, 0xDA, 0x3D, 0x2D, 0x71, 0xD9, 0x3D, 0x2D, 0x97, 0xAD, 0x39, 0xD2, 0xDA, 0x7D, 0xA3,
+    0xAC, 0xA2, 0xAD, 0x6E, 0x4D, 0x93, 0xE4, 0xE9, 0x4D, 0x49, 0xFA, 0xF9, 0x49, 0xD6, 0xAF, 0xCA,
+    0x69, 0xD7, 0x77, 0x20, 0x49, 0xAA, 0x93, 0xAA, 0x94, 0x9F, 0xD0, 0xAF, 0xC2, 0xAD, 0xA9, 0x9F,
+    0x90, 0x9D, 0x90, 0x9D, 0x93, 0xD9, 0x2A, 0xCA, 0x0D, 0xA4, 0xD9, 0x2A, 0xC9, 0x0D, 0x5A, 0xCA,
+    0x2D, 0x99, 0xD5, 0xD9, 0x2D, 0x0A, 0xCA, 0x5D, 0x91, 0x9D, 0x0D, 0x95, 0xD2, 0xAC, 0xA0, 0xD9,
+    0x49, 0xD2, 0xAC, 0x90, 0xAC, 0xA4, 0xD9, 0x2D, 0x90, 0x9D, 0x3E, 0x3D, 0x2E, 0xAA, 0xE3, 0x9D,
+    0x3A, 0xFA, 0x4A, 0xCA, 0x76, 0xD9, 0x76, 0xD7, 0x7D, 0x76, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x92,
+    0x1A, 0xFE, 0xA9, 0x29, 0xFF, 0xF1, 0xDA, 0x0D, 0x92, 0xAD, 0xA0, 0xD1, 0xD4, 0xAD, 0x0A, 0xA0,
+    0x9D, 0x49, 0xD3, 0x9D, 0x49, 0xD3, 0xAC, 0xA4, 0x9D, 0x3D, 0x94, 0xDA, 0x3D, 0x39, 0xE3, 0x9F,
+    0xFC, 0x4A, 0xFD, 0xA9, 0x5A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73, 0xD9,
+    0x73, 0xD7, 0x30, 0x77, 0x4A, 0xE7, 0x19, 0xF7, 0x1D, 0xA7, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x19,
+    0xAA, 0x6A, 0xC9, 0x9F, 0xC5, 0xDA, 0xCA, 0x99, 0xE4, 0xE9, 0x3D, 0x39, 0xDA, 0x4D, 0x3A, 0xD5,
+    0xD3, 0xAC, 0xA5, 0xD3, 0xD9, 0x49, 0xD3, 0xD5, 0xAD, 0x29, 0xD5, 0xD9, 0x2A, 0xD4, 0x9D, 0x3E,
+    0xA2, 0x9D, 0x93, 0xD9, 0xDA, 0xEA, 0x4D, 0x09, 0xF9, 0x49, 0xD7, 0x3A, 0xCA, 0x73, 0xD9, 0x73,
+    0xD7, 0x4D, 0x73, 0x9C, 0xA7, 0x30, 0x3D, 0x71, 0x9C, 0xA7, 0x1A, 0xCA, 0x99, 0x96, 0xFE, 0xA4,
+    0xDA, 0xAA, 0xF2, 0x9D, 0x4D, 0x91, 0xAC, 0xA4, 0xAC, 0xA1, 0xD9, 0x4A, 0xCA, 0x1D, 0x94, 0xDA,
+    0x1D, 0x5D, 0x90, 0x9D, 0x39, 0xDA, 0x1A, 0xFF, 0xA2, 0xFE, 0xA4, 0xD9, 0x1A, 0xCA, 0x4D, 0x29,
+    0xD3, 0x9D, 0x3D, 0x92, 0xAC, 0xA3, 0xAC, 0xA2, 0xD9, 0x39, 0xD7, 0x2D, 0x97, 0x1A, 0xD7, 0x2A,
+    0xA1, 0x77, 0x19, 0xAF, 0xA6, 0xFF, 0x59, 0x93, 0xE7, 0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xD7, 0x19,
+    0xDA, 0x79, 0xF6, 0xAF, 0xA5, 0xAF, 0xA5, 0x9E, 0xA9, 0x7E, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0x9D,
+    0x73, 0xDA, 0x49, 0x4A, 0xEA, 0xAE, 0x5A, 0xFD, 0xA7, 0x71, 0x39, 0xAA, 0xA9, 0x39, 0xFE, 0x3C,
+    0xA9, 0x09, 0xD9, 0x7A, 0xCA, 0x7A, 0xCA, 0x6A, 0xD4, 0xAF, 0x92, 0xFC, 0x93, 0xE9, 0x5A, 0xD7,
+    0xAC, 0x97, 0xAC, 0xA4, 0x92, 0xEA, 0xAA, 0xCA, 0x29, 0xFD, 0x97, 0x40, 0x4F, 0xFD, 0x49, 0xFF,
+    0xD4, 0x9D, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0xAC, 0xA7, 0x39,
+    0xD7, 0x4D, 0x74, 0xD9, 0x73, 0xD9, 0x73, 0xAC, 0xA7, 0x39, 0xD7, 0x39, 0xD7, 0x4F, 0xFE, 0x4F,
+    0xFE, 0x30, 0x79, 0xF1, 0xDA, 0xDA, 0x9C, 0xA0, 0x9C, 0xA9, 0xDA, 0xAC, 0xA0, 0xAF, 0x92, 0x9D,
+    0x4D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x39, 0xD3, 0x9C, 0xA3, 0xAC, 0xA3, 0xD9, 0x3D, 0x39,
+    0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x4D, 0x39, 0xD3, 0x9D, 0x4F, 0xC1, 0x9E, 0xA0, 0x39, 0x69, 0xC6,
+    0xD5, 0xAD, 0x99, 0x90, 0xAF, 0xE1, 0x9D, 0xA9, 0x93, 0xD5, 0x9D, 0x5A, 0xCA, 0x5A, 0xCA, 0x5D,
+    0x95, 0xD5, 0x9D, 0x5A, 0xCA, 0x5A, 0xCA, 0x59, 0xDA, 0xAA, 0x3A, 0xEA, 0x5A, 0xC9, 0x5D, 0x6D,
+    0x59, 0xCA, 0x3A, 0xE9, 0x39, 0xD9, 0x40, 0x1A, 0xFF, 0xDA, 0x9F, 0xFF, 0x9D, 0xA2, 0xD9, 0x4D,
+    0x3D, 0x5A, 0xA2, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0xAC,
+    0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x70, 0x74,
+    0x9E, 0xA3, 0xFA, 0x2A, 0xCA, 0x5D, 0x6D, 0x5A, 0xD9, 0x99, 0x0A, 0xFE, 0x19, 0xDA, 0x99, 0x3D,
+    0x59, 0xD5, 0xAC, 0xA5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xAC, 0xA5, 0x9D, 0xAA,
+    0xA3, 0xAE, 0xA7, 0x30, 0x9F, 0xFE, 0xAA, 0xFF, 0xE9, 0x4D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC,
+    0xA7, 0x1D, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D,
+    0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAD, 0x71, 0xAC, 0xA7, 0x1D,
+    0xA7, 0x1A, 0xF7, 0x0A, 0xDA, 0x60, 0x77, 0x1D, 0xA2, 0x9C, 0xA7, 0xD1, 0xD9, 0x2A, 0xCA, 0x69,
+    0xD0, 0xAC, 0xA3, 0xD9, 0x6A, 0xFA, 0x4D, 0x7A, 0xE9, 0x49, 0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D,
+    0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D,
+    0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9, 0x7D, 0x95, 0xAD, 0x70, 0xAD, 0x4A, 0xD9, 0x71, 0xFA, 0xF9,
+    0x73, 0xAF, 0xD9, 0x77, 0x76, 0x76, 0x99, 0x77, 0xD2, 0x99, 0x69, 0x90, 0xAD, 0x2D, 0x94, 0xAC,
+    0xA9, 0xD3, 0xD5, 0xFC, 0x4D, 0x5D, 0xA9, 0x49, 0xD4, 0x9D, 0x6A, 0xCA, 0x49, 0xCA, 0x6D, 0x94,
+    0xAC, 0x96, 0xD5, 0xD9, 0x59, 0xD4, 0x9D, 0x69, 0xCA, 0x4E, 0x6A, 0xCA, 0x39, 0xDA, 0x6A, 0xD2,
+    0x9E, 0x96, 0x9E, 0xAD, 0x9A, 0xC7, 0x0A, 0xF9, 0x0D, 0x77, 0x71, 0x49, 0xD2, 0xD9, 0x2D, 0x29,
+    0xC9, 0x70, 0xD9, 0x1D, 0x91, 0xAC, 0x91, 0x9C, 0x92, 0x74, 0xE4, 0xF9, 0x2D, 0x90, 0xD1, 0xAA,
+    0x3C, 0x90, 0x29, 0x49, 0x09, 0xEA, 0x1C, 0x90, 0xD9, 0xFC, 0x1C, 0x29, 0xCA, 0x10, 0x9F, 0xD9,
+    0xAF, 0xD0, 0x73, 0xFF, 0xCA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0A, 0x49, 0x0C, 0xA2, 0xCA,
+    0x0F, 0xD2, 0xAD, 0xA1, 0x19, 0x1D, 0x90, 0xD9, 0x19, 0x00, 0x70, 0xD1, 0xAC, 0xA0, 0xD1, 0xAC,
+    0x97, 0x09, 0x99, 0x2F, 0x3A, 0xC2, 0x9D, 0x1D, 0xA2, 0xCA, 0x39, 0x30, 0x29, 0x3A, 0xEA, 0x1C,
+    0x90, 0x9C, 0x09, 0xC2, 0xC1, 0xCA, 0x9D, 0x2A, 0xCA, 0x10, 0x74, 0xD1, 0xD9, 0x1D, 0x90, 0xAC,
+    0xA1, 0xAC, 0x90, 0x9C, 0x91, 0x9C, 0x2C, 0x92, 0x71, 0xD2, 0xAC, 0x19, 0xCA, 0x0D, 0x3A, 0xE4,
+    0x9D, 0x92, 0x1D, 0x09, 0xCA, 0x0A, 0xC9, 0x0D, 0x1D, 0x1D, 0x1A, 0x90, 0x09, 0xCA, 0x09, 0xCA,
+    0x09, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0D, 0x1D, 0x1D, 0x70, 0x72, 0xD9, 0x0D, 0xA2, 0x9C, 0xA1,
+    0xD3, 0xAC, 0x19, 0xC9, 0x3C, 0xA1, 0xAC, 0x00, 0x73, 0x9C, 0xA5, 0xAD, 0x3A, 0x09, 0xA1, 0x91,
+    0xCA, 0x2D, 0x1A, 0xFC, 0x3A, 0xDA, 0x20, 0x29, 0x99, 0x29, 0xFC, 0x1C, 0xA9, 0x9A, 0xC9, 0x9A,
+    0x3C, 0x90, 0x2A, 0xC2, 0x9C, 0xA2, 0xD2, 0x9D, 0x2D, 0x91, 0x9D, 0x39, 0x30, 0x19, 0xD2, 0xAC,
+    0xA2, 0xD2, 0xAC, 0xA2, 0xD2, 0x9C, 0x93, 0x93, 0x9C, 0xA0, 0x9D, 0x09, 0xD1, 0xD1, 0xD1, 0xAC,
+    0x29, 0x00, 0x19, 0xD2, 0xAC, 0xA2, 0xD2, 0xAC, 0xA2, 0xD2, 0x9C, 0x93, 0x93, 0x49, 0xD2, 0xAC,
+    0x92, 0xD3, 0xC9, 0x79, 0xD9, 0x1D, 0x91, 0xAC, 0x91, 0x9C, 0x92, 0x39, 0x4C, 0xA0, 0xAA, 0xAC,
+    0x90, 0xF3, 0xAC, 0x39, 0x90, 0x19, 0x3D, 0x3D, 0xAA, 0x90, 0xF0, 0x9C, 0x92, 0x99, 0x30, 0x9F,
+    0xDA, 0x0A, 0xAA, 0xAA, 0xC9, 0x4A, 0xC5, 0xAC, 0x5C, 0xA5, 0xC9, 0x49, 0xC1, 0x2D, 0x91, 0x9D,
+    0x2D, 0x90, 0x9D, 0xA1, 0xD9, 0x70, 0x19, 0xA1, 0x9C, 0xA1, 0xCA, 0x2C, 0x92, 0xAC, 0x3A, 0x10,
+    0x19, 0xC3, 0xAC, 0x29, 0xD9, 0x0F, 0xC9, 0x50, 0x0F, 0xC0, 0x9A, 0xDA, 0xA2, 0xD4, 0xCA, 0x71,
+    0x29, 0x39, 0xC9, 0x1A, 0xDA, 0x9A, 0xFA, 0x1C, 0xA3, 0xA9, 0x10, 0x09, 0x99, 0x90, 0xFC, 0xA5,
+    0x70, 0xAC, 0x92, 0xD9, 0x2D, 0x3D, 0x2A, 0xCA, 0x0F, 0x1A, 0xD9, 0x10, 0x5A, 0xC9, 0x1D, 0x91,
+    0xD2, 0xD1, 0x9D, 0x2F, 0x09, 0xDA, 0x09, 0x90, 0x9D, 0x09, 0xD1, 0x91, 0x70, 0xD1, 0xAC, 0x99,
+    0xD1, 0xD9, 0x70, 0x19, 0x92, 0xF0, 0xAC, 0x1C, 0xAA, 0xA1, 0xAA, 0x9C, 0xAA, 0xC9, 0x09, 0xD9,
+    0x00, 0x29, 0x91, 0xAC, 0x91, 0xCA, 0x1A, 0xC2, 0xA2, 0x2C, 0x92, 0x9C, 0x93, 0xAC, 0x92, 0x9C,
+    0xA0, 0x99, 0xD9, 0x0E, 0x90, 0x1A, 0xC1, 0xD1, 0x9C, 0x91, 0xAC, 0x91, 0x9E, 0x29, 0x90, 0x1D,
+    0x09, 0xCA, 0x0A, 0xC9, 0x0D, 0x1D, 0x09, 0xCA, 0x09, 0xA9, 0x00, 0x0F, 0xFA, 0x0D, 0xAA, 0xAA,
+    0xAC, 0xA9, 0xC5, 0xC9, 0xAC, 0x49, 0xC0, 0x99, 0x49, 0x90, 0x09, 0x29, 0x29, 0x09, 0xC1, 0xAC,
+    0x1A, 0xC1, 0xFF, 0x92, 0x99, 0x19, 0x92, 0x71, 0xCA, 0x2D, 0x19, 0xCA, 0x9D, 0x3F, 0x49, 0xD3,
+    0x72, 0xE3, 0xF9, 0x1D, 0x90, 0xD0, 0xAA, 0x3C, 0xA0, 0x0A, 0x49, 0x1C, 0xA2, 0xCA, 0x1F, 0xD3,
+    0xAD, 0xA2, 0x29, 0x99, 0x29, 0xFC, 0x1D, 0x99, 0xAC, 0xA9, 0xC3, 0xAA, 0x29, 0x39, 0x19, 0xEA,
+    0x09, 0xC9, 0x0C, 0xAA, 0xFC, 0x09, 0xC2, 0xAC, 0xA1, 0x9F, 0xD9, 0x9F, 0xD0, 0x0F, 0xFD, 0x1F,
+    0xFD, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xC9, 0x19, 0x99, 0x99, 0x99, 0x99, 0x75,
+    0xFF, 0xCA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x29, 0x39, 0x19, 0xEA, 0x09, 0xC9, 0x0C, 0xAA,
+    0xFC, 0x09, 0xC2, 0xAC, 0xA1, 0x71, 0xAF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF0, 0x5A, 0x4A, 0xD9, 0x19, 0xE9, 0x1E, 0xA2, 0x9C, 0xA7, 0x40, 0x72, 0x9C, 0xA7,
+    0x2D, 0x72, 0xAC, 0x97, 0x2D, 0x72, 0xAC, 0x97, 0x2C, 0xA7, 0x2D, 0x72, 0x9C, 0xA7, 0x2D, 0x72,
+    0xAC, 0x97, 0x2D, 0x72, 0xAC, 0x97, 0x2C, 0xA7, 0x2D, 0x72, 0x9C, 0xA7, 0x2D, 0x72, 0xAC, 0x97,
+    0x2D, 0x72, 0xAC, 0x97, 0x2C, 0xA7, 0x29, 0x97, 0x30, 0x09, 0xA1, 0x9C, 0xA1, 0xAC, 0x1C, 0xA9,
+    0xD1, 0x91, 0x0C, 0x94, 0xAA, 0x0C, 0x94, 0xCA, 0x9C, 0x94, 0xC9, 0xAF, 0xF0, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x19, 0x99, 0x99, 0x99, 0x1F, 0xFA, 0x0C, 0x94, 0xC9, 0x9C, 0x49, 0xC0, 0xAC, 0xAA,
+    0xAA, 0xAD, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0x91, 0x99, 0x1A, 0xFE, 0xA9, 0xC1, 0xAC,
+    0x1A, 0xC9, 0x92, 0x92, 0x90, 0x7A, 0xC0, 0xAC, 0x19, 0xE9, 0x2D, 0xA1, 0x9C, 0xAA, 0xC9, 0x19,
+    0x19, 0x10, 0x3A, 0x91, 0x9D, 0x91, 0xD3, 0xD3, 0x9C, 0xA3, 0xCA, 0x1A, 0xD2, 0xA9, 0x20, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xCA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x75, 0xFF, 0xD1, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x6D, 0xA3, 0xD3, 0x9C, 0x93, 0xAC, 0x00, 0x71, 0xE2, 0x9D, 0x29,
+    0xD3, 0xCA, 0x30, 0x19, 0x93, 0x91, 0xAE, 0x90, 0x9C, 0x09, 0xCA, 0xAF, 0xA0, 0xAA, 0x2A, 0xCA,
+    0x10, 0x09, 0x92, 0xE2, 0xAC, 0x91, 0xAC, 0x2C, 0x10, 0x49, 0x99, 0x6D, 0x92, 0xD9, 0xAC, 0xA9,
+    0xCA, 0x0D, 0x0D, 0x0A, 0xC9, 0x29, 0xC4, 0x9C, 0xA0, 0xAC, 0x90, 0xAD, 0x99, 0xD9, 0x74, 0x9F,
+    0xFC, 0xA0, 0xAC, 0x99, 0x99, 0x99, 0xAC, 0x90, 0xCA, 0x59, 0xC1, 0xCA, 0x5A, 0xC7, 0x40, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFC, 0xA1, 0x99, 0x99, 0x99, 0x99, 0x97, 0x5F, 0xFD, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0D, 0x1D, 0x1D, 0x1D, 0x09,
+    0xCA, 0x70, 0x9A, 0xAA, 0x9F, 0xC2, 0xCA, 0x19, 0xC9, 0x19, 0xC0, 0x74, 0x90, 0xAC, 0x19, 0x1F,
+    0x90, 0xCA, 0x0D, 0x9F, 0xC1, 0xC0, 0x9C, 0x9C, 0xA5, 0x94, 0x77, 0xAC, 0x70, 0xD6, 0x94, 0x92,
+    0xF9, 0x0A, 0xC1, 0xAC, 0xAA, 0xF9, 0x1C, 0x91, 0x9A, 0xC9, 0x5C, 0xA7, 0x9D, 0x70, 0xA9, 0x40,
+    0x39, 0x39, 0x2A, 0xEA, 0x0A, 0xC2, 0xC9, 0x9A, 0xE9, 0x29, 0x39, 0x4A, 0xCA, 0x2A, 0x91, 0xAC,
+    0xAF, 0xC2, 0xC9, 0x1A, 0xCA, 0x20, 0x74, 0xA1, 0x9A, 0x29, 0xDA, 0xAD, 0xA1, 0xFF, 0x2A, 0xA1,
+    0xC9, 0x73, 0x59, 0xCA, 0x09, 0xE9, 0x0A, 0xC2, 0xD2, 0xCA, 0x10, 0xF2, 0xF2, 0xFC, 0xAA, 0x92,
+    0x9A, 0xA9, 0x29, 0xAA, 0xD9, 0x75, 0x9D, 0x93, 0x99, 0xAA, 0x99, 0x39, 0xC4, 0x99, 0x91, 0x99,
+    0x97, 0x09, 0xA5, 0xA9, 0x69, 0x97, 0x99, 0x2C, 0x90, 0x99, 0x79, 0x90, 0x9D, 0x90, 0xA7, 0x1A,
+    0x09, 0xD9, 0x0A, 0x71, 0xA0, 0x9D, 0x97, 0x39, 0x09, 0xC2, 0xAA, 0x79, 0xA6, 0x99, 0x59, 0x97,
+    0x99, 0x93, 0x99, 0x93, 0xC9, 0x3A, 0x9A, 0xA9, 0xA3, 0x9D, 0x97, 0x59, 0xDA, 0x99, 0x29, 0x99,
+    0x92, 0x99, 0xAF, 0xC2, 0xF2, 0xF0, 0xA3, 0xAC, 0xA9, 0x19, 0xD0, 0x9E, 0x0C, 0xA7, 0x1A, 0x90,
+    0xD0, 0xAC, 0x1C, 0xA1, 0x9C, 0x91, 0x99, 0x00, 0x71, 0xAE, 0xA1, 0xAD, 0xAD, 0x90, 0xC9, 0x2A,
+    0xC0, 0x90, 0xAC, 0x5D, 0x94, 0xAA, 0x20, 0x49, 0xC0, 0xC9, 0x9E, 0x90, 0xE0, 0xAC, 0xAC, 0xA0,
+    0x90, 0x90, 0x2A, 0x99, 0xE0, 0xAC, 0xA1, 0x9A, 0xD3, 0xA9, 0x0C, 0x92, 0xAD, 0xA1, 0x9D, 0x0A,
+    0xDA, 0x0C, 0x91, 0xC9, 0x3A, 0xA1, 0x9D, 0xA1, 0xD9, 0x2D, 0x99, 0xDA, 0x09, 0xDA, 0x0C, 0xA9,
+    0xC0, 0xC9, 0x19, 0xC1, 0xC9, 0x1A, 0x2C, 0xA1, 0x9C, 0x1A, 0xC0, 0xD9, 0x09, 0x10, 0x19, 0x1D,
+    0x90, 0xD9, 0x19, 0x00, 0x7A, 0xC2, 0xCA, 0xD9, 0x0A, 0xDA, 0x90, 0xAE, 0x19, 0xA9, 0xA0, 0x69,
+    0x2F, 0xAE, 0x99, 0xC1, 0xD1, 0xAC, 0xAA, 0x1A, 0xC1, 0x9C, 0x9C, 0x99, 0xD9, 0x9C, 0xA0, 0xAD,
+    0xA9, 0xDA, 0x00, 0x0A, 0x29, 0xC2, 0xAE, 0xA9, 0x99, 0xC9, 0x2C, 0x50, 0x0C, 0xA7, 0x4D, 0x1A,
+    0xCA, 0x71, 0x9D, 0x92, 0xE9, 0x59, 0xE9, 0x4A, 0xFF, 0xDA, 0x70, 0x9A, 0xAA, 0xAA, 0xA9, 0x50,
+    0xAC, 0x97, 0x39, 0xCA, 0x0D, 0x72, 0xAD, 0x19, 0xDA, 0x94, 0x9A, 0xDA, 0x4F, 0xFE, 0x97, 0x9A,
+    0xAA, 0xAA, 0x95, 0x0F, 0xFF, 0x90, 0xFF, 0xF0, 0x0F, 0xFF, 0x90, 0xFF, 0xF0, 0x39, 0x99, 0x71,
+    0x91, 0x9F, 0xEA, 0x94, 0xAC, 0x1D, 0x99, 0x99, 0xAF, 0xFC, 0x90, 0xAA, 0x79, 0xAA, 0xDA, 0x20,
+    0x79, 0x99, 0x97, 0x29, 0xAF, 0xFA, 0x6F, 0xA9, 0x99, 0x9A, 0xE9, 0x3D, 0xA7, 0x09, 0xD9, 0x1D,
+    0x74, 0xD1, 0x97, 0x69, 0x00, 0x77, 0x77, 0x19, 0x91, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAD, 0xA0, 0xFF, 0xFF, 0xD7, 0x7A, 0xA7, 0x74, 0x1A, 0xCA, 0x99, 0x0A, 0xA1, 0xC1, 0xC2, 0xC1,
+    0xC1, 0xAA, 0x1C, 0x09, 0xC9, 0x19, 0xA9, 0x91, 0x09, 0xDA, 0x0C, 0x1C, 0xAA, 0xAC, 0x9C, 0x92,
+    0xAA, 0x09, 0x19, 0xA9, 0x00, 0x1C, 0x59, 0x91, 0xA9, 0x1C, 0x2C, 0x19, 0xA1, 0x92, 0x1A, 0xD9,
+    0x1A, 0x91, 0xC1, 0xC2, 0xC1, 0xC2, 0xC1, 0xC9, 0x0C, 0x92, 0xAA, 0x20, 0x09, 0xA1, 0xA9, 0x0A,
+    0x91, 0xC1, 0xC2, 0xC1, 0xC1, 0xAA, 0x1C, 0x09, 0xC9, 0x19, 0xA0, 0x91, 0x1A, 0xAA, 0x1C, 0x39,
+    0xA3, 0xA9, 0x39, 0xC4, 0x9A, 0x91, 0x74, 0xC4, 0x9A, 0x1A, 0xCA, 0xA9, 0x0A, 0xA1, 0xC1, 0xC2,
+    0xC1, 0xC1, 0xAA, 0x1C, 0x09, 0xC9, 0x19, 0xA0, 0x91, 0x70, 0xC5, 0xC4, 0x9A, 0xAC, 0xA1, 0xAC,
+    0x1C, 0x1C, 0x91, 0xC1, 0xC1, 0x9A, 0x1A, 0x1A, 0x91, 0x91, 0x91, 0x1A, 0x9A, 0xC0, 0xAC, 0x91,
+    0xC1, 0xCA, 0x09, 0xA0, 0x9A, 0x1C, 0x19, 0xA0, 0xA9, 0x1C, 0x1A, 0x90, 0xC1, 0x9A, 0x1C, 0x19,
+    0x19, 0x29, 0x00, 0x09, 0xAA, 0xA1, 0xAC, 0x3C, 0x93, 0xC4, 0xA4, 0x93, 0x49, 0x90, 0x9C, 0xA9,
+    0x0C, 0x19, 0xA1, 0xA9, 0x1C, 0x92, 0xA9, 0x00, 0x99, 0x1A, 0x99, 0xA0, 0x9C, 0x09, 0xA0, 0xC2,
+    0xA9, 0xA2, 0xD3, 0x99, 0x20, 0x1A, 0x1A, 0x2A, 0x9C, 0x39, 0xC9, 0x3A, 0xC9, 0x2A, 0x90, 0xC2,
+    0x91, 0x91, 0x71, 0xDA, 0x72, 0x9E, 0x72, 0xF7, 0x1A, 0xCA, 0xD7, 0x1D, 0x0D, 0x70, 0xAC, 0xA0,
+    0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA, 0x1A, 0xCA, 0x59, 0xD2, 0x9C, 0xA5, 0xDA, 0x29, 0xD4, 0x9D,
+    0xAA, 0xAA, 0xAD, 0x4F, 0xFD, 0x39, 0xD9, 0x99, 0x99, 0x9D, 0x3D, 0x95, 0xD9, 0x1A, 0xD6, 0xD9,
+    0x1D, 0x96, 0xAC, 0xA0, 0xAD, 0x7A, 0xCA, 0x0D, 0x97, 0x9D, 0x3F, 0xDA, 0x94, 0x9F, 0xFA, 0x3A,
+    0xCA, 0x3A, 0xD9, 0x2D, 0x94, 0xDA, 0x2D, 0x5A, 0xCA, 0x19, 0xD5, 0xDA, 0x1A, 0xCA, 0x49, 0xD2,
+    0xDA, 0x99, 0x99, 0xAD, 0x92, 0xFF, 0x94, 0xDA, 0xAA, 0xAE, 0x39, 0xD4, 0xAD, 0x2A, 0xCA, 0x5D,
+    0x91, 0xD9, 0x5D, 0xA1, 0xD6, 0xD9, 0x1D, 0x59, 0xD1, 0x9D, 0x49, 0xDA, 0x1A, 0xFF, 0xCA, 0x2F,
+    0xFA, 0x93, 0x3F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC,
+    0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7,
+    0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0x71, 0x9D, 0x74, 0xE7, 0x3A, 0xE9, 0x71, 0x9D, 0x9C,
+    0xA7, 0x1D, 0x99, 0xCA, 0x70, 0x9C, 0xA1, 0xD7, 0x0D, 0x2D, 0x7A, 0xCA, 0x2D, 0x7D, 0x3D, 0x95,
+    0xAC, 0x93, 0xAC, 0x94, 0x9D, 0x49, 0xCA, 0x4D, 0x94, 0x9C, 0xA3, 0x9D, 0x6D, 0x3D, 0x96, 0xD2,
+    0xAC, 0xA7, 0xD2, 0xD7, 0x0D, 0x90, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0x3F, 0xFA, 0x29, 0xFF,
+    0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F,
+    0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19,
+    0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x73, 0x9D, 0xA7, 0x3D, 0xA7,
+    0x3A, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3D, 0xA7, 0x3E, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xD9, 0x73,
+    0xDA, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3F, 0xFE, 0x4F, 0xFE, 0x30, 0x3D, 0x7D, 0x39,
+    0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xD9, 0x3D, 0x7D, 0x39, 0xD7, 0xD3, 0xAC, 0xA6,
+    0x9D, 0x3A, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xCA, 0x3F, 0xFF, 0x93, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xAC, 0x93, 0xD7, 0xD9, 0x3D, 0x7D, 0x39,
+    0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA, 0x3D, 0x96, 0xD9, 0x30, 0x77, 0x69, 0xFC, 0xA7, 0x0F, 0xFC,
+    0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC,
+    0xA7, 0x1D, 0x1D, 0x90, 0xFE, 0x1D, 0x1D, 0x90, 0xFE, 0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D,
+    0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF, 0x97,
+    0xAF, 0xCA, 0x77, 0x60, 0x3A, 0xFC, 0x93, 0x9F, 0xA6, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7,
+    0x9D, 0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD6, 0x9A, 0xDA,
+    0x93, 0x9F, 0xD3, 0x3D, 0x5A, 0xCA, 0x39, 0xCA, 0x4A, 0xD4, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0xAD,
+    0x6D, 0x2A, 0xD6, 0x9D, 0x1A, 0xD7, 0xAC, 0xA0, 0xAD, 0x70, 0xD9, 0xAD, 0x71, 0xFC, 0xA7, 0x1E,
+    0xAD, 0x70, 0x9D, 0x90, 0xAC, 0xA7, 0xAC, 0xA1, 0x9D, 0x7D, 0x92, 0xD9, 0x6D, 0x3A, 0xD6, 0xD4,
+    0xD9, 0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0x9D, 0x4D, 0x95, 0xDA, 0x30, 0x71, 0xDA, 0x72, 0x9E,
+    0x72, 0xF7, 0x1A, 0xCA, 0xD7, 0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA,
+    0x1A, 0xCA, 0x59, 0xD2, 0x9C, 0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0x4D, 0x4D, 0x94, 0xD3, 0x9D, 0x5D,
+    0x3D, 0x95, 0xD9, 0x1A, 0xD6, 0xAC, 0x91, 0xD9, 0x6A, 0xCA, 0x0A, 0xD7, 0xAC, 0xA0, 0xD9, 0x79,
+    0xD0, 0x29, 0xE7, 0x09, 0xE3, 0xAE, 0x70, 0xF3, 0xAE, 0x7A, 0xEA, 0x3D, 0xAC, 0x96, 0xDA, 0xC9,
+    0x3D, 0x9C, 0x95, 0xAC, 0x9D, 0x39, 0xCA, 0x9C, 0xA5, 0xD0, 0xD3, 0xAC, 0xA0, 0xCA, 0x4D, 0x99,
+    0xD3, 0xD9, 0x0D, 0x39, 0xCA, 0x0A, 0xCA, 0x3D, 0x1D, 0x3D, 0x1D, 0x93, 0xD1, 0xD2, 0x9C, 0xA1,
+    0xD3, 0x9C, 0xA1, 0xAC, 0x2D, 0x19, 0xD3, 0xAC, 0x91, 0xAC, 0x90, 0xAC, 0xA1, 0x9D, 0x3D, 0x91,
+    0x9C, 0x90, 0xD2, 0xAC, 0xA3, 0xD2, 0x9C, 0xAA, 0xC9, 0x2D, 0x92, 0x9D, 0x29, 0xF3, 0xD3, 0x9C,
+    0xA3, 0xE9, 0x29, 0xD3, 0xAC, 0x93, 0xE3, 0xAC, 0xA3, 0xD4, 0xD4, 0xAC, 0xA3, 0x29, 0xD9, 0x69,
+    0xCA, 0x2A, 0xDA, 0x6A, 0xCA, 0x2A, 0xE6, 0xD9, 0x2F, 0x95, 0xD3, 0xD9, 0xD4, 0x9D, 0x29, 0xCA,
+    0x0D, 0x49, 0xCA, 0x2A, 0xCA, 0x0A, 0xCA, 0x3A, 0xC9, 0x2D, 0x90, 0x9D, 0x3D, 0x92, 0xD2, 0xD9,
+    0x2D, 0x3D, 0x2A, 0xCA, 0x19, 0xD2, 0x9C, 0xA3, 0xD1, 0xAC, 0xA2, 0xAC, 0x93, 0xD9, 0x0A, 0xC9,
+    0x2D, 0x93, 0x9C, 0xA0, 0xD3, 0xD5, 0xD0, 0xD2, 0x9D, 0x5A, 0xCA, 0xD2, 0x9C, 0xA5, 0x9E, 0xA2,
+    0xAC, 0x96, 0xE9, 0x2D, 0x7A, 0xD3, 0x4A, 0xFF, 0xC5, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0x99, 0x99, 0x99, 0x97, 0xAF, 0xE9, 0x69, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xAF, 0xFD, 0x4F, 0xFE, 0x30, 0x77, 0x69, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E,
+    0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97,
+    0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7,
+    0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x60, 0x3F, 0xFF,
+    0x39, 0xFF, 0xF3, 0xAC, 0xA6, 0xAC, 0xA3, 0xD9, 0x6D, 0x93, 0xD7, 0xD3, 0x9D, 0x7D, 0x3A, 0xCA,
+    0x69, 0xD3, 0xAC, 0x96, 0xAC, 0xA3, 0xD9, 0x6D, 0x93, 0xD7, 0xD3, 0x9D, 0x69, 0xD3, 0xAC, 0xA6,
+    0xAD, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x7D, 0x39, 0xD6, 0x9D, 0x3A, 0xCA, 0x6A, 0xCA,
+    0x3D, 0x96, 0xD9, 0x30, 0x3F, 0xCA, 0x95, 0x9F, 0xF4, 0xAC, 0xA2, 0x9D, 0xA3, 0xD9, 0x39, 0xD3,
+    0xD5, 0xD2, 0x9D, 0x5D, 0x2A, 0xCA, 0x49, 0xD2, 0xD9, 0x4D, 0xA2, 0xD9, 0x29, 0xE3, 0xFF, 0xC3,
+    0x9F, 0xDA, 0x94, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD9,
+    0x72, 0x4F, 0xFD, 0x49, 0xFF, 0xD4, 0x9D, 0x75, 0xDA, 0x74, 0x9D, 0x75, 0xD9, 0x74, 0x9D, 0x75,
+    0xD9, 0x74, 0xAC, 0xA7, 0x39, 0xD7, 0x4D, 0x74, 0xD9, 0x73, 0xD9, 0x73, 0xAC, 0xA7, 0x39, 0xD7,
+    0x39, 0xD7, 0x4F, 0xFE, 0x4F, 0xFE, 0x30, 0x9F, 0xFE, 0xAA, 0xFF, 0xE9, 0x4D, 0x97, 0x1D, 0x71,
+    0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97,
+    0x1D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x70, 0xAC, 0xA6, 0xAC, 0xA0,
+    0x9D, 0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9, 0x5D,
+    0x1A, 0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7, 0x29,
+    0xD7, 0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x71, 0x71, 0x9C, 0xA7, 0x70, 0xAC, 0xA7,
+    0x39, 0xAF, 0xFA, 0x96, 0xFC, 0xAF, 0xEA, 0x4E, 0x92, 0xD2, 0xAD, 0xA2, 0xDA, 0x39, 0xD3, 0x9D,
+    0x1A, 0xD4, 0xAC, 0xA4, 0xD9, 0x0D, 0x94, 0xD9, 0x4D, 0x90, 0xD5, 0xD5, 0xD9, 0x9D, 0x5D, 0x5D,
+    0x09, 0xD4, 0x9D, 0x4A, 0xD1, 0xD4, 0xAC, 0xA4, 0xD9, 0x1E, 0x3D, 0x93, 0xDA, 0x29, 0xEA, 0x99,
+    0xD1, 0x9A, 0xDA, 0x49, 0xFF, 0xF9, 0x79, 0xAA, 0xEA, 0xA9, 0x75, 0xAC, 0x97, 0x70, 0xD9, 0x71,
+    0x4D, 0x69, 0xCA, 0x5A, 0xCA, 0x49, 0xD6, 0x9D, 0x4D, 0x97, 0xD3, 0xDA, 0x70, 0xAC, 0xA1, 0xAD,
+    0x72, 0xD0, 0x9D, 0x73, 0xDA, 0xD7, 0x49, 0xE9, 0x75, 0xDA, 0x75, 0xF7, 0x4A, 0xF7, 0x39, 0xD0,
+    0xAC, 0x97, 0x2D, 0x90, 0x9D, 0x71, 0xDA, 0x2D, 0x70, 0xAD, 0x3A, 0xCA, 0x69, 0xD4, 0x9D, 0x6D,
+    0x95, 0xD9, 0x4D, 0xA6, 0xAC, 0xA3, 0x19, 0xCA, 0x3A, 0xCA, 0x3A, 0xC9, 0x1A, 0xCA, 0x3D, 0x93,
+    0xD9, 0x1D, 0x93, 0xD9, 0x3D, 0x2D, 0x4D, 0x39, 0xD1, 0x9D, 0x39, 0xD3, 0xAC, 0xA1, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xD9, 0x1D, 0xA3, 0xD9, 0x3D, 0x2D, 0x93, 0xD3, 0x9D, 0x2D, 0x92, 0x9D, 0x3D, 0xA2,
+    0xDA, 0x2A, 0xD2, 0x9D, 0x39, 0xD9, 0x1A, 0xCA, 0x19, 0xD9, 0x4F, 0xAE, 0xAE, 0x96, 0xAF, 0xFA,
+    0x73, 0xAD, 0x97, 0x6A, 0xCA, 0x77, 0xD9, 0x77, 0xD9, 0x77, 0xD7, 0x20, 0x77, 0x70, 0x9F, 0xD9,
+    0x79, 0xFF, 0xD5, 0x9D, 0xA4, 0xAD, 0xA4, 0xD9, 0x6A, 0xD3, 0xAC, 0xA7, 0x0D, 0x92, 0xD7, 0x1D,
+    0xA1, 0x9D, 0x71, 0xDA, 0x1A, 0xCA, 0x71, 0xDA, 0x1D, 0x97, 0x1D, 0x91, 0xD9, 0x71, 0xD9, 0x1D,
+    0x97, 0x09, 0xD2, 0xDA, 0x70, 0xDA, 0x2A, 0xD7, 0x9D, 0x4D, 0x7D, 0x94, 0xAC, 0xA5, 0xD9, 0x6D,
+    0x92, 0x9D, 0x93, 0x9F, 0xD2, 0xFD, 0x90, 0xAF, 0xD1, 0x9F, 0xD1, 0x4A, 0xAA, 0x29, 0x92, 0xAF,
+    0xC9, 0x0C, 0x91, 0xAD, 0xA0, 0x9D, 0xAC, 0x90, 0x9D, 0x93, 0xE1, 0xDA, 0x4A, 0xD1, 0xD5, 0xAC,
+    0xA0, 0xAD, 0x5D, 0x90, 0xAC, 0xA5, 0xD1, 0xD9, 0x49, 0xD1, 0xD9, 0x4E, 0x1D, 0x93, 0xAD, 0xA1,
+    0xAD, 0x29, 0xE9, 0x19, 0xEA, 0xD9, 0xAD, 0x91, 0x9F, 0x90, 0x9D, 0xA7, 0x50, 0x77, 0x69, 0xFC,
+    0x97, 0xAE, 0xAE, 0x95, 0x9D, 0x92, 0xAD, 0x5D, 0x94, 0xD5, 0xD5, 0xD4, 0x9D, 0x49, 0xD4, 0xAC,
+    0xA4, 0xAC, 0xA4, 0xD9, 0x3A, 0xD5, 0xD1, 0xFA, 0x59, 0xD0, 0x9E, 0xA6, 0x9C, 0xA3, 0x9D, 0x5A,
+    0xCA, 0x4A, 0xCA, 0x4D, 0x94, 0x9D, 0x4D, 0x6D, 0x39, 0xD5, 0x9D, 0x3A, 0xCA, 0x5A, 0xCA, 0x3D,
+    0xA4, 0xAD, 0x4F, 0xAA, 0xAE, 0x94, 0xD0, 0xAF, 0xC9, 0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74,
+    0xD7, 0x49, 0xD7, 0x49, 0xCA, 0x74, 0x99, 0x69, 0x9A, 0xC9, 0x49, 0xDA, 0xCA, 0x4A, 0xCA, 0xAC,
+    0xA4, 0xD9, 0x9C, 0xA4, 0xD0, 0x9C, 0xA3, 0x9D, 0x1D, 0x3A, 0xC9, 0x1D, 0x3D, 0x2D, 0x2A, 0xC9,
+    0x2D, 0x19, 0xD3, 0xD1, 0xD4, 0xD0, 0xD5, 0xAE, 0x95, 0xAD, 0x96, 0xAC, 0xA7, 0xD9, 0x7D, 0x79,
+    0xD7, 0xAC, 0xA7, 0x09, 0x70, 0x77, 0x3A, 0xFA, 0x6E, 0xAA, 0xE4, 0xAC, 0xA3, 0x99, 0x4D, 0x97,
+    0x2A, 0xC9, 0x72, 0x9D, 0x73, 0xAD, 0x97, 0x09, 0xAE, 0x96, 0xE9, 0x9D, 0x94, 0xDA, 0x29, 0xD3,
+    0xDA, 0x4D, 0x91, 0x9D, 0x5A, 0xCA, 0x1A, 0xCA, 0x5A, 0xCA, 0x1D, 0x95, 0xD9, 0x1D, 0x95, 0xD9,
+    0x1D, 0xA4, 0x9D, 0x2A, 0xD3, 0x9D, 0x93, 0xEA, 0xAE, 0xA5, 0xAF, 0xC9, 0x77, 0x20, 0x49, 0xAA,
+    0xA9, 0x39, 0xFD, 0xA2, 0xDA, 0x90, 0x9A, 0x91, 0xAC, 0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0x9F, 0x49,
+    0xFA, 0x3A, 0xD7, 0xD7, 0x9D, 0x70, 0xD9, 0x7E, 0xAA, 0xAD, 0x3A, 0xFC, 0xA7, 0x40, 0x2A, 0xFF,
+    0xA2, 0xAA, 0xAA, 0xAA, 0xAD, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x0A, 0xCA, 0x70, 0xAD, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAC, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x19,
+    0xD7, 0x19, 0xD7, 0x2E, 0x71, 0x9F, 0x97, 0x0A, 0xF9, 0x70, 0x9E, 0x71, 0x9D, 0x71, 0x9D, 0x71,
+    0xD9, 0x70, 0x9D, 0x77, 0x10, 0x29, 0x92, 0xAA, 0xA9, 0x4A, 0xC9, 0x9F, 0xC9, 0x3D, 0xAC, 0xA9,
+    0x9E, 0x3E, 0xA2, 0x9D, 0x29, 0xDA, 0x39, 0xD2, 0xAD, 0x49, 0xD2, 0xDA, 0x4A, 0xCA, 0x2D, 0x94,
+    0xDA, 0x2D, 0x5D, 0x91, 0x9D, 0x49, 0xD2, 0xAC, 0xA4, 0xAD, 0x2D, 0x94, 0xAC, 0xA2, 0xD9, 0x4D,
+    0x91, 0x9D, 0x5D, 0x72, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD3, 0x77,
+    0x19, 0xF9, 0x5E, 0xAE, 0x93, 0xAD, 0x2A, 0xD2, 0x9D, 0x4D, 0x2D, 0x94, 0xD2, 0xD5, 0xD1, 0xAC,
+    0xA5, 0xD1, 0xD9, 0x5D, 0x1D, 0xAA, 0xAA, 0xAA, 0xE0, 0x9F, 0xFD, 0xA0, 0x9C, 0xA5, 0xD9, 0x0A,
+    0xCA, 0x5D, 0x1D, 0x94, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0xD9, 0x4D, 0x2A, 0xC9, 0x3A, 0xCA, 0x2A,
+    0xD2, 0x9D, 0x4E, 0xAE, 0x94, 0x9F, 0xC7, 0x72, 0x19, 0x93, 0xD9, 0x2D, 0x3D, 0x29, 0xD2, 0xAC,
+    0xA2, 0xD9, 0x2D, 0x29, 0xD2, 0x9C, 0xA2, 0xAC, 0xA2, 0xDA, 0x2A, 0xDA, 0xA9, 0x0F, 0x95, 0x39,
+    0x93, 0x99, 0x93, 0xAC, 0xA2, 0x9D, 0x93, 0xD9, 0x19, 0xD9, 0x4D, 0x19, 0xD9, 0x49, 0xD0, 0x9D,
+    0x95, 0xAC, 0xA9, 0xD9, 0x6A, 0xCA, 0xDA, 0x7F, 0xD7, 0xDA, 0x0D, 0x95, 0x9D, 0x19, 0xD5, 0xAC,
+    0xA2, 0xD9, 0x4D, 0x92, 0xAD, 0x4D, 0x4D, 0x93, 0xD4, 0xAC, 0xA2, 0x77, 0x9E, 0xA7, 0xAA, 0xEA,
+    0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xE7, 0x0A, 0xE7, 0x0F, 0x7A, 0xC9,
+    0xAC, 0x96, 0xD0, 0xAC, 0xA5, 0xAC, 0x90, 0x9C, 0xA4, 0x9D, 0x19, 0xD4, 0xD9, 0x2D, 0x39, 0xD3,
+    0xD3, 0xD9, 0x3D, 0x91, 0xAC, 0xA4, 0xAC, 0xA1, 0xD5, 0xAD, 0xAA, 0xCA, 0x59, 0xDA, 0x74, 0x49,
+    0x95, 0x99, 0x3A, 0xCA, 0x49, 0xCA, 0x3D, 0x94, 0xAC, 0xA3, 0xD5, 0xD9, 0x29, 0xD5, 0xD3, 0x9C,
+    0xA4, 0x9D, 0x3A, 0xCA, 0x4A, 0xCA, 0x3D, 0x94, 0xD9, 0x3D, 0x5D, 0x39, 0xD4, 0xAD, 0x3A, 0xD3,
+    0x9E, 0x3E, 0x29, 0xEA, 0x3F, 0xAD, 0xA9, 0xDA, 0x2D, 0xAE, 0xA1, 0xE1, 0x9D, 0x73, 0xAC, 0xA7,
+    0x3D, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x73, 0x99, 0x69, 0x9A, 0xC9, 0x49, 0xDA, 0xCA, 0x4A,
+    0xCA, 0xAC, 0xA4, 0xD9, 0x9C, 0xA4, 0xD0, 0x9C, 0xA3, 0x9D, 0x1D, 0x3A, 0xC9, 0x1D, 0x3D, 0x2D,
+    0x2A, 0xC9, 0x2D, 0x19, 0xD3, 0xD1, 0xD4, 0xD0, 0xD5, 0xAE, 0x95, 0xAD, 0x95, 0x3F, 0xFC, 0x4A,
+    0xAF, 0xAA, 0xA5, 0xAC, 0x97, 0x1A, 0xC9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x3E, 0x73, 0xFD,
+    0x69, 0xFD, 0x5D, 0x97, 0x1D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0xA7, 0x2A, 0xDA,
+    0x72, 0xFA, 0x71, 0xAF, 0xA7, 0x19, 0xE9, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2D, 0x77, 0x30,
+    0x49, 0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0,
+    0xD5, 0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC,
+    0xA0, 0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x9A, 0xFF, 0xFC, 0xA9, 0x9A, 0xD9, 0x99, 0x9A, 0xD9, 0x92, 0x9D, 0x3A, 0xCA, 0x4A, 0xCA,
+    0x3D, 0x94, 0xD9, 0x3D, 0x94, 0xD4, 0xD4, 0x9D, 0x39, 0xD4, 0xAC, 0xA3, 0xAC, 0xA4, 0xAC, 0x93,
+    0xD9, 0x4D, 0x93, 0xD5, 0xD4, 0xD4, 0x9D, 0x4D, 0xAA, 0x2A, 0xCA, 0x4A, 0xE7, 0x71, 0x69, 0xAA,
+    0x97, 0x9F, 0xD9, 0x5D, 0xA9, 0x9A, 0xD4, 0xDA, 0x3D, 0x93, 0xD4, 0xAC, 0xA2, 0x9D, 0x4A, 0xCA,
+    0x2A, 0xC9, 0x4A, 0xCA, 0x2D, 0x94, 0xD9, 0x2D, 0x5D, 0x91, 0x9D, 0x49, 0xD2, 0xAC, 0xA4, 0xDA,
+    0x2E, 0x3A, 0xD3, 0xFA, 0xAE, 0x93, 0xD0, 0xAF, 0x93, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D,
+    0x73, 0xD7, 0x29, 0xCA, 0x72, 0x49, 0xAA, 0xA9, 0x39, 0xFD, 0x91, 0x9D, 0xA9, 0x09, 0xA2, 0xD9,
+    0x6D, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xDA, 0x7A, 0xD7, 0x9D, 0xA7, 0xAE, 0xA6, 0x9F,
+    0xA6, 0x9A, 0xD9, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xD9, 0x75, 0x59, 0x99, 0x99, 0x99, 0x92, 0x9F,
+    0xFC, 0xA1, 0xAE, 0xA9, 0xAD, 0x99, 0x19, 0xD9, 0x3D, 0x92, 0xDA, 0x4A, 0xCA, 0x19, 0xD5, 0x9D,
+    0x1A, 0xD5, 0x9D, 0x1A, 0xCA, 0x59, 0xD1, 0xDA, 0x5A, 0xCA, 0x1A, 0xCA, 0x5D, 0x91, 0xAD, 0x49,
+    0xD2, 0x9D, 0x92, 0x9D, 0x93, 0xAD, 0xAA, 0xE9, 0x5A, 0xFC, 0x77, 0x30, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x0A, 0xFF, 0xC9, 0x99, 0x9A, 0xD9, 0x99, 0x93, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D,
+    0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD9, 0x7A, 0xDA, 0xA9, 0x5F, 0x97, 0x50, 0x19, 0x95, 0x99,
+    0x2D, 0x94, 0xD9, 0x1D, 0x5A, 0xC9, 0x1D, 0x5A, 0xC9, 0x09, 0xD5, 0xD9, 0x0A, 0xCA, 0x5D, 0x90,
+    0xD9, 0x5D, 0x1D, 0x59, 0xD0, 0x9D, 0x5A, 0xCA, 0x09, 0xD5, 0xD9, 0x0A, 0xCA, 0x4A, 0xD1, 0x9D,
+    0x3A, 0xD3, 0xEA, 0xAE, 0x93, 0x9F, 0xCA, 0x77, 0x10, 0x39, 0x39, 0xAA, 0x95, 0xD9, 0x1A, 0xFC,
+    0x3E, 0x19, 0xD9, 0x9D, 0xA1, 0x9D, 0x2D, 0x91, 0x9D, 0x1D, 0x92, 0xD3, 0xD0, 0x9D, 0x29, 0xD3,
+    0xD0, 0xAC, 0xA2, 0xAC, 0xA2, 0x9D, 0x0A, 0xCA, 0x2A, 0xC9, 0x2A, 0xCA, 0x0A, 0xC9, 0x2D, 0x3D,
+    0x90, 0xAC, 0xA2, 0xD2, 0x9D, 0x19, 0xD1, 0x9D, 0x2D, 0xA2, 0xD9, 0x0A, 0xCA, 0x09, 0xE3, 0x9F,
+    0xFC, 0xA5, 0x9F, 0xDA, 0x97, 0x09, 0xD7, 0x49, 0xCA, 0x74, 0xAC, 0x97, 0x4D, 0x75, 0xD7, 0x49,
+    0xD7, 0x10, 0x39, 0x97, 0x99, 0x4E, 0x5A, 0xD4, 0x9D, 0xA4, 0xD6, 0x9D, 0x3D, 0x97, 0xD2, 0xAC,
+    0xA7, 0x0D, 0x91, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x19, 0xD9, 0xCA, 0x73, 0xF7, 0x4A, 0xD7, 0x5A,
+    0xD7, 0x49, 0xE7, 0x4F, 0x97, 0x2A, 0xC9, 0xAC, 0xA7, 0x19, 0xCA, 0x09, 0xD7, 0x1D, 0x2D, 0x70,
+    0xAC, 0x92, 0xD9, 0x69, 0xD3, 0xAC, 0xA6, 0xD4, 0x9F, 0x3D, 0xA5, 0x9D, 0xA2, 0x70, 0xAC, 0x97,
+    0x4D, 0x75, 0xD7, 0x49, 0xD7, 0x4A, 0xCA, 0x69, 0x93, 0xD9, 0x19, 0x92, 0xD9, 0x2D, 0x2A, 0xC9,
+    0x1D, 0x3D, 0x2A, 0xCA, 0x1D, 0x29, 0xCA, 0x2A, 0xCA, 0x09, 0xD2, 0xAC, 0xA2, 0xAC, 0x90, 0xAC,
+    0xA2, 0xD9, 0x2D, 0x90, 0xD9, 0x2D, 0x3D, 0x1D, 0x29, 0xD3, 0xD1, 0xD2, 0x9C, 0xA2, 0xAC, 0xA0,
+    0x9D, 0x2A, 0xC9, 0x2D, 0x90, 0x9D, 0x2D, 0x2A, 0xCA, 0x2D, 0xA1, 0xD1, 0xAD, 0x3A, 0xEA, 0xDA,
+    0xE5, 0x9F, 0xE9, 0x71, 0xD9, 0x74, 0xD7, 0x5D, 0x74, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x00,
+    0x39, 0x97, 0x99, 0x4A, 0xCA, 0x79, 0xD2, 0x9D, 0x71, 0xD2, 0xD9, 0x71, 0xD9, 0x09, 0xD7, 0x2D,
+    0x90, 0xD9, 0x3A, 0xC9, 0x3D, 0x90, 0xD4, 0xD4, 0xD9, 0x9D, 0x4D, 0x4D, 0x99, 0xD3, 0x9D, 0x4D,
+    0x09, 0xCA, 0x3A, 0xCA, 0x39, 0xD0, 0x9D, 0x3D, 0xA3, 0xD9, 0x1D, 0x29, 0xE2, 0x9D, 0x2E, 0xAD,
+    0xAA, 0xDA, 0xE4, 0xFA, 0x1F, 0xC7, 0x75, 0x71, 0xDA, 0x72, 0x9E, 0x72, 0xF7, 0x1A, 0xCA, 0xD7,
+    0x1D, 0x0D, 0x70, 0xAC, 0xA0, 0xD9, 0x7D, 0x1A, 0xC9, 0x6A, 0xCA, 0x1A, 0xCA, 0x59, 0xD2, 0x9C,
+    0xA5, 0xDA, 0x29, 0xD4, 0x9D, 0xAA, 0xAA, 0xAD, 0x4F, 0xFD, 0x39, 0xD9, 0x99, 0x99, 0x9D, 0x3D,
+    0x95, 0xD9, 0x1A, 0xD6, 0xD9, 0x1D, 0x96, 0xAC, 0xA0, 0xAD, 0x7A, 0xCA, 0x0D, 0x97, 0x9D, 0x77,
+    0x59, 0x74, 0xD7, 0x39, 0xD7, 0x49, 0x70, 0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D,
+    0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0,
+    0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E,
+    0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x39, 0x72, 0xD9, 0x71, 0xD7, 0x29, 0x70, 0x72,
+    0xAA, 0x97, 0x29, 0xAD, 0xA7, 0x4D, 0x73, 0xAC, 0xA7, 0x2D, 0x97, 0x29, 0xC7, 0x77, 0x3D, 0xA7,
+    0x29, 0xE7, 0x2F, 0x71, 0xAC, 0xAD, 0x71, 0xD0, 0xD7, 0x0A, 0xCA, 0x0D, 0x97, 0xD1, 0xAC, 0x96,
+    0xAC, 0xA1, 0xAC, 0xA5, 0x9D, 0x29, 0xCA, 0x5D, 0xA2, 0x9D, 0x49, 0xDA, 0xAA, 0xAA, 0xD4, 0xFF,
+    0xD3, 0x9D, 0x99, 0x99, 0x99, 0xD3, 0xD9, 0x5D, 0x91, 0xAD, 0x6D, 0x91, 0xD9, 0x6A, 0xCA, 0x0A,
+    0xD7, 0xAC, 0xA0, 0xD9, 0x79, 0xD0, 0x69, 0x99, 0x71, 0xEA, 0x72, 0xD7, 0x19, 0xD7, 0x0D, 0xA7,
+    0x1C, 0x97, 0x29, 0x71, 0x9A, 0xA2, 0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91,
+    0xD9, 0x3E, 0x1A, 0xD4, 0xAD, 0x1D, 0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90,
+    0xAC, 0xA4, 0x9D, 0x1D, 0x94, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A,
+    0xC3, 0x9F, 0x90, 0xD7, 0x70, 0x77, 0x9C, 0xA7, 0x7D, 0x72, 0x9D, 0xA0, 0xCA, 0x72, 0x9C, 0xAD,
+    0x74, 0x9C, 0x91, 0xD7, 0x39, 0x49, 0x77, 0x77, 0x0D, 0xA7, 0x69, 0xE7, 0x6F, 0x75, 0xAC, 0xAD,
+    0x75, 0xD0, 0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x3D, 0x1A, 0xC9, 0x72, 0xAC, 0xA1, 0xAC, 0xA7, 0x19,
+    0xD2, 0x9C, 0xA7, 0x1D, 0xA2, 0x9D, 0x70, 0x9D, 0xAA, 0xAA, 0xAD, 0x70, 0xFF, 0xD7, 0x9D, 0x99,
+    0x99, 0x99, 0xD7, 0xD9, 0x5D, 0x95, 0xAD, 0x6D, 0x95, 0xD9, 0x6A, 0xCA, 0x4A, 0xD7, 0xAC, 0xA4,
+    0xD9, 0x79, 0xD3, 0x74, 0x99, 0x74, 0xAC, 0xA7, 0xAA, 0x90, 0xAC, 0x97, 0xF0, 0x97, 0x0D, 0x99,
+    0xCA, 0x70, 0xAA, 0x3C, 0x77, 0x71, 0x9A, 0xA2, 0x99, 0x59, 0xFC, 0x99, 0xCA, 0x49, 0xDA, 0x99,
+    0xAE, 0x94, 0xD9, 0x3E, 0x4A, 0xD4, 0xAD, 0x4D, 0x94, 0xAC, 0xA3, 0x9D, 0x5A, 0xCA, 0x3A, 0xCA,
+    0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x4D, 0x94, 0xE4, 0xAC, 0xA3, 0x9D, 0xA4, 0xAD, 0x29, 0xE9, 0x5E,
+    0xAD, 0x9A, 0xC6, 0x9F, 0x90, 0xD7, 0x75, 0x5A, 0xA7, 0x59, 0xC9, 0x75, 0x9C, 0x09, 0xDA, 0x72,
+    0x9C, 0xAD, 0x71, 0x9C, 0x91, 0xD7, 0x09, 0x49, 0x77, 0x72, 0xDA, 0x73, 0x9E, 0x73, 0xF7, 0x2A,
+    0xCA, 0xD7, 0x2D, 0x0D, 0x71, 0xAC, 0xA0, 0xD9, 0x70, 0xD1, 0xAC, 0x97, 0xAC, 0xA1, 0xAC, 0xA6,
+    0x9D, 0x29, 0xCA, 0x6D, 0xA2, 0x9D, 0x59, 0xDA, 0xAA, 0xAA, 0xD5, 0xFF, 0xD4, 0x9D, 0x99, 0x99,
+    0x99, 0xD4, 0xD9, 0x5D, 0x92, 0xAD, 0x6D, 0x92, 0xD9, 0x6A, 0xCA, 0x1A, 0xD7, 0xAC, 0xA1, 0xD9,
+    0x79, 0xD0, 0x19, 0x97, 0x2A, 0xC9, 0x72, 0xAC, 0x1A, 0xA9, 0x69, 0x0F, 0x7D, 0x99, 0xCA, 0x5A,
+    0xA3, 0xC7, 0x73, 0x9A, 0xA2, 0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9,
+    0x3E, 0x1A, 0xD4, 0xAD, 0x1D, 0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC,
+    0xA4, 0x9D, 0x1D, 0x94, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3,
+    0x9F, 0x90, 0xD7, 0x70, 0x76, 0xD9, 0x77, 0x09, 0xC7, 0x79, 0xCA, 0x72, 0x9D, 0xA0, 0xC9, 0x72,
+    0x9C, 0xAD, 0x74, 0x9C, 0x91, 0xD7, 0x39, 0x49, 0x77, 0x77, 0x0D, 0xA7, 0x69, 0xE7, 0x6F, 0x75,
+    0xAC, 0xAD, 0x75, 0xD0, 0xD7, 0x4A, 0xCA, 0x0D, 0x97, 0x3D, 0x1A, 0xC9, 0x72, 0xAC, 0xA1, 0xAC,
+    0xA7, 0x19, 0xD2, 0x9C, 0xA7, 0x1D, 0xA2, 0x9D, 0x70, 0x9D, 0xAA, 0xAA, 0xAD, 0x70, 0xFF, 0xD7,
+    0x9D, 0x99, 0x99, 0x99, 0xD7, 0xD9, 0x5D, 0x95, 0xAD, 0x6D, 0x95, 0xD9, 0x6A, 0xCA, 0x4A, 0xD7,
+    0xAC, 0xA4, 0xD9, 0x79, 0xD3, 0x72, 0x99, 0x74, 0xAA, 0xC7, 0x49, 0xC7, 0xAA, 0x90, 0xD9, 0x6F,
+    0x09, 0x7D, 0x99, 0xCA, 0x7A, 0xA3, 0xC7, 0x77, 0x9A, 0xA2, 0x99, 0x49, 0xFC, 0x99, 0xCA, 0x39,
+    0xDA, 0x99, 0xAE, 0x93, 0xD9, 0x3E, 0x3A, 0xD4, 0xAD, 0x3D, 0x94, 0xAC, 0xA2, 0x9D, 0x5A, 0xCA,
+    0x2A, 0xCA, 0x5D, 0x92, 0xAC, 0xA4, 0x9D, 0x3D, 0x94, 0xE3, 0xAC, 0xA3, 0x9D, 0xA3, 0xAD, 0x29,
+    0xE9, 0x4E, 0xAD, 0x9A, 0xC5, 0x9F, 0x90, 0xD7, 0x73, 0x71, 0x99, 0x3A, 0x71, 0xFA, 0x9C, 0xA7,
+    0x09, 0xC1, 0xAE, 0x77, 0x75, 0x9D, 0xA7, 0x49, 0xCA, 0xD7, 0x39, 0xC9, 0x1D, 0x72, 0x94, 0x97,
+    0x77, 0x6D, 0xA7, 0x59, 0xE7, 0x5F, 0x74, 0xAC, 0xAD, 0x74, 0xD0, 0xD7, 0x3A, 0xCA, 0x0D, 0x97,
+    0x2D, 0x1A, 0xC9, 0x71, 0xAC, 0xA1, 0xAC, 0xA7, 0x09, 0xD2, 0x9C, 0xA7, 0x0D, 0xA2, 0x9D, 0x79,
+    0xDA, 0xAA, 0xAA, 0xD7, 0xFF, 0xD6, 0x9D, 0x99, 0x99, 0x99, 0xD6, 0xD9, 0x5D, 0x94, 0xAD, 0x6D,
+    0x94, 0xD9, 0x6A, 0xCA, 0x3A, 0xD7, 0xAC, 0xA3, 0xD9, 0x79, 0xD2, 0x77, 0x29, 0xDA, 0x90, 0x9C,
+    0x5C, 0xAA, 0xF9, 0x49, 0xA2, 0x9A, 0x97, 0x0A, 0xA9, 0x71, 0xF7, 0x0D, 0x99, 0xCA, 0x6A, 0xA3,
+    0xC7, 0x75, 0x9A, 0xA2, 0x99, 0x39, 0xFC, 0x99, 0xCA, 0x29, 0xDA, 0x99, 0xAE, 0x92, 0xD9, 0x3E,
+    0x2A, 0xD4, 0xAD, 0x2D, 0x94, 0xAC, 0xA1, 0x9D, 0x5A, 0xCA, 0x1A, 0xCA, 0x5D, 0x91, 0xAC, 0xA4,
+    0x9D, 0x2D, 0x94, 0xE2, 0xAC, 0xA3, 0x9D, 0xA2, 0xAD, 0x29, 0xE9, 0x3E, 0xAD, 0x9A, 0xC4, 0x9F,
+    0x90, 0xD7, 0x71, 0x77, 0x71, 0x9D, 0xA7, 0x29, 0xF7, 0x19, 0xD1, 0xCA, 0x70, 0xCA, 0x29, 0xC7,
+    0x77, 0x2D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97,
+    0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA,
+    0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D,
+    0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D, 0x77, 0x79, 0x75, 0xD7, 0x49, 0xD7, 0x59,
+    0x70, 0x77, 0x3D, 0xA7, 0x0F, 0x96, 0xD1, 0xD5, 0xCA, 0x29, 0xC9, 0x77, 0x29, 0xAA, 0x29, 0x92,
+    0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD, 0x4A, 0xD1, 0xD9, 0x4A,
+    0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1, 0xD9, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D, 0x77, 0x39, 0x72, 0xD9,
+    0x71, 0xD7, 0x29, 0x70, 0x74, 0x9A, 0x97, 0x39, 0xCA, 0x74, 0xC9, 0x71, 0x9A, 0x3A, 0xA7, 0x9C,
+    0xA9, 0x9D, 0x71, 0xAF, 0x97, 0x39, 0x97, 0x77, 0x4D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD,
+    0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2,
+    0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D,
+    0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D,
+    0x00, 0x77, 0x5D, 0x97, 0x0A, 0xC9, 0x69, 0x1A, 0x19, 0x49, 0xC9, 0x2C, 0xA5, 0xFD, 0x7A, 0xDA,
+    0x77, 0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1,
+    0xAD, 0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49,
+    0xD1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9,
+    0x0D, 0x77, 0x71, 0xA9, 0x75, 0xAC, 0x76, 0xCA, 0x72, 0x9A, 0x3A, 0xA7, 0x9C, 0xA9, 0x9D, 0x71,
+    0xAF, 0x97, 0x39, 0x97, 0x77, 0x4D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0, 0xD7,
+    0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6, 0xDA,
+    0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95, 0xD9,
+    0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D, 0x00, 0x77, 0x2D,
+    0x73, 0xC9, 0x70, 0x91, 0xA1, 0x94, 0x9C, 0x92, 0xCA, 0x5F, 0xD7, 0xAD, 0xA7, 0x74, 0x9A, 0xA2,
+    0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9, 0x3E, 0x1A, 0xD4, 0xAD, 0x1D,
+    0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC, 0xA4, 0x9D, 0x1D, 0x94, 0xE1,
+    0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3, 0x9F, 0x90, 0xD7, 0x70, 0x72,
+    0x99, 0x75, 0xAA, 0xC7, 0x6C, 0x97, 0x3A, 0xC9, 0x71, 0x9A, 0x09, 0x1A, 0xA7, 0x9C, 0xA9, 0x9D,
+    0x71, 0xAF, 0x97, 0x39, 0x97, 0x77, 0x4D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD, 0x72, 0xD0,
+    0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2, 0x9C, 0xA6,
+    0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D, 0x4D, 0x95,
+    0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D, 0x00, 0x6A,
+    0xD7, 0x3C, 0x97, 0x1A, 0xC7, 0x90, 0xAA, 0x19, 0x49, 0xC9, 0x2C, 0xA5, 0xFD, 0x7A, 0xDA, 0x77,
+    0x49, 0xAA, 0x29, 0x92, 0x9F, 0xC9, 0x9C, 0xA1, 0x9D, 0xA9, 0x9A, 0xE9, 0x1D, 0x93, 0xE1, 0xAD,
+    0x4A, 0xD1, 0xD9, 0x4A, 0xCA, 0x09, 0xD5, 0xAC, 0xA0, 0xAC, 0xA5, 0xD9, 0x0A, 0xCA, 0x49, 0xD1,
+    0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x92, 0xEA, 0xD9, 0xAC, 0x39, 0xF9, 0x0D,
+    0x77, 0x71, 0x99, 0x39, 0x70, 0xFA, 0x9C, 0xA7, 0xAC, 0x1A, 0xE7, 0x77, 0x19, 0xA3, 0xAA, 0x70,
+    0x9C, 0xA9, 0x9A, 0xC7, 0x2A, 0xF9, 0x74, 0x99, 0x77, 0x76, 0xDA, 0x74, 0x9E, 0x74, 0xF7, 0x3A,
+    0xCA, 0xD7, 0x3D, 0x0D, 0x72, 0xAC, 0xA0, 0xD9, 0x71, 0xD1, 0xAC, 0x97, 0x0A, 0xCA, 0x1A, 0xCA,
+    0x79, 0xD2, 0x9C, 0xA7, 0xDA, 0x29, 0xD6, 0x9D, 0xAA, 0xAA, 0xAD, 0x6F, 0xFD, 0x59, 0xD9, 0x99,
+    0x99, 0x9D, 0x5D, 0x95, 0xD9, 0x3A, 0xD6, 0xD9, 0x3D, 0x96, 0xAC, 0xA2, 0xAD, 0x7A, 0xCA, 0x2D,
+    0x97, 0x9D, 0x10, 0x77, 0x29, 0xDA, 0x1A, 0xC4, 0x9C, 0xAA, 0xF9, 0x49, 0x92, 0x9A, 0x96, 0x94,
+    0x95, 0x9C, 0x92, 0xCA, 0x6F, 0xD7, 0x0A, 0xDA, 0x77, 0x69, 0xAA, 0x29, 0x93, 0x9F, 0xC9, 0x9C,
+    0xA2, 0x9D, 0xA9, 0x9A, 0xE9, 0x2D, 0x93, 0xE2, 0xAD, 0x4A, 0xD2, 0xD9, 0x4A, 0xCA, 0x19, 0xD5,
+    0xAC, 0xA1, 0xAC, 0xA5, 0xD9, 0x1A, 0xCA, 0x49, 0xD2, 0xD9, 0x4E, 0x2A, 0xCA, 0x39, 0xDA, 0x2A,
+    0xD2, 0x9E, 0x93, 0xEA, 0xD9, 0xAC, 0x49, 0xF9, 0x0D, 0x77, 0x10, 0x70, 0x93, 0x99, 0x79, 0xC9,
+    0x19, 0xC9, 0x70, 0xFD, 0x72, 0xAD, 0xA7, 0x77, 0x3D, 0xA7, 0x39, 0xE7, 0x3F, 0x72, 0xAC, 0xAD,
+    0x72, 0xD0, 0xD7, 0x1A, 0xCA, 0x0D, 0x97, 0x0D, 0x1A, 0xC9, 0x7A, 0xCA, 0x1A, 0xCA, 0x69, 0xD2,
+    0x9C, 0xA6, 0xDA, 0x29, 0xD5, 0x9D, 0xAA, 0xAA, 0xAD, 0x5F, 0xFD, 0x49, 0xD9, 0x99, 0x99, 0x9D,
+    0x4D, 0x95, 0xD9, 0x2A, 0xD6, 0xD9, 0x2D, 0x96, 0xAC, 0xA1, 0xAD, 0x7A, 0xCA, 0x1D, 0x97, 0x9D,
+    0x77, 0x79, 0x75, 0xD7, 0x49, 0xD7, 0x59, 0x70, 0x4A, 0x39, 0x95, 0xC9, 0x19, 0xCA, 0x5F, 0xD7,
+    0xAD, 0xA7, 0x74, 0x9A, 0xA2, 0x99, 0x29, 0xFC, 0x99, 0xCA, 0x19, 0xDA, 0x99, 0xAE, 0x91, 0xD9,
+    0x3E, 0x1A, 0xD4, 0xAD, 0x1D, 0x94, 0xAC, 0xA0, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x5D, 0x90, 0xAC,
+    0xA4, 0x9D, 0x1D, 0x94, 0xE1, 0xAC, 0xA3, 0x9D, 0xA1, 0xAD, 0x29, 0xE9, 0x2E, 0xAD, 0x9A, 0xC3,
+    0x9F, 0x90, 0xD7, 0x73, 0x97, 0x2D, 0x97, 0x1D, 0x72, 0x97, 0x00, 0x3F, 0xFA, 0x29, 0xFF, 0xA2,
+    0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA,
+    0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7,
+    0x1A, 0xFF, 0x92, 0xFF, 0xC7, 0x74, 0x97, 0x2D, 0xA7, 0x1D, 0x97, 0x29, 0x70, 0x49, 0xAA, 0x94,
+    0x9F, 0xD2, 0x9D, 0xA0, 0x9D, 0xA1, 0xD9, 0x29, 0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0x3A, 0xD0,
+    0x9D, 0xAA, 0xF9, 0x0A, 0xFD, 0xA2, 0xDA, 0x7D, 0x97, 0xAC, 0xA7, 0x9D, 0x49, 0x2E, 0xAA, 0xAD,
+    0x3A, 0xFC, 0xA7, 0x70, 0x97, 0x0D, 0x70, 0xD7, 0x09, 0x60, 0x69, 0xAA, 0x97, 0x0A, 0xAD, 0x97,
+    0x2C, 0xA7, 0x09, 0xD9, 0x79, 0xCA, 0x97, 0x0A, 0xC7, 0x74, 0xFF, 0xA2, 0x9F, 0xFA, 0x2A, 0xCA,
+    0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xDA, 0x99, 0x99, 0x94, 0xFF, 0xA3, 0xDA,
+    0xAA, 0xAA, 0xA9, 0x29, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x71, 0xAF,
+    0xF9, 0x2F, 0xFC, 0x30, 0x59, 0x99, 0x7F, 0x70, 0x9C, 0x97, 0xD6, 0xAC, 0xA7, 0xCA, 0x77, 0x29,
+    0xAA, 0x94, 0x9F, 0xD2, 0x9D, 0xA0, 0x9D, 0xA1, 0xD9, 0x29, 0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D,
+    0x3A, 0xD0, 0x9D, 0xAA, 0xF9, 0x0A, 0xFD, 0xA2, 0xDA, 0x7D, 0x97, 0xAC, 0xA7, 0x9D, 0x49, 0x2E,
+    0xAA, 0xAD, 0x3A, 0xFC, 0xA7, 0x40, 0x69, 0x39, 0x5A, 0xE9, 0x09, 0xC5, 0xCA, 0xAF, 0xA4, 0x9A,
+    0x2A, 0xCA, 0x77, 0x3F, 0xFA, 0x39, 0xFF, 0xA3, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72,
+    0xAC, 0xA7, 0x2D, 0xA9, 0x99, 0x99, 0x5F, 0xFA, 0x4D, 0xAA, 0xAA, 0xAA, 0x93, 0x9D, 0x72, 0xAC,
+    0xA7, 0x2D, 0x97, 0x2D, 0x73, 0xD7, 0x29, 0xD7, 0x2A, 0xFF, 0x93, 0xFF, 0xC4, 0x49, 0x49, 0x4F,
+    0x90, 0xAC, 0x3A, 0xCA, 0xAF, 0x93, 0xC9, 0x2A, 0xC9, 0x77, 0x39, 0xAA, 0x96, 0x9F, 0xD4, 0x9D,
+    0xA0, 0x9D, 0xA3, 0xD9, 0x29, 0xCA, 0x2A, 0xCA, 0x3A, 0xCA, 0x2D, 0x3A, 0xD2, 0x9D, 0xAA, 0xF9,
+    0x2A, 0xFD, 0xA4, 0xDA, 0x71, 0xD9, 0x71, 0xAC, 0xA7, 0x19, 0xD4, 0x94, 0xEA, 0xAA, 0xD5, 0xAF,
+    0xCA, 0x77, 0x00, 0x74, 0x9C, 0xA7, 0x39, 0xCA, 0x7A, 0xD9, 0x9C, 0x97, 0xAC, 0xAD, 0x71, 0xAC,
+    0x91, 0xCA, 0x70, 0x94, 0x97, 0x77, 0xFF, 0xA5, 0x9F, 0xFA, 0x5A, 0xCA, 0x74, 0xD9, 0x74, 0xD7,
+    0x49, 0xD7, 0x4A, 0xCA, 0x74, 0xDA, 0x99, 0x99, 0x97, 0xFF, 0xA6, 0xDA, 0xAA, 0xAA, 0xA9, 0x59,
+    0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x5D, 0x74, 0x9D, 0x74, 0xAF, 0xF9, 0x5F, 0xFC, 0x60,
+    0x74, 0x97, 0x39, 0xD6, 0x9A, 0xA0, 0x9C, 0xA6, 0xAE, 0x99, 0x96, 0xAC, 0xA0, 0xD7, 0x9A, 0x3A,
+    0x97, 0x77, 0x9A, 0xA9, 0x70, 0x9F, 0xD6, 0x9D, 0xA0, 0x9D, 0xA5, 0xD9, 0x29, 0xCA, 0x4A, 0xCA,
+    0x3A, 0xCA, 0x4D, 0x3A, 0xD4, 0x9D, 0xAA, 0xF9, 0x4A, 0xFD, 0xA6, 0xDA, 0x73, 0xD9, 0x73, 0xAC,
+    0xA7, 0x39, 0xD4, 0x96, 0xEA, 0xAA, 0xD7, 0xAF, 0xCA, 0x77, 0x40, 0x2A, 0xA7, 0x29, 0xC9, 0x72,
+    0xAC, 0x0A, 0xD9, 0x7A, 0xCA, 0xD6, 0xAC, 0x91, 0xCA, 0x59, 0x49, 0x77, 0x1F, 0xFA, 0x29, 0xFF,
+    0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F,
+    0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19,
+    0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC3, 0x19, 0x71, 0xCA, 0x70, 0x9C, 0x19, 0xAA, 0x49, 0x9A, 0xE9,
+    0x4A, 0xCA, 0x0D, 0x39, 0xA3, 0xA9, 0x77, 0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09, 0xDA, 0x1D,
+    0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0, 0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF, 0xDA, 0x2D,
+    0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92, 0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x74, 0x72, 0x9D, 0x97,
+    0x4A, 0xC7, 0x39, 0xCA, 0x6A, 0xD9, 0x0C, 0x7A, 0xCA, 0xD7, 0x0A, 0xC9, 0x1C, 0xA7, 0x94, 0x97,
+    0x75, 0xFF, 0xA4, 0x9F, 0xFA, 0x4A, 0xCA, 0x73, 0xD9, 0x73, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x73,
+    0xDA, 0x99, 0x99, 0x96, 0xFF, 0xA5, 0xDA, 0xAA, 0xAA, 0xA9, 0x49, 0xD7, 0x3A, 0xCA, 0x73, 0xD9,
+    0x73, 0xD7, 0x4D, 0x73, 0x9D, 0x73, 0xAF, 0xF9, 0x4F, 0xFC, 0x50, 0x71, 0x99, 0x97, 0x29, 0xAC,
+    0x97, 0x3C, 0x95, 0x9A, 0xA0, 0xAC, 0x95, 0xAE, 0x97, 0xAC, 0xA0, 0xD6, 0x9A, 0x3A, 0x97, 0x75,
+    0x9A, 0xA9, 0x79, 0xFD, 0x59, 0xDA, 0x09, 0xDA, 0x4D, 0x92, 0x9C, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xD3, 0xAD, 0x39, 0xDA, 0xAF, 0x93, 0xAF, 0xDA, 0x5D, 0xA7, 0x2D, 0x97, 0x2A, 0xCA, 0x72, 0x9D,
+    0x49, 0x5E, 0xAA, 0xAD, 0x6A, 0xFC, 0xA7, 0x72, 0x69, 0x93, 0x95, 0xFA, 0x9C, 0xA4, 0xAC, 0x1A,
+    0xDA, 0x77, 0x5A, 0xD9, 0x70, 0xAC, 0xAD, 0x7A, 0xC9, 0x1C, 0xA6, 0x94, 0x97, 0x73, 0xFF, 0xA3,
+    0x9F, 0xFA, 0x3A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xDA, 0x99, 0x99,
+    0x95, 0xFF, 0xA4, 0xDA, 0xAA, 0xAA, 0xA9, 0x39, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x3D,
+    0x72, 0x9D, 0x72, 0xAF, 0xF9, 0x3F, 0xFC, 0x40, 0x77, 0x1E, 0x91, 0xC9, 0x3D, 0xAF, 0xC4, 0xA2,
+    0x9A, 0x97, 0x9A, 0xA7, 0x0A, 0xE9, 0x6A, 0xCA, 0x0D, 0x59, 0xA3, 0xA9, 0x77, 0x39, 0xAA, 0x96,
+    0x9F, 0xD4, 0x9D, 0xA0, 0x9D, 0xA3, 0xD9, 0x29, 0xCA, 0x2A, 0xCA, 0x3A, 0xCA, 0x2D, 0x3A, 0xD2,
+    0x9D, 0xAA, 0xF9, 0x2A, 0xFD, 0xA4, 0xDA, 0x71, 0xD9, 0x71, 0xAC, 0xA7, 0x19, 0xD4, 0x94, 0xEA,
+    0xAA, 0xD5, 0xAF, 0xCA, 0x77, 0x00, 0x77, 0x39, 0xD9, 0x79, 0xF6, 0x9C, 0xA0, 0x9C, 0xA4, 0x9C,
+    0x92, 0x9C, 0x77, 0x1F, 0xFA, 0x29, 0xFF, 0xA2, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71,
+    0xAC, 0xA7, 0x1D, 0xA9, 0x99, 0x99, 0x4F, 0xFA, 0x3D, 0xAA, 0xAA, 0xAA, 0x92, 0x9D, 0x71, 0xAC,
+    0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xFF, 0x92, 0xFF, 0xC7, 0x74, 0x97, 0x2D,
+    0xA7, 0x1D, 0x97, 0x29, 0x70, 0x77, 0x0E, 0x6A, 0xEA, 0x4A, 0xC9, 0x0D, 0x3A, 0xC3, 0xAA, 0x77,
+    0x9A, 0xA9, 0x49, 0xFD, 0x29, 0xDA, 0x09, 0xDA, 0x1D, 0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xAC, 0xA0,
+    0xD3, 0xAD, 0x09, 0xDA, 0xAF, 0x90, 0xAF, 0xDA, 0x2D, 0xA7, 0xD9, 0x7A, 0xCA, 0x79, 0xD4, 0x92,
+    0xEA, 0xAA, 0xD3, 0xAF, 0xCA, 0x77, 0x09, 0x70, 0xD7, 0x0D, 0x70, 0x96, 0x6A, 0xA9, 0x69, 0xAD,
+    0xA7, 0x0D, 0x7A, 0xCA, 0x6D, 0x97, 0xC7, 0x71, 0xAF, 0xC9, 0x39, 0xFA, 0x6D, 0x79, 0xD7, 0xAC,
+    0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0x9C, 0xA7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9,
+    0x7D, 0x69, 0xAD, 0xA9, 0x39, 0xFD, 0x30, 0x39, 0x99, 0x5F, 0x69, 0xC9, 0x5D, 0x4A, 0xCA, 0x5C,
+    0xA7, 0x79, 0x95, 0xAC, 0xA5, 0xD9, 0x5D, 0x59, 0xD5, 0x9C, 0xA5, 0xAC, 0xA5, 0xD9, 0x5D, 0x59,
+    0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x6D, 0x50, 0x3A, 0xFC, 0x93, 0x9F, 0xA6, 0xD7, 0x9D, 0x7A, 0xCA,
+    0x7D, 0x97, 0xD7, 0x9D, 0x79, 0xCA, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97,
+    0xD6, 0x9A, 0xDA, 0x93, 0x9F, 0xD7, 0x71, 0x97, 0x0D, 0x70, 0xD7, 0x09, 0x70, 0x59, 0x5A, 0xCA,
+    0x4D, 0xA5, 0x97, 0x59, 0x94, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0x9C, 0xA4, 0xAC, 0xA4, 0xD9,
+    0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x5D, 0x75, 0x95, 0xD9, 0x4D, 0x95, 0x94, 0x77, 0x69,
+    0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1,
+    0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1,
+    0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F,
+    0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x74, 0x97, 0x6A, 0xCA, 0x75, 0xDA, 0x76, 0x97, 0x10, 0x49, 0xAA,
+    0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5, 0x9D,
+    0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0, 0x9D,
+    0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x39, 0x71, 0xAC, 0xA7, 0x0A, 0xCA, 0x71, 0x96,
+    0x71, 0xAA, 0x97, 0x49, 0xAD, 0xA7, 0x6D, 0x75, 0xAC, 0xA7, 0x4D, 0x97, 0x49, 0xC7, 0x77, 0x49,
+    0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E, 0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1,
+    0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97, 0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1,
+    0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7, 0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F,
+    0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x60, 0x69, 0x97, 0x0A, 0xE9, 0x71, 0xCA, 0x70, 0xAC, 0x96, 0x9D,
+    0x97, 0x9C, 0x77, 0x49, 0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0,
+    0xDA, 0x49, 0xD0, 0xD5, 0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0,
+    0xAC, 0xA4, 0xAC, 0xA0, 0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x76, 0x9C, 0xA7,
+    0x6D, 0x71, 0x9D, 0xA0, 0xCA, 0x71, 0x9C, 0xAD, 0x73, 0x9C, 0x91, 0xD7, 0x29, 0x49, 0x77, 0x73,
+    0x9F, 0xCA, 0x71, 0xFF, 0xC9, 0x6E, 0x93, 0xE5, 0xE6, 0xDA, 0x3A, 0xD7, 0xAD, 0x3D, 0x97, 0x0D,
+    0x29, 0xD7, 0x1D, 0x2A, 0xCA, 0x71, 0xD2, 0xD9, 0x71, 0xD2, 0xD9, 0x70, 0x9D, 0x2D, 0x71, 0xAD,
+    0x2D, 0x71, 0xDA, 0x2D, 0x97, 0x9D, 0x92, 0xDA, 0x7E, 0x3A, 0xD6, 0xAD, 0x5E, 0x4A, 0xD9, 0x59,
+    0xFA, 0xF9, 0x70, 0xAF, 0xCA, 0x77, 0x70, 0x74, 0x97, 0x4D, 0x69, 0xAA, 0x1D, 0x69, 0xEA, 0x99,
+    0x69, 0xCA, 0x0A, 0xC7, 0x9C, 0x92, 0xAA, 0x77, 0x79, 0xAA, 0x97, 0x09, 0xFD, 0x95, 0xAD, 0xA9,
+    0x9A, 0xD4, 0x9D, 0x93, 0xDA, 0x3D, 0xA4, 0x9D, 0x3D, 0x59, 0xD2, 0x9D, 0x59, 0xD2, 0xAC, 0xA5,
+    0xAC, 0xA2, 0xD9, 0x5D, 0xA2, 0xD9, 0x5D, 0x3A, 0xCA, 0x4A, 0xCA, 0x39, 0xD3, 0x9D, 0x5A, 0xDA,
+    0xAE, 0x96, 0xAF, 0xA7, 0x75, 0x4A, 0xA7, 0x69, 0xC9, 0x76, 0x9C, 0x09, 0xDA, 0x73, 0x9C, 0xAD,
+    0x72, 0x9C, 0x91, 0xD7, 0x19, 0x49, 0x77, 0x71, 0x9F, 0xCA, 0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4,
+    0xE6, 0xDA, 0x2A, 0xD7, 0xAD, 0x2D, 0x97, 0x0D, 0x19, 0xD7, 0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9,
+    0x71, 0xD1, 0xD9, 0x70, 0x9D, 0x1D, 0x71, 0xAD, 0x1D, 0x71, 0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA,
+    0x7E, 0x2A, 0xD6, 0xAD, 0x4E, 0x4A, 0xD9, 0x49, 0xFA, 0xF9, 0x7A, 0xFC, 0xA7, 0x76, 0x19, 0x72,
+    0xD7, 0x2C, 0x90, 0x9A, 0xA6, 0x99, 0xEA, 0x59, 0xCA, 0x0A, 0xC4, 0x9C, 0x92, 0xAA, 0x77, 0x19,
+    0xAA, 0x95, 0x9F, 0xD9, 0x2A, 0xDA, 0x99, 0xAD, 0x19, 0xD9, 0x3D, 0xA0, 0xDA, 0x49, 0xD0, 0xD5,
+    0x9D, 0x9D, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xD9, 0x5D, 0xAD, 0x95, 0xD0, 0xAC, 0xA4, 0xAC, 0xA0,
+    0x9D, 0x39, 0xD2, 0xAD, 0xAA, 0xE9, 0x3A, 0xFA, 0x77, 0x75, 0xD9, 0x77, 0x9C, 0x76, 0x9C, 0xA7,
+    0x19, 0xDA, 0x0C, 0x97, 0x19, 0xCA, 0xD7, 0x39, 0xC9, 0x1D, 0x72, 0x94, 0x97, 0x77, 0x39, 0xFC,
+    0xA7, 0x1F, 0xFC, 0x96, 0xE9, 0x3E, 0x5E, 0x6D, 0xA3, 0xAD, 0x7A, 0xD3, 0xD9, 0x70, 0xD2, 0x9D,
+    0x71, 0xD2, 0xAC, 0xA7, 0x1D, 0x2D, 0x97, 0x1D, 0x2D, 0x97, 0x09, 0xD2, 0xD7, 0x1A, 0xD2, 0xD7,
+    0x1D, 0xA2, 0xD9, 0x79, 0xD9, 0x2D, 0xA7, 0xE3, 0xAD, 0x6A, 0xD5, 0xE4, 0xAD, 0x95, 0x9F, 0xAF,
+    0x97, 0x0A, 0xFC, 0xA7, 0x77, 0x00, 0x72, 0x99, 0x72, 0x9A, 0xCA, 0x73, 0xCA, 0x59, 0xAA, 0x09,
+    0xCA, 0x59, 0xEA, 0x79, 0xCA, 0x0A, 0xC6, 0x9C, 0x92, 0xAA, 0x77, 0x59, 0xAA, 0x97, 0x9F, 0xD9,
+    0x4A, 0xDA, 0x99, 0xAD, 0x39, 0xD9, 0x3D, 0xA2, 0xDA, 0x49, 0xD2, 0xD5, 0x9D, 0x19, 0xD5, 0x9D,
+    0x1A, 0xCA, 0x5A, 0xCA, 0x1D, 0x95, 0xDA, 0x1D, 0x95, 0xD2, 0xAC, 0xA4, 0xAC, 0xA2, 0x9D, 0x39,
+    0xD4, 0xAD, 0xAA, 0xE9, 0x5A, 0xFA, 0x77, 0x30, 0x70, 0x99, 0x3A, 0x70, 0xFA, 0x9C, 0xA7, 0x9C,
+    0x1A, 0xE7, 0x77, 0x39, 0xDA, 0x73, 0x9C, 0xAD, 0x72, 0x9C, 0x91, 0xD7, 0x19, 0x49, 0x77, 0x71,
+    0x9F, 0xCA, 0x70, 0xFF, 0xC9, 0x5E, 0x93, 0xE4, 0xE6, 0xDA, 0x2A, 0xD7, 0xAD, 0x2D, 0x97, 0x0D,
+    0x19, 0xD7, 0x1D, 0x1A, 0xCA, 0x71, 0xD1, 0xD9, 0x71, 0xD1, 0xD9, 0x70, 0x9D, 0x1D, 0x71, 0xAD,
+    0x1D, 0x71, 0xDA, 0x1D, 0x97, 0x9D, 0x91, 0xDA, 0x7E, 0x2A, 0xD6, 0xAD, 0x4E, 0x4A, 0xD9, 0x49,
+    0xFA, 0xF9, 0x7A, 0xFC, 0xA7, 0x76, 0x77, 0x1A, 0xDA, 0x1C, 0xA3, 0xAC, 0xAA, 0xF4, 0xA3, 0xAA,
+    0x79, 0xAA, 0x70, 0x9E, 0xA6, 0x9C, 0xA0, 0xAC, 0x59, 0xC9, 0x2A, 0xA7, 0x73, 0x9A, 0xA9, 0x69,
+    0xFD, 0x93, 0xAD, 0xA9, 0x9A, 0xD2, 0x9D, 0x93, 0xDA, 0x1D, 0xA4, 0x9D, 0x1D, 0x59, 0xD0, 0x9D,
+    0x59, 0xD0, 0xAC, 0xA5, 0xAC, 0xA0, 0xD9, 0x5D, 0xA0, 0xD9, 0x5D, 0x1A, 0xCA, 0x4A, 0xCA, 0x19,
+    0xD3, 0x9D, 0x3A, 0xDA, 0xAE, 0x94, 0xAF, 0xA7, 0x71, 0x77, 0x71, 0x9D, 0xA7, 0x39, 0xF7, 0x29,
+    0xD1, 0xCA, 0x71, 0xCA, 0x29, 0xC7, 0x77, 0x19, 0xFC, 0xA7, 0x0F, 0xFC, 0x95, 0xE9, 0x3E, 0x4E,
+    0x6D, 0xA2, 0xAD, 0x7A, 0xD2, 0xD9, 0x70, 0xD1, 0x9D, 0x71, 0xD1, 0xAC, 0xA7, 0x1D, 0x1D, 0x97,
+    0x1D, 0x1D, 0x97, 0x09, 0xD1, 0xD7, 0x1A, 0xD1, 0xD7, 0x1D, 0xA1, 0xD9, 0x79, 0xD9, 0x1D, 0xA7,
+    0xE2, 0xAD, 0x6A, 0xD4, 0xE4, 0xAD, 0x94, 0x9F, 0xAF, 0x97, 0xAF, 0xCA, 0x77, 0x74, 0x97, 0x6A,
+    0xCA, 0x75, 0xDA, 0x76, 0x97, 0x10, 0x77, 0x1A, 0xD7, 0xAF, 0x5A, 0xCA, 0x0A, 0xC9, 0x39, 0xC9,
+    0x2A, 0xC7, 0x71, 0x9A, 0xA9, 0x59, 0xFD, 0x92, 0xAD, 0xA9, 0x9A, 0xD1, 0x9D, 0x93, 0xDA, 0x0D,
+    0xA4, 0x9D, 0x0D, 0x59, 0xD9, 0xD5, 0x9D, 0xAC, 0xA5, 0xAC, 0xAD, 0x95, 0xDA, 0xD9, 0x5D, 0x0A,
+    0xCA, 0x4A, 0xCA, 0x09, 0xD3, 0x9D, 0x2A, 0xDA, 0xAE, 0x93, 0xAF, 0xA7, 0x73, 0x97, 0x1A, 0xCA,
+    0x70, 0xAC, 0xA7, 0x19, 0x60, 0x77, 0x76, 0xAD, 0x77, 0x9D, 0x77, 0x0D, 0x77, 0x0C, 0xA7, 0x77,
+    0x1A, 0xD5, 0x9F, 0xCA, 0x3D, 0x94, 0xFF, 0xC9, 0x0A, 0xD4, 0xE9, 0x3E, 0xAD, 0x4E, 0x6E, 0x94,
+    0xAD, 0x7A, 0xD5, 0xD9, 0x70, 0xD4, 0x9D, 0x71, 0xD4, 0xAC, 0xA7, 0x1D, 0x4D, 0x97, 0x1D, 0x4D,
+    0x97, 0x09, 0xD4, 0xD7, 0x1A, 0xD4, 0xD7, 0x1D, 0xA4, 0xD9, 0x79, 0xD9, 0x4D, 0xA7, 0xE5, 0xAD,
+    0x6A, 0xD7, 0xE4, 0xAD, 0x97, 0x9F, 0xAF, 0x97, 0x2A, 0xFC, 0xA7, 0x77, 0x40, 0x77, 0x7A, 0xD7,
+    0x4D, 0x74, 0xD7, 0x4A, 0xA4, 0x99, 0x97, 0x4D, 0x94, 0x9A, 0xA9, 0x29, 0xD3, 0x9F, 0xD9, 0x0D,
+    0x92, 0xAD, 0xA9, 0x9A, 0xF9, 0x29, 0xD9, 0x3D, 0xA4, 0xDA, 0x49, 0xD4, 0xD5, 0x9D, 0x39, 0xD5,
+    0x9D, 0x3A, 0xCA, 0x5A, 0xCA, 0x3D, 0x95, 0xDA, 0x3D, 0x95, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0x9D,
+    0x39, 0xD6, 0xAD, 0xAA, 0xE9, 0x7A, 0xFA, 0x77, 0x70, 0x77, 0x73, 0xD7, 0x71, 0xAC, 0xA7, 0x71,
+    0xD7, 0x72, 0xC9, 0x77, 0x70, 0xAD, 0x59, 0xFC, 0xA3, 0xD9, 0x4F, 0xFC, 0x90, 0xAD, 0x4E, 0x93,
+    0xEA, 0xD4, 0xE6, 0xE9, 0x4A, 0xD7, 0xAD, 0x5D, 0x97, 0x0D, 0x49, 0xD7, 0x1D, 0x4A, 0xCA, 0x71,
+    0xD4, 0xD9, 0x71, 0xD4, 0xD9, 0x70, 0x9D, 0x4D, 0x71, 0xAD, 0x4D, 0x71, 0xDA, 0x4D, 0x97, 0x9D,
+    0x94, 0xDA, 0x7E, 0x5A, 0xD6, 0xAD, 0x7E, 0x4A, 0xD9, 0x79, 0xFA, 0xF9, 0x72, 0xAF, 0xCA, 0x77,
+    0x74, 0x77, 0x4D, 0x97, 0x49, 0xD7, 0x5A, 0xC9, 0x75, 0xAA, 0x39, 0x99, 0x74, 0xD9, 0x49, 0xAA,
+    0x92, 0x9D, 0x39, 0xFD, 0x90, 0xD9, 0x2A, 0xDA, 0x99, 0xAF, 0x92, 0x9D, 0x93, 0xDA, 0x4D, 0xA4,
+    0x9D, 0x4D, 0x59, 0xD3, 0x9D, 0x59, 0xD3, 0xAC, 0xA5, 0xAC, 0xA3, 0xD9, 0x5D, 0xA3, 0xD9, 0x5D,
+    0x4A, 0xCA, 0x4A, 0xCA, 0x49, 0xD3, 0x9D, 0x6A, 0xDA, 0xAE, 0x97, 0xAF, 0xA7, 0x77, 0x71, 0xAA,
+    0x97, 0x79, 0xAD, 0xA7, 0x71, 0xD7, 0x70, 0xAC, 0xA7, 0x7D, 0x97, 0x79, 0xC7, 0x77, 0x1A, 0xD5,
+    0x9F, 0xCA, 0x3D, 0x94, 0xFF, 0xC9, 0x0A, 0xD4, 0xE9, 0x3E, 0xAD, 0x4E, 0x6E, 0x94, 0xAD, 0x7A,
+    0xD5, 0xD9, 0x70, 0xD4, 0x9D, 0x71, 0xD4, 0xAC, 0xA7, 0x1D, 0x4D, 0x97, 0x1D, 0x4D, 0x97, 0x09,
+    0xD4, 0xD7, 0x1A, 0xD4, 0xD7, 0x1D, 0xA4, 0xD9, 0x79, 0xD9, 0x4D, 0xA7, 0xE5, 0xAD, 0x6A, 0xD7,
+    0xE4, 0xAD, 0x97, 0x9F, 0xAF, 0x97, 0x2A, 0xFC, 0xA7, 0x77, 0x40, 0x69, 0x97, 0x4A, 0xE9, 0x75,
+    0xCA, 0x74, 0xAC, 0x97, 0x29, 0xD9, 0x73, 0x9C, 0x49, 0x99, 0x74, 0xD9, 0x49, 0xAA, 0x92, 0x9D,
+    0x39, 0xFD, 0x90, 0xD9, 0x2A, 0xDA, 0x99, 0xAF, 0x92, 0x9D, 0x93, 0xDA, 0x4D, 0xA4, 0x9D, 0x4D,
+    0x59, 0xD3, 0x9D, 0x59, 0xD3, 0xAC, 0xA5, 0xAC, 0xA3, 0xD9, 0x5D, 0xA3, 0xD9, 0x5D, 0x4A, 0xCA,
+    0x4A, 0xCA, 0x49, 0xD3, 0x9D, 0x6A, 0xDA, 0xAE, 0x97, 0xAF, 0xA7, 0x77, 0x79, 0x49, 0x73, 0xF9,
+    0x0A, 0xC7, 0x2A, 0xCA, 0xAF, 0x97, 0x2C, 0x92, 0xAC, 0x97, 0x76, 0xAD, 0x59, 0xFC, 0xA3, 0xD9,
+    0x4F, 0xFC, 0x90, 0xAD, 0x4E, 0x93, 0xEA, 0xD4, 0xE6, 0xE9, 0x4A, 0xD7, 0xAD, 0x5D, 0x97, 0x0D,
+    0x49, 0xD7, 0x1D, 0x4A, 0xCA, 0x71, 0xD4, 0xD9, 0x71, 0xD4, 0xD9, 0x70, 0x9D, 0x4D, 0x71, 0xAD,
+    0x4D, 0x71, 0xDA, 0x4D, 0x97, 0x9D, 0x94, 0xDA, 0x7E, 0x5A, 0xD6, 0xAD, 0x7E, 0x4A, 0xD9, 0x79,
+    0xFA, 0xF9, 0x72, 0xAF, 0xCA, 0x77, 0x74, 0x49, 0x93, 0x97, 0xAE, 0x90, 0xAC, 0x69, 0xCA, 0xAF,
+    0xA6, 0xAA, 0x2A, 0xCA, 0x19, 0x99, 0x74, 0xD9, 0x49, 0xAA, 0x92, 0x9D, 0x39, 0xFD, 0x90, 0xD9,
+    0x2A, 0xDA, 0x99, 0xAF, 0x92, 0x9D, 0x93, 0xDA, 0x4D, 0xA4, 0x9D, 0x4D, 0x59, 0xD3, 0x9D, 0x59,
+    0xD3, 0xAC, 0xA5, 0xAC, 0xA3, 0xD9, 0x5D, 0xA3, 0xD9, 0x5D, 0x4A, 0xCA, 0x4A, 0xCA, 0x49, 0xD3,
+    0x9D, 0x6A, 0xDA, 0xAE, 0x97, 0xAF, 0xA7, 0x77, 0x77, 0x0A, 0xD5, 0x9F, 0xCA, 0x3D, 0x94, 0xFF,
+    0xC9, 0x0A, 0xD4, 0xE9, 0x3E, 0xAD, 0x4E, 0x6E, 0x94, 0xAD, 0x7A, 0xD5, 0xD9, 0x70, 0xD4, 0x9D,
+    0x71, 0xD4, 0xAC, 0xA7, 0x1D, 0x4D, 0x97, 0x1D, 0x4D, 0x97, 0x09, 0xD4, 0xD7, 0x1A, 0xD4, 0xD7,
+    0x1D, 0xA4, 0xD9, 0x79, 0xD9, 0x4D, 0xA7, 0xE5, 0xAD, 0x6A, 0xD7, 0xE4, 0xAD, 0x97, 0x9F, 0xAF,
+    0x97, 0x2A, 0xFC, 0xA7, 0x77, 0x72, 0x97, 0x71, 0xD7, 0x70, 0x9D, 0x77, 0x19, 0x75, 0x74, 0x99,
+    0x97, 0x4D, 0x94, 0x9A, 0xA9, 0x29, 0xD3, 0x9F, 0xD9, 0x0D, 0x92, 0xAD, 0xA9, 0x9A, 0xF9, 0x29,
+    0xD9, 0x3D, 0xA4, 0xDA, 0x49, 0xD4, 0xD5, 0x9D, 0x39, 0xD5, 0x9D, 0x3A, 0xCA, 0x5A, 0xCA, 0x3D,
+    0x95, 0xDA, 0x3D, 0x95, 0xD4, 0xAC, 0xA4, 0xAC, 0xA4, 0x9D, 0x39, 0xD6, 0xAD, 0xAA, 0xE9, 0x7A,
+    0xFA, 0x77, 0x73, 0x97, 0x5D, 0x97, 0x4D, 0x75, 0x97, 0x30, 0x29, 0xCA, 0x7D, 0x3A, 0xCA, 0x69,
+    0xD3, 0xD9, 0x6A, 0xCA, 0x3D, 0x7A, 0xC9, 0x29, 0xD7, 0xD9, 0x2A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D,
+    0x3D, 0x7A, 0xCA, 0x3D, 0x7D, 0x92, 0x9D, 0x7D, 0x3A, 0xCA, 0x7D, 0x3D, 0x96, 0x9D, 0x3D, 0x96,
+    0xAC, 0xA3, 0xD7, 0xD9, 0x3D, 0x95, 0xAD, 0x4A, 0xD4, 0xAD, 0x95, 0xFA, 0xF9, 0x7A, 0xFD, 0x97,
+    0x77, 0x39, 0x97, 0x59, 0xD7, 0x59, 0xD7, 0x69, 0x72, 0x19, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1,
+    0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA, 0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5,
+    0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA, 0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E,
+    0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x73, 0x97, 0x2D, 0x71, 0x9D, 0x72, 0x97, 0x00, 0x70, 0xAA,
+    0x97, 0x5F, 0x76, 0xAC, 0x75, 0x9D, 0x74, 0xDA, 0x75, 0xC9, 0x77, 0x71, 0x9C, 0xA7, 0xD3, 0xAC,
+    0xA6, 0x9D, 0x3D, 0x96, 0xAC, 0xA3, 0xD7, 0xAC, 0x92, 0x9D, 0x7D, 0x92, 0xAC, 0xA7, 0xD3, 0xD9,
+    0x69, 0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x29, 0xD7, 0xD3, 0xAC, 0xA7, 0xD3, 0xD9, 0x69, 0xD3,
+    0xD9, 0x6A, 0xCA, 0x3D, 0x7D, 0x93, 0xD9, 0x5A, 0xD4, 0xAD, 0x4A, 0xD9, 0x5F, 0xAF, 0x97, 0xAF,
+    0xD9, 0x77, 0x60, 0x69, 0x99, 0x71, 0xF7, 0x2A, 0xC7, 0x19, 0xD7, 0x0D, 0xA7, 0x1C, 0x97, 0x29,
+    0x69, 0x96, 0x99, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x1D, 0x5D, 0x19, 0xD4, 0x9D, 0x1A, 0xCA,
+    0x49, 0xCA, 0x1D, 0x94, 0xAC, 0xA1, 0xD5, 0xD9, 0x09, 0xD4, 0x9D, 0x19, 0xCA, 0x4E, 0x1A, 0xCA,
+    0x39, 0xDA, 0x1A, 0xD2, 0x9E, 0x91, 0x9E, 0xAD, 0x9A, 0xC3, 0xAF, 0x90, 0xD7, 0x70, 0x77, 0x77,
+    0xE7, 0x70, 0xAD, 0x77, 0x09, 0xD7, 0x71, 0xCA, 0x77, 0x73, 0xDA, 0x29, 0xCA, 0x7D, 0x1D, 0x92,
+    0xAC, 0xA6, 0x9D, 0x0A, 0xCA, 0x3D, 0x96, 0xAF, 0xA4, 0xD7, 0xAE, 0x94, 0x9D, 0x7D, 0x96, 0xAC,
+    0xA7, 0xD7, 0xD9, 0x69, 0xD7, 0xD7, 0xAC, 0xA7, 0xD7, 0xD9, 0x69, 0xD7, 0xD7, 0xAC, 0xA7, 0xD7,
+    0xD9, 0x69, 0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D, 0x97, 0xD9, 0x5A, 0xD7, 0x0A, 0xD4, 0xAD, 0x97,
+    0x1F, 0xAF, 0x97, 0x3A, 0xFD, 0x97, 0x77, 0x60, 0x77, 0x72, 0xDA, 0x75, 0xDA, 0x75, 0xAC, 0xA7,
+    0x6C, 0x95, 0x99, 0x77, 0xD2, 0x99, 0x69, 0x90, 0xAD, 0x2D, 0x94, 0xAC, 0xA9, 0xD3, 0xD5, 0xFC,
+    0x4D, 0x5D, 0xA9, 0x49, 0xD4, 0x9D, 0x6A, 0xCA, 0x49, 0xCA, 0x6D, 0x94, 0xAC, 0x96, 0xD5, 0xD9,
+    0x59, 0xD4, 0x9D, 0x69, 0xCA, 0x4E, 0x6A, 0xCA, 0x39, 0xDA, 0x6A, 0xD2, 0x9E, 0x96, 0x9E, 0xAD,
+    0x9A, 0xC7, 0x0A, 0xF9, 0x0D, 0x77, 0x71, 0x77, 0x73, 0x9D, 0x77, 0x2A, 0xC9, 0x77, 0x2D, 0x77,
+    0x3C, 0x97, 0x77, 0x2D, 0xA2, 0x9C, 0xA7, 0xD1, 0xD9, 0x2A, 0xCA, 0x69, 0xD0, 0xAC, 0xA3, 0xD9,
+    0x6A, 0xFA, 0x4D, 0x7A, 0xE9, 0x49, 0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A,
+    0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x96, 0xAC, 0xA7,
+    0xD7, 0xD9, 0x7D, 0x95, 0xAD, 0x70, 0xAD, 0x4A, 0xD9, 0x71, 0xFA, 0xF9, 0x73, 0xAF, 0xD9, 0x77,
+    0x76, 0x77, 0x6A, 0xD7, 0x7D, 0x97, 0x7D, 0x77, 0x9C, 0x59, 0x97, 0x7D, 0x29, 0x96, 0x99, 0x0A,
+    0xD2, 0xD9, 0x4A, 0xCA, 0x9D, 0x3D, 0x5F, 0xC4, 0xD5, 0xDA, 0x94, 0x9D, 0x49, 0xD6, 0xAC, 0xA4,
+    0x9C, 0xA6, 0xD9, 0x4A, 0xC9, 0x6D, 0x5D, 0x95, 0x9D, 0x49, 0xD6, 0x9C, 0xA4, 0xE6, 0xAC, 0xA3,
+    0x9D, 0xA6, 0xAD, 0x29, 0xE9, 0x69, 0xEA, 0xD9, 0xAC, 0x70, 0xAF, 0x90, 0xD7, 0x77, 0x10, 0x70,
+    0xAA, 0x97, 0x71, 0xF7, 0x72, 0xAC, 0x77, 0x19, 0xD7, 0x70, 0xDA, 0x77, 0x1C, 0xA7, 0x77, 0x3D,
+    0xA2, 0x9C, 0xA7, 0xD1, 0xD9, 0x2A, 0xCA, 0x69, 0xD0, 0xAC, 0xA3, 0xD9, 0x6A, 0xFA, 0x4D, 0x7A,
+    0xE9, 0x49, 0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96,
+    0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9, 0x7D, 0x95,
+    0xAD, 0x70, 0xAD, 0x4A, 0xD9, 0x71, 0xFA, 0xF9, 0x73, 0xAF, 0xD9, 0x77, 0x76, 0x69, 0x99, 0x76,
+    0xF7, 0x7A, 0xC7, 0x69, 0xD7, 0x5D, 0xA7, 0x6C, 0x95, 0x99, 0x79, 0x6D, 0x29, 0x96, 0x99, 0x0A,
+    0xD2, 0xD9, 0x4A, 0xCA, 0x9D, 0x3D, 0x5F, 0xC4, 0xD5, 0xDA, 0x94, 0x9D, 0x49, 0xD6, 0xAC, 0xA4,
+    0x9C, 0xA6, 0xD9, 0x4A, 0xC9, 0x6D, 0x5D, 0x95, 0x9D, 0x49, 0xD6, 0x9C, 0xA4, 0xE6, 0xAC, 0xA3,
+    0x9D, 0xA6, 0xAD, 0x29, 0xE9, 0x69, 0xEA, 0xD9, 0xAC, 0x70, 0xAF, 0x90, 0xD7, 0x77, 0x10, 0x79,
+    0x49, 0x74, 0xEA, 0x1C, 0xA7, 0x3D, 0x9F, 0xC7, 0x4C, 0x91, 0x9D, 0x97, 0x77, 0x0D, 0xA2, 0x9C,
+    0xA7, 0xD1, 0xD9, 0x2A, 0xCA, 0x69, 0xD0, 0xAC, 0xA3, 0xD9, 0x6A, 0xFA, 0x4D, 0x7A, 0xE9, 0x49,
+    0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D,
+    0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9, 0x7D, 0x95, 0xAD, 0x70,
+    0xAD, 0x4A, 0xD9, 0x71, 0xFA, 0xF9, 0x73, 0xAF, 0xD9, 0x77, 0x76, 0x59, 0x39, 0x71, 0x9E, 0xA1,
+    0xC9, 0x70, 0xDA, 0xFC, 0x71, 0xC2, 0x9C, 0xA3, 0x99, 0x77, 0xD2, 0x99, 0x69, 0x90, 0xAD, 0x2D,
+    0x94, 0xAC, 0xA9, 0xD3, 0xD5, 0xFC, 0x4D, 0x5D, 0xA9, 0x49, 0xD4, 0x9D, 0x6A, 0xCA, 0x49, 0xCA,
+    0x6D, 0x94, 0xAC, 0x96, 0xD5, 0xD9, 0x59, 0xD4, 0x9D, 0x69, 0xCA, 0x4E, 0x6A, 0xCA, 0x39, 0xDA,
+    0x6A, 0xD2, 0x9E, 0x96, 0x9E, 0xAD, 0x9A, 0xC7, 0x0A, 0xF9, 0x0D, 0x77, 0x71, 0x77, 0x1D, 0xA2,
+    0x9C, 0xA7, 0xD1, 0xD9, 0x2A, 0xCA, 0x69, 0xD0, 0xAC, 0xA3, 0xD9, 0x6A, 0xFA, 0x4D, 0x7A, 0xE9,
+    0x49, 0xD7, 0xD9, 0x6A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D,
+    0x7D, 0x7A, 0xCA, 0x7D, 0x7D, 0x96, 0x9D, 0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9, 0x7D, 0x95, 0xAD,
+    0x70, 0xAD, 0x4A, 0xD9, 0x71, 0xFA, 0xF9, 0x73, 0xAF, 0xD9, 0x77, 0x77, 0x39, 0x97, 0x71, 0x9D,
+    0x77, 0x19, 0xD7, 0x72, 0x97, 0x60, 0x76, 0x99, 0x77, 0xD2, 0x99, 0x69, 0x90, 0xAD, 0x2D, 0x94,
+    0xAC, 0xA9, 0xD3, 0xD5, 0xFC, 0x4D, 0x5D, 0xA9, 0x49, 0xD4, 0x9D, 0x6A, 0xCA, 0x49, 0xCA, 0x6D,
+    0x94, 0xAC, 0x96, 0xD5, 0xD9, 0x59, 0xD4, 0x9D, 0x69, 0xCA, 0x4E, 0x6A, 0xCA, 0x39, 0xDA, 0x6A,
+    0xD2, 0x9E, 0x96, 0x9E, 0xAD, 0x9A, 0xC7, 0x0A, 0xF9, 0x0D, 0x77, 0x75, 0x97, 0x7D, 0xA7, 0x6D,
+    0x97, 0x79, 0x74, 0x77, 0x19, 0xD7, 0x3A, 0xC9, 0x73, 0xD7, 0x4C, 0x97, 0x72, 0xAC, 0xA6, 0xAC,
+    0xA0, 0x9D, 0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9,
+    0x5D, 0x1A, 0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7,
+    0x29, 0xD7, 0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x71, 0x77, 0x69, 0xD7, 0x5A, 0xCA,
+    0x75, 0xD7, 0x6C, 0x97, 0x77, 0x99, 0x79, 0x93, 0xAC, 0xA5, 0xD9, 0x3A, 0xCA, 0x49, 0xD4, 0x9D,
+    0x4D, 0x95, 0xD3, 0xAD, 0x6D, 0x3D, 0x7D, 0x2A, 0xCA, 0x7D, 0x91, 0xD7, 0x0A, 0xC9, 0x0A, 0xCA,
+    0x70, 0x9C, 0x90, 0xD7, 0x19, 0xCA, 0xAC, 0x97, 0x2C, 0xAD, 0x73, 0xE9, 0x73, 0xE7, 0x4D, 0x97,
+    0x3A, 0xD7, 0x4D, 0x74, 0xDA, 0x70, 0x9F, 0xC7, 0x19, 0xEA, 0x72, 0xAC, 0xA6, 0xAC, 0xA0, 0x9D,
+    0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9, 0x5D, 0x1A,
+    0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7,
+    0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x77, 0x71, 0x97, 0x3D, 0xA7, 0x2D, 0x97, 0x39,
+    0x72, 0x39, 0x97, 0x99, 0x3A, 0xCA, 0x5D, 0x93, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0xD9, 0x5D, 0x3A,
+    0xD6, 0xD3, 0xD7, 0xD2, 0xAC, 0xA7, 0xD9, 0x1D, 0x70, 0xAC, 0x90, 0xAC, 0xA7, 0x09, 0xC9, 0x0D,
+    0x71, 0x9C, 0xAA, 0xC9, 0x72, 0xCA, 0xD7, 0x3E, 0x97, 0x3E, 0x74, 0xD9, 0x73, 0xAD, 0x19, 0x71,
+    0xD1, 0xD9, 0x7D, 0xA1, 0xD9, 0x39, 0xFC, 0x39, 0x49, 0xEA, 0x72, 0x49, 0xAA, 0x97, 0x19, 0xAD,
+    0xA7, 0x3D, 0x72, 0xAC, 0x97, 0x09, 0xD9, 0x71, 0x9C, 0x77, 0x4A, 0xCA, 0x6A, 0xCA, 0x09, 0xD5,
+    0x9D, 0x2D, 0x5D, 0x92, 0xD9, 0x3A, 0xCA, 0x3A, 0xCA, 0x29, 0xD4, 0x9D, 0x2D, 0x95, 0xD1, 0xAC,
+    0xA6, 0xD9, 0x9D, 0x7A, 0xCA, 0xD9, 0x79, 0xEA, 0x71, 0xE7, 0x2D, 0x97, 0x2D, 0x72, 0x9D, 0x72,
+    0x9C, 0xA7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x10, 0x70, 0x99, 0x97, 0x4F, 0x75, 0x9C, 0x97,
+    0x39, 0xD7, 0x3A, 0xCA, 0x74, 0xCA, 0x77, 0x70, 0x99, 0x79, 0x93, 0xAC, 0xA5, 0xD9, 0x3A, 0xCA,
+    0x49, 0xD4, 0x9D, 0x4D, 0x95, 0xD3, 0xAD, 0x6D, 0x3D, 0x7D, 0x2A, 0xCA, 0x7D, 0x91, 0xD7, 0x0A,
+    0xC9, 0x0A, 0xCA, 0x70, 0x9C, 0x90, 0xD7, 0x19, 0xCA, 0xAC, 0x97, 0x2C, 0xAD, 0x73, 0xE9, 0x73,
+    0xE7, 0x4D, 0x97, 0x3A, 0xD7, 0x4D, 0x74, 0xDA, 0x70, 0x9F, 0xC7, 0x19, 0xEA, 0x72, 0x49, 0x49,
+    0x5F, 0x1C, 0xA4, 0xAC, 0x9A, 0xF5, 0xC9, 0x19, 0xAC, 0x97, 0x70, 0xAC, 0xA6, 0xAC, 0xA0, 0x9D,
+    0x59, 0xD2, 0xD5, 0xD9, 0x2D, 0x93, 0xAC, 0xA3, 0xAC, 0xA2, 0x9D, 0x49, 0xD2, 0xD9, 0x5D, 0x1A,
+    0xCA, 0x6D, 0x99, 0xD7, 0xAC, 0xAD, 0x97, 0x9E, 0xA7, 0x1E, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7,
+    0x29, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x71, 0x79, 0x49, 0x7F, 0x1C, 0xA6, 0xAC, 0x9A,
+    0xF7, 0xC9, 0x19, 0xAC, 0x97, 0x75, 0x99, 0x79, 0x93, 0xAC, 0xA5, 0xD9, 0x3A, 0xCA, 0x49, 0xD4,
+    0x9D, 0x4D, 0x95, 0xD3, 0xAD, 0x6D, 0x3D, 0x7D, 0x2A, 0xCA, 0x7D, 0x91, 0xD7, 0x0A, 0xC9, 0x0A,
+    0xCA, 0x70, 0x9C, 0x90, 0xD7, 0x19, 0xCA, 0xAC, 0x97, 0x2C, 0xAD, 0x73, 0xE9, 0x73, 0xE7, 0x4D,
+    0x97, 0x3A, 0xD7, 0x4D, 0x74, 0xDA, 0x70, 0x9F, 0xC7, 0x19, 0xEA, 0x72, 0x71, 0xC9, 0x5C, 0x90,
+    0xAF, 0xC0, 0xAA, 0x1C, 0x90, 0xAA, 0x0C, 0x2A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x70,
+    0x9C, 0x39, 0xC4, 0xFC, 0xA0, 0x9C, 0x1A, 0xA1, 0x9C, 0x0A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x60, 0x0A, 0xAA, 0xAA, 0xA0, 0xFC, 0xA0, 0x99, 0x99, 0x90, 0x0A, 0xAA, 0xAA, 0xA0, 0xFC,
+    0xA0, 0x99, 0x99, 0x90, 0x0F, 0xFE, 0x09, 0xFF, 0xE0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF,
+    0xD1, 0x99, 0x99, 0x99, 0x99, 0x91, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA1, 0xFF, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x10, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFD,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x9C, 0xA2, 0xD0, 0x9C,
+    0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2,
+    0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0,
+    0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C,
+    0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2,
+    0xD0, 0x9C, 0xA2, 0xD0, 0x9C, 0xA2, 0xD7, 0x10, 0x19, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xC2,
+    0x99, 0x99, 0x99, 0x99, 0x97, 0x49, 0xFF, 0xCA, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x29,
+    0xC3, 0xD2, 0xAC, 0x92, 0xD2, 0xDA, 0x19, 0xD9, 0x29, 0x92, 0x2D, 0x91, 0xAD, 0x2D, 0x91, 0x9D,
+    0x2A, 0xC9, 0x2C, 0xA3, 0x93, 0x2D, 0xA1, 0x9D, 0x2A, 0xCA, 0x2D, 0x29, 0xCA, 0x2D, 0x70, 0x0D,
+    0x1D, 0x1D, 0x1D, 0x1A, 0xC1, 0x9C, 0x91, 0x90, 0x29, 0xC2, 0xAA, 0x3D, 0x19, 0xC9, 0x2A, 0xC9,
+    0x1D, 0x3D, 0x1A, 0xCA, 0x2D, 0xA1, 0xD2, 0x9D, 0x90, 0xAD, 0x39, 0x92, 0x93, 0x2D, 0x90, 0xAD,
+    0x2A, 0xD1, 0xDA, 0x2D, 0x90, 0x9D, 0x29, 0xD1, 0xAC, 0x92, 0xAC, 0x91, 0xD3, 0xCA, 0x1A, 0xC4,
+    0x97, 0x00, 0x2D, 0xA0, 0x9D, 0x29, 0xD1, 0xAD, 0x2A, 0xCA, 0x1D, 0x3D, 0x19, 0xCA, 0x29, 0xCA,
+    0x1D, 0x3D, 0x19, 0xC9, 0x75, 0x0D, 0x1D, 0x90, 0xD1, 0xD9, 0x0D, 0x1A, 0xC9, 0x0D, 0x1A, 0xC9,
+    0x0A, 0xC1, 0x9C, 0xA0, 0x9C, 0x91, 0xCA, 0x19, 0x29, 0x00, 0x4D, 0xA6, 0xD7, 0xD7, 0xCA, 0x69,
+    0xC4, 0xFF, 0xC9, 0xCA, 0xAD, 0xAA, 0xCA, 0x3C, 0xA7, 0xC9, 0x69, 0xC7, 0xAC, 0x7D, 0x7C, 0xA6,
+    0xAC, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAD, 0x6D, 0xA5, 0x6D, 0xA7, 0x1D, 0x97, 0x1D, 0x72, 0xCA,
+    0x6A, 0xAA, 0x9C, 0xAA, 0xAA, 0x3F, 0xFC, 0x39, 0x1A, 0xC1, 0x99, 0x6D, 0x71, 0x9C, 0xA7, 0x1A,
+    0xCA, 0x71, 0xD9, 0x71, 0xD6, 0x99, 0x1C, 0xA1, 0x93, 0xFF, 0xC3, 0xAA, 0xAA, 0xC9, 0xAA, 0xA6,
+    0xAC, 0x72, 0xD7, 0x19, 0xD7, 0x1A, 0xD6, 0x6A, 0xE0, 0x9F, 0xCA, 0xFC, 0xAF, 0xC9, 0xFA, 0x09,
+    0xDA, 0x00, 0x1A, 0x59, 0xD4, 0x9E, 0x92, 0xAF, 0xA1, 0xFD, 0x90, 0xEA, 0x91, 0x9C, 0xA7, 0x40,
+    0x4D, 0x99, 0xDA, 0x9D, 0x90, 0x91, 0x72, 0xD9, 0x2A, 0xCA, 0x9D, 0xA2, 0xE9, 0xD9, 0x2D, 0xA0,
+    0x95, 0x90, 0x77, 0x1D, 0x92, 0x9D, 0x3D, 0x09, 0xDA, 0x2E, 0x2A, 0xD9, 0x9D, 0x92, 0xDA, 0x2A,
+    0xD1, 0x95, 0x94, 0x91, 0x4A, 0xCA, 0x0E, 0x0D, 0xA1, 0x90, 0x6A, 0xFC, 0x9A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x69, 0xFC, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x60, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70,
+    0x5F, 0xCA, 0xC4, 0xC4, 0xC4, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFC, 0x4C,
+    0x4C, 0x4F, 0xE1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x77, 0x73, 0x9E, 0xA6, 0xCA, 0x72,
+    0x9D, 0xAD, 0x94, 0xD7, 0x3D, 0x19, 0xCA, 0x3A, 0xC9, 0x72, 0x9C, 0xA2, 0xCA, 0x29, 0xCA, 0x73,
+    0xAC, 0x3C, 0xA2, 0xD7, 0x4D, 0x29, 0xC9, 0x1D, 0x75, 0xD2, 0xAC, 0x1A, 0xC9, 0x75, 0xD2, 0xD0,
+    0x9C, 0xA0, 0xAD, 0xA3, 0xAD, 0xA1, 0xD1, 0x9C, 0x90, 0xD0, 0xDA, 0xD9, 0x1F, 0xCA, 0x0A, 0xCA,
+    0xAD, 0x0D, 0x0A, 0xC9, 0x1D, 0x0A, 0xCA, 0x1D, 0x1A, 0xDA, 0x0A, 0xC9, 0x0D, 0x2D, 0x0D, 0x2D,
+    0x59, 0xCA, 0x09, 0xC9, 0x2D, 0x9C, 0xA2, 0xD5, 0xD1, 0xAC, 0x3C, 0xA9, 0xC9, 0x2D, 0x4D, 0x2D,
+    0x29, 0xC9, 0xAC, 0x3C, 0xA3, 0xAC, 0x92, 0xD2, 0xAC, 0x0A, 0xC2, 0xAC, 0x92, 0x9C, 0xA3, 0xD2,
+    0xCA, 0x0A, 0xC9, 0x1D, 0x3D, 0x4A, 0xCA, 0x9D, 0x19, 0xD9, 0xD9, 0x2D, 0x6F, 0x92, 0xAE, 0x97,
+    0x77, 0x40, 0x77, 0x77, 0x39, 0xEA, 0x6C, 0xA7, 0x72, 0x9D, 0xAD, 0x94, 0xD7, 0x73, 0xD1, 0x9C,
+    0xA3, 0xAC, 0x97, 0x72, 0x9C, 0xA2, 0xCA, 0x29, 0xCA, 0x77, 0x3A, 0xC3, 0xCA, 0x2D, 0x77, 0x4D,
+    0x29, 0xC9, 0x1D, 0x77, 0x5D, 0x2A, 0xC1, 0xAC, 0x97, 0x75, 0xD2, 0xD0, 0x9C, 0xA0, 0xAD, 0xA3,
+    0xAD, 0xA3, 0x9D, 0xA1, 0xD1, 0x9C, 0x90, 0xD0, 0xDA, 0xD9, 0x1F, 0xCA, 0x1A, 0xFC, 0x0A, 0xCA,
+    0xAD, 0x0D, 0x0A, 0xC9, 0x1D, 0x0A, 0xCA, 0x1D, 0x09, 0xCA, 0x1D, 0x1A, 0xDA, 0x0A, 0xC9, 0x0D,
+    0x2D, 0x0D, 0x2D, 0x0D, 0x2A, 0xC5, 0x9C, 0xA0, 0x9C, 0x92, 0xD9, 0xCA, 0x2D, 0x0D, 0x2A, 0xC5,
+    0xD1, 0xAC, 0x3C, 0xA9, 0xC9, 0x2D, 0x9C, 0xA2, 0xD4, 0xD2, 0xD2, 0x9C, 0x9A, 0xC3, 0xCA, 0x9C,
+    0x92, 0xD3, 0xAC, 0x92, 0xD2, 0xAC, 0x0A, 0xC2, 0xAC, 0x99, 0xC9, 0x19, 0xC9, 0x29, 0xCA, 0x3D,
+    0x2C, 0xA0, 0xAC, 0x91, 0xD0, 0x9C, 0x91, 0xD3, 0xD4, 0xAC, 0xA9, 0xD1, 0x9D, 0x9D, 0x91, 0xD9,
+    0xAC, 0x92, 0xD6, 0xF9, 0x2A, 0xE9, 0x29, 0xEA, 0x77, 0x77, 0x40, 0x29, 0xD3, 0xD9, 0x29, 0xD3,
+    0xD3, 0x9C, 0x93, 0xD4, 0xA4, 0x29, 0xD1, 0xD3, 0xD9, 0x0A, 0xCA, 0x29, 0xD1, 0xD3, 0xD1, 0xAC,
+    0x92, 0x9C, 0x91, 0xCA, 0x3D, 0x1A, 0xC4, 0xA2, 0xA9, 0x30, 0x29, 0xD1, 0xD1, 0xAC, 0x92, 0xD9,
+    0x0A, 0xCA, 0x09, 0xD2, 0x9D, 0x1D, 0x1D, 0x3D, 0x1A, 0xC9, 0x09, 0xCA, 0x29, 0xC9, 0x1C, 0xA1,
+    0xD3, 0xD1, 0xAC, 0x19, 0xC9, 0x3A, 0x2A, 0x91, 0x99, 0x30, 0x9C, 0x90, 0x9C, 0xA1, 0xD1, 0xAC,
+    0x19, 0xC9, 0x1C, 0x91, 0x99, 0x9C, 0x90, 0xAC, 0x90, 0x9C, 0xA0, 0x9C, 0xA1, 0xD1, 0xD1, 0xAC,
+    0x1D, 0x19, 0xC9, 0x0A, 0xC2, 0xC9, 0x1C, 0x91, 0x99, 0x1A, 0x90, 0x9C, 0x90, 0xAC, 0x90, 0xAC,
+    0x19, 0xCA, 0x09, 0xCA, 0x0A, 0xC9, 0x1D, 0x1D, 0x09, 0xCA, 0x1A, 0xC1, 0xD1, 0xD1, 0x9C, 0x90,
+    0xAC, 0x1A, 0xC2, 0xC9, 0x1C, 0x90, 0x9C, 0x29, 0x91, 0xA9, 0x1A, 0x00, 0x77, 0xCA, 0x6A, 0xD5,
+    0x9C, 0x9C, 0x5C, 0xA0, 0xCA, 0x3A, 0xC1, 0xAC, 0x29, 0xC2, 0x9C, 0x2C, 0x93, 0xC9, 0x0C, 0xA4,
+    0xCA, 0x39, 0x39, 0xCA, 0x19, 0xD1, 0x9D, 0x19, 0xD2, 0xD9, 0x29, 0xD3, 0xD9, 0x29, 0xCA, 0x3D,
+    0x49, 0x10, 0x19, 0x94, 0xD4, 0x9C, 0xA4, 0xD4, 0xAC, 0xA3, 0x9D, 0x3D, 0xA2, 0xDA, 0x2D, 0x92,
+    0xAC, 0x94, 0x94, 0x77, 0x39, 0x5A, 0xC9, 0x59, 0x1D, 0x4D, 0xA4, 0xD1, 0x9D, 0x3A, 0xC9, 0x3D,
+    0x39, 0xD7, 0x0D, 0x94, 0x9D, 0x6D, 0x96, 0x9D, 0x4D, 0x97, 0x09, 0xD2, 0xD9, 0x59, 0x39, 0xD9,
+    0xD9, 0x39, 0x0A, 0xD3, 0x9E, 0x93, 0xDA, 0xAD, 0x4E, 0x4D, 0xA0, 0xA9, 0x3D, 0xAD, 0x39, 0xA6,
+    0xD9, 0x09, 0xD7, 0x2D, 0x92, 0x9D, 0x70, 0xD9, 0x49, 0xD6, 0xD9, 0x69, 0xD4, 0xD9, 0x29, 0xA3,
+    0x9D, 0x2D, 0x93, 0xDA, 0x39, 0xD1, 0xA9, 0x4D, 0xA4, 0x9A, 0x71, 0x97, 0x00, 0x3A, 0xCA, 0x2D,
+    0xA3, 0xDA, 0x2D, 0x93, 0xD9, 0x19, 0xD3, 0x9D, 0x2A, 0xD3, 0xAD, 0x2A, 0xCA, 0x3D, 0xA2, 0xD9,
+    0x3D, 0x92, 0xD4, 0xD2, 0x9D, 0x39, 0xD2, 0x9C, 0xA3, 0x9C, 0xA2, 0xAC, 0x93, 0xAC, 0x92, 0xD4,
+    0xD3, 0xD4, 0xD3, 0xCA, 0x77, 0x75, 0xD9, 0x2D, 0x39, 0xDA, 0x1A, 0xD9, 0x29, 0xD9, 0x1A, 0xD4,
+    0x94, 0x94, 0x74, 0x9A, 0xFA, 0x29, 0xFE, 0xA2, 0xA9, 0xD9, 0x9D, 0x39, 0xD1, 0xD9, 0x29, 0xD1,
+    0xD9, 0x2A, 0xCA, 0x1D, 0x3D, 0x90, 0xDA, 0x3D, 0x9E, 0x4F, 0xA4, 0x9E, 0x95, 0x9D, 0x96, 0xAC,
+    0x97, 0xAC, 0x77, 0x75, 0x9D, 0x7E, 0x7D, 0xA7, 0x09, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99,
+    0xFF, 0xCA, 0x76, 0xC7, 0x1C, 0x1C, 0xA7, 0xCA, 0x19, 0xC9, 0x5C, 0xA3, 0xAC, 0xA9, 0x99, 0xAC,
+    0xA5, 0x9A, 0xEA, 0x40, 0x39, 0xAD, 0xA9, 0x5D, 0xAA, 0x9A, 0xD3, 0xCA, 0x5C, 0xA1, 0xC9, 0x7C,
+    0x0A, 0xA7, 0x0A, 0x97, 0x40, 0x77, 0x5C, 0xA7, 0x0A, 0xC7, 0x1C, 0x97, 0x0A, 0xA7, 0x09, 0xC7,
+    0x1C, 0xA7, 0x0A, 0xC7, 0x1C, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xE7, 0xAC, 0x0C, 0x7C, 0x90, 0xC9,
+    0x5C, 0xA1, 0xC9, 0x49, 0xC2, 0xAA, 0x4C, 0x92, 0xAC, 0x30, 0x77, 0x77, 0x70, 0xAC, 0x97, 0x77,
+    0xD7, 0x77, 0x0D, 0x77, 0x3D, 0x91, 0xCA, 0x77, 0x3A, 0xEA, 0xC9, 0x77, 0x59, 0xAF, 0xE7, 0x72,
+    0xAD, 0xA9, 0x9A, 0xA7, 0x71, 0xAC, 0x9A, 0xC7, 0x74, 0xAC, 0xA0, 0x9C, 0x97, 0x73, 0xD2, 0xD7,
+    0x73, 0x93, 0xD9, 0x75, 0x9D, 0x69, 0x39, 0xCA, 0x70, 0x9C, 0xA7, 0x3A, 0xC9, 0x49, 0x29, 0xC7,
+    0x99, 0x2A, 0xC4, 0xAD, 0x90, 0xAC, 0x7E, 0x90, 0xAA, 0x49, 0xAF, 0xA9, 0x99, 0x99, 0x29, 0xAF,
+    0xA9, 0x99, 0x94, 0xFE, 0xA5, 0x9F, 0xE9, 0x29, 0xE1, 0x99, 0x95, 0xAE, 0x19, 0x92, 0xAC, 0xA0,
+    0xC9, 0x70, 0xAC, 0x99, 0xC9, 0x4A, 0xD1, 0xD7, 0xAC, 0xA1, 0xD4, 0xAC, 0x2A, 0xC9, 0x6A, 0xC2,
+    0xD9, 0x70, 0x9C, 0xA7, 0x3A, 0xC9, 0x77, 0x75, 0x0A, 0xAA, 0xAA, 0x90, 0xFC, 0x90, 0x99, 0x99,
+    0x90, 0x74, 0xCA, 0x74, 0xAC, 0x74, 0x9C, 0x97, 0x4C, 0xA7, 0x4D, 0x74, 0xAC, 0x97, 0x39, 0xCA,
+    0x74, 0xD7, 0x4D, 0x74, 0xAC, 0x97, 0x39, 0xCA, 0x74, 0xD7, 0x4D, 0x74, 0xAC, 0x97, 0x39, 0xCA,
+    0x74, 0xD7, 0x4D, 0x74, 0xAC, 0x97, 0x40, 0x4A, 0xF5, 0xFC, 0x5D, 0x79, 0xD7, 0xAC, 0xA7, 0xAC,
+    0x97, 0xD7, 0x0D, 0x79, 0xCA, 0x7A, 0xCA, 0x7F, 0xC5, 0xFA, 0x5D, 0x79, 0xCA, 0x7A, 0xC9, 0x7D,
+    0x70, 0xD7, 0x9D, 0x79, 0xCA, 0x7A, 0xC9, 0x7F, 0xC5, 0xFA, 0x40, 0x4F, 0x93, 0x9F, 0x96, 0xD7,
+    0xD6, 0x9C, 0xA6, 0xAC, 0xA6, 0xD9, 0x6D, 0x7D, 0x69, 0xCA, 0x39, 0xF9, 0x3A, 0xF7, 0xD6, 0x9D,
+    0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xCA, 0x39, 0xF9, 0x3A, 0xF4, 0x77, 0x79,
+    0xAF, 0xA3, 0x9F, 0xC9, 0x29, 0xFE, 0xA1, 0xAF, 0xE9, 0x2A, 0x92, 0x9D, 0x2A, 0x3A, 0xD7, 0x0D,
+    0x97, 0xD7, 0x0D, 0x97, 0xD7, 0x0D, 0x79, 0xD7, 0xDA, 0x7D, 0x96, 0xE6, 0x9D, 0xA5, 0x9D, 0xA6,
+    0x9D, 0xA5, 0x9D, 0xA6, 0xAD, 0x96, 0xD9, 0x7D, 0x79, 0xC9, 0x7A, 0xC7, 0x0A, 0xC7, 0x0D, 0x77,
+    0x77, 0x77, 0x39, 0xD7, 0xAC, 0xA7, 0xE6, 0x9E, 0x7D, 0xA7, 0xD9, 0x70, 0x97, 0x19, 0x70, 0x77,
+    0x29, 0xAF, 0xA4, 0xD9, 0x09, 0xFE, 0xA2, 0x9D, 0x91, 0xA9, 0x29, 0xD2, 0x9D, 0x70, 0xD9, 0x1A,
+    0xD7, 0x0D, 0x91, 0xDA, 0x70, 0xD2, 0xD9, 0x7D, 0xA2, 0xD7, 0xE2, 0x9D, 0x59, 0xDA, 0x3A, 0xCA,
+    0x49, 0xDA, 0x4A, 0xC9, 0x4D, 0x95, 0xD4, 0x9C, 0x96, 0xD4, 0xAC, 0x7C, 0xA7, 0x77, 0x75, 0x9D,
+    0x6D, 0x4E, 0x5A, 0xD9, 0x3D, 0xA5, 0xAD, 0x59, 0x79, 0x40, 0x77, 0x5A, 0xCA, 0x2A, 0xFC, 0x94,
+    0xDA, 0x1F, 0xF9, 0x3D, 0x91, 0x99, 0x3D, 0xA2, 0x9D, 0x70, 0x9D, 0x2A, 0xD7, 0x09, 0xD2, 0xDA,
+    0x70, 0xAC, 0xA2, 0xD9, 0x79, 0xD3, 0xD7, 0x9D, 0x92, 0x9D, 0x6A, 0xD9, 0x39, 0xCA, 0x5A, 0xD5,
+    0xAC, 0x94, 0x9D, 0x6D, 0x5D, 0x7D, 0x5C, 0xA7, 0x77, 0x77, 0x2D, 0x94, 0xD9, 0x59, 0xDA, 0x39,
+    0xDA, 0x59, 0xD9, 0x39, 0xD9, 0x69, 0x69, 0x70, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF,
+    0xEA, 0x09, 0x99, 0x99, 0x99, 0x99, 0xD9, 0x70, 0x9C, 0xA7, 0x1D, 0x71, 0xAC, 0x97, 0x09, 0xD7,
+    0x1D, 0x97, 0x0A, 0xCA, 0x71, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xCA, 0x60, 0x9F,
+    0xFA, 0x91, 0x9F, 0xFD, 0xA0, 0x9C, 0x19, 0xFE, 0x09, 0xC1, 0x9F, 0xEA, 0x9C, 0x19, 0xFF, 0x9C,
+    0x19, 0xFF, 0x9C, 0x19, 0xFF, 0x9C, 0x19, 0xFF, 0x9C, 0x19, 0xFF, 0x9C, 0x19, 0xFE, 0x99, 0xC1,
+    0x9F, 0xE0, 0x9C, 0x19, 0xFD, 0x19, 0xC1, 0x9C, 0x99, 0x93, 0x9C, 0x19, 0xC6, 0x9C, 0x19, 0xC6,
+    0x9C, 0x19, 0xC6, 0x9C, 0x19, 0xC6, 0x9C, 0x19, 0xC6, 0x9C, 0x19, 0xC6, 0x9C, 0x19, 0xC6, 0x9C,
+    0x19, 0xC6, 0x9C, 0x19, 0xC7, 0x73, 0x39, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xD0, 0xAF, 0xE9,
+    0x9D, 0x0F, 0xF1, 0xD9, 0xFF, 0x1D, 0xAF, 0xF1, 0xDA, 0xFF, 0x1D, 0xAF, 0xF1, 0xDA, 0xFF, 0x1D,
+    0x9F, 0xF1, 0xD0, 0xFF, 0x1D, 0x09, 0xFE, 0xAA, 0xD1, 0x9A, 0xFF, 0xC7, 0x40, 0x99, 0x99, 0x99,
+    0x99, 0x93, 0xFF, 0xDA, 0x1D, 0x99, 0xFE, 0xA0, 0xCA, 0x1F, 0xF0, 0xCA, 0x1F, 0xF9, 0xCA, 0x1F,
+    0xFA, 0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xF9, 0xCA, 0x1F, 0xF0,
+    0xDA, 0xAF, 0xE9, 0x0F, 0xFC, 0xA7, 0x70, 0x77, 0x29, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xC5, 0xDA,
+    0x1C, 0xA5, 0xAE, 0xAC, 0x97, 0x0A, 0xFE, 0x93, 0x9E, 0x99, 0xAA, 0x39, 0xCA, 0xAC, 0x6A, 0xD1,
+    0xCA, 0x5D, 0x2D, 0x69, 0x2A, 0xC9, 0x77, 0x2A, 0xA2, 0x9D, 0xA1, 0xAD, 0x92, 0xA9, 0x77, 0x77,
+    0x73, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xAC, 0x49, 0x20, 0x79, 0xAD, 0xA9, 0x71, 0xDA, 0xA9, 0xAD,
+    0x7C, 0xA5, 0xCA, 0x5C, 0x97, 0xC4, 0xAA, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0C, 0x71, 0xC4, 0xCA, 0x7C, 0xA4,
+    0x9C, 0x95, 0xCA, 0x6A, 0xCA, 0x99, 0x9A, 0xCA, 0x70, 0x9A, 0xEA, 0x70, 0x77, 0x6D, 0x74, 0xD7,
+    0x93, 0xD7, 0xD9, 0x1C, 0x97, 0xAE, 0xAC, 0x72, 0x9A, 0xFE, 0x6A, 0xDA, 0x9A, 0xAA, 0x5A, 0xC9,
+    0xD7, 0x0D, 0xA0, 0xAC, 0x96, 0x9D, 0x19, 0xD7, 0x93, 0xD7, 0x49, 0x77, 0x70, 0x9C, 0xA7, 0x39,
+    0xCA, 0x73, 0xAC, 0x7A, 0xCA, 0x1A, 0xC7, 0xAE, 0xAC, 0xA7, 0x2A, 0xFE, 0x95, 0x9E, 0x99, 0xAA,
+    0x94, 0x9C, 0xA9, 0xC7, 0x09, 0xD1, 0xCA, 0x7D, 0x2D, 0x70, 0x92, 0xAC, 0xA7, 0x49, 0x60, 0x71,
+    0xAD, 0x3D, 0x0E, 0x29, 0xCA, 0x09, 0xCA, 0x2A, 0xC7, 0xD6, 0xAC, 0x96, 0xD6, 0x9C, 0xA6, 0xAC,
+    0x7D, 0x69, 0xC9, 0x6D, 0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xC9, 0x6D, 0x29, 0xCA, 0x1C, 0xA2,
+    0xAD, 0x0A, 0xC9, 0x2A, 0xD7, 0x20, 0x39, 0x99, 0x77, 0x0A, 0xFD, 0xA9, 0x70, 0xC9, 0x0A, 0xCA,
+    0x99, 0x9A, 0xFC, 0xA9, 0x29, 0xD1, 0xC9, 0x69, 0xAF, 0xF1, 0x9A, 0x73, 0x9A, 0xAA, 0x92, 0x59,
+    0x99, 0x97, 0xAF, 0xD9, 0x4D, 0x93, 0xAC, 0x92, 0xCA, 0x6A, 0xC1, 0xAA, 0x70, 0xC9, 0x0A, 0x71,
+    0x90, 0x59, 0xA7, 0x3A, 0xC7, 0xAC, 0x1A, 0xC1, 0xAC, 0x39, 0xD0, 0xAC, 0x0A, 0xC9, 0x49, 0xFA,
+    0xC9, 0x69, 0xFA, 0x39, 0xFF, 0xF9, 0x0A, 0xAA, 0xAF, 0xAA, 0xAA, 0x4A, 0xFC, 0x6A, 0xC9, 0xAC,
+    0x9D, 0x4A, 0xC9, 0x0A, 0xC0, 0x9D, 0x49, 0x1A, 0xC1, 0x99, 0x7A, 0xC7, 0x73, 0x77, 0x2D, 0x96,
+    0x9D, 0xA7, 0xAA, 0x77, 0x77, 0x75, 0x97, 0x0A, 0xD7, 0xAD, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x73,
+    0x9A, 0x70, 0xDA, 0x7D, 0x97, 0x99, 0x00, 0x29, 0xD1, 0xD1, 0xD9, 0x0A, 0xCA, 0x2D, 0x90, 0xAC,
+    0xA0, 0x9D, 0x1D, 0x29, 0xD1, 0xD1, 0xD1, 0xAC, 0x92, 0xD1, 0xAC, 0x90, 0x9C, 0x91, 0xCA, 0x29,
+    0xC9, 0x1C, 0xA1, 0xD1, 0xAC, 0x3D, 0x1A, 0xC1, 0x9C, 0x2C, 0x93, 0xA2, 0xA9, 0x19, 0x91, 0x9A,
+    0x30, 0x77, 0x72, 0xD9, 0x76, 0x9D, 0xA7, 0x7A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0x97, 0x59,
+    0x1A, 0xD7, 0x3A, 0xD0, 0xAD, 0x73, 0xAD, 0x1A, 0x97, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0x9A, 0x77, 0x0D, 0xA7, 0x7D, 0x97, 0x79, 0x97, 0x00, 0x77, 0x29, 0xD7, 0x39, 0xD0, 0xAD, 0x73,
+    0x9D, 0x90, 0xAA, 0x74, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xA7, 0x70, 0xDA, 0x77, 0xDA,
+    0x77, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5A, 0x97, 0x4A, 0x90, 0xAD, 0x73, 0xAD, 0x0A, 0xD7,
+    0x3A, 0xD1, 0x97, 0x59, 0x10, 0x39, 0xD0, 0xAD, 0x09, 0xD7, 0x77, 0x77, 0x71, 0xCA, 0x0A, 0xD0,
+    0x9D, 0x40, 0x5A, 0xA7, 0x39, 0xD9, 0x73, 0xD9, 0x74, 0x97, 0x77, 0x77, 0x77, 0x73, 0xAA, 0x79,
+    0xA9, 0x0A, 0xD7, 0xE0, 0xAD, 0x7A, 0xD1, 0x97, 0x19, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xA7, 0x39,
+    0xD9, 0x73, 0xD9, 0x77, 0x40, 0x70, 0x99, 0x77, 0x0D, 0x77, 0x0D, 0x72, 0xDA, 0x2D, 0x2A, 0xD4,
+    0xE2, 0xD2, 0xE4, 0xAC, 0x92, 0xD2, 0x9C, 0x97, 0x2D, 0x77, 0x0D, 0x77, 0x0D, 0x70, 0xFF, 0xFF,
+    0xD0, 0xFF, 0xFF, 0xD7, 0x0D, 0x77, 0x0D, 0x77, 0x0D, 0x72, 0x9A, 0x3D, 0x29, 0xA5, 0xDA, 0x2D,
+    0x2D, 0xA4, 0xDA, 0x2D, 0x2D, 0xA5, 0x93, 0xD3, 0x97, 0x3D, 0x77, 0x0A, 0x97, 0x19, 0x1E, 0x0E,
+    0x0A, 0xC9, 0x77, 0x0D, 0xA0, 0xE0, 0xDA, 0x77, 0x0D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x39, 0xD0,
+    0xAD, 0x99, 0xD7, 0x09, 0xD0, 0xAD, 0x9A, 0xD7, 0x09, 0xD0, 0xAD, 0x9A, 0xD1, 0x95, 0x9D, 0x0A,
+    0xD9, 0xAD, 0x19, 0x10, 0x5A, 0xFA, 0x1A, 0xA3, 0xAA, 0x3A, 0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA7, 0x5F, 0xE3, 0xD3, 0xD3, 0xFE, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A,
+    0xFA, 0x0F, 0x19, 0xD9, 0x2D, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x79, 0x93,
+    0xD2, 0xAD, 0xA1, 0xF0, 0xAF, 0xA1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x7D, 0x2C, 0x99,
+    0xC0, 0xAA, 0x1A, 0xA0, 0xAA, 0xAA, 0x2A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5A,
+    0xDA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x39, 0x94,
+    0x9F, 0x92, 0xD9, 0x0D, 0x1A, 0xC9, 0x1A, 0xC1, 0xD2, 0xAC, 0x1C, 0xA2, 0xAC, 0x09, 0xC9, 0x2D,
+    0x09, 0xC9, 0x2C, 0xA0, 0x9C, 0x91, 0x9C, 0x90, 0x9C, 0xA1, 0xD2, 0xFC, 0x93, 0xAC, 0xA3, 0x5A,
+    0xC2, 0x94, 0x9C, 0x1A, 0xC1, 0xAA, 0x1C, 0x91, 0xC1, 0x9C, 0x1A, 0xC1, 0xA9, 0x10, 0x76, 0xAC,
+    0xA4, 0x9D, 0x94, 0xE4, 0xCA, 0xAC, 0x3D, 0x0D, 0x2A, 0xC1, 0xCA, 0x1A, 0xC9, 0x99, 0xCA, 0x1F,
+    0xEA, 0x4D, 0x6C, 0xA6, 0xA9, 0x10, 0x72, 0x9F, 0xC2, 0xAC, 0x99, 0x99, 0x2C, 0xA6, 0xC9, 0x59,
+    0xF9, 0x39, 0x99, 0xD6, 0x9C, 0x95, 0x9C, 0x95, 0xD1, 0xAC, 0xAA, 0xD9, 0x2A, 0xDA, 0x30, 0x59,
+    0x49, 0xF2, 0x9C, 0xA9, 0x09, 0x2C, 0xA5, 0xAC, 0x6F, 0xD2, 0xD9, 0x0A, 0xC9, 0x09, 0xCA, 0x2C,
+    0xA0, 0x9C, 0x92, 0xC9, 0x1C, 0xA1, 0xAC, 0x2D, 0xAD, 0xA3, 0xAC, 0xA9, 0x20, 0x72, 0xFD, 0xA1,
+    0x99, 0x99, 0xD9, 0x5C, 0xA5, 0xD5, 0x9C, 0x95, 0xD5, 0xAC, 0x59, 0xCA, 0x5D, 0x5A, 0xC9, 0x5A,
+    0xA5, 0x39, 0x94, 0x9F, 0x92, 0xCA, 0x1D, 0x19, 0xC9, 0x1A, 0xC2, 0xCA, 0x1C, 0xA2, 0x9E, 0xA2,
+    0x9F, 0x91, 0x9C, 0xA1, 0xD1, 0xAC, 0x29, 0xC9, 0x0D, 0x2A, 0xC1, 0x9D, 0xAD, 0xA2, 0x9A, 0xCA,
+    0x92, 0x72, 0x9F, 0x29, 0xD0, 0x9C, 0xA1, 0xAC, 0x2A, 0xC1, 0xD2, 0xAC, 0x1D, 0x2D, 0x1A, 0xDA,
+    0xE2, 0xAC, 0xA9, 0xC9, 0x5A, 0xC5, 0xAC, 0x91, 0xAA, 0xAD, 0xA2, 0x9C, 0xAA, 0x40, 0x29, 0x95,
+    0xAA, 0x5A, 0xA2, 0x9F, 0xD9, 0x0A, 0xAD, 0xAA, 0x3A, 0xA5, 0xAA, 0x72, 0x9F, 0xD9, 0x0A, 0xAA,
+    0xAA, 0xA0, 0x79, 0xFD, 0x97, 0x09, 0x99, 0x99, 0x90, 0x9F, 0xD9, 0x49, 0x4C, 0xA3, 0xD3, 0x9C,
+    0x93, 0xD3, 0x9C, 0x93, 0xAC, 0x4D, 0x4C, 0xA4, 0xCA, 0x4C, 0xA4, 0xD4, 0xAC, 0x5C, 0x92, 0x29,
+    0x4D, 0x39, 0xC3, 0x9C, 0x93, 0xC9, 0x3C, 0x92, 0x9C, 0x92, 0x9C, 0x92, 0xAC, 0x3C, 0xA2, 0xAC,
+    0x92, 0xCA, 0x2A, 0xC2, 0xAC, 0x30, 0x59, 0x92, 0xAC, 0xAE, 0xA1, 0xDA, 0x1A, 0xC1, 0xD2, 0xD0,
+    0x9C, 0x92, 0xCA, 0x0A, 0xC3, 0xC9, 0x0A, 0xC2, 0x9C, 0x1C, 0xA2, 0xAC, 0x1C, 0x92, 0xAA, 0x00,
+    0x39, 0x95, 0xF9, 0x2D, 0x90, 0xD1, 0xAC, 0x91, 0xAC, 0x1D, 0x2A, 0xC1, 0xCA, 0x2A, 0xC0, 0x9C,
+    0x92, 0xAC, 0x09, 0xC9, 0x2D, 0x09, 0xC9, 0x19, 0xCA, 0x1C, 0xA1, 0xD2, 0xFC, 0x93, 0xAC, 0xA3,
+    0x70, 0x9D, 0x1E, 0xA0, 0xD9, 0xC9, 0x2A, 0xC3, 0xD3, 0xD3, 0xCA, 0x29, 0xC9, 0x2A, 0xC3, 0xD3,
+    0xA9, 0x10, 0x49, 0x94, 0xAF, 0x92, 0xC9, 0x09, 0xD6, 0xD6, 0xD5, 0xAC, 0x94, 0xAC, 0x94, 0xAC,
+    0x94, 0xD9, 0x4D, 0x5F, 0xE1, 0xAA, 0xAA, 0xAA, 0x90, 0x39, 0x93, 0xFC, 0x91, 0xA9, 0x09, 0xD5,
+    0xD5, 0xCA, 0x19, 0xAA, 0xCA, 0x29, 0xAD, 0x95, 0xAC, 0x5A, 0xC0, 0x93, 0xD0, 0xDA, 0xAD, 0x90,
+    0x9A, 0xDA, 0x20, 0x75, 0x9D, 0x5D, 0xA4, 0xEA, 0x3A, 0xC9, 0xC9, 0x2A, 0xC0, 0xAC, 0x29, 0xC9,
+    0x0D, 0x19, 0xCA, 0x99, 0xD9, 0x0A, 0xFE, 0x4A, 0xC9, 0x5A, 0xC6, 0x9A, 0x20, 0x72, 0x9F, 0xC2,
+    0xAC, 0x99, 0x99, 0x2C, 0xA6, 0xC9, 0x59, 0xF9, 0x39, 0x99, 0xD6, 0x9C, 0x95, 0x9C, 0x6D, 0x1A,
+    0xCA, 0xAD, 0x92, 0xAD, 0xA3, 0x59, 0x49, 0xF9, 0x19, 0xD9, 0x09, 0x2C, 0xA5, 0xAC, 0x19, 0x3F,
+    0xD2, 0xD9, 0x09, 0xCA, 0x1C, 0xA2, 0xCA, 0x1C, 0x92, 0xCA, 0x1C, 0xA1, 0xAC, 0x91, 0xAF, 0xA3,
+    0xAC, 0xA9, 0x20, 0x72, 0xFD, 0xA1, 0x99, 0x99, 0xAC, 0x95, 0xCA, 0x5A, 0xC5, 0x9C, 0xA5, 0xD5,
+    0xAC, 0x95, 0xCA, 0x5D, 0x59, 0xCA, 0x5A, 0xA5, 0x49, 0x49, 0xFA, 0x2D, 0x1A, 0xC2, 0xCA, 0x19,
+    0xC9, 0x1D, 0x1D, 0x29, 0xEA, 0x3F, 0x92, 0xCA, 0x1A, 0xC9, 0x0A, 0xC2, 0x9C, 0x90, 0xAC, 0x2A,
+    0xC9, 0x1D, 0xAA, 0xCA, 0x3A, 0xCA, 0x92, 0x72, 0x9F, 0x3D, 0x99, 0xD1, 0xAC, 0x2A, 0xC1, 0xD2,
+    0xAC, 0x1D, 0x2D, 0x19, 0xDA, 0xE2, 0x9C, 0xA9, 0xCA, 0x5A, 0xC5, 0x9C, 0xA1, 0x9A, 0xAD, 0xA2,
+    0x9A, 0xCA, 0x40, 0x39, 0x59, 0xC5, 0x9C, 0x3F, 0xD9, 0x0A, 0xAA, 0xCA, 0xA9, 0x29, 0xC5, 0x9C,
+    0x69, 0x20, 0x0F, 0xD9, 0x0A, 0xAA, 0xAA, 0xA9, 0x70, 0xFD, 0xA7, 0x09, 0x99, 0x99, 0x91, 0xFD,
+    0xA0, 0x39, 0x3D, 0x2A, 0xC2, 0x9C, 0x92, 0xD2, 0x9C, 0x92, 0xAC, 0x3D, 0x3D, 0x3D, 0x3D, 0x3A,
+    0xC3, 0x9C, 0x4C, 0x92, 0x29, 0x4A, 0xC3, 0x9C, 0x93, 0xC9, 0x3C, 0xA3, 0xCA, 0x3C, 0xA2, 0x9C,
+    0x92, 0xAC, 0x3D, 0x29, 0xC9, 0x2D, 0x2A, 0xC2, 0x9C, 0x92, 0x2A, 0xCA, 0x09, 0x91, 0xD9, 0x9D,
+    0x90, 0xAC, 0x2A, 0xC1, 0xC9, 0x2A, 0xC0, 0x9C, 0x3C, 0xA0, 0xAC, 0x3C, 0x90, 0x9C, 0x2D, 0x2D,
+    0xAC, 0x9C, 0x3A, 0x91, 0x91, 0x2A, 0xCA, 0x92, 0xD9, 0xAC, 0x1A, 0xC2, 0xC9, 0x0C, 0x90, 0x9D,
+    0x09, 0xEA, 0x91, 0xAC, 0x59, 0xC6, 0xDA, 0xAC, 0x92, 0x9A, 0x92, 0x2A, 0xAA, 0x93, 0xD9, 0x9C,
+    0xA1, 0xD2, 0xAC, 0x1C, 0x92, 0x9C, 0x09, 0xC3, 0xAC, 0x0A, 0xC3, 0xCA, 0x09, 0xC2, 0x9C, 0x2D,
+    0xAA, 0xC9, 0x39, 0xA9, 0x30, 0x1A, 0x92, 0xA9, 0x19, 0xC1, 0xAC, 0x3C, 0x9A, 0xC4, 0x9D, 0x59,
+    0xCA, 0x49, 0xCA, 0xC4, 0xC9, 0x0C, 0x92, 0xCA, 0x1A, 0xC1, 0x99, 0x39, 0x10, 0x09, 0xAC, 0xA9,
+    0x1A, 0x99, 0xAC, 0x94, 0xAC, 0x4A, 0xC0, 0x9F, 0xCA, 0xC9, 0x1C, 0xAC, 0xA1, 0xAC, 0x0A, 0xCA,
+    0xD2, 0x9A, 0x92, 0x19, 0xC6, 0xAC, 0x6C, 0xA6, 0xC9, 0x9A, 0xA9, 0x19, 0xCA, 0xA9, 0xAC, 0x19,
+    0xCA, 0x19, 0xC1, 0xAC, 0x29, 0xC1, 0xC9, 0x2A, 0xC1, 0xC3, 0xCA, 0x09, 0xC3, 0xC9, 0x0A, 0xC2,
+    0x9C, 0x19, 0x93, 0x91, 0x19, 0xC6, 0xAC, 0x6C, 0xA6, 0xC9, 0x1A, 0xA1, 0x9C, 0x1A, 0xC2, 0xAC,
+    0x0A, 0xC3, 0xAA, 0xAC, 0x4F, 0x4C, 0x90, 0xC9, 0x29, 0xC1, 0xAC, 0x2A, 0xC2, 0xC9, 0x19, 0x92,
+    0x99, 0x10, 0x19, 0xC2, 0xAC, 0x2C, 0xA2, 0xC9, 0x2C, 0x29, 0xC2, 0xAA, 0x2C, 0x92, 0xC9, 0x19,
+    0xC2, 0xAC, 0x29, 0x92, 0x1A, 0x09, 0xCA, 0x19, 0xCA, 0x92, 0xCA, 0xA9, 0xCA, 0xAA, 0x9D, 0x19,
+    0xC9, 0x19, 0xCA, 0x19, 0xC1, 0xAC, 0x2A, 0xC2, 0xAC, 0x1C, 0xA2, 0xCA, 0x2C, 0xA1, 0xC9, 0x2C,
+    0x92, 0xC9, 0x09, 0xC2, 0x9C, 0x29, 0xC1, 0xAC, 0x2A, 0xC2, 0x9C, 0x19, 0x92, 0x99, 0x29, 0x91,
+    0x1A, 0x09, 0xD9, 0x19, 0xCA, 0xA9, 0xAC, 0x1A, 0xCA, 0x19, 0xC1, 0xD2, 0x9C, 0x1C, 0xA2, 0xAC,
+    0x1C, 0x92, 0xCA, 0x09, 0xC3, 0xC9, 0x0A, 0xC2, 0x9C, 0x19, 0x93, 0x91, 0x2A, 0x09, 0xAA, 0x39,
+    0xCA, 0xA9, 0xAC, 0x29, 0xCA, 0x2C, 0x91, 0xAC, 0x3C, 0x91, 0xC9, 0x29, 0xC2, 0xC9, 0x2A, 0xC1,
+    0x9C, 0x91, 0x9C, 0x91, 0xAD, 0xAA, 0xCA, 0x2C, 0xA0, 0x9A, 0x4C, 0x96, 0x9C, 0x7A, 0xC7, 0x19,
+    0xAC, 0xA9, 0x09, 0xCA, 0x99, 0xA0, 0xAC, 0x49, 0xCA, 0x49, 0xD9, 0x4A, 0xC4, 0x9C, 0x0A, 0xAA,
+    0xAC, 0xA1, 0x9A, 0x99, 0x10, 0x29, 0x3A, 0xA2, 0xAD, 0xA9, 0x0A, 0xC9, 0x91, 0x9C, 0x3A, 0xA3,
+    0xC9, 0x3C, 0x92, 0x9C, 0x4C, 0xAA, 0x29, 0xA9, 0x10, 0x77, 0x19, 0xFA, 0x6E, 0xAA, 0xD5, 0xAD,
+    0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x29, 0x99, 0x99, 0x91, 0xD2, 0x9F, 0xD1, 0xD2, 0xAC, 0x95,
+    0xD2, 0xD6, 0xD9, 0x1D, 0x6A, 0xD9, 0xAD, 0x99, 0x94, 0xAF, 0xFA, 0x59, 0xDA, 0x99, 0x97, 0xD7,
+    0x3D, 0x72, 0x9C, 0xA7, 0x2A, 0xDA, 0xAA, 0xA6, 0xFD, 0xA2, 0x7A, 0xC1, 0xC9, 0x7C, 0xA0, 0xAC,
+    0x69, 0xAF, 0xC5, 0xFF, 0xA2, 0x9F, 0x90, 0xAC, 0xA2, 0x9D, 0x9A, 0xC1, 0xC9, 0x3D, 0x90, 0xCA,
+    0x0A, 0xC3, 0xAD, 0x09, 0xC1, 0xCA, 0x3D, 0x90, 0xD0, 0x9C, 0x93, 0xD1, 0xC9, 0x0A, 0xC3, 0x9D,
+    0x0A, 0xC1, 0xC9, 0x3A, 0xCA, 0x0C, 0xA0, 0xAC, 0x4A, 0xCA, 0x9C, 0x1C, 0xA4, 0x9F, 0x09, 0xC9,
+    0x5E, 0x90, 0xAC, 0x6E, 0x1C, 0x96, 0x9F, 0xCA, 0xDA, 0x39, 0xFF, 0x93, 0xD0, 0x9C, 0x97, 0xC9,
+    0x0A, 0xC7, 0x09, 0x19, 0x97, 0x77, 0x3A, 0xFC, 0xA4, 0x9F, 0xF9, 0x29, 0xDA, 0x4A, 0x3D, 0xA7,
+    0x1D, 0xA7, 0x19, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x1A, 0xC0, 0xAD, 0x2D, 0x2D, 0xAE, 0x19, 0xD2,
+    0xE4, 0x9D, 0x2D, 0x94, 0x9D, 0x19, 0xD5, 0x9D, 0x1A, 0xC9, 0x59, 0xD1, 0xD7, 0xD9, 0x0D, 0x7A,
+    0xDA, 0xD7, 0x0F, 0xF9, 0x5A, 0xFD, 0x77, 0x10, 0x49, 0xFF, 0x94, 0xAF, 0xF9, 0x4D, 0x97, 0x3D,
+    0x74, 0xD7, 0x39, 0xCA, 0x73, 0xAC, 0x97, 0x3D, 0x97, 0x3D, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0x59,
+    0xD9, 0x99, 0x99, 0x95, 0xAC, 0x97, 0x3D, 0x72, 0xFE, 0x95, 0x9F, 0xE7, 0x0A, 0xCA, 0x73, 0xD9,
+    0x73, 0xD7, 0x20, 0x77, 0x79, 0xFC, 0x97, 0xAF, 0xE6, 0x9D, 0x93, 0x96, 0xD9, 0x74, 0xD7, 0x49,
+    0xD7, 0x49, 0xCA, 0x72, 0xFF, 0xC5, 0x9F, 0xFA, 0x70, 0xD7, 0x39, 0x9D, 0x99, 0x99, 0x6F, 0xFC,
+    0x69, 0x9D, 0xA9, 0x99, 0x97, 0x0D, 0x74, 0xAC, 0xA7, 0x39, 0xCA, 0x73, 0xFF, 0xEA, 0x3F, 0xFE,
+    0xA2, 0x76, 0x9A, 0x77, 0x2C, 0xA7, 0x71, 0xD7, 0x09, 0x2A, 0xAA, 0x19, 0xCA, 0xAA, 0x94, 0xAC,
+    0x09, 0xFC, 0x0F, 0xE3, 0xD9, 0xCA, 0x99, 0xFC, 0x90, 0x9D, 0x92, 0xE9, 0x2A, 0xE3, 0xD9, 0x19,
+    0xDA, 0x3A, 0xD9, 0x3D, 0x91, 0x9D, 0x4E, 0x4D, 0x91, 0xAC, 0xA3, 0x9D, 0x94, 0xD2, 0xD9, 0x3E,
+    0x49, 0xD2, 0xD3, 0xAE, 0x4A, 0xCA, 0x19, 0xD3, 0xEA, 0x4D, 0x91, 0xAC, 0xA2, 0xF9, 0x4D, 0x2D,
+    0x91, 0x9C, 0x9D, 0x5D, 0x2D, 0x2C, 0xA0, 0xD4, 0x9D, 0x2D, 0x1A, 0xC0, 0x9D, 0x4A, 0xCA, 0x59,
+    0xC9, 0x77, 0x1D, 0x77, 0x19, 0xC7, 0x70, 0x39, 0xD4, 0xD4, 0xAD, 0x93, 0xCA, 0x4E, 0x92, 0x9C,
+    0xA4, 0xEA, 0x2A, 0xC9, 0x39, 0xCA, 0xCA, 0x2D, 0x4A, 0xC9, 0xD2, 0xD2, 0x9A, 0xDA, 0xDA, 0xAA,
+    0xDA, 0x90, 0xAF, 0xFF, 0x3D, 0x0A, 0xC9, 0x0A, 0xC4, 0x9C, 0xA0, 0x9C, 0x90, 0xD2, 0x9F, 0xFF,
+    0xA0, 0x9A, 0xDA, 0xAA, 0xDA, 0xDA, 0x92, 0xD2, 0xDA, 0xC9, 0x4C, 0xA2, 0xDA, 0xC4, 0x9C, 0xA2,
+    0xF4, 0xAC, 0x92, 0xAE, 0x4D, 0x3A, 0xDA, 0x4D, 0x39, 0xD9, 0x30, 0x3A, 0xEA, 0x97, 0x3F, 0xE7,
+    0x2D, 0x19, 0xE7, 0x1D, 0x3D, 0x70, 0x9C, 0xA3, 0xD9, 0x7A, 0xCA, 0x3D, 0x90, 0x9C, 0x4D, 0x93,
+    0xD1, 0xD4, 0xD3, 0xAD, 0x0A, 0xCA, 0x99, 0x19, 0xD2, 0xAD, 0xAF, 0xD1, 0xAF, 0xE9, 0x09, 0xD9,
+    0x92, 0xAF, 0xC9, 0x3D, 0x4D, 0x96, 0x9C, 0xA4, 0xD7, 0xAC, 0x93, 0x9D, 0x7D, 0x93, 0xAC, 0xA7,
+    0xD4, 0xD9, 0x7D, 0x4D, 0x70, 0xDA, 0xA9, 0x1D, 0x70, 0xAE, 0x97, 0x72, 0x3A, 0xFA, 0x76, 0xFE,
+    0x97, 0x4D, 0x2E, 0x73, 0x9D, 0x3D, 0x73, 0x9C, 0xA3, 0xD2, 0xAA, 0xA9, 0x4A, 0xC9, 0x3D, 0x09,
+    0xFD, 0x3D, 0x92, 0x9D, 0x0D, 0xA0, 0x9A, 0x93, 0xD3, 0xDA, 0x9D, 0x79, 0xD9, 0x99, 0xE0, 0x9D,
+    0x7A, 0xFD, 0xA2, 0xD9, 0x6E, 0xAD, 0xA3, 0xAD, 0x95, 0xD1, 0x9D, 0x4A, 0xDA, 0x4D, 0x2D, 0x59,
+    0xD9, 0x29, 0xD2, 0xD9, 0x5A, 0xCA, 0x2A, 0xCA, 0x2A, 0xC9, 0x59, 0xCA, 0x2D, 0x92, 0xAC, 0xA5,
+    0xDA, 0x2D, 0x39, 0xD0, 0xDA, 0xAE, 0x3D, 0x4D, 0x0A, 0xFC, 0x77, 0x70, 0x19, 0xCA, 0x3D, 0x39,
+    0xC9, 0x19, 0xCA, 0x29, 0xD3, 0xD2, 0x9C, 0xA2, 0xE3, 0xD2, 0x9C, 0x92, 0xCA, 0xC2, 0xAC, 0x92,
+    0xAC, 0x91, 0xAC, 0x9C, 0x2D, 0x3A, 0xC9, 0x1C, 0xAA, 0xC2, 0xCA, 0x3A, 0xC9, 0x09, 0xC9, 0xAC,
+    0x1A, 0xC9, 0x3A, 0xC1, 0xAC, 0x0A, 0xC1, 0xD3, 0xFF, 0xFE, 0x19, 0xAD, 0xAE, 0xAD, 0xAD, 0xAA,
+    0x3D, 0x0D, 0x1D, 0x0D, 0x5D, 0x0C, 0xA1, 0xCA, 0x9C, 0x95, 0xD9, 0xC2, 0xCA, 0xAC, 0x6C, 0xAD,
+    0x2C, 0xAC, 0xA6, 0xE9, 0x2E, 0x96, 0xE3, 0xE7, 0xDA, 0x3D, 0xA7, 0xD9, 0x3D, 0x95, 0x39, 0xFD,
+    0xA9, 0x4A, 0xC4, 0xFF, 0xC9, 0x3D, 0x4D, 0x49, 0xD3, 0xD4, 0xD5, 0xAC, 0x91, 0x9C, 0xA3, 0x9C,
+    0xA1, 0x99, 0x19, 0xC9, 0x1A, 0xC9, 0x3A, 0xC9, 0x1D, 0x1A, 0xC9, 0x1D, 0x4D, 0x19, 0xCA, 0x1A,
+    0xC9, 0x1D, 0x4D, 0x1A, 0xCA, 0x1D, 0x19, 0xD3, 0x9C, 0xA1, 0xAC, 0x91, 0xD1, 0x9C, 0xA3, 0x9C,
+    0xA1, 0xD1, 0x9C, 0xA1, 0xAC, 0x93, 0xAC, 0x91, 0xD1, 0xAC, 0x91, 0xD4, 0xD1, 0x9C, 0xA1, 0xD2,
+    0xD4, 0xD1, 0xAC, 0x91, 0xD1, 0x9C, 0xA3, 0x9C, 0xA1, 0xD2, 0x99, 0x1A, 0xC9, 0x3A, 0xC9, 0x1D,
+    0x6D, 0x4D, 0x91, 0xD4, 0x9D, 0x94, 0xD1, 0x9D, 0xAA, 0xAA, 0xEA, 0x5D, 0x1A, 0xFE, 0xA9, 0x50,
+    0x73, 0x9D, 0x75, 0xAC, 0xA7, 0x1F, 0xF7, 0x9F, 0xF7, 0x4D, 0x70, 0xAA, 0xA1, 0x9D, 0x6A, 0xFC,
+    0x9A, 0xCA, 0x5A, 0xDA, 0x1A, 0xE9, 0x49, 0xD9, 0x3E, 0x5D, 0xA4, 0xAD, 0x5D, 0x5A, 0xCA, 0x49,
+    0xD5, 0xAC, 0x94, 0xAC, 0xA5, 0xD9, 0x4A, 0xCA, 0x49, 0xD5, 0xD9, 0x4E, 0x5A, 0xCA, 0x39, 0xDA,
+    0x5A, 0xD2, 0x9E, 0x96, 0xEA, 0xD9, 0xAC, 0x79, 0xF9, 0x0D, 0x77, 0x77, 0x79, 0xFF, 0xC9, 0x5A,
+    0xFF, 0xC6, 0x77, 0x79, 0xFC, 0x97, 0xFF, 0x6E, 0x92, 0x99, 0x5A, 0xD7, 0x39, 0xD7, 0x4D, 0xA7,
+    0x29, 0x9D, 0xA9, 0x99, 0x95, 0x9F, 0xFC, 0x69, 0xDA, 0x99, 0x99, 0x70, 0xD7, 0x3F, 0xF9, 0x6F,
+    0xF9, 0x70, 0xD7, 0x5D, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4F, 0xAD, 0xA7, 0x0A, 0xFC, 0x97, 0x73,
+    0x4D, 0x5A, 0xCA, 0x49, 0xCA, 0x4A, 0xD5, 0xAC, 0xA3, 0xAD, 0x6D, 0x92, 0xAD, 0x7D, 0x2A, 0xD7,
+    0x9D, 0x1A, 0xD7, 0x0A, 0xCA, 0x0A, 0xD7, 0x1D, 0x9A, 0xD7, 0x0F, 0xFF, 0x4A, 0xAF, 0xEA, 0xAA,
+    0x59, 0xD9, 0x0A, 0xCA, 0x70, 0xAC, 0xA1, 0x9D, 0x70, 0xD9, 0x2D, 0x97, 0xD3, 0xAD, 0x7D, 0x4D,
+    0x95, 0x9D, 0x4A, 0xCA, 0x5A, 0xCA, 0x49, 0xD5, 0xD9, 0x5D, 0xA3, 0x09, 0xFF, 0xEA, 0x0A, 0xFF,
+    0xE9, 0x5D, 0x97, 0x2D, 0x72, 0x9D, 0x1A, 0x7A, 0xCA, 0xAD, 0x7F, 0xA7, 0x0E, 0x97, 0x9E, 0x70,
+    0xFC, 0x0A, 0xC4, 0xD9, 0xAF, 0x97, 0xEA, 0x70, 0xAD, 0x97, 0x9F, 0x7A, 0xDA, 0xD7, 0x99, 0x0A,
+    0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x00, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x76, 0xFF, 0xD7, 0x59, 0x94,
+    0x9E, 0x77, 0x99, 0x3E, 0x76, 0xD4, 0xD9, 0x75, 0xD4, 0xAC, 0xA7, 0x49, 0xCA, 0x49, 0xD7, 0x4A,
+    0xCA, 0x49, 0xD7, 0x4D, 0x94, 0x9D, 0x74, 0xD5, 0x9D, 0x49, 0x59, 0xD5, 0xAC, 0xA1, 0x9F, 0xC3,
+    0x9C, 0xA5, 0xD9, 0x1D, 0xA9, 0xE2, 0xAC, 0x94, 0xAD, 0x1D, 0xA2, 0xD9, 0x1D, 0x94, 0xD9, 0x1D,
+    0x3D, 0x91, 0xD3, 0x9D, 0xA1, 0x9D, 0x3D, 0x19, 0xD1, 0x9A, 0xE2, 0xAC, 0xA2, 0xAD, 0x1A, 0xFE,
+    0xA3, 0xEA, 0xAE, 0x91, 0xAF, 0xA9, 0x5D, 0xAF, 0x97, 0x7D, 0x77, 0x49, 0xCA, 0x77, 0x4A, 0xC9,
+    0x77, 0x4D, 0x97, 0x74, 0xD7, 0x74, 0x9D, 0x70, 0x77, 0x71, 0x9E, 0xA7, 0x2D, 0xAD, 0xA7, 0x0A,
+    0xC9, 0x1D, 0x70, 0xD2, 0xCA, 0x70, 0xD1, 0x9C, 0xA7, 0x0C, 0xA1, 0xAC, 0x71, 0xCA, 0x1C, 0xA7,
+    0x1D, 0x0D, 0x72, 0xD9, 0xCA, 0x72, 0xF7, 0x3A, 0xD7, 0x4A, 0xCA, 0x70, 0xC1, 0x9D, 0xA7, 0xD1,
+    0xF6, 0xAD, 0xAD, 0x0D, 0x59, 0xCA, 0xAD, 0x90, 0xD5, 0xD0, 0x9C, 0xA1, 0xAC, 0x93, 0xAC, 0x91,
+    0xC2, 0xAC, 0x97, 0x4A, 0xC9, 0x74, 0xAC, 0x97, 0x4D, 0x97, 0x39, 0xD7, 0x19, 0xF9, 0x71, 0x9E,
+    0x94, 0x39, 0xFC, 0xA7, 0x0A, 0xFE, 0x96, 0xD9, 0x2A, 0xD4, 0x99, 0xD9, 0x99, 0x99, 0xD9, 0x92,
+    0xFF, 0xFC, 0x39, 0xCA, 0x4D, 0x5A, 0xCA, 0x4D, 0x3A, 0xAE, 0xAA, 0xAA, 0xEA, 0x2A, 0xAD, 0xAA,
+    0xAA, 0xAD, 0xAA, 0x39, 0xD3, 0xDA, 0x5A, 0xDA, 0xAF, 0x6A, 0xFD, 0x97, 0xD9, 0x74, 0xD7, 0x49,
+    0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x40, 0x71, 0xC9, 0x72, 0xAF, 0xD9, 0x5A, 0xFF, 0xC9,
+    0x3E, 0xA0, 0xD1, 0x9A, 0x3A, 0xD9, 0x1C, 0xA6, 0x9D, 0x91, 0x9C, 0x96, 0xDA, 0x29, 0xC6, 0x9D,
+    0x3A, 0xC6, 0xAD, 0x3C, 0xA6, 0xD9, 0x3C, 0xA9, 0x99, 0x99, 0x1D, 0x92, 0x9F, 0xD9, 0x1D, 0x3A,
+    0xCA, 0xAA, 0xD9, 0x1D, 0x3D, 0x2D, 0x2D, 0x92, 0xCA, 0x19, 0xD2, 0xDA, 0x2C, 0x91, 0xAC, 0xA2,
+    0xAD, 0x19, 0xC2, 0xD9, 0x3E, 0x0A, 0xC2, 0xD4, 0x9F, 0xCA, 0xF6, 0xAF, 0xDA, 0x97, 0x9C, 0xA7,
+    0x49, 0xC7, 0x00, 0x71, 0xDA, 0x74, 0x9E, 0x74, 0xF7, 0x3A, 0xCA, 0xD7, 0x3D, 0x0D, 0x72, 0xAC,
+    0xA0, 0xD9, 0x70, 0x9D, 0x90, 0xAC, 0xA5, 0xFF, 0xFD, 0x29, 0x9A, 0xD9, 0x99, 0xAD, 0x99, 0x94,
+    0xDA, 0x29, 0xD4, 0x9A, 0xAD, 0xAA, 0xAA, 0xAD, 0xAA, 0x2F, 0xFF, 0xD3, 0x9D, 0x5D, 0x5D, 0x95,
+    0xD9, 0x3A, 0xD6, 0xAC, 0x93, 0xD9, 0x6A, 0xCA, 0x2A, 0xD7, 0xAC, 0xA2, 0xD9, 0x79, 0xD1, 0x77,
+    0x39, 0xAF, 0xA7, 0xFF, 0x69, 0x93, 0xE7, 0x39, 0xD7, 0x4D, 0x73, 0x9D, 0x2A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xEA, 0x09, 0xFF, 0xFA, 0x5A, 0xF9, 0x6A, 0xF9, 0x5F, 0xFF, 0xC1, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x91, 0x9D, 0x73, 0xAD, 0x73, 0x9D, 0x73, 0x9D, 0xA4, 0x95, 0xAE, 0xAA, 0xE6, 0xAF, 0xDA,
+    0x77, 0x20, 0x71, 0xC9, 0x71, 0xAF, 0xCA, 0x5A, 0xFF, 0xA3, 0xEA, 0x0D, 0x1A, 0x3A, 0xD2, 0xCA,
+    0x59, 0xD9, 0x2C, 0x95, 0xDA, 0x29, 0xC5, 0x9D, 0x3A, 0xC5, 0xAD, 0x3C, 0xA5, 0xDA, 0x3C, 0xA5,
+    0xD9, 0x29, 0xC9, 0x5D, 0x3A, 0xC6, 0xD3, 0xAC, 0x6D, 0x92, 0xCA, 0x6D, 0xA2, 0xC9, 0x6A, 0xD1,
+    0x9C, 0x97, 0xE0, 0xAC, 0x70, 0x9F, 0xFA, 0x59, 0xFE, 0x97, 0x9C, 0xA7, 0x39, 0xC7, 0x49, 0x49,
+    0x79, 0xC3, 0xAC, 0x7D, 0x3D, 0x6A, 0xD9, 0x99, 0xAD, 0x99, 0x91, 0xAF, 0xFF, 0xC2, 0x9D, 0xA9,
+    0x99, 0xD9, 0x99, 0x4D, 0x3D, 0x69, 0xD2, 0x9D, 0x6A, 0xCA, 0x2A, 0xCA, 0x6A, 0xCA, 0x2D, 0x96,
+    0xD9, 0x2D, 0x7D, 0x3D, 0x69, 0xD2, 0x9D, 0x6A, 0xCA, 0x2A, 0xCA, 0x6D, 0x92, 0xAC, 0xA6, 0xD3,
+    0x9D, 0xAA, 0xA3, 0xD4, 0xAE, 0xA7, 0x72, 0x77, 0x73, 0xAF, 0xCA, 0x71, 0xFF, 0xA7, 0xE9, 0x29,
+    0xA7, 0x9D, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0x9D, 0x97, 0x6E, 0xA7, 0x6F, 0x76, 0xAE, 0x97, 0x6E,
+    0x97, 0x6E, 0x29, 0xCA, 0x0A, 0xA9, 0x0A, 0xA1, 0x9D, 0x2C, 0xAC, 0xA9, 0xAC, 0xA9, 0xAC, 0x09,
+    0xD2, 0xC9, 0xC9, 0x09, 0xC9, 0x09, 0xC0, 0xAC, 0xA2, 0xE1, 0x9C, 0x1A, 0xA9, 0xD3, 0x9D, 0xA9,
+    0xCA, 0x1F, 0x94, 0xCA, 0xFF, 0xA6, 0xC2, 0xC9, 0x09, 0xC7, 0x0C, 0x19, 0xC1, 0x9C, 0x60, 0x09,
+    0xFF, 0xE1, 0xAF, 0xFE, 0x77, 0x75, 0xFF, 0xE9, 0x09, 0xFF, 0xE6, 0xD9, 0x72, 0xD7, 0x29, 0xD7,
+    0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7,
+    0x29, 0xD7, 0x00, 0x1A, 0xFF, 0xC9, 0x1A, 0xFF, 0xC5, 0x9D, 0x72, 0xAC, 0xA4, 0x9A, 0xAA, 0xAE,
+    0xAA, 0x91, 0xFF, 0xD9, 0x6D, 0xA7, 0x0A, 0xD5, 0x99, 0xAE, 0x94, 0xAF, 0xA6, 0x9D, 0x72, 0xD9,
+    0x71, 0xAC, 0xA7, 0x2D, 0x72, 0xAC, 0xA7, 0x2D, 0x72, 0xDA, 0x71, 0x9D, 0x60, 0x4D, 0x72, 0x9D,
+    0x72, 0xAC, 0xA2, 0x9A, 0x5D, 0xA9, 0xAD, 0xA5, 0xFC, 0x94, 0x9F, 0x97, 0xCA, 0xAD, 0x19, 0xAC,
+    0x5A, 0xDA, 0xE9, 0x49, 0xF9, 0x59, 0xF7, 0x09, 0x99, 0xD5, 0xAC, 0x91, 0x9D, 0x5D, 0x2A, 0xCA,
+    0x49, 0xD2, 0xD9, 0x4D, 0x92, 0xD4, 0xE2, 0x9D, 0x29, 0xE3, 0xAF, 0xEA, 0x4A, 0xFC, 0xA9, 0x77,
+    0x20, 0x77, 0x1E, 0x97, 0x2D, 0x9D, 0x71, 0x9C, 0x19, 0xC9, 0x70, 0xAC, 0x19, 0xC9, 0x70, 0x9C,
+    0xA9, 0xAC, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0xC9, 0x29, 0xAD, 0xAA, 0xAA, 0xAA, 0xAD, 0x4C, 0xA7,
+    0xCA, 0x29, 0xC9, 0x7A, 0xA2, 0xAC, 0x1C, 0x1A, 0x2A, 0xA2, 0xD9, 0xDA, 0xE1, 0xCA, 0x2E, 0x9A,
+    0xD9, 0xCA, 0xAC, 0x3D, 0x2A, 0x19, 0xD9, 0x2E, 0x73, 0xCA, 0xD7, 0x39, 0x0A, 0xCA, 0x75, 0xEA,
+    0xAD, 0x70, 0x9F, 0xCA, 0x77, 0x40, 0x72, 0x9C, 0xA7, 0x7D, 0x97, 0x7D, 0x97, 0x7D, 0x77, 0x9D,
+    0x75, 0x99, 0xE9, 0x71, 0x9F, 0xFD, 0x95, 0xAE, 0xAA, 0xDA, 0xAE, 0x93, 0xAD, 0x91, 0x9D, 0x2A,
+    0xD3, 0xD9, 0x29, 0xD3, 0xD2, 0x9D, 0x3A, 0xCA, 0x3D, 0x2D, 0xA3, 0xD9, 0x3D, 0x2D, 0x93, 0xD3,
+    0x9D, 0x2D, 0x4D, 0x3A, 0xD1, 0x9D, 0x72, 0xAC, 0xA1, 0xAC, 0xA7, 0x2D, 0x91, 0xD9, 0x72, 0xD2,
+    0xD9, 0x71, 0x9D, 0x10, 0x5F, 0xDA, 0x96, 0x9F, 0xFC, 0x5A, 0xCA, 0x3A, 0xDA, 0x4D, 0x94, 0xAD,
+    0x4D, 0x59, 0xD3, 0x9D, 0x59, 0xD3, 0xAC, 0xA5, 0xAC, 0xA3, 0xD9, 0x49, 0xD4, 0xD9, 0x19, 0x9E,
+    0x91, 0x9F, 0xFE, 0x92, 0x9F, 0xDA, 0xAA, 0x7A, 0xCA, 0x74, 0xD9, 0x72, 0xFF, 0x96, 0xAA, 0xDA,
+    0xAA, 0xA7, 0x09, 0xD7, 0x4A, 0xCA, 0x74, 0xD9, 0x72, 0x72, 0x91, 0x97, 0x3C, 0xA0, 0x9C, 0x73,
+    0xCA, 0x09, 0xC7, 0x2A, 0xFC, 0x97, 0xAF, 0xFA, 0x5F, 0xC1, 0xCA, 0xA9, 0x4E, 0x0C, 0xA0, 0x9C,
+    0x6A, 0xD1, 0xC9, 0x0A, 0xC6, 0xD9, 0x1C, 0x90, 0xAC, 0x5A, 0xD1, 0x9C, 0x1C, 0xA5, 0xD9, 0x19,
+    0xA1, 0xA6, 0xD9, 0x75, 0xD7, 0x6D, 0x76, 0xD7, 0x6D, 0x97, 0x59, 0xD7, 0x6D, 0xA7, 0x6A, 0xD9,
+    0x70, 0xFF, 0xFC, 0x3F, 0xFF, 0xA2, 0x69, 0x19, 0x7A, 0xC0, 0x9C, 0x7C, 0xA0, 0xAC, 0x5F, 0xDA,
+    0x49, 0xFE, 0xA3, 0xAC, 0xA2, 0xAD, 0x92, 0xD9, 0x3D, 0xA2, 0xD4, 0xAC, 0xA1, 0x9D, 0x4A, 0xCA,
+    0x1A, 0xCA, 0x39, 0xD2, 0xDA, 0x99, 0x9A, 0xD9, 0x2F, 0xEA, 0x4D, 0xAA, 0xAE, 0x92, 0x9D, 0x39,
+    0xD2, 0xAC, 0xA4, 0xD9, 0x1D, 0x94, 0xDA, 0x1D, 0x5D, 0x91, 0xD4, 0x9D, 0x19, 0xD3, 0x9D, 0xA1,
+    0xAF, 0xFA, 0x2F, 0xEA, 0x95, 0xCA, 0x0A, 0xC7, 0xC9, 0x0C, 0xA7, 0x91, 0x96, 0x0A, 0xAA, 0xAA,
+    0xA0, 0xFC, 0xA0, 0x99, 0x99, 0x90, 0x72, 0xC7, 0x74, 0xE7, 0x72, 0xFC, 0x77, 0x0F, 0xE7, 0x6F,
+    0xFC, 0x74, 0xD9, 0x4A, 0xD7, 0x2D, 0xA6, 0xAD, 0x70, 0xF0, 0x9A, 0xC9, 0x19, 0xE6, 0xFF, 0xD1,
+    0x9F, 0x4F, 0xFD, 0xA1, 0x9F, 0xC2, 0xFF, 0xDA, 0x2F, 0xE0, 0xAF, 0xFC, 0xA2, 0xFF, 0xA0, 0xFF,
+    0xC2, 0xFF, 0xC2, 0xFE, 0xA1, 0xAF, 0xF4, 0xFE, 0x99, 0xFF, 0x6F, 0xFF, 0xE7, 0x0F, 0xC9, 0x9F,
+    0xD7, 0x2E, 0x91, 0x9F, 0x74, 0xD9, 0x19, 0xE7, 0x6D, 0xAA, 0xE7, 0x70, 0xFC, 0x77, 0x2E, 0x77,
+    0x4A, 0x72,
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 7, 19, 8, 0, 18, 34, 0 }, // !
-    { 9, 7, 12, 2, 18, 16, 34 }, // "
-    { 17, 18, 18, 0, 18, 77, 50 }, // #
-    { 14, 21, 15, 0, 19, 74, 127 }, // $
-    { 17, 20, 20, 2, 19, 85, 201 }, // %
-    { 17, 20, 18, 0, 19, 85, 286 }, // &
-    { 4, 7, 7, 2, 18, 7, 371 }, // '
-    { 9, 22, 11, 1, 18, 50, 378 }, // (
-    { 9, 22, 8, -2, 18, 50, 428 }, // )
-    { 13, 13, 16, 2, 20, 43, 478 }, // *
-    { 13, 13, 15, 1, 15, 43, 521 }, // +
-    { 6, 7, 6, -2, 3, 11, 564 }, // ,
-    { 7, 3, 8, 0, 8, 6, 575 }, // -
-    { 4, 5, 6, 0, 4, 5, 581 }, // .
-    { 14, 18, 13, -2, 18, 63, 586 }, // /
-    { 13, 20, 15, 1, 19, 65, 649 }, // 0
-    { 9, 18, 14, 3, 18, 41, 714 }, // 1
-    { 14, 19, 15, 0, 19, 67, 755 }, // 2
-    { 14, 20, 15, 0, 19, 70, 822 }, // 3
-    { 14, 18, 15, 0, 18, 63, 892 }, // 4
-    { 14, 19, 15, 0, 18, 67, 955 }, // 5
-    { 13, 20, 15, 1, 19, 65, 1022 }, // 6
-    { 13, 18, 16, 2, 18, 59, 1087 }, // 7
-    { 13, 20, 15, 1, 19, 65, 1146 }, // 8
-    { 13, 20, 15, 1, 19, 65, 1211 }, // 9
-    { 6, 15, 7, 0, 14, 23, 1276 }, // :
-    { 8, 18, 7, -2, 14, 36, 1299 }, // ;
-    { 13, 14, 15, 1, 16, 46, 1335 }, // <
-    { 13, 8, 15, 1, 13, 26, 1381 }, // =
-    { 13, 14, 15, 1, 16, 46, 1407 }, // >
-    { 11, 20, 13, 1, 19, 55, 1453 }, // ?
-    { 20, 21, 22, 1, 18, 105, 1508 }, // @
-    { 15, 18, 14, -2, 18, 68, 1613 }, // A
-    { 14, 18, 16, 1, 18, 63, 1681 }, // B
-    { 15, 20, 17, 1, 19, 75, 1744 }, // C
-    { 15, 18, 17, 1, 18, 68, 1819 }, // D
-    { 13, 18, 15, 1, 18, 59, 1887 }, // E
-    { 13, 18, 15, 1, 18, 59, 1946 }, // F
-    { 16, 20, 18, 1, 19, 80, 2005 }, // G
-    { 17, 18, 19, 1, 18, 77, 2085 }, // H
-    { 11, 18, 11, -1, 18, 50, 2162 }, // I
-    { 12, 23, 9, -4, 18, 69, 2212 }, // J
-    { 16, 18, 18, 1, 18, 72, 2281 }, // K
-    { 10, 18, 12, 1, 18, 45, 2353 }, // L
-    { 21, 18, 23, 1, 18, 95, 2398 }, // M
-    { 17, 18, 19, 1, 18, 77, 2493 }, // N
-    { 17, 20, 19, 1, 19, 85, 2570 }, // O
-    { 14, 18, 16, 1, 18, 63, 2655 }, // P
-    { 17, 24, 19, 1, 19, 102, 2718 }, // Q
-    { 14, 18, 16, 1, 18, 63, 2820 }, // R
-    { 13, 20, 14, 0, 19, 65, 2883 }, // S
-    { 13, 18, 16, 2, 18, 59, 2948 }, // T
-    { 17, 19, 19, 1, 18, 81, 3007 }, // U
-    { 15, 18, 18, 2, 18, 68, 3088 }, // V
-    { 22, 18, 25, 2, 18, 99, 3156 }, // W
-    { 18, 18, 17, -2, 18, 81, 3255 }, // X
-    { 14, 18, 17, 2, 18, 63, 3336 }, // Y
-    { 16, 18, 16, -1, 18, 72, 3399 }, // Z
-    { 11, 22, 11, -1, 18, 61, 3471 }, // [
-    { 6, 18, 9, 2, 18, 27, 3532 }, // <backslash>
-    { 10, 22, 9, -2, 18, 55, 3559 }, // ]
-    { 14, 12, 15, 0, 18, 42, 3614 }, // ^
-    { 11, 2, 10, -3, -2, 6, 3656 }, // _
-    { 5, 5, 9, 3, 20, 7, 3662 }, // `
-    { 13, 15, 15, 1, 14, 49, 3669 }, // a
-    { 14, 20, 15, 0, 19, 70, 3718 }, // b
-    { 11, 15, 13, 1, 14, 42, 3788 }, // c
-    { 14, 20, 16, 1, 19, 70, 3830 }, // d
-    { 11, 15, 13, 1, 14, 42, 3900 }, // e
-    { 15, 26, 13, -3, 20, 98, 3942 }, // f
-    { 14, 20, 15, 0, 14, 70, 4040 }, // g
-    { 14, 19, 15, 0, 19, 67, 4110 }, // h
-    { 7, 19, 8, 0, 19, 34, 4177 }, // i
-    { 11, 25, 8, -4, 19, 69, 4211 }, // j
-    { 14, 19, 15, 0, 19, 67, 4280 }, // k
-    { 7, 19, 8, 0, 19, 34, 4347 }, // l
-    { 21, 14, 22, 0, 14, 74, 4381 }, // m
-    { 14, 14, 15, 0, 14, 49, 4455 }, // n
-    { 12, 15, 14, 1, 14, 45, 4504 }, // o
-    { 15, 20, 15, -1, 14, 75, 4549 }, // p
-    { 13, 20, 15, 1, 14, 65, 4624 }, // q
-    { 11, 14, 12, 0, 14, 39, 4689 }, // r
-    { 11, 15, 12, 0, 14, 42, 4728 }, // s
-    { 9, 18, 11, 1, 17, 41, 4770 }, // t
-    { 13, 15, 15, 1, 14, 49, 4811 }, // u
-    { 12, 14, 14, 1, 14, 42, 4860 }, // v
-    { 19, 14, 21, 1, 14, 67, 4902 }, // w
-    { 14, 14, 14, -1, 14, 49, 4969 }, // x
-    { 16, 20, 14, -3, 14, 80, 5018 }, // y
-    { 12, 14, 12, -1, 14, 42, 5098 }, // z
-    { 10, 22, 11, 0, 18, 55, 5140 }, // {
-    { 3, 26, 14, 6, 19, 20, 5195 }, // |
-    { 10, 22, 10, -1, 18, 55, 5215 }, // }
-    { 13, 4, 15, 1, 11, 13, 5270 }, // ~
-    { 0, 0, 7, 0, 0, 0, 5283 }, //  
-    { 8, 19, 8, -1, 14, 38, 5283 }, // ¡
-    { 12, 20, 15, 2, 19, 60, 5321 }, // ¢
-    { 16, 19, 16, -1, 19, 76, 5381 }, // £
-    { 11, 12, 14, 2, 15, 33, 5457 }, // ¤
-    { 15, 18, 17, 1, 18, 68, 5490 }, // ¥
-    { 3, 26, 14, 6, 19, 20, 5558 }, // ¦
-    { 13, 21, 14, 0, 20, 69, 5578 }, // §
-    { 8, 4, 14, 5, 19, 8, 5647 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5655 }, // ©
-    { 8, 10, 11, 2, 19, 20, 5750 }, // ª
-    { 11, 11, 13, 1, 12, 31, 5770 }, // «
-    { 13, 7, 15, 1, 10, 23, 5801 }, // ¬
-    { 7, 3, 8, 0, 8, 6, 5824 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5830 }, // ®
-    { 11, 2, 14, 2, 21, 6, 5925 }, // ¯
-    { 9, 9, 11, 1, 19, 21, 5931 }, // °
-    { 13, 15, 15, 1, 15, 49, 5952 }, // ±
-    { 9, 12, 11, 1, 22, 27, 6001 }, // ²
-    { 8, 12, 11, 2, 22, 24, 6028 }, // ³
-    { 7, 5, 10, 2, 20, 9, 6052 }, // ´
-    { 15, 20, 15, -1, 14, 75, 6061 }, // µ
-    { 13, 23, 16, 2, 19, 75, 6136 }, // ¶
-    { 4, 5, 7, 2, 11, 5, 6211 }, // ·
-    { 6, 6, 5, -3, 0, 9, 6216 }, // ¸
-    { 6, 12, 10, 3, 22, 18, 6225 }, // ¹
-    { 8, 10, 11, 2, 19, 20, 6243 }, // º
-    { 11, 11, 12, 0, 12, 31, 6263 }, // »
-    { 16, 19, 19, 2, 19, 76, 6294 }, // ¼
-    { 18, 19, 21, 2, 19, 86, 6370 }, // ½
-    { 18, 19, 20, 1, 19, 86, 6456 }, // ¾
-    { 10, 19, 11, -1, 14, 48, 6542 }, // ¿
-    { 15, 24, 14, -2, 24, 90, 6590 }, // À
-    { 16, 24, 15, -2, 24, 96, 6680 }, // Á
-    { 16, 24, 15, -2, 24, 96, 6776 }, // Â
-    { 17, 23, 16, -2, 23, 98, 6872 }, // Ã
-    { 16, 23, 15, -2, 23, 92, 6970 }, // Ä
-    { 15, 25, 14, -2, 25, 94, 7062 }, // Å
-    { 24, 18, 23, -2, 18, 108, 7156 }, // Æ
-    { 15, 25, 17, 1, 19, 94, 7264 }, // Ç
-    { 13, 24, 15, 1, 24, 78, 7358 }, // È
-    { 13, 24, 15, 1, 24, 78, 7436 }, // É
-    { 13, 24, 15, 1, 24, 78, 7514 }, // Ê
-    { 13, 23, 15, 1, 23, 75, 7592 }, // Ë
-    { 11, 24, 11, -1, 24, 66, 7667 }, // Ì
-    { 12, 24, 12, -1, 24, 72, 7733 }, // Í
-    { 12, 24, 12, -1, 24, 72, 7805 }, // Î
-    { 12, 23, 12, -1, 23, 69, 7877 }, // Ï
-    { 16, 18, 17, 0, 18, 72, 7946 }, // Ð
-    { 17, 23, 19, 1, 23, 98, 8018 }, // Ñ
-    { 17, 25, 19, 1, 24, 107, 8116 }, // Ò
-    { 17, 25, 19, 1, 24, 107, 8223 }, // Ó
-    { 17, 25, 19, 1, 24, 107, 8330 }, // Ô
-    { 17, 24, 19, 1, 23, 102, 8437 }, // Õ
-    { 17, 24, 19, 1, 23, 102, 8539 }, // Ö
-    { 12, 12, 15, 2, 15, 36, 8641 }, // ×
-    { 17, 21, 19, 1, 19, 90, 8677 }, // Ø
-    { 17, 25, 19, 1, 24, 107, 8767 }, // Ù
-    { 17, 25, 19, 1, 24, 107, 8874 }, // Ú
-    { 17, 25, 19, 1, 24, 107, 8981 }, // Û
-    { 17, 24, 19, 1, 23, 102, 9088 }, // Ü
-    { 14, 24, 17, 2, 24, 84, 9190 }, // Ý
-    { 13, 18, 15, 1, 18, 59, 9274 }, // Þ
-    { 18, 26, 15, -4, 20, 117, 9333 }, // ß
-    { 13, 21, 15, 1, 20, 69, 9450 }, // à
-    { 13, 21, 15, 1, 20, 69, 9519 }, // á
-    { 13, 21, 15, 1, 20, 69, 9588 }, // â
-    { 13, 20, 15, 1, 19, 65, 9657 }, // ã
-    { 13, 20, 15, 1, 19, 65, 9722 }, // ä
-    { 13, 22, 15, 1, 21, 72, 9787 }, // å
-    { 19, 15, 21, 1, 14, 72, 9859 }, // æ
-    { 11, 20, 13, 1, 14, 55, 9931 }, // ç
-    { 11, 21, 13, 1, 20, 58, 9986 }, // è
-    { 12, 21, 14, 1, 20, 63, 10044 }, // é
-    { 11, 21, 13, 1, 20, 58, 10107 }, // ê
-    { 11, 20, 13, 1, 19, 55, 10165 }, // ë
-    { 7, 20, 8, 0, 20, 35, 10220 }, // ì
-    { 9, 20, 10, 0, 20, 45, 10255 }, // í
-    { 9, 20, 10, 0, 20, 45, 10300 }, // î
-    { 9, 19, 10, 0, 19, 43, 10345 }, // ï
-    { 13, 21, 15, 1, 20, 69, 10388 }, // ð
-    { 14, 19, 15, 0, 19, 67, 10457 }, // ñ
-    { 12, 21, 14, 1, 20, 63, 10524 }, // ò
-    { 12, 21, 14, 1, 20, 63, 10587 }, // ó
-    { 12, 21, 14, 1, 20, 63, 10650 }, // ô
-    { 13, 20, 15, 1, 19, 65, 10713 }, // õ
-    { 12, 20, 14, 1, 19, 60, 10778 }, // ö
-    { 13, 12, 15, 1, 15, 39, 10838 }, // ÷
-    { 14, 16, 15, 0, 15, 56, 10877 }, // ø
-    { 13, 21, 15, 1, 20, 69, 10933 }, // ù
-    { 13, 21, 15, 1, 20, 69, 11002 }, // ú
-    { 13, 21, 15, 1, 20, 69, 11071 }, // û
-    { 13, 20, 15, 1, 19, 65, 11140 }, // ü
-    { 16, 26, 14, -3, 20, 104, 11205 }, // ý
-    { 15, 25, 15, -1, 19, 94, 11309 }, // þ
-    { 16, 25, 14, -3, 19, 100, 11403 }, // ÿ
-    { 16, 21, 15, -2, 21, 84, 11503 }, // Ā
-    { 13, 18, 15, 1, 17, 59, 11587 }, // ā
-    { 16, 23, 15, -2, 23, 92, 11646 }, // Ă
-    { 13, 20, 15, 1, 19, 65, 11738 }, // ă
-    { 15, 24, 14, -2, 18, 90, 11803 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 11893 }, // ą
-    { 15, 25, 17, 1, 24, 94, 11958 }, // Ć
-    { 11, 21, 13, 1, 20, 58, 12052 }, // ć
-    { 15, 25, 17, 1, 24, 94, 12110 }, // Ĉ
-    { 11, 21, 13, 1, 20, 58, 12204 }, // ĉ
-    { 15, 24, 17, 1, 23, 90, 12262 }, // Ċ
-    { 11, 20, 13, 1, 19, 55, 12352 }, // ċ
-    { 15, 25, 17, 1, 24, 94, 12407 }, // Č
-    { 12, 21, 14, 1, 20, 63, 12501 }, // č
-    { 15, 24, 17, 1, 24, 90, 12564 }, // Ď
-    { 19, 20, 21, 1, 19, 95, 12654 }, // ď
-    { 16, 18, 17, 0, 18, 72, 12749 }, // Đ
-    { 16, 20, 18, 1, 19, 80, 12821 }, // đ
-    { 13, 21, 15, 1, 21, 69, 12901 }, // Ē
-    { 11, 18, 13, 1, 17, 50, 12970 }, // ē
-    { 13, 23, 15, 1, 23, 75, 13020 }, // Ĕ
-    { 12, 20, 14, 1, 19, 60, 13095 }, // ĕ
-    { 13, 23, 15, 1, 23, 75, 13155 }, // Ė
-    { 11, 20, 13, 1, 19, 55, 13230 }, // ė
-    { 13, 24, 15, 1, 18, 78, 13285 }, // Ę
-    { 11, 20, 13, 1, 14, 55, 13363 }, // ę
-    { 14, 24, 16, 1, 24, 84, 13418 }, // Ě
-    { 12, 21, 14, 1, 20, 63, 13502 }, // ě
-    { 16, 25, 18, 1, 24, 100, 13565 }, // Ĝ
-    { 14, 26, 15, 0, 20, 91, 13665 }, // ĝ
-    { 16, 24, 18, 1, 23, 96, 13756 }, // Ğ
-    { 14, 25, 15, 0, 19, 88, 13852 }, // ğ
-    { 16, 24, 18, 1, 23, 96, 13940 }, // Ġ
-    { 14, 25, 15, 0, 19, 88, 14036 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 14124 }, // Ģ
-    { 14, 26, 15, 0, 20, 91, 14224 }, // ģ
-    { 17, 24, 19, 1, 24, 102, 14315 }, // Ĥ
-    { 14, 26, 15, 0, 26, 91, 14417 }, // ĥ
-    { 18, 18, 20, 1, 18, 81, 14508 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 14589 }, // ħ
-    { 13, 23, 13, -1, 23, 75, 14656 }, // Ĩ
-    { 10, 19, 11, 0, 19, 48, 14731 }, // ĩ
-    { 12, 21, 12, -1, 21, 63, 14779 }, // Ī
-    { 9, 17, 10, 0, 17, 39, 14842 }, // ī
-    { 12, 23, 12, -1, 23, 69, 14881 }, // Ĭ
-    { 10, 19, 11, 0, 19, 48, 14950 }, // ĭ
-    { 11, 24, 11, -1, 18, 66, 14998 }, // Į
-    { 8, 25, 8, -1, 19, 50, 15064 }, // į
-    { 11, 23, 11, -1, 23, 64, 15114 }, // İ
-    { 6, 14, 7, 0, 14, 21, 15178 }, // ı
-    { 17, 23, 17, -1, 18, 98, 15199 }, // Ĳ
-    { 14, 25, 15, 0, 19, 88, 15297 }, // ĳ
-    { 14, 29, 11, -4, 24, 102, 15385 }, // Ĵ
-    { 13, 26, 10, -4, 20, 85, 15487 }, // ĵ
-    { 16, 24, 18, 1, 18, 96, 15572 }, // Ķ
-    { 14, 25, 15, 0, 19, 88, 15668 }, // ķ
-    { 14, 14, 15, 0, 14, 49, 15756 }, // ĸ
-    { 10, 24, 12, 1, 24, 60, 15805 }, // Ĺ
-    { 11, 26, 12, 0, 26, 72, 15865 }, // ĺ
-    { 10, 24, 12, 1, 18, 60, 15937 }, // Ļ
-    { 8, 25, 8, -1, 19, 50, 15997 }, // ļ
-    { 12, 18, 14, 1, 18, 54, 16047 }, // Ľ
-    { 11, 19, 12, 0, 19, 53, 16101 }, // ľ
-    { 10, 18, 12, 1, 18, 45, 16154 }, // Ŀ
-    { 9, 19, 10, 0, 19, 43, 16199 }, // ŀ
-    { 11, 18, 12, 0, 18, 50, 16242 }, // Ł
-    { 8, 19, 9, 0, 19, 38, 16292 }, // ł
-    { 17, 24, 19, 1, 24, 102, 16330 }, // Ń
-    { 14, 20, 15, 0, 20, 70, 16432 }, // ń
-    { 17, 24, 19, 1, 18, 102, 16502 }, // Ņ
-    { 14, 20, 15, 0, 14, 70, 16604 }, // ņ
-    { 17, 24, 19, 1, 24, 102, 16674 }, // Ň
-    { 14, 20, 15, 0, 20, 70, 16776 }, // ň
-    { 15, 18, 17, 1, 18, 68, 16846 }, // ŉ
-    { 17, 23, 19, 1, 18, 98, 16914 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 17012 }, // ŋ
-    { 17, 22, 19, 1, 21, 94, 17082 }, // Ō
-    { 12, 18, 14, 1, 17, 54, 17176 }, // ō
-    { 17, 24, 19, 1, 23, 102, 17230 }, // Ŏ
-    { 12, 20, 14, 1, 19, 60, 17332 }, // ŏ
-    { 18, 25, 20, 1, 24, 113, 17392 }, // Ő
-    { 14, 21, 16, 1, 20, 74, 17505 }, // ő
-    { 22, 20, 24, 1, 19, 110, 17579 }, // Œ
-    { 20, 15, 22, 1, 14, 75, 17689 }, // œ
-    { 14, 24, 16, 1, 24, 84, 17764 }, // Ŕ
-    { 12, 20, 13, 0, 20, 60, 17848 }, // ŕ
-    { 14, 24, 16, 1, 18, 84, 17908 }, // Ŗ
-    { 12, 20, 12, -1, 14, 60, 17992 }, // ŗ
-    { 14, 24, 16, 1, 24, 84, 18052 }, // Ř
-    { 13, 20, 14, 0, 20, 65, 18136 }, // ř
-    { 13, 25, 14, 0, 24, 82, 18201 }, // Ś
-    { 11, 21, 12, 0, 20, 58, 18283 }, // ś
-    { 13, 25, 14, 0, 24, 82, 18341 }, // Ŝ
-    { 11, 21, 12, 0, 20, 58, 18423 }, // ŝ
-    { 13, 25, 14, 0, 19, 82, 18481 }, // Ş
-    { 11, 20, 12, 0, 14, 55, 18563 }, // ş
-    { 14, 25, 15, 0, 24, 88, 18618 }, // Š
-    { 12, 21, 13, 0, 20, 63, 18706 }, // š
-    { 14, 24, 16, 1, 18, 84, 18769 }, // Ţ
-    { 10, 23, 11, 0, 17, 58, 18853 }, // ţ
-    { 13, 24, 16, 2, 24, 78, 18911 }, // Ť
-    { 11, 20, 13, 1, 19, 55, 18989 }, // ť
-    { 13, 18, 16, 2, 18, 59, 19044 }, // Ŧ
-    { 10, 18, 11, 0, 17, 45, 19103 }, // ŧ
-    { 17, 24, 19, 1, 23, 102, 19148 }, // Ũ
-    { 13, 20, 15, 1, 19, 65, 19250 }, // ũ
-    { 17, 22, 19, 1, 21, 94, 19315 }, // Ū
-    { 13, 18, 15, 1, 17, 59, 19409 }, // ū
-    { 17, 24, 19, 1, 23, 102, 19468 }, // Ŭ
-    { 13, 20, 15, 1, 19, 65, 19570 }, // ŭ
-    { 17, 26, 19, 1, 25, 111, 19635 }, // Ů
-    { 13, 22, 15, 1, 21, 72, 19746 }, // ů
-    { 17, 25, 19, 1, 24, 107, 19818 }, // Ű
-    { 15, 21, 17, 1, 20, 79, 19925 }, // ű
-    { 17, 24, 19, 1, 18, 102, 20004 }, // Ų
-    { 13, 20, 15, 1, 14, 65, 20106 }, // ų
-    { 22, 24, 25, 2, 24, 132, 20171 }, // Ŵ
-    { 19, 20, 21, 1, 20, 95, 20303 }, // ŵ
-    { 14, 24, 17, 2, 24, 84, 20398 }, // Ŷ
-    { 16, 26, 14, -3, 20, 104, 20482 }, // ŷ
-    { 14, 23, 17, 2, 23, 81, 20586 }, // Ÿ
-    { 16, 24, 16, -1, 24, 96, 20667 }, // Ź
-    { 13, 20, 13, -1, 20, 65, 20763 }, // ź
-    { 16, 23, 16, -1, 23, 92, 20828 }, // Ż
-    { 12, 19, 12, -1, 19, 57, 20920 }, // ż
-    { 16, 24, 16, -1, 24, 96, 20977 }, // Ž
-    { 13, 20, 13, -1, 20, 65, 21073 }, // ž
-    { 15, 26, 12, -4, 20, 98, 21138 }, // ſ
-    { 20, 20, 22, 1, 19, 100, 21236 }, // Ơ
-    { 16, 17, 18, 1, 16, 68, 21336 }, // ơ
-    { 24, 20, 26, 1, 19, 120, 21404 }, // Ƣ
-    { 18, 20, 20, 1, 14, 90, 21524 }, // ƣ
-    { 15, 18, 18, 2, 18, 68, 21614 }, // Ƥ
-    { 15, 26, 15, -1, 20, 98, 21682 }, // ƥ
-    { 13, 21, 15, 1, 18, 69, 21780 }, // Ʀ
-    { 14, 20, 15, 0, 19, 70, 21849 }, // Ƨ
-    { 11, 15, 12, 0, 14, 42, 21919 }, // ƨ
-    { 16, 18, 16, -1, 18, 72, 21961 }, // Ʃ
-    { 7, 26, 8, 0, 20, 46, 22033 }, // ƪ
-    { 9, 23, 11, 1, 17, 52, 22079 }, // ƫ
-    { 14, 18, 17, 2, 18, 63, 22131 }, // Ƭ
-    { 9, 21, 11, 1, 20, 48, 22194 }, // ƭ
-    { 13, 24, 16, 2, 18, 78, 22242 }, // Ʈ
-    { 21, 20, 23, 1, 19, 105, 22320 }, // Ư
-    { 18, 17, 20, 1, 16, 77, 22425 }, // ư
-    { 5, 5, 0, -10, 20, 7, 22502 }, // ̀
-    { 6, 5, 1, -6, 20, 8, 22509 }, // ́
-    { 9, 5, 7, -3, 20, 12, 22517 }, // ̂
-    { 10, 4, 0, -11, 19, 10, 22529 }, // ̃
-    { 8, 2, 7, -2, 17, 4, 22539 }, // ̄
-    { 11, 3, 9, -3, 22, 9, 22543 }, // ̅
-    { 8, 4, 7, -2, 19, 8, 22552 }, // ̆
-    { 4, 4, 5, 0, 19, 4, 22560 }, // ̇
-    { 8, 4, 7, -2, 19, 8, 22564 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 22572 }, // ̉
-    { 7, 6, 7, -1, 21, 11, 22583 }, // ̊
-    { 10, 5, 9, -2, 20, 13, 22594 }, // ̋
-    { 9, 5, 8, -2, 20, 12, 22607 }, // ̌
-    { 4, 7, 5, 0, 19, 7, 22619 }, // ̍
-    { 8, 5, 7, -2, 19, 10, 22626 }, // ̎
-    { 10, 5, 0, -13, 20, 13, 22636 }, // ̏
-    { 9, 7, 8, -2, 22, 16, 22649 }, // ̐
-    { 8, 4, 7, -2, 19, 8, 22665 }, // ̑
-    { 6, 7, 6, -1, 18, 11, 22673 }, // ̒
-    { 6, 7, 6, -1, 18, 11, 22684 }, // ̓
-    { 4, 7, 5, 0, 18, 7, 22695 }, // ̔
-    { 6, 7, 6, -1, 18, 11, 22702 }, // ̕
-    { 5, 5, 1, -5, 0, 7, 22713 }, // ̖
-    { 6, 5, 3, -4, 0, 8, 22720 }, // ̗
-    { 6, 6, 2, -5, 0, 9, 22728 }, // ̘
-    { 6, 6, 2, -5, 0, 9, 22737 }, // ̙
-    { 8, 7, 11, 2, 19, 14, 22746 }, // ̚
-    { 6, 6, 6, -1, 19, 9, 22760 }, // ̛
-    { 5, 6, 4, -2, 0, 8, 22769 }, // ̜
-    { 6, 5, 2, -5, -1, 8, 22777 }, // ̝
-    { 7, 5, 3, -5, -1, 9, 22785 }, // ̞
-    { 6, 6, 2, -5, 0, 9, 22794 }, // ̟
-    { 6, 3, 2, -5, -2, 5, 22803 }, // ̠
-    { 6, 8, 2, -5, 2, 12, 22808 }, // ̡
-    { 5, 8, 3, -3, 2, 10, 22820 }, // ̢
-    { 4, 4, 0, -11, -1, 4, 22830 }, // ̣
-    { 8, 4, 3, -6, -1, 8, 22834 }, // ̤
-    { 6, 6, 2, -5, 0, 9, 22842 }, // ̥
-    { 5, 5, 7, 1, -1, 7, 22851 }, // ̦
-    { 6, 6, 2, -5, 0, 9, 22858 }, // ̧
-    { 5, 6, 2, -4, 0, 8, 22867 }, // ̨
-    { 4, 7, 1, -4, -1, 7, 22875 }, // ̩
-    { 10, 5, 4, -7, -1, 13, 22882 }, // ̪
-    { 11, 4, 5, -7, -1, 11, 22895 }, // ̫
-    { 9, 5, 4, -6, 0, 12, 22906 }, // ̬
-    { 8, 5, 3, -6, 0, 10, 22918 }, // ̭
-    { 9, 4, 4, -6, -1, 9, 22928 }, // ̮
-    { 8, 4, 3, -6, -1, 8, 22937 }, // ̯
-    { 10, 4, 4, -7, -1, 10, 22945 }, // ̰
-    { 8, 2, 3, -6, -2, 4, 22955 }, // ̱
-    { 12, 2, 5, -8, -2, 6, 22959 }, // ̲
-    { 12, 6, 5, -8, 0, 18, 22965 }, // ̳
-    { 10, 4, 6, -5, 9, 10, 22983 }, // ̴
-    { 10, 3, 6, -5, 9, 8, 22993 }, // ̵
-    { 18, 2, 10, -9, 8, 9, 23001 }, // ̶
-    { 8, 6, 5, -4, 10, 12, 23010 }, // ̷
-    { 14, 21, 8, -7, 19, 74, 23022 }, // ̸
-    { 4, 6, 3, -2, 0, 6, 23096 }, // ̹
-    { 10, 5, 4, -7, -1, 13, 23102 }, // ̺
-    { 10, 6, 4, -7, 0, 15, 23115 }, // ̻
-    { 10, 4, 4, -7, -1, 10, 23130 }, // ̼
-    { 7, 6, 7, -1, 20, 11, 23140 }, // ̽
-    { 6, 8, 6, -1, 22, 12, 23151 }, // ̾
-    { 12, 6, 10, -3, 25, 18, 23163 }, // ̿
-    { 6, 5, 5, -2, 20, 8, 23181 }, // ̀
-    { 7, 5, 8, 0, 20, 9, 23189 }, // ́
-    { 10, 4, 15, 4, 19, 10, 23198 }, // ͂
-    { 5, 5, 6, 0, 20, 7, 23208 }, // ̓
-    { 10, 5, 8, -3, 20, 13, 23215 }, // ̈́
-    { 4, 4, 2, -3, -2, 4, 23228 }, // ͅ
-    { 12, 6, 9, -4, 20, 18, 23232 }, // ͆
-    { 12, 6, 5, -8, 0, 18, 23250 }, // ͇
-    { 8, 5, 3, -6, -1, 10, 23268 }, // ͈
-    { 5, 5, 2, -4, -1, 7, 23278 }, // ͉
-    { 10, 6, 8, -3, 20, 15, 23285 }, // ͊
-    { 11, 10, 9, -3, 24, 28, 23300 }, // ͋
-    { 11, 7, 9, -3, 22, 20, 23328 }, // ͌
-    { 10, 6, 4, -7, 0, 15, 23348 }, // ͍
-    { 5, 6, 2, -4, 0, 8, 23363 }, // ͎
-    { 18, 18, 10, -9, 18, 81, 23371 }, // ͏
-    { 5, 6, 6, 0, 20, 8, 23452 }, // ͐
-    { 4, 6, 8, 3, 21, 6, 23460 }, // ͑
-    { 8, 7, 7, -2, 22, 14, 23466 }, // ͒
-    { 5, 6, 2, -4, 0, 8, 23480 }, // ͓
-    { 5, 5, 2, -4, -1, 7, 23488 }, // ͔
-    { 5, 5, 2, -4, -1, 7, 23495 }, // ͕
-    { 10, 5, 5, -6, -1, 13, 23502 }, // ͖
-    { 4, 6, 7, 2, 21, 6, 23515 }, // ͗
-    { 4, 4, 5, 0, 19, 4, 23521 }, // ͘
-    { 6, 6, 2, -5, 0, 9, 23525 }, // ͙
-    { 10, 6, 4, -7, 0, 15, 23534 }, // ͚
-    { 5, 6, 6, 0, 20, 8, 23549 }, // ͛
-    { 19, 5, 9, -11, -1, 24, 23557 }, // ͜
-    { 18, 5, 12, -7, 19, 23, 23581 }, // ͝
-    { 14, 2, 10, -5, 17, 7, 23604 }, // ͞
-    { 14, 2, 6, -9, -2, 7, 23611 }, // ͟
-    { 19, 4, 13, -7, 19, 19, 23618 }, // ͠
-    { 19, 6, 13, -7, 22, 29, 23637 }, // ͡
-    { 19, 6, 8, -12, 0, 29, 23666 }, // ͢
-    { 7, 6, 7, -1, 21, 11, 23695 }, // ͣ
-    { 5, 6, 6, 0, 21, 8, 23706 }, // ͤ
-    { 4, 8, 6, 1, 23, 8, 23714 }, // ͥ
-    { 7, 6, 7, -1, 21, 11, 23722 }, // ͦ
-    { 7, 6, 7, -1, 21, 11, 23733 }, // ͧ
-    { 6, 6, 7, 0, 21, 9, 23744 }, // ͨ
-    { 7, 9, 7, -1, 24, 16, 23753 }, // ͩ
-    { 7, 9, 7, -1, 24, 16, 23769 }, // ͪ
-    { 10, 6, 8, -3, 21, 15, 23785 }, // ͫ
-    { 6, 6, 7, 0, 21, 9, 23800 }, // ͬ
-    { 4, 8, 6, 1, 23, 8, 23809 }, // ͭ
-    { 6, 6, 7, 0, 21, 9, 23817 }, // ͮ
-    { 7, 6, 7, -1, 21, 11, 23826 }, // ͯ
-    { 15, 18, 14, -2, 18, 68, 23837 }, // Α
-    { 14, 18, 16, 1, 18, 63, 23905 }, // Β
-    { 13, 18, 15, 1, 18, 59, 23968 }, // Γ
-    { 16, 18, 15, -2, 18, 72, 24027 }, // Δ
-    { 13, 18, 15, 1, 18, 59, 24099 }, // Ε
-    { 16, 18, 16, -1, 18, 72, 24158 }, // Ζ
-    { 17, 18, 19, 1, 18, 77, 24230 }, // Η
-    { 17, 20, 19, 1, 19, 85, 24307 }, // Θ
-    { 11, 18, 11, -1, 18, 50, 24392 }, // Ι
-    { 16, 18, 18, 1, 18, 72, 24442 }, // Κ
-    { 15, 18, 14, -2, 18, 68, 24514 }, // Λ
-    { 21, 18, 23, 1, 18, 95, 24582 }, // Μ
-    { 17, 18, 19, 1, 18, 77, 24677 }, // Ν
-    { 16, 18, 16, -1, 18, 72, 24754 }, // Ξ
-    { 17, 20, 19, 1, 19, 85, 24826 }, // Ο
-    { 17, 18, 19, 1, 18, 77, 24911 }, // Π
-    { 14, 18, 16, 1, 18, 63, 24988 }, // Ρ
-    { 16, 18, 16, -1, 18, 72, 25051 }, // Σ
-    { 13, 18, 16, 2, 18, 59, 25123 }, // Τ
-    { 14, 18, 17, 2, 18, 63, 25182 }, // Υ
-    { 20, 18, 22, 1, 18, 90, 25245 }, // Φ
-    { 18, 18, 17, -2, 18, 81, 25335 }, // Χ
-    { 19, 18, 22, 2, 18, 86, 25416 }, // Ψ
-    { 18, 19, 18, -1, 19, 86, 25502 }, // Ω
-    { 13, 15, 15, 1, 14, 49, 25588 }, // α
-    { 16, 26, 16, -1, 20, 104, 25637 }, // β
-    { 11, 20, 13, 1, 14, 55, 25741 }, // γ
-    { 14, 21, 16, 1, 20, 74, 25796 }, // δ
-    { 11, 15, 12, 0, 14, 42, 25870 }, // ε
-    { 13, 25, 14, 0, 19, 82, 25912 }, // ζ
-    { 14, 20, 15, 0, 14, 70, 25994 }, // η
-    { 13, 21, 15, 1, 20, 69, 26064 }, // θ
-    { 6, 15, 8, 1, 14, 23, 26133 }, // ι
-    { 14, 14, 15, 0, 14, 49, 26156 }, // κ
-    { 13, 21, 13, -1, 20, 69, 26205 }, // λ
-    { 15, 20, 15, -1, 14, 75, 26274 }, // μ
-    { 11, 14, 13, 1, 14, 39, 26349 }, // ν
-    { 14, 25, 15, 0, 19, 88, 26388 }, // ξ
-    { 12, 15, 14, 1, 14, 45, 26476 }, // ο
-    { 15, 15, 17, 1, 14, 57, 26521 }, // π
-    { 14, 20, 14, -1, 14, 70, 26578 }, // ρ
-    { 11, 20, 13, 1, 14, 55, 26648 }, // ς
-    { 14, 15, 16, 1, 14, 53, 26703 }, // σ
-    { 11, 15, 13, 1, 14, 42, 26756 }, // τ
-    { 13, 15, 15, 1, 14, 49, 26798 }, // υ
-    { 16, 20, 18, 1, 14, 80, 26847 }, // φ
-    { 17, 20, 16, -2, 14, 85, 26927 }, // χ
-    { 16, 25, 18, 1, 19, 100, 27012 }, // ψ
-    { 18, 15, 20, 1, 14, 68, 27112 }, // ω
-    { 15, 23, 14, -2, 18, 87, 27180 }, // Ạ
-    { 13, 19, 15, 1, 14, 62, 27267 }, // ạ
-    { 15, 25, 14, -2, 25, 94, 27329 }, // Ả
-    { 13, 22, 15, 1, 21, 72, 27423 }, // ả
-    { 19, 25, 18, -2, 25, 119, 27495 }, // Ấ
-    { 16, 22, 18, 1, 21, 88, 27614 }, // ấ
-    { 16, 25, 15, -2, 25, 100, 27702 }, // Ầ
-    { 13, 22, 15, 1, 21, 72, 27802 }, // ầ
-    { 19, 26, 18, -2, 26, 124, 27874 }, // Ẩ
-    { 15, 23, 17, 1, 22, 87, 27998 }, // ẩ
-    { 18, 27, 17, -2, 27, 122, 28085 }, // Ẫ
-    { 14, 24, 16, 1, 23, 84, 28207 }, // ẫ
-    { 16, 29, 15, -2, 24, 116, 28291 }, // Ậ
-    { 13, 25, 15, 1, 20, 82, 28407 }, // ậ
-    { 16, 26, 15, -2, 26, 104, 28489 }, // Ắ
-    { 13, 23, 15, 1, 22, 75, 28593 }, // ắ
-    { 16, 26, 15, -2, 26, 104, 28668 }, // Ằ
-    { 13, 23, 15, 1, 22, 75, 28772 }, // ằ
-    { 16, 27, 15, -2, 27, 108, 28847 }, // Ẳ
-    { 13, 23, 15, 1, 22, 75, 28955 }, // ẳ
-    { 17, 27, 16, -2, 27, 115, 29030 }, // Ẵ
-    { 14, 24, 16, 1, 23, 84, 29145 }, // ẵ
-    { 16, 28, 15, -2, 23, 112, 29229 }, // Ặ
-    { 13, 24, 15, 1, 19, 78, 29341 }, // ặ
-    { 13, 23, 15, 1, 18, 75, 29419 }, // Ẹ
-    { 11, 19, 13, 1, 14, 53, 29494 }, // ẹ
-    { 13, 25, 15, 1, 25, 82, 29547 }, // Ẻ
-    { 11, 22, 13, 1, 21, 61, 29629 }, // ẻ
-    { 14, 23, 16, 1, 23, 81, 29690 }, // Ẽ
-    { 13, 20, 15, 1, 19, 65, 29771 }, // ẽ
-    { 16, 25, 18, 1, 25, 100, 29836 }, // Ế
-    { 15, 22, 17, 1, 21, 83, 29936 }, // ế
-    { 13, 25, 15, 1, 25, 82, 30019 }, // Ề
-    { 11, 22, 13, 1, 21, 61, 30101 }, // ề
-    { 15, 26, 17, 1, 26, 98, 30162 }, // Ể
-    { 14, 23, 16, 1, 22, 81, 30260 }, // ể
-    { 14, 27, 16, 1, 27, 95, 30341 }, // Ễ
-    { 13, 24, 15, 1, 23, 78, 30436 }, // ễ
-    { 13, 29, 15, 1, 24, 95, 30514 }, // Ệ
-    { 11, 25, 13, 1, 20, 69, 30609 }, // ệ
-    { 11, 25, 11, -1, 25, 69, 30678 }, // Ỉ
-    { 9, 21, 10, 0, 21, 48, 30747 }, // ỉ
-    { 11, 23, 11, -1, 18, 64, 30795 }, // Ị
-    { 8, 24, 8, -1, 19, 48, 30859 }, // ị
-    { 17, 24, 19, 1, 19, 102, 30907 }, // Ọ
-    { 12, 19, 14, 1, 14, 57, 31009 }, // ọ
-    { 17, 26, 19, 1, 25, 111, 31066 }, // Ỏ
-    { 12, 22, 14, 1, 21, 66, 31177 }, // ỏ
-    { 18, 26, 20, 1, 25, 117, 31243 }, // Ố
-    { 15, 22, 17, 1, 21, 83, 31360 }, // ố
-    { 17, 26, 19, 1, 25, 111, 31443 }, // Ồ
-    { 12, 22, 14, 1, 21, 66, 31554 }, // ồ
-    { 18, 27, 20, 1, 26, 122, 31620 }, // Ổ
-    { 14, 23, 16, 1, 22, 81, 31742 }, // ổ
-    { 17, 28, 19, 1, 27, 119, 31823 }, // Ỗ
-    { 13, 24, 15, 1, 23, 78, 31942 }, // ỗ
-    { 17, 29, 19, 1, 24, 124, 32020 }, // Ộ
-    { 12, 25, 14, 1, 20, 75, 32144 }, // ộ
-    { 20, 25, 22, 1, 24, 125, 32219 }, // Ớ
-    { 16, 21, 18, 1, 20, 84, 32344 }, // ớ
-    { 20, 25, 22, 1, 24, 125, 32428 }, // Ờ
-    { 16, 21, 18, 1, 20, 84, 32553 }, // ờ
-    { 20, 26, 22, 1, 25, 130, 32637 }, // Ở
-    { 16, 22, 18, 1, 21, 88, 32767 }, // ở
-    { 20, 24, 22, 1, 23, 120, 32855 }, // Ỡ
-    { 16, 20, 18, 1, 19, 80, 32975 }, // ỡ
-    { 20, 24, 22, 1, 19, 120, 33055 }, // Ợ
-    { 16, 21, 18, 1, 16, 84, 33175 }, // ợ
-    { 17, 23, 19, 1, 18, 98, 33259 }, // Ụ
-    { 13, 19, 15, 1, 14, 62, 33357 }, // ụ
-    { 17, 26, 19, 1, 25, 111, 33419 }, // Ủ
-    { 13, 22, 15, 1, 21, 72, 33530 }, // ủ
-    { 21, 25, 23, 1, 24, 132, 33602 }, // Ứ
-    { 18, 21, 20, 1, 20, 95, 33734 }, // ứ
-    { 21, 25, 23, 1, 24, 132, 33829 }, // Ừ
-    { 18, 21, 20, 1, 20, 95, 33961 }, // ừ
-    { 21, 26, 23, 1, 25, 137, 34056 }, // Ử
-    { 18, 22, 20, 1, 21, 99, 34193 }, // ử
-    { 21, 24, 23, 1, 23, 126, 34292 }, // Ữ
-    { 18, 20, 20, 1, 19, 90, 34418 }, // ữ
-    { 21, 24, 23, 1, 19, 126, 34508 }, // Ự
-    { 18, 21, 20, 1, 16, 95, 34634 }, // ự
-    { 14, 24, 17, 2, 24, 84, 34729 }, // Ỳ
-    { 16, 26, 14, -3, 20, 104, 34813 }, // ỳ
-    { 14, 23, 17, 2, 18, 81, 34917 }, // Ỵ
-    { 16, 20, 14, -3, 14, 80, 34998 }, // ỵ
-    { 14, 25, 17, 2, 25, 88, 35078 }, // Ỷ
-    { 16, 27, 14, -3, 21, 108, 35166 }, // ỷ
-    { 14, 23, 17, 2, 23, 81, 35274 }, // Ỹ
-    { 16, 25, 14, -3, 19, 100, 35355 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 35455 }, //  
-    { 0, 0, 25, 0, 0, 0, 35455 }, //  
-    { 0, 0, 13, 0, 0, 0, 35455 }, //  
-    { 0, 0, 25, 0, 0, 0, 35455 }, //  
-    { 0, 0, 8, 0, 0, 0, 35455 }, //  
-    { 0, 0, 6, 0, 0, 0, 35455 }, //  
-    { 0, 0, 4, 0, 0, 0, 35455 }, //  
-    { 0, 0, 14, 0, 0, 0, 35455 }, //  
-    { 0, 0, 6, 0, 0, 0, 35455 }, //  
-    { 0, 0, 4, 0, 0, 0, 35455 }, //  
-    { 0, 0, 3, 0, 0, 0, 35455 }, //  
-    { 0, 0, 1, 0, 0, 0, 35455 }, // ​
-    { 0, 0, 1, 0, 0, 0, 35455 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 35455 }, // ‍
-    { 7, 22, 7, -1, 18, 39, 35455 }, // ‎
-    { 7, 22, 2, -6, 18, 39, 35494 }, // ‏
-    { 7, 3, 8, 0, 8, 6, 35533 }, // ‐
-    { 7, 3, 8, 0, 8, 6, 35539 }, // ‑
-    { 13, 2, 15, 1, 10, 7, 35545 }, // ‒
-    { 12, 3, 13, 0, 8, 9, 35552 }, // –
-    { 24, 3, 25, 0, 8, 18, 35561 }, // —
-    { 24, 3, 25, 0, 8, 18, 35579 }, // ―
-    { 9, 26, 14, 3, 19, 59, 35597 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 35656 }, // ‗
-    { 6, 7, 8, 1, 18, 11, 35674 }, // ‘
-    { 6, 7, 8, 1, 18, 11, 35685 }, // ’
-    { 6, 7, 6, -2, 3, 11, 35696 }, // ‚
-    { 4, 7, 7, 2, 18, 7, 35707 }, // ‛
-    { 11, 7, 13, 1, 18, 20, 35714 }, // “
-    { 11, 7, 13, 1, 18, 20, 35734 }, // ”
-    { 11, 7, 11, -2, 3, 20, 35754 }, // „
-    { 8, 7, 11, 2, 18, 14, 35774 }, // ‟
-    { 10, 19, 13, 2, 19, 48, 35788 }, // †
-    { 13, 19, 14, 0, 19, 62, 35836 }, // ‡
-    { 6, 7, 9, 2, 13, 11, 35898 }, // •
-    { 8, 8, 10, 1, 13, 16, 35909 }, // ‣
-    { 4, 5, 13, 3, 4, 5, 35925 }, // ․
-    { 10, 5, 13, 0, 4, 13, 35930 }, // ‥
-    { 17, 5, 19, 0, 4, 22, 35943 }, // …
-    { 4, 5, 6, 1, 9, 5, 35965 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 35970 }, //  
-    { 0, 0, 15, 0, 0, 0, 35970 }, //  
-    { 7, 20, 7, -1, 16, 35, 35970 }, // ‪
-    { 7, 20, 2, -6, 16, 35, 36005 }, // ‫
-    { 6, 22, 4, -3, 18, 33, 36040 }, // ‬
-    { 6, 22, 4, -3, 18, 33, 36073 }, // ‭
-    { 6, 22, 4, -3, 18, 33, 36106 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 36139 }, //  
-    { 26, 20, 29, 2, 19, 130, 36139 }, // ‰
-    { 34, 20, 37, 2, 19, 170, 36269 }, // ‱
-    { 7, 7, 9, 1, 18, 13, 36439 }, // ′
-    { 11, 7, 13, 1, 18, 20, 36452 }, // ″
-    { 15, 7, 17, 1, 18, 27, 36472 }, // ‴
-    { 4, 7, 8, 3, 18, 7, 36499 }, // ‵
-    { 8, 7, 12, 3, 18, 14, 36506 }, // ‶
-    { 12, 7, 16, 3, 18, 21, 36520 }, // ‷
-    { 10, 9, 10, -3, 3, 23, 36541 }, // ‸
-    { 6, 11, 8, 1, 12, 17, 36564 }, // ‹
-    { 7, 11, 8, 0, 12, 20, 36581 }, // ›
-    { 19, 20, 21, 1, 19, 95, 36601 }, // ※
-    { 13, 19, 14, 0, 18, 62, 36696 }, // ‼
-    { 11, 20, 13, 1, 19, 55, 36758 }, // ‽
-    { 11, 2, 14, 2, 21, 6, 36813 }, // ‾
-    { 14, 6, 14, -2, 0, 21, 36819 }, // ‿
-    { 13, 6, 16, 2, 20, 20, 36840 }, // ⁀
-    { 12, 17, 10, -3, 11, 51, 36860 }, // ⁁
-    { 27, 24, 28, 0, 20, 162, 36911 }, // ⁂
-    { 7, 3, 8, 0, 8, 6, 37073 }, // ⁃
-    { 16, 18, 11, -6, 18, 72, 37079 }, // ⁄
-    { 11, 22, 11, -1, 18, 61, 37151 }, // ⁅
-    { 10, 22, 9, -2, 18, 55, 37212 }, // ⁆
-    { 22, 20, 24, 1, 19, 110, 37267 }, // ⁇
-    { 17, 20, 19, 1, 19, 85, 37377 }, // ⁈
-    { 18, 20, 19, 0, 19, 90, 37462 }, // ⁉
-    { 13, 14, 15, 1, 14, 46, 37552 }, // ⁊
-    { 13, 23, 16, 2, 19, 75, 37598 }, // ⁋
-    { 13, 14, 16, 1, 14, 46, 37673 }, // ⁌
-    { 13, 14, 16, 2, 14, 46, 37719 }, // ⁍
-    { 13, 13, 14, -1, 7, 43, 37765 }, // ⁎
-    { 6, 18, 7, 0, 14, 27, 37808 }, // ⁏
-    { 17, 26, 16, -2, 20, 111, 37835 }, // ⁐
-    { 15, 26, 16, 0, 20, 98, 37946 }, // ⁑
-    { 10, 20, 11, 0, 19, 50, 38044 }, // ⁒
-    { 22, 5, 25, 2, 10, 28, 38094 }, // ⁓
-    { 14, 6, 14, -3, 0, 21, 38122 }, // ⁔
-    { 14, 14, 15, 0, 13, 49, 38143 }, // ⁕
-    { 11, 20, 13, 1, 19, 55, 38192 }, // ⁖
-    { 19, 7, 21, 1, 18, 34, 38247 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 38281 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 38376 }, // ⁙
-    { 4, 20, 6, 1, 19, 20, 38471 }, // ⁚
-    { 15, 20, 17, 1, 19, 75, 38491 }, // ⁛
-    { 19, 20, 20, 0, 19, 95, 38566 }, // ⁜
-    { 4, 19, 7, 1, 18, 19, 38661 }, // ⁝
-    { 4, 20, 7, 2, 19, 20, 38680 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 38700 }, //  
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 38700 }, // ⁩
-    { 6, 22, 4, -3, 18, 33, 38700 }, // ⁪
-    { 6, 22, 4, -3, 18, 33, 38733 }, // ⁫
-    { 6, 22, 4, -3, 18, 33, 38766 }, // ⁬
-    { 6, 22, 4, -3, 18, 33, 38799 }, // ⁭
-    { 6, 22, 4, -3, 18, 33, 38832 }, // ⁮
-    { 6, 22, 4, -3, 18, 33, 38865 }, // ⁯
-    { 9, 12, 12, 2, 22, 27, 38898 }, // ⁰
-    { 4, 12, 7, 2, 19, 12, 38925 }, // ⁱ
-    { 9, 12, 11, 1, 22, 27, 38937 }, // ⁴
-    { 9, 12, 12, 2, 22, 27, 38964 }, // ⁵
-    { 9, 12, 12, 2, 22, 27, 38991 }, // ⁶
-    { 9, 12, 12, 2, 22, 27, 39018 }, // ⁷
-    { 9, 12, 12, 2, 22, 27, 39045 }, // ⁸
-    { 9, 12, 12, 2, 22, 27, 39072 }, // ⁹
-    { 8, 8, 11, 2, 19, 16, 39099 }, // ⁺
-    { 8, 2, 11, 2, 16, 4, 39115 }, // ⁻
-    { 8, 5, 11, 2, 18, 10, 39119 }, // ⁼
-    { 7, 14, 10, 2, 23, 25, 39129 }, // ⁽
-    { 6, 14, 7, 0, 23, 21, 39154 }, // ⁾
-    { 9, 9, 11, 1, 16, 21, 39175 }, // ⁿ
-    { 9, 12, 9, -1, 8, 27, 39196 }, // ₀
-    { 6, 12, 9, 0, 8, 18, 39223 }, // ₁
-    { 9, 12, 9, -2, 8, 27, 39241 }, // ₂
-    { 8, 12, 9, -1, 8, 24, 39268 }, // ₃
-    { 9, 12, 9, -1, 8, 27, 39292 }, // ₄
-    { 9, 12, 9, -1, 8, 27, 39319 }, // ₅
-    { 9, 12, 9, -1, 8, 27, 39346 }, // ₆
-    { 9, 12, 9, -1, 8, 27, 39373 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 39400 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 39427 }, // ₉
-    { 8, 8, 8, -1, 6, 16, 39454 }, // ₊
-    { 8, 2, 8, -1, 3, 4, 39470 }, // ₋
-    { 8, 5, 8, -1, 5, 10, 39474 }, // ₌
-    { 6, 14, 7, 0, 9, 21, 39484 }, // ₍
-    { 6, 14, 5, -3, 9, 21, 39505 }, // ₎
-    { 9, 9, 9, -1, 6, 21, 39526 }, // ₐ
-    { 8, 9, 8, -1, 6, 18, 39547 }, // ₑ
-    { 9, 9, 9, -1, 6, 21, 39565 }, // ₒ
-    { 9, 9, 8, -2, 6, 21, 39586 }, // ₓ
-    { 7, 9, 8, -1, 6, 16, 39607 }, // ₔ
-    { 9, 12, 11, 0, 9, 27, 39623 }, // ₕ
-    { 9, 12, 10, 0, 9, 27, 39650 }, // ₖ
-    { 5, 12, 6, 0, 9, 15, 39677 }, // ₗ
-    { 14, 9, 16, 0, 6, 32, 39692 }, // ₘ
-    { 9, 9, 9, -1, 6, 21, 39724 }, // ₙ
-    { 10, 12, 9, -2, 6, 30, 39745 }, // ₚ
-    { 7, 9, 8, -1, 6, 16, 39775 }, // ₛ
-    { 6, 11, 6, -1, 8, 17, 39791 }, // ₜ
-    { 14, 19, 16, 1, 19, 67, 39808 }, // ₠
-    { 14, 21, 16, 1, 19, 74, 39875 }, // ₡
-    { 14, 20, 16, 1, 19, 70, 39949 }, // ₢
-    { 15, 18, 16, 0, 18, 68, 40019 }, // ₣
-    { 16, 19, 16, -1, 19, 76, 40087 }, // ₤
-    { 21, 20, 22, 0, 17, 105, 40163 }, // ₥
-    { 15, 18, 16, 0, 18, 68, 40268 }, // ₦
-    { 18, 19, 19, 0, 18, 86, 40336 }, // ₧
-    { 21, 19, 22, 0, 18, 100, 40422 }, // ₨
-    { 18, 18, 19, 0, 18, 81, 40522 }, // ₩
-    { 21, 18, 22, 0, 18, 95, 40603 }, // ₪
-    { 17, 23, 18, 0, 19, 98, 40698 }, // ₫
-    { 16, 20, 17, 0, 19, 80, 40796 }, // €
-    { 17, 18, 18, 0, 18, 77, 40876 }, // ₭
-    { 14, 18, 16, 1, 18, 63, 40953 }, // ₮
-    { 24, 25, 25, 0, 19, 150, 41016 }, // ₯
-    { 16, 25, 15, -2, 19, 100, 41166 }, // ₰
-    { 16, 18, 17, 0, 18, 72, 41266 }, // ₱
-    { 16, 21, 18, 1, 19, 84, 41338 }, // ₲
-    { 17, 18, 16, -2, 18, 77, 41422 }, // ₳
-    { 15, 20, 15, -1, 19, 75, 41499 }, // ₴
-    { 15, 21, 17, 1, 19, 79, 41574 }, // ₵
-    { 16, 18, 17, 0, 17, 72, 41653 }, // ₶
-    { 18, 21, 18, -1, 19, 95, 41725 }, // ₷
-    { 14, 18, 16, 1, 18, 63, 41820 }, // ₸
-    { 13, 18, 16, 2, 18, 59, 41883 }, // ₹
-    { 14, 19, 15, 0, 18, 67, 41942 }, // ₺
-    { 16, 20, 18, 1, 19, 80, 42009 }, // ₻
-    { 19, 18, 19, -1, 18, 86, 42089 }, // ₼
-    { 16, 18, 16, -1, 18, 72, 42175 }, // ₽
-    { 17, 21, 17, -1, 21, 90, 42247 }, // ₾
-    { 13, 24, 15, 1, 21, 78, 42337 }, // ₿
-    { 7, 3, 8, 0, 8, 6, 42415 }, // −
-    { 23, 23, 25, 1, 19, 133, 42421 }, // �
+    { 7, 19, 8, 0, 18, 28, 0 }, // !
+    { 9, 7, 12, 2, 18, 23, 28 }, // "
+    { 17, 18, 18, 0, 18, 64, 51 }, // #
+    { 14, 21, 15, 0, 19, 57, 115 }, // $
+    { 17, 20, 20, 2, 19, 87, 172 }, // %
+    { 17, 20, 18, 0, 19, 65, 259 }, // &
+    { 4, 7, 7, 2, 18, 12, 324 }, // '
+    { 9, 22, 11, 1, 18, 32, 336 }, // (
+    { 9, 22, 8, -2, 18, 32, 368 }, // )
+    { 13, 13, 16, 2, 20, 31, 400 }, // *
+    { 13, 13, 15, 1, 15, 33, 431 }, // +
+    { 6, 7, 6, -2, 3, 11, 464 }, // ,
+    { 7, 3, 8, 0, 8, 9, 475 }, // -
+    { 4, 5, 6, 0, 4, 6, 484 }, // .
+    { 14, 18, 13, -2, 18, 38, 490 }, // /
+    { 13, 20, 15, 1, 19, 54, 528 }, // 0
+    { 9, 18, 14, 3, 18, 30, 582 }, // 1
+    { 14, 19, 15, 0, 19, 41, 612 }, // 2
+    { 14, 20, 15, 0, 19, 45, 653 }, // 3
+    { 14, 18, 15, 0, 18, 46, 698 }, // 4
+    { 14, 19, 15, 0, 18, 40, 744 }, // 5
+    { 13, 20, 15, 1, 19, 52, 784 }, // 6
+    { 13, 18, 16, 2, 18, 37, 836 }, // 7
+    { 13, 20, 15, 1, 19, 53, 873 }, // 8
+    { 13, 20, 15, 1, 19, 50, 926 }, // 9
+    { 6, 15, 7, 0, 14, 17, 976 }, // :
+    { 8, 18, 7, -2, 14, 21, 993 }, // ;
+    { 13, 14, 15, 1, 16, 29, 1014 }, // <
+    { 13, 8, 15, 1, 13, 21, 1043 }, // =
+    { 13, 14, 15, 1, 16, 28, 1064 }, // >
+    { 11, 20, 13, 1, 19, 32, 1092 }, // ?
+    { 20, 21, 22, 1, 18, 103, 1124 }, // @
+    { 15, 18, 14, -2, 18, 56, 1227 }, // A
+    { 14, 18, 16, 1, 18, 56, 1283 }, // B
+    { 15, 20, 17, 1, 19, 41, 1339 }, // C
+    { 15, 18, 17, 1, 18, 55, 1380 }, // D
+    { 13, 18, 15, 1, 18, 42, 1435 }, // E
+    { 13, 18, 15, 1, 18, 43, 1477 }, // F
+    { 16, 20, 18, 1, 19, 55, 1520 }, // G
+    { 17, 18, 19, 1, 18, 61, 1575 }, // H
+    { 11, 18, 11, -1, 18, 31, 1636 }, // I
+    { 12, 23, 9, -4, 18, 48, 1667 }, // J
+    { 16, 18, 18, 1, 18, 57, 1715 }, // K
+    { 10, 18, 12, 1, 18, 28, 1772 }, // L
+    { 21, 18, 23, 1, 18, 92, 1800 }, // M
+    { 17, 18, 19, 1, 18, 73, 1892 }, // N
+    { 17, 20, 19, 1, 19, 56, 1965 }, // O
+    { 14, 18, 16, 1, 18, 45, 2021 }, // P
+    { 17, 24, 19, 1, 19, 65, 2066 }, // Q
+    { 14, 18, 16, 1, 18, 54, 2131 }, // R
+    { 13, 20, 14, 0, 19, 45, 2185 }, // S
+    { 13, 18, 16, 2, 18, 37, 2230 }, // T
+    { 17, 19, 19, 1, 18, 55, 2267 }, // U
+    { 15, 18, 18, 2, 18, 53, 2322 }, // V
+    { 22, 18, 25, 2, 18, 86, 2375 }, // W
+    { 18, 18, 17, -2, 18, 54, 2461 }, // X
+    { 14, 18, 17, 2, 18, 46, 2515 }, // Y
+    { 16, 18, 16, -1, 18, 39, 2561 }, // Z
+    { 11, 22, 11, -1, 18, 36, 2600 }, // [
+    { 6, 18, 9, 2, 18, 26, 2636 }, // <backslash>
+    { 10, 22, 9, -2, 18, 35, 2662 }, // ]
+    { 14, 12, 15, 0, 18, 34, 2697 }, // ^
+    { 11, 2, 10, -3, -2, 5, 2731 }, // _
+    { 5, 5, 9, 3, 20, 6, 2736 }, // `
+    { 13, 15, 15, 1, 14, 49, 2742 }, // a
+    { 14, 20, 15, 0, 19, 56, 2791 }, // b
+    { 11, 15, 13, 1, 14, 31, 2847 }, // c
+    { 14, 20, 16, 1, 19, 59, 2878 }, // d
+    { 11, 15, 13, 1, 14, 39, 2937 }, // e
+    { 15, 26, 13, -3, 20, 56, 2976 }, // f
+    { 14, 20, 15, 0, 14, 61, 3032 }, // g
+    { 14, 19, 15, 0, 19, 54, 3093 }, // h
+    { 7, 19, 8, 0, 19, 28, 3147 }, // i
+    { 11, 25, 8, -4, 19, 40, 3175 }, // j
+    { 14, 19, 15, 0, 19, 55, 3215 }, // k
+    { 7, 19, 8, 0, 19, 29, 3270 }, // l
+    { 21, 14, 22, 0, 14, 68, 3299 }, // m
+    { 14, 14, 15, 0, 14, 46, 3367 }, // n
+    { 12, 15, 14, 1, 14, 42, 3413 }, // o
+    { 15, 20, 15, -1, 14, 56, 3455 }, // p
+    { 13, 20, 15, 1, 14, 61, 3511 }, // q
+    { 11, 14, 12, 0, 14, 28, 3572 }, // r
+    { 11, 15, 12, 0, 14, 31, 3600 }, // s
+    { 9, 18, 11, 1, 17, 32, 3631 }, // t
+    { 13, 15, 15, 1, 14, 46, 3663 }, // u
+    { 12, 14, 14, 1, 14, 38, 3709 }, // v
+    { 19, 14, 21, 1, 14, 70, 3747 }, // w
+    { 14, 14, 14, -1, 14, 39, 3817 }, // x
+    { 16, 20, 14, -3, 14, 55, 3856 }, // y
+    { 12, 14, 12, -1, 14, 32, 3911 }, // z
+    { 10, 22, 11, 0, 18, 35, 3943 }, // {
+    { 3, 26, 14, 6, 19, 38, 3978 }, // |
+    { 10, 22, 10, -1, 18, 34, 4016 }, // }
+    { 13, 4, 15, 1, 11, 14, 4050 }, // ~
+    { 0, 0, 7, 0, 0, 0, 4064 }, //  
+    { 8, 19, 8, -1, 14, 28, 4064 }, // ¡
+    { 12, 20, 15, 2, 19, 39, 4092 }, // ¢
+    { 16, 19, 16, -1, 19, 45, 4131 }, // £
+    { 11, 12, 14, 2, 15, 36, 4176 }, // ¤
+    { 15, 18, 17, 1, 18, 49, 4212 }, // ¥
+    { 3, 26, 14, 6, 19, 31, 4261 }, // ¦
+    { 13, 21, 14, 0, 20, 49, 4292 }, // §
+    { 8, 4, 14, 5, 19, 7, 4341 }, // ¨
+    { 19, 20, 21, 1, 19, 83, 4348 }, // ©
+    { 8, 10, 11, 2, 19, 27, 4431 }, // ª
+    { 11, 11, 13, 1, 12, 34, 4458 }, // «
+    { 13, 7, 15, 1, 10, 21, 4492 }, // ¬
+    { 7, 3, 8, 0, 8, 9, 4513 }, // ­
+    { 19, 20, 21, 1, 19, 90, 4522 }, // ®
+    { 11, 2, 14, 2, 21, 8, 4612 }, // ¯
+    { 9, 9, 11, 1, 19, 24, 4620 }, // °
+    { 13, 15, 15, 1, 15, 35, 4644 }, // ±
+    { 9, 12, 11, 1, 22, 23, 4679 }, // ²
+    { 8, 12, 11, 2, 22, 25, 4702 }, // ³
+    { 7, 5, 10, 2, 20, 7, 4727 }, // ´
+    { 15, 20, 15, -1, 14, 58, 4734 }, // µ
+    { 13, 23, 16, 2, 19, 74, 4792 }, // ¶
+    { 4, 5, 7, 2, 11, 5, 4866 }, // ·
+    { 6, 6, 5, -3, 0, 12, 4871 }, // ¸
+    { 6, 12, 10, 3, 22, 19, 4883 }, // ¹
+    { 8, 10, 11, 2, 19, 24, 4902 }, // º
+    { 11, 11, 12, 0, 12, 33, 4926 }, // »
+    { 16, 19, 19, 2, 19, 71, 4959 }, // ¼
+    { 18, 19, 21, 2, 19, 72, 5030 }, // ½
+    { 18, 19, 20, 1, 19, 77, 5102 }, // ¾
+    { 10, 19, 11, -1, 14, 34, 5179 }, // ¿
+    { 15, 24, 14, -2, 24, 66, 5213 }, // À
+    { 16, 24, 15, -2, 24, 68, 5279 }, // Á
+    { 16, 24, 15, -2, 24, 71, 5347 }, // Â
+    { 17, 23, 16, -2, 23, 72, 5418 }, // Ã
+    { 16, 23, 15, -2, 23, 67, 5490 }, // Ä
+    { 15, 25, 14, -2, 25, 74, 5557 }, // Å
+    { 24, 18, 23, -2, 18, 74, 5631 }, // Æ
+    { 15, 25, 17, 1, 19, 54, 5705 }, // Ç
+    { 13, 24, 15, 1, 24, 52, 5759 }, // È
+    { 13, 24, 15, 1, 24, 52, 5811 }, // É
+    { 13, 24, 15, 1, 24, 55, 5863 }, // Ê
+    { 13, 23, 15, 1, 23, 51, 5918 }, // Ë
+    { 11, 24, 11, -1, 24, 41, 5969 }, // Ì
+    { 12, 24, 12, -1, 24, 47, 6010 }, // Í
+    { 12, 24, 12, -1, 24, 48, 6057 }, // Î
+    { 12, 23, 12, -1, 23, 46, 6105 }, // Ï
+    { 16, 18, 17, 0, 18, 56, 6151 }, // Ð
+    { 17, 23, 19, 1, 23, 87, 6207 }, // Ñ
+    { 17, 25, 19, 1, 24, 66, 6294 }, // Ò
+    { 17, 25, 19, 1, 24, 66, 6360 }, // Ó
+    { 17, 25, 19, 1, 24, 69, 6426 }, // Ô
+    { 17, 24, 19, 1, 23, 69, 6495 }, // Õ
+    { 17, 24, 19, 1, 23, 65, 6564 }, // Ö
+    { 12, 12, 15, 2, 15, 33, 6629 }, // ×
+    { 17, 21, 19, 1, 19, 72, 6662 }, // Ø
+    { 17, 25, 19, 1, 24, 65, 6734 }, // Ù
+    { 17, 25, 19, 1, 24, 65, 6799 }, // Ú
+    { 17, 25, 19, 1, 24, 68, 6864 }, // Û
+    { 17, 24, 19, 1, 23, 65, 6932 }, // Ü
+    { 14, 24, 17, 2, 24, 57, 6997 }, // Ý
+    { 13, 18, 15, 1, 18, 46, 7054 }, // Þ
+    { 18, 26, 15, -4, 20, 76, 7100 }, // ß
+    { 13, 21, 15, 1, 20, 58, 7176 }, // à
+    { 13, 21, 15, 1, 20, 59, 7234 }, // á
+    { 13, 21, 15, 1, 20, 60, 7293 }, // â
+    { 13, 20, 15, 1, 19, 61, 7353 }, // ã
+    { 13, 20, 15, 1, 19, 58, 7414 }, // ä
+    { 13, 22, 15, 1, 21, 65, 7472 }, // å
+    { 19, 15, 21, 1, 14, 67, 7537 }, // æ
+    { 11, 20, 13, 1, 14, 42, 7604 }, // ç
+    { 11, 21, 13, 1, 20, 47, 7646 }, // è
+    { 12, 21, 14, 1, 20, 49, 7693 }, // é
+    { 11, 21, 13, 1, 20, 49, 7742 }, // ê
+    { 11, 20, 13, 1, 19, 47, 7791 }, // ë
+    { 7, 20, 8, 0, 20, 29, 7838 }, // ì
+    { 9, 20, 10, 0, 20, 30, 7867 }, // í
+    { 9, 20, 10, 0, 20, 31, 7897 }, // î
+    { 9, 19, 10, 0, 19, 29, 7928 }, // ï
+    { 13, 21, 15, 1, 20, 58, 7957 }, // ð
+    { 14, 19, 15, 0, 19, 59, 8015 }, // ñ
+    { 12, 21, 14, 1, 20, 52, 8074 }, // ò
+    { 12, 21, 14, 1, 20, 51, 8126 }, // ó
+    { 12, 21, 14, 1, 20, 55, 8177 }, // ô
+    { 13, 20, 15, 1, 19, 59, 8232 }, // õ
+    { 12, 20, 14, 1, 19, 50, 8291 }, // ö
+    { 13, 12, 15, 1, 15, 25, 8341 }, // ÷
+    { 14, 16, 15, 0, 15, 57, 8366 }, // ø
+    { 13, 21, 15, 1, 20, 55, 8423 }, // ù
+    { 13, 21, 15, 1, 20, 56, 8478 }, // ú
+    { 13, 21, 15, 1, 20, 56, 8534 }, // û
+    { 13, 20, 15, 1, 19, 54, 8590 }, // ü
+    { 16, 26, 14, -3, 20, 65, 8644 }, // ý
+    { 15, 25, 15, -1, 19, 66, 8709 }, // þ
+    { 16, 25, 14, -3, 19, 64, 8775 }, // ÿ
+    { 16, 21, 15, -2, 21, 63, 8839 }, // Ā
+    { 13, 18, 15, 1, 17, 55, 8902 }, // ā
+    { 16, 23, 15, -2, 23, 70, 8957 }, // Ă
+    { 13, 20, 15, 1, 19, 60, 9027 }, // ă
+    { 15, 24, 14, -2, 18, 68, 9087 }, // Ą
+    { 13, 20, 15, 1, 14, 61, 9155 }, // ą
+    { 15, 25, 17, 1, 24, 49, 9216 }, // Ć
+    { 11, 21, 13, 1, 20, 40, 9265 }, // ć
+    { 15, 25, 17, 1, 24, 54, 9305 }, // Ĉ
+    { 11, 21, 13, 1, 20, 41, 9359 }, // ĉ
+    { 15, 24, 17, 1, 23, 49, 9400 }, // Ċ
+    { 11, 20, 13, 1, 19, 38, 9449 }, // ċ
+    { 15, 25, 17, 1, 24, 54, 9487 }, // Č
+    { 12, 21, 14, 1, 20, 45, 9541 }, // č
+    { 15, 24, 17, 1, 24, 67, 9586 }, // Ď
+    { 19, 20, 21, 1, 19, 68, 9653 }, // ď
+    { 16, 18, 17, 0, 18, 56, 9721 }, // Đ
+    { 16, 20, 18, 1, 19, 59, 9777 }, // đ
+    { 13, 21, 15, 1, 21, 47, 9836 }, // Ē
+    { 11, 18, 13, 1, 17, 43, 9883 }, // ē
+    { 13, 23, 15, 1, 23, 54, 9926 }, // Ĕ
+    { 12, 20, 14, 1, 19, 51, 9980 }, // ĕ
+    { 13, 23, 15, 1, 23, 50, 10031 }, // Ė
+    { 11, 20, 13, 1, 19, 46, 10081 }, // ė
+    { 13, 24, 15, 1, 18, 54, 10127 }, // Ę
+    { 11, 20, 13, 1, 14, 48, 10181 }, // ę
+    { 14, 24, 16, 1, 24, 56, 10229 }, // Ě
+    { 12, 21, 14, 1, 20, 51, 10285 }, // ě
+    { 16, 25, 18, 1, 24, 66, 10336 }, // Ĝ
+    { 14, 26, 15, 0, 20, 73, 10402 }, // ĝ
+    { 16, 24, 18, 1, 23, 66, 10475 }, // Ğ
+    { 14, 25, 15, 0, 19, 73, 10541 }, // ğ
+    { 16, 24, 18, 1, 23, 63, 10614 }, // Ġ
+    { 14, 25, 15, 0, 19, 68, 10677 }, // ġ
+    { 16, 25, 18, 1, 19, 65, 10745 }, // Ģ
+    { 14, 26, 15, 0, 20, 71, 10810 }, // ģ
+    { 17, 24, 19, 1, 24, 73, 10881 }, // Ĥ
+    { 14, 26, 15, 0, 26, 66, 10954 }, // ĥ
+    { 18, 18, 20, 1, 18, 61, 11020 }, // Ħ
+    { 14, 19, 15, 0, 19, 54, 11081 }, // ħ
+    { 13, 23, 13, -1, 23, 51, 11135 }, // Ĩ
+    { 10, 19, 11, 0, 19, 33, 11186 }, // ĩ
+    { 12, 21, 12, -1, 21, 43, 11219 }, // Ī
+    { 9, 17, 10, 0, 17, 27, 11262 }, // ī
+    { 12, 23, 12, -1, 23, 49, 11289 }, // Ĭ
+    { 10, 19, 11, 0, 19, 31, 11338 }, // ĭ
+    { 11, 24, 11, -1, 18, 41, 11369 }, // Į
+    { 8, 25, 8, -1, 19, 37, 11410 }, // į
+    { 11, 23, 11, -1, 23, 37, 11447 }, // İ
+    { 6, 14, 7, 0, 14, 22, 11484 }, // ı
+    { 17, 23, 17, -1, 18, 72, 11506 }, // Ĳ
+    { 14, 25, 15, 0, 19, 67, 11578 }, // ĳ
+    { 14, 29, 11, -4, 24, 59, 11645 }, // Ĵ
+    { 13, 26, 10, -4, 20, 50, 11704 }, // ĵ
+    { 16, 24, 18, 1, 18, 67, 11754 }, // Ķ
+    { 14, 25, 15, 0, 19, 65, 11821 }, // ķ
+    { 14, 14, 15, 0, 14, 44, 11886 }, // ĸ
+    { 10, 24, 12, 1, 24, 36, 11930 }, // Ĺ
+    { 11, 26, 12, 0, 26, 38, 11966 }, // ĺ
+    { 10, 24, 12, 1, 18, 36, 12004 }, // Ļ
+    { 8, 25, 8, -1, 19, 37, 12040 }, // ļ
+    { 12, 18, 14, 1, 18, 41, 12077 }, // Ľ
+    { 11, 19, 12, 0, 19, 35, 12118 }, // ľ
+    { 10, 18, 12, 1, 18, 33, 12153 }, // Ŀ
+    { 9, 19, 10, 0, 19, 34, 12186 }, // ŀ
+    { 11, 18, 12, 0, 18, 33, 12220 }, // Ł
+    { 8, 19, 9, 0, 19, 30, 12253 }, // ł
+    { 17, 24, 19, 1, 24, 85, 12283 }, // Ń
+    { 14, 20, 15, 0, 20, 56, 12368 }, // ń
+    { 17, 24, 19, 1, 18, 84, 12424 }, // Ņ
+    { 14, 20, 15, 0, 14, 58, 12508 }, // ņ
+    { 17, 24, 19, 1, 24, 86, 12566 }, // Ň
+    { 14, 20, 15, 0, 20, 58, 12652 }, // ň
+    { 15, 18, 17, 1, 18, 57, 12710 }, // ŉ
+    { 17, 23, 19, 1, 18, 84, 12767 }, // Ŋ
+    { 14, 20, 15, 0, 14, 56, 12851 }, // ŋ
+    { 17, 22, 19, 1, 21, 61, 12907 }, // Ō
+    { 12, 18, 14, 1, 17, 47, 12968 }, // ō
+    { 17, 24, 19, 1, 23, 68, 13015 }, // Ŏ
+    { 12, 20, 14, 1, 19, 54, 13083 }, // ŏ
+    { 18, 25, 20, 1, 24, 74, 13137 }, // Ő
+    { 14, 21, 16, 1, 20, 60, 13211 }, // ő
+    { 22, 20, 24, 1, 19, 69, 13271 }, // Œ
+    { 20, 15, 22, 1, 14, 68, 13340 }, // œ
+    { 14, 24, 16, 1, 24, 64, 13408 }, // Ŕ
+    { 12, 20, 13, 0, 20, 40, 13472 }, // ŕ
+    { 14, 24, 16, 1, 18, 64, 13512 }, // Ŗ
+    { 12, 20, 12, -1, 14, 43, 13576 }, // ŗ
+    { 14, 24, 16, 1, 24, 65, 13619 }, // Ř
+    { 13, 20, 14, 0, 20, 45, 13684 }, // ř
+    { 13, 25, 14, 0, 24, 54, 13729 }, // Ś
+    { 11, 21, 12, 0, 20, 39, 13783 }, // ś
+    { 13, 25, 14, 0, 24, 55, 13822 }, // Ŝ
+    { 11, 21, 12, 0, 20, 40, 13877 }, // ŝ
+    { 13, 25, 14, 0, 19, 57, 13917 }, // Ş
+    { 11, 20, 12, 0, 14, 42, 13974 }, // ş
+    { 14, 25, 15, 0, 24, 55, 14016 }, // Š
+    { 12, 21, 13, 0, 20, 43, 14071 }, // š
+    { 14, 24, 16, 1, 18, 52, 14114 }, // Ţ
+    { 10, 23, 11, 0, 17, 43, 14166 }, // ţ
+    { 13, 24, 16, 2, 24, 49, 14209 }, // Ť
+    { 11, 20, 13, 1, 19, 38, 14258 }, // ť
+    { 13, 18, 16, 2, 18, 38, 14296 }, // Ŧ
+    { 10, 18, 11, 0, 17, 34, 14334 }, // ŧ
+    { 17, 24, 19, 1, 23, 69, 14368 }, // Ũ
+    { 13, 20, 15, 1, 19, 57, 14437 }, // ũ
+    { 17, 22, 19, 1, 21, 61, 14494 }, // Ū
+    { 13, 18, 15, 1, 17, 51, 14555 }, // ū
+    { 17, 24, 19, 1, 23, 68, 14606 }, // Ŭ
+    { 13, 20, 15, 1, 19, 56, 14674 }, // ŭ
+    { 17, 26, 19, 1, 25, 73, 14730 }, // Ů
+    { 13, 22, 15, 1, 21, 61, 14803 }, // ů
+    { 17, 25, 19, 1, 24, 70, 14864 }, // Ű
+    { 15, 21, 17, 1, 20, 59, 14934 }, // ű
+    { 17, 24, 19, 1, 18, 67, 14993 }, // Ų
+    { 13, 20, 15, 1, 14, 58, 15060 }, // ų
+    { 22, 24, 25, 2, 24, 102, 15118 }, // Ŵ
+    { 19, 20, 21, 1, 20, 85, 15220 }, // ŵ
+    { 14, 24, 17, 2, 24, 57, 15305 }, // Ŷ
+    { 16, 26, 14, -3, 20, 67, 15362 }, // ŷ
+    { 14, 23, 17, 2, 23, 55, 15429 }, // Ÿ
+    { 16, 24, 16, -1, 24, 49, 15484 }, // Ź
+    { 13, 20, 13, -1, 20, 45, 15533 }, // ź
+    { 16, 23, 16, -1, 23, 47, 15578 }, // Ż
+    { 12, 19, 12, -1, 19, 40, 15625 }, // ż
+    { 16, 24, 16, -1, 24, 52, 15665 }, // Ž
+    { 13, 20, 13, -1, 20, 49, 15717 }, // ž
+    { 15, 26, 12, -4, 20, 53, 15766 }, // ſ
+    { 20, 20, 22, 1, 19, 62, 15819 }, // Ơ
+    { 16, 17, 18, 1, 16, 53, 15881 }, // ơ
+    { 24, 20, 26, 1, 19, 86, 15934 }, // Ƣ
+    { 18, 20, 20, 1, 14, 76, 16020 }, // ƣ
+    { 15, 18, 18, 2, 18, 51, 16096 }, // Ƥ
+    { 15, 26, 15, -1, 20, 67, 16147 }, // ƥ
+    { 13, 21, 15, 1, 18, 59, 16214 }, // Ʀ
+    { 14, 20, 15, 0, 19, 41, 16273 }, // Ƨ
+    { 11, 15, 12, 0, 14, 34, 16314 }, // ƨ
+    { 16, 18, 16, -1, 18, 38, 16348 }, // Ʃ
+    { 7, 26, 8, 0, 20, 43, 16386 }, // ƪ
+    { 9, 23, 11, 1, 17, 42, 16429 }, // ƫ
+    { 14, 18, 17, 2, 18, 40, 16471 }, // Ƭ
+    { 9, 21, 11, 1, 20, 37, 16511 }, // ƭ
+    { 13, 24, 16, 2, 18, 50, 16548 }, // Ʈ
+    { 21, 20, 23, 1, 19, 63, 16598 }, // Ư
+    { 18, 17, 20, 1, 16, 54, 16661 }, // ư
+    { 5, 5, 0, -10, 20, 6, 16715 }, // ̀
+    { 6, 5, 1, -6, 20, 8, 16721 }, // ́
+    { 9, 5, 7, -3, 20, 9, 16729 }, // ̂
+    { 10, 4, 0, -11, 19, 12, 16738 }, // ̃
+    { 8, 2, 7, -2, 17, 4, 16750 }, // ̄
+    { 11, 3, 9, -3, 22, 9, 16754 }, // ̅
+    { 8, 4, 7, -2, 19, 9, 16763 }, // ̆
+    { 4, 4, 5, 0, 19, 6, 16772 }, // ̇
+    { 8, 4, 7, -2, 19, 7, 16778 }, // ̈
+    { 6, 7, 0, -8, 21, 11, 16785 }, // ̉
+    { 7, 6, 7, -1, 21, 14, 16796 }, // ̊
+    { 10, 5, 9, -2, 20, 14, 16810 }, // ̋
+    { 9, 5, 8, -2, 20, 10, 16824 }, // ̌
+    { 4, 7, 5, 0, 19, 10, 16834 }, // ̍
+    { 8, 5, 7, -2, 19, 14, 16844 }, // ̎
+    { 10, 5, 0, -13, 20, 14, 16858 }, // ̏
+    { 9, 7, 8, -2, 22, 15, 16872 }, // ̐
+    { 8, 4, 7, -2, 19, 11, 16887 }, // ̑
+    { 6, 7, 6, -1, 18, 11, 16898 }, // ̒
+    { 6, 7, 6, -1, 18, 11, 16909 }, // ̓
+    { 4, 7, 5, 0, 18, 10, 16920 }, // ̔
+    { 6, 7, 6, -1, 18, 11, 16930 }, // ̕
+    { 5, 5, 1, -5, 0, 6, 16941 }, // ̖
+    { 6, 5, 3, -4, 0, 8, 16947 }, // ̗
+    { 6, 6, 2, -5, 0, 10, 16955 }, // ̘
+    { 6, 6, 2, -5, 0, 10, 16965 }, // ̙
+    { 8, 7, 11, 2, 19, 14, 16975 }, // ̚
+    { 6, 6, 6, -1, 19, 9, 16989 }, // ̛
+    { 5, 6, 4, -2, 0, 10, 16998 }, // ̜
+    { 6, 5, 2, -5, -1, 8, 17008 }, // ̝
+    { 7, 5, 3, -5, -1, 8, 17016 }, // ̞
+    { 6, 6, 2, -5, 0, 11, 17024 }, // ̟
+    { 6, 3, 2, -5, -2, 5, 17035 }, // ̠
+    { 6, 8, 2, -5, 2, 12, 17040 }, // ̡
+    { 5, 8, 3, -3, 2, 10, 17052 }, // ̢
+    { 4, 4, 0, -11, -1, 6, 17062 }, // ̣
+    { 8, 4, 3, -6, -1, 7, 17068 }, // ̤
+    { 6, 6, 2, -5, 0, 14, 17075 }, // ̥
+    { 5, 5, 7, 1, -1, 8, 17089 }, // ̦
+    { 6, 6, 2, -5, 0, 12, 17097 }, // ̧
+    { 5, 6, 2, -4, 0, 10, 17109 }, // ̨
+    { 4, 7, 1, -4, -1, 12, 17119 }, // ̩
+    { 10, 5, 4, -7, -1, 15, 17131 }, // ̪
+    { 11, 4, 5, -7, -1, 13, 17146 }, // ̫
+    { 9, 5, 4, -6, 0, 9, 17159 }, // ̬
+    { 8, 5, 3, -6, 0, 9, 17168 }, // ̭
+    { 9, 4, 4, -6, -1, 9, 17177 }, // ̮
+    { 8, 4, 3, -6, -1, 10, 17186 }, // ̯
+    { 10, 4, 4, -7, -1, 13, 17196 }, // ̰
+    { 8, 2, 3, -6, -2, 4, 17209 }, // ̱
+    { 12, 2, 5, -8, -2, 5, 17213 }, // ̲
+    { 12, 6, 5, -8, 0, 22, 17218 }, // ̳
+    { 10, 4, 6, -5, 9, 13, 17240 }, // ̴
+    { 10, 3, 6, -5, 9, 8, 17253 }, // ̵
+    { 18, 2, 10, -9, 8, 6, 17261 }, // ̶
+    { 8, 6, 5, -4, 10, 10, 17267 }, // ̷
+    { 14, 21, 8, -7, 19, 44, 17277 }, // ̸
+    { 4, 6, 3, -2, 0, 9, 17321 }, // ̹
+    { 10, 5, 4, -7, -1, 16, 17330 }, // ̺
+    { 10, 6, 4, -7, 0, 22, 17346 }, // ̻
+    { 10, 4, 4, -7, -1, 13, 17368 }, // ̼
+    { 7, 6, 7, -1, 20, 13, 17381 }, // ̽
+    { 6, 8, 6, -1, 22, 13, 17394 }, // ̾
+    { 12, 6, 10, -3, 25, 22, 17407 }, // ̿
+    { 6, 5, 5, -2, 20, 7, 17429 }, // ̀
+    { 7, 5, 8, 0, 20, 7, 17436 }, // ́
+    { 10, 4, 15, 4, 19, 14, 17443 }, // ͂
+    { 5, 5, 6, 0, 20, 8, 17457 }, // ̓
+    { 10, 5, 8, -3, 20, 14, 17465 }, // ̈́
+    { 4, 4, 2, -3, -2, 7, 17479 }, // ͅ
+    { 12, 6, 9, -4, 20, 17, 17486 }, // ͆
+    { 12, 6, 5, -8, 0, 22, 17503 }, // ͇
+    { 8, 5, 3, -6, -1, 13, 17525 }, // ͈
+    { 5, 5, 2, -4, -1, 9, 17538 }, // ͉
+    { 10, 6, 8, -3, 20, 15, 17547 }, // ͊
+    { 11, 10, 9, -3, 24, 22, 17562 }, // ͋
+    { 11, 7, 9, -3, 22, 22, 17584 }, // ͌
+    { 10, 6, 4, -7, 0, 12, 17606 }, // ͍
+    { 5, 6, 2, -4, 0, 9, 17618 }, // ͎
+    { 18, 18, 10, -9, 18, 75, 17627 }, // ͏
+    { 5, 6, 6, 0, 20, 8, 17702 }, // ͐
+    { 4, 6, 8, 3, 21, 10, 17710 }, // ͑
+    { 8, 7, 7, -2, 22, 15, 17720 }, // ͒
+    { 5, 6, 2, -4, 0, 11, 17735 }, // ͓
+    { 5, 5, 2, -4, -1, 8, 17746 }, // ͔
+    { 5, 5, 2, -4, -1, 9, 17754 }, // ͕
+    { 10, 5, 5, -6, -1, 18, 17763 }, // ͖
+    { 4, 6, 7, 2, 21, 9, 17781 }, // ͗
+    { 4, 4, 5, 0, 19, 6, 17790 }, // ͘
+    { 6, 6, 2, -5, 0, 11, 17796 }, // ͙
+    { 10, 6, 4, -7, 0, 20, 17807 }, // ͚
+    { 5, 6, 6, 0, 20, 9, 17827 }, // ͛
+    { 19, 5, 9, -11, -1, 20, 17836 }, // ͜
+    { 18, 5, 12, -7, 19, 19, 17856 }, // ͝
+    { 14, 2, 10, -5, 17, 5, 17875 }, // ͞
+    { 14, 2, 6, -9, -2, 5, 17880 }, // ͟
+    { 19, 4, 13, -7, 19, 19, 17885 }, // ͠
+    { 19, 6, 13, -7, 22, 21, 17904 }, // ͡
+    { 19, 6, 8, -12, 0, 19, 17925 }, // ͢
+    { 7, 6, 7, -1, 21, 16, 17944 }, // ͣ
+    { 5, 6, 6, 0, 21, 13, 17960 }, // ͤ
+    { 4, 8, 6, 1, 23, 9, 17973 }, // ͥ
+    { 7, 6, 7, -1, 21, 14, 17982 }, // ͦ
+    { 7, 6, 7, -1, 21, 16, 17996 }, // ͧ
+    { 6, 6, 7, 0, 21, 10, 18012 }, // ͨ
+    { 7, 9, 7, -1, 24, 19, 18022 }, // ͩ
+    { 7, 9, 7, -1, 24, 18, 18041 }, // ͪ
+    { 10, 6, 8, -3, 21, 24, 18059 }, // ͫ
+    { 6, 6, 7, 0, 21, 9, 18083 }, // ͬ
+    { 4, 8, 6, 1, 23, 12, 18092 }, // ͭ
+    { 6, 6, 7, 0, 21, 13, 18104 }, // ͮ
+    { 7, 6, 7, -1, 21, 13, 18117 }, // ͯ
+    { 15, 18, 14, -2, 18, 56, 18130 }, // Α
+    { 14, 18, 16, 1, 18, 56, 18186 }, // Β
+    { 13, 18, 15, 1, 18, 37, 18242 }, // Γ
+    { 16, 18, 15, -2, 18, 53, 18279 }, // Δ
+    { 13, 18, 15, 1, 18, 42, 18332 }, // Ε
+    { 16, 18, 16, -1, 18, 39, 18374 }, // Ζ
+    { 17, 18, 19, 1, 18, 61, 18413 }, // Η
+    { 17, 20, 19, 1, 19, 58, 18474 }, // Θ
+    { 11, 18, 11, -1, 18, 31, 18532 }, // Ι
+    { 16, 18, 18, 1, 18, 57, 18563 }, // Κ
+    { 15, 18, 14, -2, 18, 53, 18620 }, // Λ
+    { 21, 18, 23, 1, 18, 92, 18673 }, // Μ
+    { 17, 18, 19, 1, 18, 73, 18765 }, // Ν
+    { 16, 18, 16, -1, 18, 32, 18838 }, // Ξ
+    { 17, 20, 19, 1, 19, 56, 18870 }, // Ο
+    { 17, 18, 19, 1, 18, 54, 18926 }, // Π
+    { 14, 18, 16, 1, 18, 45, 18980 }, // Ρ
+    { 16, 18, 16, -1, 18, 38, 19025 }, // Σ
+    { 13, 18, 16, 2, 18, 37, 19063 }, // Τ
+    { 14, 18, 17, 2, 18, 46, 19100 }, // Υ
+    { 20, 18, 22, 1, 18, 70, 19146 }, // Φ
+    { 18, 18, 17, -2, 18, 54, 19216 }, // Χ
+    { 19, 18, 22, 2, 18, 70, 19270 }, // Ψ
+    { 18, 19, 18, -1, 19, 63, 19340 }, // Ω
+    { 13, 15, 15, 1, 14, 50, 19403 }, // α
+    { 16, 26, 16, -1, 20, 73, 19453 }, // β
+    { 11, 20, 13, 1, 14, 47, 19526 }, // γ
+    { 14, 21, 16, 1, 20, 57, 19573 }, // δ
+    { 11, 15, 12, 0, 14, 32, 19630 }, // ε
+    { 13, 25, 14, 0, 19, 55, 19662 }, // ζ
+    { 14, 20, 15, 0, 14, 58, 19717 }, // η
+    { 13, 21, 15, 1, 20, 57, 19775 }, // θ
+    { 6, 15, 8, 1, 14, 23, 19832 }, // ι
+    { 14, 14, 15, 0, 14, 44, 19855 }, // κ
+    { 13, 21, 13, -1, 20, 52, 19899 }, // λ
+    { 15, 20, 15, -1, 14, 57, 19951 }, // μ
+    { 11, 14, 13, 1, 14, 37, 20008 }, // ν
+    { 14, 25, 15, 0, 19, 51, 20045 }, // ξ
+    { 12, 15, 14, 1, 14, 42, 20096 }, // ο
+    { 15, 15, 17, 1, 14, 52, 20138 }, // π
+    { 14, 20, 14, -1, 14, 55, 20190 }, // ρ
+    { 11, 20, 13, 1, 14, 37, 20245 }, // ς
+    { 14, 15, 16, 1, 14, 50, 20282 }, // σ
+    { 11, 15, 13, 1, 14, 33, 20332 }, // τ
+    { 13, 15, 15, 1, 14, 44, 20365 }, // υ
+    { 16, 20, 18, 1, 14, 73, 20409 }, // φ
+    { 17, 20, 16, -2, 14, 59, 20482 }, // χ
+    { 16, 25, 18, 1, 19, 83, 20541 }, // ψ
+    { 18, 15, 20, 1, 14, 55, 20624 }, // ω
+    { 15, 23, 14, -2, 18, 64, 20679 }, // Ạ
+    { 13, 19, 15, 1, 14, 56, 20743 }, // ạ
+    { 15, 25, 14, -2, 25, 71, 20799 }, // Ả
+    { 13, 22, 15, 1, 21, 63, 20870 }, // ả
+    { 19, 25, 18, -2, 25, 78, 20933 }, // Ấ
+    { 16, 22, 18, 1, 21, 68, 21011 }, // ấ
+    { 16, 25, 15, -2, 25, 75, 21079 }, // Ầ
+    { 13, 22, 15, 1, 21, 66, 21154 }, // ầ
+    { 19, 26, 18, -2, 26, 81, 21220 }, // Ẩ
+    { 15, 23, 17, 1, 22, 68, 21301 }, // ẩ
+    { 18, 27, 17, -2, 27, 82, 21369 }, // Ẫ
+    { 14, 24, 16, 1, 23, 72, 21451 }, // ẫ
+    { 16, 29, 15, -2, 24, 78, 21523 }, // Ậ
+    { 13, 25, 15, 1, 20, 67, 21601 }, // ậ
+    { 16, 26, 15, -2, 26, 77, 21668 }, // Ắ
+    { 13, 23, 15, 1, 22, 65, 21745 }, // ắ
+    { 16, 26, 15, -2, 26, 76, 21810 }, // Ằ
+    { 13, 23, 15, 1, 22, 65, 21886 }, // ằ
+    { 16, 27, 15, -2, 27, 80, 21951 }, // Ẳ
+    { 13, 23, 15, 1, 22, 66, 22031 }, // ẳ
+    { 17, 27, 16, -2, 27, 82, 22097 }, // Ẵ
+    { 14, 24, 16, 1, 23, 72, 22179 }, // ẵ
+    { 16, 28, 15, -2, 23, 77, 22251 }, // Ặ
+    { 13, 24, 15, 1, 19, 67, 22328 }, // ặ
+    { 13, 23, 15, 1, 18, 50, 22395 }, // Ẹ
+    { 11, 19, 13, 1, 14, 45, 22445 }, // ẹ
+    { 13, 25, 15, 1, 25, 58, 22490 }, // Ẻ
+    { 11, 22, 13, 1, 21, 50, 22548 }, // ẻ
+    { 14, 23, 16, 1, 23, 55, 22598 }, // Ẽ
+    { 13, 20, 15, 1, 19, 54, 22653 }, // ẽ
+    { 16, 25, 18, 1, 25, 61, 22707 }, // Ế
+    { 15, 22, 17, 1, 21, 59, 22768 }, // ế
+    { 13, 25, 15, 1, 25, 59, 22827 }, // Ề
+    { 11, 22, 13, 1, 21, 55, 22886 }, // ề
+    { 15, 26, 17, 1, 26, 62, 22941 }, // Ể
+    { 14, 23, 16, 1, 22, 61, 23003 }, // ể
+    { 14, 27, 16, 1, 27, 64, 23064 }, // Ễ
+    { 13, 24, 15, 1, 23, 62, 23128 }, // ễ
+    { 13, 29, 15, 1, 24, 63, 23190 }, // Ệ
+    { 11, 25, 13, 1, 20, 55, 23253 }, // ệ
+    { 11, 25, 11, -1, 25, 43, 23308 }, // Ỉ
+    { 9, 21, 10, 0, 21, 32, 23351 }, // ỉ
+    { 11, 23, 11, -1, 18, 38, 23383 }, // Ị
+    { 8, 24, 8, -1, 19, 33, 23421 }, // ị
+    { 17, 24, 19, 1, 19, 64, 23454 }, // Ọ
+    { 12, 19, 14, 1, 14, 50, 23518 }, // ọ
+    { 17, 26, 19, 1, 25, 70, 23568 }, // Ỏ
+    { 12, 22, 14, 1, 21, 55, 23638 }, // ỏ
+    { 18, 26, 20, 1, 25, 74, 23693 }, // Ố
+    { 15, 22, 17, 1, 21, 62, 23767 }, // ố
+    { 17, 26, 19, 1, 25, 73, 23829 }, // Ồ
+    { 12, 22, 14, 1, 21, 59, 23902 }, // ồ
+    { 18, 27, 20, 1, 26, 77, 23961 }, // Ổ
+    { 14, 23, 16, 1, 22, 66, 24038 }, // ổ
+    { 17, 28, 19, 1, 27, 78, 24104 }, // Ỗ
+    { 13, 24, 15, 1, 23, 67, 24182 }, // ỗ
+    { 17, 29, 19, 1, 24, 77, 24249 }, // Ộ
+    { 12, 25, 14, 1, 20, 63, 24326 }, // ộ
+    { 20, 25, 22, 1, 24, 72, 24389 }, // Ớ
+    { 16, 21, 18, 1, 20, 60, 24461 }, // ớ
+    { 20, 25, 22, 1, 24, 72, 24521 }, // Ờ
+    { 16, 21, 18, 1, 20, 61, 24593 }, // ờ
+    { 20, 26, 22, 1, 25, 77, 24654 }, // Ở
+    { 16, 22, 18, 1, 21, 65, 24731 }, // ở
+    { 20, 24, 22, 1, 23, 75, 24796 }, // Ỡ
+    { 16, 20, 18, 1, 19, 65, 24871 }, // ỡ
+    { 20, 24, 22, 1, 19, 70, 24936 }, // Ợ
+    { 16, 21, 18, 1, 16, 60, 25006 }, // ợ
+    { 17, 23, 19, 1, 18, 63, 25066 }, // Ụ
+    { 13, 19, 15, 1, 14, 53, 25129 }, // ụ
+    { 17, 26, 19, 1, 25, 69, 25182 }, // Ủ
+    { 13, 22, 15, 1, 21, 59, 25251 }, // ủ
+    { 21, 25, 23, 1, 24, 74, 25310 }, // Ứ
+    { 18, 21, 20, 1, 20, 63, 25384 }, // ứ
+    { 21, 25, 23, 1, 24, 74, 25447 }, // Ừ
+    { 18, 21, 20, 1, 20, 62, 25521 }, // ừ
+    { 21, 26, 23, 1, 25, 78, 25583 }, // Ử
+    { 18, 22, 20, 1, 21, 66, 25661 }, // ử
+    { 21, 24, 23, 1, 23, 76, 25727 }, // Ữ
+    { 18, 20, 20, 1, 19, 66, 25803 }, // ữ
+    { 21, 24, 23, 1, 19, 73, 25869 }, // Ự
+    { 18, 21, 20, 1, 16, 61, 25942 }, // ự
+    { 14, 24, 17, 2, 24, 56, 26003 }, // Ỳ
+    { 16, 26, 14, -3, 20, 64, 26059 }, // ỳ
+    { 14, 23, 17, 2, 18, 54, 26123 }, // Ỵ
+    { 16, 20, 14, -3, 14, 58, 26177 }, // ỵ
+    { 14, 25, 17, 2, 25, 62, 26235 }, // Ỷ
+    { 16, 27, 14, -3, 21, 69, 26297 }, // ỷ
+    { 14, 23, 17, 2, 23, 59, 26366 }, // Ỹ
+    { 16, 25, 14, -3, 19, 67, 26425 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 26492 }, //  
+    { 0, 0, 25, 0, 0, 0, 26492 }, //  
+    { 0, 0, 13, 0, 0, 0, 26492 }, //  
+    { 0, 0, 25, 0, 0, 0, 26492 }, //  
+    { 0, 0, 8, 0, 0, 0, 26492 }, //  
+    { 0, 0, 6, 0, 0, 0, 26492 }, //  
+    { 0, 0, 4, 0, 0, 0, 26492 }, //  
+    { 0, 0, 14, 0, 0, 0, 26492 }, //  
+    { 0, 0, 6, 0, 0, 0, 26492 }, //  
+    { 0, 0, 4, 0, 0, 0, 26492 }, //  
+    { 0, 0, 3, 0, 0, 0, 26492 }, //  
+    { 0, 0, 1, 0, 0, 0, 26492 }, // ​
+    { 0, 0, 1, 0, 0, 0, 26492 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 26492 }, // ‍
+    { 7, 22, 7, -1, 18, 35, 26492 }, // ‎
+    { 7, 22, 2, -6, 18, 35, 26527 }, // ‏
+    { 7, 3, 8, 0, 8, 9, 26562 }, // ‐
+    { 7, 3, 8, 0, 8, 9, 26571 }, // ‑
+    { 13, 2, 15, 1, 10, 5, 26580 }, // ‒
+    { 12, 3, 13, 0, 8, 13, 26585 }, // –
+    { 24, 3, 25, 0, 8, 27, 26598 }, // —
+    { 24, 3, 25, 0, 8, 27, 26625 }, // ―
+    { 9, 26, 14, 3, 19, 76, 26652 }, // ‖
+    { 12, 6, 10, -3, 0, 23, 26728 }, // ‗
+    { 6, 7, 8, 1, 18, 11, 26751 }, // ‘
+    { 6, 7, 8, 1, 18, 11, 26762 }, // ’
+    { 6, 7, 6, -2, 3, 10, 26773 }, // ‚
+    { 4, 7, 7, 2, 18, 9, 26783 }, // ‛
+    { 11, 7, 13, 1, 18, 21, 26792 }, // “
+    { 11, 7, 13, 1, 18, 21, 26813 }, // ”
+    { 11, 7, 11, -2, 3, 19, 26834 }, // „
+    { 8, 7, 11, 2, 18, 21, 26853 }, // ‟
+    { 10, 19, 13, 2, 19, 31, 26874 }, // †
+    { 13, 19, 14, 0, 19, 46, 26905 }, // ‡
+    { 6, 7, 9, 2, 13, 11, 26951 }, // •
+    { 8, 8, 10, 1, 13, 14, 26962 }, // ‣
+    { 4, 5, 13, 3, 4, 6, 26976 }, // ․
+    { 10, 5, 13, 0, 4, 12, 26982 }, // ‥
+    { 17, 5, 19, 0, 4, 18, 26994 }, // …
+    { 4, 5, 6, 1, 9, 6, 27012 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 27018 }, //  
+    { 0, 0, 15, 0, 0, 0, 27018 }, //  
+    { 7, 20, 7, -1, 16, 29, 27018 }, // ‪
+    { 7, 20, 2, -6, 16, 29, 27047 }, // ‫
+    { 6, 22, 4, -3, 18, 28, 27076 }, // ‬
+    { 6, 22, 4, -3, 18, 29, 27104 }, // ‭
+    { 6, 22, 4, -3, 18, 29, 27133 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 27162 }, //  
+    { 26, 20, 29, 2, 19, 120, 27162 }, // ‰
+    { 34, 20, 37, 2, 19, 153, 27282 }, // ‱
+    { 7, 7, 9, 1, 18, 10, 27435 }, // ′
+    { 11, 7, 13, 1, 18, 21, 27445 }, // ″
+    { 15, 7, 17, 1, 18, 32, 27466 }, // ‴
+    { 4, 7, 8, 3, 18, 11, 27498 }, // ‵
+    { 8, 7, 12, 3, 18, 22, 27509 }, // ‶
+    { 12, 7, 16, 3, 18, 33, 27531 }, // ‷
+    { 10, 9, 10, -3, 3, 21, 27564 }, // ‸
+    { 6, 11, 8, 1, 12, 17, 27585 }, // ‹
+    { 7, 11, 8, 0, 12, 17, 27602 }, // ›
+    { 19, 20, 21, 1, 19, 74, 27619 }, // ※
+    { 13, 19, 14, 0, 18, 53, 27693 }, // ‼
+    { 11, 20, 13, 1, 19, 40, 27746 }, // ‽
+    { 11, 2, 14, 2, 21, 8, 27786 }, // ‾
+    { 14, 6, 14, -2, 0, 18, 27794 }, // ‿
+    { 13, 6, 16, 2, 20, 17, 27812 }, // ⁀
+    { 12, 17, 10, -3, 11, 37, 27829 }, // ⁁
+    { 27, 24, 28, 0, 20, 110, 27866 }, // ⁂
+    { 7, 3, 8, 0, 8, 9, 27976 }, // ⁃
+    { 16, 18, 11, -6, 18, 38, 27985 }, // ⁄
+    { 11, 22, 11, -1, 18, 36, 28023 }, // ⁅
+    { 10, 22, 9, -2, 18, 35, 28059 }, // ⁆
+    { 22, 20, 24, 1, 19, 65, 28094 }, // ⁇
+    { 17, 20, 19, 1, 19, 59, 28159 }, // ⁈
+    { 18, 20, 19, 0, 19, 62, 28218 }, // ⁉
+    { 13, 14, 15, 1, 14, 39, 28280 }, // ⁊
+    { 13, 23, 16, 2, 19, 71, 28319 }, // ⁋
+    { 13, 14, 16, 1, 14, 39, 28390 }, // ⁌
+    { 13, 14, 16, 2, 14, 42, 28429 }, // ⁍
+    { 13, 13, 14, -1, 7, 32, 28471 }, // ⁎
+    { 6, 18, 7, 0, 14, 18, 28503 }, // ⁏
+    { 17, 26, 16, -2, 20, 51, 28521 }, // ⁐
+    { 15, 26, 16, 0, 20, 67, 28572 }, // ⁑
+    { 10, 20, 11, 0, 19, 39, 28639 }, // ⁒
+    { 22, 5, 25, 2, 10, 25, 28678 }, // ⁓
+    { 14, 6, 14, -3, 0, 18, 28703 }, // ⁔
+    { 14, 14, 15, 0, 13, 44, 28721 }, // ⁕
+    { 11, 20, 13, 1, 19, 26, 28765 }, // ⁖
+    { 19, 7, 21, 1, 18, 42, 28791 }, // ⁗
+    { 19, 20, 21, 1, 19, 40, 28833 }, // ⁘
+    { 19, 20, 21, 1, 19, 44, 28873 }, // ⁙
+    { 4, 20, 6, 1, 19, 13, 28917 }, // ⁚
+    { 15, 20, 17, 1, 19, 35, 28930 }, // ⁛
+    { 19, 20, 20, 0, 19, 56, 28965 }, // ⁜
+    { 4, 19, 7, 1, 18, 17, 29021 }, // ⁝
+    { 4, 20, 7, 2, 19, 22, 29038 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 29060 }, //  
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 29060 }, // ⁩
+    { 6, 22, 4, -3, 18, 31, 29060 }, // ⁪
+    { 6, 22, 4, -3, 18, 28, 29091 }, // ⁫
+    { 6, 22, 4, -3, 18, 31, 29119 }, // ⁬
+    { 6, 22, 4, -3, 18, 31, 29150 }, // ⁭
+    { 6, 22, 4, -3, 18, 34, 29181 }, // ⁮
+    { 6, 22, 4, -3, 18, 31, 29215 }, // ⁯
+    { 9, 12, 12, 2, 22, 33, 29246 }, // ⁰
+    { 4, 12, 7, 2, 19, 15, 29279 }, // ⁱ
+    { 9, 12, 11, 1, 22, 24, 29294 }, // ⁴
+    { 9, 12, 12, 2, 22, 25, 29318 }, // ⁵
+    { 9, 12, 12, 2, 22, 30, 29343 }, // ⁶
+    { 9, 12, 12, 2, 22, 20, 29373 }, // ⁷
+    { 9, 12, 12, 2, 22, 32, 29393 }, // ⁸
+    { 9, 12, 12, 2, 22, 29, 29425 }, // ⁹
+    { 8, 8, 11, 2, 19, 14, 29454 }, // ⁺
+    { 8, 2, 11, 2, 16, 6, 29468 }, // ⁻
+    { 8, 5, 11, 2, 18, 9, 29474 }, // ⁼
+    { 7, 14, 10, 2, 23, 20, 29483 }, // ⁽
+    { 6, 14, 7, 0, 23, 23, 29503 }, // ⁾
+    { 9, 9, 11, 1, 16, 26, 29526 }, // ⁿ
+    { 9, 12, 9, -1, 8, 32, 29552 }, // ₀
+    { 6, 12, 9, 0, 8, 18, 29584 }, // ₁
+    { 9, 12, 9, -2, 8, 23, 29602 }, // ₂
+    { 8, 12, 9, -1, 8, 26, 29625 }, // ₃
+    { 9, 12, 9, -1, 8, 26, 29651 }, // ₄
+    { 9, 12, 9, -1, 8, 24, 29677 }, // ₅
+    { 9, 12, 9, -1, 8, 30, 29701 }, // ₆
+    { 9, 12, 9, -1, 8, 21, 29731 }, // ₇
+    { 9, 12, 9, -1, 8, 31, 29752 }, // ₈
+    { 9, 12, 9, -1, 8, 28, 29783 }, // ₉
+    { 8, 8, 8, -1, 6, 15, 29811 }, // ₊
+    { 8, 2, 8, -1, 3, 6, 29826 }, // ₋
+    { 8, 5, 8, -1, 5, 9, 29832 }, // ₌
+    { 6, 14, 7, 0, 9, 19, 29841 }, // ₍
+    { 6, 14, 5, -3, 9, 22, 29860 }, // ₎
+    { 9, 9, 9, -1, 6, 27, 29882 }, // ₐ
+    { 8, 9, 8, -1, 6, 22, 29909 }, // ₑ
+    { 9, 9, 9, -1, 6, 26, 29931 }, // ₒ
+    { 9, 9, 8, -2, 6, 24, 29957 }, // ₓ
+    { 7, 9, 8, -1, 6, 22, 29981 }, // ₔ
+    { 9, 12, 11, 0, 9, 33, 30003 }, // ₕ
+    { 9, 12, 10, 0, 9, 30, 30036 }, // ₖ
+    { 5, 12, 6, 0, 9, 18, 30066 }, // ₗ
+    { 14, 9, 16, 0, 6, 44, 30084 }, // ₘ
+    { 9, 9, 9, -1, 6, 28, 30128 }, // ₙ
+    { 10, 12, 9, -2, 6, 35, 30156 }, // ₚ
+    { 7, 9, 8, -1, 6, 22, 30191 }, // ₛ
+    { 6, 11, 6, -1, 8, 20, 30213 }, // ₜ
+    { 14, 19, 16, 1, 19, 49, 30233 }, // ₠
+    { 14, 21, 16, 1, 19, 75, 30282 }, // ₡
+    { 14, 20, 16, 1, 19, 51, 30357 }, // ₢
+    { 15, 18, 16, 0, 18, 43, 30408 }, // ₣
+    { 16, 19, 16, -1, 19, 46, 30451 }, // ₤
+    { 21, 20, 22, 0, 17, 86, 30497 }, // ₥
+    { 15, 18, 16, 0, 18, 68, 30583 }, // ₦
+    { 18, 19, 19, 0, 18, 65, 30651 }, // ₧
+    { 21, 19, 22, 0, 18, 80, 30716 }, // ₨
+    { 18, 18, 19, 0, 18, 82, 30796 }, // ₩
+    { 21, 18, 22, 0, 18, 98, 30878 }, // ₪
+    { 17, 23, 18, 0, 19, 66, 30976 }, // ₫
+    { 16, 20, 17, 0, 19, 46, 31042 }, // €
+    { 17, 18, 18, 0, 18, 59, 31088 }, // ₭
+    { 14, 18, 16, 1, 18, 43, 31147 }, // ₮
+    { 24, 25, 25, 0, 19, 98, 31190 }, // ₯
+    { 16, 25, 15, -2, 19, 73, 31288 }, // ₰
+    { 16, 18, 17, 0, 18, 55, 31361 }, // ₱
+    { 16, 21, 18, 1, 19, 75, 31416 }, // ₲
+    { 17, 18, 16, -2, 18, 60, 31491 }, // ₳
+    { 15, 20, 15, -1, 19, 51, 31551 }, // ₴
+    { 15, 21, 17, 1, 19, 60, 31602 }, // ₵
+    { 16, 18, 17, 0, 17, 57, 31662 }, // ₶
+    { 18, 21, 18, -1, 19, 72, 31719 }, // ₷
+    { 14, 18, 16, 1, 18, 36, 31791 }, // ₸
+    { 13, 18, 16, 2, 18, 42, 31827 }, // ₹
+    { 14, 19, 15, 0, 18, 52, 31869 }, // ₺
+    { 16, 20, 18, 1, 19, 69, 31921 }, // ₻
+    { 19, 18, 19, -1, 18, 62, 31990 }, // ₼
+    { 16, 18, 16, -1, 18, 53, 32052 }, // ₽
+    { 17, 21, 17, -1, 21, 61, 32105 }, // ₾
+    { 13, 24, 15, 1, 21, 71, 32166 }, // ₿
+    { 7, 3, 8, 0, 8, 9, 32237 }, // −
+    { 23, 23, 25, 1, 19, 76, 32246 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
@@ -3481,4 +2842,5 @@ static const EpdFontData notosans_12_italic = {
     27,
     -8,
     true,
+    true,
 };
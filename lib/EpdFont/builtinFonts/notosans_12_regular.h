@@ -2,3270 +2,2775 @@
  * generated by fontconvert.py
  * name: notosans_12_regular
  * size: 12
- * mode: 2-bit
- * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_12_regular 12 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_regularBitmaps[39630] = {
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x3E,
-    0x3F, 0x3E, 0x04, 0x7C, 0x2D, 0x7C, 0x2D, 0x3C, 0x2D, 0x38, 0x2D, 0x38, 0x1C, 0x38, 0x1C, 0x24,
-    0x08, 0x00, 0x0B, 0x01, 0xC0, 0x00, 0x0E, 0x02, 0xC0, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0x1D, 0x03,
-    0x80, 0x00, 0x2C, 0x03, 0x80, 0x0A, 0xBE, 0xAB, 0xA9, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x0F,
-    0x00, 0x00, 0x74, 0x0E, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00, 0xF0, 0x1D, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xD0, 0x3C, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x02, 0xC0, 0x74,
-    0x00, 0x03, 0xC0, 0xB0, 0x00, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x01,
-    0xBF, 0x90, 0x1F, 0xFF, 0xFC, 0x3E, 0x6C, 0x68, 0x7C, 0x2C, 0x00, 0x7C, 0x2C, 0x00, 0x7C, 0x2C,
-    0x00, 0x3F, 0xBC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x2D, 0xFD, 0x00, 0x2C, 0x2F,
-    0x00, 0x2C, 0x1F, 0x00, 0x2C, 0x2F, 0x79, 0x2D, 0xBD, 0x7F, 0xFF, 0xF4, 0x1A, 0xBE, 0x40, 0x00,
-    0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xB0, 0x03, 0xEB, 0x80, 0x07, 0x80, 0x1D, 0x0B, 0x00, 0x3C, 0x00, 0xB0, 0x1D, 0x01, 0xD0, 0x02,
-    0xC0, 0x38, 0x0F, 0x00, 0x0F, 0x00, 0xE0, 0xB4, 0x00, 0x2C, 0x03, 0x83, 0xC0, 0x00, 0xB0, 0x1D,
-    0x2C, 0x2F, 0x81, 0xE0, 0xB1, 0xE3, 0xEF, 0x83, 0xEB, 0xCF, 0x1E, 0x0F, 0x03, 0xF8, 0x78, 0xB0,
-    0x1D, 0x00, 0x03, 0xC3, 0xC0, 0x74, 0x00, 0x1D, 0x0F, 0x01, 0xE0, 0x00, 0xF0, 0x3C, 0x07, 0x80,
-    0x0B, 0x40, 0xB0, 0x1D, 0x00, 0x3C, 0x01, 0xD0, 0xB0, 0x02, 0xC0, 0x03, 0xDB, 0xC0, 0x1E, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x07, 0xFB, 0xF4, 0x00, 0x00, 0xF8, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x07,
-    0xC0, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xEF, 0x40, 0x0F, 0x03, 0xF0, 0x7E, 0x01, 0xE0, 0x7C, 0x01, 0xF8,
-    0x3D, 0x0B, 0x80, 0x07, 0xE7, 0xC0, 0xB8, 0x00, 0x1F, 0xF4, 0x0B, 0xC0, 0x00, 0xBF, 0x00, 0x3E,
-    0x00, 0x2F, 0xF8, 0x02, 0xFF, 0xBF, 0xD7, 0xE0, 0x07, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0xF3, 0xCE, 0x38, 0xE2, 0x40, 0x02, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x3D, 0x03, 0xC0,
-    0x7C, 0x0B, 0x80, 0xF4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF4, 0x0F, 0x40, 0xB8, 0x0B, 0xC0, 0x3C,
-    0x03, 0xD0, 0x2F, 0x00, 0xF0, 0x07, 0xC0, 0x2D, 0x3C, 0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x03,
-    0xD0, 0x0B, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xE0, 0x1F, 0x00, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF,
-    0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0xAA, 0xBE, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x3D, 0x3C, 0x7C, 0xB4, 0xF0,
-    0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x03, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x40,
-    0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1E,
-    0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0xFF, 0xFF, 0x00, 0xBC, 0x03, 0xE0, 0x3D, 0x00, 0x3C, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x01, 0xF2,
-    0xE0, 0x00, 0x7C, 0xB4, 0x00, 0x0F, 0x3D, 0x00, 0x03, 0xCF, 0x40, 0x00, 0xF2, 0xD0, 0x00, 0x3C,
-    0xB8, 0x00, 0x1F, 0x1E, 0x00, 0x07, 0xC7, 0xC0, 0x02, 0xE0, 0xF4, 0x00, 0xF4, 0x1F, 0x00, 0xBC,
-    0x03, 0xFA, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0B, 0xF0, 0xFF, 0xDF,
-    0x9F, 0x74, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00,
-    0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x3F, 0xFF, 0xF0, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x7F, 0xFF, 0xF4, 0x38, 0x00, 0xBC, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x03, 0xFF,
-    0x40, 0x02, 0xBF, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x3E, 0x80, 0x00, 0xBC, 0xFE, 0xAB, 0xF4, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7B, 0xC0, 0x00, 0x0F, 0x3C,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0xB8, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x00, 0xB4,
-    0x03, 0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xF8, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x50, 0x00, 0xBC, 0x7F, 0xAF,
-    0xF4, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x2F, 0xFB,
-    0x80, 0x2F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x78, 0xBF, 0xE0, 0x2E, 0xFA, 0xBF, 0x0B, 0xE0, 0x03, 0xE2, 0xF0, 0x00, 0x7C, 0xB8, 0x00,
-    0x0F, 0x1E, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF0, 0xF4, 0x00, 0x7C, 0x1F, 0x00, 0x3D, 0x02, 0xFA,
-    0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0xFE, 0xBF, 0x40, 0xF8, 0x01, 0xF0,
-    0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x0B, 0x43, 0xD0, 0x03, 0xC0, 0xBC, 0x02, 0xE0, 0x0B, 0xE7, 0xE0,
-    0x00, 0xBF, 0xE0, 0x00, 0x7E, 0xFE, 0x00, 0xBC, 0x07, 0xF0, 0x7C, 0x00, 0x3E, 0x2E, 0x00, 0x07,
-    0xCF, 0x40, 0x00, 0xF2, 0xE0, 0x00, 0x7C, 0x7C, 0x00, 0x3E, 0x0B, 0xEA, 0xBF, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x3E, 0x00, 0xF8,
-    0x7C, 0x00, 0x3C, 0xB8, 0x00, 0x2E, 0xB4, 0x00, 0x1F, 0xB4, 0x00, 0x0F, 0xB8, 0x00, 0x2F, 0x7C,
-    0x00, 0x7F, 0x2F, 0x96, 0xEF, 0x0B, 0xFF, 0x5F, 0x00, 0x50, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF0, 0x1A, 0xAF, 0xC0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x3F, 0x3F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x0A,
-    0x43, 0xF0, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x07,
-    0xC2, 0xE0, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0x40, 0x02,
-    0xF8, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x0B,
-    0xFF, 0xFD, 0x09, 0x00, 0xBC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8,
-    0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xD0, 0x00, 0x07, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0xBD,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x2F, 0xF9, 0x07,
-    0x42, 0xC0, 0x3F, 0xAF, 0x80, 0xE0, 0xF0, 0x3D, 0x01, 0xD0, 0x3C, 0x74, 0x0F, 0x00, 0x74, 0x0B,
-    0x1D, 0x07, 0x80, 0x2D, 0x02, 0xCB, 0x42, 0xD0, 0x0B, 0x40, 0xF2, 0xD0, 0x74, 0x03, 0xD0, 0x38,
-    0x74, 0x1F, 0x00, 0xF4, 0x1D, 0x1E, 0x03, 0xE5, 0xEF, 0x5F, 0x03, 0xC0, 0x3F, 0xE0, 0xFF, 0x00,
-    0xB4, 0x00, 0x40, 0x04, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x00, 0x00,
-    0x1F, 0xE9, 0x6B, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xFE, 0x90, 0x2F, 0xFF, 0xFF, 0x0B, 0x80,
-    0x0B, 0xF2, 0xE0, 0x00, 0x7C, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xCB, 0x80, 0x01, 0xF2, 0xF5,
-    0x56, 0xF0, 0xBF, 0xFF, 0xE0, 0x2F, 0xAA, 0xBF, 0x4B, 0x80, 0x01, 0xF6, 0xE0, 0x00, 0x2E, 0xB8,
-    0x00, 0x0B, 0xEE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xFA, 0xE0, 0x00, 0xFD, 0xBF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD,
-    0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x90, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0x80, 0x1B, 0xF4, 0x2E, 0x00, 0x02, 0xF4, 0xB8, 0x00, 0x03,
-    0xF2, 0xE0, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0xBA,
-    0xE0, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x0F, 0xAE, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x01, 0xF2, 0xE0,
-    0x00, 0x0F, 0xCB, 0x80, 0x00, 0xBC, 0x2E, 0x00, 0x1F, 0xD0, 0xBF, 0xFF, 0xFD, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54, 0xBF, 0xFF, 0xF2, 0xFA, 0xAA, 0x8B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBE, 0xAA, 0xA2, 0xFF, 0xFF, 0xCB,
-    0xD5, 0x55, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00,
-    0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00,
-    0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F,
-    0x2F, 0x55, 0x55, 0x7C, 0xBF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAB, 0xCB, 0x80, 0x00, 0x0F, 0x2E,
-    0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00,
-    0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xC0, 0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x00, 0xB4, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00,
-    0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x3D, 0x47, 0xF3, 0xFF,
-    0x4A, 0xA0, 0x00, 0x78, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x1F,
-    0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0xF4, 0x00, 0xB8, 0x3D, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBB,
-    0xF8, 0x00, 0x0B, 0xFB, 0xD0, 0x00, 0xBD, 0x2F, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0xB8, 0x07, 0xD0,
-    0x0B, 0x80, 0x2F, 0x00, 0xB8, 0x00, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80,
-    0x00, 0xBC, 0x78, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFD, 0x00, 0x00, 0x2F, 0xDB, 0xF8, 0x00,
-    0x00, 0xFF, 0x6E, 0xF0, 0x00, 0x07, 0xBD, 0xB7, 0xD0, 0x00, 0x2D, 0xF6, 0xD7, 0xC0, 0x00, 0xF3,
-    0xDB, 0x4F, 0x00, 0x07, 0x8F, 0x6E, 0x2E, 0x00, 0x3C, 0x3D, 0xB8, 0x7C, 0x01, 0xF0, 0xF6, 0xE0,
-    0xF4, 0x0B, 0x43, 0xDB, 0x82, 0xE0, 0x3C, 0x0F, 0x6E, 0x03, 0xC1, 0xE0, 0x3D, 0xB8, 0x0F, 0x4F,
-    0x40, 0xF6, 0xE0, 0x1F, 0x3C, 0x03, 0xDB, 0x80, 0x3E, 0xD0, 0x0F, 0x6E, 0x00, 0xBF, 0x00, 0x3D,
-    0xB8, 0x01, 0xF8, 0x00, 0xF6, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00,
-    0x02, 0xEB, 0xF8, 0x00, 0x0B, 0xAE, 0xF0, 0x00, 0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xD0, 0x02,
-    0xEB, 0x47, 0xC0, 0x0B, 0xAD, 0x0F, 0xC0, 0x2E, 0xB8, 0x0F, 0x40, 0xBA, 0xE0, 0x2F, 0x02, 0xEB,
-    0x80, 0x3E, 0x0B, 0xAE, 0x00, 0x3D, 0x2E, 0xB8, 0x00, 0xBC, 0x7A, 0xE0, 0x00, 0xF9, 0xEB, 0x80,
-    0x01, 0xFB, 0xAE, 0x00, 0x02, 0xFE, 0xB8, 0x00, 0x03, 0xFA, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F,
-    0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F,
-    0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00,
-    0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00,
-    0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8, 0x01, 0xFC, 0xB8, 0x00, 0x3E, 0xB8,
-    0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x3D, 0xB8, 0x01, 0xFC, 0xBF, 0xFF,
-    0xF0, 0xBF, 0xFE, 0x40, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B,
-    0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x7F,
-    0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F,
-    0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF,
-    0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40,
-    0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC, 0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00,
-    0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00,
-    0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x7A,
-    0xF0, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xD0, 0x3C,
-    0x00, 0x1F, 0x00, 0xB8, 0x00, 0xB8, 0x01, 0xF0, 0x03, 0xD0, 0x03, 0xD0, 0x1F, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF3, 0xC0,
-    0x00, 0x03, 0xEF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0xB8, 0x00, 0x0B, 0x80, 0x00, 0x79, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE3, 0xD0, 0x01, 0xFD, 0x00,
-    0x0F, 0x4F, 0x80, 0x0B, 0xB8, 0x00, 0x7C, 0x2F, 0x00, 0x3D, 0xF0, 0x02, 0xF0, 0x7C, 0x00, 0xF3,
-    0xD0, 0x0F, 0x80, 0xF4, 0x07, 0x8B, 0x80, 0x3C, 0x03, 0xE0, 0x3D, 0x0F, 0x01, 0xF0, 0x07, 0xC0,
-    0xF0, 0x3C, 0x0B, 0x80, 0x0F, 0x07, 0xC0, 0xB8, 0x3D, 0x00, 0x3D, 0x2D, 0x01, 0xF0, 0xF0, 0x00,
-    0xB8, 0xF0, 0x03, 0xC7, 0xC0, 0x01, 0xF3, 0xC0, 0x0B, 0x6E, 0x00, 0x03, 0xDE, 0x00, 0x1E, 0xB4,
-    0x00, 0x0F, 0xB4, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0xBC, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0xB8, 0x01, 0xF0, 0x07, 0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0x07,
-    0xDF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xEF,
-    0x00, 0x00, 0x3E, 0x3D, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0xB8, 0x00, 0xF4,
-    0x07, 0xC0, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x07, 0xC0, 0xB8, 0x00, 0x01, 0xF1,
-    0xF0, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0xBC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0x0F,
-    0x40, 0xF0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xEF, 0xFE,
-    0xB4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x3C, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x7F, 0xF1, 0xFF,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F,
-    0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C,
-    0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0x6D, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x1E, 0x0B, 0x40, 0x03, 0xC0, 0x3C, 0x00, 0x78, 0x02, 0xD0,
-    0x0B, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0xB4, 0x2D, 0x00, 0x03, 0xC1, 0x40, 0x00, 0x04, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x02, 0x80, 0x00, 0x6A, 0x40,
-    0x3F, 0xFF, 0xC0, 0xE4, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F, 0xFF,
-    0xCB, 0xFA, 0xAF, 0x7D, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF,
-    0xBC, 0x7F, 0xF4, 0xB0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x6A, 0x40, 0xF7, 0xFF, 0xE0, 0xFF, 0x41, 0xFC, 0xFC,
-    0x00, 0x3D, 0xF8, 0x00, 0x2E, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E, 0xFD, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF1, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00,
-    0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFA, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x1A, 0x43,
-    0xD0, 0x7F, 0xFD, 0xF4, 0x7E, 0x47, 0xFD, 0x3E, 0x00, 0x3F, 0x5F, 0x00, 0x07, 0xD7, 0xC0, 0x00,
-    0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F,
-    0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
-    0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x01, 0xFE, 0xD0, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0xD5, 0x0B, 0xFF, 0xF4, 0x17,
-    0xD5, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x69, 0x01,
-    0x01, 0xFF, 0xF6, 0xD1, 0xF9, 0x1F, 0xF4, 0xF8, 0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x5F, 0x00, 0x03,
-    0xDB, 0x80, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD3, 0xC0, 0x01,
-    0xF4, 0xFC, 0x00, 0xFD, 0x0F, 0xEA, 0xFF, 0x40, 0xBF, 0xE3, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x1F, 0x05, 0x00, 0x1F, 0x82, 0xFF, 0xFF, 0x80, 0x2F, 0xFE, 0x40, 0xF4, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x2A, 0x40,
-    0xF6, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x04, 0x3D, 0x3D, 0x04, 0x00, 0x14, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x10, 0x03, 0xD0, 0x0F, 0x40,
-    0x04, 0x00, 0x00, 0x01, 0x40, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00,
-    0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x1F, 0x1F, 0xF8, 0x7F, 0x80, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x50, 0xF4, 0x02, 0xF0, 0xF4, 0x0B, 0xC0, 0xF4, 0x2F,
-    0x00, 0xF4, 0xBC, 0x00, 0xF5, 0xF0, 0x00, 0xF7, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0xBC, 0x00,
-    0xF4, 0x3E, 0x00, 0xF4, 0x0F, 0x40, 0xF4, 0x07, 0xC0, 0xF4, 0x02, 0xF0, 0xF4, 0x00, 0xF8, 0xF7,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xDF, 0x40, 0x50, 0x6A,
-    0x40, 0x1A, 0x40, 0xF3, 0xFF, 0xE2, 0xFF, 0xF0, 0xFF, 0x46, 0xFB, 0x91, 0xFC, 0xFC, 0x00, 0xBE,
-    0x00, 0x3C, 0xF8, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00,
-    0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D,
-    0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00, 0x7C, 0x00, 0x3D, 0xF4,
-    0x00, 0x7C, 0x00, 0x3D, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C,
-    0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x6A,
-    0x40, 0x01, 0xFF, 0xFD, 0x00, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0x5F, 0x00,
-    0x02, 0xEB, 0x80, 0x00, 0xBA, 0xE0, 0x00, 0x2F, 0xB8, 0x00, 0x0B, 0x9F, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0xF0, 0xBC, 0x00, 0xFC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x6A, 0x40, 0xF3, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x7D, 0xF8, 0x00, 0x2E, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E,
-    0xFE, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x69, 0x01, 0x01, 0xFF,
-    0xF6, 0xD1, 0xF9, 0x1F, 0xF4, 0xF8, 0x00, 0xFD, 0x7C, 0x00, 0x1F, 0x5F, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD3, 0xC0, 0x01, 0xF4, 0xFC,
-    0x00, 0xFD, 0x0F, 0xEA, 0xFF, 0x40, 0xBF, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x50, 0x2A, 0xF1, 0xFF,
-    0xF7, 0xD5, 0xFE, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB,
-    0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00,
-    0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E, 0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0xE0, 0x00, 0x78, 0x00, 0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00,
-    0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00,
-    0x0F, 0xE9, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0x00, 0x03, 0xD3, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xD0, 0x01, 0xF4, 0xBC, 0x00, 0xFD, 0x1F, 0xEA,
-    0xFF, 0x41, 0xFF, 0xE2, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD7, 0xC0,
-    0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x2F, 0x00, 0x3C, 0x03, 0xC0, 0x1F, 0x00, 0xF4, 0x0F, 0x40, 0x1F,
-    0x03, 0xC0, 0x03, 0xC1, 0xE0, 0x00, 0xB8, 0xF4, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xEE, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x54, 0x00, 0x14, 0x00, 0x14, 0x7C, 0x00, 0xBD, 0x00, 0x3C,
-    0x3C, 0x00, 0xFE, 0x00, 0x7C, 0x3D, 0x01, 0xEF, 0x00, 0xB8, 0x2E, 0x02, 0xDF, 0x00, 0xF4, 0x1F,
-    0x03, 0xC7, 0x80, 0xF0, 0x0F, 0x03, 0xC3, 0xC1, 0xE0, 0x0F, 0x4B, 0x83, 0xC2, 0xD0, 0x0B, 0x8F,
-    0x02, 0xD3, 0xC0, 0x07, 0xCF, 0x01, 0xF3, 0xC0, 0x03, 0xDE, 0x00, 0xF7, 0x80, 0x02, 0xFC, 0x00,
-    0xBF, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x05, 0x0B,
-    0xC0, 0x0B, 0xC0, 0xF4, 0x03, 0xC0, 0x1F, 0x03, 0xD0, 0x02, 0xF2, 0xF0, 0x00, 0x3E, 0xF0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x7C, 0xF8, 0x00, 0x3D, 0x0F, 0x40,
-    0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x2E, 0x0F, 0x40, 0x03, 0xD0, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03,
-    0xD3, 0xC0, 0x01, 0xF0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x3D, 0x03, 0xD0, 0x1F, 0x00, 0xB8, 0x0B,
-    0x80, 0x0F, 0x03, 0xC0, 0x03, 0xD1, 0xF0, 0x00, 0x78, 0xF4, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xEE,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7C, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x05, 0x55, 0x50, 0xBF, 0xFF,
-    0xE0, 0x55, 0x5F, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xAA, 0xA8, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0A, 0x80, 0x1F, 0xE0, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-    0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x07, 0xE0, 0x00,
-    0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00,
-    0x7F, 0x80, 0x02, 0xE0, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
-    0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x39, 0x00, 0x0F, 0xF0, 0x00, 0x7D, 0x00, 0x0B,
-    0x80, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x02,
-    0xF8, 0x00, 0xBF, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C,
-    0x00, 0x2E, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x0F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x1F, 0xFE, 0x41,
-    0xCF, 0x5B, 0xFF, 0xF1, 0x00, 0x1B, 0xE0, 0x18, 0x3F, 0x3F, 0x19, 0x00, 0x04, 0x1C, 0x1C, 0x2C,
-    0x2C, 0x2D, 0x2D, 0x2D, 0x3D, 0x3D, 0x3E, 0x3E, 0x3E, 0x29, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xF0, 0xBD, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00,
-    0x02, 0xF8, 0x06, 0x02, 0xFF, 0xFC, 0x01, 0xBF, 0x80, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0x40, 0x10, 0x02,
-    0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x02, 0xBF, 0xAA, 0x40, 0x3F, 0xFF, 0xF8, 0x00, 0x2D, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x38, 0x6A, 0x1D, 0x2F, 0xFF, 0xFC, 0x0F, 0x40, 0xF4,
-    0x1D, 0x00, 0x38, 0x2C, 0x00, 0x2C, 0x2C, 0x00, 0x2C, 0x2C, 0x00, 0x3C, 0x0F, 0x00, 0xB4, 0x1F,
-    0xEB, 0xF8, 0x3D, 0xBF, 0x6D, 0x10, 0x00, 0x08, 0x78, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x3C, 0x1F,
-    0x00, 0x0B, 0x80, 0xF4, 0x00, 0xF0, 0x07, 0xC0, 0x2E, 0x00, 0x3D, 0x03, 0xC0, 0x01, 0xF0, 0xB8,
-    0x00, 0x0F, 0x4F, 0x00, 0x00, 0x3E, 0xD0, 0x00, 0x57, 0xFD, 0x50, 0x0B, 0xFF, 0xFF, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x90, 0x00,
-    0x00, 0x00, 0x09, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x42, 0xFA, 0xBE, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFF,
-    0xD0, 0x3C, 0x0B, 0xE1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x0F, 0x40, 0x3C, 0x1F, 0xD2, 0xE0, 0x0B,
-    0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF1, 0x00, 0x07, 0xCB, 0xEA, 0xBD, 0x0B,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1E, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0,
-    0x0E, 0x00, 0x55, 0x03, 0xC0, 0xB0, 0x1F, 0xFE, 0x07, 0x43, 0x40, 0xF4, 0x14, 0x0B, 0x1C, 0x0B,
-    0x40, 0x00, 0x1C, 0xB0, 0x3C, 0x00, 0x00, 0x37, 0x80, 0xF0, 0x00, 0x00, 0xEE, 0x03, 0xC0, 0x00,
-    0x03, 0xAC, 0x0F, 0x00, 0x00, 0x0D, 0x70, 0x3D, 0x00, 0x00, 0x34, 0xD0, 0x7C, 0x00, 0x02, 0xC2,
-    0xC0, 0xBF, 0xF8, 0x0E, 0x03, 0x80, 0x2A, 0x40, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4,
-    0x06, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x19, 0x6D, 0x00, 0x0E, 0x06, 0xAE, 0x2E, 0x5E, 0x38, 0x0E, 0x38, 0x1E, 0x2F, 0xFE, 0x05, 0x40,
-    0x00, 0x80, 0x20, 0x0F, 0x43, 0xD0, 0xB8, 0x2E, 0x0B, 0xC2, 0xF0, 0x7C, 0x1F, 0x03, 0xD0, 0xF4,
-    0x03, 0xC1, 0xF0, 0x07, 0xC1, 0xF0, 0x0B, 0xC2, 0xF0, 0x0B, 0x82, 0xD0, 0x04, 0x01, 0x00, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0B, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x0F, 0x94, 0x6F, 0x80, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x0E, 0x05, 0x54,
-    0x03, 0xC0, 0xB0, 0x3F, 0xFD, 0x07, 0x43, 0x40, 0xF1, 0xBC, 0x0B, 0x1C, 0x03, 0xC0, 0xF0, 0x1C,
-    0xB0, 0x0F, 0x03, 0xC0, 0x37, 0x80, 0x3D, 0x6E, 0x00, 0xEE, 0x00, 0xFF, 0xE0, 0x03, 0xAC, 0x03,
-    0xC7, 0x80, 0x0D, 0x70, 0x0F, 0x0F, 0x40, 0x34, 0xD0, 0x3C, 0x1F, 0x02, 0xC2, 0xC0, 0xF0, 0x2D,
-    0x0E, 0x03, 0x82, 0x40, 0x24, 0xF0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x07, 0xE4, 0x06, 0xF0, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x02, 0xFE, 0x03, 0xD6, 0xE1, 0xD0, 0x2C, 0xB0, 0x07, 0x6C, 0x01, 0xD3, 0x80, 0xF0,
-    0x7F, 0xF4, 0x01, 0x90, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x2F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x01, 0x40, 0x2F, 0xF8, 0x38, 0x2D, 0x00, 0x0E, 0x00, 0x0E,
-    0x00, 0x2C, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0x7F, 0xFE, 0x2A, 0xA9, 0x01, 0x40,
-    0x0B, 0xFE, 0x03, 0x42, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x02, 0xBE, 0x00, 0xBF, 0xC0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xCB, 0xEB, 0xD0, 0xAF, 0x80, 0x00, 0x00, 0xF8, 0x2F, 0x07, 0xC0, 0xA0,
-    0x00, 0x50, 0x00, 0x14, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF8,
-    0x00, 0x3D, 0xFC, 0x00, 0xFD, 0xFF, 0xAB, 0xED, 0xFB, 0xFE, 0x1D, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x87, 0xFF, 0xF5, 0xE3, 0xFF, 0xF8, 0x29, 0xFF, 0xFE, 0x0A, 0xBF, 0xFF, 0x82, 0xAF, 0xFF, 0xE0,
-    0xAB, 0xFF, 0xF8, 0x2A, 0xFF, 0xFE, 0x0A, 0x7F, 0xFF, 0x82, 0x8F, 0xFF, 0xE0, 0xA2, 0xFF, 0xF8,
-    0x28, 0x2F, 0xFE, 0x0A, 0x00, 0x57, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A,
-    0x0A, 0x00, 0x02, 0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x28, 0x28, 0x00, 0x0A, 0x0A, 0x00, 0x02,
-    0x82, 0x80, 0x00, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x0E, 0x01, 0xE0,
-    0x07, 0xC0, 0x2D, 0x57, 0xCB, 0xE0, 0x00, 0x00, 0x2F, 0x0F, 0xF3, 0xCB, 0x00, 0xF0, 0x0F, 0x00,
-    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xE5, 0xF0, 0xE0,
-    0x1D, 0x34, 0x03, 0x8D, 0x00, 0xE3, 0x80, 0x34, 0xB0, 0x2C, 0x0F, 0xFD, 0x00, 0x54, 0x00, 0x08,
-    0x02, 0x00, 0x2E, 0x0F, 0x80, 0x0F, 0x43, 0xD0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x7C, 0x00, 0xB8,
-    0x3E, 0x01, 0xF0, 0x7C, 0x07, 0xC1, 0xF0, 0x0F, 0x43, 0xD0, 0x3D, 0x0F, 0x40, 0x04, 0x01, 0x00,
-    0x01, 0xF0, 0x00, 0x0E, 0x00, 0x2F, 0xC0, 0x00, 0xF0, 0x03, 0xDF, 0x00, 0x07, 0x40, 0x04, 0x3C,
-    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x07, 0x40, 0xE0, 0x00, 0xF0, 0x3C, 0x0F, 0xC0, 0x03, 0xC2, 0xC0, 0xBF, 0x00,
-    0x0B, 0x1E, 0x03, 0x7C, 0x00, 0x00, 0xF0, 0x38, 0xF0, 0x00, 0x07, 0x42, 0xC3, 0xC0, 0x00, 0x3C,
-    0x1D, 0x0F, 0x00, 0x02, 0xC0, 0xFF, 0xFF, 0x40, 0x1E, 0x02, 0xAA, 0xF8, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x02, 0xD0, 0x03,
-    0xDE, 0x00, 0x0E, 0x00, 0x04, 0x38, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x07, 0x80, 0x00, 0x03, 0x80,
-    0x3C, 0x00, 0x00, 0x0E, 0x02, 0xD0, 0x00, 0x00, 0x38, 0x0E, 0x1F, 0xE0, 0x00, 0xE0, 0xF2, 0xFA,
-    0xF0, 0x03, 0x87, 0x41, 0x02, 0xC0, 0x0E, 0x3C, 0x00, 0x0B, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x0E, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x2D, 0x00, 0x07, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x2D, 0x00, 0x02, 0xC0, 0x02, 0xFA, 0xA0, 0x1E, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x03, 0x80, 0x79, 0x7D, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00,
-    0x00, 0x1E, 0x00, 0x3C, 0x00, 0x05, 0xBC, 0x00, 0xB4, 0x00, 0x0F, 0xF8, 0x00, 0xF0, 0x00, 0x00,
-    0x2E, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0x80, 0xE0, 0x00, 0x0F, 0x0F, 0x03, 0xF0, 0xB9, 0x7D,
-    0x2D, 0x0B, 0xF0, 0x7F, 0xF4, 0x38, 0x1D, 0xF0, 0x00, 0x00, 0xF0, 0x38, 0xF0, 0x00, 0x01, 0xD0,
-    0xB0, 0xF0, 0x00, 0x03, 0xC1, 0xC0, 0xF0, 0x00, 0x0B, 0x43, 0xFF, 0xFD, 0x00, 0x0E, 0x02, 0xAA,
-    0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x74, 0x00, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xD0, 0x00, 0x0B,
-    0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x3D, 0x00, 0x01, 0xF0,
-    0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x41, 0xB0, 0x7F, 0xFF, 0xD0, 0x2B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00,
-    0x00, 0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x04, 0x01, 0x00, 0x00, 0xBF, 0x43, 0x40, 0x01, 0xEB, 0xFF, 0x00, 0x01, 0x80, 0x78, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00,
-    0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8,
-    0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x3D, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x28, 0x38, 0x00, 0x00, 0x38, 0x28, 0x00, 0x00, 0x1D, 0xB4, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40,
-    0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0,
-    0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0xB8, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00,
-    0x00, 0x3C, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0x95, 0x54,
-    0x00, 0x2F, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xD0, 0x0F, 0xEA, 0xA8, 0x00, 0x7E, 0xAA, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF5, 0x55, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0xFF,
-    0xFF, 0xE3, 0xE0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F,
-    0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x24, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x6E,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF, 0xFF, 0x2F, 0xAA,
-    0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF, 0xFF,
-    0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0xF0, 0x02, 0xE1, 0xF0, 0x1D, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B,
-    0xFF, 0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3D, 0x0F,
-    0x00, 0xB4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF,
-    0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x03, 0xD0, 0x02, 0x80, 0x00, 0x0F, 0xFF, 0x6F, 0xF8, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x06, 0xFE, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0x0F,
-    0xFF, 0x6F, 0xF8, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x06, 0xFE, 0x3F, 0xFD, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0xFF, 0x80, 0xF4, 0xF4, 0xB0, 0x0B, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0xBF,
-    0xE0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x01, 0xBF, 0x80, 0xFF, 0xF4, 0x00, 0x00, 0x3C, 0x1E, 0x3C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFD, 0x2F, 0xF8, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x1B,
-    0xF8, 0x3F, 0xFD, 0x07, 0xFF, 0xE9, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x7C, 0x01, 0xBF, 0x40,
-    0x1F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00,
-    0xF4, 0x1F, 0x00, 0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x0B, 0x9F, 0xFF, 0xF4, 0x02, 0xE0, 0xBC, 0x00,
-    0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x7C,
-    0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x1F, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x03, 0xFC, 0x2C, 0x00, 0x3D, 0xBF, 0xE0, 0x00, 0xD0, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xDB, 0xF0, 0x00, 0x0B, 0xAF, 0xE0, 0x00, 0x2E, 0xBB, 0xC0,
-    0x00, 0xBA, 0xDB, 0xC0, 0x02, 0xEB, 0x4F, 0x40, 0x0B, 0xAD, 0x1F, 0x00, 0x2E, 0xB4, 0x3F, 0x00,
-    0xBA, 0xE0, 0x3D, 0x02, 0xEB, 0x80, 0xBC, 0x0B, 0xAE, 0x00, 0xF8, 0x2E, 0xB8, 0x00, 0xF4, 0xBA,
-    0xE0, 0x02, 0xF1, 0xEB, 0x80, 0x03, 0xE7, 0xAE, 0x00, 0x07, 0xEE, 0xB8, 0x00, 0x0B, 0xFA, 0xE0,
-    0x00, 0x0F, 0xEB, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00,
-    0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E,
-    0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01,
-    0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00,
-    0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x78, 0x7C, 0x00, 0x00, 0x38,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07,
-    0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E,
-    0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00,
-    0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00,
-    0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x40, 0x00, 0x0F, 0xF4, 0x70,
-    0x00, 0x07, 0x6F, 0xFC, 0x00, 0x02, 0x80, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0,
-    0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF,
-    0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B,
-    0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0,
-    0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00,
-    0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00,
-    0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1D, 0x3E, 0x00, 0x7C, 0x0F, 0x81, 0xF0,
-    0x03, 0xE7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xC3, 0xE0, 0x1F,
-    0x00, 0xF8, 0x3C, 0x00, 0x3D, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0B, 0xFF, 0x97,
-    0x80, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x02, 0xFE, 0x0B, 0xC0, 0x00,
-    0xF7, 0xC3, 0xD0, 0x00, 0xF4, 0xF8, 0xF0, 0x00, 0xB8, 0x2F, 0x7C, 0x00, 0x7C, 0x07, 0xDF, 0x00,
-    0x3C, 0x01, 0xF7, 0xC0, 0x2D, 0x00, 0x7D, 0xF0, 0x1E, 0x00, 0x1F, 0x7C, 0x0F, 0x00, 0x0B, 0xCF,
-    0x4F, 0x40, 0x03, 0xE2, 0xFB, 0x80, 0x01, 0xF0, 0x7F, 0xC0, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC,
-    0x02, 0xFF, 0xEB, 0xFC, 0x01, 0xF6, 0xFF, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB,
-    0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4,
-    0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0x0F, 0x40, 0x02, 0x80, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB,
-    0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0xF0, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF,
-    0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xB8,
-    0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x07, 0xEE,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xEA, 0x40, 0xBF,
-    0xFF, 0xF0, 0xB8, 0x06, 0xFC, 0xB8, 0x00, 0x3E, 0xB8, 0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00,
-    0x2F, 0xB8, 0x00, 0x3E, 0xB8, 0x00, 0xFC, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0x80, 0xB8, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x03,
-    0xFE, 0xFF, 0x42, 0xF0, 0x02, 0xF0, 0xF4, 0x00, 0x3C, 0x3D, 0x00, 0x1F, 0x0F, 0x40, 0x0F, 0x43,
-    0xD0, 0x1F, 0x40, 0xF4, 0x0F, 0x40, 0x3D, 0x0B, 0x80, 0x0F, 0x41, 0xF0, 0x03, 0xD0, 0x3F, 0x40,
-    0xF4, 0x03, 0xF8, 0x3D, 0x00, 0x2F, 0x8F, 0x40, 0x01, 0xF7, 0xD0, 0x00, 0x2E, 0xF4, 0x00, 0x0B,
-    0xBD, 0x10, 0x03, 0xDF, 0x4B, 0xAB, 0xF3, 0xD1, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x02,
-    0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0xF0, 0x07, 0xF7,
-    0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF8,
-    0x00, 0x0B, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41,
-    0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x02, 0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0xF0, 0x07, 0xF7, 0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xF0, 0xF4, 0x0E, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x02, 0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0xBE, 0xF0, 0x07, 0xF7, 0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x2F,
-    0xD0, 0xD0, 0xE7, 0xFF, 0x06, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03,
-    0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD,
-    0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC,
-    0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0xFC, 0x00,
-    0x2C, 0x38, 0x00, 0xA0, 0xB0, 0x01, 0xEB, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90,
-    0x0F, 0xFF, 0xF0, 0x39, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0xFF,
-    0xF2, 0xFE, 0xAB, 0xDF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x02, 0xFB, 0xC0, 0x1F, 0xDF, 0xEB,
-    0xEF, 0x1F, 0xFD, 0x2C, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0xD3, 0xFF,
-    0xD0, 0x1E, 0x46, 0xFF, 0x82, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x3C,
-    0x00, 0x00, 0xBC, 0x00, 0x3D, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xE9, 0xFE, 0xAA, 0xA8, 0x7C,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xB8, 0x02,
-    0xFF, 0x00, 0x04, 0x7F, 0xAF, 0x8B, 0xFA, 0xF8, 0x1F, 0xFD, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x1F, 0xFF, 0xC0, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00,
-    0x0B, 0xC0, 0x00, 0x0F, 0xFA, 0xF0, 0x0B, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x1E, 0x00, 0x05, 0xF4, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF,
-    0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF,
-    0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F,
-    0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0,
-    0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE,
-    0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA,
-    0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF, 0x40,
-    0x03, 0xC3, 0xD0, 0x0A, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F,
-    0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA,
-    0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xE0, 0x03, 0xC2, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00,
-    0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x3C, 0x00, 0xA0, 0x00, 0x01, 0x40, 0x3D, 0x03, 0xD0,
-    0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D,
-    0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF0, 0x38, 0x00, 0x00, 0x14, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D,
-    0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0xFF, 0x80, 0xF4, 0xF4, 0xB0, 0x0B, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3C, 0x1E, 0x3C,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xBF,
-    0xE0, 0x00, 0xFC, 0x3D, 0x00, 0x04, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x01, 0xBE, 0x4F, 0x02, 0xFF,
-    0xFF, 0xD2, 0xF4, 0x07, 0xF8, 0xF0, 0x00, 0x3E, 0x7C, 0x00, 0x0B, 0xEE, 0x00, 0x01, 0xFB, 0x80,
-    0x00, 0x7A, 0xE0, 0x00, 0x2E, 0x3C, 0x00, 0x0F, 0x4F, 0x80, 0x0B, 0xC0, 0xFE, 0xAF, 0xC0, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x10, 0x0F, 0xF4, 0x70, 0x2D, 0xBF, 0xF0, 0x24,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00,
-    0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91, 0xBD, 0x0F, 0x80, 0x0B, 0xC3,
-    0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xB9,
-    0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE, 0xAF, 0xC0, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91,
-    0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00,
-    0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE,
-    0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0x8B, 0x80, 0x07, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x1F, 0xFF, 0xD0, 0x0F, 0x91, 0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E,
-    0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F,
-    0x0B, 0xC0, 0x0F, 0xC0, 0xFE, 0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x04, 0x00, 0xFF, 0x47, 0x00, 0xB6, 0xFF, 0x80, 0x34, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7, 0xC0,
-    0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8, 0xF4,
-    0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8,
-    0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x92, 0x80, 0x7F, 0xFF,
-    0xF0, 0x7E, 0x46, 0xF4, 0x3E, 0x00, 0xBF, 0x0F, 0x00, 0x7B, 0xD7, 0xC0, 0x3C, 0xBA, 0xE0, 0x3D,
-    0x2E, 0xB8, 0x2E, 0x0B, 0xEE, 0x1F, 0x02, 0xE7, 0xCF, 0x00, 0xF8, 0xFF, 0x40, 0x3C, 0x2F, 0x80,
-    0x3F, 0x03, 0xFA, 0xBF, 0x03, 0xEF, 0xFE, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0,
-    0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D,
-    0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03,
-    0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4, 0x1F, 0xFE,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x0B,
-    0x87, 0xC0, 0x07, 0x40, 0x38, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C,
-    0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1,
-    0xFE, 0xAF, 0xF4, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x3C,
-    0x00, 0x2D, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00,
-    0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00,
-    0x3F, 0x47, 0xFA, 0xBF, 0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x56, 0xE0, 0x00, 0x3D, 0x3C, 0x00, 0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D,
-    0x01, 0xF0, 0x0B, 0x80, 0xB8, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00,
-    0xF3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x6A, 0x40, 0xF6, 0xFF, 0xF0, 0xFF, 0x41, 0xFC, 0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x2E, 0xF4, 0x00,
-    0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E,
-    0xFE, 0x00, 0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x7C, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x5B, 0x80,
-    0x00, 0xF4, 0xF0, 0x00, 0x7C, 0x3D, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x40, 0xF4, 0x07, 0xC0, 0x2E,
-    0x02, 0xE0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x7C, 0x00, 0x1E, 0x3D, 0x00, 0x03, 0xCF, 0x00, 0x00,
-    0xBB, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C,
-    0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B,
-    0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00,
-    0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00,
-    0x2F, 0x0B, 0xFF, 0xE0, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x0F, 0xFF, 0xF0, 0x39,
-    0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0xF2, 0xFE, 0xAB, 0xDF,
-    0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x02, 0xFB, 0xC0, 0x1F, 0xDF, 0xEB, 0xEF, 0x1F, 0xFD, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0xF0, 0x0E, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,
-    0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03,
-    0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E,
-    0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x05,
-    0x00, 0x50, 0x2C, 0x03, 0x80, 0x3F, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF,
-    0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE,
-    0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8,
-    0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA,
-    0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xF0, 0x0E, 0x41, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x02, 0xFF, 0xFC, 0x2F, 0xEA, 0xBC, 0x7D, 0x00,
-    0x3C, 0xF8, 0x00, 0x3C, 0xF4, 0x00, 0xBC, 0xBC, 0x01, 0xFC, 0x7F, 0xAF, 0xBC, 0x1F, 0xFD, 0x2C,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC,
-    0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5, 0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x74, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD,
-    0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xF4,
-    0x00, 0xF0, 0xF4, 0x0E, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5,
-    0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x00, 0x24,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0B, 0xFE, 0xBF, 0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xF4, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x7F, 0xFF, 0x03,
-    0xF5, 0x68, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xEB, 0xC0, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x2D, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x7F, 0xFF,
-    0xFC, 0x07, 0xF4, 0x00, 0x90, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xFA, 0xFD, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xC0, 0x3D, 0x7C, 0x00, 0x3F, 0xC0, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x01, 0xFF, 0xFC, 0x0F, 0xD5, 0xA0, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x41, 0xF0, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xE9, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xBF, 0x42, 0xE0, 0x00, 0x2F,
-    0x4B, 0x80, 0x00, 0x3F, 0x2E, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x03, 0xEB,
-    0x80, 0x00, 0x0B, 0xAE, 0x00, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x03, 0xDB, 0x80,
-    0x00, 0x1F, 0x2E, 0x00, 0x00, 0xFC, 0xB8, 0x00, 0x0B, 0xC2, 0xE0, 0x01, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0x4F, 0x00, 0x00, 0x03, 0xD3, 0x80, 0x00, 0x00,
-    0xF5, 0xD0, 0x00, 0x00, 0x3D, 0xA0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x1A, 0x43, 0xD0, 0x00, 0x7F,
-    0xFD, 0xF4, 0x00, 0x7E, 0x47, 0xFD, 0x00, 0x3E, 0x00, 0x3F, 0x40, 0x1F, 0x00, 0x07, 0xD0, 0x07,
-    0xC0, 0x00, 0xF4, 0x02, 0xE0, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0x03, 0xD0,
-    0x07, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x03, 0xFA, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE9, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7C, 0x01, 0xBF, 0x40, 0x1F, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x3F, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x00, 0x3E, 0x3F, 0xFF, 0xC0, 0x0B,
-    0x9F, 0xFF, 0xF4, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x00,
-    0x1F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x1F, 0xD0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xA4, 0x3D, 0x00, 0x7F, 0xFD,
-    0xF4, 0x07, 0xE5, 0x7F, 0xD0, 0x3E, 0x00, 0x3F, 0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0xF4,
-    0x2E, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0xF4, 0x0F,
-    0x00, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0x3F, 0xAB, 0xFD, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF6,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xD5, 0x55,
-    0x2F, 0xFF, 0xFC, 0xBE, 0xAA, 0xA2, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00,
-    0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x40, 0x38, 0x07, 0x40, 0xBF, 0xF8, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x40, 0x05, 0x00, 0x10, 0x0B, 0x00, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E,
-    0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD,
-    0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x40, 0x00, 0x04,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40,
-    0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF,
-    0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40,
-    0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54,
-    0xBF, 0xFF, 0xF2, 0xFA, 0xAA, 0x8B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x00, 0x2C, 0x00, 0x01,
-    0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x54, 0x00, 0x6A, 0x40, 0x07,
-    0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF,
-    0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04,
-    0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00,
-    0x03, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x78, 0x0B, 0x80, 0x7C, 0xB8,
-    0x00, 0xBF, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B, 0xFF,
-    0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF0,
-    0x03, 0xD7, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07,
-    0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF,
-    0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04,
-    0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x28, 0x02, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00,
-    0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00,
-    0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x4B, 0x80, 0x0B, 0x40, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x10, 0x1F, 0xFF, 0x6D, 0x1F, 0x91, 0xFF, 0x4F, 0x80, 0x0F, 0xD7, 0xC0, 0x01,
-    0xF5, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF5, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x1F, 0x4F, 0xC0, 0x0F, 0xD0, 0xFE, 0xAF, 0xF4, 0x0B, 0xFE, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xE4, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x2C, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8,
-    0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD, 0x7C, 0x00,
-    0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80,
-    0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0xD0, 0x2C, 0x00, 0x3F, 0xFE, 0x00, 0x02, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x40, 0x7F, 0xFD, 0xB4, 0x7E, 0x47, 0xFD, 0x3E, 0x00, 0x3F, 0x5F,
-    0x00, 0x07, 0xD7, 0xC0, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xD7,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F, 0xF8, 0xF4,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC1, 0x40, 0x07, 0xE0, 0xBF, 0xFF, 0xE0,
-    0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC,
-    0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00, 0x3F, 0xFD,
-    0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D,
-    0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x40, 0x7F, 0xFD, 0xB4, 0x7E, 0x47, 0xFD, 0x3E, 0x00,
-    0x3F, 0x5F, 0x00, 0x07, 0xD7, 0xC0, 0x00, 0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00,
-    0x03, 0xD7, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x43, 0xFA, 0xBF, 0xD0, 0x2F,
-    0xF8, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC1, 0x40, 0x07, 0xE0, 0xBF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF,
-    0xFF, 0xFC, 0x03, 0xF8, 0x00, 0x64, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x15, 0x54, 0x7C, 0x00,
-    0x3F, 0xFD, 0x7C, 0x00, 0x1A, 0xBD, 0x7C, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x3D, 0x0F, 0x80, 0x00, 0x3D, 0x07, 0xF4, 0x00, 0x3D, 0x01, 0xFF, 0xEB, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x10, 0x1F, 0xFF, 0x6D, 0x1F, 0x91, 0xFF, 0x4F, 0x80, 0x0F, 0xD7, 0xC0, 0x01, 0xF5, 0xF0, 0x00,
-    0x3D, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xDB, 0x80, 0x00, 0xF5, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x4F, 0xC0, 0x0F, 0xD0, 0xFE, 0xAF, 0xF4, 0x0B, 0xFE, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x50, 0x01, 0xF8, 0x2F, 0xFF, 0xF8, 0x02, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x02, 0xC0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00,
-    0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2,
-    0xF5, 0x55, 0x57, 0xCB, 0xFF, 0xFF, 0xFF, 0x2F, 0xAA, 0xAA, 0xBC, 0xB8, 0x00, 0x00, 0xF2, 0xE0,
-    0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00,
-    0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0xB0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0xA9, 0x00, 0x0F, 0x6F, 0xFF, 0x00, 0x3F, 0xD4,
-    0x7F, 0x00, 0xFC, 0x00, 0x3C, 0x03, 0xE0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F,
-    0x40, 0xF4, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0xF4, 0x0F, 0x40, 0x03, 0xD0, 0x07, 0x80, 0x00, 0x0F, 0x00,
-    0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02, 0xF5, 0x55, 0x57,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xAA, 0xAA, 0xBC, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0xB8, 0x00,
-    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFE, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x5F, 0xFD, 0x00, 0xFB, 0xFB, 0xF8, 0x0F, 0xE0, 0x0B,
-    0xC0, 0xFC, 0x00, 0x3D, 0x0F, 0x80, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4,
-    0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D,
-    0x0F, 0x40, 0x03, 0xD0, 0x01, 0x00, 0x11, 0xFE, 0x0E, 0x39, 0xFF, 0xD3, 0x01, 0xB4, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x0B, 0xFE, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x6F, 0xE0, 0x0F, 0xFF, 0x40, 0x01, 0x00,
-    0x11, 0xFE, 0x0E, 0x39, 0xFF, 0xD3, 0x01, 0xB4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x7F, 0xFF,
-    0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFD, 0x2F, 0xF8, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x1B, 0xF8, 0x3F, 0xFD, 0x7F, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0x40,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0,
-    0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x50, 0x02, 0x1C, 0x02, 0xC3, 0xFF,
-    0xD0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x42, 0xFF, 0x80, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4,
-    0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x06, 0xFE, 0x03, 0xFF, 0xD0, 0x50, 0x02,
-    0x1C, 0x02, 0xC3, 0xFF, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0x2D, 0x00,
-    0x7F, 0x40, 0x14, 0x01, 0x03, 0xD0, 0xF4, 0x04, 0x00, 0x01, 0x40, 0xF4, 0x3D, 0x0F, 0x43, 0xD0,
-    0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0xF4, 0x38, 0x3C, 0x0E, 0x07, 0x80,
-    0xFF, 0x05, 0x40, 0x01, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x40, 0x00, 0x03, 0xFF, 0xDB, 0xFE, 0x03,
-    0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x41, 0xBF, 0x8F, 0xFF, 0x40, 0x53, 0xDF, 0x7D, 0xF7,
-    0xDF, 0x7D, 0xF7, 0xDF, 0x7D, 0xF7, 0xD0, 0xFF, 0xF4, 0x0F, 0x2F, 0xF8, 0x03, 0xC0, 0xF4, 0x00,
-    0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00,
-    0x3C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x0F, 0x40,
-    0x0F, 0x03, 0xD0, 0x03, 0xC0, 0xF4, 0x00, 0xF0, 0x3D, 0x00, 0x3C, 0x6F, 0xE0, 0x0F, 0x3F, 0xFD,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x04, 0xBD, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xA9, 0x00, 0x04, 0x00, 0x43, 0xD0, 0x2F, 0x3D, 0x01, 0xF0, 0x40, 0x04, 0x00, 0x00, 0x01, 0x40,
-    0x05, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F,
-    0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D, 0x01, 0xF3, 0xD0, 0x1F, 0x3D,
-    0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x0F, 0xFC, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0xF4, 0xB8, 0x2D, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00,
-    0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x47, 0xF0, 0x0F, 0xFD, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03,
-    0xFE, 0x00, 0xF4, 0xF4, 0x2C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x7F, 0xE0, 0x07, 0xF8, 0x00, 0x78, 0x00, 0x0B, 0x8B, 0x80,
-    0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0xF4, 0x00,
-    0xB8, 0x3D, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBB, 0xF8, 0x00, 0x0B, 0xFB, 0xD0, 0x00, 0xBD, 0x2F,
-    0x00, 0x0B, 0x80, 0xF8, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0xB8, 0x00, 0xFC, 0x0B,
-    0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0x50, 0xF4, 0x02, 0xF0, 0xF4, 0x0B, 0xC0, 0xF4, 0x2F, 0x00, 0xF4, 0xBC, 0x00, 0xF5, 0xF0, 0x00,
-    0xF7, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0xFC, 0xBC, 0x00, 0xF4, 0x3E, 0x00, 0xF4, 0x0F, 0x40, 0xF4,
-    0x07, 0xC0, 0xF4, 0x02, 0xF0, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xE0, 0x00, 0x02, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x50, 0x00, 0x50, 0xF4, 0x02, 0xF0,
-    0xF4, 0x0B, 0xC0, 0xF4, 0x1F, 0x40, 0xF4, 0x7D, 0x00, 0xF4, 0xF8, 0x00, 0xF7, 0xF0, 0x00, 0xFF,
-    0xF4, 0x00, 0xFD, 0xBC, 0x00, 0xF8, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x07, 0xD0, 0xF4, 0x02,
-    0xF0, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x3E, 0x0B, 0xC1, 0xF0, 0x38, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03,
-    0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x78, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x20, 0x00, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x00, 0x05, 0x2E, 0x3C, 0x38, 0x20, 0x78, 0x00, 0xB6, 0xE0, 0x03, 0xCB, 0x80, 0x0E,
-    0x2E, 0x00, 0x70, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0xF4, 0xF7, 0xD3, 0xCF, 0x4D, 0x3D,
-    0xB0, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4,
-    0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x78, 0x00, 0x02, 0xE0,
-    0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x40, 0xB8, 0x0B, 0xC2, 0xE0, 0x2F, 0x0B, 0x80, 0x10, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0xF4, 0x0F,
-    0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x4F, 0x6F, 0xF6, 0xFF, 0x44,
-    0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x00, 0x07, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x2E, 0x2E, 0x00, 0x0B, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x1B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC4, 0x03, 0xFD, 0x03, 0xF8, 0x1F, 0xD0, 0x3F, 0xC0, 0x13, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x07, 0x6F, 0xC0, 0x00, 0x2E, 0xBF, 0x80, 0x00, 0xBA, 0xEF, 0x00,
-    0x02, 0xEB, 0x6F, 0x00, 0x0B, 0xAD, 0x3D, 0x00, 0x2E, 0xB4, 0x7C, 0x00, 0xBA, 0xD0, 0xFC, 0x02,
-    0xEB, 0x80, 0xF4, 0x0B, 0xAE, 0x02, 0xF0, 0x2E, 0xB8, 0x03, 0xE0, 0xBA, 0xE0, 0x03, 0xD2, 0xEB,
-    0x80, 0x0B, 0xC7, 0xAE, 0x00, 0x0F, 0x9E, 0xB8, 0x00, 0x1F, 0xBA, 0xE0, 0x00, 0x2F, 0xEB, 0x80,
-    0x00, 0x3F, 0xAE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x3D, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51,
-    0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00, 0x02, 0xEB, 0xF8, 0x00, 0x0B, 0xAE, 0xF0, 0x00,
-    0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xD0, 0x02, 0xEB, 0x47, 0xC0, 0x0B, 0xAD, 0x0F, 0xC0, 0x2E,
-    0xB8, 0x0F, 0x40, 0xBA, 0xE0, 0x2F, 0x02, 0xEB, 0x80, 0x3E, 0x0B, 0xAE, 0x00, 0x3D, 0x2E, 0xB8,
-    0x00, 0xBC, 0x7A, 0xE0, 0x00, 0xF9, 0xEB, 0x80, 0x01, 0xFB, 0xAE, 0x00, 0x02, 0xFE, 0xB8, 0x00,
-    0x03, 0xFA, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2,
-    0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D,
-    0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0xB4, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x07, 0x6F, 0xC0, 0x00, 0x2E, 0xBF, 0x80, 0x00, 0xBA, 0xEF, 0x00, 0x02, 0xEB, 0x6F, 0x00,
-    0x0B, 0xAD, 0x3D, 0x00, 0x2E, 0xB4, 0x7C, 0x00, 0xBA, 0xD0, 0xFC, 0x02, 0xEB, 0x80, 0xF4, 0x0B,
-    0xAE, 0x02, 0xF0, 0x2E, 0xB8, 0x03, 0xE0, 0xBA, 0xE0, 0x03, 0xD2, 0xEB, 0x80, 0x0B, 0xC7, 0xAE,
-    0x00, 0x0F, 0x9E, 0xB8, 0x00, 0x1F, 0xBA, 0xE0, 0x00, 0x2F, 0xEB, 0x80, 0x00, 0x3F, 0xAE, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x07, 0xCB, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x6A, 0x40, 0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3C,
-    0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x2E, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0x50,
-    0x6A, 0x40, 0xF0, 0xF3, 0xFF, 0xF0, 0x40, 0xFF, 0x45, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0xF4,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0x76, 0xFC, 0x00, 0x02, 0xEB, 0xF8, 0x00,
-    0x0B, 0xAE, 0xF4, 0x00, 0x2E, 0xB6, 0xF0, 0x00, 0xBA, 0xD3, 0xE0, 0x02, 0xEB, 0x47, 0xD0, 0x0B,
-    0xAD, 0x0B, 0xC0, 0x2E, 0xB8, 0x0F, 0x80, 0xBA, 0xE0, 0x1F, 0x42, 0xEB, 0x80, 0x2F, 0x0B, 0xAE,
-    0x00, 0x3E, 0x1E, 0xB8, 0x00, 0x7D, 0x7A, 0xE0, 0x00, 0xBD, 0xEB, 0x80, 0x00, 0xFF, 0xAE, 0x00,
-    0x00, 0xFE, 0xB8, 0x00, 0x02, 0xFA, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x46, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0A, 0xA0, 0x00, 0x50, 0x6A, 0x40,
-    0xF2, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4,
-    0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00,
-    0x3D, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xF8,
-    0x00, 0x7F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x0F, 0x8F,
-    0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07,
-    0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x1F, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x1F, 0xC0, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xE4, 0x6F, 0x43, 0xE0, 0x02, 0xF0, 0xF0, 0x00,
-    0x3D, 0x7C, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xEB, 0x80, 0x00, 0xBE, 0xE0, 0x00, 0x2E, 0x7C, 0x00,
-    0x0F, 0x8F, 0x40, 0x03, 0xC2, 0xF0, 0x03, 0xF0, 0x3F, 0xAB, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x01, 0x40, 0x00, 0x0E, 0x01, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00,
-    0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00,
-    0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0xD0, 0x1C, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E,
-    0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8,
-    0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0xF8, 0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03,
-    0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x00, 0xB0, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03,
-    0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B,
-    0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00,
-    0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40,
-    0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x2F, 0x00, 0x2E, 0x0F, 0x00, 0x0E, 0x0F,
-    0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91,
-    0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00,
-    0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE,
-    0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0x80, 0x0F, 0x80, 0x00, 0x0F, 0x80,
-    0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE5, 0x55, 0x1F, 0x00, 0x00, 0xBF, 0xFF, 0xC7, 0xC0, 0x00,
-    0x2F, 0xAA, 0xA1, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00,
-    0xB8, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xE0, 0x02,
-    0xE0, 0x00, 0x00, 0xBF, 0xEB, 0xFF, 0xFF, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x06, 0x90, 0x00, 0x7F, 0xFF, 0x07, 0xFF, 0xD0, 0x1F, 0x91, 0xFD,
-    0xF4, 0x2F, 0x43, 0xE0, 0x02, 0xFD, 0x00, 0xBC, 0x7C, 0x00, 0x0F, 0xC0, 0x03, 0xCB, 0xC0, 0x00,
-    0xF8, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0xFE, 0xAA, 0xA8, 0xB8, 0x00,
-    0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF0,
-    0x03, 0xFF, 0x00, 0x04, 0x0F, 0xEA, 0xF8, 0xFE, 0xAF, 0xC0, 0x2F, 0xFD, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF,
-    0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8,
-    0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80,
-    0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80,
-    0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x02,
-    0xE0, 0x03, 0x80, 0x00, 0x00, 0x50, 0x2A, 0xF1, 0xFF, 0xF7, 0xD5, 0xFE, 0x00, 0xFC, 0x00, 0xF4,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4,
-    0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8,
-    0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B, 0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8,
-    0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C, 0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80,
-    0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x02, 0x00, 0x00, 0x14, 0x0A, 0x8F, 0x1F, 0xF3, 0xDF, 0x54, 0xFE, 0x00, 0x3F, 0x00,
-    0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x03, 0x40, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x07, 0xCB, 0x80, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xB8, 0x01,
-    0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2E, 0x0B,
-    0x80, 0x03, 0xD0, 0xBD, 0x56, 0xF8, 0x0B, 0xFF, 0xFD, 0x00, 0xBE, 0xAF, 0x80, 0x0B, 0x80, 0x7C,
-    0x00, 0xB8, 0x02, 0xF0, 0x0B, 0x80, 0x0F, 0x40, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x03, 0xE0, 0xB8,
-    0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x0A, 0x83, 0xC7, 0xFC, 0x3D, 0xF5, 0x43, 0xF8, 0x00, 0x3F,
-    0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC,
-    0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0x80, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E,
-    0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFF,
-    0x40, 0x03, 0xC3, 0xD0, 0x0A, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC,
-    0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x01, 0xF0, 0xF0, 0x38, 0x02, 0xC0,
-    0x00, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0,
-    0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E,
-    0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF,
-    0xFC, 0x3E, 0x00, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF,
-    0x80, 0x00, 0xB4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x6E, 0x00,
-    0x03, 0xF8, 0x00, 0x01, 0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07,
-    0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00,
-    0x2E, 0xBE, 0xAF, 0xC7, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xD0,
-    0x01, 0x7C, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x40, 0xF0, 0x03, 0xD7, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x1F, 0xFF, 0xFC, 0x3E, 0x00, 0x14,
-    0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x3D, 0x50, 0x00, 0xBC, 0xBF, 0xAF, 0xF4, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01,
-    0xA9, 0x02, 0xFF, 0xFD, 0x7D, 0x06, 0xCB, 0x40, 0x00, 0xB8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF4,
-    0x00, 0x2F, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x2E, 0x00, 0x01, 0xF4, 0x00, 0x2E, 0xBE, 0xAF, 0xC7,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x17, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x78, 0x00,
-    0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00,
-    0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xE9, 0x01, 0xFF, 0x40,
-    0x1D, 0x00, 0x0F, 0x40, 0x01, 0xB8, 0x00, 0x0F, 0x00, 0x5B, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x07, 0xC0, 0x00, 0xF5, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x01, 0x00, 0x3C, 0x03, 0x80, 0x34, 0x07, 0x80, 0x00,
-    0x1F, 0x95, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0x95, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x03, 0xFA, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x00, 0xE0,
-    0x00, 0x78, 0x00, 0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40, 0xB8, 0x00, 0x2E, 0x00, 0x6F, 0xEA,
-    0x1F, 0xFF, 0xC0, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xE9,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x2F, 0xE0, 0xE0, 0x03, 0x9F, 0xFC, 0x00,
-    0x70, 0x1B, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF,
-    0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0xFF, 0x47, 0x00,
-    0xB6, 0xFF, 0xC0, 0x24, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00, 0xF4,
-    0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D,
-    0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00, 0x3F,
-    0x47, 0xFA, 0xBF, 0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80,
-    0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x14, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x0F, 0x4F, 0x40, 0x07, 0xD2, 0xF0, 0x03, 0xF4, 0x7F, 0xAB, 0xFD, 0x07, 0xFF, 0x8B, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x04, 0x00, 0x2C, 0x03, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80, 0x00,
-    0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0xE0, 0x1D, 0x00, 0x1F, 0xFF, 0x00,
-    0x01, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x43, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D,
-    0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F,
-    0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF4, 0x00, 0x7D, 0x2F, 0x00, 0x3F, 0x47, 0xFA, 0xBF,
-    0xD0, 0x7F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xB0,
-    0xB0, 0x00, 0x0B, 0x0B, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01,
-    0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0, 0xFF, 0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0E, 0x0D, 0x00, 0x03, 0x43, 0x40, 0x00,
-    0xB6, 0xC0, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x40, 0x07, 0xD2, 0xF0, 0x03, 0xF4,
-    0x7F, 0xAB, 0xFD, 0x07, 0xFF, 0x8B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3,
-    0xD0, 0x00, 0xF0, 0xB8, 0x00, 0x2D, 0x1E, 0x00, 0x03, 0x42, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F,
-    0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x0B, 0x40, 0x0A,
-    0x03, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F,
-    0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3,
-    0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3D, 0x00, 0x1F, 0x4B, 0xC0, 0x0F, 0xD1, 0xFE, 0xAF, 0xF4,
-    0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00, 0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F,
-    0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x50, 0x14, 0x00, 0x05, 0x0F, 0x00,
-    0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0,
-    0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xD0, 0x01, 0xF4, 0xBC,
-    0x00, 0xFD, 0x1F, 0xEA, 0xFF, 0x41, 0xFF, 0xE2, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x1F, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0xB8, 0x00, 0x07, 0x9F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x3D, 0x00, 0x1F, 0xD0, 0x00, 0xF4,
-    0xF8, 0x00, 0xBB, 0x80, 0x07, 0xC2, 0xF0, 0x03, 0xDF, 0x00, 0x2F, 0x07, 0xC0, 0x0F, 0x3D, 0x00,
-    0xF8, 0x0F, 0x40, 0x78, 0xB8, 0x03, 0xC0, 0x3E, 0x03, 0xD0, 0xF0, 0x1F, 0x00, 0x7C, 0x0F, 0x03,
-    0xC0, 0xB8, 0x00, 0xF0, 0x7C, 0x0B, 0x83, 0xD0, 0x03, 0xD2, 0xD0, 0x1F, 0x0F, 0x00, 0x0B, 0x8F,
-    0x00, 0x3C, 0x7C, 0x00, 0x1F, 0x3C, 0x00, 0xB6, 0xE0, 0x00, 0x3D, 0xE0, 0x01, 0xEB, 0x40, 0x00,
-    0xFB, 0x40, 0x03, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x14, 0x7C, 0x00, 0xBD, 0x00, 0x3C, 0x3C, 0x00,
-    0xFE, 0x00, 0x7C, 0x3D, 0x01, 0xEF, 0x00, 0xB8, 0x2E, 0x02, 0xDF, 0x00, 0xF4, 0x1F, 0x03, 0xC7,
-    0x80, 0xF0, 0x0F, 0x03, 0xC3, 0xC1, 0xE0, 0x0F, 0x4B, 0x83, 0xC2, 0xD0, 0x0B, 0x8F, 0x02, 0xD3,
-    0xC0, 0x07, 0xCF, 0x01, 0xF3, 0xC0, 0x03, 0xDE, 0x00, 0xF7, 0x80, 0x02, 0xFC, 0x00, 0xBF, 0x40,
-    0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x03, 0x80, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xF4, 0x2E, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x3D, 0x00,
-    0xB8, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x07,
-    0xEE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x4B,
-    0x80, 0x0B, 0x40, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x56, 0xE0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D, 0x01, 0xF0, 0x0B, 0x80, 0xB8, 0x00, 0xF0,
-    0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00, 0xF3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07,
-    0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0xD0,
-    0x00, 0x1F, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0xC7,
-    0xC0, 0x00, 0x3D, 0x0B, 0x80, 0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0xBC, 0x00, 0x3D,
-    0x03, 0xC0, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x40, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x0B, 0xFF, 0xFE, 0x05, 0x55, 0xF4, 0x00, 0x0B, 0x80,
-    0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x10, 0x00, 0x01,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x42, 0xFF, 0xFF, 0x81,
-    0x55, 0x7D, 0x00, 0x02, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0xAA, 0xA3, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0xB8, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x3C, 0x7C, 0x00, 0x7F, 0xC0,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x0B, 0xFF, 0xFE, 0x05, 0x55, 0xF4, 0x00, 0x0B,
-    0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4,
-    0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xFA, 0xAA, 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x3F, 0xB8, 0xBC, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0x40, 0xBC, 0x01, 0xFF,
-    0xFF, 0xF0, 0xF4, 0x07, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x2F, 0x00, 0x00,
-    0x1F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x40, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0, 0x1F, 0x91, 0xBF, 0xD0, 0x3E, 0x00, 0x1F, 0x00,
-    0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0xC0,
-    0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFF, 0xD7, 0xFF, 0xF8, 0x0B, 0xE0,
-    0x03, 0xFE, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x3D, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x2E,
-    0x3D, 0x00, 0x00, 0x2F, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x1F,
-    0x00, 0x2E, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x2E, 0x7C, 0x00,
-    0x00, 0x0F, 0x00, 0x2E, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x2E,
-    0x2F, 0x00, 0x00, 0x3D, 0x00, 0x2E, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x2E, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0x2E, 0x02, 0xFF, 0xBF, 0xD0, 0x00, 0x2E, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x8F, 0xFF, 0x01, 0xF9, 0x1F,
-    0xF4, 0x7E, 0x0F, 0x80, 0x0F, 0x40, 0x7C, 0x7C, 0x00, 0x2F, 0x00, 0xF1, 0xF0, 0x00, 0x7C, 0x03,
-    0xCB, 0x80, 0x00, 0xF0, 0x0F, 0x2E, 0x00, 0x03, 0xC0, 0x3C, 0xB8, 0x00, 0x0F, 0x00, 0xF1, 0xF0,
-    0x00, 0x7C, 0x03, 0xC3, 0xC0, 0x02, 0xE0, 0x0F, 0x0B, 0xC0, 0x1F, 0x00, 0x3C, 0x0F, 0xEB, 0xF4,
-    0x00, 0xF0, 0x0B, 0xFF, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x1B, 0xFF, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0xB8, 0xB8, 0x01, 0xFC, 0xB4,
-    0xB8, 0x00, 0x3E, 0x64, 0xB8, 0x00, 0x2F, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0xB8, 0x00, 0x2E, 0x00,
-    0xB8, 0x00, 0x3D, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x6A, 0x40,
-    0xF7, 0xFF, 0xF0, 0xFF, 0x51, 0xFC, 0xFC, 0x00, 0x7D, 0xF8, 0x00, 0x2E, 0xF4, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x3E, 0xFE, 0x00,
-    0xBC, 0xFB, 0xEB, 0xF4, 0xF5, 0xFF, 0xD0, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0xBD, 0x54, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0xBE, 0xAB, 0xFC, 0x0B, 0x80, 0x07, 0xD0, 0xB8, 0x00,
-    0x2E, 0x0B, 0x80, 0x01, 0xF0, 0xB8, 0x00, 0x2F, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0xBC, 0x0B,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0x80, 0xBC, 0x00, 0xB8, 0x03, 0xE0, 0x0B, 0x80, 0x1F,
-    0x00, 0xB8, 0x00, 0xF8, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x08, 0x00, 0xBC, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF4, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFE, 0x00, 0x3F, 0x90, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x7D, 0x00, 0x09, 0x2F, 0xFB, 0xFD, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x03, 0xFF, 0xF8, 0x29, 0x07, 0xD0, 0x00, 0x1E, 0x00, 0x02, 0xE0, 0x00, 0xBD, 0x01, 0xFF,
-    0x41, 0xFF, 0x80, 0x7F, 0x40, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x01, 0x3F, 0xAB, 0xE1,
-    0xFF, 0xFD, 0x00, 0x10, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFC, 0x00, 0x3C, 0x3C, 0x00,
-    0x3D, 0x7C, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x07, 0xFC, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x7E, 0x54, 0xBF, 0xFF, 0x47, 0xE5, 0x40,
-    0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02,
-    0xE0, 0x00, 0xBC, 0x00, 0x0F, 0xE9, 0x01, 0xFF, 0x40, 0x02, 0xD0, 0x00, 0xB4, 0x00, 0x2D, 0x00,
-    0x0B, 0x40, 0x3F, 0xC0, 0x0F, 0xD0, 0x1B, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xCB, 0x80, 0xB8,
-    0x00, 0x2D, 0x02, 0xE0, 0x00, 0x64, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F,
-    0xF0, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x01, 0xF9, 0x52, 0xFF, 0xFD, 0x1F, 0x95, 0x02, 0xE0,
-    0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x0B, 0x80,
-    0x02, 0xF0, 0x00, 0x3F, 0xA4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xF6, 0xD0, 0x00, 0x03, 0xC3, 0xCF, 0x80, 0x00, 0x0F, 0x1E, 0x3E, 0x00, 0x00, 0x3E,
-    0xF0, 0xF8, 0x00, 0x00, 0xFE, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E,
-    0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00,
-    0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x07, 0xC0,
-    0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x03, 0xE1, 0x40, 0x00, 0x50, 0xF0, 0xF0, 0x00, 0x3D, 0xBC, 0x3C, 0x00,
-    0x0F, 0xFC, 0x0F, 0x00, 0x03, 0xE4, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x01, 0xFE, 0xAF, 0xF4, 0x00, 0x1F, 0xFE, 0x2D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x01, 0xD0, 0x00, 0x00,
-    0x3E, 0x0B, 0x81, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x00, 0xF0, 0xF4,
-    0x38, 0x02, 0xC0, 0x01, 0x00, 0x11, 0xFE, 0x0A, 0x3D, 0xFF, 0xD3, 0x01, 0xB4, 0xBF, 0xFE, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x50, 0x05, 0xB0, 0x0E, 0x3F, 0xFC,
-    0x0B, 0xE0, 0x14, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x2D, 0x78, 0x2D, 0x00, 0x00, 0x29, 0x07,
-    0xFC, 0x02, 0xC0, 0x3C, 0x1F, 0x41, 0xC0, 0x04, 0x00, 0x05, 0x03, 0xFC, 0xB0, 0xEA, 0x0B, 0x7A,
-    0xD1, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x0F, 0x47, 0xC1, 0xE0, 0xF0, 0x34, 0x28, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x7C, 0x0F, 0x5F, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0xF0,
-    0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x3D, 0x2E, 0x00, 0xF0,
-    0xB4, 0x03, 0x42, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x52, 0x85, 0xB0, 0x0E, 0x3F, 0xFC,
-    0x0B, 0xE0, 0x05, 0x50, 0x2F, 0xFC, 0xB9, 0x5E, 0xA0, 0x06, 0x0E, 0x1D, 0x3D, 0x3C, 0xBC, 0xF8,
-    0x50, 0x2E, 0x3E, 0x3C, 0x7C, 0x74, 0xB0, 0x00, 0xF8, 0xBC, 0x7C, 0x3C, 0x2D, 0x0E, 0x00, 0x2E,
-    0x3E, 0x3D, 0x3C, 0x78, 0xB0, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x78, 0x01, 0xD0, 0x00, 0x00,
-    0x7C, 0x0F, 0x42, 0xD0, 0x74, 0x00, 0x00, 0x40, 0x1C, 0x2B, 0xC3, 0xFC, 0x01, 0xC0, 0x04, 0x10,
-    0x03, 0x40, 0x3E, 0x83, 0xFC, 0x34, 0x01, 0x00, 0xBF, 0xFD, 0xAA, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-    0x3C, 0x00, 0xF0, 0x03, 0xE0, 0x3D, 0x0B, 0xC7, 0xF0, 0xB8, 0x00, 0x00, 0x09, 0x3D, 0x70, 0x70,
-    0x3D, 0x05, 0x0A, 0x00, 0xF0, 0x1F, 0x4B, 0xFE, 0x00, 0x00, 0xBF, 0xE6, 0xF9, 0x0F, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x6F, 0x9B, 0xFE, 0x0F, 0x00, 0xA0, 0x15, 0x4F, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF7, 0xF9, 0xF8, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
-    0x3C, 0x0B, 0xF4, 0xBD, 0x12, 0xEB, 0x84, 0x00, 0x00, 0x78, 0x2D, 0x78, 0x2D, 0x00, 0x00, 0x05,
-    0x03, 0xFC, 0xB0, 0xEA, 0x0B, 0x7A, 0xD1, 0xF4, 0x15, 0x2D, 0x3C, 0x74, 0x50, 0x0A, 0x00, 0xE0,
-    0x07, 0xC0, 0x1D, 0x17, 0xC7, 0xF4, 0x01, 0x00, 0xB0, 0x2C, 0x03, 0xC0, 0x3C, 0x02, 0xFC, 0x05,
-    0x40, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD7, 0xEA, 0xBD, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x10, 0x00,
-    0x40, 0x50, 0x50, 0x5B, 0x0F, 0x0E, 0x3F, 0xFF, 0xC0, 0x50, 0x50, 0x00, 0x00, 0x03, 0xD0, 0x7C,
-    0x0F, 0x5F, 0x00, 0x3F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xFD, 0x01,
-    0xF0, 0xF0, 0x38, 0x02, 0xC0, 0x40, 0x05, 0xB0, 0x0E, 0x3F, 0xFC, 0x0B, 0xE0, 0x05, 0x50, 0x2F,
-    0xFC, 0xB9, 0x5E, 0xA0, 0x06, 0x01, 0x00, 0x42, 0xFD, 0x0D, 0x79, 0xFF, 0xC6, 0x01, 0xE0, 0xBF,
-    0xFE, 0xBF, 0xFE, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x01, 0x00, 0x12, 0xFE, 0x0E,
-    0x39, 0xFF, 0xC7, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x08, 0x00, 0xBD, 0x07, 0xF4, 0x3F, 0x80, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x00,
-    0x00, 0xF0, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0B, 0x00, 0x00, 0xF0, 0x00, 0x1D,
-    0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x0B, 0x40, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00,
-    0x38, 0x00, 0x0B, 0x40, 0x00, 0x50, 0x00, 0x00, 0x20, 0x3C, 0x0D, 0x0D, 0x3C, 0x20, 0x70, 0x00,
-    0xD7, 0x00, 0x0D, 0x70, 0x00, 0xD7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x15, 0x55, 0x4B, 0xFF, 0xFE,
-    0xA0, 0x00, 0xAA, 0x00, 0x0A, 0xBA, 0xAA, 0xEA, 0xAA, 0xAA, 0x05, 0x05, 0x03, 0xFF, 0xFC, 0xB0,
-    0xF0, 0xE5, 0x05, 0x05, 0x00, 0x07, 0x5D, 0x2F, 0x81, 0xF4, 0x7A, 0xD1, 0x04, 0x09, 0x7D, 0xB0,
-    0x38, 0x2D, 0x0E, 0x7C, 0x50, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0xF4, 0x02, 0x80, 0x00,
-    0x00, 0xF8, 0x2F, 0x07, 0xC0, 0xA0, 0x00, 0x01, 0x00, 0x42, 0xFD, 0x0D, 0x79, 0xFF, 0xC6, 0x01,
-    0xE0, 0x54, 0xFD, 0x1E, 0x1D, 0x24, 0x00, 0x54, 0x00, 0x3D, 0x0B, 0x5F, 0x7E, 0xDB, 0x1F, 0x03,
-    0x80, 0x00, 0xF0, 0xF0, 0xF9, 0x7E, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x79, 0x55, 0x6D, 0x70,
-    0x00, 0x0D, 0x70, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFC, 0x15, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x2A, 0xAA, 0xA8, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F,
-    0x00, 0x00, 0x2A, 0x87, 0xFD, 0x01, 0xD0, 0x1D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x13, 0x84, 0x2F,
-    0xF0, 0xD7, 0xAF, 0xFC, 0x62, 0xDE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x14, 0x04, 0x2F, 0xD0, 0xD7, 0xAF, 0xFC, 0x60, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x05, 0x00, 0x05, 0x00, 0x82, 0xFE, 0x6C, 0x38, 0xBF, 0x41, 0x00, 0x40, 0x0F, 0x81, 0xC3, 0xEF,
-    0xFC, 0x30, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x1F, 0xAF, 0x43, 0xFF, 0xFC, 0x0A, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0xFF, 0x03, 0xFC, 0x0F,
-    0xFE, 0x90, 0x1A, 0x40, 0x6B, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x5A, 0x50, 0x07, 0x00, 0x15,
-    0x05, 0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x40, 0x00, 0x14, 0x0D, 0x14, 0x00, 0x01, 0x47,
-    0xD2, 0x00, 0x00, 0x08, 0x7D, 0x20, 0x00, 0x00, 0x87, 0xD0, 0x00, 0x00, 0x04, 0x70, 0x28, 0x00,
-    0x01, 0x80, 0x00, 0x50, 0x00, 0x50, 0x00, 0x05, 0x40, 0x15, 0x00, 0xD0, 0x09, 0xA6, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x07, 0xE5, 0x01, 0x54, 0x05, 0xBF, 0xF0, 0x3F, 0xC0, 0xFF, 0x20, 0x0F, 0x80,
-    0x7C, 0x7F, 0x38, 0x00, 0x00, 0x05, 0x2D, 0x34, 0x34, 0x2D, 0x05, 0x1F, 0xF4, 0x7F, 0xFD, 0xB0,
-    0x0E, 0x43, 0xC1, 0x07, 0xD0, 0x02, 0x80, 0x00, 0x03, 0x5C, 0x2F, 0xC1, 0xF4, 0x3E, 0xC0, 0x04,
-    0x01, 0xCB, 0xE3, 0xD0, 0xBE, 0x01, 0xC0, 0x34, 0x0B, 0xD0, 0x7C, 0xBE, 0x34, 0x00, 0xA0, 0x06,
-    0x07, 0xE0, 0xF8, 0x0F, 0x8E, 0xC7, 0xE2, 0xCD, 0xA0, 0x34, 0xA0, 0x20, 0x3C, 0x0E, 0x0E, 0x3C,
-    0x20, 0x12, 0xFB, 0xC4, 0x00, 0x00, 0xF0, 0x7F, 0xD6, 0xF9, 0x2F, 0x81, 0x54, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0xB0, 0xF0, 0xEE, 0x0A, 0x0B, 0xB5, 0xF5, 0xE2, 0xF5, 0xF8, 0x14, 0x03, 0x40, 0x3F,
-    0xC1, 0x6C, 0x02, 0x80, 0x00, 0x74, 0x00, 0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x0B,
-    0xE4, 0x00, 0x1B, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x74, 0x00,
-    0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0xE4, 0x00, 0x1B, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x01, 0x54, 0x00, 0x00, 0x05, 0x1F, 0xFF, 0xE9, 0x00,
-    0x1D, 0x3D, 0x56, 0xBF, 0xFF, 0xF8, 0x60, 0x00, 0x01, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xAA, 0xFF, 0xC0, 0x0F, 0x80, 0x00, 0x02, 0xF4, 0x3C,
-    0x00, 0x00, 0x00, 0x3C, 0x60, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0xAA, 0xAA, 0xAA, 0xAB, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x09, 0x1A, 0xE3, 0x06, 0x70,
-    0xE1, 0x91, 0x1A, 0x83, 0x06, 0x7A, 0xF3, 0x00, 0x34, 0x00, 0x68, 0x20, 0x27, 0x77, 0x71, 0x1E,
-    0x81, 0xC1, 0xCA, 0x03, 0x18, 0x0C, 0x34, 0xA0, 0x29, 0x00, 0x60, 0x26, 0x03, 0x60, 0x36, 0x07,
-    0x30, 0xB1, 0xA1, 0x2F, 0x68, 0x0C, 0x03, 0x40, 0x70, 0x06, 0x80, 0x00, 0x00, 0x03, 0x00, 0x32,
-    0xEB, 0x70, 0xB9, 0x03, 0xA0, 0x73, 0x0B, 0x0A, 0x10, 0x00, 0x06, 0x00, 0x60, 0x07, 0xAD, 0x70,
-    0x76, 0x03, 0x60, 0x36, 0x03, 0x10, 0x10, 0x2A, 0xDA, 0xC3, 0x07, 0x06, 0x30, 0x30, 0x63, 0x03,
-    0x06, 0x30, 0x30, 0x61, 0x01, 0x01, 0x2B, 0x4D, 0x03, 0x00, 0xC0, 0x30, 0x04, 0x00, 0x00, 0x09,
-    0x07, 0xE0, 0xD0, 0x34, 0x0D, 0x02, 0x80, 0x28, 0x60, 0x30, 0xC1, 0x82, 0x4C, 0x03, 0x60, 0x0F,
-    0x40, 0x04, 0x00, 0x30, 0x50, 0x67, 0x00, 0xB0, 0x03, 0x90, 0x24, 0xC0, 0x40, 0x40, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D,
-    0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95,
-    0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-    0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x7F, 0xFE, 0x90, 0x2F, 0xFF, 0xFF, 0x0B, 0x80, 0x0B, 0xF2,
-    0xE0, 0x00, 0x7C, 0xB8, 0x00, 0x0F, 0x6E, 0x00, 0x03, 0xCB, 0x80, 0x01, 0xF2, 0xF5, 0x56, 0xF0,
-    0xBF, 0xFF, 0xE0, 0x2F, 0xAA, 0xBF, 0x4B, 0x80, 0x01, 0xF6, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B,
-    0xEE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xFA, 0xE0, 0x00, 0xFD, 0xBF, 0xFF, 0xFD, 0x2F, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00,
-    0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8,
-    0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D,
-    0x7C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2E, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x03, 0xD0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x0B, 0x80, 0x02, 0xE0, 0x0F, 0x00,
-    0x00, 0xF0, 0x1F, 0x00, 0x00, 0xF4, 0x3D, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x3C, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54, 0xBF, 0xFF, 0xF2, 0xFA,
-    0xAA, 0x8B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x78, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80,
-    0x00, 0x0F, 0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00,
-    0x0F, 0x2F, 0x55, 0x55, 0x7C, 0xBF, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xAB, 0xCB, 0x80, 0x00, 0x0F,
-    0x2E, 0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xCB, 0x80, 0x00, 0x0F, 0x2E,
-    0x00, 0x00, 0x3C, 0xB8, 0x00, 0x00, 0xF2, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00,
-    0x07, 0xDF, 0x0F, 0xFF, 0xE1, 0xF7, 0xC3, 0xFF, 0xF4, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00,
-    0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B,
-    0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0,
-    0x78, 0x00, 0x0B, 0x8B, 0x80, 0x02, 0xF0, 0xB8, 0x00, 0xBC, 0x0B, 0x80, 0x1F, 0x00, 0xB8, 0x07,
-    0xD0, 0x0B, 0x80, 0xF4, 0x00, 0xB8, 0x3D, 0x00, 0x0B, 0x8F, 0x80, 0x00, 0xBB, 0xF8, 0x00, 0x0B,
-    0xFB, 0xD0, 0x00, 0xBD, 0x2F, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0xB8, 0x07, 0xD0, 0x0B, 0x80, 0x2F,
-    0x00, 0xB8, 0x00, 0xFC, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x1F, 0x4B, 0x80, 0x00, 0xBC, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2D, 0xF0, 0x00, 0x00,
-    0x3C, 0xF4, 0x00, 0x00, 0x78, 0x78, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x02,
-    0xE0, 0x1E, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x03, 0xC0, 0x0B, 0x40, 0x0B, 0x80, 0x07, 0xC0, 0x0F,
-    0x00, 0x03, 0xC0, 0x1F, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x7C,
-    0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0x7C, 0x7F, 0x00, 0x00, 0x03, 0xF2, 0xFD, 0x00, 0x00, 0x2F,
-    0xDB, 0xF8, 0x00, 0x00, 0xFF, 0x6E, 0xF0, 0x00, 0x07, 0xBD, 0xB7, 0xD0, 0x00, 0x2D, 0xF6, 0xD7,
-    0xC0, 0x00, 0xF3, 0xDB, 0x4F, 0x00, 0x07, 0x8F, 0x6E, 0x2E, 0x00, 0x3C, 0x3D, 0xB8, 0x7C, 0x01,
-    0xF0, 0xF6, 0xE0, 0xF4, 0x0B, 0x43, 0xDB, 0x82, 0xE0, 0x3C, 0x0F, 0x6E, 0x03, 0xC1, 0xE0, 0x3D,
-    0xB8, 0x0F, 0x4F, 0x40, 0xF6, 0xE0, 0x1F, 0x3C, 0x03, 0xDB, 0x80, 0x3E, 0xD0, 0x0F, 0x6E, 0x00,
-    0xBF, 0x00, 0x3D, 0xB8, 0x01, 0xF8, 0x00, 0xF6, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x7D, 0x00, 0x00,
-    0x76, 0xFC, 0x00, 0x02, 0xEB, 0xF8, 0x00, 0x0B, 0xAE, 0xF0, 0x00, 0x2E, 0xB6, 0xF0, 0x00, 0xBA,
-    0xD3, 0xD0, 0x02, 0xEB, 0x47, 0xC0, 0x0B, 0xAD, 0x0F, 0xC0, 0x2E, 0xB8, 0x0F, 0x40, 0xBA, 0xE0,
-    0x2F, 0x02, 0xEB, 0x80, 0x3E, 0x0B, 0xAE, 0x00, 0x3D, 0x2E, 0xB8, 0x00, 0xBC, 0x7A, 0xE0, 0x00,
-    0xF9, 0xEB, 0x80, 0x01, 0xFB, 0xAE, 0x00, 0x02, 0xFE, 0xB8, 0x00, 0x03, 0xFA, 0xE0, 0x00, 0x07,
-    0xE0, 0x3F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x0F, 0xFF, 0xFE,
-    0x00, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07,
-    0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00,
-    0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0,
-    0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0,
-    0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x01, 0xFB,
-    0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00,
-    0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8,
-    0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01, 0xFB, 0x80, 0x00, 0x1F, 0xB8, 0x00, 0x01,
-    0xFB, 0x80, 0x00, 0x1F, 0x7F, 0xFE, 0x40, 0xBF, 0xFF, 0xF4, 0xB8, 0x01, 0xFC, 0xB8, 0x00, 0x3E,
-    0xB8, 0x00, 0x2F, 0xB8, 0x00, 0x1F, 0xB8, 0x00, 0x2E, 0xB8, 0x00, 0x3D, 0xB8, 0x01, 0xFC, 0xBF,
-    0xFF, 0xF0, 0xBF, 0xFE, 0x40, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFC, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x42,
-    0xE0, 0x00, 0xBC, 0x03, 0xC0, 0x03, 0xD0, 0x0B, 0x80, 0x2F, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x2F,
-    0x0B, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x7E, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0x80, 0xB8, 0x0B, 0xE0, 0xF8, 0x02, 0xE0, 0x07, 0xC7, 0xC0, 0x0B, 0x80, 0x0F, 0x6E, 0x00, 0x2E,
-    0x00, 0x2E, 0xB8, 0x00, 0xB8, 0x00, 0x7E, 0xE0, 0x02, 0xE0, 0x02, 0xFB, 0xC0, 0x0B, 0x80, 0x0B,
-    0x8F, 0x00, 0x2E, 0x00, 0x3D, 0x2F, 0x00, 0xB8, 0x03, 0xF0, 0x3F, 0x92, 0xE1, 0xBF, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xBF, 0xA4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0xBC, 0x00, 0x0F, 0x40, 0xF4, 0x00, 0xB8, 0x01, 0xF0, 0x07,
-    0xC0, 0x02, 0xE0, 0x3D, 0x00, 0x03, 0xD2, 0xE0, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x0F, 0x40, 0xB8, 0x00, 0xB8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3D, 0x00,
-    0x03, 0xE2, 0xF0, 0x00, 0x07, 0xC0, 0xB4, 0x02, 0xD0, 0x0F, 0x3E, 0x00, 0xF4, 0x03, 0xDF, 0x80,
-    0x3D, 0x00, 0xF7, 0xE0, 0x0F, 0x40, 0x3D, 0xF8, 0x03, 0xD0, 0x0F, 0x7E, 0x00, 0xF4, 0x03, 0xDB,
-    0x80, 0x3D, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3C, 0x7C, 0x03, 0xD0, 0x1F, 0x0F, 0x40, 0xF4, 0x0F,
-    0x82, 0xF4, 0x3D, 0x0B, 0xC0, 0x3F, 0xEF, 0xAF, 0xD0, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0x40, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00,
-    0x00, 0xF4, 0x0F, 0x80, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x01, 0xF0, 0x07,
-    0xFF, 0xD0, 0x7F, 0xFD, 0x7F, 0xFD, 0x07, 0xFF, 0xD0, 0x00, 0x69, 0x01, 0x00, 0x1F, 0xFF, 0x6D,
-    0x01, 0xF9, 0x1F, 0xF4, 0x0F, 0x80, 0x0F, 0xD0, 0x7C, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x3D, 0x0B,
-    0x80, 0x00, 0xF4, 0x2E, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x3D, 0x03, 0xC0,
-    0x01, 0xF4, 0x0B, 0xC0, 0x0F, 0xD0, 0x0F, 0xEA, 0xFB, 0xE0, 0x0B, 0xFE, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x1F, 0xEF, 0xF0, 0x3D, 0x00, 0xF8, 0xB8, 0x00,
-    0x7C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x7C, 0xF4, 0x01, 0xF0, 0xF4, 0xFF, 0x80,
-    0xF4, 0xFF, 0xD0, 0xF4, 0x00, 0xB8, 0xF4, 0x00, 0x3D, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0x2E, 0xF8, 0x00, 0x7D, 0xFF, 0xAB, 0xF8, 0xFB, 0xFF, 0xD0, 0xF4, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x50, 0x00, 0x05, 0x2E, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF0, 0xF4, 0x00, 0x3C, 0x2E, 0x00, 0x1F,
-    0x07, 0xC0, 0x07, 0x80, 0xF4, 0x02, 0xD0, 0x2E, 0x00, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0xF4, 0x3D,
-    0x00, 0x1E, 0x1E, 0x00, 0x03, 0xDF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x3F, 0xAF, 0xE0, 0x2F, 0x00, 0x70, 0x0B, 0x40,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0xF4,
-    0xBD, 0x02, 0xF0, 0x07, 0xC1, 0xF0, 0x00, 0xBC, 0xB8, 0x00, 0x0F, 0x3D, 0x00, 0x03, 0xDF, 0x40,
-    0x00, 0xF7, 0xE0, 0x00, 0x3C, 0xBC, 0x00, 0x1F, 0x0F, 0x80, 0x0F, 0x81, 0xFE, 0xAF, 0x80, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x01, 0xFF, 0xFE, 0x3E, 0x41, 0xD7, 0xC0, 0x00,
-    0x7C, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0xFD, 0x01, 0xFF, 0xD0, 0x7D, 0x00, 0x0F, 0x80, 0x00, 0xF4,
-    0x00, 0x0B, 0xC0, 0x00, 0x3F, 0xAB, 0xE0, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xAA,
-    0xAB, 0xD0, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00,
-    0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0xE4, 0x00, 0x2F, 0xFE,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x50, 0x6A, 0x40, 0xF3, 0xFF, 0xF0, 0xFF, 0x51, 0xF8, 0xFC, 0x00, 0x7C, 0xF8, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4,
-    0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xBF, 0x40, 0x7D, 0x02, 0xF0, 0x2E, 0x00, 0x2E, 0x0F, 0x00, 0x07,
-    0xC7, 0xC0, 0x00, 0xF1, 0xF0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x6F, 0xAA, 0xAB, 0xDB, 0xFF, 0xFF,
-    0xF6, 0xE0, 0x00, 0x3D, 0xB8, 0x00, 0x0F, 0x5F, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0xF0, 0xF0, 0x00,
-    0x7C, 0x2D, 0x00, 0x2E, 0x03, 0xC0, 0x1F, 0x00, 0xBE, 0xBF, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4, 0x0F,
-    0x40, 0xF4, 0x0F, 0x40, 0x7E, 0xA2, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x50, 0xF4, 0x02, 0xF0, 0xF4,
-    0x0B, 0xC0, 0xF4, 0x1F, 0x40, 0xF4, 0x7D, 0x00, 0xF4, 0xF8, 0x00, 0xF7, 0xF0, 0x00, 0xFF, 0xF4,
-    0x00, 0xFD, 0xBC, 0x00, 0xF8, 0x3F, 0x00, 0xF4, 0x0F, 0x80, 0xF4, 0x07, 0xD0, 0xF4, 0x02, 0xF0,
-    0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0E, 0xFD, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3E, 0xD0, 0x00, 0x1E, 0x7C, 0x00, 0x0B, 0x4F, 0x00, 0x03, 0xC2, 0xE0, 0x01, 0xE0, 0x7C,
-    0x00, 0xF4, 0x0F, 0x40, 0x3C, 0x02, 0xE0, 0x2E, 0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x01,
-    0xFA, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x0F, 0x40, 0x03, 0xD0, 0xF4,
-    0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D,
-    0x0F, 0x40, 0x03, 0xD0, 0xF4, 0x00, 0x3D, 0x0F, 0x40, 0x03, 0xD0, 0xF8, 0x00, 0x7D, 0x0F, 0xC0,
-    0x0F, 0xD0, 0xFF, 0xAB, 0xEF, 0x8F, 0xBF, 0xE0, 0xFC, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x05, 0x2E, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0xF0, 0xF4, 0x00, 0x3C, 0x2E, 0x00, 0x1F, 0x07, 0xC0,
-    0x07, 0x80, 0xF4, 0x02, 0xD0, 0x2E, 0x00, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0xF4, 0x3D, 0x00, 0x1E,
-    0x1F, 0x00, 0x03, 0xDF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0xAB,
-    0xFA, 0x80, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x0B, 0xFF, 0xC1, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xE4, 0x00, 0x1F, 0xFE,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0xBC, 0x3C, 0x00,
-    0x0F, 0x5F, 0x00, 0x02, 0xEB, 0x80, 0x00, 0xBA, 0xE0, 0x00, 0x2F, 0xB8, 0x00, 0x0B, 0x9F, 0x00,
-    0x03, 0xE3, 0xD0, 0x00, 0xF0, 0xBC, 0x00, 0xFC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFF, 0xFF, 0x17, 0xE5, 0x57, 0xD4, 0x03, 0xD0,
-    0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0,
-    0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0, 0x03, 0xC0, 0x03, 0xD0,
-    0x03, 0xC0, 0x03, 0xD0, 0x03, 0xF9, 0x03, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0xFF, 0xFD, 0x00, 0xFD, 0x1B, 0xC0, 0xBC, 0x00, 0xBC, 0x3D, 0x00, 0x0F, 0x0F, 0x00,
-    0x03, 0xD3, 0xC0, 0x00, 0xB9, 0xF0, 0x00, 0x2E, 0x7C, 0x00, 0x0B, 0x9F, 0x00, 0x03, 0xD7, 0xC0,
-    0x01, 0xF1, 0xF4, 0x00, 0xF8, 0x7F, 0xEA, 0xFC, 0x1F, 0x7F, 0xF8, 0x07, 0xC0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x1F, 0xFF, 0xC1, 0xFD, 0x5A, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xD0, 0x00,
-    0x0B, 0xF9, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x40, 0x2F, 0xFF, 0xFE, 0x0F, 0xE5, 0xBD,
-    0x42, 0xF0, 0x03, 0xD0, 0x3C, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xF4, 0xB8, 0x00, 0x0F, 0x4B, 0x80,
-    0x00, 0xB4, 0xB8, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0xF4, 0x3C, 0x00, 0x1F, 0x02, 0xF0, 0x03, 0xD0,
-    0x0F, 0xEA, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0xBF, 0xFF,
-    0xFD, 0x15, 0xF5, 0x54, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x7E, 0xA8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x40, 0x14, 0x00, 0x14, 0x0F, 0x00, 0x0B, 0x83, 0xC0,
-    0x01, 0xF0, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF0, 0xF0,
-    0x00, 0x3C, 0x3C, 0x00, 0x0F, 0x0F, 0x00, 0x07, 0xC3, 0xD0, 0x02, 0xE0, 0xBC, 0x01, 0xF0, 0x0F,
-    0xEB, 0xF4, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xD7, 0xD7, 0xF0, 0x2F, 0x03, 0xC0, 0xFC, 0x3C, 0x03, 0xC0,
-    0x3D, 0x7C, 0x03, 0xC0, 0x2E, 0xB8, 0x03, 0xC0, 0x2E, 0xB8, 0x03, 0xC0, 0x2F, 0xBC, 0x03, 0xC0,
-    0x2E, 0x7C, 0x03, 0xC0, 0x3D, 0x3D, 0x03, 0xC0, 0x7C, 0x1F, 0x43, 0xC1, 0xF8, 0x07, 0xFB, 0xEF,
-    0xE0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x14, 0x00, 0x00,
-    0x51, 0xFC, 0x00, 0x03, 0xC1, 0xFC, 0x00, 0x3E, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0, 0x0F, 0x40,
-    0x03, 0xC0, 0x7C, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x0F, 0x1E, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xF7,
-    0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0xB8, 0x1F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x3D, 0x00, 0x7C,
-    0x02, 0xE0, 0x00, 0xFF, 0x8F, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x14, 0x03, 0xD0, 0x14,
-    0x3C, 0x03, 0xD0, 0x3D, 0x3C, 0x03, 0xD0, 0x2E, 0x3C, 0x03, 0xD0, 0x1F, 0x3C, 0x03, 0xD0, 0x1F,
-    0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x0F, 0x3C, 0x03, 0xD0, 0x1F,
-    0x3D, 0x03, 0xD0, 0x2E, 0x2E, 0x03, 0xD0, 0x3D, 0x0F, 0x83, 0xD0, 0xFC, 0x07, 0xFB, 0xFF, 0xF0,
-    0x01, 0xBF, 0xFF, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x14,
-    0x00, 0xF4, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x00, 0x00, 0x7C, 0x3C, 0x00,
-    0x00, 0x03, 0xC3, 0xC0, 0x0F, 0x00, 0x3C, 0x7C, 0x00, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x00, 0x3D,
-    0x7C, 0x00, 0xF0, 0x03, 0xD3, 0xC0, 0x0F, 0x00, 0x3C, 0x3D, 0x00, 0xF0, 0x07, 0xC2, 0xF0, 0x2F,
-    0x80, 0xF8, 0x0F, 0xEF, 0xAF, 0xBF, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x6A, 0x40, 0x3F,
-    0xFF, 0xC0, 0xE4, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F, 0xFF, 0xCB,
-    0xFA, 0xAF, 0x7D, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF, 0xBC,
-    0x7F, 0xF4, 0xB0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78,
-    0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F,
-    0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56,
-    0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
-    0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x64, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x02, 0xD0,
-    0x00, 0x3E, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x0F, 0xFF, 0xF0, 0x39, 0x07,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0xF2, 0xFE, 0xAB, 0xDF, 0x40,
-    0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x02, 0xFB, 0xC0, 0x1F, 0xDF, 0xEB, 0xEF, 0x1F, 0xFD, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xD3, 0xC0, 0x00, 0x0F,
-    0xF1, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D,
-    0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95,
-    0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-    0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x06, 0x82, 0xC0,
-    0x03, 0xFC, 0x40, 0x03, 0xC7, 0xC0, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x0F, 0xFF, 0xF0, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
-    0x00, 0xBF, 0xFF, 0x02, 0xFE, 0xAB, 0xC1, 0xF4, 0x00, 0xF0, 0xF8, 0x00, 0x3C, 0x3D, 0x00, 0x2F,
-    0x0B, 0xC0, 0x1F, 0xC1, 0xFE, 0xBE, 0xF0, 0x1F, 0xFD, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x87, 0xD0, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0,
-    0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00,
-    0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00,
-    0x00, 0x2F, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x0A, 0x40, 0x01, 0x3F, 0xC0, 0x00, 0xF5,
-    0xF0, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x03, 0xFF, 0xFC, 0x03, 0x90, 0x7E,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0xBF, 0xFF, 0x0B, 0xFA, 0xAF, 0x1F,
-    0x40, 0x0F, 0x3E, 0x00, 0x0F, 0x3D, 0x00, 0x2F, 0x2F, 0x00, 0x7F, 0x1F, 0xEB, 0xEF, 0x07, 0xFF,
-    0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x07, 0xC3, 0x40, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0xA0, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00,
-    0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8,
-    0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x1B, 0x00, 0x00, 0x0B, 0x00, 0x29, 0x38, 0x00, 0xFF, 0x10, 0x03, 0xD3, 0xC0, 0x0A, 0x00,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x0F, 0xFF, 0xF0, 0x0E, 0x41, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x02, 0xFF, 0xFC, 0x2F, 0xEA, 0xBC, 0x7D, 0x00, 0x3C, 0xF8,
-    0x00, 0x3C, 0xF4, 0x00, 0xBC, 0xBC, 0x01, 0xFC, 0x7F, 0xAF, 0xBC, 0x1F, 0xFD, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0x00, 0x00, 0xB6, 0xFD, 0x00, 0x00, 0x40, 0x14,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x60, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D,
-    0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB,
-    0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00,
-    0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xD1, 0xC0, 0xBB, 0xFD, 0x02, 0x01, 0x90, 0x00, 0x28, 0x00, 0x03, 0xFC, 0x00, 0x3D, 0x7C,
-    0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80,
-    0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00,
-    0xE0, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,
-    0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03,
-    0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E,
-    0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0xF0, 0xF4, 0x0E, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x03, 0xFF, 0xFC, 0x0E, 0x41, 0xF8, 0x00, 0x01, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x0F, 0x02, 0xFF, 0xFC, 0xBF, 0xAA, 0xF7, 0xD0, 0x03, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0xBE, 0xF0, 0x07, 0xF7, 0xFA, 0xFB, 0xC7, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x51, 0x45, 0x00, 0x00, 0x70, 0x0D, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xE0, 0x01, 0x4A, 0x14, 0x0B, 0x00, 0xD0, 0x0F, 0xFF,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x3F, 0xFF, 0xC0, 0xE4, 0x1F, 0x80, 0x00,
-    0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F, 0xFF, 0xCB, 0xFA, 0xAF, 0x7D, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF, 0xBC, 0x7F, 0xF4, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x51, 0x45, 0x00,
-    0x00, 0x70, 0x0D, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00,
-    0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00,
-    0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0,
-    0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C,
-    0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00,
-    0x01, 0x49, 0x14, 0x0B, 0x00, 0xD0, 0x0F, 0xFF, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0x40, 0x3F, 0xFF, 0xC0, 0xE4, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F,
-    0xFF, 0xCB, 0xFA, 0xAF, 0x7D, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F,
-    0xAF, 0xBC, 0x7F, 0xF4, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x70, 0x0D, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40,
-    0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0,
-    0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x00, 0x2C, 0x00, 0x01, 0xE0, 0x01, 0x49, 0x14, 0x07,
-    0x00, 0xE0, 0x0F, 0xFF, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x3F, 0xFF, 0xC0,
-    0xE4, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x2F, 0xFF, 0xCB, 0xFA, 0xAF,
-    0x7D, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x0B, 0xEF, 0x00, 0x7F, 0x7F, 0xAF, 0xBC, 0x7F, 0xF4,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x47, 0x00, 0x00, 0xB6, 0xFD, 0x00,
-    0x00, 0x40, 0x14, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0xB0, 0x1D, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00,
-    0x00, 0xB8, 0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80,
-    0x03, 0xEA, 0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0,
-    0x2E, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0x91, 0xC0, 0xBB, 0xFE, 0x02, 0x41, 0x90, 0x04, 0x00, 0x40, 0x2C, 0x03,
-    0x40, 0x3F, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90,
-    0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4,
-    0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01, 0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x1E, 0xB4, 0x00, 0x00, 0x3D, 0x78, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0xB8,
-    0x2D, 0x00, 0x00, 0xF4, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xE0, 0x0B, 0x80, 0x03, 0xEA,
-    0xAB, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0x95, 0x56, 0xF0, 0x1F, 0x00, 0x00, 0xF0, 0x2E, 0x00,
-    0x00, 0xB8, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x05, 0x00, 0x10, 0x2C, 0x03, 0xC0, 0x3F, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0xBF, 0xFF, 0x2F, 0xEA, 0xBD, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0x2F, 0xBC, 0x01,
-    0xFD, 0xFE, 0xBE, 0xF1, 0xFF, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x04, 0x00, 0x7F, 0xFF, 0xF6, 0xFF, 0xFF, 0xDB, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x55, 0x54, 0xBF, 0xFF, 0xF2, 0xFA, 0xAA, 0x8B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xBF, 0xFF, 0xF6, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D,
-    0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x04, 0x00, 0x00, 0xA4, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x7D, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x00,
-    0x1F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF6, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00,
-    0x02, 0xE0, 0x00, 0x0B, 0xD5, 0x55, 0x2F, 0xFF, 0xFC, 0xBE, 0xAA, 0xA2, 0xE0, 0x00, 0x0B, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0xBF,
-    0xFF, 0xF4, 0x00, 0x29, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x1F,
-    0x40, 0x00, 0x1C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8,
-    0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x3F, 0xD1, 0xC2, 0xDB, 0xFE, 0x0D, 0x02, 0xE0, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B,
-    0x80, 0x00, 0x2E, 0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0x40, 0x00, 0x40, 0x04, 0x0B, 0xF8, 0x38, 0x0E, 0x7F, 0xF0, 0x1C, 0x07, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C,
-    0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x2D, 0x00, 0xB8, 0x74, 0x02, 0xFE, 0x40, 0x0B, 0x4B, 0x40, 0x09,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0xB8, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBD, 0x55, 0x50, 0xBF, 0xFF, 0xF0,
-    0xBE, 0xAA, 0xA0, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x03, 0xD0, 0x02, 0x91, 0xD0, 0x03, 0xFD, 0x50, 0x02, 0xD3, 0xC0, 0x01, 0xD0, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xE4, 0x7E, 0x03, 0xE0, 0x03, 0xD0, 0xF0,
-    0x00, 0xB8, 0x7C, 0x00, 0x2F, 0x2F, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0xA2, 0xE0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x3F, 0xEA, 0xF0, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xB4, 0xB8, 0x00, 0x04, 0xBF, 0x80,
-    0x00, 0x78, 0xB4, 0x00, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0x42, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0xBD, 0x55, 0x50, 0x2F, 0xFF, 0xFC, 0x0B, 0xEA, 0xAA, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0x40, 0x14, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0xA4, 0x00, 0x04,
-    0xBF, 0x40, 0x00, 0xB8, 0xF0, 0x00, 0x34, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x01,
-    0xFF, 0xF8, 0x00, 0xF9, 0x1F, 0x80, 0xF8, 0x00, 0xF4, 0x3C, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0xCB,
-    0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xA8, 0xB8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x10, 0x0F, 0xFA, 0xBC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0xB8, 0x70, 0x02, 0xFE, 0x10, 0x0B, 0x4B, 0x40, 0x09,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0xB8, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBD, 0x55, 0x50, 0xBF, 0xFF, 0xF0,
-    0xBE, 0xAA, 0xA0, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x79, 0x00, 0x00,
-    0x06, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0xA4, 0xA0, 0x00, 0xFF, 0x10, 0x00, 0xB4, 0xF0, 0x00, 0x70,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xF8, 0x00, 0xF9, 0x1F, 0x80, 0xF8,
-    0x00, 0xF4, 0x3C, 0x00, 0x2E, 0x1F, 0x00, 0x0B, 0xCB, 0xFF, 0xFF, 0xF2, 0xFA, 0xAA, 0xA8, 0xB8,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x10, 0x0F, 0xFA, 0xBC, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x83, 0x01, 0xDB, 0xFC, 0x01, 0x01,
-    0x40, 0x00, 0xA8, 0x00, 0x0B, 0xF4, 0x00, 0xB4, 0xB4, 0x02, 0x00, 0x60, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E,
-    0x00, 0x00, 0xBD, 0x55, 0x52, 0xFF, 0xFF, 0xCB, 0xEA, 0xAA, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x30, 0x07, 0xBF, 0xE0, 0x05, 0x02, 0x40, 0x00, 0x29, 0x00,
-    0x00, 0xFF, 0x00, 0x02, 0xD3, 0xC0, 0x07, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07,
-    0xFF, 0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF,
-    0xFF, 0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04,
-    0x0F, 0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0xF0, 0x02, 0xE1, 0xF0, 0x1D, 0x01, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0xB8,
-    0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xF5, 0x55, 0x4B,
-    0xFF, 0xFF, 0x2F, 0xAA, 0xA8, 0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x0B, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0xFF, 0x80, 0x03, 0xC3, 0xD0, 0x0A, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x07, 0xFF,
-    0xE0, 0x0F, 0x91, 0xF8, 0x3E, 0x00, 0x3D, 0x3C, 0x00, 0x2E, 0x7C, 0x00, 0x2F, 0xBF, 0xFF, 0xFF,
-    0xBE, 0xAA, 0xAA, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x0F,
-    0xFA, 0xBC, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x04, 0x00, 0x1A, 0x40, 0x6F, 0x80, 0x0B, 0x00, 0x7C, 0x0B, 0x80, 0x2C, 0x00, 0x00,
-    0x3F, 0xFD, 0xBF, 0xE0, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x1B, 0xF8, 0xFF, 0xF4,
-    0x25, 0x07, 0xF8, 0x03, 0xC0, 0x3C, 0x2F, 0x02, 0xC0, 0x00, 0x01, 0x40, 0x3D, 0x03, 0xD0, 0x3D,
-    0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xD0, 0x3D, 0x00,
-    0xFF, 0xF6, 0xFF, 0x80, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x6F, 0xE3, 0xFF, 0xD0,
-    0x00, 0x00, 0x40, 0x0F, 0x40, 0x3D, 0x00, 0x10, 0x00, 0x04, 0x3D, 0x3D, 0x04, 0x00, 0x14, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x04, 0x3D, 0x3D,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80,
-    0x07, 0xF0, 0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D,
-    0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01,
-    0xF0, 0x7D, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0xF9, 0x1B,
-    0xD0, 0xF8, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0x5F, 0x00, 0x02, 0xEB, 0x80, 0x00, 0xBA, 0xE0, 0x00,
-    0x2F, 0xB8, 0x00, 0x0B, 0x9F, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0xF0, 0xBC, 0x00, 0xFC, 0x0F, 0xEA,
-    0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x00,
-    0xF8, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x02,
-    0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00,
-    0x01, 0xF7, 0xC0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x1F, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0xBE, 0x00, 0x1F, 0xC0, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0x40, 0x00, 0x00, 0x40, 0x00, 0x01, 0xA9, 0x00, 0x07, 0xFF,
-    0xF4, 0x03, 0xE4, 0x6F, 0x43, 0xE0, 0x02, 0xF0, 0xF0, 0x00, 0x3D, 0x7C, 0x00, 0x0B, 0xAE, 0x00,
-    0x02, 0xEB, 0x80, 0x00, 0xBE, 0xE0, 0x00, 0x2E, 0x7C, 0x00, 0x0F, 0x8F, 0x40, 0x03, 0xC2, 0xF0,
-    0x03, 0xF0, 0x3F, 0xAB, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x1E, 0x1E,
-    0x00, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x0F, 0x8F, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F,
-    0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00,
-    0x3E, 0x2F, 0x00, 0x00, 0x1F, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x1F, 0xC0, 0x0B, 0xFE,
-    0xBF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0xB8, 0x00, 0x2A, 0x0E, 0x00, 0x07, 0xF9, 0x40, 0x01, 0xE2, 0xD0, 0x00, 0x34, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xF9, 0x1B, 0xD0, 0x3E, 0x00,
-    0x2F, 0x03, 0xC0, 0x00, 0xF4, 0x7C, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0xB8, 0xB8, 0x00, 0x0B, 0xCB,
-    0x80, 0x00, 0xB8, 0x7C, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0xF0, 0x2F, 0x00, 0x3F, 0x00, 0xFE, 0xAF,
-    0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x1E, 0x1F, 0x00, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x0A, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xF8,
-    0x00, 0x7F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x0F, 0x8F,
-    0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07,
-    0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x1F, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0xBE, 0x00, 0x1F, 0xC0, 0x0B, 0xFE, 0xBF, 0xC0, 0x00, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xD2, 0xA0,
-    0x00, 0x15, 0xFE, 0x00, 0x01, 0xE2, 0xD0, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xE4, 0x6F, 0x43, 0xE0, 0x02, 0xF0, 0xF0, 0x00, 0x3D, 0x7C, 0x00,
-    0x0B, 0xAE, 0x00, 0x02, 0xEB, 0x80, 0x00, 0xBE, 0xE0, 0x00, 0x2E, 0x7C, 0x00, 0x0F, 0x8F, 0x40,
-    0x03, 0xC2, 0xF0, 0x03, 0xF0, 0x3F, 0xAB, 0xF0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x0B, 0xC3, 0x40,
-    0x00, 0x07, 0xFC, 0x40, 0x00, 0x07, 0x87, 0x80, 0x00, 0x02, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x3E, 0x00,
-    0x00, 0xF8, 0x2F, 0x00, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x00, 0xBD, 0xF0,
-    0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D,
-    0xF0, 0x00, 0x00, 0x2F, 0x3D, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x07, 0xC1, 0xF4, 0x00, 0x03,
-    0xE0, 0x2F, 0x80, 0x07, 0xF0, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x05, 0xD0, 0x00, 0x00, 0x74, 0x00, 0xA8, 0x74, 0x00,
-    0x7F, 0x84, 0x00, 0x78, 0xB4, 0x00, 0x34, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x01,
-    0xFF, 0xFD, 0x00, 0xF9, 0x1B, 0xD0, 0xF8, 0x00, 0xBC, 0x3C, 0x00, 0x0F, 0x5F, 0x00, 0x02, 0xEB,
-    0x80, 0x00, 0xBA, 0xE0, 0x00, 0x2F, 0xB8, 0x00, 0x0B, 0x9F, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0xF0,
-    0xBC, 0x00, 0xFC, 0x0F, 0xEA, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0x03, 0x9F, 0xF0, 0x00, 0x00, 0x80, 0x50, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x07, 0xF0,
-    0x0F, 0x80, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0xF8, 0xF0, 0x00, 0x00,
-    0x2F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x7D, 0xF0, 0x00,
-    0x00, 0x1F, 0x7C, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x01, 0xF0, 0x7D,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0xBF, 0xEB, 0xFC, 0x00, 0x06, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0D, 0x00, 0x3A, 0xFF, 0x00, 0x08, 0x06,
-    0x00, 0x00, 0x1A, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1E, 0x2D, 0x00, 0x0D, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x90, 0x00, 0x7F, 0xFF, 0x40, 0x3E, 0x46, 0xF4, 0x3E, 0x00, 0x2F, 0x0F, 0x00,
-    0x03, 0xD7, 0xC0, 0x00, 0xBA, 0xE0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xEE, 0x00, 0x02, 0xE7, 0xC0,
-    0x00, 0xF8, 0xF4, 0x00, 0x3C, 0x2F, 0x00, 0x3F, 0x03, 0xFA, 0xBF, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7C, 0x7C, 0x00, 0x00, 0x38, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x01,
-    0xF0, 0xF4, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0x1F, 0x7C, 0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x02, 0xF3, 0xD0,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x7C, 0x1F, 0x40, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x7F, 0x00,
-    0x2F, 0xFA, 0xFF, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0x87, 0xC0, 0x07, 0x40, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x0F, 0x91, 0xBD, 0x0F, 0x80, 0x0B, 0xC3, 0xC0,
-    0x00, 0xF5, 0xF0, 0x00, 0x2E, 0xB8, 0x00, 0x0B, 0xAE, 0x00, 0x02, 0xFB, 0x80, 0x00, 0xB9, 0xF0,
-    0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x0B, 0xC0, 0x0F, 0xC0, 0xFE, 0xAF, 0xC0, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F,
-    0xFF, 0x40, 0xBC, 0x01, 0xFF, 0xFF, 0xF0, 0xF4, 0x07, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80, 0x00,
-    0x3F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0B,
-    0x80, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x2F,
-    0x00, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02, 0xFF,
-    0xAF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0, 0x1F, 0x91, 0xBF,
-    0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B,
-    0x80, 0xB8, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x0F,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x2F, 0xFF, 0x40, 0xBC, 0x01, 0xFF, 0xFF, 0xF0, 0xF4, 0x07, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80,
-    0x00, 0x3F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00,
-    0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07,
-    0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02,
-    0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0, 0x1F, 0x91,
-    0xBF, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00,
-    0x0B, 0x80, 0xB8, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80, 0x3D, 0x00,
-    0x0F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0x40, 0xBC, 0x01, 0xFF, 0xFF, 0xF0, 0xF4, 0x07,
-    0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0, 0x1F, 0x91, 0xBF, 0xD0, 0x3E, 0x00, 0x1F, 0x00,
-    0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0xC0,
-    0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x40,
-    0x00, 0x00, 0x3F, 0xD1, 0xC0, 0x00, 0x00, 0xB6, 0xFF, 0xC0, 0x00, 0x00, 0x90, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0x40, 0xBC, 0x01, 0xFF, 0xFF, 0xF0, 0xF4, 0x07,
-    0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x00,
-    0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x03, 0xFC, 0x1C, 0x00, 0x0B, 0x6F, 0xF8, 0x00,
-    0x0D, 0x02, 0xE0, 0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0,
-    0x1F, 0x91, 0xBF, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80,
-    0x3D, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0xFF, 0x40, 0xBC, 0x01, 0xFF,
-    0xFF, 0xF0, 0xF4, 0x07, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x80, 0x2F, 0x00, 0x00,
-    0x1F, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x07, 0xC0,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x40, 0x00, 0x3E, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xAF, 0xF0, 0x00, 0x00, 0x6F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x6A, 0x40, 0xB8, 0x07, 0xFF, 0xF4, 0xF0, 0x1F, 0x91, 0xBF, 0xD0,
-    0x3E, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x0B, 0xC0, 0xB8, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x0B, 0x80, 0x3D, 0x00, 0x0F, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xB8, 0x00, 0x01, 0xFB, 0xC0, 0x00,
-    0x1F, 0x3C, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0xFC, 0x0F, 0xFA, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x14, 0x00, 0x05, 0x0F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00,
-    0x03, 0xD3, 0xD0, 0x01, 0xF4, 0xBC, 0x00, 0xFD, 0x1F, 0xEA, 0xFF, 0x41, 0xFF, 0xE2, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x02, 0xBE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xFB, 0x80, 0x00, 0x1F, 0xBC, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x3D, 0x2F, 0x40, 0x0F, 0xC0,
-    0xFF, 0xAF, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x50, 0x00, 0x14, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00,
-    0x3D, 0x3C, 0x00, 0x0F, 0x4F, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x0F, 0x4F, 0x40, 0x07, 0xD2, 0xF0, 0x03, 0xF4, 0x7F, 0xAB, 0xFD, 0x07, 0xFF, 0x8B, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDB, 0x40,
-    0x00, 0x0F, 0x0F, 0x3E, 0x00, 0x00, 0x3C, 0x78, 0xF8, 0x00, 0x00, 0xFB, 0xC3, 0xE0, 0x00, 0x03,
-    0xF8, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x03,
-    0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00,
-    0x00, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x03, 0xE1, 0x40, 0x00, 0x50, 0xF0, 0xF0, 0x00, 0x3D, 0xBC, 0x3C, 0x00, 0x0F, 0xFC, 0x0F,
-    0x00, 0x03, 0xE4, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x40,
-    0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x1F,
-    0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x01, 0xFE, 0xAF, 0xF4, 0x00, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDB,
-    0x40, 0x00, 0x0F, 0x0F, 0x3E, 0x00, 0x00, 0x3C, 0x78, 0xF8, 0x00, 0x00, 0xFB, 0xC3, 0xE0, 0x00,
-    0x03, 0xF8, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0,
-    0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8,
-    0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0B, 0x80, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0xAF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0x40, 0x05, 0x40,
-    0x00, 0x00, 0x03, 0xE1, 0x40, 0x00, 0x50, 0xF0, 0xF0, 0x00, 0x3D, 0xBC, 0x3C, 0x00, 0x0F, 0xFC,
-    0x0F, 0x00, 0x03, 0xE4, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F,
-    0x40, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x01, 0xFE, 0xAF, 0xF4, 0x00, 0x1F, 0xFE, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x6D, 0x00, 0x00, 0x3C, 0x3C, 0xF8, 0x00, 0x00, 0xF1, 0xE3, 0xE0,
-    0x00, 0x03, 0xEF, 0x0F, 0x80, 0x00, 0x0F, 0xE0, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00,
-    0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00,
-    0xF8, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x2E, 0x00,
-    0x00, 0x7C, 0x00, 0xBC, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0xBC,
-    0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0x40, 0x01, 0x50, 0x00, 0x40, 0x00, 0xF8, 0x50, 0x00,
-    0x14, 0x3C, 0x3C, 0x00, 0x0F, 0x6F, 0x0F, 0x00, 0x03, 0xFF, 0x03, 0xC0, 0x00, 0xF9, 0x00, 0xF0,
-    0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00,
-    0xF0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xF4,
-    0x00, 0x7F, 0xAB, 0xFD, 0x00, 0x07, 0xFF, 0x8B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x01, 0x00, 0x00, 0x0B, 0xF8, 0x38, 0x00, 0x00, 0x39, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xD0, 0x00, 0x03, 0xC3, 0xCF, 0x80, 0x00, 0x0F, 0x1E, 0x3E,
-    0x00, 0x00, 0x3E, 0xF0, 0xF8, 0x00, 0x00, 0xFE, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00,
-    0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x03, 0xC0,
-    0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x02, 0xE0,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x0B,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x04, 0x00, 0x00, 0xFF, 0x47, 0x00, 0x00, 0xB6, 0xFF, 0x80, 0x00, 0x24, 0x0B, 0x80,
-    0x15, 0x00, 0x00, 0x00, 0x0F, 0x85, 0x00, 0x01, 0x43, 0xC3, 0xC0, 0x00, 0xF6, 0xF0, 0xF0, 0x00,
-    0x3F, 0xF0, 0x3C, 0x00, 0x0F, 0x90, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0,
-    0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00,
-    0xF4, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x07, 0xFA, 0xBF, 0xD0, 0x00, 0x7F, 0xF8, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xD0, 0x00, 0x03, 0xC3, 0xCF, 0x80,
-    0x00, 0x0F, 0x1E, 0x3E, 0x00, 0x00, 0x3E, 0xF0, 0xF8, 0x00, 0x00, 0xFE, 0x03, 0xE0, 0x00, 0x03,
-    0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x03,
-    0xE0, 0x00, 0x03, 0xC0, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0xF8, 0x00,
-    0x00, 0xF0, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0xF8,
-    0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x3F, 0xEB, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x03, 0xE1,
-    0x40, 0x00, 0x50, 0xF0, 0xF0, 0x00, 0x3D, 0xBC, 0x3C, 0x00, 0x0F, 0xFC, 0x0F, 0x00, 0x03, 0xE4,
-    0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x03,
-    0xD0, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x0B, 0xC0,
-    0x0F, 0xD0, 0x01, 0xFE, 0xAF, 0xF4, 0x00, 0x1F, 0xFE, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0xF4, 0x2E,
-    0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x3D, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x00, 0x02, 0xF0,
-    0xB8, 0x00, 0x03, 0xD3, 0xC0, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x56, 0xE0, 0x00, 0x3D, 0x3C, 0x00, 0x1F, 0x0F, 0x40, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x3D,
-    0x01, 0xF0, 0x0B, 0x80, 0xB8, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x1F, 0x00, 0x07, 0x8F, 0x40, 0x00,
-    0xF3, 0xC0, 0x00, 0x2E, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x0F, 0x42, 0xE0, 0x00, 0xBC, 0x03, 0xC0, 0x03, 0xD0, 0x0B,
-    0x80, 0x2F, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x2F, 0x0B, 0x80, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x7E,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x05, 0x6E, 0x00, 0x03, 0xD3, 0xC0, 0x01,
-    0xF0, 0xF4, 0x00, 0xB8, 0x1F, 0x00, 0x3D, 0x03, 0xD0, 0x1F, 0x00, 0xB8, 0x0B, 0x80, 0x0F, 0x03,
-    0xC0, 0x03, 0xD1, 0xF0, 0x00, 0x78, 0xF4, 0x00, 0x0F, 0x3C, 0x00, 0x02, 0xEE, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x40, 0x00, 0xB8, 0xBC, 0x00, 0x7C,
-    0x2F, 0x0B, 0xFD, 0x01, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0xAF, 0x80, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x2F, 0x00, 0xF0, 0x00,
-    0xF4, 0x02, 0xE0, 0x0B, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x0B, 0xC2, 0xE0, 0x00, 0x0F, 0x4F, 0x00,
-    0x00, 0x1F, 0xB8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x15,
-    0xB8, 0x00, 0x0F, 0x4F, 0x00, 0x07, 0xC3, 0xD0, 0x02, 0xE0, 0x7C, 0x00, 0xF4, 0x0F, 0x40, 0x7C,
-    0x02, 0xE0, 0x2E, 0x00, 0x3C, 0x0F, 0x00, 0x0F, 0x47, 0xC0, 0x01, 0xE3, 0xD0, 0x00, 0x3C, 0xF0,
-    0x00, 0x0B, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0,
-    0x00, 0x02, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x10,
-    0x04, 0x00, 0x0B, 0xF8, 0x34, 0x00, 0x39, 0xFF, 0xC0, 0x01, 0x80, 0x79, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x3D, 0x0B, 0x80, 0x02, 0xF0, 0x0F, 0x00, 0x0F, 0x40,
-    0x2E, 0x00, 0xBC, 0x00, 0x3D, 0x03, 0xC0, 0x00, 0xBC, 0x2E, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x01,
-    0xFB, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x04, 0x01, 0xFE, 0x0B, 0x00, 0xF6, 0xFF, 0x40, 0x30,
-    0x1B, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x5B, 0x80, 0x00, 0xF4, 0xF0, 0x00, 0x7C, 0x3D,
-    0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x40, 0xF4, 0x07, 0xC0, 0x2E, 0x02, 0xE0, 0x03, 0xC0, 0xF0, 0x00,
-    0xF4, 0x7C, 0x00, 0x1E, 0x3D, 0x00, 0x03, 0xCF, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x2F, 0xFC, 0xA0, 0xD2,
-    0x8C, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x01, 0xC0, 0x0F, 0xFE, 0x1C, 0x28, 0x1C, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0,
-    0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55,
-    0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD0, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xE5, 0x55, 0x55,
-    0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x40, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x40, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0,
-    0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x15,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x2A, 0xAA, 0xA8, 0x0B, 0x03, 0xC2, 0xE0, 0xF4,
-    0x7C, 0x2F, 0x01, 0x00, 0x1F, 0x0B, 0xC3, 0xD0, 0xF0, 0x78, 0x2D, 0x01, 0x00, 0x0F, 0x43, 0xC1,
-    0xF0, 0xB8, 0x3C, 0x0E, 0x01, 0x00, 0xBC, 0x1F, 0x03, 0xD0, 0xB4, 0x1E, 0x03, 0xC0, 0x10, 0x0B,
-    0x03, 0x43, 0x82, 0xD2, 0xE0, 0xF0, 0xF4, 0x7C, 0x7C, 0x2E, 0x2F, 0x0F, 0x81, 0x01, 0x40, 0x1F,
-    0x0F, 0x4B, 0x83, 0xD3, 0xD1, 0xF0, 0xF0, 0x78, 0x78, 0x2D, 0x2C, 0x0F, 0x01, 0x01, 0x00, 0x0F,
-    0x47, 0xC0, 0xF0, 0xBC, 0x1F, 0x0F, 0x82, 0xE0, 0xF0, 0x3C, 0x0E, 0x03, 0x81, 0xD0, 0x10, 0x04,
-    0x00, 0xB8, 0x3D, 0x1F, 0x0F, 0x83, 0xC1, 0xF0, 0xB4, 0x3C, 0x1E, 0x0B, 0x43, 0xC1, 0xD0, 0x10,
-    0x10, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x70, 0x01, 0xFF,
-    0xFF, 0xC7, 0xAB, 0xAF, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x0B, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0xB0, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x1C,
-    0x00, 0x69, 0xB5, 0xA2, 0xFF, 0xFF, 0xD1, 0x07, 0x05, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x03,
-    0xE0, 0x00, 0x0B, 0x40, 0x00, 0x2C, 0x00, 0x10, 0x70, 0x52, 0xFF, 0xFF, 0xD6, 0x9B, 0x5A, 0x00,
-    0x1C, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF,
-    0x4F, 0xFD, 0x3F, 0xF4, 0xFF, 0xC0, 0xBD, 0x00, 0x60, 0x00, 0x7D, 0x00, 0x7F, 0xD0, 0x7F, 0xF8,
-    0x7F, 0xE0, 0x7F, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x7F, 0x3E, 0x04, 0x00, 0x00, 0x00,
-    0xF8, 0x03, 0xD3, 0xF0, 0x1F, 0x8F, 0x80, 0x7D, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x7C, 0x02, 0xE3, 0xF0, 0x2F, 0x40, 0xFC, 0xF8, 0x07, 0xD0, 0x3F, 0x04, 0x00, 0x40, 0x01,
-    0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x02, 0xFF, 0xDA, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80,
-    0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00,
-    0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x02, 0x80, 0x0A,
-    0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28,
-    0x00, 0xA0, 0x02, 0x80, 0x0A, 0x00, 0x28, 0x00, 0xA0, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0F, 0xFE,
-    0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3E, 0xB8, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x74, 0x2C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x1D, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0xB0, 0x0E, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x0E, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0xB0, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x1D, 0x2C, 0x2F, 0x80, 0x1F, 0xD0, 0x78, 0x2C,
-    0x78, 0xFB, 0xE0, 0x7E, 0xF0, 0x3E, 0xBC, 0xF1, 0xE0, 0xF0, 0xF0, 0x38, 0x0F, 0xE1, 0xE2, 0xC0,
-    0x74, 0xF0, 0x3C, 0x00, 0x03, 0xC3, 0xC0, 0x74, 0xE0, 0x2C, 0x00, 0x07, 0x43, 0xC0, 0x78, 0xE0,
-    0x2C, 0x00, 0x0F, 0x03, 0xC0, 0x78, 0xE0, 0x2C, 0x00, 0x2D, 0x02, 0xC0, 0x74, 0xF0, 0x3C, 0x00,
-    0x3C, 0x01, 0xD0, 0xB0, 0xF0, 0x3C, 0x00, 0xB0, 0x00, 0xF6, 0xF0, 0x79, 0xF4, 0x01, 0xE0, 0x00,
-    0x7F, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xC0,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xB4, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0x80, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0xE0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x1E, 0x2D, 0x2F, 0x80, 0x0B, 0xE0, 0x07, 0xF4, 0x1E, 0x0B,
-    0x4F, 0x2F, 0xFC, 0x0F, 0xFE, 0x03, 0xFF, 0x43, 0xEB, 0xCB, 0x0F, 0x0B, 0x47, 0x83, 0xC2, 0xD0,
-    0xF0, 0x3F, 0x83, 0x87, 0x40, 0xF2, 0xC0, 0x78, 0xF0, 0x2C, 0x00, 0x02, 0xC2, 0xD0, 0x3C, 0xF0,
-    0x1E, 0x3C, 0x0B, 0x40, 0x01, 0xE0, 0xB4, 0x0F, 0x3C, 0x03, 0x8F, 0x01, 0xD0, 0x00, 0xF0, 0x2D,
-    0x03, 0xCF, 0x01, 0xE3, 0xC0, 0xB4, 0x00, 0x74, 0x07, 0x40, 0xF2, 0xC0, 0x78, 0xF0, 0x2D, 0x00,
-    0x3C, 0x00, 0xE0, 0x78, 0x74, 0x2D, 0x3C, 0x0F, 0x00, 0x2D, 0x00, 0x3E, 0x7C, 0x0F, 0x6F, 0x07,
-    0xDB, 0x80, 0x0F, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xD0, 0x0E, 0x00, 0x70, 0x02, 0x40,
-    0x00, 0x00, 0xF0, 0xB8, 0x07, 0x83, 0xC0, 0x3C, 0x2D, 0x01, 0xD0, 0xF0, 0x0E, 0x0B, 0x00, 0x70,
-    0x38, 0x02, 0x41, 0x80, 0x00, 0x00, 0xF0, 0xB4, 0x3C, 0x01, 0xE0, 0xF0, 0xB4, 0x03, 0xC2, 0xD0,
-    0xF0, 0x07, 0x43, 0xC2, 0xC0, 0x0E, 0x0B, 0x03, 0x80, 0x1C, 0x0E, 0x0B, 0x00, 0x24, 0x18, 0x08,
-    0x00, 0x78, 0x03, 0xD0, 0x0F, 0x00, 0xB4, 0x03, 0xC0, 0x1D, 0x00, 0x50, 0x78, 0x78, 0x03, 0xD2,
-    0xD0, 0x0F, 0x0F, 0x00, 0xB4, 0x74, 0x03, 0xC3, 0xC0, 0x1D, 0x0D, 0x00, 0x50, 0x50, 0x78, 0x78,
-    0x3C, 0x03, 0xD2, 0xD2, 0xD0, 0x0F, 0x0F, 0x0F, 0x00, 0xB4, 0x74, 0x74, 0x03, 0xC3, 0xC3, 0xC0,
-    0x1D, 0x0D, 0x0D, 0x00, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3A,
-    0xC0, 0x07, 0x0D, 0x00, 0xE0, 0xA0, 0x1D, 0x03, 0x03, 0xC0, 0x38, 0x74, 0x01, 0xC0, 0x00, 0x80,
-    0x3D, 0x0B, 0x82, 0xF0, 0x7C, 0x0F, 0x40, 0x3C, 0x01, 0xF0, 0x0B, 0xC0, 0x2E, 0x00, 0x40, 0x08,
-    0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0, 0x1F, 0x01, 0xF0, 0x0F, 0x40, 0xF4,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0xD0, 0x00, 0x43, 0xC0, 0x0F, 0x80,
-    0x0F, 0x07, 0xC0, 0x2D, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00,
-    0x07, 0xC0, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x10, 0x07, 0xDF, 0x40, 0x12, 0xF0, 0x07,
-    0xF4, 0x03, 0xEB, 0xC0, 0x0F, 0xC0, 0x0F, 0x89, 0x00, 0xFB, 0xC0, 0x18, 0x00, 0x0F, 0x47, 0xC0,
-    0x00, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x0F,
-    0x40, 0x60, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0x07, 0xC2, 0x40, 0x0F, 0x80, 0x06, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x3E, 0x03, 0xD3, 0xE0, 0x3D, 0x3E, 0x03, 0xD3, 0xE0, 0x3D, 0x3D, 0x03, 0xC2, 0xD0,
-    0x3C, 0x2D, 0x03, 0xC2, 0xD0, 0x3C, 0x2D, 0x03, 0xC2, 0xC0, 0x3C, 0x1C, 0x02, 0xC1, 0xC0, 0x2C,
-    0x1C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3D, 0x3F, 0x07, 0xE3, 0xE0, 0x7D, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x07, 0xFE, 0xBD, 0x04, 0xF4, 0x3C, 0x02, 0xD0, 0xB4,
-    0x0B, 0x42, 0xD0, 0x2D, 0x0F, 0x00, 0xB4, 0x7C, 0x02, 0xC7, 0xC0, 0x0B, 0xBC, 0x00, 0x1F, 0xC0,
-    0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x10, 0x00, 0x2A, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xD2, 0x80, 0x00, 0x0B, 0x03, 0xC0, 0x00, 0xB0, 0x03,
-    0xE5, 0x6F, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x2B, 0xA4, 0x00, 0x0B, 0xEA, 0xFC, 0x00, 0xB4,
-    0x00, 0x3C, 0x0B, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0D, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x01, 0xC0,
-    0x00, 0xE0, 0x00, 0x74, 0x00, 0x3E, 0x00, 0x0E, 0xC0, 0x0B, 0x34, 0x03, 0x4B, 0x02, 0xC0, 0xD0,
-    0xE0, 0x28, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3C, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x7D, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x41, 0xD0,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x7D, 0x2C,
-    0x6F, 0x00, 0xF9, 0x34, 0xBD, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x01, 0xBF, 0x40, 0x00,
-    0x05, 0xFD, 0x40, 0x00, 0xFB, 0x40, 0x00, 0x01, 0xEE, 0x00, 0x02, 0xE3, 0xC0, 0x00, 0x03, 0xCB,
-    0x80, 0x07, 0xC2, 0xF0, 0x00, 0x0F, 0x83, 0xD0, 0x0B, 0x80, 0xF0, 0x00, 0x0F, 0x03, 0xD0, 0x00,
-    0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0xAA, 0xA3, 0xFF, 0xC5, 0x55, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x02, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0x80, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD3, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xFF, 0x4F, 0xFD, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x7F, 0xF1,
-    0xFF, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD7,
-    0xFF, 0x5F, 0xFD, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F, 0x40,
-    0x3D, 0x7F, 0xF5, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x2F, 0xFE, 0x0B,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xF0, 0x90, 0x0B, 0xC5, 0x00, 0x7D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80,
-    0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00,
-    0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x07,
-    0xC0, 0x00, 0x2D, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xFC,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0xBC, 0xBF, 0xFF, 0xD0, 0xBC, 0x24, 0x02, 0xF0, 0xBC, 0x00, 0x00,
-    0xF0, 0xBC, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x02, 0xE0, 0x78, 0x00, 0x0B,
-    0xC0, 0x78, 0x00, 0x3F, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x74, 0x01, 0xF0, 0x00, 0x34, 0x01, 0xD0,
-    0x00, 0x34, 0x01, 0xD0, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0xB8, 0x03, 0xF0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x06, 0xFF, 0xD0, 0x3E, 0x1F, 0xFF, 0xF4, 0x3E, 0x09, 0x00, 0xBC, 0x3E, 0x00,
-    0x00, 0x3D, 0x3D, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00, 0x3D, 0x2D, 0x00, 0x00, 0xBC, 0x2D, 0x00,
-    0x02, 0xF0, 0x2D, 0x00, 0x0B, 0xC0, 0x2C, 0x00, 0x2F, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x1C, 0x00,
-    0x78, 0x00, 0x1C, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x7C, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x04, 0x00, 0x10, 0x00, 0x15, 0x55,
-    0x55, 0x4F, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x2D,
-    0x7F, 0xFF, 0x4B, 0x0B, 0xFF, 0xF2, 0xC2, 0xFF, 0xFD, 0xB0, 0xBF, 0xFF, 0xAC, 0x2F, 0xFF, 0xEB,
-    0x0B, 0xFF, 0xFA, 0xC2, 0xFF, 0xFE, 0xB0, 0xBF, 0xFF, 0x6C, 0x2F, 0xFF, 0xCB, 0x0B, 0xFF, 0xE2,
-    0xC2, 0xFF, 0xE0, 0xB0, 0xB5, 0x40, 0x2C, 0x2C, 0x00, 0x0B, 0x0B, 0x00, 0x02, 0xC2, 0xC0, 0x00,
-    0xB0, 0xB0, 0x00, 0x2C, 0x2C, 0x00, 0x0B, 0x0B, 0x00, 0x02, 0xC2, 0xC0, 0x00, 0xB0, 0xB0, 0x00,
-    0x2C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x42, 0xFF, 0xFF, 0xF2, 0xFF, 0xFD,
-    0x7C, 0xFF, 0xFF, 0x0F, 0x7F, 0xFF, 0xC3, 0xEF, 0xFF, 0xF0, 0xFB, 0xFF, 0xFC, 0x3E, 0xFF, 0xFF,
-    0x0F, 0xBF, 0xFF, 0xC3, 0xDF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFC, 0x3C, 0x7F, 0xFF, 0xAF, 0x06, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFE, 0x0F, 0x5F, 0xFF, 0xE3, 0x83,
-    0xFF, 0xFC, 0xE0, 0xFF, 0xFF, 0x78, 0x3F, 0xFF, 0xEE, 0x0F, 0xFF, 0xFB, 0x83, 0xFF, 0xFE, 0xE0,
-    0xFF, 0xFF, 0xB8, 0x3F, 0xFF, 0xDE, 0x0F, 0xFF, 0xF3, 0xEB, 0xFF, 0xF4, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE,
-    0x79, 0xFE, 0xBF, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83,
-    0xE0, 0x0B, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x68, 0x3F, 0x0F, 0xC0, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x0F, 0x42, 0xE0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x2B,
-    0xA4, 0x00, 0x0B, 0xEA, 0xFC, 0x00, 0xB4, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
-    0xD2, 0x80, 0x00, 0x0B, 0x03, 0xC0, 0x00, 0xB0, 0x03, 0xE5, 0x6F, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF,
-    0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-    0x40, 0x38, 0x04, 0xFE, 0x79, 0xFE, 0xBF, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0xEF, 0x00, 0x03,
-    0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x0B, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3C,
-    0xFC, 0x07, 0x87, 0x80, 0xB0, 0x00, 0x0F, 0x00, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
-    0xB0, 0x00, 0x0F, 0x00, 0x01, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00,
-    0x01, 0xD0, 0x00, 0x3C, 0x07, 0x83, 0x80, 0xBC, 0xB4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x02, 0xC0, 0xF5, 0x6F, 0xFE, 0x40, 0x2D, 0x0B, 0x00,
-    0x01, 0xBF, 0xFF, 0xE0, 0x20, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x78, 0x00, 0x78, 0x07, 0x40, 0x00, 0x38, 0x34, 0x00, 0x00, 0x34, 0x80, 0x00, 0x00,
-    0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x7C, 0xB2, 0xD0, 0x01,
-    0xFF, 0xB4, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD2, 0xAB, 0xFE, 0xA8, 0x00, 0xBF, 0xF0,
-    0x00, 0x2D, 0xB7, 0xC0, 0x0B, 0x4B, 0x1F, 0x00, 0x10, 0xB0, 0x50, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x14, 0x00, 0xF0, 0xB4, 0x78, 0x3C, 0x01, 0xE0,
-    0xF0, 0xF0, 0xB4, 0x03, 0xC2, 0xC1, 0xD0, 0xE0, 0x07, 0x43, 0x83, 0xC2, 0xC0, 0x0E, 0x0B, 0x07,
-    0x03, 0x40, 0x1C, 0x0D, 0x0E, 0x0B, 0x00, 0x24, 0x18, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x42, 0xF0, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x2F,
-    0x09, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0x1F, 0x4A, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x92, 0xF0, 0x00, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0xBC, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBC, 0x7C, 0x00, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x01, 0x92,
-    0xF0, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x2F, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x0F, 0x02, 0xF0, 0x03, 0xF0, 0x3C, 0x0F,
-    0xC0, 0x0B, 0x40, 0xF0, 0x1D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x18, 0x03, 0xC0, 0x60,
-    0x00, 0xF8, 0x0F, 0x03, 0xE0, 0x03, 0xE0, 0x3C, 0x0F, 0x80, 0x01, 0x00, 0xF0, 0x04, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x04, 0x3F, 0x3F, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04,
-    0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00, 0x3E, 0x3F, 0x3E, 0x04, 0x00,
-    0x0B, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x3F, 0xC1, 0xF4, 0x0F, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0x02, 0xF8, 0x3F, 0xCB, 0xFE, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x35, 0xCA, 0x0A, 0x2A, 0x80, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00,
-    0xA0, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0A, 0x00, 0xA0, 0x0A, 0x0F, 0xFF, 0x0A, 0x00, 0xA0,
-    0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A,
-    0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x40, 0x03, 0xFE, 0x03, 0xE6, 0xD0, 0xE0, 0x3C, 0x74, 0x0B,
-    0x2D, 0x02, 0xCB, 0x40, 0xB1, 0xD0, 0x2C, 0x78, 0x0F, 0x0F, 0x07, 0x81, 0xFF, 0xC0, 0x1B, 0x80,
-    0x0B, 0x10, 0xBB, 0xBB, 0xBB, 0xBA, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x0B, 0xF0, 0x07,
-    0x3C, 0x03, 0x8F, 0x03, 0xC3, 0xC1, 0xD5, 0xF4, 0xFF, 0xFF, 0x80, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xA0, 0x00, 0x00, 0x2F, 0xFD, 0x2D, 0x54, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x15, 0x7E, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x7E, 0xBD, 0x1B, 0xE0, 0x00, 0x14, 0x01, 0xFF, 0x41, 0xF4, 0x00,
-    0xF0, 0x00, 0x34, 0x40, 0x1E, 0xFF, 0x47, 0xD1, 0xF1, 0xD0, 0x1C, 0x74, 0x07, 0x4F, 0x03, 0xC1,
-    0xFB, 0xE0, 0x1B, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0x55, 0xF0, 0x00, 0x74, 0x00, 0x3C, 0x00,
-    0x0E, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x28, 0x00, 0x00,
-    0x40, 0x03, 0xFF, 0x03, 0xD1, 0xE0, 0xE0, 0x3C, 0x3D, 0x1E, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0xF0,
-    0x7C, 0x74, 0x0B, 0x1E, 0x03, 0xC3, 0xEB, 0xE0, 0x1B, 0x90, 0x01, 0x40, 0x07, 0xFE, 0x03, 0xC1,
-    0xE1, 0xC0, 0x2C, 0xB0, 0x0B, 0x1D, 0x03, 0xC3, 0xEB, 0xF0, 0x2A, 0x6C, 0x00, 0x0F, 0x00, 0x0B,
-    0x42, 0xAF, 0x80, 0x7E, 0x40, 0x00, 0x40, 0x01, 0xC0, 0x01, 0xC0, 0x2A, 0xE9, 0x3F, 0xFD, 0x01,
-    0xC0, 0x01, 0xC0, 0x00, 0x40, 0x2A, 0xA9, 0x3F, 0xFD, 0x3F, 0xFE, 0x15, 0x54, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x06, 0x03, 0x82, 0xC0, 0xE0, 0x34, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x0D, 0x03,
-    0x80, 0xB0, 0x0E, 0x01, 0x80, 0x60, 0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x02, 0xC0, 0x70, 0x1C, 0x0B,
-    0x02, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x50, 0xAF, 0xFC, 0xB4, 0x0E, 0xB0, 0x0A, 0xB0,
-    0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0xA0, 0x0A, 0x00, 0x40, 0x03, 0xFE, 0x03, 0xE6, 0xD0,
-    0xE0, 0x3C, 0x74, 0x0B, 0x2D, 0x02, 0xCB, 0x40, 0xB1, 0xD0, 0x2C, 0x78, 0x0F, 0x0F, 0x07, 0x81,
-    0xFF, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x2F, 0x0F, 0xF3, 0xCB, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06, 0x01, 0x40, 0x2F, 0xF8, 0x38, 0x2D, 0x00, 0x0E, 0x00, 0x0E,
-    0x00, 0x2C, 0x00, 0xB4, 0x02, 0xD0, 0x0B, 0x40, 0x2D, 0x00, 0x7F, 0xFE, 0x2A, 0xA9, 0x01, 0x40,
-    0x0B, 0xFE, 0x03, 0x42, 0xE0, 0x00, 0x38, 0x00, 0x1D, 0x02, 0xBE, 0x00, 0xBF, 0xC0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xCB, 0xEB, 0xD0, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0xC0,
-    0x0B, 0xF0, 0x07, 0x3C, 0x03, 0x8F, 0x03, 0xC3, 0xC1, 0xD5, 0xF4, 0xFF, 0xFF, 0x80, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xA0, 0x00, 0x00, 0x2F, 0xFD, 0x2D, 0x54, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF8,
-    0x15, 0x7E, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x7E, 0xBD, 0x1B, 0xE0, 0x00, 0x14, 0x01, 0xFF,
-    0x41, 0xF4, 0x00, 0xF0, 0x00, 0x34, 0x40, 0x1E, 0xFF, 0x47, 0xD1, 0xF1, 0xD0, 0x1C, 0x74, 0x07,
-    0x4F, 0x03, 0xC1, 0xFB, 0xE0, 0x1B, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0x55, 0xF0, 0x00, 0x74,
-    0x00, 0x3C, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0xB4, 0x00,
-    0x28, 0x00, 0x00, 0x40, 0x03, 0xFF, 0x03, 0xD1, 0xE0, 0xE0, 0x3C, 0x3D, 0x1E, 0x03, 0xFE, 0x00,
-    0xFF, 0xC0, 0xF0, 0x7C, 0x74, 0x0B, 0x1E, 0x03, 0xC3, 0xEB, 0xE0, 0x1B, 0x90, 0x01, 0x40, 0x07,
-    0xFE, 0x03, 0xC1, 0xE1, 0xC0, 0x2C, 0xB0, 0x0B, 0x1D, 0x03, 0xC3, 0xEB, 0xF0, 0x2A, 0x6C, 0x00,
-    0x0F, 0x00, 0x0B, 0x42, 0xAF, 0x80, 0x7E, 0x40, 0x00, 0x40, 0x01, 0xC0, 0x01, 0xC0, 0x2A, 0xE9,
-    0x3F, 0xFD, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x40, 0x2A, 0xA9, 0x3F, 0xFD, 0x3F, 0xFE, 0x15, 0x54,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x06, 0x03, 0x82, 0xC0, 0xE0, 0x34, 0x1C, 0x07, 0x01, 0xC0,
-    0x70, 0x0D, 0x03, 0x80, 0xB0, 0x0E, 0x01, 0x80, 0x60, 0x0E, 0x01, 0xC0, 0x38, 0x0F, 0x02, 0xC0,
-    0x70, 0x1C, 0x0B, 0x02, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x00, 0x06, 0xE4, 0x09, 0x5D, 0x00, 0x0B,
-    0x01, 0x5F, 0x1E, 0xAF, 0x34, 0x0B, 0x34, 0x0F, 0x3E, 0xBB, 0x06, 0x41, 0x02, 0xE4, 0x03, 0x97,
-    0x83, 0x80, 0x70, 0xE5, 0x6D, 0x3E, 0xAA, 0x0E, 0x00, 0x02, 0xC0, 0x00, 0x3E, 0xAC, 0x01, 0xA4,
-    0x00, 0x02, 0xF8, 0x03, 0x97, 0xC3, 0xC0, 0x38, 0xD0, 0x0B, 0x34, 0x02, 0xCE, 0x00, 0xB2, 0xC0,
-    0x38, 0x3E, 0xB8, 0x01, 0xA4, 0x00, 0x20, 0x06, 0x0B, 0x07, 0x40, 0xE3, 0x80, 0x0F, 0x80, 0x03,
-    0xD0, 0x01, 0xEC, 0x01, 0xD2, 0xC0, 0xE0, 0x38, 0x10, 0x01, 0x00, 0x1B, 0xE0, 0x0A, 0x5B, 0x40,
-    0x00, 0xB0, 0x00, 0x1C, 0x3F, 0xFF, 0x4D, 0x01, 0xC3, 0x80, 0xB0, 0x7A, 0xF0, 0x01, 0x90, 0x00,
-    0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB2, 0xE4, 0xBD, 0x6D, 0xB0, 0x0E, 0xB0, 0x0A, 0xB0, 0x0A,
-    0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A, 0x50, 0x05, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x18,
-    0xB0, 0xB0, 0xB2, 0xC0, 0xBB, 0x00, 0xBF, 0x40, 0xB2, 0xC0, 0xB0, 0xB0, 0xB0, 0x3C, 0x50, 0x04,
-    0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB5, 0x52, 0xE0, 0xBD, 0x2F, 0x5F, 0xE5, 0xEB, 0x00, 0xE0, 0x2E,
-    0xC0, 0x34, 0x0B, 0xB0, 0x0D, 0x02, 0xEC, 0x03, 0x40, 0xBB, 0x00, 0xD0, 0x2E, 0xC0, 0x34, 0x0B,
-    0x50, 0x04, 0x00, 0x40, 0x52, 0xE4, 0xBD, 0x6D, 0xB0, 0x0E, 0xB0, 0x0A, 0xB0, 0x0A, 0xB0, 0x0A,
-    0xB0, 0x0A, 0xB0, 0x0A, 0x50, 0x05, 0x52, 0xE0, 0x2F, 0x5B, 0x4B, 0x00, 0xF2, 0xC0, 0x1C, 0xB0,
-    0x07, 0x2C, 0x02, 0xCB, 0x40, 0xE2, 0xFA, 0xF0, 0xB1, 0x90, 0x2C, 0x00, 0x0B, 0x00, 0x02, 0xC0,
-    0x00, 0x0B, 0xE4, 0x39, 0x64, 0x34, 0x00, 0x2E, 0x00, 0x06, 0xF0, 0x00, 0x3C, 0x00, 0x1C, 0x3A,
-    0xB8, 0x16, 0x40, 0x04, 0x01, 0xC0, 0x7E, 0x96, 0xD4, 0x2C, 0x02, 0xC0, 0x2C, 0x02, 0xC0, 0x1C,
-    0x00, 0xF9, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xEB, 0xC0, 0x01, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x01, 0x55, 0x43, 0xC0, 0x3F, 0xFD,
-    0x3C, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0xFD, 0x7D, 0x54, 0x02, 0xFF,
-    0xFF, 0xC0, 0x01, 0x7D, 0x54, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x3E, 0xA8, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x0B, 0x0E, 0x00, 0x03, 0x83, 0x40, 0x02, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFE, 0x0F, 0xFC, 0x3E, 0x0B, 0xCB, 0x0E, 0x03, 0xD3, 0x83, 0x41, 0xF0, 0xE1,
-    0xC0, 0xB8, 0x74, 0xB0, 0x2E, 0x1C, 0x38, 0x0B, 0x4B, 0x0E, 0x02, 0xE3, 0x83, 0x40, 0x7C, 0xE1,
-    0xC0, 0x0F, 0x74, 0xB0, 0x03, 0xFC, 0x38, 0x00, 0x7F, 0x0E, 0x00, 0x07, 0xFF, 0xEF, 0x00, 0xFF,
-    0xFF, 0xC0, 0x74, 0xB0, 0x00, 0x1C, 0x38, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x2F, 0x40, 0x14, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x0E, 0x7F, 0x2E, 0x03, 0xFF, 0xCB, 0x80, 0xFC, 0x02,
-    0xE0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xD0, 0xF0, 0x00, 0xBC, 0x3C, 0x00,
-    0x0F, 0xDF, 0x00, 0x00, 0xFF, 0xEF, 0x80, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xEA, 0xA9, 0x0F, 0xFF, 0xFD, 0x0F, 0x95, 0x54, 0x0F, 0x40,
-    0x00, 0x0F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0x40,
-    0x10, 0x01, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x02, 0xBF, 0xAA, 0x40, 0x02, 0xE0, 0x00, 0x01, 0x7E, 0x55, 0x00, 0x3F, 0xFF, 0xF8,
-    0x01, 0x7E, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x50, 0x6A, 0x43, 0xDA, 0x40, 0xF3, 0xFF, 0xE7, 0xFF, 0xF0, 0xFF,
-    0x46, 0xFF, 0x91, 0xFC, 0xFC, 0x00, 0xBE, 0x00, 0x3C, 0xF8, 0x00, 0x7C, 0x00, 0x3D, 0xF4, 0x00,
-    0x7C, 0x00, 0x3D, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0xF4, 0x02, 0xFC,
-    0x00, 0x3D, 0xF4, 0x03, 0xFC, 0x00, 0x3D, 0xF4, 0x0B, 0xBC, 0x00, 0x3D, 0xF4, 0x0E, 0x7C, 0x00,
-    0x3D, 0xF4, 0x2C, 0x7C, 0x00, 0x3D, 0xF4, 0x3C, 0x7C, 0x00, 0x3D, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0x00, 0x3F, 0x40,
-    0x3C, 0x00, 0xFE, 0x00, 0xF0, 0x03, 0xFC, 0x03, 0xC0, 0x0F, 0xB4, 0x0F, 0x00, 0x3C, 0xF0, 0x3C,
-    0x0A, 0xFB, 0xEA, 0xFA, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F, 0x0F, 0x0F, 0x00, 0x3C, 0x2D, 0x3C, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x1B, 0xEA, 0xFB, 0xE8, 0x0F, 0x02, 0xDF, 0x00, 0x3C, 0x03, 0xFC, 0x00, 0xF0,
-    0x0F, 0xF0, 0x03, 0xC0, 0x1F, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0xBC, 0x00, 0x3F, 0xF9,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3C, 0x07, 0xF0, 0x00, 0x03, 0xC0, 0x1F, 0x40, 0x00,
-    0x3C, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x0B, 0x83, 0x40, 0x3C, 0x00, 0xF4, 0x74, 0x03, 0xC0, 0x0F,
-    0x0B, 0x94, 0x3C, 0x07, 0xE7, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F, 0x94, 0x3F, 0xFD, 0x00, 0xB4, 0x03,
-    0xC0, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00, 0xB4, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x00,
-    0xB4, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x7E, 0x93, 0xC0, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x1F, 0x80,
-    0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x6A, 0x4F, 0x00, 0x3C, 0x2F, 0xFE, 0xF0,
-    0x03, 0xC7, 0xD1, 0x8F, 0x00, 0xB8, 0xB8, 0x00, 0xF5, 0x6F, 0x0B, 0x80, 0x0F, 0xFF, 0xD0, 0x3E,
-    0x00, 0xFA, 0xF8, 0x02, 0xFD, 0x0F, 0x03, 0xC0, 0x07, 0xF8, 0xF0, 0x2E, 0x00, 0x0B, 0xDF, 0x01,
-    0xF0, 0x00, 0x2F, 0xF0, 0x0F, 0x40, 0x01, 0xFF, 0x00, 0x7C, 0x40, 0x2E, 0xF0, 0x03, 0xDB, 0xAB,
-    0xDF, 0x00, 0x2E, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x02, 0xE0, 0x0B, 0x1E, 0x00,
-    0xFC, 0x03, 0xC3, 0xC0, 0x3F, 0x00, 0xF0, 0xF0, 0x1E, 0xC0, 0x38, 0x3C, 0x0B, 0x74, 0x1E, 0x0B,
-    0x42, 0xCE, 0x0B, 0x41, 0xD0, 0xF3, 0x82, 0xC0, 0x78, 0x38, 0xF0, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x6B, 0xEF, 0xEF, 0xFF, 0x90, 0xF2, 0xC1, 0xD3, 0x80, 0x2C, 0xF0, 0x39, 0xD0, 0x07, 0x7C, 0x0E,
-    0x70, 0x00, 0xEE, 0x02, 0xEC, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x02, 0xF0,
-    0x03, 0xE0, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xBF, 0xFE, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x01, 0xF4, 0x0F, 0xF0, 0x00, 0x7C, 0x0F, 0xF0, 0x10, 0x3C, 0x0F, 0xF0, 0x78, 0x3C, 0x0F, 0xF0,
-    0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0,
-    0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x3D, 0x0F, 0xF0, 0x78, 0x14, 0x0F, 0xF0,
-    0x78, 0x00, 0x2E, 0xF0, 0x78, 0x00, 0x7C, 0xF0, 0x7E, 0xAB, 0xF4, 0xF0, 0x7F, 0xFF, 0x90, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0x40, 0x01, 0xA4, 0x3D, 0x00, 0x7F, 0xFD, 0xF4, 0x07, 0xE5, 0x7F, 0xD0, 0x3E, 0x00, 0x3F,
-    0x41, 0xF0, 0x00, 0x7D, 0x07, 0xC0, 0x00, 0xF4, 0x2E, 0x00, 0x03, 0xD0, 0xB8, 0x00, 0x0F, 0x42,
-    0xE0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0xF4, 0x0F, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x3F, 0x40, 0x3F,
-    0xAB, 0xFD, 0x00, 0x2F, 0xF8, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xE0, 0x0F, 0xD0, 0x08, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xBD,
-    0x55, 0x40, 0x7F, 0xFF, 0xFC, 0x01, 0xB9, 0x55, 0x00, 0x0B, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x02, 0xE0,
-    0x1E, 0x00, 0x1F, 0x00, 0x78, 0x01, 0xF0, 0x01, 0xE0, 0x0F, 0x40, 0x07, 0x80, 0xF8, 0x00, 0x1E,
-    0x0B, 0x80, 0x00, 0x78, 0x7C, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC1, 0xBF, 0xFF,
-    0xAA, 0x00, 0x7D, 0x7C, 0x00, 0x01, 0xE0, 0xB8, 0x00, 0x07, 0x80, 0xF4, 0x00, 0x1E, 0x01, 0xF0,
-    0x00, 0x78, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0x80, 0x07, 0xC0, 0x1E, 0x00, 0x0B, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F,
-    0x45, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0xF4, 0xF0, 0x0B, 0x8F, 0xBD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xF4,
-    0x00, 0x07, 0xDF, 0x40, 0x00, 0x20, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x02,
-    0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x01,
-    0x00, 0x07, 0xC0, 0x02, 0xE0, 0x7F, 0xF0, 0x07, 0x80, 0x03, 0xD0, 0xF9, 0xFC, 0x0B, 0x40, 0x0B,
-    0xC3, 0xE0, 0x3D, 0x0F, 0x40, 0x0F, 0x43, 0xC0, 0x3D, 0x0F, 0x00, 0x7E, 0x07, 0xC0, 0x3C, 0x1F,
-    0x06, 0xFC, 0x0B, 0x80, 0xBC, 0x2F, 0xFF, 0xE0, 0x0F, 0xEB, 0xF4, 0x2F, 0xF9, 0x00, 0x0F, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7E, 0xF4, 0x00,
-    0x3D, 0x1E, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF0, 0x78, 0x00, 0x2D, 0x2D, 0x00,
-    0x07, 0x8F, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0xA0, 0xBE, 0x00, 0x7C, 0x3F, 0xC0, 0x3F, 0xBC, 0xB4, 0x1E, 0xBE, 0x1F, 0x0F, 0x0F, 0x03, 0xC7,
-    0x82, 0x40, 0xB4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0xB8,
-    0x07, 0xE0, 0x06, 0xE5, 0x5B, 0xD4, 0xFF, 0xFF, 0xFF, 0xF0, 0x2E, 0x00, 0x3D, 0x00, 0xB8, 0x00,
-    0xB4, 0x2B, 0xFA, 0xAB, 0xF8, 0x6F, 0xEA, 0xBF, 0xA0, 0x2E, 0x00, 0xF8, 0x00, 0xBE, 0xBF, 0xC0,
-    0x02, 0xFF, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0xB0, 0x64, 0x0F, 0xC0, 0xB0, 0x00, 0x2F,
-    0x00, 0xB0, 0x00, 0x3E, 0x00, 0xB0, 0x00, 0x3C, 0x00, 0xB0, 0x00, 0x7C, 0x00, 0xB0, 0x00, 0x7C,
-    0x00, 0xB5, 0x54, 0x7C, 0x00, 0xBF, 0xFD, 0x7C, 0x00, 0xBA, 0xBD, 0x7C, 0x00, 0xB0, 0x3D, 0x3D,
-    0x00, 0xB0, 0x3D, 0x2F, 0x00, 0xB0, 0x3D, 0x0F, 0x80, 0xB0, 0x3D, 0x07, 0xF4, 0xB0, 0x3D, 0x01,
-    0xFF, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00,
-    0x3C, 0xF4, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x57,
-    0xF5, 0x6F, 0x54, 0x03, 0xD0, 0x0F, 0x00, 0x6B, 0xEA, 0xAF, 0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F,
-    0x40, 0x03, 0xD0, 0x1F, 0x00, 0x03, 0xE0, 0x2E, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x00, 0xF4, 0x7C,
-    0x00, 0x00, 0xB8, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFE, 0x00, 0x60, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x4B,
-    0xFF, 0xFF, 0xFD, 0x6A, 0xAB, 0xFE, 0x90, 0x01, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xD2, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F,
-    0x40, 0x01, 0x40, 0xFF, 0xEF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x7F, 0xFE, 0x40, 0x1F, 0xFF, 0xFF, 0x01, 0xFD, 0x38, 0x24, 0x0F, 0xC0, 0xE0, 0x00,
-    0xBC, 0x03, 0x80, 0x03, 0xE0, 0x0E, 0x00, 0x0F, 0x00, 0x38, 0x00, 0x7C, 0x00, 0xE0, 0x01, 0xF0,
-    0x03, 0x80, 0x07, 0xC0, 0x0E, 0x00, 0x1F, 0x00, 0x38, 0x00, 0x7C, 0x00, 0xE0, 0x00, 0xF4, 0x03,
-    0x80, 0x02, 0xF0, 0x0E, 0x00, 0x07, 0xE0, 0x38, 0x00, 0x0B, 0xE0, 0xE0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0x40, 0x14, 0x00,
-    0x0E, 0x00, 0xE0, 0x00, 0x38, 0x07, 0x80, 0x02, 0xF5, 0x6F, 0x54, 0x7F, 0xFF, 0xFF, 0xF4, 0x6F,
-    0x57, 0xE5, 0x40, 0xB8, 0x0B, 0x80, 0x02, 0xE0, 0x2E, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x2E, 0x02,
-    0xE0, 0x00, 0xB8, 0x0B, 0x80, 0x02, 0xE0, 0x2E, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x2E, 0x02, 0xE0,
-    0x00, 0xB8, 0x0B, 0xC0, 0x02, 0xE0, 0x0F, 0xEA, 0x0B, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x2F, 0x40,
-    0x18, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x8A, 0x4B, 0x47, 0x81, 0xF7, 0xBD, 0xBE, 0x78, 0x3D,
-    0xDD, 0x0F, 0x07, 0x1F, 0x3F, 0x03, 0x81, 0xCF, 0x43, 0xF9, 0xE0, 0xBF, 0x80, 0x3B, 0xFF, 0xFE,
-    0x40, 0x0C, 0x0E, 0x0B, 0x00, 0x03, 0x03, 0x81, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x2A, 0xAF, 0xA8, 0x3F, 0xFF, 0xFD, 0x00, 0x1F, 0x00, 0x00, 0x3E,
-    0x00, 0x16, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x24, 0x00, 0x3D, 0xBF, 0x40, 0x03, 0xFF, 0x40,
-    0x07, 0xFE, 0x00, 0x00, 0xBB, 0xD1, 0xB4, 0x00, 0x3E, 0xFE, 0x00, 0x0B, 0xF9, 0x00, 0x07, 0xFD,
-    0x00, 0x1D, 0x53, 0xD0, 0x02, 0xD0, 0x3D, 0x00, 0x3D, 0x03, 0xD0, 0x03, 0xC0, 0x3D, 0x00, 0xBC,
-    0x03, 0xD0, 0x1F, 0x40, 0x3D, 0x07, 0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x39, 0xF4, 0x00, 0x00,
-    0x00, 0xB0, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x3C, 0x00, 0x00, 0x00, 0x7D, 0x7D, 0x55, 0x50, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0xBE, 0xAA, 0xAB, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00,
-    0x3C, 0x00, 0x00, 0x2C, 0x00, 0x3C, 0x34, 0x30, 0x1C, 0x00, 0x3D, 0xFD, 0xFC, 0x2C, 0x00, 0x2F,
-    0xCF, 0xDF, 0xB8, 0x00, 0x2F, 0x03, 0x02, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x00,
-    0x00, 0x00, 0x00, 0x47, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0x90,
-    0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0x9F, 0xAF, 0xE0, 0x1F, 0x80, 0xF0, 0x2F, 0x43, 0xE0,
-    0x0F, 0x00, 0xBC, 0x3C, 0x00, 0xF0, 0x03, 0xC7, 0xC0, 0x0F, 0x00, 0x3D, 0x7C, 0x00, 0xF0, 0x02,
-    0xEB, 0x80, 0x0F, 0x00, 0x2E, 0xB8, 0x00, 0x00, 0x02, 0xEB, 0x80, 0x00, 0x00, 0x2E, 0xB8, 0x00,
-    0x00, 0x02, 0xEB, 0x80, 0x00, 0x00, 0x2E, 0x07, 0xFF, 0xE4, 0x00, 0xBF, 0xFF, 0xF0, 0x0B, 0x80,
-    0x1F, 0xC0, 0xB8, 0x00, 0x7D, 0x0B, 0x80, 0x03, 0xE0, 0xB8, 0x00, 0x3E, 0x0B, 0x80, 0x03, 0xD0,
-    0xB8, 0x00, 0x7C, 0x0B, 0xD0, 0x6F, 0x8F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFE, 0x90, 0x00, 0xB8, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x6F, 0xEA, 0x40, 0x00, 0xB8, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x87, 0x40, 0x00, 0x00,
-    0xFA, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x03, 0xF3, 0x87, 0x5F, 0x01,
-    0xF0, 0xE1, 0xD2, 0xF0, 0xF8, 0x38, 0x74, 0x3C, 0x3C, 0x0E, 0x1D, 0x0F, 0x5F, 0x03, 0x87, 0x42,
-    0xE7, 0xC0, 0xE1, 0xD0, 0xB9, 0xF0, 0x10, 0x10, 0x04, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x01, 0x05, 0x00, 0x07, 0x4E,
-    0x00, 0x07, 0x4E, 0x00, 0x7F, 0xFF, 0x00, 0xBF, 0xFF, 0xE0, 0xB8, 0x06, 0xF4, 0xB8, 0x00, 0xFC,
-    0xB8, 0x00, 0x7C, 0xB8, 0x00, 0xBC, 0xB8, 0x00, 0xF4, 0xBD, 0x57, 0xF0, 0xBF, 0xFF, 0x80, 0xBE,
-    0xAF, 0xF0, 0xB8, 0x00, 0xFC, 0xB8, 0x00, 0x3C, 0xB8, 0x00, 0x3D, 0xB8, 0x00, 0x3D, 0xB8, 0x00,
-    0x7C, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xF0, 0xBF, 0xFF, 0x80, 0x07, 0x4E, 0x00, 0x07, 0x4E, 0x00,
-    0x01, 0x05, 0x00, 0x00, 0x6A, 0x40, 0x7F, 0xFF, 0x1F, 0x95, 0x93, 0xE0, 0x00, 0x7C, 0x00, 0x0B,
-    0x80, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xEA, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0xC6, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x82, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x5F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x41, 0xFF, 0x00,
-    0x00, 0x00, 0x3D, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+static const uint8_t notosans_12_regularBitmaps[31700] = {
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0x90, 0xAC, 0x90, 0xAC, 0x90, 0xAC, 0x90, 0xAC, 0x90,
+    0xAC, 0x19, 0xC1, 0x9C, 0x19, 0xC7, 0x1D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x9D, 0x1A, 0xC9, 0x9D,
+    0x1A, 0xC9, 0x0D, 0x1A, 0xC9, 0x0C, 0xA1, 0xAC, 0x90, 0xCA, 0x19, 0xC1, 0xCA, 0x19, 0xC1, 0xA9,
+    0x2A, 0x00, 0x5A, 0xC2, 0x9C, 0x70, 0xCA, 0x2A, 0xC7, 0x0C, 0xA2, 0xD7, 0x9C, 0x92, 0xCA, 0x7A,
+    0xC3, 0xCA, 0x4A, 0xAA, 0xDA, 0xAA, 0xAC, 0xAA, 0xA9, 0x09, 0xFF, 0xFC, 0xA3, 0x9C, 0xA2, 0xD7,
+    0x9C, 0x92, 0xCA, 0x7A, 0xC3, 0xCA, 0x7D, 0x29, 0xC9, 0x39, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xCA,
+    0x39, 0xC9, 0x2D, 0x7A, 0xC3, 0xCA, 0x7A, 0xC2, 0x9C, 0x97, 0xD2, 0xAC, 0x70, 0xCA, 0x2D, 0x50,
+    0x4A, 0xC7, 0x1A, 0xC7, 0x9A, 0xEA, 0x92, 0x9F, 0xFC, 0x1D, 0xA9, 0xAC, 0x09, 0xAA, 0x09, 0xD1,
+    0xAC, 0x49, 0xD1, 0xAC, 0x49, 0xD1, 0xAC, 0x5E, 0xAD, 0x6A, 0xFA, 0x96, 0xAF, 0xC9, 0x5A, 0xC9,
+    0xE9, 0x4A, 0xC1, 0xAD, 0x4A, 0xC1, 0x9D, 0x4A, 0xC1, 0xAD, 0x9C, 0xA9, 0x0A, 0xC9, 0xAD, 0x99,
+    0xFF, 0xC9, 0x19, 0xAA, 0xAD, 0xA9, 0x7A, 0xC7, 0x1A, 0xC7, 0x19, 0x94, 0x77, 0x4E, 0xA6, 0xAC,
+    0x4D, 0xAA, 0xCA, 0x49, 0xCA, 0x39, 0xC9, 0x1A, 0xC4, 0xD4, 0xAC, 0x29, 0xC9, 0x29, 0xC9, 0x4A,
+    0xC3, 0xCA, 0x2D, 0x5D, 0x3C, 0xA1, 0xAC, 0x95, 0xAC, 0x3C, 0xA1, 0xD6, 0xAC, 0x29, 0xC9, 0x0A,
+    0xC1, 0xAD, 0xA1, 0x9C, 0xA1, 0xAC, 0x09, 0xCA, 0x0D, 0xAD, 0xA1, 0xDA, 0xAD, 0x0D, 0x09, 0xCA,
+    0x1D, 0x2E, 0xA0, 0x9C, 0xA0, 0xAC, 0x29, 0xC9, 0x6D, 0x1D, 0x29, 0xC9, 0x59, 0xC9, 0x1D, 0x29,
+    0xCA, 0x5D, 0x2D, 0x29, 0xCA, 0x4A, 0xC9, 0x2A, 0xC2, 0x9C, 0x94, 0xD3, 0x9C, 0x91, 0xAC, 0x4A,
+    0xC5, 0xD9, 0xAD, 0x39, 0xCA, 0x59, 0xF7, 0x74, 0x77, 0x49, 0xFC, 0x97, 0x19, 0xEA, 0xE9, 0x70,
+    0xDA, 0x2A, 0xCA, 0x70, 0xD3, 0x9D, 0x70, 0xD9, 0x29, 0xD7, 0x0A, 0xCA, 0x2D, 0xA7, 0x1D, 0x90,
+    0xE7, 0x29, 0xFA, 0x73, 0x9E, 0xA7, 0x3E, 0xAD, 0x94, 0xD2, 0xE1, 0x9D, 0xA2, 0x9C, 0xA1, 0x9D,
+    0x39, 0xDA, 0x1D, 0x91, 0xAC, 0xA4, 0x9D, 0xA9, 0xD2, 0xAC, 0xA5, 0x9F, 0x92, 0xAD, 0x6A, 0xE4,
+    0xDA, 0x4A, 0xFA, 0x3A, 0xFA, 0xF9, 0x9D, 0xA3, 0x9F, 0xDA, 0x29, 0xDA, 0x77, 0x20, 0x9D, 0x9D,
+    0x0D, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xA9, 0x2A, 0xC9, 0x19, 0xD2, 0xD9, 0x19, 0xD2, 0xD9, 0x2D,
+    0x29, 0xD2, 0xAC, 0xA2, 0xD9, 0x2D, 0x92, 0xD3, 0xD3, 0xD9, 0x2D, 0x92, 0xAC, 0xA2, 0xAD, 0x3D,
+    0x3D, 0x92, 0xAD, 0x3D, 0x39, 0xD3, 0xAC, 0x90, 0x0D, 0x49, 0xD4, 0xD9, 0x39, 0xD4, 0xD9, 0x3A,
+    0xCA, 0x39, 0xD4, 0xD4, 0xD9, 0x3D, 0x93, 0xAC, 0x93, 0xAC, 0x93, 0xD9, 0x3D, 0x93, 0xD3, 0x9D,
+    0x3A, 0xCA, 0x3D, 0x92, 0x9D, 0x3A, 0xCA, 0x29, 0xD3, 0xD3, 0x39, 0xD7, 0x1D, 0x71, 0xD4, 0x93,
+    0xCA, 0x29, 0x0E, 0xA9, 0xCA, 0x9E, 0xAA, 0xFF, 0xDA, 0x3E, 0x96, 0x9C, 0xAD, 0x6D, 0x09, 0xD4,
+    0xDA, 0x1D, 0xA3, 0xAC, 0x29, 0xC9, 0x75, 0x4A, 0xC7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD4, 0xAA,
+    0xAA, 0xAD, 0xAA, 0xAA, 0xAF, 0xFF, 0x4D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x77, 0x00, 0x0A,
+    0xCA, 0x0D, 0x90, 0xD0, 0x9D, 0x0A, 0xC9, 0x0D, 0x50, 0xAA, 0xAA, 0xAA, 0x0F, 0xD0, 0x99, 0x99,
+    0x99, 0x00, 0x4D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x6D, 0x6A, 0xCA, 0x6D, 0x69, 0xD6, 0xAC, 0x96,
+    0xD6, 0x9C, 0xA6, 0xD9, 0x6D, 0x6A, 0xCA, 0x6D, 0x69, 0xD6, 0xAC, 0x96, 0xD6, 0x9C, 0xA6, 0xD9,
+    0x6D, 0x6A, 0xCA, 0x60, 0x77, 0xAF, 0xA5, 0xFF, 0x3A, 0xD3, 0xDA, 0x2D, 0x94, 0xD1, 0x9D, 0x5A,
+    0xCA, 0x0A, 0xCA, 0x59, 0xD0, 0xAC, 0xA5, 0x9D, 0x0A, 0xC9, 0x6D, 0x0D, 0x96, 0xD0, 0xD9, 0x6D,
+    0x0A, 0xC9, 0x6D, 0x0A, 0xCA, 0x59, 0xD0, 0x9C, 0xA5, 0x9D, 0x09, 0xD5, 0xAC, 0xA1, 0xD9, 0x4D,
+    0x91, 0x9D, 0x3A, 0xD3, 0xEA, 0xAE, 0x5A, 0xFC, 0x77, 0x00, 0x39, 0xCA, 0x2A, 0xE1, 0xFC, 0x9D,
+    0xA9, 0xD9, 0xC9, 0x09, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39,
+    0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x75, 0x9A, 0xFA, 0x3F, 0xFC, 0x2D, 0x93, 0xE7,
+    0x1D, 0x71, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x79, 0xD7, 0x9D, 0x97, 0xD9, 0x7D, 0x97,
+    0xD9, 0x7D, 0x97, 0xD9, 0x7D, 0x97, 0xFF, 0xFF, 0xFF, 0x75, 0xAF, 0xCA, 0x29, 0xFF, 0xC9, 0x1C,
+    0xA4, 0xAD, 0x71, 0xD7, 0x1D, 0x97, 0x0D, 0x70, 0xAD, 0x69, 0xE4, 0xFC, 0x95, 0xAA, 0xFC, 0x71,
+    0xAD, 0x71, 0xAC, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x0D, 0xAA, 0x6A, 0xD0, 0xEA, 0xAA, 0xAE, 0x90,
+    0x9F, 0xEA, 0x97, 0x50, 0x79, 0xD7, 0x2E, 0x71, 0xF7, 0x09, 0xCA, 0xD7, 0x0D, 0x0D, 0x7D, 0x1D,
+    0x6A, 0xCA, 0x1D, 0x59, 0xD2, 0xD5, 0xD3, 0xD4, 0xAC, 0x93, 0xD3, 0x9C, 0xA4, 0xD3, 0xD5, 0xD2,
+    0x9F, 0xFF, 0xC9, 0xFF, 0xFC, 0x70, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x20, 0x09, 0xFF, 0xA1, 0x9F,
+    0xFA, 0x1A, 0xCA, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xD9, 0x70, 0xD7, 0x1F, 0xEA, 0x3F, 0xFC,
+    0x97, 0x9E, 0x71, 0xDA, 0x70, 0xAD, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0xDA, 0x99, 0x5A, 0xD0, 0x9E,
+    0xAA, 0xF9, 0x1A, 0xFD, 0xA7, 0x60, 0x77, 0x1A, 0xFA, 0x4A, 0xFA, 0xCA, 0x3A, 0xD9, 0x70, 0xD7,
+    0x1A, 0xCA, 0x71, 0xD7, 0x19, 0xD7, 0x19, 0xCA, 0x0A, 0xFA, 0x2A, 0xCA, 0xDA, 0xAA, 0xE1, 0xAD,
+    0xA4, 0xDA, 0x0A, 0xD5, 0x9D, 0x0A, 0xCA, 0x6D, 0x09, 0xCA, 0x6D, 0x09, 0xD6, 0xD1, 0xD9, 0x49,
+    0xD1, 0x9D, 0x4D, 0x92, 0xAD, 0xAA, 0xEA, 0x49, 0xFC, 0x97, 0x70, 0xFF, 0xF0, 0xFF, 0xF7, 0x1A,
+    0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x71, 0xAC, 0xA7, 0x1D,
+    0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x77,
+    0xAF, 0xA9, 0x4E, 0xAA, 0xE9, 0x2D, 0xA3, 0x9D, 0x2D, 0x5D, 0x91, 0xD5, 0xAC, 0x91, 0xD9, 0x4D,
+    0x2A, 0xD3, 0xAC, 0xA3, 0xAD, 0xA9, 0xDA, 0x5A, 0xFA, 0x59, 0xDA, 0xEA, 0x3A, 0xD2, 0x9E, 0x19,
+    0xD5, 0xDA, 0x0A, 0xCA, 0x59, 0xD0, 0xD9, 0x6D, 0x0A, 0xCA, 0x59, 0xD0, 0x9D, 0x5D, 0xA1, 0xAD,
+    0xAA, 0xAA, 0xE3, 0x9F, 0xDA, 0x77, 0x76, 0xAF, 0xA4, 0xFF, 0x2D, 0xA3, 0xDA, 0x09, 0xD5, 0xD0,
+    0xAC, 0xA5, 0xAC, 0xAA, 0xC9, 0x59, 0xDA, 0xC9, 0x6D, 0xAC, 0xA5, 0xAD, 0x9D, 0x49, 0xE0, 0xAD,
+    0xA9, 0x9A, 0xCA, 0xD1, 0xAF, 0xC9, 0x9D, 0x39, 0x92, 0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7, 0x0A,
+    0xCA, 0x7A, 0xD2, 0x9A, 0xAA, 0xAE, 0x39, 0xFC, 0xA7, 0x70, 0x09, 0xA9, 0x0E, 0x0E, 0x09, 0xA7,
+    0x77, 0x5D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x1A, 0xA9, 0x1E, 0x1E, 0x19, 0xA7, 0x77, 0x75, 0xD9,
+    0x1D, 0x19, 0xD1, 0xAC, 0xA1, 0xD2, 0xCA, 0x60, 0x77, 0x69, 0xC7, 0x09, 0xE6, 0x9E, 0x95, 0x9E,
+    0x95, 0x9E, 0x95, 0x9E, 0x97, 0xAD, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0xA9, 0x71, 0xAE, 0x97, 0x1A,
+    0xE7, 0x29, 0xC7, 0x50, 0x73, 0xAF, 0xFE, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x3A,
+    0xFF, 0xE9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x74, 0xAA, 0x72, 0xAD, 0xA7, 0x19, 0xEA, 0x71,
+    0x9E, 0xA7, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x09, 0xE6, 0x9E, 0xA5, 0xAE, 0x94, 0x9F, 0x95, 0xAD,
+    0xA7, 0x0A, 0xA7, 0x77, 0x73, 0x9A, 0xFA, 0x2A, 0xFF, 0x91, 0xA9, 0x3A, 0xD7, 0x0D, 0x70, 0xD7,
+    0x0D, 0x7A, 0xCA, 0x6A, 0xD6, 0xE6, 0xDA, 0x69, 0xD7, 0x9C, 0x97, 0x9C, 0x97, 0x77, 0x5A, 0xCA,
+    0x7E, 0x7E, 0x70, 0x95, 0x69, 0xAF, 0xA9, 0x72, 0x9F, 0xFD, 0x97, 0xE9, 0x5A, 0xD9, 0x5D, 0x97,
+    0x1D, 0x93, 0xAC, 0x97, 0x3D, 0x29, 0xCA, 0x3A, 0xFA, 0x91, 0x9C, 0x91, 0xAC, 0x3E, 0xAA, 0xDA,
+    0x2C, 0xA1, 0xD2, 0xD9, 0x29, 0xC9, 0x2D, 0x09, 0xC9, 0x2D, 0x39, 0xC9, 0x2A, 0xC0, 0x9C, 0x91,
+    0x9C, 0xA3, 0xAC, 0x92, 0xAC, 0x0A, 0xC9, 0x1A, 0xC9, 0x3A, 0xC9, 0x2D, 0x0A, 0xC9, 0x19, 0xC9,
+    0x3D, 0x92, 0xCA, 0x09, 0xC9, 0x19, 0xD3, 0xD9, 0x19, 0xC9, 0x09, 0xCA, 0x2D, 0xA9, 0x9C, 0xAD,
+    0x99, 0xD2, 0xD3, 0xFA, 0x1F, 0x3A, 0xC9, 0x49, 0x49, 0x6D, 0x77, 0x29, 0xD9, 0x79, 0x70, 0x9E,
+    0xAA, 0x99, 0xAA, 0xD7, 0x29, 0xFF, 0x97, 0x77, 0x20, 0x6D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C,
+    0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6,
+    0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9,
+    0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D,
+    0x9D, 0x97, 0x1A, 0xD0, 0x9F, 0xDA, 0xA9, 0x2A, 0xFF, 0xD1, 0xAC, 0xA4, 0xAE, 0x0A, 0xCA, 0x59,
+    0xD0, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD0, 0xAC, 0xA5, 0x9D, 0x0A, 0xD9, 0x99, 0x99, 0xAD, 0x1A,
+    0xFF, 0xA2, 0xAD, 0xAA, 0xAA, 0xAE, 0x90, 0xAC, 0xA5, 0x9D, 0x9A, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6,
+    0xAD, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xDA, 0xAC, 0xA5, 0xE9, 0xAF, 0xFD, 0x90, 0xAF, 0xFA, 0x20,
+    0x77, 0x39, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9E, 0x94, 0xA9, 0x2E, 0x72, 0xAD, 0x73, 0xDA, 0x73,
+    0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x39,
+    0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xFA, 0xAE, 0x94, 0x9A, 0xFE, 0x77, 0x00, 0x9F, 0xDA, 0xA9, 0x4A,
+    0xFF, 0xD9, 0x2A, 0xCA, 0x39, 0xAE, 0x91, 0xAC, 0xA6, 0xAD, 0x90, 0xAC, 0xA7, 0xE0, 0xAC, 0xA7,
+    0x9D, 0x0A, 0xCA, 0x70, 0xD9, 0xAC, 0xA7, 0x0D, 0xAA, 0xCA, 0x70, 0xAC, 0xAA, 0xCA, 0x70, 0xAC,
+    0xAA, 0xCA, 0x70, 0xDA, 0xAC, 0xA7, 0x0D, 0x9A, 0xCA, 0x79, 0xD0, 0xAC, 0xA7, 0xE0, 0xAC, 0xA6,
+    0xAD, 0x1A, 0xCA, 0x49, 0xE9, 0x1A, 0xFF, 0xD9, 0x2A, 0xFE, 0xA9, 0x40, 0x9F, 0xFC, 0x9A, 0xFF,
+    0xC9, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90,
+    0xAF, 0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF,
+    0xFC, 0x0A, 0xD9, 0x99, 0x99, 0x99, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xCA, 0x70, 0x77, 0x49, 0xAF, 0xDA, 0x94, 0xFF, 0xE3, 0xEA, 0x49, 0xA9, 0x2E,
+    0x73, 0xAD, 0x74, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x49, 0xD5, 0x99, 0x99, 0x99, 0x09, 0xD5, 0xFD,
+    0x99, 0xD5, 0x9A, 0xAA, 0xD9, 0x9D, 0x71, 0xD9, 0x0D, 0x97, 0x0D, 0x90, 0xAD, 0x70, 0xD9, 0x1D,
+    0xA7, 0xD9, 0x19, 0xE9, 0x5D, 0x92, 0x9F, 0xCA, 0xAF, 0x94, 0xAF, 0xFA, 0x77, 0x00, 0x9C, 0xA7,
+    0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A,
+    0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xD9, 0x99, 0x99, 0x99, 0x99, 0xD0, 0xAF, 0xFF, 0xC0,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70,
+    0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC,
+    0xA7, 0x0D, 0x00, 0xFD, 0x9A, 0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D,
+    0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19, 0xAE, 0xA0, 0xFD, 0x90,
+    0x3A, 0xC9, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA,
+    0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA,
+    0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3D, 0x99, 0x09, 0xE0, 0xFC, 0x90, 0xAA, 0xAA, 0x20, 0x9C,
+    0xA6, 0xAC, 0xA0, 0xAC, 0xA5, 0xAD, 0x1A, 0xCA, 0x4A, 0xD2, 0xAC, 0xA3, 0x9D, 0x3A, 0xCA, 0x29,
+    0xD9, 0x3A, 0xCA, 0x2D, 0x94, 0xAC, 0xA1, 0xD9, 0x5A, 0xCA, 0x0D, 0xA6, 0xAC, 0xAE, 0xA6, 0xAE,
+    0xAD, 0x95, 0xAD, 0x90, 0xAD, 0x5A, 0xCA, 0x2D, 0xA4, 0xAC, 0xA2, 0x9D, 0x93, 0xAC, 0xA3, 0xAD,
+    0x3A, 0xCA, 0x4E, 0x2A, 0xCA, 0x5D, 0xA1, 0xAC, 0xA5, 0x9D, 0x90, 0xAC, 0xA6, 0xAD, 0x00, 0x9C,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF,
+    0xFC, 0x9A, 0xFF, 0xC9, 0x9E, 0x72, 0xE0, 0xAE, 0x97, 0x0A, 0xE9, 0xAE, 0xA7, 0x0F, 0x9A, 0xCA,
+    0xD7, 0x9C, 0xAD, 0x9A, 0xC9, 0xD9, 0x6A, 0xC9, 0xD9, 0xAC, 0x99, 0xD6, 0xD0, 0xD9, 0xAC, 0x90,
+    0xD5, 0x9C, 0xA0, 0xD9, 0xAC, 0xA0, 0xAC, 0xA4, 0xD1, 0xD9, 0xAC, 0xA0, 0x9D, 0x39, 0xD1, 0xD9,
+    0xAC, 0xA1, 0xD9, 0x2A, 0xC9, 0x1D, 0x9A, 0xCA, 0x1A, 0xCA, 0x2D, 0x2D, 0x9A, 0xCA, 0x2D, 0x19,
+    0xCA, 0x2D, 0x9A, 0xCA, 0x2D, 0x90, 0xD9, 0x2D, 0x9A, 0xCA, 0x29, 0xD0, 0xD3, 0xD9, 0xAC, 0xA3,
+    0xDA, 0xC9, 0x3D, 0x9A, 0xCA, 0x3A, 0xE4, 0xD9, 0xAC, 0xA3, 0x9D, 0xA4, 0xD9, 0xAC, 0xA4, 0xD9,
+    0x4D, 0x90, 0x9D, 0x97, 0x9C, 0x9A, 0xE7, 0xAC, 0xAA, 0xEA, 0x6A, 0xCA, 0xAC, 0xAD, 0x6A, 0xCA,
+    0xAC, 0x9A, 0xD5, 0xAC, 0xAA, 0xC9, 0x0D, 0x94, 0xAC, 0xAA, 0xC9, 0x09, 0xD4, 0xAC, 0xAA, 0xC9,
+    0x1E, 0x3A, 0xCA, 0xAC, 0xA2, 0xD9, 0x2A, 0xCA, 0xAC, 0xA2, 0xAD, 0x2A, 0xCA, 0xAC, 0xA3, 0xDA,
+    0x1A, 0xCA, 0xAC, 0xA4, 0xD9, 0x0A, 0xCA, 0xAC, 0xA4, 0xAD, 0x09, 0xCA, 0xAC, 0xA5, 0xDA, 0x9C,
+    0xAA, 0xCA, 0x59, 0xDA, 0xCA, 0xAC, 0xA6, 0xAE, 0xAA, 0xCA, 0x7E, 0xAA, 0xCA, 0x79, 0xDA, 0x77,
+    0x5A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D,
+    0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7,
+    0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A,
+    0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74, 0x9F, 0xDA, 0x92, 0xAF, 0xFC, 0x90,
+    0xAC, 0xA3, 0x9E, 0x0A, 0xCA, 0x5D, 0xAA, 0xCA, 0x5A, 0xDA, 0xCA, 0x59, 0xDA, 0xCA, 0x5A, 0xCA,
+    0xAC, 0xA5, 0xD9, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xC1, 0xAF, 0xDA, 0x92, 0xAC, 0xA7, 0x0A, 0xCA,
+    0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x00, 0x77, 0x5A,
+    0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97,
+    0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29,
+    0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xE2, 0xAD, 0xA4,
+    0x9E, 0x4A, 0xFA, 0xAF, 0x69, 0xAF, 0xDA, 0x74, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x97, 0x5E,
+    0x97, 0x59, 0x91, 0x9F, 0xDA, 0x94, 0xAF, 0xFC, 0x92, 0xAC, 0xA3, 0x9E, 0x2A, 0xCA, 0x5D, 0xA1,
+    0xAC, 0xA5, 0xAD, 0x1A, 0xCA, 0x59, 0xD1, 0xAC, 0xA5, 0xAC, 0xA1, 0xAC, 0xA5, 0xD9, 0x1A, 0xD9,
+    0x99, 0x9A, 0xDA, 0x2A, 0xFF, 0x93, 0xAD, 0xAA, 0xAD, 0xA4, 0xAC, 0xA2, 0x9D, 0x4A, 0xCA, 0x3A,
+    0xD3, 0xAC, 0xA4, 0xD9, 0x2A, 0xCA, 0x4A, 0xD2, 0xAC, 0xA5, 0xDA, 0x1A, 0xCA, 0x59, 0xD9, 0x0A,
+    0xCA, 0x6A, 0xD0, 0x76, 0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0x1D, 0xA4, 0x99, 0x09, 0xD7, 0x09, 0xD7,
+    0x09, 0xD7, 0x1D, 0xA7, 0x0A, 0xE9, 0x79, 0xFA, 0x7A, 0xFA, 0x79, 0xEA, 0x70, 0x9D, 0x97, 0x0D,
+    0x97, 0x0A, 0xCA, 0x70, 0xD9, 0x99, 0x5A, 0xD0, 0xAE, 0xAA, 0xF9, 0x09, 0xFE, 0xA7, 0x60, 0xAF,
+    0xFF, 0xAF, 0xFF, 0xCA, 0x49, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D,
+    0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x50, 0xAC, 0x97, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9,
+    0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77, 0x00, 0xAC, 0x97, 0x09, 0xCA, 0xAD, 0x70, 0xDA, 0x0D,
+    0x70, 0xD1, 0xDA, 0x6A, 0xD1, 0x9D, 0x6D, 0x92, 0xD5, 0x9D, 0x3A, 0xCA, 0x4A, 0xCA, 0x39, 0xD4,
+    0xD9, 0x4D, 0x92, 0x9D, 0x5A, 0xCA, 0x2A, 0xCA, 0x59, 0xD2, 0xD9, 0x6D, 0x90, 0x9D, 0x7A, 0xCA,
+    0x0A, 0xCA, 0x70, 0xD0, 0xD7, 0x1D, 0xAD, 0x71, 0xAE, 0xA7, 0x2E, 0x73, 0xE5, 0xAC, 0xA6, 0xAC,
+    0xA6, 0x9C, 0xA9, 0xD6, 0xE6, 0xDA, 0x0D, 0x94, 0x9E, 0x95, 0xD9, 0x0D, 0xA4, 0xAC, 0xAC, 0xA4,
+    0x9D, 0x1A, 0xD4, 0xD9, 0xD4, 0xAD, 0x19, 0xD4, 0xD0, 0xD9, 0x3D, 0xA2, 0xD9, 0x29, 0xCA, 0x0A,
+    0xCA, 0x3D, 0x3D, 0xA2, 0xD9, 0x1D, 0x29, 0xD3, 0x9D, 0x2D, 0x2D, 0x2A, 0xCA, 0x4D, 0x19, 0xD2,
+    0xAC, 0xA1, 0xD9, 0x4D, 0x90, 0xAC, 0x92, 0x9D, 0x1D, 0x5A, 0xCA, 0x0D, 0x4D, 0x09, 0xD5, 0x9D,
+    0x0D, 0x4A, 0xC9, 0xAC, 0xA6, 0xD9, 0xCA, 0x49, 0xCA, 0xAC, 0x96, 0xDA, 0xC9, 0x5F, 0x7A, 0xE6,
+    0xF7, 0x9D, 0xA6, 0xAD, 0xA7, 0x0D, 0x97, 0xD9, 0x30, 0x0D, 0x79, 0xCA, 0x1A, 0xD6, 0xD9, 0x2D,
+    0x94, 0xAC, 0xA3, 0x9D, 0x39, 0xD5, 0xAC, 0xA2, 0xD9, 0x6D, 0x90, 0xAC, 0xA7, 0x9D, 0x9D, 0x71,
+    0xF9, 0x72, 0xE7, 0x29, 0xE7, 0x2D, 0xAD, 0x70, 0xDA, 0x0D, 0x96, 0x9D, 0x19, 0xD6, 0xD9, 0x2A,
+    0xCA, 0x4A, 0xCA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xD9, 0x6D, 0xA0, 0xAD, 0x79, 0xD0, 0xAC, 0xA7,
+    0x9D, 0x09, 0xD7, 0xD9, 0x1A, 0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5, 0xD9, 0x2D,
+    0x6A, 0xD1, 0xAC, 0xA7, 0xD9, 0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7, 0x3D, 0x74,
+    0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x60, 0x0A, 0xFF, 0xE1, 0xFF, 0xF7, 0x2D, 0xA7,
+    0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97,
+    0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2F, 0xFF, 0x90, 0xFF, 0xF9, 0xFC,
+    0xAF, 0xCA, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xFC, 0xAF, 0xCA, 0xAC, 0x96, 0x9D, 0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9,
+    0x69, 0xD7, 0xD7, 0xAC, 0xA6, 0x9D, 0x7D, 0x96, 0xAC, 0xA7, 0xD7, 0xD9, 0x69, 0xD7, 0xD7, 0xAC,
+    0xA6, 0x9D, 0x00, 0x9F, 0xC0, 0x9F, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+    0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD0, 0x9F, 0xC0, 0x9F, 0xC0, 0x5C, 0xA7, 0x29,
+    0xD9, 0x71, 0xF7, 0x09, 0xC9, 0xAC, 0x97, 0xD1, 0xD6, 0x9C, 0xA1, 0xAC, 0x95, 0xD3, 0xD4, 0x9C,
+    0xA3, 0xAC, 0x93, 0xAC, 0x5D, 0x3C, 0xA5, 0xAC, 0x91, 0xAC, 0x96, 0xD1, 0x99, 0x70, 0x90, 0x0F,
+    0xFE, 0x1F, 0xFE, 0x00, 0x5A, 0xD3, 0xDA, 0x3D, 0x93, 0xAA, 0x00, 0x39, 0xAA, 0xA9, 0x3F, 0xF2,
+    0xCA, 0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94,
+    0xFA, 0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0xD9,
+    0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x09, 0xAA, 0xA9, 0x2D, 0x9F, 0xDA,
+    0x1F, 0x91, 0x9E, 0x0E, 0x5D, 0x9D, 0xA5, 0xAC, 0xAD, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95,
+    0x9F, 0xA5, 0xAF, 0xC5, 0xDA, 0xE9, 0x3A, 0xD0, 0xDA, 0xDA, 0xAE, 0x90, 0xD0, 0x9F, 0xC9, 0x75,
+    0x39, 0xAA, 0xA9, 0x39, 0xFE, 0x2E, 0x99, 0x9A, 0xA1, 0xDA, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xD7, 0x0F, 0xAA, 0xD3, 0xAF, 0xCA, 0x73, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x39, 0xAA, 0x91, 0xD9, 0x19, 0xFD, 0x9D, 0x90,
+    0x9D, 0xA9, 0x09, 0xF9, 0x0D, 0xA4, 0xE9, 0x9D, 0x59, 0xD9, 0x9D, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A,
+    0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x99, 0xD6, 0xD9, 0x0D, 0x59, 0xD9, 0x0E, 0x4E, 0x91, 0xEA, 0xAA,
+    0xF9, 0x2A, 0xFA, 0x0A, 0xC9, 0x74, 0x39, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1,
+    0xDA, 0x4D, 0x90, 0xD5, 0xAC, 0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xCA, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA, 0x74, 0x75,
+    0x9F, 0x92, 0x9E, 0xAC, 0x92, 0xD9, 0x6D, 0x69, 0xD6, 0xAD, 0x99, 0x91, 0xAF, 0xE9, 0x19, 0x9D,
+    0x99, 0x93, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69,
+    0xD6, 0x9D, 0x40, 0x39, 0xAA, 0x92, 0x92, 0x9F, 0xD9, 0xAC, 0x90, 0x9D, 0xA9, 0x09, 0xF9, 0x0D,
+    0xA4, 0xE9, 0x9D, 0x59, 0xD9, 0x9D, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D,
+    0x99, 0xD6, 0xD9, 0x0D, 0x59, 0xD9, 0x0E, 0x4E, 0x91, 0xEA, 0xAA, 0xF9, 0x2A, 0xFA, 0x0D, 0x97,
+    0x1D, 0x72, 0xD7, 0x19, 0xD1, 0x99, 0x49, 0xDA, 0x1A, 0xFF, 0xA3, 0xAF, 0xCA, 0x92, 0xD9, 0x70,
+    0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x1A, 0xAA, 0x92, 0xD9, 0xAF, 0xD1, 0xF9,
+    0x90, 0x9E, 0x0E, 0x5D, 0x0D, 0xA5, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95,
+    0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x90, 0x19, 0x1D,
+    0x90, 0xD9, 0x19, 0x59, 0x91, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D,
+    0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x49, 0x4D, 0x93, 0xD9, 0x49, 0x73, 0x99, 0x4D,
+    0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x29, 0xD0, 0x9F, 0xA0, 0x9E, 0xA1, 0xD9, 0x70, 0xD9,
+    0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x49, 0x91, 0xD9, 0x3A, 0xD1, 0xD9, 0x2A, 0xD2,
+    0xD9, 0x1A, 0xD3, 0xD9, 0x0A, 0xD4, 0xD9, 0x9D, 0x5D, 0x9D, 0xA5, 0xFD, 0x5E, 0x0A, 0xD4, 0xD9,
+    0x1D, 0xA3, 0xD9, 0x2D, 0x92, 0xD9, 0x29, 0xD2, 0xD9, 0x3A, 0xD1, 0xD9, 0x4D, 0xA0, 0xD9, 0xD9,
+    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xD9, 0x99, 0x19, 0xAA, 0xA9, 0x39, 0xAA, 0x92, 0xD0, 0xFD, 0xA0, 0xAF, 0xD1, 0xF9, 0x09, 0xAD,
+    0xAC, 0xA9, 0x09, 0xE0, 0xE4, 0xAD, 0xA4, 0xD0, 0xDA, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9,
+    0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9,
+    0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9,
+    0x99, 0x19, 0xAA, 0xA9, 0x2D, 0x0A, 0xFD, 0x1F, 0x99, 0x09, 0xE0, 0xE5, 0xD0, 0xDA, 0x5D, 0x9D,
+    0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95,
+    0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9,
+    0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC,
+    0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7,
+    0x70, 0x99, 0x19, 0xAA, 0xA9, 0x2D, 0x0F, 0xE1, 0xF9, 0x90, 0x9E, 0x0E, 0x49, 0xD9, 0xDA, 0x5A,
+    0xCA, 0xD9, 0x59, 0xF9, 0x59, 0xF9, 0x59, 0xF9, 0x59, 0xFA, 0x5A, 0xFC, 0x5D, 0xAE, 0xA3, 0xAD,
+    0x0D, 0xAD, 0xAA, 0xE9, 0x0D, 0x99, 0xFC, 0x91, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70,
+    0xD9, 0x70, 0xD9, 0x70, 0x39, 0xAA, 0x92, 0x92, 0x9F, 0xD9, 0xAC, 0x90, 0x9D, 0xA9, 0x09, 0xF9,
+    0x0D, 0xA4, 0xE9, 0x9D, 0x59, 0xD9, 0x9D, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA,
+    0x6D, 0x99, 0xD6, 0xD9, 0x0D, 0x59, 0xD9, 0x0E, 0x4E, 0x91, 0xEA, 0xAA, 0xF9, 0x2A, 0xFA, 0x0D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x90, 0x99, 0x2A, 0xAA,
+    0xD0, 0x9F, 0xD9, 0xD9, 0x99, 0xEA, 0x3E, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xD9, 0x4D, 0x94, 0x29, 0xAA, 0xA9, 0x2A, 0xFE, 0x99, 0xD9, 0x19, 0xAC, 0x0A, 0xC9,
+    0x6A, 0xCA, 0x69, 0xDA, 0x69, 0xF9, 0x5A, 0xF9, 0x59, 0xE9, 0x6A, 0xCA, 0x69, 0xD9, 0x5A, 0xCA,
+    0xAD, 0xAA, 0xAE, 0x09, 0xFD, 0xA7, 0x30, 0x29, 0x7C, 0xA5, 0x9C, 0xA4, 0x9D, 0xA9, 0x99, 0x0A,
+    0xFE, 0x90, 0x9D, 0xA9, 0x99, 0x2A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A,
+    0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xD6, 0xEA, 0xA9, 0x29, 0xF9, 0x70, 0x09, 0x96, 0x99, 0x1D,
+    0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD9, 0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA, 0xAA, 0xF9,
+    0x19, 0xFC, 0xA0, 0xAC, 0x97, 0x40, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x9D, 0x59, 0xD1, 0xD9,
+    0x4A, 0xCA, 0x1A, 0xD4, 0xD3, 0xD3, 0x9D, 0x3D, 0x92, 0xD9, 0x39, 0xD2, 0xD5, 0xD1, 0x9C, 0xA5,
+    0xAC, 0xA0, 0xD9, 0x59, 0xD0, 0xD7, 0xDA, 0xCA, 0x79, 0xE7, 0x1E, 0x40, 0x99, 0x95, 0x99, 0x59,
+    0x90, 0x9D, 0x4A, 0xD9, 0x4D, 0x1D, 0x4E, 0xA3, 0x9D, 0x1D, 0x92, 0x9C, 0xAD, 0x3A, 0xCA, 0x1A,
+    0xCA, 0x2A, 0xC9, 0xD3, 0xD9, 0x19, 0xD2, 0xD0, 0x9C, 0xA2, 0xD3, 0xD2, 0xD1, 0xD1, 0x9C, 0xA3,
+    0xD9, 0x0A, 0xCA, 0x1D, 0x1A, 0xC9, 0x3A, 0xCA, 0x0D, 0x2A, 0xC9, 0x0D, 0x49, 0xD0, 0xD2, 0x9D,
+    0x0D, 0x5D, 0x9C, 0xA3, 0xD9, 0xCA, 0x5A, 0xE4, 0xAE, 0x95, 0x9E, 0x49, 0xE7, 0xDA, 0x5E, 0x30,
+    0x09, 0x96, 0x99, 0x1A, 0xD4, 0xAD, 0x2D, 0x93, 0xD3, 0x9D, 0x2D, 0x94, 0xAD, 0x0A, 0xD6, 0xDA,
+    0xD7, 0x0E, 0x97, 0x0E, 0x70, 0xAF, 0x69, 0xD0, 0xDA, 0x5D, 0x91, 0xD9, 0x3D, 0xA2, 0x9D, 0x29,
+    0xD4, 0xAC, 0xA1, 0xD9, 0x5D, 0x90, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x0D, 0x59, 0xD1, 0xD9,
+    0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA, 0x4D, 0x2D, 0x5D, 0x90,
+    0x9D, 0x59, 0xCA, 0x0D, 0x96, 0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71, 0xE7, 0x1D, 0x97, 0x1D,
+    0x71, 0xAC, 0xA7, 0x09, 0xD6, 0xAF, 0x96, 0xAE, 0x97, 0x19, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFA,
+    0x19, 0x99, 0x99, 0x9D, 0x96, 0xAC, 0xA6, 0x9D, 0x7D, 0x96, 0xDA, 0x69, 0xD7, 0xD7, 0xD9, 0x6A,
+    0xD6, 0x9D, 0x7E, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xD0, 0x5A, 0xAA, 0x39, 0xEA, 0x3D, 0xA5, 0xD5,
+    0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x5D, 0xA2, 0x9E, 0x93, 0x9E, 0x95, 0x9D, 0xA5, 0x9D,
+    0x59, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x6D, 0x6D, 0xA5, 0x9E, 0xA5, 0xAC, 0xA0, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x20, 0x0C, 0xA9, 0x5F, 0x59, 0xD9, 0x5A, 0xCA, 0x59, 0xD5,
+    0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD6, 0xD9, 0x6A, 0xDA, 0x4A, 0xE3, 0xDA, 0x49, 0xD5, 0x9D, 0x59,
+    0xD5, 0x9D, 0x59, 0xD5, 0xAC, 0xA4, 0x9D, 0x93, 0xF4, 0xD9, 0x40, 0x19, 0x99, 0x79, 0xFC, 0xA9,
+    0x19, 0xC0, 0xD9, 0x9A, 0xFE, 0x09, 0x49, 0xAD, 0xA1, 0x09, 0xA1, 0xE0, 0xE0, 0x9A, 0x95, 0x91,
+    0x9C, 0x19, 0xC1, 0xAC, 0x1A, 0xC1, 0xAC, 0x90, 0xAC, 0x90, 0xAC, 0x90, 0xD9, 0x0D, 0x90, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0A, 0xA9, 0x77, 0xD7, 0x0D, 0x6A, 0xFC, 0xA2, 0xFF, 0x1A, 0xD9, 0x6D, 0x79,
+    0xD7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xDA, 0x29, 0xA2,
+    0xAF, 0xE3, 0x9A, 0xEA, 0x6D, 0x70, 0xD7, 0x60, 0x77, 0x29, 0xFC, 0xA5, 0xAF, 0xEA, 0x39, 0xD9,
+    0x39, 0x4A, 0xCA, 0x72, 0xAC, 0x97, 0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2A, 0xC9, 0x70, 0xAA, 0xEA,
+    0xAA, 0xA9, 0x3F, 0xFC, 0xA5, 0xAC, 0x97, 0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2D, 0x97, 0x2D, 0x72,
+    0xD9, 0x71, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0x74, 0xCA, 0x09, 0xAA, 0xA0, 0x9C, 0x90, 0xAF, 0xFC,
+    0x2D, 0x92, 0xD9, 0x19, 0xC9, 0x4C, 0xA1, 0xAC, 0x5A, 0xC1, 0xAC, 0x5A, 0xC1, 0xAC, 0x5D, 0x2D,
+    0x3A, 0xC9, 0x19, 0xEA, 0xAE, 0xA1, 0xD9, 0xAE, 0x9A, 0xC9, 0x09, 0x7A, 0x00, 0x9C, 0xA7, 0xAC,
+    0xA0, 0xD9, 0x6D, 0x19, 0xD5, 0xAC, 0xA2, 0xD9, 0x4D, 0x39, 0xD3, 0xAC, 0xA4, 0xD9, 0x2D, 0x59,
+    0xD1, 0xAC, 0xA6, 0xD9, 0x0D, 0x70, 0xDA, 0xC9, 0x59, 0x99, 0xF9, 0x99, 0x3A, 0xFF, 0xC7, 0xD9,
+    0x72, 0xD7, 0xAF, 0xFC, 0x3A, 0xFF, 0xC7, 0xD7, 0x3D, 0x73, 0xD5, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0A, 0x97, 0x7A, 0x90, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+    0xD2, 0x74, 0xAF, 0xD9, 0x1A, 0xDA, 0xAA, 0xDA, 0x1D, 0x70, 0xD7, 0x0E, 0x70, 0xF9, 0x5F, 0xD9,
+    0x2D, 0x2A, 0xDA, 0x09, 0xCA, 0x4D, 0x09, 0xCA, 0x4D, 0x1D, 0x93, 0xD1, 0x9E, 0x90, 0xAC, 0xA3,
+    0xAF, 0xA6, 0x9E, 0x97, 0xAD, 0x70, 0xD0, 0x95, 0x9D, 0x0A, 0xDA, 0xAA, 0xAD, 0x91, 0xAF, 0xCA,
+    0x97, 0x40, 0x70, 0xD1, 0x9C, 0xA0, 0xD1, 0x9C, 0xA7, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xDA, 0x99,
+    0x09, 0xAD, 0xA6, 0xD7, 0x9D, 0x4C, 0xA3, 0x99, 0x99, 0x2D, 0x2A, 0xC2, 0x9F, 0xCA, 0x19, 0xC9,
+    0x1C, 0x92, 0xD9, 0x19, 0x92, 0xAC, 0x09, 0xC2, 0xAC, 0x97, 0x9C, 0x0A, 0xC2, 0xD7, 0x1C, 0x9C,
+    0xA2, 0xD7, 0x1C, 0xAC, 0xA2, 0xD7, 0x1C, 0xAA, 0xC2, 0xD7, 0x1C, 0x99, 0xC2, 0xD9, 0x70, 0xC9,
+    0x0C, 0x91, 0x9D, 0x7A, 0xC1, 0xAC, 0x2A, 0xFC, 0xA2, 0xCA, 0x2C, 0xA3, 0xAA, 0xA9, 0x2D, 0x39,
+    0xCA, 0x70, 0xD5, 0x9D, 0xA9, 0x29, 0xAD, 0x70, 0x9F, 0xE9, 0x77, 0x70, 0x70, 0x9F, 0xA1, 0x9A,
+    0x99, 0xAC, 0x95, 0xCA, 0x19, 0xAA, 0xAC, 0xA0, 0xAC, 0xA9, 0x9C, 0xA0, 0xCA, 0x2C, 0xA0, 0xCA,
+    0x19, 0xCA, 0x0A, 0xFC, 0xA1, 0x99, 0x92, 0x3A, 0x3A, 0x3D, 0x91, 0xD9, 0x1A, 0xCA, 0x1A, 0xCA,
+    0x1A, 0xD1, 0xAD, 0x19, 0xD1, 0x9D, 0x2D, 0x91, 0xD9, 0x3D, 0x19, 0xD3, 0x9D, 0x19, 0xD3, 0xAD,
+    0x1A, 0xD3, 0xAC, 0xA1, 0xAC, 0x93, 0x93, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xF7,
+    0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1A, 0xC0, 0xAA, 0xAA, 0xAA, 0x0F, 0xD0, 0x99, 0x99, 0x99,
+    0x00, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xDA, 0x99, 0x09, 0xAD, 0xA6, 0xD7, 0x9D, 0x4C, 0xA1, 0x99,
+    0x99, 0x93, 0xD2, 0xAC, 0x2F, 0xD9, 0x19, 0xC9, 0x1C, 0x92, 0xD0, 0x9A, 0xD2, 0xAC, 0x09, 0xC3,
+    0xD2, 0xD2, 0x9C, 0x0A, 0xC3, 0xD2, 0xD3, 0xC9, 0xCA, 0x3D, 0x99, 0xAC, 0xA3, 0xCA, 0xCA, 0x3F,
+    0xCA, 0x4C, 0xAA, 0xC3, 0xD0, 0x9C, 0xA4, 0xC9, 0x9C, 0x3D, 0x1D, 0x93, 0xC9, 0x0C, 0x92, 0xD1,
+    0x9D, 0x2A, 0xC1, 0xAC, 0x2D, 0x2A, 0xC9, 0x1C, 0xA2, 0xCA, 0x1A, 0x93, 0xA9, 0x0D, 0x39, 0xCA,
+    0x70, 0xD5, 0x9D, 0xA9, 0x29, 0xAD, 0x70, 0x9F, 0xE9, 0x77, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x0F, 0xFF, 0xA0, 0x72, 0xAE, 0xA2, 0xD9, 0x9A, 0xCA, 0x09, 0xC9, 0x2A, 0xC0, 0xAC,
+    0x39, 0xC9, 0xAC, 0x39, 0xC9, 0x0C, 0xA2, 0xD1, 0x9F, 0xC9, 0x39, 0xA9, 0x20, 0x4A, 0xC7, 0x2D,
+    0x72, 0xD7, 0x2D, 0x72, 0xD5, 0xAF, 0xFE, 0x0F, 0xFF, 0x5D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x2D,
+    0x77, 0x2A, 0xFF, 0xE0, 0xFF, 0xF0, 0x29, 0x93, 0xAF, 0xA1, 0xCA, 0x1A, 0xC9, 0x5C, 0xA5, 0xCA,
+    0x4A, 0xC4, 0xAC, 0x93, 0xAC, 0x93, 0xAC, 0x93, 0xAC, 0x93, 0x9F, 0xDA, 0x0A, 0xAA, 0xAA, 0xA9,
+    0x29, 0x94, 0xAF, 0xA2, 0xC9, 0x1A, 0xCA, 0x6C, 0xA5, 0x9C, 0x92, 0xAA, 0xDA, 0x3A, 0xF7, 0xD6,
+    0xD6, 0xD0, 0xAD, 0xAA, 0xD9, 0x1A, 0xAD, 0xA2, 0x7D, 0xA1, 0xAD, 0x19, 0xD2, 0xAA, 0x30, 0x99,
+    0x69, 0x90, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95,
+    0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0xA5, 0xD9, 0xE4, 0xE9, 0xFA, 0xAA, 0xDA,
+    0xC9, 0xDA, 0xFA, 0x09, 0xC9, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9,
+    0x70, 0x2A, 0xFF, 0xA0, 0x9F, 0xE9, 0x9C, 0xA0, 0xFE, 0xA1, 0xAA, 0x9F, 0xEA, 0x1A, 0xAA, 0xFE,
+    0xA1, 0xAA, 0xAF, 0xEA, 0x1A, 0xAA, 0xFE, 0xA1, 0xAA, 0xAF, 0xEA, 0x1A, 0xA9, 0xFE, 0xA1, 0xAA,
+    0x0F, 0xEA, 0x1A, 0xA0, 0xAF, 0xDA, 0x1A, 0xA1, 0xAF, 0xCA, 0x1A, 0xA3, 0x99, 0x9C, 0xA1, 0xAA,
+    0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A,
+    0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x6A, 0xA1, 0xAA, 0x74, 0x4D, 0xA0, 0xE0, 0xDA,
+    0x19, 0x00, 0x1C, 0xA2, 0x9C, 0xA3, 0x9D, 0x3A, 0xC9, 0x99, 0x9D, 0x0A, 0xDA, 0x10, 0x70, 0xAD,
+    0x1F, 0x0D, 0x0A, 0xC3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x9A, 0x72, 0x9E, 0xA2, 0x9C,
+    0xA9, 0x9D, 0x1C, 0xA2, 0x9C, 0x90, 0xC9, 0x3C, 0xA0, 0xC9, 0x3C, 0xA0, 0xCA, 0x3C, 0x90, 0xAC,
+    0x2A, 0xC2, 0xFC, 0x93, 0x99, 0x92, 0x1A, 0x3A, 0x4A, 0xCA, 0x1D, 0xA4, 0xD9, 0x1D, 0x94, 0xD9,
+    0x1D, 0x93, 0x9D, 0x19, 0xD4, 0xAC, 0xA1, 0xDA, 0x29, 0xD1, 0x9D, 0x29, 0xD1, 0x9D, 0x3D, 0x91,
+    0xD9, 0x2D, 0x91, 0xD9, 0x49, 0x39, 0x30, 0x29, 0xD7, 0xCA, 0x4A, 0xE6, 0xD4, 0xD9, 0xD5, 0x9C,
+    0x94, 0x91, 0xD5, 0xD7, 0x0D, 0x4A, 0xC9, 0x70, 0xD4, 0xCA, 0x71, 0xD3, 0xD7, 0x2D, 0x29, 0xC9,
+    0x2C, 0xA5, 0xD2, 0xD2, 0xE5, 0xD1, 0xAC, 0x2A, 0xE5, 0xAC, 0x09, 0xCA, 0x2C, 0x9D, 0x70, 0xD2,
+    0xCA, 0x0D, 0x79, 0xC9, 0x1A, 0xC1, 0xD7, 0xD1, 0x9C, 0x91, 0xD6, 0xAC, 0x2F, 0xF9, 0x39, 0xCA,
+    0x2A, 0xAA, 0xAA, 0xDA, 0x4D, 0x70, 0xD4, 0xAC, 0x97, 0x0D, 0x10, 0x2A, 0xCA, 0x6D, 0x5E, 0xA5,
+    0xAC, 0x94, 0xD9, 0xCA, 0x5C, 0xA5, 0x91, 0xCA, 0x4A, 0xC7, 0x1C, 0xA3, 0x9C, 0xA7, 0x1C, 0xA3,
+    0xD7, 0x2C, 0xA2, 0xAC, 0x97, 0x2C, 0xA2, 0xCA, 0x09, 0xEA, 0x5C, 0xA1, 0xD0, 0xAD, 0xAA, 0xD4,
+    0xCA, 0x09, 0xC9, 0x19, 0x2A, 0xC4, 0xCA, 0x0D, 0x6A, 0xC6, 0xAC, 0x96, 0xD6, 0xCA, 0x6A, 0xC9,
+    0x5D, 0x6A, 0xC9, 0x59, 0xC9, 0x5A, 0xC9, 0x6D, 0x5A, 0xC9, 0x6A, 0xC5, 0xAD, 0xAA, 0xAA, 0x29,
+    0xCA, 0x5F, 0xE0, 0x77, 0x49, 0xF9, 0x7C, 0xA2, 0x9C, 0xA9, 0x9D, 0x95, 0xAC, 0x71, 0xCA, 0x49,
+    0xCA, 0x70, 0x9C, 0xA4, 0xD6, 0x99, 0xAD, 0x4A, 0xC9, 0x6F, 0xA4, 0xD7, 0x2A, 0xCA, 0x2A, 0xC7,
+    0x4D, 0x19, 0xCA, 0x2C, 0xA7, 0xD1, 0xD2, 0xE1, 0xAC, 0xA9, 0x9D, 0x90, 0xAC, 0x91, 0xAE, 0x19,
+    0xFC, 0x91, 0xCA, 0x19, 0xC9, 0xD7, 0x1D, 0x2C, 0xA0, 0xD7, 0x09, 0xC9, 0x1A, 0xC1, 0xD7, 0x0D,
+    0x19, 0xC2, 0xD7, 0xAC, 0x91, 0xFF, 0x95, 0xCA, 0x2A, 0xAA, 0xAA, 0xDA, 0x5D, 0x70, 0xD5, 0x9C,
+    0x97, 0x0D, 0x10, 0x49, 0xA7, 0x0E, 0x7E, 0x79, 0xA9, 0x77, 0x39, 0x70, 0x9C, 0x97, 0xAC, 0x79,
+    0xD6, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x96, 0xD9, 0x69, 0xD7, 0x9C, 0xA7, 0x9D, 0x70, 0xE9, 0x19,
+    0xAC, 0x19, 0xFF, 0x92, 0xAA, 0xDA, 0x91, 0x77, 0x4D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x6C, 0xA7,
+    0x77, 0x4D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D,
+    0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA,
+    0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA,
+    0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD0, 0x77, 0x79, 0xD9, 0x73,
+    0xDA, 0x73, 0xAC, 0xA7, 0x4C, 0x97, 0x77, 0x5D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9,
+    0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D,
+    0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99,
+    0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97,
+    0x1A, 0xD0, 0x77, 0x5A, 0xD9, 0x72, 0x9F, 0x97, 0x09, 0xD1, 0xD7, 0x0C, 0xA3, 0xAC, 0x77, 0x72,
+    0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A,
+    0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA,
+    0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC,
+    0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x59, 0x39, 0x7A, 0xE9, 0x1C, 0x95,
+    0x9C, 0xAA, 0xFC, 0x69, 0xA2, 0x9C, 0xA7, 0x77, 0x3D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA,
+    0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D,
+    0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99,
+    0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D,
+    0x97, 0x1A, 0xD0, 0x77, 0x39, 0xCA, 0x1D, 0x97, 0x9C, 0xA1, 0xAC, 0x97, 0x77, 0x77, 0x2D, 0x74,
+    0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1,
+    0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD,
+    0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D,
+    0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD0, 0x69, 0x97, 0x4F, 0x72, 0xAA, 0x1C, 0xA7,
+    0x1C, 0xA1, 0xAA, 0x71, 0x9C, 0x9A, 0xC9, 0x72, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xF7, 0x29, 0xCA,
+    0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69,
+    0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99,
+    0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9,
+    0xD9, 0x71, 0xAD, 0x70, 0xAF, 0xFE, 0x97, 0x0F, 0xFF, 0xA7, 0xAC, 0xA0, 0xDA, 0x76, 0xD1, 0xD9,
+    0x75, 0xAC, 0xA1, 0xD9, 0x75, 0xD2, 0xD9, 0x74, 0xAC, 0xA2, 0xD9, 0x74, 0xD9, 0x2D, 0xA9, 0x99,
+    0x99, 0x95, 0xAD, 0x3F, 0xFC, 0x5D, 0x93, 0xEA, 0xAA, 0xAA, 0xA4, 0x9D, 0xAA, 0xAA, 0xAD, 0x97,
+    0x2F, 0xFD, 0x97, 0x19, 0xD9, 0x99, 0x99, 0x9D, 0x97, 0x1D, 0x95, 0xD9, 0x70, 0x9D, 0x6D, 0x97,
+    0x0D, 0xA6, 0xD9, 0x79, 0xD7, 0xFF, 0xCA, 0x0D, 0xA7, 0xFF, 0xCA, 0x77, 0x39, 0xFD, 0xA9, 0x39,
+    0xFF, 0xD2, 0x9E, 0x94, 0xA9, 0x2E, 0x72, 0xAD, 0x73, 0xDA, 0x73, 0xD7, 0x39, 0xD7, 0x39, 0xD7,
+    0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x39, 0xDA, 0x73, 0xAD, 0xA7, 0x3A,
+    0xFA, 0xAE, 0x94, 0x9A, 0xFE, 0x70, 0xAC, 0x97, 0x3D, 0x97, 0x39, 0xAC, 0xA7, 0x4D, 0x71, 0x99,
+    0xAC, 0xA7, 0x1E, 0xA4, 0x74, 0x9D, 0x97, 0xAD, 0x70, 0xAC, 0xA7, 0x09, 0xC7, 0x69, 0xFF, 0xC9,
+    0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99, 0x99,
+    0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x77, 0x0A, 0xD6, 0x9D, 0x7D, 0x96,
+    0x9C, 0x77, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x76,
+    0xE6, 0xAF, 0x4A, 0xCA, 0x09, 0xD2, 0x9C, 0x92, 0x9C, 0xA7, 0x39, 0xFF, 0xC9, 0xAF, 0xFC, 0x9A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x74, 0xD9, 0x1D, 0x3A, 0xC9, 0x1D, 0x77, 0x79, 0xFF,
+    0xC9, 0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99,
+    0x99, 0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x6A, 0xD4, 0xDA, 0x4D, 0x94,
+    0xAA, 0x70, 0xFD, 0x9A, 0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19, 0xAE, 0xA0, 0xFD, 0x90, 0x72,
+    0xDA, 0x2A, 0xD2, 0x9D, 0x3C, 0xA7, 0x1F, 0xD9, 0xAF, 0xA2, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x91, 0x9A,
+    0xEA, 0x0F, 0xD9, 0x72, 0x9E, 0x4F, 0xA2, 0xD9, 0x0D, 0x90, 0xAC, 0x3A, 0xC7, 0x2F, 0xD9, 0x1A,
+    0xFA, 0x4D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9,
+    0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x39, 0xAE, 0xA2, 0xFD, 0x90, 0x70, 0xD1, 0x9C, 0xA0, 0xD1,
+    0x9C, 0xA7, 0x70, 0xFD, 0x90, 0xAF, 0xA3, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x92, 0x9A, 0xEA, 0x1F, 0xD9,
+    0x19, 0xFD, 0xAA, 0x96, 0x9F, 0xFD, 0x94, 0x9D, 0x39, 0xAE, 0x93, 0x9D, 0x6A, 0xD3, 0x9D, 0x7E,
+    0x29, 0xD7, 0x9D, 0x29, 0xD7, 0x0D, 0x91, 0x9D, 0x70, 0xDA, 0x0F, 0xF4, 0xAC, 0xA9, 0xFF, 0x93,
+    0xAC, 0xA1, 0xAD, 0x70, 0xDA, 0x19, 0xD7, 0x0D, 0x91, 0x9D, 0x79, 0xD2, 0x9D, 0x7E, 0x29, 0xD6,
+    0xAD, 0x39, 0xD4, 0x9E, 0x93, 0x9F, 0xFD, 0x94, 0x9F, 0xEA, 0x94, 0x49, 0x49, 0x6F, 0x1A, 0xC5,
+    0xD9, 0xAF, 0xA5, 0xC9, 0x2A, 0xCA, 0x77, 0x29, 0xD9, 0x79, 0xC9, 0xAE, 0x7A, 0xCA, 0xAE, 0xA6,
+    0xAC, 0xAA, 0xCA, 0xD6, 0xAC, 0xAA, 0xC9, 0xAD, 0x5A, 0xCA, 0xAC, 0x90, 0xD9, 0x4A, 0xCA, 0xAC,
+    0x90, 0x9D, 0x4A, 0xCA, 0xAC, 0x91, 0xE3, 0xAC, 0xAA, 0xCA, 0x2D, 0x92, 0xAC, 0xAA, 0xCA, 0x2A,
+    0xD2, 0xAC, 0xAA, 0xCA, 0x3D, 0xA1, 0xAC, 0xAA, 0xCA, 0x4D, 0x90, 0xAC, 0xAA, 0xCA, 0x4A, 0xD0,
+    0x9C, 0xAA, 0xCA, 0x5D, 0xA9, 0xCA, 0xAC, 0xA5, 0x9D, 0xAC, 0xAA, 0xCA, 0x6A, 0xEA, 0xAC, 0xA7,
+    0xEA, 0xAC, 0xA7, 0x9D, 0xA0, 0x77, 0x6D, 0xA7, 0x59, 0xD7, 0x69, 0xD7, 0x69, 0xC9, 0x77, 0x73,
+    0xAF, 0xD9, 0x69, 0xFF, 0xD4, 0x9D, 0xA4, 0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9,
+    0x71, 0xDA, 0x0D, 0x72, 0xAD, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72,
+    0x9D, 0x9D, 0x72, 0xAD, 0x0D, 0x97, 0x1D, 0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD,
+    0xA4, 0x9E, 0x4A, 0xFA, 0xAF, 0x69, 0xAF, 0xDA, 0x77, 0x40, 0x77, 0x71, 0xAD, 0x75, 0xD9, 0x74,
+    0xD9, 0x74, 0x9C, 0x97, 0x77, 0x4A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D,
+    0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29,
+    0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09,
+    0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74, 0x77,
+    0x7E, 0x97, 0x3A, 0xF7, 0x29, 0xCA, 0x09, 0xD7, 0x1C, 0xA3, 0xCA, 0x77, 0x71, 0xAF, 0xD9, 0x69,
+    0xFF, 0xD4, 0x9D, 0xA4, 0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA, 0x0D,
+    0x72, 0xAD, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72,
+    0xAD, 0x0D, 0x97, 0x1D, 0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E, 0x4A,
+    0xFA, 0xAF, 0x69, 0xAF, 0xDA, 0x77, 0x40, 0x59, 0x93, 0x97, 0x0F, 0x90, 0x9C, 0x79, 0xC9, 0xAF,
+    0xC7, 0xAA, 0x2A, 0xCA, 0x77, 0x72, 0xAF, 0xD9, 0x69, 0xFF, 0xD4, 0x9D, 0xA4, 0x9E, 0x3D, 0xA7,
+    0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA, 0x0D, 0x72, 0xAD, 0x9D, 0x72, 0x9D, 0x9D, 0x72,
+    0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0xAD, 0x0D, 0x97, 0x1D, 0xA0, 0xAD, 0x70,
+    0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E, 0x4A, 0xFA, 0xAF, 0x69, 0xAF, 0xDA, 0x77, 0x40,
+    0x77, 0x5A, 0xCA, 0x1D, 0x71, 0xAC, 0x91, 0xD7, 0x77, 0x77, 0x3A, 0xFD, 0x96, 0x9F, 0xFD, 0x49,
+    0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9,
+    0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9,
+    0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6,
+    0x9A, 0xFD, 0xA7, 0x74, 0x74, 0xCA, 0x59, 0xC9, 0x0D, 0xA3, 0x9D, 0x2D, 0xA1, 0x9D, 0x4D, 0xA9,
+    0xD6, 0xF7, 0xAD, 0xA6, 0x9F, 0xA4, 0x9D, 0x1D, 0xA2, 0x9D, 0x3D, 0xA1, 0xD5, 0xD9, 0x09, 0x79,
+    0x00, 0x75, 0x96, 0xAF, 0xCA, 0x99, 0xCA, 0x39, 0xFF, 0xE3, 0x9D, 0xA4, 0x9E, 0x3D, 0xA5, 0xAE,
+    0xA1, 0xAD, 0x6D, 0x9D, 0x1D, 0x95, 0xD9, 0x0D, 0xA0, 0xD5, 0xAC, 0xA1, 0xAD, 0x9D, 0x49, 0xD2,
+    0x9D, 0x9D, 0x4D, 0x39, 0xD9, 0xD3, 0xAC, 0x93, 0x9D, 0x9D, 0x29, 0xCA, 0x49, 0xD9, 0xD2, 0xD5,
+    0xAD, 0x0D, 0x90, 0xD9, 0x5D, 0xA0, 0xAD, 0xAC, 0xA5, 0x9D, 0x19, 0xF6, 0xDA, 0x2A, 0xDA, 0x49,
+    0xE3, 0xAF, 0xCA, 0xAF, 0x39, 0xD9, 0xAF, 0xDA, 0x59, 0x75, 0x77, 0x1E, 0x73, 0xD9, 0x73, 0xD7,
+    0x4C, 0xA7, 0x72, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD,
+    0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77, 0x00, 0x77, 0x5D,
+    0xA7, 0x1D, 0xA7, 0x19, 0xCA, 0x72, 0xCA, 0x77, 0x3A, 0xC9, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA,
+    0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA,
+    0x70, 0xDA, 0xCA, 0x79, 0xDA, 0xD7, 0x9D, 0x0D, 0x7D, 0x90, 0xAD, 0x94, 0xE2, 0xFA, 0xAF, 0x4A,
+    0xFD, 0xA7, 0x70, 0x77, 0x29, 0xDA, 0x71, 0xF9, 0x7D, 0x1D, 0x95, 0xAA, 0x3A, 0xC7, 0x70, 0xAC,
+    0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9,
+    0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77, 0x00, 0x77, 0x09, 0xD1, 0xAC, 0xA6, 0xD1,
+    0xAC, 0xA7, 0x77, 0x6A, 0xC9, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70,
+    0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xDA, 0xCA, 0x79, 0xDA,
+    0xD7, 0x9D, 0x0D, 0x7D, 0x90, 0xAD, 0x94, 0xE2, 0xFA, 0xAF, 0x4A, 0xFD, 0xA7, 0x70, 0x77, 0x6D,
+    0x97, 0x2D, 0xA7, 0x29, 0xCA, 0x73, 0xCA, 0x77, 0x5A, 0xCA, 0x79, 0xD0, 0x9D, 0x7D, 0x91, 0xAC,
+    0xA5, 0xAD, 0x3D, 0x5D, 0x93, 0xAC, 0xA3, 0xAD, 0x5D, 0x92, 0xD6, 0xAD, 0x1A, 0xCA, 0x7D, 0x90,
+    0xD7, 0x09, 0xDA, 0xCA, 0x71, 0xF7, 0x29, 0xDA, 0x73, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7,
+    0x4D, 0x74, 0xD6, 0x9C, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xFA, 0xAA, 0x92, 0xAF, 0xFC,
+    0x1A, 0xCA, 0x29, 0xAE, 0x0A, 0xCA, 0x5D, 0xAA, 0xCA, 0x5A, 0xDA, 0xCA, 0x59, 0xDA, 0xCA, 0x5A,
+    0xDA, 0xCA, 0x5D, 0xAA, 0xCA, 0x4E, 0x0A, 0xFF, 0xC9, 0x0A, 0xFE, 0xA2, 0xAC, 0xA7, 0x0A, 0xCA,
+    0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0x76, 0xAF, 0xCA, 0x4F, 0xAF, 0x91, 0xAD, 0x4A, 0xD1, 0xD9,
+    0x5D, 0x1D, 0x94, 0x9D, 0x1D, 0x94, 0xD9, 0x1D, 0x92, 0x9D, 0x92, 0xD9, 0x2D, 0x93, 0xD9, 0x1A,
+    0xCA, 0x4D, 0x91, 0x9D, 0x4D, 0x92, 0xE9, 0x2D, 0x93, 0xEA, 0x1D, 0x94, 0xAD, 0xA0, 0xD9, 0x59,
+    0xD9, 0xD9, 0x6A, 0xCA, 0xD9, 0x6A, 0xCA, 0xD9, 0x09, 0x4D, 0x9D, 0x90, 0xAC, 0xAA, 0xAE, 0x0D,
+    0x90, 0x9F, 0xD7, 0x60, 0x75, 0xE7, 0x0D, 0x97, 0x0D, 0x71, 0xCA, 0x77, 0x19, 0xAA, 0xA9, 0x3F,
+    0xF2, 0xCA, 0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D,
+    0x94, 0xFA, 0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72,
+    0x77, 0x09, 0xD9, 0x6D, 0xA6, 0xAC, 0xA7, 0xCA, 0x77, 0x29, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91,
+    0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F,
+    0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x76, 0xAD, 0xA5,
+    0x9F, 0x94, 0xD1, 0xD9, 0x2C, 0xA3, 0xAC, 0x77, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA,
+    0x79, 0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A,
+    0xDA, 0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x39, 0x39, 0x2A, 0xE9,
+    0x1C, 0x91, 0xCA, 0x9F, 0xC1, 0x9A, 0x29, 0xCA, 0x77, 0x09, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91,
+    0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F,
+    0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x74, 0x9D, 0x1A,
+    0xC9, 0x29, 0xCA, 0x1A, 0xC9, 0x77, 0x72, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79,
+    0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA,
+    0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x49, 0x97, 0xF5, 0xAC, 0x1C,
+    0xA4, 0xAA, 0x1A, 0xC4, 0x9C, 0xAA, 0xC9, 0x59, 0xD9, 0x77, 0x19, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA,
+    0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA,
+    0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x29, 0xAA,
+    0xA9, 0x39, 0xAA, 0x94, 0x9F, 0xE9, 0x0F, 0xD9, 0x29, 0xCA, 0x90, 0x9A, 0xFA, 0x1A, 0xD9, 0x70,
+    0xEA, 0x3A, 0xD7, 0x0A, 0xD5, 0xD7, 0x0A, 0xD5, 0xD9, 0x19, 0xAF, 0xFF, 0xE9, 0x0A, 0xEA, 0xA9,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9D, 0x4A, 0xD7, 0x0D, 0xA4, 0xAD, 0x70, 0xD9, 0x4E, 0x97, 0xAC,
+    0xA3, 0xAF, 0x59, 0x09, 0xEA, 0xAD, 0xA0, 0xAE, 0xAA, 0xDA, 0x19, 0xFC, 0x92, 0xAF, 0xD9, 0x77,
+    0x40, 0x39, 0xAA, 0xA9, 0x39, 0xFE, 0x2E, 0x99, 0x9A, 0xA1, 0xDA, 0x7D, 0x79, 0xD7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xD7, 0x0F, 0xAA, 0xD3, 0xAF, 0xCA, 0x5D, 0x70,
+    0xD7, 0x09, 0xD9, 0x79, 0xCA, 0x59, 0x9D, 0x94, 0x9E, 0x92, 0x76, 0xE7, 0x1D, 0x97, 0x1D, 0x72,
+    0xCA, 0x77, 0x39, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1, 0xDA, 0x4D, 0x90, 0xD5,
+    0xAC, 0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0x70, 0x9D, 0x71,
+    0xD9, 0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA, 0x74, 0x77, 0x2D, 0xA7, 0xDA, 0x79,
+    0xCA, 0x70, 0xCA, 0x77, 0x49, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1, 0xDA, 0x4D,
+    0x90, 0xD5, 0xAC, 0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0x70,
+    0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA, 0x74, 0x77, 0x9D, 0xA6,
+    0x9F, 0x95, 0xD1, 0xD9, 0x3A, 0xA3, 0xAC, 0x77, 0x19, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90,
+    0x9D, 0xA1, 0xDA, 0x4D, 0x90, 0xD5, 0xAC, 0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xCA, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA,
+    0x74, 0x75, 0x9D, 0x1A, 0xCA, 0x4D, 0x1A, 0xCA, 0x77, 0x75, 0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D,
+    0xA9, 0x09, 0xDA, 0x1D, 0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39,
+    0xFD, 0xA7, 0x40, 0x6A, 0xD3, 0xDA, 0x3D, 0x4A, 0xA7, 0x09, 0x93, 0xD9, 0x2D, 0x92, 0xD9, 0x2D,
+    0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x70, 0xDA,
+    0x1A, 0xD1, 0x9D, 0x2C, 0xA7, 0x19, 0x93, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92,
+    0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x10, 0x72, 0x9D, 0xA4, 0xFA, 0x2D,
+    0x90, 0xD9, 0x0A, 0xC3, 0xAC, 0x74, 0x99, 0x6D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9,
+    0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x92, 0x70, 0xD1, 0x9C, 0xA0, 0xD1,
+    0x9C, 0xA7, 0x72, 0x99, 0x5D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x91, 0x77, 0x0C, 0xA2, 0x9A, 0x5E, 0x9E, 0x6A, 0xE9,
+    0x6A, 0xFA, 0x5E, 0x1D, 0x95, 0x92, 0x9D, 0x72, 0xAC, 0xA3, 0x9A, 0xDA, 0x90, 0xD2, 0xAF, 0xFC,
+    0x90, 0xAD, 0x92, 0x9E, 0xA0, 0xD6, 0xDA, 0x9D, 0x6A, 0xDA, 0xCA, 0x69, 0xDA, 0xCA, 0x69, 0xCA,
+    0xAC, 0xA6, 0xAC, 0xA0, 0xD6, 0xD9, 0x0D, 0xA4, 0xAD, 0x2E, 0xAA, 0xAE, 0x4A, 0xFC, 0xA7, 0x70,
+    0x29, 0x93, 0x93, 0xF9, 0x09, 0xC2, 0xAC, 0x9A, 0xFC, 0x2A, 0x92, 0xAC, 0xA7, 0x69, 0x91, 0x9A,
+    0xAA, 0x92, 0xD0, 0xAF, 0xD1, 0xF9, 0x90, 0x9E, 0x0E, 0x5D, 0x0D, 0xA5, 0xD9, 0xD9, 0x5D, 0x9D,
+    0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95,
+    0xD9, 0xD9, 0x5D, 0x90, 0x77, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xCA, 0x72, 0xAC, 0x77, 0x59, 0xAA,
+    0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC,
+    0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1,
+    0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0x3A, 0xD7, 0x09, 0xD7, 0x1D, 0x71,
+    0xAC, 0x77, 0x69, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D,
+    0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6,
+    0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0x1E, 0x70,
+    0xFC, 0x6A, 0xCA, 0x0A, 0xCA, 0x49, 0xC9, 0x29, 0xCA, 0x77, 0x29, 0xAA, 0xA9, 0x59, 0xFE, 0x93,
+    0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA,
+    0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA,
+    0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x39, 0x49, 0x4F, 0x90, 0x9C, 0x3A, 0xC9, 0xAF, 0xA3, 0xC9, 0x2A,
+    0xCA, 0x77, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D,
+    0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6,
+    0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0xD9, 0x1D,
+    0x5D, 0x91, 0xD7, 0x77, 0x70, 0x9A, 0xAA, 0x95, 0x9F, 0xE9, 0x3D, 0xA9, 0x09, 0xAD, 0x91, 0xDA,
+    0x4A, 0xD1, 0xD6, 0xD9, 0x9D, 0x6A, 0xCA, 0xAC, 0xA6, 0xAC, 0xAA, 0xCA, 0x6A, 0xDA, 0xCA, 0x6A,
+    0xCA, 0x9D, 0x6D, 0xA0, 0xD9, 0x5D, 0x1A, 0xD4, 0xE2, 0xEA, 0xAA, 0xE4, 0x9F, 0xCA, 0x77, 0x49,
+    0xA7, 0x2D, 0x97, 0x1D, 0x97, 0x19, 0x97, 0x72, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF,
+    0x77, 0x77, 0xD7, 0x19, 0xD9, 0x71, 0xD5, 0x77, 0x09, 0xAA, 0xA9, 0x0A, 0xA2, 0x9F, 0xFC, 0x19,
+    0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA3, 0xAE, 0x1D, 0x39, 0xCA, 0xD9, 0x9D, 0x3D, 0x0A, 0xCA, 0xAC,
+    0xA2, 0xD9, 0x0A, 0xCA, 0xAC, 0xA1, 0xAC, 0xA1, 0xAD, 0xAC, 0xA0, 0x9D, 0x2A, 0xCA, 0x9D, 0x0D,
+    0x3D, 0xA0, 0xF9, 0x3D, 0x1A, 0xDA, 0x3E, 0x2E, 0xAA, 0xAE, 0x2D, 0xAF, 0xCA, 0x39, 0x97, 0x10,
+    0x77, 0x9D, 0x97, 0x19, 0xD7, 0x29, 0xCA, 0x72, 0x9C, 0x97, 0x71, 0x99, 0x69, 0x91, 0xD6, 0xD9,
+    0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D,
+    0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F,
+    0xCA, 0x0A, 0xC9, 0x74, 0x77, 0x3A, 0xD7, 0x1D, 0x97, 0x0D, 0x97, 0x09, 0xC9, 0x77, 0x29, 0x96,
+    0x99, 0x1D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9,
+    0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD9, 0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA,
+    0xAA, 0xF9, 0x19, 0xFC, 0xA0, 0xAC, 0x97, 0x40, 0x77, 0x1E, 0x97, 0xAF, 0x6A, 0xCA, 0x09, 0xD4,
+    0x9C, 0x93, 0xCA, 0x77, 0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x94, 0x9D,
+    0x90, 0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA, 0x0A, 0xC9, 0x74, 0x77, 0xAC, 0x91,
+    0xD5, 0xAC, 0x91, 0xD7, 0x77, 0x59, 0x96, 0x99, 0x1D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90,
+    0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD9,
+    0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA, 0xAA, 0xF9, 0x19, 0xFC, 0xA0, 0xAC, 0x97, 0x40, 0x77,
+    0x3E, 0x70, 0xAD, 0x71, 0xD7, 0x1A, 0xA7, 0x72, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x0D, 0x59,
+    0xD1, 0xD9, 0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA, 0x4D, 0x2D,
+    0x5D, 0x90, 0x9D, 0x59, 0xCA, 0x0D, 0x96, 0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71, 0xE7, 0x1D,
+    0x97, 0x1D, 0x71, 0xAC, 0xA7, 0x09, 0xD6, 0xAF, 0x96, 0xAE, 0x97, 0xD9, 0x70, 0xD9, 0x70, 0xD9,
+    0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x09, 0xAA, 0xA9, 0x2D, 0x9A, 0xFD, 0x1F, 0x91, 0x9E, 0x0E,
+    0x5D, 0x9D, 0xA5, 0xAC, 0xAD, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0xA5, 0xAF, 0xC5,
+    0xDA, 0xEA, 0x3A, 0xD0, 0xDA, 0xDA, 0xAE, 0x90, 0xD9, 0x9F, 0xC9, 0x1D, 0x97, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x00, 0x77, 0xD1, 0x9D, 0x5D, 0x19, 0xD7, 0x77, 0x49,
+    0x97, 0x99, 0x9A, 0xCA, 0x6D, 0x90, 0xD5, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0x9D, 0x4D, 0x92, 0xD9,
+    0x29, 0xD3, 0xAC, 0xA2, 0xAC, 0xA4, 0xD2, 0xD5, 0xD9, 0x09, 0xD5, 0x9C, 0xA0, 0xD9, 0x6D, 0x0D,
+    0x7A, 0xCA, 0xCA, 0x70, 0xE7, 0x1E, 0x71, 0xD9, 0x71, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0x6A, 0xF9,
+    0x6A, 0xE9, 0x70, 0x3A, 0xFD, 0xA7, 0xAF, 0xDA, 0x77, 0x72, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29,
+    0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D,
+    0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA,
+    0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71,
+    0xD9, 0xD9, 0x71, 0xAD, 0x1A, 0xFD, 0xA2, 0xAF, 0xDA, 0x77, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9,
+    0x19, 0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5,
+    0xF9, 0x4A, 0xDA, 0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x39, 0x49,
+    0x97, 0xD3, 0xCA, 0x79, 0xFD, 0x72, 0xAD, 0xA7, 0x77, 0x4D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C,
+    0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6,
+    0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9,
+    0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D,
+    0x9D, 0x97, 0x1A, 0xD0, 0x19, 0x93, 0x99, 0x2A, 0xC3, 0xCA, 0x3F, 0xD5, 0xAD, 0xA7, 0x71, 0x9A,
+    0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0, 0xAE, 0xAA,
+    0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA, 0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0, 0x9F, 0xC9,
+    0x0A, 0xC7, 0x20, 0x6D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7,
+    0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC,
+    0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D,
+    0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD7, 0x4D, 0x74,
+    0xAC, 0x75, 0xCA, 0x75, 0xD7, 0x5F, 0x74, 0x99, 0x90, 0x39, 0xAA, 0xA9, 0x4F, 0xF3, 0xCA, 0x91,
+    0x9D, 0xA7, 0x09, 0xD7, 0x1D, 0x71, 0xD3, 0xAF, 0xE1, 0xAE, 0xAA, 0xAA, 0xD0, 0x9D, 0x94, 0xD0,
+    0xDA, 0x5D, 0x0D, 0x94, 0xAD, 0x0A, 0xD3, 0x9E, 0x09, 0xEA, 0xAD, 0xAD, 0x19, 0xFC, 0x90, 0xAC,
+    0x71, 0xCA, 0x70, 0xCA, 0x70, 0x9C, 0x97, 0x09, 0xCA, 0x71, 0xEA, 0x70, 0x99, 0x00, 0x77, 0x7E,
+    0x72, 0x9D, 0x73, 0xD7, 0x3A, 0xC7, 0x77, 0x19, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9E, 0x94, 0xA9,
+    0x2E, 0x72, 0xAD, 0x73, 0xDA, 0x73, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39,
+    0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x39, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xFA, 0xAE, 0x94, 0x9A, 0xFE,
+    0x77, 0x00, 0x77, 0x1D, 0xA6, 0xDA, 0x69, 0xCA, 0x7C, 0xA7, 0x72, 0x9A, 0xAA, 0x93, 0x9F, 0xE2,
+    0xE9, 0x99, 0xAA, 0x1D, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x79, 0xD7, 0x0D,
+    0x97, 0xAD, 0x70, 0xFA, 0xAD, 0x3A, 0xFC, 0xA7, 0x30, 0x77, 0x5E, 0x72, 0xFC, 0x70, 0xAC, 0xA0,
+    0xAC, 0xA6, 0x9C, 0x92, 0x9C, 0x97, 0x75, 0x9F, 0xDA, 0x93, 0x9F, 0xFD, 0x29, 0xE9, 0x4A, 0x92,
+    0xE7, 0x2A, 0xD7, 0x3D, 0xA7, 0x3D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D,
+    0x74, 0xD9, 0x73, 0xAD, 0x73, 0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xAF, 0xAA, 0xE9, 0x49, 0xAF, 0xE7,
+    0x70, 0x76, 0x9D, 0xA5, 0x9F, 0x94, 0xD1, 0xD9, 0x2C, 0xA3, 0xAC, 0x77, 0x9A, 0xAA, 0x93, 0x9F,
+    0xE2, 0xE9, 0x99, 0xAA, 0x1D, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x79, 0xD7,
+    0x0D, 0x97, 0xAD, 0x70, 0xFA, 0xAD, 0x3A, 0xFC, 0xA7, 0x30, 0x79, 0x74, 0xAC, 0xA7, 0x3A, 0xCA,
+    0x74, 0x97, 0x77, 0x19, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9E, 0x94, 0xA9, 0x2E, 0x72, 0xAD, 0x73,
+    0xDA, 0x73, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x4D, 0x97, 0x3A,
+    0xD7, 0x39, 0xDA, 0x73, 0xAD, 0xA7, 0x3A, 0xFA, 0xAE, 0x94, 0x9A, 0xFE, 0x77, 0x00, 0x59, 0x70,
+    0xD9, 0x7D, 0x97, 0x09, 0x77, 0x29, 0xAA, 0xA9, 0x39, 0xFE, 0x2E, 0x99, 0x9A, 0xA1, 0xDA, 0x7D,
+    0x79, 0xD7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xD7, 0x0F, 0xAA, 0xD3,
+    0xAF, 0xCA, 0x73, 0x77, 0x29, 0xCA, 0x2A, 0xC9, 0x6A, 0xD0, 0xD9, 0x70, 0xAE, 0xA7, 0x2A, 0xCA,
+    0x77, 0x70, 0x9F, 0xDA, 0x93, 0x9F, 0xFD, 0x29, 0xE9, 0x4A, 0x92, 0xE7, 0x2A, 0xD7, 0x3D, 0xA7,
+    0x3D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAD, 0x73,
+    0x9D, 0xA7, 0x3A, 0xDA, 0x73, 0xAF, 0xAA, 0xE9, 0x49, 0xAF, 0xE7, 0x70, 0x74, 0xD9, 0x2D, 0x3D,
+    0x99, 0xD5, 0xF6, 0x9D, 0x97, 0x71, 0x9A, 0xAA, 0x93, 0x9F, 0xE2, 0xE9, 0x99, 0xAA, 0x1D, 0xA7,
+    0xD7, 0x9D, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x79, 0xD7, 0x0D, 0x97, 0xAD, 0x70, 0xFA, 0xAD,
+    0x3A, 0xFC, 0xA7, 0x30, 0x77, 0x1D, 0x91, 0x9D, 0x7D, 0x99, 0xD7, 0x1F, 0x72, 0x9D, 0x97, 0x74,
+    0x9F, 0xDA, 0xA9, 0x4A, 0xFF, 0xD9, 0x2A, 0xCA, 0x39, 0xAE, 0x91, 0xAC, 0xA6, 0xAD, 0x90, 0xAC,
+    0xA7, 0xE0, 0xAC, 0xA7, 0x9D, 0x0A, 0xCA, 0x70, 0xD9, 0xAC, 0xA7, 0x0D, 0xAA, 0xCA, 0x70, 0xAC,
+    0xAA, 0xCA, 0x70, 0xAC, 0xAA, 0xCA, 0x70, 0xDA, 0xAC, 0xA7, 0x0D, 0x9A, 0xCA, 0x79, 0xD0, 0xAC,
+    0xA7, 0xE0, 0xAC, 0xA6, 0xAD, 0x1A, 0xCA, 0x49, 0xE9, 0x1A, 0xFF, 0xD9, 0x2A, 0xFE, 0xA9, 0x40,
+    0x71, 0xD9, 0x0D, 0x72, 0xD9, 0x0C, 0xA7, 0x2D, 0x99, 0xC9, 0x72, 0xD9, 0xAA, 0x73, 0xD9, 0x79,
+    0xAA, 0x91, 0xD9, 0x59, 0xFD, 0x9D, 0x94, 0x9D, 0xA9, 0x09, 0xF9, 0x4D, 0xA4, 0xE9, 0x39, 0xD5,
+    0x9D, 0x93, 0x9D, 0x6D, 0x93, 0xAC, 0xA6, 0xD9, 0x3A, 0xCA, 0x6D, 0x93, 0xAC, 0xA6, 0xD9, 0x39,
+    0xD6, 0xD9, 0x4D, 0x59, 0xD9, 0x4E, 0x4E, 0x95, 0xEA, 0xAA, 0xF9, 0x6A, 0xFA, 0x0A, 0xC9, 0x77,
+    0x40, 0x19, 0xFD, 0xAA, 0x96, 0x9F, 0xFD, 0x94, 0x9D, 0x39, 0xAE, 0x93, 0x9D, 0x6A, 0xD3, 0x9D,
+    0x7E, 0x29, 0xD7, 0x9D, 0x29, 0xD7, 0x0D, 0x91, 0x9D, 0x70, 0xDA, 0x0F, 0xF4, 0xAC, 0xA9, 0xFF,
+    0x93, 0xAC, 0xA1, 0xAD, 0x70, 0xDA, 0x19, 0xD7, 0x0D, 0x91, 0x9D, 0x79, 0xD2, 0x9D, 0x7E, 0x29,
+    0xD6, 0xAD, 0x39, 0xD4, 0x9E, 0x93, 0x9F, 0xFD, 0x94, 0x9F, 0xEA, 0x94, 0x71, 0xD9, 0x73, 0xD9,
+    0x6F, 0xFC, 0x5F, 0xFC, 0x72, 0xD9, 0x59, 0xAA, 0x91, 0xD9, 0x39, 0xFD, 0x9D, 0x92, 0x9D, 0xA9,
+    0x99, 0xF9, 0x2D, 0xA4, 0xE9, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x6D, 0x91, 0xAC, 0xA6, 0xD9, 0x1A,
+    0xCA, 0x6D, 0x91, 0xAC, 0xA6, 0xD9, 0x19, 0xD6, 0xD9, 0x2D, 0x59, 0xD9, 0x2E, 0x4E, 0x93, 0xEA,
+    0xAA, 0xF9, 0x4A, 0xFA, 0x0A, 0xC9, 0x77, 0x00, 0x1F, 0xE9, 0x2F, 0xE9, 0x73, 0x9F, 0xFC, 0x9A,
+    0xFF, 0xC9, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99,
+    0x90, 0xAF, 0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x1A, 0xFE, 0x3A, 0xFD, 0xA7, 0x71,
+    0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA, 0x1D, 0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D,
+    0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A,
+    0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x40, 0x1A, 0x49, 0x3C, 0xA2, 0x9C, 0x92, 0xAF,
+    0xCA, 0x49, 0xAD, 0x97, 0x59, 0xFF, 0xC9, 0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF,
+    0xC9, 0x19, 0x94, 0x93, 0xAC, 0x3D, 0x4F, 0xD6, 0xAD, 0xA7, 0x73, 0x9A, 0xAA, 0x94, 0x9F, 0xDA,
+    0x3D, 0xA9, 0x09, 0xDA, 0x1D, 0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD,
+    0x39, 0xFD, 0xA7, 0x40, 0x49, 0x70, 0xAD, 0x7A, 0xD7, 0x09, 0x77, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF,
+    0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x59, 0x71, 0xD9, 0x70, 0xD9, 0x71, 0x97, 0x74,
+    0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA, 0x1D, 0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D,
+    0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A,
+    0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x40, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFC, 0x0A,
+    0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x96, 0xAC, 0x79, 0xC9, 0x7D, 0x70, 0xD7, 0x09, 0xE9, 0x69, 0x99,
+    0x00, 0x39, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1, 0xDA, 0x4D, 0x90, 0xD5, 0xAC,
+    0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0x70, 0x9D, 0x71, 0xD9,
+    0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xE7, 0x9D, 0x70, 0xAC, 0x71, 0xD7, 0x1D, 0x71,
+    0xAE, 0x70, 0x99, 0x90, 0x73, 0x9C, 0xA2, 0xAC, 0xA2, 0x9D, 0x0A, 0xCA, 0x4A, 0xEA, 0x6A, 0xD7,
+    0x69, 0xFF, 0xC9, 0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A,
+    0xD9, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x75, 0xD9, 0x2D,
+    0x4D, 0x99, 0xD6, 0xF7, 0x9D, 0x97, 0x73, 0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA,
+    0x1D, 0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x40,
+    0x77, 0x69, 0xDA, 0x72, 0x9F, 0x97, 0x1D, 0x1D, 0x97, 0xAA, 0x3A, 0xC7, 0x77, 0x9A, 0xFD, 0xA9,
+    0x4F, 0xFE, 0x3E, 0xA4, 0x9A, 0x92, 0xE7, 0x3A, 0xD7, 0x4D, 0xA7, 0x4D, 0x74, 0x9D, 0x74, 0x9D,
+    0x59, 0x99, 0x99, 0x90, 0x9D, 0x5F, 0xD9, 0x9D, 0x59, 0xAA, 0xAD, 0x99, 0xD7, 0x1D, 0x90, 0xD9,
+    0x70, 0xD9, 0x0A, 0xD7, 0x0D, 0x91, 0xDA, 0x7D, 0x91, 0x9E, 0x95, 0xD9, 0x29, 0xFC, 0xAA, 0xF9,
+    0x4A, 0xFF, 0xA7, 0x70, 0x77, 0x1E, 0x70, 0xFA, 0x6D, 0x90, 0xAC, 0xA4, 0xAC, 0x92, 0x9C, 0x97,
+    0x72, 0x9A, 0xA9, 0x29, 0x29, 0xFD, 0x9A, 0xC9, 0x09, 0xDA, 0x90, 0x9F, 0x90, 0xDA, 0x4E, 0x99,
+    0xD5, 0x9D, 0x99, 0xD6, 0xD9, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9, 0x9D, 0x6D,
+    0x90, 0xD5, 0x9D, 0x90, 0xE4, 0xE9, 0x1E, 0xAA, 0xAF, 0x92, 0xAF, 0xA0, 0xD9, 0x71, 0xD7, 0x2D,
+    0x71, 0x9D, 0x19, 0x94, 0x9D, 0xA1, 0xAF, 0xFA, 0x3A, 0xFC, 0xA9, 0x20, 0x49, 0x94, 0x97, 0xAC,
+    0x3D, 0x70, 0xFD, 0x72, 0xAD, 0xA7, 0x77, 0x19, 0xAF, 0xDA, 0x94, 0xFF, 0xE3, 0xEA, 0x49, 0xA9,
+    0x2E, 0x73, 0xAD, 0x74, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x49, 0xD5, 0x99, 0x99, 0x99, 0x09, 0xD5,
+    0xFD, 0x99, 0xD5, 0x9A, 0xAA, 0xD9, 0x9D, 0x71, 0xD9, 0x0D, 0x97, 0x0D, 0x90, 0xAD, 0x70, 0xD9,
+    0x1D, 0xA7, 0xD9, 0x19, 0xE9, 0x5D, 0x92, 0x9F, 0xCA, 0xAF, 0x94, 0xAF, 0xFA, 0x77, 0x00, 0x29,
+    0x4A, 0x49, 0xC9, 0x2A, 0xC5, 0xFD, 0xA6, 0xAD, 0xA9, 0x77, 0x49, 0xAA, 0x92, 0x92, 0x9F, 0xD9,
+    0xAC, 0x90, 0x9D, 0xA9, 0x09, 0xF9, 0x0D, 0xA4, 0xE9, 0x9D, 0x59, 0xD9, 0x9D, 0x6D, 0x9A, 0xCA,
+    0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x99, 0xD6, 0xD9, 0x0D, 0x59, 0xD9, 0x0E, 0x4E, 0x91,
+    0xEA, 0xAA, 0xF9, 0x2A, 0xFA, 0x0D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD1, 0x99, 0x49, 0xDA, 0x1A,
+    0xFF, 0xA3, 0xAF, 0xCA, 0x92, 0x70, 0x97, 0x5D, 0x97, 0x4D, 0x97, 0x59, 0x77, 0x72, 0x9A, 0xFD,
+    0xA9, 0x4F, 0xFE, 0x3E, 0xA4, 0x9A, 0x92, 0xE7, 0x3A, 0xD7, 0x4D, 0xA7, 0x4D, 0x74, 0x9D, 0x74,
+    0x9D, 0x59, 0x99, 0x99, 0x90, 0x9D, 0x5F, 0xD9, 0x9D, 0x59, 0xAA, 0xAD, 0x99, 0xD7, 0x1D, 0x90,
+    0xD9, 0x70, 0xD9, 0x0A, 0xD7, 0x0D, 0x91, 0xDA, 0x7D, 0x91, 0x9E, 0x95, 0xD9, 0x29, 0xFC, 0xAA,
+    0xF9, 0x4A, 0xFF, 0xA7, 0x70, 0x59, 0x72, 0xDA, 0x71, 0xAC, 0xA7, 0x29, 0x77, 0x69, 0xAA, 0x92,
+    0x92, 0x9F, 0xD9, 0xAC, 0x90, 0x9D, 0xA9, 0x09, 0xF9, 0x0D, 0xA4, 0xE9, 0x9D, 0x59, 0xD9, 0x9D,
+    0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x9A, 0xCA, 0x6D, 0x99, 0xD6, 0xD9, 0x0D, 0x59, 0xD9,
+    0x0E, 0x4E, 0x91, 0xEA, 0xAA, 0xF9, 0x2A, 0xFA, 0x0D, 0x97, 0x1D, 0x72, 0xD7, 0x19, 0xD1, 0x99,
+    0x49, 0xDA, 0x1A, 0xFF, 0xA3, 0xAF, 0xCA, 0x92, 0x77, 0x49, 0xAF, 0xDA, 0x94, 0xFF, 0xE3, 0xEA,
+    0x49, 0xA9, 0x2E, 0x73, 0xAD, 0x74, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x49, 0xD5, 0x99, 0x99, 0x99,
+    0x09, 0xD5, 0xFD, 0x99, 0xD5, 0x9A, 0xAA, 0xD9, 0x9D, 0x71, 0xD9, 0x0D, 0x97, 0x0D, 0x90, 0xAD,
+    0x70, 0xD9, 0x1D, 0xA7, 0xD9, 0x19, 0xE9, 0x5D, 0x92, 0x9F, 0xCA, 0xAF, 0x94, 0xAF, 0xFA, 0x77,
+    0x70, 0x99, 0x97, 0x4A, 0xC9, 0x74, 0xD7, 0x49, 0xC9, 0x74, 0x99, 0x60, 0x77, 0x2A, 0xC7, 0x2C,
+    0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x76, 0x9A, 0xA9, 0x29, 0x29, 0xFD, 0x9A, 0xC9, 0x09, 0xDA, 0x90,
+    0x9F, 0x90, 0xDA, 0x4E, 0x99, 0xD5, 0x9D, 0x99, 0xD6, 0xD9, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9,
+    0xAC, 0xA6, 0xD9, 0x9D, 0x6D, 0x90, 0xD5, 0x9D, 0x90, 0xE4, 0xE9, 0x1E, 0xAA, 0xAF, 0x92, 0xAF,
+    0xA0, 0xD9, 0x71, 0xD7, 0x2D, 0x71, 0x9D, 0x19, 0x94, 0x9D, 0xA1, 0xAF, 0xFA, 0x3A, 0xFC, 0xA9,
+    0x20, 0x77, 0x39, 0xE7, 0x2F, 0xA7, 0x0D, 0x90, 0xD9, 0x6A, 0xC3, 0xAC, 0x97, 0x71, 0x9C, 0xA7,
+    0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A,
+    0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xD9, 0x99, 0x99, 0x99, 0x99, 0xD0, 0xAF, 0xFF, 0xC0,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70,
+    0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC,
+    0xA7, 0x0D, 0x00, 0x77, 0x09, 0xE7, 0x2F, 0xA7, 0x0D, 0x90, 0xD9, 0x6A, 0xC3, 0xAC, 0x77, 0x77,
+    0x7D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x91, 0xAA, 0xA9, 0x5D, 0x9A,
+    0xFD, 0x4F, 0x99, 0x09, 0xE3, 0xE5, 0xD3, 0xDA, 0x5D, 0x92, 0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92,
+    0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92, 0xD9, 0x5D, 0x92, 0xD9,
+    0x5D, 0x92, 0xD9, 0x5D, 0x90, 0x19, 0xCA, 0x70, 0xD4, 0xAC, 0xA7, 0x0D, 0x4A, 0xCA, 0x70, 0xD2,
+    0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xD9, 0x1A, 0xCA, 0x70, 0xD4, 0xAC, 0xA7, 0x0D, 0x4A, 0xD9, 0x99,
+    0x99, 0x99, 0x99, 0xD4, 0xAF, 0xFF, 0xC4, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x4A, 0xCA, 0x70,
+    0xD4, 0xAC, 0xA7, 0x0D, 0x4A, 0xCA, 0x70, 0xD4, 0xAC, 0xA7, 0x0D, 0x4A, 0xCA, 0x70, 0xD4, 0xAC,
+    0xA7, 0x0D, 0x4A, 0xCA, 0x70, 0xD4, 0xAC, 0xA7, 0x0D, 0x20, 0x1D, 0x97, 0x2D, 0x97, 0x0A, 0xFF,
+    0x93, 0xAF, 0xFA, 0x5D, 0x97, 0x2D, 0x97, 0x2D, 0x99, 0xFC, 0x93, 0xDA, 0xEA, 0xEA, 0x2E, 0xA3,
+    0xAD, 0x2E, 0x5D, 0x91, 0xDA, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91,
+    0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x90, 0x29,
+    0x49, 0x09, 0xEA, 0x1C, 0xA0, 0xCA, 0x9F, 0xC9, 0x0C, 0x29, 0xAC, 0x97, 0x4F, 0xD9, 0x2A, 0xFA,
+    0x5D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D,
+    0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x49, 0xAE, 0xA3, 0xFD, 0x90, 0x29, 0x49, 0x09, 0xEA, 0x1C, 0xA0,
+    0xCA, 0x9F, 0xC9, 0x0C, 0x29, 0xAC, 0x97, 0x69, 0x97, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9,
+    0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x20, 0x9F, 0xE9, 0xFE,
+    0x70, 0xFD, 0x90, 0xAF, 0xA3, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x92, 0x9A, 0xEA, 0x1F, 0xD9, 0x9F, 0xE9,
+    0xFE, 0x72, 0x99, 0x5D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x91, 0x99, 0x4A, 0x09, 0xC3, 0xAC, 0x1F, 0xD9, 0x2A, 0xDA,
+    0x74, 0xFD, 0x91, 0xAF, 0xA4, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D,
+    0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x93, 0x9A, 0xEA, 0x2F, 0xD9, 0x00, 0x99,
+    0x4A, 0x09, 0xC3, 0xAC, 0x1F, 0xD9, 0x2A, 0xDA, 0x76, 0x99, 0x6D, 0x95, 0xD9, 0x5D, 0x95, 0xD9,
+    0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x92, 0xFD, 0x9A,
+    0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9,
+    0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19, 0xAE, 0xA0, 0xFD, 0x92, 0x9C, 0x93, 0xCA, 0x3A, 0xC4,
+    0xAC, 0x93, 0x9E, 0x93, 0x99, 0x00, 0x29, 0x2D, 0x91, 0xD9, 0x29, 0x79, 0x92, 0xD9, 0x1D, 0x91,
+    0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x91, 0xD9,
+    0x1C, 0xA1, 0xD2, 0xCA, 0x19, 0xCA, 0x2F, 0x19, 0x99, 0x29, 0x4D, 0x93, 0xD9, 0x49, 0x71, 0xFD,
+    0x9A, 0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19, 0xAE, 0xA0, 0xFD, 0x90, 0x99, 0x0D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x90, 0xFD, 0x92, 0xD0, 0xAF, 0xA3,
+    0xD2, 0xD9, 0x4D, 0x2D, 0x94, 0xD2, 0xD9, 0x4D, 0x2D, 0x94, 0xD2, 0xD9, 0x4D, 0x2D, 0x94, 0xD2,
+    0xD9, 0x4D, 0x2D, 0x94, 0xD2, 0xD9, 0x4D, 0x2D, 0x94, 0xD2, 0xD9, 0x4D, 0x2D, 0x94, 0xD2, 0xD9,
+    0x4D, 0x2D, 0x94, 0xD0, 0x9A, 0xEA, 0x3D, 0x0F, 0xD9, 0x2D, 0x71, 0x9D, 0x71, 0xAD, 0x69, 0x0A,
+    0xD9, 0x59, 0xFA, 0x7A, 0xAA, 0x92, 0x19, 0x49, 0x1D, 0x92, 0xAD, 0x0D, 0x92, 0x9D, 0x19, 0x49,
+    0x73, 0x99, 0x49, 0x90, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0,
+    0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9,
+    0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD0, 0xD9, 0x29, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x6D,
+    0xA3, 0xFC, 0x4F, 0x90, 0x75, 0xE5, 0xFA, 0x3D, 0x90, 0xAC, 0xA1, 0xAC, 0x92, 0x9C, 0x97, 0x5A,
+    0xC9, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A,
+    0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6A,
+    0xCA, 0x6A, 0xCA, 0x6A, 0xCA, 0x6D, 0x92, 0x90, 0x9E, 0x3F, 0xC9, 0x3A, 0xAA, 0xA5, 0x74, 0x9D,
+    0xA5, 0xFA, 0x3D, 0x90, 0xD9, 0x1A, 0xC3, 0xAC, 0x76, 0x99, 0x7D, 0x96, 0xD9, 0x6D, 0x96, 0xD9,
+    0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D,
+    0x96, 0xD9, 0x59, 0xD3, 0x9F, 0xA3, 0x9E, 0xA4, 0x9C, 0xA6, 0xAC, 0xA0, 0xAC, 0xA5, 0xAD, 0x1A,
+    0xCA, 0x4A, 0xD2, 0xAC, 0xA3, 0x9D, 0x3A, 0xCA, 0x29, 0xD9, 0x3A, 0xCA, 0x2D, 0x94, 0xAC, 0xA1,
+    0xD9, 0x5A, 0xCA, 0x0D, 0xA6, 0xAC, 0xAE, 0xA6, 0xAE, 0xAD, 0x95, 0xAD, 0x90, 0xAD, 0x5A, 0xCA,
+    0x2D, 0xA4, 0xAC, 0xA2, 0x9D, 0x93, 0xAC, 0xA3, 0xAD, 0x3A, 0xCA, 0x4E, 0x2A, 0xCA, 0x5D, 0xA1,
+    0xAC, 0xA5, 0x9D, 0x90, 0xAC, 0xA6, 0xAD, 0x77, 0x49, 0x97, 0x29, 0xCA, 0x72, 0xD7, 0x3C, 0xA7,
+    0x3A, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x49, 0x91, 0xD9,
+    0x3A, 0xD1, 0xD9, 0x2A, 0xD2, 0xD9, 0x1A, 0xD3, 0xD9, 0x0A, 0xD4, 0xD9, 0x9D, 0x5D, 0x9D, 0xA5,
+    0xFD, 0x5E, 0x0A, 0xD4, 0xD9, 0x1D, 0xA3, 0xD9, 0x2D, 0x92, 0xD9, 0x29, 0xD2, 0xD9, 0x3A, 0xD1,
+    0xD9, 0x4D, 0xA7, 0x70, 0x99, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0x71, 0x97, 0x99, 0x59, 0x91,
+    0xD9, 0x3A, 0xD1, 0xD9, 0x2A, 0xD2, 0xD9, 0x19, 0xD9, 0x2D, 0x90, 0x9D, 0x93, 0xD9, 0x0D, 0xA4,
+    0xD9, 0xE5, 0xFD, 0x94, 0xE9, 0xAD, 0x4D, 0xA1, 0xE3, 0xD9, 0x2D, 0xA2, 0xD9, 0x29, 0xD9, 0x1D,
+    0x93, 0xAD, 0x1D, 0x94, 0xDA, 0x00, 0x74, 0xE6, 0x9D, 0x7D, 0x7A, 0xC7, 0x73, 0x9C, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A,
+    0xFF, 0xC9, 0x70, 0xDA, 0x1A, 0xD1, 0x9D, 0x2C, 0xA7, 0x7D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D,
+    0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92,
+    0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x91, 0x9C, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x77, 0x99, 0x70, 0xD7, 0xAC,
+    0x97, 0xD7, 0x0A, 0x50, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9,
+    0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D,
+    0x95, 0x99, 0x0A, 0xCA, 0x0D, 0x1C, 0xA1, 0xA1, 0x9C, 0xA4, 0xAC, 0x9A, 0xCA, 0x4D, 0x0A, 0xCA,
+    0x4C, 0xA0, 0xAC, 0xA3, 0x9C, 0x1A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xFF, 0xC9,
+    0xAF, 0xFC, 0x90, 0xD9, 0x0D, 0x9D, 0x90, 0xD0, 0xD9, 0x0C, 0x90, 0xD9, 0xAC, 0x1D, 0x93, 0xD9,
+    0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D,
+    0x93, 0xD9, 0x3D, 0x93, 0x9C, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA3, 0x92, 0xAC, 0xA2, 0xAD, 0x1A, 0xCA, 0x2A, 0xD1, 0xAC, 0xA3, 0x92, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0xD9, 0x2D,
+    0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x09, 0x0D, 0x9A, 0xF9, 0xAF,
+    0x90, 0x90, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x20, 0x19, 0xCA, 0x71,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC,
+    0xA0, 0xAC, 0xA5, 0xAF, 0xC9, 0x5A, 0xE9, 0x6A, 0xE7, 0x9E, 0xA7, 0x09, 0xAC, 0xA7, 0x1A, 0xCA,
+    0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAF, 0xFC, 0x91, 0xAF, 0xFC, 0x90, 0x2D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x09, 0x3F, 0x92, 0xEA, 0x19, 0xE9, 0x2F, 0x39, 0x0D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5D, 0x20, 0x77, 0x6E, 0x72, 0x9D, 0x73, 0xD7, 0x3A, 0xC7, 0x75, 0x9D, 0x97, 0x9C,
+    0x9A, 0xE7, 0xAC, 0xAA, 0xEA, 0x6A, 0xCA, 0xAC, 0xAD, 0x6A, 0xCA, 0xAC, 0x9A, 0xD5, 0xAC, 0xAA,
+    0xC9, 0x0D, 0x94, 0xAC, 0xAA, 0xC9, 0x09, 0xD4, 0xAC, 0xAA, 0xC9, 0x1E, 0x3A, 0xCA, 0xAC, 0xA2,
+    0xD9, 0x2A, 0xCA, 0xAC, 0xA2, 0xAD, 0x2A, 0xCA, 0xAC, 0xA3, 0xDA, 0x1A, 0xCA, 0xAC, 0xA4, 0xD9,
+    0x0A, 0xCA, 0xAC, 0xA4, 0xAD, 0x09, 0xCA, 0xAC, 0xA5, 0xDA, 0x9C, 0xAA, 0xCA, 0x59, 0xDA, 0xCA,
+    0xAC, 0xA6, 0xAE, 0xAA, 0xCA, 0x7E, 0xAA, 0xCA, 0x79, 0xDA, 0x77, 0x1A, 0xD7, 0x0D, 0x97, 0xD9,
+    0x79, 0xC9, 0x77, 0x09, 0x91, 0x9A, 0xAA, 0x92, 0xD0, 0xAF, 0xD1, 0xF9, 0x90, 0x9E, 0x0E, 0x5D,
+    0x0D, 0xA5, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D,
+    0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x90, 0x9D, 0x97, 0x9C, 0x9A, 0xE7, 0xAC,
+    0xAA, 0xEA, 0x6A, 0xCA, 0xAC, 0xAD, 0x6A, 0xCA, 0xAC, 0x9A, 0xD5, 0xAC, 0xAA, 0xC9, 0x0D, 0x94,
+    0xAC, 0xAA, 0xC9, 0x09, 0xD4, 0xAC, 0xAA, 0xC9, 0x1E, 0x3A, 0xCA, 0xAC, 0xA2, 0xD9, 0x2A, 0xCA,
+    0xAC, 0xA2, 0xAD, 0x2A, 0xCA, 0xAC, 0xA3, 0xDA, 0x1A, 0xCA, 0xAC, 0xA4, 0xD9, 0x0A, 0xCA, 0xAC,
+    0xA4, 0xAD, 0x09, 0xCA, 0xAC, 0xA5, 0xDA, 0x9C, 0xAA, 0xCA, 0x59, 0xDA, 0xCA, 0xAC, 0xA6, 0xAE,
+    0xAA, 0xCA, 0x7E, 0xAA, 0xCA, 0x79, 0xDA, 0x77, 0x59, 0x97, 0x4D, 0x73, 0xAC, 0x97, 0x3D, 0x74,
+    0xA7, 0x99, 0x19, 0xAA, 0xA9, 0x2D, 0x0A, 0xFD, 0x1F, 0x99, 0x09, 0xE0, 0xE5, 0xD0, 0xDA, 0x5D,
+    0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D,
+    0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0x77, 0x09, 0x97, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC7,
+    0x19, 0x95, 0x77, 0x19, 0xCA, 0x2A, 0xC9, 0x6A, 0xD0, 0xD9, 0x70, 0xAE, 0xA7, 0x2A, 0xCA, 0x77,
+    0x49, 0xD9, 0x79, 0xC9, 0xAE, 0x7A, 0xCA, 0xAE, 0xA6, 0xAC, 0xAA, 0xCA, 0xD6, 0xAC, 0xAA, 0xC9,
+    0xAD, 0x5A, 0xCA, 0xAC, 0x90, 0xD9, 0x4A, 0xCA, 0xAC, 0x90, 0x9D, 0x4A, 0xCA, 0xAC, 0x91, 0xE3,
+    0xAC, 0xAA, 0xCA, 0x2D, 0x92, 0xAC, 0xAA, 0xCA, 0x2A, 0xD2, 0xAC, 0xAA, 0xCA, 0x3D, 0xA1, 0xAC,
+    0xAA, 0xCA, 0x4D, 0x90, 0xAC, 0xAA, 0xCA, 0x4A, 0xD0, 0x9C, 0xAA, 0xCA, 0x5D, 0xA9, 0xCA, 0xAC,
+    0xA5, 0x9D, 0xAC, 0xAA, 0xCA, 0x6A, 0xEA, 0xAC, 0xA7, 0xEA, 0xAC, 0xA7, 0x9D, 0xA0, 0x75, 0xD2,
+    0x9C, 0xA3, 0x9D, 0x0A, 0xCA, 0x59, 0xF7, 0xAD, 0x77, 0x09, 0x91, 0x9A, 0xAA, 0x92, 0xD0, 0xAF,
+    0xD1, 0xF9, 0x90, 0x9E, 0x0E, 0x5D, 0x0D, 0xA5, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D,
+    0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x90,
+    0x0A, 0xCA, 0x74, 0xD9, 0x74, 0xD7, 0x49, 0xD7, 0x4A, 0xC9, 0x09, 0x91, 0x9A, 0xAA, 0x92, 0xD1,
+    0xD0, 0xFE, 0x19, 0x2F, 0x90, 0x99, 0xDA, 0x4E, 0x49, 0xD4, 0xD9, 0x5D, 0x4D, 0x6D, 0x4D, 0x6D,
+    0x4D, 0x6D, 0x4D, 0x6D, 0x4D, 0x6D, 0x4D, 0x6D, 0x4D, 0x6D, 0x4D, 0x6D, 0x4D, 0x6D, 0x00, 0x9D,
+    0x97, 0x9C, 0x9A, 0xE7, 0xAC, 0xAA, 0xEA, 0x6A, 0xCA, 0xAC, 0xAD, 0x95, 0xAC, 0xAA, 0xC9, 0xAD,
+    0x5A, 0xCA, 0xAC, 0x90, 0xDA, 0x4A, 0xCA, 0xAC, 0x90, 0x9D, 0x93, 0xAC, 0xAA, 0xC9, 0x1A, 0xD3,
+    0xAC, 0xAA, 0xCA, 0x2D, 0xA2, 0xAC, 0xAA, 0xCA, 0x29, 0xD9, 0x1A, 0xCA, 0xAC, 0xA3, 0xAD, 0x1A,
+    0xCA, 0xAC, 0xA4, 0xDA, 0x09, 0xCA, 0xAC, 0xA4, 0x9D, 0x99, 0xCA, 0xAC, 0xA5, 0xAD, 0x9C, 0xAA,
+    0xCA, 0x6F, 0xAA, 0xCA, 0x7E, 0xAA, 0xCA, 0x7A, 0xDA, 0xAC, 0xA7, 0x0D, 0xA7, 0x3A, 0xCA, 0x73,
+    0xD9, 0x79, 0x09, 0xAD, 0x70, 0xFC, 0x97, 0x0A, 0xAA, 0xA2, 0x99, 0x19, 0xAA, 0xA9, 0x2D, 0x0A,
+    0xFD, 0x1F, 0x99, 0x09, 0xE0, 0xE5, 0xD9, 0xDA, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95,
+    0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9, 0xD9, 0x5D, 0x9D, 0x95, 0xD9,
+    0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x5F, 0xC6, 0xEA, 0x10, 0x4F, 0xE9, 0x70, 0xFE,
+    0x97, 0x77, 0x1A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70,
+    0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29,
+    0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97,
+    0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74, 0x2F, 0xE5, 0xFE, 0x77,
+    0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99,
+    0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D,
+    0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x4A, 0x49, 0x97, 0x0C, 0xA2,
+    0x9C, 0x97, 0x09, 0xFD, 0x72, 0x9A, 0xDA, 0x77, 0x73, 0xAF, 0xD9, 0x69, 0xFF, 0xD4, 0x9D, 0xA4,
+    0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA, 0x0D, 0x72, 0xAD, 0x9D, 0x72,
+    0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0xAD, 0x0D, 0x97, 0x1D,
+    0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E, 0x4A, 0xFA, 0xAF, 0x69, 0xAF,
+    0xDA, 0x77, 0x40, 0x2A, 0x49, 0x5C, 0x92, 0x9C, 0x5A, 0xFC, 0xA6, 0x9A, 0xD9, 0x77, 0x49, 0xAA,
+    0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC,
+    0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1,
+    0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0x6D, 0xA0, 0x9D, 0x70, 0x9D, 0x1D,
+    0x71, 0xD1, 0xAC, 0x97, 0x0A, 0xC2, 0xC9, 0x77, 0x73, 0xAF, 0xD9, 0x69, 0xFF, 0xD4, 0x9D, 0xA4,
+    0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA, 0x0D, 0x72, 0xAD, 0x9D, 0x72,
+    0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0xAD, 0x0D, 0x97, 0x1D,
+    0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E, 0x4A, 0xFA, 0xAF, 0x69, 0xAF,
+    0xDA, 0x77, 0x40, 0x77, 0x0D, 0x90, 0xAD, 0x4A, 0xCA, 0x1D, 0x5C, 0xA1, 0xD5, 0xAA, 0x19, 0xC7,
+    0x75, 0x9A, 0xAA, 0x95, 0x9F, 0xE9, 0x3D, 0xA9, 0x09, 0xAD, 0x91, 0xDA, 0x4A, 0xD1, 0xD6, 0xD9,
+    0x9D, 0x6A, 0xCA, 0xAC, 0xA6, 0xAC, 0xAA, 0xCA, 0x6A, 0xDA, 0xCA, 0x6A, 0xCA, 0x9D, 0x6D, 0xA0,
+    0xD9, 0x5D, 0x1A, 0xD4, 0xE2, 0xEA, 0xAA, 0xE4, 0x9F, 0xCA, 0x77, 0x77, 0x71, 0xAF, 0xFF, 0xDA,
+    0x2A, 0xFF, 0xFF, 0xA1, 0xAD, 0xA4, 0xDA, 0x70, 0xDA, 0x5A, 0xCA, 0x7A, 0xD6, 0xAC, 0xA7, 0xD9,
+    0x6A, 0xCA, 0x69, 0xD7, 0xAC, 0xA6, 0x9D, 0x7A, 0xCA, 0x99, 0x99, 0x99, 0x09, 0xD7, 0xAF, 0xF0,
+    0x9D, 0x7A, 0xDA, 0xAA, 0xAA, 0xA0, 0x9D, 0x7A, 0xCA, 0x69, 0xD7, 0xAC, 0xA7, 0xD9, 0x6A, 0xCA,
+    0x7A, 0xD6, 0xAC, 0xA7, 0x0D, 0x95, 0xAC, 0xA7, 0x0A, 0xDA, 0x4A, 0xCA, 0x71, 0xAF, 0xAA, 0xFF,
+    0xDA, 0x39, 0xAF, 0xFF, 0xDA, 0x77, 0x40, 0x39, 0xAA, 0xA9, 0x49, 0xAA, 0x95, 0x9F, 0xE1, 0x9F,
+    0xD9, 0x29, 0xDA, 0x90, 0x9E, 0x9D, 0x91, 0xAD, 0x91, 0xDA, 0x4A, 0xE9, 0x3A, 0xD0, 0x9D, 0x6E,
+    0x5D, 0x0A, 0xD6, 0xDA, 0x5D, 0x9A, 0xCA, 0x6F, 0xFE, 0x9A, 0xCA, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x0A, 0xCA, 0x6D, 0xA7, 0x09, 0xD6, 0xDA, 0x71, 0xD5, 0x9E, 0x71, 0xAD, 0x4F, 0xC5, 0x92, 0xEA,
+    0xAA, 0xDA, 0x0E, 0xAA, 0xAE, 0x3A, 0xFC, 0x92, 0xAF, 0xD9, 0x77, 0x60, 0x77, 0x3A, 0xD7, 0x2D,
+    0x97, 0x1D, 0x97, 0x19, 0xC9, 0x77, 0x49, 0xFD, 0xA9, 0x4A, 0xFF, 0xC9, 0x2A, 0xCA, 0x39, 0xE2,
+    0xAC, 0xA5, 0xDA, 0x1A, 0xCA, 0x5A, 0xD1, 0xAC, 0xA5, 0x9D, 0x1A, 0xCA, 0x5A, 0xCA, 0x1A, 0xCA,
+    0x5D, 0x91, 0xAD, 0x99, 0x99, 0xAD, 0xA2, 0xAF, 0xF9, 0x3A, 0xDA, 0xAA, 0xDA, 0x4A, 0xCA, 0x29,
+    0xD4, 0xAC, 0xA3, 0xAD, 0x3A, 0xCA, 0x4D, 0x92, 0xAC, 0xA4, 0xAD, 0x2A, 0xCA, 0x5D, 0xA1, 0xAC,
+    0xA5, 0x9D, 0x90, 0xAC, 0xA6, 0xAD, 0x00, 0x73, 0x9D, 0x93, 0xDA, 0x3A, 0xCA, 0x4C, 0xA7, 0x29,
+    0x92, 0xAA, 0xAD, 0x09, 0xFD, 0x9D, 0x99, 0x9E, 0xA3, 0xE4, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x40, 0x9F, 0xDA, 0x94, 0xAF, 0xFC, 0x92, 0xAC, 0xA3,
+    0x9E, 0x2A, 0xCA, 0x5D, 0xA1, 0xAC, 0xA5, 0xAD, 0x1A, 0xCA, 0x59, 0xD1, 0xAC, 0xA5, 0xAC, 0xA1,
+    0xAC, 0xA5, 0xD9, 0x1A, 0xD9, 0x99, 0x9A, 0xDA, 0x2A, 0xFF, 0x93, 0xAD, 0xAA, 0xAD, 0xA4, 0xAC,
+    0xA2, 0x9D, 0x4A, 0xCA, 0x3A, 0xD3, 0xAC, 0xA4, 0xD9, 0x2A, 0xCA, 0x4A, 0xD2, 0xAC, 0xA5, 0xDA,
+    0x1A, 0xCA, 0x59, 0xD9, 0x0A, 0xCA, 0x6A, 0xD7, 0x74, 0x99, 0x72, 0xAC, 0xA7, 0x2D, 0x73, 0xCA,
+    0x73, 0xA7, 0x09, 0x92, 0xAA, 0xA0, 0xD0, 0x9F, 0x0D, 0x9D, 0x99, 0x90, 0xEA, 0x4E, 0x5D, 0x95,
+    0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x97, 0x79, 0x95, 0xAC, 0x95,
+    0xD6, 0xC9, 0x69, 0x60, 0x77, 0xD2, 0x9C, 0xA5, 0x9D, 0x0A, 0xCA, 0x79, 0xF7, 0x1A, 0xD7, 0x74,
+    0x9F, 0xDA, 0x94, 0xAF, 0xFC, 0x92, 0xAC, 0xA3, 0x9E, 0x2A, 0xCA, 0x5D, 0xA1, 0xAC, 0xA5, 0xAD,
+    0x1A, 0xCA, 0x59, 0xD1, 0xAC, 0xA5, 0xAC, 0xA1, 0xAC, 0xA5, 0xD9, 0x1A, 0xD9, 0x99, 0x9A, 0xDA,
+    0x2A, 0xFF, 0x93, 0xAD, 0xAA, 0xAD, 0xA4, 0xAC, 0xA2, 0x9D, 0x4A, 0xCA, 0x3A, 0xD3, 0xAC, 0xA4,
+    0xD9, 0x2A, 0xCA, 0x4A, 0xD2, 0xAC, 0xA5, 0xDA, 0x1A, 0xCA, 0x59, 0xD9, 0x0A, 0xCA, 0x6A, 0xD0,
+    0x72, 0xD2, 0x9D, 0x2D, 0x99, 0xD4, 0xF5, 0x9D, 0x97, 0x59, 0x92, 0xAA, 0xA1, 0xD0, 0x9F, 0x1D,
+    0x9D, 0x99, 0x91, 0xEA, 0x5E, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96, 0xD9, 0x6D, 0x96,
+    0xD9, 0x6D, 0x95, 0x77, 0x2D, 0xA7, 0xDA, 0x79, 0xCA, 0x70, 0xCA, 0x77, 0x3A, 0xFC, 0xA9, 0x19,
+    0xFF, 0xC1, 0xDA, 0x49, 0x90, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0xAE, 0x97, 0x9F,
+    0xA7, 0xAF, 0xA7, 0x9E, 0xA7, 0x09, 0xD9, 0x70, 0xD9, 0x70, 0xAC, 0xA7, 0x0D, 0x99, 0x95, 0xAD,
+    0x0A, 0xEA, 0xAF, 0x90, 0x9F, 0xEA, 0x76, 0x76, 0x9D, 0x95, 0xDA, 0x5A, 0xCA, 0x6C, 0xA7, 0x70,
+    0x9A, 0xAA, 0x92, 0xAF, 0xE9, 0x9D, 0x91, 0x9A, 0xC0, 0xAC, 0x96, 0xAC, 0xA6, 0x9D, 0xA6, 0x9F,
+    0x95, 0xAF, 0x95, 0x9E, 0x96, 0xAC, 0xA6, 0x9D, 0x95, 0xAC, 0xAA, 0xDA, 0xAA, 0xE0, 0x9F, 0xDA,
+    0x73, 0x77, 0x9D, 0xA6, 0x9F, 0x95, 0xD1, 0xD9, 0x3A, 0xA3, 0xAC, 0x77, 0x0A, 0xFC, 0xA9, 0x19,
+    0xFF, 0xC1, 0xDA, 0x49, 0x90, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0x71, 0xDA, 0x70, 0xAE, 0x97, 0x9F,
+    0xA7, 0xAF, 0xA7, 0x9E, 0xA7, 0x09, 0xD9, 0x70, 0xD9, 0x70, 0xAC, 0xA7, 0x0D, 0x99, 0x95, 0xAD,
+    0x0A, 0xEA, 0xAF, 0x90, 0x9F, 0xEA, 0x76, 0x74, 0xAD, 0xA4, 0x9F, 0x92, 0x9D, 0x1D, 0x2C, 0xA3,
+    0xAC, 0x75, 0x9A, 0xAA, 0x92, 0xAF, 0xE9, 0x9D, 0x91, 0x9A, 0xC0, 0xAC, 0x96, 0xAC, 0xA6, 0x9D,
+    0xA6, 0x9F, 0x95, 0xAF, 0x95, 0x9E, 0x96, 0xAC, 0xA6, 0x9D, 0x95, 0xAC, 0xAA, 0xDA, 0xAA, 0xE0,
+    0x9F, 0xDA, 0x73, 0x76, 0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0x1D, 0xA4, 0x99, 0x09, 0xD7, 0x09, 0xD7,
+    0x09, 0xD7, 0x1D, 0xA7, 0x0A, 0xE9, 0x79, 0xFA, 0x7A, 0xFA, 0x79, 0xEA, 0x70, 0x9D, 0x97, 0x0D,
+    0x97, 0x0A, 0xCA, 0x70, 0xD9, 0x99, 0x5A, 0xD0, 0xAE, 0xAA, 0xF9, 0x09, 0xFE, 0xA6, 0xAC, 0x97,
+    0x0D, 0x97, 0x09, 0xAC, 0xA7, 0x1D, 0x69, 0x9A, 0xCA, 0x6E, 0xA4, 0x29, 0xAA, 0xA9, 0x2A, 0xFE,
+    0x99, 0xD9, 0x19, 0xAC, 0x0A, 0xC9, 0x6A, 0xCA, 0x69, 0xDA, 0x69, 0xF9, 0x5A, 0xF9, 0x59, 0xE9,
+    0x6A, 0xCA, 0x69, 0xD9, 0x5A, 0xCA, 0xAD, 0xAA, 0xAE, 0x09, 0xFD, 0xA5, 0xCA, 0x69, 0xCA, 0x79,
+    0xD7, 0x9C, 0x94, 0x99, 0xD4, 0x9E, 0x92, 0x75, 0xD9, 0x2D, 0x4D, 0x99, 0xD6, 0xF7, 0x9D, 0x97,
+    0x72, 0xAF, 0xCA, 0x91, 0x9F, 0xFC, 0x1D, 0xA4, 0x99, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x1D,
+    0xA7, 0x0A, 0xE9, 0x79, 0xFA, 0x7A, 0xFA, 0x79, 0xEA, 0x70, 0x9D, 0x97, 0x0D, 0x97, 0x0A, 0xCA,
+    0x70, 0xD9, 0x99, 0x5A, 0xD0, 0xAE, 0xAA, 0xF9, 0x09, 0xFE, 0xA7, 0x60, 0x72, 0xD2, 0x9D, 0x2D,
+    0x99, 0xD4, 0xF5, 0x9D, 0x97, 0x79, 0xAA, 0xA9, 0x2A, 0xFE, 0x99, 0xD9, 0x19, 0xAC, 0x0A, 0xC9,
+    0x6A, 0xCA, 0x69, 0xDA, 0x69, 0xF9, 0x5A, 0xF9, 0x59, 0xE9, 0x6A, 0xCA, 0x69, 0xD9, 0x5A, 0xCA,
+    0xAD, 0xAA, 0xAE, 0x09, 0xFD, 0xA7, 0x30, 0xAF, 0xFF, 0xAF, 0xFF, 0xCA, 0x49, 0xD7, 0x3D, 0x73,
+    0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xCA, 0x72, 0x9C, 0xA7, 0x39, 0xD7, 0x39, 0xC9, 0x70, 0x99, 0xD7,
+    0x09, 0xE9, 0x40, 0x29, 0x7C, 0xA5, 0x9C, 0xA4, 0x9D, 0xA9, 0x99, 0x0A, 0xFE, 0x90, 0x9D, 0xA9,
+    0x99, 0x2A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A,
+    0xCA, 0x5A, 0xD6, 0xEA, 0xA9, 0x29, 0xF9, 0x39, 0xC9, 0x5D, 0x95, 0x9A, 0xCA, 0x6D, 0x39, 0x9A,
+    0xCA, 0x3E, 0xA1, 0x77, 0x0D, 0x29, 0xD6, 0xD9, 0x9D, 0x70, 0xF7, 0x19, 0xD9, 0x77, 0x2A, 0xFF,
+    0xFA, 0xFF, 0xFC, 0xA4, 0x9D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD5, 0x70, 0x9C, 0xA7, 0x0A,
+    0xC9, 0x29, 0x4D, 0x3C, 0xA3, 0xC9, 0x29, 0xCA, 0x79, 0xDA, 0x99, 0x93, 0xAF, 0xE9, 0x39, 0xDA,
+    0x99, 0x95, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA,
+    0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAD, 0x71, 0xEA, 0xA9, 0x59, 0xF9, 0x76, 0xAF, 0xFF, 0xAF,
+    0xFF, 0xCA, 0x49, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x7F, 0xFC, 0xA3, 0xFF, 0xCA,
+    0x7D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD5, 0x29, 0x7C, 0xA5, 0x9C,
+    0xA4, 0x9D, 0xA9, 0x99, 0x0A, 0xFE, 0x90, 0x9D, 0xA9, 0x99, 0x2A, 0xCA, 0x5A, 0xCA, 0x39, 0xAE,
+    0xAA, 0xA0, 0x9F, 0xE2, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAD, 0x6E, 0xAA, 0x92,
+    0x9F, 0x97, 0x00, 0x49, 0x49, 0x4A, 0xEA, 0x1C, 0xA4, 0xCA, 0x9F, 0xC4, 0x9C, 0x29, 0xAC, 0x97,
+    0x70, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0,
+    0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77, 0x00, 0x39, 0x93, 0x94, 0xF9,
+    0x09, 0xC3, 0xAC, 0x9A, 0xFC, 0x3A, 0x92, 0xAC, 0xA7, 0x70, 0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D,
+    0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA,
+    0x0A, 0xC9, 0x74, 0x2A, 0xFE, 0x59, 0xFD, 0xA7, 0x70, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4,
+    0xAF, 0xDA, 0x77, 0x00, 0x2F, 0xE9, 0x4F, 0xE9, 0x77, 0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90,
+    0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA, 0x0A,
+    0xC9, 0x74, 0x29, 0x94, 0x95, 0xAC, 0x3D, 0x6F, 0xD9, 0x7A, 0xDA, 0x77, 0x2A, 0xC9, 0x70, 0xFA,
+    0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA,
+    0x70, 0xFA, 0x70, 0xFA, 0x70, 0xDA, 0xCA, 0x79, 0xDA, 0xD7, 0x9D, 0x0D, 0x7D, 0x90, 0xAD, 0x94,
+    0xE2, 0xFA, 0xAF, 0x4A, 0xFD, 0xA7, 0x70, 0x2A, 0x49, 0x94, 0xCA, 0x29, 0xC9, 0x49, 0xFD, 0x69,
+    0xAD, 0x97, 0x71, 0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90,
+    0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90,
+    0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA, 0x0A, 0xC9, 0x74, 0x59, 0x97, 0x2F, 0x97,
+    0xAC, 0x1A, 0xC7, 0xAC, 0x1A, 0xC7, 0x9C, 0xA9, 0xCA, 0x70, 0x9D, 0xA7, 0x72, 0xAC, 0x97, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9,
+    0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77, 0x00, 0x59, 0x97, 0x09, 0xF7, 0xCA, 0x1C, 0x96, 0xC9,
+    0x1C, 0x96, 0xAC, 0x9A, 0xC7, 0x0A, 0xCA, 0x97, 0x71, 0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90,
+    0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xAD, 0x4E, 0x90, 0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA, 0x0A,
+    0xC9, 0x74, 0x77, 0x1A, 0xD1, 0xD9, 0x5D, 0x1A, 0xCA, 0x5A, 0xC9, 0x09, 0xCA, 0x6C, 0x91, 0xAA,
+    0x77, 0x2A, 0xC9, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70,
+    0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xDA, 0xCA, 0x79, 0xDA, 0xD7, 0x9D,
+    0x0D, 0x7D, 0x90, 0xAD, 0x94, 0xE2, 0xFA, 0xAF, 0x4A, 0xFD, 0xA7, 0x70, 0x77, 0x0D, 0xA0, 0xAD,
+    0x49, 0xCA, 0x1D, 0x5D, 0x1A, 0xC9, 0x4A, 0xA2, 0xC9, 0x77, 0x19, 0x96, 0x99, 0x1D, 0x6D, 0x90,
+    0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6,
+    0xD9, 0x0D, 0x6D, 0x90, 0xD9, 0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA, 0xAA, 0xF9, 0x19, 0xFC,
+    0xA0, 0xAC, 0x97, 0x40, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7,
+    0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC, 0xA7, 0x9D,
+    0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xE7, 0x29, 0xC9, 0x72,
+    0xD7, 0x3C, 0xA7, 0x3D, 0x73, 0xF7, 0x29, 0x99, 0x10, 0x09, 0x96, 0x99, 0x1D, 0x6D, 0x90, 0xD6,
+    0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9,
+    0x0D, 0x6D, 0x90, 0xD9, 0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA, 0xAA, 0xF9, 0x19, 0xFC, 0xA0,
+    0xAC, 0x97, 0x09, 0xC9, 0x71, 0xCA, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x72, 0xEA, 0x71, 0x99, 0x00,
+    0x77, 0x77, 0x0E, 0x77, 0x2A, 0xF7, 0x70, 0xAC, 0xA0, 0x9D, 0x76, 0x9C, 0x92, 0x9C, 0xA7, 0x77,
+    0x5A, 0xCA, 0x6A, 0xCA, 0x69, 0xCA, 0x9D, 0x6E, 0x6D, 0xA0, 0xD9, 0x49, 0xE9, 0x5D, 0x90, 0xDA,
+    0x4A, 0xCA, 0xCA, 0x49, 0xD1, 0xAD, 0x4D, 0x9D, 0x4A, 0xD1, 0x9D, 0x4D, 0x0D, 0x93, 0xDA, 0x2D,
+    0x92, 0x9C, 0xA0, 0xAC, 0xA3, 0xD3, 0xDA, 0x2D, 0x91, 0xD2, 0x9D, 0x39, 0xD2, 0xD2, 0xD2, 0xAC,
+    0xA4, 0xD1, 0x9D, 0x2A, 0xCA, 0x1D, 0x94, 0xD9, 0x0A, 0xC9, 0x29, 0xD1, 0xD5, 0xAC, 0xA0, 0xD4,
+    0xD0, 0x9D, 0x59, 0xD0, 0xD4, 0xAC, 0x9A, 0xCA, 0x6D, 0x9C, 0xA4, 0x9C, 0xAA, 0xC9, 0x6D, 0xAC,
+    0x95, 0xF7, 0xAE, 0x6F, 0x79, 0xDA, 0x6A, 0xDA, 0x70, 0xD9, 0x7D, 0x93, 0x77, 0x73, 0xE9, 0x76,
+    0xAF, 0x75, 0x9D, 0x09, 0xD7, 0x4C, 0xA3, 0xCA, 0x77, 0x71, 0x99, 0x95, 0x99, 0x59, 0x90, 0x9D,
+    0x4A, 0xD9, 0x4D, 0x1D, 0x4E, 0xA3, 0x9D, 0x1D, 0x92, 0x9C, 0xAD, 0x3A, 0xCA, 0x1A, 0xCA, 0x2A,
+    0xC9, 0xD3, 0xD9, 0x19, 0xD2, 0xD0, 0x9C, 0xA2, 0xD3, 0xD2, 0xD1, 0xD1, 0x9C, 0xA3, 0xD9, 0x0A,
+    0xCA, 0x1D, 0x1A, 0xC9, 0x3A, 0xCA, 0x0D, 0x2A, 0xC9, 0x0D, 0x49, 0xD0, 0xD2, 0x9D, 0x0D, 0x5D,
+    0x9C, 0xA3, 0xD9, 0xCA, 0x5A, 0xE4, 0xAE, 0x95, 0x9E, 0x49, 0xE7, 0xDA, 0x5E, 0x30, 0x77, 0x3A,
+    0xDA, 0x71, 0x9F, 0x97, 0x0D, 0x1D, 0x96, 0xCA, 0x3A, 0xC7, 0x72, 0xAC, 0xA7, 0x9D, 0x09, 0xD7,
+    0xD9, 0x1A, 0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5, 0xD9, 0x2D, 0x6A, 0xD1, 0xAC,
+    0xA7, 0xD9, 0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7, 0x3D, 0x74, 0xD7, 0x4D, 0x74,
+    0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x60, 0x77, 0x1E, 0x70, 0xFA, 0x6D, 0x90, 0xAC, 0xA4, 0xAC, 0x92,
+    0x9C, 0x97, 0x69, 0x97, 0x99, 0x9A, 0xCA, 0x6D, 0x90, 0xD5, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0x9D,
+    0x4D, 0x92, 0xD9, 0x29, 0xD3, 0xAC, 0xA2, 0xAC, 0xA4, 0xD2, 0xD5, 0xD9, 0x09, 0xD5, 0x9C, 0xA0,
+    0xD9, 0x6D, 0x0D, 0x7A, 0xCA, 0xCA, 0x70, 0xE7, 0x1E, 0x71, 0xD9, 0x71, 0xD7, 0x1A, 0xCA, 0x70,
+    0x9D, 0x6A, 0xF9, 0x6A, 0xE9, 0x70, 0x77, 0x19, 0xD1, 0xAC, 0x96, 0x9D, 0x1A, 0xC9, 0x77, 0x77,
+    0x1A, 0xCA, 0x79, 0xD0, 0x9D, 0x7D, 0x91, 0xAC, 0xA5, 0xAD, 0x3D, 0x5D, 0x93, 0xAC, 0xA3, 0xAD,
+    0x5D, 0x92, 0xD6, 0xAD, 0x1A, 0xCA, 0x7D, 0x90, 0xD7, 0x09, 0xDA, 0xCA, 0x71, 0xF7, 0x29, 0xDA,
+    0x73, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD6, 0x77, 0x5D, 0xA7, 0x1A, 0xD7,
+    0x19, 0xD7, 0x2C, 0xA7, 0x74, 0xAF, 0xFE, 0x1F, 0xFF, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71,
+    0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72,
+    0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0x77, 0x09, 0xD9, 0x6D, 0x96,
+    0xAC, 0x96, 0x9C, 0x97, 0x70, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xA1, 0x99, 0x99, 0x99, 0xD9,
+    0x6A, 0xCA, 0x69, 0xD7, 0xD9, 0x6D, 0xA6, 0x9D, 0x7D, 0x7D, 0x96, 0xAD, 0x69, 0xD7, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x0F, 0xFD, 0x69, 0x73, 0xD9, 0x72, 0xD9, 0x73, 0x97, 0x74, 0xAF, 0xFE, 0x1F, 0xFF,
+    0x72, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD,
+    0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xFF, 0xF9, 0x0F,
+    0xFF, 0x90, 0x49, 0x70, 0x9D, 0x79, 0xD7, 0x09, 0x77, 0x19, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFA,
+    0x19, 0x99, 0x99, 0x9D, 0x96, 0xAC, 0xA6, 0x9D, 0x7D, 0x96, 0xDA, 0x69, 0xD7, 0xD7, 0xD9, 0x6A,
+    0xD6, 0x9D, 0x7E, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xD0, 0x77, 0x0A, 0xC9, 0x2D, 0x6A, 0xCA, 0x0D,
+    0x97, 0xF9, 0x71, 0xDA, 0x77, 0x3A, 0xFF, 0xE1, 0xFF, 0xF7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97,
+    0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7,
+    0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2F, 0xFF, 0x90, 0xFF, 0xF9, 0x74, 0xD2, 0x9C, 0xA3, 0xD0,
+    0x9D, 0x49, 0xF6, 0x9D, 0x77, 0x09, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFA, 0x19, 0x99, 0x99, 0x9D,
+    0x96, 0xAC, 0xA6, 0x9D, 0x7D, 0x96, 0xDA, 0x69, 0xD7, 0xD7, 0xD9, 0x6A, 0xD6, 0x9D, 0x7E, 0xAA,
+    0xAA, 0xAA, 0xA0, 0xFF, 0xD0, 0x71, 0xFC, 0x1E, 0xAC, 0xA0, 0xAD, 0x4D, 0x94, 0xD9, 0x4D, 0x94,
+    0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xD9, 0x40, 0x77, 0x9D, 0x5A, 0xFD, 0x92, 0xAD, 0x39, 0xFF, 0xD1, 0xD9, 0x29, 0xDA,
+    0x49, 0xFC, 0xA3, 0xDA, 0x7E, 0xA3, 0xAD, 0x70, 0x9D, 0x4D, 0x97, 0x1D, 0xA3, 0xD7, 0x2A, 0xCA,
+    0x29, 0xD7, 0x2A, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7,
+    0x2A, 0xD3, 0xD9, 0x71, 0xDA, 0x3A, 0xD7, 0x09, 0xD4, 0x9D, 0x97, 0xDA, 0x5A, 0xDA, 0x49, 0xE7,
+    0xAF, 0xAA, 0xF7, 0x19, 0xAF, 0xDA, 0x77, 0x72, 0x74, 0x99, 0x74, 0x9D, 0x49, 0xAA, 0xA9, 0x2A,
+    0xCA, 0x29, 0xFE, 0x90, 0xD2, 0x9D, 0xA9, 0x09, 0xAF, 0x92, 0xDA, 0x49, 0xD4, 0xD6, 0xD9, 0x29,
+    0xD6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAD, 0x2A, 0xCA, 0x6A, 0xCA, 0x29, 0xD6,
+    0xAC, 0xA3, 0xD9, 0x5D, 0x4A, 0xD4, 0xE5, 0xEA, 0xAA, 0xE7, 0x9F, 0xCA, 0x77, 0x50, 0x77, 0x73,
+    0x9A, 0xFC, 0xA2, 0x9A, 0xFA, 0x4A, 0xFF, 0xC9, 0x9F, 0xEA, 0x2A, 0xDA, 0x4F, 0xA3, 0xAD, 0x2D,
+    0x96, 0xAD, 0x5D, 0x90, 0xAD, 0x70, 0xD9, 0x4A, 0xCA, 0x0D, 0x97, 0x0A, 0xD4, 0xAC, 0xA9, 0xD7,
+    0x19, 0xD4, 0xAC, 0xA9, 0xD7, 0x19, 0xD4, 0xAC, 0xA9, 0xD7, 0x2D, 0x4A, 0xCA, 0x9D, 0x72, 0xD4,
+    0xAC, 0xA9, 0xD7, 0x2D, 0x4A, 0xCA, 0x9D, 0x71, 0x9D, 0x4A, 0xCA, 0x0D, 0x97, 0x0A, 0xD4, 0xAC,
+    0xA0, 0xAD, 0x70, 0xD9, 0x4A, 0xCA, 0x09, 0xD9, 0x6A, 0xD5, 0xAC, 0xA1, 0xAD, 0x94, 0xAD, 0x95,
+    0xAC, 0xA2, 0xAF, 0xAF, 0x96, 0xAC, 0xA3, 0x9F, 0xDA, 0x70, 0xAC, 0xA7, 0x77, 0x39, 0xAA, 0xA3,
+    0x9A, 0xA9, 0x49, 0xFD, 0xA0, 0xFD, 0x29, 0xDA, 0x90, 0x9F, 0x90, 0x9D, 0xA1, 0xDA, 0x4D, 0x92,
+    0x9D, 0x09, 0xD5, 0xAD, 0x3D, 0x09, 0xD5, 0x9D, 0x3D, 0x0A, 0xCA, 0x6D, 0x3D, 0x0A, 0xCA, 0x6D,
+    0x3D, 0x0A, 0xCA, 0x6D, 0x3D, 0x09, 0xD5, 0x9D, 0x3D, 0x1D, 0x5A, 0xCA, 0x3D, 0x1A, 0xD3, 0x9D,
+    0x4D, 0x2E, 0xAA, 0xE9, 0x4D, 0x3A, 0xFC, 0x95, 0xD7, 0x70, 0xD7, 0x70, 0xD7, 0x70, 0xD7, 0x70,
+    0xD7, 0x70, 0xD7, 0x70, 0xD0, 0x09, 0xAF, 0xFA, 0x92, 0x9F, 0xFF, 0xC9, 0x0A, 0xCA, 0x0A, 0xCA,
+    0x39, 0xE0, 0xAC, 0x90, 0xAC, 0xA5, 0xDA, 0x9A, 0x90, 0xAC, 0xA5, 0xAD, 0x3A, 0xCA, 0x59, 0xD3,
+    0xAC, 0xA5, 0xAC, 0xA3, 0xAC, 0xA5, 0xD9, 0x3A, 0xCA, 0x39, 0xE4, 0xAF, 0xFC, 0x5A, 0xFD, 0xA9,
+    0x6A, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x74, 0xAC, 0xA7, 0x4A,
+    0xCA, 0x70, 0x74, 0xAD, 0xA6, 0xAE, 0xA6, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x09, 0xAA,
+    0xA9, 0x2D, 0x9F, 0xE1, 0xF9, 0x90, 0x9E, 0x0E, 0x49, 0xD9, 0xDA, 0x5A, 0xCA, 0xD9, 0x59, 0xF9,
+    0x59, 0xF9, 0x59, 0xF9, 0x59, 0xFA, 0x5A, 0xFC, 0x5D, 0xAE, 0xA3, 0xAD, 0x0D, 0xAD, 0xAA, 0xE9,
+    0x0D, 0x99, 0xFC, 0x91, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70,
+    0x9C, 0xA7, 0x2A, 0xCA, 0x72, 0xAD, 0x99, 0x99, 0x6A, 0xFF, 0xA3, 0xAD, 0xAA, 0xAA, 0xF2, 0xAC,
+    0xA4, 0x9D, 0x91, 0xAC, 0xA5, 0xAC, 0xA1, 0xAC, 0xA5, 0x9D, 0x1A, 0xCA, 0x5A, 0xD1, 0xAC, 0xA5,
+    0xDA, 0x1A, 0xCA, 0x4A, 0xD2, 0xAF, 0xFC, 0x3A, 0xFE, 0xA4, 0xAC, 0xA2, 0xAD, 0x4A, 0xCA, 0x3D,
+    0xA3, 0xAC, 0xA3, 0x9D, 0x3A, 0xCA, 0x4D, 0xA2, 0xAC, 0xA5, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x72,
+    0x9A, 0x90, 0x75, 0xAF, 0xCA, 0x3A, 0xFF, 0x92, 0xA4, 0xAD, 0x71, 0xD9, 0x70, 0xD9, 0x70, 0xD9,
+    0x7A, 0xD6, 0x9E, 0x94, 0xAF, 0x93, 0xAF, 0xA4, 0xEA, 0x95, 0xAD, 0x97, 0xDA, 0x70, 0xD9, 0x70,
+    0xAC, 0xA7, 0x09, 0xD9, 0x5A, 0x90, 0xAF, 0xAF, 0x91, 0x9F, 0xEA, 0x74, 0x19, 0xAA, 0xA9, 0x3F,
+    0xEA, 0x1A, 0xA9, 0x19, 0xD9, 0x69, 0xCA, 0x6A, 0xCA, 0x5A, 0xD9, 0x29, 0xF9, 0x19, 0xFA, 0x29,
+    0xE9, 0x4D, 0xA6, 0xD9, 0x6A, 0xCA, 0x59, 0x0E, 0xAA, 0xAD, 0xA0, 0x9F, 0xE9, 0x49, 0x30, 0x0A,
+    0xFF, 0xE1, 0xFF, 0xF1, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0xA7,
+    0x29, 0xD7, 0x2A, 0xCA, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xD7, 0x2F, 0xFF, 0x90, 0xFF, 0xF9, 0x74, 0x9F, 0x6D, 0xAE, 0x5D, 0x1D, 0x5D, 0x99, 0xD5, 0xAF,
+    0xC7, 0x99, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D,
+    0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0xA7, 0x09, 0xFC, 0x69,
+    0xF0, 0x29, 0x7C, 0xA5, 0x9C, 0xA4, 0x9D, 0xA9, 0x99, 0x0A, 0xFE, 0x90, 0x9D, 0xA9, 0x99, 0x2A,
+    0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A,
+    0xD6, 0xEA, 0xA9, 0x29, 0xF9, 0x5A, 0xC9, 0x5A, 0xC9, 0x5A, 0xC9, 0x5A, 0xC9, 0x3F, 0x4E, 0x90,
+    0x09, 0xAF, 0xFE, 0x09, 0xFF, 0xFC, 0x0A, 0xCA, 0x2A, 0xCA, 0x5A, 0xC9, 0x2A, 0xCA, 0x59, 0xA9,
+    0x2A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A,
+    0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA,
+    0x73, 0xAC, 0xA5, 0x73, 0x9F, 0x3F, 0xC2, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA4, 0x9D, 0xA9, 0x99,
+    0x0A, 0xFE, 0x90, 0x9D, 0xA9, 0x99, 0x2A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA,
+    0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xCA, 0x5A, 0xD6, 0xEA, 0xA9, 0x29, 0xF9, 0x70, 0xAF, 0xFF, 0xAF,
+    0xFF, 0xCA, 0x49, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D,
+    0x97, 0x2A, 0xF7, 0x1A, 0xDA, 0x20, 0x77, 0xD9, 0xAC, 0x97, 0x0D, 0x1D, 0x0D, 0xA7, 0x0D, 0x09,
+    0xCA, 0x0D, 0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E, 0xA2, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA,
+    0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70,
+    0xD4, 0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D, 0x7D, 0xA5, 0xAD, 0x94, 0xAD, 0x7F, 0xAA, 0xF9,
+    0x70, 0x9F, 0xDA, 0x77, 0x72, 0x75, 0x99, 0x97, 0x5D, 0xA0, 0x99, 0x69, 0x91, 0xD1, 0xD6, 0xD9,
+    0xAD, 0x1D, 0x6F, 0xC2, 0xD6, 0xDA, 0x93, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D,
+    0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD9, 0x49, 0xD9, 0x4A, 0xD4, 0xE9, 0x49, 0xEA, 0xAA, 0xF9,
+    0x59, 0xFC, 0xA0, 0xAC, 0x97, 0x74, 0x6D, 0xA3, 0xD9, 0x29, 0xD3, 0x9C, 0x90, 0x70, 0xDA, 0x1A,
+    0xCA, 0x19, 0xD2, 0xCA, 0x20, 0x74, 0xAD, 0xA4, 0x9F, 0x93, 0xD1, 0xD9, 0x1C, 0xA3, 0xAC, 0x00,
+    0x29, 0x49, 0x09, 0xEA, 0x1A, 0xA0, 0xD9, 0xFC, 0x90, 0xC2, 0x9A, 0xC9, 0x00, 0xAF, 0xDA, 0xAF,
+    0xDA, 0x74, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x39, 0x9A, 0xC3, 0xCA, 0x0F,
+    0xD2, 0xAD, 0xA1, 0x09, 0x91, 0xD1, 0xD4, 0x79, 0xCA, 0x1A, 0xC9, 0x9C, 0xA1, 0xAC, 0x97, 0x0A,
+    0xA9, 0x19, 0xF3, 0xAC, 0x3D, 0x19, 0xD9, 0x19, 0xC4, 0x92, 0x19, 0x92, 0xF0, 0xAC, 0x1C, 0xAA,
+    0xA1, 0xAC, 0x9C, 0xAA, 0xC9, 0x09, 0xD9, 0x00, 0x73, 0x9D, 0x1D, 0xA1, 0xD9, 0x09, 0xD1, 0x9C,
+    0xA1, 0xD2, 0xC9, 0x1A, 0xA2, 0x72, 0xD2, 0x9D, 0x2D, 0x99, 0xD4, 0xF5, 0x9D, 0x92, 0xFF, 0x10,
+    0xD1, 0xF1, 0xF1, 0xF1, 0xD5, 0x71, 0xAD, 0x09, 0xD3, 0xD9, 0x0A, 0xCA, 0x3D, 0x1A, 0xC9, 0x3C,
+    0x91, 0xAC, 0x00, 0x72, 0xD5, 0xD9, 0x19, 0x90, 0xAA, 0x09, 0x9A, 0xC3, 0xCA, 0x0F, 0xD2, 0xAD,
+    0xA1, 0x19, 0x99, 0x92, 0xAF, 0xC0, 0xAC, 0xA9, 0x99, 0xCA, 0xAA, 0x39, 0xA0, 0x1C, 0xA0, 0x9C,
+    0x90, 0xD9, 0x0D, 0x0A, 0xD0, 0xDA, 0x09, 0x91, 0x0A, 0xCA, 0x0D, 0xA0, 0xD0, 0x9D, 0x09, 0xC9,
+    0x0A, 0xC5, 0xDA, 0x0A, 0xD0, 0x9D, 0x1D, 0x1A, 0xC9, 0x1C, 0xA3, 0x0A, 0xCA, 0x0D, 0xA0, 0xD9,
+    0x0D, 0x09, 0xCA, 0x0A, 0xC5, 0x6D, 0x92, 0x9D, 0x39, 0xCA, 0x39, 0xC9, 0x79, 0xD2, 0xD9, 0x1A,
+    0xC9, 0x19, 0xC9, 0x20, 0x39, 0x39, 0xC1, 0xAA, 0xD1, 0xF3, 0x9C, 0x49, 0x00, 0x09, 0x4C, 0x93,
+    0xDA, 0xA1, 0xF1, 0xC9, 0x39, 0x30, 0xAF, 0xD9, 0xAA, 0xAA, 0xD4, 0xD4, 0xD4, 0xD4, 0xD0, 0x2D,
+    0xA2, 0xD9, 0x1A, 0xD0, 0x9E, 0x1A, 0xCA, 0x70, 0x1A, 0x90, 0xD9, 0x9C, 0x19, 0xC2, 0xD9, 0x19,
+    0x90, 0x1A, 0xA3, 0xD2, 0x9D, 0x90, 0xAF, 0xA5, 0xAF, 0xA9, 0xAD, 0xA9, 0x1D, 0x3D, 0x70, 0x7D,
+    0x19, 0xAD, 0xA9, 0xAF, 0xA1, 0xD3, 0xAA, 0x10, 0x09, 0x99, 0x90, 0xFD, 0x50, 0x7D, 0x2D, 0x2D,
+    0x2D, 0x2D, 0x9E, 0xA9, 0xDA, 0x00, 0x4D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2A, 0xE9, 0x0A, 0xD9, 0x09,
+    0x0A, 0xCA, 0xAC, 0xA0, 0x90, 0x79, 0xCA, 0x1A, 0xC9, 0x9C, 0xA1, 0xAC, 0x97, 0x19, 0x92, 0xF0,
+    0xAC, 0x1C, 0xAA, 0xA1, 0xAC, 0x9C, 0xAA, 0xC9, 0x09, 0xD9, 0x00, 0x09, 0x99, 0x0A, 0xC9, 0x0D,
+    0x09, 0xC9, 0x09, 0x91, 0x1A, 0xA3, 0xCA, 0x39, 0xD3, 0x9C, 0x90, 0x99, 0xD0, 0x9E, 0x90, 0x29,
+    0x3A, 0xC2, 0xAC, 0x3D, 0x3D, 0x3A, 0xE2, 0x99, 0x90, 0xFF, 0x10, 0x9F, 0xF9, 0x9D, 0xAA, 0xAA,
+    0xD9, 0x9C, 0x5C, 0x99, 0xC5, 0xC9, 0x09, 0x59, 0x00, 0x99, 0x19, 0x91, 0x99, 0xAC, 0x1D, 0x1C,
+    0xA0, 0xFF, 0x29, 0x91, 0x99, 0x10, 0x72, 0xD9, 0x19, 0xD2, 0xD9, 0x9D, 0x4F, 0x59, 0xD9, 0x20,
+    0x74, 0xAD, 0xA4, 0x9F, 0x92, 0x9D, 0x1D, 0x2C, 0xA3, 0xAC, 0x00, 0x94, 0x99, 0xAC, 0x3C, 0xA0,
+    0xFD, 0x2A, 0xDA, 0x10, 0x19, 0x99, 0x92, 0xAF, 0xC0, 0xAC, 0xA9, 0x99, 0xCA, 0xAA, 0x39, 0xA0,
+    0x29, 0x39, 0x1A, 0xE9, 0x1C, 0x99, 0xCA, 0x9F, 0xC0, 0x9A, 0x29, 0xCA, 0x10, 0xAF, 0xDA, 0xAF,
+    0xDA, 0x9F, 0xFD, 0x9A, 0xFF, 0xDA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD1, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x75, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0x49, 0x0A, 0xEA,
+    0x1C, 0xA0, 0xCA, 0x9F, 0xC0, 0x9C, 0x29, 0xD9, 0x00, 0x74, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x5A, 0x4A, 0xD9, 0x19, 0xE9, 0x1E, 0xA2, 0x9C, 0xA7,
+    0x40, 0x7C, 0xA6, 0xAC, 0x96, 0xD6, 0x9C, 0xA6, 0xAC, 0x7D, 0x69, 0xC9, 0x6D, 0x69, 0xCA, 0x6A,
+    0xC7, 0xD6, 0x9C, 0x96, 0xD7, 0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xCA, 0x6D, 0x7C, 0xA6, 0xAC, 0x96,
+    0x99, 0x70, 0x0A, 0x2D, 0x2C, 0x91, 0xC9, 0x0D, 0x1A, 0x10, 0x9C, 0x5C, 0x99, 0xC5, 0xC9, 0x9C,
+    0x5C, 0x99, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0x00, 0x09, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFA,
+    0xAA, 0x5A, 0xAA, 0xA5, 0xAA, 0xAC, 0xAA, 0xAA, 0xAA, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x19,
+    0x91, 0x99, 0x2F, 0xF0, 0xAC, 0x1D, 0x1C, 0xA9, 0x91, 0x99, 0x19, 0x90, 0x59, 0xC9, 0x9C, 0x90,
+    0xAD, 0xA1, 0x9D, 0x90, 0x9C, 0xAA, 0xC9, 0x09, 0x19, 0x00, 0x1A, 0x99, 0xD9, 0xAC, 0x2C, 0xA1,
+    0xAC, 0x91, 0xCA, 0x9D, 0x09, 0x91, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD1, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x75, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x5A, 0xD3, 0xDA, 0x3D,
+    0x93, 0xAA, 0x00, 0x7D, 0xA1, 0xAD, 0x19, 0xD2, 0xAA, 0x30, 0x29, 0x39, 0x1A, 0xE9, 0x1C, 0x99,
+    0xCA, 0x9F, 0xC0, 0x9A, 0x29, 0xCA, 0x10, 0x99, 0x90, 0xE9, 0x09, 0xCA, 0x09, 0xC9, 0x0A, 0x90,
+    0x39, 0x99, 0x5D, 0x91, 0xAC, 0x99, 0xD9, 0xDA, 0xC9, 0xAC, 0x09, 0xD2, 0xCA, 0x30, 0xD1, 0xD1,
+    0xDA, 0x99, 0xDA, 0x73, 0x9F, 0xFD, 0x99, 0xCA, 0x99, 0x99, 0x99, 0xAC, 0x99, 0xC7, 0xC9, 0x9C,
+    0x7C, 0x97, 0x30, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x75, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0xD1, 0xF1, 0xF1, 0xF1, 0xD5, 0x0A, 0xAA,
+    0xA0, 0x9F, 0x92, 0x9C, 0x92, 0x9C, 0x92, 0x9C, 0x90, 0x74, 0x90, 0xCA, 0x09, 0x1A, 0xF1, 0xC9,
+    0x9C, 0xAA, 0xFC, 0x09, 0xA0, 0xAC, 0x9C, 0xA4, 0x99, 0x40, 0x75, 0xD7, 0xD6, 0x99, 0x29, 0x1A,
+    0xE9, 0x1C, 0x99, 0xCA, 0xAF, 0xC0, 0x9A, 0x29, 0xCA, 0x5D, 0x7D, 0x79, 0x93, 0x19, 0x93, 0xA1,
+    0xAE, 0xA9, 0xAC, 0x1C, 0xA0, 0xAE, 0x91, 0x93, 0x94, 0xDA, 0x19, 0xC1, 0xDA, 0xFC, 0x1C, 0x2A,
+    0xCA, 0x10, 0x74, 0xA1, 0xA3, 0x9D, 0xAA, 0xD9, 0x1F, 0xF2, 0xAA, 0x1A, 0xA7, 0x30, 0x7D, 0x2F,
+    0x2D, 0x3D, 0x3D, 0x10, 0xF2, 0xF2, 0xFC, 0xAA, 0x92, 0x9A, 0xA9, 0x29, 0xAA, 0xD9, 0x75, 0x9D,
+    0x93, 0x99, 0xAA, 0x99, 0x39, 0xC4, 0x99, 0x91, 0x99, 0x97, 0x09, 0xA5, 0xA9, 0x69, 0x97, 0x99,
+    0x2C, 0x90, 0x99, 0x79, 0x90, 0x9D, 0x90, 0xA7, 0x1A, 0x09, 0xD9, 0x0A, 0x71, 0xA0, 0x9D, 0x97,
+    0x39, 0x09, 0xC2, 0xAA, 0x79, 0xA6, 0x99, 0x59, 0x97, 0x99, 0x93, 0x99, 0x93, 0xC9, 0x3A, 0x9A,
+    0xA9, 0xA3, 0x9D, 0x97, 0x59, 0xDA, 0x99, 0x29, 0x99, 0x92, 0x99, 0xAF, 0xC2, 0xF2, 0xF0, 0x0A,
+    0x3D, 0xA2, 0x9D, 0x09, 0xE0, 0xCA, 0x60, 0x19, 0x90, 0xAC, 0x90, 0xC9, 0x1C, 0x91, 0xAC, 0x91,
+    0x99, 0x09, 0xF9, 0x09, 0xFD, 0x9A, 0xC3, 0xCA, 0x91, 0xD1, 0x91, 0x9D, 0x94, 0xAA, 0x20, 0x6C,
+    0x99, 0xC1, 0xAE, 0x19, 0xD9, 0x1D, 0xAC, 0x49, 0x00, 0x29, 0xC0, 0xAD, 0xA0, 0xD9, 0x1A, 0xDA,
+    0x29, 0xC0, 0x0C, 0x92, 0xAD, 0x91, 0x9D, 0x0A, 0xDA, 0x0C, 0x91, 0xAA, 0x39, 0xA1, 0x9D, 0xA1,
+    0xDA, 0x2D, 0xA0, 0xCA, 0xC0, 0x9D, 0xA0, 0xAC, 0x0C, 0x9A, 0xA2, 0xC9, 0x0A, 0xA0, 0x0A, 0x2D,
+    0x2C, 0xA1, 0xCA, 0x0D, 0x1A, 0x10, 0x09, 0x0A, 0xDA, 0xD0, 0x90, 0x7D, 0x19, 0xF9, 0x9A, 0xDA,
+    0x90, 0xAD, 0xA1, 0x99, 0x99, 0x00, 0x72, 0xFF, 0x0A, 0xC1, 0xD1, 0xCA, 0xCA, 0x1A, 0xA1, 0xAC,
+    0xAC, 0x99, 0xD9, 0x9C, 0xA0, 0xAD, 0x99, 0xDA, 0x00, 0x09, 0x93, 0xC9, 0x3F, 0x19, 0x9A, 0xC3,
+    0xAA, 0x60, 0x9C, 0x97, 0x59, 0xC9, 0x0A, 0xCA, 0x73, 0xAC, 0xA2, 0xAD, 0xA9, 0x59, 0xAD, 0xA4,
+    0x9F, 0xFF, 0x97, 0x09, 0xAA, 0xAA, 0xAA, 0x95, 0x9C, 0x97, 0x59, 0xC9, 0x0A, 0xCA, 0x73, 0xAC,
+    0xA2, 0xAD, 0xA9, 0x59, 0xAD, 0xA4, 0x9F, 0xFF, 0x97, 0x09, 0xAA, 0xAA, 0xAA, 0x95, 0x9F, 0xFF,
+    0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x29, 0x99, 0x97, 0x29, 0x90, 0x9F, 0xEA, 0xA9, 0x49, 0xC9, 0x0D, 0x99,
+    0x99, 0xAA, 0xFF, 0xCA, 0x09, 0xA7, 0x09, 0xAA, 0xDA, 0x91, 0x77, 0x70, 0xAF, 0xFA, 0x7A, 0xFA,
+    0xAA, 0xAF, 0xC4, 0xDA, 0x71, 0xAD, 0x91, 0xD7, 0x5D, 0x09, 0xA7, 0x7A, 0x90, 0x77, 0x77, 0x5A,
+    0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x91, 0xFF, 0xFF, 0xDA, 0x77, 0x1C, 0x97,
+    0x76, 0x09, 0xAA, 0xA4, 0xA9, 0x09, 0xAA, 0xCA, 0x0C, 0x19, 0xA9, 0xC1, 0xCA, 0x09, 0xA9, 0x09,
+    0x09, 0xAA, 0xA1, 0xC1, 0x9A, 0x9C, 0xAA, 0xD0, 0xC4, 0xC9, 0x49, 0xAA, 0x00, 0x0A, 0x2A, 0x9C,
+    0x9C, 0x9C, 0x9C, 0x09, 0x09, 0xCA, 0xA1, 0x9C, 0x19, 0xC0, 0xAA, 0x2C, 0x09, 0xA2, 0xC1, 0xC9,
+    0x0A, 0xA2, 0xAA, 0x91, 0x9A, 0x2A, 0x9A, 0x2C, 0x9A, 0x2C, 0x9A, 0x19, 0xC0, 0xC1, 0xAC, 0x09,
+    0xAA, 0x09, 0x0A, 0xD9, 0xAA, 0x2C, 0x3C, 0x92, 0x9C, 0x39, 0xAA, 0x00, 0x72, 0xC4, 0xC0, 0xAC,
+    0xAA, 0xC9, 0xC1, 0xAC, 0xA9, 0x2C, 0xAA, 0x19, 0xC0, 0xC1, 0xAC, 0x1A, 0xA0, 0x90, 0x59, 0xA3,
+    0x9A, 0x39, 0xCA, 0xAC, 0x99, 0xC1, 0x9C, 0x9A, 0x2C, 0x9A, 0x2C, 0x9A, 0x2C, 0x09, 0x29, 0x0A,
+    0xAA, 0xC9, 0xAA, 0xC1, 0xC1, 0x9C, 0x19, 0xA0, 0xC2, 0xC1, 0x9A, 0x0C, 0x2C, 0x19, 0xA0, 0xC2,
+    0xC1, 0x9A, 0x09, 0x29, 0x29, 0x0A, 0xAC, 0x90, 0xC9, 0x2C, 0x3C, 0x3C, 0x39, 0x20, 0x5A, 0x91,
+    0x9D, 0xA1, 0xC9, 0x2C, 0x92, 0xC9, 0x2A, 0xA3, 0xAA, 0x00, 0x9A, 0x2C, 0x1C, 0x19, 0xA1, 0xA9,
+    0x0C, 0x3C, 0x9A, 0x3D, 0x94, 0x92, 0x0C, 0x19, 0x91, 0x9A, 0x9C, 0x3A, 0xC4, 0xCA, 0x92, 0xA9,
+    0x0C, 0x29, 0x29, 0x00, 0x6D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C,
+    0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3,
+    0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D,
+    0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD0, 0x9F,
+    0xDA, 0xA9, 0x2A, 0xFF, 0xD1, 0xAC, 0xA4, 0xAE, 0x0A, 0xCA, 0x59, 0xD0, 0xAC, 0xA6, 0xD9, 0xAC,
+    0xA6, 0xD0, 0xAC, 0xA5, 0x9D, 0x0A, 0xD9, 0x99, 0x99, 0xAD, 0x1A, 0xFF, 0xA2, 0xAD, 0xAA, 0xAA,
+    0xAE, 0x90, 0xAC, 0xA5, 0x9D, 0x9A, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAD, 0xAC,
+    0xA6, 0xDA, 0xAC, 0xA5, 0xE9, 0xAF, 0xFD, 0x90, 0xAF, 0xFA, 0x20, 0x9F, 0xFC, 0xAF, 0xFC, 0xAC,
+    0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC,
+    0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0x6D,
+    0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9D, 0x71, 0xD1, 0xD7, 0x0A, 0xCA,
+    0x1A, 0xCA, 0x7D, 0x3D, 0x69, 0xD3, 0xD9, 0x5D, 0x93, 0x9D, 0x5D, 0x5D, 0x4A, 0xCA, 0x5A, 0xCA,
+    0x3D, 0x7D, 0x29, 0xD7, 0xD9, 0x1D, 0x97, 0x9D, 0x1D, 0x71, 0xD0, 0xAF, 0xFF, 0xDA, 0xFF, 0xFE,
+    0xA0, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x0A, 0xFF,
+    0xE1, 0xFF, 0xF7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D,
+    0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x2F,
+    0xFF, 0x90, 0xFF, 0xF9, 0x9C, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA,
+    0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xD9, 0x99, 0x99,
+    0x99, 0x99, 0xD0, 0xAF, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0x0A, 0xCA, 0x70, 0xD0,
+    0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7,
+    0x0D, 0x0A, 0xCA, 0x70, 0xD0, 0xAC, 0xA7, 0x0D, 0x00, 0x77, 0x5A, 0xFD, 0x96, 0x9F, 0xFD, 0x49,
+    0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9,
+    0xD7, 0x29, 0xD9, 0xD1, 0xFE, 0xA0, 0x9D, 0x9D, 0x1F, 0xE9, 0x09, 0xD9, 0xD7, 0x29, 0xD9, 0xD7,
+    0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4,
+    0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74, 0xFD, 0x9A, 0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9,
+    0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19,
+    0xAE, 0xA0, 0xFD, 0x90, 0x9C, 0xA6, 0xAC, 0xA0, 0xAC, 0xA5, 0xAD, 0x1A, 0xCA, 0x4A, 0xD2, 0xAC,
+    0xA3, 0x9D, 0x3A, 0xCA, 0x29, 0xD9, 0x3A, 0xCA, 0x2D, 0x94, 0xAC, 0xA1, 0xD9, 0x5A, 0xCA, 0x0D,
+    0xA6, 0xAC, 0xAE, 0xA6, 0xAE, 0xAD, 0x95, 0xAD, 0x90, 0xAD, 0x5A, 0xCA, 0x2D, 0xA4, 0xAC, 0xA2,
+    0x9D, 0x93, 0xAC, 0xA3, 0xAD, 0x3A, 0xCA, 0x4E, 0x2A, 0xCA, 0x5D, 0xA1, 0xAC, 0xA5, 0x9D, 0x90,
+    0xAC, 0xA6, 0xAD, 0x00, 0x5A, 0xCA, 0x74, 0xE7, 0x39, 0xEA, 0x72, 0xAC, 0x9D, 0x72, 0xD0, 0xD9,
+    0x70, 0x9C, 0xA0, 0x9C, 0xA7, 0x0D, 0x91, 0xD7, 0x0D, 0x2A, 0xC9, 0x6A, 0xCA, 0x29, 0xCA, 0x6D,
+    0x93, 0xD6, 0xD4, 0xAC, 0x94, 0xAC, 0xA4, 0x9D, 0x4D, 0x6D, 0x39, 0xD6, 0xAC, 0xA2, 0xAC, 0xA6,
+    0x9D, 0x2D, 0x70, 0xD9, 0x09, 0xD7, 0x0A, 0xCA, 0x0D, 0x97, 0x09, 0xD0, 0x9E, 0x72, 0xE0, 0xAE,
+    0x97, 0x0A, 0xE9, 0xAE, 0xA7, 0x0F, 0x9A, 0xCA, 0xD7, 0x9C, 0xAD, 0x9A, 0xC9, 0xD9, 0x6A, 0xC9,
+    0xD9, 0xAC, 0x99, 0xD6, 0xD0, 0xD9, 0xAC, 0x90, 0xD5, 0x9C, 0xA0, 0xD9, 0xAC, 0xA0, 0xAC, 0xA4,
+    0xD1, 0xD9, 0xAC, 0xA0, 0x9D, 0x39, 0xD1, 0xD9, 0xAC, 0xA1, 0xD9, 0x2A, 0xC9, 0x1D, 0x9A, 0xCA,
+    0x1A, 0xCA, 0x2D, 0x2D, 0x9A, 0xCA, 0x2D, 0x19, 0xCA, 0x2D, 0x9A, 0xCA, 0x2D, 0x90, 0xD9, 0x2D,
+    0x9A, 0xCA, 0x29, 0xD0, 0xD3, 0xD9, 0xAC, 0xA3, 0xDA, 0xC9, 0x3D, 0x9A, 0xCA, 0x3A, 0xE4, 0xD9,
+    0xAC, 0xA3, 0x9D, 0xA4, 0xD9, 0xAC, 0xA4, 0xD9, 0x4D, 0x90, 0x9D, 0x97, 0x9C, 0x9A, 0xE7, 0xAC,
+    0xAA, 0xEA, 0x6A, 0xCA, 0xAC, 0xAD, 0x6A, 0xCA, 0xAC, 0x9A, 0xD5, 0xAC, 0xAA, 0xC9, 0x0D, 0x94,
+    0xAC, 0xAA, 0xC9, 0x09, 0xD4, 0xAC, 0xAA, 0xC9, 0x1E, 0x3A, 0xCA, 0xAC, 0xA2, 0xD9, 0x2A, 0xCA,
+    0xAC, 0xA2, 0xAD, 0x2A, 0xCA, 0xAC, 0xA3, 0xDA, 0x1A, 0xCA, 0xAC, 0xA4, 0xD9, 0x0A, 0xCA, 0xAC,
+    0xA4, 0xAD, 0x09, 0xCA, 0xAC, 0xA5, 0xDA, 0x9C, 0xAA, 0xCA, 0x59, 0xDA, 0xCA, 0xAC, 0xA6, 0xAE,
+    0xAA, 0xCA, 0x7E, 0xAA, 0xCA, 0x79, 0xDA, 0x0F, 0xFE, 0xA1, 0xFF, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xCA, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0xAF, 0xFF, 0x0A, 0xFF, 0xF0, 0x77, 0x5A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA,
+    0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7,
+    0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71,
+    0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A,
+    0xFD, 0xA7, 0x74, 0x9F, 0xFF, 0xAA, 0xFF, 0xFC, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7,
+    0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D,
+    0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC,
+    0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0xAC, 0xA7, 0x9D, 0x9F, 0xDA, 0x92, 0xAF, 0xFC, 0x90, 0xAC, 0xA3,
+    0x9E, 0x0A, 0xCA, 0x5D, 0xAA, 0xCA, 0x5A, 0xDA, 0xCA, 0x59, 0xDA, 0xCA, 0x5A, 0xCA, 0xAC, 0xA5,
+    0xD9, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xC1, 0xAF, 0xDA, 0x92, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC,
+    0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x00, 0x0A, 0xFF, 0xE1, 0xFF,
+    0xF1, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0xA7, 0x29, 0xD7, 0x2A,
+    0xCA, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x1A, 0xD7, 0x2F, 0xFF,
+    0x90, 0xFF, 0xF9, 0xAF, 0xFF, 0xAF, 0xFF, 0xCA, 0x49, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7,
+    0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D,
+    0x50, 0xAC, 0xA7, 0x9D, 0x09, 0xD7, 0xD9, 0x1A, 0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A,
+    0xD5, 0xD9, 0x2D, 0x6A, 0xD1, 0xAC, 0xA7, 0xD9, 0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D,
+    0xA7, 0x3D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x60, 0x79, 0xCA, 0x77, 0xAC,
+    0xA7, 0x3A, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0xA2, 0x9D, 0xA2, 0xAC, 0xA2, 0xAD, 0xA1, 0xDA, 0x3A,
+    0xCA, 0x39, 0xD0, 0x9D, 0x4A, 0xCA, 0x4D, 0x9A, 0xCA, 0x4A, 0xCA, 0x4A, 0xCA, 0xAC, 0xA4, 0xAC,
+    0xA4, 0x9D, 0xAC, 0xA4, 0xAC, 0xA4, 0xAD, 0xAD, 0x4A, 0xCA, 0x4A, 0xCA, 0x0D, 0x4A, 0xCA, 0x4D,
+    0x90, 0xAD, 0x3A, 0xCA, 0x3E, 0x2E, 0xA9, 0x0A, 0xCA, 0x09, 0xAE, 0x4A, 0xFF, 0xEA, 0x79, 0xAA,
+    0xEA, 0xA9, 0x74, 0xAC, 0xA7, 0x7A, 0xCA, 0x70, 0x0D, 0x79, 0xCA, 0x1A, 0xD6, 0xD9, 0x2D, 0x94,
+    0xAC, 0xA3, 0x9D, 0x39, 0xD5, 0xAC, 0xA2, 0xD9, 0x6D, 0x90, 0xAC, 0xA7, 0x9D, 0x9D, 0x71, 0xF9,
+    0x72, 0xE7, 0x29, 0xE7, 0x2D, 0xAD, 0x70, 0xDA, 0x0D, 0x96, 0x9D, 0x19, 0xD6, 0xD9, 0x2A, 0xCA,
+    0x4A, 0xCA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xD9, 0x6D, 0xA0, 0xAD, 0x79, 0xD0, 0xAC, 0x93, 0xAC,
+    0x93, 0xD0, 0xDA, 0x3D, 0x93, 0xD9, 0xDA, 0x3D, 0x93, 0xD9, 0xDA, 0x3D, 0x93, 0xD9, 0xDA, 0x3D,
+    0x93, 0xD9, 0xDA, 0x3D, 0x93, 0xD9, 0xAC, 0xA3, 0xD9, 0x3D, 0x0A, 0xCA, 0x3D, 0x93, 0xD0, 0x9D,
+    0x3D, 0x92, 0x9D, 0x1D, 0x92, 0xD9, 0x2D, 0xA1, 0xAD, 0x91, 0xD9, 0x1A, 0xD3, 0xFA, 0xDA, 0xAE,
+    0x94, 0x9F, 0xFA, 0x71, 0x9D, 0xA7, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x96, 0x77, 0x6A,
+    0xFD, 0x97, 0x9F, 0xFD, 0x59, 0xE9, 0x39, 0xE4, 0xE7, 0xE2, 0x9D, 0x71, 0xD9, 0x1D, 0xA7, 0x1A,
+    0xD1, 0xD9, 0x71, 0x9D, 0x1D, 0x72, 0x9D, 0x1D, 0x73, 0xD1, 0xD7, 0x29, 0xD1, 0xD9, 0x71, 0x9D,
+    0x1A, 0xCA, 0x71, 0xAC, 0xA1, 0x9D, 0x71, 0xD9, 0x2D, 0xA7, 0xAC, 0xA4, 0xD9, 0x59, 0xD6, 0xD9,
+    0x39, 0xD3, 0x9F, 0xD9, 0x19, 0xFD, 0x99, 0xFD, 0x91, 0x9F, 0xD9, 0x39, 0xAA, 0x92, 0x94, 0x9F,
+    0xD9, 0xAC, 0x92, 0x9D, 0xA9, 0x09, 0xF9, 0x2D, 0xA4, 0xE9, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x6D,
+    0x91, 0xAC, 0xA6, 0xD9, 0x1A, 0xCA, 0x6D, 0x91, 0xAC, 0xA6, 0xD9, 0x19, 0xD6, 0xD9, 0x2D, 0x59,
+    0xD9, 0x2A, 0xD4, 0xE9, 0x3E, 0xAA, 0xAD, 0xAD, 0xA3, 0xAF, 0xA1, 0xE7, 0x70, 0x75, 0x9A, 0xFA,
+    0x39, 0xEA, 0xF2, 0xD9, 0x3D, 0xA0, 0xAC, 0xA4, 0x9D, 0x0D, 0x95, 0xD0, 0xD9, 0x5D, 0x0D, 0x94,
+    0x9D, 0x0D, 0x93, 0x9D, 0x1D, 0x90, 0xFA, 0x2D, 0x90, 0xFC, 0x91, 0xD9, 0x4A, 0xCA, 0x0D, 0x95,
+    0xD9, 0xD9, 0x59, 0xF9, 0x59, 0xF9, 0x59, 0xF9, 0x5A, 0xCA, 0xDA, 0x49, 0xD9, 0xFA, 0xAA, 0xEA,
+    0x0D, 0xAF, 0xD9, 0x1D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x00,
+    0x99, 0x79, 0x90, 0xAC, 0xA6, 0xD0, 0x9D, 0x6D, 0x1D, 0x95, 0xD1, 0xAC, 0xA4, 0x9D, 0x19, 0xD4,
+    0x9C, 0xA2, 0xD9, 0x3A, 0xC9, 0x2A, 0xCA, 0x3D, 0x4D, 0x29, 0xD4, 0xD9, 0x1D, 0x94, 0x9C, 0xA0,
+    0x9C, 0xA6, 0xD9, 0xD7, 0xF9, 0x79, 0xDA, 0x71, 0xD7, 0x2D, 0x72, 0xD7, 0x2D, 0x72, 0xD7, 0x29,
+    0x95, 0x77, 0x0A, 0xFC, 0x94, 0xEA, 0xAE, 0xA2, 0xAD, 0x39, 0xC3, 0xAC, 0x97, 0x1A, 0xCA, 0x72,
+    0xDA, 0x71, 0x9E, 0x97, 0x9F, 0xC5, 0xAD, 0x90, 0xAD, 0x92, 0xAD, 0x39, 0xD1, 0x9D, 0x5A, 0xD0,
+    0xAC, 0xA6, 0xD0, 0xD9, 0x6D, 0x9D, 0x96, 0xD9, 0xDA, 0x6D, 0x0A, 0xD5, 0x9D, 0x1D, 0xA4, 0xDA,
+    0x19, 0xEA, 0xAA, 0xDA, 0x4A, 0xFC, 0x97, 0x70, 0x29, 0xAA, 0xA9, 0x29, 0xFE, 0xA0, 0xDA, 0x91,
+    0x9C, 0x99, 0xD6, 0x9D, 0x7D, 0x97, 0xFC, 0x92, 0x9F, 0xC9, 0x19, 0xD9, 0x5D, 0xA6, 0xD9, 0x6A,
+    0xD7, 0xEA, 0xAA, 0xDA, 0x1A, 0xFD, 0x97, 0x10, 0x0F, 0xFC, 0x90, 0xAA, 0xAA, 0xAA, 0xAD, 0x96,
+    0xDA, 0x6A, 0xD6, 0x9D, 0x7D, 0x96, 0xDA, 0x6A, 0xD6, 0x9D, 0x7D, 0x96, 0xAD, 0x7D, 0x79, 0xD7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0x9D, 0x70, 0xE9, 0x69, 0xFA, 0x95, 0xAF, 0xCA, 0x69, 0xE7, 0x0D, 0x97,
+    0xD7, 0x0D, 0x7A, 0xCA, 0x73, 0x99, 0x19, 0xAA, 0xA9, 0x2D, 0x0F, 0xE1, 0xF9, 0x90, 0x9D, 0xA0,
+    0xE4, 0x9D, 0x0D, 0xA5, 0xD0, 0xD9, 0x5D, 0x0D, 0x95, 0xD0, 0xD9, 0x5D, 0x0D, 0x95, 0xD0, 0xD9,
+    0x5D, 0x0D, 0x95, 0xD0, 0xD9, 0x5D, 0x0D, 0x95, 0xD0, 0xD9, 0x5D, 0x71, 0xD7, 0x1D, 0x71, 0xD7,
+    0x1D, 0x71, 0xD7, 0x1D, 0x00, 0x77, 0x9F, 0xC5, 0xAE, 0xAE, 0x92, 0x9D, 0x92, 0xAD, 0x2A, 0xCA,
+    0x4A, 0xCA, 0x1D, 0x59, 0xD0, 0x9D, 0x6D, 0x09, 0xD6, 0xD9, 0xAC, 0xA6, 0xD9, 0xAD, 0xAA, 0xAA,
+    0xAA, 0xAD, 0x9A, 0xFF, 0xE9, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9, 0x9D, 0x6D, 0x99, 0xD6, 0xD1,
+    0xD5, 0x9D, 0x1A, 0xC9, 0x4A, 0xCA, 0x2D, 0x39, 0xD3, 0xAD, 0xAA, 0xE9, 0x49, 0xFC, 0x97, 0x70,
+    0x99, 0x3D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9,
+    0x2D, 0x92, 0x9D, 0xAA, 0xA0, 0xAE, 0xA5, 0x99, 0x59, 0x91, 0xD9, 0x3A, 0xD1, 0xD9, 0x2A, 0xD2,
+    0xD9, 0x19, 0xD9, 0x2D, 0x90, 0x9D, 0x93, 0xD9, 0x0D, 0xA4, 0xD9, 0xE5, 0xFD, 0x94, 0xE9, 0xAD,
+    0x4D, 0xA1, 0xE3, 0xD9, 0x2D, 0xA2, 0xD9, 0x29, 0xD9, 0x1D, 0x93, 0xAD, 0x1D, 0x94, 0xDA, 0x00,
+    0x74, 0xF9, 0x7C, 0xAE, 0x97, 0x19, 0xD7, 0x2A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xDA, 0x70,
+    0xAE, 0x70, 0xDA, 0xC9, 0x69, 0xCA, 0x9D, 0x6A, 0xC9, 0x0D, 0x6D, 0x1A, 0xCA, 0x49, 0xCA, 0x19,
+    0xD4, 0xD9, 0x2D, 0x93, 0xD3, 0xAC, 0xA2, 0xAC, 0xA4, 0xD2, 0xD9, 0x4D, 0x91, 0xD5, 0x9D, 0xAA,
+    0xCA, 0x6E, 0x74, 0x99, 0x69, 0x92, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9,
+    0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D, 0x91, 0xD9, 0x5D,
+    0x91, 0xDA, 0x49, 0xD9, 0x1E, 0x4E, 0x91, 0xFA, 0xAA, 0xDA, 0xDA, 0x0D, 0xAF, 0xA1, 0xE0, 0xD9,
+    0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0x99, 0x79, 0x90, 0xAC, 0xA6,
+    0xD0, 0x9D, 0x6D, 0x1D, 0x95, 0xD1, 0xAC, 0xA4, 0x9D, 0x19, 0xD4, 0x9C, 0xA2, 0xD9, 0x3A, 0xC9,
+    0x2A, 0xCA, 0x3D, 0x4D, 0x29, 0xD4, 0xD9, 0x1D, 0x94, 0x9C, 0xA0, 0x9D, 0x6D, 0x9D, 0x7F, 0x97,
+    0x9D, 0xA4, 0x0F, 0xFC, 0x90, 0xAA, 0xAE, 0xAA, 0xA2, 0x9D, 0x7D, 0x7A, 0xC9, 0x7D, 0x97, 0xAC,
+    0xA7, 0x0D, 0xA7, 0x0F, 0xE3, 0xAF, 0xD1, 0x9D, 0x96, 0xD9, 0x69, 0xD7, 0xAC, 0xA7, 0xAC, 0xA7,
+    0x9D, 0x70, 0xE9, 0x7F, 0xA9, 0x59, 0xFC, 0xA6, 0x9E, 0x70, 0xD9, 0x7D, 0x70, 0xD7, 0xAC, 0xA7,
+    0x30, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D,
+    0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA,
+    0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0xAF, 0xFF, 0xE0, 0x99, 0xDA, 0x99, 0x99, 0x9D, 0x99, 0x3D, 0x94, 0xD5,
+    0xD9, 0x4D, 0x5D, 0x94, 0xD5, 0xD9, 0x4D, 0x5D, 0x94, 0xD5, 0xD9, 0x4D, 0x5D, 0x94, 0xD5, 0xD9,
+    0x4D, 0x5D, 0x94, 0xD5, 0xD9, 0x4E, 0xA9, 0x2D, 0x94, 0x9E, 0x97, 0x70, 0x39, 0xAA, 0xA9, 0x6F,
+    0xE9, 0x3E, 0x90, 0x9A, 0xD2, 0xAD, 0x4A, 0xD1, 0xD9, 0x5D, 0x1D, 0x6D, 0x90, 0xD6, 0xAC, 0xA9,
+    0xD6, 0xAC, 0xA9, 0xD6, 0xAC, 0xA9, 0xD6, 0xD9, 0x9D, 0x59, 0xD0, 0x9D, 0x94, 0xDA, 0x09, 0xFA,
+    0xAA, 0xE1, 0x9D, 0x9F, 0xCA, 0x29, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x19, 0xD7, 0x19,
+    0xD7, 0x10, 0x39, 0xAA, 0xA9, 0x39, 0xFE, 0x19, 0xE9, 0x99, 0xAA, 0x1D, 0xA7, 0xD7, 0x9D, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xD7, 0x9D, 0x70, 0xD9, 0x7A, 0xD9, 0x7A, 0xEA, 0x95, 0x9F, 0xCA, 0x69,
+    0xE7, 0x0D, 0x97, 0xD7, 0x0D, 0x7A, 0xCA, 0x73, 0x59, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0xCA, 0x1E,
+    0xA9, 0x9A, 0xD9, 0x91, 0xAD, 0x4D, 0x92, 0xD5, 0x9D, 0x19, 0xD6, 0xD9, 0x0A, 0xCA, 0x6D, 0x90,
+    0xAC, 0xA6, 0xAC, 0x90, 0xAC, 0xA6, 0xD9, 0x09, 0xD6, 0xD9, 0x1D, 0x59, 0xD2, 0xAD, 0x4D, 0x93,
+    0xEA, 0xAA, 0xDA, 0x5A, 0xFC, 0x97, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFD, 0x90,
+    0x99, 0x9D, 0x99, 0x99, 0x94, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D,
+    0x97, 0x0D, 0xA7, 0x09, 0xDA, 0xAA, 0xA5, 0xAF, 0xA7, 0x09, 0x20, 0x09, 0x95, 0x99, 0x2D, 0x5A,
+    0xCA, 0x1D, 0x59, 0xD1, 0xD6, 0xD1, 0xD6, 0xD1, 0xD6, 0xD1, 0xD6, 0xD1, 0xD6, 0xD1, 0xD6, 0xD1,
+    0xD5, 0x9D, 0x1D, 0x94, 0xAC, 0xA1, 0xAD, 0x39, 0xD3, 0xEA, 0xAE, 0x93, 0x9F, 0xD9, 0x77, 0x6D,
+    0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x73, 0x9A, 0xDA, 0x97, 0xAF, 0xFA, 0x4E, 0x99, 0xD9, 0x9E,
+    0x2A, 0xD2, 0xD2, 0xE1, 0xD3, 0xD3, 0xD9, 0x9D, 0x3D, 0x3A, 0xCA, 0xAC, 0xA3, 0xD3, 0xAC, 0xAA,
+    0xCA, 0x3D, 0x3A, 0xDA, 0xD3, 0xD3, 0xAC, 0xA9, 0xD3, 0xD3, 0xD9, 0x0D, 0x92, 0xD2, 0x9D, 0x19,
+    0xD9, 0x1D, 0x19, 0xDA, 0x29, 0xEA, 0xDA, 0xEA, 0x5A, 0xFD, 0xA9, 0x71, 0xD9, 0x74, 0xD7, 0x5D,
+    0x75, 0xD7, 0x5D, 0x75, 0xD6, 0x09, 0x97, 0x09, 0x90, 0x9E, 0x7D, 0x19, 0xE5, 0xDA, 0x3D, 0x93,
+    0x9D, 0x4A, 0xCA, 0x3D, 0x95, 0xD2, 0x9D, 0x6A, 0xCA, 0x1D, 0x70, 0xD0, 0x9C, 0xA7, 0x0A, 0xCA,
+    0xD7, 0x2E, 0x97, 0x2E, 0x73, 0xE7, 0x2F, 0xA7, 0x09, 0xD9, 0xD7, 0x0D, 0x1D, 0xA6, 0xAC, 0xA1,
+    0x9D, 0x59, 0xD3, 0xDA, 0x4D, 0x93, 0x9D, 0x3A, 0xCA, 0x5F, 0xA0, 0xD7, 0xAD, 0xA0, 0x6D, 0x97,
+    0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x96, 0x99, 0x3D, 0x92, 0x99, 0x1D, 0x3D, 0x92, 0xD9,
+    0x0D, 0x3D, 0x92, 0xAC, 0xA0, 0xD3, 0xD9, 0x29, 0xD0, 0xD3, 0xD9, 0x29, 0xD0, 0xD3, 0xD9, 0x3D,
+    0x0D, 0x3D, 0x93, 0xD0, 0xD3, 0xD9, 0x3D, 0x0D, 0x3D, 0x92, 0x9D, 0x0D, 0x92, 0xD9, 0x2A, 0xCA,
+    0x0A, 0xCA, 0x2D, 0x92, 0xD9, 0x1D, 0xA1, 0xD9, 0x1E, 0x29, 0xEA, 0xFE, 0x49, 0xAF, 0xE9, 0x71,
+    0xDA, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x50, 0x29, 0x97, 0x99, 0x4D,
+    0x97, 0x9D, 0x29, 0xD7, 0x1D, 0x91, 0xD9, 0x71, 0x9D, 0x1D, 0x73, 0xD1, 0xD4, 0xD4, 0xD0, 0x9D,
+    0x4D, 0x4D, 0x99, 0xD4, 0xD4, 0xD9, 0x9D, 0x4D, 0x4D, 0x90, 0xD4, 0xD4, 0xD1, 0xD9, 0x3D, 0x39,
+    0xD1, 0xAD, 0x2A, 0xDA, 0x2D, 0xA2, 0xEA, 0xDA, 0xAD, 0xAE, 0x4F, 0xA1, 0xAF, 0x77, 0x40, 0x6D,
+    0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC,
+    0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA,
+    0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA,
+    0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD7, 0x77, 0x97, 0x5D, 0x97, 0x4D, 0x97,
+    0x59, 0x60, 0x39, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A,
+    0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD,
+    0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x77, 0x99, 0x70, 0xD7, 0x0D, 0x70, 0x99, 0x30, 0x59, 0xA9, 0x74,
+    0xF7, 0x59, 0xC9, 0x74, 0xAC, 0x97, 0x3D, 0x97, 0x4C, 0x97, 0x59, 0x76, 0xD7, 0x4A, 0xDA, 0x73,
+    0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D,
+    0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD,
+    0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0,
+    0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x39, 0xA9, 0x7F, 0x70, 0x9C, 0xA7, 0xAC, 0x96, 0xDA, 0x7C,
+    0x97, 0x72, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD2, 0xAF,
+    0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA, 0xD3, 0x9E, 0x9E, 0xAA, 0xDA,
+    0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x73, 0x99, 0x75, 0xD7, 0x9D, 0x90, 0xD7, 0x0F, 0x09, 0x70,
+    0xD1, 0xD7, 0x0A, 0xA3, 0xA9, 0x77, 0x72, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97,
+    0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9,
+    0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99,
+    0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71,
+    0xAD, 0x72, 0x97, 0x2D, 0x49, 0xAA, 0x1A, 0xC5, 0xF0, 0x95, 0xD0, 0x9D, 0x5A, 0xA3, 0xAA, 0x77,
+    0x39, 0xAA, 0xA9, 0x5F, 0xF4, 0xCA, 0x91, 0x9D, 0xA7, 0x19, 0xD7, 0x2D, 0x72, 0xD4, 0xAF, 0xE2,
+    0xAE, 0xAA, 0xAA, 0xD1, 0x9D, 0x94, 0xD1, 0xDA, 0x5D, 0x1D, 0x94, 0xAD, 0x1A, 0xD3, 0x9E, 0x19,
+    0xEA, 0xAD, 0xAD, 0x29, 0xFC, 0x90, 0xAC, 0x76, 0x09, 0x99, 0x75, 0xD7, 0x6C, 0xA0, 0x9D, 0x97,
+    0x19, 0x0F, 0x72, 0xD1, 0xD7, 0x0A, 0xA3, 0xA9, 0x77, 0x72, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29,
+    0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D,
+    0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA,
+    0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71,
+    0xD9, 0xD9, 0x71, 0xAD, 0x09, 0x72, 0xD7, 0x2C, 0xA1, 0xAA, 0x95, 0x90, 0xF6, 0xD9, 0x9D, 0x4A,
+    0xA3, 0xAA, 0x77, 0x19, 0xAA, 0xA9, 0x4F, 0xF3, 0xCA, 0x91, 0x9D, 0xA7, 0x09, 0xD7, 0x1D, 0x71,
+    0xD3, 0xAF, 0xE1, 0xAE, 0xAA, 0xAA, 0xD0, 0x9D, 0x94, 0xD0, 0xDA, 0x5D, 0x0D, 0x94, 0xAD, 0x0A,
+    0xD3, 0x9E, 0x09, 0xEA, 0xAD, 0xAD, 0x19, 0xFC, 0x90, 0xAC, 0x73, 0x71, 0xAC, 0xA7, 0x6C, 0xA7,
+    0x49, 0xCA, 0x79, 0xD1, 0xC9, 0x79, 0xF0, 0x97, 0x0D, 0x09, 0xD7, 0x0A, 0xA3, 0xA9, 0x77, 0x72,
+    0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A,
+    0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA,
+    0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC,
+    0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x79, 0xCA, 0x71, 0x9A, 0xC7, 0x1A,
+    0xC4, 0xAA, 0x90, 0xCA, 0x4F, 0x09, 0x4D, 0x90, 0xD4, 0xAA, 0x3A, 0xA7, 0x71, 0x9A, 0xAA, 0x94,
+    0xFF, 0x3C, 0xA9, 0x19, 0xDA, 0x70, 0x9D, 0x71, 0xD7, 0x1D, 0x3A, 0xFE, 0x1A, 0xEA, 0xAA, 0xAD,
+    0x09, 0xD9, 0x4D, 0x0D, 0xA5, 0xD0, 0xD9, 0x4A, 0xD0, 0xAD, 0x39, 0xE0, 0x9E, 0xAA, 0xDA, 0xD1,
+    0x9F, 0xC9, 0x0A, 0xC7, 0x40, 0x77, 0x4E, 0x90, 0xAC, 0x7A, 0xC9, 0xAE, 0x97, 0x93, 0x99, 0x72,
+    0x9A, 0xA9, 0x73, 0xF7, 0x2D, 0x1D, 0x70, 0x9A, 0x3A, 0x97, 0x77, 0x2D, 0x74, 0xAD, 0xA7, 0x3F,
+    0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9, 0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9,
+    0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC, 0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9,
+    0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2, 0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09,
+    0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD0, 0x75, 0xE9, 0x09, 0xC2, 0xAC, 0xAF, 0x92, 0xA2, 0x9A, 0x96,
+    0xAA, 0x7F, 0x5D, 0x99, 0xD3, 0xAA, 0x3A, 0xA7, 0x79, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91, 0x9D,
+    0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F, 0x94,
+    0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x77, 0x5A, 0xDA, 0x72,
+    0x9F, 0x97, 0x09, 0xD1, 0xD7, 0x0C, 0xA3, 0xAC, 0x77, 0x72, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29,
+    0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D,
+    0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA,
+    0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71,
+    0xD9, 0xD9, 0x71, 0xAD, 0x77, 0x79, 0x75, 0xD9, 0x74, 0xD9, 0x75, 0x96, 0x76, 0xAD, 0xA5, 0x9F,
+    0x94, 0xD1, 0xD9, 0x2C, 0xA3, 0xAC, 0x77, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79,
+    0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA,
+    0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x79, 0x70, 0x9D, 0x79, 0xD7, 0x09,
+    0x40, 0x77, 0x7A, 0xCA, 0x73, 0x9C, 0xA7, 0x19, 0x90, 0x99, 0x09, 0x97, 0x9C, 0x3C, 0x97, 0x0F,
+    0xD7, 0x2A, 0xAA, 0x97, 0x77, 0x4D, 0x74, 0xAD, 0xA7, 0x3F, 0x72, 0x9C, 0xAA, 0xC9, 0x71, 0xD9,
+    0x9C, 0xA7, 0x1D, 0x1D, 0x70, 0xAC, 0xA1, 0xAC, 0x97, 0xD9, 0x19, 0xD6, 0x9D, 0x3D, 0x95, 0xAC,
+    0xA3, 0xAC, 0xA5, 0xDA, 0xAA, 0xAA, 0xAD, 0x49, 0xFF, 0xD9, 0x3D, 0xA9, 0x99, 0x99, 0x9A, 0xD2,
+    0x9D, 0x7D, 0x2A, 0xCA, 0x7A, 0xCA, 0x1D, 0x70, 0x9D, 0x09, 0xD7, 0x1D, 0x9D, 0x97, 0x1A, 0xD0,
+    0x77, 0x0A, 0xCA, 0x7C, 0xA4, 0x99, 0x0A, 0xA0, 0x99, 0x2A, 0xC3, 0xC9, 0x3F, 0xD5, 0xAD, 0xA7,
+    0x71, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD2, 0xAF, 0xE0,
+    0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA, 0xD3, 0x9E, 0x9E, 0xAA, 0xDA, 0xD0,
+    0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x77, 0x4A, 0xC9, 0x75, 0xAC, 0x73, 0x99, 0x09, 0x90, 0x99, 0x79,
+    0xC3, 0xC9, 0x70, 0xFD, 0x72, 0xAA, 0xA9, 0x77, 0x74, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA,
+    0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69,
+    0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99,
+    0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9,
+    0xD9, 0x71, 0xAD, 0x75, 0xD9, 0x70, 0xD6, 0x99, 0x0A, 0x90, 0x99, 0x2A, 0xC3, 0xC9, 0x3F, 0xD5,
+    0xAD, 0xA7, 0x71, 0x9A, 0xAA, 0x93, 0xFF, 0x2C, 0xA9, 0x19, 0xDA, 0x79, 0xD7, 0x0D, 0x70, 0xD2,
+    0xAF, 0xE0, 0xAE, 0xAA, 0xAA, 0xD9, 0xD9, 0x4F, 0xA5, 0xF9, 0x4A, 0xDA, 0xD3, 0x9E, 0x9E, 0xAA,
+    0xDA, 0xD0, 0x9F, 0xC9, 0x0A, 0xC7, 0x20, 0x77, 0x5A, 0xD9, 0x75, 0xAC, 0x74, 0xAC, 0x97, 0x19,
+    0x90, 0xA1, 0x99, 0x79, 0xC3, 0xC9, 0x70, 0xFD, 0x72, 0xAA, 0xA9, 0x77, 0x74, 0xD7, 0x4A, 0xDA,
+    0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9,
+    0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F,
+    0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09,
+    0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x39, 0xD9, 0x70, 0xAC, 0x79, 0xCA, 0x49, 0x90, 0xA9,
+    0x09, 0x92, 0x9C, 0x3C, 0xA3, 0xFD, 0x5A, 0xDA, 0x77, 0x19, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91,
+    0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F,
+    0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x77, 0x4E, 0x90,
+    0x9C, 0x7A, 0xC9, 0xAE, 0x97, 0x93, 0x99, 0x70, 0x99, 0x39, 0x97, 0xAC, 0x29, 0xC9, 0x70, 0xFD,
+    0x72, 0xAA, 0xA9, 0x77, 0x74, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99,
+    0xCA, 0x71, 0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA,
+    0x3A, 0xCA, 0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29,
+    0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x75,
+    0xDA, 0x90, 0x9C, 0x2A, 0xCA, 0xFA, 0x2A, 0x91, 0x9A, 0x93, 0x94, 0x93, 0xAC, 0x3C, 0x93, 0xFD,
+    0x5A, 0xDA, 0x77, 0x19, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D,
+    0x2A, 0xFE, 0x0A, 0xEA, 0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA,
+    0xAD, 0xAD, 0x09, 0xFC, 0x90, 0xAC, 0x72, 0x39, 0x94, 0x97, 0xAC, 0x3C, 0xA7, 0x0F, 0xD7, 0x2A,
+    0xDA, 0x77, 0x74, 0xD7, 0x4A, 0xDA, 0x73, 0xF7, 0x29, 0xCA, 0xAC, 0x97, 0x1D, 0x99, 0xCA, 0x71,
+    0xD1, 0xD7, 0x0A, 0xCA, 0x1A, 0xC9, 0x7D, 0x91, 0x9D, 0x69, 0xD3, 0xD9, 0x5A, 0xCA, 0x3A, 0xCA,
+    0x5D, 0xAA, 0xAA, 0xAA, 0xD4, 0x9F, 0xFD, 0x93, 0xDA, 0x99, 0x99, 0x99, 0xAD, 0x29, 0xD7, 0xD2,
+    0xAC, 0xA7, 0xAC, 0xA1, 0xD7, 0x09, 0xD0, 0x9D, 0x71, 0xD9, 0xD9, 0x71, 0xAD, 0x77, 0x79, 0x75,
+    0xD9, 0x74, 0xD9, 0x75, 0x96, 0x19, 0x94, 0x92, 0xAC, 0x3D, 0x3F, 0xD9, 0x4A, 0xDA, 0x77, 0x19,
+    0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91, 0x9D, 0xA7, 0x9D, 0x70, 0xD7, 0x0D, 0x2A, 0xFE, 0x0A, 0xEA,
+    0xAA, 0xAD, 0x9D, 0x94, 0xFA, 0x5F, 0x94, 0xAD, 0xAD, 0x39, 0xE9, 0xEA, 0xAD, 0xAD, 0x09, 0xFC,
+    0x90, 0xAC, 0x77, 0x97, 0x0A, 0xD7, 0xAD, 0x70, 0x94, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9, 0xAC, 0xA7,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFC, 0x0A,
+    0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x97, 0x79, 0x70, 0xAC, 0xA7, 0xAC, 0xA7, 0x09, 0x40, 0x39, 0xAA,
+    0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1, 0xDA, 0x4D, 0x90, 0xD5, 0xAC, 0xA9, 0xD5, 0xAD,
+    0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x94,
+    0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA, 0x77, 0x29, 0x71, 0xAC, 0xA7, 0x0A, 0xCA, 0x71, 0x94, 0x3A,
+    0xA9, 0x69, 0xF7, 0x0A, 0xC7, 0x0D, 0x69, 0xD9, 0x69, 0xC7, 0x19, 0x49, 0xFF, 0xC9, 0xAF, 0xFC,
+    0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99, 0x99, 0x99, 0x0A,
+    0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x4A, 0xA9, 0x79, 0xF7, 0x1A, 0xC7, 0x1D, 0x79,
+    0xD9, 0x79, 0xC7, 0x29, 0x70, 0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA, 0x1D, 0xA4,
+    0xD9, 0x0D, 0x5A, 0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA7,
+    0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x40, 0x29, 0x49,
+    0x2F, 0x90, 0x9C, 0x1A, 0xC9, 0xAF, 0xA1, 0xC9, 0x2A, 0xCA, 0x74, 0x9F, 0xFC, 0x9A, 0xFF, 0xC9,
+    0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAD, 0x99, 0x99, 0x99, 0x90, 0xAF,
+    0xFC, 0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xCA, 0x7A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x39, 0x49, 0x2A, 0xEA, 0x1C, 0xA2, 0xCA, 0x9F,
+    0xC2, 0x9C, 0x29, 0xD9, 0x77, 0x19, 0xAA, 0xA9, 0x49, 0xFD, 0xA3, 0xDA, 0x90, 0x9D, 0xA1, 0xDA,
+    0x4D, 0x90, 0xD5, 0xAC, 0xA9, 0xD5, 0xAD, 0xAF, 0xFE, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xCA,
+    0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAD, 0x94, 0x92, 0xFA, 0xAA, 0xD3, 0x9F, 0xDA, 0x74, 0x71, 0x99,
+    0x70, 0xAC, 0x93, 0xAC, 0xA0, 0x9C, 0x93, 0xAE, 0xA9, 0x4A, 0xC9, 0x0A, 0xC9, 0x4A, 0x92, 0x9A,
+    0x76, 0x9F, 0xFC, 0x90, 0xAF, 0xFC, 0x90, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA,
+    0x70, 0xAC, 0xA7, 0x0A, 0xD9, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xC1, 0xAD, 0xAA, 0xAA, 0xAA, 0xA1,
+    0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAF,
+    0xFC, 0x90, 0xAF, 0xFC, 0x90, 0x72, 0x97, 0x2D, 0x94, 0xAA, 0x90, 0x9C, 0x94, 0xF9, 0x99, 0x4A,
+    0xC9, 0x0D, 0x59, 0xC9, 0x2A, 0xA7, 0x73, 0x9A, 0xAA, 0x95, 0x9F, 0xDA, 0x4D, 0xA9, 0x09, 0xDA,
+    0x2D, 0xA4, 0xD9, 0x1D, 0x5A, 0xCA, 0x09, 0xD5, 0xAD, 0x0A, 0xFF, 0xE0, 0xAD, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xAC, 0xA7, 0x19, 0xD7, 0x2D, 0x97, 0x1A, 0xD9, 0x49, 0x3F, 0xAA, 0xAD, 0x49, 0xFD,
+    0xA7, 0x60, 0x09, 0x97, 0x29, 0xCA, 0x72, 0xAC, 0x90, 0xAC, 0xA6, 0x90, 0xAE, 0xA6, 0x9C, 0xA0,
+    0xAC, 0x95, 0xA9, 0x29, 0xA7, 0x70, 0x9F, 0xFC, 0x91, 0xAF, 0xFC, 0x91, 0xAC, 0xA7, 0x1A, 0xCA,
+    0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xC2,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC,
+    0xA7, 0x1A, 0xCA, 0x71, 0xAF, 0xFC, 0x91, 0xAF, 0xFC, 0x90, 0x09, 0x97, 0x2D, 0x97, 0x2D, 0x1A,
+    0xA9, 0x69, 0x0A, 0xE9, 0x6A, 0xCA, 0x0D, 0x6C, 0x92, 0xAC, 0x77, 0x39, 0xAA, 0xA9, 0x59, 0xFD,
+    0xA4, 0xDA, 0x90, 0x9D, 0xA2, 0xDA, 0x4D, 0x91, 0xD5, 0xAC, 0xA0, 0x9D, 0x5A, 0xD0, 0xAF, 0xFE,
+    0x0A, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAD, 0x94, 0x93,
+    0xFA, 0xAA, 0xD4, 0x9F, 0xDA, 0x75, 0x7D, 0xA7, 0x19, 0xC7, 0x19, 0xC4, 0xAC, 0xA0, 0x9C, 0x4A,
+    0xEA, 0x09, 0x3A, 0xC9, 0x0A, 0xC9, 0x4A, 0x92, 0x9A, 0x76, 0x9F, 0xFC, 0x90, 0xAF, 0xFC, 0x90,
+    0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xD9, 0x99, 0x99,
+    0x99, 0x1A, 0xFF, 0xC1, 0xAD, 0xAA, 0xAA, 0xAA, 0xA1, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAC, 0xA7,
+    0x0A, 0xCA, 0x70, 0xAC, 0xA7, 0x0A, 0xCA, 0x70, 0xAF, 0xFC, 0x90, 0xAF, 0xFC, 0x90, 0x79, 0xCA,
+    0x97, 0x19, 0xAC, 0x72, 0xAC, 0x5A, 0xA9, 0x0A, 0xA5, 0xF0, 0x95, 0xAC, 0x90, 0xD5, 0x9C, 0x3A,
+    0xA7, 0x73, 0x9A, 0xAA, 0x95, 0x9F, 0xDA, 0x4D, 0xA9, 0x09, 0xDA, 0x2D, 0xA4, 0xD9, 0x1D, 0x5A,
+    0xCA, 0x09, 0xD5, 0xAD, 0x0A, 0xFF, 0xE0, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0x19,
+    0xD7, 0x2D, 0x97, 0x1A, 0xD9, 0x49, 0x3F, 0xAA, 0xAD, 0x49, 0xFD, 0xA7, 0x60, 0x74, 0xAD, 0xA1,
+    0xC2, 0x9C, 0x9A, 0xF3, 0x92, 0x99, 0x6A, 0xAA, 0x6A, 0xE9, 0x4A, 0xC9, 0x0A, 0xC9, 0x3A, 0x39,
+    0xA7, 0x49, 0xFF, 0xC9, 0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xCA,
+    0x7A, 0xD9, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAC, 0xA7, 0xAC,
+    0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC, 0x9A, 0xFF, 0xC9, 0x76, 0xAD,
+    0x91, 0xC3, 0x9C, 0xAF, 0xA3, 0x99, 0x2A, 0x97, 0xAA, 0x97, 0xF6, 0xAC, 0x90, 0xD4, 0x9C, 0x3A,
+    0xA7, 0x71, 0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA, 0x1D, 0xA4, 0xD9, 0x0D, 0x5A,
+    0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA7, 0x09, 0xD7, 0x1D,
+    0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x40, 0x76, 0xE6, 0xAF, 0x4A, 0xCA,
+    0x09, 0xD2, 0x9C, 0x92, 0x9C, 0xA7, 0x39, 0xFF, 0xC9, 0xAF, 0xFC, 0x9A, 0xCA, 0x7A, 0xCA, 0x7A,
+    0xCA, 0x7A, 0xCA, 0x7A, 0xCA, 0x7A, 0xD9, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC0, 0xAD, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAC, 0xA7, 0xAF, 0xFC,
+    0x9A, 0xFF, 0xC9, 0x77, 0x97, 0x0A, 0xCA, 0x7A, 0xCA, 0x70, 0x94, 0x77, 0x9D, 0xA7, 0xFA, 0x5D,
+    0x1D, 0x93, 0xAA, 0x3A, 0xC7, 0x71, 0x9A, 0xAA, 0x94, 0x9F, 0xDA, 0x3D, 0xA9, 0x09, 0xDA, 0x1D,
+    0xA4, 0xD9, 0x0D, 0x5A, 0xCA, 0x9D, 0x5A, 0xDA, 0xFF, 0xEA, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC,
+    0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9, 0x49, 0x2F, 0xAA, 0xAD, 0x39, 0xFD, 0xA7, 0x72, 0x97,
+    0x1A, 0xCA, 0x70, 0xAC, 0xA7, 0x19, 0x40, 0x09, 0xAA, 0x92, 0x9A, 0xDA, 0x4A, 0xC3, 0x9D, 0x2A,
+    0xCA, 0x3A, 0xC7, 0x1F, 0xD9, 0xAF, 0xA2, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x91, 0x9A, 0xEA, 0x0F, 0xD9,
+    0x0A, 0x99, 0x19, 0xEA, 0x3D, 0x3D, 0x1A, 0xD2, 0xAC, 0x71, 0x99, 0x3D, 0x92, 0xD9, 0x2D, 0x92,
+    0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x91, 0xFD,
+    0x9A, 0xFA, 0x2D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93,
+    0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x19, 0xAE, 0xA0, 0xFD, 0x97, 0x19, 0x4D, 0x93, 0xD9,
+    0x49, 0x20, 0x19, 0x1D, 0x90, 0xD9, 0x19, 0x59, 0x91, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9,
+    0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x59, 0x1D, 0x90, 0xD9,
+    0x19, 0x00, 0x77, 0x5A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD,
+    0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7,
+    0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D,
+    0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x77, 0x49, 0x76, 0x9D,
+    0x75, 0x9D, 0x76, 0x97, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4,
+    0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC,
+    0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x75, 0x97,
+    0x2A, 0xCA, 0x71, 0xAC, 0xA7, 0x29, 0x50, 0x6A, 0xAA, 0x75, 0xAA, 0xD9, 0x76, 0xCA, 0x75, 0xAC,
+    0x97, 0x4D, 0x97, 0x5C, 0x97, 0x77, 0x4A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA,
+    0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7,
+    0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7,
+    0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74,
+    0x49, 0xA9, 0x71, 0xF7, 0x29, 0xC9, 0x71, 0xAC, 0x70, 0x9D, 0x97, 0x1C, 0x97, 0x29, 0x71, 0x9A,
+    0xAA, 0x95, 0x9F, 0xE9, 0x3D, 0xA9, 0x09, 0xAD, 0x91, 0xDA, 0x4A, 0xD1, 0xD6, 0xD9, 0x9D, 0x6A,
+    0xCA, 0xAC, 0xA6, 0xAC, 0xAA, 0xCA, 0x6A, 0xDA, 0xCA, 0x6A, 0xCA, 0x9D, 0x6D, 0xA0, 0xD9, 0x5D,
+    0x1A, 0xD4, 0xE2, 0xEA, 0xAA, 0xE4, 0x9F, 0xCA, 0x77, 0x74, 0x99, 0x75, 0x9C, 0xA7, 0x0A, 0xD1,
+    0xCA, 0x70, 0x9F, 0x09, 0x70, 0x9C, 0xA0, 0x9C, 0xA7, 0x1A, 0x93, 0xA9, 0x77, 0x71, 0xAF, 0xD9,
+    0x69, 0xFF, 0xD4, 0x9D, 0xA4, 0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA,
+    0x0D, 0x72, 0xAD, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D,
+    0x72, 0xAD, 0x0D, 0x97, 0x1D, 0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E,
+    0x4A, 0xFA, 0xAF, 0x69, 0xAF, 0xDA, 0x77, 0x40, 0x72, 0x99, 0x72, 0xAC, 0xA5, 0xAA, 0xA1, 0xCA,
+    0x59, 0xEA, 0x99, 0x59, 0xCA, 0x0A, 0xC9, 0x6C, 0x92, 0x9C, 0x77, 0x59, 0xAA, 0xA9, 0x69, 0xFE,
+    0x94, 0xDA, 0x90, 0x9A, 0xD9, 0x2D, 0xA4, 0xAD, 0x2D, 0x6D, 0x90, 0x9D, 0x6A, 0xCA, 0x0A, 0xCA,
+    0x6A, 0xCA, 0x0A, 0xCA, 0x6A, 0xD0, 0xAC, 0xA6, 0xAC, 0xA0, 0x9D, 0x6D, 0xA1, 0xD9, 0x5D, 0x2A,
+    0xD4, 0xE3, 0xEA, 0xAA, 0xE5, 0x9F, 0xCA, 0x77, 0x10, 0x19, 0x97, 0x7D, 0x76, 0x9C, 0xA0, 0x9D,
+    0x73, 0x99, 0xF7, 0x3D, 0x09, 0xD7, 0x1A, 0xA3, 0xA9, 0x77, 0x71, 0xAF, 0xD9, 0x69, 0xFF, 0xD4,
+    0x9D, 0xA4, 0x9E, 0x3D, 0xA7, 0xDA, 0x1A, 0xD7, 0x09, 0xD1, 0xD9, 0x71, 0xDA, 0x0D, 0x72, 0xAD,
+    0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0x9D, 0x9D, 0x72, 0xAD, 0x0D,
+    0x97, 0x1D, 0xA0, 0xAD, 0x70, 0x9D, 0x19, 0xD9, 0x7D, 0xA2, 0xAD, 0xA4, 0x9E, 0x4A, 0xFA, 0xAF,
+    0x69, 0xAF, 0xDA, 0x77, 0x40, 0x99, 0x72, 0xAC, 0xA7, 0x2A, 0xC9, 0x0A, 0xAA, 0x69, 0x99, 0xEA,
+    0x69, 0xCA, 0x0A, 0xC9, 0x5C, 0x92, 0x9C, 0x77, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90,
+    0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6,
+    0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49,
+    0xFC, 0xA7, 0x70, 0x72, 0xAC, 0xA7, 0x7C, 0xA7, 0x59, 0xC9, 0x70, 0xAD, 0x1C, 0x97, 0x09, 0xF0,
+    0x97, 0x09, 0xCA, 0x09, 0xCA, 0x71, 0xA9, 0x3A, 0x97, 0x77, 0x1A, 0xFD, 0x96, 0x9F, 0xFD, 0x49,
+    0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9,
+    0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9,
+    0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6,
+    0x9A, 0xFD, 0xA7, 0x74, 0x70, 0xAA, 0x97, 0x19, 0x9C, 0x97, 0x19, 0xC9, 0x4A, 0xAA, 0x09, 0xC9,
+    0x49, 0xEA, 0x09, 0x49, 0xCA, 0x0A, 0xC9, 0x5C, 0x92, 0x9C, 0x77, 0x39, 0xAA, 0xA9, 0x59, 0xFE,
+    0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC, 0xAA, 0xCA, 0x6A,
+    0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1, 0xAD, 0x4E, 0x2E,
+    0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0x59, 0xE9, 0x0A, 0xA7, 0x0C, 0xA9, 0xF7, 0x1A, 0x29,
+    0x97, 0x49, 0xAA, 0x74, 0x9F, 0x73, 0xCA, 0x09, 0xCA, 0x71, 0xA9, 0x3A, 0x97, 0x77, 0x1A, 0xFD,
+    0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA, 0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D,
+    0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9,
+    0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7, 0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49,
+    0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x74, 0x77, 0x9D, 0xA1, 0xC9, 0x4C, 0xAA, 0xF5, 0xA2,
+    0x9A, 0x70, 0x9A, 0xA7, 0x09, 0xEA, 0x69, 0xCA, 0x0A, 0xC9, 0x5C, 0x92, 0x9C, 0x77, 0x39, 0xAA,
+    0xA9, 0x59, 0xFE, 0x93, 0xDA, 0x90, 0x9A, 0xD9, 0x1D, 0xA4, 0xAD, 0x1D, 0x6D, 0x99, 0xD6, 0xAC,
+    0xAA, 0xCA, 0x6A, 0xCA, 0xAC, 0xA6, 0xAD, 0xAC, 0xA6, 0xAC, 0xA9, 0xD6, 0xDA, 0x0D, 0x95, 0xD1,
+    0xAD, 0x4E, 0x2E, 0xAA, 0xAE, 0x49, 0xFC, 0xA7, 0x70, 0x77, 0x7E, 0x97, 0x3A, 0xF7, 0x29, 0xD0,
+    0x9D, 0x71, 0xCA, 0x3C, 0xA7, 0x77, 0x1A, 0xFD, 0x96, 0x9F, 0xFD, 0x49, 0xDA, 0x49, 0xE3, 0xDA,
+    0x7D, 0xA1, 0xAD, 0x70, 0x9D, 0x1D, 0x97, 0x1D, 0xA0, 0xD7, 0x2A, 0xD9, 0xD7, 0x29, 0xD9, 0xD7,
+    0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x29, 0xD9, 0xD7, 0x2A, 0xD0, 0xD9, 0x71, 0xDA, 0x0A, 0xD7,
+    0x09, 0xD1, 0x9D, 0x97, 0xDA, 0x2A, 0xDA, 0x49, 0xE4, 0xAF, 0xAA, 0xF6, 0x9A, 0xFD, 0xA7, 0x77,
+    0x49, 0x76, 0x9D, 0x75, 0x9D, 0x76, 0x97, 0x77, 0x1E, 0x70, 0xAF, 0x6A, 0xCA, 0x09, 0xD4, 0x9C,
+    0x92, 0x9C, 0xA7, 0x72, 0x9A, 0xAA, 0x95, 0x9F, 0xE9, 0x3D, 0xA9, 0x09, 0xAD, 0x91, 0xDA, 0x4A,
+    0xD1, 0xD6, 0xD9, 0x9D, 0x6A, 0xCA, 0xAC, 0xA6, 0xAC, 0xAA, 0xCA, 0x6A, 0xDA, 0xCA, 0x6A, 0xCA,
+    0x9D, 0x6D, 0xA0, 0xD9, 0x5D, 0x1A, 0xD4, 0xE2, 0xEA, 0xAA, 0xE4, 0x9F, 0xCA, 0x77, 0x59, 0x72,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x72, 0x95, 0x77, 0x74, 0xAD, 0x77, 0x9D, 0x77, 0x0D, 0x97, 0x79, 0xC7,
+    0x77, 0x29, 0xD5, 0xAF, 0xD9, 0x2A, 0xD3, 0x9F, 0xFD, 0x1D, 0x92, 0x9D, 0xA4, 0x9F, 0xCA, 0x3D,
+    0xA7, 0xEA, 0x3A, 0xD7, 0x09, 0xD4, 0xD9, 0x71, 0xDA, 0x3D, 0x72, 0xAC, 0xA2, 0x9D, 0x72, 0xAD,
+    0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0xAD, 0x3D, 0x97,
+    0x1D, 0xA3, 0xAD, 0x70, 0x9D, 0x49, 0xD9, 0x7D, 0xA5, 0xAD, 0xA4, 0x9E, 0x7A, 0xFA, 0xAF, 0x71,
+    0x9A, 0xFD, 0xA7, 0x77, 0x20, 0x77, 0x6E, 0x73, 0xAD, 0x74, 0xD7, 0x4A, 0xC5, 0x99, 0x74, 0x9D,
+    0x49, 0xAA, 0xA9, 0x2A, 0xCA, 0x29, 0xFE, 0x90, 0xD2, 0x9D, 0xA9, 0x09, 0xAF, 0x92, 0xDA, 0x49,
+    0xD4, 0xD6, 0xD9, 0x29, 0xD6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAD, 0x2A, 0xCA,
+    0x6A, 0xCA, 0x29, 0xD6, 0xAC, 0xA3, 0xD9, 0x5D, 0x4A, 0xD4, 0xE5, 0xEA, 0xAA, 0xE7, 0x9F, 0xCA,
+    0x77, 0x50, 0x77, 0x71, 0xD9, 0x77, 0x09, 0xD7, 0x71, 0x9C, 0xA7, 0x71, 0x9C, 0x97, 0x77, 0x09,
+    0xD5, 0xAF, 0xD9, 0x2A, 0xD3, 0x9F, 0xFD, 0x1D, 0x92, 0x9D, 0xA4, 0x9F, 0xCA, 0x3D, 0xA7, 0xEA,
+    0x3A, 0xD7, 0x09, 0xD4, 0xD9, 0x71, 0xDA, 0x3D, 0x72, 0xAC, 0xA2, 0x9D, 0x72, 0xAD, 0x29, 0xD7,
+    0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0xAD, 0x3D, 0x97, 0x1D, 0xA3,
+    0xAD, 0x70, 0x9D, 0x49, 0xD9, 0x7D, 0xA5, 0xAD, 0xA4, 0x9E, 0x7A, 0xFA, 0xAF, 0x71, 0x9A, 0xFD,
+    0xA7, 0x77, 0x20, 0x77, 0x29, 0xD9, 0x74, 0xAD, 0x75, 0xAC, 0xA7, 0x5A, 0xC4, 0x99, 0x74, 0x9D,
+    0x49, 0xAA, 0xA9, 0x2A, 0xCA, 0x29, 0xFE, 0x90, 0xD2, 0x9D, 0xA9, 0x09, 0xAF, 0x92, 0xDA, 0x49,
+    0xD4, 0xD6, 0xD9, 0x29, 0xD6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAD, 0x2A, 0xCA,
+    0x6A, 0xCA, 0x29, 0xD6, 0xAC, 0xA3, 0xD9, 0x5D, 0x4A, 0xD4, 0xE5, 0xEA, 0xAA, 0xE7, 0x9F, 0xCA,
+    0x77, 0x50, 0x6A, 0xA9, 0x77, 0x0F, 0x77, 0x1A, 0xC9, 0x77, 0x0A, 0xC7, 0x79, 0xD9, 0x77, 0x9C,
+    0x77, 0x29, 0x69, 0xD5, 0xAF, 0xD9, 0x2A, 0xD3, 0x9F, 0xFD, 0x1D, 0x92, 0x9D, 0xA4, 0x9F, 0xCA,
+    0x3D, 0xA7, 0xEA, 0x3A, 0xD7, 0x09, 0xD4, 0xD9, 0x71, 0xDA, 0x3D, 0x72, 0xAC, 0xA2, 0x9D, 0x72,
+    0xAD, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0xAD, 0x3D,
+    0x97, 0x1D, 0xA3, 0xAD, 0x70, 0x9D, 0x49, 0xD9, 0x7D, 0xA5, 0xAD, 0xA4, 0x9E, 0x7A, 0xFA, 0xAF,
+    0x71, 0x9A, 0xFD, 0xA7, 0x77, 0x20, 0x4A, 0x99, 0x73, 0x9E, 0xA7, 0x5A, 0xC7, 0x5D, 0x73, 0x9D,
+    0x74, 0x9C, 0x59, 0x97, 0x49, 0xD4, 0x9A, 0xAA, 0x92, 0xAC, 0xA2, 0x9F, 0xE9, 0x0D, 0x29, 0xDA,
+    0x90, 0x9A, 0xF9, 0x2D, 0xA4, 0x9D, 0x4D, 0x6D, 0x92, 0x9D, 0x6A, 0xCA, 0x2A, 0xCA, 0x6A, 0xCA,
+    0x2A, 0xCA, 0x6A, 0xD2, 0xAC, 0xA6, 0xAC, 0xA2, 0x9D, 0x6A, 0xCA, 0x3D, 0x95, 0xD4, 0xAD, 0x4E,
+    0x5E, 0xAA, 0xAE, 0x79, 0xFC, 0xA7, 0x75, 0x59, 0x93, 0x97, 0x3F, 0x90, 0x9C, 0x72, 0xAC, 0x9A,
+    0xFC, 0x72, 0xA9, 0x2A, 0xCA, 0x77, 0x79, 0xD5, 0xAF, 0xD9, 0x2A, 0xD3, 0x9F, 0xFD, 0x1D, 0x92,
+    0x9D, 0xA4, 0x9F, 0xCA, 0x3D, 0xA7, 0xEA, 0x3A, 0xD7, 0x09, 0xD4, 0xD9, 0x71, 0xDA, 0x3D, 0x72,
+    0xAC, 0xA2, 0x9D, 0x72, 0xAD, 0x29, 0xD7, 0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x29, 0xD2,
+    0x9D, 0x72, 0xAD, 0x3D, 0x97, 0x1D, 0xA3, 0xAD, 0x70, 0x9D, 0x49, 0xD9, 0x7D, 0xA5, 0xAD, 0xA4,
+    0x9E, 0x7A, 0xFA, 0xAF, 0x71, 0x9A, 0xFD, 0xA7, 0x77, 0x20, 0x39, 0x49, 0x7F, 0x19, 0xC6, 0xAC,
+    0x9A, 0xFA, 0x6C, 0x92, 0xAC, 0xA2, 0x99, 0x74, 0x9D, 0x49, 0xAA, 0xA9, 0x2A, 0xCA, 0x29, 0xFE,
+    0x90, 0xD2, 0x9D, 0xA9, 0x09, 0xAF, 0x92, 0xDA, 0x49, 0xD4, 0xD6, 0xD9, 0x29, 0xD6, 0xAC, 0xA2,
+    0xAC, 0xA6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAD, 0x2A, 0xCA, 0x6A, 0xCA, 0x29, 0xD6, 0xAC, 0xA3, 0xD9,
+    0x5D, 0x4A, 0xD4, 0xE5, 0xEA, 0xAA, 0xE7, 0x9F, 0xCA, 0x77, 0x50, 0x77, 0x9D, 0x5A, 0xFD, 0x92,
+    0xAD, 0x39, 0xFF, 0xD1, 0xD9, 0x29, 0xDA, 0x49, 0xFC, 0xA3, 0xDA, 0x7E, 0xA3, 0xAD, 0x70, 0x9D,
+    0x4D, 0x97, 0x1D, 0xA3, 0xD7, 0x2A, 0xCA, 0x29, 0xD7, 0x2A, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7,
+    0x29, 0xD2, 0x9D, 0x72, 0x9D, 0x29, 0xD7, 0x2A, 0xD3, 0xD9, 0x71, 0xDA, 0x3A, 0xD7, 0x09, 0xD4,
+    0x9D, 0x97, 0xDA, 0x5A, 0xDA, 0x49, 0xE7, 0xAF, 0xAA, 0xF7, 0x19, 0xAF, 0xDA, 0x77, 0x77, 0x29,
+    0x77, 0x1A, 0xD7, 0x70, 0xAD, 0x77, 0x19, 0x72, 0x74, 0x99, 0x74, 0x9D, 0x49, 0xAA, 0xA9, 0x2A,
+    0xCA, 0x29, 0xFE, 0x90, 0xD2, 0x9D, 0xA9, 0x09, 0xAF, 0x92, 0xDA, 0x49, 0xD4, 0xD6, 0xD9, 0x29,
+    0xD6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAC, 0xA2, 0xAC, 0xA6, 0xAD, 0x2A, 0xCA, 0x6A, 0xCA, 0x29, 0xD6,
+    0xAC, 0xA3, 0xD9, 0x5D, 0x4A, 0xD4, 0xE5, 0xEA, 0xAA, 0xE7, 0x9F, 0xCA, 0x77, 0x73, 0x97, 0x5A,
+    0xCA, 0x74, 0xAC, 0xA7, 0x59, 0x70, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7,
+    0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D, 0xAC,
+    0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA, 0x77,
+    0x79, 0x73, 0xD9, 0x72, 0xD9, 0x73, 0x95, 0x09, 0x96, 0x99, 0x1D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D,
+    0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D,
+    0x90, 0xD9, 0x49, 0xD9, 0x0A, 0xD4, 0xE9, 0x09, 0xEA, 0xAA, 0xF9, 0x19, 0xFC, 0xA0, 0xAC, 0x97,
+    0x72, 0x97, 0x2D, 0xA7, 0x1D, 0xA7, 0x29, 0x50, 0x49, 0xAA, 0x97, 0x1A, 0xAD, 0xA7, 0x3D, 0x72,
+    0x9C, 0xA7, 0x1D, 0xA7, 0x2A, 0xC7, 0x73, 0xAC, 0x97, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F,
+    0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0F, 0xA7, 0x0D,
+    0xAC, 0xA7, 0x9D, 0xAD, 0x79, 0xD0, 0xD7, 0xD9, 0x0A, 0xD9, 0x4E, 0x2F, 0xAA, 0xF4, 0xAF, 0xDA,
+    0x77, 0x00, 0x49, 0xA9, 0x71, 0xF7, 0x29, 0xC9, 0x71, 0xAC, 0x70, 0x9D, 0x97, 0x1C, 0x73, 0x96,
+    0x99, 0x69, 0x91, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D,
+    0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x6D, 0x90, 0xD6, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xAD, 0x4E, 0x90,
+    0x9E, 0xAA, 0xAF, 0x91, 0x9F, 0xCA, 0x0A, 0xC9, 0x74, 0x77, 0x71, 0x9D, 0x97, 0x6D, 0xA7, 0x6A,
+    0xCA, 0x77, 0xCA, 0x77, 0x72, 0xD9, 0xAC, 0x97, 0x0D, 0x1D, 0x0D, 0xA7, 0x0D, 0x09, 0xCA, 0x0D,
+    0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E, 0xA2, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4,
+    0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xAC,
+    0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D, 0x7D, 0xA5, 0xAD, 0x94, 0xAD, 0x7F, 0xAA, 0xF9, 0x70, 0x9F,
+    0xDA, 0x77, 0x72, 0x77, 0x7E, 0x74, 0x9D, 0x75, 0xD7, 0x5A, 0xC6, 0x99, 0x97, 0x5D, 0xA0, 0x99,
+    0x69, 0x91, 0xD1, 0xD6, 0xD9, 0xAD, 0x1D, 0x6F, 0xC2, 0xD6, 0xDA, 0x93, 0xD6, 0xD9, 0x4D, 0x6D,
+    0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD9, 0x49, 0xD9, 0x4A, 0xD4,
+    0xE9, 0x49, 0xEA, 0xAA, 0xF9, 0x59, 0xFC, 0xA0, 0xAC, 0x97, 0x74, 0x77, 0x6E, 0x77, 0x0D, 0x97,
+    0x70, 0xD7, 0x71, 0xCA, 0x77, 0x71, 0xD9, 0xAC, 0x97, 0x0D, 0x1D, 0x0D, 0xA7, 0x0D, 0x09, 0xCA,
+    0x0D, 0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E, 0xA2, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70,
+    0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4,
+    0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D, 0x7D, 0xA5, 0xAD, 0x94, 0xAD, 0x7F, 0xAA, 0xF9, 0x70,
+    0x9F, 0xDA, 0x77, 0x72, 0x77, 0x39, 0xD9, 0x75, 0x9D, 0x76, 0x9C, 0xA7, 0x69, 0xC9, 0x49, 0x99,
+    0x75, 0xDA, 0x09, 0x96, 0x99, 0x1D, 0x1D, 0x6D, 0x9A, 0xD1, 0xD6, 0xFC, 0x2D, 0x6D, 0xA9, 0x3D,
+    0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x94,
+    0x9D, 0x94, 0xAD, 0x4E, 0x94, 0x9E, 0xAA, 0xAF, 0x95, 0x9F, 0xCA, 0x0A, 0xC9, 0x77, 0x40, 0x49,
+    0xAA, 0x97, 0x69, 0xAD, 0xA7, 0x70, 0xD7, 0x79, 0xD7, 0x6A, 0xCA, 0x77, 0xAC, 0x77, 0x72, 0xD9,
+    0xAC, 0x97, 0x0D, 0x1D, 0x0D, 0xA7, 0x0D, 0x09, 0xCA, 0x0D, 0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E,
+    0xA2, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4,
+    0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D,
+    0x7D, 0xA5, 0xAD, 0x94, 0xAD, 0x7F, 0xAA, 0xF9, 0x70, 0x9F, 0xDA, 0x77, 0x72, 0x49, 0xA9, 0x75,
+    0xF7, 0x69, 0xC9, 0x75, 0xAC, 0x97, 0x4D, 0x97, 0x5C, 0x95, 0x99, 0x95, 0x96, 0xDA, 0x09, 0x96,
+    0x99, 0x1D, 0x1D, 0x6D, 0x9A, 0xD1, 0xD6, 0xFC, 0x2D, 0x6D, 0xA9, 0x3D, 0x6D, 0x94, 0xD6, 0xD9,
+    0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x94, 0x9D, 0x94, 0xAD, 0x4E,
+    0x94, 0x9E, 0xAA, 0xAF, 0x95, 0x9F, 0xCA, 0x0A, 0xC9, 0x77, 0x40, 0x49, 0x49, 0x71, 0xAE, 0xA1,
+    0xCA, 0x71, 0xCA, 0x9F, 0xC7, 0x19, 0xC2, 0x9D, 0x97, 0x77, 0xD9, 0xAC, 0x97, 0x0D, 0x1D, 0x0D,
+    0xA7, 0x0D, 0x09, 0xCA, 0x0D, 0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E, 0xA2, 0xDA, 0x70, 0xD4, 0xDA,
+    0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70,
+    0xD4, 0xDA, 0x70, 0xD4, 0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D, 0x7D, 0xA5, 0xAD, 0x94, 0xAD,
+    0x7F, 0xAA, 0xF9, 0x70, 0x9F, 0xDA, 0x77, 0x72, 0x39, 0x49, 0x70, 0xF9, 0x09, 0xC7, 0xAC, 0x9A,
+    0xFA, 0x7A, 0x92, 0xAC, 0xA3, 0x99, 0x97, 0x5D, 0xA0, 0x99, 0x69, 0x91, 0xD1, 0xD6, 0xD9, 0xAD,
+    0x1D, 0x6F, 0xC2, 0xD6, 0xDA, 0x93, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94,
+    0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD9, 0x49, 0xD9, 0x4A, 0xD4, 0xE9, 0x49, 0xEA, 0xAA, 0xF9, 0x59,
+    0xFC, 0xA0, 0xAC, 0x97, 0x74, 0x77, 0xD9, 0xAC, 0x97, 0x0D, 0x1D, 0x0D, 0xA7, 0x0D, 0x09, 0xCA,
+    0x0D, 0xA7, 0x0D, 0xAD, 0x1D, 0xA7, 0x0E, 0xA2, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70,
+    0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4, 0xDA, 0x70, 0xD4,
+    0xAC, 0xA7, 0x9D, 0x4A, 0xD7, 0x9D, 0x5D, 0x7D, 0xA5, 0xAD, 0x94, 0xAD, 0x7F, 0xAA, 0xF9, 0x70,
+    0x9F, 0xDA, 0x77, 0x77, 0x19, 0x77, 0x0D, 0x97, 0x7D, 0x97, 0x70, 0x97, 0x20, 0x75, 0x99, 0x97,
+    0x5D, 0xA0, 0x99, 0x69, 0x91, 0xD1, 0xD6, 0xD9, 0xAD, 0x1D, 0x6F, 0xC2, 0xD6, 0xDA, 0x93, 0xD6,
+    0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD6, 0xD9, 0x4D, 0x6D, 0x94, 0xD9, 0x49,
+    0xD9, 0x4A, 0xD4, 0xE9, 0x49, 0xEA, 0xAA, 0xF9, 0x59, 0xFC, 0xA0, 0xAC, 0x97, 0x77, 0x29, 0x76,
+    0xDA, 0x75, 0xDA, 0x76, 0x97, 0x10, 0x77, 0x2E, 0x74, 0xD9, 0x74, 0xD7, 0x5C, 0xA7, 0x74, 0xAC,
+    0xA7, 0x9D, 0x09, 0xD7, 0xD9, 0x1A, 0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5, 0xD9,
+    0x2D, 0x6A, 0xD1, 0xAC, 0xA7, 0xD9, 0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7, 0x3D,
+    0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x60, 0x77, 0xAD, 0x72, 0xAC, 0xA7, 0x2D,
+    0x97, 0x2A, 0xC7, 0x71, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x0D, 0x59, 0xD1, 0xD9, 0x4A, 0xCA,
+    0x19, 0xD4, 0xD9, 0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA, 0x4D, 0x2D, 0x5D, 0x90, 0x9D, 0x59,
+    0xCA, 0x0D, 0x96, 0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71, 0xE7, 0x1D, 0x97, 0x1D, 0x71, 0xAC,
+    0xA7, 0x09, 0xD6, 0xAF, 0x96, 0xAE, 0x97, 0xAC, 0xA7, 0x9D, 0x09, 0xD7, 0xD9, 0x1A, 0xCA, 0x5A,
+    0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5, 0xD9, 0x2D, 0x6A, 0xD1, 0xAC, 0xA7, 0xD9, 0x0D, 0x70,
+    0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7, 0x3D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7,
+    0x4D, 0x77, 0x73, 0x99, 0x74, 0xD7, 0x4D, 0x74, 0x99, 0x60, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9,
+    0x0D, 0x59, 0xD1, 0xD9, 0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA,
+    0x4D, 0x2D, 0x5D, 0x90, 0x9D, 0x59, 0xCA, 0x0D, 0x96, 0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71,
+    0xE7, 0x1D, 0x97, 0x1D, 0x19, 0x6A, 0xCA, 0x0A, 0xD4, 0x9D, 0x1A, 0xD1, 0xAF, 0x92, 0x92, 0xAE,
+    0x97, 0x49, 0xAA, 0x97, 0x2A, 0xAD, 0xA7, 0x4D, 0x73, 0x9C, 0xA7, 0x2D, 0xA7, 0x3A, 0xA7, 0x75,
+    0xAC, 0xA7, 0x9D, 0x09, 0xD7, 0xD9, 0x1A, 0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5,
+    0xD9, 0x2D, 0x6A, 0xD1, 0xAC, 0xA7, 0xD9, 0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7,
+    0x3D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x60, 0x4A, 0x99, 0x70, 0x9E, 0xA7,
+    0x2D, 0x72, 0xD7, 0x0A, 0xD7, 0x1A, 0xC7, 0x72, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x0D, 0x59,
+    0xD1, 0xD9, 0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA, 0x4D, 0x2D,
+    0x5D, 0x90, 0x9D, 0x59, 0xCA, 0x0D, 0x96, 0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71, 0xE7, 0x1D,
+    0x97, 0x1D, 0x71, 0xAC, 0xA7, 0x09, 0xD6, 0xAF, 0x96, 0xAE, 0x97, 0x49, 0x39, 0x6A, 0xEA, 0x1C,
+    0x95, 0xCA, 0x9F, 0xC5, 0x9A, 0x29, 0xCA, 0x97, 0x72, 0xAC, 0xA7, 0x9D, 0x09, 0xD7, 0xD9, 0x1A,
+    0xCA, 0x5A, 0xD3, 0xD5, 0xD9, 0x3A, 0xCA, 0x3A, 0xD5, 0xD9, 0x2D, 0x6A, 0xD1, 0xAC, 0xA7, 0xD9,
+    0x0D, 0x70, 0x9D, 0xAC, 0xA7, 0x1F, 0x72, 0x9D, 0xA7, 0x3D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D,
+    0x74, 0xD7, 0x4D, 0x60, 0x39, 0x49, 0x39, 0xEA, 0x1A, 0xC3, 0xD9, 0xAF, 0x93, 0xC2, 0x9A, 0xC9,
+    0x77, 0x99, 0x79, 0x99, 0xAC, 0xA6, 0xD9, 0x0D, 0x59, 0xD1, 0xD9, 0x4A, 0xCA, 0x19, 0xD4, 0xD9,
+    0x2D, 0x92, 0x9D, 0x3A, 0xCA, 0x2A, 0xCA, 0x4D, 0x2D, 0x5D, 0x90, 0x9D, 0x59, 0xCA, 0x0D, 0x96,
+    0xD0, 0xD7, 0xAC, 0xAC, 0xA7, 0x0E, 0x71, 0xE7, 0x1D, 0x97, 0x1D, 0x71, 0xAC, 0xA7, 0x09, 0xD6,
+    0xAF, 0x96, 0xAE, 0x97, 0x71, 0xC9, 0x5C, 0x90, 0xAF, 0xC0, 0xAA, 0x1C, 0x90, 0xAA, 0x0C, 0x2A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7, 0x30, 0x70, 0x9C, 0x39, 0xC4, 0xFC, 0xA0, 0x9C, 0x1A, 0xA1,
+    0x9C, 0x0A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA,
+    0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x60, 0xAA, 0xAA, 0xAA, 0x0F, 0xD0, 0x99,
+    0x99, 0x99, 0x00, 0xAA, 0xAA, 0xAA, 0x0F, 0xD0, 0x99, 0x99, 0x99, 0x00, 0xFF, 0xF9, 0xFF, 0xF9,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xE9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA,
+    0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2,
+    0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C,
+    0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xAD, 0x29, 0xCA, 0xD2, 0x9C, 0xA7,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x97, 0x5F, 0xFD,
+    0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x1A, 0xC2, 0xD1, 0xAC, 0xA1, 0xD9, 0x09, 0xD1, 0xAD,
+    0x29, 0x20, 0x09, 0xD1, 0xAD, 0x1D, 0x91, 0xD1, 0x9C, 0xA1, 0xAC, 0x92, 0x92, 0x1D, 0x91, 0xD1,
+    0x9D, 0x1A, 0xCA, 0x1D, 0x2C, 0xA2, 0x92, 0xAD, 0x19, 0xD2, 0xD9, 0x1A, 0xC9, 0x19, 0xCA, 0x2D,
+    0x39, 0x00, 0x1A, 0xC2, 0xC9, 0x1C, 0xA1, 0xAC, 0x90, 0xAC, 0xA1, 0xD1, 0xD9, 0x09, 0xD0, 0x9D,
+    0x1A, 0xCA, 0x0A, 0xD1, 0xDA, 0x19, 0x29, 0x91, 0x09, 0xD1, 0xD9, 0x0A, 0xCA, 0x1D, 0x90, 0xD9,
+    0x09, 0xD1, 0xD1, 0x9C, 0xA0, 0x9C, 0xA1, 0xAC, 0x90, 0xAC, 0x2D, 0x29, 0x29, 0x20, 0x1D, 0x90,
+    0x9D, 0x2D, 0x1A, 0xD1, 0x9D, 0x1D, 0xA1, 0xAC, 0xA1, 0xD2, 0xD2, 0xCA, 0x2C, 0xA1, 0x9C, 0x92,
+    0x93, 0x92, 0xAC, 0xA1, 0xD9, 0x09, 0xD1, 0xDA, 0x1D, 0x19, 0xD1, 0xAC, 0x91, 0xD1, 0x9C, 0xA1,
+    0xAC, 0x91, 0xD1, 0x9C, 0x92, 0x92, 0x90, 0x3D, 0x97, 0xD9, 0x7A, 0xC7, 0x0A, 0xC7, 0x09, 0xC4,
+    0x9F, 0xFC, 0x09, 0xCA, 0xAA, 0xCA, 0xAD, 0x49, 0xC7, 0x09, 0xC7, 0x09, 0xC7, 0x0A, 0xC7, 0x0A,
+    0xC7, 0x0A, 0xC7, 0x0A, 0xC9, 0x7A, 0xC9, 0x7D, 0x97, 0xD9, 0x7D, 0x97, 0xDA, 0x30, 0x3D, 0xA7,
+    0xAC, 0x97, 0xAC, 0x97, 0x9C, 0x49, 0xAA, 0x9A, 0xC9, 0x9A, 0xA0, 0xAF, 0xFC, 0x90, 0x91, 0x9C,
+    0x19, 0x94, 0xAC, 0x97, 0xAC, 0x97, 0xDA, 0x7A, 0xC9, 0x7A, 0xC5, 0x91, 0x9C, 0x19, 0x90, 0xAF,
+    0xFC, 0x99, 0xAA, 0x9A, 0xC9, 0x9A, 0xA4, 0x9C, 0x70, 0xAC, 0x97, 0xAC, 0x97, 0xDA, 0x30, 0x79,
+    0xEA, 0x1F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC2, 0xAD, 0x90, 0x9A, 0x59, 0xD9, 0x39, 0xF9,
+    0x19, 0xFC, 0xA0, 0x9F, 0xA1, 0x9E, 0x39, 0xC9, 0x74, 0x4D, 0x99, 0xE0, 0xDA, 0x19, 0x00, 0x73,
+    0xDA, 0x3D, 0x90, 0xE2, 0x9D, 0xA0, 0xDA, 0x29, 0xD9, 0x19, 0x59, 0x00, 0x77, 0x1D, 0xA2, 0x9D,
+    0x3A, 0xCA, 0x0E, 0x2A, 0xD9, 0x2E, 0x0D, 0xA2, 0x9D, 0x92, 0xE1, 0x94, 0x95, 0x90, 0x4D, 0xA0,
+    0xE0, 0xDA, 0x19, 0x00, 0x6A, 0xFC, 0x9A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A,
+    0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA7,
+    0x30, 0x69, 0xFC, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4,
+    0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x4A, 0xA4, 0xAA, 0x60, 0x5F, 0xFF,
+    0xFF, 0xFF, 0xD1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5F, 0xCA, 0xC4, 0xC4, 0xC4, 0xFD,
+    0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFC, 0x4C, 0x4C, 0x4F, 0xE1, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x70, 0x77, 0x75, 0xEA, 0x6A, 0xC7, 0x5D, 0xAA, 0xCA, 0x49, 0xCA, 0x74, 0x9C,
+    0x91, 0xAC, 0x4D, 0x75, 0xAC, 0x29, 0xC9, 0x29, 0xC9, 0x75, 0xAC, 0x3C, 0xA2, 0xD7, 0x6D, 0x3C,
+    0xA1, 0xAC, 0x97, 0x6A, 0xC3, 0xCA, 0x1D, 0x77, 0xAC, 0x29, 0xC9, 0x0A, 0xC1, 0xAD, 0xA3, 0x9E,
+    0x91, 0x9C, 0xA1, 0xAC, 0x09, 0xCA, 0x0D, 0xAD, 0xA1, 0x9D, 0xAD, 0x2D, 0xAA, 0xD0, 0xD0, 0x9C,
+    0xA1, 0xD1, 0xD2, 0xCA, 0x2E, 0xA0, 0x9C, 0xA0, 0xAC, 0x29, 0xC9, 0x0D, 0x2D, 0x7D, 0x1D, 0x29,
+    0xC9, 0x0C, 0xA2, 0xAC, 0x69, 0xC9, 0x1D, 0x29, 0xCA, 0x0C, 0xA2, 0xAC, 0x6D, 0x2D, 0x29, 0xCA,
+    0x0C, 0xA2, 0xAC, 0x5A, 0xC9, 0x2A, 0xC2, 0x9C, 0x90, 0xD2, 0xD5, 0xD3, 0x9C, 0x91, 0xAC, 0x1D,
+    0x2D, 0x4A, 0xC5, 0xD9, 0xAD, 0x19, 0xCA, 0x9D, 0x93, 0x9C, 0xA5, 0x9F, 0x3A, 0xEA, 0x77, 0x75,
+    0x77, 0x77, 0x6E, 0xA6, 0xAC, 0x77, 0x6D, 0xAA, 0xD5, 0xCA, 0x77, 0x59, 0xCA, 0x1A, 0xC9, 0x3D,
+    0x77, 0x6A, 0xC2, 0x9C, 0xA2, 0x9C, 0xA7, 0x76, 0xD3, 0xCA, 0x2D, 0x77, 0x7D, 0x3C, 0xA1, 0x9C,
+    0x97, 0x77, 0xD2, 0x9C, 0xA1, 0xD7, 0x77, 0x0A, 0xC2, 0x9C, 0xA0, 0xAC, 0x90, 0xAD, 0xA4, 0xAD,
+    0xA3, 0x9E, 0x91, 0x9C, 0xA1, 0xAC, 0x90, 0xD0, 0xAF, 0xC2, 0xFC, 0xA2, 0xFC, 0x91, 0xDA, 0xAD,
+    0x0A, 0xC1, 0xD1, 0xAC, 0x90, 0x9C, 0xA1, 0xD1, 0xAC, 0x91, 0xD2, 0xEA, 0x1C, 0xA0, 0x9C, 0x92,
+    0xD0, 0xAC, 0x29, 0xCA, 0x0D, 0x2A, 0xC7, 0xAC, 0x1A, 0xC9, 0x2D, 0x0D, 0x29, 0xCA, 0x0D, 0x2A,
+    0xC9, 0x59, 0xCA, 0x1A, 0xC9, 0x2D, 0x0D, 0x3C, 0xA0, 0xD2, 0x9C, 0x95, 0xD2, 0xAC, 0x92, 0xD0,
+    0xD2, 0x9C, 0xA0, 0xD2, 0xAC, 0x94, 0x9C, 0x92, 0x9C, 0x92, 0xD0, 0xAC, 0x29, 0xCA, 0x0D, 0x2A,
+    0xC9, 0x4D, 0x4C, 0xA1, 0x9C, 0xA0, 0x9C, 0x91, 0xAC, 0x90, 0xD2, 0xD4, 0xAC, 0x94, 0xDA, 0x9D,
+    0x2D, 0x9A, 0xD1, 0x9D, 0x9A, 0xCA, 0x4D, 0x6F, 0x92, 0x9F, 0x3A, 0xF7, 0x77, 0x76, 0x3D, 0x39,
+    0xCA, 0x3D, 0x39, 0xC9, 0x3C, 0xA3, 0x9C, 0x4A, 0x93, 0x3D, 0x1A, 0xCA, 0x29, 0xCA, 0x1D, 0x3D,
+    0x1A, 0xC9, 0x29, 0xC9, 0x1D, 0x3C, 0xA1, 0xAC, 0x39, 0xC2, 0xCA, 0x3A, 0x91, 0x9A, 0x30, 0x3D,
+    0x1A, 0xC9, 0x1D, 0x39, 0xCA, 0x1D, 0x1A, 0xC9, 0x3D, 0x1A, 0xC9, 0x1D, 0x39, 0xC9, 0x1D, 0x1A,
+    0xC4, 0xCA, 0x1A, 0xC2, 0xCA, 0x39, 0xC2, 0xCA, 0x1A, 0xC4, 0xA9, 0x19, 0xA2, 0xA4, 0x9C, 0xA3,
+    0xD9, 0x3D, 0x3A, 0xC9, 0x3D, 0x39, 0xC9, 0x39, 0x90, 0x9C, 0xA0, 0x9C, 0xA3, 0xD9, 0x0A, 0xC9,
+    0x3D, 0x1D, 0x3A, 0xC9, 0x09, 0xC9, 0x3D, 0x1D, 0x39, 0xC9, 0x1C, 0x93, 0x99, 0x19, 0x90, 0x9C,
+    0xA0, 0x9C, 0xA1, 0xD3, 0xD9, 0x0A, 0xC9, 0x0A, 0xC9, 0x3D, 0x1D, 0x1D, 0x3A, 0xC9, 0x09, 0xC9,
+    0x09, 0xC9, 0x3D, 0x1D, 0x1D, 0x39, 0xC9, 0x1C, 0x91, 0xC9, 0x39, 0x91, 0x99, 0x19, 0x90, 0x75,
+    0xD6, 0x9D, 0x95, 0xCA, 0xAC, 0x49, 0xC1, 0xC9, 0x3C, 0xA1, 0xAA, 0x29, 0xC9, 0x2C, 0x2D, 0x3C,
+    0xA0, 0x9C, 0x93, 0x9C, 0x00, 0x3A, 0x3D, 0x91, 0xAC, 0xA1, 0xAD, 0x19, 0xD2, 0xD9, 0x3D, 0x39,
+    0xD3, 0xAD, 0x3A, 0xCA, 0x39, 0x00, 0x1A, 0x4A, 0xCA, 0x4D, 0x94, 0xD9, 0x39, 0xD4, 0xAC, 0xA2,
+    0x9D, 0x29, 0xD3, 0xD9, 0x2D, 0x94, 0x93, 0x77, 0x39, 0x5A, 0xC9, 0x59, 0x1D, 0x4D, 0xA4, 0xD1,
+    0x9D, 0x3A, 0xC9, 0x3D, 0x39, 0xD7, 0x0D, 0x94, 0x9D, 0x6D, 0x96, 0x9D, 0x4D, 0x97, 0x09, 0xD2,
+    0xD9, 0x59, 0x39, 0xD9, 0xD9, 0x39, 0x0A, 0xD3, 0x9E, 0x93, 0xDA, 0xAD, 0x4E, 0x4D, 0xA0, 0xA9,
+    0x3D, 0xAD, 0x39, 0xA6, 0xD9, 0x09, 0xD7, 0x2D, 0x92, 0x9D, 0x70, 0xD9, 0x49, 0xD6, 0xD9, 0x69,
+    0xD4, 0xD9, 0x29, 0xA3, 0x9D, 0x2D, 0x93, 0xDA, 0x39, 0xD1, 0xA9, 0x4D, 0xA4, 0x9A, 0x71, 0x97,
+    0x00, 0x0D, 0xA2, 0xD9, 0x0D, 0xA2, 0xD9, 0x0D, 0xA2, 0xD9, 0x0D, 0xA2, 0xD9, 0x0D, 0x92, 0xD1,
+    0xAC, 0x92, 0xD1, 0xAC, 0x92, 0xD1, 0xAC, 0x92, 0xD1, 0xAC, 0x92, 0xD1, 0xAC, 0x3D, 0x19, 0xC3,
+    0xAC, 0x19, 0xC3, 0xAC, 0x19, 0xC3, 0xAC, 0x77, 0x5D, 0xA2, 0xD9, 0x0E, 0x19, 0xDA, 0x0D, 0xA1,
+    0x9D, 0x91, 0x94, 0x90, 0x73, 0x9A, 0xFC, 0x91, 0x9F, 0xAA, 0xD9, 0x19, 0x0D, 0x91, 0xD3, 0xAC,
+    0x91, 0xAC, 0x92, 0xAC, 0x91, 0xAC, 0x92, 0xAC, 0x91, 0xD3, 0xAC, 0x90, 0x9D, 0x3A, 0xC0, 0x9D,
+    0x4A, 0xCA, 0xD5, 0x9E, 0x69, 0xD7, 0x9C, 0xA7, 0x9C, 0x97, 0x77, 0x59, 0xC9, 0x7E, 0x7A, 0xD7,
+    0x09, 0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xA0, 0x77, 0xC7, 0x2C, 0x90,
+    0xAA, 0x70, 0xAC, 0x2D, 0x6A, 0xC4, 0xDA, 0x99, 0x9A, 0xD6, 0x9A, 0xF9, 0x30, 0x4A, 0xAC, 0xAA,
+    0x96, 0xAD, 0xAA, 0xAE, 0x4A, 0xC9, 0x5D, 0x2A, 0xC7, 0x0A, 0xC1, 0xC7, 0x2C, 0x97, 0x60, 0x77,
+    0xCA, 0x59, 0xC9, 0x5A, 0xC6, 0xC9, 0x5A, 0xC6, 0xCA, 0x59, 0xC6, 0xCA, 0x59, 0xC9, 0x5D, 0xA5,
+    0xCA, 0xC4, 0xAC, 0x0C, 0x93, 0xC9, 0x0A, 0xC2, 0xAC, 0x2C, 0x91, 0xCA, 0x2A, 0xA0, 0x9C, 0x39,
+    0xC0, 0x74, 0xD7, 0x77, 0x1D, 0x77, 0x71, 0xD7, 0x74, 0x99, 0x2D, 0x29, 0x77, 0x0A, 0xDA, 0x9D,
+    0x9A, 0xDA, 0x77, 0xAF, 0xFD, 0xA7, 0x73, 0xAD, 0xA7, 0x76, 0x9C, 0xAD, 0x97, 0x75, 0xD0, 0x9D,
+    0x77, 0x4E, 0x1E, 0x77, 0x39, 0xC9, 0x19, 0xC9, 0x76, 0xAA, 0x97, 0x39, 0xAA, 0x71, 0xD9, 0x73,
+    0x9C, 0xA7, 0x1D, 0x74, 0x9C, 0xA7, 0x1A, 0xC7, 0x5C, 0xA4, 0x9D, 0x90, 0xAC, 0x09, 0xAD, 0x3D,
+    0xA9, 0x0C, 0x90, 0xAD, 0x9A, 0xFF, 0xE3, 0xFF, 0xE9, 0x29, 0xAE, 0x97, 0x09, 0x9E, 0x99, 0x6D,
+    0xAC, 0x97, 0x19, 0xCA, 0xCA, 0x6A, 0xCA, 0x0D, 0x71, 0xD0, 0xAC, 0xA4, 0x9D, 0x1A, 0xD7, 0xDA,
+    0x1D, 0x93, 0xAC, 0xA2, 0xD7, 0xD2, 0xD9, 0x71, 0x97, 0x19, 0x70, 0xAA, 0xAA, 0xAA, 0x0F, 0xD0,
+    0x99, 0x99, 0x99, 0x00, 0x72, 0xCA, 0x71, 0xAC, 0x71, 0x9C, 0xA7, 0x1D, 0x71, 0xAC, 0x97, 0x1C,
+    0xA7, 0x1A, 0xC7, 0x19, 0xCA, 0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xCA, 0x71, 0xD7, 0x19, 0xC9, 0x71,
+    0xD7, 0x1A, 0xC7, 0x19, 0xCA, 0x71, 0xD7, 0x19, 0xC9, 0x71, 0x0F, 0xC9, 0x0F, 0xC9, 0x0D, 0x4D,
+    0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4F, 0xC9, 0x0F, 0xC9, 0x0D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x4F, 0xC9, 0x0F, 0xC9, 0x9F, 0xC0, 0x9F, 0xC9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9,
+    0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x9F, 0xC9, 0x9F, 0xC9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9,
+    0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x9F, 0xC9, 0x9F, 0xC0, 0x77, 0x59, 0xAF, 0xA3, 0xAF, 0xCA,
+    0x1A, 0xFF, 0x90, 0xFF, 0xC1, 0xA9, 0x3A, 0xD0, 0x99, 0x39, 0xD9, 0x7D, 0x7A, 0xCA, 0x7D, 0x79,
+    0xCA, 0x7D, 0x7A, 0xCA, 0x6A, 0xCA, 0x7D, 0x6A, 0xD6, 0x9D, 0x95, 0xE6, 0x9D, 0x95, 0xDA, 0x7D,
+    0x95, 0x9D, 0x7A, 0xC9, 0x69, 0xC9, 0x7D, 0x79, 0xC9, 0x7D, 0x77, 0x77, 0x77, 0x1A, 0xCA, 0x7D,
+    0x7E, 0x6A, 0xDA, 0x6E, 0x69, 0xD9, 0x79, 0x77, 0x77, 0x09, 0xAF, 0xA3, 0xAD, 0x0A, 0xFF, 0x91,
+    0xAD, 0x1A, 0x93, 0xAD, 0x1A, 0xD7, 0x0D, 0x1A, 0xD7, 0x0D, 0x1A, 0xCA, 0x70, 0xD1, 0x9C, 0xA7,
+    0xAC, 0xA1, 0x9C, 0xA6, 0xAD, 0x29, 0xCA, 0x5E, 0x39, 0xCA, 0x4D, 0xA4, 0x9C, 0x93, 0x9D, 0x6C,
+    0x93, 0x9C, 0x96, 0xC9, 0x39, 0xC9, 0x6C, 0x97, 0x77, 0x73, 0xAC, 0xA5, 0xAC, 0xA3, 0xE5, 0xE3,
+    0xE5, 0xE4, 0x97, 0x91, 0x77, 0x0D, 0xA1, 0x9A, 0xFC, 0x92, 0xDA, 0x09, 0xFF, 0x91, 0xDA, 0x1A,
+    0x93, 0xAD, 0x1D, 0xA7, 0x0D, 0x90, 0xD9, 0x70, 0xAC, 0x90, 0xAC, 0x97, 0x0D, 0x90, 0xAC, 0x97,
+    0xAD, 0x1A, 0xC9, 0x6A, 0xD2, 0xAC, 0x95, 0xAD, 0x3A, 0xC5, 0xAD, 0x49, 0xC5, 0xD5, 0x9C, 0x49,
+    0xCA, 0x59, 0xC4, 0x9C, 0x97, 0x77, 0x75, 0xDA, 0x39, 0xD5, 0xE3, 0xE5, 0xDA, 0x3A, 0xD6, 0x95,
+    0x95, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xF0, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xCA,
+    0x71, 0xD7, 0x1D, 0x97, 0x09, 0xCA, 0x71, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0x71, 0xD9, 0x70, 0xAC,
+    0xA7, 0x1D, 0x71, 0xDA, 0x70, 0x9D, 0x60, 0xAF, 0xFA, 0x2A, 0xC9, 0x9F, 0xE9, 0x0A, 0xC1, 0xAF,
+    0xE0, 0xAC, 0x1A, 0xFE, 0x9A, 0xC1, 0xAF, 0xEA, 0xAC, 0x1A, 0xFE, 0xAA, 0xC1, 0xAF, 0xEA, 0xAC,
+    0x1A, 0xFE, 0xAA, 0xC1, 0xAF, 0xE9, 0xAC, 0x1A, 0xFE, 0x0A, 0xC1, 0xAF, 0xDA, 0x0A, 0xC1, 0xAF,
+    0xCA, 0x1A, 0xC1, 0xAC, 0x99, 0x93, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC,
+    0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A, 0xC6, 0xAC, 0x1A,
+    0xC7, 0x73, 0x39, 0x99, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xD0, 0xAF, 0xE9, 0x9D, 0x0F, 0xF1, 0xD9,
+    0xFF, 0x1D, 0xAF, 0xF1, 0xDA, 0xFF, 0x1D, 0xAF, 0xF1, 0xDA, 0xFF, 0x1D, 0x9F, 0xF1, 0xD0, 0xFF,
+    0x1D, 0x09, 0xFE, 0xAA, 0xD1, 0x9A, 0xFF, 0xC7, 0x40, 0x99, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xDA,
+    0x1D, 0x99, 0xFE, 0xA0, 0xCA, 0x1F, 0xF0, 0xCA, 0x1F, 0xF9, 0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xFA,
+    0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xFA, 0xCA, 0x1F, 0xF9, 0xCA, 0x1F, 0xF0, 0xDA, 0xAF, 0xE9, 0x0F,
+    0xFC, 0xA7, 0x70, 0x39, 0xD7, 0x1D, 0x71, 0xD4, 0x93, 0xCA, 0x29, 0x0E, 0xA9, 0xCA, 0x9E, 0xAA,
+    0xFF, 0xDA, 0x3E, 0x96, 0x9C, 0xAD, 0x6D, 0x09, 0xD4, 0xDA, 0x1D, 0xA3, 0xAC, 0x29, 0xC9, 0x75,
+    0x9A, 0xA1, 0xE1, 0xE2, 0xA9, 0x77, 0x77, 0x49, 0xD1, 0x9D, 0x2D, 0x91, 0xAC, 0xA2, 0xD2, 0xD5,
+    0x4A, 0xAC, 0xAA, 0x96, 0xAD, 0xAA, 0xAE, 0x4A, 0xC9, 0x5D, 0x2A, 0xC7, 0x0A, 0xC1, 0xC7, 0x2C,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0xC7, 0x2C, 0x90, 0xAA, 0x70, 0xAC, 0x2D, 0x6A, 0xC4, 0xDA, 0x99, 0x9A, 0xD6, 0x9A, 0xF9, 0x30,
+    0x39, 0xD7, 0x1D, 0x71, 0xD4, 0x93, 0xCA, 0x29, 0x0E, 0xA9, 0xCA, 0x9E, 0xAA, 0xFF, 0xDA, 0x3E,
+    0x96, 0x9C, 0xAD, 0x6D, 0x09, 0xD4, 0xDA, 0x1D, 0xA3, 0xAC, 0x29, 0xC9, 0x77, 0x75, 0x9D, 0x71,
+    0xD7, 0x1D, 0x49, 0x3C, 0xA2, 0x90, 0xEA, 0x9C, 0xA9, 0xEA, 0xAF, 0xFD, 0xA3, 0xE9, 0x69, 0xCA,
+    0xD6, 0xD0, 0x9D, 0x4D, 0xA1, 0xDA, 0x3A, 0xC2, 0x9C, 0x97, 0x50, 0x71, 0xAD, 0x3D, 0x0E, 0x29,
+    0xCA, 0x09, 0xCA, 0x2A, 0xC7, 0xD6, 0xAC, 0x96, 0xD6, 0x9C, 0xA6, 0xAC, 0x7D, 0x69, 0xC9, 0x6D,
+    0x69, 0xCA, 0x6A, 0xC9, 0x6D, 0x69, 0xC9, 0x6D, 0x29, 0xCA, 0x1C, 0xA2, 0xAD, 0x0A, 0xC9, 0x2A,
+    0xD7, 0x20, 0x49, 0x97, 0x71, 0x9F, 0xEA, 0x97, 0xAC, 0x2D, 0x99, 0x9A, 0xFC, 0xA9, 0x3A, 0xC9,
+    0x1A, 0xC6, 0x9A, 0xFF, 0xA2, 0xA7, 0x39, 0xAA, 0xAA, 0x30, 0x59, 0x99, 0x97, 0x9F, 0xE9, 0x49,
+    0xCA, 0x49, 0xCA, 0x29, 0xC9, 0x7C, 0xA1, 0xC9, 0x71, 0xC9, 0x0A, 0x72, 0x90, 0x59, 0xA7, 0x3A,
+    0xC7, 0xAC, 0x1A, 0xC1, 0xAC, 0x39, 0xD0, 0xAC, 0x0A, 0xC9, 0x49, 0xFA, 0xC9, 0x69, 0xFA, 0x39,
+    0xFF, 0xF9, 0x0A, 0xAA, 0xAF, 0xAA, 0xAA, 0x4A, 0xFC, 0x6A, 0xC9, 0xAC, 0x9D, 0x4A, 0xC9, 0x0A,
+    0xC0, 0x9D, 0x49, 0x1A, 0xC1, 0x99, 0x7A, 0xC7, 0x73, 0x77, 0x2D, 0x96, 0x9D, 0xA7, 0xAA, 0x77,
+    0x77, 0x75, 0x97, 0x0A, 0xD7, 0xAD, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x73, 0x9A, 0x70, 0xDA, 0x7D,
+    0x97, 0x99, 0x00, 0x3D, 0x1A, 0xC9, 0x09, 0xCA, 0x1D, 0x39, 0xCA, 0x1D, 0x1D, 0x1A, 0xC9, 0x3D,
+    0x1A, 0xC1, 0x9C, 0x91, 0xCA, 0x39, 0xC9, 0x1C, 0xA1, 0xD1, 0xAC, 0x4C, 0xA1, 0xAC, 0x19, 0xC2,
+    0xC9, 0x39, 0xC2, 0xC9, 0x1C, 0xA1, 0xAC, 0x4A, 0x91, 0x9A, 0x2A, 0x2A, 0x40, 0x77, 0x72, 0xD9,
+    0x76, 0x9D, 0xA7, 0x7A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0x97, 0x59, 0x1A, 0xD7, 0x3A, 0xD0,
+    0xAD, 0x73, 0xAD, 0x1A, 0x97, 0x4A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0x77, 0x0D, 0xA7,
+    0x7D, 0x97, 0x79, 0x97, 0x00, 0x77, 0x29, 0xD7, 0x39, 0xD0, 0xAD, 0x73, 0x9D, 0x90, 0xAA, 0x74,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xA7, 0x70, 0xDA, 0x77, 0xDA, 0x77, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x5A, 0x97, 0x4A, 0x90, 0xAD, 0x73, 0xAD, 0x0A, 0xD7, 0x3A, 0xD1, 0x97, 0x59,
+    0x10, 0x39, 0xD0, 0xAD, 0x09, 0xD7, 0x77, 0x77, 0x71, 0xCA, 0x0A, 0xD0, 0x9D, 0x40, 0x5A, 0xA7,
+    0x39, 0xD9, 0x73, 0xD9, 0x74, 0x97, 0x77, 0x77, 0x77, 0x73, 0xAA, 0x79, 0xA9, 0x0A, 0xD7, 0xE0,
+    0xAD, 0x7A, 0xD1, 0x97, 0x19, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xA7, 0x39, 0xD9, 0x73, 0xD9, 0x77,
+    0x40, 0x70, 0x99, 0x77, 0x0D, 0x77, 0x0D, 0x72, 0xDA, 0x2D, 0x2A, 0xD4, 0xE2, 0xD2, 0xE4, 0xAC,
+    0x92, 0xD2, 0x9C, 0x97, 0x2D, 0x77, 0x0D, 0x77, 0x0D, 0x70, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xD7,
+    0x0D, 0x77, 0x0D, 0x77, 0x0D, 0x72, 0x9A, 0x3D, 0x29, 0xA5, 0xDA, 0x2D, 0x2D, 0xA4, 0xDA, 0x2D,
+    0x2D, 0xA5, 0x93, 0xD3, 0x97, 0x3D, 0x77, 0x0A, 0x97, 0x19, 0x1E, 0x0E, 0x0A, 0xC9, 0x77, 0x0D,
+    0xA0, 0xE0, 0xDA, 0x77, 0x0D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x4D, 0xA0, 0xE0, 0xDA, 0x19, 0x5D,
+    0xA0, 0xE0, 0xDA, 0x19, 0x5D, 0xA0, 0xE0, 0xDA, 0x19, 0x5D, 0xA0, 0xE0, 0xDA, 0x19, 0x00, 0x5A,
+    0xFA, 0x1A, 0xA3, 0xAA, 0x3A, 0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5F, 0xE3,
+    0xD3, 0xD3, 0xFE, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x5A, 0xFA, 0x0F, 0x19, 0xD9, 0x2D,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x79, 0x93, 0xD2, 0xAD, 0xA1, 0xF0, 0xAF,
+    0xA1, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x7D, 0x2C, 0x99, 0xC0, 0xAA, 0x1A, 0xA0, 0xAA,
+    0xAA, 0x2A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x70, 0x5A, 0xDA, 0x3A, 0xA3, 0xAA, 0x3A,
+    0xA1, 0xFD, 0x1A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3,
+    0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA3, 0xAA, 0x3A, 0xA7, 0x39, 0x5F, 0xA2, 0xDA, 0x9A, 0xC9, 0x1C,
+    0xA2, 0xD0, 0x9C, 0x92, 0xAC, 0x0A, 0xC9, 0x2A, 0xC0, 0xAC, 0x92, 0xAC, 0x09, 0xC9, 0x2A, 0xC0,
+    0x9C, 0xA2, 0xD1, 0xD1, 0x9C, 0xA1, 0x9F, 0xC3, 0x9A, 0xCA, 0x20, 0x1A, 0xC0, 0x91, 0xAC, 0xAC,
+    0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0x74, 0x9D, 0x5E, 0x4A, 0xE3, 0x9C, 0x0D, 0x3C, 0xA0, 0xD2,
+    0xD1, 0xD1, 0x9C, 0x99, 0x9D, 0x90, 0xFF, 0xA4, 0xD6, 0xD6, 0xAA, 0x10, 0x70, 0xAF, 0xC9, 0x0A,
+    0xC9, 0x99, 0x91, 0xCA, 0x5C, 0xA5, 0xFC, 0xA1, 0x99, 0x99, 0xDA, 0x5D, 0x5D, 0x5D, 0x9D, 0xAA,
+    0xD9, 0x09, 0xAD, 0xA1, 0x49, 0x93, 0x9F, 0x91, 0x9D, 0x94, 0xD6, 0xC9, 0x09, 0x39, 0xCA, 0xF9,
+    0x09, 0xD9, 0x09, 0xD0, 0x9C, 0x92, 0x9C, 0x09, 0xC9, 0x29, 0xC9, 0x0D, 0x2D, 0x19, 0xDA, 0xDA,
+    0x29, 0xAC, 0xA9, 0x10, 0x70, 0x9F, 0xE1, 0x99, 0x99, 0x9D, 0x59, 0xC9, 0x5D, 0x6C, 0xA5, 0xAC,
+    0x6C, 0xA5, 0xAC, 0x6D, 0x5A, 0xC9, 0x5A, 0xA4, 0x39, 0x5F, 0xC2, 0xD9, 0x09, 0xCA, 0x1C, 0xA2,
+    0xD1, 0xD9, 0x09, 0xCA, 0x2F, 0xA3, 0xFC, 0x2D, 0x19, 0xD0, 0x9C, 0x92, 0xAC, 0x09, 0xCA, 0x2D,
+    0x1D, 0xAA, 0xDA, 0x29, 0xAC, 0xA9, 0x10, 0x29, 0x94, 0x9F, 0xA2, 0xD1, 0x9C, 0xA0, 0x9C, 0x3A,
+    0xC0, 0xAC, 0x3A, 0xC0, 0x9C, 0x92, 0xD1, 0xDA, 0xAE, 0x2A, 0xAA, 0x9A, 0xC6, 0xD5, 0xAC, 0x91,
+    0xAA, 0xAD, 0xA2, 0x9D, 0xA9, 0x20, 0x39, 0x59, 0xC5, 0x9C, 0x3A, 0xAA, 0xCA, 0xA9, 0x0F, 0xD9,
+    0x29, 0xC5, 0x9C, 0x69, 0x20, 0x0A, 0xAA, 0xAA, 0xA9, 0x0F, 0xD9, 0x0F, 0xDA, 0x09, 0x99, 0x99,
+    0x97, 0x1F, 0xDA, 0x70, 0x19, 0xA2, 0xCA, 0x1A, 0xC2, 0xCA, 0x2C, 0x91, 0x9C, 0x29, 0xC2, 0x9C,
+    0x29, 0xC3, 0xC9, 0x2C, 0xA2, 0xAC, 0x3C, 0xA2, 0x9A, 0x00, 0x9A, 0x3C, 0xA2, 0x9C, 0x3C, 0xA2,
+    0xD2, 0xAC, 0x29, 0xC2, 0x9C, 0x2A, 0xC2, 0xAC, 0x2C, 0xA1, 0x9C, 0x2C, 0xA1, 0x9A, 0x20, 0x39,
+    0x91, 0xAA, 0xFC, 0x0A, 0xC9, 0x2C, 0xAA, 0xC3, 0xAA, 0xAC, 0x3A, 0xAA, 0xC3, 0xAA, 0xAC, 0x3A,
+    0xAA, 0xC3, 0xAA, 0xAA, 0x3A, 0xA0, 0x39, 0x5F, 0xA2, 0xDA, 0x9A, 0xC9, 0x1C, 0xA2, 0xD0, 0x9C,
+    0x92, 0xAC, 0x0A, 0xC9, 0x2A, 0xC0, 0xAC, 0x92, 0xAC, 0x09, 0xC9, 0x2A, 0xC0, 0x9C, 0xA2, 0xD1,
+    0xD1, 0x9C, 0xA1, 0x9F, 0xC3, 0x9A, 0xCA, 0x20, 0x70, 0xAD, 0x1F, 0x0D, 0x0A, 0xC3, 0xD3, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x9A, 0x29, 0x93, 0xAF, 0xA1, 0xCA, 0x1A, 0xC9, 0x5C, 0xA5, 0xCA,
+    0x4A, 0xC4, 0xAC, 0x93, 0xAC, 0x93, 0xAC, 0x93, 0xAC, 0x93, 0x9F, 0xDA, 0x0A, 0xAA, 0xAA, 0xA9,
+    0x29, 0x94, 0xAF, 0xA2, 0xC9, 0x1A, 0xCA, 0x6C, 0xA5, 0x9C, 0x92, 0xAA, 0xDA, 0x3A, 0xF7, 0xD6,
+    0xD6, 0xD0, 0xAD, 0xAA, 0xD9, 0x1A, 0xAD, 0xA2, 0x74, 0x9D, 0x5E, 0x4A, 0xE3, 0x9C, 0x0D, 0x3C,
+    0xA0, 0xD2, 0xD1, 0xD1, 0x9C, 0x99, 0x9D, 0x90, 0xFF, 0xA4, 0xD6, 0xD6, 0xAA, 0x10, 0x70, 0xAF,
+    0xC9, 0x0A, 0xC9, 0x99, 0x91, 0xCA, 0x5C, 0xA5, 0xFC, 0xA1, 0x99, 0x99, 0xDA, 0x5D, 0x5D, 0x5D,
+    0x9D, 0xAA, 0xD9, 0x09, 0xAD, 0xA1, 0x49, 0x93, 0x9F, 0x91, 0x9D, 0x94, 0xD6, 0xC9, 0x09, 0x39,
+    0xCA, 0xF9, 0x09, 0xD9, 0x09, 0xD0, 0x9C, 0x92, 0x9C, 0x09, 0xC9, 0x29, 0xC9, 0x0D, 0x2D, 0x19,
+    0xDA, 0xDA, 0x29, 0xAC, 0xA9, 0x10, 0x70, 0x9F, 0xE1, 0x99, 0x99, 0x9D, 0x59, 0xC9, 0x5D, 0x6C,
+    0xA5, 0xAC, 0x6C, 0xA5, 0xAC, 0x6D, 0x5A, 0xC9, 0x5A, 0xA4, 0x39, 0x5F, 0xC2, 0xD9, 0x09, 0xCA,
+    0x1C, 0xA2, 0xD1, 0xD9, 0x09, 0xCA, 0x2F, 0xA3, 0xFC, 0x2D, 0x19, 0xD0, 0x9C, 0x92, 0xAC, 0x09,
+    0xCA, 0x2D, 0x1D, 0xAA, 0xDA, 0x29, 0xAC, 0xA9, 0x10, 0x29, 0x94, 0x9F, 0xA2, 0xD1, 0x9C, 0xA0,
+    0x9C, 0x3A, 0xC0, 0xAC, 0x3A, 0xC0, 0x9C, 0x92, 0xD1, 0xDA, 0xAE, 0x2A, 0xAA, 0x9A, 0xC6, 0xD5,
+    0xAC, 0x91, 0xAA, 0xAD, 0xA2, 0x9D, 0xA9, 0x20, 0x39, 0x59, 0xC5, 0x9C, 0x3A, 0xAA, 0xCA, 0xA9,
+    0x0F, 0xD9, 0x29, 0xC5, 0x9C, 0x69, 0x20, 0x0A, 0xAA, 0xAA, 0xA9, 0x0F, 0xD9, 0x0F, 0xDA, 0x09,
+    0x99, 0x99, 0x97, 0x1F, 0xDA, 0x70, 0x19, 0xA2, 0xCA, 0x1A, 0xC2, 0xCA, 0x2C, 0x91, 0x9C, 0x29,
+    0xC2, 0x9C, 0x29, 0xC3, 0xC9, 0x2C, 0xA2, 0xAC, 0x3C, 0xA2, 0x9A, 0x00, 0x9A, 0x3C, 0xA2, 0x9C,
+    0x3C, 0xA2, 0xD2, 0xAC, 0x29, 0xC2, 0x9C, 0x2A, 0xC2, 0xAC, 0x2C, 0xA1, 0x9C, 0x2C, 0xA1, 0x9A,
+    0x20, 0x19, 0xAC, 0xA9, 0x2A, 0x99, 0x9C, 0x95, 0xAC, 0x29, 0x99, 0xD0, 0x9C, 0xAA, 0xAD, 0x0C,
+    0x92, 0xAC, 0x0C, 0x92, 0xD0, 0xDA, 0xAC, 0xAC, 0x19, 0xA9, 0x19, 0x2A, 0xCA, 0x93, 0xCA, 0x99,
+    0xCA, 0x1C, 0xA2, 0x9C, 0x1C, 0xA9, 0x99, 0xAC, 0x90, 0xDA, 0xAA, 0xAA, 0x1C, 0xA6, 0xAC, 0x7D,
+    0xAA, 0xAC, 0x39, 0xAA, 0x91, 0x2A, 0xDA, 0x3C, 0xA9, 0x9D, 0x1D, 0x3C, 0xA0, 0xC9, 0x3A, 0xC0,
+    0xC9, 0x3A, 0xC0, 0xCA, 0x3A, 0xC0, 0xAC, 0x3C, 0xA1, 0xDA, 0xAC, 0xA3, 0x9A, 0xA9, 0x10, 0x0A,
+    0x39, 0xA1, 0xAC, 0x19, 0xC9, 0x2C, 0xA0, 0xCA, 0x4D, 0xA5, 0xD9, 0x49, 0xCA, 0xC3, 0x9C, 0x90,
+    0xAC, 0x2C, 0xA2, 0xCA, 0x19, 0x49, 0x00, 0x09, 0xAD, 0xA3, 0xAA, 0x99, 0xAC, 0x96, 0xAC, 0x69,
+    0xC1, 0xFE, 0x90, 0xC9, 0x29, 0xC1, 0xCA, 0x2A, 0xC1, 0x9C, 0xAA, 0xD4, 0x9A, 0x92, 0xAC, 0x5A,
+    0xC5, 0xAC, 0x5A, 0xC0, 0xAC, 0xA9, 0x0A, 0xD9, 0x9A, 0xC9, 0xAC, 0x3C, 0xAA, 0xC3, 0xAA, 0xAC,
+    0x3A, 0xAA, 0xC3, 0xAA, 0xAC, 0x3A, 0xAA, 0xC3, 0xAA, 0x99, 0x39, 0x90, 0xAC, 0x5A, 0xC5, 0xAC,
+    0x5A, 0xC2, 0x9A, 0x0A, 0xC1, 0xAC, 0x1A, 0xC0, 0xAC, 0x2A, 0xCA, 0xC3, 0xAE, 0x92, 0xAC, 0x0A,
+    0xC2, 0xAC, 0x1A, 0xC1, 0xAC, 0x2D, 0x09, 0x93, 0x90, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+    0xAC, 0xAC, 0xAC, 0xAC, 0x99, 0x99, 0x0A, 0xCA, 0x1A, 0xD9, 0x0A, 0xD9, 0x9E, 0xA9, 0x9C, 0xAA,
+    0xC3, 0xCA, 0x2A, 0xCA, 0xC3, 0xC9, 0x2A, 0xCA, 0xC3, 0xC9, 0x2A, 0xCA, 0xC3, 0xC9, 0x2A, 0xCA,
+    0xC3, 0xC9, 0x2A, 0xCA, 0xC3, 0xC9, 0x2A, 0xC9, 0x93, 0x94, 0x90, 0x99, 0x0A, 0xCA, 0x90, 0xAD,
+    0x99, 0xAC, 0x9A, 0xC3, 0xCA, 0xAC, 0x3A, 0xAA, 0xC3, 0xAA, 0xAC, 0x3A, 0xAA, 0xC3, 0xAA, 0xAC,
+    0x3A, 0xA9, 0x93, 0x99, 0x99, 0x0A, 0xCA, 0x2A, 0xD9, 0x9A, 0xC9, 0x0A, 0xC3, 0xD0, 0xAC, 0x39,
+    0xC0, 0xAC, 0x39, 0xC0, 0xAC, 0x3A, 0xC0, 0xAC, 0x92, 0xCA, 0x0A, 0xDA, 0xAD, 0x1A, 0xC0, 0x9A,
+    0x92, 0xAC, 0x6A, 0xC6, 0xAC, 0x60, 0x1A, 0xDA, 0x91, 0xCA, 0x99, 0xA9, 0x1C, 0x95, 0xAC, 0xA5,
+    0x9A, 0xD6, 0xD5, 0x9C, 0x1C, 0xAA, 0xAC, 0xA1, 0x99, 0xA9, 0x20, 0x19, 0x39, 0xC2, 0x9D, 0xAA,
+    0x99, 0xAC, 0x99, 0x1A, 0xC3, 0xAC, 0x3A, 0xC3, 0xAC, 0x39, 0xC4, 0xDA, 0x92, 0x9A, 0x00, 0x77,
+    0x09, 0xFC, 0x95, 0xAD, 0xAA, 0xD5, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x39, 0x99, 0x99,
+    0x91, 0xD3, 0xFD, 0x90, 0xD3, 0xD5, 0xD9, 0x2D, 0x5A, 0xD2, 0xD6, 0xE9, 0x9D, 0x99, 0x99, 0x3A,
+    0xFF, 0xC5, 0x99, 0xD9, 0x99, 0x97, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0xAA, 0xAA, 0x7F, 0xD9, 0x5A,
+    0xC1, 0xCA, 0x6C, 0xA1, 0xC9, 0x5A, 0xFC, 0xA3, 0xAF, 0xFA, 0x1F, 0xC1, 0xDA, 0x1A, 0xD0, 0xAC,
+    0x1C, 0xA2, 0xD9, 0x0C, 0xA1, 0xC9, 0x19, 0xD1, 0xCA, 0x09, 0xC2, 0xAC, 0xA0, 0x9C, 0x90, 0xAC,
+    0x2A, 0xCA, 0x09, 0xC1, 0xCA, 0x2A, 0xC9, 0x0A, 0xC1, 0xCA, 0x2A, 0xCA, 0x0C, 0xA1, 0xC9, 0x29,
+    0xD0, 0xCA, 0x09, 0xC4, 0xD9, 0xC9, 0x0A, 0xC4, 0xF1, 0xCA, 0x49, 0xE1, 0xCA, 0x59, 0xFD, 0xAD,
+    0x3F, 0xFC, 0x29, 0xC9, 0x0A, 0xC6, 0x9C, 0x1C, 0xA6, 0x99, 0x19, 0x94, 0x77, 0x09, 0xFD, 0x93,
+    0xFF, 0xC2, 0xAD, 0x93, 0x99, 0x19, 0xD7, 0x1D, 0xA7, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA2, 0xCA,
+    0x9E, 0x0A, 0xCA, 0x2F, 0xD0, 0xAC, 0xA2, 0xE3, 0xAC, 0xA2, 0xD4, 0x9D, 0x2D, 0x5D, 0x2D, 0x5D,
+    0x91, 0xD5, 0xAD, 0x1D, 0x6E, 0x9D, 0x7F, 0xCA, 0xDA, 0x4A, 0xFD, 0x97, 0x50, 0x1A, 0xFF, 0xC1,
+    0xFF, 0xD1, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xEA, 0xAA,
+    0xAA, 0xA9, 0x1F, 0xFC, 0x91, 0xDA, 0x99, 0x99, 0x99, 0x2D, 0x97, 0x0D, 0x96, 0xFF, 0x3A, 0xFE,
+    0x5D, 0x97, 0x0D, 0x97, 0x0D, 0x96, 0x77, 0x29, 0xFC, 0xA5, 0xAF, 0xEA, 0x4D, 0x93, 0x94, 0x9C,
+    0xA7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x2A, 0xCA, 0x70, 0xFF, 0xCA, 0x3A, 0xAE, 0xAA, 0xAA, 0x95,
+    0xAC, 0xA7, 0x09, 0x9D, 0xA9, 0x99, 0x94, 0xFF, 0xCA, 0x39, 0x9D, 0xA9, 0x99, 0x96, 0xD9, 0x72,
+    0xD7, 0x2D, 0x97, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x73, 0x9A, 0x77, 0x1C, 0xA7, 0x70, 0x9C, 0x95,
+    0x99, 0x19, 0xAA, 0xA9, 0x1D, 0x9A, 0xA9, 0x2D, 0x0F, 0xDA, 0x9F, 0xE1, 0xF9, 0x09, 0xAF, 0xA9,
+    0x09, 0xE0, 0xE4, 0xAD, 0xA4, 0xD0, 0xDA, 0x49, 0xD5, 0xD9, 0xD9, 0x49, 0xD5, 0xD9, 0xD9, 0x4A,
+    0xD5, 0xD9, 0xD9, 0x4E, 0x5D, 0x9D, 0x93, 0xAE, 0x5D, 0x9D, 0x93, 0xF5, 0xD9, 0xD9, 0x2A, 0xCA,
+    0xD5, 0xD9, 0xD9, 0x2C, 0xA9, 0xD5, 0xD9, 0xD9, 0x1A, 0xC0, 0x9D, 0x5D, 0x9D, 0x91, 0xD0, 0x9D,
+    0x5D, 0x93, 0x9C, 0x97, 0x70, 0xD7, 0x71, 0xC9, 0x75, 0x1A, 0xD4, 0xAC, 0x4E, 0x93, 0xD4, 0xEA,
+    0x3D, 0x4F, 0x3D, 0x4D, 0xAC, 0x92, 0xD4, 0xD0, 0xD2, 0xD2, 0xAA, 0xDA, 0xDA, 0xAA, 0xDA, 0xA0,
+    0xAF, 0xFF, 0xC2, 0xD1, 0xD1, 0xD4, 0xD1, 0xAC, 0x90, 0xD2, 0xFF, 0xFD, 0x09, 0xAD, 0xAA, 0xAD,
+    0xAD, 0xAA, 0x2D, 0x2A, 0xC9, 0xD4, 0xD3, 0xF4, 0xD3, 0xF4, 0xD3, 0x9E, 0x4D, 0x4E, 0x4D, 0x4A,
+    0xD2, 0x0F, 0xCA, 0x97, 0x2F, 0xF7, 0x1D, 0x29, 0xE7, 0x0D, 0x39, 0xD9, 0x7D, 0x4D, 0x97, 0xD4,
+    0xAC, 0xA1, 0xC9, 0x3D, 0x4D, 0x90, 0x9C, 0x93, 0xD4, 0xD1, 0xAC, 0xA9, 0x91, 0xD2, 0x9D, 0xA9,
+    0xFD, 0x1F, 0xF1, 0x9D, 0xA9, 0x91, 0xFD, 0x93, 0xAC, 0x93, 0xD7, 0x0A, 0xC9, 0x3D, 0x70, 0xAC,
+    0x93, 0xD7, 0x0A, 0xC9, 0x3D, 0x70, 0xAC, 0x93, 0xD7, 0x0A, 0xCA, 0x3D, 0x70, 0x9D, 0xAA, 0x90,
+    0xD7, 0x1A, 0xEA, 0x77, 0x10, 0xFC, 0xA9, 0x72, 0xFF, 0x71, 0xD2, 0x9D, 0xA7, 0x0D, 0x39, 0xD7,
+    0x0D, 0x4D, 0x29, 0xAA, 0xA9, 0x0D, 0x4D, 0x1A, 0xFC, 0xAD, 0x4D, 0x09, 0xD9, 0x09, 0xA0, 0xD3,
+    0xAC, 0xA0, 0xAC, 0xA4, 0xD9, 0x99, 0xAD, 0x1A, 0xCA, 0x4F, 0xE9, 0x2D, 0xA3, 0xDA, 0xAD, 0xA3,
+    0xAE, 0x91, 0xD2, 0xD4, 0x9E, 0xA0, 0xD2, 0xAC, 0xA5, 0xAD, 0x9D, 0x29, 0xD6, 0xAF, 0x3D, 0x95,
+    0x9F, 0x39, 0xD0, 0x93, 0xAC, 0xAD, 0x4D, 0x9A, 0xCA, 0xAA, 0xD9, 0xD4, 0xAC, 0xA9, 0xFC, 0x97,
+    0x72, 0x9C, 0x93, 0xAC, 0xA3, 0xAC, 0x09, 0xCA, 0x3E, 0x3D, 0x1D, 0x3E, 0x3D, 0x1D, 0x29, 0xCA,
+    0xC3, 0xCA, 0x1D, 0x2A, 0xC9, 0xC9, 0x19, 0xCA, 0x1A, 0xC9, 0x1A, 0xC0, 0xCA, 0x1A, 0xC9, 0x19,
+    0xC9, 0x1D, 0x0C, 0xA1, 0xAC, 0x29, 0xCA, 0x1C, 0xA0, 0xD1, 0xD1, 0xAF, 0xFF, 0xE9, 0xAA, 0xDA,
+    0xEA, 0xFD, 0xA9, 0x1D, 0x0A, 0xC1, 0x9C, 0x90, 0xCA, 0x3A, 0xC0, 0xD2, 0xCA, 0x9C, 0x93, 0x9C,
+    0x9D, 0x2C, 0xA9, 0xC5, 0xCA, 0xCA, 0x2A, 0xCA, 0xC5, 0xE9, 0x2A, 0xE5, 0xE3, 0x9E, 0x5A, 0xD4,
+    0xDA, 0x5A, 0xD4, 0xD9, 0x20, 0xAF, 0xDA, 0x94, 0xFF, 0xEA, 0x3F, 0x49, 0xD9, 0x2F, 0x59, 0xD2,
+    0xF2, 0x92, 0xD2, 0xF1, 0x9C, 0xA1, 0xD2, 0xF1, 0x9C, 0xA1, 0xD9, 0x1F, 0x19, 0xCA, 0x1D, 0x91,
+    0xF1, 0x9C, 0xA1, 0xD9, 0x1F, 0x19, 0xCA, 0x1D, 0x91, 0xF1, 0x9C, 0xA1, 0xD9, 0x1F, 0x19, 0xCA,
+    0x1D, 0x91, 0xF1, 0x9C, 0xA1, 0xD9, 0x1F, 0x19, 0xCA, 0x19, 0x92, 0xF1, 0x9C, 0xA5, 0xAC, 0xAD,
+    0x19, 0xCA, 0x49, 0xD0, 0xD1, 0x9D, 0xAA, 0xAA, 0xE9, 0x0D, 0x19, 0xFE, 0xA9, 0x10, 0x71, 0xD9,
+    0x73, 0xD9, 0x6F, 0xFC, 0x5F, 0xFC, 0x72, 0xD9, 0x59, 0xAA, 0x91, 0xD9, 0x39, 0xFD, 0x9D, 0x92,
+    0x9D, 0xA9, 0x99, 0xF9, 0x2D, 0xA4, 0xE9, 0x19, 0xD5, 0x9D, 0x91, 0x9D, 0x6D, 0x91, 0xAC, 0xA6,
+    0xD9, 0x1A, 0xCA, 0x6D, 0x91, 0xAC, 0xA6, 0xD9, 0x19, 0xD6, 0xD9, 0x2D, 0x59, 0xD9, 0x2E, 0x4E,
+    0x93, 0xEA, 0xAA, 0xF9, 0x4A, 0xFA, 0x0A, 0xC9, 0x77, 0x77, 0x1F, 0xFE, 0x3F, 0xFE, 0x10, 0x77,
+    0x39, 0xFC, 0xA5, 0xFF, 0xA3, 0xE9, 0x3A, 0x39, 0xD7, 0x2D, 0x97, 0x2D, 0x71, 0x9A, 0xD9, 0x99,
+    0x99, 0x92, 0x9F, 0xFD, 0x39, 0xAC, 0xA9, 0x99, 0x99, 0x5A, 0xCA, 0x70, 0x9F, 0xFC, 0x39, 0xFF,
+    0xC5, 0x9D, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3F, 0xAE, 0x95, 0xAF, 0xD7, 0x60, 0x19, 0xCA,
+    0x5A, 0xCA, 0x29, 0xCA, 0x49, 0xD3, 0x9C, 0xA3, 0x9D, 0x49, 0xCA, 0x3D, 0x94, 0x9C, 0xA2, 0xDA,
+    0x59, 0xCA, 0x1A, 0xCA, 0x69, 0xCA, 0x09, 0xD7, 0x9C, 0xA9, 0xD6, 0xAF, 0xFF, 0x19, 0xAF, 0xEA,
+    0xAA, 0xA3, 0x9D, 0x99, 0xD7, 0x9C, 0xA1, 0xAC, 0xA6, 0x9C, 0xA2, 0xD9, 0x59, 0xCA, 0x29, 0xD5,
+    0x9C, 0xA3, 0xAD, 0x49, 0xCA, 0x4D, 0xA3, 0x9C, 0xA4, 0x9D, 0x39, 0xCA, 0x5A, 0xD0, 0x9F, 0xFF,
+    0xAA, 0xFF, 0xFC, 0x5D, 0x97, 0x2D, 0x97, 0x2D, 0x90, 0x99, 0x7D, 0x9A, 0xD7, 0xFA, 0x70, 0xE9,
+    0x79, 0xE9, 0x7F, 0xC9, 0x0D, 0x3A, 0xCA, 0x0D, 0xAD, 0x97, 0xF7, 0x0A, 0xDA, 0x79, 0xF9, 0x69,
+    0xD9, 0xD9, 0x7A, 0x1D, 0x97, 0x2D, 0x97, 0x2D, 0x94, 0x77, 0x70, 0x9A, 0xFC, 0xA9, 0x76, 0xFF,
+    0xD7, 0x59, 0x94, 0x9E, 0x77, 0x99, 0x3E, 0x76, 0xD4, 0xD9, 0x75, 0xD4, 0xAC, 0xA7, 0x49, 0xCA,
+    0x49, 0xD7, 0x4A, 0xCA, 0x49, 0xD7, 0x4D, 0x94, 0x9D, 0x74, 0xD5, 0x9D, 0x49, 0x59, 0xD5, 0xAC,
+    0xA1, 0x9F, 0xC3, 0x9C, 0xA5, 0xD9, 0x1D, 0xA9, 0xE2, 0xAC, 0x94, 0xAD, 0x1D, 0xA2, 0xD9, 0x1D,
+    0x94, 0xD9, 0x1D, 0x3D, 0x91, 0xD3, 0x9D, 0xA1, 0x9D, 0x3D, 0x19, 0xD1, 0x9A, 0xE2, 0xAC, 0xA2,
+    0xAD, 0x1A, 0xFE, 0xA3, 0xEA, 0xAE, 0x91, 0xAF, 0xA9, 0x5D, 0xAF, 0x97, 0x7D, 0x77, 0x49, 0xCA,
+    0x77, 0x4A, 0xC9, 0x77, 0x4D, 0x97, 0x74, 0xD7, 0x74, 0x9D, 0x70, 0x77, 0x3A, 0xEA, 0x69, 0xDA,
+    0xD9, 0x5D, 0x90, 0x9C, 0xA5, 0xD2, 0xD5, 0xD2, 0xD5, 0xD1, 0x9C, 0xA5, 0xAC, 0x90, 0xAC, 0x95,
+    0x9C, 0xA0, 0xD7, 0xD9, 0xCA, 0x7F, 0x70, 0x9D, 0xA7, 0x1D, 0x5A, 0xA1, 0xAD, 0xA3, 0x9D, 0x1F,
+    0x3E, 0xAD, 0x0A, 0xC9, 0x19, 0xCA, 0xAD, 0xA0, 0x9D, 0x1D, 0x1D, 0x2D, 0x09, 0xCA, 0x1A, 0x92,
+    0xAC, 0x97, 0x19, 0xCA, 0x72, 0xD7, 0x2D, 0x71, 0x9C, 0xA6, 0xAF, 0x96, 0xAE, 0x90, 0x19, 0xFC,
+    0xA9, 0x6A, 0xFE, 0xA5, 0xAC, 0xA2, 0x9D, 0xA3, 0x9A, 0xCA, 0x99, 0x99, 0xAD, 0x99, 0x0F, 0xFF,
+    0xD2, 0xAC, 0xA4, 0xD9, 0x3A, 0xCA, 0x4A, 0xC9, 0x1A, 0xAE, 0xAA, 0xAA, 0xAE, 0xA0, 0x9A, 0xEA,
+    0xAA, 0xAE, 0xAA, 0x2A, 0xCA, 0x3D, 0xA4, 0xAD, 0xAA, 0xF5, 0xAF, 0xD9, 0x6A, 0xCA, 0x73, 0xAC,
+    0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x10, 0x7A, 0xC7, 0x29, 0xAF,
+    0xDA, 0x94, 0xFF, 0xE3, 0xEA, 0x0A, 0xC1, 0x9A, 0x92, 0xE2, 0xAC, 0x6A, 0xD3, 0xAC, 0x6D, 0xA3,
+    0xAC, 0x6D, 0x4A, 0xC5, 0x9D, 0x4A, 0xC5, 0x9D, 0x4A, 0xC9, 0x99, 0x99, 0x09, 0xD4, 0xAF, 0xD9,
+    0x9D, 0x4A, 0xCA, 0xAA, 0xD9, 0x9D, 0x4A, 0xC2, 0xD9, 0x0D, 0x93, 0xAC, 0x2D, 0x90, 0xAD, 0x3A,
+    0xC2, 0xD9, 0x1D, 0xA2, 0xAC, 0x2D, 0x91, 0x9E, 0x90, 0xAC, 0x2D, 0x92, 0x9F, 0xDA, 0xF9, 0x4A,
+    0xFF, 0xA7, 0x0A, 0xC7, 0x5A, 0xC5, 0x5A, 0xD7, 0x4E, 0x73, 0x9E, 0xA7, 0x2D, 0xAD, 0x72, 0xD0,
+    0xD9, 0x70, 0xAC, 0xA0, 0xAC, 0xA7, 0x0D, 0xA0, 0x9D, 0x4F, 0xFF, 0xE0, 0x99, 0x9E, 0x99, 0x9A,
+    0xD9, 0x99, 0x3D, 0x93, 0xD3, 0x9A, 0xAD, 0xAA, 0xAA, 0xAD, 0xAA, 0xA0, 0xFF, 0xFE, 0x2D, 0x95,
+    0xD9, 0x29, 0xD6, 0xDA, 0x2A, 0xCA, 0x69, 0xD2, 0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xAC, 0xA0, 0xDA,
+    0x70, 0x9D, 0x00, 0x77, 0x0A, 0xFD, 0x94, 0xFF, 0xCA, 0x39, 0xA4, 0xAD, 0x73, 0xD9, 0x72, 0xD9,
+    0x72, 0xD9, 0x0A, 0xFF, 0xF9, 0x9A, 0xAA, 0xAA, 0xAF, 0xAA, 0x94, 0x9E, 0xA6, 0xAE, 0xA5, 0xAF,
+    0xFF, 0x9A, 0xFF, 0xF9, 0x0A, 0xCA, 0x72, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD9, 0x59, 0x92, 0xFC,
+    0xAF, 0x93, 0xAF, 0xEA, 0x77, 0x7C, 0xA7, 0x19, 0xFD, 0xA9, 0x39, 0xFF, 0xD2, 0x9E, 0x90, 0xCA,
+    0x1A, 0x92, 0xE2, 0xCA, 0x5A, 0xD3, 0xCA, 0x5D, 0xA3, 0xCA, 0x5D, 0x4C, 0xA4, 0x9D, 0x4C, 0xA4,
+    0x9D, 0x4C, 0xA4, 0x9D, 0x4C, 0xA4, 0x9D, 0x4C, 0xA4, 0x9D, 0x4C, 0xA5, 0xD9, 0x3C, 0xA5, 0xAD,
+    0x3C, 0xA5, 0x9D, 0xA2, 0xCA, 0x6A, 0xDA, 0x1C, 0xA7, 0xAF, 0xFC, 0x94, 0x9A, 0xFE, 0x71, 0xCA,
+    0x74, 0xCA, 0x40, 0x29, 0x93, 0x99, 0x6C, 0xA3, 0xCA, 0x6C, 0xA2, 0x9C, 0xA5, 0xAD, 0x99, 0x9A,
+    0xD9, 0x99, 0x09, 0xFF, 0xFC, 0x90, 0x9A, 0xD9, 0x99, 0xDA, 0x99, 0x92, 0xAC, 0xA2, 0xAC, 0xA5,
+    0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAC, 0xA5,
+    0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAC, 0xA5, 0xAC, 0xA2, 0xAD, 0x5A,
+    0xCA, 0x3E, 0xAA, 0xA1, 0xAC, 0xA3, 0x9F, 0xA7, 0x60, 0x77, 0x70, 0x9F, 0xCA, 0x97, 0xAF, 0xF9,
+    0x5A, 0xD9, 0x39, 0xA6, 0xD9, 0x75, 0xD7, 0x6D, 0x97, 0x5A, 0xD7, 0x6E, 0xA7, 0x5F, 0xC9, 0x73,
+    0x9A, 0xF7, 0x5A, 0xE7, 0x6D, 0xA0, 0xAA, 0x90, 0xAC, 0x90, 0x9C, 0xA1, 0x9D, 0x9C, 0xAD, 0x9A,
+    0xDA, 0x9C, 0xA1, 0xD9, 0xC9, 0xC9, 0x1D, 0x19, 0xC0, 0x9D, 0x0E, 0x2C, 0xA1, 0x9C, 0x0D, 0x91,
+    0xEA, 0x9C, 0xA1, 0xAE, 0xA3, 0xCA, 0xFF, 0xA9, 0x4C, 0x2C, 0xA1, 0xAC, 0x6C, 0x2C, 0xA1, 0x9C,
+    0x30, 0x9F, 0xFF, 0x0A, 0xFF, 0xF7, 0x77, 0x4A, 0xFF, 0xF0, 0xAF, 0xFF, 0x59, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x29, 0xD5, 0x0F, 0xFD, 0x90, 0xFF, 0xD4, 0x9D, 0x97, 0x0A, 0xD4, 0xAA, 0xAA, 0xAD,
+    0xAA, 0xA1, 0xFF, 0xD9, 0x49, 0xD7, 0x0D, 0xA4, 0x99, 0xAE, 0x5F, 0xA6, 0xAC, 0xA7, 0x1D, 0x97,
+    0x09, 0xD7, 0x1D, 0xA7, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x70, 0xAD, 0x30, 0x2A, 0xC9, 0x72,
+    0xD9, 0x72, 0xD9, 0x2A, 0x95, 0xD9, 0xAE, 0x95, 0xFC, 0x94, 0x9F, 0xA7, 0xAC, 0xAD, 0x90, 0x9A,
+    0xC9, 0x5D, 0xAE, 0xA5, 0xAE, 0xA9, 0x59, 0xF9, 0x49, 0xC9, 0x99, 0x0D, 0x94, 0xAC, 0x92, 0xD9,
+    0x4D, 0x92, 0xD9, 0x4D, 0x3D, 0x93, 0xAD, 0x3D, 0x92, 0x9D, 0x93, 0xD9, 0x19, 0xDA, 0x4F, 0xEA,
+    0x5F, 0xCA, 0x77, 0x20, 0x77, 0x49, 0xE9, 0x76, 0xCA, 0x9D, 0x97, 0x4A, 0xC2, 0xD7, 0x4A, 0xC2,
+    0xD7, 0x49, 0xD9, 0x9D, 0x99, 0x99, 0x99, 0x96, 0xAF, 0xFF, 0xDA, 0x49, 0x9A, 0xDA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x6D, 0x70, 0x9C, 0xA5, 0xD7, 0x1A, 0xC5, 0xD1, 0xC9, 0x1C, 0x29, 0xC5, 0xD9, 0xE9,
+    0xE1, 0xAC, 0x5A, 0xE0, 0xE9, 0xDA, 0xCA, 0x5A, 0xD2, 0xC2, 0xAC, 0xA5, 0xAD, 0xA7, 0x6A, 0xCA,
+    0xD7, 0x79, 0x09, 0xD7, 0x71, 0xAE, 0xAA, 0xD9, 0x73, 0x9F, 0xD7, 0x77, 0x00, 0x7D, 0x77, 0xD7,
+    0x7D, 0x77, 0xD7, 0x7D, 0x75, 0x9A, 0xDA, 0x97, 0x09, 0xFF, 0xD9, 0x4A, 0xEA, 0x9D, 0xAA, 0xEA,
+    0x29, 0xDA, 0x2D, 0x2A, 0xD9, 0x1D, 0xA3, 0xD3, 0xAD, 0x1D, 0x4D, 0x4D, 0x09, 0xD4, 0xD4, 0xD9,
+    0x9D, 0x4D, 0x4A, 0xCA, 0xAC, 0xA4, 0xD4, 0xAC, 0xAA, 0xCA, 0x73, 0xAC, 0xAA, 0xCA, 0x73, 0xAC,
+    0xAA, 0xCA, 0x73, 0xAC, 0xAA, 0xCA, 0x73, 0xAC, 0xA0, 0x19, 0xFD, 0xA9, 0x4A, 0xFF, 0xC3, 0xAC,
+    0xA3, 0x9E, 0x2A, 0xCA, 0x49, 0xD9, 0x1A, 0xCA, 0x5D, 0xA1, 0xAC, 0xA5, 0xDA, 0x1A, 0xCA, 0x5D,
+    0x91, 0xAC, 0xA4, 0x9D, 0x2A, 0xD9, 0x19, 0xAD, 0xA0, 0xFF, 0xEA, 0x1A, 0xFD, 0xAA, 0x95, 0xAC,
+    0xA7, 0x2A, 0xCA, 0x70, 0xFF, 0xC4, 0x9A, 0xEA, 0xAA, 0x96, 0xAC, 0xA7, 0x2A, 0xCA, 0x72, 0xAC,
+    0xA7, 0x00, 0x71, 0x97, 0x3C, 0xA0, 0x9C, 0x97, 0x2D, 0xAA, 0xC9, 0x70, 0xAF, 0xF6, 0xFC, 0x09,
+    0xF9, 0x3E, 0x0C, 0xA0, 0x9C, 0x99, 0xD2, 0x9D, 0x1C, 0xA0, 0x9C, 0x90, 0xAD, 0x1D, 0xA1, 0xCA,
+    0x09, 0xC9, 0x1D, 0x1D, 0x2C, 0xA0, 0x9C, 0x91, 0xD9, 0x9D, 0x2C, 0xA0, 0x9C, 0x91, 0xAC, 0xA9,
+    0xD2, 0xCA, 0x09, 0xC9, 0x1A, 0xCA, 0x9D, 0x29, 0x29, 0x39, 0x1D, 0x76, 0xD9, 0x75, 0xAC, 0xA7,
+    0x6D, 0x76, 0x9D, 0x76, 0x9D, 0x97, 0x3A, 0xFF, 0xFA, 0x2F, 0xFF, 0xCA, 0x00, 0x29, 0x19, 0x95,
+    0x9C, 0x90, 0xCA, 0x59, 0xC9, 0x0C, 0xA3, 0x9F, 0xE3, 0xAF, 0xFA, 0x1A, 0xCA, 0x29, 0xAD, 0x90,
+    0xAC, 0xA4, 0xE0, 0xAC, 0xA4, 0x9D, 0x0A, 0xCA, 0x4A, 0xD0, 0xAC, 0xA4, 0xD9, 0x0A, 0xD9, 0x99,
+    0x9E, 0x1A, 0xFE, 0xA2, 0xAD, 0xAA, 0xAF, 0x1A, 0xCA, 0x4E, 0x0A, 0xCA, 0x5D, 0x0A, 0xCA, 0x5D,
+    0x9A, 0xCA, 0x5D, 0x9A, 0xCA, 0x49, 0xD0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xC1, 0xAF, 0xEA, 0x49,
+    0xC9, 0x0C, 0xA5, 0x9C, 0x90, 0xCA, 0x69, 0x19, 0x93, 0x39, 0xAA, 0xA9, 0x29, 0xFE, 0x09, 0xDA,
+    0x99, 0x9A, 0x90, 0xDA, 0x59, 0xD6, 0xAC, 0xA6, 0xDA, 0x6D, 0x96, 0xAC, 0xA6, 0xAC, 0xA6, 0x9D,
+    0x7E, 0x7E, 0xAA, 0xAD, 0x2A, 0xFC, 0xA7, 0x73, 0xAF, 0xFC, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xF7, 0x30, 0x72, 0xC7, 0x74, 0xE7, 0x72, 0xFC, 0x77, 0x0F,
+    0xE7, 0x6F, 0xFC, 0x74, 0xD9, 0x4A, 0xD7, 0x2D, 0xA6, 0xAD, 0x70, 0xF0, 0x9A, 0xC9, 0x19, 0xE6,
+    0xFF, 0xD1, 0x9F, 0x4F, 0xFD, 0xA1, 0x9F, 0xC2, 0xFF, 0xDA, 0x2F, 0xE0, 0xAF, 0xFC, 0xA2, 0xFF,
+    0xA0, 0xFF, 0xC2, 0xFF, 0xC2, 0xFE, 0xA1, 0xAF, 0xF4, 0xFE, 0x99, 0xFF, 0x6F, 0xFF, 0xE7, 0x0F,
+    0xC9, 0x9F, 0xD7, 0x2E, 0x91, 0x9F, 0x74, 0xD9, 0x19, 0xE7, 0x6D, 0xAA, 0xE7, 0x70, 0xFC, 0x77,
+    0x2E, 0x77, 0x4A, 0x72,
 };
 
 static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 4, 19, 7, 1, 18, 19, 0 }, // !
-    { 8, 7, 10, 1, 18, 14, 19 }, // "
-    { 16, 18, 17, 0, 18, 72, 33 }, // #
-    { 12, 21, 14, 1, 19, 63, 105 }, // $
-    { 19, 20, 21, 1, 19, 95, 168 }, // %
-    { 18, 20, 20, 1, 19, 90, 263 }, // &
-    { 3, 7, 6, 1, 18, 6, 353 }, // '
-    { 6, 22, 8, 1, 18, 33, 359 }, // (
-    { 7, 22, 8, 0, 18, 39, 392 }, // )
-    { 12, 12, 14, 1, 19, 36, 431 }, // *
-    { 12, 13, 14, 1, 15, 39, 467 }, // +
-    { 4, 7, 7, 1, 3, 7, 506 }, // ,
-    { 7, 3, 9, 1, 8, 6, 513 }, // -
-    { 4, 5, 7, 1, 4, 5, 519 }, // .
-    { 10, 18, 11, 0, 18, 45, 524 }, // /
-    { 13, 20, 15, 1, 19, 65, 569 }, // 0
-    { 7, 18, 14, 2, 18, 32, 634 }, // 1
-    { 12, 19, 14, 1, 19, 57, 666 }, // 2
-    { 12, 20, 14, 1, 19, 60, 723 }, // 3
-    { 14, 18, 15, 0, 18, 63, 783 }, // 4
-    { 12, 19, 14, 1, 18, 57, 846 }, // 5
-    { 13, 20, 15, 1, 19, 65, 903 }, // 6
-    { 13, 18, 15, 1, 18, 59, 968 }, // 7
-    { 13, 20, 15, 1, 19, 65, 1027 }, // 8
-    { 12, 20, 14, 1, 19, 60, 1092 }, // 9
-    { 4, 15, 7, 1, 14, 15, 1152 }, // :
-    { 5, 18, 7, 0, 14, 23, 1167 }, // ;
-    { 13, 14, 15, 1, 16, 46, 1190 }, // <
-    { 12, 8, 14, 1, 13, 24, 1236 }, // =
-    { 13, 14, 15, 1, 16, 46, 1260 }, // >
-    { 11, 20, 12, 0, 19, 55, 1306 }, // ?
-    { 21, 21, 23, 1, 18, 111, 1361 }, // @
-    { 16, 18, 17, 0, 18, 72, 1472 }, // A
-    { 13, 18, 16, 2, 18, 59, 1544 }, // B
-    { 15, 20, 17, 1, 19, 75, 1603 }, // C
-    { 15, 18, 18, 2, 18, 68, 1678 }, // D
-    { 11, 18, 14, 2, 18, 50, 1746 }, // E
-    { 11, 18, 14, 2, 18, 50, 1796 }, // F
-    { 16, 20, 18, 1, 19, 80, 1846 }, // G
-    { 15, 18, 19, 2, 18, 68, 1926 }, // H
-    { 7, 18, 9, 1, 18, 32, 1994 }, // I
-    { 7, 23, 7, -2, 18, 41, 2026 }, // J
-    { 14, 18, 17, 2, 18, 63, 2067 }, // K
-    { 11, 18, 14, 2, 18, 50, 2130 }, // L
-    { 19, 18, 23, 2, 18, 86, 2180 }, // M
-    { 15, 18, 19, 2, 18, 68, 2266 }, // N
-    { 17, 20, 20, 1, 19, 85, 2334 }, // O
-    { 12, 18, 15, 2, 18, 54, 2419 }, // P
-    { 17, 24, 20, 1, 19, 102, 2473 }, // Q
-    { 14, 18, 17, 2, 18, 63, 2575 }, // R
-    { 12, 20, 14, 1, 19, 60, 2638 }, // S
-    { 14, 18, 15, 0, 18, 63, 2698 }, // T
-    { 14, 19, 18, 2, 18, 67, 2761 }, // U
-    { 15, 18, 16, 0, 18, 68, 2828 }, // V
-    { 23, 18, 24, 0, 18, 104, 2896 }, // W
-    { 15, 18, 16, 0, 18, 68, 3000 }, // X
-    { 15, 18, 16, 0, 18, 68, 3068 }, // Y
-    { 14, 18, 15, 0, 18, 63, 3136 }, // Z
-    { 6, 22, 9, 2, 18, 33, 3199 }, // [
-    { 10, 18, 11, 0, 18, 45, 3232 }, // <backslash>
-    { 7, 22, 8, 0, 18, 39, 3277 }, // ]
-    { 14, 12, 15, 0, 18, 42, 3316 }, // ^
-    { 13, 2, 13, -1, -2, 7, 3358 }, // _
-    { 6, 5, 8, 1, 20, 8, 3365 }, // `
-    { 11, 15, 14, 1, 14, 42, 3373 }, // a
-    { 12, 20, 15, 2, 19, 60, 3415 }, // b
-    { 11, 15, 13, 1, 14, 42, 3475 }, // c
-    { 13, 20, 15, 1, 19, 65, 3517 }, // d
-    { 12, 15, 14, 1, 14, 45, 3582 }, // e
-    { 10, 20, 11, 0, 20, 50, 3627 }, // f
-    { 13, 20, 15, 1, 14, 65, 3677 }, // g
-    { 12, 19, 15, 2, 19, 57, 3742 }, // h
-    { 4, 19, 6, 1, 19, 19, 3799 }, // i
-    { 7, 25, 6, -2, 19, 44, 3818 }, // j
-    { 12, 19, 15, 2, 19, 57, 3862 }, // k
-    { 3, 19, 6, 2, 19, 15, 3919 }, // l
-    { 20, 14, 23, 2, 14, 70, 3934 }, // m
-    { 12, 14, 15, 2, 14, 42, 4004 }, // n
-    { 13, 15, 15, 1, 14, 49, 4046 }, // o
-    { 12, 20, 15, 2, 14, 60, 4095 }, // p
-    { 13, 20, 15, 1, 14, 65, 4155 }, // q
-    { 8, 14, 11, 2, 14, 28, 4220 }, // r
-    { 10, 15, 12, 1, 14, 38, 4248 }, // s
-    { 9, 18, 10, 0, 17, 41, 4286 }, // t
-    { 13, 15, 15, 1, 14, 49, 4327 }, // u
-    { 13, 14, 14, 0, 14, 46, 4376 }, // v
-    { 20, 14, 21, 0, 14, 70, 4422 }, // w
-    { 13, 14, 14, 0, 14, 46, 4492 }, // x
-    { 13, 20, 14, 0, 14, 65, 4538 }, // y
-    { 11, 14, 12, 0, 14, 39, 4603 }, // z
-    { 9, 22, 10, 0, 18, 50, 4642 }, // {
-    { 3, 26, 14, 5, 19, 20, 4692 }, // |
-    { 9, 22, 10, 0, 18, 50, 4712 }, // }
-    { 13, 4, 15, 1, 11, 13, 4762 }, // ~
-    { 0, 0, 7, 0, 0, 0, 4775 }, //  
-    { 4, 19, 7, 1, 14, 19, 4775 }, // ¡
-    { 11, 20, 14, 2, 19, 55, 4794 }, // ¢
-    { 14, 19, 15, 0, 19, 67, 4849 }, // £
-    { 12, 12, 14, 1, 15, 36, 4916 }, // ¤
-    { 14, 18, 15, 0, 18, 63, 4952 }, // ¥
-    { 3, 26, 14, 5, 19, 20, 5015 }, // ¦
-    { 11, 21, 13, 1, 20, 58, 5035 }, // §
-    { 8, 4, 15, 3, 19, 8, 5093 }, // ¨
-    { 19, 20, 21, 1, 19, 95, 5101 }, // ©
-    { 8, 10, 9, 0, 19, 20, 5196 }, // ª
-    { 11, 11, 13, 1, 12, 31, 5216 }, // «
-    { 12, 7, 14, 1, 10, 21, 5247 }, // ¬
-    { 7, 3, 9, 1, 8, 6, 5268 }, // ­
-    { 19, 20, 21, 1, 19, 95, 5274 }, // ®
-    { 14, 2, 14, -1, 21, 7, 5369 }, // ¯
-    { 9, 9, 11, 1, 19, 21, 5376 }, // °
-    { 13, 15, 15, 1, 15, 49, 5397 }, // ±
-    { 8, 12, 9, 0, 22, 24, 5446 }, // ²
-    { 9, 12, 10, 0, 22, 27, 5470 }, // ³
-    { 6, 5, 8, 1, 20, 8, 5497 }, // ´
-    { 12, 20, 16, 2, 14, 60, 5505 }, // µ
-    { 13, 23, 16, 1, 19, 75, 5565 }, // ¶
-    { 4, 5, 7, 1, 11, 5, 5640 }, // ·
-    { 6, 6, 7, 0, 0, 9, 5645 }, // ¸
-    { 6, 12, 9, 0, 22, 18, 5654 }, // ¹
-    { 9, 10, 10, 0, 19, 23, 5672 }, // º
-    { 12, 11, 13, 0, 12, 33, 5695 }, // »
-    { 19, 18, 20, 0, 18, 86, 5728 }, // ¼
-    { 19, 18, 20, 0, 18, 86, 5814 }, // ½
-    { 20, 19, 21, 0, 19, 95, 5900 }, // ¾
-    { 11, 19, 12, 0, 14, 53, 5995 }, // ¿
-    { 16, 24, 17, 0, 24, 96, 6048 }, // À
-    { 16, 24, 17, 0, 24, 96, 6144 }, // Á
-    { 16, 24, 17, 0, 24, 96, 6240 }, // Â
-    { 16, 23, 17, 0, 23, 92, 6336 }, // Ã
-    { 16, 23, 17, 0, 23, 92, 6428 }, // Ä
-    { 16, 23, 17, 0, 23, 92, 6520 }, // Å
-    { 22, 18, 22, -1, 18, 99, 6612 }, // Æ
-    { 15, 25, 17, 1, 19, 94, 6711 }, // Ç
-    { 11, 24, 14, 2, 24, 66, 6805 }, // È
-    { 11, 24, 14, 2, 24, 66, 6871 }, // É
-    { 11, 24, 14, 2, 24, 66, 6937 }, // Ê
-    { 11, 23, 14, 2, 23, 64, 7003 }, // Ë
-    { 7, 24, 9, 1, 24, 42, 7067 }, // Ì
-    { 7, 24, 9, 1, 24, 42, 7109 }, // Í
-    { 9, 24, 10, 0, 24, 54, 7151 }, // Î
-    { 8, 23, 9, 0, 23, 46, 7205 }, // Ï
-    { 17, 18, 18, 0, 18, 77, 7251 }, // Ð
-    { 15, 23, 19, 2, 23, 87, 7328 }, // Ñ
-    { 17, 25, 20, 1, 24, 107, 7415 }, // Ò
-    { 17, 25, 20, 1, 24, 107, 7522 }, // Ó
-    { 17, 25, 20, 1, 24, 107, 7629 }, // Ô
-    { 17, 24, 20, 1, 23, 102, 7736 }, // Õ
-    { 17, 24, 20, 1, 23, 102, 7838 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 7940 }, // ×
-    { 17, 20, 20, 1, 19, 85, 7976 }, // Ø
-    { 14, 25, 18, 2, 24, 88, 8061 }, // Ù
-    { 14, 25, 18, 2, 24, 88, 8149 }, // Ú
-    { 14, 25, 18, 2, 24, 88, 8237 }, // Û
-    { 14, 24, 18, 2, 23, 84, 8325 }, // Ü
-    { 15, 24, 16, 0, 24, 90, 8409 }, // Ý
-    { 12, 18, 15, 2, 18, 54, 8499 }, // Þ
-    { 13, 21, 16, 2, 20, 69, 8553 }, // ß
-    { 11, 21, 14, 1, 20, 58, 8622 }, // à
-    { 11, 21, 14, 1, 20, 58, 8680 }, // á
-    { 11, 21, 14, 1, 20, 58, 8738 }, // â
-    { 11, 20, 14, 1, 19, 55, 8796 }, // ã
-    { 11, 20, 14, 1, 19, 55, 8851 }, // ä
-    { 11, 22, 14, 1, 21, 61, 8906 }, // å
-    { 20, 15, 22, 1, 14, 75, 8967 }, // æ
-    { 11, 20, 13, 1, 14, 55, 9042 }, // ç
-    { 12, 21, 14, 1, 20, 63, 9097 }, // è
-    { 12, 21, 14, 1, 20, 63, 9160 }, // é
-    { 12, 21, 14, 1, 20, 63, 9223 }, // ê
-    { 12, 20, 14, 1, 19, 60, 9286 }, // ë
-    { 6, 20, 6, -1, 20, 30, 9346 }, // ì
-    { 6, 20, 8, 1, 20, 30, 9376 }, // í
-    { 9, 20, 9, -1, 20, 45, 9406 }, // î
-    { 8, 19, 8, -1, 19, 38, 9451 }, // ï
-    { 13, 21, 15, 1, 20, 69, 9489 }, // ð
-    { 12, 19, 15, 2, 19, 57, 9558 }, // ñ
-    { 13, 21, 15, 1, 20, 69, 9615 }, // ò
-    { 13, 21, 15, 1, 20, 69, 9684 }, // ó
-    { 13, 21, 15, 1, 20, 69, 9753 }, // ô
-    { 13, 20, 15, 1, 19, 65, 9822 }, // õ
-    { 13, 20, 15, 1, 19, 65, 9887 }, // ö
-    { 13, 12, 15, 1, 15, 39, 9952 }, // ÷
-    { 13, 16, 15, 1, 15, 52, 9991 }, // ø
-    { 13, 21, 15, 1, 20, 69, 10043 }, // ù
-    { 13, 21, 15, 1, 20, 69, 10112 }, // ú
-    { 13, 21, 15, 1, 20, 69, 10181 }, // û
-    { 13, 20, 15, 1, 19, 65, 10250 }, // ü
-    { 13, 26, 14, 0, 20, 85, 10315 }, // ý
-    { 12, 25, 15, 2, 19, 75, 10400 }, // þ
-    { 13, 25, 14, 0, 19, 82, 10475 }, // ÿ
-    { 16, 21, 17, 0, 21, 84, 10557 }, // Ā
-    { 11, 18, 14, 1, 17, 50, 10641 }, // ā
-    { 16, 23, 17, 0, 23, 92, 10691 }, // Ă
-    { 11, 20, 14, 1, 19, 55, 10783 }, // ă
-    { 16, 24, 17, 0, 18, 96, 10838 }, // Ą
-    { 12, 20, 14, 1, 14, 60, 10934 }, // ą
-    { 15, 25, 17, 1, 24, 94, 10994 }, // Ć
-    { 11, 21, 13, 1, 20, 58, 11088 }, // ć
-    { 15, 25, 17, 1, 24, 94, 11146 }, // Ĉ
-    { 11, 21, 13, 1, 20, 58, 11240 }, // ĉ
-    { 15, 24, 17, 1, 23, 90, 11298 }, // Ċ
-    { 11, 20, 13, 1, 19, 55, 11388 }, // ċ
-    { 15, 25, 17, 1, 24, 94, 11443 }, // Č
-    { 11, 21, 13, 1, 20, 58, 11537 }, // č
-    { 15, 24, 18, 2, 24, 90, 11595 }, // Ď
-    { 17, 20, 19, 1, 19, 85, 11685 }, // ď
-    { 17, 18, 18, 0, 18, 77, 11770 }, // Đ
-    { 15, 20, 17, 1, 19, 75, 11847 }, // đ
-    { 11, 21, 14, 2, 21, 58, 11922 }, // Ē
-    { 12, 18, 14, 1, 17, 54, 11980 }, // ē
-    { 11, 23, 14, 2, 23, 64, 12034 }, // Ĕ
-    { 12, 20, 14, 1, 19, 60, 12098 }, // ĕ
-    { 11, 23, 14, 2, 23, 64, 12158 }, // Ė
-    { 12, 20, 14, 1, 19, 60, 12222 }, // ė
-    { 11, 24, 14, 2, 18, 66, 12282 }, // Ę
-    { 12, 20, 14, 1, 14, 60, 12348 }, // ę
-    { 11, 24, 14, 2, 24, 66, 12408 }, // Ě
-    { 12, 21, 14, 1, 20, 63, 12474 }, // ě
-    { 16, 25, 18, 1, 24, 100, 12537 }, // Ĝ
-    { 13, 26, 15, 1, 20, 85, 12637 }, // ĝ
-    { 16, 24, 18, 1, 23, 96, 12722 }, // Ğ
-    { 13, 25, 15, 1, 19, 82, 12818 }, // ğ
-    { 16, 24, 18, 1, 23, 96, 12900 }, // Ġ
-    { 13, 25, 15, 1, 19, 82, 12996 }, // ġ
-    { 16, 25, 18, 1, 19, 100, 13078 }, // Ģ
-    { 13, 26, 15, 1, 20, 85, 13178 }, // ģ
-    { 15, 24, 19, 2, 24, 90, 13263 }, // Ĥ
-    { 15, 26, 15, -1, 26, 98, 13353 }, // ĥ
-    { 19, 18, 20, 0, 18, 86, 13451 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 13537 }, // ħ
-    { 10, 23, 10, -1, 23, 58, 13604 }, // Ĩ
-    { 10, 19, 9, -2, 19, 48, 13662 }, // ĩ
-    { 8, 21, 9, 0, 21, 42, 13710 }, // Ī
-    { 8, 17, 8, -1, 17, 34, 13752 }, // ī
-    { 9, 23, 10, 0, 23, 52, 13786 }, // Ĭ
-    { 9, 19, 9, -1, 19, 43, 13838 }, // ĭ
-    { 7, 24, 9, 1, 18, 42, 13881 }, // Į
-    { 5, 25, 6, 0, 19, 32, 13923 }, // į
-    { 7, 23, 9, 1, 23, 41, 13955 }, // İ
-    { 3, 14, 6, 2, 14, 11, 13996 }, // ı
-    { 13, 23, 15, 1, 18, 75, 14007 }, // Ĳ
-    { 10, 25, 13, 1, 19, 63, 14082 }, // ĳ
-    { 10, 29, 9, -2, 24, 73, 14145 }, // Ĵ
-    { 10, 26, 9, -2, 20, 65, 14218 }, // ĵ
-    { 14, 24, 17, 2, 18, 84, 14283 }, // Ķ
-    { 12, 25, 15, 2, 19, 75, 14367 }, // ķ
-    { 12, 14, 15, 2, 14, 42, 14442 }, // ĸ
-    { 11, 24, 14, 2, 24, 66, 14484 }, // Ĺ
-    { 6, 26, 8, 1, 26, 39, 14550 }, // ĺ
-    { 11, 24, 14, 2, 18, 66, 14589 }, // Ļ
-    { 4, 25, 6, 1, 19, 25, 14655 }, // ļ
-    { 11, 18, 14, 2, 18, 50, 14680 }, // Ľ
-    { 7, 19, 10, 2, 19, 34, 14730 }, // ľ
-    { 11, 18, 14, 2, 18, 50, 14764 }, // Ŀ
-    { 6, 19, 9, 2, 19, 29, 14814 }, // ŀ
-    { 13, 18, 14, 0, 18, 59, 14843 }, // Ł
-    { 8, 19, 8, -1, 19, 38, 14902 }, // ł
-    { 15, 24, 19, 2, 24, 90, 14940 }, // Ń
-    { 12, 20, 15, 2, 20, 60, 15030 }, // ń
-    { 15, 24, 19, 2, 18, 90, 15090 }, // Ņ
-    { 12, 20, 15, 2, 14, 60, 15180 }, // ņ
-    { 15, 24, 19, 2, 24, 90, 15240 }, // Ň
-    { 12, 20, 15, 2, 20, 60, 15330 }, // ň
-    { 16, 18, 17, 0, 18, 72, 15390 }, // ŉ
-    { 15, 23, 19, 2, 18, 87, 15462 }, // Ŋ
-    { 12, 20, 15, 2, 14, 60, 15549 }, // ŋ
-    { 17, 22, 20, 1, 21, 94, 15609 }, // Ō
-    { 13, 18, 15, 1, 17, 59, 15703 }, // ō
-    { 17, 24, 20, 1, 23, 102, 15762 }, // Ŏ
-    { 13, 20, 15, 1, 19, 65, 15864 }, // ŏ
-    { 17, 25, 20, 1, 24, 107, 15929 }, // Ő
-    { 13, 21, 15, 1, 20, 69, 16036 }, // ő
-    { 21, 20, 23, 1, 19, 105, 16105 }, // Œ
-    { 22, 15, 24, 1, 14, 83, 16210 }, // œ
-    { 14, 24, 17, 2, 24, 84, 16293 }, // Ŕ
-    { 8, 20, 11, 2, 20, 40, 16377 }, // ŕ
-    { 14, 24, 17, 2, 18, 84, 16417 }, // Ŗ
-    { 9, 20, 11, 1, 14, 45, 16501 }, // ŗ
-    { 14, 24, 17, 2, 24, 84, 16546 }, // Ř
-    { 10, 20, 12, 1, 20, 50, 16630 }, // ř
-    { 12, 25, 14, 1, 24, 75, 16680 }, // Ś
-    { 10, 21, 12, 1, 20, 53, 16755 }, // ś
-    { 12, 25, 14, 1, 24, 75, 16808 }, // Ŝ
-    { 10, 21, 12, 1, 20, 53, 16883 }, // ŝ
-    { 12, 25, 14, 1, 19, 75, 16936 }, // Ş
-    { 10, 20, 12, 1, 14, 50, 17011 }, // ş
-    { 12, 25, 14, 1, 24, 75, 17061 }, // Š
-    { 10, 21, 12, 1, 20, 53, 17136 }, // š
-    { 14, 24, 15, 0, 18, 84, 17189 }, // Ţ
-    { 9, 23, 10, 0, 17, 52, 17273 }, // ţ
-    { 14, 24, 15, 0, 24, 84, 17325 }, // Ť
-    { 12, 20, 13, 0, 19, 60, 17409 }, // ť
-    { 14, 18, 15, 0, 18, 63, 17469 }, // Ŧ
-    { 9, 18, 10, 0, 17, 41, 17532 }, // ŧ
-    { 14, 24, 18, 2, 23, 84, 17573 }, // Ũ
-    { 13, 20, 15, 1, 19, 65, 17657 }, // ũ
-    { 14, 22, 18, 2, 21, 77, 17722 }, // Ū
-    { 13, 18, 15, 1, 17, 59, 17799 }, // ū
-    { 14, 24, 18, 2, 23, 84, 17858 }, // Ŭ
-    { 13, 20, 15, 1, 19, 65, 17942 }, // ŭ
-    { 14, 26, 18, 2, 25, 91, 18007 }, // Ů
-    { 13, 22, 15, 1, 21, 72, 18098 }, // ů
-    { 14, 25, 18, 2, 24, 88, 18170 }, // Ű
-    { 13, 21, 15, 1, 20, 69, 18258 }, // ű
-    { 14, 24, 18, 2, 18, 84, 18327 }, // Ų
-    { 13, 20, 15, 1, 14, 65, 18411 }, // ų
-    { 23, 24, 24, 0, 24, 138, 18476 }, // Ŵ
-    { 20, 20, 21, 0, 20, 100, 18614 }, // ŵ
-    { 15, 24, 16, 0, 24, 90, 18714 }, // Ŷ
-    { 13, 26, 14, 0, 20, 85, 18804 }, // ŷ
-    { 15, 23, 16, 0, 23, 87, 18889 }, // Ÿ
-    { 14, 24, 15, 0, 24, 84, 18976 }, // Ź
-    { 11, 20, 12, 0, 20, 55, 19060 }, // ź
-    { 14, 23, 15, 0, 23, 81, 19115 }, // Ż
-    { 11, 19, 12, 0, 19, 53, 19196 }, // ż
-    { 14, 24, 15, 0, 24, 84, 19249 }, // Ž
-    { 11, 20, 12, 0, 20, 55, 19333 }, // ž
-    { 8, 20, 11, 2, 20, 40, 19388 }, // ſ
-    { 20, 20, 22, 1, 19, 100, 19428 }, // Ơ
-    { 16, 17, 18, 1, 16, 68, 19528 }, // ơ
-    { 24, 20, 27, 1, 19, 120, 19596 }, // Ƣ
-    { 19, 20, 21, 1, 14, 95, 19716 }, // ƣ
-    { 16, 18, 17, 0, 18, 72, 19811 }, // Ƥ
-    { 12, 26, 15, 2, 20, 78, 19883 }, // ƥ
-    { 14, 21, 17, 2, 18, 74, 19961 }, // Ʀ
-    { 12, 20, 14, 1, 19, 60, 20035 }, // Ƨ
-    { 10, 15, 12, 1, 14, 38, 20095 }, // ƨ
-    { 14, 18, 15, 0, 18, 63, 20133 }, // Ʃ
-    { 12, 26, 12, -1, 20, 78, 20196 }, // ƪ
-    { 9, 23, 10, 0, 17, 52, 20274 }, // ƫ
-    { 15, 18, 16, 0, 18, 68, 20326 }, // Ƭ
-    { 9, 21, 10, 0, 20, 48, 20394 }, // ƭ
-    { 14, 24, 15, 0, 18, 84, 20442 }, // Ʈ
-    { 19, 20, 22, 2, 19, 95, 20526 }, // Ư
-    { 17, 17, 19, 1, 16, 73, 20621 }, // ư
-    { 6, 5, 0, -13, 20, 8, 20694 }, // ̀
-    { 6, 5, 0, -9, 20, 8, 20702 }, // ́
-    { 10, 5, 6, -5, 20, 13, 20710 }, // ̂
-    { 10, 4, 0, -13, 19, 10, 20723 }, // ̃
-    { 8, 2, 5, -4, 17, 4, 20733 }, // ̄
-    { 12, 3, 7, -6, 22, 9, 20737 }, // ̅
-    { 8, 4, 5, -4, 19, 8, 20746 }, // ̆
-    { 4, 4, 3, -2, 19, 4, 20754 }, // ̇
-    { 8, 4, 5, -4, 19, 8, 20758 }, // ̈
-    { 6, 7, 0, -10, 21, 11, 20766 }, // ̉
-    { 6, 6, 4, -3, 21, 9, 20777 }, // ̊
-    { 10, 5, 7, -4, 20, 13, 20786 }, // ̋
-    { 10, 5, 6, -5, 20, 13, 20799 }, // ̌
-    { 2, 5, 2, -1, 19, 3, 20812 }, // ̍
-    { 6, 5, 4, -3, 19, 8, 20815 }, // ̎
-    { 10, 5, 0, -13, 20, 13, 20823 }, // ̏
-    { 8, 7, 5, -4, 22, 14, 20836 }, // ̐
-    { 8, 4, 5, -4, 19, 8, 20850 }, // ̑
-    { 4, 7, 3, -2, 18, 7, 20858 }, // ̒
-    { 4, 7, 3, -2, 18, 7, 20865 }, // ̓
-    { 4, 7, 3, -2, 18, 7, 20872 }, // ̔
-    { 4, 7, 3, -2, 18, 7, 20879 }, // ̕
-    { 6, 5, 4, -3, 0, 8, 20886 }, // ̖
-    { 6, 5, 4, -3, 0, 8, 20894 }, // ̗
-    { 6, 6, 4, -3, 0, 9, 20902 }, // ̘
-    { 6, 6, 4, -3, 0, 9, 20911 }, // ̙
-    { 7, 6, 8, 0, 19, 11, 20920 }, // ̚
-    { 6, 6, 4, -3, 19, 9, 20931 }, // ̛
-    { 4, 6, 3, -2, 0, 6, 20940 }, // ̜
-    { 6, 5, 4, -3, -1, 8, 20946 }, // ̝
-    { 6, 5, 4, -3, -1, 8, 20954 }, // ̞
-    { 6, 6, 4, -3, 0, 9, 20962 }, // ̟
-    { 6, 3, 4, -3, -2, 5, 20971 }, // ̠
-    { 5, 8, 1, -5, 2, 10, 20976 }, // ̡
-    { 5, 8, 6, 0, 2, 10, 20986 }, // ̢
-    { 3, 4, 0, -9, -1, 3, 20996 }, // ̣
-    { 8, 4, 5, -4, -1, 8, 20999 }, // ̤
-    { 6, 6, 4, -3, 0, 9, 21007 }, // ̥
-    { 4, 5, 3, -2, -1, 5, 21016 }, // ̦
-    { 6, 6, 4, -3, 0, 9, 21021 }, // ̧
-    { 6, 7, 4, -3, 1, 11, 21030 }, // ̨
-    { 2, 5, 2, -1, -1, 3, 21041 }, // ̩
-    { 10, 5, 6, -5, -1, 13, 21044 }, // ̪
-    { 10, 4, 6, -5, -1, 10, 21057 }, // ̫
-    { 10, 5, 6, -5, 0, 13, 21067 }, // ̬
-    { 10, 5, 6, -5, 0, 13, 21080 }, // ̭
-    { 8, 4, 5, -4, -1, 8, 21093 }, // ̮
-    { 8, 4, 5, -4, -1, 8, 21101 }, // ̯
-    { 10, 4, 6, -5, -1, 10, 21109 }, // ̰
-    { 8, 2, 5, -4, -2, 4, 21119 }, // ̱
-    { 12, 2, 7, -6, -2, 6, 21123 }, // ̲
-    { 12, 6, 7, -6, 0, 18, 21129 }, // ̳
-    { 10, 4, 6, -5, 9, 10, 21147 }, // ̴
-    { 12, 3, 7, -6, 9, 9, 21157 }, // ̵
-    { 18, 2, 10, -9, 8, 9, 21166 }, // ̶
-    { 8, 6, 5, -4, 10, 12, 21175 }, // ̷
-    { 10, 21, 6, -5, 19, 53, 21187 }, // ̸
-    { 4, 6, 3, -2, 0, 6, 21240 }, // ̹
-    { 10, 5, 6, -5, -1, 13, 21246 }, // ̺
-    { 10, 6, 6, -5, 0, 15, 21259 }, // ̻
-    { 10, 4, 6, -5, -1, 10, 21274 }, // ̼
-    { 6, 6, 4, -3, 20, 9, 21284 }, // ̽
-    { 4, 8, 3, -2, 22, 8, 21293 }, // ̾
-    { 12, 6, 7, -6, 25, 18, 21301 }, // ̿
-    { 6, 5, 3, -4, 20, 8, 21319 }, // ̀
-    { 6, 5, 6, -1, 20, 8, 21327 }, // ́
-    { 10, 4, 6, -5, 19, 10, 21335 }, // ͂
-    { 4, 5, 3, -2, 20, 5, 21345 }, // ̓
-    { 9, 5, 6, -4, 20, 12, 21350 }, // ̈́
-    { 4, 4, 4, -1, -2, 4, 21362 }, // ͅ
-    { 12, 6, 7, -6, 20, 18, 21366 }, // ͆
-    { 12, 6, 7, -6, 0, 18, 21384 }, // ͇
-    { 6, 5, 4, -3, -1, 8, 21402 }, // ͈
-    { 6, 5, 4, -3, -1, 8, 21410 }, // ͉
-    { 10, 6, 6, -5, 20, 15, 21418 }, // ͊
-    { 10, 10, 6, -5, 24, 25, 21433 }, // ͋
-    { 10, 7, 6, -5, 22, 18, 21458 }, // ͌
-    { 10, 6, 6, -5, 0, 15, 21476 }, // ͍
-    { 6, 6, 4, -3, 0, 9, 21491 }, // ͎
-    { 18, 18, 10, -9, 18, 81, 21500 }, // ͏
-    { 5, 6, 3, -3, 20, 8, 21581 }, // ͐
-    { 4, 6, 3, -2, 21, 6, 21589 }, // ͑
-    { 8, 6, 5, -4, 21, 12, 21595 }, // ͒
-    { 6, 6, 4, -3, 0, 9, 21607 }, // ͓
-    { 5, 5, 3, -3, -1, 7, 21616 }, // ͔
-    { 5, 5, 3, -3, -1, 7, 21623 }, // ͕
-    { 10, 5, 6, -5, -1, 13, 21630 }, // ͖
-    { 4, 6, 3, -2, 21, 6, 21643 }, // ͗
-    { 3, 4, 7, 3, 19, 3, 21649 }, // ͘
-    { 6, 6, 4, -3, 0, 9, 21652 }, // ͙
-    { 10, 6, 6, -5, 0, 15, 21661 }, // ͚
-    { 6, 6, 4, -3, 20, 9, 21676 }, // ͛
-    { 20, 5, 11, -10, -1, 25, 21685 }, // ͜
-    { 20, 5, 11, -10, 19, 25, 21710 }, // ͝
-    { 16, 2, 9, -8, 17, 8, 21735 }, // ͞
-    { 16, 2, 9, -8, -2, 8, 21743 }, // ͟
-    { 20, 4, 11, -10, 19, 20, 21751 }, // ͠
-    { 20, 6, 11, -10, 22, 30, 21771 }, // ͡
-    { 21, 6, 12, -10, 0, 32, 21801 }, // ͢
-    { 6, 6, 4, -3, 21, 9, 21833 }, // ͣ
-    { 6, 6, 4, -3, 21, 9, 21842 }, // ͤ
-    { 2, 8, 2, -1, 23, 4, 21851 }, // ͥ
-    { 7, 6, 5, -3, 21, 11, 21855 }, // ͦ
-    { 6, 6, 4, -3, 21, 9, 21866 }, // ͧ
-    { 5, 6, 4, -2, 21, 8, 21875 }, // ͨ
-    { 6, 9, 4, -3, 24, 14, 21883 }, // ͩ
-    { 6, 9, 4, -3, 24, 14, 21897 }, // ͪ
-    { 10, 6, 6, -5, 21, 15, 21911 }, // ͫ
-    { 5, 6, 4, -2, 21, 8, 21926 }, // ͬ
-    { 5, 8, 4, -2, 23, 10, 21934 }, // ͭ
-    { 7, 6, 5, -3, 21, 11, 21944 }, // ͮ
-    { 7, 6, 5, -3, 21, 11, 21955 }, // ͯ
-    { 16, 18, 17, 0, 18, 72, 21966 }, // Α
-    { 13, 18, 16, 2, 18, 59, 22038 }, // Β
-    { 10, 18, 13, 2, 18, 45, 22097 }, // Γ
-    { 16, 18, 17, 0, 18, 72, 22142 }, // Δ
-    { 11, 18, 14, 2, 18, 50, 22214 }, // Ε
-    { 14, 18, 15, 0, 18, 63, 22264 }, // Ζ
-    { 15, 18, 19, 2, 18, 68, 22327 }, // Η
-    { 17, 20, 20, 1, 19, 85, 22395 }, // Θ
-    { 7, 18, 9, 1, 18, 32, 22480 }, // Ι
-    { 14, 18, 17, 2, 18, 63, 22512 }, // Κ
-    { 16, 18, 17, 0, 18, 72, 22575 }, // Λ
-    { 19, 18, 23, 2, 18, 86, 22647 }, // Μ
-    { 15, 18, 19, 2, 18, 68, 22733 }, // Ν
-    { 14, 18, 16, 1, 18, 63, 22801 }, // Ξ
-    { 17, 20, 20, 1, 19, 85, 22864 }, // Ο
-    { 14, 18, 18, 2, 18, 63, 22949 }, // Π
-    { 12, 18, 15, 2, 18, 54, 23012 }, // Ρ
-    { 14, 18, 15, 0, 18, 63, 23066 }, // Σ
-    { 14, 18, 15, 0, 18, 63, 23129 }, // Τ
-    { 15, 18, 16, 0, 18, 68, 23192 }, // Υ
-    { 19, 18, 21, 1, 18, 86, 23260 }, // Φ
-    { 15, 18, 16, 0, 18, 68, 23346 }, // Χ
-    { 17, 18, 21, 2, 18, 77, 23414 }, // Ψ
-    { 18, 19, 19, 0, 19, 86, 23491 }, // Ω
-    { 15, 15, 17, 1, 14, 57, 23577 }, // α
-    { 12, 26, 15, 2, 20, 78, 23634 }, // β
-    { 13, 20, 14, 0, 14, 65, 23712 }, // γ
-    { 13, 21, 15, 1, 20, 69, 23777 }, // δ
-    { 10, 15, 12, 1, 14, 38, 23846 }, // ε
-    { 11, 25, 13, 1, 19, 69, 23884 }, // ζ
-    { 12, 20, 15, 2, 14, 60, 23953 }, // η
-    { 13, 21, 15, 1, 20, 69, 24013 }, // θ
-    { 6, 15, 9, 2, 14, 23, 24082 }, // ι
-    { 12, 14, 15, 2, 14, 42, 24105 }, // κ
-    { 13, 21, 14, 0, 20, 69, 24147 }, // λ
-    { 14, 20, 17, 2, 14, 70, 24216 }, // μ
-    { 13, 14, 14, 0, 14, 46, 24286 }, // ν
-    { 11, 25, 13, 1, 19, 69, 24332 }, // ξ
-    { 13, 15, 15, 1, 14, 49, 24401 }, // ο
-    { 16, 15, 17, 0, 14, 60, 24450 }, // π
-    { 13, 20, 15, 1, 14, 65, 24510 }, // ρ
-    { 11, 20, 13, 1, 14, 55, 24575 }, // ς
-    { 14, 15, 16, 1, 14, 53, 24630 }, // σ
-    { 12, 15, 13, 0, 14, 45, 24683 }, // τ
-    { 13, 15, 15, 1, 14, 49, 24728 }, // υ
-    { 16, 25, 18, 1, 19, 100, 24777 }, // φ
-    { 15, 20, 16, 0, 14, 75, 24877 }, // χ
-    { 16, 25, 19, 1, 19, 100, 24952 }, // ψ
-    { 18, 15, 20, 1, 14, 68, 25052 }, // ω
-    { 16, 23, 17, 0, 18, 92, 25120 }, // Ạ
-    { 11, 19, 14, 1, 14, 53, 25212 }, // ạ
-    { 16, 25, 17, 0, 25, 100, 25265 }, // Ả
-    { 11, 22, 14, 1, 21, 61, 25365 }, // ả
-    { 16, 25, 17, 0, 25, 100, 25426 }, // Ấ
-    { 13, 22, 15, 1, 21, 72, 25526 }, // ấ
-    { 16, 25, 17, 0, 25, 100, 25598 }, // Ầ
-    { 12, 22, 14, 0, 21, 66, 25698 }, // ầ
-    { 16, 26, 17, 0, 26, 104, 25764 }, // Ẩ
-    { 12, 23, 14, 1, 22, 69, 25868 }, // ẩ
-    { 16, 27, 17, 0, 27, 108, 25937 }, // Ẫ
-    { 11, 24, 14, 1, 23, 66, 26045 }, // ẫ
-    { 16, 29, 17, 0, 24, 116, 26111 }, // Ậ
-    { 11, 25, 14, 1, 20, 69, 26227 }, // ậ
-    { 16, 26, 17, 0, 26, 104, 26296 }, // Ắ
-    { 11, 23, 14, 1, 22, 64, 26400 }, // ắ
-    { 16, 26, 17, 0, 26, 104, 26464 }, // Ằ
-    { 11, 23, 14, 1, 22, 64, 26568 }, // ằ
-    { 16, 27, 17, 0, 27, 108, 26632 }, // Ẳ
-    { 11, 23, 14, 1, 22, 64, 26740 }, // ẳ
-    { 16, 27, 17, 0, 27, 108, 26804 }, // Ẵ
-    { 11, 24, 14, 1, 23, 66, 26912 }, // ẵ
-    { 16, 28, 17, 0, 23, 112, 26978 }, // Ặ
-    { 11, 24, 14, 1, 19, 66, 27090 }, // ặ
-    { 11, 23, 14, 2, 18, 64, 27156 }, // Ẹ
-    { 12, 19, 14, 1, 14, 57, 27220 }, // ẹ
-    { 11, 25, 14, 2, 25, 69, 27277 }, // Ẻ
-    { 12, 22, 14, 1, 21, 66, 27346 }, // ẻ
-    { 11, 23, 14, 2, 23, 64, 27412 }, // Ẽ
-    { 12, 20, 14, 1, 19, 60, 27476 }, // ẽ
-    { 12, 25, 15, 2, 25, 75, 27536 }, // Ế
-    { 13, 22, 15, 1, 21, 72, 27611 }, // ế
-    { 13, 25, 14, 0, 25, 82, 27683 }, // Ề
-    { 13, 22, 14, 0, 21, 72, 27765 }, // ề
-    { 12, 26, 15, 2, 26, 78, 27837 }, // Ể
-    { 13, 23, 15, 1, 22, 75, 27915 }, // ể
-    { 11, 27, 14, 2, 27, 75, 27990 }, // Ễ
-    { 12, 24, 14, 1, 23, 72, 28065 }, // ễ
-    { 11, 29, 14, 2, 24, 80, 28137 }, // Ệ
-    { 12, 25, 14, 1, 20, 75, 28217 }, // ệ
-    { 7, 25, 9, 1, 25, 44, 28292 }, // Ỉ
-    { 6, 21, 8, 1, 21, 32, 28336 }, // ỉ
-    { 7, 23, 9, 1, 18, 41, 28368 }, // Ị
-    { 4, 24, 6, 1, 19, 24, 28409 }, // ị
-    { 17, 24, 20, 1, 19, 102, 28433 }, // Ọ
-    { 13, 19, 15, 1, 14, 62, 28535 }, // ọ
-    { 17, 26, 20, 1, 25, 111, 28597 }, // Ỏ
-    { 13, 22, 15, 1, 21, 72, 28708 }, // ỏ
-    { 17, 26, 20, 1, 25, 111, 28780 }, // Ố
-    { 14, 22, 16, 1, 21, 77, 28891 }, // ố
-    { 17, 26, 20, 1, 25, 111, 28968 }, // Ồ
-    { 13, 22, 15, 1, 21, 72, 29079 }, // ồ
-    { 17, 27, 20, 1, 26, 115, 29151 }, // Ổ
-    { 13, 23, 15, 1, 22, 75, 29266 }, // ổ
-    { 17, 28, 20, 1, 27, 119, 29341 }, // Ỗ
-    { 13, 24, 15, 1, 23, 78, 29460 }, // ỗ
-    { 17, 29, 20, 1, 24, 124, 29538 }, // Ộ
-    { 13, 25, 15, 1, 20, 82, 29662 }, // ộ
-    { 20, 25, 22, 1, 24, 125, 29744 }, // Ớ
-    { 16, 21, 18, 1, 20, 84, 29869 }, // ớ
-    { 20, 25, 22, 1, 24, 125, 29953 }, // Ờ
-    { 16, 21, 18, 1, 20, 84, 30078 }, // ờ
-    { 20, 26, 22, 1, 25, 130, 30162 }, // Ở
-    { 16, 22, 18, 1, 21, 88, 30292 }, // ở
-    { 20, 24, 22, 1, 23, 120, 30380 }, // Ỡ
-    { 16, 20, 18, 1, 19, 80, 30500 }, // ỡ
-    { 20, 24, 22, 1, 19, 120, 30580 }, // Ợ
-    { 16, 21, 18, 1, 16, 84, 30700 }, // ợ
-    { 14, 23, 18, 2, 18, 81, 30784 }, // Ụ
-    { 13, 19, 15, 1, 14, 62, 30865 }, // ụ
-    { 14, 26, 18, 2, 25, 91, 30927 }, // Ủ
-    { 13, 22, 15, 1, 21, 72, 31018 }, // ủ
-    { 19, 25, 22, 2, 24, 119, 31090 }, // Ứ
-    { 17, 21, 19, 1, 20, 90, 31209 }, // ứ
-    { 19, 25, 22, 2, 24, 119, 31299 }, // Ừ
-    { 17, 21, 19, 1, 20, 90, 31418 }, // ừ
-    { 19, 26, 22, 2, 25, 124, 31508 }, // Ử
-    { 17, 22, 19, 1, 21, 94, 31632 }, // ử
-    { 19, 24, 22, 2, 23, 114, 31726 }, // Ữ
-    { 17, 20, 19, 1, 19, 85, 31840 }, // ữ
-    { 19, 24, 22, 2, 19, 114, 31925 }, // Ự
-    { 17, 21, 19, 1, 16, 90, 32039 }, // ự
-    { 15, 24, 16, 0, 24, 90, 32129 }, // Ỳ
-    { 13, 26, 14, 0, 20, 85, 32219 }, // ỳ
-    { 15, 23, 16, 0, 18, 87, 32304 }, // Ỵ
-    { 13, 20, 14, 0, 14, 65, 32391 }, // ỵ
-    { 15, 25, 16, 0, 25, 94, 32456 }, // Ỷ
-    { 13, 27, 14, 0, 21, 88, 32550 }, // ỷ
-    { 15, 23, 16, 0, 23, 87, 32638 }, // Ỹ
-    { 13, 25, 14, 0, 19, 82, 32725 }, // ỹ
-    { 0, 0, 13, 0, 0, 0, 32807 }, //  
-    { 0, 0, 25, 0, 0, 0, 32807 }, //  
-    { 0, 0, 13, 0, 0, 0, 32807 }, //  
-    { 0, 0, 25, 0, 0, 0, 32807 }, //  
-    { 0, 0, 8, 0, 0, 0, 32807 }, //  
-    { 0, 0, 6, 0, 0, 0, 32807 }, //  
-    { 0, 0, 4, 0, 0, 0, 32807 }, //  
-    { 0, 0, 14, 0, 0, 0, 32807 }, //  
-    { 0, 0, 7, 0, 0, 0, 32807 }, //  
-    { 0, 0, 4, 0, 0, 0, 32807 }, //  
-    { 0, 0, 3, 0, 0, 0, 32807 }, //  
-    { 0, 0, 1, 0, 0, 0, 32807 }, // ​
-    { 0, 0, 1, 0, 0, 0, 32807 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 32807 }, // ‍
-    { 7, 22, 7, -1, 18, 39, 32807 }, // ‎
-    { 7, 22, 2, -6, 18, 39, 32846 }, // ‏
-    { 7, 3, 9, 1, 8, 6, 32885 }, // ‐
-    { 7, 3, 9, 1, 8, 6, 32891 }, // ‑
-    { 13, 2, 15, 1, 10, 7, 32897 }, // ‒
-    { 11, 3, 13, 1, 8, 9, 32904 }, // –
-    { 23, 3, 25, 1, 8, 18, 32913 }, // —
-    { 23, 3, 25, 1, 8, 18, 32931 }, // ―
-    { 8, 26, 14, 3, 19, 52, 32949 }, // ‖
-    { 12, 6, 12, -1, 0, 18, 33001 }, // ‗
-    { 5, 7, 6, 0, 18, 9, 33019 }, // ‘
-    { 5, 7, 6, 0, 18, 9, 33028 }, // ’
-    { 5, 7, 6, 0, 3, 9, 33037 }, // ‚
-    { 5, 7, 6, 0, 18, 9, 33046 }, // ‛
-    { 9, 7, 10, 0, 18, 16, 33055 }, // “
-    { 9, 7, 10, 0, 18, 16, 33071 }, // ”
-    { 10, 7, 11, 0, 3, 18, 33087 }, // „
-    { 9, 7, 10, 0, 18, 16, 33105 }, // ‟
-    { 11, 19, 13, 1, 19, 53, 33121 }, // †
-    { 11, 19, 13, 1, 19, 53, 33174 }, // ‡
-    { 7, 7, 9, 1, 13, 13, 33227 }, // •
-    { 8, 8, 10, 1, 13, 16, 33240 }, // ‣
-    { 4, 5, 13, 4, 4, 5, 33256 }, // ․
-    { 11, 5, 13, 1, 4, 14, 33261 }, // ‥
-    { 17, 5, 20, 1, 4, 22, 33275 }, // …
-    { 4, 5, 7, 1, 9, 5, 33297 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 33302 }, //  
-    { 0, 0, 15, 0, 0, 0, 33302 }, //  
-    { 7, 20, 7, -1, 16, 35, 33302 }, // ‪
-    { 7, 20, 2, -6, 16, 35, 33337 }, // ‫
-    { 6, 22, 4, -3, 18, 33, 33372 }, // ‬
-    { 6, 22, 4, -3, 18, 33, 33405 }, // ‭
-    { 6, 22, 4, -3, 18, 33, 33438 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 33471 }, //  
-    { 28, 20, 30, 1, 19, 140, 33471 }, // ‰
-    { 37, 20, 39, 1, 19, 185, 33611 }, // ‱
-    { 7, 7, 8, 0, 18, 13, 33796 }, // ′
-    { 11, 7, 12, 0, 18, 20, 33809 }, // ″
-    { 16, 7, 17, 0, 18, 28, 33829 }, // ‴
-    { 6, 7, 6, -1, 18, 11, 33857 }, // ‵
-    { 10, 7, 11, -1, 18, 18, 33868 }, // ‶
-    { 14, 7, 15, -1, 18, 25, 33886 }, // ‷
-    { 10, 9, 11, 0, 3, 23, 33911 }, // ‸
-    { 6, 11, 8, 1, 12, 17, 33934 }, // ‹
-    { 7, 11, 8, 0, 12, 20, 33951 }, // ›
-    { 19, 20, 21, 1, 19, 95, 33971 }, // ※
-    { 10, 19, 12, 1, 18, 48, 34066 }, // ‼
-    { 11, 20, 12, 0, 19, 55, 34114 }, // ‽
-    { 14, 2, 14, -1, 21, 7, 34169 }, // ‾
-    { 15, 6, 16, 0, 0, 23, 34176 }, // ‿
-    { 15, 6, 16, 0, 20, 23, 34199 }, // ⁀
-    { 9, 17, 10, 0, 11, 39, 34222 }, // ⁁
-    { 28, 23, 29, 0, 19, 161, 34261 }, // ⁂
-    { 7, 3, 9, 1, 8, 6, 34422 }, // ⁃
-    { 13, 18, 9, -5, 18, 59, 34428 }, // ⁄
-    { 7, 22, 9, 1, 18, 39, 34487 }, // ⁅
-    { 7, 22, 8, 0, 18, 39, 34526 }, // ⁆
-    { 21, 20, 22, 0, 19, 105, 34565 }, // ⁇
-    { 16, 20, 17, 0, 19, 80, 34670 }, // ⁈
-    { 16, 20, 18, 1, 19, 80, 34750 }, // ⁉
-    { 13, 14, 14, 0, 14, 46, 34830 }, // ⁊
-    { 13, 23, 16, 2, 19, 75, 34876 }, // ⁋
-    { 13, 14, 16, 1, 14, 46, 34951 }, // ⁌
-    { 13, 14, 16, 2, 14, 46, 34997 }, // ⁍
-    { 12, 12, 14, 1, 6, 36, 35043 }, // ⁎
-    { 5, 18, 7, 1, 14, 23, 35079 }, // ⁏
-    { 15, 26, 16, 0, 20, 98, 35102 }, // ⁐
-    { 12, 25, 14, 1, 19, 75, 35200 }, // ⁑
-    { 10, 20, 11, 0, 19, 50, 35275 }, // ⁒
-    { 23, 5, 25, 1, 10, 29, 35325 }, // ⁓
-    { 15, 6, 16, 0, 0, 23, 35354 }, // ⁔
-    { 14, 14, 15, 0, 13, 49, 35377 }, // ⁕
-    { 11, 20, 13, 1, 19, 55, 35426 }, // ⁖
-    { 20, 7, 21, 0, 18, 35, 35481 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 35516 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 35611 }, // ⁙
-    { 4, 20, 6, 1, 19, 20, 35706 }, // ⁚
-    { 15, 20, 17, 1, 19, 75, 35726 }, // ⁛
-    { 19, 20, 20, 0, 19, 95, 35801 }, // ⁜
-    { 4, 19, 7, 1, 18, 19, 35896 }, // ⁝
-    { 4, 20, 7, 1, 19, 20, 35915 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 35935 }, //  
-    { 0, 0, 15, 0, 0, 0, 35935 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 35935 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 35935 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 35935 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 35935 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 35935 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 35935 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 35935 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 35935 }, // ⁩
-    { 6, 22, 4, -3, 18, 33, 35935 }, // ⁪
-    { 6, 22, 4, -3, 18, 33, 35968 }, // ⁫
-    { 6, 22, 4, -3, 18, 33, 36001 }, // ⁬
-    { 6, 22, 4, -3, 18, 33, 36034 }, // ⁭
-    { 6, 22, 4, -3, 18, 33, 36067 }, // ⁮
-    { 6, 22, 4, -3, 18, 33, 36100 }, // ⁯
-    { 9, 12, 10, 0, 22, 27, 36133 }, // ⁰
-    { 2, 12, 4, 1, 19, 6, 36160 }, // ⁱ
-    { 9, 12, 10, 0, 22, 27, 36166 }, // ⁴
-    { 8, 12, 9, 0, 22, 24, 36193 }, // ⁵
-    { 9, 12, 10, 0, 22, 27, 36217 }, // ⁶
-    { 9, 12, 10, 0, 22, 27, 36244 }, // ⁷
-    { 9, 12, 10, 0, 22, 27, 36271 }, // ⁸
-    { 9, 12, 10, 0, 22, 27, 36298 }, // ⁹
-    { 8, 8, 9, 0, 19, 16, 36325 }, // ⁺
-    { 8, 2, 9, 0, 16, 4, 36341 }, // ⁻
-    { 8, 5, 9, 0, 17, 10, 36345 }, // ⁼
-    { 5, 14, 7, 1, 23, 18, 36355 }, // ⁽
-    { 5, 14, 6, 0, 23, 18, 36373 }, // ⁾
-    { 8, 9, 10, 1, 16, 18, 36391 }, // ⁿ
-    { 9, 12, 10, 0, 8, 27, 36409 }, // ₀
-    { 6, 12, 9, 0, 8, 18, 36436 }, // ₁
-    { 8, 12, 9, 0, 8, 24, 36454 }, // ₂
-    { 9, 12, 10, 0, 8, 27, 36478 }, // ₃
-    { 9, 12, 10, 0, 8, 27, 36505 }, // ₄
-    { 8, 12, 9, 0, 8, 24, 36532 }, // ₅
-    { 9, 12, 10, 0, 8, 27, 36556 }, // ₆
-    { 9, 12, 10, 0, 8, 27, 36583 }, // ₇
-    { 9, 12, 10, 0, 8, 27, 36610 }, // ₈
-    { 9, 12, 10, 0, 8, 27, 36637 }, // ₉
-    { 8, 8, 9, 0, 6, 16, 36664 }, // ₊
-    { 8, 2, 9, 0, 3, 4, 36680 }, // ₋
-    { 8, 5, 9, 0, 4, 10, 36684 }, // ₌
-    { 5, 14, 7, 1, 9, 18, 36694 }, // ₍
-    { 5, 14, 6, 0, 9, 18, 36712 }, // ₎
-    { 8, 9, 9, 0, 6, 18, 36730 }, // ₐ
-    { 9, 9, 10, 0, 6, 21, 36748 }, // ₑ
-    { 9, 9, 10, 0, 6, 21, 36769 }, // ₒ
-    { 9, 9, 10, 0, 6, 21, 36790 }, // ₓ
-    { 9, 9, 10, 0, 6, 21, 36811 }, // ₔ
-    { 8, 12, 10, 1, 9, 24, 36832 }, // ₕ
-    { 8, 12, 10, 1, 9, 24, 36856 }, // ₖ
-    { 2, 12, 4, 1, 9, 6, 36880 }, // ₗ
-    { 13, 9, 15, 1, 6, 30, 36886 }, // ₘ
-    { 8, 9, 10, 1, 6, 18, 36916 }, // ₙ
-    { 9, 12, 11, 1, 6, 27, 36934 }, // ₚ
-    { 8, 9, 9, 0, 6, 18, 36961 }, // ₛ
-    { 6, 11, 7, 0, 8, 17, 36979 }, // ₜ
-    { 14, 19, 15, 0, 19, 67, 36996 }, // ₠
-    { 13, 21, 15, 1, 19, 69, 37063 }, // ₡
-    { 13, 20, 15, 1, 19, 65, 37132 }, // ₢
-    { 12, 18, 14, 1, 18, 54, 37197 }, // ₣
-    { 14, 19, 15, 0, 19, 67, 37251 }, // ₤
-    { 20, 20, 23, 2, 17, 100, 37318 }, // ₥
-    { 15, 18, 16, 0, 18, 68, 37418 }, // ₦
-    { 18, 19, 20, 1, 18, 86, 37486 }, // ₧
-    { 18, 19, 21, 2, 18, 86, 37572 }, // ₨
-    { 17, 18, 18, 0, 18, 77, 37658 }, // ₩
-    { 16, 18, 20, 2, 18, 72, 37735 }, // ₪
-    { 15, 23, 17, 1, 19, 87, 37807 }, // ₫
-    { 14, 20, 15, 0, 19, 70, 37894 }, // €
-    { 15, 18, 16, 0, 18, 68, 37964 }, // ₭
-    { 14, 18, 15, 0, 18, 63, 38032 }, // ₮
-    { 24, 25, 25, 0, 19, 150, 38095 }, // ₯
-    { 13, 25, 14, 0, 19, 82, 38245 }, // ₰
-    { 15, 18, 16, 0, 18, 68, 38327 }, // ₱
-    { 16, 21, 18, 1, 19, 84, 38395 }, // ₲
-    { 16, 18, 17, 0, 18, 72, 38479 }, // ₳
-    { 14, 20, 15, 0, 19, 70, 38551 }, // ₴
-    { 15, 21, 17, 1, 19, 79, 38621 }, // ₵
-    { 15, 18, 16, 0, 17, 68, 38700 }, // ₶
-    { 17, 21, 18, 0, 19, 90, 38768 }, // ₷
-    { 14, 18, 15, 0, 18, 63, 38858 }, // ₸
-    { 12, 18, 14, 1, 18, 54, 38921 }, // ₹
-    { 14, 19, 15, 0, 18, 67, 38975 }, // ₺
-    { 20, 20, 21, 0, 19, 100, 39042 }, // ₻
-    { 18, 18, 20, 1, 18, 81, 39142 }, // ₼
-    { 14, 18, 15, 0, 18, 63, 39223 }, // ₽
-    { 17, 20, 19, 1, 20, 85, 39286 }, // ₾
-    { 12, 24, 15, 2, 21, 72, 39371 }, // ₿
-    { 10, 18, 12, 1, 14, 45, 39443 }, // ⃀
-    { 12, 3, 14, 1, 10, 9, 39488 }, // −
-    { 23, 23, 25, 1, 19, 133, 39497 }, // �
+    { 4, 19, 7, 1, 18, 28, 0 }, // !
+    { 8, 7, 10, 1, 18, 22, 28 }, // "
+    { 16, 18, 17, 0, 18, 62, 50 }, // #
+    { 12, 21, 14, 1, 19, 60, 112 }, // $
+    { 19, 20, 21, 1, 19, 92, 172 }, // %
+    { 18, 20, 20, 1, 19, 70, 264 }, // &
+    { 3, 7, 6, 1, 18, 9, 334 }, // '
+    { 6, 22, 8, 1, 18, 33, 343 }, // (
+    { 7, 22, 8, 0, 18, 34, 376 }, // )
+    { 12, 12, 14, 1, 19, 29, 410 }, // *
+    { 12, 13, 14, 1, 15, 24, 439 }, // +
+    { 4, 7, 7, 1, 3, 10, 463 }, // ,
+    { 7, 3, 9, 1, 8, 9, 473 }, // -
+    { 4, 5, 7, 1, 4, 6, 482 }, // .
+    { 10, 18, 11, 0, 18, 28, 488 }, // /
+    { 13, 20, 15, 1, 19, 54, 516 }, // 0
+    { 7, 18, 14, 2, 18, 30, 570 }, // 1
+    { 12, 19, 14, 1, 19, 33, 600 }, // 2
+    { 12, 20, 14, 1, 19, 43, 633 }, // 3
+    { 14, 18, 15, 0, 18, 40, 676 }, // 4
+    { 12, 19, 14, 1, 18, 42, 716 }, // 5
+    { 13, 20, 15, 1, 19, 53, 758 }, // 6
+    { 13, 18, 15, 1, 18, 36, 811 }, // 7
+    { 13, 20, 15, 1, 19, 55, 847 }, // 8
+    { 12, 20, 14, 1, 19, 52, 902 }, // 9
+    { 4, 15, 7, 1, 14, 13, 954 }, // :
+    { 5, 18, 7, 0, 14, 17, 967 }, // ;
+    { 13, 14, 15, 1, 16, 28, 984 }, // <
+    { 12, 8, 14, 1, 13, 20, 1012 }, // =
+    { 13, 14, 15, 1, 16, 28, 1032 }, // >
+    { 11, 20, 12, 0, 19, 32, 1060 }, // ?
+    { 21, 21, 23, 1, 18, 101, 1092 }, // @
+    { 16, 18, 17, 0, 18, 59, 1193 }, // A
+    { 13, 18, 16, 2, 18, 60, 1252 }, // B
+    { 15, 20, 17, 1, 19, 44, 1312 }, // C
+    { 15, 18, 18, 2, 18, 64, 1356 }, // D
+    { 11, 18, 14, 2, 18, 45, 1420 }, // E
+    { 11, 18, 14, 2, 18, 44, 1465 }, // F
+    { 16, 20, 18, 1, 19, 57, 1509 }, // G
+    { 15, 18, 19, 2, 18, 69, 1566 }, // H
+    { 7, 18, 9, 1, 18, 29, 1635 }, // I
+    { 7, 23, 7, -2, 18, 47, 1664 }, // J
+    { 14, 18, 17, 2, 18, 64, 1711 }, // K
+    { 11, 18, 14, 2, 18, 37, 1775 }, // L
+    { 19, 18, 23, 2, 18, 94, 1812 }, // M
+    { 15, 18, 19, 2, 18, 77, 1906 }, // N
+    { 17, 20, 20, 1, 19, 59, 1983 }, // O
+    { 12, 18, 15, 2, 18, 52, 2042 }, // P
+    { 17, 24, 20, 1, 19, 69, 2094 }, // Q
+    { 14, 18, 17, 2, 18, 64, 2163 }, // R
+    { 12, 20, 14, 1, 19, 44, 2227 }, // S
+    { 14, 18, 15, 0, 18, 30, 2271 }, // T
+    { 14, 19, 18, 2, 18, 43, 2301 }, // U
+    { 15, 18, 16, 0, 18, 53, 2344 }, // V
+    { 23, 18, 24, 0, 18, 92, 2397 }, // W
+    { 15, 18, 16, 0, 18, 53, 2489 }, // X
+    { 15, 18, 16, 0, 18, 43, 2542 }, // Y
+    { 14, 18, 15, 0, 18, 38, 2585 }, // Z
+    { 6, 22, 9, 2, 18, 24, 2623 }, // [
+    { 10, 18, 11, 0, 18, 28, 2647 }, // <backslash>
+    { 7, 22, 8, 0, 18, 26, 2675 }, // ]
+    { 14, 12, 15, 0, 18, 34, 2701 }, // ^
+    { 13, 2, 13, -1, -2, 5, 2735 }, // _
+    { 6, 5, 8, 1, 20, 7, 2740 }, // `
+    { 11, 15, 14, 1, 14, 36, 2747 }, // a
+    { 12, 20, 15, 2, 19, 49, 2783 }, // b
+    { 11, 15, 13, 1, 14, 30, 2832 }, // c
+    { 13, 20, 15, 1, 19, 56, 2862 }, // d
+    { 12, 15, 14, 1, 14, 41, 2918 }, // e
+    { 10, 20, 11, 0, 20, 36, 2959 }, // f
+    { 13, 20, 15, 1, 14, 59, 2995 }, // g
+    { 12, 19, 15, 2, 19, 48, 3054 }, // h
+    { 4, 19, 6, 1, 19, 26, 3102 }, // i
+    { 7, 25, 6, -2, 19, 37, 3128 }, // j
+    { 12, 19, 15, 2, 19, 49, 3165 }, // k
+    { 3, 19, 6, 2, 19, 19, 3214 }, // l
+    { 20, 14, 23, 2, 14, 63, 3233 }, // m
+    { 12, 14, 15, 2, 14, 38, 3296 }, // n
+    { 13, 15, 15, 1, 14, 43, 3334 }, // o
+    { 12, 20, 15, 2, 14, 51, 3377 }, // p
+    { 13, 20, 15, 1, 14, 57, 3428 }, // q
+    { 8, 14, 11, 2, 14, 24, 3485 }, // r
+    { 10, 15, 12, 1, 14, 34, 3509 }, // s
+    { 9, 18, 10, 0, 17, 37, 3543 }, // t
+    { 13, 15, 15, 1, 14, 42, 3580 }, // u
+    { 13, 14, 14, 0, 14, 38, 3622 }, // v
+    { 20, 14, 21, 0, 14, 68, 3660 }, // w
+    { 13, 14, 14, 0, 14, 38, 3728 }, // x
+    { 13, 20, 14, 0, 14, 51, 3766 }, // y
+    { 11, 14, 12, 0, 14, 32, 3817 }, // z
+    { 9, 22, 10, 0, 18, 36, 3849 }, // {
+    { 3, 26, 14, 5, 19, 26, 3885 }, // |
+    { 9, 22, 10, 0, 18, 36, 3911 }, // }
+    { 13, 4, 15, 1, 11, 14, 3947 }, // ~
+    { 0, 0, 7, 0, 0, 0, 3961 }, //  
+    { 4, 19, 7, 1, 14, 28, 3961 }, // ¡
+    { 11, 20, 14, 2, 19, 35, 3989 }, // ¢
+    { 14, 19, 15, 0, 19, 47, 4024 }, // £
+    { 12, 12, 14, 1, 15, 38, 4071 }, // ¤
+    { 14, 18, 15, 0, 18, 46, 4109 }, // ¥
+    { 3, 26, 14, 5, 19, 22, 4155 }, // ¦
+    { 11, 21, 13, 1, 20, 49, 4177 }, // §
+    { 8, 4, 15, 3, 19, 7, 4226 }, // ¨
+    { 19, 20, 21, 1, 19, 83, 4233 }, // ©
+    { 8, 10, 9, 0, 19, 27, 4316 }, // ª
+    { 11, 11, 13, 1, 12, 33, 4343 }, // «
+    { 12, 7, 14, 1, 10, 16, 4376 }, // ¬
+    { 7, 3, 9, 1, 8, 9, 4392 }, // ­
+    { 19, 20, 21, 1, 19, 90, 4401 }, // ®
+    { 14, 2, 14, -1, 21, 10, 4491 }, // ¯
+    { 9, 9, 11, 1, 19, 24, 4501 }, // °
+    { 13, 15, 15, 1, 15, 25, 4525 }, // ±
+    { 8, 12, 9, 0, 22, 26, 4550 }, // ²
+    { 9, 12, 10, 0, 22, 24, 4576 }, // ³
+    { 6, 5, 8, 1, 20, 7, 4600 }, // ´
+    { 12, 20, 16, 2, 14, 50, 4607 }, // µ
+    { 13, 23, 16, 1, 19, 75, 4657 }, // ¶
+    { 4, 5, 7, 1, 11, 6, 4732 }, // ·
+    { 6, 6, 7, 0, 0, 12, 4738 }, // ¸
+    { 6, 12, 9, 0, 22, 14, 4750 }, // ¹
+    { 9, 10, 10, 0, 19, 26, 4764 }, // º
+    { 12, 11, 13, 0, 12, 33, 4790 }, // »
+    { 19, 18, 20, 0, 18, 68, 4823 }, // ¼
+    { 19, 18, 20, 0, 18, 72, 4891 }, // ½
+    { 20, 19, 21, 0, 19, 80, 4963 }, // ¾
+    { 11, 19, 12, 0, 14, 36, 5043 }, // ¿
+    { 16, 24, 17, 0, 24, 69, 5079 }, // À
+    { 16, 24, 17, 0, 24, 70, 5148 }, // Á
+    { 16, 24, 17, 0, 24, 72, 5218 }, // Â
+    { 16, 23, 17, 0, 23, 73, 5290 }, // Ã
+    { 16, 23, 17, 0, 23, 70, 5363 }, // Ä
+    { 16, 23, 17, 0, 23, 74, 5433 }, // Å
+    { 22, 18, 22, -1, 18, 72, 5507 }, // Æ
+    { 15, 25, 17, 1, 19, 57, 5579 }, // Ç
+    { 11, 24, 14, 2, 24, 54, 5636 }, // È
+    { 11, 24, 14, 2, 24, 53, 5690 }, // É
+    { 11, 24, 14, 2, 24, 56, 5743 }, // Ê
+    { 11, 23, 14, 2, 23, 52, 5799 }, // Ë
+    { 7, 24, 9, 1, 24, 36, 5851 }, // Ì
+    { 7, 24, 9, 1, 24, 36, 5887 }, // Í
+    { 9, 24, 10, 0, 24, 40, 5923 }, // Î
+    { 8, 23, 9, 0, 23, 37, 5963 }, // Ï
+    { 17, 18, 18, 0, 18, 59, 6000 }, // Ð
+    { 15, 23, 19, 2, 23, 90, 6059 }, // Ñ
+    { 17, 25, 20, 1, 24, 69, 6149 }, // Ò
+    { 17, 25, 20, 1, 24, 69, 6218 }, // Ó
+    { 17, 25, 20, 1, 24, 72, 6287 }, // Ô
+    { 17, 24, 20, 1, 23, 73, 6359 }, // Õ
+    { 17, 24, 20, 1, 23, 68, 6432 }, // Ö
+    { 12, 12, 14, 1, 15, 29, 6500 }, // ×
+    { 17, 20, 20, 1, 19, 73, 6529 }, // Ø
+    { 14, 25, 18, 2, 24, 52, 6602 }, // Ù
+    { 14, 25, 18, 2, 24, 53, 6654 }, // Ú
+    { 14, 25, 18, 2, 24, 55, 6707 }, // Û
+    { 14, 24, 18, 2, 23, 52, 6762 }, // Ü
+    { 15, 24, 16, 0, 24, 53, 6814 }, // Ý
+    { 12, 18, 15, 2, 18, 51, 6867 }, // Þ
+    { 13, 21, 16, 2, 20, 62, 6918 }, // ß
+    { 11, 21, 14, 1, 20, 44, 6980 }, // à
+    { 11, 21, 14, 1, 20, 45, 7024 }, // á
+    { 11, 21, 14, 1, 20, 47, 7069 }, // â
+    { 11, 20, 14, 1, 19, 49, 7116 }, // ã
+    { 11, 20, 14, 1, 19, 46, 7165 }, // ä
+    { 11, 22, 14, 1, 21, 51, 7211 }, // å
+    { 20, 15, 22, 1, 14, 67, 7262 }, // æ
+    { 11, 20, 13, 1, 14, 41, 7329 }, // ç
+    { 12, 21, 14, 1, 20, 49, 7370 }, // è
+    { 12, 21, 14, 1, 20, 50, 7419 }, // é
+    { 12, 21, 14, 1, 20, 52, 7469 }, // ê
+    { 12, 20, 14, 1, 19, 50, 7521 }, // ë
+    { 6, 20, 6, -1, 20, 27, 7571 }, // ì
+    { 6, 20, 8, 1, 20, 29, 7598 }, // í
+    { 9, 20, 9, -1, 20, 32, 7627 }, // î
+    { 8, 19, 8, -1, 19, 29, 7659 }, // ï
+    { 13, 21, 15, 1, 20, 56, 7688 }, // ð
+    { 12, 19, 15, 2, 19, 52, 7744 }, // ñ
+    { 13, 21, 15, 1, 20, 53, 7796 }, // ò
+    { 13, 21, 15, 1, 20, 52, 7849 }, // ó
+    { 13, 21, 15, 1, 20, 56, 7901 }, // ô
+    { 13, 20, 15, 1, 19, 56, 7957 }, // õ
+    { 13, 20, 15, 1, 19, 50, 8013 }, // ö
+    { 13, 12, 15, 1, 15, 24, 8063 }, // ÷
+    { 13, 16, 15, 1, 15, 57, 8087 }, // ø
+    { 13, 21, 15, 1, 20, 52, 8144 }, // ù
+    { 13, 21, 15, 1, 20, 52, 8196 }, // ú
+    { 13, 21, 15, 1, 20, 53, 8248 }, // û
+    { 13, 20, 15, 1, 19, 50, 8301 }, // ü
+    { 13, 26, 14, 0, 20, 60, 8351 }, // ý
+    { 12, 25, 15, 2, 19, 61, 8411 }, // þ
+    { 13, 25, 14, 0, 19, 59, 8472 }, // ÿ
+    { 16, 21, 17, 0, 21, 65, 8531 }, // Ā
+    { 11, 18, 14, 1, 17, 42, 8596 }, // ā
+    { 16, 23, 17, 0, 23, 70, 8638 }, // Ă
+    { 11, 20, 14, 1, 19, 47, 8708 }, // ă
+    { 16, 24, 17, 0, 18, 70, 8755 }, // Ą
+    { 12, 20, 14, 1, 14, 53, 8825 }, // ą
+    { 15, 25, 17, 1, 24, 52, 8878 }, // Ć
+    { 11, 21, 13, 1, 20, 39, 8930 }, // ć
+    { 15, 25, 17, 1, 24, 56, 8969 }, // Ĉ
+    { 11, 21, 13, 1, 20, 41, 9025 }, // ĉ
+    { 15, 24, 17, 1, 23, 52, 9066 }, // Ċ
+    { 11, 20, 13, 1, 19, 37, 9118 }, // ċ
+    { 15, 25, 17, 1, 24, 57, 9155 }, // Č
+    { 11, 21, 13, 1, 20, 40, 9212 }, // č
+    { 15, 24, 18, 2, 24, 76, 9252 }, // Ď
+    { 17, 20, 19, 1, 19, 65, 9328 }, // ď
+    { 17, 18, 18, 0, 18, 59, 9393 }, // Đ
+    { 15, 20, 17, 1, 19, 60, 9452 }, // đ
+    { 11, 21, 14, 2, 21, 50, 9512 }, // Ē
+    { 12, 18, 14, 1, 17, 47, 9562 }, // ē
+    { 11, 23, 14, 2, 23, 56, 9609 }, // Ĕ
+    { 12, 20, 14, 1, 19, 51, 9665 }, // ĕ
+    { 11, 23, 14, 2, 23, 52, 9716 }, // Ė
+    { 12, 20, 14, 1, 19, 49, 9768 }, // ė
+    { 11, 24, 14, 2, 18, 56, 9817 }, // Ę
+    { 12, 20, 14, 1, 14, 51, 9873 }, // ę
+    { 11, 24, 14, 2, 24, 57, 9924 }, // Ě
+    { 12, 21, 14, 1, 20, 51, 9981 }, // ě
+    { 16, 25, 18, 1, 24, 68, 10032 }, // Ĝ
+    { 13, 26, 15, 1, 20, 72, 10100 }, // ĝ
+    { 16, 24, 18, 1, 23, 67, 10172 }, // Ğ
+    { 13, 25, 15, 1, 19, 70, 10239 }, // ğ
+    { 16, 24, 18, 1, 23, 64, 10309 }, // Ġ
+    { 13, 25, 15, 1, 19, 67, 10373 }, // ġ
+    { 16, 25, 18, 1, 19, 68, 10440 }, // Ģ
+    { 13, 26, 15, 1, 20, 69, 10508 }, // ģ
+    { 15, 24, 19, 2, 24, 82, 10577 }, // Ĥ
+    { 15, 26, 15, -1, 26, 66, 10659 }, // ĥ
+    { 19, 18, 20, 0, 18, 69, 10725 }, // Ħ
+    { 14, 19, 15, 0, 19, 53, 10794 }, // ħ
+    { 10, 23, 10, -1, 23, 43, 10847 }, // Ĩ
+    { 10, 19, 9, -2, 19, 35, 10890 }, // ĩ
+    { 8, 21, 9, 0, 21, 33, 10925 }, // Ī
+    { 8, 17, 8, -1, 17, 25, 10958 }, // ī
+    { 9, 23, 10, 0, 23, 40, 10983 }, // Ĭ
+    { 9, 19, 9, -1, 19, 31, 11023 }, // ĭ
+    { 7, 24, 9, 1, 18, 40, 11054 }, // Į
+    { 5, 25, 6, 0, 19, 35, 11094 }, // į
+    { 7, 23, 9, 1, 23, 35, 11129 }, // İ
+    { 3, 14, 6, 2, 14, 15, 11164 }, // ı
+    { 13, 23, 15, 1, 18, 59, 11179 }, // Ĳ
+    { 10, 25, 13, 1, 19, 62, 11238 }, // ĳ
+    { 10, 29, 9, -2, 24, 58, 11300 }, // Ĵ
+    { 10, 26, 9, -2, 20, 42, 11358 }, // ĵ
+    { 14, 24, 17, 2, 18, 74, 11400 }, // Ķ
+    { 12, 25, 15, 2, 19, 59, 11474 }, // ķ
+    { 12, 14, 15, 2, 14, 41, 11533 }, // ĸ
+    { 11, 24, 14, 2, 24, 44, 11574 }, // Ĺ
+    { 6, 26, 8, 1, 26, 36, 11618 }, // ĺ
+    { 11, 24, 14, 2, 18, 46, 11654 }, // Ļ
+    { 4, 25, 6, 1, 19, 36, 11700 }, // ļ
+    { 11, 18, 14, 2, 18, 43, 11736 }, // Ľ
+    { 7, 19, 10, 2, 19, 33, 11779 }, // ľ
+    { 11, 18, 14, 2, 18, 42, 11812 }, // Ŀ
+    { 6, 19, 9, 2, 19, 31, 11854 }, // ŀ
+    { 13, 18, 14, 0, 18, 47, 11885 }, // Ł
+    { 8, 19, 8, -1, 19, 24, 11932 }, // ł
+    { 15, 24, 19, 2, 24, 86, 11956 }, // Ń
+    { 12, 20, 15, 2, 20, 48, 12042 }, // ń
+    { 15, 24, 19, 2, 18, 87, 12090 }, // Ņ
+    { 12, 20, 15, 2, 14, 49, 12177 }, // ņ
+    { 15, 24, 19, 2, 24, 92, 12226 }, // Ň
+    { 12, 20, 15, 2, 20, 50, 12318 }, // ň
+    { 16, 18, 17, 0, 18, 47, 12368 }, // ŉ
+    { 15, 23, 19, 2, 18, 91, 12415 }, // Ŋ
+    { 12, 20, 15, 2, 14, 50, 12506 }, // ŋ
+    { 17, 22, 20, 1, 21, 64, 12556 }, // Ō
+    { 13, 18, 15, 1, 17, 47, 12620 }, // ō
+    { 17, 24, 20, 1, 23, 72, 12667 }, // Ŏ
+    { 13, 20, 15, 1, 19, 54, 12739 }, // ŏ
+    { 17, 25, 20, 1, 24, 74, 12793 }, // Ő
+    { 13, 21, 15, 1, 20, 56, 12867 }, // ő
+    { 21, 20, 23, 1, 19, 76, 12923 }, // Œ
+    { 22, 15, 24, 1, 14, 69, 12999 }, // œ
+    { 14, 24, 17, 2, 24, 75, 13068 }, // Ŕ
+    { 8, 20, 11, 2, 20, 33, 13143 }, // ŕ
+    { 14, 24, 17, 2, 18, 74, 13176 }, // Ŗ
+    { 9, 20, 11, 1, 14, 34, 13250 }, // ŗ
+    { 14, 24, 17, 2, 24, 76, 13284 }, // Ř
+    { 10, 20, 12, 1, 20, 35, 13360 }, // ř
+    { 12, 25, 14, 1, 24, 52, 13395 }, // Ś
+    { 10, 21, 12, 1, 20, 42, 13447 }, // ś
+    { 12, 25, 14, 1, 24, 54, 13489 }, // Ŝ
+    { 10, 21, 12, 1, 20, 44, 13543 }, // ŝ
+    { 12, 25, 14, 1, 19, 56, 13587 }, // Ş
+    { 10, 20, 12, 1, 14, 44, 13643 }, // ş
+    { 12, 25, 14, 1, 24, 53, 13687 }, // Š
+    { 10, 21, 12, 1, 20, 43, 13740 }, // š
+    { 14, 24, 15, 0, 18, 44, 13783 }, // Ţ
+    { 9, 23, 10, 0, 17, 48, 13827 }, // ţ
+    { 14, 24, 15, 0, 24, 41, 13875 }, // Ť
+    { 12, 20, 13, 0, 19, 49, 13916 }, // ť
+    { 14, 18, 15, 0, 18, 31, 13965 }, // Ŧ
+    { 9, 18, 10, 0, 17, 39, 13996 }, // ŧ
+    { 14, 24, 18, 2, 23, 57, 14035 }, // Ũ
+    { 13, 20, 15, 1, 19, 55, 14092 }, // ũ
+    { 14, 22, 18, 2, 21, 49, 14147 }, // Ū
+    { 13, 18, 15, 1, 17, 46, 14196 }, // ū
+    { 14, 24, 18, 2, 23, 53, 14242 }, // Ŭ
+    { 13, 20, 15, 1, 19, 53, 14295 }, // ŭ
+    { 14, 26, 18, 2, 25, 60, 14348 }, // Ů
+    { 13, 22, 15, 1, 21, 58, 14408 }, // ů
+    { 14, 25, 18, 2, 24, 58, 14466 }, // Ű
+    { 13, 21, 15, 1, 20, 56, 14524 }, // ű
+    { 14, 24, 18, 2, 18, 53, 14580 }, // Ų
+    { 13, 20, 15, 1, 14, 55, 14633 }, // ų
+    { 23, 24, 24, 0, 24, 108, 14688 }, // Ŵ
+    { 20, 20, 21, 0, 20, 82, 14796 }, // ŵ
+    { 15, 24, 16, 0, 24, 56, 14878 }, // Ŷ
+    { 13, 26, 14, 0, 20, 64, 14934 }, // ŷ
+    { 15, 23, 16, 0, 23, 53, 14998 }, // Ÿ
+    { 14, 24, 15, 0, 24, 48, 15051 }, // Ź
+    { 11, 20, 12, 0, 20, 41, 15099 }, // ź
+    { 14, 23, 15, 0, 23, 46, 15140 }, // Ż
+    { 11, 19, 12, 0, 19, 39, 15186 }, // ż
+    { 14, 24, 15, 0, 24, 50, 15225 }, // Ž
+    { 11, 20, 12, 0, 20, 42, 15275 }, // ž
+    { 8, 20, 11, 2, 20, 31, 15317 }, // ſ
+    { 20, 20, 22, 1, 19, 68, 15348 }, // Ơ
+    { 16, 17, 18, 1, 16, 54, 15416 }, // ơ
+    { 24, 20, 27, 1, 19, 95, 15470 }, // Ƣ
+    { 19, 20, 21, 1, 14, 72, 15565 }, // ƣ
+    { 16, 18, 17, 0, 18, 61, 15637 }, // Ƥ
+    { 12, 26, 15, 2, 20, 62, 15698 }, // ƥ
+    { 14, 21, 17, 2, 18, 66, 15760 }, // Ʀ
+    { 12, 20, 14, 1, 19, 42, 15826 }, // Ƨ
+    { 10, 15, 12, 1, 14, 35, 15868 }, // ƨ
+    { 14, 18, 15, 0, 18, 39, 15903 }, // Ʃ
+    { 12, 26, 12, -1, 20, 43, 15942 }, // ƪ
+    { 9, 23, 10, 0, 17, 47, 15985 }, // ƫ
+    { 15, 18, 16, 0, 18, 51, 16032 }, // Ƭ
+    { 9, 21, 10, 0, 20, 42, 16083 }, // ƭ
+    { 14, 24, 15, 0, 18, 41, 16125 }, // Ʈ
+    { 19, 20, 22, 2, 19, 63, 16166 }, // Ư
+    { 17, 17, 19, 1, 16, 49, 16229 }, // ư
+    { 6, 5, 0, -13, 20, 7, 16278 }, // ̀
+    { 6, 5, 0, -9, 20, 8, 16285 }, // ́
+    { 10, 5, 6, -5, 20, 11, 16293 }, // ̂
+    { 10, 4, 0, -13, 19, 13, 16304 }, // ̃
+    { 8, 2, 5, -4, 17, 4, 16317 }, // ̄
+    { 12, 3, 7, -6, 22, 9, 16321 }, // ̅
+    { 8, 4, 5, -4, 19, 9, 16330 }, // ̆
+    { 4, 4, 3, -2, 19, 4, 16339 }, // ̇
+    { 8, 4, 5, -4, 19, 8, 16343 }, // ̈
+    { 6, 7, 0, -10, 21, 11, 16351 }, // ̉
+    { 6, 6, 4, -3, 21, 14, 16362 }, // ̊
+    { 10, 5, 7, -4, 20, 13, 16376 }, // ̋
+    { 10, 5, 6, -5, 20, 9, 16389 }, // ̌
+    { 2, 5, 2, -1, 19, 2, 16398 }, // ̍
+    { 6, 5, 4, -3, 19, 5, 16400 }, // ̎
+    { 10, 5, 0, -13, 20, 14, 16405 }, // ̏
+    { 8, 7, 5, -4, 22, 14, 16419 }, // ̐
+    { 8, 4, 5, -4, 19, 12, 16433 }, // ̑
+    { 4, 7, 3, -2, 18, 11, 16445 }, // ̒
+    { 4, 7, 3, -2, 18, 10, 16456 }, // ̓
+    { 4, 7, 3, -2, 18, 9, 16466 }, // ̔
+    { 4, 7, 3, -2, 18, 10, 16475 }, // ̕
+    { 6, 5, 4, -3, 0, 7, 16485 }, // ̖
+    { 6, 5, 4, -3, 0, 8, 16492 }, // ̗
+    { 6, 6, 4, -3, 0, 9, 16500 }, // ̘
+    { 6, 6, 4, -3, 0, 9, 16509 }, // ̙
+    { 7, 6, 8, 0, 19, 9, 16518 }, // ̚
+    { 6, 6, 4, -3, 19, 9, 16527 }, // ̛
+    { 4, 6, 3, -2, 0, 9, 16536 }, // ̜
+    { 6, 5, 4, -3, -1, 7, 16545 }, // ̝
+    { 6, 5, 4, -3, -1, 7, 16552 }, // ̞
+    { 6, 6, 4, -3, 0, 9, 16559 }, // ̟
+    { 6, 3, 4, -3, -2, 5, 16568 }, // ̠
+    { 5, 8, 1, -5, 2, 9, 16573 }, // ̡
+    { 5, 8, 6, 0, 2, 9, 16582 }, // ̢
+    { 3, 4, 0, -9, -1, 6, 16591 }, // ̣
+    { 8, 4, 5, -4, -1, 8, 16597 }, // ̤
+    { 6, 6, 4, -3, 0, 14, 16605 }, // ̥
+    { 4, 5, 3, -2, -1, 9, 16619 }, // ̦
+    { 6, 6, 4, -3, 0, 11, 16628 }, // ̧
+    { 6, 7, 4, -3, 1, 10, 16639 }, // ̨
+    { 2, 5, 2, -1, -1, 2, 16649 }, // ̩
+    { 10, 5, 6, -5, -1, 14, 16651 }, // ̪
+    { 10, 4, 6, -5, -1, 13, 16665 }, // ̫
+    { 10, 5, 6, -5, 0, 10, 16678 }, // ̬
+    { 10, 5, 6, -5, 0, 11, 16688 }, // ̭
+    { 8, 4, 5, -4, -1, 9, 16699 }, // ̮
+    { 8, 4, 5, -4, -1, 12, 16708 }, // ̯
+    { 10, 4, 6, -5, -1, 13, 16720 }, // ̰
+    { 8, 2, 5, -4, -2, 4, 16733 }, // ̱
+    { 12, 2, 7, -6, -2, 5, 16737 }, // ̲
+    { 12, 6, 7, -6, 0, 22, 16742 }, // ̳
+    { 10, 4, 6, -5, 9, 13, 16764 }, // ̴
+    { 12, 3, 7, -6, 9, 9, 16777 }, // ̵
+    { 18, 2, 10, -9, 8, 5, 16786 }, // ̶
+    { 8, 6, 5, -4, 10, 10, 16791 }, // ̷
+    { 10, 21, 6, -5, 19, 33, 16801 }, // ̸
+    { 4, 6, 3, -2, 0, 8, 16834 }, // ̹
+    { 10, 5, 6, -5, -1, 15, 16842 }, // ̺
+    { 10, 6, 6, -5, 0, 22, 16857 }, // ̻
+    { 10, 4, 6, -5, -1, 13, 16879 }, // ̼
+    { 6, 6, 4, -3, 20, 14, 16892 }, // ̽
+    { 4, 8, 3, -2, 22, 12, 16906 }, // ̾
+    { 12, 6, 7, -6, 25, 22, 16918 }, // ̿
+    { 6, 5, 3, -4, 20, 7, 16940 }, // ̀
+    { 6, 5, 6, -1, 20, 7, 16947 }, // ́
+    { 10, 4, 6, -5, 19, 13, 16954 }, // ͂
+    { 4, 5, 3, -2, 20, 9, 16967 }, // ̓
+    { 9, 5, 6, -4, 20, 14, 16976 }, // ̈́
+    { 4, 4, 4, -1, -2, 5, 16990 }, // ͅ
+    { 12, 6, 7, -6, 20, 16, 16995 }, // ͆
+    { 12, 6, 7, -6, 0, 22, 17011 }, // ͇
+    { 6, 5, 4, -3, -1, 5, 17033 }, // ͈
+    { 6, 5, 4, -3, -1, 11, 17038 }, // ͉
+    { 10, 6, 6, -5, 20, 17, 17049 }, // ͊
+    { 10, 10, 6, -5, 24, 19, 17066 }, // ͋
+    { 10, 7, 6, -5, 22, 21, 17085 }, // ͌
+    { 10, 6, 6, -5, 0, 12, 17106 }, // ͍
+    { 6, 6, 4, -3, 0, 6, 17118 }, // ͎
+    { 18, 18, 10, -9, 18, 75, 17124 }, // ͏
+    { 5, 6, 3, -3, 20, 8, 17199 }, // ͐
+    { 4, 6, 3, -2, 21, 10, 17207 }, // ͑
+    { 8, 6, 5, -4, 21, 14, 17217 }, // ͒
+    { 6, 6, 4, -3, 0, 10, 17231 }, // ͓
+    { 5, 5, 3, -3, -1, 9, 17241 }, // ͔
+    { 5, 5, 3, -3, -1, 9, 17250 }, // ͕
+    { 10, 5, 6, -5, -1, 19, 17259 }, // ͖
+    { 4, 6, 3, -2, 21, 8, 17278 }, // ͗
+    { 3, 4, 7, 3, 19, 5, 17286 }, // ͘
+    { 6, 6, 4, -3, 0, 11, 17291 }, // ͙
+    { 10, 6, 6, -5, 0, 19, 17302 }, // ͚
+    { 6, 6, 4, -3, 20, 9, 17321 }, // ͛
+    { 20, 5, 11, -10, -1, 22, 17330 }, // ͜
+    { 20, 5, 11, -10, 19, 22, 17352 }, // ͝
+    { 16, 2, 9, -8, 17, 11, 17374 }, // ͞
+    { 16, 2, 9, -8, -2, 11, 17385 }, // ͟
+    { 20, 4, 11, -10, 19, 22, 17396 }, // ͠
+    { 20, 6, 11, -10, 22, 19, 17418 }, // ͡
+    { 21, 6, 12, -10, 0, 20, 17437 }, // ͢
+    { 6, 6, 4, -3, 21, 15, 17457 }, // ͣ
+    { 6, 6, 4, -3, 21, 13, 17472 }, // ͤ
+    { 2, 8, 2, -1, 23, 7, 17485 }, // ͥ
+    { 7, 6, 5, -3, 21, 16, 17492 }, // ͦ
+    { 6, 6, 4, -3, 21, 14, 17508 }, // ͧ
+    { 5, 6, 4, -2, 21, 10, 17522 }, // ͨ
+    { 6, 9, 4, -3, 24, 18, 17532 }, // ͩ
+    { 6, 9, 4, -3, 24, 17, 17550 }, // ͪ
+    { 10, 6, 6, -5, 21, 22, 17567 }, // ͫ
+    { 5, 6, 4, -2, 21, 9, 17589 }, // ͬ
+    { 5, 8, 4, -2, 23, 12, 17598 }, // ͭ
+    { 7, 6, 5, -3, 21, 12, 17610 }, // ͮ
+    { 7, 6, 5, -3, 21, 14, 17622 }, // ͯ
+    { 16, 18, 17, 0, 18, 59, 17636 }, // Α
+    { 13, 18, 16, 2, 18, 60, 17695 }, // Β
+    { 10, 18, 13, 2, 18, 36, 17755 }, // Γ
+    { 16, 18, 17, 0, 18, 50, 17791 }, // Δ
+    { 11, 18, 14, 2, 18, 45, 17841 }, // Ε
+    { 14, 18, 15, 0, 18, 38, 17886 }, // Ζ
+    { 15, 18, 19, 2, 18, 69, 17924 }, // Η
+    { 17, 20, 20, 1, 19, 62, 17993 }, // Θ
+    { 7, 18, 9, 1, 18, 29, 18055 }, // Ι
+    { 14, 18, 17, 2, 18, 64, 18084 }, // Κ
+    { 16, 18, 17, 0, 18, 56, 18148 }, // Λ
+    { 19, 18, 23, 2, 18, 94, 18204 }, // Μ
+    { 15, 18, 19, 2, 18, 77, 18298 }, // Ν
+    { 14, 18, 16, 1, 18, 33, 18375 }, // Ξ
+    { 17, 20, 20, 1, 19, 59, 18408 }, // Ο
+    { 14, 18, 18, 2, 18, 53, 18467 }, // Π
+    { 12, 18, 15, 2, 18, 52, 18520 }, // Ρ
+    { 14, 18, 15, 0, 18, 39, 18572 }, // Σ
+    { 14, 18, 15, 0, 18, 30, 18611 }, // Τ
+    { 15, 18, 16, 0, 18, 43, 18641 }, // Υ
+    { 19, 18, 21, 1, 18, 76, 18684 }, // Φ
+    { 15, 18, 16, 0, 18, 53, 18760 }, // Χ
+    { 17, 18, 21, 2, 18, 65, 18813 }, // Ψ
+    { 18, 19, 19, 0, 19, 61, 18878 }, // Ω
+    { 15, 15, 17, 1, 14, 50, 18939 }, // α
+    { 12, 26, 15, 2, 20, 67, 18989 }, // β
+    { 13, 20, 14, 0, 14, 49, 19056 }, // γ
+    { 13, 21, 15, 1, 20, 55, 19105 }, // δ
+    { 10, 15, 12, 1, 14, 32, 19160 }, // ε
+    { 11, 25, 13, 1, 19, 45, 19192 }, // ζ
+    { 12, 20, 15, 2, 14, 48, 19237 }, // η
+    { 13, 21, 15, 1, 20, 59, 19285 }, // θ
+    { 6, 15, 9, 2, 14, 23, 19344 }, // ι
+    { 12, 14, 15, 2, 14, 41, 19367 }, // κ
+    { 13, 21, 14, 0, 20, 51, 19408 }, // λ
+    { 14, 20, 17, 2, 14, 56, 19459 }, // μ
+    { 13, 14, 14, 0, 14, 39, 19515 }, // ν
+    { 11, 25, 13, 1, 19, 47, 19554 }, // ξ
+    { 13, 15, 15, 1, 14, 43, 19601 }, // ο
+    { 16, 15, 17, 0, 14, 48, 19644 }, // π
+    { 13, 20, 15, 1, 14, 54, 19692 }, // ρ
+    { 11, 20, 13, 1, 14, 38, 19746 }, // ς
+    { 14, 15, 16, 1, 14, 47, 19784 }, // σ
+    { 12, 15, 13, 0, 14, 36, 19831 }, // τ
+    { 13, 15, 15, 1, 14, 36, 19867 }, // υ
+    { 16, 25, 18, 1, 19, 70, 19903 }, // φ
+    { 15, 20, 16, 0, 14, 57, 19973 }, // χ
+    { 16, 25, 19, 1, 19, 78, 20030 }, // ψ
+    { 18, 15, 20, 1, 14, 51, 20108 }, // ω
+    { 16, 23, 17, 0, 18, 67, 20159 }, // Ạ
+    { 11, 19, 14, 1, 14, 43, 20226 }, // ạ
+    { 16, 25, 17, 0, 25, 73, 20269 }, // Ả
+    { 11, 22, 14, 1, 21, 48, 20342 }, // ả
+    { 16, 25, 17, 0, 25, 75, 20390 }, // Ấ
+    { 13, 22, 15, 1, 21, 55, 20465 }, // ấ
+    { 16, 25, 17, 0, 25, 76, 20520 }, // Ầ
+    { 12, 22, 14, 0, 21, 55, 20596 }, // ầ
+    { 16, 26, 17, 0, 26, 79, 20651 }, // Ẩ
+    { 12, 23, 14, 1, 22, 59, 20730 }, // ẩ
+    { 16, 27, 17, 0, 27, 81, 20789 }, // Ẫ
+    { 11, 24, 14, 1, 23, 54, 20870 }, // ẫ
+    { 16, 29, 17, 0, 24, 80, 20924 }, // Ậ
+    { 11, 25, 14, 1, 20, 53, 21004 }, // ậ
+    { 16, 26, 17, 0, 26, 79, 21057 }, // Ắ
+    { 11, 23, 14, 1, 22, 53, 21136 }, // ắ
+    { 16, 26, 17, 0, 26, 78, 21189 }, // Ằ
+    { 11, 23, 14, 1, 22, 52, 21267 }, // ằ
+    { 16, 27, 17, 0, 27, 80, 21319 }, // Ẳ
+    { 11, 23, 14, 1, 22, 54, 21399 }, // ẳ
+    { 16, 27, 17, 0, 27, 82, 21453 }, // Ẵ
+    { 11, 24, 14, 1, 23, 56, 21535 }, // ẵ
+    { 16, 28, 17, 0, 23, 78, 21591 }, // Ặ
+    { 11, 24, 14, 1, 19, 52, 21669 }, // ặ
+    { 11, 23, 14, 2, 18, 53, 21721 }, // Ẹ
+    { 12, 19, 14, 1, 14, 49, 21774 }, // ẹ
+    { 11, 25, 14, 2, 25, 57, 21823 }, // Ẻ
+    { 12, 22, 14, 1, 21, 54, 21880 }, // ẻ
+    { 11, 23, 14, 2, 23, 58, 21934 }, // Ẽ
+    { 12, 20, 14, 1, 19, 54, 21992 }, // ẽ
+    { 12, 25, 15, 2, 25, 71, 22046 }, // Ế
+    { 13, 22, 15, 1, 21, 61, 22117 }, // ế
+    { 13, 25, 14, 0, 25, 72, 22178 }, // Ề
+    { 13, 22, 14, 0, 21, 60, 22250 }, // ề
+    { 12, 26, 15, 2, 26, 72, 22310 }, // Ể
+    { 13, 23, 15, 1, 22, 63, 22382 }, // ể
+    { 11, 27, 14, 2, 27, 65, 22445 }, // Ễ
+    { 12, 24, 14, 1, 23, 61, 22510 }, // ễ
+    { 11, 29, 14, 2, 24, 64, 22571 }, // Ệ
+    { 12, 25, 14, 1, 20, 60, 22635 }, // ệ
+    { 7, 25, 9, 1, 25, 41, 22695 }, // Ỉ
+    { 6, 21, 8, 1, 21, 31, 22736 }, // ỉ
+    { 7, 23, 9, 1, 18, 35, 22767 }, // Ị
+    { 4, 24, 6, 1, 19, 32, 22802 }, // ị
+    { 17, 24, 20, 1, 19, 66, 22834 }, // Ọ
+    { 13, 19, 15, 1, 14, 51, 22900 }, // ọ
+    { 17, 26, 20, 1, 25, 73, 22951 }, // Ỏ
+    { 13, 22, 15, 1, 21, 57, 23024 }, // ỏ
+    { 17, 26, 20, 1, 25, 79, 23081 }, // Ố
+    { 14, 22, 16, 1, 21, 65, 23160 }, // ố
+    { 17, 26, 20, 1, 25, 76, 23225 }, // Ồ
+    { 13, 22, 15, 1, 21, 62, 23301 }, // ồ
+    { 17, 27, 20, 1, 26, 81, 23363 }, // Ổ
+    { 13, 23, 15, 1, 22, 66, 23444 }, // ổ
+    { 17, 28, 20, 1, 27, 82, 23510 }, // Ỗ
+    { 13, 24, 15, 1, 23, 65, 23592 }, // ỗ
+    { 17, 29, 20, 1, 24, 78, 23657 }, // Ộ
+    { 13, 25, 15, 1, 20, 63, 23735 }, // ộ
+    { 20, 25, 22, 1, 24, 79, 23798 }, // Ớ
+    { 16, 21, 18, 1, 20, 61, 23877 }, // ớ
+    { 20, 25, 22, 1, 24, 81, 23938 }, // Ờ
+    { 16, 21, 18, 1, 20, 63, 24019 }, // ờ
+    { 20, 26, 22, 1, 25, 84, 24082 }, // Ở
+    { 16, 22, 18, 1, 21, 65, 24166 }, // ở
+    { 20, 24, 22, 1, 23, 83, 24231 }, // Ỡ
+    { 16, 20, 18, 1, 19, 65, 24314 }, // ỡ
+    { 20, 24, 22, 1, 19, 77, 24379 }, // Ợ
+    { 16, 21, 18, 1, 16, 62, 24456 }, // ợ
+    { 14, 23, 18, 2, 18, 49, 24518 }, // Ụ
+    { 13, 19, 15, 1, 14, 49, 24567 }, // ụ
+    { 14, 26, 18, 2, 25, 58, 24616 }, // Ủ
+    { 13, 22, 15, 1, 21, 55, 24674 }, // ủ
+    { 19, 25, 22, 2, 24, 74, 24729 }, // Ứ
+    { 17, 21, 19, 1, 20, 56, 24803 }, // ứ
+    { 19, 25, 22, 2, 24, 73, 24859 }, // Ừ
+    { 17, 21, 19, 1, 20, 59, 24932 }, // ừ
+    { 19, 26, 22, 2, 25, 78, 24991 }, // Ử
+    { 17, 22, 19, 1, 21, 62, 25069 }, // ử
+    { 19, 24, 22, 2, 23, 77, 25131 }, // Ữ
+    { 17, 20, 19, 1, 19, 61, 25208 }, // ữ
+    { 19, 24, 22, 2, 19, 72, 25269 }, // Ự
+    { 17, 21, 19, 1, 16, 57, 25341 }, // ự
+    { 15, 24, 16, 0, 24, 52, 25398 }, // Ỳ
+    { 13, 26, 14, 0, 20, 61, 25450 }, // ỳ
+    { 15, 23, 16, 0, 18, 51, 25511 }, // Ỵ
+    { 13, 20, 14, 0, 14, 55, 25562 }, // ỵ
+    { 15, 25, 16, 0, 25, 58, 25617 }, // Ỷ
+    { 13, 27, 14, 0, 21, 64, 25675 }, // ỷ
+    { 15, 23, 16, 0, 23, 57, 25739 }, // Ỹ
+    { 13, 25, 14, 0, 19, 64, 25796 }, // ỹ
+    { 0, 0, 13, 0, 0, 0, 25860 }, //  
+    { 0, 0, 25, 0, 0, 0, 25860 }, //  
+    { 0, 0, 13, 0, 0, 0, 25860 }, //  
+    { 0, 0, 25, 0, 0, 0, 25860 }, //  
+    { 0, 0, 8, 0, 0, 0, 25860 }, //  
+    { 0, 0, 6, 0, 0, 0, 25860 }, //  
+    { 0, 0, 4, 0, 0, 0, 25860 }, //  
+    { 0, 0, 14, 0, 0, 0, 25860 }, //  
+    { 0, 0, 7, 0, 0, 0, 25860 }, //  
+    { 0, 0, 4, 0, 0, 0, 25860 }, //  
+    { 0, 0, 3, 0, 0, 0, 25860 }, //  
+    { 0, 0, 1, 0, 0, 0, 25860 }, // ​
+    { 0, 0, 1, 0, 0, 0, 25860 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 25860 }, // ‍
+    { 7, 22, 7, -1, 18, 35, 25860 }, // ‎
+    { 7, 22, 2, -6, 18, 35, 25895 }, // ‏
+    { 7, 3, 9, 1, 8, 9, 25930 }, // ‐
+    { 7, 3, 9, 1, 8, 9, 25939 }, // ‑
+    { 13, 2, 15, 1, 10, 4, 25948 }, // ‒
+    { 11, 3, 13, 1, 8, 13, 25952 }, // –
+    { 23, 3, 25, 1, 8, 26, 25965 }, // —
+    { 23, 3, 25, 1, 8, 26, 25991 }, // ―
+    { 8, 26, 14, 3, 19, 63, 26017 }, // ‖
+    { 12, 6, 12, -1, 0, 23, 26080 }, // ‗
+    { 5, 7, 6, 0, 18, 11, 26103 }, // ‘
+    { 5, 7, 6, 0, 18, 11, 26114 }, // ’
+    { 5, 7, 6, 0, 3, 10, 26125 }, // ‚
+    { 5, 7, 6, 0, 18, 11, 26135 }, // ‛
+    { 9, 7, 10, 0, 18, 22, 26146 }, // “
+    { 9, 7, 10, 0, 18, 22, 26168 }, // ”
+    { 10, 7, 11, 0, 3, 20, 26190 }, // „
+    { 9, 7, 10, 0, 18, 21, 26210 }, // ‟
+    { 11, 19, 13, 1, 19, 39, 26231 }, // †
+    { 11, 19, 13, 1, 19, 49, 26270 }, // ‡
+    { 7, 7, 9, 1, 13, 12, 26319 }, // •
+    { 8, 8, 10, 1, 13, 14, 26331 }, // ‣
+    { 4, 5, 13, 4, 4, 6, 26345 }, // ․
+    { 11, 5, 13, 1, 4, 13, 26351 }, // ‥
+    { 17, 5, 20, 1, 4, 18, 26364 }, // …
+    { 4, 5, 7, 1, 9, 6, 26382 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 26388 }, //  
+    { 0, 0, 15, 0, 0, 0, 26388 }, //  
+    { 7, 20, 7, -1, 16, 29, 26388 }, // ‪
+    { 7, 20, 2, -6, 16, 29, 26417 }, // ‫
+    { 6, 22, 4, -3, 18, 28, 26446 }, // ‬
+    { 6, 22, 4, -3, 18, 29, 26474 }, // ‭
+    { 6, 22, 4, -3, 18, 29, 26503 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 26532 }, //  
+    { 28, 20, 30, 1, 19, 124, 26532 }, // ‰
+    { 37, 20, 39, 1, 19, 158, 26656 }, // ‱
+    { 7, 7, 8, 0, 18, 11, 26814 }, // ′
+    { 11, 7, 12, 0, 18, 22, 26825 }, // ″
+    { 16, 7, 17, 0, 18, 31, 26847 }, // ‴
+    { 6, 7, 6, -1, 18, 11, 26878 }, // ‵
+    { 10, 7, 11, -1, 18, 22, 26889 }, // ‶
+    { 14, 7, 15, -1, 18, 32, 26911 }, // ‷
+    { 10, 9, 11, 0, 3, 22, 26943 }, // ‸
+    { 6, 11, 8, 1, 12, 17, 26965 }, // ‹
+    { 7, 11, 8, 0, 12, 17, 26982 }, // ›
+    { 19, 20, 21, 1, 19, 74, 26999 }, // ※
+    { 10, 19, 12, 1, 18, 51, 27073 }, // ‼
+    { 11, 20, 12, 0, 19, 46, 27124 }, // ‽
+    { 14, 2, 14, -1, 21, 10, 27170 }, // ‾
+    { 15, 6, 16, 0, 0, 17, 27180 }, // ‿
+    { 15, 6, 16, 0, 20, 18, 27197 }, // ⁀
+    { 9, 17, 10, 0, 11, 34, 27215 }, // ⁁
+    { 28, 23, 29, 0, 19, 106, 27249 }, // ⁂
+    { 7, 3, 9, 1, 8, 9, 27355 }, // ⁃
+    { 13, 18, 9, -5, 18, 38, 27364 }, // ⁄
+    { 7, 22, 9, 1, 18, 28, 27402 }, // ⁅
+    { 7, 22, 8, 0, 18, 36, 27430 }, // ⁆
+    { 21, 20, 22, 0, 19, 62, 27466 }, // ⁇
+    { 16, 20, 17, 0, 19, 60, 27528 }, // ⁈
+    { 16, 20, 18, 1, 19, 61, 27588 }, // ⁉
+    { 13, 14, 14, 0, 14, 38, 27649 }, // ⁊
+    { 13, 23, 16, 2, 19, 75, 27687 }, // ⁋
+    { 13, 14, 16, 1, 14, 39, 27762 }, // ⁌
+    { 13, 14, 16, 2, 14, 42, 27801 }, // ⁍
+    { 12, 12, 14, 1, 6, 29, 27843 }, // ⁎
+    { 5, 18, 7, 1, 14, 16, 27872 }, // ⁏
+    { 15, 26, 16, 0, 20, 48, 27888 }, // ⁐
+    { 12, 25, 14, 1, 19, 59, 27936 }, // ⁑
+    { 10, 20, 11, 0, 19, 39, 27995 }, // ⁒
+    { 23, 5, 25, 1, 10, 24, 28034 }, // ⁓
+    { 15, 6, 16, 0, 0, 19, 28058 }, // ⁔
+    { 14, 14, 15, 0, 13, 44, 28077 }, // ⁕
+    { 11, 20, 13, 1, 19, 26, 28121 }, // ⁖
+    { 20, 7, 21, 0, 18, 42, 28147 }, // ⁗
+    { 19, 20, 21, 1, 19, 40, 28189 }, // ⁘
+    { 19, 20, 21, 1, 19, 44, 28229 }, // ⁙
+    { 4, 20, 6, 1, 19, 13, 28273 }, // ⁚
+    { 15, 20, 17, 1, 19, 35, 28286 }, // ⁛
+    { 19, 20, 20, 0, 19, 56, 28321 }, // ⁜
+    { 4, 19, 7, 1, 18, 17, 28377 }, // ⁝
+    { 4, 20, 7, 1, 19, 21, 28394 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 28415 }, //  
+    { 0, 0, 15, 0, 0, 0, 28415 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 28415 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 28415 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 28415 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 28415 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 28415 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 28415 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 28415 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 28415 }, // ⁩
+    { 6, 22, 4, -3, 18, 31, 28415 }, // ⁪
+    { 6, 22, 4, -3, 18, 28, 28446 }, // ⁫
+    { 6, 22, 4, -3, 18, 31, 28474 }, // ⁬
+    { 6, 22, 4, -3, 18, 31, 28505 }, // ⁭
+    { 6, 22, 4, -3, 18, 34, 28536 }, // ⁮
+    { 6, 22, 4, -3, 18, 31, 28570 }, // ⁯
+    { 9, 12, 10, 0, 22, 34, 28601 }, // ⁰
+    { 2, 12, 4, 1, 19, 11, 28635 }, // ⁱ
+    { 9, 12, 10, 0, 22, 22, 28646 }, // ⁴
+    { 8, 12, 9, 0, 22, 24, 28668 }, // ⁵
+    { 9, 12, 10, 0, 22, 32, 28692 }, // ⁶
+    { 9, 12, 10, 0, 22, 20, 28724 }, // ⁷
+    { 9, 12, 10, 0, 22, 31, 28744 }, // ⁸
+    { 9, 12, 10, 0, 22, 31, 28775 }, // ⁹
+    { 8, 8, 9, 0, 19, 15, 28806 }, // ⁺
+    { 8, 2, 9, 0, 16, 6, 28821 }, // ⁻
+    { 8, 5, 9, 0, 17, 9, 28827 }, // ⁼
+    { 5, 14, 7, 1, 23, 22, 28836 }, // ⁽
+    { 5, 14, 6, 0, 23, 21, 28858 }, // ⁾
+    { 8, 9, 10, 1, 16, 23, 28879 }, // ⁿ
+    { 9, 12, 10, 0, 8, 34, 28902 }, // ₀
+    { 6, 12, 9, 0, 8, 14, 28936 }, // ₁
+    { 8, 12, 9, 0, 8, 26, 28950 }, // ₂
+    { 9, 12, 10, 0, 8, 24, 28976 }, // ₃
+    { 9, 12, 10, 0, 8, 22, 29000 }, // ₄
+    { 8, 12, 9, 0, 8, 24, 29022 }, // ₅
+    { 9, 12, 10, 0, 8, 32, 29046 }, // ₆
+    { 9, 12, 10, 0, 8, 20, 29078 }, // ₇
+    { 9, 12, 10, 0, 8, 31, 29098 }, // ₈
+    { 9, 12, 10, 0, 8, 31, 29129 }, // ₉
+    { 8, 8, 9, 0, 6, 15, 29160 }, // ₊
+    { 8, 2, 9, 0, 3, 6, 29175 }, // ₋
+    { 8, 5, 9, 0, 4, 9, 29181 }, // ₌
+    { 5, 14, 7, 1, 9, 22, 29190 }, // ₍
+    { 5, 14, 6, 0, 9, 21, 29212 }, // ₎
+    { 8, 9, 9, 0, 6, 26, 29233 }, // ₐ
+    { 9, 9, 10, 0, 6, 26, 29259 }, // ₑ
+    { 9, 9, 10, 0, 6, 26, 29285 }, // ₒ
+    { 9, 9, 10, 0, 6, 24, 29311 }, // ₓ
+    { 9, 9, 10, 0, 6, 23, 29335 }, // ₔ
+    { 8, 12, 10, 1, 9, 30, 29358 }, // ₕ
+    { 8, 12, 10, 1, 9, 29, 29388 }, // ₖ
+    { 2, 12, 4, 1, 9, 12, 29417 }, // ₗ
+    { 13, 9, 15, 1, 6, 38, 29429 }, // ₘ
+    { 8, 9, 10, 1, 6, 25, 29467 }, // ₙ
+    { 9, 12, 11, 1, 6, 34, 29492 }, // ₚ
+    { 8, 9, 9, 0, 6, 21, 29526 }, // ₛ
+    { 6, 11, 7, 0, 8, 20, 29547 }, // ₜ
+    { 14, 19, 15, 0, 19, 48, 29567 }, // ₠
+    { 13, 21, 15, 1, 19, 77, 29615 }, // ₡
+    { 13, 20, 15, 1, 19, 49, 29692 }, // ₢
+    { 12, 18, 14, 1, 18, 41, 29741 }, // ₣
+    { 14, 19, 15, 0, 19, 50, 29782 }, // ₤
+    { 20, 20, 23, 2, 17, 81, 29832 }, // ₥
+    { 15, 18, 16, 0, 18, 56, 29913 }, // ₦
+    { 18, 19, 20, 1, 18, 68, 29969 }, // ₧
+    { 18, 19, 21, 2, 18, 76, 30037 }, // ₨
+    { 17, 18, 18, 0, 18, 84, 30113 }, // ₩
+    { 16, 18, 20, 2, 18, 73, 30197 }, // ₪
+    { 15, 23, 17, 1, 19, 65, 30270 }, // ₫
+    { 14, 20, 15, 0, 19, 47, 30335 }, // €
+    { 15, 18, 16, 0, 18, 64, 30382 }, // ₭
+    { 14, 18, 15, 0, 18, 43, 30446 }, // ₮
+    { 24, 25, 25, 0, 19, 98, 30489 }, // ₯
+    { 13, 25, 14, 0, 19, 67, 30587 }, // ₰
+    { 15, 18, 16, 0, 18, 62, 30654 }, // ₱
+    { 16, 21, 18, 1, 19, 74, 30716 }, // ₲
+    { 16, 18, 17, 0, 18, 61, 30790 }, // ₳
+    { 14, 20, 15, 0, 19, 50, 30851 }, // ₴
+    { 15, 21, 17, 1, 19, 62, 30901 }, // ₵
+    { 15, 18, 16, 0, 17, 70, 30963 }, // ₶
+    { 17, 21, 18, 0, 19, 72, 31033 }, // ₷
+    { 14, 18, 15, 0, 18, 35, 31105 }, // ₸
+    { 12, 18, 14, 1, 18, 41, 31140 }, // ₹
+    { 14, 19, 15, 0, 18, 55, 31181 }, // ₺
+    { 20, 20, 21, 0, 19, 73, 31236 }, // ₻
+    { 18, 18, 20, 1, 18, 60, 31309 }, // ₼
+    { 14, 18, 15, 0, 18, 57, 31369 }, // ₽
+    { 17, 20, 19, 1, 20, 75, 31426 }, // ₾
+    { 12, 24, 15, 2, 21, 76, 31501 }, // ₿
+    { 10, 18, 12, 1, 14, 38, 31577 }, // ⃀
+    { 12, 3, 14, 1, 10, 9, 31615 }, // −
+    { 23, 23, 25, 1, 19, 76, 31624 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
@@ -3299,4 +2804,5 @@ static const EpdFontData notosans_12_regular = {
     27,
     -8,
     true,
+    true,
 };
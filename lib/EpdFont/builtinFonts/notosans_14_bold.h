@@ -2,4480 +2,3315 @@
  * generated by fontconvert.py
  * name: notosans_14_bold
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_boldBitmaps[58987] = {
-    0x7F, 0xD7, 0xFE, 0x3F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xD3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F,
-    0xC3, 0xFC, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0,
-    0x50, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x82, 0xFC, 0x3F, 0x82, 0xFC,
-    0x3F, 0x82, 0xFC, 0x2F, 0x42, 0xF8, 0x1A, 0x41, 0xA4, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x1F,
-    0xC1, 0xF8, 0x00, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC1,
-    0xF8, 0x00, 0x6A, 0xFF, 0xAF, 0xFA, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0x47, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0xBE, 0x00, 0x00, 0x2F,
-    0x82, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x0F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFA, 0xFD, 0x2F, 0xE2, 0xD0, 0x10, 0xBF, 0x8B, 0x40, 0x02, 0xFF,
-    0xAD, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x01, 0xBF,
-    0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xD7, 0xFD, 0x00, 0x0B, 0x4F, 0xFA, 0x90, 0x2D, 0x3F,
-    0xDB, 0xFE, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x40, 0x1A, 0xFF, 0x90, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x80, 0x3F,
-    0x00, 0x00, 0x3F, 0x42, 0xFC, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x3F,
-    0x42, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x3F, 0x87, 0xF0, 0x6E, 0x40, 0x2F, 0xC3, 0xF4, 0xFD,
-    0x3F, 0xFE, 0x01, 0xFF, 0xFF, 0x2F, 0xCB, 0xFF, 0xF4, 0x0B, 0xFF, 0xD3, 0xF4, 0xFE, 0x2F, 0xC0,
-    0x1F, 0xE0, 0xBF, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x0F, 0xD0, 0x00, 0x03, 0xF8,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0xFD,
-    0x00, 0x01, 0xFC, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x0F, 0xFB, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xF9, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x2F, 0xFF, 0xFC, 0x03, 0xFD, 0x0F, 0xFD, 0xFF, 0xC1, 0xFF, 0x0B, 0xFC, 0x0F, 0xFC, 0xFF, 0x83,
-    0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x2F, 0xF4, 0x00, 0xFF, 0xF0, 0x07,
-    0xFF, 0x96, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xEF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF3, 0xFC, 0xFE, 0x3F,
-    0x8F, 0xE2, 0xF4, 0x69, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xE0, 0x0B,
-    0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0B, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x1A, 0x40, 0x2F,
-    0x80, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x0F, 0xF0, 0x03,
-    0xFC, 0x00, 0xBF, 0x40, 0x1F, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF8, 0x00, 0xFE, 0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x0F, 0xF0, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0xFF,
-    0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x1F, 0xD0, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x1F, 0x5B,
-    0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xEF, 0xE0, 0x00, 0xBF, 0x1F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x7F, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x3F, 0xD0,
-    0xFF, 0x03, 0xF8, 0x1F, 0xD0, 0xBF, 0x03, 0xF8, 0x0F, 0xC0, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF,
-    0xF4, 0xFF, 0xFD, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0xFF, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00,
-    0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xF9, 0xFF,
-    0xD0, 0xFF, 0x40, 0xFF, 0x87, 0xFC, 0x01, 0xFF, 0x2F, 0xE0, 0x03, 0xFC, 0xFF, 0x80, 0x0F, 0xF7,
-    0xFD, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0xFF, 0xBF, 0xD0, 0x03, 0xFE, 0xFF, 0x40, 0x0F, 0xFB, 0xFD,
-    0x00, 0x3F, 0xEF, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x03, 0xFD, 0x7F, 0xC0, 0x1F, 0xF0, 0xFF, 0x40,
-    0xBF, 0xC2, 0xFF, 0x5B, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFC, 0x02, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFC, 0x3F, 0xF7, 0xFC, 0x1F, 0xC7, 0xFC, 0x0A, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFA, 0xFF, 0xF0, 0xBD, 0x00, 0xBF, 0xC0, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFF, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xF4, 0x3F, 0xE6, 0xFF, 0xE0, 0x20, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x5B, 0xFD, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0xBF, 0xDF, 0x94, 0x1B, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x41, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0xFE, 0x00, 0x01, 0xFC, 0xBF, 0x80,
-    0x00, 0xFE, 0x2F, 0xE0, 0x00, 0xBF, 0x0B, 0xF8, 0x00, 0x7F, 0x02, 0xFE, 0x00, 0x3F, 0x80, 0xBF,
-    0x80, 0x2F, 0xC0, 0x2F, 0xE0, 0x1F, 0xFA, 0xAF, 0xFE, 0x8B, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x6A, 0xAA, 0xBF, 0xFA, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x50, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFD, 0x02, 0x95, 0x7F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFC, 0x40, 0x00, 0x2F, 0xF2, 0xF9, 0x57, 0xFF, 0x8B, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0x95, 0x80, 0x7F, 0xD0,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x41, 0x94, 0x02, 0xFC, 0xBF, 0xFD,
-    0x0F, 0xFB, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xE0, 0x2F, 0xF7, 0xFE, 0x00, 0x3F, 0xEF,
-    0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x02, 0xFE, 0xBF, 0x80, 0x0B, 0xF9, 0xFF, 0x40, 0x3F, 0xD3, 0xFF,
-    0x57, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xE0, 0x7F, 0xF1, 0xFF, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0xFF,
-    0x0F, 0xF0, 0x0B, 0xF8, 0x2F, 0xF4, 0xBF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0xBF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xD2, 0xFF, 0x8B, 0xFC, 0x02, 0xFF, 0x3F, 0xD0,
-    0x02, 0xFE, 0xFF, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x2F, 0xEB, 0xFD, 0x02, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x1F, 0xFE, 0xBF,
-    0xF4, 0x2F, 0xF0, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x03,
-    0xFE, 0x3F, 0xD0, 0x03, 0xFE, 0x3F, 0xF0, 0x0B, 0xFE, 0x1F, 0xFE, 0xBF, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xF6, 0xFD, 0x00, 0x6E, 0x82, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x01, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xE7, 0xFE, 0x3F,
-    0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFD, 0x7F, 0xE7,
-    0xFE, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x2F, 0xC1, 0xFF, 0x87, 0xFE, 0x0F, 0xF4, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x43, 0xFC,
-    0x0F, 0xE0, 0x7F, 0x42, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0xF9, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x06, 0xFF, 0xD0, 0x01, 0xFF, 0xF9, 0x00, 0xBF, 0xFE, 0x00, 0x7F, 0xFF, 0x40, 0x03,
-    0xFF, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x3F, 0xA6, 0xFF,
-    0xC1, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFE, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xAF,
-    0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x05, 0xA9, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0xFF, 0xE0, 0xFC, 0x2F, 0x81, 0xFF, 0xFF, 0xE0, 0xBD,
-    0x3F, 0x03, 0xFD, 0x0B, 0xE0, 0x7E, 0x7F, 0x07, 0xF0, 0x0B, 0xE0, 0x7F, 0x7E, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x7F, 0xBE, 0x0F, 0xD0, 0x0F, 0xE0, 0x7F, 0xBE, 0x0F, 0xD0, 0x0F, 0xD0, 0x7E, 0xBE, 0x0F,
-    0xE0, 0x0F, 0xD0, 0xFD, 0x7E, 0x0B, 0xF0, 0x2F, 0xE1, 0xFC, 0x7F, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0x41, 0xFF, 0xF4, 0xFF, 0xE0, 0x2F, 0xC0, 0x2A, 0x80, 0x2A, 0x40, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0xE5, 0x5B, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03,
-    0xFF, 0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE,
-    0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F,
-    0xFF, 0xE9, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xEA, 0xBF, 0xFC, 0xBF,
-    0xC0, 0x0B, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF,
-    0xD5, 0xBF, 0xF4, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x90, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xC0, 0x0B, 0xFD, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xBF,
-    0xC0, 0x07, 0xFE, 0xBF, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF, 0x03, 0xFF, 0x80, 0x01, 0x41, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x40,
-    0xBF, 0xFE, 0x5B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0x50, 0x00, 0x7F, 0xFF, 0xE9, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xC0, 0x0B, 0xFF, 0x4B, 0xFC, 0x00, 0x1F, 0xFC,
-    0xBF, 0xC0, 0x00, 0xBF, 0xDB, 0xFC, 0x00, 0x07, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x07, 0xFD, 0xBF, 0xC0, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x1F, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFF, 0x4B, 0xFE, 0xAF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA,
-    0xAA, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA, 0x97, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7,
-    0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00,
-    0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B,
-    0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F,
-    0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02,
-    0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xEA, 0xAA, 0xBF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0,
-    0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x0A, 0xBF,
-    0xF4, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF,
-    0xC7, 0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x07, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xC0,
-    0x3F, 0xF0, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xE0, 0x00,
-    0x7F, 0xCF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x07,
-    0xFC, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03,
-    0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xF7, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x02,
-    0xFF, 0xFD, 0xFE, 0xFD, 0x00, 0x0F, 0xEF, 0xF7, 0xF7, 0xF8, 0x00, 0x3F, 0x7F, 0xDF, 0xDB, 0xF0,
-    0x02, 0xFC, 0xFF, 0x7F, 0x5F, 0xC0, 0x0F, 0xE3, 0xFD, 0xFE, 0x3F, 0x80, 0x3F, 0x4F, 0xF7, 0xF8,
-    0xFF, 0x02, 0xFC, 0x3F, 0xDF, 0xE1, 0xFC, 0x0F, 0xE0, 0xFF, 0x7F, 0x83, 0xF4, 0x3F, 0x43, 0xFD,
-    0xFE, 0x0F, 0xF1, 0xFC, 0x0F, 0xF7, 0xF8, 0x2F, 0xCF, 0xE0, 0x3F, 0xDF, 0xE0, 0x7F, 0xBF, 0x40,
-    0xFF, 0x7F, 0x80, 0xFF, 0xFC, 0x03, 0xFD, 0xFE, 0x02, 0xFF, 0xE0, 0x0F, 0xF7, 0xF8, 0x07, 0xFF,
-    0x40, 0x3F, 0xDF, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x7F, 0x80, 0x2F, 0xE0, 0x03, 0xFC, 0x7F, 0xF4,
-    0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00,
-    0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03,
-    0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC,
-    0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F,
-    0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80,
-    0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00,
-    0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF,
-    0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F,
-    0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE,
-    0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x7F, 0xFF, 0xE4, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0xBF, 0xEF, 0xF0, 0x02, 0xFF, 0xBF, 0xC0,
-    0x0F, 0xFA, 0xFF, 0x01, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xAA, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4,
-    0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE,
-    0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0xFF, 0xA4,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE, 0xAF, 0xFF, 0x40, 0xBF,
-    0xC0, 0x1F, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x0B, 0xFD, 0x5B, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xC0,
-    0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0,
-    0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00,
-    0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00, 0x07, 0xFD, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xFA, 0xFF,
-    0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xD0,
-    0x03, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0xFF,
-    0x00, 0x00, 0x0F, 0xF7, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x2F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xC7, 0xFC, 0x00, 0x2F,
-    0xFC, 0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x03, 0xFF, 0xD0,
-    0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0xBF, 0x00, 0xBF,
-    0x80, 0x3F, 0xC0, 0x3F, 0xAF, 0xC0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xD7, 0xF4, 0x0F, 0xF0, 0x02,
-    0xFE, 0x07, 0xF4, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0xC2, 0xFC, 0x3F, 0xC2, 0xFE, 0x00, 0x0F, 0xF0,
-    0xFF, 0x0B, 0xF0, 0xFF, 0x40, 0x03, 0xFC, 0x3F, 0x81, 0xFD, 0x3F, 0xC0, 0x00, 0xBF, 0x5F, 0xD0,
-    0x3F, 0x8F, 0xF0, 0x00, 0x1F, 0xEB, 0xF0, 0x0F, 0xF7, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0x02, 0xFE,
-    0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xCB,
-    0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xAA,
-    0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0x7F, 0xFF, 0xFF, 0xFE, 0xAA, 0xA0, 0xBF, 0x40, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x7F, 0xFE, 0x7F, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x15, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE,
-    0x2A, 0xA9, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0F, 0xC3, 0xF4, 0x00,
-    0x0B, 0xE0, 0x7F, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x7F, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0xFD, 0x0A, 0x80, 0x00, 0x1A, 0x80, 0x15, 0x55,
-    0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x55, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0x40,
-    0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF,
-    0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x8B, 0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF,
-    0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF,
-    0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0x7F, 0xFF, 0xC0, 0xFE, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x01, 0xFF, 0xD3, 0xFD, 0x0B, 0xFF, 0xF7, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0,
-    0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0,
-    0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF,
-    0xF6, 0xFD, 0x02, 0xFF, 0xD1, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x03,
-    0xFF, 0x05, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0x01, 0x7F, 0xE5, 0x40, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00,
-    0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F,
-    0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07,
-    0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3,
-    0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0xD0, 0xFF, 0x7F, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFD, 0x3F, 0xE3, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F,
-    0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF8, 0x03, 0xFE,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8,
-    0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0,
-    0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80,
-    0x3F, 0xD6, 0xBF, 0xF6, 0xFF, 0xFC, 0xBF, 0xFD, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0xBF, 0x80, 0x2F,
-    0xF4, 0x2F, 0xE0, 0x1F, 0xF4, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFE, 0x1F, 0xF8, 0x00, 0xBF, 0x8F,
-    0xF8, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x0B, 0xF8, 0x0F, 0xF8, 0x02, 0xFE, 0x01, 0xFF, 0x40,
-    0xBF, 0x80, 0x2F, 0xF0, 0x2F, 0xE0, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xEF,
-    0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB,
-    0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x82, 0xFF, 0xD0, 0x7F, 0xFC, 0x0F, 0xF7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xF5, 0x7F, 0xFF, 0x57, 0xFF, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0x7F, 0xDF,
-    0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0xFF, 0x80, 0x0F, 0xF4,
-    0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF7, 0xFE,
-    0x00, 0x3F, 0xD0, 0x03, 0xFD, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFD, 0x00,
-    0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9, 0x7F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0,
-    0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03,
-    0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03,
-    0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x0B, 0xFE, 0x00, 0xFF, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F,
-    0xF4, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07,
-    0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F,
-    0xF8, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0x4F, 0xFE,
-    0x00, 0xFF, 0x80, 0x50, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F,
-    0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07,
-    0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xF7, 0xFD, 0x02, 0xFF, 0xD3,
-    0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xEF, 0xF2, 0xFF, 0xBF, 0xEF, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFE, 0x42, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0xBF, 0x80, 0x1C, 0x2F, 0xE0, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x80, 0x02, 0xFF, 0xF0,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x6D, 0x00, 0x7F, 0xDB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xF4,
-    0x7F, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00,
-    0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x54, 0x07,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFE, 0x00, 0x01, 0x40, 0xFF, 0x40, 0x0B, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xBF, 0xE5, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF,
-    0xF0, 0xBF, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD,
-    0x00, 0x2F, 0xE0, 0xBF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x03, 0xFD, 0x2F, 0xD0, 0x00, 0x7F, 0x8F, 0xF0,
-    0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x02, 0xFE, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xFC, 0x00, 0xBF,
-    0x5F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xD3, 0xFC, 0x02, 0xFF, 0xE0, 0x0F, 0xF0, 0xBF, 0x80, 0xFF,
-    0xFC, 0x07, 0xF8, 0x1F, 0xF0, 0x3F, 0x7F, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0xCF, 0xC0, 0xFF, 0x00,
-    0xFF, 0x4B, 0xE3, 0xF4, 0x7F, 0xC0, 0x2F, 0xE3, 0xF4, 0xBE, 0x2F, 0xE0, 0x07, 0xFC, 0xFC, 0x1F,
-    0xCF, 0xF4, 0x00, 0xFF, 0x3F, 0x03, 0xF3, 0xFC, 0x00, 0x3F, 0xDF, 0xC0, 0xFD, 0xFE, 0x00, 0x07,
-    0xFB, 0xE0, 0x2F, 0xBF, 0x40, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF4, 0xBF, 0xC0, 0x02,
-    0xFF, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFC, 0xFF,
-    0x80, 0x0B, 0xFC, 0x1F, 0xF4, 0x03, 0xFE, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xE2, 0xFF, 0x40,
-    0x0B, 0xFD, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x2F, 0xF0, 0xBF,
-    0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x00,
-    0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x0F, 0xF7, 0xF8,
-    0x00, 0x01, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03,
-    0xFE, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC1, 0x55,
-    0x5F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF9,
-    0x55, 0x43, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0x06, 0xF4, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x1F, 0xFF, 0x00, 0xBF, 0xE0, 0x02,
-    0xFF, 0xD0, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x3F,
-    0xF4, 0x00, 0x06, 0x80, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0x69, 0xBA, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x1B, 0xFD, 0x00, 0x0B, 0xF4, 0x00,
-    0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x00, 0xBF, 0xFC, 0x00, 0x6F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xFE, 0x01, 0xFF, 0x00, 0x07, 0xF4,
-    0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xD0, 0x0B, 0xFF,
-    0x40, 0x3F, 0xFC, 0x00, 0xFF, 0xD0, 0x02, 0x94, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x01, 0xFF, 0xFE,
-    0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0x7E, 0x6B, 0xFF, 0xFD, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x83, 0xFD, 0x7F, 0xE3, 0xFD, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xA8, 0x2F, 0xC2, 0xFC,
-    0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F, 0xD3, 0xFD, 0x3F, 0xD7, 0xFE, 0x7F,
-    0xE1, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xBF, 0xE4, 0x07,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xD3, 0xFF, 0xEB, 0xF1, 0xFF, 0x80, 0x04, 0xBF, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x19, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF0,
-    0x00, 0x7F, 0x50, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x9A,
-    0xE0, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x5B, 0xFD, 0x55, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0x40, 0xAF, 0xFE, 0xAA,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x08, 0x00, 0x02, 0x43, 0xF6, 0xFD, 0xBD, 0x3F, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x7F, 0x41, 0xFC, 0x01, 0xF8, 0x1F, 0x80, 0x0F, 0xC1, 0xF8, 0x00,
-    0xFC, 0x0F, 0xD0, 0x3F, 0x80, 0xFF, 0xEF, 0xF4, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x1E,
-    0x05, 0x03, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0xBF, 0xC2, 0xFE,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x07, 0xFC, 0x00,
-    0x2F, 0xD2, 0xFD, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x57, 0xFE,
-    0x54, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0A, 0xBF, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x15,
-    0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x3F, 0xD5, 0xFC, 0x7F, 0x00, 0x04, 0x3F, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x2F, 0xDF, 0xFC, 0x3F, 0x01, 0xFD, 0x7F,
-    0x00, 0xBE, 0x3F, 0x40, 0xBE, 0x3F, 0xE0, 0xFE, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x50, 0x00, 0xFE, 0x7E, 0x57, 0xFD, 0x7F, 0xFF, 0xF8,
-    0x2F, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x2F, 0x01, 0xF5, 0xFE, 0x0F, 0xF7, 0xF8, 0x3F, 0xCB, 0x80,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF,
-    0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x06, 0xFF,
-    0x82, 0xF0, 0x1F, 0x01, 0xFF, 0xFC, 0x0B, 0x83, 0xD0, 0x7E, 0x01, 0x40, 0x3C, 0x3C, 0x0F, 0xC0,
-    0x00, 0x02, 0xD7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xFB, 0x41, 0xF0,
-    0x00, 0x00, 0x0F, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xF7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0x3C, 0x0F,
-    0x80, 0x00, 0x02, 0xD3, 0xC0, 0x7D, 0x00, 0x00, 0x3C, 0x2F, 0x03, 0xFF, 0xFC, 0x0B, 0xC0, 0xF4,
-    0x0B, 0xFF, 0x81, 0xF0, 0x07, 0xE0, 0x01, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x1F, 0xFF, 0xD0, 0xE4, 0xBE, 0x00, 0x03, 0xF0, 0xBF, 0xFF, 0x3F,
-    0xEB, 0xF3, 0xF0, 0x3F, 0x3F, 0x0B, 0xF3, 0xFF, 0xFF, 0x1F, 0xF5, 0xF0, 0x14, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0xBE, 0x01, 0xF8, 0x01, 0xFF, 0x03, 0xFD, 0x03, 0xFD, 0x0F, 0xF8, 0x0F, 0xF8,
-    0x2F, 0xF0, 0x3F, 0xF0, 0xBF, 0xC0, 0xBF, 0xC1, 0xFF, 0x00, 0xBF, 0xC1, 0xFF, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x0F, 0xF8, 0x3F, 0xF0, 0x03, 0xFD, 0x0F, 0xF8, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0xBE,
-    0x01, 0xF8, 0x00, 0x10, 0x00, 0x40, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0x45, 0x55, 0x55, 0xFD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0x50, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF,
-    0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x3F, 0xFD,
-    0x02, 0xF0, 0x1F, 0x03, 0xFF, 0xF8, 0x0B, 0x83, 0xD0, 0x3D, 0x0B, 0xD0, 0x3C, 0x3C, 0x03, 0xD0,
-    0x3D, 0x02, 0xD7, 0x80, 0x3D, 0x03, 0xD0, 0x1E, 0xB4, 0x03, 0xD0, 0xBC, 0x01, 0xFB, 0x40, 0x3F,
-    0xFF, 0x40, 0x0F, 0xB4, 0x03, 0xFF, 0xD0, 0x01, 0xF7, 0x80, 0x3D, 0x2F, 0x00, 0x1E, 0x3C, 0x03,
-    0xD0, 0xF8, 0x02, 0xD3, 0xC0, 0x3D, 0x07, 0xC0, 0x3C, 0x2F, 0x03, 0xD0, 0x3E, 0x0B, 0xC0, 0xF4,
-    0x3D, 0x01, 0xF5, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFC, 0x1F, 0xEB, 0xF8, 0xBD, 0x03, 0xF3, 0xF0, 0x0B,
-    0xCF, 0xC0, 0x2F, 0x2F, 0x81, 0xFC, 0x3F, 0xFF, 0xD0, 0x7F, 0xFE, 0x00, 0x1A, 0x80, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x0A, 0xAB, 0xFE, 0xAA, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0xBF, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xFE, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0xD0, 0xD0,
-    0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x07, 0xF8, 0x01, 0xFE, 0x00,
-    0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x06, 0xFE, 0x00, 0xFF, 0xFF, 0x02, 0xFA, 0xFE,
-    0x01, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0A, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xAB, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC3, 0xE6, 0xFF, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0xBF, 0x80, 0x7F, 0x40, 0x15, 0x00, 0x00, 0xFF, 0x40, 0x07,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF5, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xEF, 0xF4, 0xBF, 0xFF, 0x45, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xFF, 0xFD, 0x7E, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E,
-    0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E,
-    0x3F, 0xFF, 0xF8, 0x3E, 0x2F, 0xFF, 0xF8, 0x3E, 0x0F, 0xFF, 0xF8, 0x3E, 0x02, 0xFF, 0xF8, 0x3E,
-    0x00, 0x04, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E,
-    0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0xB8, 0x3E, 0x00, 0x00, 0x64, 0x29,
-    0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x0B, 0xC0, 0x0F, 0xE0, 0x07, 0xFC, 0x00,
-    0xFC, 0x56, 0xFC, 0x7F, 0xF8, 0x7F, 0xD0, 0x00, 0x2A, 0x00, 0x3F, 0xC0, 0x7F, 0xF0, 0xBF, 0xFC,
-    0x2F, 0x7F, 0x02, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0xFD, 0x0B, 0xE6, 0xFC,
-    0x3F, 0x02, 0xF4, 0xF8, 0x0B, 0xD3, 0xE0, 0x1F, 0x4F, 0xC0, 0xBD, 0x3F, 0x47, 0xF0, 0x3F, 0xFF,
-    0x80, 0x7F, 0xF4, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0xBF, 0xC1,
-    0xFF, 0x40, 0x2F, 0xF0, 0x7F, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x03, 0xFD, 0x0F, 0xF8, 0x01, 0xFF,
-    0x43, 0xFE, 0x01, 0xFF, 0x43, 0xFE, 0x03, 0xFD, 0x0F, 0xF8, 0x0F, 0xF8, 0x2F, 0xF0, 0x2F, 0xF0,
-    0x7F, 0xC0, 0xBF, 0xC1, 0xFF, 0x40, 0x2F, 0x00, 0xBD, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0xFE, 0x00, 0x0B, 0xE0, 0x00, 0x2D, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE,
-    0x02, 0xFC, 0x02, 0xA0, 0x00, 0xBE, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0xBE, 0x0B, 0xF0, 0x2F, 0xF0,
-    0x00, 0xBE, 0x0F, 0xC0, 0x3F, 0xF0, 0x00, 0x69, 0x2F, 0x80, 0xFB, 0xF0, 0x00, 0x00, 0x7F, 0x02,
-    0xF3, 0xF0, 0x00, 0x00, 0xFE, 0x03, 0xD3, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0x83, 0xF0, 0x00, 0x03,
-    0xF4, 0x2F, 0xAB, 0xFA, 0x00, 0x0B, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x2F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x2F, 0x80, 0x00, 0x2D, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBE,
-    0x02, 0xFC, 0x1B, 0xA0, 0x00, 0x2F, 0x80, 0xFD, 0x7F, 0xFF, 0x40, 0x0B, 0xE0, 0xBF, 0x2F, 0xFF,
-    0xF0, 0x02, 0xF8, 0x3F, 0x02, 0x82, 0xFC, 0x00, 0x69, 0x2F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x7F, 0xFF, 0x40, 0x02,
-    0xFC, 0x00, 0x3E, 0x6F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x1F,
-    0x80, 0x1F, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFD, 0x00, 0x7F, 0x00, 0x00,
-    0x05, 0x7F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x0A, 0x90, 0x40, 0x0F, 0xD3, 0xF4,
-    0x1F, 0xE0, 0xBE, 0xBF, 0xCB, 0xF0, 0x3F, 0xE0, 0xBF, 0xFF, 0x4F, 0xD0, 0xFF, 0xE0, 0x1B, 0xF8,
-    0x2F, 0x81, 0xFB, 0xE0, 0x00, 0x00, 0x7F, 0x03, 0xDF, 0xE0, 0x00, 0x00, 0xFE, 0x0F, 0x8F, 0xE0,
-    0x00, 0x01, 0xFC, 0x1F, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x3F, 0xAF, 0xF8, 0x00, 0x07, 0xF0, 0x3F,
-    0xFF, 0xFD, 0x00, 0x0F, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x10, 0x3F, 0xF5, 0x6F, 0xC3, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00,
-    0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF,
-    0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xE0, 0x00,
-    0x00, 0x7F, 0x41, 0xFE, 0x00, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xC0, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7,
-    0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07,
-    0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0,
-    0x00, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00,
-    0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00,
-    0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x00,
-    0x1E, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC,
-    0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00,
-    0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x1F, 0xFA, 0xAA, 0x90, 0x00, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xEA,
-    0xAA, 0x83, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x07,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEA, 0xFF, 0x03, 0xFF, 0x80, 0x01, 0x41,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x40, 0xBF, 0xFE, 0x5B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x06, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x55,
-    0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x15, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F,
-    0xFF, 0x40, 0x3F, 0xCB, 0xF0, 0x2F, 0xC0, 0xBF, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFE, 0x0B, 0xC0, 0xBD, 0x07, 0xF8, 0x3F, 0xC1, 0xFD, 0x0F, 0xF0, 0x2E, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xD7, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00,
-    0x07, 0xFE, 0xAA, 0xA1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA,
-    0xA9, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x15, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x05, 0x54, 0x00, 0xBF, 0xD0, 0x07, 0xFC,
-    0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x3F,
-    0xCF, 0xF0, 0x3F, 0x80, 0xBF, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF4,
-    0x2E, 0x02, 0xF1, 0xFD, 0x0F, 0xE7, 0xF4, 0x3F, 0x8B, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFE, 0x80, 0x00,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFC, 0x00, 0xBF, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFC,
-    0x00, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0x7F, 0xFF, 0xFC,
-    0x03, 0xFF, 0x7F, 0xFF, 0xFC, 0x03, 0xFE, 0x2B, 0xFE, 0xA4, 0x03, 0xFE, 0x07, 0xFC, 0x00, 0x07,
-    0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xF4,
-    0x07, 0xFE, 0xAF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x00, 0x00, 0x3F,
-    0xFE, 0xBE, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0xF4, 0x00, 0x00, 0x50, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03,
-    0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC,
-    0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F,
-    0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80,
-    0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F,
-    0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF,
-    0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD,
-    0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF,
-    0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE,
-    0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00,
-    0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x05, 0x40, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F,
-    0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F,
-    0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0,
-    0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFE, 0x02, 0xE0, 0x00, 0x01, 0xFF, 0xFA, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x3D, 0x0B, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F,
-    0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF,
-    0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF,
-    0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x00, 0x02,
-    0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x9B,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x00, 0x02, 0x01, 0xF4, 0x00, 0xBC, 0x3F, 0xD0,
-    0x2F, 0xE0, 0xFF, 0x4B, 0xF8, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0x8F, 0xF4, 0x2F, 0xE0, 0x3F, 0xD2, 0xF8, 0x00,
-    0xFD, 0x0A, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x02, 0xFF,
-    0xFE, 0x7E, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFC, 0x3F, 0xE0, 0x03, 0xF6, 0xFF, 0x1F, 0xF4, 0x02, 0xF8, 0x7F, 0xD7, 0xFD, 0x01, 0xFC,
-    0x1F, 0xF5, 0xFF, 0x40, 0xFD, 0x07, 0xFD, 0x7F, 0xD0, 0xBE, 0x01, 0xFF, 0x5F, 0xF4, 0x7F, 0x00,
-    0x7F, 0xD3, 0xFE, 0x3F, 0x40, 0x2F, 0xF0, 0xFF, 0xEF, 0x80, 0x0F, 0xFC, 0x2F, 0xFF, 0xC0, 0x07,
-    0xFE, 0x03, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFA, 0xFF, 0xFE, 0x40, 0x00, 0x2C, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F,
-    0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xF6, 0xFD, 0x00, 0x02, 0xFC,
-    0x07, 0xF4, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F,
-    0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00,
-    0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xA4,
-    0x00, 0x7F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x0B, 0xFE,
-    0x7F, 0xC0, 0x0F, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x7F, 0xDF, 0xF0, 0x02, 0xFF, 0x7F,
-    0xC0, 0x2F, 0xF9, 0xFF, 0xAF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF,
-    0xE4, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xF4, 0x1F, 0xFD, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x03, 0xFD,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x2F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x82,
-    0xFF, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0x83, 0xFF, 0x80, 0x0F, 0xF8, 0x1F, 0xFF, 0x40,
-    0xFF, 0x80, 0x7F, 0xFE, 0x0F, 0xF8, 0x00, 0xFF, 0xF8, 0xFF, 0x80, 0x01, 0xFF, 0xCF, 0xF8, 0x00,
-    0x07, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xDF, 0xF8, 0x60, 0x0B, 0xFD, 0xFF, 0x87, 0xFF, 0xFF, 0xCF,
-    0xF8, 0x7F, 0xFF, 0xF4, 0xFF, 0x83, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F,
-    0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0,
-    0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F,
-    0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4,
-    0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x6F, 0xD0,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F,
-    0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x0B, 0xC0, 0x3F, 0xFE, 0xBE, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0x81, 0xFF, 0x40, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8,
-    0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8,
-    0x3F, 0x40, 0x14, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x40, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0x83, 0xFC,
-    0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4, 0x03,
-    0xFD, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x7F, 0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xF7, 0xF4, 0x2F, 0xFE, 0x0F, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0xF4, 0x3D, 0x00, 0x02,
-    0xFB, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB,
-    0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x42, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0x80, 0x2F, 0xFE, 0x02, 0xFF, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xF4, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xEB, 0xFD, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x1F, 0xFF, 0xC0, 0x06, 0x87, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x05, 0x7F, 0xC0, 0x00, 0xBF, 0xF8, 0x00,
-    0x07, 0xFD, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x02,
-    0xFD, 0xBF, 0x40, 0x0B, 0xF0, 0x2F, 0xC0, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x02, 0xF0, 0x1F, 0x40, 0x07, 0xF8, 0x3F, 0xC0, 0x07, 0xF8, 0x3F, 0xC0, 0x02,
-    0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F,
-    0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x15,
-    0x50, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x01, 0x55, 0x00, 0xFF, 0x80, 0xFF, 0x80,
-    0xFF, 0x40, 0xBF, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F,
-    0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-    0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF8, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0x8F, 0xF0, 0x3F, 0x80, 0xFF, 0x05, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3E, 0x02, 0xE2, 0xFC, 0x1F, 0xDB, 0xF0, 0x7F,
-    0x4F, 0x40, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xC0, 0x00, 0x7F, 0xEF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x7F,
-    0xD0, 0x00, 0x34, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF7, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xF4, 0x1F, 0xFE, 0x7F, 0xD0, 0x03, 0xFF, 0x7F, 0xC0, 0x03,
-    0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xD0, 0x03,
-    0xFC, 0x3F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0x40, 0x7F, 0xFE, 0xBD,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0x02, 0xFF, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF4, 0x0F, 0xE0,
-    0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xF0, 0x02, 0xFF, 0xFB, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xC1, 0xFF, 0x80,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xF4, 0x0F, 0x80,
-    0x03, 0xFC, 0x2F, 0xC0, 0x03, 0xFC, 0x2F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
-    0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0xFE, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xF9, 0x7F, 0xF8, 0x3F, 0xE0, 0x3F, 0xFC, 0x7F, 0xC0, 0xBF, 0xFD, 0xBF, 0xC1, 0xFF,
-    0xFE, 0xBF, 0xC3, 0xF2, 0xFE, 0xBF, 0xCB, 0xD2, 0xFE, 0xBF, 0xDF, 0xC3, 0xFE, 0x7F, 0xFF, 0x03,
-    0xFD, 0x3F, 0xFD, 0x07, 0xFC, 0x2F, 0xFD, 0x2F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0,
-    0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9,
-    0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0x3F, 0xC0,
-    0x0F, 0xE0, 0x2F, 0xC0, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x2F,
-    0xD1, 0xFE, 0x00, 0xBF, 0x47, 0xF8, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF,
-    0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFB, 0xFE,
-    0x5B, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xF7, 0xFC, 0x2F, 0xFF, 0x0B, 0xF0, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1,
-    0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x07,
-    0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x8B,
-    0xFE, 0x00, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xF5, 0x7F, 0xF4, 0xFF, 0xC0,
-    0x0F, 0xF8, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80,
-    0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0xC0, 0x0B, 0xFC, 0xFF, 0xC0, 0x0F, 0xF8, 0xFF, 0xF5,
-    0x7F, 0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xC0, 0xFF, 0x4F, 0xFE, 0x00, 0xFF, 0x80,
-    0x50, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0x80, 0x00, 0xFF,
-    0x07, 0xF4, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x02, 0xFF,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x2F, 0xE0, 0x07, 0xFC, 0x0F,
-    0xF0, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0xFF,
-    0x7F, 0x80, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0x80, 0x00,
-    0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x7F, 0xC0, 0x00,
-    0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0xFF,
-    0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x02,
-    0xAA, 0xAA, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F,
-    0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF,
-    0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xFF, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0,
-    0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0,
-    0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0,
-    0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x05, 0x40, 0x01, 0x50, 0x1F, 0x40, 0x1F, 0x40, 0x3F, 0xEB, 0xFC,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03,
-    0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF,
-    0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00,
-    0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF,
-    0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF,
-    0x83, 0xF4, 0x01, 0x40, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xB9, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0F, 0xF8, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0x6F, 0xD0, 0x00, 0xBF, 0x01,
-    0xFD, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0xFF, 0xFC, 0x00, 0x3F, 0xCF, 0xF0, 0x0F, 0xE0, 0x2F, 0xC0, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x15,
-    0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFE, 0xAF, 0xF0, 0x3F, 0xF8, 0x00, 0x14, 0x1F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x04, 0x0B, 0xFF, 0xE5, 0xBF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0xFE, 0x01, 0xFE, 0x03,
-    0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x2F, 0xFD, 0x5B, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0xD5, 0xBC, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x01, 0x50, 0x00, 0x54,
-    0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFC, 0x00,
-    0xBF, 0xF4, 0xBF, 0xC0, 0x01, 0xFF, 0xCB, 0xFC, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00, 0x7F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x7F, 0xDB, 0xFC, 0x00, 0x0B, 0xFC, 0xBF,
-    0xC0, 0x01, 0xFF, 0xCB, 0xFC, 0x00, 0xBF, 0xF4, 0xBF, 0xEA, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD2, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xD3, 0xF4,
-    0x00, 0x00, 0x03, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xD2, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xFD, 0x3F, 0xD0, 0x00, 0x0B, 0xFF, 0xF7, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xF9, 0x6F, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xC0, 0x03, 0xFD,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0x07,
-    0xFD, 0x00, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x6F, 0xD0, 0x00, 0x02, 0xFF, 0xD1, 0xFD, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFC, 0x00, 0xBF, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC, 0x00, 0x0B,
-    0xFD, 0x07, 0xFC, 0x00, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xFF, 0xFC, 0x03, 0xFF,
-    0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0x7F, 0xFF, 0xFC, 0x03, 0xFE, 0x2B, 0xFE, 0xA4, 0x03, 0xFE, 0x07,
-    0xFC, 0x00, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFC,
-    0x00, 0xBF, 0xF4, 0x07, 0xFE, 0xAF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0xE3, 0xFD, 0x00,
-    0xBF, 0xFF, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x7F, 0xF0, 0x0B,
-    0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0xBF,
-    0xD0, 0x03, 0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x95, 0xFF,
-    0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x7F, 0xD0, 0x02, 0xFF, 0xC2, 0xFD, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x15, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x5F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA,
-    0x87, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0xAA, 0xA5, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE0, 0x02, 0xAA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0x80, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC,
-    0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x15, 0x00, 0x05, 0x47, 0xC0, 0x07, 0xD0, 0xFF, 0xAF, 0xF0, 0x1F, 0xFF, 0xF4, 0x01, 0xFF, 0xF4,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA,
-    0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x05, 0x40, 0x01, 0x50, 0x07,
-    0xD0, 0x07, 0xD0, 0x03, 0xFE, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA,
-    0x97, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x01,
-    0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x15, 0x00, 0x05, 0x42, 0xFC, 0x03, 0xF8, 0x0F, 0xF5, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x47, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x87,
-    0xFF, 0xFF, 0xF8, 0x05, 0x40, 0x01, 0x50, 0x0B, 0xF0, 0x0F, 0xF0, 0x02, 0xFD, 0x7F, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F,
-    0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7,
-    0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00,
-    0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B,
-    0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x02, 0xFD, 0x7F, 0x40, 0x07, 0xF4, 0x1F, 0xD0, 0x05, 0x40, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9,
-    0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0,
-    0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0,
-    0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF,
-    0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5,
-    0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x15,
-    0x00, 0x05, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0,
-    0xFF, 0xF4, 0x00, 0x14, 0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F,
-    0xD0, 0x1F, 0xFF, 0xF3, 0xFD, 0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02,
-    0xFF, 0x2F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x01, 0x40, 0x01, 0x50, 0x03, 0xD0, 0x03, 0xE0, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1,
-    0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD,
-    0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F,
-    0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD,
-    0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD,
-    0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD,
-    0x0B, 0xFF, 0xFB, 0xFD, 0x02, 0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x10, 0x00, 0x0F, 0xFC, 0x2F, 0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFA, 0xBF, 0xC0, 0xFF, 0xF4, 0x00, 0x14, 0x1F,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x1A, 0xAA, 0xA7, 0xFD, 0x01, 0xFF, 0xFF, 0x7F, 0xD0, 0x1F, 0xFF, 0xF3, 0xFD,
-    0x01, 0xFF, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF3, 0xFF, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x2F,
-    0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x0B, 0xFF, 0xE5, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD1, 0xFD, 0x0B, 0xFF, 0xFA, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xF9, 0x6F, 0xFD, 0x3F, 0xE0, 0x0B, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF,
-    0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F,
-    0xE0, 0x07, 0xFD, 0x3F, 0xF8, 0x1F, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFB, 0xFD, 0x02,
-    0xFF, 0xD3, 0xFD, 0x00, 0x04, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x10, 0x00, 0x0F, 0xFC, 0x2F,
-    0xA5, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC0, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x07, 0xF5, 0xFE,
-    0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x15, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F,
-    0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFE, 0xAA, 0xAB, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7,
-    0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00,
-    0x3F, 0x80, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xFD, 0x00,
-    0x0F, 0xF7, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xF9, 0x7F, 0xF8, 0x03, 0xFF,
-    0x40, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B,
-    0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0xFF, 0x80, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xE0,
-    0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x01,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFE, 0xAA, 0xAB, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00,
-    0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x14, 0x00, 0x0B, 0xF8, 0xBF, 0xF8, 0x02, 0xFE, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFD, 0x0B, 0xFF, 0x0B, 0xFD, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x1F, 0xF0, 0xBF, 0xC0, 0x07, 0xFC,
-    0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x80, 0x07,
-    0xFC, 0x2F, 0xE0, 0x01, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xC2, 0xFE, 0x00, 0x1F, 0xF0, 0xBF, 0x80,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x3F, 0xFE, 0xBE, 0xBF, 0xFF, 0xFC, 0xF8, 0x1F,
-    0xF4, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD,
-    0x01, 0xFF, 0xE0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB, 0xF0,
-    0xFF, 0xFF, 0xF8, 0x7C, 0x0B, 0xFC, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x00, 0x2A, 0xAA, 0xA4, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x85, 0x55, 0x54, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x07, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF4,
-    0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x6A, 0xAA, 0xA1, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x54, 0x00, 0x14, 0xBC, 0x00, 0x7D, 0x3F, 0xEF, 0xFC, 0x2F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF4, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x54, 0x00, 0x14, 0xFC, 0x00, 0xBC, 0x7F, 0xEF, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-    0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBE,
-    0x00, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x02, 0xA8, 0x00, 0x02, 0xFD, 0x3F, 0xE3, 0xFE, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3,
-    0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0xF8, 0x3F, 0x0B, 0xD0,
-    0xFD, 0x0B, 0xFF, 0x3F, 0xF0, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFD, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0xFF, 0xBF, 0xEF,
-    0xFB, 0xFE, 0xFF, 0xBF, 0xEF, 0xFB, 0xFE, 0x3F, 0xFF, 0xF4, 0x0B, 0xF8, 0xFF, 0xFF, 0xD0, 0x2F,
-    0xE3, 0xFF, 0xFF, 0x40, 0xBF, 0x81, 0xFF, 0xE0, 0x02, 0xFE, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0B,
-    0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x02, 0xFE, 0x02, 0xFF, 0x00,
-    0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x02, 0xFE,
-    0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0xBF,
-    0xC0, 0x02, 0xFE, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x0F, 0xFD, 0x00, 0x2F, 0xE3, 0xFF, 0xFF, 0x40,
-    0xBF, 0x8F, 0xFF, 0xFD, 0x02, 0xFE, 0x3F, 0xFF, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x06, 0xAF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x2F, 0xC3, 0xFE, 0x00, 0xFF, 0x8F, 0xF8, 0x03, 0xFE, 0x1F, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80,
-    0x3F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F,
-    0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD3,
-    0xFE, 0x00, 0xFF, 0x4F, 0xF8, 0x03, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD3, 0xFE,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x6B,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xCB, 0xF4, 0x0B, 0xF0, 0x2F, 0xC0, 0x54,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x2A, 0xFF, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
-    0xFF, 0x00, 0x3F, 0x8F, 0xF0, 0x3F, 0x80, 0xFE, 0x05, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x06, 0xBF, 0xF4, 0x02,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x07, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xF0,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x7F, 0xCF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFB, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x07, 0xFC, 0x03,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x07,
-    0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xF4, 0xBF, 0x80, 0x2F, 0xF4, 0x2F, 0xE0,
-    0x1F, 0xF4, 0x0B, 0xF8, 0x1F, 0xF8, 0x02, 0xFE, 0x1F, 0xF8, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0x2F,
-    0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x0B, 0xF8, 0x0F, 0xF8, 0x02, 0xFE, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x03, 0xFF, 0x0B, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFD, 0x2F, 0xE0, 0x03, 0xFD,
-    0x0B, 0xF8, 0x03, 0xFE, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0x82, 0xFF, 0x00, 0x2F, 0xE2, 0xFF,
-    0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x7F, 0xD0, 0x2F,
-    0xE0, 0x0B, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0xC2, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x55, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0xEA, 0xAA, 0x9B, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x55,
-    0x40, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
-    0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-    0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F,
-    0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3,
-    0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFE,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x01, 0x50, 0x7F, 0xC0, 0x0F, 0xF2, 0xFF, 0x00, 0x3F, 0x8B, 0xFC, 0x01,
-    0xFC, 0x2F, 0xF0, 0x0B, 0xE0, 0xBF, 0xC0, 0x2F, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0x4B, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF,
-    0xF4, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xEF, 0xF8, 0xBF, 0x3F, 0xE2, 0xF8,
-    0xFF, 0x8F, 0xC3, 0xFE, 0x29, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0xBF, 0x0B, 0xFC, 0x0F, 0xF8, 0xBF, 0xC0, 0xFF, 0x8B, 0xFC, 0x07, 0xF0, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0xFE, 0x3F, 0xEB, 0xFC,
-    0xFF, 0xAF, 0xF3, 0xFE, 0x3F, 0x4F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x40, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x17, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA9, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFD, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE,
-    0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x2F,
-    0xFD, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xD0, 0xBF, 0xFC, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x0B,
-    0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC,
-    0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F,
-    0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B,
-    0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF,
-    0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6,
-    0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC,
-    0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97, 0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC,
-    0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F,
-    0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B,
-    0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF,
-    0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6,
-    0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC,
-    0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFD, 0xFF, 0xF9, 0x7F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x54, 0x00, 0x15,
-    0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD7, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF,
-    0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0,
-    0x03, 0xFC, 0x7F, 0x5F, 0xF4, 0x03, 0xFC, 0x7F, 0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03,
-    0xFC, 0x7F, 0x82, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC,
-    0x7F, 0x80, 0x3F, 0xF3, 0xFC, 0x7F, 0x80, 0x1F, 0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F,
-    0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80, 0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80,
-    0x00, 0x7F, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x05, 0x40, 0x01, 0x50, 0x3F, 0x80, 0x7F, 0x80,
-    0x3F, 0xCB, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x82, 0xFF, 0xD0, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x97,
-    0xFF, 0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x47, 0xFF, 0xC0,
-    0x3F, 0x43, 0xF9, 0xFF, 0xFF, 0x41, 0x50, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xD5, 0xFF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xE0, 0x7F, 0xF4, 0x00, 0x02, 0xFC, 0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00,
-    0x03, 0xFC, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0xBF, 0xF0, 0x03,
-    0xFC, 0x7F, 0x6F, 0xF8, 0x03, 0xFC, 0x7F, 0x4F, 0xFD, 0x03, 0xFC, 0x7F, 0x47, 0xFF, 0x03, 0xFC,
-    0x7F, 0x82, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0xFF, 0xD3, 0xFC, 0x7F, 0x80, 0x7F, 0xF2, 0xFC, 0x7F,
-    0x80, 0x2F, 0xFE, 0xFC, 0x7F, 0x80, 0x0F, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC, 0x7F, 0x80,
-    0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x3F, 0xFC, 0x7F, 0x80, 0x00,
-    0x1F, 0xFC, 0x7F, 0x80, 0x00, 0x0F, 0xFC, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9,
-    0x6F, 0xFB, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0A, 0xAA, 0xA8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80,
-    0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F,
-    0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF,
-    0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x15, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8,
-    0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40,
-    0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x50, 0x03, 0xE0, 0x03, 0xF0,
-    0x02, 0xFF, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
-    0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x54, 0x15, 0x00, 0x00, 0x03, 0xFE,
-    0x3F, 0xD0, 0x00, 0x01, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0xAF,
-    0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01,
-    0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07,
-    0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0xFF, 0x1F, 0xF0, 0x03, 0xFD, 0x3F, 0xC0, 0x07, 0xF0, 0xFE,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x05, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07,
-    0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02,
-    0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF,
-    0xFF, 0xE0, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF,
-    0xAA, 0xA8, 0x7F, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC7, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x96, 0xBF, 0xFA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF, 0xC0, 0x3F, 0xE0, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x3F, 0xC7,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xDB, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xE4, 0xBF, 0xFF, 0x80, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFA, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xEA,
-    0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xD5, 0xBF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x0B,
-    0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x05, 0x54, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B, 0xF8, 0xFF, 0x2F, 0xF8, 0xFF, 0xBF, 0xF4, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-    0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80,
-    0x00, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xA4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x0B, 0xFE, 0xAF, 0xFF, 0x40, 0xBF, 0xC0, 0x1F, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF,
-    0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0F, 0xF8, 0x0B, 0xFD, 0x5B, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFC,
-    0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF4,
-    0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFE, 0x3F, 0xCB, 0xFE, 0x3F, 0xEF, 0xFD, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00,
-    0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x40, 0x01, 0x50, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xEA, 0xFF, 0xF4, 0x0B, 0xFC, 0x01, 0xFF, 0xC0,
-    0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0xBF, 0xC0, 0x0B, 0xFC, 0x0B, 0xFC, 0x00,
-    0xFF, 0x80, 0xBF, 0xD5, 0xBF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xC1, 0xFF, 0x40, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x3F,
-    0xE0, 0x0B, 0xFC, 0x02, 0xFF, 0x40, 0xBF, 0xC0, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF,
-    0xC0, 0x03, 0xFF, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x14, 0x00, 0x05, 0x0F, 0xE0, 0x1F, 0xD1, 0xFE,
-    0x2F, 0xD0, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x0B, 0xF8, 0x3F, 0xCB, 0xFE, 0x0F, 0xFB, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0xFF, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F,
-    0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01, 0xC2, 0xFE, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF,
-    0x47, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00, 0x15, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x01, 0xFF,
-    0xFC, 0x00, 0x7F, 0x9F, 0xE0, 0x1F, 0xD0, 0x3F, 0x80, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00,
-    0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0x9F, 0xE0, 0x7F, 0x40, 0xFE, 0x05, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x2F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01,
-    0xC2, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA, 0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x01, 0x5B, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x42, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0xBF, 0x80,
-    0x1C, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x6D, 0x00, 0x7F, 0xDB, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01,
-    0xBF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x9B, 0xF4, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x05,
-    0x00, 0x01, 0x41, 0xFD, 0x02, 0xFC, 0x07, 0xF8, 0xFF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xF8,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFA, 0xBF, 0xC7, 0xFD, 0x00, 0x14, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xFA,
-    0x00, 0x02, 0xFF, 0xBF, 0x95, 0xFF, 0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x05, 0x0F, 0xE0, 0x1F, 0xD1, 0xFE, 0x2F, 0xD0, 0x1F,
-    0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x2F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8B, 0xF8, 0x01, 0xC2, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x0F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF6, 0xD0, 0x07, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x47, 0xFF, 0xFE, 0x00,
-    0x01, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x09, 0x7F,
-    0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00,
-    0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B,
-    0xFD, 0x54, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x06, 0xFC, 0x00,
-    0x00, 0xBE, 0x00, 0x25, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0x50, 0x00, 0x54, 0x00,
-    0xFE, 0x01, 0xFD, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x50, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x28, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xD5, 0x40,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x14, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xAF, 0xFE, 0xA0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x54, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFF, 0x45, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0x00, 0x02, 0xFF, 0xFB, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x0B, 0xC1, 0xFF, 0x80, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0x40, 0x7F, 0xFE, 0xBD, 0x03,
-    0xFF, 0xFF, 0xF0, 0x0F, 0x02, 0xFF, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xEF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xFF, 0x96, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFD, 0xFF, 0x0B, 0xFF, 0xC2, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00,
-    0x0F, 0x40, 0x0F, 0x80, 0x00, 0xFF, 0xEF, 0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03,
-    0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0,
-    0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x40,
-    0x01, 0x40, 0x2F, 0x00, 0x2F, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF,
-    0xF0, 0xBF, 0xFC, 0x2F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0x00, 0x02,
-    0xFB, 0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7,
-    0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x3C, 0x1F, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xEF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFE, 0xFF, 0x96, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0xFF, 0x0B, 0xFF,
-    0xC2, 0xFC, 0x00, 0x40, 0x00, 0x00, 0x00, 0x15, 0x41, 0x54, 0x00, 0x07, 0xFC, 0xBF, 0x80, 0x00,
-    0xFF, 0x1F, 0xE0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x00, 0x14, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC,
-    0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x15, 0x40, 0x0F, 0xF8, 0xFF,
-    0x00, 0x7F, 0x8F, 0xF4, 0x03, 0xF4, 0x7F, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x50, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xEF, 0xF9, 0x6F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xDF, 0xF0, 0xBF, 0xFC, 0x2F, 0xC0,
-    0x04, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F,
-    0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC2,
-    0xFF, 0xE5, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0xFF, 0x40, 0x0B, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xBF, 0xE5,
-    0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF, 0xF0, 0xBF, 0x00, 0x10, 0x07,
-    0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x6E, 0x40, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00,
-    0x03, 0xFC, 0xBF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0xBF,
-    0x83, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x2F,
-    0xE0, 0x07, 0xFF, 0xE0, 0x07, 0xFC, 0x07, 0xFC, 0x02, 0xFE, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x00,
-    0xFE, 0xBF, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0x5F, 0xD0, 0x3F, 0xC0, 0x0B, 0xF8, 0x1F, 0xD3,
-    0xF8, 0x1F, 0xF0, 0x01, 0xFF, 0x0B, 0xF0, 0xFF, 0x0B, 0xF8, 0x00, 0x3F, 0xC3, 0xFC, 0x2F, 0xC3,
-    0xFD, 0x00, 0x0F, 0xF0, 0xFE, 0x07, 0xF4, 0xFF, 0x00, 0x02, 0xFD, 0x7F, 0x40, 0xFE, 0x3F, 0xC0,
-    0x00, 0x7F, 0xAF, 0xC0, 0x3F, 0xDF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x0B, 0xFB, 0xF4, 0x00, 0x03,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x3F, 0xF0, 0x02, 0xFD, 0x7F, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0x4F, 0xF0, 0x0B, 0xFF, 0x80,
-    0x3F, 0xC2, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xE0, 0x7F, 0xC0, 0xFD, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x7F, 0x3F, 0x03, 0xFC, 0x03, 0xFD, 0x2F, 0x8F, 0xD1, 0xFF, 0x00, 0xBF, 0x8F, 0xD2, 0xF8, 0xBF,
-    0x80, 0x1F, 0xF3, 0xF0, 0x7F, 0x3F, 0xD0, 0x03, 0xFC, 0xFC, 0x0F, 0xCF, 0xF0, 0x00, 0xFF, 0x7F,
-    0x03, 0xF7, 0xF8, 0x00, 0x1F, 0xEF, 0x80, 0xBE, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD,
-    0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x50, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4,
-    0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01,
-    0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x03, 0xFC, 0x2F,
-    0xC0, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x3F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0xFF,
-    0x40, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x0B, 0xFE, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x55, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD0, 0x01, 0x50, 0x00, 0x54, 0x00, 0xFE, 0x01,
-    0xFE, 0x00, 0x0F, 0xF2, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x05, 0x00, 0x01, 0x40, 0xFE, 0x01, 0xFD, 0x07, 0xF8, 0xBF, 0x40, 0x1F, 0xFF, 0xD0, 0x00, 0xBF,
-    0xF8, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0B,
-    0xFC, 0x00, 0x01, 0xFF, 0x95, 0x54, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x14, 0x00, 0xBF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFC, 0xBF, 0xD0, 0x4B, 0xF8, 0x00,
-    0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF,
-    0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80,
-    0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF0, 0x0F,
-    0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F,
-    0xD0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xE6,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE, 0x03, 0xFC, 0x03,
-    0xFF, 0xFF, 0xDF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF, 0x80, 0x3F, 0xE0,
-    0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE,
-    0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1B, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0x4B, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xC0, 0xFF, 0xD0, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF8, 0x00, 0x0F,
-    0xFC, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFE,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xD7, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFD, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xD3, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xD3,
-    0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFD, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0xFF,
-    0xD0, 0x02, 0xFF, 0xC0, 0x03, 0xFD, 0x0B, 0xFF, 0xEA, 0xFF, 0xF4, 0x00, 0x3F, 0xD0, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x02, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xF9, 0x7F, 0xFE, 0x5B, 0xFE, 0x3F, 0xD0, 0x0F, 0xF8, 0x03, 0xFF,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x02, 0xFF, 0xBF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0xBF, 0xC0, 0x07, 0xFC,
-    0x01, 0xFF, 0xBF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0xBF, 0xC0, 0x07, 0xFC, 0x01, 0xFF, 0x7F, 0xC0,
-    0x0B, 0xFC, 0x01, 0xFF, 0x3F, 0xD0, 0x0F, 0xF8, 0x01, 0xFF, 0x3F, 0xF4, 0x7F, 0xF0, 0x01, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0xBF, 0xFD, 0x00,
-    0x01, 0xFF, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x06, 0xFF, 0xFF, 0xFA,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0x0F, 0xF8, 0x07, 0xFF, 0x3F, 0xC3, 0xFE, 0x00, 0x7F, 0xD6, 0xA0, 0xFF, 0x80, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0x03, 0xFE, 0x06, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xA9, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF, 0xD4, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x8B, 0xFE, 0x00, 0xBF, 0xBF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xF0, 0xBF, 0xF9, 0x7F, 0xF4, 0xBF, 0xD0, 0x0F, 0xFC, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF,
-    0xC0, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF,
-    0xC0, 0x0B, 0xFC, 0xBF, 0xD0, 0x0F, 0xFC, 0xBF, 0xF9, 0x7F, 0xF4, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xD0, 0xBF, 0x8B, 0xFF, 0x00, 0xBF, 0x80, 0x50, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xEA, 0xFF, 0xF0, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xC1, 0xFF, 0x40, 0x07,
-    0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x07, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x1F, 0xFA, 0xFF,
-    0xE0, 0x90, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0xBF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00,
-    0xBF, 0xE0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x06, 0x7F, 0xF9,
-    0xAF, 0xF3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x1E, 0x41, 0xFF,
-    0x40, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xF0, 0x02, 0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8,
-    0x07, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF0, 0x06, 0xC7, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFC, 0x07, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x0F, 0x8B, 0xF8, 0x00, 0x3E, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-    0x6B, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0xEA, 0x80, 0x03, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x55, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x55, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x16, 0xFE, 0x00, 0x2F,
-    0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xE0, 0x2F,
-    0xF0, 0x00, 0xBE, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFC, 0x03, 0xFE, 0x54, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFE, 0x1B, 0xFD, 0x55, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFF, 0x55, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0x40, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x60, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC7, 0xF8, 0x00, 0x02, 0xFD, 0x2F, 0xF2, 0xFF, 0x00, 0x00, 0xFF, 0x8F, 0xF4, 0xBF, 0xC0,
-    0x00, 0x3F, 0xEB, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xF8,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
-    0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF9, 0x6F, 0xFE,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0xBF, 0x8F,
-    0xF4, 0xFF, 0x40, 0x0B, 0xFE, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF,
-    0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B,
-    0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x5B,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x0B, 0xFF,
-    0x82, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0x80,
-    0x0B, 0xF8, 0x00, 0x7F, 0x40, 0x01, 0x50, 0x00, 0x55, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x7F, 0x80,
-    0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x2F, 0xDB,
-    0xF4, 0xBF, 0x01, 0xFD, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0x3F, 0xFF, 0xBE,
-    0x7F, 0xFF, 0xFD, 0xB8, 0x1F, 0xF4, 0x50, 0x00, 0x40, 0x6A, 0xAA, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0x55, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0x55, 0x55,
-    0x54, 0x14, 0x00, 0x15, 0x3E, 0x00, 0x3E, 0x3F, 0xFB, 0xFD, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x00, 0x14, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0xD7, 0xFD, 0x2F, 0x80, 0x00, 0x2F, 0x01, 0xF4, 0x3F,
-    0xC3, 0xFC, 0x3F, 0x83, 0xFC, 0x1F, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xFC, 0x12, 0xFC,
-    0x00, 0xFC, 0x0B, 0xF8, 0x0F, 0xD0, 0x06, 0x80, 0x05, 0x40, 0x3F, 0xF4, 0xBE, 0xFC, 0xF4, 0x3D,
-    0xF4, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x01, 0x54, 0x15, 0x40, 0x7F, 0xCB, 0xF8, 0x0F,
-    0xF1, 0xFE, 0x02, 0xFC, 0x3F, 0x80, 0x7E, 0x0B, 0xD0, 0x01, 0x40, 0x50, 0x00, 0x54, 0x00, 0x15,
-    0x1F, 0xD0, 0x2F, 0xC2, 0xFD, 0x3F, 0xC0, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x15, 0x50,
-    0x00, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0x54, 0x15, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC,
-    0x3F, 0xA8, 0x2A, 0x15, 0x05, 0x50, 0x0F, 0xF2, 0xFE, 0x01, 0xFD, 0x2F, 0xC0, 0x1F, 0xC2, 0xF8,
-    0x01, 0xF8, 0x2F, 0x40, 0x05, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0x14, 0xFE, 0x14,
-    0x3D, 0x28, 0x7C, 0x2F, 0x41, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x14, 0x00, 0x00,
-    0x55, 0x00, 0x07, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F, 0xAA, 0xFC, 0x7C, 0x00, 0x3D, 0x14, 0x00,
-    0x14, 0x07, 0xE0, 0xFE, 0x1F, 0xD2, 0xFC, 0x3F, 0xC7, 0xF8, 0xBF, 0x81, 0x50, 0x1F, 0xE2, 0xFE,
-    0x3F, 0xC3, 0xFC, 0x3F, 0x47, 0xF0, 0xBE, 0x01, 0x40, 0xBF, 0x4B, 0xF8, 0x3F, 0xC3, 0xFC, 0x1F,
-    0xC0, 0xFD, 0x0B, 0xE0, 0x14, 0x1F, 0xE2, 0xFE, 0x3F, 0xC3, 0xFC, 0x3F, 0x47, 0xF0, 0xBE, 0x01,
-    0x40, 0x15, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0x7F, 0x00, 0x01, 0x40, 0x00,
-    0x55, 0x40, 0x1F, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x2F, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x1E, 0x16, 0xEB, 0xFE, 0x56, 0xE0, 0x1E, 0x00, 0x40, 0x00, 0x0B, 0x40, 0xB9, 0x4B, 0xFE, 0xB9,
-    0x5B, 0x40, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x6A, 0xAE, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
-    0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x0B, 0xF8, 0x7F, 0xF0, 0xBF, 0xD0,
-    0xBE, 0x00, 0x00, 0x00, 0x05, 0x3F, 0xBD, 0xF4, 0xB8, 0x7F, 0x1E, 0x02, 0x80, 0x03, 0xC0, 0x03,
-    0xC0, 0x2B, 0xE8, 0x3F, 0xFC, 0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x03, 0xC0, 0x03, 0xC0, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x2B, 0xE8, 0x03, 0xC0, 0x02,
-    0x80, 0x2A, 0xA8, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xA8, 0x0B, 0xF0, 0x2F, 0xC0, 0xBF, 0x02, 0xFC,
-    0x1F, 0xF7, 0xFF, 0x9F, 0xFC, 0x7F, 0x80, 0xA9, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03,
-    0xFD, 0x0B, 0xFF, 0x4F, 0xFD, 0x1F, 0xF4, 0x00, 0x02, 0xFC, 0x3F, 0xD3, 0xFD, 0x2F, 0xC0, 0x00,
-    0x2F, 0x01, 0xF4, 0x3F, 0xC3, 0xFC, 0x3F, 0x83, 0xFC, 0x1F, 0x01, 0xF4, 0x05, 0x40, 0x3F, 0xF4,
-    0xBE, 0xFC, 0xF4, 0x3D, 0xF4, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x00, 0x02, 0xFD, 0x3F,
-    0xC3, 0xF4, 0x3F, 0x01, 0x40, 0x07, 0xC0, 0x0F, 0xE0, 0x06, 0xFC, 0x00, 0xFD, 0x16, 0xFC, 0x7F,
-    0xFC, 0x3F, 0xE0, 0x01, 0x00, 0xF8, 0x3E, 0x0B, 0xC0, 0xFD, 0x0F, 0xFF, 0x7F, 0xF0, 0xBA, 0x14,
-    0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0x3C, 0x38, 0x00,
-    0x2C, 0x38, 0x00, 0x2C, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x70, 0x3C, 0x0D, 0x39, 0xBE, 0x7C,
-    0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x05, 0x1F, 0xD0, 0x2F, 0xC1, 0xFE, 0x3F, 0xC0,
-    0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x00, 0x00, 0x55, 0x00, 0x03, 0xFF, 0x80,
-    0x0B, 0xFF, 0xE0, 0x2F, 0xDB, 0xF4, 0x7F, 0x01, 0xFD, 0x54, 0x00, 0x15, 0x14, 0x00, 0x15, 0x7D,
-    0x00, 0x7D, 0x3F, 0xEB, 0xFC, 0x1F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x55,
-    0x00, 0x07, 0xFF, 0xE0, 0x2F, 0xFF, 0xF8, 0x3F, 0xAA, 0xFC, 0x7C, 0x00, 0x3D, 0x14, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1F, 0x3F, 0xFE, 0xBE, 0xBF, 0xFF, 0xFC, 0xF8, 0x1F, 0xF4, 0x50,
-    0x01, 0x40, 0x6A, 0xAA, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xA0, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA,
-    0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x03, 0xC3, 0xFF, 0xFB, 0xF1, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xF8, 0x04, 0x00,
-    0x10, 0x00, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x54,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE6, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0xF8, 0x00,
-    0x2F, 0xFC, 0x01, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x50, 0xFC, 0x7E, 0x1F, 0x2E, 0xFD, 0xB4,
-    0x24, 0x00, 0x18, 0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x3D, 0x55, 0x7C, 0x3F, 0xFF, 0xFC, 0x15,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xB5, 0x55, 0x5E, 0xB0, 0x00, 0x0E, 0xB0, 0x00,
-    0x0E, 0xBF, 0xFF, 0xFE, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x39, 0x7E, 0x6C,
-    0x70, 0x3C, 0x0D, 0x00, 0x00, 0x00, 0x10, 0x4B, 0x5E, 0x3F, 0xC2, 0xF4, 0x7F, 0xDB, 0x0E, 0x00,
-    0x00, 0x00, 0x2F, 0xB8, 0xF4, 0x7C, 0x2D, 0x0F, 0x6E, 0xF8, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF,
-    0xFF, 0xDA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA,
-    0xAA, 0xA0, 0x15, 0x40, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x01, 0x50,
-    0x00, 0x55, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x7F, 0x80, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0x07, 0xC3, 0xFF, 0xFB, 0xF1, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xF4, 0x14, 0x00,
-    0x10, 0x00, 0x6A, 0x0B, 0xFC, 0x6F, 0xC0, 0xFC, 0x1F, 0x40, 0x40, 0x00, 0x02, 0xA9, 0x00, 0x07,
-    0xD1, 0xFF, 0x5F, 0x43, 0xFC, 0xBF, 0x8F, 0xF0, 0xFF, 0x3F, 0xC3, 0xFC, 0x1F, 0x4F, 0xD0, 0x7D,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x15, 0x00, 0xFD, 0x03, 0xF4, 0x0F, 0xF8, 0x3F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00, 0x2D, 0x78, 0x00,
-    0x02, 0xD6, 0x40, 0x00, 0x19, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xDA, 0xAA, 0xAA, 0xA0, 0x54, 0x15, 0xFC, 0x3F,
-    0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xA8, 0x2A, 0x15, 0x4B, 0xFE, 0x6A, 0xE0, 0x0E, 0x00, 0xE0,
-    0x0E, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x04, 0x1F, 0xFD, 0x3C, 0x3F, 0xFF, 0xFC, 0x38, 0xBF, 0xF0,
-    0x10, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7D, 0x00, 0x0B, 0xD0, 0x3C, 0x2F, 0xFE, 0xBC, 0x3F, 0xFF, 0xF8, 0x78, 0x1B, 0xF0, 0x00, 0x28,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x3C,
-    0x2F, 0xFF, 0xF8, 0x3C, 0x2F, 0xF0, 0x10, 0x00, 0x00, 0x0B, 0xE4, 0x3C, 0x1F, 0xFF, 0xF8, 0x3D,
-    0x2F, 0xF0, 0x14, 0x01, 0x40, 0x00, 0x41, 0x00, 0x07, 0x82, 0xD0, 0x2F, 0xFF, 0xF8, 0x0F, 0xEB,
-    0xF0, 0x02, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x82, 0xF8, 0x0F, 0x00, 0xF0,
-    0x0F, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90, 0x00, 0x84,
-    0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x60, 0x60,
-    0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30, 0xD7, 0x04,
-    0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34, 0x00, 0x87,
-    0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8, 0x02, 0xAD,
-    0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x06, 0x40, 0x3F, 0x40, 0xBD, 0x1F, 0xD7, 0xE0, 0x50,
-    0x00, 0x01, 0x0B, 0xC7, 0xF2, 0xF0, 0x7C, 0x0F, 0xC1, 0xF0, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xF0, 0x1F, 0xEB, 0xF8, 0x3E, 0x00, 0xBC, 0x3C, 0x7E, 0x3C, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x03, 0x08, 0x7F, 0xD2, 0xF8, 0x3F, 0xC7, 0x9D, 0x00, 0x40, 0x00, 0x90,
-    0xBD, 0x7E, 0x07, 0xE0, 0x1F, 0xC0, 0x19, 0x60, 0x07, 0xE0, 0x0B, 0xD0, 0xBD, 0x7F, 0x46, 0x00,
-    0x60, 0x00, 0x50, 0x7E, 0x02, 0xF0, 0x0B, 0xD3, 0xF4, 0x0B, 0xD7, 0x7C, 0x3F, 0x4B, 0x2C, 0x60,
-    0x0E, 0x0E, 0x10, 0x1F, 0x07, 0xF0, 0x7C, 0x1F, 0x1F, 0x87, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x3F,
-    0xE3, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xC0, 0x17, 0xD4, 0x3F, 0xFC, 0x0B, 0xE0, 0x0F, 0xF0, 0x09,
-    0x60, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x79, 0xBE, 0x6D, 0xB0, 0x3C, 0x0E, 0xB0, 0x3C, 0x0E,
-    0x3D, 0xBE, 0x7C, 0x1F, 0xD7, 0xF4, 0x38, 0x03, 0x40, 0x7F, 0xE6, 0xAD, 0x01, 0xC0, 0x18, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x6F,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xBF,
-    0xFE, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F,
-    0xFD, 0x00, 0x00, 0x6F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x06, 0xBF, 0xFE, 0x80, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x40, 0x00, 0x3D, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xAA, 0xFC, 0x3F, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7C, 0x00, 0x05, 0xBF, 0xFF,
-    0xD0, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xA5, 0x5A, 0xFF, 0xE0, 0x1F,
-    0xE4, 0x00, 0x00, 0x1B, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x55, 0x55, 0x55,
-    0x55, 0x57, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x90, 0x0F, 0xFC, 0x00,
-    0x2D, 0x1F, 0xFD, 0x3C, 0x2D, 0x3D, 0x7D, 0x1F, 0xDD, 0x00, 0x00, 0x06, 0x41, 0xFB, 0xCF, 0x07,
-    0xBF, 0xFE, 0xF0, 0x02, 0xE5, 0x82, 0xFF, 0x00, 0x00, 0xB1, 0x85, 0x2D, 0xB6, 0xDB, 0x6D, 0xB4,
-    0x01, 0x90, 0x1F, 0xFC, 0x3C, 0x2E, 0x3C, 0x1E, 0x3C, 0x1E, 0x2E, 0x7D, 0x0B, 0xF4, 0x00, 0x00,
-    0x14, 0x05, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x2E, 0x3E, 0x7E, 0x1F, 0xDE, 0x00, 0x00,
-    0x06, 0x90, 0xBF, 0xC7, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0xF9, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x1D,
-    0x00, 0x2E, 0x06, 0x6E, 0x2F, 0xFE, 0x3C, 0x2E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3E, 0x7E, 0x0F, 0xDD,
-    0x00, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x18, 0x3F, 0xFD, 0xF4, 0xBB, 0xC1, 0xEF, 0x07, 0xBC, 0x1E,
-    0xF0, 0x78, 0x11, 0xA0, 0x64, 0x3F, 0xFF, 0xFD, 0x3C, 0x3E, 0x1E, 0x3C, 0x2D, 0x0F, 0x3C, 0x2D,
-    0x0F, 0x3C, 0x2D, 0x0F, 0x3C, 0x2D, 0x0E, 0x51, 0x8B, 0xBC, 0xBC, 0x0B, 0x40, 0xB4, 0x0B, 0x40,
-    0xB4, 0x00, 0x0A, 0x01, 0xF5, 0x3F, 0xE1, 0xE0, 0x1E, 0x01, 0xE0, 0x0F, 0x50, 0xBE, 0x00, 0x00,
-    0x14, 0x05, 0x0F, 0x07, 0x82, 0xD2, 0xC0, 0x38, 0xF0, 0x0F, 0xB4, 0x01, 0xFC, 0x00, 0x3D, 0x00,
-    0x14, 0x15, 0x2D, 0x3C, 0x0F, 0xF4, 0x07, 0xE0, 0x0B, 0xF0, 0x1E, 0x7C, 0x3C, 0x2E, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xAA,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00,
-    0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xFF, 0xE9,
-    0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xEA, 0xBF, 0xFC, 0xBF, 0xC0, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0xD5, 0xBF,
-    0xF4, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x90, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xC0, 0x0B,
-    0xFD, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFF, 0xBF, 0xC0, 0x07,
-    0xFE, 0xBF, 0xEA, 0xBF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0,
-    0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x00, 0x7F,
-    0xC7, 0xFC, 0x00, 0x00, 0xBF, 0x83, 0xFC, 0x00, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x01,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x07, 0xFC, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x2F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xFA, 0xAA, 0xAF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x1F, 0xFA, 0xAA, 0x97, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02,
-    0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC,
-    0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xEA, 0xAA, 0xBF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0,
-    0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE,
-    0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE7, 0xFC, 0x00,
-    0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF,
-    0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x55, 0x54, 0x7F, 0xD7, 0xFD, 0x3F, 0xFF, 0x1F,
-    0xF5, 0xFF, 0x4F, 0xFF, 0xC7, 0xFD, 0x7F, 0xD3, 0xFF, 0xF1, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE,
-    0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0F,
-    0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x7F, 0xC0, 0x00, 0xBF, 0xC7, 0xFC,
-    0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x07, 0xFD, 0x07, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xF0,
-    0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC2, 0xFF, 0x40, 0x07, 0xFC, 0x7F, 0xE0, 0x00, 0x7F, 0xCF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFB, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0xBF, 0xD0, 0x07, 0xFC, 0x03,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x07,
-    0xFC, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xDF,
-    0xF0, 0x00, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x00, 0xBF, 0x83, 0xFC,
-    0x00, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x02, 0xFF, 0x01, 0xFF, 0x00,
-    0x03, 0xFE, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF8, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00,
-    0x07, 0xFD, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF7, 0xFF, 0xD0,
-    0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x7F, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0xFE,
-    0xFD, 0x00, 0x0F, 0xEF, 0xF7, 0xF7, 0xF8, 0x00, 0x3F, 0x7F, 0xDF, 0xDB, 0xF0, 0x02, 0xFC, 0xFF,
-    0x7F, 0x5F, 0xC0, 0x0F, 0xE3, 0xFD, 0xFE, 0x3F, 0x80, 0x3F, 0x4F, 0xF7, 0xF8, 0xFF, 0x02, 0xFC,
-    0x3F, 0xDF, 0xE1, 0xFC, 0x0F, 0xE0, 0xFF, 0x7F, 0x83, 0xF4, 0x3F, 0x43, 0xFD, 0xFE, 0x0F, 0xF1,
-    0xFC, 0x0F, 0xF7, 0xF8, 0x2F, 0xCF, 0xE0, 0x3F, 0xDF, 0xE0, 0x7F, 0xBF, 0x40, 0xFF, 0x7F, 0x80,
-    0xFF, 0xFC, 0x03, 0xFD, 0xFE, 0x02, 0xFF, 0xE0, 0x0F, 0xF7, 0xF8, 0x07, 0xFF, 0x40, 0x3F, 0xDF,
-    0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0x7F, 0x80, 0x2F, 0xE0, 0x03, 0xFC, 0x7F, 0xF4, 0x00, 0x02, 0xFC,
-    0x7F, 0xFC, 0x00, 0x03, 0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x00, 0x03, 0xFC, 0x7F,
-    0xFF, 0x80, 0x03, 0xFC, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x7F, 0x7F, 0xF0, 0x03, 0xFC, 0x7F, 0x5F,
-    0xF4, 0x03, 0xFC, 0x7F, 0x4B, 0xFC, 0x03, 0xFC, 0x7F, 0x83, 0xFE, 0x03, 0xFC, 0x7F, 0x82, 0xFF,
-    0x03, 0xFC, 0x7F, 0x80, 0xFF, 0xC3, 0xFC, 0x7F, 0x80, 0x7F, 0xD3, 0xFC, 0x7F, 0x80, 0x3F, 0xF3,
-    0xFC, 0x7F, 0x80, 0x1F, 0xF6, 0xFC, 0x7F, 0x80, 0x0B, 0xFF, 0xFC, 0x7F, 0x80, 0x03, 0xFF, 0xFC,
-    0x7F, 0x80, 0x02, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0xFC, 0x7F, 0x80, 0x00, 0x7F, 0xFC, 0x7F,
-    0x80, 0x00, 0x3F, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xA0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00,
-    0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07,
-    0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F,
-    0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD,
-    0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00,
-    0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x7F, 0xFF, 0xE4, 0x02, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x2F, 0xFA, 0xFF, 0x00, 0x3F, 0xFB, 0xFC, 0x00, 0xBF, 0xEF, 0xF0, 0x02, 0xFF, 0xBF, 0xC0,
-    0x0F, 0xFA, 0xFF, 0x01, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xAA, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFB, 0xFF, 0xF8,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B,
-    0xFC, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00,
-    0x2F, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFA, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFB, 0xFF, 0xBF, 0xFE, 0x03, 0xFF, 0x40, 0xFF,
-    0x41, 0xFF, 0xC1, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x2F,
-    0xE0, 0x03, 0xFD, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF2, 0xFF, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x7F, 0xC0, 0x0F, 0xF4, 0x03, 0xFE, 0x0F, 0xFC, 0x03, 0xFD, 0x01, 0xFF, 0x42, 0xFF,
-    0xD0, 0xFF, 0x46, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0,
-    0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x00,
-    0x7F, 0xDF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x01, 0xFF, 0x43, 0xFE,
-    0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0x80, 0x3F, 0x80, 0x3F, 0xCB,
-    0xF8, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC,
-    0xBF, 0x80, 0x3F, 0xC0, 0x3F, 0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0x80, 0x3F, 0xC0, 0x3F,
-    0xCB, 0xF8, 0x03, 0xFC, 0x03, 0xFC, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xC7, 0xFC, 0x03, 0xFC, 0x03,
-    0xFC, 0x3F, 0xD0, 0x3F, 0xC0, 0xBF, 0x82, 0xFF, 0x43, 0xFC, 0x2F, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6B, 0xFE,
-    0x90, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xE0, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC3,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFC,
-    0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x01, 0xFF,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xF8, 0x02, 0xFF,
-    0x00, 0x2A, 0xBF, 0xD0, 0x7F, 0xEA, 0x83, 0xFF, 0xFD, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xC3, 0xFF, 0xFD, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x1F, 0xD0,
-    0x0B, 0xFF, 0xFA, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0x6F, 0xFD, 0x03, 0xFE, 0x00,
-    0xBF, 0xD0, 0x7F, 0xC0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x0B,
-    0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x07,
-    0xFD, 0x03, 0xFF, 0x81, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0x8F, 0xFD, 0x01,
-    0xFF, 0xD0, 0x7F, 0xD0, 0x00, 0x40, 0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0xBF, 0xC0, 0x3F, 0xF0,
-    0xFF, 0x80, 0x2F, 0xF0, 0xFF, 0x80, 0x2F, 0xE0, 0xFF, 0x80, 0x3F, 0xD0, 0xFF, 0x80, 0xBF, 0x80,
-    0xFF, 0x8F, 0xFE, 0x00, 0xFF, 0x8F, 0xF9, 0x00, 0xFF, 0x8F, 0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0xF0,
-    0xFF, 0x80, 0x0F, 0xF8, 0xFF, 0x80, 0x0B, 0xFC, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x80, 0x0B, 0xFC,
-    0xFF, 0x80, 0x0F, 0xFC, 0xFF, 0xE4, 0x7F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x81, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x03, 0xFD,
-    0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x0B, 0xF8,
-    0x03, 0xFC, 0x0F, 0xF4, 0x02, 0xFD, 0x1F, 0xF0, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0xFF, 0x7F, 0xC0,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xF4, 0x0B, 0xFC, 0x02, 0xF0,
-    0x0B, 0xF8, 0x00, 0x10, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0xBF, 0xF0, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x7F, 0xC0, 0x0B, 0xFC, 0xFF, 0x80, 0x03, 0xFD, 0xFF, 0x40, 0x03, 0xFD, 0xFF, 0x40, 0x03, 0xFD,
-    0xFF, 0x80, 0x03, 0xFD, 0xBF, 0xC0, 0x0B, 0xFC, 0x7F, 0xF4, 0x6F, 0xFC, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0x1B, 0x0F, 0xF0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0xFA, 0x80, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x07, 0xFE, 0x55, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x01, 0xDB, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFD,
-    0x07, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xC0, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x2F, 0xFD, 0x0F, 0xF3, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9, 0x7F, 0xF7,
-    0xFF, 0x40, 0x3F, 0xEF, 0xFC, 0x00, 0xFF, 0xBF, 0xE0, 0x02, 0xFE, 0xFF, 0x80, 0x0B, 0xFB, 0xFE,
-    0x00, 0x2F, 0xEF, 0xF8, 0x00, 0xBF, 0xBF, 0xE0, 0x02, 0xFE, 0xFF, 0x80, 0x0B, 0xFB, 0xFE, 0x00,
-    0x2F, 0xEF, 0xF8, 0x00, 0xBF, 0xBF, 0xE0, 0x02, 0xFE, 0xFF, 0x80, 0x0B, 0xF8, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xF4, 0x1F, 0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x3F,
-    0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFD, 0xBF, 0xC0, 0x03, 0xFD, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xD5, 0x57, 0xFE, 0x7F,
-    0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xFC, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x0B, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFF, 0x00, 0xBF, 0xE1, 0x4F, 0xFF, 0xF2, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x14, 0x00, 0xBF, 0x80,
-    0x07, 0xFD, 0x2F, 0xE0, 0x03, 0xFD, 0x0B, 0xF8, 0x03, 0xFE, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0xBF,
-    0x82, 0xFF, 0x00, 0x2F, 0xE2, 0xFF, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF0, 0x02, 0xFE, 0x03, 0xFE,
-    0x00, 0xBF, 0x80, 0x7F, 0xD0, 0x2F, 0xE0, 0x0B, 0xFC, 0x0B, 0xF8, 0x00, 0xFF, 0xC2, 0xFE, 0x00,
-    0x1F, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0xBF, 0x7F, 0xD0, 0x00, 0x3F, 0xC7,
-    0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x0B, 0xF8, 0x3F, 0xE0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xF5, 0x3F, 0xD0, 0x07, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x40, 0x0B, 0xF8, 0x3F, 0xE0, 0x02, 0xFF,
-    0x0F, 0xF8, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xE0, 0x02,
-    0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xE0,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0xF5, 0xBF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFE, 0xFF, 0x43, 0xFF, 0xFF, 0x41, 0x00, 0x04,
-    0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFD, 0x7F, 0xC0,
-    0x03, 0xFE, 0x3F, 0xC0, 0x03, 0xFD, 0x3F, 0xE0, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF0,
-    0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x0B, 0xF8, 0x03, 0xFC, 0x0F, 0xF4, 0x02, 0xFD,
-    0x1F, 0xF0, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0xFF, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0x90, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0xE4, 0x00,
-    0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE,
-    0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x57, 0xFE, 0x55, 0xFF, 0x95, 0x00, 0xFF, 0x40,
-    0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x03,
-    0xFE, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xF5, 0x40, 0x3F, 0xD0, 0x0B,
-    0xFF, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0xF8, 0x03, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xF8, 0x2F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFD, 0x3F, 0xC0,
-    0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x7F, 0xC0,
-    0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xF4, 0x1F, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xDF, 0xFF, 0x40, 0x7F, 0xC0, 0x50, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4,
-    0x2F, 0xF9, 0x5B, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x6F,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xF5, 0x7F, 0x95, 0x3F, 0xE0, 0x0B, 0xF4, 0x1F, 0xF0, 0x01, 0xFF, 0x0B, 0xFC, 0x00, 0x3F,
-    0xC2, 0xFF, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0xFF, 0x47, 0xFC, 0x00,
-    0x7F, 0xC0, 0xFF, 0x40, 0x2F, 0xF0, 0x2F, 0xF8, 0x6F, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x85, 0x6F, 0xF5, 0x54, 0x00, 0x7F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x50, 0x00, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0xFF, 0x40, 0x1F, 0xF3,
-    0xFE, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0xFF, 0x7F, 0xE0, 0x03, 0xFE, 0xFF, 0x80, 0x0B, 0xFB, 0xFE,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00,
-    0x2F, 0xEB, 0xF8, 0x00, 0xFF, 0xAF, 0xF0, 0x07, 0xFD, 0x7F, 0xE4, 0x7F, 0xF0, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x1F, 0xFE, 0x7F, 0xDB, 0xFF, 0x03, 0xFF, 0x03, 0xFC, 0x1F, 0xF8, 0x7F, 0xD0,
-    0x3F, 0xC0, 0xBF, 0xCB, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0xBF, 0xC0, 0x3F, 0xC0, 0x3F, 0xDB, 0xFC,
-    0x03, 0xFC, 0x03, 0xFD, 0xBF, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0x03, 0xFC, 0x0B, 0xFC, 0x3F,
-    0xF0, 0x3F, 0xC0, 0xFF, 0x81, 0xFF, 0xD3, 0xFC, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0x00, 0x03, 0xFD, 0x3F,
-    0xFF, 0x00, 0x1F, 0xF0, 0xAB, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x00, 0x2F, 0xF1, 0xFE, 0x00, 0x00, 0x3F, 0xDF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x02, 0xFD, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0xFF, 0x80, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x0B, 0xF8, 0x03, 0xFF, 0xA0, 0x3F, 0xC0, 0x07, 0xFF, 0xD2, 0xFE, 0x00, 0x0B, 0xFF, 0x5F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xFC,
-    0x0F, 0xF4, 0xFF, 0x40, 0xFF, 0x02, 0xFE, 0x3F, 0xD0, 0x3F, 0xC0, 0x7F, 0xCF, 0xF4, 0x0F, 0xF0,
-    0x0F, 0xF3, 0xFD, 0x03, 0xFC, 0x03, 0xFD, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0x7F, 0xD0, 0x3F, 0xC0,
-    0x3F, 0xDF, 0xF4, 0x0F, 0xF0, 0x0F, 0xF7, 0xFD, 0x03, 0xFC, 0x03, 0xFD, 0xFF, 0x40, 0xFF, 0x00,
-    0xFF, 0x7F, 0xE0, 0x3F, 0xC0, 0x7F, 0xCB, 0xFC, 0x0F, 0xF0, 0x3F, 0xF0, 0xFF, 0xE7, 0xFD, 0xBF,
-    0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x2F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x7F, 0x80, 0x2F, 0xD7, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0x9F, 0xE0,
-    0x07, 0xF8, 0x01, 0xFE, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF9, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xE3,
-    0xFC, 0x01, 0xFE, 0x00, 0xBF, 0x4F, 0xF0, 0x0B, 0xFC, 0x03, 0xFD, 0x2F, 0xF4, 0x7F, 0xF8, 0x2F,
-    0xF0, 0x3F, 0xFF, 0xF7, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xCB, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x0B,
-    0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB,
-    0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F,
-    0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F,
-    0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F,
-    0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF,
-    0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x02,
-    0xFE, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x00, 0x2F,
-    0xE0, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x02, 0xFF,
-    0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x04,
-    0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC,
-    0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80,
-    0x1F, 0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83,
-    0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0x6A, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03,
-    0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF,
-    0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00,
-    0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0xF4, 0xBD, 0x00, 0x0B, 0xFF, 0xDA, 0x00,
-    0x01, 0xFC, 0xBF, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x39, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xAF, 0xF4, 0x0B, 0xFD, 0x00, 0xFF, 0x40, 0xFF,
-    0xC0, 0x0F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0x40, 0xBF, 0xD0, 0x7F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF7, 0xF4, 0x00, 0xBF, 0xF8, 0x3F, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0xF8, 0x00, 0x00, 0x06,
-    0x8F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x7F, 0x00, 0x00, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x01, 0xFF,
-    0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xF4, 0x00,
-    0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0x40, 0x00,
-    0x0F, 0xF8, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x3F, 0xF4, 0x00, 0x06, 0x6F, 0xFF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xE4, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x6F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFA, 0xFF,
-    0x42, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0xC0, 0x0F, 0xF4, 0x3F, 0xE0, 0x07, 0xFD, 0x0B, 0xFD, 0x07,
-    0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF7, 0xF4, 0x02, 0xFF, 0xE0, 0xFD, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0x87, 0xD0, 0x00, 0x00, 0xFF,
-    0xF5, 0xD0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x00, 0x28, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF,
-    0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF,
-    0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF,
-    0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF,
-    0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF,
-    0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x6F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3F, 0xF4, 0xF8, 0x00, 0xBF, 0xFC, 0x60, 0x01, 0xFC,
-    0xBF, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0x90, 0x2F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x6F, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xAF, 0xF4, 0xBF, 0xD0, 0x0F, 0xF4, 0xFF, 0xC0, 0x0F, 0xF4, 0xFF, 0x80, 0x1F, 0xF4, 0xBF, 0xD0,
-    0x7F, 0xF4, 0x7F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xF7, 0xF4, 0x0B, 0xFF, 0x83, 0xF4, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0xEB, 0xC0, 0x00, 0x00, 0xF5, 0xFF,
-    0xD0, 0x00, 0x00, 0x24, 0x06, 0x90, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0x42, 0xF8, 0x00, 0x00, 0x09, 0x00, 0x06,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40,
-    0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x40,
-    0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40,
-    0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0x80, 0xF0, 0x03, 0xFF, 0xEF, 0x80, 0x1E, 0x1F, 0xFC,
-    0x00, 0x10, 0x01, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xF7, 0xF8, 0x00,
-    0x7E, 0x02, 0xF4, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4, 0x03, 0xFD,
-    0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x7F, 0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xE7, 0xF4, 0x2F, 0xFE, 0x0F, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x9F, 0xE0, 0x00,
-    0x00, 0x7F, 0x40, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F,
-    0xFE, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xBF,
-    0x6F, 0xD0, 0x0B, 0xF0, 0x1F, 0xD0, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF4, 0x01, 0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF,
-    0xD0, 0x0F, 0xF7, 0xFF, 0x00, 0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xDF, 0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0xB4, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE,
-    0x7F, 0x80, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0,
-    0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF1, 0x90,
-    0xF0, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03,
-    0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F,
-    0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x78, 0xB4, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFD, 0x00, 0x00, 0x02, 0xFE,
-    0x7F, 0x80, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x00, 0x2F, 0xE0,
-    0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0xFF, 0xEA, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x6A, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF0, 0xA0,
-    0xF0, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x03,
-    0x90, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x1B, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFE, 0xBF, 0xDB, 0xFD, 0x00, 0xFF, 0x7F, 0xF0, 0x03, 0xFD, 0xFF, 0x80, 0x1F,
-    0xF6, 0xFF, 0x41, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0xFD, 0x0B, 0xFF, 0x83, 0xF4,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C, 0x38, 0x3C, 0x00, 0x00, 0x0F,
-    0xC0, 0x2F, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0,
-    0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00,
-    0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00,
-    0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC7, 0x47, 0xC0, 0x0F, 0x80, 0x7E, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x0E, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x6F, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4,
-    0x03, 0xFD, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE, 0x00, 0x7F, 0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xF7, 0xF4, 0x2F, 0xFE, 0x0F, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x07, 0x00, 0x00, 0x01, 0xFF, 0xEB, 0xC0, 0x00, 0x00, 0xF5, 0xFF, 0xE0, 0x00, 0x00, 0x24, 0x02,
-    0x90, 0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x9F, 0xE0,
-    0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x1F, 0xF0,
-    0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x2F, 0xF0,
-    0x00, 0x3F, 0xFA, 0xAF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0x80, 0xF0, 0x03, 0xFF, 0xEF, 0x80, 0x1F, 0x1F, 0xFC, 0x00, 0x10, 0x01, 0x40, 0x01,
-    0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x1F, 0x40, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x0E, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x6F, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFA, 0xFF, 0x6F, 0xF4, 0x03, 0xFD, 0xFF, 0xC0, 0x0F, 0xF7, 0xFE,
-    0x00, 0x7F, 0xDB, 0xFD, 0x07, 0xFF, 0x5F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xE7, 0xF4, 0x2F, 0xFE,
-    0x0F, 0xD0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0,
-    0x00, 0x02, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x00, 0x2F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00,
-    0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFD,
-    0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x01, 0x50, 0x1F, 0x40, 0x1F, 0x80, 0x3F, 0xEB, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x39, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x01,
-    0xBF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xEB, 0xFD, 0xBF, 0xD0, 0x0F, 0xF7, 0xFF, 0x00,
-    0x3F, 0xDF, 0xF8, 0x01, 0xFF, 0x6F, 0xF4, 0x1F, 0xFD, 0x7F, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xDF,
-    0xD0, 0xBF, 0xF8, 0x3F, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFD, 0x7F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x1F, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFA, 0xAA, 0x97, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFD, 0x00, 0x04, 0x7F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xE0,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0x5F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x1F, 0xFA, 0xAA, 0x87, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE,
-    0xAA, 0xA5, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x11, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4,
-    0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0xE1, 0xFF, 0xFA, 0xF4, 0xFF, 0xFF,
-    0xFC, 0x3D, 0x0B, 0xFC, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0x9F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xF1, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xE0, 0x03, 0xFF, 0xEB, 0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F,
-    0x41, 0xFF, 0x40, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0, 0x07, 0xFC, 0x7F,
-    0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xB0, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFF, 0x47, 0xE0, 0x07, 0xFF, 0xCA, 0x40, 0x1F,
-    0xDF, 0xF0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x64, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x40, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xEA, 0xAA, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xF8, 0x7E,
-    0x00, 0x07, 0xFF, 0xDA, 0x40, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x01, 0x40,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0x41, 0xFF, 0x40, 0x3F, 0xD0, 0x07, 0xFC, 0x07, 0xFC, 0x00,
-    0x3F, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xF0,
-    0x00, 0x0A, 0x6F, 0xFF, 0x00, 0x00, 0x1F, 0xDF, 0xE0, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x06, 0x40,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xFA, 0xAA, 0x90, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80,
-    0x6A, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xFF, 0x80, 0x00, 0x19, 0x7F,
-    0xFD, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x14, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x2F, 0xF4, 0x1F, 0xF4, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x03, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x02,
-    0xFF, 0x4F, 0xD0, 0x7F, 0xFC, 0xB0, 0x1F, 0xDF, 0xF0, 0x03, 0xF0, 0x2F, 0x80, 0x64, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x87, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x07,
-    0xFE, 0xAA, 0xA4, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x2F, 0xF8, 0xBC, 0x00, 0x1F, 0xFF, 0x58, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x0F, 0xC0, 0x7F, 0x00,
-    0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFD, 0x07, 0xFD, 0x03, 0xFD, 0x00, 0x7F, 0xC1, 0xFF, 0x00,
-    0x0F, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x02, 0xA4, 0x0A, 0x02, 0xFF, 0xEB, 0x80, 0xF6, 0xFF, 0xC0, 0x60, 0x06, 0x80, 0x00, 0x6A,
-    0x40, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xBF, 0x40, 0x3F, 0x42, 0xF4, 0x19, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xD7, 0xFC,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0xAA, 0xA1, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0x80, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xF1,
-    0xBF, 0xC0, 0x00, 0x40, 0x05, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F,
-    0x6F, 0x80, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4, 0x3F, 0xD0,
-    0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x55, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xCF, 0xF0, 0x3F,
-    0x80, 0xBF, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF1,
-    0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xEA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x02, 0xFD, 0xBF, 0x40, 0x0B, 0xF0, 0x1F, 0xD0, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF4, 0x1F, 0xF4,
-    0x3F, 0xD0, 0x07, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0xF0, 0x02, 0x6F, 0xE0, 0x00, 0x3F, 0x80, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x07, 0xFF, 0x80,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xF4, 0x0F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xF0, 0x7F, 0xFC, 0x12, 0xFC, 0x01, 0xFC, 0x0B, 0xF8, 0x0F, 0xD0, 0x0A, 0x40, 0x00,
-    0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F,
-    0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3F,
-    0xE0, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x41, 0xFF, 0xE0, 0x02, 0xFF, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0x0F, 0xFD, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x3F, 0xE3, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE,
-    0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F,
-    0xE0, 0x00, 0x00, 0x01, 0xFD, 0x3F, 0xE3, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xD7,
-    0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F,
-    0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x2F,
-    0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x02, 0xFF, 0x80,
-    0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x1F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0xBF, 0xFE, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x11, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F,
-    0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF,
-    0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFC, 0x3F, 0x40, 0x00,
-    0x0F, 0xFF, 0x9A, 0x00, 0x00, 0x0B, 0xF7, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x01,
-    0x90, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFD,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80,
-    0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00,
-    0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00,
-    0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x0F, 0xFD, 0x00,
-    0x1F, 0xFC, 0x02, 0xFF, 0xF9, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x90, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0xF8, 0x7E, 0x00, 0x07, 0xFF, 0xDA, 0x40, 0x00,
-    0xFD, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0x81, 0xFF, 0xC0, 0x3F, 0xE0, 0x07, 0xFD, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x03, 0xFE,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x7F, 0xC0,
-    0x03, 0xFE, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x2F, 0xF8, 0x1F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0x8F,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF7, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0x90,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFD, 0x00,
-    0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x00,
-    0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00,
-    0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x00,
-    0xBF, 0xC3, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0x1F,
-    0xFC, 0x02, 0xFF, 0xF9, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xFF, 0x80, 0x00, 0x1A, 0x7F, 0xFD, 0x00, 0x00, 0x0F,
-    0xD7, 0xF0, 0x00, 0x03, 0xF4, 0x0F, 0xC0, 0x00, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xF8,
-    0x1F, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xD0, 0x7F, 0xC0, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x3F, 0xE0,
-    0xBF, 0xC0, 0x02, 0xFF, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x03, 0xFE, 0x07, 0xFC, 0x00,
-    0x3F, 0xE0, 0x3F, 0xE0, 0x07, 0xFD, 0x02, 0xFF, 0x81, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xFF, 0xC3, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0xE0, 0x00, 0x00, 0xBF, 0x7F,
-    0x40, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x00, 0x1F,
-    0xF5, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F,
-    0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x9B, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x05, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0xF8, 0xBD, 0x00, 0x1F, 0xFF, 0x58, 0x00, 0x0F,
-    0xD7, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE, 0x07, 0xFF,
-    0x03, 0xFE, 0x00, 0x7F, 0xD1, 0xFF, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x03, 0xFE, 0x2F, 0xF0, 0x00,
-    0xBF, 0xCB, 0xFC, 0x00, 0x2F, 0xF2, 0xFF, 0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x03, 0xFE, 0x0F, 0xF8,
-    0x01, 0xFF, 0x42, 0xFF, 0x81, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x03, 0x40, 0x00, 0x00, 0xFF,
-    0xFB, 0xD0, 0x00, 0x00, 0xB9, 0xBF, 0xF0, 0x00, 0x00, 0x18, 0x01, 0x90, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x1F, 0x81,
-    0xFC, 0x00, 0x00, 0x06, 0x40, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0xBF,
-    0xFE, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC7, 0xFD, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x07,
-    0xFD, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F,
-    0xF4, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x01, 0xFF,
-    0x80, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x2F, 0xFF, 0x9B, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0xB0, 0x00, 0xBF, 0xFE, 0xF0, 0x00, 0xF5, 0xBF, 0xD0, 0x00, 0x50, 0x05, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xAF, 0xC0, 0x00, 0xFD, 0x07, 0xF0,
-    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE,
-    0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD, 0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xCF, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFE, 0xAF, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x00, 0x07, 0xFE,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x07, 0xFD,
-    0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x1F, 0xF5,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC2,
-    0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x01, 0xFE, 0x7F, 0x80, 0x07, 0xF4, 0x0F, 0xE0, 0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xF8, 0x1F, 0xFC,
-    0x3F, 0xE0, 0x07, 0xFD, 0x7F, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x03, 0xFE, 0xBF, 0xC0, 0x02, 0xFF,
-    0xBF, 0xC0, 0x02, 0xFF, 0xBF, 0xC0, 0x03, 0xFE, 0x7F, 0xC0, 0x03, 0xFE, 0x3F, 0xE0, 0x07, 0xFD,
-    0x2F, 0xF8, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD,
-    0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01,
-    0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xE6, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x54, 0x00, 0x05, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE,
-    0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF,
-    0x80, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0xF8,
-    0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF,
-    0xEA, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x01,
-    0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F,
-    0xFC, 0x00, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x54, 0x00, 0x00, 0x54, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF, 0x80, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE,
-    0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F,
-    0xF9, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8,
-    0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD,
-    0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x11, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x54, 0x00, 0x06, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x7F, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9,
-    0x6F, 0xFF, 0x80, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03,
-    0xFE, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE,
-    0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F, 0xF9, 0x6F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xAF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B,
-    0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8,
-    0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD,
-    0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xE6, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xF0, 0x00, 0x02, 0xFF, 0xFB, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xC1, 0xFF, 0x80, 0x54, 0x01, 0x00, 0x04, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF, 0x80, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xC0,
-    0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x02,
-    0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFD,
-    0x00, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFF, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xFF,
-    0x83, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0xF8, 0x0B, 0xFF, 0xEA, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD,
-    0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01,
-    0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xD0,
-    0x00, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xE6, 0xFF,
-    0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x7F, 0xFE,
-    0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xDF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xF9, 0x6F, 0xFF,
-    0x80, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0x7F,
-    0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFD, 0x00, 0x2F, 0xF9, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x2F, 0xDB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00,
-    0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0x7F,
-    0xC0, 0x00, 0x3F, 0xE7, 0xFD, 0x00, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC2, 0xFF, 0xE5, 0xBF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x0B, 0xFB, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xBF, 0xE5, 0xBF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0x7F, 0xC2, 0xFF, 0xF0, 0xBF, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x02, 0xFD, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03,
-    0xFE, 0x7F, 0xD0, 0x00, 0x7F, 0xD3, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x04, 0xBF, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xEF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE,
-    0xFF, 0x96, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFD, 0xFF, 0x0B, 0xFF, 0xC2, 0xFC, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFE,
-    0x00, 0x00, 0xBF, 0x4B, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xE3, 0xFD, 0x2F, 0xF0, 0x00, 0x0F, 0xFA,
-    0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xBF, 0xC0,
-    0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x15, 0x40, 0x01, 0x50, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F,
-    0xF4, 0x00, 0xBF, 0x8F, 0xF4, 0xFF, 0x40, 0x0B, 0xFE, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xC0,
-    0xFF, 0x40, 0x0B, 0xFF, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0,
-    0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0x0B, 0xFE, 0x5B, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x3F,
-    0xC0, 0x00, 0x0B, 0xFF, 0x82, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x00, 0xBF, 0x4B, 0xFC, 0xBF,
-    0xC0, 0x00, 0x3F, 0xE3, 0xFD, 0x2F, 0xF0, 0x00, 0x0F, 0xFA, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0,
-    0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00,
-    0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x15, 0x40, 0x00,
-    0x05, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0xBF, 0x8F, 0xF4, 0xFF,
-    0x40, 0x0B, 0xFE, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0xF0, 0x0F,
-    0xF4, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x5B, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0x82, 0xFC,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x57, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x1F,
-    0xE0, 0x00, 0x0B, 0xF4, 0xBF, 0xCB, 0xFC, 0x00, 0x03, 0xFE, 0x3F, 0xD2, 0xFF, 0x00, 0x00, 0xFF,
-    0xAF, 0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x2F, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x0B, 0xFC,
-    0x00, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0,
-    0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x15, 0x40,
-    0x00, 0xA4, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0xBF, 0x8F, 0xF4,
-    0xFF, 0x40, 0x0B, 0xFE, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0xF0,
-    0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0,
-    0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x5B, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0x82,
-    0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xAF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x00, 0xBF, 0x4B, 0xFC, 0xBF, 0xC0, 0x00, 0x3F, 0xE3, 0xFD,
-    0x2F, 0xF0, 0x00, 0x0F, 0xFA, 0xFF, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F,
-    0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xFE,
-    0x5B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0x02, 0xFF, 0x00, 0x15, 0x40, 0x50, 0x01, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0xBF, 0x8F, 0xF4, 0xFF, 0x40, 0x0B, 0xFE, 0xFF, 0x0F,
-    0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00,
-    0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x5B, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0x82, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xF8,
-    0x00, 0x02, 0xFD, 0x2F, 0xF2, 0xFF, 0x00, 0x00, 0xFF, 0x8F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F, 0xEB,
-    0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00,
-    0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x0F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF9, 0x6F, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xF4,
-    0x00, 0xBF, 0x8F, 0xF4, 0xFF, 0x40, 0x0B, 0xFE, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0xFF,
-    0x40, 0x0B, 0xFF, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F,
-    0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00,
-    0x0B, 0xFE, 0x5B, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x00, 0x0B, 0xFF, 0x82, 0xFC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC1,
-    0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xDF, 0xE0, 0x00, 0x07,
-    0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xF9, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x0B, 0xFC,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x2F,
-    0xF0, 0xBF, 0xC0, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x7F, 0xC3,
-    0xFD, 0x00, 0x2F, 0xF0, 0xBF, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE,
-    0x00, 0x7F, 0xC0, 0xFF, 0x00, 0x0F, 0xF0, 0x7F, 0xC0, 0x02, 0xFD, 0x2F, 0xD0, 0x00, 0x3F, 0x8F,
-    0xF0, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x01, 0xFE, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0xAB, 0xFF, 0x0F, 0xFC, 0x3F, 0xFF, 0x83, 0xFF,
-    0x0F, 0xFF, 0x80, 0x7F, 0x43, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x5F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0xC7, 0xFE, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00,
-    0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x3F, 0xD0,
-    0x00, 0xBF, 0xC2, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF4, 0x00, 0x02, 0xFF, 0xBF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD7, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x03, 0xFD, 0x03,
-    0xFC, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x1F, 0xF0, 0x3F, 0xC0, 0x03, 0xFC, 0x1F, 0xF0,
-    0x00, 0xBF, 0x4B, 0xF4, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x03, 0xFD, 0xFE, 0x00, 0x00, 0x7F, 0xBF,
-    0x40, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2A,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xF0, 0x00, 0x0B, 0xFF, 0xEF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x02, 0xF0, 0x7F, 0xE0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0x00,
-    0xFF, 0x40, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x0B, 0xFC,
-    0x2F, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x40, 0x00, 0x2F, 0xFB, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x3D, 0x00, 0x2F, 0xFF,
-    0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xC0, 0xBF, 0x80, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0xBF, 0xC2,
-    0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFC,
-    0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x3F, 0xDF,
-    0xE0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8, 0xA0,
-    0xE0, 0xA1, 0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9, 0x2E,
-    0xAE, 0x0B, 0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF, 0xF4,
-    0xFF, 0xFD, 0x2A, 0xAA, 0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x3F, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x2A, 0x00, 0x68, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC,
-    0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA,
-    0xAA, 0x80, 0x07, 0xE0, 0xBE, 0x0F, 0xD2, 0xFC, 0x3F, 0xC3, 0xFC, 0xBF, 0x81, 0x50, 0x0F, 0xE1,
-    0xFE, 0x2F, 0xD3, 0xFC, 0x3F, 0x83, 0xF4, 0x7F, 0x01, 0x40, 0x0B, 0xF4, 0x3F, 0xC0, 0xFF, 0x07,
-    0xF4, 0x2F, 0xC0, 0xFE, 0x03, 0xF0, 0x05, 0x40, 0x7F, 0x87, 0xFC, 0x3F, 0xC2, 0xFC, 0x1F, 0xD0,
-    0xFE, 0x07, 0xF0, 0x15, 0x07, 0xE0, 0x2F, 0x42, 0xF8, 0x0F, 0xD0, 0xFD, 0x07, 0xF0, 0xBF, 0x03,
-    0xFC, 0x3F, 0xC0, 0xFE, 0x0F, 0xF0, 0xBF, 0x8B, 0xF8, 0x3F, 0xD0, 0x54, 0x05, 0x50, 0x0F, 0xE0,
-    0xBF, 0x47, 0xF8, 0x3F, 0xD2, 0xFD, 0x0F, 0xF0, 0xFF, 0x03, 0xF8, 0x3F, 0x81, 0xFD, 0x0F, 0xD0,
-    0xBF, 0x07, 0xF0, 0x3F, 0x40, 0x50, 0x05, 0x40, 0x0B, 0xF4, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F,
-    0xF0, 0x7F, 0x81, 0xFE, 0x0B, 0xF0, 0x1F, 0xC0, 0xFF, 0x02, 0xFC, 0x0F, 0xD0, 0x3F, 0x41, 0xFC,
-    0x01, 0x50, 0x05, 0x00, 0x7F, 0x83, 0xFC, 0x1F, 0xF0, 0xBF, 0x43, 0xFC, 0x1F, 0xE0, 0xBF, 0x03,
-    0xFC, 0x1F, 0xD0, 0xBF, 0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x03, 0xF4, 0x05, 0x40, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0x80, 0x02, 0x57, 0xE5, 0x61, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0x5A, 0x9F, 0x9A, 0x80, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x01, 0x03, 0xF0, 0x11, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0x9F, 0xEF, 0xEF, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xFF, 0xF1, 0xFF, 0xFD, 0xBF, 0xFF, 0xAF,
-    0xFF, 0xEB, 0xFF, 0xF4, 0xFF, 0xFC, 0x2F, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x7E, 0x00, 0x07, 0xFD, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0xD0, 0x7F,
-    0xE0, 0x07, 0xF0, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x43, 0xFD, 0x3F, 0xF3, 0xFF, 0x2F,
-    0xD0, 0x50, 0x05, 0x00, 0x05, 0x40, 0xFF, 0x40, 0x7F, 0xC7, 0xFE, 0x03, 0xFF, 0x1F, 0xF8, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x1F, 0xE0, 0x14, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x40, 0x01, 0x40, 0xFF,
-    0x40, 0xBF, 0x80, 0x7F, 0xC7, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x1F, 0xF8, 0x0F, 0xFC, 0x0B, 0xFC,
-    0x3F, 0xC0, 0x2F, 0xD0, 0x1F, 0xE0, 0x14, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x03, 0xFD, 0x7F,
-    0xE7, 0xFE, 0x3F, 0xC0, 0x50, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F,
-    0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xF8,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFE, 0x1F, 0xC1, 0xB9, 0x00, 0x06, 0xE4, 0x02,
-    0xFC, 0x3F, 0x4F, 0xD3, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0xCB, 0xF2, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xF8, 0x0B, 0xFF, 0xD3, 0xF4, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x00, 0x7F, 0x82, 0xFC, 0x7F,
-    0x03, 0xF1, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0xFD, 0x7F, 0x03, 0xF4, 0x00, 0x00,
-    0xFE, 0x07, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x0F, 0xD7, 0xF0, 0x3F,
-    0x40, 0x00, 0x3F, 0x80, 0x7F, 0x03, 0xF5, 0xFC, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x0F, 0xD1, 0xFC,
-    0x3F, 0x47, 0xF0, 0x00, 0x0F, 0xD0, 0x03, 0xFE, 0xFF, 0x0B, 0xFB, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x42, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x7F, 0x06, 0xE4, 0x00, 0x1B, 0x90, 0x00, 0x6E, 0x40,
-    0x2F, 0xC3, 0xF4, 0xFE, 0x2F, 0xFF, 0x00, 0xBF, 0xFC, 0x02, 0xFF, 0xF0, 0x1F, 0xFF, 0xF1, 0xFC,
-    0xBF, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x0B, 0xFF, 0xD3, 0xF4, 0xFF, 0x2F, 0xC3, 0xFC,
-    0xBF, 0x0F, 0xF1, 0xFD, 0x01, 0xFE, 0x0B, 0xF0, 0xFD, 0x0F, 0xD3, 0xF4, 0x3F, 0x4F, 0xD0, 0xFE,
-    0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0x8F, 0xD0, 0xFE, 0x00, 0x00, 0x2F, 0x81,
-    0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0x8F, 0xD0, 0xBF, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x0F, 0xE7, 0xF0,
-    0x3F, 0x8F, 0xD0, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x0F, 0xD3, 0xF4, 0x3F, 0x8F, 0xD0, 0xFE,
-    0x00, 0x01, 0xFC, 0x00, 0xFD, 0x1F, 0xD3, 0xF8, 0x3F, 0x4F, 0xE0, 0xFD, 0x00, 0x03, 0xF8, 0x00,
-    0xBF, 0xBF, 0xC2, 0xFE, 0xFF, 0x07, 0xFB, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0xFF,
-    0xFD, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0xF0, 0x01, 0xA4, 0x00, 0x00, 0xFE,
-    0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0x80, 0x3F, 0x82, 0xFC, 0x02, 0xFC, 0x0F, 0xD0, 0x0F, 0xC0, 0xBE,
-    0x00, 0xBE, 0x03, 0xF0, 0x03, 0xF0, 0x2F, 0x40, 0x1A, 0x40, 0xA8, 0x00, 0x00, 0xFE, 0x0B, 0xF0,
-    0x3F, 0x80, 0xBF, 0x03, 0xF8, 0x2F, 0xC0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0x2F, 0xC0, 0xFD, 0x0B,
-    0xF0, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x02, 0xF4, 0x03, 0xF0, 0x2F, 0x40, 0xFC,
-    0x01, 0xA4, 0x0A, 0x80, 0x68, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x02,
-    0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xA8, 0x3F, 0x82, 0xFC, 0x00, 0xBF, 0x03, 0xF8, 0x00,
-    0xFE, 0x0B, 0xF0, 0x01, 0xFC, 0x0F, 0xE0, 0x02, 0xF8, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x80, 0x07,
-    0xE0, 0x3F, 0x00, 0x0A, 0x80, 0x69, 0x3F, 0x82, 0xFC, 0x1F, 0xD0, 0x02, 0xFC, 0x0F, 0xE0, 0xFF,
-    0x00, 0x0F, 0xE0, 0xBF, 0x03, 0xF8, 0x00, 0x7F, 0x03, 0xF8, 0x1F, 0xC0, 0x02, 0xF8, 0x0F, 0xC0,
-    0xFE, 0x00, 0x0F, 0xC0, 0xBE, 0x03, 0xF0, 0x00, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0x02, 0xA0, 0x1A,
-    0x40, 0xA8, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xDF,
-    0x80, 0x07, 0xC7, 0xC0, 0x0F, 0x83, 0xE0, 0x1F, 0x01, 0xF0, 0x3E, 0x00, 0xF8, 0x3C, 0x00, 0x7C,
-    0x00, 0x10, 0x00, 0x2F, 0x80, 0x1F, 0xF0, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFC, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBE, 0x00, 0x04, 0x00,
-    0x05, 0x00, 0x0B, 0xC0, 0x0B, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF4,
-    0x07, 0xFD, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x04, 0x00, 0xF4, 0x02, 0xFE, 0x00,
-    0xB8, 0x0B, 0xF4, 0x0B, 0xF8, 0x0B, 0xF8, 0x0F, 0xF4, 0x1F, 0xC0, 0xBF, 0x80, 0x0F, 0xF4, 0x04,
-    0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0xBF, 0x80, 0x00, 0x14, 0x0F, 0xFF, 0xFC, 0x05, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0xFF, 0x2F,
-    0xF0, 0x0F, 0xFC, 0x03, 0xFD, 0x7F, 0xC0, 0xBF, 0xF4, 0x0F, 0xF0, 0xBD, 0x0B, 0xFF, 0xF4, 0x1F,
-    0x40, 0x00, 0xBF, 0x8F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x0F,
-    0xF4, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0xB8, 0x0F, 0xF4, 0x0B, 0xF8, 0x0B,
-    0xF4, 0x0F, 0xF4, 0x1F, 0x80, 0x3F, 0xE0, 0x0F, 0xC0, 0x18, 0x00, 0xBF, 0x40, 0x0C, 0x00, 0x00,
-    0x00, 0xA4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0xE7, 0xFE, 0x03, 0xFF, 0x3F, 0xD0, 0x3F, 0xF3,
-    0xFD, 0x03, 0xFE, 0x3F, 0xD0, 0x3F, 0xE3, 0xFD, 0x03, 0xFE, 0x3F, 0xD0, 0x2F, 0xE3, 0xFC, 0x02,
-    0xFE, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x02, 0xFD, 0x3F, 0xC0, 0x2F, 0xD3, 0xFC, 0x01, 0xFD, 0x2F,
-    0xC0, 0x1F, 0xD2, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05,
-    0x43, 0xFD, 0x02, 0xFE, 0x7F, 0xE0, 0x3F, 0xF7, 0xFE, 0x03, 0xFF, 0x3F, 0xC0, 0x2F, 0xD0, 0x50,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFD, 0xBF, 0xC1, 0x6F, 0xC3, 0xFC, 0x02, 0xFC, 0x2F, 0xC0, 0x2F, 0xC3, 0xFC, 0x01, 0xFC,
-    0xBF, 0x80, 0x1F, 0xEF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2C, 0x3C, 0x00, 0x00, 0x07,
-    0x80, 0xF0, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x01, 0xBC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x30, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xEB,
-    0x40, 0x03, 0xC3, 0xC0, 0x0B, 0x83, 0xD0, 0x0F, 0x01, 0xF0, 0x2E, 0x00, 0xF4, 0x3C, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0xF8, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x6F, 0xFD, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x2E, 0x03,
-    0xD0, 0x15, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x04, 0x07, 0xE0, 0x04,
-    0x00, 0x40, 0x7E, 0x00, 0x4B, 0xE5, 0xF9, 0xBF, 0x00, 0x7E, 0x5F, 0x9B, 0xF2, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xFD,
-    0x40, 0x00, 0x06, 0xFF, 0xD4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x0B, 0xFB,
-    0xF0, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x07, 0xF4, 0xFE, 0x00, 0x00, 0x7F, 0x4F, 0xE0, 0x03, 0xFC,
-    0x2F, 0xD0, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x2E, 0x03, 0x80, 0x00, 0x01, 0xE0, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x2F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x7F, 0xC0,
-    0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF5, 0x7F, 0xFF, 0xFF, 0xFE,
-    0xAA, 0xA0, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x2A, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x15, 0xFE,
-    0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x15, 0xFE,
-    0x7F, 0xFE, 0x7F, 0xFE, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFE, 0x40, 0x7F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x8B, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xA6, 0xFF, 0xC3, 0xF9, 0x6F, 0xFC, 0x14, 0x00, 0x3F, 0xD2, 0x40, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F,
-    0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x7F, 0xD7, 0xFF, 0xFF, 0xF0, 0x1F, 0xF5, 0xFF, 0xFF, 0xFE, 0x07, 0xFD, 0x3F, 0xA6, 0xFF, 0xC1,
-    0xFF, 0x45, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x01, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x07, 0xFE,
-    0x01, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x01, 0x40, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x06, 0xFF, 0xF8, 0x07, 0xFE, 0x0F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0x43, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0xBF, 0x97, 0xFF, 0x4F, 0xF4, 0x08, 0x00, 0x2F, 0xE3,
-    0xFD, 0x00, 0x00, 0x0B, 0xF8, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x02, 0xFF, 0x0F,
-    0xF0, 0x00, 0x02, 0xFF, 0x43, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x3F,
-    0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x15, 0x00, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF0,
-    0x00, 0xBF, 0x40, 0x00, 0x50, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
-    0xE0, 0xF9, 0x7F, 0xFF, 0xF4, 0xF8, 0x3F, 0xFF, 0xF8, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xF4, 0xF8, 0x3F, 0xFF, 0xE0, 0xF8, 0x3F, 0xFF,
-    0x80, 0xF8, 0x3D, 0x10, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00,
-    0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00,
-    0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xA4, 0x29, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC,
-    0x2E, 0x3F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC,
-    0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x7F, 0xFF, 0xFC, 0x2E, 0x3F, 0xFF, 0xFC, 0x2E, 0x3F, 0xFF, 0xFC,
-    0x3E, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0xAA, 0xA9, 0x7F, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x7C, 0x3F, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF,
-    0xFD, 0x7C, 0x3F, 0xFF, 0xFD, 0x7C, 0x3F, 0xFF, 0xFE, 0x7C, 0x3F, 0xFF, 0xFE, 0x7C, 0x3F, 0xFF,
-    0xFE, 0x7C, 0x3F, 0xFF, 0xFD, 0x7C, 0x3F, 0xFF, 0xFC, 0x7C, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x6A, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x1F, 0x5B, 0xE3,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF, 0xF0, 0x00, 0x0F,
-    0xEF, 0xE0, 0x00, 0xBF, 0x1F, 0xD0, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xFE, 0x1F, 0xF8, 0x3F, 0xD0, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0xFC, 0x0F, 0xF4, 0x1F, 0xD0,
-    0x3F, 0x80, 0xBF, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xC0, 0x0F, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00,
-    0x00, 0x38, 0x30, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x2C, 0x3C, 0x00, 0x00, 0x07,
-    0x80, 0xF0, 0x00, 0x01, 0xF0, 0x07, 0xE0, 0x01, 0xBC, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBE, 0x1F, 0x5B, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-    0xFF, 0x05, 0x7F, 0xF9, 0x50, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0xBF, 0x1F, 0xD0,
-    0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xD0, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x2F, 0x87,
-    0xD6, 0xF8, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xC1, 0x5F, 0xFE, 0x54, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xFB, 0xF8, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0xFF, 0x0F, 0xF0, 0x01, 0xF4, 0x1E, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xCF, 0xFC, 0x0F, 0xE3, 0xFF, 0x03,
-    0xF4, 0xBF, 0x82, 0xFC, 0x06, 0x40, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x05, 0x01, 0xFC,
-    0x1F, 0xF0, 0xFE, 0x0B, 0xFC, 0x7F, 0x02, 0xFF, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x01, 0x00, 0x01,
-    0xBF, 0xE9, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x7E, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xD0, 0xB4, 0x00, 0x00, 0x05, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x02, 0xFE, 0xAB, 0xF4, 0x00, 0xB8, 0x00, 0x07, 0xD0, 0x1E, 0x00, 0x00, 0x0B, 0x43,
-    0x80, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0x90, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0x83, 0xD1, 0xD0, 0x0B, 0xE3, 0xD7, 0xF0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0x00, 0x2A, 0xBF, 0xFE, 0xA9, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xF7, 0xDB, 0xE0, 0x07, 0xC3, 0xD2, 0xE0, 0x01, 0x03, 0xD0,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x68, 0x00, 0x00, 0xFE, 0x0F, 0xF0,
-    0xBF, 0x0B, 0xF0, 0x0B, 0xF0, 0x7F, 0x47, 0xF8, 0x3F, 0x80, 0x3F, 0x83, 0xF8, 0x3F, 0xC2, 0xFC,
-    0x02, 0xFC, 0x1F, 0xC1, 0xFC, 0x0F, 0xD0, 0x0F, 0xC0, 0xFD, 0x0F, 0xE0, 0xBE, 0x00, 0xBE, 0x07,
-    0xE0, 0x7F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x40, 0x1A, 0x40, 0xA4, 0x0A, 0x40,
-    0xA8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0A, 0x43, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0x9F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xD7, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x6E, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0xA4, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F, 0xD7, 0xFE, 0x7F, 0xE3, 0xFC, 0x05, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x01, 0xA4, 0x3F, 0xD0, 0x00, 0x3F,
-    0xD7, 0xFE, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x7F, 0xD2, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xF4, 0x03, 0xFE, 0x03, 0xF0,
-    0x3F, 0xF0, 0x0F, 0xFC, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F, 0xE0, 0x3F, 0x02, 0xFF, 0x00, 0x2E, 0x00,
-    0xFC, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x90, 0x0F, 0xC0, 0x1A, 0x00, 0x3F, 0xE0, 0x3F,
-    0x02, 0xFF, 0x00, 0xFF, 0xC0, 0xFC, 0x0F, 0xFC, 0x03, 0xFE, 0x03, 0xF0, 0x3F, 0xF0, 0x0B, 0xF0,
-    0x0F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x3F, 0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC3, 0xFE, 0x3F, 0xF3, 0xFE, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x7F, 0xE7,
-    0xFE, 0x3F, 0xD0, 0x64, 0x05, 0x03, 0xFD, 0x7F, 0xE7, 0xFE, 0x2F, 0xC0, 0x00, 0x0A, 0x43, 0xFD,
-    0x7F, 0xE3, 0xFE, 0x1F, 0x80, 0x00, 0x1A, 0x43, 0xFD, 0x7F, 0xE3, 0xFD, 0x1F, 0x80, 0x00, 0x1F,
-    0x83, 0xFD, 0x7F, 0xE3, 0xFD, 0x0A, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70,
-    0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F,
-    0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01,
-    0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F, 0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38, 0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0x02, 0xFF, 0xFE, 0x0F, 0xF2, 0xFC, 0x7F, 0x47,
-    0xF5, 0xFC, 0x0F, 0xD7, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x7F, 0x43, 0xF4, 0xFE, 0x2F, 0xC2, 0xFF,
-    0xFF, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBD, 0x7C, 0x00, 0xBD, 0xBD,
-    0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0x68, 0x00, 0x1A, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x03, 0xDF, 0xC0, 0x3E, 0x3F, 0x01, 0xF0, 0xFC, 0x0F, 0x43, 0xF0, 0xBF, 0xFF,
-    0xFA, 0xFF, 0xFF, 0xF6, 0xAA, 0xFE, 0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2A, 0xAA, 0x03, 0xFF,
-    0xF4, 0x7F, 0xFF, 0x47, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x02, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0xF5, 0x7F, 0xCF, 0xFF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFF, 0xE9, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0xFF, 0x07,
-    0xFF, 0xFF, 0x1F, 0xD0, 0xFD, 0x7F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3, 0xF9, 0xBF, 0x03, 0xFF, 0xF8,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x00,
-    0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x03,
-    0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x43,
-    0xF9, 0xBF, 0x0F, 0xC0, 0xFC, 0x2F, 0x87, 0xE0, 0x3F, 0xFF, 0x00, 0xBF, 0xF8, 0x0B, 0xFB, 0xF8,
-    0x3F, 0x03, 0xF5, 0xF8, 0x0B, 0xD3, 0xF4, 0x7F, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x03, 0xFE, 0xFE, 0x1F, 0xC0, 0xFC, 0x7F, 0x02, 0xF5, 0xFC,
-    0x0F, 0xD3, 0xFE, 0xFF, 0x47, 0xFE, 0xFD, 0x01, 0x43, 0xF0, 0x00, 0x2F, 0xC0, 0x57, 0xFD, 0x07,
-    0xFF, 0xD0, 0x1F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x3D, 0x01, 0x5F,
-    0x94, 0xFF, 0xFF, 0x6A, 0xFA, 0x80, 0x3D, 0x00, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x55, 0x55, 0x3F,
-    0xFF, 0xDA, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0xAA, 0xAA, 0x7F,
-    0xFF, 0xD5, 0x55, 0x50, 0x01, 0x50, 0x7D, 0x0F, 0xC1, 0xF4, 0x2F, 0x03, 0xF0, 0x3E, 0x03, 0xE0,
-    0x3D, 0x03, 0xD0, 0x3E, 0x03, 0xE0, 0x2F, 0x01, 0xF0, 0x0F, 0x80, 0xBC, 0x02, 0xE0, 0x54, 0x07,
-    0xD0, 0x2F, 0x01, 0xF4, 0x0F, 0x80, 0xBC, 0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC,
-    0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x8F, 0xF8, 0xBF, 0xFF, 0xEB,
-    0xF0, 0x7F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0,
-    0x3F, 0x68, 0x02, 0xA0, 0x02, 0xFE, 0x00, 0x3F, 0xFF, 0x02, 0xFF, 0xFE, 0x0F, 0xF2, 0xFC, 0x7F,
-    0x47, 0xF5, 0xFC, 0x0F, 0xD7, 0xF0, 0x3F, 0x5F, 0xC0, 0xFD, 0x7F, 0x43, 0xF4, 0xFE, 0x2F, 0xC2,
-    0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x3F, 0xC0,
-    0x7F, 0xF0, 0xBF, 0xFC, 0x2F, 0x7F, 0x02, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x06, 0xFE, 0x02, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xD0, 0xD0, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x07, 0xF8, 0x01,
-    0xFE, 0x00, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x06, 0xFE, 0x00, 0xFF, 0xFF, 0x02,
-    0xFA, 0xFE, 0x01, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x0A, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xAB, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC3, 0xE6, 0xFF, 0x0F, 0xFF, 0xF4, 0x2F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x80, 0x00, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xDF, 0xC0, 0x3E,
-    0x3F, 0x01, 0xF0, 0xFC, 0x0F, 0x43, 0xF0, 0xBF, 0xFF, 0xFA, 0xFF, 0xFF, 0xF6, 0xAA, 0xFE, 0x40,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x2A, 0xAA, 0x03, 0xFF, 0xF4, 0x7F, 0xFF, 0x47, 0xC0, 0x00, 0x7D,
-    0x00, 0x0B, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0xF5, 0x7F,
-    0xCF, 0xFF, 0xF4, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFF, 0xE9,
-    0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xD0, 0xFD, 0x7F, 0x03,
-    0xF4, 0xFC, 0x0F, 0xD3, 0xF9, 0xBF, 0x03, 0xFF, 0xF8, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xA0, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xFD, 0x00,
-    0x0B, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x43, 0xF9, 0xBF, 0x0F, 0xC0, 0xFC, 0x2F, 0x87,
-    0xE0, 0x3F, 0xFF, 0x00, 0xBF, 0xF8, 0x0B, 0xFB, 0xF8, 0x3F, 0x03, 0xF5, 0xF8, 0x0B, 0xD3, 0xF4,
-    0x7F, 0x0B, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x7F, 0xFF, 0x03,
-    0xFE, 0xFE, 0x1F, 0xC0, 0xFC, 0x7F, 0x02, 0xF5, 0xFC, 0x0F, 0xD3, 0xFE, 0xFF, 0x47, 0xFE, 0xFD,
-    0x01, 0x43, 0xF0, 0x00, 0x2F, 0xC0, 0x57, 0xFD, 0x07, 0xFF, 0xD0, 0x1F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x3D, 0x01, 0x5F, 0x94, 0xFF, 0xFF, 0x6A, 0xFA, 0x80, 0x3D,
-    0x00, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xDA, 0xAA, 0xA0, 0x00, 0x00, 0x3F,
-    0xFF, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0xAA, 0xAA, 0x7F, 0xFF, 0xD5, 0x55, 0x50, 0x01, 0x50, 0x7D,
-    0x0F, 0xC1, 0xF4, 0x2F, 0x03, 0xF0, 0x3E, 0x03, 0xE0, 0x3D, 0x03, 0xD0, 0x3E, 0x03, 0xE0, 0x2F,
-    0x01, 0xF0, 0x0F, 0x80, 0xBC, 0x02, 0xE0, 0x54, 0x07, 0xD0, 0x2F, 0x01, 0xF4, 0x0F, 0x80, 0xBC,
-    0x0B, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0xBC, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xE0, 0xBC,
-    0x00, 0x06, 0xFF, 0x40, 0xFF, 0xFD, 0x05, 0x03, 0xF0, 0x00, 0x3F, 0x0B, 0xFF, 0xF3, 0xF9, 0x7F,
-    0x3F, 0x03, 0xF3, 0xF0, 0x7F, 0x3F, 0xFF, 0xF0, 0xBF, 0x4F, 0x01, 0xFE, 0x40, 0x3F, 0xFF, 0x42,
-    0xF8, 0x2F, 0x0F, 0xC0, 0x7D, 0x3F, 0xFF, 0xF4, 0xFE, 0xAA, 0x93, 0xF0, 0x00, 0x0B, 0xE0, 0x04,
-    0x0F, 0xFF, 0xF0, 0x07, 0xFE, 0x40, 0x01, 0xFE, 0x40, 0x3F, 0xFF, 0x82, 0xF8, 0x3F, 0x4F, 0xC0,
-    0x3F, 0x3F, 0x00, 0xFC, 0xFC, 0x03, 0xF3, 0xF0, 0x0F, 0xCB, 0xE0, 0xBD, 0x0F, 0xFF, 0xE0, 0x07,
-    0xFD, 0x00, 0x7E, 0x02, 0xF4, 0xFD, 0x1F, 0xC0, 0xFC, 0xFC, 0x01, 0xFF, 0xD0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0xBF, 0xF4, 0x07, 0xF3, 0xF0, 0x3F, 0x03, 0xF1, 0xF4, 0x07, 0xD0, 0x0B, 0xFE,
-    0x00, 0xBF, 0xFF, 0x01, 0x40, 0x7F, 0x00, 0x00, 0xBD, 0x2A, 0xAB, 0xF4, 0xFF, 0xFF, 0xD3, 0xE0,
-    0x2F, 0x0F, 0xC0, 0xFC, 0x0F, 0xFF, 0xD0, 0x0B, 0xF8, 0x00, 0x68, 0x00, 0x0B, 0xD0, 0x00, 0xBD,
-    0x00, 0x0B, 0xD0, 0x00, 0xBD, 0xBF, 0x4B, 0xFF, 0xFD, 0xBF, 0x4B, 0xFB, 0xE0, 0x3F, 0xBD, 0x03,
-    0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xF7, 0xC0, 0x2F, 0x68, 0x00, 0x02,
-    0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x02, 0xE2, 0xF4, 0x3F, 0x4B, 0xD3, 0xF4,
-    0x2F, 0x7F, 0x40, 0xBF, 0xF8, 0x02, 0xFF, 0xF4, 0x0B, 0xE3, 0xF0, 0x2F, 0x47, 0xF0, 0xBD, 0x0B,
-    0xE1, 0xF4, 0x0B, 0xD0, 0x68, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
-    0xBD, 0x7C, 0x78, 0xBF, 0x47, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x8B, 0xF4, 0xBF, 0x87, 0xF2, 0xF4,
-    0x1F, 0xC0, 0xFC, 0xBD, 0x03, 0xE0, 0x2F, 0x2F, 0x40, 0xF8, 0x0B, 0xCB, 0xD0, 0x3E, 0x02, 0xF2,
-    0xF4, 0x0F, 0x80, 0xBC, 0xBD, 0x03, 0xE0, 0x2F, 0x1F, 0x00, 0xF8, 0x0B, 0xC0, 0x78, 0xBF, 0x4B,
-    0xFF, 0xFD, 0xBF, 0x4B, 0xFB, 0xE0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0, 0x3F, 0xBD, 0x03, 0xFB, 0xD0,
-    0x3F, 0xBD, 0x03, 0xF7, 0xC0, 0x2F, 0x78, 0xBE, 0x02, 0xFF, 0xFF, 0x0B, 0xF4, 0xBE, 0x2F, 0x40,
-    0xFC, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x2F, 0xD2, 0xF8, 0xBF, 0xFF, 0xC2, 0xF6,
-    0xF8, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x0F,
-    0xFF, 0xD3, 0xE0, 0x10, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0xBF, 0xD0, 0x02, 0xF8, 0x90, 0x3E, 0x3F,
-    0xFF, 0x4B, 0xFE, 0x40, 0x07, 0x40, 0x0B, 0x80, 0x1F, 0xFD, 0xBF, 0xFE, 0x1F, 0x80, 0x0F, 0x80,
-    0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x0F, 0xFE, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xF9, 0x6C,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x06, 0xAA, 0xA8, 0x7F, 0x82,
-    0xFF, 0xFF, 0x1F, 0xE0, 0xBF, 0xFF, 0xC7, 0xFC, 0x2F, 0xFF, 0xF0, 0xFF, 0x0B, 0xF4, 0x00, 0x3F,
-    0xF6, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xE5, 0x50, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE1, 0xF0, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFD, 0xBF, 0x40, 0xBF, 0xEB, 0x4B, 0x90, 0x0F, 0xF8,
-    0xF0, 0xB4, 0x02, 0xFF, 0x0F, 0x0F, 0x00, 0x3F, 0xE1, 0xF0, 0xF0, 0x03, 0xFD, 0x2E, 0x1E, 0x00,
-    0x3F, 0xD2, 0xD2, 0xE0, 0x03, 0xFD, 0x3C, 0x2D, 0x00, 0x3F, 0xE3, 0xC3, 0xC0, 0x02, 0xFF, 0x7C,
-    0x3C, 0x00, 0x1F, 0xFF, 0x87, 0x80, 0x00, 0xFF, 0xF4, 0xB8, 0x00, 0x0B, 0xFF, 0x9F, 0x9B, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x2D, 0x6E,
-    0x40, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0x96, 0xF0, 0x2F,
-    0xF8, 0x00, 0x10, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF,
-    0x81, 0xA0, 0xBC, 0xFF, 0x42, 0xF7, 0xFC, 0xFF, 0x42, 0xFF, 0xF8, 0xFF, 0x42, 0xFF, 0xE4, 0xFF,
-    0x82, 0xFF, 0x00, 0xBF, 0x82, 0xFD, 0x00, 0xBF, 0xC2, 0xFD, 0x00, 0x7F, 0xD2, 0xFD, 0x00, 0x3F,
-    0xF2, 0xFD, 0x00, 0x1F, 0xFF, 0xFE, 0xB4, 0x0F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1B,
-    0xFD, 0x54, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1B, 0xFD, 0x54, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x9B, 0xE0, 0x03,
-    0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x6B, 0xFE, 0xAA, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x5B, 0xFD, 0x55, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFE, 0x0B, 0xFF, 0x4F,
-    0xFF, 0xF0, 0x3F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xD5, 0xFF, 0xFD, 0x5F, 0xFC, 0xFF, 0xD0, 0x1F, 0xFC, 0x01, 0xFF, 0x7F, 0xF0, 0x03, 0xFF, 0x00,
-    0x3F, 0xDF, 0xF8, 0x00, 0xFF, 0x80, 0x0F, 0xF7, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0xFF, 0x7F, 0xE0, 0x07, 0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x03, 0xFF, 0x40, 0x0F,
-    0xF7, 0xFE, 0x01, 0xFF, 0xD0, 0x03, 0xFD, 0xFF, 0x80, 0xFF, 0xF4, 0x00, 0xFF, 0x7F, 0xE0, 0x7F,
-    0xFD, 0x00, 0x3F, 0xDF, 0xF8, 0x2F, 0xFF, 0x40, 0x0F, 0xF7, 0xFE, 0x0F, 0xBF, 0xD0, 0x03, 0xFD,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xF8, 0x03, 0xFF, 0x00,
-    0xBE, 0x00, 0xFF, 0xD0, 0x2F, 0x80, 0x3F, 0xF8, 0x0B, 0xE0, 0x0F, 0xFF, 0x02, 0xF8, 0x03, 0xFB,
-    0xC0, 0xBE, 0x00, 0xFD, 0xF8, 0x2F, 0x81, 0xBF, 0xBF, 0xAF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0x5B,
-    0xFA, 0xFE, 0xFF, 0x80, 0xFC, 0x3E, 0x1F, 0x81, 0x7F, 0x5F, 0xDB, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x0F, 0xDF, 0x80, 0x3F, 0x02, 0xFB, 0xE0, 0x0F, 0xC0, 0x7F,
-    0xF8, 0x03, 0xF0, 0x0F, 0xFE, 0x00, 0xFC, 0x02, 0xFF, 0x80, 0x3F, 0x00, 0x7F, 0xE0, 0x0F, 0xC0,
-    0x0F, 0xF8, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03,
-    0xFD, 0x00, 0xFF, 0x40, 0x50, 0x0F, 0xF4, 0x03, 0xFD, 0x0B, 0xC0, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F,
-    0x00, 0xFF, 0x40, 0x7F, 0xC1, 0xFC, 0x03, 0xFD, 0x07, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF4, 0x03, 0xFC, 0x03, 0xFF, 0xA4,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-    0x40, 0x00, 0x03, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0xFF, 0x41, 0xFF, 0xF8, 0xFF, 0x40, 0xFF, 0x47, 0xFF, 0xFD, 0xFF, 0x40, 0xFF, 0x0F,
-    0xFF, 0xFC, 0xFF, 0x41, 0xFF, 0x0F, 0xF0, 0x28, 0xFF, 0xAB, 0xFE, 0x1F, 0xE0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xE0,
-    0xFF, 0x4F, 0xF0, 0x00, 0xBF, 0xFC, 0xFF, 0x4F, 0xF8, 0x00, 0x1F, 0xFE, 0xFF, 0x47, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x42, 0xFF, 0x19, 0x01, 0xFE, 0xFF, 0x40,
-    0xFF, 0x5F, 0xFF, 0xFD, 0xFF, 0x40, 0xBF, 0xDF, 0xFF, 0xFC, 0xFF, 0x40, 0x3F, 0xDB, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0x83, 0xF0, 0x07, 0xFC, 0x02,
-    0xF8, 0x3F, 0x40, 0xBF, 0xC0, 0x3F, 0x83, 0xF4, 0x0B, 0xFC, 0x03, 0xF4, 0x3F, 0x80, 0xFF, 0xD0,
-    0x3F, 0x02, 0xF8, 0x0F, 0xBE, 0x07, 0xF0, 0x1F, 0xC0, 0xF7, 0xE0, 0x7F, 0x01, 0xFC, 0x1F, 0x7F,
-    0x0B, 0xE0, 0x0F, 0xC1, 0xF2, 0xF0, 0xBE, 0x06, 0xFE, 0xBF, 0xBF, 0xAF, 0xE8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC6, 0xFF, 0xBF, 0xAF, 0xEF, 0xE8, 0x07, 0xE3, 0xE0, 0xF8, 0xFC, 0x00, 0x7F, 0x7D,
-    0x0F, 0xDF, 0xC0, 0x03, 0xF7, 0xD0, 0xFD, 0xF8, 0x00, 0x3F, 0xBC, 0x0B, 0xEF, 0x40, 0x03, 0xFF,
-    0xC0, 0x7F, 0xF0, 0x00, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF4, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x07, 0xF6,
-    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xDB, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x6F, 0xE5, 0x56, 0xFF, 0x41,
-    0xFD, 0xBF, 0x40, 0x01, 0xFF, 0x07, 0xF6, 0xFD, 0x1A, 0x83, 0xFC, 0x1F, 0xDB, 0xF4, 0xBF, 0x4B,
-    0xF0, 0x7F, 0x6F, 0xD2, 0xFD, 0x2F, 0xD1, 0xFD, 0xBF, 0x4B, 0xF4, 0xBF, 0x47, 0xF6, 0xFD, 0x2F,
-    0xD2, 0xFD, 0x1F, 0xDB, 0xF4, 0xBF, 0x4B, 0xF4, 0x7F, 0x6F, 0xD2, 0xFD, 0x2F, 0xD1, 0xFD, 0xBF,
-    0x4B, 0xF4, 0xBF, 0x47, 0xF6, 0xFD, 0x2F, 0xD2, 0xFD, 0x1F, 0xDB, 0xF4, 0xBF, 0x4B, 0xF4, 0xBF,
-    0x6F, 0xD2, 0xFD, 0x1A, 0x83, 0xFC, 0xBF, 0x4B, 0xF4, 0x00, 0x1F, 0xF2, 0xFD, 0x2F, 0xD0, 0x02,
-    0xFF, 0x4B, 0xF4, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xD2, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0x4B, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0xE3, 0xFD, 0x00, 0xFF, 0xFF, 0xBF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x96, 0xFF, 0xD0, 0x7F, 0xF0, 0x0B, 0xFD, 0x07, 0xFD, 0x00,
-    0x3F, 0xD0, 0xBF, 0xC0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0xBF, 0xD0, 0x03, 0xFD, 0x07,
-    0xFD, 0x00, 0x3F, 0xD0, 0x7F, 0xF0, 0x07, 0xFD, 0x03, 0xFF, 0x95, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0x7F, 0xD0, 0x02, 0xFF, 0xC2, 0xFD, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x6A, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xEA, 0xF4, 0x00, 0xFF, 0x80, 0x04, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xAF,
-    0xFA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x6F, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x5B, 0x80, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F,
-    0xF4, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xC0, 0x3F, 0xD0, 0x3F, 0xE0,
-    0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x3F, 0xD3, 0xFC,
-    0x00, 0x0F, 0xF6, 0xFD, 0x00, 0x2B, 0xFF, 0xFF, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x3F,
-    0xD0, 0xFF, 0x80, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x7F, 0xD0,
-    0x3F, 0xD0, 0x0F, 0xFC, 0x0F, 0xF4, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFE, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x89, 0x00, 0x0B, 0xFF, 0xEF, 0xC0, 0x07, 0xEF, 0xFF, 0xD0,
-    0x00, 0x93, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x38, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x95, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x6F,
-    0xE4, 0x01, 0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF8, 0x7F, 0xEF, 0xF0,
-    0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0x80, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x1F, 0xC0, 0x3F, 0x87, 0xFC,
-    0x0B, 0xFF, 0x0B, 0xF0, 0x0F, 0xE2, 0xFF, 0xAF, 0xFF, 0x43, 0xFC, 0x03, 0xF4, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0x97, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xE4, 0x00, 0x2F,
-    0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xF5, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x02, 0xFE, 0x0B, 0xF0, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0x00, 0x03, 0xFD, 0x7F,
-    0x40, 0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x0C, 0x0B, 0xFC, 0x00, 0x07, 0x82, 0xFF, 0x80, 0x03, 0xF1, 0xFF, 0xF0, 0x02, 0xFE,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0xBF, 0xC0, 0xBE, 0xFF, 0x0F, 0xF4, 0x3F, 0x2F, 0x43, 0xFE, 0x2F,
-    0x43, 0x80, 0x7F, 0xC0, 0x00, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xFF, 0xE8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xD5, 0xFF, 0xD0, 0x1F, 0xF5, 0x5F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xC0, 0x0F, 0xF0, 0x5F, 0xF5, 0x57, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xEA, 0xFF,
-    0xE4, 0x3F, 0xC0, 0x7F, 0xD0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xE5, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFB, 0xFC, 0x0F, 0xFF, 0x7E, 0x01, 0x41, 0xFF, 0xC3, 0xE0, 0x00,
-    0x2F, 0xF0, 0x3E, 0x00, 0x03, 0xFF, 0x03, 0xE0, 0x00, 0x3F, 0xD0, 0x3E, 0x00, 0x07, 0xFD, 0x03,
-    0xFA, 0xAA, 0x7F, 0xD0, 0x3F, 0xFF, 0xF7, 0xFD, 0x03, 0xFF, 0xFF, 0x3F, 0xD0, 0x3F, 0xFF, 0xF3,
-    0xFE, 0x03, 0xE2, 0xFF, 0x3F, 0xF0, 0x3E, 0x2F, 0xF2, 0xFF, 0x43, 0xE2, 0xFF, 0x0F, 0xFD, 0x3E,
-    0x2F, 0xF0, 0xBF, 0xFF, 0xFB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x1B, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F, 0x80, 0x00, 0x03, 0xFC,
-    0xFF, 0x00, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE5, 0xFF, 0x95, 0x5B, 0xFD, 0x43, 0xFC, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00,
-    0x3F, 0xD0, 0xFF, 0x80, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x03, 0xFD,
-    0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x07, 0xFA, 0xBF, 0xFC, 0x00, 0x90, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x6A, 0xAA, 0xAF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xD6,
-    0xAB, 0xFF, 0xFE, 0xA0, 0x03, 0xFF, 0xFD, 0x00, 0x57, 0xFF, 0xFD, 0x55, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0x00, 0xFF, 0xE5, 0x6F, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0xFF, 0xE3, 0xE0, 0x90, 0x7F, 0xE0, 0xF8, 0x00, 0x2F, 0xF0, 0x3E, 0x00, 0x0F, 0xF8, 0x0F,
-    0x80, 0x03, 0xFD, 0x03, 0xE0, 0x01, 0xFF, 0x40, 0xF8, 0x00, 0x7F, 0xD0, 0x3E, 0x00, 0x1F, 0xF4,
-    0x0F, 0x80, 0x03, 0xFD, 0x03, 0xE0, 0x00, 0xFF, 0x80, 0xF8, 0x00, 0x3F, 0xF0, 0x3E, 0x00, 0x0B,
-    0xFD, 0x0F, 0x80, 0x00, 0xFF, 0xD3, 0xE0, 0x10, 0x2F, 0xFE, 0xFE, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00,
-    0x01, 0xFC, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1B, 0xFD, 0x5F, 0xFD, 0x54, 0x07, 0xFC,
-    0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B,
-    0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0x07, 0xFC, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x07, 0xFC, 0x07, 0xFE, 0x14, 0x07, 0xFC, 0x03, 0xFF, 0xFD,
-    0x07, 0xFC, 0x02, 0xFF, 0xFD, 0x07, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xEB, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x06, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x68, 0x2E,
-    0x0B, 0x83, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0xBF, 0x1C, 0xFC, 0x3E, 0x0F, 0x2F, 0xC3, 0xFE, 0x0F,
-    0x43, 0xDF, 0xE0, 0x7F, 0xD3, 0xD0, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBE, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2E, 0x0F, 0x97, 0xC0, 0x00, 0x0B, 0x83, 0xD0, 0xF0, 0x00, 0x00, 0x40, 0x10,
-    0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1A, 0xAB, 0xFF, 0xAA, 0x80, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xC1, 0x5B, 0xFF, 0x55, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x56,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x06, 0x00, 0x03, 0xFE, 0xBF, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x01, 0x00, 0xFF, 0xFD, 0x6F, 0x00, 0x43, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE7, 0xFC, 0x00, 0xFF,
-    0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x0F, 0xF8,
-    0x03, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xAF, 0xEA, 0xAA, 0xAB, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC1, 0xC0, 0x80, 0x3C, 0x00, 0x0F, 0xCB, 0xF7,
-    0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0xBC, 0x00, 0x0F, 0xF8, 0x7F, 0x7F, 0xF0, 0x00, 0x0F,
-    0xE0, 0x18, 0x0A, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x61, 0xFF, 0xEA, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xAF, 0xF6, 0xFF, 0xE0, 0x1F, 0xF4, 0x0F, 0xF0, 0x2F, 0xF0,
-    0x3F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF0,
-    0x07, 0xFC, 0x7F, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFC, 0xBF, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC,
-    0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0xFE, 0x40,
-    0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0x07, 0xFC, 0x01,
-    0xFF, 0xC1, 0xFF, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x07, 0xFC, 0x1F, 0xF0, 0x02, 0xFF, 0x07, 0xFC,
-    0x02, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xFA, 0x40, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x50, 0x00, 0x00, 0x00, 0x7C, 0xB8, 0x00,
-    0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xEF, 0x2F, 0xFF, 0xC0, 0x7F, 0xD7, 0xCB, 0x8F, 0xF4,
-    0x3F, 0xF1, 0xF2, 0xE2, 0xFF, 0x0F, 0xF4, 0x7C, 0xB8, 0x7F, 0xC7, 0xFD, 0x1F, 0x2E, 0x0F, 0xF5,
-    0xFF, 0x07, 0xCB, 0x83, 0xFD, 0x7F, 0xC1, 0xE1, 0xD0, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xEA, 0xAA, 0xA0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xD1, 0xD0, 0x00, 0x1E, 0x1D, 0x00, 0x01, 0xE1, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFD,
-    0x07, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xC7, 0xFC, 0x0F, 0xFC, 0x7F, 0xC0, 0x7F, 0xC7, 0xFC,
-    0x07, 0xFC, 0x7F, 0xC0, 0xBF, 0xC7, 0xFE, 0xBF, 0xF8, 0x7F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xC7, 0xFC, 0x0B, 0xFD, 0x7F, 0xC0, 0x3F, 0xE7, 0xFC, 0x03, 0xFE, 0x7F, 0xC0,
-    0x3F, 0xE7, 0xFC, 0x07, 0xFE, 0x7F, 0xEB, 0xFF, 0xD7, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0x40, 0x01, 0xE1, 0xD0, 0x00, 0x1E, 0x1D, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x3F, 0xFD, 0x5B, 0x03,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFF, 0x95, 0xB8, 0x1F,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x86, 0xE0, 0x2F,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_boldBitmaps[40338] = {
+    0x9F, 0x99, 0xFA, 0x0F, 0x90, 0xF9, 0x0F, 0x90, 0xF9, 0x0F, 0x90, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
+    0xAE, 0x1A, 0xE7, 0x69, 0x92, 0xF9, 0x9F, 0xA9, 0xFA, 0x0F, 0x29, 0x91, 0x0F, 0x1F, 0x1F, 0x1F,
+    0x1F, 0x1F, 0x1E, 0xA1, 0xAE, 0x1E, 0xA1, 0xAE, 0x1E, 0xA1, 0xAE, 0x1A, 0xD9, 0x1A, 0xDA, 0x19,
+    0xAA, 0x91, 0x9A, 0xA9, 0x00, 0x6D, 0xA2, 0xDA, 0x70, 0x9E, 0x19, 0xDA, 0x70, 0xAD, 0xA1, 0xAD,
+    0x97, 0x0A, 0xD9, 0x1E, 0x97, 0x0E, 0x2E, 0x71, 0xE2, 0xE4, 0x9F, 0xFF, 0xF1, 0x9F, 0xFF, 0xF1,
+    0x9F, 0xFF, 0xF5, 0xE2, 0xE7, 0x1E, 0x2E, 0x70, 0x9E, 0x19, 0xDA, 0x49, 0xAA, 0xAF, 0xAA, 0xFA,
+    0xAA, 0x19, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0x49, 0xE9, 0x09, 0xE7, 0x1E, 0x19, 0xE7, 0x09, 0xDA,
+    0x1A, 0xDA, 0x70, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x91, 0xE7, 0x1E, 0x2E, 0x60, 0x77, 0x4A, 0xC9,
+    0x73, 0xAC, 0x97, 0x09, 0xAF, 0xDA, 0x93, 0xFF, 0xF1, 0xFF, 0xFC, 0x09, 0xFE, 0xAA, 0xE9, 0x0A,
+    0xEA, 0x0A, 0xC9, 0x29, 0x1A, 0xEA, 0x0A, 0xC9, 0x5A, 0xFA, 0xAC, 0x96, 0xFE, 0x96, 0x9F, 0xF9,
+    0x6F, 0xFC, 0x95, 0x9A, 0xFE, 0x96, 0xAF, 0xE6, 0xAC, 0x99, 0xF9, 0x5A, 0xC9, 0x0F, 0xAA, 0xA9,
+    0x2A, 0xC9, 0x0F, 0x9A, 0xFA, 0xFF, 0x0A, 0xFF, 0xF9, 0x0A, 0xFF, 0xE9, 0x39, 0xAA, 0xFA, 0x97,
+    0x1A, 0xC9, 0x73, 0xAC, 0x97, 0x39, 0xA6, 0x77, 0x74, 0xAF, 0x97, 0xE9, 0x6F, 0xE9, 0x5A, 0xE6,
+    0x9F, 0xF5, 0xE9, 0x6F, 0x1E, 0x93, 0xAE, 0x7E, 0x91, 0xEA, 0x3E, 0x70, 0xE9, 0x1A, 0xE2, 0xEA,
+    0x70, 0xE9, 0x1A, 0xE1, 0x9E, 0x71, 0xE9, 0x1A, 0xDA, 0x1E, 0xA7, 0x1E, 0x91, 0xEA, 0x09, 0xE1,
+    0x9A, 0xCA, 0x93, 0xAE, 0x1E, 0x90, 0xE9, 0x0F, 0xDA, 0x29, 0xFF, 0x0A, 0xE0, 0xAF, 0xE9, 0x2A,
+    0xFD, 0x90, 0xE9, 0x0E, 0xA0, 0xAE, 0x39, 0xEA, 0x1A, 0xE0, 0x9E, 0x2E, 0x72, 0xE1, 0x9E, 0x2E,
+    0x97, 0x0E, 0xA1, 0x9E, 0x2E, 0x97, 0x9E, 0x29, 0xE2, 0xE9, 0x7E, 0xA2, 0x9E, 0x2E, 0x96, 0x9E,
+    0x4E, 0x90, 0x9E, 0x7E, 0x94, 0xFA, 0xF6, 0xAE, 0x6F, 0xE7, 0xE9, 0x69, 0xFC, 0x97, 0x75, 0x94,
+    0x77, 0x70, 0x9F, 0xD9, 0x73, 0xAF, 0xFA, 0x71, 0x9F, 0xFD, 0x97, 0x0F, 0xA9, 0x9F, 0xC7, 0x0F,
+    0x3F, 0x70, 0xF2, 0x9F, 0x70, 0xF9, 0x1F, 0x97, 0x09, 0xF9, 0xFC, 0x72, 0xFF, 0xC7, 0x39, 0xFD,
+    0xA7, 0x3A, 0xFE, 0x4A, 0xF1, 0xAF, 0xFC, 0x3F, 0x91, 0xFC, 0x9F, 0xC1, 0x9F, 0x1A, 0xF2, 0xFC,
+    0x0F, 0xA1, 0xFC, 0x3F, 0xFC, 0x2F, 0xC4, 0xFE, 0xA2, 0xAF, 0x94, 0xFD, 0x39, 0xFC, 0xA9, 0x9A,
+    0xFE, 0x93, 0xFF, 0xFF, 0xC9, 0x3F, 0xFE, 0xAF, 0xC9, 0x39, 0xFE, 0xA2, 0xFC, 0x96, 0x99, 0x73,
+    0x0F, 0x0F, 0x0F, 0x0E, 0xA0, 0xEA, 0x0E, 0xA0, 0xAD, 0x90, 0x9A, 0xA9, 0x3A, 0xDA, 0x3A, 0xE4,
+    0xEA, 0x3A, 0xE4, 0xEA, 0x3A, 0xE4, 0xF4, 0xEA, 0x39, 0xE9, 0x3A, 0xE4, 0xAE, 0x4F, 0x4F, 0x4F,
+    0x4F, 0x4A, 0xE4, 0xAE, 0x49, 0xE9, 0x4E, 0xA4, 0xF4, 0xAE, 0x94, 0xEA, 0x4A, 0xE5, 0xEA, 0x49,
+    0xE9, 0x49, 0xAA, 0x90, 0x0A, 0xDA, 0x5E, 0x94, 0xAE, 0x5E, 0xA4, 0xAE, 0x49, 0xE9, 0x4F, 0x4F,
+    0x4A, 0xE9, 0x39, 0xE9, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x4E, 0xA4, 0xEA, 0x39, 0xE9, 0x3A,
+    0xE9, 0x3F, 0x4F, 0x39, 0xE9, 0x3F, 0x4E, 0xA3, 0xF3, 0x9E, 0x93, 0xAA, 0xA9, 0x30, 0x77, 0x4E,
+    0xA7, 0x2E, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x95, 0xAD, 0xA0, 0x9D, 0x99, 0xAD, 0xA0, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFD, 0x19, 0x99, 0xFC, 0xA9, 0x99, 0x5F, 0xD7, 0xEA, 0xEA, 0x5A, 0xE0, 0x9E, 0x94,
+    0xF1, 0xF4, 0x9D, 0x91, 0x9C, 0xA7, 0x97, 0x00, 0x59, 0x99, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E,
+    0x73, 0xE5, 0xAF, 0xFF, 0xC9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0xE9, 0x99, 0x99,
+    0x6E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3D, 0xA5, 0x19, 0x99, 0x92, 0xF9, 0x1F, 0x2E, 0xA1, 0x9E,
+    0x91, 0xAE, 0x2E, 0xA2, 0xE2, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0x90, 0xFE, 0x90, 0xFE, 0x90,
+    0x19, 0x92, 0xF9, 0x9F, 0xA9, 0xFA, 0x0F, 0x29, 0x91, 0x7F, 0x6A, 0xE9, 0x6F, 0x69, 0xEA, 0x6A,
+    0xE9, 0x6F, 0x69, 0xEA, 0x6F, 0x7F, 0x6A, 0xE9, 0x6F, 0x69, 0xEA, 0x6A, 0xE9, 0x6F, 0x69, 0xEA,
+    0x6A, 0xE9, 0x6F, 0x69, 0xEA, 0x6F, 0x7F, 0x6A, 0xE9, 0x77, 0x20, 0x77, 0x2A, 0xFC, 0x95, 0x9F,
+    0xFC, 0x4F, 0xFD, 0xA2, 0xAF, 0xA9, 0xFC, 0x91, 0xF9, 0x2F, 0xA0, 0x9F, 0x39, 0xF0, 0xAE, 0xA4,
+    0xF0, 0xFA, 0x4F, 0x9F, 0x94, 0xFA, 0xF9, 0x4F, 0xAF, 0x94, 0xFA, 0xF9, 0x4F, 0xAF, 0x94, 0xFA,
+    0xFA, 0x4F, 0x9A, 0xEA, 0x4F, 0x99, 0xF3, 0x9F, 0x1F, 0x92, 0xAF, 0x1A, 0xF9, 0x9A, 0xF9, 0x2F,
+    0xFE, 0x39, 0xFF, 0xC6, 0xFD, 0xA7, 0x19, 0x96, 0x6F, 0x59, 0xFC, 0x49, 0xFD, 0x3A, 0xFE, 0x2F,
+    0xFC, 0x1F, 0xC9, 0xF1, 0x9E, 0x09, 0xF2, 0xAA, 0x19, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6,
+    0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x00, 0x77, 0x19,
+    0xAF, 0xCA, 0x49, 0xFF, 0xD9, 0x19, 0xFF, 0xF1, 0x9F, 0xCA, 0xAF, 0xD1, 0xAD, 0x93, 0xAF, 0x29,
+    0x59, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x0A, 0xF7, 0x0A, 0xF9, 0x7A, 0xF9, 0x79, 0xF9,
+    0x79, 0xF9, 0x79, 0xF9, 0x79, 0xF9, 0x79, 0xF9, 0x79, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0x77, 0x09, 0xAF, 0xDA, 0x39, 0xFF, 0xE9, 0x19, 0xFF, 0xF9,
+    0x1F, 0xA9, 0xAF, 0xCA, 0x2A, 0x5F, 0xC7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF4, 0x99, 0x99, 0xAF,
+    0x94, 0xAF, 0xDA, 0x6A, 0xFD, 0xA9, 0x5A, 0xFF, 0xC7, 0x1A, 0xFC, 0x71, 0x9F, 0x97, 0x1F, 0x97,
+    0x1F, 0x99, 0x7A, 0xF9, 0xDA, 0x99, 0x19, 0xAF, 0xC0, 0xFF, 0xFC, 0x90, 0xFF, 0xF9, 0x19, 0xAF,
+    0xFA, 0x70, 0x99, 0x70, 0x70, 0xAE, 0xA7, 0x29, 0xFA, 0x72, 0xFC, 0xA7, 0x1A, 0xFC, 0xA7, 0x09,
+    0xFD, 0xA7, 0x0F, 0xEA, 0x7A, 0xEA, 0xEA, 0x69, 0xE0, 0xAE, 0xA6, 0xEA, 0x0A, 0xEA, 0x5A, 0xE1,
+    0xAE, 0xA4, 0x9E, 0x2A, 0xEA, 0x4E, 0xA2, 0xAE, 0xA3, 0xAE, 0x3A, 0xEA, 0x29, 0xFA, 0xAA, 0xAF,
+    0xCA, 0xA0, 0xAF, 0xFF, 0xE0, 0xAF, 0xFF, 0xE0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0xA7, 0x1A,
+    0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xAE, 0xA2, 0x09, 0xFF, 0xE2, 0x9F, 0xFE, 0x2A, 0xFF,
+    0xE2, 0xAF, 0xFE, 0x2A, 0xE9, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0x19, 0x96, 0xFF, 0xD9, 0x3F, 0xFE,
+    0xA2, 0xFF, 0xF9, 0x2A, 0xA9, 0x99, 0x9F, 0xD7, 0x1A, 0xF7, 0x2F, 0x97, 0x1F, 0x97, 0x1F, 0x09,
+    0x7A, 0xF0, 0xAD, 0xA9, 0x99, 0x9F, 0xCA, 0x0A, 0xFF, 0xF1, 0xAF, 0xFE, 0x3A, 0xFF, 0x97, 0x09,
+    0x97, 0x77, 0x4A, 0xFD, 0x5A, 0xFF, 0x93, 0xFF, 0xD9, 0x2F, 0xDA, 0x99, 0x9A, 0x29, 0xF9, 0x70,
+    0xF9, 0x71, 0xF7, 0x19, 0xE9, 0x19, 0xA9, 0x93, 0xAE, 0x0A, 0xFD, 0x91, 0xFA, 0xFF, 0x90, 0xFF,
+    0xFD, 0x0F, 0xCA, 0x2A, 0xF9, 0xFA, 0x4F, 0xAF, 0x94, 0xAE, 0xAF, 0x94, 0xAE, 0xAA, 0xEA, 0x4A,
+    0xEA, 0x9F, 0x93, 0xF9, 0x0F, 0xC9, 0x99, 0xFC, 0x2F, 0xFE, 0xA2, 0x9F, 0xFC, 0xA5, 0xAF, 0xD9,
+    0x71, 0x99, 0x50, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xD9, 0x72,
+    0xF7, 0x2A, 0xEA, 0x72, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72,
+    0xFA, 0x71, 0x9F, 0x72, 0xFA, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xF9, 0x71, 0xAF, 0x72, 0xF9, 0x71,
+    0xAF, 0x70, 0x77, 0x19, 0xAF, 0xCA, 0x5A, 0xFF, 0xC9, 0x2A, 0xFF, 0xE9, 0x1F, 0xA1, 0x9F, 0xC0,
+    0x9F, 0x39, 0xF0, 0x9F, 0x4F, 0x1F, 0x3A, 0xEA, 0x1A, 0xF9, 0x0A, 0xF9, 0x2F, 0xFD, 0x94, 0xAF,
+    0xE9, 0x5A, 0xFE, 0x94, 0xFF, 0xDA, 0x2F, 0xC9, 0x0A, 0xFA, 0x0A, 0xF3, 0xAF, 0x0F, 0x94, 0xAE,
+    0xAF, 0x59, 0xEA, 0xF9, 0x4A, 0xEA, 0xAF, 0x92, 0xAF, 0x90, 0xFF, 0xFC, 0x19, 0xFF, 0xE4, 0xAF,
+    0xE9, 0x70, 0x99, 0x60, 0x77, 0x39, 0xAF, 0xA9, 0x6A, 0xFF, 0xA4, 0xAF, 0xFD, 0xA2, 0x9F, 0xCA,
+    0xAF, 0xC9, 0x1A, 0xF3, 0xAF, 0x1F, 0x94, 0xF1, 0xF5, 0xF9, 0x0F, 0x5F, 0xA0, 0xF9, 0x4F, 0xA0,
+    0xFC, 0x3A, 0xFA, 0x09, 0xFC, 0xAA, 0xFD, 0xA1, 0xFF, 0xFC, 0xA2, 0xFE, 0x9A, 0xE9, 0x39, 0xAC,
+    0xAA, 0x1A, 0xE7, 0x3F, 0x72, 0x9E, 0xA7, 0x19, 0xF4, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFD, 0x4A,
+    0xFF, 0xA5, 0xAF, 0xDA, 0x71, 0x99, 0x71, 0x6F, 0x09, 0xFA, 0x9F, 0xA0, 0xF9, 0x1A, 0xA9, 0x77,
+    0x77, 0x69, 0x92, 0xF9, 0x9F, 0xA9, 0xFA, 0x0F, 0x29, 0x91, 0x70, 0xAE, 0x19, 0xFA, 0x09, 0xFA,
+    0x1F, 0x92, 0xAA, 0x97, 0x77, 0x77, 0x73, 0x99, 0x99, 0x2F, 0x91, 0xF2, 0xEA, 0x19, 0xE9, 0x1A,
+    0xE2, 0xEA, 0x2E, 0x20, 0x77, 0x72, 0x9C, 0x97, 0x19, 0xE9, 0x79, 0xFC, 0x95, 0x9F, 0xDA, 0x49,
+    0xFD, 0xA4, 0x9F, 0xD9, 0x49, 0xFD, 0x96, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x09, 0xFD, 0xA9, 0x79,
+    0xAF, 0xD9, 0x70, 0xAF, 0xDA, 0x70, 0xAF, 0xC9, 0x71, 0x9E, 0x97, 0x39, 0xA9, 0x76, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xD9, 0xFF, 0xFD, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x77, 0x6F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x76, 0x76, 0xAA, 0x74, 0xEA,
+    0x72, 0xFC, 0xA7, 0x09, 0xFD, 0xA7, 0x1A, 0xFC, 0xA7, 0x1A, 0xFC, 0xA7, 0x1A, 0xFC, 0xA7, 0x1A,
+    0xF9, 0x69, 0xAF, 0xC9, 0x49, 0xFD, 0xA9, 0x3A, 0xFD, 0xA3, 0x9F, 0xE9, 0x5F, 0xD9, 0x7E, 0xA7,
+    0x2A, 0xA7, 0x77, 0x30, 0x77, 0x9A, 0xFD, 0x92, 0x9F, 0xFE, 0x19, 0xFF, 0xEA, 0x1E, 0xAA, 0x9A,
+    0xFC, 0x19, 0x95, 0xF9, 0x70, 0xF9, 0x70, 0xF7, 0x0F, 0xC7, 0xFC, 0x69, 0xFC, 0x7F, 0xC7, 0xAE,
+    0xA7, 0x0F, 0x71, 0xEA, 0x77, 0x77, 0x69, 0x97, 0x2F, 0x70, 0x9F, 0xA7, 0x9F, 0x97, 0x0F, 0x72,
+    0x99, 0x60, 0x79, 0xAF, 0xCA, 0xA7, 0x49, 0xFF, 0xF7, 0x1F, 0xEA, 0xAF, 0xD9, 0x6F, 0xA6, 0x9F,
+    0x94, 0xF7, 0x2A, 0xE3, 0xAE, 0x39, 0x9A, 0xAA, 0x92, 0xAE, 0x19, 0xE3, 0xFF, 0xA1, 0xE1, 0xAD,
+    0xA1, 0x9F, 0xFC, 0xA1, 0xAD, 0x90, 0xE2, 0xF9, 0x1A, 0xDA, 0x19, 0xDA, 0x9E, 0x19, 0xE3, 0xAD,
+    0xA1, 0x9E, 0x9D, 0xA1, 0xAD, 0xA3, 0xAD, 0xA1, 0x9E, 0xAD, 0xA1, 0xE9, 0x3E, 0xA1, 0x9E, 0xAD,
+    0xA1, 0xE9, 0x3E, 0x91, 0x9D, 0xAA, 0xDA, 0x1E, 0xA3, 0xE9, 0x1E, 0x99, 0xDA, 0x1A, 0xE2, 0xAE,
+    0xA0, 0x9E, 0x09, 0xE2, 0xFF, 0xFE, 0x91, 0xE9, 0x19, 0xFD, 0x90, 0xFC, 0xA2, 0xAE, 0x3A, 0xAA,
+    0xA3, 0xAA, 0xA9, 0x4E, 0xA7, 0x73, 0x9F, 0x71, 0x99, 0x7A, 0xFC, 0xA9, 0x99, 0x9A, 0xEA, 0x70,
+    0x9F, 0xFF, 0xCA, 0x72, 0x9A, 0xFF, 0xC9, 0x77, 0x99, 0x99, 0x71, 0x6F, 0xD7, 0x6F, 0xD9, 0x74,
+    0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71, 0x9F,
+    0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6, 0xFC,
+    0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F, 0xA2,
+    0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x9F, 0xFA,
+    0xA9, 0x3A, 0xFF, 0xFA, 0x1A, 0xFF, 0xFC, 0xA0, 0xAF, 0xAA, 0xAA, 0xFD, 0x0A, 0xF4, 0xAF, 0x9A,
+    0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF4, 0xAF, 0x0A, 0xF9, 0x99, 0xAF, 0xC9, 0x0A, 0xFF, 0xEA, 0x2A,
+    0xFF, 0xEA, 0x91, 0xAF, 0xFF, 0xCA, 0x0A, 0xF4, 0xAF, 0x9A, 0xF5, 0xFC, 0xAF, 0x5A, 0xFA, 0xF5,
+    0xFC, 0xAF, 0x49, 0xFA, 0xAF, 0xAA, 0xAA, 0xFD, 0x9A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFA, 0x1A, 0xFF,
+    0xDA, 0x30, 0x77, 0x69, 0xAF, 0xDA, 0x94, 0x9F, 0xFE, 0xA2, 0x9F, 0xFF, 0x91, 0x9F, 0xDA, 0xAA,
+    0xF2, 0xFC, 0xA5, 0x99, 0x19, 0xFA, 0x72, 0xFC, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x97, 0x29,
+    0xF7, 0x39, 0xF9, 0x72, 0x9F, 0x97, 0x3F, 0xA7, 0x3F, 0xC7, 0x3A, 0xF9, 0x73, 0xFC, 0x96, 0x92,
+    0xAF, 0xDA, 0x99, 0xAE, 0x3F, 0xFF, 0xC4, 0xAF, 0xFE, 0x59, 0xAF, 0xF9, 0x71, 0x99, 0x94, 0x9F,
+    0xFA, 0xA9, 0x5A, 0xFF, 0xF9, 0x3A, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xDA, 0x1A, 0xF4, 0xAF, 0xC9,
+    0x0A, 0xF5, 0x9F, 0xC0, 0xAF, 0x6A, 0xF9, 0xAF, 0x69, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFC, 0xAF,
+    0x7F, 0xCA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF6, 0x9F, 0x9A, 0xF6, 0xAF, 0x0A, 0xF5, 0x9F, 0xC0,
+    0xAF, 0x4A, 0xFC, 0x90, 0xAF, 0xAA, 0xAF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0x93, 0xAF,
+    0xFC, 0xA9, 0x50, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7,
+    0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09,
+    0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF,
+    0xEA, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79,
+    0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09,
+    0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x70, 0x77, 0x70, 0xAF, 0xEA,
+    0x95, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x3F, 0xEA, 0xAA, 0xF2, 0xFD, 0x95, 0x99, 0x19, 0xFC, 0x73,
+    0xAF, 0x74, 0xFC, 0x74, 0xF9, 0x73, 0x9F, 0x92, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xF9, 0x29, 0xFF,
+    0x9F, 0x92, 0x9F, 0xF0, 0xF9, 0x29, 0xFF, 0x0F, 0xA6, 0xAF, 0x0F, 0xC6, 0xAF, 0x0A, 0xF9, 0x5A,
+    0xF1, 0xFC, 0x94, 0xAF, 0x1A, 0xFD, 0xA9, 0x9A, 0xFC, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xC4, 0x9A,
+    0xFF, 0xA9, 0x71, 0x99, 0x95, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A,
+    0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0x7A, 0xEA, 0x9F,
+    0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A,
+    0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F,
+    0xCA, 0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF,
+    0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x49, 0xF5,
+    0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F,
+    0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0x9F, 0x59, 0xF5, 0xAF, 0x5F,
+    0xA1, 0xAA, 0xAF, 0xC9, 0x1F, 0xF2, 0xFE, 0x3F, 0xCA, 0x76, 0x9F, 0x6A, 0xF0, 0x9F, 0x5A, 0xF9,
+    0x09, 0xF4, 0x9F, 0x91, 0x9F, 0x39, 0xFA, 0x29, 0xF3, 0xFC, 0x39, 0xF2, 0xFC, 0x49, 0xF1, 0xAF,
+    0x94, 0x9F, 0x09, 0xFA, 0x59, 0xF0, 0xFA, 0x69, 0xFF, 0xC7, 0x9F, 0xFC, 0xA6, 0x9F, 0xFD, 0x95,
+    0x9F, 0xCA, 0xFC, 0x59, 0xF9, 0x09, 0xFA, 0x49, 0xF2, 0xAF, 0x93, 0x9F, 0x3F, 0xC3, 0x9F, 0x39,
+    0xFA, 0x29, 0xF4, 0xFC, 0x29, 0xF5, 0xFC, 0x19, 0xF5, 0xAF, 0x90, 0x9F, 0x6F, 0xC0, 0x9F, 0x70,
+    0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70,
+    0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70,
+    0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0x9F, 0xCA, 0x71,
+    0xFC, 0xA9, 0xFD, 0x70, 0xAF, 0xD9, 0xFD, 0x97, 0xFE, 0x9F, 0xDA, 0x7F, 0xE9, 0xFE, 0x6A, 0xFE,
+    0x9E, 0xAE, 0x95, 0xEA, 0xF9, 0xE9, 0xEA, 0x5E, 0x9F, 0x9E, 0x9A, 0xE4, 0xAE, 0x0F, 0x9E, 0x99,
+    0xE4, 0xEA, 0x0F, 0x9E, 0xA0, 0xEA, 0x3E, 0x90, 0xF9, 0xEA, 0x0F, 0x2A, 0xE1, 0xF9, 0xEA, 0x09,
+    0xE2, 0xEA, 0x1F, 0x9E, 0xA1, 0xE9, 0x1E, 0x91, 0xF9, 0xEA, 0x1F, 0x09, 0xE2, 0xF9, 0xEA, 0x1A,
+    0xE0, 0xEA, 0x2F, 0x9E, 0xA1, 0x9E, 0xAE, 0x92, 0xF9, 0xEA, 0x2F, 0xE3, 0xF9, 0xEA, 0x2A, 0xFC,
+    0xA3, 0xF9, 0xEA, 0x29, 0xFC, 0x93, 0xF9, 0xEA, 0x3F, 0xC4, 0xF9, 0xEA, 0x3A, 0xEA, 0x4F, 0x9F,
+    0xC9, 0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xDA, 0x6F, 0x09, 0xFE, 0x6F, 0x09, 0xFE, 0xA5, 0xF0,
+    0x9F, 0xF9, 0x4F, 0x09, 0xE9, 0xFC, 0x4F, 0x09, 0xE9, 0x9F, 0x93, 0xF0, 0x9E, 0x90, 0xAF, 0x3F,
+    0x09, 0xEA, 0x1F, 0xA2, 0xF0, 0x9E, 0xA1, 0xAF, 0x2F, 0x09, 0xEA, 0x2F, 0xC1, 0xF0, 0x9E, 0xA2,
+    0x9F, 0x90, 0xF0, 0x9E, 0xA3, 0xFC, 0x0F, 0x09, 0xEA, 0x39, 0xF9, 0xAE, 0x09, 0xEA, 0x4A, 0xFF,
+    0x09, 0xEA, 0x5F, 0xF0, 0x9E, 0xA5, 0xAF, 0xE0, 0x9E, 0xA6, 0xFE, 0x09, 0xEA, 0x69, 0xFD, 0x09,
+    0xEA, 0x7F, 0xD0, 0x77, 0x72, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA,
+    0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7,
+    0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97,
+    0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69,
+    0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7,
+    0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x9F, 0xFA, 0x93, 0xAF, 0xFE, 0x91, 0xAF, 0xFF, 0xA0,
+    0xAF, 0xFF, 0xC0, 0xAF, 0x3A, 0xFA, 0xAF, 0x4F, 0xCA, 0xF4, 0xAF, 0xAF, 0x4A, 0xFA, 0xF4, 0xFA,
+    0xAF, 0x29, 0xFC, 0x9A, 0xFF, 0xFC, 0x0A, 0xFF, 0xF1, 0xAF, 0xFD, 0xA2, 0xAF, 0xAA, 0xAA, 0x94,
+    0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0x77, 0x72,
+    0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94,
+    0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC,
+    0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xFA, 0x75, 0x99,
+    0xFC, 0x97, 0x7F, 0xC9, 0x76, 0x9F, 0xC7, 0x7A, 0xFC, 0x77, 0xAF, 0xC0, 0x9F, 0xEA, 0xA9, 0x6A,
+    0xFF, 0xEA, 0x4A, 0xFF, 0xFC, 0x3A, 0xFA, 0xAA, 0xFD, 0x92, 0xAF, 0x39, 0xFC, 0x2A, 0xF4, 0xAF,
+    0x2A, 0xF4, 0xAF, 0x2A, 0xF4, 0xAF, 0x2A, 0xF4, 0xFA, 0x2A, 0xF9, 0x99, 0xAF, 0xC3, 0xAF, 0xFF,
+    0x93, 0xAF, 0xFD, 0xA5, 0xAF, 0xFD, 0xA5, 0xAF, 0x19, 0xF9, 0x4A, 0xF2, 0xAF, 0x4A, 0xF3, 0xFA,
+    0x3A, 0xF3, 0xAF, 0x92, 0xAF, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x1A, 0xF5, 0xFC, 0x1A, 0xF6, 0xFC,
+    0x00, 0x77, 0x1A, 0xFD, 0xA3, 0xAF, 0xFD, 0xA0, 0x9F, 0xFE, 0x90, 0xFC, 0xAA, 0xAF, 0x09, 0xF9,
+    0x49, 0x90, 0x9F, 0x70, 0x9F, 0x71, 0xFC, 0x70, 0xFD, 0xA7, 0xFE, 0xA6, 0xFF, 0x95, 0x9F, 0xEA,
+    0x69, 0xFD, 0x97, 0xAF, 0xA7, 0x0A, 0xF7, 0x09, 0xFA, 0xA6, 0xAF, 0xAE, 0xA9, 0x99, 0xFC, 0x9A,
+    0xFF, 0xF0, 0xAF, 0xFE, 0x2A, 0xFF, 0x97, 0x99, 0x60, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F,
+    0xFF, 0xE9, 0x9F, 0xFF, 0xE6, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x50, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59,
+    0xF9, 0x0F, 0xC5, 0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF,
+    0x97, 0x39, 0x97, 0xAE, 0x97, 0x0A, 0xEA, 0xAF, 0x70, 0xFA, 0x0F, 0x70, 0xF1, 0xFA, 0x6A, 0xF1,
+    0xAF, 0x6F, 0x92, 0xF6, 0xF3, 0xF9, 0x4A, 0xF3, 0xAF, 0x4F, 0x94, 0xF4, 0xF5, 0xF9, 0x29, 0xF5,
+    0xAE, 0xA2, 0xF9, 0x6F, 0x2F, 0x7F, 0x90, 0x9F, 0x79, 0xEA, 0x0A, 0xE9, 0x70, 0xF0, 0xF7, 0x1F,
+    0x9F, 0x71, 0x9F, 0xE9, 0x72, 0xFE, 0x73, 0xFD, 0xA7, 0x39, 0xFC, 0x97, 0x4F, 0xC6, 0xAE, 0x96,
+    0xF7, 0xF0, 0xAE, 0xA5, 0x9F, 0xA5, 0x9F, 0x09, 0xF5, 0xAF, 0xC5, 0xAE, 0xA1, 0xF5, 0xFD, 0x5F,
+    0x91, 0xF9, 0x4F, 0xD9, 0x4F, 0x2A, 0xEA, 0x39, 0xFD, 0xA3, 0x9F, 0x29, 0xF3, 0xAE, 0xAE, 0x3A,
+    0xEA, 0x3F, 0x3E, 0xAA, 0xE3, 0xF9, 0x3F, 0x92, 0xE9, 0x9E, 0x92, 0xF4, 0xAE, 0xA1, 0x9E, 0x90,
+    0xEA, 0x19, 0xF4, 0x9F, 0x1A, 0xE1, 0xF1, 0xAE, 0xA5, 0xF1, 0xF1, 0xAE, 0x1F, 0x95, 0xF1, 0xEA,
+    0x19, 0xE9, 0x0F, 0x6A, 0xE9, 0x9E, 0x92, 0xEA, 0x0F, 0x69, 0xEA, 0xAE, 0x3F, 0x9E, 0xA7, 0xFE,
+    0xA3, 0xAE, 0xAE, 0x97, 0xFE, 0x93, 0x9F, 0xE7, 0x0A, 0xFD, 0x5F, 0xE7, 0x09, 0xFD, 0x5F, 0xDA,
+    0x71, 0xFC, 0xA5, 0xAF, 0xC9, 0x71, 0xFC, 0x95, 0x9F, 0xC5, 0x0F, 0xA6, 0x9F, 0xA1, 0xAF, 0x95,
+    0xFC, 0x3F, 0xC4, 0x9F, 0x93, 0x9F, 0x93, 0xFC, 0x5A, 0xF2, 0xAF, 0x7F, 0xA1, 0xFA, 0x79, 0xF9,
+    0xFC, 0x71, 0xFF, 0xC9, 0x72, 0xFE, 0xA7, 0x39, 0xFD, 0x75, 0xFC, 0xA7, 0x4F, 0xE7, 0x39, 0xFE,
+    0xA7, 0x2F, 0xFC, 0x97, 0x0A, 0xF0, 0xAF, 0x79, 0xF9, 0x1F, 0xA6, 0xFC, 0x29, 0xF9, 0x4A, 0xF4,
+    0xFC, 0x39, 0xFA, 0x5F, 0xA2, 0xFC, 0x6A, 0xF9, 0x0A, 0xF9, 0x7F, 0xC0, 0xAF, 0x7A, 0xF0, 0x9F,
+    0xA6, 0xFA, 0x1F, 0xC5, 0xAF, 0x3F, 0x94, 0xF9, 0x3A, 0xF3, 0xAF, 0x5F, 0x92, 0xF9, 0x5A, 0xF1,
+    0xAF, 0x7F, 0x90, 0xF9, 0x7A, 0xFA, 0xF7, 0x1F, 0xF7, 0x29, 0xFD, 0xA7, 0x3F, 0xD7, 0x49, 0xFA,
+    0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9,
+    0x60, 0x0F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFD, 0xA7, 0x2F, 0xC7, 0x2A, 0xF7,
+    0x3F, 0xA7, 0x2F, 0xC7, 0x2A, 0xF7, 0x29, 0xF9, 0x72, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F,
+    0xA7, 0x2F, 0xC7, 0x29, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC2, 0xF2, 0xF2, 0xF2, 0xF2,
+    0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF9, 0x99,
+    0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xA0, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE, 0x97, 0xF7, 0xF7, 0x9E,
+    0xA7, 0xF7, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE, 0x97, 0xEA, 0x7F, 0x7A, 0xE9, 0x7F, 0x7F, 0x79,
+    0xEA, 0x7F, 0x7A, 0xE9, 0x69, 0xEA, 0x73, 0x0F, 0xDA, 0x9F, 0xDA, 0x9F, 0xDA, 0x29, 0xEA, 0x3E,
+    0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3,
+    0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x09, 0x99, 0xEA, 0x9F, 0xDA, 0x9F,
+    0xDA, 0x0A, 0xAA, 0xAA, 0xA9, 0x59, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAF, 0xC7, 0x2F, 0xD9, 0x70,
+    0xAD, 0xA9, 0xE7, 0x0E, 0x1E, 0x96, 0xAD, 0xA1, 0x9E, 0x6E, 0x3E, 0x94, 0x9E, 0x39, 0xE4, 0xE9,
+    0x4E, 0x92, 0x9E, 0x59, 0xE2, 0xEA, 0x6E, 0x91, 0xAA, 0xA7, 0x9A, 0xAA, 0x00, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x99, 0x93,
+    0x9F, 0xA4, 0xF9, 0x4F, 0x94, 0xAE, 0x69, 0x90, 0x77, 0x1A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE,
+    0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF,
+    0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9,
+    0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x70, 0x77, 0xFA, 0x72, 0xFA, 0x72, 0xFA,
+    0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x0A, 0xFA, 0x3F, 0xAF, 0xF2, 0xFF, 0xFD, 0x1F,
+    0xD9, 0x99, 0xFC, 0x90, 0xFC, 0x4F, 0xA0, 0xFC, 0x4A, 0xF0, 0xFA, 0x4A, 0xF0, 0xFA, 0x49, 0xF0,
+    0xFA, 0x49, 0xF0, 0xFA, 0x4A, 0xF0, 0xFC, 0x4A, 0xF0, 0xFC, 0x4F, 0xA0, 0xFD, 0x99, 0x9F, 0xC9,
+    0x0F, 0xFF, 0xD1, 0xF9, 0xFF, 0x2E, 0xA1, 0xFC, 0xA7, 0x39, 0x95, 0x77, 0x19, 0xFE, 0x93, 0xFF,
+    0xD2, 0xFF, 0xDA, 0x1A, 0xFC, 0x99, 0x9A, 0xC2, 0xFC, 0x79, 0xF9, 0x7A, 0xF7, 0x0A, 0xF7, 0x0A,
+    0xF7, 0x0A, 0xF7, 0x09, 0xF7, 0x1F, 0xA7, 0x0F, 0xD9, 0x99, 0xAD, 0x2F, 0xFE, 0x29, 0xFF, 0xD4,
+    0xAF, 0xDA, 0x70, 0x99, 0x40, 0x77, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9,
+    0x72, 0xF9, 0x29, 0xFC, 0x90, 0xF9, 0x1A, 0xFE, 0x9F, 0x90, 0x9F, 0xFF, 0xC9, 0x0F, 0xCA, 0x99,
+    0xAF, 0xC9, 0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A,
+    0xF5, 0xF9, 0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x99, 0xAF, 0xC9, 0x09, 0xFF, 0xFC,
+    0x91, 0xAF, 0xE9, 0xAE, 0x92, 0xAF, 0xC9, 0x09, 0xE9, 0x59, 0x70, 0x77, 0x3A, 0xFD, 0x96, 0xFF,
+    0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A,
+    0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF,
+    0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50, 0x79, 0x97, 0xFE, 0x93, 0xFF, 0x3A, 0xFF, 0x3F,
+    0xC1, 0x99, 0x3F, 0x97, 0xF9, 0x6A, 0xFF, 0x19, 0xFF, 0xD1, 0x9F, 0xFD, 0x29, 0x9F, 0xA9, 0x99,
+    0x4F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F,
+    0x97, 0xF9, 0x40, 0x77, 0x29, 0xFC, 0x90, 0x9E, 0x91, 0xAF, 0xEA, 0xAE, 0x90, 0x9F, 0xFF, 0xC9,
+    0x0F, 0xCA, 0x99, 0xAF, 0xC9, 0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9,
+    0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x19, 0xFC, 0x90,
+    0x9F, 0xFF, 0xC9, 0x1A, 0xFE, 0xAF, 0x92, 0xAF, 0xC9, 0x0F, 0x95, 0x93, 0xF9, 0x71, 0x9F, 0x19,
+    0x7F, 0xC1, 0xAD, 0xAA, 0x99, 0xAF, 0xCA, 0x1A, 0xFF, 0xF2, 0xAF, 0xFE, 0x49, 0xAF, 0xDA, 0x93,
+    0x76, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xF9, 0x0A, 0xFC,
+    0x91, 0xF9, 0xFF, 0xA0, 0xFF, 0xFD, 0x9F, 0xDA, 0x99, 0xFC, 0xAF, 0xC9, 0x3F, 0xFD, 0x4A, 0xFF,
+    0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4,
+    0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xF0, 0x6A, 0xE9, 0x0F, 0xA0, 0xFA, 0x09, 0xE7,
+    0x5F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F,
+    0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x74, 0xAE, 0x93, 0xFA, 0x3F, 0xA3, 0x9E, 0x77,
+    0x6F, 0x93, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F,
+    0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0x99, 0xAA, 0xFC, 0x9A,
+    0xFE, 0x0A, 0xFD, 0x90, 0x9F, 0xA2, 0x77, 0x0A, 0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xAE,
+    0xA7, 0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x4A, 0xF9, 0x0A, 0xEA, 0x3A, 0xF9, 0x1A, 0xEA,
+    0x29, 0xF9, 0x2A, 0xEA, 0x19, 0xFA, 0x3A, 0xEA, 0x09, 0xFA, 0x4A, 0xEA, 0x0F, 0xA5, 0xAE, 0xAF,
+    0xC6, 0xAF, 0xFC, 0x6A, 0xFF, 0xCA, 0x5A, 0xFF, 0xD9, 0x4A, 0xF9, 0x0F, 0xC4, 0xAE, 0xA2, 0xFA,
+    0x3A, 0xEA, 0x29, 0xF9, 0x2A, 0xEA, 0x3A, 0xF2, 0xAE, 0xA4, 0xFC, 0x1A, 0xEA, 0x49, 0xFA, 0x00,
+    0x4F, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+    0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xA0, 0x77, 0x70, 0xEA, 0x1A, 0xFC, 0x91, 0x9F, 0xD2, 0xF9,
+    0xFF, 0x99, 0xFF, 0x90, 0xFF, 0xFF, 0xFF, 0x0F, 0xD9, 0x99, 0xFE, 0x99, 0x9F, 0xC0, 0xFC, 0x92,
+    0x9F, 0xC3, 0x9F, 0x9F, 0xC4, 0xFC, 0x4F, 0x9F, 0xA4, 0xFA, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F,
+    0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F,
+    0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x9F, 0xA4, 0xF9, 0x4F, 0x90,
+    0x76, 0xEA, 0x1A, 0xFC, 0x91, 0xF0, 0xFF, 0xA0, 0xFF, 0xFD, 0x9F, 0xDA, 0x99, 0xFC, 0xAF, 0xC9,
+    0x3F, 0xFD, 0x4A, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F,
+    0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xF0, 0x77, 0x3A, 0xFD,
+    0xA6, 0xFF, 0xD9, 0x3F, 0xFF, 0x2A, 0xFA, 0x19, 0xFC, 0x1F, 0xA3, 0x9F, 0x99, 0xF5, 0xFA, 0xAF,
+    0x5F, 0xAA, 0xF5, 0xAF, 0xAF, 0x5A, 0xFA, 0xF5, 0xFA, 0x9F, 0x5F, 0xA0, 0xFA, 0x39, 0xF9, 0x0A,
+    0xFA, 0x19, 0xFC, 0x2F, 0xFF, 0x93, 0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x29, 0x96, 0x77, 0xF1, 0xAF,
+    0xA3, 0xF0, 0xFF, 0x2F, 0xFF, 0xD1, 0xFD, 0x99, 0x9F, 0xC9, 0x0F, 0xC4, 0xFA, 0x0F, 0xC4, 0xAF,
+    0x0F, 0xA4, 0xAF, 0x0F, 0xA4, 0x9F, 0x0F, 0xA4, 0x9F, 0x0F, 0xA4, 0xAF, 0x0F, 0xC4, 0xAF, 0x0F,
+    0xC4, 0xFA, 0x0F, 0xD9, 0x99, 0xFC, 0x90, 0xFF, 0xFD, 0x1F, 0xAF, 0xF2, 0xF9, 0x0F, 0xCA, 0x3F,
+    0xA2, 0x99, 0x5F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xA7, 0x20, 0x77,
+    0x29, 0xFC, 0x90, 0x9E, 0x91, 0xAF, 0xEA, 0xAE, 0x90, 0x9F, 0xFF, 0xC9, 0x0F, 0xCA, 0x99, 0xAF,
+    0xC9, 0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5,
+    0xF9, 0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x19, 0xFC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A,
+    0xFE, 0x9F, 0x92, 0xAF, 0xC9, 0x0F, 0x95, 0x93, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72,
+    0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72, 0xEA, 0x1A, 0xEA, 0xF0, 0xAF, 0xAF, 0xAF, 0xC9, 0xFF, 0xD9,
+    0xFD, 0x93, 0xFC, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x50, 0x76, 0x9A, 0xFD, 0xA9, 0x1A, 0xFF, 0xD0, 0x9F, 0xFD, 0xA0, 0xAE, 0xA3, 0x9C,
+    0x1A, 0xEA, 0x7A, 0xFC, 0x96, 0xFE, 0x94, 0x9F, 0xF9, 0x4A, 0xFE, 0xA5, 0xAF, 0xD7, 0x9F, 0x97,
+    0xF9, 0xAC, 0x93, 0x9F, 0x9A, 0xFF, 0xE0, 0xAF, 0xFD, 0x90, 0x9F, 0xFA, 0x69, 0x99, 0x50, 0x49,
+    0x97, 0x0E, 0x79, 0xE7, 0xAE, 0x6A, 0xFF, 0xA0, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x9A, 0xF9, 0x99,
+    0x92, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x7F, 0x7F, 0xC9, 0x09, 0x92,
+    0xFF, 0xA2, 0x9F, 0xEA, 0x39, 0xFD, 0xA6, 0x99, 0x20, 0xF9, 0x4A, 0xEA, 0xF9, 0x4A, 0xFF, 0x94,
+    0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF,
+    0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99, 0xAF, 0xD9, 0xFF, 0xFD, 0x0A, 0xFF,
+    0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x00, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAE, 0xA1,
+    0xAE, 0xA4, 0xF9, 0x19, 0xF3, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0xAE, 0xA2, 0xF5, 0xF1, 0x9F, 0x5F,
+    0x90, 0xAE, 0x95, 0x9E, 0xA0, 0xF7, 0xF9, 0xEA, 0x7A, 0xEA, 0xE9, 0x79, 0xFE, 0x71, 0xFD, 0xA7,
+    0x1A, 0xFC, 0x73, 0xFC, 0x50, 0xAE, 0xA4, 0xFC, 0x4A, 0xE9, 0x9F, 0x4F, 0xC9, 0x3F, 0x90, 0xF3,
+    0xAF, 0xCA, 0x3F, 0x1A, 0xEA, 0x2F, 0xE2, 0x9E, 0xA1, 0x9F, 0x2E, 0x9E, 0x2F, 0x92, 0xF1, 0x9E,
+    0x0E, 0x2F, 0x3F, 0x90, 0xAD, 0xA0, 0xE9, 0x09, 0xF3, 0xAE, 0xA0, 0xE9, 0x0A, 0xDA, 0x0A, 0xEA,
+    0x39, 0xF0, 0xE1, 0x9E, 0x0F, 0x94, 0xF0, 0xE2, 0xE0, 0xF5, 0xF9, 0xE2, 0xE9, 0xEA, 0x59, 0xEA,
+    0xDA, 0x2A, 0xDA, 0xE9, 0x6F, 0xD9, 0x29, 0xFD, 0x7F, 0xD4, 0xFD, 0x7A, 0xFC, 0x4F, 0xCA, 0x79,
+    0xFA, 0x4A, 0xF4, 0x9F, 0xA4, 0xAF, 0x1A, 0xF3, 0x9F, 0xA2, 0xFC, 0x2F, 0xC3, 0x9F, 0x90, 0xAF,
+    0x5A, 0xF9, 0xFA, 0x6F, 0xFC, 0x79, 0xFE, 0x71, 0xAF, 0xCA, 0x71, 0xFD, 0xA7, 0x0A, 0xFE, 0x97,
+    0xFF, 0xC6, 0xFC, 0x0F, 0xA4, 0xAF, 0x19, 0xF9, 0x3F, 0xA2, 0xAF, 0x2F, 0xC4, 0xFA, 0x0A, 0xF9,
+    0x4A, 0xF9, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4, 0xF9, 0x2F, 0x39, 0xF3,
+    0xF9, 0x2A, 0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x6E, 0xA0, 0xF7, 0xF9,
+    0xEA, 0x79, 0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xF9, 0x72,
+    0x9F, 0x73, 0xFA, 0x7A, 0xAA, 0xFC, 0x70, 0xFE, 0xA7, 0x0F, 0xDA, 0x71, 0xFA, 0x97, 0x10, 0x0A,
+    0xFF, 0xE1, 0xAF, 0xFE, 0x1A, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x9F, 0xC7, 0xAF, 0x79, 0xF9, 0x7F,
+    0xA7, 0xFC, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7A, 0xF7, 0x9F, 0xA9, 0x99, 0x99, 0x91, 0xFF, 0xF9,
+    0x0F, 0xFF, 0x90, 0xFF, 0xF9, 0x59, 0xAD, 0x94, 0xFC, 0x93, 0xAF, 0xC9, 0x3F, 0xC9, 0x4F, 0x6F,
+    0x6F, 0x6F, 0x6F, 0x6F, 0x5A, 0xEA, 0x29, 0xFD, 0x3A, 0xFA, 0x4A, 0xFC, 0x93, 0x9A, 0xFC, 0x95,
+    0xAF, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xCA, 0x4A, 0xFC, 0x94, 0xFC, 0x96, 0x9A, 0xA0,
+    0x3A, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA,
+    0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA,
+    0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xA9, 0xAA, 0x90, 0xAC, 0xAA, 0x6F,
+    0xCA, 0x4F, 0xD4, 0x9A, 0xF9, 0x5A, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59,
+    0xEA, 0x6F, 0x95, 0xAF, 0xD4, 0x9A, 0xF4, 0xAF, 0xC3, 0xFD, 0xA2, 0x9F, 0x59, 0xE9, 0x59, 0xE9,
+    0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x5A, 0xE9, 0x3A, 0xFC, 0x93, 0xFD, 0x4F, 0xC9, 0x4A, 0xA9,
+    0x96, 0x19, 0xAA, 0xA9, 0x79, 0xFE, 0xA2, 0x9C, 0x9F, 0xFF, 0xD9, 0xDA, 0x9A, 0xAF, 0xF9, 0xA5,
+    0x9F, 0xC9, 0x77, 0x09, 0xDA, 0x1F, 0x99, 0xFA, 0x0F, 0x90, 0x9D, 0xA7, 0x59, 0xAA, 0xA1, 0xAE,
+    0x1A, 0xE1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF9, 0x0F, 0x90, 0xF9, 0x0F, 0x99, 0xFA, 0x9F, 0xA0,
+    0x99, 0x99, 0x00, 0x77, 0x2D, 0xA7, 0x1D, 0xA7, 0x9A, 0xFA, 0x92, 0x9F, 0xFC, 0xA0, 0x9F, 0xFD,
+    0x90, 0xFD, 0xAA, 0xE0, 0x9F, 0xA4, 0x90, 0xAF, 0x7F, 0xA7, 0xFA, 0x7F, 0x97, 0xFA, 0x7F, 0xA7,
+    0xAF, 0x79, 0xFC, 0x39, 0xA9, 0x0F, 0xFE, 0x91, 0xFF, 0xD9, 0x2A, 0xFF, 0x59, 0xE9, 0x97, 0xDA,
+    0x71, 0xDA, 0x71, 0x99, 0x40, 0x77, 0x49, 0xFD, 0xA9, 0x5A, 0xFF, 0xC9, 0x39, 0xFF, 0xD4, 0xFC,
+    0xA9, 0xAA, 0xCA, 0x4F, 0x97, 0x19, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x09, 0x9A, 0xF9, 0x99, 0x99,
+    0x3F, 0xFF, 0x92, 0xFF, 0xF9, 0x2A, 0xAF, 0xCA, 0xAA, 0xAA, 0x94, 0x9F, 0x72, 0x9F, 0x72, 0x9F,
+    0x72, 0xAE, 0xA7, 0x19, 0xF7, 0x1A, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFE, 0x0F, 0xFF,
+    0xE0, 0xFF, 0xFE, 0x00, 0x1A, 0x7A, 0x91, 0xE9, 0xAE, 0x9A, 0xD9, 0x0F, 0xFF, 0xA1, 0xFF, 0xDA,
+    0x2E, 0xA1, 0x9E, 0x91, 0x9E, 0x39, 0xDA, 0x19, 0xDA, 0x4E, 0x19, 0xDA, 0x4E, 0x2E, 0x92, 0xEA,
+    0x2F, 0xCA, 0xF9, 0x1A, 0xFF, 0xE1, 0xFF, 0xFA, 0x09, 0xCA, 0x19, 0x92, 0xCA, 0x76, 0xAE, 0xA6,
+    0xF9, 0x0F, 0x5A, 0xF1, 0xAE, 0xA4, 0xF9, 0x2F, 0x39, 0xF3, 0xAE, 0x92, 0xF9, 0x4F, 0x19, 0xF5,
+    0xAE, 0x90, 0xAE, 0x96, 0xF0, 0xF7, 0xAF, 0xE9, 0x70, 0xFE, 0x71, 0xFD, 0x96, 0x9F, 0xFE, 0x49,
+    0xFF, 0xE5, 0x99, 0x9F, 0xA9, 0x99, 0x70, 0xAE, 0x97, 0x0A, 0xAA, 0xFC, 0xAA, 0xA4, 0x9F, 0xFE,
+    0x5F, 0xFD, 0xA7, 0x0A, 0xE9, 0x73, 0xAE, 0x97, 0x3A, 0xE9, 0x50, 0x3A, 0xDA, 0xAD, 0xAA, 0xDA,
+    0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0x9A, 0xA9, 0x77, 0x3A,
+    0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA,
+    0x9A, 0xA9, 0x49, 0x99, 0x59, 0xFE, 0xA1, 0x9F, 0xFC, 0x90, 0xF9, 0x99, 0xE0, 0x9E, 0x59, 0x1E,
+    0xA7, 0xFA, 0x7F, 0xD9, 0x4F, 0xF2, 0xAE, 0x9F, 0xC1, 0xE2, 0x9E, 0x99, 0xE3, 0xAD, 0xA0, 0xE9,
+    0x2A, 0xDA, 0x0F, 0xA1, 0xEA, 0x1F, 0xFC, 0x3A, 0xFD, 0x95, 0xAF, 0xC7, 0xAE, 0xA7, 0xEA, 0x99,
+    0x5E, 0xA9, 0xDA, 0x99, 0x9F, 0x99, 0xFF, 0xCA, 0x1A, 0xFE, 0x95, 0x99, 0x94, 0x0A, 0xD2, 0x9D,
+    0x99, 0xEA, 0x1F, 0x9E, 0xA1, 0xF0, 0xAC, 0xA2, 0x9D, 0x90, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAF,
+    0xCA, 0xFA, 0x70, 0xE9, 0x59, 0xE9, 0x5D, 0xA7, 0x1A, 0xD9, 0x3A, 0xCA, 0x29, 0xAF, 0xA1, 0xAD,
+    0x29, 0xD2, 0x9F, 0xE2, 0xAC, 0xA1, 0xD9, 0x19, 0xDA, 0x29, 0x93, 0xD1, 0xD2, 0xE7, 0x1A, 0xC9,
+    0x9C, 0xA2, 0xD9, 0x71, 0x9C, 0xAA, 0xC9, 0x19, 0xD7, 0x29, 0xDA, 0xC9, 0x19, 0xD7, 0x3D, 0xAC,
+    0x91, 0x9D, 0x72, 0x9D, 0x9C, 0xA2, 0xD9, 0x71, 0x9C, 0xA0, 0xD2, 0xDA, 0x71, 0xAC, 0x90, 0xD2,
+    0x9D, 0x97, 0x0D, 0x1A, 0xD2, 0xFF, 0x2A, 0xD2, 0xD9, 0x2A, 0xFC, 0xA1, 0x9D, 0x39, 0xDA, 0x49,
+    0x39, 0xD9, 0x49, 0xE9, 0x6A, 0xDA, 0x7F, 0xAA, 0xAA, 0xF9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97,
+    0x10, 0x73, 0xAF, 0xC9, 0x19, 0xFE, 0x91, 0xCA, 0x90, 0xAD, 0xA6, 0xE1, 0xAF, 0xE0, 0xFA, 0xAE,
+    0x0E, 0x2E, 0x0E, 0x1A, 0xE0, 0xFF, 0xC0, 0x9F, 0x99, 0xD2, 0x99, 0x40, 0x49, 0x59, 0x6A, 0xDA,
+    0x29, 0xDA, 0x39, 0xF2, 0xF9, 0x2F, 0x91, 0xFA, 0x2F, 0xA1, 0xAF, 0x2F, 0xC1, 0xAF, 0x2A, 0xF1,
+    0x9F, 0x3A, 0xF1, 0x9F, 0x4F, 0xC1, 0xAF, 0x4F, 0xA1, 0xFC, 0x4F, 0x91, 0xFA, 0x39, 0xF2, 0xF9,
+    0x3A, 0xDA, 0x29, 0xDA, 0x59, 0x59, 0x20, 0xAF, 0xFF, 0xC9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x9E, 0x97, 0x2A, 0xD9, 0x72, 0xAD, 0x97, 0x2A, 0xD9, 0x72, 0xAD, 0x97,
+    0x29, 0x99, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0x90, 0xFE, 0x90, 0xFE, 0x90, 0x77, 0x74,
+    0xAF, 0xDA, 0x73, 0xAF, 0xCA, 0xFA, 0x70, 0xE9, 0x59, 0xE9, 0x5D, 0xA7, 0x1A, 0xD9, 0x3A, 0xCA,
+    0x1F, 0xD9, 0x2A, 0xD2, 0x9D, 0x2F, 0xEA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x1A, 0xD9, 0x2D, 0x1D,
+    0x3D, 0x92, 0xD9, 0x2A, 0xC9, 0x9C, 0xA3, 0xD9, 0x2D, 0x92, 0x9C, 0xAA, 0xC9, 0x3D, 0x91, 0xAD,
+    0x39, 0xDA, 0xC9, 0x3F, 0xE9, 0x4D, 0xAC, 0x93, 0xFD, 0x94, 0x9D, 0x9C, 0xA3, 0xD9, 0x0A, 0xD4,
+    0x9C, 0xA0, 0xD3, 0xD9, 0x1D, 0xA3, 0xAC, 0x90, 0xD3, 0xD9, 0x19, 0xD3, 0xD1, 0xAD, 0x2D, 0x92,
+    0xDA, 0x1A, 0xD2, 0xD9, 0x1D, 0x92, 0x9D, 0x99, 0xD3, 0x9D, 0xA7, 0x19, 0xD9, 0x49, 0xE9, 0x6A,
+    0xDA, 0x7F, 0xAA, 0xAA, 0xF9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97, 0x10, 0x77, 0x0F, 0xFF, 0xDA,
+    0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x74, 0x9F, 0xA3, 0xAF, 0xE1, 0x9E, 0xAA, 0xEA, 0x0A, 0xD9,
+    0x2E, 0x0E, 0x3A, 0xD0, 0xE3, 0xAD, 0x0A, 0xDA, 0x19, 0xE1, 0xFF, 0x91, 0x9F, 0xDA, 0x49, 0xAA,
+    0xA3, 0x59, 0x97, 0x4E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x5A, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA,
+    0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x99, 0x99, 0x99, 0xAE, 0x99, 0x99, 0x96, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x74, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x90, 0x19, 0xAE, 0xA2, 0xAF,
+    0xE1, 0xFF, 0x91, 0xC9, 0x1E, 0xA5, 0xEA, 0x49, 0xE5, 0xEA, 0x4E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA4,
+    0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0x19, 0xAE, 0xA3, 0xFF, 0x2A, 0xDA, 0xAE, 0xA2, 0x92, 0x9E,
+    0x69, 0xDA, 0x3A, 0xAF, 0x4F, 0xC9, 0x4A, 0xAA, 0xEA, 0x7E, 0x7E, 0x1D, 0xA9, 0xAF, 0x1F, 0xF9,
+    0x1A, 0xFD, 0x97, 0x40, 0x39, 0x99, 0x93, 0xFC, 0x2F, 0xA2, 0xAE, 0xA2, 0x9E, 0x93, 0x99, 0x95,
+    0xF9, 0x49, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA,
+    0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFF, 0xE9, 0x99,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x9F, 0xFA, 0xF9, 0x0A, 0xFE, 0x90, 0x99, 0x6F, 0xA7, 0x1F, 0xA7, 0x1F,
+    0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xA7, 0x10, 0x77, 0x29, 0xFF, 0xEA, 0x1A, 0xFF, 0xFA, 0x0A,
+    0xFF, 0xC9, 0x9D, 0xA0, 0xFF, 0xCA, 0x1D, 0xA0, 0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9,
+    0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA0,
+    0xFF, 0xCA, 0x1D, 0xA0, 0xAF, 0xFA, 0x1D, 0xA1, 0xFF, 0xA1, 0xDA, 0x2A, 0xFD, 0xA1, 0xDA, 0x59,
+    0x0A, 0xCA, 0x1D, 0xA7, 0xAC, 0xA1, 0xDA, 0x7A, 0xCA, 0x1D, 0xA7, 0xAC, 0xA1, 0xDA, 0x7A, 0xCA,
+    0x1D, 0xA7, 0xAC, 0xA1, 0xDA, 0x7A, 0xCA, 0x1D, 0xA7, 0xAC, 0xA1, 0xDA, 0x7A, 0xCA, 0x1D, 0xA7,
+    0xAC, 0xA1, 0xDA, 0x7A, 0xCA, 0x1D, 0xA7, 0x9A, 0x91, 0xAA, 0x90, 0x19, 0x92, 0xF9, 0x9F, 0xA9,
+    0xFA, 0x0F, 0x29, 0x91, 0x1A, 0xD4, 0xEA, 0x39, 0xF4, 0xE0, 0x99, 0x9A, 0xE0, 0x9F, 0xCA, 0x09,
+    0xF9, 0x10, 0x4A, 0xAA, 0x4F, 0x29, 0xFC, 0x1A, 0xFD, 0x1A, 0xD9, 0xE2, 0xA1, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE0, 0x75, 0xAE, 0xA4, 0xFE, 0x91, 0xAD, 0xA9, 0xAE, 0x1E, 0x2A, 0xD9,
+    0x0D, 0xA2, 0xAD, 0x90, 0xDA, 0x29, 0xD9, 0x0E, 0x2A, 0xD9, 0x0E, 0x90, 0x9E, 0x2F, 0xEA, 0x29,
+    0xFC, 0x96, 0x94, 0x19, 0x95, 0x95, 0xAD, 0x3A, 0xD9, 0x3A, 0xF1, 0x9F, 0x93, 0xAF, 0x19, 0xF4,
+    0xFA, 0x1A, 0xF4, 0xF9, 0x1F, 0xA3, 0x9F, 0x91, 0xFA, 0x29, 0xF9, 0x1F, 0xA2, 0xF9, 0x1F, 0xA2,
+    0xFA, 0x1A, 0xF2, 0xAF, 0x19, 0xF2, 0xAF, 0x19, 0xF9, 0x3A, 0xD3, 0xAD, 0x95, 0x99, 0x59, 0x40,
+    0x39, 0xDA, 0x7E, 0x7A, 0xEA, 0x6A, 0xE6, 0xFC, 0xA6, 0xE6, 0xFD, 0xA5, 0xAD, 0xA6, 0xAC, 0x9A,
+    0xDA, 0x49, 0xE7, 0x2A, 0xDA, 0x4E, 0xA7, 0x2A, 0xDA, 0x39, 0xE7, 0x3A, 0xDA, 0x3E, 0x97, 0x3A,
+    0xDA, 0x2A, 0xE3, 0xAA, 0xA5, 0xAD, 0xA2, 0xE9, 0x2F, 0x5A, 0xDA, 0x1A, 0xE2, 0xAF, 0x5A, 0xDA,
+    0x1E, 0x3F, 0xC5, 0x9A, 0xA9, 0x0A, 0xDA, 0x2D, 0xAE, 0x71, 0x9E, 0x2A, 0xD0, 0xE7, 0x1E, 0xA2,
+    0xD9, 0x0E, 0x70, 0x9E, 0x2D, 0xA1, 0xE7, 0x0E, 0x91, 0xAD, 0xAA, 0xAE, 0xAA, 0x5A, 0xE2, 0xAF,
+    0xFD, 0x5E, 0x92, 0xAF, 0xFD, 0x4A, 0xE7, 0x1E, 0x6E, 0x72, 0xE1, 0x39, 0xDA, 0x7E, 0x70, 0xAE,
+    0xA6, 0xAE, 0x7F, 0xCA, 0x6E, 0x7F, 0xDA, 0x5A, 0xDA, 0x7A, 0xC9, 0xAD, 0xA4, 0x9E, 0x73, 0xAD,
+    0xA4, 0xEA, 0x73, 0xAD, 0xA3, 0x9E, 0x74, 0xAD, 0xA3, 0xE9, 0x74, 0xAD, 0xA2, 0xAE, 0x19, 0xAC,
+    0xAA, 0x6A, 0xDA, 0x2E, 0x99, 0xFE, 0x94, 0xAD, 0xA1, 0xAE, 0x0A, 0xFF, 0x4A, 0xDA, 0x1E, 0x2A,
+    0xA1, 0xAE, 0x49, 0xAA, 0x90, 0xAD, 0xA6, 0x9E, 0x70, 0x9E, 0x7E, 0xA7, 0x0E, 0xA6, 0xAE, 0x70,
+    0x9E, 0x6A, 0xE9, 0x70, 0xE9, 0x5A, 0xE9, 0x70, 0xAE, 0x5A, 0xE7, 0x2E, 0x94, 0xAF, 0xF9, 0x4A,
+    0xE5, 0xFF, 0xC9, 0x4E, 0x6F, 0xFC, 0x90, 0x77, 0x70, 0x9A, 0xF9, 0x7E, 0x93, 0x9F, 0xE9, 0x5A,
+    0xE5, 0xDA, 0x9A, 0xE5, 0xE7, 0x3E, 0x4A, 0xDA, 0x72, 0x9D, 0xA3, 0x9E, 0x70, 0xAF, 0xA4, 0xEA,
+    0x70, 0xFC, 0x93, 0x9E, 0x71, 0x99, 0x9E, 0xA2, 0xE9, 0x75, 0xE1, 0x9E, 0x2A, 0xAA, 0x91, 0x94,
+    0xE9, 0x0E, 0x91, 0x9E, 0xA1, 0xAD, 0xAA, 0xF0, 0xAE, 0x2F, 0xA1, 0xAF, 0xE9, 0x0E, 0x91, 0xFC,
+    0xA2, 0x9A, 0xEA, 0x1A, 0xDA, 0x19, 0xDA, 0xDA, 0x71, 0x9E, 0x2D, 0x9E, 0xA7, 0x1E, 0xA1, 0xDA,
+    0x0E, 0xA7, 0x09, 0xE1, 0x9D, 0x1E, 0xA7, 0x0E, 0x91, 0xEA, 0xAF, 0xA6, 0x9E, 0x2F, 0xFD, 0x95,
+    0xE9, 0x2F, 0xFD, 0x94, 0xAE, 0x70, 0xEA, 0x6E, 0x97, 0x0E, 0xA1, 0x77, 0x3E, 0xA7, 0x0A, 0xF9,
+    0x7A, 0xF9, 0x79, 0xF7, 0x19, 0xAA, 0x77, 0x77, 0x6A, 0xE7, 0x1E, 0xA7, 0x0A, 0xEA, 0x7A, 0xF7,
+    0xFC, 0x96, 0xFC, 0x96, 0xFC, 0x70, 0xF7, 0x09, 0xF7, 0x09, 0xF5, 0x92, 0xFC, 0x99, 0x9A, 0xE1,
+    0xFF, 0xF9, 0x1F, 0xFE, 0x92, 0xAF, 0xE9, 0x77, 0x59, 0x99, 0x97, 0x70, 0xFC, 0x77, 0x0A, 0xF7,
+    0x70, 0x9E, 0xA7, 0x71, 0xEA, 0x77, 0x19, 0x99, 0x77, 0x77, 0x2F, 0xD7, 0x6F, 0xD9, 0x74, 0xAF,
+    0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71, 0x9F, 0x1F,
+    0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6, 0xFC, 0xAA,
+    0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F, 0xA2, 0xFC,
+    0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x72, 0x99, 0x99,
+    0x97, 0x6A, 0xF9, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0xEA, 0x77, 0x09, 0x99, 0x77, 0x77, 0x5F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC0, 0x79, 0x99, 0x97, 0x7A, 0xFC, 0x75, 0xAF, 0xDA, 0x73, 0x9E, 0x99, 0xEA, 0x71, 0x9E, 0x91,
+    0x9E, 0xA7, 0x09, 0x99, 0x59, 0x99, 0x77, 0x77, 0x0F, 0xD7, 0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74,
+    0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A,
+    0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC,
+    0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2,
+    0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x77, 0x72, 0xAE, 0x92, 0xD7,
+    0x1A, 0xFD, 0xAE, 0x70, 0x9F, 0xFD, 0x97, 0x0A, 0xD1, 0x9F, 0xA7, 0x29, 0x59, 0x77, 0x77, 0x3F,
+    0xD7, 0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72,
+    0xF9, 0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96,
+    0xAF, 0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF,
+    0x39, 0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7,
+    0x1F, 0xC0, 0x49, 0xD9, 0x2D, 0xA7, 0x2F, 0x1A, 0xE7, 0x2F, 0x1A, 0xE7, 0x29, 0xD9, 0x2D, 0x97,
+    0x77, 0x77, 0x76, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F, 0xF7, 0x4F, 0xAE, 0x97, 0x2A,
+    0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE, 0xA1, 0x9F, 0x70, 0xF9, 0x2F,
+    0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5, 0x9F, 0xFF, 0xDA, 0x4A, 0xFF,
+    0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F, 0xA7, 0x9F, 0x90, 0x9F, 0x97,
+    0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x70, 0x99, 0x77, 0x0A, 0xFA, 0x76, 0xDA, 0xAD, 0x97, 0x49,
+    0xCA, 0x1A, 0xCA, 0x74, 0x9D, 0x1D, 0xA7, 0x5F, 0xD9, 0x75, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F,
+    0xF7, 0x4F, 0xAE, 0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE,
+    0xA1, 0x9F, 0x70, 0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5,
+    0x9F, 0xFF, 0xDA, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F,
+    0xA7, 0x9F, 0x90, 0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x70, 0xAF, 0xFF, 0xF7, 0x09,
+    0xFF, 0xFF, 0xC7, 0x0A, 0xFF, 0xFF, 0xC7, 0x0F, 0xFF, 0xFD, 0x7A, 0xEA, 0x09, 0xF7, 0x7F, 0x19,
+    0xF7, 0x6A, 0xEA, 0x19, 0xF7, 0x6F, 0x91, 0x9F, 0x75, 0x9F, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0x95,
+    0xF9, 0x29, 0xFF, 0xEA, 0x49, 0xF3, 0x9F, 0xFE, 0xA4, 0xAE, 0xA3, 0x9F, 0xFE, 0xA4, 0xFC, 0xAA,
+    0xAA, 0xFC, 0x73, 0xAF, 0xFF, 0xD7, 0x3F, 0xFF, 0xE7, 0x2A, 0xFF, 0xFE, 0x72, 0xF9, 0x59, 0xF7,
+    0x19, 0xF6, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xA6, 0x9F, 0xFF, 0x09, 0xF7, 0x9F, 0xFF, 0x0F,
+    0xA7, 0x9F, 0xFF, 0x00, 0x77, 0x69, 0xAF, 0xDA, 0x94, 0x9F, 0xFE, 0xA2, 0x9F, 0xFF, 0x91, 0x9F,
+    0xDA, 0xAA, 0xF2, 0xFC, 0xA5, 0x99, 0x19, 0xFA, 0x72, 0xFC, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F,
+    0x97, 0x29, 0xF7, 0x39, 0xF9, 0x72, 0x9F, 0x97, 0x3F, 0xA7, 0x3F, 0xC7, 0x3A, 0xF9, 0x73, 0xFC,
+    0x96, 0x92, 0xAF, 0xDA, 0x99, 0xAE, 0x3F, 0xFF, 0xC4, 0xAF, 0xFE, 0x59, 0xAF, 0xF9, 0x70, 0xAD,
+    0x97, 0x4E, 0xA7, 0x49, 0xF7, 0x5E, 0x72, 0x99, 0xAE, 0x71, 0x9F, 0xCA, 0x71, 0x9F, 0x94, 0x19,
+    0x99, 0x97, 0x0F, 0xC7, 0x0F, 0xA7, 0x0A, 0xEA, 0x70, 0x9E, 0x97, 0x19, 0x97, 0x70, 0x9F, 0xFE,
+    0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA0, 0x69,
+    0x99, 0x99, 0x6A, 0xF9, 0x59, 0xF9, 0x6F, 0x7E, 0xA7, 0x09, 0x99, 0x77, 0x29, 0xFF, 0xEA, 0x9F,
+    0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA,
+    0xAA, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x49, 0x99, 0x97,
+    0xFC, 0x95, 0xFE, 0x93, 0xF0, 0xAE, 0x2A, 0xE2, 0xAE, 0x19, 0x99, 0x59, 0x97, 0x59, 0xFF, 0xEA,
+    0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7,
+    0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x1A, 0xD2,
+    0xAD, 0x91, 0x9E, 0xA1, 0xF1, 0x9E, 0x91, 0xF2, 0xAC, 0xA2, 0x9D, 0x77, 0x73, 0x9F, 0xFE, 0xA9,
+    0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA,
+    0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79,
+    0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA0, 0x09, 0x99,
+    0x96, 0xFC, 0x6F, 0xA6, 0xAE, 0x96, 0x9E, 0x97, 0x99, 0x76, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF,
+    0xC9, 0x19, 0xFC, 0xA4, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5,
+    0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5F, 0xC9, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC,
+    0x90, 0x59, 0x99, 0x99, 0x4A, 0xF9, 0x39, 0xF5, 0xF5, 0xEA, 0x69, 0x97, 0x71, 0xFF, 0xC9, 0x0F,
+    0xFC, 0x90, 0xFF, 0xC9, 0x19, 0xFC, 0xA4, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5,
+    0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5F, 0xC9, 0x2F, 0xFC, 0x90, 0xFF,
+    0xC9, 0x0F, 0xFC, 0x90, 0x39, 0x99, 0x99, 0x7F, 0xC9, 0x5F, 0xE4, 0xF0, 0xF2, 0xEA, 0x2A, 0xE1,
+    0x99, 0x95, 0x99, 0x77, 0xFF, 0xC9, 0x2F, 0xFC, 0x92, 0xFF, 0xC9, 0x39, 0xFC, 0xA6, 0xAF, 0x7A,
+    0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7, 0xAF, 0x7A, 0xF7,
+    0xAF, 0x7F, 0xC9, 0x4F, 0xFC, 0x92, 0xFF, 0xC9, 0x2F, 0xFC, 0x90, 0x0A, 0xCA, 0x2A, 0xD0, 0x9E,
+    0x91, 0xEA, 0x9E, 0x91, 0xEA, 0x0A, 0xCA, 0x29, 0xD7, 0x77, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF,
+    0xC9, 0x19, 0xFC, 0xA4, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5,
+    0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5F, 0xC9, 0x2F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC,
+    0x90, 0x19, 0xFF, 0xAA, 0x70, 0x9F, 0xFF, 0x95, 0x9F, 0xFF, 0xCA, 0x49, 0xFF, 0xFD, 0xA3, 0x9F,
+    0x4A, 0xFC, 0x92, 0x9F, 0x59, 0xFC, 0x29, 0xF6, 0xAF, 0x91, 0x9F, 0x69, 0xFA, 0x1A, 0xF7, 0xFA,
+    0x9F, 0xFD, 0x3F, 0xC9, 0xFF, 0xD3, 0xFC, 0x9F, 0xFD, 0x3F, 0xA0, 0xAA, 0xFA, 0xAA, 0x93, 0xFA,
+    0x19, 0xF6, 0x9F, 0x91, 0x9F, 0x6A, 0xF2, 0x9F, 0x59, 0xFC, 0x29, 0xF4, 0xAF, 0xC9, 0x29, 0xFA,
+    0xAA, 0xFE, 0xA3, 0x9F, 0xFF, 0xCA, 0x49, 0xFF, 0xF9, 0x59, 0xFF, 0xCA, 0x95, 0x77, 0x71, 0xEA,
+    0x2A, 0xD7, 0x0F, 0xDA, 0xAD, 0xA7, 0xAF, 0xFD, 0x70, 0xDA, 0x19, 0xF9, 0x70, 0x99, 0x49, 0x97,
+    0x77, 0x29, 0xFC, 0x97, 0xAE, 0x09, 0xFD, 0x7F, 0x09, 0xFD, 0xA6, 0xF0, 0x9F, 0xE6, 0xF0, 0x9F,
+    0xEA, 0x5F, 0x09, 0xFF, 0x94, 0xF0, 0x9E, 0x9F, 0xC4, 0xF0, 0x9E, 0x99, 0xF9, 0x3F, 0x09, 0xE9,
+    0x0A, 0xF3, 0xF0, 0x9E, 0xA1, 0xFA, 0x2F, 0x09, 0xEA, 0x1A, 0xF2, 0xF0, 0x9E, 0xA2, 0xFC, 0x1F,
+    0x09, 0xEA, 0x29, 0xF9, 0x0F, 0x09, 0xEA, 0x3F, 0xC0, 0xF0, 0x9E, 0xA3, 0x9F, 0x9A, 0xE0, 0x9E,
+    0xA4, 0xAF, 0xF0, 0x9E, 0xA5, 0xFF, 0x09, 0xEA, 0x5A, 0xFE, 0x09, 0xEA, 0x6F, 0xE0, 0x9E, 0xA6,
+    0x9F, 0xD0, 0x9E, 0xA7, 0xFD, 0x00, 0x59, 0x99, 0x99, 0x77, 0x9F, 0xA7, 0x79, 0xF9, 0x77, 0x0F,
+    0x77, 0x1A, 0xE7, 0x71, 0x99, 0x97, 0x77, 0x71, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF,
+    0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70,
+    0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC,
+    0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6,
+    0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x73, 0x99, 0x99, 0x77, 0xFC, 0x76,
+    0xFA, 0x76, 0xAE, 0xA7, 0x69, 0xE9, 0x77, 0x99, 0x97, 0x77, 0x74, 0xAF, 0xEA, 0x71, 0xAF, 0xFE,
+    0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F,
+    0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9,
+    0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1,
+    0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA,
+    0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x79, 0x99, 0x99,
+    0x76, 0x9F, 0xC9, 0x75, 0xFE, 0x74, 0xF0, 0xF7, 0x2E, 0xA2, 0xAE, 0x71, 0x99, 0x94, 0x99, 0x97,
+    0x77, 0x7A, 0xFE, 0xA7, 0x1A, 0xFF, 0xEA, 0x6A, 0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F,
+    0xC9, 0x49, 0xFC, 0x2A, 0xFA, 0x69, 0xFA, 0x1F, 0xC7, 0x0F, 0xC1, 0xFA, 0x70, 0xAF, 0x09, 0xF9,
+    0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9,
+    0x70, 0x9F, 0x90, 0xFA, 0x70, 0xAF, 0x1F, 0xC7, 0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94,
+    0x9F, 0xC3, 0xAF, 0xDA, 0x9A, 0xFD, 0xA4, 0xFF, 0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9,
+    0x75, 0x99, 0x97, 0x00, 0x77, 0x72, 0x9E, 0xA2, 0xAC, 0xA7, 0x09, 0xFD, 0xAA, 0xD9, 0x70, 0xFF,
+    0xE7, 0x1D, 0x91, 0xAF, 0x72, 0x99, 0x49, 0x77, 0x77, 0x2A, 0xFE, 0xA7, 0x1A, 0xFF, 0xEA, 0x6A,
+    0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xC9, 0x49, 0xFC, 0x2A, 0xFA, 0x69, 0xFA, 0x1F,
+    0xC7, 0x0F, 0xC1, 0xFA, 0x70, 0xAF, 0x09, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9,
+    0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x90, 0xFA, 0x70, 0xAF, 0x1F, 0xC7,
+    0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94, 0x9F, 0xC3, 0xAF, 0xDA, 0x9A, 0xFD, 0xA4, 0xFF,
+    0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9, 0x75, 0x99, 0x97, 0x00, 0x5D, 0xA2, 0xAD, 0x72,
+    0xAE, 0x90, 0x9E, 0xA7, 0x1A, 0xE9, 0x1E, 0xA7, 0x2A, 0xCA, 0x2A, 0xCA, 0x77, 0x77, 0x77, 0x5A,
+    0xFE, 0xA7, 0x1A, 0xFF, 0xEA, 0x6A, 0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xC9, 0x49,
+    0xFC, 0x2A, 0xFA, 0x69, 0xFA, 0x1F, 0xC7, 0x0F, 0xC1, 0xFA, 0x70, 0xAF, 0x09, 0xF9, 0x70, 0x9F,
+    0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F,
+    0x90, 0xFA, 0x70, 0xAF, 0x1F, 0xC7, 0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94, 0x9F, 0xC3,
+    0xAF, 0xDA, 0x9A, 0xFD, 0xA4, 0xFF, 0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9, 0x75, 0x99,
+    0x97, 0x00, 0x19, 0x96, 0xA2, 0x9D, 0x94, 0xAD, 0x1F, 0x92, 0xAE, 0xA1, 0xF9, 0x0A, 0xEA, 0x3F,
+    0xFA, 0x5F, 0xDA, 0x7F, 0xA7, 0xAF, 0xC9, 0x5A, 0xFE, 0x93, 0xAE, 0xA0, 0xF9, 0x1A, 0xEA, 0x2F,
+    0x90, 0xAD, 0xA4, 0xE9, 0x1A, 0xA6, 0xC9, 0x76, 0x77, 0xA9, 0x70, 0xAF, 0xEA, 0x9D, 0xA5, 0xAF,
+    0xFF, 0xC9, 0x4A, 0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xC9, 0x4F, 0xD2, 0xAF, 0xA4,
+    0xAF, 0xDA, 0x1F, 0xC4, 0x9F, 0xF1, 0xFA, 0x4E, 0x9A, 0xF0, 0x9F, 0x93, 0xAD, 0xA0, 0x9F, 0x99,
+    0xF9, 0x29, 0xE1, 0x9F, 0x99, 0xF9, 0x2E, 0x91, 0x9F, 0x99, 0xF9, 0x1A, 0xDA, 0x29, 0xF9, 0x9F,
+    0x90, 0x9E, 0x39, 0xF9, 0x0F, 0xA0, 0xE9, 0x3A, 0xF1, 0xFC, 0xAD, 0xA4, 0xFC, 0x1A, 0xFE, 0x49,
+    0xFA, 0x2F, 0xD9, 0x39, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE5, 0xFF, 0xFC, 0xA5,
+    0xAD, 0xAA, 0xFE, 0xA9, 0x7A, 0xC3, 0x99, 0x97, 0x77, 0x50, 0x39, 0x99, 0x97, 0x5A, 0xF7, 0x5A,
+    0xF7, 0x59, 0xF7, 0x6E, 0xA7, 0x69, 0x99, 0x77, 0x79, 0xEA, 0x7A, 0xE9, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xA9, 0xF7, 0xFA, 0x9F,
+    0x95, 0x9F, 0x90, 0xFC, 0x5F, 0xC1, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6,
+    0x9F, 0xF9, 0x73, 0x99, 0x70, 0x70, 0x99, 0x99, 0x97, 0x39, 0xFA, 0x73, 0xF9, 0x73, 0xF9, 0x73,
+    0xAE, 0x75, 0x99, 0x97, 0x77, 0x29, 0xEA, 0x7A, 0xE9, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F,
+    0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xA9, 0xF7, 0xFA, 0x9F, 0x95, 0x9F, 0x90,
+    0xFC, 0x5F, 0xC1, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9F, 0xF9, 0x73,
+    0x99, 0x70, 0x69, 0x99, 0x97, 0x4F, 0xCA, 0x72, 0xAF, 0xDA, 0x70, 0xAE, 0x9A, 0xE9, 0x6A, 0xE2,
+    0x9E, 0x95, 0x99, 0x95, 0x99, 0x97, 0x74, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59,
+    0xF9, 0x0F, 0xC5, 0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF,
+    0x97, 0x39, 0x97, 0x3A, 0xD2, 0x9D, 0x97, 0xF1, 0xF7, 0xEA, 0x1F, 0x79, 0xD2, 0x9D, 0x97, 0x77,
+    0x77, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59, 0xF9, 0x0F, 0xC5, 0xFC, 0x1A, 0xFC,
+    0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0x97, 0x39, 0x97, 0x71, 0x99, 0x99,
+    0x97, 0x49, 0xF9, 0x74, 0xF9, 0x74, 0xF7, 0x5E, 0xA7, 0x69, 0x99, 0x77, 0x73, 0xAF, 0x7A, 0xF0,
+    0x9F, 0xA6, 0xFA, 0x1F, 0xC5, 0xAF, 0x3F, 0x94, 0xF9, 0x3A, 0xF3, 0xAF, 0x5F, 0x92, 0xF9, 0x5A,
+    0xF1, 0xAF, 0x7F, 0x90, 0xF9, 0x7A, 0xFA, 0xF7, 0x1F, 0xF7, 0x29, 0xFD, 0xA7, 0x3F, 0xD7, 0x49,
+    0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75,
+    0xF9, 0x60, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0xAA, 0xAA, 0x94, 0x9F, 0xFE, 0x91, 0x9F,
+    0xFF, 0x90, 0x9F, 0xFF, 0xC0, 0x9F, 0x3A, 0xFA, 0x9F, 0x4F, 0xC9, 0xF4, 0xAF, 0x9F, 0x49, 0xF9,
+    0xF4, 0xAF, 0x9F, 0x3A, 0xFA, 0x9F, 0xAA, 0xFE, 0x09, 0xFF, 0xFA, 0x09, 0xFF, 0xE9, 0x19, 0xFF,
+    0xA9, 0x39, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x19, 0xF7, 0x10, 0x69, 0x97, 0x39, 0xFF, 0xA6, 0xFF,
+    0xF9, 0x3F, 0xFF, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x91, 0xFC, 0x5F, 0xA1, 0xFA, 0x5F, 0x91, 0xFA,
+    0x4A, 0xF2, 0xFA, 0x3A, 0xF9, 0x2F, 0xA2, 0xFC, 0x93, 0xFA, 0x1A, 0xF5, 0xFA, 0x1F, 0xC5, 0xFA,
+    0x1F, 0xCA, 0x4F, 0xA1, 0x9F, 0xD9, 0x2F, 0xA2, 0x9F, 0xDA, 0x1F, 0xA4, 0xFD, 0xA0, 0xFA, 0x59,
+    0xFC, 0x0F, 0xA6, 0x9F, 0x9F, 0xA7, 0xF9, 0xFA, 0x09, 0xA3, 0xAF, 0x9F, 0xA0, 0x9F, 0xFD, 0x0F,
+    0xA0, 0x9F, 0xFC, 0x90, 0xFA, 0x1F, 0xF9, 0x73, 0x99, 0x50, 0x29, 0x99, 0x99, 0x72, 0xFC, 0x72,
+    0xFA, 0x72, 0xAE, 0x97, 0x2A, 0xE7, 0x49, 0x97, 0x75, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3,
+    0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9,
+    0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90,
+    0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x70, 0x99, 0x99, 0x71, 0xFC, 0x70,
+    0xAF, 0x70, 0x9E, 0xA7, 0x09, 0xE9, 0x72, 0x99, 0x77, 0x70, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF,
+    0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA,
+    0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC,
+    0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x59, 0x99, 0x97, 0x1F, 0xCA,
+    0x7F, 0xE9, 0x5A, 0xE9, 0xAE, 0x93, 0xAE, 0x2A, 0xE3, 0x99, 0x95, 0x99, 0x77, 0x3A, 0xFE, 0xA4,
+    0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF,
+    0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F,
+    0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x70, 0x77, 0x2E,
+    0xA2, 0xAD, 0x3F, 0xDA, 0xAD, 0xA2, 0xAF, 0xFD, 0x3D, 0xA1, 0x9F, 0x93, 0x99, 0x49, 0x97, 0x75,
+    0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF,
+    0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A,
+    0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97,
+    0x00, 0x2A, 0xD2, 0x9D, 0x93, 0x9E, 0xA1, 0xF3, 0x9E, 0xA1, 0xF4, 0xAC, 0xA2, 0x9D, 0x77, 0x77,
+    0x3A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A,
+    0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9,
+    0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99,
+    0x70, 0x59, 0x99, 0x72, 0xFC, 0x97, 0xAD, 0xAE, 0x7D, 0x91, 0xD9, 0x6D, 0x91, 0xD9, 0x6A, 0xDA,
+    0xE7, 0x0A, 0xF9, 0x72, 0x99, 0x77, 0x7A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A,
+    0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F,
+    0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E,
+    0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x70, 0x77, 0x73, 0xAF, 0xE9, 0x1A, 0xFC, 0xA5, 0xFF, 0xDA,
+    0xFF, 0xC9, 0x3A, 0xFF, 0xFF, 0xF9, 0x3C, 0xA3, 0xAF, 0xCA, 0x2A, 0xF7, 0x2F, 0xA4, 0xF7, 0x2F,
+    0x94, 0xAE, 0x92, 0x9A, 0xAF, 0xFF, 0xFD, 0x91, 0xFF, 0xFF, 0xFD, 0xA0, 0xFD, 0xAA, 0xAF, 0xFF,
+    0xDA, 0xAF, 0x93, 0xF9, 0x71, 0xAF, 0x4F, 0x97, 0x1F, 0xA3, 0xAF, 0xC7, 0x1A, 0xF2, 0x9F, 0xE4,
+    0x9A, 0xA0, 0x9F, 0xFD, 0xAF, 0xFE, 0xA1, 0xFF, 0xCA, 0x09, 0xFF, 0xDA, 0x2A, 0xFD, 0x93, 0xAF,
+    0xEA, 0x69, 0x72, 0x99, 0x50, 0x77, 0x19, 0xFE, 0x93, 0xFF, 0xD2, 0xFF, 0xDA, 0x1A, 0xFC, 0x99,
+    0x9A, 0xC2, 0xFC, 0x79, 0xF9, 0x7A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x09, 0xF7, 0x1F,
+    0xA7, 0x0F, 0xD9, 0x99, 0xAD, 0x2F, 0xFE, 0x29, 0xFF, 0xD4, 0xAF, 0xDA, 0x7D, 0xA7, 0x2E, 0x97,
+    0x19, 0xEA, 0x71, 0x9E, 0x69, 0x99, 0xF6, 0xAF, 0xCA, 0x69, 0xF9, 0x30, 0x29, 0x99, 0x99, 0x73,
+    0xFC, 0x73, 0xFA, 0x73, 0xAE, 0x97, 0x3A, 0xE7, 0x59, 0x97, 0x77, 0x0A, 0xFD, 0x96, 0xFF, 0xD4,
+    0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF,
+    0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4,
+    0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50, 0x70, 0x99, 0x99, 0x72, 0xFC, 0x71, 0xAF, 0x71, 0x9E,
+    0xA7, 0x19, 0xE9, 0x73, 0x99, 0x77, 0x73, 0xAF, 0xD9, 0x6F, 0xFD, 0x4F, 0xFF, 0x2A, 0xF9, 0x19,
+    0xF9, 0x1F, 0x93, 0x9F, 0x09, 0xF5, 0xF0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0,
+    0xAF, 0x72, 0x9F, 0x73, 0xFA, 0x72, 0xAF, 0xA4, 0xAC, 0x3F, 0xFF, 0x4F, 0xFE, 0x5A, 0xFF, 0x97,
+    0x19, 0x95, 0x59, 0x99, 0x97, 0x2F, 0xCA, 0x70, 0xFE, 0x96, 0xAE, 0x9A, 0xE9, 0x4A, 0xE2, 0xAE,
+    0x49, 0x99, 0x59, 0x97, 0x76, 0xAF, 0xD9, 0x6F, 0xFD, 0x4F, 0xFF, 0x2A, 0xF9, 0x19, 0xF9, 0x1F,
+    0x93, 0x9F, 0x09, 0xF5, 0xF0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0x72,
+    0x9F, 0x73, 0xFA, 0x72, 0xAF, 0xA4, 0xAC, 0x3F, 0xFF, 0x4F, 0xFE, 0x5A, 0xFF, 0x97, 0x19, 0x95,
+    0x2A, 0xD2, 0x9D, 0x94, 0x9E, 0xA1, 0xF4, 0x9E, 0xA1, 0xF5, 0xAC, 0xA2, 0x9D, 0x77, 0x77, 0x7A,
+    0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A,
+    0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA,
+    0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50, 0x09, 0x99, 0x99, 0x4A, 0xF9,
+    0x49, 0xF6, 0xF6, 0xF6, 0x99, 0x97, 0x5F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F,
+    0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x10, 0x29,
+    0x99, 0x99, 0x3F, 0xA2, 0xFA, 0x2F, 0x92, 0xAE, 0x49, 0x99, 0x76, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F,
+    0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3, 0xFA, 0x3F, 0xA3,
+    0xFA, 0x3F, 0xA3, 0x39, 0x99, 0x97, 0x9F, 0xC5, 0x9F, 0xE4, 0xEA, 0x0F, 0x2E, 0xA2, 0xF1, 0x99,
+    0x59, 0x99, 0x77, 0x1F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F,
+    0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x30, 0x0D, 0xA2, 0xAC, 0xA0,
+    0xAE, 0x19, 0xE9, 0xAE, 0x19, 0xE9, 0x0D, 0x92, 0xAC, 0xA7, 0x77, 0x1F, 0xA5, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA,
+    0x5F, 0xA5, 0xFA, 0x20, 0x77, 0x4D, 0x92, 0xAC, 0x69, 0xFA, 0xEA, 0x6A, 0xFE, 0x70, 0xFD, 0x79,
+    0xFE, 0xA6, 0x9E, 0x9F, 0x96, 0xC9, 0x19, 0xF7, 0x3A, 0xEA, 0x4A, 0xFC, 0x9F, 0x29, 0xFF, 0xF9,
+    0x09, 0xFF, 0xFC, 0xA0, 0xFC, 0x91, 0x9F, 0xCA, 0x9F, 0x94, 0xFC, 0x9F, 0x5F, 0xCA, 0xF5, 0xAF,
+    0xAF, 0x5A, 0xEA, 0x9F, 0x5F, 0xA0, 0xF9, 0x4F, 0x1F, 0xC9, 0x2F, 0xC2, 0xFF, 0xF3, 0x9F, 0xFD,
+    0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60, 0x77, 0x19, 0xE9, 0x2D, 0x92, 0x9F, 0xDA, 0xAD, 0x92, 0xFF,
+    0xE3, 0xD2, 0xAF, 0x49, 0x94, 0x97, 0x73, 0xEA, 0x1A, 0xFC, 0x91, 0xF0, 0xFF, 0xA0, 0xFF, 0xFD,
+    0x9F, 0xDA, 0x99, 0xFC, 0xAF, 0xC9, 0x3F, 0xFD, 0x4A, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4,
+    0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F,
+    0xFA, 0x49, 0xF0, 0x39, 0x99, 0x97, 0x3A, 0xF7, 0x3A, 0xF7, 0x39, 0xEA, 0x74, 0xEA, 0x74, 0x99,
+    0x97, 0x77, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA, 0x39, 0xF9,
+    0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5, 0xFA, 0x0F,
+    0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99,
+    0x60, 0x70, 0x99, 0x99, 0x97, 0x19, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x2E, 0xA7, 0x39, 0x99, 0x77,
+    0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F,
+    0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3,
+    0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60,
+    0x59, 0x99, 0x97, 0x2A, 0xFC, 0x70, 0xAF, 0xDA, 0x69, 0xEA, 0x9E, 0xA4, 0x9E, 0x92, 0xEA, 0x49,
+    0x95, 0x99, 0x97, 0x75, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA,
+    0x39, 0xF9, 0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5,
+    0xFA, 0x0F, 0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA,
+    0x72, 0x99, 0x60, 0x77, 0x3A, 0xE9, 0x2D, 0x4A, 0xFD, 0xAE, 0x4F, 0xFD, 0x93, 0xAD, 0x19, 0xFA,
+    0x59, 0x59, 0x77, 0x70, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA,
+    0x39, 0xF9, 0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5,
+    0xFA, 0x0F, 0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA,
+    0x72, 0x99, 0x60, 0x29, 0xD9, 0x2D, 0xA5, 0xF1, 0xAE, 0x5F, 0x1A, 0xE5, 0x9D, 0x92, 0xDA, 0x77,
+    0x77, 0x6A, 0xFD, 0xA6, 0xFF, 0xD9, 0x3F, 0xFF, 0x2A, 0xFA, 0x19, 0xFC, 0x1F, 0xA3, 0x9F, 0x99,
+    0xF5, 0xFA, 0xAF, 0x5F, 0xAA, 0xF5, 0xAF, 0xAF, 0x5A, 0xFA, 0xF5, 0xFA, 0x9F, 0x5F, 0xA0, 0xFA,
+    0x39, 0xF9, 0x0A, 0xFA, 0x19, 0xFC, 0x2F, 0xFF, 0x93, 0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x29, 0x96,
+    0x69, 0x73, 0x9E, 0x72, 0xAE, 0x97, 0x1A, 0xE7, 0x3A, 0xCA, 0x77, 0x4A, 0xFF, 0xFC, 0x9F, 0xFF,
+    0xD9, 0xFF, 0xFD, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x96, 0x99, 0x73, 0x9E, 0x72, 0xAE,
+    0x97, 0x1A, 0xE7, 0x3A, 0xC9, 0x50, 0x73, 0x96, 0xAF, 0xDA, 0xD4, 0xFF, 0xE3, 0xFF, 0xF2, 0xAF,
+    0xA9, 0x9F, 0xCA, 0x1F, 0xA2, 0xFD, 0x09, 0xF2, 0xAF, 0xD9, 0xAF, 0x19, 0xFE, 0xAA, 0xF1, 0xE0,
+    0xAE, 0xAA, 0xF0, 0xAD, 0x90, 0xAE, 0xAA, 0xF9, 0xE1, 0xFA, 0x9F, 0xE2, 0xF9, 0x0F, 0xD9, 0x19,
+    0xF1, 0xAF, 0xC9, 0x0A, 0xFC, 0x2F, 0xFF, 0x3F, 0xFE, 0x92, 0x9F, 0xFC, 0xA5, 0x9C, 0x29, 0x97,
+    0x76, 0x29, 0x99, 0x99, 0x71, 0x9F, 0xA7, 0x19, 0xF9, 0x72, 0xF7, 0x3A, 0xE7, 0x39, 0x99, 0x77,
+    0x2F, 0x94, 0xAE, 0xAF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF,
+    0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFC, 0xAF,
+    0xA9, 0x9A, 0xFD, 0x9F, 0xFF, 0xD0, 0xAF, 0xF9, 0xF1, 0xAF, 0xD1, 0xAE, 0x49, 0x70, 0x70, 0x99,
+    0x99, 0x71, 0xFC, 0x70, 0xFA, 0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x71, 0x99, 0x97, 0x75, 0xF9, 0x4A,
+    0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF,
+    0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99, 0xAF,
+    0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x00, 0x49, 0x99, 0x99, 0x70,
+    0x9F, 0xC9, 0x7F, 0xE6, 0xF0, 0xF4, 0xEA, 0x2A, 0xE3, 0x99, 0x94, 0x99, 0x97, 0x70, 0xF9, 0x4A,
+    0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF,
+    0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99, 0xAF,
+    0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x00, 0x2D, 0xA2, 0xAD, 0x4A,
+    0xE9, 0x09, 0xEA, 0x3A, 0xE9, 0x09, 0xEA, 0x4A, 0xCA, 0x2A, 0xCA, 0x77, 0x77, 0x0F, 0x94, 0xAE,
+    0xAF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF,
+    0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFC, 0xAF, 0xA9, 0x9A, 0xFD,
+    0x9F, 0xFF, 0xD0, 0xAF, 0xF9, 0xF1, 0xAF, 0xD1, 0xAE, 0x49, 0x70, 0x70, 0x99, 0x99, 0x97, 0x29,
+    0xFA, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xAE, 0x74, 0x99, 0x97, 0x77, 0x0F, 0xA6, 0xF9, 0x9F, 0x59,
+    0xF1, 0xF9, 0x4A, 0xF1, 0xAF, 0x4F, 0x92, 0xF3, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0x9F, 0x2F, 0x5F,
+    0x19, 0xF5, 0xAE, 0x90, 0xAE, 0x96, 0xEA, 0x0F, 0x7F, 0x9E, 0xA7, 0x9E, 0xAE, 0x97, 0x0F, 0xE7,
+    0x1A, 0xFC, 0xA7, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0x97, 0x29, 0xF7, 0x3F, 0xA7, 0xAA, 0xAF, 0xC7,
+    0x0F, 0xEA, 0x70, 0xFD, 0xA7, 0x1F, 0xA9, 0x71, 0x77, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA,
+    0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x0A, 0xFA, 0x3F, 0xAF, 0xF2, 0xFF, 0xFD, 0x1F, 0xD9, 0x99,
+    0xFC, 0x90, 0xFC, 0x4F, 0xA0, 0xFC, 0x4A, 0xF0, 0xFA, 0x4A, 0xF0, 0xFA, 0x49, 0xF0, 0xFA, 0x49,
+    0xF0, 0xFA, 0x4A, 0xF0, 0xFC, 0x4A, 0xF0, 0xFC, 0x4F, 0xA0, 0xFD, 0x99, 0x9F, 0xC9, 0x0F, 0xFF,
+    0xD1, 0xFA, 0xFF, 0x2F, 0x90, 0xFC, 0xA3, 0xFA, 0x29, 0x95, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72,
+    0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0x29, 0xDA, 0x2A, 0xCA, 0x6F, 0x19, 0xE9, 0x5F, 0x19, 0xE9,
+    0x6D, 0x92, 0xAC, 0xA7, 0x77, 0x75, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4,
+    0xF9, 0x2F, 0x39, 0xF3, 0xF9, 0x2A, 0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9,
+    0x6E, 0xA0, 0xF7, 0xF9, 0xEA, 0x79, 0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73,
+    0xFC, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0xFA, 0x7A, 0xAA, 0xFC, 0x70, 0xFE, 0xA7, 0x0F, 0xDA, 0x71,
+    0xFA, 0x97, 0x10, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x2F, 0xFD, 0x72, 0xFF, 0xD7, 0x29, 0x99,
+    0x99, 0x99, 0x99, 0x97, 0x77, 0x71, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F, 0xF7, 0x4F,
+    0xAE, 0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE, 0xA1, 0x9F,
+    0x70, 0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5, 0x9F, 0xFF,
+    0xDA, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F, 0xA7, 0x9F,
+    0x90, 0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xFF,
+    0xCA, 0x4F, 0xFC, 0xA4, 0x99, 0x99, 0x99, 0x99, 0x97, 0x74, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF,
+    0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA,
+    0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC,
+    0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x49, 0x95, 0x99, 0x97, 0x1D,
+    0xA4, 0xE7, 0x1A, 0xFA, 0xF9, 0x72, 0xFF, 0xA7, 0x4F, 0xDA, 0x77, 0x99, 0x77, 0x77, 0x5F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC0, 0x19, 0x99, 0x59, 0x99, 0x29, 0xD9, 0x39, 0xD9, 0x3F, 0xAA, 0xF4, 0x9F, 0xF9, 0x59, 0xFD,
+    0x97, 0x19, 0x97, 0x77, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9,
+    0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F,
+    0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC,
+    0xA1, 0xE9, 0x39, 0x97, 0x00, 0x6F, 0xD7, 0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA,
+    0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7,
+    0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD,
+    0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9,
+    0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC7, 0x79, 0xDA, 0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77,
+    0x1E, 0x77, 0x1F, 0xD7, 0x69, 0xFC, 0x77, 0x0A, 0xCA, 0x90, 0x77, 0x1A, 0xFE, 0xA4, 0xFF, 0xE3,
+    0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF, 0xF9, 0x0F,
+    0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F, 0xC9, 0x9F,
+    0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x39, 0xD9, 0x71, 0x9D, 0xA7,
+    0x2E, 0x73, 0xE7, 0x3F, 0xCA, 0x70, 0x9F, 0xC7, 0x19, 0xAC, 0xA9, 0x72, 0x99, 0x99, 0x97, 0x2A,
+    0xF7, 0x2A, 0xF7, 0x29, 0xEA, 0x73, 0xEA, 0x74, 0x99, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x49, 0xFF,
+    0xEA, 0x29, 0xFF, 0xF9, 0x19, 0xFD, 0xAA, 0xAF, 0x2F, 0xCA, 0x59, 0x91, 0x9F, 0xA7, 0x2F, 0xC7,
+    0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x73, 0x9F, 0x97, 0x29, 0xF9, 0x73, 0xFA, 0x73,
+    0xFC, 0x73, 0xAF, 0x97, 0x3F, 0xC9, 0x69, 0x2A, 0xFD, 0xA9, 0x9A, 0xE3, 0xFF, 0xFC, 0x4A, 0xFF,
+    0xE5, 0x9A, 0xFF, 0x97, 0x19, 0x99, 0x40, 0x70, 0x99, 0x99, 0x70, 0xFA, 0x7F, 0xA7, 0xAE, 0x97,
+    0xAE, 0x71, 0x99, 0x97, 0x77, 0x9F, 0xE9, 0x3F, 0xFD, 0x2F, 0xFD, 0xA1, 0xAF, 0xC9, 0x99, 0xAC,
+    0x2F, 0xC7, 0x9F, 0x97, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xFA, 0x70,
+    0xFD, 0x99, 0x9A, 0xD2, 0xFF, 0xE2, 0x9F, 0xFD, 0x4A, 0xFD, 0xA7, 0x09, 0x94, 0x79, 0x99, 0x97,
+    0x3F, 0xCA, 0x71, 0xFE, 0x97, 0xAE, 0x9A, 0xE9, 0x5A, 0xE2, 0x9E, 0x94, 0x99, 0x95, 0x99, 0x77,
+    0x70, 0x9A, 0xFD, 0xA9, 0x49, 0xFF, 0xEA, 0x29, 0xFF, 0xF9, 0x19, 0xFD, 0xAA, 0xAF, 0x2F, 0xCA,
+    0x59, 0x91, 0x9F, 0xA7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x73, 0x9F,
+    0x97, 0x29, 0xF9, 0x73, 0xFA, 0x73, 0xFC, 0x73, 0xAF, 0x97, 0x3F, 0xC9, 0x69, 0x2A, 0xFD, 0xA9,
+    0x9A, 0xE3, 0xFF, 0xFC, 0x4A, 0xFF, 0xE5, 0x9A, 0xFF, 0x97, 0x19, 0x99, 0x40, 0x49, 0x99, 0x99,
+    0x79, 0xFC, 0x96, 0xFE, 0x5F, 0x0F, 0x3E, 0xA2, 0xAE, 0x29, 0x95, 0x99, 0x97, 0x72, 0x9F, 0xE9,
+    0x3F, 0xFD, 0x2F, 0xFD, 0xA1, 0xAF, 0xC9, 0x99, 0xAC, 0x2F, 0xC7, 0x9F, 0x97, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xFA, 0x70, 0xFD, 0x99, 0x9A, 0xD2, 0xFF, 0xE2, 0x9F,
+    0xFD, 0x4A, 0xFD, 0xA7, 0x09, 0x94, 0x77, 0x70, 0xEA, 0x73, 0xAF, 0x73, 0x9F, 0x74, 0xEA, 0x77,
+    0x77, 0x74, 0x9A, 0xFD, 0xA9, 0x49, 0xFF, 0xEA, 0x29, 0xFF, 0xF9, 0x19, 0xFD, 0xAA, 0xAF, 0x2F,
+    0xCA, 0x59, 0x91, 0x9F, 0xA7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x73,
+    0x9F, 0x97, 0x29, 0xF9, 0x73, 0xFA, 0x73, 0xFC, 0x73, 0xAF, 0x97, 0x3F, 0xC9, 0x69, 0x2A, 0xFD,
+    0xA9, 0x9A, 0xE3, 0xFF, 0xFC, 0x4A, 0xFF, 0xE5, 0x9A, 0xFF, 0x97, 0x19, 0x99, 0x40, 0x77, 0x29,
+    0xE9, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x77, 0x73, 0x9F, 0xE9, 0x3F, 0xFD, 0x2F, 0xFD,
+    0xA1, 0xAF, 0xC9, 0x99, 0xAC, 0x2F, 0xC7, 0x9F, 0x97, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0x9F, 0x71, 0xFA, 0x70, 0xFD, 0x99, 0x9A, 0xD2, 0xFF, 0xE2, 0x9F, 0xFD, 0x4A, 0xFD, 0xA7,
+    0x09, 0x94, 0x39, 0x99, 0x59, 0x99, 0x4A, 0xE3, 0xAE, 0x5A, 0xE9, 0x0F, 0x7A, 0xFE, 0x71, 0xFD,
+    0x97, 0x29, 0x99, 0x99, 0x77, 0x72, 0x9A, 0xFD, 0xA9, 0x49, 0xFF, 0xEA, 0x29, 0xFF, 0xF9, 0x19,
+    0xFD, 0xAA, 0xAF, 0x2F, 0xCA, 0x59, 0x91, 0x9F, 0xA7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3F, 0x97, 0x29,
+    0xF9, 0x72, 0x9F, 0x73, 0x9F, 0x97, 0x29, 0xF9, 0x73, 0xFA, 0x73, 0xFC, 0x73, 0xAF, 0x97, 0x3F,
+    0xC9, 0x69, 0x2A, 0xFD, 0xA9, 0x9A, 0xE3, 0xFF, 0xFC, 0x4A, 0xFF, 0xE5, 0x9A, 0xFF, 0x97, 0x19,
+    0x99, 0x40, 0x19, 0x99, 0x59, 0x99, 0x1E, 0xA2, 0x9E, 0xA2, 0xF0, 0xAE, 0xA4, 0xFE, 0xA5, 0x9F,
+    0xD7, 0x99, 0x99, 0x97, 0x75, 0x9F, 0xE9, 0x3F, 0xFD, 0x2F, 0xFD, 0xA1, 0xAF, 0xC9, 0x99, 0xAC,
+    0x2F, 0xC7, 0x9F, 0x97, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xFA, 0x70,
+    0xFD, 0x99, 0x9A, 0xD2, 0xFF, 0xE2, 0x9F, 0xFD, 0x4A, 0xFD, 0xA7, 0x09, 0x94, 0x29, 0x99, 0x59,
+    0x99, 0x5A, 0xE3, 0xEA, 0x6F, 0x99, 0xF7, 0x0F, 0xF7, 0x2F, 0xD7, 0x49, 0x99, 0x97, 0x77, 0x09,
+    0xFF, 0xAA, 0x95, 0xAF, 0xFF, 0x93, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xFD, 0xA1, 0xAF, 0x4A, 0xFC,
+    0x90, 0xAF, 0x59, 0xFC, 0x0A, 0xF6, 0xAF, 0x9A, 0xF6, 0x9F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xCA,
+    0xF7, 0xFC, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x69, 0xF9, 0xAF, 0x6A, 0xF0, 0xAF, 0x59, 0xFC,
+    0x0A, 0xF4, 0xAF, 0xC9, 0x0A, 0xFA, 0xAA, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xF9, 0x3A,
+    0xFF, 0xCA, 0x95, 0x77, 0x77, 0x0F, 0x90, 0xAE, 0x97, 0x2F, 0x90, 0xAE, 0x73, 0xF9, 0x0E, 0x97,
+    0x3F, 0x90, 0xE7, 0x4F, 0x90, 0xAA, 0x75, 0xF9, 0x70, 0x9F, 0xC9, 0x0F, 0x97, 0xAF, 0xE9, 0xF9,
+    0x69, 0xFF, 0xFC, 0x96, 0xFC, 0xA9, 0x9A, 0xFC, 0x96, 0xFA, 0x3A, 0xF9, 0x59, 0xF5, 0xF9, 0x5A,
+    0xF5, 0xF9, 0x5A, 0xF5, 0xF9, 0x5A, 0xF5, 0xF9, 0x5A, 0xF5, 0xF9, 0x59, 0xF5, 0xF9, 0x6F, 0xA3,
+    0x9F, 0x96, 0xFC, 0xA9, 0x9A, 0xFC, 0x96, 0x9F, 0xFF, 0xC9, 0x7A, 0xFE, 0x9A, 0xE9, 0x70, 0xAF,
+    0xC9, 0x09, 0xE9, 0x73, 0x97, 0x60, 0x19, 0xFF, 0xAA, 0x70, 0x9F, 0xFF, 0x95, 0x9F, 0xFF, 0xCA,
+    0x49, 0xFF, 0xFD, 0xA3, 0x9F, 0x4A, 0xFC, 0x92, 0x9F, 0x59, 0xFC, 0x29, 0xF6, 0xAF, 0x91, 0x9F,
+    0x69, 0xFA, 0x1A, 0xF7, 0xFA, 0x9F, 0xFD, 0x3F, 0xC9, 0xFF, 0xD3, 0xFC, 0x9F, 0xFD, 0x3F, 0xA0,
+    0xAA, 0xFA, 0xAA, 0x93, 0xFA, 0x19, 0xF6, 0x9F, 0x91, 0x9F, 0x6A, 0xF2, 0x9F, 0x59, 0xFC, 0x29,
+    0xF4, 0xAF, 0xC9, 0x29, 0xFA, 0xAA, 0xFE, 0xA3, 0x9F, 0xFF, 0xCA, 0x49, 0xFF, 0xF9, 0x59, 0xFF,
+    0xCA, 0x95, 0x77, 0x74, 0xF9, 0x74, 0xF9, 0x79, 0xFF, 0xD9, 0x5A, 0xFF, 0xDA, 0x5A, 0xFF, 0xDA,
+    0x72, 0xF9, 0x79, 0x3F, 0x94, 0xAF, 0xCA, 0x0F, 0x93, 0xAF, 0xEA, 0xF9, 0x2A, 0xFF, 0xFC, 0x92,
+    0xFC, 0xA9, 0x9A, 0xFC, 0x91, 0x9F, 0xC3, 0xAF, 0x91, 0x9F, 0x94, 0xF9, 0x1A, 0xF5, 0xF9, 0x1A,
+    0xF5, 0xF9, 0x1A, 0xF9, 0x4F, 0x91, 0x9F, 0x94, 0xF9, 0x19, 0xFC, 0x39, 0xF9, 0x2F, 0xCA, 0x99,
+    0x9F, 0xC9, 0x2A, 0xFF, 0xFC, 0x93, 0xFF, 0x9F, 0x94, 0xAF, 0xC1, 0xAE, 0x97, 0x97, 0x20, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xCA, 0x2F, 0xFC, 0xA2, 0x99, 0x99, 0x99, 0x99, 0x97, 0x69,
+    0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79,
+    0xFA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79, 0xF7, 0x9F,
+    0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA,
+    0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xCA, 0x5F, 0xFC, 0xA5, 0x99, 0x99, 0x99, 0x99, 0x97,
+    0x77, 0xAF, 0xD9, 0x6F, 0xFD, 0x4F, 0xFF, 0x2A, 0xF9, 0x19, 0xF9, 0x1F, 0x93, 0x9F, 0x09, 0xF5,
+    0xF0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0x72, 0x9F, 0x73, 0xFA, 0x72,
+    0xAF, 0xA4, 0xAC, 0x3F, 0xFF, 0x4F, 0xFE, 0x5A, 0xFF, 0x97, 0x19, 0x95, 0x09, 0x99, 0x59, 0x99,
+    0x09, 0xD4, 0x9D, 0x91, 0xFA, 0xAF, 0x29, 0xFF, 0x93, 0x9F, 0xD9, 0x79, 0x97, 0x71, 0x9F, 0xFE,
+    0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA0, 0x19,
+    0x99, 0x59, 0x99, 0x39, 0xD9, 0x39, 0xD9, 0x4F, 0xAA, 0xF5, 0x9F, 0xF9, 0x69, 0xFD, 0x97, 0x29,
+    0x97, 0x77, 0x2A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0,
+    0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F,
+    0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50, 0x77, 0x1E,
+    0xA7, 0xAF, 0x7A, 0xF7, 0x0E, 0xA7, 0x77, 0x59, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F,
+    0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xE0, 0x9F,
+    0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA,
+    0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x77, 0x5E, 0xA7, 0x2A, 0xF7, 0x2A, 0xF7, 0x3E,
+    0xA7, 0x77, 0x77, 0x1A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39,
+    0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7,
+    0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50, 0x9F,
+    0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7,
+    0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA7,
+    0x9D, 0x97, 0x9D, 0x97, 0x0E, 0x71, 0xE7, 0x1F, 0xCA, 0x6A, 0xFA, 0x79, 0xAC, 0xA9, 0x77, 0x3A,
+    0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A,
+    0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA,
+    0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0x9F, 0xFA, 0x71, 0x9A, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x4E,
+    0x74, 0xFA, 0xA7, 0x19, 0xFC, 0x72, 0x9E, 0xA1, 0x09, 0x99, 0x59, 0x99, 0x1A, 0xE3, 0xEA, 0x2F,
+    0x99, 0xEA, 0x4F, 0xF6, 0xFD, 0x70, 0x99, 0x99, 0x77, 0x29, 0xFF, 0xEA, 0x09, 0xFF, 0xEA, 0x09,
+    0xFF, 0xEA, 0x09, 0xFF, 0xE9, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x19, 0xFF, 0xE1, 0x9F, 0xFE, 0x19, 0xFF, 0xE1, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70,
+    0x9F, 0x70, 0x9F, 0x70, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x09, 0xFF, 0xEA, 0x09, 0xFF, 0xEA, 0x09,
+    0xFF, 0xEA, 0x00, 0x19, 0x99, 0x59, 0x99, 0x3A, 0xE3, 0xF4, 0xAE, 0x99, 0xF6, 0xFF, 0x70, 0xFD,
+    0x72, 0x99, 0x99, 0x77, 0x71, 0xAF, 0xD9, 0x6F, 0xFD, 0x4F, 0xFF, 0x2A, 0xF9, 0x19, 0xF9, 0x1F,
+    0x93, 0x9F, 0x09, 0xF5, 0xF0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0x72,
+    0x9F, 0x73, 0xFA, 0x72, 0xAF, 0xA4, 0xAC, 0x3F, 0xFF, 0x4F, 0xFE, 0x5A, 0xFF, 0x97, 0x19, 0x95,
+    0x79, 0x99, 0x99, 0x73, 0x9F, 0xC9, 0x72, 0xFE, 0x71, 0xF0, 0xF7, 0xEA, 0x2A, 0xE6, 0x99, 0x94,
+    0x99, 0x97, 0x77, 0x2A, 0xFE, 0xA9, 0x5A, 0xFF, 0xEA, 0x3F, 0xFF, 0xC3, 0xFE, 0xAA, 0xAF, 0x2F,
+    0xD9, 0x59, 0x91, 0x9F, 0xC7, 0x3A, 0xF7, 0x4F, 0xC7, 0x4F, 0x97, 0x39, 0xF9, 0x29, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0x92, 0x9F, 0xF9, 0xF9, 0x29, 0xFF, 0x0F, 0x92, 0x9F, 0xF0, 0xFA, 0x6A, 0xF0,
+    0xFC, 0x6A, 0xF0, 0xAF, 0x95, 0xAF, 0x1F, 0xC9, 0x4A, 0xF1, 0xAF, 0xDA, 0x99, 0xAF, 0xC2, 0xFF,
+    0xFE, 0x3A, 0xFF, 0xFC, 0x49, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x50, 0x59, 0x99, 0x97, 0x2F, 0xD7,
+    0x0A, 0xFD, 0xA6, 0xAE, 0x99, 0xE9, 0x49, 0xE9, 0x19, 0xE9, 0x39, 0x99, 0x59, 0x99, 0x77, 0x49,
+    0xFC, 0x90, 0x9E, 0x91, 0xAF, 0xEA, 0xAE, 0x90, 0x9F, 0xFF, 0xC9, 0x0F, 0xCA, 0x99, 0xAF, 0xC9,
+    0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9,
+    0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x19, 0xFC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFE,
+    0xAF, 0x92, 0xAF, 0xC9, 0x0F, 0x95, 0x93, 0xF9, 0x71, 0x9F, 0x19, 0x7F, 0xC1, 0xAD, 0xAA, 0x99,
+    0xAF, 0xCA, 0x1A, 0xFF, 0xF2, 0xAF, 0xFE, 0x49, 0xAF, 0xDA, 0x93, 0x49, 0x99, 0x59, 0x96, 0xAD,
+    0x49, 0xD9, 0x6F, 0xAF, 0xC7, 0xAF, 0xF9, 0x70, 0x9F, 0xD7, 0x59, 0x97, 0x77, 0x6A, 0xFE, 0xA9,
+    0x5A, 0xFF, 0xEA, 0x3F, 0xFF, 0xC3, 0xFE, 0xAA, 0xAF, 0x2F, 0xD9, 0x59, 0x91, 0x9F, 0xC7, 0x3A,
+    0xF7, 0x4F, 0xC7, 0x4F, 0x97, 0x39, 0xF9, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0x92, 0x9F, 0xF9,
+    0xF9, 0x29, 0xFF, 0x0F, 0x92, 0x9F, 0xF0, 0xFA, 0x6A, 0xF0, 0xFC, 0x6A, 0xF0, 0xAF, 0x95, 0xAF,
+    0x1F, 0xC9, 0x4A, 0xF1, 0xAF, 0xDA, 0x99, 0xAF, 0xC2, 0xFF, 0xFE, 0x3A, 0xFF, 0xFC, 0x49, 0xAF,
+    0xFA, 0x97, 0x19, 0x99, 0x50, 0x29, 0x95, 0x99, 0x94, 0xD9, 0x4D, 0xA4, 0xFC, 0xAF, 0x95, 0xFF,
+    0xA7, 0xFD, 0x97, 0x29, 0x97, 0x77, 0x19, 0xFC, 0x90, 0x9E, 0x91, 0xAF, 0xEA, 0xAE, 0x90, 0x9F,
+    0xFF, 0xC9, 0x0F, 0xCA, 0x99, 0xAF, 0xC9, 0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A,
+    0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x19,
+    0xFC, 0x90, 0x9F, 0xFF, 0xC9, 0x1A, 0xFE, 0xAF, 0x92, 0xAF, 0xC9, 0x0F, 0x95, 0x93, 0xF9, 0x71,
+    0x9F, 0x19, 0x7F, 0xC1, 0xAD, 0xAA, 0x99, 0xAF, 0xCA, 0x1A, 0xFF, 0xF2, 0xAF, 0xFE, 0x49, 0xAF,
+    0xDA, 0x93, 0x77, 0x72, 0xEA, 0x74, 0xAF, 0x74, 0xAF, 0x75, 0xE9, 0x77, 0x77, 0x77, 0xAF, 0xEA,
+    0x95, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x3F, 0xEA, 0xAA, 0xF2, 0xFD, 0x95, 0x99, 0x19, 0xFC, 0x73,
+    0xAF, 0x74, 0xFC, 0x74, 0xF9, 0x73, 0x9F, 0x92, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xF9, 0x29, 0xFF,
+    0x9F, 0x92, 0x9F, 0xF0, 0xF9, 0x29, 0xFF, 0x0F, 0xA6, 0xAF, 0x0F, 0xC6, 0xAF, 0x0A, 0xF9, 0x5A,
+    0xF1, 0xFC, 0x94, 0xAF, 0x1A, 0xFD, 0xA9, 0x9A, 0xFC, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xC4, 0x9A,
+    0xFF, 0xA9, 0x71, 0x99, 0x95, 0x77, 0x5F, 0x72, 0x9F, 0x97, 0x19, 0xF9, 0x72, 0xAD, 0xA7, 0x77,
+    0x77, 0x09, 0xFC, 0x90, 0x9E, 0x91, 0xAF, 0xEA, 0xAE, 0x90, 0x9F, 0xFF, 0xC9, 0x0F, 0xCA, 0x99,
+    0xAF, 0xC9, 0x0F, 0xA3, 0xAF, 0x99, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A,
+    0xF5, 0xF9, 0x9F, 0x5F, 0x90, 0xFA, 0x39, 0xF9, 0x0F, 0xCA, 0x19, 0xFC, 0x90, 0x9F, 0xFF, 0xC9,
+    0x1A, 0xFE, 0xAF, 0x92, 0xAF, 0xC9, 0x0F, 0x95, 0x93, 0xF9, 0x71, 0x9F, 0x19, 0x7F, 0xC1, 0xAD,
+    0xAA, 0x99, 0xAF, 0xCA, 0x1A, 0xFF, 0xF2, 0xAF, 0xFE, 0x49, 0xAF, 0xDA, 0x93, 0x77, 0x70, 0xAF,
+    0xEA, 0x95, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x3F, 0xEA, 0xAA, 0xF2, 0xFD, 0x95, 0x99, 0x19, 0xFC,
+    0x73, 0xAF, 0x74, 0xFC, 0x74, 0xF9, 0x73, 0x9F, 0x92, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xF9, 0x29,
+    0xFF, 0x9F, 0x92, 0x9F, 0xF0, 0xF9, 0x29, 0xFF, 0x0F, 0xA6, 0xAF, 0x0F, 0xC6, 0xAF, 0x0A, 0xF9,
+    0x5A, 0xF1, 0xFC, 0x94, 0xAF, 0x1A, 0xFD, 0xA9, 0x9A, 0xFC, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xC4,
+    0x9A, 0xFF, 0xA9, 0x71, 0x99, 0x97, 0x77, 0x70, 0xF7, 0x49, 0xE9, 0x74, 0xAE, 0x75, 0xE7, 0x69,
+    0x99, 0x60, 0x79, 0x99, 0x73, 0x9D, 0xA7, 0x3E, 0x97, 0x29, 0xE7, 0x3F, 0x73, 0x99, 0x99, 0x77,
+    0x70, 0x9F, 0xC9, 0x09, 0xE9, 0x1A, 0xFE, 0xAA, 0xE9, 0x09, 0xFF, 0xFC, 0x90, 0xFC, 0xA9, 0x9A,
+    0xFC, 0x90, 0xFA, 0x3A, 0xF9, 0x9F, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF,
+    0x5F, 0x99, 0xF5, 0xF9, 0x0F, 0xA3, 0x9F, 0x90, 0xFC, 0xA1, 0x9F, 0xC9, 0x09, 0xFF, 0xFC, 0x91,
+    0xAF, 0xEA, 0xF9, 0x2A, 0xFC, 0x90, 0xF9, 0x59, 0x3F, 0x97, 0x19, 0xF1, 0x97, 0xFC, 0x1A, 0xDA,
+    0xA9, 0x9A, 0xFC, 0xA1, 0xAF, 0xFF, 0x2A, 0xFF, 0xE4, 0x9A, 0xFD, 0xA9, 0x30, 0x69, 0x99, 0x97,
+    0x4A, 0xFC, 0x72, 0xAF, 0xDA, 0x70, 0x9E, 0x99, 0xEA, 0x69, 0xE9, 0x19, 0xE9, 0x59, 0x99, 0x59,
+    0x99, 0x77, 0x49, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7,
+    0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF,
+    0xA9, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9,
+    0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7, 0xAE, 0xA9, 0xF7,
+    0xAE, 0xA9, 0xF7, 0xAE, 0xA0, 0x39, 0x99, 0x99, 0x74, 0x9F, 0xC7, 0x4F, 0xE7, 0x2E, 0xA0, 0xF7,
+    0x0E, 0xA2, 0xF7, 0x99, 0x59, 0x99, 0x77, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA, 0x75, 0xFA, 0x75,
+    0xFA, 0x75, 0xFA, 0x75, 0xF9, 0x0A, 0xFC, 0x95, 0xF9, 0xFF, 0xA4, 0xFF, 0xFD, 0x93, 0xFD, 0xA9,
+    0x9F, 0xCA, 0x3F, 0xC9, 0x3F, 0xC3, 0xFC, 0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA,
+    0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A,
+    0xF3, 0xFA, 0x4A, 0xF3, 0xFA, 0x4A, 0xF0, 0x19, 0xF7, 0xAE, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F,
+    0xA2, 0xFF, 0xFF, 0xFD, 0x9F, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xFD, 0x91, 0x9F, 0x7F, 0xA4, 0x9F,
+    0x7F, 0xA4, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x49, 0xFF, 0xFF, 0xA4, 0x9F, 0xFF, 0xFA, 0x49,
+    0xFF, 0xFF, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F,
+    0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA4, 0x9F, 0x7F, 0xA2, 0x77, 0x2A,
+    0xEA, 0x73, 0xAE, 0xA7, 0x1F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x7A, 0xEA, 0x73, 0xAE, 0xA2, 0x99,
+    0x6A, 0xEA, 0x0A, 0xFC, 0xA3, 0xAE, 0xAF, 0xFC, 0x2A, 0xFF, 0xFC, 0x91, 0xAF, 0xC9, 0x1A, 0xFC,
+    0x1A, 0xF9, 0x3A, 0xF1, 0xAF, 0x49, 0xF1, 0xAF, 0x49, 0xF1, 0xAE, 0xA4, 0x9F, 0x1A, 0xEA, 0x49,
+    0xF1, 0xAE, 0xA4, 0x9F, 0x1A, 0xEA, 0x49, 0xF1, 0xAE, 0xA4, 0x9F, 0x1A, 0xEA, 0x49, 0xF1, 0xAE,
+    0xA4, 0x9F, 0x1A, 0xEA, 0x49, 0xF0, 0x75, 0xEA, 0x2A, 0xD0, 0xFD, 0xAA, 0xDA, 0xAF, 0xFD, 0x0D,
+    0xA1, 0x9F, 0x90, 0x99, 0x49, 0x97, 0x70, 0xFF, 0xC9, 0x1F, 0xFC, 0x91, 0xFF, 0xC9, 0x29, 0xFC,
+    0xA5, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6,
+    0xAF, 0x6A, 0xF6, 0xAF, 0x6F, 0xC9, 0x3F, 0xFC, 0x91, 0xFF, 0xC9, 0x1F, 0xFC, 0x90, 0x76, 0x9E,
+    0x92, 0xD9, 0x09, 0xFD, 0xAE, 0x1F, 0xFD, 0xA0, 0x9D, 0x2A, 0xF2, 0x99, 0x49, 0x77, 0x4F, 0xA7,
+    0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA,
+    0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xCA, 0x0F,
+    0xFC, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x97, 0x4F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F,
+    0xCA, 0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF,
+    0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xC0, 0x9F, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x76, 0xFA, 0x5F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA2, 0x99, 0x95, 0x99, 0x0A, 0xD4, 0x9D, 0x90, 0xFA, 0xFC, 0x1A,
+    0xFF, 0x92, 0x9F, 0xD7, 0x99, 0x77, 0x1F, 0xFC, 0x91, 0xFF, 0xC9, 0x1F, 0xFC, 0x92, 0x9F, 0xCA,
+    0x5A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x6A,
+    0xF6, 0xAF, 0x6A, 0xF6, 0xFC, 0x93, 0xFF, 0xC9, 0x1F, 0xFC, 0x91, 0xFF, 0xC9, 0x00, 0x99, 0x95,
+    0x99, 0x0E, 0x4A, 0xD0, 0x9F, 0xAF, 0xA1, 0xFF, 0xC3, 0xAF, 0xCA, 0x79, 0x97, 0x73, 0xFA, 0x6F,
+    0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6,
+    0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA3, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F, 0xCA,
+    0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A,
+    0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x5E, 0x6A, 0xD6,
+    0x9D, 0xA6, 0xAD, 0xA6, 0x9F, 0xC9, 0x4F, 0xC9, 0x5A, 0xAA, 0xA0, 0x6A, 0xE9, 0x0F, 0xA0, 0xFA,
+    0x09, 0xE7, 0x5F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0,
+    0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x1D, 0xA1, 0xE1, 0xAD, 0x91, 0xE9,
+    0x1A, 0xFC, 0x0F, 0xC1, 0xAA, 0xAA, 0x76, 0xEA, 0x5A, 0xF5, 0xAF, 0x6E, 0x97, 0x77, 0x1F, 0xFC,
+    0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F, 0xCA, 0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5,
+    0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9,
+    0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+    0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x0F, 0xFC, 0x92, 0xAE, 0xA0, 0xFF, 0xC9, 0x2A, 0xEA, 0x0F, 0xFC,
+    0x92, 0xAE, 0xA1, 0x9F, 0xCA, 0x4A, 0xEA, 0x2A, 0xF5, 0xAE, 0xA2, 0xAF, 0x5A, 0xEA, 0x2A, 0xF5,
+    0xAE, 0xA2, 0xAF, 0x5A, 0xEA, 0x2A, 0xF5, 0xAE, 0xA2, 0xAF, 0x5A, 0xEA, 0x2A, 0xF5, 0xAE, 0xA2,
+    0xAF, 0x5A, 0xEA, 0x2A, 0xF5, 0xAE, 0xA2, 0xAF, 0x5A, 0xEA, 0x2A, 0xF5, 0xAE, 0xA2, 0xAF, 0x5A,
+    0xEA, 0x2A, 0xF5, 0xAE, 0xA2, 0xFC, 0x94, 0xAE, 0xA0, 0xFF, 0xC9, 0x2A, 0xEA, 0x0F, 0xFC, 0x92,
+    0xAE, 0xA0, 0xFF, 0xC9, 0x2A, 0xEA, 0x75, 0xFA, 0x74, 0x9F, 0x97, 0x09, 0xAA, 0xAF, 0xC7, 0x19,
+    0xFE, 0xA7, 0x19, 0xFD, 0xA7, 0x29, 0xFC, 0x97, 0x75, 0x77, 0xAE, 0x93, 0xAE, 0x1F, 0xA3, 0xFA,
+    0x0F, 0xA3, 0xFA, 0x09, 0xE4, 0xAE, 0x77, 0x77, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F,
+    0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90,
+    0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA,
+    0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xFA, 0x3F, 0x97, 0x1F, 0x97, 0x1F, 0x97, 0x1F, 0x95, 0x9A, 0xAF,
+    0xC6, 0xAF, 0xE6, 0xAF, 0xD7, 0x9F, 0xA2, 0x59, 0x99, 0x97, 0x0F, 0xCA, 0x6F, 0xE9, 0x4A, 0xE0,
+    0xAE, 0x92, 0xAE, 0x2A, 0xE2, 0x99, 0x95, 0x99, 0x77, 0x39, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09,
+    0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA4, 0xAA, 0xAF, 0xC9, 0x4F, 0xF5, 0xFE, 0x6F, 0xCA, 0x77,
+    0x40, 0x39, 0x99, 0x97, 0x9F, 0xC5, 0x9F, 0xE4, 0xEA, 0x0F, 0x2E, 0xA2, 0xEA, 0x19, 0x95, 0x99,
+    0x97, 0x71, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F,
+    0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xF9, 0x39, 0xAA,
+    0xFC, 0x93, 0xAF, 0xE4, 0xAF, 0xD9, 0x49, 0xFA, 0x60, 0x9F, 0x6A, 0xF0, 0x9F, 0x5A, 0xF9, 0x09,
+    0xF4, 0x9F, 0x91, 0x9F, 0x39, 0xFA, 0x29, 0xF3, 0xFC, 0x39, 0xF2, 0xFC, 0x49, 0xF1, 0xAF, 0x94,
+    0x9F, 0x09, 0xFA, 0x59, 0xF0, 0xFA, 0x69, 0xFF, 0xC7, 0x9F, 0xFC, 0xA6, 0x9F, 0xFD, 0x95, 0x9F,
+    0xCA, 0xFC, 0x59, 0xF9, 0x09, 0xFA, 0x49, 0xF2, 0xAF, 0x93, 0x9F, 0x3F, 0xC3, 0x9F, 0x39, 0xFA,
+    0x29, 0xF4, 0xFC, 0x29, 0xF5, 0xFC, 0x19, 0xF5, 0xAF, 0x90, 0x9F, 0x6F, 0xC7, 0x77, 0x77, 0x2A,
+    0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x75, 0xE7, 0x69, 0x97, 0x10, 0x77, 0x0A, 0xEA, 0x73, 0xAE, 0xA7,
+    0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x4A, 0xF9, 0x0A, 0xEA,
+    0x3A, 0xF9, 0x1A, 0xEA, 0x29, 0xF9, 0x2A, 0xEA, 0x19, 0xFA, 0x3A, 0xEA, 0x09, 0xFA, 0x4A, 0xEA,
+    0x0F, 0xA5, 0xAE, 0xAF, 0xC6, 0xAF, 0xFC, 0x6A, 0xFF, 0xCA, 0x5A, 0xFF, 0xD9, 0x4A, 0xF9, 0x0F,
+    0xC4, 0xAE, 0xA2, 0xFA, 0x3A, 0xEA, 0x29, 0xF9, 0x2A, 0xEA, 0x3A, 0xF2, 0xAE, 0xA4, 0xFC, 0x1A,
+    0xEA, 0x49, 0xFA, 0x77, 0x77, 0x7A, 0xE9, 0x73, 0xAE, 0x74, 0xE9, 0x74, 0xE7, 0x59, 0x97, 0x10,
+    0xAE, 0xA4, 0x9F, 0x90, 0xAE, 0xA4, 0xF9, 0x1A, 0xEA, 0x3F, 0xA2, 0xAE, 0xA2, 0xFA, 0x3A, 0xEA,
+    0x1A, 0xF4, 0xAE, 0xA0, 0xAF, 0x5A, 0xEA, 0x9F, 0x6A, 0xFF, 0xA6, 0xAF, 0xFC, 0x95, 0xAF, 0xFD,
+    0x5A, 0xFA, 0x0F, 0xC4, 0xAE, 0xA2, 0xFA, 0x3A, 0xEA, 0x29, 0xF9, 0x2A, 0xEA, 0x3A, 0xF2, 0xAE,
+    0xA4, 0xFC, 0x1A, 0xEA, 0x49, 0xFA, 0x00, 0x39, 0x99, 0x97, 0x0F, 0xC7, 0xAE, 0xA7, 0xAE, 0xA7,
+    0x9E, 0x97, 0x19, 0x97, 0x77, 0x09, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A,
+    0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A,
+    0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0x9A,
+    0xFF, 0xF9, 0xAF, 0xFF, 0x90, 0x39, 0x99, 0x99, 0x4F, 0xA3, 0xFA, 0x3F, 0x93, 0xAE, 0x59, 0x99,
+    0x77, 0x0F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA,
+    0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F, 0xA4, 0xFA, 0x4F,
+    0xA4, 0xFA, 0x30, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A,
+    0xFF, 0xF9, 0x77, 0x77, 0x0F, 0x71, 0xF7, 0x1E, 0x97, 0x09, 0xDA, 0x72, 0x99, 0x60, 0x6F, 0xA0,
+    0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA,
+    0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x74,
+    0x9E, 0xA0, 0x9E, 0x1A, 0xDA, 0x1E, 0x29, 0x99, 0x10, 0x9F, 0x4F, 0x0A, 0xF4, 0xEA, 0x0A, 0xF3,
+    0x9E, 0x1A, 0xF3, 0xAD, 0xA1, 0xAF, 0x3A, 0xD2, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFF, 0x90, 0xAF, 0xFF, 0x90, 0xAF, 0xFF, 0x90, 0x72,
+    0xFA, 0x09, 0xEA, 0xFA, 0x0A, 0xE0, 0xFA, 0x0A, 0xDA, 0x0F, 0xA0, 0xE1, 0xFA, 0x0A, 0xA9, 0x1F,
+    0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x2A, 0xE1, 0xAF, 0x2F, 0xA0, 0xAF,
+    0x2F, 0xA0, 0xAF, 0x29, 0xE1, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0x72, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA0, 0xEA, 0x0F, 0xAA, 0xF0,
+    0xFA, 0xAF, 0x0F, 0xA0, 0xE9, 0x0F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5,
+    0xFA, 0x5F, 0xA5, 0x19, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29,
+    0xF0, 0x97, 0x09, 0xFE, 0x79, 0xFE, 0x96, 0x9F, 0xE7, 0xFD, 0x96, 0x9F, 0xD7, 0x0A, 0xFD, 0x71,
+    0xFD, 0x71, 0x99, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xFA, 0xAA, 0xAA, 0xAA, 0xA9, 0x19, 0xFF,
+    0xF9, 0x19, 0xFF, 0xF9, 0x19, 0xFF, 0xF9, 0x75, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5,
+    0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAF, 0xA4, 0xAF, 0xC9, 0x3A, 0xFD, 0x3F, 0xD9,
+    0x1A, 0xFD, 0x3F, 0xDA, 0x39, 0xFC, 0xA4, 0xAF, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE, 0xA5, 0xAE,
+    0xA5, 0xAE, 0xA5, 0xAE, 0xA2, 0x72, 0x99, 0x99, 0x76, 0xFC, 0x75, 0xAF, 0x75, 0x9E, 0xA7, 0x59,
+    0xE9, 0x77, 0x99, 0x77, 0x75, 0x9F, 0xC9, 0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xDA, 0x6F, 0x09,
+    0xFE, 0x6F, 0x09, 0xFE, 0xA5, 0xF0, 0x9F, 0xF9, 0x4F, 0x09, 0xE9, 0xFC, 0x4F, 0x09, 0xE9, 0x9F,
+    0x93, 0xF0, 0x9E, 0x90, 0xAF, 0x3F, 0x09, 0xEA, 0x1F, 0xA2, 0xF0, 0x9E, 0xA1, 0xAF, 0x2F, 0x09,
+    0xEA, 0x2F, 0xC1, 0xF0, 0x9E, 0xA2, 0x9F, 0x90, 0xF0, 0x9E, 0xA3, 0xFC, 0x0F, 0x09, 0xEA, 0x39,
+    0xF9, 0xAE, 0x09, 0xEA, 0x4A, 0xFF, 0x09, 0xEA, 0x5F, 0xF0, 0x9E, 0xA5, 0xAF, 0xE0, 0x9E, 0xA6,
+    0xFE, 0x09, 0xEA, 0x69, 0xFD, 0x09, 0xEA, 0x7F, 0xD0, 0x70, 0x99, 0x99, 0x71, 0xFC, 0x70, 0xFA,
+    0x70, 0xAE, 0x97, 0x0A, 0xE9, 0x71, 0x99, 0x97, 0x75, 0xEA, 0x1A, 0xFC, 0x91, 0xF0, 0xFF, 0xA0,
+    0xFF, 0xFD, 0x9F, 0xDA, 0x99, 0xFC, 0xAF, 0xC9, 0x3F, 0xFD, 0x4A, 0xFF, 0xA4, 0x9F, 0xFA, 0x49,
+    0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF,
+    0xA4, 0x9F, 0xFA, 0x49, 0xF0, 0x9F, 0xC9, 0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xDA, 0x6F, 0x09,
+    0xFE, 0x6F, 0x09, 0xFE, 0xA5, 0xF0, 0x9F, 0xF9, 0x4F, 0x09, 0xE9, 0xFC, 0x4F, 0x09, 0xE9, 0x9F,
+    0x93, 0xF0, 0x9E, 0x90, 0xAF, 0x3F, 0x09, 0xEA, 0x1F, 0xA2, 0xF0, 0x9E, 0xA1, 0xAF, 0x2F, 0x09,
+    0xEA, 0x2F, 0xC1, 0xF0, 0x9E, 0xA2, 0x9F, 0x90, 0xF0, 0x9E, 0xA3, 0xFC, 0x0F, 0x09, 0xEA, 0x39,
+    0xF9, 0xAE, 0x09, 0xEA, 0x4A, 0xFF, 0x09, 0xEA, 0x5F, 0xF0, 0x9E, 0xA5, 0xAF, 0xE0, 0x9E, 0xA6,
+    0xFE, 0x09, 0xEA, 0x69, 0xFD, 0x09, 0xEA, 0x7F, 0xD7, 0x77, 0x77, 0x70, 0xF7, 0x7E, 0xA7, 0x69,
+    0xE7, 0x7A, 0xDA, 0x77, 0x99, 0x97, 0x10, 0x76, 0xEA, 0x1A, 0xFC, 0x91, 0xF0, 0xFF, 0xA0, 0xFF,
+    0xFD, 0x9F, 0xDA, 0x99, 0xFC, 0xAF, 0xC9, 0x3F, 0xFD, 0x4A, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF,
+    0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4,
+    0x9F, 0xFA, 0x49, 0xF7, 0x77, 0x73, 0xF7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xE7, 0x39, 0x99, 0x60,
+    0x39, 0x99, 0x59, 0x99, 0x7A, 0xE3, 0xF7, 0x0A, 0xE9, 0x9F, 0x72, 0xFF, 0x74, 0xFD, 0x76, 0x99,
+    0x99, 0x77, 0x73, 0x9F, 0xC9, 0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xDA, 0x6F, 0x09, 0xFE, 0x6F,
+    0x09, 0xFE, 0xA5, 0xF0, 0x9F, 0xF9, 0x4F, 0x09, 0xE9, 0xFC, 0x4F, 0x09, 0xE9, 0x9F, 0x93, 0xF0,
+    0x9E, 0x90, 0xAF, 0x3F, 0x09, 0xEA, 0x1F, 0xA2, 0xF0, 0x9E, 0xA1, 0xAF, 0x2F, 0x09, 0xEA, 0x2F,
+    0xC1, 0xF0, 0x9E, 0xA2, 0x9F, 0x90, 0xF0, 0x9E, 0xA3, 0xFC, 0x0F, 0x09, 0xEA, 0x39, 0xF9, 0xAE,
+    0x09, 0xEA, 0x4A, 0xFF, 0x09, 0xEA, 0x5F, 0xF0, 0x9E, 0xA5, 0xAF, 0xE0, 0x9E, 0xA6, 0xFE, 0x09,
+    0xEA, 0x69, 0xFD, 0x09, 0xEA, 0x7F, 0xD0, 0x19, 0x99, 0x59, 0x99, 0x2E, 0xA2, 0x9E, 0xA3, 0xF0,
+    0xAE, 0xA5, 0xFE, 0xA6, 0x9F, 0xD7, 0x09, 0x99, 0x99, 0x77, 0x3E, 0xA1, 0xAF, 0xC9, 0x1F, 0x0F,
+    0xFA, 0x0F, 0xFF, 0xD9, 0xFD, 0xA9, 0x9F, 0xCA, 0xFC, 0x93, 0xFF, 0xD4, 0xAF, 0xFA, 0x49, 0xFF,
+    0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0xFA, 0x49, 0xFF, 0xA4,
+    0x9F, 0xFA, 0x49, 0xFF, 0xA4, 0x9F, 0x1A, 0xE9, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x70, 0x9E, 0xA7,
+    0x70, 0x9E, 0x77, 0x1A, 0xE1, 0xE9, 0x09, 0xFD, 0x3E, 0x91, 0xEA, 0x9F, 0xF9, 0x19, 0x99, 0x2F,
+    0xFF, 0xD7, 0xFD, 0x99, 0x9F, 0xC9, 0x6F, 0xC3, 0x9F, 0x96, 0xFA, 0x4F, 0xA6, 0xF9, 0x4F, 0xA6,
+    0xF5, 0xFA, 0x6F, 0x5F, 0xA6, 0xF5, 0xFA, 0x6F, 0x5F, 0xA6, 0xF5, 0xFA, 0x6F, 0x5F, 0xA6, 0xF5,
+    0xFA, 0x6F, 0x5F, 0xA6, 0xF5, 0xFA, 0x9F, 0xC9, 0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xE6, 0xF0,
+    0x9F, 0xEA, 0x5F, 0x09, 0xFF, 0x94, 0xF0, 0x9E, 0xAF, 0xC4, 0xF0, 0x9E, 0x9A, 0xFA, 0x3F, 0x09,
+    0xE9, 0x0F, 0xC9, 0x2F, 0x09, 0xE9, 0x09, 0xFC, 0x2F, 0x09, 0xEA, 0x1A, 0xFC, 0x1F, 0x09, 0xEA,
+    0x2F, 0xC9, 0x0F, 0x09, 0xEA, 0x29, 0xFC, 0x0A, 0xE0, 0x9E, 0xA3, 0xAF, 0xCA, 0xE0, 0x9E, 0xA4,
+    0xFF, 0xC0, 0x9E, 0xA5, 0xFF, 0x09, 0xEA, 0x5A, 0xFE, 0x09, 0xEA, 0x6F, 0xE0, 0x9E, 0xA7, 0xFD,
+    0x09, 0xEA, 0x79, 0xFC, 0x09, 0xEA, 0x70, 0xFC, 0x09, 0xEA, 0x71, 0xF7, 0x7F, 0x77, 0xF7, 0x29,
+    0x99, 0xAF, 0xA7, 0x19, 0xFF, 0x72, 0x9F, 0xE9, 0x72, 0x9F, 0xCA, 0x77, 0x70, 0x76, 0xEA, 0x1A,
+    0xFC, 0x91, 0xF0, 0xFF, 0xA0, 0xFF, 0xFD, 0x9F, 0xDA, 0x99, 0xAF, 0xAF, 0xC9, 0x3F, 0xFD, 0x4A,
+    0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF,
+    0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xF7, 0x1A, 0xF7, 0x1A, 0xF7, 0x1F, 0xC6,
+    0xAA, 0xAF, 0xA6, 0xFE, 0x96, 0xFD, 0xA7, 0xAF, 0x91, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0x72, 0x9F,
+    0xFC, 0x97, 0x19, 0xFF, 0xC9, 0x72, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x70, 0xAF, 0xEA, 0x71,
+    0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF,
+    0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97,
+    0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7,
+    0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9,
+    0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x29,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xAF, 0xFC, 0x5A, 0xFF, 0xC6, 0x99, 0x99, 0x99, 0x99, 0x97, 0x76,
+    0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F, 0x5F,
+    0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3, 0x9F,
+    0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60, 0x49,
+    0x99, 0x59, 0x97, 0x1A, 0xD4, 0xAD, 0x97, 0x09, 0xFA, 0xFC, 0x72, 0xAF, 0xF7, 0x4A, 0xFD, 0x77,
+    0x09, 0x97, 0x77, 0x73, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA,
+    0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A,
+    0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA,
+    0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09,
+    0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x29, 0x96, 0x99, 0x4D, 0xA4, 0xE4, 0xAF, 0xAF, 0x95, 0xFF,
+    0xC7, 0xAF, 0xCA, 0x72, 0x99, 0x77, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1,
+    0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF,
+    0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD,
+    0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60, 0x69, 0x99, 0x91, 0x99, 0x97, 0x2F, 0xA0, 0xF9, 0x70, 0x9E,
+    0xA0, 0xAE, 0x97, 0x1E, 0xA0, 0x9E, 0x97, 0x1A, 0xD9, 0x1E, 0x73, 0x99, 0x39, 0x97, 0x77, 0x73,
+    0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94,
+    0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC,
+    0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59,
+    0x99, 0x70, 0x39, 0x99, 0x91, 0x99, 0x99, 0x5F, 0x09, 0xF4, 0xF9, 0x0F, 0x49, 0xE1, 0xEA, 0x5E,
+    0x19, 0xDA, 0x69, 0x92, 0x99, 0x77, 0x72, 0xAF, 0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1,
+    0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF,
+    0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD,
+    0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60, 0x77, 0x77, 0xAF, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xFF, 0xA2,
+    0xFF, 0xFF, 0xFD, 0xA1, 0xAF, 0xDA, 0xAA, 0xFF, 0xFC, 0xA1, 0xFC, 0x94, 0xFA, 0x70, 0xAF, 0x95,
+    0xFA, 0x70, 0xFC, 0x6F, 0xA7, 0x0F, 0xA6, 0xFA, 0x70, 0xF9, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0x09,
+    0xF9, 0x6F, 0xFF, 0x09, 0xF9, 0x6F, 0xFF, 0x09, 0xF9, 0x6F, 0xFF, 0x1F, 0x96, 0xFA, 0x70, 0xFA,
+    0x6F, 0xA7, 0x0F, 0xC6, 0xFA, 0x70, 0xAF, 0x95, 0xFA, 0x71, 0xFC, 0x5F, 0xA7, 0x1A, 0xFC, 0xA9,
+    0x9A, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xFF, 0xA4, 0x9F,
+    0xFF, 0xFE, 0xA7, 0x09, 0x97, 0x60, 0x77, 0x76, 0xAF, 0xD9, 0x29, 0xFD, 0xA5, 0x9F, 0xFD, 0x9F,
+    0xFD, 0x4F, 0xFF, 0xFF, 0xE2, 0xAF, 0xA9, 0x9A, 0xFE, 0x3F, 0xA1, 0xFA, 0x39, 0xFC, 0x5F, 0x09,
+    0xF5, 0xFC, 0x5F, 0x0A, 0xF5, 0xFF, 0xFE, 0x9A, 0xF5, 0xAF, 0xFF, 0xD9, 0xAF, 0x5A, 0xFF, 0xFD,
+    0x9A, 0xF5, 0xFA, 0x72, 0x9F, 0x5F, 0xC7, 0x3F, 0xA3, 0x9F, 0xC9, 0x72, 0xAF, 0xA9, 0x0A, 0xFE,
+    0xA4, 0x9C, 0x92, 0xFF, 0xFF, 0xFE, 0x93, 0xFF, 0xD9, 0xFF, 0xE9, 0x4A, 0xFD, 0xA2, 0x9F, 0xFA,
+    0x70, 0x99, 0x71, 0x99, 0x50, 0x70, 0x99, 0x99, 0x74, 0xFC, 0x73, 0xFA, 0x73, 0xAE, 0xA7, 0x39,
+    0xE9, 0x74, 0x99, 0x97, 0x77, 0x39, 0xFE, 0xAA, 0x96, 0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xC3, 0xAF,
+    0xAA, 0xAF, 0xD9, 0x2A, 0xF3, 0x9F, 0xC2, 0xAF, 0x4A, 0xF2, 0xAF, 0x4A, 0xF2, 0xAF, 0x4A, 0xF2,
+    0xAF, 0x4F, 0xA2, 0xAF, 0x99, 0x9A, 0xFC, 0x3A, 0xFF, 0xF9, 0x3A, 0xFF, 0xDA, 0x5A, 0xFF, 0xDA,
+    0x5A, 0xF1, 0x9F, 0x94, 0xAF, 0x2A, 0xF4, 0xAF, 0x3F, 0xA3, 0xAF, 0x3A, 0xF9, 0x2A, 0xF4, 0xFC,
+    0x2A, 0xF4, 0x9F, 0xA1, 0xAF, 0x5F, 0xC1, 0xAF, 0x6F, 0xC0, 0x59, 0x99, 0x99, 0x59, 0xFA, 0x5F,
+    0x95, 0xF9, 0x5F, 0x79, 0x99, 0x77, 0x1E, 0xA1, 0xAE, 0xA0, 0xF0, 0xAF, 0xA0, 0xFA, 0xFC, 0x90,
+    0xFF, 0xD9, 0x0F, 0xD9, 0x4F, 0xC6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA,
+    0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0x9F, 0xEA, 0xA9, 0x6A, 0xFF, 0xEA, 0x4A, 0xFF, 0xFC, 0x3A, 0xFA,
+    0xAA, 0xFD, 0x92, 0xAF, 0x39, 0xFC, 0x2A, 0xF4, 0xAF, 0x2A, 0xF4, 0xAF, 0x2A, 0xF4, 0xAF, 0x2A,
+    0xF4, 0xFA, 0x2A, 0xF9, 0x99, 0xAF, 0xC3, 0xAF, 0xFF, 0x93, 0xAF, 0xFD, 0xA5, 0xAF, 0xFD, 0xA5,
+    0xAF, 0x19, 0xF9, 0x4A, 0xF2, 0xAF, 0x4A, 0xF3, 0xFA, 0x3A, 0xF3, 0xAF, 0x92, 0xAF, 0x4F, 0xC2,
+    0xAF, 0x49, 0xFA, 0x1A, 0xF5, 0xFC, 0x1A, 0xF6, 0xFC, 0x77, 0x77, 0x72, 0xAE, 0x97, 0x4F, 0x75,
+    0xE9, 0x74, 0x9E, 0x76, 0x99, 0x71, 0x74, 0xEA, 0x1A, 0xEA, 0x0F, 0x0A, 0xFA, 0x0F, 0xAF, 0xC9,
+    0x0F, 0xFD, 0x90, 0xFD, 0x94, 0xFC, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x6F,
+    0xA6, 0xFA, 0x6F, 0xA6, 0xFA, 0x77, 0x76, 0x9E, 0xA6, 0x9E, 0x7A, 0xDA, 0x7E, 0x70, 0x99, 0x97,
+    0x19, 0x99, 0x59, 0x99, 0x5E, 0xA3, 0xEA, 0x6F, 0x09, 0xEA, 0x70, 0xFF, 0x72, 0xFD, 0x73, 0x99,
+    0x99, 0x97, 0x77, 0x19, 0xFE, 0xAA, 0x96, 0xAF, 0xFE, 0xA4, 0xAF, 0xFF, 0xC3, 0xAF, 0xAA, 0xAF,
+    0xD9, 0x2A, 0xF3, 0x9F, 0xC2, 0xAF, 0x4A, 0xF2, 0xAF, 0x4A, 0xF2, 0xAF, 0x4A, 0xF2, 0xAF, 0x4F,
+    0xA2, 0xAF, 0x99, 0x9A, 0xFC, 0x3A, 0xFF, 0xF9, 0x3A, 0xFF, 0xDA, 0x5A, 0xFF, 0xDA, 0x5A, 0xF1,
+    0x9F, 0x94, 0xAF, 0x2A, 0xF4, 0xAF, 0x3F, 0xA3, 0xAF, 0x3A, 0xF9, 0x2A, 0xF4, 0xFC, 0x2A, 0xF4,
+    0x9F, 0xA1, 0xAF, 0x5F, 0xC1, 0xAF, 0x6F, 0xC0, 0x09, 0x96, 0x99, 0x1E, 0xA2, 0x9E, 0x90, 0x9E,
+    0xA0, 0xAE, 0x92, 0x9F, 0xE9, 0x4A, 0xFC, 0xA6, 0x99, 0x99, 0x97, 0x71, 0xEA, 0x1A, 0xEA, 0x1F,
+    0x0A, 0xFA, 0x1F, 0xAF, 0xC9, 0x1F, 0xFD, 0x91, 0xFD, 0x95, 0xFC, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7,
+    0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x60, 0x79, 0x99, 0x97, 0x0F, 0xC7,
+    0xFA, 0x7A, 0xEA, 0x79, 0xE9, 0x70, 0x99, 0x97, 0x77, 0x0A, 0xFD, 0xA3, 0xAF, 0xFD, 0xA0, 0x9F,
+    0xFE, 0x90, 0xFC, 0xAA, 0xAF, 0x09, 0xF9, 0x49, 0x90, 0x9F, 0x70, 0x9F, 0x71, 0xFC, 0x70, 0xFD,
+    0xA7, 0xFE, 0xA6, 0xFF, 0x95, 0x9F, 0xEA, 0x69, 0xFD, 0x97, 0xAF, 0xA7, 0x0A, 0xF7, 0x09, 0xFA,
+    0xA6, 0xAF, 0xAE, 0xA9, 0x99, 0xFC, 0x9A, 0xFF, 0xF0, 0xAF, 0xFE, 0x2A, 0xFF, 0x97, 0x99, 0x60,
+    0x69, 0x99, 0x99, 0x69, 0xFA, 0x6F, 0x96, 0xF9, 0x6F, 0x70, 0x99, 0x97, 0x74, 0x9A, 0xFD, 0xA9,
+    0x1A, 0xFF, 0xD0, 0x9F, 0xFD, 0xA0, 0xAE, 0xA3, 0x9C, 0x1A, 0xEA, 0x7A, 0xFC, 0x96, 0xFE, 0x94,
+    0x9F, 0xF9, 0x4A, 0xFE, 0xA5, 0xAF, 0xD7, 0x9F, 0x97, 0xF9, 0xAC, 0x93, 0x9F, 0x9A, 0xFF, 0xE0,
+    0xAF, 0xFD, 0x90, 0x9F, 0xFA, 0x69, 0x99, 0x50, 0x49, 0x99, 0x97, 0x0A, 0xFC, 0x69, 0xFE, 0x49,
+    0xEA, 0x9E, 0xA2, 0x9E, 0x92, 0xEA, 0x29, 0x95, 0x99, 0x97, 0x72, 0xAF, 0xDA, 0x3A, 0xFF, 0xDA,
+    0x09, 0xFF, 0xE9, 0x0F, 0xCA, 0xAA, 0xF0, 0x9F, 0x94, 0x99, 0x09, 0xF7, 0x09, 0xF7, 0x1F, 0xC7,
+    0x0F, 0xDA, 0x7F, 0xEA, 0x6F, 0xF9, 0x59, 0xFE, 0xA6, 0x9F, 0xD9, 0x7A, 0xFA, 0x70, 0xAF, 0x70,
+    0x9F, 0xAA, 0x6A, 0xFA, 0xEA, 0x99, 0x9F, 0xC9, 0xAF, 0xFF, 0x0A, 0xFF, 0xE2, 0xAF, 0xF9, 0x79,
+    0x96, 0x39, 0x99, 0x97, 0xAF, 0xC5, 0x9F, 0xE3, 0x9E, 0xA9, 0xEA, 0x19, 0xE9, 0x2E, 0xA1, 0x99,
+    0x59, 0x99, 0x77, 0x9A, 0xFD, 0xA9, 0x1A, 0xFF, 0xD0, 0x9F, 0xFD, 0xA0, 0xAE, 0xA3, 0x9C, 0x1A,
+    0xEA, 0x7A, 0xFC, 0x96, 0xFE, 0x94, 0x9F, 0xF9, 0x4A, 0xFE, 0xA5, 0xAF, 0xD7, 0x9F, 0x97, 0xF9,
+    0xAC, 0x93, 0x9F, 0x9A, 0xFF, 0xE0, 0xAF, 0xFD, 0x90, 0x9F, 0xFA, 0x69, 0x99, 0x50, 0x77, 0x1A,
+    0xFD, 0xA3, 0xAF, 0xFD, 0xA0, 0x9F, 0xFE, 0x90, 0xFC, 0xAA, 0xAF, 0x09, 0xF9, 0x49, 0x90, 0x9F,
+    0x70, 0x9F, 0x71, 0xFC, 0x70, 0xFD, 0xA7, 0xFE, 0xA6, 0xFF, 0x95, 0x9F, 0xEA, 0x69, 0xFD, 0x97,
+    0xAF, 0xA7, 0x0A, 0xF7, 0x09, 0xFA, 0xA6, 0xAF, 0xAE, 0xA9, 0x99, 0xFC, 0x9A, 0xFF, 0xF0, 0xAF,
+    0xFE, 0x2A, 0xFF, 0x97, 0xE7, 0x2E, 0xA7, 0x19, 0xF7, 0x2E, 0x69, 0x99, 0xAE, 0x69, 0xFC, 0xA6,
+    0x9F, 0x94, 0x76, 0x9A, 0xFD, 0xA9, 0x1A, 0xFF, 0xD0, 0x9F, 0xFD, 0xA0, 0xAE, 0xA3, 0x9C, 0x1A,
+    0xEA, 0x7A, 0xFC, 0x96, 0xFE, 0x94, 0x9F, 0xF9, 0x4A, 0xFE, 0xA5, 0xAF, 0xD7, 0x9F, 0x97, 0xF9,
+    0xAC, 0x93, 0x9F, 0x9A, 0xFF, 0xE0, 0xAF, 0xFD, 0x90, 0x9F, 0xFA, 0x6A, 0xD9, 0x70, 0xAD, 0xA7,
+    0x09, 0xAE, 0x71, 0xE9, 0x5A, 0x9A, 0xE9, 0x5F, 0xD6, 0xFA, 0x40, 0x19, 0x96, 0x99, 0x19, 0xE9,
+    0x2A, 0xE2, 0x9E, 0xA0, 0xF9, 0x39, 0xFE, 0x95, 0xAF, 0xCA, 0x79, 0x99, 0x99, 0x77, 0x5A, 0xFD,
+    0xA3, 0xAF, 0xFD, 0xA0, 0x9F, 0xFE, 0x90, 0xFC, 0xAA, 0xAF, 0x09, 0xF9, 0x49, 0x90, 0x9F, 0x70,
+    0x9F, 0x71, 0xFC, 0x70, 0xFD, 0xA7, 0xFE, 0xA6, 0xFF, 0x95, 0x9F, 0xEA, 0x69, 0xFD, 0x97, 0xAF,
+    0xA7, 0x0A, 0xF7, 0x09, 0xFA, 0xA6, 0xAF, 0xAE, 0xA9, 0x99, 0xFC, 0x9A, 0xFF, 0xF0, 0xAF, 0xFE,
+    0x2A, 0xFF, 0x97, 0x99, 0x60, 0x09, 0x96, 0x99, 0x1E, 0xA2, 0x9E, 0x90, 0x9E, 0xA0, 0xAE, 0x92,
+    0x9F, 0xE9, 0x4A, 0xFC, 0xA6, 0x99, 0x99, 0x97, 0x72, 0x9A, 0xFD, 0xA9, 0x1A, 0xFF, 0xD0, 0x9F,
+    0xFD, 0xA0, 0xAE, 0xA3, 0x9C, 0x1A, 0xEA, 0x7A, 0xFC, 0x96, 0xFE, 0x94, 0x9F, 0xF9, 0x4A, 0xFE,
+    0xA5, 0xAF, 0xD7, 0x9F, 0x97, 0xF9, 0xAC, 0x93, 0x9F, 0x9A, 0xFF, 0xE0, 0xAF, 0xFD, 0x90, 0x9F,
+    0xFA, 0x69, 0x99, 0x50, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE6,
+    0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73,
+    0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73,
+    0xFA, 0x74, 0xD9, 0x74, 0xAD, 0xA9, 0x74, 0xAE, 0x97, 0x4A, 0xDA, 0x71, 0xA9, 0x9E, 0xA7, 0x1F,
+    0xD7, 0x2A, 0xEA, 0x60, 0x49, 0x97, 0x0E, 0x79, 0xE7, 0xAE, 0x6A, 0xFF, 0xA0, 0xFF, 0xDA, 0x9F,
+    0xFD, 0xA0, 0x9A, 0xF9, 0x99, 0x92, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F,
+    0x7F, 0x7F, 0xC9, 0x09, 0x92, 0xFF, 0xA2, 0x9F, 0xEA, 0x39, 0xFD, 0xA5, 0x9D, 0x97, 0xAD, 0xA7,
+    0x9A, 0xE7, 0x0A, 0xDA, 0x4A, 0x99, 0xEA, 0x4F, 0xD5, 0xFA, 0x10, 0x29, 0x99, 0x59, 0x99, 0x4E,
+    0xA2, 0x9E, 0x95, 0xF0, 0xAE, 0xA7, 0xFE, 0xA7, 0x09, 0xFD, 0x72, 0x99, 0x99, 0x97, 0x76, 0x9F,
+    0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE6, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x50, 0x77, 0x74, 0x9E,
+    0x97, 0x3A, 0xE5, 0x99, 0x4E, 0x94, 0xE4, 0xE4, 0x9E, 0x4A, 0xA5, 0xAE, 0x73, 0xAF, 0xFA, 0x5F,
+    0xFD, 0xA4, 0x9F, 0xFD, 0xA5, 0x9A, 0xF9, 0x99, 0x97, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F,
+    0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x74, 0xF7, 0x4F, 0xC9, 0x09, 0x97, 0xFF, 0xA7, 0x9F, 0xEA,
+    0x70, 0x9F, 0xDA, 0x73, 0x99, 0x70, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F,
+    0xFF, 0xE9, 0x5F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x9F, 0xFE, 0x49, 0xFF,
+    0xE4, 0x9F, 0xFE, 0x5A, 0xAA, 0xFC, 0xAA, 0xA7, 0x0F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7,
+    0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA5, 0x49, 0x97, 0x0E, 0x79, 0xE7, 0xAE, 0x6A, 0xFF,
+    0xA0, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x9A, 0xF9, 0x99, 0x92, 0x9F, 0x69, 0xF5, 0xFF, 0xD1, 0xFF,
+    0xD1, 0xFF, 0xD2, 0x9F, 0x69, 0xF7, 0xF7, 0xFC, 0x90, 0x99, 0x2F, 0xFA, 0x29, 0xFE, 0xA3, 0x9F,
+    0xDA, 0x69, 0x92, 0x77, 0x5A, 0xE9, 0x2D, 0x6A, 0xFD, 0xAE, 0x59, 0xFF, 0xD9, 0x5A, 0xD1, 0x9F,
+    0xA7, 0x95, 0x97, 0x77, 0x09, 0xEA, 0x7A, 0xE9, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xA9, 0xF7, 0xFA, 0x9F, 0x95, 0x9F, 0x90, 0xFC,
+    0x5F, 0xC1, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9F, 0xF9, 0x73, 0x99,
+    0x70, 0x77, 0x19, 0xE9, 0x2D, 0x92, 0x9F, 0xDA, 0xAD, 0x92, 0xFF, 0xE3, 0xD2, 0xAF, 0x49, 0x94,
+    0x97, 0x73, 0xF9, 0x4A, 0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9,
+    0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F,
+    0xCA, 0xFA, 0x99, 0xAF, 0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x00,
+    0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xD7, 0xFF, 0xD7, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77,
+    0x59, 0xEA, 0x7A, 0xE9, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F,
+    0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xA9, 0xF7, 0xFA, 0x9F, 0x95, 0x9F, 0x90, 0xFC, 0x5F, 0xC1, 0xAF, 0xCA,
+    0x99, 0xAF, 0xCA, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9F, 0xF9, 0x73, 0x99, 0x70, 0x2A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x49, 0xFF, 0xC9, 0x39, 0xFF, 0xC9, 0x49, 0x99, 0x99, 0x99, 0x99, 0x77, 0x1F, 0x94,
+    0xAE, 0xAF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A,
+    0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFC, 0xAF, 0xA9, 0x9A,
+    0xFD, 0x9F, 0xFF, 0xD0, 0xAF, 0xF9, 0xF1, 0xAF, 0xD1, 0xAE, 0x49, 0x70, 0x39, 0x95, 0x99, 0x96,
+    0xD9, 0x4D, 0xA6, 0xFC, 0xAF, 0x96, 0x9F, 0xFA, 0x71, 0xFD, 0x97, 0x49, 0x97, 0x77, 0x19, 0xEA,
+    0x7A, 0xE9, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xA9, 0xF7, 0xFA, 0x9F, 0x95, 0x9F, 0x90, 0xFC, 0x5F, 0xC1, 0xAF, 0xCA, 0x99, 0xAF,
+    0xCA, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9F, 0xF9, 0x73, 0x99, 0x70, 0x19, 0x99, 0x59, 0x93, 0xAD,
+    0x4A, 0xD3, 0x9F, 0xAF, 0xC4, 0xAF, 0xF6, 0xAF, 0xCA, 0x72, 0x99, 0x77, 0x4F, 0x94, 0xAE, 0xAF,
+    0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94,
+    0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFC, 0xAF, 0xA9, 0x9A, 0xFD, 0x9F,
+    0xFF, 0xD0, 0xAF, 0xF9, 0xF1, 0xAF, 0xD1, 0xAE, 0x49, 0x70, 0x69, 0x99, 0x75, 0xFC, 0x97, 0x2A,
+    0xDA, 0xE7, 0x2D, 0x91, 0xD7, 0x2D, 0x91, 0xD7, 0x2A, 0xDA, 0xE7, 0x3A, 0xF7, 0x69, 0x77, 0x72,
+    0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF,
+    0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59, 0xF9, 0x0F, 0xC5, 0xFC, 0x1A, 0xFC, 0xA9,
+    0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0x97, 0x39, 0x97, 0x59, 0x99, 0x72, 0xFC,
+    0x70, 0xEA, 0xE7, 0xD1, 0x9D, 0x7D, 0x19, 0xD7, 0xEA, 0xDA, 0x70, 0xFC, 0x73, 0x97, 0x75, 0xF9,
+    0x4A, 0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94,
+    0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99,
+    0xAF, 0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x00, 0x49, 0x99, 0x91,
+    0x99, 0x99, 0x69, 0xF0, 0xAE, 0xA6, 0xF0, 0x9E, 0xA6, 0xAE, 0x1E, 0xA6, 0x9D, 0xA1, 0xAD, 0x97,
+    0x09, 0x92, 0x99, 0x77, 0x71, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF,
+    0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59, 0xF9, 0x0F,
+    0xC5, 0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0x97, 0x39,
+    0x97, 0x39, 0x99, 0x90, 0x99, 0x99, 0x4F, 0xA0, 0xF3, 0x9E, 0xA0, 0xF9, 0x3E, 0x90, 0x9E, 0x4E,
+    0x91, 0xE5, 0x99, 0x39, 0x97, 0x74, 0xF9, 0x4A, 0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A,
+    0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF,
+    0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99, 0xAF, 0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD,
+    0x1A, 0xE4, 0x97, 0x00, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF,
+    0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F,
+    0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59, 0xF9, 0x0F, 0xC5,
+    0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0xC7, 0x39, 0x9E,
+    0x75, 0x9D, 0xA7, 0x5A, 0xD7, 0x6E, 0x76, 0xAE, 0xAA, 0x73, 0x9F, 0xC7, 0x49, 0xEA, 0x20, 0xF9,
+    0x4A, 0xEA, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94,
+    0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99,
+    0xAF, 0xD9, 0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x93, 0x9D, 0x97, 0x2D, 0xA7,
+    0x2E, 0x73, 0xE7, 0x3F, 0xD7, 0x09, 0xFC, 0x71, 0x9A, 0xCA, 0x90, 0x73, 0x99, 0x99, 0x77, 0x7F,
+    0xD7, 0x75, 0xAF, 0xDA, 0x77, 0x3A, 0xE9, 0x9E, 0x97, 0x71, 0x9E, 0x91, 0x9E, 0x97, 0x70, 0x99,
+    0x95, 0x99, 0x97, 0x77, 0x75, 0xAE, 0x96, 0xF7, 0xF0, 0xAE, 0xA5, 0x9F, 0xA5, 0x9F, 0x09, 0xF5,
+    0xAF, 0xC5, 0xAE, 0xA1, 0xF5, 0xFD, 0x5F, 0x91, 0xF9, 0x4F, 0xD9, 0x4F, 0x2A, 0xEA, 0x39, 0xFD,
+    0xA3, 0x9F, 0x29, 0xF3, 0xAE, 0xAE, 0x3A, 0xEA, 0x3F, 0x3E, 0xAA, 0xE3, 0xF9, 0x3F, 0x92, 0xE9,
+    0x9E, 0x92, 0xF4, 0xAE, 0xA1, 0x9E, 0x90, 0xEA, 0x19, 0xF4, 0x9F, 0x1A, 0xE1, 0xF1, 0xAE, 0xA5,
+    0xF1, 0xF1, 0xAE, 0x1F, 0x95, 0xF1, 0xEA, 0x19, 0xE9, 0x0F, 0x6A, 0xE9, 0x9E, 0x92, 0xEA, 0x0F,
+    0x69, 0xEA, 0xAE, 0x3F, 0x9E, 0xA7, 0xFE, 0xA3, 0xAE, 0xAE, 0x97, 0xFE, 0x93, 0x9F, 0xE7, 0x0A,
+    0xFD, 0x5F, 0xE7, 0x09, 0xFD, 0x5F, 0xDA, 0x71, 0xFC, 0xA5, 0xAF, 0xC9, 0x71, 0xFC, 0x95, 0x9F,
+    0xC5, 0x71, 0x99, 0x99, 0x97, 0x73, 0xFC, 0x97, 0x71, 0xFE, 0x77, 0x0F, 0x0F, 0x76, 0xEA, 0x2A,
+    0xE7, 0x59, 0x99, 0x59, 0x97, 0x77, 0x7A, 0xEA, 0x4F, 0xC4, 0xAE, 0x99, 0xF4, 0xFC, 0x93, 0xF9,
+    0x0F, 0x3A, 0xFC, 0xA3, 0xF1, 0xAE, 0xA2, 0xFE, 0x29, 0xEA, 0x19, 0xF2, 0xE9, 0xE2, 0xF9, 0x2F,
+    0x19, 0xE0, 0xE2, 0xF3, 0xF9, 0x0A, 0xDA, 0x0E, 0x90, 0x9F, 0x3A, 0xEA, 0x0E, 0x90, 0xAD, 0xA0,
+    0xAE, 0xA3, 0x9F, 0x0E, 0x19, 0xE0, 0xF9, 0x4F, 0x0E, 0x2E, 0x0F, 0x5F, 0x9E, 0x2E, 0x9E, 0xA5,
+    0x9E, 0xAD, 0xA2, 0xAD, 0xAE, 0x96, 0xFD, 0x92, 0x9F, 0xD7, 0xFD, 0x4F, 0xD7, 0xAF, 0xC4, 0xFC,
+    0xA7, 0x9F, 0xA4, 0xAF, 0x40, 0x69, 0x99, 0x97, 0x5A, 0xFC, 0x73, 0xAF, 0xDA, 0x71, 0x9E, 0xA9,
+    0xEA, 0x79, 0xE9, 0x2E, 0xA7, 0x99, 0x59, 0x99, 0x77, 0x6A, 0xF7, 0xAF, 0x09, 0xFA, 0x6F, 0xA1,
+    0xFC, 0x5A, 0xF3, 0xF9, 0x4F, 0x93, 0xAF, 0x3A, 0xF5, 0xF9, 0x2F, 0x95, 0xAF, 0x1A, 0xF7, 0xF9,
+    0x0F, 0x97, 0xAF, 0xAF, 0x71, 0xFF, 0x72, 0x9F, 0xDA, 0x73, 0xFD, 0x74, 0x9F, 0xA7, 0x5F, 0x97,
+    0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x96, 0x59, 0x99,
+    0x97, 0x39, 0xFC, 0x71, 0x9F, 0xE7, 0x0E, 0xA0, 0xF6, 0xEA, 0x2E, 0xA5, 0x99, 0x59, 0x99, 0x77,
+    0x3F, 0xA6, 0xF9, 0x9F, 0x59, 0xF1, 0xF9, 0x4A, 0xF1, 0xAF, 0x4F, 0x92, 0xF3, 0x9F, 0x3F, 0x92,
+    0xAE, 0xA3, 0x9F, 0x2F, 0x5F, 0x19, 0xF5, 0xAE, 0x90, 0xAE, 0x96, 0xEA, 0x0F, 0x7F, 0x9E, 0xA7,
+    0x9E, 0xAE, 0x97, 0x0F, 0xE7, 0x1A, 0xFC, 0xA7, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0x97, 0x29, 0xF7,
+    0x3F, 0xA7, 0xAA, 0xAF, 0xC7, 0x0F, 0xEA, 0x70, 0xFD, 0xA7, 0x1F, 0xA9, 0x71, 0x39, 0xD9, 0x2D,
+    0xA7, 0x0F, 0x1A, 0xE7, 0x0F, 0x1A, 0xE7, 0x09, 0xD9, 0x2D, 0xA7, 0x77, 0x77, 0x2A, 0xF7, 0xAF,
+    0x09, 0xFA, 0x6F, 0xA1, 0xFC, 0x5A, 0xF3, 0xF9, 0x4F, 0x93, 0xAF, 0x3A, 0xF5, 0xF9, 0x2F, 0x95,
+    0xAF, 0x1A, 0xF7, 0xF9, 0x0F, 0x97, 0xAF, 0xAF, 0x71, 0xFF, 0x72, 0x9F, 0xDA, 0x73, 0xFD, 0x74,
+    0x9F, 0xA7, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97,
+    0x5F, 0x96, 0x70, 0x99, 0x99, 0x97, 0x2A, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x73, 0xEA, 0x74, 0x99,
+    0x77, 0x72, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xDA, 0x72, 0xFC, 0x72, 0xAF,
+    0x73, 0xFA, 0x72, 0xFC, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2A, 0xF7, 0x29, 0xF9, 0x72,
+    0xFA, 0x72, 0xFC, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F,
+    0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x79, 0x99, 0x99, 0x79, 0xFA, 0x7F, 0x97, 0xF9,
+    0x7F, 0x71, 0x99, 0x97, 0x74, 0xAF, 0xFE, 0x1A, 0xFF, 0xE1, 0xAF, 0xFE, 0x19, 0x99, 0x99, 0x99,
+    0xFC, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF, 0x79, 0xF9, 0x7F, 0xA7, 0xAF, 0x79, 0xFA,
+    0x99, 0x99, 0x99, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0x77, 0x69, 0xEA, 0x73, 0xAF,
+    0x73, 0xAF, 0x74, 0xE9, 0x77, 0x77, 0x70, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF,
+    0xDA, 0x72, 0xFC, 0x72, 0xAF, 0x73, 0xFA, 0x72, 0xFC, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F, 0xA7,
+    0x2A, 0xF7, 0x29, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xCA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x77, 0x2A, 0xE7,
+    0x1F, 0xA7, 0x0F, 0xA7, 0x0A, 0xE7, 0x77, 0x71, 0xAF, 0xFE, 0x1A, 0xFF, 0xE1, 0xAF, 0xFE, 0x19,
+    0x99, 0x99, 0x99, 0xFC, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF, 0x79, 0xF9, 0x7F, 0xA7,
+    0xAF, 0x79, 0xFA, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0x29, 0x99,
+    0x59, 0x99, 0x4E, 0xA2, 0x9E, 0xA5, 0xF0, 0xAE, 0xA7, 0xFE, 0xA7, 0x09, 0xFD, 0x72, 0x99, 0x99,
+    0x97, 0x77, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xDA, 0x72, 0xFC, 0x72, 0xAF,
+    0x73, 0xFA, 0x72, 0xFC, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2A, 0xF7, 0x29, 0xF9, 0x72,
+    0xFA, 0x72, 0xFC, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F,
+    0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x19, 0x96, 0x99, 0x2E, 0xA2, 0x9E, 0x91, 0x9E,
+    0xA0, 0xAE, 0x93, 0x9F, 0xE9, 0x5A, 0xFC, 0xA7, 0x99, 0x99, 0x97, 0x72, 0xAF, 0xFE, 0x1A, 0xFF,
+    0xE1, 0xAF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0xFC, 0x7A, 0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF,
+    0x79, 0xF9, 0x7F, 0xA7, 0xAF, 0x79, 0xFA, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x90, 0xFF, 0xF9, 0x0F,
+    0xFF, 0x90, 0x49, 0x94, 0xAF, 0xDA, 0x0F, 0xF9, 0x9F, 0xF0, 0xAF, 0x91, 0x90, 0xAE, 0xA4, 0xAE,
+    0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE,
+    0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE,
+    0xA4, 0x77, 0x77, 0x72, 0xAF, 0x5A, 0xFE, 0xA3, 0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A, 0xFF, 0xFD,
+    0xAE, 0xA2, 0xAF, 0xDA, 0xAA, 0xFF, 0xD3, 0xFC, 0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F, 0xA4, 0xFC,
+    0x70, 0xFC, 0x4F, 0xA7, 0x0A, 0xF3, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F,
+    0x97, 0x1F, 0x92, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70, 0xAF, 0x4F,
+    0xC7, 0x0F, 0xC4, 0xAF, 0x96, 0x9F, 0xA5, 0xFC, 0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A, 0xFD, 0xA7,
+    0xFF, 0xFE, 0x71, 0xAF, 0xFE, 0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x70, 0x99, 0x97, 0x30, 0x77, 0x99,
+    0x97, 0x7F, 0xA7, 0x6F, 0x93, 0x9F, 0xDA, 0x2F, 0x3F, 0xFD, 0x9F, 0xA2, 0xFF, 0xFF, 0x2A, 0xFA,
+    0x99, 0xAF, 0xDA, 0x3F, 0xA3, 0x9F, 0x93, 0x9F, 0x5F, 0xA3, 0xAF, 0x5F, 0xA3, 0xAF, 0x5A, 0xF3,
+    0xAF, 0x5A, 0xF3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA4, 0xFA, 0x39, 0xF9, 0x4A, 0xFA, 0x99, 0xAF,
+    0xC6, 0xFF, 0xF9, 0x7F, 0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x77, 0x77, 0x3A, 0xFE,
+    0x93, 0x9A, 0xFC, 0x96, 0xAF, 0xFE, 0x90, 0xAF, 0xFA, 0x4A, 0xFF, 0xFF, 0xFF, 0xA2, 0xAF, 0xDA,
+    0xAA, 0xFF, 0xCA, 0xAF, 0xD2, 0xFC, 0x94, 0xAF, 0xC4, 0xFC, 0x1A, 0xFA, 0x6F, 0xC4, 0x9F, 0x90,
+    0xFC, 0x79, 0xF9, 0x4F, 0x90, 0xFC, 0x70, 0xFA, 0x4F, 0x90, 0xFA, 0x70, 0xFC, 0x4F, 0x99, 0xF9,
+    0x70, 0xFC, 0x4F, 0x99, 0xF9, 0x70, 0xFC, 0x4F, 0x99, 0xF9, 0x70, 0xFC, 0x4F, 0x90, 0xFA, 0x70,
+    0xFC, 0x4F, 0x90, 0xFC, 0x70, 0xFA, 0x4F, 0x90, 0xFC, 0x79, 0xFA, 0x4F, 0x90, 0xAF, 0xA6, 0xFC,
+    0x5F, 0x91, 0xFC, 0x94, 0xAF, 0xC5, 0xF9, 0x1A, 0xFD, 0xAA, 0xAF, 0xD9, 0x5F, 0x92, 0xFF, 0xFD,
+    0x96, 0xF9, 0x3A, 0xFF, 0xE9, 0x7F, 0x94, 0x9A, 0xFE, 0xA7, 0x1F, 0x97, 0x09, 0x97, 0x72, 0x77,
+    0x73, 0xAF, 0xD9, 0x2A, 0xFC, 0x93, 0x9F, 0xFC, 0xA9, 0xFF, 0xA2, 0xFF, 0xFF, 0xFC, 0x90, 0xAF,
+    0xA9, 0x9F, 0xDA, 0x99, 0xAF, 0xA0, 0xF9, 0x3F, 0xA3, 0xFC, 0x9F, 0x4A, 0xF3, 0xAF, 0xAF, 0x49,
+    0xF3, 0x9F, 0xAF, 0x49, 0xF3, 0x9F, 0xAF, 0x49, 0xF3, 0x9F, 0xAF, 0x49, 0xF3, 0x9F, 0x9F, 0x4A,
+    0xF3, 0x9F, 0x0F, 0x93, 0xFA, 0x39, 0xF0, 0xFC, 0x90, 0x9F, 0xC4, 0x9F, 0x1F, 0xFE, 0xA4, 0x9F,
+    0x19, 0xFF, 0xCA, 0x59, 0xF3, 0xAF, 0xD9, 0x69, 0xF6, 0x99, 0x71, 0x9F, 0x77, 0x29, 0xF7, 0x72,
+    0x9F, 0x77, 0x29, 0xF7, 0x72, 0x9F, 0x77, 0x29, 0xF7, 0x72, 0x9F, 0x19, 0xAF, 0xFD, 0xAA, 0x94,
+    0xAF, 0xFF, 0xF2, 0x9F, 0xFF, 0xFD, 0x1A, 0xFF, 0xFF, 0xE0, 0xF1, 0xFA, 0x29, 0xFC, 0x0F, 0x1F,
+    0xA3, 0x9F, 0x99, 0xAA, 0xA1, 0xFA, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xFA, 0x39, 0xF9, 0x5F, 0xA1,
+    0x9A, 0xFC, 0x6F, 0xFF, 0xCA, 0x6F, 0xFF, 0xA7, 0xFF, 0xE9, 0x70, 0xFC, 0xAA, 0xA9, 0x97, 0x2F,
+    0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x7F, 0xA7, 0x10, 0x39, 0x97,
+    0x3F, 0xC9, 0x70, 0xFD, 0x97, 0x9F, 0xD9, 0x7A, 0xF9, 0x97, 0x0A, 0xEA, 0x72, 0xAE, 0xA7, 0x2A,
+    0xEA, 0x0A, 0xFA, 0x3A, 0xEA, 0xFF, 0x2A, 0xFF, 0xFC, 0x1A, 0xFC, 0xA9, 0x9F, 0xC9, 0x0A, 0xF9,
+    0x3F, 0xC0, 0xAF, 0x4A, 0xF0, 0xAF, 0x49, 0xF0, 0xAE, 0xA4, 0x9F, 0x0A, 0xEA, 0x49, 0xF0, 0xAF,
+    0x49, 0xF0, 0xAF, 0x4A, 0xF0, 0xAF, 0x93, 0xFC, 0x0A, 0xFC, 0xA9, 0x9F, 0xC9, 0x0A, 0xFF, 0xFC,
+    0x1A, 0xFF, 0xF9, 0x1A, 0xEA, 0x0A, 0xFC, 0x3A, 0xEA, 0x29, 0x95, 0xAE, 0xA7, 0x2A, 0xEA, 0x72,
+    0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x74,
+    0x9F, 0xFA, 0xA6, 0x9F, 0xFE, 0xA4, 0x9F, 0xFF, 0xC3, 0x9F, 0xFF, 0xCA, 0x29, 0xF3, 0x9F, 0xC2,
+    0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x39, 0xFA, 0x29, 0xFA, 0xAA, 0xFD,
+    0x39, 0xFF, 0xF9, 0x39, 0xFF, 0xDA, 0x59, 0xFF, 0xDA, 0x59, 0xF1, 0x9F, 0x94, 0x9F, 0x2A, 0xF4,
+    0x9F, 0x3F, 0xA3, 0x9F, 0x39, 0xF9, 0x29, 0xF4, 0xFC, 0x75, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC0,
+    0x77, 0x9A, 0xFD, 0xA3, 0xFF, 0xE2, 0xFF, 0xF1, 0x9F, 0xAA, 0xFC, 0xA1, 0xA9, 0x4F, 0xC7, 0x0A,
+    0xF7, 0x0F, 0xC7, 0xAF, 0xA5, 0xAF, 0xD4, 0xAF, 0xEA, 0x29, 0xFF, 0x92, 0x9F, 0xEA, 0x4F, 0xDA,
+    0x5A, 0xFA, 0x7A, 0xF7, 0x0F, 0xA7, 0x0A, 0xF6, 0x9A, 0x9F, 0xCA, 0x9A, 0xAF, 0x0F, 0xFF, 0xC1,
+    0xFF, 0xF2, 0xAF, 0xF9, 0x69, 0x99, 0x40, 0x75, 0x9A, 0xFD, 0xA3, 0xFF, 0xD9, 0x1F, 0xFE, 0x19,
+    0xCA, 0x91, 0x9F, 0x97, 0xF9, 0x59, 0xFC, 0x4A, 0xFE, 0x2A, 0xFF, 0x2F, 0xFA, 0x29, 0xFD, 0x94,
+    0xAF, 0x96, 0xFA, 0x7A, 0xF3, 0x9A, 0xC0, 0x9F, 0xFE, 0x1A, 0xFF, 0xD2, 0x9F, 0xF9, 0x69, 0x94,
+    0x0F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFD, 0xAF, 0xEA, 0x2F, 0xC7, 0x4F, 0xC7, 0x4F,
+    0xC7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xF9, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F,
+    0xC7, 0x2A, 0xF7, 0x2A, 0xF7, 0x29, 0xF9, 0x72, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x00, 0x29, 0x99, 0x97, 0x1F, 0xD9, 0x6F, 0xF9, 0x5D,
+    0xA0, 0xAE, 0xA5, 0xDA, 0x09, 0xF5, 0xFF, 0xC5, 0x9F, 0xF7, 0x9A, 0xAF, 0x71, 0x9F, 0x71, 0x9F,
+    0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F,
+    0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F,
+    0x72, 0xFC, 0xAA, 0xAA, 0x5F, 0xFA, 0x6F, 0xEA, 0x7A, 0xFA, 0x90, 0x49, 0x97, 0x0E, 0x79, 0xE7,
+    0xF6, 0xAF, 0xFA, 0x0F, 0xFD, 0xA9, 0xFF, 0xDA, 0x09, 0xAF, 0x99, 0x99, 0x91, 0x9F, 0x69, 0xF6,
+    0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF9, 0x6F, 0xC9, 0x99, 0x92, 0xFF, 0xC2, 0x9F,
+    0xF3, 0x9F, 0xE6, 0x9F, 0x7F, 0x7E, 0xA4, 0x99, 0xAE, 0xA4, 0xAF, 0xC9, 0x4A, 0xFC, 0x59, 0xEA,
+    0x10, 0x2A, 0xFF, 0xFC, 0x90, 0x9F, 0xFF, 0xE9, 0x0F, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0xF2, 0xAF,
+    0x5E, 0xA2, 0xAF, 0x5A, 0xDA, 0x2A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A,
+    0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A, 0xF7, 0x4A,
+    0xF7, 0x4A, 0xF5, 0x69, 0x96, 0x9F, 0xD3, 0x9F, 0xE3, 0xFF, 0x3F, 0xA9, 0x99, 0x29, 0xF6, 0x9F,
+    0x6A, 0xFF, 0xA0, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x9A, 0xF9, 0x99, 0x99, 0x19, 0xF6, 0x9F, 0x69,
+    0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF7, 0xF9, 0x6F, 0xC9, 0x99, 0x92, 0xFF, 0xC2, 0x9F, 0xF3,
+    0x9F, 0xDA, 0x69, 0x92, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9,
+    0x5F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7,
+    0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7,
+    0x3F, 0xA7, 0x3F, 0xA7, 0x3F, 0xA7, 0x3A, 0xF7, 0x3A, 0xFA, 0x9A, 0x70, 0x9F, 0xE7, 0x1A, 0xFD,
+    0x72, 0x9F, 0xA2, 0x77, 0x77, 0x73, 0x9F, 0x09, 0xEA, 0x7A, 0xE9, 0x0A, 0xF0, 0xAF, 0x7F, 0xA0,
+    0xF9, 0x0A, 0xF7, 0xFA, 0xAF, 0x1A, 0xF7, 0xFF, 0xC2, 0xAF, 0x7F, 0xEA, 0x3A, 0xF7, 0xFC, 0x95,
+    0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF,
+    0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0x9F, 0x7F, 0xA6, 0x9F, 0x96, 0xF9, 0x7F, 0xC5,
+    0xFC, 0x70, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x71, 0xFF, 0xFD, 0x73, 0xFF, 0xF7, 0x59, 0xFF, 0x97,
+    0x72, 0x99, 0x76, 0x77, 0x09, 0x99, 0x97, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x0F, 0x94, 0xAE, 0xA0,
+    0xF9, 0x0F, 0x94, 0xAF, 0xAF, 0x1F, 0x94, 0xAF, 0xF2, 0xF9, 0x4A, 0xFE, 0x3F, 0x94, 0xAF, 0x95,
+    0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xFA,
+    0x4F, 0xC6, 0xFC, 0x39, 0xFC, 0x6A, 0xFA, 0x99, 0xAF, 0xD6, 0x9F, 0xFF, 0xD7, 0xAF, 0xF0, 0xF7,
+    0x0A, 0xFC, 0xA1, 0xAE, 0x73, 0x97, 0x70, 0x09, 0x99, 0x94, 0xFC, 0x4A, 0xEA, 0x4A, 0xEA, 0x49,
+    0xE9, 0x59, 0x99, 0x39, 0x99, 0x93, 0xFC, 0x2A, 0xF2, 0x9E, 0xA2, 0x9E, 0x94, 0x99, 0x50, 0x39,
+    0x99, 0x96, 0xFC, 0xA4, 0xAF, 0xDA, 0x2A, 0xE9, 0xAE, 0x90, 0xAE, 0x29, 0xE9, 0x99, 0x95, 0x99,
+    0x90, 0x75, 0xAD, 0xA2, 0x9D, 0x0F, 0xEA, 0xDA, 0x9F, 0xFD, 0x9A, 0xCA, 0x19, 0xF9, 0x09, 0x95,
+    0x92, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF1, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00,
+    0x09, 0x95, 0x99, 0x90, 0xDA, 0x4D, 0xA0, 0xFC, 0xAF, 0x91, 0xFF, 0xA3, 0xFD, 0x96, 0x99, 0x40,
+    0x6F, 0x09, 0xF9, 0x9F, 0x90, 0xAD, 0xA6, 0x0A, 0xD2, 0x9D, 0x91, 0xF1, 0xF1, 0xEA, 0x1F, 0x19,
+    0xD2, 0x9D, 0x90, 0x70, 0xFC, 0x2F, 0xD1, 0x90, 0xAE, 0x4E, 0x2A, 0xEA, 0x2E, 0x93, 0x9A, 0xA2,
+    0x19, 0x99, 0x3F, 0xC9, 0x0A, 0xDA, 0xE0, 0xD9, 0x1D, 0x9D, 0x91, 0xD9, 0x9D, 0xAE, 0x1A, 0xF9,
+    0x39, 0x92, 0x29, 0x99, 0x91, 0x99, 0x99, 0x29, 0xF0, 0xAE, 0xA2, 0xF0, 0x9E, 0xA2, 0xAE, 0x1E,
+    0xA2, 0x9D, 0xA1, 0xAD, 0x94, 0x99, 0x29, 0x95, 0x99, 0x95, 0x99, 0x90, 0x9E, 0x92, 0xAE, 0x1A,
+    0xE9, 0x0F, 0x3A, 0xFE, 0x5F, 0xD9, 0x69, 0x99, 0x99, 0x30, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x9D,
+    0x99, 0xD9, 0x9A, 0xA9, 0x99, 0x91, 0x99, 0x9E, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xEA, 0xAA, 0x1A,
+    0xAA, 0x09, 0x99, 0x19, 0x99, 0x93, 0xF0, 0xAE, 0xA2, 0x9E, 0x90, 0xAE, 0x39, 0xE1, 0xAD, 0xA3,
+    0x9D, 0xA1, 0xAD, 0x94, 0x99, 0x29, 0x90, 0x39, 0xD7, 0x0F, 0x49, 0x90, 0xEA, 0x09, 0x91, 0xD9,
+    0x0A, 0xA0, 0x9D, 0x1A, 0xD9, 0x19, 0xDA, 0x2F, 0xF3, 0x9F, 0xD7, 0x99, 0x40, 0x39, 0x99, 0x95,
+    0x9F, 0xDA, 0x2A, 0xFF, 0xA1, 0xEA, 0xAA, 0xAE, 0x09, 0xD5, 0xD9, 0x09, 0x95, 0x99, 0x00, 0x19,
+    0xDA, 0x1E, 0xA0, 0x9E, 0x90, 0xAE, 0x1F, 0x09, 0xEA, 0x0A, 0xEA, 0x19, 0x99, 0x10, 0x09, 0xEA,
+    0x0A, 0xEA, 0x0F, 0x1F, 0x1E, 0x90, 0x9E, 0x1A, 0xDA, 0x29, 0x92, 0xAE, 0x90, 0xAE, 0xA1, 0xF1,
+    0xF1, 0x9E, 0x2E, 0x91, 0xAD, 0xA2, 0x99, 0x00, 0x09, 0xEA, 0x0A, 0xEA, 0x0F, 0x1F, 0x1E, 0x90,
+    0x9E, 0x1A, 0xDA, 0x29, 0x92, 0x09, 0x99, 0x94, 0xFC, 0x4F, 0xA4, 0xAE, 0x94, 0x9E, 0x69, 0x90,
+    0x39, 0x99, 0x99, 0x39, 0xFA, 0x3F, 0x93, 0xF9, 0x3A, 0xE5, 0x99, 0x95, 0x70, 0x9C, 0xA0, 0x99,
+    0xAC, 0xAA, 0xFA, 0x99, 0x9A, 0xCA, 0x29, 0xCA, 0x39, 0x00, 0x5A, 0xC9, 0x2A, 0xCA, 0x99, 0x0A,
+    0xFA, 0xAC, 0xA9, 0x99, 0xAC, 0x93, 0x93, 0x7A, 0xFD, 0xA9, 0xAA, 0xAA, 0xAC, 0xA4, 0x9C, 0xA4,
+    0x9C, 0xA4, 0x9C, 0xA4, 0x9C, 0xA4, 0x9C, 0xA0, 0x72, 0xF9, 0x19, 0xF2, 0xAE, 0xA0, 0x9F, 0xC1,
+    0xAF, 0x91, 0xAD, 0xA7, 0x30, 0x19, 0x90, 0xEA, 0xD9, 0xD9, 0x0A, 0xCA, 0x09, 0xE0, 0x9C, 0xA0,
+    0x2A, 0xA5, 0xD5, 0xD3, 0xAA, 0xDA, 0xA1, 0xFD, 0x70, 0x0A, 0xAA, 0xAA, 0xA1, 0xFD, 0x3D, 0x5D,
+    0x5D, 0x72, 0x72, 0xD5, 0xD3, 0xFD, 0x1A, 0xAD, 0xAA, 0x3D, 0x5A, 0xA2, 0x0A, 0xAA, 0xAA, 0xA0,
+    0xFD, 0x60, 0x29, 0xAA, 0xA2, 0xAE, 0x2A, 0xE2, 0xAE, 0x2A, 0xE1, 0x9F, 0x9F, 0xCA, 0x9F, 0xC0,
+    0x9E, 0xA1, 0xAA, 0xA9, 0x2E, 0xA2, 0xEA, 0x2E, 0xA2, 0xEA, 0x2F, 0x91, 0xAF, 0xC9, 0x0F, 0xC9,
+    0x09, 0xF9, 0x6A, 0xE1, 0xF9, 0x0F, 0x90, 0xAE, 0x60, 0x0A, 0xD2, 0x9D, 0x91, 0xF1, 0xF1, 0xEA,
+    0x1F, 0x19, 0xD2, 0x9D, 0x90, 0x19, 0x99, 0x3F, 0xC9, 0x0A, 0xDA, 0xE0, 0xD9, 0x1D, 0x9D, 0x91,
+    0xD9, 0x9D, 0xAE, 0x1A, 0xF9, 0x39, 0x92, 0x6A, 0xE9, 0x0F, 0x1E, 0x91, 0xE2, 0x99, 0x20, 0x19,
+    0xD4, 0xEA, 0x39, 0xAE, 0x4E, 0x90, 0x99, 0xAE, 0x09, 0xFD, 0x1F, 0xA1, 0x29, 0x3D, 0xA1, 0xDA,
+    0x1A, 0xD2, 0xE9, 0x1F, 0xD9, 0xFC, 0x1A, 0xCA, 0xA0, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x9D, 0x99,
+    0xD9, 0x9A, 0xA9, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD1, 0xD5, 0xD1, 0xCA, 0x5A, 0xC1,
+    0xCA, 0x5A, 0xC1, 0x99, 0x59, 0x90, 0x73, 0x9C, 0x2D, 0x2C, 0x90, 0xCA, 0x9A, 0xDA, 0x9D, 0x19,
+    0xEA, 0xAE, 0x97, 0x40, 0x99, 0x96, 0x99, 0x09, 0xE9, 0x2A, 0xE1, 0x9E, 0xA0, 0xF3, 0xAF, 0xE9,
+    0x4F, 0xD9, 0x69, 0x99, 0x99, 0x30, 0x39, 0x99, 0x96, 0xFC, 0xA4, 0xAF, 0xDA, 0x2A, 0xE9, 0xAE,
+    0x90, 0x9E, 0x29, 0xE9, 0x99, 0x95, 0x99, 0x90, 0x09, 0x95, 0x99, 0x99, 0xD9, 0x39, 0xD9, 0x0F,
+    0xAA, 0xF1, 0x9F, 0xF9, 0x29, 0xFD, 0x96, 0x99, 0x40, 0x39, 0x99, 0x95, 0x9F, 0xDA, 0x2A, 0xFF,
+    0xA1, 0xEA, 0xAA, 0xAE, 0x09, 0xD5, 0xD9, 0x09, 0x95, 0x99, 0x00, 0x75, 0xAD, 0xA2, 0x9D, 0x0F,
+    0xDA, 0xAD, 0xAA, 0xFF, 0xD0, 0xDA, 0x19, 0xF9, 0x09, 0x94, 0x99, 0x20, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xA9, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFF, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF,
+    0xF9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x76, 0xAE, 0x92, 0xD1, 0xFE, 0xAE, 0x09, 0xFF,
+    0xD9, 0x0A, 0xD1, 0x9F, 0xA2, 0x95, 0x93, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF1,
+    0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0xAF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x39, 0xC7, 0x0E, 0xA5, 0xAF, 0xC3, 0x9F, 0xC9, 0x3F,
+    0xCA, 0x4F, 0xC9, 0x59, 0xD9, 0x70, 0x97, 0x00, 0x77, 0x7E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA,
+    0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE7, 0x19,
+    0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xE7, 0x19,
+    0xD9, 0x71, 0xE7, 0x2D, 0xA7, 0x1A, 0xD7, 0x2A, 0xAA, 0x71, 0x99, 0x1E, 0x09, 0xDA, 0x09, 0xD0,
+    0xAC, 0xAE, 0x9A, 0xC9, 0x00, 0x0A, 0x95, 0x9A, 0x1C, 0xA5, 0xAC, 0x1C, 0xA5, 0xAC, 0x1D, 0x99,
+    0x99, 0x99, 0xD1, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x73, 0xAF, 0xFD, 0xAA, 0xC9,
+    0x99, 0x99, 0x99, 0x9C, 0xAA, 0xC7, 0xCA, 0xAC, 0x7C, 0xAA, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x74, 0x9E, 0xAA, 0xE9, 0x1C, 0xA9, 0x9D, 0xA9, 0xAC, 0x09, 0xC2, 0xD2, 0xC9, 0x73,
+    0x09, 0x19, 0x0A, 0xC9, 0x9C, 0xA0, 0xF1, 0xAD, 0x90, 0x9F, 0x9A, 0xC1, 0xCA, 0x50, 0x4A, 0xDA,
+    0xCA, 0x0D, 0x90, 0x9D, 0x1A, 0xC9, 0x1D, 0x9A, 0xCA, 0xDA, 0x40, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x0F, 0xFF, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x94, 0xFC, 0x4A, 0xF4,
+    0x9E, 0xA5, 0xEA, 0x59, 0x99, 0x39, 0x99, 0x93, 0xFC, 0x2A, 0xF2, 0x9E, 0xA2, 0x9E, 0x94, 0x99,
+    0x50, 0x76, 0xAD, 0xA9, 0x19, 0xD1, 0xFE, 0xAE, 0x09, 0xFF, 0xD9, 0x0A, 0xD1, 0x9F, 0x91, 0x99,
+    0x59, 0x30, 0x9A, 0xAA, 0x1A, 0xF0, 0x9A, 0xE2, 0xE1, 0x9D, 0x92, 0x92, 0x6A, 0xAA, 0xA9, 0x59,
+    0xD9, 0x09, 0xF9, 0x9D, 0x91, 0xF0, 0xAE, 0xA0, 0xF1, 0xF0, 0xF1, 0xF1, 0x9D, 0x90, 0xE9, 0x19,
+    0xD9, 0x69, 0x99, 0x70, 0x09, 0x99, 0x3E, 0x92, 0xE9, 0x2F, 0xA1, 0xFC, 0x19, 0xF0, 0x75, 0x9F,
+    0xFF, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0x99, 0xCA, 0x7A, 0xC9, 0x9C, 0xA7, 0xAC, 0x99, 0xA9,
+    0x79, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x99, 0x91, 0x99, 0x9E, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xEA, 0xAA, 0x1A, 0xAA, 0x09, 0x99,
+    0x90, 0xAF, 0xA9, 0xAA, 0xAC, 0xA3, 0xCA, 0x3C, 0xA3, 0xCA, 0x76, 0x99, 0x0D, 0x19, 0x19, 0xFC,
+    0x90, 0xD1, 0xFF, 0xD1, 0xCA, 0x0A, 0xFC, 0x29, 0x1C, 0xA1, 0x97, 0x60, 0x49, 0x97, 0x0A, 0xDA,
+    0x7A, 0xE7, 0x9D, 0x95, 0xAD, 0x92, 0xD1, 0xAF, 0xCA, 0xAD, 0x1F, 0xFC, 0xA0, 0x9C, 0xA1, 0x9A,
+    0xE6, 0xAA, 0x70, 0xAD, 0xA7, 0xAD, 0xA7, 0x0A, 0xA4, 0x75, 0xAE, 0x91, 0xD1, 0xAF, 0xFA, 0x1D,
+    0x1A, 0xF2, 0x97, 0x3A, 0xDA, 0x91, 0xD1, 0x9F, 0xFA, 0x1D, 0x90, 0xAF, 0x29, 0x93, 0x99, 0x20,
+    0x39, 0x19, 0x59, 0xCA, 0x1A, 0xC9, 0x2A, 0xFF, 0xA2, 0xEA, 0xAE, 0x4A, 0xA1, 0xAA, 0x76, 0x7A,
+    0xA2, 0xAD, 0xA1, 0xAD, 0xA2, 0xD3, 0xD3, 0xD1, 0x9F, 0x3F, 0x3F, 0x99, 0xF3, 0xF3, 0xF9, 0x9C,
+    0x77, 0x1C, 0x99, 0xC7, 0x99, 0x7C, 0x99, 0xA5, 0xC0, 0xAA, 0x0C, 0x5A, 0x95, 0xA0, 0x93, 0x90,
+    0xA7, 0x3C, 0x7C, 0x71, 0x9A, 0x71, 0x99, 0x39, 0xA1, 0x9A, 0x71, 0xAA, 0x1A, 0x99, 0xC7, 0x71,
+    0xC9, 0x9C, 0x1C, 0x97, 0x2C, 0x1C, 0x99, 0xC1, 0x97, 0x39, 0x1C, 0x99, 0xC1, 0x9A, 0x71, 0x99,
+    0x1C, 0x93, 0x9A, 0x71, 0xAA, 0x71, 0xA7, 0xA7, 0x3C, 0x09, 0x39, 0x0C, 0x6A, 0x49, 0xC0, 0xAA,
+    0x0C, 0x94, 0xA0, 0x9C, 0x79, 0x97, 0xC9, 0x9C, 0x77, 0x1C, 0x99, 0xCA, 0xAA, 0x3A, 0xAA, 0xA3,
+    0xAA, 0xAC, 0x99, 0xF2, 0x9F, 0x92, 0xF9, 0x59, 0xA9, 0x3E, 0x92, 0xAD, 0x90, 0x9E, 0x99, 0xDA,
+    0x19, 0x93, 0x29, 0x1A, 0xD0, 0x9E, 0x0A, 0xD1, 0x9D, 0x2E, 0x19, 0xD5, 0x29, 0xAD, 0xA9, 0x4A,
+    0xFE, 0x29, 0xEA, 0xAE, 0xA1, 0xDA, 0x3A, 0xD1, 0xD0, 0x9D, 0xA0, 0xD4, 0xF7, 0xAD, 0xA7, 0x19,
+    0x40, 0x6C, 0x1A, 0x09, 0xF9, 0x0A, 0xDA, 0x1F, 0x09, 0xCA, 0x9C, 0x93, 0x90, 0x3A, 0x91, 0xAD,
+    0x99, 0xDA, 0x19, 0xDA, 0x29, 0xE3, 0x9A, 0x90, 0x9A, 0x39, 0xDA, 0x3A, 0xD9, 0x1A, 0xD9, 0x9E,
+    0x90, 0x9A, 0x30, 0x9A, 0x59, 0x91, 0x9D, 0xA2, 0xAD, 0x3A, 0xD9, 0x0E, 0x92, 0xAD, 0x99, 0xC9,
+    0xD1, 0xE9, 0x0A, 0xC0, 0xAC, 0x09, 0xA3, 0xCA, 0x1C, 0xA0, 0x09, 0x29, 0xD1, 0x9E, 0x19, 0xD1,
+    0x9D, 0x09, 0xDA, 0x09, 0xCA, 0x60, 0x6A, 0xE1, 0xFA, 0x0F, 0x90, 0xAE, 0x60, 0x2D, 0x39, 0x9D,
+    0x99, 0x1F, 0xD2, 0xAD, 0xA3, 0xF3, 0xA9, 0x9A, 0x10, 0x74, 0x9E, 0xAA, 0xE9, 0x09, 0xCA, 0x9A,
+    0xDA, 0x9A, 0xC9, 0xAC, 0x2D, 0x2C, 0xAA, 0xC2, 0xD2, 0xCA, 0x0D, 0x9A, 0xDA, 0x9D, 0x19, 0xE9,
+    0x9E, 0x90, 0x0C, 0xA3, 0xC9, 0x29, 0xFA, 0x9A, 0xAA, 0xC9, 0x29, 0xC3, 0x9A, 0x00, 0x9D, 0xA7,
+    0x7A, 0xD9, 0x0F, 0x75, 0xF2, 0xFC, 0x97, 0x9A, 0xF4, 0xFF, 0xFF, 0xD6, 0x9F, 0xFF, 0xD9, 0x71,
+    0x9A, 0xAF, 0xDA, 0xA6, 0x9D, 0xA7, 0x7A, 0xD9, 0x0F, 0x75, 0xF2, 0xFC, 0x97, 0x9A, 0xF4, 0xFF,
+    0xFF, 0xD6, 0x9F, 0xFF, 0xD9, 0x71, 0x9A, 0xAF, 0xDA, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xD7, 0x71, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFF, 0xFF, 0xD7, 0x71, 0x77, 0x71, 0x9F, 0xEA, 0xA9, 0x7D, 0x90, 0x9F, 0xFF, 0xDA, 0xAA, 0xAE,
+    0x1F, 0xAF, 0xFF, 0xFA, 0x09, 0xD6, 0x99, 0xAF, 0xF9, 0x29, 0x77, 0x94, 0x70, 0x99, 0x99, 0x99,
+    0x75, 0x9A, 0xFF, 0xE9, 0x79, 0xFF, 0xFF, 0x94, 0x9F, 0xCA, 0xA9, 0x99, 0x9A, 0xAF, 0xCA, 0x29,
+    0xEA, 0x97, 0x19, 0xAE, 0x91, 0xE9, 0x75, 0x9E, 0x19, 0x97, 0x71, 0x99, 0x00, 0x77, 0x77, 0x72,
+    0xC9, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x1F, 0xFF, 0xFF, 0xDA,
+    0x0A, 0xFF, 0xFF, 0xFC, 0x77, 0x4C, 0xA7, 0x75, 0x93, 0x19, 0x9A, 0x93, 0xFC, 0x5A, 0xC9, 0x09,
+    0xFC, 0x90, 0xD1, 0xAC, 0x90, 0xD9, 0x9D, 0x90, 0x9E, 0x9C, 0x97, 0x19, 0xA9, 0x19, 0xDA, 0xD0,
+    0xD1, 0x9C, 0xAF, 0xDA, 0xD4, 0xAC, 0xA9, 0x9A, 0x1A, 0xF7, 0xAC, 0x09, 0xA0, 0x99, 0x0A, 0xC9,
+    0xAC, 0x9A, 0xC9, 0xAC, 0x9A, 0xC9, 0xAC, 0x90, 0x29, 0xA9, 0x29, 0xFC, 0x1D, 0x1A, 0xCA, 0x0D,
+    0x19, 0xCA, 0x0D, 0x19, 0xCA, 0x0A, 0xCA, 0x9D, 0x91, 0xAE, 0x97, 0x00, 0x09, 0x92, 0x99, 0x0D,
+    0x19, 0xCA, 0x0D, 0x19, 0xCA, 0x0D, 0x19, 0xCA, 0x0D, 0x1A, 0xCA, 0x0D, 0xA9, 0xDA, 0x09, 0xE9,
+    0xCA, 0x70, 0x19, 0xAA, 0x91, 0xAF, 0x09, 0xD3, 0x9C, 0xA3, 0x9C, 0xA4, 0xDA, 0x9A, 0x19, 0xF7,
+    0x49, 0xC9, 0x4A, 0xCA, 0x19, 0xA9, 0xAC, 0xA0, 0xAF, 0xCA, 0x0D, 0x1A, 0xCA, 0x0D, 0x19, 0xCA,
+    0x0D, 0x19, 0xCA, 0x0D, 0xA9, 0xDA, 0x1E, 0x9C, 0x97, 0xD4, 0xD4, 0xD0, 0x9A, 0x1F, 0xD9, 0xD9,
+    0x0A, 0xCA, 0xD1, 0x9C, 0xAD, 0x19, 0xCA, 0xD1, 0x9C, 0xAD, 0x19, 0xCA, 0x09, 0x09, 0xAA, 0x19,
+    0xA9, 0x1F, 0xFD, 0x90, 0xD1, 0xDA, 0x09, 0xCA, 0x0D, 0x1A, 0xC9, 0x1D, 0x0D, 0x1A, 0xC9, 0x1D,
+    0x0D, 0x1A, 0xC9, 0x1D, 0x0D, 0x1A, 0xC9, 0x1C, 0xA0, 0x99, 0x09, 0xA0, 0xAC, 0xAD, 0x0A, 0xD2,
+    0xAC, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0x1A, 0xA2, 0x9D, 0x99, 0x0F, 0xA0, 0x9C, 0xA2,
+    0x9C, 0xA2, 0x9C, 0xA3, 0xD9, 0x91, 0xAD, 0xA5, 0x09, 0x92, 0x99, 0x1D, 0x19, 0xCA, 0x1A, 0xC9,
+    0x0A, 0xC3, 0xCA, 0x0D, 0x3D, 0xAC, 0x93, 0x9E, 0x5D, 0x92, 0x09, 0x91, 0x99, 0x90, 0xAC, 0x90,
+    0xD2, 0xF9, 0x29, 0xDA, 0x3A, 0xE2, 0x9C, 0xA9, 0xD1, 0xD1, 0xAC, 0xA0, 0x6F, 0xD7, 0x6F, 0xD9,
+    0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71,
+    0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6,
+    0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F,
+    0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x9F,
+    0xFA, 0xA9, 0x3A, 0xFF, 0xFA, 0x1A, 0xFF, 0xFC, 0xA0, 0xAF, 0xAA, 0xAA, 0xFD, 0x0A, 0xF4, 0xAF,
+    0x9A, 0xF5, 0xF9, 0xAF, 0x5F, 0x9A, 0xF4, 0xAF, 0x0A, 0xF9, 0x99, 0xAF, 0xC9, 0x0A, 0xFF, 0xEA,
+    0x2A, 0xFF, 0xEA, 0x91, 0xAF, 0xFF, 0xCA, 0x0A, 0xF4, 0xAF, 0x9A, 0xF5, 0xFC, 0xAF, 0x5A, 0xFA,
+    0xF5, 0xFC, 0xAF, 0x49, 0xFA, 0xAF, 0xAA, 0xAA, 0xFD, 0x9A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFA, 0x1A,
+    0xFF, 0xDA, 0x30, 0x9F, 0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x9F, 0xFE, 0x9F, 0x69, 0xF6, 0x9F, 0x69,
+    0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6,
+    0x9F, 0x69, 0xF6, 0x9F, 0x60, 0x6F, 0xCA, 0x74, 0x9F, 0xD7, 0x4F, 0xE9, 0x73, 0xFE, 0xA7, 0x2A,
+    0xE9, 0xF7, 0x2F, 0x0A, 0xE9, 0x70, 0x9F, 0x09, 0xF7, 0x0A, 0xEA, 0x1F, 0x70, 0xF2, 0xAE, 0xA6,
+    0x9F, 0x29, 0xF6, 0xAE, 0xA3, 0xF9, 0x5F, 0x4A, 0xEA, 0x49, 0xF4, 0x9F, 0x4F, 0xA5, 0xF9, 0x3F,
+    0x95, 0xAE, 0xA2, 0xAF, 0x69, 0xF2, 0xFA, 0x7F, 0x90, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAF, 0xC0,
+    0xAF, 0xFF, 0xFD, 0x0A, 0xFF, 0xFF, 0xD9, 0xAF, 0xFF, 0xFD, 0x90, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA,
+    0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA0,
+    0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA0, 0x0F, 0xFF, 0xE1, 0xFF,
+    0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFD, 0xA7, 0x2F, 0xC7, 0x2A, 0xF7, 0x3F, 0xA7, 0x2F, 0xC7, 0x2A,
+    0xF7, 0x29, 0xF9, 0x72, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xC7, 0x29, 0xF9,
+    0x72, 0xFA, 0x72, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09,
+    0xFF, 0xFE, 0x00, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F,
+    0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA,
+    0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x9F,
+    0x7A, 0xEA, 0x9F, 0x7A, 0xEA, 0x77, 0x72, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4,
+    0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC,
+    0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x90, 0x99, 0x99, 0x99, 0x90, 0x9F, 0x99, 0xF9, 0x0F, 0xE0, 0x9F,
+    0x99, 0xF9, 0x0F, 0xE0, 0x9F, 0x99, 0xF9, 0x0F, 0xE0, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x90, 0xFA,
+    0x70, 0xAF, 0x1F, 0xC7, 0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94, 0x9F, 0xC3, 0xAF, 0xDA,
+    0x9A, 0xFD, 0xA4, 0xFF, 0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9, 0x75, 0x99, 0x97, 0x00,
+    0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F, 0xCA, 0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF,
+    0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92,
+    0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x9F, 0x6A, 0xF0, 0x9F, 0x5A, 0xF9, 0x09, 0xF4, 0x9F,
+    0x91, 0x9F, 0x39, 0xFA, 0x29, 0xF3, 0xFC, 0x39, 0xF2, 0xFC, 0x49, 0xF1, 0xAF, 0x94, 0x9F, 0x09,
+    0xFA, 0x59, 0xF0, 0xFA, 0x69, 0xFF, 0xC7, 0x9F, 0xFC, 0xA6, 0x9F, 0xFD, 0x95, 0x9F, 0xCA, 0xFC,
+    0x59, 0xF9, 0x09, 0xFA, 0x49, 0xF2, 0xAF, 0x93, 0x9F, 0x3F, 0xC3, 0x9F, 0x39, 0xFA, 0x29, 0xF4,
+    0xFC, 0x29, 0xF5, 0xFC, 0x19, 0xF5, 0xAF, 0x90, 0x9F, 0x6F, 0xC0, 0x6F, 0xCA, 0x74, 0xAF, 0xD7,
+    0x4F, 0xE9, 0x73, 0xFE, 0xA7, 0x2A, 0xE9, 0xF7, 0x2F, 0x0A, 0xE9, 0x71, 0xF0, 0x9E, 0xA7, 0x0A,
+    0xEA, 0x1F, 0x70, 0xF9, 0x1F, 0x97, 0xF2, 0xAE, 0xA6, 0xAF, 0x29, 0xF6, 0xFA, 0x3F, 0x95, 0xF9,
+    0x3F, 0xA4, 0xAF, 0x49, 0xF4, 0xFA, 0x5F, 0x93, 0xF9, 0x5F, 0xA2, 0xAF, 0x6A, 0xF2, 0xFC, 0x69,
+    0xF9, 0x1F, 0xA7, 0xFA, 0x0A, 0xF9, 0x7F, 0xC0, 0xFC, 0x70, 0x9F, 0x90, 0x9F, 0xCA, 0x71, 0xFC,
+    0xA9, 0xFD, 0x70, 0xAF, 0xD9, 0xFD, 0x97, 0xFE, 0x9F, 0xDA, 0x7F, 0xE9, 0xFE, 0x6A, 0xFE, 0x9E,
+    0xAE, 0x95, 0xEA, 0xF9, 0xE9, 0xEA, 0x5E, 0x9F, 0x9E, 0x9A, 0xE4, 0xAE, 0x0F, 0x9E, 0x99, 0xE4,
+    0xEA, 0x0F, 0x9E, 0xA0, 0xEA, 0x3E, 0x90, 0xF9, 0xEA, 0x0F, 0x2A, 0xE1, 0xF9, 0xEA, 0x09, 0xE2,
+    0xEA, 0x1F, 0x9E, 0xA1, 0xE9, 0x1E, 0x91, 0xF9, 0xEA, 0x1F, 0x09, 0xE2, 0xF9, 0xEA, 0x1A, 0xE0,
+    0xEA, 0x2F, 0x9E, 0xA1, 0x9E, 0xAE, 0x92, 0xF9, 0xEA, 0x2F, 0xE3, 0xF9, 0xEA, 0x2A, 0xFC, 0xA3,
+    0xF9, 0xEA, 0x29, 0xFC, 0x93, 0xF9, 0xEA, 0x3F, 0xC4, 0xF9, 0xEA, 0x3A, 0xEA, 0x4F, 0x9F, 0xC9,
+    0x7A, 0xE0, 0x9F, 0xD7, 0xF0, 0x9F, 0xDA, 0x6F, 0x09, 0xFE, 0x6F, 0x09, 0xFE, 0xA5, 0xF0, 0x9F,
+    0xF9, 0x4F, 0x09, 0xE9, 0xFC, 0x4F, 0x09, 0xE9, 0x9F, 0x93, 0xF0, 0x9E, 0x90, 0xAF, 0x3F, 0x09,
+    0xEA, 0x1F, 0xA2, 0xF0, 0x9E, 0xA1, 0xAF, 0x2F, 0x09, 0xEA, 0x2F, 0xC1, 0xF0, 0x9E, 0xA2, 0x9F,
+    0x90, 0xF0, 0x9E, 0xA3, 0xFC, 0x0F, 0x09, 0xEA, 0x39, 0xF9, 0xAE, 0x09, 0xEA, 0x4A, 0xFF, 0x09,
+    0xEA, 0x5F, 0xF0, 0x9E, 0xA5, 0xAF, 0xE0, 0x9E, 0xA6, 0xFE, 0x09, 0xEA, 0x69, 0xFD, 0x09, 0xEA,
+    0x7F, 0xD0, 0x0A, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x77, 0x77,
+    0x77, 0x77, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0xAF, 0xFE, 0x3A, 0xFF, 0xE3, 0xAF, 0xFE,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xDA,
+    0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x77, 0x72, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF,
+    0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70,
+    0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC,
+    0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6,
+    0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9,
+    0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F,
+    0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F, 0x99, 0xF7, 0xF9, 0x9F, 0x7F,
+    0x90, 0x9F, 0xFA, 0x93, 0xAF, 0xFE, 0x91, 0xAF, 0xFF, 0xA0, 0xAF, 0xFF, 0xC0, 0xAF, 0x3A, 0xFA,
+    0xAF, 0x4F, 0xCA, 0xF4, 0xAF, 0xAF, 0x4A, 0xFA, 0xF4, 0xFA, 0xAF, 0x29, 0xFC, 0x9A, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xF1, 0xAF, 0xFD, 0xA2, 0xAF, 0xAA, 0xAA, 0x94, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71,
+    0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0xAF, 0x71, 0x0F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1,
+    0xFD, 0xAF, 0xEA, 0x2F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xF9,
+    0x72, 0x9F, 0x97, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xC7, 0x2A, 0xF7, 0x2A, 0xF7, 0x29, 0xF9, 0x72,
+    0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x00,
+    0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE6, 0xFA, 0x73, 0xFA, 0x73,
+    0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73,
+    0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x50, 0xAF, 0x7A,
+    0xF0, 0x9F, 0xA6, 0xFA, 0x1F, 0xC5, 0xAF, 0x3F, 0x94, 0xF9, 0x3A, 0xF3, 0xAF, 0x5F, 0x92, 0xF9,
+    0x5A, 0xF1, 0xAF, 0x7F, 0x90, 0xF9, 0x7A, 0xFA, 0xF7, 0x1F, 0xF7, 0x29, 0xFD, 0xA7, 0x3F, 0xD7,
+    0x49, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9,
+    0x75, 0xF9, 0x60, 0x71, 0xF9, 0x77, 0x3F, 0x97, 0x79, 0xAF, 0xFA, 0xA9, 0x71, 0xFF, 0xFF, 0x95,
+    0x9F, 0xFF, 0xFD, 0xA3, 0x9F, 0xEA, 0xFC, 0xAF, 0xDA, 0x2F, 0xC9, 0x2F, 0x91, 0x9F, 0xC1, 0x9F,
+    0x93, 0xF9, 0x3F, 0xA0, 0xAF, 0x4F, 0x93, 0xAF, 0x0A, 0xEA, 0x4F, 0x93, 0x9F, 0x0A, 0xEA, 0x4F,
+    0x93, 0x9F, 0x0A, 0xF4, 0xF9, 0x39, 0xF0, 0x9F, 0x4F, 0x93, 0xFA, 0x1F, 0xC3, 0xF9, 0x29, 0xF9,
+    0x1A, 0xFC, 0x91, 0xF9, 0x09, 0xAF, 0xC3, 0xFF, 0xFF, 0xF5, 0xAF, 0xFF, 0xFC, 0x79, 0xAF, 0xFF,
+    0xC9, 0x74, 0x99, 0xFA, 0x97, 0x72, 0xF9, 0x77, 0x3F, 0x97, 0x77, 0x72, 0x0F, 0xA6, 0x9F, 0xA1,
+    0xAF, 0x95, 0xFC, 0x3F, 0xC4, 0x9F, 0x93, 0x9F, 0x93, 0xFC, 0x5A, 0xF2, 0xAF, 0x7F, 0xA1, 0xFA,
+    0x79, 0xF9, 0xFC, 0x71, 0xFF, 0xC9, 0x72, 0xFE, 0xA7, 0x39, 0xFD, 0x75, 0xFC, 0xA7, 0x4F, 0xE7,
+    0x39, 0xFE, 0xA7, 0x2F, 0xFC, 0x97, 0x0A, 0xF0, 0xAF, 0x79, 0xF9, 0x1F, 0xA6, 0xFC, 0x29, 0xF9,
+    0x4A, 0xF4, 0xFC, 0x39, 0xFA, 0x5F, 0xA2, 0xFC, 0x6A, 0xF9, 0x0A, 0xF9, 0x7F, 0xC0, 0x9E, 0xA3,
+    0xEA, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x0A, 0xEA,
+    0x3F, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x0A, 0xEA, 0x3F, 0x3F, 0x09, 0xEA,
+    0x3F, 0x3F, 0x09, 0xF3, 0xF3, 0xF1, 0xF9, 0x2F, 0x2A, 0xEA, 0x1A, 0xF9, 0x1F, 0x1A, 0xF9, 0x2F,
+    0xFF, 0xFD, 0x39, 0xFF, 0xFF, 0x6F, 0xFF, 0xCA, 0x71, 0x9A, 0xAF, 0xAA, 0x97, 0x6F, 0x77, 0x1F,
+    0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x70, 0x77, 0x73, 0x9A, 0xFD, 0xA9, 0x72, 0xFF, 0xF7, 0x0F,
+    0xFF, 0xD6, 0xFE, 0xAA, 0xAF, 0xD4, 0xAF, 0xC5, 0xFC, 0xA3, 0xFC, 0x7F, 0xC2, 0x9F, 0x97, 0x9F,
+    0xA1, 0xAF, 0x71, 0xFC, 0x1F, 0xC7, 0x1A, 0xF1, 0xFA, 0x71, 0xAF, 0x1F, 0xC7, 0x1A, 0xF1, 0xAF,
+    0x71, 0xFC, 0x19, 0xF7, 0x1F, 0x92, 0xF9, 0x79, 0xF3, 0xAF, 0x7F, 0xA4, 0xFA, 0x5A, 0xF6, 0xAE,
+    0xA3, 0xAF, 0x4A, 0xAA, 0xAF, 0x91, 0x9F, 0xAA, 0xAA, 0x1F, 0xF9, 0x19, 0xFF, 0x1F, 0xF9, 0x19,
+    0xFF, 0x1F, 0xF9, 0x19, 0xFF, 0x00, 0x77, 0x49, 0xFC, 0x90, 0x9E, 0x93, 0xAF, 0xEA, 0xAE, 0x92,
+    0x9F, 0xFF, 0xC9, 0x2F, 0xCA, 0x99, 0xAF, 0xC9, 0x2F, 0xA3, 0xAF, 0x91, 0x9F, 0x5F, 0x91, 0xAF,
+    0x5F, 0x91, 0xAF, 0x5F, 0x91, 0xAF, 0x5F, 0x91, 0xAF, 0x5F, 0x91, 0x9F, 0x5F, 0x92, 0xFA, 0x39,
+    0xF9, 0x2F, 0xCA, 0x19, 0xFC, 0xA2, 0x9F, 0xFF, 0xE9, 0x1A, 0xFE, 0xA0, 0xFC, 0x92, 0x9F, 0xC9,
+    0x19, 0xF9, 0x59, 0x79, 0x10, 0x59, 0x97, 0x2A, 0xFE, 0x95, 0xFF, 0xD9, 0x3F, 0xFF, 0x29, 0xFA,
+    0x19, 0xFA, 0x1A, 0xF3, 0xFC, 0x1F, 0xA3, 0xAF, 0x1F, 0xA3, 0xAE, 0xA1, 0xFA, 0x3F, 0x91, 0xFA,
+    0x2A, 0xEA, 0x2F, 0xA0, 0xFC, 0xA3, 0xFA, 0x0F, 0xA9, 0x3F, 0xA0, 0xFE, 0x2F, 0xA2, 0x9F, 0xC1,
+    0xFA, 0x4F, 0xA0, 0xFA, 0x4A, 0xF0, 0xFA, 0x49, 0xF0, 0xFA, 0x4A, 0xF0, 0xFA, 0x4F, 0xC0, 0xFC,
+    0xA9, 0x09, 0xFC, 0xA0, 0xFF, 0xFD, 0x1F, 0xFF, 0xC9, 0x1F, 0xFE, 0xA3, 0xFA, 0x19, 0x96, 0xFA,
+    0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFA, 0x5F, 0x99, 0xF5, 0xFA,
+    0x0F, 0x5F, 0x90, 0xFA, 0x4F, 0x90, 0x9F, 0x4F, 0x91, 0xF4, 0xF2, 0xAE, 0xA2, 0x9F, 0x29, 0xF2,
+    0xAE, 0xA3, 0xF2, 0xF9, 0x3A, 0xE9, 0x09, 0xF4, 0x9F, 0x0A, 0xE9, 0x5F, 0x9F, 0x6A, 0xFE, 0x97,
+    0xFD, 0xA7, 0x0F, 0xD7, 0x1A, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7,
+    0x29, 0xF7, 0x75, 0x79, 0x97, 0x19, 0xFE, 0xA5, 0xAF, 0xFD, 0x92, 0x9F, 0xFE, 0x92, 0xAF, 0x3A,
+    0xD3, 0xAE, 0xA5, 0x93, 0xAF, 0x73, 0xFC, 0x97, 0x19, 0xFD, 0x97, 0x09, 0xFD, 0xA6, 0xAF, 0xFC,
+    0x4F, 0xCA, 0xAF, 0xC2, 0xFC, 0x29, 0xFA, 0x09, 0xF4, 0xAF, 0x0F, 0xA5, 0xF9, 0xF9, 0x5F, 0x9F,
+    0x95, 0xF9, 0xFA, 0x5F, 0x9A, 0xF4, 0xAF, 0x09, 0xFC, 0x90, 0x9A, 0xFC, 0x1A, 0xFF, 0xF3, 0xAF,
+    0xFD, 0x94, 0x9F, 0xEA, 0x72, 0x99, 0x60, 0x77, 0xAF, 0xEA, 0x2F, 0xFD, 0xA0, 0xFF, 0xE1, 0xF9,
+    0x29, 0xAC, 0x1F, 0x70, 0xF7, 0x09, 0xFC, 0xAA, 0xA5, 0xFD, 0xA3, 0x9F, 0xEA, 0x29, 0xFA, 0x99,
+    0x99, 0x2F, 0xA7, 0xFA, 0x7F, 0xC9, 0x39, 0xC9, 0xAF, 0xFE, 0x90, 0xAF, 0xFD, 0x91, 0x9F, 0xF9,
+    0x69, 0x94, 0x76, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xF7, 0x0F, 0x97, 0xFA, 0x7F, 0xC7, 0xAF, 0x7A,
+    0xF7, 0x9F, 0x97, 0xFA, 0x7F, 0xC7, 0x9F, 0x70, 0xFA, 0x79, 0xF7, 0x0A, 0xF7, 0x0A, 0xF7, 0x0A,
+    0xF7, 0x0A, 0xFA, 0x79, 0xFD, 0xA9, 0x5A, 0xFF, 0xA4, 0xAF, 0xFC, 0x93, 0x9A, 0xFF, 0x69, 0xAF,
+    0xC7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xEA, 0x70, 0xF7, 0x09, 0xEA, 0x10, 0x76, 0xEA, 0x1A, 0xFC,
+    0x91, 0xF0, 0xFF, 0x90, 0xFF, 0xFD, 0x0F, 0xDA, 0x99, 0xFC, 0x9F, 0xC9, 0x3F, 0xAF, 0xC4, 0xFA,
+    0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA,
+    0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0xFA, 0x4A, 0xEA, 0x71, 0xAE,
+    0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xEA, 0x71, 0xAE, 0xA0,
+    0x69, 0x97, 0x2A, 0xFD, 0x96, 0xFF, 0xCA, 0x4F, 0xFE, 0xA2, 0x9F, 0x91, 0x9F, 0x2F, 0xA3, 0xAE,
+    0xA1, 0xF4, 0x9F, 0x09, 0xF5, 0xF0, 0x9F, 0x5F, 0x9A, 0xF5, 0xF9, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF,
+    0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0x99, 0x99, 0x99, 0xFA, 0x9F, 0x5F, 0x99, 0xF5, 0xF9, 0x0F, 0x5F,
+    0x1F, 0x49, 0xF1, 0xAE, 0xA3, 0xAE, 0xA2, 0xF9, 0x19, 0xF3, 0xAF, 0xFD, 0xA4, 0xAF, 0xFC, 0x69,
+    0xFD, 0x97, 0x29, 0x96, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAF, 0x3A, 0xFA, 0x09, 0x90, 0xFF,
+    0x0A, 0xFE, 0x19, 0xFD, 0x49, 0x91, 0xAE, 0xA4, 0x9F, 0x90, 0xAE, 0xA4, 0xF9, 0x1A, 0xEA, 0x3F,
+    0xA2, 0xAE, 0xA2, 0xFA, 0x3A, 0xEA, 0x1A, 0xF4, 0xAE, 0xA0, 0xAF, 0x5A, 0xEA, 0x9F, 0x6A, 0xFF,
+    0xA6, 0xAF, 0xFC, 0x95, 0xAF, 0xFD, 0x5A, 0xFA, 0x0F, 0xC4, 0xAE, 0xA2, 0xFA, 0x3A, 0xEA, 0x29,
+    0xF9, 0x2A, 0xEA, 0x3A, 0xF2, 0xAE, 0xA4, 0xFC, 0x1A, 0xEA, 0x49, 0xFA, 0x00, 0x19, 0x97, 0x4A,
+    0xFC, 0xA7, 0x1A, 0xFE, 0x70, 0xAF, 0xEA, 0x72, 0x9F, 0xC7, 0x4F, 0x97, 0x39, 0xF7, 0x39, 0xF7,
+    0x3A, 0xFA, 0x72, 0xFD, 0x71, 0x9F, 0xD9, 0x70, 0xFE, 0xA7, 0x0E, 0xAF, 0x7A, 0xE9, 0xF9, 0x6F,
+    0x09, 0xF5, 0x9F, 0x1F, 0x5A, 0xEA, 0x1F, 0xA4, 0xF9, 0x19, 0xF3, 0x9F, 0x3F, 0x92, 0xAE, 0xA3,
+    0xFC, 0x99, 0x0F, 0x93, 0x9F, 0xD9, 0xF5, 0xFF, 0xE5, 0x9F, 0xA7, 0x59, 0x10, 0xF9, 0x4A, 0xEA,
+    0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F,
+    0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xFC, 0x1F, 0xA4, 0xFC, 0x1F, 0xC3,
+    0x9F, 0xC1, 0xFD, 0x99, 0xAF, 0xD9, 0x0F, 0xFF, 0xFF, 0xFE, 0x9A, 0xFF, 0xCA, 0xF9, 0x1F, 0xFC,
+    0x91, 0x95, 0x91, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x5F, 0x99, 0xF5, 0xFA, 0x0F, 0x5F, 0x90, 0xFA, 0x4F, 0x90, 0x9F, 0x4F, 0x91, 0xF4, 0xF2, 0xAE,
+    0xA2, 0x9F, 0x29, 0xF2, 0xAE, 0xA3, 0xF2, 0xF9, 0x3A, 0xE9, 0x09, 0xF4, 0x9F, 0x0A, 0xE9, 0x5F,
+    0x9F, 0x6A, 0xFE, 0x97, 0xFD, 0xA7, 0x0F, 0xD7, 0x19, 0xF5, 0x76, 0xFF, 0xF9, 0x0F, 0xFF, 0x90,
+    0xFF, 0xF9, 0x29, 0xE9, 0x7F, 0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0A, 0xF7, 0x09, 0xFC, 0x97, 0x9F,
+    0xFC, 0xA4, 0xFF, 0xA2, 0xAF, 0xFC, 0xA1, 0xAF, 0xA9, 0x6F, 0x97, 0xAF, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0xAF, 0x97, 0x0F, 0xDA, 0x95, 0xAF, 0xFC, 0x93, 0xAF, 0xFC, 0xA4, 0xAF, 0xF7, 0x9F, 0xC9,
+    0x70, 0xF9, 0x70, 0xF7, 0x1F, 0x70, 0xAE, 0xA7, 0x0F, 0x10, 0x77, 0x3A, 0xFD, 0xA6, 0xFF, 0xD9,
+    0x3F, 0xFF, 0x2A, 0xFA, 0x19, 0xFC, 0x1F, 0xA3, 0x9F, 0x99, 0xF5, 0xFA, 0xAF, 0x5F, 0xAA, 0xF5,
+    0xAF, 0xAF, 0x5A, 0xFA, 0xF5, 0xFA, 0x9F, 0x5F, 0xA0, 0xFA, 0x39, 0xF9, 0x0A, 0xFA, 0x19, 0xFC,
+    0x2F, 0xFF, 0x93, 0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x29, 0x96, 0x9F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0x09, 0x99, 0xFA, 0x99, 0x99, 0xFA, 0x99, 0x93, 0xF9, 0x3F, 0xA6, 0xF9, 0x3F,
+    0xA6, 0xF9, 0x3F, 0xA6, 0xF9, 0x3F, 0xA6, 0xF9, 0x3F, 0xA6, 0xF9, 0x3F, 0xA6, 0xF9, 0x3F, 0xA6,
+    0xF9, 0x3F, 0xA6, 0xF9, 0x3F, 0xC9, 0x99, 0x3F, 0x93, 0xAF, 0xDA, 0x3F, 0x94, 0xFD, 0xA3, 0xF9,
+    0x49, 0xFC, 0x97, 0x70, 0x92, 0x77, 0x39, 0xFD, 0xA6, 0xFF, 0xD4, 0xFF, 0xF2, 0x9F, 0xA1, 0xAF,
+    0xA1, 0xFA, 0x3A, 0xF1, 0xF9, 0x4F, 0x90, 0xF5, 0xFA, 0x9F, 0x5F, 0xA9, 0xF5, 0xFA, 0x9F, 0x5F,
+    0xA9, 0xF5, 0xF9, 0x9F, 0x4A, 0xF0, 0x9F, 0xC9, 0x19, 0xFC, 0x09, 0xFF, 0xFC, 0x19, 0xFF, 0xF9,
+    0x19, 0xF9, 0xFD, 0x92, 0x9F, 0x29, 0x95, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72, 0x9F,
+    0x72, 0x9F, 0x72, 0x77, 0x19, 0xFD, 0xA9, 0x3F, 0xFD, 0x2F, 0xFD, 0x91, 0xAF, 0xA9, 0x99, 0xAC,
+    0x2F, 0xA7, 0x9F, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0x9F, 0x71, 0xFC, 0x70,
+    0xFD, 0xA9, 0x6F, 0xFA, 0x49, 0xFF, 0xC9, 0x4A, 0xFF, 0x69, 0xAF, 0xC7, 0x09, 0xF7, 0x09, 0xF7,
+    0x09, 0xEA, 0x70, 0xF7, 0x09, 0xEA, 0x10, 0x4A, 0xFF, 0xE2, 0xAF, 0xFF, 0xC1, 0xFF, 0xFE, 0x0A,
+    0xFC, 0x99, 0x9E, 0xA9, 0x99, 0x0F, 0xA3, 0xAE, 0x91, 0x9F, 0x49, 0xF1, 0xAF, 0x5F, 0x1A, 0xF5,
+    0xF9, 0x0A, 0xF5, 0xF9, 0x0A, 0xF5, 0xF9, 0x09, 0xF4, 0x9F, 0x2F, 0x93, 0xAF, 0x2A, 0xFA, 0x09,
+    0xAF, 0x93, 0xFF, 0xF5, 0xFF, 0xD7, 0xAF, 0xD9, 0x73, 0x99, 0x70, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF,
+    0xCA, 0x9F, 0xFF, 0xCA, 0x09, 0x99, 0xAF, 0x99, 0x99, 0x94, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71,
+    0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x71, 0x9F, 0x72, 0xFA, 0x19, 0x95, 0xFF, 0xA5, 0x9F,
+    0xEA, 0x69, 0xFD, 0x97, 0x19, 0x93, 0xF9, 0x39, 0xF0, 0xFA, 0x4F, 0x0F, 0xA4, 0xF9, 0xFA, 0x4F,
+    0xAF, 0xA4, 0xAE, 0xAF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0xA4, 0xAE,
+    0xAA, 0xEA, 0x4F, 0xAA, 0xF3, 0x9F, 0x99, 0xFA, 0x90, 0x9F, 0xC1, 0xFF, 0xF9, 0x2F, 0xFD, 0x94,
+    0xAF, 0xDA, 0x71, 0x99, 0x60, 0x77, 0x76, 0xF7, 0x71, 0xF7, 0x71, 0xF7, 0x71, 0xF7, 0x71, 0xF7,
+    0x71, 0xF7, 0x59, 0xAF, 0xFA, 0x70, 0x9F, 0xFF, 0xCA, 0x5A, 0xFF, 0xFF, 0x92, 0x9F, 0xCA, 0x9F,
+    0x9A, 0xFC, 0x2F, 0xC2, 0xF1, 0x9F, 0xA0, 0x9F, 0x92, 0xF2, 0xAF, 0x0A, 0xF3, 0xF3, 0xF9, 0xAF,
+    0x3F, 0x3F, 0x9A, 0xF3, 0xF3, 0xF9, 0xAF, 0x3F, 0x3F, 0x99, 0xF9, 0x2F, 0x2A, 0xF1, 0xFC, 0x2F,
+    0x2F, 0xA1, 0x9F, 0xC9, 0x0F, 0x0A, 0xFC, 0x39, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xD9, 0x79, 0xAF,
+    0xFA, 0x97, 0x5F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1F, 0x70,
+    0x77, 0x2A, 0xF7, 0x9F, 0x0F, 0xD6, 0xF9, 0x0F, 0xE4, 0x9F, 0x1A, 0xAA, 0xF9, 0x3F, 0x94, 0xAF,
+    0x29, 0xEA, 0x6F, 0x91, 0xF7, 0xAF, 0x09, 0xEA, 0x70, 0xF9, 0xF7, 0x19, 0xFE, 0x97, 0x2F, 0xE7,
+    0x39, 0xFC, 0x97, 0x4F, 0xC7, 0x49, 0xFC, 0x74, 0xFD, 0x97, 0x2A, 0xFE, 0x72, 0xFF, 0x97, 0x0A,
+    0xE9, 0x9F, 0x79, 0xF1, 0xFA, 0x6F, 0x29, 0xF5, 0xAE, 0xA3, 0xFC, 0xAA, 0x2F, 0x49, 0xFD, 0x90,
+    0xAE, 0xA5, 0xAF, 0xC9, 0x9F, 0x7A, 0xF7, 0x73, 0x77, 0x74, 0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x70,
+    0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x0F, 0x3F, 0x2F, 0x90, 0xF9, 0x2F, 0x2A, 0xEA, 0x0F, 0x92, 0xF2,
+    0x9F, 0x0F, 0x92, 0xF3, 0xF0, 0xF9, 0x2F, 0x3F, 0x9F, 0x92, 0xF3, 0xF9, 0xF9, 0x2F, 0x3F, 0x9F,
+    0x92, 0xF3, 0xF9, 0xF9, 0x2F, 0x3F, 0x9F, 0x92, 0xF3, 0xF9, 0xFA, 0x2F, 0x29, 0xF0, 0xAF, 0x2F,
+    0x2F, 0xC1, 0xFC, 0xA9, 0xF9, 0xAF, 0xC9, 0x1A, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xDA, 0x6A, 0xFF,
+    0xDA, 0x74, 0xF9, 0x77, 0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x70, 0xF7, 0x00,
+    0x2F, 0x70, 0xAE, 0x93, 0xAE, 0x72, 0xF3, 0xEA, 0x72, 0x9E, 0xA1, 0xAE, 0x97, 0x3F, 0x1F, 0x74,
+    0xAE, 0x90, 0xF3, 0x9E, 0xA3, 0xAE, 0x99, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x9E, 0xA3, 0x9E, 0xA3,
+    0x9E, 0xA9, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA0, 0xF3, 0x9E, 0xA3,
+    0xAE, 0x90, 0xF3, 0xAF, 0x3F, 0x90, 0xAF, 0x90, 0x9F, 0xCA, 0x1A, 0xF2, 0xFF, 0xC9, 0xFF, 0xC9,
+    0x29, 0xFF, 0x0A, 0xFE, 0xA4, 0x9F, 0xCA, 0x2A, 0xFC, 0x97, 0x09, 0x97, 0x95, 0x6F, 0xD7, 0x6F,
+    0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F,
+    0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A,
+    0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9,
+    0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC7,
+    0x77, 0x77, 0x72, 0xAE, 0x77, 0x0F, 0x97, 0x7F, 0x97, 0x7A, 0xE7, 0x77, 0x50, 0x77, 0x1A, 0xFE,
+    0xA4, 0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91,
+    0xFF, 0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91,
+    0x9F, 0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x77, 0x75,
+    0xEA, 0x71, 0xAF, 0x71, 0xAF, 0x72, 0xEA, 0x77, 0x30, 0x77, 0x73, 0xFC, 0x97, 0x6F, 0xD7, 0x69,
+    0x09, 0xE9, 0x77, 0x0E, 0x97, 0x69, 0xF7, 0x7A, 0xD9, 0x77, 0x09, 0xAA, 0x77, 0x77, 0x5F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC0, 0x77, 0x29, 0xFC, 0x70, 0x9F, 0xD7, 0x09, 0x0A, 0xE7, 0x29, 0xE7, 0x1A, 0xEA, 0x71, 0xE9,
+    0x72, 0xAA, 0x97, 0x77, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9,
+    0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F,
+    0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC,
+    0xA1, 0xE9, 0x39, 0x97, 0x00, 0x77, 0x9A, 0xA9, 0x77, 0x9E, 0x70, 0x9F, 0xA1, 0xE7, 0x1F, 0xD9,
+    0xAA, 0xA7, 0x1E, 0xAA, 0xE7, 0x3A, 0xD9, 0x19, 0xE7, 0x2A, 0xA5, 0xAA, 0x77, 0x77, 0x1F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC0, 0x74, 0x9A, 0xAA, 0x75, 0xE9, 0x5F, 0xC9, 0x0A, 0xD9, 0x5A, 0xFD, 0x9A, 0xA6, 0x9E, 0x0A,
+    0xE7, 0x9D, 0xA2, 0x9D, 0xA7, 0x99, 0x59, 0x97, 0x77, 0x1A, 0xFE, 0xA7, 0xFF, 0xE6, 0xAF, 0xFE,
+    0x6C, 0xA9, 0x2A, 0xF7, 0x5F, 0x97, 0x4F, 0x96, 0x9A, 0xFF, 0x94, 0xFF, 0xF9, 0x3F, 0xEA, 0xAF,
+    0x92, 0xAF, 0x93, 0xF9, 0x2F, 0xC4, 0xF9, 0x2F, 0xA3, 0x9F, 0x92, 0xAF, 0x91, 0x9F, 0xC9, 0x29,
+    0xFF, 0xFC, 0x93, 0xFF, 0xC9, 0xE9, 0x4A, 0xFC, 0xA1, 0xE9, 0x69, 0x97, 0x30, 0x0A, 0xAA, 0x77,
+    0x1E, 0xA7, 0x71, 0xAD, 0x90, 0x9F, 0xA7, 0x29, 0xAA, 0x0F, 0xD9, 0x74, 0xEA, 0x9E, 0x73, 0xAD,
+    0x91, 0x9E, 0x72, 0xAA, 0x5A, 0xA7, 0x77, 0x71, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F,
+    0xF7, 0x4F, 0xAE, 0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE,
+    0xA1, 0x9F, 0x70, 0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5,
+    0x9F, 0xFF, 0xDA, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F,
+    0xA7, 0x9F, 0x90, 0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x9A, 0xAA, 0x75, 0xE9, 0x75,
+    0xE1, 0xFC, 0x96, 0x9A, 0x9A, 0xFD, 0x70, 0x9E, 0x0A, 0xE7, 0xE2, 0x9D, 0xA6, 0x99, 0x59, 0x97,
+    0x77, 0xAF, 0xEA, 0x6F, 0xFE, 0x5A, 0xFF, 0xE5, 0xCA, 0x92, 0xAF, 0x74, 0xF9, 0x73, 0xF9, 0x59,
+    0xAF, 0xF9, 0x3F, 0xFF, 0x92, 0xFE, 0xAA, 0xF9, 0x1A, 0xF9, 0x3F, 0x91, 0xFC, 0x4F, 0x91, 0xFA,
+    0x39, 0xF9, 0x1A, 0xF9, 0x19, 0xFC, 0x91, 0x9F, 0xFF, 0xC9, 0x2F, 0xFC, 0x9E, 0x93, 0xAF, 0xCA,
+    0x1E, 0x95, 0x99, 0x70, 0x77, 0x77, 0x2E, 0xA7, 0x70, 0xAA, 0xD9, 0x77, 0x1D, 0x71, 0x9F, 0xA0,
+    0x9D, 0x97, 0x1F, 0xD9, 0x9C, 0x97, 0x1E, 0xA9, 0xE7, 0x3A, 0xD9, 0x19, 0xE7, 0x2A, 0xA5, 0xAA,
+    0x77, 0x77, 0x1F, 0xD7, 0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE,
+    0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7,
+    0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70,
+    0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x73, 0x99, 0x74, 0x9E, 0xA7, 0x39, 0xAD, 0x74, 0x9D, 0x4F, 0xC9,
+    0x0D, 0xA4, 0xAF, 0xD0, 0x9A, 0x49, 0xE0, 0xAE, 0x6E, 0x29, 0xDA, 0x59, 0x95, 0x99, 0x77, 0x5A,
+    0xFE, 0xA5, 0xFF, 0xE4, 0xAF, 0xFE, 0x4C, 0xA9, 0x2A, 0xF7, 0x3F, 0x97, 0x2F, 0x94, 0x9A, 0xFF,
+    0x92, 0xFF, 0xF9, 0x1F, 0xEA, 0xAF, 0x90, 0xAF, 0x93, 0xF9, 0x0F, 0xC4, 0xF9, 0x0F, 0xA3, 0x9F,
+    0x90, 0xAF, 0x91, 0x9F, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0xFF, 0xC9, 0xE9, 0x2A, 0xFC, 0xA1, 0xE9,
+    0x49, 0x97, 0x10, 0x69, 0xAA, 0x92, 0xAC, 0x72, 0x9F, 0xCA, 0xAD, 0x72, 0xD9, 0x9F, 0xC9, 0x72,
+    0xA9, 0x29, 0xAA, 0x97, 0x6A, 0xAA, 0xA7, 0x7F, 0xCA, 0x75, 0xAD, 0xAE, 0xA7, 0x3A, 0xD9, 0x1A,
+    0xDA, 0x72, 0xA9, 0x59, 0xA7, 0x77, 0x70, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F, 0xF7,
+    0x4F, 0xAE, 0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE, 0xA1,
+    0x9F, 0x70, 0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5, 0x9F,
+    0xFF, 0xDA, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F, 0xA7,
+    0x9F, 0x90, 0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x4A, 0xDA, 0x2D, 0x4F, 0xDA, 0xDA,
+    0x39, 0xCA, 0x09, 0xFC, 0x59, 0x49, 0x97, 0x09, 0xEA, 0x70, 0x9F, 0xCA, 0x69, 0xE9, 0xEA, 0x49,
+    0xDA, 0x2A, 0xD9, 0x49, 0x69, 0x97, 0x72, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92,
+    0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93,
+    0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xA9,
+    0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x79, 0x99, 0x97, 0x7A, 0xFC, 0x75, 0xAF, 0xDA,
+    0x73, 0x9E, 0xA9, 0xEA, 0x71, 0x9E, 0x92, 0xEA, 0x71, 0x99, 0x59, 0x99, 0x77, 0x77, 0x0F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC7, 0x77, 0x77, 0x72, 0xAE, 0x77, 0x0F, 0x97, 0x7F, 0x97, 0x7A, 0xE7, 0x77, 0x50, 0x59, 0x99,
+    0x97, 0x1F, 0xCA, 0x7F, 0xE9, 0x5A, 0xE9, 0xAE, 0x93, 0xAE, 0x29, 0xE9, 0x29, 0x99, 0x59, 0x97,
+    0x73, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39,
+    0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F,
+    0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39,
+    0x97, 0x77, 0x5E, 0x97, 0x1A, 0xF7, 0x1A, 0xF7, 0x2E, 0x97, 0x73, 0x71, 0x99, 0x99, 0x77, 0x0E,
+    0x77, 0x0A, 0xD7, 0x5D, 0x90, 0xD1, 0xAC, 0x97, 0x1A, 0xD3, 0x9D, 0x73, 0xFF, 0xC7, 0x4F, 0xE7,
+    0x69, 0x9A, 0x97, 0x77, 0x74, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD, 0xA7, 0x4F, 0xF7, 0x4F, 0xAE,
+    0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9, 0x70, 0xAE, 0xA1, 0x9F, 0x70,
+    0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA, 0xAF, 0xC5, 0x9F, 0xFF, 0xDA,
+    0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7, 0xFC, 0x2F, 0xA7, 0x9F, 0x90,
+    0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x7A, 0xAA, 0x72, 0x9D, 0xA7, 0x2D, 0xA7, 0xD0,
+    0x9A, 0x91, 0xD4, 0xE9, 0x19, 0xE4, 0x9F, 0xF9, 0x59, 0xFD, 0x97, 0x19, 0x97, 0x77, 0xAF, 0xEA,
+    0x4F, 0xFE, 0x3A, 0xFF, 0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F,
+    0xFF, 0x90, 0xFE, 0xAA, 0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19,
+    0xFC, 0x99, 0xFF, 0xFC, 0x90, 0xFF, 0xC9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x69,
+    0x99, 0x77, 0x1A, 0xDA, 0x77, 0x1A, 0xD7, 0x6D, 0x90, 0x9C, 0xA0, 0xAC, 0x97, 0x1A, 0xD3, 0x9D,
+    0x73, 0xFF, 0xC7, 0x4F, 0xE7, 0x69, 0x9A, 0x97, 0x77, 0x74, 0xFD, 0x76, 0xFD, 0x97, 0x4A, 0xFD,
+    0xA7, 0x4F, 0xF7, 0x4F, 0xAE, 0x97, 0x2A, 0xEA, 0x9E, 0xA7, 0x2F, 0x90, 0xF7, 0x19, 0xF1, 0xF9,
+    0x70, 0xAE, 0xA1, 0x9F, 0x70, 0xF9, 0x2F, 0x79, 0xF3, 0xF9, 0x6A, 0xF3, 0xAF, 0x6F, 0xCA, 0xAA,
+    0xAF, 0xC5, 0x9F, 0xFF, 0xDA, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0x9F, 0x96, 0xFA, 0x2F, 0xC7,
+    0xFC, 0x2F, 0xA7, 0x9F, 0x90, 0x9F, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0x00, 0x39, 0xAA, 0xA7,
+    0x3A, 0xD9, 0x73, 0xAD, 0x70, 0xD1, 0xAA, 0x1D, 0x4E, 0x91, 0x9E, 0x49, 0xFF, 0x95, 0x9F, 0xD9,
+    0x71, 0x99, 0x77, 0x7A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97,
+    0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9,
+    0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA,
+    0x1E, 0x93, 0x99, 0x70, 0x79, 0x99, 0x77, 0x1F, 0x77, 0x2D, 0x97, 0x70, 0x9D, 0x75, 0xD1, 0xCA,
+    0x1D, 0x72, 0xE3, 0xAD, 0x72, 0x9F, 0xFA, 0x73, 0x9F, 0xDA, 0x76, 0x99, 0xA9, 0x77, 0x77, 0x4F,
+    0xD7, 0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72,
+    0xF9, 0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96,
+    0xAF, 0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF,
+    0x39, 0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7,
+    0x1F, 0xC0, 0x5A, 0xA9, 0x73, 0xEA, 0x74, 0xD7, 0x3D, 0x96, 0x9D, 0x09, 0xC9, 0x09, 0xD4, 0xDA,
+    0x29, 0xDA, 0x49, 0xFF, 0x69, 0xFD, 0x72, 0x99, 0x77, 0x7A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE,
+    0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A, 0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF,
+    0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9, 0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9,
+    0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99, 0x70, 0x69, 0xAA, 0xA2, 0x9C, 0x72, 0x9F,
+    0xCA, 0xAD, 0x72, 0xD9, 0x9F, 0xCA, 0x72, 0xA9, 0x3A, 0xA9, 0x73, 0xAA, 0x5A, 0xA7, 0x2D, 0xA3,
+    0xAD, 0x72, 0x9F, 0xF9, 0x73, 0x9F, 0xDA, 0x76, 0x99, 0x99, 0x77, 0x77, 0x3F, 0xD7, 0x6F, 0xD9,
+    0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9, 0x0F, 0x71,
+    0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF, 0x3A, 0xF6,
+    0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39, 0xF9, 0x6F,
+    0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xC0, 0x4A,
+    0xDA, 0x2D, 0x4F, 0xDA, 0xDA, 0x39, 0xD0, 0x9F, 0xC5, 0x94, 0x99, 0x59, 0xCA, 0x49, 0xCA, 0x4D,
+    0xA2, 0x9D, 0x94, 0xAF, 0xF6, 0xAF, 0xD7, 0x29, 0x97, 0x76, 0xAF, 0xEA, 0x4F, 0xFE, 0x3A, 0xFF,
+    0xE3, 0xCA, 0x92, 0xAF, 0x72, 0xF9, 0x71, 0xF9, 0x39, 0xAF, 0xF9, 0x1F, 0xFF, 0x90, 0xFE, 0xAA,
+    0xF9, 0xAF, 0x93, 0xF9, 0xFC, 0x4F, 0x9F, 0xA3, 0x9F, 0x9A, 0xF9, 0x19, 0xFC, 0x99, 0xFF, 0xFC,
+    0x90, 0xFF, 0xA9, 0xE9, 0x1A, 0xFC, 0xA1, 0xE9, 0x39, 0x97, 0x00, 0x49, 0x96, 0x99, 0x71, 0xDA,
+    0x4E, 0x71, 0xAF, 0xAF, 0xA7, 0x2F, 0xFC, 0x74, 0xAF, 0xCA, 0x77, 0x99, 0x77, 0x77, 0x5F, 0xD7,
+    0x6F, 0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFA, 0xE9, 0x72, 0xAE, 0xA9, 0xEA, 0x72, 0xF9,
+    0x0F, 0x71, 0x9F, 0x1F, 0x97, 0x0A, 0xEA, 0x19, 0xF7, 0x0F, 0x92, 0xF7, 0x9F, 0x3F, 0x96, 0xAF,
+    0x3A, 0xF6, 0xFC, 0xAA, 0xAA, 0xFC, 0x59, 0xFF, 0xFD, 0xA4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x39,
+    0xF9, 0x6F, 0xA2, 0xFC, 0x7F, 0xC2, 0xFA, 0x79, 0xF9, 0x09, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F,
+    0xC7, 0x77, 0x77, 0x72, 0xAE, 0x77, 0x0F, 0x97, 0x7F, 0x97, 0x7A, 0xE7, 0x77, 0x50, 0x29, 0x95,
+    0x99, 0x92, 0x9D, 0x93, 0x9D, 0xA3, 0xFA, 0xAF, 0x49, 0xFF, 0xA5, 0x9F, 0xD9, 0x71, 0x99, 0x77,
+    0x7A, 0xFE, 0xA4, 0xFF, 0xE3, 0xAF, 0xFE, 0x3C, 0xA9, 0x2A, 0xF7, 0x2F, 0x97, 0x1F, 0x93, 0x9A,
+    0xFF, 0x91, 0xFF, 0xF9, 0x0F, 0xEA, 0xAF, 0x9A, 0xF9, 0x3F, 0x9F, 0xC4, 0xF9, 0xFA, 0x39, 0xF9,
+    0xAF, 0x91, 0x9F, 0xC9, 0x9F, 0xFF, 0xC9, 0x0F, 0xFC, 0x9E, 0x91, 0xAF, 0xCA, 0x1E, 0x93, 0x99,
+    0x77, 0x74, 0x9E, 0x97, 0x1F, 0xC7, 0x1F, 0xC7, 0x19, 0xE9, 0x77, 0x30, 0x9F, 0xFE, 0xA9, 0xFF,
+    0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA,
+    0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA7, 0x77, 0x5A, 0xE7,
+    0x9F, 0x96, 0x9F, 0x97, 0xAE, 0x77, 0x10, 0x77, 0x3A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF,
+    0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF,
+    0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF,
+    0xF9, 0x71, 0x99, 0x77, 0x73, 0x9E, 0x73, 0xFA, 0x72, 0xFA, 0x72, 0xAE, 0x77, 0x50, 0x77, 0xFC,
+    0x96, 0xFD, 0x95, 0x90, 0x9E, 0xA7, 0x0E, 0xA6, 0x9F, 0x7A, 0xDA, 0x70, 0x9A, 0xA7, 0x72, 0x9F,
+    0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7,
+    0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA0,
+    0x77, 0x4A, 0xFA, 0x71, 0xAF, 0xC9, 0x70, 0x90, 0x9E, 0xA7, 0x3A, 0xDA, 0x72, 0xAE, 0x72, 0x9D,
+    0xA7, 0x4A, 0xA7, 0x77, 0x2A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9,
+    0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29,
+    0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x50,
+    0x76, 0x9E, 0xA2, 0xAC, 0xA0, 0x9F, 0xDA, 0xAD, 0x90, 0xFF, 0xE1, 0xD9, 0x1A, 0xF2, 0x99, 0x49,
+    0x97, 0x79, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7,
+    0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79,
+    0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9,
+    0xFF, 0xEA, 0x77, 0x3E, 0xA2, 0xAC, 0xA4, 0xFD, 0xAA, 0xDA, 0x3A, 0xFF, 0xD4, 0xD9, 0x19, 0xF9,
+    0x49, 0x94, 0x99, 0x77, 0x70, 0xAF, 0xD9, 0x6F, 0xFD, 0x4F, 0xFF, 0x2A, 0xF9, 0x19, 0xF9, 0x1F,
+    0x93, 0x9F, 0x09, 0xF5, 0xF0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xD0, 0xAF, 0x72,
+    0x9F, 0x73, 0xFA, 0x72, 0xAF, 0xA4, 0xAC, 0x3F, 0xFF, 0x4F, 0xFE, 0x5A, 0xFF, 0x97, 0x19, 0x95,
+    0x73, 0xAA, 0xA7, 0x3E, 0xA3, 0xAF, 0x90, 0x9D, 0xA3, 0x9F, 0xD0, 0xAA, 0x93, 0x9E, 0x9F, 0x6E,
+    0x2A, 0xDA, 0x49, 0xA9, 0x49, 0xAA, 0x77, 0x49, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x29, 0xFF, 0xEA,
+    0x29, 0xFF, 0xE9, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xFA, 0xAA, 0xAA, 0xAA,
+    0x39, 0xFF, 0xE3, 0x9F, 0xFE, 0x39, 0xFF, 0xE3, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x72,
+    0x9F, 0x72, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x29, 0xFF, 0xEA, 0x29, 0xFF, 0xEA, 0x29, 0xFF, 0xEA,
+    0x20, 0x75, 0xAA, 0xA7, 0x5A, 0xDA, 0x5A, 0xFA, 0x09, 0xDA, 0x59, 0xFD, 0x9A, 0xA9, 0x6E, 0x99,
+    0xE7, 0x0E, 0x29, 0xE7, 0x99, 0x59, 0x97, 0x77, 0x2A, 0xFD, 0x97, 0x0F, 0xFD, 0x6F, 0xFF, 0x4A,
+    0xF9, 0x19, 0xF9, 0x3F, 0x93, 0x9F, 0x29, 0xF5, 0xF2, 0xAF, 0xFF, 0xD2, 0xAF, 0xFF, 0xD2, 0xAF,
+    0xFF, 0xD2, 0xAF, 0x74, 0x9F, 0x75, 0xFA, 0x74, 0xAF, 0xA4, 0xAC, 0x5F, 0xFF, 0x6F, 0xFE, 0x7A,
+    0xFF, 0x97, 0x39, 0x97, 0x9A, 0xA9, 0x74, 0x9E, 0x75, 0x9D, 0xA1, 0xFC, 0x7A, 0xA9, 0xAF, 0xD7,
+    0x09, 0xE9, 0xEA, 0x69, 0xE2, 0xAD, 0x95, 0x9A, 0x94, 0x9A, 0x97, 0x76, 0x9F, 0xFE, 0xA3, 0x9F,
+    0xFE, 0xA3, 0x9F, 0xFE, 0xA3, 0x9F, 0xFE, 0x93, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73, 0x9F, 0x73,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFE, 0x49, 0xFF, 0xE4, 0x9F, 0xFE, 0x49, 0xF7, 0x39, 0xF7,
+    0x39, 0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x93, 0x9F, 0xFE, 0xA3, 0x9F,
+    0xFE, 0xA3, 0x9F, 0xFE, 0xA0, 0x9A, 0xAA, 0x76, 0xAD, 0xA7, 0x6A, 0xD9, 0x0A, 0xFA, 0x79, 0xA9,
+    0x9F, 0xD9, 0x71, 0xE9, 0x9E, 0x70, 0xE2, 0x9E, 0x79, 0x95, 0x99, 0x77, 0x72, 0xAF, 0xD9, 0x70,
+    0xFF, 0xD6, 0xFF, 0xF4, 0xAF, 0x91, 0x9F, 0x93, 0xF9, 0x39, 0xF2, 0x9F, 0x5F, 0x2A, 0xFF, 0xFD,
+    0x2A, 0xFF, 0xFD, 0x2A, 0xFF, 0xFD, 0x2A, 0xF7, 0x49, 0xF7, 0x5F, 0xA7, 0x4A, 0xFA, 0x4A, 0xC5,
+    0xFF, 0xF6, 0xFF, 0xE7, 0xAF, 0xF9, 0x73, 0x99, 0x50, 0x77, 0x69, 0xE9, 0x71, 0xAE, 0x72, 0x9D,
+    0x2A, 0xF9, 0x0E, 0x91, 0x9F, 0xD0, 0xAC, 0x29, 0xE9, 0xF4, 0xE2, 0xAD, 0xA2, 0x9A, 0x94, 0x9A,
+    0xA7, 0x70, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0x90, 0x9F, 0x70,
+    0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0xAA, 0xAA, 0xAA, 0xA1, 0x9F, 0xFE, 0x19, 0xFF, 0xE1,
+    0x9F, 0xFE, 0x19, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xF7, 0x09, 0xFA, 0xAA, 0xAA,
+    0xAA, 0x90, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0xA0, 0x9F, 0xFE, 0xA0, 0x73, 0x99, 0x76, 0xEA, 0x74,
+    0x9A, 0xD7, 0x59, 0xD5, 0xAF, 0xA0, 0xAD, 0x59, 0xFD, 0x99, 0xA6, 0xE9, 0x9E, 0x7E, 0x29, 0xE6,
+    0x99, 0x59, 0x97, 0x77, 0x0A, 0xFD, 0x97, 0xFF, 0xD5, 0xFF, 0xF3, 0xAF, 0x91, 0x9F, 0x92, 0xF9,
+    0x39, 0xF1, 0x9F, 0x5F, 0x1A, 0xFF, 0xFD, 0x1A, 0xFF, 0xFD, 0x1A, 0xFF, 0xFD, 0x1A, 0xF7, 0x39,
+    0xF7, 0x4F, 0xA7, 0x3A, 0xFA, 0x4A, 0xC4, 0xFF, 0xF5, 0xFF, 0xE6, 0xAF, 0xF9, 0x72, 0x99, 0x60,
+    0x2A, 0xAA, 0x92, 0xAA, 0x2A, 0xFC, 0xAA, 0xCA, 0x2D, 0x9A, 0xFC, 0x29, 0xA3, 0x9A, 0xA6, 0x9A,
+    0xAA, 0x97, 0xFC, 0xA5, 0xEA, 0xE9, 0x3E, 0x91, 0xAD, 0x91, 0x9A, 0x94, 0x9A, 0xA7, 0x59, 0xFF,
+    0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xFA,
+    0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xE0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0, 0x9F, 0x79, 0xF7, 0x9F, 0x79,
+    0xF7, 0x9F, 0x79, 0xFA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x4A,
+    0xDA, 0x2D, 0x5A, 0xFF, 0xC5, 0xD0, 0x9A, 0xF6, 0x94, 0x99, 0x71, 0x9E, 0xA7, 0x2F, 0xD7, 0x0E,
+    0x9A, 0xDA, 0x6E, 0x29, 0xDA, 0x59, 0x95, 0x99, 0x77, 0x5A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2,
+    0xAF, 0x91, 0x9F, 0x91, 0xF9, 0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A,
+    0xFF, 0xFD, 0x0A, 0xF7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5,
+    0x9F, 0xF9, 0x71, 0x99, 0x50, 0x39, 0x99, 0x99, 0x69, 0xFC, 0x95, 0xFE, 0x4F, 0x0F, 0x2E, 0xA2,
+    0xAE, 0x19, 0x99, 0x49, 0x99, 0x75, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xE9,
+    0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFE, 0x09, 0xFF, 0xE0,
+    0x9F, 0xFE, 0x09, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0x79, 0xF7, 0x9F, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F,
+    0xFE, 0xA9, 0xFF, 0xEA, 0x9F, 0xFE, 0xA7, 0x77, 0x5A, 0xE7, 0x9F, 0x96, 0x9F, 0x97, 0xAE, 0x77,
+    0x10, 0x59, 0x99, 0x97, 0x2F, 0xCA, 0x70, 0xFE, 0x96, 0xAE, 0x9A, 0xE9, 0x4A, 0xE2, 0x9E, 0x93,
+    0x99, 0x95, 0x99, 0x77, 0x6A, 0xFD, 0x96, 0xFF, 0xD4, 0xFF, 0xF2, 0xAF, 0x91, 0x9F, 0x91, 0xF9,
+    0x39, 0xF0, 0x9F, 0x5F, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x0A, 0xF7, 0x29,
+    0xF7, 0x3F, 0xA7, 0x2A, 0xFA, 0x4A, 0xC3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF, 0xF9, 0x71, 0x99, 0x77,
+    0x73, 0x9E, 0x73, 0xFA, 0x72, 0xFA, 0x72, 0xAE, 0x77, 0x50, 0x74, 0xAF, 0x94, 0xFD, 0x4A, 0x9A,
+    0xEA, 0x6E, 0xA5, 0xAE, 0x5A, 0xE6, 0x9D, 0x77, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91,
+    0x9F, 0xCA, 0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5,
+    0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x79,
+    0xFC, 0x19, 0xFD, 0x19, 0x0A, 0xE3, 0x9E, 0x2A, 0xEA, 0x2E, 0x93, 0xAA, 0x97, 0x3F, 0xA2, 0xFA,
+    0x2F, 0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x2F,
+    0xA2, 0xFA, 0x2F, 0xA2, 0xFA, 0x10, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x0F, 0xFC, 0x91, 0x9F, 0xCA,
+    0x4A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A, 0xF5, 0xAF, 0x5A,
+    0xF5, 0xAF, 0x5A, 0xF5, 0xFC, 0x92, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0xFF, 0xC9, 0x77, 0x70, 0xEA,
+    0x59, 0xF5, 0x9F, 0x6E, 0xA7, 0x60, 0x6A, 0xE9, 0x0F, 0xA0, 0xFA, 0x09, 0xE7, 0x5F, 0xA0, 0xFA,
+    0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x0F,
+    0xA0, 0xFA, 0x0F, 0xA0, 0xFA, 0x74, 0x9E, 0x90, 0xFA, 0x0F, 0xA0, 0x9E, 0x95, 0x77, 0x72, 0xAF,
+    0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F,
+    0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9,
+    0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9,
+    0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A,
+    0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99,
+    0x77, 0x77, 0x59, 0xE9, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0x9E, 0x97, 0x77, 0x40, 0x77, 0x3A, 0xFD,
+    0xA6, 0xFF, 0xD9, 0x3F, 0xFF, 0x2A, 0xFA, 0x19, 0xFC, 0x1F, 0xA3, 0x9F, 0x99, 0xF5, 0xFA, 0xAF,
+    0x5F, 0xAA, 0xF5, 0xAF, 0xAF, 0x5A, 0xFA, 0xF5, 0xFA, 0x9F, 0x5F, 0xA0, 0xFA, 0x39, 0xF9, 0x0A,
+    0xFA, 0x19, 0xFC, 0x2F, 0xFF, 0x93, 0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x29, 0x97, 0x77, 0x4A, 0xDA,
+    0x72, 0x9F, 0x97, 0x19, 0xF9, 0x72, 0xF7, 0x75, 0x77, 0x74, 0xFA, 0x76, 0x9F, 0xD7, 0x69, 0x9A,
+    0xE7, 0x71, 0xE7, 0x79, 0xF7, 0x7E, 0xA7, 0x70, 0xAC, 0xA7, 0x77, 0x73, 0xAF, 0xEA, 0x71, 0xAF,
+    0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6,
+    0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09,
+    0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A,
+    0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF,
+    0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70, 0x77, 0x4A,
+    0xFA, 0x71, 0xAF, 0xC9, 0x70, 0x90, 0x9E, 0xA7, 0x3A, 0xDA, 0x72, 0xAE, 0x72, 0x9D, 0xA7, 0x4A,
+    0xA7, 0x77, 0x2A, 0xFD, 0xA6, 0xFF, 0xD9, 0x3F, 0xFF, 0x2A, 0xFA, 0x19, 0xFC, 0x1F, 0xA3, 0x9F,
+    0x99, 0xF5, 0xFA, 0xAF, 0x5F, 0xAA, 0xF5, 0xAF, 0xAF, 0x5A, 0xFA, 0xF5, 0xFA, 0x9F, 0x5F, 0xA0,
+    0xFA, 0x39, 0xF9, 0x0A, 0xFA, 0x19, 0xFC, 0x2F, 0xFF, 0x93, 0xFF, 0xD9, 0x5A, 0xFD, 0xA7, 0x29,
+    0x96, 0x77, 0x9A, 0xA9, 0x77, 0x0E, 0x97, 0x0F, 0xC1, 0xE9, 0x70, 0xFD, 0xA9, 0xAA, 0x71, 0xAE,
+    0x9E, 0x97, 0x29, 0xDA, 0x2E, 0x72, 0x9A, 0x94, 0x9A, 0x97, 0x77, 0x7A, 0xFE, 0xA7, 0x1A, 0xFF,
+    0xEA, 0x6A, 0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xC9, 0x49, 0xFC, 0x2A, 0xFA, 0x69,
+    0xFA, 0x1F, 0xC7, 0x0F, 0xC1, 0xFA, 0x70, 0xAF, 0x09, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F,
+    0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x90, 0xFA, 0x70, 0xAF,
+    0x1F, 0xC7, 0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94, 0x9F, 0xC3, 0xAF, 0xDA, 0x9A, 0xFD,
+    0xA4, 0xFF, 0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9, 0x75, 0x99, 0x97, 0x00, 0x75, 0xAA,
+    0xA9, 0x74, 0xAD, 0xA5, 0xAF, 0xA0, 0x9D, 0xA5, 0x9F, 0xD9, 0xAA, 0x96, 0xE9, 0x9E, 0x70, 0xE3,
+    0xE7, 0x99, 0x59, 0x97, 0x77, 0x2A, 0xFD, 0xA7, 0x0F, 0xFD, 0x95, 0xFF, 0xF4, 0xAF, 0xA1, 0x9F,
+    0xC3, 0xFA, 0x39, 0xF9, 0x19, 0xF5, 0xFA, 0x1A, 0xF5, 0xFA, 0x1A, 0xF5, 0xAF, 0x1A, 0xF5, 0xAF,
+    0x1A, 0xF5, 0xFA, 0x19, 0xF5, 0xFA, 0x2F, 0xA3, 0x9F, 0x92, 0xAF, 0xA1, 0x9F, 0xC4, 0xFF, 0xF9,
+    0x5F, 0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x09, 0xAA, 0x97, 0x70, 0x9E, 0x77, 0x19, 0xDA,
+    0x1F, 0xC7, 0x3A, 0xA0, 0xFD, 0xA7, 0x4A, 0xE9, 0xEA, 0x72, 0x9E, 0x2E, 0x97, 0x19, 0xA9, 0x49,
+    0xA9, 0x77, 0x77, 0xAF, 0xEA, 0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD,
+    0xA3, 0xFC, 0x94, 0x9F, 0xC2, 0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0,
+    0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9,
+    0x9F, 0x97, 0x09, 0xF9, 0x0F, 0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F,
+    0xC9, 0x49, 0xFC, 0x3A, 0xFD, 0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF,
+    0xEA, 0x97, 0x59, 0x99, 0x70, 0x0A, 0xAA, 0x76, 0xAD, 0xA7, 0x6A, 0xD9, 0x0A, 0xFA, 0x79, 0xAA,
+    0x9F, 0xD9, 0x71, 0xE9, 0x9E, 0x70, 0xE9, 0x2E, 0x79, 0x95, 0x99, 0x77, 0x72, 0xAF, 0xDA, 0x70,
+    0xFF, 0xD9, 0x5F, 0xFF, 0x4A, 0xFA, 0x19, 0xFC, 0x3F, 0xA3, 0x9F, 0x91, 0x9F, 0x5F, 0xA1, 0xAF,
+    0x5F, 0xA1, 0xAF, 0x5A, 0xF1, 0xAF, 0x5A, 0xF1, 0xAF, 0x5F, 0xA1, 0x9F, 0x5F, 0xA2, 0xFA, 0x39,
+    0xF9, 0x2A, 0xFA, 0x19, 0xFC, 0x4F, 0xFF, 0x95, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x96, 0x77,
+    0x77, 0x2A, 0xE7, 0x70, 0x9A, 0xDA, 0x77, 0x1A, 0xCA, 0x71, 0xFC, 0x1D, 0xA7, 0x1F, 0xDA, 0x0C,
+    0xA7, 0x1A, 0xE9, 0xE9, 0x72, 0x9D, 0xA2, 0xE7, 0x29, 0xA9, 0x49, 0xA9, 0x77, 0x77, 0xAF, 0xEA,
+    0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2,
+    0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F,
+    0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F,
+    0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD,
+    0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70,
+    0x73, 0x99, 0x97, 0x5F, 0x74, 0x99, 0xD7, 0x59, 0xD5, 0xAF, 0xA0, 0xAD, 0x94, 0x9F, 0xD9, 0x9A,
+    0x6E, 0x99, 0xE7, 0xE3, 0xE6, 0x99, 0x59, 0x97, 0x77, 0x0A, 0xFD, 0xA7, 0xFF, 0xD9, 0x4F, 0xFF,
+    0x3A, 0xFA, 0x19, 0xFC, 0x2F, 0xA3, 0x9F, 0x90, 0x9F, 0x5F, 0xA0, 0xAF, 0x5F, 0xA0, 0xAF, 0x5A,
+    0xF0, 0xAF, 0x5A, 0xF0, 0xAF, 0x5F, 0xA0, 0x9F, 0x5F, 0xA1, 0xFA, 0x39, 0xF9, 0x1A, 0xFA, 0x19,
+    0xFC, 0x3F, 0xFF, 0x94, 0xFF, 0xD9, 0x6A, 0xFD, 0xA7, 0x39, 0x97, 0x7A, 0xAA, 0x3C, 0x97, 0x2F,
+    0xDA, 0xD9, 0x71, 0xAC, 0xA9, 0xAF, 0xC7, 0x29, 0xA3, 0x9A, 0x97, 0x69, 0xAA, 0xA9, 0x76, 0x9F,
+    0xC7, 0x59, 0xEA, 0xE7, 0x39, 0xDA, 0x19, 0xE7, 0x29, 0xA9, 0x49, 0xA9, 0x77, 0x76, 0xAF, 0xEA,
+    0x71, 0xAF, 0xFE, 0xA6, 0xAF, 0xFF, 0xD4, 0xAF, 0xDA, 0xAA, 0xFD, 0xA3, 0xFC, 0x94, 0x9F, 0xC2,
+    0xAF, 0xA6, 0x9F, 0xA1, 0xFC, 0x70, 0xFC, 0x1F, 0xA7, 0x0A, 0xF0, 0x9F, 0x97, 0x09, 0xF9, 0x9F,
+    0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x9F, 0x97, 0x09, 0xF9, 0x0F,
+    0xA7, 0x0A, 0xF1, 0xFC, 0x70, 0xFC, 0x1A, 0xF9, 0x69, 0xFA, 0x2F, 0xC9, 0x49, 0xFC, 0x3A, 0xFD,
+    0xA9, 0xAF, 0xDA, 0x4F, 0xFF, 0xE6, 0xAF, 0xFE, 0xA7, 0x09, 0xAF, 0xEA, 0x97, 0x59, 0x99, 0x70,
+    0x4A, 0xDA, 0x2A, 0xC5, 0xAF, 0xDA, 0xD5, 0xD9, 0x9A, 0xF9, 0x59, 0x93, 0x99, 0x72, 0xF7, 0x2F,
+    0xD7, 0x0E, 0xAA, 0xE6, 0xE9, 0x19, 0xE5, 0x99, 0x59, 0x97, 0x75, 0xAF, 0xDA, 0x6F, 0xFD, 0x93,
+    0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F, 0x5F, 0xAA, 0xF5, 0xFA, 0xAF, 0x5A,
+    0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3, 0x9F, 0x90, 0xAF, 0xA1, 0x9F, 0xC2,
+    0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99, 0x60, 0x79, 0x99, 0x99, 0x77, 0xFC, 0x97,
+    0x5F, 0xE7, 0x4F, 0x0F, 0x72, 0xEA, 0x2A, 0xE7, 0x19, 0x99, 0x59, 0x97, 0x77, 0x7A, 0xFE, 0xA7,
+    0x1A, 0xFF, 0xEA, 0x6A, 0xFF, 0xFD, 0x4A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xC9, 0x49, 0xFC, 0x2A,
+    0xFA, 0x69, 0xFA, 0x1F, 0xC7, 0x0F, 0xC1, 0xFA, 0x70, 0xAF, 0x09, 0xF9, 0x70, 0x9F, 0x99, 0xF9,
+    0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x99, 0xF9, 0x70, 0x9F, 0x90, 0xFA,
+    0x70, 0xAF, 0x1F, 0xC7, 0x0F, 0xC1, 0xAF, 0x96, 0x9F, 0xA2, 0xFC, 0x94, 0x9F, 0xC3, 0xAF, 0xDA,
+    0x9A, 0xFD, 0xA4, 0xFF, 0xFE, 0x6A, 0xFF, 0xEA, 0x70, 0x9A, 0xFE, 0xA9, 0x75, 0x99, 0x97, 0x77,
+    0x75, 0x9E, 0x97, 0x7F, 0xC7, 0x7F, 0xC7, 0x79, 0xE9, 0x77, 0x74, 0x59, 0x99, 0x97, 0x2A, 0xFC,
+    0x70, 0x9F, 0xDA, 0x69, 0xEA, 0x9E, 0xA4, 0x9E, 0x92, 0xEA, 0x49, 0x95, 0x99, 0x97, 0x75, 0xAF,
+    0xDA, 0x6F, 0xFD, 0x93, 0xFF, 0xF2, 0xAF, 0xA1, 0x9F, 0xC1, 0xFA, 0x39, 0xF9, 0x9F, 0x5F, 0xAA,
+    0xF5, 0xFA, 0xAF, 0x5A, 0xFA, 0xF5, 0xAF, 0xAF, 0x5F, 0xA9, 0xF5, 0xFA, 0x0F, 0xA3, 0x9F, 0x90,
+    0xAF, 0xA1, 0x9F, 0xC2, 0xFF, 0xF9, 0x3F, 0xFD, 0x95, 0xAF, 0xDA, 0x72, 0x99, 0x77, 0x74, 0xAD,
+    0xA7, 0x29, 0xF9, 0x71, 0x9F, 0x97, 0x2F, 0x77, 0x50, 0x73, 0x99, 0x99, 0x77, 0x2F, 0xC7, 0x71,
+    0xFA, 0x77, 0x1A, 0xE9, 0x77, 0x19, 0xE9, 0x77, 0x29, 0x99, 0x77, 0x77, 0xAF, 0x5A, 0xFE, 0xA3,
+    0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A, 0xFF, 0xFD, 0xAE, 0xA2, 0xAF, 0xDA, 0xAA, 0xFF, 0xD3, 0xFC,
+    0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F, 0xA4, 0xFC, 0x70, 0xFC, 0x4F, 0xA7, 0x0A, 0xF3, 0x9F, 0x97,
+    0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F, 0x97, 0x1F, 0x92, 0x9F, 0x97, 0x09, 0xF9, 0x29,
+    0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70, 0xAF, 0x4F, 0xC7, 0x0F, 0xC4, 0xAF, 0x96, 0x9F, 0xA5, 0xFC,
+    0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A, 0xFD, 0xA7, 0xFF, 0xFE, 0x71, 0xAF, 0xFE, 0xA7, 0x39, 0xAF,
+    0xEA, 0x97, 0x70, 0x99, 0x97, 0x30, 0x70, 0x99, 0x99, 0x97, 0x5A, 0xF9, 0x74, 0x9F, 0x97, 0x5F,
+    0x76, 0xEA, 0x59, 0x99, 0x69, 0x99, 0x5F, 0xA7, 0x6F, 0x93, 0x9F, 0xDA, 0x2F, 0x3F, 0xFD, 0x9F,
+    0xA2, 0xFF, 0xFF, 0x2A, 0xFA, 0x99, 0xAF, 0xDA, 0x3F, 0xA3, 0x9F, 0x93, 0x9F, 0x5F, 0xA3, 0xAF,
+    0x5F, 0xA3, 0xAF, 0x5A, 0xF3, 0xAF, 0x5A, 0xF3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA4, 0xFA, 0x39,
+    0xF9, 0x4A, 0xFA, 0x99, 0xAF, 0xC6, 0xFF, 0xF9, 0x7F, 0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x69, 0x97,
+    0x20, 0x59, 0x99, 0x97, 0x73, 0xFC, 0x77, 0x3F, 0xA7, 0x73, 0xAE, 0x97, 0x73, 0x9E, 0x97, 0x74,
+    0x99, 0x77, 0x75, 0xAF, 0x5A, 0xFE, 0xA3, 0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A, 0xFF, 0xFD, 0xAE,
+    0xA2, 0xAF, 0xDA, 0xAA, 0xFF, 0xD3, 0xFC, 0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F, 0xA4, 0xFC, 0x70,
+    0xFC, 0x4F, 0xA7, 0x0A, 0xF3, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F, 0x97,
+    0x1F, 0x92, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70, 0xAF, 0x4F, 0xC7,
+    0x0F, 0xC4, 0xAF, 0x96, 0x9F, 0xA5, 0xFC, 0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A, 0xFD, 0xA7, 0xFF,
+    0xFE, 0x71, 0xAF, 0xFE, 0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x70, 0x99, 0x97, 0x30, 0x29, 0x99, 0x99,
+    0x76, 0xAF, 0x97, 0x69, 0xF7, 0x70, 0xF7, 0x70, 0xF4, 0x99, 0x97, 0x09, 0x99, 0x3F, 0xA7, 0x6F,
+    0x93, 0x9F, 0xDA, 0x2F, 0x3F, 0xFD, 0x9F, 0xA2, 0xFF, 0xFF, 0x2A, 0xFA, 0x99, 0xAF, 0xDA, 0x3F,
+    0xA3, 0x9F, 0x93, 0x9F, 0x5F, 0xA3, 0xAF, 0x5F, 0xA3, 0xAF, 0x5A, 0xF3, 0xAF, 0x5A, 0xF3, 0xAF,
+    0x5F, 0xA3, 0x9F, 0x5F, 0xA4, 0xFA, 0x39, 0xF9, 0x4A, 0xFA, 0x99, 0xAF, 0xC6, 0xFF, 0xF9, 0x7F,
+    0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x77, 0x76, 0xAF, 0xA7, 0x71, 0xAF, 0xCA, 0x77,
+    0x19, 0x0F, 0x77, 0x3A, 0xE7, 0x72, 0xAE, 0x97, 0x72, 0xE9, 0x77, 0x3A, 0xA9, 0x77, 0x76, 0xAF,
+    0x5A, 0xFE, 0xA3, 0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A, 0xFF, 0xFD, 0xAE, 0xA2, 0xAF, 0xDA, 0xAA,
+    0xFF, 0xD3, 0xFC, 0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F, 0xA4, 0xFC, 0x70, 0xFC, 0x4F, 0xA7, 0x0A,
+    0xF3, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F, 0x97, 0x1F, 0x92, 0x9F, 0x97,
+    0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70, 0xAF, 0x4F, 0xC7, 0x0F, 0xC4, 0xAF, 0x96,
+    0x9F, 0xA5, 0xFC, 0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A, 0xFD, 0xA7, 0xFF, 0xFE, 0x71, 0xAF, 0xFE,
+    0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x70, 0x99, 0x97, 0x30, 0x77, 0x70, 0xFC, 0x97, 0x5F, 0xD7, 0x59,
+    0x09, 0xE9, 0x77, 0xE9, 0x75, 0x9F, 0x76, 0xAD, 0xA5, 0x99, 0x96, 0x9A, 0xA5, 0xFA, 0x76, 0xF9,
+    0x39, 0xFD, 0xA2, 0xF3, 0xFF, 0xD9, 0xFA, 0x2F, 0xFF, 0xF2, 0xAF, 0xA9, 0x9A, 0xFD, 0xA3, 0xFA,
+    0x39, 0xF9, 0x39, 0xF5, 0xFA, 0x3A, 0xF5, 0xFA, 0x3A, 0xF5, 0xAF, 0x3A, 0xF5, 0xAF, 0x3A, 0xF5,
+    0xFA, 0x39, 0xF5, 0xFA, 0x4F, 0xA3, 0x9F, 0x94, 0xAF, 0xA9, 0x9A, 0xFC, 0x6F, 0xFF, 0x97, 0xFF,
+    0xD9, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x77, 0x75, 0x9E, 0xA2, 0xAC, 0xA7, 0x39, 0xFD, 0xAA,
+    0xD9, 0x73, 0xFF, 0xE7, 0x4D, 0x91, 0xAF, 0x75, 0x99, 0x49, 0x77, 0x75, 0xAF, 0x5A, 0xFE, 0xA3,
+    0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A, 0xFF, 0xFD, 0xAE, 0xA2, 0xAF, 0xDA, 0xAA, 0xFF, 0xD3, 0xFC,
+    0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F, 0xA4, 0xFC, 0x70, 0xFC, 0x4F, 0xA7, 0x0A, 0xF3, 0x9F, 0x97,
+    0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x92, 0x9F, 0x97, 0x1F, 0x92, 0x9F, 0x97, 0x09, 0xF9, 0x29,
+    0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70, 0xAF, 0x4F, 0xC7, 0x0F, 0xC4, 0xAF, 0x96, 0x9F, 0xA5, 0xFC,
+    0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A, 0xFD, 0xA7, 0xFF, 0xFE, 0x71, 0xAF, 0xFE, 0xA7, 0x39, 0xAF,
+    0xEA, 0x97, 0x70, 0x99, 0x97, 0x30, 0x77, 0x7A, 0xE9, 0x2D, 0x70, 0xAF, 0xDA, 0xE7, 0x0F, 0xFD,
+    0x97, 0xAD, 0x19, 0xFA, 0x29, 0x99, 0x39, 0x59, 0x3F, 0xA7, 0x6F, 0x93, 0x9F, 0xDA, 0x2F, 0x3F,
+    0xFD, 0x9F, 0xA2, 0xFF, 0xFF, 0x2A, 0xFA, 0x99, 0xAF, 0xDA, 0x3F, 0xA3, 0x9F, 0x93, 0x9F, 0x5F,
+    0xA3, 0xAF, 0x5F, 0xA3, 0xAF, 0x5A, 0xF3, 0xAF, 0x5A, 0xF3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA4,
+    0xFA, 0x39, 0xF9, 0x4A, 0xFA, 0x99, 0xAF, 0xC6, 0xFF, 0xF9, 0x7F, 0xFD, 0x97, 0x1A, 0xFD, 0xA7,
+    0x69, 0x97, 0x20, 0x77, 0x77, 0x72, 0xAF, 0x5A, 0xFE, 0xA3, 0xFA, 0x3A, 0xFF, 0xEA, 0x1F, 0x3A,
+    0xFF, 0xFD, 0xAE, 0xA2, 0xAF, 0xDA, 0xAA, 0xFF, 0xD3, 0xFC, 0x94, 0x9F, 0xE3, 0xAF, 0xA6, 0x9F,
+    0xA4, 0xFC, 0x70, 0xFC, 0x4F, 0xA7, 0x0A, 0xF3, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F,
+    0x92, 0x9F, 0x97, 0x1F, 0x92, 0x9F, 0x97, 0x09, 0xF9, 0x29, 0xF9, 0x70, 0x9F, 0x93, 0xFA, 0x70,
+    0xAF, 0x4F, 0xC7, 0x0F, 0xC4, 0xAF, 0x96, 0x9F, 0xA5, 0xFC, 0x94, 0x9F, 0xC6, 0xAF, 0xDA, 0x9A,
+    0xFD, 0xA7, 0xFF, 0xFE, 0x71, 0xAF, 0xFE, 0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x70, 0x99, 0x97, 0x77,
+    0x77, 0x39, 0xE9, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x77, 0x29, 0xE9, 0x77, 0x77, 0x20, 0x77, 0x99,
+    0x97, 0x7F, 0xA7, 0x6F, 0x93, 0x9F, 0xDA, 0x2F, 0x3F, 0xFD, 0x9F, 0xA2, 0xFF, 0xFF, 0x2A, 0xFA,
+    0x99, 0xAF, 0xDA, 0x3F, 0xA3, 0x9F, 0x93, 0x9F, 0x5F, 0xA3, 0xAF, 0x5F, 0xA3, 0xAF, 0x5A, 0xF3,
+    0xAF, 0x5A, 0xF3, 0xAF, 0x5F, 0xA3, 0x9F, 0x5F, 0xA4, 0xFA, 0x39, 0xF9, 0x4A, 0xFA, 0x99, 0xAF,
+    0xC6, 0xFF, 0xF9, 0x7F, 0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x77, 0x74, 0xAE, 0x77, 0xF9,
+    0x76, 0xF9, 0x76, 0xAE, 0x77, 0x75, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7,
+    0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA,
+    0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9, 0x59, 0xF9,
+    0x0F, 0xC5, 0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0x97,
+    0x39, 0x97, 0x77, 0x7A, 0xE7, 0x5F, 0x97, 0x4F, 0xA7, 0x4A, 0xE7, 0x77, 0x10, 0xF9, 0x4A, 0xEA,
+    0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9,
+    0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0xA4, 0xFF, 0xD3, 0x9F, 0xCA, 0xFA, 0x99, 0xAF, 0xD9,
+    0xFF, 0xFD, 0x0A, 0xFF, 0x9F, 0x1A, 0xFD, 0x1A, 0xE4, 0x97, 0x77, 0x4A, 0xE7, 0x2F, 0x97, 0x1F,
+    0x97, 0x1A, 0xE7, 0x74, 0x77, 0x6A, 0xF9, 0x73, 0xAF, 0xC9, 0x72, 0x99, 0x9F, 0x75, 0xAE, 0x74,
+    0x9E, 0x97, 0x39, 0xE9, 0x75, 0xD9, 0x77, 0x71, 0x9E, 0xA7, 0xAE, 0x9A, 0xF7, 0xFA, 0xAF, 0x7F,
+    0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA,
+    0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0xAF, 0x7F, 0xAA, 0xF7, 0xFA, 0x9F, 0x7F, 0xA9, 0xF9,
+    0x59, 0xF9, 0x0F, 0xC5, 0xFC, 0x1A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69,
+    0xFF, 0x97, 0x39, 0x97, 0x77, 0x29, 0xFA, 0x70, 0xAF, 0xCA, 0x70, 0x90, 0xAE, 0x72, 0x9E, 0x71,
+    0xAE, 0x97, 0x1E, 0x97, 0x2A, 0xA9, 0x77, 0x4F, 0x94, 0xAE, 0xAF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF,
+    0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94, 0xAF, 0xF9, 0x4A, 0xFF, 0x94,
+    0xAF, 0xFA, 0x4F, 0xFD, 0x39, 0xFC, 0xAF, 0xA9, 0x9A, 0xFD, 0x9F, 0xFF, 0xD0, 0xAF, 0xF9, 0xF1,
+    0xAF, 0xD1, 0xAE, 0x49, 0x70, 0x71, 0x99, 0x99, 0x77, 0x3F, 0xC7, 0x72, 0xAF, 0x77, 0x29, 0xEA,
+    0x77, 0x3E, 0x97, 0x74, 0x99, 0x77, 0x77, 0x29, 0xF0, 0x9E, 0xA7, 0xAE, 0x90, 0xAF, 0x0A, 0xF7,
+    0xFA, 0x0F, 0x90, 0xAF, 0x7F, 0xAA, 0xF1, 0xAF, 0x7F, 0xFC, 0x2A, 0xF7, 0xFE, 0xA3, 0xAF, 0x7F,
+    0xC9, 0x5A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA,
+    0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x69, 0xF7, 0xFA, 0x69, 0xF9, 0x6F, 0x97,
+    0xFC, 0x5F, 0xC7, 0x0A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA7, 0x1F, 0xFF, 0xD7, 0x3F, 0xFF, 0x75, 0x9F,
+    0xF9, 0x77, 0x29, 0x97, 0x60, 0x79, 0x99, 0x99, 0x77, 0x0F, 0xA7, 0x7F, 0xA7, 0x7F, 0x97, 0x7A,
+    0xE7, 0x99, 0x99, 0x59, 0x99, 0x79, 0xF7, 0x70, 0xAE, 0xA0, 0xF9, 0x4A, 0xEA, 0x0F, 0x90, 0xF9,
+    0x4A, 0xFA, 0xF1, 0xF9, 0x4A, 0xFF, 0x2F, 0x94, 0xAF, 0xE3, 0xF9, 0x4A, 0xF9, 0x5F, 0x94, 0xAF,
+    0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0xA4, 0xFC, 0x6F,
+    0xC3, 0x9F, 0xC6, 0xAF, 0xA9, 0x9A, 0xFD, 0x69, 0xFF, 0xFD, 0x7A, 0xFF, 0x0F, 0x70, 0xAF, 0xCA,
+    0x1A, 0xE7, 0x39, 0x77, 0x39, 0x99, 0x97, 0x74, 0xFC, 0x77, 0x4A, 0xEA, 0x77, 0x4A, 0xEA, 0x77,
+    0x49, 0xE9, 0x77, 0x59, 0x99, 0x77, 0x77, 0x9F, 0x09, 0xEA, 0x7A, 0xE9, 0x0A, 0xF0, 0xAF, 0x7F,
+    0xA0, 0xF9, 0x0A, 0xF7, 0xFA, 0xAF, 0x1A, 0xF7, 0xFF, 0xC2, 0xAF, 0x7F, 0xEA, 0x3A, 0xF7, 0xFC,
+    0x95, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6,
+    0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0x9F, 0x7F, 0xA6, 0x9F, 0x96, 0xF9, 0x7F,
+    0xC5, 0xFC, 0x70, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x71, 0xFF, 0xFD, 0x73, 0xFF, 0xF7, 0x59, 0xFF,
+    0x97, 0x72, 0x99, 0x76, 0x19, 0x99, 0x99, 0x77, 0x09, 0xFA, 0x77, 0x1F, 0x97, 0x71, 0xF9, 0x77,
+    0x1A, 0xE6, 0x99, 0x99, 0x70, 0x99, 0x59, 0xF7, 0x70, 0xAE, 0xA0, 0xF9, 0x4A, 0xEA, 0x0F, 0x90,
+    0xF9, 0x4A, 0xFA, 0xF1, 0xF9, 0x4A, 0xFF, 0x2F, 0x94, 0xAF, 0xE3, 0xF9, 0x4A, 0xF9, 0x5F, 0x94,
+    0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0xA4, 0xFC,
+    0x6F, 0xC3, 0x9F, 0xC6, 0xAF, 0xA9, 0x9A, 0xFD, 0x69, 0xFF, 0xFD, 0x7A, 0xFF, 0x0F, 0x70, 0xAF,
+    0xCA, 0x1A, 0xE7, 0x39, 0x77, 0x77, 0x75, 0x9F, 0x97, 0x72, 0xAF, 0xCA, 0x77, 0x19, 0x99, 0xF7,
+    0x74, 0x9E, 0x77, 0x39, 0xEA, 0x77, 0x3E, 0x97, 0x74, 0xD9, 0x77, 0x77, 0x19, 0xF0, 0x9E, 0xA7,
+    0xAE, 0x90, 0xAF, 0x0A, 0xF7, 0xFA, 0x0F, 0x90, 0xAF, 0x7F, 0xAA, 0xF1, 0xAF, 0x7F, 0xFC, 0x2A,
+    0xF7, 0xFE, 0xA3, 0xAF, 0x7F, 0xC9, 0x5A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A,
+    0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x69, 0xF7,
+    0xFA, 0x69, 0xF9, 0x6F, 0x97, 0xFC, 0x5F, 0xC7, 0x0A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA7, 0x1F, 0xFF,
+    0xD7, 0x3F, 0xFF, 0x75, 0x9F, 0xF9, 0x77, 0x29, 0x97, 0x60, 0x77, 0x71, 0x9F, 0xC7, 0x79, 0xFD,
+    0x77, 0x90, 0xAE, 0x77, 0x19, 0xE7, 0x70, 0xAE, 0xA7, 0x70, 0xE9, 0x69, 0x99, 0x96, 0xAA, 0x96,
+    0x9F, 0x77, 0x0A, 0xEA, 0x0F, 0x94, 0xAE, 0xA0, 0xF9, 0x0F, 0x94, 0xAF, 0xAF, 0x1F, 0x94, 0xAF,
+    0xF2, 0xF9, 0x4A, 0xFE, 0x3F, 0x94, 0xAF, 0x95, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A,
+    0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xFA, 0x4F, 0xC6, 0xFC, 0x39, 0xFC, 0x6A, 0xFA, 0x99,
+    0xAF, 0xD6, 0x9F, 0xFF, 0xD7, 0xAF, 0xF0, 0xF7, 0x0A, 0xFC, 0xA1, 0xAE, 0x73, 0x97, 0x70, 0x77,
+    0x75, 0xAD, 0xA2, 0x9D, 0x75, 0xFD, 0xAA, 0xDA, 0x74, 0xAF, 0xFD, 0x75, 0xDA, 0x19, 0xF9, 0x75,
+    0x99, 0x49, 0x97, 0x77, 0x79, 0xF0, 0x9E, 0xA7, 0xAE, 0x90, 0xAF, 0x0A, 0xF7, 0xFA, 0x0F, 0x90,
+    0xAF, 0x7F, 0xAA, 0xF1, 0xAF, 0x7F, 0xFC, 0x2A, 0xF7, 0xFE, 0xA3, 0xAF, 0x7F, 0xC9, 0x5A, 0xF7,
+    0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA,
+    0x6A, 0xF7, 0xFA, 0x6A, 0xF7, 0xFA, 0x69, 0xF7, 0xFA, 0x69, 0xF9, 0x6F, 0x97, 0xFC, 0x5F, 0xC7,
+    0x0A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA7, 0x1F, 0xFF, 0xD7, 0x3F, 0xFF, 0x75, 0x9F, 0xF9, 0x77, 0x29,
+    0x97, 0x60, 0x77, 0x70, 0x9E, 0x92, 0xD9, 0x71, 0x9F, 0xDA, 0xE7, 0x2F, 0xFE, 0x72, 0xD2, 0xAF,
+    0x49, 0x99, 0x92, 0x99, 0x49, 0x59, 0xF7, 0x70, 0xAE, 0xA0, 0xF9, 0x4A, 0xEA, 0x0F, 0x90, 0xF9,
+    0x4A, 0xFA, 0xF1, 0xF9, 0x4A, 0xFF, 0x2F, 0x94, 0xAF, 0xE3, 0xF9, 0x4A, 0xF9, 0x5F, 0x94, 0xAF,
+    0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0x94, 0xAF, 0x6F, 0xA4, 0xFC, 0x6F,
+    0xC3, 0x9F, 0xC6, 0xAF, 0xA9, 0x9A, 0xFD, 0x69, 0xFF, 0xFD, 0x7A, 0xFF, 0x0F, 0x70, 0xAF, 0xCA,
+    0x1A, 0xE7, 0x39, 0x77, 0x77, 0x77, 0x73, 0x9F, 0x09, 0xEA, 0x7A, 0xE9, 0x0A, 0xF0, 0xAF, 0x7F,
+    0xA0, 0xF9, 0x0A, 0xF7, 0xFA, 0xAF, 0x1A, 0xF7, 0xFF, 0xC2, 0xAF, 0x7F, 0xEA, 0x3A, 0xF7, 0xFC,
+    0x95, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6,
+    0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0x9F, 0x7F, 0xA6, 0x9F, 0x96, 0xF9, 0x7F,
+    0xC5, 0xFC, 0x70, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x71, 0xFF, 0xFD, 0x73, 0xFF, 0xF7, 0x59, 0xFF,
+    0x97, 0x72, 0x99, 0x77, 0x77, 0x75, 0xAE, 0x77, 0x4F, 0x97, 0x73, 0xF9, 0x77, 0x3A, 0xE7, 0x77,
+    0x77, 0x77, 0x09, 0x99, 0x97, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x0F, 0x94, 0xAE, 0xA0, 0xF9, 0x0F,
+    0x94, 0xAF, 0xAF, 0x1F, 0x94, 0xAF, 0xF2, 0xF9, 0x4A, 0xFE, 0x3F, 0x94, 0xAF, 0x95, 0xF9, 0x4A,
+    0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xF9, 0x4A, 0xF6, 0xFA, 0x4F, 0xC6,
+    0xFC, 0x39, 0xFC, 0x6A, 0xFA, 0x99, 0xAF, 0xD6, 0x9F, 0xFF, 0xD7, 0xAF, 0xF0, 0xF7, 0x0A, 0xFC,
+    0xA1, 0xAE, 0x73, 0x97, 0x77, 0x77, 0x2A, 0xE7, 0x71, 0xF9, 0x77, 0x0F, 0x97, 0x70, 0xAE, 0x77,
+    0x77, 0x20, 0x49, 0x99, 0x97, 0x6A, 0xF7, 0x6A, 0xF7, 0x69, 0xEA, 0x77, 0xEA, 0x77, 0x99, 0x97,
+    0x77, 0x0A, 0xF7, 0xAF, 0x09, 0xFA, 0x6F, 0xA1, 0xFC, 0x5A, 0xF3, 0xF9, 0x4F, 0x93, 0xAF, 0x3A,
+    0xF5, 0xF9, 0x2F, 0x95, 0xAF, 0x1A, 0xF7, 0xF9, 0x0F, 0x97, 0xAF, 0xAF, 0x71, 0xFF, 0x72, 0x9F,
+    0xDA, 0x73, 0xFD, 0x74, 0x9F, 0xA7, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97,
+    0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x96, 0x39, 0x99, 0x99, 0x73, 0xAF, 0x97, 0x39, 0xF7, 0x49, 0xF7,
+    0x5F, 0x75, 0x99, 0x97, 0x75, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4, 0xF9,
+    0x2F, 0x39, 0xF3, 0xF9, 0x2A, 0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x6E,
+    0xA0, 0xF7, 0xF9, 0xEA, 0x79, 0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xFC,
+    0x73, 0xF9, 0x72, 0x9F, 0x73, 0xFA, 0x7A, 0xAA, 0xFC, 0x70, 0xFE, 0xA7, 0x0F, 0xDA, 0x71, 0xFA,
+    0x97, 0x10, 0xAF, 0x7A, 0xF0, 0x9F, 0xA6, 0xFA, 0x1F, 0xC5, 0xAF, 0x3F, 0x94, 0xF9, 0x3A, 0xF3,
+    0xAF, 0x5F, 0x92, 0xF9, 0x5A, 0xF1, 0xAF, 0x7F, 0x90, 0xF9, 0x7A, 0xFA, 0xF7, 0x1F, 0xF7, 0x29,
+    0xFD, 0xA7, 0x3F, 0xD7, 0x49, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9,
+    0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x77, 0x77, 0x77, 0x3A, 0xE7, 0x6F, 0x97, 0x49, 0xF9, 0x75,
+    0xAE, 0x77, 0x72, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4, 0xF9, 0x2F, 0x39,
+    0xF3, 0xF9, 0x2A, 0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x6E, 0xA0, 0xF7,
+    0xF9, 0xEA, 0x79, 0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xF9,
+    0x72, 0x9F, 0x73, 0xFA, 0x09, 0xE9, 0x1A, 0xAA, 0xFC, 0x1F, 0xC1, 0xFE, 0xA1, 0xFC, 0x1F, 0xDA,
+    0x29, 0xE9, 0x1F, 0xA9, 0x71, 0x77, 0x70, 0xAF, 0x97, 0x4F, 0xD9, 0x73, 0x99, 0x9E, 0xA7, 0x6E,
+    0xA7, 0x5A, 0xE9, 0x74, 0x9E, 0x97, 0x59, 0xD7, 0x77, 0x3A, 0xF7, 0xAF, 0x09, 0xFA, 0x6F, 0xA1,
+    0xFC, 0x5A, 0xF3, 0xF9, 0x4F, 0x93, 0xAF, 0x3A, 0xF5, 0xF9, 0x2F, 0x95, 0xAF, 0x1A, 0xF7, 0xF9,
+    0x0F, 0x97, 0xAF, 0xAF, 0x71, 0xFF, 0x72, 0x9F, 0xDA, 0x73, 0xFD, 0x74, 0x9F, 0xA7, 0x5F, 0x97,
+    0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x96, 0x77, 0x5A,
+    0xFA, 0x72, 0xAF, 0xCA, 0x73, 0x9F, 0x74, 0xAE, 0x73, 0xAE, 0x97, 0x3E, 0x75, 0xAA, 0x97, 0x77,
+    0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4, 0xF9, 0x2F, 0x39, 0xF3, 0xF9, 0x2A,
+    0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x6E, 0xA0, 0xF7, 0xF9, 0xEA, 0x79,
+    0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xF9, 0x72, 0x9F, 0x73,
+    0xFA, 0x7A, 0xAA, 0xFC, 0x70, 0xFE, 0xA7, 0x0F, 0xDA, 0x71, 0xFA, 0x97, 0x10, 0x77, 0x7A, 0xE9,
+    0x2D, 0x7A, 0xFD, 0xAE, 0x69, 0xFF, 0xD9, 0x6A, 0xD1, 0x9F, 0xA7, 0x09, 0x59, 0x77, 0x71, 0xAF,
+    0x7A, 0xF0, 0x9F, 0xA6, 0xFA, 0x1F, 0xC5, 0xAF, 0x3F, 0x94, 0xF9, 0x3A, 0xF3, 0xAF, 0x5F, 0x92,
+    0xF9, 0x5A, 0xF1, 0xAF, 0x7F, 0x90, 0xF9, 0x7A, 0xFA, 0xF7, 0x1F, 0xF7, 0x29, 0xFD, 0xA7, 0x3F,
+    0xD7, 0x49, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75, 0xF9, 0x75,
+    0xF9, 0x75, 0xF9, 0x60, 0x77, 0x4A, 0xE9, 0x2D, 0x94, 0xAF, 0xDA, 0xE5, 0xFF, 0xDA, 0x49, 0xD2,
+    0xAE, 0xA6, 0x95, 0x97, 0x76, 0xFA, 0x6F, 0x99, 0xF5, 0x9F, 0x1F, 0x94, 0xAF, 0x1A, 0xF4, 0xF9,
+    0x2F, 0x39, 0xF3, 0xF9, 0x2A, 0xEA, 0x39, 0xF2, 0xF5, 0xF1, 0x9F, 0x5A, 0xE9, 0x0A, 0xE9, 0x6E,
+    0xA0, 0xF7, 0xF9, 0xEA, 0x79, 0xEA, 0xE9, 0x70, 0xFE, 0x71, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xFC,
+    0x73, 0xF9, 0x72, 0x9F, 0x73, 0xFA, 0x7A, 0xAA, 0xFC, 0x70, 0xFE, 0xA7, 0x0F, 0xDA, 0x71, 0xFA,
+    0x97, 0x10, 0x72, 0x9A, 0x6C, 0xA1, 0x9A, 0xAA, 0xAC, 0xA0, 0xAC, 0xAA, 0xAC, 0xA0, 0xAA, 0x1C,
+    0xA1, 0xAA, 0x09, 0xA2, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x72,
+    0xA9, 0x4A, 0xC4, 0xAC, 0xAA, 0xAA, 0x90, 0xAC, 0xAA, 0xAC, 0xA1, 0xAC, 0x1A, 0xA2, 0xA9, 0x0A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA,
+    0x90, 0xFE, 0x90, 0xFE, 0x90, 0xFE, 0x90, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0x90, 0xFE, 0x90,
+    0xFE, 0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xFF, 0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0x9F, 0xFF, 0x9A, 0xFF, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFF, 0xFF, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xAF, 0xFF, 0xFF, 0xFD, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xAF,
+    0xFF, 0xFF, 0xFD, 0x00, 0x73, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A,
+    0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9,
+    0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E,
+    0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A,
+    0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9,
+    0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x0A, 0xAA, 0x39, 0xAA, 0x00, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x19, 0xDA, 0x1A,
+    0xDA, 0x1E, 0x90, 0xAE, 0x1F, 0x1F, 0x0A, 0xEA, 0x19, 0x99, 0x10, 0x1E, 0xA0, 0x9E, 0xA0, 0xAE,
+    0x90, 0xF1, 0xEA, 0x1E, 0x90, 0x9E, 0x29, 0x92, 0x1A, 0xE9, 0x1F, 0x2F, 0x19, 0xE9, 0x1A, 0xE2,
+    0xEA, 0x2E, 0x39, 0x99, 0x20, 0x9E, 0xA0, 0x9F, 0x1F, 0x1A, 0xE1, 0x9E, 0x91, 0xEA, 0x19, 0xE2,
+    0x99, 0x90, 0x19, 0xDA, 0x2A, 0xD9, 0x1A, 0xDA, 0x2E, 0x91, 0xE9, 0x19, 0xE1, 0xAE, 0x2F, 0x1F,
+    0x2E, 0xA1, 0xF1, 0xAE, 0xA0, 0xAE, 0xA1, 0xF9, 0x19, 0x99, 0x29, 0x99, 0x91, 0x1E, 0xA1, 0xAE,
+    0x90, 0x9E, 0xA1, 0xF9, 0x0A, 0xE9, 0x1F, 0x1F, 0x2E, 0xA1, 0xEA, 0x19, 0xE9, 0x1E, 0x91, 0xAE,
+    0x19, 0xE2, 0xE9, 0x29, 0x93, 0x99, 0x92, 0x1A, 0xE9, 0x1F, 0x2F, 0x2F, 0x2F, 0x19, 0xEA, 0x19,
+    0xEA, 0x1A, 0xE2, 0x9E, 0x2F, 0x2A, 0xE2, 0xE9, 0x2E, 0x91, 0x9E, 0x39, 0x99, 0x39, 0x93, 0x9E,
+    0xA1, 0xF1, 0x9F, 0x1A, 0xE9, 0x1F, 0x19, 0xEA, 0x1A, 0xE2, 0xF1, 0x9E, 0x91, 0xAE, 0x2E, 0xA1,
+    0x9E, 0x29, 0xE2, 0xE9, 0x29, 0x99, 0x39, 0x90, 0x77, 0x0A, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x1E,
+    0x71, 0xDA, 0x5A, 0x99, 0x9D, 0xA9, 0x99, 0xA0, 0x9F, 0xFE, 0x99, 0xFF, 0xE9, 0x9A, 0xAA, 0x9D,
+    0xA9, 0xAA, 0xA5, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x09, 0xE7, 0x09,
+    0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE9, 0x30, 0x77, 0x09, 0xE9, 0x70,
+    0xE9, 0x70, 0xE7, 0x1E, 0x71, 0xAD, 0x49, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xFF, 0xEA, 0x4E, 0x71,
+    0xE7, 0x1E, 0x97, 0x0E, 0x97, 0x0E, 0x59, 0x2E, 0x29, 0x09, 0xFF, 0xEA, 0x9F, 0xFE, 0xA9, 0xEA,
+    0xEA, 0xEA, 0x4E, 0x71, 0xE7, 0x1E, 0x71, 0xE9, 0x79, 0xE9, 0x30, 0x72, 0xAE, 0xA2, 0xFE, 0x09,
+    0xFE, 0x9A, 0xFE, 0xAA, 0xFE, 0xAA, 0xFE, 0x90, 0xFE, 0x1A, 0xFC, 0xA2, 0x9E, 0x91, 0x71, 0x9C,
+    0x79, 0xDA, 0x59, 0xF9, 0x39, 0xFD, 0x29, 0xFE, 0xA0, 0x9F, 0xF0, 0x9F, 0xD9, 0x19, 0xFA, 0x39,
+    0xE5, 0x9C, 0x97, 0x70, 0x19, 0x99, 0x1F, 0x90, 0xFC, 0x0F, 0xC0, 0xAE, 0x91, 0x99, 0x10, 0x19,
+    0x95, 0x99, 0x92, 0xF9, 0x29, 0xF0, 0x9F, 0xA2, 0xFC, 0x09, 0xFA, 0x2A, 0xF1, 0xF3, 0x9E, 0xA2,
+    0x99, 0x69, 0x91, 0x19, 0x95, 0x99, 0x95, 0x99, 0x2F, 0x92, 0xAE, 0xA2, 0x9F, 0x09, 0xFA, 0x2F,
+    0xC2, 0xFC, 0x09, 0xFA, 0x2F, 0xC2, 0xAF, 0x1F, 0x3A, 0xE9, 0x29, 0xEA, 0x29, 0x96, 0x96, 0x99,
+    0x10, 0x19, 0x92, 0xF9, 0x9F, 0xA9, 0xFA, 0x0F, 0x29, 0x91, 0x9A, 0xAA, 0xAA, 0xA0, 0xAC, 0xAA,
+    0xAA, 0xA0, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0x0A, 0xAA, 0xAA, 0xA9, 0x0A, 0xAA, 0xAA, 0xCA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x79, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD,
+    0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD,
+    0x99, 0xC5, 0x9C, 0x59, 0xC5, 0x9C, 0x59, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD, 0x95, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0x99, 0xFD, 0x92, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x77, 0x77, 0x7A, 0xF9, 0x7E, 0x97,
+    0x71, 0xFE, 0x95, 0xAE, 0x77, 0x19, 0xFF, 0x5E, 0x97, 0x71, 0xF1, 0xE9, 0x3A, 0xE7, 0x72, 0xE9,
+    0x1E, 0xA3, 0xE7, 0x73, 0xE9, 0x1A, 0xE2, 0xEA, 0x77, 0x3E, 0x91, 0xAE, 0x19, 0xE7, 0x74, 0xE9,
+    0x1A, 0xDA, 0x1E, 0xA7, 0x74, 0xE9, 0x1E, 0xA0, 0x9E, 0x19, 0xAC, 0xA9, 0x59, 0xAC, 0xA9, 0x3A,
+    0xE1, 0xE9, 0x0E, 0x90, 0xFD, 0xA3, 0xFD, 0xA2, 0x9F, 0xF0, 0xAE, 0x0A, 0xFE, 0x91, 0xAF, 0xEA,
+    0x2A, 0xFD, 0x90, 0xE9, 0x0E, 0xA0, 0xAE, 0x1E, 0xA0, 0xAE, 0x39, 0xEA, 0x1A, 0xE0, 0x9E, 0x2E,
+    0x09, 0xE2, 0xE9, 0x71, 0xE1, 0x9E, 0x2E, 0x99, 0xE2, 0xE9, 0x70, 0xEA, 0x19, 0xE2, 0xE9, 0x9E,
+    0x2E, 0x97, 0x9E, 0x29, 0xE2, 0xE9, 0x9E, 0x2E, 0x97, 0xEA, 0x29, 0xE2, 0xE9, 0x9E, 0x2E, 0x96,
+    0x9E, 0x4E, 0x90, 0x9E, 0x1E, 0x90, 0x9E, 0x7E, 0x94, 0xFA, 0xF1, 0xAE, 0xAF, 0x6A, 0xE6, 0xFE,
+    0x3F, 0xE7, 0xE9, 0x69, 0xFC, 0x94, 0xFC, 0x97, 0x75, 0x97, 0x19, 0x40, 0x77, 0x77, 0x77, 0x2A,
+    0xF9, 0x7E, 0x97, 0x77, 0x4F, 0xE9, 0x5A, 0xE7, 0x77, 0x49, 0xFF, 0x5E, 0x97, 0x77, 0x4F, 0x1E,
+    0x93, 0xAE, 0x77, 0x75, 0xE9, 0x1E, 0xA3, 0xE9, 0x77, 0x75, 0xE9, 0x1A, 0xE2, 0xAD, 0xA7, 0x77,
+    0x6E, 0x91, 0xAE, 0x19, 0xE7, 0x77, 0x7E, 0x91, 0xAE, 0x1E, 0xA7, 0x77, 0x7E, 0xA1, 0xEA, 0x09,
+    0xE1, 0x9A, 0xCA, 0x95, 0x9A, 0xCA, 0x95, 0x9A, 0xCA, 0x93, 0xAE, 0x1E, 0x90, 0xEA, 0x0A, 0xFD,
+    0x3A, 0xFD, 0x3A, 0xFD, 0x29, 0xFF, 0x09, 0xE0, 0xAF, 0xEA, 0x19, 0xFE, 0xA1, 0x9F, 0xF2, 0xAF,
+    0xD9, 0x0E, 0x90, 0xF0, 0xAE, 0x1F, 0x0A, 0xE1, 0xF0, 0x9E, 0x92, 0x9E, 0xA1, 0xAE, 0x1E, 0x91,
+    0xE9, 0x0E, 0x91, 0xE9, 0x0E, 0x91, 0xEA, 0x71, 0xE9, 0x09, 0xE2, 0xEA, 0x9E, 0x2E, 0xA0, 0xE9,
+    0x1E, 0xA7, 0x0A, 0xDA, 0x19, 0xE2, 0xEA, 0x9E, 0x2E, 0xA0, 0xE9, 0x1A, 0xE7, 0x9E, 0x29, 0xE2,
+    0xEA, 0x9E, 0x2E, 0xA0, 0xE9, 0x1A, 0xE7, 0xEA, 0x3E, 0x2E, 0x90, 0xE9, 0x1E, 0xA0, 0xE9, 0x1E,
+    0xA6, 0x9E, 0x4E, 0x90, 0x9E, 0x90, 0xEA, 0x1E, 0x90, 0xEA, 0x1E, 0x96, 0xEA, 0x4A, 0xEA, 0xF1,
+    0xAE, 0xAF, 0x19, 0xEA, 0xF6, 0x9E, 0x6F, 0xE9, 0x2F, 0xE9, 0x2F, 0xEA, 0x6E, 0x97, 0xFC, 0x94,
+    0xFC, 0x94, 0xAF, 0x97, 0x75, 0x97, 0x19, 0x77, 0x3E, 0xA3, 0xAE, 0x4E, 0xA3, 0xAE, 0x4E, 0x4A,
+    0xDA, 0x4E, 0x49, 0xAA, 0x94, 0x3E, 0xA1, 0xAE, 0x3A, 0xE2, 0xEA, 0x3E, 0xA1, 0xAE, 0x3A, 0xE2,
+    0xE9, 0x3E, 0x2A, 0xDA, 0x3A, 0xDA, 0x2E, 0x4E, 0x2A, 0xD9, 0x39, 0xAA, 0x92, 0xAA, 0xA4, 0x3E,
+    0xA1, 0xAE, 0x2E, 0xA2, 0xAE, 0x2E, 0xA1, 0xAE, 0x3E, 0xA1, 0xAE, 0x2E, 0x92, 0xAE, 0x2E, 0x91,
+    0xAE, 0x3E, 0x2A, 0xDA, 0x2E, 0x3A, 0xDA, 0x2E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x2E, 0x39, 0xAA,
+    0x92, 0xAA, 0xA2, 0x9A, 0xA4, 0x0E, 0xA4, 0xAE, 0x5E, 0xA4, 0x9E, 0x5A, 0xDA, 0x5E, 0x59, 0xDA,
+    0x5A, 0xAA, 0x00, 0x0E, 0xA1, 0xAE, 0x4A, 0xE2, 0xEA, 0x4E, 0xA1, 0xAE, 0x49, 0xE2, 0xEA, 0x4A,
+    0xDA, 0x2E, 0x5E, 0x2A, 0xDA, 0x49, 0xDA, 0x2E, 0x5A, 0xAA, 0x29, 0xAA, 0x90, 0x0E, 0xA1, 0xAE,
+    0x19, 0xE9, 0x4A, 0xE2, 0xEA, 0x1F, 0x5E, 0xA1, 0xAE, 0x2E, 0xA4, 0x9E, 0x2E, 0xA1, 0x9E, 0x5A,
+    0xDA, 0x2E, 0x2E, 0xA5, 0xE2, 0xAD, 0xA2, 0xE5, 0x9D, 0xA2, 0xE2, 0x9D, 0xA5, 0xAA, 0xA2, 0x9A,
+    0xA9, 0x2A, 0xAA, 0x00, 0x49, 0x97, 0x09, 0xD7, 0x0E, 0x96, 0x9F, 0x6D, 0x9D, 0xA4, 0x9D, 0x09,
+    0xD4, 0xDA, 0x1D, 0xA2, 0x9D, 0x29, 0xD2, 0xDA, 0x3D, 0xA1, 0xD4, 0x9D, 0x00, 0x49, 0x6A, 0xDA,
+    0x39, 0xF3, 0xF9, 0x2F, 0xA2, 0xFC, 0x2A, 0xF3, 0xAF, 0x4F, 0xC4, 0xFA, 0x4F, 0x93, 0x9F, 0x4A,
+    0xDA, 0x59, 0x20, 0x19, 0x95, 0xAD, 0x4A, 0xF4, 0xAF, 0x4F, 0xA4, 0xF9, 0x39, 0xF9, 0x29, 0xF9,
+    0x2F, 0x92, 0xFA, 0x2A, 0xF2, 0xAF, 0x4A, 0xD6, 0x99, 0x40, 0x77, 0x71, 0x94, 0x9E, 0x59, 0x4D,
+    0x93, 0xAE, 0xA3, 0xAC, 0xA2, 0xAE, 0x92, 0xAE, 0xA2, 0xAE, 0xA2, 0xF9, 0x19, 0xE2, 0xAE, 0xA4,
+    0xF9, 0x29, 0x2A, 0xEA, 0x6F, 0x94, 0xAE, 0xA7, 0x0F, 0x92, 0xAE, 0xA7, 0x2F, 0x90, 0xAE, 0xA7,
+    0x99, 0x2F, 0xFC, 0x29, 0x92, 0xEA, 0x2F, 0xE2, 0xF0, 0xAF, 0x3F, 0xC3, 0xF9, 0x9F, 0x2A, 0xFC,
+    0x92, 0xF1, 0xAD, 0x91, 0xAF, 0xE9, 0x19, 0xD9, 0x6A, 0xEA, 0x0F, 0x97, 0x2A, 0xEA, 0x2F, 0x97,
+    0x0A, 0xEA, 0x4F, 0x96, 0xAE, 0xA6, 0xF9, 0x4A, 0xEA, 0x2A, 0xCA, 0x2F, 0x92, 0xAE, 0xA2, 0xAE,
+    0x92, 0xF9, 0x19, 0xDA, 0x3F, 0xA3, 0xE3, 0x9A, 0x4A, 0xE9, 0x4C, 0x74, 0xAA, 0x97, 0x10, 0x9F,
+    0x92, 0xFA, 0x9F, 0xA2, 0xFC, 0x0F, 0x92, 0xFC, 0x0F, 0x92, 0xFA, 0x0F, 0x92, 0xFA, 0x0F, 0x92,
+    0xFA, 0x0F, 0x92, 0xAE, 0xA0, 0xF3, 0xAE, 0xA0, 0xF3, 0xAE, 0x90, 0xF3, 0xAE, 0x90, 0xF3, 0xAE,
+    0x90, 0xF3, 0x9E, 0x90, 0xAE, 0x39, 0xE9, 0x0A, 0xE3, 0x9E, 0x77, 0x76, 0x99, 0x59, 0x99, 0x1F,
+    0x92, 0xAE, 0xA9, 0xFA, 0x2F, 0xC9, 0xFA, 0x2F, 0xC0, 0xF3, 0xAE, 0x91, 0x99, 0x69, 0x10, 0x77,
+    0x9A, 0xFD, 0x92, 0x9F, 0xFD, 0xA1, 0x9F, 0xFE, 0xA1, 0xFD, 0x9A, 0xF1, 0x99, 0xAE, 0x1F, 0x3A,
+    0xE1, 0xAE, 0x3A, 0xE1, 0xF3, 0x9E, 0x0A, 0xEA, 0x39, 0xEA, 0xF4, 0x9F, 0xE5, 0x9F, 0xCA, 0x7F,
+    0x97, 0x0F, 0x71, 0xEA, 0x77, 0x77, 0x69, 0x97, 0x2F, 0x70, 0x9F, 0x97, 0x9F, 0x97, 0x0F, 0x72,
+    0x99, 0x60, 0x77, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x77, 0x2C, 0x97, 0x3A,
+    0xC1, 0xD7, 0x29, 0xCA, 0x2D, 0x70, 0x9D, 0x39, 0xDA, 0x49, 0xAD, 0x6F, 0xFC, 0xA7, 0x09, 0xAF,
+    0xA9, 0x40, 0x77, 0x69, 0xFD, 0x97, 0x9F, 0xFD, 0x59, 0xDA, 0x5A, 0xD4, 0xD7, 0x1D, 0x2D, 0x73,
+    0xCA, 0x1C, 0x74, 0x9C, 0x77, 0x20, 0x70, 0x9A, 0x97, 0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x9D,
+    0x70, 0xD9, 0x79, 0xD7, 0x0D, 0x97, 0x9D, 0x70, 0xD9, 0x79, 0xD7, 0x0E, 0x96, 0x9F, 0x6D, 0xAA,
+    0xC9, 0x5D, 0x1D, 0x4A, 0xCA, 0x1D, 0x93, 0xD2, 0x9D, 0x2A, 0xCA, 0x3D, 0x91, 0xD4, 0x9D, 0x00,
+    0x77, 0x77, 0x76, 0xAE, 0x77, 0x74, 0x9E, 0x77, 0x74, 0x9E, 0x77, 0x74, 0x9D, 0xA7, 0x77, 0x9D,
+    0xA9, 0x0D, 0xA0, 0x9E, 0x77, 0x2A, 0xFF, 0xFC, 0x77, 0x2A, 0xFF, 0xFC, 0x77, 0x39, 0x99, 0xAF,
+    0xC9, 0x99, 0x97, 0x76, 0xAF, 0xC7, 0x77, 0x19, 0xEA, 0xE7, 0x77, 0x0E, 0xA0, 0xEA, 0x77, 0x6F,
+    0x1A, 0xE9, 0x77, 0x09, 0x99, 0x2A, 0xCA, 0x2D, 0x92, 0x99, 0x97, 0x2A, 0xE7, 0x09, 0x3A, 0xE7,
+    0x2A, 0xE7, 0x59, 0xE7, 0x29, 0xDA, 0x75, 0x9E, 0x69, 0x29, 0xDA, 0x39, 0x49, 0x29, 0xDA, 0x39,
+    0x0A, 0xDA, 0x99, 0xDA, 0x9A, 0xE3, 0x9D, 0xA9, 0x9D, 0xA9, 0xAE, 0x0A, 0xFF, 0xFC, 0x3A, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xD3, 0xFF, 0xFD, 0x39, 0xAF, 0xC9, 0x97, 0x09, 0xAF, 0xC9, 0x96, 0xFD, 0x73,
+    0xFD, 0x96, 0xAE, 0xAE, 0x71, 0xAE, 0xAE, 0x59, 0xE9, 0x0E, 0xA7, 0x9E, 0x90, 0xEA, 0x4F, 0x1A,
+    0xE9, 0x6F, 0x1A, 0xE9, 0x4A, 0xCA, 0x2C, 0xA7, 0x19, 0xCA, 0x2C, 0xA7, 0x77, 0x74, 0x9A, 0xAA,
+    0xAA, 0xAA, 0x0A, 0xFE, 0x0A, 0xFE, 0x0A, 0xFE, 0x00, 0x73, 0xE7, 0x3E, 0xA7, 0x29, 0xE7, 0x3E,
+    0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2A, 0xE7, 0x3E, 0x97, 0x2A, 0xDA, 0x73, 0xE7, 0x3E, 0xA7, 0x29,
+    0xE7, 0x3E, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2A, 0xE7, 0x3E, 0x97, 0x2A, 0xE7, 0x3E, 0x73, 0xEA,
+    0x72, 0x9E, 0x73, 0xFF, 0xFF, 0xFF, 0xC2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xFA, 0xAA,
+    0xFF, 0xFF, 0xD9, 0x99, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF9, 0x99, 0xFF, 0xFD, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x0F, 0xDA, 0x9F, 0xDA, 0x9F, 0xDA, 0x29, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3,
+    0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA0, 0xAA, 0xAE, 0xA9, 0xFD, 0xA9, 0xFD, 0xA0, 0x99, 0x9E, 0xA3,
+    0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x3E, 0xA3, 0xEA, 0x09, 0x99, 0xEA, 0x9F, 0xDA, 0x9F,
+    0xDA, 0x0A, 0xAA, 0xAA, 0xA9, 0x77, 0x75, 0x9A, 0xFD, 0x94, 0x9F, 0xDA, 0x92, 0x9F, 0xFE, 0x1A,
+    0xFF, 0xDA, 0x19, 0xFF, 0xEA, 0x0A, 0xFF, 0xE9, 0x1E, 0xAA, 0x9A, 0xFC, 0x1E, 0xA9, 0x9A, 0xFC,
+    0x19, 0x95, 0xF9, 0x0A, 0x94, 0x9F, 0x71, 0xF9, 0x70, 0xF7, 0x1F, 0x70, 0x9F, 0x70, 0xFC, 0x70,
+    0xFA, 0x7F, 0xC7, 0x9F, 0xC6, 0x9F, 0xC7, 0xAF, 0xC7, 0xFC, 0x79, 0xFA, 0x7A, 0xEA, 0x70, 0xF9,
+    0x70, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0x97, 0x77, 0x77, 0x77, 0x72, 0x99, 0x73, 0x99, 0x72,
+    0xF7, 0x09, 0xF7, 0x09, 0xFA, 0x7A, 0xF9, 0x79, 0xF9, 0x7A, 0xF7, 0x1F, 0x71, 0xF7, 0x29, 0x97,
+    0x39, 0x96, 0x77, 0x69, 0xAF, 0xD9, 0x39, 0xF9, 0x9F, 0xFE, 0x29, 0xF9, 0x9F, 0xFE, 0xA1, 0x9F,
+    0x90, 0xEA, 0xA9, 0xAF, 0xC1, 0x9F, 0x90, 0x99, 0x5F, 0x91, 0xF9, 0x70, 0xF9, 0x1F, 0x71, 0xF2,
+    0xF7, 0x0F, 0xC2, 0xF7, 0xFC, 0x3F, 0x59, 0xFC, 0x4F, 0x5F, 0xC5, 0xF4, 0xAE, 0xA6, 0xF4, 0xF7,
+    0xF4, 0xEA, 0x7F, 0x77, 0x77, 0x77, 0x99, 0x71, 0x99, 0x5F, 0x7F, 0x39, 0xFA, 0x59, 0xFA, 0x29,
+    0xF9, 0x59, 0xF9, 0x3F, 0x7F, 0x59, 0x97, 0x19, 0x91, 0x77, 0x49, 0xF9, 0x29, 0xAF, 0xDA, 0x29,
+    0xFA, 0x1F, 0xFE, 0x2F, 0x91, 0xFF, 0xF1, 0xF9, 0x1A, 0xEA, 0x99, 0xFC, 0x90, 0xF9, 0x2A, 0x5A,
+    0xEA, 0x0F, 0x97, 0x1A, 0xEA, 0x0F, 0x97, 0x1F, 0x90, 0xF7, 0x1A, 0xF1, 0xF7, 0x0A, 0xF9, 0x1F,
+    0x7F, 0xC9, 0x2F, 0x6F, 0xC9, 0x3F, 0x59, 0xF5, 0xAE, 0x59, 0xE6, 0xAE, 0x5A, 0xE7, 0x77, 0x77,
+    0x71, 0x99, 0x79, 0x99, 0x6F, 0x94, 0xFA, 0x49, 0xFA, 0x4F, 0xC4, 0x9F, 0xA4, 0xFC, 0x5F, 0x5A,
+    0xE9, 0x69, 0x97, 0x09, 0x60, 0xAF, 0xFF, 0xC9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x70, 0x9E, 0xA7,
+    0x1A, 0xE7, 0x19, 0xEA, 0x71, 0xF7, 0x1A, 0xE9, 0x71, 0xF7, 0x1A, 0xE9, 0x70, 0x9E, 0xA7, 0x1F,
+    0x71, 0xAE, 0xA7, 0x1F, 0x71, 0xF9, 0x70, 0x9F, 0x70, 0x77, 0xFF, 0xF9, 0x2F, 0xFF, 0xCA, 0x1D,
+    0xA9, 0x9F, 0xFC, 0x90, 0xDA, 0x1F, 0xFC, 0xA0, 0xDA, 0x1F, 0xFD, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA,
+    0x1F, 0xFD, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFD, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFD,
+    0x0D, 0xA1, 0xFF, 0xC9, 0x0D, 0xA1, 0xFF, 0xA1, 0xDA, 0x1F, 0xEA, 0x2D, 0xA1, 0xD9, 0x09, 0x5D,
+    0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1,
+    0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7A, 0xA9, 0x1A,
+    0xA9, 0x70, 0x3A, 0xFF, 0xDA, 0x19, 0xFF, 0xFA, 0x09, 0xFF, 0xFC, 0xA0, 0xFF, 0xD1, 0xAC, 0xA0,
+    0xFF, 0xD1, 0xAC, 0xA9, 0xFF, 0xD1, 0xAC, 0xA9, 0xFF, 0xD1, 0xAC, 0xA9, 0xFF, 0xD1, 0xAC, 0xA9,
+    0xFF, 0xD1, 0xAC, 0xA9, 0xFF, 0xD1, 0xAC, 0xA0, 0xFF, 0xD1, 0xAC, 0xA0, 0xFF, 0xD1, 0xDA, 0x1F,
+    0xFF, 0xCA, 0x19, 0xFF, 0xFA, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x9F, 0xFD, 0xA3, 0x9F,
+    0xFF, 0xA1, 0x9F, 0xFF, 0xC9, 0x09, 0xD1, 0xFF, 0xD0, 0x9D, 0x1F, 0xFD, 0x99, 0xD1, 0xFF, 0xD9,
+    0x9D, 0x1F, 0xFD, 0xA9, 0xD1, 0xFF, 0xDA, 0x9D, 0x1F, 0xFD, 0xA9, 0xD1, 0xFF, 0xD9, 0x9D, 0x1F,
+    0xFD, 0x09, 0xD1, 0xFF, 0xD0, 0x9F, 0xFF, 0xC9, 0x09, 0xFF, 0xF9, 0x19, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x93, 0x77, 0x4E, 0xA7, 0x2E, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x95, 0xAD, 0xA0, 0x9D, 0x99,
+    0xAD, 0xA0, 0xFF, 0xFC, 0xA0, 0xFF, 0xFD, 0x19, 0x99, 0xFC, 0xA9, 0x99, 0x5F, 0xD7, 0xEA, 0xEA,
+    0x5A, 0xE0, 0x9E, 0x94, 0xF1, 0xF4, 0x9D, 0x91, 0x9C, 0xA7, 0x97, 0x00, 0x7A, 0xE1, 0x9F, 0xA0,
+    0x9F, 0xA1, 0xF9, 0x2A, 0xA9, 0x77, 0x77, 0x77, 0x39, 0x99, 0x92, 0xF2, 0xF9, 0x19, 0xE9, 0x2E,
+    0xA2, 0xAE, 0x3E, 0x3A, 0xD0, 0x77, 0x69, 0xFD, 0x97, 0x9F, 0xFD, 0x59, 0xDA, 0x5A, 0xD4, 0xD7,
+    0x1D, 0x2D, 0x73, 0xCA, 0x1C, 0x74, 0x9C, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5C, 0x97, 0x3A, 0xC1, 0xD7,
+    0x29, 0xCA, 0x2D, 0x70, 0x9D, 0x39, 0xDA, 0x49, 0xAD, 0x6F, 0xFC, 0xA7, 0x09, 0xAF, 0xA9, 0x40,
+    0x77, 0x4E, 0xA7, 0x2E, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x95, 0xAD, 0xA0, 0x9D, 0x99, 0xAD, 0xA0,
+    0xFF, 0xFC, 0xA0, 0xFF, 0xFD, 0x19, 0x99, 0xFC, 0xA9, 0x99, 0x5F, 0xD7, 0xEA, 0xEA, 0x5A, 0xE0,
+    0x9E, 0x94, 0xF1, 0xF4, 0x9D, 0x91, 0x9C, 0xA7, 0x97, 0x77, 0x5E, 0xA7, 0x2E, 0xA7, 0x2A, 0xD9,
+    0x72, 0xAD, 0x95, 0xAD, 0xA0, 0x9D, 0x99, 0xAD, 0xA0, 0xFF, 0xFC, 0xA0, 0xFF, 0xFD, 0x19, 0x99,
+    0xFC, 0xA9, 0x99, 0x5F, 0xD7, 0xEA, 0xEA, 0x5A, 0xE0, 0x9E, 0x94, 0xF1, 0xF4, 0x9D, 0x91, 0x9C,
+    0xA7, 0x97, 0x00, 0x74, 0x9E, 0x92, 0x9E, 0x0F, 0xC2, 0xEA, 0x0F, 0xC2, 0xE9, 0x0A, 0xEA, 0x1A,
+    0xE2, 0x9A, 0x92, 0xE9, 0x79, 0xE7, 0x0E, 0xA7, 0x9E, 0x70, 0xAE, 0x70, 0xE9, 0x7A, 0xE7, 0x0E,
+    0xA7, 0x9E, 0x70, 0xEA, 0x70, 0xE9, 0x7A, 0xE7, 0x0E, 0x92, 0x99, 0x29, 0xE1, 0x9F, 0x1E, 0xA1,
+    0xAF, 0x09, 0xE2, 0xAF, 0x0A, 0xE3, 0xEA, 0x71, 0x92, 0x29, 0xAF, 0xAA, 0x97, 0x4A, 0xA2, 0xAF,
+    0xFF, 0xA9, 0x95, 0xE1, 0xFF, 0xFF, 0xFF, 0xC9, 0x09, 0xDA, 0x49, 0xAA, 0xFF, 0xFC, 0x91, 0xAC,
+    0x97, 0x29, 0x9A, 0xFD, 0xA7, 0x77, 0x70, 0x69, 0x99, 0x97, 0x29, 0xFE, 0xA7, 0xAE, 0xAA, 0xAA,
+    0xE9, 0x4A, 0xCA, 0x69, 0xD9, 0x29, 0xCA, 0x71, 0xAC, 0x91, 0xCA, 0x73, 0xD1, 0xA7, 0x49, 0x90,
+    0x6A, 0xA9, 0x74, 0xD9, 0x70, 0xCA, 0x1D, 0x90, 0x9C, 0x93, 0xAD, 0xA0, 0xD9, 0x9E, 0x4A, 0xFF,
+    0xC6, 0xAF, 0xE4, 0xAA, 0xAA, 0xFD, 0xAA, 0xAA, 0x90, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x93, 0x9F,
+    0xDA, 0x69, 0xFF, 0xA4, 0x9E, 0x9D, 0x9A, 0xDA, 0x39, 0xD1, 0xD9, 0x0A, 0xCA, 0x49, 0x2D, 0x91,
+    0x97, 0x1D, 0x95, 0x72, 0x99, 0x72, 0x9F, 0x71, 0xAF, 0x71, 0xAF, 0x72, 0xEA, 0x77, 0x77, 0x77,
+    0x76, 0xAA, 0x97, 0x2F, 0x97, 0x09, 0xFA, 0x71, 0xFA, 0x71, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x7A, 0xCA, 0x97, 0x1A, 0xF7, 0x1F, 0xC7, 0x1A, 0xF7, 0x29, 0xAA, 0x10, 0x3E, 0xA1, 0xF1, 0xAE,
+    0x1A, 0xE3, 0xAE, 0x19, 0xE9, 0x09, 0xEA, 0x1E, 0xA3, 0xEA, 0x1E, 0xA1, 0xF1, 0xAE, 0x3A, 0xE1,
+    0x9E, 0x19, 0xE2, 0xE9, 0x3E, 0x2E, 0x91, 0xEA, 0x1A, 0xDA, 0x3A, 0xDA, 0x19, 0xDA, 0x19, 0xE2,
+    0xE4, 0xE2, 0xE2, 0xE2, 0xAD, 0x93, 0x9A, 0xA9, 0x2A, 0xA9, 0x2A, 0xA9, 0x2A, 0xAA, 0x40, 0x72,
+    0x99, 0x77, 0x29, 0xF7, 0x71, 0xAF, 0x77, 0x1A, 0xF7, 0x72, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x6A, 0xA9, 0x75, 0xAA, 0x91, 0xF9, 0x73, 0xFA, 0x9F, 0xA7, 0x3F, 0xC0, 0xFA, 0x73, 0xFA,
+    0x09, 0xDA, 0x74, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAC, 0xA9, 0x77, 0x1A, 0xF7,
+    0x71, 0xFC, 0x77, 0x1A, 0xF7, 0x72, 0x9A, 0xA7, 0x10, 0x19, 0x97, 0x69, 0x92, 0xF9, 0x73, 0xF9,
+    0x9F, 0xA7, 0x3F, 0xC9, 0xFA, 0x73, 0xFA, 0x0A, 0xE7, 0x4A, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x76, 0x9A, 0xA7, 0x72, 0xAF, 0x77, 0x1F, 0xC7, 0x71, 0xAF, 0x77, 0x2A, 0xD9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x59, 0xDA, 0x74, 0x9A, 0xCA, 0x1F, 0x97, 0x3F, 0xA9, 0xFA, 0x73, 0xFC, 0x0F,
+    0x97, 0x3F, 0xA1, 0xAA, 0x97, 0x5A, 0xA9, 0x00, 0x6A, 0xE0, 0x9F, 0xA9, 0xFA, 0x0F, 0x91, 0xAA,
+    0x97, 0x77, 0x77, 0x77, 0x74, 0x99, 0x2F, 0x99, 0xFA, 0x9F, 0xA0, 0xF2, 0x99, 0x10, 0x69, 0xDA,
+    0x75, 0xF9, 0x73, 0x9F, 0xA7, 0x4F, 0x97, 0x49, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xA9,
+    0x79, 0xAA, 0x91, 0xF9, 0x6F, 0x99, 0xFA, 0x59, 0xFA, 0x0F, 0xA5, 0x9F, 0x90, 0xAE, 0x7A, 0xDA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0x97, 0x6F, 0x97, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x4F, 0x76,
+    0x99, 0x70, 0x71, 0xE7, 0x73, 0xE7, 0x39, 0xE3, 0xE3, 0xE9, 0x3F, 0xA2, 0xE2, 0xFC, 0x3F, 0xC2,
+    0xE2, 0xFC, 0x3F, 0xA2, 0xE2, 0xAF, 0x4A, 0xCA, 0x3E, 0x3A, 0xCA, 0x74, 0xE7, 0x73, 0xE7, 0x73,
+    0xE7, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x09, 0xE9, 0x77, 0x2E, 0x77,
+    0x3E, 0x74, 0xAA, 0x93, 0xE3, 0x9A, 0xA4, 0xFA, 0x2E, 0x2A, 0xF3, 0xFC, 0x2E, 0x2F, 0xC3, 0xFA,
+    0x2E, 0x2F, 0xC3, 0xAE, 0x3E, 0x29, 0xE9, 0x73, 0xE7, 0x73, 0xE7, 0x10, 0x6A, 0xE1, 0xFA, 0x9F,
+    0xA0, 0xF9, 0x1A, 0xA9, 0x77, 0x71, 0xAE, 0x1F, 0xA0, 0xFC, 0x0F, 0xA1, 0xAA, 0x97, 0x75, 0x92,
+    0xAE, 0x09, 0xFA, 0x9F, 0xA0, 0xF9, 0x19, 0xA9, 0x00, 0x19, 0x92, 0xF9, 0x9F, 0xA9, 0xFA, 0x0A,
+    0xE7, 0x0A, 0xA9, 0x1F, 0x99, 0xFA, 0x0F, 0xA0, 0x9D, 0xA7, 0x9A, 0xA9, 0x1F, 0x99, 0xFA, 0x0F,
+    0x90, 0x9D, 0xA7, 0x9D, 0xA1, 0xF9, 0x9F, 0xA0, 0xF9, 0x1A, 0xA9, 0x00, 0x79, 0xFD, 0x92, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x9F, 0xD9, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x20, 0x79, 0xFD, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99,
+    0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x70, 0xFD, 0x1A,
+    0xFA, 0x2F, 0x39, 0xD9, 0x4D, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA2, 0x72, 0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x2A, 0xFA, 0x1F, 0xD3, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x72, 0xAA, 0x4A, 0xDA, 0x2C, 0xA1, 0xAC, 0x1C, 0xA1,
+    0xAC, 0x2A, 0xDA, 0x4D, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20,
+    0x79, 0xEA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x29, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x2A, 0xEA, 0x4F, 0xE2, 0xAF, 0xEA, 0x1F, 0x0A, 0xE0, 0x9E,
+    0x90, 0x9E, 0x99, 0xE2, 0xE9, 0x9E, 0x2E, 0x99, 0xE2, 0xE9, 0x9E, 0x91, 0xE9, 0x0E, 0xA0, 0xAE,
+    0x1A, 0xFF, 0x2F, 0xE4, 0xFC, 0x75, 0x0A, 0xA0, 0xAD, 0x99, 0xD4, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A,
+    0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x99, 0xAA, 0x00, 0x49, 0xAA, 0xA6, 0xF5, 0xFC,
+    0x49, 0xFC, 0x4D, 0x9E, 0x3D, 0xA0, 0xE2, 0x9D, 0x1E, 0x2D, 0x91, 0xE1, 0xAF, 0xFC, 0xAA, 0xFF,
+    0xD9, 0xAA, 0xAA, 0xAE, 0xA9, 0x5E, 0x7E, 0x10, 0x0A, 0xAA, 0xAA, 0xAA, 0x2F, 0xE9, 0x09, 0xFE,
+    0x90, 0x9D, 0x69, 0xD9, 0x5A, 0xFD, 0x91, 0x9F, 0xEA, 0x5A, 0xE6, 0xE6, 0xE0, 0xD9, 0x99, 0xF0,
+    0xFF, 0x90, 0x9F, 0xCA, 0x74, 0x39, 0xAE, 0x93, 0xFD, 0x92, 0xFC, 0xAA, 0x91, 0xAE, 0x6E, 0x7E,
+    0x9F, 0x19, 0xFF, 0xC0, 0x9E, 0x91, 0xE9, 0x9E, 0x2E, 0x90, 0xE2, 0xE9, 0x0E, 0xA9, 0xAE, 0x2F,
+    0xEA, 0x3A, 0xF9, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x90, 0xFF, 0xC9, 0x6E, 0x6A,
+    0xDA, 0x6E, 0x6A, 0xDA, 0x6E, 0x6A, 0xDA, 0x6E, 0x95, 0xAE, 0x6E, 0x95, 0xAE, 0x40, 0x2A, 0xEA,
+    0x39, 0xFE, 0x91, 0xEA, 0x9A, 0xE1, 0xE2, 0xE1, 0xAD, 0xA0, 0x9D, 0xA2, 0xFE, 0x3A, 0xFC, 0xA2,
+    0xAE, 0xAE, 0xA1, 0xE2, 0xE9, 0x9D, 0xA2, 0xAD, 0x90, 0xE9, 0x09, 0xE1, 0xAF, 0xEA, 0x2A, 0xFC,
+    0xA7, 0x40, 0x2A, 0xE9, 0x39, 0xFE, 0x2F, 0xAE, 0xA0, 0x9E, 0x2E, 0x09, 0xE2, 0xAD, 0x99, 0xE2,
+    0xE9, 0x0F, 0xAF, 0x90, 0x9F, 0xAE, 0x92, 0x99, 0x1E, 0x6A, 0xE2, 0x99, 0x9F, 0x91, 0x9F, 0xD9,
+    0x29, 0xFA, 0x97, 0x50, 0x2A, 0xA9, 0x5D, 0x95, 0xD9, 0x29, 0x99, 0xDA, 0x99, 0x0F, 0xF9, 0xAA,
+    0xAD, 0xAA, 0xA3, 0xD9, 0x5D, 0x95, 0xAC, 0x92, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xF9, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x70, 0xFF, 0x9F, 0xF9, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xF9, 0x99, 0x99,
+    0x99, 0x99, 0x00, 0x29, 0x99, 0x19, 0xD9, 0x1E, 0x19, 0xD9, 0x1A, 0xD2, 0xE2, 0xDA, 0x2D, 0xA2,
+    0xD9, 0x2D, 0x92, 0xDA, 0x2D, 0xA2, 0xAD, 0x29, 0xD3, 0xDA, 0x2A, 0xD3, 0xAC, 0xA0, 0x99, 0x92,
+    0x9D, 0x92, 0xAD, 0x29, 0xD9, 0x2D, 0xA2, 0xAD, 0x2A, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD2,
+    0xAD, 0x2E, 0x2D, 0x91, 0xAD, 0x2D, 0xA1, 0xAD, 0x20, 0x71, 0xAC, 0xA0, 0xFA, 0x0A, 0xFF, 0xAA,
+    0xE1, 0x9E, 0xAD, 0x92, 0xEA, 0xD9, 0x2E, 0xAD, 0x92, 0xEA, 0xD9, 0x2E, 0xAD, 0x92, 0xEA, 0xD9,
+    0x2E, 0x9A, 0xA3, 0xAA, 0xA0, 0x2A, 0xEA, 0x4F, 0xE2, 0xAF, 0xEA, 0x1F, 0x0A, 0xE0, 0x9E, 0x90,
+    0x9E, 0x99, 0xE2, 0xE9, 0x9E, 0x2E, 0x99, 0xE2, 0xE9, 0x9E, 0x91, 0xE9, 0x0E, 0xA0, 0xAE, 0x1A,
+    0xFF, 0x2F, 0xE4, 0xFC, 0x75, 0x4A, 0xAA, 0x4F, 0x29, 0xFC, 0x1A, 0xFD, 0x1A, 0xD9, 0xE2, 0xA1,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE0, 0x19, 0xAE, 0xA2, 0xAF, 0xE1, 0xFF, 0x91, 0xC9,
+    0x1E, 0xA5, 0xEA, 0x49, 0xE5, 0xEA, 0x4E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA4, 0xFF, 0xC0, 0xFF, 0xC0,
+    0xFF, 0xC0, 0x19, 0xAE, 0xA3, 0xFF, 0x2A, 0xDA, 0xAE, 0xA2, 0x92, 0x9E, 0x69, 0xDA, 0x3A, 0xAF,
+    0x4F, 0xC9, 0x4A, 0xAA, 0xEA, 0x7E, 0x7E, 0x1D, 0xA9, 0xAF, 0x1F, 0xF9, 0x1A, 0xFD, 0x97, 0x40,
+    0x49, 0xAA, 0xA6, 0xF5, 0xFC, 0x49, 0xFC, 0x4D, 0x9E, 0x3D, 0xA0, 0xE2, 0x9D, 0x1E, 0x2D, 0x91,
+    0xE1, 0xAF, 0xFC, 0xAA, 0xFF, 0xD9, 0xAA, 0xAA, 0xAE, 0xA9, 0x5E, 0x7E, 0x10, 0x0A, 0xAA, 0xAA,
+    0xAA, 0x2F, 0xE9, 0x09, 0xFE, 0x90, 0x9D, 0x69, 0xD9, 0x5A, 0xFD, 0x91, 0x9F, 0xEA, 0x5A, 0xE6,
+    0xE6, 0xE0, 0xD9, 0x99, 0xF0, 0xFF, 0x90, 0x9F, 0xCA, 0x74, 0x39, 0xAE, 0x93, 0xFD, 0x92, 0xFC,
+    0xAA, 0x91, 0xAE, 0x6E, 0x7E, 0x9F, 0x19, 0xFF, 0xC0, 0x9E, 0x91, 0xE9, 0x9E, 0x2E, 0x90, 0xE2,
+    0xE9, 0x0E, 0xA9, 0xAE, 0x2F, 0xEA, 0x3A, 0xF9, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC,
+    0x90, 0xFF, 0xC9, 0x6E, 0x6A, 0xDA, 0x6E, 0x6A, 0xDA, 0x6E, 0x6A, 0xDA, 0x6E, 0x95, 0xAE, 0x6E,
+    0x95, 0xAE, 0x40, 0x2A, 0xEA, 0x39, 0xFE, 0x91, 0xEA, 0x9A, 0xE1, 0xE2, 0xE1, 0xAD, 0xA0, 0x9D,
+    0xA2, 0xFE, 0x3A, 0xFC, 0xA2, 0xAE, 0xAE, 0xA1, 0xE2, 0xE9, 0x9D, 0xA2, 0xAD, 0x90, 0xE9, 0x09,
+    0xE1, 0xAF, 0xEA, 0x2A, 0xFC, 0xA7, 0x40, 0x2A, 0xE9, 0x39, 0xFE, 0x2F, 0xAE, 0xA0, 0x9E, 0x2E,
+    0x09, 0xE2, 0xAD, 0x99, 0xE2, 0xE9, 0x0F, 0xAF, 0x90, 0x9F, 0xAE, 0x92, 0x99, 0x1E, 0x6A, 0xE2,
+    0x99, 0x9F, 0x91, 0x9F, 0xD9, 0x29, 0xFA, 0x97, 0x50, 0x2A, 0xA9, 0x5D, 0x95, 0xD9, 0x29, 0x99,
+    0xDA, 0x99, 0x0F, 0xF9, 0xAA, 0xAD, 0xAA, 0xA3, 0xD9, 0x5D, 0x95, 0xAC, 0x92, 0x99, 0x99, 0x99,
+    0x99, 0x0F, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x70, 0xFF, 0x9F, 0xF9, 0x70, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x9F, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x00, 0x29, 0x99, 0x19, 0xD9, 0x1E, 0x19, 0xD9, 0x1A,
+    0xD2, 0xE2, 0xDA, 0x2D, 0xA2, 0xD9, 0x2D, 0x92, 0xDA, 0x2D, 0xA2, 0xAD, 0x29, 0xD3, 0xDA, 0x2A,
+    0xD3, 0xAC, 0xA0, 0x99, 0x92, 0x9D, 0x92, 0xAD, 0x29, 0xD9, 0x2D, 0xA2, 0xAD, 0x2A, 0xD2, 0x9D,
+    0x29, 0xD2, 0x9D, 0x29, 0xD2, 0xAD, 0x2E, 0x2D, 0x91, 0xAD, 0x2D, 0xA1, 0xAD, 0x20, 0x19, 0xAF,
+    0x92, 0xFE, 0x91, 0x99, 0x2E, 0x6E, 0x1A, 0xFE, 0x0E, 0xA9, 0x9E, 0x0E, 0x2E, 0x0E, 0x19, 0xE0,
+    0xFF, 0xC1, 0xAE, 0x90, 0xD0, 0x29, 0xEA, 0x93, 0xFE, 0x91, 0xAD, 0xA1, 0xAD, 0x1E, 0x29, 0xD9,
+    0x0F, 0xFC, 0x90, 0xEA, 0xAA, 0xAA, 0xA9, 0x0E, 0x7A, 0xDA, 0x39, 0x2F, 0xF3, 0x9F, 0xA9, 0x00,
+    0x29, 0xEA, 0x93, 0xFE, 0xA1, 0xAD, 0xA1, 0xE9, 0x0E, 0x3E, 0x0E, 0x3E, 0x0E, 0x3E, 0x0E, 0x3E,
+    0x0A, 0xDA, 0x1A, 0xD9, 0x1F, 0xEA, 0x39, 0xF9, 0x10, 0x9D, 0xA2, 0xAD, 0x90, 0xE9, 0x09, 0xE2,
+    0xE0, 0xE3, 0x9F, 0xC9, 0x4A, 0xEA, 0x5F, 0xA4, 0xAF, 0xC9, 0x29, 0xE0, 0xE2, 0xE2, 0xE0, 0x9D,
+    0x92, 0x9D, 0x90, 0x1A, 0xFA, 0x3A, 0xFE, 0x29, 0x92, 0x9E, 0x7A, 0xD9, 0x0A, 0xAA, 0xAA, 0xAE,
+    0x90, 0xFF, 0xC9, 0x0D, 0xA2, 0xAD, 0x1E, 0x2E, 0x2F, 0xE9, 0x3A, 0xEA, 0x20, 0x9A, 0xA6, 0xAD,
+    0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x9A, 0xE9, 0x0A, 0xFF, 0x9A, 0xE9, 0x0A, 0xEA, 0xDA, 0x2E,
+    0xAD, 0x92, 0xEA, 0xD9, 0x2E, 0xAD, 0x92, 0xEA, 0xD9, 0x2E, 0xAD, 0x92, 0xE9, 0xD3, 0xAD, 0x9A,
+    0xA7, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x92, 0xAC, 0xA0, 0xAD, 0x91, 0xE9, 0x0A, 0xD9,
+    0x0E, 0x91, 0xAD, 0x9E, 0x92, 0xAF, 0xCA, 0x3A, 0xFD, 0x92, 0xAD, 0xA0, 0xE2, 0xAD, 0x90, 0x9E,
+    0x1A, 0xD9, 0x1A, 0xDA, 0x09, 0xD9, 0x2A, 0xD9, 0x9A, 0xA0, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9,
+    0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0x9D, 0x00, 0x9C, 0xA0,
+    0xAE, 0x90, 0x9E, 0xA1, 0xAF, 0xFF, 0xDA, 0x0A, 0xE9, 0x0A, 0xEA, 0x09, 0xE0, 0xAD, 0x91, 0x9E,
+    0x2E, 0x0A, 0xD9, 0x2D, 0xA2, 0xAD, 0x0A, 0xD9, 0x2D, 0xA2, 0xAD, 0x0A, 0xD9, 0x2D, 0xA2, 0xAD,
+    0x0A, 0xD9, 0x2D, 0xA2, 0xAD, 0x0A, 0xD9, 0x2D, 0xA2, 0xAD, 0x09, 0xD3, 0xDA, 0x2A, 0xD0, 0x9C,
+    0xA0, 0xAE, 0x90, 0xAF, 0xF9, 0xAE, 0x90, 0xAE, 0xAD, 0xA2, 0xEA, 0xD9, 0x2E, 0xAD, 0x92, 0xEA,
+    0xD9, 0x2E, 0xAD, 0x92, 0xEA, 0xD9, 0x2E, 0x9D, 0x3A, 0xD0, 0x9C, 0xA0, 0xAD, 0xA2, 0xAF, 0xF1,
+    0xAE, 0x90, 0xAD, 0xA0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0,
+    0xAE, 0x90, 0xAD, 0xA0, 0xAF, 0xF1, 0xAD, 0x9A, 0xDA, 0x2A, 0xD9, 0x6A, 0xD9, 0x6A, 0xD9, 0x6A,
+    0xD9, 0x60, 0x19, 0xFA, 0x1F, 0xE9, 0x0D, 0xA2, 0x91, 0xEA, 0x49, 0xFC, 0x4A, 0xF9, 0x4A, 0xDA,
+    0x0A, 0x92, 0xDA, 0x0F, 0xE9, 0x0A, 0xFA, 0x90, 0x19, 0xC9, 0x4A, 0xCA, 0x39, 0xFC, 0x9A, 0xFD,
+    0xA0, 0x9D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xE4, 0xFC, 0xA2, 0xAE, 0x90, 0x77, 0x4A,
+    0xFC, 0xA9, 0x7F, 0xFA, 0x6F, 0xFC, 0x95, 0xAF, 0xA9, 0x9A, 0xC6, 0xF9, 0x73, 0xF7, 0x39, 0xF1,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0x9E, 0xA1, 0xAF, 0xF0, 0x9E, 0xA1, 0xAF, 0xF0, 0x9F, 0x1A, 0xFF,
+    0x1F, 0x1A, 0xE9, 0x5F, 0xC9, 0xAE, 0x95, 0x9F, 0xFF, 0xCA, 0x29, 0xFF, 0xFA, 0x4A, 0xFF, 0xDA,
+    0x7A, 0xEA, 0x73, 0xAE, 0x97, 0x3A, 0xEA, 0x99, 0x99, 0x7A, 0xFF, 0x7A, 0xFF, 0x7A, 0xFF, 0x00,
+    0x77, 0x72, 0x9C, 0xA0, 0x9D, 0x72, 0xAC, 0x90, 0xAC, 0xA7, 0x0A, 0xFE, 0xA6, 0xFF, 0xF4, 0xFF,
+    0xFA, 0x3F, 0xF9, 0xAE, 0x92, 0xAF, 0xAA, 0xC9, 0x0A, 0xCA, 0x93, 0xFA, 0x0D, 0x1A, 0xC9, 0x3A,
+    0xF1, 0xD1, 0xD4, 0xFA, 0x09, 0xD1, 0xD4, 0xF9, 0x0A, 0xCA, 0x09, 0xCA, 0x4F, 0x90, 0xAC, 0x90,
+    0xAC, 0xA4, 0xF9, 0x0D, 0x1A, 0xC9, 0x4F, 0xA0, 0xD1, 0xD5, 0xAF, 0x9D, 0x1D, 0x59, 0xFD, 0xA0,
+    0x9C, 0xA6, 0xFD, 0x90, 0xAC, 0xA6, 0xAF, 0xCA, 0x9D, 0xA9, 0xAC, 0x4F, 0xFF, 0xC5, 0xAF, 0xFE,
+    0x6A, 0xFF, 0xCA, 0x6A, 0xC9, 0x9A, 0xCA, 0x97, 0x1D, 0x1D, 0x97, 0x2A, 0xA1, 0xAA, 0x60, 0x77,
+    0x49, 0xAF, 0xDA, 0x5F, 0xFE, 0x3F, 0xFE, 0xA2, 0xFD, 0xA9, 0x9A, 0xD2, 0xAF, 0xA5, 0x92, 0xFA,
+    0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x19, 0xAA, 0x1A, 0xD0, 0xF9, 0x1A, 0xD9, 0xF0, 0xF9, 0x1A,
+    0xFD, 0xA0, 0xF9, 0x1A, 0xFC, 0xA9, 0x0F, 0xA1, 0xAF, 0x3A, 0xEA, 0x1A, 0xE9, 0x3A, 0xF1, 0xAE,
+    0x93, 0x9F, 0x90, 0xAE, 0x94, 0xFC, 0x0A, 0xE9, 0x49, 0xFF, 0xCA, 0xAC, 0x92, 0xFF, 0xF9, 0x3F,
+    0xFE, 0x94, 0x9F, 0xFA, 0x71, 0x99, 0x50, 0x19, 0xFF, 0xF2, 0x9F, 0xFF, 0x29, 0xFF, 0xF2, 0x9F,
+    0xFF, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xF9, 0x99, 0x99, 0x99, 0x92, 0x9F,
+    0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F, 0xFE, 0xA2, 0x9F, 0x72, 0x9F, 0x71, 0x9A, 0xF9, 0x99, 0x94,
+    0xAF, 0xFD, 0x93, 0xAF, 0xFD, 0x94, 0x9A, 0xF9, 0x99, 0x96, 0x9F, 0x72, 0x9F, 0x72, 0x9F, 0x70,
+    0x77, 0x49, 0xFD, 0xA9, 0x5A, 0xFF, 0xC9, 0x39, 0xFF, 0xD4, 0xFC, 0xA9, 0xAD, 0xA4, 0xF9, 0x71,
+    0x9F, 0x72, 0x9F, 0x70, 0x9A, 0xAF, 0xAA, 0xAA, 0xA3, 0xFF, 0xF3, 0xFF, 0xF5, 0x9F, 0x70, 0x99,
+    0xAF, 0x99, 0x99, 0x93, 0xFF, 0xF3, 0xFF, 0xF5, 0x9F, 0x72, 0xAE, 0xA7, 0x19, 0xF7, 0x1A, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x77, 0x99, 0x77,
+    0x5E, 0x77, 0x49, 0xDA, 0x77, 0x4A, 0xD9, 0x6E, 0xA1, 0xAF, 0xC9, 0x0F, 0xF2, 0xF9, 0xFF, 0xFF,
+    0xD9, 0x0F, 0xFF, 0xFF, 0xF0, 0xFD, 0x99, 0x9F, 0xE9, 0x99, 0xFC, 0x0F, 0xC9, 0x29, 0xFC, 0x39,
+    0xF9, 0xFC, 0x4F, 0xC4, 0xF9, 0xFA, 0x4F, 0xA4, 0xF9, 0xFA, 0x4F, 0x94, 0xF9, 0xFA, 0x4F, 0x94,
+    0xF9, 0xFA, 0x39, 0xF9, 0x4F, 0x9F, 0xA3, 0xFC, 0x94, 0xF9, 0xFA, 0x29, 0xFC, 0x94, 0xF9, 0xFA,
+    0x2F, 0xD9, 0x4F, 0x9F, 0xA1, 0x9F, 0xD9, 0x4F, 0x9F, 0xA1, 0xAF, 0xD9, 0x4F, 0x9F, 0xA1, 0xDA,
+    0xF9, 0x4F, 0x95, 0xAD, 0x97, 0x74, 0xE7, 0x74, 0xAD, 0x97, 0x77, 0x77, 0x00, 0x1F, 0xA3, 0x9D,
+    0xA3, 0xFC, 0x3A, 0xDA, 0x3F, 0xC9, 0x2A, 0xDA, 0x3F, 0xCA, 0x2A, 0xDA, 0x3F, 0xD2, 0xAD, 0xA3,
+    0xEA, 0xD2, 0xAD, 0xA3, 0xE9, 0xDA, 0x1A, 0xDA, 0x19, 0xAE, 0xAE, 0xAA, 0xFA, 0x0A, 0xFF, 0xFE,
+    0x99, 0xAE, 0xAA, 0xEA, 0xFA, 0x2E, 0x1D, 0xA0, 0x9D, 0xA1, 0x99, 0xE9, 0x9E, 0x9A, 0xE9, 0x0A,
+    0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x91, 0xE2, 0xE9, 0xDA, 0x3E, 0x2A, 0xDA, 0xDA, 0x3E, 0x29, 0xFC,
+    0xA3, 0xE3, 0xFC, 0xA3, 0xE3, 0xAF, 0xA3, 0xE3, 0x9F, 0xA3, 0xE4, 0xFA, 0x10, 0xAF, 0xDA, 0xA7,
+    0x5F, 0xFE, 0x73, 0xFF, 0xF7, 0x2F, 0xFF, 0xA7, 0x1F, 0x92, 0xFC, 0x71, 0xF9, 0x3F, 0x92, 0x99,
+    0x3F, 0x93, 0xF9, 0x1A, 0xD3, 0xF9, 0x3F, 0x91, 0xE3, 0xF9, 0x29, 0xF1, 0x9E, 0x3F, 0x91, 0x9F,
+    0xC0, 0xAF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xCA, 0x0F, 0xFC, 0xAF, 0xFD, 0x93, 0xF3, 0xFC, 0xAA,
+    0x96, 0xF3, 0xF9, 0x71, 0xF3, 0xF9, 0x71, 0xF3, 0xF9, 0x71, 0xF3, 0xF9, 0x71, 0xF9, 0x2F, 0x97,
+    0x1A, 0xFF, 0xE9, 0x71, 0x9F, 0xFE, 0x97, 0x29, 0xFC, 0xA7, 0x72, 0x92, 0xAF, 0xDA, 0x97, 0x6F,
+    0xFD, 0x97, 0x4F, 0xFE, 0x97, 0x3F, 0xFF, 0x73, 0xF9, 0x1A, 0xF7, 0x3F, 0x92, 0xF9, 0x19, 0xFD,
+    0xA0, 0xF9, 0x2F, 0x90, 0x9F, 0xF9, 0xF9, 0x2F, 0x1F, 0xFC, 0x0F, 0x91, 0x9F, 0x1F, 0x2A, 0xA0,
+    0xFA, 0xAA, 0xFA, 0x09, 0xEA, 0x5F, 0xFD, 0xA2, 0xFA, 0x4F, 0xFC, 0xA3, 0xFD, 0x92, 0xFF, 0xCA,
+    0x4F, 0xDA, 0x1F, 0x90, 0xF5, 0xAF, 0xD0, 0xF9, 0x0F, 0xA5, 0x9F, 0xCA, 0xF9, 0x09, 0xF7, 0xAF,
+    0xF9, 0x1F, 0x97, 0xFF, 0x91, 0xAF, 0x09, 0xA9, 0x29, 0xEA, 0xF9, 0x2F, 0x99, 0xFF, 0xC9, 0xF9,
+    0x2A, 0xF9, 0xFF, 0xC0, 0xF9, 0x3F, 0x9A, 0xFD, 0xA7, 0x72, 0x99, 0x40, 0x9E, 0x4E, 0xA3, 0x9D,
+    0xA1, 0xE3, 0x9F, 0x3A, 0xDA, 0x1E, 0x92, 0xAF, 0x3E, 0xA1, 0xE9, 0x2A, 0xF3, 0xE9, 0x1E, 0xA2,
+    0xFC, 0x92, 0xE2, 0xAD, 0xA2, 0xDA, 0xDA, 0x19, 0xE2, 0x9E, 0x2D, 0x9D, 0xA1, 0x9E, 0x29, 0xE1,
+    0x9D, 0x9E, 0x1A, 0xDA, 0x3E, 0x19, 0xD0, 0xAD, 0x1A, 0xDA, 0x19, 0xAE, 0xAA, 0xEA, 0xEA, 0xAE,
+    0xAA, 0x0A, 0xFF, 0xFF, 0xF0, 0x9A, 0xFA, 0xEA, 0xAE, 0xAE, 0xAA, 0x29, 0xDA, 0x0D, 0xA1, 0xDA,
+    0x0E, 0x49, 0xE9, 0xD9, 0x1E, 0x9E, 0x5E, 0x9D, 0x91, 0xE9, 0xDA, 0x5E, 0xAD, 0x2A, 0xDA, 0xD9,
+    0x5F, 0xD2, 0x9F, 0xC6, 0xAF, 0xC2, 0x9F, 0xC6, 0x9F, 0xA3, 0xFC, 0x69, 0xF9, 0x3F, 0xA7, 0xF9,
+    0x3A, 0xEA, 0x30, 0x9F, 0xFC, 0xAA, 0x59, 0xE9, 0xAF, 0xFF, 0xA3, 0x9E, 0x9A, 0xFF, 0xFD, 0x29,
+    0xE9, 0xAE, 0xA9, 0x99, 0x99, 0xAF, 0x91, 0x9E, 0x9A, 0xE9, 0x59, 0xF1, 0x9E, 0x9A, 0xE9, 0x09,
+    0xAA, 0xA1, 0xF1, 0x9E, 0x9A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE1, 0x9E, 0x9A, 0xE9, 0x0A, 0xE9, 0x0A,
+    0xE9, 0x09, 0xE9, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0x9E, 0x9A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9,
+    0x09, 0xE9, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0x9E, 0x9A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9, 0x09,
+    0xE9, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0x9E, 0x9A, 0xE9, 0x0A, 0xE9, 0x0A, 0xE9, 0x09, 0xE9,
+    0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x90, 0xAE, 0x9A, 0xE9, 0x0A, 0xE9, 0x09, 0xAA, 0xA1, 0xF0, 0xAE,
+    0x90, 0xAE, 0x95, 0x9F, 0x0A, 0xE9, 0x0A, 0xE9, 0x4A, 0xF9, 0x0A, 0xE9, 0x0A, 0xFF, 0xFD, 0x1A,
+    0xE9, 0x0A, 0xFF, 0xFC, 0x2A, 0xE9, 0x0A, 0xFF, 0xDA, 0x93, 0x77, 0x74, 0xF9, 0x74, 0xF9, 0x79,
+    0xFF, 0xD9, 0x5A, 0xFF, 0xDA, 0x5A, 0xFF, 0xDA, 0x72, 0xF9, 0x79, 0x3F, 0x94, 0xAF, 0xCA, 0x0F,
+    0x93, 0xFF, 0xAF, 0x92, 0xAF, 0xFF, 0xC9, 0x2F, 0xCA, 0x99, 0xAF, 0xC9, 0x19, 0xFC, 0x3A, 0xF9,
+    0x19, 0xF9, 0x4F, 0x91, 0xAF, 0x5F, 0x91, 0xAF, 0x5F, 0x91, 0xAF, 0x94, 0xF9, 0x19, 0xF9, 0x4F,
+    0x91, 0x9F, 0xC3, 0x9F, 0x92, 0xFC, 0xA9, 0x99, 0xFC, 0x92, 0xAF, 0xFF, 0xC9, 0x3F, 0xF9, 0xF9,
+    0x4A, 0xFC, 0x1A, 0xE9, 0x79, 0x77, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0xAF, 0xFE, 0x94,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0x7A, 0xFC, 0xA7, 0xAF, 0xFC, 0x94, 0xFF, 0xE4, 0xAF,
+    0xCA, 0xAA, 0xD9, 0x4F, 0xA4, 0x94, 0xAF, 0x73, 0xF9, 0x71, 0xAA, 0xFA, 0xAA, 0xAA, 0x94, 0xFF,
+    0xF4, 0xFF, 0xF5, 0x9F, 0x72, 0x9A, 0xF9, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFE, 0x7F, 0x97, 0x3F,
+    0xA7, 0x39, 0xF9, 0x73, 0xFD, 0xA9, 0x9A, 0xCA, 0x5F, 0xFD, 0xA6, 0xFF, 0xCA, 0x79, 0xFE, 0x97,
+    0x39, 0x93, 0x1F, 0x94, 0xF9, 0x1F, 0x93, 0xAF, 0x2F, 0x93, 0xF3, 0xF9, 0x2F, 0xA3, 0xF9, 0x19,
+    0xF4, 0xF9, 0x1F, 0x94, 0xF9, 0x0A, 0xEA, 0x5F, 0x90, 0xF6, 0xF9, 0xAE, 0x94, 0xAA, 0xFF, 0xCA,
+    0xAA, 0xA9, 0x0F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x2F, 0xCA, 0xF6, 0xFA, 0x0F, 0x95, 0xF9, 0x09,
+    0xF5, 0xF9, 0x1F, 0xA4, 0xF9, 0x19, 0xF4, 0xF9, 0x2F, 0xA3, 0xF9, 0x29, 0xF9, 0x2F, 0x93, 0xFC,
+    0x2F, 0x93, 0x9F, 0x90, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE6,
+    0xFA, 0x73, 0xFA, 0x0A, 0xA7, 0x0F, 0xF7, 0x0F, 0xE7, 0x1F, 0xCA, 0x72, 0xFA, 0x72, 0xFC, 0xA0,
+    0xA9, 0x5A, 0xFD, 0xAE, 0x49, 0xDA, 0xFE, 0x95, 0xA9, 0x0F, 0xD7, 0x2F, 0xA7, 0x2A, 0xFA, 0x70,
+    0x9F, 0xDA, 0x79, 0xFE, 0xA7, 0x0C, 0xA0, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x50, 0x77, 0x76, 0xAF,
+    0xF9, 0x77, 0x09, 0xFF, 0xFA, 0x77, 0xFF, 0xFD, 0x76, 0x9D, 0xA9, 0x99, 0xAF, 0xDA, 0x77, 0x7F,
+    0xC9, 0x77, 0xF3, 0xFA, 0x77, 0xF3, 0x9F, 0x76, 0x9F, 0x4F, 0x76, 0xAE, 0xA4, 0xF9, 0x75, 0xF9,
+    0x4F, 0x97, 0x5F, 0x5F, 0x75, 0x9F, 0x49, 0xF2, 0x9A, 0xEA, 0x93, 0x9E, 0xA4, 0xAF, 0x1A, 0xFE,
+    0x92, 0xAE, 0xA4, 0xFA, 0x09, 0xFA, 0xF2, 0xF9, 0x3A, 0xF1, 0xEA, 0x2E, 0x91, 0xF3, 0x9F, 0xA0,
+    0x9E, 0x3E, 0xA0, 0x9F, 0x2A, 0xFC, 0x1A, 0xE3, 0xEA, 0x0A, 0xFA, 0xAF, 0xD9, 0x1F, 0x3E, 0x90,
+    0xFF, 0xF9, 0x2F, 0xA9, 0x9F, 0x1F, 0xFD, 0xA3, 0x9F, 0xFD, 0x91, 0xFE, 0xA9, 0x5A, 0xEA, 0xFC,
+    0x77, 0x2A, 0xE1, 0x99, 0x77, 0x4E, 0xA7, 0x77, 0x0E, 0xA7, 0x77, 0x9E, 0x97, 0x77, 0xAE, 0x77,
+    0x70, 0xF7, 0x77, 0x0E, 0xA7, 0x10, 0x77, 0x70, 0xAF, 0xA7, 0x09, 0xFF, 0x7F, 0xFC, 0xA5, 0x9F,
+    0x99, 0xF5, 0xAF, 0x1F, 0x5A, 0xEA, 0x1A, 0xE5, 0xAF, 0x1F, 0x59, 0xF1, 0xF6, 0xF9, 0x9E, 0x96,
+    0xAF, 0xAE, 0x70, 0xFE, 0xA7, 0x0A, 0xFD, 0x72, 0xFC, 0x96, 0xC2, 0xAF, 0x69, 0xCA, 0x1A, 0xFA,
+    0x5E, 0x09, 0xFD, 0x4A, 0xEA, 0xFE, 0xA3, 0xFE, 0xAA, 0xF2, 0xAD, 0xAF, 0x1F, 0x91, 0xE0, 0xAD,
+    0x91, 0xFA, 0x0A, 0xD9, 0x1C, 0xA2, 0x9F, 0x69, 0x4F, 0x74, 0xF7, 0x4F, 0x71, 0x99, 0xFC, 0x70,
+    0x9F, 0xDA, 0x70, 0x9F, 0xD7, 0x2F, 0xA2, 0x1F, 0xEA, 0xA7, 0xFF, 0xDA, 0x5F, 0xFF, 0x4F, 0x99,
+    0x9F, 0xC9, 0x29, 0xF9, 0x99, 0x9F, 0xC9, 0x0F, 0xFF, 0xFA, 0xAF, 0xFF, 0xE9, 0x1F, 0x4F, 0x19,
+    0x9F, 0x99, 0x99, 0x9F, 0x90, 0xFF, 0xFF, 0xAA, 0xFD, 0xAA, 0xAF, 0xCA, 0x91, 0xF2, 0x9F, 0x93,
+    0xFF, 0xF4, 0xFF, 0xE5, 0xFF, 0xCA, 0x6F, 0xA9, 0x97, 0x1F, 0x74, 0xF7, 0x4F, 0x74, 0xF7, 0x4F,
+    0x72, 0x77, 0x72, 0xE7, 0x4A, 0xFE, 0xA9, 0x5A, 0xFF, 0xEA, 0x3F, 0xFF, 0xC3, 0xFF, 0xCA, 0xF2,
+    0xFD, 0x9D, 0xA2, 0x99, 0x19, 0xFC, 0x1D, 0xA6, 0xAF, 0x2D, 0xA6, 0xFC, 0x2D, 0xA6, 0xF9, 0x2D,
+    0xA5, 0x9F, 0x92, 0xEA, 0xAA, 0xAA, 0xA9, 0xF9, 0x2F, 0xFC, 0x9F, 0x92, 0xFF, 0xC0, 0xF9, 0x2F,
+    0xFC, 0x0F, 0xA2, 0xDA, 0x0A, 0xF0, 0xFC, 0x2D, 0xA0, 0xAF, 0x0A, 0xF9, 0x1D, 0xA0, 0xAF, 0x1F,
+    0xC9, 0x0D, 0xA0, 0xAF, 0x1A, 0xFF, 0xCA, 0xFC, 0x2F, 0xFF, 0xE3, 0xAF, 0xFF, 0xC4, 0x9A, 0xFF,
+    0xA9, 0x71, 0xE7, 0x6D, 0xA7, 0x69, 0x96, 0x6F, 0xC7, 0x49, 0xFC, 0x97, 0x3A, 0xFC, 0xA7, 0x3F,
+    0xE7, 0x29, 0xFE, 0x97, 0x1F, 0x9E, 0xA7, 0x1F, 0x0F, 0x70, 0x9E, 0xA0, 0xAE, 0x93, 0xAF, 0xFF,
+    0xFC, 0xAA, 0xFF, 0xFF, 0xCA, 0x2A, 0xEA, 0x2A, 0xE9, 0x5F, 0x92, 0x9E, 0xA2, 0xAF, 0xFF, 0xFC,
+    0xAA, 0xFF, 0xFF, 0xCA, 0x99, 0xFA, 0x99, 0x99, 0x9A, 0xF9, 0x91, 0xF6, 0xF2, 0x9F, 0x6F, 0x91,
+    0xFA, 0x6A, 0xF1, 0xF7, 0x0F, 0x09, 0xF7, 0x0F, 0x9F, 0xA7, 0x0A, 0xF0, 0x77, 0x39, 0xAF, 0xDA,
+    0x6F, 0xFE, 0x94, 0xAF, 0xFE, 0x93, 0x9E, 0xAA, 0xAF, 0xD4, 0xA9, 0x4A, 0xF7, 0x4F, 0x73, 0x9F,
+    0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x0A, 0xFF, 0xFE, 0x99, 0xAA, 0xAA, 0xFF, 0xAA, 0xA4,
+    0xFF, 0x93, 0x99, 0x9F, 0xF9, 0x99, 0x99, 0x0A, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x90, 0x9F, 0x73,
+    0x9F, 0x73, 0x9F, 0x7A, 0x3F, 0xCA, 0x99, 0x9A, 0xE3, 0xAF, 0xFF, 0x4F, 0xFF, 0x59, 0xFF, 0xA7,
+    0x29, 0x96, 0x77, 0x71, 0xDA, 0x72, 0x9F, 0xE9, 0x59, 0xFF, 0xE9, 0x29, 0xFF, 0xF2, 0x9F, 0xFF,
+    0xA2, 0xFC, 0xA0, 0xDA, 0x1A, 0x91, 0x9F, 0xA1, 0xDA, 0x5A, 0xF2, 0xDA, 0x5F, 0xA2, 0xDA, 0x5F,
+    0x92, 0xDA, 0x49, 0xF9, 0x2D, 0xA4, 0x9F, 0x92, 0xDA, 0x49, 0xF9, 0x2D, 0xA5, 0xF9, 0x2D, 0xA5,
+    0xFA, 0x2D, 0xA5, 0xFC, 0x2D, 0xA5, 0xAF, 0x91, 0xDA, 0x6F, 0xC9, 0x0D, 0xA2, 0x92, 0xAF, 0xCA,
+    0xEA, 0xE3, 0xFF, 0xFC, 0x4A, 0xFF, 0xE5, 0x9F, 0xFA, 0x97, 0x1E, 0x75, 0xDA, 0x75, 0x99, 0x50,
+    0x49, 0x94, 0x99, 0x71, 0xE3, 0x9D, 0xA7, 0x9E, 0x3A, 0xDA, 0x7A, 0xE3, 0xEA, 0x6A, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xD1, 0x9A, 0xF9, 0x99, 0xFC, 0x99, 0x99, 0x29, 0xF2, 0xAE,
+    0xA6, 0x9F, 0x2A, 0xEA, 0x69, 0xF2, 0xAE, 0xA6, 0x9F, 0x2A, 0xEA, 0x69, 0xF2, 0xAE, 0xA6, 0x9F,
+    0x2A, 0xEA, 0x69, 0xF2, 0xAE, 0xA6, 0x9F, 0x2A, 0xF6, 0x9F, 0x29, 0xFA, 0x09, 0x92, 0x9F, 0x3F,
+    0xF9, 0x19, 0xF3, 0xAF, 0xE9, 0x19, 0xF4, 0xAF, 0xD7, 0x79, 0x30, 0x77, 0x76, 0xAF, 0xDA, 0x97,
+    0x19, 0xFF, 0xE7, 0x0F, 0xFE, 0xA7, 0xFD, 0xAA, 0xF7, 0x0F, 0xA4, 0x9A, 0x70, 0xF7, 0x70, 0xF9,
+    0x77, 0xFC, 0x97, 0x6A, 0xFD, 0x97, 0x5F, 0xF9, 0x74, 0xAF, 0xEA, 0x74, 0x9F, 0xF7, 0x59, 0xFD,
+    0xA7, 0x69, 0xFC, 0x19, 0xAA, 0x1A, 0xCA, 0x1A, 0xCA, 0x1F, 0x1F, 0xFF, 0xD0, 0xAE, 0x09, 0xC0,
+    0xE1, 0xDA, 0x1D, 0x0A, 0xE1, 0xFA, 0x1D, 0x91, 0xD9, 0xEA, 0x19, 0xF9, 0x0D, 0x91, 0xFD, 0x4F,
+    0xFF, 0xE9, 0x4A, 0xDA, 0xFF, 0xCA, 0x6A, 0xCA, 0x1D, 0xA9, 0x9D, 0x70, 0xAC, 0xA1, 0xD9, 0x1D,
+    0x71, 0x93, 0x92, 0x99, 0x50, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF,
+    0xE7, 0x77, 0x72, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9A, 0xAA, 0xAA, 0xFC,
+    0xAA, 0xAA, 0xA6, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA,
+    0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x73, 0xFA, 0x50, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x19, 0x99,
+    0xAF, 0xC9, 0x99, 0x96, 0xF9, 0x71, 0xAE, 0xA4, 0xFF, 0xFC, 0x1F, 0xFF, 0xC6, 0xAF, 0x70, 0x9F,
+    0x94, 0x99, 0x9A, 0xFC, 0x5F, 0xF6, 0xFD, 0x97, 0xAF, 0x72, 0xFA, 0x71, 0xAF, 0x72, 0xFC, 0x71,
+    0x9F, 0x97, 0x1F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC3, 0x2F, 0x73, 0xF7, 0x3F, 0x29,
+    0xA6, 0xFA, 0xAE, 0x6F, 0xFA, 0x49, 0xAF, 0xD9, 0x5F, 0xE9, 0x29, 0x3F, 0xE9, 0x9A, 0xD3, 0x91,
+    0xFF, 0xC5, 0x9F, 0xE9, 0x4A, 0xFD, 0xA7, 0xFE, 0x4F, 0xCA, 0x9F, 0x4F, 0x2F, 0x39, 0xEA, 0x2F,
+    0x3A, 0xE9, 0x2F, 0x3F, 0x3F, 0x2F, 0xA3, 0xFA, 0xAF, 0xC4, 0xFF, 0xD9, 0x4F, 0xFC, 0x95, 0xFE,
+    0x97, 0x19, 0x97, 0x00, 0x77, 0x71, 0xAE, 0xA7, 0x71, 0xDA, 0x9E, 0x77, 0x9C, 0x92, 0xD9, 0x76,
+    0xAC, 0x92, 0xDA, 0x76, 0xAD, 0x91, 0xE7, 0x69, 0xFF, 0xFF, 0xE9, 0x3F, 0xFF, 0xFF, 0xA3, 0xFF,
+    0xFF, 0xF9, 0x39, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0x6E, 0x72, 0xAD, 0x6E, 0x19, 0xC2,
+    0xA3, 0xD6, 0xE0, 0xAE, 0x9D, 0xA2, 0xD6, 0xFF, 0xFC, 0x9A, 0xD6, 0xFA, 0x09, 0xE9, 0xFC, 0x7E,
+    0xA2, 0x9A, 0x2A, 0xAA, 0x7F, 0xC7, 0x71, 0xDA, 0xF7, 0x70, 0x9A, 0x09, 0xFC, 0xAA, 0xAA, 0xD7,
+    0x4A, 0xFF, 0xD7, 0x5A, 0xFF, 0xC7, 0x69, 0xAF, 0xDA, 0x77, 0x74, 0x71, 0xEA, 0x77, 0x3F, 0x77,
+    0x3F, 0x77, 0x3F, 0x77, 0x3F, 0x77, 0x29, 0xF7, 0x69, 0xAF, 0xFD, 0xA7, 0x1F, 0xFF, 0xEA, 0x6F,
+    0xFF, 0xFD, 0x4F, 0xDA, 0xAF, 0x9A, 0xFC, 0xA2, 0x9F, 0x92, 0xF2, 0xAF, 0x2F, 0x93, 0xF3, 0xF9,
+    0x1F, 0x4F, 0x3A, 0xEA, 0x09, 0xF4, 0xF3, 0x9F, 0x09, 0xEA, 0x4F, 0x4F, 0x0A, 0xEA, 0x4F, 0x4F,
+    0x0A, 0xEA, 0x75, 0xF0, 0xAE, 0xA7, 0x5F, 0x0A, 0xEA, 0x75, 0xF0, 0xAE, 0xA7, 0x5F, 0x0A, 0xEA,
+    0x75, 0xF0, 0x19, 0xFF, 0xA9, 0x59, 0xFF, 0xEA, 0x39, 0xFF, 0xFC, 0x29, 0xFF, 0xFC, 0x91, 0x9F,
+    0x39, 0xFC, 0x19, 0xF4, 0xAF, 0x19, 0xF4, 0x9F, 0x19, 0xF4, 0xAF, 0x19, 0xF3, 0xAF, 0xAA, 0xFF,
+    0xFE, 0x0A, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xC9, 0x1A, 0xFF, 0xCA, 0xA9, 0x59, 0xF7, 0x39, 0xF7,
+    0x1A, 0xFF, 0xD9, 0x4A, 0xFF, 0xDA, 0x4A, 0xFF, 0xD9, 0x69, 0xF7, 0x39, 0xF7, 0x39, 0xF7, 0x10,
+    0x79, 0x90, 0x99, 0x97, 0x59, 0xD0, 0xAC, 0xA7, 0x5A, 0xDA, 0xDA, 0x73, 0xAF, 0xFC, 0xA7, 0x0F,
+    0xFF, 0xC9, 0x5F, 0xEA, 0xFE, 0x93, 0xFC, 0xAD, 0x0A, 0xFE, 0x29, 0xF9, 0x9D, 0x0A, 0xCA, 0x0F,
+    0x91, 0xFC, 0x09, 0xD0, 0xAC, 0xA0, 0xAF, 0x1F, 0x90, 0x9D, 0x0A, 0xCA, 0x09, 0xF0, 0x9F, 0x90,
+    0x9D, 0x0A, 0xCA, 0x1F, 0x99, 0xF1, 0x9D, 0x0A, 0xCA, 0x1F, 0x99, 0xF1, 0x9C, 0xA0, 0x9C, 0x91,
+    0xF9, 0x0F, 0x97, 0x7F, 0x97, 0x7A, 0xEA, 0x77, 0x9F, 0x77, 0x0A, 0xF7, 0x70, 0xAF, 0x97, 0x69,
+    0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xC9, 0x2F, 0xFF, 0xFC, 0x92, 0xFF, 0xFF, 0xC9,
+    0x00, 0x29, 0xC9, 0x09, 0xC9, 0x69, 0xCA, 0x09, 0xC9, 0x69, 0xCA, 0x09, 0xC9, 0x39, 0xFF, 0xA3,
+    0x9F, 0xFD, 0x91, 0x9F, 0xFE, 0x90, 0x9F, 0xFF, 0x09, 0xF2, 0xFC, 0x09, 0xF2, 0x9F, 0x09, 0xF2,
+    0x9F, 0x09, 0xF2, 0xAF, 0x09, 0xFA, 0xAF, 0xCA, 0x09, 0xFF, 0xDA, 0x19, 0xFF, 0xDA, 0x19, 0xFF,
+    0xF0, 0x9F, 0x2A, 0xF9, 0x9F, 0x3F, 0xA9, 0xF3, 0xFA, 0x9F, 0x3F, 0xA9, 0xF2, 0x9F, 0xA9, 0xFA,
+    0xAF, 0xD9, 0x9F, 0xFE, 0xA0, 0x9F, 0xFD, 0xA1, 0x9F, 0xFC, 0x95, 0x9C, 0xA0, 0x9C, 0x96, 0x9C,
+    0xA0, 0x9C, 0x96, 0x9C, 0x90, 0x9C, 0x93, 0x77, 0x1A, 0xFE, 0x93, 0xFF, 0xD2, 0xFF, 0xD9, 0x1F,
+    0xD9, 0x99, 0xAC, 0x2F, 0xA7, 0xAF, 0x70, 0xAF, 0x70, 0xFA, 0x70, 0xFA, 0x70, 0xAF, 0x70, 0xAF,
+    0x70, 0x9F, 0xA7, 0x0F, 0xCA, 0x99, 0x9A, 0xCA, 0x19, 0xFF, 0xDA, 0x29, 0xFF, 0xCA, 0x4A, 0xFD,
+    0xA7, 0x09, 0x97, 0x72, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF, 0x0A, 0xFF, 0xF7,
+    0x60, 0xAF, 0xFF, 0xC9, 0xAF, 0xFF, 0xCA, 0xAF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x00, 0x77, 0x77, 0x7C, 0x97, 0x77, 0xE9, 0x77, 0x5F, 0xC9, 0x77, 0x3F, 0xE9, 0x77, 0x1F,
+    0xFC, 0x97, 0x7E, 0xAA, 0x99, 0xAE, 0x97, 0x5D, 0x96, 0xE9, 0x73, 0xE7, 0x0E, 0x97, 0x1F, 0xA0,
+    0x9A, 0xCA, 0x2A, 0xE9, 0x7F, 0xFE, 0x29, 0xF9, 0x5F, 0xFF, 0x2A, 0xFC, 0x93, 0xFF, 0xF9, 0x2F,
+    0xE9, 0x1F, 0xFF, 0x92, 0xAF, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA0, 0x9F, 0xFC, 0xA2, 0xFF,
+    0xDA, 0x29, 0xFF, 0xA1, 0x9F, 0xFC, 0xA4, 0x9F, 0xEA, 0x1A, 0xFF, 0xA6, 0x9F, 0xFF, 0xFC, 0xA7,
+    0x09, 0xFF, 0xFE, 0xA7, 0x29, 0xF9, 0x19, 0xFC, 0xA7, 0x49, 0xE3, 0xFA, 0x76, 0x9D, 0x92, 0xEA,
+    0x77, 0x09, 0xD9, 0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x49, 0xEA, 0x77, 0x69, 0xCA, 0x77, 0x70,
+    0x97, 0x40,
 };
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 6, 22, 8, 1, 21, 33, 0 }, // !
-    { 12, 8, 14, 1, 21, 24, 33 }, // "
-    { 19, 21, 20, 0, 21, 100, 57 }, // #
-    { 15, 25, 17, 1, 23, 94, 157 }, // $
-    { 26, 23, 27, 0, 22, 150, 251 }, // %
-    { 21, 23, 23, 1, 22, 121, 401 }, // &
-    { 5, 8, 8, 1, 21, 10, 522 }, // '
-    { 9, 26, 11, 1, 21, 59, 532 }, // (
-    { 9, 26, 10, 0, 21, 59, 591 }, // )
-    { 15, 15, 16, 0, 23, 57, 650 }, // *
-    { 15, 15, 17, 1, 18, 57, 707 }, // +
-    { 7, 8, 8, 0, 4, 14, 764 }, // ,
-    { 9, 4, 10, 0, 10, 9, 778 }, // -
-    { 6, 6, 8, 1, 5, 9, 787 }, // .
-    { 12, 22, 13, 0, 21, 66, 796 }, // /
-    { 15, 23, 17, 1, 22, 87, 862 }, // 0
-    { 12, 21, 17, 1, 21, 63, 949 }, // 1
-    { 15, 22, 17, 1, 22, 83, 1012 }, // 2
-    { 15, 23, 17, 1, 22, 87, 1095 }, // 3
-    { 17, 21, 18, 0, 21, 90, 1182 }, // 4
-    { 15, 22, 17, 1, 21, 83, 1272 }, // 5
-    { 15, 23, 17, 1, 22, 87, 1355 }, // 6
-    { 16, 21, 17, 0, 21, 84, 1442 }, // 7
-    { 15, 23, 17, 1, 22, 87, 1526 }, // 8
-    { 16, 23, 17, 0, 22, 92, 1613 }, // 9
-    { 6, 18, 8, 1, 17, 27, 1705 }, // :
-    { 7, 21, 8, 0, 17, 37, 1732 }, // ;
-    { 15, 17, 17, 1, 19, 64, 1769 }, // <
-    { 15, 10, 17, 1, 15, 38, 1833 }, // =
-    { 15, 17, 17, 1, 19, 64, 1871 }, // >
-    { 14, 23, 15, 0, 22, 81, 1935 }, // ?
-    { 24, 24, 26, 1, 21, 144, 2016 }, // @
-    { 21, 21, 22, 0, 21, 111, 2160 }, // A
-    { 16, 21, 19, 2, 21, 84, 2271 }, // B
-    { 17, 23, 19, 1, 22, 98, 2355 }, // C
-    { 18, 21, 21, 2, 21, 95, 2453 }, // D
-    { 13, 21, 16, 2, 21, 69, 2548 }, // E
-    { 13, 21, 16, 2, 21, 69, 2617 }, // F
-    { 18, 23, 21, 1, 22, 104, 2686 }, // G
-    { 18, 21, 22, 2, 21, 95, 2790 }, // H
-    { 11, 21, 12, 0, 21, 58, 2885 }, // I
-    { 11, 28, 10, -3, 21, 77, 2943 }, // J
-    { 18, 21, 21, 2, 21, 95, 3020 }, // K
-    { 14, 21, 17, 2, 21, 74, 3115 }, // L
-    { 23, 21, 28, 2, 21, 121, 3189 }, // M
-    { 20, 21, 24, 2, 21, 105, 3310 }, // N
-    { 21, 23, 23, 1, 22, 121, 3415 }, // O
-    { 15, 21, 18, 2, 21, 79, 3536 }, // P
-    { 21, 27, 23, 1, 22, 142, 3615 }, // Q
-    { 18, 21, 21, 2, 21, 95, 3757 }, // R
-    { 14, 23, 16, 1, 22, 81, 3852 }, // S
-    { 17, 21, 18, 0, 21, 90, 3933 }, // T
-    { 18, 22, 22, 2, 21, 99, 4023 }, // U
-    { 19, 21, 20, 0, 21, 100, 4122 }, // V
-    { 29, 21, 30, 0, 21, 153, 4222 }, // W
-    { 20, 21, 21, 0, 21, 105, 4375 }, // X
-    { 19, 21, 20, 0, 21, 100, 4480 }, // Y
-    { 17, 21, 18, 0, 21, 90, 4580 }, // Z
-    { 7, 26, 10, 2, 21, 46, 4670 }, // [
-    { 12, 22, 13, 0, 21, 66, 4716 }, // <backslash>
-    { 8, 26, 10, 0, 21, 52, 4782 }, // ]
-    { 17, 14, 18, 0, 21, 60, 4834 }, // ^
-    { 14, 3, 14, -1, -2, 11, 4894 }, // _
-    { 9, 6, 11, 1, 23, 14, 4905 }, // `
-    { 15, 18, 17, 1, 17, 68, 4919 }, // a
-    { 16, 24, 19, 2, 23, 96, 4987 }, // b
-    { 14, 18, 16, 1, 17, 63, 5083 }, // c
-    { 16, 24, 18, 1, 23, 96, 5146 }, // d
-    { 16, 18, 18, 1, 17, 72, 5242 }, // e
-    { 13, 23, 14, 0, 23, 75, 5314 }, // f
-    { 16, 24, 18, 1, 17, 96, 5389 }, // g
-    { 15, 23, 19, 2, 23, 87, 5485 }, // h
-    { 6, 23, 9, 1, 23, 35, 5572 }, // i
-    { 9, 30, 9, -2, 23, 68, 5607 }, // j
-    { 17, 23, 20, 2, 23, 98, 5675 }, // k
-    { 5, 23, 9, 2, 23, 29, 5773 }, // l
-    { 25, 17, 28, 2, 17, 107, 5802 }, // m
-    { 15, 17, 19, 2, 17, 64, 5909 }, // n
-    { 16, 18, 18, 1, 17, 72, 5973 }, // o
-    { 16, 24, 19, 2, 17, 96, 6045 }, // p
-    { 16, 24, 18, 1, 17, 96, 6141 }, // q
-    { 11, 17, 14, 2, 17, 47, 6237 }, // r
-    { 13, 18, 15, 1, 17, 59, 6284 }, // s
-    { 12, 21, 13, 0, 20, 63, 6343 }, // t
-    { 15, 17, 19, 2, 16, 64, 6406 }, // u
-    { 17, 16, 18, 0, 16, 68, 6470 }, // v
-    { 25, 16, 26, 0, 16, 100, 6538 }, // w
-    { 17, 16, 18, 0, 16, 68, 6638 }, // x
-    { 17, 23, 18, 0, 16, 98, 6706 }, // y
-    { 14, 16, 15, 0, 16, 56, 6804 }, // z
-    { 11, 26, 12, 0, 21, 72, 6860 }, // {
-    { 4, 30, 16, 6, 23, 30, 6932 }, // |
-    { 11, 26, 13, 1, 21, 72, 6962 }, // }
-    { 15, 6, 17, 1, 13, 23, 7034 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7057 }, //  
-    { 6, 22, 8, 1, 16, 33, 7057 }, // ¡
-    { 13, 23, 17, 2, 22, 75, 7090 }, // ¢
-    { 16, 22, 18, 1, 22, 88, 7165 }, // £
-    { 14, 14, 17, 1, 17, 49, 7253 }, // ¤
-    { 17, 21, 18, 0, 21, 90, 7302 }, // ¥
-    { 4, 30, 16, 6, 23, 30, 7392 }, // ¦
-    { 12, 24, 14, 1, 23, 72, 7422 }, // §
-    { 11, 4, 17, 3, 22, 11, 7494 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 7505 }, // ©
-    { 10, 12, 11, 0, 22, 30, 7632 }, // ª
-    { 16, 14, 18, 1, 15, 56, 7662 }, // «
-    { 15, 9, 17, 1, 12, 34, 7718 }, // ¬
-    { 9, 4, 10, 0, 10, 9, 7752 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7761 }, // ®
-    { 16, 4, 16, -1, 26, 16, 7888 }, // ¯
-    { 11, 11, 13, 1, 22, 31, 7904 }, // °
-    { 15, 19, 17, 1, 19, 72, 7935 }, // ±
-    { 10, 13, 11, 0, 25, 33, 8007 }, // ²
-    { 11, 14, 12, 0, 25, 39, 8040 }, // ³
-    { 9, 6, 11, 1, 23, 14, 8079 }, // ´
-    { 15, 23, 19, 2, 16, 87, 8093 }, // µ
-    { 16, 27, 19, 1, 23, 108, 8180 }, // ¶
-    { 6, 6, 8, 1, 13, 9, 8288 }, // ·
-    { 8, 7, 9, 0, 0, 14, 8297 }, // ¸
-    { 9, 13, 11, 0, 25, 30, 8311 }, // ¹
-    { 11, 12, 12, 0, 22, 33, 8341 }, // º
-    { 16, 14, 18, 1, 15, 56, 8374 }, // »
-    { 24, 21, 25, 0, 21, 126, 8430 }, // ¼
-    { 25, 21, 26, 0, 21, 132, 8556 }, // ½
-    { 24, 22, 26, 1, 22, 132, 8688 }, // ¾
-    { 14, 23, 15, 0, 17, 81, 8820 }, // ¿
-    { 21, 28, 22, 0, 28, 147, 8901 }, // À
-    { 21, 28, 22, 0, 28, 147, 9048 }, // Á
-    { 21, 28, 22, 0, 28, 147, 9195 }, // Â
-    { 21, 28, 22, 0, 28, 147, 9342 }, // Ã
-    { 21, 27, 22, 0, 27, 142, 9489 }, // Ä
-    { 21, 26, 22, 0, 26, 137, 9631 }, // Å
-    { 27, 21, 28, 0, 21, 142, 9768 }, // Æ
-    { 17, 29, 19, 1, 22, 124, 9910 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 10034 }, // È
-    { 13, 28, 16, 2, 28, 91, 10125 }, // É
-    { 13, 28, 16, 2, 28, 91, 10216 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 10307 }, // Ë
-    { 11, 28, 12, 0, 28, 77, 10395 }, // Ì
-    { 11, 28, 12, 0, 28, 77, 10472 }, // Í
-    { 13, 28, 13, -1, 28, 91, 10549 }, // Î
-    { 11, 27, 12, 0, 27, 75, 10640 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 10715 }, // Ð
-    { 20, 28, 24, 2, 28, 140, 10820 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 10960 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 11113 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 11266 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 11419 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 11572 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 11719 }, // ×
-    { 21, 24, 23, 1, 22, 126, 11768 }, // Ø
-    { 18, 29, 22, 2, 28, 131, 11894 }, // Ù
-    { 18, 29, 22, 2, 28, 131, 12025 }, // Ú
-    { 18, 29, 22, 2, 28, 131, 12156 }, // Û
-    { 18, 28, 22, 2, 27, 126, 12287 }, // Ü
-    { 19, 28, 20, 0, 28, 133, 12413 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 12546 }, // Þ
-    { 18, 24, 21, 2, 23, 108, 12625 }, // ß
-    { 15, 24, 17, 1, 23, 90, 12733 }, // à
-    { 15, 24, 17, 1, 23, 90, 12823 }, // á
-    { 15, 24, 17, 1, 23, 90, 12913 }, // â
-    { 15, 24, 17, 1, 23, 90, 13003 }, // ã
-    { 15, 23, 17, 1, 22, 87, 13093 }, // ä
-    { 15, 26, 17, 1, 25, 98, 13180 }, // å
-    { 25, 18, 27, 1, 17, 113, 13278 }, // æ
-    { 14, 24, 16, 1, 17, 84, 13391 }, // ç
-    { 16, 24, 18, 1, 23, 96, 13475 }, // è
-    { 16, 24, 18, 1, 23, 96, 13571 }, // é
-    { 16, 24, 18, 1, 23, 96, 13667 }, // ê
-    { 16, 23, 18, 1, 22, 92, 13763 }, // ë
-    { 10, 23, 10, -1, 23, 58, 13855 }, // ì
-    { 9, 23, 12, 2, 23, 52, 13913 }, // í
-    { 13, 23, 12, -2, 23, 75, 13965 }, // î
-    { 11, 22, 11, -1, 22, 61, 14040 }, // ï
-    { 16, 24, 18, 1, 23, 96, 14101 }, // ð
-    { 15, 23, 19, 2, 23, 87, 14197 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 14284 }, // ò
-    { 16, 24, 18, 1, 23, 96, 14380 }, // ó
-    { 16, 24, 18, 1, 23, 96, 14476 }, // ô
-    { 16, 24, 18, 1, 23, 96, 14572 }, // õ
-    { 16, 23, 18, 1, 22, 92, 14668 }, // ö
-    { 15, 15, 17, 1, 18, 57, 14760 }, // ÷
-    { 16, 19, 18, 1, 17, 76, 14817 }, // ø
-    { 15, 24, 19, 2, 23, 90, 14893 }, // ù
-    { 15, 24, 19, 2, 23, 90, 14983 }, // ú
-    { 15, 24, 19, 2, 23, 90, 15073 }, // û
-    { 15, 23, 19, 2, 22, 87, 15163 }, // ü
-    { 17, 30, 18, 0, 23, 128, 15250 }, // ý
-    { 16, 30, 19, 2, 23, 120, 15378 }, // þ
-    { 17, 29, 18, 0, 22, 124, 15498 }, // ÿ
-    { 21, 26, 22, 0, 26, 137, 15622 }, // Ā
-    { 15, 22, 17, 1, 21, 83, 15759 }, // ā
-    { 21, 28, 22, 0, 28, 147, 15842 }, // Ă
-    { 15, 24, 17, 1, 23, 90, 15989 }, // ă
-    { 21, 28, 22, 0, 21, 147, 16079 }, // Ą
-    { 15, 24, 17, 1, 17, 90, 16226 }, // ą
-    { 17, 29, 19, 1, 28, 124, 16316 }, // Ć
-    { 14, 24, 16, 1, 23, 84, 16440 }, // ć
-    { 17, 29, 19, 1, 28, 124, 16524 }, // Ĉ
-    { 14, 24, 16, 1, 23, 84, 16648 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 16732 }, // Ċ
-    { 14, 24, 16, 1, 23, 84, 16856 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 16940 }, // Č
-    { 14, 24, 16, 1, 23, 84, 17064 }, // č
-    { 18, 28, 21, 2, 28, 126, 17148 }, // Ď
-    { 22, 24, 24, 1, 23, 132, 17274 }, // ď
-    { 20, 21, 21, 0, 21, 105, 17406 }, // Đ
-    { 18, 24, 20, 1, 23, 108, 17511 }, // đ
-    { 13, 26, 16, 2, 26, 85, 17619 }, // Ē
-    { 16, 22, 18, 1, 21, 88, 17704 }, // ē
-    { 13, 28, 16, 2, 28, 91, 17792 }, // Ĕ
-    { 16, 24, 18, 1, 23, 96, 17883 }, // ĕ
-    { 13, 28, 16, 2, 28, 91, 17979 }, // Ė
-    { 16, 24, 18, 1, 23, 96, 18070 }, // ė
-    { 13, 28, 16, 2, 21, 91, 18166 }, // Ę
-    { 16, 24, 18, 1, 17, 96, 18257 }, // ę
-    { 14, 28, 17, 2, 28, 98, 18353 }, // Ě
-    { 16, 24, 18, 1, 23, 96, 18451 }, // ě
-    { 18, 29, 21, 1, 28, 131, 18547 }, // Ĝ
-    { 16, 30, 18, 1, 23, 120, 18678 }, // ĝ
-    { 18, 29, 21, 1, 28, 131, 18798 }, // Ğ
-    { 16, 30, 18, 1, 23, 120, 18929 }, // ğ
-    { 18, 29, 21, 1, 28, 131, 19049 }, // Ġ
-    { 16, 30, 18, 1, 23, 120, 19180 }, // ġ
-    { 18, 29, 21, 1, 22, 131, 19300 }, // Ģ
-    { 16, 30, 18, 1, 23, 120, 19431 }, // ģ
-    { 18, 28, 22, 2, 28, 126, 19551 }, // Ĥ
-    { 19, 29, 19, -2, 29, 138, 19677 }, // ĥ
-    { 23, 21, 24, 0, 21, 121, 19815 }, // Ħ
-    { 17, 23, 19, 0, 23, 98, 19936 }, // ħ
-    { 12, 28, 12, -1, 28, 84, 20034 }, // Ĩ
-    { 13, 23, 12, -2, 23, 75, 20118 }, // ĩ
-    { 11, 26, 12, 0, 26, 72, 20193 }, // Ī
-    { 11, 21, 11, -1, 21, 58, 20265 }, // ī
-    { 12, 28, 13, 0, 28, 84, 20323 }, // Ĭ
-    { 12, 23, 12, -1, 23, 69, 20407 }, // ĭ
-    { 11, 28, 12, 0, 21, 77, 20476 }, // Į
-    { 6, 30, 9, 1, 23, 45, 20553 }, // į
-    { 11, 28, 12, 0, 28, 77, 20598 }, // İ
-    { 5, 16, 9, 2, 16, 20, 20675 }, // ı
-    { 19, 28, 21, 0, 21, 133, 20695 }, // Ĳ
-    { 15, 30, 18, 1, 23, 113, 20828 }, // ĳ
-    { 14, 35, 12, -3, 28, 123, 20941 }, // Ĵ
-    { 13, 30, 12, -2, 23, 98, 21064 }, // ĵ
-    { 18, 28, 21, 2, 21, 126, 21162 }, // Ķ
-    { 17, 30, 20, 2, 23, 128, 21288 }, // ķ
-    { 17, 16, 20, 2, 16, 68, 21416 }, // ĸ
-    { 14, 28, 17, 2, 28, 98, 21484 }, // Ĺ
-    { 10, 29, 12, 1, 29, 73, 21582 }, // ĺ
-    { 14, 28, 17, 2, 21, 98, 21655 }, // Ļ
-    { 6, 30, 9, 1, 23, 45, 21753 }, // ļ
-    { 15, 21, 18, 2, 21, 79, 21798 }, // Ľ
-    { 11, 23, 14, 2, 23, 64, 21877 }, // ľ
-    { 14, 21, 17, 2, 21, 74, 21941 }, // Ŀ
-    { 11, 23, 14, 2, 23, 64, 22015 }, // ŀ
-    { 16, 21, 17, 0, 21, 84, 22079 }, // Ł
-    { 11, 23, 11, -1, 23, 64, 22163 }, // ł
-    { 20, 28, 24, 2, 28, 140, 22227 }, // Ń
-    { 15, 23, 19, 2, 23, 87, 22367 }, // ń
-    { 20, 28, 24, 2, 21, 140, 22454 }, // Ņ
-    { 15, 24, 19, 2, 17, 90, 22594 }, // ņ
-    { 20, 28, 24, 2, 28, 140, 22684 }, // Ň
-    { 15, 23, 19, 2, 23, 87, 22824 }, // ň
-    { 22, 21, 23, -1, 21, 116, 22911 }, // ŉ
-    { 20, 28, 24, 2, 21, 140, 23027 }, // Ŋ
-    { 15, 24, 19, 2, 17, 90, 23167 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 23257 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 23399 }, // ō
-    { 21, 29, 23, 1, 28, 153, 23487 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 23640 }, // ŏ
-    { 21, 29, 23, 1, 28, 153, 23736 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 23889 }, // ő
-    { 26, 23, 28, 1, 22, 150, 23985 }, // Œ
-    { 27, 18, 29, 1, 17, 122, 24135 }, // œ
-    { 18, 28, 21, 2, 28, 126, 24257 }, // Ŕ
-    { 12, 23, 15, 2, 23, 69, 24383 }, // ŕ
-    { 18, 28, 21, 2, 21, 126, 24452 }, // Ŗ
-    { 12, 24, 14, 1, 17, 72, 24578 }, // ŗ
-    { 18, 28, 21, 2, 28, 126, 24650 }, // Ř
-    { 13, 23, 15, 1, 23, 75, 24776 }, // ř
-    { 14, 29, 16, 1, 28, 102, 24851 }, // Ś
-    { 13, 24, 15, 1, 23, 78, 24953 }, // ś
-    { 14, 29, 16, 1, 28, 102, 25031 }, // Ŝ
-    { 13, 24, 15, 1, 23, 78, 25133 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 25211 }, // Ş
-    { 13, 24, 15, 1, 17, 78, 25313 }, // ş
-    { 14, 29, 16, 1, 28, 102, 25391 }, // Š
-    { 13, 24, 15, 1, 23, 78, 25493 }, // š
-    { 17, 28, 18, 0, 21, 119, 25571 }, // Ţ
-    { 12, 27, 13, 0, 20, 81, 25690 }, // ţ
-    { 17, 28, 18, 0, 28, 119, 25771 }, // Ť
-    { 17, 24, 18, 0, 23, 102, 25890 }, // ť
-    { 17, 21, 18, 0, 21, 90, 25992 }, // Ŧ
-    { 12, 21, 13, 0, 20, 63, 26082 }, // ŧ
-    { 18, 29, 22, 2, 28, 131, 26145 }, // Ũ
-    { 15, 24, 19, 2, 23, 90, 26276 }, // ũ
-    { 18, 27, 22, 2, 26, 122, 26366 }, // Ū
-    { 15, 22, 19, 2, 21, 83, 26488 }, // ū
-    { 18, 29, 22, 2, 28, 131, 26571 }, // Ŭ
-    { 15, 24, 19, 2, 23, 90, 26702 }, // ŭ
-    { 18, 31, 22, 2, 30, 140, 26792 }, // Ů
-    { 15, 26, 19, 2, 25, 98, 26932 }, // ů
-    { 18, 29, 22, 2, 28, 131, 27030 }, // Ű
-    { 15, 24, 19, 2, 23, 90, 27161 }, // ű
-    { 18, 28, 22, 2, 21, 126, 27251 }, // Ų
-    { 15, 23, 19, 2, 16, 87, 27377 }, // ų
-    { 29, 28, 30, 0, 28, 203, 27464 }, // Ŵ
-    { 25, 23, 26, 0, 23, 144, 27667 }, // ŵ
-    { 19, 28, 20, 0, 28, 133, 27811 }, // Ŷ
-    { 17, 30, 18, 0, 23, 128, 27944 }, // ŷ
-    { 19, 27, 20, 0, 27, 129, 28072 }, // Ÿ
-    { 17, 28, 18, 0, 28, 119, 28201 }, // Ź
-    { 14, 23, 15, 0, 23, 81, 28320 }, // ź
-    { 17, 28, 18, 0, 28, 119, 28401 }, // Ż
-    { 14, 23, 15, 0, 23, 81, 28520 }, // ż
-    { 17, 28, 18, 0, 28, 119, 28601 }, // Ž
-    { 14, 23, 15, 0, 23, 81, 28720 }, // ž
-    { 10, 23, 13, 2, 23, 58, 28801 }, // ſ
-    { 24, 24, 26, 1, 23, 144, 28859 }, // Ơ
-    { 20, 20, 22, 1, 19, 100, 29003 }, // ơ
-    { 30, 23, 33, 1, 22, 173, 29103 }, // Ƣ
-    { 24, 24, 27, 1, 17, 144, 29276 }, // ƣ
-    { 21, 21, 22, 0, 21, 111, 29420 }, // Ƥ
-    { 16, 30, 19, 2, 23, 120, 29531 }, // ƥ
-    { 18, 24, 21, 2, 21, 108, 29651 }, // Ʀ
-    { 14, 23, 16, 1, 22, 81, 29759 }, // Ƨ
-    { 13, 18, 15, 1, 17, 59, 29840 }, // ƨ
-    { 17, 21, 18, 0, 21, 90, 29899 }, // Ʃ
-    { 15, 30, 15, -1, 23, 113, 29989 }, // ƪ
-    { 12, 27, 13, 0, 20, 81, 30102 }, // ƫ
-    { 18, 21, 19, 0, 21, 95, 30183 }, // Ƭ
-    { 12, 24, 13, 0, 23, 72, 30278 }, // ƭ
-    { 17, 28, 18, 0, 21, 119, 30350 }, // Ʈ
-    { 25, 24, 28, 2, 23, 150, 30469 }, // Ư
-    { 22, 20, 25, 2, 19, 110, 30619 }, // ư
-    { 9, 6, 0, -16, 23, 14, 30729 }, // ̀
-    { 9, 6, 0, -11, 23, 14, 30743 }, // ́
-    { 12, 6, 7, -6, 23, 18, 30757 }, // ̂
-    { 12, 6, 0, -16, 23, 18, 30775 }, // ̃
-    { 10, 4, 6, -5, 21, 10, 30793 }, // ̄
-    { 14, 4, 8, -7, 25, 14, 30803 }, // ̅
-    { 12, 6, 7, -6, 23, 18, 30817 }, // ̆
-    { 6, 6, 4, -3, 23, 9, 30835 }, // ̇
-    { 12, 4, 7, -6, 22, 12, 30844 }, // ̈
-    { 8, 8, 0, -13, 25, 16, 30856 }, // ̉
-    { 8, 8, 5, -4, 25, 16, 30872 }, // ̊
-    { 14, 6, 10, -5, 23, 21, 30888 }, // ̋
-    { 13, 6, 8, -6, 23, 20, 30909 }, // ̌
-    { 4, 6, 3, -2, 23, 6, 30929 }, // ̍
-    { 8, 6, 5, -4, 23, 12, 30935 }, // ̎
-    { 13, 6, 0, -17, 23, 20, 30947 }, // ̏
-    { 12, 8, 7, -6, 25, 24, 30967 }, // ̐
-    { 12, 6, 7, -6, 23, 18, 30991 }, // ̑
-    { 6, 8, 4, -3, 21, 12, 31009 }, // ̒
-    { 6, 8, 4, -3, 21, 12, 31021 }, // ̓
-    { 6, 8, 4, -3, 21, 12, 31033 }, // ̔
-    { 6, 8, 4, -3, 21, 12, 31045 }, // ̕
-    { 9, 6, 5, -5, -1, 14, 31057 }, // ̖
-    { 10, 6, 6, -5, -1, 15, 31071 }, // ̗
-    { 6, 7, 4, -3, 0, 11, 31086 }, // ̘
-    { 6, 7, 4, -3, 0, 11, 31097 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 31108 }, // ̚
-    { 8, 8, 6, -3, 23, 16, 31124 }, // ̛
-    { 4, 7, 3, -2, 0, 7, 31140 }, // ̜
-    { 8, 6, 5, -4, -1, 12, 31147 }, // ̝
-    { 8, 6, 5, -4, -1, 12, 31159 }, // ̞
-    { 8, 7, 5, -4, 0, 14, 31171 }, // ̟
-    { 7, 3, 4, -4, -3, 6, 31185 }, // ̠
-    { 7, 9, 1, -7, 2, 16, 31191 }, // ̡
-    { 7, 9, 8, 0, 2, 16, 31207 }, // ̢
-    { 6, 6, 0, -13, -1, 9, 31223 }, // ̣
-    { 12, 4, 7, -6, -2, 12, 31232 }, // ̤
-    { 8, 8, 5, -4, 1, 16, 31244 }, // ̥
-    { 6, 6, 4, -3, -1, 9, 31260 }, // ̦
-    { 8, 7, 5, -4, 0, 14, 31269 }, // ̧
-    { 6, 8, 4, -3, 1, 12, 31283 }, // ̨
-    { 4, 6, 3, -2, -1, 6, 31295 }, // ̩
-    { 12, 6, 7, -6, -1, 18, 31301 }, // ̪
-    { 12, 5, 7, -6, -1, 15, 31319 }, // ̫
-    { 13, 6, 8, -6, 0, 20, 31334 }, // ̬
-    { 12, 6, 7, -6, -1, 18, 31354 }, // ̭
-    { 12, 6, 7, -6, -1, 18, 31372 }, // ̮
-    { 12, 6, 7, -6, -1, 18, 31390 }, // ̯
-    { 12, 6, 7, -6, -1, 18, 31408 }, // ̰
-    { 10, 4, 6, -5, -2, 10, 31426 }, // ̱
-    { 14, 3, 8, -7, -2, 11, 31436 }, // ̲
-    { 13, 7, 7, -7, 0, 23, 31447 }, // ̳
-    { 13, 6, 8, -6, 11, 20, 31470 }, // ̴
-    { 14, 4, 8, -7, 10, 14, 31490 }, // ̵
-    { 22, 4, 12, -11, 10, 22, 31504 }, // ̶
-    { 12, 9, 7, -6, 13, 27, 31526 }, // ̷
-    { 14, 25, 8, -7, 23, 88, 31553 }, // ̸
-    { 4, 7, 3, -2, 0, 7, 31641 }, // ̹
-    { 12, 6, 7, -6, -1, 18, 31648 }, // ̺
-    { 12, 7, 7, -6, 0, 21, 31666 }, // ̻
-    { 12, 5, 7, -6, -1, 15, 31687 }, // ̼
-    { 6, 7, 4, -3, 23, 11, 31702 }, // ̽
-    { 4, 10, 3, -2, 26, 10, 31713 }, // ̾
-    { 13, 7, 7, -7, 29, 23, 31723 }, // ̿
-    { 9, 6, 3, -7, 23, 14, 31746 }, // ̀
-    { 9, 6, 8, -2, 23, 14, 31760 }, // ́
-    { 13, 6, 8, -6, 23, 20, 31774 }, // ͂
-    { 6, 6, 4, -3, 23, 9, 31794 }, // ̓
-    { 17, 6, 11, -7, 23, 26, 31803 }, // ̈́
-    { 7, 6, 6, -2, -1, 11, 31829 }, // ͅ
-    { 14, 6, 8, -7, 23, 21, 31840 }, // ͆
-    { 13, 7, 7, -7, 0, 23, 31861 }, // ͇
-    { 8, 6, 5, -4, -1, 12, 31884 }, // ͈
-    { 6, 6, 4, -3, -1, 9, 31896 }, // ͉
-    { 12, 7, 7, -6, 23, 21, 31905 }, // ͊
-    { 12, 12, 7, -6, 28, 36, 31926 }, // ͋
-    { 12, 9, 7, -6, 26, 27, 31962 }, // ͌
-    { 12, 6, 7, -6, -1, 18, 31989 }, // ͍
-    { 6, 7, 4, -3, 0, 11, 32007 }, // ͎
-    { 22, 21, 12, -11, 21, 116, 32018 }, // ͏
-    { 6, 7, 4, -3, 24, 11, 32134 }, // ͐
-    { 5, 8, 4, -2, 24, 10, 32145 }, // ͑
-    { 12, 8, 7, -6, 25, 24, 32155 }, // ͒
-    { 6, 7, 4, -3, 0, 11, 32179 }, // ͓
-    { 6, 6, 4, -3, -1, 9, 32190 }, // ͔
-    { 6, 6, 4, -3, -1, 9, 32199 }, // ͕
-    { 12, 6, 7, -6, -1, 18, 32208 }, // ͖
-    { 5, 8, 4, -2, 24, 10, 32226 }, // ͗
-    { 6, 6, 9, 2, 23, 9, 32236 }, // ͘
-    { 8, 6, 5, -4, -1, 12, 32245 }, // ͙
-    { 12, 7, 7, -6, 0, 21, 32257 }, // ͚
-    { 6, 6, 4, -3, 23, 9, 32278 }, // ͛
-    { 24, 6, 13, -12, -1, 36, 32287 }, // ͜
-    { 24, 6, 13, -12, 23, 36, 32323 }, // ͝
-    { 18, 3, 10, -9, 20, 14, 32359 }, // ͞
-    { 18, 3, 10, -9, -2, 14, 32373 }, // ͟
-    { 24, 6, 13, -12, 23, 36, 32387 }, // ͠
-    { 24, 7, 13, -12, 26, 42, 32423 }, // ͡
-    { 24, 7, 14, -11, 0, 42, 32465 }, // ͢
-    { 8, 8, 5, -4, 25, 16, 32507 }, // ͣ
-    { 7, 8, 5, -3, 25, 14, 32523 }, // ͤ
-    { 3, 9, 3, -1, 27, 7, 32537 }, // ͥ
-    { 8, 8, 5, -4, 25, 16, 32544 }, // ͦ
-    { 8, 8, 5, -4, 25, 16, 32560 }, // ͧ
-    { 7, 8, 5, -3, 25, 14, 32576 }, // ͨ
-    { 8, 10, 5, -4, 27, 20, 32590 }, // ͩ
-    { 7, 9, 5, -3, 27, 16, 32610 }, // ͪ
-    { 12, 7, 7, -6, 25, 21, 32626 }, // ͫ
-    { 6, 7, 5, -2, 25, 11, 32647 }, // ͬ
-    { 6, 9, 4, -3, 26, 14, 32658 }, // ͭ
-    { 9, 7, 6, -4, 25, 16, 32672 }, // ͮ
-    { 8, 7, 5, -4, 25, 14, 32688 }, // ͯ
-    { 21, 21, 22, 0, 21, 111, 32702 }, // Α
-    { 16, 21, 19, 2, 21, 84, 32813 }, // Β
-    { 12, 21, 15, 2, 21, 63, 32897 }, // Γ
-    { 20, 21, 21, 0, 21, 105, 32960 }, // Δ
-    { 13, 21, 16, 2, 21, 69, 33065 }, // Ε
-    { 17, 21, 18, 0, 21, 90, 33134 }, // Ζ
-    { 18, 21, 22, 2, 21, 95, 33224 }, // Η
-    { 21, 23, 23, 1, 22, 121, 33319 }, // Θ
-    { 11, 21, 12, 0, 21, 58, 33440 }, // Ι
-    { 18, 21, 21, 2, 21, 95, 33498 }, // Κ
-    { 20, 21, 21, 0, 21, 105, 33593 }, // Λ
-    { 23, 21, 28, 2, 21, 121, 33698 }, // Μ
-    { 20, 21, 24, 2, 21, 105, 33819 }, // Ν
-    { 16, 21, 18, 1, 21, 84, 33924 }, // Ξ
-    { 21, 23, 23, 1, 22, 121, 34008 }, // Ο
-    { 18, 21, 22, 2, 21, 95, 34129 }, // Π
-    { 15, 21, 18, 2, 21, 79, 34224 }, // Ρ
-    { 17, 21, 18, 0, 21, 90, 34303 }, // Σ
-    { 17, 21, 18, 0, 21, 90, 34393 }, // Τ
-    { 19, 21, 20, 0, 21, 100, 34483 }, // Υ
-    { 25, 22, 27, 1, 21, 138, 34583 }, // Φ
-    { 20, 21, 21, 0, 21, 105, 34721 }, // Χ
-    { 22, 21, 26, 2, 21, 116, 34826 }, // Ψ
-    { 22, 22, 23, 0, 22, 121, 34942 }, // Ω
-    { 18, 18, 20, 1, 17, 81, 35063 }, // α
-    { 16, 30, 19, 2, 23, 120, 35144 }, // β
-    { 16, 23, 17, 0, 16, 92, 35264 }, // γ
-    { 16, 24, 18, 1, 23, 96, 35356 }, // δ
-    { 13, 18, 15, 1, 17, 59, 35452 }, // ε
-    { 14, 29, 16, 1, 23, 102, 35511 }, // ζ
-    { 15, 24, 19, 2, 17, 90, 35613 }, // η
-    { 16, 24, 18, 1, 23, 96, 35703 }, // θ
-    { 9, 17, 12, 2, 16, 39, 35799 }, // ι
-    { 17, 16, 20, 2, 16, 68, 35838 }, // κ
-    { 17, 24, 18, 0, 23, 102, 35906 }, // λ
-    { 17, 23, 20, 2, 16, 98, 36008 }, // μ
-    { 16, 16, 17, 0, 16, 64, 36106 }, // ν
-    { 14, 29, 16, 1, 23, 102, 36170 }, // ξ
-    { 16, 18, 18, 1, 17, 72, 36272 }, // ο
-    { 21, 17, 22, 0, 16, 90, 36344 }, // π
-    { 16, 24, 18, 1, 17, 96, 36434 }, // ρ
-    { 14, 23, 16, 1, 17, 81, 36530 }, // ς
-    { 17, 17, 19, 1, 16, 73, 36611 }, // σ
-    { 15, 17, 16, 0, 16, 64, 36684 }, // τ
-    { 15, 17, 19, 2, 16, 64, 36748 }, // υ
-    { 22, 30, 24, 1, 23, 165, 36812 }, // φ
-    { 19, 25, 20, 0, 17, 119, 36977 }, // χ
-    { 21, 30, 24, 2, 23, 158, 37096 }, // ψ
-    { 23, 17, 25, 1, 16, 98, 37254 }, // ω
-    { 21, 28, 22, 0, 21, 147, 37352 }, // Ạ
-    { 15, 24, 17, 1, 17, 90, 37499 }, // ạ
-    { 21, 30, 22, 0, 30, 158, 37589 }, // Ả
-    { 15, 26, 17, 1, 25, 98, 37747 }, // ả
-    { 21, 29, 22, 0, 29, 153, 37845 }, // Ấ
-    { 18, 25, 20, 1, 24, 113, 37998 }, // ấ
-    { 21, 29, 22, 0, 29, 153, 38111 }, // Ầ
-    { 17, 25, 17, -1, 24, 107, 38264 }, // ầ
-    { 21, 31, 22, 0, 31, 163, 38371 }, // Ẩ
-    { 16, 27, 18, 1, 26, 108, 38534 }, // ẩ
-    { 21, 31, 22, 0, 31, 163, 38642 }, // Ẫ
-    { 15, 27, 17, 1, 26, 102, 38805 }, // ẫ
-    { 21, 35, 22, 0, 28, 184, 38907 }, // Ậ
-    { 15, 30, 17, 1, 23, 113, 39091 }, // ậ
-    { 21, 30, 22, 0, 30, 158, 39204 }, // Ắ
-    { 15, 26, 17, 1, 25, 98, 39362 }, // ắ
-    { 21, 30, 22, 0, 30, 158, 39460 }, // Ằ
-    { 15, 26, 17, 1, 25, 98, 39618 }, // ằ
-    { 21, 31, 22, 0, 31, 163, 39716 }, // Ẳ
-    { 15, 27, 17, 1, 26, 102, 39879 }, // ẳ
-    { 21, 31, 22, 0, 31, 163, 39981 }, // Ẵ
-    { 15, 27, 17, 1, 26, 102, 40144 }, // ẵ
-    { 21, 35, 22, 0, 28, 184, 40246 }, // Ặ
-    { 15, 30, 17, 1, 23, 113, 40430 }, // ặ
-    { 13, 28, 16, 2, 21, 91, 40543 }, // Ẹ
-    { 16, 24, 18, 1, 17, 96, 40634 }, // ẹ
-    { 13, 30, 16, 2, 30, 98, 40730 }, // Ẻ
-    { 16, 26, 18, 1, 25, 104, 40828 }, // ẻ
-    { 13, 28, 16, 2, 28, 91, 40932 }, // Ẽ
-    { 16, 24, 18, 1, 23, 96, 41023 }, // ẽ
-    { 16, 29, 19, 2, 29, 116, 41119 }, // Ế
-    { 18, 25, 20, 1, 24, 113, 41235 }, // ế
-    { 17, 29, 16, -2, 29, 124, 41348 }, // Ề
-    { 18, 25, 18, -1, 24, 113, 41472 }, // ề
-    { 14, 31, 17, 2, 31, 109, 41585 }, // Ể
-    { 17, 27, 19, 1, 26, 115, 41694 }, // ể
-    { 13, 31, 16, 2, 31, 101, 41809 }, // Ễ
-    { 16, 27, 18, 1, 26, 108, 41910 }, // ễ
-    { 13, 35, 16, 2, 28, 114, 42018 }, // Ệ
-    { 16, 30, 18, 1, 23, 120, 42132 }, // ệ
-    { 11, 30, 12, 0, 30, 83, 42252 }, // Ỉ
-    { 8, 25, 10, 1, 25, 50, 42335 }, // ỉ
-    { 11, 28, 12, 0, 21, 77, 42385 }, // Ị
-    { 6, 30, 9, 1, 23, 45, 42462 }, // ị
-    { 21, 29, 23, 1, 22, 153, 42507 }, // Ọ
-    { 16, 24, 18, 1, 17, 96, 42660 }, // ọ
-    { 21, 31, 23, 1, 30, 163, 42756 }, // Ỏ
-    { 16, 26, 18, 1, 25, 104, 42919 }, // ỏ
-    { 21, 30, 23, 1, 29, 158, 43023 }, // Ố
-    { 18, 25, 20, 1, 24, 113, 43181 }, // ố
-    { 21, 30, 23, 1, 29, 158, 43294 }, // Ồ
-    { 18, 25, 18, -1, 24, 113, 43452 }, // ồ
-    { 21, 32, 23, 1, 31, 168, 43565 }, // Ổ
-    { 17, 27, 19, 1, 26, 115, 43733 }, // ổ
-    { 21, 32, 23, 1, 31, 168, 43848 }, // Ỗ
-    { 16, 27, 18, 1, 26, 108, 44016 }, // ỗ
-    { 21, 35, 23, 1, 28, 184, 44124 }, // Ộ
-    { 16, 30, 18, 1, 23, 120, 44308 }, // ộ
-    { 24, 29, 26, 1, 28, 174, 44428 }, // Ớ
-    { 20, 24, 22, 1, 23, 120, 44602 }, // ớ
-    { 24, 29, 26, 1, 28, 174, 44722 }, // Ờ
-    { 20, 24, 22, 1, 23, 120, 44896 }, // ờ
-    { 24, 31, 26, 1, 30, 186, 45016 }, // Ở
-    { 20, 26, 22, 1, 25, 130, 45202 }, // ở
-    { 24, 29, 26, 1, 28, 174, 45332 }, // Ỡ
-    { 20, 24, 22, 1, 23, 120, 45506 }, // ỡ
-    { 24, 30, 26, 1, 23, 180, 45626 }, // Ợ
-    { 20, 26, 22, 1, 19, 130, 45806 }, // ợ
-    { 18, 28, 22, 2, 21, 126, 45936 }, // Ụ
-    { 15, 23, 19, 2, 16, 87, 46062 }, // ụ
-    { 18, 31, 22, 2, 30, 140, 46149 }, // Ủ
-    { 15, 26, 19, 2, 25, 98, 46289 }, // ủ
-    { 25, 29, 28, 2, 28, 182, 46387 }, // Ứ
-    { 22, 24, 25, 2, 23, 132, 46569 }, // ứ
-    { 25, 29, 28, 2, 28, 182, 46701 }, // Ừ
-    { 22, 24, 25, 2, 23, 132, 46883 }, // ừ
-    { 25, 31, 28, 2, 30, 194, 47015 }, // Ử
-    { 22, 26, 25, 2, 25, 143, 47209 }, // ử
-    { 25, 29, 28, 2, 28, 182, 47352 }, // Ữ
-    { 22, 24, 25, 2, 23, 132, 47534 }, // ữ
-    { 25, 30, 28, 2, 23, 188, 47666 }, // Ự
-    { 22, 26, 25, 2, 19, 143, 47854 }, // ự
-    { 19, 28, 20, 0, 28, 133, 47997 }, // Ỳ
-    { 17, 30, 18, 0, 23, 128, 48130 }, // ỳ
-    { 19, 28, 20, 0, 21, 133, 48258 }, // Ỵ
-    { 17, 23, 18, 0, 16, 98, 48391 }, // ỵ
-    { 19, 30, 20, 0, 30, 143, 48489 }, // Ỷ
-    { 17, 32, 18, 0, 25, 136, 48632 }, // ỷ
-    { 19, 28, 20, 0, 28, 133, 48768 }, // Ỹ
-    { 17, 30, 18, 0, 23, 128, 48901 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 49029 }, //  
-    { 0, 0, 29, 0, 0, 0, 49029 }, //  
-    { 0, 0, 15, 0, 0, 0, 49029 }, //  
-    { 0, 0, 29, 0, 0, 0, 49029 }, //  
-    { 0, 0, 10, 0, 0, 0, 49029 }, //  
-    { 0, 0, 7, 0, 0, 0, 49029 }, //  
-    { 0, 0, 5, 0, 0, 0, 49029 }, //  
-    { 0, 0, 17, 0, 0, 0, 49029 }, //  
-    { 0, 0, 8, 0, 0, 0, 49029 }, //  
-    { 0, 0, 5, 0, 0, 0, 49029 }, //  
-    { 0, 0, 3, 0, 0, 0, 49029 }, //  
-    { 0, 0, 1, 0, 0, 0, 49029 }, // ​
-    { 0, 0, 1, 0, 0, 0, 49029 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 49029 }, // ‍
-    { 8, 25, 8, -1, 21, 50, 49029 }, // ‎
-    { 8, 25, 2, -7, 21, 50, 49079 }, // ‏
-    { 9, 4, 10, 0, 10, 9, 49129 }, // ‐
-    { 9, 4, 10, 0, 10, 9, 49138 }, // ‑
-    { 15, 4, 17, 1, 12, 15, 49147 }, // ‒
-    { 13, 4, 15, 1, 10, 13, 49162 }, // –
-    { 28, 4, 30, 1, 10, 28, 49175 }, // —
-    { 28, 4, 30, 1, 10, 28, 49203 }, // ―
-    { 12, 30, 16, 2, 23, 90, 49231 }, // ‖
-    { 14, 7, 14, -1, 0, 25, 49321 }, // ‗
-    { 6, 8, 7, 0, 21, 12, 49346 }, // ‘
-    { 6, 8, 7, 0, 21, 12, 49358 }, // ’
-    { 7, 8, 8, 0, 4, 14, 49370 }, // ‚
-    { 6, 8, 7, 0, 21, 12, 49384 }, // ‛
-    { 13, 8, 14, 0, 21, 26, 49396 }, // “
-    { 13, 8, 14, 0, 21, 26, 49422 }, // ”
-    { 14, 8, 15, 0, 4, 28, 49448 }, // „
-    { 13, 8, 14, 0, 21, 26, 49476 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 49502 }, // †
-    { 13, 23, 15, 1, 23, 75, 49577 }, // ‡
-    { 9, 10, 11, 1, 16, 23, 49652 }, // •
-    { 10, 12, 12, 1, 17, 30, 49675 }, // ‣
-    { 6, 6, 15, 4, 5, 9, 49705 }, // ․
-    { 15, 6, 17, 1, 5, 23, 49714 }, // ‥
-    { 23, 6, 25, 1, 5, 35, 49737 }, // …
-    { 6, 6, 8, 1, 11, 9, 49772 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 49781 }, //  
-    { 0, 0, 18, 0, 0, 0, 49781 }, //  
-    { 8, 22, 8, -1, 18, 44, 49781 }, // ‪
-    { 8, 22, 2, -7, 18, 44, 49825 }, // ‫
-    { 8, 25, 5, -4, 21, 50, 49869 }, // ‬
-    { 8, 25, 5, -4, 21, 50, 49919 }, // ‭
-    { 8, 25, 5, -4, 21, 50, 49969 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 50019 }, //  
-    { 37, 23, 38, 0, 22, 213, 50019 }, // ‰
-    { 48, 23, 49, 0, 22, 276, 50232 }, // ‱
-    { 9, 8, 11, 1, 21, 18, 50508 }, // ′
-    { 15, 8, 17, 1, 21, 30, 50526 }, // ″
-    { 21, 8, 23, 1, 21, 42, 50556 }, // ‴
-    { 9, 8, 12, 1, 21, 18, 50598 }, // ‵
-    { 15, 8, 19, 1, 21, 30, 50616 }, // ‶
-    { 22, 8, 25, 1, 21, 44, 50646 }, // ‷
-    { 12, 10, 13, 0, 3, 30, 50690 }, // ‸
-    { 9, 14, 11, 1, 15, 32, 50720 }, // ‹
-    { 9, 14, 11, 1, 15, 32, 50752 }, // ›
-    { 23, 23, 25, 1, 22, 133, 50784 }, // ※
-    { 14, 22, 17, 1, 21, 77, 50917 }, // ‼
-    { 14, 23, 15, 0, 22, 81, 50994 }, // ‽
-    { 16, 4, 16, -1, 26, 16, 51075 }, // ‾
-    { 18, 7, 19, 0, 0, 32, 51091 }, // ‿
-    { 18, 8, 19, 0, 24, 36, 51123 }, // ⁀
-    { 12, 19, 13, 0, 12, 57, 51159 }, // ⁁
-    { 33, 28, 34, 0, 23, 231, 51216 }, // ⁂
-    { 9, 4, 11, 1, 10, 9, 51447 }, // ⁃
-    { 16, 21, 11, -6, 21, 84, 51456 }, // ⁄
-    { 7, 26, 10, 2, 21, 46, 51540 }, // ⁅
-    { 8, 26, 10, 0, 21, 52, 51586 }, // ⁆
-    { 28, 23, 29, 0, 22, 161, 51638 }, // ⁇
-    { 21, 23, 22, 0, 22, 121, 51799 }, // ⁈
-    { 21, 23, 23, 1, 22, 121, 51920 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 52041 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 52101 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 52209 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 52269 }, // ⁍
-    { 15, 15, 16, 0, 8, 57, 52329 }, // ⁎
-    { 7, 21, 9, 1, 17, 37, 52386 }, // ⁏
-    { 18, 31, 19, 0, 24, 140, 52423 }, // ⁐
-    { 15, 30, 16, 0, 23, 113, 52563 }, // ⁑
-    { 13, 23, 14, 0, 22, 75, 52676 }, // ⁒
-    { 28, 6, 30, 1, 11, 42, 52751 }, // ⁓
-    { 18, 7, 19, 0, 0, 32, 52793 }, // ⁔
-    { 16, 15, 17, 0, 15, 60, 52825 }, // ⁕
-    { 15, 23, 17, 1, 22, 87, 52885 }, // ⁖
-    { 27, 8, 29, 1, 21, 54, 52972 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 53026 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 53159 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 53292 }, // ⁚
-    { 18, 24, 20, 1, 23, 108, 53327 }, // ⁛
-    { 23, 23, 25, 1, 22, 133, 53435 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 53568 }, // ⁝
-    { 6, 23, 8, 1, 22, 35, 53604 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 53639 }, //  
-    { 0, 0, 18, 0, 0, 0, 53639 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 53639 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 53639 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 53639 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 53639 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 53639 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 53639 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 53639 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 53639 }, // ⁩
-    { 8, 25, 5, -4, 21, 50, 53639 }, // ⁪
-    { 8, 25, 5, -4, 21, 50, 53689 }, // ⁫
-    { 8, 25, 5, -4, 21, 50, 53739 }, // ⁬
-    { 8, 25, 5, -4, 21, 50, 53789 }, // ⁭
-    { 8, 25, 5, -4, 21, 50, 53839 }, // ⁮
-    { 8, 25, 5, -4, 21, 50, 53889 }, // ⁯
-    { 11, 14, 12, 0, 25, 39, 53939 }, // ⁰
-    { 4, 14, 6, 1, 22, 14, 53978 }, // ⁱ
-    { 11, 13, 12, 0, 25, 36, 53992 }, // ⁴
-    { 10, 14, 12, 1, 25, 35, 54028 }, // ⁵
-    { 11, 14, 12, 0, 25, 39, 54063 }, // ⁶
-    { 11, 13, 12, 0, 25, 36, 54102 }, // ⁷
-    { 11, 14, 12, 0, 25, 39, 54138 }, // ⁸
-    { 11, 14, 12, 0, 25, 39, 54177 }, // ⁹
-    { 9, 9, 11, 1, 22, 21, 54216 }, // ⁺
-    { 9, 3, 11, 1, 19, 7, 54237 }, // ⁻
-    { 9, 7, 11, 1, 21, 16, 54244 }, // ⁼
-    { 6, 17, 8, 1, 27, 26, 54260 }, // ⁽
-    { 6, 17, 7, 0, 27, 26, 54286 }, // ⁾
-    { 10, 11, 12, 1, 19, 28, 54312 }, // ⁿ
-    { 11, 14, 12, 0, 9, 39, 54340 }, // ₀
-    { 9, 13, 11, 0, 9, 30, 54379 }, // ₁
-    { 10, 13, 11, 0, 9, 33, 54409 }, // ₂
-    { 11, 14, 12, 0, 9, 39, 54442 }, // ₃
-    { 11, 13, 12, 0, 9, 36, 54481 }, // ₄
-    { 10, 14, 12, 1, 9, 35, 54517 }, // ₅
-    { 11, 14, 12, 0, 9, 39, 54552 }, // ₆
-    { 11, 13, 12, 0, 9, 36, 54591 }, // ₇
-    { 11, 14, 12, 0, 9, 39, 54627 }, // ₈
-    { 11, 14, 12, 0, 9, 39, 54666 }, // ₉
-    { 9, 9, 11, 1, 7, 21, 54705 }, // ₊
-    { 9, 3, 11, 1, 4, 7, 54726 }, // ₋
-    { 9, 7, 11, 1, 6, 16, 54733 }, // ₌
-    { 6, 17, 8, 1, 11, 26, 54749 }, // ₍
-    { 6, 17, 7, 0, 11, 26, 54775 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 54801 }, // ₐ
-    { 11, 10, 12, 0, 7, 28, 54826 }, // ₑ
-    { 11, 10, 12, 0, 7, 28, 54854 }, // ₒ
-    { 11, 10, 12, 0, 7, 28, 54882 }, // ₓ
-    { 11, 10, 12, 0, 7, 28, 54910 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 54938 }, // ₕ
-    { 11, 14, 13, 1, 11, 39, 54973 }, // ₖ
-    { 4, 14, 6, 1, 11, 14, 55012 }, // ₗ
-    { 17, 10, 19, 1, 7, 43, 55026 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 55069 }, // ₙ
-    { 11, 14, 13, 1, 7, 39, 55094 }, // ₚ
-    { 9, 10, 10, 0, 7, 23, 55133 }, // ₛ
-    { 8, 12, 9, 0, 9, 24, 55156 }, // ₜ
-    { 17, 22, 18, 0, 22, 94, 55180 }, // ₠
-    { 18, 25, 19, 0, 23, 113, 55274 }, // ₡
-    { 16, 23, 18, 1, 22, 92, 55387 }, // ₢
-    { 16, 21, 17, 0, 21, 84, 55479 }, // ₣
-    { 16, 22, 18, 1, 22, 88, 55563 }, // ₤
-    { 25, 24, 28, 2, 20, 150, 55651 }, // ₥
-    { 17, 21, 18, 0, 21, 90, 55801 }, // ₦
-    { 23, 22, 26, 2, 21, 127, 55891 }, // ₧
-    { 24, 22, 27, 2, 21, 132, 56018 }, // ₨
-    { 22, 21, 23, 0, 21, 116, 56150 }, // ₩
-    { 23, 21, 27, 2, 21, 121, 56266 }, // ₪
-    { 18, 28, 20, 1, 23, 126, 56387 }, // ₫
-    { 17, 22, 18, 0, 21, 94, 56513 }, // €
-    { 17, 21, 18, 0, 21, 90, 56607 }, // ₭
-    { 17, 21, 18, 0, 21, 90, 56697 }, // ₮
-    { 29, 29, 30, 0, 22, 211, 56787 }, // ₯
-    { 17, 29, 18, 0, 22, 124, 56998 }, // ₰
-    { 17, 21, 18, 0, 21, 90, 57122 }, // ₱
-    { 18, 26, 21, 1, 23, 117, 57212 }, // ₲
-    { 19, 21, 20, 0, 21, 100, 57329 }, // ₳
-    { 17, 23, 18, 0, 22, 98, 57429 }, // ₴
-    { 17, 26, 19, 1, 23, 111, 57527 }, // ₵
-    { 20, 21, 21, 0, 20, 105, 57638 }, // ₶
-    { 21, 25, 22, 0, 22, 132, 57743 }, // ₷
-    { 17, 21, 18, 0, 21, 90, 57875 }, // ₸
-    { 15, 21, 17, 1, 21, 79, 57965 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 58044 }, // ₺
-    { 24, 23, 25, 0, 22, 138, 58132 }, // ₻
-    { 24, 21, 26, 1, 21, 126, 58270 }, // ₼
-    { 17, 21, 18, 0, 21, 90, 58396 }, // ₽
-    { 21, 23, 23, 1, 23, 121, 58486 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 58607 }, // ₿
-    { 14, 23, 16, 1, 17, 81, 58702 }, // ⃀
-    { 15, 4, 17, 1, 12, 15, 58783 }, // −
-    { 27, 28, 29, 1, 23, 189, 58798 }, // �
+    { 6, 22, 8, 1, 21, 28, 0 }, // !
+    { 12, 8, 14, 1, 21, 25, 28 }, // "
+    { 19, 21, 20, 0, 21, 72, 53 }, // #
+    { 15, 25, 17, 1, 23, 74, 125 }, // $
+    { 26, 23, 27, 0, 22, 105, 199 }, // %
+    { 21, 23, 23, 1, 22, 80, 304 }, // &
+    { 5, 8, 8, 1, 21, 12, 384 }, // '
+    { 9, 26, 11, 1, 21, 40, 396 }, // (
+    { 9, 26, 10, 0, 21, 42, 436 }, // )
+    { 15, 15, 16, 0, 23, 42, 478 }, // *
+    { 15, 15, 17, 1, 18, 32, 520 }, // +
+    { 7, 8, 8, 0, 4, 13, 552 }, // ,
+    { 9, 4, 10, 0, 10, 11, 565 }, // -
+    { 6, 6, 8, 1, 5, 9, 576 }, // .
+    { 12, 22, 13, 0, 21, 34, 585 }, // /
+    { 15, 23, 17, 1, 22, 61, 619 }, // 0
+    { 12, 21, 17, 1, 21, 38, 680 }, // 1
+    { 15, 22, 17, 1, 22, 56, 718 }, // 2
+    { 15, 23, 17, 1, 22, 62, 774 }, // 3
+    { 17, 21, 18, 0, 21, 69, 836 }, // 4
+    { 15, 22, 17, 1, 21, 56, 905 }, // 5
+    { 15, 23, 17, 1, 22, 66, 961 }, // 6
+    { 16, 21, 17, 0, 21, 47, 1027 }, // 7
+    { 15, 23, 17, 1, 22, 66, 1074 }, // 8
+    { 16, 23, 17, 0, 22, 67, 1140 }, // 9
+    { 6, 18, 8, 1, 17, 19, 1207 }, // :
+    { 7, 21, 8, 0, 17, 26, 1226 }, // ;
+    { 15, 17, 17, 1, 19, 42, 1252 }, // <
+    { 15, 10, 17, 1, 15, 30, 1294 }, // =
+    { 15, 17, 17, 1, 19, 40, 1324 }, // >
+    { 14, 23, 15, 0, 22, 46, 1364 }, // ?
+    { 24, 24, 26, 1, 21, 121, 1410 }, // @
+    { 21, 21, 22, 0, 21, 67, 1531 }, // A
+    { 16, 21, 19, 2, 21, 68, 1598 }, // B
+    { 17, 23, 19, 1, 22, 61, 1666 }, // C
+    { 18, 21, 21, 2, 21, 68, 1727 }, // D
+    { 13, 21, 16, 2, 21, 49, 1795 }, // E
+    { 13, 21, 16, 2, 21, 40, 1844 }, // F
+    { 18, 23, 21, 1, 22, 73, 1884 }, // G
+    { 18, 21, 22, 2, 21, 66, 1957 }, // H
+    { 11, 21, 12, 0, 21, 39, 2023 }, // I
+    { 11, 28, 10, -3, 21, 44, 2062 }, // J
+    { 18, 21, 21, 2, 21, 68, 2106 }, // K
+    { 14, 21, 17, 2, 21, 47, 2174 }, // L
+    { 23, 21, 28, 2, 21, 98, 2221 }, // M
+    { 20, 21, 24, 2, 21, 84, 2319 }, // N
+    { 21, 23, 23, 1, 22, 84, 2403 }, // O
+    { 15, 21, 18, 2, 21, 55, 2487 }, // P
+    { 21, 27, 23, 1, 22, 94, 2542 }, // Q
+    { 18, 21, 21, 2, 21, 69, 2636 }, // R
+    { 14, 23, 16, 1, 22, 56, 2705 }, // S
+    { 17, 21, 18, 0, 21, 46, 2761 }, // T
+    { 18, 22, 22, 2, 21, 60, 2807 }, // U
+    { 19, 21, 20, 0, 21, 59, 2867 }, // V
+    { 29, 21, 30, 0, 21, 108, 2926 }, // W
+    { 20, 21, 21, 0, 21, 66, 3034 }, // X
+    { 19, 21, 20, 0, 21, 53, 3100 }, // Y
+    { 17, 21, 18, 0, 21, 55, 3153 }, // Z
+    { 7, 26, 10, 2, 21, 30, 3208 }, // [
+    { 12, 22, 13, 0, 21, 33, 3238 }, // <backslash>
+    { 8, 26, 10, 0, 21, 46, 3271 }, // ]
+    { 17, 14, 18, 0, 21, 40, 3317 }, // ^
+    { 14, 3, 14, -1, -2, 16, 3357 }, // _
+    { 9, 6, 11, 1, 23, 11, 3373 }, // `
+    { 15, 18, 17, 1, 17, 50, 3384 }, // a
+    { 16, 24, 19, 2, 23, 65, 3434 }, // b
+    { 14, 18, 16, 1, 17, 42, 3499 }, // c
+    { 16, 24, 18, 1, 23, 70, 3541 }, // d
+    { 16, 18, 18, 1, 17, 45, 3611 }, // e
+    { 13, 23, 14, 0, 23, 43, 3656 }, // f
+    { 16, 24, 18, 1, 17, 77, 3699 }, // g
+    { 15, 23, 19, 2, 23, 57, 3776 }, // h
+    { 6, 23, 9, 1, 23, 31, 3833 }, // i
+    { 9, 30, 9, -2, 23, 46, 3864 }, // j
+    { 17, 23, 20, 2, 23, 74, 3910 }, // k
+    { 5, 23, 9, 2, 23, 23, 3984 }, // l
+    { 25, 17, 28, 2, 17, 73, 4007 }, // m
+    { 15, 17, 19, 2, 17, 45, 4080 }, // n
+    { 16, 18, 18, 1, 17, 48, 4125 }, // o
+    { 16, 24, 19, 2, 17, 66, 4173 }, // p
+    { 16, 24, 18, 1, 17, 70, 4239 }, // q
+    { 11, 17, 14, 2, 17, 30, 4309 }, // r
+    { 13, 18, 15, 1, 17, 44, 4339 }, // s
+    { 12, 21, 13, 0, 20, 42, 4383 }, // t
+    { 15, 17, 19, 2, 16, 46, 4425 }, // u
+    { 17, 16, 18, 0, 16, 46, 4471 }, // v
+    { 25, 16, 26, 0, 16, 78, 4517 }, // w
+    { 17, 16, 18, 0, 16, 47, 4595 }, // x
+    { 17, 23, 18, 0, 16, 61, 4642 }, // y
+    { 14, 16, 15, 0, 16, 38, 4703 }, // z
+    { 11, 26, 12, 0, 21, 43, 4741 }, // {
+    { 4, 30, 16, 6, 23, 45, 4784 }, // |
+    { 11, 26, 13, 1, 21, 52, 4829 }, // }
+    { 15, 6, 17, 1, 13, 18, 4881 }, // ~
+    { 0, 0, 8, 0, 0, 0, 4899 }, //  
+    { 6, 22, 8, 1, 16, 32, 4899 }, // ¡
+    { 13, 23, 17, 2, 22, 50, 4931 }, // ¢
+    { 16, 22, 18, 1, 22, 63, 4981 }, // £
+    { 14, 14, 17, 1, 17, 42, 5044 }, // ¤
+    { 17, 21, 18, 0, 21, 61, 5086 }, // ¥
+    { 4, 30, 16, 6, 23, 39, 5147 }, // ¦
+    { 12, 24, 14, 1, 23, 59, 5186 }, // §
+    { 11, 4, 17, 3, 22, 13, 5245 }, // ¨
+    { 22, 23, 24, 1, 22, 103, 5258 }, // ©
+    { 10, 12, 11, 0, 22, 27, 5361 }, // ª
+    { 16, 14, 18, 1, 15, 43, 5388 }, // «
+    { 15, 9, 17, 1, 12, 28, 5431 }, // ¬
+    { 9, 4, 10, 0, 10, 11, 5459 }, // ­
+    { 22, 23, 24, 1, 22, 110, 5470 }, // ®
+    { 16, 4, 16, -1, 26, 10, 5580 }, // ¯
+    { 11, 11, 13, 1, 22, 27, 5590 }, // °
+    { 15, 19, 17, 1, 19, 43, 5617 }, // ±
+    { 10, 13, 11, 0, 25, 26, 5660 }, // ²
+    { 11, 14, 12, 0, 25, 30, 5686 }, // ³
+    { 9, 6, 11, 1, 23, 12, 5716 }, // ´
+    { 15, 23, 19, 2, 16, 56, 5728 }, // µ
+    { 16, 27, 19, 1, 23, 99, 5784 }, // ¶
+    { 6, 6, 8, 1, 13, 9, 5883 }, // ·
+    { 8, 7, 9, 0, 0, 14, 5892 }, // ¸
+    { 9, 13, 11, 0, 25, 19, 5906 }, // ¹
+    { 11, 12, 12, 0, 22, 30, 5925 }, // º
+    { 16, 14, 18, 1, 15, 45, 5955 }, // »
+    { 24, 21, 25, 0, 21, 91, 6000 }, // ¼
+    { 25, 21, 26, 0, 21, 92, 6091 }, // ½
+    { 24, 22, 26, 1, 22, 100, 6183 }, // ¾
+    { 14, 23, 15, 0, 17, 45, 6283 }, // ¿
+    { 21, 28, 22, 0, 28, 85, 6328 }, // À
+    { 21, 28, 22, 0, 28, 84, 6413 }, // Á
+    { 21, 28, 22, 0, 28, 90, 6497 }, // Â
+    { 21, 28, 22, 0, 28, 87, 6587 }, // Ã
+    { 21, 27, 22, 0, 27, 84, 6674 }, // Ä
+    { 21, 26, 22, 0, 26, 85, 6758 }, // Å
+    { 27, 21, 28, 0, 21, 89, 6843 }, // Æ
+    { 17, 29, 19, 1, 22, 75, 6932 }, // Ç
+    { 13, 28, 16, 2, 28, 64, 7007 }, // È
+    { 13, 28, 16, 2, 28, 62, 7071 }, // É
+    { 13, 28, 16, 2, 28, 65, 7133 }, // Ê
+    { 13, 27, 16, 2, 27, 64, 7198 }, // Ë
+    { 11, 28, 12, 0, 28, 51, 7262 }, // Ì
+    { 11, 28, 12, 0, 28, 51, 7313 }, // Í
+    { 13, 28, 13, -1, 28, 55, 7364 }, // Î
+    { 11, 27, 12, 0, 27, 54, 7419 }, // Ï
+    { 20, 21, 21, 0, 21, 76, 7473 }, // Ð
+    { 20, 28, 24, 2, 28, 105, 7549 }, // Ñ
+    { 21, 29, 23, 1, 28, 100, 7654 }, // Ò
+    { 21, 29, 23, 1, 28, 99, 7754 }, // Ó
+    { 21, 29, 23, 1, 28, 103, 7853 }, // Ô
+    { 21, 29, 23, 1, 28, 104, 7956 }, // Õ
+    { 21, 28, 23, 1, 27, 102, 8060 }, // Ö
+    { 14, 14, 17, 1, 17, 38, 8162 }, // ×
+    { 21, 24, 23, 1, 22, 98, 8200 }, // Ø
+    { 18, 29, 22, 2, 28, 75, 8298 }, // Ù
+    { 18, 29, 22, 2, 28, 77, 8373 }, // Ú
+    { 18, 29, 22, 2, 28, 81, 8450 }, // Û
+    { 18, 28, 22, 2, 27, 74, 8531 }, // Ü
+    { 19, 28, 20, 0, 28, 69, 8605 }, // Ý
+    { 15, 21, 18, 2, 21, 56, 8674 }, // Þ
+    { 18, 24, 21, 2, 23, 80, 8730 }, // ß
+    { 15, 24, 17, 1, 23, 64, 8810 }, // à
+    { 15, 24, 17, 1, 23, 65, 8874 }, // á
+    { 15, 24, 17, 1, 23, 67, 8939 }, // â
+    { 15, 24, 17, 1, 23, 67, 9006 }, // ã
+    { 15, 23, 17, 1, 22, 64, 9073 }, // ä
+    { 15, 26, 17, 1, 25, 70, 9137 }, // å
+    { 25, 18, 27, 1, 17, 78, 9207 }, // æ
+    { 14, 24, 16, 1, 17, 55, 9285 }, // ç
+    { 16, 24, 18, 1, 23, 59, 9340 }, // è
+    { 16, 24, 18, 1, 23, 59, 9399 }, // é
+    { 16, 24, 18, 1, 23, 62, 9458 }, // ê
+    { 16, 23, 18, 1, 22, 59, 9520 }, // ë
+    { 10, 23, 10, -1, 23, 36, 9579 }, // ì
+    { 9, 23, 12, 2, 23, 36, 9615 }, // í
+    { 13, 23, 12, -2, 23, 41, 9651 }, // î
+    { 11, 22, 11, -1, 22, 40, 9692 }, // ï
+    { 16, 24, 18, 1, 23, 66, 9732 }, // ð
+    { 15, 23, 19, 2, 23, 61, 9798 }, // ñ
+    { 16, 24, 18, 1, 23, 62, 9859 }, // ò
+    { 16, 24, 18, 1, 23, 63, 9921 }, // ó
+    { 16, 24, 18, 1, 23, 67, 9984 }, // ô
+    { 16, 24, 18, 1, 23, 64, 10051 }, // õ
+    { 16, 23, 18, 1, 22, 61, 10115 }, // ö
+    { 15, 15, 17, 1, 18, 38, 10176 }, // ÷
+    { 16, 19, 18, 1, 17, 59, 10214 }, // ø
+    { 15, 24, 19, 2, 23, 61, 10273 }, // ù
+    { 15, 24, 19, 2, 23, 62, 10334 }, // ú
+    { 15, 24, 19, 2, 23, 64, 10396 }, // û
+    { 15, 23, 19, 2, 22, 63, 10460 }, // ü
+    { 17, 30, 18, 0, 23, 77, 10523 }, // ý
+    { 16, 30, 19, 2, 23, 78, 10600 }, // þ
+    { 17, 29, 18, 0, 22, 77, 10678 }, // ÿ
+    { 21, 26, 22, 0, 26, 86, 10755 }, // Ā
+    { 15, 22, 17, 1, 21, 66, 10841 }, // ā
+    { 21, 28, 22, 0, 28, 86, 10907 }, // Ă
+    { 15, 24, 17, 1, 23, 68, 10993 }, // ă
+    { 21, 28, 22, 0, 21, 85, 11061 }, // Ą
+    { 15, 24, 17, 1, 17, 65, 11146 }, // ą
+    { 17, 29, 19, 1, 28, 76, 11211 }, // Ć
+    { 14, 24, 16, 1, 23, 54, 11287 }, // ć
+    { 17, 29, 19, 1, 28, 80, 11341 }, // Ĉ
+    { 14, 24, 16, 1, 23, 57, 11421 }, // ĉ
+    { 17, 29, 19, 1, 28, 72, 11478 }, // Ċ
+    { 14, 24, 16, 1, 23, 52, 11550 }, // ċ
+    { 17, 29, 19, 1, 28, 80, 11602 }, // Č
+    { 14, 24, 16, 1, 23, 59, 11682 }, // č
+    { 18, 28, 21, 2, 28, 86, 11741 }, // Ď
+    { 22, 24, 24, 1, 23, 83, 11827 }, // ď
+    { 20, 21, 21, 0, 21, 76, 11910 }, // Đ
+    { 18, 24, 20, 1, 23, 77, 11986 }, // đ
+    { 13, 26, 16, 2, 26, 65, 12063 }, // Ē
+    { 16, 22, 18, 1, 21, 60, 12128 }, // ē
+    { 13, 28, 16, 2, 28, 67, 12188 }, // Ĕ
+    { 16, 24, 18, 1, 23, 63, 12255 }, // ĕ
+    { 13, 28, 16, 2, 28, 58, 12318 }, // Ė
+    { 16, 24, 18, 1, 23, 55, 12376 }, // ė
+    { 13, 28, 16, 2, 21, 63, 12431 }, // Ę
+    { 16, 24, 18, 1, 17, 58, 12494 }, // ę
+    { 14, 28, 17, 2, 28, 75, 12552 }, // Ě
+    { 16, 24, 18, 1, 23, 61, 12627 }, // ě
+    { 18, 29, 21, 1, 28, 91, 12688 }, // Ĝ
+    { 16, 30, 18, 1, 23, 96, 12779 }, // ĝ
+    { 18, 29, 21, 1, 28, 90, 12875 }, // Ğ
+    { 16, 30, 18, 1, 23, 93, 12965 }, // ğ
+    { 18, 29, 21, 1, 28, 83, 13058 }, // Ġ
+    { 16, 30, 18, 1, 23, 88, 13141 }, // ġ
+    { 18, 29, 21, 1, 22, 85, 13229 }, // Ģ
+    { 16, 30, 18, 1, 23, 91, 13314 }, // ģ
+    { 18, 28, 22, 2, 28, 88, 13405 }, // Ĥ
+    { 19, 29, 19, -2, 29, 82, 13493 }, // ĥ
+    { 23, 21, 24, 0, 21, 71, 13575 }, // Ħ
+    { 17, 23, 19, 0, 23, 72, 13646 }, // ħ
+    { 12, 28, 12, -1, 28, 56, 13718 }, // Ĩ
+    { 13, 23, 12, -2, 23, 41, 13774 }, // ĩ
+    { 11, 26, 12, 0, 26, 55, 13815 }, // Ī
+    { 11, 21, 11, -1, 21, 40, 13870 }, // ī
+    { 12, 28, 13, 0, 28, 56, 13910 }, // Ĭ
+    { 12, 23, 12, -1, 23, 40, 13966 }, // ĭ
+    { 11, 28, 12, 0, 21, 53, 14006 }, // Į
+    { 6, 30, 9, 1, 23, 43, 14059 }, // į
+    { 11, 28, 12, 0, 28, 47, 14102 }, // İ
+    { 5, 16, 9, 2, 16, 16, 14149 }, // ı
+    { 19, 28, 21, 0, 21, 100, 14165 }, // Ĳ
+    { 15, 30, 18, 1, 23, 78, 14265 }, // ĳ
+    { 14, 35, 12, -3, 28, 74, 14343 }, // Ĵ
+    { 13, 30, 12, -2, 23, 56, 14417 }, // ĵ
+    { 18, 28, 21, 2, 21, 81, 14473 }, // Ķ
+    { 17, 30, 20, 2, 23, 86, 14554 }, // ķ
+    { 17, 16, 20, 2, 16, 55, 14640 }, // ĸ
+    { 14, 28, 17, 2, 28, 62, 14695 }, // Ĺ
+    { 10, 29, 12, 1, 29, 46, 14757 }, // ĺ
+    { 14, 28, 17, 2, 21, 59, 14803 }, // Ļ
+    { 6, 30, 9, 1, 23, 43, 14862 }, // ļ
+    { 15, 21, 18, 2, 21, 54, 14905 }, // Ľ
+    { 11, 23, 14, 2, 23, 42, 14959 }, // ľ
+    { 14, 21, 17, 2, 21, 51, 15001 }, // Ŀ
+    { 11, 23, 14, 2, 23, 39, 15052 }, // ŀ
+    { 16, 21, 17, 0, 21, 52, 15091 }, // Ł
+    { 11, 23, 11, -1, 23, 46, 15143 }, // ł
+    { 20, 28, 24, 2, 28, 100, 15189 }, // Ń
+    { 15, 23, 19, 2, 23, 60, 15289 }, // ń
+    { 20, 28, 24, 2, 21, 98, 15349 }, // Ņ
+    { 15, 24, 19, 2, 17, 57, 15447 }, // ņ
+    { 20, 28, 24, 2, 28, 103, 15504 }, // Ň
+    { 15, 23, 19, 2, 23, 63, 15607 }, // ň
+    { 22, 21, 23, -1, 21, 64, 15670 }, // ŉ
+    { 20, 28, 24, 2, 21, 103, 15734 }, // Ŋ
+    { 15, 24, 19, 2, 17, 60, 15837 }, // ŋ
+    { 21, 27, 23, 1, 26, 102, 15897 }, // Ō
+    { 16, 22, 18, 1, 21, 64, 15999 }, // ō
+    { 21, 29, 23, 1, 28, 103, 16063 }, // Ŏ
+    { 16, 24, 18, 1, 23, 64, 16166 }, // ŏ
+    { 21, 29, 23, 1, 28, 108, 16230 }, // Ő
+    { 16, 24, 18, 1, 23, 68, 16338 }, // ő
+    { 26, 23, 28, 1, 22, 96, 16406 }, // Œ
+    { 27, 18, 29, 1, 17, 79, 16502 }, // œ
+    { 18, 28, 21, 2, 28, 85, 16581 }, // Ŕ
+    { 12, 23, 15, 2, 23, 43, 16666 }, // ŕ
+    { 18, 28, 21, 2, 21, 81, 16709 }, // Ŗ
+    { 12, 24, 14, 1, 17, 42, 16790 }, // ŗ
+    { 18, 28, 21, 2, 28, 88, 16832 }, // Ř
+    { 13, 23, 15, 1, 23, 51, 16920 }, // ř
+    { 14, 29, 16, 1, 28, 69, 16971 }, // Ś
+    { 13, 24, 15, 1, 23, 56, 17040 }, // ś
+    { 14, 29, 16, 1, 28, 73, 17096 }, // Ŝ
+    { 13, 24, 15, 1, 23, 61, 17169 }, // ŝ
+    { 14, 29, 16, 1, 22, 68, 17230 }, // Ş
+    { 13, 24, 15, 1, 17, 57, 17298 }, // ş
+    { 14, 29, 16, 1, 28, 74, 17355 }, // Š
+    { 13, 24, 15, 1, 23, 63, 17429 }, // š
+    { 17, 28, 18, 0, 21, 64, 17492 }, // Ţ
+    { 12, 27, 13, 0, 20, 55, 17556 }, // ţ
+    { 17, 28, 18, 0, 28, 66, 17611 }, // Ť
+    { 17, 24, 18, 0, 23, 57, 17677 }, // ť
+    { 17, 21, 18, 0, 21, 50, 17734 }, // Ŧ
+    { 12, 21, 13, 0, 20, 43, 17784 }, // ŧ
+    { 18, 29, 22, 2, 28, 78, 17827 }, // Ũ
+    { 15, 24, 19, 2, 23, 63, 17905 }, // ũ
+    { 18, 27, 22, 2, 26, 77, 17968 }, // Ū
+    { 15, 22, 19, 2, 21, 63, 18045 }, // ū
+    { 18, 29, 22, 2, 28, 79, 18108 }, // Ŭ
+    { 15, 24, 19, 2, 23, 63, 18187 }, // ŭ
+    { 18, 31, 22, 2, 30, 82, 18250 }, // Ů
+    { 15, 26, 19, 2, 25, 65, 18332 }, // ů
+    { 18, 29, 22, 2, 28, 84, 18397 }, // Ű
+    { 15, 24, 19, 2, 23, 67, 18481 }, // ű
+    { 18, 28, 22, 2, 21, 75, 18548 }, // Ų
+    { 15, 23, 19, 2, 16, 60, 18623 }, // ų
+    { 29, 28, 30, 0, 28, 134, 18683 }, // Ŵ
+    { 25, 23, 26, 0, 23, 100, 18817 }, // ŵ
+    { 19, 28, 20, 0, 28, 73, 18917 }, // Ŷ
+    { 17, 30, 18, 0, 23, 79, 18990 }, // ŷ
+    { 19, 27, 20, 0, 27, 69, 19069 }, // Ÿ
+    { 17, 28, 18, 0, 28, 70, 19138 }, // Ź
+    { 14, 23, 15, 0, 23, 51, 19208 }, // ź
+    { 17, 28, 18, 0, 28, 66, 19259 }, // Ż
+    { 14, 23, 15, 0, 23, 49, 19325 }, // ż
+    { 17, 28, 18, 0, 28, 74, 19374 }, // Ž
+    { 14, 23, 15, 0, 23, 58, 19448 }, // ž
+    { 10, 23, 13, 2, 23, 47, 19506 }, // ſ
+    { 24, 24, 26, 1, 23, 93, 19553 }, // Ơ
+    { 20, 20, 22, 1, 19, 62, 19646 }, // ơ
+    { 30, 23, 33, 1, 22, 115, 19708 }, // Ƣ
+    { 24, 24, 27, 1, 17, 92, 19823 }, // ƣ
+    { 21, 21, 22, 0, 21, 67, 19915 }, // Ƥ
+    { 16, 30, 19, 2, 23, 92, 19982 }, // ƥ
+    { 18, 24, 21, 2, 21, 70, 20074 }, // Ʀ
+    { 14, 23, 16, 1, 22, 55, 20144 }, // Ƨ
+    { 13, 18, 15, 1, 17, 41, 20199 }, // ƨ
+    { 17, 21, 18, 0, 21, 56, 20240 }, // Ʃ
+    { 15, 30, 15, -1, 23, 67, 20296 }, // ƪ
+    { 12, 27, 13, 0, 20, 54, 20363 }, // ƫ
+    { 18, 21, 19, 0, 21, 50, 20417 }, // Ƭ
+    { 12, 24, 13, 0, 23, 49, 20467 }, // ƭ
+    { 17, 28, 18, 0, 21, 63, 20516 }, // Ʈ
+    { 25, 24, 28, 2, 23, 80, 20579 }, // Ư
+    { 22, 20, 25, 2, 19, 68, 20659 }, // ư
+    { 9, 6, 0, -16, 23, 12, 20727 }, // ̀
+    { 9, 6, 0, -11, 23, 12, 20739 }, // ́
+    { 12, 6, 7, -6, 23, 18, 20751 }, // ̂
+    { 12, 6, 0, -16, 23, 16, 20769 }, // ̃
+    { 10, 4, 6, -5, 21, 13, 20785 }, // ̄
+    { 14, 4, 8, -7, 25, 18, 20798 }, // ̅
+    { 12, 6, 7, -6, 23, 16, 20816 }, // ̆
+    { 6, 6, 4, -3, 23, 7, 20832 }, // ̇
+    { 12, 4, 7, -6, 22, 12, 20839 }, // ̈
+    { 8, 8, 0, -13, 25, 13, 20851 }, // ̉
+    { 8, 8, 5, -4, 25, 18, 20864 }, // ̊
+    { 14, 6, 10, -5, 23, 22, 20882 }, // ̋
+    { 13, 6, 8, -6, 23, 18, 20904 }, // ̌
+    { 4, 6, 3, -2, 23, 10, 20922 }, // ̍
+    { 8, 6, 5, -4, 23, 13, 20932 }, // ̎
+    { 13, 6, 0, -17, 23, 22, 20945 }, // ̏
+    { 12, 8, 7, -6, 25, 22, 20967 }, // ̐
+    { 12, 6, 7, -6, 23, 18, 20989 }, // ̑
+    { 6, 8, 4, -3, 21, 15, 21007 }, // ̒
+    { 6, 8, 4, -3, 21, 13, 21022 }, // ̓
+    { 6, 8, 4, -3, 21, 13, 21035 }, // ̔
+    { 6, 8, 4, -3, 21, 13, 21048 }, // ̕
+    { 9, 6, 5, -5, -1, 11, 21061 }, // ̖
+    { 10, 6, 6, -5, -1, 12, 21072 }, // ̗
+    { 6, 7, 4, -3, 0, 14, 21084 }, // ̘
+    { 6, 7, 4, -3, 0, 13, 21098 }, // ̙
+    { 8, 8, 9, 0, 23, 17, 21111 }, // ̚
+    { 8, 8, 6, -3, 23, 13, 21128 }, // ̛
+    { 4, 7, 3, -2, 0, 11, 21141 }, // ̜
+    { 8, 6, 5, -4, -1, 9, 21152 }, // ̝
+    { 8, 6, 5, -4, -1, 9, 21161 }, // ̞
+    { 8, 7, 5, -4, 0, 10, 21170 }, // ̟
+    { 7, 3, 4, -4, -3, 6, 21180 }, // ̠
+    { 7, 9, 1, -7, 2, 16, 21186 }, // ̡
+    { 7, 9, 8, 0, 2, 16, 21202 }, // ̢
+    { 6, 6, 0, -13, -1, 7, 21218 }, // ̣
+    { 12, 4, 7, -6, -2, 12, 21225 }, // ̤
+    { 8, 8, 5, -4, 1, 18, 21237 }, // ̥
+    { 6, 6, 4, -3, -1, 8, 21255 }, // ̦
+    { 8, 7, 5, -4, 0, 13, 21263 }, // ̧
+    { 6, 8, 4, -3, 1, 13, 21276 }, // ̨
+    { 4, 6, 3, -2, -1, 10, 21289 }, // ̩
+    { 12, 6, 7, -6, -1, 19, 21299 }, // ̪
+    { 12, 5, 7, -6, -1, 14, 21318 }, // ̫
+    { 13, 6, 8, -6, 0, 18, 21332 }, // ̬
+    { 12, 6, 7, -6, -1, 18, 21350 }, // ̭
+    { 12, 6, 7, -6, -1, 17, 21368 }, // ̮
+    { 12, 6, 7, -6, -1, 18, 21385 }, // ̯
+    { 12, 6, 7, -6, -1, 17, 21403 }, // ̰
+    { 10, 4, 6, -5, -2, 13, 21420 }, // ̱
+    { 14, 3, 8, -7, -2, 16, 21433 }, // ̲
+    { 13, 7, 7, -7, 0, 31, 21449 }, // ̳
+    { 13, 6, 8, -6, 11, 15, 21480 }, // ̴
+    { 14, 4, 8, -7, 10, 18, 21495 }, // ̵
+    { 22, 4, 12, -11, 10, 29, 21513 }, // ̶
+    { 12, 9, 7, -6, 13, 18, 21542 }, // ̷
+    { 14, 25, 8, -7, 23, 50, 21560 }, // ̸
+    { 4, 7, 3, -2, 0, 11, 21610 }, // ̹
+    { 12, 6, 7, -6, -1, 22, 21621 }, // ̺
+    { 12, 7, 7, -6, 0, 23, 21643 }, // ̻
+    { 12, 5, 7, -6, -1, 14, 21666 }, // ̼
+    { 6, 7, 4, -3, 23, 14, 21680 }, // ̽
+    { 4, 10, 3, -2, 26, 13, 21694 }, // ̾
+    { 13, 7, 7, -7, 29, 31, 21707 }, // ̿
+    { 9, 6, 3, -7, 23, 11, 21738 }, // ̀
+    { 9, 6, 8, -2, 23, 12, 21749 }, // ́
+    { 13, 6, 8, -6, 23, 17, 21761 }, // ͂
+    { 6, 6, 4, -3, 23, 10, 21778 }, // ̓
+    { 17, 6, 11, -7, 23, 24, 21788 }, // ̈́
+    { 7, 6, 6, -2, -1, 10, 21812 }, // ͅ
+    { 14, 6, 8, -7, 23, 20, 21822 }, // ͆
+    { 13, 7, 7, -7, 0, 31, 21842 }, // ͇
+    { 8, 6, 5, -4, -1, 13, 21873 }, // ͈
+    { 6, 6, 4, -3, -1, 12, 21886 }, // ͉
+    { 12, 7, 7, -6, 23, 18, 21898 }, // ͊
+    { 12, 12, 7, -6, 28, 29, 21916 }, // ͋
+    { 12, 9, 7, -6, 26, 23, 21945 }, // ͌
+    { 12, 6, 7, -6, -1, 15, 21968 }, // ͍
+    { 6, 7, 4, -3, 0, 9, 21983 }, // ͎
+    { 22, 21, 12, -11, 21, 95, 21992 }, // ͏
+    { 6, 7, 4, -3, 24, 11, 22087 }, // ͐
+    { 5, 8, 4, -2, 24, 10, 22098 }, // ͑
+    { 12, 8, 7, -6, 25, 21, 22108 }, // ͒
+    { 6, 7, 4, -3, 0, 12, 22129 }, // ͓
+    { 6, 6, 4, -3, -1, 11, 22141 }, // ͔
+    { 6, 6, 4, -3, -1, 11, 22152 }, // ͕
+    { 12, 6, 7, -6, -1, 23, 22163 }, // ͖
+    { 5, 8, 4, -2, 24, 12, 22186 }, // ͗
+    { 6, 6, 9, 2, 23, 7, 22198 }, // ͘
+    { 8, 6, 5, -4, -1, 12, 22205 }, // ͙
+    { 12, 7, 7, -6, 0, 25, 22217 }, // ͚
+    { 6, 6, 4, -3, 23, 12, 22242 }, // ͛
+    { 24, 6, 13, -12, -1, 22, 22254 }, // ͜
+    { 24, 6, 13, -12, 23, 22, 22276 }, // ͝
+    { 18, 3, 10, -9, 20, 13, 22298 }, // ͞
+    { 18, 3, 10, -9, -2, 13, 22311 }, // ͟
+    { 24, 6, 13, -12, 23, 24, 22324 }, // ͠
+    { 24, 7, 13, -12, 26, 33, 22348 }, // ͡
+    { 24, 7, 14, -11, 0, 28, 22381 }, // ͢
+    { 8, 8, 5, -4, 25, 18, 22409 }, // ͣ
+    { 7, 8, 5, -3, 25, 15, 22427 }, // ͤ
+    { 3, 9, 3, -1, 27, 14, 22442 }, // ͥ
+    { 8, 8, 5, -4, 25, 20, 22456 }, // ͦ
+    { 8, 8, 5, -4, 25, 22, 22476 }, // ͧ
+    { 7, 8, 5, -3, 25, 14, 22498 }, // ͨ
+    { 8, 10, 5, -4, 27, 25, 22512 }, // ͩ
+    { 7, 9, 5, -3, 27, 19, 22537 }, // ͪ
+    { 12, 7, 7, -6, 25, 29, 22556 }, // ͫ
+    { 6, 7, 5, -2, 25, 15, 22585 }, // ͬ
+    { 6, 9, 4, -3, 26, 16, 22600 }, // ͭ
+    { 9, 7, 6, -4, 25, 18, 22616 }, // ͮ
+    { 8, 7, 5, -4, 25, 18, 22634 }, // ͯ
+    { 21, 21, 22, 0, 21, 67, 22652 }, // Α
+    { 16, 21, 19, 2, 21, 68, 22719 }, // Β
+    { 12, 21, 15, 2, 21, 34, 22787 }, // Γ
+    { 20, 21, 21, 0, 21, 70, 22821 }, // Δ
+    { 13, 21, 16, 2, 21, 49, 22891 }, // Ε
+    { 17, 21, 18, 0, 21, 55, 22940 }, // Ζ
+    { 18, 21, 22, 2, 21, 66, 22995 }, // Η
+    { 21, 23, 23, 1, 22, 91, 23061 }, // Θ
+    { 11, 21, 12, 0, 21, 39, 23152 }, // Ι
+    { 18, 21, 21, 2, 21, 68, 23191 }, // Κ
+    { 20, 21, 21, 0, 21, 65, 23259 }, // Λ
+    { 23, 21, 28, 2, 21, 98, 23324 }, // Μ
+    { 20, 21, 24, 2, 21, 84, 23422 }, // Ν
+    { 16, 21, 18, 1, 21, 52, 23506 }, // Ξ
+    { 21, 23, 23, 1, 22, 84, 23558 }, // Ο
+    { 18, 21, 22, 2, 21, 55, 23642 }, // Π
+    { 15, 21, 18, 2, 21, 55, 23697 }, // Ρ
+    { 17, 21, 18, 0, 21, 56, 23752 }, // Σ
+    { 17, 21, 18, 0, 21, 46, 23808 }, // Τ
+    { 19, 21, 20, 0, 21, 53, 23854 }, // Υ
+    { 25, 22, 27, 1, 21, 89, 23907 }, // Φ
+    { 20, 21, 21, 0, 21, 66, 23996 }, // Χ
+    { 22, 21, 26, 2, 21, 73, 24062 }, // Ψ
+    { 22, 22, 23, 0, 22, 79, 24135 }, // Ω
+    { 18, 18, 20, 1, 17, 63, 24214 }, // α
+    { 16, 30, 19, 2, 23, 86, 24277 }, // β
+    { 16, 23, 17, 0, 16, 56, 24363 }, // γ
+    { 16, 24, 18, 1, 23, 68, 24419 }, // δ
+    { 13, 18, 15, 1, 17, 43, 24487 }, // ε
+    { 14, 29, 16, 1, 23, 58, 24530 }, // ζ
+    { 15, 24, 19, 2, 17, 68, 24588 }, // η
+    { 16, 24, 18, 1, 23, 68, 24656 }, // θ
+    { 9, 17, 12, 2, 16, 34, 24724 }, // ι
+    { 17, 16, 20, 2, 16, 55, 24758 }, // κ
+    { 17, 24, 18, 0, 23, 64, 24813 }, // λ
+    { 17, 23, 20, 2, 16, 66, 24877 }, // μ
+    { 16, 16, 17, 0, 16, 43, 24943 }, // ν
+    { 14, 29, 16, 1, 23, 64, 24986 }, // ξ
+    { 16, 18, 18, 1, 17, 48, 25050 }, // ο
+    { 21, 17, 22, 0, 16, 59, 25098 }, // π
+    { 16, 24, 18, 1, 17, 62, 25157 }, // ρ
+    { 14, 23, 16, 1, 17, 52, 25219 }, // ς
+    { 17, 17, 19, 1, 16, 52, 25271 }, // σ
+    { 15, 17, 16, 0, 16, 43, 25323 }, // τ
+    { 15, 17, 19, 2, 16, 47, 25366 }, // υ
+    { 22, 30, 24, 1, 23, 91, 25413 }, // φ
+    { 19, 25, 20, 0, 17, 72, 25504 }, // χ
+    { 21, 30, 24, 2, 23, 88, 25576 }, // ψ
+    { 23, 17, 25, 1, 16, 77, 25664 }, // ω
+    { 21, 28, 22, 0, 21, 80, 25741 }, // Ạ
+    { 15, 24, 17, 1, 17, 60, 25821 }, // ạ
+    { 21, 30, 22, 0, 30, 88, 25881 }, // Ả
+    { 15, 26, 17, 1, 25, 68, 25969 }, // ả
+    { 21, 29, 22, 0, 29, 92, 26037 }, // Ấ
+    { 18, 25, 20, 1, 24, 76, 26129 }, // ấ
+    { 21, 29, 22, 0, 29, 94, 26205 }, // Ầ
+    { 17, 25, 17, -1, 24, 73, 26299 }, // ầ
+    { 21, 31, 22, 0, 31, 97, 26372 }, // Ẩ
+    { 16, 27, 18, 1, 26, 78, 26469 }, // ẩ
+    { 21, 31, 22, 0, 31, 103, 26547 }, // Ẫ
+    { 15, 27, 17, 1, 26, 78, 26650 }, // ẫ
+    { 21, 35, 22, 0, 28, 102, 26728 }, // Ậ
+    { 15, 30, 17, 1, 23, 77, 26830 }, // ậ
+    { 21, 30, 22, 0, 30, 93, 26907 }, // Ắ
+    { 15, 26, 17, 1, 25, 71, 27000 }, // ắ
+    { 21, 30, 22, 0, 30, 94, 27071 }, // Ằ
+    { 15, 26, 17, 1, 25, 71, 27165 }, // ằ
+    { 21, 31, 22, 0, 31, 94, 27236 }, // Ẳ
+    { 15, 27, 17, 1, 26, 72, 27330 }, // ẳ
+    { 21, 31, 22, 0, 31, 101, 27402 }, // Ẵ
+    { 15, 27, 17, 1, 26, 76, 27503 }, // ẵ
+    { 21, 35, 22, 0, 28, 99, 27579 }, // Ặ
+    { 15, 30, 17, 1, 23, 78, 27678 }, // ặ
+    { 13, 28, 16, 2, 21, 59, 27756 }, // Ẹ
+    { 16, 24, 18, 1, 17, 55, 27815 }, // ẹ
+    { 13, 30, 16, 2, 30, 66, 27870 }, // Ẻ
+    { 16, 26, 18, 1, 25, 64, 27936 }, // ẻ
+    { 13, 28, 16, 2, 28, 66, 28000 }, // Ẽ
+    { 16, 24, 18, 1, 23, 62, 28066 }, // ẽ
+    { 16, 29, 19, 2, 29, 81, 28128 }, // Ế
+    { 18, 25, 20, 1, 24, 67, 28209 }, // ế
+    { 17, 29, 16, -2, 29, 81, 28276 }, // Ề
+    { 18, 25, 18, -1, 24, 68, 28357 }, // ề
+    { 14, 31, 17, 2, 31, 82, 28425 }, // Ể
+    { 17, 27, 19, 1, 26, 69, 28507 }, // ể
+    { 13, 31, 16, 2, 31, 79, 28576 }, // Ễ
+    { 16, 27, 18, 1, 26, 70, 28655 }, // ễ
+    { 13, 35, 16, 2, 28, 76, 28725 }, // Ệ
+    { 16, 30, 18, 1, 23, 73, 28801 }, // ệ
+    { 11, 30, 12, 0, 30, 53, 28874 }, // Ỉ
+    { 8, 25, 10, 1, 25, 39, 28927 }, // ỉ
+    { 11, 28, 12, 0, 21, 48, 28966 }, // Ị
+    { 6, 30, 9, 1, 23, 39, 29014 }, // ị
+    { 21, 29, 23, 1, 22, 96, 29053 }, // Ọ
+    { 16, 24, 18, 1, 17, 59, 29149 }, // ọ
+    { 21, 31, 23, 1, 30, 102, 29208 }, // Ỏ
+    { 16, 26, 18, 1, 25, 67, 29310 }, // ỏ
+    { 21, 30, 23, 1, 29, 109, 29377 }, // Ố
+    { 18, 25, 20, 1, 24, 74, 29486 }, // ố
+    { 21, 30, 23, 1, 29, 109, 29560 }, // Ồ
+    { 18, 25, 18, -1, 24, 74, 29669 }, // ồ
+    { 21, 32, 23, 1, 31, 113, 29743 }, // Ổ
+    { 17, 27, 19, 1, 26, 75, 29856 }, // ổ
+    { 21, 32, 23, 1, 31, 117, 29931 }, // Ỗ
+    { 16, 27, 18, 1, 26, 74, 30048 }, // ỗ
+    { 21, 35, 23, 1, 28, 113, 30122 }, // Ộ
+    { 16, 30, 18, 1, 23, 78, 30235 }, // ộ
+    { 24, 29, 26, 1, 28, 109, 30313 }, // Ớ
+    { 20, 24, 22, 1, 23, 75, 30422 }, // ớ
+    { 24, 29, 26, 1, 28, 108, 30497 }, // Ờ
+    { 20, 24, 22, 1, 23, 75, 30605 }, // ờ
+    { 24, 31, 26, 1, 30, 113, 30680 }, // Ở
+    { 20, 26, 22, 1, 25, 78, 30793 }, // ở
+    { 24, 29, 26, 1, 28, 111, 30871 }, // Ỡ
+    { 20, 24, 22, 1, 23, 77, 30982 }, // ỡ
+    { 24, 30, 26, 1, 23, 107, 31059 }, // Ợ
+    { 20, 26, 22, 1, 19, 72, 31166 }, // ợ
+    { 18, 28, 22, 2, 21, 71, 31238 }, // Ụ
+    { 15, 23, 19, 2, 16, 55, 31309 }, // ụ
+    { 18, 31, 22, 2, 30, 80, 31364 }, // Ủ
+    { 15, 26, 19, 2, 25, 65, 31444 }, // ủ
+    { 25, 29, 28, 2, 28, 96, 31509 }, // Ứ
+    { 22, 24, 25, 2, 23, 79, 31605 }, // ứ
+    { 25, 29, 28, 2, 28, 96, 31684 }, // Ừ
+    { 22, 24, 25, 2, 23, 81, 31780 }, // ừ
+    { 25, 31, 28, 2, 30, 101, 31861 }, // Ử
+    { 22, 26, 25, 2, 25, 85, 31962 }, // ử
+    { 25, 29, 28, 2, 28, 99, 32047 }, // Ữ
+    { 22, 24, 25, 2, 23, 82, 32146 }, // ữ
+    { 25, 30, 28, 2, 23, 93, 32228 }, // Ự
+    { 22, 26, 25, 2, 19, 81, 32321 }, // ự
+    { 19, 28, 20, 0, 28, 68, 32402 }, // Ỳ
+    { 17, 30, 18, 0, 23, 76, 32470 }, // ỳ
+    { 19, 28, 20, 0, 21, 65, 32546 }, // Ỵ
+    { 17, 23, 18, 0, 16, 66, 32611 }, // ỵ
+    { 19, 30, 20, 0, 30, 73, 32677 }, // Ỷ
+    { 17, 32, 18, 0, 25, 79, 32750 }, // ỷ
+    { 19, 28, 20, 0, 28, 71, 32829 }, // Ỹ
+    { 17, 30, 18, 0, 23, 78, 32900 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 32978 }, //  
+    { 0, 0, 29, 0, 0, 0, 32978 }, //  
+    { 0, 0, 15, 0, 0, 0, 32978 }, //  
+    { 0, 0, 29, 0, 0, 0, 32978 }, //  
+    { 0, 0, 10, 0, 0, 0, 32978 }, //  
+    { 0, 0, 7, 0, 0, 0, 32978 }, //  
+    { 0, 0, 5, 0, 0, 0, 32978 }, //  
+    { 0, 0, 17, 0, 0, 0, 32978 }, //  
+    { 0, 0, 8, 0, 0, 0, 32978 }, //  
+    { 0, 0, 5, 0, 0, 0, 32978 }, //  
+    { 0, 0, 3, 0, 0, 0, 32978 }, //  
+    { 0, 0, 1, 0, 0, 0, 32978 }, // ​
+    { 0, 0, 1, 0, 0, 0, 32978 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 32978 }, // ‍
+    { 8, 25, 8, -1, 21, 45, 32978 }, // ‎
+    { 8, 25, 2, -7, 21, 45, 33023 }, // ‏
+    { 9, 4, 10, 0, 10, 11, 33068 }, // ‐
+    { 9, 4, 10, 0, 10, 11, 33079 }, // ‑
+    { 15, 4, 17, 1, 12, 15, 33090 }, // ‒
+    { 13, 4, 15, 1, 10, 13, 33105 }, // –
+    { 28, 4, 30, 1, 10, 27, 33118 }, // —
+    { 28, 4, 30, 1, 10, 27, 33145 }, // ―
+    { 12, 30, 16, 2, 23, 90, 33172 }, // ‖
+    { 14, 7, 14, -1, 0, 31, 33262 }, // ‗
+    { 6, 8, 7, 0, 21, 14, 33293 }, // ‘
+    { 6, 8, 7, 0, 21, 13, 33307 }, // ’
+    { 7, 8, 8, 0, 4, 13, 33320 }, // ‚
+    { 6, 8, 7, 0, 21, 13, 33333 }, // ‛
+    { 13, 8, 14, 0, 21, 27, 33346 }, // “
+    { 13, 8, 14, 0, 21, 26, 33373 }, // ”
+    { 14, 8, 15, 0, 4, 24, 33399 }, // „
+    { 13, 8, 14, 0, 21, 25, 33423 }, // ‟
+    { 13, 23, 15, 1, 23, 52, 33448 }, // †
+    { 13, 23, 15, 1, 23, 47, 33500 }, // ‡
+    { 9, 10, 11, 1, 16, 19, 33547 }, // •
+    { 10, 12, 12, 1, 17, 22, 33566 }, // ‣
+    { 6, 6, 15, 4, 5, 11, 33588 }, // ․
+    { 15, 6, 17, 1, 5, 20, 33599 }, // ‥
+    { 23, 6, 25, 1, 5, 30, 33619 }, // …
+    { 6, 6, 8, 1, 11, 9, 33649 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 33658 }, //  
+    { 0, 0, 18, 0, 0, 0, 33658 }, //  
+    { 8, 22, 8, -1, 18, 38, 33658 }, // ‪
+    { 8, 22, 2, -7, 18, 38, 33696 }, // ‫
+    { 8, 25, 5, -4, 21, 40, 33734 }, // ‬
+    { 8, 25, 5, -4, 21, 38, 33774 }, // ‭
+    { 8, 25, 5, -4, 21, 38, 33812 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 33850 }, //  
+    { 37, 23, 38, 0, 22, 146, 33850 }, // ‰
+    { 48, 23, 49, 0, 22, 188, 33996 }, // ‱
+    { 9, 8, 11, 1, 21, 13, 34184 }, // ′
+    { 15, 8, 17, 1, 21, 26, 34197 }, // ″
+    { 21, 8, 23, 1, 21, 38, 34223 }, // ‴
+    { 9, 8, 12, 1, 21, 14, 34261 }, // ‵
+    { 15, 8, 19, 1, 21, 26, 34275 }, // ‶
+    { 22, 8, 25, 1, 21, 39, 34301 }, // ‷
+    { 12, 10, 13, 0, 3, 25, 34340 }, // ‸
+    { 9, 14, 11, 1, 15, 22, 34365 }, // ‹
+    { 9, 14, 11, 1, 15, 23, 34387 }, // ›
+    { 23, 23, 25, 1, 22, 101, 34410 }, // ※
+    { 14, 22, 17, 1, 21, 64, 34511 }, // ‼
+    { 14, 23, 15, 0, 22, 51, 34575 }, // ‽
+    { 16, 4, 16, -1, 26, 10, 34626 }, // ‾
+    { 18, 7, 19, 0, 0, 22, 34636 }, // ‿
+    { 18, 8, 19, 0, 24, 20, 34658 }, // ⁀
+    { 12, 19, 13, 0, 12, 42, 34678 }, // ⁁
+    { 33, 28, 34, 0, 23, 142, 34720 }, // ⁂
+    { 9, 4, 11, 1, 10, 11, 34862 }, // ⁃
+    { 16, 21, 11, -6, 21, 42, 34873 }, // ⁄
+    { 7, 26, 10, 2, 21, 32, 34915 }, // ⁅
+    { 8, 26, 10, 0, 21, 50, 34947 }, // ⁆
+    { 28, 23, 29, 0, 22, 93, 34997 }, // ⁇
+    { 21, 23, 22, 0, 22, 71, 35090 }, // ⁈
+    { 21, 23, 23, 1, 22, 76, 35161 }, // ⁉
+    { 15, 16, 17, 1, 16, 36, 35237 }, // ⁊
+    { 16, 27, 19, 2, 23, 89, 35273 }, // ⁋
+    { 16, 15, 19, 1, 16, 58, 35362 }, // ⁌
+    { 16, 15, 19, 2, 16, 54, 35420 }, // ⁍
+    { 15, 15, 16, 0, 8, 42, 35474 }, // ⁎
+    { 7, 21, 9, 1, 17, 25, 35516 }, // ⁏
+    { 18, 31, 19, 0, 24, 59, 35541 }, // ⁐
+    { 15, 30, 16, 0, 23, 83, 35600 }, // ⁑
+    { 13, 23, 14, 0, 22, 54, 35683 }, // ⁒
+    { 28, 6, 30, 1, 11, 30, 35737 }, // ⁓
+    { 18, 7, 19, 0, 0, 25, 35767 }, // ⁔
+    { 16, 15, 17, 0, 15, 51, 35792 }, // ⁕
+    { 15, 23, 17, 1, 22, 41, 35843 }, // ⁖
+    { 27, 8, 29, 1, 21, 51, 35884 }, // ⁗
+    { 23, 23, 25, 1, 22, 58, 35935 }, // ⁘
+    { 23, 23, 25, 1, 22, 63, 35993 }, // ⁙
+    { 6, 23, 8, 1, 22, 22, 36056 }, // ⁚
+    { 18, 24, 20, 1, 23, 52, 36078 }, // ⁛
+    { 23, 23, 25, 1, 22, 74, 36130 }, // ⁜
+    { 6, 24, 8, 1, 23, 29, 36204 }, // ⁝
+    { 6, 23, 8, 1, 22, 35, 36233 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 36268 }, //  
+    { 0, 0, 18, 0, 0, 0, 36268 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 36268 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 36268 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 36268 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 36268 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 36268 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 36268 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 36268 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 36268 }, // ⁩
+    { 8, 25, 5, -4, 21, 39, 36268 }, // ⁪
+    { 8, 25, 5, -4, 21, 42, 36307 }, // ⁫
+    { 8, 25, 5, -4, 21, 37, 36349 }, // ⁬
+    { 8, 25, 5, -4, 21, 37, 36386 }, // ⁭
+    { 8, 25, 5, -4, 21, 41, 36423 }, // ⁮
+    { 8, 25, 5, -4, 21, 38, 36464 }, // ⁯
+    { 11, 14, 12, 0, 25, 32, 36502 }, // ⁰
+    { 4, 14, 6, 1, 22, 21, 36534 }, // ⁱ
+    { 11, 13, 12, 0, 25, 29, 36555 }, // ⁴
+    { 10, 14, 12, 1, 25, 29, 36584 }, // ⁵
+    { 11, 14, 12, 0, 25, 31, 36613 }, // ⁶
+    { 11, 13, 12, 0, 25, 26, 36644 }, // ⁷
+    { 11, 14, 12, 0, 25, 36, 36670 }, // ⁸
+    { 11, 14, 12, 0, 25, 34, 36706 }, // ⁹
+    { 9, 9, 11, 1, 22, 20, 36740 }, // ⁺
+    { 9, 3, 11, 1, 19, 11, 36760 }, // ⁻
+    { 9, 7, 11, 1, 21, 16, 36771 }, // ⁼
+    { 6, 17, 8, 1, 27, 27, 36787 }, // ⁽
+    { 6, 17, 7, 0, 27, 27, 36814 }, // ⁾
+    { 10, 11, 12, 1, 19, 28, 36841 }, // ⁿ
+    { 11, 14, 12, 0, 9, 32, 36869 }, // ₀
+    { 9, 13, 11, 0, 9, 19, 36901 }, // ₁
+    { 10, 13, 11, 0, 9, 26, 36920 }, // ₂
+    { 11, 14, 12, 0, 9, 30, 36946 }, // ₃
+    { 11, 13, 12, 0, 9, 29, 36976 }, // ₄
+    { 10, 14, 12, 1, 9, 29, 37005 }, // ₅
+    { 11, 14, 12, 0, 9, 31, 37034 }, // ₆
+    { 11, 13, 12, 0, 9, 26, 37065 }, // ₇
+    { 11, 14, 12, 0, 9, 36, 37091 }, // ₈
+    { 11, 14, 12, 0, 9, 34, 37127 }, // ₉
+    { 9, 9, 11, 1, 7, 20, 37161 }, // ₊
+    { 9, 3, 11, 1, 4, 11, 37181 }, // ₋
+    { 9, 7, 11, 1, 6, 16, 37192 }, // ₌
+    { 6, 17, 8, 1, 11, 27, 37208 }, // ₍
+    { 6, 17, 7, 0, 11, 27, 37235 }, // ₎
+    { 10, 10, 11, 0, 7, 23, 37262 }, // ₐ
+    { 11, 10, 12, 0, 7, 27, 37285 }, // ₑ
+    { 11, 10, 12, 0, 7, 25, 37312 }, // ₒ
+    { 11, 10, 12, 0, 7, 26, 37337 }, // ₓ
+    { 11, 10, 12, 0, 7, 26, 37363 }, // ₔ
+    { 10, 14, 12, 1, 11, 34, 37389 }, // ₕ
+    { 11, 14, 13, 1, 11, 41, 37423 }, // ₖ
+    { 4, 14, 6, 1, 11, 22, 37464 }, // ₗ
+    { 17, 10, 19, 1, 7, 49, 37486 }, // ₘ
+    { 10, 10, 12, 1, 7, 27, 37535 }, // ₙ
+    { 11, 14, 13, 1, 7, 40, 37562 }, // ₚ
+    { 9, 10, 10, 0, 7, 22, 37602 }, // ₛ
+    { 8, 12, 9, 0, 9, 22, 37624 }, // ₜ
+    { 17, 22, 18, 0, 22, 66, 37646 }, // ₠
+    { 18, 25, 19, 0, 23, 95, 37712 }, // ₡
+    { 16, 23, 18, 1, 22, 72, 37807 }, // ₢
+    { 16, 21, 17, 0, 21, 57, 37879 }, // ₣
+    { 16, 22, 18, 1, 22, 61, 37936 }, // ₤
+    { 25, 24, 28, 2, 20, 96, 37997 }, // ₥
+    { 17, 21, 18, 0, 21, 80, 38093 }, // ₦
+    { 23, 22, 26, 2, 21, 79, 38173 }, // ₧
+    { 24, 22, 27, 2, 21, 96, 38252 }, // ₨
+    { 22, 21, 23, 0, 21, 103, 38348 }, // ₩
+    { 23, 21, 27, 2, 21, 135, 38451 }, // ₪
+    { 18, 28, 20, 1, 23, 93, 38586 }, // ₫
+    { 17, 22, 18, 0, 21, 59, 38679 }, // €
+    { 17, 21, 18, 0, 21, 66, 38738 }, // ₭
+    { 17, 21, 18, 0, 21, 57, 38804 }, // ₮
+    { 29, 29, 30, 0, 22, 121, 38861 }, // ₯
+    { 17, 29, 18, 0, 22, 81, 38982 }, // ₰
+    { 17, 21, 18, 0, 21, 58, 39063 }, // ₱
+    { 18, 26, 21, 1, 23, 86, 39121 }, // ₲
+    { 19, 21, 20, 0, 21, 69, 39207 }, // ₳
+    { 17, 23, 18, 0, 22, 70, 39276 }, // ₴
+    { 17, 26, 19, 1, 23, 78, 39346 }, // ₵
+    { 20, 21, 21, 0, 20, 75, 39424 }, // ₶
+    { 21, 25, 22, 0, 22, 90, 39499 }, // ₷
+    { 17, 21, 18, 0, 21, 52, 39589 }, // ₸
+    { 15, 21, 17, 1, 21, 50, 39641 }, // ₹
+    { 16, 22, 17, 0, 21, 57, 39691 }, // ₺
+    { 24, 23, 25, 0, 22, 87, 39748 }, // ₻
+    { 24, 21, 26, 1, 21, 71, 39835 }, // ₼
+    { 17, 21, 18, 0, 21, 62, 39906 }, // ₽
+    { 21, 23, 23, 1, 23, 97, 39968 }, // ₾
+    { 14, 27, 17, 2, 24, 86, 40065 }, // ₿
+    { 14, 23, 16, 1, 17, 58, 40151 }, // ⃀
+    { 15, 4, 17, 1, 12, 17, 40209 }, // −
+    { 27, 28, 29, 1, 23, 112, 40226 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
@@ -4509,4 +3344,5 @@ static const EpdFontData notosans_14_bold = {
     32,
     -9,
     true,
+    true,
 };
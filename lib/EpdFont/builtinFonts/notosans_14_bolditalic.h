@@ -2,4723 +2,3360 @@
  * generated by fontconvert.py
  * name: notosans_14_bolditalic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_bolditalicBitmaps[62894] = {
-    0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x00, 0x7F, 0x80, 0x00, 0x40, 0x00, 0x0F, 0xE1, 0xFD, 0x1F, 0xD2, 0xFC, 0x1F, 0xC2, 0xFC,
-    0x2F, 0xC3, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x43, 0xF0, 0x3F, 0x03, 0xF0, 0x2A, 0x02, 0x90, 0x00,
-    0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0xBD,
-    0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F, 0xC1, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x02,
-    0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00,
-    0x0B, 0xD0, 0xFD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x0B, 0xE0,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xBE, 0xFC, 0x03,
-    0xFD, 0x3C, 0x04, 0x03, 0xFC, 0x78, 0x00, 0x03, 0xFE, 0xB4, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x03, 0xCF, 0xF8, 0x00, 0x03, 0xCB, 0xF8, 0x74, 0x07, 0x8F, 0xF8, 0x7F, 0xEF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x40, 0x06, 0xBF, 0xE4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x7E, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xD3,
-    0xF8, 0x02, 0xF8, 0x00, 0xBF, 0x0F, 0xE0, 0x1F, 0xC0, 0x03, 0xF8, 0x3F, 0x80, 0xFC, 0x00, 0x0F,
-    0xD0, 0xFE, 0x0F, 0xD0, 0x00, 0x7F, 0x07, 0xF4, 0xBE, 0x00, 0x01, 0xFC, 0x2F, 0xC7, 0xF1, 0xBE,
-    0x07, 0xF5, 0xFE, 0x3F, 0x2F, 0xFF, 0x0F, 0xFF, 0xF3, 0xF5, 0xFF, 0xFE, 0x2F, 0xFF, 0x6F, 0x8F,
-    0xF3, 0xFC, 0x1F, 0xE1, 0xFC, 0x7F, 0x4B, 0xF0, 0x00, 0x0F, 0xD2, 0xFC, 0x2F, 0xC0, 0x00, 0xFE,
-    0x0F, 0xE0, 0xFF, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF8, 0x00, 0x7F, 0x00, 0xFD, 0x1F, 0xD0, 0x03,
-    0xF4, 0x03, 0xF4, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xFF, 0xF4, 0x02, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x1F, 0xC0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xE1, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0x02, 0xFE,
-    0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x02, 0xFF, 0x07, 0xFD, 0xFF, 0x80, 0xFF, 0x80, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xD0, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0xD0, 0x03, 0xFF, 0x96, 0xFF, 0xF4, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x47, 0xFE, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xFD, 0x1F, 0xC2, 0xFC, 0x2F, 0x83, 0xF4, 0x3F, 0x02,
-    0xA0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x2F, 0xD0, 0x01, 0xFE, 0x00, 0x0F,
-    0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x1F,
-    0xE0, 0x00, 0xBF, 0x40, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00,
-    0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x02, 0xFD,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x2E, 0x07, 0xE0, 0x00, 0xFF, 0xAF, 0x40,
-    0x07, 0xFF, 0xFE, 0xBF, 0x41, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xFF, 0x81, 0x40,
-    0xBF, 0xBF, 0x00, 0x07, 0xFC, 0xBE, 0x00, 0x0B, 0xC1, 0xFC, 0x00, 0x05, 0x03, 0xF4, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x7F, 0x55, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x54, 0x03, 0xFD,
-    0x07, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x2A, 0xAA, 0x4F, 0xFF,
-    0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x05, 0x03, 0xFC, 0xBF, 0xDB, 0xFC, 0x7F, 0x80, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xDB, 0xFD,
-    0x03, 0xFF, 0x03, 0xFE, 0x07, 0xFD, 0x02, 0xFF, 0x0F, 0xFC, 0x02, 0xFF, 0x0F, 0xF4, 0x02, 0xFF,
-    0x1F, 0xF0, 0x02, 0xFE, 0x2F, 0xF0, 0x02, 0xFE, 0x3F, 0xE0, 0x03, 0xFE, 0x3F, 0xE0, 0x03, 0xFD,
-    0x3F, 0xD0, 0x07, 0xFC, 0x3F, 0xD0, 0x0B, 0xFC, 0x3F, 0xD0, 0x0F, 0xF8, 0x3F, 0xD0, 0x1F, 0xF0,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0xF5, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0xC0, 0x07,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xF8, 0x1F, 0xFF, 0xFD, 0x0F, 0xFE, 0xFF, 0x02, 0xFD, 0x7F, 0xC0, 0x38,
-    0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xEB, 0xFF, 0x40, 0x0F, 0x40, 0x3F, 0xE0, 0x01, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xEA, 0xAA, 0x40, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x90, 0x01, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFE, 0x5F, 0xFE, 0x00,
-    0x60, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x01, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x40,
-    0x00, 0x2F, 0xF0, 0xF9, 0x45, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x6F,
-    0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x1F, 0xE1,
-    0xFF, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x0F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xFE,
-    0xAF, 0xFE, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xBF, 0xE9, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x06, 0x56, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x40, 0x00, 0x3F, 0xF0, 0x2F, 0x95, 0xBF, 0xF8, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xF9, 0x58, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xE0, 0x64, 0x00, 0x3F, 0xDB, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xF0, 0x2F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0x40, 0x1F, 0xF0, 0xBF,
-    0x80, 0x2F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0x7F, 0xE5, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xE0, 0x0F, 0xF0, 0x0B, 0xF8, 0x07, 0xF8, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x0F, 0xFC,
-    0x02, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x02,
-    0xFE, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8, 0x0F, 0xFD, 0x7F, 0xF0, 0xBF, 0xC0, 0x3F, 0xD3, 0xFE, 0x00,
-    0xFF, 0x4F, 0xF0, 0x03, 0xFE, 0x3F, 0xC0, 0x0F, 0xF8, 0xFF, 0x00, 0x7F, 0xD3, 0xFE, 0x03, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0x7F, 0x80, 0x1A, 0x92, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x09, 0x46, 0xFF, 0xD0, 0x3F, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xC0, 0xBF, 0xD0, 0xBF, 0xC0, 0x7F, 0x80,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xD0, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x2F,
-    0xC0, 0x03, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFE,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0x80,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA5, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0x8A, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0xE0, 0x01, 0xBF, 0xFD, 0x00, 0xBF, 0xFE, 0x40, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x2F, 0x96, 0xFF, 0x06, 0x00, 0x3F,
-    0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE,
-    0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xC0,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x00, 0x2F, 0xF0,
-    0x01, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xF0, 0x0B, 0xFF,
-    0xE0, 0xFD, 0x1F, 0xC0, 0x7F, 0xFF, 0xF0, 0xBE, 0x3F, 0x81, 0xFF, 0x5F, 0xE0, 0xBE, 0x3F, 0x03,
-    0xF8, 0x0F, 0xD0, 0x7E, 0x7F, 0x07, 0xF0, 0x0F, 0xC0, 0xBE, 0xBE, 0x0F, 0xE0, 0x1F, 0xC0, 0xFD,
-    0xBE, 0x0F, 0xD0, 0x2F, 0x80, 0xFC, 0xBE, 0x0F, 0xC0, 0x3F, 0x42, 0xFC, 0xBE, 0x0F, 0xD0, 0xBF,
-    0x07, 0xF4, 0xBE, 0x0F, 0xFB, 0xFF, 0xAF, 0xE0, 0x7F, 0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x3F, 0x41,
-    0xFE, 0x07, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x40, 0x17, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x03,
-    0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x0F, 0xF4, 0x07,
-    0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xC1, 0xFF, 0x00,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xE4,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0x80, 0x3F, 0xF0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x02, 0xFF, 0xAB, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x40,
-    0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xAB, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x40,
-    0x01, 0xFF, 0xE5, 0xAF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F,
-    0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x2F, 0xF0, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0xFF, 0x00,
-    0x03, 0xFE, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE,
-    0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0xAF, 0xE0, 0x0B, 0xFF, 0x40, 0x02, 0x40, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0xAA, 0xAA, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0xD0, 0x2F, 0xFF, 0xD1, 0xFF,
-    0x40, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x40, 0xFF, 0xD0, 0x03, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0xAA, 0xAF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00,
-    0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x1A, 0xBF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0xE0, 0x00,
-    0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x02,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x2F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF,
-    0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x03, 0xFB,
-    0xF8, 0x00, 0xFE, 0xFD, 0x00, 0x7F, 0xBF, 0x40, 0x1F, 0xDF, 0xD0, 0x0F, 0xEB, 0xF4, 0x02, 0xFD,
-    0xFD, 0x01, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xD0, 0x3F, 0x8F, 0xF0, 0x03, 0xFC, 0xFE, 0x07, 0xF1,
-    0xFE, 0x00, 0x3F, 0x8B, 0xE0, 0xFE, 0x2F, 0xD0, 0x07, 0xF4, 0xBE, 0x1F, 0xC3, 0xFC, 0x00, 0xBF,
-    0x0B, 0xE3, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xFF, 0xE0,
-    0x7F, 0x80, 0x1F, 0xE0, 0x7F, 0xFC, 0x0B, 0xF4, 0x01, 0xFD, 0x07, 0xFF, 0x80, 0xFF, 0x00, 0x2F,
-    0xC0, 0x7F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFE, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0xC0,
-    0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x07,
-    0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xD0,
-    0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xEF, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x6F, 0xE0, 0x1F,
-    0xE0, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x02, 0xFD, 0x00, 0x3F, 0xC2, 0xFE,
-    0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF1, 0xFE, 0x00, 0x2F, 0xD0,
-    0x2F, 0xE7, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0xEF, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
-    0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x0F, 0xFF, 0x40,
-    0x0F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F,
-    0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x1F,
-    0xF0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEA, 0x50, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFC, 0x00, 0x03, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFD,
-    0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF5,
-    0xBF, 0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC3, 0xFD, 0x00, 0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x1F, 0xF0, 0x0F,
-    0xF8, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x3F,
-    0xD0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0xFC, 0x03, 0xFF, 0x00, 0x10, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x50, 0x00, 0x7F, 0xD0, 0x7E, 0x56, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE7, 0xFC, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0xFF, 0x83,
-    0xFC, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x2F, 0xE0, 0x02, 0xFD, 0x03, 0xFC, 0x00, 0x1F,
-    0xD0, 0xBF, 0x80, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x1F, 0xE2, 0xFE, 0x00, 0x00, 0xFE, 0x3F, 0xC0,
-    0x00, 0x0F, 0xEB, 0xF8, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x0B, 0xF9, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xC7, 0xF8,
-    0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x1F, 0xE0, 0x03, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0x80, 0x0F, 0xFE,
-    0x00, 0x7F, 0xC0, 0xFF, 0x00, 0xBF, 0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFF, 0xE0, 0x0F, 0xF0,
-    0x0F, 0xF0, 0x2F, 0xEF, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFE, 0xBF, 0x03, 0xFC, 0x00, 0xFF, 0x07,
-    0xF2, 0xFC, 0x1F, 0xE0, 0x03, 0xFC, 0x3F, 0xCB, 0xF0, 0xFF, 0x40, 0x0F, 0xF1, 0xFD, 0x2F, 0xC7,
-    0xFC, 0x00, 0x3F, 0xCF, 0xF0, 0xBF, 0x2F, 0xD0, 0x00, 0xFF, 0x3F, 0x42, 0xFC, 0xFF, 0x00, 0x03,
-    0xFA, 0xFC, 0x07, 0xF7, 0xF4, 0x00, 0x0F, 0xEF, 0xE0, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x2F,
-    0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFF,
-    0x43, 0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x80, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07,
-    0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x03, 0xFD, 0x50, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0x00, 0x1A, 0xAA, 0x00, 0x00,
-    0xFF, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0x3F, 0x40, 0x3F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0,
-    0x2F, 0xC0, 0x1F, 0xC0, 0x0F, 0xD0, 0x0F, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x0B, 0xF0, 0x07, 0xF0,
-    0x07, 0xF4, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x01, 0x6F, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x2A, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0xBF, 0x0B,
-    0xE0, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x02, 0xF4, 0x0F, 0xD0, 0x01,
-    0xF8, 0x3F, 0x80, 0x00, 0xFC, 0x2A, 0x00, 0x00, 0xA8, 0x15, 0x55, 0x55, 0x1F, 0xFF, 0xFF, 0xD6,
-    0xAA, 0xAA, 0xA0, 0x55, 0x41, 0xFF, 0x03, 0xFD, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE,
-    0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0,
-    0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0,
-    0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD,
-    0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x01, 0xFE, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xF9, 0x7F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x01, 0xFE, 0x00,
-    0x7F, 0xC0, 0xBF, 0x40, 0x1F, 0xF0, 0x3F, 0xC0, 0x0B, 0xFC, 0x0F, 0xF0, 0x03, 0xFE, 0x07, 0xFC,
-    0x01, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF5, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xDF, 0xFF, 0xE0, 0x07, 0xF0, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0x42, 0xFF, 0x40,
-    0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFE, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x6F, 0xFC, 0x01, 0xFF, 0x40, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x0F, 0xF4, 0x0B, 0xFC,
-    0x00, 0xFF, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0xD0,
-    0x0B, 0xFE, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0xFC, 0x00, 0x0B, 0xFE,
-    0x3F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3, 0xFE, 0x00,
-    0xFF, 0x4F, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xA4, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x2F, 0xF0, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x5F, 0xF5, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x0B, 0xE0, 0x07, 0xFF, 0xF3, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x9B, 0xFF, 0x01,
-    0xFF, 0x40, 0xFF, 0xC0, 0xFF, 0xC0, 0x2F, 0xE0, 0x3F, 0xD0, 0x0B, 0xF8, 0x1F, 0xF0, 0x03, 0xFD,
-    0x0B, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x3F, 0xE0, 0x2F, 0xF0, 0x2F,
-    0xF4, 0x0B, 0xFE, 0x6F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xBF, 0xC0, 0x02, 0xFF,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x7E,
-    0x5B, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC,
-    0xBF, 0xD0, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFD, 0x7F, 0xF0, 0x0F,
-    0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0,
-    0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x00, 0x7F,
-    0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0xD0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F,
-    0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0xAB, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x2F, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x9F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x3F,
-    0xD0, 0x3F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F,
-    0xF0, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x7F, 0xC0,
-    0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x3F,
-    0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xFD, 0x02, 0xFF, 0x40, 0x1F, 0xCB, 0xFF, 0xC3, 0xFF, 0xF0, 0x0B, 0xFB, 0xFF, 0xFA, 0xFF, 0xFE,
-    0x03, 0xFF, 0xD7, 0xFF, 0xF5, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x1F,
-    0xF4, 0x07, 0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x07, 0xFC, 0x2F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFD,
-    0x00, 0xFF, 0x40, 0x3F, 0xC0, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x7F, 0xC0, 0x1F, 0xF0, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD, 0x00, 0x1F, 0xCB, 0xFF, 0xD0, 0x0B,
-    0xFB, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F,
-    0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00,
-    0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4, 0xBF, 0xD0,
-    0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE, 0x00, 0x3F,
-    0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87, 0xFF, 0x03,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xC0, 0x00, 0x7F, 0x3F, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xE5, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F,
-    0xE0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0xFF,
-    0x80, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xF5, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFE, 0x00, 0x1F, 0xF2, 0xFF, 0x40, 0x02, 0xFE, 0x01, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFD, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF4, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF,
-    0xC0, 0x0F, 0xF0, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0x80, 0x2F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF,
-    0xE1, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFC, 0xBF, 0x80, 0x00,
-    0x40, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD2, 0xFD, 0x01, 0xFD, 0xBF, 0xC0, 0x2F, 0xEF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x03, 0xFF,
-    0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x0F, 0xF8, 0x07, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x0A, 0x40, 0x7F, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x40, 0x7F,
-    0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD, 0x54, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F,
-    0xFF, 0x40, 0x00, 0x50, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x80,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x02, 0xFE,
-    0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x07,
-    0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0xD2, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xF4,
-    0x03, 0xFF, 0xF5, 0xFC, 0x00, 0x3F, 0xF4, 0x7F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0F, 0xF4, 0x3F, 0xC0, 0x2F, 0xF0, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x80, 0x3F, 0xC0, 0xFF, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x2F, 0xD3,
-    0xFC, 0x00, 0x1F, 0xDB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0x80,
-    0x2F, 0xF4, 0x03, 0xFC, 0x3F, 0xC0, 0x3F, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x7F, 0xF4, 0x0F, 0xF4,
-    0x3F, 0xC0, 0xFF, 0xF4, 0x1F, 0xF0, 0x3F, 0xC1, 0xFF, 0xF4, 0x3F, 0xD0, 0x3F, 0xC2, 0xFB, 0xF4,
-    0x7F, 0xC0, 0x3F, 0xC3, 0xF3, 0xF4, 0xBF, 0x40, 0x3F, 0xCB, 0xF3, 0xF4, 0xFF, 0x00, 0x3F, 0xCF,
-    0xD3, 0xF6, 0xFD, 0x00, 0x3F, 0xDF, 0xC3, 0xF7, 0xFC, 0x00, 0x2F, 0xEF, 0x43, 0xF7, 0xF8, 0x00,
-    0x2F, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x0F, 0xF7, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x1F, 0xF4, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x40, 0x15, 0x5F, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF9, 0x55, 0x00, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2B, 0xC0, 0x00, 0x1F, 0xFC,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xE4, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0x69, 0x00, 0x2E, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xE0, 0x00,
-    0x07, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00,
-    0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x06, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00,
-    0x7F, 0xD0, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x04, 0xFF, 0xFE, 0x40, 0xE7, 0xFF,
-    0xFF, 0xFF, 0x9F, 0x5B, 0xFF, 0xFE, 0x50, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA0, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x03, 0xFC, 0x00, 0x3F,
-    0xC0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x02, 0xFF, 0x00,
-    0x3F, 0xF0, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x01, 0xBF, 0xE4, 0x00, 0xBF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xAB, 0x41, 0xFF, 0x80,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x01, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xD4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x96, 0xE0, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFF, 0x95, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAA, 0x90,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x09,
-    0x00, 0x02, 0x40, 0xBD, 0xBF, 0x6F, 0x83, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0,
-    0x7F, 0x80, 0x3F, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xF0, 0x0F, 0xD0, 0x2F,
-    0x80, 0x2F, 0xFB, 0xFD, 0x02, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xF8, 0x0E, 0x05, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x0F, 0xF4, 0x0B, 0xF4, 0x02,
-    0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x03, 0xFC, 0x0F, 0xF4, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x02,
-    0xFD, 0x3F, 0xC0, 0x00, 0x1F, 0xDB, 0xF4, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x01, 0x5B,
-    0xFD, 0x50, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xAF, 0xFE, 0xA0, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x69,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
-    0x69, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0xE6, 0xFC,
-    0x01, 0xFE, 0x00, 0x10, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x0F, 0xF7, 0xFF, 0x00, 0x7F, 0x03, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xF0,
-    0x1F, 0xC0, 0x2F, 0xE0, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x24, 0x00, 0x7F, 0x80, 0xBE, 0xAB, 0xFD, 0x02,
-    0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0xFF, 0x2F,
-    0xD3, 0xF8, 0xBF, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03, 0xE0, 0x00, 0x00,
-    0xBD, 0x00, 0xB8, 0x06, 0xFF, 0x82, 0xF0, 0x1F, 0x01, 0xFF, 0xFC, 0x0B, 0x83, 0xD0, 0x7E, 0x01,
-    0x40, 0x3C, 0x3C, 0x0F, 0xC0, 0x00, 0x02, 0xD7, 0x80, 0xF4, 0x00, 0x00, 0x1E, 0xB4, 0x1F, 0x00,
-    0x00, 0x01, 0xFB, 0x41, 0xF0, 0x00, 0x00, 0x0F, 0xB4, 0x1F, 0x00, 0x00, 0x01, 0xF7, 0x80, 0xF4,
-    0x00, 0x00, 0x1E, 0x3C, 0x0F, 0x80, 0x00, 0x02, 0xD3, 0xC0, 0x7D, 0x00, 0x00, 0x3C, 0x2F, 0x03,
-    0xFF, 0xFC, 0x0B, 0xC0, 0xF4, 0x0B, 0xFF, 0x81, 0xF0, 0x07, 0xE0, 0x01, 0x00, 0x7D, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xD0, 0xFF, 0xFF, 0x0F, 0xE2, 0xFC,
-    0x7F, 0x03, 0xF2, 0xF4, 0x0F, 0x8F, 0xD0, 0x7D, 0x3F, 0x02, 0xF0, 0xFD, 0x1F, 0xC2, 0xFF, 0xFE,
-    0x03, 0xFD, 0xF4, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0xFF,
-    0x47, 0xFD, 0x03, 0xFE, 0x0F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x3F, 0xF0, 0xFF, 0xC0, 0xBF, 0xC2,
-    0xFF, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x7F, 0xC1, 0xFF, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x2F, 0xF0,
-    0xBF, 0xC0, 0x0F, 0xF0, 0x3F, 0xC0, 0x0B, 0xE0, 0x2F, 0x80, 0x01, 0x00, 0x04, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x54,
-    0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x03,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0xB8, 0x3F, 0xFD, 0x02, 0xF0, 0x1F, 0x03, 0xFF, 0xF8, 0x0B, 0x83,
-    0xD0, 0x3D, 0x0B, 0xD0, 0x3C, 0x3C, 0x03, 0xD0, 0x3D, 0x02, 0xD7, 0x80, 0x3D, 0x03, 0xD0, 0x1E,
-    0xB4, 0x03, 0xD0, 0xBC, 0x01, 0xFB, 0x40, 0x3F, 0xFF, 0x40, 0x0F, 0xB4, 0x03, 0xFF, 0xD0, 0x01,
-    0xF7, 0x80, 0x3D, 0x2F, 0x00, 0x1E, 0x3C, 0x03, 0xD0, 0xF8, 0x02, 0xD3, 0xC0, 0x3D, 0x07, 0xC0,
-    0x3C, 0x2F, 0x03, 0xD0, 0x3E, 0x0B, 0xC0, 0xF4, 0x3D, 0x01, 0xF5, 0xF0, 0x07, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xEA, 0xBF, 0xD0, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC2,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFC, 0x1F,
-    0xEB, 0xF8, 0xBD, 0x03, 0xF3, 0xF0, 0x0B, 0xCF, 0xC0, 0x2F, 0x2F, 0x81, 0xFC, 0x3F, 0xFF, 0xD0,
-    0x7F, 0xFE, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAA, 0xFF, 0xAA,
-    0x5F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x7F, 0x95, 0x50, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F,
-    0xD0, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0x81, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x3F, 0xFF, 0xC0, 0xBE, 0xFF, 0x40, 0x40, 0xFD,
-    0x00, 0x03, 0xF0, 0x06, 0xBF, 0x40, 0x3F, 0xF0, 0x00, 0xAF, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x4F, 0x97, 0xFC, 0x3F, 0xFF, 0xE0, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xFF,
-    0x80, 0xFF, 0x80, 0xBF, 0x80, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01,
-    0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x02, 0xFF,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xDF,
-    0xC0, 0x07, 0xFF, 0xFC, 0x3F, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0xBC, 0x7F, 0xFF, 0xF4, 0x3C, 0xBF, 0xFF, 0xF4, 0x3C,
-    0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C, 0xFF, 0xFF, 0xF4, 0x3C,
-    0xBF, 0xFF, 0xF4, 0x3C, 0x7F, 0xFF, 0xF4, 0x3C, 0x3F, 0xFF, 0xF4, 0x3C, 0x1F, 0xFF, 0xF4, 0x3C,
-    0x07, 0xFF, 0xF4, 0x3C, 0x00, 0x14, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF4, 0x3C,
-    0x00, 0x00, 0xA4, 0x28, 0x01, 0x40, 0x7F, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xD0, 0x14, 0x00, 0x0B,
-    0xC0, 0x7F, 0x80, 0x7F, 0x80, 0xBE, 0x9B, 0xFB, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x07,
-    0xFC, 0x03, 0xFF, 0xC2, 0xFF, 0xF8, 0x3F, 0xFF, 0x41, 0xD3, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x02, 0xFE, 0x00,
-    0xFF, 0xFC, 0x2F, 0xDF, 0xD3, 0xF0, 0x7E, 0x7E, 0x07, 0xEB, 0xD0, 0xBD, 0xBD, 0x0F, 0xD7, 0xE1,
-    0xFC, 0x3F, 0xFF, 0x41, 0xFF, 0xD0, 0x01, 0x40, 0x00, 0x00, 0x50, 0x01, 0x40, 0x07, 0xF0, 0x1F,
-    0xC0, 0x0B, 0xF8, 0x2F, 0xD0, 0x07, 0xFC, 0x1F, 0xF0, 0x03, 0xFD, 0x0F, 0xF4, 0x02, 0xFF, 0x0B,
-    0xFC, 0x00, 0xFF, 0x43, 0xFC, 0x02, 0xFF, 0x0B, 0xFC, 0x07, 0xFD, 0x2F, 0xF0, 0x1F, 0xF4, 0x7F,
-    0xD0, 0x3F, 0xE0, 0xFF, 0x40, 0xBF, 0x83, 0xFE, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0xBE, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0x40, 0x03,
-    0xF4, 0x07, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0x8F, 0xE0, 0x07,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0B,
-    0xF0, 0x1A, 0x80, 0x2F, 0xC1, 0xFC, 0x07, 0xFC, 0x03, 0xF8, 0x3F, 0x41, 0xFF, 0xC0, 0x3F, 0x4F,
-    0xE0, 0x3F, 0xF8, 0x07, 0xF2, 0xFC, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0x0F,
-    0xD0, 0xBD, 0x7F, 0x00, 0x03, 0xF8, 0x2F, 0x4B, 0xF0, 0x00, 0xBF, 0x03, 0xFA, 0xFF, 0x80, 0x1F,
-    0xC0, 0x7F, 0xFF, 0xFC, 0x03, 0xF4, 0x06, 0xAB, 0xFF, 0x80, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x2F,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1A, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xF0,
-    0x00, 0xBF, 0xF4, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xF4, 0x00, 0xBF, 0xFF, 0x00, 0x2F,
-    0x80, 0x00, 0xE3, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xFE, 0x00, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0xBF, 0x80, 0x0B, 0xF0, 0x7F, 0x2F, 0xFF, 0xC0, 0x3F,
-    0x83, 0xF4, 0xBF, 0xFF, 0x80, 0xFD, 0x3F, 0x80, 0xD0, 0xFF, 0x07, 0xF2, 0xFC, 0x00, 0x03, 0xF8,
-    0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x2F,
-    0xD0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0x40, 0x07,
-    0xFF, 0xFE, 0x03, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x2F, 0xC0, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xBF,
-    0x80, 0x00, 0x0B, 0xD0, 0x0B, 0xFF, 0xF0, 0x00, 0x2F, 0xC0, 0x07, 0xEB, 0xF8, 0x00, 0x7F, 0x00,
-    0x01, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x01, 0xAF, 0xE0, 0x0B,
-    0xF0, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xBF, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0xFE, 0x02, 0xA8, 0x00, 0x0B, 0xE2, 0xFC, 0x0B, 0xFC, 0xB9, 0x6F, 0xD7, 0xF0, 0x1F, 0xF8,
-    0xBF, 0xFF, 0x8F, 0xD0, 0x7F, 0xF4, 0x7F, 0xFD, 0x2F, 0x80, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x03,
-    0xF7, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xCB, 0xF0, 0x00, 0x03, 0xF4, 0x2F, 0x4F, 0xE0, 0x00, 0x0B,
-    0xE0, 0x7F, 0xAF, 0xF8, 0x00, 0x1F, 0xC0, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0x40, 0xAA, 0xBF, 0xE8,
-    0x00, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x00,
-    0x01, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x3F, 0xE0, 0x01, 0x0B, 0xFD, 0x5B, 0xC1, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFE,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x00,
-    0xFF, 0x07, 0xF4, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x03, 0xFD, 0x01,
-    0xFE, 0x00, 0x1F, 0xFA, 0xAB, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x7F, 0xC0,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF,
-    0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F,
-    0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x80,
-    0xFE, 0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02,
-    0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F,
-    0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x03, 0xD0, 0x00,
-    0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3C, 0x0B, 0xF8, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x00, 0x2F,
-    0xD2, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x07, 0xFC,
-    0x07, 0xF8, 0x00, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x0F, 0xF2,
-    0xFD, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00,
-    0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC,
-    0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F,
-    0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0xF4,
-    0x3C, 0x00, 0x00, 0x03, 0xD0, 0xF0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xBF,
-    0x00, 0x00, 0x0B, 0xF6, 0xFC, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00,
-    0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0xD0,
-    0x1F, 0xE0, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0xFF, 0x07, 0xFC,
-    0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0xAA, 0xA8,
-    0x00, 0x00, 0x2F, 0xF0, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xAA, 0xA8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFF, 0x00, 0x0A, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x40,
-    0x01, 0xFF, 0xE5, 0xAF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x05, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x00, 0x00,
-    0xFF, 0x1F, 0xD0, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xC7, 0xF0, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00,
-    0x0F, 0x82, 0xF0, 0x00, 0xBF, 0x1F, 0xE0, 0x03, 0xFC, 0x7F, 0x40, 0x07, 0xD0, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF3, 0xFF, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xFD, 0x03, 0xFE, 0x2F, 0xFE,
-    0xA0, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFD, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x3D, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF,
-    0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xDB, 0xF8, 0x07, 0xF8, 0x00,
-    0xBF, 0x4F, 0xF0, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x83, 0xFC,
-    0x00, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF9,
-    0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0xBF, 0xFF, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC,
-    0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF,
-    0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD,
-    0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F,
-    0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0,
-    0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01,
-    0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA,
-    0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4,
-    0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x1F, 0xD0,
-    0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00,
-    0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03,
-    0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC,
-    0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x7C, 0x00, 0x00, 0xFF, 0xFE, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xE0, 0x7F, 0xD0, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x07, 0xD0, 0x00, 0x00, 0xBF, 0x4F, 0xE0, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x3D,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4,
-    0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0,
-    0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00, 0x05, 0x03, 0xE0, 0x01,
-    0xF4, 0xBF, 0x80, 0x7F, 0xC2, 0xFE, 0x1F, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0x3F, 0xE0, 0x7F, 0xC0, 0xBF,
-    0x87, 0xF0, 0x02, 0xF8, 0x1C, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x01, 0xBF, 0xFD, 0xBD, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xF9, 0xBF, 0xF8, 0x03, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xFD, 0x00, 0xBF, 0xFC, 0x0F, 0xF8,
-    0x01, 0xFF, 0xFD, 0x1F, 0xF0, 0x03, 0xF7, 0xFD, 0x2F, 0xF0, 0x0F, 0xE3, 0xFD, 0x3F, 0xE0, 0x2F,
-    0xC3, 0xFD, 0x3F, 0xD0, 0x7F, 0x03, 0xFC, 0x3F, 0xC1, 0xFC, 0x07, 0xFC, 0x3F, 0xC3, 0xF4, 0x0B,
-    0xFC, 0x3F, 0xCF, 0xE0, 0x0F, 0xF4, 0x3F, 0xEF, 0xC0, 0x1F, 0xF0, 0x3F, 0xFF, 0x00, 0x3F, 0xE0,
-    0x3F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x7F, 0xFF, 0x80, 0x00, 0x1C, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8,
-    0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF,
-    0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x3F, 0x80, 0x00, 0x0B, 0xF4, 0x0F, 0xD0, 0x00, 0x05,
-    0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0,
-    0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC,
-    0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xA5,
-    0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFC,
-    0x0B, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F,
-    0xF0, 0x07, 0xFD, 0x07, 0xFC, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xE9, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFC, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0xF0,
-    0x00, 0x03, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x80, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x80, 0x1F, 0xF4, 0x00, 0x3F, 0xD3,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x4F, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0x2F, 0xFF, 0x80, 0x00, 0x2F,
-    0xF0, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x06,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x54, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xC0,
-    0x03, 0xFF, 0xFB, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xB8, 0x1F, 0xF4, 0x00, 0x14, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC2, 0xF8, 0x01, 0xFF, 0xFC, 0xFE, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xE6, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x0B, 0xF8, 0x0F, 0xF4,
-    0x02, 0xFE, 0x07, 0xFC, 0x00, 0xFF, 0x42, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x1F, 0xF0, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x02, 0xFF, 0x9B, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xEF, 0xF0, 0x00, 0xBF, 0xD3, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x82,
-    0xF0, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x2F, 0xC7, 0xF4, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B,
-    0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBD, 0xFF, 0xE0, 0x01, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFD, 0x6F, 0xFF, 0x42, 0xFE, 0x1F,
-    0xF4, 0x0F, 0xFD, 0x01, 0xFE, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFD, 0x3F, 0xD0, 0x0F, 0xF8, 0x6F,
-    0xFC, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0xF4, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0x80, 0x1F,
-    0xFA, 0x94, 0x00, 0xBF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xF0, 0x00, 0x00, 0xBF,
-    0xE2, 0xFF, 0xF8, 0x01, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFD, 0x3F, 0x3F, 0xFF, 0x40, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE, 0x5B, 0x42, 0xFF,
-    0x40, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56, 0xC0, 0x3F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x9B, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0,
-    0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40,
-    0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE, 0x02, 0xF8, 0x00, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x0B, 0xF4, 0x3F, 0xE0, 0x0F, 0xF4, 0x3F, 0xD1, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0xFF, 0x1F, 0xD0, 0x03, 0xFC, 0xBF,
-    0x40, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xF4, 0x3F, 0xD1, 0xFF, 0x00, 0xBF, 0x4F, 0xF8,
-    0x03, 0xFD, 0x3F, 0xD1, 0xBF, 0xF1, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xE0, 0x2F, 0xFA, 0x90,
-    0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xB0, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0x54, 0x00, 0xFF,
-    0x40, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFF,
-    0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0,
-    0x0F, 0xF4, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x0F, 0xF2,
-    0xFC, 0x3F, 0x80, 0xBE, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B,
-    0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x07, 0xD0, 0xB8, 0x0F, 0xF1, 0xFD,
-    0x0F, 0xF2, 0xFC, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC,
-    0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00,
-    0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x2C, 0x00, 0x07, 0xFA, 0xFD, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x0D, 0x0B, 0xF4, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0xBF, 0xE3, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF4, 0x3F, 0xFC,
-    0x7F, 0xD0, 0x0F, 0xF8, 0xBF, 0xC0, 0x0F, 0xF8, 0xFF, 0x80, 0x0F, 0xF4, 0xFF, 0x40, 0x1F, 0xF0,
-    0xFF, 0x40, 0x2F, 0xF0, 0xFF, 0x40, 0x3F, 0xE0, 0xBF, 0xC0, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x07, 0xFF, 0xEF, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0x07, 0xFE, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0x40,
-    0x01, 0xFC, 0xBF, 0xFD, 0x00, 0x2F, 0xEF, 0xFF, 0xF0, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0x3F, 0xF0,
-    0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x07,
-    0xFC, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0x4B, 0xFD, 0x03,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xAF, 0xE0, 0x03, 0xFE,
-    0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0x4B, 0xFD, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF,
-    0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xAF, 0xE0, 0x03, 0xFE, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00,
-    0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0xFE, 0x03, 0xF8, 0x01, 0x40, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6,
-    0xFF, 0x4B, 0xFD, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF,
-    0xAF, 0xE0, 0x03, 0xFE, 0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F,
-    0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2E, 0x00, 0x3F, 0xFE, 0xBD, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xF4, 0x2F, 0xF0, 0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x6F, 0xF4, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xF8, 0xBF, 0x80,
-    0x0F, 0xF8, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE1,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0xFF, 0x1F, 0xD0, 0x03, 0xF8, 0xBF, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xF5, 0xBF, 0xD2, 0xFF, 0x40, 0xFF, 0x8F, 0xF8, 0x02, 0xFF, 0x7F,
-    0xC0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0xFF, 0xAF, 0xE0, 0x03, 0xFD, 0xBF, 0x80,
-    0x1F, 0xF2, 0xFF, 0x00, 0xFF, 0x87, 0xFE, 0x1F, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x55, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xEF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x4B, 0xFD, 0x02, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0x43, 0xFF, 0xF0,
-    0x7F, 0xC2, 0xFF, 0xFC, 0x1F, 0xE2, 0xFA, 0xFE, 0x0B, 0xF9, 0xFC, 0xBF, 0x82, 0xFE, 0xFC, 0x3F,
-    0xD0, 0xBF, 0xFC, 0x1F, 0xF0, 0x2F, 0xFD, 0x0F, 0xF8, 0x07, 0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xBF, 0xF9, 0x00, 0x0B, 0x40, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40,
-    0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD,
-    0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07,
-    0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0,
-    0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03,
-    0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC,
-    0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF,
-    0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xBF, 0x5F, 0xD0,
-    0x00, 0xBF, 0x01, 0xFC, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03,
-    0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF,
-    0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01,
-    0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xF4, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF0, 0x2F, 0xE0, 0x07, 0xFC, 0x0F, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40,
-    0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x2F, 0xE0, 0x0B, 0xFC, 0x0F, 0xF4, 0x03, 0xFE,
-    0x03, 0xFC, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x7F, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F,
-    0xF8, 0x07, 0xFD, 0x2F, 0xFD, 0x00, 0xFF, 0xFF, 0xBF, 0x40, 0x3F, 0xFF, 0x5F, 0xC0, 0x03, 0xFF,
-    0x47, 0xF0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2,
-    0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0xBF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF5, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F,
-    0xC0, 0x3F, 0xC0, 0x0B, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xF4, 0x0B, 0xFD,
-    0x03, 0xFF, 0x00, 0xBF, 0xF5, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFF, 0x00,
-    0x1F, 0xF2, 0xFF, 0x80, 0x02, 0xFE, 0x01, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x01,
-    0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xB8, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F,
-    0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0,
-    0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00,
-    0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F,
-    0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0,
-    0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC,
-    0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01,
-    0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F,
-    0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF,
-    0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x1F, 0xEA, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0,
-    0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F,
-    0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F,
-    0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x15, 0x00, 0x14, 0x00,
-    0x3F, 0x00, 0xBC, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F,
-    0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF,
-    0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xEF, 0xC0, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x4B,
-    0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0x01, 0xFE, 0x00,
-    0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F,
-    0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0xBD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0,
-    0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xE5, 0xB4, 0x0B, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0x5B, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0x8F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x0F, 0xD0, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xEB,
-    0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04, 0x00, 0x1F,
-    0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x3F, 0xC7, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xE5, 0xB4,
-    0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xFD,
-    0x5B, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x04, 0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x0F, 0xFE,
-    0x5B, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0x56,
-    0xC0, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xEB, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xA0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x04,
-    0x00, 0x1F, 0xFE, 0x5A, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0xFD, 0x03,
-    0xF8, 0x00, 0x7F, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFE, 0x5B, 0x40, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xF5, 0x6C, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00,
-    0xFE, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x01,
-    0xFF, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x0B, 0xFC, 0x03, 0xFD,
-    0x00, 0x0F, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x1F, 0xF4, 0x0B, 0xFC, 0x00,
-    0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0xC0, 0x1F, 0xF0, 0x07, 0xFF,
-    0x80, 0x1F, 0xFA, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC7, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF1, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFE, 0x6F, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x00,
-    0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xE0, 0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x0B, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xF3, 0xFF, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xFD, 0x03, 0xFE, 0x2F, 0xFE,
-    0xA0, 0x1F, 0xF4, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0xFF, 0x80, 0x07, 0xFE, 0x03, 0xFD, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x07, 0xFF, 0x80, 0x7F, 0xEB, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x50, 0x7F, 0x80, 0x00,
-    0xBF, 0xF2, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x47,
-    0xFF, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x2F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x00,
-    0x2F, 0xF0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x0B, 0xFC,
-    0x03, 0xFD, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xBF,
-    0x00, 0x00, 0xBF, 0xE2, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0x00,
-    0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xEA, 0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1A, 0xAA, 0xA0, 0x00, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3,
-    0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE,
-    0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x01, 0x40, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0x40, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x54, 0x01,
-    0xF4, 0x03, 0xE0, 0x03, 0xFA, 0xBF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0x47, 0xFC, 0x02, 0xFD, 0x3F, 0xE0, 0x0F, 0xF4, 0xFF, 0x46, 0xFF,
-    0xC7, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0xBF, 0xEA, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE,
-    0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFE, 0x80, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x01,
-    0x50, 0x00, 0x0F, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0xCB, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xEA, 0xA9, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFA,
-    0xAA, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x15, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x02, 0xFC, 0xBF, 0x40, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0x40,
-    0x7F, 0xC0, 0x2F, 0xD0, 0x3F, 0xE0, 0x0F, 0xF4, 0x0F, 0xF4, 0x6F, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x2C, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xD7, 0xF4, 0x00, 0x03, 0xFC, 0x07, 0xF0, 0x00,
-    0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x24,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A, 0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFD, 0x02, 0xFF,
-    0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x02, 0xFE, 0x03,
-    0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
-    0xC7, 0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0,
-    0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F,
-    0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02,
-    0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F,
-    0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07,
-    0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xFA, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00, 0xBF, 0xF4, 0x00, 0x24, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A,
-    0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF, 0x83, 0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0,
-    0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD,
-    0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-    0x03, 0xE0, 0x0F, 0xC0, 0x00, 0xFF, 0xAF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF,
-    0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F,
-    0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFE, 0x00,
-    0xBF, 0xF4, 0x00, 0x24, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x0A, 0xAA, 0xA0, 0xFF, 0x80, 0x7F, 0xFF,
-    0x83, 0xFD, 0x02, 0xFF, 0xFD, 0x1F, 0xF4, 0x0B, 0xFF, 0xF0, 0x7F, 0xD0, 0x00, 0x7F, 0xC0, 0xFF,
-    0x40, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x0F, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFE, 0x5B,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4, 0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF,
-    0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03,
-    0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0xAF, 0xE0, 0x0B, 0xFF, 0x40,
-    0x02, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xAA, 0xAA, 0x0F, 0xF8, 0x07, 0xFF, 0xF8, 0x3F, 0xD0,
-    0x2F, 0xFF, 0xD1, 0xFF, 0x40, 0xBF, 0xFF, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x0F, 0xF4, 0x00, 0x2F,
-    0xE0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF, 0xD0, 0x03, 0xFC, 0x01, 0xFF, 0xE5, 0xBF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x7F, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0xBF, 0xF0, 0x1F, 0xF4,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xBF, 0x81, 0xFF, 0x00, 0x3F, 0xD0, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xFF, 0x40,
-    0xBF, 0xE6, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFB, 0xFC, 0x00, 0x2F, 0xF2, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xE5, 0xBF,
-    0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFE, 0x3F, 0x80, 0x00, 0x01, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0xFF,
-    0x40, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFE,
-    0xAA, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x1F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF5, 0xFD, 0x00, 0x0F, 0xF0, 0x1F, 0xC0, 0x01, 0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xCB, 0xFD, 0x00, 0x1F, 0xEF,
-    0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F,
-    0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40,
-    0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE,
-    0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xAA, 0xAF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0x80, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0xFF, 0x01, 0x40, 0x01, 0xFF, 0x2F, 0xF4, 0x02, 0xFE, 0xFF, 0xFD, 0x03,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xD3, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0x07, 0xFD, 0x01, 0xFF, 0x0B,
-    0xFC, 0x02, 0xFE, 0x0F, 0xF8, 0x03, 0xFD, 0x0F, 0xF0, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFC, 0x2F,
-    0xF0, 0x07, 0xFC, 0x2F, 0xE0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0F, 0xF4, 0x3F, 0xC0, 0x0F, 0xF0, 0x7F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2E, 0x00, 0x3F, 0xFE, 0xBD, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xF4, 0x2F, 0xF0, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xF0, 0xFF, 0xFA, 0xF4, 0xBF, 0xFF, 0xFC,
-    0x3E, 0x0B, 0xFC, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0xBF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xAA, 0xA8, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC,
-    0x00, 0x07, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x14, 0x00, 0x14, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x05,
-    0x00, 0x05, 0x03, 0xE0, 0x0F, 0xC0, 0xFF, 0xAF, 0xE0, 0x2F, 0xFF, 0xF0, 0x02, 0xFF, 0xE0, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFF, 0x90, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x03,
-    0xFC, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0xE4, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x0F, 0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x2F,
-    0xE0, 0x0F, 0xF4, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0xBF, 0xC0, 0x0F,
-    0xFF, 0xFC, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x03, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0x01,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0x00,
-    0x2F, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x07, 0xFD,
-    0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x0B,
-    0xFC, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x07, 0xFC, 0x01,
-    0xFF, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x02, 0xAF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xD3, 0xF8, 0x00, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x05, 0x40, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x06, 0xAF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x3F, 0x80, 0xBE, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0xE0,
-    0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00,
-    0x02, 0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x2F, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0x9F, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xC0, 0x02, 0xFE, 0x07, 0xFD, 0x00, 0x3F,
-    0xD0, 0x3F, 0xF0, 0x03, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x02, 0xFE, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x03, 0xFC,
-    0x3F, 0xE0, 0x00, 0x3F, 0xCF, 0xF8, 0x00, 0x07, 0xFB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x02, 0xFF, 0x0F,
-    0xFC, 0x00, 0x2F, 0xE0, 0x7F, 0xD0, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF4, 0x07,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA,
-    0xAA, 0x80, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF,
-    0xAA, 0xA8, 0x2F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0xBF, 0x80, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x7F, 0x40, 0x0F, 0xF0, 0x3F, 0xC0, 0x07, 0xFC, 0x0F, 0xD0, 0x02, 0xFF, 0x0B, 0xE0,
-    0x00, 0xFF, 0x83, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD2,
-    0xFD, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0xBF, 0xCF, 0xC0, 0x00, 0xFF, 0x8A,
-    0x40, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x07, 0xF4, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F, 0xD0, 0xFF, 0x80, 0xFF,
-    0x02, 0xFC, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD1, 0xFD, 0x07, 0xFC,
-    0x3F, 0xE0, 0x7F, 0xC3, 0xFE, 0x0B, 0xF8, 0x2F, 0xC0, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x40, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0xBF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00,
-    0x1F, 0xFE, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xE1, 0xFF, 0xF8, 0x0B, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xFF,
-    0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x03,
-    0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xDB, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x4F, 0xF0, 0x2F, 0xE0,
-    0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x0F,
-    0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F, 0x80, 0x0B, 0xF4, 0x0B, 0xF9, 0xFD, 0x00, 0x3F, 0xC0, 0x1F,
-    0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xD0,
-    0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0xD0, 0x01, 0xFC, 0xBF, 0xFD, 0x00, 0xBF, 0xBF, 0xFF, 0xC0,
-    0x3F, 0xFD, 0x7F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F,
-    0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00,
-    0xFF, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xE0,
-    0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0xFF,
-    0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xEF, 0xF4, 0x03, 0xFC, 0x00,
-    0x7F, 0x6F, 0xE0, 0x1F, 0xE0, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x02, 0xFD,
-    0x00, 0x3F, 0xC2, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF1,
-    0xFE, 0x00, 0x2F, 0xD0, 0x2F, 0xE7, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0xEF, 0xC0, 0x03, 0xFC, 0x00,
-    0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xE0, 0x02, 0xFC,
-    0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD,
-    0x00, 0x1F, 0xCB, 0xFF, 0xD0, 0x0B, 0xFB, 0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD,
-    0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B,
-    0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x3F, 0xFF,
-    0x80, 0x0B, 0xF4, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x03, 0xFB, 0xFD, 0x00, 0xFF, 0x00, 0x1F,
-    0xDB, 0xF8, 0x07, 0xF8, 0x00, 0xBF, 0x4F, 0xF0, 0x2F, 0xE0, 0x03, 0xFC, 0x3F, 0xC0, 0xBF, 0x40,
-    0x0F, 0xF0, 0xBF, 0x83, 0xFC, 0x00, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x7F,
-    0x80, 0x0B, 0xF4, 0x0B, 0xF9, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xFB, 0xF0, 0x00, 0xFF, 0x00, 0x3F,
-    0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0xBF, 0x00,
-    0x03, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x05, 0x40, 0x01, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC2, 0xFF, 0x40, 0x01, 0xFC, 0xBF, 0xFD, 0x00, 0x2F, 0xEF, 0xFF, 0xF0, 0x03, 0xFF, 0xD7, 0xFF,
-    0x00, 0x3F, 0xF0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x0B, 0xF8,
-    0x02, 0xFE, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x2F, 0xF0, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x0F, 0xF4, 0x03, 0xFC, 0x00,
-    0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC3, 0xF0, 0xBF, 0xD0, 0x3F, 0x47, 0xF3, 0xFF, 0xF4, 0x15, 0x0B, 0xFB, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0x5F, 0xFC, 0x00, 0x0F, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x1F,
-    0xF0, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0,
-    0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x2F,
-    0xE0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x01,
-    0xFE, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFC,
-    0x00, 0xFF, 0x00, 0x0F, 0xEB, 0xF4, 0x03, 0xFC, 0x00, 0x7F, 0x5F, 0xE0, 0x1F, 0xE0, 0x02, 0xFC,
-    0x3F, 0xC0, 0xBF, 0x40, 0x0F, 0xF0, 0xBF, 0x43, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x0F, 0xF0, 0x00,
-    0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF4, 0x07, 0xF9, 0xFE, 0x00, 0x2F, 0xD0, 0x0F, 0xFB, 0xF4,
-    0x00, 0xFF, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0xFF,
-    0xF8, 0x00, 0x7F, 0x40, 0x02, 0xFF, 0xE0, 0x02, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD, 0x00, 0x1F, 0xCF, 0xFF, 0xD0, 0x0B, 0xFB,
-    0xFF, 0xFC, 0x03, 0xFF, 0xD7, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xD0,
-    0x7F, 0xC0, 0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF,
-    0x40, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1A, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA0, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4,
-    0xBF, 0xD0, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE,
-    0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87,
-    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0xFF, 0xAF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00,
-    0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03,
-    0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC,
-    0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x3F, 0xEB, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x6F, 0xF4, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xF8, 0xBF, 0x80,
-    0x0F, 0xF8, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0x7F, 0xE1,
-    0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x15, 0x40, 0x00, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x00, 0x3F,
-    0xF8, 0x01, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x1F,
-    0xF4, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x03,
-    0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0xC0,
-    0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x3F, 0xC3, 0xFC,
-    0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD6, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x01,
-    0xFF, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x0F, 0xF4, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x7F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFA, 0xBF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x01,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0xFF, 0xAA, 0xA8, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xF4,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE5,
-    0xBF, 0xFA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x02, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFD, 0x7F, 0xFF, 0x81, 0xFF, 0x2F, 0xF0,
-    0x0F, 0xFE, 0x00, 0xFF, 0x3F, 0xE0, 0x0F, 0xFC, 0x02, 0xFF, 0x7F, 0xC0, 0x0F, 0xFC, 0x5F, 0xFD,
-    0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF8, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0x80, 0x0F, 0xFA,
-    0xA4, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xE1,
-    0xFF, 0xFD, 0x01, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEB, 0xFF, 0xC0, 0x0F, 0xF8,
-    0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x5B, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0xFF, 0x82, 0xFF, 0x00, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x0B, 0xFC, 0x02, 0xFE, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x03, 0xFF, 0x03, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4B, 0xF4, 0x01, 0xFD, 0xBF, 0xC0, 0x0B, 0xFB, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFE, 0xBF, 0xFC, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF5, 0xBF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xC3, 0xFD, 0x00,
-    0x0F, 0xF8, 0x2F, 0xF0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x01, 0xFF, 0x00,
-    0xBF, 0xC0, 0x2F, 0xE0, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xD0, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0, 0x07, 0xF6, 0xFF, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x0B,
-    0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xE0,
-    0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x07, 0xFC,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x03, 0xFF, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFC, 0x3F, 0xD0, 0x00, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x3F, 0xF0, 0x0F, 0xF4, 0x00, 0xBF, 0xD0, 0x00, 0x54,
-    0x00, 0x14, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xD0, 0x01, 0xFD,
-    0xBF, 0xC0, 0x02, 0xFE, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xAF, 0xC0, 0x0F, 0xFC, 0x00, 0x40, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x01, 0x40, 0x01, 0xFF, 0x40,
-    0x7E, 0x56, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x70, 0x03,
-    0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x29, 0x01, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xC7,
-    0xF0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x05, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xAF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFD, 0x01, 0x40, 0x01, 0xFF, 0x40, 0x7E, 0x56, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xCB, 0xF0, 0x03, 0xF8, 0x0B, 0xF0, 0x05,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFE, 0x00, 0xFF, 0x80, 0x70, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF0, 0x29, 0x01, 0xFF, 0x80, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEA, 0xFC, 0x03, 0xFF, 0x00, 0x10, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x50, 0x00, 0x7F, 0xD0, 0x7E, 0x56,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x05, 0x7F,
-    0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE4, 0x03, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF8, 0x0F, 0xF8, 0x07, 0x00, 0xFF, 0x40, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x0A, 0x40, 0x7F, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x40, 0x7F, 0xFF, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x40, 0x00, 0xFD, 0x03, 0xF8, 0x00, 0x07, 0xF1, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xEA, 0xFC, 0x00,
-    0x3F, 0xF0, 0x01, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x05, 0x00, 0x07, 0xFD, 0x00, 0x7E, 0x56, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x54, 0x00, 0xFD, 0x07, 0xF8, 0x00, 0xBF, 0x1F, 0xE0, 0x00, 0x3F, 0xFF,
-    0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x0F, 0xF8, 0x07, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0xA4, 0x07, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x57, 0xFC, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD, 0x54, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F,
-    0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x07, 0xE0, 0x00,
-    0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x57, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x54, 0x00, 0x54, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x43,
-    0xF4, 0x00, 0x3F, 0x2F, 0x40, 0x02, 0xFC, 0x64, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF0, 0x01, 0xBF, 0xD5, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x50, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x6B, 0xFF, 0xA8, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0x47, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x1B, 0xFD, 0x54, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF4, 0x50, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xF4, 0x00,
-    0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xC1, 0xFF, 0x80, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00,
-    0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xC0, 0x02,
-    0xFF, 0xFB, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x1F, 0xF4, 0x00, 0x14, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF,
-    0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02,
-    0xFF, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xFC, 0x07, 0xFC, 0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F,
-    0xFF, 0xD7, 0xF0, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x00,
-    0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x1F,
-    0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00,
-    0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF, 0xF4, 0x03,
-    0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0x50, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x01, 0xFE, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF,
-    0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00,
-    0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-    0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F,
-    0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x02, 0xFE, 0xBF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x03, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x3F,
-    0xD0, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFF, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0xFF, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xFC,
-    0x07, 0xFE, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x3F, 0xFF, 0xEF, 0xD0, 0x0F, 0xFF, 0xD7, 0xF0, 0x00,
-    0xFF, 0xD1, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x2E,
-    0x00, 0x00, 0x00, 0x3F, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD,
-    0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40,
-    0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7E, 0xBC, 0x00,
-    0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0x80,
-    0x1F, 0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0, 0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x03,
-    0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF, 0xF4,
-    0x03, 0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x15, 0x40, 0x00, 0x03, 0xFE, 0x3F, 0xD0, 0x00, 0x01, 0xFE,
-    0x2F, 0xD0, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07,
-    0xFC, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x3F,
-    0xE0, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF,
-    0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
-    0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80,
-    0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x41, 0x50,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x2F, 0xD3, 0xFD, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x1F,
-    0x81, 0xF8, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F,
-    0xC0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x03, 0xFD, 0x00,
-    0xFF, 0x80, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xFF, 0xC0,
-    0x07, 0xFC, 0x07, 0xFE, 0x00, 0x1F, 0xF4, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0xFF,
-    0xFD, 0x7F, 0x00, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B,
-    0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07,
-    0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA0, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0xFF, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F,
-    0xF0, 0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xE0,
-    0x3F, 0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x01, 0xFF,
-    0x80, 0x7F, 0xD2, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xF4, 0x03, 0xFF, 0xF5, 0xFC, 0x00, 0x3F, 0xF4,
-    0x7F, 0x00, 0x00, 0x40, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x7F, 0x80, 0x03, 0xFE, 0x00, 0x0F,
-    0xF1, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xC7, 0xF8, 0x00, 0xFF, 0xE0, 0x03, 0xFD, 0x0F, 0xE0,
-    0x03, 0xFF, 0x80, 0x1F, 0xF0, 0x3F, 0xC0, 0x2F, 0xFE, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0xFF, 0xF8,
-    0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xFB, 0xF0, 0x2F, 0xE0, 0x0F, 0xF0, 0x3F, 0xAF, 0xC0, 0xFF, 0x00,
-    0x3F, 0xC1, 0xFC, 0xBF, 0x07, 0xF8, 0x00, 0xFF, 0x0F, 0xF2, 0xFC, 0x3F, 0xD0, 0x03, 0xFC, 0x7F,
-    0x4B, 0xF1, 0xFF, 0x00, 0x0F, 0xF3, 0xFC, 0x2F, 0xCB, 0xF4, 0x00, 0x3F, 0xCF, 0xD0, 0xBF, 0x3F,
-    0xC0, 0x00, 0xFE, 0xBF, 0x01, 0xFD, 0xFD, 0x00, 0x03, 0xFB, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x01,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00,
-    0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xF4, 0x03,
-    0xFC, 0x3F, 0xC0, 0x3F, 0xF4, 0x0B, 0xFC, 0x3F, 0xC0, 0x7F, 0xF4, 0x0F, 0xF4, 0x3F, 0xC0, 0xFF,
-    0xF4, 0x1F, 0xF0, 0x3F, 0xC1, 0xFF, 0xF4, 0x3F, 0xD0, 0x3F, 0xC2, 0xFB, 0xF4, 0x7F, 0xC0, 0x3F,
-    0xC3, 0xF3, 0xF4, 0xBF, 0x40, 0x3F, 0xCB, 0xF3, 0xF4, 0xFF, 0x00, 0x3F, 0xCF, 0xD3, 0xF6, 0xFD,
-    0x00, 0x3F, 0xDF, 0xC3, 0xF7, 0xFC, 0x00, 0x2F, 0xEF, 0x43, 0xF7, 0xF8, 0x00, 0x2F, 0xFF, 0x03,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFC, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x01, 0xFD, 0x03,
-    0xF4, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F,
-    0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF,
-    0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xC0, 0x00, 0x07, 0xF4,
-    0x0F, 0xD0, 0x00, 0x05, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03,
-    0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00,
-    0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x03, 0xE0, 0x00, 0x03, 0xF8, 0xBF, 0x00, 0x00, 0x7F, 0x4F, 0xF0, 0x00, 0x02, 0xE0, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD,
-    0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF,
-    0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x55, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0x55, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x05, 0x57, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x07, 0xFE, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x50, 0x00, 0x0B, 0xF0, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xAA, 0xA8, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00,
-    0x0B, 0xE0, 0x2F, 0xC0, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x05, 0x57, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xE5, 0x54, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x6B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x1B, 0xFF, 0xD0, 0x1F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0x0B, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFB, 0xFC, 0x00, 0x3F, 0xFE, 0xAF, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
-    0x1F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0xFF, 0x40, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0xD0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF9, 0x7F, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xF8, 0x0F, 0xF4, 0x01,
-    0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD6, 0xFF, 0xF4, 0x00, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC,
-    0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0,
-    0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x2F,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFA, 0xFF, 0xFF, 0xEB, 0xFF, 0x80, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x3F, 0xF0, 0xBF,
-    0xD0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x01, 0xFF, 0x1F, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0xBF, 0x8F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x00, 0x7F,
-    0xC0, 0x0F, 0xF1, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x07, 0xFC, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x02,
-    0xFE, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xD1,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x7F, 0xD0, 0x00, 0xBF, 0xD0, 0x07, 0xFC, 0x0F, 0xFC,
-    0x00, 0xBF, 0xF0, 0x02, 0xFE, 0x02, 0xFF, 0xE6, 0xFF, 0xF0, 0x00, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xDF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xFE, 0x5B, 0xFD, 0x2F, 0xF4, 0x0F, 0xF8, 0x03, 0xFE, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xFC, 0x03, 0xFD, 0x7F, 0xC0, 0x0B, 0xF8, 0x03, 0xFC,
-    0xBF, 0x80, 0x0F, 0xF8, 0x07, 0xFC, 0xBF, 0x80, 0x0F, 0xF4, 0x0B, 0xF8, 0xBF, 0x80, 0x1F, 0xF0,
-    0x0F, 0xF4, 0xBF, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x7F, 0xE1, 0xFF, 0xC0, 0x0F, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0xE4, 0x00, 0x3F, 0xD0,
-    0x00, 0x04, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-    0x4B, 0xFC, 0x03, 0xFF, 0x2F, 0xC3, 0xFE, 0x00, 0x7F, 0xC7, 0xE0, 0xFF, 0x40, 0x0F, 0xF0, 0x00,
-    0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x07, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFA, 0xA4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF5, 0xFF, 0xC0, 0x0F, 0xFC, 0x0B, 0xFC, 0x01,
-    0xFF, 0x40, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFD, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0B,
-    0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xF4, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0xBF,
-    0xF5, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xBF, 0xFF, 0x00, 0x1F, 0xF2, 0xFF, 0x80,
-    0x02, 0xFE, 0x01, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFA, 0xFF, 0xF0, 0x07, 0xFC,
-    0x0B, 0xFD, 0x02, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xD0, 0x3F, 0xD0, 0x1F, 0xF0, 0x1F,
-    0xF0, 0x0F, 0xFC, 0x07, 0xFE, 0xBF, 0xFD, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x0B, 0xFC, 0x2F, 0xF0, 0x02, 0xFE, 0x03, 0xFD,
-    0x00, 0xFF, 0x40, 0xFF, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBE, 0xAF, 0xFD, 0x00, 0x10, 0x03, 0xFE, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x2F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0x3F, 0xF5,
-    0x6F, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC,
-    0x03, 0x90, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x40, 0x3F, 0xFE, 0x40, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B,
-    0xFC, 0x01, 0x90, 0x7F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFB, 0xFF, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0xFF, 0xEA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x50, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xC7, 0xD3, 0xFC, 0x7C,
-    0x3F, 0xC3, 0xFB, 0xFC, 0x2F, 0xFF, 0xC0, 0x6F, 0xF8, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xFF,
-    0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE6, 0xC3, 0xFF, 0xFC, 0x2F, 0xFF, 0xC0, 0x7F, 0xE4,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD, 0x54, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00,
-    0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x00,
-    0x3F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xE0,
-    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x41, 0xFF, 0x00, 0x0B, 0xF0, 0x2F, 0xE0, 0x00, 0x7E, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0xBF, 0xFE, 0x00, 0xFF, 0x81, 0x01,
-    0xFF, 0x00, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x1B, 0xFD,
-    0x54, 0x0F, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xD1, 0x40, 0x3F, 0xFF, 0x80, 0x3F,
-    0xFF, 0x80, 0x0F, 0xFF, 0x40, 0x00, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xFA, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0x4F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0xC7,
-    0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF7, 0xFD, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0x40,
-    0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x90, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF,
-    0xD6, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41,
-    0xFF, 0x00, 0x3F, 0xCB, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFF, 0xFC,
-    0x00, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x3F, 0xE0, 0x0F, 0xF0, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x54, 0x00, 0x55, 0x00,
-    0xFF, 0x80, 0xFF, 0x80, 0xBF, 0x40, 0x7F, 0x40, 0x05, 0x00, 0x00, 0x00, 0x15, 0x40, 0x01, 0xFF,
-    0xE0, 0x07, 0xFF, 0xF0, 0x1F, 0xE3, 0xFC, 0x7F, 0x40, 0xFD, 0x54, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x07, 0xC2, 0xFF, 0xFB, 0xE1, 0xFF, 0xFF, 0xF0, 0xBC, 0x1F, 0xF4, 0x14, 0x00, 0x50,
-    0x00, 0x1A, 0xAA, 0x93, 0xFF, 0xFF, 0x7F, 0xFF, 0xE1, 0x55, 0x54, 0x1A, 0xAA, 0xAA, 0x83, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x81, 0x55, 0x55, 0x50, 0x14, 0x00, 0x55, 0xF4, 0x03, 0xE3, 0xFA,
-    0xBF, 0x4F, 0xFF, 0xF8, 0x0B, 0xFF, 0x80, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0x7F,
-    0x40, 0x00, 0x1F, 0x43, 0xE0, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x0B, 0x81, 0xF4, 0x00, 0x02, 0xFF,
-    0x8B, 0xFF, 0x51, 0xFE, 0x03, 0xF4, 0xBF, 0x83, 0xF4, 0x0A, 0x40, 0x01, 0x40, 0x2F, 0xF4, 0x7E,
-    0xFC, 0xB8, 0x3D, 0xB8, 0x3D, 0x7E, 0xFC, 0x2F, 0xF4, 0x01, 0x40, 0x01, 0x54, 0x15, 0x40, 0x7F,
-    0xC7, 0xFC, 0x0F, 0xF0, 0xFF, 0x03, 0xF8, 0x3F, 0x80, 0xBD, 0x0B, 0xD0, 0x05, 0x00, 0x50, 0x00,
-    0x54, 0x00, 0x15, 0x7F, 0x01, 0xFD, 0x3F, 0xCB, 0xF4, 0x0F, 0xFF, 0xD0, 0x0B, 0xFF, 0x40, 0x01,
-    0x54, 0x00, 0x05, 0x43, 0xF1, 0xF8, 0xBD, 0x3F, 0x0F, 0xC3, 0xE1, 0xF8, 0x68, 0x00, 0x15, 0x05,
-    0x43, 0xF0, 0xFC, 0x7E, 0x1F, 0x87, 0xD1, 0xF4, 0xBD, 0x2F, 0x0A, 0x82, 0xA0, 0x15, 0x41, 0x50,
-    0x3F, 0xC7, 0xF8, 0x0F, 0xD2, 0xFC, 0x07, 0xF0, 0xFD, 0x01, 0xF4, 0x3F, 0x00, 0x50, 0x05, 0x00,
-    0x7C, 0x00, 0x03, 0xF8, 0x01, 0x4F, 0xD1, 0x4F, 0x19, 0x2E, 0x3E, 0x02, 0xF0, 0xBF, 0xFF, 0x80,
-    0xBF, 0xF8, 0x00, 0x14, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xEA, 0xFC,
-    0xBC, 0x01, 0xF5, 0x40, 0x01, 0x40, 0x00, 0xFD, 0x02, 0xFC, 0x03, 0xF8, 0x0B, 0xF0, 0x1F, 0xF0,
-    0x3F, 0xD0, 0x7F, 0xC0, 0x15, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x3F, 0x00, 0x15, 0x00, 0xFF, 0x3F, 0xCF, 0xF2, 0xFC, 0x7F, 0x1F, 0xC3, 0xF0, 0x54,
-    0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xD0, 0x3F, 0xC0, 0x3F, 0x00, 0x15, 0x00,
-    0x15, 0x41, 0xFF, 0x02, 0xFD, 0x03, 0xF8, 0x03, 0xF0, 0x01, 0x40, 0x00, 0x55, 0x00, 0xBF, 0xC0,
-    0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x5B, 0x4F, 0xFC,
-    0x15, 0xF0, 0x03, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x74, 0x02, 0xD5, 0x0F, 0xFC, 0x3D, 0x51, 0xE0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x2A, 0xAB, 0xC0, 0x00, 0x78, 0x00, 0x07, 0x40,
-    0x00, 0xB0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x09, 0x00, 0x00, 0x55, 0x00, 0x7F, 0xC0, 0x2F,
-    0xF0, 0x0F, 0xF4, 0x2F, 0xF8, 0x1F, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x8B, 0xD3, 0xD1,
-    0xF0, 0x7D, 0x0F, 0x80, 0x90, 0x02, 0x80, 0x0F, 0x00, 0x78, 0x1B, 0xF9, 0xFF, 0xF4, 0x00, 0x00,
-    0x2A, 0xA8, 0x3F, 0xFC, 0x07, 0x80, 0x07, 0x40, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x3C, 0x1F, 0xFE, 0x6F, 0xE4, 0x2C, 0x00, 0xA0, 0x00, 0x6A, 0xAB, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x1F, 0xD0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0xBF, 0x43, 0xFF, 0xC0, 0xFF,
-    0xD0, 0x3F, 0xD0, 0x00, 0x0A, 0x80, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xD8,
-    0x3F, 0xFC, 0x1F, 0xFC, 0x02, 0xA4, 0x00, 0x01, 0xFC, 0x3F, 0xE3, 0xFD, 0x3F, 0xC0, 0x00, 0x1F,
-    0x43, 0xE0, 0xFE, 0x2F, 0xC3, 0xF8, 0xBF, 0x0B, 0x81, 0xF4, 0x05, 0x40, 0x3F, 0xF0, 0xBE, 0xFC,
-    0xF4, 0x3C, 0xF4, 0x3C, 0xBE, 0xFC, 0x3F, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0xFE, 0x0B,
-    0xF0, 0x3F, 0x00, 0x54, 0x00, 0x03, 0xE0, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0xFC, 0x57, 0xFC, 0x7F,
-    0xF8, 0x7F, 0xD0, 0x03, 0xF0, 0x3F, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0xA0, 0xFF, 0xD0, 0xFF, 0x00,
-    0x00, 0x05, 0x40, 0xFC, 0x1F, 0x81, 0xF4, 0x2F, 0x03, 0xF0, 0x3F, 0x07, 0xE0, 0x68, 0x00, 0x0A,
-    0xAA, 0xAA, 0x07, 0xFF, 0xFF, 0xC2, 0xD0, 0x00, 0xF0, 0xF0, 0x00, 0x78, 0x3C, 0x00, 0x2D, 0x05,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x38, 0x1D, 0xB9, 0xFD, 0x7C, 0x3F, 0xDF, 0xF0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x15, 0x0F, 0xC0, 0x7F, 0x82, 0xFC, 0xBF, 0x40, 0x3F, 0xFF, 0x40, 0x07,
-    0xFF, 0x80, 0x00, 0x55, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
-    0x3F, 0xCB, 0xF0, 0x3F, 0x80, 0xBF, 0x05, 0x00, 0x05, 0x40, 0x14, 0x00, 0x14, 0x3E, 0x00, 0xFC,
-    0x3F, 0xEB, 0xF8, 0x1F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x55, 0x00, 0x1F,
-    0xFF, 0x41, 0xFF, 0xFF, 0x0F, 0xEA, 0xFE, 0x7D, 0x00, 0xF8, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0x7C, 0x0B, 0xF8, 0x05, 0x00, 0x10,
-    0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x05, 0x55, 0x50, 0x15, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAA, 0x80, 0x05, 0x55, 0x55, 0x41, 0xFF, 0xFF, 0xFD, 0x1A, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0xFF, 0xFA, 0xF8, 0x7F, 0xFF, 0xFC, 0x3E, 0x0B, 0xFD,
-    0x05, 0x00, 0x14, 0x00, 0x2A, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF5, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x07, 0xF8,
-    0x00, 0x3F, 0xF8, 0x02, 0xFF, 0xD0, 0x1F, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0x0B, 0xC3, 0xF4, 0x39, 0x00, 0x28, 0x00,
-    0x18, 0x3C, 0x00, 0x2C, 0x78, 0x00, 0x3C, 0xB9, 0x55, 0x7C, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x39, 0x55, 0x7C, 0x74, 0x00, 0x38, 0xB0, 0x00, 0x74, 0xBF,
-    0xFF, 0xF0, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3D, 0x7E, 0x6D, 0xB0, 0x38,
-    0x1D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2D, 0x7C, 0x1F, 0xF0, 0x0F, 0xC0, 0x3F, 0xF0, 0x74, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x02, 0xF0,
-    0x3E, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x41, 0xFF, 0xFF, 0xFD, 0x1A, 0xAA, 0xAA, 0x80, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0xAA, 0x40, 0x15, 0x40, 0xFF,
-    0x80, 0xFF, 0x01, 0xFD, 0x01, 0xFC, 0x01, 0x50, 0x01, 0x55, 0x07, 0xFD, 0x0F, 0xF4, 0x2F, 0xD0,
-    0xBF, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x03, 0xD1, 0xFF, 0xFB, 0xF0, 0xFF, 0xFF,
-    0xF8, 0x7C, 0x1F, 0xF8, 0x05, 0x00, 0x10, 0x00, 0x6A, 0x0B, 0xFC, 0x5F, 0xC0, 0xFC, 0x0F, 0x40,
-    0x50, 0x00, 0x01, 0xAA, 0x00, 0x03, 0xE0, 0xFF, 0x8F, 0x83, 0xFC, 0xBF, 0x8F, 0xF0, 0xFE, 0x3F,
-    0xC3, 0xFC, 0x2E, 0x1F, 0xC0, 0xB8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x47,
-    0xF9, 0x7F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF7, 0xEA, 0xAA, 0xB9, 0xD0, 0x00,
-    0x2D, 0xB0, 0x00, 0x0F, 0x28, 0x00, 0x02, 0x80, 0x05, 0x55, 0x55, 0x41, 0xFF, 0xFF, 0xFD, 0x1A,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0x2A, 0xAA, 0xAA,
-    0x40, 0x15, 0x05, 0x43, 0xF0, 0xFC, 0x3E, 0x0F, 0x87, 0xE1, 0xF4, 0xBD, 0x2F, 0x46, 0x81, 0xA0,
-    0x15, 0x4B, 0xFE, 0x6B, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x00, 0x04, 0x00, 0x04, 0x74, 0x52, 0xFF,
-    0xC7, 0x9F, 0xBF, 0xFC, 0xB0, 0xFF, 0xD1, 0x4B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x06, 0x90, 0x1C, 0x1F, 0xFD, 0x7C, 0x3D,
-    0xBF, 0xF4, 0x74, 0x0B, 0xD0, 0x00, 0xB4, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2C, 0x0F, 0xFF, 0xF8, 0x2D, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x74, 0x3F, 0xFF, 0xF0, 0xB4, 0x7F, 0xC0, 0x50, 0x05, 0x00, 0x00, 0x81, 0x40, 0x1E,
-    0x0B, 0x43, 0xFF, 0xFF, 0x87, 0xEA, 0xF8, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x1F, 0xC2, 0xF9, 0x0F, 0x01, 0xE0, 0x2D, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03,
-    0xFC, 0x03, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00,
-    0xCA, 0x30, 0x00, 0x90, 0x00, 0x84, 0x01, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x05, 0x00, 0x60, 0x60, 0x00, 0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70,
-    0xD0, 0x00, 0x00, 0x30, 0xD7, 0x04, 0x00, 0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0,
-    0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00,
-    0x20, 0x01, 0xCA, 0x34, 0x00, 0x87, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0xD7, 0xA8, 0x02, 0xA8, 0x02, 0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x38, 0x0B, 0xE0,
-    0x3F, 0x1F, 0xFF, 0x48, 0x00, 0x06, 0xC1, 0xFC, 0x3E, 0x03, 0xC0, 0x3E, 0x02, 0xF0, 0x06, 0x00,
-    0x01, 0xBE, 0x40, 0x3F, 0xFF, 0x82, 0xFA, 0xBF, 0x0F, 0x40, 0x3D, 0x78, 0xFC, 0xB8, 0x07, 0xF4,
-    0x00, 0x0F, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x92, 0x03, 0xFE, 0x07, 0xF0, 0x3F, 0xD0, 0xF7,
-    0x80, 0x00, 0x00, 0x00, 0x50, 0xBD, 0x3F, 0x43, 0xE0, 0x1B, 0xD0, 0x0A, 0x90, 0x0B, 0xE0, 0x1F,
-    0xC0, 0xBC, 0x7E, 0x4A, 0x00, 0x90, 0x01, 0x40, 0xBD, 0x03, 0xE0, 0x1F, 0xC7, 0xF0, 0x0F, 0xCB,
-    0x74, 0xBE, 0x0E, 0x38, 0xD0, 0x2C, 0x1C, 0x0A, 0x00, 0xF8, 0x0B, 0xC0, 0x3C, 0x0B, 0xC3, 0xF4,
-    0x39, 0x00, 0x00, 0x0F, 0xEB, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x03, 0x80, 0x8E, 0x53, 0xFF, 0x82,
-    0xF4, 0x1E, 0xF0, 0x22, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF4, 0x79, 0xBD, 0x7C, 0xB0, 0x38,
-    0x0D, 0xB0, 0x38, 0x0D, 0x79, 0xFE, 0x7C, 0x1F, 0xD7, 0xF0, 0x34, 0x07, 0x00, 0xBF, 0xDA, 0xBC,
-    0x02, 0xC0, 0x24, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x42, 0xFE,
-    0x40, 0x00, 0x6F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFD, 0x00, 0x00, 0x00,
-    0x7F, 0x82, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x2B, 0xFF, 0xE4, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x54, 0x2A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFA, 0x40, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF, 0xAB, 0xF8, 0x3F, 0xEB, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7D, 0x00, 0x06, 0xBF, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF9, 0x00, 0x00, 0xBF, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0x8A, 0x90, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x15, 0x55, 0x55, 0x55, 0x57, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x02, 0x44, 0x1F, 0xFD, 0x3C, 0x3C, 0x78, 0x3C, 0x78, 0x78, 0x7D, 0xF4, 0x3F, 0xB0, 0x00,
-    0x00, 0x01, 0xA0, 0x0F, 0xBC, 0x2D, 0x3C, 0x3F, 0xF8, 0x3D, 0x40, 0x3D, 0x60, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0x02, 0x80, 0x40, 0xB4, 0x3C, 0x0F, 0x07, 0x82, 0xD0, 0xB0, 0x00, 0x01, 0x90, 0x1F,
-    0xF8, 0x3C, 0x3C, 0x78, 0x3C, 0x74, 0x3C, 0x7D, 0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x04, 0x04, 0x2C,
-    0x2D, 0x3C, 0x3C, 0x3C, 0x3C, 0x78, 0x78, 0x7D, 0xF4, 0x3E, 0x70, 0x00, 0x00, 0x02, 0x90, 0xBF,
-    0xC7, 0xC0, 0x2D, 0x00, 0xF0, 0x02, 0xE6, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-    0x25, 0xE0, 0x7F, 0xF4, 0x3C, 0x3C, 0x1E, 0x0F, 0x07, 0x47, 0x81, 0xF7, 0xD0, 0x2F, 0xB0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x60, 0x2F, 0xFC, 0x3D, 0x3C, 0x3C, 0x3C, 0x78, 0x78,
-    0xB4, 0x74, 0xB0, 0xB0, 0x04, 0x60, 0x60, 0x2F, 0xFE, 0xFC, 0x3D, 0x3D, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x78, 0x78, 0x78, 0xB4, 0xB4, 0xB4, 0xB0, 0xB0, 0xB0, 0x04, 0x60, 0x7F, 0xC2, 0xF0, 0x0F, 0x00,
-    0x3C, 0x01, 0xE0, 0x0B, 0x40, 0x00, 0x03, 0x00, 0xF5, 0x3F, 0xD1, 0xD0, 0x2D, 0x03, 0xC0, 0x3D,
-    0x02, 0xF4, 0x00, 0x00, 0x50, 0x17, 0xC2, 0xDB, 0x0E, 0x1D, 0xF0, 0x7B, 0x80, 0xFC, 0x03, 0xD0,
-    0x00, 0x05, 0x01, 0x41, 0xF3, 0xC0, 0x3F, 0xC0, 0x07, 0xD0, 0x03, 0xF4, 0x03, 0xDF, 0x03, 0xD2,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F,
-    0xF2, 0xFC, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F,
-    0x40, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00,
-    0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD,
-    0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0F, 0xF4, 0x02, 0xFF,
-    0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0xAB, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x07, 0xFC, 0x02, 0xFF, 0x00,
-    0xBF, 0x80, 0x0F, 0xF4, 0x0F, 0xF4, 0x00, 0xFF, 0x40, 0xFF, 0x40, 0x1F, 0xF4, 0x1F, 0xF0, 0x03,
-    0xFF, 0x01, 0xFF, 0xAB, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xDF, 0xD0, 0x00, 0x00, 0xBF, 0x9F, 0xE0, 0x00, 0x00, 0xFF, 0x0F,
-    0xE0, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x0B, 0xF4, 0x00, 0x7F, 0xC0, 0x0B, 0xF4, 0x00,
-    0xFF, 0x40, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x0B, 0xF8,
-    0x00, 0x03, 0xFC, 0x0F, 0xFE, 0xAA, 0xAF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07,
-    0xFE, 0xAA, 0xA0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xD0,
-    0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00,
-    0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0xAA, 0xAF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF,
-    0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80,
-    0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03,
-    0xFD, 0x2F, 0xF0, 0x55, 0x43, 0xFD, 0x3F, 0xE3, 0xFF, 0xD3, 0xFD, 0x3F, 0xD3, 0xFF, 0xC7, 0xFC,
-    0x3F, 0xD3, 0xFF, 0xCB, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE,
-    0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F, 0xD0, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF0, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xBF, 0xD0, 0x00, 0x02, 0xFE, 0x7F, 0xE0, 0x00,
-    0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x43, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0xBF, 0xC0, 0x00, 0x1F, 0xF0, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x02,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xC0, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x01, 0xFE, 0x7F, 0x40,
-    0x00, 0x3F, 0xD7, 0xF4, 0x00, 0x07, 0xFC, 0x7F, 0x80, 0x00, 0xFF, 0x47, 0xF8, 0x00, 0x1F, 0xF0,
-    0x3F, 0xC0, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFC, 0x01,
-    0xFF, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x02,
-    0xFD, 0x1F, 0xF0, 0x00, 0x2F, 0xE3, 0xFE, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x1F, 0xE0, 0x00,
-    0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00,
-    0x07, 0xFF, 0xD0, 0x0B, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x03, 0xFB, 0xF8, 0x00, 0xFE, 0xFD, 0x00, 0x7F, 0xBF, 0x40, 0x1F, 0xDF, 0xD0,
-    0x0F, 0xEB, 0xF4, 0x02, 0xFD, 0xFD, 0x01, 0xFC, 0xFF, 0x00, 0x3F, 0xCF, 0xD0, 0x3F, 0x8F, 0xF0,
-    0x03, 0xFC, 0xFE, 0x07, 0xF1, 0xFE, 0x00, 0x3F, 0x8B, 0xE0, 0xFE, 0x2F, 0xD0, 0x07, 0xF4, 0xBE,
-    0x1F, 0xC3, 0xFC, 0x00, 0xBF, 0x0B, 0xE3, 0xF8, 0x3F, 0xC0, 0x0F, 0xF0, 0xBF, 0x7F, 0x03, 0xFC,
-    0x00, 0xFF, 0x07, 0xFF, 0xE0, 0x7F, 0x80, 0x1F, 0xE0, 0x7F, 0xFC, 0x0B, 0xF4, 0x01, 0xFD, 0x07,
-    0xFF, 0x80, 0xFF, 0x00, 0x2F, 0xC0, 0x7F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xFE, 0x01, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xF8, 0x00,
-    0xFF, 0xFE, 0x00, 0x2F, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xEF, 0xF4, 0x03, 0xFC,
-    0x00, 0x7F, 0x6F, 0xE0, 0x1F, 0xE0, 0x02, 0xFD, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0xFF, 0x02,
-    0xFD, 0x00, 0x3F, 0xC2, 0xFE, 0x0F, 0xF0, 0x01, 0xFE, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x0F,
-    0xF1, 0xFE, 0x00, 0x2F, 0xD0, 0x2F, 0xE7, 0xF4, 0x00, 0xFF, 0x00, 0x7F, 0xEF, 0xC0, 0x03, 0xFC,
-    0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0xBF, 0x40, 0x07, 0xFF, 0xE0, 0x02,
-    0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xA4, 0x07, 0xFF, 0xFF,
-    0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC,
-    0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF0,
-    0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFC, 0x00,
-    0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x0B,
-    0xF8, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0x80, 0x3F, 0xE0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x02,
-    0xFF, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x3F, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xEA, 0x50, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFB, 0xFF, 0xF4, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xAA,
-    0xA0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x2F, 0xF0, 0x2F, 0xE0, 0x03,
-    0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x0B,
-    0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFB, 0xFE, 0xBF, 0xFC, 0x0F, 0xFD, 0x03,
-    0xFC, 0x0B, 0xFD, 0x1F, 0xF0, 0x03, 0xFC, 0x02, 0xFE, 0x3F, 0xD0, 0x07, 0xF8, 0x01, 0xFF, 0x3F,
-    0xC0, 0x0B, 0xF4, 0x01, 0xFF, 0x7F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x7F, 0xC0, 0x0F, 0xF0, 0x02,
-    0xFE, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x3F, 0xE0, 0x1F, 0xE0, 0x0F, 0xF8, 0x3F, 0xF9, 0x2F,
-    0xD1, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x0F,
-    0xFC, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF0, 0x0B, 0xF4, 0x07, 0xF8, 0x7F, 0xC0, 0x3F, 0xC0,
-    0x2F, 0xE1, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x4B, 0xF4, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0xC0, 0x2F,
-    0xE0, 0x1F, 0xF0, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x87, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x2F, 0xE0,
-    0x0F, 0xF0, 0x0F, 0xF0, 0xBF, 0x40, 0x7F, 0x80, 0x3F, 0xC2, 0xFD, 0x02, 0xFD, 0x02, 0xFE, 0x0B,
-    0xF8, 0x0F, 0xF4, 0x1F, 0xF4, 0x2F, 0xF8, 0x3F, 0xC2, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1A, 0xFF, 0xA5,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0xAF, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xFC,
-    0x00, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x02, 0xFF, 0x00, 0x00, 0x3F,
-    0xD0, 0x3F, 0xD0, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x07,
-    0xFC, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x07, 0xF8, 0x02,
-    0xFD, 0x00, 0x2A, 0xBF, 0xC0, 0xFF, 0xEA, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBE,
-    0x01, 0xFF, 0xFD, 0xFD, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xFC, 0x2F, 0xF4, 0x0F, 0xFC,
-    0x3F, 0xE0, 0x0F, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0x80, 0x0F, 0xF0,
-    0xFF, 0x80, 0x1F, 0xE0, 0xFF, 0x80, 0x3F, 0xE0, 0xFF, 0x80, 0x7F, 0xD0, 0xBF, 0xD1, 0xFF, 0xE4,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x3F, 0xF8, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x2F, 0xF4, 0x00, 0xBF, 0xC0, 0x3F, 0xD0, 0x03, 0xFD, 0x00,
-    0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x00,
-    0x0F, 0xF8, 0xFF, 0xE0, 0x00, 0x3F, 0xD7, 0xFD, 0x00, 0x01, 0xFF, 0x2F, 0xFF, 0x00, 0x07, 0xFC,
-    0x07, 0xFE, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x01, 0xFF, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0x91, 0xFF, 0xE0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0x7F, 0xFE, 0x00, 0x0B, 0xF8, 0x05,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x1F, 0xF1, 0xFE, 0x00, 0x7F, 0xC7, 0xF8, 0x02, 0xFE, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0,
-    0x3F, 0xD0, 0xFF, 0x01, 0xFF, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xC1, 0xFF,
-    0x00, 0xBF, 0x0F, 0xF0, 0x01, 0xFC, 0xBF, 0x80, 0x07, 0xF7, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xD0, 0x2E, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xFF, 0x80, 0x1F, 0xF8, 0x2F, 0xF0, 0x0F, 0xF8, 0x03,
-    0xFD, 0x07, 0xFC, 0x00, 0xFF, 0x82, 0xFE, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x0F, 0xF4, 0x3F, 0xE0,
-    0x07, 0xFD, 0x0F, 0xF8, 0x03, 0xFF, 0x02, 0xFF, 0x42, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x02, 0xC0, 0x3F, 0x80,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xFA, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x1F,
-    0xF9, 0x50, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x01, 0xD0, 0x3F, 0xFF, 0xFD,
-    0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFD, 0x00, 0x1F, 0xCB, 0xFF, 0xD0, 0x0B, 0xFB, 0xFF, 0xFC,
-    0x03, 0xFF, 0xD6, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0, 0x07,
-    0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0xC0,
-    0x0F, 0xF0, 0x2F, 0xF0, 0x07, 0xFC, 0x0B, 0xF8, 0x02, 0xFE, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0xFF,
-    0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0x07, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x0B, 0xFC, 0x03,
-    0xFD, 0x0F, 0xF4, 0x03, 0xFD, 0x1F, 0xF0, 0x03, 0xFD, 0x2F, 0xF0, 0x03, 0xFC, 0x3F, 0xFA, 0xAF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xBF, 0xEA, 0xAF, 0xF8, 0xBF, 0x80, 0x0F,
-    0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xFF, 0x40, 0x3F, 0xE0, 0xFF, 0x40, 0x3F, 0xD0, 0xBF, 0x80, 0xBF,
-    0xC0, 0x7F, 0xC1, 0xFF, 0x40, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x0F, 0xF0,
-    0x07, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x1F, 0xF0, 0x07, 0xFC, 0x02, 0xFF, 0x00,
-    0xFF, 0xD1, 0x2F, 0xFF, 0xD7, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x50, 0x00, 0x00, 0xFF, 0x00, 0x7F,
-    0xD0, 0x1F, 0xF0, 0x1F, 0xF8, 0x02, 0xFE, 0x07, 0xFE, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x03, 0xFC,
-    0x3F, 0xE0, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x07, 0xFB, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF9, 0xFF, 0x40, 0x02, 0xFE, 0x0F,
-    0xFC, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x03, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07,
-    0xFC, 0x00, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x01,
-    0xFE, 0xBF, 0x00, 0x00, 0x3F, 0xCB, 0xF4, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0xFF, 0x07, 0xF8,
-    0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xF4, 0x0F, 0xF4,
-    0x03, 0xFF, 0xD3, 0xFF, 0x00, 0x2F, 0xFC, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x3F,
-    0xE0, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x07,
-    0xFC, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x03, 0xFD, 0x00,
-    0x7F, 0xC0, 0x2F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x1F, 0xFF, 0x50, 0x3F, 0xFF,
-    0xFB, 0xFF, 0x40, 0xFF, 0xFF, 0xCF, 0xFD, 0x07, 0xFE, 0xFC, 0x1F, 0xF0, 0x2F, 0xE0, 0x00, 0x04,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x1F, 0xF1, 0xFE, 0x00, 0x7F, 0xC7, 0xF8, 0x02, 0xFE, 0x0F, 0xF0, 0x0F, 0xF4, 0x3F, 0xC0, 0x3F,
-    0xC0, 0xFF, 0x01, 0xFF, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x2F, 0xC1, 0xFE, 0x00,
-    0xBF, 0x0F, 0xF0, 0x01, 0xFC, 0xBF, 0x80, 0x07, 0xF7, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0xE4, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x40, 0x1F, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F,
-    0xF4, 0xBF, 0xD0, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA,
-    0xFE, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF,
-    0x87, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x5B, 0xFD, 0x57, 0xFD, 0x54, 0x02, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x7F,
-    0xC0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x03, 0xFC,
-    0x00, 0x02, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x2F, 0xE0,
-    0x00, 0x0F, 0xF0, 0x0F, 0xFC, 0x10, 0x07, 0xFC, 0x03, 0xFF, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0xFE,
-    0x00, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xE6,
-    0xFF, 0x40, 0x3F, 0xE0, 0x3F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x02, 0xFE,
-    0x00, 0xFF, 0x80, 0xFF, 0x40, 0x3F, 0xD0, 0x3F, 0xC0, 0x1F, 0xF4, 0x1F, 0xF0, 0x0B, 0xFC, 0x0B,
-    0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x97, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xF3, 0xFF, 0x80, 0x0B, 0xF8, 0x04, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC,
-    0x0F, 0xFE, 0x57, 0x41, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xE5, 0xFE, 0x50, 0x2F, 0xF4, 0x0B, 0xF0, 0x03, 0xFE, 0x00, 0xBF, 0x40, 0x7F, 0xC0,
-    0x0B, 0xF8, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x0F, 0xF8, 0x0B, 0xF8, 0x00, 0xFF, 0x40,
-    0xBF, 0x80, 0x1F, 0xF0, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xE1, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFE, 0x05, 0x7F, 0xE5, 0x50, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x14,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x07, 0xFC, 0x01, 0xFE, 0x0B, 0xF8, 0x01, 0xFF, 0x0F, 0xF8, 0x01, 0xFF, 0x0F, 0xF4, 0x01, 0xFF,
-    0x0F, 0xF0, 0x02, 0xFF, 0x1F, 0xF0, 0x02, 0xFE, 0x2F, 0xE0, 0x03, 0xFE, 0x3F, 0xD0, 0x03, 0xFD,
-    0x3F, 0xC0, 0x03, 0xFD, 0x7F, 0xC0, 0x07, 0xFC, 0x7F, 0xC0, 0x0F, 0xF8, 0x7F, 0xC0, 0x2F, 0xF0,
-    0x7F, 0xD1, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0xBF, 0xF4, 0x00, 0x2F,
-    0xE0, 0xFF, 0xFF, 0x80, 0x1F, 0xFC, 0xBF, 0xFF, 0xF4, 0x0F, 0xFC, 0x3F, 0xD2, 0xFF, 0x0B, 0xFC,
-    0x1F, 0xF0, 0x3F, 0xC3, 0xFE, 0x0B, 0xF8, 0x0F, 0xF1, 0xFF, 0x02, 0xFD, 0x03, 0xFC, 0x7F, 0xC0,
-    0xFF, 0x01, 0xFF, 0x2F, 0xF0, 0x3F, 0xC0, 0xBF, 0xCB, 0xFC, 0x1F, 0xE0, 0x3F, 0xE2, 0xFF, 0x0B,
-    0xF4, 0x2F, 0xF4, 0x7F, 0xD3, 0xFD, 0x1F, 0xFC, 0x0F, 0xFD, 0xFF, 0x6F, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xFD, 0x00,
-    0x2F, 0xE0, 0x07, 0xFF, 0xC0, 0x1F, 0xF0, 0x01, 0xAF, 0xF4, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x0B,
-    0xF8, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x0B, 0xFE, 0x80,
-    0x03, 0xFD, 0x01, 0xFF, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF,
-    0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x3F, 0xD0, 0xFF, 0x81, 0xFF, 0x03, 0xFD, 0x0F, 0xF4, 0x2F,
-    0xE0, 0x3F, 0xD0, 0xFF, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0xC2, 0xFE, 0x03,
-    0xFC, 0x07, 0xFC, 0x3F, 0xD0, 0x7F, 0xC0, 0xBF, 0xC3, 0xFD, 0x0B, 0xF8, 0x0F, 0xF8, 0x3F, 0xC0,
-    0xFF, 0x40, 0xFF, 0x47, 0xFC, 0x0F, 0xF0, 0x2F, 0xF0, 0x7F, 0xC0, 0xFF, 0x07, 0xFD, 0x03, 0xFE,
-    0x1F, 0xE6, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F,
-    0xD0, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x00, 0x00,
-    0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x7F, 0x80, 0x2F, 0xC0, 0x2F, 0xD3, 0xFD, 0x00,
-    0xFE, 0x00, 0xBF, 0x4F, 0xF0, 0x03, 0xF8, 0x02, 0xFD, 0x3F, 0xC0, 0x1F, 0xD0, 0x0F, 0xF1, 0xFE,
-    0x00, 0xBF, 0x00, 0x3F, 0xC7, 0xF8, 0x03, 0xFC, 0x02, 0xFE, 0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4,
-    0x3F, 0xD1, 0xFF, 0xE1, 0xFF, 0xC0, 0xBF, 0xFF, 0xEF, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xD0, 0x00, 0xFF, 0xD0, 0x7F, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00,
-    0xBF, 0x4B, 0xF0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x01, 0xFF, 0x01,
-    0xFE, 0x00, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFD, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0,
-    0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x26, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xF6, 0xFC, 0x00, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02,
-    0xFD, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x7F, 0x40, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x07, 0xFC, 0x07,
-    0xF8, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x01, 0xFF, 0xAA, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0xFF, 0x80,
-    0x00, 0xFF, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0x5F,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B,
-    0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0x8A, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFF, 0x87, 0xE0, 0x00, 0x07,
-    0xFF, 0xCA, 0x40, 0x00, 0x1F, 0xDB, 0xE0, 0x00, 0x00, 0x7F, 0x02, 0xF4, 0x00, 0x00, 0x54, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x00, 0x01, 0xFF, 0xFC, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x6F, 0xFC, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xBF, 0xC0,
-    0x7F, 0xD0, 0x00, 0xBF, 0xE6, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xBF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0xA6, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF,
-    0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F,
-    0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0,
-    0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x1A, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xD1, 0xFF, 0x80, 0x00, 0x97, 0xFF, 0xC0, 0x00, 0x1F, 0xDB,
-    0xE0, 0x00, 0x7F, 0x02, 0xF4, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F,
-    0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x89, 0x00, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x02,
-    0xFD, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x00,
-    0x07, 0xFE, 0xAA, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03,
-    0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xFF, 0x8F, 0x80, 0x00, 0x1F, 0xFF, 0x28,
-    0x00, 0x01, 0xFD, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0xBC, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0B, 0xE0, 0x00, 0x7F, 0xFF, 0x3F, 0x80, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xF9, 0xBF, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFE, 0x00,
-    0x3F, 0xD0, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xF0,
-    0x07, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x0B, 0xFE, 0x6F, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xBF, 0xC0, 0x00, 0x2F, 0xF4, 0xFE, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x0A, 0x00, 0x00, 0x01, 0xFF, 0xEB, 0x80,
-    0x00, 0x00, 0xFA, 0xFF, 0xC0, 0x00, 0x00, 0x38, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00,
-    0x00, 0x14, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFE, 0xFC, 0x00, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x4B, 0xF0, 0x00, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x00, 0x1F,
-    0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x07, 0xF8, 0x00, 0x07, 0xFE, 0xAA, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0,
-    0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x00,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xA0, 0x1D, 0x00, 0x0F, 0xFF, 0xBC,
-    0x00, 0x1F, 0xBF, 0xF8, 0x00, 0x28, 0x06, 0x90, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x54, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC,
-    0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4,
-    0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0,
-    0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0,
-    0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00,
-    0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x3F, 0xD7, 0xF4, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F,
-    0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF,
-    0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF,
-    0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x05, 0x0F, 0x45, 0x00, 0x00, 0x0F, 0x28, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF,
-    0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0,
-    0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00,
-    0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x14, 0x3E, 0x14, 0x00, 0x3D, 0x64,
-    0xBC, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B,
-    0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF,
-    0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x05, 0x3D, 0x05, 0x00, 0x00, 0x0F, 0x0A, 0x3E, 0x00, 0x00, 0x0F,
-    0x80, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00,
-    0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0,
-    0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00,
-    0x02, 0xA0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x14, 0x7C, 0x14, 0x00, 0x3D, 0x18, 0xBC, 0x00,
-    0x2F, 0x42, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x0F,
-    0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F,
-    0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B,
-    0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x05, 0x1F, 0x45, 0x00, 0x00, 0x0F, 0x2C, 0x3E,
-    0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F,
-    0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x14,
-    0x3E, 0x14, 0x00, 0x3D, 0x34, 0xBC, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF,
-    0xFC, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0,
-    0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xA8, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0xC0, 0x00, 0x00, 0xB9, 0xFF, 0xD0, 0x00, 0x00,
-    0x18, 0x06, 0x40, 0x00, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x00, 0x03, 0xD0, 0x1F, 0x80, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x02, 0xFD,
-    0xBF, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x4B, 0xF0, 0x00, 0x00, 0x3F, 0xC1,
-    0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x7F, 0x40, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x0F, 0xF4, 0x07,
-    0xF8, 0x00, 0x07, 0xFE, 0xAA, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x02, 0xE4, 0x1E, 0x00, 0x0F, 0xFF, 0xBD, 0x00, 0x1F, 0x6F, 0xF8, 0x00, 0x04, 0x01,
-    0x40, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B,
-    0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F,
-    0xF0, 0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x15, 0x00, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x1F, 0xEA, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0x6F, 0xC0, 0x00, 0x00,
-    0xFF, 0x2F, 0xC0, 0x00, 0x02, 0xFD, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x1F, 0xD0, 0x00, 0x0B, 0xF4,
-    0x1F, 0xD0, 0x00, 0x1F, 0xF0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x1F, 0xE0, 0x00, 0x7F, 0xEA, 0xAF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x3F,
-    0xE0, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14,
-    0x00, 0x3F, 0x00, 0xBC, 0x00, 0x3F, 0xEB, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBE, 0x01, 0xFF, 0xFC, 0xFE,
-    0x07, 0xFF, 0xFF, 0xFD, 0x0F, 0xFE, 0x6F, 0xFC, 0x1F, 0xF8, 0x0F, 0xFC, 0x3F, 0xF0, 0x0B, 0xF8,
-    0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0xC0, 0x0F, 0xF4, 0xBF, 0xC0, 0x0F, 0xF0, 0xBF, 0xC0, 0x1F, 0xF0,
-    0xBF, 0xC0, 0x3F, 0xE0, 0xBF, 0xC0, 0x7F, 0xD0, 0xBF, 0xE6, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xBF, 0xC0, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0,
-    0x2F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8,
-    0x0B, 0xFE, 0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x9B, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xEA,
-    0xA9, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x47, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFD, 0x0F, 0xF4, 0x7F, 0xC0, 0x2F, 0xD3, 0xFE, 0x00, 0xFF, 0x4F, 0xF4, 0x6F,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF8, 0x0B, 0xFE, 0xA4, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x2C, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x2E,
-    0x00, 0x03, 0xFF, 0xEB, 0xD0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0x42, 0xFF, 0x00, 0x00, 0x50,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0xAA, 0x40, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x3E, 0x00, 0x3F, 0xFE,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xF4, 0x2F, 0xF0, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x0B, 0xF4, 0x3F, 0xE0, 0x0F, 0xF4, 0x3F, 0xD1, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xC0, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x2F, 0xF4, 0xBE, 0x00, 0x00, 0x0B, 0xFF, 0xCA, 0x40, 0x00, 0x02, 0xFD, 0xFD, 0x00,
-    0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA,
-    0xA4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xAA, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x03, 0xFF, 0x4B, 0xD0, 0x00, 0x0B, 0xFF, 0xCA, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0xBE,
-    0x03, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x0F, 0xF4,
-    0x00, 0x1F, 0xF0, 0x0B, 0xF4, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD1, 0xBF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xFF, 0x40, 0x00,
-    0x66, 0xFF, 0xF0, 0x00, 0x02, 0xFD, 0xFD, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x54, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xA0,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xF4, 0x00, 0x66, 0xFF, 0xF0, 0x00, 0x2F, 0xCF,
-    0xD0, 0x02, 0xF8, 0x0F, 0xC0, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0x43, 0xFD, 0x1F, 0xF0, 0x0B, 0xF4, 0xFF,
-    0x80, 0x3F, 0xD3, 0xFD, 0x1B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFE, 0x02, 0xFF, 0xA9,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x2F, 0xF4, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x90, 0x00, 0x02, 0xFD, 0xFD, 0x00, 0x00,
-    0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xFA, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xFF, 0x0F, 0x80, 0x00, 0xFF,
-    0xF8, 0x90, 0x00, 0x2F, 0xCF, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xD0, 0xFF, 0x40, 0x1F, 0xF0, 0x0B, 0xF4, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x3F,
-    0xD1, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0xA4, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x02, 0x80, 0x00, 0x0F, 0xFE, 0xBC, 0x00, 0x02, 0xFB, 0xFF, 0x40, 0x00,
-    0x3C, 0x0B, 0x90, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x05, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xAA, 0xA8, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x90,
-    0x2C, 0x00, 0x1F, 0xFE, 0xFC, 0x00, 0x3E, 0xBF, 0xF0, 0x00, 0x28, 0x06, 0x80, 0x00, 0x02, 0xAA,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x50, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFD, 0x0F, 0xF4, 0x1F, 0xF0, 0x0B, 0xF4, 0x3F, 0xE0, 0x0F, 0xF4, 0x3F, 0xD1, 0xBF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xEA, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xF2, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01,
-    0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0x90, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F,
-    0xFA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0xFE,
-    0x02, 0xF8, 0x00, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x0F, 0xF4, 0x1F, 0xF0, 0x0B, 0xF4, 0x3F, 0xE0,
-    0x0F, 0xF4, 0x3F, 0xD1, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFE, 0x00, 0xBF, 0xEA,
-    0x40, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x0B, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x16, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x05, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xC0,
-    0x03, 0xF4, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xD0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x01, 0xFF, 0x40, 0x07,
-    0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x02,
-    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xE0, 0x00,
-    0xFF, 0x40, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xFC, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA,
-    0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07,
-    0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD,
-    0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4,
-    0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4, 0xBF, 0xD0, 0x3F,
-    0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE, 0x00, 0x3F, 0xEB,
-    0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F,
-    0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0,
-    0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x47, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD, 0x6F, 0xF4,
-    0xBF, 0xD0, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFF, 0x7F, 0xC0, 0x0B, 0xFA, 0xFE,
-    0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xFF, 0x6F, 0xE0, 0x07, 0xFC, 0xBF, 0xC0, 0x3F, 0xE1, 0xFF, 0x87,
-    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F,
-    0xE1, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xCA, 0x40, 0x00, 0x00, 0x7F, 0x6F, 0x80, 0x00, 0x00, 0x07,
-    0xF0, 0x3F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFE, 0xAF, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x2F, 0xF0, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF4,
-    0x00, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x03,
-    0xFD, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF9, 0x6F, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFF, 0x4B, 0xD0, 0x00, 0x0B, 0xFF,
-    0xCA, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFD, 0x6F, 0xF4, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0x3F,
-    0xE0, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0xBF, 0x80,
-    0x0F, 0xF8, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F,
-    0xE0, 0x00, 0x7F, 0xE1, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xFE, 0x00, 0x00, 0x06, 0x5F, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x6F, 0x80, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B,
-    0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD,
-    0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F,
-    0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0xF4, 0x00, 0x66, 0xFF, 0xF0,
-    0x00, 0x2F, 0xCF, 0xD0, 0x02, 0xF8, 0x0F, 0xC0, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0xFF, 0x5B, 0xFD, 0x2F, 0xF4,
-    0x0F, 0xF8, 0xFF, 0x80, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xDF, 0xF0, 0x02, 0xFE, 0xBF, 0x80, 0x0F,
-    0xFA, 0xFE, 0x00, 0x3F, 0xDB, 0xF8, 0x01, 0xFF, 0x2F, 0xF0, 0x0F, 0xF8, 0x7F, 0xE1, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0x40, 0x00, 0x01, 0xFF, 0xF2, 0x80,
-    0x00, 0x00, 0x7F, 0x6F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x1F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x01, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x3F, 0xD0, 0x00,
-    0x07, 0xFC, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x07, 0xFD, 0x00,
-    0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF4,
-    0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xE5, 0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x03, 0xFF, 0x4F, 0x80, 0x00, 0xBF, 0xFC, 0x90, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x0B,
-    0xE0, 0x3F, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xD6, 0xFF, 0x40, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x7F, 0xC0, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0xBF, 0x80,
-    0xBF, 0x80, 0x0F, 0xF8, 0x0B, 0xF8, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x1F, 0xF0, 0x0B, 0xFC, 0x03,
-    0xFE, 0x00, 0x7F, 0xE1, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00,
-    0x2F, 0xFE, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x64, 0x00, 0x00,
-    0x3F, 0xFA, 0xF0, 0x00, 0x00, 0x7E, 0xFF, 0xE0, 0x00, 0x00, 0xB0, 0x1A, 0x40, 0x00, 0x00, 0x02,
-    0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x01, 0xFD, 0x0F,
-    0xC0, 0x00, 0x01, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03,
-    0xFF, 0x80, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4,
-    0x00, 0x03, 0xFD, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00,
-    0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F,
-    0xF8, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0,
-    0x1F, 0xFE, 0x5B, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x2C, 0x00, 0x0F, 0xFE,
-    0xBC, 0x00, 0x2E, 0xBF, 0xF4, 0x00, 0x28, 0x06, 0x80, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x6F,
-    0xF4, 0x2F, 0xF4, 0x0F, 0xF8, 0x3F, 0xE0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x7F, 0xC0, 0x0B,
-    0xF8, 0xBF, 0x80, 0x0F, 0xF8, 0xBF, 0x80, 0x0F, 0xF4, 0xBF, 0x80, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F,
-    0xE0, 0x7F, 0xE1, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x1F, 0xD0, 0x00, 0x03, 0xF8, 0x0B, 0xF0, 0x00, 0x01,
-    0x50, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xF4, 0x03, 0xFF, 0x80, 0x1F,
-    0xFC, 0x07, 0xFE, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x07, 0xFD, 0x1F, 0xF4, 0x00, 0x03, 0xFD,
-    0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x3F,
-    0xD0, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xFC, 0x7F, 0xD0, 0x00, 0x0F, 0xF8, 0x3F, 0xD0,
-    0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF, 0xC0, 0x1F, 0xFE, 0x5B,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x0F, 0xF2, 0xFC, 0x00, 0xFE, 0x03, 0xF8, 0x01, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xD6, 0xFF, 0x4B, 0xFD, 0x03,
-    0xFE, 0x3F, 0xE0, 0x0B, 0xFD, 0xFF, 0x00, 0x2F, 0xF7, 0xFC, 0x00, 0xBF, 0xAF, 0xE0, 0x03, 0xFE,
-    0xBF, 0x80, 0x0F, 0xF6, 0xFE, 0x00, 0x7F, 0xCB, 0xFC, 0x03, 0xFE, 0x1F, 0xF8, 0x7F, 0xF0, 0x3F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x06, 0xFF, 0xF4, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC2, 0xFE, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFE, 0x00,
-    0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xF4, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xFE,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x5F, 0xFF, 0x40,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x55, 0x00, 0x00, 0x54, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0xF8, 0x0F, 0xF4, 0x01, 0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xD6, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x1F,
-    0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF,
-    0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x01, 0xFF,
-    0x87, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x06, 0xFF, 0xF4, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC2,
-    0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0xFE,
-    0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40,
-    0x01, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00,
-    0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x1F,
-    0xFE, 0x5F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55, 0x00, 0x00, 0x05, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xF8, 0x0F, 0xF4, 0x01, 0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD6, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00,
-    0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x03,
-    0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFC,
-    0x2F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0xFF, 0xFA, 0xBF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00,
-    0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x01,
-    0xFF, 0xE5, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x04, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x05, 0x50, 0x00, 0x02, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0B,
-    0xFF, 0x80, 0xFF, 0x40, 0x1F, 0xFF, 0xFD, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFD,
-    0x6F, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x01, 0xFF, 0x00,
-    0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x0B, 0xF8, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x00, 0x0B, 0xF8, 0x00,
-    0xFF, 0x40, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x7F,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x06, 0xFF, 0xF4, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC2, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x00,
-    0x3F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x01,
-    0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xFC,
-    0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFE,
-    0x5F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B, 0x80, 0x00, 0x03, 0xFF, 0xEF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x2F, 0xF0, 0x55, 0x00, 0x14, 0x00, 0x40, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xF8, 0x0F, 0xF4, 0x01, 0xFF, 0xFF, 0xDF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xD6, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x0B,
-    0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x03, 0xFE,
-    0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x1B, 0xFF, 0xD0, 0x1F, 0xF0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFB, 0xFC, 0x00, 0x3F, 0xFE, 0xAF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF4, 0x00,
-    0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x7F, 0xF9, 0x7F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xF8, 0x0F, 0xF4, 0x01, 0xFF, 0xFF,
-    0xDF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xD6, 0xFF, 0xF4, 0x00, 0xBF, 0xD0, 0x3F,
-    0xE0, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0xBF,
-    0x80, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x2F, 0xE0, 0x07, 0xFC,
-    0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC,
-    0x02, 0xFE, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07,
-    0xFC, 0x00, 0x1F, 0xF0, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4,
-    0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF,
-    0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0xFF, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x03, 0xFC, 0x07, 0xFC, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x3F,
-    0xC0, 0x0F, 0xF4, 0x0F, 0xF0, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x80,
-    0x7F, 0xD2, 0xFF, 0xD0, 0x0F, 0xFF, 0xFB, 0xF4, 0x03, 0xFF, 0xF5, 0xFC, 0x00, 0x3F, 0xF4, 0x7F,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x09, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x01, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x02, 0xFE, 0x00, 0x0B, 0xF8,
-    0x03, 0xFD, 0x00, 0x0F, 0xF8, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFC, 0x00, 0x2F, 0xF0, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x0F, 0xF4, 0x00, 0x3F, 0xD0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x00, 0xBF, 0xC0, 0x3F, 0xE0, 0x00,
-    0xFF, 0x80, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE,
-    0x00, 0x2F, 0xFE, 0x6F, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x3F, 0xC0, 0xBF, 0x80, 0x1F, 0xF0, 0x3F, 0xE0, 0x0B, 0xF8, 0x0F, 0xF4, 0x03,
-    0xFD, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0xBF, 0x80, 0x2F, 0xF0, 0x3F, 0xD0,
-    0x0F, 0xF8, 0x0F, 0xF0, 0x03, 0xFD, 0x03, 0xFC, 0x01, 0xFF, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x7F,
-    0xC0, 0x7F, 0xE0, 0x1F, 0xF4, 0xBF, 0xF4, 0x03, 0xFF, 0xFE, 0xFD, 0x00, 0xFF, 0xFD, 0x7F, 0x00,
-    0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xD3, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xF1,
-    0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0xFF, 0x40, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xD0,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE4, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF,
-    0xF5, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x01, 0x50, 0x00, 0x01, 0x40, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xCB, 0xFC, 0x0B, 0xF8, 0x01,
-    0xFF, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD1,
-    0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x3F, 0xD3, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xF1,
-    0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0xFF, 0x40, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xD0,
-    0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xE4, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00,
-    0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF,
-    0xF5, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0x50, 0x00, 0x00, 0x14, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xCB, 0xFC, 0x0B, 0xF8, 0x01,
-    0xFF, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x03,
-    0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xF4,
-    0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD1,
-    0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0xFF, 0x00, 0x03, 0xFD, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0xFF, 0x1F, 0xF0, 0x1F, 0xF0,
-    0x00, 0x7F, 0xDF, 0xF4, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xF4, 0x03, 0xFD, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0xFF, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x5B, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x15, 0x00, 0x00, 0x2A, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x1F,
-    0xF0, 0x03, 0xFC, 0xBF, 0xC0, 0xBF, 0x80, 0x1F, 0xFB, 0xFC, 0x03, 0xFE, 0x00, 0xBF, 0xFF, 0xC0,
-    0x0F, 0xF4, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xF8, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x3F,
-    0xD0, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x4B, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x41, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x0F, 0xF0, 0x00,
-    0x3F, 0xD3, 0xFD, 0x07, 0xFC, 0x00, 0x0F, 0xF1, 0xFF, 0x01, 0xFF, 0x00, 0x07, 0xFD, 0xFF, 0x40,
-    0xBF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xD0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-    0xE4, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF,
-    0x80, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00,
-    0x03, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xBF, 0xF5, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0xBC, 0x00, 0x00, 0x03, 0xFF, 0xEB, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0xF4, 0x01, 0x50, 0x01, 0x40, 0x05, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41,
-    0xFF, 0x00, 0x3F, 0xCB, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFF, 0xFC,
-    0x00, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x03,
-    0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0x00,
-    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x3F, 0xC0,
-    0x00, 0xFF, 0x4F, 0xF4, 0x1F, 0xF0, 0x00, 0x3F, 0xC7, 0xFC, 0x07, 0xFC, 0x00, 0x1F, 0xF7, 0xFD,
-    0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0xFF, 0x90, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x03,
-    0xFE, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xD6, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x3F, 0xCB, 0xFC, 0x0B, 0xF8, 0x01, 0xFF, 0xBF, 0xC0, 0x3F, 0xE0, 0x0B, 0xFF, 0xFC, 0x00,
-    0xFF, 0x40, 0x3F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00,
-    0x00, 0xBF, 0x80, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x07,
-    0xFE, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0,
-    0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B,
-    0xFC, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F,
-    0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0,
-    0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC,
-    0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x83, 0xFD, 0x00, 0x2F, 0xF0,
-    0x2F, 0xE0, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xF0, 0x1F, 0xF0, 0x00, 0xFF, 0x43,
-    0xFD, 0x00, 0x0B, 0xF4, 0xBF, 0xC0, 0x00, 0x7F, 0x9F, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00,
-    0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F,
-    0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3,
-    0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF2, 0xFC, 0x00, 0x2A, 0xFF, 0xC3, 0xFD, 0x00, 0x3F, 0xFF, 0x47, 0xFD, 0x00, 0x3F, 0xFD,
-    0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x57, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x1B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x0F, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC, 0x00,
-    0x07, 0xF9, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x04, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03,
-    0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x2F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00,
-    0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7, 0xF8, 0x00, 0x00, 0x0F,
-    0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x03, 0xC0, 0x00, 0xBF, 0xFE, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x01, 0xF0, 0x7F, 0xE0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xF8, 0x3F, 0xD0, 0x02, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xFC,
-    0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0x07, 0xF9,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0xF4, 0x00, 0x01, 0xFF, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xC1, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x00,
-    0x3F, 0xC0, 0x2F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0xC0, 0x00, 0x2F,
-    0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xD2, 0xFE, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x0F, 0xE7,
-    0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2A,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8, 0xA0, 0xE0, 0xA1,
-    0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9, 0x2E, 0xAE, 0x0B,
-    0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC,
-    0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x55, 0x54, 0x1A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00,
-    0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD,
-    0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x7F,
-    0x00, 0xBD, 0x7F, 0x00, 0xBD, 0x2A, 0x00, 0x68, 0x05, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x0A,
-    0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA,
-    0x40, 0x00, 0xBD, 0x01, 0xFC, 0x03, 0xF8, 0x0B, 0xF4, 0x0F, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0, 0x15,
-    0x40, 0x02, 0xFD, 0x03, 0xFC, 0x0B, 0xF8, 0x0F, 0xF0, 0x1F, 0xD0, 0x2F, 0xC0, 0x3F, 0x40, 0x15,
-    0x00, 0x01, 0x54, 0x03, 0xFD, 0x07, 0xFC, 0x0F, 0xF4, 0x0F, 0xE0, 0x2F, 0xC0, 0x3F, 0x80, 0x3E,
-    0x00, 0xBF, 0x2F, 0xCB, 0xF1, 0xFC, 0x7F, 0x0F, 0xC3, 0xF0, 0x14, 0x00, 0xBD, 0x07, 0xE0, 0x1F,
-    0xC0, 0xFD, 0x03, 0xF8, 0x2F, 0xC0, 0xBF, 0x03, 0xF8, 0x0F, 0xF0, 0xFF, 0x02, 0xFD, 0x1F, 0xF0,
-    0x3F, 0xC3, 0xFD, 0x01, 0x54, 0x15, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0x3F, 0xC3, 0xFD, 0x0B, 0xF4,
-    0x3F, 0xC0, 0xFF, 0x0B, 0xF4, 0x1F, 0xD0, 0xFF, 0x02, 0xFC, 0x1F, 0xC0, 0x3F, 0x03, 0xF8, 0x01,
-    0x50, 0x15, 0x00, 0x01, 0x54, 0x05, 0x50, 0x3F, 0xC2, 0xFE, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0x07,
-    0xF8, 0x0F, 0xE0, 0xFF, 0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0x82, 0xFC, 0x03, 0xE0, 0x2F, 0x40, 0xFF,
-    0x0B, 0xF3, 0xFC, 0x2F, 0xDB, 0xF0, 0x7F, 0x5F, 0xC1, 0xFD, 0x7F, 0x03, 0xF4, 0xFC, 0x0F, 0xD3,
-    0xF4, 0x2F, 0x81, 0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x01, 0x95, 0xF9, 0x68, 0xBF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0x4E, 0xAF, 0xDA, 0xC0, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x0F, 0xC1, 0x40, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xBF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x1F, 0xFF, 0x43, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC2, 0xFF, 0xFC,
-    0x0F, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0F, 0x80, 0x00, 0xFE, 0x00, 0x0F,
-    0xFC, 0x01, 0xFF, 0xF0, 0x2F, 0xFF, 0xC3, 0xFF, 0xF4, 0x3F, 0xF4, 0x07, 0xF4, 0x00, 0xB4, 0x00,
-    0x04, 0x00, 0x00, 0x06, 0x43, 0xFD, 0x7F, 0xEB, 0xFD, 0x7F, 0xC0, 0x50, 0x05, 0x00, 0x05, 0x43,
-    0xFC, 0x02, 0xFE, 0xBF, 0xD0, 0x3F, 0xFB, 0xFC, 0x07, 0xFE, 0x7F, 0x80, 0x3F, 0xC0, 0x40, 0x00,
-    0x50, 0x05, 0x00, 0x05, 0x00, 0x05, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0xBF, 0xD0, 0xBF, 0xD0,
-    0xBF, 0xDB, 0xFC, 0x0B, 0xFC, 0x0F, 0xFC, 0x7F, 0x80, 0x7F, 0x80, 0x7F, 0x80, 0x40, 0x00, 0x40,
-    0x00, 0x40, 0x05, 0x03, 0xFC, 0xBF, 0xDF, 0xFC, 0x7F, 0x80, 0x40, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F,
-    0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
-    0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00,
-    0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xF8, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xF8, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0x1F, 0xC6, 0xF8, 0x00, 0x1B, 0x90, 0x7F, 0x5F,
-    0xE3, 0xF2, 0xFF, 0xF0, 0x0F, 0xFF, 0x83, 0xFF, 0xFC, 0xFD, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x2F,
-    0xFF, 0x6F, 0x8F, 0xF3, 0xFC, 0x7F, 0x9F, 0xD0, 0x7F, 0x87, 0xF1, 0xFD, 0x2F, 0xCF, 0xF0, 0xFD,
-    0x00, 0x00, 0xFD, 0x2F, 0xC2, 0xFC, 0xFD, 0x0F, 0xD0, 0x00, 0x3F, 0x83, 0xF8, 0x3F, 0xDF, 0xC0,
-    0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF9, 0xFC, 0x1F, 0xC0, 0x01, 0xFC, 0x03, 0xF4, 0x7F, 0x6F,
-    0xC2, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x4B, 0xF2, 0xFC, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0xFF, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0xBF,
-    0xE0, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD3, 0xF8, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x7F, 0x1B, 0xE0, 0x00, 0x6E, 0x40, 0x02, 0xF8, 0x07, 0xF5, 0xFE,
-    0x3F, 0x2F, 0xFF, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0xFF, 0xFF, 0x3F, 0x5F, 0xFF, 0xE0, 0xFF,
-    0xFF, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0x6F, 0x8F, 0xF3, 0xFC, 0x7F, 0x9F, 0xD3, 0xFD, 0xBF, 0x01,
-    0xFE, 0x1F, 0xC7, 0xF4, 0xBF, 0x3F, 0xC3, 0xF5, 0xFD, 0x1F, 0xC0, 0x00, 0x0F, 0xD2, 0xFC, 0x2F,
-    0xCF, 0xD0, 0xFD, 0xBF, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0xFE, 0x0F, 0xF7, 0xF0, 0x3F, 0x7F, 0xC2,
-    0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x43, 0xF9, 0xFC, 0x1F, 0xCF, 0xE0, 0xFE, 0x00, 0x07, 0xF0, 0x0F,
-    0xD1, 0xFD, 0xBF, 0x0B, 0xF3, 0xF8, 0x3F, 0x40, 0x03, 0xF4, 0x03, 0xF4, 0xBF, 0x2F, 0xC3, 0xF8,
-    0xFE, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0x47, 0xFF, 0xFC, 0x3F, 0xFF, 0xE0, 0x02, 0xFC,
-    0x00, 0x2F, 0xFF, 0x80, 0xFF, 0xFD, 0x07, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x1F,
-    0x80, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0xFD, 0x07, 0xF0,
-    0x03, 0xFC, 0x0F, 0xD0, 0x07, 0xF0, 0x2F, 0xC0, 0x0F, 0xD0, 0x3F, 0x00, 0x1F, 0x80, 0xFD, 0x00,
-    0x2A, 0x00, 0xA8, 0x00, 0x00, 0x3F, 0x81, 0xFD, 0x0B, 0xF0, 0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0x80,
-    0x0F, 0xD0, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x03, 0xF4, 0x1F, 0xC0, 0x07, 0xF0, 0x2F, 0xC0, 0xFE,
-    0x00, 0x3F, 0x40, 0xFC, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xD0, 0x3F, 0x00, 0x0A, 0x80, 0x2A, 0x01,
-    0xA4, 0x00, 0x7F, 0x40, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x00, 0xF8,
-    0x00, 0xA8, 0x7F, 0x42, 0xFC, 0x03, 0xF8, 0x1F, 0xD0, 0x1F, 0xC0, 0xFF, 0x00, 0xFE, 0x03, 0xF0,
-    0x07, 0xF0, 0x2F, 0x80, 0x3F, 0x40, 0xFC, 0x00, 0xF8, 0x0B, 0xD0, 0x0A, 0x80, 0x2A, 0x7F, 0x42,
-    0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x42, 0xFC, 0x01, 0xFC, 0x0F, 0xF0, 0x3F, 0x80, 0x3F, 0x80,
-    0xFC, 0x07, 0xF0, 0x07, 0xF0, 0x2F, 0x80, 0xFD, 0x00, 0xFD, 0x03, 0xF0, 0x1F, 0xC0, 0x0F, 0x80,
-    0xBD, 0x03, 0xF0, 0x02, 0xA0, 0x0A, 0x80, 0x29, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF4,
-    0x00, 0x0F, 0xE0, 0x00, 0xB7, 0xC0, 0x07, 0xCB, 0x00, 0x3D, 0x2D, 0x02, 0xE0, 0x78, 0x0F, 0x00,
-    0xE0, 0xF4, 0x03, 0xC0, 0x00, 0x10, 0x00, 0x1F, 0x40, 0x0F, 0xF4, 0x0F, 0xF8, 0x0F, 0xFC, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF4, 0x02, 0xFF, 0x00, 0x3F, 0xC0, 0x0B,
-    0xE0, 0x00, 0x40, 0x00, 0x00, 0x50, 0x01, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x00,
-    0xBF, 0xC0, 0x0F, 0xF4, 0x0B, 0xFC, 0x07, 0xFD, 0x07, 0xFD, 0x03, 0xFE, 0x02, 0xFE, 0x00, 0x2F,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x0B, 0xF0, 0x00, 0x80,
-    0x07, 0xD0, 0x0F, 0xF8, 0x02, 0xF0, 0x0F, 0xF4, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xE0,
-    0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x2F, 0xE0, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x80, 0x54,
-    0x2F, 0xC0, 0x3F, 0xFE, 0x01, 0xFD, 0x3F, 0xD0, 0x0F, 0xFC, 0x03, 0xFE, 0x3F, 0xD0, 0x2F, 0xFD,
-    0x02, 0xFE, 0x0B, 0x40, 0xBF, 0xFF, 0x40, 0xB8, 0x00, 0x02, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x0B,
-    0xF8, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0x40,
-    0x02, 0xFE, 0x01, 0x40, 0x3F, 0xD0, 0x0B, 0xF8, 0x0B, 0xF4, 0x0F, 0xF4, 0x0B, 0xE0, 0x0F, 0xF8,
-    0x03, 0xF4, 0x02, 0x80, 0x0F, 0xF4, 0x00, 0xD0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x0F, 0xF4, 0x0F, 0xF4,
-    0x01, 0xFF, 0x01, 0xFF, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x02, 0xFE, 0x02, 0xFE, 0x00, 0x3F, 0xD0,
-    0x3F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x07, 0xF8, 0x07, 0xF8, 0x00,
-    0xBF, 0x40, 0xBF, 0x40, 0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xBF,
-    0xD0, 0xBF, 0xD0, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFC, 0x2F, 0xFD,
-    0xFF, 0x05, 0xFF, 0x2F, 0xD0, 0x3F, 0x8B, 0xF4, 0x0F, 0xD3, 0xFC, 0x03, 0xF7, 0xFE, 0x01, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x1C, 0x34, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x01, 0xF0, 0x0F, 0x40, 0x1B, 0xC0, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x07, 0xD0, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x78, 0x38, 0x00, 0x00, 0x2C, 0x30,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x2F, 0x2D, 0x00, 0x00,
-    0xF0, 0x78, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x7C, 0x03, 0xC0, 0x03, 0xD0, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC1, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x05, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x90, 0x03, 0xF4, 0x00, 0x10, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1F, 0x43, 0xF0, 0x00, 0x02, 0xE0, 0x3F, 0x00, 0x0B, 0xFD, 0xF8, 0x00, 0x00,
-    0xFF, 0x9F, 0x40, 0x03, 0xFF, 0xFF, 0xAF, 0xC0, 0x3F, 0xFF, 0xEA, 0xF8, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x01, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFC, 0x15,
-    0x00, 0x07, 0xFF, 0xC1, 0x40, 0x3F, 0xEF, 0x80, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x3F, 0xD3, 0xF0,
-    0x00, 0x07, 0xFC, 0x7F, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x00, 0xBD, 0x0F, 0xD0, 0x00, 0x20, 0x2F,
-    0xC0, 0x00, 0x06, 0x03, 0xF8, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x15, 0x55,
-    0x4F, 0xFF, 0xD3, 0xFF, 0xF4, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xFA, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xF8,
-    0x00, 0x3F, 0x94, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFD, 0x50, 0x00, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFD, 0x00, 0x1A, 0xAA, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x03,
-    0xFF, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x0A, 0xBF, 0xC0, 0x03,
-    0xFF, 0xE0, 0x01, 0xFF, 0xF4, 0x00, 0x17, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x01,
-    0x6F, 0xD0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0x2A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x1B, 0xFF, 0x80, 0x3F, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF8, 0x2F, 0x96, 0xFF, 0x0F, 0xE5, 0xFF, 0xC1, 0x80, 0x0F,
-    0xF4, 0x50, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-    0xE0, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x3F, 0xE3, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xF8, 0xFF, 0xFF, 0xFC, 0x07, 0xFC, 0x2F, 0x96, 0xFF, 0x02, 0xFF, 0x06, 0x00, 0x3F,
-    0xD0, 0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00, 0x0B, 0xFE,
-    0x07, 0xFC, 0x00, 0x0F, 0xFE, 0x02, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0xBF, 0x40, 0x0F, 0xFD, 0x00,
-    0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01,
-    0x40, 0x03, 0xFC, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x7F, 0xFD, 0x00, 0x0F, 0xFC, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xE0,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xFD, 0x6F, 0xF8, 0x07, 0xFC, 0x02, 0x00, 0x2F, 0xE0, 0x2F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xF0,
-    0x0F, 0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xF0, 0x01, 0xFE, 0x00, 0x0B, 0xFD,
-    0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x01, 0x50, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xD0, 0x07, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xBF, 0xFF, 0xFC, 0x3D, 0x1F, 0xFF,
-    0xFD, 0x3D, 0x1F, 0xFF, 0xFE, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF,
-    0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFF, 0x3D, 0x1F, 0xFF, 0xFE, 0x3D, 0x1F, 0xFF,
-    0xFC, 0x3D, 0x1F, 0xFF, 0xF8, 0x3D, 0x1F, 0xFF, 0xD0, 0x3D, 0x1F, 0x14, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x3D, 0x1F, 0x00,
-    0x00, 0x3D, 0x1F, 0x00, 0x00, 0x28, 0x1A, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8,
-    0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8, 0x3E, 0x7F, 0xFF, 0xF8,
-    0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x3F, 0xFF, 0xF8, 0x3E, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x6F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xF8, 0x3F, 0xFF, 0xF8, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF, 0xFC, 0xF8, 0x3F, 0xFF,
-    0xFC, 0xF8, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x04, 0x01, 0xFC, 0x00,
-    0x3E, 0x0B, 0xD0, 0x00, 0xFF, 0xAF, 0x00, 0x07, 0xFF, 0xFE, 0xBF, 0x41, 0xBF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xF0, 0x0B, 0xFF, 0x81, 0x40, 0xBF, 0x7F, 0x00, 0x0B, 0xF8, 0xFD, 0x00, 0x0F, 0xC2,
-    0xFC, 0x00, 0x09, 0x03, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0B, 0xFC,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0xBF, 0x00,
-    0x7F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x38, 0x00,
-    0x00, 0x2C, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x34, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00,
-    0x0F, 0x40, 0x1B, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xB8, 0x1F, 0x80, 0x00, 0x0F, 0xFA, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xAF, 0xD0, 0x01,
-    0xBF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xF8, 0x14, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x07, 0xFC, 0xBE, 0x00, 0x00, 0x2F, 0x07, 0xF0, 0x00, 0x00, 0x50, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x7E, 0x00, 0x00, 0x3F, 0xEB, 0xC0, 0x00, 0x07, 0xFF, 0xFE,
-    0xBF, 0x40, 0x06, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x50, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x2F, 0xF2, 0xF8, 0x00, 0x00, 0xBC, 0x1F, 0xC0, 0x00, 0x02, 0x40, 0xFD,
-    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xCF, 0xFC, 0x0F, 0xE3,
-    0xFF, 0x03, 0xF4, 0xBF, 0x82, 0xFC, 0x06, 0x40, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x05,
-    0x01, 0xFC, 0x1F, 0xF0, 0xFE, 0x0B, 0xFC, 0x7F, 0x02, 0xFF, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x7C, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x90, 0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x40, 0x1A,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFE, 0x6F, 0xD0, 0x0B, 0x80,
-    0x00, 0xF0, 0x2D, 0x00, 0x00, 0x38, 0x34, 0x00, 0x00, 0x2C, 0x20, 0x00, 0x00, 0x04, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0x03, 0xE0, 0x40, 0x07, 0xC3, 0xE2, 0xF0, 0x0F, 0xF7, 0xEB, 0xF4, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x6A, 0xFF, 0xFF, 0xAA, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x0B, 0xFB, 0xEF, 0xF0, 0x0B, 0xD3,
-    0xE3, 0xF0, 0x02, 0x43, 0xE0, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x3F, 0x83, 0xF8, 0x7F, 0x47, 0xF4, 0x02, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0x80, 0x0F, 0xD1, 0xFD,
-    0x1F, 0xC2, 0xFC, 0x00, 0xFF, 0x0F, 0xE0, 0xFD, 0x0F, 0xD0, 0x07, 0xF0, 0x7F, 0x0B, 0xF0, 0xFE,
-    0x00, 0x3F, 0x43, 0xF0, 0x3F, 0x07, 0xF0, 0x01, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x00, 0x0A, 0x80,
-    0xA8, 0x0A, 0x81, 0xA4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1A, 0x03, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF0,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x0B,
-    0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x05,
-    0x03, 0xFC, 0x7F, 0xD7, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC7, 0xFD, 0x7F, 0xD3, 0xFC,
-    0x06, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x05, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x7F, 0xD0, 0x00, 0x2F, 0xF0,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0xA4, 0x0B, 0xE0, 0x0A, 0x40, 0x03, 0xFD, 0x0B, 0xE0, 0x3F, 0xD0, 0x07, 0xFE, 0x0B, 0xE0,
-    0x7F, 0xE0, 0x03, 0xFD, 0x0B, 0xE0, 0x3F, 0xD0, 0x02, 0xF8, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x1F, 0x40, 0x03, 0xFD, 0x0B, 0xE0, 0x7F, 0xD0,
-    0x07, 0xFE, 0x0B, 0xE0, 0x7F, 0xD0, 0x03, 0xFD, 0x0B, 0xE0, 0x7F, 0xD0, 0x01, 0xF8, 0x0B, 0xE0,
-    0x1F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x3F, 0xE7, 0xFE, 0x3F, 0xD0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFE,
-    0x3F, 0xF3, 0xFE, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFC, 0x7F, 0xE7, 0xFE, 0x3F,
-    0xD0, 0x64, 0x15, 0x2F, 0xEF, 0xFF, 0xFF, 0x7F, 0x40, 0x01, 0x92, 0xFE, 0xFF, 0xFF, 0xF3, 0xF0,
-    0x00, 0x2A, 0x3F, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xFF, 0xF2, 0xA0, 0x00,
-    0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F,
-    0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38,
-    0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x7F, 0x80, 0x0F, 0xFF,
-    0xC0, 0xBF, 0xFF, 0x43, 0xF8, 0xFE, 0x2F, 0xC2, 0xFC, 0xFE, 0x0F, 0xE3, 0xF4, 0x3F, 0x8F, 0xD0,
-    0xFD, 0x7F, 0x07, 0xF0, 0xFD, 0x3F, 0xC3, 0xFF, 0xFD, 0x0B, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x90, 0x3F, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0xFC, 0x1F, 0x82, 0xF4, 0x3F, 0x03,
-    0xF0, 0x3E, 0x07, 0xD0, 0xBC, 0x0A, 0x80, 0x00, 0x01, 0xA8, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF4, 0x02, 0xF7, 0xF4, 0x0B, 0xD7, 0xF0, 0x1F, 0x8B, 0xF0, 0x3F,
-    0xAF, 0xF8, 0x7F, 0xFF, 0xFC, 0x6A, 0xBF, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x02, 0xAA,
-    0xA0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7F, 0xFC, 0x01, 0xFF,
-    0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x4E, 0x57, 0xFC, 0x3F, 0xFF, 0xC0, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x07, 0xFF, 0xE0, 0x7F, 0xEF, 0x43, 0xF4, 0x00,
-    0x2F, 0x80, 0x00, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x1F, 0xD1, 0xFC, 0x7F, 0x03, 0xF0, 0xFC, 0x1F,
-    0xC3, 0xF9, 0xFE, 0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA9, 0x0F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x80, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xFF, 0xC0, 0xFE, 0x7F, 0x43, 0xF0, 0xBE, 0x0F, 0xE3,
-    0xF0, 0x1F, 0xFF, 0x40, 0x7F, 0xF4, 0x0B, 0xFF, 0xF4, 0x7F, 0x0F, 0xF2, 0xF8, 0x2F, 0xCB, 0xF0,
-    0xFE, 0x1F, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x1F, 0xFF, 0x80,
-    0xFF, 0xBF, 0x4B, 0xE0, 0xBE, 0x3F, 0x42, 0xF8, 0xFD, 0x0F, 0xE2, 0xFE, 0xFF, 0x43, 0xFF, 0xFD,
-    0x01, 0x97, 0xF0, 0x00, 0x3F, 0x46, 0x5B, 0xFC, 0x1F, 0xFF, 0x80, 0x7F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x78, 0x00, 0x1E, 0x01, 0xAB, 0xE9, 0xBF, 0xFF, 0xD5, 0xB9, 0x50, 0x1E,
-    0x00, 0x07, 0x80, 0x01, 0x90, 0x00, 0x55, 0x55, 0x3F, 0xFF, 0xEA, 0xAA, 0xA4, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x6A, 0xAA, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0xF4, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x02, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x1F, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0xF0, 0x07, 0xEF, 0xFC, 0x07, 0xF0, 0xFC, 0x0B,
-    0xD0, 0xFC, 0x0F, 0xC0, 0xF8, 0x0F, 0x81, 0xF8, 0x1F, 0x41, 0xF4, 0x2F, 0x02, 0xF0, 0x3F, 0x03,
-    0xF0, 0x29, 0x02, 0x90, 0x00, 0xBF, 0x40, 0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0x0B, 0xF5, 0xFD, 0x3F,
-    0x83, 0xF4, 0xFD, 0x0F, 0xD7, 0xF0, 0x3F, 0x6F, 0xC1, 0xFC, 0xBF, 0x0F, 0xF2, 0xFC, 0x7F, 0x87,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x07, 0xFD,
-    0x02, 0xFF, 0xC1, 0xFF, 0xFC, 0x2F, 0xFF, 0x80, 0xE3, 0xF4, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x6F, 0xD0, 0x03,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x01, 0x81, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xF0, 0x00, 0xAF, 0x90, 0x1F, 0xFF, 0xD0, 0x3F, 0xBF, 0xC0, 0x40, 0x7F, 0x00, 0x02,
-    0xF8, 0x02, 0xBF, 0xC0, 0x1F, 0xF4, 0x00, 0x6B, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC7, 0x96,
-    0xFF, 0x1F, 0xFF, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x07, 0xFC,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF4, 0x03, 0xF7, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F,
-    0x4B, 0xE0, 0x7F, 0xAF, 0xF8, 0x7F, 0xFF, 0xFC, 0x6A, 0xBF, 0xE8, 0x00, 0x2F, 0xC0, 0x00, 0x2F,
-    0x80, 0x02, 0xAA, 0xA0, 0x1F, 0xFF, 0xC0, 0xBF, 0xFF, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBF,
-    0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x0E, 0x57, 0xFC, 0x3F,
-    0xFF, 0xC0, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF4, 0x0B, 0xFF, 0xD0, 0xBF, 0xEF,
-    0x07, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0xFF, 0x07, 0xFF, 0xFE, 0x1F, 0xD1, 0xFC, 0x7E, 0x03,
-    0xF1, 0xF8, 0x1F, 0xC3, 0xF5, 0xFD, 0x0B, 0xFF, 0xE0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xAA, 0xA8, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x6F, 0xD0, 0x02, 0xFF, 0xF8, 0x03, 0xF9, 0xFC, 0x07,
-    0xF0, 0xFC, 0x03, 0xF1, 0xFC, 0x02, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x3F, 0x83,
-    0xF8, 0x3F, 0x43, 0xF8, 0x3F, 0x87, 0xF4, 0x2F, 0xFF, 0xF0, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xBE, 0x40, 0x2F, 0xFF, 0x41, 0xFE, 0xBF, 0x0F, 0xD0, 0xFC, 0x3F, 0x03, 0xF4, 0xFC, 0x0F,
-    0xD3, 0xFE, 0xFF, 0x07, 0xFF, 0xFC, 0x01, 0x4B, 0xE0, 0x00, 0x7F, 0x06, 0x6F, 0xF4, 0x2F, 0xFF,
-    0x40, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB4, 0x00, 0x2D, 0x02, 0xAF, 0xA9,
-    0xFF, 0xFF, 0x95, 0xF9, 0x40, 0x2D, 0x00, 0x0B, 0x40, 0x01, 0x80, 0x00, 0x55, 0x55, 0x3F, 0xFF,
-    0xEA, 0xAA, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xF6, 0xAA, 0xA8, 0x00, 0x00, 0x7F, 0xFF, 0xAF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x2F, 0x00, 0x3D,
-    0x00, 0x7C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3D,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x2E, 0x00, 0xBC, 0x02, 0xF0,
-    0x0B, 0xC0, 0x2E, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x2F,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0xB4, 0x3F, 0xFF, 0xC2, 0xF8, 0xBF, 0x0F, 0xC0, 0xF8, 0x7E, 0x03,
-    0xD2, 0xF4, 0x1F, 0x0B, 0xC0, 0xFC, 0x2F, 0x8B, 0xF0, 0x7F, 0xFF, 0x80, 0x7E, 0x3D, 0x00, 0x01,
-    0xBF, 0x40, 0xBF, 0xFD, 0x2F, 0x83, 0xE3, 0xE0, 0x7D, 0x7F, 0xFF, 0xCB, 0xFF, 0x90, 0xBC, 0x00,
-    0x0B, 0xE0, 0x10, 0x3F, 0xFF, 0x00, 0xBF, 0x90, 0x01, 0xFE, 0x00, 0xFF, 0xFC, 0x2F, 0x8B, 0xE3,
-    0xF0, 0x3E, 0x7D, 0x03, 0xEB, 0xC0, 0x7E, 0xBC, 0x0B, 0xD7, 0xE1, 0xFC, 0x3F, 0xFF, 0x00, 0xBF,
-    0x80, 0x02, 0xF0, 0x2F, 0x00, 0xBD, 0x2F, 0x40, 0x0F, 0xDF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0x80, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0x9F, 0x40, 0x1F, 0xC3, 0xF0, 0x0F, 0xC0,
-    0xBC, 0x00, 0x02, 0xFF, 0x40, 0x1F, 0xFF, 0x80, 0x50, 0x3F, 0x00, 0x00, 0xBC, 0x02, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xC3, 0xF0, 0x3E, 0x0F, 0x83, 0xF0, 0x2F, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0xA4,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE7, 0xE0, 0x03, 0xFF, 0xFC,
-    0x07, 0xF4, 0xFC, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0x80, 0xF8, 0x1F, 0x41, 0xF4, 0x2F,
-    0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3E, 0x03, 0xE0, 0x00, 0xA4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0xF8, 0x7F, 0x00, 0x7D, 0x7F, 0x00, 0x2F,
-    0x7E, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0xF8, 0x00, 0xBC, 0x3F, 0x00, 0x3F,
-    0x07, 0xE0, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0xA4, 0x07, 0xE0, 0x1F, 0x40, 0xBC, 0x03, 0xF0, 0x0F,
-    0x80, 0x7D, 0x02, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF4, 0x0B, 0xD0, 0x3F, 0x00, 0xF8, 0x00, 0x02,
-    0xC7, 0xE0, 0xBE, 0x00, 0xFB, 0xFE, 0xBF, 0xD0, 0x7F, 0x4F, 0xF5, 0xF8, 0x2F, 0x43, 0xF4, 0x3E,
-    0x0F, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0x7E, 0x07, 0xD1, 0xF4, 0x2F, 0x42, 0xF0, 0xBC, 0x0B, 0xC0,
-    0xFC, 0x3F, 0x03, 0xF0, 0x3E, 0x0F, 0x80, 0xF4, 0x1F, 0x40, 0x03, 0xC7, 0xE0, 0x1F, 0xBF, 0xE0,
-    0xBF, 0x5F, 0xC2, 0xF4, 0x3F, 0x0F, 0xC0, 0xF8, 0x3E, 0x07, 0xD1, 0xF4, 0x2F, 0x4B, 0xC0, 0xBC,
-    0x3F, 0x03, 0xF0, 0xF8, 0x0F, 0x40, 0x00, 0xF2, 0xF8, 0x01, 0xFF, 0xFD, 0x02, 0xFC, 0x7F, 0x02,
-    0xF0, 0x3F, 0x03, 0xE0, 0x3F, 0x03, 0xD0, 0x3E, 0x07, 0xD0, 0xBD, 0x0B, 0xF1, 0xFC, 0x0F, 0xFF,
-    0xF0, 0x0F, 0x9F, 0x80, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xFE, 0x03, 0xFF, 0xD2, 0xF4, 0x10, 0xBE, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x80, 0x07, 0xF1,
-    0x41, 0xFC, 0xBF, 0xFD, 0x1F, 0xF8, 0x00, 0x01, 0xD0, 0x03, 0xC0, 0x1F, 0xFD, 0x7F, 0xFD, 0x1F,
-    0x80, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x7F, 0xF0, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFE, 0x5B, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xAA,
-    0xA8, 0x3F, 0xC1, 0xFF, 0xFF, 0x1F, 0xF0, 0xBF, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0xD1, 0xFF, 0x0F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x55, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x1B, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFB, 0xFC, 0x00, 0xBF,
-    0xFF, 0x47, 0xE0, 0x07, 0xFF, 0x3C, 0x3D, 0x00, 0x3F, 0xF1, 0xE1, 0xF0, 0x01, 0xFF, 0x4F, 0x4B,
-    0x40, 0x0B, 0xFC, 0x7C, 0x3C, 0x00, 0x3F, 0xE2, 0xE1, 0xE0, 0x00, 0xFF, 0x4F, 0x0F, 0x40, 0x03,
-    0xFD, 0x78, 0x7C, 0x00, 0x0F, 0xF7, 0xD2, 0xE0, 0x00, 0x3F, 0xFF, 0x0F, 0x00, 0x00, 0xBF, 0xF8,
-    0x78, 0x00, 0x01, 0xFF, 0xE3, 0xEB, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x2E, 0x6F, 0x40, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x02,
-    0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x2F, 0xFC, 0x00, 0x14, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xA1,
-    0xF0, 0x2F, 0xF0, 0x3F, 0x7F, 0x03, 0xFE, 0x07, 0xFF, 0xF0, 0x3F, 0xE0, 0xBF, 0xE9, 0x03, 0xFD,
-    0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0xFE, 0x00, 0x03, 0xFE, 0x1F, 0xD0, 0x00, 0x3F, 0xF2, 0xFD, 0x00,
-    0x02, 0xFF, 0x6F, 0xC1, 0x00, 0x0F, 0xFF, 0xFE, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x95, 0x54, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1B, 0xFD, 0x50, 0x00, 0x0B,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0xFF, 0x55, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0x96, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x01, 0xAF, 0xFE, 0xA9, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x01, 0x6F, 0xF5, 0x50, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xEA, 0xAA, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x2F,
-    0xF4, 0xFF, 0xFD, 0x00, 0x7F, 0x2F, 0xFF, 0xBF, 0xFF, 0xC0, 0x2F, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0x5F, 0xFF, 0xD7, 0xFF, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xC0, 0xFF, 0x80, 0x7F,
-    0xD0, 0x1F, 0xF0, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x2F, 0xE0, 0x0B, 0xF8, 0x03, 0xFD, 0x0F,
-    0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x43, 0xFC, 0x02, 0xFF, 0x00, 0x3F, 0xC1, 0xFF, 0x01, 0xFF, 0xC0,
-    0x1F, 0xF0, 0xBF, 0xC0, 0xFF, 0xE0, 0x0B, 0xF8, 0x2F, 0xE0, 0xBF, 0xF4, 0x03, 0xFD, 0x0F, 0xF4,
-    0x7F, 0xFD, 0x00, 0xFF, 0x03, 0xFC, 0x3F, 0xFF, 0x00, 0x7F, 0xC1, 0xFF, 0x2F, 0xBF, 0xC0, 0x1F,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x0B, 0xD0, 0x07,
-    0xFE, 0x00, 0xFC, 0x00, 0xBF, 0xE0, 0x0F, 0xC0, 0x0F, 0xFF, 0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x2F,
-    0x80, 0x0F, 0xEF, 0x03, 0xF4, 0x01, 0xFA, 0xF0, 0x3F, 0x00, 0xBF, 0xFF, 0xAB, 0xF9, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD1, 0xBF, 0xAF, 0xAF, 0xE8, 0x03, 0xF1, 0xF4, 0xFD, 0x01, 0xBF, 0x6F, 0x9F, 0xD0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0xFA, 0xF4, 0x01, 0xFC, 0x0F,
-    0xBF, 0x00, 0x2F, 0x80, 0xFF, 0xF0, 0x02, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0x40, 0xBF, 0xE0, 0x03,
-    0xF0, 0x0B, 0xFD, 0x00, 0x7F, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x41, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x54, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF4, 0x3E, 0x00, 0x07, 0xFC, 0x03, 0xFD, 0x2F, 0x40, 0x02, 0xFE, 0x02, 0xFF, 0x0F,
-    0xD0, 0x00, 0xBF, 0x42, 0xFF, 0x9F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0x40, 0x02, 0xFF, 0xA5, 0x00, 0x2F, 0xC0,
-    0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF8, 0x1F, 0xFF, 0x40, 0x2F, 0xE0, 0x2F, 0xE2,
-    0xFF, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0x9F, 0xFF, 0xF8, 0x03, 0xFD, 0x0B, 0xFD, 0xBF, 0x41, 0xC0,
-    0x0F, 0xFA, 0xFF, 0xF3, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F,
-    0xFC, 0x01, 0xFF, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x07, 0xFC, 0x2F, 0xE0, 0x00, 0x2F, 0xF0, 0x2F,
-    0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x41, 0xFF, 0x28, 0x02, 0xFE, 0x03, 0xFC, 0x03, 0xFC,
-    0xBF, 0xFF, 0xF0, 0x1F, 0xF0, 0x0F, 0xF6, 0xFF, 0xFF, 0x40, 0xBF, 0x80, 0x3F, 0xE7, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0xF4, 0x02, 0xF8, 0x01, 0xF8, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x0F, 0xD0, 0x3F, 0x40, 0xBF, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xFE, 0x02, 0xF8, 0x03,
-    0xF0, 0x1F, 0xF8, 0x0F, 0xD0, 0x0F, 0xC0, 0xFF, 0xE0, 0x7F, 0x00, 0x3F, 0x03, 0xEF, 0x82, 0xF8,
-    0x00, 0xFC, 0x2F, 0x7D, 0x0F, 0xC0, 0x03, 0xF0, 0xFC, 0xF4, 0x7F, 0x00, 0x6F, 0xEB, 0xFB, 0xEB,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFE, 0xFE, 0xFF, 0xFF, 0xA0, 0x07, 0xE7, 0xD2,
-    0xF3, 0xF4, 0x00, 0x1F, 0x6F, 0x0B, 0xCF, 0xC0, 0x00, 0xBD, 0xF8, 0x2F, 0x7E, 0x00, 0x02, 0xFB,
-    0xD0, 0xBE, 0xF0, 0x00, 0x0B, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0x0B, 0xFD, 0x00, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF4, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x1F, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x07, 0xF9, 0x56, 0xFF, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x0B, 0xF4,
-    0x7F, 0x40, 0x0B, 0xF0, 0xA8, 0x3F, 0x47, 0xF0, 0x00, 0xFE, 0x2F, 0xC3, 0xF4, 0xBF, 0x00, 0x0F,
-    0xD2, 0xFC, 0x7F, 0x4F, 0xE0, 0x01, 0xFD, 0x3F, 0x8B, 0xF0, 0xFE, 0x00, 0x2F, 0xC3, 0xF8, 0xBF,
-    0x1F, 0xD0, 0x03, 0xFC, 0x7F, 0x4F, 0xE2, 0xFC, 0x00, 0x3F, 0x8B, 0xF0, 0xFE, 0x2F, 0xC0, 0x03,
-    0xF4, 0xFF, 0x1F, 0xD3, 0xF8, 0x00, 0x7F, 0x0F, 0xE2, 0xFC, 0x3F, 0x40, 0x0B, 0xF0, 0xFD, 0x3F,
-    0xC7, 0xF0, 0x00, 0xFF, 0x1F, 0xC2, 0xA4, 0xFF, 0x00, 0x0F, 0xE2, 0xFC, 0x00, 0x2F, 0xD0, 0x01,
-    0xFD, 0x3F, 0xC0, 0x1B, 0xFC, 0x00, 0x2F, 0xC3, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0x8B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0x50,
-    0x7F, 0x80, 0x00, 0x2F, 0xFC, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x0B, 0xFC, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0x02, 0xFD, 0x00,
-    0x1F, 0xF0, 0x02, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xF4, 0x00, 0x2F, 0xF8, 0x7F, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0x8B, 0xE0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x5F, 0x80, 0x02, 0xFF, 0x40,
-    0x10, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xEA, 0x80, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x17, 0xFE, 0x54, 0x00,
-    0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x96, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xC0, 0x1F, 0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0xBF, 0xC0,
-    0xFF, 0xC0, 0x00, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x2F, 0xF0, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x2B, 0xFF, 0xFF, 0xEA, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFC, 0x7F, 0xC0, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x00, 0x0F, 0xF4, 0x3F, 0xE0, 0x00, 0x1F, 0xF0,
-    0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x2F, 0xE0, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x0F,
-    0xFC, 0x00, 0x3F, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xD1,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x70,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFD, 0x20, 0x00, 0x2F, 0xFF, 0xBE, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x02, 0x2F,
-    0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xC0, 0x00, 0x03, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x95,
-    0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x6F, 0xE4, 0x01,
-    0xFE, 0x00, 0x2F, 0xF0, 0xBF, 0xFF, 0x40, 0xBF, 0x80, 0x0F, 0xF8, 0xBF, 0xEF, 0xF0, 0x3F, 0xD0,
-    0x0B, 0xFC, 0x3F, 0xC0, 0xFD, 0x0F, 0xF0, 0x07, 0xFE, 0x1F, 0xC0, 0x3F, 0x87, 0xFC, 0x0B, 0xFF,
-    0x0B, 0xF0, 0x0F, 0xE2, 0xFF, 0xAF, 0xFF, 0x43, 0xFC, 0x07, 0xF4, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0x97, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFD, 0x0F, 0xFF, 0xE4, 0x00, 0x2F, 0xEF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xF2, 0xFC, 0x00, 0x00, 0x7F,
-    0xC1, 0xFC, 0x00, 0x00, 0x7F, 0xC1, 0xFC, 0x00, 0x00, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0xBF, 0xC3,
-    0xF8, 0x00, 0x00, 0x7F, 0xCB, 0xF0, 0x00, 0x00, 0x7F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x08, 0x0F, 0xF8, 0x00, 0x00,
-    0x3C, 0x1F, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0xFC, 0x00, 0x01, 0xFE, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xF7, 0xFE, 0x00, 0x0F, 0xEF, 0xE2, 0xFE, 0x00, 0x2F, 0x4F, 0x82, 0xFF, 0x00, 0x7E, 0x0B, 0x01,
-    0xFF, 0x00, 0x00, 0x04, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x5B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFA, 0xFF, 0xE0, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xC0, 0x1F, 0xE0, 0x17, 0xFD, 0x57, 0xFE, 0x43, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x2F, 0xFE, 0xAF, 0xFE, 0x40, 0xFF, 0x47, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFE, 0x50, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xBF,
-    0xC0, 0x3F, 0xFD, 0xF8, 0x05, 0x01, 0xFF, 0xC3, 0xE0, 0x00, 0x0F, 0xFC, 0x0F, 0x40, 0x00, 0x7F,
-    0xE0, 0x7C, 0x00, 0x02, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xEA, 0xA8, 0x3F, 0xD0, 0x3F,
-    0xFF, 0xF1, 0xFF, 0x41, 0xFF, 0xFF, 0x87, 0xFC, 0x0B, 0xFF, 0xFD, 0x1F, 0xF0, 0x2F, 0x0F, 0xF0,
-    0x7F, 0xD0, 0xF8, 0x7F, 0xC0, 0xFF, 0x83, 0xD2, 0xFE, 0x03, 0xFF, 0x5F, 0x0F, 0xF8, 0x07, 0xFF,
-    0xFD, 0xBF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00,
-    0x00, 0x1F, 0xE7, 0xF4, 0x00, 0x00, 0x0F, 0xF5, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x6F, 0xF5, 0x57, 0xFD, 0x40, 0x0F,
-    0xF4, 0x00, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0x0B, 0xF4, 0x01, 0xFF,
-    0x00, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0xBF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xAB, 0xFF, 0x00, 0x01, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x1A, 0xAA, 0xAB, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x1A, 0xBF, 0xFF, 0xFA,
-    0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x17, 0xFF, 0xFE, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x05, 0x00,
-    0x2F, 0xF9, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xBF, 0x00, 0x3F, 0xF8, 0xBC, 0x14, 0x01, 0xFF, 0x83, 0xE0, 0x00, 0x0F, 0xFC, 0x0F,
-    0x40, 0x00, 0x7F, 0xD0, 0x7C, 0x00, 0x02, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x3E, 0x00, 0x00, 0xFF, 0x40, 0xF4, 0x00, 0x03, 0xFC, 0x07, 0xC0, 0x00, 0x0F, 0xF0,
-    0x2F, 0x00, 0x00, 0x3F, 0xD0, 0xF8, 0x00, 0x00, 0xFF, 0x83, 0xE0, 0x00, 0x03, 0xFF, 0x4F, 0x41,
-    0x00, 0x07, 0xFF, 0xFE, 0xBC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x40, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x03, 0xF8, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1B, 0xFD, 0x5F, 0xF9, 0x50, 0x02, 0xFE, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x00, 0x0B, 0xF8, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x41, 0xFF,
-    0x00, 0x00, 0x3F, 0xC0, 0x7F, 0xC0, 0x00, 0x1F, 0xF0, 0x2F, 0xF4, 0x40, 0x0B, 0xF8, 0x07, 0xFF,
-    0xF4, 0x03, 0xFD, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xBF, 0x40, 0x00, 0x03,
-    0xFE, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x01, 0xA4, 0x68, 0x29, 0x3F, 0xC0, 0x7F, 0xDF, 0xEF, 0xF3, 0xFC, 0x0B,
-    0x3F, 0x7F, 0xAF, 0x3F, 0xC0, 0xBB, 0xE2, 0xF1, 0xFB, 0xF4, 0x03, 0xFE, 0x7E, 0x1F, 0xFF, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x4B, 0xD7, 0xD0, 0x00,
-    0x00, 0xF4, 0xB8, 0x7C, 0x00, 0x00, 0x05, 0x01, 0x01, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x1A, 0xAF, 0xFA, 0xA8, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0x55, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFD,
-    0x05, 0x57, 0xFE, 0x50, 0x00, 0x1F, 0xF4, 0x01, 0xAB, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFE, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x10, 0x00, 0x7F, 0xDB, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x06, 0xFF, 0xFE, 0x40, 0x1F, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x06, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0x90,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xA7, 0xFC, 0x00, 0xFE, 0x07, 0xF8, 0x02, 0xFE, 0x0B, 0xF4, 0x03,
-    0xFC, 0x0F, 0xF4, 0x0B, 0xFC, 0x0F, 0xF0, 0x2F, 0xF4, 0x1F, 0xF6, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00,
-    0x3E, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xD0, 0x00,
-    0x0F, 0x80, 0x1F, 0x09, 0x10, 0x2E, 0x00, 0x7C, 0xFD, 0xE0, 0xB4, 0x02, 0xFF, 0xFF, 0xD7, 0xC0,
-    0x0F, 0xFA, 0xFB, 0xFE, 0x00, 0x3F, 0x43, 0x07, 0x90, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0xEB, 0xFE, 0xAD, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x82, 0xFD, 0x0F, 0xFC, 0x03, 0xFE, 0x03,
-    0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x0B, 0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x07, 0xFC, 0x0F, 0xF0, 0x0B, 0xF4, 0x0B, 0xF8, 0x0F, 0xF0, 0x05, 0x50, 0x0B,
-    0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xD0, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x2F,
-    0xF4, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x03, 0xFD, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x07, 0xFC, 0x00,
-    0x7F, 0xC0, 0x3F, 0xF0, 0x06, 0xFF, 0x5B, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x1B, 0xFD, 0x50, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x06, 0xFF, 0xEA, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xBF,
-    0xD5, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x74, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x06, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0x83, 0xD9, 0x00, 0xBF, 0xE7, 0x87, 0x80, 0x00, 0xFF, 0xCB, 0x47, 0x40, 0x02,
-    0xFF, 0x0F, 0x0B, 0x40, 0x03, 0xFF, 0x0F, 0x0F, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x1A, 0xAF, 0xFF, 0xFA, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xB0, 0xB0, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0F,
-    0x0E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFD, 0x0B, 0xFC, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x1F, 0xE0, 0x3F, 0xE0, 0x0B, 0xFE, 0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x1F, 0xE0, 0x7F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF8, 0x03, 0xFC, 0x03,
-    0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x80, 0x7F, 0xC0, 0xBF, 0xD0, 0x1F, 0xFA, 0xFF, 0xF0, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00,
-    0xF0, 0xF0, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x2A, 0xAA, 0x4F, 0xFF, 0xE3, 0xFF, 0xF5, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF,
-    0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE,
-    0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_bolditalicBitmaps[41079] = {
+    0x3A, 0xF4, 0xFC, 0x4F, 0xA4, 0xF9, 0x39, 0xF4, 0xAF, 0x4A, 0xEA, 0x4F, 0x94, 0xF5, 0xF4, 0x9E,
+    0xA4, 0xAE, 0x94, 0xF5, 0xF7, 0x77, 0x19, 0x96, 0xF4, 0xAF, 0x93, 0xAF, 0x93, 0x9E, 0xA6, 0x96,
+    0x1E, 0xA0, 0x9E, 0x90, 0x9E, 0x90, 0xAE, 0x19, 0xE1, 0xAE, 0x1A, 0xE1, 0xEA, 0x1A, 0xDA, 0x1E,
+    0x91, 0xE9, 0x1E, 0x2E, 0x2E, 0x2A, 0xAA, 0x2A, 0xA9, 0x10, 0x7A, 0xD2, 0xE7, 0x1E, 0x2E, 0x70,
+    0x9D, 0xA1, 0x9D, 0xA7, 0x0A, 0xD9, 0x1E, 0x97, 0x0E, 0x2E, 0x70, 0x9E, 0x19, 0xDA, 0x4A, 0xFF,
+    0xFF, 0x1A, 0xFF, 0xFF, 0x1A, 0xFF, 0xFE, 0xA4, 0x9D, 0xA1, 0x9D, 0xA7, 0x0A, 0xD9, 0x1E, 0x97,
+    0x0E, 0x2E, 0x5F, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xF4, 0x9E, 0x19, 0xE7, 0x09,
+    0xDA, 0x1A, 0xDA, 0x70, 0xAD, 0x91, 0xE9, 0x70, 0xE2, 0xE7, 0x1E, 0x19, 0xDA, 0x70, 0xAD, 0xA1,
+    0xAD, 0x96, 0x77, 0x71, 0xD7, 0x5D, 0x71, 0x9A, 0xFC, 0xA9, 0x5F, 0xFE, 0x3F, 0xFE, 0x92, 0xAF,
+    0xAD, 0xAE, 0x3F, 0x90, 0xD2, 0x93, 0xF0, 0x9C, 0xA7, 0xFA, 0xAC, 0x97, 0xAF, 0xD7, 0x1F, 0xEA,
+    0x70, 0xFF, 0x97, 0x9F, 0xE7, 0x0A, 0xFD, 0xA7, 0xD0, 0xFA, 0x7D, 0x0A, 0xEA, 0x09, 0xC9, 0x29,
+    0xCA, 0x0F, 0xA0, 0x9F, 0xAF, 0xF1, 0x9F, 0xFF, 0xA2, 0xFF, 0xE9, 0x49, 0xAA, 0xFA, 0x97, 0x19,
+    0xCA, 0x74, 0xAC, 0x97, 0x4A, 0xA7, 0x00, 0x77, 0x72, 0xAF, 0x79, 0xDA, 0x4F, 0xE6, 0xE4, 0xFF,
+    0x94, 0xE9, 0x39, 0xE9, 0x0E, 0xA3, 0xAD, 0xA4, 0xAE, 0x1E, 0xA2, 0x9E, 0x5E, 0xA1, 0xEA, 0x2E,
+    0x6E, 0x91, 0xEA, 0x1E, 0x95, 0x9E, 0x19, 0xE9, 0x0A, 0xDA, 0x69, 0xE1, 0xAE, 0x09, 0xE0, 0x9A,
+    0xDA, 0x19, 0xE9, 0x9E, 0xA0, 0xE0, 0xAF, 0xD1, 0xFF, 0x0E, 0x99, 0xFE, 0xA0, 0xAF, 0xD9, 0xAD,
+    0xA0, 0xF0, 0xF1, 0x9E, 0xA0, 0x9E, 0x09, 0xE9, 0x0A, 0xE7, 0xE9, 0x0A, 0xE1, 0xAE, 0x6E, 0xA1,
+    0xEA, 0x1F, 0x5A, 0xE2, 0xE9, 0x1E, 0xA4, 0x9E, 0x3E, 0x90, 0x9E, 0x94, 0xE9, 0x3E, 0x90, 0xAE,
+    0x4E, 0xA4, 0xFF, 0x93, 0xAE, 0x5A, 0xFD, 0xA3, 0x9E, 0x7A, 0xFA, 0x77, 0x71, 0x77, 0x74, 0xAF,
+    0xC9, 0x73, 0x9F, 0xF9, 0x71, 0x9F, 0xFD, 0x71, 0xAE, 0xA0, 0x9F, 0x71, 0xF2, 0xF7, 0x1F, 0x2F,
+    0x71, 0xF1, 0xAF, 0x71, 0xF9, 0xAF, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xDA, 0x73, 0xAF, 0xD9, 0x3F,
+    0x3F, 0xFC, 0x2A, 0xEA, 0x2F, 0xC9, 0xFA, 0x1F, 0x2A, 0xF1, 0x9F, 0x9F, 0xA2, 0xFA, 0x2A, 0xFF,
+    0x3F, 0x93, 0xFE, 0x4F, 0xA3, 0x9F, 0xC9, 0x4F, 0xCA, 0x99, 0xAF, 0xD9, 0x49, 0xFF, 0xFE, 0x5F,
+    0xFF, 0xF5, 0xAF, 0xE9, 0x09, 0xFA, 0x79, 0x97, 0x40, 0x1E, 0xA0, 0x9E, 0x90, 0x9E, 0x1A, 0xE1,
+    0xAD, 0xA1, 0xE9, 0x1E, 0x2A, 0xAA, 0x10, 0x6E, 0xA5, 0xF5, 0xF5, 0xAE, 0x94, 0x9E, 0xA5, 0xF5,
+    0x9E, 0x95, 0xF5, 0x9E, 0xA5, 0xAE, 0x6F, 0x59, 0xEA, 0x5A, 0xE9, 0x5A, 0xE6, 0xF6, 0xF6, 0xF6,
+    0xF6, 0xF6, 0xF6, 0xAE, 0x69, 0xE9, 0x6E, 0xA6, 0xF6, 0x9E, 0x7A, 0xAA, 0x50, 0x77, 0x19, 0xE7,
+    0x0E, 0xA7, 0xAE, 0x79, 0xE7, 0x9E, 0x97, 0xEA, 0x7E, 0xA7, 0xF7, 0xF7, 0xF7, 0xF7, 0xEA, 0x7E,
+    0xA6, 0x9E, 0x96, 0xAE, 0x7F, 0x69, 0xEA, 0x6A, 0xE7, 0xF6, 0xAE, 0x96, 0xEA, 0x6F, 0x6A, 0xE9,
+    0x59, 0xEA, 0x6E, 0xA6, 0x9A, 0xAA, 0x60, 0x77, 0x5E, 0x97, 0x2E, 0x97, 0x19, 0xE5, 0xAC, 0xA1,
+    0x9D, 0xA5, 0xFA, 0xAD, 0x94, 0x9F, 0xFA, 0xAE, 0x91, 0x9A, 0xFF, 0xD9, 0x39, 0xFF, 0xC9, 0x29,
+    0xFC, 0xA1, 0x99, 0x2A, 0xEA, 0xE5, 0x9F, 0x0A, 0xDA, 0x5A, 0xD1, 0x9E, 0x69, 0x92, 0xE9, 0x72,
+    0xA9, 0x40, 0x59, 0x99, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9F, 0xFF, 0xCA, 0x9F,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x6E, 0x73, 0xE7, 0x3E, 0x73,
+    0xE7, 0x3A, 0xD5, 0x29, 0x99, 0x93, 0xF9, 0x19, 0xF2, 0xAE, 0x92, 0xF2, 0x9E, 0x3E, 0xA3, 0xE3,
+    0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0xA0, 0xFE, 0x99, 0xFE, 0x00, 0x19, 0x92, 0xF0, 0xAF, 0x9A,
+    0xF0, 0x9E, 0xA2, 0x92, 0x73, 0xF7, 0x39, 0xEA, 0x73, 0xF7, 0x39, 0xEA, 0x73, 0xF7, 0x3A, 0xE9,
+    0x73, 0xF7, 0x3A, 0xE9, 0x73, 0xF7, 0x3F, 0x73, 0x9E, 0xA7, 0x3F, 0x73, 0x9E, 0xA7, 0x3F, 0x73,
+    0xAE, 0x97, 0x3F, 0x73, 0xAE, 0x97, 0x29, 0xF7, 0x3F, 0x73, 0x9E, 0xA7, 0x3F, 0x77, 0x74, 0x77,
+    0x6A, 0xFA, 0x79, 0xFF, 0x94, 0x9F, 0xFD, 0x4F, 0xC9, 0xAF, 0x92, 0xFC, 0x2F, 0xA1, 0x9F, 0x92,
+    0xAF, 0x1F, 0xC3, 0xAF, 0x1F, 0x93, 0xAF, 0x09, 0xF4, 0xAE, 0xA0, 0xAF, 0x4A, 0xEA, 0x0F, 0xA4,
+    0xFA, 0x0F, 0xA4, 0xF9, 0x0F, 0x93, 0x9F, 0x1F, 0x93, 0xAF, 0x1F, 0x93, 0xFA, 0x1F, 0x92, 0x9F,
+    0x2F, 0xA2, 0xFC, 0x2A, 0xF9, 0x9F, 0xC3, 0x9F, 0xFD, 0x94, 0xAF, 0xFA, 0x6A, 0xFD, 0x97, 0x29,
+    0x70, 0x7A, 0xE6, 0xAF, 0xC4, 0x9F, 0xDA, 0x3A, 0xFE, 0xA1, 0x9F, 0xFC, 0x91, 0xFC, 0xAF, 0x2A,
+    0xE9, 0x9F, 0x3C, 0xA1, 0xAE, 0xA7, 0xF9, 0x7F, 0x79, 0xF7, 0x9F, 0x7A, 0xEA, 0x7F, 0x97, 0xF7,
+    0x9F, 0x7A, 0xF7, 0xFA, 0x7F, 0x97, 0xF7, 0x9F, 0x40, 0x77, 0x7A, 0xFC, 0xA7, 0xAF, 0xFC, 0x94,
+    0xFF, 0xF4, 0xFC, 0xAA, 0xFC, 0x94, 0xD9, 0x3F, 0xA4, 0x95, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73,
+    0xFA, 0x72, 0xAF, 0x72, 0xAF, 0x97, 0x1F, 0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xC7, 0x19, 0xFC, 0x71,
+    0x9F, 0xA7, 0x19, 0xF9, 0x71, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xFC, 0xA1, 0x9F, 0xFF,
+    0xC9, 0x1A, 0xFF, 0xFC, 0x20, 0x77, 0x49, 0xAF, 0xCA, 0x94, 0x9F, 0xFD, 0xA3, 0xAF, 0xFE, 0x4E,
+    0xA9, 0x9F, 0xCA, 0x39, 0xA4, 0xFA, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x1A, 0xF7, 0x9A, 0xFC, 0x95,
+    0xFE, 0xA7, 0xFD, 0x97, 0x9F, 0xF7, 0x3A, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0x90, 0x97, 0xAF,
+    0x1D, 0xA9, 0x90, 0x99, 0xFC, 0xA1, 0xFF, 0xFC, 0x2F, 0xFF, 0x39, 0xAF, 0xF9, 0x71, 0x99, 0x70,
+    0x73, 0xFA, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0x71, 0x9F, 0xD7, 0x09, 0xFE, 0x70, 0xFE, 0xA7, 0xFA,
+    0xE9, 0x6F, 0x0F, 0x6A, 0xE9, 0x0F, 0x59, 0xEA, 0x09, 0xF4, 0x9E, 0xA1, 0xAE, 0xA4, 0xF2, 0xF9,
+    0x3F, 0x3F, 0x3A, 0xFA, 0xAA, 0xFC, 0xAA, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1A, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xAA, 0x97, 0x1F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x93, 0x4A, 0xFF, 0xD5, 0xFF, 0xE4,
+    0x9F, 0xFD, 0xA4, 0xAF, 0xFD, 0x94, 0xF7, 0x4F, 0x73, 0x9E, 0xA7, 0x3F, 0x97, 0x3F, 0xFA, 0x69,
+    0xFF, 0xD5, 0x9F, 0xFE, 0x59, 0xA9, 0x99, 0xAF, 0xC9, 0x72, 0x9F, 0x97, 0x3F, 0x97, 0x3F, 0x97,
+    0x29, 0xF9, 0x19, 0x7F, 0xC2, 0xAD, 0xA9, 0x99, 0xAF, 0xCA, 0x2A, 0xFF, 0xF3, 0xAF, 0xFD, 0xA5,
+    0xAF, 0xEA, 0x97, 0x29, 0x97, 0x10, 0x77, 0x69, 0xAF, 0xD9, 0x5F, 0xFC, 0x49, 0xFF, 0xD4, 0xFD,
+    0xA9, 0x99, 0xA3, 0xFC, 0x71, 0xAF, 0x72, 0xF7, 0x29, 0xEA, 0x19, 0xA9, 0x5F, 0x9A, 0xFC, 0x93,
+    0xFF, 0xF9, 0x19, 0xFF, 0xFA, 0x1A, 0xFC, 0x2A, 0xF1, 0xAF, 0x39, 0xF1, 0xAE, 0xA3, 0x9F, 0x1A,
+    0xE9, 0x39, 0xF1, 0xAE, 0xA3, 0xAE, 0xA1, 0xAF, 0x29, 0xF9, 0x19, 0xFA, 0x99, 0xFC, 0x3F, 0xFE,
+    0x5F, 0xFC, 0x96, 0xAF, 0xCA, 0x73, 0x97, 0x00, 0x1A, 0xFF, 0xFC, 0x2F, 0xFF, 0xD2, 0xFF, 0xFD,
+    0x2F, 0xFF, 0xC9, 0x72, 0xFC, 0x72, 0x9F, 0x73, 0xFA, 0x72, 0xAF, 0x73, 0xF9, 0x72, 0xFC, 0x72,
+    0x9F, 0x97, 0x2F, 0xA7, 0x2A, 0xF7, 0x29, 0xF9, 0x72, 0xFC, 0x72, 0xAF, 0x97, 0x2F, 0xA7, 0x2A,
+    0xF7, 0x29, 0xFA, 0x72, 0xFC, 0x72, 0xAF, 0x97, 0x20, 0x77, 0x69, 0xFD, 0x97, 0xAF, 0xFC, 0x5A,
+    0xFF, 0xDA, 0x4F, 0x91, 0xFC, 0x39, 0xEA, 0x3F, 0x3A, 0xEA, 0x3F, 0x3A, 0xEA, 0x29, 0xEA, 0x4F,
+    0x90, 0x9F, 0x5A, 0xFF, 0xC9, 0x6A, 0xFD, 0xA7, 0xAF, 0xE9, 0x6F, 0xFD, 0x94, 0xFC, 0x1F, 0xC3,
+    0xAE, 0xA3, 0xF9, 0x2F, 0x4A, 0xEA, 0x2F, 0x49, 0xEA, 0x2F, 0x4A, 0xEA, 0x2F, 0xC2, 0xAF, 0x3A,
+    0xFF, 0xEA, 0x4F, 0xFE, 0x69, 0xFE, 0x97, 0x29, 0x97, 0x00, 0x77, 0x3A, 0xFC, 0xA5, 0x9F, 0xFC,
+    0x39, 0xFF, 0xDA, 0x2F, 0xC9, 0x9F, 0xC1, 0xAF, 0x3F, 0x90, 0xFA, 0x3F, 0x90, 0xF4, 0xFA, 0x0F,
+    0x4F, 0xA0, 0xF3, 0x9F, 0x90, 0xFA, 0x2F, 0xC9, 0x0F, 0xFF, 0xC1, 0x9F, 0xFF, 0x2A, 0xFD, 0x9E,
+    0xA3, 0x9A, 0xAA, 0x90, 0xAE, 0x97, 0x1F, 0x71, 0xFA, 0x70, 0xAF, 0x2A, 0x99, 0x09, 0xAF, 0xC9,
+    0x2F, 0xFD, 0xA3, 0xFF, 0xCA, 0x4A, 0xFD, 0xA7, 0x19, 0x97, 0x10, 0x72, 0x9E, 0xA2, 0xFC, 0x2F,
+    0xC2, 0xF9, 0x3A, 0xA9, 0x77, 0x77, 0x77, 0x29, 0x94, 0xF2, 0xAF, 0x91, 0xAF, 0x29, 0xEA, 0x49,
+    0x40, 0x76, 0x9E, 0xA4, 0xFC, 0x4F, 0xC4, 0xF9, 0x5A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99,
+    0x99, 0x5F, 0x49, 0xEA, 0x4F, 0x5E, 0xA4, 0xAE, 0x5E, 0x94, 0x9D, 0xA5, 0x77, 0x73, 0xAA, 0x72,
+    0xAD, 0xA7, 0x0A, 0xFA, 0x6A, 0xFC, 0xA5, 0xAF, 0xCA, 0x5A, 0xFC, 0xA5, 0xAF, 0xCA, 0x69, 0xFA,
+    0x70, 0x9F, 0xCA, 0x97, 0x9A, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x0A, 0xFE, 0x97, 0x9F, 0xCA, 0x71,
+    0x9A, 0xDA, 0x74, 0xAA, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xFC, 0xA9,
+    0xFF, 0xFC, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77, 0x75, 0x9F, 0xFF, 0xCA, 0x9F,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x76, 0x76, 0x9C, 0x97, 0x39, 0xE9, 0x71, 0x9F, 0xC9, 0x70, 0xAF,
+    0xD9, 0x70, 0xAF, 0xD9, 0x70, 0x9F, 0xD9, 0x70, 0x9F, 0xD7, 0x19, 0xFA, 0x7A, 0xFC, 0xA4, 0x9A,
+    0xFD, 0x93, 0xAF, 0xDA, 0x93, 0xAF, 0xDA, 0x59, 0xFC, 0x97, 0x9E, 0x97, 0x19, 0xA7, 0x77, 0x30,
+    0x77, 0xAF, 0xCA, 0x3F, 0xFD, 0x91, 0xFF, 0xE1, 0xAD, 0xA9, 0x9A, 0xF1, 0x9A, 0x4F, 0x97, 0xF9,
+    0x69, 0xF6, 0xAF, 0xA5, 0xFC, 0xA5, 0xFC, 0xA5, 0xFC, 0x95, 0xAF, 0x7F, 0x70, 0xEA, 0x77, 0x77,
+    0x29, 0x97, 0x1F, 0x7A, 0xF9, 0x6A, 0xF7, 0x9E, 0xA7, 0x19, 0x71, 0x71, 0x9A, 0xFA, 0x97, 0x49,
+    0xFF, 0xEA, 0x71, 0xFF, 0xFE, 0x69, 0xFA, 0x95, 0xAF, 0x49, 0xF7, 0x19, 0xEA, 0x3E, 0xA7, 0x39,
+    0xE2, 0xF3, 0xAF, 0xDA, 0x1E, 0x90, 0x9E, 0x29, 0xFF, 0xC1, 0xAD, 0xA0, 0xEA, 0x19, 0xF9, 0x9E,
+    0xA1, 0xAD, 0xA0, 0xE2, 0xEA, 0x2E, 0x91, 0x9D, 0xA9, 0xE1, 0x9E, 0x3E, 0x2A, 0xDA, 0xAD, 0xA1,
+    0xEA, 0x29, 0xE2, 0xE9, 0xAD, 0xA1, 0xE9, 0x2A, 0xDA, 0x2E, 0x0A, 0xDA, 0x1E, 0x3E, 0x91, 0xAE,
+    0x0A, 0xDA, 0x1E, 0x91, 0xAE, 0x19, 0xE9, 0x0A, 0xDA, 0x1F, 0xAF, 0xCA, 0xAE, 0xA1, 0x9E, 0x19,
+    0xFD, 0x9F, 0xDA, 0x3E, 0x91, 0x9E, 0xA1, 0x9F, 0x94, 0xAE, 0x77, 0x4F, 0x77, 0x39, 0xFA, 0x93,
+    0x99, 0xD7, 0x19, 0xFF, 0xFC, 0x73, 0xAF, 0xFD, 0xA7, 0x59, 0xAA, 0xAA, 0xA9, 0x71, 0x72, 0xFC,
+    0x97, 0x3A, 0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71, 0xAE, 0x9A, 0xE7, 0x1F,
+    0x0A, 0xE7, 0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19, 0xE9, 0x59, 0xF2, 0x9E,
+    0xA5, 0xF9, 0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF, 0xD3, 0xFF,
+    0xFE, 0x29, 0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9, 0x9F, 0x70, 0xAE, 0xA0,
+    0x4F, 0xFA, 0x97, 0xFF, 0xE9, 0x49, 0xFF, 0xF4, 0xAF, 0xFF, 0xA3, 0xFA, 0x3F, 0xC3, 0xF9, 0x3A,
+    0xF3, 0xF4, 0xFA, 0x29, 0xF3, 0x9F, 0x3A, 0xFA, 0xAA, 0xFC, 0x93, 0xFF, 0xF9, 0x4F, 0xFE, 0x6F,
+    0xFF, 0x93, 0x9F, 0x3A, 0xF3, 0xAE, 0xA4, 0xF9, 0x2F, 0x94, 0xF9, 0x2F, 0x93, 0x9F, 0x91, 0x9F,
+    0x4F, 0xC2, 0x9F, 0xAA, 0xAF, 0xDA, 0x2A, 0xFF, 0xFC, 0x3F, 0xFF, 0xA4, 0xFF, 0xDA, 0x50, 0x77,
+    0x72, 0xAF, 0xDA, 0x97, 0xAF, 0xFE, 0x5F, 0xFF, 0xA4, 0xFE, 0xAA, 0xF4, 0xFD, 0x5A, 0xA3, 0x9F,
+    0xA7, 0x4F, 0xC7, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x74, 0x9F, 0x97,
+    0x49, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFC, 0x95, 0x95, 0x9F, 0xCA, 0x99, 0xAA, 0xD6, 0xFF,
+    0xF7, 0xFF, 0xE7, 0x09, 0xFE, 0xA9, 0x73, 0x99, 0x97, 0x00, 0x4F, 0xEA, 0x97, 0x1F, 0xFD, 0xA6,
+    0x9F, 0xFF, 0x5A, 0xFF, 0xFA, 0x4F, 0xA2, 0x9F, 0xC4, 0xF9, 0x39, 0xFA, 0x3F, 0x5F, 0xA2, 0x9F,
+    0x5A, 0xF2, 0xAF, 0x5A, 0xF2, 0xFA, 0x5A, 0xF2, 0xF9, 0x5F, 0xA2, 0xF6, 0xFA, 0x19, 0xF5, 0x9F,
+    0x91, 0xAF, 0x5A, 0xF2, 0xFA, 0x49, 0xFA, 0x2F, 0x94, 0xFC, 0x29, 0xF3, 0x9F, 0xCA, 0x29, 0xFA,
+    0xAF, 0xEA, 0x3A, 0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xCA, 0x70, 0x4F, 0xFE, 0xA4, 0xFF, 0xEA,
+    0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xFA, 0xAA,
+    0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x3F,
+    0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4, 0xFF, 0xEA, 0x4F, 0xFE, 0xA3,
+    0x4F, 0xFE, 0xA4, 0xFF, 0xE9, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xF7, 0x3F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0xFD, 0xA4, 0xAE, 0xA7,
+    0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x73, 0xF9, 0x72, 0x77,
+    0x72, 0x9F, 0xEA, 0x96, 0xAF, 0xFE, 0xA4, 0xFF, 0xFC, 0x4F, 0xEA, 0xAA, 0xEA, 0x3A, 0xFC, 0x95,
+    0xA9, 0x29, 0xFC, 0x74, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF7, 0x5F, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x1F, 0xA2, 0x9F, 0xEA, 0x1F, 0x92, 0xAF, 0xE9, 0x09, 0xF9, 0x2A, 0xFE, 0x19, 0xF9, 0x59, 0xF2,
+    0xF9, 0x5A, 0xEA, 0x2F, 0xA5, 0xF9, 0x2F, 0xC9, 0x4F, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x4A, 0xFF,
+    0xFC, 0x5A, 0xFF, 0xEA, 0x69, 0xFF, 0xA9, 0x73, 0x99, 0x70, 0x4F, 0x95, 0xAE, 0x94, 0xF9, 0x5F,
+    0x93, 0x9F, 0x59, 0xF4, 0xAF, 0x5A, 0xF4, 0xFA, 0x5A, 0xEA, 0x4F, 0x95, 0xF9, 0x4F, 0x95, 0xF4,
+    0x9F, 0x59, 0xF4, 0xAF, 0xAA, 0xAA, 0xAA, 0xFC, 0x4F, 0xFF, 0xEA, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF,
+    0xE4, 0x9F, 0x59, 0xF4, 0xAF, 0x5A, 0xEA, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xF9, 0x39, 0xF5, 0x9F,
+    0x49, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0x95, 0xF9, 0x4F, 0x95, 0xF9, 0x30, 0x39, 0xFF,
+    0xA3, 0xAF, 0xFA, 0x3F, 0xFC, 0x59, 0xFC, 0x97, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F,
+    0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0x9F,
+    0x79, 0xFC, 0x6F, 0xFA, 0x3A, 0xFF, 0xA3, 0xAF, 0xF9, 0x30, 0x71, 0x9E, 0xA7, 0x1F, 0xA7, 0x1F,
+    0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0x9F, 0x71, 0xAE,
+    0xA7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F,
+    0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x70, 0xFC, 0x49, 0xAA, 0xAF, 0xCA, 0x4A, 0xFF, 0x5A, 0xFE,
+    0x6A, 0xFC, 0xA7, 0x76, 0x4F, 0x94, 0xAF, 0x5F, 0x4A, 0xF9, 0x49, 0xF3, 0x9F, 0xA5, 0xAF, 0x29,
+    0xFA, 0x6F, 0xA2, 0xFC, 0x7F, 0x91, 0xFC, 0x70, 0xF1, 0xFC, 0x70, 0x9F, 0x0A, 0xF9, 0x70, 0xAE,
+    0xA9, 0xFA, 0x71, 0xFA, 0xFA, 0x72, 0xFF, 0xC9, 0x72, 0xFF, 0xCA, 0x71, 0x9F, 0xFD, 0x71, 0xAF,
+    0x1F, 0x97, 0x0F, 0x91, 0xFC, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x3F, 0xA6, 0x9F, 0x3F, 0xC6, 0xAE,
+    0xA3, 0x9F, 0x95, 0xF9, 0x4F, 0xA5, 0xF5, 0xAF, 0x40, 0x4F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF,
+    0x70, 0xFA, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x70, 0xF7,
+    0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF9, 0x79, 0xF7, 0x09, 0xFA, 0xAA, 0xAA, 0xAA, 0x1A,
+    0xFF, 0xE1, 0xFF, 0xEA, 0x1F, 0xFE, 0x90, 0x4F, 0xD7, 0x9F, 0xCA, 0x4F, 0xD7, 0xFD, 0xA3, 0x9F,
+    0xD6, 0x9F, 0xD9, 0x3A, 0xFD, 0x6F, 0xE4, 0xFE, 0x59, 0xFE, 0x4F, 0xE5, 0xEA, 0xEA, 0x4E, 0xAE,
+    0x93, 0x9E, 0xAE, 0x93, 0x9E, 0x9E, 0x93, 0xEA, 0xAE, 0x93, 0xAE, 0x9E, 0x92, 0x9E, 0x0F, 0x4F,
+    0x0E, 0x92, 0xEA, 0x0F, 0x4F, 0x0E, 0xA1, 0x9E, 0x09, 0xEA, 0x4E, 0xA0, 0xAD, 0xA1, 0xEA, 0x0A,
+    0xE9, 0x39, 0xE9, 0x0A, 0xDA, 0x09, 0xE1, 0xF4, 0xAE, 0x1A, 0xDA, 0x0E, 0xA1, 0xF4, 0xF1, 0xAE,
+    0x9E, 0x2F, 0x4F, 0x19, 0xFD, 0xA1, 0x9E, 0xA3, 0x9E, 0xA1, 0x9F, 0xD2, 0xAE, 0x93, 0x9E, 0x91,
+    0x9F, 0xCA, 0x2F, 0x4A, 0xE2, 0x9F, 0xC3, 0xF4, 0xF2, 0x9F, 0xA2, 0x9E, 0xA4, 0xF3, 0xF3, 0x9E,
+    0xA3, 0x4F, 0xC9, 0x6A, 0xE5, 0xFC, 0xA6, 0xF4, 0x9F, 0xD6, 0xF4, 0xAF, 0xD9, 0x49, 0xEA, 0x4F,
+    0xEA, 0x4A, 0xE9, 0x4F, 0xF4, 0xF5, 0xEA, 0xF9, 0x3F, 0x49, 0xE9, 0xAE, 0xA2, 0x9E, 0xA4, 0xAE,
+    0x90, 0xF2, 0xAE, 0xA4, 0xF1, 0xF2, 0xAE, 0x94, 0xF1, 0xAE, 0xA1, 0xF4, 0x9E, 0xA2, 0xF1, 0xF4,
+    0x9E, 0xA2, 0xF0, 0x9E, 0xA4, 0xAE, 0x92, 0xAE, 0xA9, 0xE9, 0x4F, 0x39, 0xFA, 0xE5, 0xF4, 0xFF,
+    0x49, 0xEA, 0x4A, 0xFE, 0x4A, 0xE9, 0x49, 0xFD, 0xA4, 0xAE, 0x6F, 0xD9, 0x4F, 0x6A, 0xFC, 0x5F,
+    0x69, 0xFC, 0x40, 0x77, 0x72, 0x9A, 0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF,
+    0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90,
+    0xAF, 0x70, 0xF9, 0x0F, 0xA7, 0x0F, 0x90, 0xF9, 0x79, 0xF1, 0xF9, 0x7A, 0xF0, 0x9F, 0x97, 0xFC,
+    0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x59, 0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC,
+    0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC, 0xA6, 0xFF, 0xE9, 0x70, 0x9F, 0xEA, 0x76, 0x99, 0x71, 0x4F,
+    0xEA, 0xA9, 0x7F, 0xFE, 0x59, 0xFF, 0xF4, 0xAF, 0xFF, 0x93, 0xFA, 0x3F, 0xA3, 0xF9, 0x3A, 0xF3,
+    0xF4, 0x9F, 0x29, 0xF4, 0xAF, 0x2A, 0xF4, 0xFA, 0x2F, 0xA2, 0x9F, 0xC3, 0xFF, 0xFC, 0xA3, 0xFF,
+    0xFA, 0x39, 0xFF, 0xE9, 0x4A, 0xFA, 0xAA, 0x99, 0x7F, 0x97, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xF7,
+    0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x40, 0x77, 0x72, 0x9A, 0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF,
+    0xC5, 0xFD, 0xAA, 0xAF, 0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC, 0x7F, 0x90,
+    0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA, 0x70, 0xF9, 0x0F, 0xA7, 0x9F, 0x1F, 0x97, 0xAF,
+    0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93,
+    0x9F, 0xC3, 0x9F, 0xCA, 0x9A, 0xFD, 0x94, 0xFF, 0xFC, 0x96, 0xFF, 0xE9, 0x70, 0x9F, 0xF7, 0x59,
+    0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x76, 0x9F, 0xA7, 0x6F, 0xC3, 0x4F, 0xEA, 0x97, 0x0F, 0xFD,
+    0x95, 0x9F, 0xFE, 0x94, 0xAF, 0xAA, 0xFD, 0x4F, 0xA2, 0xAF, 0x4F, 0x93, 0xF9, 0x3F, 0x4F, 0x92,
+    0x9F, 0x39, 0xF3, 0xAF, 0x3F, 0xC3, 0xFC, 0x99, 0xAF, 0xC9, 0x3F, 0xFF, 0x94, 0xFF, 0xE9, 0x49,
+    0xFF, 0xD6, 0xAF, 0x1F, 0x95, 0xFA, 0x1A, 0xF5, 0xF9, 0x19, 0xF4, 0x9F, 0x3F, 0xA3, 0x9F, 0x3A,
+    0xF3, 0xAE, 0xA4, 0xF9, 0x2F, 0x94, 0xFC, 0x2F, 0x94, 0xAF, 0x90, 0x77, 0x59, 0xAF, 0xCA, 0x95,
+    0xFF, 0xDA, 0x3F, 0xFE, 0x39, 0xFC, 0xAA, 0xAE, 0x3F, 0xC4, 0x94, 0xFA, 0x72, 0xFA, 0x72, 0xFC,
+    0x72, 0xAF, 0xC9, 0x71, 0xFD, 0xA7, 0x1F, 0xDA, 0x71, 0xFD, 0xA7, 0x1A, 0xFC, 0x72, 0xAF, 0x97,
+    0x2F, 0x97, 0x2F, 0x91, 0x99, 0x59, 0xF9, 0x19, 0xDA, 0x99, 0x9A, 0xFC, 0x29, 0xFF, 0xE9, 0x29,
+    0xFF, 0xD9, 0x49, 0xFE, 0xA7, 0x29, 0x97, 0x00, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x9F, 0xFF,
+    0xD0, 0x9F, 0xFF, 0xD5, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F,
+    0x97, 0x19, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2A,
+    0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x70, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0x9F, 0x3A,
+    0xEA, 0x5A, 0xEA, 0x3F, 0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F,
+    0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA,
+    0x3F, 0x95, 0xF9, 0x3F, 0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF, 0xCA, 0x9A, 0xFC, 0x6F, 0xFF,
+    0x96, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x9E, 0xA7, 0xAE, 0xA9, 0xF6, 0x9F,
+    0x1F, 0x6F, 0xA1, 0xF5, 0x9F, 0x2F, 0x5F, 0xA2, 0xF4, 0x9F, 0x3F, 0x4A, 0xEA, 0x3A, 0xE9, 0x3F,
+    0x4A, 0xE9, 0x2A, 0xEA, 0x4A, 0xE9, 0x2F, 0x59, 0xE9, 0x1A, 0xEA, 0x59, 0xE9, 0x1F, 0x69, 0xEA,
+    0x0A, 0xEA, 0x7E, 0xA0, 0xF7, 0x0E, 0xAA, 0xEA, 0x70, 0xEA, 0xF7, 0x1F, 0xE9, 0x71, 0xFE, 0x72,
+    0xFD, 0x97, 0x2A, 0xFC, 0x73, 0xAF, 0x97, 0x10, 0x9E, 0xA5, 0x9E, 0xA5, 0xAE, 0xA9, 0xEA, 0x5F,
+    0xA5, 0xF0, 0x9E, 0xA4, 0x9F, 0xA4, 0xAF, 0x09, 0xEA, 0x4F, 0xCA, 0x4F, 0x91, 0xEA, 0x4F, 0xCA,
+    0x39, 0xF2, 0xF3, 0xAF, 0xCA, 0x3F, 0x92, 0xF3, 0xFD, 0xA3, 0xF3, 0xF2, 0xAE, 0xAE, 0x2A, 0xEA,
+    0x3F, 0x2E, 0xAA, 0xE2, 0xF4, 0xF1, 0x9E, 0x0A, 0xE1, 0x9E, 0xA4, 0xF1, 0xF0, 0xAE, 0x1F, 0x94,
+    0xF0, 0x9E, 0x90, 0xAE, 0x09, 0xF5, 0xF0, 0xF1, 0xAE, 0x0A, 0xE9, 0x5F, 0x0E, 0x91, 0xAE, 0x0F,
+    0x6E, 0xAA, 0xE2, 0x9E, 0x9E, 0x96, 0xEA, 0xEA, 0x29, 0xFE, 0x7F, 0xE3, 0x9F, 0xDA, 0x7F, 0xDA,
+    0x39, 0xFD, 0x70, 0xFD, 0x49, 0xFC, 0xA7, 0x0F, 0xD4, 0x9F, 0xC9, 0x70, 0xFC, 0x94, 0x9F, 0xC7,
+    0x00, 0x4A, 0xF6, 0xFA, 0x59, 0xF5, 0xFC, 0x7F, 0x93, 0xAF, 0x97, 0xAF, 0x29, 0xFA, 0x70, 0x9F,
+    0x2F, 0xC7, 0x2F, 0x90, 0xAF, 0x73, 0xAE, 0xA9, 0xF9, 0x73, 0x9F, 0xF9, 0x75, 0xFE, 0xA7, 0x6A,
+    0xFD, 0x77, 0xFD, 0x97, 0x6A, 0xFD, 0xA7, 0x59, 0xFF, 0x75, 0xFA, 0xF9, 0x73, 0xFC, 0x0A, 0xF7,
+    0x2A, 0xF1, 0x9F, 0x71, 0x9F, 0xA2, 0xFA, 0x70, 0xFC, 0x3F, 0xC7, 0xFC, 0x49, 0xF6, 0xAF, 0x95,
+    0xFA, 0x49, 0xFA, 0x6F, 0xC4, 0x0F, 0x6F, 0xA1, 0xF9, 0x4A, 0xF2, 0xAE, 0xA4, 0xFA, 0x29, 0xF3,
+    0xFC, 0x4F, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0x90, 0xAF, 0x69, 0xEA, 0x9F, 0x70, 0xFF, 0x97,
+    0x0F, 0xEA, 0x71, 0xAF, 0xD7, 0x29, 0xFC, 0x97, 0x3F, 0xA7, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0x74,
+    0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x20, 0x39, 0xFF, 0xFC, 0x4A, 0xFF,
+    0xFC, 0x4A, 0xFF, 0xFA, 0x4A, 0xFF, 0xF7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC,
+    0x74, 0xFC, 0x97, 0x3A, 0xF9, 0x73, 0x9F, 0xA7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4A, 0xF9, 0x73, 0xAF,
+    0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0xFF, 0xFC, 0xA3, 0xAF,
+    0xFF, 0xC9, 0x3F, 0xFF, 0xD4, 0x5F, 0xD9, 0x49, 0xFD, 0x94, 0xAF, 0xD5, 0xF7, 0x0E, 0xA7, 0x0E,
+    0x97, 0x9E, 0x70, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xAE, 0x70, 0xEA, 0x70,
+    0xEA, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0F, 0x99,
+    0x95, 0xFD, 0xA4, 0x9F, 0xD9, 0x49, 0xAA, 0xAA, 0xAA, 0x50, 0xF3, 0xAE, 0x39, 0xE3, 0x9E, 0x93,
+    0xE9, 0x3E, 0xA3, 0xF3, 0xAE, 0x3A, 0xE3, 0x9E, 0x4E, 0x93, 0xEA, 0x3E, 0xA3, 0xF3, 0xAE, 0x39,
+    0xE3, 0x9E, 0x93, 0xEA, 0x3E, 0xA3, 0xF3, 0xAE, 0x70, 0x4A, 0xFD, 0x5F, 0xE5, 0xFD, 0xA7, 0x9E,
+    0x97, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xF7, 0x0E,
+    0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E,
+    0xA5, 0x99, 0xAE, 0x94, 0xAF, 0xD5, 0xAF, 0xD5, 0xAA, 0xAA, 0xAA, 0x95, 0x70, 0xDA, 0x73, 0xAE,
+    0x72, 0x9F, 0x72, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0E, 0x0E, 0x7E, 0x90, 0xE9, 0x5A, 0xE1, 0xAD,
+    0xA5, 0xE3, 0xE4, 0xEA, 0x3E, 0x39, 0xE4, 0xAD, 0x92, 0xE9, 0x49, 0xDA, 0x1E, 0xA6, 0xE1, 0xAA,
+    0xA7, 0xAA, 0xA0, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x99, 0x99, 0x91, 0x9F, 0x2F, 0x92, 0xEA, 0x3E, 0x49, 0x90, 0x77, 0x4F, 0xC1,
+    0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19, 0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F, 0xC1,
+    0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F, 0x1A,
+    0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A,
+    0xF9, 0x0E, 0xA6, 0x97, 0x20, 0x77, 0x5F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0xA7,
+    0x3F, 0x97, 0x3F, 0x0A, 0xF5, 0x9E, 0xAF, 0xE4, 0xAF, 0xFE, 0xA3, 0xFC, 0xA9, 0x9F, 0xC3, 0xFA,
+    0x29, 0xF2, 0x9F, 0x39, 0xF2, 0x9E, 0xA3, 0x9F, 0x2A, 0xE9, 0x39, 0xF2, 0xF4, 0xAF, 0x2F, 0x4F,
+    0xA1, 0x9F, 0x39, 0xF2, 0xAF, 0x3F, 0xC2, 0xAF, 0xC9, 0x9F, 0xC9, 0x2F, 0xFF, 0xA3, 0xE9, 0xFE,
+    0xA3, 0x9E, 0x1F, 0xC9, 0x74, 0x97, 0x77, 0x2A, 0xFD, 0xA3, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xFC,
+    0xA9, 0x9A, 0xC9, 0x1A, 0xF9, 0x7F, 0xA7, 0x9F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xAE, 0xA7, 0x0A,
+    0xEA, 0x70, 0xAF, 0x70, 0x9F, 0xC9, 0x99, 0xAC, 0x3F, 0xFD, 0x39, 0xFF, 0xC5, 0xFE, 0x97, 0x99,
+    0x60, 0x77, 0x75, 0x9F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x6F, 0xC0,
+    0x9E, 0xA4, 0x9F, 0xEA, 0xEA, 0x39, 0xFF, 0xF9, 0x3F, 0xCA, 0x9A, 0xFC, 0x39, 0xF9, 0x2F, 0xC3,
+    0xFC, 0x3A, 0xEA, 0x3F, 0x93, 0xAE, 0x92, 0x9F, 0x4F, 0x92, 0xAF, 0x4F, 0x3A, 0xEA, 0x39, 0xF3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAF, 0x29, 0xF9, 0x3A, 0xFA, 0x09, 0xFC, 0x5F, 0xFF, 0x5A, 0xFE, 0xAE,
+    0x6A, 0xFA, 0x0E, 0xA7, 0x09, 0x74, 0x77, 0x39, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9,
+    0x1F, 0x90, 0x9F, 0x3A, 0xE9, 0x0F, 0xA3, 0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF,
+    0xFD, 0xA2, 0xAF, 0xAA, 0xA9, 0x5A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F,
+    0xFD, 0x5A, 0xFD, 0xA9, 0x70, 0x99, 0x60, 0x75, 0x99, 0x75, 0xAF, 0xD7, 0x2A, 0xFD, 0xA7, 0x19,
+    0xFE, 0x97, 0x1A, 0xF1, 0x97, 0x2F, 0x97, 0x49, 0xF7, 0x49, 0xFF, 0x70, 0xFF, 0xD7, 0x9F, 0xFC,
+    0xA7, 0x09, 0x9F, 0x99, 0x97, 0x29, 0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9F,
+    0x75, 0xAE, 0xA7, 0x5F, 0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x59, 0xF7, 0x5A, 0xEA, 0x75, 0xF9, 0x75,
+    0xF7, 0x5A, 0xF7, 0x2A, 0xAA, 0xFA, 0x72, 0xFE, 0x73, 0xFD, 0x97, 0x3F, 0xA7, 0x40, 0x77, 0x59,
+    0xFC, 0x1A, 0xDA, 0x39, 0xFE, 0x0E, 0xA2, 0x9F, 0xFF, 0x92, 0xFC, 0xA9, 0xAF, 0xC2, 0x9F, 0x92,
+    0xFC, 0x2F, 0xC3, 0xAE, 0xA2, 0xF9, 0x3A, 0xEA, 0x19, 0xF4, 0xF9, 0x1A, 0xF4, 0xF2, 0xAF, 0x39,
+    0xF2, 0xAF, 0x3F, 0xA2, 0xAF, 0x2A, 0xF9, 0x2A, 0xFA, 0x9A, 0xFC, 0x39, 0xFF, 0xF4, 0xFE, 0xAF,
+    0x5A, 0xF0, 0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0xFC, 0x39, 0xDA, 0x99, 0xAF, 0xC9, 0x39, 0xFF,
+    0xDA, 0x49, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x70, 0x77, 0x5F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE,
+    0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x3F, 0x0A, 0xF9, 0x49, 0xEA, 0xFE, 0x93, 0xAF, 0xFF, 0x3F, 0xD9,
+    0x9F, 0xC3, 0xFC, 0x29, 0xF2, 0x9F, 0xA3, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2, 0xF9,
+    0x3F, 0x92, 0xF4, 0xF9, 0x19, 0xF4, 0xF2, 0xAF, 0x39, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F,
+    0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0x76, 0xAE, 0x49, 0xF9, 0x39, 0xF5, 0xEA, 0x77, 0x70, 0xF4,
+    0x9F, 0x4A, 0xF4, 0xFA, 0x4F, 0x93, 0x9F, 0x49, 0xF4, 0xAE, 0xA4, 0xF9, 0x4F, 0x93, 0x9F, 0x4A,
+    0xF4, 0xAE, 0xA4, 0xF9, 0x4F, 0x49, 0xF4, 0x77, 0x6A, 0xE7, 0x1F, 0x97, 0x9F, 0x97, 0x0E, 0xA7,
+    0x77, 0x74, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE,
+    0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x0F, 0x97, 0x9F,
+    0x70, 0xAF, 0x70, 0xFA, 0x79, 0xF9, 0x4A, 0xAA, 0xFC, 0x5A, 0xFD, 0xA5, 0xAF, 0xCA, 0x6A, 0xF9,
+    0x70, 0x77, 0x6F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x4F, 0x97, 0x4F, 0x39,
+    0xFA, 0x29, 0xF2, 0x9F, 0xA3, 0xAE, 0xA1, 0x9F, 0xA4, 0xF9, 0x1F, 0xA5, 0xF1, 0xFA, 0x59, 0xF0,
+    0xFA, 0x69, 0xFF, 0xA7, 0xAF, 0xF7, 0x0F, 0xFC, 0x97, 0xFF, 0xD6, 0x9F, 0xA9, 0xF9, 0x5A, 0xF1,
+    0xFC, 0x5A, 0xEA, 0x19, 0xF9, 0x4F, 0x92, 0xFC, 0x4F, 0x39, 0xF9, 0x29, 0xF4, 0xFA, 0x20, 0x76,
+    0xF9, 0x4F, 0x49, 0xF4, 0xAF, 0x4F, 0xA4, 0xF9, 0x4F, 0x49, 0xF4, 0xAE, 0xA4, 0xFA, 0x4F, 0x93,
+    0x9F, 0x49, 0xF4, 0xAE, 0xA4, 0xF9, 0x4F, 0x93, 0x9F, 0x4A, 0xF4, 0xFA, 0x4F, 0x94, 0xF4, 0x9F,
+    0x40, 0x77, 0x74, 0xE1, 0xAF, 0x92, 0xAF, 0x93, 0x9E, 0x0A, 0xFD, 0x1F, 0xE3, 0xAE, 0xAF, 0xEA,
+    0xAF, 0xEA, 0x2F, 0xD9, 0x9F, 0xE9, 0x9F, 0xC2, 0xFC, 0x29, 0xFC, 0x29, 0xF2, 0xFA, 0x29, 0xF9,
+    0x29, 0xF1, 0x9F, 0x3A, 0xF3, 0xAE, 0xA1, 0xAE, 0xA3, 0xAE, 0xA3, 0xF9, 0x1F, 0x93, 0xF9, 0x3F,
+    0x91, 0xF4, 0xF4, 0xF1, 0x9F, 0x39, 0xF3, 0x9F, 0x1A, 0xF3, 0xAE, 0xA3, 0xAE, 0xA1, 0xAE, 0xA3,
+    0xF9, 0x3F, 0x91, 0xF9, 0x3F, 0x93, 0xF2, 0xF4, 0xF3, 0x9F, 0x19, 0xF3, 0x9F, 0x39, 0xF1, 0x77,
+    0x4E, 0x1A, 0xF9, 0x49, 0xE0, 0xAF, 0xD9, 0x3A, 0xEA, 0xFF, 0x3F, 0xD9, 0x9F, 0xC3, 0xFC, 0x29,
+    0xF3, 0xFA, 0x3F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x91,
+    0x9F, 0x4F, 0x2A, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3,
+    0x9F, 0x20, 0x77, 0x3A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99, 0xAF, 0x90, 0xAF,
+    0x92, 0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F, 0xAA, 0xEA, 0x4F,
+    0x9A, 0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA, 0x3F, 0xFC, 0xA5,
+    0xAF, 0xCA, 0x97, 0x19, 0x70, 0x77, 0x6E, 0x1A, 0xF6, 0x9E, 0x0F, 0xE5, 0xAF, 0xFE, 0xA4, 0xFC,
+    0xA9, 0x9F, 0xC4, 0xFA, 0x29, 0xF3, 0x9F, 0x39, 0xF3, 0x9E, 0xA3, 0x9F, 0x3A, 0xE9, 0x39, 0xF3,
+    0xF4, 0xAF, 0x3F, 0x4F, 0xA2, 0x9F, 0x39, 0xF3, 0xAF, 0x3F, 0xC3, 0xAF, 0xC9, 0x9F, 0xC9, 0x3F,
+    0xFF, 0xA4, 0xFA, 0xFD, 0xA4, 0x9F, 0x0A, 0xF9, 0x5A, 0xEA, 0x29, 0x70, 0xF9, 0x74, 0xF9, 0x74,
+    0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0x77, 0x4F, 0xC1, 0xAD, 0xA2, 0x9F, 0xE9, 0xEA,
+    0x2F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0x92, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A,
+    0xE9, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAE, 0xA3, 0x9F, 0x1A, 0xEA, 0x3A, 0xEA, 0x1A, 0xF2,
+    0x9F, 0x91, 0xAF, 0xA0, 0x9F, 0xC3, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x0A, 0xEA, 0x69, 0x2F,
+    0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x97, 0x2F, 0x40, 0x77, 0x1E, 0x90,
+    0xAE, 0x92, 0x9E, 0x9A, 0xF3, 0xAE, 0xAF, 0xC3, 0xFF, 0xCA, 0x3F, 0xCA, 0x69, 0xFC, 0x79, 0xF7,
+    0x0A, 0xF7, 0x0F, 0x97, 0x0F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x0F, 0x70,
+    0x9F, 0x70, 0x77, 0x1A, 0xFD, 0xA9, 0x3F, 0xFD, 0x2A, 0xFF, 0xCA, 0x2F, 0xA2, 0x9C, 0x3F, 0x97,
+    0x0F, 0xC9, 0x7A, 0xFC, 0xA7, 0xFE, 0x96, 0xAF, 0xD7, 0x9F, 0xCA, 0x70, 0xFC, 0x70, 0xAF, 0x1A,
+    0xA9, 0x29, 0xFA, 0x1A, 0xFF, 0xD2, 0xAF, 0xFC, 0x92, 0x9F, 0xF9, 0x79, 0x97, 0x59, 0x97, 0x0E,
+    0x7A, 0xE7, 0xEA, 0x5A, 0xFF, 0x99, 0xFF, 0xD0, 0x9F, 0xFD, 0x19, 0xAF, 0x99, 0x99, 0x2F, 0xA6,
+    0xF9, 0x6F, 0x69, 0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x96, 0xF6, 0x9F, 0x90, 0x99, 0x3F, 0xEA, 0x3F,
+    0xEA, 0x4F, 0xD9, 0x69, 0x95, 0x19, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9,
+    0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92,
+    0xF3, 0x9F, 0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9,
+    0x3F, 0xE9, 0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x9E, 0xA5, 0xF9, 0x9F, 0x4A, 0xF0, 0x9F,
+    0x4F, 0x91, 0xF3, 0xAF, 0x2F, 0x3F, 0x3F, 0x2A, 0xEA, 0x3F, 0x2F, 0x4A, 0xE1, 0xAE, 0xA4, 0xAE,
+    0x90, 0xF5, 0x9E, 0x9A, 0xEA, 0x59, 0xE9, 0xF7, 0xFE, 0x97, 0xFE, 0x70, 0xFD, 0x97, 0x0F, 0xD7,
+    0x1A, 0xF9, 0x70, 0x0E, 0xA3, 0xAF, 0x93, 0xF1, 0xF3, 0xFC, 0x92, 0xAF, 0x1F, 0x29, 0xFC, 0x92,
+    0xF9, 0x1F, 0x2F, 0xD9, 0x19, 0xF2, 0xF1, 0x9F, 0xD9, 0x1F, 0x92, 0xF1, 0xAD, 0xAE, 0x90, 0x9F,
+    0x3F, 0x1E, 0x0E, 0x90, 0xAE, 0x93, 0xF0, 0xAE, 0x0E, 0x90, 0xF4, 0xF0, 0xE9, 0x0E, 0x9A, 0xE9,
+    0x4F, 0x9E, 0x1E, 0x9F, 0x5A, 0xEA, 0xD9, 0x1E, 0x9E, 0xA5, 0xAF, 0xD2, 0xFE, 0x6A, 0xFC, 0xA2,
+    0xFD, 0xA6, 0xAF, 0xC3, 0xFD, 0x7A, 0xFC, 0x3F, 0xCA, 0x7A, 0xF9, 0x3F, 0xC7, 0x3A, 0xF3, 0x9F,
+    0xA4, 0xF9, 0x2F, 0xC5, 0xFA, 0x1F, 0xC6, 0x9F, 0x09, 0xF7, 0x0F, 0x9F, 0x97, 0x0A, 0xFE, 0xA7,
+    0x2F, 0xDA, 0x73, 0xFD, 0x73, 0x9F, 0xCA, 0x73, 0xFE, 0x72, 0xFF, 0x97, 0x0A, 0xF9, 0xF7, 0xAF,
+    0x1F, 0x95, 0x9F, 0x91, 0xFA, 0x5F, 0xA2, 0x9F, 0x4F, 0xC4, 0xFA, 0x20, 0x39, 0xEA, 0x5F, 0x93,
+    0x9F, 0x4A, 0xF5, 0xF4, 0xF9, 0x5F, 0x3A, 0xF6, 0xF3, 0xF9, 0x6F, 0x2A, 0xF7, 0xAE, 0x91, 0xF7,
+    0x09, 0xE9, 0x0A, 0xEA, 0x70, 0x9E, 0xA0, 0xF7, 0x2E, 0xA9, 0xEA, 0x72, 0xEA, 0xF7, 0x3F, 0xEA,
+    0x73, 0xAF, 0xD7, 0x4A, 0xFC, 0xA7, 0x49, 0xFC, 0x75, 0x9F, 0x97, 0x59, 0xF7, 0x6F, 0x97, 0x5F,
+    0xC7, 0x2A, 0xAA, 0xFC, 0x73, 0xFE, 0x97, 0x3F, 0xD9, 0x74, 0xFA, 0x75, 0x3F, 0xFE, 0x3F, 0xFD,
+    0xA2, 0x9F, 0xFD, 0x93, 0x99, 0x99, 0x9F, 0xC7, 0x0A, 0xF7, 0x0A, 0xF9, 0x79, 0xF9, 0x70, 0xFA,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xAF, 0x70, 0x9F, 0x97, 0x9F, 0xA9, 0x99, 0x99, 0x3F, 0xFE, 0x92,
+    0xFF, 0xE2, 0x9F, 0xFE, 0x20, 0x70, 0xAA, 0xD7, 0x9F, 0xC7, 0xFC, 0xA6, 0x9F, 0xA9, 0x6A, 0xE7,
+    0x1F, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0xAE, 0xA5, 0x9F, 0xD6, 0xAF, 0x97,
+    0xFC, 0x97, 0x9A, 0xF7, 0x1A, 0xE9, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1F, 0x71, 0xEA,
+    0x70, 0x9E, 0xA7, 0x1F, 0xC7, 0x0F, 0xC9, 0x79, 0xF9, 0x71, 0x9A, 0xA5, 0x3A, 0xDA, 0xAD, 0xAA,
+    0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA,
+    0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD,
+    0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xA9, 0xAA, 0x90, 0x4A, 0xCA, 0x97, 0x0F, 0xA7, 0xFC, 0x96,
+    0xAF, 0xA7, 0x9E, 0xA7, 0x9E, 0x97, 0xAE, 0x70, 0xAE, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xF7, 0x0A,
+    0xFA, 0x7A, 0xF6, 0xAF, 0xC5, 0xFD, 0xA4, 0x9F, 0x7A, 0xE7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x7A,
+    0xE7, 0x0F, 0x59, 0xAF, 0xA5, 0x9F, 0xC6, 0x9F, 0x96, 0x9A, 0xA9, 0x70, 0x19, 0xAA, 0xA9, 0x69,
+    0x0F, 0xEA, 0x92, 0xCA, 0x9F, 0xFF, 0xCA, 0x9D, 0x99, 0xAF, 0xFA, 0x99, 0x49, 0xAF, 0x97, 0x70,
+    0x5A, 0xD5, 0xFA, 0x4F, 0xC4, 0xF9, 0x49, 0xDA, 0x77, 0x70, 0x9A, 0xAA, 0x5A, 0xE5, 0xEA, 0x5E,
+    0xA4, 0x9E, 0x94, 0xF5, 0xF4, 0x9F, 0x4A, 0xEA, 0x4F, 0xA4, 0xF9, 0x39, 0xF4, 0xAF, 0x4F, 0xC4,
+    0x99, 0x99, 0x40, 0x77, 0x5D, 0xA7, 0x19, 0xD9, 0x79, 0xAF, 0xA9, 0x4A, 0xFF, 0x92, 0xFF, 0xD2,
+    0xAF, 0xCA, 0xAA, 0xC9, 0x19, 0xFA, 0x7A, 0xF7, 0x0F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xAE, 0xA7,
+    0x0A, 0xEA, 0x70, 0xAF, 0x70, 0x9F, 0xA2, 0x9C, 0x3F, 0xFD, 0x3A, 0xFF, 0xC4, 0x9F, 0xEA, 0x6E,
+    0x99, 0x70, 0xDA, 0x71, 0x9D, 0x97, 0x29, 0x97, 0x77, 0x74, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xC9,
+    0x7F, 0xFD, 0x7A, 0xFA, 0x99, 0xAC, 0xA7, 0xFA, 0x74, 0x9F, 0x75, 0xAF, 0x75, 0xAE, 0xA7, 0x5F,
+    0x97, 0x2F, 0xFE, 0x96, 0xFF, 0xE9, 0x59, 0xFF, 0xE7, 0x99, 0xFA, 0x99, 0x97, 0x2F, 0x97, 0x5F,
+    0x75, 0xAE, 0xA7, 0x4A, 0xEA, 0x73, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0xFF, 0xFC, 0xA3,
+    0xFF, 0xFD, 0x93, 0xFF, 0xFD, 0x30, 0x1A, 0x96, 0xA9, 0x2A, 0xD9, 0xAE, 0x9A, 0xDA, 0x1F, 0xFF,
+    0xA2, 0xFF, 0xDA, 0x3E, 0xA1, 0x9E, 0xA3, 0xE4, 0xE2, 0x9D, 0xA4, 0xE3, 0xE4, 0xE3, 0xE9, 0x2A,
+    0xDA, 0x3A, 0xFA, 0xF9, 0x2A, 0xFF, 0xE9, 0x1F, 0xFF, 0xA2, 0xCA, 0x19, 0x92, 0xD7, 0x70, 0x1F,
+    0x59, 0xF2, 0xF9, 0x4F, 0x92, 0xAE, 0x93, 0xAF, 0x39, 0xEA, 0x3F, 0x5F, 0x2F, 0x95, 0xF1, 0x9F,
+    0x6A, 0xE9, 0x0F, 0x79, 0xE9, 0xAE, 0x97, 0x0F, 0xEA, 0x71, 0xFE, 0x72, 0xAF, 0xCA, 0x79, 0xFF,
+    0xE5, 0xAF, 0xFD, 0xA5, 0x99, 0x9A, 0xF9, 0x99, 0x71, 0x9E, 0xA7, 0x1A, 0xAA, 0xFC, 0xAA, 0xA5,
+    0x9F, 0xFE, 0x5A, 0xFF, 0xDA, 0x70, 0x9F, 0x74, 0xAE, 0xA7, 0x4A, 0xE9, 0x71, 0x3A, 0xDA, 0xAD,
+    0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0x9A, 0xA9,
+    0x77, 0x3A, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD,
+    0xAA, 0xDA, 0x9A, 0xA9, 0x70, 0x99, 0x71, 0xAF, 0xDA, 0x49, 0xFF, 0xC9, 0x3F, 0xA9, 0xAE, 0x39,
+    0xEA, 0x49, 0x39, 0xEA, 0x72, 0xFA, 0x71, 0x9F, 0xCA, 0x7A, 0xFE, 0x5F, 0x9F, 0xC3, 0x9E, 0x2F,
+    0x3E, 0xA2, 0x9E, 0x3F, 0x29, 0xE3, 0xAE, 0xA1, 0xEA, 0x4F, 0xFC, 0x6F, 0xE7, 0x09, 0xFC, 0x72,
+    0xAE, 0xA7, 0x2F, 0x2A, 0x94, 0x9E, 0xA2, 0xAD, 0xAA, 0xAA, 0xF9, 0x2A, 0xFF, 0xC9, 0x39, 0xAF,
+    0xDA, 0x97, 0x09, 0x97, 0x00, 0x09, 0xD9, 0x1A, 0xCA, 0x1F, 0x0A, 0xE9, 0x0E, 0xA0, 0xAE, 0x1A,
+    0xD2, 0xD9, 0x00, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAF, 0xCA, 0xFA, 0x70, 0xE9, 0x59, 0xE9, 0x5D,
+    0xA7, 0x1A, 0xD9, 0x3A, 0xCA, 0x29, 0xAF, 0xA1, 0xAD, 0x29, 0xD2, 0x9F, 0xE2, 0xAC, 0xA1, 0xD9,
+    0x19, 0xDA, 0x29, 0x93, 0xD1, 0xD2, 0xE7, 0x1A, 0xC9, 0x9C, 0xA2, 0xD9, 0x71, 0x9C, 0xAA, 0xC9,
+    0x19, 0xD7, 0x29, 0xDA, 0xC9, 0x19, 0xD7, 0x3D, 0xAC, 0x91, 0x9D, 0x72, 0x9D, 0x9C, 0xA2, 0xD9,
+    0x71, 0x9C, 0xA0, 0xD2, 0xDA, 0x71, 0xAC, 0x90, 0xD2, 0x9D, 0x97, 0x0D, 0x1A, 0xD2, 0xFF, 0x2A,
+    0xD2, 0xD9, 0x2A, 0xFC, 0xA1, 0x9D, 0x39, 0xDA, 0x49, 0x39, 0xD9, 0x49, 0xE9, 0x6A, 0xDA, 0x7F,
+    0xAA, 0xAA, 0xF9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97, 0x10, 0x75, 0xAD, 0xA0, 0xD9, 0x1F, 0xF1,
+    0xEA, 0x0A, 0xE0, 0x9E, 0x2E, 0x0A, 0xD9, 0x2D, 0xA0, 0xE9, 0x19, 0xD9, 0x0E, 0x2A, 0xD1, 0xE9,
+    0x09, 0xE1, 0xAF, 0xEA, 0x2F, 0x9D, 0x94, 0x96, 0x49, 0x59, 0x69, 0xD9, 0x29, 0xD9, 0x4F, 0x90,
+    0x9F, 0x92, 0xFA, 0x1F, 0xA2, 0xFC, 0x1F, 0xC2, 0xFC, 0x1F, 0xC2, 0xAF, 0x1A, 0xF3, 0xFA, 0x1F,
+    0xA3, 0x9F, 0x19, 0xF4, 0xF9, 0x1F, 0x93, 0xAF, 0x1A, 0xF4, 0xF2, 0xF4, 0xAD, 0xA2, 0xAD, 0xA5,
+    0x95, 0x94, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x9A, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0x99, 0x90, 0x0A,
+    0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0xA0, 0xFE, 0x99, 0xFE, 0x00, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAF,
+    0xCA, 0xFA, 0x70, 0xE9, 0x59, 0xE9, 0x5D, 0xA7, 0x1A, 0xD9, 0x3A, 0xCA, 0x1F, 0xD9, 0x2A, 0xD2,
+    0x9D, 0x2F, 0xEA, 0x2A, 0xCA, 0x1D, 0x92, 0xD9, 0x1A, 0xD9, 0x2D, 0x1D, 0x3D, 0x92, 0xD9, 0x2A,
+    0xC9, 0x9C, 0xA3, 0xD9, 0x2D, 0x92, 0x9C, 0xAA, 0xC9, 0x3D, 0x91, 0xAD, 0x39, 0xDA, 0xC9, 0x3F,
+    0xE9, 0x4D, 0xAC, 0x93, 0xFD, 0x94, 0x9D, 0x9C, 0xA3, 0xD9, 0x0A, 0xD4, 0x9C, 0xA0, 0xD3, 0xD9,
+    0x1D, 0xA3, 0xAC, 0x90, 0xD3, 0xD9, 0x19, 0xD3, 0xD1, 0xAD, 0x2D, 0x92, 0xDA, 0x1A, 0xD2, 0xD9,
+    0x1D, 0x92, 0x9D, 0x99, 0xD3, 0x9D, 0xA7, 0x19, 0xD9, 0x49, 0xE9, 0x6A, 0xDA, 0x7F, 0xAA, 0xAA,
+    0xF9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97, 0x10, 0x77, 0xAF, 0xFF, 0x1A, 0xFF, 0xF1, 0xFF, 0xFA,
+    0x00, 0x74, 0x9F, 0xA3, 0xAF, 0xE1, 0x9E, 0xAA, 0xEA, 0x0A, 0xD9, 0x2E, 0x0E, 0x3A, 0xD0, 0xE3,
+    0xAD, 0x0A, 0xDA, 0x19, 0xE1, 0xFF, 0x91, 0x9F, 0xDA, 0x49, 0xAA, 0xA3, 0x59, 0x99, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9A, 0xAA, 0xAA, 0xFA, 0xAA, 0xA9, 0x9F, 0xFF, 0xCA, 0x9F,
+    0xFF, 0xCA, 0x09, 0x99, 0x99, 0xEA, 0x99, 0x99, 0x95, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x74, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x39, 0xAE, 0x94, 0xFE, 0xA3, 0xFF,
+    0x39, 0xA1, 0x9E, 0x97, 0xE7, 0xF6, 0xF6, 0xF5, 0x9E, 0xA5, 0xAE, 0x95, 0xAF, 0xF9, 0x1F, 0xFC,
+    0x2F, 0xFC, 0x10, 0x29, 0xAE, 0xA3, 0xFF, 0x2A, 0xDA, 0xF9, 0x29, 0x2E, 0x96, 0xE3, 0x9A, 0xAE,
+    0x93, 0xFC, 0x5A, 0xAF, 0x7E, 0x96, 0xE9, 0x0D, 0xA9, 0x9F, 0x1F, 0xFA, 0x19, 0xFC, 0xA9, 0x75,
+    0x39, 0x99, 0x93, 0xFA, 0x2F, 0xA2, 0xAE, 0xA2, 0x9E, 0x94, 0x99, 0x50, 0x4F, 0x4F, 0x49, 0xF3,
+    0x9F, 0x4A, 0xEA, 0x39, 0xF4, 0xF9, 0x3A, 0xEA, 0x4F, 0x93, 0xF9, 0x39, 0xF4, 0xF4, 0x9F, 0x39,
+    0xF4, 0xAE, 0xA3, 0xAE, 0xA4, 0xF9, 0x3F, 0xA4, 0xF4, 0xF9, 0x39, 0xF3, 0xAF, 0x4A, 0xF3, 0xFC,
+    0x4A, 0xFA, 0x09, 0xFC, 0xA4, 0xFF, 0xFC, 0x94, 0xFF, 0xC9, 0xE4, 0x9F, 0xF1, 0xE4, 0xAE, 0xA7,
+    0x5F, 0x97, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x50, 0x77, 0x2A, 0xFF,
+    0xE2, 0xFF, 0xFC, 0x1F, 0xFD, 0xAA, 0xD0, 0x9F, 0xFC, 0x91, 0xD0, 0xAF, 0xFC, 0x91, 0xD0, 0xFF,
+    0xD9, 0x1D, 0x0F, 0xFD, 0x91, 0xD0, 0xFF, 0xD9, 0x1D, 0x0F, 0xFD, 0x91, 0xD0, 0xAF, 0xFC, 0x91,
+    0xD0, 0x9F, 0xFC, 0x91, 0xD1, 0xFF, 0xC9, 0x1D, 0x19, 0xFF, 0x91, 0xD2, 0x9F, 0xE9, 0x1D, 0x59,
+    0x90, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70,
+    0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD9,
+    0x1D, 0x70, 0xAA, 0x91, 0xAA, 0x00, 0x29, 0x92, 0x9F, 0x1F, 0xC1, 0xFC, 0x1F, 0x92, 0x99, 0x20,
+    0x1A, 0xD2, 0x9E, 0xA2, 0x9E, 0xA2, 0xAD, 0xAA, 0x9A, 0xEA, 0xFD, 0x0F, 0xA1, 0x5A, 0xAA, 0x49,
+    0xF3, 0xFD, 0x1A, 0xFD, 0xA1, 0xFE, 0x91, 0x9C, 0x90, 0xE5, 0xAE, 0x5A, 0xE5, 0xEA, 0x5E, 0x94,
+    0x9E, 0x5A, 0xE5, 0xAD, 0xA2, 0x2A, 0xEA, 0x3F, 0xE1, 0xAE, 0x9E, 0x90, 0xE1, 0x9D, 0xA9, 0xDA,
+    0x19, 0xDA, 0xAD, 0x91, 0xAD, 0x9A, 0xD9, 0x1E, 0x99, 0xDA, 0x09, 0xE1, 0xFE, 0x91, 0x9F, 0xC9,
+    0x49, 0x94, 0x39, 0x94, 0x99, 0x49, 0xE2, 0x9E, 0x4A, 0xEA, 0x1A, 0xE9, 0x39, 0xF1, 0x9F, 0x4F,
+    0x91, 0xF9, 0x3A, 0xF1, 0xAF, 0x4F, 0x91, 0xF3, 0xAF, 0x1A, 0xF2, 0x9F, 0x90, 0xAF, 0x29, 0xF9,
+    0x09, 0xF9, 0x2F, 0xA1, 0xF9, 0x2A, 0xEA, 0x1F, 0xA4, 0xAD, 0x3D, 0xA6, 0x95, 0x95, 0x49, 0xAA,
+    0x96, 0xAD, 0xA5, 0xF9, 0x59, 0xE4, 0xAF, 0xC9, 0x5E, 0x92, 0x9F, 0xE5, 0xEA, 0x3A, 0xFE, 0x4A,
+    0xE5, 0xCA, 0x0E, 0xA3, 0x9E, 0x71, 0xE9, 0x3E, 0x97, 0x09, 0xE3, 0xEA, 0x71, 0xAE, 0x2A, 0xE2,
+    0x9A, 0xAA, 0x3A, 0xE1, 0x9E, 0x29, 0xF3, 0xEA, 0x1E, 0x91, 0x9F, 0xC3, 0xE9, 0x0E, 0xA2, 0xFC,
+    0xA2, 0x9E, 0x0A, 0xE2, 0xFD, 0x96, 0x9E, 0x2E, 0x9E, 0x7E, 0x91, 0xAD, 0x99, 0xE6, 0xEA, 0x1A,
+    0xD9, 0x0A, 0xE5, 0xAE, 0x2E, 0xAA, 0xFA, 0x39, 0xE2, 0x9F, 0xFD, 0x3E, 0x92, 0x9A, 0xAA, 0xAF,
+    0xCA, 0x2E, 0xA7, 0x09, 0xE3, 0xAE, 0x71, 0xAD, 0xA2, 0x49, 0xAA, 0x96, 0xAD, 0xA6, 0xF9, 0x59,
+    0xE5, 0xAF, 0xC9, 0x5E, 0x49, 0xFE, 0x5E, 0x94, 0xAF, 0xE4, 0xAD, 0xA6, 0xCA, 0x0E, 0xA3, 0x9E,
+    0x72, 0xE9, 0x3E, 0x97, 0x19, 0xE3, 0xEA, 0x72, 0xAE, 0x2A, 0xE1, 0xAE, 0xA4, 0xAE, 0x19, 0xE0,
+    0xAF, 0xE3, 0xEA, 0x1E, 0x90, 0xAF, 0xEA, 0x2E, 0x90, 0xEA, 0x2C, 0x91, 0xF1, 0x9E, 0x0A, 0xE7,
+    0xEA, 0x59, 0xE7, 0x9E, 0x6E, 0x96, 0x9E, 0x95, 0xEA, 0x6A, 0xE9, 0x5A, 0xE6, 0xF6, 0x9E, 0x59,
+    0xEA, 0x7E, 0x94, 0x9F, 0xFA, 0x2E, 0xA5, 0xAF, 0xFA, 0x1A, 0xE6, 0xFF, 0xC9, 0x00, 0x29, 0xAE,
+    0xA7, 0x0A, 0xD9, 0x3A, 0xFE, 0x6A, 0xE4, 0x9D, 0xAA, 0xEA, 0x49, 0xE6, 0x92, 0xAD, 0xA4, 0xE9,
+    0x72, 0xE9, 0x3E, 0xA7, 0x9A, 0xAE, 0xA3, 0xAE, 0x70, 0xAF, 0x49, 0xE7, 0x1A, 0xAF, 0x3E, 0x97,
+    0x4A, 0xDA, 0x1E, 0xA2, 0xAA, 0xAA, 0x6A, 0xDA, 0x0A, 0xE2, 0xAF, 0x0A, 0xCA, 0x99, 0xAE, 0x99,
+    0xE2, 0x9F, 0xA0, 0xAF, 0xEA, 0x0E, 0x91, 0x9F, 0xC9, 0x09, 0xFD, 0x90, 0xAD, 0xA2, 0xFD, 0x97,
+    0x09, 0xE2, 0xE9, 0xE7, 0x1E, 0x2E, 0x0A, 0xE7, 0x0E, 0x91, 0xAD, 0x90, 0xEA, 0x7A, 0xDA, 0x19,
+    0xEA, 0xAF, 0xA5, 0x9E, 0x2A, 0xFF, 0xD5, 0xE9, 0x2A, 0xAA, 0xAA, 0xFA, 0xA4, 0xEA, 0x70, 0xAE,
+    0x5A, 0xE7, 0x1A, 0xDA, 0x20, 0x77, 0x4F, 0x7A, 0xF9, 0x6A, 0xF7, 0x9F, 0x70, 0x9A, 0x97, 0x77,
+    0x72, 0xEA, 0x79, 0xE9, 0x7F, 0x69, 0xFA, 0x5A, 0xFC, 0x5F, 0xCA, 0x5F, 0xC9, 0x59, 0xF7, 0xAE,
+    0xA7, 0xFA, 0x49, 0x1A, 0xF9, 0x99, 0xAD, 0x19, 0xFF, 0xDA, 0x1A, 0xFF, 0xCA, 0x2A, 0xFD, 0xA7,
+    0x70, 0x72, 0x99, 0x99, 0x76, 0xF9, 0x75, 0x9E, 0xA7, 0x6A, 0xE7, 0x7A, 0xDA, 0x77, 0x99, 0x97,
+    0x77, 0x7F, 0xC9, 0x73, 0xAF, 0xCA, 0x73, 0xFD, 0xA7, 0x2A, 0xFE, 0x72, 0xFA, 0xE7, 0x1A, 0xE9,
+    0xAE, 0x71, 0xF0, 0xAE, 0x70, 0xAE, 0x90, 0xAE, 0x70, 0xF1, 0x9E, 0x96, 0xAE, 0x91, 0x9E, 0x95,
+    0x9F, 0x29, 0xEA, 0x5F, 0x92, 0x9E, 0xA4, 0x9F, 0xAA, 0xAA, 0xAE, 0xA4, 0xFF, 0xFD, 0x39, 0xFF,
+    0xFD, 0x3F, 0xFF, 0xE2, 0x9F, 0x6F, 0x2F, 0xA6, 0xF1, 0x9F, 0x7F, 0x90, 0xFA, 0x7F, 0x99, 0xF7,
+    0x0A, 0xEA, 0x76, 0x99, 0x99, 0x97, 0x59, 0xF9, 0x75, 0xF9, 0x75, 0xF7, 0x6A, 0xE7, 0x79, 0x99,
+    0x77, 0x77, 0x3F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xFA, 0xE7, 0x2A,
+    0xE9, 0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1, 0x9E, 0x97, 0xAE, 0x91, 0x9E,
+    0x96, 0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA, 0xAE, 0xA5, 0xFF, 0xFD, 0x49,
+    0xFF, 0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F, 0x7F, 0x91, 0xFA, 0x7F, 0x90,
+    0x9F, 0x70, 0xAE, 0xA0, 0x74, 0x99, 0x99, 0x76, 0xFD, 0x74, 0xFE, 0x97, 0x2E, 0xA0, 0xAE, 0x70,
+    0x9E, 0xA2, 0xEA, 0x70, 0x99, 0x59, 0x99, 0x77, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0xA7, 0x4F, 0xDA,
+    0x73, 0xAF, 0xE7, 0x3F, 0xAE, 0x72, 0xAE, 0x9A, 0xE7, 0x2F, 0x0A, 0xE7, 0x1A, 0xE9, 0x0A, 0xE7,
+    0x1F, 0x19, 0xE9, 0x7A, 0xE9, 0x19, 0xE9, 0x69, 0xF2, 0x9E, 0xA6, 0xF9, 0x29, 0xEA, 0x59, 0xFA,
+    0xAA, 0xAA, 0xEA, 0x5F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD4, 0xFF, 0xFE, 0x39, 0xF6, 0xF3, 0xFA, 0x6F,
+    0x29, 0xF7, 0xF9, 0x1F, 0xA7, 0xF9, 0x09, 0xF7, 0x0A, 0xEA, 0x00, 0x77, 0x76, 0x9E, 0xA2, 0xD9,
+    0x70, 0x9F, 0xDA, 0xE7, 0x1F, 0xFD, 0xA7, 0x1D, 0x2A, 0xEA, 0x72, 0x99, 0x49, 0x77, 0x77, 0x3F,
+    0xC9, 0x75, 0xAF, 0xCA, 0x75, 0xFD, 0xA7, 0x4A, 0xFE, 0x74, 0xFA, 0xE7, 0x3A, 0xE9, 0xAE, 0x73,
+    0xF0, 0xAE, 0x72, 0xAE, 0x90, 0xAE, 0x72, 0xF1, 0x9E, 0x97, 0x0A, 0xE9, 0x19, 0xE9, 0x79, 0xF2,
+    0x9E, 0xA7, 0xF9, 0x29, 0xEA, 0x69, 0xFA, 0xAA, 0xAA, 0xEA, 0x6F, 0xFF, 0xD5, 0x9F, 0xFF, 0xD5,
+    0xFF, 0xFE, 0x49, 0xF6, 0xF4, 0xFA, 0x6F, 0x39, 0xF7, 0xF9, 0x2F, 0xA7, 0xF9, 0x19, 0xF7, 0x0A,
+    0xEA, 0x10, 0x71, 0x9D, 0x91, 0xAC, 0xA7, 0x2F, 0x0A, 0xE9, 0x71, 0xEA, 0x0A, 0xE7, 0x2A, 0xD2,
+    0xD9, 0x77, 0x77, 0x77, 0x3F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xFA,
+    0xE7, 0x2A, 0xE9, 0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1, 0x9E, 0x97, 0xAE,
+    0x91, 0x9E, 0x96, 0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA, 0xAE, 0xA5, 0xFF,
+    0xFD, 0x49, 0xFF, 0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F, 0x7F, 0x91, 0xFA,
+    0x7F, 0x90, 0x9F, 0x70, 0xAE, 0xA0, 0x74, 0x99, 0x97, 0x6F, 0xC9, 0x73, 0xAD, 0xAE, 0x73, 0xD9,
+    0x1D, 0x73, 0xD9, 0x1D, 0x73, 0xAD, 0xAE, 0x74, 0xFC, 0x77, 0x97, 0x77, 0x71, 0xFC, 0x97, 0x3A,
+    0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71, 0xAE, 0x9A, 0xE7, 0x1F, 0x0A, 0xE7,
+    0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19, 0xE9, 0x59, 0xF2, 0x9E, 0xA5, 0xF9,
+    0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF, 0xD3, 0xFF, 0xFE, 0x29,
+    0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9, 0x9F, 0x70, 0xAE, 0xA0, 0x74, 0xAF,
+    0xFF, 0xE7, 0x49, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0xA7, 0x3A, 0xFF, 0xFF, 0x97, 0x29, 0xF0, 0x9F,
+    0x77, 0x2F, 0xA0, 0xAE, 0xA7, 0x71, 0xAF, 0x1F, 0x97, 0x70, 0x9F, 0x91, 0xF9, 0x77, 0x0F, 0xA1,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xA7, 0x1A, 0xF2, 0xAF, 0xFD, 0xA7, 0x1F, 0x92, 0xAF, 0xFD, 0x97, 0x0F,
+    0xC3, 0xFF, 0xE7, 0x09, 0xFC, 0xAA, 0xAA, 0xF7, 0x7F, 0xFF, 0xD7, 0x6A, 0xFF, 0xFD, 0x75, 0x9F,
+    0xFF, 0xDA, 0x75, 0xFA, 0x5F, 0x97, 0x4A, 0xF6, 0xFA, 0xAA, 0xAA, 0xAA, 0x6F, 0x95, 0x9F, 0xFE,
+    0x5F, 0xC6, 0xAF, 0xFE, 0x49, 0xF7, 0xFF, 0xF4, 0x77, 0x72, 0xAF, 0xDA, 0x97, 0xAF, 0xFE, 0x5F,
+    0xFF, 0xA4, 0xFE, 0xAA, 0xF4, 0xFD, 0x5A, 0xA3, 0x9F, 0xA7, 0x4F, 0xC7, 0x49, 0xF9, 0x74, 0xAF,
+    0x75, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x74, 0x9F, 0x97, 0x49, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75,
+    0xFC, 0x95, 0x95, 0x9F, 0xCA, 0x99, 0xAA, 0xD6, 0xFF, 0xF7, 0xFF, 0xE7, 0x09, 0xFE, 0xA9, 0x72,
+    0x9D, 0xA7, 0x6F, 0x76, 0x9F, 0x76, 0x9E, 0x73, 0x99, 0x9F, 0x73, 0xAF, 0xCA, 0x73, 0x9F, 0x97,
+    0x00, 0x79, 0x99, 0x97, 0x4F, 0x97, 0x39, 0xEA, 0x74, 0xAE, 0x75, 0xE9, 0x75, 0x99, 0x77, 0x71,
+    0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x9F, 0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73,
+    0x9F, 0x73, 0xAF, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A,
+    0xEA, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F,
+    0xFE, 0xA4, 0xFF, 0xEA, 0x30, 0x73, 0x99, 0x99, 0x97, 0x29, 0xF9, 0x72, 0xF9, 0x72, 0xF9, 0x72,
+    0xAE, 0x74, 0x99, 0x97, 0x77, 0x2F, 0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4,
+    0xFA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF,
+    0xE5, 0xFF, 0xE4, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x4A, 0xFF, 0xE4, 0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x71, 0x99, 0x99, 0x73, 0xFD, 0x71,
+    0xFE, 0x97, 0xF0, 0xAE, 0x6E, 0xA2, 0xEA, 0x59, 0x95, 0x99, 0x97, 0x75, 0xFF, 0xEA, 0x4F, 0xFE,
+    0xA3, 0x9F, 0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0xAA,
+    0xAA, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73,
+    0xF9, 0x72, 0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F, 0xFE, 0xA4, 0xFF, 0xEA,
+    0x30, 0x69, 0xD9, 0x1A, 0xCA, 0x7F, 0x09, 0xE9, 0x6F, 0x0A, 0xE7, 0x9D, 0x2D, 0xA7, 0x77, 0x77,
+    0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x9F, 0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73,
+    0x9F, 0x73, 0xAF, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A,
+    0xEA, 0x73, 0xFA, 0x73, 0xF9, 0x72, 0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F,
+    0xFE, 0xA4, 0xFF, 0xEA, 0x30, 0x59, 0x99, 0x97, 0x1F, 0xA7, 0x1F, 0x71, 0x9E, 0x97, 0x19, 0xE7,
+    0x29, 0x99, 0x77, 0x39, 0xFF, 0xA3, 0xAF, 0xFA, 0x3F, 0xFC, 0x59, 0xFC, 0x97, 0xF9, 0x70, 0xF7,
+    0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0xA7,
+    0x0F, 0x97, 0x9F, 0x70, 0x9F, 0x79, 0xFC, 0x6F, 0xFA, 0x3A, 0xFF, 0xA3, 0xAF, 0xF9, 0x30, 0x71,
+    0x99, 0x99, 0x97, 0x19, 0xFA, 0x71, 0xFA, 0x71, 0xAE, 0x97, 0x19, 0xE9, 0x72, 0x99, 0x97, 0x77,
+    0x19, 0xFF, 0xA5, 0xAF, 0xFA, 0x5F, 0xFC, 0x79, 0xFC, 0x97, 0x1F, 0x97, 0x2F, 0x72, 0x9F, 0x72,
+    0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x71,
+    0x9F, 0x72, 0x9F, 0x71, 0x9F, 0xC7, 0x0F, 0xFA, 0x5A, 0xFF, 0xA5, 0xAF, 0xF9, 0x50, 0x79, 0x99,
+    0x99, 0x71, 0xFD, 0x70, 0xFE, 0xA6, 0xF0, 0x9E, 0x5E, 0xA2, 0xAE, 0x49, 0x99, 0x49, 0x99, 0x77,
+    0x49, 0xFF, 0xA5, 0xAF, 0xFA, 0x5F, 0xFC, 0x79, 0xFC, 0x97, 0x1F, 0x97, 0x2F, 0x72, 0x9F, 0x72,
+    0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x71,
+    0x9F, 0x72, 0x9F, 0x71, 0x9F, 0xC7, 0x0F, 0xFA, 0x5A, 0xFF, 0xA5, 0xAF, 0xF9, 0x50, 0x5D, 0xA1,
+    0xAD, 0x5A, 0xE0, 0x9E, 0xA4, 0xF0, 0x9E, 0x94, 0x9D, 0x91, 0xAC, 0xA7, 0x77, 0x72, 0x9F, 0xFA,
+    0x4A, 0xFF, 0xA4, 0xFF, 0xC6, 0x9F, 0xC9, 0x70, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F,
+    0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0x97, 0x09, 0xF7, 0x19,
+    0xF7, 0x09, 0xFC, 0x7F, 0xFA, 0x4A, 0xFF, 0xA4, 0xAF, 0xF9, 0x40, 0x4F, 0xEA, 0x97, 0x1F, 0xFD,
+    0xA6, 0x9F, 0xFF, 0x5A, 0xFF, 0xFA, 0x4F, 0xA2, 0x9F, 0xC4, 0xF9, 0x39, 0xFA, 0x3F, 0x5F, 0xA2,
+    0x9F, 0x5A, 0xF2, 0xAF, 0x5A, 0xF0, 0xFF, 0xD2, 0xAF, 0x0F, 0xFC, 0xA2, 0xFA, 0x9F, 0xFC, 0x92,
+    0xFA, 0x0A, 0xFC, 0xAA, 0xA2, 0x9F, 0x91, 0xAF, 0x5A, 0xF2, 0xFA, 0x49, 0xFA, 0x2F, 0x94, 0xFC,
+    0x29, 0xF3, 0x9F, 0xCA, 0x29, 0xFA, 0xAF, 0xEA, 0x3A, 0xFF, 0xFA, 0x4F, 0xFF, 0x95, 0xFF, 0xCA,
+    0x70, 0x77, 0x77, 0x09, 0xEA, 0x2D, 0xA7, 0x3F, 0xDA, 0xE9, 0x72, 0xAF, 0xFD, 0x73, 0xD9, 0x1A,
+    0xF7, 0x49, 0x94, 0x97, 0x77, 0x71, 0xFC, 0x96, 0xAE, 0x5F, 0xCA, 0x6F, 0x49, 0xFD, 0x6F, 0x4A,
+    0xFD, 0x94, 0x9E, 0xA4, 0xFE, 0xA4, 0xAE, 0x94, 0xFF, 0x4F, 0x5E, 0xAF, 0x93, 0xF4, 0x9E, 0x9A,
+    0xEA, 0x29, 0xEA, 0x4A, 0xE9, 0x0F, 0x2A, 0xEA, 0x4F, 0x1F, 0x2A, 0xE9, 0x4F, 0x1A, 0xEA, 0x1F,
+    0x49, 0xEA, 0x2F, 0x1F, 0x49, 0xEA, 0x2F, 0x09, 0xEA, 0x4A, 0xE9, 0x2A, 0xEA, 0x9E, 0x94, 0xF3,
+    0x9F, 0xAE, 0x5F, 0x4F, 0xF4, 0x9E, 0xA4, 0xAF, 0xE4, 0xAE, 0x94, 0x9F, 0xDA, 0x4A, 0xE6, 0xFD,
+    0x94, 0xF6, 0xAF, 0xC5, 0xF6, 0x9F, 0xC4, 0x70, 0x99, 0x99, 0x77, 0xFA, 0x77, 0xF7, 0x79, 0xE9,
+    0x77, 0xAD, 0xA7, 0x70, 0x99, 0x97, 0x77, 0x79, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F,
+    0xDA, 0xAA, 0xFC, 0x93, 0xFC, 0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F,
+    0x97, 0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09,
+    0xF9, 0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F,
+    0xC3, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69,
+    0x97, 0x10, 0x75, 0x99, 0x99, 0x76, 0xFA, 0x75, 0xFA, 0x75, 0xAE, 0xA7, 0x59, 0xE9, 0x77, 0x99,
+    0x77, 0x77, 0x19, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F, 0xDA, 0xAA, 0xFC, 0x93, 0xFC,
+    0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F,
+    0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97,
+    0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF,
+    0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69, 0x97, 0x10, 0x72, 0x99, 0x99,
+    0x97, 0x5F, 0xD7, 0x4F, 0xEA, 0x72, 0xF0, 0x9E, 0x97, 0x0E, 0xA2, 0xAE, 0x70, 0x99, 0x94, 0x99,
+    0x97, 0x77, 0x49, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F, 0xDA, 0xAA, 0xFC, 0x93, 0xFC,
+    0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F,
+    0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97,
+    0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF,
+    0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69, 0x97, 0x10, 0x77, 0x74, 0xAD,
+    0xA9, 0x19, 0xD7, 0x0F, 0xEA, 0xDA, 0x79, 0xFF, 0xD7, 0x0A, 0xCA, 0x19, 0xF9, 0x70, 0x99, 0x49,
+    0x97, 0x77, 0x69, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F, 0xDA, 0xAA, 0xFC, 0x93, 0xFC,
+    0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F,
+    0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97,
+    0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF,
+    0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69, 0x97, 0x10, 0x70, 0xAC, 0xA1,
+    0x9D, 0x97, 0x1A, 0xE9, 0x0E, 0xA7, 0x1A, 0xE1, 0xEA, 0x72, 0xD9, 0x1A, 0xCA, 0x77, 0x77, 0x77,
+    0x19, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F, 0xDA, 0xAA, 0xFC, 0x93, 0xFC, 0xA3, 0x9F,
+    0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA,
+    0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F,
+    0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F,
+    0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69, 0x97, 0x10, 0x19, 0x69, 0x92, 0xDA, 0x49,
+    0xD9, 0x0A, 0xEA, 0x29, 0xF1, 0xAE, 0xA0, 0x9F, 0x3F, 0xFC, 0x5F, 0xE7, 0xFC, 0x79, 0xFC, 0xA5,
+    0x9F, 0xEA, 0x39, 0xF0, 0xFA, 0x19, 0xF2, 0xAE, 0xA0, 0x9E, 0x4A, 0xDA, 0x19, 0xC6, 0xAA, 0x77,
+    0x77, 0x0A, 0x97, 0x9A, 0xFD, 0x9A, 0xD9, 0x5A, 0xFF, 0xF5, 0xFF, 0xFC, 0x94, 0xFD, 0xA9, 0xAF,
+    0xCA, 0x3F, 0xC9, 0x3A, 0xFC, 0x29, 0xF9, 0x3A, 0xFD, 0x2F, 0xA3, 0x9F, 0xE9, 0x09, 0xF4, 0xE9,
+    0xF9, 0x0A, 0xF3, 0xEA, 0x0F, 0x90, 0xFA, 0x2A, 0xE1, 0xF9, 0x0F, 0x91, 0x9E, 0x2F, 0x1F, 0x19,
+    0xE2, 0x9F, 0x1F, 0x1E, 0x92, 0xAF, 0x1F, 0x0E, 0xA3, 0xF9, 0x1F, 0xAE, 0x39, 0xF2, 0xFE, 0x4F,
+    0xA2, 0xFD, 0x4F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0xCA, 0x4A, 0xFF, 0xF9, 0x49,
+    0xE9, 0xFE, 0xA7, 0x9C, 0x39, 0x97, 0x77, 0x60, 0x79, 0x99, 0x97, 0x7A, 0xF7, 0x7F, 0x77, 0x0E,
+    0xA7, 0x79, 0xE7, 0x71, 0x99, 0x77, 0x75, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x59, 0xF3,
+    0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3,
+    0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3, 0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F,
+    0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC, 0x39, 0xFA, 0x4A, 0xFC, 0xA9, 0xAF, 0xC6, 0xFF,
+    0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x74, 0x99, 0x99, 0x76, 0xFC, 0x75,
+    0x9F, 0x76, 0xF7, 0x6E, 0xA7, 0x79, 0x99, 0x77, 0x76, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF,
+    0x59, 0xF3, 0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF,
+    0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3, 0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3,
+    0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC, 0x39, 0xFA, 0x4A, 0xFC, 0xA9, 0xAF,
+    0xC6, 0xFF, 0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x71, 0x99, 0x99, 0x97,
+    0x5A, 0xFC, 0x97, 0x39, 0xFE, 0x72, 0xAE, 0x90, 0xEA, 0x70, 0xAE, 0x92, 0xE9, 0x79, 0x99, 0x59,
+    0x97, 0x77, 0x2F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0x9F, 0x3A, 0xEA, 0x5A, 0xEA, 0x3F,
+    0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95,
+    0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F,
+    0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF, 0xCA, 0x9A, 0xFC, 0x6F, 0xFF, 0x96, 0x9F, 0xFD, 0xA7,
+    0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x79, 0xD2, 0xDA, 0x72, 0xEA, 0x0A, 0xE7, 0x19, 0xEA, 0x0F,
+    0x72, 0xAC, 0xA1, 0x9D, 0x97, 0x77, 0x77, 0x6F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0x9F,
+    0x3A, 0xEA, 0x5A, 0xEA, 0x3F, 0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF,
+    0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5,
+    0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF, 0xCA, 0x9A, 0xFC, 0x6F,
+    0xFF, 0x96, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x71, 0x99, 0x99, 0x74, 0xAF,
+    0x73, 0x9F, 0x74, 0xF7, 0x4E, 0xA7, 0x59, 0x99, 0x77, 0x72, 0xF6, 0xFA, 0x1F, 0x94, 0xAF, 0x2A,
+    0xEA, 0x4F, 0xA2, 0x9F, 0x3F, 0xC4, 0xF2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xE9, 0x0A, 0xF6, 0x9E,
+    0xA9, 0xF7, 0x0F, 0xF9, 0x70, 0xFE, 0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xF7,
+    0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x72, 0x4F,
+    0x97, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xFA, 0xA9, 0x97, 0xFF, 0xD9, 0x5F, 0xFE, 0x94, 0xFF, 0xF3,
+    0x9F, 0x2A, 0xF9, 0x2A, 0xF3, 0xFA, 0x2F, 0xA3, 0xFA, 0x2F, 0x93, 0xFA, 0x2F, 0x39, 0xF9, 0x19,
+    0xF2, 0x9F, 0xC2, 0xAF, 0xFF, 0xA2, 0xFF, 0xFA, 0x3F, 0xFE, 0x93, 0x9F, 0xEA, 0xA9, 0x59, 0xF7,
+    0x3A, 0xEA, 0x73, 0xF9, 0x73, 0xF9, 0x72, 0x76, 0x99, 0x77, 0x09, 0xFE, 0xA7, 0x4F, 0xFE, 0x97,
+    0x1A, 0xFF, 0xF7, 0x09, 0xFC, 0x2A, 0xF9, 0x7A, 0xF4, 0xFA, 0x7F, 0x94, 0xF9, 0x7F, 0x4A, 0xF7,
+    0x9F, 0x29, 0xFC, 0xA7, 0xAF, 0x1A, 0xFC, 0x97, 0x0F, 0xA0, 0x9F, 0xC7, 0x2F, 0x90, 0xFC, 0x73,
+    0xF1, 0xFC, 0x72, 0x9F, 0x1F, 0xCA, 0x71, 0xAE, 0xA2, 0xFD, 0x70, 0xFA, 0x29, 0xFD, 0x7F, 0x94,
+    0xFC, 0x95, 0x9F, 0x6F, 0xA5, 0xAF, 0x6F, 0xA5, 0xAE, 0xA0, 0xA3, 0x9F, 0x95, 0xF9, 0x0F, 0xFD,
+    0x6F, 0x90, 0xFF, 0xC9, 0x59, 0xF1, 0xAF, 0xDA, 0x7A, 0xF4, 0x99, 0x72, 0xFA, 0x77, 0x09, 0xF9,
+    0x75, 0x9A, 0xAF, 0xC7, 0x6A, 0xFD, 0xA7, 0x6A, 0xFC, 0xA7, 0x7A, 0xF9, 0x77, 0x00, 0x59, 0x99,
+    0x97, 0x3F, 0xA7, 0x3F, 0x73, 0x9E, 0x74, 0xAD, 0xA7, 0x49, 0x99, 0x77, 0x70, 0xFC, 0x1A, 0xDA,
+    0x29, 0xFE, 0x0E, 0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3,
+    0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F,
+    0xA1, 0xAF, 0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90,
+    0xEA, 0x69, 0x72, 0x72, 0x99, 0x99, 0x72, 0xFA, 0x71, 0xFA, 0x71, 0xAE, 0xA7, 0x19, 0xE9, 0x73,
+    0x99, 0x77, 0x72, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E, 0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF,
+    0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4,
+    0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF,
+    0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x72, 0x79, 0x99, 0x99, 0x71, 0xFD, 0x70, 0xFE,
+    0xA6, 0xF0, 0x9E, 0x94, 0xEA, 0x2A, 0xE4, 0x99, 0x94, 0x99, 0x97, 0x75, 0xFC, 0x1A, 0xDA, 0x29,
+    0xFE, 0x0E, 0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE,
+    0xA1, 0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1,
+    0xAF, 0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA,
+    0x69, 0x72, 0x77, 0x6A, 0xE9, 0x19, 0xD5, 0xFE, 0xAD, 0xA4, 0x9F, 0xFD, 0x5A, 0xCA, 0x19, 0xF9,
+    0x59, 0x94, 0x99, 0x77, 0x71, 0xFC, 0x1A, 0xDA, 0x39, 0xFE, 0x0E, 0xA2, 0x9F, 0xFF, 0x92, 0xFC,
+    0xA9, 0xAF, 0xC2, 0x9F, 0xA2, 0xFC, 0x2F, 0xC3, 0xAE, 0xA2, 0xF9, 0x3A, 0xEA, 0x19, 0xF4, 0xF9,
+    0x1A, 0xF4, 0xF2, 0xAF, 0x39, 0xF2, 0xAF, 0x3F, 0xA2, 0xAF, 0x29, 0xF9, 0x2A, 0xFA, 0x9A, 0xFC,
+    0x39, 0xFF, 0xF4, 0xAF, 0xDA, 0xF5, 0xAF, 0x90, 0xEA, 0x79, 0x73, 0x5D, 0xA1, 0xAD, 0x6A, 0xE1,
+    0xEA, 0x5A, 0xE0, 0x9E, 0x95, 0x9D, 0x91, 0xAC, 0xA7, 0x77, 0x76, 0xFC, 0x1A, 0xDA, 0x29, 0xFE,
+    0x0E, 0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1,
+    0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF,
+    0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69,
+    0x72, 0x70, 0x99, 0x73, 0xAF, 0x97, 0x09, 0xDA, 0xE7, 0x0A, 0xCA, 0x1D, 0x97, 0xAC, 0xA1, 0xD9,
+    0x79, 0xDA, 0xE7, 0x1A, 0xF9, 0x73, 0x99, 0x77, 0x71, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E, 0xA1,
+    0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A,
+    0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29, 0xF9,
+    0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x72, 0x77,
+    0x74, 0xFC, 0x1A, 0xD9, 0xFC, 0xA4, 0x9F, 0xE9, 0xFF, 0xE2, 0x9F, 0xFF, 0xFF, 0x91, 0xFC, 0x99,
+    0xAF, 0xD9, 0x1A, 0xEA, 0x09, 0xF9, 0x2F, 0xC9, 0x29, 0xEA, 0x0F, 0xA3, 0xFA, 0x3F, 0x90, 0xF9,
+    0x3F, 0xA0, 0x9A, 0xFC, 0x09, 0xF4, 0xFF, 0xF9, 0x0A, 0xF4, 0xFF, 0xDA, 0x2A, 0xEA, 0x39, 0xFA,
+    0xAA, 0x99, 0x4A, 0xEA, 0x3F, 0xC7, 0x1A, 0xF2, 0x9F, 0xC7, 0x1A, 0xFA, 0x0A, 0xFD, 0xA3, 0x9C,
+    0x92, 0xFF, 0xFF, 0xF9, 0x2A, 0xFD, 0xAF, 0xFF, 0x93, 0xAF, 0x90, 0xE0, 0xFE, 0x96, 0x97, 0x19,
+    0x96, 0x77, 0x2A, 0xFD, 0xA3, 0x9F, 0xFC, 0x3F, 0xFC, 0xA2, 0xFC, 0xA9, 0x9A, 0xC9, 0x1A, 0xF9,
+    0x7F, 0xA7, 0x9F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0xAF, 0x70, 0x9F,
+    0xC9, 0x99, 0xAC, 0x3F, 0xFD, 0x39, 0xFF, 0xC5, 0xFE, 0x96, 0xDA, 0x71, 0xAE, 0x97, 0x09, 0xAE,
+    0x72, 0xE9, 0x6A, 0x9A, 0xE6, 0x9F, 0xCA, 0x7F, 0x96, 0x59, 0x99, 0x97, 0x2F, 0x97, 0x19, 0xF7,
+    0x29, 0xE7, 0x3A, 0xDA, 0x73, 0x99, 0x97, 0x76, 0x9F, 0xD9, 0x5F, 0xFC, 0xA3, 0xFF, 0xE2, 0xFC,
+    0x91, 0xF9, 0x09, 0xF3, 0xAE, 0x90, 0xFA, 0x3F, 0x90, 0xF9, 0x09, 0xAF, 0xC0, 0x9F, 0xFF, 0x1A,
+    0xFF, 0xDA, 0x2A, 0xFA, 0xAA, 0x95, 0xAE, 0xA7, 0x1A, 0xF7, 0x19, 0xFA, 0x3A, 0xC3, 0xFF, 0xE4,
+    0xFF, 0xD5, 0xAF, 0xDA, 0x97, 0x09, 0x96, 0x71, 0x99, 0x99, 0x97, 0x09, 0xF9, 0x70, 0xF9, 0x70,
+    0xF9, 0x70, 0xAE, 0x72, 0x99, 0x97, 0x77, 0x09, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9,
+    0x1F, 0x90, 0x9F, 0x3A, 0xE9, 0x0F, 0xA3, 0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF,
+    0xFD, 0xA2, 0xAF, 0xAA, 0xA9, 0x5A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F,
+    0xFD, 0x5A, 0xFD, 0xA9, 0x70, 0x99, 0x60, 0x79, 0x99, 0x97, 0x2F, 0xD7, 0x0F, 0xE9, 0x6F, 0x0A,
+    0xE5, 0xEA, 0x2A, 0xDA, 0x49, 0x95, 0x99, 0x97, 0x75, 0x9F, 0xD9, 0x6F, 0xFC, 0xA4, 0xFF, 0xE3,
+    0xFC, 0x91, 0xF9, 0x19, 0xF3, 0xAE, 0x91, 0xFA, 0x3F, 0x91, 0xF9, 0x09, 0xAF, 0xC1, 0x9F, 0xFF,
+    0x2A, 0xFF, 0xDA, 0x3A, 0xFA, 0xAA, 0x96, 0xAE, 0xA7, 0x2A, 0xF7, 0x29, 0xFA, 0x3A, 0xC4, 0xFF,
+    0xE5, 0xFF, 0xD6, 0xAF, 0xDA, 0x97, 0x19, 0x97, 0x49, 0xD9, 0x1A, 0xD5, 0xF0, 0x9E, 0x94, 0xF0,
+    0xAE, 0x94, 0x9D, 0x2D, 0xA7, 0x77, 0x73, 0x9F, 0xD9, 0x5F, 0xFC, 0xA3, 0xFF, 0xE2, 0xFC, 0x91,
+    0xF9, 0x09, 0xF3, 0xAE, 0x90, 0xFA, 0x3F, 0x90, 0xF9, 0x09, 0xAF, 0xC0, 0x9F, 0xFF, 0x1A, 0xFF,
+    0xDA, 0x2A, 0xFA, 0xAA, 0x95, 0xAE, 0xA7, 0x1A, 0xF7, 0x19, 0xFA, 0x3A, 0xC3, 0xFF, 0xE4, 0xFF,
+    0xD5, 0xAF, 0xDA, 0x97, 0x09, 0x96, 0x29, 0x99, 0x94, 0xF9, 0x39, 0xEA, 0x4A, 0xE5, 0xE9, 0x59,
+    0x97, 0x5F, 0x39, 0xF3, 0xAF, 0x3F, 0xA3, 0xF9, 0x29, 0xF3, 0x9F, 0x3A, 0xEA, 0x3F, 0x93, 0xF9,
+    0x29, 0xF3, 0xAF, 0x3A, 0xEA, 0x3F, 0x93, 0xF3, 0x9F, 0x30, 0x69, 0x99, 0x99, 0x59, 0xF9, 0x5F,
+    0x95, 0xAE, 0x95, 0xAE, 0x79, 0x99, 0x77, 0x4F, 0x69, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6,
+    0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x60,
+    0x49, 0x99, 0x96, 0xFD, 0x4F, 0xE9, 0x2F, 0x0A, 0xE1, 0xEA, 0x2A, 0xDA, 0x09, 0x95, 0x99, 0x97,
+    0x7F, 0x69, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6, 0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF9, 0x59,
+    0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x60, 0x19, 0xD9, 0x1A, 0xCA, 0x2F, 0x09, 0xE9,
+    0x1F, 0x0A, 0xE2, 0x9D, 0x2D, 0xA7, 0x77, 0x4F, 0x69, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x59, 0xF6,
+    0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6, 0x9F, 0x60,
+    0x77, 0x6D, 0x92, 0xAC, 0x69, 0xEA, 0xAE, 0x95, 0xAF, 0xE9, 0x7A, 0xFC, 0x70, 0xFE, 0x96, 0xFA,
+    0xF7, 0xC9, 0x1A, 0xE9, 0x72, 0x9E, 0xA4, 0xAF, 0xA0, 0xEA, 0x29, 0xFF, 0xF2, 0xFF, 0xFC, 0x1F,
+    0xC9, 0x1F, 0xD0, 0x9F, 0x93, 0xFA, 0x0A, 0xF4, 0xFA, 0x0F, 0xA4, 0xF9, 0x0F, 0x93, 0x9F, 0x1F,
+    0x93, 0xAF, 0x1F, 0x93, 0xFA, 0x1A, 0xF2, 0xFC, 0x29, 0xFF, 0xE9, 0x3A, 0xFF, 0xC9, 0x59, 0xFD,
+    0xA7, 0x29, 0x97, 0x00, 0x77, 0x70, 0x9E, 0x92, 0xD9, 0x59, 0xFD, 0xAE, 0x6F, 0xFD, 0xA5, 0x9D,
+    0x19, 0xFA, 0x79, 0x94, 0x97, 0x77, 0x1E, 0x1A, 0xF9, 0x59, 0xE0, 0xAF, 0xD9, 0x4A, 0xEA, 0xFF,
+    0x4F, 0xD9, 0x9F, 0xC4, 0xFC, 0x29, 0xF4, 0xFA, 0x3F, 0x39, 0xF3, 0x9F, 0x3A, 0xEA, 0x3A, 0xEA,
+    0x3F, 0x93, 0xF9, 0x3F, 0x4F, 0x92, 0x9F, 0x4F, 0x3A, 0xF3, 0x9F, 0x3A, 0xEA, 0x3A, 0xEA, 0x3F,
+    0x93, 0xF9, 0x3F, 0x4F, 0x39, 0xF3, 0x9F, 0x30, 0x59, 0x99, 0x97, 0x2F, 0x97, 0x19, 0xEA, 0x72,
+    0xAE, 0x73, 0xE9, 0x73, 0x99, 0x77, 0x7A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99,
+    0xAF, 0x90, 0xAF, 0x92, 0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F,
+    0xAA, 0xEA, 0x4F, 0x9A, 0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA,
+    0x3F, 0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x19, 0x70, 0x71, 0x99, 0x99, 0x97, 0x09, 0xF9, 0x70, 0xF9,
+    0x70, 0xF9, 0x70, 0xAE, 0x72, 0x99, 0x97, 0x77, 0x0A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2,
+    0xFC, 0x99, 0xAF, 0x90, 0xAF, 0x92, 0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA,
+    0xEA, 0x4F, 0xAA, 0xEA, 0x4F, 0x9A, 0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2,
+    0xFF, 0xEA, 0x3F, 0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x19, 0x70, 0x79, 0x99, 0x97, 0x1F, 0xD7, 0xFE,
+    0x95, 0xF0, 0xAE, 0x4E, 0xA2, 0xEA, 0x39, 0x95, 0x99, 0x97, 0x73, 0xAF, 0xCA, 0x59, 0xFF, 0xC3,
+    0x9F, 0xFE, 0x2F, 0xC9, 0x9A, 0xF9, 0x0A, 0xF9, 0x2F, 0xA0, 0xFA, 0x3A, 0xF9, 0xF4, 0xAF, 0x9F,
+    0x4A, 0xEA, 0xAE, 0xA4, 0xFA, 0xAE, 0xA4, 0xF9, 0xAE, 0xA3, 0x9F, 0x0A, 0xF3, 0xFA, 0x09, 0xFA,
+    0x09, 0xFC, 0x2F, 0xFE, 0xA3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x71, 0x97, 0x77, 0x5E, 0xA2, 0xAC,
+    0xA4, 0xFD, 0xAA, 0xD9, 0x3A, 0xFF, 0xD4, 0xD9, 0x1A, 0xF5, 0x99, 0x49, 0x97, 0x77, 0xAF, 0xCA,
+    0x69, 0xFF, 0xC4, 0x9F, 0xFE, 0x3F, 0xC9, 0x9A, 0xF9, 0x1A, 0xF9, 0x2F, 0xA1, 0xFA, 0x3A, 0xF0,
+    0x9F, 0x4A, 0xF0, 0x9F, 0x4A, 0xEA, 0x0A, 0xEA, 0x4F, 0xA0, 0xAE, 0xA4, 0xF9, 0x0A, 0xEA, 0x39,
+    0xF1, 0xAF, 0x3F, 0xA1, 0x9F, 0xA0, 0x9F, 0xC3, 0xFF, 0xEA, 0x4F, 0xFC, 0xA6, 0xAF, 0xCA, 0x97,
+    0x29, 0x70, 0x49, 0xD9, 0x1A, 0xCA, 0x5F, 0x09, 0xE9, 0x4E, 0xA0, 0xAE, 0x59, 0xD2, 0xDA, 0x77,
+    0x77, 0x3A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99, 0xAF, 0x90, 0xAF, 0x92, 0xFA,
+    0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F, 0xAA, 0xEA, 0x4F, 0x9A, 0xEA,
+    0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA, 0x3F, 0xFC, 0xA5, 0xAF, 0xCA,
+    0x97, 0x19, 0x70, 0x69, 0x74, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xE9, 0x72, 0xAC, 0xA7, 0x74, 0x9F,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x79,
+    0x97, 0x3E, 0x97, 0x19, 0xEA, 0x71, 0x9E, 0x97, 0x2A, 0xCA, 0x50, 0x75, 0x97, 0xAF, 0xCA, 0xDA,
+    0x49, 0xFF, 0xDA, 0x39, 0xFF, 0xE4, 0xFC, 0x90, 0xAF, 0x92, 0xAF, 0x2F, 0xCA, 0x2F, 0x91, 0xFE,
+    0x19, 0xF1, 0xAF, 0xE1, 0x9E, 0xA0, 0xAD, 0xAA, 0xEA, 0x1A, 0xEA, 0x9E, 0x0A, 0xEA, 0x1A, 0xEA,
+    0xE1, 0xF9, 0x1A, 0xFD, 0x19, 0xF2, 0xAF, 0xC9, 0x1F, 0xA2, 0x9F, 0xC1, 0xAF, 0x4F, 0xFE, 0xA3,
+    0x9F, 0xFD, 0xA4, 0xEA, 0xFC, 0xA9, 0x5A, 0xC9, 0x29, 0x77, 0x71, 0x59, 0x99, 0x97, 0x4F, 0xA7,
+    0x4F, 0x74, 0x9E, 0x97, 0x49, 0xE7, 0x59, 0x99, 0x77, 0x79, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F, 0x2F,
+    0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F, 0x93,
+    0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90, 0xAF,
+    0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x72, 0x99, 0x99,
+    0x73, 0xFA, 0x72, 0xAE, 0xA7, 0x29, 0xEA, 0x73, 0xE9, 0x74, 0x99, 0x77, 0x71, 0x9F, 0x4F, 0x2A,
+    0xEA, 0x39, 0xF2, 0xFA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA,
+    0x3A, 0xF2, 0xF9, 0x3F, 0xA2, 0xF4, 0xF9, 0x2F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0x29, 0xFA,
+    0x29, 0xF9, 0x0A, 0xFC, 0x93, 0xFF, 0xAE, 0x93, 0xFE, 0x99, 0xE5, 0xFC, 0x90, 0x9E, 0x79, 0x73,
+    0x79, 0x99, 0x99, 0x72, 0xAF, 0xC7, 0x1A, 0xFE, 0x7A, 0xE9, 0x9E, 0x95, 0xAE, 0x29, 0xE5, 0x99,
+    0x95, 0x99, 0x77, 0x49, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92,
+    0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F,
+    0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9,
+    0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x5A, 0xCA, 0x19, 0xD9, 0x6A, 0xE1, 0xEA, 0x6A, 0xE1,
+    0xEA, 0x7D, 0x91, 0xAC, 0xA7, 0x77, 0x76, 0x9F, 0x4F, 0x2A, 0xEA, 0x39, 0xF2, 0xFA, 0x3A, 0xEA,
+    0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xF2, 0xF9, 0x3F, 0xA2, 0xF4,
+    0xF9, 0x2F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0x29, 0xFA, 0x29, 0xF9, 0x0A, 0xFC, 0x93, 0xFF,
+    0xAE, 0x93, 0xFE, 0x99, 0xE5, 0xFC, 0x90, 0x9E, 0x79, 0x73, 0x74, 0x99, 0x99, 0x76, 0xAF, 0x75,
+    0x9F, 0x76, 0xF7, 0x6E, 0xA7, 0x79, 0x99, 0x77, 0x76, 0x9E, 0xA5, 0xF9, 0x39, 0xF4, 0xAF, 0x5F,
+    0x4F, 0x95, 0xF3, 0xAF, 0x6F, 0x3F, 0x96, 0xF2, 0xAF, 0x7A, 0xE9, 0x1F, 0x70, 0x9E, 0x90, 0xAE,
+    0xA7, 0x09, 0xEA, 0x0F, 0x72, 0xEA, 0x9E, 0xA7, 0x2E, 0xAF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74,
+    0xAF, 0xCA, 0x74, 0x9F, 0xC7, 0x59, 0xF9, 0x75, 0x9F, 0x76, 0xF9, 0x75, 0xFC, 0x72, 0xAA, 0xAF,
+    0xC7, 0x3F, 0xE9, 0x73, 0xFD, 0x97, 0x4F, 0xA7, 0x50, 0x77, 0x7F, 0x97, 0x4F, 0x74, 0x9F, 0x74,
+    0xAF, 0x74, 0xFA, 0x74, 0xF9, 0x74, 0xF0, 0xAF, 0x69, 0xFF, 0xE5, 0xAF, 0xFE, 0xA4, 0xFD, 0x99,
+    0xFC, 0x4F, 0xC2, 0xAF, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x3A, 0xE9, 0x39, 0xF3, 0xF4, 0xAF,
+    0x3F, 0x4F, 0xA2, 0x9F, 0x39, 0xF9, 0x2A, 0xF9, 0x2F, 0xC3, 0xAF, 0xC9, 0x9F, 0xC9, 0x3F, 0xFF,
+    0xA4, 0xFA, 0xFE, 0x49, 0xF0, 0xAF, 0xA5, 0xAE, 0xA2, 0x97, 0x0F, 0xA7, 0x4F, 0x97, 0x4F, 0x74,
+    0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x40, 0x79, 0xD2, 0xDA, 0x72, 0xEA, 0x0A, 0xE7, 0x19, 0xEA,
+    0x0F, 0x72, 0xAC, 0xA1, 0x9D, 0x97, 0x77, 0x77, 0x69, 0xEA, 0x5F, 0x93, 0x9F, 0x4A, 0xF5, 0xF4,
+    0xF9, 0x5F, 0x3A, 0xF6, 0xF3, 0xF9, 0x6F, 0x2A, 0xF7, 0xAE, 0x91, 0xF7, 0x09, 0xE9, 0x0A, 0xEA,
+    0x70, 0x9E, 0xA0, 0xF7, 0x2E, 0xA9, 0xEA, 0x72, 0xEA, 0xF7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x4A,
+    0xFC, 0xA7, 0x49, 0xFC, 0x75, 0x9F, 0x97, 0x59, 0xF7, 0x6F, 0x97, 0x5F, 0xC7, 0x2A, 0xAA, 0xFC,
+    0x73, 0xFE, 0x97, 0x3F, 0xD9, 0x74, 0xFA, 0x75, 0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xA7, 0x2F, 0xFC,
+    0x72, 0xFF, 0xC7, 0x29, 0x99, 0x99, 0x99, 0x97, 0x77, 0x70, 0xFC, 0x97, 0x4A, 0xFC, 0xA7, 0x4F,
+    0xDA, 0x73, 0xAF, 0xE7, 0x3F, 0xAE, 0x72, 0xAE, 0x9A, 0xE7, 0x2F, 0x0A, 0xE7, 0x1A, 0xE9, 0x0A,
+    0xE7, 0x1F, 0x19, 0xE9, 0x7A, 0xE9, 0x19, 0xE9, 0x69, 0xF2, 0x9E, 0xA6, 0xF9, 0x29, 0xEA, 0x59,
+    0xFA, 0xAA, 0xAA, 0xEA, 0x5F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD4, 0xFF, 0xFE, 0x39, 0xF6, 0xF3, 0xFA,
+    0x6F, 0x29, 0xF7, 0xF9, 0x1F, 0xA7, 0xF9, 0x09, 0xF7, 0x0A, 0xEA, 0x00, 0x5A, 0xAA, 0xAA, 0xAA,
+    0xA6, 0xAF, 0xF9, 0x5F, 0xFC, 0x69, 0x99, 0x99, 0x99, 0x99, 0x77, 0x6F, 0xC1, 0xAD, 0xA2, 0x9F,
+    0xE0, 0xEA, 0x19, 0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F, 0xC1, 0xFC, 0x3A, 0xEA,
+    0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F, 0x1A, 0xF3, 0xFA, 0x1A,
+    0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A, 0xF9, 0x0E, 0xA6,
+    0x97, 0x20, 0x71, 0x99, 0x49, 0x99, 0x70, 0x9D, 0x93, 0xDA, 0x70, 0x9E, 0xAA, 0xAE, 0x72, 0xFF,
+    0xA7, 0x3F, 0xD9, 0x76, 0x99, 0x77, 0x77, 0x3F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A,
+    0xFE, 0x73, 0xFA, 0xE7, 0x2A, 0xE9, 0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1,
+    0x9E, 0x97, 0xAE, 0x91, 0x9E, 0x96, 0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA,
+    0xAE, 0xA5, 0xFF, 0xFD, 0x49, 0xFF, 0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F,
+    0x7F, 0x91, 0xFA, 0x7F, 0x90, 0x9F, 0x70, 0xAE, 0xA0, 0x49, 0x99, 0x49, 0x95, 0xE3, 0xAD, 0x5F,
+    0xAA, 0xEA, 0x59, 0xFF, 0x79, 0xFD, 0x73, 0x99, 0x77, 0x71, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E,
+    0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9,
+    0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29,
+    0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x72,
+    0x72, 0xFC, 0x97, 0x3A, 0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71, 0xAE, 0x9A,
+    0xE7, 0x1F, 0x0A, 0xE7, 0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19, 0xE9, 0x59,
+    0xF2, 0x9E, 0xA5, 0xF9, 0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF,
+    0xD3, 0xFF, 0xFE, 0x29, 0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9, 0x9F, 0x70,
+    0xAE, 0xA7, 0x49, 0xDA, 0x75, 0xAD, 0xA7, 0x59, 0xDA, 0x76, 0xAD, 0x97, 0x6F, 0xAA, 0x74, 0x9F,
+    0xC7, 0x5A, 0xEA, 0x77, 0x40, 0x77, 0x4F, 0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19, 0xFF, 0xF9,
+    0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F, 0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F,
+    0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F, 0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9,
+    0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A, 0xF9, 0x0E, 0xA6, 0x92, 0xAD, 0x97, 0x2E, 0x97,
+    0x2A, 0xD9, 0x73, 0xE7, 0x4F, 0xA9, 0x71, 0xFC, 0x97, 0x2A, 0xE9, 0x77, 0x30, 0x74, 0x99, 0x99,
+    0x75, 0xAF, 0x74, 0x9F, 0x75, 0xF7, 0x5E, 0xA7, 0x69, 0x99, 0x77, 0x77, 0x0A, 0xFD, 0xA9, 0x7A,
+    0xFF, 0xE5, 0xFF, 0xFA, 0x4F, 0xEA, 0xAF, 0x4F, 0xD5, 0xAA, 0x39, 0xFA, 0x74, 0xFC, 0x74, 0x9F,
+    0x97, 0x4A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x5F, 0x97, 0x49, 0xF9, 0x74, 0x9F, 0x97, 0x5F, 0x97,
+    0x5F, 0xA7, 0x5F, 0xC9, 0x59, 0x59, 0xFC, 0xA9, 0x9A, 0xAD, 0x6F, 0xFF, 0x7F, 0xFE, 0x70, 0x9F,
+    0xEA, 0x97, 0x39, 0x99, 0x70, 0x70, 0x99, 0x99, 0x97, 0x1F, 0xA7, 0x0F, 0xA7, 0x0A, 0xE9, 0x70,
+    0x9E, 0x97, 0x19, 0x99, 0x77, 0x71, 0xAF, 0xDA, 0x49, 0xFF, 0xC4, 0xFF, 0xCA, 0x3F, 0xCA, 0x99,
+    0xAC, 0x92, 0xAF, 0x97, 0x0F, 0xA7, 0x09, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1A,
+    0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xC9, 0x99, 0xAC, 0x4F, 0xFD, 0x49, 0xFF, 0xC6, 0xFE, 0x97, 0x09,
+    0x97, 0x71, 0x99, 0x99, 0x97, 0x49, 0xFC, 0x97, 0x29, 0xFE, 0x71, 0x9E, 0xA0, 0xEA, 0x7A, 0xE9,
+    0x2E, 0x96, 0x99, 0x95, 0x99, 0x77, 0x74, 0xAF, 0xDA, 0x97, 0xAF, 0xFE, 0x5F, 0xFF, 0xA4, 0xFE,
+    0xAA, 0xF4, 0xFD, 0x5A, 0xA3, 0x9F, 0xA7, 0x4F, 0xC7, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFA, 0x75,
+    0xF9, 0x75, 0xF9, 0x74, 0x9F, 0x97, 0x49, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75, 0xFC, 0x95, 0x95,
+    0x9F, 0xCA, 0x99, 0xAA, 0xD6, 0xFF, 0xF7, 0xFF, 0xE7, 0x09, 0xFE, 0xA9, 0x73, 0x99, 0x97, 0x00,
+    0x69, 0x99, 0x97, 0x1F, 0xD7, 0xFE, 0xA5, 0xF0, 0x9E, 0x4E, 0xA2, 0xAE, 0x39, 0x99, 0x49, 0x99,
+    0x77, 0x4A, 0xFD, 0xA4, 0x9F, 0xFC, 0x4F, 0xFC, 0xA3, 0xFC, 0xA9, 0x9A, 0xC9, 0x2A, 0xF9, 0x70,
+    0xFA, 0x70, 0x9F, 0x97, 0x09, 0xF7, 0x1A, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1A, 0xF7, 0x19,
+    0xFC, 0x99, 0x9A, 0xC4, 0xFF, 0xD4, 0x9F, 0xFC, 0x6F, 0xE9, 0x70, 0x99, 0x70, 0x77, 0x74, 0x9E,
+    0x97, 0x5F, 0xC7, 0x5F, 0xA7, 0x5A, 0xE7, 0x77, 0x77, 0x72, 0xAF, 0xDA, 0x97, 0xAF, 0xFE, 0x5F,
+    0xFF, 0xA4, 0xFE, 0xAA, 0xF4, 0xFD, 0x5A, 0xA3, 0x9F, 0xA7, 0x4F, 0xC7, 0x49, 0xF9, 0x74, 0xAF,
+    0x75, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x74, 0x9F, 0x97, 0x49, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75,
+    0xFC, 0x95, 0x95, 0x9F, 0xCA, 0x99, 0xAA, 0xD6, 0xFF, 0xF7, 0xFF, 0xE7, 0x09, 0xFE, 0xA9, 0x73,
+    0x99, 0x97, 0x00, 0x77, 0x4A, 0xE7, 0x09, 0xF9, 0x79, 0xF7, 0x1E, 0xA7, 0x77, 0x73, 0xAF, 0xDA,
+    0x39, 0xFF, 0xC3, 0xFF, 0xCA, 0x2F, 0xCA, 0x99, 0xAC, 0x91, 0xAF, 0x97, 0xFA, 0x79, 0xF9, 0x79,
+    0xF7, 0x0A, 0xF7, 0x0A, 0xEA, 0x70, 0xAE, 0xA7, 0x0A, 0xF7, 0x09, 0xFC, 0x99, 0x9A, 0xC3, 0xFF,
+    0xD3, 0x9F, 0xFC, 0x5F, 0xE9, 0x79, 0x96, 0x69, 0x99, 0x59, 0x97, 0xAE, 0x2A, 0xE7, 0x0E, 0xA0,
+    0xF7, 0x19, 0xFE, 0x73, 0xFD, 0x75, 0x99, 0x99, 0x77, 0x77, 0xAF, 0xDA, 0x97, 0xAF, 0xFE, 0x5F,
+    0xFF, 0xA4, 0xFE, 0xAA, 0xF4, 0xFD, 0x5A, 0xA3, 0x9F, 0xA7, 0x4F, 0xC7, 0x49, 0xF9, 0x74, 0xAF,
+    0x75, 0xFA, 0x75, 0xF9, 0x75, 0xF9, 0x74, 0x9F, 0x97, 0x49, 0xF9, 0x75, 0xF9, 0x75, 0xFA, 0x75,
+    0xFC, 0x95, 0x95, 0x9F, 0xCA, 0x99, 0xAA, 0xD6, 0xFF, 0xF7, 0xFF, 0xE7, 0x09, 0xFE, 0xA9, 0x73,
+    0x99, 0x97, 0x00, 0x39, 0x95, 0x99, 0x94, 0xE9, 0x2E, 0xA4, 0x9E, 0x09, 0xEA, 0x6F, 0xEA, 0x79,
+    0xFC, 0xA7, 0x19, 0x99, 0x99, 0x77, 0x71, 0xAF, 0xDA, 0x59, 0xFF, 0xC5, 0xFF, 0xCA, 0x4F, 0xCA,
+    0x99, 0xAC, 0x93, 0xAF, 0x97, 0x1F, 0xA7, 0x19, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7,
+    0x2A, 0xEA, 0x72, 0xAF, 0x72, 0x9F, 0xC9, 0x99, 0xAC, 0x5F, 0xFD, 0x59, 0xFF, 0xC7, 0xFE, 0x97,
+    0x19, 0x97, 0x00, 0x79, 0x99, 0x49, 0x99, 0x70, 0xEA, 0x2A, 0xE7, 0x1E, 0x90, 0xF7, 0x2A, 0xFE,
+    0x74, 0xFD, 0x75, 0x99, 0x99, 0x97, 0x77, 0x5F, 0xEA, 0x97, 0x2F, 0xFD, 0xA7, 0x9F, 0xFF, 0x6A,
+    0xFF, 0xFA, 0x5F, 0xA2, 0x9F, 0xC5, 0xF9, 0x39, 0xFA, 0x4F, 0x5F, 0xA3, 0x9F, 0x5A, 0xF3, 0xAF,
+    0x5A, 0xF3, 0xFA, 0x5A, 0xF3, 0xF9, 0x5F, 0xA3, 0xF6, 0xFA, 0x29, 0xF5, 0x9F, 0x92, 0xAF, 0x5A,
+    0xF3, 0xFA, 0x49, 0xFA, 0x3F, 0x94, 0xFC, 0x39, 0xF3, 0x9F, 0xCA, 0x39, 0xFA, 0xAF, 0xEA, 0x4A,
+    0xFF, 0xFA, 0x5F, 0xFF, 0x96, 0xFF, 0xCA, 0x70, 0x77, 0x77, 0x39, 0xF1, 0xF7, 0x49, 0xF0, 0x9E,
+    0x97, 0x4A, 0xEA, 0x0E, 0xA7, 0x5F, 0x90, 0xE7, 0x6F, 0x1A, 0xA7, 0x69, 0xF7, 0x4F, 0xC0, 0x9E,
+    0xA7, 0x29, 0xFE, 0xAE, 0xA7, 0x19, 0xFF, 0xF9, 0x71, 0xFC, 0xA9, 0xAF, 0xC7, 0x19, 0xF9, 0x2F,
+    0xC7, 0x1F, 0xC3, 0xAE, 0xA7, 0x1F, 0x93, 0xAE, 0x97, 0x09, 0xF4, 0xF9, 0x70, 0xAF, 0x4F, 0x71,
+    0xAE, 0xA3, 0x9F, 0x71, 0xAE, 0xA3, 0xAE, 0xA7, 0x1A, 0xF2, 0x9F, 0x97, 0x1A, 0xFA, 0x09, 0xFC,
+    0x73, 0xFF, 0xF7, 0x3A, 0xFE, 0xAE, 0x74, 0xAF, 0xA0, 0xEA, 0x76, 0x97, 0x72, 0x4F, 0xEA, 0x97,
+    0x1F, 0xFD, 0xA6, 0x9F, 0xFF, 0x5A, 0xFF, 0xFA, 0x4F, 0xA2, 0x9F, 0xC4, 0xF9, 0x39, 0xFA, 0x3F,
+    0x5F, 0xA2, 0x9F, 0x5A, 0xF2, 0xAF, 0x5A, 0xF0, 0xFF, 0xD2, 0xAF, 0x0F, 0xFC, 0xA2, 0xFA, 0x9F,
+    0xFC, 0x92, 0xFA, 0x0A, 0xFC, 0xAA, 0xA2, 0x9F, 0x91, 0xAF, 0x5A, 0xF2, 0xFA, 0x49, 0xFA, 0x2F,
+    0x94, 0xFC, 0x29, 0xF3, 0x9F, 0xCA, 0x29, 0xFA, 0xAF, 0xEA, 0x3A, 0xFF, 0xFA, 0x4F, 0xFF, 0x95,
+    0xFF, 0xCA, 0x70, 0x77, 0x76, 0x9F, 0x75, 0xAF, 0x71, 0xFF, 0xDA, 0x7F, 0xFD, 0xA6, 0x9F, 0xFD,
+    0x97, 0x29, 0xF7, 0x09, 0x99, 0x19, 0xEA, 0x6A, 0xFC, 0x0A, 0xEA, 0x5A, 0xFF, 0xE9, 0x4A, 0xFF,
+    0xF5, 0xFC, 0x90, 0x9F, 0xC4, 0xAF, 0x3F, 0xA4, 0xF9, 0x3A, 0xE9, 0x39, 0xF4, 0xAE, 0x4A, 0xF4,
+    0xF4, 0xAE, 0xA4, 0xF4, 0xAE, 0xA3, 0xAE, 0xA4, 0xAF, 0x3F, 0x94, 0xAF, 0xA0, 0x9F, 0xC6, 0xFF,
+    0xF6, 0xAF, 0xDA, 0xAE, 0x7A, 0xFA, 0x0A, 0xDA, 0x71, 0x99, 0x74, 0x69, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x7F, 0xFC, 0x7F, 0xFC, 0x79, 0x99, 0x99, 0x99, 0x97, 0x77, 0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x9F,
+    0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0xAA, 0xAA, 0xAA,
+    0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73, 0xF9, 0x72,
+    0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F, 0xFE, 0xA4, 0xFF, 0xEA, 0x30, 0x49,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFC, 0x5F, 0xFC, 0x59, 0x99, 0x99, 0x99, 0x97, 0x75, 0x9F, 0xD9,
+    0x5F, 0xFC, 0xA3, 0xFF, 0xE2, 0xFC, 0x91, 0xF9, 0x09, 0xF3, 0xAE, 0x90, 0xFA, 0x3F, 0x90, 0xF9,
+    0x09, 0xAF, 0xC0, 0x9F, 0xFF, 0x1A, 0xFF, 0xDA, 0x2A, 0xFA, 0xAA, 0x95, 0xAE, 0xA7, 0x1A, 0xF7,
+    0x19, 0xFA, 0x3A, 0xC3, 0xFF, 0xE4, 0xFF, 0xD5, 0xAF, 0xDA, 0x97, 0x09, 0x96, 0x69, 0x95, 0x99,
+    0x7D, 0xA3, 0xE7, 0xFA, 0xAE, 0x97, 0xAF, 0xF7, 0x1A, 0xFC, 0xA7, 0x49, 0x97, 0x77, 0x4F, 0xFE,
+    0xA5, 0xFF, 0xEA, 0x49, 0xFF, 0xE9, 0x4A, 0xFF, 0xE5, 0xFA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7,
+    0x4A, 0xFA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE6, 0xFF, 0xE5, 0x9F, 0x74, 0xAE, 0xA7,
+    0x4F, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xFA, 0xAA, 0xAA, 0xAA, 0x5A, 0xFF, 0xE5, 0xFF, 0xEA,
+    0x5F, 0xFE, 0xA4, 0x49, 0x94, 0x99, 0x93, 0x9D, 0x93, 0xDA, 0x4E, 0xAA, 0xAE, 0x94, 0xFF, 0xA6,
+    0xAF, 0xCA, 0x71, 0x99, 0x77, 0x70, 0x9F, 0xD9, 0x5F, 0xFC, 0xA3, 0xFF, 0xE2, 0xFC, 0x91, 0xF9,
+    0x09, 0xF3, 0xAE, 0x90, 0xFA, 0x3F, 0x90, 0xF9, 0x09, 0xAF, 0xC0, 0x9F, 0xFF, 0x1A, 0xFF, 0xDA,
+    0x2A, 0xFA, 0xAA, 0x95, 0xAE, 0xA7, 0x1A, 0xF7, 0x19, 0xFA, 0x3A, 0xC3, 0xFF, 0xE4, 0xFF, 0xD5,
+    0xAF, 0xDA, 0x97, 0x09, 0x96, 0x77, 0x72, 0xEA, 0x73, 0xAF, 0x73, 0xAF, 0x73, 0x9E, 0x97, 0x77,
+    0x77, 0x1F, 0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73,
+    0xF7, 0x39, 0xF7, 0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F,
+    0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF,
+    0xE4, 0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x77, 0x6F, 0x71, 0xAF, 0x71, 0xAF, 0x72, 0xE9, 0x77, 0x77,
+    0x59, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9, 0x1F, 0x90, 0x9F, 0x3A, 0xE9, 0x0F, 0xA3,
+    0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF, 0xFD, 0xA2, 0xAF, 0xAA, 0xA9, 0x5A, 0xEA,
+    0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F, 0xFD, 0x5A, 0xFD, 0xA9, 0x70, 0x99, 0x60,
+    0x4F, 0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0x73,
+    0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4,
+    0xFF, 0xEA, 0x4F, 0xFE, 0xA7, 0x3E, 0x74, 0xE7, 0x4E, 0x74, 0x9E, 0x74, 0x9E, 0xAA, 0x73, 0xFC,
+    0x73, 0x9F, 0x77, 0x60, 0x77, 0x39, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9, 0x1F, 0x90,
+    0x9F, 0x3A, 0xE9, 0x0F, 0xA3, 0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF, 0xFD, 0xA2,
+    0xAF, 0xAA, 0xA9, 0x5A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F, 0xFD, 0x5A,
+    0xFE, 0x97, 0x09, 0xE7, 0x2E, 0x72, 0xE7, 0x3E, 0x73, 0xEA, 0xA7, 0x1F, 0xC9, 0x71, 0xAE, 0x40,
+    0x69, 0x95, 0x99, 0x97, 0xE2, 0x9E, 0x97, 0xAE, 0x0A, 0xE9, 0x71, 0xFE, 0x97, 0x29, 0xFC, 0x97,
+    0x49, 0x99, 0x99, 0x77, 0x74, 0xFF, 0xEA, 0x6F, 0xFE, 0xA5, 0x9F, 0xFE, 0x95, 0xAF, 0xFE, 0x6F,
+    0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAF, 0xAA, 0xAA, 0xAA, 0x96, 0xFF, 0xE9, 0x6F, 0xFE,
+    0x7F, 0xFE, 0x69, 0xF7, 0x5A, 0xEA, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75, 0x9F, 0xAA, 0xAA,
+    0xAA, 0xA6, 0xAF, 0xFE, 0x6F, 0xFE, 0xA6, 0xFF, 0xEA, 0x50, 0x49, 0x95, 0x99, 0x95, 0xE2, 0x9E,
+    0xA5, 0xAE, 0x0A, 0xE9, 0x7F, 0xE9, 0x70, 0x9F, 0xCA, 0x72, 0x99, 0x99, 0x97, 0x77, 0x29, 0xFD,
+    0x97, 0xFF, 0xCA, 0x5F, 0xFE, 0x4F, 0xC9, 0x1F, 0x92, 0x9F, 0x3A, 0xE9, 0x2F, 0xA3, 0xF9, 0x2F,
+    0x90, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xFD, 0xA4, 0xAF, 0xAA, 0xA9, 0x7A, 0xEA, 0x73, 0xAF,
+    0x73, 0x9F, 0xA3, 0xAC, 0x5F, 0xFE, 0x6F, 0xFD, 0x7A, 0xFD, 0xA9, 0x72, 0x99, 0x70, 0x72, 0x99,
+    0x99, 0x97, 0x4A, 0xFC, 0x73, 0xAF, 0xDA, 0x71, 0xAE, 0x99, 0xE9, 0x7F, 0x29, 0xE7, 0x99, 0x94,
+    0x99, 0x97, 0x77, 0x39, 0xFE, 0xA9, 0x6A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC4, 0xFE, 0xAA, 0xAE, 0xA3,
+    0xAF, 0xC9, 0x5A, 0x92, 0x9F, 0xC7, 0x4F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x75, 0xFA, 0x3A, 0xAA,
+    0xAA, 0xAA, 0xA1, 0xFA, 0x29, 0xFE, 0xA1, 0xF9, 0x2A, 0xFE, 0x90, 0x9F, 0x92, 0xAF, 0xE1, 0x9F,
+    0x95, 0x9F, 0x2F, 0x95, 0xAE, 0xA2, 0xFA, 0x5F, 0x92, 0xFC, 0x94, 0xF3, 0x9F, 0xCA, 0x99, 0xAF,
+    0xC4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFE, 0xA6, 0x9F, 0xFA, 0x97, 0x39, 0x97, 0x00, 0x70, 0x99, 0x99,
+    0x73, 0xFD, 0x71, 0xFE, 0xA7, 0xF0, 0x9E, 0x6E, 0xA2, 0xAE, 0x59, 0x99, 0x49, 0x99, 0x77, 0x69,
+    0xFC, 0x1A, 0xDA, 0x39, 0xFE, 0x0E, 0xA2, 0x9F, 0xFF, 0x92, 0xFC, 0xA9, 0xAF, 0xC2, 0x9F, 0x92,
+    0xFC, 0x2F, 0xC3, 0xAE, 0xA2, 0xF9, 0x3A, 0xEA, 0x19, 0xF4, 0xF9, 0x1A, 0xF4, 0xF2, 0xAF, 0x39,
+    0xF2, 0xAF, 0x3F, 0xA2, 0xAF, 0x2A, 0xF9, 0x2A, 0xFA, 0x9A, 0xFC, 0x39, 0xFF, 0xF4, 0xFE, 0xAF,
+    0x5A, 0xF0, 0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0xFC, 0x39, 0xDA, 0x99, 0xAF, 0xC9, 0x39, 0xFF,
+    0xDA, 0x49, 0xFF, 0xCA, 0x69, 0xAF, 0xCA, 0x70, 0x79, 0x99, 0x49, 0x97, 0x0E, 0x3A, 0xD7, 0x0A,
+    0xEA, 0xAF, 0x70, 0x9F, 0xF7, 0x29, 0xFD, 0x76, 0x99, 0x77, 0x77, 0x9F, 0xEA, 0x96, 0xAF, 0xFE,
+    0xA4, 0xFF, 0xFC, 0x4F, 0xEA, 0xAA, 0xEA, 0x3A, 0xFC, 0x95, 0xA9, 0x29, 0xFC, 0x74, 0xFC, 0x74,
+    0x9F, 0xA7, 0x4A, 0xF7, 0x5F, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xA2, 0x9F, 0xEA, 0x1F, 0x92,
+    0xAF, 0xE9, 0x09, 0xF9, 0x2A, 0xFE, 0x19, 0xF9, 0x59, 0xF2, 0xF9, 0x5A, 0xEA, 0x2F, 0xA5, 0xF9,
+    0x2F, 0xC9, 0x4F, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x4A, 0xFF, 0xFC, 0x5A, 0xFF, 0xEA, 0x69, 0xFF,
+    0xA9, 0x73, 0x99, 0x70, 0x59, 0x95, 0x99, 0x6D, 0xA3, 0xE6, 0xFA, 0xAE, 0xA6, 0x9F, 0xF7, 0x0A,
+    0xFC, 0xA7, 0x39, 0x99, 0x77, 0x72, 0x9F, 0xC1, 0xAD, 0xA3, 0x9F, 0xE0, 0xEA, 0x29, 0xFF, 0xF9,
+    0x2F, 0xCA, 0x9A, 0xFC, 0x29, 0xF9, 0x2F, 0xC2, 0xFC, 0x3A, 0xEA, 0x2F, 0x93, 0xAE, 0xA1, 0x9F,
+    0x4F, 0x91, 0xAF, 0x4F, 0x2A, 0xF3, 0x9F, 0x2A, 0xF3, 0xFA, 0x2A, 0xF2, 0xAF, 0x92, 0xAF, 0xA9,
+    0xAF, 0xC3, 0x9F, 0xFF, 0x4F, 0xEA, 0xF5, 0xAF, 0x0A, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x3F, 0xC3,
+    0x9D, 0xA9, 0x9A, 0xFC, 0x93, 0x9F, 0xFD, 0xA4, 0x9F, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x77, 0x75,
+    0xAE, 0x76, 0xF9, 0x74, 0x9F, 0x97, 0x5E, 0xA7, 0x77, 0x77, 0x71, 0x9F, 0xEA, 0x96, 0xAF, 0xFE,
+    0xA4, 0xFF, 0xFC, 0x4F, 0xEA, 0xAA, 0xEA, 0x3A, 0xFC, 0x95, 0xA9, 0x29, 0xFC, 0x74, 0xFC, 0x74,
+    0x9F, 0xA7, 0x4A, 0xF7, 0x5F, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xA2, 0x9F, 0xEA, 0x1F, 0x92,
+    0xAF, 0xE9, 0x09, 0xF9, 0x2A, 0xFE, 0x19, 0xF9, 0x59, 0xF2, 0xF9, 0x5A, 0xEA, 0x2F, 0xA5, 0xF9,
+    0x2F, 0xC9, 0x4F, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x4A, 0xFF, 0xFC, 0x5A, 0xFF, 0xEA, 0x69, 0xFF,
+    0xA9, 0x73, 0x99, 0x70, 0x77, 0x71, 0xF7, 0x39, 0xF9, 0x72, 0x9F, 0x74, 0xE9, 0x77, 0x77, 0x72,
+    0x9F, 0xC1, 0xAD, 0xA3, 0x9F, 0xE0, 0xEA, 0x29, 0xFF, 0xF9, 0x2F, 0xCA, 0x9A, 0xFC, 0x29, 0xF9,
+    0x2F, 0xC2, 0xFC, 0x3A, 0xEA, 0x2F, 0x93, 0xAE, 0xA1, 0x9F, 0x4F, 0x91, 0xAF, 0x4F, 0x2A, 0xF3,
+    0x9F, 0x2A, 0xF3, 0xFA, 0x2A, 0xF2, 0xAF, 0x92, 0xAF, 0xA9, 0xAF, 0xC3, 0x9F, 0xFF, 0x4F, 0xEA,
+    0xF5, 0xAF, 0x0A, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x3F, 0xC3, 0x9D, 0xA9, 0x9A, 0xFC, 0x93, 0x9F,
+    0xFD, 0xA4, 0x9F, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x77, 0x72, 0x9F, 0xEA, 0x96, 0xAF, 0xFE, 0xA4,
+    0xFF, 0xFC, 0x4F, 0xEA, 0xAA, 0xEA, 0x3A, 0xFC, 0x95, 0xA9, 0x29, 0xFC, 0x74, 0xFC, 0x74, 0x9F,
+    0xA7, 0x4A, 0xF7, 0x5F, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xA2, 0x9F, 0xEA, 0x1F, 0x92, 0xAF,
+    0xE9, 0x09, 0xF9, 0x2A, 0xFE, 0x19, 0xF9, 0x59, 0xF2, 0xF9, 0x5A, 0xEA, 0x2F, 0xA5, 0xF9, 0x2F,
+    0xC9, 0x4F, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x4A, 0xFF, 0xFC, 0x5A, 0xFF, 0xEA, 0x69, 0xFF, 0xA9,
+    0x73, 0x99, 0x77, 0x77, 0x1A, 0xE9, 0x75, 0xF7, 0x59, 0xE7, 0x6E, 0x97, 0x69, 0x99, 0x72, 0x72,
+    0x99, 0x97, 0x4A, 0xDA, 0x73, 0x9E, 0x74, 0xEA, 0x73, 0xAE, 0x97, 0x39, 0x99, 0x97, 0x77, 0x3F,
+    0xC1, 0xAD, 0xA3, 0x9F, 0xE0, 0xEA, 0x29, 0xFF, 0xF9, 0x2F, 0xCA, 0x9A, 0xFC, 0x29, 0xF9, 0x2F,
+    0xC2, 0xFC, 0x3A, 0xEA, 0x2F, 0x93, 0xAE, 0xA1, 0x9F, 0x4F, 0x91, 0xAF, 0x4F, 0x2A, 0xF3, 0x9F,
+    0x2A, 0xF3, 0xFA, 0x2A, 0xF2, 0xAF, 0x92, 0xAF, 0xA9, 0xAF, 0xC3, 0x9F, 0xFF, 0x4F, 0xEA, 0xF5,
+    0xAF, 0x0A, 0xEA, 0x73, 0xF9, 0x73, 0xF7, 0x3F, 0xC3, 0x9D, 0xA9, 0x9A, 0xFC, 0x93, 0x9F, 0xFD,
+    0xA4, 0x9F, 0xFC, 0xA6, 0x9A, 0xFC, 0xA7, 0x72, 0x99, 0x99, 0x97, 0x69, 0xFC, 0xA7, 0x49, 0xFE,
+    0x73, 0x9E, 0xA0, 0xEA, 0x71, 0x9E, 0x92, 0xE9, 0x70, 0x99, 0x95, 0x99, 0x77, 0x74, 0xF9, 0x5A,
+    0xE9, 0x4F, 0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x4A, 0xF5, 0xAF, 0x4F, 0xA5, 0xAE, 0xA4, 0xF9, 0x5F,
+    0x94, 0xF9, 0x5F, 0x49, 0xF5, 0x9F, 0x4A, 0xFA, 0xAA, 0xAA, 0xAF, 0xC4, 0xFF, 0xFE, 0xA4, 0xFF,
+    0xFE, 0x94, 0xFF, 0xFE, 0x49, 0xF5, 0x9F, 0x4A, 0xF5, 0xAE, 0xA4, 0xFA, 0x5F, 0xA4, 0xF9, 0x5F,
+    0x93, 0x9F, 0x59, 0xF4, 0x9F, 0x59, 0xF4, 0xAE, 0xA5, 0xAE, 0xA4, 0xF9, 0x5F, 0x94, 0xF9, 0x5F,
+    0x93, 0x59, 0x99, 0x99, 0x72, 0xFD, 0x71, 0xAF, 0xDA, 0x7A, 0xE9, 0x9E, 0x95, 0xF2, 0x9E, 0x59,
+    0x99, 0x49, 0x99, 0x77, 0x71, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73, 0xF9,
+    0x73, 0xF0, 0xAF, 0x94, 0x9E, 0xAF, 0xE9, 0x3A, 0xFF, 0xF3, 0xFD, 0x99, 0xFC, 0x3F, 0xC2, 0x9F,
+    0x29, 0xFA, 0x3F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x91,
+    0x9F, 0x4F, 0x2A, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3,
+    0x9F, 0x20, 0x4F, 0x95, 0xF9, 0x6F, 0x95, 0xF9, 0x59, 0xF5, 0x9F, 0x4F, 0xFF, 0xFF, 0x90, 0x9F,
+    0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xF4, 0xF6, 0xF9, 0x59, 0xF5, 0x9F, 0x6A, 0xFA, 0xAA, 0xAA, 0xAF,
+    0xC6, 0xFF, 0xFE, 0xA6, 0xFF, 0xFE, 0x96, 0xFF, 0xFE, 0x69, 0xF5, 0x9F, 0x6A, 0xF5, 0xAF, 0x6F,
+    0xA5, 0xFA, 0x6F, 0x95, 0xF9, 0x59, 0xF5, 0x9F, 0x6A, 0xF5, 0xAF, 0x6A, 0xEA, 0x5A, 0xEA, 0x6F,
+    0x95, 0xFA, 0x6F, 0x95, 0xF9, 0x50, 0x77, 0x4F, 0x97, 0x2F, 0x70, 0xAF, 0xFD, 0x4F, 0xFE, 0x4F,
+    0xFE, 0x6F, 0x97, 0x2F, 0x29, 0x95, 0x9F, 0x0A, 0xF9, 0x3A, 0xEA, 0xFE, 0x92, 0xFF, 0xFA, 0x2F,
+    0xD9, 0x0F, 0xC2, 0xFC, 0x29, 0xF1, 0x9F, 0x92, 0x9F, 0x1A, 0xF3, 0xAE, 0xA1, 0xFA, 0x3F, 0x91,
+    0xF4, 0xF9, 0x09, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAE, 0xA3, 0xAE, 0xA1, 0xF9, 0x3F, 0x91, 0xF4,
+    0xF1, 0x9F, 0x39, 0xF1, 0x77, 0x5E, 0xA2, 0xAC, 0xA4, 0xFD, 0xAA, 0xD9, 0x3A, 0xFF, 0xD4, 0xD9,
+    0x1A, 0xF5, 0x99, 0x49, 0x77, 0x79, 0xFF, 0xA5, 0xAF, 0xFA, 0x5F, 0xFC, 0x79, 0xFC, 0x97, 0x1F,
+    0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA,
+    0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x71, 0x9F, 0xC7, 0x0F, 0xFA, 0x5A, 0xFF, 0xA5,
+    0xAF, 0xF9, 0x50, 0x77, 0xEA, 0x2A, 0xD1, 0xFD, 0xAA, 0xD9, 0x0A, 0xFF, 0xD1, 0xDA, 0x1A, 0xF2,
+    0x99, 0x49, 0x97, 0x73, 0xF7, 0x9F, 0x7A, 0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x79, 0xF7, 0xAE, 0xA7,
+    0xF9, 0x7F, 0x96, 0x9F, 0x7A, 0xF7, 0xAE, 0xA7, 0xF9, 0x7F, 0x79, 0xF7, 0x49, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x5A, 0xFF, 0x5F, 0xFC, 0x59, 0x99, 0x99, 0x99, 0x99, 0x77, 0x39, 0xFF, 0xA4, 0xAF, 0xFA,
+    0x4F, 0xFC, 0x69, 0xFC, 0x97, 0x0F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9,
+    0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0x9F, 0x70, 0x9F,
+    0xC7, 0xFF, 0xA4, 0xAF, 0xFA, 0x4A, 0xFF, 0x94, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0x2F, 0xFC, 0x2F,
+    0xFC, 0x29, 0x99, 0x99, 0x99, 0x97, 0x71, 0xF6, 0x9F, 0x6A, 0xF6, 0xFA, 0x6F, 0x95, 0x9F, 0x69,
+    0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x95, 0x9F, 0x6A, 0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x69, 0xF6, 0x49,
+    0x95, 0x99, 0x5D, 0xA3, 0xE5, 0xFA, 0xAE, 0x95, 0xAF, 0xF7, 0xAF, 0xCA, 0x72, 0x99, 0x77, 0x71,
+    0x9F, 0xFA, 0x5A, 0xFF, 0xA5, 0xFF, 0xC7, 0x9F, 0xC9, 0x71, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A,
+    0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x2F, 0x97, 0x19,
+    0xF7, 0x29, 0xF7, 0x19, 0xFC, 0x70, 0xFF, 0xA5, 0xAF, 0xFA, 0x5A, 0xFF, 0x95, 0x19, 0x95, 0x99,
+    0x2D, 0xA3, 0xE2, 0xFA, 0xAE, 0xA2, 0xAF, 0xF4, 0xAF, 0xCA, 0x79, 0x97, 0x76, 0xF7, 0x9F, 0x7A,
+    0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x79, 0xF7, 0xAE, 0xA7, 0xF9, 0x7F, 0x96, 0x9F, 0x7A, 0xF7, 0xAE,
+    0xA7, 0xF9, 0x7F, 0x79, 0xF7, 0x39, 0xFF, 0xA3, 0xAF, 0xFA, 0x3F, 0xFC, 0x59, 0xFC, 0x97, 0xF9,
+    0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7,
+    0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0x9F, 0x79, 0xFC, 0x6F, 0xFA, 0x3A, 0xFF, 0xA3, 0xAF, 0xF9,
+    0x7A, 0xD9, 0x70, 0xE7, 0x1A, 0xD9, 0x71, 0xE7, 0x2F, 0xA9, 0x7F, 0xC9, 0x70, 0xF9, 0x77, 0x30,
+    0x77, 0x2A, 0xE6, 0x9F, 0x95, 0x9F, 0x7E, 0xA7, 0x77, 0x6F, 0x69, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9,
+    0x59, 0xF6, 0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF9, 0x59, 0xF6, 0xAF, 0x6A, 0xEA, 0x6F, 0x96, 0xF6,
+    0x9F, 0x7A, 0xD9, 0x6E, 0x96, 0xAD, 0x97, 0xE7, 0x0F, 0xA9, 0x5A, 0xFA, 0x6A, 0xE9, 0x77, 0x00,
+    0x77, 0x5A, 0xE7, 0x09, 0xF9, 0x79, 0xF7, 0x1E, 0xA7, 0x77, 0x71, 0x9F, 0xFA, 0x3A, 0xFF, 0xA3,
+    0xFF, 0xC5, 0x9F, 0xC9, 0x7F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF, 0x70, 0xFA, 0x70, 0xF9, 0x70,
+    0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF7, 0x09, 0xF7, 0x9F, 0xC6, 0xFF,
+    0xA3, 0xAF, 0xFA, 0x3A, 0xFF, 0x93, 0x3F, 0x39, 0xF3, 0xAF, 0x3F, 0xA3, 0xF9, 0x29, 0xF3, 0x9F,
+    0x3A, 0xEA, 0x3F, 0x93, 0xF9, 0x29, 0xF3, 0xAF, 0x3A, 0xEA, 0x3F, 0x93, 0xF3, 0x9F, 0x30, 0x39,
+    0xFF, 0xA2, 0x9F, 0x4A, 0xFF, 0xA2, 0xAF, 0x4F, 0xFC, 0x3F, 0xA5, 0x9F, 0xC9, 0x4F, 0x96, 0xF9,
+    0x5F, 0x7F, 0x59, 0xF6, 0x9F, 0x5A, 0xEA, 0x6A, 0xF5, 0xFA, 0x6F, 0xA5, 0xF9, 0x6F, 0x94, 0x9F,
+    0x7F, 0x5A, 0xF6, 0x9F, 0x5A, 0xEA, 0x6A, 0xEA, 0x5F, 0x96, 0xFA, 0x5F, 0x7F, 0x94, 0x9F, 0x69,
+    0xF5, 0xAF, 0x69, 0xF5, 0xFA, 0x59, 0xFC, 0x5F, 0x94, 0xFF, 0xA2, 0x9F, 0x4A, 0xFF, 0xA2, 0x9F,
+    0x4A, 0xFF, 0x92, 0xAE, 0xA7, 0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x49, 0xAA, 0xAF, 0xD7, 0x49, 0xFF,
+    0x75, 0x9F, 0xE9, 0x75, 0x9F, 0xCA, 0x77, 0x77, 0x77, 0x7A, 0xE4, 0xF4, 0x9F, 0x92, 0xAF, 0x49,
+    0xF3, 0xAF, 0x5E, 0xA4, 0xE9, 0x77, 0x77, 0x72, 0xF3, 0x9F, 0x49, 0xF3, 0xAE, 0xA4, 0xAF, 0x3F,
+    0xA4, 0xFA, 0x3F, 0x94, 0xF9, 0x29, 0xF4, 0x9F, 0x39, 0xF4, 0x9F, 0x3A, 0xEA, 0x4A, 0xEA, 0x3F,
+    0x94, 0xF9, 0x3F, 0x5F, 0x92, 0x9F, 0x49, 0xF3, 0xAF, 0x4A, 0xF3, 0xFA, 0x4A, 0xEA, 0x3F, 0x94,
+    0xF9, 0x3F, 0x5F, 0x39, 0xF4, 0x9F, 0x3A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97, 0x4A, 0xF7, 0x2A, 0xAA,
+    0xFA, 0x72, 0xFE, 0x73, 0xFD, 0x97, 0x3F, 0xA9, 0x70, 0x72, 0x99, 0x99, 0x97, 0x4A, 0xFC, 0x97,
+    0x2A, 0xFE, 0x71, 0xAE, 0x90, 0xEA, 0x7A, 0xE3, 0xE7, 0x99, 0x95, 0x99, 0x77, 0x75, 0x9E, 0xA7,
+    0x5F, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75,
+    0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0xA7, 0x5F, 0x97, 0x49, 0xF7, 0x5A, 0xF7, 0x5F, 0xA7, 0x5F, 0x97,
+    0x5F, 0x75, 0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0xFC, 0x70, 0x9A, 0xAA, 0xFC, 0xA7,
+    0x0A, 0xFF, 0x71, 0xAF, 0xE7, 0x2A, 0xFC, 0xA7, 0x77, 0x60, 0x70, 0x99, 0x99, 0x72, 0xFD, 0x70,
+    0xFE, 0x96, 0xF0, 0xAE, 0x5E, 0xA2, 0xAD, 0xA4, 0x99, 0x59, 0x99, 0x77, 0x7F, 0x72, 0x9F, 0x72,
+    0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x71,
+    0x9F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7,
+    0x19, 0xF9, 0x6A, 0xAA, 0xFC, 0x7A, 0xFD, 0xA7, 0xAF, 0xCA, 0x70, 0xAF, 0x97, 0x10, 0x4F, 0x94,
+    0xAF, 0x5F, 0x4A, 0xF9, 0x49, 0xF3, 0x9F, 0xA5, 0xAF, 0x29, 0xFA, 0x6F, 0xA2, 0xFC, 0x7F, 0x91,
+    0xFC, 0x70, 0xF1, 0xFC, 0x70, 0x9F, 0x0A, 0xF9, 0x70, 0xAE, 0xA9, 0xFA, 0x71, 0xFA, 0xFA, 0x72,
+    0xFF, 0xC9, 0x72, 0xFF, 0xCA, 0x71, 0x9F, 0xFD, 0x71, 0xAF, 0x1F, 0x97, 0x0F, 0x91, 0xFC, 0x70,
+    0xF9, 0x1A, 0xF7, 0x9F, 0x3F, 0xA6, 0x9F, 0x3F, 0xC6, 0xAE, 0xA3, 0x9F, 0x95, 0xF9, 0x4F, 0xA5,
+    0xF5, 0xAF, 0x77, 0x77, 0x77, 0x39, 0xF7, 0x7A, 0xE7, 0x70, 0xE9, 0x77, 0xAD, 0xA7, 0x70, 0x99,
+    0x97, 0x50, 0x77, 0x6F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x4F, 0x97, 0x4F,
+    0x39, 0xFA, 0x29, 0xF2, 0x9F, 0xA3, 0xAE, 0xA1, 0x9F, 0xA4, 0xF9, 0x1F, 0xA5, 0xF1, 0xFA, 0x59,
+    0xF0, 0xFA, 0x69, 0xFF, 0xA7, 0xAF, 0xF7, 0x0F, 0xFC, 0x97, 0xFF, 0xD6, 0x9F, 0xA9, 0xF9, 0x5A,
+    0xF1, 0xFC, 0x5A, 0xEA, 0x19, 0xF9, 0x4F, 0x92, 0xFC, 0x4F, 0x39, 0xF9, 0x29, 0xF4, 0xFA, 0x77,
+    0x77, 0x73, 0xF7, 0x49, 0xE9, 0x74, 0xEA, 0x74, 0x9E, 0x75, 0x99, 0x97, 0x30, 0x3F, 0x39, 0xFA,
+    0x29, 0xF2, 0x9F, 0xA3, 0xAE, 0xA2, 0xFA, 0x4F, 0x91, 0xFA, 0x5F, 0x1F, 0xA6, 0xF0, 0xFA, 0x69,
+    0xEA, 0xFA, 0x7A, 0xFF, 0x70, 0xFF, 0xC9, 0x7F, 0xFD, 0x69, 0xFA, 0x9F, 0x95, 0xAF, 0x1F, 0xC5,
+    0xAE, 0xA1, 0x9F, 0x94, 0xF9, 0x2F, 0xC4, 0xF3, 0x9F, 0x92, 0x9F, 0x4F, 0xA2, 0x70, 0x99, 0x99,
+    0x97, 0x1F, 0xA7, 0x0F, 0xA7, 0x0A, 0xE9, 0x70, 0x9E, 0x97, 0x19, 0x99, 0x77, 0x71, 0xF9, 0x71,
+    0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F,
+    0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x19,
+    0xFA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF, 0xE2, 0xFF, 0xEA, 0x2F, 0xFE, 0x91, 0x70, 0x99, 0x99, 0x70,
+    0xFA, 0x7A, 0xEA, 0x79, 0xEA, 0x70, 0xE9, 0x71, 0x99, 0x77, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7,
+    0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0F, 0x97,
+    0x9F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x0F, 0x97, 0x9F, 0x70, 0xAF, 0x70, 0xFA, 0x70,
+    0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x00, 0x4F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF, 0x70, 0xFA, 0x70,
+    0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A,
+    0xEA, 0x70, 0xF9, 0x70, 0xF9, 0x79, 0xF7, 0x09, 0xFA, 0xAA, 0xAA, 0xAA, 0x1A, 0xFF, 0xE1, 0xFF,
+    0xEA, 0x1F, 0xFE, 0x97, 0x77, 0x70, 0xAE, 0x97, 0x0F, 0x70, 0x9E, 0x71, 0xE9, 0x71, 0x99, 0x97,
+    0x77, 0x2F, 0x96, 0xF6, 0x9F, 0x6A, 0xF6, 0xFA, 0x6F, 0x96, 0xF6, 0x9F, 0x6A, 0xEA, 0x6F, 0xA6,
+    0xF9, 0x59, 0xF6, 0x9F, 0x6A, 0xEA, 0x6F, 0x96, 0xF9, 0x59, 0xF6, 0xAF, 0x6F, 0xA6, 0xF9, 0x6F,
+    0x69, 0xF7, 0x77, 0x6A, 0xE9, 0x6F, 0x69, 0xE7, 0xE9, 0x79, 0x99, 0x70, 0x4F, 0x91, 0x9E, 0x94,
+    0xF2, 0xF4, 0x9F, 0x2E, 0x94, 0xAF, 0x1A, 0xDA, 0x5F, 0xA1, 0xDA, 0x6F, 0x97, 0x3F, 0x73, 0x9F,
+    0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x3F,
+    0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4, 0xFF, 0xEA, 0x4F, 0xFE, 0x93,
+    0x77, 0x4F, 0x90, 0xAE, 0x94, 0xF1, 0xEA, 0x49, 0xF0, 0xAE, 0x5A, 0xF0, 0xE6, 0xFA, 0x0A, 0xA9,
+    0x6F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF7,
+    0x2A, 0xEA, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7,
+    0x29, 0xF7, 0x20, 0x4F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAF, 0x71, 0xFA, 0x71, 0xF9, 0x71, 0xF7,
+    0x19, 0xF7, 0x1A, 0xEA, 0x19, 0xE9, 0x2F, 0xA1, 0xFA, 0x2F, 0x91, 0xFA, 0x2F, 0x2A, 0xE2, 0x9F,
+    0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x19, 0xFA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF,
+    0xE2, 0xFF, 0xEA, 0x2F, 0xFE, 0x91, 0x77, 0x2F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF, 0x70, 0xFA,
+    0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x09, 0xE9, 0x19, 0xF1,
+    0xFA, 0x19, 0xF1, 0xFA, 0x1A, 0xEA, 0x1A, 0xE2, 0xF9, 0x70, 0xF9, 0x79, 0xF7, 0x0A, 0xF7, 0x0F,
+    0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0x5A, 0xE9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1A,
+    0xEA, 0x71, 0xF9, 0x71, 0xF0, 0x97, 0x9F, 0xDA, 0x6A, 0xFE, 0x6F, 0xEA, 0x5A, 0xFD, 0x5A, 0xFD,
+    0x96, 0xAF, 0xD7, 0x0F, 0xCA, 0x70, 0x9F, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x19, 0xFA, 0xAA, 0xAA,
+    0xAA, 0x2A, 0xFF, 0xE2, 0xFF, 0xEA, 0x2F, 0xFE, 0x90, 0x77, 0xAE, 0xA5, 0xF9, 0x5F, 0x95, 0xF5,
+    0x9F, 0x5A, 0xEA, 0x5F, 0x95, 0xF6, 0xFA, 0x49, 0xFC, 0xA3, 0xAF, 0xD2, 0x9F, 0xDA, 0x09, 0xFD,
+    0xA2, 0xAF, 0xD4, 0xFC, 0xA4, 0xAF, 0xA5, 0xF9, 0x5F, 0x59, 0xF5, 0xAE, 0xA5, 0xF9, 0x5F, 0x94,
+    0x76, 0x99, 0x99, 0x97, 0x70, 0x9F, 0x97, 0x70, 0xF9, 0x77, 0x0F, 0x77, 0x1A, 0xE7, 0x72, 0x99,
+    0x97, 0x77, 0x73, 0xFC, 0x96, 0xAE, 0x5F, 0xCA, 0x6F, 0x49, 0xFD, 0x6F, 0x4A, 0xFD, 0x94, 0x9E,
+    0xA4, 0xFE, 0xA4, 0xAE, 0x94, 0xFF, 0x4F, 0x5E, 0xAF, 0x93, 0xF4, 0x9E, 0x9A, 0xEA, 0x29, 0xEA,
+    0x4A, 0xE9, 0x0F, 0x2A, 0xEA, 0x4F, 0x1F, 0x2A, 0xE9, 0x4F, 0x1A, 0xEA, 0x1F, 0x49, 0xEA, 0x2F,
+    0x1F, 0x49, 0xEA, 0x2F, 0x09, 0xEA, 0x4A, 0xE9, 0x2A, 0xEA, 0x9E, 0x94, 0xF3, 0x9F, 0xAE, 0x5F,
+    0x4F, 0xF4, 0x9E, 0xA4, 0xAF, 0xE4, 0xAE, 0x94, 0x9F, 0xDA, 0x4A, 0xE6, 0xFD, 0x94, 0xF6, 0xAF,
+    0xC5, 0xF6, 0x9F, 0xC4, 0x73, 0x99, 0x99, 0x73, 0xAF, 0x72, 0x9F, 0x73, 0xF7, 0x3E, 0xA7, 0x49,
+    0x99, 0x77, 0x71, 0xE1, 0xAF, 0x94, 0x9E, 0x0A, 0xFD, 0x93, 0xAE, 0xAF, 0xF3, 0xFD, 0x99, 0xFC,
+    0x3F, 0xC2, 0x9F, 0x3F, 0xA3, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92,
+    0xF4, 0xF9, 0x19, 0xF4, 0xF2, 0xAF, 0x39, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4,
+    0xF2, 0x9F, 0x39, 0xF2, 0x4F, 0xC9, 0x6A, 0xE5, 0xFC, 0xA6, 0xF4, 0x9F, 0xD6, 0xF4, 0xAF, 0xD9,
+    0x49, 0xEA, 0x4F, 0xEA, 0x4A, 0xE9, 0x4F, 0xF4, 0xF5, 0xEA, 0xF9, 0x3F, 0x49, 0xE9, 0xAE, 0xA2,
+    0x9E, 0xA4, 0xAE, 0x90, 0xF2, 0xAE, 0xA4, 0xF1, 0xF2, 0xAE, 0x94, 0xF1, 0xAE, 0xA1, 0xF4, 0x9E,
+    0xA2, 0xF1, 0xF4, 0x9E, 0xA2, 0xF0, 0x9E, 0xA4, 0xAE, 0x92, 0xAE, 0xA9, 0xE9, 0x4F, 0x39, 0xFA,
+    0xE5, 0xF4, 0xFF, 0x49, 0xEA, 0x4A, 0xFE, 0x4A, 0xE9, 0x49, 0xFD, 0xA4, 0xAE, 0x6F, 0xD9, 0x4F,
+    0x6A, 0xFC, 0x5F, 0x69, 0xFC, 0x77, 0x77, 0x77, 0x71, 0xF7, 0x71, 0x9E, 0x97, 0x71, 0xEA, 0x77,
+    0x19, 0xE7, 0x73, 0x99, 0x76, 0x77, 0x4E, 0x1A, 0xF9, 0x49, 0xE0, 0xAF, 0xD9, 0x3A, 0xEA, 0xFF,
+    0x3F, 0xD9, 0x9F, 0xC3, 0xFC, 0x29, 0xF3, 0xFA, 0x3F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA,
+    0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x91, 0x9F, 0x4F, 0x2A, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xEA, 0x2F,
+    0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3, 0x9F, 0x77, 0x77, 0x71, 0xF7, 0x39, 0xE9, 0x73, 0xEA, 0x73,
+    0x9E, 0x74, 0x99, 0x97, 0x20, 0x71, 0x99, 0x59, 0x99, 0x72, 0x9E, 0x29, 0xE9, 0x73, 0xAE, 0x0A,
+    0xE9, 0x75, 0xFE, 0x97, 0x6A, 0xFC, 0x97, 0x70, 0x99, 0x99, 0x97, 0x77, 0x71, 0xFC, 0x96, 0xAE,
+    0x5F, 0xCA, 0x6F, 0x49, 0xFD, 0x6F, 0x4A, 0xFD, 0x94, 0x9E, 0xA4, 0xFE, 0xA4, 0xAE, 0x94, 0xFF,
+    0x4F, 0x5E, 0xAF, 0x93, 0xF4, 0x9E, 0x9A, 0xEA, 0x29, 0xEA, 0x4A, 0xE9, 0x0F, 0x2A, 0xEA, 0x4F,
+    0x1F, 0x2A, 0xE9, 0x4F, 0x1A, 0xEA, 0x1F, 0x49, 0xEA, 0x2F, 0x1F, 0x49, 0xEA, 0x2F, 0x09, 0xEA,
+    0x4A, 0xE9, 0x2A, 0xEA, 0x9E, 0x94, 0xF3, 0x9F, 0xAE, 0x5F, 0x4F, 0xF4, 0x9E, 0xA4, 0xAF, 0xE4,
+    0xAE, 0x94, 0x9F, 0xDA, 0x4A, 0xE6, 0xFD, 0x94, 0xF6, 0xAF, 0xC5, 0xF6, 0x9F, 0xC4, 0x59, 0x99,
+    0x59, 0x96, 0xAE, 0x2A, 0xE7, 0xEA, 0x0F, 0x70, 0x9F, 0xE7, 0x2F, 0xD7, 0x49, 0x99, 0x97, 0x77,
+    0x2E, 0x1A, 0xF9, 0x59, 0xE0, 0xAF, 0xD9, 0x4A, 0xEA, 0xFF, 0x4F, 0xD9, 0x9F, 0xC4, 0xFC, 0x29,
+    0xF4, 0xFA, 0x3F, 0x39, 0xF3, 0x9F, 0x3A, 0xEA, 0x3A, 0xEA, 0x3F, 0x93, 0xF9, 0x3F, 0x4F, 0x92,
+    0x9F, 0x4F, 0x3A, 0xF3, 0x9F, 0x3A, 0xEA, 0x3A, 0xEA, 0x3F, 0x93, 0xF9, 0x3F, 0x4F, 0x39, 0xF3,
+    0x9F, 0x30, 0x2A, 0xEA, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0x77, 0xEA, 0x76, 0xAE, 0x1E, 0x1A,
+    0xF9, 0x2E, 0x90, 0x9E, 0x0F, 0xE9, 0x19, 0x99, 0x1A, 0xEA, 0xFF, 0x6F, 0xD9, 0x9F, 0xC6, 0xFC,
+    0x29, 0xF5, 0x9F, 0xA2, 0x9F, 0x59, 0xF3, 0x9F, 0x5A, 0xEA, 0x3A, 0xEA, 0x5F, 0x93, 0xF9, 0x5F,
+    0x4F, 0x59, 0xF3, 0x9F, 0x5A, 0xEA, 0x39, 0xF5, 0xFA, 0x3A, 0xEA, 0x5F, 0x93, 0xF9, 0x5F, 0x4F,
+    0x59, 0xF3, 0x9F, 0x20, 0x4F, 0xC7, 0xAE, 0x5F, 0xC9, 0x6F, 0x49, 0xFD, 0x59, 0xEA, 0x4A, 0xFD,
+    0x59, 0xE9, 0x4F, 0xEA, 0x4A, 0xE9, 0x4F, 0xF4, 0xF5, 0xEA, 0xAE, 0x93, 0xF4, 0x9E, 0x99, 0xEA,
+    0x29, 0xEA, 0x4A, 0xE1, 0xF2, 0xAE, 0x94, 0xF1, 0xAE, 0x91, 0xF5, 0xF2, 0xF1, 0xF5, 0xEA, 0x2F,
+    0x1F, 0x49, 0xE9, 0x29, 0xEA, 0x9E, 0xA4, 0xAE, 0x93, 0xFA, 0xE9, 0x4F, 0x4A, 0xFE, 0x5F, 0x49,
+    0xFE, 0x49, 0xEA, 0x5F, 0xDA, 0x49, 0xE9, 0x5A, 0xFC, 0xA4, 0xAE, 0x7F, 0xC9, 0x4F, 0x7F, 0xC5,
+    0xF7, 0x9F, 0x77, 0x19, 0xEA, 0x77, 0x1F, 0x97, 0x49, 0x99, 0xAF, 0xC7, 0x49, 0xFF, 0x97, 0x49,
+    0xFE, 0x97, 0x59, 0xFC, 0xA7, 0x77, 0x70, 0x77, 0x4E, 0x1A, 0xF9, 0x49, 0xE0, 0xFE, 0x93, 0xAE,
+    0xAF, 0xF3, 0xFD, 0x99, 0xFC, 0x3F, 0xC2, 0x9F, 0x3F, 0xA3, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3,
+    0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF9, 0x19, 0xF4, 0xF2, 0xAF, 0x39, 0xF2, 0xAE, 0xA3, 0xAE,
+    0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x79,
+    0xAA, 0xFC, 0x70, 0xAF, 0xD9, 0x70, 0xAF, 0xCA, 0x71, 0xAF, 0x95, 0x70, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x72, 0xAF, 0xF9, 0x71, 0xFF, 0xC7, 0x29, 0x99, 0x99, 0x99, 0x99, 0x77, 0x75, 0x9A, 0xFD, 0x97,
+    0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF, 0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A,
+    0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90, 0xAF, 0x70, 0xF9, 0x0F, 0xA7, 0x0F, 0x90, 0xF9,
+    0x79, 0xF1, 0xF9, 0x7A, 0xF0, 0x9F, 0x97, 0xFC, 0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA,
+    0x59, 0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC, 0xA6, 0xFF,
+    0xE9, 0x70, 0x9F, 0xEA, 0x76, 0x99, 0x71, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFC, 0x5F, 0xFC,
+    0x59, 0x99, 0x99, 0x99, 0x97, 0x75, 0xAF, 0xCA, 0x59, 0xFF, 0xC3, 0x9F, 0xFE, 0x2F, 0xC9, 0x9A,
+    0xF9, 0x0A, 0xF9, 0x2F, 0xA0, 0xFA, 0x3A, 0xF9, 0xF4, 0xAF, 0x9F, 0x4A, 0xEA, 0xAE, 0xA4, 0xFA,
+    0xAE, 0xA4, 0xF9, 0xAE, 0xA3, 0x9F, 0x0A, 0xF3, 0xFA, 0x09, 0xFA, 0x09, 0xFC, 0x2F, 0xFE, 0xA3,
+    0xFF, 0xCA, 0x5A, 0xFC, 0xA9, 0x71, 0x97, 0x79, 0x99, 0x49, 0x97, 0x1E, 0x3A, 0xD7, 0x1F, 0xAA,
+    0xEA, 0x71, 0x9F, 0xF7, 0x39, 0xFC, 0xA7, 0x79, 0x97, 0x77, 0x70, 0x9A, 0xFD, 0x97, 0x1F, 0xFE,
+    0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF, 0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC,
+    0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90, 0xAF, 0x70, 0xF9, 0x0F, 0xA7, 0x0F, 0x90, 0xF9, 0x79, 0xF1,
+    0xF9, 0x7A, 0xF0, 0x9F, 0x97, 0xFC, 0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x59, 0xFA,
+    0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC, 0xA6, 0xFF, 0xE9, 0x70,
+    0x9F, 0xEA, 0x76, 0x99, 0x71, 0x49, 0x95, 0x99, 0x5D, 0xA3, 0xE5, 0xFA, 0xAE, 0x95, 0xAF, 0xF7,
+    0xAF, 0xCA, 0x72, 0x99, 0x77, 0x72, 0xAF, 0xCA, 0x69, 0xFF, 0xC4, 0x9F, 0xFE, 0x3F, 0xC9, 0x9A,
+    0xF9, 0x1A, 0xF9, 0x2F, 0xA1, 0xFA, 0x3A, 0xF0, 0x9F, 0x4A, 0xF0, 0x9F, 0x4A, 0xEA, 0x0A, 0xEA,
+    0x4F, 0xA0, 0xAE, 0xA4, 0xF9, 0x0A, 0xEA, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0x9F, 0xA0, 0x9F, 0xC3,
+    0xFF, 0xEA, 0x4F, 0xFC, 0xA6, 0xAF, 0xCA, 0x97, 0x29, 0x70, 0x73, 0x99, 0x91, 0x99, 0x99, 0x73,
+    0xF9, 0x0F, 0x72, 0xF9, 0x0F, 0x72, 0xAE, 0x1A, 0xE7, 0x29, 0xDA, 0x19, 0xDA, 0x74, 0x99, 0x39,
+    0x97, 0x77, 0x71, 0x9A, 0xFD, 0x97, 0x3F, 0xFE, 0x71, 0xFF, 0xFC, 0x7F, 0xDA, 0xAA, 0xFC, 0x95,
+    0xFC, 0xA3, 0x9F, 0xC4, 0x9F, 0xA5, 0xAF, 0x4F, 0xC6, 0x9F, 0x92, 0x9F, 0x97, 0xF9, 0x2A, 0xF7,
+    0x0F, 0x92, 0xFA, 0x70, 0xF9, 0x2F, 0x97, 0x9F, 0x3F, 0x97, 0xAF, 0x29, 0xF9, 0x7F, 0xC2, 0x9F,
+    0x97, 0xFA, 0x3F, 0x96, 0xAF, 0x4F, 0xA5, 0x9F, 0xA4, 0xFC, 0x93, 0x9F, 0xC5, 0x9F, 0xCA, 0x99,
+    0xAF, 0xC9, 0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA, 0x77, 0x09, 0x97, 0x30, 0x79,
+    0x99, 0x91, 0x99, 0x99, 0x79, 0xF0, 0x9F, 0x7F, 0x1F, 0x7E, 0xA1, 0xEA, 0x7A, 0xD9, 0x1A, 0xD9,
+    0x70, 0x99, 0x39, 0x97, 0x77, 0x5A, 0xFC, 0xA7, 0x19, 0xFF, 0xC7, 0x9F, 0xFE, 0x6F, 0xC9, 0x9A,
+    0xF9, 0x4A, 0xF9, 0x2F, 0xA4, 0xFA, 0x3A, 0xF3, 0x9F, 0x4A, 0xF3, 0x9F, 0x4A, 0xEA, 0x3A, 0xEA,
+    0x4F, 0xA3, 0xAE, 0xA4, 0xF9, 0x3A, 0xEA, 0x39, 0xF4, 0xAF, 0x3F, 0xA4, 0x9F, 0xA0, 0x9F, 0xC6,
+    0xFF, 0xEA, 0x7F, 0xFC, 0xA7, 0x1A, 0xFC, 0xA9, 0x75, 0x97, 0x30, 0x77, 0x77, 0x19, 0xAF, 0xFF,
+    0xFC, 0x6A, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xFC, 0x4F, 0xDA, 0xAA, 0xFF, 0xF9, 0x3F, 0xCA, 0x39,
+    0xF7, 0x29, 0xFA, 0x49, 0xF7, 0x2F, 0xC5, 0xAE, 0xA7, 0x19, 0xF9, 0x5F, 0x97, 0x1A, 0xF6, 0xFA,
+    0xAA, 0xAA, 0xAA, 0x3F, 0xA5, 0x9F, 0xFE, 0x3F, 0x95, 0xAF, 0xFD, 0xA3, 0xF9, 0x5F, 0xFE, 0x93,
+    0xF6, 0xF9, 0x72, 0xF6, 0xF7, 0x3F, 0x94, 0x9F, 0x73, 0xFA, 0x4A, 0xEA, 0x73, 0xFC, 0x4F, 0xA7,
+    0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xFF, 0xF9, 0x6F, 0xFF, 0xFE, 0x70,
+    0x9F, 0xFF, 0xFC, 0x74, 0x97, 0x71, 0x77, 0x74, 0xAF, 0xC9, 0x2A, 0xFC, 0xA4, 0x9F, 0xFA, 0x9F,
+    0xFC, 0x29, 0xFF, 0xFF, 0xFA, 0x1F, 0xC9, 0x9F, 0xEA, 0x19, 0xF0, 0xAF, 0x3F, 0xCA, 0x3F, 0x0F,
+    0xA3, 0xFC, 0x3A, 0xF9, 0xF4, 0xFC, 0x09, 0x9F, 0xC9, 0xAF, 0x4F, 0xFF, 0xA0, 0xAE, 0xA4, 0xFF,
+    0xE9, 0x1A, 0xEA, 0x4F, 0xAA, 0xAA, 0x94, 0xAE, 0xA3, 0xAF, 0x71, 0xAF, 0x3F, 0xC9, 0x70, 0x9F,
+    0xA0, 0x9F, 0xE9, 0x29, 0xAA, 0x2F, 0xFF, 0xFF, 0xA2, 0x9F, 0xFC, 0xAF, 0xFC, 0xA4, 0xFD, 0x91,
+    0x9F, 0xEA, 0x79, 0x97, 0x99, 0x60, 0x74, 0x99, 0x99, 0x74, 0xAF, 0x73, 0x9F, 0x74, 0xF7, 0x4E,
+    0xA7, 0x59, 0x99, 0x77, 0x73, 0xFE, 0xA9, 0x70, 0xFF, 0xD9, 0x59, 0xFF, 0xE9, 0x4A, 0xFA, 0xAF,
+    0xD4, 0xFA, 0x2A, 0xF4, 0xF9, 0x3F, 0x93, 0xF4, 0xF9, 0x29, 0xF3, 0x9F, 0x3A, 0xF3, 0xFC, 0x3F,
+    0xC9, 0x9A, 0xFC, 0x93, 0xFF, 0xF9, 0x4F, 0xFE, 0x94, 0x9F, 0xFD, 0x6A, 0xF1, 0xF9, 0x5F, 0xA1,
+    0xAF, 0x5F, 0x91, 0x9F, 0x49, 0xF3, 0xFA, 0x39, 0xF3, 0xAF, 0x3A, 0xEA, 0x4F, 0x92, 0xF9, 0x4F,
+    0xC2, 0xF9, 0x4A, 0xF9, 0x00, 0x71, 0x99, 0x99, 0x71, 0xAF, 0x70, 0x9F, 0x71, 0xF7, 0x1E, 0xA7,
+    0x29, 0x99, 0x77, 0x7E, 0x90, 0xAE, 0x93, 0x9E, 0x9A, 0xF4, 0xAE, 0xAF, 0xC4, 0xFF, 0xCA, 0x4F,
+    0xCA, 0x79, 0xFC, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F, 0x71, 0xAF, 0x71,
+    0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0x4F, 0xEA, 0x97, 0x0F, 0xFD, 0x95, 0x9F, 0xFE,
+    0x94, 0xAF, 0xAA, 0xFD, 0x4F, 0xA2, 0xAF, 0x4F, 0x93, 0xF9, 0x3F, 0x4F, 0x92, 0x9F, 0x39, 0xF3,
+    0xAF, 0x3F, 0xC3, 0xFC, 0x99, 0xAF, 0xC9, 0x3F, 0xFF, 0x94, 0xFF, 0xE9, 0x49, 0xFF, 0xD6, 0xAF,
+    0x1F, 0x95, 0xFA, 0x1A, 0xF5, 0xF9, 0x19, 0xF4, 0x9F, 0x3F, 0xA3, 0x9F, 0x3A, 0xF3, 0xAE, 0xA4,
+    0xF9, 0x2F, 0x94, 0xFC, 0x2F, 0x94, 0xAF, 0x97, 0x77, 0x77, 0x1A, 0xEA, 0x74, 0xF7, 0x49, 0xE7,
+    0x5E, 0x97, 0x59, 0x99, 0x72, 0x77, 0x3E, 0x90, 0xAE, 0x93, 0x9E, 0x9A, 0xF4, 0xAE, 0xAF, 0xC4,
+    0xFF, 0xCA, 0x4F, 0xCA, 0x79, 0xFC, 0x70, 0x9F, 0x71, 0xAF, 0x71, 0xF9, 0x71, 0xF9, 0x70, 0x9F,
+    0x71, 0xAF, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x77, 0x77, 0x79, 0xEA, 0x71, 0xF7,
+    0x19, 0xE9, 0x71, 0xAD, 0x97, 0x29, 0x99, 0x73, 0x69, 0x99, 0x59, 0x99, 0x6A, 0xE2, 0xAE, 0x70,
+    0xEA, 0x0F, 0x71, 0x9F, 0xE7, 0x3F, 0xD7, 0x59, 0x99, 0x97, 0x77, 0x4F, 0xEA, 0x97, 0x1F, 0xFD,
+    0x96, 0x9F, 0xFE, 0x95, 0xAF, 0xAA, 0xFD, 0x5F, 0xA2, 0xAF, 0x5F, 0x93, 0xF9, 0x4F, 0x4F, 0x93,
+    0x9F, 0x39, 0xF4, 0xAF, 0x3F, 0xC4, 0xFC, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0x95, 0xFF, 0xE9, 0x59,
+    0xFF, 0xD7, 0xAF, 0x1F, 0x96, 0xFA, 0x1A, 0xF6, 0xF9, 0x19, 0xF5, 0x9F, 0x3F, 0xA4, 0x9F, 0x3A,
+    0xF4, 0xAE, 0xA4, 0xF9, 0x3F, 0x94, 0xFC, 0x3F, 0x94, 0xAF, 0x91, 0x39, 0x99, 0x59, 0x94, 0xAE,
+    0x2A, 0xE5, 0xEA, 0x0F, 0x69, 0xFE, 0x70, 0xFD, 0x72, 0x99, 0x99, 0x77, 0x70, 0xE9, 0x0A, 0xE9,
+    0x49, 0xE9, 0xAF, 0x5A, 0xEA, 0xFC, 0x5F, 0xFC, 0xA5, 0xFC, 0xA7, 0x09, 0xFC, 0x71, 0x9F, 0x72,
+    0xAF, 0x72, 0xF9, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F, 0x72,
+    0x9F, 0x72, 0x73, 0x99, 0x99, 0x73, 0xFA, 0x72, 0xFA, 0x72, 0xAE, 0x97, 0x29, 0xE9, 0x73, 0x99,
+    0x97, 0x77, 0x49, 0xAF, 0xCA, 0x96, 0xFF, 0xDA, 0x4F, 0xFE, 0x49, 0xFC, 0xAA, 0xAE, 0x4F, 0xC4,
+    0x95, 0xFA, 0x73, 0xFA, 0x73, 0xFC, 0x73, 0xAF, 0xC9, 0x72, 0xFD, 0xA7, 0x2F, 0xDA, 0x72, 0xFD,
+    0xA7, 0x2A, 0xFC, 0x73, 0xAF, 0x97, 0x3F, 0x97, 0x3F, 0x92, 0x99, 0x59, 0xF9, 0x29, 0xDA, 0x99,
+    0x9A, 0xFC, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0xD9, 0x59, 0xFE, 0xA7, 0x39, 0x97, 0x10, 0x70, 0x99,
+    0x99, 0x97, 0x09, 0xF9, 0x70, 0xF9, 0x70, 0xAE, 0x97, 0x09, 0xE7, 0x29, 0x99, 0x77, 0x70, 0xAF,
+    0xDA, 0x94, 0xFF, 0xD3, 0xAF, 0xFC, 0xA3, 0xFA, 0x29, 0xC4, 0xF9, 0x71, 0xFC, 0x97, 0x0A, 0xFC,
+    0xA7, 0x0F, 0xE9, 0x7A, 0xFD, 0x70, 0x9F, 0xCA, 0x71, 0xFC, 0x71, 0xAF, 0x2A, 0xA9, 0x29, 0xFA,
+    0x2A, 0xFF, 0xD3, 0xAF, 0xFC, 0x93, 0x9F, 0xF9, 0x70, 0x99, 0x70, 0x70, 0x99, 0x99, 0x97, 0x2F,
+    0xD7, 0x1F, 0xEA, 0x7F, 0x09, 0xE6, 0xEA, 0x2A, 0xE5, 0x99, 0x94, 0x99, 0x97, 0x77, 0x9A, 0xFC,
+    0xA9, 0x6F, 0xFD, 0xA4, 0xFF, 0xE4, 0x9F, 0xCA, 0xAA, 0xE4, 0xFC, 0x49, 0x5F, 0xA7, 0x3F, 0xA7,
+    0x3F, 0xC7, 0x3A, 0xFC, 0x97, 0x2F, 0xDA, 0x72, 0xFD, 0xA7, 0x2F, 0xDA, 0x72, 0xAF, 0xC7, 0x3A,
+    0xF9, 0x73, 0xF9, 0x73, 0xF9, 0x29, 0x95, 0x9F, 0x92, 0x9D, 0xA9, 0x99, 0xAF, 0xC3, 0x9F, 0xFE,
+    0x93, 0x9F, 0xFD, 0x95, 0x9F, 0xEA, 0x73, 0x99, 0x71, 0x69, 0x99, 0x97, 0x1F, 0xD7, 0xFE, 0xA5,
+    0xF0, 0xAE, 0x4E, 0xA2, 0xAE, 0x39, 0x95, 0x99, 0x97, 0x73, 0xAF, 0xDA, 0x94, 0xFF, 0xD3, 0xAF,
+    0xFC, 0xA3, 0xFA, 0x29, 0xC4, 0xF9, 0x71, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0F, 0xE9, 0x7A, 0xFD,
+    0x70, 0x9F, 0xCA, 0x71, 0xFC, 0x71, 0xAF, 0x2A, 0xA9, 0x29, 0xFA, 0x2A, 0xFF, 0xD3, 0xAF, 0xFC,
+    0x93, 0x9F, 0xF9, 0x70, 0x99, 0x70, 0x77, 0x59, 0xAF, 0xCA, 0x95, 0xFF, 0xDA, 0x3F, 0xFE, 0x39,
+    0xFC, 0xAA, 0xAE, 0x3F, 0xC4, 0x94, 0xFA, 0x72, 0xFA, 0x72, 0xFC, 0x72, 0xAF, 0xC9, 0x71, 0xFD,
+    0xA7, 0x1F, 0xDA, 0x71, 0xFD, 0xA7, 0x1A, 0xFC, 0x72, 0xAF, 0x97, 0x2F, 0x97, 0x2F, 0x91, 0x99,
+    0x59, 0xF9, 0x19, 0xDA, 0x99, 0x9A, 0xFC, 0x29, 0xFF, 0xE9, 0x29, 0xFF, 0xD9, 0x49, 0xFE, 0xA7,
+    0x1A, 0xD9, 0x73, 0xEA, 0x73, 0x9E, 0xA7, 0x3A, 0xE7, 0x09, 0x99, 0xEA, 0x70, 0xFD, 0x97, 0x0A,
+    0xEA, 0x70, 0x77, 0x1A, 0xFD, 0xA9, 0x3F, 0xFD, 0x2A, 0xFF, 0xCA, 0x2F, 0xA2, 0x9C, 0x3F, 0x97,
+    0x0F, 0xC9, 0x7A, 0xFC, 0xA7, 0xFE, 0x96, 0xAF, 0xD7, 0x9F, 0xCA, 0x70, 0xFC, 0x70, 0xAF, 0x1A,
+    0xA9, 0x29, 0xFA, 0x1A, 0xFF, 0xD2, 0xAF, 0xFC, 0x92, 0x9F, 0xF9, 0x69, 0xD9, 0x71, 0xF7, 0x19,
+    0xF7, 0x19, 0xE6, 0x99, 0x9F, 0x6A, 0xFC, 0x96, 0x9F, 0x96, 0x59, 0x95, 0x99, 0x96, 0xE9, 0x2E,
+    0xA6, 0x9E, 0x09, 0xEA, 0x70, 0xFE, 0xA7, 0x19, 0xFC, 0xA7, 0x39, 0x99, 0x99, 0x77, 0x74, 0x9A,
+    0xFC, 0xA9, 0x7F, 0xFD, 0xA5, 0xFF, 0xE5, 0x9F, 0xCA, 0xAA, 0xE5, 0xFC, 0x49, 0x6F, 0xA7, 0x4F,
+    0xA7, 0x4F, 0xC7, 0x4A, 0xFC, 0x97, 0x3F, 0xDA, 0x73, 0xFD, 0xA7, 0x3F, 0xDA, 0x73, 0xAF, 0xC7,
+    0x4A, 0xF9, 0x74, 0xF9, 0x74, 0xF9, 0x39, 0x95, 0x9F, 0x93, 0x9D, 0xA9, 0x99, 0xAF, 0xC4, 0x9F,
+    0xFE, 0x94, 0x9F, 0xFD, 0x96, 0x9F, 0xEA, 0x74, 0x99, 0x72, 0x39, 0x95, 0x99, 0x94, 0xE9, 0x19,
+    0xEA, 0x4A, 0xE0, 0x9E, 0xA6, 0xFE, 0xA7, 0x9F, 0xCA, 0x71, 0x99, 0x99, 0x97, 0x77, 0x0A, 0xFD,
+    0xA9, 0x5F, 0xFD, 0x4A, 0xFF, 0xCA, 0x4F, 0xA2, 0x9C, 0x5F, 0x97, 0x2F, 0xC9, 0x71, 0xAF, 0xCA,
+    0x71, 0xFE, 0x97, 0x0A, 0xFD, 0x71, 0x9F, 0xCA, 0x72, 0xFC, 0x72, 0xAF, 0x3A, 0xA9, 0x29, 0xFA,
+    0x3A, 0xFF, 0xD4, 0xAF, 0xFC, 0x94, 0x9F, 0xF9, 0x71, 0x99, 0x71, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF,
+    0xD9, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD5, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7,
+    0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7,
+    0x2A, 0xF7, 0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0x9D, 0x74, 0xEA, 0x73, 0x9E, 0xA7, 0x3A,
+    0xE7, 0x09, 0x99, 0xF7, 0x0A, 0xFC, 0x97, 0x0A, 0xEA, 0x97, 0x10, 0x59, 0x97, 0x0E, 0x7A, 0xE7,
+    0xEA, 0x5A, 0xFF, 0x99, 0xFF, 0xD0, 0x9F, 0xFD, 0x19, 0xAF, 0x99, 0x99, 0x2F, 0xA6, 0xF9, 0x6F,
+    0x69, 0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x96, 0xF6, 0x9F, 0x90, 0x99, 0x3F, 0xEA, 0x3F, 0xEA, 0x4F,
+    0xD9, 0x49, 0xDA, 0x7F, 0x79, 0xF7, 0x9E, 0x49, 0x99, 0xF4, 0xAF, 0xCA, 0x49, 0xF9, 0x50, 0x39,
+    0x99, 0x49, 0x99, 0x4E, 0xA2, 0xAE, 0x5E, 0x90, 0xF6, 0xAF, 0xE7, 0x0F, 0xD7, 0x29, 0x99, 0x97,
+    0x75, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x5F, 0xA7, 0x2F, 0x97,
+    0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAF, 0x72,
+    0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x2F, 0x97, 0x00, 0x77,
+    0x70, 0x9E, 0xA7, 0x1A, 0xE6, 0x99, 0x1E, 0x95, 0xE0, 0xAD, 0x95, 0xAE, 0x09, 0xA9, 0x6E, 0xA7,
+    0x0A, 0xFF, 0x92, 0x9F, 0xFD, 0x39, 0xFF, 0xD4, 0x9A, 0xF9, 0x99, 0x95, 0xFA, 0x71, 0xF9, 0x71,
+    0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF9, 0x09, 0x96, 0xFE,
+    0xA6, 0xFE, 0xA7, 0xFD, 0x97, 0x19, 0x97, 0x00, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x9F, 0xFF,
+    0xD0, 0x9F, 0xFF, 0xD5, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0xFF, 0xE3, 0x9F,
+    0xFE, 0x3A, 0xFF, 0xDA, 0x39, 0xAA, 0xFC, 0xAA, 0xA7, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F,
+    0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0xA7, 0x2F, 0x97, 0x00, 0x69, 0x97, 0x1E, 0x70, 0xAE, 0x70,
+    0xEA, 0x6A, 0xFF, 0x90, 0x9F, 0xFD, 0x19, 0xFF, 0xD2, 0x9A, 0xF9, 0x99, 0x93, 0xAE, 0xA7, 0xF9,
+    0x5F, 0xFC, 0x91, 0x9F, 0xFC, 0x29, 0xFF, 0xC4, 0xF9, 0x7F, 0x97, 0xF7, 0x9F, 0x90, 0x99, 0x4F,
+    0xEA, 0x4F, 0xEA, 0x5F, 0xD9, 0x79, 0x95, 0x77, 0x73, 0x9E, 0x92, 0xD9, 0x79, 0xFD, 0xAE, 0x70,
+    0xFF, 0xD9, 0x79, 0xD1, 0x9F, 0xA7, 0x19, 0x59, 0x77, 0x74, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3,
+    0xAF, 0x59, 0xF3, 0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9, 0x5F, 0x92, 0x9F, 0x59, 0xF3,
+    0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3, 0x9F, 0x59, 0xF3, 0xAF, 0x5A,
+    0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC, 0x39, 0xFA, 0x4A, 0xFC, 0xA9,
+    0xAF, 0xC6, 0xFF, 0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x77, 0x6A, 0xE9,
+    0x19, 0xD5, 0xAF, 0xDA, 0xDA, 0x5F, 0xFD, 0x94, 0xAD, 0x19, 0xF9, 0x59, 0x95, 0x97, 0x76, 0x9F,
+    0x4F, 0x2A, 0xEA, 0x39, 0xF2, 0xFA, 0x3A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3, 0x9F,
+    0x2A, 0xEA, 0x3A, 0xF2, 0xF9, 0x3F, 0xA2, 0xF4, 0xF9, 0x2F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F,
+    0x29, 0xFA, 0x29, 0xF9, 0x0A, 0xFC, 0x93, 0xFF, 0xAE, 0x93, 0xFE, 0x99, 0xE5, 0xFC, 0x90, 0x9E,
+    0x79, 0x73, 0x7A, 0xAA, 0xAA, 0xAA, 0xA9, 0x72, 0xFF, 0xA7, 0x19, 0xFF, 0x97, 0x29, 0x99, 0x99,
+    0x99, 0x97, 0x77, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0x9F, 0x3A, 0xEA, 0x5A, 0xEA,
+    0x3F, 0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F,
+    0x95, 0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9,
+    0x3F, 0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF, 0xCA, 0x9A, 0xFC, 0x6F, 0xFF, 0x96, 0x9F, 0xFD,
+    0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x5A, 0xAA, 0xAA, 0xAA, 0xA9, 0x69, 0xFF, 0x96, 0xAF,
+    0xF7, 0x99, 0x99, 0x99, 0x99, 0x97, 0x75, 0x9F, 0x4F, 0x2A, 0xEA, 0x39, 0xF2, 0xFA, 0x3A, 0xEA,
+    0x2F, 0x93, 0xF9, 0x2F, 0x4F, 0x29, 0xF3, 0x9F, 0x2A, 0xEA, 0x3A, 0xF2, 0xF9, 0x3F, 0xA2, 0xF4,
+    0xF9, 0x2F, 0x39, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0x29, 0xFA, 0x29, 0xF9, 0x0A, 0xFC, 0x93, 0xFF,
+    0xAE, 0x93, 0xFE, 0x99, 0xE5, 0xFC, 0x90, 0x9E, 0x79, 0x73, 0x79, 0x94, 0x99, 0x97, 0x0A, 0xD3,
+    0x9D, 0x97, 0x09, 0xEA, 0xAF, 0x72, 0xFF, 0x97, 0x3F, 0xD9, 0x76, 0x99, 0x77, 0x76, 0xF9, 0x5F,
+    0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x59, 0xF3, 0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9, 0x5F,
+    0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3, 0x9F,
+    0x59, 0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC, 0x39,
+    0xFA, 0x4A, 0xFC, 0xA9, 0xAF, 0xC6, 0xFF, 0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99,
+    0x72, 0x49, 0x99, 0x49, 0x96, 0xE3, 0xAD, 0x95, 0xAE, 0xAA, 0xF7, 0xFF, 0x97, 0x9F, 0xD7, 0x49,
+    0x97, 0x77, 0x09, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4,
+    0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29,
+    0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E,
+    0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x72, 0x99, 0x77, 0x9F, 0xA7, 0x5E, 0xAD, 0x97, 0x39, 0xD1,
+    0xAC, 0xA7, 0x39, 0xD1, 0xAC, 0xA7, 0x4E, 0xAD, 0x97, 0x49, 0xFA, 0x77, 0x99, 0x77, 0x76, 0xF9,
+    0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x59, 0xF3, 0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9,
+    0x5F, 0x92, 0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3,
+    0x9F, 0x59, 0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC,
+    0x39, 0xFA, 0x4A, 0xFC, 0xA9, 0xAF, 0xC6, 0xFF, 0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76,
+    0x99, 0x72, 0x70, 0x99, 0x74, 0xAF, 0x97, 0x19, 0xDA, 0xAD, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xAC,
+    0xA1, 0xD9, 0x70, 0x9D, 0xAE, 0x72, 0xAF, 0x97, 0x49, 0x97, 0x77, 0x09, 0xF4, 0xF2, 0xAE, 0xA3,
+    0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF,
+    0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F,
+    0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x72,
+    0x99, 0x99, 0x19, 0x99, 0x97, 0x1F, 0xA0, 0xF9, 0x70, 0x9E, 0xA0, 0xAE, 0x97, 0x1E, 0x90, 0x9E,
+    0x97, 0x1E, 0x2E, 0x73, 0x99, 0x39, 0x97, 0x77, 0x5F, 0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x4A, 0xF5,
+    0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0x95, 0xFA, 0x4F, 0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x4A, 0xF5,
+    0xAF, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xF9, 0x4F, 0x6F, 0x49, 0xF5, 0x9F, 0x4A, 0xF5, 0xAF, 0x4F,
+    0xA5, 0xFA, 0x4F, 0x95, 0xF9, 0x4F, 0x94, 0xAF, 0x5F, 0xC3, 0x9F, 0xA5, 0xAF, 0xCA, 0x9A, 0xFC,
+    0x7F, 0xFF, 0x97, 0x9F, 0xFD, 0xA7, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x30, 0x70, 0x99, 0x99, 0x19,
+    0x99, 0x70, 0xF9, 0x0F, 0x96, 0xAE, 0x90, 0xF9, 0x69, 0xE1, 0xAE, 0x79, 0xDA, 0x19, 0xDA, 0x71,
+    0x99, 0x39, 0x97, 0x77, 0x19, 0xF4, 0xF4, 0xAE, 0xA3, 0x9F, 0x4F, 0xA3, 0xAE, 0xA4, 0xF9, 0x3F,
+    0x94, 0xF4, 0xF4, 0x9F, 0x39, 0xF4, 0xAE, 0xA3, 0xAF, 0x4F, 0x93, 0xFA, 0x4F, 0x4F, 0x94, 0xF3,
+    0x9F, 0x49, 0xF3, 0xFC, 0x49, 0xF2, 0x9F, 0xA4, 0x9F, 0x90, 0xAF, 0xC9, 0x5F, 0xFA, 0xE9, 0x5F,
+    0xE9, 0x9E, 0x7F, 0xC9, 0x09, 0xE7, 0x19, 0x75, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5,
+    0x9F, 0x3A, 0xEA, 0x5A, 0xEA, 0x3F, 0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5, 0x9F, 0x3A, 0xF5,
+    0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A, 0xF5, 0xAF, 0x3F,
+    0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF, 0xCA, 0x9A, 0xFC,
+    0x6F, 0xFF, 0x96, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x5A, 0xDA, 0x76, 0xAD, 0x97, 0x69, 0xDA,
+    0x77, 0xAD, 0x97, 0x7F, 0xAA, 0x75, 0xAF, 0xA7, 0x6A, 0xEA, 0x77, 0x75, 0x19, 0xF4, 0xF2, 0xAE,
+    0xA3, 0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3,
+    0xAF, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2,
+    0x9F, 0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x92, 0xAD,
+    0x97, 0x3A, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0x97, 0x4F, 0xAA, 0x72, 0xAF, 0xA7, 0x3A, 0xEA, 0x77,
+    0x50, 0x73, 0x99, 0x99, 0x97, 0x74, 0x9F, 0xC9, 0x77, 0x29, 0xFE, 0x77, 0x19, 0xEA, 0x0E, 0xA7,
+    0x7A, 0xE9, 0x2E, 0x97, 0x69, 0x99, 0x59, 0x97, 0x77, 0x72, 0x9E, 0xA5, 0x9E, 0xA5, 0xAE, 0xA9,
+    0xEA, 0x5F, 0xA5, 0xF0, 0x9E, 0xA4, 0x9F, 0xA4, 0xAF, 0x09, 0xEA, 0x4F, 0xCA, 0x4F, 0x91, 0xEA,
+    0x4F, 0xCA, 0x39, 0xF2, 0xF3, 0xAF, 0xCA, 0x3F, 0x92, 0xF3, 0xFD, 0xA3, 0xF3, 0xF2, 0xAE, 0xAE,
+    0x2A, 0xEA, 0x3F, 0x2E, 0xAA, 0xE2, 0xF4, 0xF1, 0x9E, 0x0A, 0xE1, 0x9E, 0xA4, 0xF1, 0xF0, 0xAE,
+    0x1F, 0x94, 0xF0, 0x9E, 0x90, 0xAE, 0x09, 0xF5, 0xF0, 0xF1, 0xAE, 0x0A, 0xE9, 0x5F, 0x0E, 0x91,
+    0xAE, 0x0F, 0x6E, 0xAA, 0xE2, 0x9E, 0x9E, 0x96, 0xEA, 0xEA, 0x29, 0xFE, 0x7F, 0xE3, 0x9F, 0xDA,
+    0x7F, 0xDA, 0x39, 0xFD, 0x70, 0xFD, 0x49, 0xFC, 0xA7, 0x0F, 0xD4, 0x9F, 0xC9, 0x70, 0xFC, 0x94,
+    0x9F, 0xC7, 0x00, 0x72, 0x99, 0x99, 0x77, 0x2F, 0xD7, 0x70, 0xFE, 0x97, 0x6E, 0xA0, 0xAE, 0x74,
+    0x9E, 0xA2, 0xEA, 0x74, 0x99, 0x59, 0x99, 0x77, 0x76, 0xEA, 0x3A, 0xF9, 0x3F, 0x1F, 0x3F, 0xC9,
+    0x2A, 0xF1, 0xF2, 0x9F, 0xC9, 0x2F, 0x91, 0xF2, 0xFD, 0x91, 0x9F, 0x2F, 0x19, 0xFD, 0x91, 0xF9,
+    0x2F, 0x1A, 0xDA, 0xE9, 0x09, 0xF3, 0xF1, 0xE0, 0xE9, 0x0A, 0xE9, 0x3F, 0x0A, 0xE0, 0xE9, 0x0F,
+    0x4F, 0x0E, 0x90, 0xE9, 0xAE, 0x94, 0xF9, 0xE1, 0xE9, 0xF5, 0xAE, 0xAD, 0x91, 0xE9, 0xEA, 0x5A,
+    0xFD, 0x2F, 0xE6, 0xAF, 0xCA, 0x2F, 0xDA, 0x6A, 0xFC, 0x3F, 0xD7, 0xAF, 0xC3, 0xFC, 0xA7, 0xAF,
+    0x93, 0xFC, 0x70, 0x69, 0x99, 0x99, 0x73, 0x9F, 0xCA, 0x71, 0x9F, 0xE7, 0x09, 0xEA, 0x0E, 0xA6,
+    0x9E, 0x92, 0xE9, 0x59, 0x99, 0x59, 0x97, 0x76, 0xF6, 0xFA, 0x1F, 0x94, 0xAF, 0x2A, 0xEA, 0x4F,
+    0xA2, 0x9F, 0x3F, 0xC4, 0xF2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xE9, 0x0A, 0xF6, 0x9E, 0xA9, 0xF7,
+    0x0F, 0xF9, 0x70, 0xFE, 0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xF7, 0x49, 0xF7,
+    0x4A, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x72, 0x71, 0x99, 0x99,
+    0x97, 0x59, 0xFC, 0xA7, 0x39, 0xFE, 0x72, 0x9E, 0xA0, 0xF7, 0x09, 0xE9, 0x2E, 0x97, 0x99, 0x95,
+    0x99, 0x77, 0x72, 0x9E, 0xA5, 0xF9, 0x39, 0xF4, 0xAF, 0x5F, 0x4F, 0x95, 0xF3, 0xAF, 0x6F, 0x3F,
+    0x96, 0xF2, 0xAF, 0x7A, 0xE9, 0x1F, 0x70, 0x9E, 0x90, 0xAE, 0xA7, 0x09, 0xEA, 0x0F, 0x72, 0xEA,
+    0x9E, 0xA7, 0x2E, 0xAF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0xAF, 0xCA, 0x74, 0x9F, 0xC7, 0x59,
+    0xF9, 0x75, 0x9F, 0x76, 0xF9, 0x75, 0xFC, 0x72, 0xAA, 0xAF, 0xC7, 0x3F, 0xE9, 0x73, 0xFD, 0x97,
+    0x4F, 0xA7, 0x50, 0x4A, 0xD2, 0xDA, 0x70, 0xEA, 0x0A, 0xE7, 0x9E, 0x90, 0xF7, 0x0A, 0xCA, 0x19,
+    0xD9, 0x77, 0x77, 0x70, 0xF6, 0xFA, 0x1F, 0x94, 0xAF, 0x2A, 0xEA, 0x4F, 0xA2, 0x9F, 0x3F, 0xC4,
+    0xF2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xE9, 0x0A, 0xF6, 0x9E, 0xA9, 0xF7, 0x0F, 0xF9, 0x70, 0xFE,
+    0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xEA,
+    0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x72, 0x74, 0x99, 0x99, 0x75, 0xFC, 0x74, 0x9F,
+    0x75, 0xF7, 0x5E, 0xA7, 0x69, 0x99, 0x77, 0x74, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF,
+    0xA4, 0xAF, 0xFF, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73,
+    0xAF, 0x97, 0x39, 0xFA, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xAF, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xDA, 0xAA, 0xAA, 0xAA, 0xA3, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xFC, 0x93, 0xFF,
+    0xFD, 0x40, 0x72, 0x99, 0x99, 0x72, 0xFC, 0x71, 0xAF, 0x71, 0x9E, 0xA7, 0x2E, 0xA7, 0x39, 0x97,
+    0x77, 0x1F, 0xFE, 0x4F, 0xFD, 0xA3, 0x9F, 0xFD, 0x94, 0x99, 0x99, 0x9F, 0xC7, 0x1A, 0xF7, 0x1A,
+    0xF9, 0x70, 0x9F, 0x97, 0x1F, 0xA7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1A, 0xF7, 0x19, 0xF9, 0x70, 0x9F,
+    0xA9, 0x99, 0x99, 0x4F, 0xFE, 0x93, 0xFF, 0xE3, 0x9F, 0xFE, 0x30, 0x77, 0x74, 0x9E, 0x97, 0x5F,
+    0xA7, 0x5F, 0xA7, 0x5A, 0xE7, 0x77, 0x77, 0x69, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4A, 0xFF, 0xFA,
+    0x4A, 0xFF, 0xF7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A,
+    0xF9, 0x73, 0x9F, 0xA7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74,
+    0xFC, 0x74, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0xC9, 0x3F, 0xFF,
+    0xD4, 0x77, 0x69, 0xE9, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xAE, 0x77, 0x77, 0x4F, 0xFE, 0x3F, 0xFD,
+    0xA2, 0x9F, 0xFD, 0x93, 0x99, 0x99, 0x9F, 0xC7, 0x0A, 0xF7, 0x0A, 0xF9, 0x79, 0xF9, 0x70, 0xFA,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xAF, 0x70, 0x9F, 0x97, 0x9F, 0xA9, 0x99, 0x99, 0x3F, 0xFE, 0x92,
+    0xFF, 0xE2, 0x9F, 0xFE, 0x20, 0x69, 0x99, 0x59, 0x97, 0xAE, 0x2A, 0xE7, 0x0E, 0xA0, 0xF7, 0x19,
+    0xFE, 0x73, 0xFD, 0x75, 0x99, 0x99, 0x77, 0x73, 0x9F, 0xFF, 0xC4, 0xAF, 0xFF, 0xC4, 0xAF, 0xFF,
+    0xA4, 0xAF, 0xFF, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73,
+    0xAF, 0x97, 0x39, 0xFA, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xAF, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xDA, 0xAA, 0xAA, 0xAA, 0xA3, 0x9F, 0xFF, 0xCA, 0x3A, 0xFF, 0xFC, 0x93, 0xFF,
+    0xFD, 0x40, 0x49, 0x99, 0x49, 0x99, 0x5A, 0xDA, 0x2A, 0xE6, 0xEA, 0x0F, 0x79, 0xFE, 0x71, 0xFD,
+    0x73, 0x99, 0x99, 0x77, 0x71, 0xFF, 0xE5, 0xFF, 0xDA, 0x49, 0xFF, 0xD9, 0x59, 0x99, 0x99, 0xFC,
+    0x72, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xF9, 0x72, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xAF, 0x72,
+    0x9F, 0x97, 0x19, 0xFA, 0x99, 0x99, 0x95, 0xFF, 0xE9, 0x4F, 0xFE, 0x49, 0xFF, 0xE4, 0x74, 0x99,
+    0x75, 0xAF, 0xC9, 0x71, 0xFE, 0x97, 0x0A, 0xFE, 0x71, 0xFA, 0x19, 0x70, 0x9F, 0x74, 0xAE, 0xA7,
+    0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74,
+    0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74,
+    0x9F, 0x74, 0xAF, 0x74, 0xFA, 0x70, 0x9A, 0xAF, 0xC7, 0x1A, 0xFD, 0xA7, 0x1A, 0xFD, 0x72, 0x9F,
+    0xA7, 0x30, 0x77, 0x77, 0x74, 0xF9, 0x69, 0xAF, 0xD9, 0x29, 0xF6, 0xAF, 0xFD, 0x1A, 0xEA, 0x5F,
+    0xFF, 0xCA, 0xF5, 0xFD, 0xAA, 0xAF, 0xFC, 0x5F, 0xCA, 0x4F, 0xDA, 0x59, 0xFA, 0x59, 0xF9, 0x6F,
+    0xC7, 0xF9, 0x59, 0xF9, 0x7F, 0x95, 0xAF, 0x70, 0xF9, 0x5F, 0xA7, 0x0F, 0x95, 0xF9, 0x79, 0xF6,
+    0xF9, 0x79, 0xF6, 0xF7, 0x0A, 0xF6, 0xF7, 0x0F, 0x96, 0xF9, 0x6A, 0xF7, 0xFA, 0x59, 0xFA, 0x7F,
+    0xC4, 0x9F, 0xC7, 0x09, 0xFC, 0xA9, 0x9F, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x3F, 0xFE, 0x97, 0x59,
+    0xFE, 0xA7, 0x73, 0x97, 0x70, 0x77, 0x99, 0x99, 0x77, 0x0F, 0x77, 0x9F, 0x5A, 0xFC, 0xA2, 0xF9,
+    0x39, 0xFF, 0xC9, 0xFA, 0x39, 0xFF, 0xFD, 0xA4, 0xFC, 0x99, 0xAF, 0xD9, 0x4A, 0xF9, 0x2F, 0xA6,
+    0xFA, 0x3A, 0xF5, 0x9F, 0x4A, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0xA5, 0xAE, 0xA4, 0xF9,
+    0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0x3F, 0xA6, 0x9F, 0xA0, 0x9F, 0xC7, 0x0F, 0xFE, 0xA7, 0x1F, 0xFC,
+    0xA7, 0x3A, 0xFC, 0xA9, 0x77, 0x97, 0x50, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x93, 0xAF, 0xC9, 0x7F,
+    0xFD, 0xA0, 0x9F, 0xFA, 0x49, 0xFF, 0xFF, 0xFE, 0x92, 0x9F, 0xDA, 0xAF, 0xFC, 0xAA, 0xFC, 0xA2,
+    0xFC, 0x93, 0x9F, 0xC9, 0x3F, 0xC1, 0xAF, 0x95, 0xAF, 0x49, 0xF1, 0xFA, 0x69, 0xF4, 0x9F, 0x09,
+    0xF7, 0x9F, 0x4A, 0xEA, 0x0F, 0xA7, 0x9F, 0x4F, 0x90, 0xF9, 0x79, 0xF4, 0xF0, 0x9F, 0x70, 0xAF,
+    0x39, 0xF0, 0x9F, 0x70, 0xAF, 0x3A, 0xEA, 0x09, 0xF7, 0x0F, 0xA3, 0xAE, 0xA0, 0x9F, 0x79, 0xF9,
+    0x3F, 0x90, 0x9F, 0x7F, 0xC4, 0xF1, 0x9F, 0x95, 0xAF, 0x93, 0x9F, 0x2F, 0xC4, 0xAF, 0xC4, 0xAE,
+    0xA2, 0xAF, 0xCA, 0x9A, 0xFD, 0x5F, 0x93, 0xFF, 0xFC, 0x95, 0xF5, 0xFF, 0xE7, 0xF6, 0xAF, 0xE9,
+    0x79, 0xF7, 0x19, 0x97, 0x73, 0x77, 0x74, 0xAF, 0xCA, 0x29, 0xFC, 0x94, 0x9F, 0xFC, 0x9F, 0xFA,
+    0x29, 0xFF, 0xFF, 0xF2, 0xFC, 0x99, 0xAF, 0xCA, 0x99, 0xAF, 0x90, 0xAF, 0x92, 0xFA, 0x3F, 0xA0,
+    0xFA, 0x3A, 0xF3, 0xF9, 0x9F, 0x4A, 0xF3, 0xF9, 0x9F, 0x4A, 0xEA, 0x3F, 0x0A, 0xEA, 0x4F, 0xA2,
+    0x9F, 0x0A, 0xEA, 0x4F, 0x92, 0xAE, 0xA0, 0xAE, 0xA3, 0x9F, 0x3F, 0x90, 0xAF, 0x3F, 0xA3, 0xF1,
+    0x9F, 0xA0, 0x9F, 0xC4, 0xF2, 0xFF, 0xEA, 0x39, 0xF3, 0xFF, 0xCA, 0x4A, 0xEA, 0x4A, 0xFC, 0xA9,
+    0x5F, 0x97, 0x97, 0x1F, 0x77, 0x29, 0xF7, 0x72, 0xAF, 0x77, 0x2A, 0xEA, 0x77, 0x2F, 0x97, 0x72,
+    0xF7, 0x72, 0x9F, 0x30, 0x29, 0xAF, 0xFD, 0xA9, 0x5A, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xC2, 0xFF,
+    0xFF, 0xDA, 0x09, 0xE9, 0x0A, 0xF3, 0xFC, 0x0A, 0xE1, 0xFA, 0x39, 0xF0, 0x9D, 0xA1, 0xF9, 0x4F,
+    0x6F, 0x49, 0xF5, 0x9F, 0x4F, 0xC5, 0xAF, 0x29, 0xFC, 0x95, 0xFF, 0xFD, 0x6F, 0xFF, 0xC7, 0xFF,
+    0xE9, 0x79, 0xFA, 0xAA, 0xA9, 0x72, 0xAE, 0xA7, 0x7F, 0x97, 0x7F, 0x97, 0x69, 0xF7, 0x7A, 0xF7,
+    0x7A, 0xEA, 0x77, 0xF9, 0x74, 0x70, 0x99, 0x97, 0x4A, 0xFA, 0x72, 0xAF, 0xCA, 0x72, 0xFD, 0xA7,
+    0x1A, 0xF7, 0x4F, 0xA7, 0x4F, 0x97, 0x4F, 0x0A, 0xF6, 0x9F, 0xFE, 0x5A, 0xFF, 0xEA, 0x4F, 0xD9,
+    0x9F, 0xC4, 0xFC, 0x2A, 0xF3, 0x9F, 0x92, 0x9F, 0x39, 0xF3, 0x9F, 0x3A, 0xE9, 0x39, 0xF3, 0xF4,
+    0xAF, 0x3F, 0x4F, 0xA2, 0x9F, 0x39, 0xF9, 0x2A, 0xF9, 0x2F, 0xC3, 0xAF, 0xC9, 0x9F, 0xC9, 0x3F,
+    0xFF, 0xA4, 0xFA, 0xFE, 0x49, 0xF0, 0xAF, 0xA5, 0xAE, 0xA2, 0x97, 0x0F, 0xA7, 0x4F, 0x97, 0x4F,
+    0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x40, 0x4F, 0x97, 0x3F, 0x97, 0x29, 0xF7, 0x3A, 0xFE,
+    0xA9, 0x6F, 0xFD, 0xA5, 0xFF, 0xEA, 0x4F, 0xAA, 0xFD, 0x39, 0xF2, 0xAF, 0x92, 0xAF, 0x3F, 0x92,
+    0xFA, 0x3F, 0x92, 0xF9, 0x29, 0xF2, 0x9F, 0x3F, 0xC2, 0x9F, 0xAA, 0xFD, 0x92, 0xAF, 0xFE, 0x93,
+    0xFF, 0xE9, 0x4F, 0xFD, 0x59, 0xF1, 0xF9, 0x4A, 0xF1, 0xAF, 0x4A, 0xEA, 0x2F, 0x93, 0xF9, 0x2F,
+    0xA3, 0xF9, 0x29, 0xF7, 0x4F, 0xA7, 0x3A, 0xF7, 0x39, 0xF9, 0x00, 0x77, 0x49, 0xAF, 0xCA, 0x59,
+    0xFF, 0xD5, 0xFF, 0xE4, 0xAD, 0xAA, 0xAF, 0xC9, 0x49, 0x4F, 0xA7, 0x2A, 0xEA, 0x72, 0xFA, 0x70,
+    0x9F, 0xC7, 0x9F, 0xDA, 0x5A, 0xFF, 0x4A, 0xFF, 0xA4, 0xAF, 0xEA, 0x5A, 0xFD, 0x97, 0xFC, 0x97,
+    0x09, 0xF7, 0x29, 0xF7, 0x29, 0xF6, 0x93, 0xFC, 0x99, 0x9A, 0xE3, 0xFF, 0xF4, 0xFF, 0xE5, 0xAF,
+    0xEA, 0x71, 0x99, 0x70, 0x77, 0x09, 0xFE, 0x93, 0xAF, 0xFC, 0xA2, 0x9F, 0xFD, 0x3C, 0xA9, 0x2F,
+    0x97, 0x0F, 0x97, 0xAF, 0x5A, 0xFE, 0x3A, 0xFF, 0x29, 0xFF, 0x93, 0xFD, 0xA9, 0x49, 0xF9, 0x7A,
+    0xEA, 0x70, 0xAF, 0x39, 0xA9, 0x19, 0xFF, 0xD9, 0x2A, 0xFF, 0xC9, 0x39, 0xFE, 0xA7, 0x99, 0x60,
+    0x4A, 0xFF, 0xF5, 0xFF, 0xFC, 0x5F, 0xFF, 0xA5, 0xFA, 0xFE, 0x95, 0xF9, 0x75, 0x9F, 0x76, 0xF9,
+    0x75, 0xAE, 0xA7, 0x6F, 0x76, 0xFA, 0x75, 0xF9, 0x74, 0xAE, 0xA7, 0x4A, 0xEA, 0x74, 0xAF, 0x74,
+    0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x97, 0x4F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0xFF, 0xFC, 0xA3,
+    0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xD4, 0x39, 0x95, 0xFD, 0x2F, 0xF0, 0x9D, 0x90, 0xF0, 0x9D, 0x1F,
+    0x1E, 0xAF, 0x1A, 0xFE, 0x29, 0xAF, 0xA4, 0xAE, 0x94, 0xF5, 0xF4, 0x9F, 0x4A, 0xEA, 0x4F, 0x94,
+    0xF5, 0xF4, 0x9E, 0xA4, 0xAE, 0xA4, 0xF9, 0x4F, 0x49, 0xF4, 0xAE, 0xA4, 0xAE, 0x94, 0xF5, 0xF4,
+    0x9F, 0x49, 0xFA, 0x9A, 0xC1, 0xFF, 0x1A, 0xFE, 0x29, 0xFA, 0x90, 0x59, 0x97, 0x0E, 0x7A, 0xE7,
+    0xEA, 0x5A, 0xFF, 0x99, 0xFF, 0xD0, 0x9F, 0xFD, 0x19, 0xAF, 0x99, 0x99, 0x2F, 0xA6, 0xF9, 0x6F,
+    0x69, 0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x96, 0xF6, 0x9F, 0x90, 0x99, 0x3F, 0xF3, 0xFF, 0x4F, 0xDA,
+    0x69, 0xE9, 0x7E, 0x79, 0xE6, 0x9E, 0xA4, 0xFD, 0x94, 0xFC, 0xA5, 0xAE, 0xA5, 0x29, 0xAF, 0xFF,
+    0xA1, 0xAF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFE, 0x90, 0xFF, 0xFF, 0x09, 0xE9, 0x19, 0xF5, 0xAE, 0x2A,
+    0xEA, 0x59, 0xDA, 0x2F, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74,
+    0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4F,
+    0xA7, 0x00, 0x79, 0x97, 0xFC, 0xA4, 0xFD, 0xA3, 0xAF, 0xDA, 0x3F, 0xA1, 0x92, 0x9F, 0x6A, 0xEA,
+    0x5A, 0xFF, 0x99, 0xFF, 0xD0, 0x9F, 0xFD, 0x19, 0xAF, 0x99, 0x99, 0x2F, 0xA6, 0xF9, 0x6F, 0x69,
+    0xF6, 0xAE, 0xA6, 0xF9, 0x6F, 0x96, 0xF6, 0x9F, 0x90, 0x99, 0x3F, 0xEA, 0x3F, 0xEA, 0x4F, 0xD9,
+    0x69, 0x95, 0x0A, 0xFF, 0xFC, 0x90, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0x09, 0xFF, 0xFC, 0xA5, 0xAE,
+    0xA7, 0x2F, 0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7,
+    0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x2F,
+    0x72, 0x9F, 0x72, 0xAF, 0x72, 0xAE, 0xA7, 0x2F, 0xCA, 0xA9, 0x7A, 0xFD, 0x97, 0x0F, 0xD9, 0x71,
+    0xAF, 0x96, 0x77, 0x77, 0x74, 0xAF, 0x2F, 0x6F, 0x90, 0xF9, 0x19, 0xF6, 0xF0, 0x9F, 0x29, 0xF5,
+    0x9F, 0x9F, 0x92, 0xAE, 0xA5, 0xAF, 0xF9, 0x3F, 0x95, 0xFE, 0xA5, 0xF6, 0xFA, 0x96, 0x9F, 0x59,
+    0xF7, 0x0A, 0xF5, 0x9F, 0x70, 0xFA, 0x5A, 0xEA, 0x70, 0xF9, 0x5F, 0x97, 0x0F, 0x6F, 0x70, 0x9F,
+    0x59, 0xF7, 0x0A, 0xF5, 0xAF, 0x70, 0xFA, 0x5F, 0xA7, 0x0F, 0x95, 0xF9, 0x70, 0xF9, 0x49, 0xF7,
+    0x1F, 0xA4, 0xFA, 0x71, 0xAF, 0xC9, 0x9A, 0xFC, 0x73, 0xFF, 0xF9, 0x73, 0x9F, 0xFD, 0x97, 0x59,
+    0xFE, 0xA7, 0x73, 0x97, 0x71, 0x77, 0x29, 0x99, 0x77, 0x2F, 0xA7, 0x71, 0xF9, 0x19, 0xF4, 0xF0,
+    0xAF, 0x2A, 0xEA, 0x39, 0xFA, 0xF3, 0xFA, 0x3A, 0xFF, 0x4F, 0x93, 0xFE, 0xA5, 0xF4, 0xF9, 0x79,
+    0xF3, 0x9F, 0x70, 0xAE, 0xA3, 0xAF, 0x70, 0xF9, 0x3F, 0xA7, 0x0F, 0x4F, 0x97, 0x0F, 0x39, 0xF7,
+    0x09, 0xF3, 0xFC, 0x70, 0x9F, 0x29, 0xFA, 0x70, 0x9F, 0x90, 0xAF, 0xC9, 0x71, 0xFF, 0xAE, 0x97,
+    0x1F, 0xEA, 0x9E, 0x73, 0xFC, 0x90, 0x9E, 0x75, 0x97, 0x71, 0x09, 0x99, 0x93, 0xFA, 0x3F, 0x39,
+    0xE9, 0x39, 0xE4, 0x99, 0x90, 0x39, 0x99, 0x93, 0xFA, 0x2F, 0xA2, 0xAE, 0x92, 0x9E, 0x94, 0x99,
+    0x50, 0x49, 0x99, 0x95, 0x9F, 0xCA, 0x39, 0xFE, 0x29, 0xEA, 0x0F, 0x09, 0xE9, 0x2E, 0x99, 0x99,
+    0x59, 0x99, 0x76, 0xAE, 0x91, 0x9D, 0x1A, 0xFD, 0xAD, 0xA0, 0x9F, 0xFD, 0x1A, 0xD1, 0x9F, 0x91,
+    0x99, 0x49, 0x93, 0x09, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFC, 0x9F, 0xFA, 0x09, 0x99, 0x99, 0x99,
+    0x90, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF1, 0xFF, 0xEA, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x10, 0x09, 0x94, 0x99, 0x99, 0xD9, 0x3D, 0xA0, 0xEA, 0xAA, 0xE9, 0x0F, 0xFA, 0x2A,
+    0xFC, 0xA5, 0x99, 0x40, 0x5E, 0xAA, 0xFF, 0xC9, 0xE9, 0x40, 0x09, 0xD9, 0x1D, 0xA1, 0xEA, 0x0A,
+    0xE1, 0xEA, 0x0A, 0xE1, 0xAC, 0xA1, 0x9D, 0x90, 0x6A, 0xFA, 0x0A, 0xFC, 0x99, 0x09, 0xEA, 0x2E,
+    0x90, 0xAE, 0xA1, 0xE9, 0x2A, 0xA9, 0x20, 0x29, 0x93, 0xAF, 0x90, 0x9D, 0xAE, 0x0A, 0xCA, 0x1D,
+    0x9A, 0xCA, 0x1D, 0x99, 0xDA, 0xE1, 0xAF, 0x93, 0x99, 0x20, 0x29, 0x99, 0x91, 0x99, 0x99, 0x29,
+    0xF0, 0x9F, 0x2F, 0x1F, 0x2E, 0xA1, 0xEA, 0x2A, 0xD9, 0x1A, 0xD9, 0x39, 0x93, 0x99, 0x50, 0x99,
+    0x95, 0x99, 0x99, 0xE2, 0x9E, 0x90, 0xF0, 0xAE, 0x92, 0xFE, 0x93, 0xAF, 0xC9, 0x59, 0x99, 0x94,
+    0x19, 0x99, 0x1E, 0x09, 0xDA, 0x0A, 0xD9, 0x0E, 0x1E, 0x1D, 0xA0, 0x9D, 0xA0, 0x9A, 0xA1, 0x09,
+    0x99, 0x19, 0x99, 0x1E, 0x1E, 0x09, 0xDA, 0x09, 0xDA, 0x09, 0xD9, 0x09, 0xD9, 0x0A, 0xD9, 0x0A,
+    0xD1, 0xAA, 0xA1, 0xAA, 0xA1, 0x09, 0x99, 0x91, 0x99, 0x92, 0xF0, 0x9E, 0xA2, 0xE9, 0x0A, 0xE2,
+    0x9E, 0x1E, 0x92, 0x9D, 0x91, 0xE3, 0x99, 0x39, 0x90, 0x39, 0xD7, 0xEA, 0x39, 0x90, 0xE9, 0x09,
+    0x90, 0xD0, 0x9A, 0x90, 0xAC, 0xA0, 0xDA, 0x2A, 0xD1, 0xAF, 0xEA, 0x2A, 0xFC, 0xA5, 0x99, 0x40,
+    0x39, 0x99, 0x5A, 0xFD, 0x2F, 0xFC, 0x09, 0xEA, 0xAA, 0xE0, 0xAD, 0x39, 0xD9, 0x99, 0x59, 0x90,
+    0x3E, 0x92, 0xAE, 0x3E, 0xA2, 0xAE, 0x29, 0xF2, 0xF9, 0x19, 0xF3, 0x99, 0x93, 0x2F, 0x92, 0xF2,
+    0xAE, 0x92, 0xF2, 0x9E, 0x92, 0xF3, 0xE4, 0x99, 0x93, 0xF0, 0xF0, 0xF0, 0xAE, 0x09, 0xE0, 0x9E,
+    0x1E, 0x19, 0x99, 0x00, 0x2F, 0x92, 0xF2, 0xAE, 0x92, 0xF2, 0x9E, 0x92, 0xF3, 0xE4, 0x99, 0x93,
+    0x09, 0x99, 0x91, 0x9F, 0x2A, 0xE9, 0x2E, 0xA3, 0xE4, 0x99, 0x00, 0x39, 0x99, 0x93, 0xAF, 0x29,
+    0xF3, 0xF3, 0xEA, 0x49, 0x99, 0x40, 0x72, 0x9C, 0xA1, 0x99, 0xAC, 0x90, 0xFC, 0x19, 0x99, 0xD4,
+    0xD4, 0x91, 0x79, 0xC9, 0x3A, 0xC9, 0x99, 0x1F, 0xC1, 0xD9, 0x99, 0x09, 0xCA, 0x49, 0x40, 0x72,
+    0xFF, 0x1A, 0xAA, 0xAA, 0xAD, 0x69, 0xCA, 0x69, 0xC9, 0x6A, 0xC7, 0xD7, 0xD7, 0xA9, 0x10, 0x39,
+    0x99, 0x93, 0x9F, 0x3A, 0xF3, 0xF9, 0x1A, 0xFA, 0x19, 0xFA, 0x2A, 0xDA, 0x75, 0x19, 0xCA, 0x0A,
+    0xD9, 0x0D, 0x90, 0x9D, 0x19, 0xD9, 0x1D, 0xA2, 0xA9, 0x00, 0x2A, 0xA4, 0xD3, 0x9C, 0xA1, 0x9A,
+    0xEA, 0x9F, 0xD9, 0x60, 0x0A, 0xAA, 0xAA, 0xA1, 0xFD, 0x29, 0xCA, 0x49, 0xC9, 0x4A, 0xC7, 0x30,
+    0x71, 0xD4, 0xD1, 0x9F, 0xCA, 0x9A, 0xEA, 0x91, 0xAC, 0x4A, 0xA2, 0x9A, 0xAA, 0xAA, 0xAF, 0xDA,
+    0x60, 0x49, 0x99, 0x49, 0xE9, 0x3A, 0xE4, 0xAE, 0x4E, 0xA3, 0xAE, 0x91, 0xFD, 0x2F, 0xC9, 0x2F,
+    0x92, 0x1A, 0xAA, 0x39, 0xE3, 0xAE, 0x3F, 0x3E, 0xA3, 0xF9, 0xA1, 0xFD, 0x19, 0xFC, 0x3A, 0xAA,
+    0x90, 0x69, 0xE1, 0xFA, 0x0F, 0x90, 0xF6, 0x09, 0xD9, 0x1D, 0xA1, 0xEA, 0x0A, 0xE1, 0xEA, 0x0A,
+    0xE1, 0xAC, 0xA1, 0x9D, 0x90, 0x19, 0x99, 0x3F, 0xC1, 0xAD, 0xAE, 0x0D, 0x91, 0xD0, 0xD9, 0x1D,
+    0x0A, 0xDA, 0xE1, 0xFC, 0x49, 0x30, 0x70, 0xF9, 0x1E, 0xA1, 0xAE, 0x2E, 0x39, 0x99, 0x20, 0x2D,
+    0xA3, 0xF9, 0x29, 0xF4, 0xE0, 0x99, 0x9F, 0x09, 0xFC, 0xA0, 0x9F, 0x91, 0x2E, 0x2E, 0x2E, 0x92,
+    0xE3, 0xEA, 0xA1, 0xFC, 0x91, 0xF7, 0x19, 0x99, 0x2E, 0x19, 0xDA, 0x19, 0xD9, 0x1A, 0xD2, 0xE2,
+    0xE1, 0x9D, 0xA1, 0x9A, 0xA2, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x9F, 0xFD, 0x1A, 0xC9, 0x5D,
+    0x1D, 0x59, 0xCA, 0x1D, 0x5A, 0xC9, 0x19, 0x96, 0x91, 0x73, 0xAC, 0x2C, 0xA1, 0x9C, 0x9A, 0xCA,
+    0x9E, 0x99, 0xD1, 0xF9, 0xF7, 0x50, 0x09, 0x95, 0x99, 0x91, 0xE2, 0x9E, 0xA1, 0xAE, 0x0A, 0xE9,
+    0x3F, 0xE9, 0x49, 0xFC, 0xA6, 0x99, 0x99, 0x94, 0x49, 0x99, 0x97, 0xFD, 0x5F, 0xEA, 0x3F, 0x0A,
+    0xE2, 0xEA, 0x2A, 0xE1, 0x99, 0x59, 0x99, 0x00, 0x09, 0x95, 0x99, 0x1D, 0xA3, 0xE1, 0xFA, 0xAE,
+    0xA1, 0x9F, 0xF3, 0xAF, 0xCA, 0x69, 0x99, 0x40, 0x39, 0x99, 0x94, 0x9F, 0xD9, 0x19, 0xFF, 0x1E,
+    0xAA, 0xAE, 0xA9, 0xD9, 0x3D, 0xA0, 0x99, 0x49, 0x90, 0x76, 0x9E, 0x92, 0xD9, 0x09, 0xFD, 0xAE,
+    0x1F, 0xFD, 0xA0, 0x9D, 0x2A, 0xEA, 0x29, 0x94, 0x93, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC,
+    0x1F, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x91, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF,
+    0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF,
+    0xE9, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x77, 0xAD, 0xA2, 0xAD, 0x1F, 0xDA, 0xAD, 0xA0,
+    0x9F, 0xFD, 0x1D, 0xA1, 0xAF, 0x91, 0x99, 0x49, 0x92, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99,
+    0xFF, 0xEA, 0x9F, 0xFE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0F, 0xFF, 0xFF, 0xA9, 0xFF,
+    0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0x97, 0x75, 0x77, 0x3A, 0xC7, 0x9E, 0xA5, 0xFC, 0xA3, 0xAF, 0xC9,
+    0x29, 0xFC, 0x94, 0xFA, 0x7D, 0x97, 0x09, 0x70, 0x77, 0x77, 0xE7, 0x5A, 0xD9, 0x75, 0xDA, 0x75,
+    0xAD, 0x75, 0x9D, 0xA7, 0x5E, 0x75, 0x9D, 0x97, 0x5E, 0x75, 0xAD, 0x97, 0x5D, 0xA7, 0x5A, 0xD7,
+    0x59, 0xDA, 0x75, 0xE7, 0x59, 0xD9, 0x75, 0xE7, 0x5A, 0xD9, 0x75, 0xDA, 0x75, 0xAD, 0x75, 0x9D,
+    0xA7, 0x5E, 0x75, 0x9D, 0x97, 0x5E, 0x75, 0xAD, 0x97, 0x5A, 0xAA, 0x75, 0x1A, 0xA3, 0xDA, 0x29,
+    0xD3, 0xD2, 0xAD, 0x1E, 0x91, 0xCA, 0x91, 0x0A, 0xA5, 0x9A, 0x1D, 0x5A, 0xC0, 0x9C, 0xA5, 0xD0,
+    0xAC, 0xA9, 0x99, 0x99, 0x9D, 0x0F, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x74, 0xFF,
+    0xD1, 0xCA, 0x99, 0x99, 0x99, 0xD0, 0x9C, 0x95, 0xCA, 0x0A, 0xC5, 0x9C, 0x90, 0xAF, 0xFC, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x75, 0xF9, 0xEA, 0x1D, 0x99, 0xDA, 0x9A, 0xC9, 0xAC, 0x2C, 0xA1,
+    0x9C, 0x97, 0x30, 0x19, 0x5A, 0xC9, 0x9D, 0x19, 0xF3, 0xE3, 0xFC, 0x19, 0xC9, 0x0D, 0x71, 0x71,
+    0xAD, 0x91, 0xAD, 0x92, 0xD9, 0x3A, 0xCA, 0x4D, 0x4D, 0x3A, 0xD2, 0xDA, 0x71, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x19, 0xFF, 0xE9, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x79, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x09, 0x99, 0x92,
+    0xFA, 0x2F, 0x29, 0xE9, 0x29, 0xE3, 0x99, 0x90, 0x29, 0x99, 0x99, 0x19, 0xF9, 0x1F, 0x91, 0xAE,
+    0x91, 0xAE, 0x39, 0x99, 0x40, 0x76, 0x9E, 0x92, 0xD9, 0x09, 0xFD, 0xAE, 0x1F, 0xFD, 0xA0, 0x9D,
+    0x19, 0xFA, 0x29, 0x94, 0x93, 0x9A, 0xAA, 0x1A, 0xF0, 0x99, 0xE2, 0xE2, 0xD9, 0x29, 0x91, 0x69,
+    0xAA, 0xAA, 0x6D, 0xA1, 0xFA, 0x0D, 0xA1, 0xF0, 0xAE, 0xA0, 0xF1, 0xEA, 0x0F, 0x1F, 0x1A, 0xCA,
+    0x09, 0xE2, 0xAC, 0xA7, 0x99, 0x70, 0x6E, 0x91, 0xE9, 0x09, 0xEA, 0x99, 0xF9, 0x0A, 0xE0, 0x75,
+    0xFF, 0xF9, 0xDA, 0xAA, 0xAA, 0xAA, 0xAC, 0xA9, 0xC9, 0x6A, 0xC9, 0xAC, 0x7D, 0x0A, 0xA7, 0xAA,
+    0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xE9, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA7, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x90, 0x09, 0x99, 0x19, 0x99, 0x1E, 0x1E, 0x1D, 0xA1, 0xDA, 0x09, 0xDA, 0x09, 0xD9, 0x0A, 0xD9,
+    0x0A, 0xD9, 0x09, 0xAA, 0x19, 0xAA, 0x10, 0x09, 0x99, 0x90, 0xAF, 0xA9, 0xAA, 0xD9, 0x2A, 0xC3,
+    0xD3, 0xD0, 0x59, 0x69, 0x09, 0xC9, 0x09, 0x90, 0xAF, 0xC0, 0x9C, 0xA9, 0xDA, 0xFD, 0x0A, 0xC1,
+    0xFC, 0x90, 0x99, 0x0A, 0xC1, 0x97, 0x50, 0x59, 0x97, 0x0E, 0x97, 0xE9, 0x7E, 0x59, 0xAA, 0x92,
+    0x9C, 0x19, 0xFC, 0x99, 0xD1, 0xD9, 0xAF, 0xC9, 0x09, 0xC9, 0x2A, 0xD9, 0x5A, 0xC9, 0x7A, 0xE7,
+    0xAD, 0xA7, 0x0A, 0xA5, 0x75, 0x9E, 0xA1, 0xAC, 0x2F, 0xFA, 0x1A, 0xC9, 0x09, 0xEA, 0x77, 0xAD,
+    0x91, 0x9C, 0x91, 0xFF, 0xC1, 0xAC, 0x90, 0x9F, 0x29, 0x93, 0x99, 0x30, 0x3A, 0x19, 0x93, 0x9C,
+    0xA1, 0xAC, 0x91, 0xFF, 0xCA, 0x09, 0xDA, 0xAA, 0xDA, 0x29, 0xC2, 0xC7, 0x50, 0x79, 0xC2, 0x9E,
+    0x1A, 0xDA, 0x91, 0xD2, 0x9C, 0xA2, 0xAC, 0x91, 0x9F, 0x3F, 0x3F, 0x99, 0xF3, 0xF3, 0xF9, 0x9C,
+    0x77, 0x1C, 0x99, 0xC7, 0x99, 0x7C, 0x99, 0xA5, 0xC0, 0xAA, 0x0C, 0x5A, 0x95, 0xA0, 0x93, 0x90,
+    0xA7, 0x3C, 0x7C, 0x71, 0x9A, 0x71, 0x99, 0x39, 0xA1, 0x9A, 0x71, 0xAA, 0x1A, 0x99, 0xC7, 0x71,
+    0xC9, 0x9C, 0x1C, 0x97, 0x2C, 0x1C, 0x99, 0xC1, 0x97, 0x39, 0x1C, 0x99, 0xC1, 0x9A, 0x71, 0x99,
+    0x1C, 0x93, 0x9A, 0x71, 0xAA, 0x71, 0xA7, 0xA7, 0x3C, 0x09, 0x39, 0x0C, 0x6A, 0x49, 0xC0, 0xAA,
+    0x0C, 0x94, 0xA0, 0x9C, 0x79, 0x97, 0xC9, 0x9C, 0x77, 0x1C, 0x99, 0xCA, 0xAA, 0x3A, 0xAA, 0xA3,
+    0xAA, 0xAC, 0x99, 0xF2, 0x9F, 0x92, 0xF9, 0x4C, 0xA2, 0xAD, 0xA2, 0xE0, 0x9F, 0xD9, 0x0A, 0x30,
+    0x19, 0xAC, 0x19, 0xE1, 0xDA, 0x2D, 0x3D, 0xA2, 0xAD, 0x39, 0xA1, 0x29, 0xAD, 0xA9, 0x3F, 0xEA,
+    0x1A, 0xDA, 0xAA, 0xE1, 0xD9, 0x3D, 0x99, 0xCA, 0x0E, 0x0A, 0xCA, 0x29, 0xE9, 0x6E, 0x70, 0x94,
+    0x7A, 0x90, 0xA2, 0xFA, 0x19, 0xE2, 0xF9, 0x1D, 0x9C, 0xA7, 0x39, 0x91, 0xAD, 0x90, 0xE9, 0x1D,
+    0xA2, 0x9A, 0xD9, 0x3A, 0xA0, 0xA9, 0x3A, 0xDA, 0x29, 0xE2, 0xAD, 0x09, 0xDA, 0x90, 0xAA, 0x30,
+    0xA9, 0x49, 0x92, 0xAD, 0x92, 0xDA, 0x29, 0xE0, 0x9E, 0x3E, 0x0A, 0xC9, 0xC9, 0x0A, 0xDA, 0x1C,
+    0xA0, 0xCA, 0x0C, 0x92, 0xAC, 0x19, 0xC0, 0x1A, 0xA3, 0xDA, 0x2A, 0xD3, 0xD2, 0xAD, 0x1E, 0x91,
+    0xCA, 0x91, 0x5E, 0xAA, 0xFF, 0xC9, 0xE5, 0x2C, 0xA2, 0xA0, 0xCA, 0x99, 0x0F, 0xCA, 0x1A, 0xD9,
+    0x19, 0xCA, 0xD2, 0xA0, 0xA9, 0x00, 0x74, 0xAE, 0x9A, 0xE9, 0x09, 0xCA, 0x9A, 0xD9, 0x9D, 0x0A,
+    0xC2, 0xCA, 0x2C, 0x9A, 0xC2, 0xCA, 0x2C, 0x99, 0xCA, 0x9E, 0xA9, 0xD1, 0x9E, 0x99, 0xE1, 0x0C,
+    0x92, 0x9C, 0x3A, 0xF9, 0xAA, 0xAD, 0x3A, 0xC3, 0xA9, 0x00, 0xAD, 0x77, 0xAD, 0x09, 0xE9, 0x73,
+    0x9E, 0x91, 0xAE, 0xA9, 0x69, 0xAF, 0x93, 0xAF, 0xFF, 0xF9, 0x59, 0xFF, 0xFC, 0xA7, 0x19, 0xAF,
+    0xEA, 0x96, 0x9D, 0x97, 0x6A, 0xD1, 0xE9, 0x73, 0x9E, 0xA1, 0xAF, 0x97, 0x9F, 0xA3, 0xAF, 0xFF,
+    0xF9, 0x59, 0xFF, 0xFC, 0xA7, 0x2A, 0xAF, 0xDA, 0x96, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x90, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xDA, 0xAF, 0xFF, 0xD9, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x72, 0xAF, 0xDA, 0xA9, 0x69, 0xD2, 0xFF, 0xFD, 0xAA, 0xAE,
+    0xA1, 0xFA, 0xAF, 0xFF, 0xE1, 0x9D, 0x95, 0x9A, 0xAF, 0xEA, 0x39, 0x76, 0x95, 0x77, 0x75, 0xAF,
+    0xEA, 0xA7, 0x19, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xC9, 0x3F, 0xA9, 0x7A, 0xF2, 0xEA, 0x74, 0xAD,
+    0xA0, 0xAA, 0xA9, 0x76, 0xAA, 0xA0, 0x77, 0x77, 0x72, 0xC9, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x9D, 0xA2, 0xFF, 0xFF, 0xFD, 0x09, 0xFF, 0xFF, 0xFC, 0x77, 0x4C, 0xA7, 0x75,
+    0x93, 0x2A, 0x90, 0x91, 0x9F, 0xC9, 0x0D, 0x1D, 0x09, 0xCA, 0x1D, 0x09, 0xCA, 0x09, 0xCA, 0x09,
+    0xD9, 0xD9, 0x1E, 0xAC, 0x71, 0x29, 0xAA, 0x3D, 0xAD, 0x1A, 0xC9, 0x0D, 0x1F, 0xCA, 0x1D, 0x99,
+    0x3D, 0x99, 0xA2, 0x9F, 0x71, 0x1D, 0x2A, 0xA2, 0x92, 0xAC, 0x91, 0xD2, 0xD1, 0x9C, 0xA1, 0xAC,
+    0x91, 0xAC, 0x20, 0x29, 0xA9, 0x29, 0xFA, 0x1D, 0x1D, 0x09, 0xCA, 0x1D, 0x09, 0xC9, 0x1D, 0x09,
+    0xD9, 0xD9, 0x1A, 0xE9, 0x71, 0x19, 0x29, 0x1A, 0xC1, 0xAC, 0x90, 0xD1, 0xD1, 0xD1, 0xD0, 0x9C,
+    0xA0, 0x9C, 0xA0, 0x9D, 0x9D, 0x91, 0xDA, 0x9C, 0x71, 0x2A, 0xA9, 0x1A, 0xF0, 0x9D, 0x3A, 0xC9,
+    0x3D, 0x4A, 0xCA, 0x9A, 0x2A, 0xE7, 0x00, 0x5D, 0x6D, 0x3A, 0x99, 0xCA, 0x19, 0xFC, 0x91, 0xD1,
+    0xD1, 0x9C, 0xA1, 0xD1, 0x9C, 0x90, 0x9C, 0xA1, 0x9D, 0x9D, 0x92, 0xAD, 0xAC, 0x73, 0x1D, 0x5D,
+    0x49, 0xCA, 0x9A, 0x2A, 0xFC, 0x1D, 0x90, 0xD1, 0xD1, 0xD0, 0x9C, 0xA0, 0x9C, 0xA0, 0xAC, 0x90,
+    0x9C, 0x90, 0xAC, 0x1A, 0xC1, 0x19, 0x09, 0xA1, 0x9A, 0x2A, 0xFC, 0xAE, 0x1D, 0x90, 0xD9, 0x0D,
+    0x1D, 0x1D, 0x1D, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A, 0xC9, 0x0A,
+    0xC1, 0xAC, 0x1A, 0xC1, 0x19, 0x09, 0xA1, 0x9F, 0x1A, 0xD3, 0xD4, 0xD3, 0x9C, 0xA3, 0xAC, 0x93,
+    0x2C, 0x3D, 0x99, 0x0F, 0x90, 0x9C, 0x92, 0xAC, 0x92, 0xD3, 0xD9, 0x2A, 0xD9, 0x60, 0x99, 0x29,
+    0x9D, 0x1A, 0xC9, 0xAC, 0x1C, 0xA0, 0x9C, 0x9D, 0x19, 0xCA, 0xCA, 0x2E, 0x3D, 0x92, 0x19, 0x92,
+    0x99, 0x19, 0xD0, 0xD3, 0xF4, 0x9D, 0x94, 0xE9, 0x3D, 0x9D, 0x2D, 0x90, 0xAC, 0x90, 0x72, 0xFC,
+    0x97, 0x3A, 0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71, 0xAE, 0x9A, 0xE7, 0x1F,
+    0x0A, 0xE7, 0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19, 0xE9, 0x59, 0xF2, 0x9E,
+    0xA5, 0xF9, 0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF, 0xD3, 0xFF,
+    0xFE, 0x29, 0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9, 0x9F, 0x70, 0xAE, 0xA0,
+    0x4F, 0xFA, 0x97, 0xFF, 0xE9, 0x49, 0xFF, 0xF4, 0xAF, 0xFF, 0xA3, 0xFA, 0x3F, 0xC3, 0xF9, 0x3A,
+    0xF3, 0xF4, 0xFA, 0x29, 0xF3, 0x9F, 0x3A, 0xFA, 0xAA, 0xFC, 0x93, 0xFF, 0xF9, 0x4F, 0xFE, 0x6F,
+    0xFF, 0x93, 0x9F, 0x3A, 0xF3, 0xAE, 0xA4, 0xF9, 0x2F, 0x94, 0xF9, 0x2F, 0x93, 0x9F, 0x91, 0x9F,
+    0x4F, 0xC2, 0x9F, 0xAA, 0xAF, 0xDA, 0x2A, 0xFF, 0xFC, 0x3F, 0xFF, 0xA4, 0xFF, 0xDA, 0x50, 0x4F,
+    0xFE, 0xA4, 0xFF, 0xE9, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7, 0x39,
+    0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x3F,
+    0x97, 0x29, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x73, 0xF9, 0x72, 0x72, 0xAF, 0xC7, 0x49,
+    0xFD, 0x74, 0xFE, 0x73, 0x9F, 0xE9, 0x72, 0xF9, 0xE9, 0x71, 0xAE, 0xA9, 0xEA, 0x71, 0xF1, 0xEA,
+    0x70, 0xAE, 0xA1, 0xF7, 0x0F, 0x2F, 0x7F, 0x92, 0xF6, 0x9F, 0x3F, 0x6F, 0x93, 0xAE, 0x94, 0x9F,
+    0x4A, 0xE9, 0x4F, 0x94, 0xAE, 0xA3, 0xAF, 0x59, 0xF3, 0xF9, 0x59, 0xF2, 0xAE, 0xA7, 0xF2, 0xFC,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xC1, 0xAF, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFD, 0x00,
+    0x4F, 0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0x73,
+    0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4,
+    0xFF, 0xEA, 0x4F, 0xFE, 0xA3, 0x39, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4A, 0xFF, 0xFA, 0x4A, 0xFF,
+    0xF7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xF9, 0x73,
+    0x9F, 0xA7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4A, 0xF9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74,
+    0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xD4, 0x4F,
+    0x95, 0xAE, 0x94, 0xF9, 0x5F, 0x93, 0x9F, 0x59, 0xF4, 0xAF, 0x5A, 0xF4, 0xFA, 0x5A, 0xEA, 0x4F,
+    0x95, 0xF9, 0x4F, 0x95, 0xF4, 0x9F, 0x59, 0xF4, 0xAF, 0xAA, 0xAA, 0xAA, 0xFC, 0x4F, 0xFF, 0xEA,
+    0x4F, 0xFF, 0xE9, 0x4F, 0xFF, 0xE4, 0x9F, 0x59, 0xF4, 0xAF, 0x5A, 0xEA, 0x4F, 0xA5, 0xFA, 0x4F,
+    0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x49, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0x95, 0xF9, 0x4F,
+    0x95, 0xF9, 0x30, 0x77, 0x72, 0x9A, 0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF,
+    0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90,
+    0xAF, 0x19, 0x99, 0x99, 0x1F, 0x90, 0xFA, 0x0F, 0xD9, 0x0F, 0x90, 0xF9, 0x0F, 0xD0, 0x9F, 0x1F,
+    0x90, 0xFD, 0x0A, 0xF0, 0x9F, 0x97, 0xFC, 0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x59,
+    0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC, 0xA6, 0xFF, 0xE9,
+    0x70, 0x9F, 0xEA, 0x76, 0x99, 0x71, 0x39, 0xFF, 0xA3, 0xAF, 0xFA, 0x3F, 0xFC, 0x59, 0xFC, 0x97,
+    0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE,
+    0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0x9F, 0x79, 0xFC, 0x6F, 0xFA, 0x3A, 0xFF, 0xA3, 0xAF,
+    0xF9, 0x30, 0x4F, 0x94, 0xAF, 0x5F, 0x4A, 0xF9, 0x49, 0xF3, 0x9F, 0xA5, 0xAF, 0x29, 0xFA, 0x6F,
+    0xA2, 0xFC, 0x7F, 0x91, 0xFC, 0x70, 0xF1, 0xFC, 0x70, 0x9F, 0x0A, 0xF9, 0x70, 0xAE, 0xA9, 0xFA,
+    0x71, 0xFA, 0xFA, 0x72, 0xFF, 0xC9, 0x72, 0xFF, 0xCA, 0x71, 0x9F, 0xFD, 0x71, 0xAF, 0x1F, 0x97,
+    0x0F, 0x91, 0xFC, 0x70, 0xF9, 0x1A, 0xF7, 0x9F, 0x3F, 0xA6, 0x9F, 0x3F, 0xC6, 0xAE, 0xA3, 0x9F,
+    0x95, 0xF9, 0x4F, 0xA5, 0xF5, 0xAF, 0x40, 0x71, 0x9F, 0xA7, 0x3F, 0xD7, 0x29, 0xFD, 0x72, 0xFE,
+    0x71, 0x9F, 0xE7, 0x1F, 0xAE, 0x97, 0x9E, 0xA9, 0xE9, 0x7F, 0x99, 0xE9, 0x69, 0xF0, 0x9E, 0xA6,
+    0xF9, 0x09, 0xEA, 0x59, 0xF2, 0xF5, 0xF9, 0x2F, 0x49, 0xF3, 0xF4, 0xF9, 0x3F, 0x39, 0xF4, 0xF3,
+    0xF9, 0x4F, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0x90, 0x9F, 0x6A, 0xEA, 0x0F, 0xA6, 0xAE, 0xAA,
+    0xF7, 0x9E, 0xA0, 0x4F, 0xD7, 0x9F, 0xCA, 0x4F, 0xD7, 0xFD, 0xA3, 0x9F, 0xD6, 0x9F, 0xD9, 0x3A,
+    0xFD, 0x6F, 0xE4, 0xFE, 0x59, 0xFE, 0x4F, 0xE5, 0xEA, 0xEA, 0x4E, 0xAE, 0x93, 0x9E, 0xAE, 0x93,
+    0x9E, 0x9E, 0x93, 0xEA, 0xAE, 0x93, 0xAE, 0x9E, 0x92, 0x9E, 0x0F, 0x4F, 0x0E, 0x92, 0xEA, 0x0F,
+    0x4F, 0x0E, 0xA1, 0x9E, 0x09, 0xEA, 0x4E, 0xA0, 0xAD, 0xA1, 0xEA, 0x0A, 0xE9, 0x39, 0xE9, 0x0A,
+    0xDA, 0x09, 0xE1, 0xF4, 0xAE, 0x1A, 0xDA, 0x0E, 0xA1, 0xF4, 0xF1, 0xAE, 0x9E, 0x2F, 0x4F, 0x19,
+    0xFD, 0xA1, 0x9E, 0xA3, 0x9E, 0xA1, 0x9F, 0xD2, 0xAE, 0x93, 0x9E, 0x91, 0x9F, 0xCA, 0x2F, 0x4A,
+    0xE2, 0x9F, 0xC3, 0xF4, 0xF2, 0x9F, 0xA2, 0x9E, 0xA4, 0xF3, 0xF3, 0x9E, 0xA3, 0x4F, 0xC9, 0x6A,
+    0xE5, 0xFC, 0xA6, 0xF4, 0x9F, 0xD6, 0xF4, 0xAF, 0xD9, 0x49, 0xEA, 0x4F, 0xEA, 0x4A, 0xE9, 0x4F,
+    0xF4, 0xF5, 0xEA, 0xF9, 0x3F, 0x49, 0xE9, 0xAE, 0xA2, 0x9E, 0xA4, 0xAE, 0x90, 0xF2, 0xAE, 0xA4,
+    0xF1, 0xF2, 0xAE, 0x94, 0xF1, 0xAE, 0xA1, 0xF4, 0x9E, 0xA2, 0xF1, 0xF4, 0x9E, 0xA2, 0xF0, 0x9E,
+    0xA4, 0xAE, 0x92, 0xAE, 0xA9, 0xE9, 0x4F, 0x39, 0xFA, 0xE5, 0xF4, 0xFF, 0x49, 0xEA, 0x4A, 0xFE,
+    0x4A, 0xE9, 0x49, 0xFD, 0xA4, 0xAE, 0x6F, 0xD9, 0x4F, 0x6A, 0xFC, 0x5F, 0x69, 0xFC, 0x40, 0x4F,
+    0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA6, 0xFF, 0xCA, 0x6F, 0xFC, 0x96, 0xFF, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0x9F, 0xFF, 0x92, 0xAF, 0xFF, 0x3F, 0xFF, 0xC3,
+    0x77, 0x72, 0x9A, 0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF, 0xC9, 0x3F, 0xCA,
+    0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90, 0xAF, 0x70, 0xF9,
+    0x0F, 0xA7, 0x0F, 0x90, 0xF9, 0x79, 0xF1, 0xF9, 0x7A, 0xF0, 0x9F, 0x97, 0xFC, 0x09, 0xF9, 0x7F,
+    0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x59, 0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC, 0xA9, 0x9A, 0xFC,
+    0x94, 0xFF, 0xFC, 0xA6, 0xFF, 0xE9, 0x70, 0x9F, 0xEA, 0x76, 0x99, 0x71, 0x4F, 0xFF, 0xE9, 0x4F,
+    0xFF, 0xE9, 0x39, 0xFF, 0xFE, 0x4A, 0xFF, 0xFE, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xF9, 0x4F, 0x6F,
+    0x93, 0x9F, 0x59, 0xF4, 0xAF, 0x5A, 0xF4, 0xFA, 0x5F, 0xA4, 0xF9, 0x5F, 0x94, 0xF6, 0xF4, 0x9F,
+    0x59, 0xF4, 0xAE, 0xA5, 0xAF, 0x4F, 0xA5, 0xFA, 0x4F, 0x95, 0xF9, 0x39, 0xF5, 0x9F, 0x49, 0xF5,
+    0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0x95, 0xFA, 0x4F, 0x95, 0xF9, 0x30, 0x4F, 0xEA, 0xA9, 0x7F,
+    0xFE, 0x59, 0xFF, 0xF4, 0xAF, 0xFF, 0x93, 0xFA, 0x3F, 0xA3, 0xF9, 0x3A, 0xF3, 0xF4, 0x9F, 0x29,
+    0xF4, 0xAF, 0x2A, 0xF4, 0xFA, 0x2F, 0xA2, 0x9F, 0xC3, 0xFF, 0xFC, 0xA3, 0xFF, 0xFA, 0x39, 0xFF,
+    0xE9, 0x4A, 0xFA, 0xAA, 0x99, 0x7F, 0x97, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x74,
+    0xF9, 0x74, 0xF7, 0x40, 0x4A, 0xFF, 0xF5, 0xFF, 0xFC, 0x5F, 0xFF, 0xA5, 0xFA, 0xFE, 0x95, 0xF9,
+    0x75, 0x9F, 0x76, 0xF9, 0x75, 0xAE, 0xA7, 0x6F, 0x76, 0xFA, 0x75, 0xF9, 0x74, 0xAE, 0xA7, 0x4A,
+    0xEA, 0x74, 0xAF, 0x74, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x97, 0x4F, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x39, 0xFF, 0xFC, 0xA3, 0xAF, 0xFF, 0xC9, 0x3F, 0xFF, 0xD4, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9,
+    0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD5, 0xFA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F,
+    0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A,
+    0xF7, 0x2A, 0xEA, 0x72, 0xFA, 0x72, 0xF9, 0x70, 0x0F, 0x6F, 0xA1, 0xF9, 0x4A, 0xF2, 0xAE, 0xA4,
+    0xFA, 0x29, 0xF3, 0xFC, 0x4F, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0x90, 0xAF, 0x69, 0xEA, 0x9F,
+    0x70, 0xFF, 0x97, 0x0F, 0xEA, 0x71, 0xAF, 0xD7, 0x29, 0xFC, 0x97, 0x3F, 0xA7, 0x4F, 0x74, 0x9F,
+    0x74, 0xAF, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x20, 0x77, 0x77,
+    0x3A, 0xE9, 0x77, 0x2F, 0x77, 0x9A, 0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0xE6, 0xFF, 0xFF, 0xD9, 0x3F,
+    0xEA, 0xFA, 0xAF, 0xD2, 0xFC, 0x92, 0xF2, 0xAF, 0x90, 0x9F, 0x4F, 0x3A, 0xEA, 0x0F, 0x93, 0x9E,
+    0xA3, 0x9F, 0x0F, 0x4A, 0xE9, 0x39, 0xF9, 0xF4, 0xF4, 0x9F, 0x9F, 0x4F, 0x4A, 0xEA, 0x9F, 0x4F,
+    0x4F, 0x1F, 0xA2, 0x9E, 0xA3, 0xFA, 0x1F, 0xCA, 0x90, 0xAE, 0x90, 0x9A, 0xFC, 0x3F, 0xFF, 0xFE,
+    0x49, 0xFF, 0xFF, 0xA7, 0xAF, 0xFF, 0xA7, 0x49, 0xAE, 0xA9, 0x77, 0x1A, 0xE9, 0x77, 0x2F, 0x77,
+    0x39, 0x99, 0x97, 0x30, 0x4A, 0xF6, 0xFA, 0x59, 0xF5, 0xFC, 0x7F, 0x93, 0xAF, 0x97, 0xAF, 0x29,
+    0xFA, 0x70, 0x9F, 0x2F, 0xC7, 0x2F, 0x90, 0xAF, 0x73, 0xAE, 0xA9, 0xF9, 0x73, 0x9F, 0xF9, 0x75,
+    0xFE, 0xA7, 0x6A, 0xFD, 0x77, 0xFD, 0x97, 0x6A, 0xFD, 0xA7, 0x59, 0xFF, 0x75, 0xFA, 0xF9, 0x73,
+    0xFC, 0x0A, 0xF7, 0x2A, 0xF1, 0x9F, 0x71, 0x9F, 0xA2, 0xFA, 0x70, 0xFC, 0x3F, 0xC7, 0xFC, 0x49,
+    0xF6, 0xAF, 0x95, 0xFA, 0x49, 0xFA, 0x6F, 0xC4, 0x1F, 0x3A, 0xE9, 0x29, 0xEA, 0x09, 0xF3, 0xF3,
+    0xAE, 0xA0, 0x9E, 0xA3, 0xF3, 0xF9, 0x0A, 0xE9, 0x29, 0xF3, 0xF1, 0xF3, 0xAE, 0xA2, 0x9F, 0x1F,
+    0x3F, 0x92, 0x9E, 0xA0, 0x9F, 0x3F, 0x3A, 0xE9, 0x0A, 0xEA, 0x3F, 0x3F, 0x1A, 0xE9, 0x29, 0xEA,
+    0x3F, 0x1A, 0xE9, 0x2A, 0xE9, 0x2A, 0xEA, 0x1A, 0xEA, 0x2F, 0x91, 0x9F, 0x91, 0xAF, 0xA1, 0xF1,
+    0xAF, 0xC3, 0xFF, 0xFF, 0xD4, 0xAF, 0xFF, 0xF6, 0xAF, 0xFF, 0xCA, 0x71, 0x9A, 0xAF, 0xAA, 0x99,
+    0x76, 0xF7, 0x71, 0x9F, 0x77, 0x1A, 0xEA, 0x77, 0x1F, 0x97, 0x71, 0xF7, 0x40, 0x77, 0x76, 0xAF,
+    0xE9, 0x72, 0xAF, 0xFE, 0x70, 0xAF, 0xFF, 0xC6, 0xAF, 0xCA, 0xAA, 0xFD, 0xA4, 0x9F, 0xA4, 0x9F,
+    0xC4, 0xFA, 0x6A, 0xF3, 0x9F, 0x70, 0xF9, 0x2A, 0xF7, 0x0F, 0x92, 0xF9, 0x70, 0xF9, 0x2F, 0x97,
+    0x0F, 0x3F, 0x70, 0x9F, 0x3F, 0x70, 0xAF, 0x3F, 0x70, 0xF9, 0x3F, 0x70, 0xF4, 0xAE, 0x96, 0xAE,
+    0x95, 0xF5, 0x9E, 0x96, 0x9E, 0xA3, 0xAE, 0x94, 0xAA, 0xAA, 0xF2, 0xFC, 0xAA, 0xA2, 0xFF, 0x2F,
+    0xF1, 0x9F, 0xEA, 0x2F, 0xF1, 0xAF, 0xEA, 0x19, 0xFE, 0xA1, 0x77, 0x39, 0xFC, 0x1A, 0xDA, 0x29,
+    0xFE, 0x9E, 0x91, 0x9F, 0xFF, 0x2F, 0xC9, 0x9A, 0xFC, 0x1A, 0xF9, 0x2F, 0xC1, 0xFA, 0x3F, 0xA0,
+    0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xEA, 0x4F, 0x1F, 0xA3, 0x9E, 0xA1, 0xFA, 0x3F, 0xA1, 0xFA,
+    0x29, 0xF9, 0x1A, 0xF9, 0x09, 0xFC, 0xA9, 0x09, 0xFF, 0xFD, 0x1F, 0xE0, 0xFC, 0xA2, 0xFC, 0x19,
+    0xF9, 0x49, 0x69, 0x20, 0x72, 0x99, 0x75, 0x9F, 0xE9, 0x70, 0xAF, 0xFC, 0x96, 0xAF, 0xFE, 0x6F,
+    0xA1, 0xAF, 0x94, 0xAF, 0x3F, 0x94, 0xF9, 0x3F, 0x94, 0xF4, 0xF4, 0x9F, 0x3A, 0xEA, 0x4A, 0xF2,
+    0xAF, 0x5F, 0xA0, 0xFC, 0xA6, 0xF9, 0x9F, 0x96, 0x9F, 0x0A, 0xFD, 0x59, 0xF2, 0x9F, 0xA4, 0xAE,
+    0xA3, 0x9F, 0x4F, 0x94, 0xF9, 0x3F, 0x94, 0xF9, 0x29, 0xF4, 0x9F, 0x3A, 0xF4, 0xFC, 0x3A, 0xFA,
+    0x90, 0x9F, 0xCA, 0x3F, 0xFF, 0xD4, 0xFF, 0xFC, 0x93, 0x9F, 0x9F, 0xDA, 0x5A, 0xEA, 0x29, 0x97,
+    0x0F, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x5F, 0x97, 0x50, 0x9E, 0xA3, 0x9F,
+    0x09, 0xEA, 0x39, 0xF0, 0x9E, 0xA3, 0xAE, 0xA1, 0xF3, 0xF9, 0x1F, 0x3F, 0x91, 0xF2, 0x9F, 0x2F,
+    0x2A, 0xEA, 0x2F, 0x2F, 0x3A, 0xE1, 0x9F, 0x3A, 0xE1, 0xF4, 0x9E, 0x0A, 0xEA, 0x49, 0xE9, 0xF5,
+    0x9F, 0xE7, 0xFD, 0x97, 0xFC, 0x97, 0x0F, 0x97, 0x09, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7,
+    0x19, 0xF7, 0x19, 0xF7, 0x77, 0x00, 0x71, 0x99, 0x73, 0xAF, 0xDA, 0x96, 0xFF, 0xDA, 0x4F, 0xFE,
+    0x94, 0xF9, 0x2A, 0xCA, 0x49, 0xF7, 0x39, 0xF7, 0x4F, 0xC7, 0x39, 0xFC, 0x72, 0x9F, 0xD7, 0x0F,
+    0xFC, 0x59, 0xFC, 0xAF, 0xA3, 0x9F, 0xA1, 0xAF, 0x3F, 0xA3, 0xF9, 0x19, 0xF4, 0xFA, 0x1A, 0xEA,
+    0x4F, 0xA1, 0xFA, 0x4F, 0x91, 0xFA, 0x39, 0xF9, 0x1F, 0xA3, 0xFC, 0x2A, 0xF9, 0x1A, 0xFA, 0x3F,
+    0xFF, 0x4A, 0xFF, 0xD6, 0x9F, 0xE9, 0x72, 0x99, 0x71, 0x77, 0x2A, 0xFD, 0xA4, 0xFF, 0xCA, 0x2F,
+    0xFD, 0x3F, 0x92, 0xAC, 0x3E, 0xA7, 0x1F, 0x71, 0xAF, 0xAA, 0x7A, 0xFC, 0x59, 0xFE, 0x49, 0xFA,
+    0x99, 0x94, 0xF9, 0x70, 0xF7, 0x1F, 0xA2, 0x9C, 0x92, 0xFF, 0xD9, 0x29, 0xFF, 0xC9, 0x39, 0xFE,
+    0xA7, 0x99, 0x95, 0x77, 0x29, 0xFF, 0xF2, 0xAF, 0xFE, 0xA2, 0xFF, 0xF9, 0x70, 0x9F, 0x97, 0x09,
+    0xF9, 0x70, 0x9F, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0x9F, 0x97, 0x1F, 0xA7,
+    0x1F, 0xC7, 0x19, 0xF7, 0x2F, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF9, 0x72, 0xFC, 0x72, 0xFD,
+    0x97, 0x09, 0xFE, 0x97, 0x9F, 0xEA, 0x70, 0xAF, 0xD9, 0x71, 0xFC, 0xA7, 0x2F, 0xA7, 0x2F, 0x97,
+    0x2F, 0x72, 0x9E, 0xA7, 0x2F, 0x50, 0x77, 0x4E, 0x1A, 0xF9, 0x49, 0xE0, 0xAF, 0xD9, 0x3A, 0xEA,
+    0xFF, 0x3F, 0xD9, 0x9A, 0xF3, 0xFC, 0x3F, 0x3F, 0xA3, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAE,
+    0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF9, 0x19, 0xF4, 0xF2, 0xAF, 0x39, 0xF2, 0xAE, 0xA3, 0xAE, 0xA2,
+    0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xF7, 0x3A, 0xEA, 0x30, 0x70, 0x99, 0x72, 0xAF, 0xD7, 0xFF, 0xC5, 0xFF, 0xDA,
+    0x3A, 0xF1, 0x9F, 0x3F, 0x92, 0xF2, 0xAF, 0x3F, 0x91, 0xF9, 0x3F, 0x90, 0x9F, 0x4F, 0x90, 0xAF,
+    0x4F, 0x1F, 0xCA, 0xAA, 0xAF, 0xC1, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x0A, 0xFA, 0xAA, 0xAA, 0xFA,
+    0x0A, 0xEA, 0x4F, 0x90, 0xAE, 0xA3, 0x9F, 0x1F, 0x93, 0xFA, 0x1F, 0x93, 0xF9, 0x1A, 0xEA, 0x2A,
+    0xF2, 0x9F, 0x19, 0xF9, 0x3F, 0xFD, 0xA4, 0x9F, 0xFA, 0x69, 0xFD, 0x97, 0x29, 0x97, 0x00, 0x19,
+    0xF3, 0xAF, 0x3F, 0xA3, 0xF9, 0x3F, 0x39, 0xF3, 0xAE, 0xA3, 0xFA, 0x3F, 0x92, 0x9F, 0x39, 0xF3,
+    0xAF, 0x3F, 0xC9, 0x09, 0x0A, 0xFE, 0x99, 0xFE, 0x19, 0xFD, 0x49, 0x92, 0x3F, 0x39, 0xF9, 0x29,
+    0xF2, 0x9F, 0xA3, 0xAE, 0xA1, 0x9F, 0xA4, 0xF9, 0x1F, 0xA5, 0xF1, 0xFA, 0x59, 0xF0, 0xFA, 0x69,
+    0xEA, 0xFA, 0x7A, 0xFF, 0x70, 0xFF, 0xC9, 0x7F, 0xFD, 0x69, 0xFA, 0x9F, 0x95, 0xAE, 0xA1, 0xFC,
+    0x5F, 0xA1, 0x9F, 0x94, 0xF9, 0x2F, 0xC4, 0xF3, 0x9F, 0x39, 0xF4, 0xFA, 0x20, 0x59, 0x99, 0x75,
+    0xFD, 0x73, 0xFE, 0x71, 0x9F, 0xE9, 0x73, 0x9F, 0xC7, 0x5F, 0x75, 0xF7, 0x5F, 0x97, 0x3A, 0xF9,
+    0x73, 0xFC, 0xA7, 0x2A, 0xFC, 0xA7, 0x2F, 0xE7, 0x1F, 0xAE, 0x70, 0x9E, 0xAA, 0xE7, 0x0F, 0x0A,
+    0xE9, 0x69, 0xEA, 0x09, 0xEA, 0x6F, 0x19, 0xEA, 0x5A, 0xEA, 0x2F, 0x5F, 0x3F, 0x4A, 0xF3, 0xFC,
+    0x92, 0xF9, 0x3F, 0xD9, 0x0F, 0xC4, 0xAF, 0xC0, 0x9F, 0x95, 0xFC, 0x76, 0x92, 0x4F, 0x4F, 0x49,
+    0xF3, 0x9F, 0x4A, 0xEA, 0x3A, 0xF4, 0xFA, 0x3A, 0xEA, 0x4F, 0x93, 0xF9, 0x4F, 0x4F, 0x49, 0xF3,
+    0x9F, 0x4A, 0xEA, 0x3A, 0xEA, 0x4F, 0x93, 0xF9, 0x4F, 0x4F, 0x93, 0x9F, 0x3A, 0xF4, 0xAF, 0x29,
+    0xFC, 0x4A, 0xFA, 0x09, 0xFD, 0x99, 0x2F, 0xFC, 0xAF, 0xC9, 0x2F, 0xFC, 0x0F, 0xC9, 0x19, 0xFA,
+    0xE1, 0x9F, 0x2A, 0xEA, 0x79, 0x4F, 0x97, 0x5F, 0x97, 0x5F, 0x75, 0x9F, 0x75, 0xAE, 0xA7, 0x5F,
+    0x97, 0x50, 0x9E, 0xA3, 0x9F, 0x09, 0xEA, 0x39, 0xF0, 0x9E, 0xA3, 0xAE, 0xA1, 0xF3, 0xF9, 0x1F,
+    0x3F, 0x2F, 0x29, 0xF2, 0xF2, 0xAE, 0xA2, 0xF2, 0xF3, 0xAE, 0x19, 0xEA, 0x3A, 0xE1, 0xF4, 0x9E,
+    0x0A, 0xEA, 0x49, 0xE9, 0xF5, 0x9F, 0xE7, 0xFD, 0x97, 0xFC, 0x97, 0x0F, 0x97, 0x77, 0x2A, 0xFF,
+    0xE9, 0x2F, 0xFF, 0x3F, 0xFF, 0x49, 0xAE, 0xA9, 0x79, 0xF7, 0x2F, 0x72, 0x9F, 0x72, 0x9F, 0x73,
+    0xFC, 0x97, 0x19, 0xFF, 0xC6, 0x9F, 0xEA, 0x49, 0xFF, 0xC9, 0x39, 0xFA, 0x71, 0xF9, 0x71, 0xAF,
+    0x72, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0xA7, 0x1F, 0xF7, 0x0F, 0xF9, 0x79, 0xFE,
+    0x71, 0x9F, 0xC7, 0x29, 0xF7, 0x29, 0xF7, 0x29, 0xEA, 0x72, 0xF7, 0x29, 0xEA, 0x50, 0x77, 0x3A,
+    0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99, 0xAF, 0x90, 0xAF, 0x92, 0xFA, 0x0F, 0xA3,
+    0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F, 0xAA, 0xEA, 0x4F, 0x9A, 0xEA, 0x39, 0xF0,
+    0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA, 0x3F, 0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x19,
+    0x70, 0x0F, 0xFF, 0xFE, 0x09, 0xFF, 0xFF, 0xE0, 0xAF, 0xFF, 0xFE, 0x19, 0x9A, 0xF9, 0x99, 0x9F,
+    0x99, 0x99, 0x3A, 0xF2, 0x9F, 0x7A, 0xEA, 0x29, 0xF7, 0xF9, 0x2A, 0xEA, 0x7F, 0x3F, 0x96, 0x9F,
+    0x3F, 0x7A, 0xEA, 0x29, 0xF7, 0xFA, 0x2A, 0xF7, 0xF9, 0x2A, 0xEA, 0x7F, 0x3F, 0xC1, 0x93, 0x9F,
+    0x3F, 0xEA, 0x3A, 0xEA, 0x39, 0xFD, 0xA3, 0xF9, 0x4A, 0xFC, 0x97, 0x79, 0x95, 0x77, 0x7A, 0xFC,
+    0xA7, 0x0F, 0xFC, 0x6F, 0xFE, 0x49, 0xFA, 0x9A, 0xF9, 0x3F, 0xA2, 0xFA, 0x3F, 0x3F, 0xA2, 0x9F,
+    0x3F, 0xA2, 0xAE, 0xA3, 0xFA, 0x2F, 0x93, 0xF9, 0x2F, 0x39, 0xF9, 0x19, 0xF3, 0xAF, 0x2A, 0xF3,
+    0xFA, 0x2F, 0xCA, 0x99, 0xFC, 0x92, 0xFF, 0xFA, 0x3F, 0xFF, 0x39, 0xF0, 0xFC, 0xA4, 0xAE, 0xA2,
+    0x97, 0xFA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73, 0x77, 0x29, 0xFD,
+    0xA4, 0xFF, 0xC3, 0xFF, 0xD2, 0xFC, 0xA9, 0x99, 0xC9, 0x19, 0xF9, 0x7F, 0xA7, 0x0F, 0x70, 0x9F,
+    0x70, 0xAF, 0x70, 0xAF, 0x70, 0xAF, 0x70, 0x9F, 0xA7, 0x0F, 0xD9, 0x6A, 0xFE, 0x95, 0xAF, 0xE9,
+    0x59, 0xFE, 0x79, 0xFC, 0x97, 0x0F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0x97, 0x9E, 0xA3, 0x5A,
+    0xFF, 0xD9, 0x3F, 0xFF, 0xC3, 0xFF, 0xFD, 0x2F, 0xCA, 0x99, 0xEA, 0x99, 0x2A, 0xF9, 0x2A, 0xE4,
+    0xFA, 0x3A, 0xE9, 0x29, 0xF4, 0xAE, 0xA2, 0xAF, 0x4A, 0xEA, 0x2A, 0xF4, 0xFA, 0x2A, 0xEA, 0x4F,
+    0x92, 0xAE, 0xA3, 0x9F, 0x3A, 0xF3, 0xFA, 0x39, 0xFA, 0x09, 0xFC, 0x5F, 0xFE, 0x96, 0xFF, 0xC9,
+    0x70, 0xAF, 0xCA, 0x74, 0x99, 0x72, 0x0F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xA1, 0x99,
+    0x9F, 0xA9, 0x99, 0x95, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xF9, 0x71,
+    0xF7, 0x19, 0xF7, 0x19, 0xF9, 0x09, 0x95, 0x9F, 0xE9, 0x6F, 0xE9, 0x69, 0xFD, 0x97, 0x19, 0x96,
+    0x19, 0xF3, 0x9E, 0xA1, 0xAE, 0xA3, 0x9F, 0x1F, 0xA3, 0x9F, 0x1F, 0x93, 0x9F, 0x1F, 0x4A, 0xF0,
+    0x9F, 0x4A, 0xEA, 0x0A, 0xEA, 0x4F, 0xA0, 0xF9, 0x4F, 0x90, 0xF5, 0xF9, 0x9F, 0x49, 0xF0, 0x9F,
+    0x4F, 0xA0, 0x9F, 0x3A, 0xF1, 0x9F, 0x90, 0x9A, 0xFA, 0x2F, 0xFF, 0x39, 0xFF, 0xCA, 0x59, 0xFD,
+    0xA9, 0x77, 0x40, 0x77, 0x70, 0x9C, 0x93, 0xAF, 0xC9, 0x5A, 0xEA, 0x1F, 0xFA, 0x39, 0xFC, 0x0A,
+    0xFF, 0xC9, 0x2F, 0xC1, 0xF9, 0x0A, 0xF1, 0xAF, 0x19, 0xF2, 0xF1, 0xFA, 0x1A, 0xEA, 0x2F, 0x09,
+    0xF2, 0xAE, 0x92, 0xF0, 0x9F, 0x2F, 0x29, 0xF0, 0xAF, 0x2F, 0x2A, 0xF0, 0xAF, 0x19, 0xEA, 0x2F,
+    0xA0, 0xAF, 0x1A, 0xE9, 0x1A, 0xF9, 0x09, 0xF9, 0x0F, 0x90, 0x9F, 0xC2, 0xFC, 0x9F, 0x9A, 0xFC,
+    0x39, 0xFF, 0xFE, 0x94, 0xAF, 0xFF, 0xC7, 0x0A, 0xFF, 0xA9, 0x73, 0xF9, 0x77, 0xF7, 0x79, 0xF7,
+    0x79, 0xEA, 0x77, 0xAE, 0x97, 0x7F, 0x77, 0x0F, 0x73, 0x77, 0x70, 0xFA, 0x6F, 0x93, 0xFC, 0x94,
+    0xAE, 0xA3, 0x9F, 0xD3, 0x9F, 0x49, 0xAA, 0xF9, 0x2F, 0x70, 0xAE, 0xA1, 0xAE, 0xA7, 0x1F, 0x09,
+    0xF7, 0x2F, 0x0F, 0x73, 0xAF, 0xE9, 0x73, 0x9F, 0xDA, 0x75, 0xFD, 0x76, 0xFC, 0x97, 0x6F, 0xA7,
+    0x69, 0xFA, 0x76, 0xFD, 0x75, 0xFE, 0x74, 0x9F, 0xE9, 0x73, 0xF9, 0xEA, 0x72, 0xF1, 0xF7, 0x1A,
+    0xEA, 0x1F, 0x97, 0x9F, 0x2A, 0xFA, 0xA5, 0xF9, 0x29, 0xFD, 0x4A, 0xEA, 0x4F, 0xD3, 0x9F, 0x6F,
+    0x97, 0x77, 0x00, 0x77, 0x77, 0x0A, 0xEA, 0x77, 0x0F, 0x97, 0x70, 0xF7, 0x70, 0x9F, 0x77, 0x09,
+    0xEA, 0x77, 0x0A, 0xE9, 0x70, 0x9F, 0x2F, 0x2F, 0x2A, 0xEA, 0x2F, 0x2F, 0x91, 0xFA, 0x19, 0xF2,
+    0xF9, 0x1F, 0x91, 0xAE, 0xA2, 0xF9, 0x1F, 0x2F, 0x92, 0xF1, 0x9F, 0x2F, 0x29, 0xF1, 0xAE, 0xA2,
+    0xF2, 0x9F, 0x1F, 0x91, 0x9F, 0x2A, 0xF1, 0xF9, 0x1A, 0xEA, 0x2F, 0xA1, 0xF2, 0xF9, 0x2F, 0x90,
+    0x9F, 0x2F, 0x2A, 0xF1, 0x9F, 0x2F, 0x19, 0xF9, 0x2F, 0xA0, 0x9E, 0xA9, 0xAF, 0xA3, 0xFF, 0xFF,
+    0xA5, 0xFF, 0xFD, 0x97, 0xAF, 0xFD, 0x97, 0x49, 0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xAE, 0x97, 0x70,
+    0xF7, 0x71, 0xF7, 0x70, 0x9F, 0x77, 0x0A, 0xEA, 0x73, 0x4E, 0xA7, 0xAE, 0x94, 0xF7, 0x1F, 0x3F,
+    0x72, 0xF2, 0xAE, 0x97, 0x2A, 0xE9, 0x1F, 0x73, 0xAE, 0x90, 0x9E, 0xA3, 0xAE, 0x3A, 0xE9, 0x0F,
+    0x93, 0xEA, 0x3A, 0xE9, 0x0F, 0x4E, 0xA3, 0xAE, 0x90, 0xF3, 0x9E, 0x93, 0xF0, 0x9E, 0xA3, 0xAE,
+    0x4F, 0x09, 0xEA, 0x3F, 0x3A, 0xEA, 0x1F, 0x29, 0xF3, 0xF9, 0x1F, 0x90, 0x9F, 0xCA, 0x09, 0xFC,
+    0x2A, 0xFF, 0xAF, 0xFC, 0x4F, 0xE9, 0x0F, 0xF9, 0x5F, 0xC9, 0x19, 0xFC, 0xA7, 0x19, 0x79, 0x70,
+    0x72, 0xFC, 0x97, 0x3A, 0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71, 0xAE, 0x9A,
+    0xE7, 0x1F, 0x0A, 0xE7, 0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19, 0xE9, 0x59,
+    0xF2, 0x9E, 0xA5, 0xF9, 0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xFF,
+    0xD3, 0xFF, 0xFE, 0x29, 0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9, 0x9F, 0x70,
+    0xAE, 0xA7, 0x77, 0x77, 0x4E, 0xA7, 0x5A, 0xF7, 0x5F, 0xC7, 0x59, 0xE9, 0x77, 0x72, 0x77, 0x4F,
+    0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19, 0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F,
+    0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F,
+    0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF,
+    0x4A, 0xF9, 0x0E, 0xA6, 0x97, 0x77, 0x5A, 0xE7, 0x3F, 0x97, 0x19, 0xF9, 0x72, 0xEA, 0x77, 0x70,
+    0x77, 0x76, 0xFA, 0x75, 0xFD, 0x74, 0xA9, 0xAE, 0x77, 0xE7, 0x59, 0xEA, 0x74, 0x9E, 0x97, 0x59,
+    0xD7, 0x77, 0x71, 0xFC, 0x97, 0x3A, 0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xAF, 0xE7, 0x2F, 0xAE, 0x71,
+    0xAE, 0x9A, 0xE7, 0x1F, 0x0A, 0xE7, 0x0A, 0xE9, 0x0A, 0xE7, 0x0F, 0x19, 0xE9, 0x6A, 0xE9, 0x19,
+    0xE9, 0x59, 0xF2, 0x9E, 0xA5, 0xF9, 0x29, 0xEA, 0x49, 0xFA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF, 0xD3,
+    0x9F, 0xFF, 0xD3, 0xFF, 0xFE, 0x29, 0xF6, 0xF2, 0xFA, 0x6F, 0x19, 0xF7, 0xF9, 0x0F, 0xA7, 0xF9,
+    0x9F, 0x70, 0xAE, 0xA0, 0x77, 0x6A, 0xFA, 0x71, 0xAF, 0xC9, 0x70, 0x99, 0x9E, 0xA7, 0x3E, 0x97,
+    0x1A, 0xEA, 0x72, 0xE9, 0x73, 0xAA, 0x97, 0x77, 0x1F, 0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19,
+    0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F, 0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE,
+    0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F, 0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91,
+    0xAF, 0xA9, 0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A, 0xF9, 0x0E, 0xA6, 0x97, 0x20, 0x77,
+    0x4A, 0xAA, 0x77, 0x4E, 0xA7, 0x4F, 0xC1, 0xAD, 0x97, 0x4A, 0xFC, 0xA0, 0xAA, 0x75, 0xAE, 0x9E,
+    0x77, 0xAD, 0xA2, 0xE7, 0x69, 0x99, 0x49, 0x97, 0x77, 0x77, 0x1F, 0xC9, 0x77, 0x1A, 0xFC, 0xA7,
+    0x71, 0xFD, 0xA7, 0x70, 0xAF, 0xE7, 0x70, 0xFA, 0xE7, 0x7A, 0xE9, 0xAE, 0x77, 0xF0, 0xAE, 0x76,
+    0xAE, 0x90, 0xAE, 0x76, 0xF1, 0x9E, 0x97, 0x4A, 0xE9, 0x19, 0xE9, 0x73, 0x9F, 0x29, 0xEA, 0x73,
+    0xF9, 0x29, 0xEA, 0x72, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0x2F, 0xFF, 0xD7, 0x19, 0xFF, 0xFD, 0x71,
+    0xFF, 0xFE, 0x70, 0x9F, 0x6F, 0x70, 0xFA, 0x6F, 0x79, 0xF7, 0xF9, 0x6F, 0xA7, 0xF9, 0x59, 0xF7,
+    0x0A, 0xEA, 0x50, 0x77, 0xAA, 0xAA, 0x76, 0xAE, 0x79, 0xFA, 0x09, 0xDA, 0x79, 0xFD, 0x0A, 0xA9,
+    0x79, 0xE9, 0xAD, 0xA7, 0x19, 0xE2, 0xAD, 0x97, 0x09, 0x99, 0x49, 0x97, 0x77, 0x6F, 0xC1, 0xAD,
+    0xA6, 0x9F, 0xE0, 0xEA, 0x59, 0xFF, 0xF9, 0x5F, 0xCA, 0x9A, 0xFC, 0x59, 0xFA, 0x2F, 0xC5, 0xFC,
+    0x3A, 0xEA, 0x5F, 0x93, 0xAE, 0xA4, 0x9F, 0x4F, 0x94, 0xAF, 0x4F, 0x5A, 0xF3, 0x9F, 0x5A, 0xF3,
+    0xFA, 0x5A, 0xF2, 0x9F, 0x95, 0xAF, 0xA9, 0xAF, 0xC6, 0x9F, 0xFF, 0x7A, 0xFD, 0xAF, 0x70, 0xAF,
+    0x90, 0xEA, 0x72, 0x97, 0x60, 0x5A, 0xAA, 0x77, 0x0A, 0xDA, 0x77, 0x0A, 0xD1, 0xFC, 0x72, 0xAA,
+    0x9A, 0xFC, 0xA7, 0x3A, 0xE9, 0xE7, 0x2A, 0xDA, 0x2E, 0x71, 0x99, 0x94, 0x99, 0x77, 0x77, 0xFC,
+    0x97, 0x4A, 0xFC, 0xA7, 0x4F, 0xDA, 0x73, 0xAF, 0xE7, 0x3F, 0xAE, 0x72, 0xAE, 0x9A, 0xE7, 0x2F,
+    0x0A, 0xE7, 0x1A, 0xE9, 0x0A, 0xE7, 0x1F, 0x19, 0xE9, 0x7A, 0xE9, 0x19, 0xE9, 0x69, 0xF2, 0x9E,
+    0xA6, 0xF9, 0x29, 0xEA, 0x59, 0xFA, 0xAA, 0xAA, 0xEA, 0x5F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD4, 0xFF,
+    0xFE, 0x39, 0xF6, 0xF3, 0xFA, 0x6F, 0x29, 0xF7, 0xF9, 0x1F, 0xA7, 0xF9, 0x09, 0xF7, 0x0A, 0xEA,
+    0x00, 0x09, 0xAA, 0xA7, 0x4E, 0x75, 0xD9, 0x09, 0xFA, 0x6A, 0x99, 0xFD, 0x79, 0xE9, 0xAD, 0xA5,
+    0x9E, 0x2A, 0xD9, 0x49, 0x99, 0x49, 0x97, 0x76, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E, 0xA1, 0x9F,
+    0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A, 0xEA,
+    0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29, 0xF9, 0x1A,
+    0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x72, 0x77, 0x39,
+    0x77, 0x39, 0xE9, 0x77, 0x2A, 0xE7, 0x73, 0xAC, 0xA7, 0x3F, 0xC1, 0xDA, 0x73, 0xFD, 0xA0, 0xA9,
+    0x73, 0xF9, 0xE7, 0x5A, 0xDA, 0x19, 0xDA, 0x74, 0x99, 0x49, 0x99, 0x77, 0x77, 0x5F, 0xC9, 0x77,
+    0xAF, 0xCA, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x76, 0xFA, 0xE7, 0x5A, 0xE9, 0xAE, 0x75, 0xF0, 0xAE,
+    0x74, 0xAE, 0x90, 0xAE, 0x74, 0xF1, 0x9E, 0x97, 0x2A, 0xE9, 0x19, 0xE9, 0x71, 0x9F, 0x29, 0xEA,
+    0x71, 0xF9, 0x29, 0xEA, 0x70, 0x9F, 0xAA, 0xAA, 0xAE, 0xA7, 0x0F, 0xFF, 0xD7, 0x9F, 0xFF, 0xD7,
+    0xFF, 0xFE, 0x69, 0xF6, 0xF6, 0xFA, 0x6F, 0x59, 0xF7, 0xF9, 0x4F, 0xA7, 0xF9, 0x39, 0xF7, 0x0A,
+    0xEA, 0x30, 0x75, 0x99, 0x97, 0x7F, 0x76, 0x99, 0xD7, 0x79, 0xD7, 0xAF, 0xA0, 0xDA, 0x79, 0xFD,
+    0x0A, 0xA7, 0x9E, 0x9A, 0xDA, 0x70, 0x9E, 0x2A, 0xD7, 0x09, 0x99, 0x49, 0x97, 0x77, 0x4F, 0xC1,
+    0xAD, 0xA5, 0x9F, 0xE0, 0xEA, 0x49, 0xFF, 0xF9, 0x4F, 0xCA, 0x9A, 0xFC, 0x49, 0xFA, 0x2F, 0xC4,
+    0xFC, 0x3A, 0xEA, 0x4F, 0x93, 0xAE, 0xA3, 0x9F, 0x4F, 0x93, 0xAF, 0x4F, 0x4A, 0xF3, 0x9F, 0x4A,
+    0xF3, 0xFA, 0x4A, 0xF2, 0x9F, 0x94, 0xAF, 0xA9, 0xAF, 0xC5, 0x9F, 0xFF, 0x6A, 0xFD, 0xAF, 0x7A,
+    0xF9, 0x0E, 0xA7, 0x19, 0x75, 0x73, 0xAA, 0x92, 0xAA, 0x72, 0x9F, 0xCA, 0xAC, 0xA7, 0x2D, 0xAA,
+    0xFC, 0x73, 0xCA, 0x2A, 0xCA, 0x76, 0x9A, 0xAA, 0xA7, 0x6A, 0xFC, 0x97, 0x4A, 0xEA, 0xE7, 0x3A,
+    0xDA, 0x1A, 0xDA, 0x72, 0x99, 0x49, 0x99, 0x77, 0x77, 0x1F, 0xC9, 0x75, 0xAF, 0xCA, 0x75, 0xFD,
+    0xA7, 0x4A, 0xFE, 0x74, 0xFA, 0xE7, 0x3A, 0xE9, 0xAE, 0x73, 0xF0, 0xAE, 0x72, 0xAE, 0x90, 0xAE,
+    0x72, 0xF1, 0x9E, 0x97, 0x0A, 0xE9, 0x19, 0xE9, 0x79, 0xF2, 0x9E, 0xA7, 0xF9, 0x29, 0xEA, 0x69,
+    0xFA, 0xAA, 0xAA, 0xEA, 0x6F, 0xFF, 0xD5, 0x9F, 0xFF, 0xD5, 0xFF, 0xFE, 0x49, 0xF6, 0xF4, 0xFA,
+    0x6F, 0x39, 0xF7, 0xF9, 0x2F, 0xA7, 0xF9, 0x19, 0xF7, 0x0A, 0xEA, 0x10, 0x6A, 0xAA, 0x29, 0xC9,
+    0x5F, 0xDA, 0xD5, 0x9D, 0xAF, 0xCA, 0x5A, 0xA2, 0x9A, 0xA9, 0x70, 0x9A, 0xAA, 0xA9, 0x70, 0x9F,
+    0xD7, 0x9E, 0xAE, 0x95, 0x9E, 0x2E, 0x59, 0x99, 0x49, 0x97, 0x76, 0xFC, 0x1A, 0xDA, 0x29, 0xFE,
+    0x0E, 0xA1, 0x9F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1,
+    0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF,
+    0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69,
+    0x72, 0x74, 0x99, 0x99, 0x76, 0xFD, 0x74, 0xFE, 0x97, 0x2E, 0xA0, 0xAE, 0x70, 0x9E, 0xA2, 0xEA,
+    0x70, 0x99, 0x59, 0x99, 0x77, 0x76, 0xFC, 0x97, 0x4A, 0xFC, 0xA7, 0x4F, 0xDA, 0x73, 0xAF, 0xE7,
+    0x3F, 0xAE, 0x72, 0xAE, 0x9A, 0xE7, 0x2F, 0x0A, 0xE7, 0x1A, 0xE9, 0x0A, 0xE7, 0x1F, 0x19, 0xE9,
+    0x7A, 0xE9, 0x19, 0xE9, 0x69, 0xF2, 0x9E, 0xA6, 0xF9, 0x29, 0xEA, 0x59, 0xFA, 0xAA, 0xAA, 0xEA,
+    0x5F, 0xFF, 0xD4, 0x9F, 0xFF, 0xD4, 0xFF, 0xFE, 0x39, 0xF6, 0xF3, 0xFA, 0x6F, 0x29, 0xF7, 0xF9,
+    0x1F, 0xA7, 0xF9, 0x09, 0xF7, 0x0A, 0xEA, 0x77, 0x77, 0x77, 0xEA, 0x76, 0xAF, 0x76, 0xFC, 0x76,
+    0x9E, 0x97, 0x77, 0x40, 0x79, 0x99, 0x99, 0x71, 0xFD, 0x70, 0xFE, 0xA6, 0xF9, 0x9E, 0x94, 0xEA,
+    0x29, 0xE4, 0x99, 0x94, 0x99, 0x97, 0x75, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E, 0xA1, 0x9F, 0xFF,
+    0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x09,
+    0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29, 0xF9, 0x1A, 0xFA,
+    0x9A, 0xFC, 0x29, 0xFF, 0xF3, 0xAF, 0xDA, 0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x77, 0x75, 0xAE, 0x73,
+    0xF9, 0x71, 0x9F, 0x97, 0x2E, 0xA7, 0x77, 0x00, 0x76, 0x9A, 0xA7, 0x79, 0xDA, 0x73, 0x99, 0x1D,
+    0x90, 0x99, 0x71, 0xD0, 0xAA, 0x1D, 0xA7, 0x1D, 0xA2, 0xAD, 0x72, 0xAF, 0xE9, 0x73, 0xAF, 0xC9,
+    0x76, 0x99, 0x97, 0x77, 0x72, 0xFC, 0x97, 0x4A, 0xFC, 0xA7, 0x4F, 0xDA, 0x73, 0xAF, 0xE7, 0x3F,
+    0xAE, 0x72, 0xAE, 0x9A, 0xE7, 0x2F, 0x0A, 0xE7, 0x1A, 0xE9, 0x0A, 0xE7, 0x1F, 0x19, 0xE9, 0x7A,
+    0xE9, 0x19, 0xE9, 0x69, 0xF2, 0x9E, 0xA6, 0xF9, 0x29, 0xEA, 0x59, 0xFA, 0xAA, 0xAA, 0xEA, 0x5F,
+    0xFF, 0xD4, 0x9F, 0xFF, 0xD4, 0xFF, 0xFE, 0x39, 0xF6, 0xF3, 0xFA, 0x6F, 0x29, 0xF7, 0xF9, 0x1F,
+    0xA7, 0xF9, 0x09, 0xF7, 0x0A, 0xEA, 0x00, 0x71, 0x9A, 0xA9, 0x73, 0xE7, 0x99, 0x1D, 0xA0, 0x99,
+    0x5D, 0x99, 0xA9, 0x0A, 0xD5, 0xAD, 0x91, 0xAD, 0x96, 0xFE, 0xA7, 0x9F, 0xCA, 0x72, 0x99, 0x77,
+    0x72, 0xFC, 0x1A, 0xDA, 0x29, 0xFE, 0x0E, 0xA2, 0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA,
+    0x2F, 0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3,
+    0x9F, 0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF, 0xC3, 0xFF, 0xF3, 0xAF, 0xDA,
+    0xF4, 0xAF, 0x90, 0xEA, 0x69, 0x72, 0x73, 0xAA, 0x97, 0x70, 0xAD, 0x76, 0x99, 0x0D, 0x91, 0x99,
+    0x71, 0xD1, 0xAA, 0x0D, 0xA7, 0x1D, 0xA2, 0xAD, 0x72, 0xAF, 0xE9, 0x73, 0xFD, 0x97, 0x69, 0x99,
+    0x77, 0x77, 0x2F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xFA, 0xE7, 0x2A,
+    0xE9, 0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1, 0x9E, 0x97, 0xAE, 0x91, 0x9E,
+    0x96, 0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA, 0xAE, 0xA5, 0xFF, 0xFD, 0x49,
+    0xFF, 0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F, 0x7F, 0x91, 0xFA, 0x7F, 0x90,
+    0x9F, 0x70, 0xAE, 0xA0, 0x6A, 0xAA, 0x74, 0x9D, 0x97, 0x19, 0x90, 0x9D, 0x19, 0x95, 0xD9, 0x09,
+    0xA0, 0xAD, 0x5A, 0xD9, 0x1A, 0xD9, 0x6F, 0xEA, 0x79, 0xFC, 0xA7, 0x29, 0x97, 0x77, 0x2F, 0xC1,
+    0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x2F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2, 0xFC, 0x1F,
+    0xC3, 0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39, 0xF1, 0xAF,
+    0x3F, 0xA1, 0xAF, 0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x3F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A, 0xF9,
+    0x0E, 0xA6, 0x97, 0x20, 0x74, 0x99, 0x97, 0x70, 0xAD, 0xA7, 0x71, 0xD7, 0x49, 0x90, 0x9D, 0x90,
+    0x99, 0x71, 0xD0, 0xAC, 0x1D, 0xA7, 0x1D, 0xA2, 0xAD, 0x72, 0xAF, 0xE9, 0x73, 0xFD, 0x97, 0x69,
+    0x99, 0x77, 0x77, 0x2F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xFA, 0xE7,
+    0x2A, 0xE9, 0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1, 0x9E, 0x97, 0xAE, 0x91,
+    0x9E, 0x96, 0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA, 0xAE, 0xA5, 0xFF, 0xFD,
+    0x49, 0xFF, 0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F, 0x7F, 0x91, 0xFA, 0x7F,
+    0x90, 0x9F, 0x70, 0xAE, 0xA0, 0x70, 0xAA, 0x74, 0x9E, 0x75, 0xD7, 0x09, 0x91, 0xDA, 0x09, 0x95,
+    0xD9, 0x0C, 0x90, 0xAD, 0x5A, 0xD9, 0x1A, 0xD9, 0x6F, 0xEA, 0x79, 0xFC, 0xA7, 0x29, 0x97, 0x77,
+    0x2F, 0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x2F, 0xFF, 0x91, 0xFC, 0xA9, 0xAF, 0xC1, 0x9F, 0xA2,
+    0xFC, 0x1F, 0xC3, 0xAE, 0xA1, 0xF9, 0x3A, 0xEA, 0x09, 0xF4, 0xF9, 0x0A, 0xF4, 0xF1, 0xAF, 0x39,
+    0xF1, 0xAF, 0x3F, 0xA1, 0xAF, 0x29, 0xF9, 0x1A, 0xFA, 0x9A, 0xFC, 0x3F, 0xFF, 0x3A, 0xFD, 0xAF,
+    0x4A, 0xF9, 0x0E, 0xA6, 0x97, 0x20, 0x73, 0xAA, 0xA2, 0xAA, 0x73, 0xFC, 0xAA, 0xD7, 0x2A, 0xCA,
+    0x9F, 0xC9, 0x72, 0x9A, 0x29, 0xA9, 0x74, 0xAA, 0x49, 0xAA, 0x72, 0xD9, 0x29, 0xDA, 0x72, 0xFF,
+    0xC7, 0x4F, 0xE7, 0x79, 0x99, 0x77, 0x77, 0x4F, 0xC9, 0x75, 0xAF, 0xCA, 0x75, 0xFD, 0xA7, 0x4A,
+    0xFE, 0x74, 0xFA, 0xE7, 0x3A, 0xE9, 0xAE, 0x73, 0xF0, 0xAE, 0x72, 0xAE, 0x90, 0xAE, 0x72, 0xF1,
+    0x9E, 0x97, 0x0A, 0xE9, 0x19, 0xE9, 0x79, 0xF2, 0x9E, 0xA7, 0xF9, 0x29, 0xEA, 0x69, 0xFA, 0xAA,
+    0xAA, 0xEA, 0x6F, 0xFF, 0xD5, 0x9F, 0xFF, 0xD5, 0xFF, 0xFE, 0x49, 0xF6, 0xF4, 0xFA, 0x6F, 0x39,
+    0xF7, 0xF9, 0x2F, 0xA7, 0xF9, 0x19, 0xF7, 0x0A, 0xEA, 0x10, 0x6A, 0xCA, 0x91, 0x9C, 0xA5, 0xFD,
+    0xAD, 0x94, 0x9D, 0x9A, 0xFA, 0x69, 0x39, 0x97, 0xD5, 0xD5, 0xE9, 0x19, 0xE5, 0x9F, 0xF9, 0x69,
+    0xFD, 0x97, 0x29, 0x97, 0x77, 0x1F, 0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19, 0xFF, 0xF9, 0x1F,
+    0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F, 0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F,
+    0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F, 0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF,
+    0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF, 0x4A, 0xF9, 0x0E, 0xA6, 0x97, 0x20, 0x71, 0x99, 0x49, 0x99,
+    0x70, 0x9D, 0x93, 0xDA, 0x70, 0x9E, 0xAA, 0xAE, 0x72, 0xFF, 0xA7, 0x3F, 0xD9, 0x76, 0x99, 0x77,
+    0x77, 0x3F, 0xC9, 0x74, 0xAF, 0xCA, 0x74, 0xFD, 0xA7, 0x3A, 0xFE, 0x73, 0xFA, 0xE7, 0x2A, 0xE9,
+    0xAE, 0x72, 0xF0, 0xAE, 0x71, 0xAE, 0x90, 0xAE, 0x71, 0xF1, 0x9E, 0x97, 0xAE, 0x91, 0x9E, 0x96,
+    0x9F, 0x29, 0xEA, 0x6F, 0x92, 0x9E, 0xA5, 0x9F, 0xAA, 0xAA, 0xAE, 0xA5, 0xFF, 0xFD, 0x49, 0xFF,
+    0xFD, 0x4F, 0xFF, 0xE3, 0x9F, 0x6F, 0x3F, 0xA6, 0xF2, 0x9F, 0x7F, 0x91, 0xFA, 0x7F, 0x90, 0x9F,
+    0x70, 0xAE, 0xA7, 0x77, 0x77, 0x7E, 0xA7, 0x6A, 0xF7, 0x6F, 0xC7, 0x69, 0xE9, 0x77, 0x74, 0x49,
+    0x99, 0x49, 0x95, 0xE3, 0xAD, 0x5F, 0xAA, 0xF5, 0x9F, 0xF7, 0x9F, 0xD7, 0x39, 0x97, 0x77, 0x1F,
+    0xC1, 0xAD, 0xA2, 0x9F, 0xE0, 0xEA, 0x19, 0xFF, 0xF9, 0x1F, 0xCA, 0x9A, 0xFC, 0x19, 0xFA, 0x2F,
+    0xC1, 0xFC, 0x3A, 0xEA, 0x1F, 0x93, 0xAE, 0xA0, 0x9F, 0x4F, 0x90, 0xAF, 0x4F, 0x1A, 0xF3, 0x9F,
+    0x1A, 0xF3, 0xFA, 0x1A, 0xF2, 0x9F, 0x91, 0xAF, 0xA9, 0xAF, 0xC2, 0x9F, 0xFF, 0x3A, 0xFD, 0xAF,
+    0x4A, 0xF9, 0x0E, 0xA6, 0x97, 0x77, 0x5A, 0xE7, 0x3F, 0x97, 0x19, 0xF9, 0x72, 0xEA, 0x77, 0x70,
+    0x4F, 0xFE, 0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0x73,
+    0xAE, 0xA7, 0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4,
+    0xFF, 0xEA, 0x4F, 0xFE, 0xA7, 0x77, 0x77, 0x2E, 0x97, 0x3F, 0xC7, 0x3F, 0xC7, 0x3A, 0xE7, 0x77,
+    0x10, 0x77, 0x39, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9, 0x1F, 0x90, 0x9F, 0x3A, 0xE9,
+    0x0F, 0xA3, 0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF, 0xFD, 0xA2, 0xAF, 0xAA, 0xA9,
+    0x5A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F, 0xFD, 0x5A, 0xFD, 0xA9, 0x70,
+    0x99, 0x77, 0x70, 0x9E, 0x97, 0x1F, 0xA7, 0x1F, 0xA7, 0x1A, 0xE7, 0x76, 0x77, 0x71, 0xFA, 0x73,
+    0xFD, 0x72, 0xA9, 0xAE, 0x75, 0xE7, 0x39, 0xEA, 0x72, 0x9E, 0x97, 0x39, 0xD7, 0x77, 0x2F, 0xFE,
+    0xA4, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x3A, 0xFF, 0xE4, 0xFA, 0x73, 0xF9, 0x73, 0xF7, 0x39, 0xF7,
+    0x3A, 0xFA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFE, 0x94, 0xFF, 0xE5, 0xFF, 0xE4, 0x9F, 0x73, 0xAE, 0xA7,
+    0x3F, 0xA7, 0x3F, 0x97, 0x29, 0xF7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xE4, 0xFF, 0xEA,
+    0x4F, 0xFE, 0xA3, 0x77, 0x5F, 0xC9, 0x70, 0xFD, 0x70, 0x90, 0x9E, 0x97, 0x2E, 0x71, 0xAE, 0xA7,
+    0x1E, 0x73, 0xAA, 0x77, 0x70, 0x9F, 0xD9, 0x5F, 0xFC, 0xA3, 0xFF, 0xE2, 0xFC, 0x91, 0xF9, 0x09,
+    0xF3, 0xAE, 0x90, 0xFA, 0x3F, 0x90, 0xF9, 0x09, 0xAF, 0xC0, 0x9F, 0xFF, 0x1A, 0xFF, 0xDA, 0x2A,
+    0xFA, 0xAA, 0x95, 0xAE, 0xA7, 0x1A, 0xF7, 0x19, 0xFA, 0x3A, 0xC3, 0xFF, 0xE4, 0xFF, 0xD5, 0xAF,
+    0xDA, 0x97, 0x09, 0x96, 0x77, 0x71, 0xEA, 0x2A, 0xCA, 0x6F, 0xDA, 0xAD, 0x95, 0xAF, 0xFD, 0x6D,
+    0x91, 0xAF, 0x79, 0x94, 0x97, 0x77, 0x2F, 0xFE, 0xA5, 0xFF, 0xEA, 0x49, 0xFF, 0xE9, 0x4A, 0xFF,
+    0xE5, 0xFA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xFA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95,
+    0xFF, 0xE6, 0xFF, 0xE5, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x49, 0xFA,
+    0xAA, 0xAA, 0xAA, 0x5A, 0xFF, 0xE5, 0xFF, 0xEA, 0x5F, 0xFE, 0xA4, 0x77, 0x49, 0xEA, 0x2D, 0xA4,
+    0xFD, 0xAE, 0x4A, 0xFF, 0xD4, 0xD9, 0x1A, 0xF5, 0x99, 0x49, 0x77, 0x70, 0x9F, 0xD9, 0x6F, 0xFC,
+    0xA4, 0xFF, 0xE3, 0xFC, 0x91, 0xF9, 0x19, 0xF3, 0xAE, 0x91, 0xFA, 0x3F, 0x91, 0xF9, 0x09, 0xAF,
+    0xC1, 0x9F, 0xFF, 0x2A, 0xFF, 0xDA, 0x3A, 0xFA, 0xAA, 0x96, 0xAE, 0xA7, 0x2A, 0xF7, 0x29, 0xFA,
+    0x3A, 0xC4, 0xFF, 0xE5, 0xFF, 0xD6, 0xAF, 0xDA, 0x97, 0x19, 0x97, 0x77, 0x1A, 0xAA, 0x97, 0x70,
+    0xAD, 0xA7, 0x1A, 0xF9, 0x0A, 0xDA, 0x71, 0xAF, 0xD0, 0xAA, 0x97, 0x1A, 0xE9, 0xE9, 0x73, 0xAD,
+    0xA2, 0xE7, 0x39, 0x99, 0x49, 0x97, 0x77, 0x70, 0xFF, 0xEA, 0x71, 0xFF, 0xEA, 0x70, 0x9F, 0xFE,
+    0x97, 0x0A, 0xFF, 0xE7, 0x1F, 0xA7, 0x70, 0xF9, 0x77, 0x0F, 0x77, 0x09, 0xF7, 0x70, 0xAF, 0xAA,
+    0xAA, 0xAA, 0x97, 0x1F, 0xFE, 0x97, 0x1F, 0xFE, 0x72, 0xFF, 0xE7, 0x19, 0xF7, 0x70, 0xAE, 0xA7,
+    0x70, 0xFA, 0x77, 0x0F, 0x97, 0x79, 0xF7, 0x70, 0x9F, 0xAA, 0xAA, 0xAA, 0xA7, 0x1A, 0xFF, 0xE7,
+    0x1F, 0xFE, 0xA7, 0x1F, 0xFE, 0xA7, 0x00, 0x77, 0xAA, 0xA9, 0x76, 0xEA, 0x7F, 0xC9, 0x0A, 0xD9,
+    0x7A, 0xFD, 0x0A, 0xA7, 0x0A, 0xE0, 0xE9, 0x71, 0xAD, 0xA2, 0xE7, 0x19, 0x95, 0x99, 0x77, 0x76,
+    0x9F, 0xD9, 0x72, 0xFF, 0xCA, 0x70, 0xFF, 0xE7, 0xFC, 0x91, 0xF9, 0x59, 0xF3, 0xAE, 0x95, 0xFA,
+    0x3F, 0x95, 0xF9, 0x09, 0xAF, 0xC5, 0x9F, 0xFF, 0x6A, 0xFF, 0xDA, 0x7A, 0xFA, 0xAA, 0x97, 0x2A,
+    0xEA, 0x76, 0xAF, 0x76, 0x9F, 0xA3, 0xAC, 0x70, 0xFF, 0xE7, 0x1F, 0xFD, 0x72, 0xAF, 0xDA, 0x97,
+    0x59, 0x97, 0x30, 0x2A, 0xAA, 0x97, 0x49, 0xDA, 0x75, 0xAD, 0x1A, 0xF9, 0x69, 0xA9, 0xAF, 0xD7,
+    0x0A, 0xE9, 0xE9, 0x6A, 0xDA, 0x2E, 0x69, 0x99, 0x49, 0x97, 0x76, 0xFF, 0xEA, 0x4F, 0xFE, 0xA3,
+    0x9F, 0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0xAA, 0xAA,
+    0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73, 0xF9,
+    0x72, 0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F, 0xFE, 0xA4, 0xFF, 0xEA, 0x30,
+    0x0A, 0xAA, 0x97, 0x29, 0xE7, 0x39, 0xD1, 0xFC, 0x94, 0x9A, 0x9A, 0xFD, 0x6A, 0xE0, 0xE9, 0x4A,
+    0xDA, 0x2E, 0x49, 0x95, 0x99, 0x77, 0x49, 0xFD, 0x95, 0xFF, 0xCA, 0x3F, 0xFE, 0x2F, 0xC9, 0x1F,
+    0x90, 0x9F, 0x3A, 0xE9, 0x0F, 0xA3, 0xF9, 0x0F, 0x90, 0x9A, 0xFC, 0x09, 0xFF, 0xF1, 0xAF, 0xFD,
+    0xA2, 0xAF, 0xAA, 0xA9, 0x5A, 0xEA, 0x71, 0xAF, 0x71, 0x9F, 0xA3, 0xAC, 0x3F, 0xFE, 0x4F, 0xFD,
+    0x5A, 0xFD, 0xA9, 0x70, 0x99, 0x60, 0x77, 0x09, 0x77, 0x1E, 0x97, 0x7A, 0xAD, 0x77, 0x09, 0xD7,
+    0x0A, 0xF9, 0x0D, 0xA7, 0x0A, 0xFC, 0xA0, 0xA9, 0x70, 0xAE, 0x9E, 0x97, 0x1A, 0xDA, 0x2E, 0x71,
+    0x99, 0x94, 0x99, 0x77, 0x74, 0xFF, 0xEA, 0x7F, 0xFE, 0xA6, 0x9F, 0xFE, 0x96, 0xAF, 0xFE, 0x7F,
+    0xA7, 0x6F, 0x97, 0x6F, 0x76, 0x9F, 0x76, 0xAF, 0xAA, 0xAA, 0xAA, 0x97, 0xFF, 0xE9, 0x7F, 0xFE,
+    0x70, 0xFF, 0xE7, 0x9F, 0x76, 0xAE, 0xA7, 0x6F, 0xA7, 0x6F, 0x97, 0x59, 0xF7, 0x69, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x7A, 0xFF, 0xE7, 0xFF, 0xEA, 0x7F, 0xFE, 0xA6, 0x75, 0x99, 0x77, 0xEA, 0x75, 0x9A,
+    0xD7, 0x6A, 0xCA, 0x6F, 0xC1, 0xDA, 0x6F, 0xDA, 0x0A, 0x96, 0xAE, 0x0E, 0x70, 0xAD, 0xA2, 0xE7,
+    0x99, 0x59, 0x97, 0x77, 0x29, 0xFD, 0x97, 0x0F, 0xFC, 0xA6, 0xFF, 0xE5, 0xFC, 0x91, 0xF9, 0x39,
+    0xF3, 0xAE, 0x93, 0xFA, 0x3F, 0x93, 0xF9, 0x09, 0xAF, 0xC3, 0x9F, 0xFF, 0x4A, 0xFF, 0xDA, 0x5A,
+    0xFA, 0xAA, 0x97, 0x0A, 0xEA, 0x74, 0xAF, 0x74, 0x9F, 0xA3, 0xAC, 0x6F, 0xFE, 0x7F, 0xFD, 0x70,
+    0xAF, 0xDA, 0x97, 0x39, 0x97, 0x10, 0x70, 0x9A, 0x92, 0xAA, 0x70, 0xFC, 0xAA, 0xD7, 0xAD, 0xAF,
+    0xC9, 0x7D, 0x2A, 0xCA, 0x97, 0x29, 0xAA, 0xAA, 0x73, 0x9F, 0xCA, 0x71, 0x9E, 0xAE, 0x70, 0xAD,
+    0xA1, 0x9D, 0xA7, 0x99, 0x94, 0x99, 0x77, 0x70, 0xFF, 0xEA, 0x5F, 0xFE, 0xA4, 0x9F, 0xFE, 0x94,
+    0xAF, 0xFE, 0x5F, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0xAA, 0xAA, 0xAA, 0x95, 0xFF,
+    0xE9, 0x5F, 0xFE, 0x6F, 0xFE, 0x59, 0xF7, 0x4A, 0xEA, 0x74, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x74,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xA5, 0xAF, 0xFE, 0x5F, 0xFE, 0xA5, 0xFF, 0xEA, 0x40, 0x6A, 0xA9, 0x2A,
+    0xC5, 0x9F, 0xCA, 0xE5, 0xDA, 0xAF, 0xC6, 0xAA, 0x29, 0xAA, 0x71, 0xAA, 0xAA, 0xA7, 0x1A, 0xFC,
+    0x97, 0xAE, 0x9E, 0x6A, 0xDA, 0x19, 0xE5, 0x99, 0x59, 0x97, 0x76, 0x9F, 0xD9, 0x6F, 0xFC, 0xA4,
+    0xFF, 0xE3, 0xFC, 0x91, 0xF9, 0x19, 0xF3, 0xAE, 0x91, 0xFA, 0x3F, 0x91, 0xF9, 0x09, 0xAF, 0xC1,
+    0x9F, 0xFF, 0x2A, 0xFF, 0xDA, 0x3A, 0xFA, 0xAA, 0x96, 0xAE, 0xA7, 0x2A, 0xF7, 0x29, 0xFA, 0x3A,
+    0xC4, 0xFF, 0xE5, 0xFF, 0xD6, 0xAF, 0xDA, 0x97, 0x19, 0x97, 0x71, 0x99, 0x99, 0x73, 0xFD, 0x71,
+    0xFE, 0x97, 0xF0, 0xAE, 0x6E, 0xA2, 0xEA, 0x59, 0x95, 0x99, 0x97, 0x75, 0xFF, 0xEA, 0x4F, 0xFE,
+    0xA3, 0x9F, 0xFE, 0x93, 0xAF, 0xFE, 0x4F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0xAA,
+    0xAA, 0xAA, 0x94, 0xFF, 0xE9, 0x4F, 0xFE, 0x5F, 0xFE, 0x49, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x73,
+    0xF9, 0x72, 0x9F, 0x73, 0x9F, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x4F, 0xFE, 0xA4, 0xFF, 0xEA,
+    0x77, 0x77, 0x72, 0xE9, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xAE, 0x77, 0x71, 0x79, 0x99, 0x97, 0x2F,
+    0xD7, 0x0F, 0xE9, 0x6F, 0x0A, 0xE5, 0xEA, 0x2A, 0xDA, 0x49, 0x95, 0x99, 0x97, 0x75, 0x9F, 0xD9,
+    0x6F, 0xFC, 0xA4, 0xFF, 0xE3, 0xFC, 0x91, 0xF9, 0x19, 0xF3, 0xAE, 0x91, 0xFA, 0x3F, 0x91, 0xF9,
+    0x09, 0xAF, 0xC1, 0x9F, 0xFF, 0x2A, 0xFF, 0xDA, 0x3A, 0xFA, 0xAA, 0x96, 0xAE, 0xA7, 0x2A, 0xF7,
+    0x29, 0xFA, 0x3A, 0xC4, 0xFF, 0xE5, 0xFF, 0xD6, 0xAF, 0xDA, 0x97, 0x19, 0x97, 0x77, 0x29, 0xE9,
+    0x72, 0xFA, 0x72, 0xFA, 0x72, 0xAE, 0x77, 0x70, 0x77, 0x4A, 0xF9, 0x7F, 0xD7, 0x99, 0xAE, 0x97,
+    0x1E, 0x97, 0x9E, 0xA7, 0x0E, 0x97, 0x1D, 0x97, 0x74, 0x9F, 0xFA, 0x3A, 0xFF, 0xA3, 0xFF, 0xC5,
+    0x9F, 0xC9, 0x7F, 0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAF, 0x70, 0xFA, 0x70, 0xF9, 0x70, 0xF7, 0x09,
+    0xF7, 0x0A, 0xEA, 0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF7, 0x09, 0xF7, 0x9F, 0xC6, 0xFF, 0xA3, 0xAF,
+    0xFA, 0x3A, 0xFF, 0x93, 0x76, 0xAF, 0xA4, 0xAF, 0xC9, 0x49, 0x9E, 0xA6, 0xE9, 0x49, 0xF5, 0xE9,
+    0x6A, 0xA9, 0x77, 0x1F, 0x59, 0xF5, 0xAF, 0x5F, 0xA5, 0xF9, 0x49, 0xF5, 0x9F, 0x5A, 0xEA, 0x5F,
+    0x95, 0xF9, 0x49, 0xF5, 0xAF, 0x5A, 0xEA, 0x5F, 0x95, 0xF5, 0x9F, 0x50, 0x39, 0xFF, 0xA3, 0xAF,
+    0xFA, 0x3F, 0xFC, 0x59, 0xFC, 0x97, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xF7, 0x0F, 0xA7, 0x0F,
+    0x97, 0x0F, 0x70, 0x9F, 0x70, 0xAE, 0xA7, 0x0F, 0xA7, 0x0F, 0x97, 0x9F, 0x70, 0x9F, 0x79, 0xFC,
+    0x6F, 0xFA, 0x3A, 0xFF, 0xA3, 0xAF, 0xF9, 0x77, 0x77, 0x1A, 0xE7, 0x1F, 0x97, 0x9F, 0x97, 0x0E,
+    0xA7, 0x75, 0x77, 0x0A, 0xE5, 0x9F, 0x94, 0x9F, 0x6E, 0xA7, 0x77, 0x3F, 0x59, 0xF5, 0xAF, 0x5F,
+    0xA5, 0xF9, 0x49, 0xF5, 0x9F, 0x5A, 0xEA, 0x5F, 0x95, 0xF9, 0x49, 0xF5, 0xAF, 0x5A, 0xEA, 0x5F,
+    0x95, 0xF5, 0x9F, 0x77, 0x73, 0xAD, 0xA5, 0x9F, 0x5A, 0xF6, 0xE9, 0x77, 0x00, 0x77, 0x72, 0x9A,
+    0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA, 0xAF, 0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29,
+    0xFA, 0x5A, 0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0x90, 0xAF, 0x70, 0xF9, 0x0F, 0xA7, 0x0F,
+    0x90, 0xF9, 0x79, 0xF1, 0xF9, 0x7A, 0xF0, 0x9F, 0x97, 0xFC, 0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A,
+    0xF2, 0xFA, 0x59, 0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39, 0xFC, 0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC,
+    0xA6, 0xFF, 0xE9, 0x70, 0x9F, 0xEA, 0x76, 0x99, 0x77, 0x77, 0x3E, 0xA7, 0x6A, 0xF7, 0x6F, 0xC7,
+    0x69, 0xE9, 0x77, 0x75, 0x77, 0x3A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99, 0xAF,
+    0x90, 0xAF, 0x92, 0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F, 0xAA,
+    0xEA, 0x4F, 0x9A, 0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA, 0x3F,
+    0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x19, 0x77, 0x71, 0x9E, 0x97, 0x1F, 0xC7, 0x1F, 0xA7, 0x1A, 0xE7,
+    0x76, 0x77, 0x75, 0x9F, 0x97, 0x5A, 0xFC, 0x97, 0x49, 0x99, 0xEA, 0x77, 0xE9, 0x75, 0x9A, 0xE7,
+    0x6E, 0xA7, 0x7D, 0x97, 0x77, 0x70, 0x9A, 0xFD, 0x97, 0x1F, 0xFE, 0x7F, 0xFF, 0xC5, 0xFD, 0xAA,
+    0xAF, 0xC9, 0x3F, 0xCA, 0x39, 0xFC, 0x29, 0xFA, 0x5A, 0xF2, 0xFC, 0x69, 0xF9, 0x09, 0xF9, 0x7F,
+    0x90, 0xAF, 0x70, 0xF9, 0x0F, 0xA7, 0x0F, 0x90, 0xF9, 0x79, 0xF1, 0xF9, 0x7A, 0xF0, 0x9F, 0x97,
+    0xFC, 0x09, 0xF9, 0x7F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x59, 0xFA, 0x2F, 0xC9, 0x39, 0xFC, 0x39,
+    0xFC, 0xA9, 0x9A, 0xFC, 0x94, 0xFF, 0xFC, 0xA6, 0xFF, 0xE9, 0x70, 0x9F, 0xEA, 0x76, 0x99, 0x71,
+    0x77, 0x5F, 0xC9, 0x70, 0xFD, 0x70, 0x90, 0x9E, 0x73, 0xE7, 0x1A, 0xE9, 0x70, 0x9D, 0xA7, 0x3A,
+    0xA7, 0x77, 0x0A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC, 0x99, 0xAF, 0x90, 0xAF, 0x92,
+    0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA, 0x4F, 0xAA, 0xEA, 0x4F, 0x9A,
+    0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF, 0xEA, 0x3F, 0xFC, 0xA5, 0xAF,
+    0xCA, 0x97, 0x19, 0x70, 0x77, 0x2A, 0xAA, 0x97, 0x71, 0xAE, 0x72, 0x9F, 0xA0, 0x9D, 0xA7, 0x29,
+    0xFD, 0x0A, 0xA9, 0x72, 0x9E, 0x9A, 0xDA, 0x74, 0x9E, 0x2E, 0x74, 0x99, 0x94, 0x99, 0x77, 0x77,
+    0x39, 0xAF, 0xD9, 0x74, 0xFF, 0xE7, 0x2F, 0xFF, 0xC7, 0x0F, 0xDA, 0xAA, 0xFC, 0x96, 0xFC, 0xA3,
+    0x9F, 0xC5, 0x9F, 0xA5, 0xAF, 0x5F, 0xC6, 0x9F, 0x93, 0x9F, 0x97, 0xF9, 0x3A, 0xF7, 0x0F, 0x93,
+    0xFA, 0x70, 0xF9, 0x3F, 0x97, 0x9F, 0x4F, 0x97, 0xAF, 0x39, 0xF9, 0x7F, 0xC3, 0x9F, 0x97, 0xFA,
+    0x4F, 0x96, 0xAF, 0x5F, 0xA5, 0x9F, 0xA5, 0xFC, 0x93, 0x9F, 0xC6, 0x9F, 0xCA, 0x99, 0xAF, 0xC9,
+    0x7F, 0xFF, 0xCA, 0x71, 0xFF, 0xE9, 0x73, 0x9F, 0xEA, 0x77, 0x19, 0x97, 0x40, 0x77, 0xAA, 0xA9,
+    0x76, 0xEA, 0x7F, 0xC9, 0x0A, 0xD9, 0x7A, 0xFD, 0x0A, 0xA7, 0x0A, 0xE0, 0xE9, 0x71, 0xAD, 0xA2,
+    0xE7, 0x19, 0x95, 0x99, 0x77, 0x76, 0xAF, 0xCA, 0x72, 0x9F, 0xFC, 0x70, 0x9F, 0xFE, 0x7F, 0xC9,
+    0x9A, 0xF9, 0x5A, 0xF9, 0x2F, 0xA5, 0xFA, 0x3A, 0xF4, 0x9F, 0x4A, 0xF4, 0x9F, 0x4A, 0xEA, 0x4A,
+    0xEA, 0x4F, 0xA4, 0xAE, 0xA4, 0xF9, 0x4A, 0xEA, 0x39, 0xF5, 0xAF, 0x3F, 0xA5, 0x9F, 0xA0, 0x9F,
+    0xC7, 0xFF, 0xEA, 0x70, 0xFF, 0xCA, 0x72, 0xAF, 0xCA, 0x97, 0x69, 0x74, 0x39, 0xAA, 0x97, 0x70,
+    0xE7, 0x70, 0x9D, 0x90, 0x9F, 0xA7, 0x19, 0xA9, 0x9F, 0xD7, 0x39, 0xE9, 0xAD, 0xA7, 0x19, 0xE2,
+    0xE7, 0x19, 0x99, 0x49, 0x97, 0x77, 0x59, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F, 0xDA,
+    0xAA, 0xFC, 0x93, 0xFC, 0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F, 0x97,
+    0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09, 0xF9,
+    0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F, 0xC3,
+    0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69, 0x97,
+    0x10, 0x0A, 0xAA, 0x97, 0x29, 0xE7, 0x39, 0xD1, 0xFC, 0x94, 0x9A, 0x9A, 0xFD, 0x6A, 0xE0, 0xE9,
+    0x4A, 0xDA, 0x2E, 0x49, 0x95, 0x99, 0x77, 0x4A, 0xFC, 0xA5, 0x9F, 0xFC, 0x39, 0xFF, 0xE2, 0xFC,
+    0x99, 0xAF, 0x90, 0xAF, 0x92, 0xFA, 0x0F, 0xA3, 0xAF, 0x9F, 0x4A, 0xF9, 0xF4, 0xAE, 0xAA, 0xEA,
+    0x4F, 0xAA, 0xEA, 0x4F, 0x9A, 0xEA, 0x39, 0xF0, 0xAF, 0x3F, 0xA0, 0x9F, 0xA0, 0x9F, 0xC2, 0xFF,
+    0xEA, 0x3F, 0xFC, 0xA5, 0xAF, 0xCA, 0x97, 0x19, 0x70, 0x77, 0x19, 0x77, 0x3E, 0xA7, 0x71, 0xAA,
+    0xD7, 0x73, 0xD7, 0x2A, 0xF9, 0x0E, 0x97, 0x19, 0xFD, 0x0A, 0xA7, 0x29, 0xE9, 0xAD, 0x97, 0x39,
+    0xE2, 0xE7, 0x39, 0x99, 0x49, 0x97, 0x77, 0x71, 0x9A, 0xFD, 0x97, 0x3F, 0xFE, 0x71, 0xFF, 0xFC,
+    0x7F, 0xDA, 0xAA, 0xFC, 0x95, 0xFC, 0xA3, 0x9F, 0xC4, 0x9F, 0xA5, 0xAF, 0x4F, 0xC6, 0x9F, 0x92,
+    0x9F, 0x97, 0xF9, 0x2A, 0xF7, 0x0F, 0x92, 0xFA, 0x70, 0xF9, 0x2F, 0x97, 0x9F, 0x3F, 0x97, 0xAF,
+    0x29, 0xF9, 0x7F, 0xC2, 0x9F, 0x97, 0xFA, 0x3F, 0x96, 0xAF, 0x4F, 0xA5, 0x9F, 0xA4, 0xFC, 0x93,
+    0x9F, 0xC5, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x6F, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA,
+    0x77, 0x09, 0x97, 0x30, 0x75, 0x99, 0x97, 0x6E, 0xA7, 0x59, 0xAD, 0x76, 0xAC, 0xA6, 0xFC, 0x90,
+    0xDA, 0x6A, 0xFD, 0x0A, 0x96, 0xAE, 0x0E, 0x97, 0xAD, 0xA2, 0xE7, 0x99, 0x59, 0x97, 0x77, 0x2A,
+    0xFC, 0xA7, 0x09, 0xFF, 0xC6, 0x9F, 0xFE, 0x5F, 0xC9, 0x9A, 0xF9, 0x3A, 0xF9, 0x2F, 0xA3, 0xFA,
+    0x3A, 0xF2, 0x9F, 0x4A, 0xF2, 0x9F, 0x4A, 0xEA, 0x2A, 0xEA, 0x4F, 0xA2, 0xAE, 0xA4, 0xF9, 0x2A,
+    0xEA, 0x39, 0xF3, 0xAF, 0x3F, 0xA3, 0x9F, 0xA0, 0x9F, 0xC5, 0xFF, 0xEA, 0x6F, 0xFC, 0xA7, 0x0A,
+    0xFC, 0xA9, 0x74, 0x97, 0x20, 0x71, 0x9A, 0x92, 0x9A, 0x97, 0x1F, 0xCA, 0xAD, 0x71, 0x9D, 0xAF,
+    0xCA, 0x71, 0xAC, 0x29, 0xAA, 0x97, 0x5A, 0xAA, 0xA7, 0x6F, 0xCA, 0x74, 0xEA, 0xE9, 0x71, 0x9E,
+    0x91, 0xE7, 0x19, 0x99, 0x49, 0x97, 0x77, 0x59, 0xAF, 0xD9, 0x71, 0xFF, 0xE7, 0xFF, 0xFC, 0x5F,
+    0xDA, 0xAA, 0xFC, 0x93, 0xFC, 0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6, 0x9F, 0x90, 0x9F,
+    0x97, 0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F, 0x97, 0xAF, 0x09,
+    0xF9, 0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2, 0xFC, 0x93, 0x9F,
+    0xC3, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09, 0xFE, 0xA7, 0x69,
+    0x97, 0x10, 0x6A, 0xAA, 0x2A, 0xC6, 0xFC, 0xAA, 0xD5, 0xAC, 0xAA, 0xFC, 0x95, 0xAA, 0x29, 0xAA,
+    0x71, 0x9A, 0xAA, 0xA7, 0x1A, 0xFC, 0xA7, 0xAE, 0x9E, 0x6A, 0xDA, 0x19, 0xE5, 0x99, 0x59, 0x97,
+    0x76, 0xAF, 0xCA, 0x69, 0xFF, 0xC4, 0x9F, 0xFE, 0x3F, 0xC9, 0x9A, 0xF9, 0x1A, 0xF9, 0x2F, 0xA1,
+    0xFA, 0x3A, 0xF0, 0x9F, 0x4A, 0xF0, 0x9F, 0x4A, 0xEA, 0x0A, 0xEA, 0x4F, 0xA0, 0xAE, 0xA4, 0xF9,
+    0x0A, 0xEA, 0x39, 0xF1, 0xAF, 0x3F, 0xA1, 0x9F, 0xA0, 0x9F, 0xC3, 0xFF, 0xEA, 0x4F, 0xFC, 0xA6,
+    0xAF, 0xCA, 0x97, 0x29, 0x70, 0x72, 0x99, 0x99, 0x97, 0x5F, 0xD7, 0x4F, 0xEA, 0x72, 0xF0, 0x9E,
+    0x97, 0x0E, 0xA2, 0xAE, 0x70, 0x99, 0x94, 0x99, 0x97, 0x77, 0x49, 0xAF, 0xD9, 0x71, 0xFF, 0xE7,
+    0xFF, 0xFC, 0x5F, 0xDA, 0xAA, 0xFC, 0x93, 0xFC, 0xA3, 0x9F, 0xC2, 0x9F, 0xA5, 0xAF, 0x2F, 0xC6,
+    0x9F, 0x90, 0x9F, 0x97, 0xF9, 0x0A, 0xF7, 0x0F, 0x90, 0xFA, 0x70, 0xF9, 0x0F, 0x97, 0x9F, 0x1F,
+    0x97, 0xAF, 0x09, 0xF9, 0x7F, 0xC0, 0x9F, 0x97, 0xFA, 0x1F, 0x96, 0xAF, 0x2F, 0xA5, 0x9F, 0xA2,
+    0xFC, 0x93, 0x9F, 0xC3, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x4F, 0xFF, 0xCA, 0x6F, 0xFE, 0x97, 0x09,
+    0xFE, 0xA7, 0x69, 0x97, 0x77, 0x73, 0xEA, 0x76, 0xAF, 0x76, 0xFC, 0x76, 0x9E, 0x97, 0x77, 0x50,
+    0x79, 0x99, 0x97, 0x1F, 0xD7, 0xFE, 0x95, 0xF0, 0xAE, 0x4E, 0xA2, 0xEA, 0x39, 0x95, 0x99, 0x97,
+    0x73, 0xAF, 0xCA, 0x59, 0xFF, 0xC3, 0x9F, 0xFE, 0x2F, 0xC9, 0x9A, 0xF9, 0x0A, 0xF9, 0x2F, 0xA0,
+    0xFA, 0x3A, 0xF9, 0xF4, 0xAF, 0x9F, 0x4A, 0xEA, 0xAE, 0xA4, 0xFA, 0xAE, 0xA4, 0xF9, 0xAE, 0xA3,
+    0x9F, 0x0A, 0xF3, 0xFA, 0x09, 0xFA, 0x09, 0xFC, 0x2F, 0xFE, 0xA3, 0xFF, 0xCA, 0x5A, 0xFC, 0xA9,
+    0x71, 0x97, 0x77, 0x19, 0xE9, 0x71, 0xFC, 0x71, 0xFA, 0x71, 0xAE, 0x77, 0x60, 0x74, 0x99, 0x99,
+    0x77, 0x3A, 0xF7, 0x72, 0x9F, 0x77, 0x3F, 0x77, 0x3E, 0xA7, 0x74, 0x99, 0x97, 0x77, 0x7F, 0x96,
+    0x9A, 0xFD, 0x92, 0x9F, 0x6A, 0xFF, 0xD1, 0xAE, 0xA5, 0xFF, 0xFC, 0xAF, 0x5F, 0xDA, 0xAA, 0xFF,
+    0xC5, 0xFC, 0xA4, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0x96, 0xFC, 0x7F, 0x95, 0x9F, 0x97, 0xF9, 0x5A,
+    0xF7, 0x0F, 0x95, 0xFA, 0x70, 0xF9, 0x5F, 0x97, 0x9F, 0x6F, 0x97, 0x9F, 0x6F, 0x70, 0xAF, 0x6F,
+    0x70, 0xF9, 0x6F, 0x96, 0xAF, 0x7F, 0xA5, 0x9F, 0xA7, 0xFC, 0x49, 0xFC, 0x70, 0x9F, 0xCA, 0x99,
+    0xFD, 0x97, 0x1F, 0xFF, 0xCA, 0x73, 0xFF, 0xE9, 0x75, 0x9F, 0xEA, 0x77, 0x39, 0x77, 0x71, 0x99,
+    0x99, 0x97, 0x69, 0xF9, 0x76, 0xF9, 0x76, 0xF9, 0x76, 0xAE, 0x49, 0x99, 0x97, 0x99, 0x95, 0xF7,
+    0x79, 0xF5, 0xAF, 0xCA, 0x2F, 0x93, 0x9F, 0xFC, 0x9F, 0xA3, 0x9F, 0xFF, 0xDA, 0x4F, 0xC9, 0x9A,
+    0xFD, 0x94, 0xAF, 0x92, 0xFA, 0x6F, 0xA3, 0xAF, 0x59, 0xF4, 0xAF, 0x59, 0xF4, 0xAE, 0xA5, 0xAE,
+    0xA4, 0xFA, 0x5A, 0xEA, 0x4F, 0x95, 0xAE, 0xA3, 0x9F, 0x6A, 0xF3, 0xFA, 0x69, 0xFA, 0x09, 0xFC,
+    0x70, 0xFF, 0xEA, 0x71, 0xFF, 0xCA, 0x73, 0xAF, 0xCA, 0x97, 0x79, 0x75, 0x70, 0x99, 0x99, 0x77,
+    0x4F, 0x77, 0x4A, 0xEA, 0x77, 0x4A, 0xE7, 0x75, 0xE9, 0x77, 0x59, 0x97, 0x77, 0x6F, 0x96, 0x9A,
+    0xFD, 0x92, 0x9F, 0x6A, 0xFF, 0xD1, 0xAE, 0xA5, 0xFF, 0xFC, 0xAF, 0x5F, 0xDA, 0xAA, 0xFF, 0xC5,
+    0xFC, 0xA4, 0xFD, 0xA5, 0x9F, 0xA5, 0x9F, 0x96, 0xFC, 0x7F, 0x95, 0x9F, 0x97, 0xF9, 0x5A, 0xF7,
+    0x0F, 0x95, 0xFA, 0x70, 0xF9, 0x5F, 0x97, 0x9F, 0x6F, 0x97, 0x9F, 0x6F, 0x70, 0xAF, 0x6F, 0x70,
+    0xF9, 0x6F, 0x96, 0xAF, 0x7F, 0xA5, 0x9F, 0xA7, 0xFC, 0x49, 0xFC, 0x70, 0x9F, 0xCA, 0x99, 0xFD,
+    0x97, 0x1F, 0xFF, 0xCA, 0x73, 0xFF, 0xE9, 0x75, 0x9F, 0xEA, 0x77, 0x39, 0x77, 0x59, 0x99, 0x97,
+    0x70, 0xF7, 0x70, 0xAE, 0xA7, 0x70, 0xAE, 0x77, 0x1E, 0x93, 0x99, 0x99, 0x71, 0x99, 0x4F, 0x77,
+    0x9F, 0x5A, 0xFC, 0xA2, 0xF9, 0x39, 0xFF, 0xC9, 0xFA, 0x39, 0xFF, 0xFD, 0xA4, 0xFC, 0x99, 0xAF,
+    0xD9, 0x4A, 0xF9, 0x2F, 0xA6, 0xFA, 0x3A, 0xF5, 0x9F, 0x4A, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A, 0xEA,
+    0x4F, 0xA5, 0xAE, 0xA4, 0xF9, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0x3F, 0xA6, 0x9F, 0xA0, 0x9F, 0xC7,
+    0x0F, 0xFE, 0xA7, 0x1F, 0xFC, 0xA7, 0x3A, 0xFC, 0xA9, 0x77, 0x97, 0x50, 0x77, 0x77, 0x29, 0xF9,
+    0x77, 0x2A, 0xFC, 0x97, 0x71, 0x99, 0x9E, 0xA7, 0x74, 0xE9, 0x77, 0x29, 0xAE, 0x77, 0x3E, 0xA7,
+    0x74, 0xD9, 0x77, 0x76, 0xF9, 0x69, 0xAF, 0xD9, 0x29, 0xF6, 0xAF, 0xFD, 0x1A, 0xEA, 0x5F, 0xFF,
+    0xCA, 0xF5, 0xFD, 0xAA, 0xAF, 0xFC, 0x5F, 0xCA, 0x4F, 0xDA, 0x59, 0xFA, 0x59, 0xF9, 0x6F, 0xC7,
+    0xF9, 0x59, 0xF9, 0x7F, 0x95, 0xAF, 0x70, 0xF9, 0x5F, 0xA7, 0x0F, 0x95, 0xF9, 0x79, 0xF6, 0xF9,
+    0x79, 0xF6, 0xF7, 0x0A, 0xF6, 0xF7, 0x0F, 0x96, 0xF9, 0x6A, 0xF7, 0xFA, 0x59, 0xFA, 0x7F, 0xC4,
+    0x9F, 0xC7, 0x09, 0xFC, 0xA9, 0x9F, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x3F, 0xFE, 0x97, 0x59, 0xFE,
+    0xA7, 0x73, 0x97, 0x70, 0x77, 0x73, 0xFC, 0x97, 0x6F, 0xD7, 0x69, 0x09, 0xE7, 0x71, 0xE7, 0x7A,
+    0xE9, 0x76, 0x9D, 0xA4, 0x99, 0x99, 0x70, 0xAA, 0x5F, 0x77, 0x9F, 0x5A, 0xFC, 0xA2, 0xF9, 0x39,
+    0xFF, 0xC9, 0xFA, 0x39, 0xFF, 0xFD, 0xA4, 0xFC, 0x99, 0xAF, 0xD9, 0x4A, 0xF9, 0x2F, 0xA6, 0xFA,
+    0x3A, 0xF5, 0x9F, 0x4A, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A, 0xEA, 0x4F, 0xA5, 0xAE, 0xA4, 0xF9, 0x5A,
+    0xEA, 0x39, 0xF6, 0xAF, 0x3F, 0xA6, 0x9F, 0xA0, 0x9F, 0xC7, 0x0F, 0xFE, 0xA7, 0x1F, 0xFC, 0xA7,
+    0x3A, 0xFC, 0xA9, 0x77, 0x97, 0x50, 0x77, 0x77, 0x09, 0xE9, 0x2D, 0x97, 0x49, 0xFD, 0xAE, 0x75,
+    0xFF, 0xDA, 0x74, 0x9D, 0x19, 0xFA, 0x76, 0x99, 0x49, 0x77, 0x75, 0xF9, 0x69, 0xAF, 0xD9, 0x29,
+    0xF6, 0xAF, 0xFD, 0x1A, 0xEA, 0x5F, 0xFF, 0xCA, 0xF5, 0xFD, 0xAA, 0xAF, 0xFC, 0x5F, 0xCA, 0x4F,
+    0xDA, 0x59, 0xFA, 0x59, 0xF9, 0x6F, 0xC7, 0xF9, 0x59, 0xF9, 0x7F, 0x95, 0xAF, 0x70, 0xF9, 0x5F,
+    0xA7, 0x0F, 0x95, 0xF9, 0x79, 0xF6, 0xF9, 0x79, 0xF6, 0xF7, 0x0A, 0xF6, 0xF7, 0x0F, 0x96, 0xF9,
+    0x6A, 0xF7, 0xFA, 0x59, 0xFA, 0x7F, 0xC4, 0x9F, 0xC7, 0x09, 0xFC, 0xA9, 0x9F, 0xD9, 0x71, 0xFF,
+    0xFC, 0xA7, 0x3F, 0xFE, 0x97, 0x59, 0xFE, 0xA7, 0x73, 0x97, 0x70, 0x77, 0x72, 0xEA, 0x2A, 0xCA,
+    0x71, 0xFD, 0xAE, 0x97, 0x0A, 0xFF, 0xD7, 0x1D, 0x91, 0xAF, 0x19, 0x99, 0x94, 0x99, 0x49, 0x3F,
+    0x77, 0x9F, 0x5A, 0xFC, 0xA2, 0xF9, 0x39, 0xFF, 0xC9, 0xFA, 0x39, 0xFF, 0xFD, 0xA4, 0xFC, 0x99,
+    0xAF, 0xD9, 0x4A, 0xF9, 0x2F, 0xA6, 0xFA, 0x3A, 0xF5, 0x9F, 0x4A, 0xF5, 0x9F, 0x4A, 0xEA, 0x5A,
+    0xEA, 0x4F, 0xA5, 0xAE, 0xA4, 0xF9, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0x3F, 0xA6, 0x9F, 0xA0, 0x9F,
+    0xC7, 0x0F, 0xFE, 0xA7, 0x1F, 0xFC, 0xA7, 0x3A, 0xFC, 0xA9, 0x77, 0x97, 0x50, 0x77, 0x77, 0x74,
+    0xF9, 0x69, 0xAF, 0xD9, 0x29, 0xF6, 0xAF, 0xFD, 0x1A, 0xEA, 0x5F, 0xFF, 0xCA, 0xF5, 0xFD, 0xAA,
+    0xAF, 0xFC, 0x5F, 0xCA, 0x4F, 0xDA, 0x59, 0xFA, 0x59, 0xF9, 0x6F, 0xC7, 0xF9, 0x59, 0xF9, 0x7F,
+    0x95, 0xAF, 0x70, 0xF9, 0x5F, 0xA7, 0x0F, 0x95, 0xF9, 0x79, 0xF6, 0xF9, 0x79, 0xF6, 0xF7, 0x0A,
+    0xF6, 0xF7, 0x0F, 0x96, 0xF9, 0x6A, 0xF7, 0xFA, 0x59, 0xFA, 0x7F, 0xC4, 0x9F, 0xC7, 0x09, 0xFC,
+    0xA9, 0x9F, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x3F, 0xFE, 0x97, 0x59, 0xFE, 0xA7, 0x73, 0x97, 0x77,
+    0x77, 0x6E, 0xA7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x73, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x99, 0x99,
+    0x77, 0x0F, 0x77, 0x9F, 0x5A, 0xFC, 0xA2, 0xF9, 0x39, 0xFF, 0xC9, 0xFA, 0x39, 0xFF, 0xFD, 0xA4,
+    0xFC, 0x99, 0xAF, 0xD9, 0x4A, 0xF9, 0x2F, 0xA6, 0xFA, 0x3A, 0xF5, 0x9F, 0x4A, 0xF5, 0x9F, 0x4A,
+    0xEA, 0x5A, 0xEA, 0x4F, 0xA5, 0xAE, 0xA4, 0xF9, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0x3F, 0xA6, 0x9F,
+    0xA0, 0x9F, 0xC7, 0x0F, 0xFE, 0xA7, 0x1F, 0xFC, 0xA7, 0x3A, 0xFC, 0xA9, 0x77, 0x97, 0x77, 0x76,
+    0xAE, 0x77, 0x9F, 0x97, 0x69, 0xF7, 0x70, 0xEA, 0x77, 0x77, 0x10, 0x3F, 0x95, 0xF9, 0x29, 0xF5,
+    0x9F, 0x3A, 0xF5, 0x9F, 0x3A, 0xEA, 0x5A, 0xEA, 0x3F, 0x95, 0xFA, 0x3F, 0x95, 0xF9, 0x29, 0xF5,
+    0x9F, 0x3A, 0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x6F, 0x39, 0xF5, 0x9F, 0x3A,
+    0xF5, 0xAF, 0x3F, 0xA5, 0xFA, 0x3F, 0x95, 0xF9, 0x3F, 0x94, 0xAF, 0x4F, 0xC3, 0x9F, 0xA4, 0xAF,
+    0xCA, 0x9A, 0xFC, 0x6F, 0xFF, 0x96, 0x9F, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x77, 0x73,
+    0xEA, 0x76, 0xAF, 0x76, 0xFC, 0x76, 0x9E, 0x97, 0x77, 0x60, 0x19, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F,
+    0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4, 0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F,
+    0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29, 0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90,
+    0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E, 0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x77, 0x7A, 0xE7,
+    0x4F, 0x97, 0x29, 0xF9, 0x73, 0xF7, 0x77, 0x20, 0x77, 0x75, 0xFA, 0x76, 0xFD, 0x75, 0xA9, 0xAE,
+    0x77, 0x0E, 0x76, 0x9E, 0x97, 0x59, 0xE9, 0x76, 0x9D, 0x77, 0x76, 0xF9, 0x5F, 0x92, 0x9F, 0x59,
+    0xF3, 0xAF, 0x59, 0xF3, 0xAE, 0xA5, 0xAE, 0xA3, 0xF9, 0x5F, 0xA3, 0xF9, 0x5F, 0x92, 0x9F, 0x59,
+    0xF3, 0xAF, 0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF6, 0xF3, 0x9F, 0x59, 0xF3, 0xAF,
+    0x5A, 0xF3, 0xFA, 0x5F, 0xA3, 0xF9, 0x5F, 0x93, 0xF9, 0x4A, 0xF4, 0xFC, 0x39, 0xFA, 0x4A, 0xFC,
+    0xA9, 0xAF, 0xC6, 0xFF, 0xF9, 0x69, 0xFF, 0xDA, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x77, 0x79,
+    0xFA, 0x72, 0x9F, 0xCA, 0x72, 0x90, 0xAE, 0x74, 0xAD, 0xA7, 0x29, 0xF7, 0x3A, 0xD9, 0x74, 0xAA,
+    0xA7, 0x77, 0x09, 0xF4, 0xF2, 0xAE, 0xA3, 0x9F, 0x2F, 0xA3, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF4,
+    0xF2, 0x9F, 0x39, 0xF2, 0xAE, 0xA3, 0xAF, 0x2F, 0x93, 0xFA, 0x2F, 0x4F, 0x92, 0xF3, 0x9F, 0x29,
+    0xF3, 0xFC, 0x29, 0xF2, 0x9F, 0xA2, 0x9F, 0x90, 0xAF, 0xC9, 0x3F, 0xFA, 0xE9, 0x3F, 0xE9, 0x9E,
+    0x5F, 0xC9, 0x09, 0xE7, 0x97, 0x30, 0x73, 0x99, 0x99, 0x77, 0x3F, 0xC7, 0x72, 0xAF, 0x77, 0x3E,
+    0xA7, 0x73, 0xEA, 0x77, 0x49, 0x99, 0x77, 0x77, 0x0A, 0xF2, 0xF6, 0xF9, 0x0F, 0x91, 0x9F, 0x6F,
+    0x09, 0xF2, 0x9F, 0x59, 0xF9, 0xF9, 0x2A, 0xEA, 0x5A, 0xFF, 0x93, 0xF9, 0x5F, 0xEA, 0x5F, 0x6F,
+    0xA9, 0x69, 0xF5, 0x9F, 0x70, 0xAF, 0x59, 0xF7, 0x0F, 0xA5, 0xAE, 0xA7, 0x0F, 0x95, 0xF9, 0x70,
+    0xF6, 0xF7, 0x09, 0xF5, 0x9F, 0x70, 0xAF, 0x5A, 0xF7, 0x0F, 0xA5, 0xFA, 0x70, 0xF9, 0x5F, 0x97,
+    0x0F, 0x94, 0x9F, 0x71, 0xFA, 0x4F, 0xA7, 0x1A, 0xFC, 0x99, 0xAF, 0xC7, 0x3F, 0xFF, 0x97, 0x39,
+    0xFF, 0xD9, 0x75, 0x9F, 0xEA, 0x77, 0x39, 0x77, 0x10, 0x72, 0x99, 0x99, 0x77, 0x1F, 0xA7, 0x70,
+    0xFA, 0x77, 0x0A, 0xEA, 0x77, 0x09, 0xE9, 0x69, 0x99, 0x70, 0x99, 0x7F, 0xA7, 0x71, 0xF9, 0x19,
+    0xF4, 0xF0, 0xAF, 0x2A, 0xEA, 0x39, 0xFA, 0xF3, 0xFA, 0x3A, 0xFF, 0x4F, 0x93, 0xFE, 0xA5, 0xF4,
+    0xF9, 0x79, 0xF3, 0x9F, 0x70, 0xAE, 0xA3, 0xAF, 0x70, 0xF9, 0x3F, 0xA7, 0x0F, 0x4F, 0x97, 0x0F,
+    0x39, 0xF7, 0x09, 0xF3, 0xFC, 0x70, 0x9F, 0x29, 0xFA, 0x70, 0x9F, 0x90, 0xAF, 0xC9, 0x71, 0xFF,
+    0xAE, 0x97, 0x1F, 0xEA, 0x9E, 0x73, 0xFC, 0x90, 0x9E, 0x75, 0x97, 0x71, 0x79, 0x99, 0x97, 0x73,
+    0x9F, 0x77, 0x4A, 0xE9, 0x77, 0x4F, 0x77, 0x5E, 0x77, 0x69, 0x97, 0x77, 0x7A, 0xF2, 0xF6, 0xF9,
+    0x0F, 0x91, 0x9F, 0x6F, 0x09, 0xF2, 0x9F, 0x59, 0xF9, 0xF9, 0x2A, 0xEA, 0x5A, 0xFF, 0x93, 0xF9,
+    0x5F, 0xEA, 0x5F, 0x6F, 0xA9, 0x69, 0xF5, 0x9F, 0x70, 0xAF, 0x59, 0xF7, 0x0F, 0xA5, 0xAE, 0xA7,
+    0x0F, 0x95, 0xF9, 0x70, 0xF6, 0xF7, 0x09, 0xF5, 0x9F, 0x70, 0xAF, 0x5A, 0xF7, 0x0F, 0xA5, 0xFA,
+    0x70, 0xF9, 0x5F, 0x97, 0x0F, 0x94, 0x9F, 0x71, 0xFA, 0x4F, 0xA7, 0x1A, 0xFC, 0x99, 0xAF, 0xC7,
+    0x3F, 0xFF, 0x97, 0x39, 0xFF, 0xD9, 0x75, 0x9F, 0xEA, 0x77, 0x39, 0x77, 0x10, 0x59, 0x99, 0x97,
+    0x72, 0xAE, 0xA7, 0x72, 0xF7, 0x72, 0x9E, 0x97, 0x72, 0x9E, 0x69, 0x99, 0x72, 0x99, 0x5F, 0xA7,
+    0x71, 0xF9, 0x19, 0xF4, 0xF0, 0xAF, 0x2A, 0xEA, 0x39, 0xFA, 0xF3, 0xFA, 0x3A, 0xFF, 0x4F, 0x93,
+    0xFE, 0xA5, 0xF4, 0xF9, 0x79, 0xF3, 0x9F, 0x70, 0xAE, 0xA3, 0xAF, 0x70, 0xF9, 0x3F, 0xA7, 0x0F,
+    0x4F, 0x97, 0x0F, 0x39, 0xF7, 0x09, 0xF3, 0xFC, 0x70, 0x9F, 0x29, 0xFA, 0x70, 0x9F, 0x90, 0xAF,
+    0xC9, 0x71, 0xFF, 0xAE, 0x97, 0x1F, 0xEA, 0x9E, 0x73, 0xFC, 0x90, 0x9E, 0x75, 0x97, 0x71, 0x77,
+    0x77, 0x1F, 0xA7, 0x73, 0xFD, 0x77, 0x2A, 0x9A, 0xE7, 0x75, 0xE7, 0x73, 0x9E, 0xA7, 0x72, 0x9E,
+    0x97, 0x73, 0x9D, 0x77, 0x77, 0x0A, 0xF2, 0xF6, 0xF9, 0x0F, 0x91, 0x9F, 0x6F, 0x09, 0xF2, 0x9F,
+    0x59, 0xF9, 0xF9, 0x2A, 0xEA, 0x5A, 0xFF, 0x93, 0xF9, 0x5F, 0xEA, 0x5F, 0x6F, 0xA9, 0x69, 0xF5,
+    0x9F, 0x70, 0xAF, 0x59, 0xF7, 0x0F, 0xA5, 0xAE, 0xA7, 0x0F, 0x95, 0xF9, 0x70, 0xF6, 0xF7, 0x09,
+    0xF5, 0x9F, 0x70, 0xAF, 0x5A, 0xF7, 0x0F, 0xA5, 0xFA, 0x70, 0xF9, 0x5F, 0x97, 0x0F, 0x94, 0x9F,
+    0x71, 0xFA, 0x4F, 0xA7, 0x1A, 0xFC, 0x99, 0xAF, 0xC7, 0x3F, 0xFF, 0x97, 0x39, 0xFF, 0xD9, 0x75,
+    0x9F, 0xEA, 0x77, 0x39, 0x77, 0x10, 0x77, 0x75, 0x9F, 0xA7, 0x70, 0x9F, 0xCA, 0x77, 0x09, 0x0A,
+    0xE7, 0x72, 0xAD, 0xA7, 0x70, 0x9F, 0x77, 0x1A, 0xD9, 0x69, 0x99, 0x70, 0xAA, 0xA6, 0xFA, 0x77,
+    0x1F, 0x91, 0x9F, 0x4F, 0x0A, 0xF2, 0xAE, 0xA3, 0x9F, 0xAF, 0x3F, 0xA3, 0xAF, 0xF4, 0xF9, 0x3F,
+    0xEA, 0x5F, 0x4F, 0x97, 0x9F, 0x39, 0xF7, 0x0A, 0xEA, 0x3A, 0xF7, 0x0F, 0x93, 0xFA, 0x70, 0xF4,
+    0xF9, 0x70, 0xF3, 0x9F, 0x70, 0x9F, 0x3F, 0xC7, 0x09, 0xF2, 0x9F, 0xA7, 0x09, 0xF9, 0x0A, 0xFC,
+    0x97, 0x1F, 0xFA, 0xE9, 0x71, 0xFE, 0xA9, 0xE7, 0x3F, 0xC9, 0x09, 0xE7, 0x59, 0x77, 0x10, 0x77,
+    0x77, 0xAE, 0x91, 0x9D, 0x75, 0xAF, 0xDA, 0xE7, 0x5F, 0xFD, 0x97, 0x4A, 0xD1, 0x9F, 0x97, 0x69,
+    0x59, 0x77, 0x76, 0xAF, 0x2F, 0x6F, 0x90, 0xF9, 0x19, 0xF6, 0xF0, 0x9F, 0x29, 0xF5, 0x9F, 0x9F,
+    0x92, 0xAE, 0xA5, 0xAF, 0xF9, 0x3F, 0x95, 0xFE, 0xA5, 0xF6, 0xFA, 0x96, 0x9F, 0x59, 0xF7, 0x0A,
+    0xF5, 0x9F, 0x70, 0xFA, 0x5A, 0xEA, 0x70, 0xF9, 0x5F, 0x97, 0x0F, 0x6F, 0x70, 0x9F, 0x59, 0xF7,
+    0x0A, 0xF5, 0xAF, 0x70, 0xFA, 0x5F, 0xA7, 0x0F, 0x95, 0xF9, 0x70, 0xF9, 0x49, 0xF7, 0x1F, 0xA4,
+    0xFA, 0x71, 0xAF, 0xC9, 0x9A, 0xFC, 0x73, 0xFF, 0xF9, 0x73, 0x9F, 0xFD, 0x97, 0x59, 0xFE, 0xA7,
+    0x73, 0x97, 0x71, 0x77, 0x74, 0xAD, 0xA2, 0xAD, 0x73, 0xFD, 0xAA, 0xDA, 0x72, 0x9F, 0xFD, 0x73,
+    0xDA, 0x1A, 0xF9, 0x39, 0x99, 0x49, 0x94, 0x99, 0x4F, 0xA7, 0x71, 0xF9, 0x19, 0xF4, 0xF0, 0xAF,
+    0x2A, 0xEA, 0x39, 0xFA, 0xF3, 0xFA, 0x3A, 0xFF, 0x4F, 0x93, 0xFE, 0xA5, 0xF4, 0xF9, 0x79, 0xF3,
+    0x9F, 0x70, 0xAE, 0xA3, 0xAF, 0x70, 0xF9, 0x3F, 0xA7, 0x0F, 0x4F, 0x97, 0x0F, 0x39, 0xF7, 0x09,
+    0xF3, 0xFC, 0x70, 0x9F, 0x29, 0xFA, 0x70, 0x9F, 0x90, 0xAF, 0xC9, 0x71, 0xFF, 0xAE, 0x97, 0x1F,
+    0xEA, 0x9E, 0x73, 0xFC, 0x90, 0x9E, 0x75, 0x97, 0x71, 0x77, 0x77, 0x74, 0xAF, 0x2F, 0x6F, 0x90,
+    0xF9, 0x19, 0xF6, 0xF0, 0x9F, 0x29, 0xF5, 0x9F, 0x9F, 0x92, 0xAE, 0xA5, 0xAF, 0xF9, 0x3F, 0x95,
+    0xFE, 0xA5, 0xF6, 0xFA, 0x96, 0x9F, 0x59, 0xF7, 0x0A, 0xF5, 0x9F, 0x70, 0xFA, 0x5A, 0xEA, 0x70,
+    0xF9, 0x5F, 0x97, 0x0F, 0x6F, 0x70, 0x9F, 0x59, 0xF7, 0x0A, 0xF5, 0xAF, 0x70, 0xFA, 0x5F, 0xA7,
+    0x0F, 0x95, 0xF9, 0x70, 0xF9, 0x49, 0xF7, 0x1F, 0xA4, 0xFA, 0x71, 0xAF, 0xC9, 0x9A, 0xFC, 0x73,
+    0xFF, 0xF9, 0x73, 0x9F, 0xFD, 0x97, 0x59, 0xFE, 0xA7, 0x73, 0x97, 0x77, 0x77, 0x6A, 0xE7, 0x73,
+    0x9F, 0x97, 0x72, 0x9F, 0x77, 0x4E, 0xA7, 0x77, 0x77, 0x10, 0x77, 0x29, 0x99, 0x77, 0x2F, 0xA7,
+    0x71, 0xF9, 0x19, 0xF4, 0xF0, 0xAF, 0x2A, 0xEA, 0x39, 0xFA, 0xF3, 0xFA, 0x3A, 0xFF, 0x4F, 0x93,
+    0xFE, 0xA5, 0xF4, 0xF9, 0x79, 0xF3, 0x9F, 0x70, 0xAE, 0xA3, 0xAF, 0x70, 0xF9, 0x3F, 0xA7, 0x0F,
+    0x4F, 0x97, 0x0F, 0x39, 0xF7, 0x09, 0xF3, 0xFC, 0x70, 0x9F, 0x29, 0xFA, 0x70, 0x9F, 0x90, 0xAF,
+    0xC9, 0x71, 0xFF, 0xAE, 0x97, 0x1F, 0xEA, 0x9E, 0x73, 0xFC, 0x90, 0x9E, 0x75, 0x97, 0x77, 0x77,
+    0x4E, 0xA7, 0x71, 0xAF, 0x77, 0x1A, 0xF7, 0x71, 0x9E, 0x97, 0x77, 0x75, 0x59, 0x99, 0x97, 0x49,
+    0xF7, 0x5A, 0xE9, 0x75, 0xF7, 0x6E, 0x97, 0x69, 0x97, 0x77, 0x1F, 0x6F, 0xA1, 0xF9, 0x4A, 0xF2,
+    0xAE, 0xA4, 0xFA, 0x29, 0xF3, 0xFC, 0x4F, 0x29, 0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0x90, 0xAF, 0x69,
+    0xEA, 0x9F, 0x70, 0xFF, 0x97, 0x0F, 0xEA, 0x71, 0xAF, 0xD7, 0x29, 0xFC, 0x97, 0x3F, 0xA7, 0x4F,
+    0x74, 0x9F, 0x74, 0xAF, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x20,
+    0x70, 0x99, 0x99, 0x77, 0xF7, 0x7A, 0xEA, 0x77, 0xF7, 0x70, 0xE9, 0x77, 0x09, 0x97, 0x77, 0x59,
+    0xEA, 0x5F, 0x93, 0x9F, 0x4A, 0xF5, 0xF4, 0xF9, 0x5F, 0x3A, 0xF6, 0xF3, 0xF9, 0x6F, 0x2A, 0xF7,
+    0xAE, 0x91, 0xF7, 0x09, 0xE9, 0x0A, 0xEA, 0x70, 0x9E, 0xA0, 0xF7, 0x2E, 0xA9, 0xEA, 0x72, 0xEA,
+    0xF7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x4A, 0xFC, 0xA7, 0x49, 0xFC, 0x75, 0x9F, 0x97, 0x59, 0xF7,
+    0x6F, 0x97, 0x5F, 0xC7, 0x2A, 0xAA, 0xFC, 0x73, 0xFE, 0x97, 0x3F, 0xD9, 0x74, 0xFA, 0x75, 0x0F,
+    0x6F, 0xA1, 0xF9, 0x4A, 0xF2, 0xAE, 0xA4, 0xFA, 0x29, 0xF3, 0xFC, 0x4F, 0x29, 0xF5, 0xF9, 0x1F,
+    0x95, 0xAE, 0x90, 0xAF, 0x69, 0xEA, 0x9F, 0x70, 0xFF, 0x97, 0x0F, 0xEA, 0x71, 0xAF, 0xD7, 0x29,
+    0xFC, 0x97, 0x3F, 0xA7, 0x4F, 0x74, 0x9F, 0x74, 0xAF, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0x74,
+    0x9F, 0x74, 0xAE, 0xA7, 0x77, 0x77, 0x70, 0xEA, 0x74, 0xAF, 0x74, 0xAF, 0x74, 0x9E, 0x97, 0x77,
+    0x50, 0x39, 0xEA, 0x5F, 0x93, 0x9F, 0x4A, 0xF5, 0xF4, 0xF9, 0x5F, 0x3A, 0xF6, 0xF3, 0xF9, 0x6F,
+    0x2A, 0xF7, 0xAE, 0x91, 0xF7, 0x09, 0xE9, 0x0A, 0xEA, 0x70, 0x9E, 0xA0, 0xF7, 0x2E, 0xA9, 0xEA,
+    0x72, 0xEA, 0xF7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x4A, 0xFC, 0xA7, 0x49, 0xFC, 0x75, 0x9F, 0x97,
+    0x59, 0xF7, 0x6F, 0x97, 0x5F, 0xC0, 0xAE, 0x5A, 0xAA, 0xFC, 0x1F, 0x94, 0xFE, 0x90, 0x9F, 0x94,
+    0xFD, 0x92, 0xEA, 0x5F, 0xA7, 0x50, 0x77, 0x79, 0xF9, 0x73, 0xAF, 0xC9, 0x72, 0x99, 0x9E, 0xA7,
+    0x5E, 0x97, 0x39, 0xAE, 0x74, 0xEA, 0x75, 0xDA, 0x77, 0x72, 0xF6, 0xFA, 0x1F, 0x94, 0xAF, 0x2A,
+    0xEA, 0x4F, 0xA2, 0x9F, 0x3F, 0xC4, 0xF2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xE9, 0x0A, 0xF6, 0x9E,
+    0xA9, 0xF7, 0x0F, 0xF9, 0x70, 0xFE, 0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xF7,
+    0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x72, 0x77,
+    0x75, 0xFC, 0x97, 0x5F, 0xD7, 0x59, 0x09, 0xE7, 0x79, 0xE7, 0x6A, 0xE9, 0x75, 0x9D, 0xA7, 0x79,
+    0xAA, 0x77, 0x76, 0x9E, 0xA5, 0xF9, 0x39, 0xF4, 0xAF, 0x5F, 0x4F, 0x95, 0xF3, 0xAF, 0x6F, 0x3F,
+    0x96, 0xF2, 0xAF, 0x7A, 0xE9, 0x1F, 0x70, 0x9E, 0x90, 0xAE, 0xA7, 0x09, 0xEA, 0x0F, 0x72, 0xEA,
+    0x9E, 0xA7, 0x2E, 0xAF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0xAF, 0xCA, 0x74, 0x9F, 0xC7, 0x59,
+    0xF9, 0x75, 0x9F, 0x76, 0xF9, 0x75, 0xFC, 0x72, 0xAA, 0xAF, 0xC7, 0x3F, 0xE9, 0x73, 0xFD, 0x97,
+    0x4F, 0xA7, 0x50, 0x77, 0x6A, 0xE9, 0x2D, 0x6A, 0xFD, 0xAE, 0x6F, 0xFD, 0x95, 0x9D, 0x19, 0xFA,
+    0x79, 0x59, 0x77, 0x70, 0xF6, 0xFA, 0x1F, 0x94, 0xAF, 0x2A, 0xEA, 0x4F, 0xA2, 0x9F, 0x3F, 0xC4,
+    0xF2, 0x9F, 0x5F, 0x91, 0xF9, 0x5A, 0xE9, 0x0A, 0xF6, 0x9E, 0xA9, 0xF7, 0x0F, 0xF9, 0x70, 0xFE,
+    0xA7, 0x1A, 0xFD, 0x72, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xF7, 0x4A, 0xEA,
+    0x74, 0xF9, 0x74, 0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x72, 0x77, 0x73, 0x9E, 0x92, 0xD9, 0x79, 0xFD,
+    0xAE, 0x70, 0xFF, 0xD9, 0x79, 0xD1, 0x9F, 0xA7, 0x19, 0x59, 0x77, 0x74, 0x9E, 0xA5, 0xF9, 0x39,
+    0xF4, 0xAF, 0x5F, 0x4F, 0x95, 0xF3, 0xAF, 0x6F, 0x3F, 0x96, 0xF2, 0xAF, 0x7A, 0xE9, 0x1F, 0x70,
+    0x9E, 0x90, 0xAE, 0xA7, 0x09, 0xEA, 0x0F, 0x72, 0xEA, 0x9E, 0xA7, 0x2E, 0xAF, 0x73, 0xFE, 0xA7,
+    0x3A, 0xFD, 0x74, 0xAF, 0xCA, 0x74, 0x9F, 0xC7, 0x59, 0xF9, 0x75, 0x9F, 0x76, 0xF9, 0x75, 0xFC,
+    0x72, 0xAA, 0xAF, 0xC7, 0x3F, 0xE9, 0x73, 0xFD, 0x97, 0x4F, 0xA7, 0x50, 0x72, 0x9A, 0x6C, 0xA1,
+    0x9A, 0xAA, 0xAC, 0xA0, 0xAC, 0xAA, 0xAC, 0xA0, 0xAA, 0x1C, 0xA1, 0xAA, 0x09, 0xA2, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x72, 0xA9, 0x4A, 0xC4, 0xAC, 0xAA, 0xAA,
+    0x90, 0xAC, 0xAA, 0xAC, 0xA1, 0xAC, 0x1A, 0xA2, 0xA9, 0x0A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0xA0, 0xFE, 0x99, 0xFE,
+    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x90, 0xFE, 0xA0, 0xFE, 0x99, 0xFE, 0x00, 0x9F, 0xFF, 0xC9, 0xAF,
+    0xFF, 0xC0, 0xFF, 0xFD, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x09, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA1, 0xFF, 0xF1, 0xFF, 0xF0, 0x9F, 0xFE, 0xA0, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x9F, 0xFF, 0xFF, 0xFC, 0xA0, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFF, 0xFC, 0xA0,
+    0x73, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9,
+    0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E,
+    0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A,
+    0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9,
+    0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x9E,
+    0x3A, 0xD9, 0x9E, 0x3A, 0xD9, 0x0A, 0xAA, 0x39, 0xAA, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x91, 0xFF, 0xEA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x91, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x3A, 0xD9, 0x29, 0xE3, 0xEA, 0x2A,
+    0xE9, 0x2F, 0x2A, 0xEA, 0x2F, 0x39, 0x99, 0x92, 0x2A, 0xE9, 0x2F, 0x2A, 0xEA, 0x2F, 0x29, 0xE9,
+    0x2A, 0xE3, 0xE9, 0x39, 0x99, 0x30, 0x29, 0x99, 0x93, 0xF9, 0x19, 0xF2, 0xF9, 0x2E, 0xA2, 0xAE,
+    0x3E, 0xA3, 0xDA, 0x30, 0xAE, 0x0A, 0xE0, 0xAE, 0x09, 0xE0, 0x9E, 0x1E, 0x1E, 0x29, 0x90, 0x3A,
+    0xD9, 0x19, 0xDA, 0x29, 0xE2, 0xE9, 0x2E, 0xA1, 0xAE, 0x2A, 0xE2, 0xEA, 0x2F, 0x1F, 0x2A, 0xE9,
+    0x09, 0xF2, 0xF1, 0xF9, 0x29, 0x99, 0x91, 0x99, 0x99, 0x20, 0x2A, 0xE9, 0x09, 0xEA, 0x2F, 0x1F,
+    0x91, 0xAE, 0x91, 0xF2, 0xF1, 0xAE, 0x91, 0x9E, 0x91, 0xF2, 0xAE, 0x19, 0xE3, 0xE2, 0xEA, 0x39,
+    0x99, 0x29, 0x99, 0x30, 0x29, 0x99, 0x92, 0x99, 0x99, 0x2F, 0x1A, 0xEA, 0x19, 0xEA, 0x1F, 0x2F,
+    0x19, 0xEA, 0x2E, 0xA1, 0xF2, 0xAE, 0x2E, 0xA2, 0xEA, 0x1A, 0xE3, 0xDA, 0x2A, 0xD9, 0x20, 0xF1,
+    0xAE, 0x0F, 0x1A, 0xE9, 0xAE, 0x19, 0xE9, 0x9E, 0x19, 0xE9, 0x9E, 0x2E, 0x90, 0xE2, 0xE9, 0x0E,
+    0x91, 0xAD, 0xA1, 0x99, 0x39, 0x90, 0x77, 0x2F, 0x70, 0xEA, 0x70, 0xE9, 0x70, 0xE7, 0x1D, 0xA4,
+    0x9A, 0x99, 0x9D, 0xA9, 0x9A, 0xA0, 0xAF, 0xFD, 0xA0, 0xFF, 0xE9, 0x0C, 0xAA, 0xAE, 0x9A, 0xAC,
+    0x5D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1E, 0x70, 0x9E, 0x70, 0xEA, 0x70, 0xE9, 0x79,
+    0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0x9E, 0xA6, 0x77, 0x7A, 0xE9, 0x72, 0xAE, 0x73, 0xEA, 0x73,
+    0xE7, 0x4E, 0x7A, 0xFF, 0xE3, 0xAF, 0xFE, 0x3F, 0xFE, 0xA7, 0xE7, 0x4E, 0x73, 0xAE, 0x73, 0xF7,
+    0x3E, 0x97, 0x99, 0x1E, 0x19, 0x93, 0x9F, 0xFE, 0x3A, 0xFF, 0xE3, 0xFE, 0xAE, 0xA7, 0xAD, 0x74,
+    0xE7, 0x39, 0xE7, 0x3F, 0x73, 0xF7, 0x73, 0x9F, 0x92, 0x9F, 0xD9, 0x1F, 0xF1, 0xFF, 0x1F, 0xF1,
+    0xFF, 0x1A, 0xFE, 0x2F, 0xD4, 0xAD, 0xA2, 0x73, 0xAA, 0x7D, 0xA6, 0xEA, 0x5F, 0xC3, 0x9F, 0xD2,
+    0xAF, 0xE1, 0xFE, 0x91, 0xFC, 0x92, 0x9E, 0x94, 0xAC, 0x96, 0x97, 0x00, 0x19, 0xA9, 0x1F, 0x99,
+    0xFA, 0xAF, 0x99, 0xF2, 0x99, 0x10, 0x19, 0x95, 0x99, 0x91, 0xF3, 0xAE, 0xAA, 0xF9, 0x2F, 0xCA,
+    0xF2, 0x9F, 0xA9, 0xEA, 0x3F, 0x29, 0x69, 0x91, 0x19, 0x95, 0x99, 0x59, 0x92, 0xF3, 0xF3, 0xF0,
+    0xAF, 0x91, 0xAF, 0x91, 0xAF, 0x9A, 0xF2, 0xAF, 0x2F, 0xC0, 0x9E, 0xA2, 0x9E, 0xA2, 0x9E, 0xA2,
+    0x96, 0x96, 0x92, 0x19, 0x92, 0xF0, 0xAF, 0x9F, 0xC0, 0x9E, 0xA2, 0x92, 0x9A, 0xAA, 0xAA, 0xA0,
+    0xAC, 0xAA, 0xAA, 0xA0, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0x0A, 0xAA, 0xAA, 0xA9, 0x0A, 0xAA, 0xAA, 0xCA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x79, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD,
+    0x99, 0xFD, 0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2,
+    0x79, 0xFD, 0x99, 0xC5, 0x9C, 0x59, 0xC5, 0x9C, 0x59, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD, 0x95, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0x99, 0xFD,
+    0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x77, 0x77, 0x5A, 0xF7,
+    0x9D, 0xA7, 0x7F, 0xE6, 0xE7, 0x7F, 0xF9, 0x4E, 0x97, 0x69, 0xE9, 0x0E, 0xA3, 0xAD, 0xA7, 0x7A,
+    0xE1, 0xEA, 0x29, 0xE7, 0x70, 0xEA, 0x1E, 0xA2, 0xE7, 0x71, 0xE9, 0x1E, 0xA1, 0xE9, 0x77, 0x09,
+    0xE1, 0x9E, 0x90, 0xAD, 0xA7, 0x71, 0x9E, 0x1A, 0xE0, 0x9E, 0x09, 0xAD, 0xA5, 0x9A, 0xCA, 0x91,
+    0x9E, 0x99, 0xEA, 0x0E, 0x0A, 0xFD, 0x3F, 0xDA, 0x1F, 0xF0, 0xE9, 0x9F, 0xEA, 0x1F, 0xF1, 0xAF,
+    0xD9, 0xAD, 0xA0, 0xF0, 0xF0, 0x9E, 0xA9, 0xE9, 0x19, 0xEA, 0x09, 0xE0, 0x9E, 0x90, 0xAE, 0x0F,
+    0x1E, 0x97, 0xE9, 0x0A, 0xE1, 0xAE, 0x0E, 0x91, 0xE9, 0x6E, 0xA1, 0xEA, 0x1F, 0x9E, 0x2E, 0x95,
+    0xAE, 0x2E, 0x91, 0xEA, 0x9E, 0x19, 0xE5, 0x9E, 0x3E, 0x90, 0x9E, 0x9A, 0xE1, 0xAE, 0x5E, 0x93,
+    0xE9, 0x0A, 0xE0, 0xAE, 0x1E, 0xA4, 0xEA, 0x4F, 0xF9, 0x09, 0xFF, 0x4A, 0xE5, 0xAF, 0xDA, 0x2F,
+    0xE9, 0x39, 0xE7, 0xAF, 0xA4, 0xFC, 0x97, 0x77, 0x59, 0x50, 0x77, 0x77, 0x77, 0x0A, 0xF7, 0x9D,
+    0xA7, 0x77, 0x2F, 0xE6, 0xE7, 0x77, 0x2F, 0xF9, 0x4E, 0x97, 0x77, 0x19, 0xE9, 0x0E, 0xA3, 0xAD,
+    0xA7, 0x77, 0x2A, 0xE1, 0xEA, 0x29, 0xE7, 0x77, 0x3E, 0xA1, 0xEA, 0x2E, 0x77, 0x74, 0xE9, 0x1E,
+    0xA1, 0xE9, 0x77, 0x73, 0x9E, 0x19, 0xE9, 0x0A, 0xDA, 0x77, 0x74, 0x9E, 0x1A, 0xE0, 0x9E, 0x09,
+    0xAD, 0xA5, 0x9A, 0xCA, 0x95, 0xAD, 0xA2, 0x9E, 0x99, 0xEA, 0x0E, 0x0A, 0xFD, 0x3F, 0xDA, 0x29,
+    0xFD, 0x2F, 0xF0, 0xE9, 0x9F, 0xEA, 0x1F, 0xF1, 0x9F, 0xEA, 0x1A, 0xFD, 0x9A, 0xDA, 0x0F, 0x0F,
+    0x09, 0xEA, 0x9E, 0x90, 0xF9, 0xAE, 0x29, 0xEA, 0x09, 0xE0, 0x9E, 0x90, 0xAE, 0x0F, 0x1E, 0x99,
+    0xE9, 0x09, 0xE7, 0x0E, 0x90, 0xAE, 0x1A, 0xE0, 0xE9, 0x1E, 0x9A, 0xE1, 0xAE, 0x7E, 0xA1, 0xEA,
+    0x1F, 0x9E, 0x2E, 0x9F, 0x1A, 0xE6, 0xAE, 0x2E, 0x91, 0xEA, 0x9E, 0x19, 0xE0, 0xEA, 0x1E, 0xA5,
+    0x9E, 0x3E, 0x90, 0x9E, 0x9A, 0xE1, 0xAE, 0x0E, 0xA1, 0xE9, 0x5E, 0x93, 0xE9, 0x0A, 0xE0, 0xAE,
+    0x1E, 0xA0, 0xEA, 0x0A, 0xE5, 0xEA, 0x4F, 0xF9, 0x09, 0xFF, 0x1F, 0xFA, 0x4A, 0xE5, 0xAF, 0xDA,
+    0x2F, 0xE9, 0x19, 0xFE, 0x49, 0xE7, 0xAF, 0xA4, 0xFC, 0x93, 0xAF, 0xA7, 0x77, 0x69, 0x77, 0x00,
+    0x4E, 0xA4, 0xAE, 0x5E, 0x94, 0xF4, 0x9E, 0x5E, 0x94, 0x9D, 0xA5, 0xAA, 0xA5, 0x4E, 0xA1, 0x9E,
+    0x93, 0xAE, 0x2F, 0x4E, 0x91, 0x9E, 0x4F, 0x2E, 0x93, 0x9E, 0x2A, 0xE4, 0xE9, 0x2E, 0x49, 0xDA,
+    0x2E, 0x94, 0xAA, 0xA3, 0xAA, 0xA4, 0x4E, 0xA1, 0x9E, 0x91, 0xAE, 0x4A, 0xE2, 0xF2, 0xEA, 0x4E,
+    0x91, 0x9E, 0x2F, 0x4F, 0x2E, 0x91, 0x9E, 0x49, 0xE2, 0xAE, 0x2E, 0xA4, 0xE9, 0x2E, 0x29, 0xE4,
+    0x9D, 0xA2, 0xE9, 0x2E, 0x5A, 0xAA, 0x3A, 0xAA, 0x29, 0xAA, 0x94, 0x9E, 0x93, 0xEA, 0x39, 0xE4,
+    0xEA, 0x39, 0xE4, 0xE9, 0x4D, 0xA4, 0xAA, 0xA0, 0x9E, 0x91, 0xAE, 0x3E, 0xA1, 0x9E, 0x92, 0x9E,
+    0x2F, 0x3E, 0xA2, 0xE3, 0x9E, 0x2A, 0xDA, 0x3E, 0x92, 0xE4, 0xDA, 0x2A, 0xD9, 0x3A, 0xAA, 0x3A,
+    0xAA, 0x9E, 0x91, 0xAE, 0x2E, 0xA3, 0xEA, 0x19, 0xE9, 0x1A, 0xE3, 0x9E, 0x2F, 0x2E, 0xA3, 0xEA,
+    0x2E, 0x29, 0xE3, 0x9E, 0x2A, 0xDA, 0x2E, 0x93, 0xE9, 0x2E, 0x29, 0xE4, 0xDA, 0x2A, 0xD9, 0x2E,
+    0x4A, 0xAA, 0x3A, 0xAA, 0x3A, 0xA9, 0x69, 0x70, 0xD7, 0x9D, 0x96, 0xEA, 0x5A, 0xC9, 0xD4, 0x9D,
+    0x0A, 0xC4, 0xD9, 0x0A, 0xC9, 0x2A, 0xCA, 0x19, 0xCA, 0x2D, 0x3C, 0xA1, 0xD9, 0x3D, 0x00, 0x49,
+    0x69, 0xD9, 0x4F, 0x92, 0xFA, 0x2F, 0xC2, 0xFC, 0x2A, 0xF3, 0xFA, 0x39, 0xF4, 0xF9, 0x3A, 0xF4,
+    0xF4, 0xAD, 0xA5, 0x94, 0x39, 0x94, 0x9E, 0x4A, 0xEA, 0x39, 0xF4, 0xF9, 0x3A, 0xF4, 0xF9, 0x2A,
+    0xF2, 0x9F, 0x91, 0x9F, 0x92, 0xFA, 0x2A, 0xEA, 0x4A, 0xD6, 0x95, 0x72, 0x99, 0x75, 0x99, 0x4A,
+    0xE5, 0xA4, 0x9D, 0x93, 0xFA, 0x3A, 0xD3, 0xF9, 0x2F, 0x92, 0xAE, 0xA3, 0xF9, 0x2D, 0xA2, 0xAE,
+    0xA5, 0xF9, 0x6A, 0xEA, 0x7F, 0x94, 0xAE, 0xA7, 0x1F, 0x92, 0xAE, 0xA7, 0x3F, 0x90, 0xAE, 0xA7,
+    0x99, 0x3F, 0xFA, 0x29, 0x99, 0x1A, 0xE3, 0xFD, 0xA2, 0x9E, 0x90, 0xF9, 0x3F, 0xC3, 0xFA, 0x0F,
+    0x92, 0xAF, 0xC9, 0x2A, 0xEA, 0x1A, 0xC9, 0x2A, 0xFE, 0x92, 0xAC, 0xA7, 0xAE, 0xA0, 0xF9, 0x73,
+    0xAE, 0xA2, 0xF9, 0x71, 0xAE, 0xA4, 0xF9, 0x7A, 0xEA, 0x6F, 0x95, 0xAE, 0xA2, 0x99, 0x3F, 0x93,
+    0xAE, 0xA2, 0xAE, 0x92, 0xF9, 0x2A, 0xDA, 0x3F, 0xA3, 0xE9, 0x3A, 0xA4, 0xF9, 0x4C, 0x97, 0x4A,
+    0xC9, 0x71, 0x3A, 0xF2, 0xAF, 0x4F, 0xC2, 0xFC, 0x4F, 0xA2, 0xFA, 0x4F, 0x92, 0xF9, 0x39, 0xF2,
+    0x9F, 0x4A, 0xF2, 0xAF, 0x4A, 0xEA, 0x2A, 0xEA, 0x4F, 0x92, 0xF9, 0x4F, 0x3F, 0x5F, 0x3F, 0x49,
+    0xEA, 0x29, 0xEA, 0x4A, 0xE9, 0x2A, 0xE9, 0x4F, 0x3A, 0xE5, 0xF3, 0xF7, 0x77, 0x77, 0x19, 0x95,
+    0x99, 0x6F, 0x3F, 0x4A, 0xF9, 0x1A, 0xF9, 0x3A, 0xF9, 0x1A, 0xF9, 0x39, 0xEA, 0x29, 0xEA, 0x69,
+    0x69, 0x60, 0x77, 0xAF, 0xCA, 0x3F, 0xFD, 0x91, 0xFF, 0xE1, 0xAF, 0xC9, 0xF1, 0x99, 0xF0, 0xAE,
+    0x92, 0xEA, 0x0A, 0xE9, 0x2E, 0x90, 0xF3, 0xE9, 0xFA, 0x29, 0xFE, 0xA3, 0xAF, 0xDA, 0x4A, 0xFC,
+    0x95, 0xFC, 0x7F, 0x70, 0xEA, 0x77, 0x77, 0x29, 0x97, 0x1F, 0x7A, 0xF9, 0x6A, 0xF9, 0x69, 0xEA,
+    0x71, 0x97, 0x10, 0x77, 0xAF, 0xFF, 0x1A, 0xFF, 0xF1, 0xFF, 0xFA, 0x00, 0x77, 0x9C, 0x72, 0x9C,
+    0x1C, 0x97, 0x1C, 0xA1, 0xD7, 0x9D, 0x3D, 0x93, 0x9A, 0xD4, 0x9F, 0xFA, 0x7A, 0xFA, 0x94, 0x77,
+    0x4A, 0xFC, 0xA6, 0x9F, 0xFC, 0x49, 0xD9, 0x49, 0xD2, 0x9C, 0xA7, 0x9C, 0xA1, 0xCA, 0x71, 0xAC,
+    0x1C, 0x72, 0x9A, 0x77, 0x00, 0x73, 0xAA, 0x97, 0x29, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x3D, 0x73,
+    0xDA, 0x72, 0x9D, 0x73, 0xD9, 0x72, 0xAC, 0xA7, 0x29, 0xD7, 0x3D, 0xA7, 0x2A, 0xDA, 0x71, 0x9F,
+    0x71, 0xD9, 0xD7, 0x0A, 0xD0, 0xAC, 0x97, 0xD1, 0x9C, 0xA6, 0xDA, 0x19, 0xD5, 0x9D, 0x3D, 0x5D,
+    0x93, 0xD4, 0x77, 0x77, 0x77, 0x1E, 0x97, 0x77, 0x4E, 0x97, 0x77, 0x4E, 0x77, 0x7A, 0xCA, 0x19,
+    0xDA, 0x77, 0x7F, 0xAA, 0xD9, 0x77, 0x69, 0xFF, 0xAA, 0xEA, 0x77, 0x39, 0xAF, 0xFD, 0x97, 0x75,
+    0x9F, 0xFC, 0x97, 0x74, 0x9F, 0xD1, 0x99, 0x77, 0x49, 0xEA, 0xE7, 0x77, 0x9F, 0x0A, 0xDA, 0x77,
+    0x7A, 0xD1, 0x9E, 0x77, 0x2A, 0xDA, 0x19, 0x92, 0xEA, 0x2E, 0xA7, 0x2E, 0xA6, 0xA9, 0x4E, 0x95,
+    0x93, 0xE9, 0x75, 0xE5, 0x9D, 0x91, 0xE7, 0x0A, 0xCA, 0x2E, 0x5A, 0xF9, 0xDA, 0x70, 0xFA, 0x9D,
+    0x95, 0xFF, 0xCA, 0xAE, 0x3F, 0xFA, 0xAA, 0xDA, 0x2A, 0xFF, 0xE4, 0x9A, 0xFF, 0xDA, 0x4F, 0xFD,
+    0x7F, 0xFC, 0x93, 0xFD, 0x19, 0x99, 0x59, 0xFD, 0x19, 0x93, 0xFA, 0xDA, 0x70, 0x9E, 0xAE, 0x95,
+    0xF9, 0x0E, 0x79, 0xF0, 0x9E, 0x59, 0xDA, 0x1E, 0xA7, 0xAD, 0x91, 0xE9, 0x6A, 0x2A, 0xE7, 0x09,
+    0xA2, 0xEA, 0x72, 0x9A, 0x97, 0x6A, 0x94, 0x09, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x90, 0xFE, 0x90,
+    0xFE, 0x71, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA,
+    0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xEA,
+    0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE9, 0x76, 0xAD, 0xA7, 0x69, 0xE7, 0x7E, 0x77, 0x5F, 0xD9, 0x49,
+    0xFD, 0x94, 0xAF, 0xD5, 0xF7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xF7, 0x0E, 0xA7,
+    0x9E, 0x97, 0xAE, 0xAA, 0xA5, 0xAF, 0xD5, 0xFD, 0xA5, 0xEA, 0x99, 0x59, 0xE9, 0x7A, 0xE7, 0x0F,
+    0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0F, 0x99, 0x95, 0xFD, 0xA4, 0x9F, 0xD9, 0x49,
+    0xAA, 0xAA, 0xAA, 0x50, 0x4A, 0xFD, 0x5F, 0xE5, 0xFD, 0xA7, 0x9E, 0x97, 0x9E, 0x97, 0xAE, 0x70,
+    0xF7, 0x0E, 0xA7, 0x9E, 0x97, 0x9E, 0x70, 0xAE, 0x5A, 0xAA, 0xF5, 0xFD, 0xA4, 0x9F, 0xD9, 0x59,
+    0x9F, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x0E, 0xA5, 0x99, 0xAE,
+    0x94, 0xAF, 0xD5, 0xAF, 0xD5, 0xAA, 0xAA, 0xAA, 0x95, 0x77, 0x74, 0xAF, 0xCA, 0x49, 0xAF, 0xCA,
+    0x3F, 0xFD, 0x90, 0x9F, 0xFD, 0x2F, 0xFE, 0x09, 0xFF, 0xDA, 0x1A, 0xDA, 0x99, 0xAF, 0x1E, 0xA9,
+    0x9F, 0xC1, 0x9A, 0x4F, 0x90, 0x99, 0x4F, 0x70, 0xF9, 0x7F, 0x79, 0xF7, 0xAF, 0x6A, 0xFA, 0x6A,
+    0xF9, 0x5F, 0xCA, 0x6F, 0xCA, 0x5F, 0xCA, 0x59, 0xFC, 0x95, 0xFC, 0x96, 0xFC, 0x6A, 0xF7, 0xAE,
+    0xA7, 0xF7, 0x0F, 0x70, 0xEA, 0x79, 0xE9, 0x77, 0x77, 0x77, 0x74, 0x99, 0x72, 0x99, 0x71, 0xF7,
+    0x9F, 0x7A, 0xF9, 0x6F, 0xC7, 0xAF, 0x7F, 0xC7, 0x9E, 0xA7, 0xAE, 0x97, 0x19, 0x72, 0x99, 0x71,
+    0x77, 0x7A, 0xFC, 0xA5, 0xFA, 0x0F, 0xFD, 0x92, 0x9F, 0xA0, 0xFF, 0xE2, 0x9F, 0x1A, 0xDA, 0x99,
+    0xAF, 0x2A, 0xF1, 0x9A, 0x4F, 0x91, 0xFA, 0x70, 0xF9, 0x1F, 0x97, 0x9F, 0x2F, 0x7A, 0xFA, 0x19,
+    0xF6, 0xFC, 0xA2, 0xAE, 0xA5, 0xFC, 0xA3, 0xAE, 0x94, 0xFC, 0x94, 0xF4, 0xAF, 0x6F, 0x4F, 0x7E,
+    0xA4, 0xEA, 0x69, 0xE9, 0x77, 0x77, 0x76, 0x99, 0x71, 0x99, 0x5F, 0x69, 0xF3, 0xAF, 0x95, 0xFC,
+    0x3A, 0xF6, 0xFC, 0x39, 0xEA, 0x6F, 0x95, 0x97, 0x19, 0x95, 0x77, 0x72, 0xAF, 0x39, 0xFD, 0x95,
+    0xFC, 0x1A, 0xFF, 0xCA, 0x4F, 0xA1, 0xFF, 0xE4, 0xF9, 0x19, 0xE9, 0x9A, 0xFA, 0x29, 0xF3, 0xA4,
+    0xAE, 0xA2, 0xAF, 0x71, 0xAE, 0xA2, 0xAE, 0xA7, 0x1F, 0x92, 0xF9, 0x79, 0xFC, 0x3F, 0x7A, 0xFC,
+    0x4F, 0x6A, 0xFC, 0x49, 0xEA, 0x5A, 0xF9, 0x5A, 0xE9, 0x5F, 0x7F, 0x5A, 0xE9, 0x7F, 0x5F, 0x77,
+    0x77, 0x77, 0x69, 0x97, 0x99, 0x97, 0x0F, 0x5F, 0x96, 0xAF, 0x93, 0x9F, 0xA6, 0xAF, 0x93, 0x9F,
+    0x96, 0x9E, 0xA5, 0xF7, 0x19, 0x70, 0x99, 0x70, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x0F, 0xFF, 0xD7,
+    0x1A, 0xE9, 0x71, 0xEA, 0x71, 0xAE, 0x71, 0x9E, 0xA7, 0x1F, 0x71, 0xAE, 0x97, 0x1F, 0x71, 0xF9,
+    0x70, 0x9E, 0xA7, 0x1F, 0x71, 0xAE, 0xA7, 0x1F, 0x71, 0xF9, 0x60, 0x77, 0x0F, 0xFE, 0xA3, 0xFF,
+    0xFC, 0x91, 0xEA, 0xFF, 0xD1, 0xD9, 0x09, 0xFF, 0xC9, 0x0D, 0x90, 0x9F, 0xFC, 0xA0, 0xD9, 0x09,
+    0xFF, 0xD0, 0xD9, 0x09, 0xFF, 0xD0, 0xD9, 0x09, 0xFF, 0xD0, 0xD9, 0x09, 0xFF, 0xD0, 0xD9, 0x09,
+    0xFF, 0xD0, 0xD9, 0x09, 0xFF, 0xCA, 0x0D, 0x90, 0x9F, 0xFC, 0x1D, 0x90, 0x9F, 0xFA, 0x1D, 0x90,
+    0x9F, 0xE9, 0x2D, 0x90, 0x9D, 0x09, 0x95, 0xD9, 0x09, 0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xD9, 0x09,
+    0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xD9, 0x09, 0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xD9, 0x09, 0xD7, 0x0D,
+    0x90, 0x9D, 0x70, 0xD9, 0x09, 0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xAA, 0x19, 0xAA, 0x70, 0x3A, 0xFF,
+    0xDA, 0x19, 0xFF, 0xFA, 0x09, 0xFF, 0xFC, 0xA0, 0xFF, 0xCA, 0x1D, 0xA0, 0xFF, 0xCA, 0x1D, 0xA9,
+    0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9, 0xFF, 0xCA, 0x1D, 0xA9,
+    0xFF, 0xCA, 0x1D, 0xA0, 0xFF, 0xCA, 0x1D, 0xA0, 0xFF, 0xCA, 0x1D, 0xA0, 0x9F, 0xFF, 0xCA, 0x19,
+    0xFF, 0xFA, 0x39, 0xAF, 0xFC, 0x90, 0xFF, 0xE9, 0x3F, 0xFF, 0xC2, 0xFF, 0xFD, 0x1D, 0xA1, 0xFF,
+    0xCA, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFD, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFD, 0x0D,
+    0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFD, 0x0D, 0xA1, 0xFF, 0xD0, 0xDA, 0x1F, 0xFC, 0xA0, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xC9, 0x1A, 0xFF, 0xCA, 0x93, 0x77, 0x5E, 0x97, 0x19, 0xE5, 0x93, 0x9E, 0x5D, 0xA1,
+    0xAD, 0x95, 0xFA, 0xAD, 0x59, 0xFF, 0xAA, 0xE9, 0x19, 0xAF, 0xFD, 0x93, 0x9F, 0xFC, 0x3A, 0xFC,
+    0xA1, 0x99, 0x2A, 0xE9, 0xE5, 0xAE, 0xA0, 0xE9, 0x5E, 0x1A, 0xE6, 0xA9, 0x2E, 0x97, 0x2A, 0x94,
+    0x72, 0xEA, 0x2A, 0xF2, 0xFC, 0x2F, 0xA3, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x19, 0x99, 0x93, 0xF3,
+    0xF3, 0xF3, 0xAE, 0x3A, 0xE3, 0x9E, 0x4D, 0xA3, 0x77, 0x74, 0xAF, 0xCA, 0x72, 0x9F, 0xFC, 0x70,
+    0x9D, 0x94, 0x9D, 0x69, 0xCA, 0x79, 0xCA, 0x5C, 0xA7, 0x1A, 0xC5, 0xC7, 0x29, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xC7, 0x29, 0xC5, 0xC9, 0x71, 0xCA, 0x5D, 0x79, 0xD7, 0xD9, 0x39,
+    0xAD, 0x70, 0x9F, 0xFA, 0x73, 0xAF, 0xA9, 0x70, 0x77, 0x73, 0xE9, 0x75, 0xE9, 0x74, 0x9E, 0x70,
+    0xAC, 0xA1, 0x9D, 0xA7, 0x0F, 0xAA, 0xD9, 0x79, 0xFF, 0xAA, 0xE9, 0x49, 0xAF, 0xFD, 0x96, 0x9F,
+    0xFC, 0x95, 0x9F, 0xCA, 0x19, 0x95, 0xAE, 0xAE, 0x70, 0x9F, 0x0A, 0xDA, 0x70, 0xAD, 0x19, 0xE7,
+    0x19, 0x92, 0xE9, 0x75, 0xA9, 0x77, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0x9E, 0x70, 0xDA, 0x19, 0xDA,
+    0x70, 0xFA, 0xAD, 0x70, 0x9F, 0xFA, 0xAE, 0x94, 0x9A, 0xFF, 0xD9, 0x69, 0xFF, 0xC9, 0x59, 0xFC,
+    0xA1, 0x99, 0x5A, 0xEA, 0xE7, 0x0A, 0xF0, 0xAD, 0xA7, 0x0A, 0xD1, 0x9E, 0x71, 0xA9, 0x2E, 0x97,
+    0x5A, 0x97, 0x74, 0x9E, 0x92, 0x9E, 0x0F, 0xC2, 0xEA, 0x0F, 0xC2, 0xE9, 0x0A, 0xEA, 0x1A, 0xE2,
+    0x9A, 0x92, 0xE9, 0x79, 0xE7, 0x0E, 0xA7, 0x9E, 0x70, 0xAE, 0x70, 0xE9, 0x7A, 0xE7, 0x0E, 0xA7,
+    0x9E, 0x70, 0xEA, 0x70, 0xE9, 0x7A, 0xE7, 0x0E, 0x92, 0x99, 0x29, 0xE1, 0x9F, 0x1E, 0xA1, 0xAF,
+    0x09, 0xE2, 0xAF, 0x0A, 0xE3, 0xEA, 0x71, 0x92, 0x77, 0x76, 0x9F, 0xEA, 0xA9, 0x71, 0x9D, 0x2F,
+    0xFF, 0xDA, 0x94, 0x9E, 0x1A, 0xFF, 0xFF, 0xFF, 0x91, 0xE9, 0x39, 0xAA, 0xFF, 0xFC, 0xA1, 0x9D,
+    0x72, 0x9A, 0xFF, 0x97, 0x75, 0x99, 0x95, 0x69, 0x99, 0x71, 0x9F, 0xE9, 0x5A, 0xEA, 0x9A, 0xE9,
+    0x3A, 0xCA, 0x6D, 0x2A, 0xC9, 0x70, 0xCA, 0x1C, 0x97, 0x1A, 0xC1, 0xA7, 0x39, 0x00, 0x6D, 0xA7,
+    0x09, 0x2D, 0xA1, 0x94, 0x9D, 0x1D, 0xA0, 0xAD, 0x3F, 0x9D, 0xAA, 0xE9, 0x3F, 0xFD, 0x95, 0xFF,
+    0x92, 0x9A, 0xAA, 0xFF, 0xAA, 0xAA, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x3A, 0xFE, 0x6A, 0xFF, 0xC4,
+    0xAE, 0xAD, 0xAF, 0x3A, 0xD9, 0x0D, 0xA0, 0xE4, 0xA9, 0x1D, 0xA1, 0xC7, 0x1D, 0xA7, 0x49, 0x96,
+    0x71, 0x99, 0x72, 0xAE, 0x97, 0x0F, 0xC7, 0x0F, 0xA7, 0x0A, 0xE9, 0x72, 0x97, 0x77, 0x77, 0x49,
+    0xAA, 0x97, 0x1F, 0x70, 0x9F, 0x97, 0x9F, 0x97, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9E,
+    0x71, 0xFA, 0x70, 0xFC, 0x70, 0xF9, 0x71, 0x9A, 0x90, 0x4E, 0xA1, 0xEA, 0x09, 0xE9, 0x09, 0xE9,
+    0x3A, 0xE1, 0xF1, 0xF1, 0xEA, 0x4E, 0x90, 0x9E, 0x90, 0x9E, 0x1A, 0xE4, 0xF1, 0xEA, 0x1E, 0x91,
+    0xE9, 0x39, 0xE1, 0x9E, 0x1A, 0xE1, 0xEA, 0x4E, 0x91, 0xE2, 0xE1, 0x9E, 0x49, 0xDA, 0x1A, 0xDA,
+    0x1E, 0x91, 0xE5, 0xAA, 0xA2, 0xAA, 0xA2, 0xAA, 0xA1, 0x9A, 0xA9, 0x40, 0x71, 0x99, 0x77, 0x3A,
+    0xE9, 0x77, 0x1F, 0xA7, 0x71, 0xFA, 0x77, 0x1A, 0xE9, 0x77, 0x39, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xAA, 0x97, 0x49, 0xAA, 0x2F, 0x73, 0x9F, 0x09, 0xF9, 0x72, 0xAF, 0x99, 0xF9, 0x72, 0xAF,
+    0x1A, 0xDA, 0x74, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9E, 0x77, 0x2F, 0xA7, 0x71,
+    0xFA, 0x77, 0x1F, 0x97, 0x72, 0x9A, 0x97, 0x10, 0x19, 0x97, 0x69, 0x92, 0xF7, 0x4F, 0x09, 0xF9,
+    0x72, 0xAF, 0x99, 0xF9, 0x72, 0xAF, 0x1F, 0x74, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAC,
+    0xA7, 0x72, 0xFA, 0x77, 0x1F, 0xC7, 0x71, 0xFA, 0x77, 0x2A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x6A, 0xDA, 0x74, 0xE9, 0x09, 0xF9, 0x72, 0xAF, 0x09, 0xF9, 0x72, 0xAF, 0x1F, 0x73, 0x9F,
+    0x2A, 0xA7, 0x59, 0xAA, 0x10, 0x19, 0x92, 0xF0, 0x9F, 0x99, 0xF9, 0x0F, 0x29, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x2F, 0x09, 0xF9, 0x9F, 0x90, 0xF2, 0x9A, 0x10, 0x7A, 0xA9, 0x76, 0xFA, 0x75, 0xFC,
+    0x75, 0xFA, 0x75, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0x97, 0x29, 0x92, 0xF7, 0x0F, 0x09,
+    0xF9, 0x6A, 0xF0, 0x9F, 0x96, 0xAF, 0x1F, 0x70, 0xF2, 0x99, 0x72, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x75, 0xAE, 0x97, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0x97, 0x69, 0xA9, 0x70, 0x71, 0x9A, 0xA9, 0x77,
+    0x3A, 0xDA, 0x75, 0xAA, 0x92, 0xAD, 0xA3, 0xAA, 0x95, 0xF9, 0x1A, 0xDA, 0x2F, 0x93, 0x9F, 0xA1,
+    0xAD, 0xA1, 0x9F, 0xA4, 0xF9, 0x1A, 0xDA, 0x2F, 0x94, 0xAD, 0xA2, 0xAD, 0xA2, 0xAD, 0xA7, 0x4A,
+    0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x72, 0xFF, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xFD, 0x90,
+    0xFF, 0xFF, 0xFD, 0x97, 0x1A, 0xE7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x49, 0xDA, 0x2A, 0xDA,
+    0x29, 0xD9, 0x5F, 0x91, 0xAD, 0xA1, 0x9F, 0x93, 0x9F, 0xA1, 0xAD, 0xA1, 0x9F, 0x94, 0xF9, 0x1A,
+    0xDA, 0x19, 0xF9, 0x49, 0xDA, 0x2A, 0xDA, 0x29, 0xD9, 0x74, 0xAD, 0xA7, 0x73, 0x9D, 0xA7, 0x10,
+    0x6A, 0xE1, 0xFA, 0x9F, 0xA0, 0xF9, 0x1A, 0xA9, 0x77, 0x71, 0xAE, 0x1F, 0xA0, 0xFC, 0x0F, 0xA1,
+    0xAA, 0x97, 0x75, 0x92, 0xAE, 0x09, 0xFA, 0x9F, 0xA0, 0xF9, 0x19, 0xA9, 0x00, 0x09, 0x99, 0x0A,
+    0xEA, 0xFF, 0xD9, 0xE9, 0x59, 0xA9, 0x0A, 0xEA, 0xFF, 0xD0, 0xE6, 0xAA, 0xA0, 0xFF, 0xFE, 0x0A,
+    0xCA, 0x6A, 0xCA, 0x0F, 0xFF, 0xE0, 0xAA, 0xA0, 0x79, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA2, 0x9F, 0xD9, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79,
+    0xFD, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xFD, 0x92, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x70, 0xFD, 0x1A, 0xFA, 0x2F, 0x39, 0xD9,
+    0x4D, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x72, 0x99,
+    0x5D, 0x49, 0xD9, 0x3F, 0x2A, 0xFA, 0x1F, 0xD3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA2, 0x72, 0xAA, 0x4A, 0xDA, 0x2C, 0xA1, 0xAC, 0x1C, 0xA1, 0xAC, 0x2A, 0xDA, 0x4D,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79, 0xEA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x29, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA2, 0x39, 0xEA, 0x4F, 0xE2, 0xAF, 0xE9, 0x1E, 0xA0, 0xEA, 0x0A, 0xE1, 0xAE, 0x0E, 0xA1,
+    0xEA, 0x0E, 0x91, 0xEA, 0x0E, 0x91, 0xE9, 0x9E, 0x19, 0xE1, 0xE9, 0x0F, 0x1F, 0xF9, 0x1A, 0xFD,
+    0xA3, 0xAF, 0x97, 0x50, 0x29, 0xA9, 0x2E, 0x2D, 0x97, 0xE2, 0xE1, 0x9D, 0xA1, 0xAD, 0x91, 0xE2,
+    0xE2, 0xDA, 0x19, 0xD9, 0x1A, 0xD2, 0xAA, 0xA2, 0x69, 0xAA, 0xA6, 0x9F, 0x6F, 0xC5, 0xFC, 0xA4,
+    0xFD, 0x93, 0xAD, 0x9E, 0x92, 0xAD, 0x99, 0xE2, 0x9D, 0xA0, 0xAE, 0x2E, 0xAA, 0xFA, 0x09, 0xFF,
+    0xD0, 0x9A, 0xAA, 0xAF, 0xCA, 0x59, 0xE7, 0xAD, 0xA2, 0x2A, 0xAA, 0xAA, 0xAA, 0x29, 0xFE, 0x2A,
+    0xFE, 0x2D, 0xA7, 0xD9, 0x69, 0xFD, 0x39, 0xFE, 0x69, 0xE9, 0x6E, 0x96, 0xE9, 0x0C, 0xA9, 0x99,
+    0xF1, 0xFF, 0x2A, 0xFC, 0xA7, 0x60, 0x49, 0xAE, 0x92, 0x9F, 0xDA, 0x19, 0xFA, 0xD9, 0x1E, 0x95,
+    0xAD, 0xA6, 0xEA, 0xF2, 0xFF, 0xC0, 0x9E, 0x90, 0x9E, 0x09, 0xE2, 0xE1, 0xE1, 0x9E, 0x1E, 0xA9,
+    0xEA, 0x19, 0xFE, 0x39, 0xFA, 0x75, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xC9, 0x1F, 0xFC,
+    0x7E, 0xA6, 0xAE, 0x7E, 0x96, 0xEA, 0x6A, 0xE7, 0xE9, 0x6E, 0xA6, 0xAE, 0x7E, 0x96, 0xAD, 0xA6,
+    0x3A, 0xEA, 0x39, 0xFE, 0x2E, 0xA9, 0xE9, 0x1E, 0x1A, 0xDA, 0x1E, 0xA0, 0xE2, 0x9F, 0xD9, 0x29,
+    0xFC, 0x92, 0xAF, 0xE9, 0x09, 0xE1, 0xF0, 0xAD, 0xA1, 0xAE, 0x0A, 0xE1, 0xEA, 0x09, 0xFF, 0x29,
+    0xFC, 0xA7, 0x50, 0x3A, 0xDA, 0x93, 0x9F, 0xDA, 0x2F, 0xAE, 0x90, 0xAD, 0xA1, 0xAD, 0xA0, 0xE9,
+    0x1A, 0xDA, 0x0E, 0x91, 0xEA, 0x0A, 0xEA, 0xF9, 0x1F, 0xF9, 0x29, 0xA9, 0x9E, 0x6E, 0x90, 0x9A,
+    0x99, 0xAF, 0x19, 0xFD, 0xA2, 0x9F, 0xA9, 0x76, 0x29, 0xC9, 0x59, 0xCA, 0x59, 0xCA, 0x29, 0xAA,
+    0xAD, 0xAA, 0x9A, 0xFF, 0x99, 0x9A, 0xCA, 0x99, 0x92, 0x9C, 0xA5, 0x9C, 0xA5, 0x9A, 0x92, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x71, 0x9F, 0xF0, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xA7, 0x29, 0xFF, 0x09, 0xFF, 0x72, 0x39, 0xD4, 0xD9, 0x3D, 0xA3, 0xAD, 0x4D, 0x93, 0x9D,
+    0x4D, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0x9D, 0x49, 0xD5, 0xD5, 0xD9, 0x4A, 0xCA, 0x49, 0xD7, 0x30,
+    0x3D, 0x5D, 0x94, 0xAC, 0xA4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x4A, 0xD4, 0xDA, 0x4D,
+    0x93, 0xAD, 0x4D, 0x93, 0xAC, 0xA3, 0x9D, 0x39, 0xD7, 0x40, 0x76, 0xD0, 0xAE, 0x39, 0xDA, 0xFC,
+    0x29, 0xE1, 0xE2, 0xAD, 0x91, 0xE2, 0xE2, 0xDA, 0x2D, 0xA1, 0x9D, 0xA1, 0x9D, 0x91, 0x9D, 0x91,
+    0xAD, 0x2A, 0xD2, 0xE2, 0xE2, 0xAA, 0x92, 0xAA, 0x91, 0x3A, 0xE9, 0x4F, 0xDA, 0x2F, 0xF1, 0xAE,
+    0x99, 0xE9, 0x0E, 0xA1, 0xE9, 0x0E, 0x91, 0xE9, 0x9E, 0x2E, 0x9A, 0xE1, 0x9E, 0x0A, 0xE1, 0xF0,
+    0xAE, 0x09, 0xEA, 0x09, 0xFF, 0x2F, 0xE4, 0xFA, 0x76, 0x59, 0xAA, 0x93, 0x9F, 0x92, 0xAF, 0xC1,
+    0x9F, 0xE1, 0xAF, 0xDA, 0x2C, 0xA0, 0xE9, 0x5E, 0x94, 0x9E, 0x5A, 0xE5, 0xEA, 0x5E, 0x94, 0x9E,
+    0x59, 0xE2, 0x39, 0xAE, 0x94, 0xFE, 0xA3, 0xFF, 0x39, 0xA1, 0x9E, 0x96, 0x9E, 0x7F, 0x6F, 0x6F,
+    0x59, 0xEA, 0x5A, 0xE9, 0x5F, 0xFC, 0x91, 0xFF, 0xC1, 0x9F, 0xFC, 0x10, 0x3A, 0xAD, 0xA9, 0x29,
+    0xFE, 0x92, 0xEA, 0xF2, 0x92, 0x9E, 0x6A, 0xDA, 0x3A, 0xAF, 0x39, 0xF9, 0x49, 0xAA, 0xEA, 0x69,
+    0xE6, 0x9E, 0x09, 0xCA, 0x99, 0xAF, 0x09, 0xFF, 0x2A, 0xFC, 0xA7, 0x50, 0x6A, 0xAA, 0xA6, 0x9F,
+    0x59, 0xFC, 0x5F, 0xCA, 0x4F, 0xD9, 0x3E, 0x9E, 0x3A, 0xD0, 0x9E, 0x2A, 0xD9, 0x0A, 0xDA, 0x19,
+    0xEA, 0xAF, 0xA0, 0x9F, 0xFD, 0x09, 0xAA, 0xAA, 0xFA, 0xA5, 0xAE, 0x7A, 0xDA, 0x20, 0x2A, 0xAA,
+    0xAA, 0xAA, 0x29, 0xFE, 0x2A, 0xFE, 0x2D, 0xA6, 0x9D, 0x96, 0xAF, 0xD3, 0xAF, 0xE6, 0x9E, 0x96,
+    0xE9, 0x6E, 0x1C, 0xA9, 0x99, 0xF1, 0xFF, 0x2A, 0xFC, 0xA7, 0x60, 0x4A, 0xAE, 0x92, 0xAF, 0xD9,
+    0x1A, 0xFA, 0xD1, 0x9E, 0x95, 0xE9, 0x6E, 0xAF, 0x19, 0xFF, 0xA0, 0x9E, 0x90, 0x9E, 0x09, 0xDA,
+    0x2E, 0x09, 0xDA, 0x19, 0xE1, 0xE9, 0x9E, 0x91, 0xAF, 0xDA, 0x39, 0xF9, 0x75, 0x1A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x19, 0xFF, 0xC1, 0xAF, 0xFC, 0x7E, 0x7E, 0xA6, 0x9E, 0x7E, 0x96, 0xEA, 0x6A, 0xE7,
+    0xE9, 0x6F, 0x6A, 0xE7, 0xE9, 0x60, 0x39, 0xAE, 0x94, 0xAF, 0xDA, 0x3E, 0xA9, 0xE2, 0x9E, 0x1E,
+    0x3E, 0x09, 0xE3, 0xAF, 0xD4, 0x9F, 0xC4, 0xFF, 0x2E, 0xA1, 0xEA, 0x1E, 0x91, 0xEA, 0x1E, 0xA0,
+    0x9E, 0x91, 0xAF, 0xF3, 0xAF, 0xCA, 0x76, 0x29, 0xAD, 0xA9, 0x3A, 0xFD, 0x91, 0x9E, 0xAA, 0xE1,
+    0xE9, 0x1E, 0x1E, 0x2E, 0x90, 0xE2, 0xE9, 0x0F, 0xAF, 0x19, 0xFF, 0x39, 0x90, 0xAD, 0xA5, 0x9E,
+    0x19, 0xA9, 0xAF, 0x91, 0xAF, 0xD9, 0x2A, 0xFA, 0x77, 0x2A, 0xC6, 0xAC, 0x95, 0xAC, 0x92, 0xAA,
+    0xAD, 0xAA, 0xA9, 0xFF, 0xA9, 0x99, 0xDA, 0x99, 0x3A, 0xC9, 0x5A, 0xC9, 0x59, 0xA3, 0x99, 0x99,
+    0x99, 0x99, 0x0F, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x70, 0xAF, 0xF9, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x70, 0x9F, 0xEA, 0xAF, 0xF7, 0x00, 0x39, 0xCA, 0x39, 0xD4, 0xD9, 0x3A, 0xCA, 0x4D, 0x4A, 0xD4,
+    0xD9, 0x39, 0xD4, 0x9D, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0x9D, 0x5D, 0x5D, 0x94, 0xAC, 0xA7, 0x30,
+    0x29, 0xCA, 0x4D, 0x4D, 0x93, 0xAC, 0xA3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xCA, 0x3D, 0xA3, 0xD9,
+    0x29, 0xD3, 0xDA, 0x29, 0xD3, 0xD9, 0x2A, 0xCA, 0x2A, 0xD7, 0x20, 0x2A, 0xDA, 0x0A, 0xC9, 0x1F,
+    0xF1, 0xAD, 0xA0, 0xAE, 0x1E, 0x2D, 0xA0, 0x9D, 0xA2, 0xD9, 0x0A, 0xD9, 0x19, 0xD1, 0xAD, 0x2E,
+    0x1A, 0xDA, 0x0A, 0xE1, 0x9F, 0xEA, 0x29, 0xDA, 0x0D, 0x91, 0x29, 0xAE, 0x92, 0xAF, 0xD9, 0x0A,
+    0xDA, 0x1D, 0xA0, 0xDA, 0x19, 0xD9, 0x9F, 0xF0, 0xAF, 0xCA, 0x91, 0xAD, 0x6A, 0xDA, 0x29, 0x2F,
+    0xE3, 0xAE, 0xA9, 0x10, 0x29, 0xEA, 0x3F, 0xE1, 0xAD, 0xA0, 0xAD, 0xA0, 0xE2, 0xDA, 0x9D, 0x92,
+    0xDA, 0xAD, 0x29, 0xDA, 0xAD, 0x2A, 0xD9, 0x9D, 0xA0, 0x9E, 0x1F, 0xE3, 0xAE, 0xA2, 0x2A, 0xD2,
+    0xAD, 0x3A, 0xD9, 0x0A, 0xD9, 0x4E, 0x9D, 0xA5, 0xAF, 0xA6, 0x9E, 0xA7, 0xAE, 0x96, 0xAF, 0xC5,
+    0x9D, 0xA9, 0xD9, 0x39, 0xE1, 0xE3, 0xE2, 0xAD, 0x20, 0x2A, 0xF9, 0x39, 0xFD, 0xA2, 0x99, 0x2E,
+    0x7A, 0xD3, 0xAF, 0xD1, 0x9F, 0xF1, 0xE2, 0xDA, 0x1D, 0xA1, 0xE2, 0xAF, 0xD9, 0x3A, 0xEA, 0x30,
+    0x3A, 0xA9, 0x79, 0xDA, 0x7A, 0xD9, 0x7A, 0xD7, 0x0D, 0xA9, 0xDA, 0x4F, 0xF2, 0x9E, 0x90, 0xE2,
+    0xAD, 0x91, 0xE2, 0xE2, 0xE2, 0xDA, 0x2D, 0xA1, 0x9D, 0x91, 0x9D, 0x91, 0xAD, 0x2A, 0xD2, 0xE2,
+    0xE2, 0xDA, 0x2D, 0xA1, 0x3A, 0xA9, 0x70, 0x9D, 0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0x19, 0xDA,
+    0x3D, 0xA0, 0x9E, 0x39, 0xD9, 0x9E, 0x4A, 0xD9, 0xDA, 0x5F, 0xD6, 0xFD, 0x59, 0xEA, 0xDA, 0x4A,
+    0xD1, 0xE4, 0xE1, 0x9D, 0xA3, 0xDA, 0x2E, 0x20, 0x3A, 0xA9, 0x29, 0xDA, 0x29, 0xD9, 0x2A, 0xD3,
+    0xE3, 0xDA, 0x29, 0xD9, 0x2A, 0xD3, 0xE3, 0xDA, 0x29, 0xD9, 0x2A, 0xD9, 0x2E, 0x3D, 0xA2, 0x2A,
+    0xC0, 0x9D, 0xA1, 0xAD, 0xA3, 0xDA, 0xFA, 0xAF, 0x91, 0x9E, 0x90, 0xF9, 0x9D, 0xA1, 0xAD, 0x91,
+    0xE9, 0x1D, 0xA1, 0xE2, 0xE1, 0x9D, 0xA1, 0xDA, 0x19, 0xDA, 0x19, 0xD9, 0x09, 0xD9, 0x1A, 0xD9,
+    0x1A, 0xD1, 0xAD, 0x2A, 0xD2, 0xE1, 0xE2, 0xE2, 0xDA, 0x1D, 0xA2, 0xD9, 0x19, 0xD9, 0x00, 0x2D,
+    0x09, 0xDA, 0x29, 0xDA, 0xFA, 0x1A, 0xE9, 0x9E, 0x1A, 0xD9, 0x1E, 0x1E, 0x2D, 0xA1, 0xDA, 0x19,
+    0xD9, 0x09, 0xD9, 0x1A, 0xD9, 0x0A, 0xD2, 0xAD, 0x1E, 0x2E, 0x1D, 0xA2, 0xD9, 0x00, 0x3D, 0x0A,
+    0xDA, 0x39, 0xFE, 0x92, 0xAE, 0x09, 0xE2, 0xAD, 0x2E, 0x2D, 0xA2, 0xE2, 0xD9, 0x2D, 0xA1, 0x9D,
+    0x91, 0xAD, 0x91, 0xAE, 0x09, 0xE2, 0xFF, 0x3D, 0xA9, 0xDA, 0x39, 0xD9, 0x7A, 0xD7, 0x0E, 0x70,
+    0xE7, 0x2A, 0xEA, 0x2F, 0xD9, 0x0A, 0xD9, 0x19, 0x1A, 0xDA, 0x5F, 0xA4, 0xAE, 0xA4, 0x9E, 0x09,
+    0x91, 0x9E, 0x0A, 0xFD, 0x90, 0x9F, 0xA2, 0x29, 0xC9, 0x4D, 0x39, 0xFC, 0x99, 0xFD, 0x90, 0x9D,
+    0xA3, 0xAD, 0x93, 0xE4, 0xE4, 0xDA, 0x39, 0xDA, 0x39, 0xFC, 0x2A, 0xE9, 0x10, 0x77, 0x59, 0xFD,
+    0x97, 0xFF, 0xC6, 0xFF, 0xC9, 0x5A, 0xFA, 0x99, 0xAC, 0x59, 0xF9, 0x72, 0xAE, 0xA7, 0x3F, 0x2A,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xF1, 0x9F, 0xF0, 0x9F, 0x1A, 0xFE, 0xA0, 0x9F, 0x1F, 0xF9, 0x09, 0xF1,
+    0xF6, 0xFA, 0x9E, 0xA6, 0xFF, 0xFC, 0xA3, 0xFF, 0xF9, 0x4A, 0xFF, 0xD7, 0x0F, 0x74, 0xEA, 0x73,
+    0x9E, 0xA9, 0x99, 0x97, 0xAF, 0xEA, 0x7F, 0xF9, 0x7F, 0xF3, 0x77, 0x75, 0x9D, 0x1D, 0x73, 0xAC,
+    0x90, 0xAC, 0xA7, 0x09, 0xAF, 0xE9, 0x69, 0xFF, 0xE5, 0xFF, 0xFA, 0x4F, 0xFA, 0xF4, 0xAF, 0xE9,
+    0x09, 0xDA, 0x39, 0xFC, 0x0D, 0x1D, 0x94, 0xFC, 0x09, 0xCA, 0x09, 0xD4, 0x9F, 0x90, 0xD9, 0x0A,
+    0xC9, 0x4A, 0xF0, 0x9D, 0x1D, 0x5F, 0xA0, 0xAC, 0xA0, 0x9C, 0xA5, 0xF9, 0x0D, 0x1D, 0x95, 0xF9,
+    0x9C, 0xA0, 0x9D, 0x6F, 0x9D, 0x90, 0xAC, 0xA6, 0xFE, 0x1D, 0x7A, 0xFC, 0xA0, 0x9C, 0xA7, 0x9F,
+    0xCA, 0x0D, 0xAA, 0xC6, 0xFF, 0xF7, 0xFF, 0xE7, 0x9F, 0xFC, 0xA7, 0xAC, 0xA9, 0xAD, 0x97, 0x2D,
+    0x1D, 0x97, 0x3A, 0xA1, 0xAA, 0x71, 0x77, 0x71, 0xAF, 0xDA, 0x96, 0xAF, 0xFD, 0xA4, 0xFF, 0xF9,
+    0x3F, 0xDA, 0xAA, 0xAE, 0x3A, 0xFC, 0x59, 0x93, 0xFC, 0x73, 0xAF, 0x74, 0xFA, 0x73, 0x9F, 0x2A,
+    0xAA, 0x09, 0xD2, 0xAF, 0x2E, 0x9E, 0x2F, 0xA1, 0x9F, 0xE2, 0xFA, 0x1A, 0xFA, 0xA9, 0x2F, 0x91,
+    0xF6, 0xF9, 0x1E, 0xA6, 0xFA, 0x09, 0xE9, 0x6F, 0xC0, 0xAE, 0x96, 0xAF, 0x9A, 0xE1, 0x95, 0xFF,
+    0xCA, 0xD5, 0xAF, 0xFE, 0x6A, 0xFF, 0xD7, 0x9F, 0xEA, 0x97, 0x29, 0x99, 0x70, 0x49, 0xFF, 0xE5,
+    0xAF, 0xFE, 0x5F, 0xFF, 0x5F, 0xFE, 0x94, 0x9F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x4F,
+    0xA9, 0x99, 0x99, 0x95, 0x9F, 0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x95, 0xF9, 0x74, 0xF7, 0x39,
+    0xAF, 0x99, 0x97, 0xAF, 0xFC, 0x96, 0xFF, 0xD7, 0x99, 0xF9, 0x99, 0x97, 0x1F, 0x74, 0x9F, 0x74,
+    0xAE, 0xA7, 0x30, 0x77, 0x74, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xC9, 0x7F, 0xFD, 0x7A, 0xFA, 0x99,
+    0xAC, 0xA7, 0xFA, 0x74, 0x9F, 0x75, 0xAF, 0x72, 0x9A, 0xAF, 0xCA, 0xAA, 0xA9, 0x5A, 0xFF, 0xE9,
+    0x5F, 0xFF, 0x70, 0x9F, 0x73, 0x99, 0xAF, 0x99, 0x99, 0x6A, 0xFF, 0xEA, 0x5A, 0xFF, 0xE9, 0x79,
+    0xF7, 0x5A, 0xEA, 0x74, 0xAE, 0xA7, 0x39, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xAF, 0xFF, 0xCA,
+    0x3F, 0xFF, 0xD9, 0x3F, 0xFF, 0xD3, 0x77, 0x29, 0x99, 0x77, 0x4E, 0x77, 0x49, 0xD9, 0x77, 0x4E,
+    0x70, 0xE1, 0xAF, 0x90, 0xFE, 0x93, 0x9E, 0x0A, 0xFD, 0xAF, 0xF3, 0xAE, 0xAF, 0xFF, 0xFA, 0x2F,
+    0xD9, 0x9F, 0xE9, 0x9F, 0xC2, 0xFC, 0x29, 0xFC, 0x29, 0xF2, 0xFA, 0x29, 0xF9, 0x29, 0xF1, 0x9F,
+    0x3A, 0xF3, 0xAE, 0xA1, 0xAE, 0xA3, 0xAE, 0xA3, 0xF9, 0x1F, 0x93, 0xF9, 0x3F, 0x91, 0xF3, 0xAF,
+    0x4F, 0x19, 0xF2, 0x9F, 0xC3, 0x9F, 0x1A, 0xF2, 0xFC, 0xA3, 0xAE, 0xA1, 0xAE, 0xA1, 0xAF, 0xC9,
+    0x3F, 0x91, 0xF9, 0x09, 0xFD, 0x93, 0xF2, 0xF1, 0xFE, 0x39, 0xF1, 0x9F, 0x0A, 0xDA, 0xF3, 0x9F,
+    0x69, 0xDA, 0x77, 0x4E, 0x77, 0x4A, 0xD9, 0x77, 0x77, 0x71, 0x4F, 0x93, 0xAD, 0x93, 0x9F, 0xA3,
+    0xE4, 0xAF, 0xA3, 0xE4, 0xFD, 0x29, 0xE4, 0xFD, 0x2A, 0xDA, 0x4E, 0xAD, 0x2E, 0x93, 0x9D, 0xAA,
+    0xD2, 0xE3, 0xAF, 0xEA, 0xAA, 0xEA, 0x90, 0x9F, 0xFF, 0xE9, 0x09, 0xAE, 0xAA, 0xDA, 0xAE, 0xAA,
+    0x3E, 0x09, 0xD9, 0x0E, 0x92, 0x9A, 0xE9, 0xAD, 0xA9, 0xE9, 0x19, 0xFF, 0xFE, 0x90, 0x9F, 0xFF,
+    0xE3, 0xE2, 0xDA, 0xAD, 0x93, 0x9E, 0x2D, 0xAE, 0x4A, 0xDA, 0x2F, 0xD4, 0xAD, 0xA2, 0xFD, 0x4E,
+    0x92, 0xAF, 0xA4, 0xE3, 0xAF, 0x93, 0x9E, 0x3A, 0xF4, 0x4A, 0xFC, 0xA9, 0x77, 0x0F, 0xFC, 0x97,
+    0x6F, 0xFD, 0x97, 0x49, 0xFF, 0xE7, 0x4A, 0xE9, 0x19, 0xF9, 0x73, 0xF3, 0xF9, 0x19, 0x99, 0x6F,
+    0x3F, 0x91, 0xDA, 0x59, 0xF3, 0xF9, 0x0A, 0xD9, 0x5A, 0xEA, 0x2A, 0xF1, 0xE9, 0x5A, 0xE9, 0x1A,
+    0xFA, 0x9F, 0xEA, 0x2F, 0xFF, 0xAF, 0xF9, 0x2F, 0xFE, 0x0A, 0xFF, 0x29, 0xFF, 0xCA, 0x29, 0xE9,
+    0x5A, 0xFA, 0xA9, 0x94, 0xAE, 0x6F, 0x97, 0x0F, 0x6F, 0x71, 0xF6, 0xF7, 0x1E, 0xA5, 0x9E, 0xA7,
+    0x09, 0xEA, 0x5A, 0xE9, 0x70, 0x9F, 0xE2, 0xF7, 0x2F, 0xE2, 0xF7, 0x29, 0xFC, 0xA7, 0x74, 0x94,
+    0x39, 0xFD, 0xA9, 0x77, 0x1A, 0xFF, 0xC7, 0x70, 0xAF, 0xFD, 0x77, 0xFF, 0xE9, 0x76, 0xF2, 0xFA,
+    0x75, 0x9F, 0x2F, 0xA1, 0x9F, 0xD9, 0x3A, 0xEA, 0x2A, 0xEA, 0x0A, 0xFF, 0x3F, 0xA2, 0xFA, 0x9F,
+    0xFA, 0x3F, 0x91, 0xAF, 0x9A, 0xE9, 0x19, 0xC4, 0xFA, 0xAF, 0xD0, 0xF7, 0x09, 0xFF, 0xE1, 0xFA,
+    0x7A, 0xFF, 0xCA, 0x2A, 0xFA, 0x6F, 0xFD, 0x4F, 0xD9, 0x4F, 0x1F, 0x5F, 0xD3, 0x9F, 0x1F, 0x95,
+    0xAF, 0xA2, 0x9F, 0x1A, 0xEA, 0x6A, 0xF2, 0xAE, 0xA1, 0x9E, 0xA6, 0x9E, 0xA2, 0xF9, 0x19, 0xF0,
+    0xAA, 0x3A, 0xEA, 0x2F, 0x3F, 0x0A, 0xFF, 0xC2, 0x9F, 0x3F, 0x9A, 0xFF, 0x92, 0xAE, 0xA3, 0xFA,
+    0x9F, 0xE9, 0x77, 0x59, 0x96, 0x2A, 0xD9, 0x3A, 0xDA, 0x39, 0xDA, 0x2E, 0x93, 0xEA, 0x3E, 0x92,
+    0xE9, 0x2A, 0xEA, 0x3E, 0x3E, 0x3F, 0xA2, 0xAD, 0xA3, 0xE2, 0x9F, 0xA2, 0xE9, 0x3E, 0x2F, 0xCA,
+    0x19, 0xE4, 0xE2, 0xDA, 0xDA, 0x1A, 0xDA, 0x4E, 0x1A, 0xD9, 0xD9, 0x1E, 0x5E, 0x1E, 0x0D, 0x90,
+    0x9E, 0x39, 0xAE, 0xAA, 0xEA, 0xDA, 0xAF, 0xA2, 0xFF, 0xFF, 0xF2, 0xAF, 0xAE, 0xAF, 0xFA, 0xA3,
+    0x9D, 0xA9, 0xD9, 0x0A, 0xD0, 0xE9, 0x59, 0xD9, 0xAD, 0x1A, 0xD0, 0xE6, 0xAD, 0x9D, 0xA1, 0xAD,
+    0x9D, 0xA6, 0xAD, 0xAD, 0x91, 0xAD, 0xAD, 0x7A, 0xFC, 0x2A, 0xFC, 0x7A, 0xFA, 0x2A, 0xF9, 0x7A,
+    0xF3, 0xAF, 0x70, 0xFA, 0x3A, 0xF7, 0x0F, 0x93, 0xF9, 0x60, 0x4A, 0xFF, 0xA5, 0x9E, 0x5F, 0xFE,
+    0xA3, 0xAE, 0x5F, 0xFF, 0x92, 0xF4, 0x9E, 0xA9, 0x99, 0x9A, 0xF2, 0xEA, 0x4A, 0xE5, 0xAE, 0x90,
+    0x9E, 0x94, 0xAE, 0x1A, 0xAA, 0x1E, 0x90, 0x9E, 0x5E, 0xA0, 0xAE, 0x1E, 0x90, 0xAE, 0x5E, 0x90,
+    0xAE, 0x09, 0xE9, 0x0E, 0xA4, 0x9E, 0x90, 0xEA, 0x0A, 0xE1, 0xEA, 0x4A, 0xE1, 0xEA, 0x0A, 0xE0,
+    0x9E, 0x94, 0xF0, 0x9E, 0x90, 0xEA, 0x0A, 0xE5, 0xEA, 0x0A, 0xE1, 0xEA, 0x0A, 0xE5, 0xE9, 0x0F,
+    0x09, 0xE9, 0x0E, 0xA4, 0x9E, 0x1E, 0xA0, 0xAE, 0x1E, 0x94, 0xAE, 0x1E, 0x90, 0xF0, 0x9E, 0x5F,
+    0x09, 0xE1, 0xAA, 0xA9, 0x0F, 0x5E, 0xA0, 0xAE, 0x5A, 0xE9, 0x49, 0xE9, 0x0F, 0x39, 0xAF, 0x5A,
+    0xE1, 0xFF, 0xFC, 0x95, 0xAE, 0x09, 0xFF, 0xF9, 0x6E, 0xA0, 0xAF, 0xFC, 0xA9, 0x70, 0x77, 0x77,
+    0x09, 0xF7, 0x6A, 0xF7, 0x2F, 0xFD, 0xA7, 0x0F, 0xFD, 0xA7, 0x9F, 0xFD, 0x97, 0x39, 0xF7, 0x19,
+    0x99, 0x19, 0xEA, 0x7A, 0xFC, 0x0A, 0xEA, 0x6A, 0xFF, 0xE9, 0x5A, 0xFF, 0xF6, 0xFC, 0x90, 0x9F,
+    0xC5, 0xAF, 0x3F, 0xA5, 0xF9, 0x3A, 0xE9, 0x49, 0xF4, 0xAE, 0x5A, 0xF4, 0xF5, 0xAE, 0xA4, 0xF5,
+    0xAE, 0xA3, 0xAE, 0xA5, 0xAF, 0x3F, 0x95, 0xAF, 0xA0, 0x9F, 0xC7, 0xFF, 0xF7, 0xAF, 0xDA, 0xAE,
+    0x70, 0xAF, 0xA0, 0xAD, 0xA7, 0x29, 0x97, 0x77, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0xAF,
+    0xFE, 0x79, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x77, 0x72, 0x9F, 0xD9, 0x70, 0xFF, 0xCA, 0x6F,
+    0xFD, 0x6F, 0xCA, 0x99, 0xDA, 0x5A, 0xF9, 0x39, 0x6F, 0x97, 0x3A, 0xF7, 0x2A, 0xAF, 0xCA, 0xAA,
+    0xA6, 0xFF, 0xE5, 0x9F, 0xFE, 0x7F, 0xA7, 0x29, 0x9F, 0xA9, 0x99, 0x7F, 0xFD, 0x95, 0x9F, 0xFD,
+    0x70, 0x9F, 0x75, 0xF7, 0x5F, 0xA7, 0x4F, 0xCA, 0x99, 0xAD, 0x69, 0xFF, 0xD7, 0xAF, 0xFC, 0x70,
+    0x9F, 0xE9, 0x73, 0x99, 0x70, 0x4F, 0x93, 0xAF, 0x94, 0xF3, 0x9F, 0xA4, 0x9F, 0x3F, 0xC5, 0xAF,
+    0x2F, 0xC6, 0xFA, 0x1A, 0xF9, 0x6F, 0x91, 0xFA, 0x7F, 0x1F, 0xC7, 0x9F, 0x0A, 0xF7, 0x0A, 0xEA,
+    0x9F, 0x7A, 0xAF, 0xFD, 0xAA, 0xA4, 0xFF, 0xFE, 0x39, 0xFF, 0xFD, 0xA5, 0xAF, 0xFD, 0x70, 0xAF,
+    0x09, 0xF7, 0x0F, 0x91, 0xF9, 0x7F, 0x91, 0xFA, 0x69, 0xF2, 0xAF, 0x69, 0xF2, 0x9F, 0x95, 0xAE,
+    0xA3, 0xFA, 0x5F, 0x93, 0xFC, 0x5F, 0x4A, 0xF4, 0x1A, 0xFF, 0xFC, 0x91, 0xFF, 0xFD, 0x90, 0x9F,
+    0xFF, 0xD1, 0x9F, 0xFF, 0xCA, 0x6A, 0xEA, 0x73, 0xF9, 0x9C, 0x71, 0xFE, 0xA7, 0x9F, 0xD9, 0x70,
+    0xAF, 0xA7, 0x2F, 0xA7, 0x19, 0xFC, 0x90, 0xA6, 0xAF, 0xDA, 0xDA, 0x4A, 0xFF, 0xCA, 0x6A, 0x0A,
+    0xFC, 0x97, 0x1F, 0xA7, 0x2A, 0xF9, 0x70, 0x9F, 0xD7, 0x0A, 0xFE, 0x71, 0xC0, 0xAE, 0xA7, 0x3F,
+    0x97, 0x3F, 0x71, 0x77, 0x76, 0xAF, 0xEA, 0x97, 0x70, 0x9F, 0xFF, 0x97, 0x7F, 0xFF, 0xCA, 0x76,
+    0x9D, 0xA9, 0x99, 0xAF, 0xDA, 0x77, 0x69, 0xFC, 0x97, 0x7F, 0x3F, 0xA7, 0x7F, 0x3A, 0xF7, 0x69,
+    0xF4, 0xF7, 0x6A, 0xEA, 0x4F, 0x97, 0x5F, 0x94, 0xF9, 0x75, 0xF5, 0xF7, 0x59, 0xF4, 0x9F, 0x29,
+    0xAE, 0xA9, 0x39, 0xEA, 0x4A, 0xF1, 0xAF, 0xE9, 0x2A, 0xEA, 0x4F, 0xA0, 0xAF, 0xAF, 0x2F, 0x93,
+    0xAF, 0x1F, 0x2E, 0x91, 0xF3, 0x9F, 0xA0, 0x9E, 0x3E, 0xA0, 0x9F, 0x2A, 0xFC, 0x1A, 0xE3, 0xEA,
+    0x0A, 0xFA, 0xAF, 0xD9, 0x1F, 0x29, 0xE9, 0x0F, 0xFF, 0x92, 0xFA, 0x99, 0xF1, 0xFF, 0xDA, 0x39,
+    0xFF, 0xD9, 0x1F, 0xEA, 0x95, 0xAE, 0xAF, 0xC9, 0x77, 0x1A, 0xE1, 0x99, 0x77, 0x4E, 0xA7, 0x77,
+    0x0E, 0xA7, 0x77, 0x9E, 0x97, 0x77, 0xAE, 0x77, 0x70, 0xF7, 0x77, 0x0E, 0xA7, 0x10, 0x77, 0x76,
+    0x9F, 0xC9, 0x73, 0xAF, 0xE9, 0x71, 0x9F, 0xFC, 0x71, 0xFC, 0x0A, 0xE7, 0x09, 0xF1, 0x9E, 0x70,
+    0x9F, 0x19, 0xE7, 0x0A, 0xF1, 0xF7, 0x0A, 0xF1, 0xEA, 0x70, 0x9F, 0x0A, 0xE7, 0x19, 0xFA, 0xE9,
+    0x72, 0xFE, 0xA7, 0x3F, 0xE7, 0x49, 0xFC, 0x72, 0xA2, 0xFA, 0x71, 0xD1, 0x9F, 0xC7, 0x0A, 0xD9,
+    0x0F, 0xD7, 0x9E, 0xAF, 0xE9, 0x6F, 0xE9, 0xFA, 0x5E, 0xAE, 0xA0, 0xAE, 0xA4, 0xAD, 0x90, 0xDA,
+    0x1A, 0xF3, 0x9D, 0xA1, 0xAC, 0x29, 0xF7, 0x19, 0x39, 0xF7, 0x6A, 0xF7, 0x6F, 0xA7, 0x39, 0x9A,
+    0xF9, 0x73, 0xFE, 0x74, 0xFD, 0x75, 0xFA, 0x60, 0x39, 0xFD, 0xA9, 0x70, 0xAF, 0xFC, 0x96, 0xFF,
+    0xE6, 0xFA, 0xAF, 0xCA, 0x49, 0xF2, 0xAF, 0x3F, 0xFF, 0xE9, 0x09, 0xFF, 0xFE, 0x92, 0xF3, 0x9E,
+    0xA2, 0x99, 0xF9, 0x99, 0x9F, 0xA9, 0x1F, 0xFF, 0xEA, 0x1A, 0xFC, 0xAA, 0xAF, 0xCA, 0x92, 0xF9,
+    0x09, 0xFC, 0x94, 0xFF, 0xEA, 0x49, 0xFF, 0xD9, 0x59, 0xFF, 0xA7, 0xAE, 0xA9, 0x97, 0x2F, 0x97,
+    0x4F, 0x74, 0x9F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x40, 0x73, 0x99, 0x77, 0xE7, 0x49, 0xFE, 0xA9,
+    0x6A, 0xFF, 0xEA, 0x4F, 0xFF, 0xC9, 0x3F, 0xFC, 0xAF, 0x3F, 0xD9, 0xDA, 0x29, 0x92, 0x9F, 0xC1,
+    0xDA, 0x7F, 0xC2, 0xD9, 0x69, 0xFA, 0x19, 0xD7, 0xAF, 0x2A, 0xD7, 0xFA, 0x2E, 0xAA, 0xAA, 0xAA,
+    0x1F, 0x92, 0xFF, 0xC0, 0x9F, 0x91, 0x9F, 0xFA, 0x09, 0xF2, 0xAF, 0xF9, 0x09, 0xF2, 0xAD, 0x1F,
+    0x19, 0xF9, 0x1D, 0xA0, 0x9F, 0x2F, 0xA1, 0xD9, 0x0A, 0xEA, 0x2F, 0xC9, 0x9D, 0x1F, 0xA2, 0x9F,
+    0xF9, 0xAF, 0x93, 0xFF, 0xFD, 0x5F, 0xFF, 0xC6, 0x9F, 0xFC, 0xA7, 0x19, 0xD9, 0x76, 0xAD, 0x77,
+    0x74, 0x71, 0x9F, 0xA7, 0x6F, 0xD7, 0x59, 0xFD, 0x75, 0xFE, 0x74, 0x9F, 0xE7, 0x4F, 0xAE, 0x97,
+    0x29, 0xEA, 0x9E, 0x97, 0x2F, 0x99, 0xE9, 0x6F, 0xFF, 0xFC, 0x29, 0xFF, 0xFF, 0xC5, 0xAF, 0x19,
+    0xF7, 0x0F, 0x92, 0xF5, 0xAF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC3, 0x9A, 0xF9, 0x99, 0x99, 0xF9, 0x94,
+    0xF9, 0x4F, 0x59, 0xF5, 0xF9, 0x4F, 0x95, 0xAE, 0x93, 0x9F, 0x6A, 0xEA, 0x3F, 0xA6, 0xAE, 0xA2,
+    0xAF, 0x79, 0xEA, 0x20, 0x77, 0x7A, 0xFD, 0x97, 0xAF, 0xFC, 0xA6, 0x9F, 0xFD, 0xA6, 0xEA, 0xAA,
+    0xFC, 0x69, 0x94, 0xF7, 0x5F, 0x74, 0x9F, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x1F, 0xFF,
+    0xF1, 0x9A, 0xAA, 0xFF, 0xCA, 0xA9, 0x4F, 0xFC, 0x59, 0x9F, 0xFA, 0x99, 0x99, 0x1A, 0xFF, 0xFE,
+    0x1A, 0xFF, 0xFD, 0xA2, 0xAE, 0xA7, 0x4F, 0x97, 0x4F, 0xA5, 0x99, 0x4A, 0xFA, 0x99, 0x9A, 0xDA,
+    0x5F, 0xFE, 0xA5, 0x9F, 0xFD, 0xA6, 0x9F, 0xF9, 0x73, 0x99, 0x70, 0x77, 0x75, 0xAD, 0x74, 0xAF,
+    0xDA, 0x97, 0xAF, 0xFE, 0x5F, 0xFF, 0x94, 0xFF, 0xCA, 0xE4, 0xFC, 0xA0, 0xAD, 0x19, 0x93, 0x9F,
+    0xA1, 0xDA, 0x7F, 0xC2, 0xD9, 0x69, 0xF9, 0x19, 0xD7, 0xAF, 0x2A, 0xD7, 0xFA, 0x2E, 0x7F, 0x92,
+    0xDA, 0x7F, 0x92, 0xD9, 0x7F, 0x29, 0xD7, 0x0F, 0x2A, 0xD7, 0x0F, 0x91, 0xDA, 0x70, 0xFA, 0x1D,
+    0xA7, 0x0F, 0xC9, 0x0D, 0x91, 0x95, 0x9F, 0xFA, 0xAD, 0x6F, 0xFF, 0x7F, 0xFE, 0x70, 0x9F, 0xEA,
+    0x97, 0x29, 0xD9, 0x76, 0xAD, 0x77, 0x09, 0x97, 0x10, 0x69, 0x94, 0x99, 0x97, 0x1E, 0x39, 0xE7,
+    0x0A, 0xE3, 0xEA, 0x70, 0xEA, 0x29, 0xE9, 0x6A, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0xD1, 0x9F, 0xFF,
+    0xFD, 0x29, 0xAF, 0x99, 0x9F, 0xA9, 0x99, 0x4A, 0xEA, 0x2F, 0x97, 0xF9, 0x2F, 0x70, 0xF2, 0x9F,
+    0x79, 0xF2, 0xAE, 0xA7, 0xAE, 0xA2, 0xF9, 0x7F, 0x92, 0xF7, 0x0F, 0x91, 0x9F, 0x70, 0xF2, 0x9F,
+    0x79, 0xF2, 0xAF, 0x90, 0x94, 0xAE, 0xA2, 0x9F, 0xE9, 0x3F, 0x93, 0xFE, 0x93, 0xF4, 0x9F, 0xD7,
+    0x70, 0x99, 0x50, 0x77, 0x77, 0x1A, 0xFD, 0xA7, 0x39, 0xFF, 0xD7, 0x2F, 0xFE, 0x71, 0xFD, 0xAA,
+    0xE9, 0x71, 0xFA, 0x49, 0x71, 0x9F, 0x77, 0x09, 0xF7, 0x70, 0x9F, 0xA7, 0x70, 0xFC, 0xA7, 0x79,
+    0xFD, 0x77, 0xAF, 0xD9, 0x76, 0x9F, 0xD7, 0x70, 0xFC, 0xA7, 0x70, 0xFC, 0x39, 0xAA, 0x90, 0x9A,
+    0xA1, 0xAA, 0x90, 0xF2, 0x9F, 0x9E, 0xAF, 0x0F, 0x2A, 0xC0, 0xE9, 0xEA, 0xAD, 0x0F, 0x2A, 0xCA,
+    0xDA, 0x0A, 0xD0, 0x9D, 0xAE, 0x93, 0xFA, 0x9D, 0xA0, 0x9F, 0xD4, 0x9F, 0xFF, 0xDA, 0x6A, 0xFF,
+    0xF9, 0x7D, 0x90, 0xAD, 0x99, 0xD9, 0x71, 0xD9, 0x0A, 0xCA, 0x09, 0xD7, 0x29, 0x92, 0x92, 0x99,
+    0x70, 0x1A, 0xFF, 0xFC, 0x2F, 0xFF, 0xD1, 0x9F, 0xFF, 0xD1, 0x9F, 0xFF, 0xCA, 0x77, 0x77, 0x3F,
+    0xFF, 0xD1, 0x9F, 0xFF, 0xD1, 0xAF, 0xFF, 0xCA, 0x19, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x7F, 0x97,
+    0x29, 0xF7, 0x3A, 0xF7, 0x3F, 0xA7, 0x3F, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0x73, 0xFA, 0x73,
+    0xF9, 0x73, 0xF7, 0x10, 0x1A, 0xFF, 0xE9, 0x1F, 0xFF, 0x91, 0xFF, 0x99, 0x99, 0x49, 0xAF, 0x97,
+    0x1F, 0xA4, 0xAF, 0xFE, 0x91, 0xFF, 0xF9, 0x19, 0x99, 0x99, 0xFA, 0x99, 0x69, 0xF9, 0x39, 0xAA,
+    0xAF, 0xCA, 0x4A, 0xFE, 0xA5, 0xFD, 0xA9, 0x6F, 0xA7, 0x19, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x2F,
+    0x97, 0x1A, 0xF7, 0x2F, 0x97, 0x1A, 0xF7, 0x2F, 0x95, 0x4A, 0xE9, 0x72, 0xF7, 0x3F, 0x39, 0x59,
+    0xF9, 0xAD, 0xA5, 0xAF, 0xFA, 0x39, 0xAF, 0xEA, 0x93, 0x9F, 0xD9, 0x7A, 0xFD, 0x19, 0xAA, 0x59,
+    0xFF, 0xA5, 0xAF, 0xF9, 0x3F, 0xEA, 0x95, 0x9F, 0xD7, 0x0A, 0xA9, 0xF4, 0xEA, 0x19, 0xEA, 0x3A,
+    0xEA, 0x1A, 0xE9, 0x3F, 0x2F, 0x92, 0xAF, 0x2F, 0x2A, 0xF9, 0x19, 0xF9, 0xAF, 0xCA, 0x2A, 0xFF,
+    0xDA, 0x3F, 0xFD, 0x94, 0xFF, 0xA7, 0x09, 0x99, 0x71, 0x77, 0x5F, 0x75, 0xFD, 0x73, 0xAD, 0x1D,
+    0x97, 0x2D, 0xA1, 0xD9, 0x72, 0xE1, 0xD9, 0x72, 0xFF, 0xFE, 0x92, 0xAF, 0xFF, 0xEA, 0x2F, 0xFF,
+    0xF9, 0x2A, 0xFF, 0xFD, 0xA4, 0xD9, 0x7D, 0xA3, 0x9D, 0x1A, 0x90, 0x92, 0xAC, 0xA3, 0x9D, 0x0E,
+    0x9C, 0xA1, 0xAC, 0x93, 0xAF, 0xFC, 0x99, 0xD4, 0xFA, 0xAD, 0xAF, 0xA4, 0xE9, 0x1C, 0x19, 0xCA,
+    0x94, 0xF7, 0x49, 0xFC, 0x97, 0x4C, 0xAA, 0xFA, 0xAA, 0xC9, 0x71, 0xFF, 0x72, 0xAF, 0xE7, 0x39,
+    0xFC, 0xA7, 0x77, 0x00, 0x74, 0x9E, 0x97, 0x72, 0xAE, 0x97, 0x72, 0xF7, 0x73, 0xF7, 0x72, 0x9E,
+    0xA7, 0x72, 0xAE, 0x97, 0x69, 0xAF, 0xFA, 0x97, 0x1A, 0xFF, 0xFD, 0x7F, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xFD, 0xA3, 0x9F, 0xA1, 0xAE, 0x91, 0xFC, 0x3F, 0xA2, 0xF2, 0x9F, 0x29, 0xF3, 0xF3, 0xF2, 0xAE,
+    0xA2, 0x9F, 0x3F, 0x2F, 0x92, 0xAE, 0xA2, 0x9F, 0x2F, 0x3A, 0xE9, 0x2A, 0xEA, 0x2F, 0x39, 0x99,
+    0x93, 0xAE, 0xA1, 0x9F, 0x73, 0xF9, 0x1A, 0xEA, 0x73, 0xF2, 0xF9, 0x72, 0x9F, 0x2F, 0x73, 0xAE,
+    0xA1, 0x5A, 0xFE, 0xA9, 0x70, 0xFF, 0xDA, 0x7F, 0xFE, 0xA6, 0xFF, 0xF5, 0x9F, 0x2A, 0xF9, 0x4A,
+    0xEA, 0x3F, 0x94, 0xF9, 0x3F, 0x94, 0xF3, 0x9F, 0x49, 0xF3, 0xFC, 0x39, 0xAF, 0x99, 0xAF, 0xC9,
+    0x2A, 0xFF, 0xFC, 0xA3, 0xFF, 0xFC, 0xA4, 0xFF, 0xEA, 0x95, 0x9A, 0xF9, 0x99, 0x72, 0xAE, 0xA7,
+    0x39, 0xAF, 0xCA, 0xAA, 0x70, 0xFF, 0xD7, 0x0F, 0xFD, 0x70, 0x9A, 0xF9, 0x99, 0x72, 0xAE, 0xA7,
+    0x5F, 0x97, 0x30, 0x73, 0xAC, 0x19, 0xC9, 0x74, 0xD1, 0xD7, 0x5D, 0x1D, 0x73, 0x9A, 0xFD, 0x97,
+    0x0A, 0xFF, 0xE6, 0xFF, 0xFA, 0x49, 0xFF, 0xFC, 0xA4, 0xFE, 0xA1, 0xD9, 0xA9, 0x3A, 0xFA, 0x9C,
+    0xA0, 0x9C, 0xA6, 0xFC, 0x0A, 0xC9, 0x09, 0xC9, 0x5A, 0xF1, 0xD1, 0xAC, 0x95, 0xFC, 0x1D, 0x1D,
+    0x6F, 0xA7, 0x6F, 0x97, 0x6F, 0x97, 0x6F, 0x97, 0x6A, 0xF7, 0x7F, 0x77, 0xAF, 0x77, 0xAF, 0x97,
+    0x19, 0xAA, 0xAA, 0xFF, 0xAA, 0xA3, 0xFF, 0xFE, 0xA3, 0xFF, 0xFE, 0x92, 0x9F, 0xFF, 0xE3, 0x7A,
+    0xC1, 0xAC, 0x72, 0xD1, 0xD7, 0x2D, 0x1C, 0xA7, 0xFF, 0xA7, 0xFF, 0xCA, 0x59, 0xFF, 0xDA, 0x4A,
+    0xFF, 0xE4, 0xF9, 0x1A, 0xF4, 0xF2, 0x9F, 0x4F, 0x29, 0xF3, 0x9E, 0xA2, 0xFA, 0x3A, 0xFA, 0xAF,
+    0xC4, 0xFF, 0xDA, 0x5F, 0xFC, 0xA6, 0xFF, 0xE4, 0x9E, 0xA1, 0x9F, 0x93, 0xAE, 0x92, 0xFA, 0x3F,
+    0x3F, 0xA3, 0xF3, 0xFA, 0x29, 0xF2, 0xAF, 0x92, 0x9F, 0xAA, 0xFD, 0x3A, 0xFF, 0xE9, 0x3F, 0xFE,
+    0x94, 0xFF, 0xC9, 0x70, 0xD1, 0xD7, 0x2D, 0x1D, 0x72, 0xCA, 0x1C, 0xA7, 0x0A, 0xAA, 0xAA, 0xAA,
+    0x90, 0xFE, 0xA0, 0xFE, 0x99, 0xFE, 0x00, 0x77, 0x77, 0x7C, 0x97, 0x77, 0xE9, 0x77, 0x5F, 0xC9,
+    0x77, 0x3F, 0xE9, 0x77, 0x1F, 0xFC, 0x97, 0x7E, 0xAA, 0x99, 0xAE, 0x97, 0x5D, 0x96, 0xE9, 0x73,
+    0xE7, 0x0E, 0x97, 0x1F, 0xA0, 0x9A, 0xCA, 0x2A, 0xE9, 0x7F, 0xFE, 0x29, 0xF9, 0x5F, 0xFF, 0x2A,
+    0xFC, 0x93, 0xFF, 0xF9, 0x2F, 0xE9, 0x1F, 0xFF, 0x92, 0xAF, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0xFC,
+    0xA0, 0x9F, 0xFC, 0xA2, 0xFF, 0xDA, 0x29, 0xFF, 0xA1, 0x9F, 0xFC, 0xA4, 0x9F, 0xEA, 0x1A, 0xFF,
+    0xA6, 0x9F, 0xFF, 0xFC, 0xA7, 0x09, 0xFF, 0xFE, 0xA7, 0x29, 0xF9, 0x19, 0xFC, 0xA7, 0x49, 0xE3,
+    0xFA, 0x76, 0x9D, 0x92, 0xEA, 0x77, 0x09, 0xD9, 0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x49, 0xEA,
+    0x77, 0x69, 0xCA, 0x77, 0x70, 0x97, 0x40,
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 10, 22, 11, 0, 21, 55, 0 }, // !
-    { 12, 8, 15, 2, 21, 24, 55 }, // "
-    { 19, 21, 20, 0, 21, 100, 79 }, // #
-    { 16, 25, 17, 0, 23, 100, 179 }, // $
-    { 23, 23, 25, 1, 22, 133, 279 }, // %
-    { 21, 23, 22, 0, 22, 121, 412 }, // &
-    { 6, 8, 9, 2, 21, 12, 533 }, // '
-    { 11, 26, 13, 1, 21, 72, 545 }, // (
-    { 12, 27, 10, -3, 22, 81, 617 }, // )
-    { 15, 15, 18, 2, 23, 57, 698 }, // *
-    { 15, 15, 17, 1, 18, 57, 755 }, // +
-    { 8, 8, 8, -2, 4, 16, 812 }, // ,
-    { 9, 4, 10, 0, 10, 9, 828 }, // -
-    { 6, 6, 8, 0, 5, 9, 837 }, // .
-    { 17, 22, 16, -2, 21, 94, 846 }, // /
-    { 16, 23, 17, 0, 22, 92, 940 }, // 0
-    { 13, 21, 16, 2, 21, 69, 1032 }, // 1
-    { 17, 22, 17, -1, 22, 94, 1101 }, // 2
-    { 16, 23, 17, 0, 22, 92, 1195 }, // 3
-    { 17, 21, 17, -1, 21, 90, 1287 }, // 4
-    { 17, 22, 18, 0, 21, 94, 1377 }, // 5
-    { 16, 23, 18, 1, 22, 92, 1471 }, // 6
-    { 17, 21, 19, 1, 21, 90, 1563 }, // 7
-    { 17, 23, 18, 0, 22, 98, 1653 }, // 8
-    { 15, 23, 17, 1, 22, 87, 1751 }, // 9
-    { 8, 18, 9, 0, 17, 36, 1838 }, // :
-    { 10, 21, 9, -2, 17, 53, 1874 }, // ;
-    { 15, 17, 17, 1, 19, 64, 1927 }, // <
-    { 15, 10, 17, 1, 15, 38, 1991 }, // =
-    { 15, 17, 17, 1, 19, 64, 2029 }, // >
-    { 13, 23, 16, 2, 22, 75, 2093 }, // ?
-    { 24, 24, 26, 1, 21, 144, 2168 }, // @
-    { 19, 21, 18, -2, 21, 100, 2312 }, // A
-    { 18, 21, 19, 0, 21, 95, 2412 }, // B
-    { 19, 23, 21, 1, 22, 110, 2507 }, // C
-    { 19, 21, 20, 0, 21, 100, 2617 }, // D
-    { 17, 21, 18, 0, 21, 90, 2717 }, // E
-    { 17, 21, 18, 0, 21, 90, 2807 }, // F
-    { 19, 23, 21, 1, 22, 110, 2897 }, // G
-    { 21, 21, 22, 0, 21, 111, 3007 }, // H
-    { 14, 21, 14, -1, 21, 74, 3118 }, // I
-    { 15, 28, 11, -5, 21, 105, 3192 }, // J
-    { 21, 21, 22, 0, 21, 111, 3297 }, // K
-    { 14, 21, 15, 0, 21, 74, 3408 }, // L
-    { 26, 21, 27, 0, 21, 137, 3482 }, // M
-    { 23, 21, 24, 0, 21, 121, 3619 }, // N
-    { 20, 23, 22, 1, 22, 115, 3740 }, // O
-    { 18, 21, 19, 0, 21, 95, 3855 }, // P
-    { 20, 27, 22, 1, 22, 135, 3950 }, // Q
-    { 18, 21, 19, 0, 21, 95, 4085 }, // R
-    { 16, 23, 17, 0, 22, 92, 4180 }, // S
-    { 16, 21, 19, 2, 21, 84, 4272 }, // T
-    { 20, 22, 22, 1, 21, 110, 4356 }, // U
-    { 18, 21, 21, 2, 21, 95, 4466 }, // V
-    { 27, 21, 30, 2, 21, 142, 4561 }, // W
-    { 23, 21, 22, -2, 21, 121, 4703 }, // X
-    { 18, 21, 21, 2, 21, 95, 4824 }, // Y
-    { 19, 21, 19, -1, 21, 100, 4919 }, // Z
-    { 13, 26, 13, -1, 21, 85, 5019 }, // [
-    { 8, 22, 12, 3, 21, 44, 5104 }, // <backslash>
-    { 13, 26, 12, -2, 21, 85, 5148 }, // ]
-    { 16, 14, 17, 0, 21, 56, 5233 }, // ^
-    { 13, 3, 12, -3, -2, 10, 5289 }, // _
-    { 7, 6, 12, 4, 23, 11, 5299 }, // `
-    { 16, 18, 18, 1, 17, 72, 5310 }, // a
-    { 17, 24, 18, 0, 23, 102, 5382 }, // b
-    { 14, 18, 16, 1, 17, 63, 5484 }, // c
-    { 18, 24, 20, 1, 23, 108, 5547 }, // d
-    { 15, 18, 17, 1, 17, 68, 5655 }, // e
-    { 19, 30, 16, -4, 23, 143, 5723 }, // f
-    { 17, 24, 18, 0, 17, 102, 5866 }, // g
-    { 17, 23, 18, 0, 23, 98, 5968 }, // h
-    { 10, 23, 11, 0, 23, 58, 6066 }, // i
-    { 14, 30, 11, -4, 23, 105, 6124 }, // j
-    { 18, 23, 19, 0, 23, 104, 6229 }, // k
-    { 10, 23, 11, 0, 23, 58, 6333 }, // l
-    { 25, 17, 26, 0, 17, 107, 6391 }, // m
-    { 17, 17, 18, 0, 17, 73, 6498 }, // n
-    { 15, 18, 17, 1, 17, 68, 6571 }, // o
-    { 18, 24, 18, -1, 17, 108, 6639 }, // p
-    { 16, 24, 18, 1, 17, 96, 6747 }, // q
-    { 14, 17, 15, 0, 17, 60, 6843 }, // r
-    { 14, 18, 15, 0, 17, 63, 6903 }, // s
-    { 12, 21, 14, 1, 20, 63, 6966 }, // t
-    { 17, 17, 19, 1, 16, 73, 7029 }, // u
-    { 16, 16, 18, 1, 16, 64, 7102 }, // v
-    { 24, 16, 26, 1, 16, 96, 7166 }, // w
-    { 19, 16, 18, -2, 16, 76, 7262 }, // x
-    { 20, 23, 18, -3, 16, 115, 7338 }, // y
-    { 15, 16, 15, -1, 16, 60, 7453 }, // z
-    { 14, 26, 14, -1, 21, 91, 7513 }, // {
-    { 4, 30, 16, 6, 23, 30, 7604 }, // |
-    { 13, 26, 12, -2, 21, 85, 7634 }, // }
-    { 15, 6, 17, 1, 13, 23, 7719 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7742 }, //  
-    { 10, 22, 9, -2, 16, 55, 7742 }, // ¡
-    { 14, 23, 17, 2, 22, 81, 7797 }, // ¢
-    { 19, 22, 19, -1, 22, 105, 7878 }, // £
-    { 15, 14, 17, 1, 17, 53, 7983 }, // ¤
-    { 18, 21, 20, 1, 21, 95, 8036 }, // ¥
-    { 4, 30, 16, 6, 23, 30, 8131 }, // ¦
-    { 15, 24, 16, 0, 23, 90, 8161 }, // §
-    { 11, 4, 17, 5, 22, 11, 8251 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 8262 }, // ©
-    { 11, 12, 14, 2, 22, 33, 8389 }, // ª
-    { 16, 14, 18, 1, 15, 56, 8422 }, // «
-    { 15, 9, 17, 1, 12, 34, 8478 }, // ¬
-    { 9, 4, 10, 0, 10, 9, 8512 }, // ­
-    { 22, 23, 24, 1, 22, 127, 8521 }, // ®
-    { 15, 4, 18, 2, 26, 15, 8648 }, // ¯
-    { 11, 11, 13, 1, 22, 31, 8663 }, // °
-    { 15, 19, 17, 1, 19, 72, 8694 }, // ±
-    { 12, 13, 14, 1, 25, 39, 8766 }, // ²
-    { 11, 14, 14, 2, 25, 39, 8805 }, // ³
-    { 9, 6, 13, 3, 23, 14, 8844 }, // ´
-    { 19, 23, 19, -1, 16, 110, 8858 }, // µ
-    { 16, 27, 19, 2, 23, 108, 8968 }, // ¶
-    { 7, 6, 9, 1, 13, 11, 9076 }, // ·
-    { 7, 7, 6, -3, 0, 13, 9087 }, // ¸
-    { 10, 13, 13, 2, 25, 33, 9100 }, // ¹
-    { 10, 11, 13, 2, 21, 28, 9133 }, // º
-    { 16, 14, 17, 0, 15, 56, 9161 }, // »
-    { 22, 21, 25, 2, 21, 116, 9217 }, // ¼
-    { 23, 21, 26, 2, 21, 121, 9333 }, // ½
-    { 24, 21, 26, 1, 21, 126, 9454 }, // ¾
-    { 13, 23, 14, -1, 17, 75, 9580 }, // ¿
-    { 19, 28, 18, -2, 28, 133, 9655 }, // À
-    { 20, 28, 19, -2, 28, 140, 9788 }, // Á
-    { 20, 28, 19, -2, 28, 140, 9928 }, // Â
-    { 21, 28, 20, -2, 28, 147, 10068 }, // Ã
-    { 20, 27, 19, -2, 27, 135, 10215 }, // Ä
-    { 19, 30, 18, -2, 30, 143, 10350 }, // Å
-    { 30, 21, 29, -2, 21, 158, 10493 }, // Æ
-    { 19, 29, 21, 1, 22, 138, 10651 }, // Ç
-    { 17, 28, 18, 0, 28, 119, 10789 }, // È
-    { 17, 28, 18, 0, 28, 119, 10908 }, // É
-    { 17, 28, 18, 0, 28, 119, 11027 }, // Ê
-    { 17, 27, 18, 0, 27, 115, 11146 }, // Ë
-    { 14, 28, 14, -1, 28, 98, 11261 }, // Ì
-    { 16, 28, 16, -1, 28, 112, 11359 }, // Í
-    { 16, 28, 16, -1, 28, 112, 11471 }, // Î
-    { 15, 27, 15, -1, 27, 102, 11583 }, // Ï
-    { 19, 21, 20, 0, 21, 100, 11685 }, // Ð
-    { 23, 28, 24, 0, 28, 161, 11785 }, // Ñ
-    { 20, 29, 22, 1, 28, 145, 11946 }, // Ò
-    { 20, 29, 22, 1, 28, 145, 12091 }, // Ó
-    { 20, 29, 22, 1, 28, 145, 12236 }, // Ô
-    { 20, 29, 22, 1, 28, 145, 12381 }, // Õ
-    { 20, 28, 22, 1, 27, 140, 12526 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 12666 }, // ×
-    { 20, 24, 22, 1, 22, 120, 12715 }, // Ø
-    { 20, 29, 22, 1, 28, 145, 12835 }, // Ù
-    { 20, 29, 22, 1, 28, 145, 12980 }, // Ú
-    { 20, 29, 22, 1, 28, 145, 13125 }, // Û
-    { 20, 28, 22, 1, 27, 140, 13270 }, // Ü
-    { 18, 28, 21, 2, 28, 126, 13410 }, // Ý
-    { 17, 21, 18, 0, 21, 90, 13536 }, // Þ
-    { 23, 30, 20, -4, 23, 173, 13626 }, // ß
-    { 16, 24, 18, 1, 23, 96, 13799 }, // à
-    { 16, 24, 18, 1, 23, 96, 13895 }, // á
-    { 16, 24, 18, 1, 23, 96, 13991 }, // â
-    { 17, 24, 19, 1, 23, 102, 14087 }, // ã
-    { 16, 23, 18, 1, 22, 92, 14189 }, // ä
-    { 16, 26, 18, 1, 25, 104, 14281 }, // å
-    { 24, 18, 26, 1, 17, 108, 14385 }, // æ
-    { 14, 24, 16, 1, 17, 84, 14493 }, // ç
-    { 15, 24, 17, 1, 23, 90, 14577 }, // è
-    { 15, 24, 17, 1, 23, 90, 14667 }, // é
-    { 16, 24, 18, 1, 23, 96, 14757 }, // ê
-    { 15, 23, 17, 1, 22, 87, 14853 }, // ë
-    { 9, 23, 10, 0, 23, 52, 14940 }, // ì
-    { 12, 23, 13, 0, 23, 69, 14992 }, // í
-    { 12, 23, 13, 0, 23, 69, 15061 }, // î
-    { 12, 22, 13, 0, 22, 66, 15130 }, // ï
-    { 16, 24, 18, 1, 23, 96, 15196 }, // ð
-    { 18, 23, 19, 0, 23, 104, 15292 }, // ñ
-    { 15, 24, 17, 1, 23, 90, 15396 }, // ò
-    { 15, 24, 17, 1, 23, 90, 15486 }, // ó
-    { 15, 24, 17, 1, 23, 90, 15576 }, // ô
-    { 16, 24, 18, 1, 23, 96, 15666 }, // õ
-    { 15, 23, 17, 1, 22, 87, 15762 }, // ö
-    { 15, 15, 17, 1, 18, 57, 15849 }, // ÷
-    { 17, 19, 18, 0, 17, 81, 15906 }, // ø
-    { 17, 24, 19, 1, 23, 102, 15987 }, // ù
-    { 17, 24, 19, 1, 23, 102, 16089 }, // ú
-    { 17, 24, 19, 1, 23, 102, 16191 }, // û
-    { 17, 23, 19, 1, 22, 98, 16293 }, // ü
-    { 20, 30, 18, -3, 23, 150, 16391 }, // ý
-    { 18, 30, 18, -1, 23, 135, 16541 }, // þ
-    { 20, 29, 18, -3, 22, 145, 16676 }, // ÿ
-    { 20, 26, 19, -2, 26, 130, 16821 }, // Ā
-    { 16, 22, 18, 1, 21, 88, 16951 }, // ā
-    { 20, 28, 19, -2, 28, 140, 17039 }, // Ă
-    { 16, 24, 18, 1, 23, 96, 17179 }, // ă
-    { 19, 29, 18, -2, 21, 138, 17275 }, // Ą
-    { 16, 25, 18, 1, 17, 100, 17413 }, // ą
-    { 19, 29, 21, 1, 28, 138, 17513 }, // Ć
-    { 15, 24, 17, 1, 23, 90, 17651 }, // ć
-    { 19, 29, 21, 1, 28, 138, 17741 }, // Ĉ
-    { 15, 24, 17, 1, 23, 90, 17879 }, // ĉ
-    { 19, 29, 21, 1, 28, 138, 17969 }, // Ċ
-    { 14, 24, 16, 1, 23, 84, 18107 }, // ċ
-    { 19, 29, 21, 1, 28, 138, 18191 }, // Č
-    { 16, 24, 18, 1, 23, 96, 18329 }, // č
-    { 20, 28, 21, 0, 28, 140, 18425 }, // Ď
-    { 24, 24, 26, 1, 23, 144, 18565 }, // ď
-    { 19, 21, 20, 0, 21, 100, 18709 }, // Đ
-    { 19, 24, 21, 1, 23, 114, 18809 }, // đ
-    { 17, 26, 18, 0, 26, 111, 18923 }, // Ē
-    { 15, 22, 17, 1, 21, 83, 19034 }, // ē
-    { 18, 28, 19, 0, 28, 126, 19117 }, // Ĕ
-    { 15, 24, 17, 1, 23, 90, 19243 }, // ĕ
-    { 17, 28, 18, 0, 28, 119, 19333 }, // Ė
-    { 15, 24, 17, 1, 23, 90, 19452 }, // ė
-    { 17, 29, 18, 0, 21, 124, 19542 }, // Ę
-    { 15, 24, 17, 1, 17, 90, 19666 }, // ę
-    { 19, 28, 20, 0, 28, 133, 19756 }, // Ě
-    { 17, 24, 19, 1, 23, 102, 19889 }, // ě
-    { 19, 29, 21, 1, 28, 138, 19991 }, // Ĝ
-    { 17, 30, 18, 0, 23, 128, 20129 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 20257 }, // Ğ
-    { 17, 30, 18, 0, 23, 128, 20395 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 20523 }, // Ġ
-    { 17, 30, 18, 0, 23, 128, 20661 }, // ġ
-    { 19, 29, 21, 1, 22, 138, 20789 }, // Ģ
-    { 17, 30, 18, 0, 23, 128, 20927 }, // ģ
-    { 21, 28, 22, 0, 28, 147, 21055 }, // Ĥ
-    { 17, 29, 18, 0, 29, 124, 21202 }, // ĥ
-    { 23, 21, 24, 0, 21, 121, 21326 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 21447 }, // ħ
-    { 16, 28, 16, -1, 28, 112, 21539 }, // Ĩ
-    { 13, 23, 14, 0, 23, 75, 21651 }, // ĩ
-    { 15, 26, 15, -1, 26, 98, 21726 }, // Ī
-    { 12, 21, 13, 0, 21, 63, 21824 }, // ī
-    { 16, 28, 16, -1, 28, 112, 21887 }, // Ĭ
-    { 13, 23, 14, 0, 23, 75, 21999 }, // ĭ
-    { 14, 29, 14, -1, 21, 102, 22074 }, // Į
-    { 12, 31, 11, -2, 23, 93, 22176 }, // į
-    { 14, 28, 14, -1, 28, 98, 22269 }, // İ
-    { 9, 16, 10, 0, 16, 36, 22367 }, // ı
-    { 23, 28, 23, -1, 21, 161, 22403 }, // Ĳ
-    { 19, 30, 20, 0, 23, 143, 22564 }, // ĳ
-    { 19, 35, 15, -5, 28, 167, 22707 }, // Ĵ
-    { 16, 30, 13, -4, 23, 120, 22874 }, // ĵ
-    { 21, 28, 22, 0, 21, 147, 22994 }, // Ķ
-    { 18, 30, 19, 0, 23, 135, 23141 }, // ķ
-    { 18, 16, 19, 0, 16, 72, 23276 }, // ĸ
-    { 15, 28, 16, 0, 28, 105, 23348 }, // Ĺ
-    { 14, 29, 15, 0, 29, 102, 23453 }, // ĺ
-    { 14, 28, 15, 0, 21, 98, 23555 }, // Ļ
-    { 12, 30, 11, -2, 23, 90, 23653 }, // ļ
-    { 17, 21, 18, 0, 21, 90, 23743 }, // Ľ
-    { 16, 23, 17, 0, 23, 92, 23833 }, // ľ
-    { 15, 21, 16, 0, 21, 79, 23925 }, // Ŀ
-    { 14, 23, 15, 0, 23, 81, 24004 }, // ŀ
-    { 15, 21, 15, -1, 21, 79, 24085 }, // Ł
-    { 11, 23, 12, 0, 23, 64, 24164 }, // ł
-    { 23, 28, 24, 0, 28, 161, 24228 }, // Ń
-    { 17, 23, 18, 0, 23, 98, 24389 }, // ń
-    { 23, 28, 24, 0, 21, 161, 24487 }, // Ņ
-    { 17, 24, 18, 0, 17, 102, 24648 }, // ņ
-    { 23, 28, 24, 0, 28, 161, 24750 }, // Ň
-    { 18, 23, 19, 0, 23, 104, 24911 }, // ň
-    { 20, 21, 21, 0, 21, 105, 25015 }, // ŉ
-    { 23, 28, 24, 0, 21, 161, 25120 }, // Ŋ
-    { 17, 24, 18, 0, 17, 102, 25281 }, // ŋ
-    { 20, 27, 22, 1, 26, 135, 25383 }, // Ō
-    { 15, 22, 17, 1, 21, 83, 25518 }, // ō
-    { 20, 29, 22, 1, 28, 145, 25601 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 25746 }, // ŏ
-    { 22, 29, 24, 1, 28, 160, 25842 }, // Ő
-    { 19, 24, 21, 1, 23, 114, 26002 }, // ő
-    { 27, 23, 29, 1, 22, 156, 26116 }, // Œ
-    { 24, 18, 26, 1, 17, 108, 26272 }, // œ
-    { 18, 28, 19, 0, 28, 126, 26380 }, // Ŕ
-    { 15, 23, 16, 0, 23, 87, 26506 }, // ŕ
-    { 18, 28, 19, 0, 21, 126, 26593 }, // Ŗ
-    { 15, 24, 15, -1, 17, 90, 26719 }, // ŗ
-    { 19, 28, 20, 0, 28, 133, 26809 }, // Ř
-    { 16, 23, 17, 0, 23, 92, 26942 }, // ř
-    { 17, 29, 18, 0, 28, 124, 27034 }, // Ś
-    { 15, 24, 16, 0, 23, 90, 27158 }, // ś
-    { 17, 29, 18, 0, 28, 124, 27248 }, // Ŝ
-    { 15, 24, 16, 0, 23, 90, 27372 }, // ŝ
-    { 16, 29, 17, 0, 22, 116, 27462 }, // Ş
-    { 14, 24, 15, 0, 17, 84, 27578 }, // ş
-    { 18, 29, 19, 0, 28, 131, 27662 }, // Š
-    { 16, 24, 17, 0, 23, 96, 27793 }, // š
-    { 16, 28, 19, 2, 21, 112, 27889 }, // Ţ
-    { 12, 27, 14, 1, 20, 81, 28001 }, // ţ
-    { 16, 28, 19, 2, 28, 112, 28082 }, // Ť
-    { 15, 24, 17, 1, 23, 90, 28194 }, // ť
-    { 16, 21, 19, 2, 21, 84, 28284 }, // Ŧ
-    { 13, 21, 14, 0, 20, 69, 28368 }, // ŧ
-    { 20, 29, 22, 1, 28, 145, 28437 }, // Ũ
-    { 17, 24, 19, 1, 23, 102, 28582 }, // ũ
-    { 20, 27, 22, 1, 26, 135, 28684 }, // Ū
-    { 17, 22, 19, 1, 21, 94, 28819 }, // ū
-    { 20, 29, 22, 1, 28, 145, 28913 }, // Ŭ
-    { 17, 24, 19, 1, 23, 102, 29058 }, // ŭ
-    { 20, 31, 22, 1, 30, 155, 29160 }, // Ů
-    { 17, 26, 19, 1, 25, 111, 29315 }, // ů
-    { 21, 29, 23, 1, 28, 153, 29426 }, // Ű
-    { 19, 24, 21, 1, 23, 114, 29579 }, // ű
-    { 20, 29, 22, 1, 21, 145, 29693 }, // Ų
-    { 17, 24, 19, 1, 16, 102, 29838 }, // ų
-    { 27, 28, 30, 2, 28, 189, 29940 }, // Ŵ
-    { 24, 23, 26, 1, 23, 138, 30129 }, // ŵ
-    { 18, 28, 21, 2, 28, 126, 30267 }, // Ŷ
-    { 20, 30, 18, -3, 23, 150, 30393 }, // ŷ
-    { 18, 27, 21, 2, 27, 122, 30543 }, // Ÿ
-    { 19, 28, 19, -1, 28, 133, 30665 }, // Ź
-    { 16, 23, 16, -1, 23, 92, 30798 }, // ź
-    { 19, 28, 19, -1, 28, 133, 30890 }, // Ż
-    { 15, 23, 15, -1, 23, 87, 31023 }, // ż
-    { 19, 28, 19, -1, 28, 133, 31110 }, // Ž
-    { 17, 23, 17, -1, 23, 98, 31243 }, // ž
-    { 18, 30, 15, -4, 23, 135, 31341 }, // ſ
-    { 25, 24, 27, 1, 23, 150, 31476 }, // Ơ
-    { 21, 20, 23, 1, 19, 105, 31626 }, // ơ
-    { 29, 23, 32, 1, 22, 167, 31731 }, // Ƣ
-    { 24, 24, 26, 1, 17, 144, 31898 }, // ƣ
-    { 21, 21, 23, 1, 21, 111, 32042 }, // Ƥ
-    { 18, 30, 18, -1, 23, 135, 32153 }, // ƥ
-    { 17, 24, 18, 0, 21, 102, 32288 }, // Ʀ
-    { 16, 23, 17, 0, 22, 92, 32390 }, // Ƨ
-    { 14, 18, 15, 0, 17, 63, 32482 }, // ƨ
-    { 19, 21, 19, -1, 21, 100, 32545 }, // Ʃ
-    { 10, 30, 11, 0, 23, 75, 32645 }, // ƪ
-    { 12, 27, 14, 1, 20, 81, 32720 }, // ƫ
-    { 18, 21, 20, 1, 21, 95, 32801 }, // Ƭ
-    { 12, 24, 14, 1, 23, 72, 32896 }, // ƭ
-    { 16, 28, 19, 2, 21, 112, 32968 }, // Ʈ
-    { 25, 24, 28, 2, 23, 150, 33080 }, // Ư
-    { 23, 20, 25, 1, 19, 115, 33230 }, // ư
-    { 8, 6, 0, -13, 23, 12, 33345 }, // ̀
-    { 9, 6, 3, -7, 23, 14, 33357 }, // ́
-    { 12, 6, 9, -4, 23, 18, 33371 }, // ̂
-    { 13, 6, 1, -13, 23, 20, 33389 }, // ̃
-    { 10, 4, 8, -3, 21, 10, 33409 }, // ̄
-    { 14, 4, 11, -4, 25, 14, 33419 }, // ̅
-    { 11, 6, 9, -3, 23, 17, 33433 }, // ̆
-    { 5, 6, 6, 0, 23, 8, 33450 }, // ̇
-    { 11, 4, 9, -3, 22, 11, 33458 }, // ̈
-    { 7, 8, 0, -9, 25, 14, 33469 }, // ̉
-    { 8, 8, 8, -1, 25, 16, 33483 }, // ̊
-    { 14, 6, 12, -3, 23, 21, 33499 }, // ̋
-    { 12, 6, 10, -3, 23, 18, 33520 }, // ̌
-    { 5, 9, 6, 0, 23, 12, 33538 }, // ̍
-    { 10, 6, 9, -2, 23, 15, 33550 }, // ̎
-    { 12, 6, 0, -14, 23, 18, 33565 }, // ̏
-    { 11, 8, 9, -3, 25, 22, 33583 }, // ̐
-    { 11, 6, 9, -3, 23, 17, 33605 }, // ̑
-    { 8, 8, 7, -2, 21, 16, 33622 }, // ̒
-    { 8, 8, 7, -2, 21, 16, 33638 }, // ̓
-    { 5, 8, 6, 0, 21, 10, 33654 }, // ̔
-    { 8, 8, 7, -2, 21, 16, 33664 }, // ̕
-    { 7, 6, 2, -6, -1, 11, 33680 }, // ̖
-    { 9, 6, 3, -7, -1, 14, 33691 }, // ̗
-    { 7, 7, 2, -6, 0, 13, 33705 }, // ̘
-    { 7, 7, 2, -6, 0, 13, 33718 }, // ̙
-    { 10, 9, 13, 2, 23, 23, 33731 }, // ̚
-    { 9, 8, 8, -2, 23, 18, 33754 }, // ̛
-    { 5, 7, 4, -2, 0, 9, 33772 }, // ̜
-    { 7, 6, 2, -6, -1, 11, 33781 }, // ̝
-    { 8, 6, 3, -6, -1, 12, 33792 }, // ̞
-    { 7, 7, 2, -6, 0, 13, 33804 }, // ̟
-    { 7, 3, 2, -6, -3, 6, 33817 }, // ̠
-    { 9, 9, 3, -7, 2, 21, 33823 }, // ̡
-    { 8, 9, 5, -4, 2, 18, 33844 }, // ̢
-    { 6, 6, 0, -14, -1, 9, 33862 }, // ̣
-    { 11, 4, 4, -8, -2, 11, 33871 }, // ̤
-    { 8, 8, 3, -6, 0, 16, 33882 }, // ̥
-    { 7, 6, 9, 1, -1, 11, 33898 }, // ̦
-    { 8, 7, 3, -6, 0, 14, 33909 }, // ̧
-    { 7, 8, 2, -6, 0, 14, 33923 }, // ̨
-    { 6, 9, 2, -5, 0, 14, 33937 }, // ̩
-    { 13, 6, 5, -9, -1, 20, 33951 }, // ̪
-    { 12, 5, 5, -8, -1, 15, 33971 }, // ̫
-    { 13, 6, 6, -8, -1, 20, 33986 }, // ̬
-    { 13, 6, 5, -9, -1, 20, 34006 }, // ̭
-    { 12, 6, 5, -8, -1, 18, 34026 }, // ̮
-    { 11, 6, 4, -8, -1, 17, 34044 }, // ̯
-    { 13, 6, 5, -9, -1, 20, 34061 }, // ̰
-    { 11, 4, 4, -8, -2, 11, 34081 }, // ̱
-    { 14, 3, 6, -9, -2, 11, 34092 }, // ̲
-    { 14, 7, 5, -10, 0, 25, 34103 }, // ̳
-    { 13, 6, 7, -7, 11, 20, 34128 }, // ̴
-    { 13, 4, 7, -7, 10, 13, 34148 }, // ̵
-    { 22, 4, 12, -11, 10, 22, 34161 }, // ̶
-    { 12, 9, 7, -6, 13, 27, 34183 }, // ̷
-    { 18, 25, 10, -9, 23, 113, 34210 }, // ̸
-    { 6, 7, 4, -3, 0, 11, 34323 }, // ̹
-    { 12, 6, 5, -8, -1, 18, 34334 }, // ̺
-    { 12, 7, 5, -8, 0, 21, 34352 }, // ̻
-    { 12, 5, 5, -8, -1, 15, 34373 }, // ̼
-    { 8, 7, 8, -1, 23, 14, 34388 }, // ̽
-    { 7, 10, 7, -1, 26, 18, 34402 }, // ̾
-    { 14, 7, 11, -4, 29, 25, 34420 }, // ̿
-    { 7, 6, 5, -3, 23, 11, 34445 }, // ̀
-    { 8, 6, 9, 0, 23, 12, 34456 }, // ́
-    { 13, 6, 18, 4, 23, 20, 34468 }, // ͂
-    { 6, 6, 7, 0, 23, 9, 34488 }, // ̓
-    { 17, 6, 13, -5, 23, 26, 34497 }, // ̈́
-    { 6, 6, 3, -4, -1, 9, 34523 }, // ͅ
-    { 13, 6, 10, -4, 23, 20, 34532 }, // ͆
-    { 14, 7, 5, -10, 0, 25, 34552 }, // ͇
-    { 10, 6, 4, -7, 0, 15, 34577 }, // ͈
-    { 6, 6, 2, -5, -1, 9, 34592 }, // ͉
-    { 11, 7, 9, -3, 23, 20, 34601 }, // ͊
-    { 12, 12, 10, -3, 28, 36, 34621 }, // ͋
-    { 12, 9, 10, -3, 26, 27, 34657 }, // ͌
-    { 11, 6, 4, -8, -1, 17, 34684 }, // ͍
-    { 6, 7, 2, -5, 0, 11, 34701 }, // ͎
-    { 22, 21, 12, -11, 21, 116, 34712 }, // ͏
-    { 5, 7, 6, 0, 24, 9, 34828 }, // ͐
-    { 6, 7, 10, 3, 25, 11, 34837 }, // ͑
-    { 11, 8, 9, -3, 25, 22, 34848 }, // ͒
-    { 7, 7, 3, -5, 0, 13, 34870 }, // ͓
-    { 6, 6, 2, -5, -1, 9, 34883 }, // ͔
-    { 6, 6, 3, -4, -1, 9, 34892 }, // ͕
-    { 12, 6, 6, -7, -1, 18, 34901 }, // ͖
-    { 6, 7, 9, 2, 24, 11, 34919 }, // ͗
-    { 5, 6, 6, 0, 23, 8, 34930 }, // ͘
-    { 7, 6, 2, -6, -1, 11, 34938 }, // ͙
-    { 12, 7, 5, -8, 0, 21, 34949 }, // ͚
-    { 6, 6, 7, 0, 23, 9, 34970 }, // ͛
-    { 23, 6, 11, -13, -1, 35, 34979 }, // ͜
-    { 23, 6, 15, -9, 23, 35, 35014 }, // ͝
-    { 17, 4, 12, -6, 21, 17, 35049 }, // ͞
-    { 16, 4, 7, -10, -1, 16, 35066 }, // ͟
-    { 24, 6, 16, -9, 23, 36, 35082 }, // ͠
-    { 23, 7, 16, -8, 26, 41, 35118 }, // ͡
-    { 24, 7, 10, -15, 0, 42, 35159 }, // ͢
-    { 8, 8, 8, -1, 25, 16, 35201 }, // ͣ
-    { 8, 8, 8, -1, 25, 16, 35217 }, // ͤ
-    { 5, 9, 7, 1, 27, 12, 35233 }, // ͥ
-    { 8, 8, 8, -1, 25, 16, 35245 }, // ͦ
-    { 8, 8, 8, -1, 25, 16, 35261 }, // ͧ
-    { 7, 8, 8, 0, 25, 14, 35277 }, // ͨ
-    { 9, 10, 9, -1, 27, 23, 35291 }, // ͩ
-    { 8, 9, 8, -1, 27, 18, 35314 }, // ͪ
-    { 12, 7, 10, -3, 25, 21, 35332 }, // ͫ
-    { 7, 7, 8, 0, 25, 13, 35353 }, // ͬ
-    { 6, 9, 7, 0, 26, 14, 35366 }, // ͭ
-    { 7, 7, 8, 0, 25, 13, 35380 }, // ͮ
-    { 9, 7, 8, -2, 25, 16, 35393 }, // ͯ
-    { 19, 21, 18, -2, 21, 100, 35409 }, // Α
-    { 18, 21, 19, 0, 21, 95, 35509 }, // Β
-    { 17, 21, 18, 0, 21, 90, 35604 }, // Γ
-    { 20, 21, 19, -2, 21, 105, 35694 }, // Δ
-    { 17, 21, 18, 0, 21, 90, 35799 }, // Ε
-    { 19, 21, 19, -1, 21, 100, 35889 }, // Ζ
-    { 21, 21, 22, 0, 21, 111, 35989 }, // Η
-    { 20, 23, 22, 1, 22, 115, 36100 }, // Θ
-    { 14, 21, 14, -1, 21, 74, 36215 }, // Ι
-    { 21, 21, 22, 0, 21, 111, 36289 }, // Κ
-    { 18, 21, 18, -2, 21, 95, 36400 }, // Λ
-    { 26, 21, 27, 0, 21, 137, 36495 }, // Μ
-    { 23, 21, 24, 0, 21, 121, 36632 }, // Ν
-    { 17, 21, 18, 0, 21, 90, 36753 }, // Ξ
-    { 20, 23, 22, 1, 22, 115, 36843 }, // Ο
-    { 21, 21, 22, 0, 21, 111, 36958 }, // Π
-    { 18, 21, 19, 0, 21, 95, 37069 }, // Ρ
-    { 19, 21, 19, -1, 21, 100, 37164 }, // Σ
-    { 16, 21, 19, 2, 21, 84, 37264 }, // Τ
-    { 18, 21, 21, 2, 21, 95, 37348 }, // Υ
-    { 24, 23, 26, 1, 22, 138, 37443 }, // Φ
-    { 23, 21, 22, -2, 21, 121, 37581 }, // Χ
-    { 23, 21, 27, 3, 21, 121, 37702 }, // Ψ
-    { 22, 22, 22, -1, 22, 121, 37823 }, // Ω
-    { 16, 18, 18, 1, 17, 72, 37944 }, // α
-    { 19, 30, 19, -1, 23, 143, 38016 }, // β
-    { 15, 23, 17, 1, 16, 87, 38159 }, // γ
-    { 17, 24, 19, 1, 23, 102, 38246 }, // δ
-    { 14, 18, 15, 0, 17, 63, 38348 }, // ε
-    { 16, 29, 17, 0, 23, 116, 38411 }, // ζ
-    { 17, 24, 18, 0, 17, 102, 38527 }, // η
-    { 16, 24, 18, 1, 23, 96, 38629 }, // θ
-    { 9, 17, 11, 1, 16, 39, 38725 }, // ι
-    { 18, 16, 19, 0, 16, 72, 38764 }, // κ
-    { 18, 24, 17, -2, 23, 108, 38836 }, // λ
-    { 19, 23, 19, -1, 16, 110, 38944 }, // μ
-    { 15, 16, 17, 1, 16, 60, 39054 }, // ν
-    { 16, 29, 18, 1, 23, 116, 39114 }, // ξ
-    { 15, 18, 17, 1, 17, 68, 39230 }, // ο
-    { 21, 17, 23, 1, 16, 90, 39298 }, // π
-    { 17, 24, 17, -1, 17, 102, 39388 }, // ρ
-    { 14, 23, 16, 1, 17, 81, 39490 }, // ς
-    { 18, 17, 20, 1, 16, 77, 39571 }, // σ
-    { 15, 17, 17, 1, 16, 64, 39648 }, // τ
-    { 16, 17, 18, 1, 16, 68, 39712 }, // υ
-    { 21, 24, 23, 1, 17, 126, 39780 }, // φ
-    { 21, 25, 20, -2, 17, 132, 39906 }, // χ
-    { 22, 30, 24, 1, 23, 165, 40038 }, // ψ
-    { 23, 17, 25, 1, 16, 98, 40203 }, // ω
-    { 19, 28, 18, -2, 21, 133, 40301 }, // Ạ
-    { 16, 24, 18, 1, 17, 96, 40434 }, // ạ
-    { 19, 30, 18, -2, 30, 143, 40530 }, // Ả
-    { 16, 26, 18, 1, 25, 104, 40673 }, // ả
-    { 25, 29, 24, -2, 29, 182, 40777 }, // Ấ
-    { 20, 25, 22, 1, 24, 125, 40959 }, // ấ
-    { 20, 29, 19, -2, 29, 145, 41084 }, // Ầ
-    { 16, 25, 18, 1, 24, 100, 41229 }, // ầ
-    { 23, 31, 22, -2, 31, 179, 41329 }, // Ẩ
-    { 19, 27, 21, 1, 26, 129, 41508 }, // ẩ
-    { 21, 31, 20, -2, 31, 163, 41637 }, // Ẫ
-    { 16, 27, 18, 1, 26, 108, 41800 }, // ẫ
-    { 20, 35, 19, -2, 28, 175, 41908 }, // Ậ
-    { 16, 30, 18, 1, 23, 120, 42083 }, // ậ
-    { 20, 30, 19, -2, 30, 150, 42203 }, // Ắ
-    { 16, 26, 18, 1, 25, 104, 42353 }, // ắ
-    { 20, 30, 19, -2, 30, 150, 42457 }, // Ằ
-    { 16, 26, 18, 1, 25, 104, 42607 }, // ằ
-    { 20, 31, 19, -2, 31, 155, 42711 }, // Ẳ
-    { 16, 27, 18, 1, 26, 108, 42866 }, // ẳ
-    { 21, 31, 20, -2, 31, 163, 42974 }, // Ẵ
-    { 16, 27, 18, 1, 26, 108, 43137 }, // ẵ
-    { 20, 35, 19, -2, 28, 175, 43245 }, // Ặ
-    { 16, 30, 18, 1, 23, 120, 43420 }, // ặ
-    { 17, 28, 18, 0, 21, 119, 43540 }, // Ẹ
-    { 15, 24, 17, 1, 17, 90, 43659 }, // ẹ
-    { 17, 30, 18, 0, 30, 128, 43749 }, // Ẻ
-    { 15, 26, 17, 1, 25, 98, 43877 }, // ẻ
-    { 18, 28, 19, 0, 28, 126, 43975 }, // Ẽ
-    { 16, 24, 18, 1, 23, 96, 44101 }, // ẽ
-    { 22, 29, 23, 0, 29, 160, 44197 }, // Ế
-    { 20, 25, 22, 1, 24, 125, 44357 }, // ế
-    { 17, 29, 18, 0, 29, 124, 44482 }, // Ề
-    { 15, 25, 17, 1, 24, 94, 44606 }, // ề
-    { 20, 31, 21, 0, 31, 155, 44700 }, // Ể
-    { 18, 27, 20, 1, 26, 122, 44855 }, // ể
-    { 18, 31, 19, 0, 31, 140, 44977 }, // Ễ
-    { 16, 27, 18, 1, 26, 108, 45117 }, // ễ
-    { 17, 35, 18, 0, 28, 149, 45225 }, // Ệ
-    { 16, 30, 18, 1, 23, 120, 45374 }, // ệ
-    { 14, 30, 14, -1, 30, 105, 45494 }, // Ỉ
-    { 11, 25, 12, 0, 25, 69, 45599 }, // ỉ
-    { 14, 28, 14, -1, 21, 98, 45668 }, // Ị
-    { 11, 30, 11, -1, 23, 83, 45766 }, // ị
-    { 20, 29, 22, 1, 22, 145, 45849 }, // Ọ
-    { 15, 24, 17, 1, 17, 90, 45994 }, // ọ
-    { 20, 31, 22, 1, 30, 155, 46084 }, // Ỏ
-    { 15, 26, 17, 1, 25, 98, 46239 }, // ỏ
-    { 23, 30, 25, 1, 29, 173, 46337 }, // Ố
-    { 20, 25, 22, 1, 24, 125, 46510 }, // ố
-    { 20, 30, 22, 1, 29, 150, 46635 }, // Ồ
-    { 15, 25, 17, 1, 24, 94, 46785 }, // ồ
-    { 22, 32, 24, 1, 31, 176, 46879 }, // Ổ
-    { 18, 27, 20, 1, 26, 122, 47055 }, // ổ
-    { 20, 32, 22, 1, 31, 160, 47177 }, // Ỗ
-    { 16, 27, 18, 1, 26, 108, 47337 }, // ỗ
-    { 20, 35, 22, 1, 28, 175, 47445 }, // Ộ
-    { 15, 30, 17, 1, 23, 113, 47620 }, // ộ
-    { 25, 29, 27, 1, 28, 182, 47733 }, // Ớ
-    { 21, 24, 23, 1, 23, 126, 47915 }, // ớ
-    { 25, 29, 27, 1, 28, 182, 48041 }, // Ờ
-    { 21, 24, 23, 1, 23, 126, 48223 }, // ờ
-    { 25, 31, 27, 1, 30, 194, 48349 }, // Ở
-    { 21, 26, 23, 1, 25, 137, 48543 }, // ở
-    { 25, 29, 27, 1, 28, 182, 48680 }, // Ỡ
-    { 21, 24, 23, 1, 23, 126, 48862 }, // ỡ
-    { 25, 30, 27, 1, 23, 188, 48988 }, // Ợ
-    { 21, 26, 23, 1, 19, 137, 49176 }, // ợ
-    { 20, 28, 22, 1, 21, 140, 49313 }, // Ụ
-    { 17, 23, 19, 1, 16, 98, 49453 }, // ụ
-    { 20, 31, 22, 1, 30, 155, 49551 }, // Ủ
-    { 17, 26, 19, 1, 25, 111, 49706 }, // ủ
-    { 25, 29, 28, 2, 28, 182, 49817 }, // Ứ
-    { 23, 24, 25, 1, 23, 138, 49999 }, // ứ
-    { 25, 29, 28, 2, 28, 182, 50137 }, // Ừ
-    { 23, 24, 25, 1, 23, 138, 50319 }, // ừ
-    { 25, 31, 28, 2, 30, 194, 50457 }, // Ử
-    { 23, 26, 25, 1, 25, 150, 50651 }, // ử
-    { 25, 29, 28, 2, 28, 182, 50801 }, // Ữ
-    { 23, 24, 25, 1, 23, 138, 50983 }, // ữ
-    { 25, 30, 28, 2, 23, 188, 51121 }, // Ự
-    { 23, 26, 25, 1, 19, 150, 51309 }, // ự
-    { 18, 28, 21, 2, 28, 126, 51459 }, // Ỳ
-    { 20, 30, 18, -3, 23, 150, 51585 }, // ỳ
-    { 18, 28, 21, 2, 21, 126, 51735 }, // Ỵ
-    { 20, 23, 18, -3, 16, 115, 51861 }, // ỵ
-    { 18, 30, 21, 2, 30, 135, 51976 }, // Ỷ
-    { 20, 32, 18, -3, 25, 160, 52111 }, // ỷ
-    { 18, 28, 21, 2, 28, 126, 52271 }, // Ỹ
-    { 20, 30, 18, -3, 23, 150, 52397 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 52547 }, //  
-    { 0, 0, 29, 0, 0, 0, 52547 }, //  
-    { 0, 0, 15, 0, 0, 0, 52547 }, //  
-    { 0, 0, 29, 0, 0, 0, 52547 }, //  
-    { 0, 0, 10, 0, 0, 0, 52547 }, //  
-    { 0, 0, 7, 0, 0, 0, 52547 }, //  
-    { 0, 0, 5, 0, 0, 0, 52547 }, //  
-    { 0, 0, 16, 0, 0, 0, 52547 }, //  
-    { 0, 0, 8, 0, 0, 0, 52547 }, //  
-    { 0, 0, 5, 0, 0, 0, 52547 }, //  
-    { 0, 0, 3, 0, 0, 0, 52547 }, //  
-    { 0, 0, 1, 0, 0, 0, 52547 }, // ​
-    { 0, 0, 1, 0, 0, 0, 52547 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 52547 }, // ‍
-    { 8, 25, 8, -1, 21, 50, 52547 }, // ‎
-    { 8, 25, 2, -7, 21, 50, 52597 }, // ‏
-    { 9, 4, 10, 0, 10, 9, 52647 }, // ‐
-    { 9, 4, 10, 0, 10, 9, 52656 }, // ‑
-    { 15, 4, 17, 1, 12, 15, 52665 }, // ‒
-    { 14, 4, 15, 0, 10, 14, 52680 }, // –
-    { 28, 4, 29, 0, 10, 28, 52694 }, // —
-    { 28, 4, 29, 0, 10, 28, 52722 }, // ―
-    { 12, 30, 16, 2, 23, 90, 52750 }, // ‖
-    { 14, 7, 12, -4, 0, 25, 52840 }, // ‗
-    { 8, 8, 10, 1, 21, 16, 52865 }, // ‘
-    { 8, 8, 10, 1, 21, 16, 52881 }, // ’
-    { 8, 8, 8, -2, 4, 16, 52897 }, // ‚
-    { 5, 8, 9, 3, 21, 10, 52913 }, // ‛
-    { 14, 8, 16, 1, 21, 28, 52923 }, // “
-    { 14, 8, 16, 1, 21, 28, 52951 }, // ”
-    { 14, 8, 15, -2, 4, 28, 52979 }, // „
-    { 11, 8, 15, 3, 21, 22, 53007 }, // ‟
-    { 13, 23, 16, 2, 23, 75, 53029 }, // †
-    { 16, 23, 17, 0, 23, 92, 53104 }, // ‡
-    { 10, 10, 12, 1, 16, 25, 53196 }, // •
-    { 10, 12, 12, 1, 17, 30, 53221 }, // ‣
-    { 6, 6, 15, 3, 5, 9, 53251 }, // ․
-    { 14, 6, 17, 0, 5, 21, 53260 }, // ‥
-    { 22, 6, 24, 0, 5, 33, 53281 }, // …
-    { 6, 6, 9, 2, 11, 9, 53314 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 53323 }, //  
-    { 0, 0, 18, 0, 0, 0, 53323 }, //  
-    { 8, 22, 8, -1, 18, 44, 53323 }, // ‪
-    { 8, 22, 2, -7, 18, 44, 53367 }, // ‫
-    { 8, 25, 5, -4, 21, 50, 53411 }, // ‬
-    { 8, 25, 5, -4, 21, 50, 53461 }, // ‭
-    { 8, 25, 5, -4, 21, 50, 53511 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 53561 }, //  
-    { 34, 23, 36, 1, 22, 196, 53561 }, // ‰
-    { 45, 23, 47, 1, 22, 259, 53757 }, // ‱
-    { 10, 8, 12, 1, 21, 20, 54016 }, // ′
-    { 16, 8, 18, 1, 21, 32, 54036 }, // ″
-    { 23, 8, 25, 1, 21, 46, 54068 }, // ‴
-    { 8, 8, 11, 2, 21, 16, 54114 }, // ‵
-    { 14, 8, 17, 2, 21, 28, 54130 }, // ‶
-    { 21, 8, 24, 2, 21, 42, 54158 }, // ‷
-    { 11, 10, 10, -3, 3, 28, 54200 }, // ‸
-    { 9, 14, 11, 1, 15, 32, 54228 }, // ‹
-    { 9, 14, 10, 0, 15, 32, 54260 }, // ›
-    { 24, 23, 25, 0, 22, 138, 54292 }, // ※
-    { 18, 22, 19, 0, 21, 99, 54430 }, // ‼
-    { 13, 23, 16, 2, 22, 75, 54529 }, // ‽
-    { 15, 4, 18, 2, 26, 15, 54604 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 54619 }, // ‿
-    { 16, 8, 19, 2, 24, 32, 54647 }, // ⁀
-    { 15, 19, 13, -3, 12, 72, 54679 }, // ⁁
-    { 33, 27, 34, -1, 23, 223, 54751 }, // ⁂
-    { 9, 5, 10, 0, 10, 12, 54974 }, // ⁃
-    { 20, 21, 13, -8, 21, 105, 54986 }, // ⁄
-    { 13, 26, 13, -1, 21, 85, 55091 }, // ⁅
-    { 13, 26, 12, -2, 21, 85, 55176 }, // ⁆
-    { 26, 23, 29, 2, 22, 150, 55261 }, // ⁇
-    { 21, 23, 24, 2, 22, 121, 55411 }, // ⁈
-    { 23, 23, 24, 0, 22, 133, 55532 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 55665 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 55725 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 55833 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 55893 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 55953 }, // ⁎
-    { 8, 21, 10, 1, 17, 42, 56010 }, // ⁏
-    { 20, 31, 19, -2, 24, 155, 56052 }, // ⁐
-    { 18, 30, 18, -1, 23, 135, 56207 }, // ⁑
-    { 13, 23, 14, 0, 22, 75, 56342 }, // ⁒
-    { 28, 7, 30, 1, 12, 49, 56417 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 56466 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 56494 }, // ⁕
-    { 14, 23, 16, 1, 22, 81, 56558 }, // ⁖
-    { 27, 8, 29, 1, 21, 54, 56639 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 56693 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 56826 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 56959 }, // ⁚
-    { 19, 24, 21, 1, 23, 114, 56994 }, // ⁛
-    { 24, 23, 25, 0, 22, 138, 57108 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 57246 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 57282 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 57311 }, //  
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 57311 }, // ⁩
-    { 8, 25, 5, -4, 21, 50, 57311 }, // ⁪
-    { 8, 25, 5, -4, 21, 50, 57361 }, // ⁫
-    { 8, 25, 5, -4, 21, 50, 57411 }, // ⁬
-    { 8, 25, 5, -4, 21, 50, 57461 }, // ⁭
-    { 8, 25, 5, -4, 21, 50, 57511 }, // ⁮
-    { 8, 25, 5, -4, 21, 50, 57561 }, // ⁯
-    { 11, 14, 14, 2, 25, 39, 57611 }, // ⁰
-    { 6, 14, 9, 2, 22, 21, 57650 }, // ⁱ
-    { 12, 13, 14, 1, 25, 39, 57671 }, // ⁴
-    { 11, 14, 14, 2, 25, 39, 57710 }, // ⁵
-    { 11, 14, 14, 2, 25, 39, 57749 }, // ⁶
-    { 12, 13, 15, 2, 25, 39, 57788 }, // ⁷
-    { 11, 14, 14, 2, 25, 39, 57827 }, // ⁸
-    { 11, 14, 14, 2, 25, 39, 57866 }, // ⁹
-    { 9, 9, 13, 3, 22, 21, 57905 }, // ⁺
-    { 9, 3, 13, 3, 19, 7, 57926 }, // ⁻
-    { 10, 7, 14, 3, 21, 18, 57933 }, // ⁼
-    { 8, 17, 12, 3, 26, 34, 57951 }, // ⁽
-    { 8, 17, 9, 0, 26, 34, 57985 }, // ⁾
-    { 12, 11, 14, 1, 19, 33, 58019 }, // ⁿ
-    { 11, 14, 11, -1, 9, 39, 58052 }, // ₀
-    { 10, 13, 11, -1, 9, 33, 58091 }, // ₁
-    { 12, 13, 11, -2, 9, 39, 58124 }, // ₂
-    { 11, 14, 11, -2, 9, 39, 58163 }, // ₃
-    { 12, 13, 11, -2, 9, 39, 58202 }, // ₄
-    { 11, 14, 11, -1, 9, 39, 58241 }, // ₅
-    { 11, 14, 11, -1, 9, 39, 58280 }, // ₆
-    { 12, 13, 12, -1, 9, 39, 58319 }, // ₇
-    { 12, 14, 11, -2, 9, 42, 58358 }, // ₈
-    { 11, 14, 11, -1, 9, 39, 58400 }, // ₉
-    { 9, 9, 11, 0, 7, 21, 58439 }, // ₊
-    { 9, 3, 11, 0, 4, 7, 58460 }, // ₋
-    { 9, 7, 12, 0, 6, 16, 58467 }, // ₌
-    { 8, 17, 9, 0, 11, 34, 58483 }, // ₍
-    { 7, 17, 7, -3, 11, 30, 58517 }, // ₎
-    { 11, 10, 11, -1, 7, 28, 58547 }, // ₐ
-    { 10, 10, 10, -1, 7, 25, 58575 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 58600 }, // ₒ
-    { 13, 10, 11, -3, 7, 33, 58625 }, // ₓ
-    { 11, 10, 10, -2, 7, 28, 58658 }, // ₔ
-    { 12, 14, 13, -1, 11, 42, 58686 }, // ₕ
-    { 13, 14, 13, -1, 11, 46, 58728 }, // ₖ
-    { 7, 14, 7, -1, 11, 25, 58774 }, // ₗ
-    { 17, 10, 19, -1, 7, 43, 58799 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 58842 }, // ₙ
-    { 12, 14, 11, -3, 7, 42, 58870 }, // ₚ
-    { 9, 10, 10, -1, 7, 23, 58912 }, // ₛ
-    { 8, 12, 8, -1, 9, 24, 58935 }, // ₜ
-    { 17, 22, 19, 1, 22, 94, 58959 }, // ₠
-    { 19, 25, 20, 0, 23, 119, 59053 }, // ₡
-    { 18, 23, 19, 0, 22, 104, 59172 }, // ₢
-    { 18, 21, 19, 0, 21, 95, 59276 }, // ₣
-    { 19, 22, 19, -1, 22, 105, 59371 }, // ₤
-    { 25, 24, 26, 0, 20, 150, 59476 }, // ₥
-    { 18, 21, 19, 0, 21, 95, 59626 }, // ₦
-    { 25, 22, 26, 0, 21, 138, 59721 }, // ₧
-    { 27, 22, 28, 0, 21, 149, 59859 }, // ₨
-    { 23, 21, 24, 0, 21, 121, 60008 }, // ₩
-    { 26, 21, 27, 0, 21, 137, 60129 }, // ₪
-    { 20, 28, 21, 0, 23, 140, 60266 }, // ₫
-    { 18, 23, 19, 0, 22, 104, 60406 }, // €
-    { 20, 21, 21, 0, 21, 105, 60510 }, // ₭
-    { 17, 21, 19, 1, 21, 90, 60615 }, // ₮
-    { 29, 29, 30, 0, 22, 211, 60705 }, // ₯
-    { 20, 29, 19, -2, 22, 145, 60916 }, // ₰
-    { 18, 21, 19, 0, 21, 95, 61061 }, // ₱
-    { 19, 26, 21, 1, 23, 124, 61156 }, // ₲
-    { 21, 21, 20, -2, 21, 111, 61280 }, // ₳
-    { 18, 23, 19, 0, 22, 104, 61391 }, // ₴
-    { 19, 26, 21, 1, 23, 124, 61495 }, // ₵
-    { 21, 21, 22, 0, 20, 111, 61619 }, // ₶
-    { 22, 25, 22, -1, 22, 138, 61730 }, // ₷
-    { 17, 21, 19, 1, 21, 90, 61868 }, // ₸
-    { 15, 21, 18, 2, 21, 79, 61958 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 62037 }, // ₺
-    { 19, 23, 21, 1, 22, 110, 62125 }, // ₻
-    { 24, 21, 24, -1, 21, 126, 62235 }, // ₼
-    { 19, 21, 19, -1, 21, 100, 62361 }, // ₽
-    { 20, 24, 20, -1, 24, 120, 62461 }, // ₾
-    { 17, 27, 18, 0, 24, 115, 62581 }, // ₿
-    { 9, 4, 10, 0, 10, 9, 62696 }, // −
-    { 27, 28, 29, 1, 23, 189, 62705 }, // �
+    { 10, 22, 11, 0, 21, 32, 0 }, // !
+    { 12, 8, 15, 2, 21, 26, 32 }, // "
+    { 19, 21, 20, 0, 21, 72, 58 }, // #
+    { 16, 25, 17, 0, 23, 69, 130 }, // $
+    { 23, 23, 25, 1, 22, 102, 199 }, // %
+    { 21, 23, 22, 0, 22, 76, 301 }, // &
+    { 6, 8, 9, 2, 21, 14, 377 }, // '
+    { 11, 26, 13, 1, 21, 38, 391 }, // (
+    { 12, 27, 10, -3, 22, 42, 429 }, // )
+    { 15, 15, 18, 2, 23, 43, 471 }, // *
+    { 15, 15, 17, 1, 18, 33, 514 }, // +
+    { 8, 8, 8, -2, 4, 13, 547 }, // ,
+    { 9, 4, 10, 0, 10, 11, 560 }, // -
+    { 6, 6, 8, 0, 5, 9, 571 }, // .
+    { 17, 22, 16, -2, 21, 43, 580 }, // /
+    { 16, 23, 17, 0, 22, 66, 623 }, // 0
+    { 13, 21, 16, 2, 21, 40, 689 }, // 1
+    { 17, 22, 17, -1, 22, 60, 729 }, // 2
+    { 16, 23, 17, 0, 22, 59, 789 }, // 3
+    { 17, 21, 17, -1, 21, 59, 848 }, // 4
+    { 17, 22, 18, 0, 21, 59, 907 }, // 5
+    { 16, 23, 18, 1, 22, 66, 966 }, // 6
+    { 17, 21, 19, 1, 21, 49, 1032 }, // 7
+    { 17, 23, 18, 0, 22, 65, 1081 }, // 8
+    { 15, 23, 17, 1, 22, 65, 1146 }, // 9
+    { 8, 18, 9, 0, 17, 22, 1211 }, // :
+    { 10, 21, 9, -2, 17, 27, 1233 }, // ;
+    { 15, 17, 17, 1, 19, 41, 1260 }, // <
+    { 15, 10, 17, 1, 15, 33, 1301 }, // =
+    { 15, 17, 17, 1, 19, 42, 1334 }, // >
+    { 13, 23, 16, 2, 22, 43, 1376 }, // ?
+    { 24, 24, 26, 1, 21, 115, 1419 }, // @
+    { 19, 21, 18, -2, 21, 66, 1534 }, // A
+    { 18, 21, 19, 0, 21, 63, 1600 }, // B
+    { 19, 23, 21, 1, 22, 59, 1663 }, // C
+    { 19, 21, 20, 0, 21, 65, 1722 }, // D
+    { 17, 21, 18, 0, 21, 53, 1787 }, // E
+    { 17, 21, 18, 0, 21, 47, 1840 }, // F
+    { 19, 23, 21, 1, 22, 75, 1887 }, // G
+    { 21, 21, 22, 0, 21, 68, 1962 }, // H
+    { 14, 21, 14, -1, 21, 44, 2030 }, // I
+    { 15, 28, 11, -5, 21, 58, 2074 }, // J
+    { 21, 21, 22, 0, 21, 69, 2132 }, // K
+    { 14, 21, 15, 0, 21, 46, 2201 }, // L
+    { 26, 21, 27, 0, 21, 106, 2247 }, // M
+    { 23, 21, 24, 0, 21, 82, 2353 }, // N
+    { 20, 23, 22, 1, 22, 76, 2435 }, // O
+    { 18, 21, 19, 0, 21, 56, 2511 }, // P
+    { 20, 27, 22, 1, 22, 84, 2567 }, // Q
+    { 18, 21, 19, 0, 21, 64, 2651 }, // R
+    { 16, 23, 17, 0, 22, 61, 2715 }, // S
+    { 16, 21, 19, 2, 21, 46, 2776 }, // T
+    { 20, 22, 22, 1, 21, 68, 2822 }, // U
+    { 18, 21, 21, 2, 21, 62, 2890 }, // V
+    { 27, 21, 30, 2, 21, 105, 2952 }, // W
+    { 23, 21, 22, -2, 21, 68, 3057 }, // X
+    { 18, 21, 21, 2, 21, 54, 3125 }, // Y
+    { 19, 21, 19, -1, 21, 58, 3179 }, // Z
+    { 13, 26, 13, -1, 21, 53, 3237 }, // [
+    { 8, 22, 12, 3, 21, 31, 3290 }, // <backslash>
+    { 13, 26, 12, -2, 21, 51, 3321 }, // ]
+    { 16, 14, 17, 0, 21, 39, 3372 }, // ^
+    { 13, 3, 12, -3, -2, 16, 3411 }, // _
+    { 7, 6, 12, 4, 23, 10, 3427 }, // `
+    { 16, 18, 18, 1, 17, 56, 3437 }, // a
+    { 17, 24, 18, 0, 23, 65, 3493 }, // b
+    { 14, 18, 16, 1, 17, 43, 3558 }, // c
+    { 18, 24, 20, 1, 23, 69, 3601 }, // d
+    { 15, 18, 17, 1, 17, 49, 3670 }, // e
+    { 19, 30, 16, -4, 23, 71, 3719 }, // f
+    { 17, 24, 18, 0, 17, 74, 3790 }, // g
+    { 17, 23, 18, 0, 23, 62, 3864 }, // h
+    { 10, 23, 11, 0, 23, 33, 3926 }, // i
+    { 14, 30, 11, -4, 23, 58, 3959 }, // j
+    { 18, 23, 19, 0, 23, 62, 4017 }, // k
+    { 10, 23, 11, 0, 23, 34, 4079 }, // l
+    { 25, 17, 26, 0, 17, 78, 4113 }, // m
+    { 17, 17, 18, 0, 17, 51, 4191 }, // n
+    { 15, 18, 17, 1, 17, 51, 4242 }, // o
+    { 18, 24, 18, -1, 17, 67, 4293 }, // p
+    { 16, 24, 18, 1, 17, 69, 4360 }, // q
+    { 14, 17, 15, 0, 17, 37, 4429 }, // r
+    { 14, 18, 15, 0, 17, 43, 4466 }, // s
+    { 12, 21, 14, 1, 20, 40, 4509 }, // t
+    { 17, 17, 19, 1, 16, 52, 4549 }, // u
+    { 16, 16, 18, 1, 16, 42, 4601 }, // v
+    { 24, 16, 26, 1, 16, 74, 4643 }, // w
+    { 19, 16, 18, -2, 16, 47, 4717 }, // x
+    { 20, 23, 18, -3, 16, 64, 4764 }, // y
+    { 15, 16, 15, -1, 16, 41, 4828 }, // z
+    { 14, 26, 14, -1, 21, 55, 4869 }, // {
+    { 4, 30, 16, 6, 23, 45, 4924 }, // |
+    { 13, 26, 12, -2, 21, 51, 4969 }, // }
+    { 15, 6, 17, 1, 13, 20, 5020 }, // ~
+    { 0, 0, 8, 0, 0, 0, 5040 }, //  
+    { 10, 22, 9, -2, 16, 35, 5040 }, // ¡
+    { 14, 23, 17, 2, 22, 53, 5075 }, // ¢
+    { 19, 22, 19, -1, 22, 62, 5128 }, // £
+    { 15, 14, 17, 1, 17, 41, 5190 }, // ¤
+    { 18, 21, 20, 1, 21, 62, 5231 }, // ¥
+    { 4, 30, 16, 6, 23, 39, 5293 }, // ¦
+    { 15, 24, 16, 0, 23, 65, 5332 }, // §
+    { 11, 4, 17, 5, 22, 14, 5397 }, // ¨
+    { 22, 23, 24, 1, 22, 103, 5411 }, // ©
+    { 11, 12, 14, 2, 22, 30, 5514 }, // ª
+    { 16, 14, 18, 1, 15, 42, 5544 }, // «
+    { 15, 9, 17, 1, 12, 29, 5586 }, // ¬
+    { 9, 4, 10, 0, 10, 11, 5615 }, // ­
+    { 22, 23, 24, 1, 22, 110, 5626 }, // ®
+    { 15, 4, 18, 2, 26, 9, 5736 }, // ¯
+    { 11, 11, 13, 1, 22, 27, 5745 }, // °
+    { 15, 19, 17, 1, 19, 46, 5772 }, // ±
+    { 12, 13, 14, 1, 25, 25, 5818 }, // ²
+    { 11, 14, 14, 2, 25, 29, 5843 }, // ³
+    { 9, 6, 13, 3, 23, 12, 5872 }, // ´
+    { 19, 23, 19, -1, 16, 65, 5884 }, // µ
+    { 16, 27, 19, 2, 23, 89, 5949 }, // ¶
+    { 7, 6, 9, 1, 13, 10, 6038 }, // ·
+    { 7, 7, 6, -3, 0, 13, 6048 }, // ¸
+    { 10, 13, 13, 2, 25, 24, 6061 }, // ¹
+    { 10, 11, 13, 2, 21, 29, 6085 }, // º
+    { 16, 14, 17, 0, 15, 44, 6114 }, // »
+    { 22, 21, 25, 2, 21, 91, 6158 }, // ¼
+    { 23, 21, 26, 2, 21, 85, 6249 }, // ½
+    { 24, 21, 26, 1, 21, 103, 6334 }, // ¾
+    { 13, 23, 14, -1, 17, 44, 6437 }, // ¿
+    { 19, 28, 18, -2, 28, 81, 6481 }, // À
+    { 20, 28, 19, -2, 28, 82, 6562 }, // Á
+    { 20, 28, 19, -2, 28, 87, 6644 }, // Â
+    { 21, 28, 20, -2, 28, 87, 6731 }, // Ã
+    { 20, 27, 19, -2, 27, 84, 6818 }, // Ä
+    { 19, 30, 18, -2, 30, 88, 6902 }, // Å
+    { 30, 21, 29, -2, 21, 90, 6990 }, // Æ
+    { 19, 29, 21, 1, 22, 73, 7080 }, // Ç
+    { 17, 28, 18, 0, 28, 68, 7153 }, // È
+    { 17, 28, 18, 0, 28, 69, 7221 }, // É
+    { 17, 28, 18, 0, 28, 71, 7290 }, // Ê
+    { 17, 27, 18, 0, 27, 68, 7361 }, // Ë
+    { 14, 28, 14, -1, 28, 58, 7429 }, // Ì
+    { 16, 28, 16, -1, 28, 63, 7487 }, // Í
+    { 16, 28, 16, -1, 28, 64, 7550 }, // Î
+    { 15, 27, 15, -1, 27, 61, 7614 }, // Ï
+    { 19, 21, 20, 0, 21, 70, 7675 }, // Ð
+    { 23, 28, 24, 0, 28, 102, 7745 }, // Ñ
+    { 20, 29, 22, 1, 28, 91, 7847 }, // Ò
+    { 20, 29, 22, 1, 28, 91, 7938 }, // Ó
+    { 20, 29, 22, 1, 28, 96, 8029 }, // Ô
+    { 20, 29, 22, 1, 28, 96, 8125 }, // Õ
+    { 20, 28, 22, 1, 27, 94, 8221 }, // Ö
+    { 14, 14, 17, 2, 17, 37, 8315 }, // ×
+    { 20, 24, 22, 1, 22, 88, 8352 }, // Ø
+    { 20, 29, 22, 1, 28, 82, 8440 }, // Ù
+    { 20, 29, 22, 1, 28, 82, 8522 }, // Ú
+    { 20, 29, 22, 1, 28, 90, 8604 }, // Û
+    { 20, 28, 22, 1, 27, 85, 8694 }, // Ü
+    { 18, 28, 21, 2, 28, 68, 8779 }, // Ý
+    { 17, 21, 18, 0, 21, 56, 8847 }, // Þ
+    { 23, 30, 20, -4, 23, 103, 8903 }, // ß
+    { 16, 24, 18, 1, 23, 69, 9006 }, // à
+    { 16, 24, 18, 1, 23, 70, 9075 }, // á
+    { 16, 24, 18, 1, 23, 73, 9145 }, // â
+    { 17, 24, 19, 1, 23, 73, 9218 }, // ã
+    { 16, 23, 18, 1, 22, 70, 9291 }, // ä
+    { 16, 26, 18, 1, 25, 78, 9361 }, // å
+    { 24, 18, 26, 1, 17, 82, 9439 }, // æ
+    { 14, 24, 16, 1, 17, 56, 9521 }, // ç
+    { 15, 24, 17, 1, 23, 62, 9577 }, // è
+    { 15, 24, 17, 1, 23, 64, 9639 }, // é
+    { 16, 24, 18, 1, 23, 65, 9703 }, // ê
+    { 15, 23, 17, 1, 22, 62, 9768 }, // ë
+    { 9, 23, 10, 0, 23, 36, 9830 }, // ì
+    { 12, 23, 13, 0, 23, 38, 9866 }, // í
+    { 12, 23, 13, 0, 23, 41, 9904 }, // î
+    { 12, 22, 13, 0, 22, 39, 9945 }, // ï
+    { 16, 24, 18, 1, 23, 68, 9984 }, // ð
+    { 18, 23, 19, 0, 23, 68, 10052 }, // ñ
+    { 15, 24, 17, 1, 23, 64, 10120 }, // ò
+    { 15, 24, 17, 1, 23, 66, 10184 }, // ó
+    { 15, 24, 17, 1, 23, 66, 10250 }, // ô
+    { 16, 24, 18, 1, 23, 70, 10316 }, // õ
+    { 15, 23, 17, 1, 22, 65, 10386 }, // ö
+    { 15, 15, 17, 1, 18, 40, 10451 }, // ÷
+    { 17, 19, 18, 0, 17, 64, 10491 }, // ø
+    { 17, 24, 19, 1, 23, 66, 10555 }, // ù
+    { 17, 24, 19, 1, 23, 67, 10621 }, // ú
+    { 17, 24, 19, 1, 23, 71, 10688 }, // û
+    { 17, 23, 19, 1, 22, 67, 10759 }, // ü
+    { 20, 30, 18, -3, 23, 79, 10826 }, // ý
+    { 18, 30, 18, -1, 23, 78, 10905 }, // þ
+    { 20, 29, 18, -3, 22, 81, 10983 }, // ÿ
+    { 20, 26, 19, -2, 26, 84, 11064 }, // Ā
+    { 16, 22, 18, 1, 21, 70, 11148 }, // ā
+    { 20, 28, 19, -2, 28, 87, 11218 }, // Ă
+    { 16, 24, 18, 1, 23, 71, 11305 }, // ă
+    { 19, 29, 18, -2, 21, 85, 11376 }, // Ą
+    { 16, 25, 18, 1, 17, 72, 11461 }, // ą
+    { 19, 29, 21, 1, 28, 72, 11533 }, // Ć
+    { 15, 24, 17, 1, 23, 60, 11605 }, // ć
+    { 19, 29, 21, 1, 28, 79, 11665 }, // Ĉ
+    { 15, 24, 17, 1, 23, 61, 11744 }, // ĉ
+    { 19, 29, 21, 1, 28, 70, 11805 }, // Ċ
+    { 14, 24, 16, 1, 23, 52, 11875 }, // ċ
+    { 19, 29, 21, 1, 28, 76, 11927 }, // Č
+    { 16, 24, 18, 1, 23, 64, 12003 }, // č
+    { 20, 28, 21, 0, 28, 85, 12067 }, // Ď
+    { 24, 24, 26, 1, 23, 85, 12152 }, // ď
+    { 19, 21, 20, 0, 21, 70, 12237 }, // Đ
+    { 19, 24, 21, 1, 23, 72, 12307 }, // đ
+    { 17, 26, 18, 0, 26, 68, 12379 }, // Ē
+    { 15, 22, 17, 1, 21, 62, 12447 }, // ē
+    { 18, 28, 19, 0, 28, 70, 12509 }, // Ĕ
+    { 15, 24, 17, 1, 23, 66, 12579 }, // ĕ
+    { 17, 28, 18, 0, 28, 65, 12645 }, // Ė
+    { 15, 24, 17, 1, 23, 58, 12710 }, // ė
+    { 17, 29, 18, 0, 21, 68, 12768 }, // Ę
+    { 15, 24, 17, 1, 17, 60, 12836 }, // ę
+    { 19, 28, 20, 0, 28, 74, 12896 }, // Ě
+    { 17, 24, 19, 1, 23, 68, 12970 }, // ě
+    { 19, 29, 21, 1, 28, 95, 13038 }, // Ĝ
+    { 17, 30, 18, 0, 23, 91, 13133 }, // ĝ
+    { 19, 29, 21, 1, 28, 92, 13224 }, // Ğ
+    { 17, 30, 18, 0, 23, 90, 13316 }, // ğ
+    { 19, 29, 21, 1, 28, 86, 13406 }, // Ġ
+    { 17, 30, 18, 0, 23, 84, 13492 }, // ġ
+    { 19, 29, 21, 1, 22, 87, 13576 }, // Ģ
+    { 17, 30, 18, 0, 23, 88, 13663 }, // ģ
+    { 21, 28, 22, 0, 28, 90, 13751 }, // Ĥ
+    { 17, 29, 18, 0, 29, 81, 13841 }, // ĥ
+    { 23, 21, 24, 0, 21, 68, 13922 }, // Ħ
+    { 16, 23, 18, 0, 23, 62, 13990 }, // ħ
+    { 16, 28, 16, -1, 28, 63, 14052 }, // Ĩ
+    { 13, 23, 14, 0, 23, 41, 14115 }, // ĩ
+    { 15, 26, 15, -1, 26, 60, 14156 }, // Ī
+    { 12, 21, 13, 0, 21, 39, 14216 }, // ī
+    { 16, 28, 16, -1, 28, 62, 14255 }, // Ĭ
+    { 13, 23, 14, 0, 23, 40, 14317 }, // ĭ
+    { 14, 29, 14, -1, 21, 59, 14357 }, // Į
+    { 12, 31, 11, -2, 23, 48, 14416 }, // į
+    { 14, 28, 14, -1, 28, 54, 14464 }, // İ
+    { 9, 16, 10, 0, 16, 25, 14518 }, // ı
+    { 23, 28, 23, -1, 21, 89, 14543 }, // Ĳ
+    { 19, 30, 20, 0, 23, 81, 14632 }, // ĳ
+    { 19, 35, 15, -5, 28, 81, 14713 }, // Ĵ
+    { 16, 30, 13, -4, 23, 68, 14794 }, // ĵ
+    { 21, 28, 22, 0, 21, 84, 14862 }, // Ķ
+    { 18, 30, 19, 0, 23, 75, 14946 }, // ķ
+    { 18, 16, 19, 0, 16, 48, 15021 }, // ĸ
+    { 15, 28, 16, 0, 28, 63, 15069 }, // Ĺ
+    { 14, 29, 15, 0, 29, 58, 15132 }, // ĺ
+    { 14, 28, 15, 0, 21, 58, 15190 }, // Ļ
+    { 12, 30, 11, -2, 23, 44, 15248 }, // ļ
+    { 17, 21, 18, 0, 21, 52, 15292 }, // Ľ
+    { 16, 23, 17, 0, 23, 51, 15344 }, // ľ
+    { 15, 21, 16, 0, 21, 51, 15395 }, // Ŀ
+    { 14, 23, 15, 0, 23, 49, 15446 }, // ŀ
+    { 15, 21, 15, -1, 21, 50, 15495 }, // Ł
+    { 11, 23, 12, 0, 23, 39, 15545 }, // ł
+    { 23, 28, 24, 0, 28, 100, 15584 }, // Ń
+    { 17, 23, 18, 0, 23, 64, 15684 }, // ń
+    { 23, 28, 24, 0, 21, 97, 15748 }, // Ņ
+    { 17, 24, 18, 0, 17, 64, 15845 }, // ņ
+    { 23, 28, 24, 0, 28, 105, 15909 }, // Ň
+    { 18, 23, 19, 0, 23, 68, 16014 }, // ň
+    { 20, 21, 21, 0, 21, 66, 16082 }, // ŉ
+    { 23, 28, 24, 0, 21, 99, 16148 }, // Ŋ
+    { 17, 24, 18, 0, 17, 68, 16247 }, // ŋ
+    { 20, 27, 22, 1, 26, 92, 16315 }, // Ō
+    { 15, 22, 17, 1, 21, 64, 16407 }, // ō
+    { 20, 29, 22, 1, 28, 94, 16471 }, // Ŏ
+    { 16, 24, 18, 1, 23, 69, 16565 }, // ŏ
+    { 22, 29, 24, 1, 28, 101, 16634 }, // Ő
+    { 19, 24, 21, 1, 23, 76, 16735 }, // ő
+    { 27, 23, 29, 1, 22, 91, 16811 }, // Œ
+    { 24, 18, 26, 1, 17, 80, 16902 }, // œ
+    { 18, 28, 19, 0, 28, 79, 16982 }, // Ŕ
+    { 15, 23, 16, 0, 23, 51, 17061 }, // ŕ
+    { 18, 28, 19, 0, 21, 77, 17112 }, // Ŗ
+    { 15, 24, 15, -1, 17, 51, 17189 }, // ŗ
+    { 19, 28, 20, 0, 28, 83, 17240 }, // Ř
+    { 16, 23, 17, 0, 23, 55, 17323 }, // ř
+    { 17, 29, 18, 0, 28, 76, 17378 }, // Ś
+    { 15, 24, 16, 0, 23, 61, 17454 }, // ś
+    { 17, 29, 18, 0, 28, 78, 17515 }, // Ŝ
+    { 15, 24, 16, 0, 23, 61, 17593 }, // ŝ
+    { 16, 29, 17, 0, 22, 76, 17654 }, // Ş
+    { 14, 24, 15, 0, 17, 56, 17730 }, // ş
+    { 18, 29, 19, 0, 28, 80, 17786 }, // Š
+    { 16, 24, 17, 0, 23, 65, 17866 }, // š
+    { 16, 28, 19, 2, 21, 64, 17931 }, // Ţ
+    { 12, 27, 14, 1, 20, 52, 17995 }, // ţ
+    { 16, 28, 19, 2, 28, 64, 18047 }, // Ť
+    { 15, 24, 17, 1, 23, 57, 18111 }, // ť
+    { 16, 21, 19, 2, 21, 50, 18168 }, // Ŧ
+    { 13, 21, 14, 0, 20, 45, 18218 }, // ŧ
+    { 20, 29, 22, 1, 28, 86, 18263 }, // Ũ
+    { 17, 24, 19, 1, 23, 69, 18349 }, // ũ
+    { 20, 27, 22, 1, 26, 85, 18418 }, // Ū
+    { 17, 22, 19, 1, 21, 67, 18503 }, // ū
+    { 20, 29, 22, 1, 28, 87, 18570 }, // Ŭ
+    { 17, 24, 19, 1, 23, 69, 18657 }, // ŭ
+    { 20, 31, 22, 1, 30, 92, 18726 }, // Ů
+    { 17, 26, 19, 1, 25, 77, 18818 }, // ů
+    { 21, 29, 23, 1, 28, 93, 18895 }, // Ű
+    { 19, 24, 21, 1, 23, 76, 18988 }, // ű
+    { 20, 29, 22, 1, 21, 84, 19064 }, // Ų
+    { 17, 24, 19, 1, 16, 69, 19148 }, // ų
+    { 27, 28, 30, 2, 28, 130, 19217 }, // Ŵ
+    { 24, 23, 26, 1, 23, 96, 19347 }, // ŵ
+    { 18, 28, 21, 2, 28, 74, 19443 }, // Ŷ
+    { 20, 30, 18, -3, 23, 86, 19517 }, // ŷ
+    { 18, 27, 21, 2, 27, 70, 19603 }, // Ÿ
+    { 19, 28, 19, -1, 28, 73, 19673 }, // Ź
+    { 16, 23, 16, -1, 23, 57, 19746 }, // ź
+    { 19, 28, 19, -1, 28, 70, 19803 }, // Ż
+    { 15, 23, 15, -1, 23, 52, 19873 }, // ż
+    { 19, 28, 19, -1, 28, 77, 19925 }, // Ž
+    { 17, 23, 17, -1, 23, 60, 20002 }, // ž
+    { 18, 30, 15, -4, 23, 68, 20062 }, // ſ
+    { 25, 24, 27, 1, 23, 83, 20130 }, // Ơ
+    { 21, 20, 23, 1, 19, 66, 20213 }, // ơ
+    { 29, 23, 32, 1, 22, 110, 20279 }, // Ƣ
+    { 24, 24, 26, 1, 17, 95, 20389 }, // ƣ
+    { 21, 21, 23, 1, 21, 65, 20484 }, // Ƥ
+    { 18, 30, 18, -1, 23, 83, 20549 }, // ƥ
+    { 17, 24, 18, 0, 21, 67, 20632 }, // Ʀ
+    { 16, 23, 17, 0, 22, 57, 20699 }, // Ƨ
+    { 14, 18, 15, 0, 17, 44, 20756 }, // ƨ
+    { 19, 21, 19, -1, 21, 54, 20800 }, // Ʃ
+    { 10, 30, 11, 0, 23, 53, 20854 }, // ƪ
+    { 12, 27, 14, 1, 20, 50, 20907 }, // ƫ
+    { 18, 21, 20, 1, 21, 53, 20957 }, // Ƭ
+    { 12, 24, 14, 1, 23, 48, 21010 }, // ƭ
+    { 16, 28, 19, 2, 21, 64, 21058 }, // Ʈ
+    { 25, 24, 28, 2, 23, 83, 21122 }, // Ư
+    { 23, 20, 25, 1, 19, 69, 21205 }, // ư
+    { 8, 6, 0, -13, 23, 11, 21274 }, // ̀
+    { 9, 6, 3, -7, 23, 12, 21285 }, // ́
+    { 12, 6, 9, -4, 23, 17, 21297 }, // ̂
+    { 13, 6, 1, -13, 23, 17, 21314 }, // ̃
+    { 10, 4, 8, -3, 21, 14, 21331 }, // ̄
+    { 14, 4, 11, -4, 25, 18, 21345 }, // ̅
+    { 11, 6, 9, -3, 23, 17, 21363 }, // ̆
+    { 5, 6, 6, 0, 23, 6, 21380 }, // ̇
+    { 11, 4, 9, -3, 22, 14, 21386 }, // ̈
+    { 7, 8, 0, -9, 25, 15, 21400 }, // ̉
+    { 8, 8, 8, -1, 25, 19, 21415 }, // ̊
+    { 14, 6, 12, -3, 23, 21, 21434 }, // ̋
+    { 12, 6, 10, -3, 23, 17, 21455 }, // ̌
+    { 5, 9, 6, 0, 23, 15, 21472 }, // ̍
+    { 10, 6, 9, -2, 23, 22, 21487 }, // ̎
+    { 12, 6, 0, -14, 23, 20, 21509 }, // ̏
+    { 11, 8, 9, -3, 25, 23, 21529 }, // ̐
+    { 11, 6, 9, -3, 23, 16, 21552 }, // ̑
+    { 8, 8, 7, -2, 21, 13, 21568 }, // ̒
+    { 8, 8, 7, -2, 21, 12, 21581 }, // ̓
+    { 5, 8, 6, 0, 21, 11, 21593 }, // ̔
+    { 8, 8, 7, -2, 21, 12, 21604 }, // ̕
+    { 7, 6, 2, -6, -1, 11, 21616 }, // ̖
+    { 9, 6, 3, -7, -1, 11, 21627 }, // ̗
+    { 7, 7, 2, -6, 0, 12, 21638 }, // ̘
+    { 7, 7, 2, -6, 0, 13, 21650 }, // ̙
+    { 10, 9, 13, 2, 23, 16, 21663 }, // ̚
+    { 9, 8, 8, -2, 23, 14, 21679 }, // ̛
+    { 5, 7, 4, -2, 0, 13, 21693 }, // ̜
+    { 7, 6, 2, -6, -1, 10, 21706 }, // ̝
+    { 8, 6, 3, -6, -1, 12, 21716 }, // ̞
+    { 7, 7, 2, -6, 0, 11, 21728 }, // ̟
+    { 7, 3, 2, -6, -3, 6, 21739 }, // ̠
+    { 9, 9, 3, -7, 2, 16, 21745 }, // ̡
+    { 8, 9, 5, -4, 2, 16, 21761 }, // ̢
+    { 6, 6, 0, -14, -1, 6, 21777 }, // ̣
+    { 11, 4, 4, -8, -2, 14, 21783 }, // ̤
+    { 8, 8, 3, -6, 0, 17, 21797 }, // ̥
+    { 7, 6, 9, 1, -1, 9, 21814 }, // ̦
+    { 8, 7, 3, -6, 0, 13, 21823 }, // ̧
+    { 7, 8, 2, -6, 0, 10, 21836 }, // ̨
+    { 6, 9, 2, -5, 0, 15, 21846 }, // ̩
+    { 13, 6, 5, -9, -1, 20, 21861 }, // ̪
+    { 12, 5, 5, -8, -1, 13, 21881 }, // ̫
+    { 13, 6, 6, -8, -1, 18, 21894 }, // ̬
+    { 13, 6, 5, -9, -1, 16, 21912 }, // ̭
+    { 12, 6, 5, -8, -1, 16, 21928 }, // ̮
+    { 11, 6, 4, -8, -1, 17, 21944 }, // ̯
+    { 13, 6, 5, -9, -1, 16, 21961 }, // ̰
+    { 11, 4, 4, -8, -2, 14, 21977 }, // ̱
+    { 14, 3, 6, -9, -2, 17, 21991 }, // ̲
+    { 14, 7, 5, -10, 0, 32, 22008 }, // ̳
+    { 13, 6, 7, -7, 11, 17, 22040 }, // ̴
+    { 13, 4, 7, -7, 10, 18, 22057 }, // ̵
+    { 22, 4, 12, -11, 10, 12, 22075 }, // ̶
+    { 12, 9, 7, -6, 13, 17, 22087 }, // ̷
+    { 18, 25, 10, -9, 23, 52, 22104 }, // ̸
+    { 6, 7, 4, -3, 0, 11, 22156 }, // ̹
+    { 12, 6, 5, -8, -1, 23, 22167 }, // ̺
+    { 12, 7, 5, -8, 0, 23, 22190 }, // ̻
+    { 12, 5, 5, -8, -1, 14, 22213 }, // ̼
+    { 8, 7, 8, -1, 23, 12, 22227 }, // ̽
+    { 7, 10, 7, -1, 26, 14, 22239 }, // ̾
+    { 14, 7, 11, -4, 29, 32, 22253 }, // ̿
+    { 7, 6, 5, -3, 23, 11, 22285 }, // ̀
+    { 8, 6, 9, 0, 23, 13, 22296 }, // ́
+    { 13, 6, 18, 4, 23, 16, 22309 }, // ͂
+    { 6, 6, 7, 0, 23, 10, 22325 }, // ̓
+    { 17, 6, 13, -5, 23, 23, 22335 }, // ̈́
+    { 6, 6, 3, -4, -1, 9, 22358 }, // ͅ
+    { 13, 6, 10, -4, 23, 18, 22367 }, // ͆
+    { 14, 7, 5, -10, 0, 32, 22385 }, // ͇
+    { 10, 6, 4, -7, 0, 22, 22417 }, // ͈
+    { 6, 6, 2, -5, -1, 11, 22439 }, // ͉
+    { 11, 7, 9, -3, 23, 21, 22450 }, // ͊
+    { 12, 12, 10, -3, 28, 29, 22471 }, // ͋
+    { 12, 9, 10, -3, 26, 24, 22500 }, // ͌
+    { 11, 6, 4, -8, -1, 17, 22524 }, // ͍
+    { 6, 7, 2, -5, 0, 11, 22541 }, // ͎
+    { 22, 21, 12, -11, 21, 95, 22552 }, // ͏
+    { 5, 7, 6, 0, 24, 9, 22647 }, // ͐
+    { 6, 7, 10, 3, 25, 11, 22656 }, // ͑
+    { 11, 8, 9, -3, 25, 21, 22667 }, // ͒
+    { 7, 7, 3, -5, 0, 10, 22688 }, // ͓
+    { 6, 6, 2, -5, -1, 11, 22698 }, // ͔
+    { 6, 6, 3, -4, -1, 11, 22709 }, // ͕
+    { 12, 6, 6, -7, -1, 23, 22720 }, // ͖
+    { 6, 7, 9, 2, 24, 11, 22743 }, // ͗
+    { 5, 6, 6, 0, 23, 5, 22754 }, // ͘
+    { 7, 6, 2, -6, -1, 15, 22759 }, // ͙
+    { 12, 7, 5, -8, 0, 25, 22774 }, // ͚
+    { 6, 6, 7, 0, 23, 11, 22799 }, // ͛
+    { 23, 6, 11, -13, -1, 24, 22810 }, // ͜
+    { 23, 6, 15, -9, 23, 23, 22834 }, // ͝
+    { 17, 4, 12, -6, 21, 22, 22857 }, // ͞
+    { 16, 4, 7, -10, -1, 22, 22879 }, // ͟
+    { 24, 6, 16, -9, 23, 24, 22901 }, // ͠
+    { 23, 7, 16, -8, 26, 25, 22925 }, // ͡
+    { 24, 7, 10, -15, 0, 27, 22950 }, // ͢
+    { 8, 8, 8, -1, 25, 20, 22977 }, // ͣ
+    { 8, 8, 8, -1, 25, 16, 22997 }, // ͤ
+    { 5, 9, 7, 1, 27, 14, 23013 }, // ͥ
+    { 8, 8, 8, -1, 25, 18, 23027 }, // ͦ
+    { 8, 8, 8, -1, 25, 20, 23045 }, // ͧ
+    { 7, 8, 8, 0, 25, 14, 23065 }, // ͨ
+    { 9, 10, 9, -1, 27, 23, 23079 }, // ͩ
+    { 8, 9, 8, -1, 27, 23, 23102 }, // ͪ
+    { 12, 7, 10, -3, 25, 31, 23125 }, // ͫ
+    { 7, 7, 8, 0, 25, 12, 23156 }, // ͬ
+    { 6, 9, 7, 0, 26, 14, 23168 }, // ͭ
+    { 7, 7, 8, 0, 25, 16, 23182 }, // ͮ
+    { 9, 7, 8, -2, 25, 16, 23198 }, // ͯ
+    { 19, 21, 18, -2, 21, 66, 23214 }, // Α
+    { 18, 21, 19, 0, 21, 63, 23280 }, // Β
+    { 17, 21, 18, 0, 21, 45, 23343 }, // Γ
+    { 20, 21, 19, -2, 21, 68, 23388 }, // Δ
+    { 17, 21, 18, 0, 21, 53, 23456 }, // Ε
+    { 19, 21, 19, -1, 21, 58, 23509 }, // Ζ
+    { 21, 21, 22, 0, 21, 68, 23567 }, // Η
+    { 20, 23, 22, 1, 22, 83, 23635 }, // Θ
+    { 14, 21, 14, -1, 21, 44, 23718 }, // Ι
+    { 21, 21, 22, 0, 21, 69, 23762 }, // Κ
+    { 18, 21, 18, -2, 21, 60, 23831 }, // Λ
+    { 26, 21, 27, 0, 21, 106, 23891 }, // Μ
+    { 23, 21, 24, 0, 21, 82, 23997 }, // Ν
+    { 17, 21, 18, 0, 21, 49, 24079 }, // Ξ
+    { 20, 23, 22, 1, 22, 76, 24128 }, // Ο
+    { 21, 21, 22, 0, 21, 64, 24204 }, // Π
+    { 18, 21, 19, 0, 21, 56, 24268 }, // Ρ
+    { 19, 21, 19, -1, 21, 54, 24324 }, // Σ
+    { 16, 21, 19, 2, 21, 46, 24378 }, // Τ
+    { 18, 21, 21, 2, 21, 54, 24424 }, // Υ
+    { 24, 23, 26, 1, 22, 86, 24478 }, // Φ
+    { 23, 21, 22, -2, 21, 68, 24564 }, // Χ
+    { 23, 21, 27, 3, 21, 85, 24632 }, // Ψ
+    { 22, 22, 22, -1, 22, 77, 24717 }, // Ω
+    { 16, 18, 18, 1, 17, 58, 24794 }, // α
+    { 19, 30, 19, -1, 23, 89, 24852 }, // β
+    { 15, 23, 17, 1, 16, 57, 24941 }, // γ
+    { 17, 24, 19, 1, 23, 67, 24998 }, // δ
+    { 14, 18, 15, 0, 17, 42, 25065 }, // ε
+    { 16, 29, 17, 0, 23, 67, 25107 }, // ζ
+    { 17, 24, 18, 0, 17, 65, 25174 }, // η
+    { 16, 24, 18, 1, 23, 72, 25239 }, // θ
+    { 9, 17, 11, 1, 16, 29, 25311 }, // ι
+    { 18, 16, 19, 0, 16, 49, 25340 }, // κ
+    { 18, 24, 17, -2, 23, 64, 25389 }, // λ
+    { 19, 23, 19, -1, 16, 69, 25453 }, // μ
+    { 15, 16, 17, 1, 16, 43, 25522 }, // ν
+    { 16, 29, 18, 1, 23, 65, 25565 }, // ξ
+    { 15, 18, 17, 1, 17, 51, 25630 }, // ο
+    { 21, 17, 23, 1, 16, 60, 25681 }, // π
+    { 17, 24, 17, -1, 17, 64, 25741 }, // ρ
+    { 14, 23, 16, 1, 17, 50, 25805 }, // ς
+    { 18, 17, 20, 1, 16, 55, 25855 }, // σ
+    { 15, 17, 17, 1, 16, 42, 25910 }, // τ
+    { 16, 17, 18, 1, 16, 51, 25952 }, // υ
+    { 21, 24, 23, 1, 17, 86, 26003 }, // φ
+    { 21, 25, 20, -2, 17, 74, 26089 }, // χ
+    { 22, 30, 24, 1, 23, 102, 26163 }, // ψ
+    { 23, 17, 25, 1, 16, 71, 26265 }, // ω
+    { 19, 28, 18, -2, 21, 78, 26336 }, // Ạ
+    { 16, 24, 18, 1, 17, 66, 26414 }, // ạ
+    { 19, 30, 18, -2, 30, 84, 26480 }, // Ả
+    { 16, 26, 18, 1, 25, 75, 26564 }, // ả
+    { 25, 29, 24, -2, 29, 100, 26639 }, // Ấ
+    { 20, 25, 22, 1, 24, 82, 26739 }, // ấ
+    { 20, 29, 19, -2, 29, 92, 26821 }, // Ầ
+    { 16, 25, 18, 1, 24, 77, 26913 }, // ầ
+    { 23, 31, 22, -2, 31, 100, 26990 }, // Ẩ
+    { 19, 27, 21, 1, 26, 83, 27090 }, // ẩ
+    { 21, 31, 20, -2, 31, 103, 27173 }, // Ẫ
+    { 16, 27, 18, 1, 26, 85, 27276 }, // ẫ
+    { 20, 35, 19, -2, 28, 99, 27361 }, // Ậ
+    { 16, 30, 18, 1, 23, 84, 27460 }, // ậ
+    { 20, 30, 19, -2, 30, 95, 27544 }, // Ắ
+    { 16, 26, 18, 1, 25, 79, 27639 }, // ắ
+    { 20, 30, 19, -2, 30, 94, 27718 }, // Ằ
+    { 16, 26, 18, 1, 25, 80, 27812 }, // ằ
+    { 20, 31, 19, -2, 31, 97, 27892 }, // Ẳ
+    { 16, 27, 18, 1, 26, 81, 27989 }, // ẳ
+    { 21, 31, 20, -2, 31, 100, 28070 }, // Ẵ
+    { 16, 27, 18, 1, 26, 82, 28170 }, // ẵ
+    { 20, 35, 19, -2, 28, 99, 28252 }, // Ặ
+    { 16, 30, 18, 1, 23, 81, 28351 }, // ặ
+    { 17, 28, 18, 0, 21, 65, 28432 }, // Ẹ
+    { 15, 24, 17, 1, 17, 59, 28497 }, // ẹ
+    { 17, 30, 18, 0, 30, 71, 28556 }, // Ẻ
+    { 15, 26, 17, 1, 25, 65, 28627 }, // ẻ
+    { 18, 28, 19, 0, 28, 71, 28692 }, // Ẽ
+    { 16, 24, 18, 1, 23, 64, 28763 }, // ẽ
+    { 22, 29, 23, 0, 29, 92, 28827 }, // Ế
+    { 20, 25, 22, 1, 24, 76, 28919 }, // ế
+    { 17, 29, 18, 0, 29, 77, 28995 }, // Ề
+    { 15, 25, 17, 1, 24, 70, 29072 }, // ề
+    { 20, 31, 21, 0, 31, 84, 29142 }, // Ể
+    { 18, 27, 20, 1, 26, 76, 29226 }, // ể
+    { 18, 31, 19, 0, 31, 87, 29302 }, // Ễ
+    { 16, 27, 18, 1, 26, 77, 29389 }, // ễ
+    { 17, 35, 18, 0, 28, 82, 29466 }, // Ệ
+    { 16, 30, 18, 1, 23, 76, 29548 }, // ệ
+    { 14, 30, 14, -1, 30, 60, 29624 }, // Ỉ
+    { 11, 25, 12, 0, 25, 40, 29684 }, // ỉ
+    { 14, 28, 14, -1, 21, 54, 29724 }, // Ị
+    { 11, 30, 11, -1, 23, 43, 29778 }, // ị
+    { 20, 29, 22, 1, 22, 87, 29821 }, // Ọ
+    { 15, 24, 17, 1, 17, 61, 29908 }, // ọ
+    { 20, 31, 22, 1, 30, 95, 29969 }, // Ỏ
+    { 15, 26, 17, 1, 25, 68, 30064 }, // ỏ
+    { 23, 30, 25, 1, 29, 105, 30132 }, // Ố
+    { 20, 25, 22, 1, 24, 79, 30237 }, // ố
+    { 20, 30, 22, 1, 29, 101, 30316 }, // Ồ
+    { 15, 25, 17, 1, 24, 72, 30417 }, // ồ
+    { 22, 32, 24, 1, 31, 107, 30489 }, // Ổ
+    { 18, 27, 20, 1, 26, 81, 30596 }, // ổ
+    { 20, 32, 22, 1, 31, 109, 30677 }, // Ỗ
+    { 16, 27, 18, 1, 26, 83, 30786 }, // ỗ
+    { 20, 35, 22, 1, 28, 107, 30869 }, // Ộ
+    { 15, 30, 17, 1, 23, 77, 30976 }, // ộ
+    { 25, 29, 27, 1, 28, 97, 31053 }, // Ớ
+    { 21, 24, 23, 1, 23, 78, 31150 }, // ớ
+    { 25, 29, 27, 1, 28, 97, 31228 }, // Ờ
+    { 21, 24, 23, 1, 23, 79, 31325 }, // ờ
+    { 25, 31, 27, 1, 30, 104, 31404 }, // Ở
+    { 21, 26, 23, 1, 25, 82, 31508 }, // ở
+    { 25, 29, 27, 1, 28, 101, 31590 }, // Ỡ
+    { 21, 24, 23, 1, 23, 82, 31691 }, // ỡ
+    { 25, 30, 27, 1, 23, 96, 31773 }, // Ợ
+    { 21, 26, 23, 1, 19, 78, 31869 }, // ợ
+    { 20, 28, 22, 1, 21, 79, 31947 }, // Ụ
+    { 17, 23, 19, 1, 16, 62, 32026 }, // ụ
+    { 20, 31, 22, 1, 30, 86, 32088 }, // Ủ
+    { 17, 26, 19, 1, 25, 72, 32174 }, // ủ
+    { 25, 29, 28, 2, 28, 99, 32246 }, // Ứ
+    { 23, 24, 25, 1, 23, 83, 32345 }, // ứ
+    { 25, 29, 28, 2, 28, 97, 32428 }, // Ừ
+    { 23, 24, 25, 1, 23, 82, 32525 }, // ừ
+    { 25, 31, 28, 2, 30, 103, 32607 }, // Ử
+    { 23, 26, 25, 1, 25, 89, 32710 }, // ử
+    { 25, 29, 28, 2, 28, 100, 32799 }, // Ữ
+    { 23, 24, 25, 1, 23, 86, 32899 }, // ữ
+    { 25, 30, 28, 2, 23, 97, 32985 }, // Ự
+    { 23, 26, 25, 1, 19, 82, 33082 }, // ự
+    { 18, 28, 21, 2, 28, 68, 33164 }, // Ỳ
+    { 20, 30, 18, -3, 23, 79, 33232 }, // ỳ
+    { 18, 28, 21, 2, 21, 66, 33311 }, // Ỵ
+    { 20, 23, 18, -3, 16, 69, 33377 }, // ỵ
+    { 18, 30, 21, 2, 30, 73, 33446 }, // Ỷ
+    { 20, 32, 18, -3, 25, 84, 33519 }, // ỷ
+    { 18, 28, 21, 2, 28, 70, 33603 }, // Ỹ
+    { 20, 30, 18, -3, 23, 83, 33673 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 33756 }, //  
+    { 0, 0, 29, 0, 0, 0, 33756 }, //  
+    { 0, 0, 15, 0, 0, 0, 33756 }, //  
+    { 0, 0, 29, 0, 0, 0, 33756 }, //  
+    { 0, 0, 10, 0, 0, 0, 33756 }, //  
+    { 0, 0, 7, 0, 0, 0, 33756 }, //  
+    { 0, 0, 5, 0, 0, 0, 33756 }, //  
+    { 0, 0, 16, 0, 0, 0, 33756 }, //  
+    { 0, 0, 8, 0, 0, 0, 33756 }, //  
+    { 0, 0, 5, 0, 0, 0, 33756 }, //  
+    { 0, 0, 3, 0, 0, 0, 33756 }, //  
+    { 0, 0, 1, 0, 0, 0, 33756 }, // ​
+    { 0, 0, 1, 0, 0, 0, 33756 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 33756 }, // ‍
+    { 8, 25, 8, -1, 21, 45, 33756 }, // ‎
+    { 8, 25, 2, -7, 21, 45, 33801 }, // ‏
+    { 9, 4, 10, 0, 10, 11, 33846 }, // ‐
+    { 9, 4, 10, 0, 10, 11, 33857 }, // ‑
+    { 15, 4, 17, 1, 12, 16, 33868 }, // ‒
+    { 14, 4, 15, 0, 10, 14, 33884 }, // –
+    { 28, 4, 29, 0, 10, 27, 33898 }, // —
+    { 28, 4, 29, 0, 10, 27, 33925 }, // ―
+    { 12, 30, 16, 2, 23, 90, 33952 }, // ‖
+    { 14, 7, 12, -4, 0, 32, 34042 }, // ‗
+    { 8, 8, 10, 1, 21, 14, 34074 }, // ‘
+    { 8, 8, 10, 1, 21, 14, 34088 }, // ’
+    { 8, 8, 8, -2, 4, 14, 34102 }, // ‚
+    { 5, 8, 9, 3, 21, 11, 34116 }, // ‛
+    { 14, 8, 16, 1, 21, 27, 34127 }, // “
+    { 14, 8, 16, 1, 21, 26, 34154 }, // ”
+    { 14, 8, 15, -2, 4, 27, 34180 }, // „
+    { 11, 8, 15, 3, 21, 23, 34207 }, // ‟
+    { 13, 23, 16, 2, 23, 50, 34230 }, // †
+    { 16, 23, 17, 0, 23, 46, 34280 }, // ‡
+    { 10, 10, 12, 1, 16, 17, 34326 }, // •
+    { 10, 12, 12, 1, 17, 21, 34343 }, // ‣
+    { 6, 6, 15, 3, 5, 10, 34364 }, // ․
+    { 14, 6, 17, 0, 5, 18, 34374 }, // ‥
+    { 22, 6, 24, 0, 5, 27, 34392 }, // …
+    { 6, 6, 9, 2, 11, 9, 34419 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 34428 }, //  
+    { 0, 0, 18, 0, 0, 0, 34428 }, //  
+    { 8, 22, 8, -1, 18, 38, 34428 }, // ‪
+    { 8, 22, 2, -7, 18, 38, 34466 }, // ‫
+    { 8, 25, 5, -4, 21, 40, 34504 }, // ‬
+    { 8, 25, 5, -4, 21, 38, 34544 }, // ‭
+    { 8, 25, 5, -4, 21, 38, 34582 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 34620 }, //  
+    { 34, 23, 36, 1, 22, 142, 34620 }, // ‰
+    { 45, 23, 47, 1, 22, 182, 34762 }, // ‱
+    { 10, 8, 12, 1, 21, 13, 34944 }, // ′
+    { 16, 8, 18, 1, 21, 25, 34957 }, // ″
+    { 23, 8, 25, 1, 21, 37, 34982 }, // ‴
+    { 8, 8, 11, 2, 21, 13, 35019 }, // ‵
+    { 14, 8, 17, 2, 21, 25, 35032 }, // ‶
+    { 21, 8, 24, 2, 21, 37, 35057 }, // ‷
+    { 11, 10, 10, -3, 3, 25, 35094 }, // ‸
+    { 9, 14, 11, 1, 15, 21, 35119 }, // ‹
+    { 9, 14, 10, 0, 15, 23, 35140 }, // ›
+    { 24, 23, 25, 0, 22, 103, 35163 }, // ※
+    { 18, 22, 19, 0, 21, 64, 35266 }, // ‼
+    { 13, 23, 16, 2, 22, 49, 35330 }, // ‽
+    { 15, 4, 18, 2, 26, 9, 35379 }, // ‾
+    { 16, 7, 16, -2, 0, 19, 35388 }, // ‿
+    { 16, 8, 19, 2, 24, 22, 35407 }, // ⁀
+    { 15, 19, 13, -3, 12, 45, 35429 }, // ⁁
+    { 33, 27, 34, -1, 23, 133, 35474 }, // ⁂
+    { 9, 5, 10, 0, 10, 11, 35607 }, // ⁃
+    { 20, 21, 13, -8, 21, 43, 35618 }, // ⁄
+    { 13, 26, 13, -1, 21, 55, 35661 }, // ⁅
+    { 13, 26, 12, -2, 21, 53, 35716 }, // ⁆
+    { 26, 23, 29, 2, 22, 87, 35769 }, // ⁇
+    { 21, 23, 24, 2, 22, 74, 35856 }, // ⁈
+    { 23, 23, 24, 0, 22, 78, 35930 }, // ⁉
+    { 15, 16, 17, 1, 16, 35, 36008 }, // ⁊
+    { 16, 27, 19, 2, 23, 99, 36043 }, // ⁋
+    { 16, 15, 19, 1, 16, 56, 36142 }, // ⁌
+    { 16, 15, 19, 2, 16, 49, 36198 }, // ⁍
+    { 15, 15, 16, -1, 8, 41, 36247 }, // ⁎
+    { 8, 21, 10, 1, 17, 24, 36288 }, // ⁏
+    { 20, 31, 19, -2, 24, 64, 36312 }, // ⁐
+    { 18, 30, 18, -1, 23, 90, 36376 }, // ⁑
+    { 13, 23, 14, 0, 22, 54, 36466 }, // ⁒
+    { 28, 7, 30, 1, 12, 31, 36520 }, // ⁓
+    { 16, 7, 16, -3, 0, 23, 36551 }, // ⁔
+    { 16, 16, 17, 0, 15, 50, 36574 }, // ⁕
+    { 14, 23, 16, 1, 22, 41, 36624 }, // ⁖
+    { 27, 8, 29, 1, 21, 51, 36665 }, // ⁗
+    { 23, 23, 25, 1, 22, 60, 36716 }, // ⁘
+    { 23, 23, 25, 1, 22, 61, 36776 }, // ⁙
+    { 6, 23, 8, 1, 22, 21, 36837 }, // ⁚
+    { 19, 24, 21, 1, 23, 50, 36858 }, // ⁛
+    { 24, 23, 25, 0, 22, 100, 36908 }, // ⁜
+    { 6, 24, 8, 1, 23, 29, 37008 }, // ⁝
+    { 5, 23, 8, 2, 22, 27, 37037 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 37064 }, //  
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 37064 }, // ⁩
+    { 8, 25, 5, -4, 21, 39, 37064 }, // ⁪
+    { 8, 25, 5, -4, 21, 42, 37103 }, // ⁫
+    { 8, 25, 5, -4, 21, 37, 37145 }, // ⁬
+    { 8, 25, 5, -4, 21, 37, 37182 }, // ⁭
+    { 8, 25, 5, -4, 21, 41, 37219 }, // ⁮
+    { 8, 25, 5, -4, 21, 38, 37260 }, // ⁯
+    { 11, 14, 14, 2, 25, 34, 37298 }, // ⁰
+    { 6, 14, 9, 2, 22, 20, 37332 }, // ⁱ
+    { 12, 13, 14, 1, 25, 33, 37352 }, // ⁴
+    { 11, 14, 14, 2, 25, 29, 37385 }, // ⁵
+    { 11, 14, 14, 2, 25, 32, 37414 }, // ⁶
+    { 12, 13, 15, 2, 25, 26, 37446 }, // ⁷
+    { 11, 14, 14, 2, 25, 35, 37472 }, // ⁸
+    { 11, 14, 14, 2, 25, 37, 37507 }, // ⁹
+    { 9, 9, 13, 3, 22, 23, 37544 }, // ⁺
+    { 9, 3, 13, 3, 19, 11, 37567 }, // ⁻
+    { 10, 7, 14, 3, 21, 13, 37578 }, // ⁼
+    { 8, 17, 12, 3, 26, 25, 37591 }, // ⁽
+    { 8, 17, 9, 0, 26, 26, 37616 }, // ⁾
+    { 12, 11, 14, 1, 19, 31, 37642 }, // ⁿ
+    { 11, 14, 11, -1, 9, 32, 37673 }, // ₀
+    { 10, 13, 11, -1, 9, 25, 37705 }, // ₁
+    { 12, 13, 11, -2, 9, 26, 37730 }, // ₂
+    { 11, 14, 11, -2, 9, 32, 37756 }, // ₃
+    { 12, 13, 11, -2, 9, 34, 37788 }, // ₄
+    { 11, 14, 11, -1, 9, 29, 37822 }, // ₅
+    { 11, 14, 11, -1, 9, 34, 37851 }, // ₆
+    { 12, 13, 12, -1, 9, 25, 37885 }, // ₇
+    { 12, 14, 11, -2, 9, 33, 37910 }, // ₈
+    { 11, 14, 11, -1, 9, 34, 37943 }, // ₉
+    { 9, 9, 11, 0, 7, 21, 37977 }, // ₊
+    { 9, 3, 11, 0, 4, 11, 37998 }, // ₋
+    { 9, 7, 12, 0, 6, 13, 38009 }, // ₌
+    { 8, 17, 9, 0, 11, 26, 38022 }, // ₍
+    { 7, 17, 7, -3, 11, 27, 38048 }, // ₎
+    { 11, 10, 11, -1, 7, 31, 38075 }, // ₐ
+    { 10, 10, 10, -1, 7, 26, 38106 }, // ₑ
+    { 10, 10, 11, -1, 7, 26, 38132 }, // ₒ
+    { 13, 10, 11, -3, 7, 27, 38158 }, // ₓ
+    { 11, 10, 10, -2, 7, 23, 38185 }, // ₔ
+    { 12, 14, 13, -1, 11, 36, 38208 }, // ₕ
+    { 13, 14, 13, -1, 11, 36, 38244 }, // ₖ
+    { 7, 14, 7, -1, 11, 23, 38280 }, // ₗ
+    { 17, 10, 19, -1, 7, 48, 38303 }, // ₘ
+    { 11, 10, 11, -2, 7, 31, 38351 }, // ₙ
+    { 12, 14, 11, -3, 7, 35, 38382 }, // ₚ
+    { 9, 10, 10, -1, 7, 22, 38417 }, // ₛ
+    { 8, 12, 8, -1, 9, 22, 38439 }, // ₜ
+    { 17, 22, 19, 1, 22, 61, 38461 }, // ₠
+    { 19, 25, 20, 0, 23, 92, 38522 }, // ₡
+    { 18, 23, 19, 0, 22, 71, 38614 }, // ₢
+    { 18, 21, 19, 0, 21, 54, 38685 }, // ₣
+    { 19, 22, 19, -1, 22, 67, 38739 }, // ₤
+    { 25, 24, 26, 0, 20, 100, 38806 }, // ₥
+    { 18, 21, 19, 0, 21, 79, 38906 }, // ₦
+    { 25, 22, 26, 0, 21, 87, 38985 }, // ₧
+    { 27, 22, 28, 0, 21, 101, 39072 }, // ₨
+    { 23, 21, 24, 0, 21, 101, 39173 }, // ₩
+    { 26, 21, 27, 0, 21, 116, 39274 }, // ₪
+    { 20, 28, 21, 0, 23, 90, 39390 }, // ₫
+    { 18, 23, 19, 0, 22, 61, 39480 }, // €
+    { 20, 21, 21, 0, 21, 67, 39541 }, // ₭
+    { 17, 21, 19, 1, 21, 59, 39608 }, // ₮
+    { 29, 29, 30, 0, 22, 123, 39667 }, // ₯
+    { 20, 29, 19, -2, 22, 90, 39790 }, // ₰
+    { 18, 21, 19, 0, 21, 65, 39880 }, // ₱
+    { 19, 26, 21, 1, 23, 88, 39945 }, // ₲
+    { 21, 21, 20, -2, 21, 67, 40033 }, // ₳
+    { 18, 23, 19, 0, 22, 71, 40100 }, // ₴
+    { 19, 26, 21, 1, 23, 78, 40171 }, // ₵
+    { 21, 21, 22, 0, 20, 74, 40249 }, // ₶
+    { 22, 25, 22, -1, 22, 94, 40323 }, // ₷
+    { 17, 21, 19, 1, 21, 51, 40417 }, // ₸
+    { 15, 21, 18, 2, 21, 53, 40468 }, // ₹
+    { 16, 22, 17, 0, 21, 64, 40521 }, // ₺
+    { 19, 23, 21, 1, 22, 75, 40585 }, // ₻
+    { 24, 21, 24, -1, 21, 77, 40660 }, // ₼
+    { 19, 21, 19, -1, 21, 66, 40737 }, // ₽
+    { 20, 24, 20, -1, 24, 76, 40803 }, // ₾
+    { 17, 27, 18, 0, 24, 77, 40879 }, // ₿
+    { 9, 4, 10, 0, 10, 11, 40956 }, // −
+    { 27, 28, 29, 1, 23, 112, 40967 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
@@ -4752,4 +3389,5 @@ static const EpdFontData notosans_14_bolditalic = {
     32,
     -9,
     true,
+    true,
 };
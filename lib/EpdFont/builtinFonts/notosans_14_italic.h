@@ -2,4377 +2,3293 @@
  * generated by fontconvert.py
  * name: notosans_14_italic
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_italicBitmaps[57352] = {
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x40,
-    0x07, 0xC0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x05,
-    0x00, 0x00, 0x2E, 0x0B, 0x83, 0xE0, 0xF8, 0x3D, 0x0F, 0x47, 0xC0, 0xF0, 0x78, 0x1F, 0x0B, 0x42,
-    0xD0, 0xB0, 0x2C, 0x0A, 0x02, 0x80, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x07, 0x80,
-    0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,
-    0x02, 0xD0, 0x1E, 0x00, 0x02, 0xAB, 0xEA, 0xBF, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x5B,
-    0x95, 0xB9, 0x50, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-    0xF0, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0xB4, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-    0x01, 0xE0, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xBE, 0xFC, 0x00, 0xF8, 0x78, 0x00, 0x01, 0xF0, 0xB4, 0x00, 0x02,
-    0xF0, 0xB0, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xFD, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03, 0xCB, 0xD0, 0x00, 0x03, 0x83, 0xD0, 0x00,
-    0x07, 0x83, 0xD0, 0x00, 0x0B, 0x43, 0xD0, 0x20, 0x0F, 0x0F, 0xC0, 0x3F, 0xAF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x01, 0x7E, 0x40, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1E, 0x00, 0xBF, 0xFC,
-    0x00, 0x0F, 0x00, 0x3D, 0x0F, 0x00, 0x0F, 0x40, 0x2E, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0xF4,
-    0x07, 0xC0, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x01, 0xE0, 0x0F, 0x03, 0xD0, 0x00, 0xB8, 0x07, 0xC2,
-    0xE0, 0x00, 0x2D, 0x02, 0xD1, 0xF1, 0xB9, 0x0B, 0x80, 0xF0, 0xF1, 0xFF, 0xD1, 0xF0, 0xF8, 0xF5,
-    0xF4, 0xBC, 0x3F, 0xFC, 0xB8, 0xF4, 0x0F, 0x03, 0xF8, 0x7C, 0x3C, 0x03, 0xC0, 0x00, 0x3C, 0x2E,
-    0x00, 0xF0, 0x00, 0x3D, 0x0B, 0x40, 0x7C, 0x00, 0x2E, 0x03, 0xD0, 0x2E, 0x00, 0x1F, 0x00, 0xF0,
-    0x0F, 0x40, 0x0F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x40, 0x0F, 0x43, 0xD0, 0x0B, 0x80, 0x01, 0xFB,
-    0xF0, 0x07, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x7E, 0x00, 0x00, 0x1F, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0xF8, 0x00, 0xF8, 0x3F, 0x41, 0xF4, 0x07, 0xC1, 0xF4,
-    0x02, 0xF0, 0x3E, 0x0F, 0x80, 0x03, 0xF2, 0xF0, 0x3E, 0x00, 0x07, 0xFF, 0x40, 0xF8, 0x00, 0x0B,
-    0xF4, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x1F, 0x80,
-    0x0B, 0xFF, 0xD0, 0x2F, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x3E, 0x3D, 0x7C, 0x78, 0xB4,
-    0xB0, 0xA0, 0x00, 0x03, 0xD0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-    0x00, 0x0B, 0x80, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x1F, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x00, 0x02,
-    0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x74, 0x0B, 0x00, 0x0F, 0xF4, 0xF0, 0x00,
-    0x1F, 0xFE, 0x56, 0x90, 0x07, 0xFF, 0xFD, 0x00, 0xBF, 0x16, 0x80, 0x3E, 0x74, 0x00, 0x0F, 0xC3,
-    0xC0, 0x03, 0xF0, 0x3D, 0x00, 0x0D, 0x02, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x55, 0x5F, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x50, 0x0B, 0xD0, 0x3F, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x02,
-    0xE0, 0x0E, 0x00, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x05, 0x0F, 0xC7, 0xF1, 0xFC, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x81, 0xFC, 0x02,
-    0xF4, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xD0, 0xBC, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x1F, 0x40,
-    0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x0F, 0x4F, 0x80, 0x00, 0x7D, 0x3D, 0x00, 0x02,
-    0xF1, 0xF4, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x3E, 0x1F, 0x40, 0x01, 0xF4, 0x7D, 0x00, 0x0F, 0xC0,
-    0xF4, 0x00, 0x7E, 0x03, 0xF0, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x40, 0x0F, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x1F, 0xE0, 0x3F, 0xF4, 0xBF, 0xBC,
-    0xBF, 0x6F, 0x0E, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x01, 0xF0, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x20, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x55, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0xFD, 0x02, 0xFC, 0x00,
-    0x10, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x15, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x7F, 0x80, 0x7F,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x7D, 0xF4, 0x00,
-    0x00, 0xF8, 0xF0, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x2F, 0x03, 0xE0, 0x00,
-    0xBC, 0x03, 0xD0, 0x01, 0xF4, 0x07, 0xC0, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x3E,
-    0x00, 0x0F, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x7F, 0x54, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xEA, 0xAA, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xEA, 0x90,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x29, 0x5B, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xBD, 0x0E, 0x00, 0x1F, 0xE0, 0x3F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xF8,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x2F, 0xF4, 0x01, 0xF7, 0xFF, 0xF4, 0x0B, 0xFD, 0x07, 0xF0, 0x3F,
-    0x80, 0x07, 0xD0, 0xFC, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0xF4, 0x3D, 0x00,
-    0x03, 0xD0, 0xF8, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0x0F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF,
-    0xC1, 0x55, 0x55, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x3F, 0x40, 0xFD, 0x01, 0xF4, 0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xF0, 0x2F,
-    0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3D, 0x00, 0xF8, 0x03, 0xF0, 0x02, 0xF8, 0xBF, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFE, 0x00, 0x07, 0xF8, 0xBE, 0x00, 0x7E, 0x00, 0xBE, 0x03, 0xE0, 0x00, 0xFC,
-    0x1F, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x07, 0xD2, 0xF0, 0x00, 0x2F, 0x0B, 0xD0, 0x00, 0xFC, 0x0F,
-    0xD0, 0x0F, 0xD0, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xBE, 0x02, 0xF4, 0x07, 0xD0,
-    0x03, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x7C, 0x1F, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x7F, 0x03, 0xF0, 0x07, 0xFC, 0x07, 0xFF, 0xFB, 0xE0,
-    0x07, 0xFF, 0x4F, 0x40, 0x00, 0x40, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x10, 0x01, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0xFD, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x03, 0xF0,
-    0x1F, 0xC0, 0x7F, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xF8, 0x00, 0xFD, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x03, 0xD0, 0x01, 0xF0,
-    0x00, 0xF4, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0x90, 0x40, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xBF,
-    0xD0, 0x01, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x3F, 0xFF, 0xF4, 0x2E, 0x42, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0x80, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBE, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0x90, 0x17, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0xF0, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0xBF, 0xF8, 0x0B, 0x83, 0xD0, 0x1F,
-    0xFB, 0xF0, 0x1F, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3C, 0xF4, 0x0F, 0x80, 0x2E, 0x00, 0xF3, 0xC0,
-    0x7C, 0x00, 0xF4, 0x07, 0xDF, 0x02, 0xD0, 0x03, 0xC0, 0x1E, 0x7C, 0x0F, 0x40, 0x1F, 0x00, 0xB5,
-    0xE0, 0x3C, 0x00, 0xF8, 0x03, 0xC7, 0xC0, 0xF4, 0x07, 0xE0, 0x2E, 0x1F, 0x03, 0xE0, 0x7B, 0xC2,
-    0xF0, 0x3C, 0x07, 0xFF, 0x8F, 0xFF, 0x40, 0xF4, 0x07, 0xF4, 0x0B, 0xE0, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x55, 0xBE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x6A, 0x94, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0,
-    0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C,
-    0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B,
-    0xC0, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8,
-    0xFC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0xFE, 0x80, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x0F, 0xD5, 0x6F, 0xE0, 0x03, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0xBC,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF8, 0x03, 0xD0, 0x02, 0xFC, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x6F, 0x80, 0x0F, 0x80, 0x02, 0xF4,
-    0x03, 0xD0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x01,
-    0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x07, 0xD0, 0x06, 0xFD, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x41, 0x78, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x19, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFD,
-    0x5B, 0xFE, 0x00, 0x0F, 0x80, 0x07, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0xBC,
-    0x02, 0xF0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x7C, 0x00,
-    0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0x80, 0x00, 0x0F, 0xC0,
-    0xF4, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x2F, 0x42, 0xF0, 0x00, 0x07, 0xF0, 0x3E, 0x00, 0x01,
-    0xFC, 0x03, 0xE0, 0x00, 0xBF, 0x40, 0x7E, 0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40,
-    0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01,
-    0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x0F, 0xC0, 0x01, 0x57, 0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F,
-    0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00,
-    0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B,
-    0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x3D, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x3F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-    0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07,
-    0xD0, 0x0B, 0xC0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x01, 0xF4,
-    0x07, 0xE0, 0x00, 0x2F, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00,
-    0x03, 0xD7, 0xE0, 0x00, 0x00, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F,
-    0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F,
-    0xC0, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0xBF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0xFB, 0x80, 0x00,
-    0x0F, 0xBC, 0x01, 0xF7, 0xC0, 0x00, 0x2E, 0xF8, 0x02, 0xF7, 0xC0, 0x00, 0x7C, 0xF8, 0x03, 0xE3,
-    0xC0, 0x00, 0xF8, 0xF4, 0x03, 0xD3, 0xC0, 0x01, 0xF1, 0xF0, 0x03, 0xD3, 0xC0, 0x03, 0xD2, 0xF0,
-    0x07, 0xC3, 0xD0, 0x07, 0xC3, 0xE0, 0x0B, 0xC2, 0xD0, 0x0F, 0x43, 0xD0, 0x0F, 0x82, 0xE0, 0x2F,
-    0x07, 0xD0, 0x0F, 0x41, 0xE0, 0x3D, 0x0B, 0xC0, 0x0F, 0x01, 0xF0, 0xB8, 0x0B, 0xC0, 0x1F, 0x00,
-    0xF0, 0xF0, 0x0F, 0x80, 0x2F, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3E, 0x00, 0xF7, 0xC0, 0x1F, 0x00,
-    0x3D, 0x00, 0xFF, 0x80, 0x2F, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00,
-    0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00,
-    0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F,
-    0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00,
-    0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02,
-    0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B,
-    0xCB, 0xD0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00,
-    0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00,
-    0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x7D, 0x03,
-    0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x02, 0xF8, 0x0B, 0xD5, 0x6F, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xA4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80,
-    0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00,
-    0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC,
-    0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x07, 0xF8, 0x02,
-    0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC,
-    0x00, 0xF8, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E,
-    0x03, 0xE0, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0,
-    0x7C, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F, 0xD5, 0x54,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00,
-    0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00,
-    0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F,
-    0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x1F, 0x4F, 0x40, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x07, 0xE0, 0xF8, 0x00,
-    0x03, 0xF0, 0x3E, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0xBC,
-    0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x0F, 0xC0, 0x00, 0xF4, 0x07, 0xD0, 0x00,
-    0x3D, 0x03, 0xF0, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x00, 0xF8, 0x7C, 0x00,
-    0x00, 0x2E, 0x3E, 0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xE0, 0x00,
-    0x1F, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0xBF, 0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x3E, 0xF0, 0x00, 0xF8, 0x2F, 0x00, 0x2F, 0x7C, 0x00, 0xBC,
-    0x0B, 0xC0, 0x0F, 0x5F, 0x00, 0x3E, 0x02, 0xF0, 0x07, 0xC3, 0xC0, 0x1F, 0x00, 0xBC, 0x03, 0xD0,
-    0xF0, 0x0F, 0x80, 0x1F, 0x01, 0xF0, 0x3C, 0x07, 0xD0, 0x07, 0xC0, 0xF8, 0x0F, 0x02, 0xF0, 0x01,
-    0xF0, 0x7C, 0x03, 0xC0, 0xF4, 0x00, 0x7C, 0x3E, 0x00, 0xF0, 0xBC, 0x00, 0x1F, 0x0F, 0x00, 0x3D,
-    0x3D, 0x00, 0x07, 0xCB, 0x80, 0x0F, 0x5F, 0x00, 0x00, 0xF3, 0xC0, 0x03, 0xDF, 0x80, 0x00, 0x3D,
-    0xF0, 0x00, 0xF7, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x07,
-    0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xF0,
-    0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00,
-    0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40,
-    0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8,
-    0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x2A, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
-    0xFE, 0x00, 0x1F, 0x54, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3F, 0x54, 0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0xB4, 0x0B, 0x80, 0x7C, 0x07, 0xC0, 0x3C,
-    0x03, 0xD0, 0x3D, 0x03, 0xE0, 0x2E, 0x01, 0xF0, 0x1F, 0x00, 0xF0, 0x0F, 0x40, 0xF4, 0x0B, 0x80,
-    0xBC, 0x07, 0xC0, 0x7C, 0x03, 0xC0, 0x3D, 0x03, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
-    0x05, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x15, 0xBC,
-    0x00, 0x3F, 0xF8, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x1E, 0xB8, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x2D, 0x03,
-    0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x3C,
-    0x0F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x1F,
-    0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA0, 0x54, 0x07, 0xD0, 0x3E, 0x00, 0xF0, 0x07, 0xC0, 0x04, 0x00,
-    0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F,
-    0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D,
-    0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C,
-    0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x2F, 0x80, 0x00, 0xF5, 0xFF, 0xF4, 0x01, 0xF7, 0xD6, 0xFC, 0x02, 0xFE, 0x00, 0xBD, 0x03,
-    0xFC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x7D, 0x0B,
-    0xC0, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x02, 0xF0, 0x1F,
-    0xC0, 0x07, 0xE0, 0x2F, 0xE0, 0x1F, 0xC0, 0x3D, 0xBF, 0xFF, 0x00, 0x3C, 0x2F, 0xF8, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08,
-    0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x6F, 0x82, 0xF0, 0x00, 0xBF, 0xFC,
-    0xBC, 0x00, 0xFE, 0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xF0, 0x01, 0xFD, 0x00,
-    0x3F, 0x02, 0xEF, 0x40, 0x0B, 0xFF, 0xE3, 0xC0, 0x00, 0xBF, 0xD1, 0xF0, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80,
-    0x0F, 0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xFA, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x01, 0x7E, 0x54, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x0A, 0x00, 0x0F, 0xFF,
-    0xC7, 0xC0, 0x0F, 0xF5, 0x7F, 0xE0, 0x0B, 0xE0, 0x07, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x1F, 0x00, 0x2F, 0xD0,
-    0x03, 0xF0, 0x2E, 0xF4, 0x00, 0xBF, 0xFE, 0x7C, 0x00, 0x0B, 0xFD, 0x2F, 0x00, 0x00, 0x10, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x79, 0x02,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xD0, 0x00, 0xF5, 0xFF, 0xF8, 0x01,
-    0xF7, 0xD5, 0xFC, 0x02, 0xFE, 0x00, 0x7C, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03,
-    0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F,
-    0x80, 0x02, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E,
-    0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0,
-    0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82,
-    0xF0, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F,
-    0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01, 0xF4,
-    0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0xA0, 0x2F, 0x80, 0x0B, 0xE0,
-    0x00, 0xF1, 0xFF, 0xF0, 0x7F, 0xFC, 0x01, 0xF7, 0xD6, 0xF5, 0xF5, 0xBE, 0x02, 0xFE, 0x00, 0xFF,
-    0x80, 0x3F, 0x02, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xE0,
-    0x00, 0xF8, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7C,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF4, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x3E, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x2F, 0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC,
-    0x00, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0,
-    0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00,
-    0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x1B,
-    0xE4, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03,
-    0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD,
-    0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x0B, 0xE0, 0x00, 0x0F, 0x1F, 0xFF, 0x40, 0x07, 0xDF, 0x5B, 0xF0, 0x02, 0xFE, 0x00, 0xBD, 0x00,
-    0xBF, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x7D,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x02,
-    0xF0, 0x07, 0xF0, 0x01, 0xF8, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0xFA, 0xFF, 0xFC, 0x00, 0x3D, 0x2F,
-    0xF8, 0x00, 0x1F, 0x40, 0x50, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4,
-    0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0,
-    0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80,
-    0x7C, 0x00, 0xBF, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x9F, 0x00, 0x0B, 0xFD, 0x2F, 0x00,
-    0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xA0, 0x2F, 0x40,
-    0x3C, 0x7F, 0xC0, 0x1F, 0x7E, 0x60, 0x0B, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBE, 0x46, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x24, 0x00, 0xFC, 0x0F, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00,
-    0x2F, 0x00, 0x1B, 0xFA, 0x9B, 0xFF, 0xFD, 0x1B, 0xD5, 0x40, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x40, 0x00, 0x02, 0x90, 0x00,
-    0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01,
-    0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x68, 0x00, 0x02, 0xA1, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x0F, 0x40, 0x07, 0xD0,
-    0x3D, 0x00, 0x3F, 0x00, 0xF4, 0x01, 0xF4, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0xBC, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0xBC, 0x2F, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x0F, 0x3D,
-    0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x1A,
-    0x00, 0x06, 0x87, 0xC0, 0x03, 0xF4, 0x00, 0xF8, 0x7C, 0x00, 0xBF, 0x40, 0x1F, 0x03, 0xD0, 0x0F,
-    0xB4, 0x03, 0xF0, 0x3D, 0x02, 0xEB, 0x40, 0x7D, 0x03, 0xD0, 0x3C, 0xB4, 0x0F, 0xC0, 0x3D, 0x07,
-    0xCB, 0x80, 0xF4, 0x03, 0xD0, 0xF4, 0xB8, 0x2F, 0x00, 0x3D, 0x1F, 0x0B, 0x83, 0xD0, 0x03, 0xD3,
-    0xD0, 0x78, 0xBC, 0x00, 0x3D, 0x7C, 0x07, 0x8F, 0x80, 0x03, 0xDB, 0x40, 0x79, 0xF0, 0x00, 0x3D,
-    0xF0, 0x07, 0xAE, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x02,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x68, 0x00, 0x0A, 0x40, 0x0F, 0x40, 0x0F, 0xC0, 0x02, 0xF0,
-    0x0F, 0xC0, 0x00, 0x7C, 0x0B, 0xC0, 0x00, 0x0F, 0x87, 0xD0, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x01, 0xF7, 0xD0, 0x00, 0x01, 0xF4, 0xBC, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0x0F, 0x80, 0x00, 0x68, 0x00, 0x02, 0xA0, 0x01, 0xF0,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F,
-    0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00,
-    0x1F, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x0F, 0xFF, 0xFE, 0x00, 0x55,
-    0x5F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x6D, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xE4, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-    0x1B, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xE4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x64, 0x00, 0x01, 0xE7, 0x9E,
-    0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79,
-    0xE7, 0x9E, 0x79, 0xE0, 0x00, 0x00, 0x0E, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0xBE, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0xAF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xE6, 0xFE, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x69, 0x00, 0x00, 0x2E, 0x00, 0x1F,
-    0xC0, 0x07, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0xC0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x03, 0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2F, 0xA4, 0x00, 0xBF, 0xFF, 0x00, 0xFF,
-    0x56, 0x80, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x7F, 0x00, 0x10, 0x0B, 0xFE, 0xFC, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xD4, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xBD,
-    0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x10, 0x00, 0x01, 0x1E,
-    0x0A, 0x92, 0xD3, 0xFF, 0xFF, 0xF0, 0x3F, 0x57, 0xF4, 0x1F, 0x00, 0x2D, 0x0B, 0x40, 0x03, 0xC3,
-    0xC0, 0x00, 0xF0, 0xB4, 0x00, 0x3C, 0x1E, 0x00, 0x1E, 0x03, 0xE0, 0x1F, 0x02, 0xFF, 0xFF, 0xE1,
-    0xF6, 0xFE, 0x7E, 0x20, 0x00, 0x02, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x0B, 0xC0,
-    0x3D, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3C, 0x01, 0xF4,
-    0x00, 0x0F, 0x40, 0xF8, 0x00, 0x02, 0xE0, 0xBC, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x0F, 0x3E,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xAA, 0xFE, 0xA8, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x05,
-    0x5F, 0x55, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x03, 0xFE, 0xBF, 0x00, 0x2F, 0x00, 0x04, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x7C,
-    0x00, 0xFC, 0x02, 0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x0B, 0x80, 0x1F, 0x80, 0x3D, 0x00, 0x2F, 0xD7,
-    0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x1F, 0x00, 0x20, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0xDB, 0xC1, 0xF4, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xFE, 0x40, 0xF0, 0x1D, 0x01, 0xFF,
-    0xFC, 0x07, 0x83, 0xC0, 0x3E, 0x01, 0x40, 0x2C, 0x38, 0x0B, 0xC0, 0x00, 0x01, 0xD7, 0x40, 0xF4,
-    0x00, 0x00, 0x0E, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xB0, 0x0F,
-    0x00, 0x00, 0x00, 0xF7, 0x40, 0xF4, 0x00, 0x00, 0x0E, 0x38, 0x0B, 0x80, 0x00, 0x01, 0xD3, 0xC0,
-    0x7D, 0x00, 0x00, 0x2C, 0x2D, 0x02, 0xFF, 0xFC, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x40, 0xF0, 0x07,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x8C,
-    0x0F, 0xAF, 0xC2, 0xD0, 0x78, 0x38, 0x07, 0x87, 0x40, 0x74, 0xB0, 0x0B, 0x0B, 0x00, 0xF0, 0xB4,
-    0x3E, 0x03, 0xEE, 0xD0, 0x1F, 0x48, 0x00, 0x00, 0x10, 0x01, 0x00, 0x1F, 0x02, 0xD0, 0x1F, 0x02,
-    0xF0, 0x2F, 0x42, 0xF0, 0x2F, 0x41, 0xF4, 0x2F, 0x41, 0xF8, 0x0B, 0xC0, 0xFC, 0x00, 0xF4, 0x2F,
-    0x00, 0x2F, 0x03, 0xD0, 0x03, 0xD0, 0xBC, 0x00, 0x7C, 0x0F, 0x40, 0x0F, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x40, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x03,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x2F, 0xF9, 0x00, 0xF0, 0x1D, 0x03, 0xFF, 0xF8, 0x07, 0x83,
-    0xC0, 0x3D, 0x0B, 0xC0, 0x2C, 0x38, 0x03, 0xD0, 0x3D, 0x01, 0xD7, 0x40, 0x3D, 0x03, 0xD0, 0x0E,
-    0xB0, 0x03, 0xD0, 0x7C, 0x00, 0xFB, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xB0, 0x03, 0xFF, 0xD0, 0x00,
-    0xF7, 0x40, 0x3D, 0x1F, 0x00, 0x0E, 0x38, 0x03, 0xD0, 0xF8, 0x01, 0xD3, 0xC0, 0x3D, 0x07, 0xC0,
-    0x2C, 0x2D, 0x03, 0xD0, 0x3E, 0x03, 0xC0, 0xF0, 0x3D, 0x00, 0xF4, 0xF0, 0x07, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xAF, 0xC3, 0xC0, 0x2E, 0x78, 0x00, 0xF7, 0x80,
-    0x0F, 0x78, 0x00, 0xE3, 0xD0, 0x3D, 0x0F, 0xFF, 0x80, 0x2F, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x55, 0x6F, 0x55, 0x5F, 0xFF, 0xFF, 0xFF, 0xAA, 0xAF, 0xAA, 0xA0, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBE, 0x40, 0x7F, 0xFC, 0x02,
-    0x02, 0xE0, 0x00, 0x1E, 0x00, 0x02, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x07, 0xD0, 0x01, 0xF0,
-    0x00, 0xBC, 0x00, 0x2E, 0x00, 0x0B, 0xFF, 0xF4, 0xBF, 0xFF, 0x00, 0x01, 0xBE, 0x00, 0xBF, 0xFC,
-    0x01, 0x02, 0xD0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x16, 0xF4, 0x03, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-    0x07, 0x80, 0x00, 0x78, 0x40, 0x0F, 0x4B, 0xEB, 0xF0, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x0F, 0xC0, 0xBC, 0x07, 0xC0, 0x7C, 0x00, 0x40, 0x00, 0x00, 0x29, 0x00, 0x02, 0x80, 0x03, 0xD0,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0xC0, 0x07,
-    0xD0, 0x07, 0xF8, 0x00, 0xBF, 0x02, 0xEF, 0x40, 0x0F, 0xFF, 0xF8, 0xF0, 0x00, 0xF7, 0xFE, 0x0F,
-    0x00, 0x1F, 0x04, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8,
-    0x2C, 0x2F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8,
-    0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8, 0x2C, 0x3F, 0xFF, 0xF8,
-    0x2C, 0x1F, 0xFF, 0xF8, 0x2C, 0x0F, 0xFF, 0xF8, 0x2C, 0x02, 0xFF, 0xF8, 0x2C, 0x00, 0x05, 0x78,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38,
-    0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x38, 0x2C, 0x00, 0x00, 0x24, 0x18, 0x18, 0x1F, 0xCB,
-    0xF2, 0xF8, 0x14, 0x00, 0x03, 0xC0, 0x1D, 0x00, 0xBE, 0x00, 0x3C, 0x00, 0xF1, 0xAF, 0x87, 0xF4,
-    0x00, 0x00, 0xA0, 0x1F, 0xC2, 0xFF, 0x1E, 0x78, 0x02, 0xD0, 0x0F, 0x00, 0x3C, 0x01, 0xF0, 0x0B,
-    0x80, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFA, 0xF4, 0xB4,
-    0x0E, 0x38, 0x03, 0xDD, 0x00, 0xF7, 0x40, 0x39, 0xD0, 0x1D, 0x78, 0x0F, 0x0F, 0xEF, 0x00, 0x7E,
-    0x00, 0x02, 0x00, 0x50, 0x02, 0xE0, 0x3C, 0x00, 0x7C, 0x0B, 0x80, 0x0F, 0x81, 0xF0, 0x01, 0xF0,
-    0x3E, 0x00, 0x3E, 0x07, 0xC0, 0x0F, 0xC0, 0xF8, 0x0F, 0xC0, 0xFD, 0x0B, 0xC0, 0xBC, 0x07, 0xC0,
-    0xBC, 0x03, 0xD0, 0xBC, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01,
-    0xF0, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0xBF, 0xC0, 0x00, 0xF8, 0x07, 0x9E, 0x00, 0x0B, 0xC0, 0x00,
-    0xB4, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x01,
-    0xF0, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0xA0, 0x0B, 0x40, 0xF4, 0x0F, 0xC0, 0x3C, 0x0B, 0x80, 0xBF,
-    0x00, 0xF0, 0x7C, 0x07, 0xB8, 0x03, 0x83, 0xC0, 0x7A, 0xD0, 0x00, 0x3D, 0x03, 0xCF, 0x00, 0x02,
-    0xE0, 0x3C, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0xE0, 0x00, 0xF0, 0x2F, 0xAF, 0xE0, 0x0F, 0x40, 0xFF,
-    0xFF, 0xC0, 0xB8, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x0E, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0xBF, 0xC0, 0x00, 0xB8, 0x00,
-    0x79, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x0F, 0x06, 0xF8, 0x00,
-    0xB4, 0x0F, 0x4F, 0xFF, 0xC0, 0x3C, 0x0B, 0x81, 0x40, 0xF0, 0x0F, 0x07, 0xC0, 0x00, 0x3C, 0x03,
-    0x83, 0xC0, 0x00, 0x0F, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x01,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0xB8,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xF0, 0x3C, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01,
-    0xBF, 0x40, 0x00, 0x07, 0x80, 0x7F, 0xFD, 0x00, 0x00, 0xF0, 0x02, 0x01, 0xE0, 0x00, 0x3D, 0x00,
-    0x00, 0x0E, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xD0, 0x01, 0xF0, 0x00, 0x15, 0xF8, 0x00, 0x3C, 0x00,
-    0x02, 0xFD, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x7C, 0x02,
-    0x80, 0x00, 0x3C, 0x0F, 0x00, 0xFC, 0x00, 0x0B, 0x83, 0xD0, 0x3F, 0x87, 0xEB, 0xF0, 0xB8, 0x0B,
-    0xB4, 0x2F, 0xF8, 0x1F, 0x02, 0xDF, 0x00, 0x00, 0x03, 0xD0, 0x78, 0xF0, 0x00, 0x00, 0xF8, 0x0E,
-    0x0E, 0x00, 0x00, 0x2E, 0x03, 0xC1, 0xE0, 0x00, 0x07, 0xC0, 0xFE, 0xBF, 0x80, 0x00, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x20, 0x3F, 0xEB, 0xF8, 0x1F,
-    0xFF, 0xF4, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3F, 0x0F,
-    0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x03, 0xE0,
-    0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xAA, 0xAB, 0xC0, 0x2F, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x3D, 0x0F, 0xC0, 0x00, 0x0F, 0x87,
-    0xE0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFB, 0xC0,
-    0x00, 0x00, 0x0B, 0xDF, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00,
-    0x1F, 0x43, 0xD0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0xF8, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFA, 0xAA, 0xBC, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xF8, 0xB8, 0x00, 0x00, 0x3D, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xEA, 0xAA, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x1F, 0xF4, 0x3C, 0x00, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x00,
-    0x74, 0x1F, 0xE0, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xBC,
-    0x00, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00,
-    0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x70, 0x38, 0x00, 0x00, 0x2C,
-    0x0E, 0x00, 0x00, 0x07, 0x87, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x07, 0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03,
-    0xE0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA,
-    0xAA, 0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x55,
-    0x54, 0x00, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xF0, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x0F, 0xD5, 0x55, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0xAA, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x55, 0x54,
-    0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x41, 0x78,
-    0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x19, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x06, 0xBE, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x0F, 0x40, 0xF0, 0x00,
-    0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B,
-    0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E,
-    0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x03, 0xC0, 0xF4, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x02, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F,
-    0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xE0, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x01,
-    0xF4, 0xF0, 0x00, 0x7C, 0x07, 0xC0, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x2F, 0x07,
-    0xC0, 0x00, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03,
-    0xF5, 0x6F, 0xF8, 0x00, 0x0F, 0x80, 0x07, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8,
-    0x5B, 0xE5, 0x50, 0x03, 0xE3, 0xFF, 0xFF, 0x80, 0x1F, 0x4F, 0xFF, 0xFD, 0x00, 0xBD, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x07,
-    0xF0, 0x0F, 0x80, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x0B, 0xF4, 0x01, 0xF9, 0x56, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00,
-    0x3F, 0xE0, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00, 0x00,
-    0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00, 0xBC,
-    0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x03,
-    0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80,
-    0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00, 0x0F,
-    0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02, 0xFF,
-    0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x06, 0xFE, 0x00,
-    0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xBD, 0x00,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x02,
-    0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x06, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00,
-    0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD,
-    0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x1E, 0x00, 0x00, 0x05, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03,
-    0xFD, 0x06, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC,
-    0xBD, 0x00, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02,
-    0xF8, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x40, 0x00, 0x03, 0xFE, 0x0B, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xE0, 0x7F,
-    0xC0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B,
-    0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00,
-    0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40,
-    0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x00, 0x08, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0,
-    0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x14, 0x00, 0x01, 0x07, 0xC0, 0x00, 0x7C, 0x3F,
-    0x00, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x03, 0xF1, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x07, 0xFC, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x07, 0xE0,
-    0x00, 0xFC, 0x28, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0xBF, 0xF8, 0x3E, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF0, 0x00, 0xFE, 0x00,
-    0x0B, 0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x3E, 0xFC, 0x0B, 0xD0, 0x00, 0xFC,
-    0xBC, 0x0F, 0xC0, 0x02, 0xF0, 0xBC, 0x1F, 0x40, 0x07, 0xD0, 0xBC, 0x2F, 0x00, 0x1F, 0x80, 0xBC,
-    0x2F, 0x00, 0x3E, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x3F, 0x02, 0xF0, 0x00, 0xF8, 0x3F,
-    0x07, 0xD0, 0x02, 0xF4, 0x3F, 0x1F, 0x80, 0x03, 0xF0, 0x2F, 0x7E, 0x00, 0x07, 0xE0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3E, 0x2F, 0xFF, 0x80, 0x00, 0x2C, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F,
-    0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E,
-    0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40,
-    0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02,
-    0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00,
-    0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3C, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0,
-    0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D, 0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07,
-    0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F,
-    0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x00, 0x24,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F,
-    0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC,
-    0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC,
-    0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0,
-    0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00,
-    0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0x80, 0x2F, 0x00, 0x7F, 0x00, 0xF8,
-    0x00, 0x7E, 0x03, 0xD0, 0x00, 0xFC, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0x83, 0xF0, 0x00,
-    0x7D, 0x0F, 0x80, 0x03, 0xF0, 0x3D, 0x00, 0x7F, 0x41, 0xFE, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x00,
-    0x3F, 0x55, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x7C, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x7C, 0x01,
-    0xFD, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00,
-    0x2F, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x14, 0x02,
-    0xF8, 0x00, 0x0F, 0x8B, 0xFF, 0xFC, 0x00, 0x03, 0xD0, 0xFF, 0xF8, 0x00, 0x01, 0xF4, 0x01, 0x40,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x8B,
-    0x80, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x1F, 0xF4, 0x38, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x74, 0x1F,
-    0xE0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC,
-    0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF,
-    0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x40, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x05, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F,
-    0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F,
-    0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xEF,
-    0x00, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x0B, 0x03, 0x80, 0x00, 0x07, 0x87, 0x40, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC,
-    0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF,
-    0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1B, 0xD0,
-    0x60, 0xBF, 0x40, 0x03, 0xFF, 0xE3, 0xDF, 0xFF, 0x80, 0x3F, 0x96, 0xEF, 0xF8, 0x7F, 0x02, 0xF8,
-    0x03, 0xFF, 0x00, 0x7D, 0x0F, 0xC0, 0x0B, 0xF0, 0x01, 0xF0, 0xBC, 0x00, 0x1F, 0x80, 0x0F, 0xC3,
-    0xF0, 0x00, 0xBC, 0x01, 0xFD, 0x0F, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x7D, 0x00, 0x0F, 0xFF, 0xF4,
-    0x02, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0xBF, 0xC0, 0x19, 0x03, 0xFF, 0xF2,
-    0xEF, 0xFF, 0xF4, 0x03, 0xFE, 0x0F, 0x1F, 0xFF, 0x80, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0xD5, 0xA0, 0x2F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x08, 0x01, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x02, 0xBE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x4B, 0xE0, 0xBD, 0x00, 0xF8, 0x3E, 0x00,
-    0x3E, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x6F, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xBD, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x07, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0x92, 0xF8, 0x0B, 0xD0, 0x0F, 0x80, 0xF8,
-    0x00, 0xF8, 0x2F, 0x00, 0x1F, 0x43, 0xE0, 0x1B, 0xE0, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x18, 0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xBC, 0x7C, 0x00, 0xB8, 0x0B, 0x80, 0x10, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x4B, 0xE0, 0xBD, 0x00, 0xF8,
-    0x3E, 0x00, 0x3E, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x6F, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18,
-    0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x04, 0x01, 0x00, 0x0F, 0x82,
-    0xF0, 0x03, 0xE0, 0xFC, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x02, 0xFF, 0xFC, 0x03, 0xF9, 0x2F, 0x82, 0xF4, 0x03, 0xE0, 0xF8, 0x00, 0xF8, 0xBC, 0x00,
-    0x7D, 0x3E, 0x01, 0xBE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x60, 0x1F, 0xFF, 0xFC, 0x01, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x03, 0xF0, 0x01, 0xF0, 0x00, 0xB8, 0x00, 0x3D, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0xA4, 0x00, 0xF4, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03,
-    0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xF8, 0x01, 0xF4, 0xF0, 0x1F, 0x01,
-    0xF0, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0xFC, 0x2F, 0x00, 0x80, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x38, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x1B, 0xA1, 0xF0, 0x01, 0xFF, 0xFD, 0xF0, 0x07, 0xF5, 0x6F, 0xF0,
-    0x1F, 0x80, 0x0B, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x1F, 0x40,
-    0x3F, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xFF, 0x43, 0xC0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x38, 0x1F,
-    0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xFE, 0x00, 0x03, 0xC7,
-    0xFF, 0xE0, 0x01, 0xF7, 0xE5, 0xFC, 0x00, 0xBF, 0xC0, 0x2F, 0x40, 0x3F, 0xC0, 0x07, 0xD0, 0x0F,
-    0xC0, 0x02, 0xF0, 0x07, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0F, 0x80,
-    0x3F, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0xF8,
-    0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00,
-    0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00,
-    0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F,
-    0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F,
-    0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xC3,
-    0xC0, 0x00, 0x7C, 0x07, 0xC0, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFC, 0x2F,
-    0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xFC, 0xBC, 0x00,
-    0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xD0, 0x3F, 0x40, 0xBE,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10,
-    0x00, 0xFF, 0x82, 0xC0, 0x0B, 0xFF, 0xFE, 0x00, 0x3C, 0x0F, 0xF0, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x6F, 0xC0, 0x2F, 0x40,
-    0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0B,
-    0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1, 0xF0, 0x00, 0x3F, 0x07,
-    0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x02,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF,
-    0xC0, 0x03, 0xF9, 0x6F, 0xC0, 0x2F, 0x40, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC,
-    0x3E, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC,
-    0x00, 0x07, 0xD1, 0xF0, 0x00, 0x3F, 0x07, 0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x54, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x06, 0xFA, 0x2D, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFE, 0x57, 0xF4, 0x02, 0xF4, 0x03, 0xF8, 0x03,
-    0xD0, 0x0F, 0xFC, 0x0B, 0xC0, 0x3E, 0xBC, 0x0F, 0x40, 0xBC, 0x7C, 0x1F, 0x01, 0xF0, 0xBC, 0x1F,
-    0x03, 0xD0, 0xBC, 0x2F, 0x0F, 0x40, 0xF8, 0x2F, 0x3E, 0x00, 0xF0, 0x1F, 0xBC, 0x02, 0xF0, 0x0F,
-    0xF0, 0x07, 0xD0, 0x0F, 0xE0, 0x1F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0xBF, 0xF4, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x10, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B,
-    0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D,
-    0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F,
-    0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x0F, 0x82, 0xF0, 0x00,
-    0x0F, 0x43, 0xE0, 0x00, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F,
-    0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C,
-    0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
-    0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF,
-    0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3D, 0x7F, 0xFD, 0x00, 0x1F, 0x7D, 0x6F, 0xC0, 0x0B, 0xF8, 0x02,
-    0xF4, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x03, 0xD0, 0x1F, 0x00,
-    0x01, 0xF4, 0x0B, 0xC0, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3E,
-    0x00, 0x0B, 0xC0, 0x1F, 0xC0, 0x07, 0xE0, 0x0B, 0xF8, 0x07, 0xF0, 0x03, 0xEB, 0xFF, 0xF0, 0x00,
-    0xF4, 0xBF, 0xE0, 0x00, 0x7D, 0x01, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xD0, 0xF8, 0x00, 0x00, 0x1F, 0x43, 0xE0,
-    0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x2A, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00,
-    0x7D, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00,
-    0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x00, 0x0F,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xC0,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x1F,
-    0x43, 0xD0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3E, 0x00,
-    0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA,
-    0xAF, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x1F,
-    0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00,
-    0x07, 0xD0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x0F, 0x80,
-    0x3E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xF0,
-    0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF,
-    0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00,
-    0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02,
-    0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0, 0x00,
-    0x00, 0x2F, 0x7C, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0, 0xF4,
-    0x00, 0x03, 0xF0, 0x3D, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00,
-    0xBC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B, 0xC0,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x40, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F,
-    0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03,
-    0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F,
-    0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xD5, 0xA0,
-    0x0B, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3F, 0x40, 0x20, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xE2, 0xE0, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xF8, 0xB8, 0x00, 0xF4, 0x0F, 0x40, 0x10, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0x56, 0x80, 0xBE, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x20, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0x90,
-    0x5E, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x06, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x02, 0xFF, 0xFC, 0x03, 0xFD, 0x5A, 0x02,
-    0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xE4, 0x17, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x01, 0x90, 0x00, 0xBF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x03, 0xC0, 0x7C,
-    0x00, 0x1F, 0x2F, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xD5, 0xA0, 0x0B, 0xE0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x20, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x40, 0x00, 0x07, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE4,
-    0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xD5, 0xBF, 0xE0, 0x00, 0xF8, 0x00, 0x7F, 0x40, 0x1F,
-    0x40, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x7D, 0x0F, 0xC0,
-    0x00, 0x0B, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x02, 0xF4,
-    0x2F, 0x00, 0x00, 0x7F, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x3E, 0x00, 0x0B, 0xF4, 0x07, 0xE5, 0x5B,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF1,
-    0xF0, 0x00, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x01, 0xBE, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0xBC, 0x00, 0x00, 0x3F, 0x95, 0xFF,
-    0x80, 0x00, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x2F, 0x80, 0x00, 0x07, 0xC0, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x02, 0xEF, 0x40, 0x00, 0x02, 0xFF,
-    0xF8, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x6F, 0xF8, 0x00, 0x0F, 0x80,
-    0x07, 0xF4, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x1F,
-    0x40, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x5B, 0xE5, 0x50, 0x03, 0xE3, 0xFF,
-    0xFF, 0x80, 0x1F, 0x4F, 0xFF, 0xFD, 0x00, 0xBD, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00,
-    0x0F, 0x80, 0x7C, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x7F, 0x00,
-    0x3E, 0x00, 0x0B, 0xF4, 0x01, 0xF9, 0x56, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x0A, 0xAB, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x05, 0x57, 0xE4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x01, 0xBE, 0x0B, 0xC0, 0x00, 0xFF, 0xFC, 0xBC, 0x00, 0x3F, 0x91, 0xFF, 0x80,
-    0x0B, 0xE0, 0x07, 0xF4, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x3E, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0x0B, 0xF4, 0x00, 0x3F, 0x02, 0xEF,
-    0x40, 0x02, 0xFF, 0xF8, 0xF0, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F,
-    0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x14, 0x00, 0x07, 0x40, 0x78,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x24, 0x01, 0x80, 0x03, 0xC0, 0x3C, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0,
-    0x03, 0xF9, 0x2F, 0x80, 0xBD, 0x00, 0xF8, 0x0F, 0x80, 0x0F, 0x82, 0xF0, 0x01, 0xF4, 0x3E, 0x01,
-    0xBE, 0x07, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF4, 0x01, 0x80, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x02, 0xFF, 0xFC, 0x03, 0xF9, 0x2F, 0x82, 0xF4,
-    0x03, 0xE0, 0xF8, 0x00, 0xF8, 0xBC, 0x00, 0x7D, 0x3E, 0x01, 0xBE, 0x1F, 0xFF, 0xFE, 0x07, 0xFF,
-    0xF8, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFD,
-    0x00, 0x60, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x3E, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F, 0x8B, 0xC0, 0x07, 0xD3,
-    0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x00, 0x17, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3D, 0x40,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x7C, 0x00,
-    0x02, 0xE2, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F,
-    0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x50, 0x03, 0xD0, 0x3D, 0x00, 0x0F,
-    0x1F, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0x92, 0xF8, 0x0B, 0xD0, 0x0F, 0x80, 0xF8, 0x00,
-    0xF8, 0x2F, 0x00, 0x1F, 0x43, 0xE0, 0x1B, 0xE0, 0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x18,
-    0x01, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x01, 0xF0,
-    0x1F, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF,
-    0x0F, 0xC0, 0x01, 0x57, 0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00,
-    0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0x8B, 0x80, 0x00,
-    0x0F, 0x40, 0xF0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28,
-    0x00, 0x3F, 0xFF, 0x1F, 0x00, 0x3F, 0xD5, 0xFF, 0x80, 0x2F, 0x80, 0x1F, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00,
-    0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x7C,
-    0x00, 0xBF, 0x40, 0x0F, 0xC0, 0xBB, 0xD0, 0x02, 0xFF, 0xF9, 0xF0, 0x00, 0x2F, 0xF4, 0xBC, 0x00,
-    0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x01, 0xE4, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x02, 0x40, 0x00, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xD4, 0x5B, 0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x1F, 0xFF, 0x0F, 0xC0, 0x02, 0xFF, 0xF0, 0xFC,
-    0x00, 0x15, 0x7F, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x07,
-    0xC0, 0x7E, 0x00, 0x00, 0xBC, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18,
-    0x00, 0x01, 0xD0, 0x1E, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0xA0, 0x00, 0xFF, 0xFC, 0x7C, 0x00, 0xFF,
-    0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0,
-    0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x02, 0xF8, 0x01, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0x02, 0xEF,
-    0x40, 0x0B, 0xFF, 0xE7, 0xC0, 0x00, 0xBF, 0xD2, 0xF0, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x07, 0x90, 0x2F, 0xC0, 0x01, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xD4, 0x5B,
-    0xC0, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x1F, 0xFF, 0x0F, 0xC0, 0x02, 0xFF, 0xF0, 0xFC, 0x00, 0x15, 0x7F, 0x0F, 0xC0, 0x00,
-    0x03, 0xE0, 0xFC, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x7E, 0x00, 0x00, 0xBC, 0x03,
-    0xF4, 0x00, 0x0F, 0x80, 0x1F, 0xE0, 0x01, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF,
-    0x90, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x80, 0xA0, 0x00, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xFE, 0x00, 0xBE, 0x00, 0x7F,
-    0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x03, 0xE0, 0x00,
-    0x3E, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x03, 0xF0, 0x0B, 0xC0,
-    0x02, 0xF8, 0x01, 0xF0, 0x02, 0xFD, 0x00, 0x3F, 0x02, 0xEF, 0x40, 0x0B, 0xFF, 0xE7, 0xC0, 0x00,
-    0xBF, 0xD2, 0xF0, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x07, 0x90, 0x2F, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFD, 0x45, 0xBC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x2F, 0xFF, 0x0F, 0xC0, 0x01, 0x57,
-    0xF0, 0xFC, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x7C, 0x07, 0xE0,
-    0x00, 0x0B, 0xC0, 0x3F, 0x40, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0x3F, 0xFF, 0x1F, 0x00, 0x3F, 0xD5, 0xFF, 0x80,
-    0x2F, 0x80, 0x1F, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0xF8, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0xBF, 0x40, 0x0F, 0xC0, 0xBB, 0xD0, 0x02, 0xFF,
-    0xF9, 0xF0, 0x00, 0x2F, 0xF4, 0xBC, 0x00, 0x00, 0x40, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xE4, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2E, 0x00, 0xBC, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x7D, 0x00, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x01,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0xFD, 0x55, 0x55, 0xF8, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00,
-    0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x01, 0xF0,
-    0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0xD0, 0x3C, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x2F, 0xD0, 0x00, 0xF5, 0xFF, 0xF8, 0x01, 0xF7, 0xD5, 0xFC, 0x02, 0xFE,
-    0x00, 0x7C, 0x03, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40,
-    0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x0B, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x57, 0xE5, 0x55, 0x5B, 0xE5, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x07,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x55, 0x55, 0x7E,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40,
-    0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xBF, 0xAA,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xBD, 0x55, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x1A,
-    0x80, 0x00, 0xF4, 0xFF, 0xF4, 0x01, 0xF7, 0xE6, 0xFC, 0x02, 0xFF, 0x00, 0xBC, 0x02, 0xFC, 0x00,
-    0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0x80, 0x01, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x00, 0x03,
-    0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x05, 0x00,
-    0x10, 0x00, 0xBF, 0x81, 0xD0, 0x07, 0xFF, 0xFF, 0x00, 0x3C, 0x0B, 0xF0, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x01, 0x40, 0x04, 0x0B, 0xF8, 0x2C, 0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xC0, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x14, 0x00, 0x90, 0x02, 0xC0, 0x2D, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0x00, 0x00, 0x05, 0x00, 0x24, 0x3C, 0x02, 0xC0, 0xBF, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0xD4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x7D, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03,
-    0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0xB4, 0x00, 0xF0,
-    0x00, 0xB4, 0x00, 0x3C, 0x00, 0x0F, 0x90, 0x01, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xFF,
-    0x80, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xA4, 0x03, 0xD0, 0x1F, 0x40, 0xBC, 0x02, 0xF0, 0x0F, 0x80,
-    0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xBC, 0x03, 0xE0, 0x0F,
-    0x40, 0x00, 0x3F, 0xFF, 0x00, 0xF4, 0x01, 0xFF, 0xF8, 0x03, 0xD0, 0x00, 0x7D, 0x00, 0x1F, 0x00,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0xF4,
-    0x00, 0x7D, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00,
-    0x7C, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x0B, 0xFF, 0x80, 0x3E, 0x00,
-    0x7F, 0xFF, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x28,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0xA0, 0x00, 0xF4,
-    0x02, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xD0, 0x03, 0xE0,
-    0x07, 0xC0, 0x03, 0xD0, 0x0B, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0,
-    0x1F, 0x40, 0x0F, 0x80, 0x1F, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x47, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF4, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x01, 0xF4, 0xF0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x01,
-    0xF8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x01, 0xF4, 0x07, 0xE0, 0x00, 0x2F,
-    0x01, 0xF8, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x03, 0xD7, 0xE0, 0x00,
-    0x00, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xC1,
-    0xF4, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00,
-    0x3E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07, 0xC0, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xF0,
-    0x3F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x1F, 0x40,
-    0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0xA8, 0x00, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xD0, 0x00, 0x0F, 0xE3, 0xE0, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x1F, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0x15, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0xF4, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00,
-    0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0x80, 0x7C, 0x00, 0x3D,
-    0x03, 0xC0, 0x01, 0xF4, 0x1D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xE5, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xE0, 0x03, 0xE1, 0xF0, 0x00, 0xF8, 0xF4, 0x00,
-    0x7D, 0x78, 0x00, 0x1F, 0x14, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x04, 0x0B, 0xC0, 0x3E, 0x0F, 0xC0,
-    0x3E, 0x0F, 0x80, 0x28, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x7F, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x05, 0x00, 0xFC, 0xBC, 0x03, 0xE3, 0xF0,
-    0x0F, 0x46, 0x40, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x07, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0xB0, 0x00, 0x7E, 0xFC, 0x00, 0x2F, 0xF8, 0x00,
-    0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF9, 0x55, 0x50, 0xBF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7D, 0x40, 0x2F, 0xF0, 0x0F, 0xFC, 0x07, 0xF4, 0x0F, 0xF4,
-    0x0B, 0xFC, 0x00, 0x6F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00,
-    0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00,
-    0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00,
-    0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0,
-    0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F,
-    0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00,
-    0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02,
-    0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F,
-    0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00,
-    0x00, 0x2E, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00,
-    0x7C, 0x01, 0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4,
-    0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B,
-    0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00,
-    0x0F, 0x4B, 0xC0, 0x1F, 0x00, 0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03,
-    0xDF, 0x40, 0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE,
-    0x00, 0xB8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F,
-    0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC, 0x00,
-    0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
-    0x3D, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x2E, 0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C,
-    0x01, 0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03,
-    0xD1, 0xF0, 0x01, 0xF0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F,
-    0x4B, 0xC0, 0x1F, 0x00, 0x0F, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF,
-    0x40, 0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00,
-    0xB8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xF1,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA0, 0x2F, 0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xE5, 0xFC, 0x02, 0xFF, 0x00,
-    0xBD, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0xFC, 0x07, 0xD0, 0x00,
-    0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x1F, 0x40, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B,
-    0xC0, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x4A, 0x42, 0xFE, 0x07, 0x83, 0xD3, 0xFF, 0xF0, 0x40,
-    0xFB, 0xE5, 0xFD, 0x00, 0x7F, 0xC0, 0x0F, 0x80, 0x2F, 0xC0, 0x03, 0xE0, 0x0F, 0xE0, 0x01, 0xF4,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x03,
-    0xE0, 0x0F, 0xC0, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0xBC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x7D, 0x00,
-    0x0F, 0xC0, 0x2F, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E,
-    0x00, 0xBF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01,
-    0xFB, 0xC0, 0x00, 0xBC, 0x02, 0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1,
-    0xF0, 0x01, 0xF0, 0x03, 0xC0, 0xF4, 0x02, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C,
-    0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x03, 0xD0, 0x0F, 0x40, 0x1F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B,
-    0xC0, 0x1F, 0x00, 0x0B, 0x8B, 0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xEF, 0x40,
-    0x3D, 0x00, 0x02, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x64,
-    0x00, 0x00, 0x00, 0xA0, 0x2F, 0xD0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xF7, 0xD5, 0xFC, 0x02, 0xFE,
-    0x00, 0x7C, 0x02, 0xFC, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xBC, 0x07, 0xD0,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02, 0xF0, 0x0F, 0x40,
-    0x02, 0xF0, 0x1F, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x3D, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x04, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x1B, 0xF8, 0x00,
-    0xFE, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xE3, 0xF0,
-    0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0x00, 0x01, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x03,
-    0xC0, 0x3C, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F,
-    0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00,
-    0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x24,
-    0x00, 0x90, 0x00, 0xF0, 0x0B, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x6F, 0xC0,
-    0x2F, 0x40, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xBC, 0x3E, 0x00, 0x02, 0xF1, 0xF4,
-    0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD1, 0xF0, 0x00,
-    0x3F, 0x07, 0xE0, 0x01, 0xF4, 0x0F, 0xD0, 0x2F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x03, 0xE0, 0xF8, 0x00,
-    0x00, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x2E, 0x0B, 0x80, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x00,
-    0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x2F, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x07,
-    0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x7E, 0x00, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x01,
-    0xFD, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00,
-    0x2F, 0x0F, 0x80, 0x00, 0x1F, 0x0B, 0x80, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x01, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFE, 0x5B, 0xF0,
-    0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00,
-    0x01, 0xF4, 0x07, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFD, 0x01, 0xFD, 0x55, 0x54, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xFF, 0xFE,
-    0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x03, 0xF5, 0x55, 0x40, 0x3F, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x7E, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x6F, 0xD0, 0x00, 0xBF, 0xFF, 0x43, 0xFF, 0xF8, 0x03, 0xF9, 0x6F, 0xCF, 0xE5, 0xFC, 0x0B, 0xD0,
-    0x03, 0xFF, 0x00, 0x3D, 0x0F, 0x80, 0x02, 0xFC, 0x00, 0x3D, 0x2F, 0x00, 0x02, 0xF8, 0x00, 0xBC,
-    0x3E, 0x00, 0x02, 0xF0, 0x07, 0xF4, 0x7D, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x7C, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0xFC, 0x01, 0x90,
-    0x0F, 0xFF, 0xF8, 0xBF, 0xFF, 0xD0, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00, 0xF8, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7D, 0x03, 0xD0,
-    0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x0F, 0x95,
-    0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xD0, 0xBC, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0xF4, 0x00, 0xF1,
-    0xFF, 0x00, 0x1F, 0x7E, 0x60, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00,
-    0xF8, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03,
-    0xE0, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C,
-    0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x28, 0x0B, 0xD0, 0x03, 0xC7, 0xFC, 0x00, 0x7D, 0xF9, 0x80, 0x0B, 0xF8,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0xF1, 0xF4,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B, 0xFC, 0x00, 0xF8, 0x00, 0xBD,
-    0x01, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7D,
-    0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x07, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x00,
-    0x0F, 0x95, 0xF8, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x0B, 0xD0,
-    0xBC, 0x00, 0x03, 0xE0, 0x00, 0x14, 0x00, 0x50, 0x00, 0xB4, 0x0B, 0x80, 0x00, 0xF4, 0xF8, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x0B, 0xD0, 0x00, 0xF1, 0xFF, 0x00, 0x07, 0xDF, 0x98, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x74,
-    0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xF9, 0x1B, 0x40,
-    0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0,
-    0x90, 0x03, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x0F, 0x40,
-    0xF4, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xF4, 0xF4, 0x01, 0xF0,
-    0x0F, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xF9,
-    0x1B, 0x40, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xD0, 0x90, 0x03, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x06, 0xBD, 0x00, 0x00, 0x0B,
-    0xE4, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xBF, 0xFF, 0xC0, 0xBE, 0x46, 0xD0, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x24, 0x00, 0xFC,
-    0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x06, 0xBD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0xFF, 0x41, 0xB8, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x74, 0x01, 0xBF, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x07, 0x80, 0xBC, 0x00, 0x2E, 0x3E, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF,
-    0xFF, 0x00, 0xBE, 0x46, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x90, 0x03, 0xF0, 0x0F, 0xFF, 0xFE, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F,
-    0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x6B, 0xD0,
-    0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x2F,
-    0x00, 0x06, 0xFE, 0xA4, 0xBF, 0xFF, 0xD0, 0x6F, 0x55, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0x00, 0xAF, 0xC0, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x1F, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB4, 0x00, 0x75, 0xE0,
-    0x00, 0xF1, 0x40, 0x02, 0xF0, 0x00, 0x1B, 0xFA, 0x90, 0xBF, 0xFF, 0xD0, 0x1B, 0xD5, 0x40, 0x0B,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2A, 0xBF, 0xA9,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x15, 0xFD, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00, 0x06, 0xFE, 0xA4, 0xBF, 0xFF, 0xD0, 0x6F, 0x55,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x0B, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xFF,
-    0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x0B, 0xFC, 0x1D,
-    0x00, 0x00, 0x3E, 0xFF, 0xF0, 0x00, 0x02, 0xC0, 0xBF, 0x40, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x03,
-    0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x04,
-    0x00, 0x0F, 0xF4, 0x3C, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x38, 0x1F, 0xE0, 0x00, 0x10, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00,
-    0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0,
-    0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03,
-    0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00,
-    0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0,
-    0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x05, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00,
-    0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x80, 0x09, 0x00, 0x00, 0x0B, 0x40,
-    0xB4, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xD0,
-    0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00,
-    0x03, 0xD0, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x03, 0xE0,
-    0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x60, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03,
-    0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F,
-    0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F,
-    0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x01,
-    0xFB, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x00, 0x38, 0x0D, 0x00, 0x00, 0x00, 0xB4, 0xB0,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00,
-    0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-    0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01,
-    0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01,
-    0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x03, 0xEF, 0x40,
-    0x00, 0x07, 0x43, 0xC0, 0x00, 0x07, 0x02, 0xC0, 0x00, 0x03, 0x87, 0x80, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC,
-    0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0,
-    0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0,
-    0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40,
-    0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-    0x00, 0xF0, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x3D,
-    0x02, 0xF0, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xF4,
-    0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x07, 0xD0, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00,
-    0xBC, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x02,
-    0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00,
-    0x03, 0xF0, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x40, 0x00, 0x1F, 0x47, 0xD0, 0x00,
-    0x0F, 0x83, 0xD0, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0x01, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0, 0x07, 0xD0, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x02, 0xF0, 0x07, 0xD0, 0x00,
-    0xF8, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x0B, 0xC0, 0x0F, 0x40,
-    0x03, 0xF0, 0x07, 0xD0, 0x02, 0xF8, 0x01, 0xF0, 0x01, 0xFD, 0x00, 0x7E, 0x02, 0xEF, 0x40, 0x0F,
-    0xFF, 0xE3, 0xC0, 0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B,
-    0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00,
-    0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0,
-    0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F,
-    0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03,
-    0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F,
-    0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F,
-    0x00, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0xF8,
-    0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x4B, 0xC0, 0x02, 0xFF, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0xFB, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xBD, 0xF0, 0x02, 0xF0, 0x2F, 0x00,
-    0x3D, 0x7C, 0x00, 0xF8, 0x0B, 0xC0, 0x1F, 0x0F, 0x00, 0x7C, 0x02, 0xF0, 0x0F, 0x43, 0xC0, 0x3E,
-    0x00, 0x7C, 0x07, 0xC0, 0xF0, 0x1F, 0x40, 0x1F, 0x03, 0xE0, 0x3C, 0x0B, 0xC0, 0x07, 0xC1, 0xF0,
-    0x0F, 0x03, 0xD0, 0x01, 0xF0, 0xF8, 0x03, 0xC2, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0xF4, 0xF4, 0x00,
-    0x1F, 0x2E, 0x00, 0x3D, 0x7C, 0x00, 0x03, 0xCF, 0x00, 0x0F, 0x7E, 0x00, 0x00, 0xF7, 0xC0, 0x03,
-    0xDF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x8B,
-    0x80, 0x00, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x01, 0xA0, 0x00, 0x68, 0x7C, 0x00, 0x3F, 0x40, 0x0F, 0x87, 0xC0, 0x0B,
-    0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xFB, 0x40, 0x3F, 0x03, 0xD0, 0x2E, 0xB4, 0x07, 0xD0, 0x3D, 0x03,
-    0xCB, 0x40, 0xFC, 0x03, 0xD0, 0x7C, 0xB8, 0x0F, 0x40, 0x3D, 0x0F, 0x4B, 0x82, 0xF0, 0x03, 0xD1,
-    0xF0, 0xB8, 0x3D, 0x00, 0x3D, 0x3D, 0x07, 0x8B, 0xC0, 0x03, 0xD7, 0xC0, 0x78, 0xF8, 0x00, 0x3D,
-    0xB4, 0x07, 0x9F, 0x00, 0x03, 0xDF, 0x00, 0x7A, 0xE0, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0x03,
-    0xFC, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00,
-    0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F,
-    0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x2E, 0x00, 0x00, 0x03,
-    0xD0, 0x3D, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00,
-    0xA8, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00,
-    0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00,
-    0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3E,
-    0x0B, 0xC0, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00,
-    0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0,
-    0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x02,
-    0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xE0, 0x01, 0x55, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2A, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x90, 0x0F, 0xFF,
-    0xFE, 0x00, 0x55, 0x5F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x07, 0x80, 0xB8, 0x00, 0x00, 0x3D, 0x3E, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x02, 0xAA, 0xAA, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x04, 0x00, 0x14, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x7D, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x00, 0xFF,
-    0xFF, 0xE0, 0x01, 0x55, 0x7F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0x81, 0xF4, 0x00, 0xFF,
-    0x41, 0xBF, 0x9F, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0,
-    0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x06, 0xF9, 0x01, 0xF8, 0x00, 0xBF, 0xFF, 0x4F, 0xC0, 0x0F, 0xE5, 0xBF, 0xF8, 0x00, 0xBD, 0x00,
-    0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0,
-    0x07, 0xD0, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0xBE,
-    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x1B, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xD2, 0xFF, 0xFE, 0x00, 0x3F, 0xD0, 0x6F, 0xFF, 0x41, 0xFC, 0x03, 0xF8, 0x00, 0x1F, 0xE0,
-    0x01, 0xF4, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0x4B,
-    0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF1, 0xF8, 0x00, 0x00,
-    0x0F, 0xC0, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0xF4, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xE0, 0xBC, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0x41, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x7C, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x02, 0xF0,
-    0x07, 0xF8, 0x06, 0xFD, 0x00, 0x0F, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x3E, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x06,
-    0xF8, 0x00, 0x2F, 0xFF, 0xCB, 0xFF, 0xC0, 0x3F, 0x96, 0xFF, 0x96, 0xF4, 0x2F, 0x40, 0x2F, 0x40,
-    0x3E, 0x1F, 0x80, 0x03, 0xD0, 0x0F, 0x8B, 0xC0, 0x00, 0xF8, 0x03, 0xD3, 0xE0, 0x00, 0x3E, 0x01,
-    0xF5, 0xF4, 0x00, 0x0F, 0x80, 0x7C, 0x7C, 0x00, 0x03, 0xD0, 0x2F, 0x2F, 0x00, 0x01, 0xF0, 0x0F,
-    0x8B, 0xC0, 0x00, 0xFC, 0x03, 0xD1, 0xF0, 0x00, 0x3D, 0x01, 0xF0, 0x7D, 0x00, 0x3F, 0x00, 0xBC,
-    0x0F, 0xD0, 0x3F, 0x40, 0x3F, 0x00, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x0F, 0xFE, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0x07, 0xE7, 0xF5,
-    0x6F, 0xF2, 0xF0, 0xF8, 0x00, 0xBD, 0xB8, 0x3D, 0x00, 0x0F, 0x85, 0x1F, 0x40, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x2F, 0x80,
-    0x1F, 0x55, 0xBF, 0xC0, 0x0B, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x2F,
-    0x80, 0x00, 0x3D, 0x7F, 0xFD, 0x00, 0x1F, 0x7D, 0x6F, 0xC0, 0x0B, 0xF8, 0x02, 0xF4, 0x02, 0xFC,
-    0x00, 0x7D, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x01, 0xF4, 0x0B,
-    0xC0, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x0B, 0xC0,
-    0x1F, 0xC0, 0x07, 0xE0, 0x0B, 0xF8, 0x07, 0xF0, 0x03, 0xEB, 0xFF, 0xF0, 0x00, 0xF4, 0xBF, 0xE0,
-    0x00, 0x7D, 0x01, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xD0, 0x0B, 0xD5, 0x6F, 0xD0, 0x2F, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x3F, 0x03, 0xD0, 0x00,
-    0xBC, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0xBD, 0x0F, 0x80, 0x1F, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xD5, 0xBC, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0xF4,
-    0x03, 0xF0, 0x07, 0xD0, 0x07, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x39, 0x47, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1B, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0xFF, 0xFF, 0x80, 0x2E, 0x47, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0xE0, 0x0B,
-    0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F,
-    0x80, 0x18, 0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x5A, 0xAA, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x95,
-    0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x50, 0x1F, 0xFC,
-    0x3F, 0xBE, 0x7C, 0x2F, 0x7D, 0x3F, 0x3F, 0xFE, 0x0F, 0xFD, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xD0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x1F, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x3D, 0x00,
-    0x7D, 0x00, 0x3E, 0x04, 0x3F, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00,
-    0x2F, 0x00, 0x1B, 0xFA, 0x9B, 0xFF, 0xFD, 0x1B, 0xD5, 0x40, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x01,
-    0xF0, 0x00, 0x2F, 0x00, 0x07, 0xE0, 0x07, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x06, 0xFF, 0xFF, 0xFF,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xC7, 0xF5, 0x7F, 0x95, 0x52, 0xF0, 0x0B, 0xC0, 0x00, 0xB8, 0x03, 0xE0,
-    0x00, 0x05, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xD0, 0x07, 0xFF, 0x40, 0x3F,
-    0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x06, 0xFE, 0xA4, 0xBF, 0xFF, 0xD0, 0x6F,
-    0x55, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x00,
-    0xFF, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0xD4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xF1, 0xF4,
-    0x03, 0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x07,
-    0xE4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0A, 0x40, 0x01, 0xA0, 0xF8, 0x07, 0xD0, 0x00,
-    0xBC, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0xBC, 0x00, 0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0,
-    0x00, 0x07, 0xD0, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x7E, 0x02, 0xEF, 0x40,
-    0x00, 0x0F, 0xFF, 0xE3, 0xC0, 0x00, 0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x04, 0x00, 0x50, 0x0F, 0xC0, 0xBD, 0x07,
-    0xD0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x14, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0x00, 0xF8, 0xB8, 0x3D,
-    0x03, 0xD1, 0x00, 0x04, 0x01, 0x40, 0x04, 0x0B, 0xF8, 0x1C, 0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0,
-    0x10, 0x00, 0x40, 0x7F, 0xFF, 0x3F, 0xFF, 0xC5, 0x55, 0x50, 0x2A, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF,
-    0xC2, 0xAA, 0xAA, 0x90, 0x20, 0x01, 0x9E, 0x01, 0xE3, 0xFF, 0xF0, 0x7F, 0xF0, 0x01, 0x40, 0x00,
-    0x14, 0xBC, 0xFC, 0x64, 0x00, 0x01, 0x0F, 0x03, 0xD7, 0xC0, 0xF4, 0x90, 0x14, 0x3F, 0x82, 0xBE,
-    0x01, 0xE0, 0x2E, 0x3F, 0x83, 0xC0, 0x34, 0x00, 0x0B, 0x90, 0xFB, 0xD3, 0x43, 0xDC, 0x0B, 0x38,
-    0x78, 0x7F, 0xC0, 0x10, 0x00, 0x00, 0x50, 0x14, 0x03, 0xE0, 0xF8, 0x0F, 0x83, 0xE0, 0x2E, 0x0B,
-    0x80, 0x78, 0x1E, 0x00, 0x10, 0x10, 0x00, 0x10, 0x00, 0x43, 0xC0, 0x7C, 0x1F, 0x2F, 0x00, 0xFF,
-    0xC0, 0x07, 0xF0, 0x00, 0x14, 0x00, 0x00, 0x03, 0xD0, 0xF4, 0x3C, 0x1F, 0x0B, 0x83, 0xD0, 0xF0,
-    0x28, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xD2, 0xE0, 0xF0, 0xF8, 0x7C, 0x3D, 0x2F, 0x0A, 0x06, 0x40,
-    0x14, 0x05, 0x00, 0xF8, 0x3E, 0x01, 0xF0, 0x7C, 0x02, 0xE0, 0xB8, 0x03, 0xC0, 0xF0, 0x01, 0x00,
-    0x40, 0x00, 0x60, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0x09, 0x18, 0x38, 0x03, 0xC3, 0xFF, 0xF4,
-    0x0F, 0xFD, 0x00, 0x04, 0x00, 0x01, 0xA4, 0x07, 0xFF, 0x87, 0xEA, 0xF2, 0xC0, 0x1D, 0x40, 0x01,
-    0x00, 0x00, 0xE0, 0x3D, 0x07, 0xC0, 0xF8, 0x2F, 0x03, 0xE0, 0xBD, 0x05, 0x40, 0x03, 0xE0, 0x7D,
-    0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xD0, 0x78, 0x01, 0x00, 0x7C, 0x7D, 0x3D, 0x3D, 0x3D, 0x2D, 0x1D,
-    0x04, 0x03, 0xE0, 0x7D, 0x0F, 0xC0, 0xF4, 0x2F, 0x03, 0xD0, 0x78, 0x01, 0x00, 0x14, 0x03, 0xF0,
-    0x1F, 0x00, 0xB8, 0x03, 0xC0, 0x04, 0x00, 0x54, 0x0B, 0xD0, 0x7E, 0x03, 0xE0, 0x3D, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0x16, 0xEB, 0xFD, 0x57, 0xC0, 0x3C, 0x01, 0x40, 0x00, 0x00, 0x78, 0x02,
-    0xE5, 0x0F, 0xFD, 0x3D, 0x50, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x2A, 0xAB,
-    0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x02, 0xF0, 0x0B, 0xD0, 0x3F, 0x40, 0x24, 0x00, 0x07, 0x4B,
-    0x83, 0x80, 0xD0, 0x3C, 0x07, 0x40, 0x00, 0x01, 0x80, 0x0F, 0x00, 0x3C, 0x1B, 0xF9, 0xBF, 0xF4,
-    0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x07, 0xC0, 0x07, 0x80, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x3C, 0x1F, 0xFF, 0x6F, 0xE4, 0x2D, 0x00, 0x60, 0x00, 0x6A, 0xAA, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x01, 0xF0, 0x0B, 0x85, 0xBD, 0x2F, 0xF0, 0x7E,
-    0x00, 0x00, 0x03, 0xE0, 0x3D, 0x07, 0xC0, 0xBC, 0x0B, 0x80, 0xBD, 0x47, 0xFC, 0x2F, 0xC0, 0x00,
-    0x3E, 0x3F, 0x3D, 0x00, 0x04, 0x01, 0x0F, 0x42, 0xE3, 0xD0, 0xF8, 0x50, 0x18, 0x0B, 0x90, 0xFB,
-    0xD7, 0x03, 0x9C, 0x0F, 0x78, 0x78, 0xBF, 0xC0, 0x10, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0xF0, 0x74,
-    0x14, 0x00, 0x03, 0x40, 0xF0, 0x0F, 0xC0, 0x2E, 0x02, 0xEA, 0xBC, 0xFE, 0x00, 0x03, 0xC0, 0xF0,
-    0x3C, 0x03, 0xC0, 0x3D, 0x42, 0xFC, 0x01, 0x00, 0x00, 0x02, 0xE0, 0xF4, 0x3D, 0x1F, 0x07, 0xC2,
-    0xE0, 0xF4, 0x28, 0x00, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x78, 0x00, 0x3C, 0xB4, 0x00, 0x3C,
-    0xF0, 0x00, 0x78, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x3C, 0x0E, 0x79, 0xBD, 0x7C, 0x2F,
-    0xDF, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x53, 0xD0, 0x3D, 0x0F, 0x1F, 0x40, 0xBF, 0xD0, 0x03,
-    0xF4, 0x00, 0x15, 0x00, 0x00, 0x50, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x01, 0xF1, 0xF0, 0xBC, 0x07,
-    0x85, 0x00, 0x14, 0x90, 0x02, 0x3C, 0x03, 0xCB, 0xFF, 0xE0, 0xFF, 0xE0, 0x01, 0x40, 0x00, 0x01,
-    0xA4, 0x03, 0xFF, 0xC3, 0xFA, 0xF8, 0xE0, 0x0F, 0x10, 0x00, 0x40, 0x01, 0x40, 0x14, 0x7F, 0xD0,
-    0xE3, 0xEF, 0xFF, 0x1D, 0x0B, 0xF4, 0x10, 0x01, 0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0xD1, 0x55, 0x50,
-    0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE6, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x07, 0xFF, 0xFF, 0xF0, 0x55,
-    0x55, 0x55, 0x00, 0x01, 0x40, 0x04, 0x0F, 0xF4, 0x2C, 0x2F, 0xFF, 0xF8, 0x38, 0x1F, 0xF0, 0x10,
-    0x00, 0x00, 0x2A, 0xAA, 0xA9, 0xBF, 0xFF, 0xFE, 0x6A, 0xAA, 0xA8, 0x15, 0x55, 0x55, 0x55, 0x55,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x7F, 0x80, 0x2F, 0xD0, 0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x01, 0xF0, 0x2C, 0x0B, 0x0B, 0x8B, 0x80, 0x00, 0x28, 0x00, 0x18, 0x3C, 0x00, 0x2C,
-    0x78, 0x00, 0x3C, 0xB9, 0x55, 0x7C, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x39, 0x55, 0x7C, 0x74, 0x00, 0x38, 0xB0, 0x00, 0x74, 0xBF, 0xFF, 0xF0, 0xAA, 0xAA,
-    0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3D, 0x7E, 0x6D, 0xB0, 0x38, 0x1D, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x2D, 0x7C, 0x1F, 0xF0, 0x0F, 0xC0, 0x3F, 0xF0, 0x74, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x7D, 0x03, 0xD0, 0x0B, 0x80, 0x0F, 0x00, 0x3C, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x07, 0xFF, 0xFF, 0xF4, 0x15, 0x55, 0x55, 0x00, 0x14, 0x03, 0xF0, 0x1F, 0x00, 0xB8, 0x02,
-    0xD0, 0x04, 0x01, 0x50, 0x1F, 0x80, 0xFC, 0x0B, 0x80, 0xB8, 0x01, 0x40, 0x00, 0x01, 0x40, 0x04,
-    0x0B, 0xF8, 0x1C, 0x1F, 0xFF, 0xFC, 0x3C, 0x0F, 0xF0, 0x10, 0x00, 0x40, 0x2A, 0x03, 0xFC, 0x07,
-    0xC0, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x10, 0xFC, 0x03, 0xD7, 0xDB, 0xDF, 0x7E, 0x3E,
-    0x24, 0xF0, 0x60, 0x01, 0x00, 0x00, 0x19, 0x0F, 0x43, 0xD0, 0xFE, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x3E, 0xAA, 0xAB, 0x87, 0x80, 0x00, 0x74, 0xB4, 0x00, 0x0B, 0x4A, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xF4, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xD1,
-    0xF0, 0xF4, 0xB8, 0x7C, 0x3D, 0x1F, 0x0A, 0x06, 0x40, 0x15, 0x51, 0xFF, 0xC6, 0xAF, 0x00, 0x78,
-    0x02, 0xD0, 0x0F, 0x00, 0x00, 0x04, 0x00, 0x05, 0x34, 0x51, 0xFF, 0xC3, 0x8F, 0xBF, 0xFC, 0x70,
-    0xFF, 0xD0, 0x47, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1D,
-    0x00, 0x06, 0x90, 0x1C, 0x1F, 0xFD, 0x7C, 0x3D, 0xBF, 0xF4, 0x74, 0x0B, 0xD0, 0x00, 0x60, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x0D, 0x0F, 0xFF, 0xBC, 0x1C,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x34, 0x2F, 0xFD, 0xF0, 0x74, 0x2F, 0xD0, 0x10, 0x01,
-    0x00, 0x00, 0x81, 0x40, 0x1E, 0x0B, 0x43, 0xFF, 0xFF, 0x87, 0xEA, 0xF8, 0x07, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x1F, 0xC2, 0xF9, 0x0F, 0x01, 0xE0, 0x2D, 0x00, 0x7F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,
-    0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90, 0x00, 0x84, 0x01, 0x20, 0x00, 0x00, 0x0C,
-    0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x60, 0x60, 0x00, 0x00, 0xA0, 0x97, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30, 0xD7, 0x04, 0x00, 0x00, 0x01, 0x0D, 0x70,
-    0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34, 0x00, 0x87, 0x00, 0x00, 0x50, 0x00, 0x0D,
-    0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8, 0x02, 0xAD, 0x7F, 0xC0, 0x7F, 0xD0, 0x3F,
-    0xD0, 0x00, 0x38, 0x0B, 0xE0, 0x3F, 0x1F, 0xFF, 0x48, 0x00, 0x07, 0x4B, 0x83, 0x81, 0xD0, 0x3C,
-    0x07, 0x40, 0x00, 0x01, 0xA4, 0x03, 0xFF, 0xC3, 0xEA, 0xF9, 0xD0, 0x0E, 0x11, 0xE1, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92, 0x03, 0xFE, 0x07, 0xF0, 0x3F, 0xD0, 0xF7, 0x80,
-    0x00, 0x00, 0x00, 0x50, 0xBD, 0x3F, 0x43, 0xE0, 0x1B, 0xD0, 0x0A, 0x90, 0x0B, 0xE0, 0x1F, 0xC0,
-    0xBC, 0x7E, 0x4A, 0x00, 0x90, 0x01, 0x40, 0xBD, 0x03, 0xE0, 0x1F, 0xC7, 0xF0, 0x0F, 0xCB, 0x74,
-    0xBE, 0x0E, 0x38, 0xD0, 0x2C, 0x1C, 0x00, 0x2C, 0x1E, 0x0B, 0x0F, 0x2D, 0xF4, 0x00, 0x14, 0xBC,
-    0xFC, 0x64, 0x03, 0x80, 0x8E, 0x53, 0xFF, 0x82, 0xF4, 0x1E, 0xF0, 0x22, 0x40, 0x00, 0x00, 0x00,
-    0x2F, 0xDB, 0xF4, 0x79, 0xBD, 0x7C, 0xB0, 0x38, 0x0D, 0xB0, 0x38, 0x0D, 0x79, 0xFE, 0x7C, 0x1F,
-    0xD7, 0xF0, 0x34, 0x07, 0x00, 0xBF, 0xDA, 0xBC, 0x02, 0xC0, 0x24, 0x2C, 0x00, 0x00, 0x00, 0x02,
-    0xD2, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x3F, 0xE5, 0x56, 0xFF,
-    0x40, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0xA9, 0x40, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x0B, 0x5F, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xE9, 0x56, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xAA, 0x94, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xE5, 0x55, 0x55, 0x55, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x15, 0x55, 0x55, 0x54, 0x00, 0x55, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x90, 0x00, 0x3C, 0x3E,
-    0x9A, 0xFF, 0xFE, 0xBF, 0x4B, 0x40, 0x00, 0x6F, 0xFF, 0xD0, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE4, 0x00, 0x6F, 0xD0,
-    0x3F, 0x40, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x99, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x0E, 0x6C, 0x28, 0x1C, 0x30, 0x28, 0x30, 0x34, 0x30, 0xB0, 0x2F, 0x70, 0x00,
-    0x00, 0x01, 0x41, 0xDE, 0x30, 0xAB, 0xB8, 0xE0, 0x0A, 0x00, 0x3F, 0x80, 0x00, 0x05, 0x05, 0x04,
-    0x0C, 0x1C, 0x28, 0x34, 0x30, 0x60, 0x01, 0x40, 0x39, 0xD2, 0x81, 0xCC, 0x07, 0x30, 0x28, 0xC0,
-    0xC1, 0xFD, 0x00, 0x04, 0x04, 0x1C, 0x0C, 0x28, 0x1C, 0x34, 0x28, 0x30, 0x34, 0x30, 0xB0, 0x2F,
-    0x70, 0x00, 0x00, 0x01, 0x51, 0xE5, 0x34, 0x07, 0x00, 0x60, 0x07, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x07, 0x00, 0x0A, 0x01, 0x4D, 0x0E, 0x6C, 0x28, 0x1C, 0x30, 0x28, 0x70, 0x34, 0x30, 0xB0, 0x2F,
-    0x70, 0x00, 0x00, 0x0A, 0x00, 0x34, 0x00, 0xC5, 0x07, 0x9B, 0x2C, 0x1C, 0x90, 0x63, 0x02, 0x4C,
-    0x0C, 0x60, 0x30, 0x04, 0x50, 0x50, 0x39, 0xE9, 0xA1, 0xC1, 0xC1, 0xCA, 0x0A, 0x0A, 0x30, 0x34,
-    0x34, 0xC0, 0xC0, 0xC6, 0x06, 0x03, 0x00, 0x04, 0x50, 0xE9, 0x1C, 0x02, 0x80, 0x34, 0x03, 0x00,
-    0x70, 0x00, 0x08, 0x0B, 0x47, 0x90, 0xC0, 0x30, 0x1C, 0x0A, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x11,
-    0x80, 0xC7, 0x0D, 0x0C, 0x70, 0x33, 0x00, 0xE8, 0x02, 0xC0, 0x00, 0x04, 0x04, 0x0D, 0x28, 0x07,
-    0xA0, 0x03, 0x80, 0x0B, 0xC0, 0x1C, 0xD0, 0x70, 0x70, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3F, 0x7D, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x7F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0F, 0xD5, 0x6F, 0xE0,
-    0x03, 0xE0, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x01, 0xF8, 0x03, 0xD0, 0x02, 0xFC, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x3F, 0x00, 0x6F, 0x80, 0x0F, 0x80, 0x02, 0xF4, 0x03, 0xD0, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0xFC, 0x07,
-    0xD0, 0x06, 0xFD, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFB, 0xD0, 0x00, 0x00, 0x1F, 0x3D, 0x00, 0x00, 0x03, 0xE2, 0xE0, 0x00, 0x00, 0xBC, 0x2F,
-    0x00, 0x00, 0x0F, 0x41, 0xF0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0x00, 0x0F,
-    0x80, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0B, 0x80, 0x0B, 0xC0, 0x00, 0xBC,
-    0x00, 0xF4, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xD0, 0x00, 0x03, 0xD0, 0xFC, 0x00,
-    0x00, 0x3E, 0x1F, 0x95, 0x55, 0x57, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x2A, 0xAA,
-    0xAF, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00,
-    0x0F, 0x40, 0x3E, 0x00, 0x00, 0x7D, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x03, 0xF5, 0x55, 0x57, 0xE0, 0x0F, 0x80, 0x00, 0x0F,
-    0x40, 0x3D, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x3F,
-    0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x07, 0xD0, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00,
-    0x2F, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90,
-    0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F,
-    0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B, 0xCB, 0xD2, 0xAA, 0xA9, 0x2F, 0x2F, 0x0F, 0xFF, 0xF0, 0xFC,
-    0xFC, 0x2A, 0xAA, 0x83, 0xF3, 0xF0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F,
-    0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x0B,
-    0xC0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x01, 0xF4, 0x07, 0xE0,
-    0x00, 0x2F, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00, 0x03, 0xD7,
-    0xE0, 0x00, 0x00, 0x7D, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00,
-    0x0F, 0xC1, 0xF4, 0x00, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x07,
-    0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0x7C, 0x00,
-    0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x01, 0xF4, 0x02, 0xF0, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00,
-    0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0x83, 0xF0,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xBF,
-    0x40, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x00, 0xFB, 0x80, 0x00, 0x0F, 0xBC,
-    0x01, 0xF7, 0xC0, 0x00, 0x2E, 0xF8, 0x02, 0xF7, 0xC0, 0x00, 0x7C, 0xF8, 0x03, 0xE3, 0xC0, 0x00,
-    0xF8, 0xF4, 0x03, 0xD3, 0xC0, 0x01, 0xF1, 0xF0, 0x03, 0xD3, 0xC0, 0x03, 0xD2, 0xF0, 0x07, 0xC3,
-    0xD0, 0x07, 0xC3, 0xE0, 0x0B, 0xC2, 0xD0, 0x0F, 0x43, 0xD0, 0x0F, 0x82, 0xE0, 0x2F, 0x07, 0xD0,
-    0x0F, 0x41, 0xE0, 0x3D, 0x0B, 0xC0, 0x0F, 0x01, 0xF0, 0xB8, 0x0B, 0xC0, 0x1F, 0x00, 0xF0, 0xF0,
-    0x0F, 0x80, 0x2F, 0x00, 0xF2, 0xE0, 0x0F, 0x40, 0x3E, 0x00, 0xF7, 0xC0, 0x1F, 0x00, 0x3D, 0x00,
-    0xFF, 0x80, 0x2F, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x3E, 0x00,
-    0xB8, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2E, 0x00, 0xBF, 0x00, 0x00, 0x3D,
-    0x00, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0xFF, 0x80, 0x00, 0x7C, 0x01, 0xFB, 0xC0, 0x00, 0xBC, 0x02,
-    0xF3, 0xD0, 0x00, 0xF8, 0x03, 0xE3, 0xE0, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x01, 0xF0, 0x03, 0xD0,
-    0xF4, 0x01, 0xF0, 0x07, 0xC0, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
-    0x03, 0xD0, 0x0F, 0x40, 0x2F, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x4B, 0xC0, 0x1F, 0x00, 0x0F, 0x8B,
-    0x80, 0x2F, 0x00, 0x07, 0xCF, 0x80, 0x3E, 0x00, 0x03, 0xDF, 0x40, 0x3D, 0x00, 0x02, 0xFF, 0x00,
-    0x7C, 0x00, 0x01, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0xFE, 0x00, 0xB8, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x6F,
-    0xE0, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00,
-    0x00, 0x2F, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x81, 0xF8,
-    0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x55, 0x56, 0xF8, 0x00, 0xF8, 0x00, 0x01, 0xF4,
-    0x01, 0xF4, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x00,
-    0x1F, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFD, 0x5B,
-    0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0xFC, 0x07, 0xC0, 0x02, 0xF8, 0x0B, 0xD5, 0x6F,
-    0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xA4, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0x5A, 0xAA, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x95, 0x55, 0x50, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x15, 0x5F, 0xD5, 0x54, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80,
-    0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFA,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xE6, 0xF9, 0xBF, 0xD0, 0x0B, 0xE0, 0x07,
-    0xC0, 0x1F, 0xC0, 0xBE, 0x00, 0x2F, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x2F, 0x00,
-    0x03, 0xE0, 0x00, 0xFC, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF3, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x8F,
-    0x80, 0x02, 0xF0, 0x00, 0x7D, 0x3E, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0xFC, 0x00, 0x3D, 0x00, 0x1F,
-    0x82, 0xF8, 0x01, 0xF0, 0x01, 0xFC, 0x03, 0xF9, 0x0B, 0xC0, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1B, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x0F,
-    0x40, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xD0,
-    0x1F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00,
-    0x2F, 0x03, 0xD0, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00,
-    0x3E, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0x80, 0x0F,
-    0x80, 0x0F, 0x81, 0xF4, 0x01, 0xF4, 0x01, 0xF4, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x02,
-    0xF0, 0x02, 0xF0, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x03, 0xD0, 0x03, 0xD0, 0x03, 0xD0, 0x7D, 0x00,
-    0x7D, 0x00, 0x7C, 0x07, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0,
-    0x0F, 0x80, 0x3F, 0x00, 0x3F, 0x80, 0xF4, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x90, 0x1F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xBE,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x7D,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x01, 0xF4,
-    0x3F, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x55, 0xF8, 0x03, 0xF5, 0x50, 0x7F,
-    0xFF, 0x03, 0xFF, 0xFC, 0x2F, 0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x28, 0x03, 0xFF,
-    0xF1, 0xE0, 0x3F, 0x96, 0xEF, 0x82, 0xF4, 0x01, 0xFD, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0F,
-    0xC3, 0xE0, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0xF4, 0xBC, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x3F, 0x0B,
-    0xC0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xE0, 0xBC, 0x00, 0xBF, 0x41, 0xF8, 0x0B, 0xBD, 0x03, 0xFF,
-    0xF4, 0xFE, 0x03, 0xFF, 0x43, 0xF8, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x07,
-    0xD0, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x03, 0xD0, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3D,
-    0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xBC, 0x2B, 0xF8, 0x00, 0x0B, 0xC7, 0xFD, 0x00,
-    0x00, 0xF8, 0x16, 0xF8, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x01, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0x3F, 0x00,
-    0x7C, 0x00, 0x07, 0xD0, 0x0B, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x9F, 0xFF,
-    0x80, 0x01, 0xF4, 0x05, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x06, 0x9F, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0xF9, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x0F, 0x40, 0x0B, 0xC3, 0xD0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xF8, 0x0B, 0x80,
-    0x7C, 0x02, 0xE0, 0x3D, 0x00, 0xB8, 0x2E, 0x00, 0x1F, 0x2F, 0x00, 0x07, 0xEF, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0x40, 0x2C, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0x80, 0x0F, 0xC0, 0x0B, 0xC0,
-    0x3F, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0,
-    0xFC, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBD, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x7F, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00,
-    0x3F, 0xFF, 0xD0, 0x2F, 0x91, 0xB0, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x05, 0x01, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xD0,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xFE, 0xBF, 0x40,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0xE0, 0x00, 0xF1, 0xFF, 0xF8, 0x01, 0xFB, 0xE5,
-    0xFC, 0x02, 0xFF, 0x00, 0xBD, 0x03, 0xFC, 0x00, 0x7D, 0x03, 0xF4, 0x00, 0xBC, 0x07, 0xF0, 0x00,
-    0xFC, 0x07, 0xD0, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x02,
-    0xF0, 0x1F, 0x40, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0xFC,
-    0x01, 0xF4, 0x02, 0xF0, 0x0F, 0x80, 0x07, 0xD0, 0x7C, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x3D, 0x0F,
-    0x40, 0x01, 0xF4, 0x7C, 0x00, 0x07, 0xC2, 0xF5, 0x55, 0x6F, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xE1, 0xF0, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x7C, 0x2F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x0F,
-    0x82, 0xF0, 0x00, 0x7C, 0x0B, 0xC0, 0x03, 0xE0, 0x1F, 0x00, 0x2F, 0x00, 0x3F, 0x02, 0xF4, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x02, 0x90, 0x1F, 0x40, 0x7C,
-    0x02, 0xF0, 0x0F, 0x80, 0x3D, 0x01, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00,
-    0xBC, 0x02, 0xF4, 0x07, 0xFF, 0x8B, 0xFD, 0x01, 0x40, 0x00, 0xA4, 0x00, 0xA8, 0x00, 0xF4, 0x03,
-    0xF0, 0x01, 0xF0, 0x0F, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x03, 0xDB, 0xC0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xE3, 0xE0,
-    0x00, 0x0F, 0x82, 0xF0, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x1F, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0xFB, 0x80, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x0F, 0x83,
-    0xC0, 0x00, 0x1F, 0x03, 0xD0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7C, 0x03, 0xE0, 0x00, 0xF8, 0x02,
-    0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xE0, 0x01, 0xF0, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x40, 0x00,
-    0xFE, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x02, 0x80, 0x03, 0xD0,
-    0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0F, 0x40,
-    0x0F, 0x80, 0x01, 0xF0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0x3D, 0x00, 0x3F, 0x00, 0x07, 0xD0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x2F, 0xC0, 0x07,
-    0xD0, 0x07, 0xF8, 0x00, 0xBF, 0x01, 0xEF, 0x80, 0x0F, 0xFF, 0xFC, 0xFF, 0x00, 0xF7, 0xFE, 0x07,
-    0xF0, 0x1F, 0x01, 0x00, 0x04, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x06, 0x9F, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0xF9, 0xF0, 0x00, 0x3D, 0x3C, 0x00,
-    0x1F, 0x0F, 0x40, 0x0B, 0xC3, 0xD0, 0x03, 0xD0, 0xF4, 0x01, 0xF0, 0x3D, 0x00, 0xF8, 0x0B, 0x80,
-    0x7C, 0x02, 0xE0, 0x3D, 0x00, 0xB8, 0x2E, 0x00, 0x1F, 0x2F, 0x00, 0x07, 0xEF, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xA8, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xFA,
-    0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xBE, 0x55, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0B, 0xC3,
-    0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x9B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x6B, 0xFA, 0xAB, 0xFA, 0x80, 0x3F, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x0F,
-    0xC0, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x0F, 0x40, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x3F,
-    0x00, 0x2F, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x3D, 0x00, 0x2F, 0xF0, 0x07, 0xC0, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x2F,
-    0x95, 0xFC, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0xF4,
-    0x00, 0x3E, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x7D, 0x03, 0xE0,
-    0x00, 0xBC, 0x03, 0xD0, 0x00, 0xF8, 0x07, 0xC0, 0x02, 0xF4, 0x0B, 0xF4, 0x0B, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0x5F, 0xFE, 0x00, 0x1F, 0x00, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x2F, 0xFF, 0xD0, 0x3F, 0xD5, 0xB0, 0x2F, 0x80, 0x00, 0x0F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x05, 0xAA, 0xAA, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xEA, 0xFE, 0xA0, 0x2F, 0x80, 0x1F, 0x40, 0x1F, 0x80, 0x03, 0xE0, 0x0F,
-    0xC0, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F,
-    0x80, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xC6, 0xAB, 0xEA, 0xA0, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x90, 0x00, 0xA4, 0x1F,
-    0x40, 0x03, 0xE0, 0x7C, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0xF8, 0x3D, 0x00,
-    0x03, 0xE1, 0xF4, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x3F, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0F,
-    0xC3, 0xD0, 0x00, 0x3D, 0x1F, 0x40, 0x02, 0xF0, 0x7D, 0x00, 0x1F, 0x40, 0xFC, 0x02, 0xFC, 0x02,
-    0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x02, 0xFD, 0x00,
-    0x1F, 0x40, 0xFF, 0xF8, 0x03, 0xF0, 0x3F, 0x5F, 0xC0, 0xFC, 0x07, 0xD0, 0x3E, 0x1F, 0x40, 0xBC,
-    0x03, 0xE3, 0xF0, 0x0F, 0x80, 0x3E, 0x3E, 0x00, 0xF4, 0x03, 0xE7, 0xD0, 0x1F, 0x00, 0x3E, 0x7C,
-    0x02, 0xF0, 0x07, 0xD7, 0xC0, 0x2E, 0x00, 0xBC, 0x7C, 0x03, 0xE0, 0x0F, 0x87, 0xD0, 0x3D, 0x02,
-    0xF0, 0x3F, 0x07, 0xC0, 0xBE, 0x02, 0xF8, 0xBC, 0x7F, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xA4, 0x03, 0xFC, 0x00, 0x0B, 0xC0, 0x06, 0xF4, 0x00,
-    0x7D, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x0F, 0x41, 0xF4, 0x00,
-    0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00,
-    0x3E, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x0F, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0xA4, 0x07, 0xC0, 0x28, 0x07, 0xD0, 0x1F, 0x01, 0xF0, 0x1F, 0x00, 0xBC, 0x07,
-    0xD0, 0xBC, 0x03, 0xE0, 0x1F, 0x43, 0xE0, 0x0F, 0x40, 0x7D, 0x0F, 0x40, 0x7C, 0x01, 0xF0, 0x7C,
-    0x02, 0xF0, 0x0B, 0xC2, 0xF0, 0x0F, 0x80, 0x2F, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x3E, 0x00, 0xF4,
-    0x07, 0xD0, 0xF8, 0x07, 0xC0, 0x2F, 0x03, 0xE0, 0x2F, 0x01, 0xF4, 0x0F, 0xC0, 0xF8, 0x0F, 0xC0,
-    0x2F, 0xC3, 0xD2, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x29, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x01, 0xF0,
-    0x1F, 0x40, 0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x43, 0xD0, 0x01, 0x40, 0x03, 0xD2,
-    0xF0, 0x00, 0xF0, 0x00, 0xF4, 0xF8, 0x00, 0x7C, 0x00, 0x3D, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x4F,
-    0x40, 0x0F, 0x80, 0x07, 0xC3, 0xD0, 0x03, 0xD0, 0x02, 0xF0, 0xF4, 0x01, 0xF4, 0x00, 0xF8, 0x3D,
-    0x00, 0xFD, 0x00, 0xBC, 0x0F, 0xC0, 0xBB, 0xC0, 0x7D, 0x01, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 0x1F,
-    0xF8, 0x1F, 0xFD, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x2F, 0x7C, 0x00,
-    0x00, 0x0F, 0x5F, 0x00, 0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x3D,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0x03, 0xE0,
-    0x00, 0x0F, 0x43, 0xF0, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3F, 0x7D,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0x7C, 0x00,
-    0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x2F, 0x00, 0x01,
-    0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0x83, 0xF0,
-    0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xAF, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C,
-    0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40,
-    0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x2D, 0x00, 0x00, 0x00, 0x2F,
-    0xF1, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x00,
-    0x1F, 0x43, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x00,
-    0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x2E, 0x00, 0x00, 0x2F, 0xF2, 0x40, 0x00, 0x0B,
-    0xCF, 0x40, 0x00, 0x02, 0xD0, 0x2C, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x28, 0x00, 0x0B, 0xFF, 0xC7, 0xC0, 0x03, 0xFD, 0x5F, 0xF8, 0x00, 0xBE, 0x00,
-    0x7F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x0F,
-    0xC0, 0x0B, 0xC0, 0x02, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x40, 0x03, 0xF0, 0x2E, 0xF4, 0x00, 0x2F,
-    0xFF, 0x8F, 0x00, 0x00, 0xBF, 0xD1, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFD, 0x00, 0x00, 0x01, 0x2F, 0xF0, 0x00,
-    0x00, 0x0B, 0x8B, 0x80, 0x00, 0x03, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0xFB, 0xC0, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x1F, 0x43, 0xD0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x2F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0xFC, 0x00,
-    0x00, 0xF8, 0x1F, 0x80, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x0B, 0xC0,
-    0x02, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0xBD, 0x00, 0x00, 0x22, 0xFF, 0x00,
-    0x00, 0x0B, 0xCF, 0x40, 0x00, 0x2D, 0x02, 0xC0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4,
-    0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0,
-    0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80,
-    0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xFD, 0x38, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x02,
-    0xF7, 0xC0, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x00, 0x7D,
-    0x0F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00, 0x0F, 0x80,
-    0x3E, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0xBD, 0x3D, 0x00, 0x00, 0xBF, 0xC4,
-    0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x02, 0x80, 0x02, 0xFF, 0xF1, 0xF0, 0x03, 0xFD, 0x5F, 0xF8, 0x02, 0xF8,
-    0x01, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x03, 0xE0, 0x0F,
-    0x80, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x2F, 0x00, 0x0B, 0xE0, 0x07, 0xC0, 0x07, 0xF4, 0x00, 0xFC, 0x0B, 0xBD, 0x00, 0x2F, 0xFF, 0x8F,
-    0x00, 0x02, 0xFF, 0x47, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0D, 0x00,
-    0x00, 0x0F, 0xFF, 0xBC, 0x00, 0x00, 0x1C, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0x80, 0x00, 0x00, 0x3D,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00,
-    0x01, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x0F,
-    0x80, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x0F,
-    0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xA0, 0x09, 0x00, 0x0F, 0xFE, 0x7C, 0x00, 0x1D, 0x1F,
-    0xF4, 0x00, 0x14, 0x00, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xCF,
-    0x40, 0x00, 0x2D, 0x02, 0xC0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0,
-    0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07,
-    0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F,
-    0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xF8, 0xB8, 0x00, 0x00, 0x3D, 0x02, 0xD0, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x0F, 0xC3, 0xC0,
-    0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xEA, 0xAA, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00,
-    0x0F, 0x81, 0xF8, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x8B, 0x80, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD,
-    0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00,
-    0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF,
-    0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x06, 0x04,
-    0x18, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0xF0,
-    0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00,
-    0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAB, 0xC0,
-    0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xE0,
-    0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x04, 0x24, 0x50, 0x00, 0x1D, 0x01,
-    0xE0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07,
-    0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03,
-    0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F,
-    0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x00, 0x00, 0x06, 0x05, 0x18, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0x03, 0xD7, 0xC0, 0x00, 0x00, 0x3F, 0x0F,
-    0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x03, 0xE0, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAB, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x00, 0x3D,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC1, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x04, 0x14, 0x50, 0x00, 0x1D, 0x01, 0xE0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C,
-    0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40,
-    0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x18, 0x20, 0x60, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00,
-    0x02, 0xF7, 0xC0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00, 0x07, 0xD0,
-    0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x3E, 0x00,
-    0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xFE,
-    0xAA, 0xAF, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x03,
-    0xE0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x04, 0x30, 0x50, 0x00, 0x1D, 0x01, 0xE0, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C,
-    0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40,
-    0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4,
-    0x1D, 0x00, 0x00, 0x0F, 0xFF, 0xBC, 0x00, 0x00, 0x2C, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xBC, 0x00, 0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x03, 0xE0,
-    0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xA0, 0x0D, 0x00, 0x0F, 0xFE, 0x7C, 0x00,
-    0x2D, 0x1F, 0xF4, 0x00, 0x14, 0x01, 0x40, 0x00, 0x04, 0x00, 0x50, 0x00, 0x1D, 0x01, 0xE0, 0x00,
-    0x0F, 0xEF, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C, 0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F,
-    0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D,
-    0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C,
-    0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40, 0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x60, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xFC, 0x3C,
-    0x00, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFE, 0xAA, 0xAF, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x00, 0xF4,
-    0x03, 0xF0, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x60, 0x00, 0x1E, 0x01, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x28, 0x00, 0xBF, 0xFC, 0x7C,
-    0x03, 0xFD, 0x5F, 0xF8, 0x0B, 0xE0, 0x07, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC0,
-    0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x3F, 0x02, 0xEF, 0x40,
-    0x2F, 0xFF, 0x8F, 0x00, 0x0B, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F, 0x8B, 0xC0, 0x07, 0xD3,
-    0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x34, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54,
-    0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40,
-    0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xAF, 0xC0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8, 0x2F, 0x40, 0x3E, 0x0F,
-    0x80, 0x0F, 0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x2F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01,
-    0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x07,
-    0xFC, 0x0E, 0x00, 0x0F, 0xBF, 0xFC, 0x00, 0x2C, 0x0B, 0xF4, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5,
-    0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0xFF, 0x43, 0xC0, 0x0B, 0xFF,
-    0xFE, 0x00, 0x38, 0x1F, 0xE0, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80,
-    0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x2F, 0x80, 0x2F, 0x40, 0x3E, 0x00, 0xF8, 0x00, 0xF8, 0x0B,
-    0xC0, 0x07, 0xD0, 0x3E, 0x01, 0xBE, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x06,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF4, 0xF4, 0x00, 0x00, 0x3F, 0xF1, 0x00,
-    0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD5, 0x55,
-    0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xF5, 0x55, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE5, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x01, 0xF4, 0x7C, 0x00, 0x00, 0x7F, 0xC9, 0x00, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x07, 0x80,
-    0xB4, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0x03, 0xF9, 0x2F, 0x80, 0x00, 0xBD, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x0F,
-    0x80, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x3E, 0x01, 0xBE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x01, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x3C, 0x3F, 0x40, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0A, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x2C, 0x1F, 0x40, 0x02, 0x5F, 0xF0, 0x00, 0x1F, 0x2E, 0x00, 0x1E, 0x02, 0xD0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x92, 0xF8,
-    0x2F, 0x40, 0x3E, 0x0F, 0x80, 0x0F, 0x8B, 0xC0, 0x07, 0xD3, 0xE0, 0x1B, 0xE1, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x6C,
-    0x00, 0x00, 0x3F, 0x4E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x00, 0xF0,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x55, 0x54, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x55, 0x50,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00,
-    0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x01, 0xF4, 0xB8, 0x00, 0x07,
-    0xFC, 0x40, 0x00, 0x1F, 0x2E, 0x00, 0x00, 0x78, 0x0B, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xF9, 0x2F, 0x80, 0x0B, 0xD0,
-    0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x2F, 0x00, 0x1F, 0x40, 0x3E, 0x01, 0xBE, 0x00, 0x7F, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x07, 0x40, 0x00, 0xFF, 0xFB, 0xC0, 0x00,
-    0xB0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x3D, 0x3D, 0x00, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x55, 0x54, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x03,
-    0xF5, 0x55, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06, 0x90, 0x28, 0x00, 0xBF,
-    0xF6, 0xD0, 0x03, 0x86, 0xFE, 0x00, 0x04, 0x00, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x01, 0xF2, 0xE0, 0x00, 0x1E, 0x02, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xF9, 0x2F, 0x80, 0x2F, 0x40, 0x3E, 0x00, 0xF8,
-    0x00, 0xF8, 0x0B, 0xC0, 0x07, 0xD0, 0x3E, 0x01, 0xBE, 0x01, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xF8,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0F, 0xD0, 0x06, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0xE0,
-    0x00, 0x0F, 0x40, 0xF0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x0F, 0xD5, 0x55, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7E, 0x55, 0x54, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0xBC, 0x7C, 0x00, 0xB8, 0x0B, 0x80, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x4B, 0xE0, 0xBD, 0x00, 0xF8, 0x3E, 0x00, 0x3E, 0x2F,
-    0x00, 0x1F, 0x4F, 0x80, 0x6F, 0x87, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x00, 0xBD, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x07, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x2D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x02, 0xBE, 0x00, 0x01, 0xE0, 0x00, 0x3D,
-    0x00, 0x3F, 0x80, 0x03, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x0F, 0x40, 0x01,
-    0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0,
-    0x00, 0xF4, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x6F, 0xE0, 0x03, 0xF8, 0x00, 0x0F,
-    0xC0, 0x2F, 0x80, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x1F, 0xD0, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE4, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03,
-    0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD,
-    0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xF4, 0x1B, 0xF8, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00,
-    0x02, 0xF2, 0xF4, 0x00, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0xFC, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x0B, 0xE0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xFE, 0x00, 0xBF,
-    0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE4, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03,
-    0xF0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD,
-    0x02, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x1E, 0x00, 0x00, 0x00,
-    0x7F, 0xD5, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x80, 0x00, 0x0F, 0xF4, 0x1B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00,
-    0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xC0, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0x3F, 0xD6, 0x00, 0x00, 0x0F,
-    0x5F, 0x00, 0x00, 0x07, 0x80, 0x74, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xE4, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00, 0xBD, 0x00,
-    0x7E, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x02, 0xF0, 0x07,
-    0xD0, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x07,
-    0xD0, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x40, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x74, 0x7E, 0x00, 0x00, 0x00, 0x57, 0xFD, 0x00,
-    0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x0B, 0x40, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x1B,
-    0xF8, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0xC2,
-    0xF4, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x7E, 0x00, 0x00, 0x02, 0xF2, 0xF4, 0x00,
-    0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x0B, 0xE0, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x1D, 0x0F, 0x80, 0x00, 0x14, 0xFF, 0x40, 0x00, 0x0F, 0x5F, 0x00, 0x01,
-    0xE0, 0x1D, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x02, 0xFF,
-    0xFC, 0x00, 0x3F, 0x96, 0xFC, 0x02, 0xF4, 0x01, 0xF8, 0x1F, 0x80, 0x03, 0xF0, 0xBC, 0x00, 0x0B,
-    0xC3, 0xE0, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0xBC, 0x7C, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x1F, 0x40, 0xFD, 0x02, 0xF8, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x07, 0xE2, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x02, 0xD0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4,
-    0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x03, 0xF8, 0x00, 0x0F, 0xC0,
-    0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x00,
-    0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x2F, 0x80, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x78, 0x00,
-    0x00, 0xFF, 0x44, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x01, 0xE0, 0x1D, 0x00, 0x00, 0x40, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x03, 0xF9, 0x6F,
-    0xC0, 0x02, 0xF4, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x02, 0xF0, 0x1F, 0x40, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x07, 0xD0, 0x1F, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0xFD, 0x02, 0xF8, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0xB0, 0x00, 0x02, 0xFF, 0xEF, 0x40, 0x00, 0x0E, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00,
-    0xB4, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x41, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0x00,
-    0xBE, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0xFC,
-    0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0xBE, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00,
-    0x7F, 0x40, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0x90, 0x18, 0x00, 0x1F, 0xFD, 0xB8, 0x00, 0x3C, 0x2F,
-    0xF0, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0x5F,
-    0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x0B, 0xD0, 0x07, 0xE0, 0x1F, 0x80, 0x03,
-    0xF0, 0x2F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x02, 0xF0, 0x7C, 0x00, 0x03,
-    0xF0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F,
-    0x40, 0x3F, 0x40, 0xBE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x1E, 0x00, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x06, 0xFE,
-    0x00, 0x3F, 0x80, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xBD,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00,
-    0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0xF8,
-    0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x1F, 0x80,
-    0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x07,
-    0xC3, 0xC0, 0x00, 0x7C, 0x07, 0xC0, 0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0F, 0xE5, 0xBF, 0x00, 0xBD, 0x00, 0x7E, 0x07, 0xE0, 0x00, 0xFC,
-    0x2F, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0xFC, 0xBC,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0xFC, 0x1F, 0x80, 0x07, 0xD0, 0x3F, 0x40,
-    0xBE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFE, 0x07, 0xD0, 0x03, 0xFD, 0x06, 0xFE, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xD0, 0x02,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x00, 0x02,
-    0xF0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xF9, 0x01, 0xF8, 0x00, 0xBF, 0xFF,
-    0x4F, 0xC0, 0x0F, 0xE5, 0xBF, 0xF8, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x1F, 0x00,
-    0x00, 0xFC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xFC,
-    0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xFE, 0x07, 0xD0, 0x03, 0xFD, 0x06,
-    0xFE, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xD0, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0B,
-    0xD0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0x80, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0xE0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x06, 0xF9, 0x01, 0xF8, 0x00, 0xBF, 0xFF, 0x4F, 0xC0, 0x0F, 0xE5, 0xBF, 0xF8, 0x00,
-    0xBD, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00,
-    0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x03, 0xE0,
-    0x02, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x3F,
-    0x40, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 0xBF, 0xFF, 0xF8, 0x1F, 0x40, 0x0F, 0xF4, 0x1B, 0xF9,
-    0xF8, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x7E, 0x00,
-    0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xE4, 0x07, 0xE0, 0x02, 0xFF, 0xFD, 0x3F, 0x00, 0x3F,
-    0x96, 0xFF, 0xE0, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x03, 0xF0, 0x02,
-    0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00,
-    0x1F, 0x40, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x1D,
-    0x00, 0x00, 0x00, 0x3E, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0x00, 0x0B,
-    0xFF, 0xFF, 0x81, 0xF4, 0x00, 0xFF, 0x41, 0xBF, 0x9F, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0xF4, 0x00,
-    0xBE, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF0,
-    0x00, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0xBF, 0x82, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0x0F, 0xF0, 0x00, 0x00, 0x40, 0x01, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x01, 0xBE, 0x40, 0x7E, 0x00, 0x2F, 0xFF, 0xD3, 0xF0, 0x03, 0xF9, 0x6F,
-    0xFE, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00,
-    0x3E, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x00,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x2F, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0xFE, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0x81, 0xF4, 0x00, 0xFF, 0x41, 0xBF,
-    0x9F, 0x80, 0x0F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x07, 0xE0,
-    0x00, 0x00, 0x2F, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xF9, 0x01, 0xF8, 0x00,
-    0xBF, 0xFF, 0x4F, 0xC0, 0x0F, 0xE5, 0xBF, 0xF8, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x2F, 0x00,
-    0x1F, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xC0,
-    0x00, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xD0, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D,
-    0x01, 0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC,
-    0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0,
-    0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E, 0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00,
-    0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x3E,
-    0x01, 0xF0, 0x00, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0xF8,
-    0x00, 0x00, 0xF8, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x00,
-    0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x00, 0x3D, 0x01,
-    0xF0, 0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x01, 0xF4, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0xAF, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x68, 0x07,
-    0xD0, 0x00, 0xBC, 0x07, 0xC0, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0xF4, 0x0F, 0x80, 0x01, 0xF0, 0x0F,
-    0x40, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x2F, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xD0, 0x3E,
-    0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x2F, 0x80, 0x7C, 0x00, 0x7F, 0x40, 0x7E,
-    0x02, 0xEF, 0x40, 0x3F, 0xFF, 0x8F, 0x00, 0x0F, 0xFD, 0x1F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x03,
-    0xE0, 0x00, 0x03, 0xF1, 0xF4, 0x03, 0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF,
-    0x40, 0x0B, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7E,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x0A, 0x40, 0x01, 0xA0, 0xF8, 0x07, 0xD0, 0x00, 0xBC, 0xFC, 0x01, 0xF0, 0x00, 0x3F,
-    0xF8, 0x00, 0xBC, 0x00, 0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x02, 0xF0,
-    0x00, 0x07, 0xD0, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40,
-    0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x02, 0xF8, 0x00,
-    0x01, 0xF0, 0x01, 0xFD, 0x00, 0x00, 0x7E, 0x02, 0xEF, 0x40, 0x00, 0x0F, 0xFF, 0xE3, 0xC0, 0x00,
-    0x00, 0xFF, 0xD1, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xF1,
-    0xF4, 0x03, 0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xC0, 0x00,
-    0x07, 0xE4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0A, 0x40,
-    0x01, 0xA0, 0xF8, 0x07, 0xD0, 0x00, 0xBC, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0xBC, 0x00,
-    0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x01, 0xFD,
-    0x00, 0x00, 0x7E, 0x02, 0xEF, 0x40, 0x00, 0x0F, 0xFF, 0xE3, 0xC0, 0x00, 0x00, 0xFF, 0xD1, 0xF0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x03, 0xE0, 0x00,
-    0x03, 0xF1, 0xF4, 0x03, 0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x0B,
-    0xC0, 0x00, 0x07, 0xE4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0x90, 0x00, 0x68, 0x3E, 0x01, 0xF4, 0x00, 0x2F, 0x3F, 0x00,
-    0x7C, 0x00, 0x0F, 0xFE, 0x00, 0x2F, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x03,
-    0xD0, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0x01, 0xF4,
-    0x00, 0xBE, 0x00, 0x00, 0x7C, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0x80, 0xBB, 0xD0, 0x00, 0x03, 0xFF,
-    0xF8, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02, 0xF0, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xF1, 0xF4, 0x03,
-    0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x07, 0xE4,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00,
-    0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x07, 0xFD, 0x0E,
-    0x00, 0x00, 0x03, 0xEF, 0xFF, 0x00, 0x00, 0x01, 0xD0, 0xBF, 0x40, 0x00, 0x00, 0x10, 0x01, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x29, 0x00, 0x06, 0x83, 0xE0, 0x1F, 0x40, 0x02, 0xF3,
-    0xF0, 0x07, 0xC0, 0x00, 0xFF, 0xE0, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00,
-    0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0x40, 0x0B, 0xE0, 0x00, 0x07, 0xC0, 0x07, 0xF4, 0x00, 0x01, 0xF8, 0x0B, 0xBD, 0x00, 0x00,
-    0x3F, 0xFF, 0x8F, 0x00, 0x00, 0x03, 0xFF, 0x47, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xE0, 0x00, 0x02,
-    0xF0, 0xFC, 0x03, 0xE0, 0x00, 0x03, 0xF1, 0xF4, 0x03, 0xD0, 0x00, 0x03, 0xE7, 0xE0, 0x07, 0xC0,
-    0x00, 0x03, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0A, 0x40,
-    0x01, 0xA0, 0xF8, 0x07, 0xD0, 0x00, 0xBC, 0xFC, 0x01, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0xBC, 0x00,
-    0x0F, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x02, 0xF8, 0x00, 0x01, 0xF0, 0x01, 0xFD,
-    0x00, 0x00, 0x7E, 0x02, 0xEF, 0x40, 0x00, 0x0F, 0xFF, 0xE3, 0xC0, 0x00, 0x00, 0xFF, 0xD1, 0xF0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40,
-    0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xA8, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00,
-    0x3F, 0x00, 0x03, 0xD0, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x0F,
-    0x0B, 0xC0, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0xF6, 0xF0, 0x00, 0x00, 0x03, 0xDF, 0x40,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B,
-    0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8,
-    0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x02, 0xA0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x07, 0xD0,
-    0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0B,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xF8,
-    0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0xB8, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x01, 0xFC, 0x0F, 0x40,
-    0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F,
-    0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0xA0, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x07,
-    0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x40, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x01,
-    0xF0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00,
-    0x00, 0x3C, 0x2F, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x00, 0x0F,
-    0x7D, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x3F, 0xD0, 0xB0, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0xE0, 0x7F, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x01, 0xF8, 0x2F, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x0F, 0x80, 0x0F,
-    0x80, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x01, 0x40, 0x00, 0x07, 0xFD, 0x0E, 0x00, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x01, 0xD0,
-    0xBF, 0x80, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x2A,
-    0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x03,
-    0xE0, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x0B,
-    0xC0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x03, 0xC2, 0xF0, 0x00, 0x00, 0x0F, 0x0F, 0x80, 0x00,
-    0x00, 0x3D, 0xBC, 0x00, 0x00, 0x00, 0xF7, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A,
-    0xB8, 0xBA, 0xB8, 0xA0, 0xE0, 0xA1, 0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B,
-    0x00, 0x2E, 0xA9, 0x2E, 0xAE, 0x0B, 0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x3F, 0xFF, 0x0F,
-    0xFF, 0xC1, 0x55, 0x50, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x1A, 0xAA, 0xAA, 0xA0, 0xFF,
-    0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0x81, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x2D,
-    0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4,
-    0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0,
-    0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40,
-    0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00, 0xFB, 0x40, 0x3E, 0xD0, 0x0F, 0xB4, 0x03, 0xED, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE2, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x50, 0x00, 0xB4, 0x07, 0xC0, 0x3E, 0x01,
-    0xF0, 0x0F, 0x80, 0xBD, 0x03, 0xF0, 0x05, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x3E, 0x02, 0xF0, 0x0F,
-    0x40, 0x7C, 0x03, 0xC0, 0x05, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x7E, 0x02, 0xF0, 0x0F, 0x40, 0x7C,
-    0x03, 0xD0, 0x0E, 0x00, 0xBC, 0xBC, 0xBC, 0x7C, 0x3C, 0x3C, 0x3C, 0x04, 0x00, 0xB4, 0x0E, 0x01,
-    0xF0, 0x3D, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0xF4, 0x0F, 0x82, 0xF0, 0x2F, 0x43, 0xE0, 0x3F, 0x0B,
-    0xD0, 0x14, 0x05, 0x40, 0x01, 0xF4, 0x3E, 0x03, 0xF0, 0xBD, 0x03, 0xE0, 0xFC, 0x0B, 0xC1, 0xF4,
-    0x0F, 0x42, 0xF0, 0x1F, 0x03, 0xC0, 0x3C, 0x0B, 0x80, 0x14, 0x05, 0x00, 0x00, 0x50, 0x15, 0x03,
-    0xF0, 0xBD, 0x07, 0xE0, 0xFC, 0x0B, 0xC1, 0xF4, 0x0F, 0x42, 0xF0, 0x1F, 0x03, 0xD0, 0x3D, 0x0B,
-    0x80, 0x38, 0x0B, 0x00, 0xB8, 0x2E, 0x3F, 0x0B, 0xCB, 0xC2, 0xF1, 0xF0, 0x7C, 0x3C, 0x0F, 0x0F,
-    0x03, 0xC3, 0xC0, 0xF0, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x06, 0x57, 0x96, 0xAF, 0xFF, 0xFE, 0xBA, 0xFA, 0xB4, 0x03,
-    0xC0, 0x00, 0x0E, 0x00, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01,
-    0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFC, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x05, 0x43,
-    0x81, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0xFE, 0xFB, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFD, 0x3F, 0xFC, 0x2F, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x90, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xFE, 0x01, 0xFF, 0xFC, 0x2F, 0xFE, 0x03, 0xFD,
-    0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0xFD, 0x10, 0x05, 0x00, 0x14, 0x3F, 0x00,
-    0xBE, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xFC, 0x14, 0x00, 0x10, 0x05, 0x00, 0x14, 0x00, 0x24, 0x3F,
-    0x00, 0xBE, 0x00, 0xFC, 0x7F, 0x00, 0xFE, 0x01, 0xFC, 0x7F, 0x00, 0xFD, 0x01, 0xFC, 0x14, 0x00,
-    0x10, 0x00, 0x50, 0x05, 0x0B, 0xE3, 0xF8, 0xFC, 0x04, 0x00, 0x6A, 0xA8, 0xBA, 0xA8, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-    0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x0D,
-    0x00, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF4,
-    0x3C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x3D,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0xB4, 0x7C, 0x6E,
-    0x40, 0x06, 0xE0, 0xB8, 0x0F, 0x0F, 0x1F, 0xFD, 0x03, 0xFF, 0xC7, 0xC3, 0xE3, 0xD7, 0xD2, 0xF0,
-    0xBC, 0x7D, 0x3F, 0xFC, 0xB8, 0xF4, 0x0F, 0x1F, 0x02, 0xE0, 0xFE, 0x1F, 0x0F, 0x00, 0xF2, 0xE0,
-    0x2E, 0x00, 0x03, 0xC2, 0xE0, 0x0F, 0x3C, 0x02, 0xD0, 0x00, 0xF4, 0x2D, 0x01, 0xF3, 0xC0, 0x3D,
-    0x00, 0x2E, 0x03, 0xD0, 0x2E, 0x7C, 0x03, 0xC0, 0x07, 0xC0, 0x3C, 0x03, 0xD7, 0x80, 0x7C, 0x00,
-    0xF0, 0x03, 0xC0, 0x3C, 0x78, 0x0B, 0x40, 0x3D, 0x00, 0x3D, 0x0F, 0x47, 0xC1, 0xF0, 0x0B, 0x80,
-    0x01, 0xFB, 0xF0, 0x3F, 0xBD, 0x01, 0xF0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x43, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x03, 0xD0,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x0B, 0x47, 0xC6, 0xE4, 0x00, 0x6E, 0x00, 0x0B, 0x90, 0xB8, 0x0F, 0x0F, 0x1F, 0xFD, 0x03, 0xFF,
-    0xC0, 0x7F, 0xF4, 0x7C, 0x3E, 0x3D, 0x7D, 0x2F, 0x0B, 0xC7, 0xD0, 0xF4, 0xBC, 0x3F, 0xFC, 0xB8,
-    0xF4, 0x0F, 0x1F, 0x02, 0xE3, 0xE0, 0x3C, 0x0F, 0xE1, 0xF0, 0xF0, 0x0F, 0x2E, 0x02, 0xE3, 0xC0,
-    0x3C, 0x00, 0x03, 0xC2, 0xE0, 0x0F, 0x3C, 0x02, 0xD7, 0x80, 0x3C, 0x00, 0x0F, 0x42, 0xD0, 0x1F,
-    0x3C, 0x03, 0xDB, 0x80, 0x7C, 0x00, 0x2E, 0x03, 0xD0, 0x2E, 0x7C, 0x03, 0xCF, 0x40, 0x78, 0x00,
-    0x7C, 0x03, 0xC0, 0x3D, 0x78, 0x07, 0xCF, 0x40, 0xB4, 0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x78, 0x0B,
-    0x4F, 0x40, 0xF0, 0x03, 0xD0, 0x03, 0xD0, 0xF4, 0x7C, 0x1F, 0x0B, 0x42, 0xE0, 0x0B, 0x80, 0x01,
-    0xFB, 0xF0, 0x3F, 0xBD, 0x07, 0xEF, 0xC0, 0x1F, 0x00, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01,
-    0xF0, 0x03, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x1D, 0x00, 0x28, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x3E,
-    0x0F, 0x80, 0x1F, 0x0B, 0xC0, 0x0F, 0x43, 0xD0, 0x07, 0x82, 0xE0, 0x03, 0xC0, 0xF0, 0x01, 0xD0,
-    0x74, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x7C, 0x1F, 0x0B, 0xC0, 0x0F, 0x83, 0xE0, 0xF4, 0x01, 0xF0,
-    0xBC, 0x2F, 0x00, 0x3D, 0x0F, 0x43, 0xC0, 0x07, 0x82, 0xE0, 0xB8, 0x00, 0xF0, 0x3C, 0x0F, 0x00,
-    0x1D, 0x07, 0x42, 0xD0, 0x02, 0x80, 0xA0, 0x28, 0x00, 0x3D, 0x0F, 0x81, 0xF0, 0x3C, 0x0F, 0x02,
-    0xD0, 0x38, 0x0A, 0x3D, 0x1F, 0x03, 0xE1, 0xF0, 0x1F, 0x0F, 0x40, 0xF0, 0xB8, 0x0F, 0x07, 0x80,
-    0xB4, 0x3C, 0x03, 0x82, 0xC0, 0x28, 0x18, 0x3D, 0x1F, 0x0F, 0x43, 0xE1, 0xF0, 0xF8, 0x1F, 0x0F,
-    0x47, 0xC0, 0xF0, 0xB8, 0x3C, 0x0F, 0x07, 0x83, 0xC0, 0xB4, 0x3C, 0x2D, 0x03, 0x82, 0xC1, 0xE0,
-    0x28, 0x18, 0x09, 0x00, 0x01, 0x00, 0x00, 0x2D, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xB0, 0x00, 0xB0,
-    0xD0, 0x07, 0x43, 0x80, 0x3C, 0x0B, 0x03, 0xC0, 0x1C, 0x2D, 0x00, 0x34, 0xE0, 0x00, 0xF0, 0x00,
-    0x10, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xD0, 0x1F, 0x40, 0x7E, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x2F,
-    0x00, 0x0F, 0x40, 0x0B, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x01, 0xF8, 0x07, 0xD0, 0x1F, 0x40, 0x3D, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xF4, 0x00, 0x04, 0x3D, 0x00,
-    0x1F, 0x80, 0x03, 0xD1, 0xF4, 0x01, 0xF4, 0x00, 0xF8, 0x07, 0xD0, 0x01, 0x00, 0x3E, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00, 0x3D, 0x00, 0x7F, 0xE0, 0x03, 0xEB,
-    0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x7D, 0x00, 0x3F, 0xD0, 0x03, 0xF1, 0x40, 0x0F, 0x9F, 0x40, 0x04,
-    0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0xF4, 0x01,
-    0xF4, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xC1, 0x80, 0x01, 0xF8, 0x00, 0x18, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x0B, 0xD0, 0x0B, 0xD0, 0x2F, 0x00, 0x2F, 0x00,
-    0xFC, 0x00, 0xFC, 0x03, 0xE0, 0x03, 0xE0, 0x0F, 0x80, 0x0F, 0x40, 0x7D, 0x00, 0x7C, 0x02, 0xF0,
-    0x02, 0xF0, 0x0F, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0xF0, 0x07, 0xC0, 0x07,
-    0xC0, 0x1F, 0x00, 0x1E, 0x00, 0xB8, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x01, 0x80, 0x03, 0xF0, 0x1F, 0xC0, 0x1F, 0xC0, 0xBF, 0x00, 0x7F, 0x01, 0xF8,
-    0x00, 0x50, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x2E, 0xF9,
-    0xFC, 0x01, 0xF4, 0xBC, 0x02, 0xF0, 0x7C, 0x02, 0xF0, 0x7C, 0x03, 0xE0, 0xFC, 0x03, 0xD1, 0xF4,
-    0x03, 0xCB, 0xE0, 0x07, 0xEF, 0x80, 0x0B, 0xFD, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x34, 0x00, 0x00, 0x38,
-    0x2C, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x07, 0xC0, 0x07, 0xEA, 0xBE, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01, 0xF9, 0x5B, 0xC0, 0x07, 0x80, 0x00, 0xF0,
-    0x1D, 0x00, 0x00, 0x34, 0x34, 0x00, 0x00, 0x2C, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x03, 0x8B, 0x00,
-    0x00, 0xB0, 0x70, 0x00, 0x0E, 0x07, 0x40, 0x03, 0xC0, 0x38, 0x00, 0x74, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x40, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x56, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF5, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x3C, 0x02, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x10, 0x0B, 0x40, 0x00, 0x04,
-    0x00, 0xF0, 0x01, 0xF4, 0x2C, 0x00, 0x00, 0x3E, 0x07, 0x40, 0x0B, 0xFD, 0xF0, 0x00, 0x01, 0xFF,
-    0xAC, 0x00, 0x01, 0xBF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x3F, 0xBF, 0xD0, 0x00, 0x0B,
-    0xFF, 0xFC, 0x03, 0xED, 0x00, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x7D, 0x3C, 0x00, 0x00, 0x0F, 0x8F,
-    0x00, 0x07, 0xE0, 0xF0, 0x00, 0x00, 0xFC, 0x2E, 0x00, 0x2F, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x7C,
-    0x00, 0x20, 0x07, 0xC0, 0x00, 0x05, 0x00, 0xF8, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x00, 0x3F, 0xFE, 0x3F, 0xFD, 0x15, 0x54, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0x54, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0xC0,
-    0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x54, 0x00, 0x3F, 0xF8,
-    0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x05, 0x7D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x01, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x00, 0x0B,
-    0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x15, 0xBC, 0x00, 0x3F, 0xF8, 0x00, 0x2A,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x02, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xF4, 0x1F, 0xFF, 0xFC, 0x2E, 0x42, 0xFC, 0x0F, 0x41, 0xFD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3D, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0x80, 0x00, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFE, 0x40, 0x0B, 0xD3, 0xFF, 0xFF, 0x40, 0x3F, 0x0B, 0x90, 0xBF, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x1F, 0x40, 0x00, 0x07, 0xC0, 0x7D, 0x00, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xF4,
-    0x00, 0x3F, 0x80, 0x07, 0xC0, 0x03, 0xF4, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0xF4,
-    0x00, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x05, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x02,
-    0xF4, 0x00, 0x0B, 0xD0, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x2F, 0xFE, 0x00, 0x07, 0xE0, 0x7F, 0xFF, 0xF0, 0x02, 0xF4, 0x0F, 0x40, 0xFE, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x03,
-    0xD0, 0x00, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0x00, 0x7F, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
-    0x00, 0x3E, 0x00, 0x00, 0x78, 0x00, 0x1F, 0x00, 0x00, 0x2D, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0x40, 0x00,
-    0x10, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x5F, 0x80, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xF8, 0x3C, 0x1F, 0xFF, 0xF4, 0xF0, 0x7F,
-    0xFF, 0xF3, 0xC1, 0xFF, 0xFF, 0xCF, 0x07, 0xFF, 0xFF, 0x7C, 0x1F, 0xFF, 0xFD, 0xF0, 0x7F, 0xFF,
-    0xF7, 0xC1, 0xFF, 0xFF, 0xDF, 0x07, 0xFF, 0xFF, 0x7C, 0x1F, 0xFF, 0xFC, 0xF0, 0x7F, 0xFF, 0xE3,
-    0xC1, 0xFF, 0xFF, 0x0F, 0x07, 0xFF, 0xE0, 0x3C, 0x1D, 0x10, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1,
-    0xD0, 0x00, 0x0F, 0x07, 0x40, 0x00, 0x3C, 0x1D, 0x00, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1, 0xD0,
-    0x00, 0x0F, 0x07, 0x40, 0x00, 0x3C, 0x1D, 0x00, 0x00, 0xF0, 0x74, 0x00, 0x03, 0xC1, 0xD0, 0x00,
-    0x0A, 0x02, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF9,
-    0x7C, 0x2F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4,
-    0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4,
-    0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x1F, 0xFF, 0xF4, 0x2C, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFC, 0x6A, 0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x79, 0x7F, 0xFF, 0xE0, 0x74, 0x3F, 0xFF,
-    0xF4, 0x74, 0x3F, 0xFF, 0xF8, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF,
-    0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF,
-    0xF4, 0x74, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x2D, 0x03, 0xC0, 0x00,
-    0xFF, 0x4E, 0x00, 0x00, 0xBF, 0xF9, 0x5A, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xC5, 0xA0, 0x03,
-    0xDB, 0x40, 0x00, 0x3E, 0x1E, 0x00, 0x03, 0xF0, 0x3C, 0x00, 0x07, 0x00, 0xF8, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80, 0xFD, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x03, 0xE0,
-    0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x02, 0xE0, 0x0B, 0x80, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x01, 0xF9, 0x5B, 0xC0, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
-    0x1D, 0x00, 0x00, 0x34, 0x00, 0x34, 0x00, 0x00, 0x2C, 0x00, 0x60, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x34, 0x00, 0x00,
-    0x38, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xEA, 0xBE, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x00,
-    0x07, 0xFF, 0x95, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFC, 0x5A, 0x00, 0x03, 0xE7, 0x40,
-    0x00, 0x03, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x34, 0x0B, 0xC0, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x01, 0xD0, 0x2C, 0x00, 0x00, 0xFF, 0x4F, 0x00, 0x00, 0x07,
-    0xFF, 0x95, 0xA4, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFC, 0x5A, 0x00, 0x03, 0xE7, 0x40, 0x00,
-    0x03, 0xF0, 0xF0, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x34, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xDB, 0xE0, 0x0F, 0x2F, 0x40,
-    0xB8, 0x14, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x00,
-    0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x7D, 0x3C, 0x02, 0xFA,
-    0xE0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xA4, 0x00, 0x00, 0x00, 0xD0, 0x7F, 0xFF, 0xFE,
-    0x40, 0x00, 0x2C, 0x1F, 0x40, 0x6F, 0xFF, 0xA4, 0x1F, 0x83, 0xC0, 0x00, 0x06, 0xFF, 0xFF, 0xE0,
-    0x24, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x01,
-    0xF9, 0x07, 0xE0, 0x0B, 0x80, 0x00, 0xB0, 0x1D, 0x00, 0x00, 0x38, 0x34, 0x00, 0x00, 0x1C, 0x20,
-    0x00, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x03, 0x42, 0xC0, 0xE0, 0x03,
-    0xD2, 0xC3, 0xE0, 0x00, 0xF6, 0xCF, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x2A, 0xAF, 0xFE, 0xA9, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFA, 0xDF, 0x40, 0x03,
-    0xE2, 0xC7, 0xD0, 0x07, 0x82, 0xC1, 0xF0, 0x01, 0x02, 0xC0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x7C,
-    0x1F, 0x0B, 0xC2, 0xF0, 0x03, 0xE0, 0xF8, 0x3D, 0x0F, 0x40, 0x1F, 0x0B, 0xC2, 0xE0, 0xB8, 0x00,
-    0xF4, 0x3D, 0x0F, 0x03, 0xC0, 0x07, 0x82, 0xE0, 0xB4, 0x2D, 0x00, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
-    0x01, 0xD0, 0x74, 0x2C, 0x0B, 0x00, 0x0A, 0x02, 0x80, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD1, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xE0, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3E, 0x7F, 0x7E, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3E, 0x7F, 0x3E,
-    0x04, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x47, 0xF0, 0x00, 0x02, 0xF5,
-    0xFC, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xE0, 0x2E, 0x02, 0xFC, 0x00, 0xBE,
-    0x02, 0xE0, 0x1F, 0x80, 0x02, 0x80, 0x2E, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x6A, 0xAA, 0xBF, 0xAA, 0xAA, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xBF, 0xAA, 0xAA, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x2E, 0x00, 0x50,
-    0x00, 0x7E, 0x02, 0xE0, 0x2F, 0x40, 0x0B, 0xE0, 0x2E, 0x03, 0xF8, 0x00, 0x3D, 0x02, 0xE0, 0x1F,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x10, 0xBD, 0xFE, 0xBE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFE, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x0F, 0xC7, 0xF1, 0xFC, 0x2D, 0x00, 0x00,
-    0x40, 0xFC, 0x7F, 0x0F, 0xC1, 0x90, 0x00, 0x04, 0x0F, 0xC7, 0xF4, 0xFC, 0x18, 0x00, 0x01, 0x90,
-    0xFC, 0x7F, 0x4F, 0xC0, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70,
-    0x0D, 0x70, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F,
-    0xF0, 0x07, 0xD0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x03,
-    0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x2F, 0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x02,
-    0x80, 0x0B, 0xE0, 0x38, 0x2C, 0x38, 0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00,
-    0x00, 0x7F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x00, 0xBF, 0x40, 0x3F, 0xFC, 0x0B, 0xC2, 0xE0, 0xF0, 0x0F, 0x1E, 0x00, 0xF2, 0xD0, 0x0F,
-    0x3C, 0x01, 0xE3, 0xC0, 0x2D, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x3D, 0x0F, 0x41, 0xFB, 0xE0, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x24, 0x00, 0x07, 0x03, 0xC0, 0xE0, 0x34, 0x1C, 0x0B,
-    0x03, 0xC0, 0xE0, 0x74, 0x18, 0x00, 0x00, 0x02, 0x90, 0x00, 0xBC, 0x00, 0x1F, 0xC0, 0x07, 0xBC,
-    0x00, 0xF7, 0x80, 0x3C, 0xB4, 0x0F, 0x0F, 0x02, 0xD0, 0xF0, 0x7E, 0xBF, 0x9B, 0xFF, 0xFD, 0x00,
-    0x2D, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x00, 0xAA, 0xA0, 0x2F, 0xFE, 0x03, 0xC0, 0x00, 0x38,
-    0x00, 0x07, 0x40, 0x00, 0xFF, 0xD0, 0x0B, 0xBF, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-    0x00, 0x0B, 0x43, 0xEB, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x3F, 0xFC, 0x0F,
-    0x80, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xAF, 0xC0, 0xBE, 0x6F, 0x0F, 0x80, 0xF0, 0xF0, 0x0F,
-    0x0F, 0x00, 0xF0, 0xB4, 0x1E, 0x07, 0xEF, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x92,
-    0xFF, 0xFD, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x03, 0xC0, 0x00, 0xF4, 0x00, 0x1F,
-    0x00, 0x03, 0xC0, 0x00, 0xB8, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x3F, 0xFD, 0x0B, 0x81, 0xE0, 0xF0, 0x1E, 0x0B, 0x82, 0xD0, 0x3E, 0xF4, 0x03, 0xFD, 0x01,
-    0xF5, 0xF0, 0x3C, 0x07, 0x87, 0x80, 0x3C, 0x78, 0x0B, 0x83, 0xFA, 0xF0, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x3F, 0xFC, 0x0F, 0x82, 0xD0, 0xF0, 0x1E, 0x1E, 0x01, 0xE1, 0xE0, 0x2E,
-    0x0F, 0x5B, 0xD0, 0xBF, 0xFD, 0x00, 0x53, 0xC0, 0x00, 0xB4, 0x00, 0x2F, 0x03, 0xAF, 0xC0, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0xC0, 0x02, 0xC0, 0x57, 0xD5, 0xFF, 0xFF, 0x03, 0xC0,
-    0x02, 0xC0, 0x02, 0xC0, 0x01, 0x40, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x55, 0x55, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xD0, 0x2E, 0x01, 0xF0, 0x0F,
-    0x00, 0x78, 0x03, 0xD0, 0x0F, 0x00, 0x78, 0x01, 0xE0, 0x0B, 0x40, 0x2D, 0x00, 0x74, 0x01, 0xE0,
-    0x03, 0xC0, 0x0B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0F, 0x00, 0x3C, 0x00, 0xB4, 0x02,
-    0xD0, 0x0B, 0x40, 0x2D, 0x00, 0xB0, 0x03, 0xC0, 0x1F, 0x00, 0xB4, 0x03, 0xC0, 0x2D, 0x01, 0xE0,
-    0x0F, 0x00, 0x50, 0x00, 0x09, 0x2F, 0x80, 0xEE, 0x7D, 0x1F, 0x41, 0xE2, 0xE0, 0x1D, 0x3C, 0x02,
-    0xC3, 0x80, 0x3C, 0x78, 0x03, 0x87, 0x40, 0x74, 0xB0, 0x0B, 0x0A, 0x00, 0x60, 0x00, 0xBE, 0x00,
-    0x7F, 0xFC, 0x0F, 0x43, 0xC1, 0xE0, 0x2D, 0x3D, 0x02, 0xD3, 0xC0, 0x2D, 0x7C, 0x03, 0xD7, 0x80,
-    0x3C, 0x78, 0x03, 0xC7, 0x80, 0xB8, 0x3C, 0x1F, 0x03, 0xFF, 0xD0, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x28, 0x0B, 0xE0, 0xFF, 0x4F, 0x6D, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x03, 0xC0,
-    0x0F, 0x00, 0x7C, 0x01, 0xE0, 0x0B, 0x40, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0x80, 0x24, 0x0F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0x80, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x0F, 0xFF,
-    0x80, 0x10, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x01, 0x6F, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x41, 0x00, 0x7C, 0x0F, 0xAB, 0xD0, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x07, 0xB8, 0x01, 0xEB, 0x40, 0x38,
-    0xF0, 0x0F, 0x0F, 0x03, 0xC1, 0xE0, 0xBE, 0xBF, 0x8F, 0xFF, 0xFC, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x78, 0x00, 0x02, 0xAA, 0x80, 0x3F, 0xFC, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01,
-    0xFF, 0x80, 0x1E, 0xBF, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x00, 0xB0, 0x40, 0x1F, 0x0F, 0xAF,
-    0xD0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x1F, 0xFD, 0x07, 0xD0, 0x00, 0xF0, 0x00,
-    0x1E, 0x00, 0x03, 0xDF, 0xE0, 0x3F, 0x9F, 0x83, 0xC0, 0x3C, 0x7C, 0x03, 0xC3, 0x80, 0x78, 0x3C,
-    0x0F, 0x42, 0xFB, 0xE0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xA0, 0x3F, 0xFF, 0xC0, 0x00,
-    0x2D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x7F, 0xFC, 0x0F, 0x42, 0xD0, 0xF0, 0x2D, 0x0F, 0x03, 0xC0, 0x7E, 0xF0, 0x07, 0xFC, 0x02, 0xF6,
-    0xF0, 0x78, 0x0B, 0x4B, 0x40, 0xB8, 0xB4, 0x0F, 0x47, 0xEB, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xB9, 0x00, 0x7F, 0xF8, 0x0F, 0x03, 0xC2, 0xD0, 0x2D, 0x3C, 0x02, 0xD3, 0xC0, 0x3C, 0x2F,
-    0x5F, 0xC0, 0xFF, 0xBC, 0x01, 0x47, 0x80, 0x00, 0xF0, 0x00, 0x3D, 0x0A, 0xBF, 0x80, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x34, 0x00, 0x0D, 0x00, 0x57, 0x95, 0x3F, 0xFF, 0x80, 0x38,
-    0x00, 0x0D, 0x00, 0x03, 0x40, 0x00, 0x40, 0x00, 0x15, 0x55, 0x4F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE1, 0x55, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x3C, 0x02, 0xD0, 0x0F, 0x00, 0xB4, 0x03, 0xC0, 0x1E, 0x00, 0xB4, 0x03, 0xC0, 0x0F, 0x00,
-    0x3C, 0x00, 0xF0, 0x02, 0xC0, 0x07, 0x40, 0x0F, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x74, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00,
-    0xB4, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0B, 0x40, 0x1E, 0x00, 0x14, 0x00, 0x01, 0xA8, 0x60,
-    0xBE, 0xEE, 0x1E, 0x03, 0xD3, 0xC0, 0x2C, 0x74, 0x02, 0xCB, 0x00, 0x38, 0xB0, 0x07, 0x8B, 0x00,
-    0xF4, 0x3D, 0x7B, 0x01, 0xF8, 0x60, 0x01, 0xB9, 0x02, 0xEB, 0xC1, 0xD0, 0x74, 0xF0, 0x2C, 0x7A,
-    0xBD, 0x2F, 0xA4, 0x0B, 0x00, 0x01, 0xD0, 0x00, 0x3D, 0x5C, 0x02, 0xFE, 0x00, 0x01, 0xA8, 0x00,
-    0xBE, 0xF4, 0x1D, 0x03, 0xC3, 0x80, 0x1C, 0x74, 0x01, 0xCB, 0x00, 0x2C, 0xB0, 0x03, 0xC7, 0x40,
-    0xB4, 0x3D, 0x6E, 0x00, 0xBF, 0x40, 0x02, 0x40, 0x28, 0x02, 0xC0, 0xB0, 0x00, 0xE2, 0xD0, 0x00,
-    0xBB, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x8B, 0x00, 0x0F, 0x03,
-    0x80, 0x2C, 0x01, 0xC0, 0x02, 0xB8, 0x03, 0xAB, 0xC0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x5B, 0xC2,
-    0xFF, 0xE2, 0xD0, 0x74, 0xE0, 0x3C, 0x3D, 0x7C, 0x03, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x38, 0x00,
-    0x03, 0x40, 0x00, 0x70, 0x00, 0x0B, 0x1A, 0x40, 0xEB, 0xBD, 0x0F, 0x40, 0xE1, 0xE0, 0x0D, 0x2C,
-    0x01, 0xD3, 0xC0, 0x2C, 0x38, 0x03, 0xC7, 0x40, 0x38, 0xB0, 0x07, 0x4A, 0x00, 0x70, 0x01, 0x40,
-    0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x70, 0x00, 0x0B, 0x01, 0x80, 0xE0, 0xB4, 0x0E, 0x2D, 0x01,
-    0xDB, 0x40, 0x2E, 0xD0, 0x03, 0xEF, 0x00, 0x38, 0x74, 0x07, 0x43, 0xC0, 0xB0, 0x2D, 0x0A, 0x00,
-    0xE0, 0x01, 0x40, 0xE0, 0x34, 0x1C, 0x0B, 0x03, 0xC0, 0xE0, 0x74, 0x2C, 0x0F, 0x03, 0x81, 0xD0,
-    0x70, 0x2C, 0x00, 0x05, 0x1A, 0x02, 0xA0, 0x0E, 0xBB, 0xCE, 0xBC, 0x0F, 0x41, 0xF4, 0x2C, 0x1E,
-    0x01, 0xE0, 0x2C, 0x2C, 0x02, 0xC0, 0x3C, 0x3C, 0x03, 0xC0, 0x38, 0x38, 0x03, 0x80, 0x34, 0x74,
-    0x07, 0x40, 0x70, 0x70, 0x0B, 0x00, 0xB0, 0xB0, 0x0A, 0x00, 0xA0, 0x02, 0x4B, 0x90, 0x0E, 0xFB,
-    0xC0, 0x7D, 0x07, 0x42, 0xE0, 0x1D, 0x0F, 0x00, 0xB0, 0x38, 0x03, 0xC1, 0xD0, 0x0E, 0x0B, 0x40,
-    0x74, 0x3C, 0x02, 0xC0, 0xE0, 0x0B, 0x00, 0x02, 0x46, 0x80, 0x0D, 0xEB, 0xC0, 0x7D, 0x07, 0x42,
-    0xE0, 0x0E, 0x0F, 0x00, 0x74, 0x38, 0x01, 0xD0, 0xE0, 0x0F, 0x07, 0x80, 0x78, 0x2F, 0x9B, 0xC0,
-    0xE3, 0xF8, 0x03, 0x80, 0x00, 0x1D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0xA9,
-    0x0F, 0xAE, 0x2C, 0x00, 0x1D, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x3C, 0x00, 0x3C, 0xA5, 0xB8,
-    0x7F, 0xD0, 0x02, 0x00, 0x1C, 0x02, 0xFA, 0x1B, 0xE8, 0x1D, 0x00, 0xB0, 0x03, 0xC0, 0x0E, 0x00,
-    0x34, 0x01, 0xD0, 0x07, 0x94, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x03, 0xF4, 0x01, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x2F, 0x00, 0xAA, 0xA8, 0xFC, 0x03, 0xFF, 0xF7, 0xE0, 0x1F, 0x55, 0x4F, 0x80, 0xBC, 0x00,
-    0x3F, 0x03, 0xE0, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0xFE, 0xBE, 0xA9, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xD5, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x01, 0xFE, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFE, 0x7F, 0xC0, 0x0F, 0xEF, 0x0F, 0x00, 0x0F, 0xC7, 0x47, 0x40, 0x0B, 0xD3, 0xC3, 0xC0,
-    0x03, 0xE0, 0xE0, 0xE0, 0x02, 0xF0, 0xB0, 0xB4, 0x00, 0xFC, 0x3C, 0x3C, 0x00, 0x3E, 0x1D, 0x1D,
-    0x00, 0x0F, 0x4F, 0x0F, 0x00, 0x07, 0xD7, 0x83, 0x80, 0x01, 0xF6, 0xC2, 0xD0, 0x00, 0x3E, 0xF0,
-    0xF0, 0x00, 0x0F, 0xF4, 0x74, 0x00, 0x02, 0xFC, 0x3C, 0x00, 0x00, 0x3F, 0x9E, 0x19, 0x00, 0x0B,
-    0xFF, 0xFF, 0x80, 0x03, 0xEF, 0xFF, 0x80, 0x01, 0xD1, 0xE0, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,
-    0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x7F, 0xD0, 0x6D, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x92, 0xF4, 0x3F, 0x02, 0xDF,
-    0xF4, 0x3E, 0x02, 0xFE, 0x50, 0x3E, 0x03, 0xF4, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x3D, 0x07, 0xC0,
-    0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x1F, 0x8F, 0x00,
-    0x00, 0x0F, 0xFF, 0x06, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFD, 0x55, 0x54, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xAF, 0xEA, 0x80, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x05, 0xF9, 0x50, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0F, 0xD0, 0x2C, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1A, 0xFE, 0xAA, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x16, 0xF5, 0x54,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x17, 0xF5, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x6B,
-    0xEA, 0xA4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x01, 0xBD, 0x55, 0x55, 0x40, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xA0, 0x2F, 0x81, 0xFB, 0xE0, 0x00, 0xF1, 0xFF, 0xF3,
-    0xFF, 0xFC, 0x01, 0xF7, 0xD6, 0xFF, 0xF5, 0xBE, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x3F, 0x02, 0xF8,
-    0x00, 0xFF, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-    0x07, 0xD0, 0x03, 0xF4, 0x00, 0x3D, 0x0B, 0xC0, 0x07, 0xF0, 0x00, 0x7C, 0x0F, 0xC0, 0x0F, 0xF0,
-    0x00, 0xBC, 0x0F, 0x80, 0x2F, 0xE0, 0x00, 0xF8, 0x0F, 0x40, 0x7F, 0xD0, 0x00, 0xF8, 0x1F, 0x00,
-    0xF7, 0xC0, 0x01, 0xF4, 0x2F, 0x02, 0xDB, 0xC0, 0x02, 0xF0, 0x3E, 0x07, 0xCF, 0xC0, 0x02, 0xF0,
-    0x3D, 0x0F, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x0F, 0x00, 0x0F, 0xE0, 0x03, 0xC0, 0x03, 0xF8, 0x01, 0xF0, 0x01, 0xFF, 0x00, 0xB8, 0x00,
-    0xBB, 0xC0, 0x3D, 0x00, 0x3D, 0xF0, 0x0F, 0x00, 0x0F, 0x3C, 0x07, 0xC0, 0x2B, 0xEF, 0xAB, 0xFA,
-    0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xB9, 0xB9, 0x7D, 0x40, 0x3D, 0x1E, 0x0F, 0x00, 0x5F, 0x9B, 0xDB,
-    0xD4, 0x7F, 0xFF, 0xFF, 0xFF, 0x1B, 0xFA, 0xBE, 0xFA, 0x40, 0xB8, 0x0F, 0x3D, 0x00, 0x3D, 0x02,
-    0xDF, 0x00, 0x0F, 0x00, 0xBF, 0xC0, 0x07, 0xC0, 0x1F, 0xE0, 0x02, 0xF0, 0x07, 0xF4, 0x00, 0xB8,
-    0x00, 0xFD, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xE6, 0xFE, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x01,
-    0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x1F, 0x43, 0x80, 0x07, 0xC0, 0x07,
-    0xC2, 0xD0, 0x02, 0xF0, 0x03, 0xF1, 0xF4, 0x00, 0xFC, 0x03, 0xFB, 0xFF, 0xF0, 0x3E, 0x5B, 0xFA,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF4, 0x0F, 0x80, 0x07, 0xFF, 0x90, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0x00, 0x2E, 0x00, 0x1F, 0x40, 0x00, 0x0F,
-    0x80, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F,
-    0xF0, 0x3D, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0xBC,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x2F, 0xE4,
-    0x00, 0xF4, 0x01, 0xF0, 0xFF, 0xFC, 0x01, 0xF0, 0x02, 0xF3, 0xF4, 0x68, 0x02, 0xF0, 0x07, 0xE3,
-    0xD0, 0x00, 0x03, 0xE0, 0x1F, 0xC3, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x03, 0xFF,
-    0xF8, 0x03, 0xF4, 0x00, 0x07, 0xD6, 0xF0, 0x00, 0xFE, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3F, 0x80,
-    0x0F, 0x80, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x3D, 0x60, 0x0B, 0xD0, 0x3E, 0x00,
-    0x3E, 0x7F, 0xFF, 0xC0, 0x3D, 0x00, 0x3F, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x02, 0xD0, 0x07, 0xC0, 0x0F, 0x40, 0xF4, 0x03, 0xF0, 0x03, 0xC0, 0x3D, 0x01, 0xFC, 0x02, 0xE0,
-    0x0F, 0x00, 0xBF, 0x00, 0xF4, 0x03, 0xC0, 0x3F, 0xC0, 0x7C, 0x00, 0xF0, 0x1D, 0xF0, 0x2E, 0x00,
-    0x3C, 0x0F, 0x3C, 0x0F, 0x40, 0x0F, 0x03, 0x8F, 0x07, 0xC0, 0x07, 0xC2, 0xD3, 0xC2, 0xE0, 0x0A,
-    0xFA, 0xFA, 0xFA, 0xF9, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x6F, 0x7E, 0x6F, 0x7E, 0x40, 0x0B,
-    0x8F, 0x07, 0x8F, 0x00, 0x02, 0xE7, 0x81, 0xE7, 0x80, 0x00, 0xB6, 0xC0, 0x76, 0xD0, 0x00, 0x2D,
-    0xF0, 0x1D, 0xF0, 0x00, 0x0B, 0xB4, 0x07, 0xB8, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x2E, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7F, 0x40,
-    0x3C, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0xB8, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x19,
-    0x07, 0xC0, 0xF8, 0x00, 0xF4, 0x3E, 0x07, 0xC0, 0xF4, 0x01, 0xF0, 0x3D, 0x0B, 0x80, 0xF0, 0x02,
-    0xF0, 0x3C, 0x0F, 0x41, 0xF0, 0x02, 0xE0, 0x7C, 0x0F, 0x42, 0xE0, 0x03, 0xD0, 0xB8, 0x1F, 0x03,
-    0xE0, 0x03, 0xC0, 0xF8, 0x2F, 0x03, 0xD0, 0x07, 0xC0, 0xF4, 0x2E, 0x07, 0xC0, 0x0B, 0xC1, 0xF0,
-    0x3D, 0x0B, 0xC0, 0x0F, 0x81, 0xF0, 0x3C, 0x0B, 0x80, 0x0F, 0x42, 0xE0, 0x28, 0x0F, 0x40, 0x0F,
-    0x03, 0xD0, 0x00, 0x1F, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x2E, 0x07, 0xC0, 0x02, 0xFC,
-    0x00, 0x3E, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3D, 0x0F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0xAB, 0xFA,
-    0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x55, 0x7E, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x01,
-    0xBE, 0x0B, 0xC0, 0x00, 0x3F, 0xFF, 0x2F, 0x00, 0x03, 0xF9, 0x1F, 0xF8, 0x00, 0x2F, 0x80, 0x1F,
-    0xD0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00,
-    0xF4, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBE, 0x00, 0x07, 0xC0, 0x0B, 0xF4, 0x00, 0x0F, 0xC0, 0xBB, 0xD0,
-    0x00, 0x2F, 0xFF, 0x8F, 0x00, 0x00, 0x2F, 0xF4, 0x7C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1A, 0xAA, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xD4, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x05, 0xBD, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0A,
-    0xFE, 0xAA, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF4, 0x00,
-    0xBC, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x0F, 0x40, 0x1F, 0x80, 0x00, 0x7D, 0x01,
-    0xF8, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x3E, 0x1F, 0x80, 0x00,
-    0x00, 0xF5, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xEA, 0xA0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x05, 0xFF,
-    0x7F, 0x54, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0x7C, 0x02, 0xF0,
-    0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x55, 0x7F, 0x55, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x70, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x60, 0x00, 0x3F, 0xFC, 0xBC,
-    0x00, 0x1E, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x1E, 0x3F, 0x00, 0x00, 0x01, 0x0F, 0x80, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x6F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x6A, 0x40, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xFF, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x0B, 0xE6,
-    0xFC, 0x07, 0xC0, 0x00, 0xBC, 0x0F, 0x40, 0x7C, 0x07, 0xC0, 0x01, 0xF8, 0x2F, 0x00, 0x7C, 0x0B,
-    0xC0, 0x07, 0xF0, 0x3E, 0x00, 0x7C, 0x0F, 0x80, 0x2F, 0xC0, 0x3D, 0x00, 0xBC, 0x0F, 0x96, 0xFF,
-    0x00, 0x7E, 0x02, 0xF4, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x01, 0xF4, 0x7C, 0x00, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x00, 0x3D, 0x07, 0xC0,
-    0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0xF4, 0x00, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x00,
-    0x3C, 0x3D, 0x00, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0x03, 0xF0, 0x00, 0x00,
-    0x7C, 0x3F, 0xD0, 0x00, 0x03, 0xF2, 0xEB, 0x80, 0x00, 0x2F, 0xFF, 0x1F, 0x00, 0x01, 0xF3, 0xF0,
-    0x7C, 0x00, 0x0F, 0x0B, 0x40, 0xF0, 0x00, 0xF4, 0x18, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x0F, 0x95, 0xBF, 0x00, 0x07, 0xD0, 0x07, 0xC0, 0x2B, 0xFA,
-    0xAA, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3E, 0x00, 0x0F, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x6B,
-    0xEA, 0xAB, 0xF9, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0xFC, 0x00, 0x3E, 0x01, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x01, 0xBF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xDF, 0x5B, 0xC0, 0x2F, 0xD1,
-    0xE0, 0x00, 0x07, 0xF0, 0x1D, 0x00, 0x00, 0xFC, 0x02, 0xC0, 0x00, 0x1F, 0x80, 0x3C, 0x00, 0x03,
-    0xF0, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x07, 0xD0, 0x0B, 0x40, 0x00, 0xBC, 0x00, 0xFF,
-    0xFF, 0x0F, 0xC0, 0x0F, 0xFF, 0xF0, 0xFC, 0x00, 0xF5, 0x7F, 0x0F, 0xC0, 0x1E, 0x03, 0xE0, 0xFC,
-    0x02, 0xD0, 0x7D, 0x0B, 0xC0, 0x3C, 0x07, 0xC0, 0x7E, 0x03, 0xC0, 0xBC, 0x03, 0xF4, 0x78, 0x0F,
-    0x80, 0x1F, 0xEB, 0x41, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00,
-    0x00, 0x00, 0x2F, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x00, 0xFC, 0x3C, 0x00, 0x00,
-    0x01, 0xF4, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x0F,
-    0x40, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0B, 0xC0,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0xF5, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x0A, 0xAA, 0xAA, 0xBF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x05, 0x55, 0xFF, 0xE5, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x15, 0xFF, 0xF9, 0x55, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xEA, 0xAA, 0xA9, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x6C, 0x00, 0x07,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0x9F, 0x5E, 0x00, 0xBF, 0x03, 0x80, 0x00, 0x7F, 0x01, 0xD0, 0x00, 0x3F, 0x00, 0xB0, 0x00, 0x1F,
-    0x40, 0x3C, 0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x03, 0xE0, 0x07, 0x80, 0x01, 0xF4, 0x02, 0xD0, 0x00,
-    0xBC, 0x00, 0xB0, 0x00, 0x3F, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x0E, 0x00, 0x03, 0xF0, 0x07, 0x80,
-    0x00, 0xFC, 0x02, 0xD0, 0x00, 0x2F, 0x00, 0xF0, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x00, 0xFD, 0x0E,
-    0x00, 0x00, 0x1F, 0xEB, 0x46, 0x40, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x06, 0xFE,
-    0xAB, 0xFA, 0x92, 0xFF, 0xFF, 0xFF, 0xFD, 0x06, 0xF5, 0x5B, 0xD5, 0x40, 0x2F, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x7C, 0x01,
-    0xF0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00,
-    0xF4, 0x07, 0xD0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x07, 0xD0, 0x00, 0x3E, 0x00, 0x3F,
-    0xFC, 0x03, 0xE0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0x91, 0x7C,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x68, 0x28, 0x1A, 0x07, 0xD0, 0x3B,
-    0xBB, 0xDE, 0xE1, 0xF4, 0x1C, 0xF4, 0x78, 0x38, 0x7D, 0x03, 0x78, 0x1C, 0x0E, 0x3F, 0x00, 0xBD,
-    0x0B, 0x03, 0xBF, 0x40, 0x0F, 0xFB, 0xD6, 0xFF, 0x40, 0x02, 0xEF, 0xFF, 0xFD, 0x00, 0x00, 0xE0,
-    0x75, 0x78, 0x00, 0x00, 0x34, 0x1C, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xE9, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x10, 0x00, 0x3E,
-    0x06, 0xF0, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0xBF, 0xE4, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x2E, 0xFC,
-    0x07, 0xC0, 0x00, 0xF9, 0xFF, 0x80, 0x01, 0xFF, 0xE4, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x04, 0x43, 0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xC0,
-    0x00, 0xF8, 0x0B, 0xC0, 0x03, 0xF0, 0x0F, 0x80, 0x1F, 0xD0, 0x0F, 0x85, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0x00, 0x0F, 0x0B, 0x80, 0x00, 0x00, 0x74, 0x1E, 0x00,
-    0x00, 0x01, 0xE0, 0xB4, 0x00, 0x00, 0x03, 0xE7, 0xE5, 0x55, 0x50, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x06, 0xFE, 0xAA, 0xAF, 0xF0, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x0B, 0x40, 0x00, 0x03, 0x40, 0x3C,
-    0x00, 0x00, 0x0E, 0x00, 0xF1, 0xE1, 0xD0, 0x34, 0x03, 0xEF, 0xEF, 0xC2, 0xC0, 0x1F, 0xD7, 0xE7,
-    0xEF, 0x00, 0x7D, 0x0A, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03,
-    0x8F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x10, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x2F, 0x02, 0xF4, 0x01,
-    0xF8, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0x3E, 0x00, 0xBC, 0x07, 0xD0, 0x07, 0xD0, 0x0B, 0xC0,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
-    0x0F, 0x40, 0x00, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x00, 0x00, 0x2F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x56, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0xFD, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x80,
-    0x00, 0xBC, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0xBF, 0x00, 0xAF, 0xEA, 0xBF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x1A, 0xFE, 0xA5, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0xE0, 0x00, 0x00, 0x01, 0xD1, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xDB, 0xFC, 0x00, 0x0B,
-    0xFB, 0x43, 0x80, 0x00, 0x2F, 0x8B, 0x07, 0x40, 0x00, 0x3F, 0x0F, 0x0B, 0x00, 0x00, 0xBC, 0x0F,
-    0x0F, 0x00, 0x00, 0xF8, 0x0E, 0x0E, 0x00, 0x01, 0xF4, 0x1D, 0x1D, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x5F, 0xF9, 0x55, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xD1, 0xC0, 0x00, 0x02, 0xC3, 0xC0,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0xFD, 0x5B, 0xF4,
-    0x00, 0xF8, 0x01, 0xFC, 0x01, 0xF4, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFC,
-    0x03, 0xE0, 0x01, 0xF4, 0x03, 0xD0, 0x0B, 0xE0, 0x07, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x0F, 0xC0, 0x6F, 0x80, 0x0F, 0x80, 0x0B, 0xD0, 0x0F, 0x40, 0x03, 0xE0, 0x1F, 0x00, 0x03, 0xE0,
-    0x2F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x0F, 0xC0, 0x7D, 0x01, 0xBF, 0x40,
-    0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x07, 0x4B, 0x00, 0x00, 0x0B, 0x0F, 0x00, 0x00,
-    0x0E, 0x0E, 0x00, 0x00, 0x3F, 0xFF, 0x0F, 0xFF, 0xC1, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE9, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+static const uint8_t notosans_14_italicBitmaps[40014] = {
+    0x4E, 0x49, 0xDA, 0x4A, 0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x5D, 0x94, 0x9D, 0x5A, 0xD5, 0xDA, 0x5D,
+    0x95, 0xD5, 0x9D, 0x59, 0xCA, 0x5A, 0xC9, 0x77, 0x79, 0x95, 0xE4, 0x9E, 0x49, 0xE5, 0x99, 0x50,
+    0x0A, 0xCA, 0x1A, 0xCA, 0x1D, 0xA1, 0xDA, 0x1D, 0x91, 0xD9, 0x09, 0xD2, 0xD1, 0x9C, 0xA1, 0x9D,
+    0x1A, 0xC9, 0x1A, 0xC9, 0x1A, 0xC2, 0xAC, 0x2A, 0xA2, 0xAA, 0x20, 0x79, 0xCA, 0x3D, 0x72, 0xAC,
+    0x92, 0x9C, 0xA7, 0x2D, 0x3A, 0xC9, 0x72, 0xD3, 0xD7, 0x29, 0xCA, 0x3D, 0x72, 0xAC, 0x92, 0x9C,
+    0xA6, 0xAA, 0xAA, 0xDA, 0xAA, 0xAE, 0xAA, 0xA2, 0x9F, 0xFF, 0xF3, 0x99, 0x9A, 0xCA, 0x99, 0x9A,
+    0xCA, 0x99, 0x97, 0xD3, 0xAC, 0x97, 0x2D, 0x3D, 0x72, 0x9C, 0xA3, 0xD7, 0x2D, 0x92, 0xAC, 0xA6,
+    0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x95, 0xAC, 0x92, 0x9C, 0xA7, 0x2D, 0x3A, 0xC9, 0x72, 0xD3, 0xD7,
+    0x29, 0xCA, 0x29, 0xD7, 0x2D, 0x92, 0xAC, 0xA7, 0x2D, 0x3D, 0x70, 0x77, 0x71, 0xCA, 0x74, 0x9C,
+    0x97, 0x29, 0xAD, 0xA9, 0x79, 0xFF, 0xC4, 0x9E, 0xAD, 0xAE, 0x4D, 0xA0, 0x9C, 0xA7, 0x9D, 0x1A,
+    0xC9, 0x7A, 0xD1, 0xAC, 0x70, 0x9D, 0x1D, 0x71, 0xE9, 0xD7, 0x19, 0xFA, 0x72, 0x9F, 0xC9, 0x72,
+    0xFC, 0xA7, 0x1D, 0x0A, 0xD9, 0x70, 0xCA, 0x1D, 0x97, 0x9C, 0xA1, 0xD9, 0x7A, 0xC9, 0x1D, 0x92,
+    0xA3, 0xD1, 0xE3, 0xEA, 0xAF, 0xD4, 0xAF, 0xFA, 0x79, 0x9D, 0xA9, 0x73, 0xAC, 0x75, 0xD7, 0x5A,
+    0xA7, 0x00, 0x77, 0x79, 0xF7, 0x9C, 0xA3, 0xAF, 0xD6, 0xD4, 0xD9, 0x1D, 0x5D, 0x93, 0xAC, 0xA2,
+    0xD9, 0x3A, 0xCA, 0x4D, 0x3D, 0x92, 0x9D, 0x49, 0xD3, 0xD3, 0xD5, 0x9C, 0xA3, 0xD2, 0xD9, 0x5A,
+    0xCA, 0x29, 0xD1, 0xAC, 0xA6, 0xAC, 0x92, 0xAC, 0x90, 0x9D, 0x09, 0xAC, 0xA9, 0x1A, 0xCA, 0x2D,
+    0x1D, 0x09, 0xFC, 0x90, 0x9D, 0x1D, 0xA0, 0xD9, 0x9D, 0x90, 0xAD, 0x1F, 0xD0, 0xAC, 0xA0, 0xD9,
+    0x2D, 0x2E, 0xA0, 0x9D, 0x1D, 0x3D, 0x7D, 0x1A, 0xCA, 0x3D, 0x6D, 0x91, 0xAC, 0x92, 0x9D, 0x5A,
+    0xCA, 0x2D, 0x92, 0xAC, 0xA4, 0x9D, 0x3D, 0x3D, 0x94, 0xD4, 0xD3, 0xD4, 0xD9, 0x4D, 0x91, 0xD9,
+    0x3A, 0xCA, 0x59, 0xDA, 0xE3, 0x9D, 0x7A, 0xEA, 0x77, 0x19, 0x50, 0x77, 0x71, 0x9F, 0xC9, 0x72,
+    0xAF, 0xE9, 0x70, 0x9D, 0xA2, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0x70, 0xDA, 0x3A, 0xD7,
+    0x0D, 0xA2, 0x9D, 0xA7, 0x09, 0xD1, 0xAD, 0xA7, 0x2F, 0xD9, 0x73, 0xFA, 0x73, 0x9F, 0xC7, 0x3E,
+    0xA0, 0xDA, 0x4D, 0xA1, 0xE9, 0x19, 0xD9, 0x29, 0xD1, 0x9D, 0x93, 0xAD, 0x2D, 0xA1, 0xDA, 0x5E,
+    0x0A, 0xD2, 0xDA, 0x59, 0xFC, 0x92, 0xDA, 0x6A, 0xE9, 0x3E, 0x6A, 0xE4, 0xAD, 0xA3, 0x9F, 0xD4,
+    0xFF, 0xD0, 0x9D, 0xA4, 0xAF, 0xD9, 0x2A, 0xD9, 0x69, 0x73, 0x0A, 0xCA, 0x0D, 0xA0, 0xD9, 0x9D,
+    0x09, 0xCA, 0x0A, 0xC9, 0x0A, 0xC1, 0xAA, 0x10, 0x6D, 0x95, 0xDA, 0x5A, 0xD5, 0x9D, 0x6D, 0x95,
+    0xE5, 0x9D, 0x95, 0xE6, 0xD9, 0x5A, 0xD6, 0xDA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xAD, 0x6D, 0xA6,
+    0xDA, 0x6D, 0xA6, 0xDA, 0x6A, 0xCA, 0x6A, 0xD6, 0x9D, 0x7D, 0x7A, 0xC9, 0x69, 0xD7, 0xAA, 0x50,
+    0x5A, 0xC9, 0x79, 0xD7, 0x0D, 0x70, 0xAC, 0xA7, 0xAD, 0x79, 0xD7, 0x9D, 0x70, 0xD7, 0x0D, 0x97,
+    0xD7, 0x9D, 0x79, 0xD7, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0x96, 0xAD, 0x7D, 0xA6, 0x9D, 0x7D, 0xA6,
+    0x9D, 0x7D, 0x96, 0xDA, 0x6A, 0xD6, 0x9D, 0x7A, 0xA7, 0x77, 0x39, 0xD7, 0x2A, 0xD7, 0x2A, 0xC9,
+    0x49, 0xC9, 0x2A, 0xC5, 0xF9, 0x0D, 0x69, 0xFC, 0xA9, 0x99, 0xAA, 0x93, 0x9F, 0xF9, 0x3A, 0xE0,
+    0x99, 0xAA, 0x3D, 0xA9, 0xC9, 0x6E, 0x1D, 0x5E, 0x2D, 0x95, 0xC9, 0x2A, 0xD7, 0x29, 0xCA, 0x77,
+    0x10, 0x59, 0x97, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x59, 0x99, 0x99, 0x9D, 0x99, 0x99,
+    0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xA5, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3C, 0xA5, 0x39,
+    0x93, 0xAD, 0x92, 0xE2, 0x9D, 0x3D, 0xA2, 0x9D, 0x3A, 0xCA, 0x3C, 0xA3, 0x0F, 0xE1, 0xFE, 0x19,
+    0x99, 0x99, 0x99, 0x00, 0x19, 0x91, 0xE0, 0x9E, 0x09, 0xE1, 0x99, 0x10, 0x73, 0xDA, 0x72, 0xAD,
+    0x73, 0xDA, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x73, 0xDA,
+    0x72, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D,
+    0x97, 0x2D, 0xA7, 0x2A, 0xD7, 0x3D, 0xA7, 0x20, 0x77, 0x49, 0xFC, 0x7F, 0xF5, 0xEA, 0x19, 0xE3,
+    0xAD, 0x93, 0xAD, 0x3D, 0xA4, 0x9D, 0x91, 0xAD, 0x6D, 0xA1, 0xDA, 0x6D, 0xA0, 0x9D, 0x96, 0xDA,
+    0x0A, 0xD7, 0xDA, 0x0E, 0x7D, 0x90, 0xDA, 0x69, 0xD9, 0x0D, 0x96, 0xAD, 0x09, 0xD9, 0x6E, 0x09,
+    0xD9, 0x6D, 0xA0, 0x9D, 0x95, 0x9D, 0x90, 0x9D, 0x95, 0xE2, 0xD9, 0x49, 0xDA, 0x2E, 0x4E, 0x3A,
+    0xDA, 0x2E, 0x94, 0xFF, 0x96, 0xFD, 0x72, 0x99, 0x70, 0x5A, 0xCA, 0x39, 0xEA, 0x2F, 0xC9, 0x0A,
+    0xEA, 0xD0, 0xAE, 0x9A, 0xD1, 0xCA, 0x1E, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xDA,
+    0x49, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5E, 0x5D, 0xA3, 0x77, 0x59,
+    0xFC, 0xA6, 0x9F, 0xFC, 0x94, 0xE9, 0x2A, 0xE5, 0xA5, 0xAD, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97,
+    0x39, 0xD7, 0x4E, 0x73, 0x9D, 0x97, 0x29, 0xDA, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x2A,
+    0xDA, 0x72, 0xAD, 0xA7, 0x2A, 0xD9, 0x72, 0xE9, 0x72, 0xE7, 0x3E, 0x99, 0x99, 0x99, 0x99, 0x92,
+    0xAF, 0xFF, 0x91, 0xFF, 0xFC, 0x20, 0x77, 0x5A, 0xFC, 0xA6, 0xAF, 0xFC, 0x94, 0xE9, 0x2A, 0xE5,
+    0x95, 0xAD, 0x74, 0x9D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x39, 0xD9, 0x72, 0xAD, 0xA6, 0xAF, 0xD9,
+    0x7F, 0xCA, 0x71, 0x99, 0x9A, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D,
+    0x97, 0x3E, 0x29, 0xCA, 0x49, 0xEA, 0x29, 0xFF, 0xDA, 0x49, 0xFF, 0x97, 0x19, 0x97, 0x00, 0x73,
+    0xAD, 0x73, 0xAE, 0x72, 0xAF, 0x71, 0x9D, 0xAC, 0xA7, 0x09, 0xD9, 0xD9, 0x70, 0xDA, 0x0D, 0x70,
+    0xDA, 0x09, 0xD7, 0xE1, 0xAD, 0x6A, 0xD2, 0xDA, 0x5A, 0xD3, 0xD9, 0x49, 0xD9, 0x29, 0xD4, 0x9D,
+    0x93, 0xAD, 0x4D, 0xA4, 0xDA, 0x3D, 0xA5, 0xDA, 0x29, 0xFF, 0xFD, 0xAA, 0xFF, 0xFD, 0x90, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x99, 0x71, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0x9D, 0x40, 0x4F, 0xFC,
+    0x93, 0x9F, 0xFC, 0x93, 0xAD, 0xAA, 0xAA, 0xAA, 0xA4, 0xD9, 0x73, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7,
+    0x3D, 0x97, 0x29, 0xDA, 0xAA, 0xA9, 0x6A, 0xFF, 0x95, 0xAA, 0x99, 0x9A, 0xE9, 0x72, 0x9E, 0x73,
+    0xE7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x2A, 0xD9, 0x1C, 0xA4, 0x9E, 0xA2, 0xFF,
+    0xDA, 0x39, 0xFE, 0xA9, 0x70, 0x99, 0x70, 0x77, 0x69, 0xFD, 0x59, 0xFE, 0xA4, 0xAE, 0xA7, 0x0A,
+    0xDA, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x73, 0xD9, 0x0A, 0xF9, 0x39, 0xD9, 0xFE,
+    0x92, 0xAF, 0x91, 0x9E, 0x2E, 0xA4, 0x9D, 0x91, 0xE6, 0xDA, 0x1D, 0xA6, 0xDA, 0x1D, 0x96, 0xD9,
+    0x1D, 0x96, 0xD9, 0x1D, 0xA5, 0xAD, 0x2E, 0x5D, 0xA2, 0x9D, 0xA2, 0x9E, 0x4F, 0xFC, 0x6A, 0xFC,
+    0xA7, 0x29, 0x70, 0x09, 0xFF, 0xF9, 0x0A, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE7, 0x29,
+    0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x73,
+    0xDA, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xE7, 0x29, 0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72,
+    0xE7, 0x29, 0xD9, 0x72, 0x77, 0x4A, 0xFC, 0xA6, 0xFF, 0xC4, 0xE9, 0x2E, 0x92, 0x9D, 0x94, 0xDA,
+    0x2A, 0xD5, 0xE2, 0xAD, 0x5D, 0xA2, 0xAD, 0x5D, 0x93, 0xDA, 0x3E, 0x4A, 0xDA, 0x0A, 0xE6, 0xAF,
+    0xC9, 0x6A, 0xFC, 0xA5, 0x9E, 0xA0, 0xAD, 0xA3, 0x9D, 0xA3, 0xAD, 0xA2, 0xDA, 0x5E, 0x19, 0xD6,
+    0x9D, 0x1A, 0xD6, 0x9D, 0x90, 0xAD, 0x6A, 0xD1, 0xAD, 0x95, 0xE2, 0xE9, 0x3E, 0x92, 0x9F, 0xFC,
+    0xA4, 0x9F, 0xE9, 0x70, 0x99, 0x70, 0x77, 0x39, 0xFC, 0x96, 0xAF, 0xEA, 0x4A, 0xDA, 0x2A, 0xD9,
+    0x29, 0xD9, 0x4E, 0x2E, 0x59, 0xD2, 0xD9, 0x59, 0xD1, 0x9D, 0x69, 0xD1, 0x9D, 0x69, 0xD1, 0x9D,
+    0x6E, 0x19, 0xD9, 0x49, 0xE2, 0xE3, 0x9F, 0x29, 0xFE, 0xAD, 0xA3, 0x9F, 0xC9, 0x0D, 0x96, 0x92,
+    0xAD, 0x73, 0xDA, 0x72, 0x9D, 0x73, 0xE7, 0x2E, 0x39, 0x49, 0xE9, 0x3A, 0xFF, 0x94, 0xAF, 0xDA,
+    0x71, 0x99, 0x71, 0x71, 0x9D, 0x92, 0xEA, 0x2E, 0x92, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x29, 0x93,
+    0xE2, 0x9E, 0x29, 0xE3, 0x99, 0x30, 0x75, 0x9D, 0x94, 0xEA, 0x4E, 0x94, 0xAC, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x49, 0x95, 0xE4, 0x9D, 0xA4, 0xAD, 0x5D, 0x94, 0x9D, 0x5D, 0x95, 0xCA, 0x50, 0x74,
+    0x97, 0x2A, 0xD7, 0x0A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xEA, 0x6A, 0xE9, 0x7E, 0x97, 0x1A,
+    0xEA, 0x72, 0xAE, 0xA9, 0x71, 0xAF, 0x97, 0x19, 0xFA, 0x71, 0x9A, 0xEA, 0x72, 0xAD, 0x74, 0x90,
+    0x75, 0xFF, 0xFC, 0xAA, 0xFF, 0xF9, 0x77, 0x77, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x97, 0x4D, 0xA7, 0x2A, 0xEA, 0x72,
+    0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0xAE, 0xA7, 0x2A, 0xEA, 0x72, 0xAE, 0x70, 0xAE, 0xA5, 0x9F, 0xA5,
+    0xAF, 0x94, 0x9A, 0xF9, 0x5F, 0xA7, 0x0D, 0xA7, 0x29, 0x74, 0x75, 0x9A, 0xFA, 0x92, 0xFF, 0xC9,
+    0x1A, 0xCA, 0x91, 0xAE, 0x70, 0xAD, 0x70, 0x9D, 0x70, 0x9D, 0x70, 0xE7, 0x9D, 0x96, 0xAD, 0xA6,
+    0xAD, 0xA6, 0xEA, 0x6E, 0x96, 0x9D, 0x70, 0xD9, 0x70, 0xD7, 0x77, 0x70, 0x9A, 0x70, 0x9E, 0x7A,
+    0xE7, 0xAD, 0x97, 0x09, 0x97, 0x00, 0x71, 0x9A, 0xAD, 0xAA, 0x97, 0x4A, 0xFF, 0xD9, 0x70, 0xAE,
+    0xA9, 0x29, 0x9E, 0xA6, 0xE9, 0x70, 0x9D, 0x94, 0xE7, 0x39, 0xD3, 0xAC, 0xA7, 0x5D, 0x91, 0x9D,
+    0x4A, 0xFC, 0xA2, 0xAC, 0xA1, 0xD9, 0x29, 0xFA, 0xE2, 0x9D, 0x09, 0xD3, 0xDA, 0x29, 0xD3, 0xD0,
+    0xD9, 0x2D, 0xA3, 0xAC, 0xA3, 0xD0, 0xD2, 0x9D, 0x4D, 0x92, 0x9D, 0x9D, 0x2A, 0xC9, 0x4D, 0x39,
+    0xCA, 0x9D, 0x2D, 0x93, 0x9D, 0x3A, 0xC9, 0x9C, 0xA2, 0xD4, 0xDA, 0x3D, 0x09, 0xD2, 0xD9, 0x29,
+    0xDA, 0x2A, 0xCA, 0x09, 0xD2, 0xDA, 0x19, 0xCA, 0xD1, 0xAD, 0x2D, 0x29, 0xFC, 0xA0, 0xFD, 0x92,
+    0xD9, 0x29, 0xE9, 0x2A, 0xDA, 0x4A, 0xD7, 0x74, 0xDA, 0x77, 0x39, 0xE7, 0x73, 0x9F, 0x99, 0x99,
+    0x9A, 0xDA, 0x72, 0xAF, 0xFD, 0x97, 0x49, 0xAA, 0xAA, 0x99, 0x70, 0x72, 0x9D, 0x97, 0x4E, 0xA7,
+    0x3A, 0xEA, 0x73, 0xDA, 0xD7, 0x2A, 0xD9, 0xD7, 0x2D, 0x99, 0xD7, 0x1E, 0x1D, 0x70, 0x9D, 0x91,
+    0xD9, 0x7E, 0x2D, 0x96, 0x9D, 0x92, 0xDA, 0x6D, 0xA3, 0xDA, 0x59, 0xD4, 0xAD, 0x5F, 0xFE, 0x4A,
+    0xFF, 0xE4, 0xEA, 0xAA, 0xAA, 0xAA, 0xD3, 0xAD, 0x69, 0xD9, 0x2D, 0xA7, 0xD9, 0x1E, 0x70, 0xDA,
+    0x09, 0xDA, 0x70, 0xDA, 0x0E, 0x71, 0xE9, 0xD9, 0x71, 0xAD, 0x39, 0xFD, 0xAA, 0x7A, 0xFF, 0xCA,
+    0x5E, 0x99, 0x99, 0xAE, 0xA4, 0xDA, 0x5E, 0x39, 0xD9, 0x5A, 0xD3, 0xAD, 0x6A, 0xD3, 0xAD, 0x6A,
+    0xD3, 0xDA, 0x59, 0xDA, 0x3D, 0x94, 0xAE, 0x39, 0xFF, 0xD9, 0x4A, 0xFF, 0xC9, 0x5E, 0x39, 0xAD,
+    0xA4, 0xDA, 0x5A, 0xD9, 0x3D, 0x96, 0xDA, 0x29, 0xD7, 0xE2, 0xAD, 0x7E, 0x2D, 0xA6, 0x9D, 0xA2,
+    0xDA, 0x6E, 0x29, 0xD9, 0x39, 0xAE, 0x92, 0x9F, 0xFE, 0x93, 0xAF, 0xFA, 0x95, 0x77, 0x79, 0xFD,
+    0xA9, 0x59, 0xFF, 0xD4, 0xAE, 0xA9, 0x19, 0x9C, 0xA3, 0xAE, 0x73, 0x9E, 0x74, 0xE7, 0x49, 0xDA,
+    0x74, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xAD,
+    0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xEA, 0x39, 0xA9, 0x5A, 0xFF, 0xCA, 0x69, 0xFF, 0x97, 0x29,
+    0x97, 0x39, 0xFD, 0xA9, 0x70, 0xAF, 0xFC, 0xA6, 0xE9, 0x99, 0xAF, 0xA5, 0xDA, 0x49, 0xE9, 0x39,
+    0xD9, 0x6E, 0x3A, 0xD7, 0xAD, 0x3A, 0xD7, 0x9D, 0x92, 0xDA, 0x70, 0xDA, 0x2D, 0x97, 0x0D, 0xA1,
+    0x9D, 0x71, 0xDA, 0x1A, 0xD7, 0x09, 0xD9, 0x1E, 0x70, 0xAD, 0x91, 0xDA, 0x70, 0xE2, 0xD9, 0x70,
+    0xDA, 0x19, 0xD7, 0x0A, 0xD9, 0x1A, 0xD7, 0x9E, 0x2D, 0xA6, 0x9E, 0x3D, 0xA5, 0xAE, 0x92, 0x9D,
+    0xA9, 0x99, 0x9A, 0xF9, 0x39, 0xFF, 0xDA, 0x5A, 0xFE, 0xA9, 0x70, 0x39, 0xFF, 0xD4, 0xAF, 0xFD,
+    0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74,
+    0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97,
+    0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD,
+    0x4A, 0xFF, 0xD4, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39,
+    0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x97, 0x3A, 0xFF, 0xC9, 0x4F,
+    0xFD, 0x94, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97,
+    0x39, 0xD7, 0x4A, 0xD7, 0x40, 0x77, 0x70, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xE4, 0xAF, 0x99, 0x09,
+    0x9A, 0xD3, 0xAE, 0x97, 0x39, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x76, 0xDA, 0x75, 0x9D, 0x97,
+    0x5A, 0xD5, 0x9F, 0xD1, 0xE5, 0xAF, 0xD1, 0xE5, 0x99, 0x99, 0xE1, 0xE7, 0x1D, 0xA1, 0xE7, 0x09,
+    0xD9, 0x1A, 0xD7, 0x09, 0xD2, 0x9D, 0xA7, 0xAD, 0x3E, 0x96, 0xDA, 0x39, 0xEA, 0x49, 0xD9, 0x49,
+    0xFF, 0xE7, 0xAF, 0xEA, 0x97, 0x29, 0x97, 0x00, 0x39, 0xD7, 0x0A, 0xCA, 0x3A, 0xD7, 0x0D, 0xA3,
+    0xDA, 0x70, 0xD9, 0x3D, 0xA7, 0x9D, 0x92, 0x9D, 0x97, 0xAD, 0x3A, 0xD7, 0x0A, 0xD3, 0xAD, 0x70,
+    0xDA, 0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xD3, 0xE9, 0x99,
+    0x99, 0x99, 0x99, 0xDA, 0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3, 0x9D, 0x70, 0xAD, 0x3A, 0xD7,
+    0x0D, 0xA3, 0xE7, 0x0D, 0xA3, 0xDA, 0x79, 0xD9, 0x29, 0xD9, 0x79, 0xD3, 0x9D, 0x70, 0xAD, 0x3A,
+    0xD7, 0x0D, 0xA3, 0x4F, 0xE4, 0x9F, 0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x71,
+    0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D,
+    0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x7A, 0xFC, 0xA4, 0x9F, 0xE4, 0x71, 0x9D,
+    0x72, 0xAD, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D,
+    0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0xDA, 0x71, 0x9D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x70, 0x9E, 0x59,
+    0xFD, 0x95, 0xAF, 0xC9, 0x79, 0xA9, 0x97, 0x00, 0x39, 0xD6, 0x9D, 0x93, 0xAD, 0x59, 0xDA, 0x4D,
+    0xA4, 0x9D, 0xA5, 0xD9, 0x39, 0xDA, 0x59, 0xD9, 0x29, 0xDA, 0x6A, 0xD2, 0x9D, 0xA7, 0xAD, 0x19,
+    0xDA, 0x70, 0xDA, 0x09, 0xDA, 0x71, 0xD9, 0x9D, 0xA7, 0x19, 0xD9, 0xE7, 0x2A, 0xFD, 0x97, 0x1F,
+    0x9E, 0x71, 0xE1, 0x9D, 0x97, 0x0D, 0x92, 0xDA, 0x79, 0xD3, 0xAD, 0x7A, 0xD4, 0xDA, 0x6D, 0xA4,
+    0xE6, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x5E, 0x49, 0xD6, 0xAD, 0x4A, 0xD7, 0xDA, 0x30, 0x39, 0xD7,
+    0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79,
+    0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x9D, 0xA9, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xD0, 0xAF, 0xFD, 0x00, 0x39, 0xE7, 0x29, 0xE9, 0x3A,
+    0xE9, 0x71, 0xF9, 0x3F, 0xA7, 0x0A, 0xF4, 0xDA, 0xCA, 0x70, 0xDA, 0xD3, 0x9D, 0x9D, 0x7A, 0xCA,
+    0xDA, 0x3A, 0xD9, 0xD6, 0x9D, 0x0D, 0xA3, 0xDA, 0x0D, 0x6D, 0xA0, 0xD9, 0x3D, 0x90, 0xD5, 0x9D,
+    0x09, 0xD4, 0xD9, 0x0D, 0x5D, 0x90, 0xAD, 0x39, 0xD1, 0xD9, 0x39, 0xD1, 0xDA, 0x3A, 0xD1, 0xAC,
+    0x93, 0xD9, 0x1D, 0x93, 0xDA, 0x1A, 0xCA, 0x2A, 0xD1, 0x9D, 0x93, 0xD9, 0x19, 0xCA, 0x2D, 0x91,
+    0xAD, 0x4D, 0x29, 0xD1, 0xAC, 0xA2, 0xAD, 0x39, 0xD3, 0xD1, 0xD3, 0xDA, 0x3A, 0xD3, 0xD0, 0xAC,
+    0xA3, 0xD9, 0x3D, 0xA3, 0xD9, 0xD3, 0x9D, 0x4D, 0x93, 0xFA, 0x3A, 0xD3, 0x9D, 0x4F, 0x4E, 0x3A,
+    0xD4, 0xAD, 0x94, 0xDA, 0x3A, 0xCA, 0x4A, 0xD5, 0xD9, 0x30, 0x39, 0xD9, 0x70, 0xAC, 0xA3, 0xAE,
+    0x70, 0xD9, 0x3F, 0x70, 0xD9, 0x3F, 0xA6, 0x9D, 0x39, 0xDA, 0xD6, 0xAD, 0x3A, 0xD0, 0xD9, 0x5D,
+    0xA3, 0xDA, 0x0D, 0xA5, 0xD9, 0x3D, 0x90, 0x9D, 0x49, 0xD4, 0xD9, 0x1D, 0x93, 0x9D, 0x39, 0xD2,
+    0xAD, 0x3A, 0xD3, 0xAD, 0x29, 0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x2D, 0x93, 0xD9, 0x3A, 0xD1, 0x9D,
+    0x4D, 0x5D, 0x90, 0xAD, 0x39, 0xD5, 0xDA, 0x0A, 0xCA, 0x3A, 0xD5, 0x9D, 0x0D, 0xA3, 0xDA, 0x6D,
+    0x9D, 0x93, 0xD9, 0x6A, 0xF3, 0x9D, 0x79, 0xF3, 0xAD, 0x70, 0xEA, 0x3A, 0xCA, 0x70, 0xAD, 0x93,
+    0x77, 0x71, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD,
+    0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0,
+    0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9,
+    0x0E, 0x72, 0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3,
+    0xAE, 0xA5, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x10, 0x39, 0xFD, 0xA9, 0x6A, 0xFF,
+    0xC5, 0xE9, 0x99, 0xAE, 0xA4, 0xDA, 0x4E, 0x39, 0xD9, 0x49, 0xD9, 0x2A, 0xD6, 0xDA, 0x2A, 0xD6,
+    0xD9, 0x2D, 0xA5, 0x9D, 0x92, 0xD9, 0x5E, 0x29, 0xD5, 0xAD, 0xA2, 0xAD, 0x99, 0x99, 0xAE, 0xA3,
+    0xFF, 0xD9, 0x4F, 0xDA, 0xA9, 0x6D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39,
+    0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0x77, 0x71, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91,
+    0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7,
+    0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E,
+    0x73, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7, 0x19, 0xDA, 0x19, 0xDA, 0x70, 0xE3,
+    0xE9, 0x6E, 0x93, 0x9E, 0xA3, 0xAE, 0x95, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0xAD, 0x97,
+    0x7E, 0x77, 0x0E, 0x77, 0xAD, 0xA7, 0x7E, 0x93, 0x39, 0xFD, 0xA9, 0x6A, 0xFF, 0xC5, 0xE9, 0x99,
+    0xAF, 0x4D, 0xA4, 0xAD, 0x92, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2A, 0xD6, 0xDA, 0x2D, 0xA5,
+    0x9D, 0x92, 0xD9, 0x5E, 0x29, 0xD4, 0x9E, 0x92, 0xAF, 0xFD, 0x93, 0xFF, 0xC9, 0x5D, 0xA9, 0x99,
+    0xDA, 0x6D, 0x92, 0xAD, 0x59, 0xD3, 0x9D, 0x94, 0xAD, 0x4E, 0x4D, 0xA4, 0xAD, 0x4D, 0xA5, 0xDA,
+    0x29, 0xD9, 0x5E, 0x29, 0xD6, 0xAD, 0x91, 0xAD, 0x7D, 0xA1, 0x77, 0x59, 0xFD, 0xA6, 0xFF, 0xD4,
+    0xF9, 0x19, 0xAC, 0xA3, 0x9D, 0xA7, 0x3E, 0x74, 0xE7, 0x4E, 0x74, 0xAD, 0x97, 0x39, 0xE9, 0x73,
+    0x9F, 0x73, 0x9F, 0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x4E, 0x74, 0xE7, 0x4A, 0xD7, 0x4E, 0x73,
+    0xAD, 0xA2, 0x9C, 0x93, 0x9A, 0xE3, 0x9F, 0xFD, 0x5A, 0xFE, 0xA7, 0x19, 0x97, 0x10, 0x0F, 0xFF,
+    0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x96, 0xE7, 0x4D, 0xA7, 0x39, 0xD9, 0x73,
+    0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xDA, 0x74,
+    0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x20, 0x2A, 0xCA,
+    0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3,
+    0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70,
+    0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3,
+    0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE,
+    0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x20, 0x0D, 0x71, 0x9D, 0x90, 0xD9, 0x70, 0xE1,
+    0xD9, 0x79, 0xDA, 0x1D, 0xA7, 0xE2, 0xDA, 0x69, 0xD9, 0x2A, 0xD6, 0xE3, 0xAD, 0x59, 0xD9, 0x3A,
+    0xD5, 0xE4, 0x9D, 0x49, 0xD9, 0x49, 0xD4, 0xE6, 0xD9, 0x29, 0xD9, 0x6D, 0x92, 0xE7, 0xD9, 0x19,
+    0xD7, 0x0D, 0xA1, 0xDA, 0x70, 0xDA, 0x09, 0xD7, 0x1A, 0xCA, 0x0D, 0xA7, 0x1A, 0xD9, 0xD7, 0x29,
+    0xFA, 0x72, 0x9F, 0x74, 0xEA, 0x74, 0xE7, 0x20, 0xAC, 0xA7, 0xDA, 0x69, 0xD9, 0xDA, 0x6A, 0xDA,
+    0x6E, 0x0E, 0x6E, 0xA5, 0x9D, 0x90, 0xAD, 0x5A, 0xF5, 0xAD, 0x1A, 0xD5, 0xDA, 0xD5, 0xDA, 0x1A,
+    0xD4, 0xAD, 0x9D, 0x4A, 0xD2, 0xAD, 0x4D, 0x99, 0xD4, 0xDA, 0x2A, 0xD3, 0x9D, 0x1D, 0x39, 0xD3,
+    0xAD, 0x3D, 0x91, 0xD3, 0xDA, 0x39, 0xD2, 0x9D, 0x2D, 0x29, 0xD9, 0x39, 0xD2, 0xDA, 0x2D, 0x2A,
+    0xD4, 0x9D, 0x19, 0xD3, 0xD2, 0xD9, 0x49, 0xD1, 0xDA, 0x3D, 0x1A, 0xD5, 0x9D, 0x1D, 0x4D, 0x90,
+    0xD9, 0x59, 0xD0, 0xAC, 0xA4, 0xD9, 0x9D, 0x7D, 0x0D, 0x5D, 0x9D, 0xA7, 0xD9, 0xD5, 0xD9, 0xD7,
+    0x0F, 0x95, 0xFA, 0x70, 0xF6, 0xAE, 0x71, 0xE9, 0x6A, 0xDA, 0x71, 0xE7, 0xAD, 0x97, 0x00, 0x49,
+    0xD7, 0x9D, 0x95, 0xD9, 0x6D, 0xA6, 0xDA, 0x5E, 0x79, 0xD4, 0xAD, 0x71, 0xD9, 0x29, 0xD9, 0x71,
+    0xAD, 0x2D, 0xA7, 0x29, 0xD1, 0xDA, 0x74, 0xDA, 0xE7, 0x5A, 0xF7, 0x7E, 0x97, 0x69, 0xE7, 0x7F,
+    0x97, 0x5D, 0xAA, 0xD7, 0x4A, 0xD0, 0x9D, 0x73, 0xAD, 0x2D, 0x97, 0x19, 0xD9, 0x2A, 0xD7, 0x1D,
+    0xA3, 0x9D, 0x70, 0xE5, 0xDA, 0x6A, 0xD6, 0xAD, 0x59, 0xD9, 0x69, 0xD9, 0x4D, 0xA7, 0x0D, 0xA3,
+    0x0D, 0x97, 0xAD, 0x1D, 0xA6, 0x9D, 0xA1, 0xAD, 0x6E, 0x29, 0xD5, 0xAD, 0x93, 0xD9, 0x4D, 0xA4,
+    0xDA, 0x3E, 0x5A, 0xD2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x90, 0xE7, 0x0D, 0xAA, 0xD7, 0x1A, 0xF9,
+    0x71, 0x9F, 0x73, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7,
+    0x39, 0xD9, 0x73, 0xAD, 0x72, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0x94, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x75, 0xAD, 0x97, 0x49, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75,
+    0xE7, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x4A,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x5F, 0xCA, 0x5F, 0xCA, 0x49,
+    0xD9, 0x99, 0x5A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70,
+    0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D,
+    0xA7, 0x0D, 0x97, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xE9, 0x99, 0x5F, 0xCA, 0x5A, 0xAA, 0xAA,
+    0x94, 0xAC, 0x92, 0xAC, 0xA2, 0x9D, 0x29, 0xD3, 0xD3, 0xD9, 0x2D, 0x92, 0xDA, 0x2A, 0xCA, 0x29,
+    0xD2, 0x9D, 0x3D, 0x3D, 0x92, 0xD9, 0x2A, 0xCA, 0x2A, 0xD2, 0x9D, 0x29, 0xD3, 0xD3, 0xD9, 0x2D,
+    0xA0, 0x5A, 0xFA, 0x5F, 0xCA, 0x59, 0x99, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7,
+    0x0D, 0x97, 0x9D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70,
+    0xDA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x59, 0x99,
+    0xAD, 0x5F, 0xCA, 0x5A, 0xAA, 0xAA, 0x94, 0x5D, 0x73, 0x9D, 0xA7, 0x2F, 0x71, 0x9C, 0xAA, 0xCA,
+    0x70, 0xD9, 0x0D, 0x79, 0xD1, 0xAC, 0xA6, 0xAC, 0x92, 0xD6, 0xD3, 0xAC, 0xA4, 0xAC, 0x94, 0xD4,
+    0xD5, 0xAC, 0xA2, 0xAC, 0xA6, 0xD2, 0xD7, 0xAC, 0xA0, 0xAC, 0xA7, 0x0D, 0x77, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xE0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x99, 0x92, 0x9D,
+    0x92, 0xDA, 0x3D, 0x39, 0xD4, 0x90, 0x49, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99,
+    0xFA, 0x2A, 0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19,
+    0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93,
+    0xE2, 0xAC, 0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x20, 0x77, 0x4A, 0xD7,
+    0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x1A, 0xDA, 0x6D, 0x99,
+    0xFD, 0x93, 0x9D, 0x9D, 0x99, 0xAE, 0x3A, 0xEA, 0x3A, 0xD9, 0x2F, 0x49, 0xD9, 0x2E, 0x6D, 0x92,
+    0xDA, 0x6D, 0x91, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xE6, 0xE2, 0xDA, 0x6D, 0xA2, 0xDA,
+    0x5A, 0xD2, 0x9E, 0x49, 0xDA, 0x2A, 0xEA, 0x29, 0xE3, 0xD9, 0xAF, 0xE4, 0xD1, 0xAF, 0xA7, 0x39,
+    0x96, 0x5A, 0xEA, 0x94, 0xAF, 0xE3, 0xF9, 0x99, 0xAA, 0x2A, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x71,
+    0xDA, 0x70, 0x9D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE9,
+    0x3A, 0x39, 0xFF, 0x5F, 0xDA, 0x79, 0x95, 0x77, 0x75, 0x9D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D,
+    0xA7, 0x5D, 0x97, 0x49, 0xD6, 0x9A, 0xDA, 0x1A, 0xD5, 0xAF, 0xD0, 0xAD, 0x4E, 0xA9, 0x99, 0xFA,
+    0x3A, 0xDA, 0x39, 0xE9, 0x3E, 0x5E, 0x3A, 0xD6, 0xE3, 0xE6, 0xDA, 0x3D, 0xA6, 0xDA, 0x29, 0xD9,
+    0x59, 0xD9, 0x2A, 0xD6, 0xAD, 0x3A, 0xD6, 0xE3, 0xAD, 0x5A, 0xDA, 0x39, 0xD4, 0x9E, 0x94, 0xE2,
+    0xAC, 0xAD, 0x94, 0xAF, 0xDA, 0x0D, 0x6A, 0xF9, 0x09, 0xD7, 0x09, 0x73, 0x49, 0xAE, 0xA5, 0xAF,
+    0xE3, 0xEA, 0x90, 0xAD, 0xA1, 0xAD, 0x93, 0xDA, 0x1D, 0xA4, 0xDA, 0x0A, 0xD4, 0x9D, 0x90, 0xDA,
+    0x29, 0xAD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xEA, 0x3A, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0x9D,
+    0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC3, 0x9F, 0xDA, 0x79, 0x95, 0x74, 0x99, 0x74, 0xAF, 0xC7,
+    0x1F, 0xD9, 0x70, 0x9D, 0x97, 0x4A, 0xD7, 0x5D, 0xA7, 0x49, 0xD9, 0x73, 0x9E, 0xAA, 0xA7, 0x9F,
+    0xF7, 0x09, 0x9D, 0xA9, 0x99, 0x72, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xDA, 0x75,
+    0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x74, 0xAD, 0xA7, 0x19, 0xFC, 0x73, 0xEA, 0x73, 0x59,
+    0xAD, 0xA2, 0xAA, 0x5F, 0xE0, 0x9D, 0x4F, 0x99, 0x9F, 0xA3, 0xAD, 0xA3, 0x9E, 0x93, 0xE5, 0xE3,
+    0xAD, 0x6E, 0x3E, 0x6E, 0x3D, 0xA6, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0xAD, 0x3A, 0xD6,
+    0xE3, 0xAD, 0x5A, 0xDA, 0x39, 0xD4, 0xAE, 0x94, 0xE2, 0xAC, 0xAD, 0x94, 0xAF, 0xDA, 0x9D, 0x6A,
+    0xF9, 0x0A, 0xD7, 0x09, 0x3D, 0xA7, 0x5D, 0x97, 0x4A, 0xD7, 0x5D, 0xA4, 0x9C, 0xA9, 0x2A, 0xE5,
+    0x9F, 0xFC, 0x79, 0xAF, 0xC9, 0x70, 0x77, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73,
+    0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x1A, 0xE9, 0x5D, 0x99, 0xFD, 0xA3, 0x9D, 0x9D, 0x99, 0x9E, 0x3A,
+    0xEA, 0x39, 0xD3, 0xF4, 0x9D, 0x3E, 0x59, 0xD3, 0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6,
+    0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9,
+    0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x20, 0x59, 0x5E, 0x4E, 0x4A, 0xA7, 0x74, 0xAA, 0x94, 0xD9,
+    0x39, 0xD9, 0x3A, 0xD4, 0xAD, 0x4D, 0xA4, 0xD9, 0x39, 0xD4, 0xAD, 0x4E, 0x4D, 0xA4, 0xD9, 0x39,
+    0xD4, 0xAD, 0x4D, 0xA4, 0xD9, 0x30, 0x71, 0x97, 0x1E, 0x70, 0xDA, 0x70, 0xAA, 0x77, 0x77, 0x0A,
+    0xA9, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD,
+    0x70, 0xE7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD9, 0x79,
+    0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0xE5, 0xAF, 0xA5, 0xAE, 0x96, 0x77, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D,
+    0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x4A, 0xAA, 0x4D, 0x93, 0xE4, 0x9D, 0x3E,
+    0x5A, 0xD2, 0xE6, 0xE1, 0xAD, 0x7D, 0xA0, 0xAD, 0x70, 0xD9, 0xAD, 0x70, 0x9D, 0xAE, 0x70, 0xAF,
+    0xD9, 0x7E, 0xA0, 0xDA, 0x7D, 0xA1, 0xAD, 0x69, 0xD9, 0x2D, 0xA5, 0x9D, 0x3A, 0xD5, 0xAD, 0x4D,
+    0xA4, 0xDA, 0x4A, 0xD4, 0xD9, 0x49, 0xDA, 0x20, 0x75, 0xAD, 0x5D, 0xA5, 0xDA, 0x49, 0xD9, 0x49,
+    0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5E, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D,
+    0xA5, 0xDA, 0x49, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x40, 0x3A, 0xA2, 0xAD, 0xA4, 0xAD,
+    0xA5, 0xD0, 0x9F, 0xD1, 0x9F, 0xD3, 0x9D, 0x9D, 0x99, 0xAD, 0x99, 0xD9, 0x9A, 0xDA, 0x2A, 0xEA,
+    0x3F, 0xA3, 0xE2, 0xAD, 0xA4, 0xF4, 0xAD, 0x2E, 0x5E, 0x5E, 0x2D, 0xA5, 0xDA, 0x5D, 0xA1, 0x9D,
+    0x94, 0x9D, 0x95, 0xD9, 0x1A, 0xD5, 0xAD, 0x59, 0xD2, 0xE5, 0xAD, 0x5A, 0xD2, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x2D, 0x95, 0xD9, 0x5D, 0xA1, 0x9D, 0x59, 0xD5, 0x9D, 0x91, 0xAD, 0x5A, 0xD5, 0xAD, 0x2D,
+    0xA5, 0xE5, 0xAD, 0x2D, 0x95, 0xDA, 0x5D, 0xA1, 0x77, 0x3A, 0xA2, 0xAE, 0xA5, 0xD0, 0x9F, 0xDA,
+    0x39, 0xD9, 0xDA, 0x99, 0xE3, 0xAF, 0x3A, 0xD9, 0x2F, 0x49, 0xD9, 0x2E, 0x5A, 0xD2, 0x9D, 0xA5,
+    0xE2, 0x9D, 0x95, 0xE2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xE2,
+    0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD2, 0x49, 0xAD, 0xA9, 0x7A,
+    0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA,
+    0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6,
+    0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x4A, 0xA2,
+    0xAD, 0xA7, 0xD0, 0x9F, 0xD9, 0x49, 0xD9, 0xD9, 0x9A, 0xE4, 0xAE, 0xA3, 0xAD, 0x93, 0xAE, 0x49,
+    0xD9, 0x3E, 0x6D, 0x93, 0xDA, 0x6D, 0x92, 0x9D, 0x95, 0x9D, 0x92, 0xAD, 0x6A, 0xD3, 0xE6, 0xE3,
+    0xDA, 0x6D, 0xA3, 0xDA, 0x5A, 0xD3, 0x9E, 0x49, 0xDA, 0x3A, 0xEA, 0x29, 0xE4, 0xDA, 0xAF, 0xE5,
+    0xD9, 0x0A, 0xFA, 0x59, 0xD9, 0x29, 0x97, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D,
+    0x75, 0xAD, 0x75, 0x49, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A, 0xDA,
+    0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59, 0xD9,
+    0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0xAE, 0x93, 0xE2, 0xAC, 0xAD,
+    0x93, 0xAF, 0xDA, 0x9D, 0x5A, 0xF9, 0x0A, 0xD7, 0x93, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD,
+    0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x94, 0x3A, 0xA2, 0xAD, 0x93, 0xD0, 0x9F, 0x39, 0xD9, 0xDA, 0x9A,
+    0x3A, 0xEA, 0x7A, 0xE7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x71,
+    0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0x39, 0xAE, 0xA9, 0x4A, 0xFF, 0x2A,
+    0xDA, 0x90, 0x9A, 0xC9, 0x2E, 0x71, 0xDA, 0x71, 0xE7, 0x19, 0xE9, 0x70, 0xAE, 0xA7, 0x09, 0xF7,
+    0x1A, 0xE7, 0x19, 0xD9, 0x71, 0xDA, 0x71, 0xD9, 0x1A, 0x94, 0xE2, 0xFF, 0xCA, 0x29, 0xFE, 0x96,
+    0x99, 0x70, 0x75, 0x9C, 0x96, 0xD6, 0xAD, 0x49, 0xAE, 0xAA, 0xA9, 0xAF, 0xF9, 0x09, 0xAD, 0x99,
+    0x99, 0x2A, 0xD6, 0xE6, 0xDA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xE6, 0xDA, 0x6D, 0x95, 0x9D, 0x95,
+    0x9D, 0x96, 0xFD, 0x39, 0xFC, 0x69, 0x40, 0x2A, 0xA9, 0x59, 0xAA, 0x29, 0xD9, 0x5A, 0xD2, 0x9D,
+    0x6D, 0xA2, 0xAD, 0x6D, 0x92, 0xDA, 0x59, 0xD3, 0xD9, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6,
+    0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95, 0xE2, 0x9D, 0x94, 0xAD, 0xA2, 0x9D, 0x49,
+    0xE9, 0x29, 0xDA, 0x2A, 0xCA, 0xD9, 0x3F, 0xEA, 0x0D, 0x5F, 0xC9, 0x09, 0xD7, 0x97, 0x20, 0x9A,
+    0xA7, 0xAA, 0xA0, 0x9D, 0x69, 0xD9, 0x09, 0xD6, 0xE2, 0xD9, 0x49, 0xD9, 0x2D, 0x94, 0xE3, 0xD9,
+    0x39, 0xD9, 0x3D, 0xA3, 0xDA, 0x4D, 0xA2, 0xAD, 0x5A, 0xD2, 0xDA, 0x5A, 0xD1, 0xAD, 0x69, 0xD1,
+    0xDA, 0x69, 0xD0, 0xAD, 0x70, 0xD0, 0xD9, 0x70, 0xDA, 0xD7, 0x1F, 0x97, 0x1F, 0x70, 0x0A, 0xA5,
+    0x9A, 0xA5, 0x9A, 0xA0, 0x9D, 0x5E, 0x94, 0xDA, 0x09, 0xD4, 0xAE, 0x93, 0x9D, 0x2D, 0x93, 0xDA,
+    0xC9, 0x3E, 0x2D, 0x92, 0xAC, 0xAA, 0xC9, 0x29, 0xD9, 0x2D, 0x92, 0xD0, 0xAC, 0x92, 0xE3, 0xD9,
+    0x19, 0xD0, 0xAC, 0xA2, 0xD9, 0x3D, 0x91, 0xD9, 0x0A, 0xCA, 0x1A, 0xD4, 0xD9, 0x09, 0xD1, 0xAC,
+    0xA1, 0xD9, 0x4D, 0x90, 0xD9, 0x19, 0xCA, 0x0A, 0xD5, 0xD9, 0x9D, 0x29, 0xCA, 0x0D, 0xA5, 0xD9,
+    0xAC, 0x92, 0x9C, 0xA9, 0xD6, 0xD9, 0xD3, 0x9C, 0xAA, 0xCA, 0x6F, 0xA3, 0x9F, 0x7F, 0x5E, 0xA7,
+    0xAD, 0xA5, 0xE7, 0x39, 0xAA, 0x6A, 0xA9, 0x4D, 0x94, 0xE5, 0xAD, 0x3E, 0x69, 0xD2, 0xAD, 0x70,
+    0xDA, 0x09, 0xD9, 0x70, 0x9D, 0x9D, 0xA7, 0x2F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x3A, 0xF7, 0x29,
+    0xD9, 0xD9, 0x70, 0x9D, 0x90, 0xAD, 0x70, 0xDA, 0x2D, 0x96, 0xE3, 0xAD, 0x5E, 0x49, 0xD9, 0x3A,
+    0xD9, 0x5D, 0xA2, 0x39, 0xAA, 0x7A, 0xAA, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0x95, 0xE6, 0xD9, 0x49,
+    0xD9, 0x6D, 0xA4, 0xE7, 0xDA, 0x39, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD2,
+    0xDA, 0x72, 0xD1, 0xAD, 0x73, 0xD1, 0xDA, 0x73, 0xD9, 0xAD, 0x74, 0xD9, 0xD9, 0x74, 0xAF, 0x75,
+    0x9E, 0x97, 0x59, 0xE7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0xA7, 0x59, 0xE7, 0x3A,
+    0xFC, 0x74, 0xAE, 0xA7, 0x50, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xCA, 0x39, 0x99, 0x99,
+    0x9E, 0x97, 0x09, 0xDA, 0x71, 0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x09, 0xD9, 0x71, 0xDA,
+    0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1F, 0xFD, 0x29, 0xFF, 0xD2, 0x79, 0xAC, 0x96,
+    0xF9, 0x5A, 0xDA, 0x96, 0xDA, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xDA, 0x70, 0xD9, 0x79,
+    0xD7, 0x0D, 0xA5, 0x9A, 0xE5, 0x9E, 0xA6, 0x9E, 0xA7, 0x09, 0xD9, 0x70, 0xAC, 0xA7, 0x0D, 0xA7,
+    0x0D, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0xA9, 0x7E, 0xA7,
+    0x09, 0xA9, 0x40, 0x29, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9,
+    0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA,
+    0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x20,
+    0x5C, 0xA9, 0x70, 0x9E, 0xA7, 0x09, 0xE7, 0x2D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAD, 0x71, 0xDA,
+    0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x72, 0xE7, 0x2A, 0xE7, 0xAE, 0xA6, 0xAD, 0xA9, 0x69, 0xD7, 0x1A,
+    0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x6A, 0xAE, 0x7F,
+    0x70, 0xAA, 0x97, 0x00, 0x76, 0xAF, 0xA5, 0xAF, 0xFC, 0xA9, 0xAE, 0xA2, 0x9A, 0xFD, 0x97, 0x9A,
+    0xA9, 0x10, 0x4A, 0xCA, 0x49, 0xE4, 0x9E, 0x5D, 0x97, 0x76, 0x9A, 0x6A, 0xC6, 0xD6, 0xD5, 0x9C,
+    0xA5, 0xAC, 0x95, 0xD9, 0x49, 0xD5, 0xAD, 0x5E, 0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x94, 0xE5, 0xE5,
+    0x99, 0x94, 0x77, 0x39, 0xC9, 0x71, 0xAC, 0x97, 0x0A, 0xDA, 0xA9, 0x4A, 0xFE, 0x3F, 0x99, 0x9A,
+    0xA2, 0xE9, 0x79, 0xDA, 0x70, 0xE7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1A, 0xD7, 0x19, 0xE4, 0x93, 0xAF, 0xAE, 0x4A, 0xFD, 0xA6, 0xD9, 0x97, 0x0C, 0xA7, 0x19,
+    0xC9, 0x72, 0x97, 0x77, 0x73, 0xAF, 0xC9, 0x70, 0x9F, 0xFA, 0x7E, 0x92, 0xAC, 0x7A, 0xD7, 0x6D,
+    0xA7, 0x59, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0xDA, 0x76, 0xDA, 0x73, 0xFF, 0xD9, 0x59, 0xFF,
+    0xD7, 0x1E, 0x76, 0xDA, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0xDA, 0x75, 0xAD, 0x74, 0x9A, 0xD9, 0x99,
+    0x99, 0x99, 0x99, 0x93, 0xFF, 0xFC, 0xA3, 0xFF, 0xFC, 0x92, 0x09, 0x70, 0x90, 0x9C, 0xA1, 0xAA,
+    0xA9, 0x0A, 0xC9, 0x0F, 0xFE, 0x2E, 0x99, 0x9E, 0x91, 0x9D, 0x4A, 0xC9, 0x1A, 0xC9, 0x5D, 0x1D,
+    0x6D, 0x1A, 0xC9, 0x5D, 0x19, 0xCA, 0x49, 0xCA, 0x2D, 0xA2, 0x9D, 0x2A, 0xFF, 0xCA, 0x09, 0xD9,
+    0xAE, 0xA9, 0xDA, 0x0A, 0x70, 0xA0, 0x19, 0xD7, 0x0D, 0xA1, 0x9D, 0x7A, 0xD3, 0xD9, 0x59, 0xD9,
+    0x3D, 0xA5, 0xDA, 0x4A, 0xD4, 0xAD, 0x6D, 0x39, 0xD9, 0x6D, 0x92, 0xDA, 0x7A, 0xCA, 0x1A, 0xD7,
+    0x09, 0xD0, 0x9D, 0x72, 0xD0, 0xDA, 0x72, 0xFC, 0x70, 0xFF, 0xDA, 0x49, 0xFF, 0xD9, 0x70, 0x9D,
+    0x75, 0xAD, 0x71, 0xAA, 0xAA, 0xEA, 0xAA, 0xA5, 0xFF, 0xDA, 0x59, 0x99, 0x9D, 0x99, 0x99, 0x71,
+    0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x71, 0x29, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9,
+    0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x77, 0x49, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA,
+    0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x20, 0x70, 0x99, 0x71, 0xAF, 0xDA, 0x5F,
+    0xAA, 0xE4, 0xAD, 0x59, 0x4D, 0xA7, 0x3E, 0x73, 0x9E, 0x97, 0x2A, 0xF9, 0x7A, 0xFD, 0xA5, 0xAD,
+    0x2E, 0x93, 0x9D, 0x4E, 0x3A, 0xD4, 0x9D, 0x3A, 0xD4, 0xAC, 0xA3, 0x9D, 0xA3, 0xD9, 0x4A, 0xE9,
+    0x9D, 0x96, 0x9F, 0xC9, 0x71, 0xAE, 0x97, 0x3E, 0x74, 0xD7, 0x39, 0xD4, 0xA4, 0x9E, 0x4F, 0xFC,
+    0x5A, 0xFD, 0xA7, 0x74, 0x70, 0x9D, 0x2D, 0x9A, 0xD1, 0x9D, 0x90, 0xA9, 0x2A, 0x90, 0x77, 0x74,
+    0xAF, 0xDA, 0x73, 0xAE, 0xA9, 0x9A, 0xAD, 0xA7, 0x0D, 0xA7, 0xAD, 0x95, 0xD9, 0x72, 0xD9, 0x3D,
+    0x4A, 0xEA, 0x92, 0xD2, 0x9C, 0x92, 0x9F, 0xE2, 0x9C, 0xA1, 0xD3, 0xDA, 0x29, 0x93, 0xAC, 0x1C,
+    0xA2, 0xAD, 0x71, 0x9C, 0x99, 0xC9, 0x2D, 0x97, 0x2C, 0xAA, 0xC3, 0xD7, 0x3D, 0xAC, 0x3D, 0x73,
+    0xDA, 0xC3, 0xD7, 0x3D, 0x9C, 0x92, 0xD9, 0x72, 0xCA, 0x0C, 0xA2, 0xAC, 0xA7, 0x19, 0xC9, 0x0D,
+    0x29, 0xD9, 0x70, 0xAC, 0x1A, 0xC9, 0x2A, 0xFE, 0x3D, 0x2D, 0x39, 0xFC, 0x92, 0xD3, 0x9D, 0x73,
+    0xD9, 0x49, 0xD9, 0x79, 0xDA, 0x7E, 0xA9, 0x99, 0x9A, 0xE9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97,
+    0x10, 0x74, 0xAD, 0xA0, 0xC2, 0xDA, 0xAE, 0x1A, 0xC9, 0x19, 0xCA, 0x1C, 0xA2, 0x9C, 0xA0, 0x9C,
+    0x92, 0x9C, 0x90, 0xAC, 0x3A, 0xC1, 0xAC, 0x3D, 0x1A, 0xC9, 0x1D, 0xA2, 0xDA, 0xCA, 0xC9, 0x29,
+    0xD9, 0x0A, 0x20, 0x49, 0x49, 0x49, 0xD2, 0xAC, 0x92, 0x9D, 0x2A, 0xD2, 0xAD, 0x91, 0xAD, 0x2A,
+    0xD9, 0x19, 0xD9, 0x1A, 0xD9, 0x19, 0xDA, 0x2A, 0xD2, 0xE4, 0xD9, 0x1A, 0xD4, 0xAD, 0x2D, 0x94,
+    0xD9, 0x1A, 0xD4, 0x9D, 0x2D, 0x94, 0xD2, 0x9C, 0xA7, 0x60, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xC7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7,
+    0x39, 0x00, 0x0F, 0xE1, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x00, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAE,
+    0xA9, 0x9A, 0xAD, 0xA7, 0x0D, 0xA7, 0xAD, 0x95, 0xD9, 0x72, 0xD9, 0x3D, 0x2A, 0xFA, 0x93, 0xD2,
+    0x9C, 0x92, 0xFE, 0xA2, 0x9C, 0xA1, 0xD3, 0xD9, 0x1A, 0xD3, 0xAC, 0x1C, 0xA3, 0xD9, 0x2D, 0x92,
+    0x9C, 0x99, 0xC9, 0x3D, 0x92, 0xD9, 0x3C, 0xAA, 0xC4, 0xD9, 0x19, 0xD4, 0xDA, 0xC4, 0xFE, 0x94,
+    0xDA, 0xC4, 0xFD, 0x95, 0xD9, 0xC9, 0x3D, 0x90, 0x9D, 0x5C, 0xA0, 0xCA, 0x3D, 0x91, 0xDA, 0x39,
+    0xC9, 0x0D, 0x3D, 0x91, 0x9D, 0x3A, 0xC1, 0xAC, 0x92, 0xD9, 0x2D, 0xA2, 0xD2, 0xD2, 0xD9, 0x3D,
+    0x90, 0xD3, 0x9D, 0x73, 0xD9, 0x49, 0xD9, 0x79, 0xDA, 0x7E, 0xA9, 0x99, 0x9A, 0xE9, 0x71, 0x9A,
+    0xFE, 0x97, 0x79, 0x97, 0x10, 0x75, 0xAF, 0xFE, 0x0F, 0xFE, 0x90, 0x73, 0x9F, 0xA2, 0x9D, 0xAA,
+    0xE1, 0xD3, 0xAC, 0xA9, 0xCA, 0x4D, 0x9C, 0xA4, 0xD9, 0xCA, 0x4C, 0xA0, 0xD9, 0x2D, 0x91, 0xFD,
+    0xA3, 0xAD, 0xA9, 0x10, 0x59, 0x97, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x59, 0x99, 0x99,
+    0xAD, 0x99, 0x99, 0x99, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xDA, 0xAA, 0xAA, 0xA5, 0xD7, 0x3D, 0x73,
+    0xD7, 0x3D, 0x73, 0xD7, 0x3A, 0xA7, 0x73, 0xFF, 0xFF, 0xFF, 0xF0, 0x3A, 0xDA, 0x92, 0x9F, 0xD3,
+    0xA2, 0xAC, 0xA6, 0x9C, 0xA6, 0xAC, 0x95, 0x9D, 0x6D, 0x59, 0xD9, 0x49, 0xD5, 0xAD, 0x5A, 0xCA,
+    0x5A, 0xFE, 0x90, 0xAF, 0xE1, 0x29, 0xAD, 0xA3, 0xAF, 0xD3, 0x92, 0xAC, 0x96, 0x9C, 0xA6, 0xD3,
+    0x99, 0xAD, 0x93, 0xF7, 0x9D, 0x79, 0xCA, 0x69, 0xCA, 0x09, 0x4D, 0x90, 0xAD, 0xAA, 0xE1, 0x9A,
+    0xFA, 0x74, 0x39, 0x93, 0xE2, 0xAD, 0x29, 0xD2, 0x9D, 0x49, 0x40, 0x4A, 0xA9, 0x6A, 0xA5, 0xD9,
+    0x5A, 0xD4, 0x9D, 0x95, 0xE4, 0xAD, 0x6D, 0xA4, 0xAD, 0x6D, 0x94, 0xDA, 0x59, 0xD5, 0xD9, 0x5A,
+    0xD4, 0x9D, 0x6D, 0xA4, 0xAD, 0x6D, 0x94, 0xE5, 0x9D, 0x94, 0xDA, 0x5E, 0x5D, 0x94, 0xAE, 0x49,
+    0xD9, 0x39, 0xEA, 0x4A, 0xE2, 0xAC, 0xAD, 0x94, 0xFF, 0xA0, 0xD5, 0xD9, 0xFA, 0x1D, 0x49, 0xD1,
+    0x97, 0x39, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x60, 0x77, 0x29,
+    0xFF, 0xE2, 0xAF, 0xFF, 0x19, 0xFF, 0xA1, 0xAC, 0x1A, 0xFF, 0xA1, 0xAC, 0x1F, 0xFC, 0xA1, 0xAC,
+    0x1F, 0xFC, 0xA1, 0xAC, 0x1F, 0xFC, 0xA1, 0xAC, 0x1F, 0xFC, 0xA1, 0xAC, 0x1F, 0xFC, 0xA1, 0xAC,
+    0x1F, 0xFC, 0xA1, 0xAC, 0x1F, 0xFC, 0xA1, 0xAC, 0x19, 0xFF, 0xA1, 0xAC, 0x2F, 0xFA, 0x1A, 0xC3,
+    0xAF, 0xDA, 0x1A, 0xC6, 0x99, 0x9C, 0xA1, 0xAC, 0x71, 0xCA, 0x1A, 0xC7, 0x1C, 0xA1, 0xAC, 0x71,
+    0xCA, 0x1A, 0xC7, 0x1C, 0xA1, 0xAC, 0x71, 0xCA, 0x1A, 0xC7, 0x1C, 0xA1, 0xAC, 0x71, 0xCA, 0x1A,
+    0xC7, 0x1C, 0xA1, 0xAC, 0x71, 0xCA, 0x1A, 0xC7, 0x1C, 0xA1, 0xAC, 0x71, 0xA9, 0x19, 0xA0, 0x09,
+    0xA1, 0x9E, 0x0A, 0xE0, 0xAD, 0xA1, 0x99, 0x10, 0x2D, 0x39, 0xC9, 0x3A, 0xDA, 0x4D, 0x4D, 0x09,
+    0xAA, 0xDA, 0x09, 0xE9, 0x10, 0x3A, 0xA2, 0x9E, 0x1A, 0xF0, 0x9C, 0xA9, 0xCA, 0x3A, 0xC9, 0x3D,
+    0x4D, 0x39, 0xD3, 0xAC, 0xA3, 0xAC, 0x93, 0xD4, 0xD3, 0x9C, 0xA2, 0x73, 0xAE, 0x92, 0xDA, 0xAD,
+    0x90, 0xAC, 0x92, 0xCA, 0x0C, 0xA3, 0xD9, 0xC9, 0x3D, 0x9C, 0x93, 0xCA, 0x9C, 0x92, 0x9C, 0x99,
+    0xCA, 0x2D, 0x1E, 0xAD, 0x39, 0xDA, 0x20, 0x2A, 0x39, 0x94, 0xAC, 0xA2, 0xD4, 0x9D, 0x2A, 0xCA,
+    0x4D, 0xA1, 0x9D, 0x49, 0xD2, 0xDA, 0x4D, 0xA1, 0x9D, 0x4E, 0x2D, 0xA2, 0xE2, 0xE9, 0x1A, 0xD2,
+    0xAD, 0x29, 0xD2, 0xAD, 0x3D, 0x91, 0xAD, 0x39, 0xC9, 0x2D, 0x77, 0x10, 0x49, 0xA7, 0x9D, 0x39,
+    0xE7, 0xD9, 0x2A, 0xF6, 0xDA, 0x29, 0xCA, 0x9C, 0xA5, 0xAD, 0x6A, 0xC9, 0x49, 0xD7, 0xD9, 0x4D,
+    0x97, 0xD4, 0xAC, 0xA7, 0x0D, 0x39, 0xD7, 0x09, 0xCA, 0x3D, 0x3A, 0xA3, 0xAC, 0x92, 0xD9, 0x2E,
+    0x3D, 0x2A, 0xCA, 0x2A, 0xE3, 0xD1, 0x9D, 0x29, 0xCA, 0xCA, 0x3C, 0xA1, 0xD2, 0x9C, 0xAA, 0xC9,
+    0x6D, 0x92, 0xD0, 0xD6, 0xAC, 0xA2, 0xD1, 0xD5, 0x9D, 0x2D, 0x2C, 0xA5, 0xD2, 0xAD, 0xAA, 0xEA,
+    0x3D, 0x92, 0xFF, 0xC2, 0xAC, 0xA7, 0x0D, 0x39, 0xD7, 0x1D, 0x3D, 0x72, 0xCA, 0x20, 0x49, 0xA7,
+    0x0D, 0x59, 0xE7, 0xD9, 0x4A, 0xF6, 0xAC, 0xA4, 0x9C, 0xA9, 0xCA, 0x59, 0xD7, 0x0A, 0xC9, 0x5D,
+    0x71, 0xD9, 0x4D, 0x97, 0x1D, 0x4A, 0xCA, 0x72, 0xD3, 0x9D, 0x72, 0x9C, 0xA3, 0xD1, 0x9A, 0xDA,
+    0x4A, 0xC9, 0x2D, 0x90, 0xFE, 0x3D, 0x2A, 0xCA, 0x19, 0x92, 0xD3, 0xD1, 0x9D, 0x7D, 0x3C, 0xA1,
+    0xD7, 0x0D, 0x6D, 0x97, 0xAC, 0xA5, 0xAC, 0xA7, 0xAD, 0x59, 0xD7, 0xAD, 0x6D, 0x7A, 0xCA, 0x6D,
+    0x96, 0xDA, 0x6A, 0xCA, 0x6D, 0x96, 0x9D, 0x6F, 0xF2, 0xD7, 0xFF, 0x10, 0x29, 0xAE, 0x97, 0x09,
+    0xCA, 0x29, 0xFD, 0x97, 0xD4, 0xA2, 0x9C, 0xA6, 0xD9, 0x71, 0xCA, 0x5A, 0xCA, 0x71, 0xAC, 0x94,
+    0x9D, 0x69, 0x99, 0xDA, 0x5D, 0x7A, 0xE9, 0x5D, 0x97, 0x19, 0xD9, 0x3A, 0xCA, 0x74, 0xD2, 0x9D,
+    0x3A, 0xA7, 0xD2, 0xD3, 0xE6, 0xAC, 0xA1, 0xD9, 0x2E, 0xA0, 0x9D, 0xAA, 0xE1, 0xAC, 0xA2, 0xAC,
+    0xAC, 0x91, 0xAF, 0xA1, 0x9D, 0x2A, 0xC9, 0xD7, 0x2D, 0x91, 0x9C, 0xA0, 0xD7, 0x1D, 0xA2, 0xCA,
+    0x1C, 0xA7, 0x0A, 0xCA, 0x2D, 0x19, 0xCA, 0x79, 0xD2, 0xEA, 0xAE, 0xA6, 0xD9, 0x2F, 0xFC, 0x5D,
+    0xA7, 0x0D, 0x6A, 0xD7, 0x09, 0xCA, 0x59, 0xD7, 0x19, 0xC9, 0x20, 0x79, 0xD7, 0x0E, 0x96, 0x9E,
+    0x70, 0xDA, 0x77, 0x77, 0x0A, 0xA7, 0x09, 0xCA, 0x70, 0xD9, 0x7E, 0x69, 0xE6, 0x9E, 0x6A, 0xDA,
+    0x69, 0xDA, 0x7D, 0xA7, 0x9D, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0x9D, 0xA4, 0xA2, 0xFA, 0xAE, 0xA1,
+    0x9F, 0xF9, 0x39, 0xAA, 0xA9, 0x30, 0x72, 0x99, 0x75, 0x9D, 0x97, 0x5E, 0x76, 0xD9, 0x75, 0x9D,
+    0x77, 0x97, 0x77, 0x59, 0xD9, 0x74, 0xEA, 0x73, 0xAE, 0xA7, 0x3D, 0xAD, 0x72, 0xAD, 0x9D, 0x72,
+    0xD9, 0x9D, 0x71, 0xE1, 0xD7, 0x09, 0xD9, 0x1D, 0x97, 0xE2, 0xD9, 0x69, 0xD9, 0x2D, 0xA6, 0xDA,
+    0x3D, 0xA5, 0x9D, 0x4A, 0xD5, 0xFF, 0xE4, 0xAF, 0xFE, 0x4E, 0xAA, 0xAA, 0xAA, 0xAD, 0x3A, 0xD6,
+    0x9D, 0x92, 0xDA, 0x7D, 0x91, 0xE7, 0x0D, 0xA0, 0x9D, 0xA7, 0x0D, 0xA0, 0xE7, 0x1E, 0x9D, 0x97,
+    0x1A, 0xD0, 0x76, 0x99, 0x97, 0x69, 0xDA, 0x76, 0xDA, 0x76, 0xDA, 0x76, 0xAC, 0x97, 0x79, 0x77,
+    0x77, 0x39, 0xD9, 0x76, 0xEA, 0x75, 0xAE, 0xA7, 0x5D, 0xAD, 0x74, 0xAD, 0x9D, 0x74, 0xD9, 0x9D,
+    0x73, 0xE1, 0xD7, 0x29, 0xD9, 0x1D, 0x97, 0x1E, 0x2D, 0x97, 0x09, 0xD9, 0x2D, 0xA7, 0x0D, 0xA3,
+    0xDA, 0x79, 0xD4, 0xAD, 0x7F, 0xFE, 0x6A, 0xFF, 0xE6, 0xEA, 0xAA, 0xAA, 0xAA, 0xD5, 0xAD, 0x69,
+    0xD9, 0x4D, 0xA7, 0xD9, 0x3E, 0x70, 0xDA, 0x29, 0xDA, 0x70, 0xDA, 0x2E, 0x71, 0xE1, 0x9D, 0x97,
+    0x1A, 0xD1, 0x74, 0x99, 0x76, 0xEA, 0x74, 0xFC, 0x73, 0xDA, 0x0A, 0xCA, 0x71, 0xD9, 0x2A, 0xC9,
+    0x70, 0x95, 0x97, 0x77, 0x59, 0xD9, 0x75, 0xEA, 0x74, 0xAE, 0xA7, 0x4D, 0xAD, 0x73, 0xAD, 0x9D,
+    0x73, 0xD9, 0x9D, 0x72, 0xE1, 0xD7, 0x19, 0xD9, 0x1D, 0x97, 0x0E, 0x2D, 0x97, 0x9D, 0x92, 0xDA,
+    0x7D, 0xA3, 0xDA, 0x69, 0xD4, 0xAD, 0x6F, 0xFE, 0x5A, 0xFF, 0xE5, 0xEA, 0xAA, 0xAA, 0xAA, 0xD4,
+    0xAD, 0x69, 0xD9, 0x3D, 0xA7, 0xD9, 0x2E, 0x70, 0xDA, 0x19, 0xDA, 0x70, 0xDA, 0x1E, 0x71, 0xE0,
+    0x9D, 0x97, 0x1A, 0xD0, 0x72, 0x99, 0x39, 0x97, 0x19, 0xF9, 0x1D, 0x71, 0xDA, 0xFD, 0x97, 0x09,
+    0xC9, 0x19, 0xEA, 0x72, 0x94, 0x97, 0x77, 0x72, 0x9D, 0x97, 0x7E, 0xA7, 0x6A, 0xEA, 0x76, 0xDA,
+    0xD7, 0x5A, 0xD9, 0xD7, 0x5D, 0x99, 0xD7, 0x4E, 0x1D, 0x73, 0x9D, 0x91, 0xD9, 0x72, 0xE2, 0xD9,
+    0x71, 0x9D, 0x92, 0xDA, 0x71, 0xDA, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70, 0xFF, 0xE7, 0xAF, 0xFE,
+    0x7E, 0xAA, 0xAA, 0xAA, 0xAD, 0x6A, 0xD6, 0x9D, 0x95, 0xDA, 0x7D, 0x94, 0xE7, 0x0D, 0xA3, 0x9D,
+    0xA7, 0x0D, 0xA3, 0xE7, 0x1E, 0x29, 0xD9, 0x71, 0xAD, 0x20, 0x72, 0x93, 0x97, 0x2D, 0x91, 0xDA,
+    0x71, 0xD9, 0x1D, 0xA7, 0x19, 0x92, 0x9A, 0x77, 0x77, 0x77, 0x9D, 0x97, 0x5E, 0xA7, 0x4A, 0xEA,
+    0x74, 0xDA, 0xD7, 0x3A, 0xD9, 0xD7, 0x3D, 0x99, 0xD7, 0x2E, 0x1D, 0x71, 0x9D, 0x91, 0xD9, 0x70,
+    0xE2, 0xD9, 0x79, 0xD9, 0x2D, 0xA7, 0xDA, 0x3D, 0xA6, 0x9D, 0x4A, 0xD6, 0xFF, 0xE5, 0xAF, 0xFE,
+    0x5E, 0xAA, 0xAA, 0xAA, 0xAD, 0x4A, 0xD6, 0x9D, 0x93, 0xDA, 0x7D, 0x92, 0xE7, 0x0D, 0xA1, 0x9D,
+    0xA7, 0x0D, 0xA1, 0xE7, 0x1E, 0x09, 0xD9, 0x71, 0xAD, 0x00, 0x73, 0xAC, 0xA7, 0x4D, 0xAD, 0x72,
+    0x9C, 0x2C, 0xA7, 0x1A, 0xC2, 0xCA, 0x71, 0x9C, 0xA0, 0x9C, 0x97, 0x2A, 0xEA, 0x75, 0x97, 0x77,
+    0x69, 0xD9, 0x74, 0xEA, 0x73, 0xAE, 0xA7, 0x3D, 0xAD, 0x72, 0xAD, 0x9D, 0x72, 0xD9, 0x9D, 0x71,
+    0xE1, 0xD7, 0x09, 0xD9, 0x1D, 0x97, 0xE2, 0xD9, 0x69, 0xD9, 0x2D, 0xA6, 0xDA, 0x3D, 0xA5, 0x9D,
+    0x4A, 0xD5, 0xFF, 0xE4, 0xAF, 0xFE, 0x4E, 0xAA, 0xAA, 0xAA, 0xAD, 0x3A, 0xD6, 0x9D, 0x92, 0xDA,
+    0x7D, 0x91, 0xE7, 0x0D, 0xA0, 0x9D, 0xA7, 0x0D, 0xA0, 0xE7, 0x1E, 0x9D, 0x97, 0x1A, 0xD0, 0x74,
+    0xAF, 0xFF, 0xC7, 0x5F, 0xFF, 0xD7, 0x4E, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x73, 0x9D, 0x90, 0xDA,
+    0x77, 0x3D, 0xA0, 0x9D, 0x97, 0x72, 0xE1, 0xAD, 0x77, 0x29, 0xD9, 0x1A, 0xD7, 0x72, 0xE2, 0xDA,
+    0x77, 0x1A, 0xD3, 0xD9, 0x77, 0x09, 0xDA, 0x29, 0xFF, 0xCA, 0x71, 0xE3, 0xAF, 0xFC, 0xA7, 0x0A,
+    0xD9, 0x3E, 0x99, 0x99, 0x99, 0x97, 0x09, 0xFF, 0xDA, 0x77, 0xFF, 0xE9, 0x76, 0xAD, 0xAA, 0xAA,
+    0xAA, 0xE7, 0x7D, 0xA5, 0xAD, 0x76, 0xE6, 0xE7, 0x59, 0xD9, 0x6D, 0xA7, 0x5E, 0x69, 0xDA, 0x99,
+    0x99, 0x99, 0x95, 0xAD, 0x79, 0xFF, 0xD4, 0x9D, 0xA7, 0xAF, 0xFD, 0x40, 0x77, 0x79, 0xFD, 0xA9,
+    0x59, 0xFF, 0xD4, 0xAE, 0xA9, 0x19, 0x9C, 0xA3, 0xAE, 0x73, 0x9E, 0x74, 0xE7, 0x49, 0xDA, 0x74,
+    0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x75,
+    0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xEA, 0x39, 0xA9, 0x5A, 0xFF, 0xCA, 0x69, 0xFF, 0x97, 0x1D, 0x97,
+    0x49, 0xC9, 0x75, 0xAD, 0xA7, 0x6D, 0x76, 0xD7, 0x29, 0xAA, 0xDA, 0x72, 0x9E, 0x97, 0x00, 0x69,
+    0x99, 0x74, 0xAD, 0x75, 0xDA, 0x75, 0xD7, 0x59, 0xCA, 0x75, 0x99, 0x77, 0x79, 0xFF, 0xD4, 0xAF,
+    0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA,
+    0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D,
+    0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F,
+    0xFD, 0x4A, 0xFF, 0xD4, 0x73, 0x99, 0x97, 0x3A, 0xD9, 0x72, 0x9D, 0x97, 0x3D, 0x97, 0x3D, 0x97,
+    0x49, 0x77, 0x71, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xD9, 0x73, 0x9D,
+    0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4E,
+    0x99, 0x99, 0x99, 0x95, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73,
+    0x9D, 0xA9, 0x99, 0x99, 0x99, 0x49, 0xFF, 0xD4, 0xAF, 0xFD, 0x40, 0x71, 0x99, 0x74, 0xE9, 0x72,
+    0xFC, 0x71, 0xDA, 0x0D, 0xA7, 0xD9, 0x2D, 0x79, 0x59, 0x77, 0x59, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E,
+    0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9,
+    0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39,
+    0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A,
+    0xFF, 0xD4, 0x74, 0x97, 0x0D, 0x2D, 0x96, 0x9D, 0x2D, 0x97, 0xA9, 0x29, 0x97, 0x77, 0x75, 0x9F,
+    0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xD9, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4A,
+    0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4E, 0x99, 0x99, 0x99, 0x95,
+    0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0xA9, 0x99, 0x99,
+    0x99, 0x49, 0xFF, 0xD4, 0xAF, 0xFD, 0x40, 0x59, 0x97, 0x2E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A,
+    0xC9, 0x72, 0x97, 0x74, 0xFE, 0x49, 0xFD, 0xA6, 0x9D, 0x97, 0x0A, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1E, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71,
+    0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1A, 0xD7, 0xAF, 0xCA, 0x49, 0xFE, 0x40, 0x72,
+    0x99, 0x72, 0xE7, 0x1A, 0xD7, 0x19, 0xD7, 0x2D, 0x73, 0x97, 0x77, 0xFE, 0x59, 0xFD, 0xA7, 0x9D,
+    0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0xDA,
+    0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A,
+    0xD7, 0x0A, 0xFC, 0xA5, 0x9F, 0xE5, 0x79, 0x99, 0x71, 0x9E, 0x70, 0x9F, 0xA6, 0x9D, 0x90, 0xD5,
+    0x9D, 0x29, 0xD4, 0x99, 0x59, 0x77, 0x3F, 0xE5, 0x9F, 0xDA, 0x79, 0xD9, 0x71, 0xAD, 0x72, 0xAD,
+    0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7,
+    0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x70, 0xAF, 0xCA, 0x59,
+    0xFE, 0x50, 0x77, 0x29, 0xD2, 0xD5, 0xAD, 0x19, 0xD6, 0xA3, 0xA9, 0x77, 0x77, 0x1F, 0xE5, 0x9F,
+    0xDA, 0x79, 0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72,
+    0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD9, 0x71,
+    0xAD, 0x72, 0xAD, 0x70, 0xAF, 0xCA, 0x59, 0xFE, 0x50, 0x49, 0xFD, 0xA9, 0x71, 0xAF, 0xFC, 0xA7,
+    0xE9, 0x99, 0xAF, 0xA6, 0xDA, 0x49, 0xE9, 0x49, 0xD9, 0x6E, 0x4A, 0xD7, 0xAD, 0x4A, 0xD7, 0x9D,
+    0x93, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA0, 0x99, 0xAD, 0xA9, 0x99, 0x94, 0xDA, 0x0F, 0xFC,
+    0xA3, 0x9D, 0x90, 0xFF, 0xC9, 0x3A, 0xD9, 0x2D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70,
+    0xAD, 0x92, 0xAD, 0x79, 0xE3, 0xDA, 0x69, 0xE4, 0xDA, 0x5A, 0xE9, 0x39, 0xDA, 0x99, 0x99, 0xAF,
+    0x94, 0x9F, 0xFD, 0xA6, 0xAF, 0xEA, 0x97, 0x71, 0x99, 0x49, 0x72, 0xFA, 0x1A, 0xC7, 0x1A, 0xFF,
+    0xA7, 0x1C, 0xA1, 0x9F, 0x72, 0x97, 0x77, 0x72, 0x9D, 0x97, 0x0A, 0xCA, 0x3A, 0xE7, 0x0D, 0x93,
+    0xF7, 0x0D, 0x93, 0xFA, 0x69, 0xD3, 0x9D, 0xAD, 0x6A, 0xD3, 0xAD, 0x0D, 0x95, 0xDA, 0x3D, 0xA0,
+    0xDA, 0x5D, 0x93, 0xD9, 0x09, 0xD4, 0x9D, 0x4D, 0x91, 0xD9, 0x39, 0xD3, 0x9D, 0x2A, 0xD3, 0xAD,
+    0x3A, 0xD2, 0x9D, 0x3D, 0xA3, 0xDA, 0x3D, 0xA2, 0xD9, 0x3D, 0x93, 0xAD, 0x19, 0xD4, 0xD5, 0xD9,
+    0x0A, 0xD3, 0x9D, 0x5D, 0xA0, 0xAC, 0xA3, 0xAD, 0x59, 0xD0, 0xDA, 0x3D, 0xA6, 0xD9, 0xD9, 0x3D,
+    0x96, 0xAF, 0x39, 0xD7, 0x9F, 0x3A, 0xD7, 0x0E, 0xA3, 0xAC, 0xA7, 0x0A, 0xD9, 0x30, 0x70, 0x99,
+    0x77, 0x0D, 0xA7, 0x79, 0xD7, 0x70, 0xAC, 0xA7, 0x70, 0xD7, 0x71, 0x97, 0x77, 0x7A, 0xFC, 0xA9,
+    0x70, 0xAF, 0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E, 0x3A, 0xDA, 0x79, 0xDA, 0x2E, 0x71,
+    0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72, 0xAD, 0x0A, 0xD9, 0x72, 0xAD, 0x0A,
+    0xD7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7,
+    0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A, 0xEA, 0x5A, 0xFF, 0xD9,
+    0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x75, 0x99, 0x77, 0xE7, 0x6E, 0x76, 0xAD, 0x76, 0x9D, 0x77,
+    0x99, 0x77, 0x77, 0x0A, 0xFC, 0xA9, 0x70, 0xAF, 0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E,
+    0x3A, 0xDA, 0x79, 0xDA, 0x2E, 0x71, 0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72,
+    0xAD, 0x0A, 0xD9, 0x72, 0xAD, 0x0A, 0xD7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72,
+    0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7, 0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39,
+    0xEA, 0x3A, 0xEA, 0x5A, 0xFF, 0xD9, 0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x72, 0x99, 0x77, 0xAE,
+    0x75, 0xAF, 0x97, 0x3A, 0xD0, 0x9D, 0x72, 0xAC, 0xA2, 0x9C, 0xA7, 0x19, 0x94, 0x99, 0x77, 0x74,
+    0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D,
+    0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97,
+    0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9, 0x0E, 0x72,
+    0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3, 0xAE, 0xA5,
+    0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x10, 0x70, 0x99, 0x49, 0x71, 0xFA, 0x1A, 0xC7,
+    0x0A, 0xFF, 0xA7, 0x0C, 0xA1, 0x9F, 0x71, 0x97, 0x77, 0x74, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA,
+    0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71,
+    0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7,
+    0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D,
+    0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3, 0xAE, 0xA5, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7,
+    0x59, 0x97, 0x10, 0x77, 0x72, 0xAD, 0x19, 0xD7, 0x2E, 0x1A, 0xD7, 0x3A, 0x3A, 0x97, 0x77, 0x77,
+    0x7A, 0xFC, 0xA9, 0x70, 0xAF, 0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E, 0x3A, 0xDA, 0x79,
+    0xDA, 0x2E, 0x71, 0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72, 0xAD, 0x0A, 0xD9,
+    0x72, 0xAD, 0x0A, 0xD7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7,
+    0x2E, 0x1A, 0xD7, 0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A, 0xEA,
+    0x5A, 0xFF, 0xD9, 0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x09, 0x97, 0x91, 0x9D, 0x69, 0xD1, 0xE4,
+    0x9D, 0xA2, 0xE2, 0x9D, 0xA4, 0xE0, 0x9D, 0xA6, 0xFC, 0xA7, 0x0E, 0xA7, 0x09, 0xF7, 0x9D, 0xAE,
+    0x59, 0xDA, 0x1E, 0x39, 0xDA, 0x3E, 0x19, 0xDA, 0x5E, 0x1A, 0xA7, 0xC9, 0x76, 0x77, 0x1A, 0x70,
+    0xAF, 0xCA, 0x1D, 0xA5, 0xAF, 0xFF, 0x5F, 0x92, 0xAF, 0x5E, 0xA5, 0xAE, 0x4A, 0xDA, 0x59, 0xFA,
+    0x3E, 0x6D, 0xAE, 0x2A, 0xD9, 0x5E, 0x0A, 0xD2, 0xE5, 0xAD, 0x1A, 0xD1, 0x9D, 0x94, 0x9D, 0x91,
+    0xAD, 0x1A, 0xD4, 0x9D, 0xA2, 0xAD, 0x1A, 0xD4, 0xDA, 0x3E, 0x1E, 0x3E, 0x4E, 0x1E, 0x2A, 0xD5,
+    0xDA, 0x1E, 0x19, 0xD9, 0x4A, 0xD9, 0x1E, 0x09, 0xDA, 0x5E, 0x2A, 0xD9, 0xDA, 0x59, 0xDA, 0x29,
+    0xFC, 0x6E, 0x4F, 0x6E, 0x94, 0xAE, 0xA3, 0xAE, 0xA4, 0x9F, 0xFF, 0x95, 0xDA, 0x0A, 0xFD, 0xA7,
+    0xAC, 0x49, 0x97, 0x77, 0x50, 0x79, 0x99, 0x77, 0xAD, 0x77, 0x0D, 0x97, 0x79, 0xD7, 0x70, 0xAC,
+    0xA7, 0x70, 0x99, 0x77, 0x73, 0xAC, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xE3, 0xD9, 0x70, 0xDA, 0x29,
+    0xD7, 0x1D, 0x92, 0xAD, 0x70, 0x9D, 0x3E, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA3, 0xD9, 0x70, 0xDA,
+    0x29, 0xD7, 0x09, 0xD9, 0x2A, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D,
+    0x97, 0x0D, 0x92, 0x9D, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xD3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x9D,
+    0x93, 0x9D, 0x96, 0xE5, 0xEA, 0x3A, 0xE6, 0x9F, 0xFD, 0x97, 0x9F, 0xEA, 0x75, 0x99, 0x72, 0x74,
+    0x99, 0x97, 0x6A, 0xD9, 0x75, 0x9D, 0x97, 0x6D, 0x97, 0x6D, 0x97, 0x79, 0x77, 0x75, 0xAC, 0xA7,
+    0x0A, 0xD3, 0xDA, 0x70, 0xE3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x1D, 0x92, 0xAD, 0x70, 0x9D, 0x3E,
+    0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x09, 0xD9, 0x2A, 0xD7, 0x0A,
+    0xD3, 0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x97, 0x0D, 0x92, 0x9D, 0x70, 0x9D, 0x3A,
+    0xD7, 0x0A, 0xD3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x9D, 0x93, 0x9D, 0x96, 0xE5, 0xEA, 0x3A, 0xE6,
+    0x9F, 0xFD, 0x97, 0x9F, 0xEA, 0x75, 0x99, 0x72, 0x71, 0x99, 0x97, 0x69, 0xE9, 0x75, 0xFC, 0x74,
+    0xD9, 0x0D, 0x97, 0x19, 0xD9, 0x2D, 0x72, 0x95, 0x97, 0x77, 0x1A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7,
+    0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA,
+    0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A,
+    0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A,
+    0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79,
+    0xFE, 0xA7, 0x59, 0x97, 0x20, 0x75, 0x97, 0x3D, 0x2D, 0x97, 0x19, 0xD2, 0xD9, 0x72, 0xA9, 0x29,
+    0x97, 0x77, 0x77, 0x4A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71,
+    0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D,
+    0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70,
+    0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39,
+    0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x20, 0x71, 0x99,
+    0x97, 0x4E, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xCA, 0x74, 0x99, 0x77, 0x7D, 0x97, 0xAD, 0x1D, 0xA6,
+    0x9D, 0xA1, 0xAD, 0x6E, 0x29, 0xD5, 0xAD, 0x93, 0xD9, 0x4D, 0xA4, 0xDA, 0x3E, 0x5A, 0xD2, 0xAD,
+    0x69, 0xD2, 0xDA, 0x7D, 0x90, 0xE7, 0x0D, 0xAA, 0xD7, 0x1A, 0xF9, 0x71, 0x9F, 0x73, 0xE7, 0x4D,
+    0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x72,
+    0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0xA7, 0x29, 0xFF, 0x94, 0xAF, 0xFC, 0xA3, 0xAD, 0x39,
+    0xE3, 0xDA, 0x49, 0xDA, 0x2D, 0x95, 0xE1, 0x9D, 0x6E, 0x1A, 0xD6, 0xDA, 0x1E, 0x59, 0xD9, 0x1D,
+    0xA5, 0xE2, 0xD9, 0x39, 0xE9, 0x19, 0xEA, 0xFD, 0xA2, 0xAF, 0xFA, 0x4E, 0x99, 0x99, 0x7D, 0xA7,
+    0x29, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0x75, 0x99, 0x77, 0xAF, 0xD9, 0x73, 0xFF, 0xC9, 0x71,
+    0xAD, 0x93, 0xE7, 0x1D, 0xA4, 0x9D, 0x70, 0x9D, 0x5A, 0xD7, 0x0A, 0xD4, 0x9D, 0xA7, 0x0D, 0xA3,
+    0x9E, 0x71, 0xD9, 0x2A, 0xDA, 0x71, 0x9D, 0x2E, 0xA7, 0x2A, 0xD1, 0x9D, 0x97, 0x3E, 0x1A, 0xD7,
+    0x4D, 0xA1, 0xAD, 0x74, 0xD9, 0x2E, 0x97, 0x19, 0xD3, 0x9E, 0x97, 0x0A, 0xD5, 0xE9, 0x7E, 0x6E,
+    0x7D, 0xA6, 0xAD, 0x7D, 0x96, 0xAD, 0x69, 0xD7, 0xE6, 0xAD, 0x09, 0x93, 0xAD, 0xA6, 0xDA, 0x0A,
+    0xFF, 0x7D, 0x91, 0xFD, 0xA7, 0x9D, 0x93, 0x99, 0x72, 0xAD, 0x77, 0x1E, 0x77, 0x1D, 0xA7, 0x79,
+    0xE7, 0x6A, 0xF9, 0x76, 0xAE, 0x97, 0x70, 0x59, 0x99, 0x74, 0x9D, 0x97, 0x4D, 0xA7, 0x5D, 0x75,
+    0x9D, 0x76, 0x97, 0x77, 0x19, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A,
+    0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59,
+    0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2, 0xAC,
+    0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x20, 0x72, 0x99, 0x97, 0x39, 0xDA,
+    0x73, 0xDA, 0x73, 0xDA, 0x73, 0xAC, 0x97, 0x49, 0x77, 0x73, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0,
+    0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2,
+    0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2,
+    0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72,
+    0x70, 0x99, 0x74, 0xEA, 0x72, 0xFC, 0x71, 0xDA, 0x0A, 0xCA, 0x7D, 0x92, 0xD9, 0x69, 0x59, 0x77,
+    0x79, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A, 0xDA, 0x39, 0xE9, 0x2E,
+    0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0xAD,
+    0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2, 0xAC, 0xAD, 0x93, 0xAF, 0xDA,
+    0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x20, 0x69, 0x93, 0x99, 0x59, 0xF9, 0x1C, 0xA5, 0xDA, 0xFD,
+    0x94, 0x9C, 0x91, 0x9E, 0xA6, 0x94, 0x97, 0x77, 0x09, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3,
+    0xF9, 0x99, 0xFA, 0x2A, 0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6,
+    0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4,
+    0x9E, 0x93, 0xE2, 0xAC, 0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x20, 0x69,
+    0x39, 0x70, 0xD9, 0x1D, 0xA6, 0x9D, 0x91, 0xDA, 0x79, 0x92, 0x9A, 0x77, 0x77, 0x79, 0xAD, 0xA2,
+    0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A, 0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6,
+    0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2,
+    0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2, 0xAC, 0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9,
+    0x09, 0xD7, 0x97, 0x20, 0x7A, 0xCA, 0x73, 0xDA, 0xD7, 0x1A, 0xC2, 0xCA, 0x70, 0xAC, 0x2C, 0xA7,
+    0x09, 0xCA, 0x09, 0xC9, 0x71, 0xAE, 0xA7, 0x49, 0x77, 0x72, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0,
+    0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2,
+    0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2,
+    0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72,
+    0x49, 0xAD, 0x91, 0x9A, 0x1A, 0xE9, 0x5F, 0xDA, 0x0D, 0x9F, 0xDA, 0x3E, 0xA9, 0x9A, 0xCA, 0xFA,
+    0x09, 0xE2, 0xAD, 0xA3, 0xFC, 0x39, 0xD9, 0x1E, 0x4A, 0xE4, 0x9D, 0x1A, 0xD5, 0x9D, 0xA4, 0xE1,
+    0xE5, 0xAD, 0x39, 0xE9, 0x1D, 0x95, 0xAF, 0xFC, 0x91, 0x9D, 0x95, 0xFF, 0x93, 0xAD, 0x59, 0xDA,
+    0x71, 0xAD, 0x5A, 0xDA, 0x71, 0xAD, 0x49, 0xEA, 0x71, 0x9D, 0x4F, 0xC7, 0x19, 0xDA, 0x19, 0xDA,
+    0xF3, 0x9A, 0x92, 0xFE, 0x0A, 0xCA, 0xFF, 0x93, 0xFA, 0x1D, 0x09, 0xFD, 0xA6, 0x97, 0x19, 0x95,
+    0x5A, 0xEA, 0x94, 0xAF, 0xE3, 0xF9, 0x99, 0xAA, 0x2A, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x3A,
+    0x39, 0xFF, 0x5F, 0xDA, 0x6A, 0xC9, 0x71, 0xCA, 0x71, 0x9D, 0xA7, 0x2D, 0x72, 0xD7, 0xAA, 0xDA,
+    0x69, 0xEA, 0x60, 0x59, 0x97, 0x2D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x2D, 0x73, 0x97, 0x74, 0x9A,
+    0xEA, 0x5A, 0xFE, 0x3E, 0xA9, 0x0A, 0xDA, 0x1A, 0xD9, 0x3D, 0xA1, 0xDA, 0x4D, 0xA0, 0xAD, 0x49,
+    0xD9, 0x0D, 0xA2, 0x9A, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFE, 0xA3, 0xAD, 0x97, 0x0A, 0xD7, 0x1A,
+    0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC, 0x39, 0xFD, 0xA7, 0x99, 0x50, 0x71, 0x99,
+    0x97, 0x19, 0xE7, 0x1E, 0x71, 0xAD, 0x71, 0xAC, 0xA7, 0x29, 0x97, 0x77, 0x9A, 0xEA, 0x6A, 0xFE,
+    0x4E, 0xA9, 0x0A, 0xDA, 0x2A, 0xD9, 0x3D, 0xA2, 0xDA, 0x4D, 0xA1, 0xAD, 0x49, 0xD9, 0x1D, 0xA2,
+    0x9A, 0xDA, 0x19, 0xFF, 0xCA, 0x29, 0xFE, 0xA4, 0xAD, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x29, 0xD9,
+    0x72, 0xE9, 0x39, 0xA3, 0x9F, 0xFC, 0x49, 0xFD, 0xA7, 0x09, 0x96, 0x79, 0x97, 0x1A, 0xE7, 0xAF,
+    0x95, 0xAD, 0x09, 0xD4, 0xAC, 0xA2, 0xAC, 0xA3, 0x95, 0x99, 0x77, 0x19, 0xAE, 0xA5, 0xAF, 0xE3,
+    0xEA, 0x90, 0xAD, 0xA1, 0xAD, 0x93, 0xDA, 0x1D, 0xA4, 0xDA, 0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x29,
+    0xAD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xEA, 0x3A, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97,
+    0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC3, 0x9F, 0xDA, 0x79, 0x95, 0x59, 0x39, 0x5D, 0xA1, 0xAD, 0x4D,
+    0xA1, 0xE4, 0x9A, 0x3A, 0x77, 0x77, 0x9A, 0xEA, 0x5A, 0xFE, 0x3E, 0xA9, 0x0A, 0xDA, 0x1A, 0xD9,
+    0x3D, 0xA1, 0xDA, 0x4D, 0xA0, 0xAD, 0x49, 0xD9, 0x0D, 0xA2, 0x9A, 0xDA, 0x09, 0xFF, 0xCA, 0x19,
+    0xFE, 0xA3, 0xAD, 0x97, 0x0A, 0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC,
+    0x39, 0xFD, 0xA7, 0x99, 0x50, 0x29, 0x95, 0xE4, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0x97, 0x4A, 0xA9,
+    0x4D, 0x93, 0x9D, 0x93, 0xAD, 0x4A, 0xD4, 0xDA, 0x4D, 0x93, 0x9D, 0x4A, 0xD4, 0xE4, 0xDA, 0x4D,
+    0x93, 0x9D, 0x4A, 0xD4, 0xDA, 0x4D, 0x93, 0x79, 0x97, 0xE6, 0xAD, 0x69, 0xD6, 0x9D, 0x70, 0x97,
+    0x73, 0xAA, 0x97, 0xD9, 0x69, 0xD9, 0x6A, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7E,
+    0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x60, 0x49, 0x97, 0x9E, 0x59, 0xFA, 0x39,
+    0xD9, 0x0D, 0x29, 0xD2, 0x9D, 0x19, 0x95, 0x97, 0x7A, 0xA9, 0x7D, 0x96, 0x9D, 0x96, 0xAD, 0x7A,
+    0xD7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xE7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D,
+    0x96, 0x29, 0x70, 0xAD, 0x19, 0xD2, 0xE1, 0xAD, 0x3A, 0x3A, 0x97, 0x77, 0x2A, 0xA9, 0x7D, 0x96,
+    0x9D, 0x96, 0xAD, 0x7A, 0xD7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xE7, 0xDA, 0x7D, 0x96, 0x9D,
+    0x7A, 0xD7, 0xDA, 0x7D, 0x96, 0x77, 0x6D, 0x3C, 0xA7, 0xE9, 0xAD, 0xA7, 0x0F, 0xC9, 0x70, 0x9F,
+    0x70, 0x9E, 0xAD, 0xA7, 0x9C, 0xA1, 0x9D, 0x75, 0xDA, 0x74, 0x9D, 0x69, 0xAC, 0xAA, 0x09, 0xD4,
+    0x9F, 0xE9, 0xD3, 0x9E, 0x99, 0x9A, 0xF2, 0x9D, 0xA4, 0xAE, 0x2E, 0x6E, 0x2D, 0x96, 0xE1, 0xAD,
+    0x7E, 0x1A, 0xD7, 0xDA, 0x1A, 0xD6, 0x9D, 0x91, 0xAD, 0x6E, 0x2A, 0xD5, 0x9D, 0x93, 0xE3, 0xAD,
+    0xA4, 0xAF, 0xFA, 0x69, 0xFD, 0x97, 0x29, 0x97, 0x00, 0x79, 0x94, 0x97, 0xF9, 0x1D, 0x6A, 0xFF,
+    0xA6, 0xCA, 0x19, 0xEA, 0x79, 0x77, 0x76, 0xAA, 0x2A, 0xEA, 0x6D, 0x09, 0xFD, 0xA4, 0x9D, 0x9D,
+    0xA9, 0x9E, 0x4A, 0xF3, 0xAD, 0x93, 0xF4, 0x9D, 0x93, 0xE5, 0xAD, 0x39, 0xDA, 0x5E, 0x39, 0xD9,
+    0x5E, 0x3A, 0xD6, 0xDA, 0x3E, 0x59, 0xD9, 0x3D, 0xA5, 0xAD, 0x39, 0xD9, 0x5E, 0x3A, 0xD6, 0xDA,
+    0x3E, 0x59, 0xDA, 0x3E, 0x59, 0xD9, 0x3D, 0xA5, 0xAD, 0x30, 0x59, 0x97, 0x4E, 0x73, 0x9D, 0x74,
+    0xAC, 0xA7, 0x4D, 0x75, 0x97, 0x77, 0x09, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09,
+    0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9,
+    0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x72, 0x99, 0x73, 0xE7, 0x2A, 0xD7, 0x29, 0xD7,
+    0x29, 0xD7, 0x49, 0x77, 0x71, 0x9A, 0xDA, 0x97, 0xAF, 0xE5, 0xEA, 0x99, 0xAE, 0x3A, 0xD9, 0x39,
+    0xDA, 0x19, 0xDA, 0x5E, 0x1A, 0xD6, 0xAD, 0x1D, 0xA6, 0xAD, 0x09, 0xD9, 0x6A, 0xD0, 0x9D, 0x7E,
+    0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0x9D, 0x6E, 0x19, 0xDA, 0x49, 0xD9, 0x2E, 0x92, 0xAD,
+    0xA4, 0xFF, 0xA6, 0xAF, 0xC9, 0x77, 0x30, 0x79, 0x97, 0x3A, 0xE7, 0x19, 0xFA, 0x79, 0xD1, 0xD6,
+    0x9D, 0x29, 0xD5, 0x99, 0x59, 0x77, 0x59, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09,
+    0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9,
+    0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x59, 0x94, 0x95, 0xFA, 0x1A, 0xC4, 0xAF, 0xFA,
+    0x4D, 0x2F, 0x59, 0x59, 0x77, 0x69, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93,
+    0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7,
+    0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A,
+    0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x59, 0x74, 0xAD, 0x19, 0xD6, 0xDA, 0x1A, 0xD7, 0xA3,
+    0xA9, 0x77, 0x77, 0x49, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1,
+    0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD,
+    0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F,
+    0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x49, 0xD7, 0x2A, 0xD9, 0x71, 0xAD, 0x97, 0x29, 0x97, 0x73, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xA7, 0x77, 0x70, 0x9D, 0x72, 0xAD,
+    0x97, 0x1A, 0xD9, 0x72, 0x99, 0x50, 0x75, 0x96, 0x9A, 0xDA, 0xA0, 0xAC, 0x94, 0xAF, 0xFC, 0x4E,
+    0xA9, 0x99, 0xE9, 0x3A, 0xD9, 0x3E, 0xA3, 0xD9, 0x3F, 0xC2, 0xAD, 0x3D, 0xAA, 0xD2, 0xD9, 0x2A,
+    0xD0, 0x9D, 0x19, 0xD2, 0x9D, 0x1A, 0xD1, 0x9D, 0x2D, 0x91, 0xAD, 0x1A, 0xD1, 0xD9, 0x2D, 0xA1,
+    0xAD, 0x0D, 0xA3, 0xD2, 0x9D, 0xAD, 0x3A, 0xD3, 0xF3, 0x9D, 0x93, 0xEA, 0x29, 0xDA, 0x4F, 0xFC,
+    0xA4, 0xDA, 0xAF, 0xC9, 0x59, 0xC7, 0x77, 0x40, 0x69, 0x97, 0x49, 0xDA, 0x74, 0xAD, 0x75, 0xD9,
+    0x75, 0xD7, 0x69, 0x77, 0x7A, 0xA9, 0x59, 0xAA, 0x29, 0xD9, 0x5A, 0xD2, 0x9D, 0x6D, 0xA2, 0xAD,
+    0x6D, 0x92, 0xDA, 0x59, 0xD3, 0xD9, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2E, 0x59,
+    0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95, 0xE2, 0x9D, 0x94, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x29, 0xDA,
+    0x2A, 0xCA, 0xD9, 0x3F, 0xEA, 0x0D, 0x5F, 0xC9, 0x09, 0xD7, 0x97, 0x20, 0x72, 0x99, 0x97, 0x39,
+    0xDA, 0x73, 0xE7, 0x3D, 0xA7, 0x3A, 0xCA, 0x74, 0x99, 0x77, 0x70, 0xAA, 0x95, 0x9A, 0xA2, 0x9D,
+    0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9,
+    0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A,
+    0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D, 0xA2, 0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D,
+    0x79, 0x72, 0x70, 0x99, 0x74, 0xEA, 0x72, 0xAF, 0x97, 0x0A, 0xD0, 0x9D, 0x7A, 0xCA, 0x2A, 0xCA,
+    0x69, 0x59, 0x97, 0x74, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6,
+    0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D,
+    0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D, 0xA2,
+    0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x69, 0x39, 0x70, 0xDA, 0x1A,
+    0xD7, 0xD9, 0x1D, 0xA7, 0x9A, 0x29, 0xA7, 0x77, 0x75, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD,
+    0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2,
+    0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29,
+    0xD4, 0x9E, 0x92, 0x9D, 0xA2, 0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72,
+    0x74, 0x99, 0x97, 0x69, 0xDA, 0x76, 0xDA, 0x76, 0xDA, 0x76, 0xD9, 0x77, 0x97, 0x77, 0x69, 0xAA,
+    0x7A, 0xAA, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0x95, 0xE6, 0xD9, 0x49, 0xD9, 0x6D, 0xA4, 0xE7, 0xDA,
+    0x39, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD2, 0xDA, 0x72, 0xD1, 0xAD, 0x73,
+    0xD1, 0xDA, 0x73, 0xD9, 0xAD, 0x74, 0xD9, 0xD9, 0x74, 0xAF, 0x75, 0x9E, 0x97, 0x59, 0xE7, 0x69,
+    0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0xA7, 0x59, 0xE7, 0x3A, 0xFC, 0x74, 0xAE, 0xA7, 0x50,
+    0x77, 0x6A, 0xD7, 0x5D, 0xA7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x1A,
+    0xDA, 0x7D, 0x99, 0xFD, 0x94, 0x9D, 0x9D, 0x99, 0xAE, 0x4A, 0xEA, 0x3A, 0xD9, 0x3A, 0xE4, 0x9D,
+    0x93, 0xE6, 0xD9, 0x3D, 0xA6, 0xD9, 0x29, 0xD6, 0x9D, 0x92, 0xAD, 0x6A, 0xD3, 0xE6, 0xE3, 0xDA,
+    0x6D, 0xA3, 0xDA, 0x5A, 0xD3, 0x9E, 0x49, 0xDA, 0x3A, 0xEA, 0x29, 0xE4, 0xDA, 0xAF, 0xE5, 0xD9,
+    0x0A, 0xFA, 0x59, 0xD9, 0x29, 0x97, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75,
+    0xAD, 0x75, 0x75, 0x97, 0x3D, 0x91, 0xDA, 0x71, 0x9D, 0x91, 0xDA, 0x72, 0x99, 0x29, 0xA7, 0x77,
+    0x77, 0x59, 0xAA, 0x7A, 0xAA, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0x95, 0xE6, 0xD9, 0x49, 0xD9, 0x6D,
+    0xA4, 0xE7, 0xDA, 0x39, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD2, 0xDA, 0x72,
+    0xD1, 0xAD, 0x73, 0xD1, 0xDA, 0x73, 0xD9, 0xAD, 0x74, 0xD9, 0xD9, 0x74, 0xAF, 0x75, 0x9E, 0x97,
+    0x59, 0xE7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0xA7, 0x59, 0xE7, 0x3A, 0xFC, 0x74,
+    0xAE, 0xA7, 0x50, 0x71, 0xFE, 0x97, 0x09, 0xFE, 0x97, 0x19, 0x99, 0x99, 0x99, 0x77, 0x75, 0x9D,
+    0x97, 0x5E, 0xA7, 0x4A, 0xEA, 0x74, 0xDA, 0xD7, 0x3A, 0xD9, 0xD7, 0x3D, 0x99, 0xD7, 0x2E, 0x1D,
+    0x71, 0x9D, 0x91, 0xD9, 0x70, 0xE2, 0xD9, 0x79, 0xD9, 0x2D, 0xA7, 0xDA, 0x3D, 0xA6, 0x9D, 0x4A,
+    0xD6, 0xFF, 0xE5, 0xAF, 0xFE, 0x5E, 0xAA, 0xAA, 0xAA, 0xAD, 0x4A, 0xD6, 0x9D, 0x93, 0xDA, 0x7D,
+    0x92, 0xE7, 0x0D, 0xA1, 0x9D, 0xA7, 0x0D, 0xA1, 0xE7, 0x1E, 0x09, 0xD9, 0x71, 0xAD, 0x00, 0x5F,
+    0xE9, 0x6A, 0xFE, 0x97, 0x99, 0x99, 0x99, 0x97, 0x77, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D,
+    0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA,
+    0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D,
+    0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x71,
+    0xA4, 0x9A, 0x71, 0x9C, 0xA2, 0x9C, 0xA7, 0x2F, 0xE7, 0x39, 0xFC, 0x97, 0x69, 0x77, 0x77, 0x29,
+    0xD9, 0x76, 0xEA, 0x75, 0xAE, 0xA7, 0x5D, 0xAD, 0x74, 0xAD, 0x9D, 0x74, 0xD9, 0x9D, 0x73, 0xE1,
+    0xD7, 0x29, 0xD9, 0x1D, 0x97, 0x1E, 0x2D, 0x97, 0x09, 0xD9, 0x2D, 0xA7, 0x0D, 0xA3, 0xDA, 0x79,
+    0xD4, 0xAD, 0x7F, 0xFE, 0x6A, 0xFF, 0xE6, 0xEA, 0xAA, 0xAA, 0xAA, 0xD5, 0xAD, 0x69, 0xD9, 0x4D,
+    0xA7, 0xD9, 0x3E, 0x70, 0xDA, 0x29, 0xDA, 0x70, 0xDA, 0x2E, 0x71, 0xE1, 0x9D, 0x97, 0x1A, 0xD1,
+    0x5A, 0x49, 0xA6, 0x9C, 0xA2, 0x9C, 0xA7, 0xFE, 0x70, 0x9F, 0xC9, 0x72, 0x99, 0x77, 0x72, 0x9A,
+    0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2,
+    0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD,
+    0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5,
+    0xAF, 0x90, 0x9D, 0x79, 0x72, 0x72, 0x9D, 0x97, 0x4E, 0xA7, 0x3A, 0xEA, 0x73, 0xDA, 0xD7, 0x2A,
+    0xD9, 0xD7, 0x2D, 0x99, 0xD7, 0x1E, 0x1D, 0x70, 0x9D, 0x91, 0xD9, 0x7E, 0x2D, 0x96, 0x9D, 0x92,
+    0xDA, 0x6D, 0xA3, 0xDA, 0x59, 0xD4, 0xAD, 0x5F, 0xFE, 0x4A, 0xFF, 0xE4, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xD3, 0xAD, 0x69, 0xD9, 0x2D, 0xA7, 0xD9, 0x1E, 0x70, 0xDA, 0x09, 0xDA, 0x70, 0xDA, 0x0E, 0x71,
+    0xE9, 0xD9, 0x71, 0xAD, 0x74, 0x9C, 0xA7, 0x4A, 0xCA, 0x74, 0x9D, 0x75, 0xAC, 0xA7, 0x5A, 0xD9,
+    0x97, 0x4E, 0xA7, 0x59, 0x91, 0x49, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA,
+    0x2A, 0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9,
+    0x59, 0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2,
+    0xAC, 0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x93, 0xD7, 0x39, 0xCA, 0x74, 0xD7,
+    0x49, 0xD7, 0x49, 0xD9, 0x97, 0x3F, 0x75, 0x95, 0x74, 0x99, 0x97, 0x49, 0xDA, 0x74, 0xDA, 0x74,
+    0xDA, 0x74, 0xAC, 0x97, 0x59, 0x77, 0x75, 0x9F, 0xDA, 0x95, 0x9F, 0xFD, 0x4A, 0xEA, 0x91, 0x99,
+    0xCA, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x74, 0x9D, 0xA7, 0x4E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A,
+    0xD7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5A, 0xD7, 0x59, 0xDA, 0x75, 0xE9, 0x74, 0x9E, 0xA3,
+    0x9A, 0x95, 0xAF, 0xFC, 0xA6, 0x9F, 0xF9, 0x72, 0x99, 0x70, 0x71, 0x99, 0x97, 0x19, 0xDA, 0x71,
+    0xDA, 0x71, 0xDA, 0x71, 0xD9, 0x72, 0x97, 0x77, 0x1A, 0xEA, 0x95, 0xAF, 0xE4, 0xF9, 0x99, 0xAA,
+    0x3A, 0xDA, 0x71, 0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2A,
+    0xD7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xE9, 0x3A, 0x49, 0xFF, 0x6F, 0xDA, 0x70, 0x99, 0x60, 0x72,
+    0x99, 0x75, 0xEA, 0x73, 0xFC, 0x72, 0xDA, 0x0A, 0xCA, 0x70, 0xD9, 0x2D, 0x97, 0x95, 0x97, 0x77,
+    0x19, 0xFD, 0xA9, 0x59, 0xFF, 0xD4, 0xAE, 0xA9, 0x19, 0x9C, 0xA3, 0xAE, 0x73, 0x9E, 0x74, 0xE7,
+    0x49, 0xDA, 0x74, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xAD, 0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xEA, 0x39, 0xA9, 0x5A, 0xFF, 0xCA, 0x69, 0xFF,
+    0x97, 0x29, 0x97, 0x79, 0x97, 0x1E, 0xA7, 0xFC, 0x6D, 0xA0, 0xAC, 0xA4, 0xD9, 0x2D, 0x93, 0x95,
+    0x97, 0x73, 0xAE, 0xA9, 0x4A, 0xFE, 0x3F, 0x99, 0x9A, 0xA2, 0xAD, 0xA7, 0x0D, 0xA7, 0x0A, 0xD7,
+    0x1D, 0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E,
+    0x93, 0xA3, 0x9F, 0xF5, 0xFD, 0xA7, 0x99, 0x50, 0x72, 0x99, 0x75, 0xAD, 0x75, 0xE7, 0x59, 0xA9,
+    0x77, 0x77, 0x74, 0x9F, 0xDA, 0x95, 0x9F, 0xFD, 0x4A, 0xEA, 0x91, 0x99, 0xCA, 0x3A, 0xE7, 0x39,
+    0xE7, 0x4E, 0x74, 0x9D, 0xA7, 0x4E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5A, 0xD7, 0x59, 0xDA, 0x75, 0xE9, 0x74, 0x9E, 0xA3, 0x9A, 0x95, 0xAF, 0xFC,
+    0xA6, 0x9F, 0xF9, 0x72, 0x99, 0x70, 0x79, 0x97, 0x1A, 0xD7, 0x1E, 0x71, 0x9A, 0x97, 0x77, 0x72,
+    0xAE, 0xA9, 0x4A, 0xFE, 0x3F, 0x99, 0x9A, 0xA2, 0xAD, 0xA7, 0x0D, 0xA7, 0x0A, 0xD7, 0x1D, 0xA7,
+    0x09, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E, 0x93, 0xA3,
+    0x9F, 0xF5, 0xFD, 0xA7, 0x99, 0x50, 0x79, 0x59, 0x70, 0xD2, 0x9D, 0x70, 0x9D, 0x0A, 0xD7, 0x2F,
+    0xC7, 0x39, 0xE7, 0x59, 0x97, 0x77, 0x49, 0xFD, 0xA9, 0x59, 0xFF, 0xD4, 0xAE, 0xA9, 0x19, 0x9C,
+    0xA3, 0xAE, 0x73, 0x9E, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x75, 0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xEA, 0x39,
+    0xA9, 0x5A, 0xFF, 0xCA, 0x69, 0xFF, 0x97, 0x29, 0x97, 0x49, 0x59, 0x5D, 0x29, 0xD5, 0x9D, 0x0A,
+    0xD7, 0xFC, 0x70, 0x9E, 0x72, 0x99, 0x77, 0x70, 0xAE, 0xA9, 0x5A, 0xFE, 0x4F, 0x99, 0x9A, 0xA3,
+    0xAD, 0xA7, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x93, 0xA4, 0x9F, 0xF6, 0xFD, 0xA7, 0x09, 0x96, 0x79, 0x95,
+    0x97, 0x09, 0xCA, 0x2A, 0xCA, 0x71, 0xD9, 0x0D, 0xA7, 0x29, 0xFA, 0x74, 0xEA, 0x76, 0x99, 0x77,
+    0x72, 0x9F, 0xDA, 0x97, 0x0A, 0xFF, 0xCA, 0x6E, 0x99, 0x9A, 0xFA, 0x5D, 0xA4, 0x9E, 0x93, 0x9D,
+    0x96, 0xE3, 0xAD, 0x7A, 0xD3, 0xAD, 0x79, 0xD9, 0x2D, 0xA7, 0x0D, 0xA2, 0xD9, 0x70, 0xDA, 0x19,
+    0xD7, 0x1D, 0xA1, 0xAD, 0x70, 0x9D, 0x91, 0xE7, 0x0A, 0xD9, 0x1D, 0xA7, 0x0E, 0x2D, 0x97, 0x0D,
+    0xA1, 0x9D, 0x70, 0xAD, 0x91, 0xAD, 0x79, 0xE2, 0xDA, 0x69, 0xE3, 0xDA, 0x5A, 0xE9, 0x29, 0xDA,
+    0x99, 0x99, 0xAF, 0x93, 0x9F, 0xFD, 0xA5, 0xAF, 0xEA, 0x97, 0x77, 0x77, 0x29, 0xD9, 0x09, 0xD7,
+    0x59, 0xD1, 0xD9, 0x75, 0xAD, 0x09, 0xD7, 0x6D, 0xA0, 0xD7, 0x7D, 0x90, 0xA7, 0x79, 0xD7, 0x39,
+    0xAD, 0xA1, 0xAD, 0x72, 0xAF, 0xD0, 0xAD, 0x71, 0xEA, 0x99, 0x9F, 0xA7, 0x0A, 0xDA, 0x39, 0xE9,
+    0x70, 0xE5, 0xE7, 0x0A, 0xD6, 0xE7, 0x0E, 0x6D, 0xA7, 0x0D, 0xA6, 0xDA, 0x79, 0xD9, 0x59, 0xD9,
+    0x7A, 0xD6, 0xAD, 0x70, 0xAD, 0x6E, 0x70, 0xAD, 0x5A, 0xDA, 0x70, 0x9D, 0x49, 0xE9, 0x71, 0xE2,
+    0xAC, 0xAD, 0x97, 0x1A, 0xFD, 0xA0, 0xD7, 0x3A, 0xF9, 0x09, 0xD7, 0x59, 0x77, 0x00, 0x49, 0xFD,
+    0xA9, 0x71, 0xAF, 0xFC, 0xA7, 0xE9, 0x99, 0xAF, 0xA6, 0xDA, 0x49, 0xE9, 0x49, 0xD9, 0x6E, 0x4A,
+    0xD7, 0xAD, 0x4A, 0xD7, 0x9D, 0x93, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA0, 0x99, 0xAD, 0xA9,
+    0x99, 0x94, 0xDA, 0x0F, 0xFC, 0xA3, 0x9D, 0x90, 0xFF, 0xC9, 0x3A, 0xD9, 0x2D, 0xA7, 0x0E, 0x3D,
+    0x97, 0x0D, 0xA2, 0x9D, 0x70, 0xAD, 0x92, 0xAD, 0x79, 0xE3, 0xDA, 0x69, 0xE4, 0xDA, 0x5A, 0xE9,
+    0x39, 0xDA, 0x99, 0x99, 0xAF, 0x94, 0x9F, 0xFD, 0xA6, 0xAF, 0xEA, 0x97, 0x77, 0x76, 0x9D, 0x97,
+    0x59, 0xD7, 0x1A, 0xAA, 0xAA, 0xEA, 0xA7, 0xFF, 0xD7, 0x99, 0x99, 0x9D, 0xA9, 0x74, 0x9D, 0x79,
+    0xAD, 0xA1, 0xAD, 0x6F, 0xE0, 0xAD, 0x5E, 0xA9, 0x09, 0xFA, 0x4A, 0xDA, 0x39, 0xE9, 0x4D, 0xA5,
+    0xE4, 0xAD, 0x6E, 0x4E, 0x6D, 0xA4, 0xD9, 0x6D, 0xA3, 0x9D, 0x95, 0x9D, 0x93, 0xAD, 0x6A, 0xD4,
+    0xAD, 0x6E, 0x4A, 0xD5, 0xAD, 0xA4, 0x9D, 0x4A, 0xE9, 0x5E, 0x2A, 0xCA, 0xD9, 0x5A, 0xFD, 0xA0,
+    0xD7, 0xAF, 0x90, 0x9D, 0x71, 0x97, 0x40, 0x59, 0xFE, 0x96, 0xAF, 0xE7, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x59, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73,
+    0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99,
+    0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA,
+    0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0x4F, 0xEA, 0x39, 0xFE, 0xA4, 0x99, 0x99,
+    0x99, 0x97, 0x72, 0x9A, 0xEA, 0x5A, 0xFE, 0x3E, 0xA9, 0x0A, 0xDA, 0x1A, 0xD9, 0x3D, 0xA1, 0xDA,
+    0x4D, 0xA0, 0xAD, 0x49, 0xD9, 0x0D, 0xA2, 0x9A, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFE, 0xA3, 0xAD,
+    0x97, 0x0A, 0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC, 0x39, 0xFD, 0xA7,
+    0x99, 0x50, 0x59, 0xA4, 0x99, 0x69, 0xC9, 0x29, 0xCA, 0x7F, 0xE7, 0x09, 0xFC, 0x73, 0x99, 0x77,
+    0x70, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xD9, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4E, 0x99, 0x99,
+    0x99, 0x95, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0xA9,
+    0x99, 0x99, 0x99, 0x49, 0xFF, 0xD4, 0xAF, 0xFD, 0x40, 0x4A, 0x93, 0x9A, 0x5D, 0x3D, 0x5F, 0xE9,
+    0x6F, 0xC9, 0x71, 0x97, 0x77, 0x9A, 0xEA, 0x6A, 0xFE, 0x4E, 0xA9, 0x0A, 0xDA, 0x2A, 0xD9, 0x3D,
+    0xA2, 0xDA, 0x4D, 0xA1, 0xAD, 0x49, 0xD9, 0x1D, 0xA2, 0x9A, 0xDA, 0x19, 0xFF, 0xCA, 0x29, 0xFE,
+    0xA4, 0xAD, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xE9, 0x39, 0xA3, 0x9F, 0xFC, 0x49,
+    0xFD, 0xA7, 0x09, 0x96, 0x71, 0x99, 0x74, 0xAD, 0x74, 0xE7, 0x49, 0xA9, 0x77, 0x77, 0x79, 0xFF,
+    0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD,
+    0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D,
+    0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99,
+    0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0x79, 0x97, 0x19, 0xD9, 0x70, 0xAD, 0x97, 0x1A, 0xA7, 0x77,
+    0x71, 0x9A, 0xEA, 0x5A, 0xFE, 0x3E, 0xA9, 0x0A, 0xDA, 0x1A, 0xD9, 0x3D, 0xA1, 0xDA, 0x4D, 0xA0,
+    0xAD, 0x49, 0xD9, 0x0D, 0xA2, 0x9A, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFE, 0xA3, 0xAD, 0x97, 0x0A,
+    0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC, 0x39, 0xFD, 0xA7, 0x99, 0x50,
+    0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD,
+    0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99,
+    0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99,
+    0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD7, 0x3A, 0xC9, 0x73, 0xD9, 0x73, 0xAC, 0xA7, 0x4D,
+    0x75, 0xDA, 0x97, 0x39, 0xE9, 0x74, 0x99, 0x60, 0x49, 0xAE, 0xA5, 0xAF, 0xE3, 0xEA, 0x90, 0xAD,
+    0xA1, 0xAD, 0x93, 0xDA, 0x1D, 0xA4, 0xDA, 0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x29, 0xAD, 0xA0, 0x9F,
+    0xFC, 0xA1, 0x9F, 0xEA, 0x3A, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E, 0x93, 0x9A,
+    0x29, 0xFF, 0xC3, 0x9F, 0xE9, 0x69, 0x9C, 0xA7, 0x09, 0xD7, 0x1D, 0x71, 0x9D, 0x72, 0xD9, 0x97,
+    0x0F, 0x72, 0x94, 0x69, 0x59, 0x7D, 0x29, 0xD7, 0xAC, 0xA0, 0xAD, 0x71, 0xFC, 0x72, 0x9E, 0x74,
+    0x99, 0x77, 0x70, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xD9, 0x73, 0x9D,
+    0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4E,
+    0x99, 0x99, 0x99, 0x95, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73,
+    0x9D, 0xA9, 0x99, 0x99, 0x99, 0x49, 0xFF, 0xD4, 0xAF, 0xFD, 0x40, 0x49, 0x59, 0x94, 0xD9, 0x2D,
+    0x95, 0xD0, 0x9D, 0x96, 0xAF, 0x97, 0x0E, 0x97, 0x19, 0x99, 0x77, 0x69, 0xAE, 0xA6, 0xAF, 0xE4,
+    0xEA, 0x90, 0xAD, 0xA2, 0xAD, 0x93, 0xDA, 0x2D, 0xA4, 0xDA, 0x1A, 0xD4, 0x9D, 0x91, 0xDA, 0x29,
+    0xAD, 0xA1, 0x9F, 0xFC, 0xA2, 0x9F, 0xEA, 0x4A, 0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0x9D, 0x97,
+    0x2E, 0x93, 0x9A, 0x39, 0xFF, 0xC4, 0x9F, 0xDA, 0x70, 0x99, 0x60, 0x72, 0x99, 0x97, 0x59, 0xE7,
+    0x49, 0xFA, 0x72, 0x9D, 0x90, 0xD9, 0x70, 0x9D, 0x29, 0xD7, 0x09, 0x95, 0x97, 0x77, 0x29, 0xAF,
+    0xDA, 0x95, 0x9F, 0xFE, 0x4A, 0xF9, 0x90, 0x99, 0xAD, 0x3A, 0xE9, 0x73, 0x9E, 0x75, 0xE7, 0x59,
+    0xDA, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x59, 0xFD, 0x1E, 0x5A, 0xFD, 0x1E, 0x59,
+    0x99, 0x9E, 0x1E, 0x71, 0xDA, 0x1E, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x29, 0xDA, 0x7A, 0xD3,
+    0xE9, 0x6D, 0xA3, 0x9E, 0xA4, 0x9D, 0x94, 0x9F, 0xFE, 0x7A, 0xFE, 0xA9, 0x72, 0x99, 0x70, 0x71,
+    0x99, 0x75, 0xE9, 0x73, 0xFC, 0x72, 0xDA, 0x0A, 0xCA, 0x70, 0xD9, 0x2D, 0x70, 0x95, 0x97, 0x77,
+    0x19, 0xAD, 0xA2, 0xAA, 0x5F, 0xE0, 0x9D, 0x4F, 0x99, 0x9F, 0xA3, 0xAD, 0xA3, 0x9E, 0x93, 0xE5,
+    0xE3, 0xAD, 0x6E, 0x3E, 0x6E, 0x3D, 0xA6, 0xDA, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0xAD, 0x3A,
+    0xD6, 0xE3, 0xAD, 0x5A, 0xDA, 0x39, 0xD4, 0xAE, 0x94, 0xE2, 0xAC, 0xAD, 0x94, 0xAF, 0xDA, 0x9D,
+    0x6A, 0xF9, 0x0A, 0xD7, 0x09, 0x3D, 0xA7, 0x5D, 0x97, 0x4A, 0xD7, 0x5D, 0xA4, 0x9C, 0xA9, 0x2A,
+    0xE5, 0x9F, 0xFC, 0x79, 0xAF, 0xC9, 0x70, 0x79, 0xA4, 0xA9, 0x70, 0xAC, 0x3A, 0xC9, 0x70, 0x9F,
+    0xE7, 0x2A, 0xFA, 0x75, 0x99, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xE4, 0xAF, 0x99, 0x09,
+    0x9A, 0xD3, 0xAE, 0x97, 0x39, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x76, 0xDA, 0x75, 0x9D, 0x97,
+    0x5A, 0xD5, 0x9F, 0xD1, 0xE5, 0xAF, 0xD1, 0xE5, 0x99, 0x99, 0xE1, 0xE7, 0x1D, 0xA1, 0xE7, 0x09,
+    0xD9, 0x1A, 0xD7, 0x09, 0xD2, 0x9D, 0xA7, 0xAD, 0x3E, 0x96, 0xDA, 0x39, 0xEA, 0x49, 0xD9, 0x49,
+    0xFF, 0xE7, 0xAF, 0xEA, 0x97, 0x29, 0x97, 0x00, 0x59, 0xA4, 0x9A, 0x79, 0xC9, 0x29, 0xCA, 0x70,
+    0xFE, 0x71, 0x9F, 0xC7, 0x49, 0x97, 0x77, 0x49, 0xAD, 0xA2, 0xAA, 0x5F, 0xE0, 0x9D, 0x4F, 0x99,
+    0x9F, 0xA3, 0xAD, 0xA3, 0x9E, 0x93, 0xE5, 0xE3, 0xAD, 0x6E, 0x3E, 0x6E, 0x3D, 0xA6, 0xDA, 0x29,
+    0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0xAD, 0x3A, 0xD6, 0xE3, 0xAD, 0x5A, 0xDA, 0x39, 0xD4, 0xAE, 0x94,
+    0xE2, 0xAC, 0xAD, 0x94, 0xAF, 0xDA, 0x9D, 0x6A, 0xF9, 0x0A, 0xD7, 0x09, 0x3D, 0xA7, 0x5D, 0x97,
+    0x4A, 0xD7, 0x5D, 0xA4, 0x9C, 0xA9, 0x2A, 0xE5, 0x9F, 0xFC, 0x79, 0xAF, 0xC9, 0x70, 0x73, 0x97,
+    0x7E, 0x76, 0xDA, 0x76, 0xAA, 0x77, 0x77, 0x77, 0x9A, 0xFD, 0xA9, 0x59, 0xFF, 0xE4, 0xAF, 0x99,
+    0x09, 0x9A, 0xD3, 0xAE, 0x97, 0x39, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x76, 0xDA, 0x75, 0x9D,
+    0x97, 0x5A, 0xD5, 0x9F, 0xD1, 0xE5, 0xAF, 0xD1, 0xE5, 0x99, 0x99, 0xE1, 0xE7, 0x1D, 0xA1, 0xE7,
+    0x09, 0xD9, 0x1A, 0xD7, 0x09, 0xD2, 0x9D, 0xA7, 0xAD, 0x3E, 0x96, 0xDA, 0x39, 0xEA, 0x49, 0xD9,
+    0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x97, 0x29, 0x97, 0x00, 0x71, 0x99, 0x75, 0xAD, 0x75, 0xE7, 0x59,
+    0xA9, 0x77, 0x77, 0x74, 0x9A, 0xDA, 0x2A, 0xA5, 0xFE, 0x09, 0xD4, 0xF9, 0x99, 0xFA, 0x3A, 0xDA,
+    0x39, 0xE9, 0x3E, 0x5E, 0x3A, 0xD6, 0xE3, 0xE6, 0xE3, 0xDA, 0x6D, 0xA2, 0x9D, 0x95, 0x9D, 0x92,
+    0xAD, 0x6A, 0xD3, 0xAD, 0x6E, 0x3A, 0xD5, 0xAD, 0xA3, 0x9D, 0x4A, 0xE9, 0x4E, 0x2A, 0xCA, 0xD9,
+    0x4A, 0xFD, 0xA9, 0xD6, 0xAF, 0x90, 0xAD, 0x70, 0x93, 0xDA, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xDA,
+    0x49, 0xCA, 0x92, 0xAE, 0x59, 0xFF, 0xC7, 0x9A, 0xFC, 0x97, 0x77, 0x70, 0x9A, 0xFD, 0xA9, 0x59,
+    0xFF, 0xE4, 0xAF, 0x99, 0x09, 0x9A, 0xD3, 0xAE, 0x97, 0x39, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E,
+    0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD5, 0x9F, 0xD1, 0xE5, 0xAF, 0xD1, 0xE5, 0x99, 0x99, 0xE1,
+    0xE7, 0x1D, 0xA1, 0xE7, 0x09, 0xD9, 0x1A, 0xD7, 0x09, 0xD2, 0x9D, 0xA7, 0xAD, 0x3E, 0x96, 0xDA,
+    0x39, 0xEA, 0x49, 0xD9, 0x49, 0xFF, 0xE7, 0xAF, 0xEA, 0x97, 0x29, 0x97, 0x77, 0x70, 0xAD, 0x76,
+    0xD7, 0x6A, 0xCA, 0x76, 0xCA, 0x77, 0x97, 0x30, 0x73, 0x97, 0x6D, 0x75, 0xAC, 0x97, 0x49, 0xD7,
+    0x5D, 0xA7, 0x59, 0x97, 0x77, 0x49, 0xAD, 0xA2, 0xAA, 0x5F, 0xE0, 0x9D, 0x4F, 0x99, 0x9F, 0xA3,
+    0xAD, 0xA3, 0x9E, 0x93, 0xE5, 0xE3, 0xAD, 0x6E, 0x3E, 0x6E, 0x3D, 0xA6, 0xDA, 0x29, 0xD9, 0x59,
+    0xD9, 0x2A, 0xD6, 0xAD, 0x3A, 0xD6, 0xE3, 0xAD, 0x5A, 0xDA, 0x39, 0xD4, 0xAE, 0x94, 0xE2, 0xAC,
+    0xAD, 0x94, 0xAF, 0xDA, 0x9D, 0x6A, 0xF9, 0x0A, 0xD7, 0x09, 0x3D, 0xA7, 0x5D, 0x97, 0x4A, 0xD7,
+    0x5D, 0xA4, 0x9C, 0xA9, 0x2A, 0xE5, 0x9F, 0xFC, 0x79, 0xAF, 0xC9, 0x70, 0x72, 0x99, 0x97, 0x69,
+    0xE7, 0x6F, 0xC7, 0x4D, 0x90, 0xD9, 0x71, 0x9D, 0x3D, 0x72, 0x95, 0x97, 0x77, 0x19, 0xD7, 0x0A,
+    0xCA, 0x3A, 0xD7, 0x0D, 0xA3, 0xDA, 0x70, 0xD9, 0x3D, 0xA7, 0x9D, 0x92, 0x9D, 0x97, 0xAD, 0x3A,
+    0xD7, 0x0A, 0xD3, 0xAD, 0x70, 0xDA, 0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3, 0x9F, 0xFF, 0xD3,
+    0xAF, 0xFF, 0xD3, 0xE9, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3,
+    0x9D, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xE7, 0x0D, 0xA3, 0xDA, 0x79, 0xD9, 0x29, 0xD9, 0x79,
+    0xD3, 0x9D, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0x69, 0x97, 0x4E, 0x97, 0x2F, 0xC7, 0x1D, 0xA0,
+    0xDA, 0x7D, 0x92, 0xD7, 0x95, 0x97, 0x77, 0x77, 0x1A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9,
+    0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x1A, 0xE9, 0x5D, 0x99, 0xFD, 0xA3, 0x9D, 0x9D, 0x99, 0x9E,
+    0x3A, 0xEA, 0x39, 0xD3, 0xF4, 0x9D, 0x3E, 0x59, 0xD3, 0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A,
+    0xD6, 0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6,
+    0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x20, 0x39, 0xD7, 0x0A, 0xCA, 0x5A, 0xD7, 0x0D, 0xA5,
+    0xDA, 0x70, 0xD9, 0x29, 0x99, 0xDA, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0x90, 0xFF, 0xFF, 0xEA,
+    0x0F, 0xFF, 0xFE, 0x92, 0xE7, 0x0D, 0xA5, 0xDA, 0x70, 0xD9, 0x5D, 0x97, 0x9D, 0x59, 0xFF, 0xFD,
+    0x5A, 0xFF, 0xFD, 0x5E, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA5, 0xDA, 0x79, 0xD9, 0x5D, 0x97, 0x9D,
+    0x59, 0xD7, 0x0A, 0xD5, 0xAD, 0x70, 0xDA, 0x5D, 0xA7, 0x0D, 0xA5, 0xDA, 0x79, 0xD9, 0x49, 0xD9,
+    0x7A, 0xD5, 0x9D, 0x70, 0xAD, 0x5A, 0xD7, 0x0D, 0xA5, 0x77, 0x4A, 0xD7, 0x4D, 0xA7, 0x2A, 0xAE,
+    0xAA, 0xAA, 0x59, 0xFF, 0xC6, 0x9A, 0xD9, 0x99, 0x99, 0x7A, 0xD7, 0x4D, 0xA1, 0x9A, 0xAA, 0x6D,
+    0x90, 0xFD, 0x93, 0x9D, 0x9D, 0xA9, 0xAE, 0x3A, 0xF3, 0xAD, 0x3A, 0xE4, 0x9D, 0x3E, 0x59, 0xD3,
+    0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2D, 0xA5, 0x9D, 0x92, 0xDA, 0x59, 0xD3,
+    0xD9, 0x5A, 0xD2, 0x9D, 0x6D, 0xA2, 0xAD, 0x6D, 0x92, 0xDA, 0x59, 0xD3, 0xD9, 0x5A, 0xD2, 0x59,
+    0x94, 0x95, 0xAE, 0xA1, 0x9C, 0x93, 0x9F, 0xFC, 0x4D, 0x2A, 0xE5, 0x95, 0x97, 0x76, 0xFE, 0x69,
+    0xFD, 0xA7, 0x09, 0xD9, 0x72, 0xAD, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD,
+    0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD9,
+    0x72, 0xAD, 0x73, 0xAD, 0x71, 0xAF, 0xCA, 0x69, 0xFE, 0x60, 0x29, 0x94, 0x92, 0xAE, 0xA1, 0xAC,
+    0x19, 0xFF, 0xC1, 0xD2, 0xF2, 0x95, 0x97, 0x72, 0xAA, 0x97, 0x0D, 0x97, 0x9D, 0x97, 0xAD, 0x70,
+    0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7,
+    0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x4A, 0xFE, 0x5F, 0xF5, 0x99, 0x99, 0x99, 0x99, 0x77, 0x3F,
+    0xE5, 0x9F, 0xDA, 0x79, 0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72,
+    0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x70, 0xAF, 0xCA, 0x59, 0xFE, 0x50, 0x1A, 0xFD, 0xA2, 0xFF, 0x29,
+    0x99, 0x99, 0x99, 0x77, 0x0A, 0xA9, 0x7D, 0x96, 0x9D, 0x96, 0xAD, 0x7A, 0xD7, 0xDA, 0x7D, 0x96,
+    0x9D, 0x7A, 0xD7, 0xE7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0x96, 0x49, 0x94, 0xA9,
+    0x4A, 0xC3, 0xAC, 0x94, 0x9F, 0xDA, 0x6A, 0xFA, 0x71, 0x99, 0x77, 0x6F, 0xE5, 0x9F, 0xDA, 0x79,
+    0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0x9D, 0x72, 0xAD, 0x72, 0xE7, 0x2D,
+    0xA7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72,
+    0xAD, 0x70, 0xAF, 0xCA, 0x59, 0xFE, 0x50, 0x19, 0x94, 0xA9, 0x1D, 0x3A, 0xC2, 0xAF, 0xDA, 0x3A,
+    0xFA, 0x69, 0x97, 0x72, 0xAA, 0x97, 0xD9, 0x69, 0xD9, 0x6A, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x69,
+    0xD7, 0xAD, 0x7E, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x60, 0x4F, 0xE4, 0x9F,
+    0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71,
+    0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70,
+    0xAD, 0x71, 0xAD, 0x7A, 0xFC, 0xA4, 0x9F, 0xE7, 0x9C, 0xA7, 0x0A, 0xCA, 0x71, 0xD7, 0x1A, 0xCA,
+    0x71, 0xAD, 0x99, 0x70, 0xEA, 0x71, 0x99, 0x70, 0x69, 0x6E, 0x5E, 0x5A, 0xA7, 0x77, 0xAA, 0x95,
+    0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5E, 0x5D, 0xA5, 0xD9,
+    0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x5A, 0xC9, 0x4D, 0x5A, 0xC9, 0x5D, 0x6D, 0xA9, 0x49, 0xE6,
+    0x99, 0x40, 0x70, 0x97, 0x2D, 0xA7, 0x1D, 0xA7, 0x1A, 0xA7, 0x77, 0x71, 0xFE, 0x49, 0xFD, 0xA6,
+    0x9D, 0x97, 0x0A, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1E, 0x71,
+    0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x97, 0x0A, 0xD7,
+    0x1A, 0xD7, 0xAF, 0xCA, 0x49, 0xFE, 0x40, 0x3A, 0xA9, 0x3D, 0x92, 0x9D, 0x92, 0xAD, 0x3A, 0xD3,
+    0xDA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xE3, 0xDA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xDA, 0x3D, 0x92,
+    0x4F, 0xE3, 0xD9, 0x39, 0xFD, 0xA3, 0xD9, 0x59, 0xD9, 0x49, 0xD6, 0xAD, 0x5A, 0xD6, 0xAD, 0x5E,
+    0x6D, 0xA5, 0xDA, 0x6D, 0x94, 0x9D, 0x95, 0x9D, 0x59, 0xD6, 0xAD, 0x5A, 0xD6, 0xE5, 0xDA, 0x6D,
+    0xA5, 0xDA, 0x6D, 0x94, 0x9D, 0x95, 0x9D, 0x5A, 0xD6, 0xAD, 0x5E, 0x6D, 0xA5, 0xDA, 0x6D, 0x95,
+    0xD9, 0x59, 0xD9, 0x49, 0xD6, 0xAD, 0x5A, 0xD6, 0xAD, 0x5E, 0x4A, 0xFC, 0xA3, 0xDA, 0x39, 0xFE,
+    0x29, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x6A, 0xD9, 0x72, 0xFE, 0x73, 0xFC, 0xA7, 0x49, 0xAA, 0x97,
+    0x00, 0x59, 0x59, 0x95, 0xE3, 0x9D, 0x94, 0xE3, 0xAD, 0x94, 0xAA, 0x5A, 0x97, 0x77, 0x74, 0xAA,
+    0x93, 0x9A, 0xA5, 0xD9, 0x3A, 0xD4, 0x9D, 0x93, 0xE4, 0xAD, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xDA,
+    0x39, 0xD5, 0xD9, 0x3A, 0xD4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xE3, 0x9D, 0x94, 0xDA, 0x39,
+    0xD5, 0xD9, 0x3A, 0xD4, 0x9D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xDA, 0x39, 0xD5, 0xD9, 0x3A, 0xD7,
+    0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x3A, 0xD7, 0x19, 0x09, 0xDA, 0x71, 0xFC, 0x72, 0xEA, 0x70,
+    0x73, 0x99, 0x75, 0xE9, 0x73, 0xFC, 0x72, 0xDA, 0x0D, 0xA7, 0x0D, 0x92, 0xD7, 0x09, 0x59, 0x77,
+    0x73, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5A, 0xD7, 0x5D,
+    0xA7, 0x5D, 0x97, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A,
+    0xD7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x49, 0xD9, 0x73,
+    0x9E, 0x70, 0x9F, 0xD9, 0x70, 0xAF, 0xC9, 0x72, 0x9A, 0x99, 0x73, 0x70, 0x99, 0x97, 0x29, 0xE7,
+    0x19, 0xFA, 0x79, 0xD9, 0x0D, 0x69, 0xD2, 0x9D, 0x59, 0x95, 0x97, 0x77, 0xAA, 0x97, 0x3D, 0x97,
+    0x29, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3E, 0x73,
+    0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0x9D, 0x97, 0x29, 0xD7,
+    0x3A, 0xD7, 0x3D, 0xA7, 0x2E, 0x70, 0xAF, 0xA7, 0x0A, 0xE9, 0x71, 0x39, 0xD6, 0x9D, 0x93, 0xAD,
+    0x59, 0xDA, 0x4D, 0xA4, 0x9D, 0xA5, 0xD9, 0x39, 0xDA, 0x59, 0xD9, 0x29, 0xDA, 0x6A, 0xD2, 0x9D,
+    0xA7, 0xAD, 0x19, 0xDA, 0x70, 0xDA, 0x09, 0xDA, 0x71, 0xD9, 0x9D, 0xA7, 0x19, 0xD9, 0xE7, 0x2A,
+    0xFD, 0x97, 0x1F, 0x9E, 0x71, 0xE1, 0x9D, 0x97, 0x0D, 0x92, 0xDA, 0x79, 0xD3, 0xAD, 0x7A, 0xD4,
+    0xDA, 0x6D, 0xA4, 0xE6, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x5E, 0x49, 0xD6, 0xAD, 0x4A, 0xD7, 0xDA,
+    0x77, 0x77, 0x74, 0xD9, 0x75, 0xAD, 0x76, 0xD7, 0x6A, 0xC9, 0x76, 0x99, 0x74, 0x77, 0x4A, 0xD7,
+    0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x4A, 0xAA, 0x4D, 0x93,
+    0xE4, 0x9D, 0x3E, 0x5A, 0xD2, 0xE6, 0xE1, 0xAD, 0x7D, 0xA0, 0xAD, 0x70, 0xD9, 0xAD, 0x70, 0x9D,
+    0xAE, 0x70, 0xAF, 0xD9, 0x7E, 0xA0, 0xDA, 0x7D, 0xA1, 0xAD, 0x69, 0xD9, 0x2D, 0xA5, 0x9D, 0x3A,
+    0xD5, 0xAD, 0x4D, 0xA4, 0xDA, 0x4A, 0xD4, 0xD9, 0x49, 0xDA, 0x77, 0x77, 0x7D, 0xA7, 0x39, 0xD7,
+    0x4D, 0x97, 0x39, 0xCA, 0x74, 0x99, 0x72, 0x3A, 0xA9, 0x4A, 0xAA, 0x4D, 0x93, 0xE4, 0x9D, 0x3E,
+    0x5A, 0xD2, 0xAD, 0x6E, 0x1A, 0xD7, 0xDA, 0x0A, 0xD7, 0x0D, 0x9A, 0xD7, 0x09, 0xDA, 0xE7, 0x0A,
+    0xFD, 0x97, 0xEA, 0x0D, 0xA7, 0xDA, 0x1A, 0xD6, 0x9D, 0x92, 0xDA, 0x59, 0xD3, 0xAD, 0x5A, 0xD4,
+    0xDA, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0x9D, 0xA2, 0x70, 0x99, 0x70, 0xE7, 0xE7, 0xAD, 0x79, 0xD7,
+    0x19, 0x77, 0x49, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70,
+    0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7,
+    0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xD0, 0xAF, 0xFD, 0x00, 0x70,
+    0x99, 0x97, 0xAD, 0x96, 0x9D, 0x97, 0xD9, 0x7D, 0x97, 0x09, 0x77, 0x77, 0x1A, 0xD7, 0x0D, 0xA7,
+    0x0D, 0xA7, 0x9D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E,
+    0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0x97, 0x9D, 0x70,
+    0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0x39, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97,
+    0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xDA, 0x70, 0xD9,
+    0x79, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xD0,
+    0xAF, 0xFD, 0x77, 0x74, 0xDA, 0x79, 0xD7, 0x0D, 0x97, 0x9C, 0xA7, 0x09, 0x97, 0x77, 0x1A, 0xD7,
+    0xDA, 0x7D, 0xA6, 0x9D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xE7, 0xDA,
+    0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0xA6, 0x9D, 0x96, 0x9D, 0x7A, 0xD7, 0xDA, 0x7D, 0x97,
+    0x77, 0x5D, 0x96, 0xAC, 0xA7, 0xD7, 0xAC, 0x97, 0x99, 0x70, 0x39, 0xD3, 0x9D, 0x4A, 0xD3, 0xDA,
+    0x4D, 0xA2, 0x9D, 0x5D, 0x92, 0xD5, 0x9D, 0x91, 0x9C, 0x95, 0xAD, 0x73, 0xAD, 0x73, 0xDA, 0x73,
+    0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D,
+    0xA7, 0x3D, 0xA7, 0x29, 0xDA, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFD, 0x3A, 0xFF, 0xD3, 0x77, 0x1A,
+    0xD1, 0xDA, 0x4D, 0xA0, 0x9D, 0x5D, 0xA0, 0xD9, 0x49, 0xD9, 0x9C, 0xA5, 0x9D, 0x09, 0x96, 0xAD,
+    0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7,
+    0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9,
+    0x70, 0x39, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA,
+    0x70, 0xD9, 0x79, 0xD4, 0x92, 0xAD, 0x3D, 0xA1, 0xE3, 0xDA, 0x1D, 0xA3, 0xAA, 0x2D, 0x97, 0x9D,
+    0x70, 0xAD, 0x70, 0xDA, 0x70, 0xDA, 0x79, 0xDA, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFD, 0x0A, 0xFF,
+    0xD0, 0x77, 0xAD, 0x7D, 0xA7, 0xDA, 0x69, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x69, 0xD7,
+    0xAD, 0x19, 0x93, 0xE0, 0xAD, 0x3D, 0xA0, 0xE3, 0xD9, 0x09, 0xA9, 0x29, 0xD7, 0xAD, 0x7D, 0xA7,
+    0xDA, 0x69, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0xD9, 0x60, 0x49, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x90, 0xAC, 0x59, 0xDA, 0xE5,
+    0xAF, 0xA5, 0x9E, 0xA6, 0xAE, 0xA6, 0x9F, 0x97, 0x99, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0xA7,
+    0x09, 0xDA, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFD, 0x1A, 0xFF, 0xD0, 0x75, 0xAD, 0x5D, 0xA5, 0xDA,
+    0x49, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD9, 0x93, 0xAF, 0x3F, 0xC2, 0x9E, 0x92,
+    0xF9, 0x2A, 0xF4, 0x9A, 0xD5, 0xE5, 0xDA, 0x49, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x40,
+    0x76, 0x99, 0x77, 0x0E, 0x77, 0xE7, 0x7A, 0xD7, 0x79, 0xCA, 0x77, 0x09, 0x97, 0x77, 0x69, 0xD9,
+    0x70, 0xAC, 0xA3, 0xAE, 0x70, 0xD9, 0x3F, 0x70, 0xD9, 0x3F, 0xA6, 0x9D, 0x39, 0xDA, 0xD6, 0xAD,
+    0x3A, 0xD0, 0xD9, 0x5D, 0xA3, 0xDA, 0x0D, 0xA5, 0xD9, 0x3D, 0x90, 0x9D, 0x49, 0xD4, 0xD9, 0x1D,
+    0x93, 0x9D, 0x39, 0xD2, 0xAD, 0x3A, 0xD3, 0xAD, 0x29, 0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x2D, 0x93,
+    0xD9, 0x3A, 0xD1, 0x9D, 0x4D, 0x5D, 0x90, 0xAD, 0x39, 0xD5, 0xDA, 0x0A, 0xCA, 0x3A, 0xD5, 0x9D,
+    0x0D, 0xA3, 0xDA, 0x6D, 0x9D, 0x93, 0xD9, 0x6A, 0xF3, 0x9D, 0x79, 0xF3, 0xAD, 0x70, 0xEA, 0x3A,
+    0xCA, 0x70, 0xAD, 0x93, 0x73, 0x99, 0x97, 0x4E, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xCA, 0x74, 0x99,
+    0x77, 0x70, 0xAA, 0x2A, 0xEA, 0x5D, 0x09, 0xFD, 0xA3, 0x9D, 0x9D, 0xA9, 0x9E, 0x3A, 0xF3, 0xAD,
+    0x92, 0xF4, 0x9D, 0x92, 0xE5, 0xAD, 0x29, 0xDA, 0x5E, 0x29, 0xD9, 0x5E, 0x2A, 0xD6, 0xDA, 0x2E,
+    0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x29, 0xD9, 0x5E, 0x2A, 0xD6, 0xDA, 0x2E, 0x59, 0xDA, 0x2E, 0x59,
+    0xD9, 0x2D, 0xA5, 0xAD, 0x20, 0x39, 0xD9, 0x70, 0xAC, 0xA3, 0xAE, 0x70, 0xD9, 0x3F, 0x70, 0xD9,
+    0x3F, 0xA6, 0x9D, 0x39, 0xDA, 0xD6, 0xAD, 0x3A, 0xD0, 0xD9, 0x5D, 0xA3, 0xDA, 0x0D, 0xA5, 0xD9,
+    0x3D, 0x90, 0x9D, 0x49, 0xD4, 0xD9, 0x1D, 0x93, 0x9D, 0x39, 0xD2, 0xAD, 0x3A, 0xD3, 0xAD, 0x29,
+    0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x2D, 0x93, 0xD9, 0x3A, 0xD1, 0x9D, 0x4D, 0x5D, 0x90, 0xAD, 0x39,
+    0xD5, 0xDA, 0x0A, 0xCA, 0x3A, 0xD5, 0x9D, 0x0D, 0xA3, 0xDA, 0x6D, 0x9D, 0x93, 0xD9, 0x6A, 0xF3,
+    0x9D, 0x79, 0xF3, 0xAD, 0x70, 0xEA, 0x3A, 0xCA, 0x70, 0xAD, 0x97, 0x77, 0x77, 0x71, 0xAD, 0x77,
+    0x0D, 0x97, 0x7A, 0xCA, 0x77, 0x0D, 0x77, 0x19, 0x75, 0x77, 0x3A, 0xA2, 0xAE, 0xA5, 0xD0, 0x9F,
+    0xDA, 0x39, 0xD9, 0xDA, 0x99, 0xE3, 0xAF, 0x3A, 0xD9, 0x2F, 0x49, 0xD9, 0x2E, 0x5A, 0xD2, 0x9D,
+    0xA5, 0xE2, 0x9D, 0x95, 0xE2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD2, 0x9D, 0x95,
+    0xE2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD7, 0x77, 0x77, 0x9D,
+    0x74, 0xD9, 0x73, 0x9C, 0xA7, 0x4D, 0x75, 0x97, 0x20, 0x70, 0x95, 0x99, 0x72, 0xD9, 0x2D, 0x97,
+    0x3D, 0x09, 0xD9, 0x74, 0xAF, 0x97, 0x6E, 0x97, 0x70, 0x99, 0x77, 0x75, 0x9D, 0x97, 0x0A, 0xCA,
+    0x3A, 0xE7, 0x0D, 0x93, 0xF7, 0x0D, 0x93, 0xFA, 0x69, 0xD3, 0x9D, 0xAD, 0x6A, 0xD3, 0xAD, 0x0D,
+    0x95, 0xDA, 0x3D, 0xA0, 0xDA, 0x5D, 0x93, 0xD9, 0x09, 0xD4, 0x9D, 0x4D, 0x91, 0xD9, 0x39, 0xD3,
+    0x9D, 0x2A, 0xD3, 0xAD, 0x3A, 0xD2, 0x9D, 0x3D, 0xA3, 0xDA, 0x3D, 0xA2, 0xD9, 0x3D, 0x93, 0xAD,
+    0x19, 0xD4, 0xD5, 0xD9, 0x0A, 0xD3, 0x9D, 0x5D, 0xA0, 0xAC, 0xA3, 0xAD, 0x59, 0xD0, 0xDA, 0x3D,
+    0xA6, 0xD9, 0xD9, 0x3D, 0x96, 0xAF, 0x39, 0xD7, 0x9F, 0x3A, 0xD7, 0x0E, 0xA3, 0xAC, 0xA7, 0x0A,
+    0xD9, 0x30, 0x69, 0x59, 0x96, 0xD9, 0x2D, 0x97, 0xD0, 0x9D, 0x97, 0x0A, 0xF9, 0x72, 0xE9, 0x73,
+    0x99, 0x97, 0x77, 0xAA, 0x2A, 0xEA, 0x5D, 0x09, 0xFD, 0xA3, 0x9D, 0x9D, 0xA9, 0x9E, 0x3A, 0xF3,
+    0xAD, 0x92, 0xF4, 0x9D, 0x92, 0xE5, 0xAD, 0x29, 0xDA, 0x5E, 0x29, 0xD9, 0x5E, 0x2A, 0xD6, 0xDA,
+    0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x29, 0xD9, 0x5E, 0x2A, 0xD6, 0xDA, 0x2E, 0x59, 0xDA, 0x2E,
+    0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x20, 0x2E, 0x74, 0x9D, 0xA7, 0x4E, 0x75, 0xD9, 0x74, 0xAD, 0x75,
+    0xD9, 0x0A, 0xA9, 0x1A, 0xEA, 0x19, 0xCA, 0x1D, 0x90, 0xFE, 0x19, 0x2D, 0xAD, 0xA9, 0x9E, 0x93,
+    0x9F, 0x4D, 0xA3, 0xAE, 0x5D, 0xA3, 0xEA, 0x49, 0xD9, 0x3E, 0x59, 0xD9, 0x3D, 0xA5, 0xAD, 0x39,
+    0xD9, 0x5E, 0x3A, 0xD6, 0xDA, 0x3E, 0x59, 0xD9, 0x3D, 0xA5, 0xAD, 0x39, 0xD9, 0x5E, 0x39, 0xD9,
+    0x5E, 0x3A, 0xD6, 0xDA, 0x3E, 0x59, 0xD9, 0x10, 0x39, 0xD9, 0x70, 0xAC, 0xA3, 0xAE, 0x70, 0xD9,
+    0x3F, 0x70, 0xD9, 0x3F, 0xA6, 0x9D, 0x39, 0xDA, 0xD6, 0xAD, 0x3A, 0xD0, 0xD9, 0x5D, 0xA3, 0xDA,
+    0x0D, 0xA5, 0xD9, 0x3D, 0x90, 0x9D, 0x49, 0xD4, 0xD2, 0xD9, 0x3A, 0xD3, 0x9D, 0x2A, 0xD3, 0xAD,
+    0x3A, 0xD2, 0x9D, 0x3D, 0xA3, 0xDA, 0x3D, 0xA2, 0xD9, 0x3D, 0x93, 0x9D, 0x19, 0xD4, 0xD5, 0xD9,
+    0x0A, 0xD3, 0x9D, 0x5A, 0xCA, 0x0A, 0xCA, 0x3A, 0xD5, 0x9D, 0x0D, 0xA3, 0xDA, 0x6D, 0xAD, 0x93,
+    0xD9, 0x6A, 0xF3, 0x9D, 0x70, 0xF3, 0xAD, 0x70, 0xEA, 0x3A, 0xCA, 0x70, 0x9D, 0x97, 0x79, 0xD7,
+    0x70, 0xE7, 0x7A, 0xD9, 0x73, 0xFE, 0x74, 0xFC, 0xA7, 0x59, 0x9A, 0x97, 0x00, 0x3A, 0xA2, 0xAE,
+    0x95, 0xD0, 0x9F, 0xDA, 0x39, 0xD9, 0xD9, 0x99, 0xE3, 0xAE, 0xA3, 0x9D, 0x3A, 0xE4, 0x9D, 0x3E,
+    0x59, 0xD3, 0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5,
+    0xAD, 0x3D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD,
+    0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x3A, 0xD7, 0x19, 0x09, 0xDA, 0x71, 0xFC, 0x72, 0xEA, 0x50,
+    0x7A, 0xFD, 0xA7, 0x2F, 0xEA, 0x72, 0x99, 0x99, 0x99, 0x97, 0x77, 0x5A, 0xFC, 0xA9, 0x70, 0xAF,
+    0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E, 0x3A, 0xDA, 0x79, 0xDA, 0x2E, 0x71, 0xE1, 0xAD,
+    0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72, 0xAD, 0x0A, 0xD9, 0x72, 0xAD, 0x0A, 0xD7, 0x3E,
+    0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7, 0x1A, 0xDA,
+    0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A, 0xEA, 0x5A, 0xFF, 0xD9, 0x70, 0xAF,
+    0xDA, 0x75, 0x99, 0x71, 0x4A, 0xFD, 0xA6, 0xFF, 0x69, 0x99, 0x99, 0x99, 0x77, 0x69, 0xAD, 0xA9,
+    0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1,
+    0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09,
+    0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x7A,
+    0x94, 0xA7, 0x2D, 0x3D, 0x72, 0xAF, 0xDA, 0x73, 0xFC, 0xA7, 0x69, 0x97, 0x77, 0x7A, 0xFC, 0xA9,
+    0x70, 0xAF, 0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E, 0x3A, 0xDA, 0x79, 0xDA, 0x2E, 0x71,
+    0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72, 0xAD, 0x0A, 0xD9, 0x72, 0xAD, 0x0A,
+    0xD7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7,
+    0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A, 0xEA, 0x5A, 0xFF, 0xD9,
+    0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x4A, 0x94, 0xA9, 0x5D, 0x3A, 0xC6, 0xAF, 0xDA, 0x7A, 0xFA,
+    0x72, 0x99, 0x77, 0x70, 0x9A, 0xDA, 0x97, 0xAF, 0xE5, 0xEA, 0x99, 0xAE, 0x3A, 0xD9, 0x39, 0xDA,
+    0x19, 0xDA, 0x5E, 0x1A, 0xD6, 0xAD, 0x1D, 0xA6, 0xAD, 0x09, 0xD9, 0x6A, 0xD0, 0x9D, 0x7E, 0x0A,
+    0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0x9D, 0x6E, 0x19, 0xDA, 0x49, 0xD9, 0x2E, 0x92, 0xAD, 0xA4,
+    0xFF, 0xA6, 0xAF, 0xC9, 0x77, 0x30, 0x73, 0x99, 0x29, 0x97, 0x3D, 0xA1, 0xDA, 0x72, 0xDA, 0x1D,
+    0xA7, 0x2A, 0xCA, 0x1A, 0xCA, 0x72, 0x9C, 0xA1, 0x9C, 0xA7, 0x49, 0x29, 0x77, 0x77, 0x0A, 0xFC,
+    0xA9, 0x71, 0xAF, 0xFC, 0xA7, 0xF9, 0x19, 0xAE, 0xA5, 0xEA, 0x6E, 0x4A, 0xDA, 0x79, 0xDA, 0x3E,
+    0x71, 0xE2, 0xAD, 0x97, 0x1E, 0x2E, 0x72, 0xAD, 0x19, 0xDA, 0x72, 0xAD, 0x1A, 0xD9, 0x72, 0xAD,
+    0x1A, 0xD7, 0x3E, 0x1E, 0x73, 0xE1, 0xE7, 0x29, 0xDA, 0x1E, 0x72, 0xAD, 0x91, 0xE7, 0x2E, 0x2A,
+    0xD7, 0x1A, 0xDA, 0x29, 0xDA, 0x70, 0xE4, 0xE9, 0x59, 0xE9, 0x49, 0xEA, 0x3A, 0xEA, 0x6A, 0xFF,
+    0xD9, 0x71, 0xAF, 0xDA, 0x76, 0x99, 0x72, 0x70, 0x99, 0x29, 0x97, 0x0D, 0xA1, 0xDA, 0x7A, 0xD1,
+    0xDA, 0x79, 0xD1, 0xAC, 0xA7, 0x9C, 0xA1, 0x9C, 0xA7, 0x19, 0x39, 0x77, 0x72, 0x9A, 0xDA, 0x97,
+    0x1A, 0xFE, 0x7E, 0xA9, 0x9A, 0xE5, 0xAD, 0x93, 0x9D, 0xA3, 0x9D, 0xA5, 0xE3, 0xAD, 0x6A, 0xD3,
+    0xDA, 0x6A, 0xD2, 0x9D, 0x96, 0xAD, 0x29, 0xD7, 0xE2, 0xAD, 0x7D, 0xA2, 0xAD, 0x69, 0xD9, 0x29,
+    0xD6, 0xE3, 0x9D, 0xA4, 0x9D, 0x94, 0xE9, 0x2A, 0xDA, 0x6F, 0xFA, 0x70, 0xAF, 0xC9, 0x77, 0x70,
+    0x77, 0x77, 0xAF, 0xFF, 0xF5, 0xAF, 0xFF, 0xFD, 0x4F, 0x92, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x3E,
+    0xA5, 0xDA, 0x72, 0xAD, 0xA5, 0x9D, 0x97, 0x2E, 0x6A, 0xD7, 0x2A, 0xD9, 0x6A, 0xD7, 0x2E, 0x7D,
+    0xA7, 0x19, 0xDA, 0x7D, 0x97, 0x1A, 0xD9, 0x69, 0xFF, 0xCA, 0x2A, 0xD7, 0xAF, 0xFC, 0xA2, 0xE7,
+    0xE9, 0x99, 0x99, 0x99, 0x3E, 0x7D, 0xA7, 0x2E, 0x7D, 0x97, 0x2E, 0x69, 0xD7, 0x3A, 0xD6, 0xAD,
+    0x73, 0x9D, 0xA5, 0xE7, 0x4E, 0x94, 0xDA, 0x74, 0x9E, 0xA2, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0x6A,
+    0xFF, 0xFF, 0xC7, 0x0A, 0xFF, 0xFE, 0x73, 0x99, 0x77, 0x5A, 0xEA, 0x49, 0xAE, 0x95, 0xAF, 0xE9,
+    0x1F, 0xEA, 0x3E, 0xA9, 0x9A, 0xE0, 0xEA, 0x99, 0xE2, 0xAD, 0x94, 0xFC, 0x4D, 0x91, 0xDA, 0x5A,
+    0xE5, 0xD9, 0x0A, 0xD6, 0xAD, 0xA4, 0xAD, 0x1D, 0xA6, 0xAD, 0x39, 0xE9, 0x09, 0xD9, 0x6A, 0xFF,
+    0xC9, 0x19, 0xD7, 0xFF, 0xA3, 0xAD, 0x7E, 0x71, 0xAD, 0x69, 0xDA, 0x71, 0x9D, 0x6A, 0xE7, 0x19,
+    0xD9, 0x49, 0xF7, 0x2E, 0x92, 0xAD, 0xAE, 0x39, 0xA9, 0x3F, 0xFA, 0x0A, 0xFF, 0x94, 0xAF, 0xC9,
+    0x29, 0xFD, 0xA7, 0x72, 0x99, 0x50, 0x73, 0x99, 0x97, 0x39, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x3A,
+    0xCA, 0x74, 0x99, 0x77, 0x70, 0x9F, 0xDA, 0x96, 0xAF, 0xFC, 0x5E, 0x99, 0x9A, 0xF4, 0xDA, 0x4A,
+    0xD9, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xAD, 0x6D, 0xA2, 0xDA, 0x59, 0xD9, 0x2D, 0x95,
+    0xE2, 0x9D, 0x49, 0xE9, 0x2A, 0xFF, 0xD9, 0x3F, 0xFC, 0x95, 0xDA, 0x99, 0x9D, 0xA6, 0xD9, 0x2A,
+    0xD5, 0x9D, 0x39, 0xD9, 0x4A, 0xD4, 0xE4, 0xDA, 0x4A, 0xD4, 0xDA, 0x5D, 0xA2, 0x9D, 0x95, 0xE2,
+    0x9D, 0x6A, 0xD9, 0x1A, 0xD7, 0xDA, 0x10, 0x72, 0x99, 0x72, 0xE7, 0x1A, 0xD7, 0x19, 0xD7, 0x19,
+    0xD7, 0x39, 0x77, 0x6A, 0xA2, 0xAD, 0x94, 0xD0, 0x9F, 0x49, 0xD9, 0xDA, 0x9A, 0x4A, 0xEA, 0x70,
+    0xAE, 0x71, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x19,
+    0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0xA7, 0x10, 0x39, 0xFD, 0xA9, 0x6A, 0xFF, 0xC5, 0xE9, 0x99,
+    0xAF, 0x4D, 0xA4, 0xAD, 0x92, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2A, 0xD6, 0xDA, 0x2D, 0xA5,
+    0x9D, 0x92, 0xD9, 0x5E, 0x29, 0xD4, 0x9E, 0x92, 0xAF, 0xFD, 0x93, 0xFF, 0xC9, 0x5D, 0xA9, 0x99,
+    0xDA, 0x6D, 0x92, 0xAD, 0x59, 0xD3, 0x9D, 0x94, 0xAD, 0x4E, 0x4D, 0xA4, 0xAD, 0x4D, 0xA5, 0xDA,
+    0x29, 0xD9, 0x5E, 0x29, 0xD6, 0xAD, 0x91, 0xAD, 0x7D, 0xA7, 0x77, 0x76, 0xD9, 0x73, 0x9D, 0x74,
+    0xD7, 0x4A, 0xC9, 0x74, 0x99, 0x72, 0x4A, 0xA2, 0xAD, 0x94, 0xD0, 0x9F, 0x49, 0xD9, 0xDA, 0x9A,
+    0x4A, 0xEA, 0x70, 0xAE, 0x71, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7,
+    0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0xA7, 0x2D, 0xA7, 0x77, 0x76, 0xD9, 0x71, 0xAD, 0x72,
+    0xD7, 0x2A, 0xC9, 0x72, 0x99, 0x73, 0x69, 0x59, 0x96, 0xD9, 0x2D, 0x97, 0xD0, 0x9D, 0x97, 0x0A,
+    0xF9, 0x72, 0xE9, 0x73, 0x99, 0x97, 0x77, 0x9F, 0xDA, 0x96, 0xAF, 0xFC, 0x5E, 0x99, 0x9A, 0xF4,
+    0xDA, 0x4A, 0xD9, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xAD, 0x6D, 0xA2, 0xDA, 0x59, 0xD9,
+    0x2D, 0x95, 0xE2, 0x9D, 0x49, 0xE9, 0x2A, 0xFF, 0xD9, 0x3F, 0xFC, 0x95, 0xDA, 0x99, 0x9D, 0xA6,
+    0xD9, 0x2A, 0xD5, 0x9D, 0x39, 0xD9, 0x4A, 0xD4, 0xE4, 0xDA, 0x4A, 0xD4, 0xDA, 0x5D, 0xA2, 0x9D,
+    0x95, 0xE2, 0x9D, 0x6A, 0xD9, 0x1A, 0xD7, 0xDA, 0x10, 0x49, 0x94, 0x99, 0x5A, 0xC9, 0x2A, 0xCA,
+    0x6D, 0x90, 0xDA, 0x79, 0xFA, 0x71, 0xEA, 0x73, 0x99, 0x77, 0x7A, 0xA2, 0xAD, 0x95, 0xD0, 0x9F,
+    0x59, 0xD9, 0xDA, 0x9A, 0x5A, 0xEA, 0x71, 0xAE, 0x72, 0xE7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD,
+    0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0xA7, 0x20, 0x73,
+    0x99, 0x97, 0x3A, 0xD9, 0x72, 0x9D, 0xA7, 0x3D, 0xA7, 0x3D, 0x97, 0x49, 0x77, 0x73, 0x9F, 0xDA,
+    0x6F, 0xFD, 0x4F, 0x91, 0x9A, 0xCA, 0x39, 0xDA, 0x73, 0xE7, 0x4E, 0x74, 0xE7, 0x4A, 0xD9, 0x73,
+    0x9E, 0x97, 0x39, 0xF7, 0x39, 0xFA, 0x73, 0xAE, 0xA7, 0x39, 0xE9, 0x74, 0xE7, 0x4E, 0x74, 0xAD,
+    0x74, 0xE7, 0x3A, 0xDA, 0x29, 0xC9, 0x39, 0xAE, 0x39, 0xFF, 0xD5, 0xAF, 0xEA, 0x71, 0x99, 0x71,
+    0x71, 0x99, 0x97, 0x0E, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x0D, 0x97, 0x19, 0x77, 0x59, 0xAE, 0xA9,
+    0x4A, 0xFF, 0x2A, 0xDA, 0x90, 0x9A, 0xC9, 0x2E, 0x71, 0xDA, 0x71, 0xE7, 0x19, 0xE9, 0x70, 0xAE,
+    0xA7, 0x09, 0xF7, 0x1A, 0xE7, 0x19, 0xD9, 0x71, 0xDA, 0x71, 0xD9, 0x1A, 0x94, 0xE2, 0xFF, 0xCA,
+    0x29, 0xFE, 0x96, 0x99, 0x70, 0x71, 0x99, 0x74, 0xE9, 0x72, 0xFC, 0x71, 0xDA, 0x0A, 0xCA, 0x7D,
+    0x92, 0xD9, 0x69, 0x59, 0x77, 0x79, 0xFD, 0xA6, 0xFF, 0xD4, 0xF9, 0x19, 0xAC, 0xA3, 0x9D, 0xA7,
+    0x3E, 0x74, 0xE7, 0x4E, 0x74, 0xAD, 0x97, 0x39, 0xE9, 0x73, 0x9F, 0x73, 0x9F, 0xA7, 0x3A, 0xEA,
+    0x73, 0x9E, 0x97, 0x4E, 0x74, 0xE7, 0x4A, 0xD7, 0x4E, 0x73, 0xAD, 0xA2, 0x9C, 0x93, 0x9A, 0xE3,
+    0x9F, 0xFD, 0x5A, 0xFE, 0xA7, 0x19, 0x97, 0x10, 0x69, 0x99, 0x70, 0x9E, 0x70, 0xFC, 0x6D, 0x90,
+    0xD9, 0x39, 0xD3, 0xD4, 0x95, 0x97, 0x71, 0x9A, 0xEA, 0x94, 0xAF, 0xF2, 0xAD, 0xA9, 0x09, 0xAC,
+    0x92, 0xE7, 0x1D, 0xA7, 0x1E, 0x71, 0x9E, 0x97, 0x0A, 0xEA, 0x70, 0x9F, 0x71, 0xAE, 0x71, 0x9D,
+    0x97, 0x1D, 0xA7, 0x1D, 0x91, 0xA9, 0x4E, 0x2F, 0xFC, 0xA2, 0x9F, 0xE9, 0x69, 0x97, 0x77, 0x59,
+    0xFD, 0xA6, 0xFF, 0xD4, 0xF9, 0x19, 0xAC, 0xA3, 0x9D, 0xA7, 0x3E, 0x74, 0xE7, 0x4E, 0x74, 0xAD,
+    0x97, 0x39, 0xE9, 0x73, 0x9F, 0x73, 0x9F, 0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x4E, 0x74, 0xE7,
+    0x4A, 0xD7, 0x4E, 0x73, 0xAD, 0xA2, 0x9C, 0x93, 0x9A, 0xE3, 0x9F, 0xFD, 0x5A, 0xFE, 0xA7, 0x19,
+    0xCA, 0x74, 0xAC, 0x97, 0x4A, 0xD9, 0x74, 0x9D, 0x74, 0x9D, 0x71, 0x9A, 0xAD, 0x97, 0x1A, 0xDA,
+    0x97, 0x00, 0x39, 0xAE, 0xA9, 0x4A, 0xFF, 0x2A, 0xDA, 0x90, 0x9A, 0xC9, 0x2E, 0x71, 0xDA, 0x71,
+    0xE7, 0x19, 0xE9, 0x70, 0xAE, 0xA7, 0x09, 0xF7, 0x1A, 0xE7, 0x19, 0xD9, 0x71, 0xDA, 0x71, 0xD9,
+    0x1A, 0x94, 0xE2, 0xFF, 0xCA, 0x29, 0xFE, 0x96, 0x9C, 0xA7, 0x1A, 0xC7, 0x2A, 0xD9, 0x71, 0x9D,
+    0x71, 0x9C, 0xA6, 0x9A, 0xAD, 0x96, 0xAD, 0xA9, 0x60, 0x69, 0x59, 0x7D, 0x29, 0xD7, 0xAD, 0x0A,
+    0xD7, 0x1F, 0xC7, 0x29, 0xE7, 0x49, 0x97, 0x77, 0x29, 0xFD, 0xA6, 0xFF, 0xD4, 0xF9, 0x19, 0xAC,
+    0xA3, 0x9D, 0xA7, 0x3E, 0x74, 0xE7, 0x4E, 0x74, 0xAD, 0x97, 0x39, 0xE9, 0x73, 0x9F, 0x73, 0x9F,
+    0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x4E, 0x74, 0xE7, 0x4A, 0xD7, 0x4E, 0x73, 0xAD, 0xA2, 0x9C,
+    0x93, 0x9A, 0xE3, 0x9F, 0xFD, 0x5A, 0xFE, 0xA7, 0x19, 0x97, 0x10, 0x49, 0x59, 0x49, 0xCA, 0x2A,
+    0xD5, 0xAC, 0xA0, 0xDA, 0x7F, 0xA7, 0x0A, 0xE7, 0x29, 0x97, 0x76, 0x9A, 0xEA, 0x95, 0xAF, 0xF3,
+    0xAD, 0xA9, 0x09, 0xAC, 0x93, 0xE7, 0x2D, 0xA7, 0x2E, 0x72, 0x9E, 0x97, 0x1A, 0xEA, 0x71, 0x9F,
+    0x72, 0xAE, 0x72, 0x9D, 0x97, 0x2D, 0xA7, 0x2D, 0x92, 0xA9, 0x4E, 0x3F, 0xFC, 0xA3, 0x9F, 0xE9,
+    0x79, 0x97, 0x00, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x96, 0xE7,
+    0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x4E, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97,
+    0x39, 0xD7, 0x5C, 0xA7, 0x4A, 0xC7, 0x5A, 0xD9, 0x74, 0x9D, 0x74, 0x9C, 0xA7, 0x19, 0xAA, 0xD9,
+    0x71, 0xAD, 0xA9, 0x72, 0x77, 0x9C, 0x97, 0xD7, 0xAD, 0x59, 0xAE, 0xAA, 0xA9, 0x0A, 0xFF, 0x91,
+    0x9A, 0xD9, 0x99, 0x93, 0xAD, 0x7E, 0x7D, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7E, 0x7D, 0xA7, 0xD9,
+    0x69, 0xD9, 0x69, 0xD9, 0x7F, 0xD4, 0x9F, 0xC5, 0xAC, 0x97, 0xD7, 0x9E, 0x70, 0xD9, 0x7D, 0x94,
+    0xAA, 0xE5, 0xEA, 0x50, 0x49, 0x59, 0x96, 0xD3, 0xD9, 0x69, 0xD0, 0x9D, 0x97, 0x0A, 0xF9, 0x72,
+    0xE9, 0x73, 0x99, 0x97, 0x76, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0x99, 0x99, 0x9E, 0x99, 0x99, 0x99,
+    0x6E, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9,
+    0x73, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xDA, 0x74,
+    0xD9, 0x73, 0x9D, 0x72, 0x77, 0x4D, 0xA7, 0x0D, 0x70, 0xAC, 0x94, 0x9C, 0x99, 0xCA, 0x5D, 0x09,
+    0x95, 0xAD, 0x69, 0xAE, 0xAA, 0xA9, 0x1A, 0xFF, 0x92, 0x9A, 0xD9, 0x99, 0x94, 0xAD, 0x70, 0xE7,
+    0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAD, 0x70, 0xE7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x97, 0x9D,
+    0x97, 0x0F, 0xD5, 0x9F, 0xC7, 0x09, 0x60, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0xE9,
+    0x99, 0x99, 0x96, 0xE7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x70, 0xAA,
+    0xAA, 0xEA, 0xAA, 0x93, 0x9F, 0xFD, 0x94, 0x99, 0x9E, 0x99, 0x99, 0x70, 0xE7, 0x4D, 0xA7, 0x4D,
+    0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x72, 0x77, 0x9C, 0x97,
+    0xD7, 0xAD, 0x59, 0xAE, 0xAA, 0xA9, 0x0A, 0xFF, 0x91, 0x9A, 0xD9, 0x99, 0x93, 0xAD, 0x7E, 0x7D,
+    0xA5, 0xFF, 0x19, 0xFE, 0xA3, 0xAD, 0x7E, 0x7D, 0xA7, 0xD9, 0x69, 0xD9, 0x69, 0xD9, 0x7F, 0xD4,
+    0x9F, 0xC7, 0x94, 0x70, 0x94, 0x99, 0x70, 0xAF, 0x19, 0xC9, 0x70, 0xDA, 0xFD, 0x70, 0xAC, 0x2A,
+    0xE9, 0x70, 0x95, 0x97, 0x77, 0x2A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2,
+    0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D,
+    0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29,
+    0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79,
+    0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x20,
+    0x69, 0x94, 0x96, 0xF9, 0x1D, 0x5D, 0xAF, 0xD9, 0x5C, 0xA1, 0x9E, 0xA6, 0x94, 0x97, 0x76, 0xAA,
+    0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D,
+    0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9,
+    0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D, 0xA2, 0xAC, 0xAD, 0x93, 0xFE, 0xA0,
+    0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x69, 0xFE, 0x72, 0xFF, 0x72, 0x99, 0x99, 0x99, 0x99, 0x77,
+    0x71, 0xAC, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xE3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x1D, 0x92, 0xAD,
+    0x70, 0x9D, 0x3E, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x09, 0xD9,
+    0x2A, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x97, 0x0D, 0x92, 0x9D,
+    0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xD3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x9D, 0x93, 0x9D, 0x96, 0xE5,
+    0xEA, 0x3A, 0xE6, 0x9F, 0xFD, 0x97, 0x9F, 0xEA, 0x75, 0x99, 0x72, 0x5F, 0xEA, 0x69, 0xFE, 0xA7,
+    0x99, 0x99, 0x99, 0x97, 0x75, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A,
+    0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5,
+    0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D,
+    0xA2, 0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x69, 0xA4, 0xA9, 0x71,
+    0xAC, 0x92, 0xAC, 0x97, 0x19, 0xFE, 0x73, 0xAF, 0xC7, 0x69, 0x97, 0x77, 0x4A, 0xCA, 0x70, 0xAD,
+    0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A,
+    0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D,
+    0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70,
+    0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF,
+    0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x20, 0x5A, 0x49, 0xA7, 0xCA, 0x3D, 0x7F, 0xE9, 0x70, 0xFC,
+    0x97, 0x39, 0x77, 0x70, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6,
+    0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D,
+    0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D, 0xA2,
+    0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x70, 0x9A, 0xCA, 0x75, 0x9D,
+    0xAD, 0x74, 0xD1, 0x9C, 0x97, 0x3C, 0xA2, 0xC9, 0x73, 0xAC, 0x90, 0xAC, 0x75, 0xF9, 0x77, 0x97,
+    0x77, 0x4A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71, 0xD9, 0x2A,
+    0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70, 0x9D,
+    0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70, 0xD9, 0x29,
+    0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39, 0xD9, 0x6E,
+    0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x20, 0x7A, 0xCA, 0x97, 0x2D,
+    0xAD, 0x97, 0x09, 0xC9, 0x1D, 0x70, 0x9C, 0x2A, 0xC7, 0x1C, 0xA0, 0x9C, 0xA7, 0x1A, 0xF7, 0x49,
+    0x77, 0x70, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D,
+    0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA,
+    0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D, 0xA2, 0xAC, 0xAD,
+    0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x72, 0x99, 0x29, 0x97, 0x2A, 0xD1, 0xE7,
+    0x19, 0xD1, 0x9D, 0x72, 0xD1, 0x9D, 0x72, 0xD2, 0xD7, 0x39, 0x39, 0x77, 0x72, 0xAC, 0xA7, 0x0A,
+    0xD3, 0xDA, 0x70, 0xE3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x1D, 0x92, 0xAD, 0x70, 0x9D, 0x3E, 0x70,
+    0xAD, 0x3D, 0xA7, 0x0D, 0xA3, 0xD9, 0x70, 0xDA, 0x29, 0xD7, 0x09, 0xD9, 0x2A, 0xD7, 0x0A, 0xD3,
+    0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x97, 0x0D, 0x92, 0x9D, 0x70, 0x9D, 0x3A, 0xD7,
+    0x0A, 0xD3, 0xAD, 0x70, 0xDA, 0x3A, 0xD7, 0x9D, 0x93, 0x9D, 0x96, 0xE5, 0xEA, 0x3A, 0xE6, 0x9F,
+    0xFD, 0x97, 0x9F, 0xEA, 0x75, 0x99, 0x72, 0x70, 0x99, 0x91, 0x99, 0x97, 0x9D, 0x90, 0x9D, 0x97,
+    0xDA, 0x1D, 0x97, 0xAC, 0xA1, 0xD9, 0x7A, 0xC9, 0x1A, 0xC9, 0x70, 0x93, 0x97, 0x77, 0x0A, 0xA9,
+    0x59, 0xAA, 0x39, 0xD9, 0x5A, 0xD3, 0x9D, 0x6D, 0xA3, 0xAD, 0x6D, 0x93, 0xDA, 0x59, 0xD4, 0xD9,
+    0x5A, 0xD3, 0x9D, 0x95, 0xDA, 0x3A, 0xD6, 0xDA, 0x3E, 0x59, 0xD9, 0x3D, 0xA5, 0xAD, 0x4D, 0x95,
+    0xE3, 0x9D, 0x94, 0xAD, 0xA3, 0x9D, 0x49, 0xE9, 0x39, 0xDA, 0x2A, 0xCA, 0xD9, 0x4F, 0xEA, 0x0D,
+    0x6F, 0xC9, 0x09, 0xD7, 0x09, 0x73, 0x2A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D,
+    0xA2, 0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97,
+    0x0D, 0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA,
+    0x29, 0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD,
+    0x79, 0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x49, 0xD9,
+    0x76, 0xD7, 0x7D, 0x97, 0x7D, 0x77, 0x0D, 0xA9, 0x76, 0xAE, 0x77, 0x09, 0x97, 0x20, 0x2A, 0xA9,
+    0x59, 0xAA, 0x29, 0xD9, 0x5A, 0xD2, 0x9D, 0x6D, 0xA2, 0xAD, 0x6D, 0x92, 0xDA, 0x59, 0xD3, 0xD9,
+    0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6, 0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95,
+    0xE2, 0x9D, 0x94, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x29, 0xDA, 0x2A, 0xCA, 0xD9, 0x3F, 0xEA, 0x0D,
+    0x5F, 0xC9, 0x09, 0xD7, 0x93, 0xD7, 0x39, 0xCA, 0x74, 0xD7, 0x49, 0xD7, 0x49, 0xD9, 0x97, 0x3F,
+    0x75, 0x95, 0x73, 0x99, 0x77, 0x5A, 0xE7, 0x73, 0xAF, 0x97, 0x71, 0xAD, 0x09, 0xD7, 0x70, 0xAC,
+    0xA2, 0x9C, 0xA7, 0x79, 0x94, 0x99, 0x77, 0x77, 0x0A, 0xCA, 0x7D, 0xA6, 0x9D, 0x9D, 0xA6, 0xAD,
+    0xA6, 0xE0, 0xE6, 0xEA, 0x59, 0xD9, 0x0A, 0xD5, 0xAF, 0x5A, 0xD1, 0xAD, 0x5D, 0xAD, 0x5D, 0xA1,
+    0xAD, 0x4A, 0xD9, 0xD4, 0xAD, 0x2A, 0xD4, 0xD9, 0x9D, 0x4D, 0xA2, 0xAD, 0x39, 0xD1, 0xD3, 0x9D,
+    0x3A, 0xD3, 0xD9, 0x1D, 0x3D, 0xA3, 0x9D, 0x29, 0xD2, 0xD2, 0x9D, 0x93, 0x9D, 0x2D, 0xA2, 0xD2,
+    0xAD, 0x49, 0xD1, 0x9D, 0x3D, 0x2D, 0x94, 0x9D, 0x1D, 0xA3, 0xD1, 0xAD, 0x59, 0xD1, 0xD4, 0xD9,
+    0x0D, 0x95, 0x9D, 0x0A, 0xCA, 0x4D, 0x99, 0xD7, 0xD0, 0xD5, 0xD9, 0xDA, 0x7D, 0x9D, 0x5D, 0x9D,
+    0x70, 0xF9, 0x5F, 0xA7, 0x0F, 0x6A, 0xE7, 0x1E, 0x96, 0xAD, 0xA7, 0x1E, 0x7A, 0xD9, 0x70, 0x72,
+    0x99, 0x77, 0x2E, 0xA7, 0x70, 0xFC, 0x77, 0xDA, 0x0A, 0xCA, 0x75, 0xD9, 0x2D, 0x97, 0x49, 0x59,
+    0x77, 0x75, 0xAA, 0x59, 0xAA, 0x59, 0xAA, 0x09, 0xD5, 0xE9, 0x4D, 0xA0, 0x9D, 0x4A, 0xE9, 0x39,
+    0xD2, 0xD9, 0x3D, 0xAC, 0x93, 0xE2, 0xD9, 0x2A, 0xCA, 0xAC, 0x92, 0x9D, 0x92, 0xD9, 0x2D, 0x0A,
+    0xC9, 0x2E, 0x3D, 0x91, 0x9D, 0x0A, 0xCA, 0x2D, 0x93, 0xD9, 0x1D, 0x90, 0xAC, 0xA1, 0xAD, 0x4D,
+    0x90, 0x9D, 0x1A, 0xCA, 0x1D, 0x94, 0xD9, 0x0D, 0x91, 0x9C, 0xA0, 0xAD, 0x5D, 0x99, 0xD2, 0x9C,
+    0xA0, 0xDA, 0x5D, 0x9A, 0xC9, 0x29, 0xCA, 0x9D, 0x6D, 0x9D, 0x39, 0xCA, 0xAC, 0xA6, 0xFA, 0x39,
+    0xF7, 0xF5, 0xEA, 0x7A, 0xDA, 0x5E, 0x70, 0x79, 0x97, 0x4A, 0xE7, 0x2A, 0xF9, 0x70, 0xAD, 0x09,
+    0xD7, 0xAC, 0xA2, 0xAC, 0xA6, 0x99, 0x49, 0x97, 0x73, 0xD9, 0x7A, 0xD1, 0xDA, 0x69, 0xDA, 0x1A,
+    0xD6, 0xE2, 0x9D, 0x5A, 0xD9, 0x3D, 0x94, 0xDA, 0x4D, 0xA3, 0xE5, 0xAD, 0x2A, 0xD6, 0x9D, 0x2D,
+    0xA7, 0xD9, 0x0E, 0x70, 0xDA, 0xAD, 0x71, 0xAF, 0x97, 0x19, 0xF7, 0x3E, 0x74, 0xDA, 0x74, 0xD9,
+    0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x20, 0x72, 0x99,
+    0x77, 0xEA, 0x75, 0xFC, 0x74, 0xDA, 0x0A, 0xCA, 0x72, 0xD9, 0x2D, 0x97, 0x19, 0x59, 0x77, 0x72,
+    0x9A, 0xA7, 0xAA, 0xA4, 0x9D, 0x69, 0xD9, 0x49, 0xD9, 0x5E, 0x6D, 0x94, 0x9D, 0x96, 0xDA, 0x4E,
+    0x7D, 0xA3, 0x9D, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD2, 0xAD, 0x71, 0x9D, 0x2D, 0xA7, 0x2D, 0x1A,
+    0xD7, 0x3D, 0x1D, 0xA7, 0x3D, 0x9A, 0xD7, 0x4D, 0x9D, 0x97, 0x4A, 0xF7, 0x59, 0xE9, 0x75, 0x9E,
+    0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x6A, 0xD7, 0x69, 0xDA, 0x75, 0x9E, 0x73, 0xAF, 0xC7, 0x4A, 0xEA,
+    0x75, 0x59, 0x75, 0xDA, 0x1A, 0xD7, 0xDA, 0x1E, 0x79, 0xA3, 0xA7, 0x77, 0x74, 0xD9, 0x7A, 0xD1,
+    0xDA, 0x69, 0xDA, 0x1A, 0xD6, 0xE2, 0x9D, 0x5A, 0xD9, 0x3D, 0x94, 0xDA, 0x4D, 0xA3, 0xE5, 0xAD,
+    0x2A, 0xD6, 0x9D, 0x2D, 0xA7, 0xD9, 0x0E, 0x70, 0xDA, 0xAD, 0x71, 0xAF, 0x97, 0x19, 0xF7, 0x3E,
+    0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x20, 0x75, 0x99, 0x76, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0x76, 0xD7, 0x79, 0x77, 0x74, 0xAF,
+    0xFE, 0xA4, 0xFF, 0xF9, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x49,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x5E, 0x75, 0xE7, 0x5E, 0x97, 0x4A, 0xD9,
+    0x74, 0x9D, 0xA7, 0x5E, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x4F,
+    0xFF, 0xC4, 0xFF, 0xFC, 0x30, 0x72, 0x99, 0x97, 0x29, 0xE7, 0x2E, 0x72, 0xAD, 0x72, 0xAC, 0xA7,
+    0x39, 0x97, 0x77, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFC, 0xA4, 0x99, 0x99, 0x99, 0xE9, 0x71,
+    0x9D, 0xA7, 0x2D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0x97, 0x2D, 0xA7, 0x2E, 0x72,
+    0xE7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xFF, 0xD3, 0x9F, 0xFD, 0x30, 0x73, 0x97, 0x7E, 0x76, 0xDA,
+    0x76, 0xAA, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0xA4, 0xFF, 0xF9, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xE7,
+    0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x49, 0xE7, 0x5E, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9D, 0xA7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x97, 0x4A, 0xD9, 0x74, 0x9D, 0xA7, 0x5E, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0xAD,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC, 0x30, 0x70, 0x99, 0x72, 0x9D, 0x97,
+    0x1A, 0xD9, 0x72, 0xAA, 0x77, 0x77, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xCA, 0x39, 0x99,
+    0x99, 0x9E, 0x97, 0x09, 0xDA, 0x71, 0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x09, 0xD9, 0x71,
+    0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1F, 0xFD, 0x29, 0xFF, 0xD2, 0x79, 0x95,
+    0x97, 0x09, 0xCA, 0x2A, 0xCA, 0x71, 0xD9, 0x0D, 0xA7, 0x29, 0xFA, 0x74, 0xAD, 0xA7, 0x69, 0x97,
+    0x77, 0x3A, 0xFF, 0xEA, 0x4F, 0xFF, 0x94, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x75, 0xAD, 0x97, 0x49,
+    0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xE9,
+    0x74, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x4A, 0xDA, 0x99, 0x99, 0x99,
+    0x99, 0x94, 0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x59, 0x59, 0x95, 0xD9, 0x2D, 0x96, 0xD0, 0x9D, 0x97,
+    0xAF, 0x97, 0x1E, 0x97, 0x29, 0x99, 0x77, 0x69, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0xFF, 0xCA, 0x49,
+    0x99, 0x99, 0x9E, 0x97, 0x19, 0xDA, 0x72, 0xDA, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x97, 0x19, 0xD9,
+    0x72, 0xDA, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2F, 0xFD, 0x39, 0xFF, 0xD3, 0x74,
+    0x99, 0x73, 0x9F, 0xC9, 0x70, 0x9F, 0xD7, 0x1E, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xDA,
+    0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7,
+    0x5E, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD9,
+    0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x39, 0xE7, 0x2A, 0xF9, 0x72, 0xAE, 0x97, 0x30, 0x77, 0x77,
+    0x71, 0xAD, 0x7A, 0xFC, 0xA4, 0xE5, 0xAF, 0xFC, 0xA1, 0x9D, 0x94, 0xF9, 0x19, 0xAE, 0xA9, 0xDA,
+    0x4E, 0xA6, 0xFC, 0x94, 0xAD, 0xA7, 0x9D, 0xA6, 0xE7, 0x1E, 0x5A, 0xD9, 0x71, 0xE5, 0xE7, 0x2A,
+    0xD4, 0x9D, 0xA7, 0x2A, 0xD4, 0xAD, 0x97, 0x2A, 0xD4, 0xAD, 0x73, 0xE4, 0xE7, 0x3E, 0x4E, 0x72,
+    0x9D, 0xA4, 0xE7, 0x2A, 0xD9, 0x4E, 0x72, 0xE5, 0xAD, 0x71, 0xAD, 0xA5, 0x9D, 0xA7, 0x0E, 0x7E,
+    0x95, 0x9E, 0x97, 0x9E, 0xA3, 0xAE, 0xA7, 0x1A, 0xFF, 0xD9, 0x74, 0xAF, 0xDA, 0x77, 0x19, 0x97,
+    0x50, 0x77, 0x77, 0x1A, 0xD9, 0x76, 0xE5, 0x9A, 0xDA, 0x92, 0x9D, 0xA4, 0xAF, 0xE9, 0x0E, 0x4E,
+    0xA9, 0x9A, 0xFC, 0xA4, 0xAD, 0x93, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD6, 0xAD, 0x5D, 0xA6, 0xAD,
+    0x49, 0xD9, 0x6A, 0xD4, 0x9D, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0x94, 0x9D, 0x6E, 0x59,
+    0xDA, 0x49, 0xD9, 0x6E, 0x92, 0xAD, 0xA7, 0x0F, 0xFA, 0x72, 0xAF, 0xC9, 0x77, 0x73, 0x77, 0x77,
+    0x1A, 0xFC, 0xA3, 0x9A, 0xFA, 0x6A, 0xFF, 0xC9, 0x0A, 0xFE, 0xA4, 0xF9, 0x19, 0xAF, 0xD9, 0x19,
+    0xE3, 0xEA, 0x59, 0xEA, 0x49, 0xD9, 0x1A, 0xDA, 0x7A, 0xD9, 0x5D, 0xA1, 0xE7, 0x09, 0xDA, 0x5D,
+    0x90, 0xAD, 0x97, 0x1D, 0xA4, 0x9D, 0x90, 0xE7, 0x2E, 0x49, 0xD0, 0x9D, 0xA7, 0x2E, 0x4A, 0xD0,
+    0xAD, 0x97, 0x2E, 0x4D, 0xA0, 0xAD, 0x73, 0xDA, 0x4D, 0x90, 0xE7, 0x29, 0xDA, 0x39, 0xD9, 0x0E,
+    0x72, 0xAD, 0x93, 0xAD, 0x1E, 0x72, 0xE4, 0xE1, 0xE7, 0x19, 0xDA, 0x4D, 0xA1, 0xAD, 0x71, 0xE9,
+    0x4D, 0x91, 0x9D, 0xA7, 0x9E, 0x49, 0xD3, 0xE9, 0x59, 0xE5, 0xAD, 0x39, 0xEA, 0x29, 0xAE, 0x95,
+    0xE4, 0xAF, 0xFD, 0x96, 0xDA, 0x6A, 0xFD, 0xA7, 0x0D, 0x97, 0x19, 0x97, 0x71, 0x49, 0xAD, 0xA9,
+    0x29, 0xAD, 0xA5, 0xAF, 0xE0, 0xAF, 0xD3, 0xEA, 0x99, 0xAF, 0xA9, 0x9A, 0xD9, 0x1A, 0xD9, 0x3A,
+    0xD9, 0x3D, 0xA0, 0x9D, 0xA5, 0xD9, 0x3D, 0xA0, 0xAD, 0x6D, 0xA3, 0xD9, 0x0D, 0xA6, 0xDA, 0x29,
+    0xD9, 0x9D, 0x96, 0xDA, 0x29, 0xD0, 0x9D, 0x7D, 0x92, 0xAD, 0x0A, 0xD6, 0x9D, 0x3D, 0xA0, 0xAD,
+    0x6E, 0x3D, 0x90, 0x9D, 0x6D, 0x92, 0x9D, 0x19, 0xD9, 0x4E, 0x3A, 0xD2, 0xE9, 0x2E, 0x93, 0xE3,
+    0xFF, 0x94, 0xDA, 0x4F, 0xCA, 0x6D, 0x97, 0x70, 0x9D, 0x77, 0x1A, 0xD7, 0x71, 0xE7, 0x71, 0xDA,
+    0x77, 0x09, 0xD9, 0x77, 0x09, 0xD7, 0x71, 0xAD, 0x30, 0x19, 0xAF, 0xFA, 0x93, 0xAF, 0xFF, 0xC1,
+    0x9D, 0xA9, 0xE9, 0x99, 0xAF, 0x0A, 0xD1, 0xDA, 0x4A, 0xD9, 0xAC, 0xA1, 0xD9, 0x5D, 0xA0, 0x99,
+    0x09, 0xD9, 0x5D, 0xA3, 0xAD, 0x6D, 0xA3, 0xE6, 0xDA, 0x3D, 0xA5, 0xAD, 0x4D, 0x94, 0xAD, 0xA3,
+    0x9D, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xCA, 0x5F, 0xEA, 0x97, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75,
+    0xAD, 0x75, 0xDA, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x40, 0x70, 0x97, 0x5A, 0xE9, 0x72,
+    0xAF, 0x97, 0x2D, 0xA7, 0x49, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x1A, 0xDA, 0x7D, 0x99,
+    0xFD, 0x94, 0x9D, 0x9D, 0x99, 0xAE, 0x4A, 0xEA, 0x3A, 0xD9, 0x3A, 0xE4, 0x9D, 0x93, 0xE6, 0xD9,
+    0x3D, 0xA6, 0xD9, 0x29, 0xD9, 0x59, 0xD9, 0x2A, 0xD6, 0xAD, 0x3E, 0x6E, 0x3D, 0xA6, 0xDA, 0x3D,
+    0xA5, 0xAD, 0x39, 0xE4, 0x9D, 0xA3, 0xAE, 0xA2, 0x9E, 0x4D, 0xAA, 0xFE, 0x5D, 0x90, 0xAF, 0xA5,
+    0x9D, 0x92, 0x99, 0x79, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x50,
+    0x39, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3F, 0xEA, 0x59, 0xFF, 0xC9, 0x3A, 0xD9, 0x99, 0x9A, 0xE9,
+    0x2A, 0xD4, 0x9D, 0xA2, 0xDA, 0x5E, 0x2D, 0x95, 0xAD, 0x19, 0xD6, 0xE1, 0xAD, 0x6D, 0xA1, 0xE5,
+    0xAD, 0x91, 0xDA, 0x39, 0xEA, 0x2F, 0xFD, 0xA2, 0x9F, 0xFA, 0x4A, 0xD9, 0x99, 0xAD, 0x5D, 0xA3,
+    0xD9, 0x4D, 0x93, 0xE3, 0x9D, 0x93, 0x9D, 0x39, 0xD5, 0xDA, 0x2A, 0xD5, 0xE7, 0x39, 0xD9, 0x73,
+    0xDA, 0x73, 0xAD, 0x10, 0x77, 0x49, 0xAF, 0xCA, 0x69, 0xFF, 0xC6, 0xCA, 0x99, 0x09, 0xF7, 0x4E,
+    0x74, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0xE7, 0x3A, 0xDA, 0x71, 0x9F, 0x70, 0xAF, 0xC6, 0x9F, 0xD9,
+    0x6F, 0xCA, 0x97, 0xF9, 0x71, 0xEA, 0x73, 0xDA, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0xA7,
+    0x4E, 0xA3, 0x9A, 0xC4, 0x9F, 0xFD, 0x6A, 0xFE, 0x97, 0x19, 0x97, 0x39, 0xAE, 0xA9, 0x4F, 0xFA,
+    0x3A, 0xCA, 0x90, 0x9E, 0x72, 0xD9, 0x71, 0xD9, 0x70, 0xAD, 0x7A, 0xEA, 0x4A, 0xFC, 0xA3, 0xAF,
+    0xC9, 0x4F, 0x96, 0x9D, 0xA7, 0x0A, 0xD7, 0x1A, 0xD7, 0x19, 0xDA, 0x39, 0xA3, 0xFF, 0xC4, 0xAF,
+    0xDA, 0x79, 0x95, 0x49, 0xFF, 0xEA, 0x4A, 0xFF, 0xE9, 0x4E, 0x99, 0xAA, 0xAA, 0xAA, 0xA5, 0x9D,
+    0x97, 0x6E, 0x76, 0x9D, 0x77, 0xDA, 0x76, 0xAD, 0x77, 0xDA, 0x76, 0xAD, 0x76, 0xDA, 0x75, 0xAD,
+    0x75, 0xAD, 0x75, 0x9D, 0x97, 0x5D, 0x97, 0x5D, 0xA7, 0x5E, 0x75, 0xAD, 0x75, 0xAD, 0xA9, 0x99,
+    0x99, 0x99, 0x99, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC, 0x30, 0x29, 0x99, 0x29, 0xFC, 0x1E, 0xAD, 0xA9,
+    0xD1, 0xAD, 0x9D, 0x90, 0xE0, 0xFD, 0xA1, 0xFC, 0x93, 0x9D, 0x4A, 0xD4, 0xE4, 0xDA, 0x4D, 0x93,
+    0x9D, 0x4A, 0xD4, 0xDA, 0x4D, 0x93, 0x9D, 0x93, 0xAD, 0x4A, 0xD4, 0xDA, 0x4D, 0x93, 0x9D, 0x4A,
+    0xD4, 0xE4, 0xDA, 0x4D, 0x93, 0x9D, 0x94, 0xDA, 0x19, 0x1F, 0xD2, 0xAE, 0xA0, 0x75, 0x9C, 0x96,
+    0xD6, 0xAD, 0x49, 0xAE, 0xAA, 0xA9, 0xAF, 0xF9, 0x09, 0xAD, 0x99, 0x99, 0x2A, 0xD6, 0xE6, 0xDA,
+    0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xE6, 0xDA, 0x6D, 0x95, 0x9D, 0x95, 0x9D, 0x96, 0xFD, 0x39, 0xFA,
+    0x6D, 0x96, 0xD9, 0x59, 0xD6, 0xAD, 0x59, 0xDA, 0x39, 0xF4, 0x9E, 0x94, 0x19, 0xAF, 0xFF, 0x1A,
+    0xFF, 0xFD, 0x09, 0xE9, 0x99, 0xEA, 0x99, 0x99, 0x90, 0xAD, 0x3A, 0xD6, 0xAC, 0xA3, 0xDA, 0x79,
+    0x93, 0xD9, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD,
+    0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xDA, 0x74, 0x9D,
+    0x97, 0x10, 0x69, 0x96, 0xAF, 0x93, 0x9F, 0xC9, 0x3E, 0x7D, 0x96, 0x9D, 0x7A, 0xD5, 0x9A, 0xEA,
+    0xAA, 0x90, 0xAF, 0xF9, 0x19, 0xAD, 0x99, 0x99, 0x3A, 0xD7, 0xE7, 0xDA, 0x7D, 0x96, 0x9D, 0x7A,
+    0xD7, 0xE7, 0xDA, 0x7D, 0x96, 0x9D, 0x96, 0x9D, 0x97, 0xFD, 0x49, 0xFC, 0x79, 0x50, 0x0F, 0xFF,
+    0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x96, 0xE7, 0x4D, 0xA7, 0x39, 0xD9, 0x73,
+    0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xDA, 0x74,
+    0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74,
+    0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x4E, 0x99, 0x72, 0xFC, 0x73, 0xAE, 0x70, 0x77, 0x77, 0x73, 0xAD,
+    0x3A, 0xCA, 0x70, 0xAD, 0x1E, 0x3D, 0xA7, 0x0E, 0x09, 0xD9, 0x3D, 0x97, 0x0D, 0xA9, 0xDA, 0x39,
+    0xD7, 0x1F, 0xC9, 0x4A, 0xD7, 0x09, 0xDA, 0x96, 0xE7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D,
+    0x97, 0x0D, 0xA7, 0x9D, 0x70, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0xDA,
+    0x70, 0xDA, 0x79, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7,
+    0x0D, 0xA7, 0x0A, 0xD7, 0x9D, 0x97, 0x09, 0xDA, 0x6E, 0x72, 0xEA, 0x3A, 0xE9, 0x72, 0x9F, 0xFD,
+    0x97, 0x5A, 0xFD, 0xA7, 0x72, 0x99, 0x77, 0x77, 0x77, 0x59, 0xD9, 0x77, 0x0A, 0xD3, 0xAA, 0x95,
+    0x9A, 0xA1, 0xDA, 0x29, 0xD9, 0x5A, 0xD0, 0xE3, 0x9D, 0x6F, 0xCA, 0x4A, 0xD6, 0xEA, 0x6D, 0xA5,
+    0x9D, 0x70, 0xD9, 0x5A, 0xD7, 0x9D, 0x95, 0xDA, 0x7A, 0xD6, 0xDA, 0x7E, 0x59, 0xD9, 0x7D, 0xA5,
+    0xAD, 0x70, 0xD9, 0x5E, 0x79, 0xD9, 0x4A, 0xDA, 0x79, 0xD4, 0x9E, 0x97, 0x9D, 0xA2, 0xAC, 0xAD,
+    0x97, 0x0F, 0xEA, 0x0D, 0x72, 0xFC, 0x90, 0x9D, 0x74, 0x97, 0x70, 0x09, 0x93, 0xE2, 0x9D, 0x3A,
+    0xCA, 0x3D, 0x93, 0x90, 0x39, 0x93, 0xE2, 0xAD, 0x91, 0x9D, 0x92, 0xD4, 0x94, 0x49, 0x96, 0xE9,
+    0x4F, 0xC3, 0xDA, 0x0A, 0xCA, 0x1D, 0x92, 0xD9, 0x09, 0x59, 0x00, 0x29, 0x94, 0x92, 0xAE, 0xA1,
+    0x9C, 0x19, 0xFF, 0xC1, 0xD2, 0xF2, 0x95, 0x92, 0x9F, 0xE0, 0xFF, 0x09, 0x99, 0x99, 0x99, 0x90,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0A,
+    0x49, 0xA9, 0xCA, 0x29, 0xCA, 0x0F, 0xE1, 0x9F, 0xC4, 0x99, 0x30, 0x09, 0x90, 0xAD, 0x0E, 0x09,
+    0xA9, 0x00, 0x69, 0x1D, 0x2D, 0x99, 0xD2, 0xD9, 0x0A, 0x92, 0x99, 0x00, 0x0E, 0xA1, 0xAA, 0xDA,
+    0x29, 0xCA, 0x2A, 0xCA, 0x0E, 0xA1, 0xD3, 0xC9, 0x20, 0x1A, 0xCA, 0x91, 0xDA, 0xD9, 0x0C, 0x91,
+    0xD9, 0xC2, 0xAC, 0x0C, 0xA0, 0x9C, 0xA0, 0x9F, 0x39, 0x20, 0x39, 0x92, 0x99, 0x3D, 0xA1, 0xDA,
+    0x2D, 0xA1, 0xDA, 0x2A, 0xCA, 0x1A, 0xCA, 0x29, 0xCA, 0x19, 0xCA, 0x49, 0x29, 0x50, 0x09, 0x59,
+    0x1D, 0x29, 0xD1, 0x9D, 0x0A, 0xD3, 0xFC, 0x49, 0xE6, 0x99, 0x40, 0x6D, 0x91, 0xD9, 0x1D, 0x19,
+    0xD1, 0xAC, 0xA1, 0xD9, 0x1D, 0x2A, 0xA1, 0x71, 0x9D, 0x1D, 0x90, 0xAC, 0xA1, 0xD1, 0xDA, 0x09,
+    0xD1, 0xD9, 0x0A, 0xD1, 0xAA, 0x19, 0xA9, 0x00, 0x09, 0x92, 0x99, 0x3D, 0xA1, 0xDA, 0x29, 0xD1,
+    0x9D, 0x3A, 0xCA, 0x1A, 0xCA, 0x3D, 0x2D, 0x49, 0x39, 0x00, 0x39, 0xA6, 0x9D, 0x95, 0x9D, 0x93,
+    0xA1, 0xA9, 0x09, 0xA1, 0xCA, 0x3D, 0x1F, 0xE9, 0x2F, 0xC9, 0x59, 0x40, 0x29, 0xAA, 0x92, 0x9F,
+    0xCA, 0x09, 0xDA, 0xAA, 0xD0, 0xAC, 0x39, 0xC9, 0x95, 0x90, 0x3C, 0xA2, 0xD9, 0x19, 0xD2, 0xDA,
+    0x1A, 0xD2, 0xDA, 0x1A, 0xD9, 0x19, 0x99, 0x20, 0x2D, 0xA1, 0x9D, 0x91, 0xE2, 0xD9, 0x1A, 0xD2,
+    0xD9, 0x19, 0xCA, 0x39, 0x30, 0x9D, 0x09, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xAC, 0x90, 0x9C,
+    0x91, 0x90, 0x2D, 0xA1, 0x9D, 0x91, 0xE2, 0xD9, 0x1A, 0xD2, 0xD9, 0x19, 0xCA, 0x39, 0x30, 0x09,
+    0x93, 0xE2, 0x9D, 0x3A, 0xCA, 0x3D, 0x49, 0x00, 0x39, 0x99, 0x2A, 0xD9, 0x19, 0xDA, 0x2D, 0xA2,
+    0xD9, 0x39, 0x40, 0x71, 0xD0, 0x99, 0xAC, 0xAA, 0xF9, 0x99, 0x9D, 0x3D, 0x39, 0x90, 0x79, 0xCA,
+    0x3A, 0xCA, 0x99, 0x1F, 0xC9, 0x0D, 0x99, 0x91, 0xD4, 0x94, 0x72, 0xFF, 0x1A, 0xAA, 0xAA, 0xAD,
+    0x7C, 0xA6, 0x9C, 0xA6, 0xAC, 0x96, 0xD7, 0xD7, 0xA9, 0x10, 0x73, 0xE4, 0xDA, 0x3A, 0xD3, 0xAD,
+    0x92, 0xE9, 0x3A, 0x94, 0x19, 0xC9, 0x0A, 0xCA, 0x1C, 0xA2, 0xC9, 0x2D, 0x29, 0xC9, 0x50, 0x29,
+    0xA4, 0xD4, 0xD1, 0x9A, 0xEA, 0x9A, 0xFC, 0x96, 0x0A, 0xAA, 0xAA, 0xA1, 0xFD, 0x29, 0xD4, 0x9C,
+    0xA4, 0xAC, 0x97, 0x20, 0x71, 0xAC, 0x4D, 0x19, 0xFD, 0x9A, 0xEA, 0x91, 0xAC, 0x93, 0x9A, 0x20,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA6, 0x72, 0xDA, 0x3D, 0x92, 0x9D, 0x39, 0xD3, 0xAC, 0xA0, 0x99,
+    0xAD, 0x90, 0xAF, 0x19, 0xDA, 0x20, 0x6D, 0xA2, 0xD9, 0x19, 0xD2, 0xAD, 0x2A, 0xCA, 0x2A, 0xD9,
+    0x90, 0x9F, 0x1A, 0xE0, 0x4D, 0xA0, 0xE0, 0xD9, 0x30, 0x19, 0x39, 0x1D, 0x91, 0xAC, 0xA0, 0xD9,
+    0x1D, 0xA0, 0x99, 0x29, 0xA0, 0x1A, 0xCA, 0x91, 0xDA, 0xD9, 0x9C, 0x2C, 0xA9, 0xC2, 0xD9, 0xCA,
+    0x09, 0xCA, 0x0A, 0xF3, 0x92, 0x6D, 0x90, 0x9D, 0x1D, 0x19, 0xC9, 0x19, 0x92, 0x2C, 0x92, 0xD3,
+    0xE3, 0xAC, 0xA2, 0xAC, 0xAA, 0xAA, 0xD0, 0xEA, 0x10, 0x2D, 0x2D, 0x2D, 0x3D, 0x3D, 0x99, 0x1A,
+    0xE3, 0x91, 0x6A, 0xCA, 0x1D, 0x91, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xCA, 0x1D, 0x91, 0xAA, 0x10,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xD0, 0x9C, 0xA5, 0xD0, 0xAC, 0x95, 0xD0, 0xD5, 0x9C,
+    0xA0, 0x99, 0x69, 0x10, 0x73, 0x9C, 0x2D, 0x2C, 0xA9, 0xCA, 0x9A, 0xD9, 0x9D, 0x1A, 0xE9, 0xF7,
+    0x50, 0x09, 0x59, 0x90, 0xD9, 0x2D, 0x91, 0xD0, 0x9D, 0x92, 0xAF, 0x94, 0xE9, 0x59, 0x99, 0x30,
+    0x39, 0x96, 0xAE, 0x49, 0xF9, 0x29, 0xD0, 0x9D, 0x1A, 0xD2, 0x9C, 0xA0, 0x99, 0x49, 0x90, 0xA9,
+    0x4A, 0x0D, 0x3D, 0x0A, 0xFD, 0xA1, 0xFC, 0xA4, 0x99, 0x30, 0x29, 0xAA, 0x93, 0xFD, 0x1E, 0xAA,
+    0xDA, 0x0C, 0xA3, 0xD0, 0x95, 0x90, 0x29, 0x93, 0x99, 0x09, 0xF9, 0x1C, 0xA0, 0xDA, 0xFD, 0x09,
+    0xC9, 0x1A, 0xE9, 0x19, 0x49, 0x20, 0x0F, 0xEA, 0x9F, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x00, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xEA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x76,
+    0xAF, 0xFE, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x29, 0x94, 0x92, 0xF9, 0x1A, 0xC1, 0xAF,
+    0xFA, 0x1C, 0xA1, 0x9F, 0x29, 0x71, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFD, 0xA9, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF,
+    0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x77, 0xAD, 0x49,
+    0xEA, 0x3A, 0xE9, 0x2A, 0xE9, 0x4D, 0xA7, 0x96, 0x77, 0x74, 0xAC, 0xA7, 0x4D, 0x74, 0xDA, 0x73,
+    0x9D, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xD7, 0x4A, 0xCA, 0x74, 0xD7, 0x4D, 0x97, 0x39, 0xD7, 0x4D,
+    0x97, 0x3A, 0xD7, 0x4D, 0x74, 0xAC, 0xA7, 0x4D, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAD,
+    0x74, 0xD7, 0x4A, 0xCA, 0x74, 0xD7, 0x49, 0xA9, 0x74, 0x5A, 0xC2, 0x9D, 0x2A, 0xC2, 0xAC, 0x1A,
+    0xCA, 0x0A, 0xCA, 0x60, 0x0A, 0xA5, 0x9A, 0x1D, 0x5A, 0xC0, 0x9C, 0xA5, 0xD0, 0xAC, 0xA9, 0x99,
+    0x99, 0x9D, 0x0F, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x74, 0xFF, 0xD1, 0xCA, 0x99,
+    0x99, 0x99, 0xD0, 0x9C, 0x95, 0xCA, 0x0A, 0xC5, 0x9C, 0x90, 0xAF, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA1, 0x75, 0xF9, 0xEA, 0x1D, 0x99, 0xDA, 0x9A, 0xC9, 0xAC, 0x2C, 0xA1, 0x9C, 0x97, 0x30,
+    0x19, 0x5A, 0xC9, 0x9D, 0x19, 0xF3, 0xE3, 0xFC, 0x19, 0xC9, 0x0D, 0x71, 0x71, 0xAD, 0x91, 0x9D,
+    0x92, 0xD9, 0x3A, 0xCA, 0x4D, 0x4D, 0x3A, 0xD2, 0xDA, 0x71, 0x76, 0xAF, 0xFE, 0x19, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA7, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xE9, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x10, 0x09, 0x93, 0xE2, 0x9D, 0x3A, 0xCA, 0x3A, 0xC9, 0x39, 0x00, 0x29, 0x99,
+    0x29, 0xDA, 0x2E, 0x2A, 0xCA, 0x2A, 0xCA, 0x39, 0x94, 0x29, 0x94, 0x92, 0xAE, 0xA1, 0x9C, 0x19,
+    0xFF, 0xC1, 0xD2, 0xF2, 0x95, 0x92, 0x0A, 0xAA, 0x2F, 0x29, 0xD3, 0xD2, 0xD7, 0x49, 0xAA, 0x93,
+    0x91, 0xE3, 0xD9, 0x9D, 0x9A, 0xD9, 0xD9, 0xDA, 0x0D, 0xA0, 0xA9, 0x0D, 0x19, 0xA4, 0x95, 0x09,
+    0xA9, 0x1D, 0x91, 0xD9, 0x1E, 0xA0, 0xAD, 0xA0, 0x76, 0xFF, 0xF1, 0xDA, 0xAA, 0xAA, 0xAA, 0xAC,
+    0xA0, 0x9C, 0xA6, 0x9C, 0x90, 0xAC, 0x96, 0xAC, 0x90, 0xAA, 0x7A, 0xA1, 0x76, 0x9F, 0xFE, 0x19,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFE, 0x91, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0x71, 0x9D, 0x1D, 0x90, 0x9D, 0x1D, 0x90, 0xAC, 0xA0, 0x9D, 0x1D,
+    0x90, 0x9D, 0x1A, 0xA1, 0x9A, 0x90, 0x09, 0x99, 0x99, 0x09, 0xFC, 0x09, 0xAA, 0xAD, 0x39, 0xCA,
+    0x3A, 0xC9, 0x3D, 0x10, 0x59, 0x69, 0x90, 0xC9, 0x09, 0x90, 0x9F, 0xC1, 0xCA, 0x0D, 0xAF, 0xD0,
+    0x9C, 0x1F, 0xC9, 0x19, 0x09, 0xC1, 0x97, 0x50, 0x5C, 0xA7, 0x0A, 0xD7, 0x09, 0xC9, 0x59, 0xAA,
+    0x92, 0x9C, 0x19, 0xFC, 0x99, 0xD1, 0xD9, 0xAF, 0xC9, 0x09, 0xC9, 0x2A, 0xD9, 0x59, 0xA7, 0x1D,
+    0x97, 0x0D, 0x77, 0x10, 0x2A, 0xCA, 0x92, 0xC9, 0x1F, 0xDA, 0xD1, 0x9C, 0x2A, 0xE7, 0x7A, 0xCA,
+    0x92, 0xC9, 0x1A, 0xFC, 0x9D, 0x19, 0xC9, 0x1A, 0xE9, 0x29, 0x49, 0x30, 0x3A, 0x19, 0x93, 0x9C,
+    0xA1, 0xAC, 0x91, 0xFF, 0xCA, 0x09, 0xDA, 0xAA, 0xDA, 0x29, 0xC2, 0xC7, 0x50, 0x79, 0xC2, 0x9E,
+    0x1A, 0xDA, 0x91, 0xD2, 0x9C, 0xA2, 0xAC, 0x91, 0x9F, 0x3F, 0x3F, 0x99, 0xF3, 0xF3, 0xF9, 0x9C,
+    0x77, 0x1C, 0x99, 0xC7, 0x99, 0x7C, 0x99, 0xA5, 0xC0, 0xAA, 0x0C, 0x5A, 0x95, 0xA0, 0x93, 0x90,
+    0xA7, 0x3C, 0x7C, 0x71, 0x9A, 0x71, 0x99, 0x39, 0xA1, 0x9A, 0x71, 0xAA, 0x1A, 0x99, 0xC7, 0x71,
+    0xC9, 0x9C, 0x1C, 0x97, 0x2C, 0x1C, 0x99, 0xC1, 0x97, 0x39, 0x1C, 0x99, 0xC1, 0x9A, 0x71, 0x99,
+    0x1C, 0x93, 0x9A, 0x71, 0xAA, 0x71, 0xA7, 0xA7, 0x3C, 0x09, 0x39, 0x0C, 0x6A, 0x49, 0xC0, 0xAA,
+    0x0C, 0x94, 0xA0, 0x9C, 0x79, 0x97, 0xC9, 0x9C, 0x77, 0x1C, 0x99, 0xCA, 0xAA, 0x3A, 0xAA, 0xA3,
+    0xAA, 0xAC, 0x99, 0xF2, 0x9F, 0x92, 0xF9, 0x4C, 0xA2, 0xAD, 0xA2, 0xE0, 0x9F, 0xD9, 0x0A, 0x30,
+    0x19, 0xC9, 0x0A, 0xCA, 0x1C, 0xA1, 0x9C, 0x92, 0xD2, 0x9C, 0x95, 0x29, 0xAA, 0x93, 0xFD, 0x1D,
+    0xAA, 0xAD, 0xA9, 0xC9, 0x3C, 0xA0, 0x90, 0x9C, 0xA0, 0x93, 0xE5, 0xE6, 0x93, 0x7A, 0x90, 0xA2,
+    0xFA, 0x19, 0xE2, 0xF9, 0x1D, 0x9C, 0xA7, 0x39, 0x91, 0xAD, 0x90, 0xE9, 0x1D, 0xA2, 0x9A, 0xD9,
+    0x3A, 0xA0, 0xA9, 0x3A, 0xDA, 0x29, 0xE2, 0xAD, 0x09, 0xDA, 0x90, 0xAA, 0x30, 0xA9, 0x49, 0x92,
+    0xAD, 0x92, 0xDA, 0x29, 0xE0, 0x9E, 0x3E, 0x0A, 0xC9, 0xC9, 0x0A, 0xDA, 0x1C, 0xA0, 0xCA, 0x0C,
+    0x92, 0xAC, 0x19, 0xC0, 0x4A, 0xC1, 0x9C, 0xA1, 0xAC, 0x1D, 0x0A, 0xC9, 0xD9, 0x40, 0x09, 0x90,
+    0xAD, 0x0E, 0x09, 0xA9, 0x00, 0x2C, 0xA2, 0xA0, 0xCA, 0x99, 0x0F, 0xCA, 0x1A, 0xD9, 0x19, 0xCA,
+    0xD2, 0xA0, 0xA9, 0x00, 0x74, 0xAE, 0x9A, 0xE9, 0x09, 0xCA, 0x9A, 0xD9, 0x9D, 0x0A, 0xC2, 0xCA,
+    0x2C, 0x9A, 0xC2, 0xCA, 0x2C, 0x99, 0xCA, 0x9E, 0xA9, 0xD1, 0x9E, 0x99, 0xE1, 0x0C, 0x92, 0x9C,
+    0x3A, 0xF9, 0xAA, 0xAD, 0x3A, 0xC3, 0xA9, 0x00, 0x0A, 0xC7, 0x7A, 0xC9, 0x0A, 0xD7, 0x5D, 0xA2,
+    0xE9, 0x71, 0xAD, 0xA4, 0xFA, 0x99, 0x99, 0x9A, 0xF9, 0x69, 0xFF, 0xEA, 0x73, 0x9A, 0xAA, 0xAA,
+    0x99, 0x60, 0xAC, 0x97, 0x6A, 0xC9, 0x9D, 0x75, 0xAD, 0x1A, 0xD9, 0x71, 0x9E, 0x3A, 0xEA, 0xA9,
+    0x99, 0x9A, 0xFA, 0x59, 0xFF, 0xEA, 0x72, 0x9A, 0xAA, 0xAA, 0x99, 0x60, 0x9F, 0xFF, 0xCA, 0xFF,
+    0xFD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD1, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x39, 0x99, 0x97, 0x39, 0x2F, 0xFA, 0x96, 0xD1, 0xDA,
+    0xA9, 0xAA, 0xFE, 0xAA, 0xE9, 0x0A, 0xC9, 0x69, 0xAF, 0xE9, 0x19, 0x75, 0x99, 0x40, 0x6A, 0xAF,
+    0xCA, 0x97, 0x09, 0xFF, 0xFA, 0x5F, 0xA9, 0x49, 0xAE, 0x92, 0xE9, 0x72, 0xAD, 0x1D, 0xA7, 0x5A,
+    0xCA, 0x9A, 0x97, 0x7A, 0x90, 0x77, 0x1A, 0x77, 0x4D, 0x1A, 0xFF, 0xFF, 0xF9, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xDA, 0x77, 0x2C, 0x97, 0x77, 0x29, 0x94, 0xCA, 0x9A, 0xC1,
+    0xAA, 0x19, 0xC1, 0xC2, 0xAA, 0x1C, 0x2C, 0x91, 0xC1, 0xAC, 0x2A, 0xD9, 0xC7, 0x10, 0x29, 0x91,
+    0x9C, 0x9C, 0xA0, 0xC1, 0xAA, 0xAC, 0xAC, 0xA0, 0xCA, 0x3A, 0xA4, 0xEA, 0x60, 0x19, 0x91, 0x99,
+    0x19, 0x2C, 0x19, 0xC1, 0xAA, 0x1C, 0x91, 0xC1, 0x9A, 0x10, 0x29, 0x93, 0xCA, 0x9C, 0x90, 0xAA,
+    0x19, 0xC0, 0xC2, 0x9C, 0x0C, 0x2A, 0xA0, 0xC2, 0xC1, 0x9E, 0x90, 0x19, 0x29, 0x19, 0xC2, 0xC1,
+    0xAA, 0x19, 0xC1, 0xC9, 0x1A, 0xA1, 0xC2, 0xC9, 0x1C, 0x1A, 0xC2, 0xAD, 0x9C, 0x71, 0x29, 0x99,
+    0x09, 0xCA, 0x99, 0x0C, 0x92, 0x9C, 0x39, 0xA3, 0x9C, 0x4A, 0xE6, 0x59, 0xC5, 0xAA, 0x29, 0x90,
+    0xC9, 0x1C, 0xA9, 0xAC, 0x1A, 0xA1, 0x9C, 0x1C, 0x2A, 0xA0, 0x9C, 0x2C, 0x91, 0xC1, 0xAC, 0x2A,
+    0xD9, 0xC7, 0x10, 0x1A, 0xA4, 0xC9, 0x4C, 0x09, 0x91, 0x9C, 0xA9, 0xAC, 0x0A, 0xC1, 0x9C, 0x0A,
+    0x91, 0x9A, 0x0C, 0x2A, 0x90, 0xC2, 0xC0, 0x9A, 0x2C, 0x00, 0x19, 0x09, 0x91, 0x99, 0x2C, 0xA9,
+    0xCA, 0xA9, 0xAA, 0x09, 0xC1, 0x9C, 0x19, 0xC0, 0xAA, 0x1A, 0xA1, 0xAA, 0x0C, 0x2C, 0x91, 0xC9,
+    0x0C, 0x2C, 0x2C, 0x09, 0xA1, 0x9A, 0x2C, 0x00, 0x19, 0x09, 0x91, 0xCA, 0xA9, 0x09, 0xC3, 0xAA,
+    0x3C, 0x93, 0xC3, 0x9C, 0x30, 0x1A, 0x2A, 0xC9, 0x09, 0xCA, 0x91, 0xC3, 0xC2, 0x9C, 0x2A, 0xA2,
+    0x9D, 0x60, 0x49, 0x09, 0xA2, 0xC0, 0x9C, 0x1C, 0x91, 0xC0, 0x9C, 0x2C, 0x0C, 0x3C, 0xAA, 0x3A,
+    0xC3, 0x19, 0x29, 0x2C, 0x90, 0xAA, 0x29, 0xCA, 0xA4, 0xCA, 0x4A, 0xD3, 0x9C, 0x0C, 0x91, 0x9C,
+    0x19, 0xC1, 0x72, 0x9D, 0x97, 0x4E, 0xA7, 0x3A, 0xEA, 0x73, 0xDA, 0xD7, 0x2A, 0xD9, 0xD7, 0x2D,
+    0x99, 0xD7, 0x1E, 0x1D, 0x70, 0x9D, 0x91, 0xD9, 0x7E, 0x2D, 0x96, 0x9D, 0x92, 0xDA, 0x6D, 0xA3,
+    0xDA, 0x59, 0xD4, 0xAD, 0x5F, 0xFE, 0x4A, 0xFF, 0xE4, 0xEA, 0xAA, 0xAA, 0xAA, 0xD3, 0xAD, 0x69,
+    0xD9, 0x2D, 0xA7, 0xD9, 0x1E, 0x70, 0xDA, 0x09, 0xDA, 0x70, 0xDA, 0x0E, 0x71, 0xE9, 0xD9, 0x71,
+    0xAD, 0x39, 0xFD, 0xAA, 0x7A, 0xFF, 0xCA, 0x5E, 0x99, 0x99, 0xAE, 0xA4, 0xDA, 0x5E, 0x39, 0xD9,
+    0x5A, 0xD3, 0xAD, 0x6A, 0xD3, 0xAD, 0x6A, 0xD3, 0xDA, 0x59, 0xDA, 0x3D, 0x94, 0xAE, 0x39, 0xFF,
+    0xD9, 0x4A, 0xFF, 0xC9, 0x5E, 0x39, 0xAD, 0xA4, 0xDA, 0x5A, 0xD9, 0x3D, 0x96, 0xDA, 0x29, 0xD7,
+    0xE2, 0xAD, 0x7E, 0x2D, 0xA6, 0x9D, 0xA2, 0xDA, 0x6E, 0x29, 0xD9, 0x39, 0xAE, 0x92, 0x9F, 0xFE,
+    0x93, 0xAF, 0xFA, 0x95, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97,
+    0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7,
+    0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0x9D,
+    0x74, 0xAD, 0x74, 0x73, 0xDA, 0x75, 0xAE, 0x75, 0xF7, 0x4D, 0xAD, 0x97, 0x29, 0xD0, 0xD9, 0x72,
+    0xDA, 0x0A, 0xCA, 0x71, 0xAD, 0x1A, 0xD7, 0x1D, 0x91, 0x9D, 0x70, 0xAD, 0x29, 0xD7, 0x9D, 0x93,
+    0xD9, 0x6D, 0xA4, 0xD9, 0x59, 0xD5, 0xDA, 0x5D, 0xA5, 0xAC, 0xA4, 0xAD, 0x6A, 0xD4, 0xD9, 0x69,
+    0xD3, 0xAD, 0x79, 0xD2, 0x9D, 0x97, 0x0D, 0x91, 0xE7, 0x1D, 0xA0, 0x9D, 0xA9, 0x99, 0x99, 0x99,
+    0x99, 0x9D, 0xA0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xA0, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99,
+    0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73,
+    0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7,
+    0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF,
+    0xD4, 0x4A, 0xFF, 0xEA, 0x4F, 0xFF, 0x94, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x75, 0xAD, 0x97, 0x49,
+    0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xE9,
+    0x74, 0xAD, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0xAD, 0x97, 0x4A, 0xDA, 0x99, 0x99, 0x99,
+    0x99, 0x94, 0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x39, 0xD7, 0x0A, 0xCA, 0x3A, 0xD7, 0x0D, 0xA3, 0xDA,
+    0x70, 0xD9, 0x3D, 0xA7, 0x9D, 0x92, 0x9D, 0x97, 0xAD, 0x3A, 0xD7, 0x0A, 0xD3, 0xAD, 0x70, 0xDA,
+    0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xD3, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0xDA, 0x3D, 0xA7, 0x0D, 0x93, 0xD9, 0x79, 0xD3, 0x9D, 0x70, 0xAD, 0x3A, 0xD7, 0x0D,
+    0xA3, 0xE7, 0x0D, 0xA3, 0xDA, 0x79, 0xD9, 0x29, 0xD9, 0x79, 0xD3, 0x9D, 0x70, 0xAD, 0x3A, 0xD7,
+    0x0D, 0xA3, 0x77, 0x71, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6,
+    0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7,
+    0x2A, 0xD0, 0xAD, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAD, 0x0A, 0xD1, 0xFF, 0x1E, 0x0E, 0x1A,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90, 0xE7, 0x2E, 0x1A, 0xD7,
+    0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A, 0xEA, 0x5A, 0xFF, 0xD9,
+    0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x4F, 0xE4, 0x9F, 0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x71, 0xAD,
+    0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7,
+    0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x7A, 0xFC, 0xA4, 0x9F,
+    0xE4, 0x39, 0xD6, 0x9D, 0x93, 0xAD, 0x59, 0xDA, 0x4D, 0xA4, 0x9D, 0xA5, 0xD9, 0x39, 0xDA, 0x59,
+    0xD9, 0x29, 0xDA, 0x6A, 0xD2, 0x9D, 0xA7, 0xAD, 0x19, 0xDA, 0x70, 0xDA, 0x09, 0xDA, 0x71, 0xD9,
+    0x9D, 0xA7, 0x19, 0xD9, 0xE7, 0x2A, 0xFD, 0x97, 0x1F, 0x9E, 0x71, 0xE1, 0x9D, 0x97, 0x0D, 0x92,
+    0xDA, 0x79, 0xD3, 0xAD, 0x7A, 0xD4, 0xDA, 0x6D, 0xA4, 0xE6, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x5E,
+    0x49, 0xD6, 0xAD, 0x4A, 0xD7, 0xDA, 0x30, 0x72, 0x9D, 0x97, 0x5E, 0xA7, 0x4A, 0xEA, 0x74, 0xDA,
+    0xD7, 0x3A, 0xD9, 0xD7, 0x3D, 0x99, 0xD7, 0x2E, 0x1D, 0x71, 0x9D, 0x91, 0xD9, 0x70, 0xE2, 0xD9,
+    0x79, 0xD9, 0x2D, 0xA7, 0xE3, 0xDA, 0x69, 0xD9, 0x3A, 0xD6, 0xDA, 0x4A, 0xD5, 0xAD, 0x59, 0xD5,
+    0xDA, 0x59, 0xD4, 0xAD, 0x7D, 0x93, 0xDA, 0x7D, 0x92, 0xE7, 0x0D, 0xA1, 0x9D, 0xA7, 0x0D, 0xA1,
+    0xE7, 0x1A, 0xD0, 0x9D, 0x97, 0x1A, 0xD0, 0x39, 0xE7, 0x29, 0xE9, 0x3A, 0xE9, 0x71, 0xF9, 0x3F,
+    0xA7, 0x0A, 0xF4, 0xDA, 0xCA, 0x70, 0xDA, 0xD3, 0x9D, 0x9D, 0x7A, 0xCA, 0xDA, 0x3A, 0xD9, 0xD6,
+    0x9D, 0x0D, 0xA3, 0xDA, 0x0D, 0x6D, 0xA0, 0xD9, 0x3D, 0x90, 0xD5, 0x9D, 0x09, 0xD4, 0xD9, 0x0D,
+    0x5D, 0x90, 0xAD, 0x39, 0xD1, 0xD9, 0x39, 0xD1, 0xDA, 0x3A, 0xD1, 0xAC, 0x93, 0xD9, 0x1D, 0x93,
+    0xDA, 0x1A, 0xCA, 0x2A, 0xD1, 0x9D, 0x93, 0xD9, 0x19, 0xCA, 0x2D, 0x91, 0xAD, 0x4D, 0x29, 0xD1,
+    0xAC, 0xA2, 0xAD, 0x39, 0xD3, 0xD1, 0xD3, 0xDA, 0x3A, 0xD3, 0xD0, 0xAC, 0xA3, 0xD9, 0x3D, 0xA3,
+    0xD9, 0xD3, 0x9D, 0x4D, 0x93, 0xFA, 0x3A, 0xD3, 0x9D, 0x4F, 0x4E, 0x3A, 0xD4, 0xAD, 0x94, 0xDA,
+    0x3A, 0xCA, 0x4A, 0xD5, 0xD9, 0x30, 0x39, 0xD9, 0x70, 0xAC, 0xA3, 0xAE, 0x70, 0xD9, 0x3F, 0x70,
+    0xD9, 0x3F, 0xA6, 0x9D, 0x39, 0xDA, 0xD6, 0xAD, 0x3A, 0xD0, 0xD9, 0x5D, 0xA3, 0xDA, 0x0D, 0xA5,
+    0xD9, 0x3D, 0x90, 0x9D, 0x49, 0xD4, 0xD9, 0x1D, 0x93, 0x9D, 0x39, 0xD2, 0xAD, 0x3A, 0xD3, 0xAD,
+    0x29, 0xD3, 0xDA, 0x3D, 0xA3, 0xDA, 0x2D, 0x93, 0xD9, 0x3A, 0xD1, 0x9D, 0x4D, 0x5D, 0x90, 0xAD,
+    0x39, 0xD5, 0xDA, 0x0A, 0xCA, 0x3A, 0xD5, 0x9D, 0x0D, 0xA3, 0xDA, 0x6D, 0x9D, 0x93, 0xD9, 0x6A,
+    0xF3, 0x9D, 0x79, 0xF3, 0xAD, 0x70, 0xEA, 0x3A, 0xCA, 0x70, 0xAD, 0x93, 0x5F, 0xFE, 0x94, 0x9F,
+    0xFE, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xFF,
+    0xC9, 0x7F, 0xFC, 0x70, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFC, 0x4F, 0xFF, 0xC3, 0x77, 0x71, 0xAF, 0xCA, 0x97,
+    0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E,
+    0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A, 0xD0, 0xAD,
+    0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1, 0xAD, 0x71,
+    0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3, 0xAE, 0xA5, 0xAF, 0xFD, 0x97,
+    0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x10, 0x39, 0xFF, 0xFD, 0x4A, 0xFF, 0xFC, 0xA4, 0xE9, 0x99, 0x99,
+    0x99, 0x9A, 0xDA, 0x4D, 0xA7, 0x9D, 0x93, 0x9D, 0x97, 0xAD, 0x4A, 0xD7, 0x0E, 0x4A, 0xD7, 0x0D,
+    0xA4, 0xDA, 0x70, 0xD9, 0x4D, 0x97, 0x9D, 0x93, 0x9D, 0x97, 0xAD, 0x4A, 0xD7, 0x0E, 0x4E, 0x70,
+    0xDA, 0x4D, 0xA7, 0x0D, 0x94, 0xD9, 0x79, 0xD4, 0x9D, 0x70, 0xAD, 0x4A, 0xD7, 0x0E, 0x4E, 0x70,
+    0xDA, 0x4D, 0xA7, 0x9D, 0x93, 0x9D, 0x97, 0x9D, 0x49, 0xD7, 0x0A, 0xD4, 0xAD, 0x70, 0xDA, 0x40,
+    0x39, 0xFD, 0xA9, 0x6A, 0xFF, 0xC5, 0xE9, 0x99, 0xAE, 0xA4, 0xDA, 0x4E, 0x39, 0xD9, 0x49, 0xD9,
+    0x2A, 0xD6, 0xDA, 0x2A, 0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x92, 0xD9, 0x5E, 0x29, 0xD5, 0xAD, 0xA2,
+    0xAD, 0x99, 0x99, 0xAE, 0xA3, 0xFF, 0xD9, 0x4F, 0xDA, 0xA9, 0x6D, 0x97, 0x39, 0xD7, 0x4A, 0xD7,
+    0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0x49, 0xFF, 0xEA, 0x4A, 0xFF,
+    0xE9, 0x4E, 0x99, 0xAA, 0xAA, 0xAA, 0xA5, 0x9D, 0x97, 0x6E, 0x76, 0x9D, 0x77, 0xDA, 0x76, 0xAD,
+    0x77, 0xDA, 0x76, 0xAD, 0x76, 0xDA, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0x9D, 0x97, 0x5D, 0x97, 0x5D,
+    0xA7, 0x5E, 0x75, 0xAD, 0x75, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC,
+    0x30, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x96, 0xE7, 0x4D, 0xA7,
+    0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4E,
+    0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7,
+    0x20, 0x0D, 0x97, 0xAD, 0x1D, 0xA6, 0x9D, 0xA1, 0xAD, 0x6E, 0x29, 0xD5, 0xAD, 0x93, 0xD9, 0x4D,
+    0xA4, 0xDA, 0x3E, 0x5A, 0xD2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x90, 0xE7, 0x0D, 0xAA, 0xD7, 0x1A,
+    0xF9, 0x71, 0x9F, 0x73, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D,
+    0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x72, 0x73, 0x9D, 0x77, 0x3A, 0xD7, 0x79, 0xAF, 0xDA, 0xA9, 0x70,
+    0x9F, 0xFF, 0xD9, 0x5A, 0xFA, 0x9A, 0xDA, 0x9A, 0xF9, 0x3A, 0xDA, 0x39, 0xD3, 0x9E, 0x2A, 0xDA,
+    0x4A, 0xD4, 0x9D, 0x91, 0xDA, 0x5D, 0xA5, 0xDA, 0x0A, 0xD6, 0xDA, 0x5E, 0x0E, 0x59, 0xD9, 0x5E,
+    0x0D, 0xA5, 0x9D, 0x6D, 0xA0, 0xDA, 0x5A, 0xD5, 0x9D, 0x90, 0xDA, 0x5D, 0xA5, 0xAD, 0x1E, 0x5D,
+    0x94, 0x9D, 0xA1, 0xAD, 0xA3, 0x9D, 0x49, 0xE3, 0xEA, 0x91, 0xAD, 0x29, 0xF4, 0x9F, 0xFF, 0xEA,
+    0x7A, 0xFF, 0xEA, 0x74, 0x9A, 0xDA, 0x99, 0x77, 0x09, 0xD7, 0x73, 0xAD, 0x73, 0x49, 0xD7, 0x9D,
+    0x95, 0xD9, 0x6D, 0xA6, 0xDA, 0x5E, 0x79, 0xD4, 0xAD, 0x71, 0xD9, 0x29, 0xD9, 0x71, 0xAD, 0x2D,
+    0xA7, 0x29, 0xD1, 0xDA, 0x74, 0xDA, 0xE7, 0x5A, 0xF7, 0x7E, 0x97, 0x69, 0xE7, 0x7F, 0x97, 0x5D,
+    0xAA, 0xD7, 0x4A, 0xD0, 0x9D, 0x73, 0xAD, 0x2D, 0x97, 0x19, 0xD9, 0x2A, 0xD7, 0x1D, 0xA3, 0x9D,
+    0x70, 0xE5, 0xDA, 0x6A, 0xD6, 0xAD, 0x59, 0xD9, 0x69, 0xD9, 0x4D, 0xA7, 0x0D, 0xA3, 0x1A, 0xD4,
+    0xAD, 0x4A, 0xD2, 0xDA, 0x4E, 0x4E, 0x2D, 0xA4, 0xDA, 0x4D, 0xA1, 0x9D, 0x93, 0x9D, 0x93, 0x9D,
+    0x91, 0xAD, 0x4A, 0xD4, 0xAD, 0x2E, 0x4A, 0xD4, 0xAD, 0x2D, 0xA4, 0xDA, 0x4D, 0xA2, 0xD9, 0x4D,
+    0x94, 0xD9, 0x19, 0xD9, 0x39, 0xD9, 0x39, 0xD2, 0x9D, 0x93, 0xAD, 0x4E, 0x29, 0xD9, 0x3E, 0x39,
+    0xD9, 0x3E, 0x3D, 0xA3, 0xE4, 0xEA, 0x2D, 0x91, 0x9E, 0x6F, 0xFF, 0xD7, 0x0A, 0xFF, 0xD9, 0x73,
+    0x99, 0xE9, 0x97, 0x70, 0xDA, 0x77, 0x19, 0xD9, 0x77, 0x1A, 0xD7, 0x72, 0xAD, 0x77, 0x2D, 0xA7,
+    0x40, 0x77, 0x74, 0x9A, 0xFD, 0x97, 0x2F, 0xFE, 0x79, 0xEA, 0x92, 0x9F, 0x59, 0xE7, 0xAD, 0xA4,
+    0xE7, 0x1E, 0x39, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0x9D, 0x92, 0xDA, 0x72, 0x9D, 0x91, 0x9D, 0x97,
+    0x29, 0xD9, 0x1A, 0xD7, 0x39, 0xD9, 0x1E, 0x73, 0xAD, 0x2E, 0x73, 0xE2, 0xAD, 0x73, 0xDA, 0x2A,
+    0xD7, 0x2A, 0xD3, 0x9D, 0x97, 0x1D, 0xA4, 0xE7, 0x0E, 0x59, 0xD9, 0x6A, 0xD7, 0xE5, 0xE5, 0x99,
+    0x99, 0xDA, 0x3E, 0x99, 0x99, 0x19, 0xFE, 0x2F, 0xF1, 0xAF, 0xE2, 0xFE, 0xA1, 0x49, 0xEA, 0x2A,
+    0xA3, 0xFE, 0x09, 0xCA, 0x2E, 0xA9, 0x9A, 0xCA, 0xDA, 0x1A, 0xD9, 0x39, 0xE9, 0x09, 0xDA, 0x5E,
+    0x1A, 0xD6, 0xE1, 0xDA, 0x6D, 0xA0, 0x9D, 0x96, 0xD9, 0x0A, 0xD6, 0x9D, 0x1A, 0xD6, 0xE1, 0xAD,
+    0x6E, 0x1A, 0xD5, 0xEA, 0x1A, 0xD4, 0xAE, 0x91, 0x9D, 0xA2, 0xAC, 0xAD, 0x92, 0xFE, 0x90, 0xEA,
+    0x2F, 0xC9, 0x1E, 0xA4, 0x95, 0x92, 0x72, 0x99, 0x74, 0x9F, 0xD9, 0x70, 0xAF, 0xFA, 0x69, 0xDA,
+    0x3E, 0x6E, 0x49, 0xD9, 0x49, 0xD9, 0x5D, 0xA4, 0xAD, 0x6D, 0x94, 0xDA, 0x59, 0xD5, 0xD9, 0x5E,
+    0x49, 0xD9, 0x4A, 0xD5, 0xAD, 0x1A, 0xAE, 0xA6, 0xAD, 0x09, 0xF9, 0x7D, 0xA1, 0x99, 0xAD, 0xA6,
+    0xD9, 0x49, 0xD9, 0x49, 0xD6, 0xAD, 0x4A, 0xD6, 0x9D, 0x4E, 0x69, 0xD4, 0xDA, 0x6A, 0xD4, 0xD9,
+    0x6E, 0x39, 0xD6, 0x9D, 0x93, 0xAD, 0xA9, 0x3A, 0xE4, 0xFF, 0xF5, 0xDA, 0x9F, 0xDA, 0x59, 0xD9,
+    0x29, 0x97, 0x0A, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x60, 0x9A,
+    0xA6, 0x9A, 0xA9, 0xD6, 0xE9, 0xD6, 0xDA, 0x9D, 0x6D, 0x90, 0xD5, 0x9D, 0x1D, 0x94, 0xAD, 0x1D,
+    0x94, 0xD9, 0x1D, 0x93, 0x9D, 0x2D, 0x93, 0xDA, 0x2A, 0xCA, 0x29, 0xD3, 0xAC, 0xA2, 0xD9, 0x3A,
+    0xCA, 0x1A, 0xCA, 0x49, 0xD0, 0xAD, 0x59, 0xDA, 0xD6, 0x9F, 0x70, 0xE7, 0x1D, 0x97, 0x09, 0xD7,
+    0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x76, 0x70, 0x99, 0x73, 0xAF, 0xCA, 0x7F, 0xFC,
+    0x5A, 0xD9, 0x3A, 0xC5, 0xDA, 0x74, 0xDA, 0x74, 0xAD, 0x74, 0x9D, 0xA7, 0x4A, 0xE7, 0x3A, 0xF7,
+    0x0A, 0xEA, 0xE5, 0x9E, 0x92, 0xDA, 0x4E, 0x4A, 0xD3, 0xE6, 0xD9, 0x2D, 0x96, 0xDA, 0x1A, 0xD7,
+    0xDA, 0x1A, 0xD7, 0xDA, 0x1E, 0x7D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x94, 0x9D, 0xA3, 0xE9, 0x29,
+    0xE4, 0x9F, 0xFC, 0x69, 0xFD, 0xA7, 0x29, 0x97, 0x00, 0x49, 0xAE, 0xA9, 0x4F, 0xF9, 0x2A, 0xDA,
+    0x90, 0x9A, 0xC3, 0xDA, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xF6, 0xFD, 0x49, 0xDA,
+    0x70, 0xE7, 0x1D, 0x97, 0x1D, 0xA7, 0x1E, 0x49, 0x92, 0x9F, 0xFA, 0x39, 0xFE, 0x96, 0x99, 0x50,
+    0x77, 0x2F, 0xFD, 0xA3, 0xFC, 0xAA, 0xE9, 0x71, 0x9D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7,
+    0x2D, 0xA7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x73, 0xE7,
+    0x3D, 0xA7, 0x29, 0xD9, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xAE, 0x97, 0x2A, 0xFA, 0x71, 0x9F, 0xCA,
+    0x72, 0xAE, 0x97, 0x29, 0xDA, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x50, 0x77, 0x3A,
+    0xA2, 0xAE, 0xA5, 0xD0, 0x9F, 0xDA, 0x39, 0xDA, 0xDA, 0x99, 0xE3, 0xAF, 0x3A, 0xD9, 0x2F, 0x49,
+    0xD9, 0x2E, 0x94, 0xAD, 0x29, 0xE5, 0xE2, 0x9D, 0x95, 0xE2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0x92,
+    0xDA, 0x5A, 0xD2, 0x9D, 0x95, 0xE2, 0xAD, 0x6D, 0xA2, 0xE5, 0x9D, 0xA2, 0xE5, 0x9D, 0x92, 0xDA,
+    0x5A, 0xD7, 0x4E, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xE7, 0x4D, 0xA3, 0x70,
+    0x97, 0x2A, 0xFC, 0x96, 0xFF, 0x94, 0xE9, 0x2E, 0x39, 0xD9, 0x3A, 0xD3, 0xDA, 0x49, 0xD9, 0x19,
+    0xD6, 0xD9, 0x1D, 0xA6, 0xD9, 0x1D, 0x95, 0x9D, 0x90, 0x9D, 0x69, 0xD1, 0xAD, 0x99, 0x99, 0x99,
+    0x9A, 0xD1, 0xFF, 0xFC, 0x1F, 0xFF, 0xA0, 0x9D, 0x7D, 0x90, 0x9D, 0x69, 0xD1, 0xAD, 0x6E, 0x1A,
+    0xD6, 0xDA, 0x1A, 0xD5, 0x9D, 0x2A, 0xD5, 0xDA, 0x29, 0xD4, 0xAD, 0x4E, 0x2A, 0xD9, 0x4A, 0xFE,
+    0xA6, 0xAF, 0xC9, 0x71, 0x99, 0x70, 0x2A, 0xA9, 0x29, 0xD9, 0x29, 0xD3, 0xAD, 0x3D, 0xA3, 0xD9,
+    0x29, 0xD3, 0xAD, 0x3E, 0x3D, 0xA3, 0xD9, 0x29, 0xD3, 0xAD, 0x3A, 0xD9, 0x29, 0xFC, 0xA0, 0xAF,
+    0x92, 0x99, 0x10, 0x3A, 0xA9, 0x4A, 0xAA, 0x4D, 0x93, 0xE4, 0x9D, 0x3E, 0x5A, 0xD2, 0xAD, 0x6E,
+    0x1A, 0xD7, 0xDA, 0x0A, 0xD7, 0x0D, 0x9A, 0xD7, 0x09, 0xDA, 0xE7, 0x0A, 0xFD, 0x97, 0xEA, 0x0D,
+    0xA7, 0xDA, 0x1A, 0xD6, 0x9D, 0x92, 0xDA, 0x59, 0xD3, 0xAD, 0x5A, 0xD4, 0xDA, 0x4D, 0xA4, 0xAD,
+    0x4D, 0x94, 0x9D, 0xA2, 0x59, 0x97, 0x4F, 0xC7, 0x19, 0xFD, 0x74, 0xAD, 0x97, 0x4D, 0xA7, 0x4A,
+    0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x4E, 0x97, 0x2A, 0xEA, 0x72, 0xDA, 0xCA, 0x71, 0xAC, 0xA9, 0xD7,
+    0x1D, 0x09, 0xD7, 0x0D, 0xA1, 0xD7, 0x9D, 0x2D, 0x96, 0xDA, 0x2D, 0xA5, 0x9D, 0x3D, 0xA5, 0xDA,
+    0x3A, 0xD4, 0xAD, 0x4A, 0xD4, 0xDA, 0x49, 0xD3, 0xAD, 0x59, 0xD9, 0x2D, 0x96, 0xEA, 0x0E, 0x7E,
+    0xA7, 0x49, 0x10, 0x4A, 0xA9, 0x6A, 0xA5, 0xD9, 0x5A, 0xD4, 0x9D, 0x95, 0xE4, 0xAD, 0x6D, 0xA4,
+    0xAD, 0x6D, 0x94, 0xDA, 0x59, 0xD5, 0xD9, 0x5A, 0xD4, 0x9D, 0x6D, 0xA4, 0xAD, 0x6D, 0x94, 0xE5,
+    0x9D, 0x94, 0xDA, 0x5E, 0x5D, 0x94, 0xAE, 0x49, 0xD9, 0x39, 0xEA, 0x4A, 0xE2, 0x9C, 0xAD, 0xA4,
+    0xFF, 0xC0, 0xF3, 0xD9, 0xFA, 0x19, 0xE2, 0x9D, 0x29, 0x59, 0x39, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7,
+    0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x60, 0x9A, 0xA6, 0x9A, 0xA9, 0xD6, 0xE9, 0xD6, 0xDA, 0x9D,
+    0x6D, 0x90, 0xD5, 0x9D, 0x1D, 0x94, 0xAD, 0x1D, 0x94, 0xD9, 0x1D, 0x93, 0x9D, 0x2D, 0x93, 0xDA,
+    0x2A, 0xCA, 0x29, 0xD3, 0xAC, 0xA2, 0xD9, 0x3A, 0xCA, 0x1A, 0xCA, 0x49, 0xD0, 0xAD, 0x59, 0xDA,
+    0xD6, 0x9F, 0x70, 0xE7, 0x77, 0x39, 0xFF, 0xD9, 0x39, 0xFE, 0xAA, 0xA6, 0x9D, 0x97, 0x2A, 0xD7,
+    0x4D, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0x9E, 0x74, 0xAF, 0xAA, 0xA7, 0x0A, 0xFD, 0x6A,
+    0xDA, 0x99, 0x99, 0x6D, 0xA7, 0x3D, 0xA7, 0x39, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x4A, 0xDA,
+    0x74, 0xF9, 0x72, 0x9F, 0xC9, 0x72, 0xAF, 0xC7, 0x39, 0xF7, 0x4E, 0x74, 0xAD, 0x74, 0xDA, 0x73,
+    0xAD, 0x74, 0xD9, 0x50, 0x49, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D,
+    0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0,
+    0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA,
+    0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF,
+    0xFF, 0xF9, 0x9A, 0xAE, 0xAA, 0xAA, 0xAE, 0xAA, 0xA3, 0xE4, 0xAD, 0x6D, 0xA4, 0xDA, 0x6D, 0x94,
+    0xD9, 0x59, 0xD4, 0x9D, 0x6A, 0xD4, 0xAD, 0x6D, 0xA4, 0xE6, 0xD9, 0x4D, 0xA5, 0x9D, 0x94, 0xD9,
+    0x5A, 0xD4, 0x9D, 0x6E, 0x4A, 0xD6, 0xDA, 0x4A, 0xD6, 0xD9, 0x4A, 0xF3, 0x9D, 0x6F, 0x77, 0x94,
+    0x69, 0xAE, 0xA7, 0x0A, 0xFE, 0x95, 0xAD, 0xA9, 0x99, 0xE5, 0xDA, 0x39, 0xD9, 0x3A, 0xD5, 0xDA,
+    0x3D, 0xA5, 0xDA, 0x3D, 0x95, 0xDA, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xDA, 0x2E, 0x59, 0xD9, 0x2D,
+    0xA5, 0xAD, 0x3D, 0x95, 0xDA, 0x29, 0xD5, 0xAD, 0x92, 0xAE, 0x92, 0xAD, 0xA3, 0xFF, 0xE4, 0xD9,
+    0x9F, 0xCA, 0x49, 0xD3, 0x97, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD,
+    0x74, 0x49, 0xAE, 0xA9, 0x4A, 0xFE, 0x92, 0xF9, 0x99, 0xAC, 0x2A, 0xDA, 0x70, 0xDA, 0x70, 0xAD,
+    0x71, 0xDA, 0x70, 0x9D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1A, 0xD7, 0x19, 0xD9, 0x71, 0xE7, 0x1F,
+    0x97, 0x0F, 0xCA, 0x7A, 0xFC, 0x97, 0x9F, 0x71, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x71,
+    0xDA, 0x30, 0x59, 0x9A, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFE, 0x3F, 0xAA, 0xAE, 0xAA, 0xA2, 0xAD,
+    0xA3, 0x9D, 0x93, 0x9D, 0xA5, 0xDA, 0x3E, 0x6A, 0xD3, 0xDA, 0x6A, 0xD2, 0x9D, 0x96, 0xAD, 0x29,
+    0xD7, 0xAD, 0x2A, 0xD7, 0xDA, 0x2A, 0xD7, 0xD9, 0x29, 0xD9, 0x5A, 0xD4, 0xDA, 0x5D, 0xA4, 0xE9,
+    0x29, 0xE6, 0xFF, 0xC7, 0x0F, 0xD9, 0x73, 0x99, 0x71, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A,
+    0xFF, 0xE0, 0x9A, 0xAA, 0xAD, 0xAA, 0xAA, 0xA4, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D, 0x97, 0x09,
+    0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x1D, 0x97, 0x09, 0xD7, 0x19, 0xD9, 0x71, 0xFD, 0x69,
+    0xFC, 0x71, 0x95, 0x2A, 0xA9, 0x5A, 0xA9, 0x19, 0xD9, 0x5D, 0xA1, 0x9D, 0x6D, 0xA1, 0xAD, 0x6D,
+    0xA1, 0xDA, 0x6D, 0xA1, 0xD9, 0x6D, 0xA0, 0x9D, 0x96, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xE6, 0xAD,
+    0x1D, 0xA6, 0xE1, 0xD9, 0x6D, 0x90, 0x9D, 0x95, 0xAD, 0x19, 0xD9, 0x49, 0xD9, 0x2E, 0x3A, 0xE3,
+    0xAF, 0xFA, 0x5A, 0xFD, 0x97, 0x19, 0x70, 0x49, 0x4A, 0xE9, 0x49, 0xD9, 0x2F, 0xDA, 0x3E, 0x2E,
+    0x99, 0xE2, 0xE2, 0x9D, 0x92, 0xDA, 0x09, 0xD9, 0x2A, 0xD3, 0xDA, 0x0E, 0x3D, 0xA3, 0xDA, 0x0D,
+    0xA3, 0xD9, 0x3D, 0xA9, 0xD9, 0x29, 0xD4, 0xDA, 0x9D, 0x3A, 0xD3, 0x9D, 0x99, 0xD3, 0xAC, 0xA3,
+    0xAD, 0x09, 0xD3, 0xDA, 0x3D, 0xA0, 0x9D, 0x92, 0xD9, 0x2A, 0xD2, 0xE1, 0x9D, 0x2A, 0xDA, 0x2A,
+    0xDA, 0x0A, 0xD0, 0x9E, 0xA4, 0xAF, 0xFD, 0xA6, 0x9F, 0xEA, 0x72, 0x9D, 0x97, 0x59, 0xD7, 0x6A,
+    0xD7, 0x6D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x20, 0x39, 0xAA, 0x70, 0xAA, 0x93, 0xF6,
+    0xAD, 0x49, 0xAD, 0x94, 0x9D, 0x96, 0xE4, 0xDA, 0x7A, 0xD3, 0xAD, 0x71, 0xD9, 0x19, 0xD9, 0x71,
+    0xDA, 0x1D, 0xA7, 0x2A, 0xD0, 0xAD, 0x73, 0x9D, 0x9D, 0x75, 0xF9, 0x75, 0xEA, 0x76, 0xAD, 0x77,
+    0xE7, 0x6F, 0x97, 0x49, 0xFA, 0x74, 0xD0, 0xAD, 0x73, 0xDA, 0x09, 0xD7, 0x2A, 0xD2, 0xDA, 0x71,
+    0xD9, 0x2E, 0x70, 0xDA, 0x3A, 0xD7, 0xAD, 0x49, 0xDA, 0x59, 0xD9, 0x5F, 0xC3, 0xE7, 0xEA, 0x20,
+    0x77, 0x75, 0xD9, 0x77, 0xD9, 0x76, 0x9D, 0x77, 0xAD, 0x77, 0xDA, 0x77, 0xD9, 0x70, 0xAA, 0x92,
+    0x9D, 0x3A, 0xA2, 0x9D, 0x92, 0x9D, 0x29, 0xD2, 0x9D, 0x3A, 0xD2, 0x9D, 0x91, 0xAD, 0x3D, 0xA2,
+    0x9D, 0x91, 0xDA, 0x3D, 0x92, 0x9D, 0x91, 0xD9, 0x29, 0xD3, 0x9D, 0x19, 0xD3, 0xAD, 0x3A, 0xD1,
+    0xAD, 0x3D, 0xA3, 0xAD, 0x1E, 0x3D, 0xA3, 0xDA, 0x1D, 0xA3, 0xD9, 0x29, 0xD9, 0x1D, 0xA2, 0x9D,
+    0x3A, 0xD2, 0xDA, 0x2A, 0xD2, 0x9D, 0x92, 0xE2, 0xDA, 0x2E, 0x3A, 0xE1, 0xD9, 0x0A, 0xE5, 0xFF,
+    0xEA, 0x7A, 0xFE, 0xA9, 0x73, 0xE7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7,
+    0x7D, 0xA7, 0x20, 0x4A, 0xA9, 0x70, 0xAA, 0x94, 0xDA, 0x71, 0xE3, 0xAD, 0x72, 0x9D, 0x29, 0xD9,
+    0x72, 0x9D, 0x91, 0xE7, 0x4D, 0x91, 0xD9, 0x49, 0x95, 0xD9, 0x0A, 0xD5, 0xD5, 0xD9, 0x0D, 0xA4,
+    0x9D, 0x5D, 0x90, 0xDA, 0x4A, 0xD4, 0x9D, 0x90, 0xD9, 0x4D, 0xA4, 0x9D, 0x1D, 0x94, 0xD9, 0x4A,
+    0xD1, 0xD9, 0x39, 0xD9, 0x4D, 0xA1, 0xD9, 0x3E, 0x93, 0xAD, 0x2E, 0x2A, 0xCA, 0xD2, 0x9D, 0x92,
+    0x9F, 0xDA, 0x0F, 0xEA, 0x49, 0xFA, 0x19, 0xFC, 0x97, 0x09, 0x69, 0x60, 0x72, 0x9D, 0x97, 0x4E,
+    0xA7, 0x3A, 0xEA, 0x73, 0xDA, 0xD7, 0x2A, 0xD9, 0xD7, 0x2D, 0x99, 0xD7, 0x1E, 0x1D, 0x70, 0x9D,
+    0x91, 0xD9, 0x7E, 0x2D, 0x96, 0x9D, 0x92, 0xDA, 0x6D, 0xA3, 0xDA, 0x59, 0xD4, 0xAD, 0x5F, 0xFE,
+    0x4A, 0xFF, 0xE4, 0xEA, 0xAA, 0xAA, 0xAA, 0xD3, 0xAD, 0x69, 0xD9, 0x2D, 0xA7, 0xD9, 0x1E, 0x70,
+    0xDA, 0x09, 0xDA, 0x70, 0xDA, 0x0E, 0x71, 0xE9, 0xD9, 0x71, 0xAD, 0x77, 0x77, 0x79, 0xD7, 0x5A,
+    0xD9, 0x74, 0x9D, 0x77, 0x70, 0x49, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA,
+    0x2A, 0xDA, 0x39, 0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9,
+    0x59, 0xD9, 0x1A, 0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2,
+    0xAC, 0xAD, 0x93, 0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x77, 0x6D, 0x74, 0xAD, 0x97,
+    0x39, 0xD7, 0x77, 0x10, 0x73, 0xAA, 0xA9, 0x75, 0xFC, 0x77, 0xD7, 0x69, 0xD7, 0x49, 0xE9, 0x74,
+    0xAC, 0x97, 0x6D, 0x77, 0x77, 0x09, 0xD9, 0x75, 0xEA, 0x74, 0xAE, 0xA7, 0x4D, 0xAD, 0x73, 0xAD,
+    0x9D, 0x73, 0xD9, 0x9D, 0x72, 0xE1, 0xD7, 0x19, 0xD9, 0x1D, 0x97, 0x0E, 0x2D, 0x97, 0x9D, 0x92,
+    0xDA, 0x7D, 0xA3, 0xDA, 0x69, 0xD4, 0xAD, 0x6F, 0xFE, 0x5A, 0xFF, 0xE5, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xD4, 0xAD, 0x69, 0xD9, 0x3D, 0xA7, 0xD9, 0x2E, 0x70, 0xDA, 0x19, 0xDA, 0x70, 0xDA, 0x1E, 0x71,
+    0xE0, 0x9D, 0x97, 0x1A, 0xD0, 0x7E, 0xA7, 0x3A, 0xAE, 0x75, 0xD7, 0x4A, 0xD7, 0x2A, 0xE7, 0x3D,
+    0x75, 0xAA, 0x77, 0x72, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD,
+    0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D,
+    0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA,
+    0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x77, 0x2D, 0xA7, 0x71, 0xDA, 0x74,
+    0xE9, 0x0A, 0xC9, 0x74, 0xAF, 0x09, 0x75, 0xAC, 0xA0, 0xAC, 0xA7, 0x5D, 0x92, 0xAC, 0x77, 0x77,
+    0x77, 0x73, 0x9D, 0x97, 0x71, 0xEA, 0x77, 0x0A, 0xEA, 0x77, 0x0D, 0xAD, 0x77, 0xAD, 0x9D, 0x77,
+    0xD9, 0x9D, 0x76, 0xE1, 0xD7, 0x59, 0xD9, 0x1D, 0x97, 0x4E, 0x2D, 0x97, 0x39, 0xD9, 0x2D, 0xA7,
+    0x3D, 0xA3, 0xDA, 0x72, 0x9D, 0x4A, 0xD7, 0x2F, 0xFE, 0x71, 0xAF, 0xFE, 0x71, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xD7, 0x0A, 0xD6, 0x9D, 0x97, 0xDA, 0x7D, 0x96, 0xE7, 0x0D, 0xA5, 0x9D, 0xA7, 0x0D, 0xA5,
+    0xE7, 0x1E, 0x49, 0xD9, 0x71, 0xAD, 0x40, 0x76, 0xAA, 0x97, 0x5A, 0xD7, 0x0A, 0xD9, 0x0A, 0xCA,
+    0x70, 0xAF, 0x0A, 0x97, 0x0A, 0xD0, 0xD9, 0x71, 0xAC, 0x92, 0xAC, 0x71, 0x95, 0x97, 0x77, 0x39,
+    0xAD, 0xA2, 0xAA, 0x6A, 0xFD, 0x09, 0xD5, 0xF9, 0x99, 0xFA, 0x4A, 0xDA, 0x39, 0xE9, 0x4E, 0x5E,
+    0x4A, 0xD6, 0xE4, 0xE6, 0xDA, 0x4D, 0xA6, 0xDA, 0x39, 0xD9, 0x59, 0xD9, 0x3A, 0xD6, 0xAD, 0x4A,
+    0xD6, 0xE4, 0xAD, 0x5A, 0xDA, 0x49, 0xD4, 0x9E, 0x95, 0xE2, 0xAC, 0xAD, 0x95, 0xAF, 0xDA, 0x0D,
+    0x7A, 0xF9, 0x09, 0xD7, 0x19, 0x74, 0x6D, 0x77, 0xAC, 0x97, 0x7A, 0xC1, 0xE9, 0x72, 0x90, 0xAF,
+    0x73, 0xAC, 0xA0, 0xAC, 0xA7, 0x1D, 0x92, 0xAC, 0x77, 0x77, 0x77, 0x9D, 0x97, 0x5E, 0xA7, 0x4A,
+    0xEA, 0x74, 0xDA, 0xD7, 0x3A, 0xD9, 0xD7, 0x3D, 0x99, 0xD7, 0x2E, 0x1D, 0x71, 0x9D, 0x91, 0xD9,
+    0x70, 0xE2, 0xD9, 0x79, 0xD9, 0x2D, 0xA7, 0xDA, 0x3D, 0xA6, 0x9D, 0x4A, 0xD6, 0xFF, 0xE5, 0xAF,
+    0xFE, 0x5E, 0xAA, 0xAA, 0xAA, 0xAD, 0x4A, 0xD6, 0x9D, 0x93, 0xDA, 0x7D, 0x92, 0xE7, 0x0D, 0xA1,
+    0x9D, 0xA7, 0x0D, 0xA1, 0xE7, 0x1E, 0x09, 0xD9, 0x71, 0xAD, 0x00, 0x2A, 0xA7, 0x5A, 0xC9, 0x75,
+    0xD1, 0xAD, 0x97, 0x0A, 0x0A, 0xF7, 0x1A, 0xD0, 0xD9, 0x7A, 0xC9, 0x2A, 0xC7, 0x95, 0x97, 0x77,
+    0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5,
+    0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2,
+    0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0,
+    0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x77, 0x77, 0x5E, 0x97, 0x72, 0xCA, 0x77, 0x1A, 0xC9, 0x73,
+    0xE9, 0x0C, 0xA7, 0x4A, 0xF7, 0x6A, 0xCA, 0x0A, 0xCA, 0x74, 0xD9, 0x2A, 0xC7, 0x77, 0x77, 0x77,
+    0x09, 0xD9, 0x77, 0x0E, 0xA7, 0x7A, 0xEA, 0x77, 0xDA, 0xD7, 0x6A, 0xD9, 0xD7, 0x6D, 0x99, 0xD7,
+    0x5E, 0x1D, 0x74, 0x9D, 0x91, 0xD9, 0x73, 0xE2, 0xD9, 0x72, 0x9D, 0x92, 0xDA, 0x72, 0xDA, 0x3D,
+    0xA7, 0x19, 0xD4, 0xAD, 0x71, 0xFF, 0xE7, 0x0A, 0xFF, 0xE7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAD, 0x7A,
+    0xD6, 0x9D, 0x96, 0xDA, 0x7D, 0x95, 0xE7, 0x0D, 0xA4, 0x9D, 0xA7, 0x0D, 0xA4, 0xE7, 0x1E, 0x39,
+    0xD9, 0x71, 0xAD, 0x30, 0x77, 0x75, 0xE7, 0x7C, 0xA7, 0x59, 0xC9, 0x7A, 0xD9, 0x0D, 0x97, 0xAF,
+    0x09, 0x70, 0xAD, 0x0D, 0x97, 0x0A, 0xC9, 0x2A, 0xC7, 0x09, 0x59, 0x77, 0x71, 0x9A, 0xDA, 0x2A,
+    0xA5, 0xAF, 0xD0, 0x9D, 0x4F, 0x99, 0x9F, 0xA3, 0xAD, 0xA3, 0x9E, 0x93, 0xE5, 0xE3, 0xAD, 0x6E,
+    0x3E, 0x6D, 0xA3, 0xDA, 0x6D, 0xA2, 0x9D, 0x95, 0x9D, 0x92, 0xAD, 0x6A, 0xD3, 0xAD, 0x6E, 0x3A,
+    0xD5, 0xAD, 0xA3, 0x9D, 0x49, 0xE9, 0x4E, 0x2A, 0xCA, 0xD9, 0x4A, 0xFD, 0xA0, 0xD6, 0xAF, 0x90,
+    0x9D, 0x70, 0x97, 0x30, 0x72, 0xAD, 0x92, 0xC9, 0x71, 0xFD, 0xAD, 0x71, 0x9C, 0x2A, 0xE9, 0x77,
+    0x77, 0x0E, 0x97, 0x6A, 0xF7, 0x5A, 0xCA, 0x0A, 0xCA, 0x73, 0xD9, 0x2A, 0xC7, 0x77, 0x77, 0x75,
+    0x9D, 0x97, 0x7E, 0xA7, 0x6A, 0xEA, 0x76, 0xDA, 0xD7, 0x5A, 0xD9, 0xD7, 0x5D, 0x99, 0xD7, 0x4E,
+    0x1D, 0x73, 0x9D, 0x91, 0xD9, 0x72, 0xE2, 0xD9, 0x71, 0x9D, 0x92, 0xDA, 0x71, 0xDA, 0x3D, 0xA7,
+    0x09, 0xD4, 0xAD, 0x70, 0xFF, 0xE7, 0xAF, 0xFE, 0x7E, 0xAA, 0xAA, 0xAA, 0xAD, 0x6A, 0xD6, 0x9D,
+    0x95, 0xDA, 0x7D, 0x94, 0xE7, 0x0D, 0xA3, 0x9D, 0xA7, 0x0D, 0xA3, 0xE7, 0x1E, 0x29, 0xD9, 0x71,
+    0xAD, 0x20, 0x6A, 0xAA, 0x3A, 0x95, 0xFC, 0xA9, 0xD5, 0x9C, 0x90, 0x9F, 0x95, 0x99, 0x49, 0x72,
+    0xAD, 0x97, 0x2A, 0xF7, 0x1A, 0xD0, 0xD9, 0x7A, 0xC9, 0x2A, 0xC7, 0x95, 0x97, 0x77, 0x9A, 0xDA,
+    0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD,
+    0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E,
+    0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF,
+    0x90, 0x9D, 0x79, 0x72, 0x74, 0x99, 0x76, 0xEA, 0x74, 0xFC, 0x73, 0xDA, 0x0A, 0xCA, 0x71, 0xD9,
+    0x2A, 0xC9, 0x70, 0x95, 0x97, 0x77, 0x59, 0xD9, 0x75, 0xEA, 0x74, 0xAE, 0xA7, 0x4D, 0xAD, 0x73,
+    0xAD, 0x9D, 0x73, 0xD9, 0x9D, 0x72, 0xE1, 0xD7, 0x19, 0xD9, 0x1D, 0x97, 0x0E, 0x2D, 0x97, 0x9D,
+    0x92, 0xDA, 0x7D, 0xA3, 0xDA, 0x69, 0xD4, 0xAD, 0x6F, 0xFE, 0x5A, 0xFF, 0xE5, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xD4, 0xAD, 0x69, 0xD9, 0x3D, 0xA7, 0xD9, 0x2E, 0x70, 0xDA, 0x19, 0xDA, 0x70, 0xDA, 0x1E,
+    0x71, 0xE0, 0x9D, 0x97, 0x1A, 0xD7, 0x77, 0x77, 0x29, 0xD7, 0x6A, 0xD9, 0x75, 0x9D, 0x77, 0x72,
+    0x70, 0x99, 0x74, 0xEA, 0x72, 0xFC, 0x71, 0xDA, 0x0A, 0xCA, 0x7D, 0x92, 0xD9, 0x69, 0x59, 0x77,
+    0x79, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A, 0xDA, 0x39, 0xE9, 0x2E,
+    0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A, 0xD6, 0xAD,
+    0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2, 0xAC, 0xAD, 0x93, 0xAF, 0xDA,
+    0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x77, 0x6D, 0x74, 0xAD, 0x97, 0x39, 0xD7, 0x77, 0x10, 0x76,
+    0xAC, 0xA7, 0x6A, 0xCA, 0x76, 0x9C, 0xA7, 0x39, 0xA1, 0x91, 0x9A, 0x71, 0x9C, 0xA2, 0x9C, 0xA7,
+    0x2F, 0xE7, 0x4A, 0xEA, 0x77, 0x77, 0x77, 0x39, 0xD9, 0x76, 0xEA, 0x75, 0xAE, 0xA7, 0x5D, 0xAD,
+    0x74, 0xAD, 0x9D, 0x74, 0xD9, 0x9D, 0x73, 0xE1, 0xD7, 0x29, 0xD9, 0x1D, 0x97, 0x1E, 0x2D, 0x97,
+    0x09, 0xD9, 0x2D, 0xA7, 0x0D, 0xA3, 0xDA, 0x79, 0xD4, 0xAD, 0x7F, 0xFE, 0x6A, 0xFF, 0xE6, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xD5, 0xAD, 0x69, 0xD9, 0x4D, 0xA7, 0xD9, 0x3E, 0x70, 0xDA, 0x29, 0xDA, 0x70,
+    0xDA, 0x2E, 0x71, 0xE1, 0x9D, 0x97, 0x1A, 0xD1, 0x72, 0x9A, 0xA7, 0x39, 0xD7, 0x39, 0xCA, 0x71,
+    0x91, 0xA9, 0x09, 0x96, 0x9C, 0x92, 0x9C, 0xA7, 0xEA, 0xE7, 0x09, 0xFC, 0x73, 0x99, 0x77, 0x72,
+    0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5,
+    0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2,
+    0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0,
+    0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x72, 0xD7, 0x70, 0x9C, 0xA7, 0x70, 0x9C, 0x97, 0x49, 0xA1,
+    0x99, 0x09, 0xA7, 0x19, 0xCA, 0x29, 0xCA, 0x72, 0xFE, 0x74, 0xFA, 0x77, 0x77, 0x77, 0x39, 0xD9,
+    0x76, 0xEA, 0x75, 0xAE, 0xA7, 0x5D, 0xAD, 0x74, 0xAD, 0x9D, 0x74, 0xD9, 0x9D, 0x73, 0xE1, 0xD7,
+    0x29, 0xD9, 0x1D, 0x97, 0x1E, 0x2D, 0x97, 0x09, 0xD9, 0x2D, 0xA7, 0x0D, 0xA3, 0xDA, 0x79, 0xD4,
+    0xAD, 0x7F, 0xFE, 0x6A, 0xFF, 0xE6, 0xEA, 0xAA, 0xAA, 0xAA, 0xD5, 0xAD, 0x69, 0xD9, 0x4D, 0xA7,
+    0xD9, 0x3E, 0x70, 0xDA, 0x29, 0xDA, 0x70, 0xDA, 0x2E, 0x71, 0xE1, 0x9D, 0x97, 0x1A, 0xD1, 0x6A,
+    0xA7, 0x59, 0xCA, 0x75, 0xAC, 0x73, 0x91, 0x99, 0x09, 0x96, 0x9C, 0x92, 0x9C, 0xA7, 0xEA, 0xE7,
+    0x09, 0xFC, 0x73, 0x99, 0x77, 0x72, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F,
+    0xA2, 0xAD, 0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D,
+    0x95, 0x9D, 0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E,
+    0x2A, 0xCA, 0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x73, 0x9D, 0x97, 0x79,
+    0xAC, 0x97, 0x79, 0xC9, 0x76, 0xDA, 0x73, 0x9A, 0x1A, 0x19, 0xA7, 0x19, 0xCA, 0x29, 0xCA, 0x72,
+    0xFE, 0x74, 0xAE, 0xA7, 0x77, 0x77, 0x73, 0x9D, 0x97, 0x6E, 0xA7, 0x5A, 0xEA, 0x75, 0xDA, 0xD7,
+    0x4A, 0xD9, 0xD7, 0x4D, 0x99, 0xD7, 0x3E, 0x1D, 0x72, 0x9D, 0x91, 0xD9, 0x71, 0xE2, 0xD9, 0x70,
+    0x9D, 0x92, 0xDA, 0x70, 0xDA, 0x3D, 0xA7, 0x9D, 0x4A, 0xD7, 0xFF, 0xE6, 0xAF, 0xFE, 0x6E, 0xAA,
+    0xAA, 0xAA, 0xAD, 0x5A, 0xD6, 0x9D, 0x94, 0xDA, 0x7D, 0x93, 0xE7, 0x0D, 0xA2, 0x9D, 0xA7, 0x0D,
+    0xA2, 0xE7, 0x1E, 0x19, 0xD9, 0x71, 0xAD, 0x10, 0x70, 0xAA, 0x97, 0x39, 0xAD, 0x75, 0x9C, 0x97,
+    0x3A, 0xCA, 0x71, 0x91, 0xC1, 0x99, 0x69, 0xC9, 0x29, 0xCA, 0x7E, 0xAE, 0x70, 0x9F, 0xC7, 0x39,
+    0x97, 0x77, 0x29, 0xAD, 0xA2, 0xAA, 0x4A, 0xFD, 0x09, 0xD3, 0xF9, 0x99, 0xFA, 0x2A, 0xDA, 0x39,
+    0xE9, 0x2E, 0x5E, 0x2A, 0xD6, 0xE2, 0xE6, 0xDA, 0x2D, 0xA6, 0xDA, 0x19, 0xD9, 0x59, 0xD9, 0x1A,
+    0xD6, 0xAD, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xDA, 0x29, 0xD4, 0x9E, 0x93, 0xE2, 0xAC, 0xAD, 0x93,
+    0xAF, 0xDA, 0x0D, 0x5A, 0xF9, 0x09, 0xD7, 0x97, 0x20, 0x72, 0xAC, 0xA9, 0x19, 0xC9, 0x71, 0xFD,
+    0xAD, 0x71, 0xAC, 0x2A, 0xE7, 0x77, 0x69, 0xA4, 0x9A, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x3F, 0xE7,
+    0x5F, 0xA7, 0x77, 0x77, 0x76, 0x9D, 0x97, 0x7E, 0xA7, 0x6A, 0xEA, 0x76, 0xDA, 0xD7, 0x5A, 0xD9,
+    0xD7, 0x5D, 0x99, 0xD7, 0x4E, 0x1D, 0x73, 0x9D, 0x91, 0xD9, 0x72, 0xE2, 0xD9, 0x71, 0x9D, 0x92,
+    0xDA, 0x71, 0xDA, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70, 0xFF, 0xE7, 0xAF, 0xFE, 0x7E, 0xAA, 0xAA,
+    0xAA, 0xAD, 0x6A, 0xD6, 0x9D, 0x95, 0xDA, 0x7D, 0x94, 0xE7, 0x0D, 0xA3, 0x9D, 0xA7, 0x0D, 0xA3,
+    0xE7, 0x1E, 0x29, 0xD9, 0x71, 0xAD, 0x20, 0x6A, 0xAA, 0x3C, 0x95, 0xFC, 0xA9, 0xD5, 0xAC, 0x90,
+    0x9F, 0x95, 0x99, 0x39, 0x97, 0x09, 0x49, 0x96, 0x9C, 0x92, 0x9C, 0xA7, 0xEA, 0xE7, 0x09, 0xFC,
+    0x97, 0x39, 0x77, 0x72, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD,
+    0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D,
+    0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA,
+    0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x72, 0x71, 0xA4, 0x9A, 0x71, 0x9C, 0xA2,
+    0x9C, 0xA7, 0x2F, 0xE7, 0x39, 0xFC, 0x97, 0x69, 0x77, 0x77, 0x29, 0xD9, 0x76, 0xEA, 0x75, 0xAE,
+    0xA7, 0x5D, 0xAD, 0x74, 0xAD, 0x9D, 0x74, 0xD9, 0x9D, 0x73, 0xE1, 0xD7, 0x29, 0xD9, 0x1D, 0x97,
+    0x1E, 0x2D, 0x97, 0x09, 0xD9, 0x2D, 0xA7, 0x0D, 0xA3, 0xDA, 0x79, 0xD4, 0xAD, 0x7F, 0xFE, 0x6A,
+    0xFF, 0xE6, 0xEA, 0xAA, 0xAA, 0xAA, 0xD5, 0xAD, 0x69, 0xD9, 0x4D, 0xA7, 0xD9, 0x3E, 0x70, 0xDA,
+    0x29, 0xDA, 0x70, 0xDA, 0x2E, 0x71, 0xE1, 0x9D, 0x97, 0x1A, 0xD7, 0x77, 0x77, 0x59, 0xD7, 0x7A,
+    0xD9, 0x76, 0x9D, 0x77, 0x74, 0x5A, 0x49, 0xA6, 0x9C, 0xA2, 0x9C, 0xA7, 0xFE, 0x70, 0x9F, 0xC9,
+    0x72, 0x99, 0x77, 0x72, 0x9A, 0xDA, 0x2A, 0xA4, 0xAF, 0xD0, 0x9D, 0x3F, 0x99, 0x9F, 0xA2, 0xAD,
+    0xA3, 0x9E, 0x92, 0xE5, 0xE2, 0xAD, 0x6E, 0x2E, 0x6D, 0xA2, 0xDA, 0x6D, 0xA1, 0x9D, 0x95, 0x9D,
+    0x91, 0xAD, 0x6A, 0xD2, 0xAD, 0x6E, 0x2A, 0xD5, 0xAD, 0xA2, 0x9D, 0x49, 0xE9, 0x3E, 0x2A, 0xCA,
+    0xD9, 0x3A, 0xFD, 0xA0, 0xD5, 0xAF, 0x90, 0x9D, 0x79, 0x77, 0x76, 0xD7, 0x4A, 0xD9, 0x73, 0x9D,
+    0x77, 0x71, 0x39, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9,
+    0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9,
+    0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39,
+    0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD7, 0x77, 0x77, 0x0D, 0x97, 0x39, 0xDA,
+    0x74, 0xD7, 0x77, 0x10, 0x49, 0xAE, 0xA5, 0xAF, 0xE3, 0xEA, 0x90, 0xAD, 0xA1, 0xAD, 0x93, 0xDA,
+    0x1D, 0xA4, 0xDA, 0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x29, 0xAD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xEA,
+    0x3A, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC3, 0x9F,
+    0xDA, 0x79, 0x97, 0x75, 0x9D, 0x71, 0xAD, 0x97, 0x09, 0xD7, 0x73, 0x70, 0xAA, 0xA9, 0x72, 0x9F,
+    0x97, 0x49, 0xCA, 0x74, 0xAC, 0xA7, 0x2A, 0xDA, 0x73, 0xD7, 0x5C, 0x97, 0x77, 0x09, 0xFF, 0xD4,
+    0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74,
+    0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99, 0x5D, 0xA7,
+    0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99, 0x99, 0x94,
+    0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0x6A, 0xDA, 0x70, 0xAA, 0xE7, 0x2D, 0x71, 0x9D, 0x79, 0xE7, 0x0A,
+    0xC9, 0x71, 0xAC, 0x77, 0x59, 0xAE, 0xA5, 0xAF, 0xE3, 0xEA, 0x90, 0xAD, 0xA1, 0xAD, 0x93, 0xDA,
+    0x1D, 0xA4, 0xDA, 0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x29, 0xAD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xEA,
+    0x3A, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC3, 0x9F,
+    0xDA, 0x79, 0x95, 0x79, 0x93, 0x99, 0x59, 0xF2, 0xCA, 0x5D, 0xAF, 0xD5, 0xAC, 0x2A, 0xE9, 0x69,
+    0x49, 0x77, 0x69, 0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9,
+    0x73, 0xAD, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9,
+    0x99, 0x99, 0x99, 0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39,
+    0xDA, 0x99, 0x99, 0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0x59, 0x94, 0x95, 0xF9, 0x1D, 0x4A,
+    0xFF, 0xA4, 0xCA, 0x19, 0xEA, 0x59, 0x49, 0x77, 0x79, 0xAE, 0xA7, 0xAF, 0xE5, 0xEA, 0x90, 0xAD,
+    0xA3, 0xAD, 0x93, 0xDA, 0x3D, 0xA4, 0xDA, 0x2A, 0xD4, 0x9D, 0x92, 0xDA, 0x29, 0xAD, 0xA2, 0x9F,
+    0xFC, 0xA3, 0x9F, 0xEA, 0x5A, 0xD9, 0x72, 0xAD, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3E, 0x93, 0x9A,
+    0x49, 0xFF, 0xC5, 0x9F, 0xDA, 0x71, 0x99, 0x70, 0x77, 0xD9, 0x76, 0xD9, 0x71, 0xE9, 0x0D, 0x97,
+    0x1F, 0xC0, 0x97, 0x2D, 0x90, 0xD9, 0x72, 0xD3, 0xAC, 0x77, 0x77, 0x76, 0x9F, 0xFD, 0x7A, 0xFF,
+    0xD7, 0xE9, 0x99, 0x99, 0x99, 0x97, 0xD9, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x7A, 0xD7, 0x7D, 0xA7,
+    0x7D, 0x97, 0x69, 0xFF, 0xCA, 0x7A, 0xFF, 0xC9, 0x7E, 0x99, 0x99, 0x99, 0x97, 0x0D, 0xA7, 0x7D,
+    0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x7D, 0xA7, 0x7D, 0xA7, 0x69, 0xDA, 0x99, 0x99, 0x99, 0x97, 0x9F,
+    0xFD, 0x7A, 0xFF, 0xD7, 0x75, 0xAA, 0xA7, 0x59, 0xD7, 0x09, 0xD9, 0x09, 0xD7, 0x09, 0xF0, 0xA9,
+    0x70, 0x9D, 0x0A, 0xCA, 0x71, 0x9C, 0xA2, 0xAC, 0x97, 0x09, 0x77, 0x77, 0x39, 0xAE, 0xA7, 0x2A,
+    0xFE, 0x70, 0xEA, 0x90, 0xAD, 0xA6, 0xAD, 0x93, 0xDA, 0x6D, 0xA4, 0xDA, 0x5A, 0xD4, 0x9D, 0x95,
+    0xDA, 0x29, 0xAD, 0xA5, 0x9F, 0xFC, 0xA6, 0x9F, 0xEA, 0x70, 0xAD, 0x97, 0x5A, 0xD7, 0x6A, 0xD7,
+    0x69, 0xD9, 0x76, 0xE9, 0x39, 0xA7, 0x9F, 0xFC, 0x70, 0x9F, 0xDA, 0x74, 0x99, 0x72, 0x29, 0xCA,
+    0x75, 0xAC, 0x97, 0x5D, 0x1E, 0x97, 0x09, 0x0F, 0xC7, 0x1D, 0x90, 0xD9, 0x7D, 0x3A, 0xC7, 0x77,
+    0x75, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xD9, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xFF, 0xCA, 0x4A, 0xFF, 0xC9, 0x4E, 0x99, 0x99,
+    0x99, 0x95, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0xA9,
+    0x99, 0x99, 0x99, 0x49, 0xFF, 0xD4, 0xAF, 0xFD, 0x40, 0x1A, 0xA7, 0x2A, 0xCA, 0x72, 0xAC, 0x19,
+    0xD9, 0x5A, 0x99, 0xF6, 0x9D, 0x0A, 0xCA, 0x49, 0xCA, 0x2A, 0xC9, 0x39, 0x77, 0x71, 0x9A, 0xEA,
+    0x5A, 0xFE, 0x3E, 0xA9, 0x0A, 0xDA, 0x1A, 0xD9, 0x3D, 0xA1, 0xDA, 0x4D, 0xA0, 0xAD, 0x49, 0xD9,
+    0x0D, 0xA2, 0x9A, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFE, 0xA3, 0xAD, 0x97, 0x0A, 0xD7, 0x1A, 0xD7,
+    0x19, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC, 0x39, 0xFD, 0xA7, 0x99, 0x50, 0x77, 0x77, 0xE7,
+    0x70, 0xCA, 0x75, 0x9A, 0xC7, 0x1E, 0x90, 0xCA, 0x71, 0xFC, 0x73, 0xD9, 0x0D, 0x97, 0x1D, 0x3A,
+    0xC7, 0x77, 0x77, 0x39, 0xFF, 0xD6, 0xAF, 0xFD, 0x6E, 0x99, 0x99, 0x99, 0x99, 0x6D, 0x97, 0x59,
+    0xD9, 0x75, 0xAD, 0x76, 0xAD, 0x76, 0xDA, 0x76, 0xD9, 0x75, 0x9F, 0xFC, 0xA6, 0xAF, 0xFC, 0x96,
+    0xE9, 0x99, 0x99, 0x99, 0x7D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x6D, 0xA7, 0x6D, 0xA7,
+    0x59, 0xDA, 0x99, 0x99, 0x99, 0x96, 0x9F, 0xFD, 0x6A, 0xFF, 0xD6, 0x77, 0x73, 0xE9, 0x75, 0xD7,
+    0x49, 0xCA, 0x69, 0xD9, 0x0A, 0xCA, 0x69, 0xF0, 0x97, 0x9D, 0x0A, 0xCA, 0x79, 0xCA, 0x2A, 0xC9,
+    0x69, 0x77, 0x77, 0x9A, 0xEA, 0x70, 0xAF, 0xE6, 0xEA, 0x90, 0xAD, 0xA4, 0xAD, 0x93, 0xDA, 0x4D,
+    0xA4, 0xDA, 0x3A, 0xD4, 0x9D, 0x93, 0xDA, 0x29, 0xAD, 0xA3, 0x9F, 0xFC, 0xA4, 0x9F, 0xEA, 0x6A,
+    0xD9, 0x73, 0xAD, 0x74, 0xAD, 0x74, 0x9D, 0x97, 0x4E, 0x93, 0x9A, 0x59, 0xFF, 0xC6, 0x9F, 0xDA,
+    0x72, 0x99, 0x70, 0x69, 0xDA, 0x91, 0x9C, 0x96, 0xFD, 0xAD, 0x6A, 0xC2, 0xAE, 0x77, 0x73, 0xE9,
+    0x73, 0xFA, 0x72, 0xD9, 0x0D, 0x97, 0x0D, 0x3A, 0xC7, 0x77, 0x77, 0x09, 0xFF, 0xD5, 0xAF, 0xFD,
+    0x5E, 0x99, 0x99, 0x99, 0x99, 0x5D, 0x97, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xAD, 0x75, 0xDA, 0x75,
+    0xD9, 0x74, 0x9F, 0xFC, 0xA5, 0xAF, 0xFC, 0x95, 0xE9, 0x99, 0x99, 0x99, 0x6D, 0xA7, 0x5D, 0x97,
+    0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x5D, 0xA7, 0x49, 0xDA, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFD,
+    0x5A, 0xFF, 0xD5, 0x59, 0xAA, 0x92, 0xAA, 0x4A, 0xFC, 0x9A, 0xC9, 0x4C, 0xA0, 0x9A, 0xEA, 0x59,
+    0x49, 0x71, 0x9D, 0x97, 0x19, 0xF7, 0x09, 0xD0, 0xAC, 0xA6, 0x9C, 0xA2, 0xAC, 0x95, 0x97, 0x77,
+    0x59, 0xAE, 0xA7, 0xAF, 0xE5, 0xEA, 0x90, 0xAD, 0xA3, 0xAD, 0x93, 0xDA, 0x3D, 0xA4, 0xDA, 0x2A,
+    0xD4, 0x9D, 0x92, 0xDA, 0x29, 0xAD, 0xA2, 0x9F, 0xFC, 0xA3, 0x9F, 0xEA, 0x5A, 0xD9, 0x72, 0xAD,
+    0x73, 0xAD, 0x73, 0x9D, 0x97, 0x3E, 0x93, 0x9A, 0x49, 0xFF, 0xC5, 0x9F, 0xDA, 0x71, 0x99, 0x70,
+    0x71, 0x99, 0x74, 0xE9, 0x72, 0xFC, 0x71, 0xDA, 0x0D, 0xA7, 0xD9, 0x2D, 0x79, 0x59, 0x77, 0x59,
+    0xFF, 0xD4, 0xAF, 0xFD, 0x4E, 0x99, 0x99, 0x99, 0x99, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x74,
+    0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73, 0x9F, 0xFC, 0xA4, 0xAF, 0xFC, 0x94, 0xE9, 0x99, 0x99, 0x99,
+    0x5D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x99, 0x99,
+    0x99, 0x94, 0x9F, 0xFD, 0x4A, 0xFF, 0xD7, 0x77, 0x77, 0x0D, 0x97, 0x39, 0xDA, 0x74, 0xD7, 0x77,
+    0x10, 0x79, 0x97, 0x1A, 0xE7, 0xAF, 0x95, 0xAD, 0x09, 0xD4, 0xAC, 0xA2, 0xAC, 0xA3, 0x95, 0x99,
+    0x77, 0x19, 0xAE, 0xA5, 0xAF, 0xE3, 0xEA, 0x90, 0xAD, 0xA1, 0xAD, 0x93, 0xDA, 0x1D, 0xA4, 0xDA,
+    0x0A, 0xD4, 0x9D, 0x90, 0xDA, 0x29, 0xAD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xEA, 0x3A, 0xD9, 0x70,
+    0xAD, 0x71, 0xAD, 0x71, 0x9D, 0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC3, 0x9F, 0xDA, 0x79, 0x97,
+    0x75, 0x9D, 0x71, 0xAD, 0x97, 0x09, 0xD7, 0x73, 0x7A, 0xAA, 0x70, 0x9F, 0x97, 0x1A, 0xCA, 0x71,
+    0xAC, 0x97, 0xAD, 0xA7, 0x0C, 0xA7, 0x19, 0xC9, 0x77, 0x4F, 0xE4, 0x9F, 0xDA, 0x69, 0xD9, 0x70,
+    0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x1D,
+    0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD, 0x7A,
+    0xFC, 0xA4, 0x9F, 0xE4, 0x4E, 0xA5, 0xAA, 0xDA, 0x69, 0xCA, 0x6D, 0x94, 0xEA, 0x5D, 0x7C, 0x97,
+    0x70, 0xAA, 0x96, 0xD9, 0x59, 0xD9, 0x5A, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6E,
+    0x6D, 0xA6, 0xD9, 0x59, 0xD6, 0xAD, 0x6D, 0xA6, 0xD9, 0x50, 0x4F, 0xE4, 0x9F, 0xDA, 0x69, 0xD9,
+    0x70, 0xAD, 0x71, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x1D, 0xA7,
+    0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAD,
+    0x7A, 0xFC, 0xA4, 0x9F, 0xE7, 0x77, 0x70, 0xAC, 0xA7, 0x1E, 0x71, 0xD9, 0x77, 0x40, 0x69, 0x6E,
+    0x5E, 0x5A, 0xA7, 0x77, 0xAA, 0x95, 0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x49,
+    0xD5, 0xAD, 0x5E, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D, 0xA5, 0xD9, 0x77, 0x6A, 0xCA, 0x5E,
+    0x5D, 0x97, 0x50, 0x77, 0x71, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E,
+    0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D,
+    0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0,
+    0xE7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E,
+    0x93, 0x9E, 0xA3, 0xAE, 0xA5, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x77, 0x71, 0x9D,
+    0x77, 0xE7, 0x7A, 0xCA, 0x77, 0x75, 0x49, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD,
+    0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09,
+    0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9,
+    0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x77, 0x76, 0xAC, 0xA7, 0x3E, 0x73, 0xD9, 0x77, 0x60,
+    0x71, 0x9A, 0xAA, 0x76, 0xAF, 0x77, 0x0D, 0x97, 0x7D, 0x76, 0xE9, 0x75, 0x9C, 0xA7, 0x7A, 0xC7,
+    0x77, 0x70, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD,
+    0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0,
+    0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9,
+    0x0E, 0x72, 0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3,
+    0xAE, 0xA5, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x10, 0x69, 0xE9, 0x72, 0xAA, 0xD9,
+    0x73, 0x9C, 0xA7, 0x3D, 0x97, 0x1E, 0xA7, 0x2C, 0xA7, 0x4C, 0x97, 0x77, 0x09, 0xAD, 0xA9, 0x7A,
+    0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA,
+    0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6,
+    0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x73, 0x77, 0x0A,
+    0xD7, 0x70, 0x9D, 0x73, 0x9D, 0xA0, 0x9C, 0xA7, 0x39, 0xF9, 0x99, 0x73, 0x9D, 0x09, 0xD7, 0x4A,
+    0xC9, 0x29, 0xC9, 0x77, 0x77, 0x77, 0x5A, 0xFC, 0xA9, 0x72, 0xAF, 0xFC, 0xA7, 0x0F, 0x91, 0x9A,
+    0xEA, 0x6E, 0xA6, 0xE5, 0xAD, 0xA7, 0x9D, 0xA4, 0xE7, 0x1E, 0x3A, 0xD9, 0x71, 0xE3, 0xE7, 0x2A,
+    0xD2, 0x9D, 0xA7, 0x2A, 0xD2, 0xAD, 0x97, 0x2A, 0xD2, 0xAD, 0x73, 0xE2, 0xE7, 0x3E, 0x2E, 0x72,
+    0x9D, 0xA2, 0xE7, 0x2A, 0xD9, 0x2E, 0x72, 0xE3, 0xAD, 0x71, 0xAD, 0xA3, 0x9D, 0xA7, 0x0E, 0x5E,
+    0x95, 0x9E, 0x95, 0x9E, 0xA3, 0xAE, 0xA7, 0xAF, 0xFD, 0x97, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x30,
+    0x75, 0x9A, 0xA7, 0x59, 0xD9, 0x70, 0xDA, 0x1D, 0x71, 0xF9, 0x9A, 0x71, 0xD9, 0x9D, 0x71, 0x9C,
+    0xA2, 0x9C, 0x97, 0x09, 0x69, 0x77, 0x73, 0x9A, 0xDA, 0x97, 0x2A, 0xFE, 0x70, 0xEA, 0x99, 0xAE,
+    0x6A, 0xD9, 0x39, 0xDA, 0x49, 0xDA, 0x5E, 0x4A, 0xD6, 0xAD, 0x4D, 0xA6, 0xAD, 0x39, 0xD9, 0x6A,
+    0xD3, 0x9D, 0x7E, 0x3A, 0xD7, 0xDA, 0x3A, 0xD6, 0x9D, 0x93, 0x9D, 0x6E, 0x49, 0xDA, 0x49, 0xD9,
+    0x5E, 0x92, 0xAD, 0xA7, 0xFF, 0xA7, 0x1A, 0xFC, 0x97, 0x77, 0x10, 0x4D, 0x77, 0x1D, 0x77, 0x09,
+    0xC9, 0x09, 0xDA, 0x73, 0x99, 0x9F, 0x97, 0x39, 0xD0, 0x9D, 0x72, 0xAC, 0x92, 0x9C, 0x97, 0x77,
+    0x77, 0x7A, 0xFC, 0xA9, 0x70, 0xAF, 0xFC, 0xA6, 0xF9, 0x19, 0xAE, 0xA4, 0xEA, 0x6E, 0x3A, 0xDA,
+    0x79, 0xDA, 0x2E, 0x71, 0xE1, 0xAD, 0x97, 0x1E, 0x1E, 0x72, 0xAD, 0x09, 0xDA, 0x72, 0xAD, 0x0A,
+    0xD9, 0x72, 0xAD, 0x0A, 0xD7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x29, 0xDA, 0x0E, 0x72, 0xAD, 0x90,
+    0xE7, 0x2E, 0x1A, 0xD7, 0x1A, 0xDA, 0x19, 0xDA, 0x70, 0xE3, 0xE9, 0x59, 0xE9, 0x39, 0xEA, 0x3A,
+    0xEA, 0x5A, 0xFF, 0xD9, 0x70, 0xAF, 0xDA, 0x75, 0x99, 0x71, 0x1A, 0xA7, 0x49, 0xCA, 0x74, 0x9C,
+    0x91, 0xDA, 0x79, 0x90, 0xF9, 0x70, 0xD9, 0x9D, 0x69, 0xCA, 0x29, 0xC9, 0x59, 0x69, 0x77, 0x59,
+    0xAD, 0xA9, 0x7A, 0xFE, 0x5E, 0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD,
+    0x6A, 0xD1, 0xDA, 0x6A, 0xD0, 0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69,
+    0xD9, 0x09, 0xD6, 0xE1, 0x9D, 0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97,
+    0x73, 0x77, 0x77, 0x2A, 0xDA, 0x77, 0x1A, 0xC7, 0x70, 0x9C, 0xA7, 0x29, 0xDA, 0x0A, 0xC9, 0x72,
+    0x9F, 0x97, 0x49, 0xD0, 0x9D, 0x73, 0xAC, 0x92, 0x9C, 0x97, 0x77, 0x77, 0x72, 0xAF, 0xCA, 0x97,
+    0x1A, 0xFF, 0xCA, 0x7F, 0x91, 0x9A, 0xEA, 0x5E, 0xA6, 0xE4, 0xAD, 0xA7, 0x9D, 0xA3, 0xE7, 0x1E,
+    0x2A, 0xD9, 0x71, 0xE2, 0xE7, 0x2A, 0xD1, 0x9D, 0xA7, 0x2A, 0xD1, 0xAD, 0x97, 0x2A, 0xD1, 0xAD,
+    0x73, 0xE1, 0xE7, 0x3E, 0x1E, 0x72, 0x9D, 0xA1, 0xE7, 0x2A, 0xD9, 0x1E, 0x72, 0xE2, 0xAD, 0x71,
+    0xAD, 0xA2, 0x9D, 0xA7, 0x0E, 0x4E, 0x95, 0x9E, 0x94, 0x9E, 0xA3, 0xAE, 0xA6, 0xAF, 0xFD, 0x97,
+    0x1A, 0xFD, 0xA7, 0x69, 0x97, 0x20, 0x77, 0x74, 0xAD, 0xA7, 0x6A, 0xC7, 0x6D, 0x70, 0xDA, 0x09,
+    0xCA, 0x70, 0xF9, 0x09, 0x70, 0xD9, 0x9D, 0x70, 0x9C, 0xA2, 0x9C, 0x97, 0x96, 0x97, 0x77, 0x19,
+    0xAD, 0xA9, 0x71, 0xAF, 0xE7, 0xEA, 0x99, 0xAE, 0x5A, 0xD9, 0x39, 0xDA, 0x39, 0xDA, 0x5E, 0x3A,
+    0xD6, 0xAD, 0x3D, 0xA6, 0xAD, 0x29, 0xD9, 0x6A, 0xD2, 0x9D, 0x7E, 0x2A, 0xD7, 0xDA, 0x2A, 0xD6,
+    0x9D, 0x92, 0x9D, 0x6E, 0x39, 0xDA, 0x49, 0xD9, 0x4E, 0x92, 0xAD, 0xA6, 0xFF, 0xA7, 0x0A, 0xFC,
+    0x97, 0x77, 0x70, 0xAD, 0xA2, 0xAC, 0x70, 0xAF, 0xCA, 0xD9, 0x70, 0xCA, 0x19, 0xEA, 0x77, 0x76,
+    0x9D, 0xA7, 0x59, 0xF9, 0x73, 0x9D, 0x09, 0xD7, 0x2A, 0xC9, 0x29, 0xCA, 0x77, 0x77, 0x77, 0xAF,
+    0xCA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2,
+    0xE7, 0x1E, 0x1A, 0xD9, 0x71, 0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A,
+    0xD0, 0xAD, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1,
+    0xAD, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3, 0xAE, 0xA5, 0xAF,
+    0xFD, 0x97, 0x0A, 0xFD, 0xA7, 0x59, 0x97, 0x10, 0x59, 0xAA, 0x92, 0x9A, 0x59, 0xFC, 0x9A, 0xCA,
+    0x5D, 0x1A, 0xF6, 0x94, 0x99, 0x72, 0xDA, 0x73, 0xF9, 0x71, 0xD9, 0x9D, 0x79, 0xCA, 0x29, 0xCA,
+    0x69, 0x69, 0x77, 0x79, 0xAD, 0xA9, 0x70, 0xAF, 0xE6, 0xEA, 0x99, 0xAE, 0x4A, 0xD9, 0x39, 0xDA,
+    0x29, 0xDA, 0x5E, 0x2A, 0xD6, 0xAD, 0x2D, 0xA6, 0xAD, 0x19, 0xD9, 0x6A, 0xD1, 0x9D, 0x7E, 0x1A,
+    0xD7, 0xDA, 0x1A, 0xD6, 0x9D, 0x91, 0x9D, 0x6E, 0x29, 0xDA, 0x49, 0xD9, 0x3E, 0x92, 0xAD, 0xA5,
+    0xFF, 0xA7, 0xAF, 0xC9, 0x77, 0x50, 0x72, 0x99, 0x77, 0xAE, 0x75, 0xAF, 0x97, 0x3A, 0xD0, 0x9D,
+    0x72, 0xAC, 0xA2, 0x9C, 0xA7, 0x19, 0x94, 0x99, 0x77, 0x74, 0xAF, 0xCA, 0x97, 0x0A, 0xFF, 0xCA,
+    0x6F, 0x91, 0x9A, 0xEA, 0x4E, 0xA6, 0xE3, 0xAD, 0xA7, 0x9D, 0xA2, 0xE7, 0x1E, 0x1A, 0xD9, 0x71,
+    0xE1, 0xE7, 0x2A, 0xD0, 0x9D, 0xA7, 0x2A, 0xD0, 0xAD, 0x97, 0x2A, 0xD0, 0xAD, 0x73, 0xE0, 0xE7,
+    0x3E, 0x0E, 0x72, 0x9D, 0xA0, 0xE7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1, 0xAD, 0x71, 0xAD, 0xA1, 0x9D,
+    0xA7, 0x0E, 0x3E, 0x95, 0x9E, 0x93, 0x9E, 0xA3, 0xAE, 0xA5, 0xAF, 0xFD, 0x97, 0x0A, 0xFD, 0xA7,
+    0x59, 0x97, 0x77, 0x71, 0x9D, 0x77, 0xE7, 0x7A, 0xCA, 0x77, 0x75, 0x79, 0x97, 0x3A, 0xE7, 0x19,
+    0xFA, 0x79, 0xD1, 0xD6, 0x9D, 0x29, 0xD5, 0x99, 0x59, 0x77, 0x59, 0xAD, 0xA9, 0x7A, 0xFE, 0x5E,
+    0xA9, 0x9A, 0xE3, 0xAD, 0x93, 0x9D, 0xA1, 0x9D, 0xA5, 0xE1, 0xAD, 0x6A, 0xD1, 0xDA, 0x6A, 0xD0,
+    0x9D, 0x96, 0xAD, 0x09, 0xD7, 0xE0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x09, 0xD6, 0xE1, 0x9D,
+    0xA4, 0x9D, 0x92, 0xE9, 0x2A, 0xDA, 0x4F, 0xFA, 0x6A, 0xFC, 0x97, 0x77, 0x76, 0xAC, 0xA7, 0x3E,
+    0x73, 0xD9, 0x77, 0x60, 0x74, 0x99, 0x97, 0x72, 0xAD, 0x97, 0x71, 0x9D, 0x97, 0x72, 0xD9, 0x77,
+    0x2D, 0x97, 0x73, 0x97, 0x77, 0x6A, 0xD7, 0xAF, 0xCA, 0x4E, 0x5A, 0xFF, 0xCA, 0x19, 0xD9, 0x4F,
+    0x91, 0x9A, 0xEA, 0x9D, 0xA4, 0xEA, 0x6F, 0xC9, 0x4A, 0xDA, 0x79, 0xDA, 0x6E, 0x71, 0xE5, 0xAD,
+    0x97, 0x1E, 0x5E, 0x72, 0xAD, 0x49, 0xDA, 0x72, 0xAD, 0x4A, 0xD9, 0x72, 0xAD, 0x4A, 0xD7, 0x3E,
+    0x4E, 0x73, 0xE4, 0xE7, 0x29, 0xDA, 0x4E, 0x72, 0xAD, 0x94, 0xE7, 0x2E, 0x5A, 0xD7, 0x1A, 0xDA,
+    0x59, 0xDA, 0x70, 0xE7, 0xE9, 0x59, 0xE9, 0x79, 0xEA, 0x3A, 0xEA, 0x71, 0xAF, 0xFD, 0x97, 0x4A,
+    0xFD, 0xA7, 0x71, 0x99, 0x75, 0x72, 0x99, 0x77, 0xE7, 0x6A, 0xD7, 0x69, 0xD7, 0x69, 0xD7, 0x70,
+    0x95, 0xAD, 0x97, 0x6E, 0x59, 0xAD, 0xA9, 0x29, 0xDA, 0x4A, 0xFE, 0x90, 0xE4, 0xEA, 0x99, 0xAF,
+    0xCA, 0x4A, 0xD9, 0x39, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x6A, 0xD5, 0xDA, 0x6A, 0xD4, 0x9D, 0x96,
+    0xAD, 0x49, 0xD7, 0xE4, 0xAD, 0x7D, 0xA4, 0xAD, 0x69, 0xD9, 0x49, 0xD6, 0xE5, 0x9D, 0xA4, 0x9D,
+    0x96, 0xE9, 0x2A, 0xDA, 0x70, 0xFF, 0xA7, 0x2A, 0xFC, 0x97, 0x77, 0x30, 0x79, 0x99, 0x77, 0x3A,
+    0xD7, 0x74, 0xD9, 0x77, 0x39, 0xD7, 0x74, 0xAC, 0xA7, 0x74, 0x99, 0x77, 0x74, 0xAD, 0x7A, 0xFC,
+    0xA4, 0xE5, 0xAF, 0xFC, 0xA1, 0x9D, 0x94, 0xF9, 0x19, 0xAE, 0xA9, 0xDA, 0x4E, 0xA6, 0xFC, 0x94,
+    0xAD, 0xA7, 0x9D, 0xA6, 0xE7, 0x1E, 0x5A, 0xD9, 0x71, 0xE5, 0xE7, 0x2A, 0xD4, 0x9D, 0xA7, 0x2A,
+    0xD4, 0xAD, 0x97, 0x2A, 0xD4, 0xAD, 0x73, 0xE4, 0xE7, 0x3E, 0x4E, 0x72, 0x9D, 0xA4, 0xE7, 0x2A,
+    0xD9, 0x4E, 0x72, 0xE5, 0xAD, 0x71, 0xAD, 0xA5, 0x9D, 0xA7, 0x0E, 0x7E, 0x95, 0x9E, 0x97, 0x9E,
+    0xA3, 0xAE, 0xA7, 0x1A, 0xFF, 0xD9, 0x74, 0xAF, 0xDA, 0x77, 0x19, 0x97, 0x50, 0x59, 0x97, 0x70,
+    0xE7, 0x79, 0xD7, 0x70, 0xAC, 0xA7, 0x70, 0xD9, 0x77, 0x09, 0x4A, 0xD9, 0x76, 0xE5, 0x9A, 0xDA,
+    0x92, 0x9D, 0xA4, 0xAF, 0xE9, 0x0E, 0x4E, 0xA9, 0x9A, 0xFC, 0xA4, 0xAD, 0x93, 0x9E, 0x59, 0xDA,
+    0x5E, 0x5A, 0xD6, 0xAD, 0x5D, 0xA6, 0xAD, 0x49, 0xD9, 0x6A, 0xD4, 0x9D, 0x7E, 0x4A, 0xD7, 0xDA,
+    0x4A, 0xD6, 0x9D, 0x94, 0x9D, 0x6E, 0x59, 0xDA, 0x49, 0xD9, 0x6E, 0x92, 0xAD, 0xA7, 0x0F, 0xFA,
+    0x72, 0xAF, 0xC9, 0x77, 0x73, 0x71, 0x9A, 0xAA, 0x77, 0x2A, 0xF7, 0x74, 0xD9, 0x77, 0x3D, 0x77,
+    0x2E, 0x97, 0x71, 0x9C, 0xA7, 0x73, 0xAC, 0x77, 0x75, 0xAD, 0x7A, 0xFC, 0xA4, 0xE5, 0xAF, 0xFC,
+    0xA1, 0x9D, 0x94, 0xF9, 0x19, 0xAE, 0xA9, 0xDA, 0x4E, 0xA6, 0xFC, 0x94, 0xAD, 0xA7, 0x9D, 0xA6,
+    0xE7, 0x1E, 0x5A, 0xD9, 0x71, 0xE5, 0xE7, 0x2A, 0xD4, 0x9D, 0xA7, 0x2A, 0xD4, 0xAD, 0x97, 0x2A,
+    0xD4, 0xAD, 0x73, 0xE4, 0xE7, 0x3E, 0x4E, 0x72, 0x9D, 0xA4, 0xE7, 0x2A, 0xD9, 0x4E, 0x72, 0xE5,
+    0xAD, 0x71, 0xAD, 0xA5, 0x9D, 0xA7, 0x0E, 0x7E, 0x95, 0x9E, 0x97, 0x9E, 0xA3, 0xAE, 0xA7, 0x1A,
+    0xFF, 0xD9, 0x74, 0xAF, 0xDA, 0x77, 0x19, 0x97, 0x50, 0x69, 0xE9, 0x76, 0xAA, 0xD9, 0x77, 0x9C,
+    0xA7, 0x7D, 0x97, 0x5E, 0xA7, 0x6C, 0xA7, 0x70, 0xC9, 0x4A, 0xD9, 0x76, 0xE5, 0x9A, 0xDA, 0x92,
+    0x9D, 0xA4, 0xAF, 0xE9, 0x0E, 0x4E, 0xA9, 0x9A, 0xFC, 0xA4, 0xAD, 0x93, 0x9E, 0x59, 0xDA, 0x5E,
+    0x5A, 0xD6, 0xAD, 0x5D, 0xA6, 0xAD, 0x49, 0xD9, 0x6A, 0xD4, 0x9D, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A,
+    0xD6, 0x9D, 0x94, 0x9D, 0x6E, 0x59, 0xDA, 0x49, 0xD9, 0x6E, 0x92, 0xAD, 0xA7, 0x0F, 0xFA, 0x72,
+    0xAF, 0xC9, 0x77, 0x73, 0x70, 0x94, 0x99, 0x74, 0xAF, 0x19, 0xC9, 0x74, 0xDA, 0xFD, 0x74, 0xAC,
+    0x2A, 0xE9, 0x74, 0x95, 0x97, 0x77, 0x3A, 0xD7, 0xAF, 0xCA, 0x4E, 0x5A, 0xFF, 0xCA, 0x19, 0xD9,
+    0x4F, 0x91, 0x9A, 0xEA, 0x9D, 0xA4, 0xEA, 0x6F, 0xC9, 0x4A, 0xDA, 0x79, 0xDA, 0x6E, 0x71, 0xE5,
+    0xAD, 0x97, 0x1E, 0x5E, 0x72, 0xAD, 0x49, 0xDA, 0x72, 0xAD, 0x4A, 0xD9, 0x72, 0xAD, 0x4A, 0xD7,
+    0x3E, 0x4E, 0x73, 0xE4, 0xE7, 0x29, 0xDA, 0x4E, 0x72, 0xAD, 0x94, 0xE7, 0x2E, 0x5A, 0xD7, 0x1A,
+    0xDA, 0x59, 0xDA, 0x70, 0xE7, 0xE9, 0x59, 0xE9, 0x79, 0xEA, 0x3A, 0xEA, 0x71, 0xAF, 0xFD, 0x97,
+    0x4A, 0xFD, 0xA7, 0x71, 0x99, 0x75, 0x59, 0x94, 0x97, 0x1A, 0xEA, 0x1A, 0xC7, 0x09, 0xFF, 0xC7,
+    0x0D, 0x2F, 0x71, 0x95, 0x92, 0xAD, 0x97, 0x6E, 0x59, 0xAD, 0xA9, 0x29, 0xDA, 0x4A, 0xFE, 0x90,
+    0xE4, 0xEA, 0x99, 0xAF, 0xCA, 0x4A, 0xD9, 0x39, 0xE5, 0x9D, 0xA5, 0xE5, 0xAD, 0x6A, 0xD5, 0xDA,
+    0x6A, 0xD4, 0x9D, 0x96, 0xAD, 0x49, 0xD7, 0xE4, 0xAD, 0x7D, 0xA4, 0xAD, 0x69, 0xD9, 0x49, 0xD6,
+    0xE5, 0x9D, 0xA4, 0x9D, 0x96, 0xE9, 0x2A, 0xDA, 0x70, 0xFF, 0xA7, 0x2A, 0xFC, 0x97, 0x77, 0x30,
+    0x77, 0x77, 0x71, 0xAD, 0x7A, 0xFC, 0xA4, 0xE5, 0xAF, 0xFC, 0xA1, 0x9D, 0x94, 0xF9, 0x19, 0xAE,
+    0xA9, 0xDA, 0x4E, 0xA6, 0xFC, 0x94, 0xAD, 0xA7, 0x9D, 0xA6, 0xE7, 0x1E, 0x5A, 0xD9, 0x71, 0xE5,
+    0xE7, 0x2A, 0xD4, 0x9D, 0xA7, 0x2A, 0xD4, 0xAD, 0x97, 0x2A, 0xD4, 0xAD, 0x73, 0xE4, 0xE7, 0x3E,
+    0x4E, 0x72, 0x9D, 0xA4, 0xE7, 0x2A, 0xD9, 0x4E, 0x72, 0xE5, 0xAD, 0x71, 0xAD, 0xA5, 0x9D, 0xA7,
+    0x0E, 0x7E, 0x95, 0x9E, 0x97, 0x9E, 0xA3, 0xAE, 0xA7, 0x1A, 0xFF, 0xD9, 0x74, 0xAF, 0xDA, 0x77,
+    0x19, 0x97, 0x77, 0x77, 0x1D, 0x97, 0x72, 0x9D, 0xA7, 0x73, 0xD7, 0x77, 0x76, 0x77, 0x77, 0x1A,
+    0xD9, 0x76, 0xE5, 0x9A, 0xDA, 0x92, 0x9D, 0xA4, 0xAF, 0xE9, 0x0E, 0x4E, 0xA9, 0x9A, 0xFC, 0xA4,
+    0xAD, 0x93, 0x9E, 0x59, 0xDA, 0x5E, 0x5A, 0xD6, 0xAD, 0x5D, 0xA6, 0xAD, 0x49, 0xD9, 0x6A, 0xD4,
+    0x9D, 0x7E, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0x94, 0x9D, 0x6E, 0x59, 0xDA, 0x49, 0xD9, 0x6E,
+    0x92, 0xAD, 0xA7, 0x0F, 0xFA, 0x72, 0xAF, 0xC9, 0x77, 0x77, 0x77, 0x2D, 0x77, 0xAD, 0x97, 0x69,
+    0xD7, 0x77, 0x70, 0x2A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71,
+    0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D,
+    0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70,
+    0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A, 0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39,
+    0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79, 0xFE, 0xA7, 0x59, 0x97, 0x77, 0x72, 0xD9,
+    0x76, 0xAD, 0x97, 0x69, 0xD7, 0x77, 0x60, 0x2A, 0xA9, 0x59, 0xAA, 0x29, 0xD9, 0x5A, 0xD2, 0x9D,
+    0x6D, 0xA2, 0xAD, 0x6D, 0x92, 0xDA, 0x59, 0xD3, 0xD9, 0x5A, 0xD2, 0x9D, 0x95, 0xDA, 0x2A, 0xD6,
+    0xDA, 0x2E, 0x59, 0xD9, 0x2D, 0xA5, 0xAD, 0x3D, 0x95, 0xE2, 0x9D, 0x94, 0xAD, 0xA2, 0x9D, 0x49,
+    0xE9, 0x29, 0xDA, 0x2A, 0xCA, 0xD9, 0x3F, 0xEA, 0x0D, 0x5F, 0xC9, 0x09, 0xD7, 0x97, 0x77, 0x59,
+    0xD7, 0x4A, 0xD9, 0x73, 0x9D, 0x77, 0x71, 0x70, 0x9A, 0xAA, 0x76, 0x9F, 0x77, 0x0A, 0xC9, 0x77,
+    0xD9, 0x75, 0xAD, 0xA7, 0x59, 0xCA, 0x77, 0x9C, 0x97, 0x77, 0x4A, 0xCA, 0x70, 0xAD, 0x3D, 0xA7,
+    0x0E, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x71, 0xD9, 0x2A, 0xD7, 0x09, 0xD3, 0xE7, 0x0A, 0xD3, 0xDA,
+    0x70, 0xDA, 0x3D, 0x97, 0x0D, 0xA2, 0x9D, 0x70, 0x9D, 0x92, 0xAD, 0x70, 0xAD, 0x3D, 0xA7, 0x0A,
+    0xD3, 0xDA, 0x70, 0xDA, 0x29, 0xD9, 0x70, 0xD9, 0x29, 0xD7, 0x09, 0xD3, 0xAD, 0x70, 0xAD, 0x3A,
+    0xD7, 0x0D, 0xA3, 0xAD, 0x79, 0xD9, 0x39, 0xD9, 0x6E, 0x5E, 0xA3, 0xAE, 0x69, 0xFF, 0xD9, 0x79,
+    0xFE, 0xA7, 0x59, 0x97, 0x20, 0x7A, 0xDA, 0x73, 0xAA, 0xE7, 0x5D, 0x74, 0x9D, 0x72, 0x9E, 0x73,
+    0xAC, 0x75, 0xAA, 0x77, 0x70, 0xAA, 0x95, 0x9A, 0xA2, 0x9D, 0x95, 0xAD, 0x29, 0xD6, 0xDA, 0x2A,
+    0xD6, 0xD9, 0x2D, 0xA5, 0x9D, 0x3D, 0x95, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xAD, 0x6D, 0xA2, 0xE5,
+    0x9D, 0x92, 0xDA, 0x5A, 0xD3, 0xD9, 0x5E, 0x29, 0xD9, 0x4A, 0xDA, 0x29, 0xD4, 0x9E, 0x92, 0x9D,
+    0xA2, 0xAC, 0xAD, 0x93, 0xFE, 0xA0, 0xD5, 0xFC, 0x90, 0x9D, 0x79, 0x72, 0x74, 0x99, 0x77, 0x4E,
+    0x77, 0x3A, 0xD9, 0x77, 0x29, 0xD9, 0x77, 0x3D, 0x77, 0x59, 0x77, 0x77, 0x0A, 0xD3, 0xAC, 0xA7,
+    0x0A, 0xD1, 0xE3, 0xDA, 0x70, 0xE0, 0x9D, 0x93, 0xD9, 0x70, 0xDA, 0x9D, 0xA3, 0x9D, 0x71, 0xFC,
+    0x94, 0xAD, 0x70, 0x9D, 0xA9, 0x6E, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xDA,
+    0x79, 0xD7, 0x09, 0xD9, 0x7A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7,
+    0x9D, 0x97, 0x0D, 0x97, 0x9D, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70,
+    0xAD, 0x79, 0xD9, 0x70, 0x9D, 0xA6, 0xE7, 0x2E, 0xA3, 0xAE, 0x97, 0x29, 0xFF, 0xD9, 0x75, 0xAF,
+    0xDA, 0x77, 0x29, 0x97, 0x70, 0x72, 0x99, 0x97, 0x70, 0x9D, 0xA7, 0x70, 0xDA, 0x77, 0x0D, 0xA7,
+    0x70, 0xAC, 0xA7, 0x71, 0x97, 0x9D, 0x97, 0x70, 0xAD, 0x3A, 0xA9, 0x59, 0xAA, 0x1D, 0xA2, 0x9D,
+    0x95, 0xAD, 0x0E, 0x39, 0xD6, 0xFC, 0xA4, 0xAD, 0x6E, 0xA6, 0xDA, 0x59, 0xD7, 0x0D, 0x95, 0xAD,
+    0x79, 0xD9, 0x5D, 0xA7, 0xAD, 0x6D, 0xA7, 0xE5, 0x9D, 0x97, 0xDA, 0x5A, 0xD7, 0x0D, 0x95, 0xE7,
+    0x9D, 0x94, 0xAD, 0xA7, 0x9D, 0x49, 0xE9, 0x79, 0xDA, 0x2A, 0xCA, 0xD9, 0x70, 0xFE, 0xA0, 0xD7,
+    0x2F, 0xC9, 0x09, 0xD7, 0x49, 0x77, 0x79, 0x97, 0x75, 0xE7, 0x75, 0xD9, 0x77, 0x49, 0xD7, 0x75,
+    0xAC, 0x97, 0x75, 0x97, 0x77, 0x7A, 0xD3, 0xAC, 0xA7, 0x0A, 0xD1, 0xE3, 0xDA, 0x70, 0xE0, 0x9D,
+    0x93, 0xD9, 0x70, 0xDA, 0x9D, 0xA3, 0x9D, 0x71, 0xFC, 0x94, 0xAD, 0x70, 0x9D, 0xA9, 0x6E, 0x70,
+    0xAD, 0x70, 0xDA, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xDA, 0x79, 0xD7, 0x09, 0xD9, 0x7A, 0xD7, 0x0A,
+    0xD7, 0x0D, 0xA7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x9D, 0x97, 0x0D, 0x97, 0x9D, 0x70, 0x9D,
+    0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xAD, 0x79, 0xD9, 0x70, 0x9D, 0xA6, 0xE7,
+    0x2E, 0xA3, 0xAE, 0x97, 0x29, 0xFF, 0xD9, 0x75, 0xAF, 0xDA, 0x77, 0x29, 0x97, 0x70, 0x69, 0x97,
+    0x71, 0x9D, 0x97, 0x71, 0xE7, 0x72, 0xD9, 0x77, 0x19, 0xD7, 0x73, 0x95, 0x9D, 0x97, 0x70, 0xAD,
+    0x3A, 0xA9, 0x59, 0xAA, 0x1D, 0xA2, 0x9D, 0x95, 0xAD, 0x0E, 0x39, 0xD6, 0xFC, 0xA4, 0xAD, 0x6E,
+    0xA6, 0xDA, 0x59, 0xD7, 0x0D, 0x95, 0xAD, 0x79, 0xD9, 0x5D, 0xA7, 0xAD, 0x6D, 0xA7, 0xE5, 0x9D,
+    0x97, 0xDA, 0x5A, 0xD7, 0x0D, 0x95, 0xE7, 0x9D, 0x94, 0xAD, 0xA7, 0x9D, 0x49, 0xE9, 0x79, 0xDA,
+    0x2A, 0xCA, 0xD9, 0x70, 0xFE, 0xA0, 0xD7, 0x2F, 0xC9, 0x09, 0xD7, 0x49, 0x77, 0x71, 0xAA, 0xA7,
+    0x73, 0x9F, 0x97, 0x74, 0xAC, 0xA7, 0x74, 0xAC, 0x97, 0x72, 0xAD, 0xA7, 0x73, 0xCA, 0x77, 0x49,
+    0xC9, 0x77, 0x77, 0xAD, 0x3A, 0xCA, 0x70, 0xAD, 0x1E, 0x3D, 0xA7, 0x0E, 0x09, 0xD9, 0x3D, 0x97,
+    0x0D, 0xA9, 0xDA, 0x39, 0xD7, 0x1F, 0xC9, 0x4A, 0xD7, 0x09, 0xDA, 0x96, 0xE7, 0x0A, 0xD7, 0x0D,
+    0xA7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0xA7, 0x9D, 0x70, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA,
+    0x70, 0xAD, 0x70, 0xDA, 0x70, 0xDA, 0x79, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x0A, 0xD7,
+    0x0A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0A, 0xD7, 0x9D, 0x97, 0x09, 0xDA, 0x6E, 0x72, 0xEA, 0x3A,
+    0xE9, 0x72, 0x9F, 0xFD, 0x97, 0x5A, 0xFD, 0xA7, 0x72, 0x99, 0x77, 0x7A, 0xDA, 0x77, 0x0A, 0xAE,
+    0x77, 0x2D, 0x77, 0x19, 0xD7, 0x79, 0xE7, 0x70, 0xAC, 0x97, 0x71, 0xAA, 0x69, 0xD9, 0x77, 0x0A,
+    0xD3, 0xAA, 0x95, 0x9A, 0xA1, 0xDA, 0x29, 0xD9, 0x5A, 0xD0, 0xE3, 0x9D, 0x6F, 0xCA, 0x4A, 0xD6,
+    0xEA, 0x6D, 0xA5, 0x9D, 0x70, 0xD9, 0x5A, 0xD7, 0x9D, 0x95, 0xDA, 0x7A, 0xD6, 0xDA, 0x7E, 0x59,
+    0xD9, 0x7D, 0xA5, 0xAD, 0x70, 0xD9, 0x5E, 0x79, 0xD9, 0x4A, 0xDA, 0x79, 0xD4, 0x9E, 0x97, 0x9D,
+    0xA2, 0xAC, 0xAD, 0x97, 0x0F, 0xEA, 0x0D, 0x72, 0xFC, 0x90, 0x9D, 0x74, 0x97, 0x70, 0x79, 0x94,
+    0x97, 0x6A, 0xEA, 0x19, 0xC9, 0x74, 0x9F, 0xFC, 0x75, 0xD2, 0xF7, 0x69, 0x59, 0x77, 0x75, 0xAD,
+    0x3A, 0xCA, 0x70, 0xAD, 0x1E, 0x3D, 0xA7, 0x0E, 0x09, 0xD9, 0x3D, 0x97, 0x0D, 0xA9, 0xDA, 0x39,
+    0xD7, 0x1F, 0xC9, 0x4A, 0xD7, 0x09, 0xDA, 0x96, 0xE7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D,
+    0x97, 0x0D, 0xA7, 0x9D, 0x70, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0xDA,
+    0x70, 0xDA, 0x79, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7,
+    0x0D, 0xA7, 0x0A, 0xD7, 0x9D, 0x97, 0x09, 0xDA, 0x6E, 0x72, 0xEA, 0x3A, 0xE9, 0x72, 0x9F, 0xFD,
+    0x97, 0x5A, 0xFD, 0xA7, 0x72, 0x99, 0x77, 0x69, 0x93, 0x99, 0x72, 0x9F, 0x91, 0xCA, 0x72, 0xDA,
+    0xFD, 0x72, 0x9C, 0x91, 0xAE, 0x97, 0x39, 0x49, 0x49, 0xD9, 0x77, 0x0A, 0xD3, 0xAA, 0x95, 0x9A,
+    0xA1, 0xDA, 0x29, 0xD9, 0x5A, 0xD0, 0xE3, 0x9D, 0x6F, 0xCA, 0x4A, 0xD6, 0xEA, 0x6D, 0xA5, 0x9D,
+    0x70, 0xD9, 0x5A, 0xD7, 0x9D, 0x95, 0xDA, 0x7A, 0xD6, 0xDA, 0x7E, 0x59, 0xD9, 0x7D, 0xA5, 0xAD,
+    0x70, 0xD9, 0x5E, 0x79, 0xD9, 0x4A, 0xDA, 0x79, 0xD4, 0x9E, 0x97, 0x9D, 0xA2, 0xAC, 0xAD, 0x97,
+    0x0F, 0xEA, 0x0D, 0x72, 0xFC, 0x90, 0x9D, 0x74, 0x97, 0x70, 0x77, 0x77, 0x73, 0xAD, 0x3A, 0xCA,
+    0x70, 0xAD, 0x1E, 0x3D, 0xA7, 0x0E, 0x09, 0xD9, 0x3D, 0x97, 0x0D, 0xA9, 0xDA, 0x39, 0xD7, 0x1F,
+    0xC9, 0x4A, 0xD7, 0x09, 0xDA, 0x96, 0xE7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D,
+    0xA7, 0x9D, 0x70, 0x9D, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xDA,
+    0x79, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7,
+    0x0A, 0xD7, 0x9D, 0x97, 0x09, 0xDA, 0x6E, 0x72, 0xEA, 0x3A, 0xE9, 0x72, 0x9F, 0xFD, 0x97, 0x5A,
+    0xFD, 0xA7, 0x72, 0x99, 0x77, 0x77, 0x74, 0xD9, 0x77, 0x3A, 0xD9, 0x77, 0x39, 0xD7, 0x77, 0x77,
+    0x00, 0x77, 0x77, 0x59, 0xD9, 0x77, 0x0A, 0xD3, 0xAA, 0x95, 0x9A, 0xA1, 0xDA, 0x29, 0xD9, 0x5A,
+    0xD0, 0xE3, 0x9D, 0x6F, 0xCA, 0x4A, 0xD6, 0xEA, 0x6D, 0xA5, 0x9D, 0x70, 0xD9, 0x5A, 0xD7, 0x9D,
+    0x95, 0xDA, 0x7A, 0xD6, 0xDA, 0x7E, 0x59, 0xD9, 0x7D, 0xA5, 0xAD, 0x70, 0xD9, 0x5E, 0x79, 0xD9,
+    0x4A, 0xDA, 0x79, 0xD4, 0x9E, 0x97, 0x9D, 0xA2, 0xAC, 0xAD, 0x97, 0x0F, 0xEA, 0x0D, 0x72, 0xFC,
+    0x90, 0x9D, 0x74, 0x97, 0x77, 0x77, 0x0D, 0x97, 0x70, 0x9D, 0xA7, 0x71, 0xD7, 0x77, 0x73, 0x59,
+    0x97, 0x5D, 0xA7, 0x4A, 0xD7, 0x5D, 0x97, 0x5D, 0x76, 0x97, 0x76, 0xD9, 0x7A, 0xD1, 0xDA, 0x69,
+    0xDA, 0x1A, 0xD6, 0xE2, 0x9D, 0x5A, 0xD9, 0x3D, 0x94, 0xDA, 0x4D, 0xA3, 0xE5, 0xAD, 0x2A, 0xD6,
+    0x9D, 0x2D, 0xA7, 0xD9, 0x0E, 0x70, 0xDA, 0xAD, 0x71, 0xAF, 0x97, 0x19, 0xF7, 0x3E, 0x74, 0xDA,
+    0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x20,
+    0x79, 0x99, 0x77, 0x9D, 0x97, 0x7D, 0xA7, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0x19, 0x77, 0x74, 0x9A,
+    0xA7, 0xAA, 0xA4, 0x9D, 0x69, 0xD9, 0x49, 0xD9, 0x5E, 0x6D, 0x94, 0x9D, 0x96, 0xDA, 0x4E, 0x7D,
+    0xA3, 0x9D, 0x70, 0xAD, 0x3D, 0xA7, 0x0A, 0xD2, 0xAD, 0x71, 0x9D, 0x2D, 0xA7, 0x2D, 0x1A, 0xD7,
+    0x3D, 0x1D, 0xA7, 0x3D, 0x9A, 0xD7, 0x4D, 0x9D, 0x97, 0x4A, 0xF7, 0x59, 0xE9, 0x75, 0x9E, 0x76,
+    0x9D, 0x97, 0x6D, 0xA7, 0x6A, 0xD7, 0x69, 0xDA, 0x75, 0x9E, 0x73, 0xAF, 0xC7, 0x4A, 0xEA, 0x75,
+    0x0D, 0x97, 0xAD, 0x1D, 0xA6, 0x9D, 0xA1, 0xAD, 0x6E, 0x29, 0xD5, 0xAD, 0x93, 0xD9, 0x4D, 0xA4,
+    0xDA, 0x3E, 0x5A, 0xD2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x90, 0xE7, 0x0D, 0xAA, 0xD7, 0x1A, 0xF9,
+    0x71, 0x9F, 0x73, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7, 0x4D, 0xA7, 0x4D, 0xA7,
+    0x39, 0xD9, 0x73, 0xAD, 0x77, 0x77, 0x74, 0xD9, 0x73, 0x9D, 0xA7, 0x4D, 0x77, 0x73, 0x39, 0xAA,
+    0x7A, 0xAA, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0x95, 0xE6, 0xD9, 0x49, 0xD9, 0x6D, 0xA4, 0xE7, 0xDA,
+    0x39, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD2, 0xDA, 0x72, 0xD1, 0xAD, 0x73,
+    0xD1, 0xDA, 0x73, 0xD9, 0xAD, 0x74, 0xD9, 0xD9, 0x74, 0xAF, 0x75, 0x9E, 0x97, 0x59, 0xE7, 0x69,
+    0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x1A, 0xCA, 0x71, 0x9D, 0xA1, 0xE7, 0x09, 0xE2, 0xD9, 0x5A, 0xFC,
+    0x74, 0xAE, 0xA7, 0x50, 0x6A, 0xAA, 0x97, 0x3F, 0x97, 0x49, 0xCA, 0x74, 0xAC, 0xA7, 0x2A, 0xE7,
+    0x3D, 0x75, 0xCA, 0x77, 0x7D, 0x97, 0xAD, 0x1D, 0xA6, 0x9D, 0xA1, 0xAD, 0x6E, 0x29, 0xD5, 0xAD,
+    0x93, 0xD9, 0x4D, 0xA4, 0xDA, 0x3E, 0x5A, 0xD2, 0xAD, 0x69, 0xD2, 0xDA, 0x7D, 0x90, 0xE7, 0x0D,
+    0xAA, 0xD7, 0x1A, 0xF9, 0x71, 0x9F, 0x73, 0xE7, 0x4D, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xD7,
+    0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x72, 0x71, 0xEA, 0x76, 0xAA, 0xE7, 0x70, 0xD7,
+    0x7A, 0xD7, 0x5A, 0xDA, 0x76, 0xD7, 0x70, 0xAA, 0x77, 0x75, 0x9A, 0xA7, 0xAA, 0xA4, 0x9D, 0x69,
+    0xD9, 0x49, 0xD9, 0x5E, 0x6D, 0x94, 0x9D, 0x96, 0xDA, 0x4E, 0x7D, 0xA3, 0x9D, 0x70, 0xAD, 0x3D,
+    0xA7, 0x0A, 0xD2, 0xAD, 0x71, 0x9D, 0x2D, 0xA7, 0x2D, 0x1A, 0xD7, 0x3D, 0x1D, 0xA7, 0x3D, 0x9A,
+    0xD7, 0x4D, 0x9D, 0x97, 0x4A, 0xF7, 0x59, 0xE9, 0x75, 0x9E, 0x76, 0x9D, 0x97, 0x6D, 0xA7, 0x6A,
+    0xD7, 0x69, 0xDA, 0x75, 0x9E, 0x73, 0xAF, 0xC7, 0x4A, 0xEA, 0x75, 0x59, 0x94, 0x96, 0xF9, 0x1A,
+    0xC5, 0xAF, 0xFA, 0x5C, 0xA1, 0x9F, 0x69, 0x77, 0x73, 0xD9, 0x7A, 0xD1, 0xDA, 0x69, 0xDA, 0x1A,
+    0xD6, 0xE2, 0x9D, 0x5A, 0xD9, 0x3D, 0x94, 0xDA, 0x4D, 0xA3, 0xE5, 0xAD, 0x2A, 0xD6, 0x9D, 0x2D,
+    0xA7, 0xD9, 0x0E, 0x70, 0xDA, 0xAD, 0x71, 0xAF, 0x97, 0x19, 0xF7, 0x3E, 0x74, 0xDA, 0x74, 0xD9,
+    0x73, 0x9D, 0x74, 0xAD, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x20, 0x70, 0x99,
+    0x39, 0x97, 0x09, 0xF9, 0x1C, 0xA7, 0x0D, 0xAF, 0xD9, 0x79, 0xC9, 0x1A, 0xEA, 0x71, 0x94, 0x97,
+    0x77, 0x39, 0xAA, 0x7A, 0xAA, 0x49, 0xD6, 0x9D, 0x94, 0x9D, 0x95, 0xE6, 0xD9, 0x49, 0xD9, 0x6D,
+    0xA4, 0xE7, 0xDA, 0x39, 0xD7, 0x0A, 0xD3, 0xDA, 0x70, 0xAD, 0x2A, 0xD7, 0x19, 0xD2, 0xDA, 0x72,
+    0xD1, 0xAD, 0x73, 0xD1, 0xDA, 0x73, 0xD9, 0xAD, 0x74, 0xD9, 0xD9, 0x74, 0xAF, 0x75, 0x9E, 0x97,
+    0x59, 0xE7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xAD, 0x76, 0x9D, 0xA7, 0x59, 0xE7, 0x3A, 0xFC, 0x74,
+    0xAE, 0xA7, 0x50, 0x72, 0x9A, 0x6C, 0xA1, 0x9A, 0xAA, 0xAC, 0xA0, 0xAC, 0xAA, 0xAC, 0xA0, 0xAA,
+    0x1C, 0xA1, 0xAA, 0x09, 0xA2, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0x72, 0xA9, 0x4A, 0xC4, 0xAC, 0xAA, 0xAA, 0x90, 0xAC, 0xAA, 0xAC, 0xA1, 0xAC, 0x1A, 0xA2, 0xA9,
+    0x0A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA0, 0x0F, 0xE1, 0xFE,
+    0x19, 0x99, 0x99, 0x99, 0x00, 0x0F, 0xE1, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x00, 0x09, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF, 0xC1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x76, 0xFF,
+    0xF1, 0xFF, 0xEA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xD1,
+    0xFF, 0xFF, 0xFF, 0xCA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x10, 0x77, 0x74, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xCA, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x70, 0xAC, 0x93, 0xDA, 0xC9, 0x3D,
+    0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC,
+    0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93,
+    0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA,
+    0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9, 0x3D, 0xAC, 0x93, 0xDA, 0xC9,
+    0x3D, 0xAC, 0x93, 0xD7, 0x00, 0x75, 0xFF, 0xEA, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x59,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xE0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x3A,
+    0xC9, 0x29, 0xD3, 0xDA, 0x29, 0xD3, 0xDA, 0x2A, 0xD9, 0x2E, 0x39, 0x93, 0x29, 0xD9, 0x2E, 0x3D,
+    0xA2, 0xAD, 0x3D, 0x92, 0x9D, 0x3D, 0x49, 0x93, 0x39, 0x93, 0xE2, 0x9D, 0xA2, 0xAD, 0x3D, 0x92,
+    0x9D, 0x3D, 0x93, 0xCA, 0x30, 0xAD, 0x0A, 0xD0, 0xAD, 0x09, 0xD1, 0xD1, 0xD1, 0xD2, 0x90, 0x3A,
+    0xC9, 0x2C, 0xA2, 0x9D, 0x2D, 0x92, 0xDA, 0x19, 0xD2, 0x9D, 0x2D, 0x92, 0xDA, 0x1A, 0xD2, 0xAD,
+    0x91, 0xDA, 0x2E, 0x1A, 0xD9, 0x29, 0x92, 0x99, 0x92, 0x29, 0xD9, 0x1D, 0xA2, 0xE1, 0xAD, 0x92,
+    0xDA, 0x1E, 0x2A, 0xD1, 0x9D, 0x92, 0xD9, 0x1A, 0xD2, 0x9D, 0x2D, 0x3D, 0x2A, 0xCA, 0x39, 0x92,
+    0x99, 0x30, 0x39, 0x92, 0x99, 0x92, 0xE1, 0xAD, 0x91, 0x9D, 0xA1, 0xE2, 0xAD, 0x19, 0xD9, 0x2D,
+    0x91, 0xAD, 0x29, 0xD2, 0xD9, 0x2D, 0x91, 0xAC, 0xA3, 0xCA, 0x2A, 0xC3, 0xAC, 0xA1, 0xAC, 0xA0,
+    0xE1, 0xAD, 0x0A, 0xD1, 0xAD, 0x09, 0xD1, 0x9D, 0x1D, 0x2D, 0x1D, 0x2D, 0x1D, 0x2D, 0x29, 0x39,
+    0x00, 0x77, 0xE7, 0xDA, 0x7D, 0x97, 0xD7, 0x0C, 0xA3, 0x9A, 0x99, 0x9C, 0xA9, 0x9A, 0xAA, 0xFF,
+    0xCA, 0xAC, 0xAA, 0xDA, 0xAA, 0xC9, 0x3D, 0x70, 0xCA, 0x79, 0xC9, 0x7A, 0xC9, 0x7D, 0x70, 0xD7,
+    0x9D, 0x7A, 0xCA, 0x7D, 0x96, 0x9D, 0x96, 0xAD, 0x7E, 0x7E, 0x69, 0xDA, 0x60, 0x77, 0x6A, 0xD7,
+    0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x74, 0xD7, 0xAF, 0xFD, 0x3F, 0xFE, 0x39, 0x2A, 0xC7, 0x4D, 0x73,
+    0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x73, 0xD9, 0x73, 0xD7, 0x99, 0x91, 0xCA, 0x19, 0x93, 0xAF, 0xFD,
+    0x3E, 0xAD, 0xAE, 0xA7, 0xD7, 0x4D, 0x73, 0x9D, 0x73, 0xE7, 0x3D, 0xA7, 0x71, 0xF9, 0x1F, 0xD1,
+    0xFD, 0x1F, 0xD9, 0x0F, 0xD1, 0xAF, 0xC2, 0xAD, 0xA1, 0x73, 0xA9, 0x7D, 0xA6, 0xF9, 0x4F, 0xCA,
+    0x29, 0xFE, 0x1A, 0xFC, 0xA2, 0xF9, 0x4C, 0xA9, 0x77, 0x09, 0x90, 0xAD, 0xAE, 0xAE, 0x90, 0x91,
+    0x19, 0x94, 0x99, 0x1E, 0x3A, 0xDA, 0x9E, 0x3E, 0xA9, 0xE3, 0xE1, 0x99, 0x59, 0x10, 0x19, 0x94,
+    0x99, 0x5A, 0x91, 0xE3, 0xAD, 0xA3, 0xE0, 0x9E, 0x3E, 0xA2, 0x9E, 0x09, 0xE3, 0xE9, 0x29, 0xE1,
+    0x99, 0x59, 0x59, 0x91, 0x19, 0x91, 0xAD, 0xA0, 0xEA, 0x0E, 0x29, 0x10, 0x9A, 0xAA, 0xAA, 0xA0,
+    0xAC, 0xAA, 0xAA, 0xA0, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0x0A, 0xAA, 0xAA, 0xA9, 0x0A, 0xAA, 0xAA, 0xCA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x79, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD,
+    0x99, 0xFD, 0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2,
+    0x79, 0xFD, 0x99, 0xC5, 0x9C, 0x59, 0xC5, 0x9C, 0x59, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD, 0x95, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0x99, 0xFD,
+    0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x77, 0x77, 0x09, 0xF7,
+    0x9C, 0xA7, 0x4A, 0xFD, 0x6D, 0x75, 0xD9, 0x1D, 0x5D, 0x97, 0x4A, 0xCA, 0x2D, 0x93, 0xAC, 0xA7,
+    0x5D, 0x3D, 0x92, 0x9D, 0x75, 0x9D, 0x3D, 0x3D, 0x76, 0x9C, 0xA3, 0xD2, 0xD9, 0x76, 0xAC, 0xA2,
+    0x9D, 0x1A, 0xCA, 0x77, 0xAC, 0x92, 0xAC, 0x90, 0x9D, 0x09, 0xAC, 0xA9, 0x49, 0xAC, 0xA1, 0xAC,
+    0xA2, 0xD1, 0xD0, 0x9F, 0xC9, 0x2F, 0xD0, 0x9D, 0x1D, 0xA0, 0xD9, 0x9D, 0x90, 0xAD, 0x1A, 0xD0,
+    0x9D, 0x90, 0xFD, 0x0A, 0xCA, 0x0D, 0x92, 0xD0, 0x9D, 0x2A, 0xCA, 0x1E, 0xA0, 0x9D, 0x1D, 0x3D,
+    0x0A, 0xCA, 0x2A, 0xCA, 0x6D, 0x1A, 0xCA, 0x3D, 0x0D, 0x3A, 0xC9, 0x5D, 0x91, 0xAC, 0x92, 0x9D,
+    0x0D, 0x3D, 0x94, 0xAC, 0xA2, 0xD9, 0x2A, 0xCA, 0x9D, 0x3D, 0x49, 0xD3, 0xD3, 0xD9, 0x9C, 0xA2,
+    0x9D, 0x4D, 0x4D, 0x3D, 0x09, 0xCA, 0x2A, 0xC9, 0x3D, 0x94, 0xD9, 0x1D, 0x90, 0x9D, 0x19, 0xD3,
+    0xAC, 0xA5, 0x9D, 0xAE, 0x2E, 0xAD, 0x92, 0x9D, 0x7A, 0xEA, 0x39, 0xF9, 0x77, 0x09, 0x79, 0x94,
+    0x77, 0x77, 0x72, 0x9F, 0x79, 0xCA, 0x77, 0x6A, 0xFD, 0x6D, 0x77, 0x7D, 0x91, 0xD5, 0xD9, 0x77,
+    0x6A, 0xCA, 0x2D, 0x93, 0xAC, 0xA7, 0x77, 0xD3, 0xD9, 0x29, 0xD7, 0x77, 0x9D, 0x3D, 0x3D, 0x77,
+    0x70, 0x9C, 0xA3, 0xD2, 0xD9, 0x77, 0x70, 0xAC, 0xA2, 0x9D, 0x1A, 0xCA, 0x77, 0x71, 0xAC, 0x92,
+    0xAC, 0x90, 0x9D, 0x09, 0xAC, 0xA9, 0x49, 0xAC, 0xA5, 0xAC, 0xA9, 0x1A, 0xCA, 0x2D, 0x1D, 0x09,
+    0xFC, 0x92, 0xFD, 0x29, 0xFC, 0x90, 0x9D, 0x1D, 0xA0, 0xD9, 0x9D, 0x90, 0xAD, 0x1A, 0xD0, 0x9D,
+    0x91, 0xD9, 0x0A, 0xD1, 0xFD, 0x0A, 0xCA, 0x0D, 0x92, 0xD0, 0x9D, 0x2A, 0xCA, 0x0D, 0xA2, 0xD2,
+    0xEA, 0x09, 0xD1, 0xD3, 0xD0, 0xAC, 0xA2, 0xAC, 0xA0, 0xD3, 0xD7, 0xD1, 0xAC, 0xA3, 0xD0, 0xD3,
+    0xAC, 0x99, 0xCA, 0x3D, 0x6D, 0x91, 0xAC, 0x92, 0x9D, 0x0D, 0x3D, 0x9A, 0xCA, 0x29, 0xD5, 0xAC,
+    0xA2, 0xD9, 0x2A, 0xCA, 0x9D, 0x3D, 0x0D, 0x92, 0x9C, 0xA4, 0x9D, 0x3D, 0x3D, 0x99, 0xCA, 0x29,
+    0xD0, 0xD9, 0x2A, 0xC9, 0x4D, 0x4D, 0x3D, 0x09, 0xCA, 0x2A, 0xC9, 0x0D, 0x92, 0xD4, 0xD9, 0x4D,
+    0x91, 0xD9, 0x09, 0xD1, 0x9D, 0x1A, 0xC9, 0x1A, 0xCA, 0x3A, 0xCA, 0x59, 0xDA, 0xE2, 0xEA, 0xD9,
+    0x19, 0xDA, 0xE3, 0x9D, 0x7A, 0xEA, 0x39, 0xF9, 0x3A, 0xF7, 0x71, 0x97, 0x97, 0x09, 0x50, 0x39,
+    0xD4, 0xDA, 0x39, 0xD4, 0xD9, 0x39, 0xCA, 0x4D, 0x49, 0xC9, 0x4A, 0xA4, 0x39, 0xD1, 0x9D, 0x4D,
+    0xA1, 0xDA, 0x39, 0xD1, 0xAD, 0x4D, 0x91, 0xD9, 0x39, 0xCA, 0x1A, 0xCA, 0x4D, 0x2D, 0x49, 0xC9,
+    0x19, 0xC9, 0x4A, 0xA2, 0xAA, 0x40, 0x39, 0xD1, 0x9D, 0x1A, 0xD4, 0xDA, 0x1D, 0xA1, 0xD9, 0x39,
+    0xD1, 0xAD, 0x1A, 0xD4, 0xD9, 0x1D, 0x91, 0xD4, 0x9C, 0xA1, 0xAC, 0xA1, 0xAC, 0xA4, 0xD2, 0xD2,
+    0xD4, 0x9C, 0x91, 0x9C, 0x91, 0xAC, 0x94, 0xAA, 0x2A, 0xA2, 0xAA, 0x40, 0x0D, 0x91, 0xDA, 0x19,
+    0xD2, 0xD2, 0xD2, 0xAC, 0x92, 0xCA, 0x2A, 0xA0, 0x0D, 0x90, 0x9D, 0x2D, 0xA0, 0x9D, 0x29, 0xD1,
+    0xD9, 0x2D, 0x1A, 0xCA, 0x2D, 0x19, 0xCA, 0x2A, 0xC9, 0x1D, 0x3C, 0xA1, 0xAC, 0x3A, 0xA1, 0x9A,
+    0x00, 0x0D, 0x90, 0x9D, 0x1D, 0x91, 0xDA, 0x09, 0xD1, 0xDA, 0x19, 0xD1, 0xD9, 0x09, 0xD2, 0xD1,
+    0xAC, 0xA1, 0xD2, 0xD1, 0x9C, 0xA1, 0xD2, 0xAC, 0x91, 0xD1, 0xAC, 0x92, 0xCA, 0x1A, 0xC1, 0x9C,
+    0xA2, 0xAA, 0x19, 0xA2, 0xA9, 0x69, 0x70, 0xAC, 0x96, 0x9E, 0x6D, 0xAC, 0x5A, 0xC1, 0xC9, 0x39,
+    0xC9, 0x1C, 0xA3, 0xD2, 0xAC, 0x2D, 0x39, 0xC1, 0xAC, 0x94, 0xC9, 0x0C, 0xA5, 0xD0, 0x49, 0x59,
+    0xD3, 0x9D, 0x39, 0xD9, 0x29, 0xD9, 0x29, 0xDA, 0x3A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD9, 0x4A, 0xCA,
+    0x5D, 0x72, 0x2A, 0x5A, 0xCA, 0x5D, 0x5D, 0xA4, 0x9D, 0x5D, 0xA4, 0xAD, 0x39, 0xDA, 0x29, 0xD9,
+    0x29, 0xD9, 0x3D, 0x93, 0x9C, 0x97, 0x40, 0x77, 0x79, 0x6D, 0x96, 0x91, 0xD9, 0x49, 0xDA, 0x5D,
+    0x90, 0x9D, 0x93, 0x9D, 0x94, 0xDA, 0x29, 0xD9, 0x49, 0x4D, 0xA4, 0x9D, 0x97, 0x0D, 0xA6, 0x9D,
+    0x96, 0xDA, 0x70, 0x9D, 0x94, 0xDA, 0x72, 0x9D, 0x92, 0xDA, 0x74, 0x9D, 0x90, 0xDA, 0x7D, 0x93,
+    0x9F, 0xA4, 0xDA, 0xAD, 0xA4, 0x9E, 0x5E, 0x9D, 0x94, 0xF9, 0x4E, 0x09, 0x94, 0xDA, 0x9D, 0x94,
+    0x97, 0xDA, 0x19, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x71, 0xDA, 0x59, 0xD9, 0x7D, 0xA7, 0x9D, 0x95,
+    0xDA, 0x71, 0x9D, 0x93, 0xDA, 0x4D, 0x93, 0x9D, 0x91, 0xDA, 0x49, 0xDA, 0x49, 0xD1, 0x9A, 0x59,
+    0xDA, 0x59, 0xA7, 0x29, 0x97, 0x10, 0x4E, 0x29, 0xDA, 0x39, 0xDA, 0x2A, 0xD9, 0x3A, 0xD9, 0x2A,
+    0xD4, 0xAD, 0x3E, 0x4E, 0x3D, 0xA4, 0xDA, 0x3D, 0xA4, 0xD9, 0x29, 0xD9, 0x39, 0xD3, 0xAD, 0x4A,
+    0xD3, 0xE4, 0xDA, 0x3D, 0xA4, 0xD9, 0x3D, 0x94, 0xD3, 0x9D, 0x49, 0xD3, 0x9D, 0x49, 0xCA, 0x3A,
+    0xCA, 0x4A, 0xC9, 0x3D, 0x97, 0x77, 0x72, 0x99, 0x39, 0xA5, 0xE2, 0x9E, 0x39, 0xE2, 0xAE, 0x39,
+    0xE2, 0x9D, 0xA4, 0x99, 0x49, 0x94, 0x75, 0x9A, 0xFC, 0x3F, 0xFC, 0x91, 0xAC, 0xAD, 0xA9, 0xE3,
+    0x9D, 0x90, 0xAD, 0x3A, 0xD1, 0x9D, 0x3A, 0xD1, 0x9D, 0x3D, 0xA1, 0xE3, 0xD9, 0x09, 0xD9, 0x3D,
+    0x0A, 0xDA, 0x39, 0xDA, 0xDA, 0x4A, 0xF9, 0x5A, 0xE9, 0x6E, 0x70, 0xD9, 0x70, 0xD7, 0x77, 0x70,
+    0x9A, 0x70, 0x9E, 0x7A, 0xE7, 0xAD, 0x97, 0x09, 0x97, 0x00, 0x75, 0xAF, 0xFE, 0x0F, 0xFE, 0x90,
+    0x77, 0x0C, 0x73, 0xC1, 0xC9, 0x71, 0xCA, 0x1A, 0xC7, 0x0D, 0x3D, 0x59, 0xD4, 0x9D, 0xAA, 0xAA,
+    0xDA, 0x7A, 0xFA, 0x50, 0x77, 0x4A, 0xFC, 0xA6, 0x9D, 0xA9, 0x99, 0xAD, 0x49, 0xCA, 0x6D, 0x29,
+    0xC9, 0x70, 0xC9, 0x1C, 0x97, 0x1A, 0xC0, 0x9A, 0x72, 0x9A, 0x00, 0x72, 0x9A, 0x73, 0xCA, 0x72,
+    0xAC, 0x72, 0x9C, 0x97, 0x2D, 0x72, 0xAC, 0x73, 0xCA, 0x72, 0xAC, 0x72, 0x9C, 0x97, 0x2C, 0xA7,
+    0x2A, 0xC9, 0x72, 0xD9, 0x71, 0xEA, 0x70, 0x9C, 0x9A, 0xC7, 0x0C, 0xA0, 0xAC, 0x7A, 0xC1, 0x9C,
+    0x7C, 0xA1, 0x9C, 0x95, 0xD3, 0xCA, 0x49, 0xC9, 0x3C, 0xA4, 0x77, 0x77, 0x76, 0x9D, 0x77, 0x73,
+    0x9D, 0x77, 0x73, 0xAC, 0xA7, 0x75, 0x9C, 0x92, 0xAC, 0x97, 0x75, 0xAE, 0x90, 0xAC, 0x77, 0x79,
+    0xAF, 0xC9, 0x99, 0xAA, 0x97, 0x74, 0x9F, 0xF9, 0x77, 0x4A, 0xE9, 0x99, 0xAA, 0x97, 0x73, 0xAC,
+    0xA9, 0xCA, 0x77, 0x7A, 0xD1, 0xD7, 0x76, 0xAD, 0x2D, 0x97, 0x76, 0xC9, 0x2A, 0xD7, 0x71, 0xA9,
+    0x70, 0xD3, 0xA9, 0x72, 0x9D, 0x76, 0xD9, 0x71, 0x9D, 0x76, 0xD5, 0x93, 0xAC, 0x97, 0x09, 0x4D,
+    0x49, 0xD9, 0x1A, 0xC7, 0x1D, 0xA1, 0x9C, 0x94, 0xAF, 0x9D, 0x70, 0x9F, 0xAA, 0xC7, 0x9A, 0xFF,
+    0xCA, 0x59, 0xFF, 0xD4, 0xEA, 0xF9, 0x7A, 0xFF, 0x3D, 0xAC, 0x97, 0x3A, 0xCA, 0xCA, 0x69, 0xD9,
+    0x0D, 0x72, 0xDA, 0x0D, 0x59, 0xDA, 0x1D, 0x71, 0xE1, 0xAC, 0xA4, 0xAD, 0x2A, 0xCA, 0x79, 0xD2,
+    0x9D, 0x5A, 0x39, 0xD7, 0x09, 0x93, 0xDA, 0x72, 0xA9, 0x76, 0xA9, 0x30, 0x0F, 0xDA, 0x0F, 0xD9,
+    0x09, 0x99, 0x99, 0x90, 0x76, 0xAC, 0x97, 0x5A, 0xD7, 0x59, 0xD7, 0x6D, 0x97, 0x5D, 0xA7, 0x5A,
+    0xD7, 0x59, 0xD7, 0x6D, 0x97, 0x5A, 0xCA, 0x75, 0x9D, 0x76, 0xD7, 0x6D, 0x97, 0x5A, 0xCA, 0x75,
+    0x9D, 0x76, 0xD7, 0x6D, 0x97, 0x5A, 0xCA, 0x75, 0x9D, 0x76, 0xD7, 0x6D, 0x97, 0x5A, 0xCA, 0x76,
+    0x5F, 0xCA, 0x5F, 0xCA, 0x49, 0xD9, 0x99, 0x5A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0x9D,
+    0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x79, 0xD9, 0x79, 0xFC, 0x5A, 0xFC, 0x5D, 0xA7, 0x0D, 0x97,
+    0x9D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xD7, 0x0E, 0x99, 0x95,
+    0xFC, 0xA5, 0xAA, 0xAA, 0xA9, 0x40, 0x5A, 0xFA, 0x5F, 0xCA, 0x59, 0x99, 0xD9, 0x70, 0xD7, 0x09,
+    0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0x9D, 0x70, 0xAC, 0xA7, 0x0D, 0xA4, 0x9F,
+    0xC9, 0x49, 0xFC, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0D,
+    0xA7, 0x0D, 0x97, 0x0D, 0x59, 0x99, 0xAD, 0x5F, 0xCA, 0x5A, 0xAA, 0xAA, 0x94, 0x77, 0x71, 0x9A,
+    0xFA, 0x94, 0xAF, 0xCA, 0x2F, 0xFC, 0x91, 0x9F, 0xFC, 0x1A, 0xCA, 0x91, 0xAE, 0x2D, 0x91, 0x9E,
+    0x97, 0xAD, 0x71, 0xDA, 0x79, 0xD7, 0x1E, 0x79, 0xD7, 0x1D, 0xA7, 0xE7, 0x1D, 0x96, 0x9D, 0x97,
+    0x0E, 0x6A, 0xDA, 0x70, 0xE9, 0x5A, 0xDA, 0x79, 0xE9, 0x5E, 0xA7, 0x9E, 0x6E, 0x97, 0x9D, 0xA6,
+    0x9D, 0x71, 0xDA, 0x7D, 0x97, 0x09, 0xD7, 0x0D, 0x71, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x9A, 0x72,
+    0x99, 0x79, 0xE7, 0x0E, 0x96, 0xAE, 0x70, 0xE9, 0x6A, 0xD9, 0x70, 0xE7, 0x09, 0x97, 0x29, 0x70,
+    0x77, 0x49, 0xAF, 0xA9, 0x4A, 0xD9, 0x0F, 0xFC, 0x93, 0xE1, 0xAC, 0xA9, 0x1A, 0xE3, 0xE7, 0x0A,
+    0xD3, 0xDA, 0x70, 0x9D, 0x29, 0xD9, 0x70, 0x9D, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x70, 0x9D, 0x92,
+    0xE7, 0xAD, 0xA3, 0xDA, 0x6A, 0xDA, 0x4D, 0x95, 0xEA, 0x49, 0xD5, 0xE9, 0x5A, 0xD4, 0x9D, 0x7A,
+    0xCA, 0x4D, 0x97, 0xD9, 0x4D, 0x70, 0xD7, 0x77, 0x77, 0x29, 0xA7, 0x09, 0x94, 0x9E, 0x6A, 0xDA,
+    0x3A, 0xE6, 0xF3, 0xAD, 0x96, 0xAD, 0x94, 0x99, 0x70, 0x95, 0x77, 0x71, 0xE3, 0xAF, 0xCA, 0x59,
+    0xDA, 0x19, 0xFF, 0xC4, 0xAD, 0x92, 0xD9, 0x2E, 0xA3, 0xAD, 0x72, 0xE3, 0xE7, 0x2E, 0x3D, 0xA7,
+    0x2E, 0x3D, 0x97, 0x2D, 0x92, 0x9D, 0x72, 0xE3, 0xAD, 0x71, 0xE9, 0x3D, 0xA7, 0x0E, 0x94, 0xD9,
+    0x69, 0xE6, 0xD7, 0xDA, 0x69, 0xD6, 0xDA, 0x79, 0xCA, 0x59, 0xD7, 0x0A, 0xC9, 0x5A, 0xCA, 0x77,
+    0x77, 0x77, 0x29, 0x96, 0x99, 0x70, 0xE5, 0xE9, 0x69, 0xE5, 0xE9, 0x69, 0xE5, 0xE7, 0x09, 0x97,
+    0x97, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFD, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xDA, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xE7, 0x29, 0xD7, 0x3D, 0xA7, 0x2A, 0xD7, 0x29,
+    0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xE7, 0x29, 0xD9, 0x72, 0xDA, 0x70, 0x76, 0xFF,
+    0xE9, 0x2F, 0xFF, 0xA1, 0xD1, 0x9F, 0xF9, 0x0D, 0x19, 0xFF, 0xC0, 0xD1, 0x9F, 0xFC, 0x0D, 0x19,
+    0xFF, 0xC9, 0xD1, 0x9F, 0xFC, 0x9D, 0x19, 0xFF, 0xC9, 0xD1, 0x9F, 0xFC, 0x9D, 0x19, 0xFF, 0xC9,
+    0xD1, 0x9F, 0xFC, 0x0D, 0x19, 0xFF, 0xA0, 0xD1, 0x9F, 0xF1, 0xD1, 0x9F, 0xDA, 0x2D, 0x19, 0xC9,
+    0x09, 0x5D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9,
+    0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7D, 0x19, 0xC9, 0x7A,
+    0xA2, 0xA9, 0x70, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0x2F, 0xFA, 0x99, 0xD1, 0xAF,
+    0xF9, 0x1A, 0xC1, 0xFF, 0xC9, 0x1A, 0xC0, 0x9F, 0xFC, 0x91, 0xAC, 0x09, 0xFF, 0xC9, 0x1A, 0xC0,
+    0x9F, 0xFC, 0x91, 0xAC, 0x09, 0xFF, 0xC9, 0x1A, 0xC0, 0x9F, 0xFC, 0x91, 0xAC, 0x1F, 0xFC, 0x91,
+    0xAC, 0x1F, 0xFC, 0x91, 0xAC, 0x19, 0xFF, 0x91, 0xAC, 0x2A, 0xFF, 0xF4, 0xAF, 0xFD, 0x00, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0x9F, 0xFE, 0xA2, 0x9C, 0xA9, 0x9F, 0xFA, 0x19, 0xC9, 0x1F, 0xFC,
+    0x90, 0x9C, 0x91, 0xFF, 0xCA, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F,
+    0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F,
+    0xFC, 0x90, 0x9C, 0x91, 0xFF, 0xC1, 0x9F, 0xFF, 0x29, 0xFF, 0xCA, 0x93, 0x77, 0x5A, 0xD7, 0x3A,
+    0xCA, 0x73, 0xD9, 0x5A, 0xC9, 0x2D, 0x6F, 0x90, 0xCA, 0x7A, 0xFC, 0xA9, 0x99, 0xAA, 0x59, 0xFF,
+    0x5F, 0x09, 0x9A, 0xA4, 0xD9, 0xAC, 0x97, 0xDA, 0x09, 0xCA, 0x6E, 0x2D, 0x69, 0xC3, 0xDA, 0x73,
+    0xAC, 0xA7, 0x72, 0x71, 0x9D, 0x92, 0xEA, 0x2E, 0x92, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x19, 0x99,
+    0x3D, 0xA3, 0xDA, 0x3D, 0xA3, 0xDA, 0x3A, 0xCA, 0x3A, 0xCA, 0x39, 0xC9, 0x20, 0x77, 0x74, 0xAF,
+    0xCA, 0x72, 0x9D, 0xA9, 0x99, 0xAD, 0x70, 0x9C, 0xA6, 0xD6, 0x9C, 0x97, 0x0C, 0x95, 0xC9, 0x71,
+    0xAC, 0x49, 0xA7, 0x29, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1C, 0x73, 0xC5, 0xC9, 0x71,
+    0xCA, 0x5A, 0xC7, 0x0D, 0x7D, 0x59, 0xD7, 0x09, 0xDA, 0xAA, 0xAD, 0xA7, 0x3A, 0xFA, 0x71, 0x77,
+    0x71, 0x9D, 0x75, 0xAD, 0x75, 0xAC, 0x97, 0x9C, 0x92, 0xAC, 0x70, 0xF9, 0x0D, 0x71, 0x9F, 0xCA,
+    0x99, 0x9A, 0xA9, 0x69, 0xFF, 0x96, 0xAE, 0x09, 0x9A, 0xA6, 0xDA, 0x9C, 0x97, 0x1E, 0x1D, 0x70,
+    0xE2, 0xD9, 0x70, 0xC9, 0x2A, 0xD7, 0x59, 0xCA, 0x77, 0x77, 0x73, 0x9D, 0x75, 0xAD, 0x75, 0xAC,
+    0x97, 0x9C, 0x92, 0xAC, 0x70, 0xF9, 0x0D, 0x71, 0x9F, 0xCA, 0x99, 0x9A, 0xA9, 0x69, 0xFF, 0x96,
+    0xAE, 0x09, 0x9A, 0xA6, 0xDA, 0x9C, 0x97, 0x1E, 0x1D, 0x70, 0xE2, 0xD9, 0x70, 0xC9, 0x2A, 0xD7,
+    0x59, 0xCA, 0x77, 0x70, 0x72, 0x9D, 0x93, 0xAC, 0x9A, 0xDA, 0x3D, 0x0A, 0xD9, 0x2A, 0xCA, 0x19,
+    0x93, 0xD9, 0x69, 0xD7, 0xAC, 0xA7, 0xD7, 0x9D, 0x7D, 0x96, 0x9D, 0x7A, 0xCA, 0x7D, 0x79, 0xD7,
+    0xD9, 0x7D, 0x7A, 0xCA, 0x7D, 0x79, 0xD7, 0xD9, 0x29, 0xD9, 0x0D, 0x3A, 0xDA, 0xAC, 0xA3, 0x9D,
+    0x97, 0x20, 0x3A, 0xEA, 0xA9, 0x74, 0xC9, 0x19, 0xFF, 0xDA, 0x97, 0xAC, 0x19, 0xD9, 0x29, 0xAF,
+    0xDA, 0xA9, 0x19, 0xDA, 0x1D, 0x70, 0x9A, 0xFF, 0xCA, 0x2A, 0x97, 0x49, 0xAA, 0xAA, 0xA3, 0x69,
+    0x99, 0x72, 0xAF, 0xD9, 0x59, 0xDA, 0x91, 0x9D, 0xA3, 0xAC, 0xA6, 0xAC, 0x29, 0xC9, 0x70, 0xCA,
+    0x1C, 0x97, 0x19, 0xC1, 0xA7, 0x3A, 0x00, 0x69, 0xA7, 0x5A, 0xC7, 0x1C, 0x91, 0xAC, 0x2C, 0xA4,
+    0xD9, 0x0A, 0xC1, 0xDA, 0x5D, 0x9A, 0xC0, 0xDA, 0x7F, 0xDA, 0x70, 0x9F, 0xC9, 0x4F, 0xFF, 0xDA,
+    0x0A, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0x94, 0xFD, 0x97, 0xDA, 0xAC, 0x9D, 0x95, 0xDA, 0x0A, 0xC0,
+    0x9D, 0x93, 0x9C, 0xA1, 0xAC, 0x19, 0xD4, 0x92, 0xAC, 0x75, 0xAC, 0x77, 0x60, 0x77, 0x5A, 0xD9,
+    0x70, 0xEA, 0x70, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x6D, 0xA7, 0x09, 0xE7, 0x09, 0xDA, 0x72,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9D, 0x71, 0xEA, 0x70, 0xAD, 0x97, 0x19, 0x90, 0x39, 0xD1,
+    0x9D, 0x1A, 0xD1, 0xAD, 0x4D, 0xA1, 0xDA, 0x1D, 0x91, 0xD9, 0x39, 0xD1, 0xAD, 0x1A, 0xCA, 0x1A,
+    0xCA, 0x4D, 0x91, 0xD9, 0x1D, 0x2D, 0x49, 0xCA, 0x1A, 0xCA, 0x1A, 0xC9, 0x1A, 0xC9, 0x4D, 0x2D,
+    0x2D, 0x2D, 0x49, 0xC9, 0x19, 0xC9, 0x1A, 0xC2, 0xAC, 0x5A, 0xA2, 0xAA, 0x2A, 0x92, 0xA9, 0x40,
+    0x77, 0x76, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x6D, 0x97, 0x5A, 0xD0, 0x9E, 0x75, 0xE9, 0x9D, 0xA7, 0x5A, 0xD9, 0x09, 0x97, 0x79, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0x77, 0x2E, 0x97, 0x71, 0xAD, 0x97, 0x72, 0x99,
+    0x71, 0x77, 0x6D, 0xA7, 0x59, 0xD9, 0x9E, 0x75, 0xAD, 0xA0, 0xDA, 0x75, 0x9D, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x97, 0x73, 0xAD, 0x97, 0x71, 0xEA, 0x77, 0x19, 0xD9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xD9, 0x75, 0xAD, 0x09, 0xE7, 0x5E, 0x99, 0xE7, 0x5E,
+    0x19, 0x97, 0x79, 0x90, 0x4D, 0xA9, 0xE9, 0xDA, 0x09, 0x97, 0x77, 0x77, 0x76, 0x91, 0xDA, 0x9E,
+    0x0D, 0xA1, 0x90, 0x6A, 0xC9, 0x75, 0xE7, 0x5E, 0x75, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x49, 0x97, 0x29, 0x90, 0x9E, 0x70, 0xAD, 0x99, 0xE7, 0x0E, 0xA0, 0xDA, 0x70, 0x9D, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x97, 0x6E, 0x75, 0xE7, 0x5E, 0x76, 0x97, 0x71, 0x99, 0x77, 0x2A, 0xCA,
+    0x77, 0x2A, 0xCA, 0x74, 0xD9, 0x2A, 0xCA, 0x3D, 0x94, 0xAD, 0xA2, 0xAC, 0xA2, 0xAE, 0x4A, 0xDA,
+    0x2A, 0xCA, 0x29, 0xDA, 0x5A, 0xA3, 0xAC, 0xA3, 0xAA, 0x74, 0xAC, 0xA7, 0x72, 0xAC, 0xA7, 0x72,
+    0xAC, 0xA7, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xC0,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x1A, 0xCA, 0x77, 0x2A, 0xCA, 0x77,
+    0x2A, 0xCA, 0x74, 0x99, 0x3A, 0xCA, 0x39, 0x95, 0x9D, 0xA2, 0xAC, 0xA2, 0xAD, 0x94, 0xAD, 0xA2,
+    0xAC, 0xA2, 0xEA, 0x5D, 0x92, 0xAC, 0xA2, 0x9D, 0x74, 0xAC, 0xA7, 0x72, 0xAC, 0xA7, 0x72, 0x9A,
+    0x97, 0x10, 0x09, 0x1A, 0xD9, 0xEA, 0xAD, 0xA0, 0xA9, 0x77, 0x09, 0xD0, 0xEA, 0xEA, 0x9D, 0x77,
+    0x19, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x5E, 0x09, 0xE0, 0x9E, 0x1A, 0xC9, 0x79, 0x2E,
+    0x09, 0xE1, 0xE1, 0x9A, 0x97, 0x92, 0xE0, 0x9E, 0x90, 0xE1, 0x9A, 0x79, 0xA9, 0x1E, 0x09, 0xE9,
+    0x0E, 0x29, 0x10, 0x79, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x9F, 0xD9, 0x2A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79, 0xFD, 0x99, 0xC3, 0xC9, 0x9C,
+    0x3C, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA2, 0x70, 0xFD, 0x1A, 0xFA, 0x2F, 0x39, 0xD9, 0x4D, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x72, 0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x2A,
+    0xFA, 0x1F, 0xD3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x72, 0xAA,
+    0x4A, 0xDA, 0x2C, 0xA1, 0xAC, 0x1C, 0xA1, 0xAC, 0x2A, 0xDA, 0x4D, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79, 0xEA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x29,
+    0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x3A, 0xE9, 0x3F,
+    0xD2, 0xAD, 0x1A, 0xCA, 0x1D, 0x3D, 0x09, 0xCA, 0x3D, 0x0A, 0xC9, 0x3D, 0x0D, 0x39, 0xCA, 0x0D,
+    0x3A, 0xC9, 0x0D, 0x3D, 0x1D, 0x3D, 0x1D, 0x91, 0xD9, 0x19, 0xDA, 0xDA, 0x3A, 0xEA, 0x74, 0x7D,
+    0x2A, 0x96, 0x9C, 0x2D, 0x2C, 0xA2, 0xC9, 0x19, 0xC2, 0xAC, 0x2D, 0x2C, 0xA1, 0x9C, 0x91, 0x9A,
+    0x20, 0x6A, 0xA9, 0x5A, 0xD5, 0x9E, 0x49, 0xCA, 0xD4, 0xD9, 0xCA, 0x3D, 0x0A, 0xC9, 0x2D, 0x1D,
+    0x2A, 0xC9, 0x1D, 0x19, 0xDA, 0xAE, 0xA9, 0xAF, 0xF9, 0x4A, 0xC9, 0x6D, 0x7C, 0xA2, 0x3A, 0xAA,
+    0xAA, 0xA2, 0xAF, 0xCA, 0x2D, 0x7C, 0xA6, 0x9C, 0x96, 0xFC, 0x93, 0xAC, 0xAE, 0x96, 0x9D, 0x7D,
+    0x7D, 0x6A, 0xC9, 0x1D, 0xAA, 0xE2, 0xAF, 0x97, 0x40, 0x39, 0xAD, 0xA3, 0xFD, 0x2D, 0xA5, 0xAC,
+    0x96, 0xD6, 0x9C, 0xAA, 0xE2, 0xAD, 0xA9, 0xAD, 0x1D, 0xA2, 0xD1, 0xD3, 0xD1, 0xD3, 0xD1, 0xAC,
+    0x91, 0x9C, 0xA1, 0x9D, 0xAE, 0x39, 0xEA, 0x75, 0x1A, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xE9, 0x59,
+    0xD6, 0xD6, 0xAC, 0xA6, 0xD6, 0xD9, 0x59, 0xD6, 0xD6, 0xAC, 0xA5, 0x9D, 0x6D, 0x95, 0x9C, 0xA6,
+    0x3A, 0xE9, 0x3F, 0xD9, 0x1A, 0xCA, 0x19, 0xCA, 0x1D, 0x29, 0xCA, 0x1A, 0xCA, 0x1A, 0xC9, 0x2D,
+    0xAD, 0x93, 0xF9, 0x29, 0xD9, 0x9D, 0x2D, 0x29, 0xCA, 0x09, 0xCA, 0x3D, 0x09, 0xCA, 0x2A, 0xCA,
+    0x1E, 0xAA, 0xD3, 0xAE, 0xA7, 0x40, 0x3A, 0xDA, 0x4F, 0xD2, 0xDA, 0x1A, 0xC9, 0x1D, 0x29, 0xCA,
+    0x09, 0xCA, 0x29, 0xCA, 0x09, 0xCA, 0x2A, 0xCA, 0x1D, 0x99, 0xAD, 0x91, 0xAF, 0xD9, 0x39, 0x90,
+    0xD6, 0xAC, 0x95, 0xAD, 0x2C, 0xAA, 0xE3, 0xF9, 0x75, 0x29, 0xA5, 0xAC, 0x5A, 0xC2, 0x99, 0x9D,
+    0x99, 0x9F, 0xF2, 0xD5, 0xAC, 0x5A, 0xC5, 0x99, 0x20, 0x99, 0x99, 0x99, 0x99, 0xFF, 0x70, 0x7F,
+    0xF9, 0x99, 0x99, 0x99, 0x97, 0xAF, 0xDA, 0xAF, 0xDA, 0x72, 0xAC, 0x92, 0xAC, 0xA2, 0x9D, 0x3D,
+    0x39, 0xCA, 0x3D, 0x93, 0xD3, 0x9C, 0xA3, 0x9C, 0xA3, 0xAC, 0x93, 0xAC, 0x93, 0x9C, 0x93, 0x9C,
+    0xA4, 0xD4, 0xAC, 0x59, 0x30, 0x71, 0x9C, 0x94, 0xD4, 0xD4, 0xAC, 0x93, 0xAC, 0x93, 0xAC, 0x93,
+    0xAC, 0x93, 0xAC, 0x4D, 0x39, 0xD3, 0xAC, 0x93, 0xD3, 0xAC, 0x92, 0x9C, 0xA3, 0xD3, 0x99, 0x40,
+    0x1A, 0x90, 0xAD, 0xA2, 0xCA, 0xCA, 0x9D, 0x90, 0x9D, 0x91, 0x9C, 0xA0, 0xAC, 0xA2, 0x9C, 0x90,
+    0xD3, 0xAC, 0x1C, 0xA3, 0xD0, 0x9C, 0xA3, 0xCA, 0x09, 0xC9, 0x29, 0xC9, 0x0A, 0xC3, 0xAC, 0x1A,
+    0xA3, 0x9A, 0x10, 0x3A, 0xDA, 0x39, 0xFD, 0x2D, 0x91, 0xD1, 0x9C, 0xA2, 0xAC, 0x90, 0xD9, 0x2A,
+    0xC9, 0x0D, 0x3A, 0xC9, 0x9D, 0x3D, 0x99, 0xCA, 0x3D, 0x09, 0xCA, 0x3D, 0x09, 0xCA, 0x2A, 0xCA,
+    0x1D, 0x19, 0xD2, 0xFD, 0x93, 0xF9, 0x74, 0x4A, 0xA2, 0xAD, 0xA1, 0xF9, 0x0D, 0x9A, 0xC9, 0x3D,
+    0x4D, 0x39, 0xCA, 0x3A, 0xC9, 0x3D, 0x4D, 0x39, 0xD3, 0x9C, 0xA3, 0xAC, 0x91, 0x39, 0xEA, 0x4F,
+    0xDA, 0x3A, 0x92, 0xD7, 0x0D, 0x70, 0xD7, 0xAC, 0x96, 0xAC, 0xA6, 0xAC, 0xA6, 0xAC, 0xA6, 0xD9,
+    0x6D, 0x96, 0xFF, 0x19, 0xFE, 0xA1, 0x3A, 0xEA, 0x4F, 0xDA, 0x39, 0x3D, 0x70, 0xD7, 0x0D, 0x49,
+    0x9A, 0xD4, 0x9E, 0xA7, 0x0A, 0xD7, 0x0D, 0x70, 0xD9, 0x19, 0x39, 0xD2, 0xDA, 0xAA, 0xD9, 0x2A,
+    0xFC, 0x97, 0x50, 0x6A, 0xA6, 0xE5, 0xAE, 0x49, 0xCA, 0xCA, 0x39, 0xCA, 0xAC, 0x93, 0xCA, 0x0D,
+    0x3D, 0x1D, 0x2D, 0x19, 0xCA, 0x1A, 0xDA, 0xAE, 0xA0, 0xFF, 0xC5, 0xD7, 0xD6, 0x9C, 0xA2, 0x2A,
+    0xAA, 0xAA, 0xA3, 0xFD, 0x29, 0xC9, 0x6D, 0x7D, 0x69, 0xFA, 0x39, 0xCA, 0xAE, 0x7D, 0x7A, 0xC9,
+    0x6A, 0xC1, 0x93, 0x9D, 0x1D, 0xAA, 0xE9, 0x19, 0xFA, 0x75, 0x49, 0xAD, 0x92, 0x9F, 0xC9, 0x19,
+    0xD9, 0x5D, 0x69, 0xCA, 0x6D, 0x9E, 0xA2, 0xEA, 0x9D, 0xA1, 0xD3, 0xD0, 0x9D, 0x3D, 0x1C, 0xA2,
+    0x9C, 0xA1, 0xD2, 0xD9, 0x1A, 0xDA, 0xDA, 0x3A, 0xEA, 0x74, 0x19, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF,
+    0x7A, 0xC9, 0x69, 0xD7, 0xD7, 0xAC, 0xA7, 0xD7, 0xD9, 0x69, 0xD7, 0xD7, 0xAC, 0xA6, 0x9D, 0x7A,
+    0xC9, 0x60, 0x3A, 0xDA, 0x39, 0xFD, 0x2D, 0x91, 0xAC, 0x91, 0xD2, 0xAC, 0x91, 0xD2, 0xD2, 0x9D,
+    0xAD, 0x39, 0xF3, 0xAD, 0x9A, 0xD1, 0x9C, 0xA2, 0xAC, 0x90, 0xAC, 0x92, 0xAC, 0xA0, 0xAC, 0x92,
+    0xD9, 0x09, 0xDA, 0xAE, 0x29, 0xFA, 0x74, 0x29, 0xAC, 0xA9, 0x39, 0xFC, 0xA2, 0xD2, 0xD1, 0xAC,
+    0x92, 0xAC, 0x90, 0xD3, 0xAC, 0x90, 0xD3, 0xD1, 0xAD, 0x99, 0xE2, 0xFA, 0xD3, 0x99, 0x09, 0xCA,
+    0x6D, 0x6D, 0x91, 0xAA, 0xAE, 0xA2, 0xAE, 0xA7, 0x60, 0x3A, 0x96, 0xC9, 0x6C, 0x93, 0x99, 0x9C,
+    0xA9, 0x99, 0x0F, 0xEA, 0x3C, 0xA6, 0xC9, 0x6C, 0x96, 0x93, 0x09, 0x99, 0x99, 0x99, 0x90, 0xFE,
+    0xA7, 0x00, 0x71, 0xFE, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x71, 0xFE, 0xA0, 0xFE, 0x90, 0x72, 0xD3,
+    0xD3, 0xAC, 0x93, 0xD3, 0xAC, 0x93, 0xD3, 0x9C, 0xA3, 0xAC, 0x93, 0xD4, 0xD4, 0xD4, 0xD4, 0xAC,
+    0x49, 0xC9, 0x4D, 0x49, 0x93, 0x73, 0xAC, 0x59, 0xC9, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x49,
+    0xCA, 0x4A, 0xC9, 0x4D, 0x49, 0xCA, 0x4D, 0x4A, 0xC9, 0x39, 0xCA, 0x49, 0x94, 0x29, 0xAA, 0xA0,
+    0x9A, 0x1A, 0xDA, 0xCA, 0xCA, 0x09, 0xCA, 0x2D, 0x90, 0xD3, 0xAC, 0x09, 0xC9, 0x3A, 0xC0, 0xAC,
+    0x4C, 0xA0, 0xAC, 0x39, 0xCA, 0x0A, 0xC3, 0xD9, 0x1D, 0x99, 0xCA, 0xC2, 0x9D, 0xA0, 0x9A, 0x10,
+    0x29, 0xAC, 0xA9, 0x2A, 0xCA, 0xAD, 0x19, 0xC9, 0x19, 0xC9, 0x0D, 0x2A, 0xC0, 0x9C, 0xAA, 0xAD,
+    0x90, 0xAD, 0xAA, 0x92, 0xAC, 0x69, 0xC9, 0x6D, 0x99, 0x9C, 0x3A, 0xEA, 0x10, 0x29, 0xAA, 0xA4,
+    0xAD, 0xAD, 0x91, 0x9C, 0x92, 0xD1, 0xCA, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x0A, 0xC4, 0xAC, 0x0A,
+    0xC4, 0xD0, 0x9C, 0x92, 0xAC, 0x91, 0xD9, 0x9A, 0xCA, 0x3A, 0xE9, 0x20, 0x2A, 0x93, 0xAA, 0x3A,
+    0xC2, 0xAC, 0x5C, 0xA0, 0xAC, 0x95, 0xAC, 0xAC, 0x97, 0xD9, 0x79, 0xD7, 0x9C, 0xAC, 0xA6, 0xCA,
+    0x0A, 0xC5, 0xD2, 0xCA, 0x3A, 0xC3, 0x9C, 0x20, 0x2A, 0xAC, 0xA3, 0xCA, 0xAA, 0xD7, 0xCA, 0x6D,
+    0x39, 0x9A, 0xD1, 0xAF, 0xCA, 0x0A, 0xC9, 0x19, 0xC9, 0x0C, 0xA2, 0xD1, 0xD9, 0x9D, 0x3E, 0xA2,
+    0x29, 0x97, 0xCA, 0x7C, 0x96, 0x9C, 0x7A, 0xC0, 0x9A, 0xA9, 0x2C, 0xAA, 0xCA, 0xD9, 0x1D, 0x92,
+    0xCA, 0x09, 0xCA, 0x3C, 0x90, 0xAC, 0x39, 0xC9, 0x0D, 0x3A, 0xC1, 0xCA, 0x3D, 0x09, 0xC9, 0x3C,
+    0xA0, 0xAC, 0x39, 0xC9, 0x0A, 0xA3, 0x9C, 0x10, 0x29, 0x97, 0xCA, 0x69, 0xC9, 0x69, 0xC7, 0xAC,
+    0x29, 0xA2, 0xCA, 0x1A, 0xC9, 0x2C, 0xA0, 0xAC, 0x92, 0x9C, 0x9A, 0xC9, 0x3A, 0xCA, 0xC9, 0x4D,
+    0xAD, 0x4C, 0xA0, 0x9C, 0x92, 0x9C, 0x91, 0xD2, 0xAC, 0x2A, 0xC9, 0x1A, 0xA3, 0xCA, 0x10, 0x29,
+    0x92, 0xCA, 0x2C, 0x91, 0x9C, 0x2A, 0xC2, 0xD2, 0xCA, 0x19, 0xC9, 0x1A, 0xC2, 0xD2, 0xCA, 0x19,
+    0xC9, 0x19, 0xC2, 0xAC, 0x20, 0x19, 0x90, 0x9A, 0xA2, 0xAA, 0xA3, 0xCA, 0xAC, 0xAD, 0x0C, 0xAA,
+    0xD2, 0xD9, 0x19, 0xD9, 0x1A, 0xC1, 0x9C, 0xA2, 0x9C, 0xA2, 0xAC, 0x1A, 0xC3, 0xAC, 0x3D, 0x1D,
+    0x3D, 0x3C, 0xA1, 0xCA, 0x3C, 0xA3, 0xC9, 0x09, 0xC9, 0x29, 0xC9, 0x29, 0xC1, 0x9C, 0x3A, 0xC3,
+    0xAC, 0x1A, 0xC3, 0xAA, 0x3A, 0xA1, 0x2A, 0x90, 0xAC, 0xA9, 0x3C, 0xAD, 0xAD, 0x29, 0xD9, 0x19,
+    0xC9, 0x1A, 0xCA, 0x29, 0xC9, 0x1D, 0x3A, 0xC2, 0xCA, 0x3D, 0x19, 0xC9, 0x3C, 0xA1, 0xAC, 0x92,
+    0x9C, 0x91, 0xD3, 0xAC, 0x2C, 0xA3, 0xAC, 0x10, 0x2A, 0x90, 0x9A, 0xA4, 0xC9, 0xCA, 0xAD, 0x29,
+    0xD9, 0x19, 0xC9, 0x1A, 0xCA, 0x3C, 0xA1, 0xD3, 0x9C, 0x91, 0xCA, 0x39, 0xC9, 0x1C, 0xA3, 0xD1,
+    0x9C, 0xA2, 0x9C, 0xA1, 0xAD, 0xA9, 0xAD, 0x2C, 0xA0, 0xEA, 0x3C, 0xA7, 0x9C, 0x97, 0xAC, 0x70,
+    0xD7, 0x00, 0x2A, 0xAA, 0xA9, 0x1D, 0xAA, 0xCA, 0x0A, 0xC5, 0x9C, 0x95, 0xDA, 0x59, 0xD9, 0x5D,
+    0x5D, 0x0A, 0xA9, 0x9A, 0xCA, 0x09, 0xF9, 0x10, 0x2A, 0x49, 0xC3, 0xAD, 0xAA, 0x09, 0xAD, 0xAA,
+    0x19, 0xC9, 0x3A, 0xC4, 0xD4, 0xCA, 0x4C, 0x93, 0x9C, 0x93, 0x9C, 0xA9, 0x92, 0xAD, 0x91, 0x77,
+    0x29, 0xFC, 0xA6, 0xFF, 0x5E, 0x93, 0x94, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2A, 0xD3, 0xAA,
+    0xAA, 0xAA, 0xA0, 0xE3, 0xFE, 0x9D, 0xA2, 0x9D, 0x99, 0x99, 0x90, 0xDA, 0x2A, 0xD5, 0xE2, 0xDA,
+    0x5A, 0xD9, 0x1D, 0x96, 0xEA, 0xAD, 0xAA, 0xAA, 0x93, 0xFF, 0xDA, 0x59, 0xE9, 0x99, 0x97, 0xDA,
+    0x73, 0xD9, 0x72, 0x9D, 0x73, 0xAD, 0x73, 0xAF, 0xDA, 0x6F, 0xEA, 0x20, 0x77, 0x72, 0xD1, 0xD7,
+    0x19, 0xC9, 0x09, 0xC9, 0x70, 0x9E, 0xAD, 0x79, 0xFF, 0xC5, 0xFC, 0xA9, 0xF4, 0xEA, 0xD1, 0xD5,
+    0xE0, 0x9C, 0x90, 0x9C, 0x94, 0xAD, 0x90, 0xD1, 0xD5, 0xDA, 0x1C, 0xA1, 0xCA, 0x4A, 0xD1, 0xAC,
+    0x1A, 0xC9, 0x4E, 0x1D, 0x1D, 0x5D, 0xA0, 0x9C, 0x90, 0x9C, 0x95, 0xD9, 0x0D, 0x1D, 0x59, 0xD9,
+    0x9C, 0xA1, 0xCA, 0x59, 0xD9, 0xAC, 0x1A, 0xC9, 0x6D, 0xAD, 0x1D, 0x7F, 0x90, 0x9C, 0x97, 0xAE,
+    0x1D, 0x71, 0xEA, 0x9C, 0xA0, 0x9A, 0x95, 0xAF, 0xFC, 0xA5, 0xDA, 0xFD, 0xA5, 0x9C, 0x90, 0x9C,
+    0xA7, 0x1D, 0x1D, 0x72, 0xA9, 0x1A, 0x97, 0x10, 0x77, 0x69, 0xAF, 0xCA, 0x6F, 0xFD, 0x39, 0xF9,
+    0x19, 0xAC, 0x93, 0xE9, 0x72, 0xE9, 0x72, 0x9D, 0xA7, 0x3E, 0x74, 0xD9, 0x73, 0xAD, 0x3A, 0x90,
+    0xAD, 0x91, 0xE2, 0xAC, 0x9F, 0x91, 0xDA, 0x2A, 0xEA, 0x99, 0x2D, 0xA2, 0xE9, 0x5D, 0x92, 0xDA,
+    0x6D, 0x91, 0x9D, 0x7D, 0x91, 0xAD, 0x7D, 0xA1, 0xDA, 0x7E, 0x1D, 0x97, 0x9D, 0xA0, 0xD7, 0x1F,
+    0xD1, 0x9A, 0x6F, 0xFC, 0x7A, 0xFD, 0xA7, 0x29, 0x96, 0x59, 0xFF, 0xD5, 0xAF, 0xFC, 0xA5, 0xE9,
+    0x99, 0x99, 0x99, 0x95, 0xD9, 0x74, 0x9D, 0x75, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x75, 0xD9, 0x74,
+    0x9D, 0x97, 0x4A, 0xFF, 0xC9, 0x5F, 0xFD, 0x6D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x3A, 0xAE, 0xAA,
+    0xAA, 0x69, 0xFF, 0xA7, 0x99, 0xDA, 0x99, 0x97, 0x2D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x30, 0x77,
+    0x73, 0xAF, 0xC9, 0x70, 0x9F, 0xFA, 0x7E, 0x92, 0xAC, 0x7A, 0xD7, 0x6D, 0xA7, 0x59, 0xD9, 0x75,
+    0x9D, 0x76, 0xAD, 0x73, 0x9A, 0xAE, 0xAA, 0xAA, 0xA6, 0xFF, 0xDA, 0x69, 0x9A, 0xD9, 0x99, 0x99,
+    0x71, 0xAD, 0x74, 0x99, 0xE9, 0x99, 0x99, 0x6A, 0xFF, 0xD6, 0x9A, 0xAD, 0xAA, 0xAA, 0xA9, 0x70,
+    0x9D, 0x76, 0xDA, 0x75, 0xAD, 0x74, 0x9A, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xFC, 0xA3,
+    0xFF, 0xFC, 0x92, 0x77, 0x19, 0x97, 0x74, 0x9C, 0xA7, 0x74, 0xD7, 0x74, 0xAC, 0x97, 0x0A, 0xA2,
+    0xAD, 0xA1, 0x9D, 0xAD, 0xA5, 0xD0, 0x9F, 0xD0, 0xFF, 0x39, 0xD9, 0xD9, 0x9A, 0xFD, 0x99, 0xAD,
+    0xA2, 0xAE, 0xA3, 0xFA, 0x3E, 0x2A, 0xDA, 0x4F, 0x4A, 0xD2, 0xE5, 0xE5, 0xE2, 0xDA, 0x5D, 0xA5,
+    0xDA, 0x19, 0xD9, 0x4E, 0x95, 0xD9, 0x1A, 0xD4, 0x9E, 0x59, 0xD2, 0xE4, 0xF5, 0xAD, 0x2D, 0xA3,
+    0xAE, 0xA5, 0xDA, 0x2D, 0x92, 0x9F, 0x95, 0xDA, 0x19, 0xD3, 0xD9, 0xD5, 0x9D, 0x91, 0xAD, 0x2A,
+    0xC9, 0xAD, 0x5A, 0xD2, 0xDA, 0x19, 0xD0, 0xE5, 0xAD, 0x2D, 0x91, 0xD1, 0xDA, 0x5D, 0xA6, 0xAC,
+    0xA7, 0x74, 0xD7, 0x74, 0xD7, 0x77, 0x77, 0x10, 0x4A, 0xD9, 0x4D, 0x5E, 0xA4, 0xD5, 0xEA, 0x39,
+    0xD4, 0x9F, 0x3A, 0xCA, 0x4A, 0xCA, 0xD3, 0xD9, 0x4D, 0x9D, 0x3D, 0x5D, 0x0D, 0x29, 0xD3, 0xAA,
+    0xDA, 0xDA, 0xAA, 0xEA, 0xA0, 0x9F, 0xFF, 0xDA, 0x19, 0xAC, 0xA9, 0xAC, 0xA9, 0x9D, 0x99, 0x3D,
+    0x90, 0x9C, 0xA1, 0xD3, 0x99, 0xDA, 0x9A, 0xD9, 0xAD, 0x99, 0x09, 0xFF, 0xFE, 0x09, 0xAE, 0xAA,
+    0xAD, 0xAD, 0xAA, 0x92, 0xAC, 0xA2, 0xD0, 0xD9, 0x4D, 0x92, 0xAC, 0x9D, 0x5D, 0x3A, 0xF4, 0x9D,
+    0x39, 0xEA, 0x4A, 0xD3, 0x9E, 0x94, 0xAC, 0xA4, 0xE9, 0x4D, 0x94, 0xE4, 0x4A, 0xFA, 0x97, 0x5F,
+    0xEA, 0x73, 0x9D, 0xA9, 0xAE, 0xA7, 0x29, 0xD3, 0xE7, 0x2A, 0xD3, 0x9D, 0x97, 0x1D, 0xA4, 0xD9,
+    0x71, 0xD9, 0x39, 0xD9, 0x1C, 0xA4, 0x9D, 0x49, 0xD1, 0xAC, 0x94, 0xAD, 0x4E, 0x09, 0xD9, 0x4E,
+    0x3E, 0xAF, 0xE2, 0xDA, 0x99, 0xAE, 0xAA, 0xFD, 0xA2, 0xFF, 0x92, 0xDA, 0x49, 0xFC, 0xA9, 0x4D,
+    0x94, 0xAD, 0x70, 0x9D, 0x5D, 0xA7, 0x09, 0xD5, 0xD9, 0x70, 0xAC, 0xA4, 0x9D, 0x97, 0x0D, 0xA4,
+    0x9D, 0x71, 0xD9, 0x4A, 0xD7, 0x1D, 0x94, 0xDA, 0x71, 0xFC, 0x2D, 0x97, 0x19, 0xF7, 0x71, 0x93,
+    0x4F, 0xCA, 0x97, 0x70, 0xFF, 0x76, 0x9D, 0xA9, 0xAE, 0xA7, 0x5A, 0xD3, 0xE7, 0x5E, 0x39, 0xD7,
+    0x5D, 0xA3, 0x9D, 0x91, 0xAE, 0xA9, 0x4D, 0x93, 0x9D, 0x1F, 0xE3, 0x9D, 0x4A, 0xD0, 0xE9, 0x09,
+    0xAA, 0x3A, 0xD3, 0x9D, 0xA0, 0xD9, 0x70, 0xDA, 0x29, 0xE1, 0xD9, 0x70, 0xFF, 0xC2, 0xDA, 0x70,
+    0xFE, 0xA3, 0xE9, 0x69, 0xD9, 0x9A, 0xD5, 0xEA, 0x5A, 0xD2, 0xD9, 0x5E, 0xA4, 0xDA, 0x2D, 0xA6,
+    0xE9, 0x3D, 0x92, 0xE7, 0xE2, 0x9D, 0x3A, 0xD7, 0xAD, 0x29, 0xD3, 0x9D, 0x7D, 0xA2, 0xAD, 0x4D,
+    0x99, 0xA3, 0xAD, 0x92, 0xDA, 0x4D, 0xA9, 0xFF, 0x3D, 0x94, 0xE0, 0xAF, 0xCA, 0x77, 0x39, 0x60,
+    0x2A, 0xC9, 0x39, 0xD4, 0xD9, 0x2D, 0x93, 0xE4, 0xD3, 0xD9, 0x29, 0xE3, 0xAC, 0xA3, 0xD3, 0xAE,
+    0x3D, 0x93, 0xD3, 0xF2, 0x9D, 0x4D, 0x29, 0xC9, 0xD2, 0xAC, 0xA4, 0xD2, 0xD0, 0xD2, 0xD9, 0x4D,
+    0x2C, 0xA0, 0xD1, 0x9D, 0x49, 0xD1, 0xAC, 0x90, 0xD1, 0xAC, 0xA3, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA,
+    0xAD, 0xA9, 0x2F, 0xFF, 0xFC, 0xA2, 0x9A, 0xD9, 0xDA, 0x9A, 0xD9, 0xDA, 0x94, 0xAC, 0xA0, 0xD1,
+    0x9C, 0xA0, 0xD6, 0xAC, 0xA9, 0xCA, 0x19, 0xCA, 0x9C, 0xA6, 0xAC, 0x9A, 0xC2, 0x9C, 0x9A, 0xC9,
+    0x6A, 0xC9, 0xD2, 0x9C, 0x9D, 0x7A, 0xCA, 0xC9, 0x29, 0xCA, 0xCA, 0x7A, 0xE3, 0xAE, 0x70, 0xEA,
+    0x3A, 0xE7, 0x0E, 0x93, 0xAD, 0xA7, 0x0E, 0x4A, 0xD7, 0x4A, 0xFE, 0xA6, 0xAC, 0xA4, 0xFF, 0xD9,
+    0x4D, 0x94, 0xD9, 0x39, 0xE9, 0x3D, 0x49, 0xD6, 0xDA, 0x29, 0xD4, 0xAC, 0xA6, 0x9D, 0x2A, 0xD4,
+    0xD9, 0x19, 0xA9, 0x19, 0xD2, 0xDA, 0x4D, 0x91, 0xDA, 0x19, 0xD2, 0xD9, 0x39, 0xD2, 0xD9, 0x1A,
+    0xCA, 0x2D, 0x4A, 0xD2, 0xD2, 0xD9, 0x19, 0xD4, 0xAC, 0xA1, 0x9D, 0x2D, 0x91, 0xAC, 0xA4, 0xD9,
+    0x1A, 0xCA, 0x19, 0xD2, 0xDA, 0x4D, 0x2D, 0xA1, 0xAD, 0x2D, 0x93, 0x9D, 0x2D, 0x91, 0xAC, 0xA1,
+    0x9D, 0x4A, 0xD1, 0x9D, 0x2D, 0x91, 0xAD, 0x4D, 0xA1, 0x9D, 0x2D, 0x2A, 0xCA, 0x4D, 0x91, 0xAC,
+    0xA2, 0xAA, 0x2D, 0x94, 0xD2, 0xD9, 0x69, 0xD4, 0x9D, 0x2D, 0x7D, 0xA4, 0xAC, 0xA1, 0x9D, 0x5A,
+    0xE5, 0xDA, 0x1A, 0xFF, 0xE6, 0xD9, 0x1F, 0xFC, 0xA9, 0x60, 0x77, 0x77, 0x09, 0xD9, 0x76, 0x9D,
+    0x72, 0xAA, 0xAA, 0xAE, 0xAA, 0x70, 0xFF, 0xD7, 0x09, 0x99, 0x99, 0xDA, 0x97, 0x59, 0xD7, 0x09,
+    0xAD, 0xA1, 0xAD, 0x7F, 0xE0, 0xAD, 0x6E, 0xA9, 0x09, 0xFA, 0x5A, 0xDA, 0x39, 0xE9, 0x5D, 0xA5,
+    0xE5, 0xAD, 0x6E, 0x5E, 0x6D, 0xA5, 0xD9, 0x6D, 0xA4, 0x9D, 0x95, 0x9D, 0x94, 0xAD, 0x6A, 0xD5,
+    0xAD, 0x6E, 0x5A, 0xD5, 0xAD, 0xA5, 0x9D, 0x4A, 0xE9, 0x6E, 0x2A, 0xCA, 0xD9, 0x6A, 0xFD, 0xA0,
+    0xD7, 0x0A, 0xF9, 0x09, 0xD7, 0x29, 0x77, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xFF,
+    0xE6, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x60, 0x77, 0x73, 0xAF, 0xC9, 0x70, 0x9F, 0xF9, 0x6A,
+    0xE9, 0x90, 0x9D, 0x69, 0xDA, 0x75, 0xE7, 0x5A, 0xD7, 0x6D, 0xA7, 0x39, 0x9A, 0xD9, 0x99, 0x99,
+    0x96, 0xFF, 0xE6, 0xAA, 0xEA, 0xAA, 0xAA, 0x97, 0x9D, 0x76, 0xAD, 0x74, 0xFF, 0xD7, 0xFF, 0xD7,
+    0x1A, 0xD7, 0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xDA, 0x76, 0xAD, 0xA3, 0x99, 0x70, 0xFF, 0xA7, 0x1A,
+    0xFD, 0x97, 0x49, 0x70, 0x49, 0xD6, 0x9D, 0x94, 0xAD, 0x59, 0xDA, 0x5D, 0xA4, 0x9D, 0xA6, 0xD9,
+    0x39, 0xDA, 0x69, 0xD9, 0x29, 0xDA, 0x7A, 0xD2, 0x9D, 0xA7, 0x0A, 0xD1, 0x9D, 0xA7, 0x1D, 0xA0,
+    0x9D, 0xA7, 0x2D, 0x99, 0xDA, 0x70, 0x9A, 0xFE, 0xAA, 0xAA, 0xA4, 0xFF, 0xFD, 0x49, 0x9F, 0x9E,
+    0x99, 0x97, 0xE1, 0x9D, 0x97, 0x1D, 0x92, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x0A, 0xD4, 0xDA, 0x7D,
+    0xA4, 0xE7, 0xDA, 0x49, 0xD9, 0x59, 0xD9, 0x5E, 0x59, 0xD6, 0xAD, 0x5A, 0xD7, 0xDA, 0x30, 0x1F,
+    0xFF, 0xD2, 0xFF, 0xFD, 0x29, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x97, 0xE7, 0x5D, 0xA7, 0x49, 0xD9,
+    0x09, 0xC7, 0x1A, 0xD9, 0xE7, 0x1A, 0xFA, 0x72, 0xF7, 0x3A, 0xDA, 0x72, 0xAF, 0x90, 0x9A, 0x6F,
+    0xD0, 0xAD, 0x59, 0xCA, 0x0F, 0xCA, 0x72, 0xF9, 0x72, 0xAD, 0xA7, 0x29, 0xF7, 0x2F, 0xD7, 0x19,
+    0xCA, 0x0E, 0x72, 0x91, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x72, 0x77, 0x74, 0x9A, 0xFE, 0xA7, 0x71,
+    0xFF, 0xEA, 0x77, 0xAC, 0x99, 0x29, 0xAF, 0x77, 0x70, 0xAD, 0xA7, 0x71, 0xD9, 0x3A, 0xD9, 0x77,
+    0x9D, 0x5D, 0xA7, 0x7A, 0xD5, 0xAD, 0x77, 0xDA, 0x59, 0xD7, 0x7D, 0xA5, 0x9D, 0x97, 0x6D, 0x95,
+    0x9D, 0x97, 0x59, 0xD6, 0x9D, 0x76, 0xAD, 0x6A, 0xD3, 0x9A, 0xAA, 0x95, 0xDA, 0x6E, 0x2A, 0xFD,
+    0x4D, 0x96, 0xDA, 0x1A, 0xDA, 0x9A, 0xE2, 0x9D, 0x6A, 0xD2, 0xD9, 0x29, 0xD2, 0x9D, 0x59, 0xDA,
+    0x1A, 0xD3, 0x9D, 0x2A, 0xD4, 0x9E, 0x2D, 0xA3, 0x9D, 0x2D, 0xA3, 0xAE, 0x3D, 0x93, 0xAD, 0x2D,
+    0xA9, 0x9A, 0xF3, 0x9D, 0xA2, 0xAD, 0x91, 0x9F, 0xFA, 0x49, 0xFF, 0xA2, 0xAF, 0xCA, 0x96, 0xAF,
+    0xEA, 0x77, 0x2D, 0xA1, 0x97, 0x75, 0xD9, 0x77, 0x79, 0xD7, 0x77, 0x0A, 0xD7, 0x77, 0x0A, 0xCA,
+    0x77, 0x70, 0xDA, 0x77, 0x70, 0xD9, 0x71, 0x77, 0x76, 0xAE, 0xA7, 0x4A, 0xFC, 0xA7, 0x29, 0xD9,
+    0x09, 0xD7, 0x2A, 0xCA, 0x2D, 0x72, 0xD9, 0x19, 0xD7, 0x2D, 0x29, 0xCA, 0x72, 0xD2, 0xD9, 0x72,
+    0xD1, 0x9D, 0x73, 0xD1, 0xD9, 0x73, 0xD9, 0xAC, 0xA7, 0x4D, 0xAD, 0x75, 0xAE, 0x97, 0x59, 0xDA,
+    0x76, 0x9D, 0x72, 0xAA, 0x2E, 0x71, 0x9D, 0x1F, 0x97, 0x0E, 0x0A, 0xCA, 0xAC, 0xA7, 0xAF, 0xD0,
+    0x9D, 0x69, 0xD0, 0xE1, 0x9D, 0x6D, 0x1A, 0xC9, 0x2D, 0x5D, 0x91, 0x9A, 0x3D, 0x77, 0x0D, 0x77,
+    0x0D, 0x77, 0x9D, 0x77, 0xAD, 0x76, 0x9D, 0xA7, 0x3A, 0xFC, 0x74, 0xAE, 0xA6, 0x3A, 0xFC, 0xA9,
+    0x70, 0xFF, 0xC7, 0xDA, 0x99, 0x9A, 0xE5, 0x9D, 0x93, 0x9D, 0x3A, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA,
+    0x90, 0xFF, 0xFE, 0x92, 0xDA, 0x5D, 0x94, 0xD9, 0x49, 0xD2, 0x9A, 0xAD, 0xAA, 0xAA, 0xAA, 0xEA,
+    0x90, 0xFF, 0xFE, 0x92, 0xE4, 0xE5, 0xDA, 0x29, 0xE9, 0x5F, 0xFC, 0x95, 0x9F, 0xEA, 0x7A, 0xD7,
+    0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7, 0x50, 0x77, 0x73, 0x9C,
+    0xA7, 0x39, 0xAF, 0xDA, 0x69, 0xFF, 0xE4, 0xAF, 0x9D, 0x99, 0xAD, 0x3A, 0xE9, 0x09, 0xCA, 0x79,
+    0xE2, 0x9C, 0x97, 0xE3, 0xAC, 0x79, 0xDA, 0x3D, 0x7E, 0x4D, 0x7D, 0xA3, 0x9C, 0xA6, 0x9D, 0x93,
+    0xAC, 0x96, 0xAD, 0x4F, 0xF1, 0xE4, 0xFF, 0x1E, 0x4D, 0x99, 0x9E, 0x1E, 0x39, 0xCA, 0x2D, 0xA1,
+    0xE3, 0xAC, 0x91, 0x9D, 0x91, 0xAD, 0x3D, 0x29, 0xD2, 0x9D, 0xA2, 0xD2, 0xAD, 0x3E, 0x90, 0x9C,
+    0xA2, 0xDA, 0x39, 0xEA, 0xAC, 0x91, 0x9D, 0x94, 0x9F, 0xFE, 0x7A, 0xFE, 0xA9, 0x71, 0xD9, 0x75,
+    0x9C, 0xA7, 0x79, 0x72, 0x72, 0x9D, 0x97, 0x7E, 0xA7, 0x6A, 0xEA, 0x76, 0xDA, 0xD7, 0x5A, 0xD9,
+    0xD7, 0x5D, 0x99, 0xD7, 0x4E, 0x1D, 0x73, 0x9D, 0x91, 0xD9, 0x6A, 0xFF, 0xFE, 0x92, 0xFF, 0xFF,
+    0x6E, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x59, 0xFF, 0xFE, 0x92, 0xFF, 0xFF, 0x94, 0xDA, 0x59, 0xD9,
+    0x5A, 0xD7, 0xD9, 0x5D, 0xA7, 0xD9, 0x4E, 0x70, 0xDA, 0x39, 0xDA, 0x70, 0xDA, 0x3E, 0x71, 0xAD,
+    0x29, 0xD9, 0x71, 0xAD, 0x20, 0x77, 0x79, 0xAF, 0xCA, 0x70, 0x9F, 0xFC, 0x70, 0xD9, 0x90, 0x9F,
+    0x76, 0xE7, 0x69, 0xD9, 0x75, 0x9D, 0x97, 0x5E, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x2F,
+    0xFF, 0xE2, 0x99, 0x99, 0x99, 0xFC, 0xA9, 0x96, 0x9A, 0xFC, 0x95, 0x99, 0x9F, 0xDA, 0x99, 0x99,
+    0x92, 0xFF, 0xFE, 0x2A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x3D, 0xA7, 0x59, 0xD9, 0x75, 0x9D,
+    0x97, 0x59, 0xDA, 0x76, 0xEA, 0x39, 0xAC, 0x69, 0xFF, 0xD7, 0x0A, 0xFE, 0x97, 0x39, 0x97, 0x00,
+    0x77, 0x72, 0x9C, 0xA7, 0x29, 0xAF, 0xCA, 0x95, 0x9F, 0xFD, 0x4A, 0xEA, 0x9D, 0x99, 0xCA, 0x3A,
+    0xE2, 0xCA, 0x69, 0xE2, 0x9C, 0x96, 0xE3, 0xAC, 0x69, 0xD9, 0x3D, 0x6E, 0x4D, 0x6D, 0xA3, 0x9C,
+    0xA5, 0x9D, 0x93, 0xAC, 0x95, 0xAD, 0x4A, 0xC6, 0xE4, 0xD6, 0xE4, 0xCA, 0x6E, 0x39, 0xCA, 0x6E,
+    0x3A, 0xC9, 0x6A, 0xD3, 0xD7, 0x9D, 0xA2, 0xD7, 0x0E, 0x91, 0xCA, 0x70, 0x9E, 0xAA, 0xC9, 0x09,
+    0xA9, 0x5A, 0xFF, 0xCA, 0x69, 0xAF, 0xDA, 0x97, 0x1D, 0x75, 0x9C, 0xA7, 0x69, 0x71, 0x77, 0x69,
+    0xC9, 0x3A, 0xC7, 0x0D, 0x4D, 0x7A, 0xD3, 0xAD, 0x59, 0xAE, 0xAA, 0xAA, 0xEA, 0xAA, 0x90, 0xAF,
+    0xFF, 0xE9, 0x19, 0xAD, 0x99, 0x99, 0xAD, 0x99, 0x99, 0x3A, 0xD3, 0xAD, 0x7E, 0x3E, 0x7D, 0xA3,
+    0xDA, 0x7D, 0x92, 0x9D, 0x96, 0x9D, 0x39, 0xD7, 0xAD, 0x3A, 0xD7, 0xE3, 0xDA, 0x7D, 0xA3, 0xD9,
+    0x7D, 0x92, 0x9D, 0x96, 0x9D, 0x39, 0xD7, 0xAD, 0x39, 0xD9, 0x6D, 0xA4, 0xFD, 0x3D, 0xA4, 0x9F,
+    0xA7, 0x69, 0x40, 0x77, 0x77, 0x0A, 0xFC, 0xA9, 0x72, 0x9F, 0xFC, 0x97, 0x09, 0xEA, 0x90, 0x99,
+    0xD7, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x09, 0xD9, 0x77, 0x09, 0xD9, 0x77, 0x09, 0xE7, 0x71, 0xF7,
+    0x71, 0xF9, 0x77, 0x0A, 0xF7, 0x70, 0x9F, 0x77, 0x1A, 0xE7, 0x71, 0xE9, 0x29, 0xAA, 0x1A, 0xA1,
+    0x9A, 0xA1, 0x9D, 0x92, 0xCA, 0xCA, 0xCA, 0xD9, 0xCA, 0xCA, 0x09, 0xD9, 0x19, 0xC0, 0xD9, 0x09,
+    0xCA, 0x1C, 0xA0, 0x9D, 0x92, 0xC9, 0xCA, 0x19, 0xC2, 0xCA, 0x0E, 0x3A, 0xD9, 0x1A, 0xC2, 0xCA,
+    0xE9, 0x4F, 0xAD, 0x99, 0xAF, 0x95, 0xAC, 0xAF, 0xFC, 0x97, 0xCA, 0x19, 0xC9, 0x99, 0xCA, 0x71,
+    0xC9, 0x19, 0xC2, 0xCA, 0x71, 0x97, 0x97, 0x00, 0x1A, 0xFF, 0xF9, 0x1F, 0xFF, 0xC9, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFC, 0xA1,
+    0xFF, 0xFC, 0x96, 0xDA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAD, 0x74, 0xE7, 0x4D, 0xA7, 0x4D, 0x97,
+    0x39, 0xD7, 0x4A, 0xD7, 0x4E, 0x74, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4A, 0xD7, 0x10, 0x2F,
+    0xFE, 0xA1, 0x9F, 0xFE, 0xA5, 0xAD, 0xA7, 0x3A, 0xD7, 0x4D, 0xA5, 0xFF, 0xEA, 0x19, 0xFF, 0xEA,
+    0x79, 0xD9, 0x72, 0xE7, 0x19, 0xE6, 0xFE, 0x7E, 0xAA, 0x97, 0x0D, 0xA7, 0x39, 0xD7, 0x4D, 0xA7,
+    0x3A, 0xD7, 0x4D, 0xA7, 0x3A, 0xD7, 0x4D, 0xA7, 0x3E, 0x73, 0x9D, 0x96, 0x49, 0xD9, 0x73, 0xAD,
+    0x74, 0xAD, 0x49, 0x6D, 0xA1, 0x9A, 0xD6, 0xFE, 0xA9, 0x5A, 0xFA, 0x95, 0x9F, 0xC9, 0x70, 0xAC,
+    0xAE, 0x29, 0xD6, 0xDA, 0x9F, 0xA5, 0x9F, 0xCA, 0x95, 0xAF, 0xA7, 0x0A, 0xFC, 0x79, 0x09, 0x1E,
+    0x6D, 0xA2, 0xDA, 0x59, 0xD9, 0x19, 0xD9, 0x5A, 0xD2, 0x9D, 0x6D, 0xA2, 0xAD, 0x5E, 0x3D, 0xA3,
+    0x9E, 0x93, 0xDA, 0x09, 0x9F, 0x93, 0x9F, 0xFC, 0x94, 0xAF, 0xDA, 0x97, 0x75, 0x77, 0x4A, 0xE9,
+    0x74, 0xAD, 0xAD, 0x74, 0xD1, 0xAC, 0xA7, 0x29, 0xC9, 0x19, 0xCA, 0x72, 0x9C, 0xA1, 0xAC, 0x97,
+    0x3D, 0xA9, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0xFE, 0x39, 0xAE, 0xAA, 0xAA, 0xAA, 0xAF,
+    0x49, 0xCA, 0x70, 0xAC, 0x93, 0xAC, 0x97, 0x1C, 0x93, 0xD7, 0x2C, 0xA3, 0xD0, 0x9C, 0xA0, 0x9C,
+    0x92, 0xC9, 0x3D, 0xAE, 0xAE, 0x1A, 0xC3, 0x9E, 0x99, 0xDA, 0x9D, 0xAD, 0x39, 0xD9, 0x1A, 0xA1,
+    0x9E, 0x39, 0xDA, 0x75, 0xAF, 0x75, 0xCA, 0x0D, 0x77, 0x0E, 0x93, 0x97, 0x2F, 0xF7, 0x3F, 0xDA,
+    0x76, 0x97, 0x00, 0x74, 0xAC, 0xA7, 0x72, 0xDA, 0x77, 0x2D, 0x97, 0x71, 0x9D, 0x77, 0x2A, 0xD7,
+    0x72, 0xE7, 0x79, 0x99, 0xE9, 0x97, 0x29, 0xFF, 0xEA, 0x7F, 0xFF, 0xE5, 0xEA, 0x2A, 0xD2, 0xAD,
+    0x93, 0x9D, 0xA3, 0xDA, 0x3E, 0x3E, 0x4D, 0xA3, 0xAD, 0x29, 0xD9, 0x39, 0xD9, 0x3A, 0xD2, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x2E, 0x4E, 0x4E, 0x2D, 0xA4, 0xDA, 0x4D, 0xA2, 0xD9, 0x73, 0x9D, 0x91, 0x9D,
+    0x97, 0x39, 0xD2, 0xAD, 0x74, 0xAD, 0x2E, 0x74, 0xE2, 0xDA, 0x74, 0xDA, 0x10, 0x59, 0xFE, 0xA9,
+    0x70, 0xAF, 0xFD, 0x7E, 0x99, 0x99, 0xAF, 0x6D, 0xA5, 0xE9, 0x49, 0xD9, 0x59, 0xD9, 0x4A, 0xD6,
+    0x9D, 0x94, 0xE6, 0x9D, 0x94, 0xDA, 0x6A, 0xD5, 0xD9, 0x59, 0xDA, 0x49, 0xD5, 0xAE, 0x3A, 0xAE,
+    0xAA, 0xAA, 0xFC, 0x39, 0xFF, 0xF9, 0x49, 0xAA, 0xEA, 0xAA, 0x99, 0x72, 0xD9, 0x76, 0x9D, 0x75,
+    0xFF, 0xCA, 0x79, 0xFF, 0xCA, 0x72, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x7A, 0xD7, 0x50, 0x73,
+    0xCA, 0x1C, 0xA7, 0x49, 0xC9, 0x1C, 0xA7, 0x49, 0xC9, 0x09, 0xC9, 0x74, 0xFD, 0xA7, 0x19, 0xFF,
+    0xD7, 0xAF, 0xC9, 0xAF, 0x6A, 0xEA, 0xC9, 0x1C, 0xA7, 0xAD, 0xA0, 0xAC, 0x19, 0xC9, 0x7E, 0x1D,
+    0x1A, 0xC7, 0xAD, 0x2D, 0x1D, 0x7D, 0xA2, 0xCA, 0x1C, 0xA6, 0x9D, 0x91, 0x9C, 0x90, 0x9C, 0x96,
+    0xAD, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x77, 0x1D, 0xA7, 0x70,
+    0xAD, 0x97, 0x70, 0xAD, 0x97, 0x49, 0x99, 0x9F, 0xA9, 0x99, 0x99, 0x4F, 0xFF, 0xE4, 0xFF, 0xFD,
+    0xA3, 0x69, 0xC9, 0x09, 0xC7, 0x1A, 0xC1, 0xD7, 0x1D, 0x1D, 0x69, 0xFE, 0xA6, 0xAF, 0xFA, 0x5E,
+    0x99, 0x9A, 0xE9, 0x4D, 0xA3, 0x9E, 0x39, 0xD9, 0x4E, 0x3A, 0xD5, 0xAD, 0x3A, 0xD5, 0xE3, 0xDA,
+    0x49, 0xD9, 0x3D, 0x93, 0xAD, 0xA3, 0x9F, 0xFC, 0x94, 0xAF, 0xF9, 0x5E, 0x29, 0xAD, 0xA4, 0xDA,
+    0x4A, 0xD9, 0x3D, 0x95, 0xDA, 0x29, 0xD6, 0xDA, 0x2A, 0xD6, 0xDA, 0x2D, 0xA5, 0x9D, 0x92, 0xDA,
+    0x5E, 0x29, 0xD9, 0x29, 0xAE, 0x92, 0x9F, 0xFD, 0x93, 0xAF, 0xF9, 0x79, 0xC9, 0x0A, 0xC7, 0x1A,
+    0xC1, 0xD7, 0x1C, 0xA1, 0xCA, 0x70, 0x0F, 0xE1, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x00, 0x77, 0x77,
+    0x7C, 0x97, 0x77, 0xE9, 0x77, 0x5F, 0xC9, 0x77, 0x3F, 0xE9, 0x77, 0x1F, 0xFC, 0x97, 0x7E, 0xAA,
+    0x99, 0xAE, 0x97, 0x5D, 0x96, 0xE9, 0x73, 0xE7, 0x0E, 0x97, 0x1F, 0xA0, 0x9A, 0xCA, 0x2A, 0xE9,
+    0x7F, 0xFE, 0x29, 0xF9, 0x5F, 0xFF, 0x2A, 0xFC, 0x93, 0xFF, 0xF9, 0x2F, 0xE9, 0x1F, 0xFF, 0x92,
+    0xAF, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA0, 0x9F, 0xFC, 0xA2, 0xFF, 0xDA, 0x29, 0xFF, 0xA1,
+    0x9F, 0xFC, 0xA4, 0x9F, 0xEA, 0x1A, 0xFF, 0xA6, 0x9F, 0xFF, 0xFC, 0xA7, 0x09, 0xFF, 0xFE, 0xA7,
+    0x29, 0xF9, 0x19, 0xFC, 0xA7, 0x49, 0xE3, 0xFA, 0x76, 0x9D, 0x92, 0xEA, 0x77, 0x09, 0xD9, 0x9E,
+    0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x49, 0xEA, 0x77, 0x69, 0xCA, 0x77, 0x70, 0x97, 0x40,
 };
 
 static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 9, 22, 10, 0, 21, 50, 0 }, // !
-    { 10, 8, 14, 3, 21, 20, 50 }, // "
-    { 20, 21, 21, 0, 21, 105, 70 }, // #
-    { 16, 25, 17, 0, 23, 100, 175 }, // $
-    { 21, 23, 24, 2, 22, 121, 275 }, // %
-    { 19, 23, 20, 0, 22, 110, 396 }, // &
-    { 4, 8, 8, 3, 21, 8, 506 }, // '
-    { 10, 26, 12, 1, 21, 65, 514 }, // (
-    { 11, 26, 9, -3, 21, 72, 579 }, // )
-    { 14, 15, 18, 3, 23, 53, 651 }, // *
-    { 14, 15, 17, 2, 18, 53, 704 }, // +
-    { 7, 8, 7, -2, 4, 14, 757 }, // ,
-    { 9, 3, 10, 0, 9, 7, 771 }, // -
-    { 5, 5, 7, 0, 4, 7, 778 }, // .
-    { 15, 21, 14, -2, 21, 79, 785 }, // /
-    { 15, 23, 17, 1, 22, 87, 864 }, // 0
-    { 9, 21, 16, 4, 21, 48, 951 }, // 1
-    { 16, 22, 17, 0, 22, 88, 999 }, // 2
-    { 16, 23, 17, 0, 22, 92, 1087 }, // 3
-    { 16, 21, 17, 0, 21, 84, 1179 }, // 4
-    { 15, 22, 17, 1, 21, 83, 1263 }, // 5
-    { 15, 23, 17, 1, 22, 87, 1346 }, // 6
-    { 15, 21, 18, 2, 21, 79, 1433 }, // 7
-    { 15, 23, 17, 1, 22, 87, 1512 }, // 8
-    { 15, 23, 17, 1, 22, 87, 1599 }, // 9
-    { 7, 18, 8, 0, 17, 32, 1686 }, // :
-    { 9, 21, 8, -2, 17, 48, 1718 }, // ;
-    { 14, 15, 17, 2, 18, 53, 1766 }, // <
-    { 14, 9, 17, 2, 15, 32, 1819 }, // =
-    { 14, 15, 17, 2, 18, 53, 1851 }, // >
-    { 12, 23, 15, 2, 22, 69, 1904 }, // ?
-    { 23, 24, 25, 1, 21, 138, 1973 }, // @
-    { 17, 21, 16, -2, 21, 90, 2111 }, // A
-    { 17, 21, 19, 1, 21, 90, 2201 }, // B
-    { 17, 23, 20, 2, 22, 98, 2291 }, // C
-    { 18, 21, 20, 1, 21, 95, 2389 }, // D
-    { 16, 21, 18, 1, 21, 84, 2484 }, // E
-    { 16, 21, 18, 1, 21, 84, 2568 }, // F
-    { 18, 23, 21, 2, 22, 104, 2652 }, // G
-    { 19, 21, 21, 1, 21, 100, 2756 }, // H
-    { 13, 21, 13, -1, 21, 69, 2856 }, // I
-    { 14, 27, 10, -5, 21, 95, 2925 }, // J
-    { 18, 21, 20, 1, 21, 95, 3020 }, // K
-    { 12, 21, 14, 1, 21, 63, 3115 }, // L
-    { 24, 21, 26, 1, 21, 126, 3178 }, // M
-    { 20, 21, 22, 1, 21, 105, 3304 }, // N
-    { 19, 23, 22, 2, 22, 110, 3409 }, // O
-    { 16, 21, 18, 1, 21, 84, 3519 }, // P
-    { 19, 27, 22, 2, 22, 129, 3603 }, // Q
-    { 16, 21, 18, 1, 21, 84, 3732 }, // R
-    { 16, 23, 17, 0, 22, 92, 3816 }, // S
-    { 16, 21, 19, 2, 21, 84, 3908 }, // T
-    { 19, 22, 22, 2, 21, 105, 3992 }, // U
-    { 17, 21, 20, 2, 21, 90, 4097 }, // V
-    { 25, 21, 29, 3, 21, 132, 4187 }, // W
-    { 20, 21, 19, -2, 21, 105, 4319 }, // X
-    { 16, 21, 19, 2, 21, 84, 4424 }, // Y
-    { 18, 21, 18, -1, 21, 95, 4508 }, // Z
-    { 12, 26, 12, -1, 21, 78, 4603 }, // [
-    { 6, 21, 10, 3, 21, 32, 4681 }, // <backslash>
-    { 12, 26, 10, -3, 21, 78, 4713 }, // ]
-    { 15, 14, 17, 1, 21, 53, 4791 }, // ^
-    { 13, 3, 12, -3, -2, 10, 4844 }, // _
-    { 6, 6, 11, 4, 23, 9, 4854 }, // `
-    { 16, 17, 18, 1, 16, 68, 4863 }, // a
-    { 16, 24, 17, 0, 23, 96, 4931 }, // b
-    { 13, 17, 15, 1, 16, 56, 5027 }, // c
-    { 17, 24, 19, 1, 23, 102, 5083 }, // d
-    { 13, 17, 15, 1, 16, 56, 5185 }, // e
-    { 17, 30, 14, -4, 23, 128, 5241 }, // f
-    { 17, 23, 18, 0, 16, 98, 5369 }, // g
-    { 16, 23, 17, 0, 23, 92, 5467 }, // h
-    { 8, 22, 9, 0, 22, 44, 5559 }, // i
-    { 12, 29, 9, -4, 22, 87, 5603 }, // j
-    { 16, 23, 17, 0, 23, 92, 5690 }, // k
-    { 9, 23, 10, 0, 23, 52, 5782 }, // l
-    { 24, 16, 26, 0, 16, 96, 5834 }, // m
-    { 16, 17, 17, 0, 17, 68, 5930 }, // n
-    { 15, 17, 17, 1, 16, 64, 5998 }, // o
-    { 17, 23, 17, -1, 16, 98, 6062 }, // p
-    { 16, 23, 18, 1, 16, 92, 6160 }, // q
-    { 13, 16, 14, 0, 16, 52, 6252 }, // r
-    { 13, 17, 14, 0, 16, 56, 6304 }, // s
-    { 10, 21, 12, 1, 20, 53, 6360 }, // t
-    { 16, 17, 18, 1, 16, 68, 6413 }, // u
-    { 15, 16, 17, 1, 16, 60, 6481 }, // v
-    { 22, 16, 24, 1, 16, 88, 6541 }, // w
-    { 17, 16, 16, -2, 16, 68, 6629 }, // x
-    { 19, 23, 17, -3, 16, 110, 6697 }, // y
-    { 14, 16, 14, -1, 16, 56, 6807 }, // z
-    { 12, 26, 13, 0, 21, 78, 6863 }, // {
-    { 3, 31, 16, 7, 23, 24, 6941 }, // |
-    { 13, 26, 12, -2, 21, 85, 6965 }, // }
-    { 14, 5, 17, 2, 13, 18, 7050 }, // ~
-    { 0, 0, 8, 0, 0, 0, 7068 }, //  
-    { 9, 22, 9, -1, 16, 50, 7068 }, // ¡
-    { 13, 23, 17, 3, 22, 75, 7118 }, // ¢
-    { 18, 22, 18, -1, 22, 99, 7193 }, // £
-    { 13, 13, 16, 2, 17, 43, 7292 }, // ¤
-    { 17, 21, 19, 1, 21, 90, 7335 }, // ¥
-    { 3, 31, 16, 7, 23, 24, 7425 }, // ¦
-    { 15, 24, 16, 0, 23, 90, 7449 }, // §
-    { 9, 4, 16, 6, 22, 9, 7539 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 7548 }, // ©
-    { 10, 11, 13, 2, 22, 28, 7675 }, // ª
-    { 13, 13, 15, 1, 14, 43, 7703 }, // «
-    { 14, 9, 17, 2, 12, 32, 7746 }, // ¬
-    { 9, 3, 10, 0, 9, 7, 7778 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7785 }, // ®
-    { 13, 3, 16, 2, 25, 10, 7912 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 7922 }, // °
-    { 14, 18, 17, 2, 18, 63, 7947 }, // ±
-    { 10, 13, 13, 2, 25, 33, 8010 }, // ²
-    { 10, 14, 13, 2, 25, 35, 8043 }, // ³
-    { 7, 6, 11, 3, 23, 11, 8078 }, // ´
-    { 18, 23, 18, -1, 16, 104, 8089 }, // µ
-    { 16, 27, 19, 2, 23, 108, 8193 }, // ¶
-    { 5, 5, 8, 2, 13, 7, 8301 }, // ·
-    { 7, 7, 6, -3, 0, 13, 8308 }, // ¸
-    { 7, 13, 12, 4, 25, 23, 8321 }, // ¹
-    { 9, 11, 12, 2, 22, 25, 8344 }, // º
-    { 13, 13, 14, 0, 14, 43, 8369 }, // »
-    { 19, 21, 22, 2, 21, 100, 8412 }, // ¼
-    { 21, 21, 24, 2, 21, 111, 8512 }, // ½
-    { 22, 21, 24, 1, 21, 116, 8623 }, // ¾
-    { 12, 22, 13, -1, 16, 66, 8739 }, // ¿
-    { 17, 28, 16, -2, 28, 119, 8805 }, // À
-    { 19, 28, 18, -2, 28, 133, 8924 }, // Á
-    { 18, 28, 17, -2, 28, 126, 9057 }, // Â
-    { 20, 27, 19, -2, 27, 135, 9183 }, // Ã
-    { 18, 27, 17, -2, 27, 122, 9318 }, // Ä
-    { 17, 29, 16, -2, 29, 124, 9440 }, // Å
-    { 28, 21, 27, -2, 21, 147, 9564 }, // Æ
-    { 17, 29, 20, 2, 22, 124, 9711 }, // Ç
-    { 16, 28, 18, 1, 28, 112, 9835 }, // È
-    { 16, 28, 18, 1, 28, 112, 9947 }, // É
-    { 16, 28, 18, 1, 28, 112, 10059 }, // Ê
-    { 16, 27, 18, 1, 27, 108, 10171 }, // Ë
-    { 13, 28, 13, -1, 28, 91, 10279 }, // Ì
-    { 14, 28, 14, -1, 28, 98, 10370 }, // Í
-    { 14, 28, 14, -1, 28, 98, 10468 }, // Î
-    { 14, 27, 14, -1, 27, 95, 10566 }, // Ï
-    { 19, 21, 20, 0, 21, 100, 10661 }, // Ð
-    { 20, 27, 22, 1, 27, 135, 10761 }, // Ñ
-    { 19, 29, 22, 2, 28, 138, 10896 }, // Ò
-    { 19, 29, 22, 2, 28, 138, 11034 }, // Ó
-    { 19, 29, 22, 2, 28, 138, 11172 }, // Ô
-    { 19, 28, 22, 2, 27, 133, 11310 }, // Õ
-    { 19, 28, 22, 2, 27, 133, 11443 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 11576 }, // ×
-    { 20, 24, 22, 1, 22, 120, 11625 }, // Ø
-    { 19, 29, 22, 2, 28, 138, 11745 }, // Ù
-    { 19, 29, 22, 2, 28, 138, 11883 }, // Ú
-    { 19, 29, 22, 2, 28, 138, 12021 }, // Û
-    { 19, 28, 22, 2, 27, 133, 12159 }, // Ü
-    { 16, 28, 19, 2, 28, 112, 12292 }, // Ý
-    { 15, 21, 17, 1, 21, 79, 12404 }, // Þ
-    { 21, 30, 18, -4, 23, 158, 12483 }, // ß
-    { 16, 24, 18, 1, 23, 96, 12641 }, // à
-    { 16, 24, 18, 1, 23, 96, 12737 }, // á
-    { 16, 24, 18, 1, 23, 96, 12833 }, // â
-    { 16, 23, 18, 1, 22, 92, 12929 }, // ã
-    { 16, 23, 18, 1, 22, 92, 13021 }, // ä
-    { 16, 25, 18, 1, 24, 100, 13113 }, // å
-    { 23, 17, 25, 1, 16, 98, 13213 }, // æ
-    { 13, 23, 15, 1, 16, 75, 13311 }, // ç
-    { 13, 24, 15, 1, 23, 78, 13386 }, // è
-    { 14, 24, 16, 1, 23, 84, 13464 }, // é
-    { 13, 24, 15, 1, 23, 78, 13548 }, // ê
-    { 13, 23, 15, 1, 22, 75, 13626 }, // ë
-    { 8, 23, 9, 0, 23, 46, 13701 }, // ì
-    { 11, 23, 12, 0, 23, 64, 13747 }, // í
-    { 11, 23, 12, 0, 23, 64, 13811 }, // î
-    { 11, 22, 12, 0, 22, 61, 13875 }, // ï
-    { 16, 24, 18, 1, 23, 96, 13936 }, // ð
-    { 17, 22, 18, 0, 22, 94, 14032 }, // ñ
-    { 15, 24, 17, 1, 23, 90, 14126 }, // ò
-    { 15, 24, 17, 1, 23, 90, 14216 }, // ó
-    { 15, 24, 17, 1, 23, 90, 14306 }, // ô
-    { 15, 23, 17, 1, 22, 87, 14396 }, // õ
-    { 15, 23, 17, 1, 22, 87, 14483 }, // ö
-    { 14, 14, 17, 2, 17, 49, 14570 }, // ÷
-    { 16, 19, 17, 0, 17, 76, 14619 }, // ø
-    { 16, 24, 18, 1, 23, 96, 14695 }, // ù
-    { 16, 24, 18, 1, 23, 96, 14791 }, // ú
-    { 16, 24, 18, 1, 23, 96, 14887 }, // û
-    { 16, 23, 18, 1, 22, 92, 14983 }, // ü
-    { 19, 30, 17, -3, 23, 143, 15075 }, // ý
-    { 17, 30, 17, -1, 23, 128, 15218 }, // þ
-    { 19, 29, 17, -3, 22, 138, 15346 }, // ÿ
-    { 18, 25, 17, -2, 25, 113, 15484 }, // Ā
-    { 16, 21, 18, 1, 20, 84, 15597 }, // ā
-    { 19, 27, 18, -2, 27, 129, 15681 }, // Ă
-    { 16, 23, 18, 1, 22, 92, 15810 }, // ă
-    { 17, 28, 16, -2, 21, 119, 15902 }, // Ą
-    { 16, 23, 18, 1, 16, 92, 16021 }, // ą
-    { 17, 29, 20, 2, 28, 124, 16113 }, // Ć
-    { 14, 24, 16, 1, 23, 84, 16237 }, // ć
-    { 17, 29, 20, 2, 28, 124, 16321 }, // Ĉ
-    { 13, 24, 15, 1, 23, 78, 16445 }, // ĉ
-    { 17, 28, 20, 2, 27, 119, 16523 }, // Ċ
-    { 13, 23, 15, 1, 22, 75, 16642 }, // ċ
-    { 17, 29, 20, 2, 28, 124, 16717 }, // Č
-    { 14, 24, 16, 1, 23, 84, 16841 }, // č
-    { 18, 28, 20, 1, 28, 126, 16925 }, // Ď
-    { 22, 24, 24, 1, 23, 132, 17051 }, // ď
-    { 19, 21, 20, 0, 21, 100, 17183 }, // Đ
-    { 18, 24, 20, 1, 23, 108, 17283 }, // đ
-    { 16, 25, 18, 1, 25, 100, 17391 }, // Ē
-    { 13, 21, 15, 1, 20, 69, 17491 }, // ē
-    { 16, 27, 18, 1, 27, 108, 17560 }, // Ĕ
-    { 14, 23, 16, 1, 22, 81, 17668 }, // ĕ
-    { 16, 27, 18, 1, 27, 108, 17749 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 17857 }, // ė
-    { 16, 28, 18, 1, 21, 112, 17932 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 18044 }, // ę
-    { 16, 28, 18, 1, 28, 112, 18119 }, // Ě
-    { 14, 24, 16, 1, 23, 84, 18231 }, // ě
-    { 18, 29, 21, 2, 28, 131, 18315 }, // Ĝ
-    { 17, 30, 18, 0, 23, 128, 18446 }, // ĝ
-    { 18, 28, 21, 2, 27, 126, 18574 }, // Ğ
-    { 17, 29, 18, 0, 22, 124, 18700 }, // ğ
-    { 18, 28, 21, 2, 27, 126, 18824 }, // Ġ
-    { 17, 29, 18, 0, 22, 124, 18950 }, // ġ
-    { 18, 29, 21, 2, 22, 131, 19074 }, // Ģ
-    { 17, 30, 18, 0, 23, 128, 19205 }, // ģ
-    { 19, 28, 21, 1, 28, 133, 19333 }, // Ĥ
-    { 16, 30, 17, 0, 30, 120, 19466 }, // ĥ
-    { 21, 21, 23, 1, 21, 111, 19586 }, // Ħ
-    { 16, 23, 17, 0, 23, 92, 19697 }, // ħ
-    { 15, 27, 15, -1, 27, 102, 19789 }, // Ĩ
-    { 12, 22, 13, 0, 22, 66, 19891 }, // ĩ
-    { 14, 25, 14, -1, 25, 88, 19957 }, // Ī
-    { 11, 20, 12, 0, 20, 55, 20045 }, // ī
-    { 14, 27, 14, -1, 27, 95, 20100 }, // Ĭ
-    { 11, 22, 12, 0, 22, 61, 20195 }, // ĭ
-    { 13, 28, 13, -1, 21, 91, 20256 }, // Į
-    { 9, 29, 9, -1, 22, 66, 20347 }, // į
-    { 13, 27, 13, -1, 27, 88, 20413 }, // İ
-    { 7, 16, 8, 0, 16, 28, 20501 }, // ı
-    { 19, 27, 19, -1, 21, 129, 20529 }, // Ĳ
-    { 16, 29, 17, 0, 22, 116, 20658 }, // ĳ
-    { 17, 34, 13, -5, 28, 145, 20774 }, // Ĵ
-    { 15, 30, 12, -4, 23, 113, 20919 }, // ĵ
-    { 18, 28, 20, 1, 21, 126, 21032 }, // Ķ
-    { 16, 30, 17, 0, 23, 120, 21158 }, // ķ
-    { 16, 16, 17, 0, 16, 64, 21278 }, // ĸ
-    { 12, 28, 14, 1, 28, 84, 21342 }, // Ĺ
-    { 12, 30, 13, 0, 30, 90, 21426 }, // ĺ
-    { 12, 28, 14, 1, 21, 84, 21516 }, // Ļ
-    { 11, 30, 10, -2, 23, 83, 21600 }, // ļ
-    { 15, 21, 17, 1, 21, 79, 21683 }, // Ľ
-    { 13, 23, 14, 0, 23, 75, 21762 }, // ľ
-    { 12, 21, 14, 1, 21, 63, 21837 }, // Ŀ
-    { 11, 23, 12, 0, 23, 64, 21900 }, // ŀ
-    { 13, 21, 14, 0, 21, 69, 21964 }, // Ł
-    { 9, 23, 10, 0, 23, 52, 22033 }, // ł
-    { 20, 28, 22, 1, 28, 140, 22085 }, // Ń
-    { 16, 23, 17, 0, 23, 92, 22225 }, // ń
-    { 20, 28, 22, 1, 21, 140, 22317 }, // Ņ
-    { 16, 24, 17, 0, 17, 96, 22457 }, // ņ
-    { 20, 28, 22, 1, 28, 140, 22553 }, // Ň
-    { 16, 23, 17, 0, 23, 92, 22693 }, // ň
-    { 17, 21, 19, 1, 21, 90, 22785 }, // ŉ
-    { 20, 27, 22, 1, 21, 135, 22875 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 23010 }, // ŋ
-    { 19, 26, 22, 2, 25, 124, 23102 }, // Ō
-    { 15, 21, 17, 1, 20, 79, 23226 }, // ō
-    { 19, 28, 22, 2, 27, 133, 23305 }, // Ŏ
-    { 15, 23, 17, 1, 22, 87, 23438 }, // ŏ
-    { 20, 29, 23, 2, 28, 145, 23525 }, // Ő
-    { 17, 24, 19, 1, 23, 102, 23670 }, // ő
-    { 25, 23, 28, 2, 22, 144, 23772 }, // Œ
-    { 24, 17, 26, 1, 16, 102, 23916 }, // œ
-    { 16, 28, 18, 1, 28, 112, 24018 }, // Ŕ
-    { 14, 23, 15, 0, 23, 81, 24130 }, // ŕ
-    { 16, 28, 18, 1, 21, 112, 24211 }, // Ŗ
-    { 14, 23, 14, -1, 16, 81, 24323 }, // ŗ
-    { 16, 28, 18, 1, 28, 112, 24404 }, // Ř
-    { 15, 23, 16, 0, 23, 87, 24516 }, // ř
-    { 16, 29, 17, 0, 28, 116, 24603 }, // Ś
-    { 13, 24, 14, 0, 23, 78, 24719 }, // ś
-    { 16, 29, 17, 0, 28, 116, 24797 }, // Ŝ
-    { 13, 24, 14, 0, 23, 78, 24913 }, // ŝ
-    { 16, 29, 17, 0, 22, 116, 24991 }, // Ş
-    { 13, 23, 14, 0, 16, 75, 25107 }, // ş
-    { 16, 29, 17, 0, 28, 116, 25182 }, // Š
-    { 14, 24, 15, 0, 23, 84, 25298 }, // š
-    { 16, 28, 19, 2, 21, 112, 25382 }, // Ţ
-    { 11, 27, 12, 0, 20, 75, 25494 }, // ţ
-    { 16, 28, 19, 2, 28, 112, 25569 }, // Ť
-    { 12, 24, 14, 1, 23, 72, 25681 }, // ť
-    { 16, 21, 19, 2, 21, 84, 25753 }, // Ŧ
-    { 11, 21, 12, 0, 20, 58, 25837 }, // ŧ
-    { 19, 28, 22, 2, 27, 133, 25895 }, // Ũ
-    { 16, 23, 18, 1, 22, 92, 26028 }, // ũ
-    { 19, 26, 22, 2, 25, 124, 26120 }, // Ū
-    { 16, 21, 18, 1, 20, 84, 26244 }, // ū
-    { 19, 28, 22, 2, 27, 133, 26328 }, // Ŭ
-    { 16, 23, 18, 1, 22, 92, 26461 }, // ŭ
-    { 19, 30, 22, 2, 29, 143, 26553 }, // Ů
-    { 16, 25, 18, 1, 24, 100, 26696 }, // ů
-    { 19, 29, 22, 2, 28, 138, 26796 }, // Ű
-    { 17, 24, 19, 1, 23, 102, 26934 }, // ű
-    { 19, 28, 22, 2, 21, 133, 27036 }, // Ų
-    { 16, 23, 18, 1, 16, 92, 27169 }, // ų
-    { 25, 28, 29, 3, 28, 175, 27261 }, // Ŵ
-    { 22, 23, 24, 1, 23, 127, 27436 }, // ŵ
-    { 16, 28, 19, 2, 28, 112, 27563 }, // Ŷ
-    { 19, 30, 17, -3, 23, 143, 27675 }, // ŷ
-    { 16, 27, 19, 2, 27, 108, 27818 }, // Ÿ
-    { 18, 28, 18, -1, 28, 126, 27926 }, // Ź
-    { 15, 23, 15, -1, 23, 87, 28052 }, // ź
-    { 18, 27, 18, -1, 27, 122, 28139 }, // Ż
-    { 14, 22, 14, -1, 22, 77, 28261 }, // ż
-    { 18, 28, 18, -1, 28, 126, 28338 }, // Ž
-    { 15, 23, 15, -1, 23, 87, 28464 }, // ž
-    { 17, 30, 14, -4, 23, 128, 28551 }, // ſ
-    { 23, 24, 26, 2, 23, 138, 28679 }, // Ơ
-    { 19, 20, 21, 1, 19, 95, 28817 }, // ơ
-    { 27, 23, 30, 2, 22, 156, 28912 }, // Ƣ
-    { 21, 23, 23, 1, 16, 121, 29068 }, // ƣ
-    { 17, 21, 20, 2, 21, 90, 29189 }, // Ƥ
-    { 17, 30, 17, -1, 23, 128, 29279 }, // ƥ
-    { 15, 24, 17, 1, 21, 90, 29407 }, // Ʀ
-    { 16, 23, 17, 0, 22, 92, 29497 }, // Ƨ
-    { 13, 17, 14, 0, 16, 56, 29589 }, // ƨ
-    { 18, 21, 18, -1, 21, 95, 29645 }, // Ʃ
-    { 8, 30, 9, 0, 23, 60, 29740 }, // ƪ
-    { 10, 27, 12, 1, 20, 68, 29800 }, // ƫ
-    { 17, 21, 20, 2, 21, 90, 29868 }, // Ƭ
-    { 11, 24, 13, 1, 23, 66, 29958 }, // ƭ
-    { 16, 28, 19, 2, 21, 112, 30024 }, // Ʈ
-    { 24, 24, 27, 2, 23, 144, 30136 }, // Ư
-    { 21, 20, 23, 1, 19, 105, 30280 }, // ư
-    { 6, 6, 0, -12, 23, 9, 30385 }, // ̀
-    { 7, 6, 1, -7, 23, 11, 30394 }, // ́
-    { 10, 6, 8, -3, 23, 15, 30405 }, // ̂
-    { 12, 5, 0, -13, 22, 15, 30420 }, // ̃
-    { 9, 3, 8, -2, 20, 7, 30435 }, // ̄
-    { 13, 3, 11, -3, 25, 10, 30442 }, // ̅
-    { 9, 5, 8, -2, 22, 12, 30452 }, // ̆
-    { 4, 4, 6, 1, 22, 4, 30464 }, // ̇
-    { 9, 4, 8, -2, 22, 9, 30468 }, // ̈
-    { 6, 7, 0, -9, 24, 11, 30477 }, // ̉
-    { 7, 7, 7, -1, 24, 13, 30488 }, // ̊
-    { 12, 6, 11, -2, 23, 18, 30501 }, // ̋
-    { 10, 6, 9, -2, 23, 15, 30519 }, // ̌
-    { 5, 9, 6, 0, 23, 12, 30534 }, // ̍
-    { 9, 6, 8, -2, 23, 14, 30546 }, // ̎
-    { 11, 6, 0, -15, 23, 17, 30560 }, // ̏
-    { 10, 8, 9, -2, 25, 20, 30577 }, // ̐
-    { 9, 5, 8, -2, 22, 12, 30597 }, // ̑
-    { 6, 8, 6, -1, 21, 12, 30609 }, // ̒
-    { 6, 8, 6, -1, 21, 12, 30621 }, // ̓
-    { 4, 8, 5, 0, 21, 8, 30633 }, // ̔
-    { 6, 8, 6, -1, 21, 12, 30641 }, // ̕
-    { 6, 6, 1, -6, -1, 9, 30653 }, // ̖
-    { 7, 6, 3, -5, -1, 11, 30662 }, // ̗
-    { 6, 7, 2, -5, 0, 11, 30673 }, // ̘
-    { 7, 7, 2, -6, 0, 13, 30684 }, // ̙
-    { 10, 9, 13, 2, 23, 23, 30697 }, // ̚
-    { 8, 7, 7, -2, 23, 14, 30720 }, // ̛
-    { 5, 7, 4, -2, 0, 9, 30734 }, // ̜
-    { 7, 6, 2, -6, -1, 11, 30743 }, // ̝
-    { 8, 6, 3, -6, -1, 12, 30754 }, // ̞
-    { 7, 7, 2, -6, 0, 13, 30766 }, // ̟
-    { 7, 3, 2, -6, -3, 6, 30779 }, // ̠
-    { 7, 9, 2, -6, 2, 16, 30785 }, // ̡
-    { 6, 9, 4, -3, 2, 14, 30801 }, // ̢
-    { 4, 5, 0, -13, -1, 5, 30815 }, // ̣
-    { 9, 4, 3, -7, -2, 9, 30820 }, // ̤
-    { 7, 7, 2, -6, 0, 13, 30829 }, // ̥
-    { 5, 6, 8, 2, -1, 8, 30842 }, // ̦
-    { 6, 7, 2, -5, 0, 11, 30850 }, // ̧
-    { 6, 7, 2, -5, 0, 11, 30861 }, // ̨
-    { 5, 9, 1, -5, 0, 12, 30872 }, // ̩
-    { 12, 6, 5, -8, -1, 18, 30884 }, // ̪
-    { 12, 5, 5, -8, -1, 15, 30902 }, // ̫
-    { 10, 6, 4, -7, 0, 15, 30917 }, // ̬
-    { 10, 6, 4, -7, -1, 15, 30932 }, // ̭
-    { 9, 5, 4, -6, -1, 12, 30947 }, // ̮
-    { 9, 5, 3, -7, -1, 12, 30959 }, // ̯
-    { 11, 5, 4, -8, -1, 14, 30971 }, // ̰
-    { 9, 3, 3, -7, -2, 7, 30985 }, // ̱
-    { 13, 3, 5, -9, -2, 10, 30992 }, // ̲
-    { 14, 7, 6, -9, 0, 25, 31002 }, // ̳
-    { 12, 5, 7, -6, 10, 15, 31027 }, // ̴
-    { 12, 3, 7, -6, 10, 9, 31042 }, // ̵
-    { 20, 3, 11, -10, 10, 15, 31051 }, // ̶
-    { 10, 7, 6, -5, 12, 18, 31066 }, // ̷
-    { 16, 25, 9, -8, 23, 100, 31084 }, // ̸
-    { 5, 8, 4, -2, 1, 10, 31184 }, // ̹
-    { 12, 6, 5, -8, -1, 18, 31194 }, // ̺
-    { 12, 7, 5, -8, 0, 21, 31212 }, // ̻
-    { 12, 5, 5, -8, -1, 15, 31233 }, // ̼
-    { 8, 7, 8, -1, 23, 14, 31248 }, // ̽
-    { 7, 10, 7, -1, 26, 18, 31262 }, // ̾
-    { 14, 7, 12, -3, 29, 25, 31280 }, // ̿
-    { 6, 6, 5, -2, 23, 9, 31305 }, // ̀
-    { 7, 6, 9, 1, 23, 11, 31314 }, // ́
-    { 12, 5, 17, 4, 22, 15, 31325 }, // ͂
-    { 6, 6, 7, 0, 23, 9, 31340 }, // ̓
-    { 11, 6, 9, -3, 23, 17, 31349 }, // ̈́
-    { 5, 5, 2, -4, -2, 7, 31366 }, // ͅ
-    { 14, 6, 11, -4, 23, 21, 31373 }, // ͆
-    { 14, 7, 6, -9, 0, 25, 31394 }, // ͇
-    { 9, 6, 3, -7, 0, 14, 31419 }, // ͈
-    { 7, 6, 3, -5, -1, 11, 31433 }, // ͉
-    { 11, 7, 9, -3, 23, 20, 31444 }, // ͊
-    { 12, 11, 10, -3, 27, 33, 31464 }, // ͋
-    { 12, 8, 10, -3, 25, 24, 31497 }, // ͌
-    { 11, 6, 4, -8, -1, 17, 31521 }, // ͍
-    { 6, 7, 2, -5, 0, 11, 31538 }, // ͎
-    { 22, 21, 12, -11, 21, 116, 31549 }, // ͏
-    { 5, 7, 6, 0, 24, 9, 31665 }, // ͐
-    { 5, 7, 9, 3, 24, 9, 31674 }, // ͑
-    { 9, 8, 8, -2, 25, 18, 31683 }, // ͒
-    { 7, 7, 3, -5, 0, 13, 31701 }, // ͓
-    { 6, 6, 2, -5, -1, 9, 31714 }, // ͔
-    { 6, 6, 3, -4, -1, 9, 31723 }, // ͕
-    { 12, 6, 6, -7, -1, 18, 31732 }, // ͖
-    { 4, 8, 8, 3, 25, 8, 31750 }, // ͗
-    { 4, 4, 6, 1, 22, 4, 31758 }, // ͘
-    { 7, 6, 2, -6, -1, 11, 31762 }, // ͙
-    { 12, 7, 5, -8, 0, 21, 31773 }, // ͚
-    { 6, 6, 7, 0, 23, 9, 31794 }, // ͛
-    { 22, 6, 10, -13, -1, 33, 31803 }, // ͜
-    { 21, 6, 14, -8, 23, 32, 31836 }, // ͝
-    { 15, 3, 11, -5, 20, 12, 31868 }, // ͞
-    { 16, 3, 7, -10, -2, 12, 31880 }, // ͟
-    { 22, 5, 15, -8, 22, 28, 31892 }, // ͠
-    { 21, 6, 14, -8, 25, 32, 31920 }, // ͡
-    { 22, 6, 9, -14, -1, 33, 31952 }, // ͢
-    { 8, 8, 8, -1, 25, 16, 31985 }, // ͣ
-    { 6, 8, 7, 0, 25, 12, 32001 }, // ͤ
-    { 4, 9, 6, 1, 27, 9, 32013 }, // ͥ
-    { 7, 7, 7, -1, 25, 13, 32022 }, // ͦ
-    { 8, 8, 8, -1, 25, 16, 32035 }, // ͧ
-    { 6, 8, 7, 0, 25, 12, 32051 }, // ͨ
-    { 8, 10, 8, -1, 27, 20, 32063 }, // ͩ
-    { 7, 9, 7, -1, 27, 16, 32083 }, // ͪ
-    { 11, 7, 9, -3, 25, 20, 32099 }, // ͫ
-    { 6, 7, 7, 0, 25, 11, 32119 }, // ͬ
-    { 5, 9, 7, 1, 26, 12, 32130 }, // ͭ
-    { 7, 7, 8, 0, 25, 13, 32142 }, // ͮ
-    { 8, 7, 8, -1, 25, 14, 32155 }, // ͯ
-    { 17, 21, 16, -2, 21, 90, 32169 }, // Α
-    { 17, 21, 19, 1, 21, 90, 32259 }, // Β
-    { 16, 21, 18, 1, 21, 84, 32349 }, // Γ
-    { 18, 21, 17, -2, 21, 95, 32433 }, // Δ
-    { 16, 21, 18, 1, 21, 84, 32528 }, // Ε
-    { 18, 21, 18, -1, 21, 95, 32612 }, // Ζ
-    { 19, 21, 21, 1, 21, 100, 32707 }, // Η
-    { 19, 23, 22, 2, 22, 110, 32807 }, // Θ
-    { 13, 21, 13, -1, 21, 69, 32917 }, // Ι
-    { 18, 21, 20, 1, 21, 95, 32986 }, // Κ
-    { 18, 21, 17, -2, 21, 95, 33081 }, // Λ
-    { 24, 21, 26, 1, 21, 126, 33176 }, // Μ
-    { 20, 21, 22, 1, 21, 105, 33302 }, // Ν
-    { 18, 21, 18, -1, 21, 95, 33407 }, // Ξ
-    { 19, 23, 22, 2, 22, 110, 33502 }, // Ο
-    { 20, 21, 22, 1, 21, 105, 33612 }, // Π
-    { 16, 21, 18, 1, 21, 84, 33717 }, // Ρ
-    { 18, 21, 18, -1, 21, 95, 33801 }, // Σ
-    { 16, 21, 19, 2, 21, 84, 33896 }, // Τ
-    { 16, 21, 19, 2, 21, 84, 33980 }, // Υ
-    { 23, 21, 25, 1, 21, 121, 34064 }, // Φ
-    { 20, 21, 19, -2, 21, 105, 34185 }, // Χ
-    { 22, 21, 26, 3, 21, 116, 34290 }, // Ψ
-    { 21, 22, 21, -1, 22, 116, 34406 }, // Ω
-    { 15, 17, 17, 1, 16, 64, 34522 }, // α
-    { 18, 30, 18, -1, 23, 135, 34586 }, // β
-    { 13, 23, 15, 1, 16, 75, 34721 }, // γ
-    { 16, 24, 18, 1, 23, 96, 34796 }, // δ
-    { 13, 17, 14, 0, 16, 56, 34892 }, // ε
-    { 15, 29, 16, 0, 23, 109, 34948 }, // ζ
-    { 16, 24, 17, 0, 17, 96, 35057 }, // η
-    { 15, 24, 17, 1, 23, 90, 35153 }, // θ
-    { 7, 17, 9, 1, 16, 30, 35243 }, // ι
-    { 16, 16, 17, 0, 16, 64, 35273 }, // κ
-    { 16, 24, 15, -2, 23, 96, 35337 }, // λ
-    { 18, 23, 18, -1, 16, 104, 35433 }, // μ
-    { 13, 16, 15, 1, 16, 52, 35537 }, // ν
-    { 16, 29, 17, 0, 23, 116, 35589 }, // ξ
-    { 15, 17, 17, 1, 16, 64, 35705 }, // ο
-    { 18, 17, 20, 1, 16, 77, 35769 }, // π
-    { 16, 23, 16, -1, 16, 92, 35846 }, // ρ
-    { 13, 22, 15, 1, 16, 72, 35938 }, // ς
-    { 17, 17, 19, 1, 16, 73, 36010 }, // σ
-    { 13, 17, 15, 1, 16, 56, 36083 }, // τ
-    { 15, 17, 17, 1, 16, 64, 36139 }, // υ
-    { 18, 23, 20, 1, 16, 104, 36203 }, // φ
-    { 19, 23, 18, -2, 16, 110, 36307 }, // χ
-    { 19, 30, 21, 1, 23, 143, 36417 }, // ψ
-    { 21, 17, 23, 1, 16, 90, 36560 }, // ω
-    { 17, 27, 16, -2, 21, 115, 36650 }, // Ạ
-    { 16, 22, 18, 1, 16, 88, 36765 }, // ạ
-    { 18, 29, 17, -2, 29, 131, 36853 }, // Ả
-    { 16, 25, 18, 1, 24, 100, 36984 }, // ả
-    { 22, 29, 21, -2, 29, 160, 37084 }, // Ấ
-    { 18, 25, 20, 1, 24, 113, 37244 }, // ấ
-    { 18, 29, 17, -2, 29, 131, 37357 }, // Ầ
-    { 16, 25, 18, 1, 24, 100, 37488 }, // ầ
-    { 21, 31, 20, -2, 31, 163, 37588 }, // Ẩ
-    { 17, 27, 19, 1, 26, 115, 37751 }, // ẩ
-    { 20, 31, 19, -2, 31, 155, 37866 }, // Ẫ
-    { 16, 27, 18, 1, 26, 108, 38021 }, // ẫ
-    { 18, 34, 17, -2, 28, 153, 38129 }, // Ậ
-    { 16, 29, 18, 1, 23, 116, 38282 }, // ậ
-    { 19, 30, 18, -2, 30, 143, 38398 }, // Ắ
-    { 16, 26, 18, 1, 25, 104, 38541 }, // ắ
-    { 19, 30, 18, -2, 30, 143, 38645 }, // Ằ
-    { 16, 26, 18, 1, 25, 104, 38788 }, // ằ
-    { 19, 31, 18, -2, 31, 148, 38892 }, // Ẳ
-    { 16, 27, 18, 1, 26, 108, 39040 }, // ẳ
-    { 20, 31, 19, -2, 31, 155, 39148 }, // Ẵ
-    { 16, 27, 18, 1, 26, 108, 39303 }, // ẵ
-    { 19, 33, 18, -2, 27, 157, 39411 }, // Ặ
-    { 16, 28, 18, 1, 22, 112, 39568 }, // ặ
-    { 16, 27, 18, 1, 21, 108, 39680 }, // Ẹ
-    { 13, 22, 15, 1, 16, 72, 39788 }, // ẹ
-    { 16, 29, 18, 1, 29, 116, 39860 }, // Ẻ
-    { 13, 25, 15, 1, 24, 82, 39976 }, // ẻ
-    { 16, 27, 18, 1, 27, 108, 40058 }, // Ẽ
-    { 15, 23, 17, 1, 22, 87, 40166 }, // ẽ
-    { 19, 29, 21, 1, 29, 138, 40253 }, // Ế
-    { 18, 25, 20, 1, 24, 113, 40391 }, // ế
-    { 16, 29, 18, 1, 29, 116, 40504 }, // Ề
-    { 13, 25, 15, 1, 24, 82, 40620 }, // ề
-    { 18, 31, 20, 1, 31, 140, 40702 }, // Ể
-    { 16, 27, 18, 1, 26, 108, 40842 }, // ể
-    { 17, 31, 19, 1, 31, 132, 40950 }, // Ễ
-    { 15, 27, 17, 1, 26, 102, 41082 }, // ễ
-    { 16, 34, 18, 1, 28, 136, 41184 }, // Ệ
-    { 13, 29, 15, 1, 23, 95, 41320 }, // ệ
-    { 13, 29, 13, -1, 29, 95, 41415 }, // Ỉ
-    { 10, 24, 11, 0, 24, 60, 41510 }, // ỉ
-    { 13, 27, 13, -1, 21, 88, 41570 }, // Ị
-    { 9, 28, 9, -1, 22, 63, 41658 }, // ị
-    { 19, 28, 22, 2, 22, 133, 41721 }, // Ọ
-    { 15, 22, 17, 1, 16, 83, 41854 }, // ọ
-    { 19, 30, 22, 2, 29, 143, 41937 }, // Ỏ
-    { 15, 25, 17, 1, 24, 94, 42080 }, // ỏ
-    { 21, 30, 24, 2, 29, 158, 42174 }, // Ố
-    { 18, 25, 20, 1, 24, 113, 42332 }, // ố
-    { 19, 30, 22, 2, 29, 143, 42445 }, // Ồ
-    { 15, 25, 17, 1, 24, 94, 42588 }, // ồ
-    { 20, 32, 23, 2, 31, 160, 42682 }, // Ổ
-    { 17, 27, 19, 1, 26, 115, 42842 }, // ổ
-    { 19, 32, 22, 2, 31, 152, 42957 }, // Ỗ
-    { 16, 27, 18, 1, 26, 108, 43109 }, // ỗ
-    { 19, 34, 22, 2, 28, 162, 43217 }, // Ộ
-    { 15, 29, 17, 1, 23, 109, 43379 }, // ộ
-    { 23, 29, 26, 2, 28, 167, 43488 }, // Ớ
-    { 19, 24, 21, 1, 23, 114, 43655 }, // ớ
-    { 23, 29, 26, 2, 28, 167, 43769 }, // Ờ
-    { 19, 24, 21, 1, 23, 114, 43936 }, // ờ
-    { 23, 30, 26, 2, 29, 173, 44050 }, // Ở
-    { 19, 25, 21, 1, 24, 119, 44223 }, // ở
-    { 23, 28, 26, 2, 27, 161, 44342 }, // Ỡ
-    { 19, 23, 21, 1, 22, 110, 44503 }, // ỡ
-    { 23, 29, 26, 2, 23, 167, 44613 }, // Ợ
-    { 19, 25, 21, 1, 19, 119, 44780 }, // ợ
-    { 19, 27, 22, 2, 21, 129, 44899 }, // Ụ
-    { 16, 22, 18, 1, 16, 88, 45028 }, // ụ
-    { 19, 30, 22, 2, 29, 143, 45116 }, // Ủ
-    { 16, 25, 18, 1, 24, 100, 45259 }, // ủ
-    { 24, 29, 27, 2, 28, 174, 45359 }, // Ứ
-    { 21, 24, 23, 1, 23, 126, 45533 }, // ứ
-    { 24, 29, 27, 2, 28, 174, 45659 }, // Ừ
-    { 21, 24, 23, 1, 23, 126, 45833 }, // ừ
-    { 24, 30, 27, 2, 29, 180, 45959 }, // Ử
-    { 21, 25, 23, 1, 24, 132, 46139 }, // ử
-    { 24, 28, 27, 2, 27, 168, 46271 }, // Ữ
-    { 21, 23, 23, 1, 22, 121, 46439 }, // ữ
-    { 24, 29, 27, 2, 23, 174, 46560 }, // Ự
-    { 21, 25, 23, 1, 19, 132, 46734 }, // ự
-    { 16, 28, 19, 2, 28, 112, 46866 }, // Ỳ
-    { 19, 30, 17, -3, 23, 143, 46978 }, // ỳ
-    { 16, 27, 19, 2, 21, 108, 47121 }, // Ỵ
-    { 19, 23, 17, -3, 16, 110, 47229 }, // ỵ
-    { 16, 29, 19, 2, 29, 116, 47339 }, // Ỷ
-    { 19, 31, 17, -3, 24, 148, 47455 }, // ỷ
-    { 16, 27, 19, 2, 27, 108, 47603 }, // Ỹ
-    { 19, 29, 17, -3, 22, 138, 47711 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 47849 }, //  
-    { 0, 0, 29, 0, 0, 0, 47849 }, //  
-    { 0, 0, 15, 0, 0, 0, 47849 }, //  
-    { 0, 0, 29, 0, 0, 0, 47849 }, //  
-    { 0, 0, 10, 0, 0, 0, 47849 }, //  
-    { 0, 0, 7, 0, 0, 0, 47849 }, //  
-    { 0, 0, 5, 0, 0, 0, 47849 }, //  
-    { 0, 0, 16, 0, 0, 0, 47849 }, //  
-    { 0, 0, 7, 0, 0, 0, 47849 }, //  
-    { 0, 0, 5, 0, 0, 0, 47849 }, //  
-    { 0, 0, 3, 0, 0, 0, 47849 }, //  
-    { 0, 0, 1, 0, 0, 0, 47849 }, // ​
-    { 0, 0, 1, 0, 0, 0, 47849 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 47849 }, // ‍
-    { 8, 25, 8, -1, 21, 50, 47849 }, // ‎
-    { 8, 25, 2, -7, 21, 50, 47899 }, // ‏
-    { 9, 3, 10, 0, 9, 7, 47949 }, // ‐
-    { 9, 3, 10, 0, 9, 7, 47956 }, // ‑
-    { 15, 3, 17, 1, 12, 12, 47963 }, // ‒
-    { 14, 4, 15, 0, 10, 14, 47975 }, // –
-    { 28, 4, 29, 0, 10, 28, 47989 }, // —
-    { 28, 4, 29, 0, 10, 28, 48017 }, // ―
-    { 9, 31, 16, 4, 23, 70, 48045 }, // ‖
-    { 13, 7, 12, -3, 0, 23, 48115 }, // ‗
-    { 7, 8, 9, 1, 21, 14, 48138 }, // ‘
-    { 7, 8, 9, 1, 21, 14, 48152 }, // ’
-    { 7, 8, 7, -2, 4, 14, 48166 }, // ‚
-    { 4, 8, 8, 3, 21, 8, 48180 }, // ‛
-    { 12, 8, 14, 1, 21, 24, 48188 }, // “
-    { 12, 8, 14, 1, 21, 24, 48212 }, // ”
-    { 12, 8, 12, -2, 4, 24, 48236 }, // „
-    { 9, 8, 13, 3, 21, 18, 48260 }, // ‟
-    { 11, 23, 15, 3, 23, 64, 48278 }, // †
-    { 15, 23, 16, 0, 23, 87, 48342 }, // ‡
-    { 8, 8, 11, 2, 15, 16, 48429 }, // •
-    { 10, 10, 12, 1, 16, 25, 48445 }, // ‣
-    { 4, 5, 15, 4, 4, 5, 48470 }, // ․
-    { 12, 5, 15, 0, 4, 15, 48475 }, // ‥
-    { 20, 5, 22, 0, 4, 25, 48490 }, // …
-    { 5, 5, 7, 1, 10, 7, 48515 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 48522 }, //  
-    { 0, 0, 18, 0, 0, 0, 48522 }, //  
-    { 8, 22, 8, -1, 18, 44, 48522 }, // ‪
-    { 8, 22, 2, -7, 18, 44, 48566 }, // ‫
-    { 8, 25, 5, -4, 21, 50, 48610 }, // ‬
-    { 8, 25, 5, -4, 21, 50, 48660 }, // ‭
-    { 8, 25, 5, -4, 21, 50, 48710 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 48760 }, //  
-    { 30, 23, 33, 2, 22, 173, 48760 }, // ‰
-    { 40, 23, 43, 2, 22, 230, 48933 }, // ‱
-    { 8, 8, 10, 1, 21, 16, 49163 }, // ′
-    { 13, 8, 15, 1, 21, 26, 49179 }, // ″
-    { 18, 8, 20, 1, 21, 36, 49205 }, // ‴
-    { 5, 8, 9, 3, 21, 10, 49241 }, // ‵
-    { 10, 8, 14, 3, 21, 20, 49251 }, // ‶
-    { 14, 8, 18, 3, 21, 28, 49271 }, // ‷
-    { 11, 10, 12, -3, 3, 28, 49299 }, // ‸
-    { 8, 13, 10, 1, 14, 26, 49327 }, // ‹
-    { 8, 13, 9, 0, 14, 26, 49353 }, // ›
-    { 22, 23, 24, 1, 22, 127, 49379 }, // ※
-    { 15, 22, 16, 0, 21, 83, 49506 }, // ‼
-    { 12, 23, 15, 2, 22, 69, 49589 }, // ‽
-    { 13, 3, 16, 2, 25, 10, 49658 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 49668 }, // ‿
-    { 16, 7, 19, 2, 24, 28, 49696 }, // ⁀
-    { 14, 19, 12, -3, 12, 67, 49724 }, // ⁁
-    { 31, 27, 33, 0, 23, 210, 49791 }, // ⁂
-    { 8, 3, 9, 0, 9, 6, 50001 }, // ⁃
-    { 18, 21, 12, -7, 21, 95, 50007 }, // ⁄
-    { 12, 26, 12, -1, 21, 78, 50102 }, // ⁅
-    { 12, 26, 10, -3, 21, 78, 50180 }, // ⁆
-    { 24, 23, 27, 2, 22, 138, 50258 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 50396 }, // ⁈
-    { 21, 23, 22, 0, 22, 121, 50506 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 50627 }, // ⁊
-    { 15, 27, 19, 3, 23, 102, 50687 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 50789 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 50849 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 50909 }, // ⁎
-    { 7, 21, 8, 0, 17, 37, 50966 }, // ⁏
-    { 20, 31, 19, -2, 24, 155, 51003 }, // ⁐
-    { 17, 30, 18, 0, 23, 128, 51158 }, // ⁑
-    { 11, 23, 12, 0, 22, 64, 51286 }, // ⁒
-    { 26, 5, 29, 2, 11, 33, 51350 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 51383 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 51411 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 51475 }, // ⁖
-    { 23, 8, 25, 1, 21, 46, 51550 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 51596 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 51723 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 51850 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 51873 }, // ⁛
-    { 22, 23, 24, 1, 22, 127, 51971 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 52098 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 52120 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 52149 }, //  
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 52149 }, // ⁩
-    { 8, 25, 5, -4, 21, 50, 52149 }, // ⁪
-    { 8, 25, 5, -4, 21, 50, 52199 }, // ⁫
-    { 8, 25, 5, -4, 21, 50, 52249 }, // ⁬
-    { 8, 25, 5, -4, 21, 50, 52299 }, // ⁭
-    { 8, 25, 5, -4, 21, 50, 52349 }, // ⁮
-    { 8, 25, 5, -4, 21, 50, 52399 }, // ⁯
-    { 10, 14, 13, 2, 25, 35, 52449 }, // ⁰
-    { 5, 14, 8, 2, 22, 18, 52484 }, // ⁱ
-    { 10, 13, 13, 2, 25, 33, 52502 }, // ⁴
-    { 10, 14, 13, 2, 25, 35, 52535 }, // ⁵
-    { 10, 14, 14, 3, 25, 35, 52570 }, // ⁶
-    { 10, 13, 14, 3, 25, 33, 52605 }, // ⁷
-    { 10, 14, 13, 2, 25, 35, 52638 }, // ⁸
-    { 10, 14, 13, 2, 25, 35, 52673 }, // ⁹
-    { 8, 9, 12, 3, 22, 18, 52708 }, // ⁺
-    { 8, 3, 12, 3, 19, 6, 52726 }, // ⁻
-    { 8, 6, 12, 3, 21, 12, 52732 }, // ⁼
-    { 7, 17, 11, 3, 27, 30, 52744 }, // ⁽
-    { 7, 17, 8, 0, 27, 30, 52774 }, // ⁾
-    { 10, 10, 13, 2, 18, 25, 52804 }, // ⁿ
-    { 10, 14, 10, -1, 9, 35, 52829 }, // ₀
-    { 7, 13, 10, 0, 9, 23, 52864 }, // ₁
-    { 11, 13, 10, -2, 9, 36, 52887 }, // ₂
-    { 11, 14, 10, -2, 9, 39, 52923 }, // ₃
-    { 10, 13, 10, -1, 9, 33, 52962 }, // ₄
-    { 10, 14, 10, -1, 9, 35, 52995 }, // ₅
-    { 10, 14, 10, -1, 9, 35, 53030 }, // ₆
-    { 11, 13, 11, -1, 9, 36, 53065 }, // ₇
-    { 10, 14, 10, -1, 9, 35, 53101 }, // ₈
-    { 10, 14, 10, -1, 9, 35, 53136 }, // ₉
-    { 9, 9, 10, -1, 6, 21, 53171 }, // ₊
-    { 9, 3, 10, -1, 4, 7, 53192 }, // ₋
-    { 9, 6, 10, -1, 5, 14, 53199 }, // ₌
-    { 7, 17, 8, 0, 11, 30, 53213 }, // ₍
-    { 8, 17, 5, -4, 11, 34, 53243 }, // ₎
-    { 10, 10, 11, -1, 7, 25, 53277 }, // ₐ
-    { 9, 10, 9, -1, 7, 23, 53302 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 53325 }, // ₒ
-    { 12, 10, 10, -3, 7, 30, 53350 }, // ₓ
-    { 9, 10, 9, -2, 7, 23, 53380 }, // ₔ
-    { 10, 14, 13, 0, 11, 35, 53403 }, // ₕ
-    { 10, 14, 11, 0, 11, 35, 53438 }, // ₖ
-    { 5, 14, 7, 0, 11, 18, 53473 }, // ₗ
-    { 16, 10, 18, 0, 7, 40, 53491 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 53531 }, // ₙ
-    { 11, 14, 11, -2, 7, 39, 53559 }, // ₚ
-    { 8, 10, 9, -1, 7, 20, 53598 }, // ₛ
-    { 7, 12, 7, -1, 9, 21, 53618 }, // ₜ
-    { 15, 22, 18, 2, 22, 83, 53639 }, // ₠
-    { 17, 25, 19, 1, 23, 107, 53722 }, // ₡
-    { 16, 23, 18, 1, 22, 92, 53829 }, // ₢
-    { 17, 21, 18, 0, 21, 90, 53921 }, // ₣
-    { 18, 22, 18, -1, 22, 99, 54011 }, // ₤
-    { 24, 24, 26, 0, 20, 144, 54110 }, // ₥
-    { 17, 21, 18, 0, 21, 90, 54254 }, // ₦
-    { 21, 22, 22, 0, 21, 116, 54344 }, // ₧
-    { 24, 22, 25, 0, 21, 132, 54460 }, // ₨
-    { 21, 21, 22, 0, 21, 111, 54592 }, // ₩
-    { 24, 21, 25, 0, 21, 126, 54703 }, // ₪
-    { 19, 28, 20, 0, 23, 133, 54829 }, // ₫
-    { 18, 23, 19, 0, 22, 104, 54962 }, // €
-    { 19, 21, 20, 0, 21, 100, 55066 }, // ₭
-    { 17, 21, 19, 1, 21, 90, 55166 }, // ₮
-    { 28, 29, 29, 0, 22, 203, 55256 }, // ₯
-    { 19, 29, 18, -2, 22, 138, 55459 }, // ₰
-    { 17, 21, 19, 1, 21, 90, 55597 }, // ₱
-    { 18, 26, 21, 2, 23, 117, 55687 }, // ₲
-    { 20, 21, 19, -2, 21, 105, 55804 }, // ₳
-    { 18, 23, 18, -1, 22, 104, 55909 }, // ₴
-    { 17, 26, 20, 2, 23, 111, 56013 }, // ₵
-    { 18, 21, 19, 0, 20, 95, 56124 }, // ₶
-    { 21, 25, 21, -1, 22, 132, 56219 }, // ₷
-    { 16, 21, 18, 1, 21, 84, 56351 }, // ₸
-    { 15, 21, 18, 2, 21, 79, 56435 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 56514 }, // ₺
-    { 19, 23, 21, 1, 22, 110, 56602 }, // ₻
-    { 22, 21, 22, -1, 21, 116, 56712 }, // ₼
-    { 19, 21, 19, -1, 21, 100, 56828 }, // ₽
-    { 20, 24, 20, -1, 24, 120, 56928 }, // ₾
-    { 16, 27, 18, 1, 24, 108, 57048 }, // ₿
-    { 9, 3, 10, 0, 9, 7, 57156 }, // −
-    { 27, 28, 29, 1, 23, 189, 57163 }, // �
+    { 9, 22, 10, 0, 21, 32, 0 }, // !
+    { 10, 8, 14, 3, 21, 27, 32 }, // "
+    { 20, 21, 21, 0, 21, 80, 59 }, // #
+    { 16, 25, 17, 0, 23, 71, 139 }, // $
+    { 21, 23, 24, 2, 22, 105, 210 }, // %
+    { 19, 23, 20, 0, 22, 79, 315 }, // &
+    { 4, 8, 8, 3, 21, 14, 394 }, // '
+    { 10, 26, 12, 1, 21, 40, 408 }, // (
+    { 11, 26, 9, -3, 21, 41, 448 }, // )
+    { 14, 15, 18, 3, 23, 40, 489 }, // *
+    { 14, 15, 17, 2, 18, 30, 529 }, // +
+    { 7, 8, 7, -2, 4, 13, 559 }, // ,
+    { 9, 3, 10, 0, 9, 8, 572 }, // -
+    { 5, 5, 7, 0, 4, 8, 580 }, // .
+    { 15, 21, 14, -2, 21, 44, 588 }, // /
+    { 15, 23, 17, 1, 22, 65, 632 }, // 0
+    { 9, 21, 16, 4, 21, 37, 697 }, // 1
+    { 16, 22, 17, 0, 22, 56, 734 }, // 2
+    { 16, 23, 17, 0, 22, 57, 790 }, // 3
+    { 16, 21, 17, 0, 21, 63, 847 }, // 4
+    { 15, 22, 17, 1, 21, 57, 910 }, // 5
+    { 15, 23, 17, 1, 22, 60, 967 }, // 6
+    { 15, 21, 18, 2, 21, 49, 1027 }, // 7
+    { 15, 23, 17, 1, 22, 66, 1076 }, // 8
+    { 15, 23, 17, 1, 22, 61, 1142 }, // 9
+    { 7, 18, 8, 0, 17, 19, 1203 }, // :
+    { 9, 21, 8, -2, 17, 25, 1222 }, // ;
+    { 14, 15, 17, 2, 18, 33, 1247 }, // <
+    { 14, 9, 17, 2, 15, 26, 1280 }, // =
+    { 14, 15, 17, 2, 18, 32, 1306 }, // >
+    { 12, 23, 15, 2, 22, 44, 1338 }, // ?
+    { 23, 24, 25, 1, 21, 117, 1382 }, // @
+    { 17, 21, 16, -2, 21, 63, 1499 }, // A
+    { 17, 21, 19, 1, 21, 67, 1562 }, // B
+    { 17, 23, 20, 2, 22, 52, 1629 }, // C
+    { 18, 21, 20, 1, 21, 74, 1681 }, // D
+    { 16, 21, 18, 1, 21, 56, 1755 }, // E
+    { 16, 21, 18, 1, 21, 50, 1811 }, // F
+    { 18, 23, 21, 2, 22, 67, 1861 }, // G
+    { 19, 21, 21, 1, 21, 75, 1928 }, // H
+    { 13, 21, 13, -1, 21, 43, 2003 }, // I
+    { 14, 27, 10, -5, 21, 58, 2046 }, // J
+    { 18, 21, 20, 1, 21, 70, 2104 }, // K
+    { 12, 21, 14, 1, 21, 45, 2174 }, // L
+    { 24, 21, 26, 1, 21, 111, 2219 }, // M
+    { 20, 21, 22, 1, 21, 86, 2330 }, // N
+    { 19, 23, 22, 2, 22, 75, 2416 }, // O
+    { 16, 21, 18, 1, 21, 59, 2491 }, // P
+    { 19, 27, 22, 2, 22, 82, 2550 }, // Q
+    { 16, 21, 18, 1, 21, 66, 2632 }, // R
+    { 16, 23, 17, 0, 22, 52, 2698 }, // S
+    { 16, 21, 19, 2, 21, 48, 2750 }, // T
+    { 19, 22, 22, 2, 21, 75, 2798 }, // U
+    { 17, 21, 20, 2, 21, 63, 2873 }, // V
+    { 25, 21, 29, 3, 21, 103, 2936 }, // W
+    { 20, 21, 19, -2, 21, 65, 3039 }, // X
+    { 16, 21, 19, 2, 21, 53, 3104 }, // Y
+    { 18, 21, 18, -1, 21, 54, 3157 }, // Z
+    { 12, 26, 12, -1, 21, 54, 3211 }, // [
+    { 6, 21, 10, 3, 21, 32, 3265 }, // <backslash>
+    { 12, 26, 10, -3, 21, 54, 3297 }, // ]
+    { 15, 14, 17, 1, 21, 38, 3351 }, // ^
+    { 13, 3, 12, -3, -2, 16, 3389 }, // _
+    { 6, 6, 11, 4, 23, 9, 3405 }, // `
+    { 16, 17, 18, 1, 16, 55, 3414 }, // a
+    { 16, 24, 17, 0, 23, 68, 3469 }, // b
+    { 13, 17, 15, 1, 16, 38, 3537 }, // c
+    { 17, 24, 19, 1, 23, 69, 3575 }, // d
+    { 13, 17, 15, 1, 16, 47, 3644 }, // e
+    { 17, 30, 14, -4, 23, 68, 3691 }, // f
+    { 17, 23, 18, 0, 16, 71, 3759 }, // g
+    { 16, 23, 17, 0, 23, 65, 3830 }, // h
+    { 8, 22, 9, 0, 22, 31, 3895 }, // i
+    { 12, 29, 9, -4, 22, 52, 3926 }, // j
+    { 16, 23, 17, 0, 23, 62, 3978 }, // k
+    { 9, 23, 10, 0, 23, 35, 4040 }, // l
+    { 24, 16, 26, 0, 16, 77, 4075 }, // m
+    { 16, 17, 17, 0, 17, 52, 4152 }, // n
+    { 15, 17, 17, 1, 16, 50, 4204 }, // o
+    { 17, 23, 17, -1, 16, 69, 4254 }, // p
+    { 16, 23, 18, 1, 16, 67, 4323 }, // q
+    { 13, 16, 14, 0, 16, 36, 4390 }, // r
+    { 13, 17, 14, 0, 16, 40, 4426 }, // s
+    { 10, 21, 12, 1, 20, 37, 4466 }, // t
+    { 16, 17, 18, 1, 16, 56, 4503 }, // u
+    { 15, 16, 17, 1, 16, 47, 4559 }, // v
+    { 22, 16, 24, 1, 16, 85, 4606 }, // w
+    { 17, 16, 16, -2, 16, 48, 4691 }, // x
+    { 19, 23, 17, -3, 16, 66, 4739 }, // y
+    { 14, 16, 14, -1, 16, 40, 4805 }, // z
+    { 12, 26, 13, 0, 21, 54, 4845 }, // {
+    { 3, 31, 16, 7, 23, 45, 4899 }, // |
+    { 13, 26, 12, -2, 21, 52, 4944 }, // }
+    { 14, 5, 17, 2, 13, 14, 4996 }, // ~
+    { 0, 0, 8, 0, 0, 0, 5010 }, //  
+    { 9, 22, 9, -1, 16, 32, 5010 }, // ¡
+    { 13, 23, 17, 3, 22, 49, 5042 }, // ¢
+    { 18, 22, 18, -1, 22, 55, 5091 }, // £
+    { 13, 13, 16, 2, 17, 44, 5146 }, // ¤
+    { 17, 21, 19, 1, 21, 64, 5190 }, // ¥
+    { 3, 31, 16, 7, 23, 36, 5254 }, // ¦
+    { 15, 24, 16, 0, 23, 58, 5290 }, // §
+    { 9, 4, 16, 6, 22, 10, 5348 }, // ¨
+    { 22, 23, 24, 1, 22, 99, 5358 }, // ©
+    { 10, 11, 13, 2, 22, 34, 5457 }, // ª
+    { 13, 13, 15, 1, 14, 39, 5491 }, // «
+    { 14, 9, 17, 2, 12, 24, 5530 }, // ¬
+    { 9, 3, 10, 0, 9, 8, 5554 }, // ­
+    { 22, 23, 24, 1, 22, 107, 5562 }, // ®
+    { 13, 3, 16, 2, 25, 6, 5669 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 5675 }, // °
+    { 14, 18, 17, 2, 18, 39, 5700 }, // ±
+    { 10, 13, 13, 2, 25, 26, 5739 }, // ²
+    { 10, 14, 13, 2, 25, 29, 5765 }, // ³
+    { 7, 6, 11, 3, 23, 9, 5794 }, // ´
+    { 18, 23, 18, -1, 16, 67, 5803 }, // µ
+    { 16, 27, 19, 2, 23, 97, 5870 }, // ¶
+    { 5, 5, 8, 2, 13, 9, 5967 }, // ·
+    { 7, 7, 6, -3, 0, 13, 5976 }, // ¸
+    { 7, 13, 12, 4, 25, 22, 5989 }, // ¹
+    { 9, 11, 12, 2, 22, 28, 6011 }, // º
+    { 13, 13, 14, 0, 14, 37, 6039 }, // »
+    { 19, 21, 22, 2, 21, 82, 6076 }, // ¼
+    { 21, 21, 24, 2, 21, 78, 6158 }, // ½
+    { 22, 21, 24, 1, 21, 95, 6236 }, // ¾
+    { 12, 22, 13, -1, 16, 43, 6331 }, // ¿
+    { 17, 28, 16, -2, 28, 76, 6374 }, // À
+    { 19, 28, 18, -2, 28, 80, 6450 }, // Á
+    { 18, 28, 17, -2, 28, 82, 6530 }, // Â
+    { 20, 27, 19, -2, 27, 86, 6612 }, // Ã
+    { 18, 27, 17, -2, 27, 80, 6698 }, // Ä
+    { 17, 29, 16, -2, 29, 85, 6778 }, // Å
+    { 28, 21, 27, -2, 21, 93, 6863 }, // Æ
+    { 17, 29, 20, 2, 22, 67, 6956 }, // Ç
+    { 16, 28, 18, 1, 28, 69, 7023 }, // È
+    { 16, 28, 18, 1, 28, 71, 7092 }, // É
+    { 16, 28, 18, 1, 28, 71, 7163 }, // Ê
+    { 16, 27, 18, 1, 27, 69, 7234 }, // Ë
+    { 13, 28, 13, -1, 28, 56, 7303 }, // Ì
+    { 14, 28, 14, -1, 28, 55, 7359 }, // Í
+    { 14, 28, 14, -1, 28, 60, 7414 }, // Î
+    { 14, 27, 14, -1, 27, 55, 7474 }, // Ï
+    { 19, 21, 20, 0, 21, 78, 7529 }, // Ð
+    { 20, 27, 22, 1, 27, 103, 7607 }, // Ñ
+    { 19, 29, 22, 2, 28, 88, 7710 }, // Ò
+    { 19, 29, 22, 2, 28, 86, 7798 }, // Ó
+    { 19, 29, 22, 2, 28, 93, 7884 }, // Ô
+    { 19, 28, 22, 2, 27, 90, 7977 }, // Õ
+    { 19, 28, 22, 2, 27, 86, 8067 }, // Ö
+    { 14, 14, 17, 2, 17, 36, 8153 }, // ×
+    { 20, 24, 22, 1, 22, 88, 8189 }, // Ø
+    { 19, 29, 22, 2, 28, 90, 8277 }, // Ù
+    { 19, 29, 22, 2, 28, 89, 8367 }, // Ú
+    { 19, 29, 22, 2, 28, 93, 8456 }, // Û
+    { 19, 28, 22, 2, 27, 89, 8549 }, // Ü
+    { 16, 28, 19, 2, 28, 66, 8638 }, // Ý
+    { 15, 21, 17, 1, 21, 55, 8704 }, // Þ
+    { 21, 30, 18, -4, 23, 96, 8759 }, // ß
+    { 16, 24, 18, 1, 23, 68, 8855 }, // à
+    { 16, 24, 18, 1, 23, 69, 8923 }, // á
+    { 16, 24, 18, 1, 23, 71, 8992 }, // â
+    { 16, 23, 18, 1, 22, 72, 9063 }, // ã
+    { 16, 23, 18, 1, 22, 69, 9135 }, // ä
+    { 16, 25, 18, 1, 24, 76, 9204 }, // å
+    { 23, 17, 25, 1, 16, 80, 9280 }, // æ
+    { 13, 23, 15, 1, 16, 51, 9360 }, // ç
+    { 13, 24, 15, 1, 23, 59, 9411 }, // è
+    { 14, 24, 16, 1, 23, 61, 9470 }, // é
+    { 13, 24, 15, 1, 23, 63, 9531 }, // ê
+    { 13, 23, 15, 1, 22, 59, 9594 }, // ë
+    { 8, 23, 9, 0, 23, 34, 9653 }, // ì
+    { 11, 23, 12, 0, 23, 35, 9687 }, // í
+    { 11, 23, 12, 0, 23, 39, 9722 }, // î
+    { 11, 22, 12, 0, 22, 36, 9761 }, // ï
+    { 16, 24, 18, 1, 23, 68, 9797 }, // ð
+    { 17, 22, 18, 0, 22, 65, 9865 }, // ñ
+    { 15, 24, 17, 1, 23, 62, 9930 }, // ò
+    { 15, 24, 17, 1, 23, 63, 9992 }, // ó
+    { 15, 24, 17, 1, 23, 65, 10055 }, // ô
+    { 15, 23, 17, 1, 22, 63, 10120 }, // õ
+    { 15, 23, 17, 1, 22, 62, 10183 }, // ö
+    { 14, 14, 17, 2, 17, 33, 10245 }, // ÷
+    { 16, 19, 17, 0, 17, 66, 10278 }, // ø
+    { 16, 24, 18, 1, 23, 68, 10344 }, // ù
+    { 16, 24, 18, 1, 23, 70, 10412 }, // ú
+    { 16, 24, 18, 1, 23, 73, 10482 }, // û
+    { 16, 23, 18, 1, 22, 69, 10555 }, // ü
+    { 19, 30, 17, -3, 23, 80, 10624 }, // ý
+    { 17, 30, 17, -1, 23, 82, 10704 }, // þ
+    { 19, 29, 17, -3, 22, 81, 10786 }, // ÿ
+    { 18, 25, 17, -2, 25, 76, 10867 }, // Ā
+    { 16, 21, 18, 1, 20, 64, 10943 }, // ā
+    { 19, 27, 18, -2, 27, 81, 11007 }, // Ă
+    { 16, 23, 18, 1, 22, 69, 11088 }, // ă
+    { 17, 28, 16, -2, 21, 80, 11157 }, // Ą
+    { 16, 23, 18, 1, 16, 67, 11237 }, // ą
+    { 17, 29, 20, 2, 28, 66, 11304 }, // Ć
+    { 14, 24, 16, 1, 23, 53, 11370 }, // ć
+    { 17, 29, 20, 2, 28, 68, 11423 }, // Ĉ
+    { 13, 24, 15, 1, 23, 53, 11491 }, // ĉ
+    { 17, 28, 20, 2, 27, 62, 11544 }, // Ċ
+    { 13, 23, 15, 1, 22, 48, 11606 }, // ċ
+    { 17, 29, 20, 2, 28, 67, 11654 }, // Č
+    { 14, 24, 16, 1, 23, 53, 11721 }, // č
+    { 18, 28, 20, 1, 28, 92, 11774 }, // Ď
+    { 22, 24, 24, 1, 23, 84, 11866 }, // ď
+    { 19, 21, 20, 0, 21, 78, 11950 }, // Đ
+    { 18, 24, 20, 1, 23, 75, 12028 }, // đ
+    { 16, 25, 18, 1, 25, 66, 12103 }, // Ē
+    { 13, 21, 15, 1, 20, 57, 12169 }, // ē
+    { 16, 27, 18, 1, 27, 71, 12226 }, // Ĕ
+    { 14, 23, 16, 1, 22, 59, 12297 }, // ĕ
+    { 16, 27, 18, 1, 27, 66, 12356 }, // Ė
+    { 13, 23, 15, 1, 22, 58, 12422 }, // ė
+    { 16, 28, 18, 1, 21, 72, 12480 }, // Ę
+    { 13, 23, 15, 1, 16, 59, 12552 }, // ę
+    { 16, 28, 18, 1, 28, 72, 12611 }, // Ě
+    { 14, 24, 16, 1, 23, 64, 12683 }, // ě
+    { 18, 29, 21, 2, 28, 84, 12747 }, // Ĝ
+    { 17, 30, 18, 0, 23, 88, 12831 }, // ĝ
+    { 18, 28, 21, 2, 27, 81, 12919 }, // Ğ
+    { 17, 29, 18, 0, 22, 86, 13000 }, // ğ
+    { 18, 28, 21, 2, 27, 75, 13086 }, // Ġ
+    { 17, 29, 18, 0, 22, 81, 13161 }, // ġ
+    { 18, 29, 21, 2, 22, 78, 13242 }, // Ģ
+    { 17, 30, 18, 0, 23, 84, 13320 }, // ģ
+    { 19, 28, 21, 1, 28, 92, 13404 }, // Ĥ
+    { 16, 30, 17, 0, 30, 80, 13496 }, // ĥ
+    { 21, 21, 23, 1, 21, 81, 13576 }, // Ħ
+    { 16, 23, 17, 0, 23, 70, 13657 }, // ħ
+    { 15, 27, 15, -1, 27, 59, 13727 }, // Ĩ
+    { 12, 22, 13, 0, 22, 44, 13786 }, // ĩ
+    { 14, 25, 14, -1, 25, 53, 13830 }, // Ī
+    { 11, 20, 12, 0, 20, 34, 13883 }, // ī
+    { 14, 27, 14, -1, 27, 58, 13917 }, // Ĭ
+    { 11, 22, 12, 0, 22, 38, 13975 }, // ĭ
+    { 13, 28, 13, -1, 21, 59, 14013 }, // Į
+    { 9, 29, 9, -1, 22, 42, 14072 }, // į
+    { 13, 27, 13, -1, 27, 53, 14114 }, // İ
+    { 7, 16, 8, 0, 16, 25, 14167 }, // ı
+    { 19, 27, 19, -1, 21, 81, 14192 }, // Ĳ
+    { 16, 29, 17, 0, 22, 79, 14273 }, // ĳ
+    { 17, 34, 13, -5, 28, 75, 14352 }, // Ĵ
+    { 15, 30, 12, -4, 23, 64, 14427 }, // ĵ
+    { 18, 28, 20, 1, 21, 82, 14491 }, // Ķ
+    { 16, 30, 17, 0, 23, 74, 14573 }, // ķ
+    { 16, 16, 17, 0, 16, 49, 14647 }, // ĸ
+    { 12, 28, 14, 1, 28, 55, 14696 }, // Ĺ
+    { 12, 30, 13, 0, 30, 55, 14751 }, // ĺ
+    { 12, 28, 14, 1, 21, 55, 14806 }, // Ļ
+    { 11, 30, 10, -2, 23, 45, 14861 }, // ļ
+    { 15, 21, 17, 1, 21, 52, 14906 }, // Ľ
+    { 13, 23, 14, 0, 23, 51, 14958 }, // ľ
+    { 12, 21, 14, 1, 21, 48, 15009 }, // Ŀ
+    { 11, 23, 12, 0, 23, 41, 15057 }, // ŀ
+    { 13, 21, 14, 0, 21, 49, 15098 }, // Ł
+    { 9, 23, 10, 0, 23, 37, 15147 }, // ł
+    { 20, 28, 22, 1, 28, 100, 15184 }, // Ń
+    { 16, 23, 17, 0, 23, 65, 15284 }, // ń
+    { 20, 28, 22, 1, 21, 100, 15349 }, // Ņ
+    { 16, 24, 17, 0, 17, 64, 15449 }, // ņ
+    { 20, 28, 22, 1, 28, 105, 15513 }, // Ň
+    { 16, 23, 17, 0, 23, 68, 15618 }, // ň
+    { 17, 21, 19, 1, 21, 66, 15686 }, // ŉ
+    { 20, 27, 22, 1, 21, 101, 15752 }, // Ŋ
+    { 16, 23, 17, 0, 16, 67, 15853 }, // ŋ
+    { 19, 26, 22, 2, 25, 84, 15920 }, // Ō
+    { 15, 21, 17, 1, 20, 59, 16004 }, // ō
+    { 19, 28, 22, 2, 27, 87, 16063 }, // Ŏ
+    { 15, 23, 17, 1, 22, 64, 16150 }, // ŏ
+    { 20, 29, 23, 2, 28, 97, 16214 }, // Ő
+    { 17, 24, 19, 1, 23, 73, 16311 }, // ő
+    { 25, 23, 28, 2, 22, 89, 16384 }, // Œ
+    { 24, 17, 26, 1, 16, 77, 16473 }, // œ
+    { 16, 28, 18, 1, 28, 81, 16550 }, // Ŕ
+    { 14, 23, 15, 0, 23, 49, 16631 }, // ŕ
+    { 16, 28, 18, 1, 21, 78, 16680 }, // Ŗ
+    { 14, 23, 14, -1, 16, 48, 16758 }, // ŗ
+    { 16, 28, 18, 1, 28, 83, 16806 }, // Ř
+    { 15, 23, 16, 0, 23, 54, 16889 }, // ř
+    { 16, 29, 17, 0, 28, 65, 16943 }, // Ś
+    { 13, 24, 14, 0, 23, 53, 17008 }, // ś
+    { 16, 29, 17, 0, 28, 67, 17061 }, // Ŝ
+    { 13, 24, 14, 0, 23, 54, 17128 }, // ŝ
+    { 16, 29, 17, 0, 22, 68, 17182 }, // Ş
+    { 13, 23, 14, 0, 16, 55, 17250 }, // ş
+    { 16, 29, 17, 0, 28, 66, 17305 }, // Š
+    { 14, 24, 15, 0, 23, 56, 17371 }, // š
+    { 16, 28, 19, 2, 21, 65, 17427 }, // Ţ
+    { 11, 27, 12, 0, 20, 48, 17492 }, // ţ
+    { 16, 28, 19, 2, 28, 64, 17540 }, // Ť
+    { 12, 24, 14, 1, 23, 51, 17604 }, // ť
+    { 16, 21, 19, 2, 21, 54, 17655 }, // Ŧ
+    { 11, 21, 12, 0, 20, 38, 17709 }, // ŧ
+    { 19, 28, 22, 2, 27, 93, 17747 }, // Ũ
+    { 16, 23, 18, 1, 22, 70, 17840 }, // ũ
+    { 19, 26, 22, 2, 25, 85, 17910 }, // Ū
+    { 16, 21, 18, 1, 20, 65, 17995 }, // ū
+    { 19, 28, 22, 2, 27, 91, 18060 }, // Ŭ
+    { 16, 23, 18, 1, 22, 68, 18151 }, // ŭ
+    { 19, 30, 22, 2, 29, 97, 18219 }, // Ů
+    { 16, 25, 18, 1, 24, 77, 18316 }, // ů
+    { 19, 29, 22, 2, 28, 94, 18393 }, // Ű
+    { 17, 24, 19, 1, 23, 79, 18487 }, // ű
+    { 19, 28, 22, 2, 21, 88, 18566 }, // Ų
+    { 16, 23, 18, 1, 16, 68, 18654 }, // ų
+    { 25, 28, 29, 3, 28, 125, 18722 }, // Ŵ
+    { 22, 23, 24, 1, 23, 104, 18847 }, // ŵ
+    { 16, 28, 19, 2, 28, 71, 18951 }, // Ŷ
+    { 19, 30, 17, -3, 23, 83, 19022 }, // ŷ
+    { 16, 27, 19, 2, 27, 65, 19105 }, // Ÿ
+    { 18, 28, 18, -1, 28, 67, 19170 }, // Ź
+    { 15, 23, 15, -1, 23, 54, 19237 }, // ź
+    { 18, 27, 18, -1, 27, 64, 19291 }, // Ż
+    { 14, 22, 14, -1, 22, 51, 19355 }, // ż
+    { 18, 28, 18, -1, 28, 73, 19406 }, // Ž
+    { 15, 23, 15, -1, 23, 56, 19479 }, // ž
+    { 17, 30, 14, -4, 23, 63, 19535 }, // ſ
+    { 23, 24, 26, 2, 23, 83, 19598 }, // Ơ
+    { 19, 20, 21, 1, 19, 61, 19681 }, // ơ
+    { 27, 23, 30, 2, 22, 111, 19742 }, // Ƣ
+    { 21, 23, 23, 1, 16, 92, 19853 }, // ƣ
+    { 17, 21, 20, 2, 21, 66, 19945 }, // Ƥ
+    { 17, 30, 17, -1, 23, 85, 20011 }, // ƥ
+    { 15, 24, 17, 1, 21, 68, 20096 }, // Ʀ
+    { 16, 23, 17, 0, 22, 55, 20164 }, // Ƨ
+    { 13, 17, 14, 0, 16, 40, 20219 }, // ƨ
+    { 18, 21, 18, -1, 21, 54, 20259 }, // Ʃ
+    { 8, 30, 9, 0, 23, 52, 20313 }, // ƪ
+    { 10, 27, 12, 1, 20, 47, 20365 }, // ƫ
+    { 17, 21, 20, 2, 21, 54, 20412 }, // Ƭ
+    { 11, 24, 13, 1, 23, 44, 20466 }, // ƭ
+    { 16, 28, 19, 2, 21, 62, 20510 }, // Ʈ
+    { 24, 24, 27, 2, 23, 91, 20572 }, // Ư
+    { 21, 20, 23, 1, 19, 68, 20663 }, // ư
+    { 6, 6, 0, -12, 23, 9, 20731 }, // ̀
+    { 7, 6, 1, -7, 23, 9, 20740 }, // ́
+    { 10, 6, 8, -3, 23, 14, 20749 }, // ̂
+    { 12, 5, 0, -13, 22, 13, 20763 }, // ̃
+    { 9, 3, 8, -2, 20, 8, 20776 }, // ̄
+    { 13, 3, 11, -3, 25, 15, 20784 }, // ̅
+    { 9, 5, 8, -2, 22, 12, 20799 }, // ̆
+    { 4, 4, 6, 1, 22, 7, 20811 }, // ̇
+    { 9, 4, 8, -2, 22, 10, 20818 }, // ̈
+    { 6, 7, 0, -9, 24, 13, 20828 }, // ̉
+    { 7, 7, 7, -1, 24, 17, 20841 }, // ̊
+    { 12, 6, 11, -2, 23, 20, 20858 }, // ̋
+    { 10, 6, 9, -2, 23, 13, 20878 }, // ̌
+    { 5, 9, 6, 0, 23, 12, 20891 }, // ̍
+    { 9, 6, 8, -2, 23, 17, 20903 }, // ̎
+    { 11, 6, 0, -15, 23, 18, 20920 }, // ̏
+    { 10, 8, 9, -2, 25, 18, 20938 }, // ̐
+    { 9, 5, 8, -2, 22, 14, 20956 }, // ̑
+    { 6, 8, 6, -1, 21, 14, 20970 }, // ̒
+    { 6, 8, 6, -1, 21, 13, 20984 }, // ̓
+    { 4, 8, 5, 0, 21, 13, 20997 }, // ̔
+    { 6, 8, 6, -1, 21, 13, 21010 }, // ̕
+    { 6, 6, 1, -6, -1, 9, 21023 }, // ̖
+    { 7, 6, 3, -5, -1, 11, 21032 }, // ̗
+    { 6, 7, 2, -5, 0, 11, 21043 }, // ̘
+    { 7, 7, 2, -6, 0, 12, 21054 }, // ̙
+    { 10, 9, 13, 2, 23, 16, 21066 }, // ̚
+    { 8, 7, 7, -2, 23, 10, 21082 }, // ̛
+    { 5, 7, 4, -2, 0, 11, 21092 }, // ̜
+    { 7, 6, 2, -6, -1, 9, 21103 }, // ̝
+    { 8, 6, 3, -6, -1, 12, 21112 }, // ̞
+    { 7, 7, 2, -6, 0, 12, 21124 }, // ̟
+    { 7, 3, 2, -6, -3, 6, 21136 }, // ̠
+    { 7, 9, 2, -6, 2, 16, 21142 }, // ̡
+    { 6, 9, 4, -3, 2, 14, 21158 }, // ̢
+    { 4, 5, 0, -13, -1, 5, 21172 }, // ̣
+    { 9, 4, 3, -7, -2, 12, 21177 }, // ̤
+    { 7, 7, 2, -6, 0, 16, 21189 }, // ̥
+    { 5, 6, 8, 2, -1, 8, 21205 }, // ̦
+    { 6, 7, 2, -5, 0, 12, 21213 }, // ̧
+    { 6, 7, 2, -5, 0, 9, 21225 }, // ̨
+    { 5, 9, 1, -5, 0, 14, 21234 }, // ̩
+    { 12, 6, 5, -8, -1, 20, 21248 }, // ̪
+    { 12, 5, 5, -8, -1, 13, 21268 }, // ̫
+    { 10, 6, 4, -7, 0, 15, 21281 }, // ̬
+    { 10, 6, 4, -7, -1, 15, 21296 }, // ̭
+    { 9, 5, 4, -6, -1, 11, 21311 }, // ̮
+    { 9, 5, 3, -7, -1, 12, 21322 }, // ̯
+    { 11, 5, 4, -8, -1, 16, 21334 }, // ̰
+    { 9, 3, 3, -7, -2, 9, 21350 }, // ̱
+    { 13, 3, 5, -9, -2, 16, 21359 }, // ̲
+    { 14, 7, 6, -9, 0, 26, 21375 }, // ̳
+    { 12, 5, 7, -6, 10, 13, 21401 }, // ̴
+    { 12, 3, 7, -6, 10, 15, 21414 }, // ̵
+    { 20, 3, 11, -10, 10, 24, 21429 }, // ̶
+    { 10, 7, 6, -5, 12, 11, 21453 }, // ̷
+    { 16, 25, 9, -8, 23, 49, 21464 }, // ̸
+    { 5, 8, 4, -2, 1, 11, 21513 }, // ̹
+    { 12, 6, 5, -8, -1, 23, 21524 }, // ̺
+    { 12, 7, 5, -8, 0, 23, 21547 }, // ̻
+    { 12, 5, 5, -8, -1, 14, 21570 }, // ̼
+    { 8, 7, 8, -1, 23, 12, 21584 }, // ̽
+    { 7, 10, 7, -1, 26, 14, 21596 }, // ̾
+    { 14, 7, 12, -3, 29, 26, 21610 }, // ̿
+    { 6, 6, 5, -2, 23, 10, 21636 }, // ̀
+    { 7, 6, 9, 1, 23, 11, 21646 }, // ́
+    { 12, 5, 17, 4, 22, 13, 21657 }, // ͂
+    { 6, 6, 7, 0, 23, 7, 21670 }, // ̓
+    { 11, 6, 9, -3, 23, 18, 21677 }, // ̈́
+    { 5, 5, 2, -4, -2, 9, 21695 }, // ͅ
+    { 14, 6, 11, -4, 23, 20, 21704 }, // ͆
+    { 14, 7, 6, -9, 0, 25, 21724 }, // ͇
+    { 9, 6, 3, -7, 0, 17, 21749 }, // ͈
+    { 7, 6, 3, -5, -1, 14, 21766 }, // ͉
+    { 11, 7, 9, -3, 23, 20, 21780 }, // ͊
+    { 12, 11, 10, -3, 27, 28, 21800 }, // ͋
+    { 12, 8, 10, -3, 25, 24, 21828 }, // ͌
+    { 11, 6, 4, -8, -1, 17, 21852 }, // ͍
+    { 6, 7, 2, -5, 0, 11, 21869 }, // ͎
+    { 22, 21, 12, -11, 21, 95, 21880 }, // ͏
+    { 5, 7, 6, 0, 24, 9, 21975 }, // ͐
+    { 5, 7, 9, 3, 24, 11, 21984 }, // ͑
+    { 9, 8, 8, -2, 25, 18, 21995 }, // ͒
+    { 7, 7, 3, -5, 0, 10, 22013 }, // ͓
+    { 6, 6, 2, -5, -1, 11, 22023 }, // ͔
+    { 6, 6, 3, -4, -1, 11, 22034 }, // ͕
+    { 12, 6, 6, -7, -1, 23, 22045 }, // ͖
+    { 4, 8, 8, 3, 25, 10, 22068 }, // ͗
+    { 4, 4, 6, 1, 22, 7, 22078 }, // ͘
+    { 7, 6, 2, -6, -1, 15, 22085 }, // ͙
+    { 12, 7, 5, -8, 0, 25, 22100 }, // ͚
+    { 6, 6, 7, 0, 23, 11, 22125 }, // ͛
+    { 22, 6, 10, -13, -1, 26, 22136 }, // ͜
+    { 21, 6, 14, -8, 23, 26, 22162 }, // ͝
+    { 15, 3, 11, -5, 20, 13, 22188 }, // ͞
+    { 16, 3, 7, -10, -2, 14, 22201 }, // ͟
+    { 22, 5, 15, -8, 22, 23, 22215 }, // ͠
+    { 21, 6, 14, -8, 25, 23, 22238 }, // ͡
+    { 22, 6, 9, -14, -1, 22, 22261 }, // ͢
+    { 8, 8, 8, -1, 25, 19, 22283 }, // ͣ
+    { 6, 8, 7, 0, 25, 15, 22302 }, // ͤ
+    { 4, 9, 6, 1, 27, 13, 22317 }, // ͥ
+    { 7, 7, 7, -1, 25, 17, 22330 }, // ͦ
+    { 8, 8, 8, -1, 25, 19, 22347 }, // ͧ
+    { 6, 8, 7, 0, 25, 13, 22366 }, // ͨ
+    { 8, 10, 8, -1, 27, 24, 22379 }, // ͩ
+    { 7, 9, 7, -1, 27, 23, 22403 }, // ͪ
+    { 11, 7, 9, -3, 25, 30, 22426 }, // ͫ
+    { 6, 7, 7, 0, 25, 13, 22456 }, // ͬ
+    { 5, 9, 7, 1, 26, 13, 22469 }, // ͭ
+    { 7, 7, 8, 0, 25, 15, 22482 }, // ͮ
+    { 8, 7, 8, -1, 25, 17, 22497 }, // ͯ
+    { 17, 21, 16, -2, 21, 63, 22514 }, // Α
+    { 17, 21, 19, 1, 21, 67, 22577 }, // Β
+    { 16, 21, 18, 1, 21, 47, 22644 }, // Γ
+    { 18, 21, 17, -2, 21, 70, 22691 }, // Δ
+    { 16, 21, 18, 1, 21, 56, 22761 }, // Ε
+    { 18, 21, 18, -1, 21, 54, 22817 }, // Ζ
+    { 19, 21, 21, 1, 21, 75, 22871 }, // Η
+    { 19, 23, 22, 2, 22, 84, 22946 }, // Θ
+    { 13, 21, 13, -1, 21, 43, 23030 }, // Ι
+    { 18, 21, 20, 1, 21, 70, 23073 }, // Κ
+    { 18, 21, 17, -2, 21, 64, 23143 }, // Λ
+    { 24, 21, 26, 1, 21, 111, 23207 }, // Μ
+    { 20, 21, 22, 1, 21, 86, 23318 }, // Ν
+    { 18, 21, 18, -1, 21, 47, 23404 }, // Ξ
+    { 19, 23, 22, 2, 22, 75, 23451 }, // Ο
+    { 20, 21, 22, 1, 21, 74, 23526 }, // Π
+    { 16, 21, 18, 1, 21, 59, 23600 }, // Ρ
+    { 18, 21, 18, -1, 21, 54, 23659 }, // Σ
+    { 16, 21, 19, 2, 21, 48, 23713 }, // Τ
+    { 16, 21, 19, 2, 21, 53, 23761 }, // Υ
+    { 23, 21, 25, 1, 21, 87, 23814 }, // Φ
+    { 20, 21, 19, -2, 21, 65, 23901 }, // Χ
+    { 22, 21, 26, 3, 21, 83, 23966 }, // Ψ
+    { 21, 22, 21, -1, 22, 76, 24049 }, // Ω
+    { 15, 17, 17, 1, 16, 57, 24125 }, // α
+    { 18, 30, 18, -1, 23, 89, 24182 }, // β
+    { 13, 23, 15, 1, 16, 58, 24271 }, // γ
+    { 16, 24, 18, 1, 23, 64, 24329 }, // δ
+    { 13, 17, 14, 0, 16, 39, 24393 }, // ε
+    { 15, 29, 16, 0, 23, 62, 24432 }, // ζ
+    { 16, 24, 17, 0, 17, 65, 24494 }, // η
+    { 15, 24, 17, 1, 23, 71, 24559 }, // θ
+    { 7, 17, 9, 1, 16, 29, 24630 }, // ι
+    { 16, 16, 17, 0, 16, 49, 24659 }, // κ
+    { 16, 24, 15, -2, 23, 63, 24708 }, // λ
+    { 18, 23, 18, -1, 16, 68, 24771 }, // μ
+    { 13, 16, 15, 1, 16, 45, 24839 }, // ν
+    { 16, 29, 17, 0, 23, 64, 24884 }, // ξ
+    { 15, 17, 17, 1, 16, 50, 24948 }, // ο
+    { 18, 17, 20, 1, 16, 58, 24998 }, // π
+    { 16, 23, 16, -1, 16, 65, 25056 }, // ρ
+    { 13, 22, 15, 1, 16, 49, 25121 }, // ς
+    { 17, 17, 19, 1, 16, 55, 25170 }, // σ
+    { 13, 17, 15, 1, 16, 42, 25225 }, // τ
+    { 15, 17, 17, 1, 16, 52, 25267 }, // υ
+    { 18, 23, 20, 1, 16, 83, 25319 }, // φ
+    { 19, 23, 18, -2, 16, 70, 25402 }, // χ
+    { 19, 30, 21, 1, 23, 99, 25472 }, // ψ
+    { 21, 17, 23, 1, 16, 73, 25571 }, // ω
+    { 17, 27, 16, -2, 21, 73, 25644 }, // Ạ
+    { 16, 22, 18, 1, 16, 63, 25717 }, // ạ
+    { 18, 29, 17, -2, 29, 81, 25780 }, // Ả
+    { 16, 25, 18, 1, 24, 69, 25861 }, // ả
+    { 22, 29, 21, -2, 29, 93, 25930 }, // Ấ
+    { 18, 25, 20, 1, 24, 79, 26023 }, // ấ
+    { 18, 29, 17, -2, 29, 85, 26102 }, // Ầ
+    { 16, 25, 18, 1, 24, 75, 26187 }, // ầ
+    { 21, 31, 20, -2, 31, 94, 26262 }, // Ẩ
+    { 17, 27, 19, 1, 26, 80, 26356 }, // ẩ
+    { 20, 31, 19, -2, 31, 94, 26436 }, // Ẫ
+    { 16, 27, 18, 1, 26, 82, 26530 }, // ẫ
+    { 18, 34, 17, -2, 28, 92, 26612 }, // Ậ
+    { 16, 29, 18, 1, 23, 79, 26704 }, // ậ
+    { 19, 30, 18, -2, 30, 89, 26783 }, // Ắ
+    { 16, 26, 18, 1, 25, 78, 26872 }, // ắ
+    { 19, 30, 18, -2, 30, 89, 26950 }, // Ằ
+    { 16, 26, 18, 1, 25, 77, 27039 }, // ằ
+    { 19, 31, 18, -2, 31, 92, 27116 }, // Ẳ
+    { 16, 27, 18, 1, 26, 81, 27208 }, // ẳ
+    { 20, 31, 19, -2, 31, 94, 27289 }, // Ẵ
+    { 16, 27, 18, 1, 26, 83, 27383 }, // ẵ
+    { 19, 33, 18, -2, 27, 91, 27466 }, // Ặ
+    { 16, 28, 18, 1, 22, 77, 27557 }, // ặ
+    { 16, 27, 18, 1, 21, 66, 27634 }, // Ẹ
+    { 13, 22, 15, 1, 16, 55, 27700 }, // ẹ
+    { 16, 29, 18, 1, 29, 74, 27755 }, // Ẻ
+    { 13, 25, 15, 1, 24, 62, 27829 }, // ẻ
+    { 16, 27, 18, 1, 27, 71, 27891 }, // Ẽ
+    { 15, 23, 17, 1, 22, 62, 27962 }, // ẽ
+    { 19, 29, 21, 1, 29, 76, 28024 }, // Ế
+    { 18, 25, 20, 1, 24, 74, 28100 }, // ế
+    { 16, 29, 18, 1, 29, 75, 28174 }, // Ề
+    { 13, 25, 15, 1, 24, 68, 28249 }, // ề
+    { 18, 31, 20, 1, 31, 78, 28317 }, // Ể
+    { 16, 27, 18, 1, 26, 72, 28395 }, // ể
+    { 17, 31, 19, 1, 31, 80, 28467 }, // Ễ
+    { 15, 27, 17, 1, 26, 77, 28547 }, // ễ
+    { 16, 34, 18, 1, 28, 81, 28624 }, // Ệ
+    { 13, 29, 15, 1, 23, 71, 28705 }, // ệ
+    { 13, 29, 13, -1, 29, 60, 28776 }, // Ỉ
+    { 10, 24, 11, 0, 24, 38, 28836 }, // ỉ
+    { 13, 27, 13, -1, 21, 52, 28874 }, // Ị
+    { 9, 28, 9, -1, 22, 37, 28926 }, // ị
+    { 19, 28, 22, 2, 22, 83, 28963 }, // Ọ
+    { 15, 22, 17, 1, 16, 58, 29046 }, // ọ
+    { 19, 30, 22, 2, 29, 91, 29104 }, // Ỏ
+    { 15, 25, 17, 1, 24, 67, 29195 }, // ỏ
+    { 21, 30, 24, 2, 29, 98, 29262 }, // Ố
+    { 18, 25, 20, 1, 24, 75, 29360 }, // ố
+    { 19, 30, 22, 2, 29, 95, 29435 }, // Ồ
+    { 15, 25, 17, 1, 24, 71, 29530 }, // ồ
+    { 20, 32, 23, 2, 31, 101, 29601 }, // Ổ
+    { 17, 27, 19, 1, 26, 76, 29702 }, // ổ
+    { 19, 32, 22, 2, 31, 102, 29778 }, // Ỗ
+    { 16, 27, 18, 1, 26, 78, 29880 }, // ỗ
+    { 19, 34, 22, 2, 28, 101, 29958 }, // Ộ
+    { 15, 29, 17, 1, 23, 73, 30059 }, // ộ
+    { 23, 29, 26, 2, 28, 97, 30132 }, // Ớ
+    { 19, 24, 21, 1, 23, 71, 30229 }, // ớ
+    { 23, 29, 26, 2, 28, 97, 30300 }, // Ờ
+    { 19, 24, 21, 1, 23, 72, 30397 }, // ờ
+    { 23, 30, 26, 2, 29, 100, 30469 }, // Ở
+    { 19, 25, 21, 1, 24, 75, 30569 }, // ở
+    { 23, 28, 26, 2, 27, 98, 30644 }, // Ỡ
+    { 19, 23, 21, 1, 22, 74, 30742 }, // ỡ
+    { 23, 29, 26, 2, 23, 93, 30816 }, // Ợ
+    { 19, 25, 21, 1, 19, 70, 30909 }, // ợ
+    { 19, 27, 22, 2, 21, 84, 30979 }, // Ụ
+    { 16, 22, 18, 1, 16, 64, 31063 }, // ụ
+    { 19, 30, 22, 2, 29, 94, 31127 }, // Ủ
+    { 16, 25, 18, 1, 24, 71, 31221 }, // ủ
+    { 24, 29, 27, 2, 28, 105, 31292 }, // Ứ
+    { 21, 24, 23, 1, 23, 81, 31397 }, // ứ
+    { 24, 29, 27, 2, 28, 104, 31478 }, // Ừ
+    { 21, 24, 23, 1, 23, 79, 31582 }, // ừ
+    { 24, 30, 27, 2, 29, 110, 31661 }, // Ử
+    { 21, 25, 23, 1, 24, 83, 31771 }, // ử
+    { 24, 28, 27, 2, 27, 105, 31854 }, // Ữ
+    { 21, 23, 23, 1, 22, 83, 31959 }, // ữ
+    { 24, 29, 27, 2, 23, 103, 32042 }, // Ự
+    { 21, 25, 23, 1, 19, 78, 32145 }, // ự
+    { 16, 28, 19, 2, 28, 65, 32223 }, // Ỳ
+    { 19, 30, 17, -3, 23, 80, 32288 }, // ỳ
+    { 16, 27, 19, 2, 21, 62, 32368 }, // Ỵ
+    { 19, 23, 17, -3, 16, 70, 32430 }, // ỵ
+    { 16, 29, 19, 2, 29, 69, 32500 }, // Ỷ
+    { 19, 31, 17, -3, 24, 82, 32569 }, // ỷ
+    { 16, 27, 19, 2, 27, 67, 32651 }, // Ỹ
+    { 19, 29, 17, -3, 22, 85, 32718 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 32803 }, //  
+    { 0, 0, 29, 0, 0, 0, 32803 }, //  
+    { 0, 0, 15, 0, 0, 0, 32803 }, //  
+    { 0, 0, 29, 0, 0, 0, 32803 }, //  
+    { 0, 0, 10, 0, 0, 0, 32803 }, //  
+    { 0, 0, 7, 0, 0, 0, 32803 }, //  
+    { 0, 0, 5, 0, 0, 0, 32803 }, //  
+    { 0, 0, 16, 0, 0, 0, 32803 }, //  
+    { 0, 0, 7, 0, 0, 0, 32803 }, //  
+    { 0, 0, 5, 0, 0, 0, 32803 }, //  
+    { 0, 0, 3, 0, 0, 0, 32803 }, //  
+    { 0, 0, 1, 0, 0, 0, 32803 }, // ​
+    { 0, 0, 1, 0, 0, 0, 32803 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 32803 }, // ‍
+    { 8, 25, 8, -1, 21, 45, 32803 }, // ‎
+    { 8, 25, 2, -7, 21, 45, 32848 }, // ‏
+    { 9, 3, 10, 0, 9, 8, 32893 }, // ‐
+    { 9, 3, 10, 0, 9, 8, 32901 }, // ‑
+    { 15, 3, 17, 1, 12, 17, 32909 }, // ‒
+    { 14, 4, 15, 0, 10, 12, 32926 }, // –
+    { 28, 4, 29, 0, 10, 24, 32938 }, // —
+    { 28, 4, 29, 0, 10, 24, 32962 }, // ―
+    { 9, 31, 16, 4, 23, 75, 32986 }, // ‖
+    { 13, 7, 12, -3, 0, 26, 33061 }, // ‗
+    { 7, 8, 9, 1, 21, 13, 33087 }, // ‘
+    { 7, 8, 9, 1, 21, 12, 33100 }, // ’
+    { 7, 8, 7, -2, 4, 13, 33112 }, // ‚
+    { 4, 8, 8, 3, 21, 10, 33125 }, // ‛
+    { 12, 8, 14, 1, 21, 26, 33135 }, // “
+    { 12, 8, 14, 1, 21, 25, 33161 }, // ”
+    { 12, 8, 12, -2, 4, 26, 33186 }, // „
+    { 9, 8, 13, 3, 21, 21, 33212 }, // ‟
+    { 11, 23, 15, 3, 23, 44, 33233 }, // †
+    { 15, 23, 16, 0, 23, 47, 33277 }, // ‡
+    { 8, 8, 11, 2, 15, 13, 33324 }, // •
+    { 10, 10, 12, 1, 16, 16, 33337 }, // ‣
+    { 4, 5, 15, 4, 4, 7, 33353 }, // ․
+    { 12, 5, 15, 0, 4, 14, 33360 }, // ‥
+    { 20, 5, 22, 0, 4, 22, 33374 }, // …
+    { 5, 5, 7, 1, 10, 8, 33396 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 33404 }, //  
+    { 0, 0, 18, 0, 0, 0, 33404 }, //  
+    { 8, 22, 8, -1, 18, 38, 33404 }, // ‪
+    { 8, 22, 2, -7, 18, 38, 33442 }, // ‫
+    { 8, 25, 5, -4, 21, 40, 33480 }, // ‬
+    { 8, 25, 5, -4, 21, 38, 33520 }, // ‭
+    { 8, 25, 5, -4, 21, 38, 33558 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 33596 }, //  
+    { 30, 23, 33, 2, 22, 148, 33596 }, // ‰
+    { 40, 23, 43, 2, 22, 191, 33744 }, // ‱
+    { 8, 8, 10, 1, 21, 13, 33935 }, // ′
+    { 13, 8, 15, 1, 21, 26, 33948 }, // ″
+    { 18, 8, 20, 1, 21, 38, 33974 }, // ‴
+    { 5, 8, 9, 3, 21, 12, 34012 }, // ‵
+    { 10, 8, 14, 3, 21, 25, 34024 }, // ‶
+    { 14, 8, 18, 3, 21, 36, 34049 }, // ‷
+    { 11, 10, 12, -3, 3, 25, 34085 }, // ‸
+    { 8, 13, 10, 1, 14, 20, 34110 }, // ‹
+    { 8, 13, 9, 0, 14, 21, 34130 }, // ›
+    { 22, 23, 24, 1, 22, 95, 34151 }, // ※
+    { 15, 22, 16, 0, 21, 64, 34246 }, // ‼
+    { 12, 23, 15, 2, 22, 52, 34310 }, // ‽
+    { 13, 3, 16, 2, 25, 6, 34362 }, // ‾
+    { 16, 7, 16, -2, 0, 20, 34368 }, // ‿
+    { 16, 7, 19, 2, 24, 23, 34388 }, // ⁀
+    { 14, 19, 12, -3, 12, 47, 34411 }, // ⁁
+    { 31, 27, 33, 0, 23, 130, 34458 }, // ⁂
+    { 8, 3, 9, 0, 9, 8, 34588 }, // ⁃
+    { 18, 21, 12, -7, 21, 44, 34596 }, // ⁄
+    { 12, 26, 12, -1, 21, 54, 34640 }, // ⁅
+    { 12, 26, 10, -3, 21, 55, 34694 }, // ⁆
+    { 24, 23, 27, 2, 22, 83, 34749 }, // ⁇
+    { 19, 23, 22, 2, 22, 74, 34832 }, // ⁈
+    { 21, 23, 22, 0, 22, 72, 34906 }, // ⁉
+    { 15, 16, 17, 1, 16, 44, 34978 }, // ⁊
+    { 15, 27, 19, 3, 23, 85, 35022 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 35107 }, // ⁌
+    { 16, 15, 19, 2, 16, 61, 35167 }, // ⁍
+    { 15, 15, 16, -1, 8, 39, 35228 }, // ⁎
+    { 7, 21, 8, 0, 17, 26, 35267 }, // ⁏
+    { 20, 31, 19, -2, 24, 66, 35293 }, // ⁐
+    { 17, 30, 18, 0, 23, 85, 35359 }, // ⁑
+    { 11, 23, 12, 0, 22, 46, 35444 }, // ⁒
+    { 26, 5, 29, 2, 11, 29, 35490 }, // ⁓
+    { 16, 7, 16, -3, 0, 24, 35519 }, // ⁔
+    { 16, 16, 17, 0, 15, 54, 35543 }, // ⁕
+    { 13, 23, 15, 1, 22, 33, 35597 }, // ⁖
+    { 23, 8, 25, 1, 21, 50, 35630 }, // ⁗
+    { 22, 23, 24, 1, 22, 49, 35680 }, // ⁘
+    { 22, 23, 24, 1, 22, 51, 35729 }, // ⁙
+    { 4, 23, 6, 1, 22, 15, 35780 }, // ⁚
+    { 17, 23, 19, 1, 22, 40, 35795 }, // ⁛
+    { 22, 23, 24, 1, 22, 103, 35835 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 35938 }, // ⁝
+    { 5, 23, 8, 2, 22, 27, 35960 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 35987 }, //  
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 35987 }, // ⁩
+    { 8, 25, 5, -4, 21, 39, 35987 }, // ⁪
+    { 8, 25, 5, -4, 21, 42, 36026 }, // ⁫
+    { 8, 25, 5, -4, 21, 37, 36068 }, // ⁬
+    { 8, 25, 5, -4, 21, 37, 36105 }, // ⁭
+    { 8, 25, 5, -4, 21, 41, 36142 }, // ⁮
+    { 8, 25, 5, -4, 21, 38, 36183 }, // ⁯
+    { 10, 14, 13, 2, 25, 34, 36221 }, // ⁰
+    { 5, 14, 8, 2, 22, 18, 36255 }, // ⁱ
+    { 10, 13, 13, 2, 25, 29, 36273 }, // ⁴
+    { 10, 14, 13, 2, 25, 27, 36302 }, // ⁵
+    { 10, 14, 14, 3, 25, 31, 36329 }, // ⁶
+    { 10, 13, 14, 3, 25, 24, 36360 }, // ⁷
+    { 10, 14, 13, 2, 25, 38, 36384 }, // ⁸
+    { 10, 14, 13, 2, 25, 35, 36422 }, // ⁹
+    { 8, 9, 12, 3, 22, 16, 36457 }, // ⁺
+    { 8, 3, 12, 3, 19, 6, 36473 }, // ⁻
+    { 8, 6, 12, 3, 21, 10, 36479 }, // ⁼
+    { 7, 17, 11, 3, 27, 28, 36489 }, // ⁽
+    { 7, 17, 8, 0, 27, 27, 36517 }, // ⁾
+    { 10, 10, 13, 2, 18, 35, 36544 }, // ⁿ
+    { 10, 14, 10, -1, 9, 36, 36579 }, // ₀
+    { 7, 13, 10, 0, 9, 22, 36615 }, // ₁
+    { 11, 13, 10, -2, 9, 25, 36637 }, // ₂
+    { 11, 14, 10, -2, 9, 29, 36662 }, // ₃
+    { 10, 13, 10, -1, 9, 28, 36691 }, // ₄
+    { 10, 14, 10, -1, 9, 27, 36719 }, // ₅
+    { 10, 14, 10, -1, 9, 32, 36746 }, // ₆
+    { 11, 13, 11, -1, 9, 24, 36778 }, // ₇
+    { 10, 14, 10, -1, 9, 37, 36802 }, // ₈
+    { 10, 14, 10, -1, 9, 34, 36839 }, // ₉
+    { 9, 9, 10, -1, 6, 17, 36873 }, // ₊
+    { 9, 3, 10, -1, 4, 8, 36890 }, // ₋
+    { 9, 6, 10, -1, 5, 12, 36898 }, // ₌
+    { 7, 17, 8, 0, 11, 23, 36910 }, // ₍
+    { 8, 17, 5, -4, 11, 24, 36933 }, // ₎
+    { 10, 10, 11, -1, 7, 35, 36957 }, // ₐ
+    { 9, 10, 9, -1, 7, 29, 36992 }, // ₑ
+    { 10, 10, 11, -1, 7, 31, 37021 }, // ₒ
+    { 12, 10, 10, -3, 7, 28, 37052 }, // ₓ
+    { 9, 10, 9, -2, 7, 24, 37080 }, // ₔ
+    { 10, 14, 13, 0, 11, 40, 37104 }, // ₕ
+    { 10, 14, 11, 0, 11, 39, 37144 }, // ₖ
+    { 5, 14, 7, 0, 11, 22, 37183 }, // ₗ
+    { 16, 10, 18, 0, 7, 49, 37205 }, // ₘ
+    { 11, 10, 11, -2, 7, 34, 37254 }, // ₙ
+    { 11, 14, 11, -2, 7, 42, 37288 }, // ₚ
+    { 8, 10, 9, -1, 7, 22, 37330 }, // ₛ
+    { 7, 12, 7, -1, 9, 23, 37352 }, // ₜ
+    { 15, 22, 18, 2, 22, 61, 37375 }, // ₠
+    { 17, 25, 19, 1, 23, 92, 37436 }, // ₡
+    { 16, 23, 18, 1, 22, 65, 37528 }, // ₢
+    { 17, 21, 18, 0, 21, 54, 37593 }, // ₣
+    { 18, 22, 18, -1, 22, 68, 37647 }, // ₤
+    { 24, 24, 26, 0, 20, 101, 37715 }, // ₥
+    { 17, 21, 18, 0, 21, 84, 37816 }, // ₦
+    { 21, 22, 22, 0, 21, 84, 37900 }, // ₧
+    { 24, 22, 25, 0, 21, 96, 37984 }, // ₨
+    { 21, 21, 22, 0, 21, 105, 38080 }, // ₩
+    { 24, 21, 25, 0, 21, 113, 38185 }, // ₪
+    { 19, 28, 20, 0, 23, 94, 38298 }, // ₫
+    { 18, 23, 19, 0, 22, 60, 38392 }, // €
+    { 19, 21, 20, 0, 21, 75, 38452 }, // ₭
+    { 17, 21, 19, 1, 21, 59, 38527 }, // ₮
+    { 28, 29, 29, 0, 22, 125, 38586 }, // ₯
+    { 19, 29, 18, -2, 22, 86, 38711 }, // ₰
+    { 17, 21, 19, 1, 21, 64, 38797 }, // ₱
+    { 18, 26, 21, 2, 23, 87, 38861 }, // ₲
+    { 20, 21, 19, -2, 21, 65, 38948 }, // ₳
+    { 18, 23, 18, -1, 22, 75, 39013 }, // ₴
+    { 17, 26, 20, 2, 23, 78, 39088 }, // ₵
+    { 18, 21, 19, 0, 20, 69, 39166 }, // ₶
+    { 21, 25, 21, -1, 22, 101, 39235 }, // ₷
+    { 16, 21, 18, 1, 21, 55, 39336 }, // ₸
+    { 15, 21, 18, 2, 21, 45, 39391 }, // ₹
+    { 16, 22, 17, 0, 21, 65, 39436 }, // ₺
+    { 19, 23, 21, 1, 22, 86, 39501 }, // ₻
+    { 22, 21, 22, -1, 21, 74, 39587 }, // ₼
+    { 19, 21, 19, -1, 21, 66, 39661 }, // ₽
+    { 20, 24, 20, -1, 24, 82, 39727 }, // ₾
+    { 16, 27, 18, 1, 24, 85, 39809 }, // ₿
+    { 9, 3, 10, 0, 9, 8, 39894 }, // −
+    { 27, 28, 29, 1, 23, 112, 39902 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
@@ -4406,4 +3322,5 @@ static const EpdFontData notosans_14_italic = {
     32,
     -9,
     true,
+    true,
 };
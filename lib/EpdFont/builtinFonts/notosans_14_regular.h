@@ -2,4146 +2,3268 @@
  * generated by fontconvert.py
  * name: notosans_14_regular
  * size: 14
- * mode: 2-bit
- * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_regularBitmaps[53635] = {
-    0xBD, 0xBD, 0xBD, 0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00,
-    0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x3E, 0x0B, 0xCF, 0x82, 0xF3, 0xD0, 0xBC, 0xF4, 0x2E, 0x3D,
-    0x07, 0x8B, 0x41, 0xE2, 0xC0, 0x78, 0x60, 0x09, 0x00, 0x02, 0xC0, 0x1D, 0x00, 0x00, 0x0F, 0x00,
-    0xB4, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x0B, 0x80, 0x78, 0x00,
-    0x00, 0x3D, 0x01, 0xE0, 0x00, 0xAA, 0xFA, 0xAF, 0xEA, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x6F,
-    0x55, 0xF5, 0x50, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0xB4,
-    0x00, 0x00, 0x3C, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2D, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00, 0x0F, 0x00,
-    0xF0, 0x00, 0x00, 0x78, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x17, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x7F,
-    0xFE, 0xFF, 0x03, 0xF0, 0xB4, 0x14, 0x0F, 0x42, 0xD0, 0x00, 0x3D, 0x0B, 0x40, 0x00, 0xFC, 0x2D,
-    0x00, 0x02, 0xFD, 0xB4, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0xB5, 0xFE, 0x00, 0x02, 0xD0, 0xFC, 0x00, 0x0B, 0x41, 0xF0, 0x00, 0x2D, 0x0B, 0xC2,
-    0x40, 0xB4, 0x7E, 0x0F, 0xFB, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x00, 0x05, 0xBE, 0x40, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x1E, 0x00, 0x1F, 0xBF, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0xF4, 0x00, 0xB8, 0x00,
-    0x7C, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x3C, 0x02, 0xE0, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00,
-    0x0B, 0x80, 0x3C, 0x0B, 0x80, 0x00, 0xB8, 0x03, 0xC1, 0xF0, 0x00, 0x07, 0x80, 0x3C, 0x3D, 0x1B,
-    0x80, 0x3C, 0x07, 0x87, 0xC7, 0xFF, 0x43, 0xD0, 0xF4, 0xF4, 0xF4, 0x7C, 0x1F, 0xFF, 0x2E, 0x1E,
-    0x03, 0xD0, 0x7F, 0x83, 0xC2, 0xD0, 0x1E, 0x00, 0x00, 0xB8, 0x3D, 0x01, 0xF0, 0x00, 0x0F, 0x03,
-    0xD0, 0x1F, 0x00, 0x02, 0xE0, 0x3D, 0x01, 0xF0, 0x00, 0x7C, 0x02, 0xD0, 0x1E, 0x00, 0x0F, 0x40,
-    0x2E, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x3C, 0x00, 0x3D, 0x00, 0x0F, 0xEF, 0xC0, 0x0B, 0x80,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x7D, 0x00, 0x00, 0x01, 0xF4, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0x50, 0x0F, 0xE3, 0xF8, 0x00, 0xFC, 0x0B, 0xE0, 0x3F,
-    0x80, 0x3D, 0x03, 0xF0, 0x03, 0xF8, 0x2F, 0x01, 0xF4, 0x00, 0x3F, 0x8F, 0x80, 0x7C, 0x00, 0x03,
-    0xFF, 0xC0, 0x1F, 0x40, 0x00, 0x3F, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0x40, 0x6F,
-    0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xC2, 0xF8, 0x00, 0xBF, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x2D, 0x2C, 0x18, 0x00, 0xB4, 0x0B, 0xC0, 0x3D, 0x02,
-    0xF0, 0x0F, 0x40, 0xBC, 0x03, 0xE0, 0x0F, 0x40, 0x7C, 0x02, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0xFC,
-    0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xD0, 0x0F, 0xC0, 0x2F, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF0, 0x01, 0x90, 0x2E, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xD0,
-    0x02, 0xF0, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF8,
-    0x01, 0xF4, 0x03, 0xF0, 0x03, 0xD0, 0x0B, 0xC0, 0x1F, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x90, 0xF0,
-    0x6E, 0xBF, 0xEF, 0xFF, 0xE6, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xBE, 0x00, 0x01,
-    0xF1, 0xF4, 0x00, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0x7E, 0x00, 0x18, 0x02, 0x40, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x2D, 0x00, 0x01, 0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x05, 0x07, 0xD2, 0xF0, 0xFC, 0x3D, 0x1F, 0x07, 0x82, 0xC0,
-    0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x00, 0xF4, 0x00, 0x07,
-    0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xE0,
-    0x03, 0xF4, 0x0B, 0xD0, 0x1F, 0x40, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x3E, 0x1F,
-    0x40, 0x00, 0xBC, 0x7C, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x2F, 0x00,
-    0x00, 0x7C, 0xBC, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x1F, 0x40, 0x00,
-    0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0xBC, 0x03, 0xF4, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x1F,
-    0xD0, 0x2F, 0xF4, 0x3F, 0x7D, 0x3F, 0x0F, 0x4B, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x18, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0x1B, 0xE0, 0x14, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x55, 0xBF, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x29, 0x00, 0x0B, 0xF0, 0xBF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x02, 0xE7, 0xC0, 0x00, 0x01, 0xF1, 0xF0, 0x00,
-    0x00, 0xF4, 0x7C, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3D, 0x01, 0xF0,
-    0x00, 0x3E, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x01,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x5B, 0xD5, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFE, 0x00, 0xFA, 0xAA, 0xA4, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0xAF,
-    0x90, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xA9, 0x5B, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x2F, 0x43, 0x80, 0x02, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF4, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0xBF,
-    0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x7F, 0xE0, 0x03, 0xDF, 0xFF, 0xF4, 0x1F, 0xF4, 0x07, 0xF4,
-    0x7F, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x1F, 0x4F, 0x40, 0x00, 0x3D, 0x3D,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x3E, 0x02, 0xF4, 0x07, 0xF0, 0x03, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xD6, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xF4, 0x07, 0xF0, 0x2F, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x0F, 0x83,
-    0xE0, 0x00, 0x3E, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0xD2, 0xF8, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xF5, 0xFF, 0x00, 0x7E, 0x00, 0x7F, 0x03, 0xE0, 0x00,
-    0x3F, 0x1F, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x01, 0xF2, 0xF0, 0x00, 0x07, 0xC7, 0xD0, 0x00, 0x3F,
-    0x0F, 0xD0, 0x02, 0xF4, 0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xF4, 0x1F, 0xD0, 0x3F,
-    0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x0F, 0x47, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0x7C, 0xBC, 0x00,
-    0x01, 0xF1, 0xF0, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x7F, 0x0B, 0xE0, 0x07, 0xFC, 0x0F, 0xFF, 0xFE,
-    0xF0, 0x0B, 0xFF, 0x8B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0x00, 0x7C, 0x0F, 0xE0, 0xFE, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0F, 0xC0,
-    0xFC, 0x0F, 0x81, 0xF0, 0x2F, 0x03, 0xD0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA,
-    0xAA, 0xA0, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F,
-    0xD0, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xF8, 0x3D, 0x01, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x00,
-    0x7D, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x1A, 0xFA, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE4, 0x01,
-    0xBF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0x1F, 0xFF, 0x80, 0x7C, 0x1F, 0x00, 0xBF, 0xAF, 0xC0, 0x3C,
-    0x2D, 0x01, 0xF4, 0x03, 0xC0, 0x2D, 0x3C, 0x03, 0xD0, 0x03, 0xC0, 0x2D, 0x3C, 0x03, 0xC0, 0x03,
-    0xC0, 0x2E, 0x7C, 0x07, 0xC0, 0x07, 0xC0, 0x2D, 0x7C, 0x07, 0xC0, 0x07, 0xC0, 0x2D, 0x7C, 0x07,
-    0xC0, 0x0B, 0xC0, 0x3C, 0x3C, 0x03, 0xC0, 0x0F, 0xC0, 0x7C, 0x3C, 0x03, 0xF0, 0x2E, 0xD0, 0xF4,
-    0x3D, 0x00, 0xFF, 0xF4, 0xFF, 0xE0, 0x2F, 0x00, 0x2F, 0x80, 0x2E, 0x40, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0xBF,
-    0x95, 0x5B, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x5A, 0x94, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x3F, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0xAF, 0xF0,
-    0x3D, 0x00, 0x03, 0xF4, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8,
-    0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFE, 0x40,
-    0x3E, 0x00, 0x5B, 0xF0, 0x3D, 0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x7D,
-    0x3D, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x5B, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x41, 0xBC, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x68, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3E, 0x55, 0xAF, 0xF4, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x00, 0x7F,
-    0x03, 0xD0, 0x00, 0x01, 0xF8, 0x3D, 0x00, 0x00, 0x0F, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x3D, 0x00,
-    0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x07, 0xE3, 0xD0, 0x00, 0x00, 0x7D,
-    0x3D, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x0F, 0xC3, 0xD0, 0x00,
-    0x01, 0xF8, 0x3D, 0x00, 0x00, 0x7F, 0x03, 0xD0, 0x00, 0x1F, 0xD0, 0x3E, 0x55, 0x6F, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3,
-    0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xE4, 0x06, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0xFC, 0x3E, 0x00, 0x03, 0xFF,
-    0xF0, 0xF8, 0x00, 0x05, 0x5B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x1F,
-    0x80, 0x00, 0x02, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x7F, 0x40, 0x00, 0x2F, 0x00, 0xBF, 0x90,
-    0x01, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00,
-    0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4,
-    0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xF9, 0x55, 0x55, 0x7F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00,
-    0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0xBF, 0xFE, 0xBF, 0xFE, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F,
-    0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D,
-    0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4,
-    0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF0, 0x01, 0xFC, 0x7F, 0xFD, 0x1F, 0xFD, 0x01,
-    0xA4, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4,
-    0x00, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00,
-    0xF4, 0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F, 0x6F, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0xBE, 0x00, 0x03, 0xD0, 0x0F,
-    0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0,
-    0x00, 0x3F, 0x40, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0x80, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xE3, 0xEF, 0x00, 0x00, 0x07, 0xFE, 0x3D, 0xF4, 0x00, 0x00, 0xF7, 0xE3, 0xCF, 0x80, 0x00,
-    0x1F, 0x3E, 0x3C, 0x7C, 0x00, 0x02, 0xE3, 0xE3, 0xC3, 0xD0, 0x00, 0x3D, 0x3E, 0x3D, 0x2F, 0x00,
-    0x07, 0xC3, 0xE3, 0xD1, 0xF0, 0x00, 0xF8, 0x3E, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xE3, 0xD0, 0xBC,
-    0x02, 0xF0, 0x3E, 0x3D, 0x03, 0xD0, 0x3D, 0x03, 0xE3, 0xD0, 0x3E, 0x07, 0xC0, 0x3E, 0x3D, 0x01,
-    0xF0, 0xB8, 0x03, 0xE3, 0xD0, 0x0F, 0x4F, 0x40, 0x3E, 0x3D, 0x00, 0xBD, 0xF0, 0x03, 0xE3, 0xD0,
-    0x07, 0xFE, 0x00, 0x3E, 0x3D, 0x00, 0x3F, 0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF8, 0x00, 0x3E, 0x3D,
-    0x00, 0x0F, 0x40, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0xD0,
-    0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0, 0x00, 0x3D,
-    0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F, 0xC0, 0x03, 0xD3, 0xD0, 0x3F,
-    0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D, 0x3D, 0x00, 0x3F, 0x03, 0xD3,
-    0xD0, 0x02, 0xF4, 0x3D, 0x3D, 0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00, 0x7F, 0x3D, 0x3D, 0x00, 0x02,
-    0xF7, 0xD3, 0xD0, 0x00, 0x0F, 0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x02, 0xFD, 0x3D,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F,
-    0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE5,
-    0x6B, 0xFC, 0x0F, 0x40, 0x02, 0xF8, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00,
-    0x2F, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x2F, 0x43, 0xE5, 0x5B, 0xF8,
-    0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x16, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x3F, 0xFF, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4,
-    0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0,
-    0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0x0F, 0x83, 0xF0, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x0B,
-    0xC0, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x2F,
-    0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x3D, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x03,
-    0xD0, 0xF8, 0x00, 0x00, 0x3F, 0x1F, 0x40, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x00, 0x0F, 0x7E, 0x00,
-    0x00, 0x00, 0xFB, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x07,
-    0xD3, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFC, 0x2F, 0x00,
-    0x03, 0xDF, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x1F, 0x3D, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0xB8, 0xB8,
-    0x00, 0xBC, 0x02, 0xF0, 0x03, 0xD1, 0xF0, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x03, 0xD0, 0x0F, 0x80,
-    0x0F, 0x40, 0xBC, 0x0F, 0x80, 0x7D, 0x00, 0x3E, 0x03, 0xE0, 0x2F, 0x02, 0xF0, 0x00, 0xBC, 0x0F,
-    0x40, 0x7C, 0x0F, 0x80, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x3D, 0x00, 0x03, 0xD3, 0xE0, 0x02, 0xF1,
-    0xF0, 0x00, 0x0F, 0x8F, 0x40, 0x07, 0xCB, 0xC0, 0x00, 0x2F, 0x7C, 0x00, 0x0F, 0x7E, 0x00, 0x00,
-    0x7E, 0xF0, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0x1F, 0x80,
-    0x07, 0xD0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x07, 0xD1, 0xF4, 0x00, 0x00,
-    0xBC, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0B, 0xC0, 0xFC,
-    0x00, 0x07, 0xD0, 0x1F, 0x40, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x01, 0xF4, 0x00,
-    0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x1F, 0x1F,
-    0x80, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F,
-    0x00, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0xBF,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFA, 0xFF, 0xFB, 0xD5, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x55, 0xBF, 0xFD,
-    0xAA, 0xA0, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00,
-    0x2F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x1F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x3F, 0xFC, 0x7F, 0xFD,
-    0x15, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x15, 0xBD, 0x7F, 0xFD, 0x2A, 0xA8,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1E, 0xB8, 0x00, 0x00,
-    0xF4, 0xF0, 0x00, 0x07, 0xC2, 0xE0, 0x00, 0x2D, 0x03, 0xC0, 0x00, 0xF0, 0x0B, 0x80, 0x0B, 0x40,
-    0x0F, 0x00, 0x3C, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0xB8, 0xB8, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA,
-    0x00, 0x54, 0x01, 0xF8, 0x02, 0xF4, 0x02, 0xF0, 0x02, 0xE0, 0x01, 0x40, 0x00, 0xAF, 0xE4, 0x02,
-    0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE,
-    0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x0B,
-    0xF9, 0x00, 0xBC, 0xFF, 0xFF, 0x02, 0xFF, 0x91, 0xBF, 0x0B, 0xF0, 0x00, 0xBD, 0x2F, 0x80, 0x00,
-    0xFC, 0xBD, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D,
-    0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x3F, 0x2F, 0xC0, 0x01, 0xF8, 0xBF,
-    0xC0, 0x1F, 0xC2, 0xEB, 0xFF, 0xFD, 0x0B, 0x47, 0xFF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F,
-    0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x01, 0x80, 0x7F, 0xFF, 0xF0, 0x02,
-    0xFF, 0xF4, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x1B, 0xF4, 0x3D, 0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x91, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F,
-    0xC0, 0x00, 0xBD, 0x3E, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40,
-    0x00, 0x3D, 0x7D, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xC0, 0x00,
-    0xFD, 0x0F, 0xD0, 0x0F, 0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4B, 0x40, 0x01, 0x40, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x2F, 0xFC, 0x00, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xFA, 0x90, 0xBF, 0xFF, 0xE0, 0x17, 0xF5, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x6F, 0xD0, 0x64, 0x0F, 0xFF, 0xF3, 0xD0, 0xFE, 0x56, 0xFF, 0x47, 0xE0, 0x01, 0xFD,
-    0x3F, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D,
-    0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x7D, 0x2F, 0x40,
-    0x03, 0xF4, 0x3F, 0x40, 0x2F, 0xD0, 0x7F, 0xFF, 0xDF, 0x40, 0x7F, 0xFD, 0x3D, 0x00, 0x05, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x0E, 0x50, 0x1F, 0xD0,
-    0x3F, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC1, 0xBF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x56, 0xFC, 0xBF, 0x40, 0x0B, 0xDB, 0xE0,
-    0x00, 0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x14, 0xBC, 0xBC, 0x28, 0x00, 0x00, 0x68,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x00,
-    0x14, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x01, 0xF8, 0xBF, 0xF0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x01, 0xA4, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF0, 0x0B,
-    0xC0, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0xBE, 0xFC, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0xBF, 0x2F, 0x40, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x80, 0xBC,
-    0x00, 0xBD, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0x64, 0x2F, 0xE4, 0x02, 0xFE, 0x42, 0xF3, 0xFF, 0xF8, 0x7F, 0xFF, 0x8B, 0xFE, 0x57, 0xFB,
-    0xD5, 0x7F, 0x6F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFE, 0xF4, 0x00,
-    0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0x00,
-    0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x64, 0x1F, 0xF8,
-    0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE4, 0x6F, 0xCB, 0xF0, 0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F,
-    0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x64, 0x1F, 0xE4, 0x02, 0xF3, 0xFF, 0xFC,
-    0x0B, 0xFE, 0x46, 0xFC, 0x2F, 0xC0, 0x02, 0xF4, 0xBE, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x0B, 0xCB,
-    0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x01, 0xF6, 0xF0, 0x00, 0x07, 0xDB, 0xC0,
-    0x00, 0x2F, 0x2F, 0x40, 0x00, 0xFC, 0xBF, 0x00, 0x07, 0xE2, 0xFF, 0x00, 0x7F, 0x0B, 0xEF, 0xFF,
-    0xF4, 0x2F, 0x1F, 0xFF, 0x00, 0xBC, 0x01, 0x40, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xD0, 0x64, 0x0F, 0xFF, 0xF3, 0xD0, 0xFE, 0x46, 0xFF, 0x47, 0xE0, 0x01, 0xFD, 0x3F,
-    0x00, 0x02, 0xF4, 0xF8, 0x00, 0x07, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D, 0x00,
-    0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD3, 0xD0, 0x00, 0x0F, 0x4F, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x03,
-    0xF4, 0x3F, 0x40, 0x3F, 0xD0, 0x7F, 0xFF, 0xDF, 0x40, 0x7F, 0xFD, 0x3D, 0x00, 0x05, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x64, 0x1B, 0xDB, 0x8B, 0xFD, 0xBE, 0xF9, 0x4B, 0xF8,
-    0x00, 0xBF, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0x02,
-    0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F, 0xEA, 0x9B, 0xFF,
-    0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00,
-    0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02,
-    0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x01, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00,
-    0x14, 0x00, 0x00, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0xF8, 0x1F, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF4, 0x0B,
-    0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x7D, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x68,
-    0x00, 0x0A, 0x80, 0x00, 0xA5, 0xF4, 0x00, 0x7F, 0x00, 0x07, 0xD3, 0xE0, 0x02, 0xFE, 0x00, 0x2F,
-    0x0F, 0xC0, 0x0F, 0xBC, 0x00, 0xF8, 0x2F, 0x00, 0x3C, 0xF0, 0x03, 0xD0, 0x7D, 0x02, 0xF3, 0xD0,
-    0x1F, 0x00, 0xF8, 0x0F, 0x8B, 0xC0, 0xBC, 0x02, 0xF0, 0x3C, 0x1F, 0x03, 0xE0, 0x07, 0xC1, 0xF0,
-    0x3D, 0x0F, 0x40, 0x0F, 0x4F, 0x80, 0xB8, 0x7C, 0x00, 0x3E, 0x3D, 0x01, 0xF2, 0xF0, 0x00, 0xBD,
-    0xF0, 0x03, 0xCF, 0x80, 0x01, 0xFB, 0x80, 0x0F, 0xBC, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0xF0, 0x00,
-    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x2A, 0x00, 0x01, 0xA0, 0x7D,
-    0x00, 0x0F, 0xC0, 0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x07, 0xD0, 0x01, 0xF8, 0x3E, 0x00, 0x02, 0xF3,
-    0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x7E, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x40, 0x2F, 0x00, 0x2F, 0x01,
-    0xF4, 0x00, 0x3F, 0x0F, 0x80, 0x00, 0x7E, 0xA8, 0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0,
-    0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x2F, 0x00, 0xBC, 0x00,
-    0xF8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x0F, 0x87, 0xC0,
-    0x00, 0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xB0, 0x00, 0x7F, 0xC0, 0x03, 0xF9, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFC, 0x00, 0x3F,
-    0x80, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xF8,
-    0x00, 0x0F, 0xF0, 0x00, 0x01, 0x80, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x39, 0x00, 0x00, 0xFF, 0x40, 0x01, 0xBF, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-    0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0xD0, 0x07, 0xE0, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x87, 0xFF, 0xFE, 0x6F, 0x2C, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x6A, 0x40,
-    0x7C, 0xFE, 0xFE, 0x7D, 0x00, 0x00, 0x24, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0xBD, 0xBD, 0xBD, 0xBD, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x7F, 0x90, 0x02, 0xFF, 0xFF, 0x02, 0xFE, 0x5B, 0x81, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0x01, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x3E, 0x40, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x7E, 0x00,
-    0xB4, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x15, 0xF9, 0x55, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x2A, 0xFE, 0xAA, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD5, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x18, 0x00, 0x00, 0x83, 0xE6, 0xFE, 0x3E,
-    0x1F, 0xFF, 0xFF, 0xC0, 0xBD, 0x02, 0xF0, 0x0F, 0x40, 0x0B, 0x80, 0xF0, 0x00, 0x3C, 0x1E, 0x00,
-    0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x0F, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x0F, 0xFA, 0xBF, 0x83,
-    0xFB, 0xFF, 0xBD, 0x2C, 0x05, 0x41, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x0F, 0x81, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x02, 0xF0, 0x00,
-    0xFC, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x3D, 0x2F, 0x00,
-    0x00, 0x0B, 0xDF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0A, 0xAF, 0xEA, 0x80, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x3C, 0x00, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xFF, 0x41, 0xFE, 0xAF, 0xD0, 0xFC, 0x00, 0x10,
-    0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xF0,
-    0x0B, 0xC0, 0xBF, 0x03, 0xD0, 0x03, 0xF0, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x0F, 0x0B, 0xE0, 0x0B,
-    0xC0, 0xBF, 0x9B, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xBC, 0x64, 0x00, 0x7E, 0x1F, 0xFF, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x2F, 0x03, 0xDB, 0xC0, 0xF4, 0x90, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40,
-    0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xFE, 0x40, 0xF0, 0x1D, 0x01, 0xFF, 0xFC, 0x07,
-    0x83, 0xC0, 0x3E, 0x01, 0x40, 0x2C, 0x38, 0x0B, 0xC0, 0x00, 0x01, 0xD7, 0x40, 0xF4, 0x00, 0x00,
-    0x0E, 0xB0, 0x0F, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xB0, 0x0F, 0x00, 0x00,
-    0x00, 0xF7, 0x40, 0xF4, 0x00, 0x00, 0x0E, 0x38, 0x0B, 0x80, 0x00, 0x01, 0xD3, 0xC0, 0x7D, 0x00,
-    0x00, 0x2C, 0x2D, 0x02, 0xFF, 0xFC, 0x03, 0xC0, 0xF0, 0x07, 0xFF, 0x40, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x3D, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xE9, 0xF8,
-    0x00, 0x0F, 0x00, 0x03, 0xC2, 0xFF, 0xF2, 0xE4, 0x3C, 0xF0, 0x0F, 0x3C, 0x07, 0xCB, 0xEF, 0xF0,
-    0xBE, 0x18, 0x00, 0x10, 0x05, 0x00, 0x3E, 0x03, 0xD0, 0x3F, 0x03, 0xE0, 0x2F, 0x03, 0xF0, 0x1F,
-    0x42, 0xF0, 0x1F, 0x42, 0xF4, 0x0B, 0xC0, 0xFC, 0x00, 0xFC, 0x0F, 0x80, 0x0F, 0x81, 0xF4, 0x01,
-    0xF4, 0x2F, 0x40, 0x1F, 0x42, 0xF0, 0x02, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x52, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0xFF,
-    0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xE5, 0xAF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x03, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0xF0, 0x2F, 0xF9, 0x00, 0xF0, 0x1D, 0x03, 0xFF, 0xF8, 0x07, 0x83, 0xC0, 0x3D, 0x0B, 0xC0,
-    0x2C, 0x38, 0x03, 0xD0, 0x3D, 0x01, 0xD7, 0x40, 0x3D, 0x03, 0xD0, 0x0E, 0xB0, 0x03, 0xD0, 0x7C,
-    0x00, 0xFB, 0x00, 0x3F, 0xFF, 0x40, 0x0F, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xF7, 0x40, 0x3D, 0x1F,
-    0x00, 0x0E, 0x38, 0x03, 0xD0, 0xF8, 0x01, 0xD3, 0xC0, 0x3D, 0x07, 0xC0, 0x2C, 0x2D, 0x03, 0xD0,
-    0x3E, 0x03, 0xC0, 0xF0, 0x3D, 0x00, 0xF4, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x95, 0x6F, 0xD0, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x1F, 0xAF, 0xC3, 0xC0, 0x2E, 0x78, 0x00, 0xF7, 0x80, 0x0F, 0x78,
-    0x00, 0xE3, 0xD0, 0x3D, 0x0F, 0xFF, 0x80, 0x2F, 0x90, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x01,
-    0x55, 0xF9, 0x55, 0x2F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAF, 0xEA, 0xA0, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xF8, 0x0F,
-    0xFF, 0xD2, 0x80, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x0B, 0xF9, 0x03, 0xFF, 0xF4,
-    0x24, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x16, 0xF0, 0x0B, 0xFD, 0x00, 0x01, 0xFC, 0x00,
-    0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xCB, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x2F, 0x80, 0xF8, 0x0F, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xEB, 0xF4, 0x02, 0xFE, 0xBF, 0xFF, 0xFA, 0xEB, 0xDF, 0xFD,
-    0x1E, 0xBC, 0x04, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF9, 0x7C, 0x1F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF,
-    0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF,
-    0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x2F, 0xFF, 0xF4, 0x2C, 0x0F, 0xFF,
-    0xF4, 0x2C, 0x02, 0xFF, 0xF4, 0x2C, 0x00, 0x04, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00,
-    0x74, 0x2C, 0x00, 0x00, 0x20, 0x18, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x0B, 0x00, 0x3C, 0x00, 0xBE,
-    0x00, 0x3C, 0x00, 0xF1, 0xAF, 0xCB, 0xF8, 0x00, 0x01, 0xA0, 0xBF, 0x3E, 0xFB, 0x4F, 0x00, 0xF0,
-    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0xFA, 0xBC, 0x0B, 0x40, 0x78, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F,
-    0x00, 0x3C, 0x2E, 0x02, 0xE0, 0x3F, 0xBF, 0x00, 0x1B, 0x90, 0x00, 0x10, 0x02, 0x00, 0x2F, 0x03,
-    0xE0, 0x03, 0xF0, 0x3E, 0x00, 0x3E, 0x07, 0xD0, 0x07, 0xE0, 0x7D, 0x00, 0x7D, 0x0B, 0xC0, 0x0F,
-    0xC0, 0xF8, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0, 0xFC, 0x07, 0xD0, 0xBC, 0x03, 0xE0, 0x7D, 0x01, 0xE0,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xB4, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-    0x00, 0x2F, 0x7C, 0x00, 0x03, 0xC0, 0x02, 0xC3, 0xC0, 0x00, 0xB8, 0x00, 0x00, 0x3C, 0x00, 0x1F,
-    0x00, 0x00, 0x03, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x03, 0xC0, 0x0F,
-    0x00, 0x00, 0x00, 0x3C, 0x02, 0xD0, 0x19, 0x00, 0x03, 0xC0, 0x7C, 0x03, 0xE0, 0x00, 0x3C, 0x0F,
-    0x40, 0xFE, 0x00, 0x03, 0xC2, 0xE0, 0x2E, 0xE0, 0x00, 0x28, 0x3C, 0x07, 0x9E, 0x00, 0x00, 0x0B,
-    0x40, 0xF2, 0xE0, 0x00, 0x01, 0xF0, 0x2C, 0x2E, 0x00, 0x00, 0x3C, 0x07, 0x82, 0xE0, 0x00, 0x0B,
-    0x80, 0xFA, 0xBF, 0x90, 0x00, 0xF0, 0x0F, 0xFF, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xD0, 0x00,
-    0x7F, 0x80, 0x00, 0x7C, 0x00, 0x2F, 0xB8, 0x00, 0x0F, 0x40, 0x03, 0x87, 0x80, 0x02, 0xE0, 0x00,
-    0x00, 0xB8, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x0B, 0x40, 0x00, 0x00, 0xB8, 0x01, 0xF0, 0x00,
-    0x00, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x81, 0xA9, 0x00, 0x0B, 0x80, 0xF1, 0xFF,
-    0xF4, 0x00, 0xB8, 0x3D, 0x1D, 0x07, 0xC0, 0x0B, 0x87, 0xC0, 0x00, 0x3C, 0x00, 0x64, 0xF0, 0x00,
-    0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x1E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x78, 0x07, 0xFA, 0xF4, 0x00, 0x03, 0xC0, 0x04,
-    0x01, 0xF0, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x0F, 0x00,
-    0x00, 0x6B, 0xE0, 0x00, 0xB8, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x01, 0xF0, 0x19, 0x00, 0x00, 0x3D, 0x0F, 0x00, 0xF8, 0x14, 0x01, 0xF0,
-    0xB8, 0x0F, 0xE0, 0xBF, 0xFF, 0x47, 0xC0, 0xBB, 0x80, 0x6F, 0xE0, 0x3D, 0x03, 0x9E, 0x00, 0x00,
-    0x01, 0xE0, 0x3C, 0x78, 0x00, 0x00, 0x0F, 0x02, 0xC1, 0xE0, 0x00, 0x00, 0xB8, 0x1E, 0x07, 0x80,
-    0x00, 0x07, 0xC0, 0xFA, 0xBF, 0x90, 0x00, 0x3D, 0x03, 0xFF, 0xFF, 0x80, 0x02, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x0B, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x90, 0x7F, 0xEB, 0xFC, 0x07, 0xFF,
-    0xFE, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x0F,
-    0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xFC,
-    0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xAA, 0xAA, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x0F,
-    0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x02,
-    0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xAA,
-    0xAA, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07,
-    0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x3E, 0xF0, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00,
-    0x03, 0xE0, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x1F, 0xAA, 0xAA, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03,
-    0xF0, 0x2F, 0x00, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x80, 0xD0, 0x00, 0x0B, 0xAF,
-    0xFF, 0x00, 0x00, 0x38, 0x0B, 0xF4, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00,
-    0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF,
-    0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x03,
-    0xF0, 0x7D, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B,
-    0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x00,
-    0x00, 0xF0, 0x74, 0x00, 0x00, 0x03, 0x80, 0xD0, 0x00, 0x00, 0x0B, 0x4B, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0x00,
-    0x00, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00,
-    0x3F, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x01, 0xFA, 0xAA, 0xAF, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0,
-    0x00, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xFA, 0xFD, 0x55, 0x54, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x55, 0x54, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x55, 0x54, 0x7D, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x03,
-    0xFF, 0xFF, 0xF4, 0x07, 0xFE, 0x41, 0xBC, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x68, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0xBD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F,
-    0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95,
-    0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F,
-    0xFE, 0x00, 0x0B, 0xC7, 0xD0, 0x0B, 0xC0, 0x3D, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x10, 0x00, 0xF4, 0x2F, 0x00, 0x3E, 0x0B, 0xC0, 0x06, 0x00, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x54, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF,
-    0xFD, 0xFF, 0xFE, 0x00, 0x15, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xC0, 0x03, 0xC0, 0x00, 0x40,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0xBF, 0xFE, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0,
-    0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40,
-    0x07, 0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x01, 0xF4, 0x0B, 0xFF, 0xD3,
-    0xFF, 0xF8, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x0B, 0xFE, 0x02, 0xF1, 0xF4, 0xBC, 0x03, 0xD5, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x2F, 0xFF, 0x43, 0xFF, 0xF8, 0x00, 0x01, 0x03, 0xD0, 0xBC, 0x3E, 0x0B, 0xC1,
-    0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01,
-    0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x40,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x5A, 0xFF, 0x40, 0x03, 0xE0, 0x00, 0x2F, 0xD0,
-    0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x17, 0xF5, 0x54, 0x00, 0x7D, 0x3F, 0xFF,
-    0xFC, 0x00, 0x7E, 0x3F, 0xFF, 0xF8, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x07,
-    0xF0, 0x03, 0xE0, 0x00, 0x1F, 0xD0, 0x03, 0xE5, 0x56, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x03, 0xFD, 0x07, 0x40, 0x00, 0xFB,
-    0xFF, 0xF0, 0x00, 0x0E, 0x03, 0xFD, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00,
-    0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0, 0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3,
-    0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F, 0xC0, 0x03, 0xD3, 0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8,
-    0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D, 0x3D, 0x00, 0x3F, 0x03, 0xD3, 0xD0, 0x02, 0xF4, 0x3D, 0x3D,
-    0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00, 0x7F, 0x3D, 0x3D, 0x00, 0x02, 0xF7, 0xD3, 0xD0, 0x00, 0x0F,
-    0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x02, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F,
-    0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC,
-    0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00,
-    0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F,
-    0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40,
-    0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00,
-    0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE,
-    0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F,
-    0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x0E, 0x00, 0x00, 0x1F, 0xBF, 0xFD,
-    0x00, 0x00, 0x3C, 0x0B, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07,
-    0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x02, 0x40,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x04, 0x00, 0x00, 0x43, 0xE0, 0x00,
-    0x3D, 0x1F, 0x80, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x3F, 0x07, 0xE0, 0x0F, 0xC0, 0x1F,
-    0x83, 0xF0, 0x00, 0x7D, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x0B, 0xFF, 0xE4, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x40, 0x7F, 0xD0, 0x07,
-    0xF0, 0x00, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0xF8, 0x1F, 0x80, 0x00, 0x7C, 0xFC, 0x2F, 0x00,
-    0x00, 0xF4, 0x7D, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x3E, 0x00, 0x0B, 0xC0, 0x3F, 0x3E, 0x00, 0x1F,
-    0x40, 0x3F, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0xBC, 0x00, 0x3F, 0x3E, 0x01, 0xF0, 0x00,
-    0x3F, 0x3F, 0x03, 0xE0, 0x00, 0x3E, 0x2F, 0x0F, 0xC0, 0x00, 0x7E, 0x1F, 0x5F, 0x00, 0x00, 0xBC,
-    0x0F, 0xFD, 0x00, 0x01, 0xFC, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xFE, 0x00, 0x2F, 0xD0, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0x8B, 0xFF, 0xF8, 0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00,
-    0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00,
-    0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4,
-    0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4,
-    0xFC, 0x00, 0x00, 0xBC, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC,
-    0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x10, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00,
-    0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40,
-    0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F,
-    0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00, 0xBC, 0x2F, 0x80, 0x00, 0x3F,
-    0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00,
-    0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00,
-    0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3,
-    0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00, 0xFC, 0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x3F, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3F, 0x7D,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFD, 0x03, 0xD0, 0x06, 0xFD, 0x0F, 0x40, 0x01, 0xFC, 0x3D, 0x00,
-    0x03, 0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0xFC, 0x3D, 0x00, 0x03,
-    0xE0, 0xF4, 0x00, 0x7F, 0x03, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0xFE, 0x00, 0x3E, 0x55, 0x40, 0x00,
-    0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x3F, 0x40, 0x1F, 0xC0, 0x7D,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x2F, 0x40, 0xBC,
-    0x00, 0xFD, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0xBC,
-    0x03, 0xF4, 0x00, 0xBC, 0x01, 0xFE, 0x00, 0xBC, 0x00, 0x7F, 0xC0, 0xBC, 0x00, 0x0B, 0xF0, 0xBC,
-    0x00, 0x01, 0xF8, 0xBC, 0x00, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x7C, 0xBC, 0x00, 0x00, 0xBC, 0xBC,
-    0x14, 0x00, 0xFC, 0xBC, 0x2F, 0xFF, 0xF0, 0xBC, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC,
-    0x7F, 0xE5, 0x6F, 0x3F, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F,
-    0x7E, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC, 0x7F, 0xE5,
-    0x6F, 0x3F, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F, 0x7E, 0x00,
-    0x7F, 0xCF, 0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xD3, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0x40, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC, 0x7F, 0xE5, 0x6F, 0x3F,
-    0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0xCF,
-    0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x50, 0x01, 0x00, 0xFF, 0x81, 0xD0,
-    0xBA, 0xFF, 0xF0, 0x38, 0x0B, 0xF4, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40,
-    0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F,
-    0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B,
-    0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0,
-    0xF0, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x3F, 0x07, 0xD0, 0x02, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90,
-    0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF,
-    0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0,
-    0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x2F, 0xBC, 0x00, 0x0E, 0x07, 0x40, 0x03, 0x80, 0xD0, 0x00, 0xF4, 0xB0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80,
-    0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC,
-    0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F,
-    0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00,
-    0x00, 0x01, 0xBF, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0xF9, 0x0B, 0xFF,
-    0xD1, 0xBD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x55, 0xFD, 0x55, 0x5F, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F,
-    0xF9, 0x5F, 0xEA, 0xAA, 0xA4, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xF8, 0x02, 0xF7, 0xE0,
-    0x01, 0xC3, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x02, 0xFF, 0xE0, 0x07, 0xFF, 0xF4, 0x00, 0x10, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0, 0xBF, 0x56, 0xD0, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF4, 0x01,
-    0x80, 0x7F, 0xFF, 0xF0, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xBE,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x1A, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46,
-    0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F,
-    0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02, 0xFF,
-    0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03, 0xF7,
-    0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x1F, 0x4F, 0xC0, 0x03, 0xD0, 0x2E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E,
-    0x3E, 0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80,
-    0x3F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x00, 0x2F, 0x03,
-    0xD0, 0x02, 0xF0, 0x3D, 0x00, 0x09, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03,
-    0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18,
-    0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x15, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0xF8, 0x00, 0xF4, 0x00, 0x50, 0x00, 0x00, 0x68, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0,
-    0x0B, 0xC0, 0x2F, 0x00, 0x01, 0x50, 0x1F, 0x80, 0xFC, 0x0B, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x00,
-    0x1A, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00,
-    0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x14, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xF1, 0xF4, 0x2E, 0x01, 0xF4, 0x50, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC,
-    0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x0F,
-    0x42, 0xE7, 0xD0, 0xFC, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0B, 0xC0, 0x02,
-    0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B,
-    0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0xC0, 0x00, 0x7F, 0xAF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x6B, 0xA1, 0xF0, 0x02, 0xFF, 0xFE, 0xF4, 0x0F, 0xE5, 0x5F, 0xF8, 0x2F,
-    0x40, 0x02, 0xFC, 0x3E, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x7C, 0x00, 0x00, 0xBC, 0x7C,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x01, 0xF0, 0x0F,
-    0xD0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x50, 0x01, 0x00, 0x3F, 0xD0, 0x70, 0x0F, 0xBF, 0xFF, 0x00, 0xD0, 0x7F, 0xC0, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE4, 0x6F, 0xCB, 0xF0,
-    0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x02, 0xE0, 0x1F, 0x40,
-    0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x14, 0x00, 0x40,
-    0x01, 0xFF, 0x42, 0xC0, 0x03, 0xEF, 0xFF, 0x80, 0x07, 0x41, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xF4, 0x2F, 0x00,
-    0x00, 0xF4, 0x2F, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0,
-    0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8,
-    0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE4,
-    0xF4, 0x02, 0xFF, 0xFF, 0xF0, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x0F, 0xF0, 0x3F, 0x00, 0x2F,
-    0xF4, 0x3E, 0x00, 0x7C, 0xF8, 0x7D, 0x00, 0xF4, 0xBC, 0x7D, 0x03, 0xE0, 0xBC, 0x7D, 0x0B, 0xC0,
-    0xBC, 0x7D, 0x1F, 0x00, 0xBC, 0x3D, 0x3D, 0x00, 0xFC, 0x3F, 0xF8, 0x00, 0xF8, 0x1F, 0xF0, 0x02,
-    0xF0, 0x0F, 0xE0, 0x0B, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xBF, 0xFD, 0x00, 0x08, 0x01, 0x40,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x29, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF,
-    0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F, 0xE2, 0xFF,
-    0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x2F, 0x1F, 0x80, 0x07, 0xC0, 0x3D, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F,
-    0x40, 0x3F, 0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3,
-    0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F,
-    0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x07, 0xF9, 0x00, 0xBC, 0xFF, 0xFF,
-    0x02, 0xFF, 0x91, 0xBF, 0x0B, 0xF0, 0x00, 0xBD, 0x2F, 0x80, 0x00, 0xFC, 0xBD, 0x00, 0x02, 0xF2,
-    0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x01, 0xF6, 0xF0,
-    0x00, 0x0B, 0xCB, 0xE0, 0x00, 0x3F, 0x2F, 0xC0, 0x01, 0xF8, 0xBF, 0xC0, 0x1F, 0xC2, 0xFB, 0xFF,
-    0xFD, 0x0B, 0xC7, 0xFF, 0xC0, 0x2F, 0x00, 0x50, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x24, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x0A, 0x6F, 0x00, 0x00, 0x7D, 0x3E, 0x00,
-    0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x7D, 0x03, 0xE0, 0x02, 0xF0, 0x0B, 0xC0, 0x0F,
-    0x80, 0x0F, 0x40, 0x7C, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xF8, 0x7C, 0x00,
-    0x02, 0xF3, 0xE0, 0x00, 0x03, 0xDF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x80, 0x15, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF, 0xC0,
-    0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3, 0xFF,
-    0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x90, 0x00, 0x00, 0xE0,
-    0x07, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3,
-    0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00,
-    0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00,
-    0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1,
-    0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x02, 0x00, 0x09, 0x00, 0xE0, 0x07,
-    0x80, 0x2F, 0xFF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE,
-    0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00,
-    0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF,
-    0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x50, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0xAF, 0xE4, 0x00, 0xBF, 0xFF,
-    0xE0, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x01, 0x5B, 0xC0, 0x2F, 0xFF, 0xFC, 0x1F, 0xF9, 0x5B, 0xC3, 0xF0, 0x00, 0xBC, 0xBC, 0x00, 0x0B,
-    0xCB, 0xC0, 0x00, 0xFC, 0xBC, 0x00, 0x1F, 0xC7, 0xE0, 0x07, 0xFC, 0x3F, 0xFF, 0xF7, 0xC0, 0xBF,
-    0xF8, 0x3C, 0x00, 0x10, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x3E, 0x50, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD, 0x5B, 0x41, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x90, 0x06, 0x80, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xD3, 0xF0, 0x03, 0xD0,
-    0x2E, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD,
-    0x5B, 0x41, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xD0, 0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0x90, 0x6F, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x1A, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFC,
-    0x0B, 0xF5, 0x6D, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x18, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x14,
-    0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xE4, 0x1B, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x06, 0x80,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0xF4, 0x0B, 0x80, 0x1F, 0x4F, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x02, 0xFF, 0xFF, 0x02, 0xFD, 0x5B, 0x41, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xD0,
-    0x06, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x0F, 0x40, 0x7C, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x03, 0xE5, 0x5A, 0xFF, 0x40, 0x3D, 0x00, 0x01, 0xFD, 0x03, 0xD0, 0x00, 0x07,
-    0xF0, 0x3D, 0x00, 0x00, 0x1F, 0x83, 0xD0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0,
-    0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x00, 0x7E, 0x3D, 0x00, 0x00, 0x07,
-    0xD3, 0xD0, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0xFC, 0x3D, 0x00,
-    0x00, 0x1F, 0x83, 0xD0, 0x00, 0x07, 0xF0, 0x3D, 0x00, 0x01, 0xFD, 0x03, 0xE5, 0x56, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x00, 0x00,
-    0xF4, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x6F, 0xD0, 0xF4,
-    0x00, 0x03, 0xFF, 0xFC, 0xF4, 0x00, 0x0F, 0xE4, 0x6F, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xF4, 0x00,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x7D,
-    0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF4, 0x00, 0x3D, 0x00,
-    0x00, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x0F,
-    0xF4, 0x00, 0x07, 0xFF, 0xFD, 0xF4, 0x00, 0x01, 0xFF, 0xF4, 0xB4, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF5, 0x5A, 0xFF, 0x40,
-    0x03, 0xE0, 0x00, 0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x03,
-    0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x17, 0xF5,
-    0x54, 0x00, 0x7D, 0x3F, 0xFF, 0xFC, 0x00, 0x7E, 0x3F, 0xFF, 0xF8, 0x00, 0x7D, 0x03, 0xE0, 0x00,
-    0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x01,
-    0xF8, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x03, 0xE0, 0x00, 0x1F, 0xD0, 0x03, 0xE5, 0x56, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2A, 0xAB, 0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-    0x01, 0x55, 0x7E, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xBE, 0x43, 0xD0, 0x03, 0xFF, 0xFC, 0xF4,
-    0x03, 0xFD, 0x5B, 0xFD, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x01,
-    0xF4, 0x1F, 0x40, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x03, 0xD0, 0x7D, 0x00,
-    0x00, 0xF4, 0x0F, 0x40, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x0B, 0xF4, 0x01, 0xFF, 0xFF, 0x7D, 0x00, 0x1F, 0xFF, 0x4B, 0x40, 0x00, 0x14, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00,
-    0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x06, 0x00, 0x08, 0x01,
-    0xD0, 0x0B, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF,
-    0xD3, 0xFF, 0xFF, 0xF4, 0x02, 0x00, 0x05, 0x00, 0x38, 0x01, 0xE0, 0x02, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0,
-    0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55,
-    0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E,
-    0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC,
-    0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA,
-    0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x7D, 0x40, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0,
-    0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55,
-    0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFC, 0x00, 0x01, 0x5F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0xBD, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x05, 0x00, 0x05, 0x02, 0xF0, 0x0F,
-    0x40, 0x2F, 0x1F, 0x40, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5, 0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x01, 0x00, 0x05, 0x00, 0x3D, 0x02, 0xF0, 0x01, 0xF4, 0xFC, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x40, 0x02, 0xFF, 0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E,
-    0x00, 0x03, 0xF7, 0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x0B, 0x80, 0x7D,
-    0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0xE0, 0x03, 0xFE, 0x40, 0x6F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0,
-    0x00, 0x3F, 0xFF, 0x0F, 0x80, 0x00, 0x55, 0xBC, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00,
-    0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x2F, 0x03, 0xF4, 0x00, 0x00, 0xBC, 0x07, 0xF4, 0x00, 0x02, 0xF0,
-    0x0B, 0xF9, 0x00, 0x1B, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3E,
-    0x2F, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4,
-    0x19, 0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x95, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0xBD,
-    0x3E, 0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D,
-    0x00, 0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xFD, 0x0F, 0xD0,
-    0x0B, 0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4F, 0x40, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0x94, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0x40,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x2D, 0x00, 0xB0, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x90, 0x1B, 0xC0, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0, 0x00, 0x15, 0x6F, 0x0F, 0xC0,
-    0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x00, 0x00,
-    0x2F, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x40, 0x06, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x06, 0x00, 0x0B, 0x00, 0x3C,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFD, 0x06, 0x40, 0xFF, 0xFF, 0x3D, 0x0F, 0xE5, 0x6F, 0xF4, 0x7E, 0x00, 0x1F, 0xD3, 0xF0,
-    0x00, 0x2F, 0x4F, 0x80, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00,
-    0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x3F,
-    0x43, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xFD, 0xF4, 0x07, 0xFF, 0xD3, 0xD0, 0x00, 0x50, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xE5, 0x01, 0xFD, 0x03, 0xFF,
-    0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0x90, 0x1B,
-    0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xE0, 0x00, 0x15, 0x6F,
-    0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x02, 0xF0, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0xFD,
-    0x00, 0x00, 0x2F, 0x01, 0xFD, 0x00, 0x00, 0xBC, 0x02, 0xFE, 0x40, 0x06, 0xF0, 0x01, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFD, 0x06, 0x40, 0xFF, 0xFF, 0x3D, 0x0F, 0xE5, 0x6F, 0xF4, 0x7E, 0x00, 0x1F,
-    0xD3, 0xF0, 0x00, 0x2F, 0x4F, 0x80, 0x00, 0x7D, 0x7D, 0x00, 0x00, 0xF5, 0xF4, 0x00, 0x03, 0xD7,
-    0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x07, 0xD2, 0xF4,
-    0x00, 0x3F, 0x43, 0xF4, 0x02, 0xFD, 0x07, 0xFF, 0xFD, 0xF4, 0x07, 0xFF, 0xD3, 0xD0, 0x00, 0x50,
-    0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xE5, 0x01, 0xFD,
-    0x03, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xE4, 0x06, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF,
-    0xFC, 0x3E, 0x00, 0x03, 0xFF, 0xF0, 0xF8, 0x00, 0x05, 0x5B, 0xC3, 0xF0, 0x00, 0x00, 0x2F, 0x0B,
-    0xC0, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xC0, 0x7F, 0x40,
-    0x00, 0x2F, 0x00, 0xBF, 0x90, 0x01, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x19,
-    0x03, 0xFF, 0xFC, 0xF4, 0x3F, 0x95, 0xBF, 0xD1, 0xF8, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0xBD, 0x3E,
-    0x00, 0x01, 0xF5, 0xF4, 0x00, 0x03, 0xD7, 0xD0, 0x00, 0x0F, 0x5F, 0x40, 0x00, 0x3D, 0x7D, 0x00,
-    0x00, 0xF4, 0xF4, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xFD, 0x0F, 0xD0, 0x0B,
-    0xF4, 0x1F, 0xFF, 0xF7, 0xD0, 0x1F, 0xFF, 0x4F, 0x40, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0x94, 0x07, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0x1B,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xBC, 0x7D, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x2E, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00,
-    0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0,
-    0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xE5, 0x55, 0x55, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03,
-    0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00,
-    0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0x2E, 0x01, 0xF4, 0x00,
-    0x01, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x1B, 0xF8, 0x00, 0x0B, 0xCF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xC0, 0x0B, 0xF4, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x03, 0xE0,
-    0x0B, 0xD0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00,
-    0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x00,
-    0x3E, 0x03, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00,
-    0xFC, 0x05, 0x7E, 0x55, 0x55, 0x5F, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3E, 0x55,
-    0x55, 0x5F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x6F, 0xEA, 0xA8, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x5B, 0xD5, 0x54, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x0B, 0xC0, 0x14, 0x00, 0x0B, 0xC7, 0xFF, 0xE0, 0x0B, 0xDF, 0xFF, 0xF8, 0x0B, 0xFC, 0x00,
-    0xFC, 0x0B, 0xF0, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00, 0x3E, 0x0B, 0xC0, 0x00,
-    0x3E, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x0B, 0xFF, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x0B, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xE0, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xF8, 0x70, 0x1F, 0xF0, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4,
-    0x3F, 0xFF, 0x80, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x15, 0x55, 0x40, 0x00, 0x00, 0x01, 0xA0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0x02, 0xF0, 0x00, 0x2F, 0x00, 0x60, 0x00, 0x97, 0x40, 0x2D, 0x3F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x82, 0xFF, 0xF8, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x02, 0xFF, 0xF4, 0x3F, 0xFF, 0x80, 0x50, 0x00, 0x8B, 0x00, 0x3C, 0x3F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00,
-    0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00,
-    0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0xB4, 0x01, 0xE0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xE5, 0x02, 0xFE, 0x00, 0x14, 0x01, 0x40, 0xBC, 0x0B, 0xC0, 0x28, 0x00, 0x00,
-    0x00, 0x06, 0x80, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC,
-    0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0B, 0x41, 0xE0, 0x3C, 0x03, 0xC0, 0x3E,
-    0x52, 0xFE, 0x01, 0x40, 0x01, 0x40, 0x07, 0xD0, 0x07, 0xD0, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
-    0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x68, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBF, 0xFE, 0x01, 0xF2, 0xFF, 0xF8,
-    0x07, 0xC0, 0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07,
-    0xC0, 0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0,
-    0x7D, 0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0x7D,
-    0x00, 0x1F, 0x01, 0xF4, 0x00, 0x7C, 0x07, 0xD0, 0x01, 0xF0, 0x1F, 0x40, 0x07, 0xC0, 0x7D, 0x00,
-    0x1F, 0x2F, 0xFF, 0x40, 0x7C, 0xFF, 0xFE, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x14, 0x00, 0x52, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xCA, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x0A, 0x6F, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00,
-    0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0,
-    0x03, 0xEB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xD0, 0x04, 0x3F, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0x80,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xBF, 0xE0, 0x02, 0xF1, 0xF8, 0x07, 0xC0, 0x3D, 0x05,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40,
-    0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00,
-    0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0xFD, 0x00,
-    0x7F, 0xF4, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x14, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xF1,
-    0xF4, 0x2E, 0x01, 0xF4, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x7E, 0x00, 0xBF, 0xF0, 0x01, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00,
-    0xBE, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40,
-    0x3F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0xF4, 0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F,
-    0x6F, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00,
-    0x0F, 0x40, 0xBE, 0x00, 0x03, 0xD0, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x1F,
-    0xC0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0, 0x00, 0x3F, 0x40, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x01, 0xA4, 0xBC, 0x00, 0x3F, 0x0B,
-    0xC0, 0x0F, 0xC0, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0xFC, 0x00, 0xBC, 0x3F, 0x00, 0x0B, 0xCF, 0xC0,
-    0x00, 0xBE, 0xFC, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xBF, 0x2F, 0x40, 0x0B, 0xC0, 0xFC, 0x00, 0xBC,
-    0x03, 0xF0, 0x0B, 0xC0, 0x1F, 0x80, 0xBC, 0x00, 0xBD, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x68, 0x00, 0x1A, 0x4B, 0xC0, 0x03, 0xF0,
-    0xBC, 0x00, 0xFC, 0x0B, 0xC0, 0x3F, 0x00, 0xBC, 0x0B, 0xD0, 0x0B, 0xC2, 0xF4, 0x00, 0xBC, 0x7E,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x0B, 0xF5, 0xF8, 0x00, 0xBD, 0x0B, 0xD0, 0x0B,
-    0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF8, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0xFC, 0x01, 0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x01, 0x50, 0x1F, 0x80,
-    0xFC, 0x0B, 0xC0, 0x7C, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0xC2, 0xF0,
-    0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0xB8, 0x3C,
-    0x04, 0x00, 0x3D, 0x00, 0x0F, 0x4F, 0x40, 0x03, 0xC3, 0xD0, 0x01, 0xF0, 0xF4, 0x00, 0xB4, 0x3D,
-    0x00, 0x38, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3D, 0xBC, 0x3C, 0xBC,
-    0x74, 0xBC, 0x50, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x50, 0x0F, 0x40, 0x3E, 0x03, 0xD0, 0x1F, 0x80, 0xF4, 0x02, 0x80, 0x3D, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x10,
-    0xBC, 0xBC, 0xBC, 0xFC, 0xBC, 0x64, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x0F, 0xBF, 0xC0, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x00,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x40, 0x2F, 0xF4,
-    0x0B, 0xFC, 0x03, 0xF8, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x3F,
-    0x80, 0x00, 0x03, 0xD3, 0xFD, 0x00, 0x00, 0x3D, 0x3F, 0xF0, 0x00, 0x03, 0xD3, 0xDF, 0x80, 0x00,
-    0x3D, 0x3C, 0xBD, 0x00, 0x03, 0xD3, 0xC3, 0xF0, 0x00, 0x3D, 0x3C, 0x1F, 0x80, 0x03, 0xD3, 0xC0,
-    0xFC, 0x00, 0x3D, 0x3D, 0x03, 0xF0, 0x03, 0xD3, 0xD0, 0x1F, 0x80, 0x3D, 0x3D, 0x00, 0xFC, 0x03,
-    0xD3, 0xD0, 0x03, 0xF0, 0x3D, 0x3D, 0x00, 0x2F, 0x43, 0xD3, 0xD0, 0x00, 0xFC, 0x3D, 0x3D, 0x00,
-    0x07, 0xF3, 0xD3, 0xD0, 0x00, 0x2F, 0x7D, 0x3D, 0x00, 0x00, 0xFF, 0xD3, 0xD0, 0x00, 0x07, 0xFD,
-    0x3D, 0x00, 0x00, 0x2F, 0xD3, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x54, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x41, 0xFF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x46, 0xFC, 0xBF, 0x00, 0x0B, 0xDB,
-    0xE0, 0x00, 0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8,
-    0x00, 0x00, 0x3D, 0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03,
-    0xD3, 0xCB, 0xD0, 0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0F,
-    0xC0, 0x03, 0xD3, 0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0F, 0xC0, 0x3D,
-    0x3D, 0x00, 0x3F, 0x03, 0xD3, 0xD0, 0x02, 0xF4, 0x3D, 0x3D, 0x00, 0x0F, 0xC3, 0xD3, 0xD0, 0x00,
-    0x7F, 0x3D, 0x3D, 0x00, 0x02, 0xF7, 0xD3, 0xD0, 0x00, 0x0F, 0xFD, 0x3D, 0x00, 0x00, 0x7F, 0xD3,
-    0xD0, 0x00, 0x02, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF,
-    0xE4, 0x6F, 0xCB, 0xF0, 0x00, 0xBD, 0xBE, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x07, 0xC0,
-    0x3E, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x3F, 0x80, 0x00,
-    0x03, 0xD3, 0xFD, 0x00, 0x00, 0x3D, 0x3F, 0xF0, 0x00, 0x03, 0xD3, 0xDF, 0x80, 0x00, 0x3D, 0x3C,
-    0xBD, 0x00, 0x03, 0xD3, 0xC3, 0xF0, 0x00, 0x3D, 0x3C, 0x1F, 0x80, 0x03, 0xD3, 0xC0, 0xFC, 0x00,
-    0x3D, 0x3D, 0x03, 0xF0, 0x03, 0xD3, 0xD0, 0x1F, 0x80, 0x3D, 0x3D, 0x00, 0xFC, 0x03, 0xD3, 0xD0,
-    0x03, 0xF0, 0x3D, 0x3D, 0x00, 0x2F, 0x43, 0xD3, 0xD0, 0x00, 0xFC, 0x3D, 0x3D, 0x00, 0x07, 0xF3,
-    0xD3, 0xD0, 0x00, 0x2F, 0x7D, 0x3D, 0x00, 0x00, 0xFF, 0xD3, 0xD0, 0x00, 0x07, 0xFD, 0x3D, 0x00,
-    0x00, 0x2F, 0xD3, 0xD0, 0x00, 0x00, 0xFD, 0x05, 0x00, 0x05, 0x00, 0x7C, 0x03, 0xD0, 0x02, 0xF0,
-    0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x41, 0xFF, 0x80, 0xBC, 0xFF, 0xFF, 0x4B, 0xFE, 0x46, 0xFC, 0xBF, 0x00, 0x0B, 0xDB, 0xE0, 0x00,
-    0x3E, 0xBD, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x86,
-    0x41, 0xBF, 0x80, 0xF4, 0x7C, 0xFF, 0xFF, 0x45, 0x07, 0xFE, 0x46, 0xFC, 0x00, 0x7F, 0x40, 0x07,
-    0xD0, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C,
-    0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E,
-    0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x07, 0xC0,
-    0x00, 0x3E, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D,
-    0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D, 0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0,
-    0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8, 0x00, 0x3D, 0x3C, 0x0B, 0xD0, 0x03, 0xD3,
-    0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3, 0xD0, 0x0B, 0xD0, 0x3D, 0x3D, 0x00, 0x3F,
-    0x03, 0xD3, 0xD0, 0x00, 0xF8, 0x3D, 0x3D, 0x00, 0x0B, 0xD3, 0xD3, 0xD0, 0x00, 0x3F, 0x3D, 0x3D,
-    0x00, 0x00, 0xFB, 0xD3, 0xD0, 0x00, 0x07, 0xFD, 0x3D, 0x00, 0x00, 0x3F, 0xD3, 0xD0, 0x00, 0x00,
-    0xFD, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x64, 0x1F, 0xF8, 0x0B, 0xCF, 0xFF, 0xF4, 0xBF, 0xE5, 0x6F, 0xCB, 0xF0, 0x00, 0x7D, 0xBE,
-    0x00, 0x03, 0xEB, 0xD0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0,
-    0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x00, 0x0F, 0x00,
-    0x78, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0xD0, 0x0B, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4,
-    0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC,
-    0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x02, 0xF0, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0xF4, 0x00, 0x00,
-    0x0F, 0x42, 0xE0, 0x00, 0x00, 0x2E, 0x07, 0x80, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40,
-    0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00,
-    0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x15, 0x05, 0x40, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0xFC, 0x2F, 0x00, 0x01, 0xF0, 0x7C,
-    0x00, 0x03, 0xC0, 0xF0, 0x00, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01,
-    0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xF9, 0x01, 0xFD, 0x55, 0x54, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x3E, 0x00, 0x00, 0x2F,
-    0x55, 0x54, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xFD, 0x55, 0x54, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE4, 0x00, 0xBF, 0x90, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x0B, 0xE4,
-    0x6F, 0xCF, 0xD1, 0xBE, 0x01, 0xF4, 0x00, 0x7F, 0xF0, 0x01, 0xF4, 0x3F, 0x00, 0x02, 0xFC, 0x00,
-    0x0F, 0x83, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xFD, 0x55, 0x5F, 0xC7, 0xD0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x7D, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x87, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0xF8, 0x00, 0x64, 0x03, 0xFF, 0xFF, 0x47,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0x80, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0,
-    0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0,
-    0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00,
-    0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0,
-    0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD,
-    0x00, 0x05, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00, 0xF0, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x06, 0x41, 0xBD, 0xB8, 0xBF, 0xDB, 0xEF, 0x94, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0xBD, 0x00,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3E, 0x56, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00,
-    0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00,
-    0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00, 0x3D, 0x00,
-    0xFC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D, 0x00,
-    0x07, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x19, 0x06, 0xF4, 0xB8, 0xBF, 0xD2,
-    0xFB, 0xE5, 0x0B, 0xF8, 0x00, 0x2F, 0xC0, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00,
-    0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0,
-    0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x07, 0xC0,
-    0x3E, 0x00, 0x02, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3E, 0x56,
-    0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00,
-    0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03, 0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x56, 0xF4, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x3D, 0x00,
-    0x3E, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x3D, 0x00,
-    0x03, 0xF0, 0x3D, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBD, 0x50, 0x00, 0x57, 0xC0, 0x3D, 0x2F,
-    0x0F, 0x80, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x41, 0xBD, 0xB8, 0xBF,
-    0xDB, 0xEF, 0x94, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xC0,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0,
-    0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00,
-    0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0x4F, 0xC0,
-    0x03, 0xD0, 0x2E, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF,
-    0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF,
-    0x80, 0x0B, 0xC7, 0xE0, 0x1F, 0x00, 0xF4, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0,
-    0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD, 0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x2D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x1A,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD,
-    0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x7C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x07, 0xC0, 0x00, 0x07, 0xC0, 0x02, 0xAF, 0x40, 0x03, 0xFD, 0x00, 0x01, 0x00, 0x05, 0x00, 0x3D,
-    0x02, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xC1, 0xFD, 0x05, 0xB8, 0x3F, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xDB, 0x90, 0x06, 0xFC, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x14, 0x00,
-    0x00, 0x14, 0x00, 0x14, 0x1F, 0x00, 0xF4, 0x0B, 0xC3, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x1F, 0xFF, 0xFC, 0x3F, 0x41, 0xBC, 0x7C,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xBF,
-    0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x64, 0x00, 0xBD,
-    0x7F, 0xFF, 0xF8, 0x2F, 0xFF, 0xD0, 0x00, 0x50, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x1A, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0,
-    0x00, 0x3D, 0x00, 0x1F, 0xEA, 0x9B, 0xFF, 0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D,
-    0x00, 0x03, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x2D, 0x00, 0x03, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x1A, 0xFC, 0x02, 0xFE, 0x00, 0x01, 0x40, 0x01,
-    0x40, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x7D, 0x3E, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x01, 0xD0, 0x0B, 0x00, 0x3D,
-    0x00, 0x50, 0x03, 0xD0, 0x00, 0x01, 0xFE, 0xA9, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xBE, 0x55, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x10,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x6A, 0xAB, 0xEA, 0xA9, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x06, 0xAB, 0xFA, 0x90, 0x0B, 0xFF, 0xFF, 0xE0, 0x06, 0xAB, 0xEA,
-    0x90, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1F,
-    0xEA, 0x9B, 0xFF, 0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x7F, 0xFF,
-    0xE3, 0xFF, 0xFD, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xD0, 0x00,
-    0x3F, 0x00, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x2F,
-    0xF4, 0x3C, 0x00, 0x0F, 0xBF, 0xFE, 0x00, 0x0B, 0x01, 0xFF, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00, 0xFC,
-    0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x50, 0x01, 0x00, 0x3F, 0xD0, 0x70, 0x0F, 0xBF, 0xFF, 0x00, 0xD0, 0x7F, 0xC0, 0x04,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E,
-    0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9,
-    0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00,
-    0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0,
-    0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xD0, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE,
-    0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x01, 0x80, 0x00,
-    0x2C, 0x00, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x8F, 0x40, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x02, 0xF0, 0xBE, 0x00, 0x00,
-    0xFC, 0x0F, 0xE4, 0x02, 0xFC, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x06, 0x00, 0x09, 0x00, 0x74, 0x02, 0xD0, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x01, 0xC0, 0xF0, 0x00,
-    0x00, 0xB0, 0x3C, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00,
-    0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0,
-    0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7,
-    0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03,
-    0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00,
-    0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xAE, 0x00, 0x00, 0xE0, 0xB0, 0x00, 0x0D, 0x07,
-    0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE,
-    0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05, 0x41, 0x50, 0x00,
-    0x07, 0xD1, 0xF8, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x02, 0xE0, 0x7C, 0x00, 0x00, 0xE0, 0x3C, 0x00,
-    0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0xF4, 0xFC, 0x00, 0x00,
-    0xBC, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF9, 0x00, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x0F, 0x83, 0xF0, 0x02, 0xF0,
-    0xBC, 0x00, 0x7C, 0x0F, 0x40, 0x0F, 0x03, 0xD0, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x29, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00,
-    0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0xFE, 0x3F, 0x40, 0x3F,
-    0xE2, 0xFF, 0xFF, 0xBE, 0x07, 0xFF, 0xD2, 0xE0, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x9F,
-    0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D, 0x3F,
-    0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x05, 0x40, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E,
-    0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00,
-    0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3,
-    0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x07, 0x80, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x50, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xF4,
-    0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0xF7, 0xC0, 0x00, 0xF8, 0x0F, 0x40, 0x07, 0xCF, 0x40, 0x07, 0xD0, 0x3E, 0x00, 0x2E, 0x2E, 0x00,
-    0x2F, 0x00, 0xBC, 0x00, 0xF4, 0x7C, 0x00, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0xF4, 0x03, 0xE0, 0x03,
-    0xD0, 0x2F, 0x03, 0xE0, 0x1F, 0x40, 0x0F, 0x80, 0xF8, 0x0B, 0xC0, 0xBC, 0x00, 0x2F, 0x03, 0xD0,
-    0x1F, 0x03, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x40, 0x00, 0xF4, 0xF8, 0x00, 0xBC, 0x7C,
-    0x00, 0x03, 0xE3, 0xD0, 0x01, 0xF2, 0xF0, 0x00, 0x0B, 0xDF, 0x00, 0x03, 0xDF, 0x80, 0x00, 0x1F,
-    0xBC, 0x00, 0x0F, 0xBD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x02, 0xA0, 0x00, 0x29, 0x7D, 0x00,
-    0x1F, 0xC0, 0x01, 0xF4, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xC3, 0xF0, 0x03, 0xEF, 0x00, 0x3E, 0x0B,
-    0xC0, 0x0F, 0x3C, 0x00, 0xF4, 0x1F, 0x40, 0xBC, 0xF4, 0x07, 0xC0, 0x3E, 0x03, 0xE2, 0xF0, 0x2F,
-    0x00, 0xBC, 0x0F, 0x07, 0xC0, 0xF8, 0x01, 0xF0, 0x7C, 0x0F, 0x43, 0xD0, 0x03, 0xD3, 0xE0, 0x2E,
-    0x1F, 0x00, 0x0F, 0x8F, 0x40, 0x7C, 0xBC, 0x00, 0x2F, 0x7C, 0x00, 0xF3, 0xE0, 0x00, 0x7E, 0xE0,
-    0x03, 0xEF, 0x00, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0xF8, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0xBC, 0x02, 0xF0,
-    0x00, 0x0F, 0x80, 0xF8, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x04,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4, 0xF8, 0x00,
-    0x0B, 0xC2, 0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F, 0x00, 0x3E,
-    0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1, 0xF0, 0x00,
-    0x0B, 0xCF, 0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x2F, 0x03, 0xC0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x2F,
-    0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xFD, 0xF4,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xF5, 0xAA, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF9, 0x55,
-    0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x07, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0,
-    0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFD, 0x6A, 0xAA, 0xAB, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x01, 0x00, 0x01, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF5, 0xAA, 0xAA, 0xAF, 0xC0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF9, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x14,
-    0x00, 0x14, 0x2E, 0x00, 0xF4, 0x0B, 0xC7, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0xFE, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFD, 0x15, 0x55, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xF4, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x14, 0x02, 0xFF, 0xD2, 0xFF, 0xF0, 0xFC, 0x00, 0x7D, 0x00, 0x1F,
-    0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0xFE, 0x40, 0x2F, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xF8, 0x02,
-    0xFE, 0x40, 0x6F, 0xDB, 0xC0, 0x1F, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xD0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x02, 0xFF, 0x40, 0x7C, 0x02, 0xFF, 0xFF, 0x4F, 0x80, 0xBE, 0x55, 0xFF, 0xF0, 0x1F, 0x80, 0x03,
-    0xF8, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D,
-    0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF4, 0x02, 0xFE, 0x41, 0xBF, 0xFD, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E,
-    0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x02,
-    0xF4, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00,
-    0x3E, 0x03, 0xFD, 0x00, 0x7F, 0x80, 0x00, 0x3E, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00,
-    0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4,
-    0x07, 0xF8, 0x00, 0x2F, 0xFF, 0xE3, 0xFF, 0xF0, 0x0F, 0xE5, 0x6F, 0xF9, 0x6F, 0x81, 0xF8, 0x00,
-    0xBD, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE0, 0x07, 0xC3, 0xE0, 0x00, 0x2F, 0x00, 0x7D, 0x7D, 0x00,
-    0x01, 0xF0, 0x07, 0xD7, 0xD0, 0x00, 0x1F, 0x40, 0x7D, 0x7D, 0x00, 0x01, 0xF4, 0x07, 0xD7, 0xD0,
-    0x00, 0x1F, 0x40, 0x7D, 0x3D, 0x00, 0x02, 0xF0, 0x07, 0xD3, 0xF0, 0x00, 0x3F, 0x00, 0x7D, 0x2F,
-    0x40, 0x07, 0xE0, 0x07, 0xD0, 0xFD, 0x01, 0xFC, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xD0,
-    0x0B, 0xFF, 0x80, 0x00, 0x7D, 0x00, 0x01, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x0B, 0xFF, 0xFF, 0xA4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xE7, 0xF5, 0x5B, 0xFD, 0x2E, 0x0F, 0xC0, 0x01, 0xFC, 0xB8,
-    0x3F, 0x00, 0x02, 0xF4, 0x50, 0xFC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x0F, 0xC0,
-    0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF5, 0x5B, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xA0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x07, 0xF9, 0x00, 0xBC, 0xFF,
-    0xFF, 0x02, 0xFF, 0x91, 0xBF, 0x0B, 0xF0, 0x00, 0xBD, 0x2F, 0x80, 0x00, 0xFC, 0xBD, 0x00, 0x02,
-    0xF2, 0xF0, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x01, 0xF6,
-    0xF0, 0x00, 0x0B, 0xCB, 0xD0, 0x00, 0x3F, 0x2F, 0xC0, 0x01, 0xF8, 0xBF, 0xC0, 0x1F, 0xC2, 0xFB,
-    0xFF, 0xFD, 0x0B, 0xC7, 0xFF, 0xC0, 0x2F, 0x00, 0x50, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x3E, 0x55, 0xBF, 0xC0, 0x3D, 0x00, 0x0B, 0xE0, 0x3D, 0x00, 0x03,
-    0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x03,
-    0xE0, 0x3D, 0x00, 0x1F, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3E, 0x55, 0xF8,
-    0x00, 0x3D, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x3D, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x0F,
-    0xC0, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x00, 0xF9, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x0B, 0xFE, 0x40, 0x02, 0xFD,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x6E, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x00, 0x01,
-    0x40, 0x00, 0x06, 0xFF, 0x80, 0x2F, 0xFF, 0xF4, 0x1E, 0x41, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x3F, 0xD0, 0x00,
-    0xBE, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7E, 0x00, 0x19, 0x2F, 0xFF, 0xFD, 0x07,
-    0xFF, 0xF8, 0x00, 0x15, 0x00, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xC7, 0xFA, 0xAA, 0xAA,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE5, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0xF0, 0xBC,
-    0x00, 0x3D, 0x1F, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0x41, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00,
-    0x1F, 0xEA, 0x9B, 0xFF, 0xFF, 0x1B, 0xE5, 0x50, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07,
-    0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x03, 0xD0,
-    0x00, 0x3F, 0x00, 0x02, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x06, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x17, 0xE0, 0x07, 0xFD, 0x00, 0x3F, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xE5, 0x7F, 0x55, 0x52, 0xE0, 0x0B, 0xC0, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x05,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0xD0, 0x3E, 0x00, 0x03, 0xD0,
-    0x00, 0x7D, 0x00, 0x07, 0xD0, 0x01, 0xFE, 0xA9, 0xBF, 0xFF, 0xF1, 0xBE, 0x55, 0x07, 0xD0, 0x00,
-    0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D, 0x00, 0x07, 0xD0, 0x00, 0x7D,
-    0x00, 0x07, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0x00, 0xBF, 0xF0, 0x00, 0x10,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF5, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x0F, 0x83,
-    0xE7, 0xD0, 0x00, 0x00, 0xF8, 0x7C, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x87, 0xD0, 0x00, 0x00, 0xFF,
-    0xE0, 0x7D, 0x00, 0x00, 0x0F, 0xE4, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE4,
-    0x01, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x5A, 0x00, 0x00, 0xA4, 0xBC, 0xBC, 0x00, 0x03, 0xE7, 0xE2, 0xF0, 0x00, 0x0F, 0xFE,
-    0x0B, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03,
-    0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x00,
-    0x3F, 0x40, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x7F, 0xFD, 0x2E, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0xF0, 0x00, 0x40, 0x01, 0x50,
-    0x0F, 0xC0, 0xFC, 0x07, 0xC0, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x0B, 0xFE,
-    0x01, 0xF0, 0xF8, 0x7C, 0x03, 0xE5, 0x00, 0x05, 0x01, 0x40, 0x04, 0x0F, 0xF4, 0x1C, 0x3E, 0xFF,
-    0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x2A,
-    0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x60, 0x00, 0x97, 0x40, 0x2D, 0x3F,
-    0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x50, 0x00, 0x14, 0x7D, 0x7D, 0x28, 0x04, 0x01, 0x03, 0xD0, 0x7C,
-    0x3E, 0x0B, 0xC1, 0x80, 0x24, 0xFE, 0x0A, 0xFC, 0x02, 0xD0, 0x3D, 0x2F, 0x83, 0xC0, 0x28, 0x00,
-    0x0B, 0xE0, 0x2E, 0xBC, 0x38, 0x2C, 0x34, 0x1C, 0x3C, 0x3C, 0x1F, 0xF4, 0x01, 0x40, 0x01, 0x40,
-    0x54, 0x2F, 0x47, 0xD0, 0xF8, 0x3E, 0x0B, 0x82, 0xE0, 0x78, 0x0F, 0x00, 0x40, 0x10, 0x00, 0x50,
-    0x00, 0x57, 0xC0, 0x3D, 0x2F, 0x0F, 0x80, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x3C,
-    0x3C, 0x3C, 0x3C, 0x28, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC, 0x3E, 0x68, 0x29,
-    0x15, 0x05, 0x40, 0x2F, 0x0B, 0xD0, 0x0F, 0x83, 0xF0, 0x03, 0xD0, 0xF4, 0x00, 0xF0, 0x3C, 0x00,
-    0x10, 0x04, 0x00, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x06, 0x0A, 0x09, 0x74, 0x02, 0xD3, 0xFF,
-    0xFC, 0x0F, 0xFE, 0x00, 0x05, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF4, 0x3E, 0xAB, 0xC7, 0x40, 0x1D,
-    0x10, 0x00, 0x40, 0x03, 0xC0, 0x7C, 0x0F, 0x80, 0xF4, 0x2F, 0x03, 0xF0, 0x3F, 0x01, 0x40, 0x0B,
-    0xC0, 0xFC, 0x0F, 0x81, 0xF0, 0x2F, 0x03, 0xD0, 0x3C, 0x01, 0x00, 0x3E, 0x03, 0xF0, 0x2F, 0x01,
-    0xF4, 0x0F, 0x40, 0xB8, 0x03, 0xC0, 0x14, 0x0B, 0xC0, 0xFC, 0x0F, 0x81, 0xF4, 0x2F, 0x02, 0xE0,
-    0x3C, 0x01, 0x40, 0x54, 0x0B, 0xE0, 0x2F, 0x00, 0xBC, 0x02, 0xE0, 0x05, 0x01, 0x50, 0xBE, 0x0F,
-    0x83, 0xE0, 0xB8, 0x05, 0x00, 0x00, 0x00, 0x1E, 0x16, 0xEB, 0xFE, 0x56, 0xE0, 0x1E, 0x00, 0x40,
-    0x00, 0x0B, 0x40, 0xB9, 0x4B, 0xFE, 0xB9, 0x5B, 0x40, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x6A,
-    0xAF, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x01, 0xF4, 0x2F, 0xC3, 0xF8, 0x0A, 0x00, 0x00, 0x05, 0x3E, 0x74, 0xB0, 0x74, 0x3E, 0x05, 0x02,
-    0x80, 0x03, 0xC0, 0x03, 0xC0, 0x2B, 0xE8, 0x3F, 0xFC, 0x00, 0x00, 0x2A, 0xA8, 0x3F, 0xFC, 0x03,
-    0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x3F, 0xFC, 0x2B,
-    0xE8, 0x03, 0xC0, 0x02, 0x80, 0x2A, 0xA8, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xF0,
-    0x1F, 0x01, 0xF0, 0x1F, 0x17, 0xF3, 0xFD, 0x3F, 0x40, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0xF4,
-    0x0F, 0x40, 0xFD, 0x47, 0xFC, 0x1F, 0xC0, 0x00, 0x3D, 0x3F, 0x3D, 0x00, 0x04, 0x01, 0x03, 0xD0,
-    0x7C, 0x3E, 0x0B, 0xC1, 0x80, 0x24, 0x0B, 0xE0, 0x2E, 0xBC, 0x38, 0x2C, 0x34, 0x1C, 0x3C, 0x3C,
-    0x1F, 0xF4, 0x01, 0x40, 0x00, 0x3E, 0x3D, 0x7C, 0xB0, 0x50, 0x0F, 0x01, 0xE0, 0x1F, 0xD0, 0x1F,
-    0x01, 0xFA, 0xBE, 0xFF, 0x40, 0x01, 0x00, 0xF0, 0x2D, 0x03, 0xC0, 0x78, 0x07, 0xD4, 0x3F, 0xD0,
-    0x54, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x28, 0x2A, 0xAA, 0xA8, 0x3F, 0xFF, 0xFC, 0x3C, 0x00, 0x3C,
-    0x38, 0x00, 0x2C, 0x38, 0x00, 0x2C, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x70, 0x3C, 0x0D, 0x39,
-    0xBE, 0x7C, 0x1F, 0xEB, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x57, 0xC0, 0x3E, 0x2F, 0x0F, 0x80,
-    0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x3F, 0xC0, 0x0B, 0xFE, 0x02, 0xF1,
-    0xF8, 0x7C, 0x03, 0xD5, 0x00, 0x05, 0x60, 0x00, 0x97, 0x40, 0x2D, 0x3F, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x00, 0x50, 0x00, 0x01, 0xA4, 0x01, 0xFF, 0xF4, 0x3E, 0xAB, 0xC7, 0x40, 0x1D, 0x10, 0x00, 0x40,
-    0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F, 0xF0, 0x10, 0x00, 0x40, 0x3F,
-    0xFF, 0xD7, 0xFF, 0xFD, 0x15, 0x55, 0x40, 0x15, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA,
-    0xAA, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x40, 0x01, 0x40, 0x04, 0x0F, 0xF8,
-    0x1D, 0x2E, 0xBF, 0xFC, 0x38, 0x0B, 0xF4, 0x10, 0x00, 0x40, 0x2A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x15, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x7F, 0x80, 0x2F, 0xD0,
-    0x2F, 0xD0, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0,
-    0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x50, 0xBC, 0x1D, 0x0E, 0x1D, 0xBC, 0x50, 0x24, 0x00, 0x18, 0x38, 0x00, 0x2C,
-    0x38, 0x00, 0x2C, 0x3D, 0x55, 0x7C, 0x3F, 0xFF, 0xFC, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFE, 0xB5, 0x55, 0x5E, 0xB0, 0x00, 0x0E, 0xB0, 0x00, 0x0E, 0xBF, 0xFF, 0xFE, 0x6A, 0xAA,
-    0xA9, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x39, 0x7E, 0x6C, 0x70, 0x3C, 0x0D, 0x00, 0x00, 0x00,
-    0x10, 0x4B, 0x5E, 0x3F, 0xC2, 0xF4, 0x7F, 0xDB, 0x0E, 0x00, 0x00, 0x00, 0x2F, 0xB8, 0xF4, 0x7C,
-    0x2D, 0x0F, 0x6E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x40, 0x14, 0x01,
-    0xFC, 0x01, 0xF4, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0x40, 0x00, 0x50, 0x0F, 0xD0, 0x7D, 0x03, 0xE0,
-    0x3D, 0x00, 0x40, 0x00, 0x01, 0x40, 0x04, 0x1F, 0xF4, 0x2C, 0x3E, 0xFF, 0xFC, 0x34, 0x1F, 0xF0,
-    0x10, 0x00, 0x40, 0x2A, 0x0F, 0xE0, 0x7C, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xF8,
-    0x47, 0xCB, 0xCF, 0x9F, 0x7E, 0x3E, 0x14, 0xF0, 0x20, 0x01, 0x00, 0x00, 0x28, 0x03, 0xD0, 0x3D,
-    0x03, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80,
-    0x00, 0x2D, 0x78, 0x00, 0x02, 0xD6, 0x40, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x2A, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15, 0x55,
-    0x55, 0x40, 0x00, 0x00, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC, 0x3E, 0xBC, 0x3E, 0x68, 0x29, 0x15, 0x4B,
-    0xFE, 0x6A, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x4F, 0x04, 0x1F, 0xFD, 0x2C,
-    0x3E, 0xFF, 0xFC, 0x34, 0xBF, 0xF0, 0x10, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x3C, 0x00, 0x06, 0x90, 0x0C, 0x2F, 0xFD, 0x2C, 0x3D, 0x7F, 0xF8, 0x74, 0x07,
-    0xE0, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x0F, 0x7F, 0xFF, 0xEF, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x0F, 0x7F, 0xFA, 0xEF, 0x07,
-    0xFC, 0x40, 0x01, 0x00, 0x00, 0x41, 0x00, 0x07, 0x82, 0xD0, 0x2F, 0xFF, 0xF8, 0x0F, 0xEB, 0xF0,
-    0x02, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x2F, 0x82, 0xF8, 0x0F, 0x00, 0xF0, 0x0F,
-    0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x3F, 0xD7, 0xFC, 0x03, 0xFC, 0x03, 0xFD, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0xD7, 0x00, 0x00, 0x50, 0x00, 0x0D, 0x60, 0x00, 0xCA, 0x30, 0x00, 0x90, 0x00, 0x84, 0x01,
-    0x20, 0x00, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x60, 0x60, 0x00,
-    0x00, 0xA0, 0x97, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x70, 0xD0, 0x00, 0x00, 0x30, 0xD7, 0x04, 0x00,
-    0x00, 0x01, 0x0D, 0x70, 0x60, 0x00, 0x00, 0x50, 0xD0, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x08,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0xC4, 0x01, 0x30, 0x00, 0x20, 0x01, 0xCA, 0x34, 0x00, 0x87, 0x00,
-    0x00, 0x50, 0x00, 0x0D, 0x70, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA8, 0x02, 0xA8, 0x02, 0xAD, 0x7F,
-    0xC0, 0x7F, 0xD0, 0x3F, 0xD0, 0x00, 0x06, 0x40, 0x3F, 0x40, 0xBD, 0x1F, 0xD7, 0xE0, 0x50, 0x00,
-    0x0B, 0x3E, 0x74, 0x74, 0x3D, 0x1F, 0x00, 0x01, 0x54, 0x00, 0xFF, 0xF4, 0x3F, 0xAB, 0xC7, 0x40,
-    0x1D, 0x10, 0xF0, 0x40, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x7F, 0xD2,
-    0xF8, 0x3F, 0xC7, 0x9D, 0x00, 0x40, 0x00, 0x90, 0xBD, 0x7E, 0x07, 0xE0, 0x1F, 0xC0, 0x19, 0x60,
-    0x07, 0xE0, 0x0B, 0xD0, 0xBD, 0x7F, 0x46, 0x00, 0x60, 0x00, 0x50, 0x7E, 0x02, 0xF0, 0x0B, 0xD3,
-    0xF4, 0x0B, 0xD7, 0x7C, 0x3F, 0x4B, 0x2C, 0x60, 0x0E, 0x0E, 0x74, 0x3D, 0x0F, 0x0F, 0x1E, 0x78,
-    0x00, 0x04, 0x3E, 0x3F, 0x18, 0x03, 0xC0, 0x17, 0xD4, 0x3F, 0xFC, 0x0B, 0xE0, 0x0F, 0xF0, 0x09,
-    0x60, 0x00, 0x00, 0x00, 0x1F, 0xEB, 0xF4, 0x79, 0xBE, 0x6D, 0xB0, 0x3C, 0x0E, 0xB0, 0x3C, 0x0E,
-    0x3D, 0xBE, 0x7C, 0x1F, 0xD7, 0xF4, 0x38, 0x03, 0x40, 0x7F, 0xE6, 0xAD, 0x01, 0xC0, 0x18, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x0B,
-    0xE0, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6A,
-    0xA9, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x55, 0x40, 0x00, 0x00, 0x04, 0x0B,
-    0xFF, 0xFE, 0x40, 0x00, 0x3C, 0x2F, 0xAA, 0xBF, 0xFF, 0xEB, 0xF4, 0x38, 0x00, 0x01, 0x6F, 0xFF,
-    0xD0, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xA5, 0x5A, 0xFF, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42,
-    0x5E, 0x00, 0x71, 0xAF, 0xA0, 0x3A, 0x0B, 0x3F, 0x70, 0x00, 0x05, 0x40, 0xE6, 0x86, 0x03, 0x2F,
-    0xFD, 0xA0, 0x01, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x22, 0x17, 0x77, 0x77, 0x70, 0x05, 0x40, 0xE6,
-    0x89, 0x03, 0x74, 0x0A, 0xD0, 0x26, 0x80, 0xC2, 0xFD, 0x00, 0x00, 0x00, 0x12, 0x40, 0xC9, 0x03,
-    0x24, 0x0C, 0x90, 0x32, 0x81, 0xC3, 0xFA, 0x00, 0x00, 0x01, 0x51, 0xE6, 0x34, 0x03, 0x00, 0x30,
-    0x03, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x53, 0x1E, 0x7C, 0xD0, 0x33, 0x00, 0xCD,
-    0x03, 0x28, 0x1C, 0x2F, 0xA0, 0x00, 0x00, 0x90, 0x02, 0x80, 0x0A, 0x14, 0x2E, 0x6C, 0xA0, 0x36,
-    0x80, 0xDA, 0x03, 0x68, 0x0D, 0x90, 0x34, 0x05, 0x41, 0x42, 0xE7, 0xA6, 0xCA, 0x07, 0x03, 0x64,
-    0x0C, 0x0D, 0x90, 0x30, 0x36, 0x40, 0xC0, 0xD9, 0x03, 0x02, 0x40, 0x01, 0x5F, 0x97, 0x01, 0xC0,
-    0x70, 0x1C, 0x07, 0x00, 0x10, 0x0E, 0x47, 0x90, 0xD0, 0x34, 0x0D, 0x03, 0x40, 0x7D, 0x00, 0x00,
-    0x10, 0x00, 0x28, 0x0D, 0x1C, 0x1C, 0x0D, 0x34, 0x07, 0x30, 0x03, 0xA0, 0x02, 0xC0, 0x00, 0x10,
-    0xC2, 0x81, 0xDC, 0x02, 0xC0, 0x0E, 0x80, 0xD3, 0x4A, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B,
-    0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4,
-    0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00,
-    0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA,
-    0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F,
-    0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x3F,
-    0xFF, 0xE4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3E, 0x55, 0xAF, 0xF0, 0x3D, 0x00, 0x03, 0xF4, 0x3D,
-    0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x02, 0xF0, 0x3D,
-    0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFE, 0x40, 0x3E, 0x00, 0x5B, 0xF0, 0x3D,
-    0x00, 0x01, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x7D, 0x3D, 0x00, 0x00, 0x7D, 0x3D,
-    0x00, 0x00, 0xBC, 0x3D, 0x00, 0x01, 0xFC, 0x3E, 0x00, 0x5B, 0xF4, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3E, 0x55, 0x55, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x00, 0x3D, 0x2E, 0x00, 0x00, 0x01,
-    0xF0, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x03,
-    0xD0, 0x00, 0x0F, 0x40, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00,
-    0x1F, 0x40, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x1F, 0x00,
-    0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x0F, 0x47, 0xE5, 0x55, 0x55, 0x7F, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50,
-    0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xE5, 0x55, 0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0xBF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE5,
-    0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0x3D, 0x00, 0x00, 0x0B, 0x8F, 0x40,
-    0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0F,
-    0xCF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0x55, 0x55, 0x7F, 0x3D, 0x00, 0x00,
-    0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D, 0x00,
-    0x00, 0x0F, 0xCF, 0x40, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x3F, 0x3D,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x0A, 0xAA, 0xA8, 0x3F, 0x3E, 0x0F, 0xFF, 0xFC, 0x3F,
-    0x3E, 0x0A, 0xAA, 0xA4, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F,
-    0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0,
-    0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF,
-    0xFE, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x7E, 0x00, 0xF4, 0x00,
-    0x7E, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0xF4,
-    0x3F, 0x00, 0x00, 0x3D, 0x3F, 0x00, 0x00, 0x0F, 0x6F, 0x80, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00,
-    0xFF, 0x7F, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x0F, 0x40, 0xBE, 0x00, 0x03, 0xD0, 0x0F, 0xD0,
-    0x00, 0xF4, 0x00, 0xFC, 0x00, 0x3D, 0x00, 0x1F, 0xC0, 0x0F, 0x40, 0x02, 0xF8, 0x03, 0xD0, 0x00,
-    0x3F, 0x40, 0xF4, 0x00, 0x03, 0xF0, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x0F, 0x6E,
-    0x00, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x00,
-    0x7C, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x1F,
-    0x40, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0xF8,
-    0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x0F,
-    0xC7, 0xC0, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xE3,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE3, 0xEF, 0x00, 0x00, 0x07, 0xFE,
-    0x3D, 0xF4, 0x00, 0x00, 0xF7, 0xE3, 0xCF, 0x80, 0x00, 0x1F, 0x3E, 0x3C, 0x7C, 0x00, 0x02, 0xE3,
-    0xE3, 0xC3, 0xD0, 0x00, 0x3D, 0x3E, 0x3D, 0x2F, 0x00, 0x07, 0xC3, 0xE3, 0xD1, 0xF0, 0x00, 0xF8,
-    0x3E, 0x3D, 0x0F, 0x80, 0x0F, 0x03, 0xE3, 0xD0, 0xBC, 0x02, 0xF0, 0x3E, 0x3D, 0x03, 0xD0, 0x3D,
-    0x03, 0xE3, 0xD0, 0x3E, 0x07, 0xC0, 0x3E, 0x3D, 0x01, 0xF0, 0xB8, 0x03, 0xE3, 0xD0, 0x0F, 0x4F,
-    0x40, 0x3E, 0x3D, 0x00, 0xBD, 0xF0, 0x03, 0xE3, 0xD0, 0x07, 0xFE, 0x00, 0x3E, 0x3D, 0x00, 0x3F,
-    0xC0, 0x03, 0xE3, 0xD0, 0x02, 0xF8, 0x00, 0x3E, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x3F, 0x00,
-    0x00, 0x03, 0xD3, 0xF8, 0x00, 0x00, 0x3D, 0x3F, 0xD0, 0x00, 0x03, 0xD3, 0xFF, 0x00, 0x00, 0x3D,
-    0x3D, 0xF8, 0x00, 0x03, 0xD3, 0xCB, 0xD0, 0x00, 0x3D, 0x3C, 0x3F, 0x00, 0x03, 0xD3, 0xC1, 0xF8,
-    0x00, 0x3D, 0x3C, 0x0F, 0xC0, 0x03, 0xD3, 0xD0, 0x3F, 0x00, 0x3D, 0x3D, 0x01, 0xF8, 0x03, 0xD3,
-    0xD0, 0x0F, 0xC0, 0x3D, 0x3D, 0x00, 0x3F, 0x03, 0xD3, 0xD0, 0x02, 0xF4, 0x3D, 0x3D, 0x00, 0x0F,
-    0xC3, 0xD3, 0xD0, 0x00, 0x7F, 0x3D, 0x3D, 0x00, 0x02, 0xF7, 0xD3, 0xD0, 0x00, 0x0F, 0xFD, 0x3D,
-    0x00, 0x00, 0x7F, 0xD3, 0xD0, 0x00, 0x02, 0xFD, 0x3D, 0x00, 0x00, 0x0F, 0xD0, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x2F, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE0, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00,
-    0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x56,
-    0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3, 0xD0, 0x00,
-    0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3, 0xD0,
-    0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03, 0xD3,
-    0xD0, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x4F, 0x40, 0x00, 0x03,
-    0xD3, 0xD0, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0xFF,
-    0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xE5, 0x6B, 0xFC, 0x0F, 0x40, 0x02, 0xF8, 0x3D, 0x00, 0x03,
-    0xF0, 0xF4, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0xBC, 0x3D, 0x00, 0x03, 0xF0,
-    0xF4, 0x00, 0x2F, 0x43, 0xE5, 0x5B, 0xF8, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x90, 0x00, 0xF4,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xC7, 0xFA, 0xAA, 0xAA, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0B, 0xE5, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x5B, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0xBC, 0x00, 0x00, 0x1F, 0x1F, 0x80, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03,
-    0xE0, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0,
-    0x3E, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x07, 0xFE, 0x5F, 0xDA, 0xFF, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0xBF, 0x02, 0xF4, 0x00, 0xF8,
-    0x00, 0xBD, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x7D, 0x00, 0x0F, 0x80, 0x02, 0xF1, 0xF0, 0x00,
-    0x3E, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0xBC, 0x3E,
-    0x00, 0x0F, 0x80, 0x03, 0xF0, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x41, 0xFC, 0x00, 0xF8, 0x01, 0xFC,
-    0x02, 0xFD, 0x03, 0xE0, 0x2F, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x0B, 0xD0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0,
-    0x1F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x07, 0xD1, 0xF4,
-    0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x0B,
-    0xC0, 0xFC, 0x00, 0x07, 0xD0, 0x1F, 0x40, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x01,
-    0xF4, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x7C,
-    0x00, 0x7C, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00,
-    0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x7D, 0x00, 0x7D, 0x00, 0x7C, 0x3E, 0x00, 0x7D, 0x00, 0xBC, 0x3F,
-    0x00, 0x7D, 0x00, 0xFC, 0x1F, 0x40, 0x7D, 0x02, 0xF4, 0x0F, 0xE0, 0x7D, 0x0B, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xF9, 0x01, 0xBF, 0x40, 0x07, 0xF4, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0xBC, 0x00, 0x00, 0x01, 0xF8,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x03, 0xF0,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x81,
-    0xF0, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x55, 0xFC, 0x00, 0xFD, 0x54, 0x7F,
-    0xFF, 0x80, 0xBF, 0xFF, 0x1F, 0xFF, 0xE0, 0x2F, 0xFF, 0xC0, 0x00, 0x6F, 0xD0, 0x64, 0x00, 0xFF,
-    0xFF, 0x3D, 0x00, 0xFE, 0x46, 0xFF, 0x40, 0x7E, 0x00, 0x1F, 0xD0, 0x3F, 0x00, 0x02, 0xF4, 0x0F,
-    0x80, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0xF4,
-    0x1F, 0x40, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x07, 0xD0, 0x2F, 0x40, 0x03,
-    0xF4, 0x03, 0xF4, 0x03, 0xFE, 0x00, 0x7F, 0xFF, 0xDB, 0xF4, 0x07, 0xFF, 0xD0, 0xFE, 0x00, 0x05,
-    0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xE0,
-    0x0B, 0xF0, 0x3E, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x1F, 0x47, 0xC0, 0x00, 0x7D, 0x2F, 0x00, 0x01,
-    0xF0, 0xBC, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xBC, 0x0B, 0xC2, 0xAF, 0x80, 0x2F, 0x0F, 0xFD, 0x00,
-    0xBC, 0x15, 0x7F, 0x42, 0xF0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x7C, 0xBC,
-    0x00, 0x01, 0xF6, 0xF0, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x2F, 0x2F, 0x00, 0x00, 0xFC, 0xBF, 0x40,
-    0x1F, 0xD2, 0xFF, 0xFF, 0xFE, 0x0B, 0xEF, 0xFF, 0xD0, 0x2F, 0x01, 0x40, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xA2, 0xF0, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x1F, 0x0F,
-    0x80, 0x00, 0xBC, 0x2F, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0B, 0x80, 0xF8, 0x00, 0x3E, 0x01, 0xF0,
-    0x00, 0xF4, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x3D, 0x0F,
-    0x80, 0x00, 0xBC, 0xBC, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0xFC, 0x00, 0xB4, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x2F, 0xDB, 0xF0, 0x03, 0xF4, 0x07, 0xF0, 0x2F, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x0B, 0xC7,
-    0xC0, 0x00, 0x0F, 0x6F, 0x00, 0x00, 0x3E, 0xBC, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x03, 0xD7, 0xD0,
-    0x00, 0x1F, 0x4F, 0xC0, 0x00, 0xFC, 0x1F, 0xD0, 0x0F, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x40, 0x00, 0x01, 0xBF, 0xE4, 0x0F, 0xFF, 0xFE, 0x3F, 0x91, 0x6D, 0x3E, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x03, 0xFF, 0xC0, 0x0B, 0xFF, 0xC0,
-    0x3F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x40, 0x05, 0x2F,
-    0xFF, 0xFD, 0x07, 0xFF, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD1, 0xFF,
-    0xEB, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x0B, 0xFF, 0xD0, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x64, 0x1F, 0xF4, 0x0B, 0xCF, 0xFF, 0xF0, 0xBF, 0xE5,
-    0x7F, 0x8B, 0xF0, 0x00, 0xFC, 0xBE, 0x00, 0x07, 0xDB, 0xD0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB,
-    0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00,
-    0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x02, 0xF8, 0x07, 0xF0, 0x0F, 0x80, 0x07, 0xD0, 0xBC, 0x00, 0x0B, 0xC3, 0xE0,
-    0x00, 0x1F, 0x0F, 0x80, 0x00, 0x3D, 0x3D, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x03, 0xE7, 0xD5, 0x55,
-    0x5F, 0x9F, 0xFF, 0xFF, 0xFE, 0x7E, 0xAA, 0xAA, 0xF9, 0xF0, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x0F,
-    0x8F, 0x40, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x2F, 0x03,
-    0xE0, 0x00, 0xF8, 0x0B, 0xD0, 0x1F, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x40, 0x00, 0x68, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x3F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x50, 0x68, 0x00, 0x1A, 0x4B, 0xC0, 0x03, 0xF0, 0xBC, 0x00, 0xFC, 0x0B, 0xC0,
-    0x3F, 0x00, 0xBC, 0x0B, 0xD0, 0x0B, 0xC2, 0xF4, 0x00, 0xBC, 0x7E, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0xBF, 0xFF, 0x00, 0x0B, 0xF5, 0xF8, 0x00, 0xBD, 0x0B, 0xD0, 0x0B, 0xC0, 0x3F, 0x00, 0xBC, 0x01,
-    0xF8, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0xFC, 0x14, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0xB9, 0xF0, 0x00, 0x00, 0xF4, 0xF8, 0x00,
-    0x01, 0xF0, 0xBC, 0x00, 0x02, 0xF0, 0x7D, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x07, 0xC0, 0x2F, 0x00,
-    0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xE0,
-    0x3D, 0x00, 0x03, 0xFC, 0xBC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x68, 0x00, 0x02, 0x90,
-    0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0,
-    0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0,
-    0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x03, 0xE0, 0xBC, 0x00, 0x07, 0xE0, 0xBD, 0x00, 0x0F, 0xE0,
-    0xBF, 0x40, 0x2F, 0xE0, 0xBF, 0xFF, 0xF6, 0xFE, 0xBD, 0xFF, 0xD0, 0xFE, 0xBC, 0x04, 0x00, 0x10,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xA2, 0xF0, 0x00, 0x07, 0xC3,
-    0xD0, 0x00, 0x1F, 0x0F, 0x80, 0x00, 0xBC, 0x2F, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x0B, 0x80, 0xF8,
-    0x00, 0x3E, 0x01, 0xF0, 0x00, 0xF4, 0x03, 0xD0, 0x0B, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x1F, 0x01,
-    0xF0, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0xBC, 0xBC, 0x00, 0x01, 0xFB, 0xD0, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD1, 0xFB, 0xFF, 0xA0, 0x07, 0xD0,
-    0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0xEA, 0xA0, 0x02, 0xFF, 0xFC, 0x03, 0xF9, 0x55, 0x03, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F,
-    0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD1, 0x6F, 0x55, 0x57, 0xE5, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x07,
-    0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x01, 0xF0, 0x00,
-    0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0x40,
-    0x01, 0xF0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xFF, 0x00, 0x7C,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xBF, 0x90, 0x00, 0xBF, 0xFF, 0xD0, 0x1F,
-    0xD5, 0xBF, 0x03, 0xF0, 0x00, 0xFC, 0x7C, 0x00, 0x07, 0xDB, 0xC0, 0x00, 0x3E, 0xF8, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xEF, 0x80,
-    0x00, 0x7D, 0xF8, 0x00, 0x0F, 0xCF, 0xE0, 0x02, 0xF4, 0xFF, 0xFF, 0xFE, 0x0F, 0xAF, 0xFF, 0x40,
-    0xF8, 0x05, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0xBF, 0xFF, 0xC0,
-    0xBF, 0x56, 0xD0, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xBF,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x06, 0xAA, 0xAA, 0x01, 0xFF, 0xFF, 0xFF, 0x07, 0xF9, 0x5F, 0xD5, 0x0F, 0xC0, 0x03,
-    0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x01, 0xF4, 0x3D, 0x00, 0x00, 0xF8, 0x7D, 0x00, 0x00,
-    0xF8, 0x7C, 0x00, 0x00, 0xF8, 0x7D, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x01,
-    0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0xD0, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFD, 0x15, 0xBE, 0x55, 0x40,
-    0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x14,
-    0x00, 0x68, 0x00, 0x0A, 0x4B, 0xC0, 0x00, 0xFC, 0xBC, 0x00, 0x0B, 0xCB, 0xC0, 0x00, 0x7C, 0xBC,
-    0x00, 0x07, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03, 0xDB, 0xC0, 0x00, 0x3D, 0xBC, 0x00, 0x03,
-    0xDB, 0xC0, 0x00, 0x7D, 0xBC, 0x00, 0x07, 0xCB, 0xC0, 0x00, 0xFC, 0x7D, 0x00, 0x1F, 0x83, 0xF0,
-    0x07, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x06,
-    0xFF, 0xE4, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xE6, 0xF6, 0xFD, 0x00, 0xFC, 0x0B, 0xC0,
-    0xFC, 0x0B, 0xC0, 0x2F, 0x00, 0xFC, 0x3E, 0x00, 0xBC, 0x02, 0xF1, 0xF4, 0x02, 0xF0, 0x03, 0xD7,
-    0xD0, 0x0B, 0xC0, 0x0F, 0x9F, 0x40, 0x2F, 0x00, 0x3E, 0x7D, 0x00, 0xBC, 0x00, 0xF4, 0xF8, 0x02,
-    0xF0, 0x07, 0xD3, 0xF0, 0x0B, 0xC0, 0x3F, 0x07, 0xE0, 0x2F, 0x01, 0xF4, 0x0B, 0xE0, 0xBC, 0x2F,
-    0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x0A,
-    0x83, 0xFC, 0x00, 0x01, 0xF4, 0x1B, 0xE0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF4,
-    0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0x1F, 0x4F, 0x40, 0x00, 0x00, 0xFE, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x02, 0xF3, 0xF0, 0x00, 0x00, 0x7D, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x02, 0xF0, 0x0B,
-    0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x02, 0xF0, 0x00, 0x0F, 0xFC, 0x3E,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x06, 0x80, 0x1F, 0x00, 0x68, 0xBC, 0x01, 0xF0, 0x07, 0xCB, 0xC0, 0x1F, 0x00,
-    0x3D, 0xBC, 0x01, 0xF0, 0x03, 0xEB, 0xC0, 0x1F, 0x00, 0x3E, 0xBC, 0x01, 0xF0, 0x03, 0xFB, 0xC0,
-    0x1F, 0x00, 0x2F, 0xBC, 0x01, 0xF0, 0x02, 0xFB, 0xC0, 0x1F, 0x00, 0x2F, 0xBC, 0x01, 0xF0, 0x03,
-    0xEB, 0xC0, 0x1F, 0x00, 0x3E, 0x7D, 0x01, 0xF0, 0x07, 0xD3, 0xF0, 0x1F, 0x00, 0xFC, 0x1F, 0xD1,
-    0xF0, 0xBF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x01, 0xA0,
-    0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x80, 0x01, 0x40, 0x07, 0xC3, 0xE0, 0x02, 0xF0, 0x00, 0xF4,
-    0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x4F, 0x80, 0x0B, 0xC0, 0x03, 0xD3,
-    0xE0, 0x02, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0xBC, 0x00, 0xBC, 0x1F, 0x00, 0x3F, 0x40, 0x3F, 0x03,
-    0xF0, 0x2E, 0xF0, 0x2F, 0x40, 0x7F, 0xFF, 0x2F, 0xFF, 0x80, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x00,
-    0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F,
-    0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF,
-    0x1F, 0xF9, 0x5B, 0xCF, 0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F,
-    0xDF, 0x80, 0x1F, 0xF3, 0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00,
-    0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02,
-    0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0,
-    0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00,
-    0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x0A, 0xFC, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAF, 0xE4, 0x02, 0xFF, 0xFF, 0x80, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x15, 0xBC, 0x0B, 0xFF, 0xFF, 0x1F, 0xF9, 0x5B, 0xCF,
-    0xC0, 0x02, 0xFB, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0x3F, 0xBC, 0x00, 0x1F, 0xDF, 0x80, 0x1F, 0xF3,
-    0xFF, 0xFF, 0x7C, 0x2F, 0xFE, 0x0F, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0A, 0x43, 0xD0, 0x00, 0x00, 0xFF, 0x59, 0x00, 0x00, 0x0B, 0xDF,
-    0x40, 0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x02, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F,
-    0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xF8, 0x3C, 0x00,
-    0x0F, 0xF5, 0x80, 0x00, 0xF5, 0xF4, 0x00, 0x0F, 0x40, 0xF0, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xAF, 0xE4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xB9, 0x07, 0xF4, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x15, 0xBC, 0x00, 0xBF, 0xFF, 0xF0,
-    0x1F, 0xF9, 0x5B, 0xC0, 0xFC, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xBC, 0x2F, 0x00, 0x03, 0xF0, 0xBC,
-    0x00, 0x1F, 0xC1, 0xF8, 0x01, 0xFF, 0x03, 0xFF, 0xFF, 0x7C, 0x02, 0xFF, 0xE0, 0xF0, 0x00, 0x10,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0A, 0x40, 0x00,
-    0x00, 0x28, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xDF, 0x40, 0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x02,
-    0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x0B, 0xCF, 0x00, 0x00,
-    0x00, 0x3E, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x00, 0x3D,
-    0x03, 0xF0, 0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x2F,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7E, 0xAA, 0xAB, 0xF0, 0x03,
-    0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x00, 0x1F, 0x43, 0xE0, 0x00,
-    0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x68, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x0B, 0x46, 0xA0, 0x00, 0x14, 0xFF, 0x40, 0x00, 0x3E, 0x7D, 0x00, 0x0F, 0x40,
-    0xF0, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0x2F, 0xFF, 0xF8, 0x02,
-    0xE4, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x56,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x07, 0xFE, 0x56, 0xF0, 0xFC, 0x00, 0x2F, 0x2F, 0x00, 0x02, 0xF2, 0xF0,
-    0x00, 0x3F, 0x2F, 0x00, 0x07, 0xF1, 0xF8, 0x01, 0xFF, 0x0F, 0xFF, 0xFD, 0xF0, 0x2F, 0xFE, 0x0F,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xA4, 0x38, 0x00, 0x00, 0x0F, 0xF4, 0xC0,
-    0x00, 0x00, 0xF9, 0xF0, 0x00, 0x00, 0x0B, 0x81, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00,
-    0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F,
-    0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01,
-    0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00,
-    0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x83, 0x80, 0x00, 0xFF, 0x88, 0x00, 0x0F,
-    0x8F, 0x40, 0x00, 0xF4, 0x0F, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE,
-    0x40, 0x02, 0xFF, 0xFF, 0x80, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0x5B, 0xC0, 0x0B, 0xFF, 0xFF, 0x01, 0xFF, 0x95, 0xBC, 0x0F,
-    0xC0, 0x02, 0xF0, 0xBC, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x01, 0xFC, 0x1F, 0x80,
-    0x1F, 0xF0, 0x3F, 0xFF, 0xF7, 0xC0, 0x2F, 0xFE, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x40, 0x60, 0x00, 0x00, 0x7F, 0xD3, 0x80, 0x00, 0x03, 0x9B, 0xFD, 0x00, 0x00, 0x08, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00,
-    0x07, 0x80, 0xF0, 0x00, 0x00, 0x24, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00,
-    0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-    0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0,
-    0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0xA4, 0x0A, 0x00, 0xFF, 0xE7, 0x40, 0x34, 0x7F, 0xC0, 0x04, 0x01, 0x40, 0x00,
-    0x1A, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x0F, 0x9F, 0x40, 0x0F, 0x40, 0xF0, 0x01, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC,
-    0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF,
-    0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x3D, 0x02,
-    0xE0, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x02,
-    0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x00, 0x7C, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0xFC, 0x00, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00,
-    0x1F, 0x40, 0x0B, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xAA,
-    0xAA, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0x00, 0x07,
-    0xD0, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x07, 0xD3, 0xE0, 0x03, 0xD0, 0x2E, 0x00, 0x40, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0xBF, 0x90, 0x0B, 0xFF, 0xFE, 0x02, 0xE4, 0x1F, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x56, 0xF0, 0x2F, 0xFF, 0xFC, 0x7F, 0xE5, 0x6F,
-    0x3F, 0x00, 0x0B, 0xEF, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xFE, 0xF0, 0x00, 0x7F, 0x7E, 0x00, 0x7F,
-    0xCF, 0xFF, 0xFD, 0xF0, 0xBF, 0xF8, 0x3C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x04, 0x1C, 0x10, 0x00, 0x00, 0x3C,
-    0x00, 0xE0, 0x00, 0x00, 0x7D, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x2F, 0x3C, 0x00, 0x00, 0x00, 0xF8,
-    0xF8, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x0F, 0xC0,
-    0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFA, 0xAA, 0xAF, 0xC0, 0x0F, 0xC0, 0x00,
-    0x0F, 0x40, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x0F, 0x80, 0x00, 0x00, 0xF8,
-    0x7C, 0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xA4, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x7C, 0x00, 0x08, 0x18, 0x20, 0x03, 0x80, 0x1D, 0x00, 0xBE, 0xBF, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0xBF, 0xFF, 0xE0, 0x2E, 0x41,
-    0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x05, 0x6F, 0x02, 0xFF,
-    0xFF, 0xC7, 0xFE, 0x56, 0xF3, 0xF0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0xBC, 0x00, 0x0F, 0xEF, 0x00,
-    0x07, 0xF7, 0xE0, 0x07, 0xFC, 0xFF, 0xFF, 0xDF, 0x0B, 0xFF, 0x83, 0xC0, 0x04, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x04, 0x2C,
-    0x10, 0x00, 0x00, 0x3C, 0x00, 0xD0, 0x00, 0x00, 0xB9, 0x6F, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x2F, 0x3C,
-    0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xC2, 0xF0, 0x00, 0x00, 0x3F, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x01, 0xF4,
-    0x00, 0xBC, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFA, 0xAA, 0xAF,
-    0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x0F,
-    0x80, 0x00, 0x00, 0xF8, 0x7C, 0x00, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0xA0,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x08, 0x28, 0x20, 0x03, 0x80, 0x1C, 0x00, 0xBE,
-    0xBF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF9, 0x00, 0xBF,
-    0xFF, 0xE0, 0x2E, 0x41, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x05, 0x6F, 0x02, 0xFF, 0xFF, 0xC7, 0xFE, 0x56, 0xF3, 0xF0, 0x00, 0xBE, 0xF0, 0x00, 0x2F, 0xBC,
-    0x00, 0x0F, 0xEF, 0x00, 0x07, 0xF7, 0xE0, 0x07, 0xFC, 0xFF, 0xFF, 0xDF, 0x0B, 0xFF, 0x83, 0xC0,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x10, 0xA0, 0x40, 0x00, 0x00, 0xF0, 0x03, 0x40, 0x00,
-    0x02, 0xE5, 0xBC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00,
-    0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00,
-    0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4,
-    0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1A, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x1D,
-    0x00, 0x00, 0x2F, 0x00, 0x02, 0x49, 0x09, 0x00, 0xF0, 0x07, 0x40, 0x1F, 0xAF, 0xC0, 0x02, 0xFF,
-    0xC0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90,
-    0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF,
-    0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0,
-    0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x10, 0x00, 0x00, 0x7F, 0xD3, 0x80, 0x00, 0x03, 0x9B, 0xFD, 0x00, 0x00, 0x08, 0x01,
-    0x80, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x07, 0x40, 0x00, 0x02, 0xE5, 0xBC, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-    0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B,
-    0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0xA4, 0x06, 0x00, 0xBF, 0xD7, 0x80, 0x34, 0x7F, 0xC0, 0x04, 0x01, 0x40,
-    0x01, 0x00, 0x04, 0x00, 0xE0, 0x07, 0x00, 0x2F, 0xAF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F, 0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95,
-    0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF, 0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01,
-    0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x60, 0x00,
-    0x00, 0xF0, 0x03, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xF0, 0x00, 0x00,
-    0x03, 0xE3, 0xE0, 0x00, 0x00, 0x1F, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x3F, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xEA, 0xAA, 0xBF, 0x00, 0x3F,
-    0x00, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00,
-    0x03, 0xE1, 0xF0, 0x00, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0xF0, 0x07, 0x80, 0x2F,
-    0xFF, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x40, 0x2F,
-    0xFF, 0xF8, 0x0B, 0x90, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00,
-    0x01, 0x5B, 0xC0, 0xBF, 0xFF, 0xF1, 0xFF, 0x95, 0xBC, 0xFC, 0x00, 0x2F, 0xBC, 0x00, 0x0B, 0xEF,
-    0x00, 0x03, 0xFB, 0xC0, 0x01, 0xFD, 0xF8, 0x01, 0xFF, 0x3F, 0xFF, 0xF7, 0xC2, 0xFF, 0xE0, 0xF0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55,
-    0x50, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F,
-    0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F,
-    0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1A, 0xF8, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xD3, 0xE5, 0x55, 0x50, 0xF4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xF9, 0x55, 0x50, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE5, 0x55, 0x50,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xAF, 0x80, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00,
-    0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x50, 0x01, 0x01, 0xFF, 0x42, 0xC0, 0xFB, 0xFF, 0xE0, 0x74, 0x1F, 0xF0, 0x04, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55,
-    0x0F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x00, 0x50, 0x01, 0x40, 0x3F, 0xE0, 0x34, 0x0B, 0xAF,
-    0xFF, 0x00, 0xE0, 0x2F, 0xD0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00,
-    0x2F, 0xFF, 0xE0, 0x0B, 0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00,
-    0x3F, 0x7E, 0x55, 0x57, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x0F, 0x80,
-    0x02, 0xA0, 0x7C, 0x00, 0x1F, 0xF2, 0x80, 0x01, 0xF7, 0xE0, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x50,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFD, 0x03, 0xE5, 0x55,
-    0x50, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF0, 0x0F,
-    0x95, 0x55, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xE5, 0x55, 0x50, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x82,
-    0xD0, 0x00, 0x3F, 0xF2, 0x40, 0x00, 0xBC, 0xF8, 0x00, 0x02, 0xE0, 0x2D, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x0B, 0xE4, 0x6F,
-    0x80, 0x1F, 0x40, 0x0B, 0xC0, 0x3F, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x03, 0xF0, 0x7E, 0x55, 0x57,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xAA, 0xAA, 0xA0, 0x7D, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x01, 0x40, 0x00, 0x64, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x06, 0x80, 0x00, 0x65, 0xFF, 0x00, 0x00, 0x3D, 0xF8, 0x00, 0x0F, 0x02, 0xE0, 0x01, 0x40,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFD, 0x0F, 0x95, 0x55, 0x40,
-    0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0xF9, 0x55, 0x50, 0x0F,
-    0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x40, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xD0, 0x29,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x2A, 0x00, 0x00, 0x62, 0xFF, 0x00, 0x00, 0x2F,
-    0x2E, 0x00, 0x01, 0xE0, 0x2E, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF9,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0x91, 0xBE, 0x01, 0xF4, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0xF8,
-    0x3E, 0x00, 0x03, 0xF1, 0xF9, 0x55, 0x5F, 0xC7, 0xFF, 0xFF, 0xFF, 0x1F, 0xEA, 0xAA, 0xA8, 0x7D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xE0,
-    0x01, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1D, 0x00, 0x2A, 0x0B, 0x40, 0x0B,
-    0xFC, 0x60, 0x01, 0xF7, 0xE0, 0x00, 0x3C, 0x0B, 0x40, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF4, 0x3E, 0x55, 0x55, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xE5, 0x55, 0x40, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3E,
-    0x55, 0x55, 0x03, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x0F, 0x83, 0x80, 0x00, 0xFF, 0x88,
-    0x00, 0x0F, 0x8F, 0x40, 0x00, 0xB4, 0x0B, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x0B, 0xE4, 0x6F, 0x80, 0x7D, 0x00, 0x2F, 0x03, 0xF0,
-    0x00, 0x3E, 0x0F, 0x80, 0x00, 0xFC, 0x7E, 0x55, 0x57, 0xF1, 0xFF, 0xFF, 0xFF, 0xC7, 0xFA, 0xAA,
-    0xAA, 0x1F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x60, 0x03, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x90, 0x08, 0x00, 0xFF, 0x8B, 0x00, 0xB5, 0xFF, 0x80, 0x24, 0x06, 0x40, 0x00, 0x1A, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x1F, 0x7E, 0x00, 0x0F, 0x02, 0xD0, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x3E, 0x55, 0x55, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0x95, 0x55, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3E, 0x55, 0x55, 0x0F, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xF4, 0x00, 0x68, 0x06, 0x00, 0x2F, 0xF9, 0xE0, 0x03, 0x87, 0xFC, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x2D, 0x02,
-    0xD0, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE4, 0x00, 0x2F, 0xFF, 0xE0, 0x0B,
-    0xE4, 0x6F, 0x81, 0xF4, 0x00, 0xBC, 0x3F, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x3F, 0x7E, 0x55, 0x57,
-    0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0xAA, 0xAA, 0xA7, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xFE, 0x00, 0x0B, 0xC7,
-    0xD0, 0x0B, 0xC0, 0x3D, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0x4F, 0x95, 0x55, 0x43, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xE5,
-    0x55, 0x40, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x95, 0x55, 0x43, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0x4F,
-    0xC0, 0x03, 0xD0, 0x2F, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x40, 0x02,
-    0xFF, 0xFE, 0x00, 0xBE, 0x46, 0xF8, 0x1F, 0x40, 0x0B, 0xC3, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x03,
-    0xF7, 0xE5, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0xF7, 0xFA, 0xAA, 0xAA, 0x7D, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0x80, 0x3F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x0F, 0xFC, 0x00, 0x3C, 0x00,
-    0x3C, 0x02, 0xF8, 0x03, 0xC0, 0x03, 0x80, 0x00, 0x00, 0xBF, 0xFE, 0xBF, 0xFE, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0xBF,
-    0xFD, 0xFF, 0xFE, 0x3F, 0x80, 0xAF, 0x80, 0x0F, 0x00, 0x7C, 0x0F, 0xD0, 0x38, 0x00, 0xD0, 0x00,
-    0x00, 0x1A, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0xBF, 0xFE, 0xBF,
-    0xFE, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0xBF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0xD0, 0x07,
-    0xC0, 0x00, 0x00, 0x14, 0xBC, 0xBC, 0x28, 0x00, 0x00, 0x68, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
-    0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x00, 0x00, 0x7C, 0xBD, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE,
-    0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F,
-    0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E,
-    0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D,
-    0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F,
-    0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC,
-    0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0A, 0xFC,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00,
-    0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x2A, 0x0B, 0x80, 0x00, 0x00, 0xFF, 0x89,
-    0x00, 0x00, 0x02, 0xF7, 0xD0, 0x00, 0x00, 0x07, 0x80, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02,
-    0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80,
-    0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00,
-    0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E,
-    0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02,
-    0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0B, 0xD1, 0xE0, 0x00,
-    0x2F, 0xF1, 0x40, 0x00, 0x7C, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F,
-    0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x2A, 0x00, 0x00, 0x00, 0x28, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x07, 0x80, 0xF4, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0,
-    0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F,
-    0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x90, 0x00, 0x02, 0x5F, 0xF0, 0x00, 0x00, 0x7D, 0xBC,
-    0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01,
-    0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02,
-    0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x2A, 0x0E, 0x00, 0x00, 0x00, 0xFF, 0x89, 0x00, 0x00,
-    0x02, 0xF7, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0xF0, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40,
-    0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40,
-    0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00,
-    0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x0B, 0xD2, 0xC0, 0x00, 0x2F, 0xF1, 0x40, 0x00, 0x7C, 0xBC, 0x00, 0x01, 0xF0, 0x1F,
-    0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00,
-    0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00,
-    0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x90,
-    0x08, 0x00, 0x00, 0x07, 0xFD, 0x3C, 0x00, 0x00, 0x0E, 0x6F, 0xF4, 0x00, 0x00, 0x08, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x07, 0x80, 0xF0, 0x00, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0,
-    0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0x00, 0x7D, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00,
-    0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F,
-    0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x29, 0x03,
-    0x40, 0x00, 0xFF, 0xDB, 0x00, 0x02, 0xC2, 0xFE, 0x00, 0x01, 0x40, 0x14, 0x00, 0x00, 0x0A, 0x90,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7D, 0xBC, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F,
-    0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x0F, 0x40,
-    0xBC, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFE, 0x40, 0x6F, 0xD0, 0x07, 0xF0, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0xBC, 0x7D, 0x00, 0x02, 0xF0, 0x0F, 0x40, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x0B, 0xF5, 0x6F, 0xD0, 0x1F, 0x80, 0x03, 0xF0, 0x3F,
-    0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x7D,
-    0x00, 0x00, 0xBC, 0x7D, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xF8, 0x1F,
-    0x40, 0x02, 0xF0, 0x0F, 0xD0, 0x0B, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x02, 0xFF, 0xF9, 0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0xE0, 0x0B, 0xF9, 0x01, 0xBF, 0x6F,
-    0x00, 0x7F, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0xBC, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xFF,
-    0x40, 0x7C, 0x02, 0xFF, 0xFF, 0x4F, 0x80, 0xBE, 0x55, 0xFF, 0xF0, 0x1F, 0x80, 0x03, 0xF8, 0x03,
-    0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x02, 0xFF, 0xF9, 0x00, 0xBC, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0xE0, 0x0B, 0xF9,
-    0x01, 0xBF, 0x6F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-    0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x40, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x02, 0xFF, 0x40, 0x7C, 0x02, 0xFF, 0xFF, 0x4F, 0x80, 0xBE, 0x55, 0xFF, 0xF0, 0x1F, 0x80,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x3E, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x0B, 0xC0,
-    0x7D, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0B, 0xFF, 0xE4, 0x02,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0x80, 0x2F, 0xE4, 0x06, 0xFD, 0xBC, 0x01, 0xFC, 0x00, 0x01,
-    0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00,
-    0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xD0, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0xE0, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01,
-    0xAF, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F,
-    0xF4, 0x07, 0xC0, 0x2F, 0xFF, 0xF4, 0xF8, 0x0B, 0xE5, 0x5F, 0xFF, 0x01, 0xF8, 0x00, 0x3F, 0x80,
-    0x3F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00,
-    0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x38, 0x00, 0x00, 0x02, 0xFB, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBF,
-    0xFE, 0x40, 0x2F, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xF8, 0x02, 0xFE, 0x40, 0x6F, 0xDB, 0xC0, 0x1F,
-    0xC0, 0x00, 0x1F, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x03,
-    0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x2F, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x01,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40,
-    0x00, 0x1F, 0xF4, 0x2C, 0x00, 0x03, 0xEF, 0xFF, 0x80, 0x00, 0x74, 0x1F, 0xF0, 0x00, 0x01, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0xF4, 0x07, 0xC0, 0x2F, 0xFF, 0xF4, 0xF8,
-    0x0B, 0xE5, 0x5F, 0xFF, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x01, 0xF4, 0x03, 0xE0, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x07,
-    0xD0, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x02,
-    0xF0, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0xBF, 0xFE, 0x40, 0x2F, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0xF8, 0x02, 0xFE, 0x40, 0x6F, 0xDB,
-    0xC0, 0x1F, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80,
-    0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x02, 0xFF, 0x40, 0x7C, 0x02, 0xFF, 0xFF,
-    0x4F, 0x80, 0xBE, 0x55, 0xFF, 0xF0, 0x1F, 0x80, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x3E,
-    0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x07, 0xD0, 0x00, 0x0B,
-    0xC0, 0x7D, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xF8, 0x01, 0xF4,
-    0x00, 0x2F, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00, 0x00,
-    0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0x3D,
-    0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE,
-    0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE4, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00,
-    0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x40, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0xF4, 0x00,
-    0x00, 0x3D, 0x3F, 0x00, 0x00, 0x2F, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0xFE, 0x40, 0x2F, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x02, 0xBF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x02, 0x9B, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03,
-    0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0,
-    0x00, 0x7E, 0xBD, 0x00, 0x0F, 0xE3, 0xF4, 0x03, 0xFE, 0x2F, 0xFF, 0xFB, 0xE0, 0x7F, 0xFD, 0x2E,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00, 0xF8, 0x3E,
-    0x7D, 0x00, 0x00, 0x0F, 0x87, 0xC7, 0xD0, 0x00, 0x00, 0xF9, 0xF8, 0x7D, 0x00, 0x00, 0x0F, 0xFE,
-    0x07, 0xD0, 0x00, 0x00, 0xFE, 0x40, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x40,
-    0x1F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0x5A, 0x00, 0x00, 0xA4, 0xBC, 0xBC, 0x00, 0x03, 0xE7, 0xE2, 0xF0,
-    0x00, 0x0F, 0xFE, 0x0B, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03,
-    0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x2F, 0x40,
-    0x03, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x7F, 0xFD, 0x2E,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xC0, 0x00, 0x00,
-    0xF8, 0x3E, 0x7D, 0x00, 0x00, 0x0F, 0x87, 0xC7, 0xD0, 0x00, 0x00, 0xF9, 0xF8, 0x7D, 0x00, 0x00,
-    0x0F, 0xFE, 0x07, 0xD0, 0x00, 0x00, 0xFE, 0x40, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00,
-    0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00,
-    0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xFE, 0x40, 0x1F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x5A, 0x00, 0x00, 0xA4, 0xBC, 0xBC, 0x00, 0x03, 0xE7,
-    0xE2, 0xF0, 0x00, 0x0F, 0xFE, 0x0B, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x7E, 0x00,
-    0x2F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xEF, 0x80, 0x00, 0x7F,
-    0xFD, 0x2E, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x0F, 0x83, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0x7C, 0x7D,
-    0x00, 0x00, 0x0F, 0x9F, 0x87, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x7D, 0x00, 0x00, 0x0F, 0xE4, 0x07,
-    0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80,
-    0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE4, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x7D, 0x68, 0x00, 0x02, 0x92, 0xF2, 0xF0, 0x00, 0x0F, 0x9F, 0x8B, 0xC0, 0x00, 0x3F,
-    0xF8, 0x2F, 0x00, 0x00, 0xFE, 0x40, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B,
-    0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00,
-    0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x0F, 0xE0,
-    0x00, 0xFD, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xBE, 0x00, 0x01, 0xFF, 0xF4, 0xB8, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x0B, 0xFD, 0x0F, 0x00, 0x00, 0x00,
-    0xFB, 0xFF, 0xD0, 0x00, 0x00, 0x2C, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x0F, 0x83, 0xE7, 0xD0, 0x00, 0x00, 0xF8, 0x7C,
-    0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x87, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x7D, 0x00, 0x00, 0x0F, 0xE4,
-    0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8,
-    0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00,
-    0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE4, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x01, 0x00, 0x00, 0x1F, 0xF4, 0x1C, 0x00, 0x00, 0xFB, 0xFF, 0xF0, 0x00, 0x03, 0x41, 0xFF, 0x00,
-    0x00, 0x04, 0x00, 0x10, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD6, 0x80, 0x00, 0x29, 0x2F, 0x2F,
-    0x00, 0x00, 0xF9, 0xF8, 0xBC, 0x00, 0x03, 0xFF, 0x82, 0xF0, 0x00, 0x0F, 0xE4, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0,
-    0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x0F, 0xF8, 0x00, 0x2F, 0xFF, 0xFB,
-    0xE0, 0x00, 0x1F, 0xFF, 0x4B, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x0F, 0x83, 0xE7, 0xD0, 0x00, 0x00,
-    0xF8, 0x7C, 0x7D, 0x00, 0x00, 0x0F, 0x9F, 0x87, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x7D, 0x00, 0x00,
-    0x0F, 0xE4, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00,
-    0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00,
-    0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0,
-    0x00, 0x00, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE4, 0x01, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x5A, 0x00, 0x00, 0xA4, 0xBC, 0xBC,
-    0x00, 0x03, 0xE7, 0xE2, 0xF0, 0x00, 0x0F, 0xFE, 0x0B, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0x00, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0,
-    0x00, 0x7E, 0x00, 0x2F, 0x40, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x3F, 0xE0, 0x00, 0xBF, 0xFF, 0xEF,
-    0x80, 0x00, 0x7F, 0xFD, 0x2E, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x7C, 0x7E, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0xF8, 0x00,
-    0x0F, 0x80, 0x2F, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x0F,
-    0x80, 0xF8, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x29, 0xBC, 0x00, 0x01, 0xF4, 0xF8, 0x00, 0x0B, 0xC2,
-    0xF0, 0x00, 0x3E, 0x07, 0xD0, 0x01, 0xF4, 0x0F, 0x80, 0x0B, 0xC0, 0x2F, 0x00, 0x3E, 0x00, 0x3D,
-    0x01, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x01, 0xF0, 0x3D, 0x00, 0x03, 0xE1, 0xF0, 0x00, 0x0B, 0xCF,
-    0x80, 0x00, 0x0F, 0x7D, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x1F,
-    0x80, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0,
-    0x00, 0xF8, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F,
-    0x00, 0x00, 0x0F, 0xDF, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
-    0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x07,
-    0xD0, 0x3E, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F, 0x00,
-    0x07, 0xC0, 0xF4, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x02, 0xF0, 0xF4, 0x00, 0x0F, 0x83, 0xF0, 0x01, 0xFC, 0x0F, 0x42, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x1F, 0x80, 0x00, 0x0F, 0xC2,
-    0xF0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xF8,
-    0x00, 0x2F, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00, 0x0F, 0xDF,
-    0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x6B, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8,
-    0x00, 0x00, 0xA6, 0xF0, 0x00, 0x07, 0xD3, 0xE0, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40,
-    0x07, 0xD0, 0x3E, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x07, 0xC0, 0x02, 0xF0, 0x3F,
-    0x00, 0x07, 0xC0, 0xF4, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x2F, 0x3E, 0x00, 0x00, 0x3D, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x40, 0x00, 0x3F, 0xE0, 0x74, 0x00, 0x2E,
-    0xBF, 0xFC, 0x00, 0x0E, 0x02, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x01, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x3E,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x3E, 0x03,
-    0xE0, 0x00, 0x0B, 0xC2, 0xF0, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x0F, 0xF8, 0x0E,
-    0x00, 0x7E, 0xFF, 0xF4, 0x03, 0xC0, 0xBF, 0x80, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x0A, 0x6F, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x0F, 0x81, 0xF4,
-    0x00, 0x7D, 0x03, 0xE0, 0x02, 0xF0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40, 0x7C, 0x00, 0x2F, 0x03,
-    0xF0, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0xF8, 0x7C, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x03, 0xDF, 0x40,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x6A, 0xB8, 0xBA, 0xB8,
-    0xA0, 0xE0, 0xA1, 0x80, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0B, 0x00, 0x2E, 0xA9,
-    0x2E, 0xAE, 0x0B, 0x0A, 0x02, 0x4A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A,
-    0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54,
-    0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA,
-    0xAA, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D,
-    0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C,
-    0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03,
-    0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3,
-    0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0, 0x3D, 0x3C, 0x03, 0xD3, 0xC0,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0x80, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x55, 0x43, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x40, 0x07, 0x82, 0xD0,
-    0xF0, 0xBC, 0x3F, 0x0F, 0x8B, 0xD0, 0x50, 0x0F, 0x87, 0xD2, 0xF0, 0xFC, 0x3D, 0x0F, 0x07, 0x80,
-    0x40, 0x0B, 0xC0, 0xFC, 0x0F, 0x80, 0xF4, 0x1F, 0x02, 0xE0, 0x3C, 0x01, 0x40, 0x7D, 0x1F, 0x83,
-    0xE0, 0xBC, 0x1F, 0x03, 0xD0, 0x78, 0x04, 0x07, 0x80, 0xF0, 0x2D, 0x07, 0xC0, 0xF0, 0x3E, 0x0B,
-    0xC0, 0xF4, 0x3F, 0x0B, 0xC0, 0xF8, 0x3F, 0x0B, 0xD0, 0xFC, 0x05, 0x01, 0x40, 0x0F, 0x82, 0xF0,
-    0x7D, 0x0F, 0xC2, 0xF0, 0x3E, 0x0F, 0xC1, 0xF0, 0x3D, 0x0B, 0xC0, 0xF0, 0x3D, 0x07, 0x80, 0xF0,
-    0x04, 0x01, 0x00, 0x0B, 0xC1, 0xF4, 0x3F, 0x07, 0xD0, 0xF8, 0x2F, 0x07, 0xD0, 0xF8, 0x1F, 0x03,
-    0xD0, 0xB8, 0x1F, 0x03, 0xC0, 0xB8, 0x05, 0x00, 0x40, 0x7D, 0x0F, 0x81, 0xF4, 0x3F, 0x03, 0xE0,
-    0xBC, 0x0B, 0xC1, 0xF4, 0x1F, 0x03, 0xD0, 0x3D, 0x0B, 0x80, 0x78, 0x0F, 0x00, 0x40, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x0B, 0x00, 0x02, 0x96, 0xD5, 0xA0, 0xFF, 0xFF, 0xFC, 0x3A, 0xAE, 0xAB, 0x00, 0x07, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x07, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xFC, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x50, 0x74, 0x14, 0x7F, 0xFF,
-    0xFF, 0x1F, 0xEF, 0xAF, 0xC0, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x00, 0xBF, 0x87, 0xFF, 0x6F, 0xFE, 0xBF, 0xFA, 0xFF, 0xE7,
-    0xFF, 0x07, 0xF4, 0x00, 0x00, 0x0D, 0x00, 0x03, 0xE0, 0x00, 0xFF, 0x80, 0x3F, 0xFD, 0x0F, 0xFF,
-    0x83, 0xFF, 0x40, 0xFD, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1F, 0xCB, 0xF1, 0xFC, 0x04,
-    0x00, 0x14, 0x00, 0x24, 0xBE, 0x00, 0xFD, 0xFE, 0x00, 0xFE, 0xBD, 0x00, 0xFD, 0x14, 0x00, 0x10,
-    0x14, 0x00, 0x24, 0x00, 0x52, 0xF8, 0x03, 0xF0, 0x07, 0xFF, 0xE0, 0x1F, 0xD0, 0x2F, 0xEF, 0x40,
-    0x3F, 0x00, 0x7E, 0x14, 0x00, 0x10, 0x00, 0x50, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x6A, 0xA8, 0xBA,
-    0xA8, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
-    0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x2A, 0xA9, 0x2A, 0xAE, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00,
-    0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F, 0xFD, 0x7F,
-    0xFD, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x00, 0x70, 0x00, 0x70,
-    0x00, 0x70, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x0D, 0x00,
-    0x0D, 0x00, 0x0D, 0x00, 0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x07, 0x80, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xC1, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x03, 0xC3, 0xD1, 0xB8, 0x00, 0x1B, 0x90, 0x3C, 0x07, 0x87, 0xC7, 0xFF,
-    0x40, 0x7F, 0xF4, 0x3D, 0x0F, 0x4F, 0x4F, 0x47, 0xC0, 0xF4, 0x7C, 0x1F, 0xFF, 0x2E, 0x1E, 0x03,
-    0xD1, 0xF0, 0x2D, 0x07, 0xF8, 0x3C, 0x2D, 0x01, 0xE2, 0xE0, 0x1E, 0x00, 0x00, 0xB8, 0x3D, 0x01,
-    0xF2, 0xD0, 0x1F, 0x00, 0x00, 0xF0, 0x3D, 0x01, 0xF2, 0xD0, 0x0F, 0x00, 0x02, 0xE0, 0x3D, 0x01,
-    0xF2, 0xD0, 0x0F, 0x00, 0x07, 0xC0, 0x2D, 0x01, 0xE2, 0xE0, 0x1F, 0x00, 0x0F, 0x40, 0x2E, 0x02,
-    0xE1, 0xE0, 0x2E, 0x00, 0x1F, 0x00, 0x0F, 0x03, 0xC0, 0xF0, 0x3D, 0x00, 0x3D, 0x00, 0x0F, 0xEF,
-    0xC0, 0xBE, 0xFC, 0x00, 0xB8, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x07,
-    0xC0, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0xF0, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x0F, 0x0B, 0x82, 0xE4, 0x00, 0x2A, 0x80, 0x01, 0xB8, 0x07, 0xC0,
-    0x7C, 0x3C, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x2F, 0xFC, 0x0F, 0x83, 0xD3, 0xD3, 0xF1, 0xF4, 0x2F,
-    0x5F, 0x81, 0xF4, 0xBC, 0x1F, 0xFF, 0x1F, 0x0F, 0x01, 0xF0, 0xF4, 0x0F, 0x0F, 0x80, 0xF4, 0x1F,
-    0xE0, 0xF4, 0x7C, 0x03, 0xC3, 0xC0, 0x3D, 0x3D, 0x02, 0xE0, 0x00, 0x07, 0xC2, 0xE0, 0x0F, 0x5F,
-    0x00, 0xF4, 0xF0, 0x0B, 0x80, 0x00, 0x3C, 0x0B, 0x80, 0x3D, 0x7C, 0x03, 0xE3, 0xC0, 0x2E, 0x00,
-    0x02, 0xE0, 0x2E, 0x00, 0xF5, 0xF0, 0x0F, 0x4F, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x7C, 0x03, 0xC3,
-    0xC0, 0x3D, 0x3C, 0x02, 0xE0, 0x00, 0xB8, 0x01, 0xF0, 0x1F, 0x0F, 0x00, 0xF0, 0xF4, 0x0F, 0x40,
-    0x03, 0xC0, 0x03, 0xD0, 0xB8, 0x2E, 0x0B, 0xC2, 0xF0, 0x7C, 0x00, 0x2D, 0x00, 0x07, 0xEF, 0xC0,
-    0x7F, 0xBD, 0x03, 0xFB, 0xE0, 0x01, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x00, 0xF0, 0x0F, 0x80, 0x7C,
-    0x03, 0xD0, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x18, 0x00, 0x00, 0xF0, 0x3D, 0x03, 0xE0, 0xBC, 0x07,
-    0xC0, 0xF0, 0x0F, 0x42, 0xE0, 0x1F, 0x03, 0xC0, 0x3C, 0x0B, 0x40, 0x78, 0x0E, 0x00, 0x60, 0x18,
-    0x00, 0x00, 0xF0, 0x3D, 0x0F, 0x40, 0xF8, 0x2F, 0x0B, 0xC0, 0x7C, 0x0F, 0x03, 0xD0, 0x3D, 0x0B,
-    0x82, 0xE0, 0x1F, 0x03, 0xC0, 0xF0, 0x0F, 0x02, 0xD0, 0xB4, 0x07, 0x80, 0xE0, 0x3C, 0x01, 0x80,
-    0x60, 0x18, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
-    0x09, 0x7C, 0x2E, 0x00, 0x3E, 0x0F, 0x40, 0x1F, 0x0B, 0xC0, 0x0B, 0x83, 0xD0, 0x03, 0xC1, 0xF0,
-    0x01, 0xE0, 0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x24, 0x18, 0x7C, 0x2E, 0x0F, 0x40, 0x0F, 0x83, 0xD1,
-    0xF0, 0x01, 0xF0, 0xBC, 0x3E, 0x00, 0x2E, 0x0F, 0x43, 0xC0, 0x03, 0xC1, 0xF0, 0xB8, 0x00, 0x78,
-    0x2D, 0x0F, 0x00, 0x0F, 0x03, 0xC1, 0xE0, 0x00, 0x90, 0x60, 0x28, 0x00, 0x10, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xEF, 0x00, 0x02, 0xC7, 0x40, 0x03, 0x83, 0xC0, 0x0B, 0x01, 0xD0,
-    0x0E, 0x00, 0xF0, 0x2C, 0x00, 0x74, 0x38, 0x00, 0x3C, 0x00, 0x10, 0x03, 0xE0, 0x3F, 0x02, 0xF0,
-    0x1F, 0x41, 0xF4, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x1F, 0x40, 0x2D, 0x00, 0x00,
-    0x10, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xD0, 0x0F, 0xC0, 0xFC, 0x0B, 0xC0,
-    0x7D, 0x03, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xF4,
-    0x00, 0x04, 0x3D, 0x00, 0x1F, 0x80, 0x03, 0xD1, 0xF4, 0x01, 0xF4, 0x00, 0xF8, 0x07, 0xD0, 0x01,
-    0x00, 0x3E, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00, 0x3D, 0x00,
-    0x7F, 0xE0, 0x03, 0xEB, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x7D, 0x00, 0x3F, 0xD0, 0x03, 0xF1, 0x40,
-    0x0F, 0x9F, 0x40, 0x04, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00,
-    0x3E, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0xF8, 0x00, 0xF4, 0x01, 0xF4, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xC1, 0x80, 0x01, 0xF8, 0x00, 0x18,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF2, 0xF4, 0x0F, 0xCB, 0xD0, 0x3F, 0x1F, 0x40,
-    0xFC, 0x7D, 0x02, 0xF1, 0xF0, 0x0B, 0xC7, 0xC0, 0x2F, 0x1F, 0x00, 0xBC, 0x3C, 0x02, 0xF0, 0xF0,
-    0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00, 0x78, 0x3C, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x0D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x02, 0x4B, 0xE0, 0x3F, 0x3F, 0x80, 0xFD, 0xBD, 0x03, 0xF0,
-    0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x80, 0x97, 0xD1, 0xF4,
-    0x00, 0xF4, 0x2F, 0x00, 0x3C, 0x03, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x7C, 0x00, 0xF0, 0x3E,
-    0x00, 0x3C, 0x3F, 0x00, 0x0F, 0x3F, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x7C,
-    0x00, 0x0F, 0xEA, 0xBE, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE4, 0x00, 0x01, 0xFE, 0x5B, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00, 0x0F,
-    0x03, 0xC0, 0x00, 0x00, 0x38, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x2C, 0x00, 0x00,
-    0xE0, 0x00, 0x07, 0x40, 0x00, 0x3C, 0x00, 0x01, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x02,
-    0xFC, 0x00, 0x0E, 0x34, 0x00, 0xB0, 0xF0, 0x03, 0xC1, 0xD0, 0x1D, 0x03, 0x80, 0xF0, 0x0B, 0x07,
-    0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x90,
-    0xB0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2B,
-    0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x03, 0x80, 0xB0, 0x1A, 0x00, 0x38, 0x0B, 0x01, 0xA1,
-    0xFF, 0xBE, 0xFF, 0xC0, 0x1F, 0xFB, 0xEF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xEE, 0x00, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x03, 0xE3, 0xD0, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x02, 0xF0, 0xBC, 0x00, 0x00, 0x2F, 0x0B,
-    0xD0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x1C, 0x02, 0x80, 0x00, 0x01, 0xD0,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0xFF, 0xEB, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80,
-    0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xBF, 0xFA, 0xFF, 0xEB, 0x80, 0x2E, 0x00,
-    0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xE0, 0x0B, 0x80, 0x2F, 0x55, 0xBF, 0xF9,
-    0xAA, 0x90, 0x3F, 0xFC, 0x3F, 0xFD, 0x15, 0x7D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x7D, 0x7F, 0xFD, 0x7F, 0xFD, 0x00, 0x3D,
-    0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D,
-    0x15, 0xBD, 0x3F, 0xFD, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x01,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC0, 0xF4, 0x07, 0xF4, 0xF9, 0x06, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0xBD, 0x7F,
-    0xFF, 0xF8, 0x0B, 0xD3, 0xD0, 0x1F, 0xD0, 0xBD, 0x00, 0x00, 0x3E, 0x0B, 0xD0, 0x00, 0x02, 0xF0,
-    0x7C, 0x00, 0x00, 0x2F, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x7D, 0x07, 0xC0, 0x00,
-    0x1F, 0x80, 0x7C, 0x00, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0xF8, 0x00, 0x3C, 0x00, 0x7D, 0x00, 0x03,
-    0xC0, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x1F, 0xC0, 0x00, 0xFD,
-    0x02, 0xFC, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xBD, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x1F, 0xFF, 0x40, 0xBD, 0x0F, 0xFF, 0xFF, 0x0B, 0xD0, 0xF9, 0x06, 0xF8,
-    0x7D, 0x00, 0x00, 0x0B, 0xC7, 0xD0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00,
-    0x00, 0xBC, 0x7C, 0x00, 0x00, 0x1F, 0x83, 0xC0, 0x00, 0x07, 0xF0, 0x3C, 0x00, 0x01, 0xFC, 0x03,
-    0xC0, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x2D,
-    0x00, 0x03, 0xC0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x18, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55,
-    0x7E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x79, 0x7F, 0xFF, 0xD0, 0x74, 0x2F,
-    0xFF, 0xF0, 0x74, 0x2F, 0xFF, 0xF8, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F,
-    0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F, 0xFF, 0xFC, 0x74, 0x2F,
-    0xFF, 0xF8, 0x74, 0x2F, 0xFF, 0xF4, 0x74, 0x2F, 0xFF, 0xE0, 0x74, 0x2F, 0xFF, 0x80, 0x74, 0x2C,
-    0x50, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C,
-    0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x74, 0x2C, 0x00, 0x00, 0x24, 0x18, 0x00, 0x00, 0x00, 0x6A,
-    0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xF9, 0x7C, 0x2F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF,
-    0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x7F, 0xFF,
-    0xF4, 0x2C, 0x7F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x3F, 0xFF, 0xF4, 0x2C, 0x1F, 0xFF,
-    0xF4, 0x2C, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x6A, 0xAA, 0xA4, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x79, 0x7F, 0xFF, 0xE0, 0x74, 0x3F, 0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF8, 0x74, 0x3F,
-    0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F,
-    0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xFC, 0x74, 0x3F, 0xFF, 0xF4, 0x74, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x90, 0xF0, 0x6E, 0xBF, 0xEF, 0xFF, 0xE6, 0xBF,
-    0xFF, 0xE9, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xBE, 0x00, 0x01, 0xF1, 0xF4, 0x00, 0x3F, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x7E, 0x00, 0x18, 0x02, 0x40, 0x00, 0x07, 0xD0, 0xBF, 0x0B, 0xF0, 0x3D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3E, 0x03, 0xF0, 0x2F,
-    0x00, 0xF4, 0x0F, 0x40, 0x78, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE4, 0x00,
-    0x01, 0xFE, 0x5B, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00, 0x0F, 0x03, 0xC0, 0x00,
-    0x00, 0x38, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x03,
-    0x80, 0xE0, 0x00, 0x00, 0xF0, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0F, 0xEA, 0xBE, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x00, 0x07, 0x90, 0xF0, 0x6E, 0xBF, 0xEF, 0xFF, 0xE6, 0xBF, 0xFF, 0xE9, 0x00,
-    0x3F, 0xC0, 0x00, 0x0B, 0xBE, 0x00, 0x01, 0xF1, 0xF4, 0x00, 0x3F, 0x0F, 0xC0, 0x0B, 0xD0, 0x7E,
-    0x00, 0x18, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x79, 0x0F, 0x06, 0xEB, 0xFE, 0xFF, 0xFE,
-    0x6B, 0xFF, 0xFE, 0x90, 0x03, 0xFC, 0x00, 0x00, 0xBB, 0xE0, 0x00, 0x1F, 0x1F, 0x40, 0x03, 0xF0,
-    0xFC, 0x00, 0xBD, 0x07, 0xE0, 0x01, 0x80, 0x24, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x02, 0xDB, 0xE0,
-    0x0F, 0x2F, 0x40, 0xB8, 0x14, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xC0, 0x00,
-    0x1F, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x3D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x7D,
-    0x3C, 0x02, 0xFA, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x02, 0x83,
-    0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xE3, 0xE0, 0x06, 0xFF, 0xF9, 0x46, 0xF1, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x60, 0x00, 0x00, 0x01, 0x6A, 0x90, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x02, 0xF4, 0x06, 0xF4, 0x00, 0xB4, 0x00, 0x02, 0xD0, 0x1D, 0x00, 0x00, 0x0B, 0x03,
-    0x80, 0x00, 0x00, 0x3C, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x03, 0x42, 0xC0, 0xE0, 0x03, 0xD2, 0xC3, 0xE0, 0x00, 0xF6, 0xCF, 0x80, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x2A, 0xAF, 0xFE, 0xA9, 0x00, 0x3F, 0xFD,
-    0x00, 0x00, 0xFA, 0xDF, 0x40, 0x03, 0xE2, 0xC7, 0xD0, 0x07, 0x82, 0xC1, 0xF0, 0x01, 0x02, 0xC0,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x50, 0x00, 0xF0, 0x7C, 0x1F, 0x07, 0xC0, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x07,
-    0xC1, 0xF0, 0x7C, 0x1F, 0x00, 0xF4, 0x3D, 0x0F, 0x43, 0xD0, 0x1F, 0x07, 0xC1, 0xE0, 0x78, 0x03,
-    0xC0, 0xF0, 0x3C, 0x0F, 0x00, 0x78, 0x1E, 0x07, 0x81, 0xD0, 0x06, 0x02, 0x80, 0xA0, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE3,
-    0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3E,
-    0x7F, 0x7E, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x3E, 0x7F, 0x3E, 0x04, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x47,
-    0xF0, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xFE, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3D, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0xE0, 0x2E,
-    0x02, 0xFC, 0x00, 0xBE, 0x02, 0xE0, 0x1F, 0x80, 0x02, 0x80, 0x2E, 0x00, 0xA0, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x6A, 0xAA,
-    0xBF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xBF, 0xAA, 0xAA, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01,
-    0x40, 0x2E, 0x00, 0x50, 0x00, 0x7E, 0x02, 0xE0, 0x2F, 0x40, 0x0B, 0xE0, 0x2E, 0x03, 0xF8, 0x00,
-    0x3D, 0x02, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0xBD, 0xFE, 0xBE, 0x24, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x14, 0xBE, 0xFE, 0xBD, 0x14, 0x00, 0xBD, 0xFE, 0xFE,
-    0x38, 0x00, 0x00, 0xBD, 0xFE, 0xFE, 0x28, 0x00, 0x14, 0xBD, 0xFE, 0xBE, 0x14, 0x00, 0x24, 0xBE,
-    0xFE, 0xBD, 0x14, 0x00, 0x00, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F,
-    0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x70, 0x0D, 0x70, 0x0D, 0x70, 0x0D, 0x70,
-    0x0D, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x07,
-    0xD0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07,
-    0xD0, 0x0F, 0xF0, 0x2F, 0xF8, 0x3F, 0xFC, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x0B,
-    0xE0, 0x38, 0x2C, 0x38, 0x2C, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x7F,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x7F, 0xFD, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0xF8, 0x00, 0xFF, 0xF0, 0x2E, 0x0B, 0xC3, 0xC0, 0x3C, 0x7C, 0x02, 0xD7, 0x80, 0x2E, 0x78, 0x01,
-    0xE7, 0x80, 0x1E, 0x7C, 0x02, 0xE3, 0xC0, 0x3D, 0x3E, 0x07, 0xC1, 0xFF, 0xF4, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xD2, 0x00, 0x71, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x74, 0x80, 0x00, 0x0A, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0x00, 0x0E, 0xF0, 0x03, 0xCF, 0x00, 0xB4, 0xF0, 0x1E, 0x0F, 0x03, 0xC0,
-    0xF0, 0xBE, 0xAF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x0A, 0xAA,
-    0x41, 0xFF, 0xF8, 0x2D, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0xFF, 0xD0, 0x2E, 0xBF, 0x80,
-    0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x10, 0x03, 0xC3, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x7F, 0xF8, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00, 0x07, 0xAF, 0xF4,
-    0x7F, 0x9B, 0xC7, 0xC0, 0x2E, 0x78, 0x01, 0xE3, 0xC0, 0x1E, 0x3D, 0x03, 0xD0, 0xFA, 0xFC, 0x03,
-    0xFE, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x93, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F,
-    0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF9, 0x00, 0xFF, 0xF4, 0x3D, 0x03, 0xC3, 0xC0, 0x3C, 0x2E,
-    0x07, 0xC0, 0xFE, 0xF0, 0x07, 0xFE, 0x01, 0xF5, 0xF8, 0x3C, 0x03, 0xD7, 0x80, 0x2D, 0x3C, 0x03,
-    0xD2, 0xFA, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFF, 0xF4, 0x3C, 0x07, 0xC7,
-    0x80, 0x2D, 0x78, 0x01, 0xE7, 0x80, 0x2E, 0x3E, 0x5B, 0xE1, 0xFF, 0xDD, 0x01, 0x52, 0xD0, 0x00,
-    0x3C, 0x00, 0x0B, 0x81, 0xAB, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x03, 0x80, 0xFF, 0xFF, 0x57, 0xD5, 0x03, 0x80, 0x03, 0x80, 0x02, 0x40, 0x00, 0x00, 0xFF,
-    0xFF, 0x55, 0x55, 0xAA, 0xAA, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0x40, 0x38, 0x0F, 0x01, 0xE0, 0x2C, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x3C, 0x03,
-    0xC0, 0x2D, 0x00, 0xE0, 0x0B, 0x00, 0x3C, 0x00, 0x00, 0x50, 0x0F, 0x01, 0xD0, 0x3C, 0x0B, 0x01,
-    0xD0, 0x38, 0x0F, 0x03, 0xC0, 0xE0, 0x38, 0x1D, 0x0B, 0x03, 0xC2, 0xD1, 0xE0, 0x00, 0x00, 0x71,
-    0xFE, 0x07, 0xF5, 0xB8, 0x7C, 0x02, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01,
-    0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC2, 0x00, 0x18, 0x02, 0xF8, 0x00, 0xFF, 0xF0, 0x2E, 0x0B, 0xC3,
-    0xC0, 0x3C, 0x7C, 0x02, 0xD7, 0x80, 0x2E, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x7C, 0x02, 0xE3, 0xC0,
-    0x3D, 0x3E, 0x07, 0xC1, 0xFF, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xA0, 0xBF, 0x3E, 0xFB,
-    0x4F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x06,
-    0xF8, 0x0F, 0xFF, 0xD2, 0x80, 0xBC, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x0B, 0xF9, 0x03,
-    0xFF, 0xF4, 0x24, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x16, 0xF0, 0x0B, 0xFD, 0x00, 0x01,
-    0xFC, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xCB, 0xEA, 0xF8, 0x2F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x00, 0x0E, 0xF0, 0x03, 0xCF, 0x00, 0xB4, 0xF0, 0x1E,
-    0x0F, 0x03, 0xC0, 0xF0, 0xBE, 0xAF, 0xAB, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x0A, 0xAA, 0x41, 0xFF, 0xF8, 0x2D, 0x00, 0x02, 0xC0, 0x00, 0x2C, 0x00, 0x03, 0xFF, 0xD0,
-    0x2E, 0xBF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x10, 0x03, 0xC3, 0xEA, 0xF8, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xF8, 0x0F, 0x40, 0x02, 0xD0, 0x00, 0x3C, 0x00,
-    0x07, 0xAF, 0xF4, 0x7F, 0x9B, 0xC7, 0xC0, 0x2E, 0x78, 0x01, 0xE3, 0xC0, 0x1E, 0x3D, 0x03, 0xD0,
-    0xFA, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x93, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x78, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x00,
-    0x02, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0x02, 0xF9, 0x00, 0xFF, 0xF4, 0x3D, 0x03, 0xC3,
-    0xC0, 0x3C, 0x2E, 0x07, 0xC0, 0xFE, 0xF0, 0x07, 0xFE, 0x01, 0xF5, 0xF8, 0x3C, 0x03, 0xD7, 0x80,
-    0x2D, 0x3C, 0x03, 0xD2, 0xFA, 0xFC, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x01, 0xFF, 0xF4,
-    0x3C, 0x07, 0xC7, 0x80, 0x2D, 0x78, 0x01, 0xE7, 0x80, 0x2E, 0x3E, 0x5B, 0xE1, 0xFF, 0xDD, 0x01,
-    0x52, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x81, 0xAB, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFF, 0x57, 0xD5, 0x03, 0x80, 0x03, 0x80, 0x02, 0x40,
-    0x00, 0x00, 0xFF, 0xFF, 0x55, 0x55, 0xAA, 0xAA, 0xFF, 0xFE, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF,
-    0x00, 0x00, 0x01, 0x40, 0x38, 0x0F, 0x01, 0xE0, 0x2C, 0x03, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03,
-    0x80, 0x3C, 0x03, 0xC0, 0x2D, 0x00, 0xE0, 0x0B, 0x00, 0x3C, 0x00, 0x00, 0x50, 0x0F, 0x01, 0xD0,
-    0x3C, 0x0B, 0x01, 0xD0, 0x38, 0x0F, 0x03, 0xC0, 0xE0, 0x38, 0x1D, 0x0B, 0x03, 0xC2, 0xD1, 0xE0,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0xFA, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x02, 0xBF, 0xC1, 0xF5,
-    0x6C, 0x3C, 0x02, 0xC3, 0x80, 0x3C, 0x3D, 0x5F, 0xC0, 0xBF, 0x4C, 0x06, 0xE4, 0x0B, 0xAB, 0x87,
-    0x40, 0x76, 0xC0, 0x0E, 0xFF, 0xFF, 0xBD, 0x55, 0x5F, 0x00, 0x01, 0xD0, 0x00, 0x3E, 0x56, 0x41,
-    0xFF, 0x80, 0x06, 0xE4, 0x02, 0xFA, 0xF0, 0x78, 0x03, 0xCF, 0x00, 0x2C, 0xF0, 0x01, 0xDF, 0x00,
-    0x1D, 0xF0, 0x01, 0xD7, 0x40, 0x3C, 0x3E, 0x5F, 0x40, 0x7F, 0x80, 0x24, 0x01, 0x82, 0xC0, 0x38,
-    0x0F, 0x0F, 0x00, 0x3A, 0xC0, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x03, 0xAC, 0x00, 0xF0, 0xF0, 0x2C,
-    0x03, 0x87, 0x40, 0x1D, 0x06, 0xE8, 0x02, 0xEA, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x1D, 0x00, 0x01,
-    0xE3, 0xFF, 0xFE, 0x3C, 0x00, 0xD2, 0xC0, 0x2C, 0x0F, 0x5B, 0x80, 0x2F, 0xD0, 0x20, 0x00, 0x07,
-    0x40, 0x00, 0x74, 0x00, 0x07, 0x40, 0x00, 0x75, 0xA9, 0x07, 0xBA, 0xF8, 0x7C, 0x03, 0xC7, 0x40,
-    0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x00, 0x1C,
-    0x20, 0x00, 0x1D, 0x00, 0x07, 0x40, 0x01, 0xD0, 0x00, 0x74, 0x06, 0x1D, 0x07, 0x87, 0x47, 0x81,
-    0xD7, 0x80, 0x7B, 0xC0, 0x1F, 0xB4, 0x07, 0x4B, 0x41, 0xD0, 0xF0, 0x74, 0x0F, 0x1C, 0x01, 0xE0,
-    0x21, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xD7, 0x5D, 0x75, 0xC0, 0x21, 0xB8, 0x0A, 0x90, 0x7B,
-    0xAF, 0x7A, 0xF8, 0x7C, 0x03, 0xD0, 0x2C, 0x74, 0x03, 0xC0, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74,
-    0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x74, 0x03, 0x80, 0x1C, 0x70,
-    0x02, 0x80, 0x1C, 0x21, 0xB9, 0x07, 0xBA, 0xF8, 0x7C, 0x03, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7,
-    0x40, 0x1C, 0x74, 0x01, 0xC7, 0x40, 0x1C, 0x74, 0x01, 0xC7, 0x00, 0x1C, 0x21, 0xB9, 0x07, 0xBA,
-    0xF4, 0x7C, 0x03, 0xC7, 0x40, 0x1D, 0x74, 0x00, 0xE7, 0x40, 0x0E, 0x74, 0x01, 0xE7, 0xC0, 0x2C,
-    0x7E, 0x5B, 0x87, 0x6F, 0xD0, 0x74, 0x00, 0x07, 0x40, 0x00, 0x74, 0x00, 0x07, 0x40, 0x00, 0x06,
-    0xE9, 0x0B, 0xAB, 0x83, 0x80, 0x00, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0x40, 0x00, 0xF0, 0x00,
-    0x1C, 0x39, 0x5F, 0x0B, 0xFE, 0x00, 0x09, 0x00, 0x34, 0x02, 0xFA, 0x1B, 0xE8, 0x1D, 0x00, 0x74,
-    0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00, 0x34, 0x00, 0xF5, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x14, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0xAA, 0xA9, 0xF8, 0x03, 0xFF, 0xFB, 0xE0, 0x0F, 0x95,
-    0x4F, 0xC0, 0x3D, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x3F, 0x03, 0xD0, 0x00, 0x7F, 0xAF, 0xAA, 0x80,
-    0x7F, 0xFF, 0xFF, 0x00, 0x05, 0xF9, 0x54, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0xE0, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFC, 0x02, 0xFF, 0xDB, 0xF8, 0x0B, 0xFB, 0x43, 0x90, 0x1F, 0xCB, 0x07, 0x40, 0x3F, 0x0F,
-    0x0B, 0x00, 0x3E, 0x0F, 0x0F, 0x00, 0x7D, 0x1E, 0x0F, 0x00, 0x7C, 0x1D, 0x0E, 0x00, 0xBC, 0x2C,
-    0x1D, 0x00, 0x7C, 0x3C, 0x2C, 0x00, 0x7C, 0x3C, 0x3C, 0x00, 0x3D, 0x78, 0x3C, 0x00, 0x3F, 0x74,
-    0x38, 0x00, 0x2F, 0xF0, 0x74, 0x00, 0x0F, 0xF0, 0xB0, 0x00, 0x07, 0xF9, 0xF0, 0x64, 0x01, 0xFF,
-    0xFF, 0xF4, 0x01, 0xEF, 0xFF, 0xE0, 0x02, 0xC1, 0xD0, 0x00, 0x03, 0xC2, 0xC0, 0x00, 0x02, 0x82,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0xFF, 0x40,
-    0x6C, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0xF4, 0x0A, 0x1B, 0xD7, 0xC0, 0x3E, 0xFF, 0x1F, 0x00, 0xFF, 0x44, 0x7C,
-    0x03, 0xF0, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xD0, 0x3D, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x2F, 0x03,
-    0xD0, 0x00, 0x7E, 0x0F, 0x40, 0x00, 0xFD, 0x3D, 0x00, 0x00, 0xFD, 0xF4, 0x14, 0x01, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x3E, 0x55, 0x55, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x1B, 0xFE, 0xA8, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x7F, 0x40, 0x74, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x3F, 0xFF, 0xFF, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2A, 0xFE, 0xAA, 0x00,
-    0x3F, 0xFF, 0xFF, 0x40, 0x15, 0xF9, 0x55, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x1F, 0xD5, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x64, 0x2F, 0xE4, 0x3E, 0xFE, 0x42, 0xF3, 0xFF, 0xF9,
-    0xFF, 0xFF, 0x8B, 0xFE, 0x57, 0xFF, 0xD5, 0x7F, 0x6F, 0xC0, 0x03, 0xFC, 0x00, 0x3E, 0xBE, 0x00,
-    0x0B, 0xD0, 0x00, 0xFE, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xEF,
-    0x00, 0x03, 0xF0, 0x00, 0x2F, 0xBC, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0xF0, 0x00, 0xFF, 0x00, 0x02,
-    0xFB, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xEF, 0x00, 0x3E, 0xF0, 0x00, 0x2F, 0xBC, 0x01, 0xEB, 0xC0,
-    0x00, 0xBE, 0xF0, 0x0F, 0x2F, 0x00, 0x02, 0xFB, 0xC0, 0x78, 0xBC, 0x00, 0x0B, 0xEF, 0x03, 0xC2,
-    0xF0, 0x00, 0x2F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xF0, 0x01, 0xFC,
-    0x00, 0x3C, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x1F, 0xF0, 0x03, 0xC0, 0x07, 0xBD, 0x00, 0xF0, 0x01,
-    0xEB, 0x80, 0x3C, 0x00, 0x7D, 0xF0, 0x0F, 0x01, 0xBF, 0xBE, 0xAB, 0xE8, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x46, 0xF5, 0xF5, 0x7D, 0x40, 0x7C, 0x3E, 0x0F, 0x01, 0x6F, 0x5B, 0xD7, 0xD4, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x5A, 0xFA, 0xBF, 0xBE, 0x80, 0x7C, 0x07, 0xCF, 0x00, 0x1F, 0x00, 0xF7, 0xC0, 0x07, 0xC0,
-    0x2F, 0xF0, 0x01, 0xF0, 0x03, 0xFC, 0x00, 0x7C, 0x00, 0xFF, 0x00, 0x1F, 0x00, 0x2F, 0xC0, 0x07,
-    0xC0, 0x03, 0xF0, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFD, 0x6F,
-    0xF4, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x3D,
-    0x00, 0x00, 0xFC, 0x00, 0x3D, 0x0B, 0x00, 0xFC, 0x00, 0x3D, 0x0F, 0x00, 0xFC, 0x00, 0xBC, 0x1F,
-    0x00, 0xFC, 0x01, 0xFD, 0xFF, 0xFC, 0xFD, 0x6F, 0xF2, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x1F, 0x00,
-    0xFF, 0xF9, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x5B, 0xF0,
-    0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x0B,
-    0xC0, 0x6F, 0xE0, 0xBC, 0x00, 0xBC, 0x1F, 0xFF, 0xCB, 0xC0, 0x0B, 0xC3, 0xE4, 0x74, 0xBC, 0x00,
-    0xF8, 0x7C, 0x00, 0x0B, 0xC0, 0x2F, 0x07, 0xC0, 0x00, 0xBF, 0xFF, 0xD0, 0x7E, 0x00, 0x0B, 0xFF,
-    0xF4, 0x03, 0xF8, 0x00, 0xBD, 0x6F, 0x00, 0x0F, 0xF4, 0x0B, 0xC0, 0xF8, 0x00, 0x2F, 0xF0, 0xBC,
-    0x0B, 0xC0, 0x00, 0x3F, 0x8B, 0xC0, 0x3E, 0x00, 0x00, 0xFC, 0xBC, 0x02, 0xF0, 0x00, 0x07, 0xCB,
-    0xC0, 0x1F, 0x40, 0x00, 0x7C, 0xBC, 0x00, 0xFC, 0x90, 0x0F, 0xCB, 0xC0, 0x07, 0xDB, 0xFF, 0xF4,
-    0xBC, 0x00, 0x3E, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0x7C,
-    0x3C, 0x00, 0xFD, 0x00, 0x7C, 0x3C, 0x00, 0xFE, 0x00, 0xB8, 0x3D, 0x00, 0xFF, 0x00, 0xF4, 0x2E,
-    0x01, 0xEF, 0x00, 0xF4, 0x2E, 0x02, 0xDF, 0x00, 0xF0, 0x1F, 0x02, 0xDB, 0x41, 0xF0, 0x0F, 0x03,
-    0xC7, 0x81, 0xF0, 0x0F, 0x03, 0xC7, 0x82, 0xE0, 0x6F, 0xAB, 0xEB, 0xEB, 0xF8, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x1B, 0xDF, 0x97, 0xE7, 0xD4, 0x07, 0xCB, 0x42, 0xD3, 0xC0, 0x03, 0xCF, 0x01, 0xE3,
-    0xC0, 0x03, 0xCF, 0x00, 0xE7, 0x80, 0x03, 0xDE, 0x00, 0xF7, 0x40, 0x02, 0xEE, 0x00, 0xFB, 0x40,
-    0x01, 0xFD, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0xFC, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xA0, 0x00, 0x7E, 0xFF, 0xFF, 0xF4, 0x01, 0xFB, 0xC0, 0x07,
-    0xF4, 0x07, 0xEF, 0x00, 0x03, 0xF0, 0x1F, 0xBC, 0x00, 0x07, 0xC0, 0x7E, 0xF0, 0x28, 0x0F, 0x41,
-    0xFB, 0xC0, 0xF0, 0x3D, 0x07, 0xEF, 0x03, 0xC0, 0xF4, 0x1F, 0xBC, 0x0F, 0x03, 0xD0, 0x7E, 0xF0,
-    0x3C, 0x0F, 0x41, 0xFB, 0xC0, 0xF0, 0x3D, 0x07, 0xEF, 0x03, 0xC0, 0xF4, 0x1F, 0xBC, 0x0F, 0x03,
-    0xD0, 0x7E, 0xF0, 0x3C, 0x0F, 0x41, 0xFB, 0xC0, 0xF0, 0x3D, 0x07, 0xEF, 0x03, 0xC0, 0xA4, 0x2F,
-    0xBC, 0x0F, 0x00, 0x00, 0xFA, 0xF0, 0x3C, 0x00, 0x07, 0xDB, 0xC0, 0xF0, 0x00, 0xBF, 0x2F, 0x03,
-    0xFF, 0xFF, 0xF0, 0xBC, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2A, 0xAB, 0xF9, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01, 0x55,
-    0x7E, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x01, 0xBE, 0x43, 0xD0, 0x03, 0xFF, 0xFC, 0xF4, 0x03, 0xFD,
-    0x5B, 0xFD, 0x01, 0xF8, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3E, 0x00, 0x01, 0xF4, 0x1F,
-    0x40, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x03, 0xD0, 0x7D, 0x00, 0x00, 0xF4,
-    0x0F, 0x40, 0x00, 0x3D, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x0B,
-    0xF4, 0x01, 0xFF, 0xFF, 0x7D, 0x00, 0x1F, 0xFF, 0x4B, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x1A, 0xAA, 0xAA, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0x41, 0xB8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x17, 0xE5, 0x55, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x02, 0xBF, 0xAA, 0xA4, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x28, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x50,
-    0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0xF4, 0x00, 0x2F, 0x40, 0x3D, 0x00, 0x1F, 0x40, 0x0F, 0x40,
-    0x0F, 0x80, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0xF4, 0x0B, 0xC0, 0x00, 0x3D, 0x0B, 0xD0, 0x00, 0x0F,
-    0x47, 0xD0, 0x00, 0x03, 0xD3, 0xE0, 0x00, 0x1A, 0xFF, 0xFA, 0xAA, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x5F, 0xFB, 0xD5, 0x40, 0x03, 0xF0, 0xF8, 0x00, 0x00, 0xF4, 0x1F, 0x40, 0x00, 0x3D, 0x02, 0xF0,
-    0x00, 0x0F, 0x40, 0x3F, 0x00, 0x03, 0xD0, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00,
-    0x0F, 0xC0, 0x0F, 0x40, 0x01, 0xF8, 0x03, 0xD0, 0x00, 0x2F, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x7F, 0x55, 0x50, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x28, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x05, 0x00, 0x0F, 0xDF, 0x8F, 0xC0, 0x03, 0xC3,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02,
-    0xFB, 0xE0, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x00, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2D, 0x40, 0x6F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x6A, 0x40,
-    0x03, 0xE0, 0x00, 0x3F, 0x02, 0xFF, 0xF0, 0x03, 0xD0, 0x00, 0x3E, 0x0B, 0xE6, 0xFC, 0x07, 0xC0,
-    0x00, 0xBC, 0x0F, 0x40, 0x7C, 0x07, 0xC0, 0x01, 0xF8, 0x2F, 0x00, 0x7C, 0x0B, 0xC0, 0x07, 0xF0,
-    0x3E, 0x00, 0x7C, 0x0F, 0x80, 0x2F, 0xC0, 0x3D, 0x00, 0xBC, 0x0F, 0x96, 0xFF, 0x00, 0x7E, 0x02,
-    0xF4, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x2F, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x02, 0xF0, 0xFC,
-    0x00, 0x03, 0xD0, 0x7C, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x03, 0xE0, 0xB8,
-    0x00, 0x02, 0xF0, 0xF4, 0x00, 0x01, 0xF0, 0xF0, 0x00, 0x00, 0xF5, 0xE0, 0x00, 0x00, 0xFB, 0xD0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x40, 0x3F, 0x00, 0x00, 0xC0, 0x7F, 0x40,
-    0x02, 0xF0, 0xFF, 0xC0, 0x03, 0xF6, 0xE7, 0xC0, 0x0F, 0xFF, 0xC3, 0xE0, 0x1F, 0x3F, 0x82, 0xF0,
-    0x3E, 0x0F, 0x00, 0xF4, 0x7C, 0x09, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x3D, 0x56, 0xFD,
-    0x00, 0x0F, 0x40, 0x1F, 0xC0, 0x6B, 0xFA, 0xAB, 0xFA, 0x6F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3D, 0x00,
-    0x0F, 0x80, 0x0F, 0x40, 0x03, 0xE0, 0x6B, 0xEA, 0xAA, 0xFA, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x3D,
-    0x00, 0x3F, 0x00, 0x0F, 0x40, 0x7F, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0x9F, 0x1B, 0xC0, 0x0F, 0xE0, 0x3C, 0x00, 0x00, 0xBE, 0x00, 0xF0, 0x00, 0x03,
-    0xF0, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x00,
-    0xF0, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xF0, 0xF8, 0x00, 0x3F, 0xFF,
-    0xC3, 0xE0, 0x00, 0xF5, 0x6F, 0x0F, 0xC0, 0x03, 0xC0, 0xBC, 0x2F, 0x00, 0x0F, 0x02, 0xF0, 0x7E,
-    0x00, 0x3C, 0x0B, 0xC0, 0xFD, 0x00, 0xF0, 0x2F, 0x01, 0xFD, 0x03, 0xC0, 0xBC, 0x02, 0xFE, 0x5F,
-    0x06, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0x7F, 0x00,
-    0x00, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xF4, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x1F, 0x40,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0xF8, 0x00,
-    0x03, 0xE0, 0x1F, 0x40, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x0F, 0xC7,
-    0xD0, 0x00, 0x00, 0xBC, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xE4, 0x1B, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x02, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xE4, 0x01, 0xB8, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xAD, 0x6F, 0x00, 0xFE, 0x0B, 0x40, 0x00, 0xFD,
-    0x02, 0xD0, 0x00, 0x7F, 0x00, 0xB4, 0x00, 0x2F, 0x40, 0x2D, 0x00, 0x0F, 0xC0, 0x0B, 0x40, 0x03,
-    0xE0, 0x02, 0xD0, 0x00, 0xF8, 0x00, 0xB4, 0x00, 0x3E, 0x00, 0x2D, 0x00, 0x0F, 0x80, 0x0B, 0x40,
-    0x03, 0xE0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0xB4, 0x00, 0x2F, 0x00, 0x2D, 0x00, 0x07, 0xE0, 0x0B,
-    0x40, 0x00, 0xFC, 0x02, 0xD0, 0x00, 0x1F, 0xC0, 0xB4, 0x00, 0x02, 0xFE, 0x6D, 0x1A, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x1D, 0x00, 0x74, 0x00, 0x02, 0xD0, 0x0B,
-    0x40, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x0B, 0xFA, 0xAF, 0xEA, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x17,
-    0xE5, 0xAF, 0x95, 0x40, 0x3D, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x01, 0xF4,
-    0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x01, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D,
-    0x01, 0xF4, 0x00, 0x03, 0xD0, 0x1F, 0x40, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x03, 0xD0, 0x0F, 0x40,
-    0x00, 0x3D, 0x00, 0xFC, 0x00, 0x03, 0xD0, 0x0B, 0xFF, 0xC0, 0x3D, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x01, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1A, 0x0A,
-    0x82, 0xA0, 0x3E, 0x3B, 0xBA, 0xEE, 0xBC, 0x2F, 0x73, 0xD0, 0xF4, 0x2C, 0x2E, 0x3B, 0xC0, 0xB0,
-    0x1C, 0x3D, 0x1F, 0xC0, 0xB0, 0x1D, 0xFC, 0x07, 0xFE, 0xF5, 0x6F, 0xF0, 0x02, 0xEF, 0xFF, 0xFF,
-    0x40, 0x02, 0xC0, 0xB5, 0x6C, 0x00, 0x02, 0xC0, 0xB0, 0x1C, 0x00, 0x00, 0x40, 0x10, 0x04, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0x1F, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF4, 0x00, 0x3E, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x2F, 0x80, 0x0B, 0xFF, 0x80, 0x02, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x01, 0x00, 0x01, 0xF0, 0x2F, 0x00, 0x01, 0xFB, 0xFE, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x7A, 0xF0, 0x1B, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x3E, 0x01, 0xF0, 0x00,
-    0x3E, 0x01, 0xF0, 0x00, 0x7D, 0x01, 0xF0, 0x00, 0xBC, 0x01, 0xF0, 0x01, 0xF8, 0x01, 0xF0, 0x07,
-    0xF0, 0x01, 0xF4, 0x6F, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xD0, 0x00,
-    0x00, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x3C,
-    0x00, 0x00, 0x00, 0x03, 0xE5, 0xF9, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xAF, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x40, 0x00, 0x2C, 0x00, 0x0F, 0x0F, 0x47, 0x80, 0xB0, 0x00, 0x3D, 0xFF, 0xBF,
-    0x82, 0xC0, 0x00, 0xFF, 0x5F, 0xCB, 0xEE, 0x00, 0x03, 0xF4, 0x1C, 0x07, 0xF0, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xF9, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x02, 0xFF, 0xBF, 0xBF, 0xF0, 0x02, 0xFD, 0x0B, 0xC0, 0xBF, 0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xE0,
-    0xBC, 0x00, 0xBC, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0x4F, 0x80, 0x0B, 0xC0, 0x03, 0xE3,
-    0xD0, 0x02, 0xF0, 0x00, 0xF9, 0xF4, 0x00, 0xBC, 0x00, 0x3E, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0x9F,
-    0x40, 0x00, 0x00, 0x03, 0xE7, 0xD0, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x7D,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xE5, 0x5B,
-    0xF8, 0x03, 0xD0, 0x00, 0xFD, 0x03, 0xD0, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x3F, 0x03, 0xD0, 0x00,
-    0x3F, 0x03, 0xD0, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x7D, 0x03, 0xD0, 0x01, 0xFC, 0x6B, 0xFE, 0xBF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0x80, 0x6B, 0xFA, 0x94, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x00, 0x00, 0x02,
-    0xC1, 0xD0, 0x00, 0x00, 0x03, 0xEA, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xEB,
-    0xFF, 0x40, 0x03, 0xFB, 0xC1, 0xEF, 0xD0, 0x0B, 0xD2, 0xC1, 0xD3, 0xF0, 0x0F, 0x82, 0xC1, 0xD0,
-    0xF8, 0x2F, 0x42, 0xC1, 0xD0, 0xBC, 0x3F, 0x02, 0xC1, 0xD0, 0x7D, 0x3F, 0x02, 0xC1, 0xD0, 0x3E,
-    0x3E, 0x02, 0xC1, 0xD0, 0x3E, 0x3E, 0x02, 0xC1, 0xD0, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xD1, 0xC0, 0x00,
-    0x1D, 0x2D, 0x00, 0x01, 0xD2, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xE5, 0x6F,
-    0xF4, 0x3D, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0xFC, 0x3D, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0xFC, 0x3D,
-    0x00, 0x0F, 0x83, 0xD0, 0x07, 0xF0, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x3E, 0x01, 0xBF,
-    0x43, 0xD0, 0x00, 0xFC, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0x3E, 0x3D, 0x00, 0x03, 0xE3, 0xD0,
-    0x00, 0x7D, 0x3D, 0x00, 0x0F, 0xC3, 0xE0, 0x17, 0xF8, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40,
-    0x01, 0xD2, 0xD0, 0x00, 0x1D, 0x2D, 0x00, 0x01, 0xD1, 0xD0, 0x00, 0x00, 0x6F, 0xF8, 0x03, 0xFF,
-    0xFE, 0x0F, 0xF5, 0x6D, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0xD0, 0x05, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0xFD, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x15, 0x55, 0x55, 0x52, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x0F, 0xE9, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFF, 0x86, 0xE0, 0x2F, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFD,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xD7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00,
+static const uint8_t notosans_14_regularBitmaps[39598] = {
+    0xAD, 0x9A, 0xD9, 0xAD, 0x99, 0xD9, 0x9D, 0x99, 0xD0, 0x9D, 0x09, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+    0xD1, 0xD1, 0xD7, 0x19, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x0D, 0xA1, 0xAD, 0x0D, 0xA1,
+    0xAD, 0x0D, 0x91, 0xAD, 0x0D, 0x91, 0xAC, 0xA0, 0xD9, 0x19, 0xCA, 0x0A, 0xC9, 0x19, 0xCA, 0x0A,
+    0xC2, 0x9C, 0xA0, 0x9A, 0x3A, 0x90, 0x6A, 0xC3, 0x9C, 0x97, 0x1D, 0x3A, 0xC9, 0x71, 0xD3, 0xD7,
+    0x19, 0xCA, 0x3D, 0x71, 0xAC, 0xA2, 0x9C, 0xA7, 0x1D, 0x92, 0x9C, 0xA5, 0xAA, 0xAA, 0xDA, 0xAA,
+    0xAE, 0xAA, 0xA2, 0xFF, 0xFF, 0x29, 0x99, 0xAD, 0x99, 0x99, 0xD9, 0x99, 0x95, 0xAC, 0xA2, 0x9D,
+    0x71, 0xAC, 0x92, 0x9C, 0xA7, 0x1D, 0x3A, 0xC9, 0x71, 0xD3, 0xD5, 0x9F, 0xFF, 0xF2, 0xFF, 0xFF,
+    0x5A, 0xC9, 0x29, 0xCA, 0x71, 0xD3, 0xAC, 0x97, 0x1D, 0x3D, 0x72, 0xD3, 0xD7, 0x19, 0xCA, 0x29,
+    0xD7, 0x1A, 0xC9, 0x29, 0xCA, 0x60, 0x77, 0x4A, 0xC9, 0x73, 0xAC, 0x97, 0x19, 0x9D, 0xAA, 0x95,
+    0x9F, 0xFD, 0x29, 0xFD, 0xAF, 0x2E, 0x1A, 0xC9, 0x19, 0x92, 0xD9, 0x1A, 0xC9, 0x6D, 0x91, 0xAC,
+    0x96, 0xE1, 0xAC, 0x96, 0xAE, 0x9A, 0xC9, 0x7A, 0xFC, 0xA7, 0x09, 0xFE, 0x97, 0x0F, 0xDA, 0x7A,
+    0xC9, 0x9E, 0xA6, 0xAC, 0x91, 0xE6, 0xAC, 0x91, 0x9D, 0x6A, 0xC9, 0x1A, 0xD1, 0xA9, 0x2A, 0xC9,
+    0x09, 0xDA, 0x1F, 0xAF, 0xE2, 0xFF, 0xDA, 0x59, 0x9A, 0xDA, 0x97, 0x2A, 0xC9, 0x73, 0xAC, 0x97,
+    0x39, 0xA6, 0x77, 0x7A, 0xEA, 0x79, 0xCA, 0x49, 0xDA, 0xE6, 0xD9, 0x4D, 0x91, 0xD9, 0x4A, 0xCA,
+    0x49, 0xD2, 0x9C, 0xA4, 0xD5, 0x9C, 0xA3, 0xD3, 0xAC, 0xA5, 0xAC, 0xA3, 0xD3, 0xD6, 0xAC, 0xA3,
+    0xD2, 0xAC, 0xA6, 0xAC, 0xA3, 0xD1, 0x9D, 0x79, 0xCA, 0x3D, 0x1D, 0x90, 0x9A, 0xCA, 0x3D, 0x29,
+    0xCA, 0x09, 0xD0, 0x9F, 0xC9, 0x1D, 0x91, 0xD9, 0x0D, 0x90, 0xD9, 0x09, 0xD1, 0x9F, 0xD0, 0xAC,
+    0xA0, 0x9C, 0xA2, 0xD9, 0x19, 0xEA, 0x1D, 0x1A, 0xC9, 0x29, 0xCA, 0x7A, 0xCA, 0x1D, 0x92, 0x9D,
+    0x7D, 0x2D, 0x92, 0x9D, 0x6A, 0xCA, 0x2D, 0x92, 0x9D, 0x59, 0xD3, 0xAC, 0x92, 0x9C, 0xA5, 0xD9,
+    0x3A, 0xCA, 0x2A, 0xCA, 0x49, 0xD5, 0xD2, 0xD5, 0xD9, 0x5E, 0xAE, 0x4A, 0xCA, 0x7F, 0xC7, 0x72,
+    0x93, 0x77, 0x70, 0x9F, 0xCA, 0x74, 0x9F, 0xF7, 0x3E, 0x2A, 0xDA, 0x71, 0x9D, 0x4E, 0x71, 0x9D,
+    0x4A, 0xD7, 0x19, 0xD4, 0xE7, 0x2D, 0xA2, 0x9D, 0x97, 0x29, 0xD9, 0x0A, 0xDA, 0x74, 0xAF, 0xCA,
+    0x75, 0x9F, 0x97, 0x5A, 0xFC, 0x95, 0x99, 0x93, 0xEA, 0x0E, 0xA4, 0xE2, 0xAD, 0xA2, 0xEA, 0x3D,
+    0x92, 0xE4, 0xEA, 0x1A, 0xD2, 0x9D, 0x95, 0xEA, 0x0D, 0xA2, 0x9D, 0x7F, 0xD3, 0x9D, 0x97, 0xF9,
+    0x4E, 0x7F, 0xA4, 0xAE, 0x92, 0x9A, 0xFD, 0xA4, 0xFF, 0xE1, 0xAD, 0xA4, 0xAF, 0xE9, 0x3A, 0xDA,
+    0x69, 0x97, 0x40, 0x0D, 0xA0, 0xDA, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xAC, 0x90, 0xAC, 0x19, 0xA0,
+    0x3A, 0xC9, 0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0xDA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3,
+    0xAD, 0x3E, 0x3E, 0x3E, 0x3E, 0x3A, 0xD3, 0xAD, 0x39, 0xD9, 0x3D, 0x93, 0xE3, 0xAD, 0x4D, 0xA3,
+    0xAD, 0x4D, 0x93, 0x9D, 0x49, 0xA9, 0x0A, 0xCA, 0x5D, 0x94, 0xAD, 0x5D, 0x94, 0xAD, 0x49, 0xD9,
+    0x4D, 0xA4, 0xAD, 0x49, 0xD4, 0x9D, 0x94, 0xD9, 0x4D, 0xA4, 0xDA, 0x4D, 0xA4, 0xDA, 0x4D, 0x93,
+    0x9D, 0x93, 0x9D, 0x4A, 0xD4, 0xDA, 0x39, 0xD9, 0x3E, 0x4D, 0x93, 0xAD, 0x39, 0xD4, 0xAA, 0x93,
+    0x77, 0x29, 0xD9, 0x71, 0x9D, 0x73, 0xD7, 0x3D, 0x59, 0xCA, 0x91, 0xD1, 0x9A, 0xCA, 0xAF, 0xAF,
+    0xEA, 0x9A, 0xAF, 0xFA, 0xA9, 0x4F, 0x70, 0xAC, 0xAD, 0xA6, 0x9D, 0x09, 0xD9, 0x5E, 0x1E, 0x4A,
+    0xD9, 0x19, 0xDA, 0x49, 0xA3, 0xA9, 0x20, 0x59, 0x97, 0x4A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9,
+    0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x69, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0x9F,
+    0xFF, 0xC6, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9,
+    0x50, 0x19, 0x91, 0x9D, 0x90, 0xAD, 0x1E, 0x1D, 0x90, 0x9D, 0x19, 0xCA, 0x1A, 0xC2, 0xFE, 0x0F,
+    0xE0, 0x99, 0x99, 0x99, 0x90, 0x09, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x7D, 0x96, 0x9D,
+    0x7D, 0xA7, 0xD9, 0x6A, 0xD7, 0xDA, 0x69, 0xD7, 0xAD, 0x7D, 0x96, 0x9D, 0x7D, 0xA7, 0xD9, 0x6A,
+    0xD7, 0xDA, 0x69, 0xD7, 0xAD, 0x7D, 0x96, 0x9D, 0x7D, 0xA7, 0xD9, 0x6A, 0xD7, 0x77, 0x2A, 0xFC,
+    0x96, 0xFF, 0xA4, 0xE9, 0x2A, 0xD9, 0x29, 0xD9, 0x4E, 0x2E, 0x6D, 0x91, 0xDA, 0x6D, 0xA0, 0x9D,
+    0x96, 0xAD, 0x09, 0xD7, 0xAD, 0x0A, 0xD7, 0x9D, 0x0A, 0xD7, 0x9D, 0x0A, 0xD7, 0x9D, 0x0A, 0xD7,
+    0x9D, 0x0A, 0xD7, 0x9D, 0x09, 0xD7, 0x9D, 0x09, 0xD9, 0x6A, 0xD1, 0xD9, 0x6E, 0x1E, 0x6D, 0xA1,
+    0x9D, 0x94, 0xAD, 0x3E, 0x92, 0xAD, 0xA4, 0xFF, 0xC6, 0xAF, 0xCA, 0x72, 0x96, 0x49, 0xD9, 0x39,
+    0xE9, 0x2A, 0xF9, 0x1E, 0x9D, 0x90, 0xE1, 0xD9, 0x0A, 0xC2, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95,
+    0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9,
+    0x5D, 0x90, 0x77, 0x19, 0xFD, 0x94, 0x9F, 0xFC, 0xA3, 0xEA, 0x29, 0xEA, 0x29, 0xA6, 0xE7, 0x39,
+    0xD9, 0x72, 0x9D, 0x97, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x2A, 0xD7, 0x29, 0xD9, 0x71, 0x9D,
+    0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7,
+    0x19, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x77, 0x1A, 0xFD,
+    0x94, 0xAF, 0xFD, 0x3E, 0x92, 0x9A, 0xDA, 0x29, 0x96, 0xAD, 0x73, 0x9D, 0x97, 0x29, 0xD9, 0x72,
+    0x9D, 0x73, 0xE7, 0x19, 0xE5, 0x9F, 0xDA, 0x6A, 0xFD, 0xA7, 0x99, 0x99, 0xAE, 0xA7, 0x3A, 0xD9,
+    0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3E, 0x72, 0x9D, 0xA0, 0xAA, 0x95, 0xAE, 0x1A, 0xFF, 0xE3,
+    0xAF, 0xFA, 0x70, 0x99, 0x70, 0x71, 0xE7, 0x4A, 0xE7, 0x39, 0xF7, 0x3D, 0xAD, 0x72, 0xAC, 0xA9,
+    0xD7, 0x19, 0xD0, 0x9D, 0x71, 0xD9, 0x09, 0xD7, 0x0D, 0xA1, 0x9D, 0x79, 0xD2, 0x9D, 0x7D, 0x92,
+    0x9D, 0x6D, 0xA3, 0x9D, 0x5A, 0xD4, 0x9D, 0x49, 0xD5, 0x9D, 0x4D, 0x95, 0x9D, 0x39, 0xFF, 0xFE,
+    0x09, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x99, 0xAD, 0x99, 0x97, 0x29, 0xD7, 0x59, 0xD7, 0x59,
+    0xD7, 0x59, 0xD3, 0x1F, 0xFD, 0x93, 0xFF, 0xDA, 0x3D, 0xAA, 0xAA, 0xAA, 0xAA, 0x93, 0xD7, 0x4D,
+    0x73, 0x9D, 0x73, 0x9D, 0x73, 0x9D, 0x73, 0xAD, 0xAA, 0xDA, 0x95, 0xAF, 0xFC, 0xA4, 0xAA, 0xA9,
+    0x99, 0xAE, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xDA, 0x72, 0xAD,
+    0x91, 0xCA, 0x5A, 0xE2, 0xFF, 0xE3, 0x9F, 0xF9, 0x70, 0x99, 0x70, 0x77, 0x4A, 0xFC, 0xA5, 0xAF,
+    0xEA, 0x4A, 0xE9, 0x70, 0x9D, 0xA7, 0x2D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x3D, 0x90,
+    0x9F, 0xA4, 0xD9, 0xFF, 0x91, 0x9F, 0x92, 0x9E, 0x90, 0x9E, 0x6E, 0x09, 0xDA, 0x6A, 0xD0, 0x9D,
+    0x79, 0xD9, 0x0D, 0x97, 0xD9, 0x0D, 0x96, 0x9D, 0x1A, 0xD6, 0xAD, 0x19, 0xD9, 0x5D, 0xA2, 0xAD,
+    0x92, 0x9E, 0x4F, 0xFC, 0x95, 0xAF, 0xD9, 0x71, 0x99, 0x50, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC9,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x73, 0xDA, 0x72, 0x9D, 0x73, 0xE7, 0x29, 0xD9, 0x72, 0xE7,
+    0x29, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0x9D,
+    0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x70, 0x77, 0x2A, 0xFC, 0xA5, 0x9F,
+    0xFC, 0x39, 0xE9, 0x29, 0xE2, 0xAD, 0x59, 0xD9, 0x1D, 0xA6, 0xDA, 0x1D, 0xA6, 0xDA, 0x1A, 0xD5,
+    0x9D, 0x92, 0xDA, 0x4D, 0xA3, 0x9E, 0x90, 0xAD, 0xA5, 0x9F, 0xD9, 0x7F, 0xDA, 0x59, 0xE9, 0x9F,
+    0x39, 0xDA, 0x39, 0xE2, 0xDA, 0x6E, 0x09, 0xD7, 0xAD, 0x0A, 0xD7, 0x9D, 0x0A, 0xD7, 0x9D, 0x09,
+    0xD9, 0x6E, 0x1E, 0x94, 0xAD, 0x92, 0xFF, 0xDA, 0x4A, 0xFE, 0x97, 0x09, 0x96, 0x77, 0x2A, 0xFA,
+    0x69, 0xFF, 0x93, 0x9E, 0x91, 0x9E, 0x92, 0xE5, 0xAD, 0x2D, 0x96, 0xD9, 0x09, 0xD7, 0xAD, 0x0A,
+    0xD7, 0x9D, 0x0A, 0xD7, 0x9D, 0x09, 0xD7, 0xAD, 0x1D, 0xA5, 0x9E, 0x1A, 0xDA, 0x39, 0xF2, 0xFF,
+    0xCA, 0xD3, 0xAF, 0xCA, 0x0A, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x29, 0xD7, 0x3E, 0x72, 0xAD, 0x97,
+    0x09, 0xEA, 0x4F, 0xFA, 0x5F, 0xDA, 0x71, 0x99, 0x70, 0x39, 0xD9, 0xEA, 0xEA, 0x9D, 0x77, 0x77,
+    0x19, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x79, 0xD2, 0xEA, 0x1E, 0xA1, 0x9D, 0x77, 0x77,
+    0x77, 0x29, 0x99, 0x2E, 0x2E, 0x2D, 0xA1, 0x9D, 0x2A, 0xD2, 0xD9, 0x2A, 0xA2, 0x74, 0x97, 0x39,
+    0xD7, 0x19, 0xF7, 0x9F, 0x96, 0x9F, 0x96, 0x9E, 0xA7, 0x9E, 0xA7, 0x0A, 0xDA, 0x72, 0x9E, 0xA9,
+    0x72, 0x9F, 0x97, 0x29, 0xFA, 0x73, 0xAF, 0x97, 0x2A, 0xF7, 0x39, 0xD7, 0x59, 0x00, 0x75, 0x9F,
+    0xFF, 0xC9, 0xFF, 0xFC, 0x77, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFC,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x5A, 0xCA, 0x73, 0x9E, 0xA7, 0x3A, 0xEA, 0x73,
+    0x9E, 0xA7, 0x39, 0xEA, 0x73, 0x9E, 0xA7, 0x39, 0xE7, 0x19, 0xF7, 0xAF, 0x95, 0x9F, 0xA6, 0xAF,
+    0xA6, 0x9F, 0x97, 0x0A, 0xCA, 0x97, 0x29, 0x75, 0x75, 0xAF, 0xD9, 0x19, 0xFF, 0xCA, 0x1D, 0x92,
+    0x9E, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x9D, 0x96, 0x9D, 0xA6, 0xAD, 0xA6,
+    0xAD, 0xA6, 0x9D, 0x97, 0xAC, 0xA7, 0x0D, 0x71, 0xD7, 0x77, 0x71, 0x99, 0x70, 0x9E, 0x7A, 0xE7,
+    0x9E, 0x70, 0x99, 0x50, 0x70, 0x9A, 0xAD, 0xAA, 0x97, 0x5A, 0xFF, 0xDA, 0x71, 0xAE, 0xA9, 0x39,
+    0xAE, 0x7A, 0xD9, 0x71, 0xE5, 0xAD, 0x74, 0xAD, 0x39, 0xD7, 0x6D, 0x92, 0xD9, 0x39, 0xFD, 0xA2,
+    0x9D, 0x19, 0xD3, 0xAE, 0xAA, 0xE3, 0xD1, 0xAC, 0x92, 0x9D, 0x93, 0xD3, 0xAC, 0x90, 0xD3, 0xD9,
+    0x4D, 0x3A, 0xC9, 0x0D, 0x3D, 0x5D, 0x3A, 0xCA, 0x9D, 0x29, 0xD4, 0x9D, 0x3A, 0xC9, 0x9D, 0x29,
+    0xD4, 0x9D, 0x3A, 0xC9, 0x9D, 0x29, 0xD4, 0xAD, 0x3D, 0x1D, 0x3D, 0x4E, 0x29, 0xD1, 0xD3, 0xE2,
+    0xAC, 0xAC, 0x91, 0xD9, 0x1D, 0x93, 0xFD, 0x90, 0xFC, 0xA2, 0xAD, 0x4A, 0xDA, 0x3A, 0xCA, 0x94,
+    0xD9, 0x77, 0x49, 0xD9, 0x77, 0x4A, 0xDA, 0x71, 0x97, 0x1A, 0xEA, 0x99, 0x99, 0x9A, 0xE7, 0x3A,
+    0xFF, 0xDA, 0x75, 0x99, 0xAA, 0xA9, 0x97, 0x00, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD,
+    0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E,
+    0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA,
+    0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D,
+    0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x0F, 0xFA, 0x95, 0xFF, 0xF3,
+    0xDA, 0x99, 0x99, 0xAA, 0xF2, 0xD9, 0x6E, 0x91, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D,
+    0xA1, 0xD9, 0x6A, 0xD2, 0xD9, 0x5A, 0xDA, 0x2F, 0xFD, 0xA9, 0x3F, 0xFD, 0xA9, 0x3D, 0xA3, 0x99,
+    0xAE, 0x2D, 0x96, 0x9E, 0x1D, 0x97, 0xAD, 0x1D, 0x97, 0x9D, 0x90, 0xD9, 0x79, 0xD9, 0x0D, 0x97,
+    0xAD, 0x1D, 0x96, 0x9E, 0x1D, 0xA3, 0x99, 0xAE, 0x91, 0xFF, 0xF9, 0x2F, 0xFD, 0x93, 0x77, 0x69,
+    0xAF, 0xDA, 0x95, 0xFF, 0xE9, 0x29, 0xFA, 0x91, 0x9A, 0xD3, 0xE9, 0x73, 0xE9, 0x73, 0x9D, 0xA7,
+    0x4A, 0xD9, 0x74, 0xE7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5E, 0x75,
+    0xE7, 0x59, 0xDA, 0x75, 0xE7, 0x59, 0xE7, 0x5A, 0xEA, 0x93, 0x9A, 0xA4, 0xAF, 0xFD, 0xA6, 0xAF,
+    0xF9, 0x71, 0x99, 0x94, 0x0F, 0xFA, 0x97, 0xFF, 0xF5, 0xDA, 0x99, 0x99, 0xAA, 0xF9, 0x3D, 0x96,
+    0x9E, 0x92, 0xD9, 0x79, 0xE2, 0xD9, 0x70, 0x9D, 0xA1, 0xD9, 0x71, 0xE1, 0xD9, 0x71, 0xAD, 0x1D,
+    0x97, 0x19, 0xD9, 0x0D, 0x97, 0x19, 0xD9, 0x0D, 0x97, 0x19, 0xDA, 0x0D, 0x97, 0x19, 0xD9, 0x0D,
+    0x97, 0x19, 0xD9, 0x0D, 0x97, 0x1A, 0xD1, 0xD9, 0x71, 0xE1, 0xD9, 0x70, 0x9D, 0xA1, 0xD9, 0x79,
+    0xE2, 0xD9, 0x69, 0xE9, 0x2D, 0xA9, 0x99, 0x99, 0xAF, 0x93, 0xFF, 0xF5, 0xFF, 0xCA, 0x60, 0x0F,
+    0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99,
+    0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x71, 0xFF, 0xE1,
+    0xFF, 0xE1, 0xDA, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x70, 0x77, 0x71, 0xAF, 0xEA, 0x96, 0xAF, 0xFE, 0xA4, 0xFA, 0x92, 0x9A, 0xD4,
+    0xEA, 0x75, 0xAD, 0xA7, 0x6E, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x6F,
+    0xE1, 0xDA, 0x6F, 0xE1, 0xDA, 0x69, 0x99, 0x9A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x72, 0xAD, 0x19,
+    0xDA, 0x71, 0xAD, 0x2E, 0x97, 0x0A, 0xD2, 0x9E, 0x97, 0xAD, 0x3A, 0xEA, 0x94, 0x9A, 0xD4, 0x9F,
+    0xFF, 0xC6, 0xAF, 0xFC, 0xA9, 0x72, 0x99, 0x60, 0x0D, 0x97, 0x1A, 0xCA, 0x0D, 0x97, 0x1E, 0x0D,
+    0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97,
+    0x1E, 0x0D, 0x97, 0x1E, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9E,
+    0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D,
+    0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0xAF, 0xDA, 0xAF, 0xDA, 0x19,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x1A, 0xFD, 0x9F, 0xEA, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49,
+    0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49,
+    0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49,
+    0xD9, 0x4A, 0xD4, 0x9E, 0x09, 0xFD, 0x90, 0x9F, 0xC9, 0x29, 0xAA, 0x93, 0x0D, 0x97, 0xAD, 0x91,
+    0xD9, 0x6A, 0xDA, 0x2D, 0x95, 0x9D, 0xA3, 0xD9, 0x49, 0xDA, 0x4D, 0x94, 0xE5, 0xD9, 0x3E, 0x6D,
+    0x92, 0xE7, 0xD9, 0x1E, 0x70, 0xD9, 0x0E, 0x71, 0xD9, 0xAD, 0xA7, 0x1F, 0xE9, 0x70, 0xF9, 0xE7,
+    0x0E, 0x19, 0xE7, 0xD9, 0x2A, 0xDA, 0x6D, 0x93, 0xE9, 0x5D, 0x94, 0xE5, 0xD9, 0x49, 0xE4, 0xD9,
+    0x5A, 0xDA, 0x3D, 0x96, 0xE9, 0x2D, 0x97, 0xE2, 0xD9, 0x79, 0xDA, 0x00, 0x0D, 0x97, 0x1D, 0x97,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0x0E, 0xA7, 0x39, 0xEA, 0x0F,
+    0x73, 0xAE, 0xA0, 0xFA, 0x72, 0xFA, 0x0D, 0xAD, 0x71, 0x9F, 0xA0, 0xD9, 0xD9, 0x70, 0xD9, 0xDA,
+    0x0D, 0x0D, 0xA7, 0x9D, 0x0D, 0xA0, 0xD0, 0x9D, 0x7A, 0xCA, 0x0D, 0xA0, 0xD1, 0xD9, 0x6D, 0x90,
+    0xDA, 0x0D, 0x90, 0xAD, 0x59, 0xD1, 0xDA, 0x0D, 0x90, 0x9D, 0x5D, 0xA1, 0xDA, 0x0D, 0x91, 0xDA,
+    0x4D, 0x2D, 0xA0, 0xD9, 0x1A, 0xD3, 0xAD, 0x2D, 0xA0, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0xA0, 0xD9,
+    0x2D, 0xA1, 0x9D, 0x3D, 0xA0, 0xD9, 0x29, 0xD1, 0xAC, 0xA3, 0xDA, 0x0D, 0x93, 0xD9, 0x0D, 0x93,
+    0xDA, 0x0D, 0x93, 0xAD, 0x9D, 0x4D, 0xA0, 0xD9, 0x39, 0xFA, 0x4D, 0xA0, 0xD9, 0x4F, 0x5D, 0xA0,
+    0xD9, 0x4A, 0xDA, 0x5D, 0xA0, 0xD9, 0x5D, 0x95, 0xDA, 0x0E, 0x72, 0xD9, 0x0E, 0xA7, 0x1D, 0x90,
+    0xF9, 0x70, 0xD9, 0x0F, 0xC7, 0x0D, 0x90, 0xD9, 0xDA, 0x7D, 0x90, 0xD0, 0xAD, 0x96, 0xD9, 0x0D,
+    0x1E, 0x6D, 0x90, 0xD1, 0x9D, 0xA5, 0xD9, 0x0D, 0x2E, 0x5D, 0x90, 0xD9, 0x2E, 0x4D, 0x90, 0xD9,
+    0x29, 0xDA, 0x3D, 0x90, 0xD9, 0x3E, 0x3D, 0x90, 0xD9, 0x4E, 0x2D, 0x90, 0xD9, 0x4A, 0xD9, 0x1D,
+    0x90, 0xD9, 0x5E, 0x1D, 0x90, 0xD9, 0x59, 0xE0, 0xD9, 0x0D, 0x96, 0xAD, 0x9D, 0x90, 0xD9, 0x7F,
+    0xC9, 0x0D, 0x97, 0x9F, 0x90, 0xD9, 0x70, 0xAE, 0x90, 0xD9, 0x71, 0xE9, 0x77, 0x71, 0xAF, 0xE9,
+    0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19,
+    0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0,
+    0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0,
+    0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE,
+    0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x0F, 0xEA, 0xA5, 0xFF, 0xE3, 0xDA, 0x99, 0x9A, 0xAF,
+    0x2D, 0x95, 0xAD, 0xA1, 0xD9, 0x6E, 0x1D, 0x96, 0xAD, 0x1D, 0x96, 0xAD, 0x1D, 0x96, 0xAD, 0x1D,
+    0x96, 0xE1, 0xD9, 0x5A, 0xD9, 0x1D, 0xA9, 0x99, 0x9A, 0xEA, 0x2F, 0xFD, 0xA3, 0xFE, 0xA9, 0x5D,
+    0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x20,
+    0x77, 0x71, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3,
+    0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74,
+    0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0,
+    0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4,
+    0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x9A, 0xDA, 0x77, 0x0E, 0xA7, 0x70, 0xEA,
+    0x77, 0x0E, 0xA7, 0x79, 0xE9, 0x00, 0x0F, 0xEA, 0xA9, 0x5F, 0xFE, 0x4D, 0xA9, 0x99, 0xAA, 0xF3,
+    0xD9, 0x5A, 0xDA, 0x2D, 0x96, 0xE2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xD9,
+    0x6D, 0xA2, 0xD9, 0x49, 0xE3, 0xFF, 0xE4, 0xFF, 0xC9, 0x5D, 0xA9, 0x99, 0xAD, 0x95, 0xD9, 0x3E,
+    0x5D, 0x94, 0xDA, 0x4D, 0x94, 0xAD, 0x93, 0xD9, 0x5E, 0x3D, 0x95, 0x9D, 0xA2, 0xD9, 0x6E, 0x2D,
+    0x97, 0xE1, 0xD9, 0x7A, 0xD9, 0x77, 0x09, 0xAF, 0xDA, 0x3A, 0xFF, 0xD1, 0x9E, 0x91, 0x99, 0xAC,
+    0xA1, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x2D, 0xA7, 0x2E, 0x97, 0x19, 0xEA, 0x71, 0x9F, 0xC9, 0x70,
+    0xAF, 0xC9, 0x70, 0xAF, 0xC7, 0x19, 0xF7, 0x2E, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x1A,
+    0xD9, 0xAC, 0xA9, 0x39, 0xAE, 0x0A, 0xFF, 0xE2, 0xAF, 0xF9, 0x79, 0x96, 0xAF, 0xFF, 0xEA, 0xFF,
+    0xFE, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x50, 0x9D, 0x72, 0xDA,
+    0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA, 0x93, 0xAE, 0x4F, 0xFE,
+    0x95, 0x9F, 0xEA, 0x73, 0x99, 0x60, 0xAC, 0xA7, 0x29, 0xD9, 0xAD, 0x72, 0xAD, 0x1D, 0xA7, 0x1D,
+    0xA1, 0xE7, 0x09, 0xD9, 0x19, 0xD9, 0x7E, 0x3D, 0xA7, 0xDA, 0x3A, 0xD6, 0x9D, 0x49, 0xD9, 0x5E,
+    0x5D, 0xA5, 0xDA, 0x5A, 0xD4, 0xAD, 0x69, 0xD9, 0x3E, 0x7D, 0xA3, 0xD9, 0x7A, 0xD2, 0xAD, 0x71,
+    0xD9, 0x1D, 0xA7, 0x1E, 0x09, 0xD9, 0x71, 0xAD, 0x0A, 0xD7, 0x3D, 0x9D, 0xA7, 0x3D, 0xAD, 0x97,
+    0x39, 0xF7, 0x5E, 0xA7, 0x5A, 0xD7, 0x9D, 0x70, 0xE7, 0x0D, 0xA9, 0xD9, 0x69, 0xE7, 0x9D, 0x90,
+    0xDA, 0x6A, 0xEA, 0x6A, 0xD1, 0xE6, 0xFC, 0x6E, 0x1A, 0xD6, 0xD9, 0xD6, 0xDA, 0x2D, 0x94, 0x9D,
+    0x0D, 0x94, 0x9D, 0x92, 0xDA, 0x4A, 0xCA, 0x0A, 0xCA, 0x4A, 0xD3, 0xAD, 0x4D, 0x90, 0x9D, 0x4E,
+    0x39, 0xD3, 0x9D, 0x2D, 0x93, 0xDA, 0x4D, 0x92, 0xAD, 0x2D, 0xA2, 0x9D, 0x94, 0xDA, 0x2D, 0xA2,
+    0xAD, 0x2A, 0xD5, 0xAD, 0x2D, 0x92, 0x9D, 0x2D, 0xA5, 0x9D, 0x19, 0xD4, 0xDA, 0x1D, 0x96, 0xD9,
+    0x0D, 0xA4, 0xAD, 0x09, 0xD7, 0xDA, 0x0D, 0x94, 0x9D, 0x0A, 0xD7, 0xAD, 0x9D, 0x6D, 0x9D, 0xA7,
+    0x9D, 0xAD, 0x6D, 0xAD, 0x97, 0x0F, 0xA6, 0x9F, 0x71, 0xF7, 0x0F, 0x71, 0xAE, 0x70, 0xEA, 0x71,
+    0x9D, 0xA7, 0x0A, 0xD9, 0x40, 0x0D, 0xA7, 0x09, 0xD1, 0xAD, 0x97, 0xDA, 0x2E, 0x6E, 0x39, 0xDA,
+    0x49, 0xD9, 0x4A, 0xD4, 0xDA, 0x6E, 0x2A, 0xD7, 0x9D, 0x90, 0x9D, 0x97, 0x0A, 0xD0, 0xDA, 0x72,
+    0xFC, 0x73, 0x9E, 0x97, 0x4E, 0x97, 0x3F, 0xC7, 0x29, 0xD9, 0xDA, 0x71, 0xDA, 0x0A, 0xD7, 0x0A,
+    0xD2, 0xE6, 0x9D, 0x92, 0x9D, 0x95, 0xDA, 0x4A, 0xD4, 0xAD, 0x6D, 0xA2, 0x9D, 0x96, 0xAD, 0x91,
+    0xE7, 0x0E, 0x0A, 0xD7, 0x19, 0xDA, 0xAD, 0x71, 0x9D, 0x09, 0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3,
+    0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA, 0x4D, 0xA5, 0xAD, 0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD,
+    0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC, 0x73, 0xF9, 0x73, 0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75,
+    0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x60, 0x9F, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x72, 0xAD, 0x97, 0x19, 0xDA, 0x72, 0xE7, 0x2A,
+    0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72,
+    0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF,
+    0xDA, 0xFF, 0xFD, 0xA0, 0xAF, 0xCA, 0xAF, 0xDA, 0xD9, 0x99, 0x0A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD,
+    0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD9, 0x99, 0x9A, 0xFD, 0x9A, 0xAA, 0xAA,
+    0xA0, 0x9D, 0x70, 0xD9, 0x7D, 0xA7, 0x9D, 0x70, 0xD9, 0x7A, 0xD7, 0x9D, 0x70, 0xDA, 0x7A, 0xD7,
+    0x0D, 0x97, 0xDA, 0x79, 0xD7, 0x0D, 0x97, 0xE7, 0x9D, 0x70, 0xDA, 0x7A, 0xD7, 0x9D, 0x97, 0xDA,
+    0x7A, 0xD7, 0x0D, 0x90, 0x0F, 0xD0, 0x9F, 0xD9, 0x09, 0x99, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x90, 0x99, 0x9A, 0xD9, 0x9F, 0xD9, 0x0A, 0xAA, 0xAA, 0xA0, 0x5D, 0x73, 0x9D,
+    0xA7, 0x2F, 0x71, 0x9C, 0xAA, 0xCA, 0x70, 0xD9, 0x0D, 0x79, 0xD1, 0xAC, 0xA6, 0xAC, 0x92, 0xD6,
+    0xD3, 0xAC, 0xA4, 0xAC, 0x94, 0xD4, 0xD5, 0xAC, 0xA2, 0xAC, 0xA6, 0xD2, 0xD7, 0xAC, 0xA0, 0xAC,
+    0xA7, 0x0D, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x99, 0x93, 0x9D, 0xA3, 0xAD, 0x93, 0xAD, 0x4A, 0xCA, 0x49, 0x90, 0x3A,
+    0xAE, 0xA9, 0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99,
+    0x9A, 0xD2, 0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA,
+    0xD5, 0x9E, 0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1, 0xD4, 0x96, 0x76, 0xAD, 0x73,
+    0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x1A, 0xEA, 0x93, 0xAD, 0x0F,
+    0xF2, 0xAF, 0xA9, 0x09, 0xAE, 0x1A, 0xE5, 0xAD, 0x90, 0xAD, 0xA6, 0xE0, 0xAD, 0x96, 0xAD, 0x0A,
+    0xD7, 0x9D, 0x0A, 0xD7, 0x9D, 0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0xAD, 0x0A, 0xD9,
+    0x6E, 0x0A, 0xE5, 0x9D, 0xA0, 0xAF, 0x39, 0xE1, 0xAC, 0xAA, 0xFF, 0x91, 0xAC, 0x90, 0x9F, 0xD7,
+    0x29, 0x95, 0x4A, 0xFA, 0x93, 0xAF, 0xF2, 0xAE, 0x99, 0x9A, 0xC9, 0x19, 0xDA, 0x70, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0xAD,
+    0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC4, 0xAF, 0xD9, 0x79, 0x93, 0x77, 0x72, 0xD9, 0x73, 0xD9,
+    0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x39, 0xAE, 0x91, 0xD9, 0x2F, 0xF0, 0xD9, 0x1E,
+    0xA9, 0x09, 0xAF, 0x90, 0x9D, 0xA4, 0x9E, 0x90, 0xE6, 0xAD, 0x90, 0xDA, 0x69, 0xD9, 0x9D, 0x97,
+    0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x0D, 0x97, 0xD9, 0x0E, 0x69, 0xD9,
+    0x0A, 0xD6, 0xE9, 0x1E, 0x93, 0xF9, 0x19, 0xFF, 0x9D, 0x92, 0x9F, 0xD9, 0x0A, 0xC9, 0x59, 0x96,
+    0x39, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E, 0x6D,
+    0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93, 0xAF,
+    0xEA, 0x79, 0x94, 0x69, 0x97, 0xAF, 0xC4, 0xFE, 0x39, 0xDA, 0x7A, 0xD7, 0x0E, 0x70, 0xE7, 0xAE,
+    0xAA, 0xA9, 0x1A, 0xFF, 0xA2, 0x99, 0xE9, 0x99, 0x5E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x50, 0x39, 0xAE, 0x91, 0x9A,
+    0x92, 0xFF, 0x0D, 0x91, 0xEA, 0x99, 0x9A, 0xF9, 0x09, 0xDA, 0x49, 0xE9, 0x0E, 0x6A, 0xD9, 0x0D,
+    0xA6, 0x9D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x90, 0xD9,
+    0x7D, 0x90, 0xE6, 0x9D, 0x90, 0xAD, 0x95, 0xE9, 0x1E, 0x93, 0xAE, 0x91, 0x9F, 0xF9, 0xD9, 0x29,
+    0xFD, 0x90, 0xD9, 0x59, 0x93, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x73, 0xE2, 0xCA, 0x99, 0x29, 0xE9,
+    0x2F, 0xFD, 0x93, 0x9A, 0xFD, 0xA3, 0x75, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0x19, 0xAE, 0xA2, 0xAD, 0x0F, 0xF9, 0x0A, 0xFA, 0x99, 0x9A, 0xE0, 0xAE,
+    0x94, 0xAD, 0x9A, 0xDA, 0x6D, 0xAA, 0xD9, 0x6D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xA0, 0x09, 0x90, 0xAD, 0x0A, 0xD1, 0xAA, 0x70, 0x9A, 0xA0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A,
+    0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0,
+    0xAD, 0x00, 0x49, 0x94, 0xAD, 0x4A, 0xD5, 0xAA, 0x77, 0x49, 0xAA, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4,
+    0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD3, 0x9D, 0xA0, 0xAF, 0xC1, 0x9E, 0xA2, 0x75, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x59, 0xAA, 0x90, 0xAD,
+    0x5E, 0x1A, 0xD4, 0xE2, 0xAD, 0x3E, 0x3A, 0xD2, 0xE4, 0xAD, 0x1E, 0x5A, 0xD0, 0xE6, 0xAD, 0xAE,
+    0x6A, 0xFD, 0xA5, 0xAE, 0x0A, 0xD9, 0x4A, 0xD2, 0xE4, 0xAD, 0x3E, 0x3A, 0xD3, 0x9D, 0xA2, 0xAD,
+    0x4A, 0xD9, 0x1A, 0xD5, 0xE1, 0xAD, 0x6E, 0x00, 0x3A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0,
+    0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD,
+    0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x00, 0x9A, 0x91, 0xAE, 0xA9, 0x3A, 0xEA,
+    0x91, 0xAD, 0x0F, 0xEA, 0x09, 0xFE, 0xA0, 0xAF, 0xA9, 0x99, 0xEA, 0xD9, 0x99, 0x9E, 0x9A, 0xE5,
+    0xF5, 0xDA, 0xAD, 0xA5, 0xAD, 0x95, 0xEA, 0xD9, 0x5A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD,
+    0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD,
+    0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x9A, 0x91, 0x9F, 0xA2, 0xAD, 0x0F, 0xF9, 0x0A, 0xFA, 0x90, 0x9A, 0xE0, 0xAE,
+    0x5A, 0xD9, 0xAD, 0xA6, 0xDA, 0xAD, 0x96, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA,
+    0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7,
+    0xDA, 0x4A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9,
+    0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A,
+    0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A,
+    0xFD, 0x97, 0x29, 0x96, 0x9A, 0x91, 0x9E, 0xA9, 0x3A, 0xD0, 0xFF, 0x2A, 0xFA, 0x90, 0x9A, 0xE1,
+    0xAE, 0x5A, 0xD9, 0x0A, 0xDA, 0x6E, 0x0A, 0xD9, 0x6A, 0xD0, 0xAD, 0x79, 0xD9, 0xAD, 0x79, 0xD9,
+    0xAD, 0x79, 0xD9, 0xAD, 0x79, 0xD9, 0xAD, 0x7A, 0xD0, 0xAD, 0x96, 0xE0, 0xAE, 0x59, 0xDA, 0x0A,
+    0xF3, 0x9E, 0x1A, 0xDA, 0xFF, 0x91, 0xAD, 0x09, 0xFD, 0x3A, 0xD3, 0x99, 0x5A, 0xD7, 0x3A, 0xD7,
+    0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x30, 0x39, 0xAE, 0x91, 0x9A, 0x92, 0xFF, 0x0D,
+    0x91, 0xEA, 0x90, 0x9A, 0xF9, 0x09, 0xDA, 0x49, 0xE9, 0x0E, 0x6A, 0xD9, 0x0D, 0xA6, 0x9D, 0x99,
+    0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x90, 0xD9, 0x7D, 0x90, 0xE6,
+    0x9D, 0x90, 0xAD, 0x95, 0xE9, 0x1E, 0x93, 0xF9, 0x19, 0xFF, 0x9D, 0x92, 0x9F, 0xD9, 0x0D, 0x95,
+    0x99, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x90, 0x9A,
+    0x91, 0x9A, 0xD9, 0xAC, 0xA0, 0xAF, 0x9A, 0xDA, 0xDA, 0x99, 0x0A, 0xEA, 0x4A, 0xE5, 0xAD, 0x95,
+    0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0x2A,
+    0xFA, 0xA2, 0x9F, 0xFC, 0x1E, 0x91, 0x9A, 0xD0, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0x0A, 0xEA,
+    0x7A, 0xFA, 0x96, 0xAF, 0xC7, 0x9F, 0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0D, 0xA9, 0xA9, 0x4A, 0xD9,
+    0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x59, 0x95, 0x74, 0x9C, 0x96, 0xD9, 0x6D, 0x94, 0x9E, 0xAA, 0xAA,
+    0x9A, 0xFF, 0xC0, 0x9A, 0xDA, 0x99, 0x99, 0x19, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x6D, 0x96, 0xE6, 0xAF, 0xD3, 0xAF, 0xC6,
+    0x91, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7,
+    0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D,
+    0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC, 0xA4, 0x99,
+    0x60, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79, 0xD9, 0x0D, 0xA6, 0xAD, 0x1E, 0x6D, 0xA1, 0x9D, 0x59,
+    0xD3, 0xDA, 0x4E, 0x3A, 0xD4, 0xD9, 0x39, 0xD9, 0x2A, 0xD5, 0xDA, 0x2D, 0xA5, 0xAD, 0x2D, 0x96,
+    0xD9, 0x0A, 0xD7, 0xDA, 0x0D, 0xA7, 0x9D, 0x9D, 0x71, 0xFC, 0x71, 0xAE, 0x97, 0x19, 0xE5, 0x9A,
+    0xA6, 0xAA, 0xA6, 0xAA, 0x99, 0xD9, 0x49, 0xE5, 0x9D, 0x90, 0xDA, 0x4A, 0xEA, 0x4A, 0xD1, 0xE4,
+    0xDA, 0xD4, 0xDA, 0x1A, 0xD4, 0xD0, 0xD4, 0xD9, 0x19, 0xD9, 0x2A, 0xD0, 0xD9, 0x29, 0xD3, 0xDA,
+    0x2D, 0xA0, 0xAD, 0x2A, 0xD3, 0xAD, 0x2D, 0x19, 0xD2, 0xDA, 0x39, 0xD1, 0x9D, 0x2D, 0x91, 0xD9,
+    0x4D, 0x90, 0xDA, 0x2A, 0xCA, 0x09, 0xD5, 0xDA, 0x0D, 0x92, 0x9D, 0x0A, 0xD5, 0xAD, 0x9D, 0x4D,
+    0x0D, 0xA5, 0x9D, 0xAC, 0xA4, 0xDA, 0xD7, 0xF9, 0x4A, 0xF7, 0xF6, 0xEA, 0x7A, 0xDA, 0x6E, 0x93,
+    0x0A, 0xAA, 0x69, 0xAA, 0x19, 0xD9, 0x5E, 0x2A, 0xD4, 0xAD, 0x4E, 0x29, 0xD9, 0x49, 0xDA, 0x1D,
+    0xA6, 0xAD, 0x0E, 0x70, 0xFC, 0x97, 0x1E, 0xA7, 0x2E, 0xA7, 0x1F, 0xC9, 0x7A, 0xD0, 0xE6, 0x9D,
+    0xA1, 0xDA, 0x5E, 0x29, 0xD9, 0x3A, 0xD4, 0xAD, 0x29, 0xD9, 0x5E, 0x1D, 0xA6, 0x9D, 0xA0, 0xAA,
+    0xA7, 0x0A, 0xA9, 0xAD, 0x79, 0xD9, 0x0D, 0xA6, 0xAD, 0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9,
+    0x2D, 0xA4, 0xAD, 0x3A, 0xD4, 0xDA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA,
+    0x09, 0xD7, 0xAD, 0x0D, 0xA7, 0x0D, 0x9D, 0x97, 0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73,
+    0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xAE, 0xA7, 0x10, 0x0A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA0, 0x9F, 0xFD, 0x90, 0x99, 0x99, 0x99, 0x9E, 0x79, 0xDA, 0x7E, 0x7A, 0xD7, 0x9D,
+    0x97, 0xDA, 0x7E, 0x79, 0xD9, 0x7D, 0xA7, 0xE7, 0xAD, 0x79, 0xD9, 0x7F, 0xFE, 0xAF, 0xFE, 0xA0,
+    0x69, 0xAC, 0x59, 0xF5, 0xEA, 0x94, 0x9D, 0x96, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A,
+    0xD7, 0xDA, 0x59, 0xE5, 0xEA, 0x6F, 0x97, 0xAD, 0x97, 0xE7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD7, 0x9D, 0x97, 0xFA, 0x6F, 0x70, 0x9A, 0x00, 0x4D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x40, 0x0C, 0xA9, 0x7F, 0x95, 0x9A, 0xE7, 0x0D, 0xA7,
+    0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xAD, 0x70, 0xE9, 0x7A, 0xE9, 0x49, 0xF9,
+    0x39, 0xDA, 0x6A, 0xD7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA6, 0x9D, 0x94, 0xAF,
+    0x5F, 0x6A, 0x97, 0x77, 0x9F, 0xC9, 0x4A, 0x09, 0xFF, 0xA9, 0xAD, 0x0A, 0xC3, 0xAF, 0xDA, 0x70,
+    0x9A, 0xAA, 0x91, 0x9D, 0x0E, 0xAE, 0xA9, 0xD9, 0x70, 0xA9, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0xAD, 0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0x09, 0x90, 0x77,
+    0x2A, 0xC9, 0x71, 0xAC, 0x97, 0x09, 0xEA, 0x94, 0xAF, 0xF2, 0xAE, 0xA9, 0x9A, 0xCA, 0x19, 0xE7,
+    0x0E, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x1D, 0x97, 0x1D,
+    0xA7, 0x1A, 0xD7, 0x2E, 0x94, 0x92, 0x9F, 0xFC, 0x39, 0xFE, 0xA6, 0xDA, 0x97, 0x0A, 0xC9, 0x71,
+    0xAC, 0x97, 0x29, 0x40, 0x77, 0x59, 0xFD, 0x96, 0xAF, 0xFA, 0x49, 0xDA, 0x3A, 0xC9, 0x4E, 0x74,
+    0xDA, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x71, 0x99, 0x9D, 0xA9, 0x99, 0x99, 0x4F,
+    0xFE, 0x93, 0xAA, 0xAE, 0xAA, 0xAA, 0xA7, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x73, 0x9D,
+    0x74, 0xDA, 0x72, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x09,
+    0xA7, 0x0A, 0x1D, 0xA9, 0xAE, 0xA0, 0xDA, 0x09, 0xFF, 0xE2, 0xAD, 0x92, 0xAD, 0x3D, 0x94, 0xAC,
+    0xA2, 0xD6, 0xD1, 0x9C, 0xA6, 0xD1, 0x9C, 0xA6, 0xD2, 0xD5, 0x9D, 0x2A, 0xD4, 0xD9, 0x2F, 0xAA,
+    0xAE, 0xA1, 0xEA, 0xFC, 0xAD, 0x90, 0xAC, 0x29, 0x99, 0x19, 0xC9, 0x75, 0x9D, 0x97, 0x0A, 0xD1,
+    0xE7, 0x0D, 0xA1, 0x9D, 0x96, 0xAD, 0x3E, 0x6D, 0x93, 0x9D, 0x94, 0xAD, 0x5E, 0x4D, 0x96, 0xD9,
+    0x2A, 0xD7, 0xAD, 0x2D, 0x97, 0x0D, 0x90, 0xAD, 0x71, 0xAD, 0x9D, 0x73, 0xFA, 0x79, 0xFF, 0xE4,
+    0x9F, 0xFE, 0x71, 0xDA, 0x75, 0xDA, 0x71, 0xAA, 0xAA, 0xEA, 0xAA, 0xA4, 0x9F, 0xFE, 0x71, 0xDA,
+    0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x60, 0x4D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x77, 0x75, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD4, 0x59,
+    0x96, 0x9F, 0xF9, 0x19, 0xEA, 0xAA, 0xE9, 0x1E, 0x59, 0x2D, 0x97, 0x1E, 0x71, 0x9E, 0xA7, 0x09,
+    0xFC, 0x95, 0xAF, 0xE3, 0xAD, 0x2A, 0xE2, 0xD9, 0x4E, 0x1D, 0x59, 0xD1, 0xDA, 0x5D, 0x1A, 0xDA,
+    0x3A, 0xD2, 0xAE, 0xA9, 0xAD, 0x5A, 0xFC, 0x97, 0xAF, 0x71, 0x9D, 0xA7, 0x1A, 0xD7, 0x1A, 0xD0,
+    0x9A, 0x94, 0x9D, 0xA0, 0x9F, 0xFD, 0x2A, 0xFE, 0x97, 0x70, 0x09, 0x6A, 0xD2, 0xD9, 0xAD, 0x2D,
+    0x90, 0xA9, 0x29, 0xA0, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAE, 0xA9, 0x9A, 0xAD, 0xA7, 0x0D, 0xA7,
+    0xAD, 0x95, 0xD9, 0x72, 0xD9, 0x3D, 0x4A, 0xEA, 0x92, 0xD2, 0x9C, 0x92, 0x9F, 0xE2, 0x9C, 0xA1,
+    0xD3, 0xDA, 0x29, 0x93, 0xAC, 0x1C, 0xA2, 0xAD, 0x71, 0x9C, 0x99, 0xC9, 0x2D, 0x97, 0x2C, 0xAA,
+    0xC3, 0xD7, 0x3D, 0xAC, 0x3D, 0x73, 0xDA, 0xC3, 0xD7, 0x3D, 0x9C, 0x92, 0xD9, 0x72, 0xCA, 0x0C,
+    0xA2, 0xAC, 0xA7, 0x19, 0xC9, 0x0D, 0x29, 0xD9, 0x70, 0xAC, 0x1A, 0xC9, 0x2A, 0xFE, 0x3D, 0x2D,
+    0x39, 0xFC, 0x92, 0xD3, 0x9D, 0x73, 0xD9, 0x49, 0xD9, 0x79, 0xDA, 0x7E, 0xA9, 0x99, 0x9A, 0xE9,
+    0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97, 0x10, 0x72, 0xAF, 0xA2, 0xCA, 0xA9, 0xDA, 0x6D, 0x6D, 0x1A,
+    0xFD, 0x0A, 0xCA, 0x91, 0xD0, 0xD3, 0xD0, 0xD2, 0x9D, 0x0A, 0xDA, 0xF1, 0xAD, 0xA0, 0x9A, 0x49,
+    0x39, 0x94, 0xDA, 0x2D, 0x92, 0xE2, 0xDA, 0x2A, 0xD2, 0xE2, 0x9D, 0x91, 0xAD, 0x29, 0xD9, 0x1A,
+    0xD9, 0x2A, 0xD2, 0xE4, 0xE2, 0xDA, 0x4D, 0xA1, 0x9D, 0x93, 0x9D, 0x91, 0xAD, 0x93, 0x9D, 0x91,
+    0xAD, 0x4A, 0xC9, 0x2D, 0x97, 0x40, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC,
+    0x09, 0xFF, 0xFC, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x4D, 0x74, 0xD7, 0x59, 0x00, 0xFE, 0x0F, 0xE0,
+    0x99, 0x99, 0x99, 0x90, 0x77, 0x74, 0xAF, 0xDA, 0x73, 0xAE, 0xA9, 0x9A, 0xAD, 0xA7, 0x0D, 0xA7,
+    0xAD, 0x95, 0xD9, 0x72, 0xD9, 0x3D, 0x2A, 0xFA, 0x93, 0xD2, 0x9C, 0x92, 0xFE, 0xA2, 0x9C, 0xA1,
+    0xD3, 0xD9, 0x1A, 0xD3, 0xAC, 0x1C, 0xA3, 0xD9, 0x2D, 0x92, 0x9C, 0x99, 0xC9, 0x3D, 0x92, 0xD9,
+    0x3C, 0xAA, 0xC4, 0xD9, 0x19, 0xD4, 0xDA, 0xC4, 0xFE, 0x94, 0xDA, 0xC4, 0xFD, 0x95, 0xD9, 0xC9,
+    0x3D, 0x90, 0x9D, 0x5C, 0xA0, 0xCA, 0x3D, 0x91, 0xDA, 0x39, 0xC9, 0x0D, 0x3D, 0x91, 0x9D, 0x3A,
+    0xC1, 0xAC, 0x92, 0xD9, 0x2D, 0xA2, 0xD2, 0xD2, 0xD9, 0x3D, 0x90, 0xD3, 0x9D, 0x73, 0xD9, 0x49,
+    0xD9, 0x79, 0xDA, 0x7E, 0xA9, 0x99, 0x9A, 0xE9, 0x71, 0x9A, 0xFE, 0x97, 0x79, 0x97, 0x10, 0x77,
+    0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x73, 0x9F, 0xA2, 0x9D, 0xAA, 0xE1, 0xD3, 0xAC, 0xA9, 0xCA,
+    0x4D, 0x9C, 0xA4, 0xD9, 0xCA, 0x4C, 0xA0, 0xD9, 0x2D, 0x91, 0xFD, 0xA3, 0xAD, 0xA9, 0x10, 0x59,
+    0x97, 0x4A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x69, 0x99, 0x99,
+    0xDA, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xC0, 0x9A, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0x6A, 0xC9, 0x73,
+    0xAC, 0x97, 0x3A, 0xC9, 0x73, 0xAC, 0x97, 0x3A, 0xC9, 0x73, 0x9A, 0x77, 0x5A, 0xFF, 0xFC, 0x0A,
+    0xFF, 0xFC, 0x00, 0x19, 0xAD, 0xA2, 0xFE, 0x90, 0xAA, 0x2A, 0xD6, 0xD6, 0xD5, 0xAC, 0x94, 0x9D,
+    0x49, 0xD4, 0x9D, 0x49, 0xD4, 0x9D, 0x49, 0xFF, 0x9F, 0xF0, 0x1A, 0xEA, 0x92, 0xFE, 0x91, 0xA9,
+    0x29, 0xD7, 0xD6, 0x9D, 0x39, 0x9A, 0xD3, 0xAF, 0x96, 0x9E, 0x7D, 0x96, 0xD9, 0x6D, 0x0A, 0xDA,
+    0xAA, 0xDA, 0x1A, 0xFC, 0x97, 0x30, 0x29, 0x99, 0x2A, 0xDA, 0x2D, 0xA2, 0xE2, 0x9D, 0x39, 0x94,
+    0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D, 0xAA,
+    0xD9, 0x5E, 0xAA, 0xE9, 0x3A, 0xEA, 0xAF, 0xFC, 0xAA, 0xCA, 0xAD, 0x9F, 0xC9, 0x09, 0xCA, 0xAD,
+    0x29, 0x6A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD7, 0x20, 0x77, 0x29,
+    0xFF, 0xE2, 0xAF, 0xEA, 0x99, 0xD1, 0x9F, 0xF9, 0x1A, 0xC1, 0xFF, 0xC9, 0x1A, 0xC1, 0xFF, 0xC9,
+    0x1A, 0xC0, 0x9F, 0xFC, 0x91, 0xAC, 0x09, 0xFF, 0xC9, 0x1A, 0xC0, 0x9F, 0xFC, 0x91, 0xAC, 0x09,
+    0xFF, 0xC9, 0x1A, 0xC1, 0xFF, 0xC9, 0x1A, 0xC1, 0xFF, 0xC9, 0x1A, 0xC1, 0xAF, 0xF9, 0x1A, 0xC2,
+    0xFF, 0x91, 0xAC, 0x3A, 0xFD, 0x91, 0xAC, 0x69, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7,
+    0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7,
+    0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7,
+    0x09, 0xC9, 0x1A, 0xC7, 0x1A, 0x29, 0xA0, 0x09, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x1A,
+    0xC4, 0xD4, 0xAD, 0xA4, 0xD4, 0xD0, 0x9A, 0xAE, 0x0A, 0xEA, 0x10, 0x29, 0xAA, 0x1A, 0xE0, 0xDA,
+    0xDA, 0xC9, 0x0D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x75, 0xAE, 0xA4, 0xDA,
+    0xAA, 0xD2, 0xAC, 0x92, 0x9C, 0xA1, 0xD4, 0xD1, 0xD4, 0xD1, 0xD4, 0xD1, 0xD4, 0xD1, 0xAC, 0xA2,
+    0xAC, 0xA2, 0xEA, 0xE4, 0x9A, 0xCA, 0x92, 0x09, 0x4A, 0x4A, 0xD2, 0xDA, 0x4E, 0x2D, 0xA4, 0xDA,
+    0x19, 0xD9, 0x39, 0xDA, 0x19, 0xD9, 0x39, 0xD9, 0x1A, 0xD4, 0xE2, 0xDA, 0x2E, 0x2E, 0x2A, 0xD2,
+    0xE2, 0x9D, 0x91, 0xAD, 0x3D, 0xA1, 0x9D, 0x92, 0x9C, 0xA2, 0xAC, 0x97, 0x70, 0x3A, 0xD7, 0x0A,
+    0xC9, 0x5F, 0x79, 0xD4, 0xAD, 0x9D, 0x7D, 0x5A, 0xC1, 0xD6, 0xAC, 0xA7, 0x1D, 0x59, 0xD7, 0x2D,
+    0x5D, 0x97, 0x2D, 0x49, 0xCA, 0x73, 0xD4, 0xD7, 0x4D, 0x3A, 0xC9, 0x29, 0xA9, 0x6D, 0x29, 0xD3,
+    0xDA, 0x6D, 0x2D, 0x92, 0xEA, 0x6D, 0x1A, 0xCA, 0x2A, 0xCA, 0xCA, 0x6A, 0xA1, 0xD2, 0x9C, 0xA9,
+    0xCA, 0x71, 0xAC, 0x92, 0xD0, 0xAC, 0xA7, 0x09, 0xD2, 0xAC, 0x1A, 0xCA, 0x70, 0xD2, 0x9C, 0xA1,
+    0xAC, 0xA7, 0xAC, 0xA2, 0xDA, 0xAA, 0xEA, 0x95, 0xD3, 0xFF, 0xC9, 0x4D, 0x97, 0x0A, 0xD5, 0x9D,
+    0x71, 0xAC, 0xA5, 0xD7, 0x2A, 0xCA, 0x10, 0x3D, 0x97, 0xAC, 0x95, 0x9E, 0xA6, 0x9D, 0x5A, 0xDA,
+    0xCA, 0x6D, 0x95, 0xCA, 0x09, 0xCA, 0x5A, 0xCA, 0x71, 0xAC, 0xA5, 0xD7, 0x2A, 0xCA, 0x4A, 0xC9,
+    0x72, 0xAC, 0xA3, 0x9D, 0x73, 0xAC, 0xA3, 0xD7, 0x4A, 0xCA, 0x2A, 0xCA, 0x19, 0xAA, 0xA9, 0x5A,
+    0xCA, 0x2D, 0x09, 0xFD, 0x94, 0xAC, 0xA1, 0xD9, 0x09, 0xC9, 0x19, 0xD4, 0xAC, 0xA0, 0x9D, 0x7D,
+    0x49, 0xA9, 0x0D, 0x70, 0xD7, 0xAC, 0xA7, 0x9D, 0x7D, 0x70, 0xD7, 0xD9, 0x7D, 0x96, 0x9C, 0xA7,
+    0xD9, 0x7D, 0x7D, 0x97, 0xAC, 0xA6, 0xD9, 0x79, 0xD6, 0xFF, 0x3D, 0x96, 0xFF, 0x00, 0x77, 0x79,
+    0xAF, 0x97, 0x09, 0xCA, 0x29, 0xEA, 0xAD, 0x97, 0xD4, 0x93, 0x9D, 0x6A, 0xC9, 0x72, 0xD5, 0x9D,
+    0x72, 0xAC, 0xA5, 0xD7, 0x9A, 0xAD, 0xA5, 0xAC, 0xA7, 0xAF, 0xA5, 0xD7, 0x4A, 0xD3, 0xD9, 0x75,
+    0xD2, 0x9D, 0x29, 0xA9, 0x70, 0xD9, 0x1D, 0x3D, 0xA1, 0x99, 0x39, 0xD1, 0xAC, 0xA2, 0xEA, 0x1A,
+    0xFE, 0x90, 0x9D, 0x2A, 0xCA, 0xCA, 0x29, 0xAE, 0xA2, 0xD9, 0x2C, 0xA9, 0xCA, 0x72, 0x9C, 0xA2,
+    0xD0, 0x9C, 0xA7, 0x2D, 0x2A, 0xC1, 0x9C, 0xA7, 0x1A, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x70, 0x9D,
+    0x2D, 0xAA, 0xAE, 0xA9, 0x6D, 0x92, 0xFF, 0xCA, 0x5A, 0xCA, 0x70, 0xAD, 0x7D, 0x71, 0x9C, 0xA6,
+    0xAC, 0x97, 0x19, 0xCA, 0x10, 0x5A, 0xCA, 0x70, 0x9E, 0x70, 0x9E, 0x71, 0xDA, 0x77, 0x77, 0x39,
+    0xA9, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x09, 0xD7, 0x09, 0xDA, 0x7A, 0xDA, 0x7A, 0xDA, 0x79, 0xDA,
+    0x70, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x72, 0xD9, 0x71, 0xE5, 0xA9, 0x19, 0xFA, 0xAF, 0x29, 0xFF,
+    0xA4, 0x9A, 0xAA, 0x93, 0x59, 0x97, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0x9D, 0x97, 0x79, 0xD7, 0x71,
+    0x97, 0x77, 0x72, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0,
+    0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA,
+    0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D,
+    0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x72, 0x99, 0x77, 0xE7, 0x6A, 0xD9, 0x76, 0xD9, 0x76, 0xD9,
+    0x77, 0x97, 0x77, 0x74, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D,
+    0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70,
+    0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0,
+    0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x79, 0x97, 0x7A, 0xE7, 0x59, 0xFC, 0x73, 0x9D, 0x90,
+    0xE7, 0x2D, 0x92, 0xAC, 0xA7, 0x19, 0x59, 0x97, 0x77, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D,
+    0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9,
+    0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF,
+    0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71,
+    0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x59, 0x94, 0x99, 0x70,
+    0xFA, 0x2C, 0x97, 0xAC, 0xAA, 0xFD, 0x70, 0xCA, 0x2A, 0xE9, 0x70, 0x95, 0x97, 0x77, 0x71, 0xDA,
+    0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A,
+    0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94,
+    0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92,
+    0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73,
+    0x9D, 0x90, 0x59, 0x77, 0x0A, 0xD2, 0xD9, 0x71, 0xE1, 0x9D, 0x97, 0x2A, 0x39, 0x97, 0x77, 0x77,
+    0x73, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72,
+    0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6,
+    0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7,
+    0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD,
+    0x0E, 0x73, 0x9D, 0x90, 0x69, 0xAC, 0xA7, 0x59, 0xDA, 0xD7, 0x4D, 0x19, 0xC9, 0x73, 0xCA, 0x2C,
+    0x97, 0x3A, 0xC9, 0x0A, 0xC7, 0x5F, 0xA7, 0x59, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D,
+    0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39,
+    0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72,
+    0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x71, 0x9F, 0xFF, 0xD7, 0x1F, 0xFF, 0xE7, 0x1D,
+    0xAA, 0xE9, 0x99, 0x99, 0x99, 0x97, 0x0A, 0xD1, 0xDA, 0x77, 0x0D, 0x91, 0xDA, 0x77, 0xAD, 0x2D,
+    0xA7, 0x7D, 0xA2, 0xDA, 0x76, 0xAD, 0x3D, 0xA7, 0x6D, 0xA3, 0xDA, 0x75, 0xAD, 0x4F, 0xFD, 0x95,
+    0xDA, 0x4F, 0xFD, 0x94, 0xAD, 0x5E, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xEA, 0x73, 0x9F, 0xFE, 0xA7,
+    0x3E, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0x29, 0xD9, 0x6D, 0xA7, 0x2E, 0x7D, 0xA7, 0x19, 0xD9, 0x7D,
+    0xA7, 0x1E, 0x70, 0xE9, 0x99, 0x99, 0x99, 0x90, 0x9D, 0x97, 0x0F, 0xFE, 0x0E, 0x71, 0xFF, 0xE0,
+    0x77, 0x69, 0xAF, 0xDA, 0x95, 0xFF, 0xE9, 0x29, 0xFA, 0x91, 0x9A, 0xD3, 0xE9, 0x73, 0xE9, 0x73,
+    0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7,
+    0x5E, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xE7, 0x59, 0xE7, 0x5A, 0xEA, 0x93, 0x9A, 0xA4, 0xAF, 0xFD,
+    0xA6, 0xAF, 0xF9, 0x71, 0xD9, 0x74, 0x9C, 0xA7, 0x59, 0xE7, 0x6A, 0xCA, 0x75, 0x9D, 0x72, 0xAA,
+    0xAD, 0x97, 0x2F, 0x94, 0x29, 0x99, 0x71, 0x9D, 0xA7, 0x1A, 0xD7, 0x2A, 0xD7, 0x2A, 0xCA, 0x72,
+    0x99, 0x77, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99,
+    0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x79, 0x99, 0x70, 0x9E, 0x70, 0xE7, 0x0A, 0xD7,
+    0x09, 0xD7, 0x29, 0x77, 0x3F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA,
+    0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x59, 0x97, 0x1E, 0xA7, 0xFC, 0xA5,
+    0xAD, 0x09, 0xD9, 0x3A, 0xD3, 0xD9, 0x29, 0x95, 0x99, 0x76, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0xDA,
+    0x99, 0x99, 0x99, 0x99, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1F, 0xFE, 0x1F, 0xFE, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xE9, 0x0F, 0xFE, 0x90,
+    0x70, 0x95, 0xD9, 0x1A, 0xD4, 0xDA, 0x1A, 0xD4, 0x9A, 0x3A, 0x97, 0x77, 0x4F, 0xFE, 0x90, 0xFF,
+    0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90,
+    0xFF, 0xE9, 0x99, 0x94, 0x9D, 0xA4, 0xAD, 0x94, 0xAD, 0x5A, 0xCA, 0x59, 0x97, 0x1A, 0xFD, 0xAA,
+    0xFD, 0xA1, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x91, 0xAF, 0xD9, 0xFE, 0xA0, 0x49, 0x99, 0x49, 0xE4, 0xE4, 0xAD, 0x5D, 0x69,
+    0x75, 0xAF, 0xDA, 0x0A, 0xFD, 0xA2, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94,
+    0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94,
+    0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x92, 0xAF, 0xD9, 0x0F, 0xEA, 0x00, 0x39, 0x96, 0xF4,
+    0xAF, 0xA2, 0xAD, 0x09, 0xD9, 0x0A, 0xD3, 0xD9, 0x99, 0x59, 0x97, 0x2A, 0xFD, 0xA1, 0xAF, 0xDA,
+    0x39, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x3A, 0xFD, 0x91, 0xFE, 0xA0, 0x69, 0x2D, 0x91, 0xAD, 0x1D, 0xA1, 0xAD, 0x19, 0xA3,
+    0xA9, 0x77, 0x5A, 0xFD, 0xA1, 0xAF, 0xDA, 0x39, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x3A, 0xFD, 0x91, 0xFE, 0xA0, 0x2F, 0xFA,
+    0x97, 0x1F, 0xFE, 0xA7, 0xE9, 0x99, 0x9A, 0xAF, 0x95, 0xDA, 0x6A, 0xE9, 0x4D, 0xA7, 0x9E, 0x4D,
+    0xA7, 0x09, 0xDA, 0x3D, 0xA7, 0x1E, 0x3D, 0xA7, 0x1A, 0xD3, 0xDA, 0x71, 0x9D, 0x90, 0x99, 0xE9,
+    0x99, 0x99, 0x49, 0xD9, 0x0F, 0xFD, 0x49, 0xDA, 0x0F, 0xFC, 0xA4, 0x9D, 0x92, 0xDA, 0x71, 0x9D,
+    0x92, 0xDA, 0x71, 0xAD, 0x3D, 0xA7, 0x1E, 0x3D, 0xA7, 0x09, 0xDA, 0x3D, 0xA7, 0x9E, 0x4D, 0xA6,
+    0x9E, 0x94, 0xDA, 0x99, 0x99, 0x9A, 0xF9, 0x5F, 0xFF, 0x7F, 0xFC, 0xA6, 0x59, 0x94, 0x97, 0x0F,
+    0x91, 0x9C, 0x96, 0xDA, 0xFE, 0x7C, 0xA2, 0xF9, 0x79, 0x59, 0x77, 0x70, 0xE7, 0x2D, 0x90, 0xEA,
+    0x71, 0xD9, 0x0F, 0x97, 0x0D, 0x90, 0xFC, 0x70, 0xD9, 0x0D, 0x9D, 0xA7, 0xD9, 0x0D, 0x0A, 0xD9,
+    0x6D, 0x90, 0xD1, 0xE6, 0xD9, 0x0D, 0x19, 0xDA, 0x5D, 0x90, 0xD2, 0xE5, 0xD9, 0x0D, 0x92, 0xE4,
+    0xD9, 0x0D, 0x92, 0x9D, 0xA3, 0xD9, 0x0D, 0x93, 0xE3, 0xD9, 0x0D, 0x94, 0xE2, 0xD9, 0x0D, 0x94,
+    0xAD, 0x91, 0xD9, 0x0D, 0x95, 0xE1, 0xD9, 0x0D, 0x95, 0x9E, 0x0D, 0x90, 0xD9, 0x6A, 0xD9, 0xD9,
+    0x0D, 0x97, 0xFC, 0x90, 0xD9, 0x79, 0xF9, 0x0D, 0x97, 0x0A, 0xE9, 0x0D, 0x97, 0x1E, 0x90, 0x69,
+    0x99, 0x77, 0x0E, 0x77, 0x1D, 0xA7, 0x70, 0x9D, 0x97, 0x71, 0xD7, 0x72, 0x97, 0x77, 0x71, 0xAF,
+    0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA,
+    0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74,
+    0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D,
+    0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF,
+    0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x73, 0x99, 0x77, 0x0E, 0x97, 0x69, 0xD9, 0x77,
+    0xDA, 0x77, 0xD9, 0x77, 0x09, 0x77, 0x77, 0x3A, 0xFE, 0x97, 0x09, 0xFF, 0xE9, 0x5A, 0xEA, 0x92,
+    0x9A, 0xE9, 0x39, 0xE7, 0x9E, 0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0xA7, 0x2E, 0x1A, 0xD7, 0x39, 0xD9,
+    0x0E, 0x74, 0xDA, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D,
+    0xA7, 0x4E, 0x0E, 0x74, 0xDA, 0x0A, 0xD7, 0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71, 0x9E,
+    0x29, 0xE7, 0x0E, 0x4A, 0xEA, 0x4A, 0xE9, 0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99, 0x70,
+    0x70, 0x99, 0x97, 0x7A, 0xE9, 0x75, 0x9F, 0xC7, 0x5D, 0xA0, 0xAD, 0x73, 0xD9, 0x2A, 0xD7, 0x29,
+    0x69, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79,
+    0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA,
+    0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D,
+    0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE,
+    0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x69, 0x94, 0x99, 0x71,
+    0xFA, 0x2C, 0xA7, 0x09, 0xDA, 0xFD, 0x97, 0x0D, 0x2A, 0xEA, 0x71, 0x95, 0x97, 0x77, 0x70, 0xAF,
+    0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA,
+    0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74,
+    0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D,
+    0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF,
+    0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x69, 0x77, 0x1A, 0xD2, 0xD9, 0x72, 0xAD, 0x2D,
+    0x97, 0x3A, 0x92, 0x9A, 0x77, 0x77, 0x77, 0x3A, 0xFE, 0x97, 0x09, 0xFF, 0xE9, 0x5A, 0xEA, 0x92,
+    0x9A, 0xE9, 0x39, 0xE7, 0x9E, 0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0xA7, 0x2E, 0x1A, 0xD7, 0x39, 0xD9,
+    0x0E, 0x74, 0xDA, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D,
+    0xA7, 0x4E, 0x0E, 0x74, 0xDA, 0x0A, 0xD7, 0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71, 0x9E,
+    0x29, 0xE7, 0x0E, 0x4A, 0xEA, 0x4A, 0xE9, 0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99, 0x70,
+    0x19, 0x70, 0x91, 0xDA, 0x6D, 0x90, 0x9D, 0xA4, 0xE2, 0x9D, 0xA2, 0xE4, 0x9D, 0xA0, 0xE6, 0x9F,
+    0xC7, 0x09, 0xE7, 0x1F, 0xA7, 0xEA, 0xDA, 0x5E, 0x19, 0xDA, 0x3E, 0x39, 0xDA, 0x1E, 0x59, 0xD9,
+    0x09, 0xC7, 0x9C, 0x76, 0x77, 0x09, 0x7A, 0xFD, 0xA9, 0x0D, 0x94, 0x9F, 0xFF, 0xC4, 0xAE, 0xA9,
+    0x29, 0xF9, 0x39, 0xE7, 0xF3, 0xE7, 0xAF, 0xA1, 0x9D, 0xA6, 0x9D, 0x0E, 0x1A, 0xD7, 0xD9, 0x09,
+    0xD9, 0x0E, 0x6D, 0xA2, 0xDA, 0x0D, 0xA5, 0xAD, 0x3E, 0x0D, 0xA4, 0x9D, 0x93, 0xE0, 0xDA, 0x4D,
+    0xA4, 0xE0, 0xDA, 0x3A, 0xD5, 0xE0, 0xDA, 0x29, 0xD6, 0xE0, 0xE2, 0xDA, 0x6D, 0xA0, 0xAD, 0x1E,
+    0x69, 0xDA, 0x09, 0xD9, 0x9D, 0x7A, 0xD2, 0xFC, 0x96, 0x9E, 0x29, 0xEA, 0x7E, 0x4F, 0xA4, 0xAE,
+    0x93, 0x9F, 0xFF, 0xC9, 0x4D, 0xA0, 0xAF, 0xEA, 0x7A, 0x49, 0x97, 0x00, 0x49, 0x99, 0x75, 0xAD,
+    0x97, 0x5E, 0x76, 0xDA, 0x76, 0xD9, 0x76, 0x97, 0x77, 0x9D, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D,
+    0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D, 0x97, 0x1D,
+    0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA, 0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F, 0xEA, 0x73,
+    0x99, 0x60, 0x71, 0x99, 0x97, 0x4A, 0xDA, 0x74, 0xDA, 0x74, 0xE7, 0x4A, 0xCA, 0x75, 0x99, 0x77,
+    0x70, 0x9D, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9,
+    0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA,
+    0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA,
+    0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F, 0xEA, 0x73, 0x99, 0x60, 0x69, 0x99, 0x74, 0x9E, 0xA7, 0x3F,
+    0xC9, 0x71, 0xDA, 0x0A, 0xD7, 0x0D, 0xA2, 0x9D, 0x79, 0x69, 0x77, 0x49, 0xD7, 0x2D, 0xA9, 0xD9,
+    0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA,
+    0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA0,
+    0xD9, 0x71, 0xD9, 0x0E, 0x70, 0xAD, 0x1A, 0xDA, 0x7E, 0x2E, 0xA9, 0x3A, 0xE4, 0xFF, 0xE9, 0x59,
+    0xFE, 0xA7, 0x39, 0x96, 0x72, 0x97, 0x09, 0xD2, 0xDA, 0x79, 0xD9, 0x1D, 0xA7, 0x09, 0x93, 0xA7,
+    0x77, 0x76, 0x9D, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D,
+    0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2,
+    0xEA, 0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F, 0xEA, 0x73, 0x99, 0x60, 0x71, 0x99, 0x75, 0xE7, 0x4A,
+    0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x75, 0x97, 0x77, 0x1A, 0xD7, 0x19, 0xD0, 0x9D, 0xA7, 0x0E, 0x1A,
+    0xD7, 0xAD, 0x3D, 0xA6, 0xDA, 0x3A, 0xD5, 0xAD, 0x5D, 0xA4, 0xDA, 0x5A, 0xD3, 0xAD, 0x7D, 0xA2,
+    0xDA, 0x7A, 0xD1, 0xAD, 0x71, 0xE9, 0xD9, 0x71, 0x9F, 0xC7, 0x3F, 0x97, 0x39, 0xE7, 0x5D, 0xA7,
+    0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA6, 0x0D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0xA7, 0x3F, 0xFC, 0xA4, 0xFF, 0xE9, 0x2D, 0x93, 0x9A, 0xE9, 0x1D,
+    0x95, 0x9E, 0x1D, 0x96, 0xE1, 0xD9, 0x6A, 0xD1, 0xD9, 0x6A, 0xD1, 0xD9, 0x6E, 0x1D, 0x96, 0xDA,
+    0x1D, 0x94, 0x9E, 0x2E, 0xAA, 0xFD, 0x92, 0xFF, 0xCA, 0x4D, 0xA9, 0x99, 0x99, 0x6D, 0x97, 0x3D,
+    0x97, 0x3D, 0x97, 0x3D, 0x97, 0x20, 0x59, 0x97, 0x2A, 0xFD, 0xA5, 0x9F, 0xFD, 0x93, 0xE9, 0x39,
+    0xE2, 0x9D, 0x95, 0x9D, 0x29, 0xD6, 0x9D, 0x2A, 0xD6, 0xE2, 0xAD, 0x5A, 0xD9, 0x2A, 0xD4, 0xE9,
+    0x3A, 0xD3, 0xE5, 0xAD, 0x29, 0xD9, 0x5A, 0xD2, 0x9D, 0x95, 0xAD, 0x3E, 0x94, 0xAD, 0x39, 0xEA,
+    0x3A, 0xD4, 0x9F, 0x2A, 0xD6, 0xAE, 0x1A, 0xD7, 0x9D, 0xA0, 0xAD, 0x70, 0xAD, 0x0A, 0xD7, 0x09,
+    0xD0, 0xAD, 0x70, 0xAD, 0x0A, 0xD1, 0x99, 0x4E, 0x0A, 0xD1, 0xAF, 0xF1, 0xAD, 0x19, 0xFE, 0x73,
+    0x95, 0x39, 0x97, 0x2E, 0x71, 0x9D, 0xA7, 0x19, 0xD7, 0x29, 0xD7, 0x39, 0x77, 0x4A, 0xAE, 0xA9,
+    0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2,
+    0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E,
+    0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1, 0xD4, 0x96, 0x70, 0x99, 0x71, 0xE7, 0x0A,
+    0xD9, 0x79, 0xD9, 0x70, 0xD9, 0x71, 0x97, 0x76, 0xAA, 0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91,
+    0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99,
+    0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9,
+    0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x59, 0x97, 0x1A, 0xE7, 0xAF, 0xC5, 0x9D, 0x90, 0xDA, 0x39,
+    0xD3, 0xDA, 0x39, 0x59, 0x97, 0x71, 0xAA, 0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97,
+    0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E,
+    0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF,
+    0xCA, 0x1D, 0x49, 0x60, 0x39, 0x94, 0x93, 0xFA, 0x19, 0xC9, 0x1A, 0xCA, 0xAF, 0xD2, 0xCA, 0x2A,
+    0xE9, 0x29, 0x59, 0x77, 0x3A, 0xAE, 0xA9, 0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7,
+    0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2, 0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD,
+    0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E, 0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1,
+    0xD4, 0x96, 0x39, 0x72, 0xDA, 0x19, 0xD4, 0xE1, 0x9D, 0x94, 0xA3, 0x99, 0x77, 0x77, 0xAA, 0xEA,
+    0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD,
+    0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59,
+    0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x49, 0xDA, 0x7A, 0xDA,
+    0xD6, 0xCA, 0x19, 0xC9, 0x5C, 0xA2, 0xC9, 0x5D, 0x90, 0xAC, 0x7F, 0x97, 0x09, 0x97, 0x75, 0xAA,
+    0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99,
+    0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD,
+    0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x29, 0xAF, 0xA3,
+    0xAE, 0xA5, 0xFF, 0xC0, 0x9F, 0xEA, 0x3D, 0xA9, 0x1A, 0xFD, 0x90, 0x9A, 0xD9, 0x71, 0x9F, 0x4E,
+    0x72, 0xE5, 0x9D, 0x97, 0x1E, 0x6D, 0xA5, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x99, 0xDA, 0x2A, 0xFF,
+    0xFF, 0xDA, 0x09, 0xFA, 0x99, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0E, 0x5E, 0x71, 0xAD, 0x6E,
+    0x71, 0xAD, 0x6E, 0x71, 0xAD, 0x5A, 0xEA, 0x70, 0x9D, 0xA3, 0xAD, 0x9D, 0xA4, 0x9C, 0x1F, 0xFC,
+    0x1A, 0xFF, 0xC2, 0xAF, 0xCA, 0x39, 0xFE, 0x95, 0x97, 0x19, 0x94, 0x4A, 0xFA, 0x93, 0xAF, 0xF2,
+    0xAE, 0x99, 0x9A, 0xC9, 0x19, 0xDA, 0x70, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09,
+    0xD9, 0x70, 0x9D, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0xAD, 0x97, 0x1E, 0x93, 0x9A, 0x29, 0xFF, 0xC4,
+    0xAF, 0xD9, 0x6A, 0xC9, 0x71, 0xD7, 0x19, 0xAD, 0xA7, 0x2D, 0x72, 0xD6, 0x9A, 0xAD, 0xA6, 0xAE,
+    0xA3, 0x39, 0x97, 0x3E, 0x72, 0x9D, 0xA7, 0x29, 0xD9, 0x72, 0x9D, 0x74, 0x97, 0x76, 0x9A, 0xEA,
+    0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90, 0x9A, 0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6, 0xDA, 0x0D, 0xA6,
+    0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E, 0x9F, 0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9,
+    0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A, 0xFE, 0xA7, 0x99,
+    0x40, 0x70, 0x99, 0x72, 0xE7, 0x1A, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x72, 0x97, 0x77, 0x09, 0xAE,
+    0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E, 0x6D, 0xA0, 0xDA,
+    0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9D,
+    0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93, 0xAF, 0xEA, 0x79,
+    0x94, 0x59, 0x97, 0x2A, 0xE7, 0x09, 0xFC, 0x69, 0xD9, 0x0E, 0x5D, 0x92, 0xAC, 0xA4, 0x95, 0x99,
+    0x77, 0x39, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E,
+    0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93,
+    0xAF, 0xEA, 0x79, 0x94, 0x39, 0x73, 0xAD, 0x2D, 0x94, 0xAD, 0x2D, 0x95, 0xA9, 0x29, 0x97, 0x77,
+    0x72, 0x9A, 0xEA, 0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90, 0x9A, 0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6,
+    0xDA, 0x0D, 0xA6, 0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E, 0x9F, 0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0xD9, 0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A,
+    0xFE, 0xA7, 0x99, 0x40, 0x09, 0x99, 0x3A, 0xD9, 0x3E, 0x4D, 0xA4, 0xD9, 0x49, 0x97, 0x19, 0xAA,
+    0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD0, 0x29, 0x99, 0x29, 0xDA, 0x2E, 0x2A, 0xD2, 0x9D, 0x39,
+    0x97, 0x39, 0xAA, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0x49, 0x97, 0xEA, 0x5F, 0xC9, 0x3E,
+    0x09, 0xD9, 0x1A, 0xCA, 0x29, 0xD9, 0x09, 0x95, 0x97, 0x79, 0xAA, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD,
+    0x7A, 0xD3, 0x69, 0x1D, 0x91, 0xAC, 0xA9, 0xD9, 0x1E, 0x09, 0x93, 0xA7, 0x75, 0x9A, 0xA5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x20, 0x77, 0x4C, 0xA3, 0xAC, 0x69, 0xEA, 0xAE, 0x70, 0xAF, 0xA7,
+    0x1F, 0xC7, 0x0A, 0xE9, 0xE7, 0xD9, 0x19, 0xDA, 0x74, 0xAD, 0x75, 0xDA, 0x59, 0xAA, 0xCA, 0xA0,
+    0x9D, 0x4A, 0xFE, 0xAD, 0x92, 0xEA, 0x99, 0x99, 0xFA, 0x1A, 0xD9, 0x5A, 0xE1, 0xDA, 0x7E, 0x1D,
+    0x97, 0xAD, 0x09, 0xD7, 0x0A, 0xD0, 0x9D, 0x70, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7D, 0xA1,
+    0xAD, 0x69, 0xD3, 0xE9, 0x39, 0xDA, 0x39, 0xFF, 0xD6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x39, 0x94,
+    0x94, 0xF9, 0x19, 0xC3, 0xDA, 0xFE, 0x3C, 0x91, 0x9F, 0x49, 0x59, 0x77, 0x19, 0xA9, 0x19, 0xFA,
+    0x2A, 0xD0, 0xFF, 0x90, 0xAF, 0xA9, 0x09, 0xAE, 0x0A, 0xE5, 0xAD, 0x9A, 0xDA, 0x6D, 0xAA, 0xD9,
+    0x6D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D,
+    0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xA0, 0x39, 0x99, 0x74, 0xAD, 0xA7,
+    0x4A, 0xD7, 0x5A, 0xD7, 0x5A, 0xCA, 0x75, 0x99, 0x77, 0x72, 0xAF, 0x97, 0xAF, 0xF9, 0x4A, 0xE9,
+    0x99, 0xAE, 0x92, 0x9D, 0xA5, 0xE2, 0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0, 0x9D,
+    0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19, 0xD9,
+    0x5A, 0xD3, 0xE9, 0x3A, 0xDA, 0x4F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x70, 0x99, 0x97,
+    0x39, 0xDA, 0x73, 0xE7, 0x3A, 0xD7, 0x39, 0xD7, 0x59, 0x77, 0x74, 0xAF, 0x97, 0xAF, 0xF9, 0x4A,
+    0xE9, 0x99, 0xAE, 0x92, 0x9D, 0xA5, 0xE2, 0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0,
+    0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19,
+    0xD9, 0x5A, 0xD3, 0xE9, 0x3A, 0xDA, 0x4F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x69, 0x97,
+    0x4E, 0xA7, 0x2F, 0xC9, 0x70, 0xAD, 0x09, 0xD9, 0x6A, 0xCA, 0x29, 0xD9, 0x59, 0x95, 0x99, 0x77,
+    0x7A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D,
+    0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1,
+    0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD,
+    0x97, 0x29, 0x96, 0x49, 0x94, 0x95, 0x9F, 0x91, 0xAC, 0x5D, 0xAF, 0xDA, 0x49, 0xC9, 0x19, 0xF6,
+    0x97, 0x77, 0x70, 0xAF, 0x97, 0xAF, 0xF9, 0x4A, 0xE9, 0x99, 0xAE, 0x92, 0x9D, 0xA5, 0xE2, 0xE6,
+    0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D,
+    0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19, 0xD9, 0x5A, 0xD3, 0xE9, 0x3A, 0xDA, 0x4F, 0xFC,
+    0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x71, 0x97, 0x0D, 0x91, 0xAD, 0x7D, 0x91, 0xAD, 0x79, 0xA3,
+    0xA7, 0x77, 0x77, 0x1A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E,
+    0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09,
+    0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF,
+    0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x96, 0x5D, 0x97, 0x29, 0xE7, 0x3E, 0x73, 0x99, 0x77, 0x69, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x77, 0x77, 0x4D, 0xA7, 0x29,
+    0xE7, 0x3E, 0x74, 0x96, 0x77, 0x4A, 0xEA, 0x90, 0xD9, 0x3A, 0xFF, 0xD3, 0xAE, 0x99, 0x9A, 0xE9,
+    0x29, 0xDA, 0x4F, 0x2E, 0x4A, 0xF9, 0x1D, 0xA3, 0x9D, 0x0D, 0xA0, 0x9D, 0x93, 0xD9, 0x0A, 0xD0,
+    0x9D, 0x92, 0xDA, 0x1A, 0xD0, 0x9D, 0x91, 0xAD, 0x2A, 0xD0, 0x9D, 0x90, 0x9D, 0x3A, 0xD1, 0xD9,
+    0x0D, 0x93, 0xE1, 0xFC, 0xA4, 0xDA, 0x19, 0xF4, 0xAD, 0x3E, 0xA3, 0xAD, 0xA3, 0xFF, 0xDA, 0x3A,
+    0xDA, 0xFD, 0x95, 0xA3, 0x99, 0x60, 0x29, 0x99, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x73,
+    0xAC, 0xA7, 0x39, 0x97, 0x72, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD,
+    0x90, 0xAC, 0xA4, 0x99, 0x60, 0x79, 0x99, 0x72, 0xE7, 0x1E, 0x71, 0x9D, 0x72, 0xD7, 0x39, 0x77,
+    0x49, 0xAA, 0x7A, 0xA9, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D,
+    0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x69, 0xDA,
+    0xAD, 0x95, 0xEA, 0x0E, 0x93, 0xFA, 0x0A, 0xFF, 0xAD, 0xA1, 0x9F, 0xD9, 0x0A, 0xCA, 0x49, 0x96,
+    0x59, 0x97, 0x2F, 0x70, 0xAF, 0xA6, 0xAD, 0x09, 0xDA, 0x49, 0xD3, 0xD9, 0x39, 0x95, 0x99, 0x77,
+    0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D, 0xAA,
+    0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC, 0xA4, 0x99, 0x60,
+    0x39, 0x73, 0xDA, 0x19, 0xD5, 0xDA, 0x1A, 0xD5, 0x9A, 0x3A, 0x97, 0x77, 0x69, 0xAA, 0x7A, 0xA9,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x69, 0xDA, 0xAD, 0x95, 0xEA, 0x0E,
+    0x93, 0xFA, 0x0A, 0xFF, 0xAD, 0xA1, 0x9F, 0xD9, 0x0A, 0xCA, 0x49, 0x96, 0x70, 0x99, 0x97, 0x2E,
+    0x97, 0x19, 0xD9, 0x72, 0xDA, 0x72, 0xAC, 0xA7, 0x39, 0x97, 0x75, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD,
+    0x79, 0xD9, 0x0D, 0xA6, 0xAD, 0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A,
+    0xD4, 0xDA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D,
+    0xA7, 0x0D, 0x9D, 0x97, 0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x73,
+    0xDA, 0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xAE, 0xA7, 0x10, 0x76, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73,
+    0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x19, 0xEA, 0x93, 0xAD, 0x0F, 0xF2, 0xAF, 0xA9, 0x09,
+    0xAE, 0x1A, 0xE5, 0xAD, 0x90, 0xAD, 0xA6, 0xE0, 0xAD, 0x96, 0xAD, 0x0A, 0xD7, 0x9D, 0x0A, 0xD7,
+    0x9D, 0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0xAD, 0x0A, 0xDA, 0x6E, 0x0A, 0xE5, 0x9D,
+    0xA0, 0xAF, 0x39, 0xE1, 0xAD, 0xAF, 0xF9, 0x1A, 0xD0, 0x9F, 0xD3, 0xAD, 0x39, 0x95, 0xAD, 0x73,
+    0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x39, 0x74, 0xAD, 0x2D, 0x95, 0xAD,
+    0x2D, 0xA6, 0xA9, 0x29, 0xA7, 0x77, 0x71, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79, 0xD9, 0x0D, 0xA6,
+    0xAD, 0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A, 0xD4, 0xDA, 0x4D, 0x92,
+    0x9D, 0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D, 0xA7, 0x0D, 0x9D, 0x97,
+    0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x71, 0x9E, 0x7A,
+    0xFC, 0x70, 0xAE, 0xA7, 0x10, 0x4F, 0xF9, 0x71, 0xFF, 0xA7, 0x19, 0x99, 0x99, 0x99, 0x97, 0x77,
+    0x70, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72,
+    0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6,
+    0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7,
+    0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD,
+    0x0E, 0x73, 0x9D, 0x90, 0x2F, 0xF9, 0x3F, 0xFA, 0x39, 0x99, 0x99, 0x99, 0x97, 0x72, 0xAA, 0xEA,
+    0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD,
+    0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59,
+    0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x4A, 0x5A, 0x97, 0x1C,
+    0xA3, 0x9C, 0xA7, 0x1A, 0xFE, 0x73, 0xAF, 0xC7, 0x69, 0x97, 0x77, 0x73, 0xDA, 0x76, 0x9E, 0x76,
+    0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D,
+    0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF,
+    0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E,
+    0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x2A,
+    0x5A, 0x93, 0xCA, 0x39, 0xCA, 0x3A, 0xFE, 0x5A, 0xFC, 0x70, 0x99, 0x77, 0x5A, 0xAE, 0xA9, 0x3A,
+    0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2, 0xAF,
+    0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E, 0x9D,
+    0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1, 0xD4, 0x96, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97,
+    0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71,
+    0xD9, 0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95,
+    0xFF, 0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD,
+    0x71, 0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x76, 0xAC, 0x97,
+    0x69, 0xCA, 0x77, 0xD7, 0x70, 0xD7, 0x70, 0xDA, 0x99, 0x75, 0xAE, 0xA7, 0x79, 0x90, 0x3A, 0xAE,
+    0xA9, 0x4A, 0xFF, 0xA3, 0xAC, 0xA9, 0x19, 0xE9, 0x72, 0xE7, 0x2A, 0xD7, 0x2A, 0xD7, 0x99, 0x9A,
+    0xD3, 0xAF, 0xFC, 0x19, 0xFA, 0x99, 0x9A, 0xD1, 0xE5, 0xAD, 0x0A, 0xD6, 0xAD, 0x0A, 0xD6, 0xE0,
+    0xAD, 0x59, 0xE0, 0x9D, 0xA3, 0x9F, 0x1F, 0xFC, 0x9D, 0x2A, 0xFC, 0xA1, 0xD5, 0x93, 0x9C, 0xA7,
+    0x19, 0xCA, 0x72, 0xD7, 0x3D, 0x73, 0xDA, 0x99, 0x70, 0x9E, 0xA7, 0x29, 0x90, 0x72, 0x99, 0x97,
+    0x5E, 0x74, 0xE7, 0x49, 0xD9, 0x74, 0xD7, 0x69, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x5F, 0xFE, 0x92,
+    0x9F, 0xA9, 0x19, 0xAD, 0x3E, 0x97, 0x3E, 0x97, 0x39, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xDA,
+    0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x75,
+    0x9E, 0x75, 0xAE, 0xA9, 0x39, 0xAA, 0x4A, 0xFF, 0xDA, 0x6A, 0xFF, 0x97, 0x19, 0x99, 0x40, 0x70,
+    0x99, 0x71, 0xE7, 0x0A, 0xD9, 0x70, 0xD9, 0x70, 0xD9, 0x71, 0x97, 0x77, 0xAF, 0xA9, 0x3A, 0xFF,
+    0x2A, 0xE9, 0x99, 0xAC, 0x91, 0x9D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70,
+    0x9D, 0x97, 0x09, 0xD9, 0x71, 0xDA, 0x71, 0xE7, 0x1A, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC,
+    0x4A, 0xFD, 0x97, 0x99, 0x30, 0x70, 0x99, 0x75, 0xF7, 0x3A, 0xFA, 0x71, 0x9D, 0x1D, 0xA7, 0x9D,
+    0x3D, 0xA6, 0x99, 0x59, 0x97, 0x77, 0x09, 0xAF, 0xDA, 0x95, 0xFF, 0xE9, 0x29, 0xFA, 0x91, 0x9A,
+    0xD3, 0xE9, 0x73, 0xE9, 0x73, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D,
+    0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5E, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xE7, 0x59, 0xE7, 0x5A, 0xEA,
+    0x93, 0x9A, 0xA4, 0xAF, 0xFD, 0xA6, 0xAF, 0xF9, 0x71, 0x99, 0x94, 0x59, 0x97, 0x1A, 0xE7, 0x9F,
+    0xC5, 0x9D, 0x90, 0xE4, 0xD9, 0x2A, 0xCA, 0x39, 0x59, 0x97, 0x72, 0xAF, 0xA9, 0x3A, 0xFF, 0x2A,
+    0xE9, 0x99, 0xAC, 0x91, 0x9D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D,
+    0x97, 0x09, 0xD9, 0x71, 0xDA, 0x71, 0xE7, 0x1A, 0xD9, 0x71, 0xE9, 0x39, 0xA2, 0x9F, 0xFC, 0x4A,
+    0xFD, 0x97, 0x99, 0x30, 0x70, 0x99, 0x75, 0x9D, 0x97, 0x49, 0xDA, 0x75, 0xAA, 0x77, 0x77, 0x75,
+    0x9A, 0xFD, 0xA9, 0x5F, 0xFE, 0x92, 0x9F, 0xA9, 0x19, 0xAD, 0x3E, 0x97, 0x3E, 0x97, 0x39, 0xDA,
+    0x74, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xE7,
+    0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x75, 0x9E, 0x75, 0xAE, 0xA9, 0x39, 0xAA, 0x4A, 0xFF, 0xDA, 0x6A,
+    0xFF, 0x97, 0x19, 0x99, 0x40, 0x59, 0x97, 0x2D, 0xA7, 0x1D, 0xA7, 0x1A, 0xA7, 0x77, 0x73, 0xAF,
+    0xA9, 0x3A, 0xFF, 0x2A, 0xE9, 0x99, 0xAC, 0x91, 0x9D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x71, 0xDA, 0x71, 0xE7, 0x1A, 0xD9, 0x71, 0xE9, 0x39,
+    0xA2, 0x9F, 0xFC, 0x4A, 0xFD, 0x97, 0x99, 0x30, 0x49, 0x95, 0x99, 0x69, 0xD3, 0xDA, 0x7A, 0xD1,
+    0xDA, 0x71, 0xAF, 0xA7, 0x3F, 0x75, 0x99, 0x77, 0x74, 0x9A, 0xFD, 0xA9, 0x5F, 0xFE, 0x92, 0x9F,
+    0xA9, 0x19, 0xAD, 0x3E, 0x97, 0x3E, 0x97, 0x39, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xDA, 0x75,
+    0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xE7, 0x5E, 0x75, 0x9D, 0xA7, 0x5E, 0x75, 0x9E,
+    0x75, 0xAE, 0xA9, 0x39, 0xAA, 0x4A, 0xFF, 0xDA, 0x6A, 0xFF, 0x97, 0x19, 0x99, 0x40, 0x29, 0x59,
+    0x93, 0xD9, 0x2A, 0xCA, 0x39, 0xD9, 0x0E, 0x59, 0xFC, 0x7A, 0xE7, 0x19, 0x97, 0x76, 0xAF, 0xA9,
+    0x3A, 0xFF, 0x2A, 0xE9, 0x99, 0xAC, 0x91, 0x9D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x09,
+    0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x71, 0xDA, 0x71, 0xE7, 0x1A, 0xD9, 0x71, 0xE9, 0x39, 0xA2,
+    0x9F, 0xFC, 0x4A, 0xFD, 0x97, 0x99, 0x30, 0x39, 0x69, 0x70, 0xD9, 0x29, 0xD7, 0x1D, 0xA0, 0xAD,
+    0x73, 0xFC, 0x74, 0x9E, 0x97, 0x59, 0x99, 0x77, 0x72, 0xFF, 0xA9, 0x7F, 0xFF, 0x5D, 0xA9, 0x99,
+    0x9A, 0xAF, 0x93, 0xD9, 0x69, 0xE9, 0x2D, 0x97, 0x9E, 0x2D, 0x97, 0x09, 0xDA, 0x1D, 0x97, 0x1E,
+    0x1D, 0x97, 0x1A, 0xD1, 0xD9, 0x71, 0x9D, 0x90, 0xD9, 0x71, 0x9D, 0x90, 0xD9, 0x71, 0x9D, 0xA0,
+    0xD9, 0x71, 0x9D, 0x90, 0xD9, 0x71, 0x9D, 0x90, 0xD9, 0x71, 0xAD, 0x1D, 0x97, 0x1E, 0x1D, 0x97,
+    0x09, 0xDA, 0x1D, 0x97, 0x9E, 0x2D, 0x96, 0x9E, 0x92, 0xDA, 0x99, 0x99, 0x9A, 0xF9, 0x3F, 0xFF,
+    0x5F, 0xFC, 0xA6, 0x77, 0x77, 0xD9, 0x0A, 0xD7, 0x4D, 0x90, 0xDA, 0x74, 0xD9, 0x0D, 0x75, 0xD9,
+    0x0C, 0xA7, 0x5D, 0x90, 0xA7, 0x6D, 0x97, 0x09, 0xAE, 0x91, 0xD9, 0x7F, 0xF0, 0xD9, 0x6E, 0xA9,
+    0x09, 0xAF, 0x95, 0x9D, 0xA4, 0x9E, 0x95, 0xE6, 0xAD, 0x95, 0xDA, 0x69, 0xD9, 0x49, 0xD9, 0x7D,
+    0x94, 0x9D, 0x97, 0xD9, 0x49, 0xD9, 0x7D, 0x94, 0x9D, 0x97, 0xD9, 0x5D, 0x97, 0xD9, 0x5E, 0x69,
+    0xD9, 0x5A, 0xD6, 0xE9, 0x6E, 0x93, 0xF9, 0x69, 0xFF, 0x9D, 0x97, 0x9F, 0xD9, 0x0A, 0xC9, 0x72,
+    0x99, 0x73, 0x2F, 0xFA, 0x97, 0x1F, 0xFE, 0xA7, 0xE9, 0x99, 0x9A, 0xAF, 0x95, 0xDA, 0x6A, 0xE9,
+    0x4D, 0xA7, 0x9E, 0x4D, 0xA7, 0x09, 0xDA, 0x3D, 0xA7, 0x1E, 0x3D, 0xA7, 0x1A, 0xD3, 0xDA, 0x71,
+    0x9D, 0x90, 0x99, 0xE9, 0x99, 0x99, 0x49, 0xD9, 0x0F, 0xFD, 0x49, 0xDA, 0x0F, 0xFC, 0xA4, 0x9D,
+    0x92, 0xDA, 0x71, 0x9D, 0x92, 0xDA, 0x71, 0xAD, 0x3D, 0xA7, 0x1E, 0x3D, 0xA7, 0x09, 0xDA, 0x3D,
+    0xA7, 0x9E, 0x4D, 0xA6, 0x9E, 0x94, 0xDA, 0x99, 0x99, 0x9A, 0xF9, 0x5F, 0xFF, 0x7F, 0xFC, 0xA6,
+    0x77, 0x74, 0xD9, 0x75, 0xD9, 0x7A, 0xAA, 0xAA, 0xAE, 0xA9, 0x49, 0xFF, 0xDA, 0x59, 0x99, 0x99,
+    0x9D, 0xA9, 0x74, 0xD9, 0x59, 0xAD, 0xA9, 0x1D, 0x94, 0xFF, 0x0D, 0x93, 0xF9, 0x99, 0xAF, 0x92,
+    0x9D, 0xA4, 0x9E, 0x92, 0xE6, 0xAD, 0x92, 0xDA, 0x69, 0xD9, 0x19, 0xD9, 0x7D, 0x91, 0x9D, 0x97,
+    0xD9, 0x19, 0xD9, 0x7D, 0x91, 0x9D, 0x97, 0xD9, 0x2D, 0x97, 0xD9, 0x2E, 0x69, 0xD9, 0x2A, 0xD6,
+    0xE9, 0x3E, 0x93, 0xAE, 0x93, 0x9F, 0xF9, 0xD9, 0x49, 0xFD, 0x90, 0xAC, 0x97, 0x99, 0x70, 0x19,
+    0xFF, 0x39, 0xFF, 0x49, 0x99, 0x99, 0x99, 0x97, 0x7F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99,
+    0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x2F, 0xF9,
+    0x4F, 0xFA, 0x49, 0x99, 0x99, 0x99, 0x97, 0x74, 0x9A, 0xEA, 0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90,
+    0x9A, 0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6, 0xDA, 0x0D, 0xA6, 0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E,
+    0x9F, 0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9,
+    0x72, 0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A, 0xFE, 0xA7, 0x99, 0x40, 0x19, 0xA5, 0xA3, 0x9C, 0x93,
+    0xAC, 0x4F, 0xEA, 0x5F, 0xCA, 0x70, 0x99, 0x77, 0x2F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99,
+    0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x2A, 0x59,
+    0x94, 0xCA, 0x39, 0xCA, 0x4A, 0xFE, 0x6A, 0xFC, 0x71, 0x99, 0x77, 0x79, 0xAE, 0xA9, 0x5A, 0xFE,
+    0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E, 0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9,
+    0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97,
+    0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93, 0xAF, 0xEA, 0x79, 0x94, 0x59, 0x97,
+    0x19, 0xD9, 0x70, 0xAD, 0x97, 0x1A, 0xA7, 0x77, 0x7F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99,
+    0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x69, 0x73,
+    0xDA, 0x72, 0xE7, 0x29, 0xA7, 0x77, 0x75, 0x9A, 0xEA, 0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90, 0x9A,
+    0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6, 0xDA, 0x0D, 0xA6, 0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E, 0x9F,
+    0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9, 0x72,
+    0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A, 0xFE, 0xA7, 0x99, 0x40, 0x0F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D,
+    0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9,
+    0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9,
+    0x70, 0xD7, 0x1A, 0xC9, 0x70, 0x9D, 0x71, 0x9C, 0xA7, 0x19, 0xD9, 0x97, 0x0F, 0x97, 0x09, 0x99,
+    0x00, 0x39, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E,
+    0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93,
+    0xAF, 0xF7, 0x99, 0x9D, 0x72, 0xD7, 0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2A, 0xD9, 0x97, 0x1F, 0x72,
+    0x99, 0x90, 0x19, 0x95, 0x99, 0x2A, 0xD3, 0xD9, 0x3A, 0xD0, 0x9D, 0x95, 0xFC, 0xA7, 0xEA, 0x71,
+    0x99, 0x77, 0x2F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99,
+    0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x29, 0x59, 0x94, 0xD9, 0x2A, 0xD4, 0x9D, 0x90,
+    0xE6, 0x9F, 0xC7, 0x0A, 0xE7, 0x29, 0x97, 0x77, 0x9A, 0xEA, 0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90,
+    0x9A, 0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6, 0xDA, 0x0D, 0xA6, 0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E,
+    0x9F, 0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9,
+    0x72, 0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A, 0xFE, 0xA7, 0x99, 0x40, 0x71, 0x99, 0x77, 0xEA, 0x75,
+    0xFC, 0x97, 0x3A, 0xD0, 0x9D, 0x97, 0x1A, 0xCA, 0x29, 0xD9, 0x70, 0x99, 0x59, 0x77, 0x75, 0xAF,
+    0xEA, 0x96, 0xAF, 0xFE, 0xA4, 0xFA, 0x92, 0x9A, 0xD4, 0xEA, 0x75, 0xAD, 0xA7, 0x6E, 0x76, 0xAD,
+    0x97, 0x6E, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x6F, 0xE1, 0xDA, 0x6F, 0xE1, 0xDA, 0x69, 0x99,
+    0x9A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x72, 0xAD, 0x19, 0xDA, 0x71, 0xAD, 0x2E, 0x97, 0x0A, 0xD2,
+    0x9E, 0x97, 0xAD, 0x3A, 0xEA, 0x94, 0x9A, 0xD4, 0x9F, 0xFF, 0xC6, 0xAF, 0xFC, 0xA9, 0x72, 0x99,
+    0x60, 0x59, 0x99, 0x72, 0x9E, 0x97, 0x1F, 0xC9, 0x7D, 0xA0, 0xAD, 0x6D, 0xA2, 0x9D, 0x59, 0x69,
+    0x77, 0x59, 0xAE, 0x91, 0x9A, 0x92, 0xFF, 0x0D, 0x91, 0xEA, 0x99, 0x9A, 0xF9, 0x09, 0xDA, 0x49,
+    0xE9, 0x0E, 0x6A, 0xD9, 0x0D, 0xA6, 0x9D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D, 0x99, 0xD9, 0x7D,
+    0x99, 0xD9, 0x7D, 0x90, 0xD9, 0x7D, 0x90, 0xE6, 0x9D, 0x90, 0xAD, 0x95, 0xE9, 0x1E, 0x93, 0xAE,
+    0x91, 0x9F, 0xF9, 0xD9, 0x29, 0xFD, 0x90, 0xD9, 0x59, 0x93, 0xD9, 0x73, 0xD9, 0x72, 0x9D, 0x73,
+    0xE2, 0xCA, 0x99, 0x29, 0xE9, 0x2F, 0xFD, 0x93, 0x9A, 0xFD, 0xA3, 0x59, 0xA5, 0xA7, 0x1A, 0xC9,
+    0x3A, 0xC7, 0x2F, 0xEA, 0x72, 0x9F, 0xCA, 0x76, 0x99, 0x77, 0x77, 0x0A, 0xFE, 0xA9, 0x6A, 0xFF,
+    0xEA, 0x4F, 0xA9, 0x29, 0xAD, 0x4E, 0xA7, 0x5A, 0xDA, 0x76, 0xE7, 0x6A, 0xD9, 0x76, 0xE7, 0x7D,
+    0xA7, 0x7D, 0xA7, 0x7D, 0xA6, 0xFE, 0x1D, 0xA6, 0xFE, 0x1D, 0xA6, 0x99, 0x99, 0xAD, 0x1E, 0x72,
+    0xAD, 0x1A, 0xD7, 0x2A, 0xD1, 0x9D, 0xA7, 0x1A, 0xD2, 0xE9, 0x70, 0xAD, 0x29, 0xE9, 0x7A, 0xD3,
+    0xAE, 0xA9, 0x49, 0xAD, 0x49, 0xFF, 0xFC, 0x6A, 0xFF, 0xCA, 0x97, 0x29, 0x96, 0x29, 0x94, 0x9A,
+    0x5A, 0xC4, 0xD6, 0xFE, 0x96, 0x9F, 0xC9, 0x72, 0x99, 0x77, 0x70, 0x9A, 0xE9, 0x19, 0xA9, 0x2F,
+    0xF0, 0xD9, 0x1E, 0xA9, 0x99, 0xAF, 0x90, 0x9D, 0xA4, 0x9E, 0x90, 0xE6, 0xAD, 0x90, 0xDA, 0x69,
+    0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x0D, 0x97, 0xD9,
+    0x0E, 0x69, 0xD9, 0x0A, 0xD9, 0x5E, 0x91, 0xE9, 0x3A, 0xE9, 0x19, 0xFF, 0x9D, 0x92, 0x9F, 0xD9,
+    0x0D, 0x95, 0x99, 0x3D, 0x97, 0x3D, 0x97, 0x29, 0xD7, 0x3E, 0x2C, 0xA9, 0x92, 0x9E, 0x92, 0xFF,
+    0xD9, 0x39, 0xAF, 0xDA, 0x30, 0x71, 0x99, 0x77, 0xAD, 0x77, 0xAD, 0x97, 0x7A, 0xA7, 0x77, 0x77,
+    0x73, 0xAF, 0xEA, 0x96, 0xAF, 0xFE, 0xA4, 0xFA, 0x92, 0x9A, 0xD4, 0xEA, 0x75, 0xAD, 0xA7, 0x6E,
+    0x76, 0xAD, 0x97, 0x6E, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x6F, 0xE1, 0xDA, 0x6F, 0xE1, 0xDA,
+    0x69, 0x99, 0x9A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x72, 0xAD, 0x19, 0xDA, 0x71, 0xAD, 0x2E, 0x97,
+    0x0A, 0xD2, 0x9E, 0x97, 0xAD, 0x3A, 0xEA, 0x94, 0x9A, 0xD4, 0x9F, 0xFF, 0xC6, 0xAF, 0xFC, 0xA9,
+    0x72, 0x99, 0x60, 0x69, 0x74, 0xAD, 0x73, 0xE7, 0x4A, 0x97, 0x77, 0x77, 0x9A, 0xE9, 0x19, 0xA9,
+    0x2F, 0xF0, 0xD9, 0x1E, 0xA9, 0x99, 0xAF, 0x90, 0x9D, 0xA4, 0x9E, 0x90, 0xE6, 0xAD, 0x90, 0xDA,
+    0x69, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x0D, 0x97,
+    0xD9, 0x0E, 0x69, 0xD9, 0x0A, 0xD9, 0x5E, 0x91, 0xE9, 0x3A, 0xE9, 0x19, 0xFF, 0x9D, 0x92, 0x9F,
+    0xD9, 0x0D, 0x95, 0x99, 0x3D, 0x97, 0x3D, 0x97, 0x29, 0xD7, 0x3E, 0x2C, 0xA9, 0x92, 0x9E, 0x92,
+    0xFF, 0xD9, 0x39, 0xAF, 0xDA, 0x30, 0x77, 0x71, 0xAF, 0xEA, 0x96, 0xAF, 0xFE, 0xA4, 0xFA, 0x92,
+    0x9A, 0xD4, 0xEA, 0x75, 0xAD, 0xA7, 0x6E, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xDA, 0x77, 0xDA, 0x77,
+    0xDA, 0x6F, 0xE1, 0xDA, 0x6F, 0xE1, 0xDA, 0x69, 0x99, 0x9A, 0xD1, 0xE7, 0x2A, 0xD1, 0xAD, 0x72,
+    0xAD, 0x19, 0xDA, 0x71, 0xAD, 0x2E, 0x97, 0x0A, 0xD2, 0x9E, 0x97, 0xAD, 0x3A, 0xEA, 0x94, 0x9A,
+    0xD4, 0x9F, 0xFF, 0xC6, 0xAF, 0xFC, 0xA9, 0x72, 0x99, 0x77, 0x77, 0x3D, 0x97, 0x69, 0xD7, 0x7A,
+    0xCA, 0x77, 0xD7, 0x70, 0x97, 0x00, 0x79, 0x74, 0x9C, 0x97, 0x3D, 0x73, 0xAD, 0x73, 0xDA, 0x73,
+    0x99, 0x77, 0x71, 0x9A, 0xE9, 0x19, 0xA9, 0x2F, 0xF0, 0xD9, 0x1E, 0xA9, 0x99, 0xAF, 0x90, 0x9D,
+    0xA4, 0x9E, 0x90, 0xE6, 0xAD, 0x90, 0xDA, 0x69, 0xD9, 0x9D, 0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x9D,
+    0x97, 0xD9, 0x9D, 0x97, 0xD9, 0x0D, 0x97, 0xD9, 0x0E, 0x69, 0xD9, 0x0A, 0xD9, 0x5E, 0x91, 0xE9,
+    0x3A, 0xE9, 0x19, 0xFF, 0x9D, 0x92, 0x9F, 0xD9, 0x0D, 0x95, 0x99, 0x3D, 0x97, 0x3D, 0x97, 0x29,
+    0xD7, 0x3E, 0x2C, 0xA9, 0x92, 0x9E, 0x92, 0xFF, 0xD9, 0x39, 0xAF, 0xDA, 0x30, 0x79, 0x97, 0x5E,
+    0xA7, 0x3F, 0xC9, 0x71, 0xAD, 0x09, 0xD9, 0x7A, 0xCA, 0x29, 0xD9, 0x69, 0x95, 0x97, 0x75, 0xD9,
+    0x71, 0xAC, 0xA0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9,
+    0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0,
+    0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9, 0x71, 0xE0, 0xD9,
+    0x71, 0xE0, 0x49, 0x97, 0x6E, 0xA7, 0x4F, 0xC9, 0x72, 0xAD, 0x09, 0xD9, 0x70, 0xAC, 0xA2, 0x9D,
+    0x97, 0x99, 0x59, 0x77, 0x77, 0x77, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76,
+    0xAD, 0x76, 0xAD, 0x19, 0xAE, 0xA6, 0xAD, 0x0F, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xE4, 0xAE, 0x94,
+    0xAD, 0x93, 0xAD, 0xA6, 0xDA, 0x3A, 0xD9, 0x6D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD,
+    0x7D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D,
+    0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0xA0, 0x2D, 0x97, 0x1A, 0xCA, 0x5D, 0x97, 0x1E, 0x5D, 0x97,
+    0x1E, 0x29, 0x99, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x90, 0xFF, 0xFF, 0xFC, 0xAF, 0xFF,
+    0xFF, 0xC9, 0x2D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF,
+    0x5D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E,
+    0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D, 0x97, 0x1E, 0x5D,
+    0x97, 0x1E, 0x20, 0x77, 0x1A, 0xD7, 0x4A, 0xD7, 0x29, 0xAE, 0xAA, 0xAA, 0xAA, 0x4A, 0xFF, 0xD4,
+    0x99, 0xAD, 0x99, 0x99, 0x99, 0x6A, 0xD7, 0x4A, 0xD3, 0x99, 0x6A, 0xD0, 0x9F, 0xDA, 0x3A, 0xD9,
+    0xFF, 0xA2, 0xAF, 0x4E, 0x2A, 0xE5, 0x9D, 0x91, 0xAD, 0x96, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7,
+    0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA,
+    0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x29, 0x94, 0x91, 0x9F, 0x91, 0xAC, 0x1D,
+    0xAF, 0xE1, 0xC9, 0x19, 0xF2, 0x95, 0x97, 0x70, 0xAF, 0xDA, 0x3A, 0xFD, 0xA5, 0x9D, 0x97, 0x9D,
+    0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D,
+    0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x95, 0xAF,
+    0xD9, 0x3F, 0xEA, 0x10, 0x29, 0x94, 0x91, 0x9F, 0x91, 0xAC, 0x1D, 0xAF, 0xDA, 0x09, 0xC2, 0x9F,
+    0x29, 0x77, 0x71, 0x9A, 0xA7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD4, 0x9F, 0xF0, 0x9F, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x97, 0x3A, 0xFD, 0xA1, 0xAF,
+    0xDA, 0x39, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x3A, 0xFD, 0x91, 0xFE, 0xA0, 0x9F, 0xF0, 0xAF, 0xF1, 0x99, 0x99, 0x99, 0x99,
+    0x75, 0x9A, 0xA6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x30, 0x9A, 0x5A, 0x99, 0xC9, 0x3A, 0xC9,
+    0x0F, 0xF2, 0xFC, 0xA5, 0x99, 0x76, 0xAF, 0xDA, 0x1A, 0xFD, 0xA3, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x93, 0xAF, 0xD9, 0x1F,
+    0xEA, 0x00, 0x99, 0x5A, 0x0A, 0xC4, 0xD1, 0xFE, 0xA1, 0x9F, 0xCA, 0x59, 0x97, 0x70, 0x9A, 0xA6,
+    0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD,
+    0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x30, 0xAF, 0xDA, 0xAF, 0xDA, 0x19, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x1A, 0xFD, 0x9F,
+    0xEA, 0x3A, 0xC9, 0x39, 0xCA, 0x4D, 0x5D, 0x5D, 0xA9, 0x92, 0xAE, 0xA4, 0x99, 0x00, 0x29, 0x92,
+    0xAD, 0x2A, 0xD3, 0xAA, 0x76, 0x9A, 0xA2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2,
+    0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xC9, 0x19,
+    0xCA, 0x2D, 0x3D, 0x3D, 0xA9, 0x90, 0xAE, 0xA2, 0x99, 0x00, 0x29, 0x94, 0x9D, 0x93, 0x9D, 0x94,
+    0xAA, 0x77, 0x2A, 0xFD, 0xAA, 0xFD, 0xA1, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D,
+    0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D,
+    0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x91, 0xAF, 0xD9, 0xFE, 0xA0, 0x9A, 0xA0, 0xAD,
+    0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A,
+    0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x00, 0xAF, 0xDA, 0x29, 0xD0, 0xAF, 0xDA, 0x29, 0xD2, 0x9D, 0x94,
+    0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x29,
+    0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x29, 0xD9, 0x49,
+    0xD2, 0x9D, 0x94, 0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D,
+    0x94, 0x9D, 0x29, 0xD9, 0x49, 0xD2, 0x9D, 0x94, 0x9D, 0x0A, 0xFD, 0x92, 0x9D, 0x0F, 0xEA, 0x29,
+    0xD7, 0x39, 0xD7, 0x3A, 0xD7, 0x29, 0xDA, 0x69, 0xFD, 0x79, 0xFC, 0x97, 0x09, 0xAA, 0x93, 0x09,
+    0x94, 0x99, 0x0A, 0xD4, 0xDA, 0xAD, 0x4E, 0x0A, 0xA4, 0x9A, 0x77, 0x69, 0xAA, 0x4A, 0xA9, 0xAD,
+    0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D,
+    0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAA,
+    0xD4, 0xDA, 0xAD, 0x4D, 0xA7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0x93, 0x91, 0xE4, 0xFC, 0xA4, 0xFA,
+    0x10, 0x59, 0x97, 0x0F, 0x6A, 0xFA, 0x4A, 0xD0, 0x9D, 0xA2, 0x9D, 0x3D, 0x91, 0x99, 0x59, 0x97,
+    0x70, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D,
+    0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D,
+    0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0xAD, 0x79, 0xE3,
+    0x9F, 0xD9, 0x39, 0xFC, 0x95, 0x9A, 0xA9, 0x60, 0x49, 0x97, 0xEA, 0x5F, 0xC9, 0x3E, 0x09, 0xD9,
+    0x1A, 0xCA, 0x29, 0xD9, 0x09, 0x95, 0x97, 0x79, 0xAA, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A,
+    0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD6, 0x9D, 0xA3, 0xAF, 0xC4, 0x9E, 0xA5, 0x0D, 0x97, 0xAD, 0x91,
+    0xD9, 0x6A, 0xDA, 0x2D, 0x95, 0x9D, 0xA3, 0xD9, 0x49, 0xDA, 0x4D, 0x94, 0xE5, 0xD9, 0x3E, 0x6D,
+    0x92, 0xE7, 0xD9, 0x1E, 0x70, 0xD9, 0x0E, 0x71, 0xD9, 0xAD, 0xA7, 0x1F, 0xE9, 0x70, 0xF9, 0xE7,
+    0x0E, 0x19, 0xE7, 0xD9, 0x2A, 0xDA, 0x6D, 0x93, 0xE9, 0x5D, 0x94, 0xE5, 0xD9, 0x49, 0xE4, 0xD9,
+    0x5A, 0xDA, 0x3D, 0x96, 0xE9, 0x2D, 0x97, 0xE2, 0xD9, 0x79, 0xDA, 0x77, 0x77, 0x71, 0xD9, 0x74,
+    0x9D, 0x75, 0xAC, 0x97, 0x5D, 0x76, 0x97, 0x10, 0x75, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD,
+    0x72, 0xAD, 0x72, 0xAD, 0x72, 0xAD, 0x59, 0xAA, 0x90, 0xAD, 0x5E, 0x1A, 0xD4, 0xE2, 0xAD, 0x3E,
+    0x3A, 0xD2, 0xE4, 0xAD, 0x1E, 0x5A, 0xD0, 0xE6, 0xAD, 0xAE, 0x6A, 0xFD, 0xA5, 0xAE, 0x0A, 0xD9,
+    0x4A, 0xD2, 0xE4, 0xAD, 0x3E, 0x3A, 0xD3, 0x9D, 0xA2, 0xAD, 0x4A, 0xD9, 0x1A, 0xD5, 0xE1, 0xAD,
+    0x6E, 0x77, 0x77, 0x1D, 0xA7, 0x2D, 0x72, 0xAC, 0xA7, 0x2D, 0x73, 0x97, 0x00, 0x9A, 0xA5, 0x9A,
+    0xA9, 0x0A, 0xD5, 0xE1, 0xAD, 0x4E, 0x2A, 0xD3, 0xE3, 0xAD, 0x2A, 0xD9, 0x3A, 0xD1, 0xAD, 0x94,
+    0xAD, 0x09, 0xDA, 0x5A, 0xD9, 0xE6, 0xAF, 0xE5, 0xAE, 0x99, 0xDA, 0x4A, 0xD9, 0x1A, 0xD9, 0x3A,
+    0xD3, 0xE3, 0xAD, 0x39, 0xDA, 0x2A, 0xD4, 0xAD, 0x91, 0xAD, 0x5E, 0x1A, 0xD6, 0xE0, 0x29, 0x99,
+    0x71, 0xE7, 0x0E, 0x70, 0x9D, 0x97, 0x0D, 0x72, 0x97, 0x77, 0x0D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0xA9,
+    0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0x29, 0x99, 0x29, 0xDA, 0x2E, 0x2A, 0xD2,
+    0x9D, 0x39, 0x97, 0x72, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3,
+    0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD,
+    0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0x0D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0xEA, 0x0F, 0xFE, 0xA7, 0x77, 0x7D, 0x97, 0x09, 0xD7, 0x1A, 0xCA, 0x71, 0xD7, 0x29, 0x60, 0x5A,
+    0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1,
+    0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD,
+    0x74, 0xD9, 0x09, 0xD1, 0xAC, 0xA1, 0xD2, 0x92, 0x0D, 0x95, 0xD9, 0x0D, 0x95, 0xD1, 0xD9, 0x49,
+    0xD1, 0xD9, 0x4A, 0xC9, 0x1D, 0x94, 0xCA, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0x7A, 0xD1, 0xDA, 0xAD,
+    0x1D, 0x9A, 0xD1, 0xD0, 0xAD, 0x09, 0xC9, 0x0A, 0xD0, 0x99, 0x1A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0x0D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x93, 0x99, 0x3D, 0x93, 0xDA, 0x2D, 0x92, 0x9D, 0xA2, 0xD9, 0x3A,
+    0xA3, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99,
+    0x99, 0x99, 0x1F, 0xFE, 0xA0, 0xFF, 0xEA, 0x7A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD,
+    0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x19, 0x1A, 0xD0, 0xAD, 0x0A, 0xD0, 0xE0, 0xAD, 0x09, 0xA9,
+    0x0A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0x2D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x90,
+    0x9D, 0x7D, 0xAF, 0x7F, 0xC9, 0x79, 0xEA, 0x70, 0xFA, 0x70, 0x9F, 0x97, 0x19, 0x0D, 0x97, 0x3D,
+    0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0xA9, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xEA, 0x2F, 0xFE, 0xA0,
+    0x73, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x09, 0x3A,
+    0xF9, 0x2A, 0xF3, 0xEA, 0x2A, 0xF3, 0xFC, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x20, 0x71, 0x99, 0x97, 0x6E, 0x75, 0xE7, 0x59, 0xD9, 0x75, 0xD7, 0x79, 0x77,
+    0x73, 0xE7, 0x2D, 0x90, 0xEA, 0x71, 0xD9, 0x0F, 0x97, 0x0D, 0x90, 0xFC, 0x70, 0xD9, 0x0D, 0x9D,
+    0xA7, 0xD9, 0x0D, 0x0A, 0xD9, 0x6D, 0x90, 0xD1, 0xE6, 0xD9, 0x0D, 0x19, 0xDA, 0x5D, 0x90, 0xD2,
+    0xE5, 0xD9, 0x0D, 0x92, 0xE4, 0xD9, 0x0D, 0x92, 0x9D, 0xA3, 0xD9, 0x0D, 0x93, 0xE3, 0xD9, 0x0D,
+    0x94, 0xE2, 0xD9, 0x0D, 0x94, 0xAD, 0x91, 0xD9, 0x0D, 0x95, 0xE1, 0xD9, 0x0D, 0x95, 0x9E, 0x0D,
+    0x90, 0xD9, 0x6A, 0xD9, 0xD9, 0x0D, 0x97, 0xFC, 0x90, 0xD9, 0x79, 0xF9, 0x0D, 0x97, 0x0A, 0xE9,
+    0x0D, 0x97, 0x1E, 0x90, 0x79, 0x99, 0x72, 0xE7, 0x1E, 0x71, 0x9D, 0x72, 0xD7, 0x39, 0x77, 0x49,
+    0xA9, 0x19, 0xFA, 0x2A, 0xD0, 0xFF, 0x90, 0xAF, 0xA9, 0x09, 0xAE, 0x0A, 0xE5, 0xAD, 0x9A, 0xDA,
+    0x6D, 0xAA, 0xD9, 0x6D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7,
+    0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xA0, 0x0E, 0x72,
+    0xD9, 0x0E, 0xA7, 0x1D, 0x90, 0xF9, 0x70, 0xD9, 0x0F, 0xC7, 0x0D, 0x90, 0xD9, 0xDA, 0x7D, 0x90,
+    0xD0, 0xAD, 0x96, 0xD9, 0x0D, 0x1E, 0x6D, 0x90, 0xD1, 0x9D, 0xA5, 0xD9, 0x0D, 0x2E, 0x5D, 0x90,
+    0xD9, 0x2E, 0x4D, 0x90, 0xD9, 0x29, 0xDA, 0x3D, 0x90, 0xD9, 0x3E, 0x3D, 0x90, 0xD9, 0x4E, 0x2D,
+    0x90, 0xD9, 0x4A, 0xD9, 0x1D, 0x90, 0xD9, 0x5E, 0x1D, 0x90, 0xD9, 0x59, 0xE0, 0xD9, 0x0D, 0x96,
+    0xAD, 0x9D, 0x90, 0xD9, 0x7F, 0xC9, 0x0D, 0x97, 0x9F, 0x90, 0xD9, 0x70, 0xAE, 0x90, 0xD9, 0x71,
+    0xE9, 0x77, 0x77, 0x73, 0xAD, 0x76, 0xD9, 0x76, 0xD7, 0x6A, 0xC9, 0x76, 0x99, 0x70, 0x9A, 0x91,
+    0x9F, 0xA2, 0xAD, 0x0F, 0xF9, 0x0A, 0xFA, 0x90, 0x9A, 0xE0, 0xAE, 0x5A, 0xD9, 0xAD, 0xA6, 0xDA,
+    0xAD, 0x96, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA,
+    0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0x77, 0x77, 0x1D, 0xA7,
+    0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xC7, 0x39, 0x96, 0x39, 0x95, 0x99, 0x79, 0xD3, 0xDA, 0x70, 0xAD,
+    0x1D, 0xA7, 0x2A, 0xFA, 0x74, 0xF7, 0x69, 0x97, 0x77, 0x2E, 0x72, 0xD9, 0x0E, 0xA7, 0x1D, 0x90,
+    0xF9, 0x70, 0xD9, 0x0F, 0xC7, 0x0D, 0x90, 0xD9, 0xDA, 0x7D, 0x90, 0xD0, 0xAD, 0x96, 0xD9, 0x0D,
+    0x1E, 0x6D, 0x90, 0xD1, 0x9D, 0xA5, 0xD9, 0x0D, 0x2E, 0x5D, 0x90, 0xD9, 0x2E, 0x4D, 0x90, 0xD9,
+    0x29, 0xDA, 0x3D, 0x90, 0xD9, 0x3E, 0x3D, 0x90, 0xD9, 0x4E, 0x2D, 0x90, 0xD9, 0x4A, 0xD9, 0x1D,
+    0x90, 0xD9, 0x5E, 0x1D, 0x90, 0xD9, 0x59, 0xE0, 0xD9, 0x0D, 0x96, 0xAD, 0x9D, 0x90, 0xD9, 0x7F,
+    0xC9, 0x0D, 0x97, 0x9F, 0x90, 0xD9, 0x70, 0xAE, 0x90, 0xD9, 0x71, 0xE9, 0x19, 0x95, 0x99, 0x39,
+    0xD3, 0xD9, 0x4A, 0xD1, 0xDA, 0x6A, 0xFA, 0x70, 0xF7, 0x29, 0x97, 0x73, 0x9A, 0x91, 0x9F, 0xA2,
+    0xAD, 0x0F, 0xF9, 0x0A, 0xFA, 0x90, 0x9A, 0xE0, 0xAE, 0x5A, 0xD9, 0xAD, 0xA6, 0xDA, 0xAD, 0x96,
+    0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0x09, 0xD9, 0x75, 0xAD, 0x76, 0xE7,
+    0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xCA, 0x09, 0xA9, 0x19, 0xAE, 0xA2, 0xD9, 0x09, 0xD0, 0xFF, 0x90,
+    0x99, 0x19, 0xFA, 0x90, 0x9A, 0xE4, 0x9E, 0x94, 0x9D, 0x93, 0x9D, 0xA6, 0xDA, 0x39, 0xD9, 0x6D,
+    0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3,
+    0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA3, 0x9D, 0x7D, 0xA0, 0x0E,
+    0x72, 0xD9, 0x0E, 0xA7, 0x1D, 0x90, 0xF9, 0x70, 0xD9, 0x0F, 0xC7, 0x0D, 0x90, 0xD9, 0xDA, 0x7D,
+    0x90, 0xD0, 0xAD, 0x96, 0xD9, 0x0D, 0x1E, 0x6D, 0x90, 0xD1, 0x9D, 0xA5, 0xD9, 0x0D, 0x2A, 0xD9,
+    0x4D, 0x90, 0xD9, 0x2E, 0x4D, 0x90, 0xD9, 0x29, 0xDA, 0x3D, 0x90, 0xD9, 0x3A, 0xD9, 0x2D, 0x90,
+    0xD9, 0x4E, 0x2D, 0x90, 0xD9, 0x5D, 0xA1, 0xD9, 0x0D, 0x95, 0xAD, 0x90, 0xD9, 0x0D, 0x96, 0xE0,
+    0xD9, 0x0D, 0x97, 0xDA, 0xD9, 0x0D, 0x97, 0x9F, 0x90, 0xD9, 0x70, 0xF9, 0x0D, 0x97, 0x1E, 0x90,
+    0xD9, 0x71, 0x9D, 0x97, 0x6D, 0x97, 0x59, 0xD7, 0x6E, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xC9, 0x73,
+    0x9A, 0xA9, 0x30, 0x9A, 0x91, 0x9F, 0xA2, 0xAD, 0x0F, 0xF9, 0x0A, 0xFA, 0x99, 0x9A, 0xE0, 0xAE,
+    0x59, 0xD9, 0xAD, 0xA6, 0xDA, 0xAD, 0x96, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA,
+    0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7,
+    0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0xAD, 0x96, 0xAF, 0xC7, 0x9E, 0xA1,
+    0x5A, 0xFE, 0xA7, 0x2F, 0xFA, 0x72, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0xAF, 0xE9, 0x70, 0x9F,
+    0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72,
+    0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74,
+    0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97,
+    0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A,
+    0xFE, 0xA7, 0x59, 0x97, 0x00, 0x29, 0xFF, 0x6A, 0xFF, 0x79, 0x99, 0x99, 0x99, 0x97, 0x77, 0x0A,
+    0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7,
+    0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA,
+    0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97,
+    0x29, 0x96, 0x5A, 0x94, 0x9A, 0x72, 0xD3, 0x9C, 0xA7, 0x2A, 0xFE, 0x74, 0xAF, 0xC9, 0x76, 0x99,
+    0x77, 0x77, 0x2A, 0xFE, 0x97, 0x09, 0xFF, 0xE9, 0x5A, 0xEA, 0x92, 0x9A, 0xE9, 0x39, 0xE7, 0x9E,
+    0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0xA7, 0x2E, 0x1A, 0xD7, 0x39, 0xD9, 0x0E, 0x74, 0xDA, 0x0D, 0xA7,
+    0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0E, 0x74, 0xDA,
+    0x0A, 0xD7, 0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71, 0x9E, 0x29, 0xE7, 0x0E, 0x4A, 0xEA,
+    0x4A, 0xE9, 0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99, 0x70, 0x29, 0xA5, 0xA6, 0xAC, 0x93,
+    0xAC, 0x7F, 0xEA, 0x79, 0xFC, 0xA7, 0x39, 0x97, 0x77, 0x3A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99,
+    0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9,
+    0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95,
+    0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x96, 0x79, 0x92, 0x99, 0x73,
+    0xAD, 0x1A, 0xD9, 0x71, 0x9D, 0x91, 0xD9, 0x72, 0xD9, 0x1A, 0xCA, 0x72, 0xAC, 0xA1, 0x9C, 0xA7,
+    0x39, 0x93, 0x97, 0x77, 0x71, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93,
+    0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D,
+    0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0,
+    0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70,
+    0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x49, 0x99,
+    0x19, 0x99, 0x69, 0xDA, 0x1D, 0xA6, 0xE1, 0xAD, 0x69, 0xD1, 0x9D, 0x7D, 0x2D, 0x70, 0x93, 0x97,
+    0x77, 0x3A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9,
+    0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A,
+    0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A,
+    0xFD, 0x97, 0x29, 0x96, 0x77, 0x76, 0xAF, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xFE, 0x92, 0xAE, 0xA9,
+    0x29, 0xE9, 0x99, 0x99, 0x99, 0x92, 0x9E, 0x6A, 0xD7, 0x2E, 0x7A, 0xD7, 0x19, 0xDA, 0x7A, 0xD7,
+    0x1A, 0xD7, 0x0A, 0xD7, 0x1E, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0xAF, 0xFD,
+    0x1D, 0xA7, 0x0A, 0xFF, 0xD1, 0xDA, 0x70, 0xAD, 0x99, 0x99, 0x99, 0x92, 0xDA, 0x70, 0xAD, 0x71,
+    0xE7, 0x0A, 0xD7, 0x1A, 0xD7, 0x0A, 0xD7, 0x19, 0xD9, 0x7A, 0xD7, 0x2E, 0x7A, 0xD7, 0x29, 0xE6,
+    0xAD, 0x73, 0xAE, 0xA4, 0xE9, 0x99, 0x99, 0x99, 0x94, 0xAF, 0xFF, 0xFE, 0x95, 0xAF, 0xFF, 0xFC,
+    0x97, 0x09, 0x97, 0x50, 0x4A, 0xEA, 0x94, 0xAE, 0xA9, 0x6A, 0xFF, 0x19, 0xFF, 0x4A, 0xDA, 0x90,
+    0x9A, 0xE0, 0xE9, 0x09, 0xAD, 0xA2, 0x9D, 0x94, 0x9F, 0xC4, 0x9D, 0x91, 0xE6, 0xAE, 0x6D, 0xA1,
+    0xDA, 0x69, 0xE6, 0xAD, 0x09, 0xD9, 0x7E, 0x99, 0x99, 0x99, 0x9E, 0x09, 0xD9, 0x7F, 0xFF, 0xC0,
+    0x9D, 0x97, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9D, 0x97, 0xDA, 0x73, 0xD9, 0x7E, 0x73, 0xDA,
+    0x69, 0xE7, 0x3A, 0xD6, 0xFA, 0x73, 0xE9, 0x3E, 0x9D, 0xA4, 0x9A, 0x93, 0xFF, 0xC9, 0x09, 0xFF,
+    0xC9, 0x4A, 0xFC, 0xA4, 0xAF, 0xDA, 0x70, 0x97, 0x29, 0x94, 0x79, 0x99, 0x74, 0xE7, 0x3E, 0x73,
+    0x9D, 0x74, 0xD7, 0x59, 0x77, 0x71, 0xFE, 0xAA, 0x95, 0xFF, 0xE4, 0xDA, 0x99, 0x9A, 0xAF, 0x3D,
+    0x95, 0xAD, 0xA2, 0xD9, 0x6E, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0x96,
+    0xDA, 0x2D, 0x94, 0x9E, 0x3F, 0xFE, 0x4F, 0xFC, 0x95, 0xDA, 0x99, 0x9A, 0xD9, 0x5D, 0x93, 0xE5,
+    0xD9, 0x4D, 0xA4, 0xD9, 0x4A, 0xD9, 0x3D, 0x95, 0xE3, 0xD9, 0x59, 0xDA, 0x2D, 0x96, 0xE2, 0xD9,
+    0x7E, 0x1D, 0x97, 0xAD, 0x90, 0x59, 0x99, 0x6E, 0x5E, 0x5A, 0xD6, 0xD7, 0x97, 0x69, 0xA9, 0x19,
+    0xAD, 0x9A, 0xCA, 0x0A, 0xF9, 0xAD, 0xAD, 0xA9, 0x90, 0xAE, 0xA4, 0xAE, 0x5A, 0xD9, 0x5A, 0xD6,
+    0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x60, 0x0F, 0xEA,
+    0xA9, 0x5F, 0xFE, 0x4D, 0xA9, 0x99, 0xAA, 0xF3, 0xD9, 0x5A, 0xDA, 0x2D, 0x96, 0xE2, 0xD9, 0x6A,
+    0xD2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6D, 0xA2, 0xD9, 0x49, 0xE3, 0xFF, 0xE4, 0xFF,
+    0xC9, 0x5D, 0xA9, 0x99, 0xAD, 0x95, 0xD9, 0x3E, 0x5D, 0x94, 0xDA, 0x4D, 0x94, 0xAD, 0x93, 0xD9,
+    0x5E, 0x3D, 0x95, 0x9D, 0xA2, 0xD9, 0x6E, 0x2D, 0x97, 0xE1, 0xD9, 0x7A, 0xD9, 0x77, 0x77, 0x6D,
+    0x97, 0x39, 0xD7, 0x4A, 0xC9, 0x74, 0xD7, 0x59, 0x70, 0x09, 0xA9, 0x19, 0xAD, 0x90, 0xAC, 0xA0,
+    0xAF, 0x90, 0xAD, 0xAD, 0xA9, 0x91, 0xAE, 0xA5, 0xAE, 0x6A, 0xD9, 0x6A, 0xD7, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x77, 0x76, 0xD9, 0x69, 0xD7, 0xAC,
+    0x97, 0xD7, 0x09, 0x70, 0x19, 0x95, 0x99, 0x59, 0xD3, 0xDA, 0x6A, 0xD1, 0xDA, 0x70, 0xAF, 0xA7,
+    0x2F, 0x74, 0x99, 0x77, 0x70, 0xFE, 0xAA, 0x95, 0xFF, 0xE4, 0xDA, 0x99, 0x9A, 0xAF, 0x3D, 0x95,
+    0xAD, 0xA2, 0xD9, 0x6E, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xAD, 0x2D, 0x96, 0xDA,
+    0x2D, 0x94, 0x9E, 0x3F, 0xFE, 0x4F, 0xFC, 0x95, 0xDA, 0x99, 0x9A, 0xD9, 0x5D, 0x93, 0xE5, 0xD9,
+    0x4D, 0xA4, 0xD9, 0x4A, 0xD9, 0x3D, 0x95, 0xE3, 0xD9, 0x59, 0xDA, 0x2D, 0x96, 0xE2, 0xD9, 0x7E,
+    0x1D, 0x97, 0xAD, 0x90, 0x99, 0x59, 0x99, 0xD3, 0xD9, 0x0A, 0xD1, 0xDA, 0x2A, 0xFA, 0x4F, 0x69,
+    0x97, 0x59, 0xA9, 0x19, 0xAD, 0x9A, 0xCA, 0x0A, 0xF9, 0xAD, 0xAD, 0xA9, 0x90, 0xAE, 0xA4, 0xAE,
+    0x5A, 0xD9, 0x5A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6,
+    0xAD, 0x60, 0x70, 0x99, 0x72, 0xE7, 0x1A, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x72, 0x97, 0x77, 0x9A,
+    0xFD, 0xA3, 0xAF, 0xFD, 0x19, 0xE9, 0x19, 0x9A, 0xCA, 0x1E, 0x72, 0xDA, 0x72, 0xD9, 0x72, 0xDA,
+    0x72, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x0A, 0xFC, 0x71, 0x9F, 0x72,
+    0xE9, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0xAD, 0x9A, 0xCA, 0x93, 0x9A, 0xE0, 0xAF, 0xFE,
+    0x2A, 0xFF, 0x97, 0x99, 0x60, 0x69, 0x99, 0x70, 0xE7, 0xE7, 0xAD, 0x70, 0xD7, 0x19, 0x77, 0x4A,
+    0xFA, 0xA2, 0x9F, 0xFC, 0x1E, 0x91, 0x9A, 0xD0, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0x0A, 0xEA,
+    0x7A, 0xFA, 0x96, 0xAF, 0xC7, 0x9F, 0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0D, 0xA9, 0xA9, 0x4A, 0xD9,
+    0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x59, 0x95, 0x59, 0x97, 0x2A, 0xE7, 0x09, 0xFC, 0x69, 0xD9, 0x0E,
+    0x5D, 0x92, 0xAC, 0xA4, 0x95, 0x99, 0x77, 0x29, 0xAF, 0xDA, 0x3A, 0xFF, 0xD1, 0x9E, 0x91, 0x99,
+    0xAC, 0xA1, 0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x2D, 0xA7, 0x2E, 0x97, 0x19, 0xEA, 0x71, 0x9F, 0xC9,
+    0x70, 0xAF, 0xC9, 0x70, 0xAF, 0xC7, 0x19, 0xF7, 0x2E, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7,
+    0x1A, 0xD9, 0xAC, 0xA9, 0x39, 0xAE, 0x0A, 0xFF, 0xE2, 0xAF, 0xF9, 0x79, 0x96, 0x49, 0x97, 0x0F,
+    0x6A, 0xFA, 0x4A, 0xD0, 0x9D, 0xA2, 0x9D, 0x3D, 0x91, 0x99, 0x59, 0x97, 0x7A, 0xFA, 0xA2, 0x9F,
+    0xFC, 0x1E, 0x91, 0x9A, 0xD0, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0x0A, 0xEA, 0x7A, 0xFA, 0x96,
+    0xAF, 0xC7, 0x9F, 0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0D, 0xA9, 0xA9, 0x4A, 0xD9, 0x9F, 0xFC, 0xA1,
+    0xAF, 0xE9, 0x59, 0x95, 0x77, 0x09, 0xAF, 0xDA, 0x3A, 0xFF, 0xD1, 0x9E, 0x91, 0x99, 0xAC, 0xA1,
+    0xE7, 0x2D, 0xA7, 0x2D, 0x97, 0x2D, 0xA7, 0x2E, 0x97, 0x19, 0xEA, 0x71, 0x9F, 0xC9, 0x70, 0xAF,
+    0xC9, 0x70, 0xAF, 0xC7, 0x19, 0xF7, 0x2E, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x1A, 0xD9,
+    0xAC, 0xA9, 0x39, 0xAE, 0x0A, 0xFF, 0xE2, 0xAF, 0xF9, 0x7A, 0xC9, 0x72, 0xD9, 0x72, 0xAD, 0xA7,
+    0x3D, 0x97, 0x2D, 0x96, 0x9A, 0xAE, 0x79, 0xEA, 0x50, 0x2A, 0xFA, 0xA2, 0x9F, 0xFC, 0x1E, 0x91,
+    0x9A, 0xD0, 0x9D, 0x70, 0x9D, 0x70, 0x9D, 0xA7, 0x0A, 0xEA, 0x7A, 0xFA, 0x96, 0xAF, 0xC7, 0x9F,
+    0x70, 0xAD, 0x97, 0x0D, 0xA7, 0x0D, 0xA9, 0xA9, 0x4A, 0xD9, 0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x59,
+    0xD7, 0x09, 0xCA, 0x70, 0x9E, 0x97, 0x09, 0xD7, 0x09, 0xD5, 0xAA, 0xAD, 0x95, 0xF9, 0x30, 0x29,
+    0x59, 0x94, 0xD9, 0x2A, 0xD4, 0x9D, 0x90, 0xE6, 0x9F, 0xC7, 0x0A, 0xE7, 0x29, 0x97, 0x76, 0x9A,
+    0xFD, 0xA3, 0xAF, 0xFD, 0x19, 0xE9, 0x19, 0x9A, 0xCA, 0x1E, 0x72, 0xDA, 0x72, 0xD9, 0x72, 0xDA,
+    0x72, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xFC, 0x97, 0x0A, 0xFC, 0x97, 0x0A, 0xFC, 0x71, 0x9F, 0x72,
+    0xE9, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0xAD, 0x9A, 0xCA, 0x93, 0x9A, 0xE0, 0xAF, 0xFE,
+    0x2A, 0xFF, 0x97, 0x99, 0x60, 0x09, 0x95, 0x99, 0x19, 0xD3, 0xD9, 0x2A, 0xD1, 0xDA, 0x4A, 0xFA,
+    0x6F, 0x70, 0x99, 0x77, 0x3A, 0xFA, 0xA2, 0x9F, 0xFC, 0x1E, 0x91, 0x9A, 0xD0, 0x9D, 0x70, 0x9D,
+    0x70, 0x9D, 0xA7, 0x0A, 0xEA, 0x7A, 0xFA, 0x96, 0xAF, 0xC7, 0x9F, 0x70, 0xAD, 0x97, 0x0D, 0xA7,
+    0x0D, 0xA9, 0xA9, 0x4A, 0xD9, 0x9F, 0xFC, 0xA1, 0xAF, 0xE9, 0x59, 0x95, 0xAF, 0xFF, 0xEA, 0xFF,
+    0xFE, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xAC, 0x75, 0xD7,
+    0x49, 0xE9, 0x74, 0x9D, 0x75, 0xD7, 0x19, 0xAA, 0xDA, 0x71, 0xAE, 0x95, 0x74, 0x9C, 0x96, 0xD9,
+    0x6D, 0x94, 0x9E, 0xAA, 0xAA, 0x9A, 0xFF, 0xC0, 0x9A, 0xDA, 0x99, 0x99, 0x19, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x6D, 0x96,
+    0xE6, 0xAF, 0xD3, 0xAF, 0xC4, 0xAC, 0x96, 0xD7, 0xAD, 0xA7, 0xD7, 0xD3, 0x9A, 0xAE, 0x3A, 0xEA,
+    0x10, 0x29, 0x95, 0x99, 0x59, 0xD3, 0xDA, 0x69, 0xD9, 0x0D, 0xA7, 0x0A, 0xFA, 0x72, 0xF7, 0x49,
+    0x97, 0x76, 0xAF, 0xFF, 0xEA, 0xFF, 0xFE, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x96, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x50, 0x77, 0x70, 0xDA, 0x72, 0xD7, 0x29, 0xCA, 0x39, 0xC9, 0x3A, 0xC4, 0xD9, 0x39,
+    0x94, 0xD9, 0x70, 0x9E, 0xAA, 0xAA, 0x93, 0xAF, 0xFC, 0x49, 0xAD, 0xA9, 0x99, 0x95, 0x9D, 0x97,
+    0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19,
+    0xD9, 0x71, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAF, 0xD7, 0xAF, 0xC7, 0x29, 0x50, 0xAF, 0xFF,
+    0xEA, 0xFF, 0xFE, 0x9A, 0xAA, 0xAA, 0xAD, 0xAA, 0xAA, 0xAA, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x79, 0xAA, 0xAA, 0xEA, 0xAA, 0x93, 0xAF, 0xFD, 0xA3, 0x9A,
+    0xAA, 0xAD, 0xAA, 0xAA, 0x97, 0x0D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D,
+    0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x95, 0x74, 0x9C, 0x96, 0xD9, 0x6D, 0x94, 0x9E, 0xAA, 0xAA,
+    0x9A, 0xFF, 0xC0, 0x9A, 0xDA, 0x99, 0x99, 0x19, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x39, 0xFF, 0xA0,
+    0xFF, 0x91, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x96, 0xD9, 0x6E, 0x6A, 0xFD, 0x3A, 0xFC,
+    0x69, 0x10, 0x59, 0x59, 0x6A, 0xF9, 0x1D, 0x6D, 0xAF, 0xDA, 0x5A, 0xC2, 0x9F, 0x79, 0x49, 0x77,
+    0x69, 0xD7, 0x2D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0xD9, 0x71, 0xD9, 0x0E, 0x70, 0xAD, 0x1A, 0xDA, 0x7E, 0x2E, 0xA9,
+    0x3A, 0xE4, 0xFF, 0xE9, 0x59, 0xFE, 0xA7, 0x39, 0x96, 0x39, 0x94, 0x94, 0xF9, 0x19, 0xC3, 0xDA,
+    0xFE, 0x3C, 0x91, 0x9F, 0x49, 0x59, 0x77, 0x19, 0xAA, 0x7A, 0xA9, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x69, 0xDA, 0xAD, 0x95, 0xEA, 0x0E, 0x93, 0xFA, 0x0A, 0xFF, 0xAD,
+    0xA1, 0x9F, 0xD9, 0x0A, 0xCA, 0x49, 0x96, 0x3A, 0xFE, 0xA7, 0xAF, 0xF7, 0x09, 0x99, 0x99, 0x99,
+    0x97, 0x74, 0x9D, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D,
+    0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2,
+    0xEA, 0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F, 0xEA, 0x73, 0x99, 0x60, 0x2F, 0xF4, 0x9F, 0xF9, 0x49,
+    0x99, 0x99, 0x99, 0x97, 0x70, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD,
+    0x90, 0xAC, 0xA4, 0x99, 0x60, 0x39, 0x94, 0x9A, 0x7A, 0xC4, 0xD7, 0x0F, 0xE9, 0x70, 0x9F, 0xC9,
+    0x74, 0x99, 0x77, 0x79, 0xD7, 0x2D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D,
+    0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D,
+    0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0xD9, 0x71, 0xD9, 0x0E, 0x70, 0xAD, 0x1A, 0xDA,
+    0x7E, 0x2E, 0xA9, 0x3A, 0xE4, 0xFF, 0xE9, 0x59, 0xFE, 0xA7, 0x39, 0x96, 0x19, 0xA5, 0xA9, 0x39,
+    0xC9, 0x3A, 0xC9, 0x4F, 0xF6, 0xFC, 0xA7, 0x19, 0x97, 0x73, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0,
+    0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC, 0xA4, 0x99, 0x60, 0x6A, 0xCA, 0x97, 0x3D, 0xAD, 0x97,
+    0x19, 0xC2, 0xD7, 0x1A, 0xC2, 0xD7, 0x19, 0xCA, 0x09, 0xCA, 0x72, 0xAF, 0x75, 0x97, 0x77, 0x09,
+    0xD7, 0x2D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D,
+    0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9,
+    0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA,
+    0x9D, 0x97, 0x1D, 0xA0, 0xD9, 0x71, 0xD9, 0x0E, 0x70, 0xAD, 0x1A, 0xDA, 0x7E, 0x2E, 0xA9, 0x3A,
+    0xE4, 0xFF, 0xE9, 0x59, 0xFE, 0xA7, 0x39, 0x96, 0x4A, 0xDA, 0x70, 0xAC, 0xAA, 0xCA, 0x7C, 0xA1,
+    0xAC, 0x7C, 0x91, 0x9C, 0x7D, 0x1D, 0x79, 0xF9, 0x71, 0x99, 0x77, 0x39, 0xAA, 0x7A, 0xA9, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D,
+    0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x69, 0xDA, 0xAD, 0x95, 0xEA, 0x0E, 0x93,
+    0xFA, 0x0A, 0xFF, 0xAD, 0xA1, 0x9F, 0xD9, 0x0A, 0xCA, 0x49, 0x96, 0x59, 0x99, 0x19, 0x99, 0x79,
+    0xD9, 0x09, 0xDA, 0x7D, 0xA1, 0xDA, 0x7A, 0xCA, 0x19, 0xD7, 0x0C, 0xA2, 0xD7, 0x19, 0x39, 0x77,
+    0x79, 0xD7, 0x2D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0xD9, 0x71, 0xD9, 0x0E, 0x70, 0xAD, 0x1A, 0xDA, 0x7E, 0x2E, 0xA9,
+    0x3A, 0xE4, 0xFF, 0xE9, 0x59, 0xFE, 0xA7, 0x39, 0x96, 0x39, 0x99, 0x29, 0x95, 0xDA, 0x1E, 0x4A,
+    0xD1, 0xAD, 0x49, 0xD2, 0xD9, 0x4D, 0x2D, 0x95, 0x93, 0x97, 0x73, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7,
+    0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA,
+    0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F,
+    0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC, 0xA4, 0x99, 0x60, 0x9D, 0x72, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9,
+    0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D,
+    0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA, 0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F,
+    0xF9, 0x72, 0x99, 0x9C, 0xA7, 0x5D, 0x75, 0x9C, 0xA7, 0x59, 0xCA, 0x75, 0x9D, 0x99, 0x74, 0xF9,
+    0x74, 0x99, 0x92, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D,
+    0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA,
+    0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC,
+    0xA4, 0x99, 0x29, 0xCA, 0x71, 0x9C, 0xA7, 0x2D, 0x73, 0xD7, 0x3D, 0xA9, 0x97, 0x09, 0xF7, 0x29,
+    0x90, 0x73, 0x99, 0x97, 0x76, 0x9E, 0x97, 0x75, 0xFC, 0x77, 0x4D, 0xA0, 0xAD, 0x77, 0x2D, 0xA2,
+    0x9D, 0x77, 0x19, 0x69, 0x77, 0x77, 0x39, 0xD7, 0x0E, 0x70, 0xDA, 0x9D, 0x96, 0x9E, 0x79, 0xD9,
+    0x0D, 0xA6, 0xAE, 0xA6, 0xAD, 0x1E, 0x6F, 0xC6, 0xE1, 0xAD, 0x6D, 0x9D, 0x6D, 0xA2, 0xD9, 0x49,
+    0xD0, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAC, 0xA0, 0xAC, 0xA4, 0xAD, 0x3A, 0xD4, 0xD9, 0x09, 0xD4,
+    0xE3, 0x9D, 0x39, 0xD2, 0xD9, 0x3D, 0xA4, 0xD9, 0x2A, 0xD2, 0xDA, 0x29, 0xD9, 0x4D, 0xA2, 0xDA,
+    0x2A, 0xD2, 0xAD, 0x5A, 0xD2, 0xD9, 0x29, 0xD2, 0xDA, 0x59, 0xD1, 0x9D, 0x4D, 0xA1, 0xD9, 0x6D,
+    0x90, 0xDA, 0x4A, 0xD0, 0x9D, 0x7D, 0xA0, 0xD9, 0x49, 0xD0, 0xAD, 0x7A, 0xD9, 0xD6, 0xD9, 0xDA,
+    0x79, 0xDA, 0xD6, 0xDA, 0xD9, 0x70, 0xFA, 0x69, 0xF7, 0x1F, 0x70, 0xF7, 0x1A, 0xE7, 0x0E, 0xA7,
+    0x19, 0xDA, 0x70, 0xAD, 0x94, 0x71, 0x99, 0x97, 0x72, 0x9E, 0x97, 0x70, 0x9F, 0xC7, 0x70, 0xDA,
+    0x0A, 0xD7, 0x6D, 0x92, 0xAD, 0x75, 0x96, 0x97, 0x77, 0x59, 0xAA, 0x6A, 0xAA, 0x6A, 0xA9, 0x9D,
+    0x94, 0x9E, 0x59, 0xD9, 0x0D, 0xA4, 0xAE, 0xA4, 0xAD, 0x1E, 0x4D, 0xAD, 0x4D, 0xA1, 0xAD, 0x4D,
+    0x0D, 0x4D, 0x91, 0x9D, 0x92, 0xAD, 0x0D, 0x92, 0x9D, 0x3D, 0xA2, 0xDA, 0x0A, 0xD2, 0xAD, 0x3A,
+    0xD2, 0xD1, 0x9D, 0x2D, 0xA3, 0x9D, 0x19, 0xD2, 0xD9, 0x1D, 0x94, 0xD9, 0x0D, 0xA2, 0xAC, 0xA0,
+    0x9D, 0x5D, 0xA0, 0xD9, 0x29, 0xD0, 0xAD, 0x5A, 0xD9, 0xD4, 0xD0, 0xDA, 0x59, 0xDA, 0xCA, 0x4D,
+    0xAD, 0x7F, 0x94, 0xAF, 0x7F, 0x6E, 0xA7, 0xAD, 0xA6, 0xE9, 0x30, 0x69, 0x97, 0x5A, 0xE7, 0x39,
+    0xFC, 0x71, 0x9D, 0x90, 0xDA, 0x70, 0xD9, 0x2A, 0xCA, 0x79, 0x59, 0x97, 0x74, 0xAD, 0x71, 0x9D,
+    0x09, 0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA, 0x4D, 0xA5,
+    0xAD, 0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC, 0x73, 0xF9,
+    0x73, 0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA,
+    0x75, 0xDA, 0x60, 0x59, 0x99, 0x72, 0x9E, 0x97, 0x09, 0xFC, 0x70, 0xDA, 0x0A, 0xD6, 0xD9, 0x2A,
+    0xD5, 0x96, 0x97, 0x71, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79, 0xD9, 0x0D, 0xA6, 0xAD, 0x1A, 0xD6,
+    0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A, 0xD4, 0xDA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2,
+    0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D, 0xA7, 0x0D, 0x9D, 0x97, 0x0A, 0xF7, 0x19,
+    0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xAE,
+    0xA7, 0x10, 0x49, 0x76, 0xAD, 0x2D, 0x70, 0xE1, 0x9D, 0x97, 0x0A, 0x39, 0x97, 0x77, 0x76, 0xAD,
+    0x71, 0x9D, 0x09, 0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA,
+    0x4D, 0xA5, 0xAD, 0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC,
+    0x73, 0xF9, 0x73, 0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA,
+    0x75, 0xDA, 0x75, 0xDA, 0x60, 0x70, 0x99, 0x97, 0x2E, 0x97, 0x19, 0xDA, 0x72, 0xDA, 0x72, 0xAC,
+    0xA7, 0x39, 0x97, 0x75, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x72, 0xAD, 0x97, 0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72,
+    0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A,
+    0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA0, 0x69, 0x99, 0x79, 0xE7,
+    0xE7, 0xAD, 0x79, 0xD7, 0x19, 0x77, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFD, 0x90, 0x99,
+    0x99, 0x99, 0x9E, 0x79, 0xDA, 0x7E, 0x7A, 0xD7, 0x9D, 0x97, 0xDA, 0x7E, 0x79, 0xD9, 0x7D, 0xA7,
+    0xE7, 0xAD, 0x79, 0xD9, 0x7F, 0xFE, 0xAF, 0xFE, 0xA0, 0x69, 0x74, 0xE7, 0x3E, 0x73, 0x9A, 0x97,
+    0x77, 0x73, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x72, 0xAD,
+    0x97, 0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72,
+    0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xDA, 0xFF, 0xFD, 0xA0, 0x49, 0x97, 0x0A, 0xD9, 0x7A, 0xD9,
+    0x70, 0xAA, 0x77, 0x75, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99,
+    0xE7, 0x9D, 0xA7, 0xE7, 0xAD, 0x79, 0xD9, 0x7D, 0xA7, 0xE7, 0x9D, 0x97, 0xDA, 0x7E, 0x7A, 0xD7,
+    0x9D, 0x97, 0xFF, 0xEA, 0xFF, 0xEA, 0x29, 0x69, 0x5D, 0x92, 0xAD, 0x6D, 0xA0, 0xAD, 0x79, 0xFC,
+    0x71, 0x9E, 0x97, 0x29, 0x99, 0x77, 0x49, 0xFF, 0xFC, 0x0A, 0xFF, 0xFC, 0x99, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2D, 0xA7, 0x2E, 0x72,
+    0xAD, 0x97, 0x2D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2D, 0xA7, 0x2E, 0x72, 0xAD, 0x97, 0x2D, 0xA7,
+    0x2E, 0x72, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0x09, 0x95,
+    0x99, 0x1A, 0xCA, 0x3D, 0x92, 0xAD, 0x09, 0xD9, 0x4F, 0xC9, 0x6E, 0xA7, 0x09, 0x97, 0x71, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0xE7, 0x9D, 0xA7, 0xE7, 0xAD,
+    0x79, 0xD9, 0x7D, 0xA7, 0xE7, 0x9D, 0x97, 0xDA, 0x7E, 0x7A, 0xD7, 0x9D, 0x97, 0xFF, 0xEA, 0xFF,
+    0xEA, 0x49, 0x93, 0xAF, 0xC9, 0x0A, 0xFD, 0x1E, 0x49, 0xD9, 0x49, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x50, 0x77, 0x77, 0x71, 0xAD, 0x95, 0xAF, 0xDA, 0x93, 0xAD, 0x49,
+    0xFF, 0xE2, 0xDA, 0x3A, 0xEA, 0x92, 0x9A, 0xE9, 0xAD, 0x39, 0xE7, 0x9F, 0xC9, 0x3E, 0x71, 0x9E,
+    0x49, 0xDA, 0x72, 0xE4, 0xAD, 0x73, 0x9D, 0x93, 0xE7, 0x4D, 0xA3, 0xDA, 0x74, 0xE3, 0xDA, 0x74,
+    0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xE7, 0x4D, 0xA3, 0xAD, 0x73, 0x9D,
+    0x93, 0x9D, 0x97, 0x2A, 0xD5, 0xE7, 0x19, 0xDA, 0x59, 0xE7, 0x0E, 0x7A, 0xEA, 0x4A, 0xE9, 0x70,
+    0xAF, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99, 0x73, 0x77, 0x77, 0x0E, 0x76, 0xDA, 0x4A, 0xF9,
+    0x29, 0xD3, 0xAF, 0xF9, 0x0D, 0xA2, 0xAD, 0xA9, 0x99, 0x9F, 0xD2, 0x9D, 0xA5, 0xEA, 0x3E, 0x69,
+    0xD9, 0x3D, 0xA7, 0xE2, 0x9D, 0x97, 0xAD, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x29, 0xD9,
+    0x7A, 0xD3, 0xD9, 0x7E, 0x3E, 0x7D, 0xA3, 0x9D, 0x95, 0xAD, 0x5E, 0x93, 0xAD, 0xA6, 0xFF, 0xCA,
+    0x70, 0xAF, 0xD9, 0x74, 0x99, 0x70, 0x77, 0x77, 0x1A, 0xFD, 0xA3, 0x9A, 0xFC, 0x95, 0xAF, 0xFD,
+    0x90, 0xAF, 0xF9, 0x3A, 0xEA, 0x91, 0x9A, 0xFD, 0x92, 0xAE, 0x29, 0xE7, 0xF5, 0xAD, 0x91, 0xE7,
+    0x1E, 0x6D, 0xA0, 0x9D, 0x97, 0x1A, 0xD6, 0xDA, 0x0A, 0xD7, 0x3D, 0xA5, 0xDA, 0x0E, 0x73, 0xE5,
+    0xDA, 0x0D, 0xA7, 0x3E, 0x5D, 0xA0, 0xDA, 0x73, 0xAD, 0x5D, 0xA0, 0xDA, 0x73, 0xAD, 0x5D, 0xA0,
+    0xDA, 0x73, 0xAD, 0x5D, 0xA0, 0xDA, 0x73, 0xE5, 0xDA, 0x0E, 0x73, 0xE5, 0xDA, 0x0E, 0x73, 0xDA,
+    0x5D, 0xA0, 0x9D, 0x97, 0x1A, 0xD9, 0x5D, 0xA1, 0xE7, 0x1E, 0x6D, 0xA1, 0xAD, 0xA7, 0xE9, 0x6D,
+    0xA2, 0xF9, 0x39, 0xEA, 0x7D, 0xA3, 0xAF, 0xFD, 0xA7, 0x0D, 0xA4, 0x9A, 0xFD, 0xA7, 0x2D, 0xA7,
+    0x09, 0x97, 0x70, 0x39, 0xAE, 0xA9, 0x29, 0xEA, 0x5A, 0xFE, 0xA0, 0xFE, 0x3E, 0xA9, 0x99, 0xAF,
+    0xA9, 0x9A, 0xDA, 0x19, 0xDA, 0x4A, 0xD9, 0x3A, 0xD1, 0xE6, 0xDA, 0x39, 0xD1, 0xDA, 0x6A, 0xD3,
+    0x9D, 0x99, 0xD9, 0x69, 0xD3, 0x9D, 0x99, 0xD9, 0x69, 0xD9, 0x29, 0xD9, 0x9D, 0x96, 0x9D, 0x92,
+    0x9D, 0x99, 0xD9, 0x69, 0xD9, 0x29, 0xD9, 0x0D, 0x96, 0xAD, 0x39, 0xD9, 0x0E, 0x6E, 0x39, 0xD9,
+    0x0A, 0xD9, 0x49, 0xDA, 0x39, 0xD9, 0x1E, 0x92, 0x9E, 0x49, 0xD9, 0x2F, 0xFC, 0x59, 0xD9, 0x3A,
+    0xFC, 0xA6, 0x9D, 0x96, 0x97, 0x19, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x19, 0xD9,
+    0x77, 0x19, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x19, 0xD9, 0x1A, 0xFF, 0xCA, 0xA9, 0x4F, 0xFF, 0xE9,
+    0x1A, 0xDA, 0x9E, 0x99, 0x99, 0xAF, 0x90, 0xAC, 0xA1, 0xE5, 0x9E, 0x0A, 0xCA, 0x1E, 0x6A, 0xD9,
+    0x09, 0x91, 0xE6, 0x9D, 0x94, 0xE7, 0xD9, 0x4E, 0x69, 0xD9, 0x4E, 0x6A, 0xD5, 0xE5, 0x9D, 0xA5,
+    0xE9, 0x99, 0x9A, 0xF6, 0xFF, 0xDA, 0x7F, 0xEA, 0xA7, 0x1E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x20, 0x29, 0x97, 0x29, 0xF7, 0x1F, 0xC7, 0x09, 0xD9, 0x72, 0xAD,
+    0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x19, 0xEA, 0x93, 0xAD, 0x0F, 0xF2, 0xAF, 0xA9, 0x09, 0xAE,
+    0x1A, 0xE5, 0xAD, 0x90, 0xAD, 0xA6, 0xE0, 0xAD, 0x96, 0xAD, 0x0A, 0xD7, 0x9D, 0x9A, 0xD7, 0x9D,
+    0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0x9D, 0x9A, 0xD7, 0xAD, 0x0A, 0xD9, 0x6E, 0x0A, 0xE5, 0x9D, 0xA0,
+    0xAF, 0x39, 0xE1, 0xAD, 0xAF, 0xF9, 0x1A, 0xD0, 0x9F, 0xD3, 0xAD, 0x39, 0x95, 0xAD, 0x73, 0xAD,
+    0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0x0D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4F,
+    0xFA, 0x95, 0xFF, 0xE9, 0x3D, 0xA9, 0x99, 0x9A, 0xF3, 0xD9, 0x5A, 0xDA, 0x2D, 0x96, 0xE2, 0xD9,
+    0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6A, 0xD2, 0xD9, 0x6D, 0xA2, 0xD9, 0x49, 0xE3, 0xFF, 0xE4,
+    0xFF, 0xC9, 0x5D, 0xA9, 0x99, 0x9D, 0xA5, 0xD9, 0x3A, 0xD5, 0xD9, 0x4E, 0x4D, 0x94, 0xAD, 0x93,
+    0xD9, 0x5E, 0x3D, 0x95, 0x9D, 0xA7, 0x4E, 0x75, 0xE7, 0x4A, 0xD9, 0x77, 0x9A, 0xFD, 0x94, 0xFF,
+    0xD3, 0xDA, 0x91, 0x9F, 0x72, 0xAD, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE7, 0x0A,
+    0xEA, 0x6A, 0xFA, 0x49, 0xFD, 0x94, 0xAF, 0xA9, 0x5A, 0xE9, 0x79, 0xE7, 0x1A, 0xD7, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x29, 0xDA, 0x72, 0xAD, 0xA9, 0x39, 0xAC, 0xA1, 0xFF, 0xEA, 0x29, 0xFF, 0xA7, 0x99,
+    0x40, 0x19, 0xAF, 0xA3, 0xAF, 0xF9, 0x19, 0xCA, 0x91, 0x9E, 0x71, 0xD9, 0x70, 0xD9, 0x7A, 0xD9,
+    0x5A, 0xEA, 0x39, 0xFC, 0xA3, 0xFC, 0xA4, 0xF9, 0x5A, 0xDA, 0x7A, 0xD7, 0x0A, 0xD7, 0x09, 0xDA,
+    0x49, 0xA9, 0x0A, 0xFF, 0xC9, 0x19, 0xFE, 0xA5, 0x99, 0x93, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0,
+    0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1A, 0xDA, 0x73, 0xE9, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x3A, 0xDA, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xDA,
+    0x72, 0xE7, 0x2E, 0x72, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA,
+    0x39, 0x70, 0x9F, 0xC6, 0xFD, 0xA5, 0xD1, 0xAD, 0x5D, 0x90, 0x9D, 0x5F, 0xE6, 0xFD, 0x71, 0x9D,
+    0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D,
+    0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0x9D,
+    0x71, 0x9D, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xE9, 0x19, 0x59, 0xFD, 0x69, 0xFA, 0x74, 0x9C, 0x96,
+    0xD9, 0x6D, 0x94, 0x9E, 0xAA, 0xAA, 0x9A, 0xFF, 0xC0, 0x9A, 0xDA, 0x99, 0x99, 0x19, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x6D,
+    0x96, 0xE6, 0xAF, 0xD3, 0xAF, 0xC5, 0x9A, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x49, 0x9D, 0xA3, 0x9F,
+    0x94, 0xE9, 0x00, 0x1A, 0xFF, 0xFC, 0x90, 0xFF, 0xFE, 0x9A, 0xDA, 0x99, 0x9E, 0x99, 0x99, 0x99,
+    0x0A, 0xCA, 0x3A, 0xD6, 0xAC, 0xA3, 0xAD, 0x79, 0x93, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD,
+    0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD,
+    0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x60, 0x59, 0x95, 0xAF, 0x3A, 0xFC, 0x92, 0xDA,
+    0x6D, 0x95, 0x9D, 0x95, 0x9D, 0x94, 0x9E, 0xAA, 0xAA, 0x9A, 0xFF, 0xC0, 0x9A, 0xDA, 0x99, 0x99,
+    0x19, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9, 0x59, 0xD9,
+    0x59, 0xD9, 0x6D, 0x96, 0xE6, 0xAF, 0xD3, 0xAF, 0xC6, 0x91, 0xAF, 0xFF, 0xEA, 0xFF, 0xFE, 0x99,
+    0x99, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9,
+    0x74, 0xDA, 0x74, 0xE9, 0x99, 0x71, 0x9F, 0xA7, 0x29, 0xE9, 0x20, 0x77, 0x77, 0x70, 0xE9, 0xD7,
+    0x2D, 0xA1, 0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0x9D, 0x09, 0xD9, 0x71, 0xDA, 0x9D, 0xA0, 0x9D, 0x97,
+    0x1F, 0xCA, 0x19, 0xD9, 0x71, 0xEA, 0x92, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA5, 0xD9,
+    0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x69, 0xDA, 0x7E, 0x7E, 0xA9, 0x39, 0xE9, 0x70, 0xFF, 0xE9, 0x72,
+    0x9F, 0xEA, 0x77, 0x09, 0x97, 0x30, 0x77, 0x77, 0x19, 0xDA, 0x76, 0x9D, 0x99, 0xAA, 0x7A, 0xA9,
+    0x0A, 0xD0, 0xAD, 0x7D, 0xA9, 0xDA, 0x0A, 0xD7, 0xFC, 0xA1, 0xAD, 0x7E, 0xA9, 0x2A, 0xD7, 0xDA,
+    0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A,
+    0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0xA4, 0xAD, 0x95, 0xEA, 0x5E, 0x93, 0xFA, 0x5A, 0xFF, 0xAD, 0xA6,
+    0x9F, 0xD9, 0x0A, 0xCA, 0x71, 0x99, 0x73, 0x09, 0x99, 0x3E, 0x4D, 0xA3, 0x9D, 0x94, 0xD5, 0x90,
+    0x29, 0x99, 0x3E, 0x2E, 0x29, 0xD3, 0xD4, 0x94, 0x39, 0x96, 0xF4, 0xAF, 0xA2, 0x9D, 0x1D, 0xA0,
+    0x9D, 0x3D, 0xA9, 0x95, 0x99, 0x29, 0x94, 0x92, 0xF9, 0x19, 0xC1, 0xDA, 0xFE, 0x1C, 0x91, 0x9F,
+    0x29, 0x59, 0x20, 0x0F, 0xF9, 0x9F, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x90, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA1, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x9A, 0x5A, 0x99, 0xC9,
+    0x3A, 0xC9, 0x0F, 0xF2, 0xFC, 0xA5, 0x99, 0x30, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x0A, 0xA0, 0x19,
+    0x39, 0x2D, 0x91, 0x9D, 0x1D, 0xA1, 0xAD, 0x19, 0xA3, 0xA9, 0x00, 0xEA, 0x1A, 0xAE, 0x3A, 0xC9,
+    0x2D, 0x90, 0xAD, 0xA1, 0xD3, 0xAA, 0x20, 0x1A, 0xDA, 0x2A, 0xCA, 0xAD, 0x1C, 0xA1, 0xAC, 0x1C,
+    0x91, 0x9C, 0x1D, 0x1D, 0x19, 0xF9, 0x39, 0x92, 0x29, 0x92, 0x99, 0x91, 0xAD, 0x90, 0x9D, 0x91,
+    0xDA, 0x1D, 0xA1, 0xAC, 0xA1, 0xAC, 0xA1, 0x9C, 0xA2, 0xD3, 0x93, 0x93, 0x99, 0x59, 0x99, 0xD3,
+    0xD9, 0x0A, 0xD1, 0xDA, 0x2A, 0xFA, 0x4F, 0x69, 0x93, 0x4D, 0x1D, 0x1D, 0x1D, 0x1A, 0xA0, 0x7A,
+    0xD1, 0xDA, 0xAD, 0x1D, 0xAA, 0xD1, 0xDA, 0xAD, 0x1D, 0xA9, 0xAA, 0x1A, 0xA9, 0x09, 0x99, 0x19,
+    0x99, 0x3A, 0xD1, 0xAD, 0x93, 0xDA, 0x1E, 0x4D, 0x91, 0xD9, 0x4D, 0x2D, 0x59, 0x39, 0x00, 0x3A,
+    0xA6, 0x9D, 0x95, 0x9D, 0x92, 0x9A, 0x1A, 0xA1, 0xA9, 0x9C, 0x93, 0xAC, 0x90, 0xFF, 0x2F, 0xCA,
+    0x59, 0x93, 0x29, 0xAA, 0x93, 0x9F, 0xD9, 0x1D, 0xAA, 0xAA, 0xD0, 0x9C, 0x93, 0x9C, 0x90, 0x95,
+    0x90, 0x2D, 0x29, 0xD2, 0xDA, 0x2D, 0x91, 0xAD, 0x2E, 0x2E, 0x29, 0x92, 0x1A, 0xD2, 0xE2, 0xDA,
+    0x19, 0xD2, 0xAD, 0x2D, 0x92, 0xD3, 0x93, 0x0D, 0xA2, 0xE2, 0xAD, 0x29, 0xD9, 0x2D, 0x92, 0xAC,
+    0xA3, 0xD3, 0x99, 0x00, 0x1A, 0xD2, 0xE2, 0xDA, 0x19, 0xD9, 0x1A, 0xD2, 0xAC, 0xA2, 0xD3, 0x99,
+    0x20, 0x99, 0x92, 0xAD, 0xA2, 0xAD, 0x3A, 0xD3, 0xAC, 0xA3, 0x99, 0x29, 0x99, 0x1A, 0xDA, 0x1D,
+    0xA1, 0xDA, 0x1A, 0xCA, 0x29, 0x93, 0x70, 0x9C, 0xA0, 0x99, 0xAC, 0xAA, 0xFA, 0x99, 0x9A, 0xCA,
+    0x29, 0xCA, 0x39, 0x00, 0x5A, 0xC9, 0x2A, 0xCA, 0x99, 0x0A, 0xFA, 0xAC, 0xA9, 0x99, 0xAC, 0x93,
+    0x93, 0x7A, 0xFE, 0x9A, 0xAA, 0xAA, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD0, 0x71, 0xE3, 0xE2, 0x9D,
+    0x91, 0xAE, 0x1E, 0xA2, 0xAA, 0x40, 0x19, 0x90, 0xDA, 0x9C, 0x90, 0xAC, 0x19, 0xC9, 0x1D, 0xA1,
+    0x99, 0x2A, 0xA5, 0xD5, 0xD3, 0xAA, 0xDA, 0xA1, 0xFD, 0x70, 0x0A, 0xAA, 0xAA, 0xA1, 0xFD, 0x3D,
+    0x5D, 0x5D, 0x72, 0x72, 0xD5, 0xD3, 0xFD, 0x1A, 0xAD, 0xAA, 0x3D, 0x5A, 0xA2, 0x0A, 0xAA, 0xAA,
+    0xA0, 0x9F, 0xD9, 0x70, 0x70, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x09, 0x9E, 0x0F, 0x90,
+    0xE9, 0x00, 0x5D, 0x92, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x92, 0xE9, 0x90, 0x9F, 0x19, 0xE0, 0x4D,
+    0x90, 0xE0, 0xD9, 0x30, 0x19, 0x39, 0x2D, 0x91, 0x9D, 0x1D, 0xA1, 0xAD, 0x19, 0xA3, 0xA9, 0x00,
+    0x1A, 0xDA, 0x2A, 0xCA, 0xAD, 0x1C, 0xA1, 0xAC, 0x1C, 0x91, 0x9C, 0x1D, 0x1D, 0x19, 0xF9, 0x39,
+    0x92, 0x4D, 0xA0, 0xD9, 0x9D, 0x0A, 0xC1, 0x99, 0x10, 0x1D, 0x29, 0xCA, 0x29, 0xE9, 0x29, 0xD2,
+    0x9D, 0xAA, 0xAD, 0xAF, 0x90, 0x29, 0x3D, 0x2A, 0xC9, 0x2D, 0x29, 0xCA, 0x29, 0xD9, 0x91, 0xF9,
+    0x19, 0x99, 0x00, 0x4D, 0x1D, 0x1D, 0x1D, 0x1A, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF,
+    0xD1, 0xD5, 0xD1, 0xCA, 0x5A, 0xC1, 0xCA, 0x5A, 0xC1, 0x99, 0x59, 0x90, 0x73, 0x9C, 0x2D, 0x2C,
+    0x90, 0xCA, 0x9A, 0xDA, 0x9D, 0x19, 0xEA, 0xAE, 0x97, 0x40, 0x99, 0x59, 0x99, 0xD3, 0xDA, 0x0A,
+    0xD1, 0xDA, 0x2A, 0xFA, 0x4F, 0x69, 0x93, 0x39, 0x96, 0xF4, 0xAF, 0xA2, 0xAD, 0x09, 0xDA, 0x09,
+    0xD3, 0xD9, 0x99, 0x59, 0x90, 0x9A, 0x5A, 0x99, 0xC9, 0x3A, 0xC9, 0x0F, 0xF2, 0xFC, 0xA5, 0x99,
+    0x30, 0x29, 0xAA, 0x93, 0x9F, 0xD9, 0x1D, 0xAA, 0xAA, 0xD0, 0x9C, 0x93, 0x9C, 0x90, 0x95, 0x90,
+    0x29, 0x94, 0x91, 0x9F, 0x91, 0xAC, 0x1D, 0xAF, 0xE1, 0xC9, 0x19, 0xF2, 0x95, 0x92, 0x0F, 0xF9,
+    0x9F, 0xF9, 0x09, 0x99, 0x99, 0x99, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF,
+    0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x76, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x29, 0x94, 0x92, 0xFA, 0x19, 0xC9, 0x0A, 0xCA, 0xAF, 0xD1, 0xCA, 0x2A, 0xE9, 0x19, 0x59,
+    0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xFF, 0xA9,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x77, 0xAD, 0x49, 0xEA, 0x3A,
+    0xE9, 0x2A, 0xE9, 0x4D, 0xA7, 0x96, 0x77, 0x4A, 0xCA, 0x70, 0xD7, 0x09, 0xD7, 0x0D, 0x97, 0x0D,
+    0x70, 0xAC, 0xA7, 0x0D, 0x70, 0x9D, 0x70, 0xD9, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD7, 0x09, 0xD7,
+    0x0D, 0x97, 0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x70, 0xAC, 0xA7,
+    0x0D, 0x97, 0x9D, 0x70, 0x9A, 0x97, 0x00, 0x99, 0x1A, 0xD1, 0x9C, 0x91, 0xCA, 0x09, 0xC9, 0xAD,
+    0x09, 0x91, 0x0A, 0x95, 0x9A, 0x1C, 0xA5, 0xAC, 0x1C, 0xA5, 0xAC, 0x1D, 0x99, 0x99, 0x99, 0xD1,
+    0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x73, 0xAF, 0xFD, 0xAA, 0xC9, 0x99, 0x99, 0x99,
+    0x9C, 0xAA, 0xC7, 0xCA, 0xAC, 0x7C, 0xAA, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x74,
+    0x9E, 0xAA, 0xE9, 0x1C, 0xA9, 0x9D, 0xA9, 0xAC, 0x09, 0xC2, 0xD2, 0xC9, 0x73, 0x09, 0x19, 0x0A,
+    0xC9, 0x9C, 0xA0, 0xF1, 0xAD, 0x90, 0x9F, 0x9A, 0xC1, 0xCA, 0x50, 0x4A, 0xDA, 0xCA, 0x0D, 0x90,
+    0x9D, 0x1A, 0xC9, 0x1D, 0x9A, 0xCA, 0xDA, 0x40, 0x76, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x09, 0x93, 0x9E, 0x39, 0xD9, 0x39, 0xD4, 0x9D, 0x59, 0x00, 0x39, 0x93, 0xE9, 0x19, 0xD9,
+    0x2D, 0xA2, 0xD9, 0x39, 0x40, 0x29, 0x94, 0x91, 0x9F, 0x91, 0xAC, 0x1D, 0xAF, 0xE1, 0xC9, 0x19,
+    0xF2, 0x95, 0x92, 0x0A, 0xAA, 0x1E, 0xA1, 0x9D, 0x19, 0xCA, 0x1D, 0x50, 0x4A, 0xAA, 0x69, 0xDA,
+    0x09, 0x09, 0xD0, 0xAD, 0x0D, 0xA9, 0xD9, 0xDA, 0x0D, 0xA0, 0x99, 0x0D, 0x2A, 0x49, 0x50, 0x0A,
+    0xA3, 0xD9, 0x2D, 0x92, 0xF1, 0x9E, 0x00, 0x75, 0x9F, 0xFF, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x99, 0xCA, 0x7A, 0xC9, 0x9C, 0xA7, 0xAC, 0x99, 0xA9, 0x79, 0xA9, 0x76, 0xFF, 0xF1, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0x19, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0x7A, 0xD1, 0xDA, 0xAD, 0x1D, 0xAA, 0xD1, 0xDA, 0xAD, 0x1D, 0xA9, 0xAA,
+    0x1A, 0xA9, 0x09, 0x99, 0x90, 0xAF, 0xA9, 0xAA, 0xAC, 0xA3, 0xCA, 0x3C, 0xA3, 0xCA, 0x76, 0x99,
+    0x0D, 0x19, 0x19, 0xFC, 0x90, 0xAC, 0x1D, 0xAF, 0xE1, 0xC9, 0x0A, 0xFC, 0x29, 0x1C, 0xA1, 0x97,
+    0x60, 0x4D, 0x70, 0x9D, 0x97, 0x0D, 0x69, 0xAA, 0x93, 0xC1, 0xAF, 0xC9, 0x0A, 0xC1, 0xD9, 0x9F,
+    0xCA, 0x09, 0xC9, 0x29, 0xDA, 0x6A, 0xA7, 0x09, 0xD9, 0x70, 0xD7, 0x70, 0x72, 0xAD, 0xA2, 0xD9,
+    0xFF, 0xAD, 0x19, 0xF7, 0x3A, 0xDA, 0x2D, 0x9F, 0xCA, 0xAC, 0xAD, 0x19, 0xF0, 0x95, 0x91, 0x39,
+    0x19, 0x59, 0xCA, 0x1A, 0xC9, 0x2A, 0xFF, 0xA2, 0xEA, 0xAE, 0x4A, 0xA1, 0xAA, 0x76, 0x7A, 0xA2,
+    0xAD, 0xA1, 0xAD, 0xA2, 0xD3, 0xD3, 0xD1, 0x9F, 0x3F, 0x3F, 0x99, 0xF3, 0xF3, 0xF9, 0x9C, 0x77,
+    0x1C, 0x99, 0xC7, 0x99, 0x7C, 0x99, 0xA5, 0xC0, 0xAA, 0x0C, 0x5A, 0x95, 0xA0, 0x93, 0x90, 0xA7,
+    0x3C, 0x7C, 0x71, 0x9A, 0x71, 0x99, 0x39, 0xA1, 0x9A, 0x71, 0xAA, 0x1A, 0x99, 0xC7, 0x71, 0xC9,
+    0x9C, 0x1C, 0x97, 0x2C, 0x1C, 0x99, 0xC1, 0x97, 0x39, 0x1C, 0x99, 0xC1, 0x9A, 0x71, 0x99, 0x1C,
+    0x93, 0x9A, 0x71, 0xAA, 0x71, 0xA7, 0xA7, 0x3C, 0x09, 0x39, 0x0C, 0x6A, 0x49, 0xC0, 0xAA, 0x0C,
+    0x94, 0xA0, 0x9C, 0x79, 0x97, 0xC9, 0x9C, 0x77, 0x1C, 0x99, 0xCA, 0xAA, 0x3A, 0xAA, 0xA3, 0xAA,
+    0xAC, 0x99, 0xF2, 0x9F, 0x92, 0xF9, 0x59, 0xA9, 0x3E, 0x92, 0xAD, 0x90, 0x9E, 0x99, 0xDA, 0x19,
+    0x93, 0x1A, 0xC0, 0xDA, 0x9C, 0x90, 0x9C, 0x91, 0xD9, 0x09, 0xD3, 0x29, 0x99, 0x94, 0xFD, 0x91,
+    0xEA, 0xAA, 0xD0, 0x9C, 0x93, 0x9C, 0x90, 0x91, 0xD1, 0x93, 0x9D, 0x95, 0x9D, 0x97, 0x40, 0x6C,
+    0x1A, 0x09, 0xF9, 0x0A, 0xDA, 0x1F, 0x09, 0xCA, 0x9C, 0x93, 0x90, 0x3A, 0x91, 0xAD, 0x99, 0xDA,
+    0x19, 0xDA, 0x29, 0xE3, 0x9A, 0x90, 0x9A, 0x39, 0xDA, 0x3A, 0xD9, 0x1A, 0xD9, 0x9E, 0x90, 0x9A,
+    0x30, 0x9A, 0x59, 0x91, 0x9D, 0xA2, 0xAD, 0x3A, 0xD9, 0x0E, 0x92, 0xAD, 0x99, 0xC9, 0xD1, 0xE9,
+    0x0A, 0xC0, 0xAC, 0x09, 0xA3, 0xCA, 0x1C, 0xA0, 0x9C, 0x91, 0xD9, 0x1D, 0x1D, 0x09, 0xCA, 0x9C,
+    0xA4, 0x19, 0x1D, 0xA0, 0xE0, 0x9A, 0x00, 0x2D, 0x39, 0x9D, 0x99, 0x1F, 0xD2, 0xAD, 0xA3, 0xF3,
+    0xA9, 0x9A, 0x10, 0x74, 0x9E, 0xAA, 0xE9, 0x09, 0xCA, 0x9A, 0xDA, 0x9A, 0xC9, 0xAC, 0x2D, 0x2C,
+    0xAA, 0xC2, 0xD2, 0xCA, 0x0D, 0x9A, 0xDA, 0x9D, 0x19, 0xE9, 0x9E, 0x90, 0x0C, 0xA3, 0xC9, 0x29,
+    0xFA, 0x9A, 0xAA, 0xC9, 0x29, 0xC3, 0x9A, 0x00, 0x0D, 0x77, 0x1D, 0x19, 0xD7, 0x7D, 0x92, 0xAD,
+    0xA7, 0x3A, 0xDA, 0x49, 0xFA, 0xA9, 0x99, 0x9A, 0xAF, 0x97, 0xAF, 0xFF, 0xA7, 0x49, 0xAA, 0xAA,
+    0xAA, 0x97, 0x0D, 0x77, 0x1D, 0x19, 0xD7, 0x7D, 0x92, 0xAD, 0xA7, 0x3A, 0xDA, 0x49, 0xFA, 0xA9,
+    0x99, 0x9A, 0xAF, 0x97, 0xAF, 0xFF, 0xA7, 0x49, 0xAA, 0xAA, 0xAA, 0x97, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xFF, 0xFA, 0x39, 0x99, 0x99, 0x74, 0x92, 0xAF, 0xFA, 0x97, 0xD1, 0xAD, 0xAA, 0xAA,
+    0xAF, 0xFA, 0xAE, 0x91, 0xCA, 0x79, 0x9A, 0xFE, 0x92, 0x97, 0x69, 0x94, 0x79, 0xAA, 0xAA, 0xAA,
+    0x97, 0x4A, 0xFF, 0xFA, 0x79, 0xFA, 0xA9, 0x99, 0x9A, 0xAF, 0x94, 0xAD, 0xA7, 0x3A, 0xDA, 0x29,
+    0xD7, 0x7D, 0x91, 0xD7, 0x71, 0xD0, 0x77, 0x2A, 0x77, 0x5D, 0x90, 0xAF, 0xFF, 0xFF, 0xC9, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0x73, 0xC9, 0x77, 0x70, 0x19, 0x99,
+    0x1A, 0x99, 0xCA, 0x39, 0xC0, 0x9A, 0xAD, 0xAA, 0x2C, 0xAA, 0x1A, 0xC0, 0xE9, 0xC5, 0x19, 0x99,
+    0x2C, 0xA9, 0xAA, 0x09, 0xA2, 0xC0, 0xAF, 0xC9, 0xAA, 0x49, 0xC5, 0x9F, 0x70, 0x0A, 0x0A, 0x09,
+    0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x19, 0x99, 0x2C, 0xA9, 0xAA, 0x0A, 0x92, 0xC9, 0xC9, 0x2A,
+    0xAC, 0x92, 0xA9, 0xAA, 0x2C, 0x1A, 0xE9, 0x70, 0x49, 0x0A, 0x92, 0xC0, 0xA9, 0x2C, 0x0A, 0x92,
+    0xC0, 0xA9, 0x2C, 0x0A, 0xA1, 0x9C, 0x1E, 0xAA, 0x70, 0x29, 0x99, 0x09, 0xCA, 0x9A, 0x0C, 0x93,
+    0xC4, 0xC4, 0xCA, 0x4A, 0xDA, 0x50, 0x4C, 0x5C, 0x29, 0x90, 0xC0, 0x9C, 0xA9, 0xD0, 0xC9, 0x2C,
+    0x0C, 0x3C, 0x0C, 0x92, 0xC0, 0xAA, 0x19, 0xC1, 0xAD, 0xAA, 0x70, 0xA9, 0x4A, 0xA4, 0xAA, 0x09,
+    0x91, 0xAC, 0xA9, 0xAC, 0x0A, 0xA2, 0xC9, 0xAA, 0x2C, 0x9A, 0xA2, 0xC9, 0xAA, 0x2C, 0x9A, 0x92,
+    0xC9, 0x19, 0x99, 0x19, 0x91, 0xAC, 0xA9, 0xCA, 0xA9, 0xAC, 0x0A, 0xA1, 0x9C, 0x2C, 0x9A, 0x92,
+    0xC2, 0xC9, 0xA9, 0x2C, 0x2C, 0x9A, 0x92, 0xC2, 0xC9, 0xA9, 0x2C, 0x2A, 0x90, 0x29, 0x99, 0xDA,
+    0x99, 0xC2, 0x9C, 0x29, 0xC2, 0x9C, 0x29, 0xC2, 0x09, 0x3C, 0xA9, 0x09, 0xCA, 0x91, 0xC9, 0x2C,
+    0x92, 0xC9, 0x2C, 0x92, 0x9D, 0x94, 0x09, 0x6A, 0xA2, 0xC9, 0x09, 0xC1, 0x9C, 0x2C, 0x90, 0xC9,
+    0x29, 0xC0, 0xC4, 0xCA, 0xA4, 0xAC, 0x20, 0x49, 0x1C, 0x1A, 0xA1, 0x9C, 0x9C, 0x3A, 0xC4, 0xCA,
+    0xA2, 0xC9, 0x0C, 0x90, 0xAA, 0x2C, 0x00, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74,
+    0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70,
+    0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49,
+    0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91,
+    0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x0F, 0xFA, 0x95, 0xFF, 0xF3, 0xDA,
+    0x99, 0x99, 0xAA, 0xF2, 0xD9, 0x6E, 0x91, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1, 0xD9, 0x7D, 0xA1,
+    0xD9, 0x6A, 0xD2, 0xD9, 0x5A, 0xDA, 0x2F, 0xFD, 0xA9, 0x3F, 0xFD, 0xA9, 0x3D, 0xA3, 0x99, 0xAE,
+    0x2D, 0x96, 0x9E, 0x1D, 0x97, 0xAD, 0x1D, 0x97, 0x9D, 0x90, 0xD9, 0x79, 0xD9, 0x0D, 0x97, 0xAD,
+    0x1D, 0x96, 0x9E, 0x1D, 0xA3, 0x99, 0xAE, 0x91, 0xFF, 0xF9, 0x2F, 0xFD, 0x93, 0x0F, 0xFD, 0xA0,
+    0xFF, 0xE0, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D,
+    0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x7D, 0xA7, 0x69, 0xE7, 0x6F,
+    0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x97, 0x3D, 0x90, 0xAC, 0xA7, 0x29, 0xD1, 0x9D, 0x72, 0xDA,
+    0x2D, 0x97, 0x09, 0xD9, 0x2A, 0xD7, 0x0A, 0xD4, 0xD9, 0x7D, 0x94, 0xDA, 0x69, 0xD5, 0x9D, 0x6D,
+    0xA6, 0xD9, 0x49, 0xD9, 0x6A, 0xD4, 0xAD, 0x79, 0xD9, 0x3D, 0xA7, 0x0D, 0xA2, 0x9D, 0x71, 0xAD,
+    0x2D, 0xA7, 0x2D, 0x90, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE0, 0xAF, 0xFF, 0xFC, 0x9A,
+    0xFF, 0xFF, 0xC9, 0x0F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99,
+    0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC9, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x72, 0xAD, 0x97, 0x19, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA,
+    0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9, 0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xD9,
+    0x72, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xDA, 0xFF, 0xFD,
+    0xA0, 0x0D, 0x97, 0x1A, 0xCA, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97,
+    0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0F, 0xFF, 0xF0,
+    0xFF, 0xFF, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D,
+    0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97, 0x1E, 0x0D, 0x97,
+    0x1E, 0x0D, 0x97, 0x1E, 0x77, 0x71, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE,
+    0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7,
+    0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0x0D, 0xA1, 0xFF, 0xC1,
+    0xE0, 0xDA, 0x1A, 0xAA, 0xAA, 0xAA, 0xA9, 0x1E, 0x0D, 0xA7, 0x4E, 0x0E, 0x74, 0xDA, 0x0A, 0xD7,
+    0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71, 0x9E, 0x29, 0xE7, 0x0E, 0x4A, 0xEA, 0x4A, 0xE9,
+    0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99, 0x70, 0xAF, 0xDA, 0xAF, 0xDA, 0x19, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x1A,
+    0xFD, 0x9F, 0xEA, 0x0D, 0x97, 0xAD, 0x91, 0xD9, 0x6A, 0xDA, 0x2D, 0x95, 0x9D, 0xA3, 0xD9, 0x49,
+    0xDA, 0x4D, 0x94, 0xE5, 0xD9, 0x3E, 0x6D, 0x92, 0xE7, 0xD9, 0x1E, 0x70, 0xD9, 0x0E, 0x71, 0xD9,
+    0xAD, 0xA7, 0x1F, 0xE9, 0x70, 0xF9, 0xE7, 0x0E, 0x19, 0xE7, 0xD9, 0x2A, 0xDA, 0x6D, 0x93, 0xE9,
+    0x5D, 0x94, 0xE5, 0xD9, 0x49, 0xE4, 0xD9, 0x5A, 0xDA, 0x3D, 0x96, 0xE9, 0x2D, 0x97, 0xE2, 0xD9,
+    0x79, 0xDA, 0x00, 0x69, 0xD7, 0x6E, 0xA7, 0x5F, 0x74, 0xAC, 0xAD, 0x97, 0x3D, 0x9A, 0xCA, 0x72,
+    0x9D, 0x09, 0xD7, 0x2A, 0xCA, 0x1D, 0x97, 0x1D, 0x91, 0xAD, 0x70, 0x9D, 0x29, 0xD7, 0x0D, 0xA3,
+    0xDA, 0x7D, 0x93, 0xAD, 0x6A, 0xD4, 0x9D, 0x95, 0xDA, 0x5D, 0xA5, 0xD9, 0x5A, 0xD4, 0xAD, 0x7D,
+    0x93, 0xDA, 0x7D, 0xA2, 0x9D, 0x70, 0xAD, 0x2A, 0xD7, 0x1D, 0x91, 0xDA, 0x71, 0xE0, 0x9D, 0x72,
+    0x9D, 0x0E, 0x73, 0xDA, 0x0E, 0xA7, 0x39, 0xEA, 0x0F, 0x73, 0xAE, 0xA0, 0xFA, 0x72, 0xFA, 0x0D,
+    0xAD, 0x71, 0x9F, 0xA0, 0xD9, 0xD9, 0x70, 0xD9, 0xDA, 0x0D, 0x0D, 0xA7, 0x9D, 0x0D, 0xA0, 0xD0,
+    0x9D, 0x7A, 0xCA, 0x0D, 0xA0, 0xD1, 0xD9, 0x6D, 0x90, 0xDA, 0x0D, 0x90, 0xAD, 0x59, 0xD1, 0xDA,
+    0x0D, 0x90, 0x9D, 0x5D, 0xA1, 0xDA, 0x0D, 0x91, 0xDA, 0x4D, 0x2D, 0xA0, 0xD9, 0x1A, 0xD3, 0xAD,
+    0x2D, 0xA0, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0xA0, 0xD9, 0x2D, 0xA1, 0x9D, 0x3D, 0xA0, 0xD9, 0x29,
+    0xD1, 0xAC, 0xA3, 0xDA, 0x0D, 0x93, 0xD9, 0x0D, 0x93, 0xDA, 0x0D, 0x93, 0xAD, 0x9D, 0x4D, 0xA0,
+    0xD9, 0x39, 0xFA, 0x4D, 0xA0, 0xD9, 0x4F, 0x5D, 0xA0, 0xD9, 0x4A, 0xDA, 0x5D, 0xA0, 0xD9, 0x5D,
+    0x95, 0xDA, 0x0E, 0x72, 0xD9, 0x0E, 0xA7, 0x1D, 0x90, 0xF9, 0x70, 0xD9, 0x0F, 0xC7, 0x0D, 0x90,
+    0xD9, 0xDA, 0x7D, 0x90, 0xD0, 0xAD, 0x96, 0xD9, 0x0D, 0x1E, 0x6D, 0x90, 0xD1, 0x9D, 0xA5, 0xD9,
+    0x0D, 0x2E, 0x5D, 0x90, 0xD9, 0x2E, 0x4D, 0x90, 0xD9, 0x29, 0xDA, 0x3D, 0x90, 0xD9, 0x3E, 0x3D,
+    0x90, 0xD9, 0x4E, 0x2D, 0x90, 0xD9, 0x4A, 0xD9, 0x1D, 0x90, 0xD9, 0x5E, 0x1D, 0x90, 0xD9, 0x59,
+    0xE0, 0xD9, 0x0D, 0x96, 0xAD, 0x9D, 0x90, 0xD9, 0x7F, 0xC9, 0x0D, 0x97, 0x9F, 0x90, 0xD9, 0x70,
+    0xAE, 0x90, 0xD9, 0x71, 0xE9, 0x0A, 0xFF, 0xFA, 0x1A, 0xFF, 0xFC, 0x19, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xFD, 0xA3, 0xAF, 0xFD, 0xA4, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x77, 0x71, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95,
+    0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD,
+    0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA,
+    0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2,
+    0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7,
+    0x59, 0x97, 0x00, 0x0F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xAD,
+    0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9,
+    0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9,
+    0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97,
+    0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90, 0xD9, 0x71, 0xD9, 0x0D, 0x97, 0x1D, 0x90,
+    0x0F, 0xEA, 0xA5, 0xFF, 0xE3, 0xDA, 0x99, 0x9A, 0xAF, 0x2D, 0x95, 0xAD, 0xA1, 0xD9, 0x6E, 0x1D,
+    0x96, 0xAD, 0x1D, 0x96, 0xAD, 0x1D, 0x96, 0xAD, 0x1D, 0x96, 0xE1, 0xD9, 0x5A, 0xD9, 0x1D, 0xA9,
+    0x99, 0x9A, 0xEA, 0x2F, 0xFD, 0xA3, 0xFE, 0xA9, 0x5D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x20, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x9E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1A, 0xDA, 0x73, 0xE9, 0x73, 0xE9, 0x73, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x3A, 0xDA, 0x72, 0x9D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x72,
+    0xE7, 0x2E, 0x72, 0xAD, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFD, 0xAF, 0xFF, 0xDA, 0xAF,
+    0xFF, 0xEA, 0xFF, 0xFE, 0x99, 0x99, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74,
+    0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74,
+    0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x50,
+    0xAD, 0x71, 0x9D, 0x09, 0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5,
+    0xDA, 0x4D, 0xA5, 0xAD, 0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19,
+    0xFC, 0x73, 0xF9, 0x73, 0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75,
+    0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x60, 0x71, 0xD9, 0x77, 0x3D, 0xA7, 0x79, 0xAF, 0xDA, 0xA9, 0x71,
+    0xAF, 0xFF, 0xCA, 0x59, 0xFA, 0x99, 0xE9, 0xAA, 0xF4, 0xE9, 0x3D, 0xA3, 0xAE, 0x2A, 0xD9, 0x4D,
+    0xA4, 0xAD, 0x91, 0xDA, 0x5D, 0xA5, 0xDA, 0x09, 0xD9, 0x5D, 0xA5, 0xAD, 0x09, 0xD6, 0xDA, 0x5A,
+    0xD0, 0xAD, 0x6D, 0xA5, 0xAD, 0x09, 0xD9, 0x5D, 0xA5, 0xAD, 0x1D, 0xA5, 0xDA, 0x5E, 0x1E, 0x5D,
+    0xA4, 0x9D, 0x91, 0x9E, 0x4D, 0xA3, 0x9E, 0x3A, 0xE9, 0x2D, 0xA2, 0xAE, 0x94, 0xAF, 0xFF, 0xE9,
+    0x7A, 0xFF, 0xE9, 0x74, 0x99, 0xDA, 0x97, 0x72, 0xDA, 0x77, 0x3D, 0xA7, 0x10, 0x0D, 0xA7, 0x09,
+    0xD1, 0xAD, 0x97, 0xDA, 0x2E, 0x6E, 0x39, 0xDA, 0x49, 0xD9, 0x4A, 0xD4, 0xDA, 0x6E, 0x2A, 0xD7,
+    0x9D, 0x90, 0x9D, 0x97, 0x0A, 0xD0, 0xDA, 0x72, 0xFC, 0x73, 0x9E, 0x97, 0x4E, 0x97, 0x3F, 0xC7,
+    0x29, 0xD9, 0xDA, 0x71, 0xDA, 0x0A, 0xD7, 0x0A, 0xD2, 0xE6, 0x9D, 0x92, 0x9D, 0x95, 0xDA, 0x4A,
+    0xD4, 0xAD, 0x6D, 0xA2, 0x9D, 0x96, 0xAD, 0x91, 0xE7, 0x0E, 0x0A, 0xD7, 0x19, 0xDA, 0x9D, 0x93,
+    0x9D, 0x49, 0xD0, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x99, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x99, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x99, 0xD9,
+    0x39, 0xD9, 0x39, 0xD9, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x99, 0xD9, 0x39, 0xD9, 0x39, 0xD1, 0xDA,
+    0x39, 0xD9, 0x3A, 0xD1, 0xE3, 0x9D, 0x93, 0xE1, 0x9D, 0x92, 0x9D, 0x92, 0xAD, 0x92, 0xEA, 0x19,
+    0xD9, 0x1A, 0xE4, 0xFF, 0xFD, 0x6A, 0xFF, 0xDA, 0x71, 0x99, 0xAD, 0xA9, 0x76, 0x9D, 0x97, 0x79,
+    0xD9, 0x77, 0x9D, 0x97, 0x79, 0xD9, 0x77, 0x9D, 0x97, 0x77, 0x72, 0x9F, 0xE9, 0x71, 0x9F, 0xFE,
+    0x96, 0x9E, 0xA9, 0x29, 0xAE, 0x94, 0x9E, 0x96, 0x9E, 0x4E, 0x71, 0x9E, 0x29, 0xDA, 0x72, 0xAD,
+    0x91, 0xAD, 0x73, 0x9D, 0xA1, 0xE7, 0x4E, 0x1E, 0x74, 0xE1, 0xDA, 0x74, 0xE1, 0xDA, 0x74, 0xE1,
+    0xE7, 0x4E, 0x1E, 0x74, 0xDA, 0x19, 0xD7, 0x39, 0xD9, 0x2D, 0xA7, 0x2A, 0xD3, 0xAD, 0x72, 0xDA,
+    0x4E, 0x70, 0xE6, 0xE6, 0xE4, 0x99, 0x99, 0xE4, 0xE9, 0x99, 0x90, 0x9F, 0xEA, 0x2A, 0xFE, 0x09,
+    0xFE, 0xA2, 0xAF, 0xE0, 0x39, 0xAE, 0x91, 0x9A, 0x94, 0xFF, 0x0D, 0x93, 0xEA, 0x90, 0x9A, 0xF9,
+    0x29, 0xDA, 0x49, 0xE9, 0x2E, 0x6A, 0xD9, 0x2D, 0xA6, 0x9D, 0x91, 0x9D, 0x97, 0xD9, 0x19, 0xD9,
+    0x7D, 0x91, 0x9D, 0x97, 0xD9, 0x19, 0xD9, 0x7D, 0x92, 0xD9, 0x7D, 0x92, 0xE6, 0x9D, 0x92, 0xAD,
+    0x95, 0xE9, 0x3E, 0x93, 0xFA, 0x39, 0xFF, 0x9A, 0xE9, 0x29, 0xFD, 0x91, 0xEA, 0x59, 0x95, 0x91,
+    0x59, 0x97, 0x19, 0xFD, 0xA5, 0xFF, 0xD3, 0xAD, 0xA3, 0xAE, 0x2D, 0xA5, 0xAD, 0x19, 0xD9, 0x59,
+    0xD9, 0x09, 0xD6, 0x9D, 0x90, 0xAD, 0x69, 0xD1, 0xAD, 0x6E, 0x1A, 0xD5, 0xAD, 0x2A, 0xD1, 0xAA,
+    0xAD, 0xA3, 0xAD, 0x1F, 0xC9, 0x3A, 0xD1, 0x99, 0x99, 0xE9, 0x1A, 0xD6, 0xAD, 0x1A, 0xD7, 0xE0,
+    0xAD, 0x79, 0xD0, 0xAD, 0x79, 0xD9, 0xAD, 0x79, 0xD9, 0xAD, 0x7A, 0xD0, 0xAD, 0x7E, 0x0A, 0xE9,
+    0x39, 0xE9, 0x0A, 0xFF, 0xEA, 0x1A, 0xDA, 0xFE, 0x92, 0xAD, 0x29, 0x96, 0xAD, 0x73, 0xAD, 0x73,
+    0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAD, 0x73, 0xAA, 0x97, 0x0A, 0xA0, 0xAD, 0x79, 0xD1, 0xD9,
+    0x69, 0xD1, 0xDA, 0x6A, 0xD1, 0xAD, 0x6A, 0xD2, 0xD9, 0x5A, 0xCA, 0x2D, 0xA5, 0xDA, 0x29, 0xD5,
+    0xD9, 0x3D, 0x93, 0xAD, 0x4D, 0xA3, 0xDA, 0x49, 0xD2, 0x9D, 0x6D, 0x91, 0xDA, 0x6A, 0xD0, 0xAD,
+    0x79, 0xDA, 0xD9, 0x70, 0xFA, 0x71, 0xAD, 0xA7, 0x29, 0xD7, 0x39, 0xD7, 0x39, 0xD7, 0x39, 0xD7,
+    0x39, 0xD7, 0x39, 0xD7, 0x75, 0x69, 0x99, 0x71, 0xFE, 0x95, 0xFF, 0xCA, 0x3E, 0x4A, 0xC9, 0x3D,
+    0x97, 0x3D, 0x97, 0x3E, 0x73, 0x9E, 0x97, 0x29, 0xEA, 0x71, 0x9F, 0xCA, 0x6A, 0xE9, 0xAE, 0x4E,
+    0x92, 0x9E, 0x2A, 0xD6, 0xDA, 0x1D, 0xA6, 0xAD, 0x09, 0xD7, 0x0D, 0x9A, 0xD7, 0x0D, 0xAA, 0xD7,
+    0x0D, 0xAA, 0xD7, 0x0D, 0x99, 0xD9, 0x69, 0xD9, 0x0E, 0x6E, 0x19, 0xE9, 0x3E, 0x92, 0xAF, 0xFC,
+    0x94, 0x9F, 0xDA, 0x72, 0x96, 0x29, 0xAF, 0xA9, 0x2F, 0xFC, 0xA0, 0xEA, 0x90, 0x99, 0xAC, 0x90,
+    0xDA, 0x70, 0xD9, 0x70, 0xDA, 0x70, 0x9D, 0xA9, 0x70, 0xFD, 0x4A, 0xFD, 0x3E, 0x96, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0x9E, 0x94, 0x99, 0x0A, 0xFF, 0xC9, 0x19, 0xFF, 0x95, 0x99, 0x30, 0x75,
+    0xAF, 0xFD, 0x90, 0x9F, 0xCA, 0xAE, 0x71, 0xD9, 0x70, 0xDA, 0x70, 0xE7, 0x0A, 0xD7, 0x09, 0xD9,
+    0x70, 0xDA, 0x70, 0xE7, 0x0A, 0xD9, 0x70, 0xDA, 0x70, 0xE7, 0x09, 0xD9, 0x70, 0xE7, 0x1D, 0x97,
+    0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0xA9, 0x79, 0xFD, 0x96, 0xAF,
+    0xD9, 0x79, 0xAE, 0x71, 0xAD, 0x71, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x10, 0x9A, 0x91,
+    0x9F, 0x92, 0xAD, 0x0F, 0xF1, 0xAF, 0xA9, 0x99, 0xEA, 0x0A, 0xE5, 0xE0, 0xAD, 0xA5, 0x9D, 0x9A,
+    0xD9, 0x6D, 0x9A, 0xD7, 0xD9, 0xAD, 0x7D, 0x9A, 0xD7, 0xD9, 0xAD, 0x7D, 0x9A, 0xD7, 0xD9, 0xAD,
+    0x7D, 0x9A, 0xD7, 0xD9, 0xAD, 0x7D, 0x9A, 0xD7, 0xD9, 0xAD, 0x7D, 0x97, 0x2D, 0x97, 0x2D, 0x97,
+    0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x90, 0x69, 0x97, 0x1A, 0xFC, 0xA6, 0xFF,
+    0xC4, 0xAD, 0xA2, 0x9E, 0x3D, 0xA4, 0x9D, 0x91, 0xAD, 0x6A, 0xD1, 0xDA, 0x69, 0xD1, 0xDA, 0x7D,
+    0x90, 0xD9, 0x7D, 0xA9, 0xD9, 0x7D, 0xA9, 0xD9, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x9F, 0xFF, 0xCA,
+    0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA9, 0xD7, 0x0D, 0xA9, 0xD9, 0x7D, 0xA0, 0xD9, 0x7D, 0xA0,
+    0xDA, 0x7D, 0x90, 0xDA, 0x69, 0xD1, 0x9D, 0x6A, 0xD2, 0xDA, 0x5D, 0xA2, 0xAD, 0x92, 0x9E, 0x4A,
+    0xFF, 0x6A, 0xFC, 0xA7, 0x29, 0x60, 0x9A, 0xA4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0x9D, 0xA4, 0xFD, 0x2F, 0xC4, 0x99,
+    0x10, 0x9A, 0xA5, 0x9A, 0xA9, 0x0A, 0xD5, 0xE1, 0xAD, 0x4E, 0x2A, 0xD3, 0xE3, 0xAD, 0x2A, 0xD9,
+    0x3A, 0xD1, 0xAD, 0x94, 0xAD, 0x09, 0xDA, 0x5A, 0xD9, 0xE6, 0xAF, 0xE5, 0xAE, 0x99, 0xDA, 0x4A,
+    0xD9, 0x1A, 0xD9, 0x3A, 0xD3, 0xE3, 0xAD, 0x39, 0xDA, 0x2A, 0xD4, 0xAD, 0x91, 0xAD, 0x5E, 0x1A,
+    0xD6, 0xE0, 0x09, 0x97, 0x4F, 0xC9, 0x71, 0xFD, 0x97, 0x4E, 0x75, 0xD9, 0x74, 0xAD, 0x74, 0x9D,
+    0x97, 0x4D, 0xA7, 0x39, 0xE7, 0x3F, 0x97, 0x2D, 0xAD, 0x71, 0xAC, 0xA9, 0xD7, 0x1D, 0x90, 0xDA,
+    0x79, 0xD1, 0xAD, 0x7A, 0xD1, 0x9D, 0x96, 0xD9, 0x2D, 0xA5, 0x9D, 0x3A, 0xD5, 0xAD, 0x4D, 0x94,
+    0xD9, 0x4E, 0x39, 0xD5, 0xAD, 0x3E, 0x6D, 0xA2, 0xD9, 0x6F, 0x0A, 0xD7, 0x9E, 0x75, 0x91, 0x9A,
+    0xA7, 0xAA, 0x91, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD,
+    0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D, 0xA1, 0xAD, 0x7D,
+    0xA1, 0xAD, 0x69, 0xDA, 0x1A, 0xD9, 0x5E, 0xA1, 0xAE, 0x93, 0xAE, 0xA1, 0xAF, 0xFC, 0x9A, 0xEA,
+    0xAD, 0x9F, 0xC9, 0x1E, 0xAA, 0xD2, 0x95, 0x91, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74, 0xAD, 0x74,
+    0xAD, 0x74, 0xAD, 0x74, 0xAA, 0x97, 0x0A, 0xA0, 0xAD, 0x79, 0xD1, 0xD9, 0x69, 0xD1, 0xDA, 0x6A,
+    0xD1, 0xAD, 0x6A, 0xD2, 0xD9, 0x5A, 0xCA, 0x2D, 0xA5, 0xDA, 0x29, 0xD5, 0xD9, 0x3D, 0x93, 0xAD,
+    0x4D, 0xA3, 0xDA, 0x49, 0xD2, 0x9D, 0x6D, 0x91, 0xDA, 0x6A, 0xD0, 0xAD, 0x79, 0xDA, 0xD9, 0x70,
+    0xFA, 0x71, 0xAD, 0xA5, 0x75, 0xAF, 0xFD, 0x90, 0x9D, 0xAF, 0xCA, 0xA3, 0x9D, 0x97, 0x9D, 0x71,
+    0xD9, 0x70, 0x9D, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xE9, 0x71, 0xAE, 0xAA, 0xAA, 0xA4, 0xAF, 0xE3,
+    0xEA, 0x99, 0x99, 0x92, 0xDA, 0x70, 0xE7, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xDA,
+    0x71, 0xE9, 0x70, 0x9E, 0xA9, 0x79, 0xFD, 0xA6, 0xAF, 0xD9, 0x79, 0xAE, 0x71, 0xAD, 0x71, 0x9D,
+    0x71, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x10, 0x4A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9,
+    0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0,
+    0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E,
+    0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x96, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFF, 0xC9, 0x09, 0x9A, 0xD9, 0x99, 0x99, 0x99, 0xDA, 0x99, 0x39,
+    0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6,
+    0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xD9, 0x59, 0xD6, 0xDA,
+    0x59, 0xD6, 0xFC, 0x39, 0xD7, 0xF7, 0x70, 0x91, 0x3A, 0xEA, 0x95, 0xAF, 0xF9, 0x29, 0xE9, 0x99,
+    0xAE, 0x2E, 0x5E, 0x09, 0xD6, 0x9D, 0x9A, 0xD7, 0xDA, 0xDA, 0x7F, 0xCA, 0x7F, 0xCA, 0x7F, 0xCA,
+    0x7F, 0xCA, 0x7D, 0xAD, 0xA6, 0x9D, 0x9D, 0xA6, 0xE0, 0xEA, 0x4A, 0xD9, 0x0F, 0xFE, 0xA1, 0xDA,
+    0xAF, 0xD9, 0x2D, 0xA2, 0x99, 0x5D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D,
+    0xA7, 0x20, 0x4A, 0xFA, 0x93, 0xAF, 0xF2, 0xAE, 0x99, 0x9A, 0xC9, 0x19, 0xDA, 0x70, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0xAD,
+    0xA7, 0x1F, 0x97, 0x0F, 0xD9, 0x69, 0xFD, 0x97, 0x9A, 0xE7, 0x1A, 0xD7, 0x19, 0xD7, 0x1A, 0xD7,
+    0x1D, 0xA7, 0x09, 0xD1, 0x59, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0x9F, 0xFF, 0x19, 0xEA, 0x99, 0x9E,
+    0x99, 0x91, 0xE5, 0xD9, 0x2A, 0xD6, 0xAD, 0x2D, 0xA6, 0x9D, 0x91, 0xD9, 0x7D, 0xA0, 0x9D, 0x97,
+    0xDA, 0x09, 0xD7, 0x0D, 0xA0, 0x9D, 0x97, 0xDA, 0x1D, 0x97, 0xDA, 0x1D, 0xA6, 0x9D, 0x91, 0xAD,
+    0x6E, 0x3E, 0x93, 0xE9, 0x39, 0xFF, 0xC9, 0x6A, 0xFD, 0x73, 0x97, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xAF, 0xFF, 0x90, 0x99, 0x9A, 0xDA, 0x99, 0x99, 0x94, 0x9D, 0x97, 0x19, 0xD9, 0x71,
+    0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x19, 0xD9, 0x71, 0x9D,
+    0x97, 0x19, 0xD9, 0x72, 0xE7, 0x2A, 0xFD, 0xA6, 0xAF, 0xCA, 0x71, 0x99, 0x20, 0x9A, 0xA6, 0xAA,
+    0x90, 0xAD, 0x6E, 0x0A, 0xD6, 0xAD, 0x0A, 0xD6, 0x9D, 0x0A, 0xD6, 0x9D, 0x9A, 0xD7, 0xD9, 0xAD,
+    0x7D, 0x9A, 0xD7, 0xD9, 0xAD, 0x7D, 0x9A, 0xD6, 0x9D, 0x9A, 0xD6, 0x9D, 0x0A, 0xD6, 0xE0, 0x9D,
+    0x94, 0x9D, 0xA1, 0xE3, 0x9E, 0x2A, 0xFF, 0xC4, 0x9F, 0xDA, 0x70, 0x99, 0x60, 0x77, 0x72, 0xAD,
+    0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x74, 0x9A, 0xFC, 0xA9, 0x79, 0xFF,
+    0xE9, 0x49, 0xEA, 0x9A, 0xD9, 0xAE, 0x93, 0xE2, 0xAD, 0x2E, 0x2A, 0xD3, 0xAD, 0x3E, 0x1D, 0xA3,
+    0xAD, 0x3A, 0xD0, 0x9D, 0x93, 0xAD, 0x4D, 0x99, 0xD9, 0x3A, 0xD4, 0xDA, 0x9D, 0x93, 0xAD, 0x4D,
+    0xA9, 0xD9, 0x3A, 0xD4, 0xD9, 0x0D, 0xA3, 0xAD, 0x39, 0xD9, 0x0E, 0x3A, 0xD3, 0xE1, 0x9D, 0xA2,
+    0xAD, 0x29, 0xD9, 0x2A, 0xDA, 0x1A, 0xD1, 0xAE, 0x49, 0xFF, 0xEA, 0x7A, 0xFE, 0xA9, 0x73, 0xAD,
+    0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x70, 0x0A, 0xAA, 0x71,
+    0xAA, 0xA1, 0xF7, 0x9D, 0x91, 0x9A, 0xDA, 0x6E, 0x4A, 0xD5, 0x9D, 0x95, 0xD9, 0x4D, 0xA6, 0xAD,
+    0x39, 0xD7, 0x0D, 0x92, 0xDA, 0x70, 0xE1, 0xAD, 0x71, 0x9D, 0x90, 0xD9, 0x72, 0xEA, 0xD7, 0x39,
+    0xF7, 0x5E, 0xA7, 0x5E, 0x97, 0x49, 0xF7, 0x4F, 0xC9, 0x72, 0xAD, 0x0E, 0x71, 0x9D, 0x90, 0x9D,
+    0x97, 0x0D, 0xA2, 0xDA, 0x7A, 0xD3, 0xAD, 0x69, 0xD9, 0x4E, 0x5E, 0x5A, 0xDA, 0x3A, 0xD7, 0xFC,
+    0x1D, 0xA7, 0x0A, 0xE0, 0x77, 0x70, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76,
+    0x9D, 0x79, 0xAA, 0x39, 0xD3, 0x9A, 0xA0, 0xAD, 0x39, 0xD3, 0x9D, 0x0A, 0xD3, 0x9D, 0x4D, 0x9A,
+    0xD3, 0x9D, 0x4D, 0xAA, 0xD3, 0x9D, 0x4D, 0xAA, 0xD3, 0x9D, 0x4E, 0xAD, 0x39, 0xD4, 0xAD, 0xAD,
+    0x39, 0xD4, 0xAD, 0xAD, 0x39, 0xD4, 0xAD, 0xAD, 0x39, 0xD4, 0xDA, 0xAD, 0x39, 0xD4, 0xDA, 0x9D,
+    0x92, 0x9D, 0x39, 0xD9, 0x0E, 0x29, 0xD3, 0xE1, 0x9E, 0x90, 0x9D, 0x1A, 0xE3, 0xAF, 0xFF, 0x94,
+    0x9A, 0xFF, 0xA7, 0x2A, 0xD9, 0x75, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76, 0x9D, 0x76,
+    0x9D, 0x70, 0x29, 0xAA, 0x70, 0x9A, 0xA4, 0x9D, 0x97, 0x1D, 0xA3, 0xDA, 0x72, 0x9D, 0x29, 0xD9,
+    0x73, 0xDA, 0x1A, 0xD7, 0x4A, 0xD1, 0xDA, 0x59, 0x94, 0x9D, 0x1D, 0xA4, 0xAD, 0x5D, 0x90, 0xD9,
+    0x4A, 0xD5, 0xD9, 0x0D, 0x94, 0xAD, 0x5D, 0x90, 0xDA, 0x4A, 0xD5, 0xD9, 0x0D, 0xA4, 0xAD, 0x49,
+    0xD9, 0x0E, 0x4A, 0xD4, 0xAD, 0x19, 0xD4, 0xE9, 0x3E, 0x2E, 0x2A, 0xCA, 0xD2, 0xAD, 0x92, 0x9F,
+    0xE0, 0xAF, 0xDA, 0x49, 0xFC, 0x2A, 0xFA, 0x70, 0x96, 0x99, 0x40, 0x7D, 0xA7, 0x69, 0xE7, 0x6F,
+    0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9,
+    0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE,
+    0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2,
+    0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x77, 0x77,
+    0x75, 0xDA, 0x77, 0xE7, 0x7D, 0xA7, 0x77, 0x20, 0x3A, 0xAE, 0xA9, 0x3A, 0xFF, 0xA2, 0xAC, 0xA9,
+    0x19, 0xE9, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2, 0xAF, 0xFC, 0x09, 0xFA, 0x99,
+    0x9A, 0xD0, 0xE5, 0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E, 0x9D, 0xA3, 0x9F, 0x0F, 0xFC,
+    0x9D, 0x1A, 0xFC, 0xA1, 0xD4, 0x97, 0x77, 0x1D, 0x97, 0x09, 0xDA, 0x71, 0xD9, 0x77, 0x00, 0x6E,
+    0xA7, 0x6A, 0xAE, 0x77, 0x0D, 0x77, 0x0D, 0x76, 0xE9, 0x76, 0xD7, 0x70, 0xAA, 0x77, 0x77, 0x3D,
+    0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1,
+    0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9,
+    0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9,
+    0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7,
+    0x39, 0xD9, 0x4E, 0xA7, 0x0A, 0xAE, 0x72, 0xD7, 0x2D, 0x70, 0xE9, 0x70, 0xD7, 0x2C, 0xA7, 0x75,
+    0xAA, 0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69,
+    0x99, 0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E,
+    0xAD, 0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x75, 0x9A,
+    0x97, 0x7D, 0x97, 0x1A, 0xA9, 0x1D, 0x97, 0x1F, 0x99, 0xA9, 0x71, 0xAD, 0x9D, 0x97, 0x2A, 0xCA,
+    0x2D, 0x72, 0xA9, 0x49, 0x97, 0x77, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD,
+    0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD,
+    0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA,
+    0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA,
+    0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x73, 0xAA, 0x97, 0x29, 0xD5, 0x9D, 0xA1,
+    0xD6, 0xF9, 0x9A, 0x6D, 0x99, 0xD9, 0x6D, 0x92, 0xD6, 0x95, 0x97, 0x76, 0xAA, 0xEA, 0x95, 0xAF,
+    0xFA, 0x4A, 0xCA, 0x91, 0x9E, 0x97, 0x3E, 0x73, 0xAD, 0x73, 0xAD, 0x70, 0x99, 0x9A, 0xD4, 0xAF,
+    0xFC, 0x29, 0xFA, 0x99, 0x9A, 0xD2, 0xE5, 0xAD, 0x1A, 0xD6, 0xAD, 0x1A, 0xD6, 0xE1, 0xAD, 0x59,
+    0xE1, 0x9D, 0xA3, 0x9F, 0x2F, 0xFC, 0x9D, 0x3A, 0xFC, 0xA1, 0xD6, 0x97, 0x00, 0x1A, 0xA7, 0x70,
+    0xDA, 0x77, 0x0D, 0x91, 0xAA, 0x97, 0x3A, 0xA0, 0xF9, 0x74, 0xAD, 0x9D, 0x97, 0x2A, 0xCA, 0x2D,
+    0x72, 0xA9, 0x49, 0x97, 0x77, 0x7D, 0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D,
+    0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39,
+    0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72,
+    0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x9A, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0x90, 0x9A,
+    0xAA, 0x69, 0x90, 0xF9, 0x7D, 0xA9, 0xD9, 0x5D, 0x92, 0xD5, 0x95, 0x97, 0x74, 0xAA, 0xEA, 0x94,
+    0xAF, 0xFA, 0x3A, 0xCA, 0x91, 0x9E, 0x97, 0x2E, 0x72, 0xAD, 0x72, 0xAD, 0x79, 0x99, 0xAD, 0x3A,
+    0xFF, 0xC1, 0x9F, 0xA9, 0x99, 0xAD, 0x1E, 0x5A, 0xD0, 0xAD, 0x6A, 0xD0, 0xAD, 0x6E, 0x0A, 0xD5,
+    0x9E, 0x09, 0xDA, 0x39, 0xF1, 0xFF, 0xC9, 0xD2, 0xAF, 0xCA, 0x1D, 0x59, 0x60, 0x77, 0x76, 0xE9,
+    0x77, 0x0A, 0xC7, 0x70, 0xD7, 0x2A, 0xA9, 0x1C, 0xA7, 0x2F, 0x90, 0xC7, 0x2D, 0xA9, 0xD7, 0x3A,
+    0xCA, 0x19, 0xD7, 0x2A, 0x94, 0xA9, 0x77, 0x77, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7,
+    0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7,
+    0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4,
+    0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9,
+    0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x71, 0x99, 0x97, 0x3A, 0xDA,
+    0x74, 0x9C, 0x73, 0x9D, 0x59, 0xDA, 0x1C, 0xA6, 0xFA, 0x0A, 0x6D, 0xA0, 0xD9, 0x6D, 0x92, 0xD9,
+    0x59, 0x59, 0x77, 0x6A, 0xAE, 0xA9, 0x5A, 0xFF, 0xA4, 0xAC, 0xA9, 0x19, 0xE9, 0x73, 0xE7, 0x3A,
+    0xD7, 0x3A, 0xD7, 0x09, 0x99, 0xAD, 0x4A, 0xFF, 0xC2, 0x9F, 0xA9, 0x99, 0xAD, 0x2E, 0x5A, 0xD1,
+    0xAD, 0x6A, 0xD1, 0xAD, 0x6E, 0x1A, 0xD5, 0x9E, 0x19, 0xDA, 0x39, 0xF2, 0xFF, 0xC9, 0xD3, 0xAF,
+    0xCA, 0x1D, 0x69, 0x70, 0x59, 0xA9, 0x29, 0xA7, 0x19, 0xF9, 0x0C, 0xA7, 0x1C, 0xA9, 0xAF, 0x97,
+    0x1A, 0x39, 0xA7, 0x6A, 0xA9, 0x76, 0xAE, 0x97, 0x4A, 0xD9, 0xD9, 0x72, 0x9C, 0xA2, 0xD7, 0x2A,
+    0x94, 0x99, 0x77, 0x77, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D,
+    0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70,
+    0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0,
+    0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x3A, 0xA9, 0x2A, 0xA3, 0xFC, 0xA9, 0xC9, 0x3C, 0x90,
+    0x9F, 0x49, 0x39, 0x97, 0x9A, 0xAA, 0x70, 0xF9, 0x6D, 0xA9, 0xD9, 0x4D, 0x92, 0xD4, 0x95, 0x97,
+    0x72, 0xAA, 0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD,
+    0x69, 0x99, 0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD,
+    0x6E, 0xAD, 0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x79,
+    0x97, 0x7A, 0xE7, 0x59, 0xFC, 0x74, 0xD9, 0x0E, 0x72, 0xD9, 0x2A, 0xCA, 0x71, 0x95, 0x99, 0x77,
+    0x77, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72,
+    0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6,
+    0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7,
+    0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD,
+    0x0E, 0x73, 0x9D, 0x97, 0x77, 0x77, 0x5D, 0xA7, 0x7E, 0x77, 0xDA, 0x77, 0x72, 0x59, 0x97, 0x1A,
+    0xE7, 0x9F, 0xC5, 0x9D, 0x90, 0xDA, 0x4D, 0x92, 0xAC, 0xA3, 0x95, 0x99, 0x77, 0x1A, 0xAE, 0xA9,
+    0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2,
+    0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E,
+    0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1, 0xD4, 0x97, 0x77, 0x1D, 0x71, 0x9D, 0x97,
+    0x1D, 0x77, 0x10, 0x71, 0x99, 0x97, 0x69, 0xD7, 0x7D, 0x97, 0x39, 0x19, 0xC1, 0x97, 0x2D, 0x4C,
+    0xA7, 0x19, 0xD9, 0x9A, 0xD7, 0x3A, 0xFC, 0x97, 0x59, 0xA9, 0x77, 0x77, 0x2D, 0xA7, 0x69, 0xE7,
+    0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1, 0xAD, 0x72, 0xE2,
+    0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9, 0x4A, 0xD6, 0xAF,
+    0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9, 0x29, 0xD9, 0x70,
+    0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7, 0x39, 0xD9, 0x7A,
+    0xA9, 0x70, 0xAD, 0x70, 0x9D, 0x6A, 0x19, 0xA1, 0xA4, 0xCA, 0x39, 0xC9, 0x3A, 0xDA, 0xAE, 0x5A,
+    0xFC, 0x70, 0x99, 0x77, 0x5A, 0xAE, 0xA9, 0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71, 0xE7,
+    0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2, 0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5, 0xAD,
+    0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E, 0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC, 0xA1,
+    0xD4, 0x96, 0x59, 0x97, 0x70, 0xAD, 0x77, 0x0A, 0xC9, 0x75, 0x91, 0xAC, 0x19, 0x72, 0xD4, 0xC9,
+    0x71, 0xAC, 0xA9, 0x9A, 0xD7, 0x3A, 0xFC, 0x97, 0x49, 0x9A, 0x97, 0x77, 0x72, 0xDA, 0x76, 0x9E,
+    0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E,
+    0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A,
+    0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97,
+    0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90,
+    0x3A, 0xA7, 0x2A, 0xCA, 0x72, 0xAC, 0x97, 0xA1, 0xAA, 0x1A, 0x4C, 0xA3, 0x9C, 0x4A, 0xDA, 0xAE,
+    0x5A, 0xFC, 0x70, 0x99, 0x77, 0x5A, 0xAE, 0xA9, 0x3A, 0xFF, 0xA2, 0xAC, 0xA9, 0x19, 0xE9, 0x71,
+    0xE7, 0x1A, 0xD7, 0x1A, 0xD6, 0x99, 0x9A, 0xD2, 0xAF, 0xFC, 0x09, 0xFA, 0x99, 0x9A, 0xD0, 0xE5,
+    0xAD, 0xAD, 0x6A, 0xDA, 0xD6, 0xEA, 0xD5, 0x9E, 0x9D, 0xA3, 0x9F, 0x0F, 0xFC, 0x9D, 0x1A, 0xFC,
+    0xA1, 0xD4, 0x96, 0x79, 0x97, 0x79, 0xE7, 0x71, 0xC9, 0x76, 0x9A, 0xC7, 0x49, 0x1A, 0xA1, 0x97,
+    0x2D, 0x4C, 0x97, 0x1A, 0xCA, 0x99, 0xAD, 0x73, 0xAF, 0xC9, 0x74, 0x99, 0xA9, 0x77, 0x77, 0x2D,
+    0xA7, 0x69, 0xE7, 0x6F, 0x97, 0x5D, 0xAD, 0x74, 0xAD, 0x0D, 0x74, 0xDA, 0x0D, 0xA7, 0x29, 0xD1,
+    0xAD, 0x72, 0xE2, 0xD9, 0x71, 0xD9, 0x2E, 0x70, 0xAD, 0x39, 0xD7, 0x0D, 0xA4, 0xDA, 0x69, 0xD9,
+    0x4A, 0xD6, 0xAF, 0xFE, 0x95, 0xFF, 0xFA, 0x49, 0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x4E, 0x70, 0xD9,
+    0x29, 0xD9, 0x70, 0xE2, 0xAD, 0x71, 0x9D, 0x91, 0xDA, 0x72, 0xDA, 0x09, 0xD7, 0x3A, 0xD0, 0xE7,
+    0x39, 0xD9, 0x49, 0xAA, 0x71, 0x9A, 0xD7, 0x29, 0xC9, 0x70, 0xAD, 0x6A, 0x90, 0xA9, 0x1A, 0x93,
+    0xD3, 0x9C, 0x93, 0x9D, 0xAA, 0xE5, 0xAF, 0xC7, 0x09, 0x97, 0x75, 0xAA, 0xEA, 0x93, 0xAF, 0xFA,
+    0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD, 0x2A, 0xFF, 0xC0,
+    0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59, 0xE9, 0xDA, 0x39,
+    0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x59, 0x99, 0x39, 0x71, 0x9F, 0x90, 0xCA,
+    0x71, 0xCA, 0x9A, 0xF9, 0x71, 0xA3, 0x9A, 0x73, 0x95, 0x97, 0x2C, 0xA3, 0x9C, 0x97, 0x1A, 0xCA,
+    0x99, 0xAD, 0x73, 0xFD, 0x97, 0x49, 0x9A, 0x97, 0x77, 0x72, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75,
+    0xDA, 0xD7, 0x4A, 0xD0, 0xD7, 0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D,
+    0x92, 0xE7, 0x0A, 0xD3, 0x9D, 0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F,
+    0xFF, 0xA4, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7,
+    0x19, 0xD9, 0x1D, 0xA7, 0x2D, 0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x90, 0x3A, 0xA9, 0x29,
+    0xA3, 0xAF, 0x99, 0xCA, 0x3C, 0x90, 0x9F, 0x49, 0x39, 0x95, 0x95, 0x94, 0xCA, 0x39, 0xC4, 0xAD,
+    0xAA, 0xE5, 0xAF, 0xC7, 0x09, 0x97, 0x75, 0xAA, 0xEA, 0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E,
+    0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD, 0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD,
+    0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59, 0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1,
+    0xAF, 0xCA, 0x1D, 0x49, 0x60, 0x4A, 0x94, 0x9A, 0x71, 0xD4, 0xCA, 0x71, 0x9F, 0xE7, 0x3A, 0xFC,
+    0x97, 0x59, 0x97, 0x77, 0x73, 0xDA, 0x76, 0x9E, 0x76, 0xF9, 0x75, 0xDA, 0xD7, 0x4A, 0xD0, 0xD7,
+    0x4D, 0xA0, 0xDA, 0x72, 0x9D, 0x1A, 0xD7, 0x2E, 0x2D, 0x97, 0x1D, 0x92, 0xE7, 0x0A, 0xD3, 0x9D,
+    0x70, 0xDA, 0x4D, 0xA6, 0x9D, 0x94, 0xAD, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0xA4, 0x9D, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xE4, 0xE7, 0x0D, 0x92, 0x9D, 0x97, 0x0E, 0x2A, 0xD7, 0x19, 0xD9, 0x1D, 0xA7, 0x2D,
+    0xA0, 0x9D, 0x73, 0xAD, 0x0E, 0x73, 0x9D, 0x97, 0x77, 0x77, 0x5D, 0xA7, 0x7E, 0x77, 0xDA, 0x77,
+    0x72, 0x2A, 0x59, 0x93, 0xD3, 0x9C, 0xA3, 0xAF, 0xE5, 0xAF, 0xC9, 0x79, 0x97, 0x75, 0xAA, 0xEA,
+    0x93, 0xAF, 0xFA, 0x2A, 0xCA, 0x91, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xAD, 0x69, 0x99, 0xAD,
+    0x2A, 0xFF, 0xC0, 0x9F, 0xA9, 0x99, 0xAD, 0x0E, 0x5A, 0xDA, 0xD6, 0xAD, 0xAD, 0x6E, 0xAD, 0x59,
+    0xE9, 0xDA, 0x39, 0xF0, 0xFF, 0xC9, 0xD1, 0xAF, 0xCA, 0x1D, 0x49, 0x77, 0x70, 0xAD, 0x71, 0xE7,
+    0x1A, 0xD7, 0x71, 0x0F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99,
+    0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x77, 0x76, 0x9D, 0x71, 0xE7, 0x19, 0xD7,
+    0x71, 0x39, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E,
+    0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93,
+    0xAF, 0xEA, 0x79, 0x97, 0x77, 0x09, 0xD7, 0x2A, 0xD7, 0x29, 0xD7, 0x72, 0x39, 0xE9, 0x79, 0xAA,
+    0xDA, 0x72, 0xD7, 0x19, 0xCA, 0x79, 0xE7, 0x09, 0xCA, 0x72, 0xC9, 0x77, 0x2F, 0xFE, 0x90, 0xFF,
+    0xE9, 0x0D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71,
+    0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90,
+    0xFF, 0xE9, 0x49, 0xEA, 0x70, 0x9A, 0xAD, 0xA7, 0x3D, 0x72, 0x9C, 0xA7, 0x09, 0xE7, 0x19, 0xCA,
+    0x73, 0xC9, 0x77, 0x69, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94,
+    0xAD, 0x1E, 0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F,
+    0xFD, 0x93, 0xAF, 0xEA, 0x79, 0x94, 0x39, 0x94, 0x92, 0x9F, 0x91, 0xAC, 0x2D, 0xAF, 0xDA, 0x19,
+    0xC9, 0x19, 0xF3, 0x95, 0x97, 0x70, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0xDA, 0x99, 0x99, 0x99, 0x99,
+    0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1F, 0xFE, 0x1F, 0xFE,
+    0x1D, 0xA9, 0x99, 0x99, 0x99, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0x39, 0x94, 0x99, 0x3F,
+    0xA2, 0xC9, 0x2A, 0xCA, 0xAF, 0xD3, 0xCA, 0x2A, 0xE9, 0x39, 0x59, 0x77, 0x59, 0xAE, 0xA9, 0x5A,
+    0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD, 0xA1, 0x9D, 0x94, 0xAD, 0x1E, 0x6D, 0xA0, 0xDA, 0x6E, 0x9D,
+    0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF, 0xFC, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9D, 0x97, 0x2D,
+    0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0xA4, 0x9A, 0x3F, 0xFD, 0x93, 0xAF, 0xEA, 0x79, 0x94, 0x73,
+    0xAA, 0x73, 0xDA, 0x5A, 0xAA, 0x19, 0xD5, 0x9F, 0x0A, 0xA5, 0x9D, 0x9D, 0xA7, 0xD2, 0xAC, 0xA5,
+    0x99, 0x49, 0xA7, 0x73, 0xFF, 0xE9, 0x2F, 0xFE, 0x92, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x3D, 0x97,
+    0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3F, 0xFE, 0x3F, 0xFE, 0x3D, 0xA9,
+    0x99, 0x99, 0x99, 0x4D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x3D,
+    0xA9, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xE9, 0x2F, 0xFE, 0x91, 0x73, 0x9A, 0xA7, 0x4D, 0x96, 0xDA,
+    0x1A, 0xC9, 0x6F, 0xC0, 0xA9, 0x6A, 0xD0, 0xDA, 0x7A, 0xCA, 0x2A, 0xC9, 0x69, 0x59, 0x97, 0x77,
+    0x9A, 0xEA, 0x97, 0xAF, 0xEA, 0x5A, 0xDA, 0x90, 0x9A, 0xDA, 0x39, 0xD9, 0x4A, 0xD3, 0xE6, 0xDA,
+    0x2D, 0xA6, 0xE1, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE1, 0x9F, 0xFF, 0xC1, 0x9E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x19, 0xD9, 0x74, 0xD9, 0x74, 0xE7, 0x4A, 0xD9, 0x74, 0xEA, 0x49, 0xA5, 0xFF, 0xD9,
+    0x5A, 0xFE, 0xA7, 0x19, 0x96, 0x9A, 0x97, 0x29, 0xD7, 0x39, 0xD1, 0x9A, 0xA6, 0x9A, 0x99, 0xF7,
+    0x0D, 0x9D, 0xA6, 0xD2, 0xAC, 0xA4, 0x99, 0x49, 0xA7, 0x71, 0xFF, 0xE9, 0x1F, 0xFE, 0x91, 0xDA,
+    0x99, 0x99, 0x99, 0x99, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0x97,
+    0x2F, 0xFE, 0x2F, 0xFE, 0x2D, 0xA9, 0x99, 0x99, 0x99, 0x3D, 0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D,
+    0x97, 0x2D, 0x97, 0x2D, 0x97, 0x2D, 0xA9, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xE9, 0x1F, 0xFE, 0x90,
+    0x0A, 0xA9, 0x73, 0x9D, 0x74, 0x9C, 0xA1, 0xAA, 0xA7, 0x9A, 0x0A, 0xF7, 0x0A, 0xD0, 0xAC, 0xA6,
+    0x9C, 0xA2, 0xAC, 0xA5, 0x99, 0x59, 0x77, 0x59, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xAD, 0xA9, 0x09,
+    0xAD, 0xA2, 0x9D, 0x94, 0xAD, 0x2E, 0x6D, 0xA1, 0xDA, 0x6E, 0x09, 0xDA, 0x99, 0x99, 0x99, 0x9E,
+    0x09, 0xFF, 0xFC, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9D, 0x97, 0x3D, 0x97, 0x3E, 0x73,
+    0xAD, 0x97, 0x3E, 0xA4, 0x9A, 0x4F, 0xFD, 0x94, 0xAF, 0xEA, 0x70, 0x99, 0x40, 0x77, 0x69, 0xE7,
+    0x4C, 0x97, 0x29, 0xC9, 0x4A, 0xAA, 0x1A, 0xC9, 0x4A, 0xF0, 0x9A, 0x49, 0xD9, 0xDA, 0x6D, 0x2A,
+    0xC9, 0x49, 0x94, 0x9A, 0x77, 0x1F, 0xFE, 0x91, 0xFF, 0xE9, 0x1D, 0xA9, 0x99, 0x99, 0x99, 0x92,
+    0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xFF, 0xE2, 0xFF, 0xE2,
+    0xDA, 0x99, 0x99, 0x99, 0x93, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0xD9,
+    0x72, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFE, 0x91, 0xFF, 0xE9, 0x00, 0x71, 0x99, 0x97, 0x3A,
+    0xE7, 0x49, 0xC7, 0x39, 0xD6, 0xDA, 0x1C, 0xA6, 0xFA, 0x0A, 0x6D, 0xA0, 0xD9, 0x6A, 0xC9, 0x2A,
+    0xC9, 0x59, 0x59, 0x77, 0x69, 0xAE, 0xA9, 0x6A, 0xFE, 0xA4, 0xAD, 0xA9, 0x09, 0xAD, 0xA2, 0x9D,
+    0x94, 0xAD, 0x2E, 0x6D, 0xA1, 0xDA, 0x6E, 0x09, 0xDA, 0x99, 0x99, 0x99, 0x9E, 0x09, 0xFF, 0xFC,
+    0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9D, 0x97, 0x3D, 0x97, 0x3E, 0x73, 0xAD, 0x97, 0x3E,
+    0xA4, 0x9A, 0x4F, 0xFD, 0x94, 0xAF, 0xEA, 0x70, 0x99, 0x50, 0x3A, 0x93, 0xA4, 0xFA, 0x0A, 0xC3,
+    0xAC, 0x99, 0xFA, 0x3A, 0x92, 0x9A, 0x97, 0x9A, 0xA7, 0x09, 0xEA, 0x69, 0xD9, 0xDA, 0x5D, 0x2A,
+    0xC9, 0x39, 0x94, 0x9A, 0x77, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1D,
+    0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1F, 0xFE, 0x1F, 0xFE, 0x1D,
+    0xA9, 0x99, 0x99, 0x99, 0x2D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x1D, 0x97,
+    0x1D, 0xA9, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xE9, 0x0F, 0xFE, 0x90, 0x39, 0xAA, 0x29, 0xA4, 0xAF,
+    0xA9, 0xCA, 0x4C, 0xA0, 0x9F, 0x59, 0x49, 0x71, 0xAA, 0xA7, 0x1F, 0xA7, 0xAC, 0xA0, 0xD9, 0x5A,
+    0xC9, 0x2A, 0xC9, 0x49, 0x59, 0x97, 0x73, 0x9A, 0xEA, 0x95, 0xAF, 0xEA, 0x3A, 0xDA, 0x90, 0x9A,
+    0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0xE6, 0xDA, 0x0D, 0xA6, 0xE9, 0xDA, 0x99, 0x99, 0x99, 0x9E, 0x9F,
+    0xFF, 0xC9, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xD9, 0x72, 0xD9, 0x72, 0xE7, 0x2A, 0xD9, 0x72,
+    0xEA, 0x49, 0xA3, 0xFF, 0xD9, 0x3A, 0xFE, 0xA7, 0x99, 0x40, 0x59, 0x97, 0x1F, 0x7A, 0xFA, 0x5A,
+    0xD0, 0x9D, 0x93, 0xAD, 0x3D, 0x92, 0x99, 0x59, 0x97, 0x6F, 0xFE, 0x90, 0xFF, 0xE9, 0x0D, 0xA9,
+    0x99, 0x99, 0x99, 0x91, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71,
+    0xFF, 0xE1, 0xFF, 0xE1, 0xDA, 0x99, 0x99, 0x99, 0x92, 0xD9, 0x71, 0xD9, 0x71, 0xD9, 0x71, 0xD9,
+    0x71, 0xD9, 0x71, 0xD9, 0x71, 0xDA, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFE, 0x90, 0xFF, 0xE9, 0x77,
+    0x76, 0x9D, 0x71, 0xE7, 0x19, 0xD7, 0x71, 0x59, 0x99, 0x71, 0xAE, 0x70, 0x9F, 0xC7, 0xD9, 0x0E,
+    0x5D, 0x92, 0xAD, 0x49, 0x69, 0x77, 0x39, 0xAE, 0xA9, 0x5A, 0xFE, 0xA3, 0xAD, 0xA9, 0x09, 0xAD,
+    0xA1, 0x9D, 0x94, 0xAD, 0x1E, 0x6D, 0xA0, 0xDA, 0x6E, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0xE9, 0xFF,
+    0xFC, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9D, 0x97, 0x2D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E,
+    0xA4, 0x9A, 0x3F, 0xFD, 0x93, 0xAF, 0xEA, 0x79, 0x97, 0x77, 0x09, 0xD7, 0x2A, 0xD7, 0x29, 0xD7,
+    0x72, 0x1A, 0xCA, 0x93, 0xFC, 0x5D, 0x5D, 0x3A, 0xDA, 0x3D, 0x5C, 0xA7, 0x2A, 0xFD, 0xAA, 0xFD,
+    0xA1, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D,
+    0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D,
+    0x93, 0x9D, 0x91, 0xAF, 0xD9, 0xFE, 0xA0, 0x0E, 0xA2, 0xAA, 0xDA, 0x4D, 0x39, 0xD2, 0xE9, 0x2C,
+    0xA4, 0xC9, 0x72, 0x9A, 0xA3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A,
+    0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x20, 0xAF, 0xDA, 0xAF, 0xDA,
+    0x19, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9,
+    0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9,
+    0x39, 0xD9, 0x1A, 0xFD, 0x9F, 0xEA, 0x77, 0x19, 0xD4, 0xAD, 0x93, 0x9D, 0x72, 0x09, 0x90, 0xAD,
+    0x0A, 0xD1, 0xAA, 0x70, 0x9A, 0xA0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD,
+    0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x70, 0x9D, 0x0A, 0xD9,
+    0x9D, 0x40, 0x77, 0x71, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E,
+    0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0,
+    0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7,
+    0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4,
+    0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x77, 0x75, 0xDA, 0x77,
+    0x0E, 0x77, 0x0D, 0xA7, 0x77, 0x30, 0x4A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29,
+    0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D,
+    0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93,
+    0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x97, 0x77, 0x49, 0xD7, 0x4A, 0xD7, 0x49, 0xD7,
+    0x76, 0x79, 0xAA, 0xA7, 0x7A, 0xF9, 0x77, 0x09, 0xCA, 0x77, 0x0A, 0xCA, 0x76, 0x9E, 0x77, 0xAC,
+    0xA7, 0x70, 0x9C, 0x77, 0x77, 0x2A, 0xFE, 0x97, 0x09, 0xFF, 0xE9, 0x5A, 0xEA, 0x92, 0x9A, 0xE9,
+    0x39, 0xE7, 0x9E, 0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0xA7, 0x2E, 0x1A, 0xD7, 0x39, 0xD9, 0x0E, 0x74,
+    0xDA, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E,
+    0x0E, 0x74, 0xDA, 0x0A, 0xD7, 0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71, 0x9E, 0x29, 0xE7,
+    0x0E, 0x4A, 0xEA, 0x4A, 0xE9, 0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99, 0x70, 0x5E, 0xA7,
+    0x3A, 0xAE, 0x75, 0xD7, 0x49, 0xD7, 0x3E, 0x97, 0x3D, 0x75, 0xC9, 0x77, 0x73, 0xAF, 0x97, 0xAF,
+    0xF9, 0x4A, 0xE9, 0x99, 0xAE, 0x92, 0x9D, 0xA5, 0xE2, 0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9,
+    0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7,
+    0xDA, 0x19, 0xD9, 0x5A, 0xD3, 0xE9, 0x3A, 0xDA, 0x4F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60,
+    0x76, 0x9A, 0x97, 0x70, 0xD9, 0x72, 0xAA, 0xA1, 0xAC, 0xA7, 0x2F, 0xA0, 0xA9, 0x72, 0xAD, 0x9D,
+    0x97, 0x39, 0xCA, 0x2D, 0x97, 0x2A, 0x94, 0x99, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95,
+    0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD,
+    0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA,
+    0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2,
+    0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7,
+    0x59, 0x97, 0x00, 0x74, 0xAA, 0x97, 0x3A, 0xCA, 0x6A, 0xD9, 0x09, 0xCA, 0x6A, 0xF0, 0x99, 0x69,
+    0xD0, 0xAD, 0x79, 0xD2, 0x9D, 0x79, 0x59, 0x77, 0x70, 0xAF, 0x97, 0xAF, 0xF9, 0x4A, 0xE9, 0x99,
+    0xAE, 0x92, 0x9D, 0xA5, 0xE2, 0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97,
+    0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19, 0xD9, 0x5A,
+    0xD3, 0xE9, 0x3A, 0xDA, 0x4F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x2A, 0xA7, 0x71, 0xAD,
+    0x77, 0x1A, 0xC9, 0x1A, 0xAA, 0x74, 0xAA, 0x0A, 0xEA, 0x75, 0xAD, 0x9D, 0x97, 0x39, 0xCA, 0x2D,
+    0x97, 0x2A, 0x94, 0x99, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE,
+    0x93, 0x9E, 0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7,
+    0x4D, 0xA0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74,
+    0xE0, 0xE7, 0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E,
+    0x70, 0xE4, 0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x9A,
+    0xA7, 0x5D, 0x97, 0x5D, 0x1A, 0xAA, 0x97, 0x0A, 0x99, 0xF7, 0x19, 0xD9, 0xAD, 0x70, 0xD2, 0x9D,
+    0x79, 0x59, 0x77, 0x70, 0xAF, 0x97, 0xAF, 0xF9, 0x4A, 0xE9, 0x99, 0xAE, 0x92, 0x9D, 0xA5, 0xE2,
+    0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0,
+    0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19, 0xD9, 0x5A, 0xD3, 0xE9, 0x3A, 0xDA, 0x4F,
+    0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x77, 0x77, 0x0A, 0xDA, 0x77, 0x19, 0xC7, 0x71, 0xAC,
+    0x73, 0xAA, 0xA1, 0xCA, 0x73, 0xFA, 0x0A, 0x97, 0x2A, 0xD9, 0xD9, 0x73, 0xAC, 0xA2, 0xD7, 0x3A,
+    0x94, 0x99, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E,
+    0x79, 0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0,
+    0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7,
+    0x4D, 0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4,
+    0xAE, 0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x00, 0x72, 0x99, 0x75,
+    0xE9, 0x75, 0xCA, 0x74, 0xAC, 0x96, 0xAD, 0x90, 0xAC, 0x7A, 0xF0, 0x99, 0x69, 0xD0, 0xAD, 0x79,
+    0xD2, 0x9D, 0x79, 0x59, 0x77, 0x70, 0xAF, 0x97, 0xAF, 0xF9, 0x4A, 0xE9, 0x99, 0xAE, 0x92, 0x9D,
+    0xA5, 0xE2, 0xE6, 0x9D, 0x91, 0xDA, 0x7E, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9,
+    0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x1D, 0xA7, 0xE1, 0xE7, 0xDA, 0x19, 0xD9, 0x5A, 0xD3, 0xE9, 0x3A,
+    0xDA, 0x4F, 0xFC, 0xA6, 0xAF, 0xD9, 0x72, 0x99, 0x60, 0x69, 0xA9, 0x3A, 0x72, 0x9F, 0x90, 0xD7,
+    0x2C, 0xA9, 0xAF, 0x97, 0x2A, 0x39, 0xA9, 0x76, 0xAA, 0x97, 0x7A, 0xE9, 0x75, 0xAD, 0x9D, 0x97,
+    0x39, 0xCA, 0x2D, 0x73, 0xA9, 0x49, 0x97, 0x77, 0x6A, 0xFE, 0x97, 0x09, 0xFF, 0xE9, 0x5A, 0xEA,
+    0x92, 0x9A, 0xE9, 0x39, 0xE7, 0x9E, 0x3E, 0x71, 0x9D, 0xA1, 0x9D, 0xA7, 0x2E, 0x1A, 0xD7, 0x39,
+    0xD9, 0x0E, 0x74, 0xDA, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E, 0x0D, 0xA7, 0x4E,
+    0x0D, 0xA7, 0x4E, 0x0E, 0x74, 0xDA, 0x0A, 0xD7, 0x39, 0xDA, 0x09, 0xD9, 0x72, 0xAD, 0x2E, 0x71,
+    0x9E, 0x29, 0xE7, 0x0E, 0x4A, 0xEA, 0x4A, 0xE9, 0x5A, 0xFF, 0xE9, 0x70, 0xAF, 0xEA, 0x75, 0x99,
+    0x70, 0x4A, 0xA9, 0x2C, 0x96, 0xFC, 0x9A, 0xC6, 0xAC, 0x1A, 0xEA, 0x69, 0x93, 0x99, 0x72, 0xAA,
+    0xA9, 0x72, 0x9F, 0x71, 0x9D, 0x9A, 0xD7, 0x0D, 0x29, 0xD7, 0x95, 0x97, 0x77, 0x0A, 0xF9, 0x7A,
+    0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29, 0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D,
+    0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E,
+    0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93, 0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x96,
+    0x70, 0x99, 0x97, 0x79, 0xE9, 0x75, 0x9F, 0xC7, 0x5D, 0xA0, 0xAD, 0x73, 0xD9, 0x2A, 0xD7, 0x29,
+    0x69, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0x9F, 0xFE, 0x95, 0xAE, 0xA9, 0x29, 0xAE, 0x93, 0x9E, 0x79,
+    0xE3, 0xE7, 0x19, 0xDA, 0x19, 0xDA, 0x72, 0xE1, 0xAD, 0x73, 0x9D, 0x90, 0xE7, 0x4D, 0xA0, 0xDA,
+    0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xDA, 0x74, 0xE0, 0xE7, 0x4D,
+    0xA0, 0xAD, 0x73, 0x9D, 0xA0, 0x9D, 0x97, 0x2A, 0xD2, 0xE7, 0x19, 0xE2, 0x9E, 0x70, 0xE4, 0xAE,
+    0xA4, 0xAE, 0x95, 0xAF, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x97, 0x77, 0x75, 0xDA, 0x77, 0x0E,
+    0x77, 0x0D, 0xA7, 0x77, 0x30, 0x69, 0x97, 0x4E, 0xA7, 0x2F, 0xCA, 0x70, 0xAD, 0x09, 0xD9, 0x6A,
+    0xD3, 0xD9, 0x59, 0x95, 0x99, 0x77, 0x7A, 0xF9, 0x7A, 0xFF, 0x94, 0xAE, 0x99, 0x9A, 0xE9, 0x29,
+    0xDA, 0x5E, 0x2E, 0x69, 0xD9, 0x1D, 0xA7, 0xE0, 0x9D, 0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD0, 0x9D,
+    0x97, 0xAD, 0x09, 0xD9, 0x7A, 0xD1, 0xDA, 0x7E, 0x1E, 0x7D, 0xA1, 0x9D, 0x95, 0xAD, 0x3E, 0x93,
+    0xAD, 0xA4, 0xFF, 0xCA, 0x6A, 0xFD, 0x97, 0x29, 0x97, 0x77, 0x49, 0xD7, 0x4A, 0xD7, 0x49, 0xD7,
+    0x76, 0x73, 0x99, 0x77, 0x3E, 0x77, 0x2A, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x2D, 0x97, 0x73, 0x97,
+    0x77, 0x7A, 0xD9, 0x5A, 0xFD, 0xA9, 0x3A, 0xD4, 0x9F, 0xFE, 0x2D, 0xA3, 0xAE, 0xA9, 0x29, 0xAE,
+    0x9A, 0xD3, 0x9E, 0x79, 0xFC, 0x93, 0xE7, 0x19, 0xE4, 0x9D, 0xA7, 0x2E, 0x4A, 0xD7, 0x39, 0xD9,
+    0x3E, 0x74, 0xDA, 0x3D, 0xA7, 0x4E, 0x3D, 0xA7, 0x4E, 0x3D, 0xA7, 0x4E, 0x3D, 0xA7, 0x4E, 0x3D,
+    0xA7, 0x4E, 0x3E, 0x74, 0xDA, 0x3A, 0xD7, 0x39, 0xD9, 0x39, 0xD9, 0x72, 0xAD, 0x5E, 0x71, 0x9D,
+    0xA5, 0x9E, 0x70, 0xE7, 0xAE, 0xA4, 0xAE, 0x97, 0x0A, 0xFF, 0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09,
+    0x97, 0x30, 0x70, 0x99, 0x97, 0x5A, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xAC, 0xA7, 0x69, 0x96,
+    0xE7, 0x6D, 0xA4, 0xAF, 0x92, 0x9D, 0x3A, 0xFF, 0x90, 0xDA, 0x2A, 0xDA, 0x99, 0x99, 0xFD, 0x29,
+    0xDA, 0x5E, 0xA3, 0xE6, 0x9D, 0x93, 0xDA, 0x7E, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x29,
+    0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x3D, 0x97, 0xE3, 0xE7, 0xDA, 0x39, 0xD9, 0x5A, 0xD5, 0xE9,
+    0x3A, 0xDA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFD, 0x97, 0x49, 0x97, 0x00, 0x69, 0x99, 0x77, 0x3E, 0x77,
+    0x4D, 0xA7, 0x73, 0x9D, 0x97, 0x73, 0x9D, 0x77, 0x59, 0x77, 0x75, 0xAD, 0x95, 0xAF, 0xDA, 0x93,
+    0xAD, 0x49, 0xFF, 0xE2, 0xDA, 0x3A, 0xEA, 0x92, 0x9A, 0xE9, 0xAD, 0x39, 0xE7, 0x9F, 0xC9, 0x3E,
+    0x71, 0x9E, 0x49, 0xDA, 0x72, 0xE4, 0xAD, 0x73, 0x9D, 0x93, 0xE7, 0x4D, 0xA3, 0xDA, 0x74, 0xE3,
+    0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xE7, 0x4D, 0xA3, 0xAD,
+    0x73, 0x9D, 0x93, 0x9D, 0x97, 0x2A, 0xD5, 0xE7, 0x19, 0xDA, 0x59, 0xE7, 0x0E, 0x7A, 0xEA, 0x4A,
+    0xE9, 0x70, 0xAF, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99, 0x73, 0x39, 0x99, 0x76, 0xAD, 0xA7,
+    0x6A, 0xD7, 0x7E, 0x77, 0xAC, 0xA7, 0x79, 0x94, 0xE7, 0x6D, 0xA4, 0xAF, 0x92, 0x9D, 0x3A, 0xFF,
+    0x90, 0xDA, 0x2A, 0xDA, 0x99, 0x99, 0xFD, 0x29, 0xDA, 0x5E, 0xA3, 0xE6, 0x9D, 0x93, 0xDA, 0x7E,
+    0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x3D, 0x97,
+    0xE3, 0xE7, 0xDA, 0x39, 0xD9, 0x5A, 0xD5, 0xE9, 0x3A, 0xDA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFD, 0x97,
+    0x49, 0x97, 0x00, 0x7E, 0xA7, 0x72, 0xAA, 0xE7, 0x74, 0xAC, 0x97, 0x73, 0xD7, 0x72, 0xAD, 0xA7,
+    0x72, 0xD7, 0x74, 0xAA, 0x77, 0x76, 0xAD, 0x95, 0xAF, 0xDA, 0x93, 0xAD, 0x49, 0xFF, 0xE2, 0xDA,
+    0x3A, 0xEA, 0x92, 0x9A, 0xE9, 0xAD, 0x39, 0xE7, 0x9F, 0xC9, 0x3E, 0x71, 0x9E, 0x49, 0xDA, 0x72,
+    0xE4, 0xAD, 0x73, 0x9D, 0x93, 0xE7, 0x4D, 0xA3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74,
+    0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xE7, 0x4D, 0xA3, 0xAD, 0x73, 0x9D, 0x93, 0x9D, 0x97,
+    0x2A, 0xD5, 0xE7, 0x19, 0xDA, 0x59, 0xE7, 0x0E, 0x7A, 0xEA, 0x4A, 0xE9, 0x70, 0xAF, 0xFE, 0x97,
+    0x3A, 0xFE, 0xA7, 0x70, 0x99, 0x73, 0x49, 0xE9, 0x74, 0x9A, 0xAD, 0xA7, 0x69, 0xD7, 0x6A, 0xCA,
+    0x74, 0x9E, 0x75, 0x9C, 0x97, 0x69, 0xC6, 0xE7, 0x6D, 0xA4, 0xAF, 0x92, 0x9D, 0x3A, 0xFF, 0x90,
+    0xDA, 0x2A, 0xDA, 0x99, 0x99, 0xFD, 0x29, 0xDA, 0x5E, 0xA3, 0xE6, 0x9D, 0x93, 0xDA, 0x7E, 0x29,
+    0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x3D, 0x97, 0xE3,
+    0xE7, 0xDA, 0x39, 0xD9, 0x5A, 0xD5, 0xE9, 0x3A, 0xDA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFD, 0x97, 0x49,
+    0x97, 0x00, 0x69, 0x94, 0x99, 0x74, 0xFA, 0x2C, 0xA7, 0x3A, 0xDA, 0xFD, 0x74, 0xD2, 0xAE, 0xA7,
+    0x49, 0x59, 0x77, 0x74, 0xAD, 0x95, 0xAF, 0xDA, 0x93, 0xAD, 0x49, 0xFF, 0xE2, 0xDA, 0x3A, 0xEA,
+    0x92, 0x9A, 0xE9, 0xAD, 0x39, 0xE7, 0x9F, 0xC9, 0x3E, 0x71, 0x9E, 0x49, 0xDA, 0x72, 0xE4, 0xAD,
+    0x73, 0x9D, 0x93, 0xE7, 0x4D, 0xA3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA,
+    0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xE7, 0x4D, 0xA3, 0xAD, 0x73, 0x9D, 0x93, 0x9D, 0x97, 0x2A, 0xD5,
+    0xE7, 0x19, 0xDA, 0x59, 0xE7, 0x0E, 0x7A, 0xEA, 0x4A, 0xE9, 0x70, 0xAF, 0xFE, 0x97, 0x3A, 0xFE,
+    0xA7, 0x70, 0x99, 0x73, 0x49, 0x94, 0x97, 0x9F, 0x91, 0xAC, 0x7D, 0xAF, 0xDA, 0x69, 0xC9, 0x19,
+    0xF7, 0x09, 0x72, 0xE7, 0x6D, 0xA4, 0xAF, 0x92, 0x9D, 0x3A, 0xFF, 0x90, 0xDA, 0x2A, 0xDA, 0x99,
+    0x99, 0xFD, 0x29, 0xDA, 0x5E, 0xA3, 0xE6, 0x9D, 0x93, 0xDA, 0x7E, 0x29, 0xD9, 0x7A, 0xD2, 0x9D,
+    0x97, 0xAD, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD, 0x3D, 0x97, 0xE3, 0xE7, 0xDA, 0x39, 0xD9,
+    0x5A, 0xD5, 0xE9, 0x3A, 0xDA, 0x6F, 0xFC, 0xA7, 0x0A, 0xFD, 0x97, 0x49, 0x97, 0x00, 0x77, 0x77,
+    0x71, 0xAD, 0x95, 0xAF, 0xDA, 0x93, 0xAD, 0x49, 0xFF, 0xE2, 0xDA, 0x3A, 0xEA, 0x92, 0x9A, 0xE9,
+    0xAD, 0x39, 0xE7, 0x9F, 0xC9, 0x3E, 0x71, 0x9E, 0x49, 0xDA, 0x72, 0xE4, 0xAD, 0x73, 0x9D, 0x93,
+    0xE7, 0x4D, 0xA3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA, 0x74, 0xE3, 0xDA,
+    0x74, 0xE3, 0xE7, 0x4D, 0xA3, 0xAD, 0x73, 0x9D, 0x93, 0x9D, 0x97, 0x2A, 0xD5, 0xE7, 0x19, 0xDA,
+    0x59, 0xE7, 0x0E, 0x7A, 0xEA, 0x4A, 0xE9, 0x70, 0xAF, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99,
+    0x77, 0x77, 0x73, 0xDA, 0x77, 0x3E, 0x77, 0x3D, 0xA7, 0x77, 0x71, 0x77, 0x77, 0x0E, 0x76, 0xDA,
+    0x4A, 0xF9, 0x29, 0xD3, 0xAF, 0xF9, 0x0D, 0xA2, 0xAD, 0xA9, 0x99, 0x9F, 0xD2, 0x9D, 0xA5, 0xEA,
+    0x3E, 0x69, 0xD9, 0x3D, 0xA7, 0xE2, 0x9D, 0x97, 0xAD, 0x29, 0xD9, 0x7A, 0xD2, 0x9D, 0x97, 0xAD,
+    0x29, 0xD9, 0x7A, 0xD3, 0xD9, 0x7E, 0x3E, 0x7D, 0xA3, 0x9D, 0x95, 0xAD, 0x5E, 0x93, 0xAD, 0xA6,
+    0xFF, 0xCA, 0x70, 0xAF, 0xD9, 0x74, 0x99, 0x77, 0x77, 0x09, 0xD7, 0x6A, 0xD9, 0x75, 0x9D, 0x77,
+    0x72, 0x9D, 0x72, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9,
+    0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA,
+    0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA,
+    0x93, 0xAE, 0x4F, 0xFE, 0x95, 0x9F, 0xEA, 0x73, 0x99, 0x77, 0x76, 0xAD, 0x75, 0xE7, 0x5A, 0xD7,
+    0x77, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7,
+    0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD6, 0x9D,
+    0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90, 0xAC, 0xA4, 0x99,
+    0x77, 0x71, 0xAC, 0xA7, 0x2E, 0x72, 0xAC, 0xA7, 0x73, 0x59, 0xAC, 0xA9, 0x73, 0x9F, 0x97, 0x59,
+    0xD7, 0x59, 0xCA, 0x74, 0xAD, 0x97, 0x39, 0xCA, 0x75, 0x9C, 0x97, 0x77, 0x9D, 0x72, 0xDA, 0x9D,
+    0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D,
+    0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9,
+    0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA, 0x9D, 0x97, 0x1D, 0xA9, 0xD9, 0x71, 0xDA,
+    0x0D, 0x97, 0x1D, 0x90, 0xE7, 0x0A, 0xD1, 0xAD, 0xA7, 0xE2, 0xEA, 0x93, 0xAE, 0x4F, 0xFE, 0x95,
+    0x9F, 0xEA, 0x73, 0x99, 0x60, 0x4E, 0xA7, 0x1A, 0xAE, 0x73, 0xD7, 0x29, 0xD7, 0x1E, 0x97, 0x1C,
+    0xA7, 0x3C, 0x97, 0x73, 0x9A, 0xA7, 0xAA, 0x9A, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D,
+    0xAA, 0xD6, 0x9D, 0xAA, 0xD9, 0x5E, 0xA0, 0xE9, 0x3F, 0xA0, 0xAF, 0xFA, 0xDA, 0x19, 0xFD, 0x90,
+    0xAC, 0xA4, 0x99, 0x60, 0x71, 0x99, 0x97, 0x71, 0xE9, 0x77, 0x09, 0xDA, 0x77, 0x1D, 0xA7, 0x71,
+    0xAC, 0xA7, 0x72, 0x99, 0x77, 0x77, 0xE9, 0xD7, 0x2D, 0xA1, 0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0x9D,
+    0x09, 0xD9, 0x71, 0xDA, 0x9D, 0xA0, 0x9D, 0x97, 0x1F, 0xCA, 0x19, 0xD9, 0x71, 0xEA, 0x92, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA5, 0xD9, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x69, 0xDA, 0x7E,
+    0x7E, 0xA9, 0x39, 0xE9, 0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA, 0x77, 0x09, 0x97, 0x30, 0x79, 0x99,
+    0x76, 0x9D, 0xA7, 0x6E, 0x76, 0xAD, 0x76, 0x9D, 0x77, 0x09, 0x79, 0xDA, 0x76, 0x9D, 0x99, 0xAA,
+    0x7A, 0xA9, 0x0A, 0xD0, 0xAD, 0x7D, 0xA9, 0xDA, 0x0A, 0xD7, 0xFC, 0xA1, 0xAD, 0x7E, 0xA9, 0x2A,
+    0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7,
+    0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0xA4, 0xAD, 0x95, 0xEA, 0x5E, 0x93, 0xFA, 0x5A, 0xFF,
+    0xAD, 0xA6, 0x9F, 0xD9, 0x0A, 0xCA, 0x71, 0x99, 0x73, 0x49, 0x99, 0x77, 0x2A, 0xD9, 0x77, 0x2E,
+    0x77, 0x3D, 0xA7, 0x73, 0xD9, 0x77, 0x39, 0x77, 0x76, 0xE9, 0xD7, 0x2D, 0xA1, 0xDA, 0x9D, 0x97,
+    0x1D, 0xA0, 0x9D, 0x09, 0xD9, 0x71, 0xDA, 0x9D, 0xA0, 0x9D, 0x97, 0x1F, 0xCA, 0x19, 0xD9, 0x71,
+    0xEA, 0x92, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97,
+    0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97,
+    0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA5, 0xD9, 0x71, 0xD9, 0x5E, 0x70, 0x9D,
+    0x69, 0xDA, 0x7E, 0x7E, 0xA9, 0x39, 0xE9, 0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA, 0x77, 0x09, 0x97,
+    0x30, 0x29, 0x99, 0x77, 0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xAD, 0x77, 0x0A, 0xCA, 0x77, 0x09, 0x95,
+    0x9D, 0xA7, 0x69, 0xD9, 0x9A, 0xA7, 0xAA, 0x90, 0xAD, 0x0A, 0xD7, 0xDA, 0x9D, 0xA0, 0xAD, 0x7F,
+    0xCA, 0x1A, 0xD7, 0xEA, 0x92, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D,
+    0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x69, 0xDA, 0x4A, 0xD9, 0x5E,
+    0xA5, 0xE9, 0x3F, 0xA5, 0xAF, 0xFA, 0xDA, 0x69, 0xFD, 0x90, 0xAC, 0xA7, 0x19, 0x97, 0x30, 0x6A,
+    0xCA, 0x97, 0x70, 0x9F, 0xA7, 0x73, 0xD7, 0x73, 0xD7, 0x71, 0xAD, 0x97, 0x71, 0xD7, 0x73, 0xCA,
+    0x77, 0x76, 0xE9, 0xD7, 0x2D, 0xA1, 0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0x9D, 0x09, 0xD9, 0x71, 0xDA,
+    0x9D, 0xA0, 0x9D, 0x97, 0x1F, 0xCA, 0x19, 0xD9, 0x71, 0xEA, 0x92, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA5, 0xD9, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x69, 0xDA, 0x7E, 0x7E, 0xA9, 0x39, 0xE9,
+    0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA, 0x77, 0x09, 0x97, 0x30, 0x4E, 0xA7, 0x6A, 0xAE, 0x77, 0x0D,
+    0x77, 0x0D, 0x76, 0xE9, 0x76, 0xD7, 0x70, 0xCA, 0x69, 0xDA, 0x76, 0x9D, 0x99, 0xAA, 0x7A, 0xA9,
+    0x0A, 0xD0, 0xAD, 0x7D, 0xA9, 0xDA, 0x0A, 0xD7, 0xFC, 0xA1, 0xAD, 0x7E, 0xA9, 0x2A, 0xD7, 0xDA,
+    0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A,
+    0xD7, 0xDA, 0x4A, 0xD6, 0x9D, 0xA4, 0xAD, 0x95, 0xEA, 0x5E, 0x93, 0xFA, 0x5A, 0xFF, 0xAD, 0xA6,
+    0x9F, 0xD9, 0x0A, 0xCA, 0x71, 0x99, 0x73, 0x59, 0x59, 0x73, 0xAF, 0x91, 0xD7, 0x3D, 0xAF, 0xD9,
+    0x72, 0xAC, 0x29, 0xEA, 0x74, 0x94, 0x97, 0x77, 0x5E, 0x9D, 0x72, 0xDA, 0x1D, 0xA9, 0xD9, 0x71,
+    0xDA, 0x09, 0xD0, 0x9D, 0x97, 0x1D, 0xA9, 0xDA, 0x09, 0xD9, 0x71, 0xFC, 0xA1, 0x9D, 0x97, 0x1E,
+    0xA9, 0x29, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71,
+    0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71,
+    0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x49, 0xD9, 0x71, 0xDA, 0x5D, 0x97, 0x1D, 0x95, 0xE7, 0x09, 0xD6,
+    0x9D, 0xA7, 0xE7, 0xEA, 0x93, 0x9E, 0x97, 0x0F, 0xFE, 0x97, 0x29, 0xFE, 0xA7, 0x70, 0x99, 0x73,
+    0x39, 0x94, 0x97, 0x09, 0xF9, 0x19, 0xC7, 0x0D, 0xAF, 0xE7, 0x0C, 0x91, 0x9F, 0x71, 0x95, 0x94,
+    0x9D, 0xA7, 0x69, 0xD9, 0x9A, 0xA7, 0xAA, 0x90, 0xAD, 0x0A, 0xD7, 0xDA, 0x9D, 0xA0, 0xAD, 0x7F,
+    0xCA, 0x1A, 0xD7, 0xEA, 0x92, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D,
+    0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x7D, 0xA4, 0xAD, 0x69, 0xDA, 0x4A, 0xD9, 0x5E,
+    0xA5, 0xE9, 0x3F, 0xA5, 0xAF, 0xFA, 0xDA, 0x69, 0xFD, 0x90, 0xAC, 0xA7, 0x19, 0x97, 0x30, 0x77,
+    0x77, 0x70, 0xE9, 0xD7, 0x2D, 0xA1, 0xDA, 0x9D, 0x97, 0x1D, 0xA0, 0x9D, 0x09, 0xD9, 0x71, 0xDA,
+    0x9D, 0xA0, 0x9D, 0x97, 0x1F, 0xCA, 0x19, 0xD9, 0x71, 0xEA, 0x92, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D, 0x97, 0x1D, 0xA4, 0x9D,
+    0x97, 0x1D, 0xA5, 0xD9, 0x71, 0xD9, 0x5E, 0x70, 0x9D, 0x69, 0xDA, 0x7E, 0x7E, 0xA9, 0x39, 0xE9,
+    0x70, 0xFF, 0xE9, 0x72, 0x9F, 0xEA, 0x77, 0x09, 0x97, 0x77, 0x77, 0x09, 0xD7, 0x72, 0xAD, 0x97,
+    0x71, 0x9D, 0x77, 0x77, 0x10, 0x77, 0x77, 0x19, 0xDA, 0x76, 0x9D, 0x99, 0xAA, 0x7A, 0xA9, 0x0A,
+    0xD0, 0xAD, 0x7D, 0xA9, 0xDA, 0x0A, 0xD7, 0xFC, 0xA1, 0xAD, 0x7E, 0xA9, 0x2A, 0xD7, 0xDA, 0x4A,
+    0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7, 0xDA, 0x4A, 0xD7,
+    0xDA, 0x4A, 0xD6, 0x9D, 0xA4, 0xAD, 0x95, 0xEA, 0x5E, 0x93, 0xFA, 0x5A, 0xFF, 0xAD, 0xA6, 0x9F,
+    0xD9, 0x0A, 0xCA, 0x71, 0x99, 0x77, 0x77, 0x3A, 0xCA, 0x77, 0xE7, 0x7A, 0xCA, 0x77, 0x75, 0x49,
+    0x97, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0x9D, 0x77, 0x97, 0x77, 0xAD, 0x71, 0x9D, 0x09,
+    0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA, 0x4D, 0xA5, 0xAD,
+    0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC, 0x73, 0xF9, 0x73,
+    0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75,
+    0xDA, 0x60, 0x39, 0x99, 0x73, 0xE7, 0x4E, 0x74, 0xD9, 0x74, 0xD7, 0x59, 0x77, 0x4A, 0xAA, 0x70,
+    0xAA, 0x9A, 0xD7, 0x9D, 0x90, 0xDA, 0x6A, 0xD1, 0xAD, 0x6D, 0xA1, 0x9D, 0x94, 0x9D, 0x92, 0xDA,
+    0x4A, 0xD3, 0xAD, 0x4D, 0xA4, 0xD9, 0x29, 0xD5, 0xAD, 0x2E, 0x59, 0xD2, 0xD9, 0x6D, 0xA0, 0x9D,
+    0x7A, 0xD0, 0xDA, 0x70, 0xD9, 0xD9, 0x70, 0xAF, 0x71, 0x9E, 0xA7, 0x2E, 0x73, 0xE7, 0x3D, 0x97,
+    0x2A, 0xD7, 0x3D, 0xA7, 0x19, 0xE7, 0xAF, 0xC7, 0x0A, 0xEA, 0x71, 0xAD, 0x71, 0x9D, 0x09, 0xDA,
+    0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA, 0x4D, 0xA5, 0xAD, 0x3A,
+    0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC, 0x73, 0xF9, 0x73, 0x9E,
+    0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA,
+    0x77, 0x77, 0x77, 0xD9, 0x74, 0x9D, 0xA7, 0x5D, 0x97, 0x77, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79,
+    0xD9, 0x0D, 0xA6, 0xAD, 0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A, 0xD4,
+    0xDA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D, 0xA7,
+    0x0D, 0x9D, 0x97, 0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x1D, 0x96,
+    0xDA, 0x1E, 0x49, 0xE2, 0xD9, 0x1A, 0xFC, 0x70, 0xAE, 0xA7, 0x10, 0x5A, 0xCA, 0xA7, 0x4A, 0xF7,
+    0x6A, 0xC9, 0x75, 0xAC, 0x97, 0x39, 0xE7, 0x4A, 0xC9, 0x75, 0xAC, 0x77, 0x70, 0xAD, 0x71, 0x9D,
+    0x09, 0xDA, 0x70, 0xE1, 0xAD, 0x7A, 0xD3, 0xDA, 0x6D, 0xA3, 0xAD, 0x5A, 0xD5, 0xDA, 0x4D, 0xA5,
+    0xAD, 0x3A, 0xD7, 0xDA, 0x2D, 0xA7, 0xAD, 0x1A, 0xD7, 0x1E, 0x9D, 0x97, 0x19, 0xFC, 0x73, 0xF9,
+    0x73, 0x9E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA,
+    0x75, 0xDA, 0x60, 0x4A, 0xE9, 0x71, 0x9A, 0xAD, 0x97, 0x3A, 0xCA, 0x73, 0xAC, 0x97, 0x1A, 0xDA,
+    0x72, 0xAC, 0x97, 0x39, 0xC7, 0x75, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79, 0xD9, 0x0D, 0xA6, 0xAD,
+    0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A, 0xD4, 0xDA, 0x4D, 0x92, 0x9D,
+    0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D, 0xA7, 0x0D, 0x9D, 0x97, 0x0A,
+    0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x71, 0x9E, 0x7A, 0xFC,
+    0x70, 0xAE, 0xA7, 0x10, 0x49, 0x94, 0x97, 0xFA, 0x19, 0xC9, 0x5A, 0xCA, 0xAF, 0xD6, 0xCA, 0x2A,
+    0xE9, 0x69, 0x59, 0x77, 0x6A, 0xD7, 0x19, 0xD0, 0x9D, 0xA7, 0x0E, 0x1A, 0xD7, 0xAD, 0x3D, 0xA6,
+    0xDA, 0x3A, 0xD5, 0xAD, 0x5D, 0xA4, 0xDA, 0x5A, 0xD3, 0xAD, 0x7D, 0xA2, 0xDA, 0x7A, 0xD1, 0xAD,
+    0x71, 0xE9, 0xD9, 0x71, 0x9F, 0xC7, 0x3F, 0x97, 0x39, 0xE7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7,
+    0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA7, 0x5D, 0xA6, 0x39, 0x94, 0x99, 0x4F, 0xA2, 0xCA,
+    0x39, 0xDA, 0xFD, 0x93, 0xD2, 0xAE, 0xA4, 0x95, 0x97, 0x73, 0xAA, 0xA7, 0x0A, 0xA9, 0xAD, 0x79,
+    0xD9, 0x0D, 0xA6, 0xAD, 0x1A, 0xD6, 0xDA, 0x19, 0xD9, 0x49, 0xD9, 0x2D, 0xA4, 0xAD, 0x3A, 0xD4,
+    0xDA, 0x4D, 0x92, 0x9D, 0x5A, 0xD2, 0xE5, 0x9D, 0x2D, 0x96, 0xDA, 0x09, 0xD7, 0xAD, 0x0D, 0xA7,
+    0x0D, 0x9D, 0x97, 0x0A, 0xF7, 0x19, 0xEA, 0x72, 0xE7, 0x3E, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA,
+    0x71, 0x9E, 0x7A, 0xFC, 0x70, 0xAE, 0xA7, 0x10, 0x72, 0x9A, 0x6C, 0xA1, 0x9A, 0xAA, 0xAC, 0xA0,
+    0xAC, 0xAA, 0xAC, 0xA0, 0xAA, 0x1C, 0xA1, 0xAA, 0x09, 0xA2, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x72, 0xA9, 0x4A, 0xC4, 0xAC, 0xAA, 0xAA, 0x90, 0xAC, 0xAA, 0xAC,
+    0xA1, 0xAC, 0x1A, 0xA2, 0xA9, 0x0A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA0, 0xFE, 0x0F, 0xE0, 0x99, 0x99, 0x99, 0x90, 0xFE, 0x0F, 0xE0, 0x99, 0x99, 0x99, 0x90,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x90, 0xFF, 0xF9, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x72, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D,
+    0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D,
+    0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90,
+    0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3,
+    0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9, 0x0D, 0x3D, 0x90, 0xD3, 0xD9,
+    0x71, 0x76, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x19, 0xCA, 0x1A, 0xC9, 0x1D, 0x1A,
+    0xD1, 0xE1, 0xDA, 0x0A, 0xD9, 0x19, 0x91, 0x1D, 0xA0, 0x9D, 0x90, 0xAD, 0x1E, 0x1D, 0x91, 0xD1,
+    0x9C, 0xA2, 0x92, 0x1A, 0xD2, 0xE2, 0xDA, 0x2D, 0x91, 0x9D, 0x2A, 0xCA, 0x2D, 0x39, 0x92, 0x9D,
+    0x90, 0x9D, 0xA1, 0xDA, 0x1A, 0xD1, 0x9D, 0x2D, 0x91, 0x9C, 0xA2, 0x90, 0x19, 0xCA, 0x2D, 0x2A,
+    0xC9, 0x19, 0xD2, 0xD2, 0xDA, 0x1A, 0xD2, 0xD9, 0x1E, 0x1A, 0xD2, 0xDA, 0x1E, 0x1A, 0xD9, 0x1E,
+    0x29, 0x92, 0x99, 0x20, 0x1D, 0xA1, 0xAD, 0x19, 0xD9, 0x1E, 0x1A, 0xD2, 0xDA, 0x1E, 0x19, 0xD2,
+    0xD9, 0x1A, 0xD2, 0xD2, 0xD9, 0x19, 0xCA, 0x2D, 0x39, 0x39, 0x30, 0x1A, 0xD1, 0x9D, 0x91, 0xE1,
+    0x9D, 0x91, 0xDA, 0x1A, 0xD1, 0x9D, 0x91, 0xDA, 0x19, 0xD2, 0xD9, 0x1A, 0xCA, 0x19, 0xD2, 0xD2,
+    0xAC, 0xA2, 0x99, 0x39, 0x20, 0x9D, 0x91, 0xDA, 0x19, 0xD9, 0x1E, 0x2D, 0xA1, 0xAD, 0x2A, 0xD1,
+    0x9D, 0x91, 0x9D, 0x2D, 0x92, 0xD9, 0x1A, 0xCA, 0x29, 0xCA, 0x2D, 0x39, 0x39, 0x90, 0x77, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1D, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0x6A, 0xA9, 0x9A, 0xC9, 0x99, 0xAA, 0x1F,
+    0xFE, 0x1C, 0xAA, 0xAA, 0xCA, 0xAA, 0xAC, 0x59, 0xC7, 0x2A, 0xC7, 0x2A, 0xC7, 0x2A, 0xC9, 0x71,
+    0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x1D, 0x97, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1E, 0x40, 0x77, 0x1E, 0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x1A, 0xC9, 0x71, 0x9C,
+    0x94, 0x9F, 0xFE, 0x09, 0xFF, 0xE5, 0x9C, 0x97, 0x1A, 0xC9, 0x71, 0xDA, 0x71, 0xE7, 0x1D, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAC, 0x95, 0x99, 0x19, 0xC9, 0x19, 0x90, 0x9F, 0xFE, 0x09, 0xEA, 0xDA, 0xAE,
+    0x59, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xCA, 0x71, 0xDA, 0x71, 0xE4, 0x29, 0x3A, 0xEA, 0x09, 0xFC,
+    0x9A, 0xFC, 0xAA, 0xFC, 0xAA, 0xFC, 0xA9, 0xFC, 0x19, 0xE9, 0x00, 0x71, 0xC9, 0x6D, 0xA5, 0xFA,
+    0x3F, 0xD9, 0x1F, 0xDA, 0x1F, 0xC9, 0x2E, 0x94, 0xCA, 0x76, 0x09, 0x91, 0x9E, 0x0A, 0xE0, 0x9E,
+    0x29, 0x10, 0x09, 0x95, 0xA9, 0x0A, 0xDA, 0x3E, 0x9E, 0xA3, 0xEA, 0xAD, 0x93, 0xE9, 0x09, 0x95,
+    0x91, 0x09, 0x95, 0xA9, 0x49, 0x90, 0xAD, 0xA3, 0xE3, 0x9F, 0xDA, 0x29, 0xE9, 0x2A, 0xEA, 0xD9,
+    0x3E, 0x39, 0xDA, 0x09, 0x95, 0x95, 0x99, 0x00, 0x09, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90,
+    0x9A, 0xAA, 0xAA, 0xA0, 0xAC, 0xAA, 0xAA, 0xA0, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x0A, 0xAA, 0xAA, 0xA9, 0x0A, 0xAA, 0xAA, 0xCA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x79, 0xFD, 0x99, 0xFD,
+    0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD, 0x99, 0xC5, 0x9C, 0x59, 0xC5, 0x9C, 0x59, 0xFD, 0x92, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x79, 0xFD, 0x95, 0xC9, 0x5C, 0x95,
+    0xC9, 0x5C, 0x99, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2,
+    0x77, 0x77, 0x1A, 0xEA, 0x79, 0xCA, 0x76, 0x9D, 0xAE, 0x6D, 0x97, 0x6D, 0x91, 0xD9, 0x4A, 0xCA,
+    0x76, 0x9D, 0x29, 0xCA, 0x4D, 0x77, 0x9C, 0xA3, 0xD3, 0xAC, 0xA7, 0x7A, 0xCA, 0x3D, 0x3D, 0x77,
+    0x0A, 0xCA, 0x3D, 0x2A, 0xCA, 0x77, 0x0A, 0xCA, 0x3D, 0x19, 0xD7, 0x71, 0x9C, 0xA3, 0xD1, 0xD9,
+    0x09, 0xAC, 0xA5, 0x9A, 0xCA, 0x92, 0xD2, 0x9C, 0xA0, 0x9D, 0x09, 0xFC, 0x92, 0x9F, 0xC9, 0x1D,
+    0x91, 0xD9, 0x0D, 0x90, 0xD9, 0x09, 0xD2, 0xD9, 0x09, 0xD1, 0x9F, 0xD0, 0xAC, 0xA0, 0x9C, 0xA2,
+    0xD9, 0x09, 0xD2, 0xAC, 0x91, 0x9E, 0xA1, 0xD1, 0xAC, 0x92, 0x9C, 0xA0, 0xAC, 0xA2, 0x9C, 0xA7,
+    0xAC, 0xA1, 0xD9, 0x29, 0xD0, 0xAC, 0x92, 0x9D, 0x7D, 0x2D, 0x92, 0x9D, 0x0A, 0xC9, 0x3D, 0x6A,
+    0xCA, 0x2D, 0x92, 0x9D, 0x0A, 0xC9, 0x3D, 0x59, 0xD3, 0xAC, 0x92, 0x9C, 0xA0, 0xAC, 0xA2, 0x9D,
+    0x5D, 0x93, 0xAC, 0xA2, 0xAC, 0xA0, 0x9C, 0xA2, 0xAC, 0xA4, 0x9D, 0x5D, 0x2D, 0x2D, 0x2D, 0x94,
+    0xD9, 0x5E, 0xAE, 0x2A, 0xDA, 0xE4, 0xAC, 0xA7, 0xFC, 0x4A, 0xF7, 0x72, 0x97, 0x09, 0x30, 0x77,
+    0x77, 0x74, 0xAE, 0xA7, 0x0D, 0x77, 0x71, 0xAF, 0xD6, 0xD9, 0x77, 0x71, 0xD9, 0x1D, 0xA4, 0x9D,
+    0x77, 0x71, 0x9D, 0x29, 0xD4, 0xD9, 0x77, 0x71, 0xAC, 0xA3, 0xD3, 0x9D, 0x77, 0x72, 0xAC, 0xA3,
+    0xD3, 0xD7, 0x77, 0x3A, 0xCA, 0x3D, 0x2A, 0xCA, 0x77, 0x73, 0xAC, 0xA3, 0xD2, 0xD7, 0x77, 0x4A,
+    0xCA, 0x3D, 0x1A, 0xCA, 0x1A, 0xCA, 0x95, 0xAA, 0xAA, 0x59, 0xAC, 0xA2, 0x9D, 0x29, 0xD1, 0xD1,
+    0xFD, 0x3F, 0xD3, 0xAF, 0xC2, 0xDA, 0x1D, 0x90, 0xD9, 0x0E, 0x09, 0xD9, 0x1A, 0xD9, 0x9D, 0xA1,
+    0x9D, 0x90, 0xAD, 0x19, 0xFD, 0x09, 0xD1, 0xD2, 0x9D, 0x1D, 0x92, 0xD1, 0xDA, 0x2D, 0x91, 0x9E,
+    0xA1, 0xD9, 0x09, 0xD3, 0xD1, 0xD3, 0xD9, 0x0D, 0x92, 0xAC, 0xA7, 0x9D, 0x1A, 0xCA, 0x3D, 0x99,
+    0xD3, 0xD9, 0x0D, 0x3A, 0xCA, 0x7D, 0x2A, 0xCA, 0x3D, 0x99, 0xD3, 0xDA, 0x0D, 0x3A, 0xCA, 0x6A,
+    0xCA, 0x2A, 0xCA, 0x3D, 0x99, 0xD3, 0xD9, 0x0D, 0x3A, 0xCA, 0x6D, 0x39, 0xD3, 0xD1, 0xD3, 0xD9,
+    0x0D, 0x3A, 0xCA, 0x5A, 0xCA, 0x39, 0xD2, 0x9D, 0x1D, 0x3D, 0x1D, 0x92, 0xD9, 0x5D, 0x5D, 0x91,
+    0xAC, 0xA1, 0xAC, 0xA1, 0xAD, 0x1A, 0xD1, 0x9D, 0x5A, 0xC9, 0x59, 0xDA, 0xE2, 0x9E, 0xAD, 0x92,
+    0xEA, 0xDA, 0x49, 0xD7, 0xAF, 0x93, 0x9F, 0xA3, 0x9F, 0xA7, 0x72, 0x97, 0x09, 0x97, 0x09, 0x30,
+    0x3D, 0x3D, 0xA2, 0x9D, 0x3D, 0x92, 0x9D, 0x3D, 0x39, 0xCA, 0x39, 0xA4, 0x3D, 0x2D, 0x92, 0xDA,
+    0x1A, 0xD2, 0x9D, 0x2D, 0x3D, 0x91, 0xAC, 0xA2, 0x9D, 0x2D, 0x3D, 0x2A, 0xC9, 0x29, 0xCA, 0x2C,
+    0xA3, 0x9A, 0x29, 0xA4, 0x3D, 0x2D, 0x91, 0xD9, 0x2D, 0xA1, 0xAD, 0x1A, 0xD2, 0x9D, 0x2D, 0x2D,
+    0x92, 0xD9, 0x1A, 0xCA, 0x1A, 0xCA, 0x29, 0xD2, 0xD2, 0xD3, 0xD2, 0xAC, 0x91, 0xAC, 0x92, 0x9C,
+    0xA2, 0xCA, 0x2D, 0x39, 0xA2, 0x9A, 0x29, 0xA4, 0x9D, 0x4D, 0xA3, 0x9D, 0x4A, 0xCA, 0x4D, 0x49,
+    0xCA, 0x4D, 0x5A, 0x90, 0x9D, 0x1A, 0xCA, 0x4D, 0xA1, 0xD9, 0x39, 0xD1, 0xAD, 0x4A, 0xCA, 0x1D,
+    0x94, 0xD1, 0x9D, 0x49, 0xCA, 0x1A, 0xC9, 0x4D, 0x2D, 0x5A, 0x91, 0x9A, 0x00, 0x9D, 0x1A, 0xCA,
+    0x1D, 0x94, 0xDA, 0x1D, 0x90, 0x9D, 0x49, 0xD1, 0xAD, 0x1D, 0xA4, 0xAC, 0xA1, 0xD9, 0x1D, 0x5D,
+    0x19, 0xD1, 0xAC, 0xA4, 0x9C, 0xA1, 0xAC, 0x91, 0xD5, 0xD2, 0xD1, 0x9C, 0xA5, 0xA9, 0x19, 0xA2,
+    0xAA, 0x00, 0x49, 0x72, 0xD7, 0x0A, 0xD9, 0x7C, 0xAD, 0x6A, 0xC0, 0x9C, 0x95, 0xCA, 0x1D, 0x4A,
+    0xC2, 0x9C, 0x93, 0xCA, 0x3D, 0x2A, 0xC4, 0x9C, 0x91, 0xCA, 0x5D, 0x00, 0x49, 0x4D, 0xA2, 0xE2,
+    0xAD, 0x29, 0xD9, 0x19, 0xD9, 0x2A, 0xD4, 0xE4, 0xDA, 0x39, 0xD9, 0x39, 0xD9, 0x3A, 0xC9, 0x60,
+    0x09, 0x4A, 0xD4, 0xE4, 0xDA, 0x39, 0xDA, 0x39, 0xD9, 0x3E, 0x2E, 0x2A, 0xD2, 0x9D, 0x92, 0xDA,
+    0x29, 0xCA, 0x72, 0x77, 0x79, 0x6D, 0x96, 0x91, 0xD9, 0x49, 0xDA, 0x5D, 0x90, 0x9D, 0x93, 0x9D,
+    0x94, 0xDA, 0x29, 0xD9, 0x49, 0x4D, 0xA4, 0x9D, 0x97, 0x0D, 0xA6, 0x9D, 0x96, 0xDA, 0x70, 0x9D,
+    0x94, 0xDA, 0x72, 0x9D, 0x92, 0xDA, 0x74, 0x9D, 0x90, 0xDA, 0x7D, 0x93, 0x9F, 0xA4, 0xDA, 0xAD,
+    0xA4, 0x9E, 0x5E, 0x9D, 0x94, 0xF9, 0x4E, 0x09, 0x94, 0xDA, 0x9D, 0x94, 0x97, 0xDA, 0x19, 0xD9,
+    0x73, 0xDA, 0x39, 0xD9, 0x71, 0xDA, 0x59, 0xD9, 0x7D, 0xA7, 0x9D, 0x95, 0xDA, 0x71, 0x9D, 0x93,
+    0xDA, 0x4D, 0x93, 0x9D, 0x91, 0xDA, 0x49, 0xDA, 0x49, 0xD1, 0x9A, 0x59, 0xDA, 0x59, 0xA7, 0x29,
+    0x97, 0x10, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0xAD, 0x92, 0xE0, 0x9D, 0x92, 0xE0, 0x9D, 0x92,
+    0xAD, 0x09, 0xD3, 0xAD, 0x09, 0xD3, 0xAD, 0x09, 0xD3, 0xAD, 0x1D, 0x3A, 0xD1, 0xD3, 0x9C, 0xA1,
+    0xD3, 0x9C, 0xA1, 0xD3, 0x9C, 0xA1, 0xD3, 0x9C, 0xA1, 0xD3, 0x9C, 0xA1, 0xD4, 0xC9, 0x77, 0x79,
+    0x94, 0xA9, 0x0A, 0xDA, 0x2E, 0x0E, 0xA2, 0xE9, 0xAD, 0x92, 0xE1, 0x99, 0x49, 0x10, 0x76, 0xAF,
+    0xD9, 0x3F, 0xFC, 0xA2, 0xA9, 0x9D, 0x90, 0x9D, 0x94, 0xD9, 0x1A, 0xD4, 0xD3, 0xD4, 0xD3, 0xD4,
+    0xD2, 0x9D, 0x4D, 0x2D, 0xA4, 0xD1, 0xE5, 0xD0, 0xE6, 0xFA, 0x7E, 0xA7, 0x0E, 0x71, 0xDA, 0x71,
+    0xAC, 0x97, 0x77, 0x77, 0x70, 0xDA, 0x70, 0x9E, 0x71, 0xE7, 0x29, 0x60, 0x77, 0x0F, 0xFF, 0xDA,
+    0x0F, 0xFF, 0xDA, 0x77, 0x2C, 0x74, 0x9C, 0x1D, 0x73, 0xCA, 0x2C, 0xA7, 0x1D, 0x4D, 0x95, 0x9D,
+    0x6E, 0xAA, 0xAA, 0xDA, 0x70, 0x9A, 0xFA, 0x94, 0x77, 0x69, 0xFC, 0xA9, 0x79, 0xEA, 0x99, 0xAE,
+    0x59, 0xD6, 0x9D, 0x4C, 0xA7, 0x1D, 0x2D, 0x73, 0xCA, 0x1C, 0x74, 0x9A, 0x77, 0x20, 0x79, 0xA7,
+    0x0D, 0x79, 0xC9, 0x7A, 0xC7, 0x0C, 0xA7, 0xAC, 0x70, 0xCA, 0x79, 0xC9, 0x7D, 0x79, 0xC9, 0x7D,
+    0x70, 0xDA, 0x6A, 0xE6, 0xCA, 0x0C, 0x94, 0xAC, 0x1D, 0x4D, 0x19, 0xC9, 0x29, 0xC9, 0x2C, 0xA2,
+    0xD3, 0xAC, 0x19, 0xC9, 0x4C, 0xA0, 0x77, 0x77, 0x77, 0xDA, 0x77, 0x75, 0xDA, 0x77, 0x75, 0xD9,
+    0x77, 0x75, 0xD9, 0x77, 0x70, 0xCA, 0x91, 0xAC, 0x2A, 0xD7, 0x72, 0x9F, 0xEA, 0xFC, 0x77, 0x3A,
+    0xAF, 0xFA, 0xAA, 0x77, 0x7A, 0xE7, 0x77, 0x39, 0xD9, 0xD7, 0x77, 0x2D, 0xA0, 0xDA, 0x77, 0x70,
+    0xE1, 0x9D, 0x97, 0x76, 0x9D, 0xA2, 0xE7, 0x77, 0x0A, 0x39, 0xA7, 0x72, 0xDA, 0x76, 0xDA, 0x73,
+    0xD9, 0x76, 0xDA, 0x73, 0xD9, 0x76, 0xD9, 0x73, 0xD9, 0x76, 0xD9, 0x6C, 0xA2, 0xAC, 0x29, 0xAA,
+    0x4C, 0xA2, 0xAC, 0x29, 0xAA, 0x09, 0xFA, 0xDA, 0xFC, 0x39, 0xFA, 0xDA, 0xFC, 0x09, 0xFF, 0xFA,
+    0x39, 0xFF, 0xFC, 0x5A, 0xE7, 0x5A, 0xE7, 0x19, 0xDA, 0xCA, 0x74, 0xDA, 0xD7, 0x0D, 0xA0, 0xD9,
+    0x72, 0xDA, 0x0D, 0xA6, 0xAD, 0x1A, 0xD7, 0x1A, 0xD1, 0xAD, 0x94, 0x9D, 0xA2, 0xE7, 0x9D, 0xA2,
+    0xE5, 0x9C, 0x3A, 0xA7, 0x19, 0xC9, 0x2A, 0xA7, 0x77, 0x74, 0xFE, 0x0F, 0xE0, 0x99, 0x99, 0x99,
+    0x90, 0x74, 0xD7, 0x4A, 0xCA, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAC, 0xA7, 0x4D, 0x74, 0xAC, 0x97,
+    0x39, 0xD7, 0x4D, 0x74, 0xAC, 0xA7, 0x4D, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xD7, 0x4A, 0xCA, 0x74,
+    0xD7, 0x4D, 0x97, 0x39, 0xCA, 0x74, 0xD7, 0x4A, 0xCA, 0x73, 0x9D, 0x74, 0xAF, 0xCA, 0xAF, 0xCA,
+    0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xAC, 0xA3, 0xAF, 0xCA, 0xAF, 0xCA, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAD, 0x99, 0x99, 0xAF, 0xCA, 0x9A,
+    0xAA, 0xAA, 0x90, 0x0F, 0xD1, 0xFD, 0x90, 0x99, 0x99, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x39, 0xD9, 0x9F, 0xD9, 0x9F, 0xD9, 0x4D, 0x94, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x90, 0x99, 0x9A, 0xD9, 0x0F, 0xD9, 0x0A,
+    0xAA, 0xAA, 0xA0, 0x77, 0x72, 0xAF, 0xD9, 0x39, 0xFD, 0xA2, 0x9F, 0xFC, 0xA1, 0xFF, 0xD2, 0xD9,
+    0x29, 0xE9, 0x0D, 0xA9, 0x19, 0xAD, 0xA7, 0x1D, 0xA7, 0x0A, 0xD7, 0x1A, 0xD7, 0x09, 0xD7, 0x1A,
+    0xD7, 0x09, 0xD7, 0x1D, 0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x70, 0xDA, 0x79, 0xDA, 0x70, 0xE7, 0xAD,
+    0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xDA, 0x79, 0xD9, 0x70, 0xDA, 0x70, 0xAC, 0xA7, 0x09, 0xD7, 0x1D,
+    0x71, 0xAC, 0xA7, 0x1D, 0x71, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x39, 0x97, 0x19, 0xA7, 0x19, 0xE7,
+    0x0E, 0x70, 0xAE, 0x79, 0xE9, 0x79, 0xE7, 0x0E, 0x71, 0x99, 0x72, 0x96, 0x77, 0x3A, 0xFD, 0x93,
+    0xAD, 0x99, 0xFF, 0xCA, 0x2A, 0xD9, 0x0D, 0x92, 0x9E, 0x91, 0xAD, 0x97, 0x0D, 0xA1, 0xAD, 0x97,
+    0x0A, 0xD1, 0x9D, 0x71, 0xAD, 0x19, 0xD7, 0x1D, 0xA1, 0x9D, 0x70, 0x9D, 0x91, 0x9D, 0x79, 0xDA,
+    0x29, 0xD6, 0xAD, 0xA4, 0xD5, 0xAD, 0xA5, 0xD4, 0x9D, 0x96, 0xD4, 0xAC, 0xA7, 0xD4, 0xD7, 0x0D,
+    0x4D, 0x70, 0xCA, 0x77, 0x77, 0x70, 0x99, 0x70, 0x99, 0x39, 0xE6, 0xE9, 0x2A, 0xE6, 0xEA, 0x29,
+    0xE6, 0xAD, 0x93, 0x99, 0x70, 0x99, 0x00, 0x77, 0x1A, 0xD9, 0x29, 0xFD, 0x92, 0xAD, 0x91, 0xFF,
+    0xD1, 0xAD, 0x91, 0xDA, 0x91, 0x9A, 0xDA, 0x09, 0xD9, 0x71, 0xAD, 0x09, 0xD9, 0x71, 0x9D, 0x09,
+    0xD7, 0x29, 0xD0, 0x9D, 0x72, 0xAD, 0x09, 0xD7, 0x19, 0xDA, 0x1D, 0x70, 0x9E, 0x2D, 0x79, 0xE3,
+    0xD6, 0x9D, 0xA4, 0xD6, 0xDA, 0x5D, 0x59, 0xD6, 0xD5, 0xAC, 0x96, 0xD5, 0xAC, 0x97, 0x77, 0x77,
+    0x29, 0x95, 0x9A, 0x6A, 0xDA, 0x4E, 0x5E, 0xA3, 0x9E, 0x5A, 0xD9, 0x4E, 0x69, 0x96, 0x96, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xD0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA7,
+    0x29, 0xD7, 0x3D, 0x97, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x73, 0xD9, 0x72, 0xE7,
+    0x29, 0xD9, 0x72, 0xDA, 0x72, 0xAD, 0x72, 0x9D, 0x97, 0x2E, 0x70, 0x77, 0x9F, 0xFD, 0xA9, 0x29,
+    0xCA, 0x99, 0xFF, 0x91, 0x9C, 0x91, 0xAF, 0xF1, 0x9C, 0x91, 0xAF, 0xFA, 0x09, 0xC9, 0x1A, 0xFF,
+    0xC0, 0x9C, 0x91, 0xAF, 0xFC, 0x09, 0xC9, 0x1A, 0xFF, 0xC0, 0x9C, 0x91, 0xAF, 0xFC, 0x09, 0xC9,
+    0x1A, 0xFF, 0xC0, 0x9C, 0x91, 0xAF, 0xFC, 0x09, 0xC9, 0x1A, 0xFF, 0xA0, 0x9C, 0x91, 0xAF, 0xF9,
+    0x09, 0xC9, 0x1A, 0xFE, 0xA1, 0x9C, 0x91, 0xAF, 0xDA, 0x29, 0xC9, 0x1A, 0xC0, 0x99, 0x59, 0xC9,
+    0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9,
+    0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x09, 0xC9,
+    0x1A, 0xC7, 0x09, 0xC9, 0x1A, 0xC7, 0x1A, 0x91, 0x9A, 0x70, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x3F, 0xFF, 0x2F, 0xFA, 0x99, 0xD1, 0xAF, 0xF9, 0x1A, 0xC1, 0xFF, 0xC9, 0x1A, 0xC0, 0x9F, 0xFC,
+    0x91, 0xAC, 0x09, 0xFF, 0xC9, 0x1A, 0xC0, 0x9F, 0xFC, 0x91, 0xAC, 0x09, 0xFF, 0xC9, 0x1A, 0xC0,
+    0x9F, 0xFC, 0x91, 0xAC, 0x1F, 0xFC, 0x91, 0xAC, 0x1F, 0xFC, 0x91, 0xAC, 0x19, 0xFF, 0x91, 0xAC,
+    0x2A, 0xFF, 0xF4, 0xAF, 0xFD, 0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x94, 0x9F, 0xFE, 0xA2, 0x9C,
+    0xA9, 0x9F, 0xFA, 0x19, 0xC9, 0x1F, 0xFC, 0x90, 0x9C, 0x91, 0xFF, 0xCA, 0x09, 0xC9, 0x1F, 0xFD,
+    0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFD,
+    0x09, 0xC9, 0x1F, 0xFD, 0x09, 0xC9, 0x1F, 0xFC, 0x90, 0x9C, 0x91, 0xFF, 0xC1, 0x9F, 0xFF, 0x29,
+    0xFF, 0xCA, 0x93, 0x77, 0x29, 0xD9, 0x71, 0x9D, 0x73, 0xD7, 0x3D, 0x59, 0xCA, 0x91, 0xD1, 0x9A,
+    0xCA, 0xAF, 0xAF, 0xEA, 0x9A, 0xAF, 0xFA, 0xA9, 0x4F, 0x70, 0xAC, 0xAD, 0xA6, 0x9D, 0x09, 0xD9,
+    0x5E, 0x1E, 0x4A, 0xD9, 0x19, 0xDA, 0x49, 0xA3, 0xA9, 0x20, 0x59, 0xD9, 0x1A, 0xE1, 0xAE, 0x2D,
+    0x97, 0x77, 0x77, 0x72, 0x99, 0x3D, 0xA2, 0xE2, 0xAD, 0x3D, 0x92, 0xD9, 0x29, 0xCA, 0x3C, 0xA0,
+    0x77, 0x69, 0xFC, 0xA9, 0x79, 0xEA, 0x99, 0xAE, 0x59, 0xD6, 0x9D, 0x4C, 0xA7, 0x1D, 0x2D, 0x73,
+    0xCA, 0x1C, 0x74, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5C, 0x74, 0x9C, 0x1D, 0x73, 0xCA, 0x2C, 0xA7,
+    0x1D, 0x4D, 0x95, 0x9D, 0x6E, 0xAA, 0xAA, 0xDA, 0x70, 0x9A, 0xFA, 0x94, 0x77, 0x29, 0xD9, 0x71,
+    0x9D, 0x73, 0xD7, 0x3D, 0x59, 0xCA, 0x91, 0xD1, 0x9A, 0xCA, 0xAF, 0xAF, 0xEA, 0x9A, 0xAF, 0xFA,
+    0xA9, 0x4F, 0x70, 0xAC, 0xAD, 0xA6, 0x9D, 0x09, 0xD9, 0x5E, 0x1E, 0x4A, 0xD9, 0x19, 0xDA, 0x49,
+    0xA3, 0xA9, 0x77, 0x77, 0x39, 0xD9, 0x71, 0x9D, 0x73, 0xD7, 0x3D, 0x59, 0xCA, 0x91, 0xD1, 0x9A,
+    0xCA, 0xAF, 0xAF, 0xEA, 0x9A, 0xAF, 0xFA, 0xA9, 0x4F, 0x70, 0xAC, 0xAD, 0xA6, 0x9D, 0x09, 0xD9,
+    0x5E, 0x1E, 0x4A, 0xD9, 0x19, 0xDA, 0x49, 0xA3, 0xA9, 0x20, 0x72, 0x9D, 0x93, 0xAC, 0x9A, 0xDA,
+    0x3D, 0x0A, 0xD9, 0x2A, 0xCA, 0x19, 0x93, 0xD9, 0x69, 0xD7, 0xAC, 0xA7, 0xD7, 0x9D, 0x7D, 0x96,
+    0x9D, 0x7A, 0xCA, 0x7D, 0x79, 0xD7, 0xD9, 0x7D, 0x7A, 0xCA, 0x7D, 0x79, 0xD7, 0xD9, 0x29, 0xD9,
+    0x0D, 0x3A, 0xDA, 0xAC, 0xA3, 0x9D, 0x97, 0x20, 0x29, 0xAE, 0xA9, 0x74, 0xAA, 0x1F, 0xFD, 0xA9,
+    0x79, 0xCA, 0x0D, 0xA3, 0x9A, 0xFD, 0xA9, 0x90, 0x9A, 0xD0, 0x9C, 0x97, 0x09, 0xFF, 0xD1, 0x9A,
+    0x74, 0x99, 0xAA, 0xAA, 0x92, 0x69, 0x99, 0x97, 0x29, 0xFE, 0xA7, 0xAD, 0x92, 0x9A, 0xD9, 0x4A,
+    0xC9, 0x7A, 0xC9, 0x29, 0xC9, 0x71, 0xAC, 0x2C, 0xA7, 0x3D, 0x19, 0x75, 0x90, 0x69, 0xA7, 0x5A,
+    0xC7, 0x1C, 0x91, 0xAC, 0x2C, 0xA4, 0xD9, 0x0A, 0xC1, 0xDA, 0x5D, 0x9A, 0xC0, 0xDA, 0x7F, 0xDA,
+    0x70, 0x9F, 0xC9, 0x4F, 0xFF, 0xDA, 0x0A, 0xAA, 0xAA, 0xFC, 0xAA, 0xAA, 0x94, 0xFD, 0x97, 0xDA,
+    0xAC, 0x9D, 0x95, 0xDA, 0x0A, 0xC0, 0x9D, 0x93, 0x9C, 0xA1, 0xAC, 0x19, 0xD4, 0x92, 0xAC, 0x75,
+    0xAC, 0x77, 0x60, 0x77, 0x5A, 0xD9, 0x70, 0xEA, 0x70, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x6D,
+    0xA7, 0x09, 0xE7, 0x09, 0xDA, 0x72, 0x97, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9D, 0x71, 0xEA, 0x70,
+    0xAD, 0x97, 0x19, 0x90, 0x3D, 0x19, 0xD1, 0x9D, 0x19, 0xD3, 0xDA, 0x1D, 0xA1, 0xDA, 0x1D, 0xA2,
+    0x9D, 0x19, 0xD1, 0x9D, 0x19, 0xD3, 0xD9, 0x1D, 0x91, 0xD9, 0x1D, 0x92, 0x9D, 0x19, 0xD1, 0x9C,
+    0xA1, 0x9C, 0xA3, 0xD2, 0xD2, 0xD2, 0xD3, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9C, 0x93, 0x9A,
+    0x2A, 0xA2, 0xAA, 0x2A, 0xA4, 0x77, 0x76, 0xAD, 0x97, 0x71, 0xE9, 0x77, 0x1A, 0xD7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6D, 0x97, 0x5A, 0xD0, 0x9E, 0x75, 0xE9, 0x9D, 0xA7, 0x5A,
+    0xD9, 0x09, 0x97, 0x79, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0x77, 0x2E, 0x97,
+    0x71, 0xAD, 0x97, 0x72, 0x99, 0x71, 0x77, 0x6D, 0xA7, 0x59, 0xD9, 0x9E, 0x75, 0xAD, 0xA0, 0xDA,
+    0x75, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x97, 0x73, 0xAD, 0x97, 0x71, 0xEA,
+    0x77, 0x19, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xD9, 0x75, 0xAD, 0x09,
+    0xE7, 0x5E, 0x99, 0xE7, 0x5E, 0x19, 0x97, 0x79, 0x90, 0x4D, 0xA9, 0xE9, 0xDA, 0x09, 0x97, 0x77,
+    0x77, 0x76, 0x91, 0xDA, 0x9E, 0x0D, 0xA1, 0x90, 0x6A, 0xC9, 0x75, 0xE7, 0x5E, 0x75, 0x9A, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0x97, 0x29, 0x90, 0x9E, 0x70, 0xAD, 0x99, 0xE7, 0x0E, 0xA0,
+    0xDA, 0x70, 0x9D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x97, 0x6E, 0x75, 0xE7, 0x5E, 0x76, 0x97,
+    0x71, 0x99, 0x77, 0x2A, 0xCA, 0x77, 0x2A, 0xCA, 0x74, 0xD9, 0x2A, 0xCA, 0x3D, 0x94, 0xAD, 0xA2,
+    0xAC, 0xA2, 0xAE, 0x4A, 0xDA, 0x2A, 0xCA, 0x29, 0xDA, 0x5A, 0xA3, 0xAC, 0xA3, 0xAA, 0x74, 0xAC,
+    0xA7, 0x72, 0xAC, 0xA7, 0x72, 0xAC, 0xA7, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x0F, 0xFF, 0xFF, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x1A,
+    0xCA, 0x77, 0x2A, 0xCA, 0x77, 0x2A, 0xCA, 0x74, 0x99, 0x3A, 0xCA, 0x39, 0x95, 0x9D, 0xA2, 0xAC,
+    0xA2, 0xAD, 0x94, 0xAD, 0xA2, 0xAC, 0xA2, 0xEA, 0x5D, 0x92, 0xAC, 0xA2, 0x9D, 0x74, 0xAC, 0xA7,
+    0x72, 0xAC, 0xA7, 0x72, 0x9A, 0x97, 0x10, 0x09, 0x1A, 0xD9, 0xEA, 0xAD, 0xA0, 0xA9, 0x77, 0x09,
+    0xD0, 0xEA, 0xEA, 0x9D, 0x77, 0x19, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x3A, 0xD9, 0xEA,
+    0xEA, 0x0C, 0xA7, 0x0A, 0xD9, 0xEA, 0xEA, 0x0A, 0xA5, 0x99, 0x0A, 0xD9, 0xEA, 0xAD, 0xA0, 0x99,
+    0x5A, 0x90, 0xAD, 0xAE, 0xAA, 0xD9, 0x09, 0x90, 0x79, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA2, 0x9F, 0xD9, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79,
+    0xFD, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xC3, 0xC9, 0x9C, 0x3C, 0x99, 0xFD, 0x92, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x70, 0xFD, 0x1A, 0xFA, 0x2F, 0x39, 0xD9,
+    0x4D, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA2, 0x72, 0x99,
+    0x5D, 0x49, 0xD9, 0x3F, 0x2A, 0xFA, 0x1F, 0xD3, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA2, 0x72, 0xAA, 0x4A, 0xDA, 0x2C, 0xA1, 0xAC, 0x1C, 0xA1, 0xAC, 0x2A, 0xDA, 0x4D,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x20, 0x79, 0xEA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x29, 0xFD, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA2, 0x2A, 0xDA, 0x4F, 0xD2, 0xAC, 0xA1, 0xAD, 0x1D, 0x3D, 0x09, 0xD3, 0xAC, 0x99, 0xCA,
+    0x3A, 0xCA, 0x9C, 0xA3, 0x9C, 0xA9, 0xCA, 0x39, 0xCA, 0x9D, 0x3A, 0xCA, 0x0D, 0x3D, 0x90, 0xDA,
+    0x19, 0xD1, 0x9F, 0xD9, 0x29, 0xF9, 0x73, 0x29, 0xC9, 0x0A, 0x39, 0xC0, 0x9C, 0x99, 0xC9, 0x9C,
+    0x99, 0xC9, 0x9C, 0x99, 0xC9, 0x9C, 0x99, 0xC9, 0x0A, 0x00, 0x5A, 0xA6, 0xE5, 0xAE, 0x5C, 0xAD,
+    0x4D, 0x0D, 0x3A, 0xC9, 0x0D, 0x29, 0xCA, 0x1D, 0x2D, 0x2D, 0x1A, 0xDA, 0xAA, 0xDA, 0xAA, 0xFF,
+    0xC5, 0xD7, 0xD7, 0xD1, 0x1A, 0xAA, 0xAA, 0xA9, 0x19, 0xFD, 0xA1, 0xAC, 0x96, 0xAC, 0x7A, 0xC7,
+    0xFD, 0x92, 0xAC, 0xAA, 0xEA, 0x69, 0xD7, 0xD9, 0x6D, 0x90, 0x94, 0xD1, 0xDA, 0xAA, 0xDA, 0x1A,
+    0xFC, 0x97, 0x30, 0x3A, 0xE9, 0x29, 0xFC, 0xA2, 0xD9, 0x5A, 0xC9, 0x6D, 0x69, 0xCA, 0xAF, 0x90,
+    0x9E, 0xA9, 0xAD, 0x09, 0xD3, 0xAC, 0xA9, 0xCA, 0x39, 0xCA, 0x0D, 0x39, 0xCA, 0x0D, 0x92, 0xD9,
+    0x1D, 0xAA, 0xE3, 0xFA, 0x73, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xF9, 0x6D, 0x69, 0xCA, 0x6D,
+    0x69, 0xD6, 0xD9, 0x6D, 0x6A, 0xC9, 0x6D, 0x6A, 0xCA, 0x6D, 0x69, 0xCA, 0x40, 0x2A, 0xDA, 0x93,
+    0xFD, 0x91, 0xD9, 0x2D, 0x1D, 0x3D, 0x1A, 0xCA, 0x19, 0xD2, 0xEA, 0xD3, 0x9F, 0xA2, 0x9D, 0x99,
+    0xDA, 0x1D, 0x3D, 0x99, 0xCA, 0x3A, 0xC9, 0x0D, 0x3D, 0x90, 0xAD, 0xAA, 0xE2, 0xAF, 0xA7, 0x30,
+    0x19, 0xAD, 0xA3, 0x9F, 0xD9, 0x1D, 0x29, 0xD0, 0x9C, 0xA3, 0xAC, 0x99, 0xCA, 0x39, 0xCA, 0x9C,
+    0xA3, 0xAC, 0xA0, 0xDA, 0x99, 0xAD, 0xA0, 0x9F, 0xC9, 0xC9, 0x29, 0x99, 0x0A, 0xC9, 0x6D, 0x6A,
+    0xCA, 0x19, 0xAA, 0xAE, 0x29, 0xF9, 0x74, 0x29, 0x6C, 0xA5, 0xCA, 0x5C, 0xA2, 0xFF, 0x99, 0x9D,
+    0x99, 0x92, 0xCA, 0x5C, 0xA5, 0xA9, 0x20, 0x7F, 0xF9, 0x99, 0x99, 0x99, 0x90, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xFE, 0xA7, 0x99, 0x99, 0x99, 0x99, 0xFF, 0x70, 0x29, 0x93, 0xCA, 0x2D, 0x29, 0xCA, 0x2A,
+    0xC3, 0xD3, 0xD3, 0xCA, 0x3C, 0xA3, 0xCA, 0x3D, 0x3D, 0x3A, 0xC9, 0x3C, 0xA3, 0xAC, 0x4D, 0x60,
+    0x99, 0x3D, 0x29, 0xC9, 0x2D, 0x2A, 0xC2, 0x9C, 0x92, 0xCA, 0x2D, 0x2D, 0x2C, 0xA2, 0xCA, 0x19,
+    0xC9, 0x1A, 0xC2, 0xD1, 0xAC, 0x90, 0x9C, 0xA6, 0x9C, 0x09, 0xEA, 0x19, 0xE9, 0x9A, 0xCA, 0x09,
+    0xD3, 0xAC, 0x09, 0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C,
+    0x09, 0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x1A, 0x49, 0xA0, 0x2A, 0xDA, 0x4F, 0xD2, 0xAC, 0xA1,
+    0xAD, 0x1D, 0x3D, 0x09, 0xD3, 0xAC, 0x99, 0xCA, 0x3A, 0xCA, 0x9C, 0xA3, 0x9C, 0xA9, 0xCA, 0x39,
+    0xCA, 0x9D, 0x3A, 0xCA, 0x0D, 0x3D, 0x90, 0xDA, 0x19, 0xD1, 0x9F, 0xD9, 0x29, 0xF9, 0x73, 0x29,
+    0xAA, 0x1A, 0xE0, 0xDA, 0xDA, 0xC9, 0x0D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+    0x19, 0xAD, 0xA2, 0xFE, 0x90, 0xAA, 0x2A, 0xD6, 0xD6, 0xD5, 0xAC, 0x94, 0x9D, 0x49, 0xD4, 0x9D,
+    0x49, 0xD4, 0x9D, 0x49, 0xFF, 0x9F, 0xF0, 0x1A, 0xEA, 0x92, 0xFE, 0x91, 0xA9, 0x29, 0xD7, 0xD6,
+    0x9D, 0x39, 0x9A, 0xD3, 0xAF, 0x96, 0x9E, 0x7D, 0x96, 0xD9, 0x6D, 0x0A, 0xDA, 0xAA, 0xDA, 0x1A,
+    0xFC, 0x97, 0x30, 0x5A, 0xA6, 0xE5, 0xAE, 0x5C, 0xAD, 0x4D, 0x0D, 0x3A, 0xC9, 0x0D, 0x29, 0xCA,
+    0x1D, 0x2D, 0x2D, 0x1A, 0xDA, 0xAA, 0xDA, 0xAA, 0xFF, 0xC5, 0xD7, 0xD7, 0xD1, 0x1A, 0xAA, 0xAA,
+    0xA9, 0x19, 0xFD, 0xA1, 0xAC, 0x96, 0xAC, 0x7A, 0xC7, 0xFD, 0x92, 0xAC, 0xAA, 0xEA, 0x69, 0xD7,
+    0xD9, 0x6D, 0x90, 0x94, 0xD1, 0xDA, 0xAA, 0xDA, 0x1A, 0xFC, 0x97, 0x30, 0x3A, 0xE9, 0x29, 0xFC,
+    0xA2, 0xD9, 0x5A, 0xC9, 0x6D, 0x69, 0xCA, 0xAF, 0x90, 0x9E, 0xA9, 0xAD, 0x09, 0xD3, 0xAC, 0xA9,
+    0xCA, 0x39, 0xCA, 0x0D, 0x39, 0xCA, 0x0D, 0x92, 0xD9, 0x1D, 0xAA, 0xE3, 0xFA, 0x73, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x0F, 0xF9, 0x6D, 0x69, 0xCA, 0x6D, 0x69, 0xD6, 0xD9, 0x6D, 0x6A, 0xC9, 0x6D,
+    0x6A, 0xCA, 0x6D, 0x69, 0xCA, 0x40, 0x2A, 0xDA, 0x93, 0xFD, 0x91, 0xD9, 0x2D, 0x1D, 0x3D, 0x1A,
+    0xCA, 0x19, 0xD2, 0xEA, 0xD3, 0x9F, 0xA2, 0x9D, 0x99, 0xDA, 0x1D, 0x3D, 0x99, 0xCA, 0x3A, 0xC9,
+    0x0D, 0x3D, 0x90, 0xAD, 0xAA, 0xE2, 0xAF, 0xA7, 0x30, 0x19, 0xAD, 0xA3, 0x9F, 0xD9, 0x1D, 0x29,
+    0xD0, 0x9C, 0xA3, 0xAC, 0x99, 0xCA, 0x39, 0xCA, 0x9C, 0xA3, 0xAC, 0xA0, 0xDA, 0x99, 0xAD, 0xA0,
+    0x9F, 0xC9, 0xC9, 0x29, 0x99, 0x0A, 0xC9, 0x6D, 0x6A, 0xCA, 0x19, 0xAA, 0xAE, 0x29, 0xF9, 0x74,
+    0x29, 0x6C, 0xA5, 0xCA, 0x5C, 0xA2, 0xFF, 0x99, 0x9D, 0x99, 0x92, 0xCA, 0x5C, 0xA5, 0xA9, 0x20,
+    0x7F, 0xF9, 0x99, 0x99, 0x99, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xA7, 0x99, 0x99, 0x99, 0x99,
+    0xFF, 0x70, 0x29, 0x93, 0xCA, 0x2D, 0x29, 0xCA, 0x2A, 0xC3, 0xD3, 0xD3, 0xCA, 0x3C, 0xA3, 0xCA,
+    0x3D, 0x3D, 0x3A, 0xC9, 0x3C, 0xA3, 0xAC, 0x4D, 0x60, 0x99, 0x3D, 0x29, 0xC9, 0x2D, 0x2A, 0xC2,
+    0x9C, 0x92, 0xCA, 0x2D, 0x2D, 0x2C, 0xA2, 0xCA, 0x19, 0xC9, 0x1A, 0xC2, 0xD1, 0xAC, 0x90, 0x9C,
+    0xA6, 0x29, 0xAA, 0xA9, 0x3D, 0xAA, 0xDA, 0x7D, 0x7A, 0xC3, 0xAA, 0xF1, 0x9D, 0x99, 0x9A, 0xC1,
+    0xD3, 0xAC, 0x1C, 0xA3, 0xD1, 0xD9, 0x99, 0xE2, 0xAE, 0x90, 0xC0, 0x19, 0xAC, 0xA9, 0x2A, 0xCA,
+    0xAA, 0xCA, 0x09, 0xC9, 0x29, 0xC9, 0xAC, 0x4C, 0xAF, 0xFA, 0xD9, 0x99, 0x99, 0x99, 0xD6, 0x9C,
+    0x96, 0xDA, 0x99, 0x9A, 0x91, 0x9F, 0xA0, 0x19, 0xAC, 0xA9, 0x3A, 0xDA, 0xAD, 0x19, 0xCA, 0x3D,
+    0x0D, 0x4A, 0xC0, 0xD4, 0x9C, 0x9D, 0x49, 0xC9, 0xD4, 0x9C, 0x99, 0xC9, 0x3D, 0x1D, 0xA9, 0x9D,
+    0x92, 0x9E, 0xA2, 0x0A, 0x93, 0x9A, 0x1A, 0xC3, 0xCA, 0x2D, 0x1D, 0x4C, 0xAA, 0xC5, 0x9D, 0x95,
+    0x9D, 0x95, 0xCA, 0xAC, 0x4D, 0x1D, 0x2A, 0xC3, 0xCA, 0x09, 0xC9, 0x39, 0xC9, 0x19, 0xAC, 0xAA,
+    0x3A, 0xCA, 0xAA, 0xD9, 0x7D, 0x79, 0xC9, 0x69, 0xCA, 0x0F, 0xFA, 0x0D, 0x4C, 0x90, 0xAC, 0x3A,
+    0xC2, 0xD9, 0x9A, 0xCA, 0x3A, 0xE9, 0x10, 0x0A, 0x79, 0xC9, 0x69, 0xC9, 0x69, 0xC9, 0x69, 0xC9,
+    0x9A, 0xAA, 0x91, 0x9C, 0xAC, 0xAA, 0xDA, 0x09, 0xD3, 0xD0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39,
+    0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39, 0xC0, 0x9C,
+    0x49, 0xC0, 0x0A, 0x69, 0xC9, 0x59, 0xC9, 0x59, 0xC9, 0x59, 0xC9, 0x29, 0xA0, 0x9C, 0x91, 0x9C,
+    0xA0, 0x9C, 0x90, 0x9C, 0xA1, 0x9C, 0x99, 0xCA, 0x29, 0xCA, 0xD3, 0x9D, 0xAC, 0x92, 0x9C, 0x90,
+    0xAC, 0x91, 0x9C, 0x91, 0xD1, 0x9C, 0x92, 0xD0, 0x9C, 0x39, 0xCA, 0x0A, 0x09, 0xC9, 0x9C, 0x99,
+    0xC9, 0x9C, 0x99, 0xC9, 0x9C, 0x99, 0xC9, 0x9C, 0x99, 0xC9, 0x9C, 0x99, 0xC9, 0x9C, 0x99, 0xC0,
+    0x0A, 0x09, 0xAC, 0xA2, 0xAA, 0xA9, 0x19, 0xCA, 0xCA, 0xAD, 0x9C, 0xAA, 0xDA, 0x09, 0xD3, 0xD9,
+    0x2A, 0xC0, 0x9C, 0x93, 0xD3, 0x9C, 0x09, 0xC9, 0x3C, 0xA3, 0x9C, 0x09, 0xC9, 0x3C, 0xA3, 0x9C,
+    0x09, 0xC9, 0x3C, 0xA3, 0x9C, 0x09, 0xC9, 0x3C, 0xA3, 0x9C, 0x09, 0xC9, 0x3C, 0xA3, 0x9C, 0x09,
+    0xC4, 0xAA, 0x39, 0xC0, 0x0A, 0x09, 0xAC, 0xA9, 0x19, 0xCA, 0xCA, 0xAD, 0xA0, 0x9D, 0x3D, 0x09,
+    0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39, 0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC9, 0x39,
+    0xC0, 0x9C, 0x93, 0x9C, 0x09, 0xC4, 0x9C, 0x00, 0x0A, 0x09, 0xAC, 0xA9, 0x19, 0xCA, 0xCA, 0xAD,
+    0x90, 0x9D, 0x3D, 0x09, 0xC9, 0x39, 0xC9, 0x9C, 0x94, 0xCA, 0x9C, 0x94, 0xCA, 0x9C, 0x93, 0x9C,
+    0xA9, 0xD3, 0xAC, 0x09, 0xDA, 0x99, 0xAC, 0xA0, 0x9C, 0x9A, 0xE9, 0x19, 0xC9, 0x69, 0xC9, 0x69,
+    0xC9, 0x69, 0xC9, 0x60, 0x19, 0xAC, 0xAA, 0x91, 0xAC, 0xAA, 0xAC, 0xA1, 0xCA, 0x6D, 0x7E, 0x95,
+    0x9A, 0xD9, 0x6D, 0x69, 0xC1, 0xCA, 0x99, 0x9D, 0x1A, 0xFA, 0x10, 0x1A, 0x94, 0xC9, 0x3A, 0xDA,
+    0xA0, 0x9A, 0xDA, 0xA1, 0x9C, 0x93, 0x9C, 0x93, 0x9C, 0x93, 0x9C, 0x93, 0x9C, 0x94, 0xC9, 0x4D,
+    0x99, 0x29, 0xE9, 0x77, 0x1A, 0xFC, 0xA6, 0xFF, 0x5A, 0xD9, 0x29, 0x94, 0x9D, 0x97, 0x2A, 0xD7,
+    0x3E, 0x73, 0xDA, 0x3A, 0xAA, 0xAA, 0xAA, 0x9D, 0xA3, 0xFE, 0xAD, 0xA3, 0xDA, 0x99, 0x99, 0x0E,
+    0x3D, 0x94, 0xAD, 0x3D, 0x95, 0xE2, 0xD9, 0x59, 0xEA, 0xAD, 0xAA, 0xAA, 0xA2, 0x9F, 0xFE, 0x59,
+    0x9D, 0xA9, 0x99, 0x97, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xFE, 0xA6, 0xFE, 0xA0,
+    0x77, 0x69, 0xC9, 0x1C, 0xA7, 0x0A, 0xC1, 0x9C, 0x97, 0x9D, 0xAA, 0xD9, 0x59, 0xFF, 0xD3, 0xAF,
+    0xC9, 0xAE, 0xA2, 0xAE, 0xAC, 0x91, 0xCA, 0x92, 0x9E, 0x0A, 0xC1, 0x9C, 0x93, 0xE1, 0xD1, 0xAC,
+    0x4D, 0xA1, 0xD1, 0xD3, 0x9D, 0x90, 0x9C, 0xA1, 0xD3, 0x9D, 0x19, 0xC9, 0x1C, 0xA3, 0xAD, 0x1A,
+    0xC1, 0x9C, 0x93, 0x9D, 0x1D, 0x1A, 0xC4, 0x9D, 0x1D, 0x1D, 0x5D, 0x99, 0xCA, 0x1D, 0x5E, 0x9C,
+    0x91, 0xCA, 0x5A, 0xF1, 0x9C, 0x96, 0xF1, 0xAC, 0x79, 0xEA, 0x9D, 0x19, 0xA9, 0x39, 0xFF, 0xD9,
+    0x39, 0xCA, 0xFE, 0xA4, 0xAC, 0x19, 0xC9, 0x70, 0xD1, 0xAC, 0x71, 0xAA, 0x1A, 0xA6, 0x77, 0x39,
+    0xAF, 0xCA, 0x94, 0xAF, 0xFC, 0x92, 0xF9, 0x29, 0xAC, 0x2A, 0xDA, 0x72, 0xE7, 0x2A, 0xD7, 0x3E,
+    0x73, 0xDA, 0x73, 0xD9, 0x2A, 0xA0, 0x9A, 0xD9, 0x9D, 0x3D, 0xAF, 0x09, 0xD3, 0xF9, 0x09, 0x09,
+    0xD3, 0xE4, 0x9D, 0x92, 0xDA, 0x5D, 0x92, 0xD9, 0x5D, 0xA2, 0xD9, 0x5A, 0xD2, 0xD9, 0x59, 0xDA,
+    0x1D, 0x96, 0xE9, 0x0D, 0x97, 0xE9, 0xD9, 0x19, 0x93, 0x9F, 0xFD, 0x5A, 0xFE, 0xA7, 0x09, 0x94,
+    0x2F, 0xFE, 0x3F, 0xFE, 0x3D, 0xA9, 0x99, 0x99, 0x99, 0x93, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73,
+    0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73, 0xFF, 0xDA, 0x3F, 0xFD, 0xA3, 0xD9, 0x73, 0xD9,
+    0x73, 0xD9, 0x70, 0x9A, 0xFA, 0xAA, 0xA4, 0xAF, 0xFA, 0x69, 0xD9, 0x73, 0xD9, 0x73, 0xD9, 0x73,
+    0xD9, 0x70, 0x77, 0x59, 0xFD, 0xA6, 0xAF, 0xFC, 0x49, 0xE9, 0x29, 0xC9, 0x4A, 0xD7, 0x4D, 0xA7,
+    0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x1A, 0xFF, 0xD9, 0x3F, 0xFE, 0x95, 0x9D, 0xA7, 0x4D, 0x97,
+    0x1A, 0xAA, 0xEA, 0xAA, 0xAA, 0x4F, 0xFE, 0x93, 0x99, 0x9D, 0xA9, 0x99, 0x99, 0x7D, 0x97, 0x39,
+    0xD7, 0x4D, 0xA7, 0x29, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD, 0xA0,
+    0x76, 0x99, 0x77, 0x39, 0xCA, 0x77, 0x3D, 0x77, 0x39, 0xCA, 0x69, 0xA9, 0x1A, 0xEA, 0x91, 0xDA,
+    0xEA, 0x91, 0xAD, 0x0F, 0xEA, 0x9F, 0xFA, 0x0A, 0xFA, 0x99, 0x9F, 0xD9, 0x99, 0x9E, 0x9A, 0xE5,
+    0xF5, 0xDA, 0xAD, 0xA5, 0xAD, 0x95, 0xEA, 0xD9, 0x5A, 0xD6, 0xAD, 0xAD, 0x6A, 0xD6, 0xAD, 0xAD,
+    0x6E, 0x6A, 0xDA, 0xD5, 0xAE, 0x6A, 0xDA, 0xD5, 0xF6, 0xAD, 0xAD, 0x4A, 0xF6, 0xAD, 0xAD, 0x4D,
+    0xAD, 0x6A, 0xDA, 0xD3, 0x9C, 0xAA, 0xD6, 0xAD, 0xAD, 0x3D, 0x0A, 0xD6, 0xAD, 0xAD, 0x29, 0xCA,
+    0x0A, 0xD6, 0xAD, 0xAD, 0x2D, 0x1A, 0xD6, 0xAD, 0x49, 0xCA, 0x77, 0x3D, 0x77, 0x39, 0xD7, 0x77,
+    0x76, 0x19, 0xDA, 0x5D, 0x49, 0xE5, 0xD4, 0x9E, 0x94, 0xD4, 0x9F, 0x4D, 0x49, 0xCA, 0xD9, 0x3D,
+    0x49, 0xCA, 0xAC, 0xA3, 0xD4, 0x9D, 0x9D, 0x3D, 0x29, 0xAE, 0xAD, 0xAA, 0xAA, 0xDA, 0xA0, 0xAF,
+    0xFF, 0xE9, 0x09, 0xAD, 0x99, 0xD9, 0x99, 0xD9, 0x92, 0x9D, 0x1D, 0xA1, 0xD2, 0x99, 0xAD, 0x99,
+    0xAD, 0x99, 0xD9, 0x90, 0xAF, 0xFF, 0xE9, 0x9A, 0xAD, 0xAA, 0xAE, 0xAD, 0xAA, 0x29, 0xD2, 0x9D,
+    0x0D, 0x49, 0xD3, 0xD9, 0xD4, 0x9D, 0x3A, 0xF4, 0x9D, 0x4F, 0x49, 0xD4, 0xF4, 0x9D, 0x4A, 0xE4,
+    0x9D, 0x5E, 0x20, 0xAF, 0xCA, 0x97, 0x3F, 0xFC, 0x97, 0x1E, 0x99, 0xAF, 0x97, 0x0E, 0x39, 0xE7,
+    0x0E, 0x4A, 0xD9, 0x7E, 0x5D, 0x97, 0xE5, 0xD9, 0x1A, 0xC3, 0xE5, 0xD9, 0x1D, 0x3E, 0x4A, 0xD1,
+    0x9D, 0x3E, 0x39, 0xE9, 0xFE, 0x0E, 0x99, 0xAF, 0x0A, 0xFE, 0x0F, 0xFC, 0x39, 0xD3, 0xFD, 0xA9,
+    0x49, 0xD3, 0xE7, 0x19, 0xD3, 0xE7, 0x19, 0xD3, 0xE7, 0x19, 0xD3, 0xE7, 0x19, 0xD3, 0xE7, 0x19,
+    0xD3, 0xE7, 0x19, 0xD9, 0x2E, 0x72, 0xFC, 0xAE, 0x72, 0x9F, 0xA7, 0x70, 0x91, 0x9F, 0xCA, 0x97,
+    0x5A, 0xFF, 0x97, 0x3A, 0xD9, 0x99, 0xAE, 0x73, 0xAD, 0x39, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xAD,
+    0x4A, 0xD2, 0x9A, 0xEA, 0x1A, 0xD4, 0xAD, 0x19, 0xFE, 0x0A, 0xD4, 0xAD, 0x1D, 0xA9, 0x09, 0xC9,
+    0x0A, 0xD4, 0xDA, 0x09, 0xD6, 0xAD, 0x3A, 0xD1, 0x9D, 0x6A, 0xFF, 0x91, 0x9D, 0xA5, 0xAF, 0xE9,
+    0x3E, 0xA4, 0xAD, 0x99, 0xAD, 0x5F, 0x92, 0xAD, 0x2D, 0xA5, 0xAF, 0x1A, 0xD2, 0xAD, 0x7E, 0xA0,
+    0xAD, 0x3D, 0xA7, 0xE0, 0xAD, 0x3A, 0xD7, 0x9D, 0x0A, 0xD3, 0x9D, 0x96, 0x9D, 0x0A, 0xD4, 0xE0,
+    0xA9, 0x3E, 0x0A, 0xD4, 0x9D, 0x9A, 0xFE, 0x90, 0xAD, 0x5D, 0xA9, 0xFD, 0x97, 0x70, 0x99, 0x40,
+    0x9D, 0x4A, 0xD4, 0x9D, 0x1D, 0x4E, 0x93, 0x9D, 0x1D, 0x4E, 0xA3, 0xAC, 0xA1, 0xD9, 0x3F, 0x3D,
+    0x91, 0xAC, 0xA2, 0x9C, 0xAD, 0x3D, 0x91, 0xAC, 0xA2, 0xAC, 0x9D, 0x3D, 0x29, 0xD2, 0xAC, 0x9A,
+    0xC9, 0x19, 0xD3, 0xD2, 0xD0, 0x9C, 0xA1, 0x9D, 0x3D, 0x2D, 0x09, 0xCA, 0x1A, 0xCA, 0x19, 0xAD,
+    0xAA, 0xAD, 0xAA, 0xDA, 0xAE, 0xA0, 0xAF, 0xFF, 0xFD, 0x90, 0x9A, 0xD9, 0xDA, 0x99, 0xDA, 0x9D,
+    0x99, 0x29, 0xD0, 0xAC, 0x91, 0xAC, 0x90, 0xD5, 0xD0, 0xD2, 0x9C, 0xA0, 0xD5, 0xD0, 0xD3, 0xCA,
+    0x9C, 0xA5, 0xD9, 0xCA, 0x3D, 0x9C, 0x95, 0xAC, 0xAC, 0xA3, 0xDA, 0xC9, 0x59, 0xE9, 0x3A, 0xE6,
+    0x9E, 0x4A, 0xE7, 0xE4, 0x9E, 0x7E, 0x5D, 0xA3, 0x9F, 0xEA, 0xA5, 0x9D, 0xAF, 0xFD, 0x93, 0x9D,
+    0xAD, 0x49, 0xE9, 0x29, 0xDA, 0xD6, 0xE2, 0x9D, 0xAD, 0x69, 0xD2, 0x9D, 0xAD, 0x2A, 0xA2, 0xD9,
+    0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19,
+    0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA,
+    0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2, 0xD2, 0xD9, 0x19, 0xDA, 0xD2,
+    0xD2, 0xAA, 0x91, 0xAD, 0xAD, 0x2D, 0x7D, 0xAA, 0xD2, 0xD6, 0x9D, 0x9A, 0xD2, 0xD5, 0xAE, 0x0A,
+    0xD2, 0xFF, 0xE1, 0xAD, 0x2F, 0xFC, 0x92, 0x77, 0x74, 0xD9, 0x75, 0xD9, 0x7A, 0xAA, 0xAA, 0xAE,
+    0xA9, 0x49, 0xFF, 0xDA, 0x59, 0x99, 0x99, 0x9D, 0xA9, 0x74, 0xD9, 0x59, 0xAD, 0xA9, 0x1D, 0x94,
+    0xFF, 0x0D, 0x93, 0xF9, 0x99, 0xAF, 0x92, 0x9D, 0xA4, 0x9E, 0x92, 0xE6, 0xAD, 0x92, 0xDA, 0x69,
+    0xD9, 0x19, 0xD9, 0x7D, 0x91, 0x9D, 0x97, 0xD9, 0x19, 0xD9, 0x7D, 0x91, 0x9D, 0x97, 0xD9, 0x2D,
+    0x97, 0xD9, 0x2E, 0x69, 0xD9, 0x2A, 0xD6, 0xE9, 0x3E, 0x93, 0xAE, 0x93, 0x9F, 0xF9, 0xD9, 0x49,
+    0xFD, 0x90, 0xAC, 0x97, 0x99, 0x77, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0xF9,
+    0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x77, 0x79, 0xAF, 0xCA, 0x7A, 0xFF, 0xC5, 0xF9,
+    0x19, 0xAC, 0xA4, 0xAD, 0xA7, 0x4E, 0x74, 0x9D, 0x75, 0xE7, 0x39, 0x9D, 0xA9, 0x99, 0x99, 0x94,
+    0x9F, 0xFE, 0xA4, 0xAA, 0xEA, 0xAA, 0xAA, 0xA9, 0x59, 0xD9, 0x74, 0x9D, 0x97, 0x29, 0xFF, 0xE4,
+    0x9F, 0xFD, 0xA7, 0xE7, 0x5A, 0xD7, 0x6D, 0xA7, 0x5A, 0xD9, 0x75, 0xEA, 0x4A, 0xA6, 0xFF, 0xCA,
+    0x7A, 0xFE, 0x97, 0x29, 0x94, 0x2D, 0x96, 0xAD, 0x3D, 0x95, 0xAD, 0x93, 0xD9, 0x49, 0xD9, 0x4D,
+    0x94, 0xDA, 0x5D, 0x93, 0xE6, 0xD9, 0x2A, 0xD7, 0xD9, 0x1A, 0xD9, 0x7D, 0x90, 0x9D, 0x97, 0x0D,
+    0x90, 0xDA, 0x69, 0xAA, 0xFD, 0xAA, 0xAA, 0xAA, 0x1A, 0xFF, 0xFD, 0x29, 0x9F, 0xAD, 0x99, 0x99,
+    0x5E, 0x1D, 0xA7, 0x0D, 0x91, 0x9D, 0x97, 0xD9, 0x2A, 0xD7, 0xD9, 0x3E, 0x6D, 0x93, 0x9D, 0x95,
+    0xD9, 0x4A, 0xD5, 0xD9, 0x5E, 0x4D, 0x95, 0x9D, 0xA3, 0xD9, 0x6A, 0xD9, 0x9F, 0xFF, 0xE0, 0x9F,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x97, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x1A, 0xA7,
+    0x1D, 0xA9, 0xE7, 0x1F, 0xCA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xFA, 0x19, 0x95, 0xE9, 0xDA, 0x0E,
+    0x5D, 0x1F, 0xD7, 0x2F, 0x97, 0x2A, 0xE7, 0x29, 0xFA, 0x71, 0xAD, 0xAD, 0xA7, 0x1D, 0x90, 0xDA,
+    0x71, 0x92, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x60, 0x77, 0x74, 0x9A, 0xFE, 0xA7, 0x71, 0xFF, 0xEA,
+    0x77, 0xAC, 0x99, 0x29, 0xAF, 0x77, 0x70, 0xAD, 0xA7, 0x71, 0xD9, 0x3A, 0xD9, 0x77, 0x9D, 0x5D,
+    0xA7, 0x7A, 0xD5, 0xAD, 0x77, 0xDA, 0x59, 0xD7, 0x7D, 0xA5, 0x9D, 0x97, 0x6D, 0x95, 0x9D, 0x97,
+    0x59, 0xD6, 0x9D, 0x76, 0xAD, 0x6A, 0xD3, 0x9A, 0xAA, 0x95, 0xDA, 0x6E, 0x2A, 0xFD, 0x4D, 0x96,
+    0xDA, 0x1A, 0xDA, 0x9A, 0xE2, 0x9D, 0x6A, 0xD2, 0xD9, 0x29, 0xD2, 0x9D, 0x59, 0xDA, 0x1A, 0xD3,
+    0x9D, 0x2A, 0xD4, 0x9E, 0x2D, 0xA3, 0x9D, 0x2D, 0xA3, 0xAE, 0x3D, 0x93, 0xAD, 0x2D, 0xA9, 0x9A,
+    0xF3, 0x9D, 0xA2, 0xAD, 0x91, 0x9F, 0xFA, 0x49, 0xFF, 0xA2, 0xAF, 0xCA, 0x96, 0xAF, 0xEA, 0x77,
+    0x2D, 0xA1, 0x97, 0x75, 0xD9, 0x77, 0x79, 0xD7, 0x77, 0x0A, 0xD7, 0x77, 0x0A, 0xCA, 0x77, 0x70,
+    0xDA, 0x77, 0x70, 0xD9, 0x71, 0x77, 0x79, 0xF9, 0x71, 0xFD, 0x97, 0xAD, 0x1E, 0x7D, 0x91, 0x9D,
+    0x7D, 0x91, 0x9D, 0x7D, 0x91, 0x9D, 0x7D, 0xA1, 0xAC, 0xA7, 0xAD, 0x1D, 0x97, 0x9D, 0x1D, 0x71,
+    0xD9, 0x9C, 0xA7, 0x1D, 0xAD, 0x97, 0x19, 0xEA, 0x73, 0xE7, 0x93, 0xE7, 0xC2, 0x9E, 0x95, 0xAD,
+    0x1F, 0xC5, 0xE9, 0xAC, 0xA9, 0xD4, 0xFE, 0x1D, 0xA2, 0x9D, 0x0E, 0xA1, 0xAD, 0x2D, 0xA1, 0xD3,
+    0xD9, 0x09, 0xD2, 0xA9, 0x3D, 0xA7, 0x4A, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x4D, 0xA7,
+    0x0A, 0xFC, 0x71, 0x9E, 0xA2, 0x2F, 0xDA, 0x97, 0x0F, 0xFC, 0x96, 0xD9, 0x99, 0x9A, 0xE9, 0x5D,
+    0x93, 0x9E, 0x29, 0xAA, 0xEA, 0xAA, 0xAA, 0xEA, 0xA9, 0xAF, 0xFF, 0xE9, 0x2D, 0x95, 0xDA, 0x4D,
+    0x95, 0xDA, 0x19, 0xAA, 0xDA, 0xAA, 0xAA, 0xAA, 0xDA, 0xA0, 0xAF, 0xFF, 0xE9, 0x2D, 0x94, 0xE5,
+    0xD9, 0x29, 0xE9, 0x5F, 0xFC, 0x96, 0xFE, 0xA7, 0x0D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97,
+    0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x20, 0x77, 0x74, 0xD7, 0x5A, 0xFE, 0xA9, 0x6A, 0xFF, 0xEA,
+    0x4F, 0xA9, 0xD0, 0x9A, 0xD4, 0xEA, 0x2D, 0x70, 0xAD, 0xA3, 0xD7, 0x0E, 0x4D, 0x7A, 0xD9, 0x4D,
+    0x7E, 0x5D, 0x7D, 0xA5, 0xD7, 0xDA, 0x5D, 0x7D, 0xA5, 0xFF, 0x1D, 0xA5, 0xFF, 0x1D, 0xA5, 0xD9,
+    0x99, 0xAD, 0x1E, 0x5D, 0x2A, 0xD1, 0xAD, 0x5D, 0x2A, 0xD1, 0x9D, 0xA4, 0xD2, 0xAD, 0x2E, 0x93,
+    0xD2, 0xAD, 0x29, 0xE9, 0x2D, 0x2A, 0xD3, 0xAE, 0xA9, 0x9D, 0x19, 0xAD, 0x49, 0xFF, 0xFC, 0x6A,
+    0xFF, 0xCA, 0x97, 0x19, 0xD7, 0x70, 0xD7, 0x70, 0x97, 0x6A, 0xD9, 0x75, 0xEA, 0x74, 0x9F, 0x74,
+    0xAF, 0x97, 0x3D, 0x9E, 0x72, 0x9D, 0x09, 0xD7, 0x2E, 0x1D, 0x97, 0x1D, 0x91, 0xE4, 0xAF, 0xFF,
+    0xF9, 0xAF, 0xFF, 0xF9, 0x3D, 0x93, 0xE6, 0xAD, 0x49, 0xD9, 0x2A, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF,
+    0x91, 0xAD, 0x69, 0xD9, 0x3D, 0xA7, 0xDA, 0x29, 0xD9, 0x7A, 0xD2, 0xAD, 0x70, 0x9D, 0x91, 0xDA,
+    0x71, 0xE0, 0x9D, 0x97, 0x1A, 0xD0, 0xE7, 0x3D, 0xA0, 0x77, 0x29, 0xAF, 0xDA, 0x59, 0xFF, 0xD9,
+    0x4D, 0xA9, 0x19, 0xAE, 0x74, 0xAD, 0x97, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xD9, 0x0A, 0xFF, 0xFD,
+    0xAA, 0xFF, 0xFD, 0xA6, 0x9F, 0x97, 0xAF, 0x97, 0xAE, 0xA9, 0x6A, 0xFF, 0xFE, 0xAF, 0xFF, 0xDA,
+    0x09, 0xD7, 0x4A, 0xD7, 0x4A, 0xD7, 0x49, 0xDA, 0x74, 0xEA, 0x93, 0x9A, 0xCA, 0x29, 0xFF, 0xEA,
+    0x4A, 0xFF, 0x97, 0x09, 0x99, 0x50, 0x77, 0x71, 0xAC, 0x97, 0x29, 0xAF, 0xDA, 0x95, 0xFF, 0xE9,
+    0x29, 0xFA, 0xAC, 0x99, 0xAD, 0x3E, 0xA1, 0xAC, 0x96, 0xE9, 0x2A, 0xC9, 0x59, 0xE3, 0xAC, 0x95,
+    0xAD, 0x93, 0xAC, 0x95, 0xE4, 0xAC, 0x95, 0xDA, 0x4A, 0xC9, 0x5D, 0xA4, 0xAC, 0x95, 0xDA, 0x4A,
+    0xC9, 0x5D, 0xA4, 0xAC, 0x95, 0xDA, 0x4A, 0xC9, 0x5E, 0x4A, 0xC9, 0x5A, 0xD4, 0xAC, 0x95, 0x9D,
+    0xA3, 0xAC, 0x96, 0xE3, 0xAC, 0x96, 0x9E, 0x2A, 0xC9, 0x7A, 0xEA, 0x9A, 0xC9, 0x09, 0xAA, 0x4A,
+    0xFF, 0xDA, 0x6A, 0xFF, 0x97, 0x1A, 0xC9, 0x75, 0xAC, 0x97, 0x69, 0x50, 0x39, 0x59, 0x70, 0x9C,
+    0x93, 0x9C, 0x97, 0xAC, 0x93, 0xAC, 0x97, 0xD9, 0x3D, 0x96, 0xAE, 0xAA, 0xAA, 0xEA, 0xAA, 0xA0,
+    0x9F, 0xFF, 0xF1, 0x99, 0xDA, 0x99, 0xAA, 0xDA, 0x99, 0x99, 0x3D, 0x92, 0x9D, 0x97, 0xD9, 0x29,
+    0xD9, 0x7D, 0x92, 0x9D, 0x97, 0xD9, 0x29, 0xD9, 0x7D, 0x92, 0x9D, 0x97, 0xD9, 0x29, 0xD9, 0x7D,
+    0x92, 0x9D, 0x97, 0xD9, 0x29, 0xD9, 0x7D, 0x93, 0xD9, 0x7D, 0x93, 0xD9, 0x7D, 0x93, 0xE7, 0xD9,
+    0x3A, 0xFD, 0x3D, 0x94, 0xAF, 0xC7, 0x59, 0x92, 0x77, 0x75, 0xAF, 0xDA, 0x71, 0x9F, 0xFD, 0x97,
+    0xE9, 0x29, 0xAD, 0x7E, 0x77, 0x0D, 0xA7, 0x70, 0xDA, 0x77, 0x0E, 0x77, 0x0A, 0xD9, 0x77, 0x0E,
+    0xA9, 0x76, 0x9F, 0xC9, 0x76, 0xAF, 0xC9, 0x76, 0x9F, 0xC7, 0x79, 0xF7, 0x70, 0xAD, 0x90, 0x9A,
+    0xA1, 0xAA, 0xA1, 0xAA, 0xA2, 0xDA, 0x0C, 0xAC, 0xAC, 0xAA, 0xCA, 0xCA, 0xAD, 0x1A, 0xD9, 0xC0,
+    0xD9, 0x1D, 0x91, 0xAC, 0x1A, 0xCA, 0x0C, 0xAD, 0x2A, 0xC2, 0x9C, 0x1D, 0x90, 0x9E, 0x2A, 0xC2,
+    0x9C, 0x9E, 0x29, 0xFA, 0xD9, 0x99, 0xAF, 0x4A, 0xCA, 0xFF, 0xD9, 0x5A, 0xC2, 0xAC, 0x99, 0x9A,
+    0xC7, 0xAC, 0x2A, 0xC2, 0x9C, 0x70, 0x93, 0x93, 0x94, 0x9F, 0xFF, 0xD9, 0xAF, 0xFF, 0xD9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A,
+    0xFF, 0xFD, 0x9A, 0xFF, 0xFD, 0x95, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73,
+    0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D,
+    0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x50, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x29, 0xE9,
+    0x71, 0xE7, 0x2D, 0x93, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x5D, 0xA7, 0x0A, 0xD7, 0x0A, 0xDA, 0x4A,
+    0xFC, 0xA5, 0xAE, 0xA7, 0x0D, 0xA7, 0x19, 0xD7, 0x2E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA, 0x71,
+    0xAD, 0x97, 0x1E, 0x71, 0x9D, 0x93, 0x3D, 0x74, 0x9D, 0x74, 0x9D, 0x49, 0x69, 0xD2, 0xAD, 0x69,
+    0xDA, 0xFA, 0x6A, 0xFA, 0x95, 0x9F, 0xC9, 0x70, 0x9C, 0xAA, 0xD2, 0x9A, 0xC6, 0x9D, 0xAA, 0xF6,
+    0x9F, 0xC9, 0x6A, 0xFA, 0x70, 0x9D, 0xAD, 0x6A, 0xD2, 0x9D, 0x6D, 0xA2, 0x9D, 0x6D, 0xA2, 0x9D,
+    0x59, 0xD9, 0x29, 0xD5, 0xAD, 0x39, 0xD4, 0x9D, 0xA3, 0x9D, 0x39, 0xE4, 0x9D, 0x90, 0x9A, 0xE5,
+    0x9F, 0xF6, 0x9F, 0xCA, 0x97, 0x74, 0x77, 0x70, 0xAE, 0x97, 0x70, 0xDA, 0xAD, 0x97, 0x69, 0xCA,
+    0x19, 0xD7, 0x6A, 0xC9, 0x2D, 0x76, 0xAC, 0xA2, 0xD7, 0x7D, 0xA9, 0x9D, 0xA9, 0x99, 0x99, 0x99,
+    0x99, 0x59, 0xFF, 0xFF, 0xCA, 0x59, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAF, 0x7D, 0x72, 0xAC, 0xA6,
+    0xD7, 0x3D, 0x6D, 0x29, 0x7A, 0xC6, 0xD1, 0xD9, 0x09, 0xCA, 0x2A, 0xC6, 0xD9, 0xFA, 0xEA, 0x1A,
+    0xC6, 0xF9, 0x9E, 0x0A, 0xDA, 0xCA, 0x6E, 0x91, 0x9C, 0x29, 0xE6, 0xAE, 0x77, 0x1A, 0xF7, 0x71,
+    0xAA, 0x0A, 0xD7, 0x74, 0xE9, 0x49, 0x74, 0x9F, 0xFC, 0x76, 0xAF, 0xDA, 0x77, 0x29, 0x70, 0x70,
+    0x9D, 0x77, 0x1A, 0xD7, 0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x79, 0xAE,
+    0xA9, 0x97, 0x19, 0xFF, 0xEA, 0x6A, 0xFA, 0xEA, 0xFC, 0x4A, 0xE9, 0x1A, 0xD2, 0xAE, 0x3E, 0x3A,
+    0xD3, 0xAD, 0xA1, 0xAD, 0x4A, 0xD4, 0xE1, 0xE4, 0xAD, 0x49, 0xD9, 0x0D, 0xA4, 0xAD, 0x5D, 0xA0,
+    0xD9, 0x4A, 0xD5, 0xDA, 0x9D, 0x94, 0xAD, 0x5D, 0xA9, 0xD9, 0x75, 0xDA, 0x9D, 0x97, 0x5D, 0xA9,
+    0xD9, 0x75, 0xDA, 0x9D, 0x97, 0x5D, 0xA9, 0xD9, 0x75, 0xDA, 0x2F, 0xEA, 0x96, 0xFF, 0xDA, 0x4D,
+    0xA9, 0x99, 0x9A, 0xEA, 0x3D, 0x95, 0xE9, 0x2D, 0x96, 0xDA, 0x2D, 0x96, 0xE2, 0xD9, 0x6E, 0x2D,
+    0x96, 0xDA, 0x2D, 0x95, 0x9D, 0x92, 0xD9, 0x49, 0xE0, 0x9A, 0xAF, 0xAA, 0xFC, 0x1A, 0xFF, 0xEA,
+    0x29, 0xAA, 0xEA, 0xAA, 0x99, 0x7D, 0x97, 0x4D, 0x97, 0x1A, 0xFF, 0xC5, 0xAF, 0xFC, 0x97, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x71, 0x69, 0x92, 0x97, 0x5A, 0xC1, 0x9C, 0x97, 0x4D, 0xAA,
+    0xAC, 0x97, 0x29, 0xFF, 0xA7, 0x0F, 0xCA, 0xAF, 0xC9, 0x5E, 0xAD, 0x19, 0xCA, 0xE9, 0x3A, 0xD9,
+    0x0A, 0xC1, 0x9C, 0x90, 0xE3, 0xDA, 0x1A, 0xC1, 0x9C, 0x91, 0xDA, 0x1A, 0xD9, 0x1A, 0xC1, 0x9C,
+    0x91, 0xAD, 0x1E, 0x2A, 0xC1, 0x9C, 0x91, 0x9D, 0x90, 0xE2, 0xAC, 0x19, 0xC9, 0x2D, 0xA0, 0xDA,
+    0x2A, 0xC1, 0x9C, 0x92, 0xDA, 0x0D, 0xA2, 0xAC, 0x19, 0xC9, 0x2D, 0xA0, 0xDA, 0x77, 0x0E, 0x77,
+    0x0A, 0xD7, 0x70, 0x9D, 0x97, 0x70, 0xE7, 0x71, 0xDA, 0x77, 0x09, 0xDA, 0x77, 0x09, 0xEA, 0x97,
+    0x3A, 0xFF, 0xFE, 0x92, 0xAF, 0xFF, 0xE9, 0x00, 0x29, 0xC9, 0x09, 0xC7, 0x9C, 0x90, 0xAC, 0x96,
+    0x9C, 0x90, 0xAC, 0x94, 0xFF, 0xA4, 0xFF, 0xD9, 0x2D, 0xA9, 0x99, 0xAF, 0x91, 0xD9, 0x49, 0xE1,
+    0xD9, 0x5E, 0x1D, 0x95, 0xAD, 0x1D, 0x95, 0xE1, 0xD9, 0x5D, 0xA1, 0xD9, 0x39, 0xE2, 0xFF, 0xCA,
+    0x3F, 0xFC, 0xA3, 0xDA, 0x29, 0xAE, 0x91, 0xD9, 0x5E, 0x1D, 0x95, 0x9D, 0x90, 0xD9, 0x6D, 0xA0,
+    0xD9, 0x6D, 0xA0, 0xD9, 0x59, 0xD9, 0x0D, 0x95, 0xE1, 0xDA, 0x29, 0x9E, 0xA1, 0xFF, 0xDA, 0x2F,
+    0xFC, 0x95, 0x9C, 0x90, 0xAC, 0x96, 0x9C, 0x90, 0xAC, 0x96, 0x9C, 0x90, 0x9C, 0x93, 0x39, 0xAF,
+    0xA3, 0xFF, 0xA1, 0xF9, 0x99, 0xAC, 0x90, 0xAD, 0x97, 0xE7, 0x9D, 0x97, 0x9D, 0x70, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x0D, 0xA7, 0x0E, 0x70, 0x9E, 0x93, 0x99, 0x19, 0xFF, 0xA3,
+    0xAF, 0xD9, 0x69, 0x97, 0x69, 0xFF, 0xDA, 0x9F, 0xFD, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x00, 0x77, 0x77,
+    0x7C, 0x97, 0x77, 0xE9, 0x77, 0x5F, 0xC9, 0x77, 0x3F, 0xE9, 0x77, 0x1F, 0xFC, 0x97, 0x7E, 0xAA,
+    0x99, 0xAE, 0x97, 0x5D, 0x96, 0xE9, 0x73, 0xE7, 0x0E, 0x97, 0x1F, 0xA0, 0x9A, 0xCA, 0x2A, 0xE9,
+    0x7F, 0xFE, 0x29, 0xF9, 0x5F, 0xFF, 0x2A, 0xFC, 0x93, 0xFF, 0xF9, 0x2F, 0xE9, 0x1F, 0xFF, 0x92,
+    0xAF, 0xF9, 0x9F, 0xFE, 0x92, 0xAF, 0xFC, 0xA0, 0x9F, 0xFC, 0xA2, 0xFF, 0xDA, 0x29, 0xFF, 0xA1,
+    0x9F, 0xFC, 0xA4, 0x9F, 0xEA, 0x1A, 0xFF, 0xA6, 0x9F, 0xFF, 0xFC, 0xA7, 0x09, 0xFF, 0xFE, 0xA7,
+    0x29, 0xF9, 0x19, 0xFC, 0xA7, 0x49, 0xE3, 0xFA, 0x76, 0x9D, 0x92, 0xEA, 0x77, 0x09, 0xD9, 0x9E,
+    0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x49, 0xEA, 0x77, 0x69, 0xCA, 0x77, 0x70, 0x97, 0x40,
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 4, 22, 8, 2, 21, 22, 0 }, // !
-    { 9, 8, 12, 1, 21, 18, 22 }, // "
-    { 19, 21, 20, 0, 21, 100, 40 }, // #
-    { 15, 25, 17, 1, 23, 94, 140 }, // $
-    { 22, 23, 24, 1, 22, 127, 234 }, // %
-    { 21, 23, 23, 1, 22, 121, 361 }, // &
-    { 4, 8, 7, 1, 21, 8, 482 }, // '
-    { 7, 26, 9, 1, 21, 46, 490 }, // (
-    { 8, 26, 9, 0, 21, 52, 536 }, // )
-    { 14, 14, 16, 1, 23, 49, 588 }, // *
-    { 15, 15, 17, 1, 18, 57, 637 }, // +
-    { 5, 8, 8, 1, 4, 10, 694 }, // ,
-    { 8, 3, 10, 1, 9, 6, 704 }, // -
-    { 4, 5, 8, 2, 4, 5, 710 }, // .
-    { 11, 21, 12, 0, 21, 58, 715 }, // /
-    { 15, 23, 17, 1, 22, 87, 773 }, // 0
-    { 9, 21, 17, 2, 21, 48, 860 }, // 1
-    { 15, 22, 17, 1, 22, 83, 908 }, // 2
-    { 15, 23, 17, 1, 22, 87, 991 }, // 3
-    { 17, 21, 18, 0, 21, 90, 1078 }, // 4
-    { 15, 22, 17, 1, 21, 83, 1168 }, // 5
-    { 15, 23, 17, 1, 22, 87, 1251 }, // 6
-    { 15, 21, 17, 1, 21, 79, 1338 }, // 7
-    { 15, 23, 17, 1, 22, 87, 1417 }, // 8
-    { 15, 23, 17, 1, 22, 87, 1504 }, // 9
-    { 4, 18, 8, 2, 17, 18, 1591 }, // :
-    { 6, 21, 8, 0, 17, 32, 1609 }, // ;
-    { 15, 15, 17, 1, 18, 57, 1641 }, // <
-    { 14, 9, 17, 1, 15, 32, 1698 }, // =
-    { 15, 15, 17, 1, 18, 57, 1730 }, // >
-    { 12, 23, 13, 0, 22, 69, 1787 }, // ?
-    { 24, 24, 26, 1, 21, 144, 1856 }, // @
-    { 19, 21, 20, 0, 21, 100, 2000 }, // A
-    { 16, 21, 19, 2, 21, 84, 2100 }, // B
-    { 17, 23, 19, 1, 22, 98, 2184 }, // C
-    { 18, 21, 21, 2, 21, 95, 2282 }, // D
-    { 13, 21, 16, 2, 21, 69, 2377 }, // E
-    { 13, 21, 16, 2, 21, 69, 2446 }, // F
-    { 19, 23, 21, 1, 22, 110, 2515 }, // G
-    { 17, 21, 22, 2, 21, 90, 2625 }, // H
-    { 8, 21, 10, 1, 21, 42, 2715 }, // I
-    { 9, 27, 8, -3, 21, 61, 2757 }, // J
-    { 17, 21, 20, 2, 21, 90, 2818 }, // K
-    { 13, 21, 16, 2, 21, 69, 2908 }, // L
-    { 22, 21, 26, 2, 21, 116, 2977 }, // M
-    { 18, 21, 22, 2, 21, 95, 3093 }, // N
-    { 20, 23, 23, 1, 22, 115, 3188 }, // O
-    { 15, 21, 18, 2, 21, 79, 3303 }, // P
-    { 20, 27, 23, 1, 22, 135, 3382 }, // Q
-    { 16, 21, 19, 2, 21, 84, 3517 }, // R
-    { 14, 23, 16, 1, 22, 81, 3601 }, // S
-    { 16, 21, 17, 0, 21, 84, 3682 }, // T
-    { 17, 22, 21, 2, 21, 94, 3766 }, // U
-    { 18, 21, 19, 0, 21, 95, 3860 }, // V
-    { 27, 21, 28, 0, 21, 142, 3955 }, // W
-    { 17, 21, 18, 0, 21, 90, 4097 }, // X
-    { 17, 21, 18, 0, 21, 90, 4187 }, // Y
-    { 15, 21, 17, 1, 21, 79, 4277 }, // Z
-    { 7, 26, 10, 2, 21, 46, 4356 }, // [
-    { 11, 21, 12, 0, 21, 58, 4402 }, // <backslash>
-    { 8, 26, 10, 0, 21, 52, 4460 }, // ]
-    { 15, 14, 17, 1, 21, 53, 4512 }, // ^
-    { 15, 3, 15, -1, -2, 12, 4565 }, // _
-    { 7, 6, 9, 1, 23, 11, 4577 }, // `
-    { 13, 17, 16, 1, 16, 56, 4588 }, // a
-    { 15, 24, 18, 2, 23, 90, 4644 }, // b
-    { 13, 17, 15, 1, 16, 56, 4734 }, // c
-    { 15, 24, 18, 1, 23, 90, 4790 }, // d
-    { 14, 17, 16, 1, 16, 60, 4880 }, // e
-    { 12, 23, 13, 0, 23, 69, 4940 }, // f
-    { 15, 23, 18, 1, 16, 87, 5009 }, // g
-    { 14, 23, 18, 2, 23, 81, 5096 }, // h
-    { 4, 22, 8, 2, 22, 22, 5177 }, // i
-    { 8, 29, 8, -2, 22, 58, 5199 }, // j
-    { 14, 23, 17, 2, 23, 81, 5257 }, // k
-    { 4, 23, 8, 2, 23, 23, 5338 }, // l
-    { 23, 16, 27, 2, 16, 92, 5361 }, // m
-    { 14, 16, 18, 2, 16, 56, 5453 }, // n
-    { 16, 17, 18, 1, 16, 68, 5509 }, // o
-    { 15, 23, 18, 2, 16, 87, 5577 }, // p
-    { 15, 23, 18, 1, 16, 87, 5664 }, // q
-    { 10, 16, 13, 2, 16, 40, 5751 }, // r
-    { 12, 17, 14, 1, 16, 51, 5791 }, // s
-    { 10, 21, 11, 0, 20, 53, 5842 }, // t
-    { 14, 17, 18, 2, 16, 60, 5895 }, // u
-    { 15, 16, 16, 0, 16, 60, 5955 }, // v
-    { 23, 16, 24, 0, 16, 92, 6015 }, // w
-    { 15, 16, 16, 0, 16, 60, 6107 }, // x
-    { 15, 23, 16, 0, 16, 87, 6167 }, // y
-    { 12, 16, 14, 1, 16, 48, 6254 }, // z
-    { 11, 26, 12, 0, 21, 72, 6302 }, // {
-    { 4, 31, 16, 6, 23, 31, 6374 }, // |
-    { 11, 26, 12, 0, 21, 72, 6405 }, // }
-    { 15, 5, 17, 1, 13, 19, 6477 }, // ~
-    { 0, 0, 8, 0, 0, 0, 6496 }, //  
-    { 4, 22, 8, 2, 16, 22, 6496 }, // ¡
-    { 13, 23, 17, 2, 22, 75, 6518 }, // ¢
-    { 16, 22, 17, 0, 22, 88, 6593 }, // £
-    { 14, 14, 17, 1, 17, 49, 6681 }, // ¤
-    { 17, 21, 18, 0, 21, 90, 6730 }, // ¥
-    { 4, 31, 16, 6, 23, 31, 6820 }, // ¦
-    { 13, 24, 15, 1, 23, 78, 6851 }, // §
-    { 9, 4, 17, 4, 22, 9, 6929 }, // ¨
-    { 22, 23, 24, 1, 22, 127, 6938 }, // ©
-    { 9, 11, 10, 0, 22, 25, 7065 }, // ª
-    { 13, 13, 15, 1, 14, 43, 7090 }, // «
-    { 15, 9, 17, 1, 12, 34, 7133 }, // ¬
-    { 8, 3, 10, 1, 9, 6, 7167 }, // ­
-    { 22, 23, 24, 1, 22, 127, 7173 }, // ®
-    { 16, 3, 16, -1, 25, 12, 7300 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 7312 }, // °
-    { 15, 18, 17, 1, 18, 68, 7337 }, // ±
-    { 9, 13, 10, 0, 25, 30, 7405 }, // ²
-    { 10, 14, 11, 0, 25, 35, 7435 }, // ³
-    { 7, 6, 9, 1, 23, 11, 7470 }, // ´
-    { 14, 23, 18, 2, 16, 81, 7481 }, // µ
-    { 16, 27, 19, 1, 23, 108, 7562 }, // ¶
-    { 4, 5, 8, 2, 13, 5, 7670 }, // ·
-    { 7, 7, 8, 0, 0, 13, 7675 }, // ¸
-    { 6, 13, 10, 1, 25, 20, 7688 }, // ¹
-    { 11, 11, 12, 0, 22, 31, 7708 }, // º
-    { 13, 13, 15, 1, 14, 43, 7739 }, // »
-    { 22, 21, 23, 0, 21, 116, 7782 }, // ¼
-    { 22, 21, 23, 0, 21, 116, 7898 }, // ½
-    { 23, 22, 24, 0, 22, 127, 8014 }, // ¾
-    { 13, 22, 14, 0, 16, 72, 8141 }, // ¿
-    { 19, 28, 20, 0, 28, 133, 8213 }, // À
-    { 19, 28, 20, 0, 28, 133, 8346 }, // Á
-    { 19, 28, 20, 0, 28, 133, 8479 }, // Â
-    { 19, 27, 20, 0, 27, 129, 8612 }, // Ã
-    { 19, 27, 20, 0, 27, 129, 8741 }, // Ä
-    { 19, 26, 20, 0, 26, 124, 8870 }, // Å
-    { 25, 21, 26, -1, 21, 132, 8994 }, // Æ
-    { 17, 29, 19, 1, 22, 124, 9126 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 9250 }, // È
-    { 13, 28, 16, 2, 28, 91, 9341 }, // É
-    { 13, 28, 16, 2, 28, 91, 9432 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 9523 }, // Ë
-    { 8, 28, 10, 1, 28, 56, 9611 }, // Ì
-    { 9, 28, 11, 1, 28, 63, 9667 }, // Í
-    { 10, 28, 11, 0, 28, 70, 9730 }, // Î
-    { 10, 27, 11, 0, 27, 68, 9800 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 9868 }, // Ð
-    { 18, 27, 22, 2, 27, 122, 9973 }, // Ñ
-    { 20, 29, 23, 1, 28, 145, 10095 }, // Ò
-    { 20, 29, 23, 1, 28, 145, 10240 }, // Ó
-    { 20, 29, 23, 1, 28, 145, 10385 }, // Ô
-    { 20, 28, 23, 1, 27, 140, 10530 }, // Õ
-    { 20, 28, 23, 1, 27, 140, 10670 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 10810 }, // ×
-    { 20, 23, 23, 1, 22, 115, 10859 }, // Ø
-    { 17, 29, 21, 2, 28, 124, 10974 }, // Ù
-    { 17, 29, 21, 2, 28, 124, 11098 }, // Ú
-    { 17, 29, 21, 2, 28, 124, 11222 }, // Û
-    { 17, 28, 21, 2, 27, 119, 11346 }, // Ü
-    { 17, 28, 18, 0, 28, 119, 11465 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 11584 }, // Þ
-    { 16, 24, 19, 2, 23, 96, 11663 }, // ß
-    { 13, 24, 16, 1, 23, 78, 11759 }, // à
-    { 13, 24, 16, 1, 23, 78, 11837 }, // á
-    { 13, 24, 16, 1, 23, 78, 11915 }, // â
-    { 13, 23, 16, 1, 22, 75, 11993 }, // ã
-    { 13, 23, 16, 1, 22, 75, 12068 }, // ä
-    { 13, 25, 16, 1, 24, 82, 12143 }, // å
-    { 23, 17, 25, 1, 16, 98, 12225 }, // æ
-    { 13, 23, 15, 1, 16, 75, 12323 }, // ç
-    { 14, 24, 16, 1, 23, 84, 12398 }, // è
-    { 14, 24, 16, 1, 23, 84, 12482 }, // é
-    { 14, 24, 16, 1, 23, 84, 12566 }, // ê
-    { 14, 23, 16, 1, 22, 81, 12650 }, // ë
-    { 7, 23, 8, -1, 23, 41, 12731 }, // ì
-    { 7, 23, 10, 2, 23, 41, 12772 }, // í
-    { 11, 23, 10, -2, 23, 64, 12813 }, // î
-    { 9, 22, 9, -1, 22, 50, 12877 }, // ï
-    { 16, 24, 18, 1, 23, 96, 12927 }, // ð
-    { 14, 22, 18, 2, 22, 77, 13023 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 13100 }, // ò
-    { 16, 24, 18, 1, 23, 96, 13196 }, // ó
-    { 16, 24, 18, 1, 23, 96, 13292 }, // ô
-    { 16, 23, 18, 1, 22, 92, 13388 }, // õ
-    { 16, 23, 18, 1, 22, 92, 13480 }, // ö
-    { 15, 14, 17, 1, 17, 53, 13572 }, // ÷
-    { 16, 18, 18, 1, 17, 72, 13625 }, // ø
-    { 14, 24, 18, 2, 23, 84, 13697 }, // ù
-    { 14, 24, 18, 2, 23, 84, 13781 }, // ú
-    { 14, 24, 18, 2, 23, 84, 13865 }, // û
-    { 14, 23, 18, 2, 22, 81, 13949 }, // ü
-    { 15, 30, 16, 0, 23, 113, 14030 }, // ý
-    { 15, 30, 18, 2, 23, 113, 14143 }, // þ
-    { 15, 29, 16, 0, 22, 109, 14256 }, // ÿ
-    { 19, 25, 20, 0, 25, 119, 14365 }, // Ā
-    { 13, 21, 16, 1, 20, 69, 14484 }, // ā
-    { 19, 27, 20, 0, 27, 129, 14553 }, // Ă
-    { 13, 23, 16, 1, 22, 75, 14682 }, // ă
-    { 19, 28, 20, 0, 21, 133, 14757 }, // Ą
-    { 14, 23, 16, 1, 16, 81, 14890 }, // ą
-    { 17, 29, 19, 1, 28, 124, 14971 }, // Ć
-    { 13, 24, 15, 1, 23, 78, 15095 }, // ć
-    { 17, 29, 19, 1, 28, 124, 15173 }, // Ĉ
-    { 13, 24, 15, 1, 23, 78, 15297 }, // ĉ
-    { 17, 28, 19, 1, 27, 119, 15375 }, // Ċ
-    { 13, 23, 15, 1, 22, 75, 15494 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 15569 }, // Č
-    { 13, 24, 15, 1, 23, 78, 15693 }, // č
-    { 18, 28, 21, 2, 28, 126, 15771 }, // Ď
-    { 20, 24, 22, 1, 23, 120, 15897 }, // ď
-    { 20, 21, 21, 0, 21, 105, 16017 }, // Đ
-    { 17, 24, 19, 1, 23, 102, 16122 }, // đ
-    { 13, 25, 16, 2, 25, 82, 16224 }, // Ē
-    { 14, 21, 16, 1, 20, 74, 16306 }, // ē
-    { 13, 27, 16, 2, 27, 88, 16380 }, // Ĕ
-    { 14, 23, 16, 1, 22, 81, 16468 }, // ĕ
-    { 13, 27, 16, 2, 27, 88, 16549 }, // Ė
-    { 14, 23, 16, 1, 22, 81, 16637 }, // ė
-    { 13, 28, 16, 2, 21, 91, 16718 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 16809 }, // ę
-    { 13, 28, 16, 2, 28, 91, 16890 }, // Ě
-    { 14, 24, 16, 1, 23, 84, 16981 }, // ě
-    { 19, 29, 21, 1, 28, 138, 17065 }, // Ĝ
-    { 15, 30, 18, 1, 23, 113, 17203 }, // ĝ
-    { 19, 28, 21, 1, 27, 133, 17316 }, // Ğ
-    { 15, 29, 18, 1, 22, 109, 17449 }, // ğ
-    { 19, 28, 21, 1, 27, 133, 17558 }, // Ġ
-    { 15, 29, 18, 1, 22, 109, 17691 }, // ġ
-    { 19, 29, 21, 1, 22, 138, 17800 }, // Ģ
-    { 15, 30, 18, 1, 23, 113, 17938 }, // ģ
-    { 17, 28, 22, 2, 28, 119, 18051 }, // Ĥ
-    { 18, 30, 18, -2, 30, 135, 18170 }, // ĥ
-    { 22, 21, 23, 0, 21, 116, 18305 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 18421 }, // ħ
-    { 12, 27, 12, -1, 27, 81, 18513 }, // Ĩ
-    { 12, 22, 11, -2, 22, 66, 18594 }, // ĩ
-    { 10, 25, 11, 0, 25, 63, 18660 }, // Ī
-    { 10, 20, 10, -1, 20, 50, 18723 }, // ī
-    { 10, 27, 11, 0, 27, 68, 18773 }, // Ĭ
-    { 10, 22, 10, -1, 22, 55, 18841 }, // ĭ
-    { 8, 28, 10, 1, 21, 56, 18896 }, // Į
-    { 6, 29, 8, 0, 22, 44, 18952 }, // į
-    { 8, 27, 10, 1, 27, 54, 18996 }, // İ
-    { 4, 16, 8, 2, 16, 16, 19050 }, // ı
-    { 15, 27, 18, 1, 21, 102, 19066 }, // Ĳ
-    { 11, 29, 15, 2, 22, 80, 19168 }, // ĳ
-    { 12, 34, 10, -3, 28, 102, 19248 }, // Ĵ
-    { 11, 30, 10, -2, 23, 83, 19350 }, // ĵ
-    { 17, 28, 20, 2, 21, 119, 19433 }, // Ķ
-    { 14, 30, 17, 2, 23, 105, 19552 }, // ķ
-    { 14, 16, 17, 2, 16, 56, 19657 }, // ĸ
-    { 13, 28, 16, 2, 28, 91, 19713 }, // Ĺ
-    { 7, 30, 10, 2, 30, 53, 19804 }, // ĺ
-    { 13, 28, 16, 2, 21, 91, 19857 }, // Ļ
-    { 5, 30, 8, 1, 23, 38, 19948 }, // ļ
-    { 13, 21, 16, 2, 21, 69, 19986 }, // Ľ
-    { 8, 23, 11, 2, 23, 46, 20055 }, // ľ
-    { 13, 21, 16, 2, 21, 69, 20101 }, // Ŀ
-    { 8, 23, 11, 2, 23, 46, 20170 }, // ŀ
-    { 15, 21, 16, 0, 21, 79, 20216 }, // Ł
-    { 9, 23, 9, -1, 23, 52, 20295 }, // ł
-    { 18, 28, 22, 2, 28, 126, 20347 }, // Ń
-    { 14, 23, 18, 2, 23, 81, 20473 }, // ń
-    { 18, 28, 22, 2, 21, 126, 20554 }, // Ņ
-    { 14, 23, 18, 2, 16, 81, 20680 }, // ņ
-    { 18, 28, 22, 2, 28, 126, 20761 }, // Ň
-    { 14, 23, 18, 2, 23, 81, 20887 }, // ň
-    { 18, 21, 20, 0, 21, 95, 20968 }, // ŉ
-    { 18, 27, 22, 2, 21, 122, 21063 }, // Ŋ
-    { 14, 23, 18, 2, 16, 81, 21185 }, // ŋ
-    { 20, 26, 23, 1, 25, 130, 21266 }, // Ō
-    { 16, 21, 18, 1, 20, 84, 21396 }, // ō
-    { 20, 28, 23, 1, 27, 140, 21480 }, // Ŏ
-    { 16, 23, 18, 1, 22, 92, 21620 }, // ŏ
-    { 20, 29, 23, 1, 28, 145, 21712 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 21857 }, // ő
-    { 25, 23, 27, 1, 22, 144, 21953 }, // Œ
-    { 26, 17, 28, 1, 16, 111, 22097 }, // œ
-    { 16, 28, 19, 2, 28, 112, 22208 }, // Ŕ
-    { 10, 23, 13, 2, 23, 58, 22320 }, // ŕ
-    { 16, 28, 19, 2, 21, 112, 22378 }, // Ŗ
-    { 11, 23, 13, 1, 16, 64, 22490 }, // ŗ
-    { 16, 28, 19, 2, 28, 112, 22554 }, // Ř
-    { 10, 23, 13, 2, 23, 58, 22666 }, // ř
-    { 14, 29, 16, 1, 28, 102, 22724 }, // Ś
-    { 12, 24, 14, 1, 23, 72, 22826 }, // ś
-    { 14, 29, 16, 1, 28, 102, 22898 }, // Ŝ
-    { 12, 24, 14, 1, 23, 72, 23000 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 23072 }, // Ş
-    { 12, 23, 14, 1, 16, 69, 23174 }, // ş
-    { 14, 29, 16, 1, 28, 102, 23243 }, // Š
-    { 12, 24, 14, 1, 23, 72, 23345 }, // š
-    { 16, 28, 17, 0, 21, 112, 23417 }, // Ţ
-    { 10, 27, 11, 0, 20, 68, 23529 }, // ţ
-    { 16, 28, 17, 0, 28, 112, 23597 }, // Ť
-    { 14, 24, 15, 0, 23, 84, 23709 }, // ť
-    { 16, 21, 17, 0, 21, 84, 23793 }, // Ŧ
-    { 10, 21, 11, 0, 20, 53, 23877 }, // ŧ
-    { 17, 28, 21, 2, 27, 119, 23930 }, // Ũ
-    { 14, 23, 18, 2, 22, 81, 24049 }, // ũ
-    { 17, 26, 21, 2, 25, 111, 24130 }, // Ū
-    { 14, 21, 18, 2, 20, 74, 24241 }, // ū
-    { 17, 28, 21, 2, 27, 119, 24315 }, // Ŭ
-    { 14, 23, 18, 2, 22, 81, 24434 }, // ŭ
-    { 17, 30, 21, 2, 29, 128, 24515 }, // Ů
-    { 14, 25, 18, 2, 24, 88, 24643 }, // ů
-    { 17, 29, 21, 2, 28, 124, 24731 }, // Ű
-    { 14, 24, 18, 2, 23, 84, 24855 }, // ű
-    { 17, 28, 21, 2, 21, 119, 24939 }, // Ų
-    { 14, 23, 18, 2, 16, 81, 25058 }, // ų
-    { 27, 28, 28, 0, 28, 189, 25139 }, // Ŵ
-    { 23, 23, 24, 0, 23, 133, 25328 }, // ŵ
-    { 17, 28, 18, 0, 28, 119, 25461 }, // Ŷ
-    { 15, 30, 16, 0, 23, 113, 25580 }, // ŷ
-    { 17, 27, 18, 0, 27, 115, 25693 }, // Ÿ
-    { 15, 28, 17, 1, 28, 105, 25808 }, // Ź
-    { 12, 23, 14, 1, 23, 69, 25913 }, // ź
-    { 15, 27, 17, 1, 27, 102, 25982 }, // Ż
-    { 12, 22, 14, 1, 22, 66, 26084 }, // ż
-    { 15, 28, 17, 1, 28, 105, 26150 }, // Ž
-    { 12, 23, 14, 1, 23, 69, 26255 }, // ž
-    { 9, 23, 12, 2, 23, 52, 26324 }, // ſ
-    { 23, 24, 25, 1, 23, 138, 26376 }, // Ơ
-    { 18, 20, 20, 1, 19, 90, 26514 }, // ơ
-    { 28, 23, 31, 1, 22, 161, 26604 }, // Ƣ
-    { 22, 23, 25, 1, 16, 127, 26765 }, // ƣ
-    { 19, 21, 20, 0, 21, 100, 26892 }, // Ƥ
-    { 15, 30, 18, 2, 23, 113, 26992 }, // ƥ
-    { 16, 24, 19, 2, 21, 96, 27105 }, // Ʀ
-    { 14, 23, 16, 1, 22, 81, 27201 }, // Ƨ
-    { 12, 17, 14, 1, 16, 51, 27282 }, // ƨ
-    { 15, 21, 17, 1, 21, 79, 27333 }, // Ʃ
-    { 13, 30, 13, -1, 23, 98, 27412 }, // ƪ
-    { 10, 27, 11, 0, 20, 68, 27510 }, // ƫ
-    { 17, 21, 18, 0, 21, 90, 27578 }, // Ƭ
-    { 10, 24, 11, 0, 23, 60, 27668 }, // ƭ
-    { 16, 28, 17, 0, 21, 112, 27728 }, // Ʈ
-    { 22, 24, 25, 2, 23, 132, 27840 }, // Ư
-    { 19, 20, 22, 2, 19, 95, 27972 }, // ư
-    { 7, 6, 0, -15, 23, 11, 28067 }, // ̀
-    { 7, 6, 0, -10, 23, 11, 28078 }, // ́
-    { 10, 6, 6, -5, 23, 15, 28089 }, // ̂
-    { 12, 5, 0, -15, 22, 15, 28104 }, // ̃
-    { 10, 3, 6, -5, 20, 8, 28119 }, // ̄
-    { 14, 3, 8, -7, 25, 11, 28127 }, // ̅
-    { 10, 5, 6, -5, 22, 13, 28138 }, // ̆
-    { 4, 4, 3, -2, 22, 4, 28151 }, // ̇
-    { 10, 4, 6, -5, 22, 10, 28155 }, // ̈
-    { 6, 7, 0, -11, 24, 11, 28165 }, // ̉
-    { 8, 7, 5, -4, 24, 14, 28176 }, // ̊
-    { 11, 6, 8, -4, 23, 17, 28190 }, // ̋
-    { 10, 6, 6, -5, 23, 15, 28207 }, // ̌
-    { 4, 6, 3, -2, 23, 6, 28222 }, // ̍
-    { 8, 6, 5, -4, 23, 12, 28228 }, // ̎
-    { 12, 6, 0, -16, 23, 18, 28240 }, // ̏
-    { 10, 8, 6, -5, 25, 20, 28258 }, // ̐
-    { 10, 5, 6, -5, 22, 13, 28278 }, // ̑
-    { 6, 8, 4, -3, 21, 12, 28291 }, // ̒
-    { 6, 8, 4, -3, 21, 12, 28303 }, // ̓
-    { 6, 8, 4, -3, 21, 12, 28315 }, // ̔
-    { 6, 8, 4, -3, 21, 12, 28327 }, // ̕
-    { 6, 6, 4, -3, -1, 9, 28339 }, // ̖
-    { 6, 6, 4, -3, -1, 9, 28348 }, // ̗
-    { 6, 7, 4, -3, 0, 11, 28357 }, // ̘
-    { 6, 7, 4, -3, 0, 11, 28368 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 28379 }, // ̚
-    { 7, 7, 5, -3, 23, 13, 28395 }, // ̛
-    { 4, 7, 3, -2, 0, 7, 28408 }, // ̜
-    { 8, 6, 5, -4, -1, 12, 28415 }, // ̝
-    { 8, 6, 5, -4, -1, 12, 28427 }, // ̞
-    { 8, 7, 5, -4, 0, 14, 28439 }, // ̟
-    { 8, 3, 5, -4, -3, 6, 28453 }, // ̠
-    { 6, 9, 1, -6, 2, 14, 28459 }, // ̡
-    { 6, 9, 7, 0, 2, 14, 28473 }, // ̢
-    { 4, 5, 0, -11, -1, 5, 28487 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 28492 }, // ̤
-    { 8, 7, 5, -4, 0, 14, 28502 }, // ̥
-    { 4, 6, 3, -2, -1, 6, 28516 }, // ̦
-    { 6, 7, 4, -3, 0, 11, 28522 }, // ̧
-    { 6, 8, 4, -3, 1, 12, 28533 }, // ̨
-    { 4, 6, 3, -2, 0, 6, 28545 }, // ̩
-    { 12, 6, 7, -6, -1, 18, 28551 }, // ̪
-    { 12, 5, 7, -6, -1, 15, 28569 }, // ̫
-    { 10, 6, 6, -5, 0, 15, 28584 }, // ̬
-    { 10, 6, 6, -5, -1, 15, 28599 }, // ̭
-    { 10, 5, 6, -5, -1, 13, 28614 }, // ̮
-    { 10, 5, 6, -5, -1, 13, 28627 }, // ̯
-    { 12, 5, 7, -6, -1, 15, 28640 }, // ̰
-    { 10, 3, 6, -5, -2, 8, 28655 }, // ̱
-    { 14, 3, 8, -7, -2, 11, 28663 }, // ̲
-    { 14, 7, 8, -7, 0, 25, 28674 }, // ̳
-    { 12, 5, 7, -6, 10, 15, 28699 }, // ̴
-    { 14, 3, 8, -7, 10, 11, 28714 }, // ̵
-    { 22, 3, 12, -11, 10, 17, 28725 }, // ̶
-    { 10, 7, 6, -5, 12, 18, 28742 }, // ̷
-    { 12, 25, 7, -6, 23, 75, 28760 }, // ̸
-    { 4, 7, 3, -2, 0, 7, 28835 }, // ̹
-    { 12, 6, 7, -6, -1, 18, 28842 }, // ̺
-    { 12, 7, 7, -6, 0, 21, 28860 }, // ̻
-    { 12, 5, 7, -6, -1, 15, 28881 }, // ̼
-    { 6, 7, 4, -3, 23, 11, 28896 }, // ̽
-    { 4, 10, 3, -2, 26, 10, 28907 }, // ̾
-    { 14, 7, 8, -7, 29, 25, 28917 }, // ̿
-    { 7, 6, 3, -5, 23, 11, 28942 }, // ̀
-    { 7, 6, 6, -2, 23, 11, 28953 }, // ́
-    { 12, 5, 7, -6, 22, 15, 28964 }, // ͂
-    { 5, 6, 3, -3, 23, 8, 28979 }, // ̓
-    { 11, 6, 7, -5, 23, 17, 28987 }, // ̈́
-    { 6, 5, 5, -2, -2, 8, 29004 }, // ͅ
-    { 14, 6, 8, -7, 23, 21, 29012 }, // ͆
-    { 14, 7, 8, -7, 0, 25, 29033 }, // ͇
-    { 8, 6, 5, -4, 0, 12, 29058 }, // ͈
-    { 6, 6, 4, -3, -1, 9, 29070 }, // ͉
-    { 12, 7, 7, -6, 23, 21, 29079 }, // ͊
-    { 12, 11, 7, -6, 27, 33, 29100 }, // ͋
-    { 10, 9, 6, -5, 26, 23, 29133 }, // ͌
-    { 12, 6, 7, -6, -1, 18, 29156 }, // ͍
-    { 6, 7, 4, -3, 0, 11, 29174 }, // ͎
-    { 22, 21, 12, -11, 21, 116, 29185 }, // ͏
-    { 6, 7, 4, -3, 24, 11, 29301 }, // ͐
-    { 4, 7, 3, -2, 24, 7, 29312 }, // ͑
-    { 10, 8, 6, -5, 25, 20, 29319 }, // ͒
-    { 6, 7, 4, -3, 0, 11, 29339 }, // ͓
-    { 6, 6, 4, -3, -1, 9, 29350 }, // ͔
-    { 6, 6, 4, -3, -1, 9, 29359 }, // ͕
-    { 12, 6, 7, -6, -1, 18, 29368 }, // ͖
-    { 4, 7, 3, -2, 24, 7, 29386 }, // ͗
-    { 4, 4, 8, 3, 22, 4, 29393 }, // ͘
-    { 8, 6, 5, -4, -1, 12, 29397 }, // ͙
-    { 12, 7, 7, -6, 0, 21, 29409 }, // ͚
-    { 6, 6, 4, -3, 23, 9, 29430 }, // ͛
-    { 24, 6, 13, -12, -1, 36, 29439 }, // ͜
-    { 24, 6, 13, -12, 23, 36, 29475 }, // ͝
-    { 18, 2, 10, -9, 20, 9, 29511 }, // ͞
-    { 18, 2, 10, -9, -2, 9, 29520 }, // ͟
-    { 24, 5, 13, -12, 22, 30, 29529 }, // ͠
-    { 24, 6, 13, -12, 25, 36, 29559 }, // ͡
-    { 23, 6, 13, -11, -1, 35, 29595 }, // ͢
-    { 6, 8, 4, -3, 25, 12, 29630 }, // ͣ
-    { 7, 8, 5, -3, 25, 14, 29642 }, // ͤ
-    { 2, 9, 2, -1, 27, 5, 29656 }, // ͥ
-    { 7, 8, 5, -3, 25, 14, 29661 }, // ͦ
-    { 7, 8, 5, -3, 25, 14, 29675 }, // ͧ
-    { 6, 8, 4, -3, 25, 12, 29689 }, // ͨ
-    { 7, 10, 5, -3, 27, 18, 29701 }, // ͩ
-    { 7, 9, 5, -3, 27, 16, 29719 }, // ͪ
-    { 11, 7, 7, -5, 25, 20, 29735 }, // ͫ
-    { 5, 7, 4, -2, 25, 9, 29755 }, // ͬ
-    { 5, 9, 4, -2, 26, 12, 29764 }, // ͭ
-    { 8, 7, 5, -4, 25, 14, 29776 }, // ͮ
-    { 7, 7, 5, -3, 25, 13, 29790 }, // ͯ
-    { 19, 21, 20, 0, 21, 100, 29803 }, // Α
-    { 16, 21, 19, 2, 21, 84, 29903 }, // Β
-    { 12, 21, 15, 2, 21, 63, 29987 }, // Γ
-    { 19, 21, 20, 0, 21, 100, 30050 }, // Δ
-    { 13, 21, 16, 2, 21, 69, 30150 }, // Ε
-    { 15, 21, 17, 1, 21, 79, 30219 }, // Ζ
-    { 17, 21, 22, 2, 21, 90, 30298 }, // Η
-    { 20, 23, 23, 1, 22, 115, 30388 }, // Θ
-    { 8, 21, 10, 1, 21, 42, 30503 }, // Ι
-    { 17, 21, 20, 2, 21, 90, 30545 }, // Κ
-    { 18, 21, 19, 0, 21, 95, 30635 }, // Λ
-    { 22, 21, 26, 2, 21, 116, 30730 }, // Μ
-    { 18, 21, 22, 2, 21, 95, 30846 }, // Ν
-    { 16, 21, 18, 1, 21, 84, 30941 }, // Ξ
-    { 20, 23, 23, 1, 22, 115, 31025 }, // Ο
-    { 17, 21, 21, 2, 21, 90, 31140 }, // Π
-    { 15, 21, 18, 2, 21, 79, 31230 }, // Ρ
-    { 15, 21, 17, 1, 21, 79, 31309 }, // Σ
-    { 16, 21, 17, 0, 21, 84, 31388 }, // Τ
-    { 17, 21, 18, 0, 21, 90, 31472 }, // Υ
-    { 23, 21, 25, 1, 21, 121, 31562 }, // Φ
-    { 17, 21, 18, 0, 21, 90, 31683 }, // Χ
-    { 20, 21, 24, 2, 21, 105, 31773 }, // Ψ
-    { 21, 22, 22, 0, 22, 116, 31878 }, // Ω
-    { 17, 17, 19, 1, 16, 73, 31994 }, // α
-    { 15, 30, 18, 2, 23, 113, 32067 }, // β
-    { 15, 23, 16, 0, 16, 87, 32180 }, // γ
-    { 15, 24, 17, 1, 23, 90, 32267 }, // δ
-    { 12, 17, 14, 1, 16, 51, 32357 }, // ε
-    { 13, 29, 15, 1, 23, 95, 32408 }, // ζ
-    { 14, 23, 18, 2, 16, 81, 32503 }, // η
-    { 15, 24, 17, 1, 23, 90, 32584 }, // θ
-    { 8, 17, 11, 2, 16, 34, 32674 }, // ι
-    { 14, 16, 17, 2, 16, 56, 32708 }, // κ
-    { 16, 24, 17, 0, 23, 96, 32764 }, // λ
-    { 16, 23, 19, 2, 16, 92, 32860 }, // μ
-    { 15, 16, 16, 0, 16, 60, 32952 }, // ν
-    { 13, 29, 15, 1, 23, 95, 33012 }, // ξ
-    { 16, 17, 18, 1, 16, 68, 33107 }, // ο
-    { 19, 17, 20, 0, 16, 81, 33175 }, // π
-    { 14, 23, 18, 2, 16, 81, 33256 }, // ρ
-    { 13, 22, 15, 1, 16, 72, 33337 }, // ς
-    { 16, 17, 18, 1, 16, 68, 33409 }, // σ
-    { 14, 17, 15, 0, 16, 60, 33477 }, // τ
-    { 14, 17, 17, 2, 16, 60, 33537 }, // υ
-    { 19, 30, 21, 1, 23, 143, 33597 }, // φ
-    { 18, 23, 19, 0, 16, 104, 33740 }, // χ
-    { 18, 30, 22, 2, 23, 135, 33844 }, // ψ
-    { 21, 17, 23, 1, 16, 90, 33979 }, // ω
-    { 19, 27, 20, 0, 21, 129, 34069 }, // Ạ
-    { 13, 22, 16, 1, 16, 72, 34198 }, // ạ
-    { 19, 29, 20, 0, 29, 138, 34270 }, // Ả
-    { 13, 25, 16, 1, 24, 82, 34408 }, // ả
-    { 19, 29, 20, 0, 29, 138, 34490 }, // Ấ
-    { 15, 25, 17, 1, 24, 94, 34628 }, // ấ
-    { 19, 29, 20, 0, 29, 138, 34722 }, // Ầ
-    { 14, 25, 16, 0, 24, 88, 34860 }, // ầ
-    { 19, 31, 20, 0, 31, 148, 34948 }, // Ẩ
-    { 15, 27, 17, 1, 26, 102, 35096 }, // ẩ
-    { 19, 31, 20, 0, 31, 148, 35198 }, // Ẫ
-    { 13, 27, 16, 1, 26, 88, 35346 }, // ẫ
-    { 19, 34, 20, 0, 28, 162, 35434 }, // Ậ
-    { 13, 29, 16, 1, 23, 95, 35596 }, // ậ
-    { 19, 30, 20, 0, 30, 143, 35691 }, // Ắ
-    { 13, 26, 16, 1, 25, 85, 35834 }, // ắ
-    { 19, 30, 20, 0, 30, 143, 35919 }, // Ằ
-    { 13, 26, 16, 1, 25, 85, 36062 }, // ằ
-    { 19, 31, 20, 0, 31, 148, 36147 }, // Ẳ
-    { 13, 27, 16, 1, 26, 88, 36295 }, // ẳ
-    { 19, 31, 20, 0, 31, 148, 36383 }, // Ẵ
-    { 13, 27, 16, 1, 26, 88, 36531 }, // ẵ
-    { 19, 33, 20, 0, 27, 157, 36619 }, // Ặ
-    { 13, 28, 16, 1, 22, 91, 36776 }, // ặ
-    { 13, 27, 16, 2, 21, 88, 36867 }, // Ẹ
-    { 14, 22, 16, 1, 16, 77, 36955 }, // ẹ
-    { 13, 29, 16, 2, 29, 95, 37032 }, // Ẻ
-    { 14, 25, 16, 1, 24, 88, 37127 }, // ẻ
-    { 13, 27, 16, 2, 27, 88, 37215 }, // Ẽ
-    { 14, 23, 16, 1, 22, 81, 37303 }, // ẽ
-    { 15, 29, 18, 2, 29, 109, 37384 }, // Ế
-    { 16, 25, 18, 1, 24, 100, 37493 }, // ế
-    { 14, 29, 16, 1, 29, 102, 37593 }, // Ề
-    { 15, 25, 16, 0, 24, 94, 37695 }, // ề
-    { 14, 31, 17, 2, 31, 109, 37789 }, // Ể
-    { 15, 27, 17, 1, 26, 102, 37898 }, // ể
-    { 13, 31, 16, 2, 31, 101, 38000 }, // Ễ
-    { 14, 27, 16, 1, 26, 95, 38101 }, // ễ
-    { 13, 34, 16, 2, 28, 111, 38196 }, // Ệ
-    { 14, 29, 16, 1, 23, 102, 38307 }, // ệ
-    { 8, 29, 10, 1, 29, 58, 38409 }, // Ỉ
-    { 7, 24, 9, 1, 24, 42, 38467 }, // ỉ
-    { 8, 27, 10, 1, 21, 54, 38509 }, // Ị
-    { 4, 28, 8, 2, 22, 28, 38563 }, // ị
-    { 20, 28, 23, 1, 22, 140, 38591 }, // Ọ
-    { 16, 22, 18, 1, 16, 88, 38731 }, // ọ
-    { 20, 30, 23, 1, 29, 150, 38819 }, // Ỏ
-    { 16, 25, 18, 1, 24, 100, 38969 }, // ỏ
-    { 20, 30, 23, 1, 29, 150, 39069 }, // Ố
-    { 16, 25, 18, 1, 24, 100, 39219 }, // ố
-    { 20, 30, 23, 1, 29, 150, 39319 }, // Ồ
-    { 16, 25, 18, 1, 24, 100, 39469 }, // ồ
-    { 20, 32, 23, 1, 31, 160, 39569 }, // Ổ
-    { 16, 27, 18, 1, 26, 108, 39729 }, // ổ
-    { 20, 32, 23, 1, 31, 160, 39837 }, // Ỗ
-    { 16, 27, 18, 1, 26, 108, 39997 }, // ỗ
-    { 20, 34, 23, 1, 28, 170, 40105 }, // Ộ
-    { 16, 29, 18, 1, 23, 116, 40275 }, // ộ
-    { 23, 29, 25, 1, 28, 167, 40391 }, // Ớ
-    { 18, 24, 20, 1, 23, 108, 40558 }, // ớ
-    { 23, 29, 25, 1, 28, 167, 40666 }, // Ờ
-    { 18, 24, 20, 1, 23, 108, 40833 }, // ờ
-    { 23, 30, 25, 1, 29, 173, 40941 }, // Ở
-    { 18, 25, 20, 1, 24, 113, 41114 }, // ở
-    { 23, 28, 25, 1, 27, 161, 41227 }, // Ỡ
-    { 18, 23, 20, 1, 22, 104, 41388 }, // ỡ
-    { 23, 29, 25, 1, 23, 167, 41492 }, // Ợ
-    { 18, 25, 20, 1, 19, 113, 41659 }, // ợ
-    { 17, 27, 21, 2, 21, 115, 41772 }, // Ụ
-    { 14, 22, 18, 2, 16, 77, 41887 }, // ụ
-    { 17, 30, 21, 2, 29, 128, 41964 }, // Ủ
-    { 14, 25, 18, 2, 24, 88, 42092 }, // ủ
-    { 22, 29, 25, 2, 28, 160, 42180 }, // Ứ
-    { 19, 24, 22, 2, 23, 114, 42340 }, // ứ
-    { 22, 29, 25, 2, 28, 160, 42454 }, // Ừ
-    { 19, 24, 22, 2, 23, 114, 42614 }, // ừ
-    { 22, 30, 25, 2, 29, 165, 42728 }, // Ử
-    { 19, 25, 22, 2, 24, 119, 42893 }, // ử
-    { 22, 28, 25, 2, 27, 154, 43012 }, // Ữ
-    { 19, 23, 22, 2, 22, 110, 43166 }, // ữ
-    { 22, 29, 25, 2, 23, 160, 43276 }, // Ự
-    { 19, 25, 22, 2, 19, 119, 43436 }, // ự
-    { 17, 28, 18, 0, 28, 119, 43555 }, // Ỳ
-    { 15, 30, 16, 0, 23, 113, 43674 }, // ỳ
-    { 17, 27, 18, 0, 21, 115, 43787 }, // Ỵ
-    { 15, 23, 16, 0, 16, 87, 43902 }, // ỵ
-    { 17, 29, 18, 0, 29, 124, 43989 }, // Ỷ
-    { 15, 31, 16, 0, 24, 117, 44113 }, // ỷ
-    { 17, 27, 18, 0, 27, 115, 44230 }, // Ỹ
-    { 15, 29, 16, 0, 22, 109, 44345 }, // ỹ
-    { 0, 0, 15, 0, 0, 0, 44454 }, //  
-    { 0, 0, 29, 0, 0, 0, 44454 }, //  
-    { 0, 0, 15, 0, 0, 0, 44454 }, //  
-    { 0, 0, 29, 0, 0, 0, 44454 }, //  
-    { 0, 0, 10, 0, 0, 0, 44454 }, //  
-    { 0, 0, 7, 0, 0, 0, 44454 }, //  
-    { 0, 0, 5, 0, 0, 0, 44454 }, //  
-    { 0, 0, 17, 0, 0, 0, 44454 }, //  
-    { 0, 0, 8, 0, 0, 0, 44454 }, //  
-    { 0, 0, 5, 0, 0, 0, 44454 }, //  
-    { 0, 0, 3, 0, 0, 0, 44454 }, //  
-    { 0, 0, 1, 0, 0, 0, 44454 }, // ​
-    { 0, 0, 1, 0, 0, 0, 44454 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 44454 }, // ‍
-    { 8, 25, 8, -1, 21, 50, 44454 }, // ‎
-    { 8, 25, 2, -7, 21, 50, 44504 }, // ‏
-    { 8, 3, 10, 1, 9, 6, 44554 }, // ‐
-    { 8, 3, 10, 1, 9, 6, 44560 }, // ‑
-    { 15, 3, 17, 1, 12, 12, 44566 }, // ‒
-    { 13, 3, 15, 1, 9, 10, 44578 }, // –
-    { 27, 3, 29, 1, 9, 21, 44588 }, // —
-    { 27, 3, 29, 1, 9, 21, 44609 }, // ―
-    { 10, 31, 16, 3, 23, 78, 44630 }, // ‖
-    { 14, 7, 14, -1, 0, 25, 44708 }, // ‗
-    { 5, 8, 6, 0, 21, 10, 44733 }, // ‘
-    { 5, 8, 6, 0, 21, 10, 44743 }, // ’
-    { 6, 8, 7, 0, 4, 12, 44753 }, // ‚
-    { 5, 8, 6, 0, 21, 10, 44765 }, // ‛
-    { 11, 8, 12, 0, 21, 22, 44775 }, // “
-    { 11, 8, 12, 0, 21, 22, 44797 }, // ”
-    { 11, 8, 12, 0, 4, 22, 44819 }, // „
-    { 11, 8, 12, 0, 21, 22, 44841 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 44863 }, // †
-    { 13, 23, 15, 1, 23, 75, 44938 }, // ‡
-    { 7, 8, 11, 2, 15, 14, 45013 }, // •
-    { 9, 10, 11, 1, 16, 23, 45027 }, // ‣
-    { 5, 5, 15, 5, 4, 7, 45050 }, // ․
-    { 12, 5, 16, 2, 4, 15, 45057 }, // ‥
-    { 19, 5, 23, 2, 4, 24, 45072 }, // …
-    { 4, 5, 8, 2, 10, 5, 45096 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 45101 }, //  
-    { 0, 0, 18, 0, 0, 0, 45101 }, //  
-    { 8, 22, 8, -1, 18, 44, 45101 }, // ‪
-    { 8, 22, 2, -7, 18, 44, 45145 }, // ‫
-    { 8, 25, 5, -4, 21, 50, 45189 }, // ‬
-    { 8, 25, 5, -4, 21, 50, 45239 }, // ‭
-    { 8, 25, 5, -4, 21, 50, 45289 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 45339 }, //  
-    { 32, 23, 34, 1, 22, 184, 45339 }, // ‰
-    { 43, 23, 45, 1, 22, 248, 45523 }, // ‱
-    { 7, 8, 9, 1, 21, 14, 45771 }, // ′
-    { 12, 8, 14, 1, 21, 24, 45785 }, // ″
-    { 17, 8, 19, 1, 21, 34, 45809 }, // ‴
-    { 7, 8, 7, -1, 21, 14, 45843 }, // ‵
-    { 12, 8, 13, -1, 21, 24, 45857 }, // ‶
-    { 17, 8, 18, -1, 21, 34, 45881 }, // ‷
-    { 12, 10, 13, 0, 3, 30, 45915 }, // ‸
-    { 7, 13, 9, 1, 14, 23, 45945 }, // ‹
-    { 7, 13, 9, 1, 14, 23, 45968 }, // ›
-    { 22, 23, 24, 1, 22, 127, 45991 }, // ※
-    { 11, 22, 15, 2, 21, 61, 46118 }, // ‼
-    { 13, 23, 14, 0, 22, 75, 46179 }, // ‽
-    { 16, 3, 16, -1, 25, 12, 46254 }, // ‾
-    { 18, 7, 19, 0, 0, 32, 46266 }, // ‿
-    { 18, 8, 19, 0, 24, 36, 46298 }, // ⁀
-    { 11, 19, 12, 0, 12, 53, 46334 }, // ⁁
-    { 33, 28, 34, 0, 23, 231, 46387 }, // ⁂
-    { 8, 3, 10, 1, 9, 6, 46618 }, // ⁃
-    { 16, 21, 11, -6, 21, 84, 46624 }, // ⁄
-    { 7, 26, 10, 2, 21, 46, 46708 }, // ⁅
-    { 8, 26, 9, 0, 21, 52, 46754 }, // ⁆
-    { 25, 23, 26, 0, 22, 144, 46806 }, // ⁇
-    { 18, 23, 20, 0, 22, 104, 46950 }, // ⁈
-    { 18, 23, 21, 2, 22, 104, 47054 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 47158 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 47218 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 47326 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 47386 }, // ⁍
-    { 14, 14, 16, 1, 8, 49, 47446 }, // ⁎
-    { 6, 21, 8, 1, 17, 32, 47495 }, // ⁏
-    { 18, 31, 19, 0, 24, 140, 47527 }, // ⁐
-    { 14, 29, 16, 1, 23, 102, 47667 }, // ⁑
-    { 11, 23, 12, 0, 22, 64, 47769 }, // ⁒
-    { 25, 5, 29, 2, 11, 32, 47833 }, // ⁓
-    { 18, 7, 19, 0, 0, 32, 47865 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 47897 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 47961 }, // ⁖
-    { 22, 8, 24, 1, 21, 44, 48036 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 48080 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 48207 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 48334 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 48357 }, // ⁛
-    { 22, 23, 24, 1, 22, 127, 48455 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 48582 }, // ⁝
-    { 4, 23, 8, 2, 22, 23, 48604 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 48627 }, //  
-    { 0, 0, 18, 0, 0, 0, 48627 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 48627 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 48627 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 48627 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 48627 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 48627 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 48627 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 48627 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 48627 }, // ⁩
-    { 8, 25, 5, -4, 21, 50, 48627 }, // ⁪
-    { 8, 25, 5, -4, 21, 50, 48677 }, // ⁫
-    { 8, 25, 5, -4, 21, 50, 48727 }, // ⁬
-    { 8, 25, 5, -4, 21, 50, 48777 }, // ⁭
-    { 8, 25, 5, -4, 21, 50, 48827 }, // ⁮
-    { 8, 25, 5, -4, 21, 50, 48877 }, // ⁯
-    { 10, 14, 11, 0, 25, 35, 48927 }, // ⁰
-    { 3, 14, 5, 1, 22, 11, 48962 }, // ⁱ
-    { 10, 13, 11, 0, 25, 33, 48973 }, // ⁴
-    { 10, 14, 11, 0, 25, 35, 49006 }, // ⁵
-    { 10, 14, 11, 0, 25, 35, 49041 }, // ⁶
-    { 10, 13, 11, 0, 25, 33, 49076 }, // ⁷
-    { 10, 14, 11, 0, 25, 35, 49109 }, // ⁸
-    { 10, 14, 11, 0, 25, 35, 49144 }, // ⁹
-    { 8, 9, 10, 1, 22, 18, 49179 }, // ⁺
-    { 8, 3, 10, 1, 19, 6, 49197 }, // ⁻
-    { 8, 6, 10, 1, 20, 12, 49203 }, // ⁼
-    { 6, 17, 8, 1, 27, 26, 49215 }, // ⁽
-    { 5, 17, 7, 0, 27, 22, 49241 }, // ⁾
-    { 10, 10, 12, 1, 18, 25, 49263 }, // ⁿ
-    { 10, 14, 11, 0, 9, 35, 49288 }, // ₀
-    { 6, 13, 10, 1, 9, 20, 49323 }, // ₁
-    { 9, 13, 10, 0, 9, 30, 49343 }, // ₂
-    { 10, 14, 11, 0, 9, 35, 49373 }, // ₃
-    { 10, 13, 11, 0, 9, 33, 49408 }, // ₄
-    { 10, 14, 11, 0, 9, 35, 49441 }, // ₅
-    { 10, 14, 11, 0, 9, 35, 49476 }, // ₆
-    { 10, 13, 11, 0, 9, 33, 49511 }, // ₇
-    { 10, 14, 11, 0, 9, 35, 49544 }, // ₈
-    { 10, 14, 11, 0, 9, 35, 49579 }, // ₉
-    { 8, 9, 10, 1, 6, 18, 49614 }, // ₊
-    { 8, 3, 10, 1, 3, 6, 49632 }, // ₋
-    { 8, 6, 10, 1, 4, 12, 49638 }, // ₌
-    { 6, 17, 8, 1, 11, 26, 49650 }, // ₍
-    { 5, 17, 7, 0, 11, 22, 49676 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 49698 }, // ₐ
-    { 9, 10, 11, 1, 7, 23, 49723 }, // ₑ
-    { 10, 10, 12, 1, 7, 25, 49746 }, // ₒ
-    { 10, 10, 11, 0, 7, 25, 49771 }, // ₓ
-    { 10, 10, 11, 0, 7, 25, 49796 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 49821 }, // ₕ
-    { 9, 14, 11, 1, 11, 32, 49856 }, // ₖ
-    { 3, 14, 5, 1, 11, 11, 49888 }, // ₗ
-    { 16, 10, 18, 1, 7, 40, 49899 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 49939 }, // ₙ
-    { 10, 14, 12, 1, 7, 35, 49964 }, // ₚ
-    { 9, 10, 10, 0, 7, 23, 49999 }, // ₛ
-    { 7, 12, 8, 0, 9, 21, 50022 }, // ₜ
-    { 15, 22, 17, 1, 22, 83, 50043 }, // ₠
-    { 16, 25, 18, 1, 23, 100, 50126 }, // ₡
-    { 15, 23, 17, 1, 22, 87, 50226 }, // ₢
-    { 15, 21, 17, 1, 21, 79, 50313 }, // ₣
-    { 16, 22, 17, 0, 22, 88, 50392 }, // ₤
-    { 23, 24, 27, 2, 20, 138, 50480 }, // ₥
-    { 17, 21, 18, 0, 21, 90, 50618 }, // ₦
-    { 20, 22, 23, 2, 21, 110, 50708 }, // ₧
-    { 22, 22, 25, 2, 21, 121, 50818 }, // ₨
-    { 20, 21, 21, 0, 21, 105, 50939 }, // ₩
-    { 19, 21, 23, 2, 21, 100, 51044 }, // ₪
-    { 17, 28, 19, 1, 23, 119, 51144 }, // ₫
-    { 17, 23, 18, 0, 22, 98, 51263 }, // €
-    { 17, 21, 18, 0, 21, 90, 51361 }, // ₭
-    { 17, 21, 18, 0, 21, 90, 51451 }, // ₮
-    { 28, 29, 29, 0, 22, 203, 51541 }, // ₯
-    { 16, 29, 17, 0, 22, 116, 51744 }, // ₰
-    { 17, 21, 18, 0, 21, 90, 51860 }, // ₱
-    { 19, 26, 21, 1, 23, 124, 51950 }, // ₲
-    { 18, 21, 19, 0, 21, 95, 52074 }, // ₳
-    { 16, 23, 17, 0, 22, 92, 52169 }, // ₴
-    { 17, 26, 19, 1, 23, 111, 52261 }, // ₵
-    { 18, 21, 19, 0, 20, 95, 52372 }, // ₶
-    { 20, 25, 21, 0, 22, 125, 52467 }, // ₷
-    { 16, 21, 17, 0, 21, 84, 52592 }, // ₸
-    { 13, 21, 17, 2, 21, 69, 52676 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 52745 }, // ₺
-    { 23, 23, 24, 0, 22, 133, 52833 }, // ₻
-    { 21, 21, 24, 1, 21, 111, 52966 }, // ₼
-    { 16, 21, 17, 0, 21, 84, 53077 }, // ₽
-    { 20, 23, 22, 1, 23, 115, 53161 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 53276 }, // ₿
-    { 12, 21, 14, 1, 16, 63, 53371 }, // ⃀
-    { 15, 3, 17, 1, 12, 12, 53434 }, // −
-    { 27, 28, 29, 1, 23, 189, 53446 }, // �
+    { 4, 22, 8, 2, 21, 27, 0 }, // !
+    { 9, 8, 12, 1, 21, 27, 27 }, // "
+    { 19, 21, 20, 0, 21, 80, 54 }, // #
+    { 15, 25, 17, 1, 23, 76, 134 }, // $
+    { 22, 23, 24, 1, 22, 111, 210 }, // %
+    { 21, 23, 23, 1, 22, 82, 321 }, // &
+    { 4, 8, 7, 1, 21, 13, 403 }, // '
+    { 7, 26, 9, 1, 21, 38, 416 }, // (
+    { 8, 26, 9, 0, 21, 42, 454 }, // )
+    { 14, 14, 16, 1, 23, 39, 496 }, // *
+    { 15, 15, 17, 1, 18, 42, 535 }, // +
+    { 5, 8, 8, 1, 4, 13, 577 }, // ,
+    { 8, 3, 10, 1, 9, 7, 590 }, // -
+    { 4, 5, 8, 2, 4, 8, 597 }, // .
+    { 11, 21, 12, 0, 21, 32, 605 }, // /
+    { 15, 23, 17, 1, 22, 64, 637 }, // 0
+    { 9, 21, 17, 2, 21, 37, 701 }, // 1
+    { 15, 22, 17, 1, 22, 59, 738 }, // 2
+    { 15, 23, 17, 1, 22, 56, 797 }, // 3
+    { 17, 21, 18, 0, 21, 62, 853 }, // 4
+    { 15, 22, 17, 1, 21, 56, 915 }, // 5
+    { 15, 23, 17, 1, 22, 63, 971 }, // 6
+    { 15, 21, 17, 1, 21, 49, 1034 }, // 7
+    { 15, 23, 17, 1, 22, 66, 1083 }, // 8
+    { 15, 23, 17, 1, 22, 60, 1149 }, // 9
+    { 4, 18, 8, 2, 17, 15, 1209 }, // :
+    { 6, 21, 8, 0, 17, 21, 1224 }, // ;
+    { 15, 15, 17, 1, 18, 33, 1245 }, // <
+    { 14, 9, 17, 1, 15, 25, 1278 }, // =
+    { 15, 15, 17, 1, 18, 33, 1303 }, // >
+    { 12, 23, 13, 0, 22, 44, 1336 }, // ?
+    { 24, 24, 26, 1, 21, 116, 1380 }, // @
+    { 19, 21, 20, 0, 21, 67, 1496 }, // A
+    { 16, 21, 19, 2, 21, 67, 1563 }, // B
+    { 17, 23, 19, 1, 22, 54, 1630 }, // C
+    { 18, 21, 21, 2, 21, 75, 1684 }, // D
+    { 13, 21, 16, 2, 21, 54, 1759 }, // E
+    { 13, 21, 16, 2, 21, 47, 1813 }, // F
+    { 19, 23, 21, 1, 22, 68, 1860 }, // G
+    { 17, 21, 22, 2, 21, 67, 1928 }, // H
+    { 8, 21, 10, 1, 21, 42, 1995 }, // I
+    { 9, 27, 8, -3, 21, 55, 2037 }, // J
+    { 17, 21, 20, 2, 21, 64, 2092 }, // K
+    { 13, 21, 16, 2, 21, 47, 2156 }, // L
+    { 22, 21, 26, 2, 21, 110, 2203 }, // M
+    { 18, 21, 22, 2, 21, 83, 2313 }, // N
+    { 20, 23, 23, 1, 22, 75, 2396 }, // O
+    { 15, 21, 18, 2, 21, 57, 2471 }, // P
+    { 20, 27, 23, 1, 22, 86, 2528 }, // Q
+    { 16, 21, 19, 2, 21, 63, 2614 }, // R
+    { 14, 23, 16, 1, 22, 55, 2677 }, // S
+    { 16, 21, 17, 0, 21, 49, 2732 }, // T
+    { 17, 22, 21, 2, 21, 73, 2781 }, // U
+    { 18, 21, 19, 0, 21, 64, 2854 }, // V
+    { 27, 21, 28, 0, 21, 111, 2918 }, // W
+    { 17, 21, 18, 0, 21, 65, 3029 }, // X
+    { 17, 21, 18, 0, 21, 54, 3094 }, // Y
+    { 15, 21, 17, 1, 21, 56, 3148 }, // Z
+    { 7, 26, 10, 2, 21, 45, 3204 }, // [
+    { 11, 21, 12, 0, 21, 35, 3249 }, // <backslash>
+    { 8, 26, 10, 0, 21, 57, 3284 }, // ]
+    { 15, 14, 17, 1, 21, 38, 3341 }, // ^
+    { 15, 3, 15, -1, -2, 17, 3379 }, // _
+    { 7, 6, 9, 1, 23, 11, 3396 }, // `
+    { 13, 17, 16, 1, 16, 46, 3407 }, // a
+    { 15, 24, 18, 2, 23, 69, 3453 }, // b
+    { 13, 17, 15, 1, 16, 41, 3522 }, // c
+    { 15, 24, 18, 1, 23, 69, 3563 }, // d
+    { 14, 17, 16, 1, 16, 51, 3632 }, // e
+    { 12, 23, 13, 0, 23, 41, 3683 }, // f
+    { 15, 23, 18, 1, 16, 74, 3724 }, // g
+    { 14, 23, 18, 2, 23, 60, 3798 }, // h
+    { 4, 22, 8, 2, 22, 32, 3858 }, // i
+    { 8, 29, 8, -2, 22, 44, 3890 }, // j
+    { 14, 23, 17, 2, 23, 58, 3934 }, // k
+    { 4, 23, 8, 2, 23, 34, 3992 }, // l
+    { 23, 16, 27, 2, 16, 73, 4026 }, // m
+    { 14, 16, 18, 2, 16, 46, 4099 }, // n
+    { 16, 17, 18, 1, 16, 51, 4145 }, // o
+    { 15, 23, 18, 2, 16, 69, 4196 }, // p
+    { 15, 23, 18, 1, 16, 70, 4265 }, // q
+    { 10, 16, 13, 2, 16, 32, 4335 }, // r
+    { 12, 17, 14, 1, 16, 40, 4367 }, // s
+    { 10, 21, 11, 0, 20, 42, 4407 }, // t
+    { 14, 17, 18, 2, 16, 48, 4449 }, // u
+    { 15, 16, 16, 0, 16, 46, 4497 }, // v
+    { 23, 16, 24, 0, 16, 81, 4543 }, // w
+    { 15, 16, 16, 0, 16, 47, 4624 }, // x
+    { 15, 23, 16, 0, 16, 62, 4671 }, // y
+    { 12, 16, 14, 1, 16, 35, 4733 }, // z
+    { 11, 26, 12, 0, 21, 42, 4768 }, // {
+    { 4, 31, 16, 6, 23, 30, 4810 }, // |
+    { 11, 26, 12, 0, 21, 43, 4840 }, // }
+    { 15, 5, 17, 1, 13, 16, 4883 }, // ~
+    { 0, 0, 8, 0, 0, 0, 4899 }, //  
+    { 4, 22, 8, 2, 16, 28, 4899 }, // ¡
+    { 13, 23, 17, 2, 22, 53, 4927 }, // ¢
+    { 16, 22, 17, 0, 22, 59, 4980 }, // £
+    { 14, 14, 17, 1, 17, 45, 5039 }, // ¤
+    { 17, 21, 18, 0, 21, 59, 5084 }, // ¥
+    { 4, 31, 16, 6, 23, 24, 5143 }, // ¦
+    { 13, 24, 15, 1, 23, 59, 5167 }, // §
+    { 9, 4, 17, 4, 22, 10, 5226 }, // ¨
+    { 22, 23, 24, 1, 22, 99, 5236 }, // ©
+    { 9, 11, 10, 0, 22, 24, 5335 }, // ª
+    { 13, 13, 15, 1, 14, 39, 5359 }, // «
+    { 15, 9, 17, 1, 12, 23, 5398 }, // ¬
+    { 8, 3, 10, 1, 9, 7, 5421 }, // ­
+    { 22, 23, 24, 1, 22, 107, 5428 }, // ®
+    { 16, 3, 16, -1, 25, 7, 5535 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 5542 }, // °
+    { 15, 18, 17, 1, 18, 52, 5567 }, // ±
+    { 9, 13, 10, 0, 25, 23, 5619 }, // ²
+    { 10, 14, 11, 0, 25, 28, 5642 }, // ³
+    { 7, 6, 9, 1, 23, 10, 5670 }, // ´
+    { 14, 23, 18, 2, 16, 62, 5680 }, // µ
+    { 16, 27, 19, 1, 23, 105, 5742 }, // ¶
+    { 4, 5, 8, 2, 13, 8, 5847 }, // ·
+    { 7, 7, 8, 0, 0, 12, 5855 }, // ¸
+    { 6, 13, 10, 1, 25, 17, 5867 }, // ¹
+    { 11, 11, 12, 0, 22, 27, 5884 }, // º
+    { 13, 13, 15, 1, 14, 38, 5911 }, // »
+    { 22, 21, 23, 0, 21, 90, 5949 }, // ¼
+    { 22, 21, 23, 0, 21, 87, 6039 }, // ½
+    { 23, 22, 24, 0, 22, 103, 6126 }, // ¾
+    { 13, 22, 14, 0, 16, 47, 6229 }, // ¿
+    { 19, 28, 20, 0, 28, 82, 6276 }, // À
+    { 19, 28, 20, 0, 28, 81, 6358 }, // Á
+    { 19, 28, 20, 0, 28, 85, 6439 }, // Â
+    { 19, 27, 20, 0, 27, 86, 6524 }, // Ã
+    { 19, 27, 20, 0, 27, 82, 6610 }, // Ä
+    { 19, 26, 20, 0, 26, 84, 6692 }, // Å
+    { 25, 21, 26, -1, 21, 88, 6776 }, // Æ
+    { 17, 29, 19, 1, 22, 68, 6864 }, // Ç
+    { 13, 28, 16, 2, 28, 68, 6932 }, // È
+    { 13, 28, 16, 2, 28, 66, 7000 }, // É
+    { 13, 28, 16, 2, 28, 70, 7066 }, // Ê
+    { 13, 27, 16, 2, 27, 66, 7136 }, // Ë
+    { 8, 28, 10, 1, 28, 54, 7202 }, // Ì
+    { 9, 28, 11, 1, 28, 53, 7256 }, // Í
+    { 10, 28, 11, 0, 28, 58, 7309 }, // Î
+    { 10, 27, 11, 0, 27, 55, 7367 }, // Ï
+    { 20, 21, 21, 0, 21, 78, 7422 }, // Ð
+    { 18, 27, 22, 2, 27, 99, 7500 }, // Ñ
+    { 20, 29, 23, 1, 28, 89, 7599 }, // Ò
+    { 20, 29, 23, 1, 28, 88, 7688 }, // Ó
+    { 20, 29, 23, 1, 28, 92, 7776 }, // Ô
+    { 20, 28, 23, 1, 27, 92, 7868 }, // Õ
+    { 20, 28, 23, 1, 27, 88, 7960 }, // Ö
+    { 14, 14, 17, 1, 17, 36, 8048 }, // ×
+    { 20, 23, 23, 1, 22, 88, 8084 }, // Ø
+    { 17, 29, 21, 2, 28, 86, 8172 }, // Ù
+    { 17, 29, 21, 2, 28, 88, 8258 }, // Ú
+    { 17, 29, 21, 2, 28, 90, 8346 }, // Û
+    { 17, 28, 21, 2, 27, 87, 8436 }, // Ü
+    { 17, 28, 18, 0, 28, 67, 8523 }, // Ý
+    { 15, 21, 18, 2, 21, 56, 8590 }, // Þ
+    { 16, 24, 19, 2, 23, 75, 8646 }, // ß
+    { 13, 24, 16, 1, 23, 58, 8721 }, // à
+    { 13, 24, 16, 1, 23, 59, 8779 }, // á
+    { 13, 24, 16, 1, 23, 62, 8838 }, // â
+    { 13, 23, 16, 1, 22, 62, 8900 }, // ã
+    { 13, 23, 16, 1, 22, 58, 8962 }, // ä
+    { 13, 25, 16, 1, 24, 65, 9020 }, // å
+    { 23, 17, 25, 1, 16, 78, 9085 }, // æ
+    { 13, 23, 15, 1, 16, 54, 9163 }, // ç
+    { 14, 24, 16, 1, 23, 64, 9217 }, // è
+    { 14, 24, 16, 1, 23, 64, 9281 }, // é
+    { 14, 24, 16, 1, 23, 67, 9345 }, // ê
+    { 14, 23, 16, 1, 22, 64, 9412 }, // ë
+    { 7, 23, 8, -1, 23, 35, 9476 }, // ì
+    { 7, 23, 10, 2, 23, 35, 9511 }, // í
+    { 11, 23, 10, -2, 23, 40, 9546 }, // î
+    { 9, 22, 9, -1, 22, 36, 9586 }, // ï
+    { 16, 24, 18, 1, 23, 72, 9622 }, // ð
+    { 14, 22, 18, 2, 22, 61, 9694 }, // ñ
+    { 16, 24, 18, 1, 23, 66, 9755 }, // ò
+    { 16, 24, 18, 1, 23, 65, 9821 }, // ó
+    { 16, 24, 18, 1, 23, 69, 9886 }, // ô
+    { 16, 23, 18, 1, 22, 67, 9955 }, // õ
+    { 16, 23, 18, 1, 22, 64, 10022 }, // ö
+    { 15, 14, 17, 1, 17, 30, 10086 }, // ÷
+    { 16, 18, 18, 1, 17, 66, 10116 }, // ø
+    { 14, 24, 18, 2, 23, 63, 10182 }, // ù
+    { 14, 24, 18, 2, 23, 59, 10245 }, // ú
+    { 14, 24, 18, 2, 23, 64, 10304 }, // û
+    { 14, 23, 18, 2, 22, 60, 10368 }, // ü
+    { 15, 30, 16, 0, 23, 77, 10428 }, // ý
+    { 15, 30, 18, 2, 23, 81, 10505 }, // þ
+    { 15, 29, 16, 0, 22, 75, 10586 }, // ÿ
+    { 19, 25, 20, 0, 25, 79, 10661 }, // Ā
+    { 13, 21, 16, 1, 20, 56, 10740 }, // ā
+    { 19, 27, 20, 0, 27, 83, 10796 }, // Ă
+    { 13, 23, 16, 1, 22, 59, 10879 }, // ă
+    { 19, 28, 20, 0, 21, 84, 10938 }, // Ą
+    { 14, 23, 16, 1, 16, 63, 11022 }, // ą
+    { 17, 29, 19, 1, 28, 66, 11085 }, // Ć
+    { 13, 24, 15, 1, 23, 54, 11151 }, // ć
+    { 17, 29, 19, 1, 28, 70, 11205 }, // Ĉ
+    { 13, 24, 15, 1, 23, 57, 11275 }, // ĉ
+    { 17, 28, 19, 1, 27, 65, 11332 }, // Ċ
+    { 13, 23, 15, 1, 22, 51, 11397 }, // ċ
+    { 17, 29, 19, 1, 28, 70, 11448 }, // Č
+    { 13, 24, 15, 1, 23, 57, 11518 }, // č
+    { 18, 28, 21, 2, 28, 92, 11575 }, // Ď
+    { 20, 24, 22, 1, 23, 79, 11667 }, // ď
+    { 20, 21, 21, 0, 21, 78, 11746 }, // Đ
+    { 17, 24, 19, 1, 23, 79, 11824 }, // đ
+    { 13, 25, 16, 2, 25, 63, 11903 }, // Ē
+    { 14, 21, 16, 1, 20, 61, 11966 }, // ē
+    { 13, 27, 16, 2, 27, 67, 12027 }, // Ĕ
+    { 14, 23, 16, 1, 22, 64, 12094 }, // ĕ
+    { 13, 27, 16, 2, 27, 64, 12158 }, // Ė
+    { 14, 23, 16, 1, 22, 60, 12222 }, // ė
+    { 13, 28, 16, 2, 21, 71, 12282 }, // Ę
+    { 14, 23, 16, 1, 16, 65, 12353 }, // ę
+    { 13, 28, 16, 2, 28, 70, 12418 }, // Ě
+    { 14, 24, 16, 1, 23, 67, 12488 }, // ě
+    { 19, 29, 21, 1, 28, 86, 12555 }, // Ĝ
+    { 15, 30, 18, 1, 23, 90, 12641 }, // ĝ
+    { 19, 28, 21, 1, 27, 82, 12731 }, // Ğ
+    { 15, 29, 18, 1, 22, 88, 12813 }, // ğ
+    { 19, 28, 21, 1, 27, 78, 12901 }, // Ġ
+    { 15, 29, 18, 1, 22, 83, 12979 }, // ġ
+    { 19, 29, 21, 1, 22, 80, 13062 }, // Ģ
+    { 15, 30, 18, 1, 23, 87, 13142 }, // ģ
+    { 17, 28, 22, 2, 28, 85, 13229 }, // Ĥ
+    { 18, 30, 18, -2, 30, 85, 13314 }, // ĥ
+    { 22, 21, 23, 0, 21, 76, 13399 }, // Ħ
+    { 16, 23, 18, 0, 23, 70, 13475 }, // ħ
+    { 12, 27, 12, -1, 27, 59, 13545 }, // Ĩ
+    { 12, 22, 11, -2, 22, 47, 13604 }, // ĩ
+    { 10, 25, 11, 0, 25, 53, 13651 }, // Ī
+    { 10, 20, 10, -1, 20, 34, 13704 }, // ī
+    { 10, 27, 11, 0, 27, 56, 13738 }, // Ĭ
+    { 10, 22, 10, -1, 22, 37, 13794 }, // ĭ
+    { 8, 28, 10, 1, 21, 55, 13831 }, // Į
+    { 6, 29, 8, 0, 22, 44, 13886 }, // į
+    { 8, 27, 10, 1, 27, 51, 13930 }, // İ
+    { 4, 16, 8, 2, 16, 25, 13981 }, // ı
+    { 15, 27, 18, 1, 21, 89, 14006 }, // Ĳ
+    { 11, 29, 15, 2, 22, 66, 14095 }, // ĳ
+    { 12, 34, 10, -3, 28, 71, 14161 }, // Ĵ
+    { 11, 30, 10, -2, 23, 52, 14232 }, // ĵ
+    { 17, 28, 20, 2, 21, 76, 14284 }, // Ķ
+    { 14, 30, 17, 2, 23, 69, 14360 }, // ķ
+    { 14, 16, 17, 2, 16, 49, 14429 }, // ĸ
+    { 13, 28, 16, 2, 28, 59, 14478 }, // Ĺ
+    { 7, 30, 10, 2, 30, 44, 14537 }, // ĺ
+    { 13, 28, 16, 2, 21, 58, 14581 }, // Ļ
+    { 5, 30, 8, 1, 23, 41, 14639 }, // ļ
+    { 13, 21, 16, 2, 21, 52, 14680 }, // Ľ
+    { 8, 23, 11, 2, 23, 40, 14732 }, // ľ
+    { 13, 21, 16, 2, 21, 51, 14772 }, // Ŀ
+    { 8, 23, 11, 2, 23, 39, 14823 }, // ŀ
+    { 15, 21, 16, 0, 21, 50, 14862 }, // Ł
+    { 9, 23, 9, -1, 23, 36, 14912 }, // ł
+    { 18, 28, 22, 2, 28, 96, 14948 }, // Ń
+    { 14, 23, 18, 2, 23, 58, 15044 }, // ń
+    { 18, 28, 22, 2, 21, 96, 15102 }, // Ņ
+    { 14, 23, 18, 2, 16, 58, 15198 }, // ņ
+    { 18, 28, 22, 2, 28, 100, 15256 }, // Ň
+    { 14, 23, 18, 2, 23, 62, 15356 }, // ň
+    { 18, 21, 20, 0, 21, 69, 15418 }, // ŉ
+    { 18, 27, 22, 2, 21, 100, 15487 }, // Ŋ
+    { 14, 23, 18, 2, 16, 61, 15587 }, // ŋ
+    { 20, 26, 23, 1, 25, 85, 15648 }, // Ō
+    { 16, 21, 18, 1, 20, 61, 15733 }, // ō
+    { 20, 28, 23, 1, 27, 89, 15794 }, // Ŏ
+    { 16, 23, 18, 1, 22, 65, 15883 }, // ŏ
+    { 20, 29, 23, 1, 28, 98, 15948 }, // Ő
+    { 16, 24, 18, 1, 23, 70, 16046 }, // ő
+    { 25, 23, 27, 1, 22, 96, 16116 }, // Œ
+    { 26, 17, 28, 1, 16, 86, 16212 }, // œ
+    { 16, 28, 19, 2, 28, 75, 16298 }, // Ŕ
+    { 10, 23, 13, 2, 23, 41, 16373 }, // ŕ
+    { 16, 28, 19, 2, 21, 75, 16414 }, // Ŗ
+    { 11, 23, 13, 1, 16, 43, 16489 }, // ŗ
+    { 16, 28, 19, 2, 28, 80, 16532 }, // Ř
+    { 10, 23, 13, 2, 23, 46, 16612 }, // ř
+    { 14, 29, 16, 1, 28, 67, 16658 }, // Ś
+    { 12, 24, 14, 1, 23, 50, 16725 }, // ś
+    { 14, 29, 16, 1, 28, 70, 16775 }, // Ŝ
+    { 12, 24, 14, 1, 23, 55, 16845 }, // ŝ
+    { 14, 29, 16, 1, 22, 69, 16900 }, // Ş
+    { 12, 23, 14, 1, 16, 54, 16969 }, // ş
+    { 14, 29, 16, 1, 28, 70, 17023 }, // Š
+    { 12, 24, 14, 1, 23, 55, 17093 }, // š
+    { 16, 28, 17, 0, 21, 64, 17148 }, // Ţ
+    { 10, 27, 11, 0, 20, 53, 17212 }, // ţ
+    { 16, 28, 17, 0, 28, 66, 17265 }, // Ť
+    { 14, 24, 15, 0, 23, 59, 17331 }, // ť
+    { 16, 21, 17, 0, 21, 57, 17390 }, // Ŧ
+    { 10, 21, 11, 0, 20, 43, 17447 }, // ŧ
+    { 17, 28, 21, 2, 27, 87, 17490 }, // Ũ
+    { 14, 23, 18, 2, 22, 62, 17577 }, // ũ
+    { 17, 26, 21, 2, 25, 84, 17639 }, // Ū
+    { 14, 21, 18, 2, 20, 58, 17723 }, // ū
+    { 17, 28, 21, 2, 27, 87, 17781 }, // Ŭ
+    { 14, 23, 18, 2, 22, 62, 17868 }, // ŭ
+    { 17, 30, 21, 2, 29, 94, 17930 }, // Ů
+    { 14, 25, 18, 2, 24, 67, 18024 }, // ů
+    { 17, 29, 21, 2, 28, 94, 18091 }, // Ű
+    { 14, 24, 18, 2, 23, 66, 18185 }, // ű
+    { 17, 28, 21, 2, 21, 88, 18251 }, // Ų
+    { 14, 23, 18, 2, 16, 62, 18339 }, // ų
+    { 27, 28, 28, 0, 28, 132, 18401 }, // Ŵ
+    { 23, 23, 24, 0, 23, 102, 18533 }, // ŵ
+    { 17, 28, 18, 0, 28, 72, 18635 }, // Ŷ
+    { 15, 30, 16, 0, 23, 79, 18707 }, // ŷ
+    { 17, 27, 18, 0, 27, 67, 18786 }, // Ÿ
+    { 15, 28, 17, 1, 28, 71, 18853 }, // Ź
+    { 12, 23, 14, 1, 23, 45, 18924 }, // ź
+    { 15, 27, 17, 1, 27, 65, 18969 }, // Ż
+    { 12, 22, 14, 1, 22, 44, 19034 }, // ż
+    { 15, 28, 17, 1, 28, 72, 19078 }, // Ž
+    { 12, 23, 14, 1, 23, 51, 19150 }, // ž
+    { 9, 23, 12, 2, 23, 37, 19201 }, // ſ
+    { 23, 24, 25, 1, 23, 83, 19238 }, // Ơ
+    { 18, 20, 20, 1, 19, 61, 19321 }, // ơ
+    { 28, 23, 31, 1, 22, 109, 19382 }, // Ƣ
+    { 22, 23, 25, 1, 16, 102, 19491 }, // ƣ
+    { 19, 21, 20, 0, 21, 61, 19593 }, // Ƥ
+    { 15, 30, 18, 2, 23, 83, 19654 }, // ƥ
+    { 16, 24, 19, 2, 21, 66, 19737 }, // Ʀ
+    { 14, 23, 16, 1, 22, 54, 19803 }, // Ƨ
+    { 12, 17, 14, 1, 16, 41, 19857 }, // ƨ
+    { 15, 21, 17, 1, 21, 54, 19898 }, // Ʃ
+    { 13, 30, 13, -1, 23, 61, 19952 }, // ƪ
+    { 10, 27, 11, 0, 20, 54, 20013 }, // ƫ
+    { 17, 21, 18, 0, 21, 54, 20067 }, // Ƭ
+    { 10, 24, 11, 0, 23, 49, 20121 }, // ƭ
+    { 16, 28, 17, 0, 21, 65, 20170 }, // Ʈ
+    { 22, 24, 25, 2, 23, 91, 20235 }, // Ư
+    { 19, 20, 22, 2, 19, 65, 20326 }, // ư
+    { 7, 6, 0, -15, 23, 9, 20391 }, // ̀
+    { 7, 6, 0, -10, 23, 8, 20400 }, // ́
+    { 10, 6, 6, -5, 23, 13, 20408 }, // ̂
+    { 12, 5, 0, -15, 22, 14, 20421 }, // ̃
+    { 10, 3, 6, -5, 20, 9, 20435 }, // ̄
+    { 14, 3, 8, -7, 25, 16, 20444 }, // ̅
+    { 10, 5, 6, -5, 22, 12, 20460 }, // ̆
+    { 4, 4, 3, -2, 22, 7, 20472 }, // ̇
+    { 10, 4, 6, -5, 22, 12, 20479 }, // ̈
+    { 6, 7, 0, -11, 24, 12, 20491 }, // ̉
+    { 8, 7, 5, -4, 24, 17, 20503 }, // ̊
+    { 11, 6, 8, -4, 23, 20, 20520 }, // ̋
+    { 10, 6, 6, -5, 23, 13, 20540 }, // ̌
+    { 4, 6, 3, -2, 23, 6, 20553 }, // ̍
+    { 8, 6, 5, -4, 23, 14, 20559 }, // ̎
+    { 12, 6, 0, -16, 23, 18, 20573 }, // ̏
+    { 10, 8, 6, -5, 25, 19, 20591 }, // ̐
+    { 10, 5, 6, -5, 22, 15, 20610 }, // ̑
+    { 6, 8, 4, -3, 21, 11, 20625 }, // ̒
+    { 6, 8, 4, -3, 21, 11, 20636 }, // ̓
+    { 6, 8, 4, -3, 21, 13, 20647 }, // ̔
+    { 6, 8, 4, -3, 21, 13, 20660 }, // ̕
+    { 6, 6, 4, -3, -1, 10, 20673 }, // ̖
+    { 6, 6, 4, -3, -1, 11, 20683 }, // ̗
+    { 6, 7, 4, -3, 0, 14, 20694 }, // ̘
+    { 6, 7, 4, -3, 0, 13, 20708 }, // ̙
+    { 8, 8, 9, 0, 23, 11, 20721 }, // ̚
+    { 7, 7, 5, -3, 23, 10, 20732 }, // ̛
+    { 4, 7, 3, -2, 0, 11, 20742 }, // ̜
+    { 8, 6, 5, -4, -1, 9, 20753 }, // ̝
+    { 8, 6, 5, -4, -1, 9, 20762 }, // ̞
+    { 8, 7, 5, -4, 0, 10, 20771 }, // ̟
+    { 8, 3, 5, -4, -3, 7, 20781 }, // ̠
+    { 6, 9, 1, -6, 2, 14, 20788 }, // ̡
+    { 6, 9, 7, 0, 2, 13, 20802 }, // ̢
+    { 4, 5, 0, -11, -1, 5, 20815 }, // ̣
+    { 10, 4, 6, -5, -2, 12, 20820 }, // ̤
+    { 8, 7, 5, -4, 0, 17, 20832 }, // ̥
+    { 4, 6, 3, -2, -1, 8, 20849 }, // ̦
+    { 6, 7, 4, -3, 0, 12, 20857 }, // ̧
+    { 6, 8, 4, -3, 1, 14, 20869 }, // ̨
+    { 4, 6, 3, -2, 0, 6, 20883 }, // ̩
+    { 12, 6, 7, -6, -1, 19, 20889 }, // ̪
+    { 12, 5, 7, -6, -1, 14, 20908 }, // ̫
+    { 10, 6, 6, -5, 0, 13, 20922 }, // ̬
+    { 10, 6, 6, -5, -1, 14, 20935 }, // ̭
+    { 10, 5, 6, -5, -1, 12, 20949 }, // ̮
+    { 10, 5, 6, -5, -1, 15, 20961 }, // ̯
+    { 12, 5, 7, -6, -1, 14, 20976 }, // ̰
+    { 10, 3, 6, -5, -2, 9, 20990 }, // ̱
+    { 14, 3, 8, -7, -2, 17, 20999 }, // ̲
+    { 14, 7, 8, -7, 0, 25, 21016 }, // ̳
+    { 12, 5, 7, -6, 10, 16, 21041 }, // ̴
+    { 14, 3, 8, -7, 10, 16, 21057 }, // ̵
+    { 22, 3, 12, -11, 10, 26, 21073 }, // ̶
+    { 10, 7, 6, -5, 12, 11, 21099 }, // ̷
+    { 12, 25, 7, -6, 23, 49, 21110 }, // ̸
+    { 4, 7, 3, -2, 0, 11, 21159 }, // ̹
+    { 12, 6, 7, -6, -1, 22, 21170 }, // ̺
+    { 12, 7, 7, -6, 0, 23, 21192 }, // ̻
+    { 12, 5, 7, -6, -1, 14, 21215 }, // ̼
+    { 6, 7, 4, -3, 23, 14, 21229 }, // ̽
+    { 4, 10, 3, -2, 26, 13, 21243 }, // ̾
+    { 14, 7, 8, -7, 29, 25, 21256 }, // ̿
+    { 7, 6, 3, -5, 23, 10, 21281 }, // ̀
+    { 7, 6, 6, -2, 23, 10, 21291 }, // ́
+    { 12, 5, 7, -6, 22, 14, 21301 }, // ͂
+    { 5, 6, 3, -3, 23, 9, 21315 }, // ̓
+    { 11, 6, 7, -5, 23, 19, 21324 }, // ̈́
+    { 6, 5, 5, -2, -2, 8, 21343 }, // ͅ
+    { 14, 6, 8, -7, 23, 20, 21351 }, // ͆
+    { 14, 7, 8, -7, 0, 25, 21371 }, // ͇
+    { 8, 6, 5, -4, 0, 14, 21396 }, // ͈
+    { 6, 6, 4, -3, -1, 12, 21410 }, // ͉
+    { 12, 7, 7, -6, 23, 19, 21422 }, // ͊
+    { 12, 11, 7, -6, 27, 27, 21441 }, // ͋
+    { 10, 9, 6, -5, 26, 19, 21468 }, // ͌
+    { 12, 6, 7, -6, -1, 15, 21487 }, // ͍
+    { 6, 7, 4, -3, 0, 9, 21502 }, // ͎
+    { 22, 21, 12, -11, 21, 95, 21511 }, // ͏
+    { 6, 7, 4, -3, 24, 11, 21606 }, // ͐
+    { 4, 7, 3, -2, 24, 10, 21617 }, // ͑
+    { 10, 8, 6, -5, 25, 20, 21627 }, // ͒
+    { 6, 7, 4, -3, 0, 12, 21647 }, // ͓
+    { 6, 6, 4, -3, -1, 11, 21659 }, // ͔
+    { 6, 6, 4, -3, -1, 11, 21670 }, // ͕
+    { 12, 6, 7, -6, -1, 23, 21681 }, // ͖
+    { 4, 7, 3, -2, 24, 9, 21704 }, // ͗
+    { 4, 4, 8, 3, 22, 6, 21713 }, // ͘
+    { 8, 6, 5, -4, -1, 12, 21719 }, // ͙
+    { 12, 7, 7, -6, 0, 25, 21731 }, // ͚
+    { 6, 6, 4, -3, 23, 12, 21756 }, // ͛
+    { 24, 6, 13, -12, -1, 26, 21768 }, // ͜
+    { 24, 6, 13, -12, 23, 26, 21794 }, // ͝
+    { 18, 2, 10, -9, 20, 12, 21820 }, // ͞
+    { 18, 2, 10, -9, -2, 12, 21832 }, // ͟
+    { 24, 5, 13, -12, 22, 24, 21844 }, // ͠
+    { 24, 6, 13, -12, 25, 26, 21868 }, // ͡
+    { 23, 6, 13, -11, -1, 24, 21894 }, // ͢
+    { 6, 8, 4, -3, 25, 16, 21918 }, // ͣ
+    { 7, 8, 5, -3, 25, 15, 21934 }, // ͤ
+    { 2, 9, 2, -1, 27, 9, 21949 }, // ͥ
+    { 7, 8, 5, -3, 25, 18, 21958 }, // ͦ
+    { 7, 8, 5, -3, 25, 17, 21976 }, // ͧ
+    { 6, 8, 4, -3, 25, 13, 21993 }, // ͨ
+    { 7, 10, 5, -3, 27, 21, 22006 }, // ͩ
+    { 7, 9, 5, -3, 27, 22, 22027 }, // ͪ
+    { 11, 7, 7, -5, 25, 28, 22049 }, // ͫ
+    { 5, 7, 4, -2, 25, 11, 22077 }, // ͬ
+    { 5, 9, 4, -2, 26, 14, 22088 }, // ͭ
+    { 8, 7, 5, -4, 25, 17, 22102 }, // ͮ
+    { 7, 7, 5, -3, 25, 16, 22119 }, // ͯ
+    { 19, 21, 20, 0, 21, 67, 22135 }, // Α
+    { 16, 21, 19, 2, 21, 67, 22202 }, // Β
+    { 12, 21, 15, 2, 21, 46, 22269 }, // Γ
+    { 19, 21, 20, 0, 21, 72, 22315 }, // Δ
+    { 13, 21, 16, 2, 21, 54, 22387 }, // Ε
+    { 15, 21, 17, 1, 21, 56, 22441 }, // Ζ
+    { 17, 21, 22, 2, 21, 67, 22497 }, // Η
+    { 20, 23, 23, 1, 22, 85, 22564 }, // Θ
+    { 8, 21, 10, 1, 21, 42, 22649 }, // Ι
+    { 17, 21, 20, 2, 21, 64, 22691 }, // Κ
+    { 18, 21, 19, 0, 21, 65, 22755 }, // Λ
+    { 22, 21, 26, 2, 21, 110, 22820 }, // Μ
+    { 18, 21, 22, 2, 21, 83, 22930 }, // Ν
+    { 16, 21, 18, 1, 21, 51, 23013 }, // Ξ
+    { 20, 23, 23, 1, 22, 75, 23064 }, // Ο
+    { 17, 21, 21, 2, 21, 77, 23139 }, // Π
+    { 15, 21, 18, 2, 21, 57, 23216 }, // Ρ
+    { 15, 21, 17, 1, 21, 54, 23273 }, // Σ
+    { 16, 21, 17, 0, 21, 49, 23327 }, // Τ
+    { 17, 21, 18, 0, 21, 54, 23376 }, // Υ
+    { 23, 21, 25, 1, 21, 87, 23430 }, // Φ
+    { 17, 21, 18, 0, 21, 65, 23517 }, // Χ
+    { 20, 21, 24, 2, 21, 91, 23582 }, // Ψ
+    { 21, 22, 22, 0, 22, 75, 23673 }, // Ω
+    { 17, 17, 19, 1, 16, 60, 23748 }, // α
+    { 15, 30, 18, 2, 23, 88, 23808 }, // β
+    { 15, 23, 16, 0, 16, 61, 23896 }, // γ
+    { 15, 24, 17, 1, 23, 64, 23957 }, // δ
+    { 12, 17, 14, 1, 16, 42, 24021 }, // ε
+    { 13, 29, 15, 1, 23, 63, 24063 }, // ζ
+    { 14, 23, 18, 2, 16, 60, 24126 }, // η
+    { 15, 24, 17, 1, 23, 76, 24186 }, // θ
+    { 8, 17, 11, 2, 16, 27, 24262 }, // ι
+    { 14, 16, 17, 2, 16, 49, 24289 }, // κ
+    { 16, 24, 17, 0, 23, 61, 24338 }, // λ
+    { 16, 23, 19, 2, 16, 69, 24399 }, // μ
+    { 15, 16, 16, 0, 16, 48, 24468 }, // ν
+    { 13, 29, 15, 1, 23, 67, 24516 }, // ξ
+    { 16, 17, 18, 1, 16, 51, 24583 }, // ο
+    { 19, 17, 20, 0, 16, 62, 24634 }, // π
+    { 14, 23, 18, 2, 16, 58, 24696 }, // ρ
+    { 13, 22, 15, 1, 16, 50, 24754 }, // ς
+    { 16, 17, 18, 1, 16, 55, 24804 }, // σ
+    { 14, 17, 15, 0, 16, 50, 24859 }, // τ
+    { 14, 17, 17, 2, 16, 48, 24909 }, // υ
+    { 19, 30, 21, 1, 23, 96, 24957 }, // φ
+    { 18, 23, 19, 0, 16, 71, 25053 }, // χ
+    { 18, 30, 22, 2, 23, 94, 25124 }, // ψ
+    { 21, 17, 23, 1, 16, 73, 25218 }, // ω
+    { 19, 27, 20, 0, 21, 77, 25291 }, // Ạ
+    { 13, 22, 16, 1, 16, 55, 25368 }, // ạ
+    { 19, 29, 20, 0, 29, 83, 25423 }, // Ả
+    { 13, 25, 16, 1, 24, 60, 25506 }, // ả
+    { 19, 29, 20, 0, 29, 91, 25566 }, // Ấ
+    { 15, 25, 17, 1, 24, 68, 25657 }, // ấ
+    { 19, 29, 20, 0, 29, 91, 25725 }, // Ầ
+    { 14, 25, 16, 0, 24, 69, 25816 }, // ầ
+    { 19, 31, 20, 0, 31, 94, 25885 }, // Ẩ
+    { 15, 27, 17, 1, 26, 73, 25979 }, // ẩ
+    { 19, 31, 20, 0, 31, 99, 26052 }, // Ẫ
+    { 13, 27, 16, 1, 26, 72, 26151 }, // ẫ
+    { 19, 34, 20, 0, 28, 94, 26223 }, // Ậ
+    { 13, 29, 16, 1, 23, 70, 26317 }, // ậ
+    { 19, 30, 20, 0, 30, 92, 26387 }, // Ắ
+    { 13, 26, 16, 1, 25, 67, 26479 }, // ắ
+    { 19, 30, 20, 0, 30, 94, 26546 }, // Ằ
+    { 13, 26, 16, 1, 25, 67, 26640 }, // ằ
+    { 19, 31, 20, 0, 31, 95, 26707 }, // Ẳ
+    { 13, 27, 16, 1, 26, 71, 26802 }, // ẳ
+    { 19, 31, 20, 0, 31, 100, 26873 }, // Ẵ
+    { 13, 27, 16, 1, 26, 72, 26973 }, // ẵ
+    { 19, 33, 20, 0, 27, 92, 27045 }, // Ặ
+    { 13, 28, 16, 1, 22, 66, 27137 }, // ặ
+    { 13, 27, 16, 2, 21, 62, 27203 }, // Ẹ
+    { 14, 22, 16, 1, 16, 59, 27265 }, // ẹ
+    { 13, 29, 16, 2, 29, 70, 27324 }, // Ẻ
+    { 14, 25, 16, 1, 24, 68, 27394 }, // ẻ
+    { 13, 27, 16, 2, 27, 70, 27462 }, // Ẽ
+    { 14, 23, 16, 1, 22, 67, 27532 }, // ẽ
+    { 15, 29, 18, 2, 29, 75, 27599 }, // Ế
+    { 16, 25, 18, 1, 24, 75, 27674 }, // ế
+    { 14, 29, 16, 1, 29, 75, 27749 }, // Ề
+    { 15, 25, 16, 0, 24, 77, 27824 }, // ề
+    { 14, 31, 17, 2, 31, 79, 27901 }, // Ể
+    { 15, 27, 17, 1, 26, 78, 27980 }, // ể
+    { 13, 31, 16, 2, 31, 81, 28058 }, // Ễ
+    { 14, 27, 16, 1, 26, 79, 28139 }, // ễ
+    { 13, 34, 16, 2, 28, 77, 28218 }, // Ệ
+    { 14, 29, 16, 1, 23, 74, 28295 }, // ệ
+    { 8, 29, 10, 1, 29, 54, 28369 }, // Ỉ
+    { 7, 24, 9, 1, 24, 37, 28423 }, // ỉ
+    { 8, 27, 10, 1, 21, 49, 28460 }, // Ị
+    { 4, 28, 8, 2, 22, 37, 28509 }, // ị
+    { 20, 28, 23, 1, 22, 84, 28546 }, // Ọ
+    { 16, 22, 18, 1, 16, 59, 28630 }, // ọ
+    { 20, 30, 23, 1, 29, 93, 28689 }, // Ỏ
+    { 16, 25, 18, 1, 24, 66, 28782 }, // ỏ
+    { 20, 30, 23, 1, 29, 99, 28848 }, // Ố
+    { 16, 25, 18, 1, 24, 73, 28947 }, // ố
+    { 20, 30, 23, 1, 29, 99, 29020 }, // Ồ
+    { 16, 25, 18, 1, 24, 72, 29119 }, // ồ
+    { 20, 32, 23, 1, 31, 102, 29191 }, // Ổ
+    { 16, 27, 18, 1, 26, 76, 29293 }, // ổ
+    { 20, 32, 23, 1, 31, 104, 29369 }, // Ỗ
+    { 16, 27, 18, 1, 26, 79, 29473 }, // ỗ
+    { 20, 34, 23, 1, 28, 101, 29552 }, // Ộ
+    { 16, 29, 18, 1, 23, 76, 29653 }, // ộ
+    { 23, 29, 25, 1, 28, 97, 29729 }, // Ớ
+    { 18, 24, 20, 1, 23, 73, 29826 }, // ớ
+    { 23, 29, 25, 1, 28, 96, 29899 }, // Ờ
+    { 18, 24, 20, 1, 23, 72, 29995 }, // ờ
+    { 23, 30, 25, 1, 29, 99, 30067 }, // Ở
+    { 18, 25, 20, 1, 24, 76, 30166 }, // ở
+    { 23, 28, 25, 1, 27, 98, 30242 }, // Ỡ
+    { 18, 23, 20, 1, 22, 74, 30340 }, // ỡ
+    { 23, 29, 25, 1, 23, 93, 30414 }, // Ợ
+    { 18, 25, 20, 1, 19, 70, 30507 }, // ợ
+    { 17, 27, 21, 2, 21, 80, 30577 }, // Ụ
+    { 14, 22, 18, 2, 16, 56, 30657 }, // ụ
+    { 17, 30, 21, 2, 29, 92, 30713 }, // Ủ
+    { 14, 25, 18, 2, 24, 63, 30805 }, // ủ
+    { 22, 29, 25, 2, 28, 106, 30868 }, // Ứ
+    { 19, 24, 22, 2, 23, 75, 30974 }, // ứ
+    { 22, 29, 25, 2, 28, 104, 31049 }, // Ừ
+    { 19, 24, 22, 2, 23, 78, 31153 }, // ừ
+    { 22, 30, 25, 2, 29, 107, 31231 }, // Ử
+    { 19, 25, 22, 2, 24, 77, 31338 }, // ử
+    { 22, 28, 25, 2, 27, 105, 31415 }, // Ữ
+    { 19, 23, 22, 2, 22, 79, 31520 }, // ữ
+    { 22, 29, 25, 2, 23, 102, 31599 }, // Ự
+    { 19, 25, 22, 2, 19, 74, 31701 }, // ự
+    { 17, 28, 18, 0, 28, 67, 31775 }, // Ỳ
+    { 15, 30, 16, 0, 23, 73, 31842 }, // ỳ
+    { 17, 27, 18, 0, 21, 63, 31915 }, // Ỵ
+    { 15, 23, 16, 0, 16, 65, 31978 }, // ỵ
+    { 17, 29, 18, 0, 29, 72, 32043 }, // Ỷ
+    { 15, 31, 16, 0, 24, 81, 32115 }, // ỷ
+    { 17, 27, 18, 0, 27, 70, 32196 }, // Ỹ
+    { 15, 29, 16, 0, 22, 78, 32266 }, // ỹ
+    { 0, 0, 15, 0, 0, 0, 32344 }, //  
+    { 0, 0, 29, 0, 0, 0, 32344 }, //  
+    { 0, 0, 15, 0, 0, 0, 32344 }, //  
+    { 0, 0, 29, 0, 0, 0, 32344 }, //  
+    { 0, 0, 10, 0, 0, 0, 32344 }, //  
+    { 0, 0, 7, 0, 0, 0, 32344 }, //  
+    { 0, 0, 5, 0, 0, 0, 32344 }, //  
+    { 0, 0, 17, 0, 0, 0, 32344 }, //  
+    { 0, 0, 8, 0, 0, 0, 32344 }, //  
+    { 0, 0, 5, 0, 0, 0, 32344 }, //  
+    { 0, 0, 3, 0, 0, 0, 32344 }, //  
+    { 0, 0, 1, 0, 0, 0, 32344 }, // ​
+    { 0, 0, 1, 0, 0, 0, 32344 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 32344 }, // ‍
+    { 8, 25, 8, -1, 21, 45, 32344 }, // ‎
+    { 8, 25, 2, -7, 21, 45, 32389 }, // ‏
+    { 8, 3, 10, 1, 9, 7, 32434 }, // ‐
+    { 8, 3, 10, 1, 9, 7, 32441 }, // ‑
+    { 15, 3, 17, 1, 12, 18, 32448 }, // ‒
+    { 13, 3, 15, 1, 9, 11, 32466 }, // –
+    { 27, 3, 29, 1, 9, 21, 32477 }, // —
+    { 27, 3, 29, 1, 9, 21, 32498 }, // ―
+    { 10, 31, 16, 3, 23, 74, 32519 }, // ‖
+    { 14, 7, 14, -1, 0, 25, 32593 }, // ‗
+    { 5, 8, 6, 0, 21, 13, 32618 }, // ‘
+    { 5, 8, 6, 0, 21, 12, 32631 }, // ’
+    { 6, 8, 7, 0, 4, 12, 32643 }, // ‚
+    { 5, 8, 6, 0, 21, 13, 32655 }, // ‛
+    { 11, 8, 12, 0, 21, 24, 32668 }, // “
+    { 11, 8, 12, 0, 21, 23, 32692 }, // ”
+    { 11, 8, 12, 0, 4, 26, 32715 }, // „
+    { 11, 8, 12, 0, 21, 25, 32741 }, // ‟
+    { 13, 23, 15, 1, 23, 55, 32766 }, // †
+    { 13, 23, 15, 1, 23, 54, 32821 }, // ‡
+    { 7, 8, 11, 2, 15, 16, 32875 }, // •
+    { 9, 10, 11, 1, 16, 15, 32891 }, // ‣
+    { 5, 5, 15, 5, 4, 8, 32906 }, // ․
+    { 12, 5, 16, 2, 4, 15, 32914 }, // ‥
+    { 19, 5, 23, 2, 4, 23, 32929 }, // …
+    { 4, 5, 8, 2, 10, 8, 32952 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 32960 }, //  
+    { 0, 0, 18, 0, 0, 0, 32960 }, //  
+    { 8, 22, 8, -1, 18, 38, 32960 }, // ‪
+    { 8, 22, 2, -7, 18, 38, 32998 }, // ‫
+    { 8, 25, 5, -4, 21, 40, 33036 }, // ‬
+    { 8, 25, 5, -4, 21, 38, 33076 }, // ‭
+    { 8, 25, 5, -4, 21, 38, 33114 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 33152 }, //  
+    { 32, 23, 34, 1, 22, 159, 33152 }, // ‰
+    { 43, 23, 45, 1, 22, 193, 33311 }, // ‱
+    { 7, 8, 9, 1, 21, 12, 33504 }, // ′
+    { 12, 8, 14, 1, 21, 24, 33516 }, // ″
+    { 17, 8, 19, 1, 21, 36, 33540 }, // ‴
+    { 7, 8, 7, -1, 21, 12, 33576 }, // ‵
+    { 12, 8, 13, -1, 21, 25, 33588 }, // ‶
+    { 17, 8, 18, -1, 21, 37, 33613 }, // ‷
+    { 12, 10, 13, 0, 3, 26, 33650 }, // ‸
+    { 7, 13, 9, 1, 14, 20, 33676 }, // ‹
+    { 7, 13, 9, 1, 14, 19, 33696 }, // ›
+    { 22, 23, 24, 1, 22, 95, 33715 }, // ※
+    { 11, 22, 15, 2, 21, 60, 33810 }, // ‼
+    { 13, 23, 14, 0, 22, 46, 33870 }, // ‽
+    { 16, 3, 16, -1, 25, 7, 33916 }, // ‾
+    { 18, 7, 19, 0, 0, 21, 33923 }, // ‿
+    { 18, 8, 19, 0, 24, 22, 33944 }, // ⁀
+    { 11, 19, 12, 0, 12, 40, 33966 }, // ⁁
+    { 33, 28, 34, 0, 23, 132, 34006 }, // ⁂
+    { 8, 3, 10, 1, 9, 7, 34138 }, // ⁃
+    { 16, 21, 11, -6, 21, 43, 34145 }, // ⁄
+    { 7, 26, 10, 2, 21, 55, 34188 }, // ⁅
+    { 8, 26, 9, 0, 21, 48, 34243 }, // ⁆
+    { 25, 23, 26, 0, 22, 89, 34291 }, // ⁇
+    { 18, 23, 20, 0, 22, 75, 34380 }, // ⁈
+    { 18, 23, 21, 2, 22, 72, 34455 }, // ⁉
+    { 15, 16, 17, 1, 16, 44, 34527 }, // ⁊
+    { 16, 27, 19, 2, 23, 111, 34571 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 34682 }, // ⁌
+    { 16, 15, 19, 2, 16, 61, 34742 }, // ⁍
+    { 14, 14, 16, 1, 8, 39, 34803 }, // ⁎
+    { 6, 21, 8, 1, 17, 22, 34842 }, // ⁏
+    { 18, 31, 19, 0, 24, 60, 34864 }, // ⁐
+    { 14, 29, 16, 1, 23, 78, 34924 }, // ⁑
+    { 11, 23, 12, 0, 22, 46, 35002 }, // ⁒
+    { 25, 5, 29, 2, 11, 29, 35048 }, // ⁓
+    { 18, 7, 19, 0, 0, 24, 35077 }, // ⁔
+    { 16, 16, 17, 0, 15, 54, 35101 }, // ⁕
+    { 13, 23, 15, 1, 22, 33, 35155 }, // ⁖
+    { 22, 8, 24, 1, 21, 49, 35188 }, // ⁗
+    { 22, 23, 24, 1, 22, 49, 35237 }, // ⁘
+    { 22, 23, 24, 1, 22, 51, 35286 }, // ⁙
+    { 4, 23, 6, 1, 22, 15, 35337 }, // ⁚
+    { 17, 23, 19, 1, 22, 40, 35352 }, // ⁛
+    { 22, 23, 24, 1, 22, 103, 35392 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 35495 }, // ⁝
+    { 4, 23, 8, 2, 22, 27, 35517 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 35544 }, //  
+    { 0, 0, 18, 0, 0, 0, 35544 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 35544 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 35544 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 35544 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 35544 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 35544 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 35544 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 35544 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 35544 }, // ⁩
+    { 8, 25, 5, -4, 21, 39, 35544 }, // ⁪
+    { 8, 25, 5, -4, 21, 42, 35583 }, // ⁫
+    { 8, 25, 5, -4, 21, 37, 35625 }, // ⁬
+    { 8, 25, 5, -4, 21, 37, 35662 }, // ⁭
+    { 8, 25, 5, -4, 21, 41, 35699 }, // ⁮
+    { 8, 25, 5, -4, 21, 38, 35740 }, // ⁯
+    { 10, 14, 11, 0, 25, 37, 35778 }, // ⁰
+    { 3, 14, 5, 1, 22, 19, 35815 }, // ⁱ
+    { 10, 13, 11, 0, 25, 26, 35834 }, // ⁴
+    { 10, 14, 11, 0, 25, 31, 35860 }, // ⁵
+    { 10, 14, 11, 0, 25, 34, 35891 }, // ⁶
+    { 10, 13, 11, 0, 25, 24, 35925 }, // ⁷
+    { 10, 14, 11, 0, 25, 35, 35949 }, // ⁸
+    { 10, 14, 11, 0, 25, 39, 35984 }, // ⁹
+    { 8, 9, 10, 1, 22, 16, 36023 }, // ⁺
+    { 8, 3, 10, 1, 19, 6, 36039 }, // ⁻
+    { 8, 6, 10, 1, 20, 12, 36045 }, // ⁼
+    { 6, 17, 8, 1, 27, 23, 36057 }, // ⁽
+    { 5, 17, 7, 0, 27, 24, 36080 }, // ⁾
+    { 10, 10, 12, 1, 18, 34, 36104 }, // ⁿ
+    { 10, 14, 11, 0, 9, 37, 36138 }, // ₀
+    { 6, 13, 10, 1, 9, 17, 36175 }, // ₁
+    { 9, 13, 10, 0, 9, 23, 36192 }, // ₂
+    { 10, 14, 11, 0, 9, 28, 36215 }, // ₃
+    { 10, 13, 11, 0, 9, 26, 36243 }, // ₄
+    { 10, 14, 11, 0, 9, 31, 36269 }, // ₅
+    { 10, 14, 11, 0, 9, 34, 36300 }, // ₆
+    { 10, 13, 11, 0, 9, 24, 36334 }, // ₇
+    { 10, 14, 11, 0, 9, 35, 36358 }, // ₈
+    { 10, 14, 11, 0, 9, 39, 36393 }, // ₉
+    { 8, 9, 10, 1, 6, 16, 36432 }, // ₊
+    { 8, 3, 10, 1, 3, 6, 36448 }, // ₋
+    { 8, 6, 10, 1, 4, 12, 36454 }, // ₌
+    { 6, 17, 8, 1, 11, 23, 36466 }, // ₍
+    { 5, 17, 7, 0, 11, 24, 36489 }, // ₎
+    { 10, 10, 11, 0, 7, 26, 36513 }, // ₐ
+    { 9, 10, 11, 1, 7, 28, 36539 }, // ₑ
+    { 10, 10, 12, 1, 7, 28, 36567 }, // ₒ
+    { 10, 10, 11, 0, 7, 26, 36595 }, // ₓ
+    { 10, 10, 11, 0, 7, 26, 36621 }, // ₔ
+    { 10, 14, 12, 1, 11, 43, 36647 }, // ₕ
+    { 9, 14, 11, 1, 11, 41, 36690 }, // ₖ
+    { 3, 14, 5, 1, 11, 21, 36731 }, // ₗ
+    { 16, 10, 18, 1, 7, 52, 36752 }, // ₘ
+    { 10, 10, 12, 1, 7, 36, 36804 }, // ₙ
+    { 10, 14, 12, 1, 7, 44, 36840 }, // ₚ
+    { 9, 10, 10, 0, 7, 23, 36884 }, // ₛ
+    { 7, 12, 8, 0, 9, 24, 36907 }, // ₜ
+    { 15, 22, 17, 1, 22, 61, 36931 }, // ₠
+    { 16, 25, 18, 1, 23, 94, 36992 }, // ₡
+    { 15, 23, 17, 1, 22, 66, 37086 }, // ₢
+    { 15, 21, 17, 1, 21, 50, 37152 }, // ₣
+    { 16, 22, 17, 0, 22, 62, 37202 }, // ₤
+    { 23, 24, 27, 2, 20, 97, 37264 }, // ₥
+    { 17, 21, 18, 0, 21, 82, 37361 }, // ₦
+    { 20, 22, 23, 2, 21, 74, 37443 }, // ₧
+    { 22, 22, 25, 2, 21, 99, 37517 }, // ₨
+    { 20, 21, 21, 0, 21, 104, 37616 }, // ₩
+    { 19, 21, 23, 2, 21, 95, 37720 }, // ₪
+    { 17, 28, 19, 1, 23, 97, 37815 }, // ₫
+    { 17, 23, 18, 0, 22, 61, 37912 }, // €
+    { 17, 21, 18, 0, 21, 71, 37973 }, // ₭
+    { 17, 21, 18, 0, 21, 60, 38044 }, // ₮
+    { 28, 29, 29, 0, 22, 125, 38104 }, // ₯
+    { 16, 29, 17, 0, 22, 80, 38229 }, // ₰
+    { 17, 21, 18, 0, 21, 66, 38309 }, // ₱
+    { 19, 26, 21, 1, 23, 82, 38375 }, // ₲
+    { 18, 21, 19, 0, 21, 64, 38457 }, // ₳
+    { 16, 23, 17, 0, 22, 61, 38521 }, // ₴
+    { 17, 26, 19, 1, 23, 86, 38582 }, // ₵
+    { 18, 21, 19, 0, 20, 76, 38668 }, // ₶
+    { 20, 25, 21, 0, 22, 97, 38744 }, // ₷
+    { 16, 21, 17, 0, 21, 64, 38841 }, // ₸
+    { 13, 21, 17, 2, 21, 45, 38905 }, // ₹
+    { 16, 22, 17, 0, 21, 64, 38950 }, // ₺
+    { 23, 23, 24, 0, 22, 89, 39014 }, // ₻
+    { 21, 21, 24, 1, 21, 75, 39103 }, // ₼
+    { 16, 21, 17, 0, 21, 61, 39178 }, // ₽
+    { 20, 23, 22, 1, 23, 97, 39239 }, // ₾
+    { 14, 27, 17, 2, 24, 86, 39336 }, // ₿
+    { 12, 21, 14, 1, 16, 50, 39422 }, // ⃀
+    { 15, 3, 17, 1, 12, 14, 39472 }, // −
+    { 27, 28, 29, 1, 23, 112, 39486 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
@@ -4175,4 +3297,5 @@ static const EpdFontData notosans_14_regular = {
     32,
     -9,
     true,
+    true,
 };
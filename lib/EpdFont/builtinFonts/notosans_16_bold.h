@@ -2,5550 +2,3988 @@
  * generated by fontconvert.py
  * name: notosans_16_bold
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_boldBitmaps[76109] = {
-    0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x0F, 0xFC, 0x2F, 0xF0,
-    0xBF, 0xC2, 0xFF, 0x0B, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xF8, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x3F, 0xF4, 0xFF, 0xE3, 0xFF, 0x4B, 0xFC, 0x01, 0x40, 0xFF, 0x82, 0xFE, 0xFF,
-    0x83, 0xFF, 0xFF, 0x82, 0xFE, 0xBF, 0x82, 0xFE, 0xBF, 0x82, 0xFE, 0xBF, 0x41, 0xFD, 0x7F, 0x41,
-    0xFD, 0x7F, 0x41, 0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x0F,
-    0xD0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0xFE, 0x5B, 0xF5,
-    0x50, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0x6F, 0xD5, 0xFF, 0x55, 0x40, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00,
-    0x00, 0xFE, 0x07, 0xF4, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0x00, 0x00,
-    0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x6F, 0xFA, 0x40, 0x02, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xDB, 0x96, 0xF0, 0xBF, 0xD2, 0xE0, 0x04, 0x2F, 0xF4, 0xB8, 0x00, 0x07,
-    0xFF, 0x6E, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0xB8,
-    0xFF, 0xE0, 0x00, 0x2E, 0x0F, 0xFD, 0x80, 0x0B, 0x87, 0xFE, 0xBF, 0x96, 0xFB, 0xFF, 0x6F, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x6B, 0xF5, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xD0, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x03, 0xFC,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0xBF,
-    0x43, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC2, 0xFD, 0x06, 0xA0, 0x02, 0xFD, 0x0F, 0xF0, 0xFF,
-    0x0F, 0xFF, 0x80, 0x3F, 0xDB, 0xF8, 0xBF, 0x4F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFC, 0x3F, 0x8B, 0xFE,
-    0xFF, 0x00, 0xFF, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F, 0xE0, 0x06, 0xE8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC,
-    0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0xC0, 0x00,
-    0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0xFF,
-    0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0xBF, 0x80, 0x00, 0x3F, 0x80, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x0B, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0x6F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xF8, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x3F, 0xF8, 0xBF, 0xF0, 0x7F, 0xF0, 0x7F, 0xF0, 0x2F, 0xFD, 0xFF, 0xD0, 0xBF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xE0, 0x02, 0xFF, 0xFF, 0x40, 0xBF, 0xF0, 0x00, 0xBF, 0xFE,
-    0x00, 0x7F, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFD, 0xBF, 0xF4, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xFD, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xEF, 0xFA, 0xFE, 0xBF, 0xAF, 0xD7, 0xF5, 0xFD, 0x7F,
-    0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0x40,
-    0x1F, 0xF0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0xBF,
-    0xC0, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x0B, 0xFC, 0x00, 0x7F, 0xC0,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0x54, 0xBF, 0x40, 0x0F, 0xF0,
-    0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF,
-    0x00, 0x3F, 0xD0, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x01, 0xFF,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF0, 0x0B, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x2F, 0xF0,
-    0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x05, 0x40, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x01, 0xD0, 0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02,
-    0xFE, 0x07, 0xF8, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC2, 0xFF, 0x0F, 0xF8, 0x3F, 0xC1, 0xFF,
-    0x0B, 0xF4, 0x3F, 0xC0, 0x54, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF4, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0x03,
-    0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x0B, 0xFC, 0x7F, 0xE0, 0x02, 0xFF, 0x6F, 0xF4,
-    0x00, 0x7F, 0xEB, 0xFD, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x07, 0xFE, 0xBF, 0xD0, 0x01, 0xFF,
-    0x9F, 0xF4, 0x00, 0x7F, 0xE3, 0xFE, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x0F, 0xFC, 0x2F, 0xF8, 0x0B,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF3, 0xFF, 0xDF, 0xFC, 0x3F, 0x83,
-    0xFF, 0x07, 0x40, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFD, 0x03, 0xFF, 0xC0, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xE4, 0x03, 0xFF, 0xC0, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x17, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0A, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFE, 0xA4, 0x00, 0x0B, 0xFF, 0x6F, 0xFA, 0xBF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xBF, 0xE0,
-    0x00, 0x03, 0xFD, 0xFF, 0x80, 0x00, 0x2F, 0xD3, 0xFE, 0x00, 0x01, 0xFE, 0x0F, 0xF8, 0x00, 0x0F,
-    0xF0, 0x7F, 0xE0, 0x00, 0xBF, 0x41, 0xFF, 0x80, 0x07, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xC0, 0x1F,
-    0xF8, 0x02, 0xFD, 0x00, 0x7F, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xF9, 0x55, 0x54, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x40, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF1, 0xE4, 0x00, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFD, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x15, 0x40, 0x07, 0xFC, 0x7F, 0xFE, 0x02, 0xFF, 0x7F, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x97, 0xFF, 0xDF, 0xFF, 0x00, 0x2F, 0xFB, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0x3F, 0xF7, 0xFD, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x07,
-    0xFE, 0x3F, 0xF8, 0x03, 0xFF, 0x47, 0xFF, 0xEF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x55,
-    0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0xAF, 0xFE, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC3, 0xFE, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0x07, 0xFF, 0x43,
-    0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xF8, 0x7F, 0xE0, 0x03, 0xFF, 0x6F,
-    0xF0, 0x00, 0x3F, 0xEF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xBF, 0xE0, 0x01, 0xFF,
-    0x9F, 0xFE, 0x56, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFD, 0x03, 0xFF, 0x8B,
-    0xFE, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x01, 0xFF, 0xBF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xFF, 0x80, 0x0F, 0xFF, 0x7F, 0xF8, 0x1F, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F, 0xFF, 0xE3, 0xFE, 0x00, 0x6A, 0x90, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x03,
-    0xAA, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE4, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0x40, 0xBF, 0xC3, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x0F,
-    0xFD, 0x3F, 0xF8, 0xFF, 0xD2, 0xFF, 0x00, 0x50, 0x06, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F,
-    0xF4, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x2F, 0xF0, 0xBF, 0xC3, 0xFE, 0x0F, 0xF0, 0x7F, 0xC2, 0xFD, 0x0F, 0xF0,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x6A,
-    0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x6F, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x2F,
-    0x40, 0x1F, 0xFC, 0x04, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x40, 0x1B, 0xFF, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xC0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x07, 0xF8, 0x00,
-    0xAF, 0xA4, 0x0B, 0xF4, 0x0F, 0xF0, 0x0B, 0xFF, 0xFF, 0x43, 0xF8, 0x1F, 0xD0, 0x3F, 0xFF, 0xFF,
-    0x42, 0xFC, 0x2F, 0xC0, 0xBF, 0xD0, 0xBF, 0x41, 0xFC, 0x3F, 0x81, 0xFF, 0x00, 0x7F, 0x41, 0xFD,
-    0x3F, 0x42, 0xFD, 0x00, 0x7F, 0x00, 0xFD, 0x7F, 0x43, 0xFC, 0x00, 0xBF, 0x00, 0xFD, 0x7F, 0x03,
-    0xFC, 0x00, 0xBF, 0x01, 0xFC, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFC, 0x7F, 0x43, 0xFC, 0x00,
-    0xFF, 0x03, 0xFC, 0x7F, 0x42, 0xFE, 0x02, 0xFF, 0x47, 0xF4, 0x3F, 0x80, 0xFF, 0xEF, 0xFF, 0xEF,
-    0xF0, 0x3F, 0xC0, 0x7F, 0xFF, 0xCF, 0xFF, 0xC0, 0x2F, 0xD0, 0x1F, 0xFE, 0x03, 0xFF, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0xFF, 0xFE, 0x56, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xFF, 0xFA, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x06, 0xFF, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0xC3, 0xFF, 0x00, 0x07,
-    0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0xFF, 0xD5, 0x5F, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xEA,
-    0xAF, 0xFF, 0x43, 0xFF, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x3F,
-    0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x07, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0,
-    0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF5, 0x5B, 0xFF, 0xF8, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00,
-    0x07, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x5F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xEA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEA, 0xAA, 0x8F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x40, 0x6F, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x05, 0x55, 0x54, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x3F, 0xFC,
-    0x00, 0x07, 0xFD, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xD5, 0x55, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF8, 0x15, 0xBF, 0xF4, 0x7F, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0xFF,
-    0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF,
-    0xD0, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xFF, 0xC0,
-    0x03, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xBF, 0xDF,
-    0xF7, 0xFC, 0x00, 0x0F, 0xF7, 0xFD, 0xFF, 0x6F, 0xD0, 0x00, 0xFF, 0x3F, 0xDF, 0xF5, 0xFE, 0x00,
-    0x1F, 0xD3, 0xFD, 0xFF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F, 0xDF, 0xF4, 0xFF, 0x40, 0x3F, 0xC7, 0xFD,
-    0xFF, 0x47, 0xF8, 0x07, 0xF4, 0x7F, 0xDF, 0xF8, 0x3F, 0xC0, 0xFF, 0x07, 0xFD, 0xFF, 0x83, 0xFD,
-    0x0F, 0xF0, 0x7F, 0xDF, 0xF8, 0x2F, 0xE1, 0xFE, 0x07, 0xFD, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0x7F,
-    0xDF, 0xF8, 0x0F, 0xF7, 0xFC, 0x07, 0xFD, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x7F, 0xDF, 0xF8, 0x07,
-    0xFF, 0xF0, 0x07, 0xFD, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x7F, 0xDF, 0xF8, 0x02, 0xFF, 0xE0, 0x07,
-    0xFD, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xDF, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF,
-    0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF,
-    0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC,
-    0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F,
-    0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB,
-    0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3F, 0xFF,
-    0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xF5, 0x6F, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0xC3,
-    0xFF, 0xAB, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xAA, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
-    0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0xA8, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x01,
-    0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0,
-    0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00,
-    0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0x00, 0x7E, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x0F,
-    0xFC, 0x7E, 0x40, 0x0B, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57,
-    0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xDB, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x02, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x0F, 0xF8,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x00, 0x07, 0xFD, 0x0B, 0xFC, 0x00, 0x00, 0x3F,
-    0xE0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0x6F, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0x80,
-    0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x7F, 0xFE, 0x00, 0x0B, 0xFC, 0x0B, 0xFC,
-    0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x3F,
-    0xE0, 0x03, 0xFE, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x01, 0xFE, 0x7F, 0x80, 0x2F, 0xF0, 0x02,
-    0xFF, 0x00, 0xBF, 0x4F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xC3, 0xFC, 0x03, 0xFE, 0x00,
-    0x0F, 0xF8, 0x0F, 0xF0, 0xFF, 0x41, 0xFF, 0x40, 0x03, 0xFF, 0x07, 0xFC, 0x2F, 0xE0, 0xBF, 0xC0,
-    0x00, 0xBF, 0xC2, 0xFD, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x1F, 0xF4, 0xFF, 0x00, 0xFF, 0x0F, 0xF8,
-    0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0x00, 0x00, 0xFF, 0x9F, 0xE0, 0x0B, 0xF9, 0xFF,
-    0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xD0, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x03,
-    0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x07, 0xFF,
-    0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC2,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x0B, 0xFF,
-    0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00,
-    0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xA8, 0xBF, 0x80,
-    0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B,
-    0xFF, 0xF2, 0xFF, 0xFC, 0xBF, 0xFF, 0x05, 0x55, 0x40, 0xBF, 0xC0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xAB, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B,
-    0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF,
-    0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE,
-    0x3F, 0xFF, 0x85, 0x55, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00,
-    0x07, 0xF0, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x2F, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0xBF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x0A, 0x90, 0x00, 0x01,
-    0xA8, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF1, 0x55, 0x55, 0x55, 0x00, 0x6A, 0xA0, 0x03,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0xBE, 0x00, 0x05, 0x65, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xF5, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x5B, 0xFE, 0x01, 0xBF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0xBF, 0xF9, 0xFF, 0xD0, 0x07, 0xFE, 0xBF,
-    0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F, 0xF9, 0xFF, 0xE5, 0xBF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0x7F, 0xFE, 0x03, 0xF8, 0x00, 0x50, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x01, 0x94, 0x00, 0xBF, 0xD3, 0xFF, 0xF0, 0x0B, 0xFD, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xEA, 0xFF, 0xF8, 0xBF, 0xF4, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFC,
-    0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00,
-    0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x01, 0xFF, 0xCB,
-    0xFF, 0x80, 0x3F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xCF, 0xFF,
-    0xFC, 0x0B, 0xF8, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00,
-    0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F,
-    0xFC, 0x00, 0x10, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x65, 0x07, 0xFE, 0x00,
-    0xFF, 0xFC, 0x7F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFA, 0xBF,
-    0xFE, 0x3F, 0xFC, 0x01, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF,
-    0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F,
-    0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF,
-    0xEF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x3F, 0xE0, 0x0B, 0xFF, 0x81, 0xFE,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0x0F, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0xF9, 0x5B, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x01, 0x55, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF,
-    0xE6, 0x90, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x0A, 0xFF, 0xEA, 0x90, 0x02, 0xFF, 0x40, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xD3, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x9B, 0xFF, 0xE3, 0xFF, 0xC0, 0x0F, 0xFE, 0x3F, 0xF4, 0x00, 0xBF,
-    0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xE0,
-    0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE3, 0xFF, 0x40, 0x0B, 0xFE,
-    0x3F, 0xFC, 0x01, 0xFF, 0xE1, 0xFF, 0xFA, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xF7, 0xFE, 0x00, 0xBF, 0xF8, 0x7F, 0xE0, 0x00, 0x54, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x0F, 0xFD, 0x1E, 0x40, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xBF, 0xFE, 0x80, 0x00, 0x15, 0x40, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0x94, 0x00, 0xBF,
-    0xD3, 0xFF, 0xF8, 0x0B, 0xFD, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xF9, 0xBF,
-    0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xDB, 0xFE,
-    0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0,
-    0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD,
-    0x05, 0x07, 0xFD, 0xBF, 0xEB, 0xFE, 0x7F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFE, 0xBF,
-    0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB,
-    0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0x00, 0x05, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xE0, 0x0B,
-    0xFE, 0x00, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x1F, 0xFD, 0xFF, 0xFF, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x15, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0xFF, 0xE0,
-    0x1F, 0xF8, 0x0F, 0xFF, 0x00, 0x7F, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0x8B, 0xFF, 0x00, 0x07, 0xFD,
-    0x7F, 0xF0, 0x00, 0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x2F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x01,
-    0xFF, 0x80, 0x7F, 0xF4, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x7F, 0xE0,
-    0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x15, 0x4B, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB,
-    0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD,
-    0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0x00,
-    0x00, 0x19, 0x40, 0x00, 0x69, 0x00, 0x2F, 0xE1, 0xFF, 0xFE, 0x03, 0xFF, 0xF8, 0x0B, 0xFD, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xAF, 0xFF,
-    0xFE, 0x6F, 0xFF, 0x2F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x1F, 0xFD, 0x00,
-    0x3F, 0xF2, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF2, 0xFF,
-    0x40, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x00,
-    0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF2, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF8, 0x3F,
-    0xFF, 0x80, 0xBF, 0xCF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB,
-    0xFF, 0x80, 0x1F, 0xFC, 0xBF, 0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00,
-    0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0x57, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x07, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x02,
-    0xFF, 0x82, 0xFF, 0xC0, 0x0F, 0xFD, 0x03, 0xFF, 0xEA, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x40, 0xBF, 0xCF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFE, 0xAF, 0xFF, 0x8B, 0xFF, 0x40, 0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0xFF, 0xCB, 0xFE, 0x00,
-    0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB,
-    0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x1F, 0xFC, 0xBF, 0xF8, 0x03,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFD, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xD2, 0xFF, 0xE0, 0x0B, 0xFD, 0x01, 0x50, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x0F, 0xFF, 0xC3,
-    0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x5B, 0xFF, 0xE3, 0xFF,
-    0xC0, 0x0F, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE7, 0xFF, 0x00, 0x07, 0xFE, 0x7F, 0xF0, 0x00, 0x3F,
-    0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xF0,
-    0x00, 0x7F, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x3F, 0xFC, 0x01, 0xFF, 0xE1, 0xFF, 0xFA, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x00, 0xBF, 0xF8, 0x7F, 0xE0, 0x00, 0x54,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x19, 0x2F, 0xD0, 0xBF, 0xDB, 0xF8, 0xBF, 0xF6, 0xFF, 0xBF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x4B, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFE, 0x41, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xE0, 0x0B, 0xC1, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0xBF, 0xD6, 0x00, 0x02, 0xFF, 0x5F, 0xE5, 0x6F, 0xFC, 0x7F, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x2F, 0xFC, 0xBF, 0xF4,
-    0x07, 0xFF, 0xC7, 0xFF, 0xFB, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x01, 0xFF,
-    0x40, 0x03, 0xFE, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x47, 0xFD, 0x00,
-    0x00, 0xFF, 0x8B, 0xFC, 0x00, 0x00, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0xE0, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x80, 0x1F, 0xF4, 0x2F, 0xF0, 0x07, 0xFF, 0xF0, 0x0B, 0xFC, 0x07, 0xFD, 0x02, 0xFE,
-    0xFC, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFE, 0x7F, 0x40, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0x8F, 0xE0,
-    0x7F, 0xD0, 0x07, 0xFD, 0x1F, 0xD3, 0xFC, 0x2F, 0xF0, 0x00, 0xFF, 0x8B, 0xF0, 0xBF, 0x0F, 0xF8,
-    0x00, 0x3F, 0xE3, 0xFC, 0x1F, 0xD3, 0xFD, 0x00, 0x0B, 0xFC, 0xFE, 0x03, 0xF9, 0xFF, 0x00, 0x01,
-    0xFF, 0x3F, 0x40, 0xFE, 0xBF, 0xC0, 0x00, 0x3F, 0xEF, 0xC0, 0x2F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF0, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF,
-    0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0x01, 0xFF, 0xCB, 0xFE, 0x00,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xCF, 0xFD, 0x00, 0x03, 0xFF, 0x87, 0xFF, 0x00, 0x0B, 0xFF, 0x02,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0xBF, 0xF0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF,
-    0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x01, 0xAE, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xE0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F,
-    0xC0, 0x00, 0xFF, 0xC0, 0x17, 0xFF, 0x80, 0xBF, 0xFF, 0x00, 0xBF, 0xE4, 0x00, 0xBF, 0xFD, 0x00,
-    0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00,
-    0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x7F, 0xF9, 0x00, 0x3F,
-    0xFF, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0xBA, 0x40, 0x00, 0xBF,
-    0xF4, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0xD4, 0x00, 0xBF, 0xFE, 0x00, 0x1B, 0xFE, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFD, 0x02,
-    0xFF, 0x40, 0x03, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x6F, 0xFD, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xF8, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0xAB, 0xFF,
-    0xFF, 0xEA, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xB8, 0x07, 0xFF, 0xFF, 0x50, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0x7F, 0xC0, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x0B, 0xFC,
-    0x2F, 0xF0, 0xBF, 0xC3, 0xFF, 0x0F, 0xFC, 0x3F, 0xF4, 0xFF, 0xD3, 0xFF, 0x4F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00,
-    0xBF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xD6, 0xFC, 0x3F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0xFF, 0xF0, 0x01, 0x91, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xF4, 0x01,
-    0xBF, 0xFF, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFC, 0x01, 0x90, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x02, 0xFE, 0xFF, 0xEF, 0xE0,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
-    0x80, 0x3F, 0x40, 0x0B, 0xF0, 0x0F, 0xD0, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0xBF, 0x40,
-    0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8,
-    0x6A, 0x4B, 0xC0, 0x04, 0x00, 0x00, 0x80, 0xBF, 0xD0, 0x00, 0x1F, 0xF9, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x2F, 0xF0, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x0F,
-    0xF8, 0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x00, 0x3F, 0xD1, 0xFF, 0x00, 0x00, 0xBF, 0xCF,
-    0xF8, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x02, 0xAF, 0xFF, 0xEA, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0xFF, 0xD5, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x06, 0xAF, 0xFE, 0xA4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x57, 0xFF, 0x55, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x15, 0x50, 0x00, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC2, 0xFF, 0xAB, 0xFC, 0x3F, 0xC0, 0x06, 0x43, 0xFC, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xE0, 0x1F, 0xEB,
-    0xFF, 0x83, 0xFC, 0x07, 0xFC, 0x3F, 0x80, 0x1F, 0xD3, 0xFC, 0x00, 0xFE, 0x3F, 0xE0, 0x1F, 0xD1,
-    0xFF, 0xD3, 0xFC, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFE, 0x78, 0x00, 0x3F, 0xD7, 0xFF, 0xBF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0xBF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x40, 0xFD, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x16,
-    0x50, 0x2F, 0x80, 0x07, 0xC0, 0x1F, 0xFF, 0xD0, 0xBD, 0x00, 0xF4, 0x07, 0xFF, 0xFC, 0x03, 0xF0,
-    0x1F, 0x00, 0xFD, 0x00, 0x40, 0x1F, 0x43, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x3C, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xC7, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xC3, 0xC0, 0x3E,
-    0x00, 0x00, 0x00, 0xBC, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x1F, 0x80, 0x00, 0x00,
-    0xF4, 0x0F, 0x40, 0xFF, 0xAB, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF, 0xFC, 0x07, 0xD0, 0x03, 0xF0,
-    0x02, 0xA9, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x0F, 0xAB,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x6A, 0xFD, 0x0B, 0xFF, 0xFD, 0x2F, 0xE5, 0xFD, 0x3F, 0x40, 0xFD,
-    0x3F, 0x42, 0xFD, 0x3F, 0xEF, 0xFD, 0x1F, 0xFF, 0x7D, 0x06, 0xE4, 0x28, 0x00, 0x08, 0x00, 0x09,
-    0x00, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x03,
-    0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x2F, 0xF8, 0x03, 0xFF, 0x42, 0xFF, 0xC0, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xD0, 0x7F, 0xF0,
-    0x00, 0xFF, 0xD0, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x01,
-    0xF4, 0x00, 0xF4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xE0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x3F, 0x05, 0x55, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0xF4, 0x0F,
-    0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFC, 0x0B, 0xE0, 0x1F, 0x43, 0xE0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xF8, 0x3C, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC7, 0xC0, 0x0F, 0xC0, 0x7E, 0x00, 0x7C, 0x7C, 0x00,
-    0xFD, 0x6F, 0xC0, 0x07, 0xC7, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7C, 0x7C, 0x00, 0xFF, 0xFE, 0x00,
-    0x07, 0xC3, 0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0xBC, 0x3D, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0x82, 0xF0,
-    0x0F, 0xC0, 0xBD, 0x00, 0xF4, 0x0F, 0x40, 0xFC, 0x03, 0xF0, 0x2F, 0x00, 0xBC, 0x0F, 0xC0, 0x1F,
-    0x87, 0xD0, 0x03, 0xF0, 0x54, 0x00, 0x55, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0x41, 0xFD, 0xBE, 0x00, 0xBE, 0xBE, 0x00, 0x7F,
-    0xBE, 0x00, 0xBE, 0x7F, 0x41, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x06, 0xAA, 0xBF, 0xAA, 0xA6,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x9B, 0xFF,
-    0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x0B,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x2F, 0xEF, 0xFC, 0x0A, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07,
-    0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x0F, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0B,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0x9B, 0xFC, 0x04, 0x01, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x5B,
-    0xF4, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFD, 0x00, 0x00, 0xFE, 0x10, 0x00, 0xFE,
-    0x3F, 0xAB, 0xFD, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x55, 0x00, 0x00, 0xAA, 0x90, 0x2F,
-    0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00,
-    0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xFF, 0xDB, 0xFD, 0x00, 0x0F,
-    0xFD, 0xBF, 0xE0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x1F, 0xFD, 0xBF, 0xF4, 0x03, 0xFF, 0xDB, 0xFF,
-    0xFB, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF3, 0xFD, 0xBF, 0xEF, 0xFC, 0x2F,
-    0xDB, 0xFD, 0x14, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x0B, 0xFF, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0xBF, 0x2F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F,
-    0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x7F, 0xFF, 0xFF, 0x42, 0xF7, 0xFF, 0xFF,
-    0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF2,
-    0xFF, 0xFF, 0xF4, 0x2F, 0x0F, 0xFF, 0xFF, 0x42, 0xF0, 0x7F, 0xFF, 0xF4, 0x2F, 0x00, 0xBF, 0xFF,
-    0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00,
-    0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4,
-    0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00,
-    0x01, 0xF4, 0x2F, 0x00, 0x00, 0x1F, 0x42, 0xF0, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00, 0x07, 0xD0,
-    0x02, 0xF8, 0x00, 0xBF, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x1F, 0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFF, 0x1F, 0xEF, 0xC2, 0x87, 0xF0,
-    0x01, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFF, 0xF4, 0x1F, 0xFB, 0xFC,
-    0x3F, 0xC0, 0xFE, 0x3F, 0x40, 0xBF, 0x3F, 0x40, 0x7F, 0x3F, 0x40, 0x7F, 0x3F, 0x40, 0xBF, 0x2F,
-    0xC0, 0xFE, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0x6E, 0x40, 0x02, 0x00, 0x01, 0x40, 0x00,
-    0x7F, 0x00, 0x7F, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x0F, 0xFD,
-    0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x1F, 0xFC, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x1F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x7F, 0xF0, 0x0B, 0xFE, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x3F, 0xF4, 0x03,
-    0xFF, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x2F, 0xF8, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xB8, 0x00,
-    0xBC, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x7F, 0x40, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0x3F, 0x80, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x05, 0x40, 0x00, 0x3F, 0x80,
-    0x7F, 0x80, 0x3F, 0xD0, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0x81, 0xFD, 0x01,
-    0xFF, 0xD0, 0x00, 0x3F, 0x83, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x15, 0x4B, 0xF4, 0x0B, 0xEF, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x1F, 0x6F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x3F, 0x2F, 0xD0, 0x00, 0x00,
-    0x3F, 0x80, 0xBC, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x01, 0xF8, 0x2F, 0xD0, 0x00, 0x01, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFC, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xF4, 0x01, 0xAA, 0xBF,
-    0xE8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x0D, 0x3F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x3F, 0xC0, 0x6A, 0x40, 0x00, 0x3F, 0x80, 0x7F, 0x87, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0xFF,
-    0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0x81, 0xFD, 0x0F, 0xEB, 0xFD, 0x00, 0x3F, 0x83, 0xFC, 0x02, 0x01,
-    0xFE, 0x00, 0x15, 0x4B, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F,
-    0xF9, 0x54, 0x00, 0x07, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x08, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x07, 0xF4, 0x00, 0x00, 0x0A, 0xBF, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x82, 0xFD, 0x01,
-    0x54, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x2F, 0xF0, 0xB8, 0x07, 0xF8, 0xBF, 0x00, 0xFF, 0xC2, 0xFF,
-    0xFF, 0xD7, 0xF8, 0x0F, 0xFF, 0x07, 0xFF, 0xFD, 0x3F, 0xC0, 0xBF, 0xFC, 0x01, 0xAA, 0x41, 0xFE,
-    0x03, 0xDF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x42, 0xF4, 0xFF,
-    0x00, 0x00, 0x03, 0xFC, 0x0F, 0x83, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFD, 0x0F, 0xF0, 0x00, 0x00,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x2A,
-    0xAB, 0xFE, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x10,
-    0x3F, 0xF4, 0x06, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x6F, 0xFE, 0x40, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x01, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x47, 0xFF,
-    0xC0, 0x00, 0x00, 0x3D, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00,
-    0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF,
-    0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE,
-    0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0,
-    0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x95, 0x55, 0x50, 0x00, 0x0B, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x1F, 0xFD, 0x55, 0x54, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0xAA, 0xA8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x56, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x06,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xEF, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x2A, 0xA4, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xAA, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x6A, 0x90, 0x00, 0x1F,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0x6F, 0xF0, 0x3F, 0xD0, 0xBF, 0x8B, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x03, 0xF4, 0x3F, 0xE0, 0xBF, 0xC3, 0xFE, 0x0B, 0xFC, 0x1F, 0xC0, 0x7F, 0x40, 0x10, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x6A, 0xA0, 0x00, 0x3F, 0xF8,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1B, 0xFF, 0xF8, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x0A, 0xA8, 0x00, 0x3F,
-    0xF8, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x6F, 0xFF, 0xE0, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0x00, 0x2A, 0xA0, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0x7F, 0xD0, 0x1F, 0xE0, 0x3F, 0xD0, 0xFD, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x87, 0xFC, 0x0F, 0xF5, 0xFF, 0x03, 0xFD,
-    0x3F, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x6F, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0,
-    0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xA4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x55, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x9F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFE,
-    0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xE1, 0x7F, 0xF5, 0x50, 0x03,
-    0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xFC, 0x00,
-    0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC0, 0x5F, 0xFF, 0xD0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7D, 0x00,
-    0x00, 0x3F, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0x00,
-    0x00, 0x0F, 0x40, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00,
-    0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC,
-    0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F,
-    0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80,
-    0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8,
-    0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF,
-    0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4,
-    0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x02, 0xFE, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00,
-    0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0xBC, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xC6, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFC, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x07, 0x03, 0xF4, 0x00, 0x7F, 0x2F, 0xF4,
-    0x07, 0xFE, 0x2F, 0xF4, 0x7F, 0xE0, 0x2F, 0xFB, 0xFE, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xF4, 0x07, 0xFE, 0x2F, 0xF0,
-    0x7F, 0xE0, 0x2F, 0xF1, 0xFE, 0x00, 0x2F, 0xE2, 0xE0, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x8F,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x2F, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x3F, 0xF8, 0x00, 0x3F, 0x9F,
-    0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0x0F, 0xFD, 0x3F, 0xF4, 0x02, 0xFC, 0x0F, 0xFD, 0x3F, 0xF0, 0x03,
-    0xF8, 0x0F, 0xFD, 0x3F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFD, 0x3F, 0xF4, 0x2F, 0xC0, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x3F, 0x80, 0x0F, 0xFD, 0x3F, 0xF8, 0xFF, 0x00, 0x0F, 0xFC, 0x2F, 0xFE, 0xFC, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xF0, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xF0, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3,
-    0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xDF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x3F, 0x80,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF4,
-    0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F,
-    0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xC0, 0x1F, 0xFF, 0x3F, 0xF0, 0x00,
-    0xFF, 0xCF, 0xFC, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0xF0,
-    0x00, 0xFF, 0xCF, 0xFC, 0x01, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE4, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0x9B, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x2F, 0xFC, 0x0B, 0xFE, 0x00, 0x03,
-    0xFF, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0xBF, 0xD0, 0xBF, 0xE0,
-    0x00, 0x2F, 0xF4, 0x2F, 0xFC, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0xBF, 0xFF,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x7F, 0xFF, 0x4B, 0xFD, 0x00, 0x02, 0xFF,
-    0xF2, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x6F, 0xF4, 0x00, 0x00, 0xFF,
-    0xCB, 0xFD, 0x0F, 0x95, 0xFF, 0xF2, 0xFF, 0x43, 0xFF, 0xFF, 0xF8, 0xBF, 0xD0, 0xFF, 0xFF, 0xFC,
-    0x2F, 0xF4, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE,
-    0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xA9, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF,
-    0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFE,
-    0xBF, 0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F,
-    0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40,
-    0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF,
-    0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x1F, 0xFF, 0xEB,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xE1, 0xBF, 0xF4, 0x01, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF,
-    0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01,
-    0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF,
-    0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF8, 0x2F, 0xF0, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x04, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF,
-    0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC,
-    0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00,
-    0x0F, 0xEB, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x59, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x56, 0xFF, 0x80, 0x6F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xAF, 0xFE, 0x7F,
-    0xF4, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x7F, 0xEB, 0xFD, 0x00, 0x2F, 0xFA, 0xFF, 0x80, 0x1F, 0xFE,
-    0x7F, 0xF9, 0x6F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xFF, 0x80,
-    0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x05, 0x94, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xE4, 0x0B, 0xFF, 0xF4, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x0B, 0xFC,
-    0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFA, 0xBF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x81, 0xFF, 0xE5, 0xBF, 0xFF, 0xF9, 0x5B, 0xF0, 0x3F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x40,
-    0x00, 0x54, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00,
-    0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10,
-    0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x03, 0xFD, 0x07, 0xFC, 0x00, 0x7F, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0x3F,
-    0xE0, 0xBF, 0xC0, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC,
-    0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x7F, 0xF0,
-    0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B,
-    0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00,
-    0xBF, 0xE0, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0x80,
-    0x0B, 0xFE, 0x00, 0x00, 0xAA, 0x90, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE,
-    0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00,
-    0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0xFF,
-    0xAF, 0xF0, 0x3F, 0xD0, 0x7F, 0xC7, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xFD, 0xFF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x41, 0xFD, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x02, 0xFF, 0xAF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
-    0xE1, 0xFF, 0x80, 0x00, 0x09, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x06, 0xFF, 0xE7,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xAF, 0xFF, 0xC3,
-    0xFF, 0x80, 0x0F, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x7F,
-    0xE0, 0xFF, 0xE0, 0x03, 0xFF, 0x41, 0xFF, 0xF5, 0x7F, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xE0, 0x02, 0xFF, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xFF, 0xF4, 0x00, 0xB8, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF,
-    0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00,
-    0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xF7, 0xFD, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA,
-    0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7D, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x03, 0xF0, 0xBF, 0xFC, 0x00, 0x0F, 0x40,
-    0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F,
-    0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF,
-    0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0,
-    0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0xFE, 0x03, 0xFC, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0,
-    0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC,
-    0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40,
-    0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xAA, 0xAA, 0xAA, 0xA6, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x30, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0x6F, 0xFF, 0x03, 0xFF, 0x80,
-    0x7F, 0xFD, 0x0F, 0xFC, 0x03, 0xFF, 0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xF1, 0xFF, 0x81, 0xFD, 0xFF,
-    0xC7, 0xFE, 0x0F, 0xE3, 0xFF, 0x1F, 0xF8, 0xFF, 0x0F, 0xFC, 0x7F, 0xE7, 0xF0, 0x3F, 0xF0, 0xFF,
-    0xFF, 0x80, 0xFF, 0xC3, 0xFF, 0xFC, 0x0B, 0xFE, 0x0B, 0xFF, 0xC0, 0x7F, 0xF4, 0x0F, 0xFF, 0xAF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xC0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0,
-    0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xF6, 0xFE, 0x00,
-    0x03, 0xFD, 0x0B, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F,
-    0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F,
-    0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F,
-    0x00, 0x03, 0xFD, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0xFF, 0x80, 0x02, 0xFC, 0x07, 0xF4, 0x00, 0x01,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F,
-    0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02,
-    0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC,
-    0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0x94, 0x00,
-    0xBF, 0xD3, 0xFF, 0xF0, 0x0B, 0xFD, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xEA,
-    0xFF, 0xF8, 0xBF, 0xF4, 0x02, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xDB,
-    0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xE0, 0x00,
-    0xBF, 0xDB, 0xFE, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00, 0xFF, 0xCB, 0xFF, 0x80, 0x3F, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xDF, 0xFF, 0xFC, 0x0B, 0xFD, 0x2F, 0xFE,
-    0x00, 0xBF, 0xD0, 0x15, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x01,
-    0xFF, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x10,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80,
-    0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00,
-    0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00,
-    0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF,
-    0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00,
-    0x00, 0x2F, 0xFC, 0x01, 0x55, 0x55, 0x54, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x40, 0x00, 0x1F, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x56, 0xFF, 0x80, 0x6F, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xAF, 0xFE, 0x7F, 0xF4, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x7F, 0xEB,
-    0xFD, 0x00, 0x2F, 0xFA, 0xFF, 0x80, 0x1F, 0xFE, 0x7F, 0xF9, 0x6F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xFA, 0xBF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F,
-    0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00,
-    0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xA0,
-    0x00, 0x29, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x2F, 0xFA, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF,
-    0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55,
-    0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x05, 0x65, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x02, 0xF5, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x01, 0x5B, 0xFE, 0x01, 0xBF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0xBF, 0xF9,
-    0xFF, 0xD0, 0x07, 0xFE, 0xBF, 0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F,
-    0xF9, 0xFF, 0xE5, 0xBF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0x7F, 0xFE,
-    0x03, 0xF8, 0x00, 0x50, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD5, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01, 0xB4,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0xFF, 0x40, 0x00, 0x1F, 0xE0, 0x3F, 0xD0, 0x00, 0x3F,
-    0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x01,
-    0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0x7F, 0xE0, 0x03, 0xFC, 0x0B, 0xF8, 0x0B, 0xE0,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0,
-    0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xAA, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x28, 0x0F, 0xFF, 0xEF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xA4, 0x00, 0x2F, 0xE0, 0x0F,
-    0xF4, 0x00, 0x0F, 0xF8, 0x7F, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF4, 0x06, 0xF0, 0x0B, 0xFF, 0x40, 0x00, 0x10, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x01, 0xB4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x50, 0x00, 0x0A, 0x90, 0x00, 0x6A,
-    0x01, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00, 0x6F,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0xAB, 0xC0, 0x2F,
-    0xFC, 0x00, 0x10, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x0A, 0x00, 0xFF, 0xFE, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01,
-    0xA8, 0x00, 0x0A, 0x90, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xF5,
-    0x5B, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00,
-    0x00, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x8F, 0xFC, 0x00,
-    0x00, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x5F,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x55, 0x40, 0x00, 0x00,
-    0x1F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x87, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xE2, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x19, 0x41, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xDF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0xAF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
-    0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x00,
-    0x01, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x3F, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x55, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00,
-    0x1F, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x7F, 0xFF, 0xFF, 0x40, 0x3F, 0xF9, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xE1, 0x7F, 0xF5, 0x50, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x5F, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xE8, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xAB, 0xFF, 0xA0, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x05, 0x50, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x7F,
-    0xFF, 0xF7, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFF,
-    0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x1F, 0xFC, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xD0,
-    0x00, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x40, 0x3F, 0xF8, 0x02, 0xFF, 0xFE,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x2F, 0xFD,
-    0x0B, 0xF8, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x42, 0xFF, 0xFF, 0xF8, 0x2F,
-    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x01, 0x55, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x2A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0xBD, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFD, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55,
-    0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFE, 0x02, 0xA0, 0x00, 0x29, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xFF, 0xAF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07,
-    0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0,
-    0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F,
-    0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFD, 0x50, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x01, 0xA9, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0x42, 0xFF, 0x80, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0xF9, 0x5B, 0xF4, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x7F, 0x80,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x69, 0x00, 0x02, 0xA1, 0xFF, 0x00, 0xBF, 0x81, 0xFF, 0x4F, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xD5, 0x55,
-    0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x55, 0x55, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xAA, 0xAA, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF8, 0x06, 0x90, 0x00, 0x2A, 0x00, 0x3F, 0xD0, 0x1F,
-    0xF0, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x07, 0xF4, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF,
-    0x4F, 0xFC, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD,
-    0x2F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4,
-    0x1F, 0xFF, 0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0B, 0xFD,
-    0xFF, 0x00, 0x02, 0xFE, 0x07, 0xFC, 0x00, 0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F,
-    0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03,
-    0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F,
-    0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0xA8, 0x00, 0x02,
-    0xF4, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xEA, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x2F, 0xFC, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00,
-    0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF, 0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x2A, 0x00, 0x2F, 0x40, 0x07, 0xF0,
-    0x01, 0xFF, 0xAB, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x2B,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0,
-    0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00,
-    0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F,
-    0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03,
-    0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF9, 0x01, 0xBC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x15, 0x55, 0x50, 0xFF, 0xC0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC,
-    0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0x40, 0x3F, 0xFF, 0xF4, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x2F, 0xFC,
-    0x00, 0x01, 0xFF, 0x47, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0xFF, 0xF0, 0x00, 0x1F, 0xF4, 0x1F, 0xFF,
-    0x40, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x3F, 0xE0, 0x3F, 0xFF, 0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00,
-    0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F,
-    0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B,
-    0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFF, 0xFE, 0x40, 0x6F, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x05, 0x55, 0x54, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x4F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xD3, 0xFF, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0x3F, 0xF8, 0x00, 0x01, 0xFF,
-    0x4B, 0xFF, 0x00, 0x00, 0x7F, 0xD1, 0xFF, 0xD0, 0x00, 0x1F, 0xF4, 0x3F, 0xFC, 0x00, 0x07, 0xFD,
-    0x07, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x3F, 0xE0, 0x3F, 0xFF,
-    0xF7, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF9, 0xBF, 0xFE, 0x3F, 0xFC, 0x00, 0xFF, 0xE3,
-    0xFF, 0x40, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0x7F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00,
-    0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x03, 0xFE, 0x3F,
-    0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0xC0, 0x1F, 0xFE, 0x1F, 0xFF, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0B, 0xFF, 0x87, 0xFE, 0x00, 0x05, 0x40, 0x7F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD1, 0xE4, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x2B, 0xFF, 0xE8, 0x00, 0x00, 0x02,
-    0xAA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xDF,
-    0xF8, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFE, 0xFF, 0xD5, 0x55, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x6A,
-    0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xAF, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x7F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x19, 0x40,
-    0x00, 0x0B, 0xFD, 0x3F, 0xFF, 0x80, 0x00, 0xBF, 0xDF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0x9B, 0xFF, 0xC0, 0x0B, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xBF, 0xF0, 0x00,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xD0, 0x0B, 0xFE, 0x00,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x0A, 0xBF, 0xFA, 0xAA, 0xAB, 0xFF, 0xE9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFF, 0xAA, 0xAA, 0xBF,
-    0xFE, 0x90, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F,
-    0xFA, 0xAA, 0xAB, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x80,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xAF,
-    0xFF, 0xAA, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xAB, 0xFF,
-    0xAA, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x01, 0xA4, 0x00, 0x07, 0xFD, 0x2F,
-    0xFF, 0x80, 0x07, 0xFD, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xF9, 0xBF,
-    0xFC, 0x07, 0xFF, 0xC0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x0B, 0xFD,
-    0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07,
-    0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xD0, 0xFF, 0xFE, 0xBF, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x3F, 0x0B, 0xFF, 0xC0, 0xF4, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x3F, 0x1F, 0xFF, 0xEB, 0xE3, 0xFF, 0xFF, 0xFC, 0x7E, 0x1B, 0xFF, 0x47, 0xC0, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0x1B, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x55,
-    0x55, 0x55, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80,
-    0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02,
-    0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF,
-    0x80, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x68, 0x00, 0x0A, 0x87, 0xE0, 0x01, 0xFC, 0x3F, 0xEA,
-    0xFF, 0x82, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFC, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x2A, 0x00, 0x02, 0x93, 0xF0, 0x00, 0xBE, 0x2F, 0xFA,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x54, 0x02, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x01, 0xA9, 0x01, 0x40, 0x7F, 0xD2, 0xFF, 0x8B,
-    0xFE, 0x1F, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F,
-    0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF, 0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF,
-    0xE2, 0xFF, 0x8B, 0xFE, 0x2F, 0xF8, 0xBF, 0xE0, 0xBE, 0x0B, 0xE0, 0x3F, 0x02, 0xFC, 0x0B, 0xF5,
-    0x5F, 0xFF, 0x3F, 0xFC, 0x1A, 0x90, 0x00, 0x10, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE,
-    0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xE0, 0xBF, 0xFF, 0xF8, 0x02, 0xFF,
-    0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xDF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF5, 0xBF, 0xFF, 0x80, 0x0B, 0xFD,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x0F,
-    0xFC, 0x00, 0x0B, 0xFD, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0x7F, 0xFF, 0xFF, 0x00, 0xBF, 0xDF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xF7, 0xFF, 0xFF, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x55, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0x7F, 0xD0, 0x03, 0xFD, 0xBF, 0xE0, 0x07, 0xFF, 0xBF, 0xE0, 0x0B, 0xFF, 0x7F, 0xD0,
-    0x03, 0xFE, 0x05, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0xBF, 0xE0,
-    0x07, 0xFE, 0xBF, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x02, 0xFF, 0x7F, 0xD0, 0x07, 0xF8, 0x0F, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x15, 0xBF,
-    0xF4, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xAF, 0xF0,
-    0x3F, 0xD0, 0xBF, 0xCB, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF, 0xD0,
-    0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xFF, 0xC0, 0x03,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0xFF, 0xE1, 0xFF, 0x80, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x0F,
-    0xFF, 0x00, 0x7F, 0xE0, 0xBF, 0xF0, 0x01, 0xFF, 0x8B, 0xFF, 0x00, 0x07, 0xFD, 0x7F, 0xF0, 0x00,
-    0x1F, 0xFB, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x2F, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x7F,
-    0xF4, 0x07, 0xFE, 0x00, 0xBF, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xF0, 0x7F, 0xE0, 0x00, 0xFF, 0xE1,
-    0xFF, 0x80, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x87, 0xFE, 0x00, 0x2F, 0xF8, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x1F, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0xFF, 0xD0,
-    0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x01, 0xFF, 0x80, 0xFF, 0xD0, 0x07, 0xFE, 0x01,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF,
-    0x87, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x6A, 0xA0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0xAA, 0x90, 0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x0B, 0xFD,
-    0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x15, 0x4B, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF,
-    0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB,
-    0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD, 0xBF, 0xDB, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFD, 0x3F, 0xC7, 0xF4, 0xBE, 0x05, 0x40, 0x3F, 0xE0, 0x00, 0xFF,
-    0x4F, 0xFC, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x2F, 0xD0, 0xFF, 0xC0, 0x0B, 0xF0, 0x3F, 0xF0, 0x03,
-    0xF4, 0x0F, 0xFC, 0x00, 0xA4, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x15, 0x40, 0x55, 0x2F, 0xF4, 0x3F, 0xDB, 0xFD, 0x1F, 0xF2, 0xFF, 0x4B, 0xF4, 0xBF,
-    0xD2, 0xFC, 0x2F, 0xF4, 0xFC, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B,
-    0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0x40, 0x3F, 0xF0, 0x0F, 0xF4, 0x3F,
-    0xF0, 0x2F, 0xF8, 0x3F, 0xF0, 0x2F, 0xFC, 0x3F, 0xF0, 0x1F, 0xF4, 0x3F, 0xF0, 0x01, 0x40, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x15, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x50, 0xBF, 0xD3, 0xFD, 0xBF, 0xDB, 0xFF, 0xBF, 0xDB,
-    0xFF, 0xBF, 0xD7, 0xFD, 0xBF, 0xD0, 0x60, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00,
-    0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xBF,
-    0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x03, 0xFF, 0xBC, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x55, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01,
-    0xFF, 0xA0, 0x01, 0xFF, 0xF4, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
-    0x80, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0A, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80,
-    0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F,
-    0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00,
-    0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0,
-    0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF,
-    0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00,
-    0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8,
-    0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0x0A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0,
-    0x00, 0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD,
-    0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00,
-    0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB,
-    0xFD, 0x00, 0x0B, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF,
-    0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF,
-    0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC,
-    0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F,
-    0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07,
-    0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF,
-    0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x80, 0xBF, 0xCF, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB, 0xFF, 0x80, 0x1F, 0xFC, 0xBF,
-    0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xA8,
-    0x00, 0x06, 0x90, 0x00, 0x0B, 0xF8, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF,
-    0xFF, 0xC0, 0x00, 0x07, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F,
-    0xCF, 0xF7, 0xFF, 0x80, 0x07, 0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07,
-    0xFC, 0xFF, 0x43, 0xFF, 0x40, 0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0,
-    0x7F, 0xCF, 0xF8, 0x07, 0xFF, 0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF,
-    0xC7, 0xFC, 0xFF, 0x80, 0x0B, 0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00,
-    0x02, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x06, 0x90,
-    0x00, 0x2A, 0x00, 0x7F, 0xC0, 0x2F, 0xE0, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0xBF, 0x83, 0xFF, 0xF8, 0x0B, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x8B,
-    0xFF, 0xF9, 0xBF, 0xFC, 0xBF, 0xF8, 0x01, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xF0, 0x00,
-    0xFF, 0xDB, 0xFE, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF,
-    0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xFD, 0x1F, 0xE0, 0xBF, 0xFF, 0x00, 0xFF,
-    0x07, 0xFC, 0xFF, 0xFF, 0xF0, 0x15, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x9B,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x01,
-    0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x2F,
-    0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8,
-    0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFE, 0x00, 0x0B, 0xFD, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xCF, 0xFF,
-    0xD0, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0xFF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xCF, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xFC, 0x00, 0x7F, 0xCF,
-    0xF6, 0xFF, 0xE0, 0x07, 0xFC, 0xFF, 0x4F, 0xFF, 0x00, 0x7F, 0xCF, 0xF4, 0x7F, 0xFC, 0x07, 0xFC,
-    0xFF, 0x42, 0xFF, 0xE0, 0x7F, 0xCF, 0xF4, 0x0F, 0xFF, 0x47, 0xFC, 0xFF, 0x80, 0x3F, 0xFC, 0x7F,
-    0xCF, 0xF8, 0x01, 0xFF, 0xE7, 0xFC, 0xFF, 0x80, 0x0F, 0xFF, 0xBF, 0xCF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00, 0x0B, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xCF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xCF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFC, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x19, 0x40, 0x0B, 0xF8, 0x3F, 0xFF, 0x80, 0xBF, 0xDF, 0xFF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0x9B, 0xFF, 0xCB, 0xFF, 0x80, 0x1F, 0xFC, 0xBF,
-    0xF0, 0x00, 0xFF, 0xDB, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xE0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD,
-    0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF,
-    0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x01,
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00,
-    0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF,
-    0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x94, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xFD, 0x5F, 0xFF, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3, 0xFF, 0x40,
-    0x0B, 0xFE, 0x0B, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0xA8, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0xAF, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1A,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x2A, 0x00, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0x0F,
-    0xFA, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0A, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC,
-    0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA,
-    0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x46, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0x1F,
-    0xF8, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x2F,
-    0xC1, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8,
-    0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x2A, 0xA1, 0xAA,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x00, 0xFF, 0x47, 0xFC, 0x00, 0x07,
-    0xF4, 0x3F, 0x80, 0x00, 0x3E, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF,
-    0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00,
-    0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0,
-    0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x7F, 0xFD, 0x00, 0x7F, 0xF9, 0x55, 0x54, 0x0F, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x95, 0x55, 0x43,
-    0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xEA, 0xAA, 0x83, 0xFF, 0x40,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA5, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0x9B, 0xFF, 0xFF, 0x41, 0xFF, 0xD0, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0xFF,
-    0x00, 0x07, 0xFF, 0x40, 0x02, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0x0B, 0xFC, 0x7F, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xD0, 0x00, 0x08, 0x03, 0xFF, 0xFB, 0xFF, 0xFF, 0xF5, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xFF,
-    0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0,
-    0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xAA, 0x80, 0x00,
-    0x7F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xBF, 0x42, 0xFF, 0x4B, 0xF8, 0xBF, 0xF4, 0xBF, 0xEF,
-    0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0x41, 0x0B, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x01, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2F, 0xD0, 0xBF, 0xDB, 0xF8, 0xBF, 0xF6,
-    0xFF, 0xBF, 0xFC, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xD0, 0x4B, 0xFF, 0x80, 0x02, 0xFF, 0xC0, 0x00,
-    0xBF, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00,
-    0x2F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xF4, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x05, 0x40, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x2A, 0x00, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x1B, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x01, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x3F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x2A, 0x00,
-    0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B, 0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x2F, 0xD0, 0xBF, 0xD0,
-    0xBF, 0x8B, 0xFF, 0x42, 0xFF, 0xBF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xD0, 0x40, 0xBF,
-    0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00,
-    0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
-    0xA0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x7F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80, 0x00, 0xBF, 0xD7,
-    0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0B, 0xFD, 0xFF, 0x40, 0x0B, 0xF8, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC5, 0x00, 0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x2A, 0x90, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x02, 0xFE, 0x7F, 0xC0, 0x2F,
-    0xE0, 0x7F, 0xC1, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF,
-    0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F, 0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80,
-    0x00, 0xBF, 0xD7, 0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
-    0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0x7E, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF1, 0x40, 0x00, 0x0F, 0xFC, 0x7E, 0x40, 0x0B, 0xFE, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFE, 0x41, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xE0, 0x0B, 0xC1, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD6, 0x00, 0x02, 0xFF, 0x5F, 0xE5, 0x6F, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xEF, 0xFC,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x69, 0x03, 0xFD, 0x01,
-    0xFF, 0x00, 0x3F, 0xE1, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0xBF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xF8,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0x3F, 0xF1, 0xF9, 0x00, 0x2F, 0xF8,
-    0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF8,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2A, 0x00, 0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B,
-    0xFC, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0xA5, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xF8, 0x02, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xF5, 0x80, 0x00, 0xBF, 0xD7, 0xF9, 0x5B, 0xFF, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xF4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15,
-    0x57, 0xFF, 0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC,
-    0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x1E, 0xFF, 0xC0, 0x01, 0xFF, 0xF4, 0x00, 0x0F, 0xF9,
-    0x00, 0x02, 0xA4, 0x00, 0x1A, 0x80, 0x07, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0A, 0xFF, 0xEA,
-    0xA0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xAD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF,
-    0x95, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x7F, 0xF5,
-    0x50, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0x7F, 0xF5, 0x50, 0x3F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0x40, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F,
-    0xFF, 0xAD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xD0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFC, 0x00, 0x00, 0xF4, 0x01, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8,
-    0x00, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xE0, 0x02, 0xFF, 0xFE, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xD1, 0xFF, 0xF4, 0x00, 0xB8, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F,
-    0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F,
-    0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x3F,
-    0xF4, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x07, 0xFF, 0x80, 0x0B, 0xFF,
-    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF,
-    0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x06,
-    0x80, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x03, 0xFE, 0xAF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F,
-    0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x29, 0x00, 0x3F,
-    0x00, 0x0F, 0xD0, 0x02, 0xFF, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xBE, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x00, 0x02,
-    0xFA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00,
-    0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x07, 0xFF, 0x80, 0x0B,
-    0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x03, 0xD0, 0xFC, 0x00, 0x00, 0x3D,
-    0x0F, 0xC0, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xA8, 0x6A, 0x90, 0x00, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x2F, 0xF0, 0x00, 0x02,
-    0xFE, 0x0F, 0xF0, 0x00, 0x01, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC,
-    0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00,
-    0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00,
-    0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x82,
-    0xA9, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x0F,
-    0xE0, 0xBF, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC,
-    0x7F, 0xFF, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF,
-    0x43, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x4F, 0xFD, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x15, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x2F, 0xFC, 0xBF, 0xF4,
-    0x07, 0xFF, 0xC7, 0xFF, 0xFB, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFC,
-    0x02, 0xFF, 0xF4, 0x3F, 0xC0, 0x00, 0x50, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x94, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4,
-    0x00, 0x02, 0xFF, 0x2F, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x7F,
-    0xFE, 0x00, 0x0B, 0xFC, 0x0B, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x03, 0xFE, 0xFD, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x01,
-    0xFE, 0x7F, 0x80, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0xBF, 0x4F, 0xF0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0,
-    0x3F, 0xC3, 0xFC, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0xFF, 0x41, 0xFF, 0x40, 0x03, 0xFF,
-    0x07, 0xFC, 0x2F, 0xE0, 0xBF, 0xC0, 0x00, 0xBF, 0xC2, 0xFD, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF4, 0xFF, 0x00, 0xFF, 0x0F, 0xF8, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x3F, 0xD7, 0xFD, 0x00, 0x00,
-    0xFF, 0x9F, 0xE0, 0x0B, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xFB, 0xF4, 0x00, 0xFF, 0xBF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0xC0,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0x83, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x7F,
-    0xD0, 0xBF, 0xC0, 0x1F, 0xFF, 0xC0, 0x2F, 0xF0, 0x1F, 0xF4, 0x0B, 0xFB, 0xF0, 0x0F, 0xFC, 0x03,
-    0xFE, 0x03, 0xF9, 0xFD, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0xFE, 0x3F, 0x81, 0xFF, 0x40, 0x1F, 0xF4,
-    0x7F, 0x4F, 0xF0, 0xBF, 0xC0, 0x03, 0xFE, 0x2F, 0xC2, 0xFC, 0x3F, 0xE0, 0x00, 0xFF, 0x8F, 0xF0,
-    0x7F, 0x4F, 0xF4, 0x00, 0x2F, 0xF3, 0xF8, 0x0F, 0xE7, 0xFC, 0x00, 0x07, 0xFC, 0xFD, 0x03, 0xFA,
-    0xFF, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0,
-    0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xAA, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xDF, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07,
-    0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xDF, 0xF4, 0x00, 0x01, 0xFF, 0x03, 0xFD, 0x00, 0x03,
-    0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00,
-    0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF,
-    0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00,
-    0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x80, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F,
-    0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B,
-    0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03,
-    0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x6A, 0xA0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x19, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xA4, 0x00, 0x1A,
-    0x80, 0x07, 0xF8, 0x02, 0xFE, 0x00, 0x0B, 0xFC, 0x3F, 0xE0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2A, 0x00, 0x01, 0xA4, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x8B, 0xFC, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xBF,
-    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x15, 0x50, 0x07, 0xFF, 0xFD, 0x1F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFC, 0x3F, 0xF9, 0x64, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00,
-    0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F,
-    0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xE4, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x16, 0x50,
-    0x02, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFA, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x3F,
-    0xF4, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFC, 0x01,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x2F, 0xFE,
-    0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0x41, 0xBF, 0xFF,
-    0xD0, 0x7F, 0xFD, 0x0F, 0xFF, 0x40, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0x00, 0x0B, 0xFE, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF3, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0x80, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xF3, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF3, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xF3,
-    0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
-    0xF2, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x7F, 0xF0, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0xE0, 0x0B, 0xFF, 0xD0,
-    0x00, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x3F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xAF, 0xFF, 0xF9, 0xBF, 0xFC,
-    0x3F, 0xF8, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x7F, 0xF0,
-    0x00, 0xFF, 0xD0, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF,
-    0xD0, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x0B,
-    0xFD, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x2F,
-    0xFC, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xBF, 0xFF, 0xFF, 0xA4, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF4, 0xBF, 0xEB, 0xFF, 0x96, 0xFF, 0xFC, 0xFF, 0x43, 0xFF, 0x00, 0x2F, 0xFC, 0xBF, 0x43,
-    0xFF, 0x00, 0x0F, 0xFD, 0x6A, 0x43, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xAB,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xAA, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFA, 0x80, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x01, 0x94, 0x00, 0x7F, 0xE2,
-    0xFF, 0xF4, 0x07, 0xFE, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFA, 0xFF, 0xF8,
-    0x7F, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0xBF, 0xE7, 0xFE, 0x00,
-    0x0B, 0xFE, 0x7F, 0xE0, 0x00, 0xBF, 0xE7, 0xFE, 0x00, 0x0B, 0xFE, 0x7F, 0xF0, 0x00, 0xBF, 0xE7,
-    0xFF, 0x00, 0x0F, 0xFE, 0x7F, 0xF4, 0x00, 0xFF, 0xD7, 0xFF, 0xC0, 0x3F, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xEF, 0xFF, 0xFD, 0x07, 0xFE, 0x2F, 0xFF, 0x00, 0x7F,
-    0xE0, 0x05, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xE5, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x40,
-    0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF,
-    0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xD5, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x0F, 0xE4, 0x1F, 0xFE, 0x04, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0x7F,
-    0xF4, 0x00, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x01, 0x50, 0x00, 0x00, 0x5A, 0x50, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFC, 0x0F, 0x95, 0xBF, 0xF0, 0x10, 0x00, 0xFF, 0xD0, 0x00, 0x07,
-    0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xE0, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x06, 0x1F,
-    0xFE, 0x5A, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0x01,
-    0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x55, 0x55, 0x50, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xA9, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0x0B, 0xFC, 0x00, 0x0F, 0xE2, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x5F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x10, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xFD, 0x2B, 0xFF, 0xAA, 0x80, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xBD, 0x01, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFD, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE5, 0xBF, 0xE5, 0x55, 0xFF, 0x40, 0xBF, 0xD0, 0x00,
-    0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0x40, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xEA, 0x80, 0x3F, 0xF4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xD2, 0xBF, 0xFA, 0xA8, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x02, 0xFF, 0xFB, 0xD0, 0x1F, 0xFF, 0xFD, 0x00, 0xBF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95,
-    0x54, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F,
-    0xE0, 0x00, 0x02, 0xFF, 0x4B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x6F, 0xF8, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF2, 0xFF, 0x40, 0x03, 0xFF, 0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0xFF, 0xDF, 0xFC, 0x2F, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFD, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00,
-    0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F,
-    0xFC, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F,
-    0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF,
-    0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x3F, 0xC0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x03, 0xFF, 0x80, 0x0F, 0xFD, 0x00,
-    0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x2A, 0xA0, 0x03, 0xFF, 0x80, 0x3F, 0xF4, 0x02,
-    0xFF, 0x40, 0x1F, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0x6F, 0xF0, 0x3F, 0xD0, 0xBF, 0x8B, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x07, 0xD0, 0xFF, 0xFE, 0xBF, 0x0B, 0xFF, 0xFF, 0xF8, 0x3F, 0x4B, 0xFF, 0xC0,
-    0xF4, 0x01, 0xB4, 0x00, 0x55, 0x55, 0x55, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
-    0x55, 0x50, 0x2A, 0x00, 0x02, 0xA3, 0xF0, 0x00, 0xBE, 0x2F, 0xFA, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFE, 0x00, 0x06, 0xFA, 0x00, 0x05, 0x07, 0xFD, 0xBF, 0xEB, 0xFE, 0x7F, 0xD0, 0x50,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0xFF, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x01, 0xFD, 0x04,
-    0x00, 0x10, 0x6A, 0x80, 0xFF, 0xF8, 0xFF, 0xFC, 0x42, 0xFD, 0x01, 0xFD, 0x07, 0xFC, 0x1F, 0xE0,
-    0x1F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x0B, 0xFF, 0xC3, 0xF6, 0xF9, 0xF0, 0x3F, 0x7C, 0x0F, 0xCF,
-    0xDB, 0xE2, 0xFF, 0xF0, 0x1B, 0xD0, 0x00, 0xAA, 0x46, 0xA8, 0x03, 0xFF, 0x1F, 0xF8, 0x07, 0xFD,
-    0x3F, 0xE0, 0x0F, 0xF0, 0xBF, 0x80, 0x2F, 0xC1, 0xFD, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x69, 0x00,
-    0x02, 0xA0, 0xFF, 0x00, 0xBF, 0x81, 0xFF, 0x4F, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x00, 0x6A, 0x0A, 0x9B, 0xF0,
-    0xFE, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0xAA, 0x46,
-    0xA8, 0x0B, 0xFC, 0x3F, 0xE0, 0x2F, 0xE0, 0xFF, 0x00, 0xBF, 0x47, 0xFC, 0x02, 0xFC, 0x0F, 0xD0,
-    0x0B, 0xD0, 0x3E, 0x00, 0x14, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xA4, 0xFF, 0x1A, 0xBC,
-    0x28, 0x3E, 0x7E, 0x00, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x6A,
-    0x90, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x0F, 0xC7,
-    0xD0, 0x00, 0x7D, 0x01, 0xFC, 0x03, 0xFC, 0x07, 0xF8, 0x0B, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x3F,
-    0xF0, 0x3F, 0xE0, 0x15, 0x40, 0x0B, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x15, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x02, 0xFC, 0x00, 0x54, 0x0B, 0xFC, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F,
-    0xF4, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0x15, 0x00, 0x2A, 0xA0, 0x00, 0xBF, 0xF0,
-    0x00, 0xBF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xAA, 0x90, 0x2F,
-    0xFC, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1F, 0x01, 0xF0, 0x05, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xF4, 0x05, 0x00, 0x15, 0x55, 0x2F, 0xFF, 0xE6, 0xAA, 0xF8, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x02,
-    0xE0, 0x00, 0xB8, 0x00, 0x2E, 0x00, 0x06, 0x40, 0x00, 0x55, 0x40, 0x3F, 0xF0, 0x1F, 0xF8, 0x0B,
-    0xFD, 0x0B, 0xFF, 0x0F, 0xFF, 0x03, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF2,
-    0xFC, 0xF8, 0x3D, 0x0F, 0xD1, 0xFC, 0x1F, 0x01, 0x40, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF,
-    0xFE, 0x7F, 0xFD, 0x15, 0x54, 0xBF, 0xFE, 0x6B, 0xE9, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00,
-    0x00, 0x03, 0xC0, 0x03, 0xC0, 0x6F, 0xF9, 0xBF, 0xFE, 0x17, 0xD4, 0x03, 0xC0, 0x02, 0x80, 0x00,
-    0x00, 0xBF, 0xFD, 0xBF, 0xFD, 0x00, 0xAA, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x01,
-    0xFF, 0x6B, 0xFF, 0x7F, 0xFD, 0x7F, 0xFC, 0x7F, 0xE0, 0xAA, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
-    0x00, 0xFF, 0x00, 0xFF, 0x40, 0xFF, 0xE9, 0xBF, 0xFD, 0x3F, 0xFD, 0x0B, 0xFD, 0x0B, 0x90, 0xFF,
-    0xC3, 0xFF, 0x4F, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0xFF, 0x82,
-    0xFF, 0xFF, 0x82, 0xFF, 0x7F, 0x01, 0xFD, 0x04, 0x00, 0x10, 0x07, 0xF8, 0x0B, 0xFF, 0xC3, 0xF6,
-    0xF9, 0xF0, 0x3F, 0x7C, 0x0F, 0xCF, 0xDB, 0xE2, 0xFF, 0xF0, 0x1B, 0xD0, 0x3F, 0xF3, 0xFD, 0x3F,
-    0xC7, 0xF4, 0xBF, 0x05, 0x40, 0x0B, 0xC0, 0x0F, 0xD0, 0x1B, 0xFC, 0x00, 0xFE, 0x00, 0xFE, 0xBF,
-    0xFE, 0xBF, 0xFC, 0xBF, 0xE0, 0x00, 0x90, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0x3F, 0x00, 0x7F,
-    0x94, 0x3F, 0xFD, 0x1F, 0xFD, 0x02, 0xA8, 0x69, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0x00, 0x55, 0x55,
-    0x55, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F,
-    0x50, 0x00, 0x05, 0x78, 0x0F, 0x01, 0xD3, 0xC0, 0xF0, 0x3C, 0x2F, 0xFF, 0xFF, 0x80, 0x7E, 0x0B,
-    0xD0, 0x69, 0x00, 0x02, 0xA0, 0xFF, 0x40, 0x7F, 0xC0, 0xFF, 0x4B, 0xFC, 0x01, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0xFF, 0xAF, 0xF0, 0x3F, 0xD0, 0xBF, 0xCB, 0xE0, 0x01, 0xFD, 0x29, 0x00, 0x06,
-    0x93, 0xF0, 0x00, 0xFC, 0x3F, 0xFA, 0xFF, 0xC1, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFD, 0x00, 0x06,
-    0xF9, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFC,
-    0x3F, 0x40, 0x0F, 0xC7, 0xD0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x3E, 0x2F, 0xFF,
-    0xEF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD, 0x1F, 0xFF, 0x4B, 0x80, 0x1B, 0x80, 0x55, 0x55, 0x55, 0xBF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x15, 0x55, 0x55, 0x54, 0x15, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x0B, 0xC1, 0xFF, 0xFE, 0xBE, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x7E, 0x1B, 0xFF, 0x81, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x7F,
-    0xFD, 0x03, 0xFF, 0xE0, 0x2F, 0xFF, 0x00, 0xBF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x90, 0x3F, 0x0F, 0xE0, 0xBC, 0x1F, 0x1F, 0xCF, 0xD3, 0xD0, 0x50,
-    0x00, 0x05, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80,
-    0x00, 0x2D, 0x78, 0x00, 0x02, 0xD7, 0x80, 0x00, 0x2D, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8,
-    0x0B, 0xF5, 0xFE, 0x02, 0xFB, 0xFE, 0xF8, 0x3C, 0x0F, 0x03, 0xC7, 0x40, 0xB0, 0x1D, 0x14, 0x14,
-    0x3D, 0x7C, 0x2F, 0xF4, 0x0B, 0xE0, 0x1F, 0xF4, 0x3D, 0xBC, 0x14, 0x24, 0x06, 0xC2, 0xFC, 0x3D,
-    0x03, 0xD0, 0x2F, 0x00, 0xF8, 0x07, 0xC0, 0xBC, 0x3F, 0x43, 0x80, 0x15, 0x55, 0x55, 0x5F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA,
-    0xFF, 0xFF, 0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0x2A, 0xA4, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x7F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0xAA, 0x90, 0x3F, 0xF8, 0x0B, 0xFE, 0x01,
-    0xFF, 0x40, 0x3F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0x1F, 0xFF,
-    0xEB, 0xE3, 0xFF, 0xFF, 0xFC, 0x7E, 0x1B, 0xFF, 0x47, 0xC0, 0x0B, 0x90, 0x3F, 0xD0, 0xFF, 0xC2,
-    0xFF, 0x40, 0xFC, 0x0B, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xF0, 0x7F,
-    0xF2, 0xF8, 0xFF, 0x8B, 0xFC, 0x3F, 0xCF, 0xF8, 0xFF, 0x83, 0xFD, 0x7F, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x40, 0xFC, 0x00, 0x00, 0x15, 0x01, 0xFE, 0x07, 0xF8, 0x1F, 0xF0, 0x7F, 0xF8, 0xFF, 0xE1, 0xFF,
-    0x40, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAA, 0xBD, 0x7C, 0x00, 0x00,
-    0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x14, 0x00, 0x00, 0x14, 0x15, 0x55, 0x55,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF6, 0xAA, 0xAA, 0xAA, 0x6A, 0x0A, 0x9B, 0xF0, 0xFE, 0xBF, 0x0F,
-    0xEB, 0xF0, 0xFE, 0xBF, 0x0F, 0xEB, 0xF0, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x00, 0x40, 0x00, 0x15, 0x3D, 0x18, 0x0B, 0xFF,
-    0x87, 0xC1, 0xFF, 0xFE, 0xF8, 0x3D, 0x2F, 0xFF, 0x03, 0xC7, 0xDA, 0x80, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x4A, 0x01, 0x40, 0xBF, 0x90, 0x7C, 0x2F, 0xFF, 0xEF, 0x83, 0xFB, 0xFF, 0xF4, 0x3D,
-    0x07, 0xFE, 0x01, 0x40, 0xA4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x50, 0x00, 0x06, 0x90, 0x09, 0x3F, 0xFD, 0x7E, 0x7F, 0xFF, 0xFC, 0xB8, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1E, 0x3F, 0xFE, 0xBD, 0x7D, 0xBF, 0xFC, 0xB4, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0x41, 0xD0, 0x2F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0x0F, 0x41, 0xF0, 0x02, 0x41,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0B, 0xE0, 0x2F, 0xF8, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5,
-    0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0x00, 0x50, 0x70, 0x00, 0x00, 0x0E, 0x05,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00, 0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00,
-    0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70, 0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x40, 0x7F, 0x80, 0xBE, 0x0B, 0xE7, 0xF8, 0xF4, 0x00, 0x00,
-    0x06, 0x0F, 0xD7, 0xF2, 0xF0, 0xBC, 0x1F, 0xC3, 0xF4, 0x1D, 0x00, 0x15, 0x00, 0x07, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xF8, 0x3F, 0x96, 0xFD, 0xBD, 0x00, 0x3E, 0xFC, 0xBE, 0x2F, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x29, 0x00, 0x08, 0x20, 0x3E, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D,
-    0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F, 0x8F, 0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x40, 0x0F,
-    0x90, 0x3F, 0xD0, 0x7E, 0x1F, 0xEB, 0xE0, 0xA0, 0x00, 0x20, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xE0,
-    0x1F, 0xE0, 0xBF, 0x00, 0x2F, 0x4F, 0xF0, 0x0B, 0xF5, 0xE7, 0x83, 0xF4, 0x2C, 0x3C, 0x34, 0x03,
-    0x81, 0xD0, 0xA4, 0x2F, 0x47, 0xF0, 0x7D, 0x1F, 0x5F, 0xCB, 0xD2, 0x90, 0x05, 0x07, 0xFC, 0xFF,
-    0xEF, 0xFE, 0x7F, 0xD1, 0x90, 0x02, 0x80, 0x13, 0xC4, 0x3F, 0xFC, 0x7F, 0xFD, 0x0B, 0xE0, 0x2E,
-    0xB8, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xE0, 0x3F, 0xBF, 0xEF, 0xC7, 0x80, 0xF0,
-    0x2C, 0x74, 0x0F, 0x01, 0xD7, 0x80, 0xF0, 0x2C, 0x3F, 0xBF, 0xEF, 0xC0, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xF9, 0x55, 0x6B, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00,
-    0x2A, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xF9, 0x55, 0x6B, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00,
-    0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x14, 0x02, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xAB, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x40, 0x05, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x5A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xE5, 0x01, 0x5B, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x6F, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x19, 0x7E, 0x00, 0x2F, 0x2F,
-    0xFF, 0x7C, 0x1F, 0xBC, 0x3F, 0x3F, 0xEF, 0x05, 0x05, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xE6, 0xE1,
-    0xF0, 0x3C, 0x7F, 0xFF, 0x1F, 0x00, 0x03, 0xE0, 0x10, 0x7F, 0xF8, 0x01, 0x54, 0x00, 0x77, 0xD0,
-    0x2D, 0xF7, 0xDF, 0x7D, 0xF7, 0xD5, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x03, 0xEB, 0xE1, 0xF0, 0x3C,
-    0xB8, 0x0F, 0x6F, 0x03, 0xC3, 0xD2, 0xF0, 0x7F, 0xF0, 0x01, 0x50, 0x00, 0x78, 0x0F, 0x2F, 0x03,
-    0xCB, 0xC0, 0xF2, 0xF0, 0x3C, 0xBC, 0x1F, 0x1F, 0x4F, 0xC3, 0xFF, 0xF0, 0x15, 0x04, 0x00, 0x00,
-    0x7F, 0xD7, 0xEA, 0x6E, 0x00, 0xF4, 0x03, 0xE0, 0x0B, 0xD1, 0x4B, 0xFE, 0x01, 0x50, 0x00, 0x0F,
-    0x00, 0x1F, 0x00, 0x1F, 0x1F, 0xEF, 0x3E, 0xBF, 0xBC, 0x1F, 0xB8, 0x0F, 0xB8, 0x0F, 0x7D, 0x2F,
-    0x3F, 0xEF, 0x05, 0x45, 0x78, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xFB, 0xF4, 0x7F, 0xBF, 0x1F,
-    0x03, 0xC7, 0xC0, 0xF1, 0xF0, 0x3C, 0x7C, 0x0F, 0x1F, 0x03, 0xC1, 0x40, 0x50, 0x00, 0x00, 0x00,
-    0x3D, 0xFE, 0x7F, 0x8F, 0xEB, 0xFA, 0xF7, 0xE0, 0xF8, 0x2E, 0xF4, 0x3D, 0x0B, 0xBD, 0x0F, 0x42,
-    0xEF, 0x43, 0xD0, 0xBB, 0xD0, 0xF4, 0x2E, 0x50, 0x14, 0x01, 0x00, 0x00, 0x0F, 0x3D, 0xFF, 0xDF,
-    0x80, 0xF4, 0x0F, 0x40, 0xF4, 0x0F, 0x40, 0x50, 0x00, 0x05, 0x00, 0x3C, 0x03, 0xFF, 0x1B, 0xE8,
-    0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0xF0, 0x05, 0x40, 0xB8, 0x0F, 0x5F, 0x07, 0xC3,
-    0xD2, 0xE0, 0x78, 0xF0, 0x0F, 0x78, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x2F, 0x07, 0xC0,
-    0xF8, 0xF4, 0x03, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xFD, 0x00, 0xBD, 0xF0, 0x1F, 0x0B, 0xC1, 0x40,
-    0x14, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0,
-    0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0,
-    0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55,
-    0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFC, 0x3F, 0xFF, 0xFA, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF0, 0x06, 0xFF, 0xE0, 0xFF, 0xC0, 0x02, 0xFF, 0xC3, 0xFF, 0x00,
-    0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0xFF, 0xD5, 0x5F, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0xEA, 0xAF, 0xFF, 0x43, 0xFF, 0x00, 0x0B, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF4, 0xFF, 0xC0, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x07, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD5, 0x55, 0x7F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
-    0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xE7, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x7F, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0xFF, 0x80, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-    0x03, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x15, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xC0, 0x00, 0x07, 0xFD, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xD5,
-    0x55, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xEA, 0xAA, 0xAF, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFE, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0xFF, 0xFF, 0x0F,
-    0xFD, 0x3F, 0xF0, 0xFF, 0xFF, 0x0F, 0xFD, 0x3F, 0xF0, 0xFF, 0xFF, 0x0F, 0xFD, 0x3F, 0xF4, 0xFF,
-    0xFF, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x00, 0xBF,
-    0xF0, 0xFF, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
-    0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x00, 0xFF, 0xC1, 0xFF, 0xD0, 0x00, 0xFF,
-    0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF6, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0xFF, 0xC0, 0x03, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE7, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x81, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x3F,
-    0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x00,
-    0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0x07, 0xFE,
-    0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFF, 0x00,
-    0x00, 0x0B, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xDF,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD,
-    0xFF, 0xBF, 0xC0, 0x00, 0xBF, 0xBF, 0xDF, 0xF7, 0xFC, 0x00, 0x0F, 0xF7, 0xFD, 0xFF, 0x6F, 0xD0,
-    0x00, 0xFF, 0x3F, 0xDF, 0xF5, 0xFE, 0x00, 0x1F, 0xD3, 0xFD, 0xFF, 0x4F, 0xF0, 0x03, 0xFC, 0x3F,
-    0xDF, 0xF4, 0xFF, 0x40, 0x3F, 0xC7, 0xFD, 0xFF, 0x47, 0xF8, 0x07, 0xF4, 0x7F, 0xDF, 0xF8, 0x3F,
-    0xC0, 0xFF, 0x07, 0xFD, 0xFF, 0x83, 0xFD, 0x0F, 0xF0, 0x7F, 0xDF, 0xF8, 0x2F, 0xE1, 0xFE, 0x07,
-    0xFD, 0xFF, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0xDF, 0xF8, 0x0F, 0xF7, 0xFC, 0x07, 0xFD, 0xFF, 0x80,
-    0xBF, 0xFF, 0x80, 0x7F, 0xDF, 0xF8, 0x07, 0xFF, 0xF0, 0x07, 0xFD, 0xFF, 0x80, 0x3F, 0xFF, 0x00,
-    0x7F, 0xDF, 0xF8, 0x02, 0xFF, 0xE0, 0x07, 0xFD, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xDF, 0xF8,
-    0x00, 0xFF, 0xC0, 0x07, 0xFD, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xC0, 0x00, 0x07, 0xFC,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xCF, 0xFF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xCF, 0xFF, 0xFD, 0x00, 0x07, 0xFC, 0xFF, 0xBF, 0xF0, 0x00, 0x7F, 0xCF, 0xF7, 0xFF, 0x80, 0x07,
-    0xFC, 0xFF, 0x4F, 0xFC, 0x00, 0x7F, 0xCF, 0xF4, 0xBF, 0xF0, 0x07, 0xFC, 0xFF, 0x43, 0xFF, 0x40,
-    0x7F, 0xCF, 0xF4, 0x2F, 0xFC, 0x07, 0xFC, 0xFF, 0x40, 0xFF, 0xD0, 0x7F, 0xCF, 0xF8, 0x07, 0xFF,
-    0x07, 0xFC, 0xFF, 0x80, 0x3F, 0xF8, 0x7F, 0xCF, 0xF8, 0x00, 0xFF, 0xC7, 0xFC, 0xFF, 0x80, 0x0B,
-    0xFF, 0x7F, 0xCF, 0xF8, 0x00, 0x3F, 0xFB, 0xFC, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xCF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xCF, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xCF, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0x55, 0x55, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xAA, 0xAA, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xD5, 0x55, 0x5F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xF5, 0x6F, 0xFF, 0xC3,
-    0xFF, 0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x03, 0xFF, 0xC3, 0xFF, 0xAB, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xAA, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x55, 0x55, 0x50, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0x57, 0xFF, 0x95, 0x54, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF,
-    0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xE6, 0xFF, 0x9B, 0xFF, 0xF0, 0x2F, 0xFD, 0x01, 0xFF, 0x80, 0x7F, 0xF8, 0x3F,
-    0xF4, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFD, 0x7F, 0xE0, 0x01,
-    0xFF, 0x80, 0x0B, 0xFE, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x7F, 0xE0, 0x01, 0xFF, 0x80,
-    0x07, 0xFE, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC,
-    0x3F, 0xFC, 0x01, 0xFF, 0x80, 0x2F, 0xFC, 0x1F, 0xFF, 0x41, 0xFF, 0x81, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xBF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x02, 0xFF, 0xC0,
-    0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x0B,
-    0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC2, 0xFF, 0xC0, 0x00, 0x1F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x7F,
-    0xF4, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x2F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x4F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0xBF,
-    0xC0, 0x0F, 0xF8, 0xFF, 0x80, 0x2F, 0xF0, 0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x8F,
-    0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE3, 0xFE, 0x00, 0xBF, 0xC0, 0x0F, 0xF8, 0xFF, 0x80, 0x2F, 0xF0,
-    0x03, 0xFE, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x4F, 0xF8, 0x02, 0xFF, 0x00, 0x7F, 0xD3, 0xFE,
-    0x00, 0xBF, 0xC0, 0x1F, 0xF4, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0x1F, 0xF8, 0x0B, 0xFC, 0x07,
-    0xFF, 0x03, 0xFF, 0xD2, 0xFF, 0x1B, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x1B, 0xFF, 0xC0, 0x2F, 0xFE, 0x00, 0x01, 0xFF, 0xE0,
-    0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xF0, 0x00, 0x00,
-    0x2F, 0xF8, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0xBF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFC, 0xBF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0xF8,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xE0, 0x2F, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x3F, 0xE0, 0x03, 0xFF, 0xFF, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0x5B, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0xBF, 0xE0, 0x7F,
-    0xF0, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x00, 0x3F, 0xE0, 0x7F, 0xE0,
-    0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xF0, 0x00, 0x7F, 0xE0, 0x3F, 0xF4, 0x00,
-    0xBF, 0xE0, 0x3F, 0xFC, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0xAF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0x4F, 0xFF, 0x00, 0xBF, 0xF8, 0x07, 0xFF, 0x00, 0x05, 0x40, 0x00, 0x14,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFD, 0x6F, 0xFE, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x03, 0xFF, 0x0B,
-    0xFD, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0xBF, 0xD0, 0x1F,
-    0xFC, 0x0B, 0xFD, 0x3F, 0xFE, 0x00, 0xBF, 0xD3, 0xFF, 0x40, 0x0B, 0xFD, 0x3F, 0xFF, 0x40, 0xBF,
-    0xD2, 0xBF, 0xFF, 0x0B, 0xFD, 0x00, 0x3F, 0xF8, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0B,
-    0xFD, 0xBF, 0xD0, 0x00, 0xBF, 0xDB, 0xFD, 0x00, 0x0B, 0xFD, 0xBF, 0xD0, 0x00, 0xFF, 0xDB, 0xFF,
-    0x00, 0x3F, 0xFC, 0xBF, 0xFF, 0xAF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFE, 0xBF, 0xFE, 0x00, 0xBF, 0xD0, 0x54, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x07, 0xFE, 0x2F, 0xF4, 0x00, 0x7F, 0xE1,
-    0xFF, 0x80, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xF4, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC7, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0x41, 0xBF, 0x40, 0x3F, 0xE0, 0x00, 0xA0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0xBF, 0xF8, 0x3F, 0xF4, 0x01,
-    0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFD, 0xBF, 0xD0, 0x00, 0x7F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x07, 0xFE, 0xBF, 0xE0, 0x00, 0xFF, 0xE7, 0xFF, 0x80, 0x2F,
-    0xFC, 0x3F, 0xFF, 0xAF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x94, 0x00, 0x0B, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFC, 0x3F, 0xF8, 0x06, 0xF0, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xAA, 0x00, 0xBF, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x02,
-    0x2F, 0xFE, 0x55, 0xBC, 0x3F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF9, 0x00,
-    0x00, 0x54, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0x00, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x19, 0x40, 0x0B, 0xF8, 0x7F, 0xFF, 0x80,
-    0xBF, 0xDF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0x9F, 0xFF, 0x8B, 0xFF, 0x80,
-    0x2F, 0xFC, 0xBF, 0xF0, 0x00, 0xFF, 0xCB, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF, 0xCB,
-    0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x0F, 0xFE, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x7F, 0xD3, 0xFE, 0x00, 0x03, 0xFE, 0x7F, 0xE0,
-    0x00, 0x3F, 0xF7, 0xFF, 0xAA, 0xAB, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0x00, 0x07, 0xFF, 0x7F, 0xE0, 0x00, 0x3F, 0xE3, 0xFE, 0x00,
-    0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xD2, 0xFF, 0x00, 0x0B, 0xFC, 0x1F, 0xF4, 0x00, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x0B, 0xFF, 0x5B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF,
-    0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xAD, 0x2F, 0xFF, 0xF4, 0x3F, 0xFF, 0xD0, 0x2F, 0xFF, 0x40,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x87, 0xFE, 0x00, 0x2F, 0xF8,
-    0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x1F, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFE,
-    0x0F, 0xFD, 0x00, 0x1F, 0xF8, 0xFF, 0xD0, 0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x01,
-    0xFF, 0x80, 0xFF, 0xD0, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x03, 0xFF, 0x81, 0xFF, 0x80, 0x03, 0xFF, 0x87, 0xFE, 0x00, 0x07, 0xFF, 0x40, 0x15, 0x50, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x6A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x5F, 0xF4, 0x00, 0x02, 0xFF, 0x0F,
-    0xF8, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x0B, 0xFD, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x02, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0xFF, 0xFC,
-    0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x7F, 0xF0, 0x00, 0x7F, 0xFC, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00,
-    0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF,
-    0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0xFF, 0xC0,
-    0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0xF0, 0x02, 0xFF, 0xC0, 0xBF, 0xF4, 0x07, 0xFF, 0xD0, 0xBF,
-    0xFF, 0xBF, 0xFF, 0xF9, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x2F, 0xFD, 0xBF, 0xEF,
-    0xFC, 0x0B, 0xFD, 0xBF, 0xD0, 0x40, 0x00, 0x50, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x03, 0xFF, 0x7F, 0xE0, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x07, 0xFE, 0x2F, 0xF4, 0x00,
-    0x7F, 0xE1, 0xFF, 0x80, 0x07, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0xBF, 0xC0, 0x0B, 0xFC, 0x07,
-    0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF8, 0x02, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xF4, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x07, 0xFC, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFD, 0x05, 0xBF, 0xE5, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFA, 0xA4, 0x2F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0x57, 0xFF, 0xC0, 0xBF, 0xF0, 0x03,
-    0xFF, 0x43, 0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1,
-    0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x0F, 0xFD, 0x03, 0xFF, 0xEA, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xFF, 0xFA, 0xAB,
-    0xFF, 0xA9, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x40, 0x00, 0x7F,
-    0xE0, 0x03, 0xFF, 0xEE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0xFE, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xFE,
-    0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x65, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0x5B, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFD, 0x2F, 0xF4, 0x00, 0xBF, 0xE3, 0xFF, 0x00, 0x07, 0xFF,
-    0x3F, 0xF0, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x3F, 0xF3, 0xFF, 0x00,
-    0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x7F, 0xF3, 0xFF, 0x00, 0x0B, 0xFE, 0x3F, 0xF8, 0x01, 0xFF, 0xC3,
-    0xFF, 0xFA, 0xBF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF7, 0xFF,
-    0xE0, 0x03, 0xFF, 0x01, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x02, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0x9B, 0xF0, 0x2F, 0xFC, 0x00, 0x10, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xEB, 0xFF, 0xA8, 0x2F, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x7F, 0xE0,
-    0x7F, 0xE0, 0x00, 0x7F, 0xF0, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x00, 0xBF, 0xE0, 0x3F,
-    0xF0, 0x00, 0xFF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x0F, 0xFF, 0xAF, 0xFF, 0x40, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x2A, 0xBF, 0xFA, 0xAA, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0xFE, 0xB8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF4,
-    0xBF, 0xD0, 0x02, 0xFF, 0x8B, 0xFD, 0x00, 0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xBF, 0xCB,
-    0xFD, 0x00, 0x0B, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC7, 0xFD, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC7, 0xFE, 0x00, 0x1F, 0xF8, 0x3F, 0xF4, 0x03, 0xFF, 0x42, 0xFF, 0xFB, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x7F, 0xF7, 0xFF, 0xF0, 0x2F, 0xFD, 0x0B, 0xFC,
-    0x1F, 0xFE, 0x0F, 0xFE, 0x02, 0xFF, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0xBF, 0xC0, 0x3F, 0xF5, 0xFF,
-    0x80, 0x2F, 0xF0, 0x0B, 0xFE, 0x7F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF, 0x9F, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xE7, 0xFF, 0x00, 0xBF, 0xC0, 0x2F, 0xF8, 0xFF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFD, 0x3F, 0xF8,
-    0x0B, 0xFC, 0x07, 0xFF, 0x07, 0xFF, 0x82, 0xFF, 0x07, 0xFF, 0x80, 0xBF, 0xFE, 0xFF, 0xEF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xBF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F,
-    0xDF, 0xFF, 0xC0, 0x00, 0x3F, 0xF3, 0xFF, 0xF8, 0x00, 0x2F, 0xF4, 0xFF, 0xFF, 0x40, 0x0F, 0xFC,
-    0x00, 0x7F, 0xF0, 0x0B, 0xFC, 0x00, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x00,
-    0x00, 0x2F, 0xF4, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0x00,
-    0xBF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x44, 0x2F,
-    0xF4, 0x00, 0xFF, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xCB, 0xFC, 0x00, 0x03, 0xFF, 0xF7, 0xFE,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x1F, 0xF8, 0xBF,
-    0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0x0F, 0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B,
-    0xFC, 0xBF, 0xC0, 0x2F, 0xF0, 0x0B, 0xFD, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFD, 0xBF, 0xC0, 0x2F,
-    0xF0, 0x07, 0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x03, 0xFE, 0xBF,
-    0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF, 0xC0, 0x2F, 0xF0, 0x07, 0xFE, 0xBF, 0xD0, 0x2F, 0xF0, 0x0B,
-    0xFD, 0x7F, 0xF0, 0x2F, 0xF0, 0x0F, 0xFC, 0x3F, 0xF8, 0x2F, 0xF0, 0x7F, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00,
-    0x15, 0x50, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xD0, 0x03, 0xFE, 0x00,
-    0x2F, 0xF0, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xBF, 0xC3, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x0F,
-    0xF8, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x3F, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x7F, 0xF4, 0x0B, 0xFD, 0x03, 0xFF, 0xEB, 0xFF, 0xFA, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x1F, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF,
-    0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x00,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xF5, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x5B, 0xFE, 0x01, 0xBF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0xBF, 0xF9, 0xFF, 0xD0, 0x07, 0xFE, 0xBF,
-    0xE0, 0x01, 0xFF, 0xAF, 0xF4, 0x00, 0xBF, 0xEB, 0xFE, 0x00, 0x7F, 0xF9, 0xFF, 0xE5, 0xBF, 0xFE,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1F, 0xE0, 0x7F, 0xFE, 0x03, 0xF8, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x0A, 0xA4, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x59, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x56, 0xFF, 0x80, 0x6F, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xAF, 0xFE,
-    0x7F, 0xF4, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x7F, 0xEB, 0xFD, 0x00, 0x2F, 0xFA, 0xFF, 0x80, 0x1F,
-    0xFE, 0x7F, 0xF9, 0x6F, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC7, 0xF8, 0x1F, 0xFF,
-    0x80, 0xFE, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2A, 0xA0, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0xBD, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xD0,
-    0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0x0F,
-    0xE0, 0x00, 0x3F, 0xFF, 0x9A, 0x40, 0x00, 0xBF, 0x6F, 0xE0, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00,
-    0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x65, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xF5,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x56,
-    0xFF, 0x80, 0x01, 0xBF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xEB, 0xFF,
-    0x80, 0x7F, 0xF4, 0x01, 0xFF, 0x80, 0xBF, 0xE0, 0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF, 0x80,
-    0xBF, 0xE0, 0x07, 0xFF, 0x80, 0x7F, 0xF9, 0x6F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F,
-    0xFF, 0xFC, 0x7F, 0x80, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x2A, 0xA4, 0x00, 0x00,
-    0x01, 0xF8, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00,
-    0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x3F, 0xFC, 0x00, 0x01, 0xA3, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xEB, 0xF8,
-    0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x59, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xAF, 0xFE, 0x07, 0xFF, 0x40, 0x1F, 0xF8, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0xBF, 0xD0, 0x02,
-    0xFF, 0x82, 0xFF, 0x80, 0x1F, 0xFE, 0x07, 0xFF, 0x96, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x1F, 0xFF, 0xFC, 0x7F, 0x80, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2A, 0xA4, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0xFC,
-    0x7C, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x80, 0x00, 0x00, 0x1F,
-    0xD0, 0x0F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x3F, 0xFC, 0x3F, 0x00, 0x03, 0xFF, 0xFC,
-    0xA0, 0x00, 0x2F, 0xEB, 0xF8, 0x00, 0x01, 0xFD, 0x07, 0xF4, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xBD, 0x42, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x05, 0x6F, 0xF8, 0x00, 0x6F, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xAF, 0xFE, 0x07, 0xFF, 0x40, 0x1F, 0xF8, 0x2F, 0xF8, 0x00,
-    0x7F, 0xE0, 0xBF, 0xD0, 0x02, 0xFF, 0x82, 0xFF, 0x80, 0x1F, 0xFE, 0x07, 0xFF, 0x96, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x7F, 0x80, 0x1F, 0xFF, 0x80, 0xFE, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xB4, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xD6, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x1A,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF4, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF,
-    0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x06, 0x90, 0x0A,
-    0x00, 0x0F, 0xFF, 0x4B, 0xC0, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xD0, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x7F, 0xAF, 0xD0, 0x00, 0x3F,
-    0x41, 0xFC, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80,
-    0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x3F, 0xD0, 0x00, 0x00, 0x3F,
-    0x80, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00,
-    0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4,
-    0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xA9, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0xBF,
-    0xC0, 0x03, 0xFD, 0x07, 0xFC, 0x01, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x94, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8,
-    0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F,
-    0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0xC2, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x00,
-    0x0B, 0xF9, 0x6F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80,
-    0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00,
-    0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F,
-    0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0x03, 0xF0, 0x50, 0x02, 0xF1,
-    0xA0, 0xBC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00,
-    0x06, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x50, 0xBF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x15, 0xBF, 0xE0, 0x1B, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xEB, 0xFF, 0x9F, 0xFD, 0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x1F, 0xFA, 0xFF,
-    0x40, 0x0B, 0xFE, 0xBF, 0xE0, 0x07, 0xFF, 0x9F, 0xFE, 0x5B, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xF1, 0xFE, 0x07, 0xFF, 0xE0, 0x3F, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0x47, 0xD2, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xF9, 0x6F, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8,
-    0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x0B, 0xD0, 0x50, 0x02, 0xF0, 0x64, 0xBC, 0x00, 0x7E,
-    0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFA, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0x50, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x15, 0xBF, 0xE0, 0x1B, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xEB, 0xFF, 0x9F, 0xFD, 0x00, 0x7F, 0xEB, 0xFE, 0x00, 0x1F, 0xFA, 0xFF, 0x40, 0x0B, 0xFE, 0xBF,
-    0xE0, 0x07, 0xFF, 0x9F, 0xFE, 0x5B, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFE,
-    0x07, 0xFF, 0xE0, 0x3F, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0x0B, 0x83, 0xD0, 0x00, 0x00, 0x0F, 0x81, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xF5,
-    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x2B, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x01, 0x41, 0xF8, 0x10,
-    0x00, 0xFC, 0x34, 0x3F, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07,
-    0xFE, 0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0xB8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x03, 0xE6, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0x80, 0x1A, 0x40, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x5B, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xF8, 0x00, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x3F,
-    0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x06, 0x90, 0x0A, 0x00, 0x0B, 0xFF, 0x4B, 0xC0,
-    0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x0B,
-    0xC0, 0x0B, 0xE0, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x6F,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x8B, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE, 0xBF, 0xD0, 0x02,
-    0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x01, 0xA0,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xE0,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xBF, 0xD0,
-    0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x55, 0x56, 0xFF, 0xC0, 0x1F, 0xFC, 0x00,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF8, 0x00, 0x00, 0xBF, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0xF0, 0x7F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x2A, 0x00,
-    0xFD, 0x00, 0x2F, 0x80, 0x1F, 0xFA, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE0,
-    0x00, 0x01, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x94, 0x00, 0x01, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xD4, 0x2F, 0xFD, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x05, 0x6F, 0xF8, 0x06, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFA, 0xFF, 0xE7, 0xFF, 0x40, 0x1F, 0xFA, 0xFF, 0x80, 0x07, 0xFE,
-    0xBF, 0xD0, 0x02, 0xFF, 0xAF, 0xF8, 0x01, 0xFF, 0xE7, 0xFF, 0x96, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFC, 0x7F, 0x81, 0xFF, 0xF8, 0x0F, 0xE0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE,
-    0x03, 0xFF, 0x42, 0xFF, 0x80, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFF, 0x00, 0x07, 0xFD,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x01, 0x00,
-    0xFF, 0xF9, 0x5B, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x10, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x42, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF,
-    0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x3E, 0x2F, 0xFF, 0xEF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD, 0x1F,
-    0xFF, 0x4B, 0x80, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x03, 0xF0, 0x02, 0xFF, 0xFE, 0xBE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xE1, 0xFF, 0xF4, 0x00, 0x7C, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F,
-    0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0xAA, 0x90, 0x7F, 0x00, 0x2F, 0xFF, 0x5F, 0xC0, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x2F, 0x80, 0x01, 0x40, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x55, 0x55, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFA, 0xAA,
-    0xA0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0xFD, 0x2F, 0x80, 0x00, 0x2F, 0xFF, 0xCA, 0x40, 0x00, 0x1F, 0xE7, 0xFC, 0x00, 0x00, 0x0F,
-    0xE0, 0x3F, 0x80, 0x00, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x01, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0x95,
-    0xBF, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x2A, 0xA4, 0x00, 0x01, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xF8, 0x7F, 0x80, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x05, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0xAA, 0xA8, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0xF4,
-    0x00, 0x00, 0xA6, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xF9, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80,
-    0x00, 0x2F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xE0, 0x3F, 0xF4, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00,
-    0x07, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x10, 0x00, 0xFF, 0xF9, 0x5B, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0xAA, 0x90, 0xFE, 0x00, 0xBF, 0xFD, 0x3C, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0x83, 0xFC, 0x00,
-    0x3F, 0x80, 0x2F, 0x80, 0x05, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xD5,
-    0x55, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFA, 0xAA, 0xA0, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xFD, 0x2F, 0x40,
-    0x02, 0xFF, 0xFC, 0x64, 0x00, 0x1F, 0xE7, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0B, 0xD0,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xD0, 0x2F,
-    0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x04, 0x00, 0xFF,
-    0xF9, 0x5B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x7C, 0x1F, 0xFF,
-    0xEF, 0x82, 0xE5, 0xFF, 0xF0, 0x28, 0x01, 0xA8, 0x00, 0x01, 0x54, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0x80, 0x0B, 0xF1, 0xFE, 0x02, 0xF8, 0x02, 0xF8, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xD5, 0x55, 0x4F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE,
-    0xAA, 0xA8, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0x90, 0x0A, 0x00, 0x02, 0xFF, 0xE1, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x0B, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xBF, 0x40, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x0B, 0x90,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x00, 0x7F, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10, 0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0xAA, 0x80, 0x00, 0x2F, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x01, 0xFF, 0x7F, 0xE0, 0x3F,
-    0xC0, 0xBF, 0x8B, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD5, 0x55, 0x4F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x55, 0x54,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xAA, 0xA8, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFA, 0xFF, 0x00, 0x03,
-    0xFD, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xE0, 0x3F, 0xF4, 0x2F, 0xF8, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xF0, 0x00, 0x7F,
-    0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x10,
-    0x0F, 0xFF, 0x95, 0xBF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x02, 0xFF, 0xF4, 0x06, 0xBF,
-    0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xA0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0x80, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1A, 0x90, 0x0F, 0xFF, 0x43, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0xBF, 0x00,
-    0xBF, 0xC0, 0xBF, 0x80, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x2F,
-    0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0xBF,
-    0xE0, 0x2F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFE, 0x02, 0xFF,
-    0x80, 0xBF, 0xE0, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xF8, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x40, 0x03, 0xFF, 0x00,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x05, 0x07, 0xFD, 0xBF, 0xEB,
-    0xFE, 0x7F, 0xD0, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE,
-    0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF, 0xEB, 0xFE, 0xBF,
-    0xEB, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x87, 0xFE, 0xBF, 0xFB, 0xFE, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07,
-    0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8,
-    0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0x57, 0xFF, 0xC0, 0xBF, 0xF0, 0x03, 0xFF,
-    0x43, 0xFF, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF,
-    0x80, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF0, 0xFF, 0xD0, 0x02, 0xFF, 0x82, 0xFF, 0xC0, 0x0F, 0xFD, 0x03, 0xFF, 0xEA, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F,
-    0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFD, 0x5F, 0xFF, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x03,
-    0xFF, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0xC3,
-    0xFF, 0x40, 0x0B, 0xFE, 0x0B, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2A,
-    0xA8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F,
-    0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFD,
-    0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0xCA, 0x80, 0x00, 0x1F, 0xE7, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x3F,
-    0x80, 0x00, 0x0B, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x02, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x01, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x03, 0xFF,
-    0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x40, 0x0B, 0xFE, 0x00, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0x0F, 0xFF, 0xAB, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xF0, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0,
-    0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
-    0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00,
-    0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF,
-    0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC2, 0xFF, 0xD0, 0x00, 0x00, 0xA5, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x7F,
-    0xC0, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFD, 0x5F, 0xFF, 0x00, 0x2F, 0xFC, 0x00, 0xFF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x0B, 0xFF, 0x00, 0x3F, 0xF4,
-    0x00, 0xFF, 0xFA, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x2A, 0xA8, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0xFD, 0x3D, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xF0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xFD, 0x2F, 0x40,
-    0x02, 0xFF, 0xFC, 0x64, 0x00, 0x1F, 0xE7, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0B, 0xD0,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF, 0xF0, 0x2F,
-    0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF,
-    0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF, 0x40, 0xFF,
-    0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x3C, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x02, 0xF5, 0xFF, 0xF0, 0x00, 0x00,
-    0x02, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00, 0x02, 0xF8,
-    0x02, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40,
-    0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x06, 0x90, 0x06, 0x00, 0x00, 0x7F, 0xF9, 0x7C, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00,
-    0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00, 0x7F,
-    0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5, 0xFF,
-    0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x1F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF, 0x00,
-    0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03, 0xFF,
-    0x40, 0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x7F, 0xC0,
-    0x00, 0x00, 0x0B, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x07, 0xFF, 0xE0, 0x07, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF7, 0xFD, 0x00, 0x01, 0xFF, 0x03, 0xFD,
-    0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD5,
-    0xFF, 0xF0, 0x2F, 0xFC, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF,
-    0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x3F, 0xF1, 0xFF, 0x80, 0x00, 0xFF, 0xC7, 0xFF,
-    0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0xBF, 0xF0, 0x03,
-    0xFF, 0x40, 0xFF, 0xFA, 0xBF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xB8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x59, 0x40, 0x0B, 0xFD,
-    0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xEA, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x07, 0xFF, 0x40,
-    0x00, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x59,
-    0x40, 0x0B, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xEA, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00,
-    0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xF0,
-    0x07, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x05, 0x94, 0x00, 0xBF, 0xD0,
-    0x07, 0xFF, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFE, 0xAF, 0xFF, 0xF4, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF4, 0x00,
-    0x0F, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x7D, 0x00, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0xBF, 0xFC, 0x00,
-    0x00, 0x0F, 0x40, 0x1E, 0x40, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x59, 0x40,
-    0x0B, 0xFD, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xEA, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFF,
-    0xD0, 0x01, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xF0, 0x07,
-    0xFF, 0x40, 0x00, 0xFF, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x01,
-    0xBF, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x2F, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xE4, 0x07, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x16, 0x50, 0x02, 0xFF, 0x40,
-    0x1F, 0xFF, 0xF8, 0x0F, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFA, 0xBF, 0xFF, 0xD0, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x7F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0xD0, 0x00,
-    0x3F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F,
-    0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF,
-    0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x4F, 0xFD,
-    0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xBF, 0xF0, 0x7F, 0xF8, 0x00, 0xBF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x90, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFE, 0x00, 0x2F, 0xFC, 0xBF, 0xF4, 0x07, 0xFF,
-    0xC7, 0xFF, 0xFB, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE3, 0xFC, 0x02, 0xFF,
-    0xF4, 0x3F, 0xC0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F,
-    0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF,
-    0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3, 0xFF, 0x00, 0x00, 0x2F, 0xF4,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0xBF, 0xD3,
-    0xFF, 0x00, 0x00, 0x3F, 0xF4, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x07,
-    0xFF, 0x80, 0x0B, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x0A, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0,
-    0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC,
-    0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xCB, 0xFD, 0x00,
-    0x0F, 0xFC, 0xBF, 0xE0, 0x02, 0xFF, 0xCB, 0xFF, 0x40, 0x7F, 0xFC, 0x7F, 0xFF, 0xBF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x2F, 0xFF, 0x43, 0xFC, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x6F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC7,
-    0xFE, 0x2F, 0xF4, 0x00, 0x3F, 0xF7, 0xFF, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x01, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4B,
-    0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x6F, 0xF8, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC7,
-    0xFE, 0x2F, 0xF4, 0x00, 0x3F, 0xF7, 0xFF, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0xFF, 0xF9, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x01, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
-    0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4B, 0xFD, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x6F, 0xF8, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x0F, 0xFC, 0x7F, 0xE2, 0xFF, 0x40, 0x03, 0xFF,
-    0x7F, 0xF0, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x0B, 0xFD,
-    0x00, 0x0F, 0xFF, 0x90, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40,
-    0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00,
-    0x0B, 0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xBF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE3, 0xFC, 0x00, 0x00,
-    0x0B, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xAF, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x4B, 0xFD, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x6F, 0xF8, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x0F, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xAF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xD1, 0xFF,
-    0xF4, 0x00, 0x00, 0x02, 0xE0, 0x06, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0xFF, 0xC7, 0xFE, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF7, 0xFF, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x42, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0xBF,
-    0xD0, 0x00, 0xFF, 0xF9, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00,
-    0x00, 0xBF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0x2F, 0xFD, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFB,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x3F, 0xC0, 0x00,
-    0x00, 0xBF, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x3F, 0xE0, 0x00, 0x02, 0xFF,
-    0x4B, 0xFD, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x6F, 0xF8,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F,
-    0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0xFF, 0x40,
-    0x03, 0xFF, 0x1F, 0xF8, 0xBF, 0xD0, 0x00, 0xFF, 0xDF, 0xFC, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFD,
-    0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0xE4, 0x00, 0xBF, 0xD0, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02,
-    0xFF, 0x40, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x00, 0xBF,
-    0xF4, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF,
-    0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0,
-    0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2, 0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07,
-    0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF,
-    0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2,
-    0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
-    0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87,
-    0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0B, 0x80, 0x00, 0x7F, 0xFC, 0x3F, 0xF0, 0x3F, 0xFF,
-    0xF0, 0x3F, 0xF0, 0x3F, 0xFF, 0xE0, 0x3F, 0xF0, 0x3F, 0xFF, 0x40, 0x1F, 0xD0, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x0A, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x2F, 0xF9, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0xE0, 0x03, 0xFF,
-    0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x7F, 0xF0,
-    0x00, 0x0B, 0xFE, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x04, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x02,
-    0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00, 0x00, 0x7F,
-    0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0x01, 0xF0, 0x00, 0x03, 0xFF, 0xFA, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFC,
-    0x2F, 0xFF, 0x00, 0x00, 0x3D, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x02, 0xFF, 0x9F, 0xFC, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80,
-    0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xE2,
-    0xFF, 0x40, 0x00, 0x0F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0x40, 0x00, 0xFF, 0xFE, 0xBF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF4, 0xBF, 0xFC, 0x00, 0x03, 0xD0, 0x06, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x7F, 0xF0,
-    0x00, 0x2F, 0xF4, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x00,
-    0xBF, 0xD0, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x02, 0xFF,
-    0x00, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x87, 0xFD, 0x00, 0x00, 0xBF, 0xCB, 0xFC, 0x00,
-    0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0xC2, 0xFF, 0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0,
-    0x00, 0xFF, 0xFE, 0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xDF, 0xE0,
-    0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8,
-    0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE,
-    0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F,
-    0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF,
-    0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7,
-    0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD,
-    0xFE, 0x00, 0x7F, 0x6A, 0x40, 0x0A, 0x80, 0x15, 0x55, 0x55, 0x50, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF,
-    0xFF, 0xCA, 0xAA, 0xAA, 0xA9, 0x02, 0xF8, 0x1F, 0xE0, 0xBF, 0x43, 0xFC, 0x1F, 0xF0, 0xFF, 0x83,
-    0xFE, 0x1F, 0xF4, 0x15, 0x40, 0x0F, 0xF8, 0x3F, 0xE1, 0xFF, 0x4B, 0xFC, 0x3F, 0xE0, 0xFF, 0x03,
-    0xFC, 0x1F, 0xD0, 0x15, 0x00, 0x07, 0xFC, 0x0B, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F,
-    0xE0, 0x2F, 0xC0, 0x3F, 0xC0, 0x15, 0x00, 0x7F, 0xC1, 0xFF, 0x43, 0xFE, 0x0B, 0xFC, 0x1F, 0xF0,
-    0x3F, 0xC0, 0xBF, 0x40, 0xFE, 0x01, 0x54, 0x02, 0xF8, 0x07, 0xF4, 0x1F, 0xE0, 0x2F, 0xC0, 0xBF,
-    0x40, 0xFF, 0x03, 0xFC, 0x0B, 0xF8, 0x1F, 0xF0, 0x3F, 0xD0, 0xFF, 0x80, 0xFF, 0x43, 0xFE, 0x0B,
-    0xFC, 0x1F, 0xF4, 0x3F, 0xF0, 0x15, 0x40, 0x55, 0x40, 0x0F, 0xF8, 0x1F, 0xF4, 0x3F, 0xE0, 0xBF,
-    0xC1, 0xFF, 0x43, 0xFF, 0x0B, 0xFC, 0x0F, 0xF8, 0x3F, 0xE0, 0x3F, 0xC0, 0xFF, 0x01, 0xFF, 0x03,
-    0xFC, 0x0B, 0xF4, 0x1F, 0xD0, 0x3F, 0xC0, 0x15, 0x00, 0x54, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0xBF,
-    0xC0, 0xFF, 0xC2, 0xFF, 0x03, 0xFD, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0xBF, 0xC1, 0xFF, 0x02,
-    0xFD, 0x0B, 0xF4, 0x0F, 0xF0, 0x3F, 0xC0, 0x3F, 0x80, 0x55, 0x00, 0x54, 0x00, 0x7F, 0xC0, 0xBF,
-    0x81, 0xFF, 0x42, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x0B, 0xFC, 0x0F, 0xF4, 0x1F, 0xF0, 0x2F, 0xE0,
-    0x3F, 0xC0, 0x7F, 0xC0, 0xBF, 0x40, 0xFF, 0x00, 0xFE, 0x02, 0xFC, 0x01, 0x54, 0x01, 0x50, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xEB, 0xFA, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xC3, 0xEA, 0xFE, 0xAF, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x02, 0x95, 0xFD, 0x5A, 0x4F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x25, 0x4F, 0xD1,
-    0x64, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFD, 0x10, 0x0F, 0xC0, 0x10,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x50, 0x00, 0xBF, 0xF0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0xFF, 0xF7,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xD1, 0xFF, 0xFC, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF,
-    0xD0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0x80, 0x00,
-    0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF, 0x2F, 0xFC, 0x7F, 0xF0, 0xFF,
-    0x80, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x43, 0xFF, 0x40, 0x3F, 0xF0,
-    0xFF, 0xE0, 0x1F, 0xFD, 0x3F, 0xF4, 0x07, 0xFF, 0x4B, 0xFC, 0x00, 0xBF, 0xC0, 0x14, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x07, 0xF8, 0x3F, 0xF4,
-    0x0B, 0xFF, 0x00, 0xFF, 0xD3, 0xFF, 0x80, 0xBF, 0xF0, 0x0F, 0xFE, 0x3F, 0xF4, 0x0B, 0xFF, 0x00,
-    0xFF, 0xD2, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xFC, 0x01, 0x40, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x7F, 0x83, 0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0xBF, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xCB, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00,
-    0xD0, 0x00, 0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0xFF,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02, 0xFD, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x3F, 0xC2, 0xFD, 0x06, 0xA0, 0x00, 0x01, 0xA4, 0x02, 0xFD, 0x0F, 0xF0, 0xFF, 0x0F,
-    0xFF, 0x80, 0x07, 0xFF, 0xD0, 0x3F, 0xDB, 0xF8, 0xBF, 0x4F, 0xFF, 0xF8, 0x07, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFC, 0x3F, 0x8B, 0xFE, 0xFF, 0x03, 0xFE, 0xFF, 0xC0, 0xFF, 0xFD, 0x3F, 0xC3, 0xFC, 0x1F,
-    0xE1, 0xFF, 0x0F, 0xF0, 0x06, 0xE8, 0x1F, 0xE0, 0xFF, 0x03, 0xFC, 0x7F, 0x41, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x3F, 0x80, 0xFF, 0x2F, 0xD0, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x1F, 0xE0, 0x3F, 0xCB,
-    0xF4, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x0F, 0xF2, 0xFD, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0xFE, 0x03, 0xFC, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x1F, 0xE0,
-    0xBF, 0x40, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0xBF, 0x83, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x01,
-    0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0,
-    0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x40, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x41, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x02, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x0F, 0xF0, 0x7F, 0x41, 0xA9, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1A, 0x40, 0x0B, 0xF4, 0x3F, 0xC3,
-    0xFC, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x0B, 0xFF, 0xC0, 0x1F, 0xF7, 0xFE, 0x2F, 0xD3, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0xFF, 0x1F, 0xFB, 0xFD, 0x0B,
-    0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x4B, 0xF4, 0xFF, 0x47, 0xFC, 0x3F, 0xC2, 0xFD,
-    0x1F, 0xE0, 0xFF, 0x00, 0x1B, 0xA0, 0x3F, 0x83, 0xFC, 0x0F, 0xF1, 0xFE, 0x07, 0xF8, 0xBF, 0x42,
-    0xFD, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC7, 0xF8, 0x0F, 0xF3, 0xFC, 0x07, 0xF8, 0x00,
-    0x00, 0x1F, 0xE0, 0x3F, 0xC0, 0xBF, 0x5F, 0xE0, 0x3F, 0xCF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-    0x00, 0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x07, 0xF4, 0x03, 0xFC,
-    0x0F, 0xF1, 0xFE, 0x03, 0xFC, 0xBF, 0x42, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x3F, 0xC3,
-    0xFC, 0x1F, 0xE2, 0xFD, 0x0B, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xE1, 0xFE, 0x0F, 0xF0, 0xFF,
-    0x43, 0xFC, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF8,
-    0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x40, 0x3F, 0xE0, 0x7F, 0xC0, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x1F, 0xE0, 0x07, 0xF8, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF4, 0x01, 0xFC, 0x03, 0xF8, 0x00,
-    0xFE, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x42, 0xFE, 0x00,
-    0x3F, 0xE0, 0x7F, 0xC0, 0xFF, 0x00, 0x1F, 0xF0, 0x3F, 0xC0, 0xBF, 0x80, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x2F, 0xD0, 0x03, 0xFC, 0x07, 0xF4, 0x0F, 0xE0, 0x01, 0xFC,
-    0x03, 0xF8, 0x0B, 0xF0, 0x00, 0xFE, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x3E, 0x00, 0xBD, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0xD0, 0xBF, 0x80, 0x07, 0xFC, 0x0F,
-    0xF0, 0x00, 0xFF, 0x41, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0xFD, 0x03, 0xF8, 0x00, 0x3F,
-    0xC0, 0x7F, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x1F, 0x80,
-    0x3F, 0xD0, 0xBF, 0x80, 0xFF, 0x00, 0x07, 0xFC, 0x0F, 0xF0, 0x2F, 0xE0, 0x00, 0xFF, 0x41, 0xFE,
-    0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0x01, 0xFD, 0x03, 0xF8, 0x0B, 0xF0, 0x00,
-    0x3F, 0xC0, 0x7F, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0xFC,
-    0x03, 0xF8, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0xFC, 0xBC, 0x00, 0x7D, 0x0F, 0x80,
-    0x2F, 0x02, 0xF0, 0x0F, 0x80, 0x3E, 0x0B, 0xC0, 0x0B, 0xC3, 0xE0, 0x00, 0xF8, 0x00, 0x08, 0x00,
-    0x02, 0xF8, 0x00, 0xBF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0x3F, 0xF4, 0x0B, 0xFE,
-    0x00, 0x7F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
-    0x00, 0x1F, 0x40, 0x00, 0x40, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x80, 0x0F,
-    0xFD, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x2F, 0xF8, 0x07, 0xFF,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x07, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2F, 0xC0, 0x00, 0x40, 0x07, 0xC0, 0x03, 0xFE, 0x00, 0x2E,
-    0x01, 0xFF, 0x00, 0x7F, 0xE0, 0x0B, 0xF8, 0x0F, 0xFC, 0x03, 0xFD, 0x02, 0xFF, 0x40, 0x3F, 0xF0,
-    0x1F, 0x80, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xEF, 0xF4, 0x00, 0x02, 0xFC, 0x03, 0xFF, 0xFD, 0x03, 0xFC, 0x3F, 0xE0, 0x0F, 0xFF, 0x40,
-    0x7F, 0xE7, 0xFF, 0x00, 0xBF, 0xF0, 0x07, 0xFE, 0x3F, 0xE0, 0x2F, 0xFF, 0xC0, 0x3F, 0xD0, 0xA4,
-    0x0B, 0xFF, 0xFF, 0x01, 0xA4, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x02,
-    0xFF, 0x40, 0x50, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xC0, 0x3F, 0xF0, 0x1F, 0xF4, 0x07, 0xFE,
-    0x00, 0xFF, 0x80, 0xBD, 0x00, 0x7F, 0xE0, 0x03, 0xF0, 0x02, 0x40, 0x03, 0xFD, 0x00, 0x0C, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x0F, 0xFD, 0x02, 0xFF, 0xC3, 0xFF,
-    0x40, 0xBF, 0xF0, 0xFF, 0xD0, 0x1F, 0xFC, 0x3F, 0xF4, 0x07, 0xFF, 0x0F, 0xFD, 0x01, 0xFF, 0xC3,
-    0xFF, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x1F, 0xF8, 0x2F, 0xF0, 0x03, 0xFE, 0x0B, 0xFC, 0x00, 0xFF,
-    0x82, 0xFF, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x0F, 0xF4, 0x1F, 0xF0, 0x03, 0xFD, 0x07, 0xFC, 0x00,
-    0xFF, 0x41, 0xFF, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0F, 0xF0, 0x05, 0x40, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x0B, 0xF0, 0x3F, 0xF4, 0x0B, 0xFF, 0x0F,
-    0xFE, 0x02, 0xFF, 0xC3, 0xFF, 0x40, 0xBF, 0xF0, 0xBF, 0xC0, 0x0F, 0xF4, 0x01, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0x0F, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x07,
-    0xFC, 0x00, 0xFF, 0x0B, 0xFC, 0x00, 0xFF, 0x1F, 0xF4, 0x00, 0xFF, 0xBF, 0xF0, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x00, 0x0D, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x07,
-    0xD0, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0x41, 0x7F, 0xC0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00,
-    0x7C, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x0F, 0x7D, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x3D, 0x0F, 0x40, 0x0B, 0xC0, 0xBC, 0x00, 0xF8, 0x03,
-    0xD0, 0x2F, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x0F, 0xC0, 0x6C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF7, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBF,
-    0xF9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x1E, 0x01, 0xD0, 0x0A, 0xA0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x7E, 0x47, 0xE0, 0x6F, 0x00, 0x3E, 0x43, 0xF4, 0x6F, 0x6F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x07, 0xFB,
-    0xFC, 0x00, 0x0F, 0xF4, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0xC0, 0x0B, 0xFC, 0x2F, 0xF0, 0x00,
-    0x03, 0xFE, 0x0F, 0xF8, 0x01, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x07, 0x00,
-    0xA0, 0x00, 0x00, 0x01, 0x80, 0x34, 0x00, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF2, 0xFF, 0xA8, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xCB,
-    0xFF, 0xF2, 0xFF, 0xFC, 0xBF, 0xD5, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xFF, 0xF2, 0xFF, 0xFC, 0xBF,
-    0xFF, 0x05, 0x55, 0x40, 0x3F, 0xFF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xAB, 0xFE, 0x00, 0xBF, 0x80,
-    0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00,
-    0xBF, 0x8F, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE, 0x15, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02,
-    0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0xBF, 0x80, 0x2F, 0xE3, 0xFF,
-    0xF8, 0xFF, 0xFE, 0x3F, 0xFF, 0x85, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF8, 0xBD,
-    0x00, 0x7F, 0xF0, 0xF9, 0x00, 0xBF, 0xF0, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFD, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFD,
-    0x2F, 0x40, 0x1F, 0xFC, 0x0F, 0xFC, 0x04, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFC,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x0B, 0xFC,
-    0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8,
-    0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFD, 0x00, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFD, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x01, 0xBF, 0xFE, 0x40, 0x3F, 0xF4, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xF4, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF4, 0x2F, 0xFF, 0xFF, 0xFD, 0x3F, 0xF4, 0x0F, 0x90,
-    0x0F, 0xFE, 0x3F, 0xF4, 0x04, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x7F, 0xF8,
-    0x2F, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0x0F,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xE0,
-    0x00, 0x2F, 0xC0, 0x00, 0x05, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x7F,
-    0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x00, 0x01, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x56, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xEA, 0xFF, 0xFF, 0xF4, 0x7C, 0x0F, 0xFF,
-    0xFF, 0xC7, 0xC0, 0xFF, 0xFF, 0xFD, 0x7C, 0x0F, 0xFF, 0xFF, 0xE7, 0xC0, 0xFF, 0xFF, 0xFE, 0x7C,
-    0x0F, 0xFF, 0xFF, 0xE7, 0xC0, 0xFF, 0xFF, 0xFE, 0x7C, 0x0F, 0xFF, 0xFF, 0xE7, 0xC0, 0xFF, 0xFF,
-    0xFE, 0x7C, 0x0F, 0xFF, 0xFF, 0xD7, 0xC0, 0xFF, 0xFF, 0xFC, 0x7C, 0x0F, 0xFF, 0xFF, 0x87, 0xC0,
-    0xFF, 0xFF, 0xE0, 0x7C, 0x0F, 0xFF, 0xF4, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00,
-    0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F,
-    0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00,
-    0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF,
-    0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF, 0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF3,
-    0xFF, 0xFF, 0xF8, 0x2F, 0x3F, 0xFF, 0xFF, 0x82, 0xF3, 0xFF, 0xFF, 0xF8, 0x2F, 0x3F, 0xFF, 0xFF,
-    0x82, 0xF2, 0xFF, 0xFF, 0xF8, 0x2F, 0x0F, 0xFF, 0xFF, 0xEB, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x6A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3E, 0x0F, 0xFF, 0xFF, 0xD0,
-    0xF8, 0x3F, 0xFF, 0xFF, 0x83, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x83, 0xFF, 0xFF, 0xFC, 0x3E, 0x0F,
-    0xFF, 0xFF, 0xF0, 0xF8, 0x3F, 0xFF, 0xFF, 0xC3, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x83, 0xFF, 0xFF,
-    0xFC, 0x3E, 0x0F, 0xFF, 0xFF, 0xE0, 0xF8, 0x3F, 0xFF, 0xFF, 0x43, 0xFA, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0xAA, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x01, 0xD0, 0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFE, 0x07,
-    0xF8, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x2F, 0xF0, 0x3F,
-    0xF8, 0x3F, 0xF8, 0x3F, 0xF4, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x0B, 0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x01, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x0F,
-    0x80, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0D, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x01, 0xFE, 0x41, 0x7F, 0xC0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x01, 0xD0, 0x2F, 0x80, 0x68, 0x2F, 0xFA, 0xFA, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x15, 0xFF, 0xF5, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x2F, 0xF0, 0xFF, 0x80, 0x02, 0xFE, 0x07, 0xF8, 0x00, 0x02, 0xC0,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1D, 0x02, 0xF8,
-    0x06, 0x82, 0xFF, 0xAF, 0xAF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
-    0x5F, 0xFF, 0x54, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xF5, 0xFF,
-    0x00, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x2F, 0xE0, 0x7F, 0x80, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0xBF, 0xE0, 0x2F, 0xDF, 0xFE, 0x03,
-    0xFC, 0xBF, 0xE0, 0x7F, 0x83, 0xFC, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0x2F, 0xC1, 0xFE, 0x07, 0xFF,
-    0x3F, 0xC0, 0xBF, 0xF7, 0xF8, 0x0B, 0xFF, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0xBC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x90, 0x07, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x40,
-    0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x0B, 0x80, 0x00, 0x02, 0xF0, 0x1E,
-    0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x70, 0x3F, 0x0B, 0x00, 0x7F, 0x0F, 0xCB, 0xF0, 0x0F,
-    0xF7, 0xFB, 0xF8, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFB, 0xFF, 0xF0, 0x07, 0xF8, 0xFC, 0xFF, 0x00, 0xB8, 0x3F, 0x0F, 0x40, 0x04, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x03, 0xFE,
-    0x0F, 0xF8, 0x3F, 0xE0, 0xFF, 0x80, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x03,
-    0xFC, 0x0F, 0xF4, 0x3F, 0xD0, 0x07, 0xF8, 0x1F, 0xE0, 0x7F, 0x81, 0xFE, 0x00, 0x3F, 0xC0, 0xFF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x01, 0xFC, 0x07, 0xF4, 0x1F, 0xD0, 0x7F, 0x40, 0x0F, 0xE0, 0x3F, 0x80,
-    0xFE, 0x03, 0xF8, 0x00, 0x3E, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x83, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x7F, 0x83,
-    0xFF, 0x4F, 0xFE, 0x3F, 0xF4, 0x7F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0xFF, 0xD3, 0xFF, 0x8F, 0xFD, 0x1F, 0xF0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x02, 0x90, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x0F, 0xFE,
-    0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x0B, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x2F, 0xC0, 0x1F,
-    0x80, 0x01, 0xFF, 0x80, 0xBF, 0x00, 0xFF, 0xC0, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0x00, 0x2F,
-    0xFC, 0x0B, 0xF0, 0x1F, 0xFC, 0x00, 0x7F, 0xD0, 0x2F, 0xC0, 0x3F, 0xF0, 0x00, 0x29, 0x00, 0xBF,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2F, 0xC0, 0x05, 0x40, 0x01, 0xFF, 0x40,
-    0xBF, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x02, 0xFC, 0x07, 0xFF, 0x00, 0x2F, 0xFC, 0x0B, 0xF0, 0x1F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x2F, 0xC0, 0x7F, 0xF0, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x87, 0xFC,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8,
-    0xBF, 0xD0, 0x68, 0x00, 0x05, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x2F, 0xF0, 0x2A, 0x40, 0x00,
-    0x02, 0xE4, 0x3F, 0xF4, 0xFF, 0xE3, 0xFF, 0x8B, 0xFC, 0x01, 0x40, 0x00, 0x01, 0xFE, 0x0F, 0xFD,
-    0x3F, 0xF8, 0xFF, 0xD1, 0xFE, 0x00, 0x00, 0x01, 0x40, 0xBF, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF4,
-    0x2E, 0x40, 0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07,
-    0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0,
-    0x07, 0xD0, 0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0,
-    0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x00, 0x15, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC,
-    0x3F, 0xD3, 0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x3F,
-    0xC0, 0xFF, 0x3F, 0xC1, 0xFF, 0x3F, 0xD3, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x03, 0xFF,
-    0xE0, 0x00, 0x15, 0x00, 0x2D, 0x2F, 0xC7, 0xF0, 0x00, 0x29, 0x1F, 0xC7, 0xF1, 0xFC, 0x7F, 0x1F,
-    0xC7, 0xF1, 0xFC, 0x7F, 0x1F, 0xC7, 0xF0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02,
-    0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xF4, 0x00, 0xBD, 0xFD, 0x00, 0x7E, 0x7F, 0x40, 0x3F,
-    0x1F, 0xD0, 0x2F, 0x07, 0xF4, 0x1F, 0xD6, 0xFE, 0x4B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x6A,
-    0xAB, 0xFA, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xEA, 0xA4, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xF8, 0x19, 0x6F, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x90, 0x01, 0xFE, 0xB9, 0x6F, 0xF2,
-    0xFF, 0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xFC, 0x03, 0xFF,
-    0xFC, 0x0F, 0xFE, 0x54, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x9F, 0xF0, 0x3F, 0xFF, 0xFC,
-    0x7F, 0xE6, 0xFE, 0x3F, 0x40, 0xFF, 0x3F, 0x40, 0xFF, 0x3F, 0x80, 0xFF, 0x2F, 0xE6, 0xFE, 0x0F,
-    0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0,
-    0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFC, 0x2F, 0xD2, 0xFD, 0x2F, 0x80, 0xFD, 0x2F, 0xC1, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xF8, 0x3F, 0xD7, 0xFE, 0x3F, 0x40, 0xFF, 0x3F, 0x40, 0xBF, 0x3F, 0xD1, 0xFE, 0x2F,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x55, 0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xD0, 0x1F, 0xFF,
-    0xF8, 0x3F, 0xE7, 0xFC, 0x3F, 0x80, 0xFE, 0x7F, 0x40, 0xBF, 0x3F, 0x80, 0xFF, 0x3F, 0xD6, 0xFF,
-    0x2F, 0xFF, 0xFF, 0x07, 0xFC, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFC, 0x09, 0x6F, 0xF8, 0x0F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x05, 0x54, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x15, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x0F, 0xC2, 0xF4, 0x3F, 0x07, 0xE0, 0xBD, 0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD,
-    0x0B, 0xD0, 0x7E, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x0B, 0xD0, 0x15, 0x00, 0x07, 0xE0, 0x3F, 0x01,
-    0xF8, 0x0F, 0xC0, 0xBD, 0x07, 0xE0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x7E,
-    0x0B, 0xD0, 0xFC, 0x0F, 0xC2, 0xF4, 0x7E, 0x05, 0x40, 0x28, 0x1A, 0x90, 0x7D, 0xFF, 0xF8, 0x7F,
-    0xFB, 0xFC, 0x7F, 0x80, 0xFD, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00,
-    0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x15, 0x00, 0x54, 0x00, 0x15, 0x00,
-    0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC, 0x3F, 0xD3, 0xFE, 0x3F, 0xC1, 0xFE, 0x7F,
-    0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x7F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC1, 0xFF, 0x3F, 0xD3,
-    0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x3F, 0xF0, 0x7F, 0xFC, 0xBF, 0xFF, 0x1F, 0xEF, 0xC2, 0x87, 0xF0, 0x01, 0xFC, 0x00,
-    0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x2F, 0xEF, 0xFC, 0x0A, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x40, 0x03,
-    0xFD, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x0B, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0x9B, 0xFC, 0x04, 0x01, 0xFC,
-    0x00, 0x02, 0xFC, 0x00, 0x5B, 0xF4, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x00, 0x06, 0xFD, 0x00,
-    0x00, 0xFE, 0x10, 0x00, 0xFE, 0x3F, 0xAB, 0xFD, 0x3F, 0xFF, 0xFC, 0x2F, 0xFF, 0xE0, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xD0, 0x00, 0xFF,
-    0xF4, 0x00, 0xBD, 0xFD, 0x00, 0x7E, 0x7F, 0x40, 0x3F, 0x1F, 0xD0, 0x2F, 0x07, 0xF4, 0x1F, 0xD6,
-    0xFE, 0x4B, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x6A, 0xAB, 0xFA, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x0F, 0xEA, 0xA4,
-    0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xFF, 0xF4, 0x1F, 0xFF, 0xF8, 0x19, 0x6F, 0xF4, 0x00, 0x1F,
-    0xE0, 0x00, 0x3F, 0x90, 0x01, 0xFE, 0xB9, 0x6F, 0xF2, 0xFF, 0xFF, 0x87, 0xFF, 0xF4, 0x00, 0x54,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xFC, 0x0F, 0xFE, 0x54, 0x1F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x9F, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0xE6, 0xFE, 0x3F, 0x40, 0xFF, 0x3F,
-    0x40, 0xFF, 0x3F, 0x80, 0xFF, 0x2F, 0xE6, 0xFE, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFD,
-    0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x2F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x2F, 0xD2, 0xFD, 0x2F, 0x80, 0xFD,
-    0x2F, 0xC1, 0xFC, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x3F, 0xD7, 0xFE, 0x3F,
-    0x40, 0xFF, 0x3F, 0x40, 0xBF, 0x3F, 0xD1, 0xFE, 0x2F, 0xFF, 0xFC, 0x0B, 0xFF, 0xF0, 0x00, 0x55,
-    0x00, 0x00, 0x55, 0x00, 0x07, 0xFF, 0xD0, 0x1F, 0xFF, 0xF8, 0x3F, 0xE7, 0xFC, 0x3F, 0x80, 0xFE,
-    0x7F, 0x40, 0xBF, 0x3F, 0x80, 0xFF, 0x3F, 0xD6, 0xFF, 0x2F, 0xFF, 0xFF, 0x07, 0xFC, 0xFE, 0x00,
-    0x00, 0xFD, 0x00, 0x03, 0xFC, 0x09, 0x6F, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x05, 0x54,
-    0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC2, 0xF4, 0x3F, 0x07, 0xE0, 0xBD,
-    0x0B, 0xD0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFD, 0x0B, 0xD0, 0x7E, 0x03, 0xF0, 0x2F, 0x40,
-    0xFC, 0x0B, 0xD0, 0x15, 0x00, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0xBD, 0x07, 0xE0, 0x3F,
-    0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x7E, 0x0B, 0xD0, 0xFC, 0x0F, 0xC2, 0xF4, 0x7E,
-    0x05, 0x40, 0x01, 0xBF, 0xD0, 0x0B, 0xFF, 0xF8, 0x03, 0x96, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x5A,
-    0xFD, 0x0F, 0xFF, 0xFD, 0x3F, 0xD0, 0xFD, 0x3F, 0x40, 0xFD, 0x3F, 0x41, 0xFD, 0x3F, 0xFF, 0xFD,
-    0x0F, 0xFE, 0x3D, 0x01, 0x50, 0x00, 0x02, 0xFE, 0x40, 0x7F, 0xFF, 0x83, 0xF9, 0x7F, 0x6F, 0x80,
-    0x7E, 0xFE, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0x7F, 0x80, 0x00, 0x7F, 0x40, 0x10, 0xFF,
-    0xFF, 0xD0, 0xBF, 0xFF, 0x00, 0x15, 0x40, 0x02, 0xFE, 0x40, 0x1F, 0xFF, 0xF0, 0x3F, 0x97, 0xF8,
-    0xBF, 0x01, 0xFC, 0xFD, 0x00, 0xFD, 0xFD, 0x00, 0xFD, 0xFD, 0x00, 0xFD, 0xBE, 0x00, 0xFD, 0x7F,
-    0x42, 0xFC, 0x2F, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x00, 0x54, 0x00, 0x6A, 0x00, 0xAA, 0x0F, 0xF0,
-    0x7F, 0x40, 0xFD, 0x3F, 0x80, 0x1F, 0xEF, 0xC0, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x2F,
-    0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xE3, 0xF4, 0x0B, 0xF0, 0x7F, 0x07, 0xF0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x1E, 0x57, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xBF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0x00, 0xBE, 0x2F, 0x80, 0xFD, 0x0F, 0xFF, 0xF8,
-    0x03, 0xFF, 0xE0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x2F, 0xD0, 0x7F, 0xFF, 0xFC, 0x7F, 0xE7, 0xFD, 0x7F, 0x40, 0xFD, 0x7F, 0x00,
-    0xFE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE,
-    0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0xAA, 0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0xBF, 0x01, 0xFC, 0xBF, 0x00,
-    0x7F, 0xBF, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x01, 0xFD, 0x3F, 0x40, 0x7F, 0x07, 0xF4,
-    0x1F, 0xC0, 0xBF, 0x07, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
-    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x68, 0x2F, 0xD0, 0xBF, 0x81, 0xFB,
-    0xFF, 0xEF, 0xFF, 0xC7, 0xFE, 0xBF, 0xF9, 0xBF, 0x5F, 0xD0, 0x7F, 0x80, 0xFE, 0x7F, 0x00, 0xFD,
-    0x02, 0xF9, 0xFC, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x0F, 0xC0, 0x2F, 0x9F, 0xC0, 0x3F, 0x00, 0xBE,
-    0x7F, 0x00, 0xFC, 0x02, 0xF9, 0xFC, 0x03, 0xF0, 0x0B, 0xE7, 0xF0, 0x0F, 0xC0, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x2F, 0xE0, 0x7E, 0xFF, 0xFC, 0x7F, 0xE7, 0xFD, 0x7F, 0x40, 0xFD, 0x7F,
-    0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00,
-    0xBE, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x69, 0x2F, 0xD0, 0x7E, 0xFF, 0xF4, 0x7F, 0xEB, 0xFC,
-    0x7F, 0x40, 0xFD, 0x7F, 0x00, 0xFE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xFE, 0x7F,
-    0x82, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xBF, 0xE0, 0x7F, 0x05, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x06, 0xFF, 0x81, 0xFF, 0xFE, 0x3F, 0x96, 0xC3, 0xF4,
-    0x00, 0x2F, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0x20, 0x07, 0xF3, 0xFF, 0xFE,
-    0x3F, 0xFF, 0x80, 0x15, 0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x7D, 0x00, 0x7F, 0xE9, 0x7F, 0xFF,
-    0x9B, 0xFA, 0x90, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x80,
-    0x0B, 0xFF, 0x80, 0xFF, 0xE0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xBF,
-    0xF0, 0x05, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x2A,
-    0xAA, 0xA1, 0xFF, 0x41, 0xFF, 0xFF, 0xD7, 0xFD, 0x07, 0xFF, 0xFF, 0x4F, 0xF4, 0x1F, 0xFF, 0xFD,
-    0x3F, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x01, 0xFF, 0xEB, 0xFD, 0x55, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFD,
-    0x55, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x05, 0x01, 0x40, 0x00, 0x00, 0x3D, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0xBC, 0x00, 0x00, 0x6F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0x0B, 0xF8, 0x2F, 0xFD, 0xBC, 0x3E, 0x00, 0xFF, 0xD3, 0xE0, 0xF4, 0x07, 0xFF, 0x0F,
-    0x43, 0xC0, 0x2F, 0xF4, 0x3C, 0x1F, 0x00, 0xFF, 0xD1, 0xF0, 0xBC, 0x03, 0xFF, 0x0B, 0xC3, 0xE0,
-    0x0F, 0xFC, 0x3E, 0x0F, 0x40, 0x3F, 0xF0, 0xF4, 0x3C, 0x00, 0xBF, 0xD3, 0xC1, 0xF0, 0x02, 0xFF,
-    0x9F, 0x0B, 0xC0, 0x07, 0xFF, 0xBC, 0x3E, 0x00, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x1F, 0xFF, 0x83,
-    0xC1, 0x90, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x7D, 0x00, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x00, 0x1F,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xF8, 0x01, 0xB0, 0x1F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x29, 0x0A, 0x8B, 0xFD, 0x07, 0xF3, 0xFC, 0xFF, 0xC0, 0x7F, 0xBF, 0xCF, 0xFC, 0x07,
-    0xFF, 0xFC, 0xFF, 0xD0, 0x7F, 0xF9, 0x4B, 0xFD, 0x07, 0xFE, 0x00, 0xBF, 0xE0, 0x7F, 0xC0, 0x07,
-    0xFF, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xC0, 0x03, 0xFF, 0xC7, 0xFC, 0x00, 0x1F, 0xFE, 0xBF,
-    0xC1, 0x40, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x55, 0x55, 0x40, 0x3F,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x06, 0xBF, 0xFA,
-    0xA8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFC, 0x01, 0x90, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x05, 0x7F, 0xF9, 0x55,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x6B, 0xFF, 0xEA, 0xA0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0xBF, 0x69, 0x00, 0x2F, 0xE1, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8,
-    0x0B, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF,
-    0xFF, 0xAF, 0xFF, 0xFE, 0x6F, 0xFF, 0x2F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xCB, 0xFF, 0x00,
-    0x1F, 0xFD, 0x00, 0x3F, 0xF2, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xFC, 0x00,
-    0x3F, 0xF2, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
-    0x2F, 0xF4, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF2, 0xFF,
-    0x40, 0xBF, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0x2F, 0xF4, 0x2F,
-    0xFF, 0xF0, 0x00, 0xFF, 0xCB, 0xFD, 0x0F, 0xEF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0x80, 0x2F, 0xFC,
-    0x00, 0xFF, 0x00, 0xBF, 0xF0, 0x03, 0xFC, 0x02, 0xFF, 0xE0, 0x0F, 0xF0, 0x0B, 0xFF, 0xC0, 0x3F,
-    0xC0, 0x2F, 0xBF, 0x00, 0xFF, 0x00, 0xBE, 0xBD, 0x03, 0xFC, 0x02, 0xFD, 0xFC, 0x0F, 0xF0, 0x6F,
-    0xFB, 0xFA, 0xBF, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0x82, 0xFC, 0x7F,
-    0x0F, 0xF0, 0x0B, 0xF0, 0xFD, 0x3F, 0xC1, 0xBF, 0xEB, 0xFE, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0B, 0xF0, 0x2F, 0x6F, 0xC0, 0x2F, 0xC0, 0x7E, 0xBF, 0x00, 0xBF,
-    0x00, 0xFE, 0xFC, 0x02, 0xFC, 0x03, 0xFF, 0xF0, 0x0B, 0xF0, 0x0B, 0xFF, 0xC0, 0x2F, 0xC0, 0x0F,
-    0xFF, 0x00, 0xBF, 0x00, 0x3F, 0xFC, 0x02, 0xFC, 0x00, 0xBF, 0xF0, 0x7F, 0xFF, 0xA4, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE5, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x3F,
-    0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x2A, 0x00, 0x1F, 0xF4, 0x01, 0xFF, 0x80, 0xFC,
-    0x00, 0x7F, 0xD0, 0x07, 0xFD, 0x0B, 0xF0, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x3F, 0xC0, 0x07, 0xFD,
-    0x01, 0xFF, 0xC2, 0xFF, 0xFF, 0x1F, 0xFA, 0xBF, 0xFE, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x4A, 0xFF, 0xEA, 0x87, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x00,
-    0x1F, 0xFA, 0x94, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x1F, 0xFD, 0x65, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0xD7,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xD5, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x69, 0x40, 0xBF, 0xC0,
-    0x2F, 0xF4, 0x0F, 0xFF, 0xF8, 0xBF, 0xC0, 0x1F, 0xF4, 0x3F, 0xFF, 0xFC, 0xBF, 0xC0, 0x2F, 0xF0,
-    0xBF, 0xFF, 0xF8, 0xBF, 0xC0, 0x3F, 0xF0, 0xFF, 0xC1, 0xB4, 0xBF, 0xD1, 0xFF, 0xE0, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0xF4, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xE0, 0xBF, 0xC3, 0xFF,
-    0x00, 0x03, 0xFF, 0xF8, 0xBF, 0xC2, 0xFF, 0x40, 0x00, 0x7F, 0xFC, 0xBF, 0xC0, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFD, 0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFD, 0xBF, 0xC0, 0x7F, 0xE0, 0x40, 0x03, 0xFD,
-    0xBF, 0xC0, 0x3F, 0xF0, 0xF9, 0x1B, 0xFC, 0xBF, 0xC0, 0x2F, 0xF8, 0xFF, 0xFF, 0xFC, 0xBF, 0xC0,
-    0x0F, 0xFC, 0xFF, 0xFF, 0xF0, 0xBF, 0xC0, 0x0B, 0xFE, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x00, 0xFE, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x83,
-    0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xF4, 0x2F, 0xC0, 0x2F, 0xFC,
-    0x02, 0xFC, 0x0B, 0xF4, 0x0B, 0xEF, 0x40, 0xFF, 0x01, 0xFD, 0x03, 0xF7, 0xD0, 0x3F, 0xC0, 0x3F,
-    0x80, 0xFD, 0xF8, 0x0F, 0xE0, 0x0F, 0xE0, 0x3E, 0x3F, 0x03, 0xF8, 0x03, 0xFC, 0x1F, 0x8F, 0xC1,
-    0xFD, 0x00, 0xFF, 0x0B, 0xE3, 0xF4, 0xBF, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0xFE, 0x7F, 0x5B, 0xF7, 0xFD, 0x40, 0x3F, 0x4F, 0xC1, 0xFC, 0xFE,
-    0x00, 0x0F, 0xE7, 0xF0, 0x3F, 0x3F, 0x40, 0x02, 0xFA, 0xF8, 0x0F, 0xDF, 0xD0, 0x00, 0xBF, 0xBD,
-    0x03, 0xFB, 0xF0, 0x00, 0x1F, 0xFF, 0x40, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x2F, 0xFE, 0x00,
-    0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x1F, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x02, 0xFF, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x2F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x42, 0xFF,
-    0x3F, 0xC0, 0xAA, 0x0F, 0xF8, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0xBF, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF,
-    0x07, 0xFC, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F,
-    0xF3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xF3, 0xFC, 0x1F,
-    0xF0, 0x7F, 0xC2, 0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xF3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC2,
-    0xFF, 0x3F, 0xC1, 0xFF, 0x07, 0xFC, 0x2F, 0xE3, 0xFC, 0x1F, 0xF0, 0x7F, 0xC3, 0xFE, 0x3F, 0xC1,
-    0xFF, 0x00, 0x00, 0x7F, 0xD3, 0xFC, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0x3F, 0xC1, 0xFF, 0xAA, 0xAF,
-    0xFF, 0x83, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x1A, 0xAB, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x05, 0x50, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0x1F, 0xF8, 0x00, 0x7F, 0xFF, 0xF7, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xAB, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF,
-    0x80, 0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x1F, 0xFC,
-    0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF8,
-    0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x40, 0x7F, 0xF8, 0x02, 0xFF, 0xFE, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFE, 0x3F, 0xE0, 0x00, 0x2F, 0xFD, 0x0B, 0xF8, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x6F,
-    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xE4, 0x07, 0x40, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x5F, 0xFE, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x05, 0xFF,
-    0xD5, 0x55, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xEA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x18, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0B, 0xFD,
-    0x00, 0x1F, 0xF8, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x0B, 0xFD, 0x0F, 0xFC,
-    0x00, 0x0B, 0xFD, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0xBF, 0xC0, 0x00,
-    0x1F, 0xFE, 0xFF, 0xD5, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0x7F, 0xE0, 0x00, 0x0B, 0xFD, 0x2F, 0xF0, 0x00, 0x0B, 0xFD,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x02,
-    0xFF, 0x80, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0xBF, 0xE0, 0x0B, 0xFD, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFD, 0x00, 0x2F, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x57, 0xFF, 0x55, 0x50, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xE0, 0x00, 0x00, 0xFF, 0xEF, 0xC0, 0x00, 0x03, 0xFF, 0xFC,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0x1E, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x7F, 0xFF, 0xC0, 0x00, 0x20, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x02, 0xF7, 0xFF, 0x00, 0x00, 0x02, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x03, 0x90, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x2F, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x1F,
-    0xFC, 0x3F, 0xFB, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x1F, 0xF0, 0x2F, 0xD0, 0xFF, 0xC0, 0x0B,
-    0xFF, 0x0F, 0xF4, 0x03, 0xF8, 0x3F, 0xF0, 0x0B, 0xFF, 0x43, 0xFC, 0x00, 0xFE, 0x0F, 0xF8, 0x2F,
-    0xFF, 0x81, 0xFF, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xC2, 0xFF, 0xFF,
-    0xFF, 0x80, 0x3F, 0xFE, 0xBF, 0xE0, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xE4, 0x00, 0x03, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xBF,
-    0xF0, 0x00, 0x2F, 0xF4, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x03, 0xFF, 0x03, 0xFD, 0x00,
-    0x0B, 0xFC, 0x0F, 0xF0, 0x00, 0x2F, 0xF4, 0x7F, 0xC0, 0x00, 0x7F, 0xF2, 0xFF, 0x00, 0x00, 0xFF,
-    0xDF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x70, 0x1F, 0xFC, 0x00, 0x03, 0xD0, 0x7F, 0xF8, 0x00, 0x1F,
-    0xC3, 0xFF, 0xF0, 0x00, 0xFF, 0x6F, 0xFF, 0xE0, 0x0B, 0xFF, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xE3,
-    0xFF, 0x42, 0xFD, 0xFF, 0x07, 0xFE, 0x0F, 0xC2, 0xF4, 0x0F, 0xFC, 0xBE, 0x03, 0xC0, 0x3F, 0xF0,
-    0x00, 0x04, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x0B, 0xFF, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0x03, 0xFF, 0x81, 0xBF, 0xFA,
-    0xAB, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xEA, 0xBF, 0xFE, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFD, 0x56, 0xFF, 0x90, 0x3F, 0xF0, 0x1F, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFA, 0x94, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x1B, 0xC0, 0x2F, 0xFF, 0x1F,
-    0x80, 0x00, 0x0F, 0xFF, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0x01, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x7E,
-    0x00, 0x00, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0xF4, 0x07, 0xE5, 0x55, 0x0F, 0xFC, 0x01, 0xFF,
-    0xFF, 0xD3, 0xFF, 0x00, 0x7F, 0xFF, 0xF4, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x3F, 0xF4, 0x07, 0xFF,
-    0xFF, 0x4F, 0xFE, 0x01, 0xF8, 0x7F, 0xD2, 0xFF, 0xC0, 0x7E, 0x1F, 0xF4, 0x7F, 0xF4, 0x1F, 0x87,
-    0xFD, 0x0F, 0xFF, 0x07, 0xE1, 0xFF, 0x41, 0xFF, 0xF5, 0xF8, 0xBF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xBF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF6, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xAF, 0xFE,
-    0xAB, 0xFF, 0xA8, 0x00, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x5B, 0xFE, 0x55, 0x5F, 0xFE, 0x40, 0xFF,
-    0xC0, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xCF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0xBF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xD4, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC1,
-    0xAA, 0xAA, 0xAB, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x06, 0xBF, 0xFF, 0xFA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xC0, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xEB, 0xE7, 0xF0, 0x0B, 0xFF, 0x47, 0xE0, 0x10, 0x0F, 0xFE, 0x07, 0xE0, 0x00, 0x1F, 0xFC,
-    0x07, 0xE0, 0x00, 0x2F, 0xF8, 0x07, 0xE0, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0xF4, 0x07,
-    0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0xF0, 0x07, 0xE0,
-    0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00, 0x3F, 0xF8, 0x07, 0xE0, 0x00, 0x2F, 0xFC, 0x07, 0xE0, 0x00,
-    0x1F, 0xFC, 0x07, 0xE0, 0x00, 0x0F, 0xFF, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xD7, 0xE1, 0xB0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x06,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x2B, 0xFF, 0xAA, 0xFF, 0xEA, 0xA0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xFE, 0xBC, 0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x0A, 0x42, 0xA4, 0x6A, 0x0F, 0xFC, 0x3F, 0xEF, 0xFE, 0xFF, 0xC7, 0xFC, 0x7A, 0xFD,
-    0x7F, 0x8B, 0xC7, 0xFC, 0x39, 0xF4, 0x2F, 0x03, 0xD7, 0xF8, 0x2F, 0xF4, 0x2F, 0x03, 0xEF, 0xF4,
-    0x0B, 0xFF, 0xBF, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFA, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0xF4, 0x2F, 0x57, 0xD0, 0x00, 0x00, 0xF4, 0x2F, 0x03, 0xD0, 0x00, 0x00, 0xA0,
-    0x19, 0x02, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xAA, 0xFF,
-    0xFA, 0xA8, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x55, 0x5B, 0xFE, 0x54, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x4B, 0xD0,
-    0x02, 0x4B, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x0A, 0xA3, 0xFF, 0xFD, 0x00, 0x7F, 0xC9, 0x2F, 0xF4, 0x01, 0xFF, 0x00, 0xBF, 0xD0,
-    0x0B, 0xFC, 0x02, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFD, 0x01, 0xFF, 0x40, 0x2F, 0xF4, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xBF, 0xAA, 0xAA, 0xA5, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03,
-    0xF0, 0x04, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0xC1, 0xF4, 0x78, 0x03, 0xD0, 0x00, 0x3F, 0x2F, 0xFB,
-    0xF8, 0x0F, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFD, 0xFC, 0x00, 0x03, 0xFF, 0x07, 0xF6, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF0, 0x07, 0x01, 0xB8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xBF, 0xE4, 0x01, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xD0, 0xBF, 0xC0, 0xBF, 0xF0, 0x1F, 0xFC,
-    0x02, 0xFF, 0x00, 0xBF, 0xE0, 0xBF, 0xC0, 0x0B, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xF0,
-    0x02, 0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xF5,
-    0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x7F, 0xD7, 0xFD, 0x00, 0x05, 0x50, 0x01, 0xFF, 0x5F, 0xF4, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x7F, 0xD7, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x5F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x03,
-    0xFF, 0xFF, 0xA4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x55, 0xBF, 0xFC, 0x03, 0xFF, 0x00, 0x1F, 0xFD, 0x03, 0xFF, 0x00,
-    0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x2F,
-    0xFC, 0x6B, 0xFF, 0xAA, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x6B, 0xFF, 0xAA, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x57, 0xFF, 0x55, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3D,
-    0x3E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xD0, 0x0B, 0xFF, 0x7D, 0x3E, 0xBF, 0xF0, 0x0F, 0xFC, 0x3D, 0x3E, 0x3F, 0xF8, 0x2F, 0xF8, 0x3D,
-    0x3E, 0x1F, 0xFC, 0x3F, 0xF4, 0x3D, 0x3E, 0x0F, 0xFC, 0x3F, 0xF0, 0x3D, 0x3E, 0x0F, 0xFD, 0x3F,
-    0xF0, 0x3D, 0x3E, 0x0B, 0xFD, 0x3F, 0xF0, 0x3D, 0x3E, 0x0B, 0xFE, 0x3F, 0xF0, 0x14, 0x14, 0x01,
-    0x54, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x2E, 0x0F, 0x00, 0x00, 0xB8,
-    0x3C, 0x00, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xD6, 0xFF, 0xF3, 0xFF, 0x00, 0xFF, 0xDF, 0xFC, 0x03, 0xFF, 0x7F, 0xF0, 0x0F, 0xFD,
-    0xFF, 0xC0, 0x3F, 0xF3, 0xFF, 0x57, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xAB, 0xFF, 0xCF, 0xFC, 0x03, 0xFF, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x2F, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xF3, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x0B, 0x83, 0xC0, 0x00, 0x2E, 0x0F, 0x00, 0x00, 0x10, 0x14, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00,
-    0x7F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xAB, 0xF0, 0x3F,
-    0xFC, 0x00, 0x10, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x28, 0x1F, 0xFF, 0xEF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x2A,
-    0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x06,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xF4, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_boldBitmaps[51111] = {
+    0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC1, 0xFC, 0x1A,
+    0xF1, 0xAF, 0x1A, 0xF1, 0xAF, 0x19, 0xF1, 0x9F, 0x19, 0xF1, 0x9E, 0xA2, 0x99, 0x97, 0x70, 0x9E,
+    0xA1, 0xFC, 0x90, 0xFC, 0xA0, 0xFC, 0x90, 0xAF, 0x39, 0x91, 0xFA, 0x1A, 0xEA, 0xFA, 0x1F, 0xFC,
+    0xA1, 0xAE, 0xAA, 0xEA, 0x1A, 0xEA, 0xAE, 0xA1, 0xAE, 0xAA, 0xE9, 0x19, 0xE9, 0x9E, 0x91, 0x9E,
+    0x99, 0xE9, 0x19, 0xE9, 0x9E, 0x3E, 0x00, 0x7E, 0x91, 0x9E, 0x71, 0x9E, 0x2A, 0xE7, 0x1A, 0xE2,
+    0xEA, 0x71, 0xF2, 0xEA, 0x71, 0xEA, 0x2E, 0x97, 0x1E, 0x91, 0x9E, 0x71, 0x9E, 0x91, 0xAE, 0x5F,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x19, 0x99, 0x9E, 0xA9, 0x9A, 0xE9, 0x99, 0x95,
+    0x9E, 0x91, 0xAE, 0x71, 0x9E, 0x2A, 0xE7, 0x1A, 0xE2, 0xEA, 0x49, 0xFF, 0xFF, 0xDA, 0x09, 0xFF,
+    0xFF, 0xDA, 0x09, 0xFF, 0xFF, 0xDA, 0x19, 0x99, 0xAE, 0x99, 0x9F, 0x99, 0x99, 0x94, 0xAE, 0x2E,
+    0xA7, 0x1E, 0xA2, 0xE9, 0x71, 0xEA, 0x19, 0xE9, 0x71, 0xE9, 0x19, 0xE7, 0x19, 0xE2, 0xAE, 0x71,
+    0xAE, 0x2E, 0xA6, 0x79, 0x76, 0xAC, 0xA7, 0x5A, 0xCA, 0x73, 0x9A, 0xFA, 0xA9, 0x5A, 0xFF, 0xEA,
+    0x2F, 0xFF, 0xD1, 0xFF, 0xFD, 0xA0, 0x9F, 0xC9, 0xAC, 0xA9, 0x9A, 0xD1, 0xAF, 0x90, 0xAC, 0xA3,
+    0x91, 0xAF, 0x90, 0xAC, 0xA6, 0x9F, 0xC9, 0xAC, 0xA7, 0xFF, 0xA7, 0x9F, 0xFA, 0x96, 0x9F, 0xFD,
+    0x96, 0xAF, 0xFC, 0xA7, 0x9F, 0xFC, 0x7A, 0xFF, 0x96, 0xAC, 0xA0, 0xFC, 0xA6, 0xAC, 0xA1, 0xFC,
+    0x9A, 0x4A, 0xCA, 0x09, 0xFA, 0xAE, 0xA9, 0x9A, 0xDA, 0xFC, 0x9A, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD,
+    0x2A, 0xFF, 0xEA, 0x69, 0xAA, 0xE9, 0x97, 0x3A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x60, 0x77,
+    0x77, 0xFC, 0x97, 0x0A, 0xE9, 0x69, 0xFE, 0x97, 0xF7, 0xFF, 0xC6, 0xAE, 0x96, 0x9F, 0x0A, 0xEA,
+    0x5E, 0xA7, 0xAE, 0x91, 0xF4, 0xF7, 0x0F, 0x2A, 0xE3, 0x9E, 0xA7, 0x0F, 0x2A, 0xE9, 0x2F, 0x71,
+    0xF2, 0xAE, 0x91, 0x9E, 0xA7, 0x1F, 0x2A, 0xE9, 0x1F, 0x72, 0xF2, 0xF1, 0xAE, 0x91, 0x9A, 0xAA,
+    0x4A, 0xE9, 0x1F, 0x1F, 0x1F, 0xDA, 0x3F, 0x9A, 0xEA, 0x0A, 0xE9, 0x0F, 0xFA, 0x2A, 0xFF, 0x1E,
+    0xA0, 0xAF, 0xAF, 0x3F, 0xE9, 0x0F, 0x1F, 0x19, 0xEA, 0x39, 0xAC, 0xAA, 0x19, 0xEA, 0x1F, 0x2F,
+    0x72, 0xF2, 0xEA, 0x2F, 0x71, 0x9E, 0xA1, 0x9E, 0xA2, 0xF7, 0x1F, 0x3E, 0xA2, 0xF7, 0x0A, 0xE9,
+    0x3E, 0xA2, 0xF7, 0x0F, 0x4F, 0x2F, 0x7A, 0xE9, 0x4A, 0xE9, 0x0A, 0xEA, 0x7E, 0xA5, 0x9F, 0xFC,
+    0x7F, 0x7A, 0xFE, 0x96, 0x9E, 0xA7, 0x09, 0xFC, 0x97, 0x77, 0x09, 0x50, 0x77, 0x74, 0x9A, 0xFC,
+    0xA7, 0x6F, 0xFD, 0x97, 0x3F, 0xFF, 0x97, 0x19, 0xFD, 0xAF, 0xD7, 0x1A, 0xF9, 0x2F, 0xC7, 0x1A,
+    0xF3, 0xAF, 0x71, 0xAF, 0x3F, 0xC7, 0x19, 0xFA, 0x1A, 0xFA, 0x72, 0xFC, 0x9A, 0xFC, 0x73, 0x9F,
+    0xFD, 0x75, 0xAF, 0xF7, 0x59, 0xFE, 0xA5, 0xFA, 0x2A, 0xFF, 0xC4, 0xAF, 0xA1, 0x9F, 0xFE, 0x3F,
+    0xC9, 0x1F, 0xCA, 0x0A, 0xFC, 0x19, 0xFC, 0x19, 0xFC, 0x2A, 0xFC, 0x9F, 0xC9, 0x1A, 0xFA, 0x3A,
+    0xFF, 0xD2, 0xAF, 0xA4, 0xAF, 0xF9, 0x2A, 0xFC, 0x5A, 0xFD, 0xA3, 0x9F, 0xD4, 0xAF, 0xD9, 0x4F,
+    0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0xFE, 0x93, 0x9F, 0xFF, 0x9A, 0xFC, 0x94, 0xAF, 0xF9, 0x2A, 0xFC,
+    0x97, 0x99, 0x75, 0xFA, 0xFA, 0xFA, 0xAE, 0xAA, 0xEA, 0xAE, 0x99, 0xE9, 0x9E, 0x99, 0xE0, 0x4F,
+    0x4A, 0xE9, 0x39, 0xF4, 0xF9, 0x39, 0xF4, 0xF9, 0x39, 0xF4, 0xAE, 0xA4, 0xF9, 0x4F, 0x49, 0xF4,
+    0x9F, 0x4A, 0xF4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAF, 0x49, 0xF4, 0x9F, 0x5F,
+    0x94, 0xFA, 0x4A, 0xF5, 0xF5, 0xFA, 0x49, 0xF5, 0xAE, 0xA5, 0xF5, 0x9E, 0xA6, 0x99, 0x90, 0xAE,
+    0x94, 0xF4, 0xAE, 0xA4, 0xF9, 0x3A, 0xF4, 0xF4, 0xFA, 0x39, 0xF4, 0xF4, 0xF9, 0x3F, 0xA3, 0xAF,
+    0x39, 0xF3, 0x9F, 0x39, 0xF3, 0x9F, 0x39, 0xF3, 0xAF, 0x3A, 0xEA, 0x3F, 0xA3, 0xF9, 0x29, 0xF3,
+    0xAF, 0x3F, 0x92, 0x9F, 0x3F, 0xA2, 0x9F, 0x3F, 0x92, 0x9E, 0xA4, 0x99, 0x94, 0x69, 0x99, 0x97,
+    0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xAD, 0xA7, 0x9C, 0x92, 0xAD, 0xA2, 0x9A, 0xA1, 0xAF, 0xAA, 0xDA,
+    0xAF, 0xA1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF3, 0x99, 0x9F, 0xD9, 0x99, 0x79, 0xFD, 0x97, 0x1F, 0xF7,
+    0x0F, 0x99, 0xF6, 0xAF, 0x1F, 0xA5, 0xAE, 0xA1, 0x9E, 0xA7, 0xAC, 0x3C, 0xA7, 0x76, 0x6E, 0x97,
+    0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x59, 0xAA, 0xAA, 0xAA,
+    0xEA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x59, 0xE9, 0x73,
+    0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x49, 0x99, 0x60, 0x09,
+    0xF9, 0x0A, 0xF1, 0xAF, 0x1F, 0xA1, 0xF1, 0x9F, 0x1A, 0xE9, 0x1F, 0x29, 0x99, 0x30, 0x0F, 0xFA,
+    0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x71, 0x79, 0xEA, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F, 0xC9, 0x0A,
+    0xF3, 0x99, 0x10, 0x70, 0xF9, 0x79, 0xF7, 0x0F, 0xC7, 0x0F, 0x97, 0xAF, 0x70, 0xFA, 0x79, 0xF9,
+    0x7A, 0xF7, 0x0F, 0xA7, 0x9F, 0x70, 0xFC, 0x70, 0xF9, 0x79, 0xF7, 0x0F, 0xA7, 0x0F, 0x97, 0xAF,
+    0x70, 0xFA, 0x79, 0xF9, 0x7A, 0xF7, 0x0F, 0xA7, 0x9F, 0x70, 0xFC, 0x70, 0xF9, 0x7A, 0xF7, 0x76,
+    0x77, 0x49, 0xAF, 0xCA, 0x7A, 0xFF, 0xC9, 0x4A, 0xFF, 0xE9, 0x3F, 0xFF, 0xC2, 0xAF, 0xC2, 0xFC,
+    0xA1, 0xFC, 0x4F, 0xC0, 0x9F, 0xA4, 0xAF, 0x09, 0xFA, 0x4A, 0xF9, 0xAF, 0x94, 0x9F, 0xAA, 0xF9,
+    0x49, 0xFA, 0xFC, 0x6F, 0xFD, 0x6F, 0xFD, 0x6F, 0xFD, 0x6F, 0xCA, 0xF9, 0x49, 0xFA, 0xAF, 0x94,
+    0x9F, 0xA9, 0xF9, 0x49, 0xFA, 0x0F, 0xA4, 0xAF, 0x90, 0xFC, 0x4F, 0xC1, 0xAF, 0xA2, 0xAF, 0xA2,
+    0xFF, 0xFC, 0x92, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA6, 0x9F, 0xE9, 0x72, 0x99, 0x96, 0x7A, 0xEA,
+    0x6F, 0xD4, 0x9F, 0xE3, 0xAF, 0xF2, 0xAF, 0xFC, 0x1F, 0xFE, 0x0F, 0xD9, 0xFC, 0x1E, 0xA1, 0xFC,
+    0x19, 0xC9, 0x2F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6,
+    0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6, 0x9F, 0xC6,
+    0x9F, 0xC0, 0x77, 0x49, 0xAF, 0xD9, 0x59, 0xFF, 0xE3, 0xAF, 0xFF, 0xC1, 0x9F, 0xFF, 0xDA, 0x1A,
+    0xF9, 0x2F, 0xD2, 0xD9, 0x5F, 0xC7, 0x3A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2F,
+    0xC7, 0x2F, 0xCA, 0x71, 0xFD, 0x71, 0xAF, 0xC7, 0x1A, 0xFC, 0x71, 0xAF, 0xC7, 0x1A, 0xFC, 0x71,
+    0xAF, 0xA7, 0x1A, 0xFA, 0x71, 0xAF, 0xC7, 0x1A, 0xFF, 0xFF, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF,
+    0xFF, 0xF0, 0x77, 0x39, 0xAF, 0xDA, 0x94, 0xAF, 0xFF, 0x29, 0xFF, 0xFD, 0x2F, 0xFF, 0xDA, 0x2D,
+    0xA9, 0x3F, 0xD2, 0x97, 0xFC, 0x73, 0xFC, 0x73, 0xFA, 0x72, 0xAF, 0x97, 0x99, 0xFC, 0x95, 0xFF,
+    0xC9, 0x6F, 0xEA, 0x70, 0xFF, 0xD9, 0x5A, 0xAA, 0xFF, 0x97, 0x2A, 0xFC, 0x73, 0xFC, 0xA7, 0x2A,
+    0xFA, 0x72, 0xAF, 0xA7, 0x2F, 0xCA, 0xAA, 0x96, 0xAF, 0xC9, 0xAF, 0xAA, 0xAF, 0xF0, 0xAF, 0xFF,
+    0xD1, 0xAF, 0xFF, 0xC3, 0x9F, 0xFD, 0x97, 0x09, 0x99, 0x97, 0x72, 0xFA, 0x74, 0xFC, 0xA7, 0x3A,
+    0xFC, 0xA7, 0x3F, 0xDA, 0x72, 0xFE, 0xA7, 0x1A, 0xFE, 0xA7, 0x09, 0xEA, 0xFA, 0x70, 0xF9, 0xFA,
+    0x7A, 0xE9, 0x0F, 0xA6, 0x9E, 0xA1, 0xFA, 0x6F, 0x19, 0xFA, 0x5A, 0xE9, 0x19, 0xFA, 0x49, 0xF2,
+    0x9F, 0xA4, 0xF3, 0x9F, 0xA3, 0xAE, 0x93, 0x9F, 0xA2, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xCA,
+    0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x71, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49,
+    0xFA, 0x74, 0x9F, 0xA2, 0x1F, 0xFF, 0xA3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x29, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x29, 0xF9, 0x72, 0x9F, 0x73, 0xAF, 0x73, 0xAF, 0x73, 0xAF, 0xFD, 0xA4,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xAF, 0xFF, 0xD3, 0x94, 0x9F, 0xD7, 0x3F, 0xC9, 0x72, 0xAF, 0xA7,
+    0x2A, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC0, 0x9C, 0xA9, 0x5F, 0xD0, 0x9F, 0xFF, 0xD9, 0x09, 0xFF,
+    0xFC, 0xA1, 0x9F, 0xFF, 0xA3, 0x9F, 0xFC, 0xA7, 0x19, 0x99, 0x97, 0x77, 0x79, 0xAF, 0xD9, 0x5A,
+    0xFF, 0xC9, 0x4F, 0xFE, 0x93, 0xFF, 0xF9, 0x2A, 0xFC, 0xA7, 0x1F, 0xC7, 0x2A, 0xF7, 0x3F, 0xA7,
+    0x29, 0xF2, 0x99, 0x99, 0x49, 0xF0, 0x9F, 0xDA, 0x2A, 0xF9, 0xFF, 0xC1, 0xAF, 0xFF, 0xE0, 0xFE,
+    0xA9, 0x9F, 0xD9, 0xFD, 0x4A, 0xFA, 0xFC, 0x95, 0xFF, 0xD6, 0xFC, 0xAF, 0x6F, 0xC9, 0xF9, 0x5F,
+    0xC0, 0xFC, 0x49, 0xFA, 0x0F, 0xCA, 0x3F, 0xC9, 0x09, 0xFD, 0xAF, 0xE2, 0xAF, 0xFF, 0x93, 0xAF,
+    0xFD, 0x96, 0xAF, 0xDA, 0x73, 0x99, 0x60, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xFC, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x97, 0x3F, 0xC7, 0x39, 0xFA, 0x73,
+    0xFC, 0x74, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x3A, 0xF9, 0x73, 0xFC, 0x73, 0xAF, 0xA7, 0x3F,
+    0xC7, 0x39, 0xFA, 0x73, 0xFC, 0x73, 0x9F, 0xC7, 0x3F, 0xC9, 0x73, 0xFC, 0x73, 0xAF, 0x97, 0x3F,
+    0xC7, 0x3A, 0xFA, 0x73, 0xFC, 0x70, 0x77, 0x49, 0xAF, 0xCA, 0x96, 0xFF, 0xE4, 0xFF, 0xFC, 0x2A,
+    0xFC, 0xAA, 0xAF, 0xCA, 0x1F, 0xC4, 0xFC, 0x1F, 0xA4, 0xAF, 0x1F, 0xA4, 0xAF, 0x1F, 0xC4, 0xFC,
+    0x19, 0xFC, 0x91, 0xFC, 0x92, 0xAF, 0xFE, 0xA4, 0xAF, 0xFC, 0x96, 0xAF, 0xE9, 0x6A, 0xFF, 0xCA,
+    0x4F, 0xFF, 0xC2, 0xFC, 0xA1, 0x9F, 0xCA, 0x09, 0xFA, 0x4F, 0xC9, 0xAF, 0x6F, 0xAF, 0xC6, 0xFF,
+    0xD6, 0xFC, 0xAF, 0xA4, 0x9F, 0xA9, 0xFC, 0xA9, 0x99, 0xAF, 0xC9, 0x0A, 0xFF, 0xFC, 0xA2, 0xAF,
+    0xFE, 0xA4, 0x9A, 0xFE, 0xA7, 0x29, 0x99, 0x60, 0x77, 0x49, 0xAF, 0xC9, 0x7F, 0xFD, 0x94, 0xFF,
+    0xF9, 0x2F, 0xFF, 0xD1, 0x9F, 0xC9, 0x2F, 0xCA, 0x0A, 0xFA, 0x4F, 0xC0, 0xFC, 0x5A, 0xF9, 0xFC,
+    0x59, 0xFA, 0xFC, 0x6F, 0xFD, 0x59, 0xFC, 0xAF, 0xA4, 0xFD, 0x9F, 0xCA, 0x19, 0xFE, 0x0F, 0xFF,
+    0xF0, 0x9F, 0xFC, 0xAF, 0xA1, 0x9F, 0xEA, 0x0F, 0xA3, 0x9A, 0xAA, 0xA9, 0x1F, 0x97, 0x29, 0xF7,
+    0x3F, 0xC7, 0x2A, 0xF9, 0x71, 0xFD, 0x3C, 0xAA, 0xAA, 0xFE, 0x39, 0xFF, 0xE9, 0x39, 0xFF, 0xD5,
+    0x9F, 0xEA, 0x97, 0x09, 0x99, 0x97, 0x10, 0x19, 0xA9, 0x2A, 0xF1, 0xFC, 0x90, 0xFC, 0xA0, 0xFC,
+    0x91, 0xE9, 0x77, 0x77, 0x77, 0x71, 0x9E, 0xA1, 0xFC, 0x90, 0xFC, 0xA0, 0xFC, 0x90, 0xAF, 0x39,
+    0x91, 0x19, 0xA9, 0x2A, 0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0x91, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x09, 0xF9, 0x0A, 0xF1, 0xAF, 0x1F, 0xA1, 0xF1, 0x9F, 0x1A, 0xE9, 0x1F, 0x29, 0x99, 0x30, 0x76,
+    0x99, 0x74, 0x9D, 0xA7, 0x29, 0xFA, 0x70, 0x9F, 0xDA, 0x69, 0xFE, 0xA5, 0x9F, 0xEA, 0x59, 0xFE,
+    0x95, 0x9F, 0xE9, 0x6A, 0xFD, 0x97, 0x0A, 0xFC, 0x97, 0x19, 0xFE, 0xA7, 0x19, 0xFE, 0xA9, 0x70,
+    0x9F, 0xF9, 0x71, 0xAF, 0xEA, 0x71, 0xAF, 0xDA, 0x72, 0x9F, 0xA7, 0x49, 0xDA, 0x77, 0x90, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA9, 0xFF, 0xFE,
+    0xA7, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF,
+    0xEA, 0xAF, 0xFF, 0xEA, 0x77, 0x00, 0x99, 0x76, 0xAD, 0x97, 0x4A, 0xF9, 0x72, 0xAF, 0xD9, 0x71,
+    0xAF, 0xE9, 0x71, 0x9F, 0xE9, 0x71, 0x9F, 0xE9, 0x71, 0x9F, 0xE9, 0x71, 0x9A, 0xFC, 0xA7, 0x19,
+    0xFC, 0xA7, 0xAF, 0xE9, 0x49, 0xAF, 0xE9, 0x49, 0xFF, 0x94, 0xAF, 0xEA, 0x95, 0xAF, 0xDA, 0x70,
+    0xAF, 0x97, 0x2A, 0xD9, 0x74, 0x97, 0x70, 0x77, 0x2A, 0xFE, 0xA3, 0x9F, 0xFF, 0x91, 0xAF, 0xFF,
+    0xC2, 0xFF, 0xFD, 0x1A, 0xD9, 0x39, 0xFC, 0x29, 0x6A, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x1A, 0xFA,
+    0x70, 0xAF, 0xC7, 0x0F, 0xD7, 0x0F, 0xD7, 0x0F, 0xCA, 0x71, 0xF9, 0x72, 0xF7, 0x29, 0xEA, 0x73,
+    0x99, 0x97, 0x77, 0x77, 0x4E, 0xA7, 0x2F, 0xCA, 0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x71, 0x9F, 0x74,
+    0x99, 0x70, 0x71, 0x9A, 0xFD, 0xA9, 0x77, 0xAF, 0xFF, 0x97, 0x3A, 0xFF, 0xFF, 0x71, 0xFD, 0xA9,
+    0x39, 0xAF, 0xC7, 0xFC, 0x97, 0x1A, 0xF5, 0xAE, 0xA7, 0x4A, 0xEA, 0x39, 0xEA, 0x4A, 0xAD, 0xAA,
+    0x92, 0xAE, 0x92, 0xF3, 0xAF, 0xFC, 0x91, 0xEA, 0x19, 0xE9, 0x2F, 0xFE, 0x91, 0xAE, 0x1A, 0xE2,
+    0xAF, 0x91, 0xAE, 0x91, 0x9E, 0x1E, 0xA1, 0x9F, 0x39, 0xE9, 0x19, 0xE9, 0x0E, 0x91, 0xAE, 0x93,
+    0x9E, 0x3E, 0x99, 0xE9, 0x1F, 0x4A, 0xE3, 0xE9, 0x9E, 0x2F, 0x4A, 0xE2, 0x9E, 0x09, 0xE2, 0xF4,
+    0xF2, 0x9E, 0x09, 0xE9, 0x1F, 0x4F, 0x2F, 0x09, 0xE9, 0x1A, 0xEA, 0x2A, 0xF9, 0x09, 0xE9, 0x1E,
+    0xA2, 0xFC, 0xAF, 0xEA, 0xF2, 0xF2, 0x9F, 0xF0, 0xFE, 0x3A, 0xE9, 0x29, 0xFC, 0xA2, 0xFC, 0x5F,
+    0x76, 0x97, 0xAF, 0x77, 0x7F, 0xCA, 0x71, 0x9A, 0x97, 0x1F, 0xEA, 0x99, 0x9A, 0xAF, 0x97, 0x2A,
+    0xFF, 0xFE, 0x97, 0x4A, 0xFF, 0xFA, 0x77, 0x09, 0xAA, 0xAA, 0xAA, 0x97, 0x10, 0x7A, 0xFC, 0xA7,
+    0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0,
+    0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF,
+    0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA,
+    0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99,
+    0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19,
+    0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x0F, 0xFC, 0xAA, 0x96, 0xFF, 0xFD, 0x93,
+    0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0x91, 0xFC, 0x39, 0xAF, 0xCA, 0x1F, 0xC5, 0xAF, 0xC1, 0xFC, 0x59,
+    0xFC, 0x1F, 0xC5, 0x9F, 0xA1, 0xFC, 0x5F, 0xC9, 0x1F, 0xC9, 0x99, 0x99, 0xFD, 0x2F, 0xFF, 0xDA,
+    0x3F, 0xFF, 0xC9, 0x4F, 0xFF, 0xE9, 0x2F, 0xCA, 0xAA, 0xAA, 0xFD, 0x91, 0xFC, 0x5A, 0xFC, 0x1F,
+    0xC6, 0xFC, 0x90, 0xFC, 0x6F, 0xC9, 0x0F, 0xC6, 0xFC, 0x90, 0xFC, 0x59, 0xFC, 0x90, 0xFC, 0x49,
+    0xFD, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF2, 0xFF, 0xFD, 0xA3, 0xFF, 0xEA, 0x94, 0x77, 0x72, 0x9A,
+    0xFE, 0xA9, 0x7F, 0xFF, 0xC4, 0x9F, 0xFF, 0xD3, 0x9F, 0xFF, 0xDA, 0x3F, 0xE9, 0x29, 0xAD, 0x3A,
+    0xFC, 0x97, 0x93, 0xFC, 0xA7, 0x4A, 0xFC, 0x75, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC,
+    0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97, 0x5F, 0xCA, 0x75, 0xAF, 0xC7, 0x59, 0xFC, 0x97, 0x5F,
+    0xD7, 0x5A, 0xFD, 0xA4, 0x9A, 0xC9, 0x3F, 0xFF, 0xE9, 0x4F, 0xFF, 0xD9, 0x5A, 0xFF, 0xF9, 0x69,
+    0xAF, 0xFC, 0x97, 0x39, 0x99, 0x95, 0x0F, 0xFC, 0xAA, 0x97, 0x0F, 0xFF, 0xD9, 0x5F, 0xFF, 0xEA,
+    0x4F, 0xFF, 0xFC, 0x3F, 0xC9, 0x99, 0x9A, 0xFE, 0xA2, 0xFC, 0x59, 0xFD, 0x2F, 0xC7, 0xFC, 0xA1,
+    0xFC, 0x7A, 0xFC, 0x1F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC7, 0x0F, 0xCA, 0x0F,
+    0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F,
+    0xC7, 0x0F, 0xC1, 0xFC, 0x7A, 0xFC, 0x1F, 0xC6, 0x9F, 0xCA, 0x1F, 0xC5, 0x9F, 0xD2, 0xFC, 0x29,
+    0x9F, 0xE9, 0x2F, 0xFF, 0xFA, 0x3F, 0xFF, 0xEA, 0x4F, 0xFF, 0xCA, 0x6F, 0xFD, 0xA9, 0x70, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xC0, 0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0x77, 0x74, 0x9A,
+    0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x5F, 0xFF, 0xE4, 0xFF, 0xFE, 0xA3, 0xFE, 0xA9, 0x29, 0xAD, 0x3A,
+    0xFD, 0x75, 0xFD, 0x75, 0x9F, 0xC7, 0x6A, 0xFC, 0x76, 0xFC, 0x97, 0x6F, 0xC9, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x1F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC9,
+    0x3F, 0xFC, 0x90, 0xFC, 0xA7, 0x9F, 0x90, 0xAF, 0xC7, 0x9F, 0x90, 0x9F, 0xC9, 0x69, 0xF9, 0x1F,
+    0xD6, 0x9F, 0x91, 0x9F, 0xD9, 0x4A, 0xF9, 0x2A, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0x94, 0xAF, 0xFF,
+    0xD9, 0x6A, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x96, 0xFC, 0x70, 0x9F, 0x9F, 0xC7, 0x0A, 0xFA, 0xFC,
+    0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF,
+    0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFC, 0xAF, 0xFF,
+    0xFE, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xAF, 0xC7,
+    0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA,
+    0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70,
+    0xAF, 0xA0, 0xAF, 0xFC, 0xAF, 0xFF, 0xFF, 0xD9, 0xAF, 0xEA, 0x3F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC,
+    0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F,
+    0xC5, 0xFC, 0x3A, 0xFE, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x5F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC,
+    0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F,
+    0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC5,
+    0xAF, 0xA1, 0x99, 0x9A, 0xFC, 0x90, 0x9F, 0xFC, 0x19, 0xFF, 0x91, 0x9F, 0xE9, 0x29, 0xFC, 0xA4,
+    0xFC, 0x7A, 0xFA, 0x0F, 0xC6, 0xAF, 0xC1, 0xFC, 0x59, 0xFC, 0x91, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4,
+    0xFC, 0xA3, 0xFC, 0x3A, 0xFC, 0x4F, 0xC2, 0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x95, 0xFC, 0x1F, 0xCA,
+    0x6F, 0xC0, 0xFC, 0xA7, 0xFC, 0xAF, 0xC7, 0x0F, 0xFE, 0x97, 0xFF, 0xF7, 0xFF, 0xFA, 0x6F, 0xD9,
+    0xAF, 0xC6, 0xFC, 0x2F, 0xD5, 0xFC, 0x29, 0xFC, 0x94, 0xFC, 0x3A, 0xFC, 0x4F, 0xC4, 0xFC, 0xA3,
+    0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xD2, 0xFC, 0x6F, 0xCA, 0x1F, 0xC6, 0xAF, 0xC1, 0xFC, 0x7F,
+    0xD0, 0x0F, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F,
+    0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0xFE, 0x72, 0x9F, 0xD9, 0xFE, 0x97, 0x1F, 0xE9, 0xFE, 0xA7, 0x1F,
+    0xE9, 0xFF, 0x70, 0xAF, 0xE9, 0xFF, 0x70, 0xFF, 0x9F, 0xFA, 0x7F, 0xF9, 0xFA, 0xF6, 0xAE, 0xAF,
+    0x9F, 0x9F, 0x6F, 0x9F, 0x9F, 0x9A, 0xE9, 0x5F, 0x0F, 0x9F, 0x99, 0xEA, 0x49, 0xE9, 0x0F, 0x9F,
+    0x90, 0xF4, 0xF1, 0xF9, 0xF9, 0x0F, 0x93, 0xF0, 0x9F, 0x9F, 0x90, 0x9E, 0xA2, 0x9E, 0x90, 0x9F,
+    0x9F, 0xA1, 0xF2, 0xF1, 0x9F, 0x9F, 0xA1, 0xF9, 0x1F, 0x19, 0xF9, 0xFA, 0x1A, 0xEA, 0x09, 0xEA,
+    0x19, 0xF9, 0xFA, 0x2F, 0x0F, 0x29, 0xF9, 0xFA, 0x2F, 0x9F, 0x29, 0xF9, 0xFA, 0x2A, 0xFE, 0xA2,
+    0x9F, 0x9F, 0xA2, 0x9F, 0xE3, 0x9F, 0x9F, 0xA3, 0xFE, 0x39, 0xF9, 0xFA, 0x3A, 0xFC, 0xA3, 0x9F,
+    0x9F, 0xA3, 0x9F, 0xC4, 0x9F, 0x9F, 0xA4, 0xFC, 0x49, 0xF9, 0xFD, 0x97, 0x09, 0xF0, 0xFE, 0x70,
+    0x9F, 0x0F, 0xEA, 0x79, 0xF0, 0xFF, 0x96, 0x9F, 0x0F, 0xFC, 0x69, 0xF0, 0xFF, 0xC9, 0x59, 0xF0,
+    0xFA, 0xFC, 0x59, 0xF0, 0xF9, 0xFC, 0xA4, 0x9F, 0x0F, 0x90, 0xFC, 0x49, 0xF0, 0xF9, 0x0A, 0xFC,
+    0x39, 0xF0, 0xF9, 0x1F, 0xC9, 0x29, 0xF0, 0xF9, 0x1A, 0xFC, 0x29, 0xF0, 0xF9, 0x2F, 0xC9, 0x19,
+    0xF0, 0xFA, 0x29, 0xFC, 0x19, 0xF0, 0xFA, 0x3F, 0xCA, 0x09, 0xF0, 0xFA, 0x4F, 0xC0, 0x9F, 0x0F,
+    0xA4, 0xAF, 0xC9, 0xF0, 0xFA, 0x5F, 0xCA, 0xF0, 0xFA, 0x59, 0xFF, 0xC0, 0xFA, 0x6F, 0xFC, 0x0F,
+    0xA6, 0x9F, 0xF0, 0xFA, 0x7A, 0xFE, 0x0F, 0xA7, 0x0F, 0xE0, 0xFA, 0x70, 0xAF, 0xD0, 0x77, 0x76,
+    0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9,
+    0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1,
+    0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F,
+    0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA,
+    0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92,
+    0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA,
+    0x97, 0x70, 0x99, 0x97, 0x10, 0x0F, 0xFC, 0xAA, 0x6F, 0xFF, 0xC9, 0x3F, 0xFF, 0xD9, 0x2F, 0xFF,
+    0xE9, 0x1F, 0xC9, 0x99, 0xAF, 0xE1, 0xFC, 0x4A, 0xFC, 0x1F, 0xC5, 0xFC, 0x1F, 0xC5, 0xFC, 0x90,
+    0xFC, 0x5F, 0xC1, 0xFC, 0x5F, 0xC1, 0xFC, 0x4F, 0xD1, 0xFC, 0xAA, 0xAF, 0xE9, 0x1F, 0xFF, 0xE2,
+    0xFF, 0xFD, 0x3F, 0xFF, 0x94, 0xFC, 0xAA, 0xAA, 0x97, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC,
+    0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x77, 0x76, 0x9A, 0xFE, 0xA7, 0x39, 0xFF,
+    0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96,
+    0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F,
+    0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9,
+    0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71,
+    0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F,
+    0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFD, 0x77, 0x09, 0x9F, 0xCA, 0x77,
+    0x19, 0xFC, 0xA7, 0x71, 0xAF, 0xCA, 0x77, 0x1F, 0xD9, 0x77, 0x1F, 0xD9, 0x77, 0x09, 0xAA, 0xAA,
+    0xAA, 0x00, 0x0F, 0xFC, 0xAA, 0x97, 0xFF, 0xFC, 0x95, 0xFF, 0xFD, 0xA4, 0xFF, 0xFE, 0xA3, 0xFC,
+    0x29, 0xAF, 0xD3, 0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F,
+    0xC9, 0x2F, 0xC4, 0x9F, 0xC3, 0xFC, 0x3A, 0xFC, 0xA3, 0xFF, 0xFE, 0x4F, 0xFF, 0xCA, 0x5F, 0xFF,
+    0x96, 0xFF, 0xFC, 0x6F, 0xC2, 0xFC, 0x95, 0xFC, 0x29, 0xFC, 0x5F, 0xC3, 0xAF, 0xA4, 0xFC, 0x4F,
+    0xC9, 0x3F, 0xC4, 0xAF, 0xC3, 0xFC, 0x5F, 0xCA, 0x2F, 0xC5, 0x9F, 0xC9, 0x1F, 0xC6, 0xFD, 0x1F,
+    0xC7, 0xFC, 0xA0, 0x77, 0x49, 0xAF, 0xDA, 0x95, 0xAF, 0xFE, 0xA2, 0xFF, 0xFC, 0xA1, 0x9F, 0xFF,
+    0xC2, 0xFD, 0x39, 0xDA, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xD7, 0x2A, 0xFD, 0xA7, 0x1F,
+    0xFA, 0x70, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0F, 0xFC, 0x71, 0xFE, 0x97, 0x19, 0xFD, 0x72, 0x9F,
+    0xC7, 0x3F, 0xC0, 0x99, 0x70, 0xFC, 0x09, 0xDA, 0x94, 0xAF, 0xA0, 0x9F, 0xFF, 0xD9, 0x09, 0xFF,
+    0xFC, 0xA1, 0x9F, 0xFF, 0xA3, 0x9A, 0xFF, 0xA7, 0x29, 0x99, 0x70, 0x9F, 0xFF, 0xFC, 0x99, 0xFF,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x9F, 0xCA, 0x99, 0x99,
+    0x99, 0x6F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC6, 0x0F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC,
+    0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC,
+    0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99, 0x70, 0xAF, 0x72, 0x9F, 0x9A, 0xFA, 0x71, 0xFC, 0x1F, 0xC7,
+    0x1F, 0xC1, 0xFC, 0x70, 0x9F, 0xA1, 0xAF, 0x97, 0xFC, 0x3F, 0xC7, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3,
+    0xAF, 0x95, 0xFC, 0x5F, 0xA5, 0xFC, 0x5F, 0xC4, 0x9F, 0x95, 0xAF, 0x93, 0xAF, 0x7F, 0xA3, 0xFC,
+    0x7F, 0xC2, 0x9F, 0x97, 0x9F, 0x91, 0xAF, 0x71, 0xFA, 0x1F, 0xC7, 0x1F, 0xC1, 0xF9, 0x71, 0x9F,
+    0x0A, 0xF7, 0x3F, 0x9A, 0xF7, 0x3F, 0xAF, 0x97, 0x39, 0xFF, 0x75, 0xFF, 0x75, 0xFE, 0x97, 0x59,
+    0xFD, 0x77, 0xFC, 0xA7, 0xAF, 0x79, 0xF9, 0x7A, 0xF0, 0xAF, 0x96, 0xAF, 0xC7, 0xFC, 0x09, 0xFA,
+    0x6F, 0xD6, 0x9F, 0xA1, 0xFA, 0x6F, 0xD9, 0x5A, 0xF9, 0x1F, 0xC5, 0x9F, 0xDA, 0x5A, 0xF2, 0xAF,
+    0x5A, 0xFE, 0x5F, 0xC2, 0x9F, 0x94, 0xFF, 0x5F, 0xA3, 0xFA, 0x4F, 0xAE, 0x93, 0x9F, 0x93, 0xFC,
+    0x39, 0xEA, 0x9E, 0xA3, 0xAF, 0x4A, 0xF3, 0xAE, 0x90, 0xF3, 0xFC, 0x49, 0xF9, 0x2F, 0x1F, 0x3F,
+    0xA5, 0xFA, 0x2F, 0x1F, 0x91, 0x9F, 0x95, 0xFC, 0x19, 0xF1, 0xAE, 0xA1, 0xAF, 0x6A, 0xF1, 0xAE,
+    0x91, 0x9F, 0x1F, 0xC6, 0x9F, 0x90, 0xF3, 0xF1, 0xFA, 0x7F, 0x90, 0xF3, 0xF9, 0x9F, 0x97, 0xFA,
+    0x9E, 0xA3, 0xAE, 0xA9, 0xF7, 0x0A, 0xFA, 0xE9, 0x4F, 0xAF, 0x70, 0x9F, 0xF5, 0xFF, 0xA7, 0x1F,
+    0xF5, 0xAF, 0xE9, 0x71, 0xFE, 0xA5, 0x9F, 0xE7, 0x2A, 0xFD, 0x96, 0xFE, 0x72, 0x9F, 0xD7, 0xFD,
+    0xA7, 0x3F, 0xD7, 0xAF, 0xC9, 0x50, 0x0F, 0xC9, 0x70, 0xFC, 0x91, 0xAF, 0xC7, 0xFD, 0x3F, 0xCA,
+    0x59, 0xFC, 0x49, 0xFC, 0x5F, 0xCA, 0x5A, 0xFC, 0x3A, 0xFC, 0x7F, 0xC9, 0x2F, 0xC9, 0x79, 0xFC,
+    0x1F, 0xCA, 0x71, 0xAF, 0xA9, 0xFC, 0x73, 0xFF, 0xD9, 0x73, 0x9F, 0xFC, 0x75, 0xFF, 0x77, 0xFD,
+    0xA7, 0x69, 0xFD, 0x97, 0x6F, 0xF7, 0x5F, 0xFD, 0x73, 0x9F, 0xFD, 0xA7, 0x2F, 0xC9, 0x9F, 0xC7,
+    0x1A, 0xFC, 0x1A, 0xFC, 0x79, 0xFC, 0x3F, 0xCA, 0x6F, 0xCA, 0x39, 0xFC, 0x5A, 0xFC, 0x5F, 0xD3,
+    0x9F, 0xC9, 0x6F, 0xCA, 0x2F, 0xCA, 0x7A, 0xFC, 0x1A, 0xFC, 0x71, 0xFD, 0x00, 0xAF, 0xA7, 0x0A,
+    0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC, 0xA2, 0xFC, 0x59, 0xFC, 0x3A, 0xFA, 0x4F, 0xCA,
+    0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96, 0xFC, 0x19, 0xFC, 0x7A, 0xFA, 0x0A, 0xF9, 0x70,
+    0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF, 0xC7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x59, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x70, 0x0A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xFC, 0x97, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF,
+    0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3F, 0xCA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xCA, 0x73,
+    0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC9, 0x73, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0xAF, 0xE0, 0xAF, 0xE0, 0xAF,
+    0xE0, 0xAF, 0xAA, 0xA0, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAF, 0xE0, 0xAF, 0xE0, 0xAF, 0xE1, 0x99, 0x99, 0x99, 0x90, 0xAF, 0x70, 0x9F, 0x97, 0x0F, 0xA7,
+    0x0A, 0xF7, 0x1F, 0x97, 0x0F, 0xC7, 0x09, 0xF7, 0x1F, 0x97, 0x0A, 0xF7, 0x09, 0xF7, 0x1F, 0xA7,
+    0x0A, 0xF7, 0x1F, 0x97, 0x0F, 0xA7, 0x09, 0xF7, 0x1F, 0x97, 0x0F, 0xC7, 0x09, 0xF7, 0x1F, 0xA7,
+    0x0A, 0xF7, 0x09, 0xF9, 0x70, 0xFA, 0x70, 0xAF, 0x71, 0xF9, 0x75, 0x0F, 0xEA, 0x0F, 0xEA, 0x0F,
+    0xEA, 0x0A, 0xAA, 0xFA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA,
+    0x0F, 0xEA, 0x0F, 0xEA, 0x0F, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x00, 0x69, 0xD9, 0x76, 0xF7, 0x6F,
+    0x97, 0x4A, 0xFC, 0x74, 0xFD, 0xA7, 0x2A, 0xEA, 0xE7, 0x2E, 0xA0, 0xEA, 0x70, 0xAE, 0x1A, 0xE7,
+    0x0E, 0xA2, 0xEA, 0x69, 0xE3, 0xAE, 0x6F, 0x4E, 0xA4, 0x9E, 0x94, 0xAE, 0x4F, 0x6E, 0xA2, 0x9E,
+    0x96, 0xAE, 0x2F, 0x70, 0xF1, 0xAA, 0xA9, 0x70, 0x9A, 0xAA, 0x00, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9A, 0xAA, 0xAA, 0x4F, 0xCA, 0x4A, 0xF9, 0x4A,
+    0xF9, 0x49, 0xF6, 0xAD, 0xA0, 0x59, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC,
+    0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA,
+    0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0,
+    0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x09, 0x99, 0x97, 0x4A, 0xF9,
+    0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x29,
+    0xA9, 0x94, 0xAF, 0x90, 0xFE, 0x3A, 0xF9, 0xFF, 0xC9, 0x1A, 0xFF, 0xFE, 0x1A, 0xFD, 0xAA, 0xAF,
+    0xDA, 0x0A, 0xFC, 0x93, 0xAF, 0xC0, 0xAF, 0xC5, 0xFC, 0x0A, 0xFA, 0x5F, 0xC9, 0xAF, 0xA5, 0xAF,
+    0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xFA, 0x5F, 0xC9, 0xAF, 0xA5, 0xFC, 0x9A, 0xFC,
+    0x49, 0xFC, 0x0A, 0xFC, 0xA3, 0xFD, 0x0A, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xE1, 0xAF, 0x0F, 0xFC,
+    0x2A, 0xEA, 0x1A, 0xFC, 0xA7, 0x49, 0x99, 0x50, 0x69, 0x9A, 0xA9, 0x79, 0xAF, 0xFA, 0x3A, 0xFF,
+    0xE2, 0xAF, 0xFE, 0xA2, 0xFD, 0xAA, 0xAA, 0xD2, 0xAF, 0xC5, 0x92, 0xFC, 0x97, 0x1F, 0xC7, 0x19,
+    0xFC, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC9, 0x71, 0xAF, 0xC9,
+    0x4A, 0xA2, 0xFE, 0xAF, 0xC2, 0xAF, 0xFF, 0x3A, 0xFF, 0xE5, 0xAF, 0xEA, 0x71, 0x99, 0x94, 0x74,
+    0x99, 0x99, 0x74, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39,
+    0xFA, 0x59, 0xA9, 0x91, 0x9F, 0xA3, 0xFE, 0x09, 0xFA, 0x2F, 0xFC, 0x9F, 0xA1, 0xFF, 0xFE, 0xA0,
+    0x9F, 0xDA, 0xAA, 0xFD, 0xA0, 0xFD, 0x39, 0xFC, 0xA0, 0xFC, 0x94, 0xAF, 0xA9, 0xFC, 0x59, 0xFA,
+    0x9F, 0xC6, 0xFA, 0x9F, 0xA6, 0xFA, 0x9F, 0xA6, 0xFA, 0x9F, 0xC6, 0xFA, 0x9F, 0xC5, 0x9F, 0xA0,
+    0xFC, 0x94, 0xAF, 0xA0, 0xFD, 0x39, 0xFC, 0xA0, 0x9F, 0xEA, 0xFE, 0xA1, 0xFF, 0xFE, 0xA2, 0xFF,
+    0xC0, 0xFA, 0x3A, 0xFC, 0xA1, 0x9E, 0xA5, 0x99, 0x71, 0x69, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A,
+    0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F,
+    0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74,
+    0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF,
+    0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x50, 0x69, 0x99, 0x99, 0x96, 0x9F, 0xF4, 0xAF, 0xFC, 0x4F,
+    0xFC, 0xA3, 0x9F, 0xCA, 0x9A, 0xA9, 0x3A, 0xFA, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x69, 0xFF, 0xDA,
+    0x19, 0xFF, 0xEA, 0x19, 0xFF, 0xEA, 0x2A, 0xAF, 0xCA, 0xAA, 0xA9, 0x4A, 0xF9, 0x70, 0xAF, 0x97,
+    0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A,
+    0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x95, 0x59, 0xA9,
+    0x97, 0x3F, 0xE9, 0x0F, 0xA2, 0xFF, 0xC9, 0xFA, 0x1F, 0xFF, 0xEA, 0x09, 0xFD, 0xA9, 0xAF, 0xDA,
+    0x0F, 0xD4, 0xFC, 0xA0, 0xFC, 0x94, 0xAF, 0xA9, 0xFC, 0x59, 0xFA, 0x9F, 0xC6, 0xFA, 0x9F, 0xA6,
+    0xFA, 0x9F, 0xA6, 0xFA, 0x9F, 0xC6, 0xFA, 0x9F, 0xC6, 0xFA, 0x0F, 0xC9, 0x4A, 0xFA, 0x0F, 0xD3,
+    0x9F, 0xCA, 0x09, 0xFD, 0xAA, 0xFE, 0xA1, 0xFF, 0xFE, 0xA2, 0xFF, 0xC9, 0xFA, 0x3A, 0xFC, 0xA0,
+    0x9F, 0xA5, 0x99, 0x92, 0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xFC, 0x90, 0x9C, 0xA9, 0x49, 0xFD, 0x19,
+    0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0xA5, 0xAA, 0xFD, 0xAA, 0x40, 0x09, 0x99, 0x97,
+    0x4A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A,
+    0xF9, 0x29, 0xA9, 0x94, 0xAF, 0x90, 0xFE, 0xA2, 0xAF, 0x9F, 0xFD, 0x1A, 0xFF, 0xFE, 0xA0, 0xAF,
+    0xEA, 0x9A, 0xFD, 0x0A, 0xFC, 0xA3, 0x9F, 0xC0, 0xAF, 0xC5, 0xFC, 0x9A, 0xFC, 0x5F, 0xC9, 0xAF,
+    0xA5, 0xAF, 0x9A, 0xFA, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF,
+    0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9,
+    0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x90, 0x19, 0x91, 0x9F, 0x9A, 0xFA, 0xAF, 0xA9, 0xF9, 0x19, 0x97,
+    0x5A, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA,
+    0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xA0, 0x59, 0x95, 0x9F, 0x93,
+    0xAF, 0xA3, 0xAF, 0xA3, 0x9F, 0x95, 0x99, 0x77, 0x71, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF,
+    0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF,
+    0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF, 0x93, 0xAF,
+    0x93, 0xAF, 0x92, 0x9F, 0xC9, 0xFF, 0xC0, 0xFF, 0xA0, 0xFE, 0xA1, 0xAF, 0xA9, 0x20, 0x09, 0x99,
+    0x97, 0x59, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7,
+    0x49, 0xFA, 0x74, 0x9F, 0xA5, 0xFC, 0xA0, 0x9F, 0xA4, 0xFC, 0xA1, 0x9F, 0xA3, 0xFC, 0xA2, 0x9F,
+    0xA2, 0xFD, 0x39, 0xFA, 0x1A, 0xFC, 0x49, 0xFA, 0x0A, 0xFC, 0x59, 0xF9, 0x9F, 0xC6, 0x9F, 0xAF,
+    0xC9, 0x69, 0xFF, 0xDA, 0x69, 0xFF, 0xE9, 0x59, 0xFF, 0xF5, 0x9F, 0xCA, 0x0A, 0xFC, 0x49, 0xFA,
+    0x2F, 0xCA, 0x39, 0xFA, 0x29, 0xFC, 0x92, 0x9F, 0xA3, 0xAF, 0xC2, 0x9F, 0xA4, 0xFD, 0x19, 0xFA,
+    0x5F, 0xCA, 0x09, 0xFA, 0x59, 0xFC, 0x90, 0x09, 0x99, 0x90, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9,
+    0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF,
+    0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x90,
+    0x70, 0x9A, 0x99, 0x69, 0xAA, 0x94, 0xAE, 0xA0, 0x9F, 0xEA, 0x2F, 0xEA, 0x2A, 0xF9, 0xFF, 0xCA,
+    0x0F, 0xFD, 0x1A, 0xFF, 0xFF, 0xFF, 0xD9, 0x0A, 0xFE, 0xAA, 0xFF, 0xCA, 0x9A, 0xFD, 0x0A, 0xFC,
+    0xA3, 0xFE, 0x3A, 0xFC, 0x0A, 0xFC, 0x49, 0xFC, 0x94, 0xFC, 0x0A, 0xFA, 0x49, 0xFC, 0x5F, 0xC0,
+    0xAF, 0xA5, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95,
+    0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x5F, 0xC0, 0x70, 0x9A, 0xA9, 0x4A, 0xEA, 0x1F, 0xEA, 0x2A, 0xF0,
+    0xFF, 0xD1, 0xAF, 0xFF, 0xEA, 0x0A, 0xFE, 0xA9, 0xAF, 0xD0, 0xAF, 0xCA, 0x39, 0xFC, 0x0A, 0xFC,
+    0x5F, 0xC9, 0xAF, 0xC5, 0xFC, 0x9A, 0xFA, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9,
+    0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95,
+    0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0x69, 0x9A, 0x99, 0x72,
+    0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFF, 0xFC, 0x93, 0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC,
+    0x91, 0xFC, 0x59, 0xFC, 0x1F, 0xC6, 0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA,
+    0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x1F, 0xC6, 0xFC, 0x1F, 0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9,
+    0x2F, 0xDA, 0xAA, 0xFD, 0x39, 0xFF, 0xFC, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70,
+    0x70, 0x9A, 0x99, 0x4A, 0xEA, 0x1F, 0xE9, 0x2A, 0xF0, 0xFF, 0xC9, 0x1A, 0xFF, 0xFE, 0x1A, 0xFD,
+    0xAA, 0xAF, 0xDA, 0x0A, 0xFC, 0x93, 0xAF, 0xC0, 0xAF, 0xC5, 0xFC, 0x0A, 0xFA, 0x5F, 0xC9, 0xAF,
+    0xA5, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xFA, 0x5F, 0xC9, 0xAF, 0xA5, 0xFC,
+    0x9A, 0xFC, 0x49, 0xFC, 0x0A, 0xFC, 0xA3, 0xFD, 0x0A, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xE1, 0xAF,
+    0x9F, 0xFC, 0x2A, 0xF9, 0x0A, 0xFC, 0xA3, 0xAF, 0x92, 0x99, 0x95, 0xAF, 0x97, 0x3A, 0xF9, 0x73,
+    0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x30, 0x59, 0xA9, 0x97,
+    0x3F, 0xE1, 0xFA, 0x2F, 0xFC, 0x9F, 0xA1, 0xFF, 0xFE, 0xA0, 0x9F, 0xD9, 0x9A, 0xFD, 0xA0, 0xFD,
+    0x4F, 0xCA, 0x0F, 0xC9, 0x4A, 0xFA, 0x9F, 0xC5, 0x9F, 0xA9, 0xFC, 0x6F, 0xA9, 0xFA, 0x6F, 0xA9,
+    0xFA, 0x6F, 0xA9, 0xFC, 0x6F, 0xA9, 0xFC, 0x59, 0xFA, 0x0F, 0xC9, 0x4A, 0xFA, 0x0F, 0xD3, 0x9F,
+    0xCA, 0x09, 0xFD, 0xAA, 0xFE, 0xA1, 0xFF, 0xFE, 0xA2, 0xFF, 0xC9, 0xFA, 0x3A, 0xFC, 0xA0, 0x9F,
+    0xA5, 0x99, 0x92, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39,
+    0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x70, 0x9A, 0x90, 0xAE, 0x91, 0xAF, 0x9A, 0xEA, 0x0A, 0xFC,
+    0x9A, 0xFA, 0xFD, 0x0A, 0xFF, 0xE0, 0xAF, 0xE9, 0x19, 0x0A, 0xFC, 0xA5, 0xAF, 0xC6, 0xAF, 0xA6,
+    0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96,
+    0xAF, 0x96, 0xAF, 0x96, 0x49, 0x9A, 0xA9, 0x96, 0xAF, 0xFA, 0x91, 0x9F, 0xFF, 0x1F, 0xFF, 0x90,
+    0x9F, 0xA3, 0xAD, 0x19, 0xF9, 0x70, 0x9F, 0xC9, 0x70, 0xFE, 0x96, 0xAF, 0xFA, 0x5A, 0xFF, 0xC9,
+    0x49, 0xFF, 0xC9, 0x6A, 0xFE, 0x70, 0xAF, 0xC7, 0x1A, 0xF9, 0x9A, 0x6A, 0xF9, 0x9E, 0xA9, 0x99,
+    0xAF, 0xC0, 0x9F, 0xFF, 0xA0, 0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x97, 0x99, 0x96, 0x77, 0x19, 0xE7,
+    0x1A, 0xE7, 0x1F, 0x70, 0x9F, 0x96, 0xAF, 0xFD, 0x1F, 0xFF, 0x1F, 0xFF, 0x1A, 0xAF, 0xCA, 0xAA,
+    0xAA, 0x3F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFD, 0xAA, 0xC9, 0x29, 0xFF, 0xC9, 0x3A, 0xFF, 0x94, 0xAF,
+    0xE7, 0x09, 0x93, 0x77, 0x1A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xFA,
+    0x4A, 0xFC, 0x0A, 0xFC, 0x92, 0x9F, 0xD0, 0x9F, 0xEA, 0xFF, 0x1F, 0xFF, 0xF2, 0xFF, 0xCA, 0x0F,
+    0x3A, 0xFD, 0x91, 0xF6, 0x99, 0x71, 0x77, 0x3A, 0xF9, 0x69, 0xFC, 0x09, 0xFC, 0x6F, 0xC9, 0x1F,
+    0xC6, 0xFC, 0x2A, 0xF9, 0x49, 0xFA, 0x3F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x49, 0xF9, 0x29, 0xF9,
+    0x5F, 0xA2, 0xAF, 0x6A, 0xF2, 0xFA, 0x69, 0xF9, 0x09, 0xF9, 0x7F, 0xA0, 0xAF, 0x70, 0xAF, 0x0F,
+    0xA7, 0x1F, 0xAF, 0x72, 0xFF, 0xC7, 0x29, 0xFE, 0x97, 0x3F, 0xE7, 0x4A, 0xFC, 0xA7, 0x49, 0xFC,
+    0x96, 0x77, 0x74, 0x9F, 0x94, 0xAF, 0xC5, 0xFC, 0x1F, 0xA4, 0xFD, 0x94, 0xFA, 0x1F, 0xC4, 0xFD,
+    0xA3, 0x9F, 0x91, 0xAF, 0x39, 0xFE, 0x3A, 0xF2, 0x9F, 0x92, 0xAE, 0xAE, 0x3F, 0xC3, 0xFA, 0x2E,
+    0xA9, 0xE9, 0x2F, 0xA3, 0xFC, 0x2E, 0xA0, 0xEA, 0x19, 0xF9, 0x39, 0xF9, 0x09, 0xE9, 0x0F, 0x1A,
+    0xF5, 0xFA, 0x0A, 0xE1, 0xAE, 0x1F, 0xA5, 0xFA, 0x0F, 0x19, 0xE9, 0x0F, 0x95, 0xAF, 0x0E, 0xA2,
+    0xEA, 0x9F, 0x69, 0xF0, 0xE9, 0x2E, 0xAA, 0xF7, 0xFA, 0xE3, 0xAE, 0xAE, 0xA7, 0xFF, 0x39, 0xFE,
+    0x97, 0x9F, 0xDA, 0x4F, 0xE7, 0x1F, 0xD9, 0x4F, 0xDA, 0x71, 0xFD, 0x5F, 0xD9, 0x71, 0xAF, 0xC5,
+    0xAF, 0xC5, 0x77, 0x4F, 0xCA, 0x5F, 0xC9, 0x19, 0xFC, 0x4F, 0xCA, 0x3F, 0xCA, 0x29, 0xFC, 0x5F,
+    0xC9, 0x1F, 0xC9, 0x59, 0xFC, 0x0A, 0xFA, 0x7F, 0xFE, 0x71, 0xFF, 0xC9, 0x71, 0x9F, 0xEA, 0x73,
+    0xFE, 0x74, 0xFE, 0x97, 0x2F, 0xFC, 0x71, 0xAF, 0xFD, 0x70, 0xFC, 0x0F, 0xC9, 0x6F, 0xCA, 0x09,
+    0xFC, 0x5A, 0xFC, 0x2A, 0xFC, 0x4F, 0xC9, 0x3F, 0xC9, 0x2F, 0xCA, 0x49, 0xFC, 0x1A, 0xFC, 0x6F,
+    0xD0, 0x77, 0x3A, 0xFA, 0x69, 0xFC, 0x09, 0xFC, 0x6A, 0xF9, 0x1F, 0xC6, 0xFC, 0x2A, 0xFA, 0x49,
+    0xFA, 0x3F, 0xC4, 0xAF, 0x93, 0xAF, 0x4F, 0xC4, 0x9F, 0xA2, 0x9F, 0xA5, 0xFC, 0x2A, 0xF6, 0xAF,
+    0x2F, 0xC7, 0xFA, 0x09, 0xF9, 0x7A, 0xF0, 0xAF, 0x70, 0x9F, 0x0F, 0xA7, 0x1F, 0xAF, 0x97, 0x1A,
+    0xFF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0x9F, 0xD7, 0x5F, 0xC9, 0x75, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5F, 0xC7, 0x49, 0xFD, 0x71, 0xFF, 0xC7, 0x2F, 0xFA, 0x72, 0xFE, 0x97, 0x3A, 0xFA, 0x74, 0x76,
+    0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA7, 0x0F,
+    0xC7, 0x0F, 0xC9, 0x7A, 0xFA, 0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x97, 0xAF, 0xA7, 0x9F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFF, 0xFC, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x69,
+    0xAA, 0xCA, 0x5F, 0xD4, 0xFE, 0x4F, 0xDA, 0x39, 0xFA, 0x59, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69,
+    0xF6, 0x9F, 0x6F, 0xC3, 0x99, 0xFC, 0xA2, 0xAF, 0xE3, 0xAF, 0xA9, 0x4A, 0xFD, 0x93, 0x9F, 0xE9,
+    0x59, 0xFC, 0x6A, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0x69, 0xF6, 0x9F, 0xCA, 0x94,
+    0xFE, 0x4A, 0xFD, 0x59, 0xFC, 0x73, 0x3A, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE9, 0xAA, 0xA0, 0xAC, 0xAA, 0x96, 0xAF, 0xC9, 0x4A, 0xFD,
+    0x4A, 0xFD, 0x95, 0x9F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0xA6, 0xFC, 0x6A,
+    0xFC, 0x99, 0x4A, 0xFD, 0xA4, 0x9A, 0xFA, 0x39, 0xFD, 0xA2, 0x9F, 0xE9, 0x2A, 0xF9, 0x5F, 0xA6,
+    0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x96, 0xF9, 0x6F, 0x93, 0x9A, 0xFC, 0x93, 0xAF, 0xD4, 0xAF, 0xCA,
+    0x4A, 0xF9, 0x77, 0x10, 0x29, 0x99, 0x97, 0x2A, 0xFD, 0xA9, 0x4A, 0xAA, 0xFF, 0xDA, 0xAA, 0xDA,
+    0xAF, 0xFF, 0xEA, 0xAC, 0xA2, 0x9F, 0xFC, 0x99, 0x7A, 0xFA, 0x77, 0x20, 0x79, 0xEA, 0x1F, 0xC9,
+    0x0F, 0xCA, 0x0F, 0xC9, 0x09, 0xF3, 0x97, 0x71, 0x9E, 0xA1, 0x9F, 0x19, 0xF1, 0x9F, 0x19, 0xF1,
+    0xAF, 0x1A, 0xF1, 0xAF, 0x1A, 0xF1, 0xFC, 0x1F, 0xC1, 0xFC, 0x90, 0xFC, 0x90, 0xFC, 0x90, 0xFC,
+    0x90, 0xFC, 0xA0, 0x77, 0x5E, 0x73, 0xE7, 0x29, 0xEA, 0x96, 0xAF, 0xFC, 0xA2, 0xFF, 0xEA, 0x1F,
+    0xFF, 0x1A, 0xFD, 0x99, 0xAE, 0x1F, 0xCA, 0x79, 0xFC, 0x70, 0xAF, 0xA7, 0x0A, 0xF9, 0x70, 0xAF,
+    0x97, 0x0A, 0xF9, 0x70, 0xAF, 0xA7, 0x09, 0xFA, 0x70, 0x9F, 0xC7, 0x1F, 0xD4, 0x9A, 0x90, 0x9F,
+    0xFF, 0x91, 0xFF, 0xF9, 0x2A, 0xFF, 0xD9, 0x39, 0xAF, 0xEA, 0x7E, 0x97, 0x2E, 0x73, 0xE7, 0x39,
+    0x99, 0x40, 0x77, 0x79, 0xAF, 0xDA, 0x96, 0xAF, 0xFD, 0xA4, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFC,
+    0x39, 0xA9, 0x4A, 0xF9, 0x73, 0xAF, 0x74, 0xAF, 0x74, 0xAF, 0x74, 0xFC, 0x97, 0x0A, 0xFF, 0xFC,
+    0x92, 0xAF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFC, 0x92, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x96, 0xAF, 0x74,
+    0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0xAF, 0x97, 0x2A, 0xFA, 0x72, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF,
+    0xF9, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF9, 0x77, 0x2D, 0x79, 0xCA, 0x2A, 0xEA, 0xFC, 0xAE, 0xA1,
+    0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xEA, 0x39, 0xF9, 0x09, 0xF4, 0xF4, 0xEA, 0x3E, 0x94, 0xAE, 0x3E,
+    0x94, 0xAE, 0x3E, 0xA4, 0xEA, 0x3A, 0xE9, 0x2A, 0xE9, 0x39, 0xFF, 0xE3, 0x9F, 0xFF, 0xC2, 0xFF,
+    0xFE, 0x2D, 0xA0, 0x9A, 0xAA, 0x90, 0xAD, 0x49, 0x70, 0xA2, 0xAF, 0x96, 0x9F, 0xA9, 0xFC, 0x6F,
+    0xC1, 0xFC, 0x6F, 0xA2, 0xFA, 0x4A, 0xF3, 0xAF, 0x4F, 0xA4, 0xFA, 0x2A, 0xF5, 0xAF, 0x2F, 0xA6,
+    0xF9, 0x09, 0xF7, 0xAF, 0x0F, 0xA7, 0x0F, 0xAF, 0x71, 0xAF, 0xEA, 0x72, 0xFE, 0x70, 0xAA, 0xAF,
+    0xEA, 0xAA, 0x5F, 0xFF, 0xC5, 0xFF, 0xFC, 0x69, 0x99, 0xFC, 0x99, 0x97, 0x2F, 0xC7, 0x19, 0xAA,
+    0xAF, 0xCA, 0xAA, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC5, 0x99, 0x99, 0xFC, 0x99, 0x99, 0x71, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0x60, 0x3A, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xE7, 0x77, 0x9A, 0xAA, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+    0xAE, 0xAE, 0x9A, 0xAA, 0x49, 0x99, 0x99, 0x6A, 0xFF, 0xA2, 0xFF, 0xE1, 0xAF, 0xAA, 0xAF, 0x1F,
+    0x49, 0xA9, 0x1F, 0x71, 0xFA, 0x70, 0x9F, 0xCA, 0x79, 0xFD, 0xA5, 0xAF, 0xFA, 0x29, 0xEA, 0xAF,
+    0xCA, 0x1F, 0x29, 0xF1, 0xEA, 0x39, 0xE9, 0x0F, 0x4E, 0xA0, 0xFA, 0x29, 0xE9, 0x09, 0xFC, 0x90,
+    0xF2, 0x9F, 0xFC, 0xA4, 0xFF, 0x69, 0xAF, 0xCA, 0x70, 0xAF, 0x97, 0x0A, 0xEA, 0x70, 0x9E, 0xA9,
+    0xCA, 0x5F, 0x99, 0xFC, 0xAF, 0xD0, 0x9F, 0xFE, 0x29, 0xFF, 0xA7, 0x99, 0x95, 0x74, 0xE3, 0xE9,
+    0xAE, 0xA1, 0xAF, 0xFA, 0x1A, 0xF9, 0xE9, 0x2E, 0x91, 0x95, 0x91, 0x77, 0x77, 0x19, 0xAF, 0xDA,
+    0x97, 0x59, 0xFF, 0xF9, 0x72, 0xAE, 0xA4, 0x9A, 0xEA, 0x70, 0xE9, 0x71, 0xAD, 0xA6, 0xE4, 0x99,
+    0xA9, 0x92, 0xAD, 0xA4, 0x9D, 0x39, 0xFE, 0x91, 0xAD, 0x93, 0xD9, 0x29, 0xFF, 0x3E, 0x29, 0xD3,
+    0xE9, 0x39, 0x39, 0xD9, 0x1D, 0xA2, 0xAD, 0x97, 0x2D, 0xA1, 0xD3, 0xE7, 0x3A, 0xD0, 0x9D, 0x29,
+    0xDA, 0x73, 0x9D, 0x09, 0xD2, 0x9D, 0x97, 0x39, 0xD0, 0x9D, 0x29, 0xD9, 0x73, 0x9D, 0x09, 0xD2,
+    0x9D, 0x97, 0x39, 0xD1, 0xD3, 0xDA, 0x73, 0xAD, 0x1D, 0x92, 0xE7, 0x3D, 0xA1, 0xAD, 0x29, 0xDA,
+    0x72, 0xD9, 0x2D, 0x92, 0xFA, 0xAA, 0xD3, 0xAD, 0x3A, 0xD3, 0xAF, 0xE2, 0x9D, 0x94, 0xE4, 0xAA,
+    0xAA, 0x92, 0x9E, 0x59, 0xE7, 0x2A, 0xE7, 0x9E, 0xA9, 0x59, 0xF7, 0x2A, 0xFF, 0xFA, 0x75, 0xAF,
+    0xFA, 0x77, 0x29, 0x99, 0x73, 0x75, 0x9A, 0xFC, 0x93, 0xFF, 0x92, 0xDA, 0xAA, 0xF7, 0x0E, 0x49,
+    0xAA, 0xAE, 0x91, 0xAF, 0xF9, 0x0A, 0xEA, 0x99, 0xE9, 0x0E, 0x92, 0xE9, 0x0E, 0x91, 0xAE, 0x90,
+    0xFA, 0xFC, 0x90, 0x9F, 0xD9, 0xD9, 0x19, 0xAC, 0xA9, 0x1A, 0xA0, 0x5A, 0x6A, 0x97, 0xAD, 0xA3,
+    0x9D, 0xA5, 0xAF, 0xA1, 0x9F, 0xC3, 0x9F, 0xC2, 0xFC, 0x4F, 0xC2, 0xFC, 0x93, 0xFC, 0x91, 0xAF,
+    0xA3, 0xFC, 0x91, 0xAF, 0xC3, 0xAF, 0xA1, 0x9F, 0xC4, 0x9F, 0xC2, 0xFC, 0x5A, 0xFA, 0x19, 0xFC,
+    0x5F, 0xC9, 0x19, 0xFC, 0x5F, 0xC9, 0x1A, 0xFA, 0x5F, 0xC2, 0xFC, 0x94, 0x9F, 0xA2, 0xFC, 0x59,
+    0xD9, 0x4D, 0x97, 0x97, 0x30, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFE,
+    0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E,
+    0xA7, 0x4E, 0xA0, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x71, 0x77, 0x77, 0x19, 0xAF,
+    0xDA, 0x97, 0x59, 0xFF, 0xF9, 0x72, 0xAE, 0xA4, 0x9A, 0xEA, 0x70, 0xE9, 0x71, 0xAD, 0xA6, 0xE1,
+    0x99, 0x99, 0x99, 0x4A, 0xDA, 0x49, 0xD2, 0xFF, 0x3A, 0xD9, 0x3D, 0x92, 0xFF, 0xC3, 0xE2, 0x9D,
+    0x3E, 0x2A, 0xDA, 0x29, 0xD9, 0x1D, 0xA3, 0xE3, 0xE3, 0xDA, 0x1D, 0x4E, 0x3E, 0x3A, 0xD0, 0x9D,
+    0x4E, 0x29, 0xDA, 0x39, 0xD0, 0x9D, 0x4E, 0x99, 0xAE, 0x49, 0xD0, 0x9D, 0x4F, 0xF5, 0x9D, 0x09,
+    0xD4, 0xFE, 0xA5, 0x9D, 0x1D, 0x4E, 0x1A, 0xD5, 0xAD, 0x1D, 0x93, 0xE2, 0xE4, 0xDA, 0x1A, 0xD3,
+    0xE2, 0xAD, 0x93, 0xD9, 0x2D, 0x92, 0xE3, 0xE2, 0xAD, 0x3A, 0xD2, 0xE3, 0x9D, 0xA0, 0x9D, 0x94,
+    0xE1, 0x99, 0x94, 0x99, 0x99, 0xE5, 0x9E, 0x72, 0xAE, 0x79, 0xEA, 0x95, 0x9F, 0x72, 0xAF, 0xFF,
+    0xA7, 0x5A, 0xFF, 0xA7, 0x72, 0x99, 0x97, 0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x76, 0xAF, 0xA4, 0xFF, 0x2F, 0xFD, 0x09, 0xE9, 0x19, 0xE9, 0xAD, 0xA3, 0xAD, 0xAA, 0xDA, 0x39,
+    0xEA, 0xDA, 0x3A, 0xDA, 0x9E, 0x91, 0x9E, 0x90, 0xFF, 0xD2, 0xFF, 0x93, 0xAF, 0xA7, 0x60, 0x6E,
+    0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x59, 0xAA, 0xAA,
+    0xAA, 0xEA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0x59, 0xE9,
+    0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xE9, 0x73, 0x9E, 0x97, 0x49, 0x99, 0x69,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF, 0xEA, 0xAF, 0xFF,
+    0xEA, 0x39, 0x99, 0x95, 0xAF, 0xDA, 0x2F, 0xFC, 0x91, 0xAE, 0xAF, 0xC2, 0xAA, 0x2F, 0x7F, 0x69,
+    0xEA, 0x6F, 0x6F, 0x95, 0xF9, 0x5F, 0x95, 0xF9, 0x5F, 0xFD, 0x90, 0xFF, 0xD9, 0x0F, 0xFD, 0x97,
+    0x30, 0x39, 0x99, 0x95, 0xAF, 0xDA, 0x2F, 0xFC, 0xA1, 0x9D, 0xA9, 0xAF, 0x29, 0x39, 0xE7, 0xAE,
+    0x49, 0x9A, 0xE9, 0x3A, 0xFC, 0x5A, 0xFD, 0x96, 0x9A, 0xE9, 0x7E, 0xA0, 0x95, 0xEA, 0x0E, 0xAA,
+    0xAF, 0x90, 0xFF, 0xD1, 0xAF, 0xEA, 0x59, 0x99, 0x93, 0x3A, 0xAA, 0xAA, 0x92, 0xAF, 0xC2, 0x9F,
+    0xC3, 0xFA, 0x3F, 0x93, 0x9E, 0x50, 0x77, 0x1A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9,
+    0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9,
+    0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xFC, 0x9A, 0xF9, 0x5F, 0xC9, 0xAF, 0xA5,
+    0xFC, 0x9A, 0xFC, 0x49, 0xFC, 0x9A, 0xFC, 0x93, 0xFD, 0x9A, 0xFE, 0xAF, 0xF9, 0xAF, 0xFF, 0xF9,
+    0xAF, 0xFE, 0x0F, 0x9A, 0xFA, 0xFC, 0x1A, 0xE9, 0xAF, 0x90, 0x99, 0x70, 0xAF, 0x97, 0x3A, 0xF9,
+    0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x30, 0x69, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0xFC, 0x19, 0xFF, 0xFE, 0x1F, 0xFE, 0xAA, 0xE0, 0xAF, 0xFD,
+    0x91, 0xAD, 0x0F, 0xFE, 0x91, 0xAD, 0x0F, 0xFE, 0x91, 0xAD, 0x0F, 0xFE, 0x91, 0xAD, 0x9F, 0xFE,
+    0x91, 0xAD, 0x9F, 0xFE, 0x91, 0xAD, 0x0F, 0xFE, 0x91, 0xAD, 0x0F, 0xFE, 0x91, 0xAD, 0x0F, 0xFE,
+    0x91, 0xAD, 0x0A, 0xFF, 0xD9, 0x1A, 0xD1, 0xFF, 0xD9, 0x1A, 0xD1, 0x9F, 0xFC, 0x91, 0xAD, 0x3A,
+    0xFE, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70,
+    0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70,
+    0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x70,
+    0x9D, 0x91, 0xAD, 0x70, 0x9D, 0x91, 0xAD, 0x77, 0x10, 0x79, 0xEA, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F,
+    0xC9, 0x0A, 0xF3, 0x99, 0x10, 0x19, 0xD9, 0x4A, 0xDA, 0x4A, 0xF9, 0x4F, 0x4A, 0xE0, 0x9F, 0xE0,
+    0x9F, 0xD9, 0x1F, 0xA9, 0x10, 0x74, 0xAE, 0x3F, 0xC1, 0x9F, 0xD0, 0xAF, 0xE0, 0x9E, 0xAE, 0x1A,
+    0xA0, 0x9E, 0x49, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x71, 0x76,
+    0x9F, 0xA4, 0xAF, 0xE9, 0x19, 0xFA, 0xF1, 0xF2, 0xEA, 0x0E, 0x92, 0xAE, 0x0E, 0x92, 0x9E, 0x0E,
+    0x92, 0x9E, 0x0E, 0x92, 0xAE, 0x0A, 0xE2, 0xEA, 0x1F, 0xFC, 0x29, 0xFE, 0x59, 0xAC, 0xA9, 0x20,
+    0x2A, 0x69, 0x96, 0x9E, 0x39, 0xE5, 0x9F, 0xA2, 0xFC, 0x5A, 0xFA, 0x19, 0xFC, 0x5F, 0xC9, 0x1A,
+    0xFA, 0x5F, 0xC2, 0xFC, 0x94, 0x9F, 0xC2, 0xFC, 0x94, 0xAF, 0xA1, 0x9F, 0xC4, 0xAF, 0xA1, 0x9F,
+    0xC3, 0xAF, 0xA1, 0x9F, 0xC3, 0x9F, 0xC2, 0xFC, 0x93, 0xFC, 0x2F, 0xC9, 0x3F, 0xC9, 0x1A, 0xFA,
+    0x39, 0xF9, 0x2F, 0xC6, 0xAC, 0xA4, 0xAD, 0x70, 0x97, 0x60, 0x4A, 0xDA, 0x70, 0xAE, 0x71, 0xFA,
+    0x79, 0xEA, 0x79, 0xFC, 0xA7, 0xF7, 0xAF, 0xDA, 0x69, 0xE9, 0x7E, 0x9E, 0xA6, 0xF7, 0x1C, 0x90,
+    0xEA, 0x5A, 0xE9, 0x74, 0xEA, 0x5F, 0x75, 0xEA, 0x4A, 0xE7, 0x6E, 0xA4, 0xEA, 0x76, 0xEA, 0x3F,
+    0x49, 0x99, 0x7E, 0xA2, 0x9E, 0xA3, 0xF9, 0x6E, 0xA2, 0xF3, 0xAF, 0x96, 0xEA, 0x19, 0xE9, 0x29,
+    0xFC, 0x96, 0xEA, 0x1F, 0x3F, 0xD9, 0x69, 0x99, 0x90, 0xAE, 0x92, 0xAD, 0xAE, 0x97, 0x3F, 0x29,
+    0xD9, 0xAE, 0x97, 0x2A, 0xE9, 0x2E, 0x0A, 0xE9, 0x72, 0xEA, 0x2A, 0xD1, 0xAE, 0x97, 0x1F, 0x29,
+    0xDA, 0x1A, 0xE9, 0x70, 0x9E, 0xA2, 0xFF, 0xF9, 0x6F, 0x3F, 0xFF, 0x95, 0x9E, 0x93, 0x9A, 0xAA,
+    0xAA, 0xFA, 0xA6, 0xF7, 0x2A, 0xE9, 0x6A, 0xE9, 0x72, 0xAE, 0x91, 0x4A, 0xDA, 0x70, 0xAE, 0x71,
+    0xFA, 0x79, 0xEA, 0x79, 0xFC, 0xA7, 0xF7, 0xAF, 0xDA, 0x69, 0xE9, 0x7E, 0x9E, 0xA6, 0xF7, 0x1C,
+    0x90, 0xEA, 0x5A, 0xE9, 0x74, 0xEA, 0x5F, 0x75, 0xEA, 0x4A, 0xE7, 0x6E, 0xA4, 0xEA, 0x76, 0xEA,
+    0x3F, 0x29, 0xAA, 0xA9, 0x7E, 0xA2, 0x9E, 0xA0, 0x9F, 0xE9, 0x5E, 0xA2, 0xF0, 0x9F, 0xFC, 0x5E,
+    0xA1, 0x9E, 0x91, 0xEA, 0xAF, 0x94, 0xEA, 0x1F, 0x3A, 0x29, 0xEA, 0x49, 0x99, 0x90, 0xAE, 0x97,
+    0x9E, 0x97, 0x1F, 0x70, 0xF7, 0x1A, 0xE9, 0x7A, 0xE9, 0x71, 0xEA, 0x7A, 0xEA, 0x71, 0xF7, 0xAE,
+    0xA7, 0x19, 0xEA, 0x6F, 0xA7, 0x2F, 0x6F, 0xA9, 0x99, 0x96, 0x9E, 0x95, 0xAF, 0xFD, 0x5F, 0x6A,
+    0xFF, 0xD4, 0xAE, 0x96, 0xAF, 0xFD, 0x77, 0x74, 0x9F, 0xC9, 0x70, 0xAE, 0x5F, 0xFA, 0x7F, 0x5F,
+    0xAF, 0x6A, 0xE7, 0xA2, 0x9E, 0x94, 0x9E, 0xA7, 0x4E, 0x5F, 0x74, 0xEA, 0x49, 0xEA, 0x70, 0x9F,
+    0xCA, 0x5F, 0x71, 0x9F, 0xCA, 0x49, 0xE9, 0x72, 0xAA, 0xAF, 0x3F, 0x77, 0xEA, 0x1A, 0xE9, 0x29,
+    0x99, 0x97, 0x0F, 0x1F, 0x2A, 0xF1, 0xAC, 0xA2, 0x9E, 0xA0, 0xAE, 0x3F, 0xC1, 0xAF, 0xFC, 0x99,
+    0xEA, 0x2F, 0xD1, 0x9F, 0xF9, 0x0F, 0x2A, 0xFD, 0x39, 0xAA, 0xAA, 0x91, 0x9E, 0xA2, 0xD9, 0xF7,
+    0x3F, 0x2E, 0x0F, 0x72, 0x9E, 0x91, 0xAD, 0x90, 0xF7, 0x2F, 0x2D, 0xA1, 0xF7, 0x1A, 0xE9, 0x1E,
+    0x91, 0xF7, 0x1F, 0x19, 0xFF, 0xF6, 0xAE, 0x29, 0xFF, 0xF5, 0x9E, 0xA3, 0xAA, 0xAA, 0xAA, 0xFA,
+    0x95, 0xF7, 0x2F, 0x69, 0xEA, 0x72, 0xF1, 0x79, 0x97, 0x39, 0xF9, 0x71, 0xFD, 0x71, 0xFD, 0x71,
+    0xAF, 0xA7, 0x2A, 0xDA, 0x77, 0x77, 0x73, 0x99, 0x99, 0x73, 0xF7, 0x3F, 0x72, 0xAF, 0x71, 0xFC,
+    0xA7, 0x9F, 0xD7, 0x9F, 0xD7, 0x0F, 0xCA, 0x70, 0xFC, 0x97, 0x1F, 0xA7, 0x19, 0xF9, 0x71, 0x9F,
+    0xA6, 0x92, 0xFC, 0x92, 0x9A, 0xDA, 0x1F, 0xFF, 0xD1, 0x9F, 0xFF, 0xCA, 0x19, 0xFF, 0xEA, 0x49,
+    0xAF, 0xCA, 0x92, 0x59, 0xAA, 0xAA, 0xA7, 0x72, 0xFD, 0x77, 0x2A, 0xFA, 0x77, 0x2A, 0xF9, 0x77,
+    0x29, 0xF7, 0x74, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x7A, 0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9,
+    0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7,
+    0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA,
+    0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF,
+    0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F,
+    0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC,
+    0xA7, 0x2A, 0xFC, 0x00, 0x73, 0x9A, 0xAA, 0xAA, 0x77, 0x1F, 0xCA, 0x77, 0x0F, 0xC9, 0x77, 0x0A,
+    0xF9, 0x77, 0x09, 0xF7, 0x72, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xFC, 0xA7, 0x70, 0xFE, 0x77,
+    0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74, 0xFA,
+    0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A, 0xF9,
+    0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFC,
+    0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0x9F,
+    0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72, 0xFC,
+    0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x70, 0xAA, 0xAA, 0xA7, 0x71, 0xAF, 0xD7, 0x7A, 0xFE, 0xA7,
+    0x59, 0xF9, 0xF9, 0x73, 0x9F, 0x2F, 0x97, 0x2E, 0xA4, 0xAE, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xCA,
+    0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC,
+    0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A,
+    0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE,
+    0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99,
+    0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1,
+    0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x77, 0x76, 0xFA, 0x29, 0xD9, 0x72, 0xFE,
+    0xAA, 0xE7, 0x2A, 0xFF, 0xF7, 0x2E, 0x90, 0x9F, 0xD7, 0x3D, 0x93, 0x9A, 0xCA, 0x77, 0x77, 0x77,
+    0x77, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0,
+    0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7,
+    0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9,
+    0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA,
+    0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9,
+    0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x77, 0x75, 0xAD, 0xA2,
+    0xAD, 0xA7, 0x39, 0xF2, 0xF9, 0x72, 0x9F, 0x2F, 0x97, 0x3F, 0x2A, 0xE7, 0x59, 0x69, 0x77, 0x77,
+    0x77, 0x77, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A,
+    0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F,
+    0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A,
+    0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F,
+    0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F,
+    0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x70, 0xAE, 0x97,
+    0x71, 0xFD, 0xA7, 0x79, 0xDA, 0x9E, 0x97, 0x6A, 0xD2, 0xDA, 0x76, 0xAD, 0x2D, 0xA7, 0x69, 0xFE,
+    0x97, 0x7F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC,
+    0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A,
+    0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE,
+    0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99,
+    0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1,
+    0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x71, 0x9F, 0xFF, 0xFD, 0xA7, 0x1F, 0xFF,
+    0xFF, 0x70, 0x9F, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 0xFC, 0x79, 0xFA, 0xAA, 0xFA, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0xAF, 0x19, 0xFA, 0x77, 0x0F, 0xA1, 0x9F, 0xA7, 0x7A, 0xF2, 0x9F, 0xA7, 0x7F, 0xC2,
+    0x9F, 0xA7, 0x69, 0xF9, 0x29, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC3, 0x9F, 0xFF, 0xC5, 0x9F,
+    0xA3, 0x9F, 0xFF, 0xC5, 0xFC, 0x49, 0xFF, 0xFC, 0x49, 0xFA, 0x49, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x4A, 0xFF, 0xFE, 0xA7, 0x4F, 0xFF, 0xFA, 0x73, 0xAF, 0xFF, 0xFA, 0x73, 0xFF, 0xFF, 0xCA, 0x72,
+    0xAF, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xA7, 0x2F, 0xC7, 0x9F, 0xA7, 0x19, 0xFA, 0x79, 0xFF, 0xFD,
+    0x0F, 0xC7, 0x09, 0xFF, 0xFD, 0x9F, 0xC7, 0x09, 0xFF, 0xFF, 0xE9, 0x70, 0x9F, 0xFF, 0xD0, 0x77,
+    0x72, 0x9A, 0xFE, 0xA9, 0x7F, 0xFF, 0xC4, 0x9F, 0xFF, 0xD3, 0x9F, 0xFF, 0xDA, 0x3F, 0xE9, 0x29,
+    0xAD, 0x3A, 0xFC, 0x97, 0x93, 0xFC, 0xA7, 0x4A, 0xFC, 0x75, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC,
+    0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97, 0x5F, 0xCA, 0x75, 0xAF, 0xC7, 0x59, 0xFC,
+    0x97, 0x5F, 0xD7, 0x5A, 0xFD, 0xA4, 0x9A, 0xC9, 0x3F, 0xFF, 0xE9, 0x4F, 0xFF, 0xD9, 0x5A, 0xFF,
+    0xF9, 0x69, 0xAF, 0xFC, 0x97, 0x29, 0xDA, 0x97, 0x6A, 0xDA, 0x77, 0xAF, 0xA7, 0x7F, 0x77, 0xAE,
+    0x73, 0x9C, 0xAF, 0xC7, 0x39, 0xFD, 0x97, 0x4F, 0xA9, 0x50, 0x0A, 0xAA, 0xAA, 0x97, 0x9F, 0xC9,
+    0x79, 0xFC, 0x71, 0xFC, 0x71, 0xAE, 0xA7, 0x19, 0xE9, 0x77, 0x76, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x69, 0xAA, 0xAA, 0xA6, 0x9F,
+    0xC9, 0x6F, 0xC7, 0xFC, 0x7F, 0xA7, 0x9E, 0x97, 0x77, 0x71, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x39, 0xAA, 0xAA, 0x96, 0x9F, 0xD6,
+    0xFF, 0x4F, 0x9A, 0xF2, 0xF9, 0x1A, 0xEA, 0x0A, 0xDA, 0x49, 0xE9, 0x77, 0x73, 0xFF, 0xFC, 0xAF,
+    0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF,
+    0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x76, 0x9E, 0x3E,
+    0x91, 0xFA, 0x1A, 0xF1, 0xFA, 0x1A, 0xF1, 0x9E, 0x29, 0xE9, 0x39, 0x59, 0x77, 0x76, 0xFF, 0xFC,
+    0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+    0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70,
+    0xFC, 0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x9A, 0xAA,
+    0xAA, 0x6F, 0xCA, 0x6A, 0xF9, 0x6A, 0xF9, 0x69, 0xF7, 0x0A, 0xDA, 0x77, 0x72, 0xAF, 0xFC, 0xA0,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x9A, 0xFE, 0xA4, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6,
+    0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC4, 0xAF,
+    0xEA, 0x1F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x5A, 0xAA, 0xAA, 0x5F, 0xCA, 0x4A, 0xFA, 0x49, 0xF9,
+    0x49, 0xF6, 0xEA, 0x77, 0x75, 0xAF, 0xFC, 0xA0, 0xFF, 0xE0, 0xFF, 0xE0, 0x9A, 0xFE, 0xA4, 0xFC,
+    0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F,
+    0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC4, 0xAF, 0xEA, 0x1F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x00,
+    0x4A, 0xAA, 0xAA, 0x70, 0xFD, 0xA6, 0xAF, 0xE9, 0x4A, 0xF9, 0xF9, 0x29, 0xEA, 0x2F, 0x91, 0xE9,
+    0x4A, 0xE7, 0x77, 0x70, 0xAF, 0xFC, 0xA3, 0xFF, 0xE3, 0xFF, 0xE3, 0x9A, 0xFE, 0xA7, 0xFC, 0x71,
+    0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71,
+    0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x7A, 0xFE, 0xA4,
+    0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE1, 0x75, 0xAD, 0x92, 0xAD, 0xA0, 0x9F, 0x2F, 0x99, 0xF2, 0xF9,
+    0x0E, 0xA2, 0xF2, 0x97, 0x77, 0x74, 0xAF, 0xFC, 0xA1, 0xFF, 0xE1, 0xFF, 0xE1, 0x9A, 0xFE, 0xA5,
+    0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC,
+    0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC5, 0xAF, 0xEA, 0x2F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE,
+    0x00, 0x2F, 0xFC, 0xAA, 0x97, 0x2F, 0xFF, 0xCA, 0x97, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xA5, 0xFC,
+    0x99, 0x99, 0xAF, 0xEA, 0x4F, 0xC5, 0x9F, 0xD4, 0xFC, 0x69, 0xFC, 0xA3, 0xFC, 0x7A, 0xFC, 0x3F,
+    0xC7, 0x0F, 0xC9, 0x2F, 0xC7, 0x0F, 0xC9, 0x9F, 0xFE, 0x93, 0xFC, 0xA9, 0xFF, 0xE9, 0x3F, 0xCA,
+    0x9F, 0xFE, 0x93, 0xFC, 0xA9, 0xFF, 0xE9, 0x3F, 0xCA, 0x09, 0x9F, 0xC9, 0x99, 0x94, 0xFC, 0x92,
+    0xFC, 0x70, 0xFC, 0x3F, 0xC7, 0xAF, 0xC3, 0xFC, 0x69, 0xFC, 0xA3, 0xFC, 0x59, 0xFD, 0x4F, 0xC2,
+    0x99, 0xFE, 0x94, 0xFF, 0xFF, 0xA5, 0xFF, 0xFE, 0xA6, 0xFF, 0xFC, 0xA7, 0x0F, 0xFD, 0xA9, 0x70,
+    0x77, 0x73, 0xFA, 0x29, 0xD9, 0x70, 0xFE, 0xAA, 0xE7, 0x0A, 0xFF, 0xEA, 0x70, 0xE1, 0xAF, 0xD7,
+    0x1D, 0x93, 0x9C, 0xA9, 0x77, 0x77, 0x77, 0x2F, 0xD9, 0x70, 0x9F, 0x0F, 0xE7, 0x09, 0xF0, 0xFE,
+    0xA7, 0x9F, 0x0F, 0xF9, 0x69, 0xF0, 0xFF, 0xC6, 0x9F, 0x0F, 0xFC, 0x95, 0x9F, 0x0F, 0xAF, 0xC5,
+    0x9F, 0x0F, 0x9F, 0xCA, 0x49, 0xF0, 0xF9, 0x0F, 0xC4, 0x9F, 0x0F, 0x90, 0xAF, 0xC3, 0x9F, 0x0F,
+    0x91, 0xFC, 0x92, 0x9F, 0x0F, 0x91, 0xAF, 0xC2, 0x9F, 0x0F, 0x92, 0xFC, 0x91, 0x9F, 0x0F, 0xA2,
+    0x9F, 0xC1, 0x9F, 0x0F, 0xA3, 0xFC, 0xA0, 0x9F, 0x0F, 0xA4, 0xFC, 0x09, 0xF0, 0xFA, 0x4A, 0xFC,
+    0x9F, 0x0F, 0xA5, 0xFC, 0xAF, 0x0F, 0xA5, 0x9F, 0xFC, 0x0F, 0xA6, 0xFF, 0xC0, 0xFA, 0x69, 0xFF,
+    0x0F, 0xA7, 0xAF, 0xE0, 0xFA, 0x70, 0xFE, 0x0F, 0xA7, 0x0A, 0xFD, 0x00, 0x69, 0xAA, 0xAA, 0x97,
+    0x71, 0x9F, 0xC9, 0x77, 0x2F, 0xC7, 0x73, 0xFC, 0x77, 0x3A, 0xF7, 0x73, 0x9E, 0x97, 0x77, 0x77,
+    0x77, 0x59, 0xAF, 0xEA, 0x73, 0x9F, 0xFF, 0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xC4, 0x9F,
+    0xDA, 0x92, 0x9F, 0xDA, 0x3F, 0xD9, 0x6F, 0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1, 0xAF, 0xC7, 0x1A,
+    0xFC, 0x1F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC,
+    0x73, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90,
+    0xFC, 0xA7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1A, 0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA, 0x2F, 0xD7, 0xAF,
+    0xC9, 0x29, 0xFD, 0xA3, 0x9F, 0xE4, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xC7, 0x3A,
+    0xFF, 0xA9, 0x77, 0x09, 0x99, 0x71, 0x74, 0x9A, 0xAA, 0xAA, 0x77, 0x09, 0xFC, 0x97, 0x70, 0xFC,
+    0x77, 0x1F, 0xC7, 0x71, 0xFA, 0x77, 0x19, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x73,
+    0x9F, 0xFF, 0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xC4, 0x9F, 0xDA, 0x92, 0x9F, 0xDA, 0x3F,
+    0xD9, 0x6F, 0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1, 0xAF, 0xC7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0x9F,
+    0xC1, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x73,
+    0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0xA7, 0x2F, 0xC1, 0xAF,
+    0xC7, 0x1A, 0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA, 0x2F, 0xD7, 0xAF, 0xC9, 0x29, 0xFD, 0xA3, 0x9F,
+    0xE4, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xC7, 0x3A, 0xFF, 0xA9, 0x77, 0x09, 0x99,
+    0x71, 0x70, 0x9A, 0xAA, 0xA9, 0x77, 0x1F, 0xD9, 0x77, 0xFF, 0x97, 0x5A, 0xEA, 0x9F, 0x74, 0xAE,
+    0xA1, 0x9F, 0x72, 0x9E, 0x94, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xEA, 0x73, 0x9F, 0xFF,
+    0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xC4, 0x9F, 0xDA, 0x92, 0x9F, 0xDA, 0x3F, 0xD9, 0x6F,
+    0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1, 0xAF, 0xC7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC,
+    0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90,
+    0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0xA7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1A,
+    0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA, 0x2F, 0xD7, 0xAF, 0xC9, 0x29, 0xFD, 0xA3, 0x9F, 0xE4, 0xFF,
+    0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xC7, 0x3A, 0xFF, 0xA9, 0x77, 0x09, 0x99, 0x71, 0x77,
+    0x76, 0x9F, 0x92, 0xAD, 0x72, 0x9F, 0xEA, 0xAE, 0x72, 0xFF, 0xF9, 0x72, 0xE0, 0x9A, 0xFC, 0xA7,
+    0x29, 0xD4, 0xAC, 0xA9, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF,
+    0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC,
+    0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC,
+    0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72,
+    0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F,
+    0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F,
+    0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0x77, 0x76, 0xE9,
+    0x2E, 0x97, 0x3A, 0xF1, 0x9F, 0x73, 0xAF, 0x19, 0xF7, 0x39, 0xE9, 0x2E, 0xA7, 0x59, 0x59, 0x77,
+    0x77, 0x77, 0x76, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC,
+    0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC,
+    0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9,
+    0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F,
+    0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD,
+    0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC,
+    0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0x77, 0x0C, 0x96, 0x9C, 0x2E, 0x94, 0x9E, 0x0A,
+    0xF9, 0x29, 0xFA, 0x0A, 0xF9, 0x09, 0xFA, 0x2A, 0xFA, 0xFA, 0x4A, 0xFE, 0xA6, 0xAF, 0xCA, 0x79,
+    0xFC, 0x96, 0x9F, 0xE9, 0x49, 0xFF, 0xC9, 0x29, 0xFA, 0x0A, 0xF1, 0x9F, 0xA2, 0xAF, 0x09, 0xEA,
+    0x4A, 0xEA, 0x0A, 0xCA, 0x6A, 0xCA, 0x29, 0x70, 0x91, 0x77, 0x77, 0x72, 0xC7, 0x29, 0xAF, 0xEA,
+    0x0E, 0x96, 0x9F, 0xFF, 0xE6, 0xAF, 0xFF, 0xEA, 0x5A, 0xFF, 0xFF, 0xC4, 0x9F, 0xDA, 0x92, 0x9F,
+    0xDA, 0x3F, 0xD9, 0x5F, 0xE2, 0x9F, 0xC9, 0x5F, 0xFA, 0x1A, 0xFC, 0x5A, 0xFF, 0xC1, 0xFC, 0xA5,
+    0xEA, 0x9F, 0xC1, 0xFC, 0x94, 0xF1, 0xFC, 0x90, 0xFC, 0x93, 0xAE, 0x2F, 0xC9, 0x0F, 0xC4, 0xEA,
+    0x2F, 0xC9, 0x0F, 0xC3, 0xF3, 0xFC, 0x90, 0xFC, 0x91, 0xAE, 0x4F, 0xC9, 0x0F, 0xC9, 0x1E, 0xA4,
+    0xFC, 0x90, 0xFC, 0xA0, 0xF5, 0xFC, 0x1A, 0xFC, 0xAE, 0x5A, 0xFC, 0x19, 0xFF, 0xA5, 0xFC, 0xA2,
+    0xFF, 0x5A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x5A, 0xFF,
+    0xFE, 0x7E, 0xAA, 0xFF, 0xA9, 0x70, 0x9D, 0x49, 0x99, 0x77, 0x77, 0x10, 0x39, 0xAA, 0xAA, 0xA7,
+    0x7A, 0xFC, 0x77, 0xAF, 0xA7, 0x79, 0xF9, 0x77, 0x9F, 0x77, 0x1A, 0xDA, 0x77, 0x77, 0x77, 0x1F,
+    0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC, 0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2,
+    0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99, 0x70, 0x72,
+    0xAA, 0xAA, 0xA9, 0x75, 0xFC, 0xA7, 0x5A, 0xFA, 0x75, 0x9F, 0x97, 0x6F, 0x97, 0x6A, 0xDA, 0x77,
+    0x77, 0x77, 0x4F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC, 0xA6, 0xAF, 0xC1, 0x9F, 0xCA,
+    0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0x70, 0x9F, 0xFC, 0x97, 0x59,
+    0x99, 0x70, 0x7A, 0xAA, 0xAA, 0x76, 0xFD, 0xA7, 0x4A, 0xFE, 0xA7, 0x29, 0xF9, 0xF9, 0x70, 0x9F,
+    0x2F, 0x97, 0xEA, 0x4A, 0xE7, 0x77, 0x77, 0x6F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC,
+    0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC,
+    0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99, 0x70, 0x77, 0x71, 0xAD, 0xA2, 0xAD, 0xA7, 0x09, 0xF2, 0xF9,
+    0x79, 0xF2, 0xF9, 0x70, 0xF2, 0xAE, 0x72, 0x96, 0x97, 0x77, 0x77, 0x70, 0xFA, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x90,
+    0xFC, 0x97, 0xFC, 0x1F, 0xCA, 0x6A, 0xFC, 0x19, 0xFC, 0xA4, 0xAF, 0xCA, 0x2F, 0xFF, 0xFC, 0x4F,
+    0xFF, 0xE9, 0x5F, 0xFF, 0xC7, 0x09, 0xFF, 0xC9, 0x75, 0x99, 0x97, 0x00, 0x72, 0x9A, 0xAA, 0xAA,
+    0x76, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xAF, 0x76, 0xAE, 0xA7, 0x7E, 0x97, 0x77, 0x77, 0x72, 0xAF,
+    0xA7, 0x0A, 0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC, 0xA2, 0xFC, 0x59, 0xFC, 0x3A, 0xFA,
+    0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96, 0xFC, 0x19, 0xFC, 0x7A, 0xFA, 0x0A,
+    0xF9, 0x70, 0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF, 0xC7, 0x39, 0xFE, 0x75, 0xFD, 0xA7,
+    0x59, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x70, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFF, 0xEA, 0x93,
+    0xFF, 0xFC, 0xA2, 0xFF, 0xFE, 0x1F, 0xFF, 0xEA, 0x0F, 0xC3, 0x9F, 0xD0, 0xFC, 0x5F, 0xC0, 0xFC,
+    0x5F, 0xC9, 0xFC, 0x5A, 0xF9, 0xFC, 0x5F, 0xC9, 0xFC, 0x5F, 0xC0, 0xFC, 0x39, 0xFD, 0x0F, 0xFF,
+    0xE9, 0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0xA2, 0xFF, 0xEA, 0x93, 0xFC, 0x97, 0x2F, 0xC7, 0x3F, 0xC7,
+    0x3F, 0xC7, 0x3F, 0xC7, 0x30, 0x69, 0x99, 0x99, 0x74, 0xAF, 0xFC, 0xA7, 0x9F, 0xFF, 0xC9, 0x49,
+    0xFF, 0xFE, 0x93, 0xFE, 0xA9, 0xAF, 0xE2, 0x9F, 0xC9, 0x4A, 0xFC, 0x2A, 0xFA, 0x6F, 0xC2, 0xAF,
+    0x96, 0xFC, 0x2A, 0xF9, 0x5F, 0xC9, 0x2A, 0xF9, 0x4F, 0xCA, 0x3A, 0xF9, 0x29, 0xFC, 0xA4, 0xAF,
+    0x92, 0xFC, 0x95, 0xAF, 0x91, 0xAF, 0xA6, 0xAF, 0x91, 0xAF, 0xC6, 0xAF, 0x91, 0x9F, 0xDA, 0x4A,
+    0xF9, 0x2A, 0xFE, 0x3A, 0xF9, 0x3A, 0xFE, 0x91, 0xAF, 0x94, 0x9F, 0xE9, 0x0A, 0xF9, 0x6A, 0xFD,
+    0x0A, 0xF9, 0x79, 0xFC, 0x0A, 0xF9, 0x70, 0xFC, 0x9A, 0xF9, 0x70, 0xFC, 0x0A, 0xF9, 0x1D, 0xA9,
+    0x99, 0xFD, 0x0A, 0xF9, 0x1F, 0xFE, 0xA0, 0xAF, 0x91, 0xFF, 0xE1, 0xAF, 0x91, 0xAF, 0xF9, 0x75,
+    0x99, 0x99, 0x50, 0x3A, 0xAA, 0xAA, 0x97, 0x29, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4A, 0xEA,
+    0x74, 0x9E, 0x77, 0x72, 0x99, 0x9A, 0x99, 0x79, 0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD,
+    0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F, 0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9,
+    0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF,
+    0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99, 0x71, 0x71, 0xAA, 0xAA, 0xA9, 0x71, 0xAF, 0xC7,
+    0x19, 0xFC, 0x72, 0xFA, 0x72, 0xF9, 0x72, 0xAE, 0x77, 0x75, 0x99, 0x9A, 0x99, 0x79, 0xFF, 0xD4,
+    0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99,
+    0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F, 0xC9, 0x39,
+    0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA, 0x99, 0xAF,
+    0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99, 0x71, 0x59,
+    0xAA, 0xAA, 0x97, 0x19, 0xFD, 0x97, 0x0F, 0xF7, 0xFA, 0xAF, 0x5F, 0x91, 0x9F, 0x39, 0xE5, 0xE9,
+    0x77, 0x79, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF,
+    0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA,
+    0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA,
+    0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x77, 0x49, 0xF9, 0x2E, 0x39, 0xFE, 0xAA, 0xDA, 0x3F,
+    0xFF, 0x39, 0xDA, 0x09, 0xAF, 0xC9, 0x39, 0xD4, 0xAC, 0xA9, 0x77, 0x71, 0x99, 0x9A, 0x99, 0x79,
+    0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F,
+    0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F,
+    0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA,
+    0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99,
+    0x71, 0x77, 0x39, 0xE3, 0xE9, 0x4F, 0xA1, 0xAF, 0x4F, 0xA1, 0xAF, 0x49, 0xE9, 0x19, 0xE9, 0x69,
+    0x59, 0x77, 0x72, 0x99, 0x9A, 0x99, 0x79, 0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99,
+    0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF,
+    0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F, 0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A,
+    0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0,
+    0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99, 0x71, 0x59, 0xAD, 0xA7, 0x29, 0xFD, 0x97, 0x0E, 0x9A,
+    0xE7, 0x0D, 0x91, 0xAD, 0x70, 0xD9, 0x1A, 0xD7, 0x0E, 0xAA, 0xE7, 0x09, 0xFD, 0x73, 0xAD, 0xA7,
+    0x77, 0x49, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF,
+    0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA,
+    0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA,
+    0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x59, 0x9A, 0xA9, 0x69, 0x9A, 0x99, 0x70, 0xAF, 0xFC,
+    0x91, 0xFF, 0x95, 0xAF, 0xFE, 0xAF, 0xFE, 0x5F, 0xFF, 0xFF, 0xEA, 0x4A, 0xCA, 0x92, 0xAF, 0xE9,
+    0x19, 0xFC, 0x97, 0x3F, 0xD5, 0xFA, 0x73, 0xAF, 0xA5, 0xAF, 0x71, 0x99, 0xFC, 0xA5, 0xAF, 0x39,
+    0xAF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xD1, 0xFE, 0xAA, 0xAF, 0xFF, 0xFC, 0x09, 0xFC, 0x93,
+    0xAF, 0x97, 0x3A, 0xFA, 0x4A, 0xFA, 0x73, 0xAF, 0xA4, 0xFD, 0x73, 0xAF, 0xA3, 0x9F, 0xDA, 0x7A,
+    0x19, 0xFC, 0xA9, 0x9A, 0xFF, 0xCA, 0x99, 0x9A, 0xE2, 0xFF, 0xF9, 0xFF, 0xFC, 0x29, 0xFF, 0xD2,
+    0xFF, 0xF4, 0xFE, 0xA4, 0x9F, 0xFA, 0x96, 0x99, 0x97, 0x29, 0x99, 0x95, 0x69, 0x9A, 0xA9, 0x79,
+    0xAF, 0xFA, 0x3A, 0xFF, 0xE2, 0xAF, 0xFE, 0xA2, 0xFD, 0xAA, 0xAA, 0xD2, 0xAF, 0xC5, 0x92, 0xFC,
+    0x97, 0x1F, 0xC7, 0x19, 0xFC, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC9, 0x71, 0xAF, 0xC9, 0x4A, 0xA2, 0xFE, 0xAF, 0xC2, 0xAF, 0xFF, 0x3A, 0xFF, 0xE5, 0xAF, 0xEA,
+    0x70, 0xAD, 0x97, 0x3E, 0x97, 0x29, 0xFC, 0x73, 0x9E, 0xA7, 0x3E, 0xA7, 0xAF, 0xDA, 0x7F, 0xE7,
+    0x0A, 0xFA, 0x40, 0x3A, 0xAA, 0xAA, 0x97, 0x39, 0xFC, 0x74, 0x9F, 0xC7, 0x5F, 0xC7, 0x5A, 0xEA,
+    0x75, 0x9E, 0x77, 0x75, 0x9A, 0xA9, 0x97, 0x19, 0xFF, 0xA6, 0xAF, 0xFE, 0x4A, 0xFF, 0xFC, 0x3F,
+    0xCA, 0x2F, 0xC9, 0x1A, 0xFA, 0x4F, 0xC1, 0xFC, 0x59, 0xF1, 0xFC, 0x59, 0xF9, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x93,
+    0xFD, 0xA9, 0x99, 0xAE, 0x92, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xC9, 0x72, 0x99,
+    0x95, 0x71, 0xAA, 0xAA, 0xA9, 0x72, 0xAF, 0xC7, 0x29, 0xFC, 0x73, 0xFA, 0x73, 0xF9, 0x73, 0xAE,
+    0x77, 0x77, 0x09, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2,
+    0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF,
+    0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA,
+    0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x50,
+    0x59, 0xAA, 0xAA, 0x97, 0x29, 0xFD, 0x97, 0x1F, 0xF7, 0x0F, 0xAA, 0xF6, 0xF9, 0x19, 0xF4, 0x9E,
+    0x5E, 0x97, 0x77, 0x29, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC,
+    0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99,
+    0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F,
+    0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99,
+    0x50, 0x77, 0x49, 0xE3, 0xE9, 0x5F, 0xA1, 0xAF, 0x5F, 0xA1, 0xAF, 0x59, 0xE9, 0x19, 0xE9, 0x79,
+    0x59, 0x77, 0x75, 0x9A, 0xA9, 0x97, 0x19, 0xFF, 0xA6, 0xAF, 0xFE, 0x4A, 0xFF, 0xFC, 0x3F, 0xCA,
+    0x2F, 0xC9, 0x1A, 0xFA, 0x4F, 0xC1, 0xFC, 0x59, 0xF1, 0xFC, 0x59, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F,
+    0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x93, 0xFD,
+    0xA9, 0x99, 0xAE, 0x92, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xC9, 0x72, 0x99, 0x95,
+    0x0A, 0xAA, 0xAA, 0x94, 0x9F, 0xC5, 0x9F, 0xC6, 0xFC, 0x6A, 0xEA, 0x69, 0xE7, 0x77, 0x1A, 0xFA,
+    0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA,
+    0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA, 0x4A, 0xFA,
+    0x4A, 0xFA, 0x10, 0x3A, 0xAA, 0xAA, 0x92, 0xAF, 0xC2, 0x9F, 0xC3, 0xFA, 0x3F, 0x93, 0xAE, 0x77,
+    0x71, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF,
+    0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0xAF,
+    0xA3, 0xAF, 0xA3, 0xAF, 0xA3, 0x39, 0xAA, 0xAA, 0x96, 0x9F, 0xD9, 0x5F, 0xF4, 0xFA, 0xAF, 0x2F,
+    0x91, 0x9F, 0x09, 0xE5, 0xE9, 0x77, 0x77, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF,
+    0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF,
+    0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA3, 0x73, 0x9E, 0x3E, 0x9F, 0xA1,
+    0xAF, 0xFA, 0x1A, 0xF9, 0xE9, 0x19, 0xE9, 0x19, 0x59, 0x77, 0x74, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF,
+    0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF,
+    0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0xAF, 0xA2, 0x59,
+    0x77, 0x1D, 0xA2, 0x9D, 0x70, 0xAF, 0xAA, 0xEA, 0x79, 0xFF, 0xC9, 0x71, 0xAF, 0xCA, 0x72, 0xAF,
+    0xE7, 0x1F, 0xFD, 0x70, 0x9D, 0xA0, 0x9F, 0xA7, 0x0A, 0x92, 0xAF, 0x97, 0x5F, 0xC5, 0x9A, 0xFC,
+    0xA9, 0xF4, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xFE, 0x19, 0xFD, 0xAA, 0xAF, 0xE1, 0xFC, 0xA4, 0xFD,
+    0x1F, 0xC5, 0x9F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFC,
+    0x6F, 0xC1, 0xFC, 0x59, 0xFA, 0x1F, 0xCA, 0x4F, 0xC9, 0x19, 0xFD, 0x99, 0x9F, 0xD3, 0xAF, 0xFF,
+    0xC5, 0xAF, 0xFE, 0x70, 0xAF, 0xE9, 0x74, 0x99, 0x97, 0x77, 0x5A, 0xEA, 0x3D, 0xA4, 0xAF, 0xEA,
+    0xE9, 0x4F, 0xFF, 0x4A, 0xD9, 0x09, 0xFD, 0x94, 0xAC, 0xA3, 0x9A, 0xCA, 0x77, 0x77, 0x9A, 0xA9,
+    0x4A, 0xEA, 0x1F, 0xEA, 0x2A, 0xF0, 0xFF, 0xD1, 0xAF, 0xFF, 0xEA, 0x0A, 0xFE, 0xA9, 0xAF, 0xD0,
+    0xAF, 0xCA, 0x39, 0xFC, 0x0A, 0xFC, 0x5F, 0xC9, 0xAF, 0xC5, 0xFC, 0x9A, 0xFA, 0x5A, 0xF9, 0xAF,
+    0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF,
+    0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9,
+    0x5A, 0xF9, 0x39, 0xAA, 0xAA, 0xA7, 0x5F, 0xCA, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0x9F, 0x77,
+    0xAD, 0xA7, 0x77, 0x69, 0x9A, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFF, 0xFC, 0x93,
+    0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91, 0xFC, 0x59, 0xFC, 0x1F, 0xC6, 0xFC, 0x09, 0xFC,
+    0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x1F, 0xC6, 0xFC, 0x1F,
+    0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F, 0xDA, 0xAA, 0xFD, 0x39, 0xFF, 0xFC, 0x59, 0xFF,
+    0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x71, 0x9A, 0xAA, 0xAA, 0x74, 0xFC, 0x97, 0x3F, 0xC9,
+    0x73, 0xAF, 0x74, 0xAE, 0xA7, 0x5E, 0x97, 0x77, 0x71, 0x99, 0xA9, 0x97, 0x29, 0xFF, 0xA7, 0xAF,
+    0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A, 0xFC, 0x4F, 0xC9, 0x1F, 0xC5, 0x9F,
+    0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFC,
+    0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD, 0xAA, 0xAF,
+    0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x6A, 0xAA, 0xAA, 0x74,
+    0xFD, 0xA7, 0x2A, 0xFE, 0xA7, 0x0A, 0xF9, 0xF9, 0x69, 0xF2, 0xF9, 0x5E, 0xA4, 0xAE, 0x77, 0x74,
+    0x99, 0xA9, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD,
+    0x2A, 0xFC, 0x4F, 0xC9, 0x1F, 0xC5, 0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA,
+    0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1,
+    0xAF, 0xC4, 0xFC, 0x92, 0xFD, 0xAA, 0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA,
+    0x74, 0x99, 0x97, 0x77, 0x7F, 0xA2, 0x9D, 0x95, 0xFE, 0xAA, 0xE5, 0xAF, 0xFE, 0xA5, 0xE1, 0xAF,
+    0xD6, 0xD9, 0x39, 0xCA, 0x97, 0x77, 0x69, 0x9A, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFC, 0x93, 0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91, 0xFC, 0x59, 0xFC, 0x1F, 0xC6,
+    0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x1F,
+    0xC6, 0xFC, 0x1F, 0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F, 0xDA, 0xAA, 0xFD, 0x39, 0xFF,
+    0xFC, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x6A, 0xD9, 0x2A, 0xDA, 0x69,
+    0xF2, 0xF6, 0x9F, 0x2F, 0x96, 0xEA, 0x2F, 0x70, 0x97, 0x77, 0x76, 0x99, 0xA9, 0x97, 0x29, 0xFF,
+    0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A, 0xFC, 0x4F, 0xC9, 0x1F,
+    0xC5, 0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC,
+    0x09, 0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD,
+    0xAA, 0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x6A, 0xCA,
+    0x74, 0xAE, 0xA7, 0x3F, 0xC7, 0x3A, 0xEA, 0x74, 0xE7, 0x77, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xA7, 0x77, 0x9A, 0x97, 0x49,
+    0xE9, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0x9E, 0x97, 0x59, 0x70, 0x77, 0x71, 0x99, 0xA9, 0x91,
+    0xC7, 0x9F, 0xFE, 0x94, 0xAF, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0x9F, 0xDA, 0x9A, 0xFD, 0x2F, 0xCA,
+    0x29, 0xFD, 0x91, 0xFC, 0x3F, 0xEA, 0x09, 0xFC, 0x2F, 0xFC, 0x09, 0xFA, 0x19, 0xE9, 0xFC, 0x09,
+    0xFA, 0x1E, 0xA0, 0xFC, 0x09, 0xFA, 0x0F, 0x1F, 0xC0, 0x9F, 0xA9, 0xE2, 0xFC, 0x1F, 0xFA, 0x2F,
+    0xC1, 0xFF, 0x2A, 0xFA, 0x1A, 0xFD, 0x29, 0xFC, 0x92, 0xFD, 0xAA, 0xFE, 0x39, 0xFF, 0xFC, 0x49,
+    0xFF, 0xF5, 0xFF, 0xE9, 0x7A, 0xC2, 0x99, 0x97, 0x77, 0x20, 0x3A, 0xAA, 0xAA, 0x97, 0x3A, 0xFC,
+    0x74, 0x9F, 0xC7, 0x49, 0xFA, 0x75, 0xF9, 0x75, 0xAE, 0x77, 0x77, 0x70, 0xAF, 0x95, 0xFC, 0x0A,
+    0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF, 0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE,
+    0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF, 0xD9, 0x1F, 0x69, 0x97, 0x10, 0x71, 0xAA,
+    0xAA, 0xA9, 0x72, 0xAF, 0xC7, 0x2A, 0xFA, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3A, 0xDA, 0x77, 0x77,
+    0x73, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF, 0xC0, 0xAF,
+    0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF, 0xD9, 0x1F,
+    0x69, 0x97, 0x10, 0x59, 0xAA, 0xAA, 0x97, 0x29, 0xFD, 0x71, 0x9F, 0xF7, 0x0F, 0x9A, 0xEA, 0x6F,
+    0x91, 0xAE, 0xA4, 0xAD, 0xA4, 0x9E, 0x97, 0x77, 0x75, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0,
+    0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95,
+    0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A,
+    0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF, 0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF,
+    0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF, 0xD9, 0x1F, 0x69, 0x97, 0x10, 0x77, 0x49, 0xE2, 0x9E, 0x6F,
+    0x91, 0xFA, 0x5F, 0x91, 0xFA, 0x5A, 0xE2, 0x9E, 0x97, 0x95, 0x97, 0x77, 0x77, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xFA, 0x4A, 0xFC, 0x0A, 0xFC, 0x92, 0x9F, 0xD0,
+    0x9F, 0xEA, 0xFF, 0x1F, 0xFF, 0xF2, 0xFF, 0xCA, 0x0F, 0x3A, 0xFD, 0x91, 0xF6, 0x99, 0x71, 0x71,
+    0x9A, 0xAA, 0xAA, 0x75, 0xFC, 0xA7, 0x4F, 0xC9, 0x74, 0xAF, 0x97, 0x49, 0xF7, 0x6E, 0xA7, 0x77,
+    0x77, 0x70, 0xAF, 0xA6, 0x9F, 0xC0, 0x9F, 0xC6, 0xAF, 0x91, 0xFC, 0x6F, 0xC2, 0xAF, 0xA4, 0x9F,
+    0xA3, 0xFC, 0x4A, 0xF9, 0x3A, 0xF4, 0xFC, 0x49, 0xFA, 0x29, 0xFA, 0x5F, 0xC2, 0xAF, 0x6A, 0xF2,
+    0xFC, 0x7F, 0xA0, 0x9F, 0x97, 0xAF, 0x0A, 0xF7, 0x09, 0xF0, 0xFA, 0x71, 0xFA, 0xF9, 0x71, 0xAF,
+    0xF7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x49, 0xFD, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x59, 0xFA, 0x75,
+    0xFC, 0x74, 0x9F, 0xD7, 0x1F, 0xFC, 0x72, 0xFF, 0xA7, 0x2F, 0xE9, 0x73, 0xAF, 0xA7, 0x40, 0x09,
+    0x99, 0x97, 0x4A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF,
+    0x97, 0x3A, 0xF9, 0x29, 0xA9, 0x94, 0xAF, 0x90, 0xFE, 0x3A, 0xF9, 0xFF, 0xC9, 0x1A, 0xFF, 0xFE,
+    0x1A, 0xFD, 0xAA, 0xAF, 0xDA, 0x0A, 0xFC, 0x93, 0xAF, 0xC0, 0xAF, 0xC5, 0xFC, 0x0A, 0xFA, 0x5F,
+    0xC9, 0xAF, 0xA5, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xFA, 0x5A, 0xF9, 0xAF,
+    0xA5, 0xFC, 0x9A, 0xFC, 0x5F, 0xC0, 0xAF, 0xCA, 0x3F, 0xD0, 0xAF, 0xFF, 0xE9, 0x0A, 0xFF, 0xFE,
+    0x1A, 0xF9, 0xFF, 0xC2, 0xAF, 0x90, 0xAF, 0xCA, 0x3A, 0xF9, 0x29, 0x99, 0x5A, 0xF9, 0x73, 0xAF,
+    0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0x77, 0x7A,
+    0xDA, 0x2A, 0xDA, 0x79, 0xF2, 0xF9, 0x69, 0xF2, 0xF9, 0x7F, 0x2A, 0xE7, 0x19, 0x69, 0x77, 0x77,
+    0x75, 0xAF, 0xA6, 0x9F, 0xC0, 0x9F, 0xC6, 0xAF, 0x91, 0xFC, 0x6F, 0xC2, 0xAF, 0xA4, 0x9F, 0xA3,
+    0xFC, 0x4A, 0xF9, 0x3A, 0xF4, 0xFC, 0x49, 0xFA, 0x29, 0xFA, 0x5F, 0xC2, 0xAF, 0x6A, 0xF2, 0xFC,
+    0x7F, 0xA0, 0x9F, 0x97, 0xAF, 0x0A, 0xF7, 0x09, 0xF0, 0xFA, 0x71, 0xFA, 0xF9, 0x71, 0xAF, 0xF7,
+    0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x49, 0xFD, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x59, 0xFA, 0x75, 0xFC,
+    0x74, 0x9F, 0xD7, 0x1F, 0xFC, 0x72, 0xFF, 0xA7, 0x2F, 0xE9, 0x73, 0xAF, 0xA7, 0x40, 0x59, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x74, 0xFF, 0xE7, 0x4F, 0xFE, 0x74, 0xFF, 0xE7, 0x77, 0x77, 0x77, 0x6A,
+    0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7,
+    0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F,
+    0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF,
+    0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99,
+    0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09,
+    0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x29, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x94, 0xAF, 0xFD, 0xA4, 0xAF, 0xFD, 0xA4, 0x9F, 0xFD, 0x97, 0x77, 0x09, 0x99, 0xA9, 0x97,
+    0x9F, 0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29,
+    0xFA, 0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9,
+    0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC,
+    0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49,
+    0x97, 0x10, 0x49, 0xAA, 0x69, 0xAA, 0x72, 0x9D, 0xA4, 0x9E, 0x73, 0xFA, 0xAA, 0xFA, 0x73, 0x9F,
+    0xFD, 0x75, 0x9F, 0xF7, 0x70, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAF, 0xCA, 0x77, 0x0F,
+    0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7,
+    0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70,
+    0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF,
+    0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC,
+    0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7,
+    0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x2A, 0xAA, 0x6A, 0xA9, 0x3E, 0x5A, 0xDA, 0x3A, 0xFA,
+    0xAF, 0xC5, 0xFF, 0xD9, 0x6F, 0xF9, 0x70, 0x9A, 0xDA, 0x97, 0x77, 0x39, 0x99, 0xA9, 0x97, 0x9F,
+    0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA,
+    0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC,
+    0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9,
+    0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97,
+    0x10, 0x7A, 0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF,
+    0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC,
+    0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF,
+    0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC,
+    0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x77, 0x2E, 0x97, 0x72,
+    0xE9, 0x77, 0x29, 0xE7, 0x73, 0xEA, 0x77, 0x3F, 0x99, 0x97, 0x70, 0xAF, 0xCA, 0x77, 0x1F, 0xCA,
+    0x77, 0x29, 0xAA, 0xA9, 0x00, 0x59, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A, 0xFF, 0xF4, 0xFF, 0xFC,
+    0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99, 0xAF, 0xA2, 0x9A, 0xFF,
+    0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA,
+    0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0,
+    0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x94, 0xAD, 0xA7, 0x3A, 0xDA, 0x74, 0xE7,
+    0x4A, 0xE7, 0x4A, 0xE9, 0x99, 0x71, 0x9F, 0xD7, 0x2F, 0xD7, 0x39, 0xAA, 0xA9, 0x73, 0x9A, 0xAA,
+    0xAA, 0x75, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xFC, 0x75, 0xAE, 0xA7, 0x6E, 0x97, 0x77, 0x77, 0x75,
+    0x9A, 0xFE, 0xA9, 0x7F, 0xFF, 0xC4, 0x9F, 0xFF, 0xD3, 0x9F, 0xFF, 0xDA, 0x3F, 0xE9, 0x29, 0xAD,
+    0x3A, 0xFC, 0x97, 0x93, 0xFC, 0xA7, 0x4A, 0xFC, 0x75, 0xFC, 0xA7, 0x5F, 0xC9, 0x75, 0xFC, 0x76,
+    0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97, 0x5F, 0xCA, 0x75, 0xAF, 0xC7, 0x59, 0xFC, 0x97,
+    0x5F, 0xD7, 0x5A, 0xFD, 0xA4, 0x9A, 0xC9, 0x3F, 0xFF, 0xE9, 0x4F, 0xFF, 0xD9, 0x5A, 0xFF, 0xF9,
+    0x69, 0xAF, 0xFC, 0x97, 0x39, 0x99, 0x95, 0x71, 0xAA, 0xAA, 0xA7, 0x1F, 0xCA, 0x70, 0xAF, 0xA7,
+    0x0A, 0xF9, 0x70, 0x9F, 0x72, 0xEA, 0x77, 0x74, 0x99, 0xAA, 0x97, 0x9A, 0xFF, 0xA3, 0xAF, 0xFE,
+    0x2A, 0xFF, 0xEA, 0x2F, 0xDA, 0xAA, 0xAD, 0x2A, 0xFC, 0x59, 0x2F, 0xC9, 0x71, 0xFC, 0x71, 0x9F,
+    0xC7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0x94,
+    0xAA, 0x2F, 0xEA, 0xFC, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE, 0x5A, 0xFE, 0xA7, 0x19, 0x99, 0x40, 0x70,
+    0xAA, 0xAA, 0xA7, 0x5F, 0xDA, 0x73, 0xAF, 0xE9, 0x71, 0xAF, 0x9F, 0x97, 0x9E, 0xA2, 0xF9, 0x6E,
+    0x94, 0xAE, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0xFF, 0xFC, 0x49, 0xFF, 0xFD, 0x39, 0xFF,
+    0xFD, 0xA3, 0xFE, 0x92, 0x9A, 0xD3, 0xAF, 0xC9, 0x79, 0x3F, 0xCA, 0x74, 0xAF, 0xC7, 0x5F, 0xCA,
+    0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC9, 0x75, 0xFC, 0xA7,
+    0x5A, 0xFC, 0x75, 0x9F, 0xC9, 0x75, 0xFD, 0x75, 0xAF, 0xDA, 0x49, 0xAC, 0x93, 0xFF, 0xFE, 0x94,
+    0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0x96, 0x9A, 0xFF, 0xC9, 0x73, 0x99, 0x99, 0x50, 0x5A, 0xAA, 0xAA,
+    0x71, 0xAF, 0xD7, 0x9F, 0xEA, 0x59, 0xF9, 0xFA, 0x4F, 0x2A, 0xEA, 0x2A, 0xDA, 0x49, 0xE7, 0x77,
+    0x99, 0xAA, 0x97, 0x9A, 0xFF, 0xA3, 0xAF, 0xFE, 0x2A, 0xFF, 0xEA, 0x2F, 0xDA, 0xAA, 0xAD, 0x2A,
+    0xFC, 0x59, 0x2F, 0xC9, 0x71, 0xFC, 0x71, 0x9F, 0xC7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC,
+    0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0x94, 0xAA, 0x2F, 0xEA, 0xFC, 0x2A, 0xFF, 0xF3, 0xAF,
+    0xFE, 0x5A, 0xFE, 0xA7, 0x19, 0x99, 0x40, 0x71, 0x99, 0x77, 0x0F, 0xA7, 0x59, 0xFC, 0x75, 0x9F,
+    0xC7, 0x6F, 0xA7, 0x79, 0xA9, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xEA, 0x97, 0xFF, 0xFC, 0x49, 0xFF,
+    0xFD, 0x39, 0xFF, 0xFD, 0xA3, 0xFE, 0x92, 0x9A, 0xD3, 0xAF, 0xC9, 0x79, 0x3F, 0xCA, 0x74, 0xAF,
+    0xC7, 0x5F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC9,
+    0x75, 0xFC, 0xA7, 0x5A, 0xFC, 0x75, 0x9F, 0xC9, 0x75, 0xFD, 0x75, 0xAF, 0xDA, 0x49, 0xAC, 0x93,
+    0xFF, 0xFE, 0x94, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0x96, 0x9A, 0xFF, 0xC9, 0x73, 0x99, 0x99, 0x50,
+    0x79, 0x97, 0x3A, 0xF7, 0x2F, 0xC9, 0x71, 0xFC, 0x97, 0x1A, 0xF7, 0x39, 0xA9, 0x77, 0x74, 0x99,
+    0xAA, 0x97, 0x9A, 0xFF, 0xA3, 0xAF, 0xFE, 0x2A, 0xFF, 0xEA, 0x2F, 0xDA, 0xAA, 0xAD, 0x2A, 0xFC,
+    0x59, 0x2F, 0xC9, 0x71, 0xFC, 0x71, 0x9F, 0xC7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x72,
+    0xFC, 0x72, 0xFC, 0x97, 0x1A, 0xFC, 0x94, 0xAA, 0x2F, 0xEA, 0xFC, 0x2A, 0xFF, 0xF3, 0xAF, 0xFE,
+    0x5A, 0xFE, 0xA7, 0x19, 0x99, 0x40, 0x4A, 0xAA, 0x69, 0xAA, 0x95, 0xAE, 0xA3, 0xF9, 0x6F, 0xA0,
+    0x9F, 0x97, 0x0F, 0xFC, 0x97, 0x2F, 0xEA, 0x73, 0x9F, 0xCA, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xEA,
+    0x97, 0xFF, 0xFC, 0x49, 0xFF, 0xFD, 0x39, 0xFF, 0xFD, 0xA3, 0xFE, 0x92, 0x9A, 0xD3, 0xAF, 0xC9,
+    0x79, 0x3F, 0xCA, 0x74, 0xAF, 0xC7, 0x5F, 0xCA, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x6F,
+    0xC7, 0x6F, 0xC7, 0x6F, 0xC9, 0x75, 0xFC, 0xA7, 0x5A, 0xFC, 0x75, 0x9F, 0xC9, 0x75, 0xFD, 0x75,
+    0xAF, 0xDA, 0x49, 0xAC, 0x93, 0xFF, 0xFE, 0x94, 0xFF, 0xFD, 0x95, 0xAF, 0xFF, 0x96, 0x9A, 0xFF,
+    0xC9, 0x73, 0x99, 0x99, 0x50, 0x1A, 0xAA, 0x95, 0x9A, 0xAA, 0x29, 0xEA, 0x3A, 0xEA, 0x3A, 0xF1,
+    0xFA, 0x5A, 0xFF, 0xA7, 0xFF, 0x71, 0xFD, 0x77, 0x74, 0x99, 0xAA, 0x97, 0x09, 0xAF, 0xFA, 0x4A,
+    0xFF, 0xE3, 0xAF, 0xFE, 0xA3, 0xFD, 0xAA, 0xAA, 0xD3, 0xAF, 0xC5, 0x93, 0xFC, 0x97, 0x2F, 0xC7,
+    0x29, 0xFC, 0x72, 0x9F, 0xA7, 0x29, 0xFA, 0x72, 0x9F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC9, 0x72, 0xAF,
+    0xC9, 0x4A, 0xA3, 0xFE, 0xAF, 0xC3, 0xAF, 0xFF, 0x4A, 0xFF, 0xE6, 0xAF, 0xEA, 0x72, 0x99, 0x95,
+    0x29, 0xAA, 0xA6, 0xAA, 0xA9, 0x6F, 0x92, 0x9F, 0x70, 0xFA, 0x0A, 0xF7, 0x2F, 0xFC, 0x73, 0x9F,
+    0xE9, 0x74, 0xAF, 0xCA, 0x77, 0x77, 0x77, 0x1F, 0xFC, 0xAA, 0x97, 0x0F, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xEA, 0x4F, 0xFF, 0xFC, 0x3F, 0xC9, 0x99, 0x9A, 0xFE, 0xA2, 0xFC, 0x59, 0xFD, 0x2F, 0xC7, 0xFC,
+    0xA1, 0xFC, 0x7A, 0xFC, 0x1F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC7, 0x0F, 0xCA,
+    0x0F, 0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xCA, 0x0F, 0xC7, 0x0F, 0xC9,
+    0x0F, 0xC7, 0x0F, 0xC1, 0xFC, 0x7A, 0xFC, 0x1F, 0xC6, 0x9F, 0xCA, 0x1F, 0xC5, 0x9F, 0xD2, 0xFC,
+    0x29, 0x9F, 0xE9, 0x2F, 0xFF, 0xFA, 0x3F, 0xFF, 0xEA, 0x4F, 0xFF, 0xCA, 0x6F, 0xFD, 0xA9, 0x70,
+    0x74, 0x99, 0x99, 0x29, 0x99, 0x99, 0x73, 0x9F, 0xA1, 0xFA, 0x73, 0x9F, 0xA1, 0xF7, 0x49, 0xFA,
+    0x09, 0xEA, 0x74, 0x9F, 0xA0, 0xAE, 0x75, 0x9F, 0xA0, 0xE9, 0x75, 0x9F, 0xA7, 0x49, 0xA9, 0x91,
+    0x9F, 0xA7, 0x2F, 0xE0, 0x9F, 0xA7, 0x1F, 0xFC, 0x9F, 0xA7, 0x0F, 0xFF, 0xEA, 0x79, 0xFD, 0xAA,
+    0xAF, 0xDA, 0x7F, 0xD3, 0x9F, 0xCA, 0x7F, 0xC9, 0x4A, 0xFA, 0x69, 0xFC, 0x59, 0xFA, 0x69, 0xFC,
+    0x6F, 0xA6, 0x9F, 0xA6, 0xFA, 0x69, 0xFA, 0x6F, 0xA6, 0x9F, 0xC6, 0xFA, 0x69, 0xFC, 0x59, 0xFA,
+    0x7F, 0xC9, 0x4A, 0xFA, 0x7F, 0xD3, 0x9F, 0xCA, 0x79, 0xFE, 0xAF, 0xEA, 0x70, 0xFF, 0xFE, 0xA7,
+    0x1F, 0xFC, 0x0F, 0xA7, 0x2A, 0xFC, 0xA1, 0x9E, 0xA7, 0x49, 0x97, 0x70, 0x2F, 0xFC, 0xAA, 0x97,
+    0x2F, 0xFF, 0xCA, 0x97, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xA5, 0xFC, 0x99, 0x99, 0xAF, 0xEA, 0x4F,
+    0xC5, 0x9F, 0xD4, 0xFC, 0x69, 0xFC, 0xA3, 0xFC, 0x7A, 0xFC, 0x3F, 0xC7, 0x0F, 0xC9, 0x2F, 0xC7,
+    0x0F, 0xC9, 0x9F, 0xFE, 0x93, 0xFC, 0xA9, 0xFF, 0xE9, 0x3F, 0xCA, 0x9F, 0xFE, 0x93, 0xFC, 0xA9,
+    0xFF, 0xE9, 0x3F, 0xCA, 0x09, 0x9F, 0xC9, 0x99, 0x94, 0xFC, 0x92, 0xFC, 0x70, 0xFC, 0x3F, 0xC7,
+    0xAF, 0xC3, 0xFC, 0x69, 0xFC, 0xA3, 0xFC, 0x59, 0xFD, 0x4F, 0xC2, 0x99, 0xFE, 0x94, 0xFF, 0xFF,
+    0xA5, 0xFF, 0xFE, 0xA6, 0xFF, 0xFC, 0xA7, 0x0F, 0xFD, 0xA9, 0x70, 0x74, 0x99, 0x99, 0x77, 0x9F,
+    0xA7, 0x69, 0xFA, 0x71, 0x9A, 0xAA, 0xAF, 0xDA, 0xA7, 0xAF, 0xFF, 0x7A, 0xFF, 0xF7, 0x9A, 0xAA,
+    0xAA, 0xFC, 0xAA, 0x74, 0x9F, 0xA7, 0x09, 0x99, 0x91, 0x9F, 0xA6, 0xFE, 0x09, 0xFA, 0x49, 0xFF,
+    0xC9, 0xFA, 0x4F, 0xFF, 0xEA, 0x3A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xD3, 0x9F, 0xCA, 0x3F, 0xCA,
+    0x4A, 0xFA, 0x29, 0xFC, 0x59, 0xFA, 0x29, 0xFC, 0x6F, 0xA2, 0x9F, 0xC6, 0xFA, 0x29, 0xFC, 0x6F,
+    0xA2, 0x9F, 0xC9, 0x5F, 0xA3, 0xFC, 0xA4, 0xAF, 0xA3, 0xFD, 0x93, 0xFC, 0xA3, 0xAF, 0xEA, 0xFE,
+    0xA4, 0xFF, 0xFE, 0xA5, 0xFF, 0xA0, 0xFA, 0x6A, 0xFC, 0x91, 0xAE, 0xA7, 0x09, 0x97, 0x40, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFD, 0xA1, 0xAF, 0xFD, 0xA1, 0x9F, 0xFD, 0x97, 0x77,
+    0x4F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x90,
+    0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC0,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xA0, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0xAF, 0xFD, 0xA5, 0xAF, 0xFD, 0xA5, 0x9F, 0xFD,
+    0x97, 0x77, 0x39, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2,
+    0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF,
+    0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA,
+    0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x50,
+    0x0A, 0xAA, 0x6A, 0xA9, 0x0E, 0x5A, 0xD9, 0x0A, 0xFA, 0xAF, 0xC2, 0xFF, 0xD9, 0x3F, 0xF9, 0x59,
+    0xAD, 0xA9, 0x77, 0x77, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70,
+    0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0x2A, 0xAA, 0x6A, 0xA9, 0x4E, 0x5A, 0xDA, 0x4A, 0xFA, 0xAF, 0xC6, 0xFF,
+    0xD9, 0x7F, 0xF9, 0x71, 0x9A, 0xDA, 0x97, 0x77, 0x69, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF,
+    0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5,
+    0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC,
+    0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95,
+    0xAF, 0xFC, 0x97, 0x29, 0x99, 0x50, 0x59, 0x97, 0x2F, 0x97, 0xAF, 0xA7, 0xAF, 0xC7, 0x9F, 0x97,
+    0x19, 0x97, 0x77, 0x71, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70,
+    0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0x79, 0x97, 0x59, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFA, 0x73, 0x9F, 0x97,
+    0x59, 0x97, 0x77, 0x70, 0x9A, 0xA9, 0x97, 0x19, 0xFF, 0xA6, 0xAF, 0xFE, 0x4A, 0xFF, 0xFC, 0x3F,
+    0xCA, 0x2F, 0xC9, 0x1A, 0xFA, 0x4F, 0xC1, 0xFC, 0x59, 0xF1, 0xFC, 0x59, 0xF9, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x93,
+    0xFD, 0xA9, 0x99, 0xAE, 0x92, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xC9, 0x72, 0x99,
+    0x95, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF,
+    0xCA, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0x9E, 0x71, 0xEA, 0x71, 0xF9, 0x99, 0x6A, 0xFC, 0xA7, 0xFC,
+    0xA7, 0x09, 0xAA, 0xA9, 0x69, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3,
+    0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0xAF, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF,
+    0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79,
+    0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0xA7, 0x19,
+    0x99, 0xEA, 0x74, 0xAD, 0xA7, 0x5E, 0x75, 0xAE, 0x75, 0xAE, 0x75, 0x9F, 0xD7, 0x3F, 0xD7, 0x4A,
+    0xEA, 0x10, 0x9A, 0xA9, 0x6A, 0xAA, 0x09, 0xF3, 0xAE, 0xA1, 0x9F, 0x90, 0xFA, 0x39, 0xFF, 0xC5,
+    0xAF, 0xE7, 0xAF, 0xC9, 0x77, 0x77, 0x1F, 0xFF, 0xCA, 0x0F, 0xFF, 0xCA, 0x0F, 0xFF, 0xCA, 0x0F,
+    0xFF, 0xCA, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x91, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71,
+    0xFC, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xFF,
+    0xCA, 0x0F, 0xFF, 0xCA, 0x0F, 0xFF, 0xCA, 0x0F, 0xFF, 0xCA, 0x00, 0x19, 0xAA, 0x96, 0xAA, 0xA4,
+    0xF9, 0x29, 0xF5, 0xF9, 0x0A, 0xF6, 0x9F, 0xFC, 0x70, 0x9F, 0xE7, 0x2A, 0xFC, 0x97, 0x77, 0x59,
+    0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF,
+    0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF,
+    0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9,
+    0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x50, 0x70, 0x9A, 0xAA,
+    0xA9, 0x76, 0xFD, 0x97, 0x4F, 0xF9, 0x72, 0xAE, 0xA9, 0xF7, 0x1A, 0xEA, 0x19, 0xF7, 0x9E, 0x94,
+    0xAD, 0xA7, 0x77, 0x77, 0x73, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x5F, 0xFF, 0xE4, 0xFF, 0xFE,
+    0xA3, 0xFE, 0xA9, 0x29, 0xAD, 0x3A, 0xFD, 0x75, 0xFD, 0x75, 0x9F, 0xC7, 0x6A, 0xFC, 0x76, 0xFC,
+    0x97, 0x6F, 0xC9, 0x39, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC4, 0xFF, 0xC9,
+    0x0F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC9, 0x3F, 0xFC, 0x90, 0xFC, 0xA7, 0x9F, 0x90, 0xAF, 0xC7, 0x9F,
+    0x90, 0x9F, 0xC9, 0x69, 0xF9, 0x1F, 0xD6, 0x9F, 0x91, 0x9F, 0xD9, 0x4A, 0xF9, 0x2A, 0xFF, 0xFF,
+    0x93, 0xFF, 0xFF, 0x94, 0xAF, 0xFF, 0xD9, 0x6A, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x96, 0x6A, 0xAA,
+    0xA9, 0x73, 0xFD, 0xA7, 0x1F, 0xF9, 0x7A, 0xF9, 0xF6, 0xAE, 0xA1, 0x9F, 0x49, 0xE9, 0x4A, 0xDA,
+    0x77, 0x71, 0x9A, 0x99, 0x73, 0xFE, 0x90, 0xFA, 0x2F, 0xFC, 0x9F, 0xA1, 0xFF, 0xFE, 0xA0, 0x9F,
+    0xDA, 0x9A, 0xFD, 0xA0, 0xFD, 0x4F, 0xCA, 0x0F, 0xC9, 0x4A, 0xFA, 0x9F, 0xC5, 0x9F, 0xA9, 0xFC,
+    0x6F, 0xA9, 0xFA, 0x6F, 0xA9, 0xFA, 0x6F, 0xA9, 0xFC, 0x6F, 0xA9, 0xFC, 0x6F, 0xA0, 0xFC, 0x94,
+    0xAF, 0xA0, 0xFD, 0x39, 0xFC, 0xA0, 0x9F, 0xDA, 0xAF, 0xEA, 0x1F, 0xFF, 0xEA, 0x2F, 0xFC, 0x9F,
+    0xA3, 0xAF, 0xCA, 0x09, 0xFA, 0x59, 0x99, 0x29, 0xFA, 0x73, 0xAF, 0xA7, 0x3F, 0xC9, 0x09, 0xCA,
+    0x94, 0x9F, 0xD1, 0x9F, 0xFF, 0xDA, 0x19, 0xFF, 0xFD, 0x29, 0xFF, 0xFA, 0x5A, 0xAF, 0xDA, 0xA4,
+    0x5A, 0xAA, 0x6A, 0xAA, 0x7A, 0xD9, 0x49, 0xE7, 0x9F, 0xAA, 0xAF, 0x97, 0x0A, 0xFF, 0xD7, 0x2A,
+    0xFE, 0xA7, 0x5A, 0xAC, 0xAA, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xEA, 0x97, 0xAF, 0xFF, 0xC5, 0xFF,
+    0xFE, 0x4F, 0xFF, 0xEA, 0x3F, 0xEA, 0x92, 0x9A, 0xD3, 0xAF, 0xD7, 0x5F, 0xD7, 0x59, 0xFC, 0x76,
+    0xAF, 0xC7, 0x6F, 0xC9, 0x76, 0xFC, 0x93, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFC, 0x4F, 0xFC, 0x90,
+    0xFC, 0x4F, 0xFC, 0x90, 0xFC, 0x4F, 0xFC, 0x90, 0xFC, 0x93, 0xFF, 0xC9, 0x0F, 0xCA, 0x79, 0xF9,
+    0x0A, 0xFC, 0x79, 0xF9, 0x09, 0xFC, 0x96, 0x9F, 0x91, 0xFD, 0x69, 0xF9, 0x19, 0xFD, 0x94, 0xAF,
+    0x92, 0xAF, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0x96, 0xAF, 0xFD, 0xA9, 0x72, 0x99,
+    0x99, 0x60, 0x2A, 0xAA, 0x6A, 0xAA, 0x4A, 0xD9, 0x49, 0xE4, 0x9F, 0xAA, 0xAF, 0x95, 0xAF, 0xFD,
+    0x7A, 0xFE, 0xA7, 0x2A, 0xAC, 0xAA, 0x77, 0x75, 0x9A, 0x99, 0x73, 0xFE, 0x90, 0xFA, 0x2F, 0xFC,
+    0x9F, 0xA1, 0xFF, 0xFE, 0xA0, 0x9F, 0xDA, 0x9A, 0xFD, 0xA0, 0xFD, 0x4F, 0xCA, 0x0F, 0xC9, 0x4A,
+    0xFA, 0x9F, 0xC5, 0x9F, 0xA9, 0xFC, 0x6F, 0xA9, 0xFA, 0x6F, 0xA9, 0xFA, 0x6F, 0xA9, 0xFC, 0x6F,
+    0xA9, 0xFC, 0x6F, 0xA0, 0xFC, 0x94, 0xAF, 0xA0, 0xFD, 0x39, 0xFC, 0xA0, 0x9F, 0xDA, 0xAF, 0xEA,
+    0x1F, 0xFF, 0xEA, 0x2F, 0xFC, 0x9F, 0xA3, 0xAF, 0xCA, 0x09, 0xFA, 0x59, 0x99, 0x29, 0xFA, 0x73,
+    0xAF, 0xA7, 0x3F, 0xC9, 0x09, 0xCA, 0x94, 0x9F, 0xD1, 0x9F, 0xFF, 0xDA, 0x19, 0xFF, 0xFD, 0x29,
+    0xFF, 0xFA, 0x5A, 0xAF, 0xDA, 0xA4, 0x72, 0x99, 0x77, 0x1F, 0xA7, 0x69, 0xFC, 0x76, 0x9F, 0xC7,
+    0x7F, 0xA7, 0x70, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0xAF, 0xFF, 0xC5, 0xFF,
+    0xFE, 0x4F, 0xFF, 0xEA, 0x3F, 0xEA, 0x92, 0x9A, 0xD3, 0xAF, 0xD7, 0x5F, 0xD7, 0x59, 0xFC, 0x76,
+    0xAF, 0xC7, 0x6F, 0xC9, 0x76, 0xFC, 0x93, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFC, 0x4F, 0xFC, 0x90,
+    0xFC, 0x4F, 0xFC, 0x90, 0xFC, 0x4F, 0xFC, 0x90, 0xFC, 0x93, 0xFF, 0xC9, 0x0F, 0xCA, 0x79, 0xF9,
+    0x0A, 0xFC, 0x79, 0xF9, 0x09, 0xFC, 0x96, 0x9F, 0x91, 0xFD, 0x69, 0xF9, 0x19, 0xFD, 0x94, 0xAF,
+    0x92, 0xAF, 0xFF, 0xF9, 0x3F, 0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0x96, 0xAF, 0xFD, 0xA9, 0x72, 0x99,
+    0x99, 0x60, 0x79, 0x97, 0x6F, 0x97, 0x39, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xA7, 0x59, 0xA9, 0x77,
+    0x76, 0x9A, 0x99, 0x73, 0xFE, 0x90, 0xFA, 0x2F, 0xFC, 0x9F, 0xA1, 0xFF, 0xFE, 0xA0, 0x9F, 0xDA,
+    0x9A, 0xFD, 0xA0, 0xFD, 0x4F, 0xCA, 0x0F, 0xC9, 0x4A, 0xFA, 0x9F, 0xC5, 0x9F, 0xA9, 0xFC, 0x6F,
+    0xA9, 0xFA, 0x6F, 0xA9, 0xFA, 0x6F, 0xA9, 0xFC, 0x6F, 0xA9, 0xFC, 0x6F, 0xA0, 0xFC, 0x94, 0xAF,
+    0xA0, 0xFD, 0x39, 0xFC, 0xA0, 0x9F, 0xDA, 0xAF, 0xEA, 0x1F, 0xFF, 0xEA, 0x2F, 0xFC, 0x9F, 0xA3,
+    0xAF, 0xCA, 0x09, 0xFA, 0x59, 0x99, 0x29, 0xFA, 0x73, 0xAF, 0xA7, 0x3F, 0xC9, 0x09, 0xCA, 0x94,
+    0x9F, 0xD1, 0x9F, 0xFF, 0xDA, 0x19, 0xFF, 0xFD, 0x29, 0xFF, 0xFA, 0x5A, 0xAF, 0xDA, 0xA4, 0x77,
+    0x74, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x5F, 0xFF, 0xE4, 0xFF, 0xFE, 0xA3, 0xFE, 0xA9, 0x29,
+    0xAD, 0x3A, 0xFD, 0x75, 0xFD, 0x75, 0x9F, 0xC7, 0x6A, 0xFC, 0x76, 0xFC, 0x97, 0x6F, 0xC9, 0x39,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC4, 0xFF, 0xC9, 0x0F, 0xC4, 0xFF, 0xC9,
+    0x0F, 0xC9, 0x3F, 0xFC, 0x90, 0xFC, 0xA7, 0x9F, 0x90, 0xAF, 0xC7, 0x9F, 0x90, 0x9F, 0xC9, 0x69,
+    0xF9, 0x1F, 0xD6, 0x9F, 0x91, 0x9F, 0xD9, 0x4A, 0xF9, 0x2A, 0xFF, 0xFF, 0x93, 0xFF, 0xFF, 0x94,
+    0xAF, 0xFF, 0xD9, 0x6A, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x97, 0x77, 0x75, 0xFC, 0x77, 0xF9, 0x77,
+    0xF7, 0x79, 0xE9, 0x77, 0xAE, 0x77, 0x09, 0x99, 0x70, 0x70, 0x9A, 0xA7, 0x6E, 0x75, 0xAE, 0x75,
+    0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x77, 0x75, 0x9A, 0x99, 0x73, 0xFE, 0x1F, 0xA2, 0xFF, 0xC9, 0xFA,
+    0x1F, 0xFF, 0xEA, 0x09, 0xFD, 0xA9, 0xAF, 0xDA, 0x0F, 0xD4, 0xFC, 0xA0, 0xFC, 0x94, 0xAF, 0xA9,
+    0xFC, 0x59, 0xFA, 0x9F, 0xC6, 0xFA, 0x9F, 0xA6, 0xFA, 0x9F, 0xA6, 0xFA, 0x9F, 0xC6, 0xFA, 0x9F,
+    0xC6, 0xFA, 0x0F, 0xC9, 0x4A, 0xFA, 0x0F, 0xD3, 0x9F, 0xCA, 0x09, 0xFD, 0xAA, 0xFE, 0xA1, 0xFF,
+    0xFE, 0xA2, 0xFF, 0xC9, 0xFA, 0x3A, 0xFC, 0xA0, 0x9F, 0xA5, 0x99, 0x92, 0x9F, 0xA7, 0x3A, 0xFA,
+    0x73, 0xFC, 0x90, 0x9C, 0xA9, 0x49, 0xFD, 0x19, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0xA5, 0xAA, 0xFD, 0xAA, 0x40, 0x6A, 0xAA, 0xAA, 0x75, 0xAF, 0xD7, 0x39, 0xFE, 0xA7, 0x19, 0xF9,
+    0xFA, 0x79, 0xF2, 0xF9, 0x6E, 0xA4, 0x9E, 0x77, 0x77, 0x73, 0xFC, 0x70, 0x9F, 0x9F, 0xC7, 0x0A,
+    0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC,
+    0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFC,
+    0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC,
+    0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7,
+    0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA,
+    0xFC, 0x70, 0xAF, 0xA0, 0x39, 0xAA, 0xAA, 0x97, 0x7F, 0xD9, 0x75, 0xFF, 0x74, 0xFA, 0xAF, 0x72,
+    0xF9, 0x19, 0xF7, 0x09, 0xE5, 0xEA, 0x77, 0x77, 0x29, 0x99, 0x97, 0x70, 0xAF, 0x97, 0x7A, 0xF9,
+    0x77, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0xAF, 0x92, 0x9A, 0x99, 0x70,
+    0xAF, 0x90, 0xFE, 0xA6, 0xAF, 0x9F, 0xFD, 0x5A, 0xFF, 0xFE, 0xA4, 0xAF, 0xEA, 0x9A, 0xFD, 0x4A,
+    0xFC, 0xA3, 0x9F, 0xC4, 0xAF, 0xC5, 0xFC, 0x93, 0xAF, 0xC5, 0xFC, 0x93, 0xAF, 0xA5, 0xAF, 0x93,
+    0xAF, 0xA5, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93,
+    0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x93,
+    0xAF, 0x95, 0xAF, 0x93, 0xAF, 0x95, 0xAF, 0x90, 0x2F, 0xC7, 0x09, 0xF9, 0x5F, 0xC7, 0x0A, 0xFA,
+    0x5F, 0xC7, 0x0A, 0xFA, 0x2A, 0xAA, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xDA, 0xA9, 0xFF, 0xFF,
+    0xFF, 0xCA, 0xFF, 0xFF, 0xFF, 0xCA, 0xAA, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xAA, 0x92,
+    0xFC, 0x70, 0xAF, 0xA5, 0xFC, 0x70, 0xAF, 0xA5, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x5F,
+    0xFF, 0xFE, 0xA5, 0xFF, 0xFF, 0xEA, 0x5F, 0xFF, 0xFE, 0xA5, 0xFF, 0xFF, 0xEA, 0x5F, 0xC7, 0x0A,
+    0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A,
+    0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x5F, 0xC7, 0x0A,
+    0xFA, 0x5F, 0xC7, 0x0A, 0xFA, 0x20, 0x29, 0x99, 0x97, 0x69, 0xFA, 0x75, 0x9F, 0xA7, 0x3A, 0xAF,
+    0xDA, 0xAA, 0xA9, 0x6F, 0xFF, 0xA6, 0xFF, 0xFA, 0x6A, 0xAA, 0xFC, 0xAA, 0xAA, 0x97, 0x09, 0xFA,
+    0x75, 0x9F, 0xA2, 0x9A, 0xA9, 0x69, 0xF9, 0x0A, 0xFD, 0xA4, 0x9F, 0x9F, 0xFD, 0x39, 0xFF, 0xFE,
+    0xA2, 0x9F, 0xEA, 0x9A, 0xFD, 0x29, 0xFD, 0x39, 0xFC, 0x91, 0x9F, 0xC5, 0xFC, 0x91, 0x9F, 0xC5,
+    0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5,
+    0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5,
+    0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x91, 0x9F, 0xA5, 0xAF, 0x90, 0x77, 0x1F, 0xA2, 0x9D, 0x91, 0xFE,
+    0xAA, 0xE1, 0xAF, 0xFE, 0xA1, 0xE1, 0xAF, 0xD2, 0xD9, 0x39, 0xCA, 0x97, 0x77, 0x73, 0xAF, 0xFC,
+    0xA3, 0xFF, 0xE3, 0xFF, 0xE3, 0x9A, 0xFE, 0xA7, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71,
+    0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71,
+    0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x7A, 0xFE, 0xA4, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE0,
+    0x77, 0x9F, 0x92, 0xE0, 0x9F, 0xEA, 0xAD, 0xA0, 0xFF, 0xF0, 0x9D, 0xA0, 0x9A, 0xFC, 0x90, 0x9D,
+    0x4A, 0xCA, 0x97, 0x77, 0x71, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF,
+    0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF,
+    0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA7, 0xAF, 0xA3, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x77, 0x70, 0xAF, 0xFC, 0xA0, 0xFF, 0xE0, 0xFF, 0xE0, 0x9A, 0xFE,
+    0xA4, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6,
+    0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC4, 0xAF, 0xEA, 0x1F, 0xFE, 0x0F, 0xFE, 0x0F,
+    0xFE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xFD, 0xAA, 0xFF, 0xDA, 0x9F, 0xFD, 0x97, 0x77,
+    0x2A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA,
+    0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA, 0x5A, 0xFA,
+    0x5A, 0xFA, 0x5A, 0xFA, 0x20, 0x9A, 0xA6, 0xAA, 0xA0, 0x9D, 0xA4, 0x9E, 0x1F, 0xAA, 0xAF, 0xA1,
+    0xAF, 0xFD, 0x3A, 0xFF, 0x6A, 0xAD, 0xA9, 0x77, 0x77, 0x0A, 0xFF, 0xCA, 0x2F, 0xFE, 0x2F, 0xFE,
+    0x29, 0xAF, 0xEA, 0x6F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC6, 0xAF, 0xEA, 0x3F, 0xFE, 0x2F, 0xFE, 0x2F, 0xFE, 0x10, 0x0A, 0xAA, 0x6A, 0xA9,
+    0x0E, 0x5A, 0xDA, 0x0A, 0xFA, 0xAF, 0xC2, 0xFF, 0xD9, 0x3F, 0xF9, 0x59, 0xAD, 0xA9, 0x77, 0x77,
+    0x3A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA,
+    0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA, 0x7A, 0xFA,
+    0x7A, 0xFA, 0x7A, 0xFA, 0x30, 0xAF, 0xFC, 0xAF, 0xFF, 0xFF, 0xD9, 0xAF, 0xEA, 0x3F, 0xC5, 0xFC,
+    0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F,
+    0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x3A, 0xFE, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0xE9, 0x5E, 0x95,
+    0x9E, 0x6E, 0xA6, 0xF9, 0x99, 0x3A, 0xFC, 0xA4, 0xFC, 0xA5, 0x9A, 0xAA, 0x90, 0x29, 0x92, 0x9F,
+    0x90, 0xAF, 0xA0, 0xAF, 0xA0, 0x9F, 0x92, 0x99, 0x77, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A,
+    0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A,
+    0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x0A, 0xFA, 0x1A, 0xDA, 0x1A,
+    0xDA, 0x2E, 0x2A, 0xE2, 0xAE, 0x99, 0x99, 0xFD, 0x0F, 0xD1, 0x9A, 0xAA, 0x90, 0x49, 0x7A, 0xEA,
+    0x5F, 0xC5, 0xFC, 0x5F, 0xC6, 0x9A, 0x97, 0x77, 0x1A, 0xFF, 0xCA, 0xFF, 0xFF, 0xFD, 0x9A, 0xFE,
+    0xA3, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5,
+    0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC3, 0xAF, 0xEA, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x5A, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA,
+    0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xA0, 0xAF, 0xFC, 0xA3, 0xAF,
+    0x9F, 0xFE, 0x3A, 0xF9, 0xFF, 0xE3, 0xAF, 0x99, 0xAF, 0xEA, 0x4A, 0xF9, 0x2F, 0xC6, 0xAF, 0x92,
+    0xFC, 0x6A, 0xF9, 0x2F, 0xC6, 0xAF, 0x92, 0xFC, 0x6A, 0xF9, 0x2F, 0xC6, 0xAF, 0x92, 0xFC, 0x6A,
+    0xF9, 0x2F, 0xC6, 0xAF, 0x92, 0xFC, 0x6A, 0xF9, 0x2F, 0xC6, 0xAF, 0x92, 0xFC, 0x6A, 0xF9, 0x2F,
+    0xC6, 0xAF, 0x92, 0xFC, 0x6A, 0xF9, 0x2F, 0xC6, 0xAF, 0x92, 0xFC, 0x6A, 0xF9, 0x2F, 0xC6, 0xAF,
+    0x92, 0xFC, 0x6A, 0xF9, 0x0A, 0xFE, 0xA4, 0xAF, 0x9F, 0xFE, 0x3A, 0xF9, 0xFF, 0xE3, 0xAF, 0x9F,
+    0xFE, 0x3A, 0xF9, 0x76, 0xFC, 0x97, 0x6F, 0xC7, 0x29, 0x99, 0x9F, 0xD7, 0x2F, 0xFC, 0x97, 0x2F,
+    0xFA, 0x73, 0xFE, 0xA7, 0x4F, 0xCA, 0x93, 0x19, 0x97, 0x99, 0x19, 0xF9, 0x4F, 0x9A, 0xFA, 0x39,
+    0xFC, 0xAF, 0xA3, 0xAF, 0xC9, 0xF9, 0x4F, 0xA1, 0x99, 0x79, 0xA9, 0x77, 0x77, 0x0A, 0xFA, 0x39,
+    0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF,
+    0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F,
+    0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA,
+    0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xAA, 0xFA, 0x39, 0xFA, 0xAF, 0xA3, 0x9F, 0xA7, 0x19, 0xFA, 0x71,
+    0x9F, 0xA7, 0x1A, 0xFA, 0x70, 0x9F, 0xC9, 0x5A, 0xFF, 0x6A, 0xFF, 0x6A, 0xFE, 0x79, 0xFC, 0x92,
+    0x5A, 0xAA, 0xAA, 0x71, 0xFD, 0xA7, 0xAF, 0xE9, 0x5A, 0xF9, 0xF9, 0x39, 0xEA, 0x2F, 0x92, 0xE9,
+    0x4A, 0xE7, 0x77, 0x76, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72,
+    0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72,
+    0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72,
+    0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0xAF, 0xA5, 0x99, 0x9A, 0xFC, 0x94, 0x9F, 0xFC, 0x59, 0xFF,
+    0x95, 0x9F, 0xE9, 0x69, 0xFC, 0xA7, 0x00, 0x39, 0xAA, 0xAA, 0x96, 0x9F, 0xD6, 0xFF, 0x4F, 0xAA,
+    0xF2, 0xF9, 0x1A, 0xF0, 0xAD, 0xA4, 0x9E, 0x97, 0x77, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A,
+    0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A,
+    0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A, 0xF9, 0x7A,
+    0xF9, 0x7A, 0xF9, 0x69, 0xFC, 0x93, 0xFF, 0xC4, 0xFF, 0xA4, 0xFE, 0xA5, 0xAF, 0xA9, 0x60, 0xFC,
+    0x7A, 0xFA, 0x0F, 0xC6, 0xAF, 0xC1, 0xFC, 0x59, 0xFC, 0x91, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4, 0xFC,
+    0xA3, 0xFC, 0x3A, 0xFC, 0x4F, 0xC2, 0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x95, 0xFC, 0x1F, 0xCA, 0x6F,
+    0xC0, 0xFC, 0xA7, 0xFC, 0xAF, 0xC7, 0x0F, 0xFE, 0x97, 0xFF, 0xF7, 0xFF, 0xFA, 0x6F, 0xD9, 0xAF,
+    0xC6, 0xFC, 0x2F, 0xD5, 0xFC, 0x29, 0xFC, 0x94, 0xFC, 0x3A, 0xFC, 0x4F, 0xC4, 0xFC, 0xA3, 0xFC,
+    0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xD2, 0xFC, 0x6F, 0xCA, 0x1F, 0xC6, 0xAF, 0xC1, 0xFC, 0x7F, 0xD7,
+    0x77, 0x77, 0x7F, 0x97, 0x59, 0xF7, 0x6A, 0xEA, 0x76, 0xF7, 0x7E, 0x97, 0x79, 0x99, 0x72, 0x09,
+    0x99, 0x97, 0x59, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F,
+    0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA5, 0xFC, 0xA0, 0x9F, 0xA4, 0xFC, 0xA1, 0x9F, 0xA3, 0xFC, 0xA2,
+    0x9F, 0xA2, 0xFD, 0x39, 0xFA, 0x1A, 0xFC, 0x49, 0xFA, 0x0A, 0xFC, 0x59, 0xF9, 0x9F, 0xC6, 0x9F,
+    0xAF, 0xC9, 0x69, 0xFF, 0xDA, 0x69, 0xFF, 0xE9, 0x59, 0xFF, 0xF5, 0x9F, 0xCA, 0x0A, 0xFC, 0x49,
+    0xFA, 0x2F, 0xCA, 0x39, 0xFA, 0x29, 0xFC, 0x92, 0x9F, 0xA3, 0xAF, 0xC2, 0x9F, 0xA4, 0xFD, 0x19,
+    0xFA, 0x5F, 0xCA, 0x09, 0xFA, 0x59, 0xFC, 0x97, 0x77, 0x77, 0x39, 0xF7, 0x5A, 0xF7, 0x5F, 0x97,
+    0x5F, 0x75, 0x9E, 0x77, 0x99, 0x72, 0x77, 0x29, 0xFA, 0x5A, 0xFA, 0x09, 0xFA, 0x4A, 0xFA, 0x19,
+    0xFA, 0x39, 0xFC, 0x29, 0xFA, 0x29, 0xFC, 0x39, 0xFA, 0x2F, 0xC4, 0x9F, 0xA1, 0xFC, 0x94, 0x9F,
+    0xA0, 0xFC, 0x95, 0x9F, 0xAA, 0xFA, 0x69, 0xFF, 0xD9, 0x69, 0xFF, 0xE6, 0x9F, 0xFF, 0x59, 0xFD,
+    0x9F, 0xCA, 0x49, 0xFA, 0x2F, 0xC9, 0x39, 0xFA, 0x29, 0xFC, 0x39, 0xFA, 0x3A, 0xFC, 0x29, 0xFA,
+    0x4F, 0xCA, 0x19, 0xFA, 0x5F, 0xCA, 0x09, 0xFA, 0x59, 0xFC, 0x90, 0x39, 0xAA, 0xAA, 0xA7, 0x09,
+    0xFC, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x1A, 0xEA, 0x71, 0x9E, 0x97, 0x77, 0x77, 0x3F, 0xA7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF,
+    0xDA, 0x3A, 0xAA, 0xAA, 0x92, 0xAF, 0xC2, 0x9F, 0xC3, 0xFA, 0x3F, 0x93, 0xAD, 0xA7, 0x70, 0x99,
+    0x99, 0x4A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A,
+    0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A,
+    0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A, 0xF9, 0x3A,
+    0xF9, 0x3A, 0xF9, 0x30, 0x0F, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xFF, 0xDA, 0x0F,
+    0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x0F, 0xFF, 0xDA, 0x77, 0x77, 0x5A, 0xF7, 0x2F, 0xA7, 0x2F, 0x72,
+    0x9E, 0xA7, 0x2A, 0xE7, 0x49, 0x97, 0x09, 0x99, 0x90, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF,
+    0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A,
+    0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x9A, 0xF9, 0xAF, 0x97, 0x4F,
+    0xA0, 0xF9, 0x0F, 0x09, 0xE9, 0x0A, 0xDA, 0x19, 0x99, 0x20, 0x0F, 0xA5, 0xF9, 0x0F, 0xC4, 0x9F,
+    0x1F, 0xC4, 0xAE, 0x91, 0xFC, 0x4A, 0xE2, 0xFC, 0x4E, 0x92, 0xFC, 0x4A, 0xA9, 0x3F, 0xC7, 0x3F,
+    0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F,
+    0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xFF, 0xDA, 0x1F, 0xFF, 0xDA, 0x1F,
+    0xFF, 0xDA, 0x1F, 0xFF, 0xDA, 0x00, 0x09, 0x99, 0x92, 0x99, 0x99, 0x0A, 0xF9, 0x1F, 0x9A, 0xF9,
+    0x09, 0xF0, 0xAF, 0x90, 0xAE, 0x90, 0xAF, 0x90, 0xAE, 0x1A, 0xF9, 0x0E, 0x2A, 0xF9, 0x6A, 0xF9,
+    0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9,
+    0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9, 0x6A, 0xF9,
+    0x6A, 0xF9, 0x6A, 0xF9, 0x60, 0x0F, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC4, 0x99, 0x3F, 0xC3, 0xF9, 0x1F, 0xC2, 0xAF, 0xA1, 0xFC,
+    0x2A, 0xFC, 0x1F, 0xC2, 0x9F, 0x91, 0xFC, 0x49, 0x93, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC,
+    0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD, 0xA0, 0xFF, 0xFD,
+    0xA0, 0x09, 0x99, 0x96, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95,
+    0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x91, 0x99, 0x1A, 0xF9, 0x0F, 0x9A, 0xF9, 0xAF, 0xCA,
+    0xF9, 0xAF, 0xCA, 0xF9, 0x9F, 0x9A, 0xF9, 0x19, 0xA1, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF,
+    0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0xAF, 0x95, 0x2F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC0, 0x99, 0x71, 0xFC,
+    0xAD, 0x71, 0xFF, 0xA7, 0x0F, 0xFC, 0x70, 0xFE, 0x97, 0x9F, 0xDA, 0x70, 0xAF, 0xE7, 0x19, 0xFE,
+    0x72, 0xFE, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xFF, 0xDA, 0x2F, 0xFF,
+    0xDA, 0x2F, 0xFF, 0xDA, 0x2F, 0xFF, 0xDA, 0x39, 0x99, 0x96, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5,
+    0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xAA, 0x49, 0xFD,
+    0x93, 0x9F, 0xE3, 0x9F, 0xE9, 0x19, 0xFD, 0xA2, 0xFE, 0xA3, 0xFE, 0xA3, 0x9F, 0xDA, 0x4A, 0xAF,
+    0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA5, 0x9F, 0xA2, 0x72,
+    0x9A, 0xAA, 0xAA, 0x77, 0xFC, 0x97, 0x6F, 0xC9, 0x76, 0xAF, 0x77, 0xAE, 0xA7, 0x70, 0xE9, 0x77,
+    0x77, 0x77, 0x5F, 0xD9, 0x70, 0x9F, 0x0F, 0xE7, 0x09, 0xF0, 0xFE, 0xA7, 0x9F, 0x0F, 0xF9, 0x69,
+    0xF0, 0xFF, 0xC6, 0x9F, 0x0F, 0xFC, 0x95, 0x9F, 0x0F, 0xAF, 0xC5, 0x9F, 0x0F, 0x9F, 0xCA, 0x49,
+    0xF0, 0xF9, 0x0F, 0xC4, 0x9F, 0x0F, 0x90, 0xAF, 0xC3, 0x9F, 0x0F, 0x91, 0xFC, 0x92, 0x9F, 0x0F,
+    0x91, 0xAF, 0xC2, 0x9F, 0x0F, 0x92, 0xFC, 0x91, 0x9F, 0x0F, 0xA2, 0x9F, 0xC1, 0x9F, 0x0F, 0xA3,
+    0xFC, 0xA0, 0x9F, 0x0F, 0xA4, 0xFC, 0x09, 0xF0, 0xFA, 0x4A, 0xFC, 0x9F, 0x0F, 0xA5, 0xFC, 0xAF,
+    0x0F, 0xA5, 0x9F, 0xFC, 0x0F, 0xA6, 0xFF, 0xC0, 0xFA, 0x69, 0xFF, 0x0F, 0xA7, 0xAF, 0xE0, 0xFA,
+    0x70, 0xFE, 0x0F, 0xA7, 0x0A, 0xFD, 0x00, 0x71, 0xAA, 0xAA, 0xA9, 0x72, 0xAF, 0xC7, 0x2A, 0xFA,
+    0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3A, 0xDA, 0x77, 0x77, 0x29, 0xAA, 0x94, 0xAE, 0xA1, 0xFE, 0xA2,
+    0xAF, 0x0F, 0xFD, 0x1A, 0xFF, 0xFE, 0xA0, 0xAF, 0xEA, 0x9A, 0xFD, 0x0A, 0xFC, 0xA3, 0x9F, 0xC0,
+    0xAF, 0xC5, 0xFC, 0x9A, 0xFC, 0x5F, 0xC9, 0xAF, 0xA5, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95,
+    0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A,
+    0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x90, 0xFD, 0x97,
+    0x09, 0xF0, 0xFE, 0x70, 0x9F, 0x0F, 0xEA, 0x79, 0xF0, 0xFF, 0x96, 0x9F, 0x0F, 0xFC, 0x69, 0xF0,
+    0xFF, 0xC9, 0x59, 0xF0, 0xFA, 0xFC, 0x59, 0xF0, 0xF9, 0xFC, 0xA4, 0x9F, 0x0F, 0x90, 0xFC, 0x49,
+    0xF0, 0xF9, 0x0A, 0xFC, 0x39, 0xF0, 0xF9, 0x1F, 0xC9, 0x29, 0xF0, 0xF9, 0x1A, 0xFC, 0x29, 0xF0,
+    0xF9, 0x2F, 0xC9, 0x19, 0xF0, 0xFA, 0x29, 0xFC, 0x19, 0xF0, 0xFA, 0x3F, 0xCA, 0x09, 0xF0, 0xFA,
+    0x4F, 0xC0, 0x9F, 0x0F, 0xA4, 0xAF, 0xC9, 0xF0, 0xFA, 0x5F, 0xCA, 0xF0, 0xFA, 0x59, 0xFF, 0xC0,
+    0xFA, 0x6F, 0xFC, 0x0F, 0xA6, 0x9F, 0xF0, 0xFA, 0x7A, 0xFE, 0x0F, 0xA7, 0x0F, 0xE0, 0xFA, 0x70,
+    0xAF, 0xD7, 0x77, 0x77, 0x74, 0x9F, 0x77, 0x0A, 0xF7, 0x70, 0xF9, 0x77, 0x0F, 0x77, 0x09, 0xE7,
+    0x72, 0x99, 0x73, 0x70, 0x9A, 0xA9, 0x4A, 0xEA, 0x1F, 0xEA, 0x2A, 0xF0, 0xFF, 0xD1, 0xAF, 0xFF,
+    0xEA, 0x0A, 0xFE, 0xA9, 0xAF, 0xD0, 0xAF, 0xCA, 0x39, 0xFC, 0x0A, 0xFC, 0x5F, 0xC9, 0xAF, 0xC5,
+    0xFC, 0x9A, 0xFA, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A,
+    0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A,
+    0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0x77, 0x77, 0x72, 0xFA, 0x74, 0xF7, 0x49, 0xEA,
+    0x74, 0xAE, 0x75, 0xEA, 0x75, 0x99, 0x97, 0x00, 0x3A, 0xAA, 0x69, 0xAA, 0x97, 0xAE, 0xA3, 0xF9,
+    0x70, 0xAF, 0x09, 0xF9, 0x72, 0xFF, 0xC9, 0x74, 0xFE, 0xA7, 0x59, 0xFC, 0xA7, 0x77, 0x77, 0x73,
+    0xFD, 0x97, 0x09, 0xF0, 0xFE, 0x70, 0x9F, 0x0F, 0xEA, 0x79, 0xF0, 0xFF, 0x96, 0x9F, 0x0F, 0xFC,
+    0x69, 0xF0, 0xFF, 0xC9, 0x59, 0xF0, 0xFA, 0xFC, 0x59, 0xF0, 0xF9, 0xFC, 0xA4, 0x9F, 0x0F, 0x90,
+    0xFC, 0x49, 0xF0, 0xF9, 0x0A, 0xFC, 0x39, 0xF0, 0xF9, 0x1F, 0xC9, 0x29, 0xF0, 0xF9, 0x1A, 0xFC,
+    0x29, 0xF0, 0xF9, 0x2F, 0xC9, 0x19, 0xF0, 0xFA, 0x29, 0xFC, 0x19, 0xF0, 0xFA, 0x3F, 0xCA, 0x09,
+    0xF0, 0xFA, 0x4F, 0xC0, 0x9F, 0x0F, 0xA4, 0xAF, 0xC9, 0xF0, 0xFA, 0x5F, 0xCA, 0xF0, 0xFA, 0x59,
+    0xFF, 0xC0, 0xFA, 0x6F, 0xFC, 0x0F, 0xA6, 0x9F, 0xF0, 0xFA, 0x7A, 0xFE, 0x0F, 0xA7, 0x0F, 0xE0,
+    0xFA, 0x70, 0xAF, 0xD0, 0x19, 0xAA, 0x96, 0xAA, 0xA3, 0x9F, 0x3A, 0xEA, 0x49, 0xF9, 0x0F, 0xA6,
+    0x9F, 0xFC, 0x70, 0xAF, 0xE7, 0x2A, 0xFC, 0x97, 0x77, 0x79, 0xAA, 0x94, 0xAE, 0xA1, 0xFE, 0xA2,
+    0xAF, 0x0F, 0xFD, 0x1A, 0xFF, 0xFE, 0xA0, 0xAF, 0xEA, 0x9A, 0xFD, 0x0A, 0xFC, 0xA3, 0x9F, 0xC0,
+    0xAF, 0xC5, 0xFC, 0x9A, 0xFC, 0x5F, 0xC9, 0xAF, 0xA5, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95,
+    0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A,
+    0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x90, 0x19, 0xF7,
+    0x73, 0xAF, 0x77, 0x3F, 0xC7, 0x73, 0xF9, 0x77, 0x29, 0xF7, 0x73, 0x9E, 0xA7, 0x19, 0xAA, 0x95,
+    0xAE, 0x90, 0x9E, 0xA1, 0xAF, 0xE3, 0xF1, 0x9F, 0x0F, 0xFD, 0x29, 0x99, 0x29, 0xFF, 0xFF, 0x79,
+    0xFE, 0xA9, 0xAF, 0xD7, 0x9F, 0xD3, 0x9F, 0xC9, 0x69, 0xFC, 0x5F, 0xC9, 0x69, 0xFC, 0x5A, 0xF9,
+    0x69, 0xFC, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9,
+    0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9,
+    0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0x69, 0xFA, 0x5A, 0xF9, 0xFD, 0xA7, 0x09, 0xF0,
+    0xFE, 0x97, 0x9F, 0x0F, 0xF7, 0x9F, 0x0F, 0xFA, 0x69, 0xF0, 0xFF, 0xC9, 0x59, 0xF0, 0xFF, 0xD5,
+    0x9F, 0x0F, 0xAF, 0xD4, 0x9F, 0x0F, 0x9A, 0xFC, 0xA3, 0x9F, 0x0F, 0x90, 0xFD, 0x39, 0xF0, 0xF9,
+    0x09, 0xFD, 0x29, 0xF0, 0xF9, 0x1A, 0xFC, 0xA1, 0x9F, 0x0F, 0x92, 0xFD, 0x90, 0x9F, 0x0F, 0xA3,
+    0xFD, 0x09, 0xF0, 0xFA, 0x39, 0xFC, 0xA9, 0xF0, 0xFA, 0x4F, 0xDA, 0xF0, 0xFA, 0x5F, 0xFD, 0x0F,
+    0xA5, 0x9F, 0xFC, 0x0F, 0xA6, 0xAF, 0xF0, 0xFA, 0x7F, 0xF0, 0xFA, 0x79, 0xFE, 0x0F, 0xA7, 0x0A,
+    0xFD, 0x0F, 0xA7, 0x1F, 0xD0, 0xFA, 0x71, 0x9F, 0xC0, 0xFA, 0x72, 0xAF, 0x77, 0x09, 0xF7, 0x70,
+    0xAF, 0x77, 0xAF, 0xC7, 0x2A, 0xFF, 0xC9, 0x72, 0xAF, 0xFA, 0x73, 0xAF, 0xEA, 0x74, 0x9F, 0xCA,
+    0x40, 0x70, 0x9A, 0x99, 0x4A, 0xEA, 0x1F, 0xEA, 0x2A, 0xF9, 0xFF, 0xD1, 0xAF, 0xFF, 0xEA, 0x0A,
+    0xFE, 0xA9, 0xAF, 0xD0, 0xAF, 0xCA, 0x39, 0xFC, 0x0A, 0xFC, 0x5F, 0xC9, 0xAF, 0xC5, 0xFC, 0x9A,
+    0xFA, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A,
+    0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0xAF,
+    0x95, 0xAF, 0x9A, 0xF9, 0x5A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xFC, 0x97, 0x2A, 0xFC,
+    0x70, 0xAF, 0xF7, 0x0A, 0xFE, 0x97, 0x0A, 0xFD, 0xA7, 0x19, 0xFA, 0x92, 0x69, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x73, 0x9F, 0xFD, 0xA7, 0x39, 0xFF, 0xDA, 0x73, 0x9F, 0xFD, 0xA7, 0x77, 0x77, 0x77,
+    0x49, 0xAF, 0xEA, 0x73, 0x9F, 0xFF, 0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xC4, 0x9F, 0xDA,
+    0x92, 0x9F, 0xDA, 0x3F, 0xD9, 0x6F, 0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1, 0xAF, 0xC7, 0x1A, 0xFC,
+    0x1F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x73,
+    0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC,
+    0xA7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1A, 0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA, 0x2F, 0xD7, 0xAF, 0xC9,
+    0x29, 0xFD, 0xA3, 0x9F, 0xE4, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xC7, 0x3A, 0xFF,
+    0xA9, 0x77, 0x09, 0x99, 0x71, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
+    0xFE, 0x77, 0x75, 0x99, 0xA9, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F,
+    0xD9, 0x99, 0xFD, 0x2A, 0xFC, 0x4F, 0xC9, 0x1F, 0xC5, 0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6,
+    0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC,
+    0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD, 0xAA, 0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE,
+    0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x5A, 0xAA, 0x6A, 0xAA, 0x72, 0xAD, 0x94, 0xAD, 0xA7, 0x29,
+    0xFA, 0xAA, 0xF9, 0x73, 0xFF, 0xDA, 0x75, 0xAF, 0xEA, 0x77, 0x9A, 0xAC, 0xAA, 0x77, 0x77, 0x77,
+    0x77, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD,
+    0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF,
+    0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7,
+    0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F,
+    0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC,
+    0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF,
+    0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0x29, 0xAA, 0x6A, 0xAA, 0x59, 0xDA, 0x49, 0xE6, 0xFA, 0xAA,
+    0xFA, 0x6A, 0xFF, 0xD7, 0x0A, 0xFF, 0x73, 0xAA, 0xDA, 0x97, 0x77, 0x79, 0x9A, 0x99, 0x72, 0x9F,
+    0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFF, 0xFC, 0x93, 0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91,
+    0xFC, 0x59, 0xFC, 0x1F, 0xC6, 0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F,
+    0xC0, 0x9F, 0xC6, 0xFC, 0x1F, 0xC6, 0xFC, 0x1F, 0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F,
+    0xDA, 0xAA, 0xFD, 0x39, 0xFF, 0xFC, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x7A,
+    0xAA, 0xA9, 0x09, 0xAA, 0xAA, 0x73, 0xFC, 0x09, 0xFA, 0x72, 0x9F, 0x90, 0xFA, 0x73, 0xF1, 0xAE,
+    0xA7, 0x3A, 0xE1, 0x9E, 0x97, 0x4D, 0xA2, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x73,
+    0x9F, 0xFF, 0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF, 0xFF, 0xC4, 0x9F, 0xDA, 0x92, 0x9F, 0xDA, 0x3F,
+    0xD9, 0x6F, 0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1, 0xAF, 0xC7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0x9F,
+    0xC1, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x73,
+    0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0xA7, 0x2F, 0xC1, 0xAF,
+    0xC7, 0x1A, 0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA, 0x2F, 0xD7, 0xAF, 0xC9, 0x29, 0xFD, 0xA3, 0x9F,
+    0xE4, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF, 0xFF, 0xC7, 0x3A, 0xFF, 0xA9, 0x77, 0x09, 0x99,
+    0x71, 0x4A, 0xAA, 0xAA, 0x09, 0xAA, 0xAA, 0x6A, 0xF9, 0x0F, 0xC6, 0xF9, 0x0A, 0xF6, 0xF9, 0x09,
+    0xF6, 0x9E, 0x91, 0xEA, 0x7D, 0xA2, 0x9D, 0x97, 0x77, 0x70, 0x99, 0xA9, 0x97, 0x29, 0xFF, 0xA7,
+    0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A, 0xFC, 0x4F, 0xC9, 0x1F, 0xC5,
+    0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09,
+    0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD, 0xAA,
+    0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x77, 0x77, 0x4A,
+    0xFF, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFF, 0xE9, 0x3F, 0xFF, 0xFF, 0xFC, 0x92, 0xAF, 0xFF, 0xFF,
+    0xFC, 0x91, 0x9F, 0xD9, 0x39, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0x92, 0xFD, 0x6A, 0xF9, 0x72, 0xFC,
+    0x96, 0xAF, 0x97, 0x1A, 0xFC, 0x7A, 0xF9, 0x71, 0xFC, 0xA7, 0xAF, 0x97, 0x1F, 0xC9, 0x7A, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x1F, 0xC7, 0x0A, 0xFF, 0xFC, 0x1F, 0xC7, 0x0A, 0xFF, 0xFC, 0x1F, 0xC7,
+    0x0A, 0xFF, 0xFC, 0x1F, 0xC7, 0x0A, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xC9, 0x7A, 0xF9, 0x71,
+    0xFC, 0x97, 0xAF, 0x97, 0x1A, 0xFC, 0x7A, 0xF9, 0x71, 0x9F, 0xC7, 0xAF, 0x97, 0x2F, 0xD6, 0xAF,
+    0x97, 0x29, 0xFD, 0x93, 0x9F, 0xC9, 0x73, 0xFF, 0xFF, 0xFF, 0xD9, 0x3F, 0xFF, 0xFF, 0xFC, 0x94,
+    0xAF, 0xFF, 0xFF, 0xE9, 0x59, 0xAF, 0xFF, 0xFF, 0xC9, 0x71, 0x99, 0x97, 0x70, 0x69, 0xAA, 0x99,
+    0x69, 0x9A, 0x99, 0x72, 0x9F, 0xFA, 0x2A, 0xFF, 0x96, 0xAF, 0xFE, 0x9F, 0xFE, 0xA4, 0xAF, 0xFF,
+    0xFF, 0xFC, 0xA2, 0x9F, 0xDA, 0x9A, 0xFF, 0xC9, 0x19, 0xFC, 0x91, 0xFC, 0xA4, 0xFE, 0x5F, 0xA1,
+    0xFC, 0x59, 0xFC, 0x95, 0xAF, 0x09, 0xFC, 0x6F, 0xC9, 0x5A, 0xF0, 0x9F, 0xA6, 0xFF, 0xFF, 0xC0,
+    0x9F, 0xA6, 0xFF, 0xFF, 0xC0, 0x9F, 0xA6, 0xFF, 0xFF, 0xC0, 0x9F, 0xA6, 0xFC, 0x74, 0x9F, 0xC6,
+    0xFC, 0x75, 0xFC, 0x5A, 0xFC, 0xA7, 0x4A, 0xFC, 0x39, 0xFE, 0x97, 0xA3, 0xFE, 0xAF, 0xFE, 0x99,
+    0x99, 0xAE, 0x39, 0xFF, 0xFF, 0xFF, 0xD4, 0x9F, 0xFE, 0x09, 0xFF, 0xF6, 0xAF, 0xE9, 0x3A, 0xFF,
+    0xA9, 0x71, 0x99, 0x97, 0x19, 0x99, 0x95, 0x71, 0xAA, 0xAA, 0xA9, 0x74, 0xAF, 0xC7, 0x49, 0xFC,
+    0x75, 0xFA, 0x75, 0xF9, 0x75, 0xAD, 0xA7, 0x77, 0x77, 0x72, 0xFF, 0xCA, 0xA9, 0x7F, 0xFF, 0xC9,
+    0x5F, 0xFF, 0xDA, 0x4F, 0xFF, 0xEA, 0x3F, 0xC2, 0x9A, 0xFD, 0x3F, 0xC4, 0x9F, 0xC9, 0x2F, 0xC5,
+    0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x49, 0xFC, 0x3F, 0xC3, 0xAF, 0xCA,
+    0x3F, 0xFF, 0xE4, 0xFF, 0xFC, 0xA5, 0xFF, 0xF9, 0x6F, 0xFF, 0xC6, 0xFC, 0x2F, 0xC9, 0x5F, 0xC2,
+    0x9F, 0xC5, 0xFC, 0x3A, 0xFA, 0x4F, 0xC4, 0xFC, 0x93, 0xFC, 0x4A, 0xFC, 0x3F, 0xC5, 0xFC, 0xA2,
+    0xFC, 0x59, 0xFC, 0x91, 0xFC, 0x6F, 0xD1, 0xFC, 0x7F, 0xCA, 0x69, 0xAA, 0xAA, 0xA6, 0x9F, 0xC9,
+    0x6F, 0xC7, 0xFC, 0x7A, 0xEA, 0x79, 0xE9, 0x77, 0x74, 0x9A, 0x91, 0xAE, 0x91, 0xAF, 0x90, 0xAE,
+    0xA0, 0xAF, 0xC9, 0x0A, 0xFA, 0xFD, 0x1A, 0xFF, 0xE1, 0xAF, 0xE9, 0x19, 0x1A, 0xFC, 0xA6, 0xAF,
+    0xC7, 0xAF, 0xA7, 0xAF, 0x97, 0xAF, 0x97, 0xAF, 0x97, 0xAF, 0x97, 0xAF, 0x97, 0xAF, 0x97, 0xAF,
+    0x97, 0xAF, 0x97, 0xAF, 0x97, 0xAF, 0x97, 0x0F, 0xFC, 0xAA, 0x97, 0xFF, 0xFC, 0x95, 0xFF, 0xFD,
+    0xA4, 0xFF, 0xFE, 0xA3, 0xFC, 0x29, 0xAF, 0xD3, 0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F,
+    0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4, 0x9F, 0xC3, 0xFC, 0x3A, 0xFC, 0xA3, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xCA, 0x5F, 0xFF, 0x96, 0xFF, 0xFC, 0x6F, 0xC2, 0xFC, 0x95, 0xFC, 0x29, 0xFC, 0x5F,
+    0xC3, 0xAF, 0xA4, 0xFC, 0x4F, 0xC9, 0x3F, 0xC4, 0xAF, 0xC3, 0xFC, 0x5F, 0xCA, 0x2F, 0xC5, 0x9F,
+    0xC9, 0x1F, 0xC6, 0xFD, 0x1F, 0xC7, 0xFC, 0xA7, 0x77, 0x77, 0x69, 0xF7, 0x6A, 0xF7, 0x6F, 0x97,
+    0x6F, 0x76, 0x9E, 0x77, 0x09, 0x99, 0x71, 0x70, 0x9A, 0x90, 0xAE, 0x91, 0xAF, 0x9A, 0xEA, 0x0A,
+    0xFC, 0x9A, 0xFA, 0xFD, 0x0A, 0xFF, 0xE0, 0xAF, 0xE9, 0x19, 0x0A, 0xFC, 0xA5, 0xAF, 0xC6, 0xAF,
+    0xA6, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF, 0x96, 0xAF,
+    0x96, 0xAF, 0x96, 0xAF, 0x97, 0x77, 0x71, 0xFA, 0x7F, 0x97, 0xF7, 0x9E, 0x97, 0xAD, 0xA7, 0x09,
+    0x99, 0x71, 0x19, 0xAA, 0x96, 0xAA, 0xA6, 0xF3, 0xAE, 0xA6, 0x9F, 0x90, 0xFC, 0x70, 0x9F, 0xFC,
+    0x72, 0xAF, 0xE7, 0x4A, 0xFC, 0x97, 0x77, 0x77, 0x7F, 0xFC, 0xAA, 0x97, 0xFF, 0xFC, 0x95, 0xFF,
+    0xFD, 0xA4, 0xFF, 0xFE, 0xA3, 0xFC, 0x29, 0xAF, 0xD3, 0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xC9,
+    0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4, 0x9F, 0xC3, 0xFC, 0x3A, 0xFC, 0xA3, 0xFF,
+    0xFE, 0x4F, 0xFF, 0xCA, 0x5F, 0xFF, 0x96, 0xFF, 0xFC, 0x6F, 0xC2, 0xFC, 0x95, 0xFC, 0x29, 0xFC,
+    0x5F, 0xC3, 0xAF, 0xA4, 0xFC, 0x4F, 0xC9, 0x3F, 0xC4, 0xAF, 0xC3, 0xFC, 0x5F, 0xCA, 0x2F, 0xC5,
+    0x9F, 0xC9, 0x1F, 0xC6, 0xFD, 0x1F, 0xC7, 0xFC, 0xA0, 0x0A, 0xAA, 0x69, 0xAA, 0x90, 0xF9, 0x29,
+    0xF2, 0xFA, 0x0A, 0xF4, 0xFF, 0xC9, 0x5F, 0xE9, 0x69, 0xFC, 0xA7, 0x77, 0x49, 0xA9, 0x2A, 0xE9,
+    0x1A, 0xF9, 0x1A, 0xEA, 0x0A, 0xFC, 0x91, 0xAF, 0xAF, 0xD2, 0xAF, 0xFE, 0x2A, 0xFE, 0x91, 0x92,
+    0xAF, 0xCA, 0x7A, 0xFC, 0x70, 0xAF, 0xA7, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF,
+    0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97,
+    0x70, 0xAA, 0xAA, 0xA7, 0x2F, 0xCA, 0x71, 0xAF, 0xA7, 0x1A, 0xF9, 0x71, 0x9F, 0x73, 0xEA, 0x77,
+    0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x5A, 0xFF, 0xEA, 0x2F, 0xFF, 0xCA, 0x19, 0xFF, 0xFC, 0x2F, 0xD3,
+    0x9D, 0xA2, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFD, 0x72, 0xAF, 0xDA, 0x71, 0xFF, 0xA7, 0x0F,
+    0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xFF, 0xC7, 0x1F, 0xE9, 0x71, 0x9F, 0xD7, 0x29, 0xFC, 0x73, 0xFC,
+    0x09, 0x97, 0x0F, 0xC0, 0x9D, 0xA9, 0x4A, 0xFA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xCA, 0x19,
+    0xFF, 0xFA, 0x39, 0xAF, 0xFA, 0x72, 0x99, 0x97, 0x79, 0xAA, 0xAA, 0xA7, 0x9F, 0xC9, 0x7F, 0xC7,
+    0x0F, 0xC7, 0x0A, 0xEA, 0x70, 0x9E, 0x97, 0x77, 0x19, 0x9A, 0xA9, 0x96, 0xAF, 0xFA, 0x91, 0x9F,
+    0xFF, 0x1F, 0xFF, 0x90, 0x9F, 0xA3, 0xAD, 0x19, 0xF9, 0x70, 0x9F, 0xC9, 0x70, 0xFE, 0x96, 0xAF,
+    0xFA, 0x5A, 0xFF, 0xC9, 0x49, 0xFF, 0xC9, 0x6A, 0xFE, 0x70, 0xAF, 0xC7, 0x1A, 0xF9, 0x9A, 0x6A,
+    0xF9, 0x9E, 0xA9, 0x99, 0xAF, 0xC0, 0x9F, 0xFF, 0xA0, 0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x97, 0x99,
+    0x96, 0x5A, 0xAA, 0xAA, 0x72, 0xFD, 0xA7, 0x0A, 0xFE, 0x96, 0xAF, 0x9F, 0x94, 0xAE, 0xA2, 0xF4,
+    0xE9, 0x4A, 0xDA, 0x77, 0x77, 0x79, 0xAF, 0xDA, 0x95, 0xAF, 0xFE, 0xA2, 0xFF, 0xFC, 0xA1, 0x9F,
+    0xFF, 0xC2, 0xFD, 0x39, 0xDA, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xD7, 0x2A, 0xFD, 0xA7,
+    0x1F, 0xFA, 0x70, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0F, 0xFC, 0x71, 0xFE, 0x97, 0x19, 0xFD, 0x72,
+    0x9F, 0xC7, 0x3F, 0xC0, 0x99, 0x70, 0xFC, 0x09, 0xDA, 0x94, 0xAF, 0xA0, 0x9F, 0xFF, 0xD9, 0x09,
+    0xFF, 0xFC, 0xA1, 0x9F, 0xFF, 0xA3, 0x9A, 0xFF, 0xA7, 0x29, 0x99, 0x70, 0x4A, 0xAA, 0xA9, 0x70,
+    0xFD, 0x96, 0xFF, 0x94, 0xAE, 0xA9, 0xF3, 0xAE, 0xA1, 0x9F, 0x19, 0xE9, 0x4A, 0xDA, 0x77, 0x49,
+    0x9A, 0xA9, 0x96, 0xAF, 0xFA, 0x91, 0x9F, 0xFF, 0x1F, 0xFF, 0x90, 0x9F, 0xA3, 0xAD, 0x19, 0xF9,
+    0x70, 0x9F, 0xC9, 0x70, 0xFE, 0x96, 0xAF, 0xFA, 0x5A, 0xFF, 0xC9, 0x49, 0xFF, 0xC9, 0x6A, 0xFE,
+    0x70, 0xAF, 0xC7, 0x1A, 0xF9, 0x9A, 0x6A, 0xF9, 0x9E, 0xA9, 0x99, 0xAF, 0xC0, 0x9F, 0xFF, 0xA0,
+    0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x97, 0x99, 0x96, 0x77, 0x49, 0xAF, 0xDA, 0x95, 0xAF, 0xFE, 0xA2,
+    0xFF, 0xFC, 0xA1, 0x9F, 0xFF, 0xC2, 0xFD, 0x39, 0xDA, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F,
+    0xD7, 0x2A, 0xFD, 0xA7, 0x1F, 0xFA, 0x70, 0xFF, 0xC9, 0x7A, 0xFF, 0xC7, 0x0F, 0xFC, 0x71, 0xFE,
+    0x97, 0x19, 0xFD, 0x72, 0x9F, 0xC7, 0x3F, 0xC0, 0x99, 0x70, 0xFC, 0x09, 0xDA, 0x94, 0xAF, 0xA0,
+    0x9F, 0xFF, 0xD9, 0x09, 0xFF, 0xFC, 0xA1, 0x9F, 0xFF, 0xA3, 0x9A, 0xFF, 0xA7, 0x2E, 0x75, 0xE9,
+    0x73, 0x9F, 0xC7, 0x49, 0xEA, 0x74, 0xEA, 0x70, 0xAF, 0xD9, 0x70, 0xFE, 0x71, 0xAF, 0xA6, 0x49,
+    0x9A, 0xA9, 0x96, 0xAF, 0xFA, 0x91, 0x9F, 0xFF, 0x1F, 0xFF, 0x90, 0x9F, 0xA3, 0xAD, 0x19, 0xF9,
+    0x70, 0x9F, 0xC9, 0x70, 0xFE, 0x96, 0xAF, 0xFA, 0x5A, 0xFF, 0xC9, 0x49, 0xFF, 0xC9, 0x6A, 0xFE,
+    0x70, 0xAF, 0xC7, 0x1A, 0xF9, 0x9A, 0x6A, 0xF9, 0x9E, 0xA9, 0x99, 0xAF, 0xC0, 0x9F, 0xFF, 0xA0,
+    0x9F, 0xFE, 0xA2, 0xAF, 0xFC, 0x97, 0xAD, 0x97, 0x2E, 0xA7, 0x2A, 0xF9, 0x72, 0xF7, 0x2F, 0x6A,
+    0xCA, 0xFC, 0x6A, 0xFD, 0x79, 0xFA, 0x50, 0x1A, 0xAA, 0x69, 0xAA, 0x92, 0xF9, 0x29, 0xF4, 0xFA,
+    0x09, 0xF6, 0xFF, 0xC9, 0x7F, 0xE9, 0x70, 0x9F, 0xCA, 0x77, 0x77, 0x72, 0x9A, 0xFD, 0xA9, 0x5A,
+    0xFF, 0xEA, 0x2F, 0xFF, 0xCA, 0x19, 0xFF, 0xFC, 0x2F, 0xD3, 0x9D, 0xA2, 0xFC, 0x73, 0xFC, 0x73,
+    0xFC, 0x73, 0xFD, 0x72, 0xAF, 0xDA, 0x71, 0xFF, 0xA7, 0x0F, 0xFC, 0x97, 0xAF, 0xFC, 0x70, 0xFF,
+    0xC7, 0x1F, 0xE9, 0x71, 0x9F, 0xD7, 0x29, 0xFC, 0x73, 0xFC, 0x09, 0x97, 0x0F, 0xC0, 0x9D, 0xA9,
+    0x4A, 0xFA, 0x09, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xCA, 0x19, 0xFF, 0xFA, 0x39, 0xAF, 0xFA, 0x72,
+    0x99, 0x97, 0x0A, 0xAA, 0x69, 0xAA, 0x90, 0xF9, 0x29, 0xF2, 0xFA, 0x0A, 0xF4, 0xFF, 0xC9, 0x5F,
+    0xE9, 0x69, 0xFC, 0xA7, 0x77, 0x99, 0xAA, 0x99, 0x6A, 0xFF, 0xA9, 0x19, 0xFF, 0xF1, 0xFF, 0xF9,
+    0x09, 0xFA, 0x3A, 0xD1, 0x9F, 0x97, 0x09, 0xFC, 0x97, 0x0F, 0xE9, 0x6A, 0xFF, 0xA5, 0xAF, 0xFC,
+    0x94, 0x9F, 0xFC, 0x96, 0xAF, 0xE7, 0x0A, 0xFC, 0x71, 0xAF, 0x99, 0xA6, 0xAF, 0x99, 0xEA, 0x99,
+    0x9A, 0xFC, 0x09, 0xFF, 0xFA, 0x09, 0xFF, 0xEA, 0x2A, 0xFF, 0xC9, 0x79, 0x99, 0x60, 0x9F, 0xFF,
+    0xFC, 0x99, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x9F,
+    0xCA, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x6D, 0xA7, 0x6A, 0xDA, 0x97, 0x5A,
+    0xFA, 0x76, 0xAE, 0x76, 0xAE, 0x97, 0x2F, 0xE7, 0x3F, 0xDA, 0x73, 0xFC, 0x96, 0x77, 0x19, 0xE7,
+    0x1A, 0xE7, 0x1F, 0x70, 0x9F, 0x96, 0xAF, 0xFD, 0x1F, 0xFF, 0x1F, 0xFF, 0x1A, 0xAF, 0xCA, 0xAA,
+    0xAA, 0x3F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFD, 0xAA, 0xC9, 0x29, 0xFF, 0xC9, 0x3A, 0xFF, 0x94, 0xAF,
+    0xE7, 0x9D, 0xA7, 0x1A, 0xDA, 0x97, 0x0A, 0xFA, 0x71, 0xAE, 0x71, 0xAE, 0x59, 0xCA, 0xFC, 0x59,
+    0xFD, 0x96, 0xFA, 0x91, 0x2A, 0xAA, 0x95, 0x9A, 0xAA, 0x49, 0xEA, 0x3A, 0xE9, 0x5A, 0xF1, 0xFA,
+    0x7A, 0xFF, 0xA7, 0x1F, 0xF7, 0x3F, 0xD7, 0x77, 0x77, 0x39, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC,
+    0xA9, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFC, 0xA0, 0x99, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x96,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75,
+    0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x60, 0x76, 0x99, 0x99, 0x75, 0xAF, 0x75, 0xF9, 0x75, 0xF4, 0x9E,
+    0x49, 0xE5, 0xAE, 0x4A, 0xDA, 0x5F, 0x75, 0x9F, 0x97, 0x3A, 0xFF, 0xD6, 0xFF, 0xF6, 0xFF, 0xF6,
+    0xAA, 0xFC, 0xAA, 0xAA, 0xA7, 0x0F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC9, 0x74, 0xAF, 0xDA, 0xAC, 0x97, 0x9F, 0xFC,
+    0x97, 0x0A, 0xFF, 0x97, 0x1A, 0xFE, 0x75, 0x99, 0x70, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xCA,
+    0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x99, 0x6F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x1F, 0xFF, 0xC5, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xC5, 0xFF, 0xFC, 0x59, 0x99, 0x9F, 0xC9, 0x99, 0x97, 0x1F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC6, 0x77, 0x19, 0xE7, 0x1A, 0xE7,
+    0x1F, 0x70, 0x9F, 0x96, 0xAF, 0xFD, 0x1F, 0xFF, 0x1F, 0xFF, 0x1A, 0xAF, 0xCA, 0xAA, 0xAA, 0x3F,
+    0xC7, 0x0F, 0xC6, 0x99, 0xFC, 0x99, 0x99, 0x2F, 0xFE, 0x91, 0xFF, 0xE9, 0x1F, 0xFE, 0x93, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x97, 0xAF, 0xDA, 0xAC, 0x92, 0x9F, 0xFC, 0x93, 0xAF, 0xF9,
+    0x4A, 0xFE, 0x70, 0x99, 0x30, 0x77, 0x71, 0xFA, 0x29, 0xD9, 0x7F, 0xEA, 0xAE, 0x7A, 0xFF, 0xF7,
+    0xE9, 0x09, 0xFD, 0x70, 0xD9, 0x39, 0xAC, 0xA7, 0x77, 0x77, 0x71, 0xFA, 0x70, 0xAF, 0x90, 0xFC,
+    0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC,
+    0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC,
+    0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC,
+    0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xFC, 0x90, 0xFC,
+    0x97, 0xFC, 0x1F, 0xCA, 0x6A, 0xFC, 0x19, 0xFC, 0xA4, 0xAF, 0xCA, 0x2F, 0xFF, 0xFC, 0x4F, 0xFF,
+    0xE9, 0x5F, 0xFF, 0xC7, 0x09, 0xFF, 0xC9, 0x75, 0x99, 0x97, 0x00, 0x77, 0x5A, 0xEA, 0x3D, 0xA4,
+    0xAF, 0xEA, 0xE9, 0x4F, 0xFF, 0x4A, 0xD9, 0x09, 0xFD, 0x94, 0xAC, 0xA3, 0x9A, 0xCA, 0x77, 0x77,
+    0x70, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF, 0xC0, 0xAF,
+    0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF, 0xD9, 0x1F,
+    0x69, 0x97, 0x10, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71, 0xFF, 0xE7, 0x1F, 0xFE, 0x71, 0xFF,
+    0xE7, 0x77, 0x77, 0x7F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC, 0xA6, 0xAF, 0xC1, 0x9F,
+    0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0x70, 0x9F, 0xFC, 0x97,
+    0x59, 0x99, 0x70, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xFF, 0xD9, 0x5A, 0xFF, 0xD9, 0x5A,
+    0xFF, 0xD9, 0x77, 0x77, 0x6A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xFA,
+    0x4A, 0xFC, 0x0A, 0xFC, 0x92, 0x9F, 0xD0, 0x9F, 0xEA, 0xFF, 0x1F, 0xFF, 0xF2, 0xFF, 0xCA, 0x0F,
+    0x3A, 0xFD, 0x91, 0xF6, 0x99, 0x71, 0x39, 0xAA, 0x69, 0xAA, 0x79, 0xDA, 0x49, 0xE7, 0x0F, 0xAA,
+    0xAF, 0xA7, 0x09, 0xFF, 0xD7, 0x29, 0xFF, 0x75, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x71, 0xFA, 0x70,
+    0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70,
+    0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70,
+    0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70,
+    0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70,
+    0xFC, 0x90, 0xFC, 0x97, 0xFC, 0x1F, 0xCA, 0x6A, 0xFC, 0x19, 0xFC, 0xA4, 0xAF, 0xCA, 0x2F, 0xFF,
+    0xFC, 0x4F, 0xFF, 0xE9, 0x5F, 0xFF, 0xC7, 0x09, 0xFF, 0xC9, 0x75, 0x99, 0x97, 0x00, 0x2A, 0xA9,
+    0x6A, 0xA9, 0x4E, 0x5E, 0x94, 0xAF, 0xAA, 0xFC, 0x6F, 0xFD, 0x97, 0xFF, 0x97, 0x19, 0xAD, 0xA9,
+    0x77, 0x77, 0x71, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF,
+    0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF,
+    0xD9, 0x1F, 0x69, 0x97, 0x10, 0x7A, 0xDA, 0x97, 0x6F, 0xD9, 0x74, 0xAD, 0xA9, 0xE7, 0x4D, 0xA1,
+    0x9D, 0x97, 0x3D, 0xA1, 0x9D, 0x97, 0x3A, 0xDA, 0xAE, 0x75, 0xFD, 0x97, 0x6A, 0xDA, 0x77, 0x77,
+    0x77, 0x3F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC, 0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A,
+    0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99,
+    0x70, 0x59, 0xEA, 0x73, 0x9F, 0xD7, 0x2E, 0x9A, 0xDA, 0x71, 0xD9, 0x1E, 0x71, 0xD9, 0x1E, 0x71,
+    0xEA, 0xAD, 0xA7, 0x19, 0xFD, 0x73, 0x9A, 0xDA, 0x77, 0x77, 0x72, 0xAF, 0x95, 0xFC, 0x0A, 0xF9,
+    0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0,
+    0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95,
+    0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF, 0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF,
+    0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF, 0xD9, 0x1F, 0x69, 0x97, 0x10, 0x59, 0xAA, 0xAA,
+    0x09, 0xAA, 0xAA, 0x97, 0x9F, 0xA0, 0xFC, 0x70, 0xFA, 0x0A, 0xF7, 0x0A, 0xEA, 0x1F, 0x70, 0x9E,
+    0x91, 0xEA, 0x71, 0xAD, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x2F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F,
+    0xC1, 0xFC, 0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95,
+    0xFF, 0xFC, 0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99, 0x70, 0x39, 0xAA, 0xAA, 0x1A, 0xAA, 0xA9, 0x5F,
+    0xC0, 0xAF, 0x94, 0xFC, 0x09, 0xF9, 0x49, 0xEA, 0x1F, 0x95, 0xEA, 0x1A, 0xE6, 0xAD, 0x92, 0xDA,
+    0x77, 0x77, 0x72, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0xA4, 0xAF,
+    0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0, 0xF3, 0xAF,
+    0xD9, 0x1F, 0x69, 0x97, 0x10, 0x0F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A,
+    0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC, 0xA6, 0xAF,
+    0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC, 0x70, 0x9F,
+    0xFD, 0x75, 0x99, 0x9E, 0x97, 0x7A, 0xDA, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x71, 0xEA, 0x77, 0x0F,
+    0xD9, 0x75, 0xAF, 0xC9, 0x76, 0x9F, 0x30, 0x77, 0x1A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A,
+    0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0x95, 0xFC, 0x0A, 0xFA, 0x4A, 0xFC, 0x0A, 0xFC, 0x92, 0x9F, 0xD0, 0x9F, 0xEA, 0xFF, 0x1F, 0xFF,
+    0xF2, 0xFF, 0xCA, 0x0F, 0x3A, 0xFD, 0x91, 0xF6, 0x99, 0x39, 0xDA, 0x74, 0x9E, 0x75, 0xE7, 0x59,
+    0xE7, 0x59, 0xEA, 0x99, 0x73, 0xFD, 0x73, 0xAF, 0xC7, 0x49, 0xAA, 0xAA, 0x00, 0x74, 0x9A, 0xAA,
+    0xA9, 0x77, 0x71, 0x9F, 0xD9, 0x77, 0x70, 0xFF, 0x77, 0x7F, 0xAA, 0xF7, 0x75, 0xF9, 0x19, 0xF7,
+    0x73, 0x9E, 0x5E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xF7, 0x9F, 0x97, 0xAF, 0x0A, 0xF9, 0x6A,
+    0xFC, 0x7F, 0xC0, 0x9F, 0xA6, 0xFD, 0x69, 0xFA, 0x1F, 0xA6, 0xFD, 0x95, 0xAF, 0x91, 0xFC, 0x59,
+    0xFD, 0xA5, 0xAF, 0x2A, 0xF5, 0xAF, 0xE5, 0xFC, 0x29, 0xF9, 0x4F, 0xF5, 0xFA, 0x3F, 0xA4, 0xFA,
+    0xE9, 0x39, 0xF9, 0x3F, 0xC3, 0x9E, 0xA9, 0xEA, 0x3A, 0xF4, 0xAF, 0x3A, 0xE9, 0x0F, 0x3F, 0xC4,
+    0x9F, 0x92, 0xF1, 0xF3, 0xFA, 0x5F, 0xA2, 0xF1, 0xF9, 0x19, 0xF9, 0x5F, 0xC1, 0x9F, 0x1A, 0xEA,
+    0x1A, 0xF6, 0xAF, 0x1A, 0xE9, 0x19, 0xF1, 0xFC, 0x69, 0xF9, 0x0F, 0x3F, 0x1F, 0xA7, 0xF9, 0x0F,
+    0x3F, 0x99, 0xF9, 0x7F, 0xA9, 0xEA, 0x3A, 0xEA, 0x9F, 0x70, 0xAF, 0xAE, 0x94, 0xFA, 0xF7, 0x09,
+    0xFF, 0x5F, 0xFA, 0x71, 0xFF, 0x5A, 0xFE, 0x97, 0x1F, 0xEA, 0x59, 0xFE, 0x72, 0xAF, 0xD9, 0x6F,
+    0xE7, 0x29, 0xFD, 0x7F, 0xDA, 0x73, 0xFD, 0x7A, 0xFC, 0x95, 0x73, 0xAA, 0xAA, 0xA7, 0x76, 0xFD,
+    0xA7, 0x74, 0xAF, 0xE9, 0x77, 0x2A, 0xF9, 0xF9, 0x77, 0x09, 0xEA, 0x2F, 0x97, 0x7E, 0x94, 0xAE,
+    0x77, 0x77, 0x77, 0x77, 0x19, 0xF9, 0x4A, 0xFC, 0x5F, 0xC1, 0xFA, 0x4F, 0xD9, 0x4F, 0xA1, 0xFC,
+    0x4F, 0xDA, 0x39, 0xF9, 0x1A, 0xF3, 0x9F, 0xE3, 0xAF, 0x29, 0xF9, 0x2A, 0xEA, 0xE3, 0xFC, 0x3F,
+    0xA2, 0xEA, 0x9E, 0x92, 0xFA, 0x3F, 0xC2, 0xEA, 0x0E, 0xA1, 0x9F, 0x93, 0x9F, 0x90, 0x9E, 0x90,
+    0xF1, 0xAF, 0x5F, 0xA0, 0xAE, 0x1A, 0xE1, 0xFA, 0x5F, 0xA0, 0xF1, 0x9E, 0x90, 0xF9, 0x5A, 0xF0,
+    0xEA, 0x2E, 0xA9, 0xF6, 0x9F, 0x0E, 0x92, 0xEA, 0xAF, 0x7F, 0xAE, 0x3A, 0xEA, 0xEA, 0x7F, 0xF3,
+    0x9F, 0xE9, 0x79, 0xFD, 0xA4, 0xFE, 0x71, 0xFD, 0x94, 0xFD, 0xA7, 0x1F, 0xD5, 0xFD, 0x97, 0x1A,
+    0xFC, 0x5A, 0xFC, 0x50, 0x7A, 0xAA, 0xAA, 0x76, 0xFD, 0xA7, 0x4A, 0xFE, 0xA7, 0x2A, 0xF9, 0xF9,
+    0x70, 0x9F, 0x2F, 0x97, 0xEA, 0x4A, 0xE7, 0x77, 0x77, 0x5A, 0xFA, 0x70, 0xAF, 0xA9, 0xFC, 0x79,
+    0xFC, 0x1F, 0xCA, 0x6F, 0xCA, 0x2F, 0xC5, 0x9F, 0xC3, 0xAF, 0xA4, 0xFC, 0xA4, 0xFC, 0x39, 0xFC,
+    0x5A, 0xFA, 0x2F, 0xC9, 0x6F, 0xC1, 0x9F, 0xC7, 0xAF, 0xA0, 0xAF, 0x97, 0x0F, 0xC9, 0xFC, 0x71,
+    0x9F, 0xFC, 0x97, 0x2F, 0xFC, 0x73, 0x9F, 0xE7, 0x5F, 0xDA, 0x75, 0x9F, 0xC7, 0x7F, 0xC7, 0x7F,
+    0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x6A,
+    0xAA, 0xAA, 0x75, 0xAF, 0xD7, 0x3A, 0xFE, 0xA7, 0x19, 0xF9, 0xF9, 0x79, 0xF2, 0xF9, 0x6E, 0xA4,
+    0xAE, 0x77, 0x77, 0x73, 0xAF, 0xA6, 0x9F, 0xC0, 0x9F, 0xC6, 0xAF, 0x91, 0xFC, 0x6F, 0xC2, 0xAF,
+    0xA4, 0x9F, 0xA3, 0xFC, 0x4A, 0xF9, 0x3A, 0xF4, 0xFC, 0x49, 0xFA, 0x29, 0xFA, 0x5F, 0xC2, 0xAF,
+    0x6A, 0xF2, 0xFC, 0x7F, 0xA0, 0x9F, 0x97, 0xAF, 0x0A, 0xF7, 0x09, 0xF0, 0xFA, 0x71, 0xFA, 0xF9,
+    0x71, 0xAF, 0xF7, 0x3F, 0xEA, 0x73, 0xAF, 0xD7, 0x49, 0xFD, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x59,
+    0xFA, 0x75, 0xFC, 0x74, 0x9F, 0xD7, 0x1F, 0xFC, 0x72, 0xFF, 0xA7, 0x2F, 0xE9, 0x73, 0xAF, 0xA7,
+    0x40, 0x77, 0x71, 0xAD, 0x92, 0xAD, 0xA7, 0x09, 0xF2, 0xF7, 0x09, 0xF2, 0xF9, 0x70, 0xEA, 0x2F,
+    0x72, 0x97, 0x77, 0x77, 0x77, 0xAF, 0xA7, 0x0A, 0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC,
+    0xA2, 0xFC, 0x59, 0xFC, 0x3A, 0xFA, 0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96,
+    0xFC, 0x19, 0xFC, 0x7A, 0xFA, 0x0A, 0xF9, 0x70, 0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF,
+    0xC7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x59, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x70, 0x71, 0xAA, 0xAA, 0xA9, 0x73,
+    0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFA, 0x74, 0xF9, 0x74, 0xAE, 0x77, 0x77, 0x77, 0xAF, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xC9,
+    0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73,
+    0xFC, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0xA7, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9,
+    0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x97, 0x3F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xCA, 0x79, 0xAA, 0xAA, 0xA7, 0x9F, 0xC9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0A, 0xEA,
+    0x70, 0x9E, 0x97, 0x77, 0x73, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xFC, 0xA7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFA, 0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x97, 0xAF, 0xA7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFF, 0xFC, 0x9F, 0xFF, 0xD9, 0xFF,
+    0xFD, 0x9F, 0xFF, 0xD9, 0x70, 0x99, 0x76, 0x9F, 0x75, 0xFC, 0xA7, 0x4F, 0xCA, 0x74, 0x9F, 0x76,
+    0x9A, 0x97, 0x77, 0x77, 0x6A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFC, 0x97, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73,
+    0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3F, 0xCA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xCA,
+    0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC9, 0x73, 0xFF, 0xFF,
+    0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0x59, 0x97, 0x3F, 0x97,
+    0x09, 0xFC, 0x70, 0x9F, 0xC7, 0x1F, 0xA7, 0x29, 0xA9, 0x77, 0x77, 0x3A, 0xFF, 0xFC, 0x0A, 0xFF,
+    0xFC, 0x0A, 0xFF, 0xFC, 0x09, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x70, 0xFC, 0x70, 0xFC, 0x97, 0xAF,
+    0xA7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A, 0xFA, 0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x97,
+    0xAF, 0xFF, 0xC9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x90, 0x2A, 0xAA, 0x95, 0x9A, 0xAA,
+    0x49, 0xEA, 0x3A, 0xEA, 0x5A, 0xF1, 0xFA, 0x7A, 0xFF, 0xA7, 0x1F, 0xF7, 0x3F, 0xD7, 0x77, 0x77,
+    0x4A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xFC, 0x97, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFC,
+    0x74, 0xFC, 0x97, 0x3F, 0xCA, 0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xCA, 0x73, 0xAF, 0xC7, 0x39,
+    0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC9, 0x73, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0x0A, 0xAA, 0x69, 0xAA, 0x90, 0xF9, 0x29, 0xF2,
+    0xFA, 0x0A, 0xF4, 0xFF, 0xC9, 0x5F, 0xE9, 0x69, 0xFC, 0xA7, 0x77, 0x71, 0xAF, 0xFF, 0xC0, 0xAF,
+    0xFF, 0xC0, 0xAF, 0xFF, 0xC0, 0x9A, 0xAA, 0xAA, 0xAA, 0xFC, 0xA7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7A,
+    0xFA, 0x79, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x97, 0xAF, 0xA7, 0x9F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9,
+    0x7A, 0xFF, 0xFC, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9, 0x49, 0x99, 0x99, 0x39, 0xFF,
+    0x90, 0x9F, 0xFC, 0x1F, 0xFD, 0x1F, 0xCA, 0x99, 0xA9, 0x09, 0xFC, 0x59, 0xFA, 0x59, 0xFA, 0x59,
+    0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59,
+    0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59, 0xFA, 0x59,
+    0xFA, 0x59, 0xFA, 0x50, 0x77, 0x69, 0x99, 0x97, 0x76, 0xFC, 0x96, 0x9A, 0xFE, 0xA4, 0xFC, 0x59,
+    0xFF, 0xFA, 0x2F, 0xC4, 0xAF, 0xFF, 0xE0, 0xAF, 0x93, 0xAF, 0xFF, 0xFF, 0xCA, 0x39, 0xFD, 0xA9,
+    0x29, 0xFF, 0xD4, 0xFD, 0x96, 0xFE, 0xA4, 0x9F, 0xC9, 0x70, 0xFC, 0xA5, 0xAF, 0xC7, 0x1A, 0xFC,
+    0x5F, 0xCA, 0x71, 0x9F, 0xC5, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0x73,
+    0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC,
+    0xA7, 0x2F, 0xC5, 0xAF, 0xC7, 0x1A, 0xFC, 0x59, 0xFC, 0x97, 0x0F, 0xCA, 0x6F, 0xD7, 0xAF, 0xC9,
+    0x69, 0xFD, 0xA3, 0x9F, 0xE7, 0x0F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0x97, 0x3A, 0xFF, 0xFC, 0x77,
+    0xAF, 0xFA, 0x97, 0x74, 0x99, 0x97, 0x50, 0x77, 0x09, 0xFA, 0x77, 0x09, 0xFA, 0x69, 0x9A, 0x99,
+    0x4A, 0xF9, 0x39, 0xFF, 0xA2, 0xFC, 0x3A, 0xFF, 0xEA, 0xFC, 0x92, 0xAF, 0xFF, 0xFC, 0xA3, 0xFD,
+    0xAA, 0xAF, 0xF9, 0x3A, 0xFC, 0x4F, 0xCA, 0x5F, 0xC9, 0x49, 0xFC, 0x5F, 0xC6, 0xFC, 0x49, 0xFC,
+    0x6F, 0xC4, 0x9F, 0xA6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x5F,
+    0xC9, 0x4A, 0xFC, 0x5A, 0xFC, 0x39, 0xFC, 0x96, 0xFE, 0xAF, 0xE7, 0x9F, 0xFF, 0xC7, 0x19, 0xFF,
+    0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09, 0x99, 0x73, 0x77, 0x77, 0x70, 0x9F, 0xEA, 0x95, 0xAF, 0xCA,
+    0x97, 0x9F, 0xFF, 0x91, 0xAF, 0xFC, 0xA5, 0xAF, 0xFF, 0xDA, 0xFF, 0xF9, 0x3A, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x29, 0xFD, 0xA9, 0x19, 0xAF, 0xF9, 0x19, 0xFD, 0x91, 0xFD, 0x95, 0x9F, 0xD5, 0xFC, 0xA1,
+    0xFC, 0xA7, 0xAF, 0xC5, 0xAF, 0xA0, 0xAF, 0xC7, 0x1F, 0xC9, 0x49, 0xFC, 0x0F, 0xCA, 0x71, 0xFC,
+    0xA4, 0x9F, 0xC0, 0xFC, 0xA7, 0x1A, 0xFC, 0x49, 0xFC, 0x0F, 0xC9, 0x71, 0xAF, 0xC4, 0x9F, 0xC0,
+    0xFC, 0x97, 0x19, 0xFC, 0x49, 0xFC, 0x0F, 0xC9, 0x71, 0x9F, 0xC4, 0x9F, 0xC0, 0xFC, 0x97, 0x1A,
+    0xFC, 0x49, 0xFC, 0x0F, 0xCA, 0x71, 0xAF, 0xC4, 0x9F, 0xC0, 0xFC, 0xA7, 0x1F, 0xCA, 0x49, 0xFC,
+    0x0A, 0xFC, 0x71, 0xFC, 0x94, 0x9F, 0xC0, 0x9F, 0xC9, 0x7A, 0xFC, 0x59, 0xFC, 0x1F, 0xD6, 0x9F,
+    0xD5, 0x9F, 0xC1, 0x9F, 0xDA, 0x3A, 0xFD, 0x95, 0x9F, 0xC2, 0xFF, 0xFF, 0xCA, 0x69, 0xFC, 0x3F,
+    0xFF, 0xF7, 0x9F, 0xC4, 0xAF, 0xFF, 0xA7, 0x09, 0xFC, 0x6A, 0xFF, 0xA7, 0x29, 0xFC, 0x71, 0x99,
+    0x97, 0x74, 0x69, 0xAA, 0x97, 0x9A, 0xA9, 0x70, 0x9F, 0xF9, 0x2F, 0xF5, 0xAF, 0xFD, 0xA9, 0xFF,
+    0xD3, 0xAF, 0xFF, 0xFF, 0xEA, 0x19, 0xFD, 0xAA, 0xFF, 0xA9, 0xAF, 0xD1, 0xFC, 0xA3, 0xAF, 0xC4,
+    0xFC, 0x90, 0xFC, 0x5F, 0xC4, 0xAF, 0x99, 0xFC, 0x5F, 0xC9, 0x3A, 0xF9, 0x9F, 0xA5, 0xAF, 0x93,
+    0xAF, 0x99, 0xFA, 0x5A, 0xF9, 0x3A, 0xF9, 0x9F, 0xA5, 0xAF, 0x93, 0xAF, 0x99, 0xFA, 0x5A, 0xF9,
+    0x3A, 0xF9, 0x9F, 0xC5, 0xFC, 0x4A, 0xF9, 0x0F, 0xC5, 0xFC, 0x4A, 0xF9, 0x0A, 0xFC, 0x3F, 0xCA,
+    0x4A, 0xF9, 0x1F, 0xDA, 0xAF, 0xD5, 0xAF, 0x91, 0x9F, 0xFF, 0x95, 0xAF, 0x92, 0xAF, 0xFD, 0xA6,
+    0xAF, 0x94, 0xAF, 0xDA, 0x70, 0xAF, 0x97, 0x99, 0x73, 0xAF, 0x97, 0x75, 0xAF, 0x97, 0x75, 0xAF,
+    0x97, 0x75, 0xAF, 0x97, 0x75, 0xAF, 0x97, 0x75, 0xAF, 0x97, 0x75, 0xAF, 0x97, 0x75, 0xAF, 0x90,
+    0x29, 0xAF, 0xFE, 0xAA, 0x96, 0xFF, 0xFF, 0xD9, 0x3F, 0xFF, 0xFF, 0xA1, 0x9F, 0xFF, 0xFF, 0xC9,
+    0x0A, 0xFA, 0xAF, 0xCA, 0x99, 0xAF, 0xE0, 0xF9, 0x1F, 0xC4, 0xAF, 0xC0, 0xAE, 0x91, 0xFC, 0x5F,
+    0xC9, 0x9A, 0xAA, 0x91, 0xFC, 0x5F, 0xC9, 0x6F, 0xC5, 0xFC, 0x96, 0xFC, 0x5F, 0xC9, 0x6F, 0xC4,
+    0xFD, 0x7F, 0xCA, 0xAA, 0xFE, 0xA7, 0xFF, 0xFE, 0x70, 0xFF, 0xFD, 0x71, 0xFF, 0xFA, 0x72, 0xFC,
+    0xAA, 0xAA, 0x97, 0x5F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xC7, 0x72,
+    0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x73, 0x39, 0x99, 0x97, 0x39, 0xFC, 0xA7, 0x19, 0xFD, 0xA7,
+    0x1F, 0xEA, 0x70, 0x9F, 0xCA, 0xAA, 0x70, 0x9F, 0xC7, 0x39, 0xFA, 0x73, 0x9F, 0xA2, 0x9A, 0x99,
+    0x49, 0xFA, 0x0A, 0xFD, 0x92, 0x9F, 0xAF, 0xFC, 0x91, 0x9F, 0xFF, 0xE1, 0x9F, 0xEA, 0xAF, 0xDA,
+    0x09, 0xFC, 0xA3, 0xAF, 0xC0, 0x9F, 0xC5, 0xFC, 0x99, 0xFC, 0x5A, 0xFA, 0x9F, 0xA5, 0xAF, 0xA9,
+    0xFA, 0x5A, 0xFA, 0x9F, 0xA5, 0xAF, 0xA9, 0xFC, 0x5A, 0xFA, 0x9F, 0xC5, 0xFC, 0xA9, 0xFC, 0x94,
+    0xFC, 0x99, 0xFD, 0x3F, 0xD0, 0x9F, 0xFF, 0xEA, 0x09, 0xFF, 0xFE, 0x19, 0xFA, 0xFF, 0xC9, 0x19,
+    0xFA, 0x0A, 0xFD, 0x39, 0xFA, 0x39, 0x95, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x39, 0xFA,
+    0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xA7, 0x30, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC,
+    0xA9, 0x99, 0x97, 0x1F, 0xFF, 0xA6, 0xFF, 0xFD, 0x94, 0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0x3F, 0xC4,
+    0xAF, 0xC9, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5A, 0xFA, 0x2F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC9,
+    0x2F, 0xC3, 0x9F, 0xD3, 0xFF, 0xFE, 0x93, 0xFF, 0xFD, 0x94, 0xFF, 0xFC, 0x6F, 0xFF, 0x96, 0xFC,
+    0x99, 0x9F, 0xC6, 0xFC, 0x29, 0xFC, 0x5F, 0xC3, 0xFC, 0xA4, 0xFC, 0x39, 0xFC, 0x4F, 0xC4, 0xAF,
+    0xC3, 0xFC, 0x5F, 0xCA, 0x75, 0x9F, 0xC7, 0x6F, 0xD7, 0x6F, 0xCA, 0x75, 0x99, 0x99, 0x99, 0x00,
+    0x77, 0x29, 0xAF, 0xDA, 0x93, 0xAF, 0xFE, 0xA2, 0xAF, 0xFF, 0xC2, 0xFF, 0xFC, 0x91, 0xEA, 0x91,
+    0x9F, 0xCA, 0x19, 0x69, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xC7, 0x09, 0xFC, 0xA6, 0x9F, 0xE9, 0x49,
+    0xFF, 0xA3, 0x9F, 0xFD, 0x39, 0xFF, 0xC9, 0x39, 0xFF, 0xA5, 0xFE, 0x96, 0x9F, 0xCA, 0x70, 0xAF,
+    0xC7, 0x1A, 0xF9, 0x71, 0xAF, 0xA7, 0x09, 0x9F, 0xC9, 0x49, 0xE0, 0xFF, 0xFE, 0x09, 0xFF, 0xFD,
+    0x19, 0xFF, 0xFC, 0x3A, 0xFF, 0xA9, 0x79, 0x99, 0x50, 0x39, 0x9A, 0xA9, 0x95, 0x9F, 0xFC, 0xA3,
+    0xFF, 0xF2, 0xAF, 0xFF, 0x2D, 0xA9, 0x99, 0xAF, 0xC2, 0x95, 0xFC, 0x97, 0x9F, 0xC6, 0x9F, 0xE4,
+    0xAF, 0xF9, 0x29, 0xFF, 0xCA, 0x2A, 0xFF, 0xA4, 0xFE, 0xA5, 0xAF, 0xCA, 0x7A, 0xF9, 0x70, 0xAF,
+    0x95, 0x9A, 0x09, 0xFC, 0xA9, 0x9A, 0xAE, 0x1F, 0xFF, 0xC1, 0x9F, 0xFF, 0x3A, 0xFF, 0xA7, 0x99,
+    0x99, 0x40, 0x0A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xAF, 0xC7, 0x5A, 0xFC,
+    0x75, 0xAF, 0xC7, 0x5F, 0xD7, 0x5F, 0xC7, 0x4A, 0xFA, 0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x73, 0x9F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xFC, 0x97, 0x3A, 0xFA, 0x74, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0x29, 0xAA, 0xA9, 0x72, 0xFE, 0xA7, 0xFF,
+    0xC9, 0x6E, 0x1F, 0xC5, 0x9E, 0x1A, 0xF6, 0xEA, 0x0A, 0xF9, 0x5A, 0xFF, 0xC9, 0x6A, 0xFF, 0x97,
+    0x09, 0x9F, 0xC9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97,
+    0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A,
+    0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9,
+    0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0xC3, 0x95, 0x9F, 0xFC, 0xA6, 0xFF, 0xCA, 0x7F, 0xFA,
+    0x70, 0xAF, 0xCA, 0x00, 0x77, 0x2E, 0x71, 0xAE, 0x71, 0xF7, 0x0A, 0xF9, 0x6A, 0xFF, 0xD9, 0x0F,
+    0xFF, 0x90, 0xFF, 0xF9, 0x0A, 0xAF, 0xCA, 0xAA, 0xAA, 0x3F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x7F, 0xCA, 0x7A, 0xFD, 0xAD,
+    0x92, 0x9F, 0xFC, 0x93, 0xAF, 0xF9, 0x4A, 0xFE, 0x97, 0x9F, 0x97, 0x0F, 0x97, 0x0F, 0x97, 0x0F,
+    0x95, 0xFE, 0x6F, 0xE6, 0xFD, 0x96, 0xAF, 0x91, 0x29, 0xAF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0x0F,
+    0xFF, 0xFE, 0x9F, 0xFF, 0xFE, 0xAF, 0xA9, 0x9A, 0xFA, 0x99, 0x99, 0x99, 0xF9, 0x2A, 0xF9, 0x5F,
+    0x3A, 0xF9, 0x59, 0xE9, 0x2A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9,
+    0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75,
+    0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x50, 0x69,
+    0x99, 0x99, 0x6A, 0xFD, 0xA4, 0xAF, 0xEA, 0x39, 0xFF, 0xA3, 0xAF, 0xCA, 0xAA, 0xA3, 0xFC, 0x97,
+    0xFC, 0x70, 0xFC, 0x96, 0xAF, 0xFD, 0x90, 0xFF, 0xF9, 0x0F, 0xFF, 0x90, 0xAA, 0xFC, 0xAA, 0xAA,
+    0xA3, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0xA7, 0xAF, 0xDA, 0xD9, 0x29, 0xFF, 0xC9, 0x3A, 0xFF, 0x94, 0xAF, 0xE9,
+    0x79, 0x93, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA,
+    0x09, 0x99, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xCA, 0x74, 0xAF, 0xF7, 0x2F, 0xF7, 0x29, 0xFE, 0x74, 0xAF, 0x92,
+    0x77, 0x69, 0x99, 0x97, 0x76, 0x9F, 0xA0, 0xFA, 0x70, 0xAF, 0x90, 0xAF, 0x90, 0xFC, 0x70, 0xAF,
+    0x90, 0xFC, 0x1F, 0xC7, 0x0A, 0xF9, 0xAF, 0xA1, 0xFC, 0x70, 0xAF, 0xFD, 0x2F, 0xC7, 0x0A, 0xFF,
+    0xC3, 0xFC, 0x70, 0xAF, 0xE9, 0x4F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A,
+    0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A,
+    0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0F,
+    0xC9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0F, 0xCA, 0x6A, 0xFC, 0x70, 0x9F, 0xCA, 0x4A, 0xFC, 0xA7, 0x1F,
+    0xFF, 0xFC, 0x73, 0xFF, 0xFE, 0x97, 0x4F, 0xFF, 0xC7, 0x79, 0xFF, 0xC9, 0x77, 0x49, 0x99, 0x77,
+    0x77, 0x2A, 0xF9, 0x77, 0x2F, 0xC7, 0x73, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0x9F, 0xA0, 0xAF, 0x95,
+    0xFC, 0x9F, 0xC1, 0xAF, 0x95, 0xFF, 0xD9, 0x1A, 0xF9, 0x5F, 0xFC, 0x92, 0xAF, 0x95, 0xFD, 0xA9,
+    0x4A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9,
+    0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0xA4, 0xAF, 0xC7, 0xAF, 0xC9, 0x29,
+    0xFD, 0x79, 0xFE, 0xAF, 0xF7, 0x0F, 0xFF, 0xF7, 0x1F, 0xFC, 0xA0, 0xF7, 0x2A, 0xFD, 0x91, 0xF7,
+    0x59, 0x97, 0x70, 0x9A, 0xAA, 0xAA, 0x4F, 0xCA, 0x4F, 0xC9, 0x4A, 0xF5, 0x9F, 0x6E, 0xA0, 0x4A,
+    0xAA, 0xAA, 0x4F, 0xCA, 0x3F, 0xC9, 0x3A, 0xF9, 0x39, 0xF5, 0xEA, 0x50, 0x39, 0xAA, 0xAA, 0x96,
+    0x9F, 0xD6, 0xFF, 0x4F, 0x9A, 0xF2, 0xF9, 0x1A, 0xEA, 0x0A, 0xDA, 0x49, 0xE9, 0x77, 0x1F, 0xA2,
+    0x9D, 0x91, 0xFE, 0xAA, 0xE1, 0xAF, 0xFE, 0xA1, 0xE9, 0x0A, 0xFD, 0x2D, 0x93, 0x9A, 0xC9, 0x20,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xFD, 0xAA, 0xFF, 0xDA, 0x9F, 0xFD, 0x90, 0x75, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0A, 0xAA, 0x6A, 0xAA,
+    0x0E, 0x5A, 0xDA, 0x0A, 0xFA, 0xAF, 0xC2, 0xFF, 0xDA, 0x3F, 0xFA, 0x59, 0xAD, 0xAA, 0x30, 0x19,
+    0x91, 0x9F, 0x9A, 0xFA, 0xAF, 0xA9, 0xF9, 0x19, 0x91, 0x73, 0x9E, 0x3E, 0x9F, 0xA1, 0xAF, 0xFA,
+    0x1A, 0xF9, 0xE2, 0x9E, 0x91, 0x95, 0x91, 0x9A, 0xAA, 0xA2, 0xFD, 0xA0, 0xFE, 0x09, 0x1A, 0xE9,
+    0x29, 0xE9, 0x19, 0xF1, 0x9E, 0xA2, 0x9D, 0xA7, 0x20, 0x19, 0xEA, 0x2A, 0xFD, 0x1E, 0x9A, 0xDA,
+    0x9D, 0x2E, 0x9D, 0x2E, 0x0E, 0x9A, 0xDA, 0x0A, 0xFD, 0x29, 0xAD, 0x91, 0x3A, 0xAA, 0xA9, 0x09,
+    0xAA, 0xAA, 0x3F, 0xC0, 0x9F, 0xA2, 0x9F, 0x90, 0xFA, 0x3F, 0x1A, 0xEA, 0x3A, 0xE1, 0x9E, 0x94,
+    0xDA, 0x2A, 0xD5, 0x9A, 0xA9, 0x6A, 0xAA, 0x1F, 0x3A, 0xEA, 0x19, 0xF9, 0x0F, 0xC3, 0x9F, 0xFC,
+    0x5A, 0xFE, 0x7A, 0xFC, 0x93, 0x9A, 0xA9, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xA3, 0x9A,
+    0xAA, 0x1A, 0xAA, 0x9A, 0xE1, 0xEA, 0xAE, 0x1E, 0xAA, 0xE1, 0xEA, 0xAE, 0x1E, 0xAA, 0xE1, 0xEA,
+    0x71, 0xAA, 0xAA, 0x90, 0x9A, 0xAA, 0xA2, 0xAF, 0x1F, 0xA2, 0xAE, 0xA1, 0xF3, 0xAE, 0x90, 0x9F,
+    0x3A, 0xE2, 0xE9, 0x3A, 0xD9, 0x2D, 0xA0, 0x49, 0x97, 0x0F, 0x7F, 0x3A, 0xA9, 0x0F, 0x09, 0xAA,
+    0xAD, 0x1A, 0xA1, 0xDA, 0x9D, 0xA3, 0xE9, 0x0F, 0xFD, 0x2F, 0xF4, 0x9A, 0xDA, 0x92, 0x39, 0xAA,
+    0xAA, 0x96, 0xFF, 0x93, 0xFF, 0xD9, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x09, 0xD9, 0x59, 0xD9, 0x29,
+    0xE3, 0xF2, 0x9E, 0xA2, 0xAE, 0xA2, 0xF9, 0x19, 0xF2, 0xFC, 0x2F, 0xA2, 0x99, 0x99, 0x20, 0x1A,
+    0xF2, 0xFC, 0x2F, 0xA2, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0xF3, 0xF3, 0x99, 0x93, 0x0F, 0xA2, 0xFC,
+    0x2A, 0xF2, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0xF3, 0xAE, 0x49, 0x99, 0x00, 0x1A, 0xF2, 0xFC, 0x2F,
+    0xA2, 0xF9, 0x19, 0xF2, 0xAE, 0xA2, 0xF3, 0xF3, 0x99, 0x93, 0x0A, 0xAA, 0xAA, 0x5A, 0xFC, 0x5A,
+    0xFA, 0x59, 0xFA, 0x6F, 0x96, 0xAE, 0x00, 0x3A, 0xAA, 0xAA, 0x92, 0xAF, 0xC2, 0x9F, 0xC3, 0xFA,
+    0x3F, 0x93, 0x9E, 0x50, 0x70, 0x9D, 0x29, 0xFF, 0xFD, 0x29, 0xD2, 0x9D, 0x39, 0x90, 0x5D, 0x92,
+    0xD9, 0x2F, 0xFF, 0xD9, 0x2D, 0x92, 0x99, 0x30, 0x09, 0x99, 0x99, 0x99, 0x0A, 0xFE, 0xA9, 0xAA,
+    0xAA, 0xAD, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0xAC, 0xA5, 0x9A, 0x90, 0x39,
+    0x99, 0x99, 0x3F, 0xC2, 0x9F, 0xA2, 0xAF, 0x91, 0xAF, 0xC1, 0xFD, 0x2F, 0xA3, 0xDA, 0x75, 0x29,
+    0x91, 0xE0, 0xAE, 0x0D, 0xA1, 0xD9, 0x1E, 0x90, 0x9E, 0x19, 0xD0, 0x29, 0x95, 0xD5, 0xD5, 0xD2,
+    0xAF, 0xDA, 0x9F, 0xD9, 0x09, 0x99, 0x99, 0x90, 0xAF, 0xDA, 0x9A, 0xAD, 0xAA, 0x92, 0xD5, 0xD5,
+    0xD2, 0x72, 0xD5, 0xD2, 0x9A, 0xFA, 0x9A, 0xFD, 0xA0, 0x99, 0xD9, 0x93, 0xD5, 0xAA, 0x20, 0x7A,
+    0xFD, 0x9A, 0xFD, 0x90, 0x3A, 0xAA, 0xA3, 0xF3, 0xF3, 0xF3, 0xF2, 0x9F, 0x9A, 0xAF, 0xC9, 0xFD,
+    0x99, 0xFD, 0x09, 0xFA, 0x10, 0xAA, 0xAA, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x92, 0xFC, 0xAA, 0x9A,
+    0xFD, 0x90, 0xFD, 0x91, 0xAF, 0x90, 0x1A, 0xCA, 0x91, 0xFC, 0x1F, 0xC9, 0x0F, 0xC9, 0x09, 0xEA,
+    0x70, 0x73, 0x9E, 0x3E, 0x9F, 0xA1, 0xAF, 0xFA, 0x1A, 0xF9, 0xE2, 0x9E, 0x91, 0x95, 0x91, 0x19,
+    0xEA, 0x2A, 0xFD, 0x1E, 0x9A, 0xDA, 0x9D, 0x2E, 0x9D, 0x2E, 0x0E, 0x9A, 0xDA, 0x0A, 0xFD, 0x29,
+    0xAD, 0x91, 0x0F, 0xC0, 0xF9, 0x0F, 0x09, 0xE9, 0x0A, 0xE1, 0x99, 0x92, 0x1A, 0xD4, 0xE9, 0x29,
+    0xAF, 0x4E, 0xA3, 0xEA, 0xAF, 0xDA, 0xAF, 0xD0, 0xAF, 0xA1, 0x3A, 0x93, 0x9E, 0x3E, 0x3E, 0x93,
+    0xE3, 0x9E, 0xA9, 0x91, 0xFD, 0x90, 0x9F, 0xC9, 0x2A, 0xAA, 0xA0, 0x9A, 0xA9, 0xAD, 0xAA, 0xDA,
+    0xAD, 0xAA, 0xDA, 0xAD, 0xA3, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xF9, 0x59, 0xF9, 0x59, 0xF9, 0x59, 0xD9, 0x97, 0x99, 0x9C, 0xA2, 0xD2, 0x9C, 0x90, 0xD2,
+    0xD2, 0xD1, 0xAF, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD, 0x91, 0x9A, 0xA9, 0x6A, 0xAA, 0x1F, 0x92, 0x9F,
+    0x2F, 0x90, 0xAF, 0x39, 0xFF, 0xC5, 0x9F, 0xE7, 0xAF, 0xC9, 0x30, 0x39, 0xAA, 0xAA, 0x96, 0x9F,
+    0xD6, 0xFF, 0x4F, 0xAA, 0xF2, 0xF9, 0x1A, 0xF0, 0xAD, 0xA4, 0x9E, 0x90, 0x0A, 0xA9, 0x59, 0xAA,
+    0x90, 0xE5, 0xE1, 0xFC, 0xAA, 0xFC, 0x19, 0xFF, 0xD9, 0x29, 0xFF, 0x95, 0x9A, 0xDA, 0x93, 0x39,
+    0xAA, 0xAA, 0x96, 0xFF, 0x93, 0xFF, 0xD9, 0x1A, 0xFF, 0xE1, 0xE9, 0x4E, 0x09, 0xD9, 0x59, 0xD9,
+    0x77, 0xAE, 0xA3, 0xDA, 0x0A, 0xFE, 0xAE, 0x90, 0xFF, 0xF0, 0xAD, 0x90, 0x9F, 0xD9, 0x0A, 0xCA,
+    0x39, 0xAC, 0xA2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xFD, 0xAA, 0xFF, 0xDA, 0x9F, 0xFD,
+    0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xD0, 0xFF, 0xFD, 0x77, 0x76, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x0F, 0xFF, 0xD0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x77, 0x09, 0xF9,
+    0x2A, 0xD1, 0x9F, 0xEA, 0xAD, 0xA1, 0xFF, 0xF9, 0x09, 0xDA, 0x09, 0xAF, 0xCA, 0x19, 0xD4, 0xAC,
+    0xA9, 0x20, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x0F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xF1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x70, 0x99, 0x70, 0xE6, 0xAF, 0x93, 0x9F, 0xD9,
+    0x2F, 0xDA, 0x2A, 0xFD, 0x3A, 0xFC, 0x95, 0xEA, 0x79, 0xC7, 0x74, 0x72, 0x99, 0x97, 0x1A, 0xDA,
+    0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A,
+    0xDA, 0x71, 0xE7, 0x19, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAD, 0xA7, 0x1E, 0x71, 0x9E, 0x71,
+    0xE9, 0x71, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1E, 0x97, 0x1E, 0x71, 0xAD, 0xA7, 0x1E,
+    0x71, 0x9E, 0x71, 0xAD, 0x97, 0x10, 0xA9, 0x2E, 0x1E, 0xA1, 0xAD, 0x19, 0xD0, 0x9E, 0x0E, 0x90,
+    0xD9, 0x10, 0x99, 0x79, 0x9D, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0xCA, 0xAA, 0xAA, 0xAF, 0xFF,
+    0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x75, 0x9F, 0xFF, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x99, 0xCA, 0x7A, 0xC9, 0x9C, 0xA7, 0xAC, 0x99, 0xCA, 0x7A, 0xC9, 0x9F, 0xFF, 0x90, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x1A, 0xE9, 0x9E, 0xA2, 0xAD, 0xAF, 0xAD, 0xA1, 0xD2, 0xD2, 0xD0,
+    0x9C, 0x92, 0xAC, 0x29, 0xC9, 0x09, 0x91, 0x99, 0x1D, 0x99, 0xD1, 0xAF, 0x92, 0xAD, 0xA2, 0x9F,
+    0x91, 0xD9, 0xAD, 0x19, 0x91, 0xA9, 0x00, 0x19, 0xAC, 0x1A, 0xE1, 0xD9, 0x2D, 0x92, 0xAD, 0x3D,
+    0xA2, 0x9D, 0x2A, 0xD1, 0xE9, 0x1C, 0xA2, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF,
+    0xFF, 0xF7, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xD9, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0x94, 0xAF, 0xC5, 0x9F, 0xC5, 0x9F, 0xA6, 0xF9, 0x6A,
+    0xE0, 0x3A, 0xAA, 0xAA, 0x92, 0xFC, 0xA2, 0xAF, 0xA2, 0x9F, 0x93, 0xF9, 0x3A, 0xDA, 0x50, 0x77,
+    0x9F, 0x92, 0xE0, 0x9F, 0xEA, 0xAD, 0xA0, 0xFF, 0xF0, 0x9D, 0xA0, 0x9A, 0xFC, 0x90, 0x9D, 0x4A,
+    0xCA, 0x91, 0x0F, 0x91, 0xFC, 0x1A, 0xF9, 0x2E, 0x2A, 0xDA, 0x29, 0xCA, 0x70, 0x6F, 0xC9, 0x49,
+    0xE1, 0x9F, 0xC0, 0xAD, 0xA0, 0xFA, 0x0A, 0xF1, 0xF0, 0xFA, 0x0F, 0xA1, 0xF9, 0x9E, 0x1F, 0x2F,
+    0x29, 0x2E, 0x70, 0x09, 0x99, 0x29, 0xEA, 0x19, 0xEA, 0x19, 0xF1, 0x9F, 0xCA, 0x0F, 0xCA, 0x09,
+    0xF9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD9, 0x9D, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xD9, 0x9D, 0x71, 0xD9, 0x9D, 0x71, 0xD9, 0x9D, 0x71, 0xD9, 0x09, 0x97, 0x19, 0x90,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x3A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xD9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9A, 0xAA, 0x1A,
+    0xAA, 0x9A, 0xE1, 0xEA, 0xAE, 0x1E, 0xAA, 0xE1, 0xEA, 0xAE, 0x1E, 0xAA, 0xE1, 0xEA, 0x71, 0x0F,
+    0xD1, 0xFD, 0x5D, 0x5D, 0x5D, 0x5D, 0x00, 0x79, 0x79, 0x99, 0x0D, 0x90, 0x9A, 0x2A, 0xFC, 0xA0,
+    0x9D, 0x19, 0xFE, 0xAD, 0xA1, 0xD9, 0x0A, 0xFD, 0x2D, 0x09, 0xD9, 0xAA, 0xA7, 0xC9, 0x77, 0x40,
+    0x59, 0x97, 0x2F, 0x71, 0xF7, 0x1F, 0x70, 0x90, 0xAA, 0x29, 0x92, 0xAE, 0xA9, 0x19, 0xD1, 0xAF,
+    0xEA, 0xDA, 0x1E, 0xAF, 0xE9, 0x1D, 0x91, 0x9F, 0xA2, 0x99, 0x2A, 0xA9, 0x71, 0xF7, 0x1F, 0x71,
+    0xF7, 0x29, 0x95, 0x19, 0xAA, 0x93, 0xA9, 0x0F, 0xD9, 0x9D, 0xA9, 0xFF, 0xD0, 0xAC, 0xA1, 0x9F,
+    0x97, 0x6E, 0xA2, 0x9C, 0xA0, 0xFD, 0xAA, 0xD9, 0x9D, 0x9A, 0xFD, 0x0A, 0xC9, 0x29, 0xDA, 0x10,
+    0x75, 0x9C, 0x91, 0x9C, 0x92, 0xAF, 0xFA, 0x09, 0xFF, 0xD9, 0x1D, 0x91, 0x9D, 0x4A, 0x91, 0x9A,
+    0x76, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xFA, 0x3D, 0x5D, 0x5D, 0x5D, 0x20, 0xAF, 0x3A, 0xFA, 0x3F,
+    0xAF, 0xC9, 0x2A, 0xFA, 0x29, 0xFE, 0x77, 0x3F, 0x77, 0x3F, 0x59, 0x90, 0xD0, 0x99, 0x5D, 0x99,
+    0x5A, 0xC0, 0xAA, 0x0C, 0xA5, 0x99, 0x5C, 0xA7, 0xAC, 0x73, 0xA9, 0x79, 0xA7, 0x2A, 0x73, 0xA9,
+    0x39, 0x91, 0x9C, 0x73, 0xCA, 0x19, 0x9D, 0x77, 0x3F, 0x1A, 0x97, 0x4C, 0x1F, 0x1C, 0x97, 0x39,
+    0xC1, 0xF7, 0x73, 0xDA, 0xA1, 0x9C, 0x73, 0xCA, 0x1A, 0xA3, 0x9C, 0x73, 0xC9, 0x71, 0xA9, 0x79,
+    0xA7, 0x3C, 0xA7, 0xAC, 0x75, 0xAC, 0x09, 0x90, 0xCA, 0x7D, 0x59, 0xA0, 0xD0, 0xA9, 0x5F, 0x77,
+    0x3F, 0x77, 0x3F, 0xE3, 0xAF, 0xA3, 0xFF, 0xD9, 0x2A, 0xFA, 0x29, 0xFC, 0x5D, 0x92, 0x9E, 0xA2,
+    0xAD, 0xA1, 0xAD, 0xA9, 0xEA, 0x0D, 0x97, 0x00, 0x19, 0xA1, 0xE9, 0x9E, 0x0A, 0xD1, 0xAD, 0x19,
+    0xE1, 0xE9, 0x19, 0xC9, 0x49, 0x99, 0x59, 0xFD, 0xA2, 0xAF, 0xFA, 0x1E, 0xA9, 0x9A, 0xE9, 0xAD,
+    0x94, 0xDA, 0xE0, 0xAD, 0xA0, 0xAD, 0x3F, 0x7F, 0x70, 0xAA, 0x93, 0x1A, 0x1A, 0x2D, 0xAE, 0x2F,
+    0x92, 0xF2, 0xFC, 0xA1, 0x9C, 0x90, 0xCA, 0x70, 0x39, 0x91, 0x9D, 0xA9, 0xEA, 0x0E, 0x2A, 0xE9,
+    0x2A, 0xDA, 0x3A, 0xA0, 0x94, 0xDA, 0x92, 0xF9, 0x19, 0xDA, 0x09, 0xEA, 0xAD, 0xA1, 0xAA, 0x30,
+    0x0A, 0x74, 0xDA, 0x4D, 0xA2, 0x9E, 0xA1, 0xAE, 0x4A, 0xD9, 0x0F, 0x3A, 0xE9, 0x9C, 0xA9, 0xCA,
+    0x1E, 0x91, 0xAC, 0x1D, 0x1C, 0x93, 0xCA, 0x19, 0xC9, 0xAA, 0x91, 0xAD, 0x90, 0x9E, 0x19, 0xD9,
+    0x09, 0xD9, 0x9E, 0x0A, 0xD9, 0x0A, 0xA9, 0x10, 0x19, 0x91, 0x9F, 0x0F, 0xCA, 0xFC, 0xA9, 0xF9,
+    0x09, 0xA9, 0x10, 0x2A, 0xA3, 0x90, 0xD0, 0x91, 0xFD, 0x09, 0xFD, 0x91, 0xAD, 0xA2, 0xAC, 0xAA,
+    0xCA, 0x2A, 0x1A, 0x10, 0x77, 0xAE, 0x99, 0xEA, 0x2E, 0xAF, 0xAE, 0x09, 0xCA, 0x2D, 0x2A, 0xC0,
+    0x9C, 0x92, 0xD2, 0x9C, 0x99, 0xCA, 0x2D, 0x2A, 0xC1, 0xEA, 0xFA, 0xE2, 0xAE, 0x1E, 0xA1, 0x71,
+    0xCA, 0x49, 0xC5, 0xFD, 0x1F, 0xD5, 0xCA, 0x49, 0xC7, 0x10, 0x0A, 0xAA, 0x97, 0x71, 0x9A, 0xAA,
+    0x1A, 0xE9, 0x77, 0x9E, 0xA2, 0xFC, 0x97, 0x39, 0xFC, 0x4F, 0xEA, 0x99, 0x99, 0x99, 0xAA, 0xFD,
+    0x6A, 0xFF, 0xFF, 0xDA, 0x70, 0x9A, 0xFF, 0xFD, 0xA7, 0x59, 0xAF, 0xFA, 0x97, 0x0A, 0xAA, 0x97,
+    0x71, 0x9A, 0xAA, 0x1A, 0xE9, 0x77, 0x9E, 0xA2, 0xFC, 0x97, 0x39, 0xFC, 0x4F, 0xEA, 0x99, 0x99,
+    0x99, 0xAA, 0xFD, 0x6A, 0xFF, 0xFF, 0xDA, 0x70, 0x9A, 0xFF, 0xFD, 0xA7, 0x59, 0xAF, 0xFA, 0x97,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xFF, 0xFF, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x59, 0x99,
+    0x77, 0x99, 0x3A, 0xFF, 0xCA, 0x99, 0x7E, 0x2F, 0xFF, 0xFC, 0xAA, 0xAA, 0xEA, 0x1A, 0xFF, 0xFF,
+    0xFF, 0x2E, 0x94, 0x99, 0xAF, 0xFF, 0x92, 0xD9, 0x73, 0x99, 0xAA, 0xAA, 0xA9, 0x30, 0x77, 0x77,
+    0x39, 0xAF, 0xFA, 0x97, 0x49, 0xFF, 0xFF, 0x97, 0x0A, 0xFF, 0xFF, 0xE6, 0xFD, 0xA9, 0x92, 0x99,
+    0x9A, 0xFD, 0x4F, 0xA7, 0x49, 0xAF, 0x2A, 0xE9, 0x77, 0x9E, 0xA1, 0x9A, 0xA7, 0x73, 0xAA, 0x90,
+    0x77, 0x77, 0x77, 0x0C, 0x97, 0x77, 0x0D, 0xA1, 0x9F, 0xFF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE7, 0x77, 0xCA, 0x77,
+    0x70, 0x93, 0x70, 0x9F, 0xA1, 0x9A, 0x99, 0xDA, 0x4A, 0xD0, 0xAF, 0xD9, 0xD1, 0x9D, 0xAD, 0x1E,
+    0x0F, 0xAD, 0x19, 0x91, 0x99, 0x72, 0xAE, 0xA2, 0xDA, 0x9A, 0xCA, 0x09, 0xD2, 0xD0, 0x9F, 0xE0,
+    0x9D, 0x6D, 0xA2, 0x91, 0x9F, 0xCA, 0x39, 0x99, 0x91, 0x9C, 0x9D, 0x92, 0xAC, 0x9D, 0x9D, 0x9D,
+    0x9D, 0x9D, 0x9D, 0x99, 0x90, 0x72, 0xAE, 0xA2, 0xDA, 0xAD, 0xA0, 0x9D, 0x2D, 0x0A, 0xCA, 0x2D,
+    0x9A, 0xD2, 0xD1, 0xD9, 0x0A, 0xD1, 0x9F, 0xC4, 0x99, 0x92, 0x9C, 0xA2, 0xD0, 0xAD, 0x2D, 0x0A,
+    0xD2, 0xD0, 0xAD, 0x2D, 0x0A, 0xD1, 0x9D, 0x09, 0xD9, 0x0E, 0x1F, 0xE2, 0x99, 0x91, 0x90, 0x79,
+    0xF9, 0x9D, 0xAA, 0xA9, 0xAC, 0xA3, 0xD9, 0x3D, 0xA3, 0xAD, 0x90, 0x99, 0x0A, 0xFA, 0x29, 0x99,
+    0x00, 0x5D, 0x49, 0xD4, 0x9D, 0x09, 0xEA, 0xD0, 0xDA, 0xAE, 0xAD, 0x19, 0xDA, 0xCA, 0x2D, 0xAC,
+    0xA2, 0xD9, 0xD9, 0x0A, 0xD0, 0xFA, 0xD1, 0x99, 0x90, 0x99, 0x9C, 0xA5, 0x9D, 0x59, 0xD5, 0x9D,
+    0xAE, 0x90, 0x9E, 0xAE, 0x09, 0xD2, 0xD0, 0x9D, 0x2D, 0x09, 0xD2, 0xD0, 0x9D, 0x2D, 0x09, 0xD2,
+    0xD1, 0x99, 0x29, 0x90, 0x74, 0xD9, 0xEA, 0x9E, 0xA0, 0xEA, 0xAE, 0xAA, 0xD9, 0xDA, 0x1D, 0xA1,
+    0xAC, 0xAD, 0x91, 0xD9, 0x1A, 0xCA, 0xD9, 0x1D, 0x91, 0xAC, 0xAD, 0x91, 0xD9, 0x1A, 0xCA, 0xD9,
+    0x1D, 0x91, 0xAC, 0xA9, 0x92, 0x99, 0x39, 0x00, 0x5D, 0x0D, 0x9F, 0xC9, 0xDA, 0x2D, 0x92, 0xD9,
+    0x2D, 0x92, 0xD9, 0x29, 0x93, 0x19, 0x94, 0xD3, 0xFC, 0x09, 0xAD, 0xAA, 0x19, 0xD3, 0x9D, 0x39,
+    0xD3, 0x9D, 0x4F, 0x39, 0x99, 0x00, 0xAC, 0xA2, 0xD9, 0x9D, 0x19, 0xD1, 0xD9, 0x0A, 0xCA, 0x19,
+    0xCA, 0x0D, 0x3D, 0x9C, 0xA3, 0xAE, 0x94, 0xE5, 0x99, 0x30, 0x0A, 0xD1, 0x9D, 0x2D, 0xA0, 0xD9,
+    0x3F, 0xA4, 0x9E, 0x5F, 0x93, 0xAD, 0x9D, 0x29, 0xD1, 0xAD, 0x19, 0x93, 0x99, 0x00, 0x7A, 0xFC,
+    0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F,
+    0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2,
+    0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF,
+    0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99,
+    0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC,
+    0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x0F, 0xFC, 0xAA, 0x96, 0xFF, 0xFD,
+    0x93, 0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0x91, 0xFC, 0x39, 0xAF, 0xCA, 0x1F, 0xC5, 0xAF, 0xC1, 0xFC,
+    0x59, 0xFC, 0x1F, 0xC5, 0x9F, 0xA1, 0xFC, 0x5F, 0xC9, 0x1F, 0xC9, 0x99, 0x99, 0xFD, 0x2F, 0xFF,
+    0xDA, 0x3F, 0xFF, 0xC9, 0x4F, 0xFF, 0xE9, 0x2F, 0xCA, 0xAA, 0xAA, 0xFD, 0x91, 0xFC, 0x5A, 0xFC,
+    0x1F, 0xC6, 0xFC, 0x90, 0xFC, 0x6F, 0xC9, 0x0F, 0xC6, 0xFC, 0x90, 0xFC, 0x59, 0xFC, 0x90, 0xFC,
+    0x49, 0xFD, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF2, 0xFF, 0xFD, 0xA3, 0xFF, 0xEA, 0x94, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x9F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F,
+    0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7,
+    0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0x7F, 0xD9, 0x76, 0x9F, 0xDA, 0x76, 0xFF, 0x76, 0xFF, 0x97,
+    0x4A, 0xFA, 0xF7, 0x4F, 0xA9, 0xF7, 0x39, 0xF9, 0x0F, 0xA7, 0x2A, 0xF1, 0xAF, 0x72, 0xFC, 0x19,
+    0xF9, 0x70, 0x9F, 0x92, 0xFA, 0x70, 0xAF, 0x3F, 0xC7, 0x0F, 0xC3, 0x9F, 0x96, 0x9F, 0x94, 0xFC,
+    0x6F, 0xC5, 0xFC, 0x6F, 0xC5, 0x9F, 0xA4, 0xAF, 0xA6, 0xFC, 0x4F, 0xC7, 0xFC, 0x92, 0x9F, 0xC7,
+    0xAF, 0xA2, 0xAF, 0xA7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x09, 0xFF, 0xFF, 0xFA, 0x0A, 0xFF,
+    0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x0A, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFC, 0x97, 0x3A,
+    0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xA7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3F, 0xCA,
+    0x73, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xCA, 0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A,
+    0xFA, 0x73, 0x9F, 0xC9, 0x73, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F,
+    0xFF, 0xFC, 0xA0, 0xFC, 0x70, 0x9F, 0x9F, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A,
+    0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC,
+    0x70, 0xAF, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0xFC, 0xAF, 0xFF, 0xFE, 0xAF, 0xFF, 0xFE, 0xAF,
+    0xFF, 0xFE, 0xAF, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF,
+    0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7,
+    0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xAF, 0xC7, 0x0A, 0xFA, 0xFC, 0x70, 0xAF, 0xA0, 0x77, 0x76, 0x9A,
+    0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29,
+    0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC,
+    0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x90, 0xFF, 0x1F, 0xC9, 0x0F, 0xC1, 0xFF,
+    0x1F, 0xC9, 0x0F, 0xC1, 0xFF, 0x1F, 0xC9, 0x0F, 0xC9, 0x0F, 0xF1, 0xFC, 0x90, 0xFC, 0x97, 0x2F,
+    0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD,
+    0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC,
+    0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0xAF, 0xFC, 0xAF, 0xFF, 0xFF, 0xD9, 0xAF, 0xEA,
+    0x3F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F,
+    0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x3A, 0xFE, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xFC, 0x7A, 0xFA, 0x0F, 0xC6, 0xAF, 0xC1, 0xFC, 0x59, 0xFC, 0x91, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4,
+    0xFC, 0xA3, 0xFC, 0x3A, 0xFC, 0x4F, 0xC2, 0xAF, 0xC5, 0xFC, 0x19, 0xFC, 0x95, 0xFC, 0x1F, 0xCA,
+    0x6F, 0xC0, 0xFC, 0xA7, 0xFC, 0xAF, 0xC7, 0x0F, 0xFE, 0x97, 0xFF, 0xF7, 0xFF, 0xFA, 0x6F, 0xD9,
+    0xAF, 0xC6, 0xFC, 0x2F, 0xD5, 0xFC, 0x29, 0xFC, 0x94, 0xFC, 0x3A, 0xFC, 0x4F, 0xC4, 0xFC, 0xA3,
+    0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xD2, 0xFC, 0x6F, 0xCA, 0x1F, 0xC6, 0xAF, 0xC1, 0xFC, 0x7F,
+    0xD0, 0x7F, 0xD9, 0x76, 0x9F, 0xDA, 0x76, 0xFF, 0x76, 0xFF, 0x97, 0x49, 0xFA, 0xEA, 0x74, 0xFA,
+    0x9F, 0x74, 0xFA, 0x0F, 0x97, 0x29, 0xF9, 0x0F, 0xA7, 0x2F, 0xC1, 0xAF, 0x72, 0xFA, 0x19, 0xF9,
+    0x70, 0x9F, 0x92, 0xFA, 0x70, 0xFC, 0x3F, 0xC7, 0x0F, 0xC3, 0xAF, 0x96, 0xAF, 0xA3, 0x9F, 0xA6,
+    0xFC, 0x94, 0xFC, 0x6F, 0xC5, 0xAF, 0x94, 0xAF, 0xA5, 0x9F, 0xA4, 0xFC, 0x96, 0xFC, 0x4F, 0xC7,
+    0xFC, 0x92, 0xAF, 0xC7, 0xAF, 0xC2, 0xFC, 0xA7, 0x0F, 0xC2, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xC7,
+    0x1A, 0xFC, 0x0F, 0xCA, 0x71, 0x9F, 0xC0, 0xFE, 0x72, 0x9F, 0xD9, 0xFE, 0x97, 0x1F, 0xE9, 0xFE,
+    0xA7, 0x1F, 0xE9, 0xFF, 0x70, 0xAF, 0xE9, 0xFF, 0x70, 0xFF, 0x9F, 0xFA, 0x7F, 0xF9, 0xFA, 0xF6,
+    0xAE, 0xAF, 0x9F, 0x9F, 0x6F, 0x9F, 0x9F, 0x9A, 0xE9, 0x5F, 0x0F, 0x9F, 0x99, 0xEA, 0x49, 0xE9,
+    0x0F, 0x9F, 0x90, 0xF4, 0xF1, 0xF9, 0xF9, 0x0F, 0x93, 0xF0, 0x9F, 0x9F, 0x90, 0x9E, 0xA2, 0x9E,
+    0x90, 0x9F, 0x9F, 0xA1, 0xF2, 0xF1, 0x9F, 0x9F, 0xA1, 0xF9, 0x1F, 0x19, 0xF9, 0xFA, 0x1A, 0xEA,
+    0x09, 0xEA, 0x19, 0xF9, 0xFA, 0x2F, 0x0F, 0x29, 0xF9, 0xFA, 0x2F, 0x9F, 0x29, 0xF9, 0xFA, 0x2A,
+    0xFE, 0xA2, 0x9F, 0x9F, 0xA2, 0x9F, 0xE3, 0x9F, 0x9F, 0xA3, 0xFE, 0x39, 0xF9, 0xFA, 0x3A, 0xFC,
+    0xA3, 0x9F, 0x9F, 0xA3, 0x9F, 0xC4, 0x9F, 0x9F, 0xA4, 0xFC, 0x49, 0xF9, 0xFD, 0x97, 0x09, 0xF0,
+    0xFE, 0x70, 0x9F, 0x0F, 0xEA, 0x79, 0xF0, 0xFF, 0x96, 0x9F, 0x0F, 0xFC, 0x69, 0xF0, 0xFF, 0xC9,
+    0x59, 0xF0, 0xFA, 0xFC, 0x59, 0xF0, 0xF9, 0xFC, 0xA4, 0x9F, 0x0F, 0x90, 0xFC, 0x49, 0xF0, 0xF9,
+    0x0A, 0xFC, 0x39, 0xF0, 0xF9, 0x1F, 0xC9, 0x29, 0xF0, 0xF9, 0x1A, 0xFC, 0x29, 0xF0, 0xF9, 0x2F,
+    0xC9, 0x19, 0xF0, 0xFA, 0x29, 0xFC, 0x19, 0xF0, 0xFA, 0x3F, 0xCA, 0x09, 0xF0, 0xFA, 0x4F, 0xC0,
+    0x9F, 0x0F, 0xA4, 0xAF, 0xC9, 0xF0, 0xFA, 0x5F, 0xCA, 0xF0, 0xFA, 0x59, 0xFF, 0xC0, 0xFA, 0x6F,
+    0xFC, 0x0F, 0xA6, 0x9F, 0xF0, 0xFA, 0x7A, 0xFE, 0x0F, 0xA7, 0x0F, 0xE0, 0xFA, 0x70, 0xAF, 0xD0,
+    0x09, 0xFF, 0xFE, 0x19, 0xFF, 0xFE, 0x19, 0xFF, 0xFE, 0x19, 0xFF, 0xFE, 0x29, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x94,
+    0xFF, 0xFC, 0x4F, 0xFF, 0xC4, 0xFF, 0xFC, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x76, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xC0, 0x77, 0x76, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC,
+    0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC,
+    0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9,
+    0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F,
+    0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD,
+    0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC,
+    0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
+    0xE0, 0xFF, 0xFF, 0xE0, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7,
+    0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0,
+    0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70,
+    0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F,
+    0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x0F, 0xC7, 0x0F, 0xC0, 0xFC, 0x70, 0xFC, 0x00, 0x0F, 0xFC,
+    0xAA, 0x6F, 0xFF, 0xC9, 0x3F, 0xFF, 0xD9, 0x2F, 0xFF, 0xE9, 0x1F, 0xC9, 0x99, 0xAF, 0xE1, 0xFC,
+    0x4A, 0xFC, 0x1F, 0xC5, 0xFC, 0x1F, 0xC5, 0xFC, 0x90, 0xFC, 0x5F, 0xC1, 0xFC, 0x5F, 0xC1, 0xFC,
+    0x4F, 0xD1, 0xFC, 0xAA, 0xAF, 0xE9, 0x1F, 0xFF, 0xE2, 0xFF, 0xFD, 0x3F, 0xFF, 0x94, 0xFC, 0xAA,
+    0xAA, 0x97, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74,
+    0xFC, 0x73, 0x0A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x19, 0xFC,
+    0xA9, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xC9, 0x74, 0xAF, 0xC9, 0x74, 0xAF, 0xC7, 0x5A, 0xFC,
+    0x75, 0xAF, 0xC7, 0x5F, 0xD7, 0x5F, 0xC7, 0x4A, 0xFA, 0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x73, 0x9F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xFC, 0x97, 0x3A, 0xFA, 0x74, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xCA,
+    0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x99, 0x6F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC6, 0xAF, 0xA7, 0x0A, 0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC,
+    0xA2, 0xFC, 0x59, 0xFC, 0x3A, 0xFA, 0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96,
+    0xFC, 0x19, 0xFC, 0x7A, 0xFA, 0x0A, 0xF9, 0x70, 0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF,
+    0xC7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x59, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x70, 0x72, 0x9F, 0xA7, 0x75, 0x9F,
+    0xA7, 0x72, 0x99, 0xAA, 0xFC, 0xA9, 0x97, 0x49, 0xFF, 0xFF, 0x97, 0x0F, 0xFF, 0xFF, 0x94, 0x9F,
+    0xFF, 0xFF, 0xD9, 0x3F, 0xEA, 0x9A, 0xFA, 0x9A, 0xFE, 0x2A, 0xFC, 0x92, 0x9F, 0xA2, 0x9F, 0xCA,
+    0x1F, 0xC9, 0x39, 0xFA, 0x39, 0xFC, 0x09, 0xFC, 0x49, 0xFA, 0x4F, 0xC9, 0x9F, 0xA4, 0x9F, 0xA4,
+    0xAF, 0xA9, 0xFA, 0x49, 0xFA, 0x49, 0xFA, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA9, 0xFA, 0x49, 0xFA,
+    0x4A, 0xF9, 0x0F, 0xC4, 0x9F, 0xA4, 0xFC, 0x1F, 0xD3, 0x9F, 0xA3, 0xAF, 0xC1, 0x9F, 0xD9, 0x19,
+    0xFA, 0x19, 0xFD, 0x92, 0xAF, 0xFF, 0xFF, 0xDA, 0x4A, 0xFF, 0xFF, 0xFA, 0x69, 0xFF, 0xFF, 0xD9,
+    0x71, 0x9A, 0xFF, 0xFA, 0x97, 0x70, 0x9F, 0xA7, 0x75, 0x9F, 0xA7, 0x75, 0x9F, 0xA7, 0x77, 0x76,
+    0x0F, 0xC9, 0x70, 0xFC, 0x91, 0xAF, 0xC7, 0xFD, 0x3F, 0xCA, 0x59, 0xFC, 0x49, 0xFC, 0x5F, 0xCA,
+    0x5A, 0xFC, 0x3A, 0xFC, 0x7F, 0xC9, 0x2F, 0xC9, 0x79, 0xFC, 0x1F, 0xCA, 0x71, 0xAF, 0xA9, 0xFC,
+    0x73, 0xFF, 0xD9, 0x73, 0x9F, 0xFC, 0x75, 0xFF, 0x77, 0xFD, 0xA7, 0x69, 0xFD, 0x97, 0x6F, 0xF7,
+    0x5F, 0xFD, 0x73, 0x9F, 0xFD, 0xA7, 0x2F, 0xC9, 0x9F, 0xC7, 0x1A, 0xFC, 0x1A, 0xFC, 0x79, 0xFC,
+    0x3F, 0xCA, 0x6F, 0xCA, 0x39, 0xFC, 0x5A, 0xFC, 0x5F, 0xD3, 0x9F, 0xC9, 0x6F, 0xCA, 0x2F, 0xCA,
+    0x7A, 0xFC, 0x1A, 0xFC, 0x71, 0xFD, 0x00, 0x0F, 0x93, 0x9E, 0xA4, 0xF9, 0x0F, 0xA3, 0xAF, 0x4F,
+    0xA0, 0xFA, 0x3A, 0xF4, 0xFA, 0x0F, 0xA3, 0xAF, 0x4F, 0xA0, 0xFA, 0x3A, 0xF4, 0xFA, 0x0F, 0xA3,
+    0xAF, 0x4F, 0xA0, 0xFA, 0x3A, 0xF4, 0xFA, 0x0F, 0xA3, 0xAF, 0x4F, 0xA0, 0xFA, 0x3A, 0xF4, 0xF9,
+    0x0F, 0xA3, 0xAF, 0x39, 0xF9, 0x0F, 0xA3, 0xAF, 0x39, 0xF9, 0x0F, 0xC3, 0xAF, 0x3F, 0xC1, 0x9F,
+    0xA2, 0xAF, 0x29, 0xFC, 0x2F, 0xD9, 0x0A, 0xF0, 0x9A, 0xFC, 0x92, 0x9F, 0xFF, 0xFE, 0xA4, 0xAF,
+    0xFF, 0xFD, 0x69, 0xFF, 0xFE, 0xA7, 0x19, 0xAF, 0xFC, 0xA9, 0x77, 0xAF, 0x77, 0x3A, 0xF7, 0x73,
+    0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x10, 0x77, 0x76, 0xAF, 0xEA, 0x97, 0x3A,
+    0xFF, 0xF7, 0x09, 0xFF, 0xFE, 0x96, 0xFF, 0xFF, 0xC9, 0x4F, 0xE9, 0x29, 0xAF, 0xD3, 0xAF, 0xCA,
+    0x69, 0xFC, 0xA2, 0xFC, 0xA7, 0x0A, 0xFC, 0x19, 0xFC, 0x72, 0xFC, 0x90, 0xAF, 0xC7, 0x2A, 0xFA,
+    0x0A, 0xFA, 0x72, 0x9F, 0xC0, 0xAF, 0xA7, 0x29, 0xFC, 0x0A, 0xFA, 0x72, 0x9F, 0xC0, 0xAF, 0xA7,
+    0x29, 0xFC, 0x09, 0xFC, 0x72, 0xAF, 0xA1, 0xFC, 0x72, 0xFC, 0x91, 0xAF, 0x97, 0x1F, 0xC3, 0xFC,
+    0x70, 0xAF, 0x93, 0xAF, 0xA6, 0x9F, 0xA5, 0xAF, 0xA4, 0x9F, 0xA7, 0xAF, 0xA2, 0xAF, 0xA4, 0xFF,
+    0xD2, 0xAF, 0xFC, 0x0F, 0xFD, 0x2A, 0xFF, 0xC0, 0xFF, 0xD2, 0xAF, 0xFC, 0x0F, 0xFD, 0x2A, 0xFF,
+    0xC0, 0x59, 0x99, 0x97, 0x5F, 0xE1, 0xFA, 0x4F, 0xFC, 0x9F, 0xA3, 0xFF, 0xFE, 0xA2, 0x9F, 0xD9,
+    0x9A, 0xFD, 0xA2, 0xFD, 0x4F, 0xCA, 0x2F, 0xC5, 0xAF, 0xA1, 0x9F, 0xC5, 0x9F, 0xA1, 0x9F, 0xC6,
+    0xFA, 0x19, 0xFA, 0x6F, 0xA1, 0x9F, 0xA6, 0xFA, 0x19, 0xFC, 0x6F, 0xA1, 0x9F, 0xC5, 0x9F, 0xA2,
+    0xFC, 0x94, 0xAF, 0xA2, 0xFD, 0x39, 0xFD, 0x29, 0xFD, 0xAA, 0xFF, 0xCA, 0x1F, 0xFF, 0xFD, 0x2F,
+    0xFC, 0x90, 0xFD, 0x3A, 0xFC, 0xA2, 0x9F, 0xC5, 0x99, 0x97, 0x99, 0x00, 0x59, 0x99, 0x99, 0x72,
+    0xAF, 0xF9, 0x59, 0xFF, 0xE9, 0x4F, 0xFF, 0xC9, 0x2F, 0xD9, 0x9A, 0xFC, 0xA2, 0xFC, 0x39, 0xFC,
+    0x19, 0xFA, 0x4F, 0xC1, 0xAF, 0x94, 0xFC, 0x1A, 0xF9, 0x4F, 0xC1, 0xAF, 0x93, 0x9F, 0xA1, 0xAF,
+    0x92, 0x9F, 0xC2, 0xAF, 0x90, 0xFD, 0xA3, 0xAF, 0x90, 0xFC, 0x94, 0xAF, 0x90, 0xFE, 0x92, 0xAF,
+    0x90, 0xAA, 0xFE, 0x1A, 0xF9, 0x4F, 0xCA, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xAF, 0x9A, 0xF9,
+    0x5A, 0xF9, 0xAF, 0x95, 0xAF, 0x9A, 0xF9, 0x5F, 0xC9, 0xAF, 0xC4, 0xFD, 0x0A, 0xFE, 0xAA, 0xFD,
+    0xA0, 0xAF, 0xFF, 0xE1, 0xAF, 0xFF, 0xD2, 0xAF, 0xAA, 0xFD, 0xA3, 0xAF, 0x91, 0x99, 0x96, 0xAF,
+    0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97,
+    0x30, 0x77, 0x1F, 0xC9, 0x6F, 0xC9, 0xFA, 0x59, 0xFA, 0x0F, 0xC5, 0x9F, 0xA0, 0xAF, 0x94, 0x9F,
+    0xA0, 0x9F, 0xA4, 0x9F, 0x91, 0xFC, 0x4A, 0xF9, 0x1A, 0xF4, 0xAF, 0x29, 0xFA, 0x3F, 0xC3, 0xFC,
+    0x3F, 0xA3, 0xAF, 0x29, 0xF9, 0x4F, 0x91, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0x9F, 0x0F, 0xC7, 0xFF,
+    0xC9, 0x7F, 0xFC, 0x70, 0x9F, 0xE7, 0x2F, 0xD9, 0x72, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97,
+    0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x73, 0xAF, 0x97, 0x3A, 0xF9, 0x50, 0x79, 0x99, 0x99,
+    0x71, 0xAF, 0xFA, 0x6F, 0xFF, 0xA3, 0xAF, 0xFF, 0xC3, 0xFC, 0x91, 0x9A, 0xE9, 0x3F, 0xA5, 0xAA,
+    0x4F, 0xA7, 0x4F, 0xC9, 0x73, 0xAF, 0xD7, 0x3A, 0xFD, 0xA7, 0x2A, 0xFE, 0xA7, 0xAF, 0xFD, 0x49,
+    0xFF, 0xFC, 0x3F, 0xCA, 0x1A, 0xFC, 0xA1, 0xFC, 0x93, 0x9F, 0xC0, 0x9F, 0xC5, 0xFC, 0x9A, 0xF9,
+    0x59, 0xFA, 0xFC, 0x7F, 0xFD, 0x7F, 0xFD, 0x95, 0x9F, 0xAA, 0xFA, 0x5F, 0xCA, 0x9F, 0xCA, 0x3A,
+    0xFC, 0x1F, 0xEA, 0xAF, 0xE2, 0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xFF, 0x97, 0x39, 0x97, 0x49, 0x9A,
+    0xA9, 0x96, 0xAF, 0xFC, 0xA2, 0xFF, 0xFA, 0x0A, 0xFF, 0xF1, 0xFC, 0xA2, 0x9A, 0xD1, 0xFC, 0x71,
+    0xFC, 0x71, 0xAF, 0x97, 0x1A, 0xFF, 0x95, 0x9F, 0xE9, 0x4F, 0xFC, 0x93, 0xFD, 0xAA, 0xAA, 0x3A,
+    0xFA, 0x70, 0xFC, 0x97, 0x0F, 0xCA, 0x6A, 0x0A, 0xFC, 0xA9, 0x99, 0x9A, 0xD1, 0xFF, 0xFC, 0x19,
+    0xFF, 0xF3, 0xAF, 0xFA, 0x97, 0x99, 0x94, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0x99, 0x9F, 0xCA, 0x70, 0xAF, 0xA7, 0x09,
+    0xFC, 0x71, 0xFC, 0x71, 0xFC, 0x97, 0x0F, 0xCA, 0x70, 0xAF, 0xC7, 0x09, 0xFC, 0x71, 0xFC, 0x97,
+    0x0A, 0xFA, 0x70, 0x9F, 0xC7, 0x1A, 0xF9, 0x71, 0xFC, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F,
+    0xA7, 0x19, 0xFC, 0x72, 0xFD, 0xA7, 0x0F, 0xFC, 0xA9, 0x5F, 0xFE, 0x94, 0xFF, 0xE9, 0x49, 0xAF,
+    0xFC, 0x79, 0xAF, 0xD7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xA7, 0x19, 0xF9, 0x71, 0xAF, 0x72, 0xAA,
+    0xAA, 0x91, 0x70, 0x9A, 0x99, 0x4A, 0xEA, 0x09, 0xFE, 0xA2, 0xAF, 0x9F, 0xFC, 0xA1, 0xAF, 0xFF,
+    0xE9, 0x0A, 0xFE, 0xA9, 0xFD, 0xA0, 0xAF, 0xCA, 0x3A, 0xFC, 0x0A, 0xFC, 0x5F, 0xC0, 0xAF, 0xC5,
+    0xFC, 0x0A, 0xFA, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A,
+    0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC0, 0x69, 0x99, 0x97, 0x3F, 0xF9, 0x69, 0xFF, 0xDA,
+    0x5F, 0xFF, 0x93, 0xFC, 0xA1, 0x9F, 0xC2, 0x9F, 0xC3, 0x9F, 0xA1, 0xAF, 0x94, 0xFC, 0x1F, 0xC5,
+    0xAF, 0x90, 0xFC, 0x59, 0xF9, 0x0F, 0xA6, 0xFA, 0x9F, 0xA6, 0xFC, 0x9F, 0xCA, 0xAA, 0xAA, 0xAA,
+    0xFC, 0x9F, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x9F, 0xA5, 0x9F, 0xC9, 0xFA, 0x6F,
+    0xA0, 0xFA, 0x6F, 0xA0, 0xFC, 0x59, 0xF9, 0x0A, 0xF5, 0xAF, 0x19, 0xF9, 0x4F, 0xC2, 0xFC, 0x39,
+    0xFA, 0x2A, 0xFC, 0x99, 0xAF, 0xC4, 0xFF, 0xF9, 0x5F, 0xFD, 0xA7, 0xAF, 0xE9, 0x73, 0x99, 0x96,
+    0x72, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F,
+    0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xA4, 0x9F, 0xC5, 0xFD, 0xAA, 0xC9,
+    0x0A, 0xFF, 0x91, 0xFF, 0x92, 0xAF, 0xD9, 0x59, 0x92, 0x77, 0x29, 0xFA, 0x5A, 0xFA, 0x09, 0xFA,
+    0x4A, 0xFA, 0x19, 0xFA, 0x39, 0xFC, 0x29, 0xFA, 0x29, 0xFC, 0x39, 0xFA, 0x2F, 0xC4, 0x9F, 0xA1,
+    0xFC, 0x94, 0x9F, 0xA0, 0xFC, 0x95, 0x9F, 0xAA, 0xFA, 0x69, 0xFF, 0xD9, 0x69, 0xFF, 0xE6, 0x9F,
+    0xFF, 0x59, 0xFD, 0x9F, 0xCA, 0x49, 0xFA, 0x2F, 0xC9, 0x39, 0xFA, 0x29, 0xFC, 0x39, 0xFA, 0x3A,
+    0xFC, 0x29, 0xFA, 0x4F, 0xCA, 0x19, 0xFA, 0x5F, 0xCA, 0x09, 0xFA, 0x59, 0xFC, 0x90, 0x09, 0x99,
+    0x99, 0x75, 0x9F, 0xDA, 0x73, 0x9F, 0xF7, 0x29, 0xFF, 0xA7, 0x19, 0xAA, 0xAF, 0xD7, 0x6A, 0xFA,
+    0x76, 0xFC, 0x76, 0xAF, 0x97, 0x5A, 0xFA, 0x75, 0xFD, 0x74, 0x9F, 0xD9, 0x73, 0xAF, 0xE7, 0x3F,
+    0xF7, 0x29, 0xEA, 0xFA, 0x71, 0xFA, 0xFC, 0x71, 0xF9, 0x9F, 0x97, 0xAF, 0x1F, 0xA7, 0xFC, 0x1F,
+    0xC6, 0x9F, 0xA1, 0x9F, 0x95, 0xAF, 0x92, 0xFC, 0x5F, 0xC3, 0xFC, 0x93, 0x9F, 0xA3, 0xAF, 0xC3,
+    0xAF, 0x94, 0xFE, 0x1F, 0xC5, 0xFE, 0x09, 0xFC, 0x59, 0xFD, 0x0F, 0xCA, 0x69, 0xFC, 0x77, 0x99,
+    0x20, 0x77, 0x3A, 0xF9, 0x5F, 0xC2, 0xAF, 0x95, 0xFC, 0x2A, 0xF9, 0x5F, 0xC2, 0xAF, 0x95, 0xFC,
+    0x2A, 0xF9, 0x5F, 0xC2, 0xAF, 0x95, 0xFC, 0x2A, 0xF9, 0x5F, 0xC2, 0xAF, 0x95, 0xFC, 0x2A, 0xF9,
+    0x5F, 0xC2, 0xAF, 0x95, 0xFC, 0x2A, 0xF9, 0x5F, 0xC2, 0xAF, 0xA5, 0xFC, 0x2A, 0xFC, 0x4A, 0xFC,
+    0x2A, 0xFC, 0x92, 0x9F, 0xD9, 0x1A, 0xFE, 0xAF, 0xFC, 0xA9, 0xAF, 0xFF, 0xFD, 0x9A, 0xFF, 0xE0,
+    0xAF, 0xC9, 0xAF, 0xAF, 0xC2, 0xAF, 0x9A, 0xF9, 0x19, 0x69, 0x91, 0xAF, 0x97, 0x5A, 0xF9, 0x75,
+    0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x5A, 0xF9, 0x75, 0xAF, 0x97, 0x50, 0x77, 0x1F, 0xC9,
+    0x6F, 0xC9, 0xFA, 0x59, 0xFA, 0x0F, 0xC5, 0x9F, 0xA0, 0xAF, 0x94, 0x9F, 0xA0, 0x9F, 0xA4, 0x9F,
+    0x91, 0xFC, 0x4A, 0xF9, 0x1A, 0xF4, 0xAF, 0x29, 0xFA, 0x3F, 0xC3, 0xFC, 0x3F, 0xA3, 0xAF, 0x29,
+    0xF9, 0x4F, 0x91, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0x9F, 0x0F, 0xC7, 0xFF, 0xC9, 0x7F, 0xFC, 0x70,
+    0x9F, 0xE7, 0x2F, 0xD9, 0x72, 0xAF, 0x95, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF,
+    0xFC, 0x90, 0x9F, 0xFF, 0xC9, 0x09, 0xFF, 0xFC, 0x91, 0x99, 0xAF, 0xA9, 0x96, 0xF9, 0x71, 0xFA,
+    0x71, 0x9F, 0x97, 0x19, 0xFA, 0x71, 0x9F, 0xC7, 0x2F, 0xD9, 0x71, 0xFF, 0xEA, 0x49, 0xFF, 0xCA,
+    0x39, 0xFF, 0xDA, 0x2A, 0xFE, 0xAA, 0xAA, 0x91, 0xAF, 0xC9, 0x70, 0xFC, 0x71, 0x9F, 0xA7, 0x19,
+    0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x72, 0xFD, 0x97, 0x0A, 0xFF, 0xA9, 0x5F, 0xFE, 0xA4, 0xAF,
+    0xFD, 0xA5, 0xAF, 0xFC, 0x70, 0x9F, 0xD9, 0x71, 0xAF, 0x97, 0x1A, 0xF7, 0x2A, 0xF7, 0x2F, 0xA7,
+    0x19, 0xF9, 0x71, 0xAA, 0xAA, 0xA1, 0x69, 0x9A, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFC, 0x93, 0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91, 0xFC, 0x59, 0xFC, 0x1F, 0xC6,
+    0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x1F,
+    0xC6, 0xFC, 0x1F, 0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F, 0xDA, 0xAA, 0xFD, 0x39, 0xFF,
+    0xFC, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x79, 0xFF, 0xFF, 0xFE, 0x9F,
+    0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xFE, 0x0A, 0xAA, 0xFD, 0xAA, 0xAA, 0xAF, 0xCA, 0xAA, 0x93, 0x9F,
+    0xA4, 0xFC, 0x79, 0xFA, 0x4F, 0xC7, 0x9F, 0xA4, 0xFC, 0x79, 0xFA, 0x4F, 0xC7, 0x9F, 0xA4, 0xFC,
+    0x79, 0xFA, 0x4F, 0xC7, 0x9F, 0xA4, 0xFC, 0x79, 0xFA, 0x4F, 0xC7, 0x9F, 0xA4, 0xFC, 0x79, 0xFA,
+    0x4F, 0xC9, 0x69, 0xFA, 0x4F, 0xDA, 0xCA, 0x39, 0xFA, 0x4A, 0xFE, 0xA3, 0x9F, 0xA5, 0xFE, 0xA3,
+    0x9F, 0xA5, 0x9F, 0xD9, 0x77, 0x29, 0x92, 0x69, 0x9A, 0x99, 0x72, 0xFF, 0xA6, 0x9F, 0xFE, 0x93,
+    0x9F, 0xFF, 0xC3, 0xFD, 0x99, 0xAF, 0xD1, 0x9F, 0xC4, 0xFC, 0x90, 0xAF, 0x94, 0xAF, 0xA0, 0xFC,
+    0x59, 0xFC, 0x0F, 0xC6, 0xFC, 0x0F, 0xC6, 0xFC, 0x0F, 0xC6, 0xFC, 0x0F, 0xC6, 0xFC, 0x0F, 0xC5,
+    0x9F, 0xC0, 0xFC, 0x5A, 0xFA, 0x0F, 0xCA, 0x39, 0xFC, 0x1F, 0xEA, 0xAA, 0xFD, 0x1F, 0xFF, 0xE2,
+    0xFF, 0xFD, 0x92, 0xFC, 0x9F, 0xDA, 0x4F, 0xC2, 0x99, 0x7F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x30, 0x69, 0x9A, 0x99, 0x79, 0xFF, 0xCA, 0x3A, 0xFF,
+    0xE2, 0xAF, 0xFE, 0x92, 0xFD, 0xA9, 0xAE, 0x2A, 0xFC, 0x59, 0x2F, 0xC7, 0x19, 0xFC, 0x71, 0x9F,
+    0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xC7, 0x2F, 0xCA, 0x71, 0xFD, 0xA7,
+    0x09, 0xFF, 0xA9, 0x5A, 0xFF, 0xD9, 0x49, 0xFF, 0xD9, 0x5A, 0xFF, 0xC7, 0x9A, 0xFD, 0x72, 0xFC,
+    0x72, 0xFC, 0x72, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF7, 0x2A, 0xAA, 0xA9, 0x10, 0x77, 0x70, 0x9F,
+    0xFF, 0xC9, 0x29, 0xFF, 0xFE, 0x91, 0x9F, 0xFF, 0xF9, 0x1F, 0xEA, 0xAF, 0xCA, 0xAA, 0x1A, 0xFC,
+    0x4F, 0x4F, 0xC9, 0x4F, 0xC2, 0x9F, 0xC5, 0xAF, 0x91, 0x9F, 0xA5, 0x9F, 0xA1, 0x9F, 0xA5, 0x9F,
+    0xA1, 0x9F, 0xA5, 0x9F, 0xC1, 0x9F, 0xA5, 0x9F, 0xA1, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x5F, 0xC9,
+    0x2A, 0xFC, 0x3A, 0xFC, 0x4F, 0xDA, 0xAF, 0xD9, 0x49, 0xFF, 0xFA, 0x69, 0xFF, 0xDA, 0x71, 0xAF,
+    0xDA, 0x97, 0x59, 0x97, 0x10, 0x77, 0x1F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xAA, 0xAA,
+    0xFC, 0xAA, 0xAA, 0xAA, 0x94, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF,
+    0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xF9, 0x72, 0xAF, 0x97, 0x2A, 0xFA, 0x72, 0x9F, 0xDA,
+    0xAC, 0xA6, 0xFF, 0xCA, 0x69, 0xFF, 0xA7, 0x9F, 0xE9, 0x72, 0x99, 0x93, 0x77, 0x1A, 0xF9, 0x4A,
+    0xF9, 0x0A, 0xF9, 0x4A, 0xFA, 0x0A, 0xF9, 0x49, 0xFA, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5A, 0xF0, 0xAF, 0x95, 0xAF, 0x0A, 0xF9,
+    0x5F, 0xC0, 0x9F, 0x95, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA4, 0x9F, 0xA1, 0xFC, 0x93, 0xFC,
+    0x91, 0xAF, 0xDA, 0xFE, 0x3F, 0xFF, 0xC9, 0x39, 0xFF, 0xE9, 0x6A, 0xFE, 0xA7, 0x39, 0x97, 0x00,
+    0x72, 0x99, 0x99, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7,
+    0x73, 0xAF, 0x77, 0x3F, 0xC7, 0x7A, 0xFF, 0xEA, 0x71, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFE, 0x4F,
+    0xE9, 0xFC, 0x9F, 0xE2, 0xAF, 0xC9, 0x1A, 0xF1, 0x9F, 0xCA, 0x1F, 0xCA, 0x2A, 0xF2, 0x9F, 0xC1,
+    0xFC, 0x3A, 0xF3, 0xFC, 0x99, 0xFA, 0x3A, 0xF3, 0xAF, 0xA9, 0xFA, 0x3A, 0xF3, 0x9F, 0xA9, 0xFA,
+    0x3A, 0xF3, 0xAF, 0xA9, 0xFC, 0x3A, 0xF3, 0xAF, 0xA0, 0xFC, 0x3A, 0xF3, 0xFC, 0x90, 0xFC, 0xA2,
+    0xAF, 0x29, 0xFC, 0x19, 0xFC, 0xA1, 0xAF, 0x19, 0xFC, 0xA2, 0xAF, 0xDA, 0xFC, 0xAF, 0xE4, 0xAF,
+    0xFF, 0xFD, 0x69, 0xFF, 0xFE, 0xA7, 0x19, 0xAF, 0xFC, 0xA9, 0x77, 0xAF, 0x77, 0x3A, 0xF7, 0x73,
+    0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x73, 0xAF, 0x77, 0x3A, 0xF7, 0x10, 0x09,
+    0x99, 0x97, 0x7F, 0xD7, 0x09, 0xF9, 0xFE, 0x7F, 0xC0, 0xFE, 0xA5, 0xAF, 0x90, 0xFF, 0x94, 0xFC,
+    0x49, 0xFC, 0x3A, 0xF6, 0xAF, 0x92, 0xFA, 0x7F, 0xC1, 0xAF, 0x70, 0xAF, 0x90, 0xF9, 0x71, 0xFC,
+    0xAF, 0x72, 0xAF, 0xF9, 0x73, 0xFE, 0xA7, 0x4A, 0xFD, 0x76, 0xFC, 0xA7, 0x6F, 0xC9, 0x75, 0xAF,
+    0xD7, 0x49, 0xFE, 0x97, 0x3F, 0xFC, 0x72, 0x9F, 0xAF, 0x97, 0x1F, 0xA0, 0xFC, 0x70, 0xAF, 0x1A,
+    0xF9, 0x69, 0xF9, 0x2F, 0xC6, 0xFC, 0x3A, 0xFC, 0x90, 0x91, 0xAF, 0x94, 0xFF, 0x1F, 0xC5, 0x9F,
+    0xE0, 0xAF, 0x7F, 0xE9, 0xFA, 0x70, 0xAF, 0xA7, 0x74, 0x71, 0x99, 0x99, 0x77, 0x2A, 0xF7, 0x72,
+    0xAF, 0x77, 0x2A, 0xF7, 0x72, 0xAF, 0x77, 0x2A, 0xF7, 0x72, 0xAF, 0x77, 0x2A, 0xF7, 0x1A, 0xF3,
+    0xAF, 0x29, 0xFA, 0x0A, 0xF3, 0xAF, 0x3F, 0xC0, 0xAF, 0x3A, 0xF3, 0xFC, 0x0A, 0xF3, 0xAF, 0x3A,
+    0xF0, 0xAF, 0x3A, 0xF3, 0xAF, 0x9A, 0xF3, 0xAF, 0x39, 0xF9, 0xAF, 0x3A, 0xF3, 0x9F, 0xAA, 0xF3,
+    0xAF, 0x39, 0xFA, 0xAF, 0x3A, 0xF4, 0xFA, 0xAF, 0x3A, 0xF3, 0x9F, 0xAA, 0xF3, 0xAF, 0x39, 0xFA,
+    0xAF, 0x92, 0xAF, 0x3A, 0xF9, 0x9F, 0xC2, 0xAF, 0x3F, 0xC1, 0xFC, 0xA1, 0xAF, 0x19, 0xFC, 0xA1,
+    0xAF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFE, 0x94, 0xAF, 0xFF, 0xF9, 0x69, 0xAF, 0xFE, 0xA9, 0x75, 0xAF,
+    0x97, 0x71, 0xAF, 0x77, 0x2A, 0xF7, 0x72, 0xAF, 0x77, 0x2A, 0xF7, 0x72, 0xAF, 0x77, 0x2A, 0xF7,
+    0x72, 0xAF, 0x71, 0x77, 0x75, 0xAF, 0x72, 0xF9, 0x49, 0xF7, 0x39, 0xF4, 0xFA, 0x74, 0xFC, 0x3F,
+    0x97, 0x49, 0xF2, 0xAF, 0x76, 0xF9, 0x1F, 0xA4, 0x99, 0x99, 0x94, 0xFA, 0x1F, 0xA4, 0xFA, 0x4A,
+    0xF1, 0xF9, 0x4F, 0xA4, 0xAF, 0x1F, 0x94, 0xFA, 0x4A, 0xF1, 0xF9, 0x4F, 0xA4, 0xAF, 0x1F, 0xA4,
+    0xFA, 0x4A, 0xF1, 0xFA, 0x4F, 0xC4, 0xFC, 0x1F, 0xC4, 0xFC, 0x4F, 0xA1, 0x9F, 0xA2, 0x9F, 0xC9,
+    0x2A, 0xF9, 0x2F, 0xDA, 0xAF, 0xEA, 0xAF, 0xD3, 0x9F, 0xFD, 0x0F, 0xFD, 0x94, 0xAF, 0xF9, 0x09,
+    0xFF, 0xA6, 0x9F, 0xD9, 0x29, 0xFD, 0x97, 0x29, 0x97, 0x09, 0x96, 0x7A, 0xFC, 0xA7, 0x70, 0xFE,
+    0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74,
+    0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A,
+    0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF,
+    0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3,
+    0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72,
+    0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x77, 0x77, 0x77, 0x72, 0xAC, 0xA7, 0x73, 0xFC, 0x77, 0x2F,
+    0xC9, 0x77, 0x1F, 0xC7, 0x72, 0x9E, 0x97, 0x77, 0x71, 0x59, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A,
+    0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99,
+    0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F,
+    0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD,
+    0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x77, 0x71,
+    0xAD, 0x97, 0x3A, 0xF9, 0x72, 0xFC, 0xA7, 0x2A, 0xFA, 0x73, 0xAD, 0xA7, 0x76, 0x79, 0xAA, 0xA9,
+    0x77, 0x2F, 0xD9, 0x77, 0x0F, 0xE7, 0x70, 0x91, 0xF9, 0x77, 0x2A, 0xE9, 0x77, 0x1A, 0xF7, 0x71,
+    0xAE, 0xA7, 0x72, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x72, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE,
+    0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF,
+    0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F,
+    0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F,
+    0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70,
+    0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F,
+    0xCA, 0x72, 0xAF, 0xC0, 0x5A, 0xAA, 0xA9, 0x72, 0xAF, 0xD7, 0x1A, 0xFD, 0xA7, 0x39, 0xF7, 0x4E,
+    0xA7, 0x29, 0xF9, 0x72, 0xF9, 0x73, 0xE7, 0x77, 0x59, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A, 0xFF,
+    0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99, 0xAF,
+    0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA,
+    0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0,
+    0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x77, 0x19,
+    0xAA, 0xA7, 0x73, 0xEA, 0x72, 0xAA, 0xAA, 0xA2, 0xEA, 0x72, 0xFE, 0x0A, 0xD9, 0x72, 0xAF, 0xEA,
+    0x75, 0x9E, 0x90, 0x9E, 0x97, 0x39, 0xE9, 0x29, 0xE9, 0x73, 0x99, 0x69, 0x97, 0x77, 0x76, 0xAF,
+    0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74,
+    0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA,
+    0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF,
+    0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99,
+    0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F,
+    0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x77, 0x77, 0x29, 0xEA, 0x76, 0xEA,
+    0x6F, 0xD1, 0xEA, 0x6F, 0xEA, 0x9A, 0xA9, 0x6A, 0xE9, 0xAE, 0xA7, 0x09, 0xE9, 0x19, 0xE9, 0x7D,
+    0xA5, 0xE7, 0x77, 0x69, 0x99, 0xA9, 0x97, 0x29, 0xFF, 0xD7, 0xAF, 0xFF, 0x7F, 0xFF, 0xC6, 0xAD,
+    0x99, 0x1A, 0xFC, 0x97, 0x5A, 0xF9, 0x75, 0x9F, 0xA7, 0x29, 0x99, 0xAF, 0xA5, 0x9A, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xFC, 0xA3, 0xFF, 0xAA, 0xFC, 0xA2, 0x9F, 0xC9, 0x39, 0xFA, 0x2A, 0xFA, 0x49, 0xFA,
+    0x2A, 0xF9, 0x4A, 0xFA, 0x2A, 0xFA, 0x39, 0xFC, 0xA2, 0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x3F, 0xFF,
+    0xEA, 0x39, 0xFF, 0xC0, 0x9E, 0xA4, 0x9F, 0xDA, 0x2E, 0xA7, 0x99, 0x74, 0x0A, 0xAA, 0x97, 0x73,
+    0xAE, 0x77, 0x4A, 0xE2, 0xAA, 0xAA, 0xA9, 0x73, 0x9D, 0xA0, 0xFE, 0x77, 0xAF, 0xEA, 0x75, 0x9E,
+    0xA0, 0x9E, 0xA7, 0x39, 0xE9, 0x3E, 0x97, 0x39, 0x96, 0x99, 0x77, 0x77, 0x6A, 0xFC, 0xA7, 0x70,
+    0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC,
+    0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97,
+    0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F,
+    0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF,
+    0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC,
+    0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x77, 0x2A, 0xE9, 0x76, 0xAE, 0x77, 0xAD, 0xA1,
+    0xFD, 0x79, 0xAA, 0x0F, 0xF7, 0x1A, 0xEA, 0xAE, 0xA7, 0x9E, 0x91, 0x9E, 0x96, 0xDA, 0x5A, 0xD7,
+    0x77, 0x49, 0x99, 0xA9, 0x97, 0x19, 0xFF, 0xD6, 0xAF, 0xFF, 0x6F, 0xFF, 0xC5, 0xAD, 0x99, 0x1A,
+    0xFC, 0x97, 0x4A, 0xF9, 0x74, 0x9F, 0xA7, 0x19, 0x99, 0xAF, 0xA4, 0x9A, 0xFF, 0xEA, 0x3A, 0xFF,
+    0xFC, 0xA2, 0xFF, 0xAA, 0xFC, 0xA1, 0x9F, 0xC9, 0x39, 0xFA, 0x1A, 0xFA, 0x49, 0xFA, 0x1A, 0xF9,
+    0x4A, 0xFA, 0x1A, 0xFA, 0x39, 0xFC, 0xA1, 0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x2F, 0xFF, 0xEA, 0x29,
+    0xFF, 0xC0, 0x9E, 0xA3, 0x9F, 0xDA, 0x2E, 0xA6, 0x99, 0x71, 0x77, 0x9A, 0x97, 0x74, 0xF9, 0x77,
+    0x2A, 0xAE, 0x77, 0x4A, 0xD7, 0x3A, 0xAA, 0xAA, 0x90, 0x9E, 0x97, 0x2F, 0xE0, 0x9D, 0x73, 0xAF,
+    0xEA, 0x75, 0x9E, 0x90, 0x9E, 0xA7, 0x39, 0xE9, 0x3E, 0x97, 0x39, 0x96, 0x99, 0x77, 0x77, 0x6A,
+    0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7,
+    0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F,
+    0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF,
+    0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99,
+    0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09,
+    0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00, 0x77, 0x77, 0x9E, 0x97, 0x5A,
+    0xF7, 0x70, 0xD9, 0x75, 0x9A, 0xD6, 0xFD, 0x1E, 0x6F, 0xF0, 0xAA, 0x6A, 0xEA, 0xAE, 0xA7, 0x9E,
+    0x91, 0x9E, 0x96, 0xDA, 0x5A, 0xD7, 0x77, 0x49, 0x99, 0xA9, 0x97, 0x19, 0xFF, 0xD6, 0xAF, 0xFF,
+    0x6F, 0xFF, 0xC5, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x4A, 0xF9, 0x74, 0x9F, 0xA7, 0x19, 0x99, 0xAF,
+    0xA4, 0x9A, 0xFF, 0xEA, 0x3A, 0xFF, 0xFC, 0xA2, 0xFF, 0xAA, 0xFC, 0xA1, 0x9F, 0xC9, 0x39, 0xFA,
+    0x1A, 0xFA, 0x49, 0xFA, 0x1A, 0xF9, 0x4A, 0xFA, 0x1A, 0xFA, 0x39, 0xFC, 0xA1, 0x9F, 0xCA, 0x99,
+    0xAF, 0xDA, 0x2F, 0xFF, 0xEA, 0x29, 0xFF, 0xC0, 0x9E, 0xA3, 0x9F, 0xDA, 0x2E, 0xA6, 0x99, 0x73,
+    0x77, 0x77, 0xAE, 0xA2, 0xAC, 0x97, 0x3A, 0xFF, 0xD7, 0x4D, 0x99, 0xAF, 0xCA, 0x74, 0xAA, 0x39,
+    0xAA, 0x97, 0x70, 0x99, 0x99, 0x97, 0x71, 0x9F, 0xC9, 0x77, 0x9F, 0xE9, 0x76, 0xEA, 0x0A, 0xE9,
+    0x74, 0xE9, 0x29, 0xE9, 0x73, 0x99, 0x69, 0x97, 0x77, 0x75, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79,
+    0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0,
+    0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92,
+    0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5,
+    0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC,
+    0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA,
+    0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x59, 0xAA, 0x93, 0xAA, 0x5F, 0xD9, 0x0A, 0xD4, 0x9F, 0xFD, 0x94,
+    0xD9, 0x19, 0xFA, 0x77, 0x71, 0x9F, 0x97, 0x19, 0xFD, 0x97, 0x9E, 0xAA, 0xE9, 0x6E, 0x91, 0x9E,
+    0x5D, 0xA5, 0xAD, 0x77, 0x79, 0x99, 0xA9, 0x97, 0x9F, 0xFC, 0xA4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3,
+    0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xCA, 0x0A, 0xFE, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA, 0x49, 0xFA,
+    0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF, 0xFE, 0xA0,
+    0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x70, 0xAA, 0xAA, 0xA7, 0x71,
+    0xAF, 0xD7, 0x7A, 0xFE, 0xA7, 0x59, 0xF9, 0xFA, 0x73, 0x9F, 0x2F, 0x97, 0x2E, 0xA4, 0xAE, 0x77,
+    0x77, 0x77, 0x75, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7,
+    0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC,
+    0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA,
+    0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD,
+    0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC,
+    0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC7, 0x77, 0x77,
+    0x77, 0x2A, 0xCA, 0x77, 0x3F, 0xC7, 0x72, 0xFC, 0x97, 0x71, 0xFC, 0x77, 0x29, 0xE9, 0x77, 0x77,
+    0x10, 0x59, 0xAA, 0xAA, 0x97, 0x2F, 0xD9, 0x70, 0xFF, 0x7F, 0xAA, 0xF5, 0xF9, 0x19, 0xF3, 0x9E,
+    0x94, 0xAD, 0xA7, 0x77, 0x99, 0x9A, 0x99, 0x79, 0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD,
+    0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F, 0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9,
+    0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF,
+    0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99, 0x77, 0x77, 0x1A, 0xD9, 0x73, 0xAF, 0x97, 0x2F,
+    0xCA, 0x72, 0xAF, 0x97, 0x3E, 0xA7, 0x76, 0x73, 0xAA, 0xA9, 0x77, 0x2A, 0xE7, 0x73, 0xE7, 0x7D,
+    0x90, 0xAD, 0x1A, 0xCA, 0x73, 0xE4, 0x9D, 0xA7, 0x3A, 0xEA, 0x99, 0xAE, 0x75, 0xFF, 0xCA, 0x76,
+    0xAF, 0xD9, 0x77, 0x29, 0x97, 0x77, 0x77, 0x2A, 0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76,
+    0xFF, 0xC7, 0x6F, 0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A,
+    0xF9, 0x1F, 0xA7, 0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70,
+    0xFC, 0x4F, 0xC7, 0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF,
+    0xC9, 0x4A, 0xFF, 0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9,
+    0x2F, 0xCA, 0x70, 0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7,
+    0x2A, 0xFC, 0x00, 0x77, 0x71, 0xF7, 0x39, 0xE7, 0x09, 0x2E, 0x19, 0x94, 0xAD, 0x09, 0xAA, 0x1A,
+    0xD4, 0x9D, 0xA3, 0x9E, 0x5F, 0xFD, 0x96, 0xFF, 0x97, 0x09, 0xAD, 0xAA, 0x77, 0x73, 0x99, 0x9A,
+    0x99, 0x79, 0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9,
+    0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF,
+    0xCA, 0x9F, 0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA,
+    0x9F, 0xCA, 0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E,
+    0xA4, 0x99, 0x71, 0x7A, 0xAA, 0x97, 0x73, 0x9E, 0x77, 0x49, 0xDA, 0x77, 0x0D, 0x90, 0x9D, 0x90,
+    0xAC, 0x97, 0x3E, 0x49, 0xD9, 0x73, 0xAE, 0xA9, 0x9A, 0xE7, 0x5F, 0xFC, 0x97, 0x6A, 0xFD, 0x97,
+    0x72, 0x99, 0x77, 0x77, 0x72, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76,
+    0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA,
+    0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC,
+    0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF,
+    0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7,
+    0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0,
+    0x77, 0x59, 0xE7, 0x5A, 0xE7, 0x29, 0x1A, 0xD9, 0x19, 0x94, 0xAD, 0x19, 0xA9, 0x0A, 0xD4, 0x9D,
+    0xA3, 0x9E, 0x5F, 0xFD, 0x96, 0xFF, 0x97, 0x09, 0xAD, 0xAA, 0x77, 0x73, 0x99, 0x9A, 0x99, 0x79,
+    0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F,
+    0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA, 0x9F,
+    0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F, 0xCA,
+    0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4, 0x99,
+    0x71, 0x70, 0x9D, 0xA7, 0x73, 0xAF, 0x77, 0x49, 0xD7, 0x74, 0xAD, 0x76, 0x9D, 0x1A, 0xCA, 0x1D,
+    0x97, 0x3D, 0xA1, 0x91, 0xAD, 0x97, 0x3F, 0x99, 0x9F, 0x75, 0xFF, 0xC9, 0x76, 0xAF, 0xD9, 0x77,
+    0x29, 0x97, 0x77, 0x77, 0x2A, 0xFC, 0xA7, 0x70, 0xFE, 0x77, 0x9F, 0xE9, 0x76, 0xFF, 0xC7, 0x6F,
+    0xAF, 0x75, 0xAF, 0x0F, 0xA7, 0x4F, 0xC0, 0xFC, 0x74, 0xFA, 0x0A, 0xF7, 0x3A, 0xF9, 0x1F, 0xA7,
+    0x2F, 0xC2, 0xFC, 0x71, 0x9F, 0xA2, 0xAF, 0x97, 0x0A, 0xF9, 0x29, 0xFA, 0x70, 0xFC, 0x4F, 0xC7,
+    0x9F, 0xA4, 0xAF, 0x96, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xFC, 0x59, 0xFF, 0xFF, 0xC9, 0x4A, 0xFF,
+    0xFF, 0xD4, 0xFC, 0xA9, 0x99, 0x99, 0x99, 0xAF, 0xC3, 0x9F, 0xC7, 0x0F, 0xC9, 0x2F, 0xCA, 0x70,
+    0xAF, 0xC2, 0xFC, 0x97, 0x09, 0xFC, 0x19, 0xFC, 0x72, 0xFC, 0xA0, 0xFC, 0xA7, 0x2A, 0xFC, 0x00,
+    0x79, 0x76, 0xF7, 0x4A, 0xAD, 0x97, 0x5D, 0x97, 0x99, 0x19, 0xDA, 0x19, 0x5E, 0x1C, 0x91, 0xE4,
+    0xAD, 0xA3, 0xAD, 0xA5, 0xFF, 0xD7, 0xFF, 0x97, 0x09, 0xAD, 0xA9, 0x77, 0x73, 0x99, 0x9A, 0x99,
+    0x79, 0xFF, 0xD4, 0xAF, 0xFF, 0x4F, 0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72,
+    0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29, 0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0F, 0xFA, 0xAF, 0xCA,
+    0x9F, 0xC9, 0x39, 0xFA, 0xAF, 0xA4, 0x9F, 0xAA, 0xF9, 0x4A, 0xFA, 0xAF, 0xA3, 0x9F, 0xCA, 0x9F,
+    0xCA, 0x99, 0xAF, 0xDA, 0x0F, 0xFF, 0xEA, 0x09, 0xFF, 0xC0, 0x9E, 0xA1, 0x9F, 0xDA, 0x2E, 0xA4,
+    0x99, 0x71, 0x77, 0x77, 0xAE, 0xA2, 0xAC, 0xA7, 0x3A, 0xFF, 0xD9, 0x73, 0xDA, 0x9A, 0xFC, 0xA7,
+    0x4A, 0xA3, 0x9A, 0xA9, 0x75, 0xAA, 0x6A, 0xA7, 0x4D, 0xA4, 0x9D, 0x97, 0x3F, 0xA9, 0x9A, 0xE7,
+    0x5F, 0xFC, 0x97, 0x6A, 0xFD, 0x97, 0x72, 0x99, 0x77, 0x77, 0x71, 0xAF, 0xCA, 0x77, 0x0F, 0xE7,
+    0x79, 0xFE, 0x97, 0x6F, 0xFC, 0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F,
+    0xA0, 0xAF, 0x73, 0xAF, 0x91, 0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF,
+    0x92, 0x9F, 0xA7, 0x0F, 0xC4, 0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF,
+    0xC5, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39,
+    0xFC, 0x70, 0xFC, 0x92, 0xFC, 0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F,
+    0xCA, 0x0F, 0xCA, 0x72, 0xAF, 0xC0, 0x59, 0xAA, 0x93, 0xAA, 0x5A, 0xFC, 0x90, 0xAD, 0x49, 0xFF,
+    0xD9, 0x4A, 0xCA, 0x19, 0xFA, 0x77, 0x6D, 0xA5, 0xAD, 0x4A, 0xDA, 0x39, 0xDA, 0x5F, 0xFD, 0x7F,
+    0xF9, 0x70, 0x9A, 0xDA, 0x97, 0x77, 0x29, 0x99, 0xA9, 0x97, 0x9F, 0xFC, 0xA4, 0xAF, 0xFF, 0x4F,
+    0xFF, 0xC3, 0xAD, 0x99, 0x1A, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0xA7, 0x99, 0x9A, 0xFA, 0x29,
+    0xAF, 0xFE, 0xA1, 0xAF, 0xFF, 0xCA, 0x0A, 0xFE, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F, 0xAA, 0xFA,
+    0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD, 0xA0, 0xFF,
+    0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x10, 0x49, 0xAA, 0x95,
+    0x9A, 0xA7, 0x3E, 0x5E, 0x73, 0xFC, 0xAA, 0xFC, 0x73, 0x9F, 0xFD, 0x75, 0x9F, 0xF7, 0x70, 0x9A,
+    0xDA, 0x97, 0x77, 0x77, 0x77, 0x70, 0xAF, 0xCA, 0x77, 0x0F, 0xE7, 0x79, 0xFE, 0x97, 0x6F, 0xFC,
+    0x76, 0xFA, 0xF7, 0x5A, 0xF0, 0xFA, 0x74, 0xFC, 0x0F, 0xC7, 0x4F, 0xA0, 0xAF, 0x73, 0xAF, 0x91,
+    0xFA, 0x72, 0xFC, 0x2F, 0xC7, 0x19, 0xFA, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0x9F, 0xA7, 0x0F, 0xC4,
+    0xFC, 0x79, 0xFA, 0x4A, 0xF9, 0x6A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFF, 0xC5, 0x9F, 0xFF, 0xFC, 0x94,
+    0xAF, 0xFF, 0xFD, 0x4F, 0xCA, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x39, 0xFC, 0x70, 0xFC, 0x92, 0xFC,
+    0xA7, 0x0A, 0xFC, 0x2F, 0xC9, 0x70, 0x9F, 0xC1, 0x9F, 0xC7, 0x2F, 0xCA, 0x0F, 0xCA, 0x72, 0xAF,
+    0xC7, 0x77, 0x77, 0x77, 0x2A, 0xCA, 0x77, 0x3F, 0xC7, 0x72, 0xFC, 0x97, 0x71, 0xFC, 0x77, 0x29,
+    0xE9, 0x77, 0x77, 0x10, 0x2A, 0xAA, 0x6A, 0xAA, 0x3E, 0x94, 0xAD, 0xA3, 0x9F, 0xAA, 0xAF, 0x94,
+    0xFF, 0xDA, 0x6F, 0xFA, 0x70, 0x9A, 0xDA, 0xA7, 0x77, 0x39, 0x99, 0xA9, 0x97, 0x9F, 0xFD, 0x4A,
+    0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xD9, 0x91, 0xAF, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFA, 0x79, 0x99,
+    0xAF, 0xA2, 0x9A, 0xFF, 0xEA, 0x1A, 0xFF, 0xFC, 0xA0, 0xFF, 0xAA, 0xFC, 0xA9, 0xFC, 0x93, 0x9F,
+    0xAA, 0xFA, 0x49, 0xFA, 0xAF, 0x94, 0xAF, 0xAA, 0xFA, 0x39, 0xFC, 0xA9, 0xFC, 0xA9, 0x9A, 0xFD,
+    0xA0, 0xFF, 0xFE, 0xA0, 0x9F, 0xFC, 0x09, 0xEA, 0x19, 0xFD, 0xA2, 0xEA, 0x49, 0x97, 0x77, 0x71,
+    0xAC, 0xA9, 0x73, 0xFC, 0x97, 0x2F, 0xC9, 0x72, 0xFC, 0x97, 0x3E, 0xA7, 0x76, 0xFF, 0xFC, 0xAF,
+    0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF,
+    0xFC, 0x0F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x77, 0x77, 0x9D,
+    0xA7, 0x09, 0xFA, 0x7A, 0xFC, 0x79, 0xFC, 0x70, 0xAE, 0x77, 0x30, 0x69, 0xAA, 0x99, 0x71, 0x9F,
+    0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5,
+    0x9F, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74,
+    0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93,
+    0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x29, 0x99, 0x77, 0x77, 0xAC, 0xA9, 0x74, 0xFC, 0x74, 0xFC,
+    0x97, 0x3F, 0xC7, 0x49, 0xE9, 0x77, 0x70, 0x29, 0xAA, 0xA9, 0x70, 0xFD, 0x96, 0xFE, 0x69, 0x1F,
+    0x71, 0xAE, 0x70, 0xAF, 0x7A, 0xEA, 0x70, 0xAD, 0x97, 0x77, 0x71, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x59, 0xAA, 0xAA, 0x97, 0x3F,
+    0xDA, 0x72, 0xFE, 0x97, 0x19, 0x1A, 0xEA, 0x74, 0x9E, 0xA7, 0x39, 0xF7, 0x39, 0xF7, 0x5E, 0x77,
+    0x77, 0x9A, 0xA9, 0x97, 0x19, 0xFF, 0xA6, 0xAF, 0xFE, 0x4A, 0xFF, 0xFC, 0x3F, 0xCA, 0x2F, 0xC9,
+    0x1A, 0xFA, 0x4F, 0xC1, 0xFC, 0x59, 0xF1, 0xFC, 0x59, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xFF, 0xF9, 0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x93, 0xFD, 0xA9, 0x99,
+    0xAE, 0x92, 0x9F, 0xFF, 0xC9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xC9, 0x72, 0x99, 0x95, 0x77, 0xAE,
+    0xA3, 0xDA, 0x0A, 0xFE, 0xAE, 0x90, 0xFF, 0xF0, 0xAD, 0x90, 0x9F, 0xD9, 0x0A, 0xCA, 0x39, 0xAC,
+    0xA7, 0x77, 0x6F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xC9, 0x99, 0x99,
+    0x99, 0x90, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F,
+    0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xA0, 0x77, 0x59, 0xF9, 0x2E, 0x4A, 0xFE, 0xAA, 0xDA, 0x4F, 0xFF, 0x49, 0xDA, 0x09,
+    0xFD, 0x94, 0x9D, 0x4A, 0xCA, 0x97, 0x77, 0x49, 0xAA, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE4,
+    0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F, 0xC5, 0x9F, 0x1F, 0xC5, 0x9F,
+    0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x97,
+    0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC, 0x93, 0x9F, 0xFF, 0x95, 0xAF,
+    0xFC, 0x97, 0x29, 0x99, 0x50, 0x75, 0xAA, 0xA9, 0x74, 0xF4, 0xAA, 0xAA, 0xA9, 0x19, 0xE4, 0xAF,
+    0xD9, 0x9E, 0x49, 0xFF, 0x70, 0xEA, 0x1F, 0x6E, 0xA3, 0xAD, 0xA5, 0x99, 0x69, 0x99, 0x77, 0x7F,
+    0xFF, 0xCA, 0x3F, 0xFF, 0xCA, 0x3F, 0xFF, 0xCA, 0x3F, 0xFF, 0xCA, 0x3F, 0xC9, 0x99, 0x99, 0x99,
+    0x94, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFF,
+    0xC4, 0xFF, 0xFC, 0x4F, 0xFF, 0xC4, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xFF, 0xCA, 0x3F, 0xFF, 0xCA, 0x3F, 0xFF, 0xCA,
+    0x3F, 0xFF, 0xCA, 0x20, 0x77, 0x77, 0x4F, 0x77, 0xF7, 0xFD, 0x90, 0xAD, 0xA7, 0xAF, 0xE0, 0xAA,
+    0x97, 0x9E, 0xA9, 0xF7, 0x2E, 0xA2, 0xEA, 0x70, 0xAD, 0x94, 0xAD, 0x77, 0x77, 0x19, 0xAA, 0x99,
+    0x74, 0x9F, 0xFA, 0x71, 0xAF, 0xFE, 0x7A, 0xFF, 0xFC, 0x6F, 0xCA, 0x2F, 0xC9, 0x4A, 0xFA, 0x4F,
+    0xC4, 0xFC, 0x59, 0xF4, 0xFC, 0x59, 0xF9, 0x29, 0xFF, 0xFF, 0x92, 0x9F, 0xFF, 0xF9, 0x29, 0xFF,
+    0xFF, 0x92, 0x9F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC9, 0x76, 0xAF, 0xC7, 0x96, 0xFD, 0xA9, 0x99, 0xAE,
+    0x95, 0x9F, 0xFF, 0xC9, 0x69, 0xFF, 0xF9, 0x70, 0xAF, 0xFC, 0x97, 0x59, 0x99, 0x70, 0x0A, 0xAA,
+    0x97, 0x7A, 0xE9, 0x77, 0xAE, 0x2A, 0xAA, 0xAA, 0x97, 0x9E, 0x0F, 0xE7, 0x3A, 0xFF, 0x71, 0x9E,
+    0xA0, 0x9E, 0xA7, 0x0E, 0x93, 0xE9, 0x79, 0x96, 0x99, 0x77, 0x74, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC,
+    0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x6F, 0xC7,
+    0x6F, 0xC7, 0x6F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x96, 0xFF, 0xFC, 0x6F, 0xFF, 0xC6, 0xFF,
+    0xFC, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC,
+    0x76, 0xFC, 0x76, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0xA0, 0x77,
+    0x39, 0xEA, 0x77, 0xAE, 0x77, 0x09, 0xE1, 0xFD, 0x97, 0x0A, 0xA9, 0xAF, 0xE7, 0x29, 0xEA, 0x9F,
+    0x71, 0xEA, 0x2E, 0xA7, 0xAD, 0x94, 0xAD, 0x77, 0x77, 0x9A, 0xA9, 0x97, 0x39, 0xFF, 0xA7, 0x0A,
+    0xFF, 0xE6, 0xAF, 0xFF, 0xC5, 0xFC, 0xA2, 0xFC, 0x93, 0xAF, 0xA4, 0xFC, 0x3F, 0xC5, 0x9F, 0x3F,
+    0xC5, 0x9F, 0x91, 0x9F, 0xFF, 0xF9, 0x19, 0xFF, 0xFF, 0x91, 0x9F, 0xFF, 0xF9, 0x19, 0xFC, 0x76,
+    0xFC, 0x76, 0xFC, 0x97, 0x5A, 0xFC, 0x79, 0x5F, 0xDA, 0x99, 0x9A, 0xE9, 0x49, 0xFF, 0xFC, 0x95,
+    0x9F, 0xFF, 0x97, 0xAF, 0xFC, 0x97, 0x49, 0x99, 0x50, 0x72, 0x9A, 0x99, 0x74, 0xAF, 0x73, 0x9A,
+    0xE7, 0x59, 0xD4, 0xAA, 0xAA, 0xA9, 0x1E, 0xA3, 0xAF, 0xD9, 0x0D, 0x49, 0xFF, 0x7E, 0xA1, 0xF5,
+    0xEA, 0x3A, 0xDA, 0x49, 0x96, 0x99, 0x97, 0x75, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC,
+    0xA2, 0xFF, 0xFC, 0xA2, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x3F,
+    0xC7, 0x3F, 0xC9, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA3, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x73,
+    0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA1, 0x77, 0x77, 0x9E, 0xA7,
+    0x59, 0xF9, 0x77, 0xDA, 0x76, 0x9D, 0x95, 0xFD, 0x90, 0xAD, 0x95, 0xAF, 0xE0, 0x9A, 0x95, 0x9E,
+    0xA9, 0xF7, 0x0E, 0xA2, 0xEA, 0x6A, 0xD9, 0x4A, 0xD7, 0x77, 0x59, 0xAA, 0x99, 0x72, 0x9F, 0xFA,
+    0x7A, 0xFF, 0xE5, 0xAF, 0xFF, 0xC4, 0xFC, 0xA2, 0xFC, 0x92, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0x9F,
+    0x2F, 0xC5, 0x9F, 0x90, 0x9F, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0x90, 0x9F, 0xFF, 0xF9, 0x09, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0x97, 0x4A, 0xFC, 0x79, 0x4F, 0xDA, 0x99, 0x9A, 0xE9, 0x39, 0xFF, 0xFC,
+    0x94, 0x9F, 0xFF, 0x96, 0xAF, 0xFC, 0x97, 0x39, 0x99, 0x60, 0x77, 0x9F, 0x91, 0x9D, 0x19, 0xFE,
+    0xAD, 0xA1, 0xAC, 0xA9, 0x9F, 0xD2, 0xAA, 0x39, 0xAA, 0xA7, 0x99, 0x99, 0x70, 0xFD, 0x6F, 0xEA,
+    0x4A, 0xE0, 0x9E, 0xA2, 0xAD, 0xA3, 0xAD, 0xA1, 0x99, 0x79, 0x97, 0x6F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFC, 0x70, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+    0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x59, 0xAA, 0x93, 0xAA,
+    0x6A, 0xFC, 0xA0, 0x9D, 0x6F, 0xFD, 0xA5, 0xAC, 0xA2, 0xAE, 0xA7, 0x77, 0x4F, 0xA7, 0x3F, 0xDA,
+    0x71, 0xFA, 0xE9, 0x7E, 0xA1, 0x9E, 0x95, 0xAC, 0xA9, 0x4A, 0xD7, 0x77, 0x29, 0xAA, 0x99, 0x71,
+    0x9F, 0xFA, 0x6A, 0xFF, 0xE4, 0xAF, 0xFF, 0xC3, 0xFC, 0xA2, 0xFC, 0x91, 0xAF, 0xA4, 0xFC, 0x1F,
+    0xC5, 0xAF, 0x1F, 0xC5, 0x9F, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFC,
+    0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x79, 0x3F, 0xDA, 0x99, 0x9A, 0xE9, 0x29, 0xFF, 0xFC,
+    0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFC, 0x97, 0x19, 0x99, 0x95, 0x3A, 0xAA, 0xAA, 0x7A, 0xFD, 0x59,
+    0xFE, 0xA3, 0x9F, 0x9F, 0xA2, 0xF2, 0xAE, 0xA0, 0xAD, 0xA4, 0x9E, 0x97, 0x77, 0x3F, 0xFF, 0xCA,
+    0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xC9, 0x99, 0x99, 0x99, 0x90, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xC0, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x0F,
+    0xC7, 0x0F, 0xC7, 0x0F, 0xFF, 0xCA, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0xFF, 0xFC, 0xA7, 0x77, 0x79,
+    0xDA, 0x70, 0x9F, 0xA7, 0xAF, 0xC7, 0x9F, 0xC7, 0x0A, 0xE7, 0x73, 0x59, 0xAA, 0xAA, 0x97, 0x3F,
+    0xD9, 0x71, 0xFF, 0x70, 0xFA, 0xAF, 0x6F, 0x91, 0x9F, 0x49, 0xE5, 0xEA, 0x77, 0x72, 0x9A, 0xA9,
+    0x97, 0x19, 0xFF, 0xA6, 0xAF, 0xFE, 0x4A, 0xFF, 0xFC, 0x3F, 0xCA, 0x2F, 0xC9, 0x1A, 0xFA, 0x4F,
+    0xC1, 0xFC, 0x59, 0xF1, 0xFC, 0x59, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9,
+    0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x93, 0xFD, 0xA9, 0x99, 0xAE, 0x92, 0x9F,
+    0xFF, 0xC9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xC9, 0x72, 0x99, 0x97, 0x77, 0x7A, 0xCA, 0x97, 0x4F,
+    0xC7, 0x4F, 0xC9, 0x73, 0xFC, 0x74, 0x9E, 0x97, 0x77, 0x73, 0xAF, 0xC9, 0x3A, 0xFD, 0x92, 0x9A,
+    0xAF, 0xA6, 0xF5, 0x9E, 0xA4, 0xFC, 0x5E, 0x96, 0xAA, 0xA7, 0x7A, 0xFF, 0xCA, 0xFF, 0xFF, 0xFD,
+    0x9A, 0xFE, 0xA3, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC,
+    0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC3, 0xAF, 0xEA, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x09, 0xAA, 0xA9, 0x3F, 0xD9, 0x1F, 0xE4, 0xF4, 0xAE, 0x3A, 0xF2, 0xAE, 0xA3, 0xAD,
+    0x97, 0x75, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2,
+    0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA2,
+    0xAF, 0xA2, 0xAF, 0xA2, 0xAF, 0xA1, 0xAF, 0xFC, 0xAF, 0xFF, 0xFF, 0xD9, 0xAF, 0xEA, 0x3F, 0xC5,
+    0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC,
+    0x5F, 0xC5, 0xFC, 0x5F, 0xC5, 0xFC, 0x3A, 0xFE, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x77, 0x0A,
+    0xCA, 0x95, 0xFC, 0x5F, 0xC9, 0x4F, 0xC5, 0x9E, 0x97, 0x60, 0x19, 0x91, 0x9F, 0x9A, 0xFA, 0xAF,
+    0xA9, 0xF9, 0x19, 0x97, 0x5A, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF,
+    0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xAA, 0xFA, 0xAF, 0xA7,
+    0x4A, 0xDA, 0x09, 0xFA, 0xAF, 0xCA, 0xFA, 0x0A, 0xDA, 0x60, 0x77, 0x76, 0x9A, 0xFE, 0xA7, 0x39,
+    0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD,
+    0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC,
+    0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F,
+    0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC,
+    0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE,
+    0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97,
+    0x77, 0x77, 0x39, 0xDA, 0x77, 0x29, 0xFA, 0x77, 0x1A, 0xFC, 0x77, 0x19, 0xFA, 0x77, 0x2A, 0xE7,
+    0x77, 0x71, 0x69, 0x9A, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFF, 0xFC, 0x93, 0xFD,
+    0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91, 0xFC, 0x59, 0xFC, 0x1F, 0xC6, 0xFC, 0x09, 0xFC, 0x6F,
+    0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x1F, 0xC6, 0xFC, 0x1F, 0xC9,
+    0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F, 0xDA, 0xAA, 0xFD, 0x39, 0xFF, 0xFC, 0x59, 0xFF, 0xE7,
+    0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x77, 0x77, 0x19, 0xAC, 0xA7, 0x6F, 0xC7, 0x49, 0xFC, 0x74, 0x9F,
+    0xC7, 0x5A, 0xE9, 0x77, 0x71, 0x77, 0x77, 0x0F, 0xCA, 0x77, 0x1F, 0xE7, 0x70, 0xCA, 0xAF, 0x97,
+    0x72, 0xAE, 0x97, 0x72, 0xF7, 0x71, 0x9F, 0xA7, 0x71, 0x9E, 0x77, 0x4A, 0xA9, 0x77, 0x77, 0x70,
+    0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9,
+    0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1,
+    0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F,
+    0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA,
+    0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92,
+    0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA,
+    0x97, 0x70, 0x99, 0x97, 0x10, 0x59, 0xAA, 0xAA, 0x97, 0x4F, 0xDA, 0x73, 0xFE, 0x97, 0x29, 0x1A,
+    0xEA, 0x75, 0x9E, 0xA7, 0x49, 0xF7, 0x49, 0xF7, 0x6E, 0x77, 0x77, 0x19, 0x9A, 0x99, 0x72, 0x9F,
+    0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFF, 0xFC, 0x93, 0xFD, 0x99, 0x9F, 0xD2, 0xAF, 0xC4, 0xFC, 0x91,
+    0xFC, 0x59, 0xFC, 0x1F, 0xC6, 0xFC, 0x09, 0xFC, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFA, 0x6F,
+    0xC0, 0x9F, 0xC6, 0xFC, 0x1F, 0xC6, 0xFC, 0x1F, 0xC9, 0x4A, 0xFA, 0x1A, 0xFC, 0x4F, 0xC9, 0x2F,
+    0xDA, 0xAA, 0xFD, 0x39, 0xFF, 0xFC, 0x59, 0xFF, 0xE7, 0x0A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77,
+    0x2A, 0xAA, 0x97, 0x72, 0xAE, 0x97, 0x1A, 0xAA, 0xAA, 0xA1, 0x9E, 0x97, 0x19, 0xFD, 0x90, 0xE7,
+    0x3F, 0xF9, 0x75, 0xF1, 0xF7, 0x4E, 0xA3, 0xAE, 0x73, 0x99, 0x79, 0x97, 0x77, 0x74, 0x9A, 0xFE,
+    0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD,
+    0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7,
+    0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F,
+    0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC,
+    0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA,
+    0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97, 0x70,
+    0x99, 0x97, 0x10, 0x77, 0x77, 0x4F, 0x77, 0xAE, 0x7F, 0xD9, 0x09, 0xE7, 0xAF, 0xE0, 0xAA, 0xA7,
+    0x9E, 0xA9, 0xF7, 0x2E, 0xA2, 0xEA, 0x70, 0xAD, 0x94, 0xAD, 0x77, 0x77, 0x19, 0x9A, 0x99, 0x74,
+    0x9F, 0xFA, 0x71, 0xAF, 0xFE, 0x96, 0xAF, 0xFF, 0xC9, 0x5F, 0xD9, 0x99, 0xFD, 0x4A, 0xFC, 0x4F,
+    0xC9, 0x3F, 0xC5, 0x9F, 0xC3, 0xFC, 0x6F, 0xC2, 0x9F, 0xC6, 0xFC, 0x29, 0xFA, 0x6F, 0xC2, 0x9F,
+    0xA6, 0xFC, 0x29, 0xFC, 0x6F, 0xC3, 0xFC, 0x6F, 0xC3, 0xFC, 0x94, 0xAF, 0xA3, 0xAF, 0xC4, 0xFC,
+    0x94, 0xFD, 0xAA, 0xAF, 0xD5, 0x9F, 0xFF, 0xC7, 0x9F, 0xFE, 0x72, 0xAF, 0xEA, 0x76, 0x99, 0x97,
+    0x10, 0x09, 0xAA, 0xA7, 0x74, 0xF7, 0x74, 0xE9, 0x1A, 0xAA, 0xAA, 0xA7, 0x4E, 0x09, 0xFD, 0xA7,
+    0x7F, 0xF9, 0x75, 0xF1, 0xF7, 0x4A, 0xDA, 0x3A, 0xE7, 0x39, 0x99, 0x69, 0x97, 0x77, 0x74, 0x9A,
+    0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29,
+    0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC,
+    0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9,
+    0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72,
+    0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F,
+    0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97,
+    0x70, 0x99, 0x97, 0x10, 0x77, 0x49, 0xF7, 0x70, 0x9E, 0x97, 0x70, 0x9E, 0x1A, 0xFC, 0x97, 0x1A,
+    0xA9, 0x9F, 0xE7, 0x4F, 0x9F, 0x72, 0xEA, 0x2E, 0xA7, 0x0A, 0xD9, 0x4A, 0xD9, 0x77, 0x77, 0x09,
+    0x9A, 0x99, 0x74, 0x9F, 0xFA, 0x71, 0xAF, 0xFE, 0x96, 0xAF, 0xFF, 0xC9, 0x5F, 0xD9, 0x99, 0xFD,
+    0x4A, 0xFC, 0x4F, 0xC9, 0x3F, 0xC5, 0x9F, 0xC3, 0xFC, 0x6F, 0xC2, 0x9F, 0xC6, 0xFC, 0x29, 0xFA,
+    0x6F, 0xC2, 0x9F, 0xA6, 0xFC, 0x29, 0xFC, 0x6F, 0xC3, 0xFC, 0x6F, 0xC3, 0xFC, 0x94, 0xAF, 0xA3,
+    0xAF, 0xC4, 0xFC, 0x94, 0xFD, 0xAA, 0xAF, 0xD5, 0x9F, 0xFF, 0xC7, 0x9F, 0xFE, 0x72, 0xAF, 0xEA,
+    0x76, 0x99, 0x97, 0x77, 0x0A, 0xA9, 0x77, 0x39, 0xF7, 0x72, 0x9A, 0xAD, 0x97, 0x74, 0xD9, 0x72,
+    0xAA, 0xAA, 0xAA, 0x1A, 0xDA, 0x72, 0x9F, 0xD9, 0x0D, 0x97, 0x3F, 0xF7, 0x6F, 0x1F, 0x74, 0xAD,
+    0xA3, 0xAE, 0x73, 0x99, 0x79, 0x97, 0x77, 0x74, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF,
+    0xFF, 0xE6, 0xAF, 0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC,
+    0x97, 0x0F, 0xCA, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC,
+    0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72,
+    0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F,
+    0xC9, 0x70, 0xFC, 0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F,
+    0xFF, 0xF9, 0x7A, 0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0x77, 0x77, 0x0E,
+    0xA7, 0x6F, 0x97, 0x7D, 0xA7, 0x69, 0xD9, 0x5F, 0xD9, 0x0A, 0xD9, 0x5A, 0xFE, 0x09, 0xA9, 0x59,
+    0xEA, 0x9F, 0x70, 0xEA, 0x2E, 0xA6, 0xAD, 0x94, 0xAD, 0x77, 0x75, 0x99, 0xA9, 0x97, 0x29, 0xFF,
+    0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A, 0xFC, 0x4F, 0xC9, 0x1F,
+    0xC5, 0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC,
+    0x09, 0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD,
+    0xAA, 0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x77, 0x77,
+    0x9F, 0x92, 0xD7, 0x4F, 0xEA, 0xDA, 0x73, 0xAD, 0x99, 0xFD, 0x74, 0xAA, 0x93, 0xAA, 0xA7, 0x71,
+    0x99, 0x99, 0x77, 0x2F, 0xD7, 0x70, 0xAF, 0xE7, 0x6A, 0xE9, 0x0F, 0x74, 0xAD, 0xA3, 0xAE, 0x73,
+    0x99, 0x79, 0x97, 0x77, 0x73, 0x9A, 0xFE, 0xA7, 0x39, 0xFF, 0xFA, 0x70, 0xAF, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xFC, 0x49, 0xFD, 0xA9, 0x29, 0xFD, 0xA3, 0xFD, 0x96, 0xFD, 0x29, 0xFC, 0x97, 0x0F, 0xCA,
+    0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0xFC, 0xA7, 0x19, 0xFC, 0x1F, 0xC9, 0x72, 0xFC, 0x90, 0xFC, 0x97,
+    0x2F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC7, 0x3F, 0xC9, 0x0F, 0xC9, 0x72, 0xFC, 0x90, 0xFC,
+    0x97, 0x2F, 0xC9, 0x0F, 0xCA, 0x72, 0xFC, 0x1A, 0xFC, 0x71, 0xAF, 0xC1, 0x9F, 0xC9, 0x70, 0xFC,
+    0xA2, 0xFD, 0x7A, 0xFC, 0x92, 0x9F, 0xDA, 0x39, 0xFE, 0x4F, 0xFF, 0xFD, 0x6F, 0xFF, 0xF9, 0x7A,
+    0xFF, 0xFC, 0x73, 0xAF, 0xFA, 0x97, 0x70, 0x99, 0x97, 0x10, 0x59, 0xAA, 0x93, 0x9A, 0x79, 0xFC,
+    0xA9, 0x9D, 0x7F, 0xFE, 0x69, 0xD2, 0xAF, 0x77, 0x76, 0xFC, 0x74, 0xFD, 0xA7, 0x2F, 0xAE, 0xA7,
+    0x0E, 0xA2, 0xEA, 0x69, 0xD9, 0x49, 0xD9, 0x77, 0x73, 0x99, 0xA9, 0x97, 0x29, 0xFF, 0xA7, 0xAF,
+    0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A, 0xFA, 0x4F, 0xC9, 0x1F, 0xC5, 0x9F,
+    0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F, 0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFC,
+    0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF, 0xC4, 0xFC, 0x92, 0xFD, 0xAA, 0xAF,
+    0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xE9, 0x74, 0x99, 0x97, 0x71, 0xAA, 0xAA, 0x97,
+    0x71, 0xFD, 0xA7, 0x7F, 0xF9, 0x75, 0xAF, 0x9F, 0x74, 0xAE, 0xA1, 0x9F, 0x72, 0x9E, 0x94, 0xAD,
+    0xA7, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xEA, 0x73, 0x9F, 0xFF, 0xA7, 0x0A, 0xFF, 0xFE, 0x6A, 0xFF,
+    0xFF, 0xC4, 0x9F, 0xDA, 0x92, 0x9F, 0xDA, 0x3F, 0xD9, 0x6F, 0xD2, 0x9F, 0xC9, 0x70, 0xFC, 0xA1,
+    0xAF, 0xC7, 0x1A, 0xFC, 0x1F, 0xCA, 0x71, 0x9F, 0xC1, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9, 0x72,
+    0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x73, 0xFC, 0x90, 0xFC, 0x97, 0x2F, 0xC9, 0x0F, 0xC9,
+    0x72, 0xFC, 0x90, 0xFC, 0xA7, 0x2F, 0xC1, 0xAF, 0xC7, 0x1A, 0xFC, 0x19, 0xFC, 0x97, 0x0F, 0xCA,
+    0x2F, 0xD7, 0xAF, 0xC9, 0x29, 0xFD, 0xA3, 0x9F, 0xE4, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0x97, 0xAF,
+    0xFF, 0xC7, 0x3A, 0xFF, 0xA9, 0x77, 0x09, 0x99, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x72, 0x9F, 0xA7,
+    0x71, 0xAF, 0xC7, 0x71, 0x9F, 0xA7, 0x72, 0xAE, 0x77, 0x77, 0x10, 0x6A, 0xAA, 0xAA, 0x74, 0xFD,
+    0xA7, 0x2A, 0xFE, 0xA7, 0x09, 0xF9, 0xF9, 0x69, 0xF2, 0xF9, 0x5E, 0xA4, 0xAE, 0x77, 0x74, 0x99,
+    0xA9, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xFF, 0xC9, 0x3F, 0xD9, 0x99, 0xFD, 0x2A,
+    0xFC, 0x4F, 0xC9, 0x1F, 0xC5, 0x9F, 0xC1, 0xFC, 0x6F, 0xC0, 0x9F, 0xC6, 0xFC, 0x09, 0xFA, 0x6F,
+    0xC0, 0x9F, 0xA6, 0xFC, 0x09, 0xFC, 0x6F, 0xC1, 0xFC, 0x6F, 0xC1, 0xFC, 0x94, 0xAF, 0xA1, 0xAF,
+    0xC4, 0xFC, 0x92, 0xFD, 0xAA, 0xAF, 0xD3, 0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0x70, 0xAF, 0xEA, 0x74,
+    0x99, 0x97, 0x77, 0x71, 0x9A, 0xCA, 0x76, 0xFC, 0x74, 0x9F, 0xC7, 0x49, 0xFC, 0x75, 0xAE, 0x97,
+    0x77, 0x10, 0x74, 0x9A, 0xAA, 0xA9, 0x77, 0x49, 0xFC, 0x77, 0x5F, 0xC7, 0x75, 0xFA, 0x77, 0x5F,
+    0xA7, 0x75, 0x9E, 0x97, 0x77, 0x74, 0x99, 0x99, 0x77, 0x6F, 0xC9, 0x69, 0xAF, 0xEA, 0x4F, 0xC5,
+    0x9F, 0xFF, 0xA2, 0xFC, 0x4A, 0xFF, 0xFE, 0x0A, 0xF9, 0x3A, 0xFF, 0xFF, 0xFC, 0xA3, 0x9F, 0xDA,
+    0x92, 0x9F, 0xFD, 0x4F, 0xD9, 0x6F, 0xEA, 0x49, 0xFC, 0x97, 0x0F, 0xCA, 0x5A, 0xFC, 0x71, 0xAF,
+    0xC5, 0xFC, 0xA7, 0x19, 0xFC, 0x5F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC7,
+    0x3F, 0xC9, 0x4F, 0xC7, 0x3F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0x97, 0x2F, 0xC9, 0x4F,
+    0xCA, 0x72, 0xFC, 0x5A, 0xFC, 0x71, 0xAF, 0xC5, 0x9F, 0xC9, 0x70, 0xFC, 0xA6, 0xFD, 0x7A, 0xFC,
+    0x96, 0x9F, 0xDA, 0x39, 0xFE, 0x70, 0xFF, 0xFF, 0xD7, 0x2F, 0xFF, 0xF9, 0x73, 0xAF, 0xFF, 0xC7,
+    0x7A, 0xFF, 0xA9, 0x77, 0x49, 0x99, 0x75, 0x71, 0x9A, 0xAA, 0xAA, 0x77, 0x0F, 0xC9, 0x77, 0xFC,
+    0x97, 0x7F, 0xC7, 0x70, 0xAE, 0xA7, 0x71, 0xE9, 0x59, 0xFA, 0x77, 0x09, 0xFA, 0x69, 0x9A, 0x99,
+    0x4A, 0xF9, 0x39, 0xFF, 0xA2, 0xFC, 0x3A, 0xFF, 0xEA, 0xFC, 0x92, 0xAF, 0xFF, 0xFC, 0xA3, 0xFD,
+    0xAA, 0xAF, 0xF9, 0x3A, 0xFC, 0x4F, 0xCA, 0x5F, 0xC9, 0x49, 0xFC, 0x5F, 0xC6, 0xFC, 0x49, 0xFC,
+    0x6F, 0xC4, 0x9F, 0xA6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x5F,
+    0xC9, 0x4A, 0xFC, 0x5A, 0xFC, 0x39, 0xFC, 0x96, 0xFE, 0xAF, 0xE7, 0x9F, 0xFF, 0xC7, 0x19, 0xFF,
+    0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09, 0x99, 0x73, 0x59, 0xAA, 0xAA, 0xA7, 0x76, 0xFC, 0xA7, 0x76,
+    0xFC, 0x97, 0x76, 0xAF, 0x77, 0x79, 0xF7, 0x77, 0x0A, 0xDA, 0x77, 0x77, 0x29, 0x99, 0x97, 0x76,
+    0xFC, 0x96, 0x9A, 0xFE, 0xA4, 0xFC, 0x59, 0xFF, 0xFA, 0x2F, 0xC4, 0xAF, 0xFF, 0xE0, 0xAF, 0x93,
+    0xAF, 0xFF, 0xFF, 0xCA, 0x39, 0xFD, 0xA9, 0x29, 0xFF, 0xD4, 0xFD, 0x96, 0xFE, 0xA4, 0x9F, 0xC9,
+    0x70, 0xFC, 0xA5, 0xAF, 0xC7, 0x1A, 0xFC, 0x5F, 0xCA, 0x71, 0x9F, 0xC5, 0xFC, 0x97, 0x2F, 0xC9,
+    0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x97, 0x2F,
+    0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0xA7, 0x2F, 0xC5, 0xAF, 0xC7, 0x1A, 0xFC, 0x59, 0xFC,
+    0x97, 0x0F, 0xCA, 0x6F, 0xD7, 0xAF, 0xC9, 0x69, 0xFD, 0xA3, 0x9F, 0xE7, 0x0F, 0xFF, 0xFD, 0x72,
+    0xFF, 0xFF, 0x97, 0x3A, 0xFF, 0xFC, 0x77, 0xAF, 0xFA, 0x97, 0x74, 0x99, 0x97, 0x50, 0x29, 0xAA,
+    0xAA, 0xA7, 0x71, 0xAF, 0xC7, 0x71, 0xAF, 0xA7, 0x71, 0x9F, 0x97, 0x71, 0x9F, 0x97, 0x72, 0xAD,
+    0xA3, 0x9F, 0xA7, 0x70, 0x9F, 0xA6, 0x99, 0xA9, 0x94, 0xAF, 0x93, 0x9F, 0xFA, 0x2F, 0xC3, 0xAF,
+    0xFE, 0xAF, 0xC9, 0x2A, 0xFF, 0xFF, 0xCA, 0x3F, 0xDA, 0xAA, 0xFF, 0x93, 0xAF, 0xC4, 0xFC, 0xA5,
+    0xFC, 0x94, 0x9F, 0xC5, 0xFC, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x49, 0xFA, 0x6F, 0xC4, 0x9F, 0xC6,
+    0xFC, 0x49, 0xFC, 0x6F, 0xC5, 0xFC, 0x6F, 0xC5, 0xFC, 0x94, 0xAF, 0xC5, 0xAF, 0xC3, 0x9F, 0xC9,
+    0x6F, 0xEA, 0xFE, 0x79, 0xFF, 0xFC, 0x71, 0x9F, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99, 0x97,
+    0x30, 0x70, 0x9A, 0xAA, 0x97, 0x75, 0x9F, 0xD9, 0x77, 0x39, 0xFE, 0x77, 0x69, 0xF7, 0x77, 0xF7,
+    0x75, 0x9A, 0xEA, 0x77, 0x5F, 0xA7, 0x76, 0xAD, 0x97, 0x77, 0x74, 0x99, 0x99, 0x77, 0x6F, 0xC9,
+    0x69, 0xAF, 0xEA, 0x4F, 0xC5, 0x9F, 0xFF, 0xA2, 0xFC, 0x4A, 0xFF, 0xFE, 0x0A, 0xF9, 0x3A, 0xFF,
+    0xFF, 0xFC, 0xA3, 0x9F, 0xDA, 0x92, 0x9F, 0xFD, 0x4F, 0xD9, 0x6F, 0xEA, 0x49, 0xFC, 0x97, 0x0F,
+    0xCA, 0x5A, 0xFC, 0x71, 0xAF, 0xC5, 0xFC, 0xA7, 0x19, 0xFC, 0x5F, 0xC9, 0x72, 0xFC, 0x94, 0xFC,
+    0x97, 0x2F, 0xC9, 0x4F, 0xC7, 0x3F, 0xC9, 0x4F, 0xC7, 0x3F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94,
+    0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xCA, 0x72, 0xFC, 0x5A, 0xFC, 0x71, 0xAF, 0xC5, 0x9F, 0xC9, 0x70,
+    0xFC, 0xA6, 0xFD, 0x7A, 0xFC, 0x96, 0x9F, 0xDA, 0x39, 0xFE, 0x70, 0xFF, 0xFF, 0xD7, 0x2F, 0xFF,
+    0xF9, 0x73, 0xAF, 0xFF, 0xC7, 0x7A, 0xFF, 0xA9, 0x77, 0x49, 0x99, 0x75, 0x59, 0xAA, 0xA9, 0x77,
+    0x1F, 0xD9, 0x77, 0xFE, 0x77, 0x91, 0xF9, 0x77, 0x1A, 0xE7, 0x71, 0xAF, 0x77, 0x0A, 0xEA, 0x77,
+    0x19, 0xD9, 0x59, 0xFA, 0x77, 0x09, 0xFA, 0x69, 0x9A, 0x99, 0x4A, 0xF9, 0x39, 0xFF, 0xA2, 0xFC,
+    0x3A, 0xFF, 0xEA, 0xFC, 0x92, 0xAF, 0xFF, 0xFC, 0xA3, 0xFD, 0xAA, 0xAF, 0xF9, 0x3A, 0xFC, 0x4F,
+    0xCA, 0x5F, 0xC9, 0x49, 0xFC, 0x5F, 0xC6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F, 0xA6, 0xFC, 0x49,
+    0xFC, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x5F, 0xC9, 0x4A, 0xFC, 0x5A, 0xFC, 0x39,
+    0xFC, 0x96, 0xFE, 0xAF, 0xE7, 0x9F, 0xFF, 0xC7, 0x19, 0xFF, 0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09,
+    0x99, 0x73, 0x77, 0x77, 0x29, 0xF9, 0x2A, 0xD7, 0x69, 0xFE, 0xAA, 0xE7, 0x6F, 0xFF, 0x97, 0x6E,
+    0x1A, 0xFC, 0xA7, 0x69, 0xD4, 0xAC, 0xA9, 0x77, 0x77, 0x19, 0x99, 0x97, 0x76, 0xFC, 0x96, 0x9A,
+    0xFE, 0xA4, 0xFC, 0x59, 0xFF, 0xFA, 0x2F, 0xC4, 0xAF, 0xFF, 0xE0, 0xAF, 0x93, 0xAF, 0xFF, 0xFF,
+    0xCA, 0x39, 0xFD, 0xA9, 0x29, 0xFF, 0xD4, 0xFD, 0x96, 0xFE, 0xA4, 0x9F, 0xC9, 0x70, 0xFC, 0xA5,
+    0xAF, 0xC7, 0x1A, 0xFC, 0x5F, 0xCA, 0x71, 0x9F, 0xC5, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9, 0x72,
+    0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9,
+    0x72, 0xFC, 0x94, 0xFC, 0xA7, 0x2F, 0xC5, 0xAF, 0xC7, 0x1A, 0xFC, 0x59, 0xFC, 0x97, 0x0F, 0xCA,
+    0x6F, 0xD7, 0xAF, 0xC9, 0x69, 0xFD, 0xA3, 0x9F, 0xE7, 0x0F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0x97,
+    0x3A, 0xFF, 0xFC, 0x77, 0xAF, 0xFA, 0x97, 0x74, 0x99, 0x97, 0x50, 0x77, 0x73, 0xFA, 0x29, 0xD9,
+    0x71, 0xFE, 0xAA, 0xE7, 0x1A, 0xFF, 0xEA, 0x71, 0xE1, 0xAF, 0xD7, 0x2D, 0x93, 0x9C, 0xA9, 0x29,
+    0xFA, 0x77, 0x09, 0xFA, 0x69, 0x9A, 0x99, 0x4A, 0xF9, 0x39, 0xFF, 0xA2, 0xFC, 0x3A, 0xFF, 0xEA,
+    0xFC, 0x92, 0xAF, 0xFF, 0xFC, 0xA3, 0xFD, 0xAA, 0xAF, 0xF9, 0x3A, 0xFC, 0x4F, 0xCA, 0x5F, 0xC9,
+    0x49, 0xFC, 0x5F, 0xC6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F, 0xA6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4,
+    0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x5F, 0xC9, 0x4A, 0xFC, 0x5A, 0xFC, 0x39, 0xFC, 0x96, 0xFE,
+    0xAF, 0xE7, 0x9F, 0xFF, 0xC7, 0x19, 0xFF, 0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09, 0x99, 0x73, 0x77,
+    0x69, 0x99, 0x97, 0x76, 0xFC, 0x96, 0x9A, 0xFE, 0xA4, 0xFC, 0x59, 0xFF, 0xFA, 0x2F, 0xC4, 0xAF,
+    0xFF, 0xE0, 0xAF, 0x93, 0xAF, 0xFF, 0xFF, 0xCA, 0x39, 0xFD, 0xA9, 0x29, 0xFF, 0xD4, 0xFD, 0x96,
+    0xFE, 0xA4, 0x9F, 0xC9, 0x70, 0xFC, 0xA5, 0xAF, 0xC7, 0x1A, 0xFC, 0x5F, 0xCA, 0x71, 0x9F, 0xC5,
+    0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0x73, 0xFC, 0x94, 0xFC, 0x73, 0xFC,
+    0x94, 0xFC, 0x97, 0x2F, 0xC9, 0x4F, 0xC9, 0x72, 0xFC, 0x94, 0xFC, 0xA7, 0x2F, 0xC5, 0xAF, 0xC7,
+    0x1A, 0xFC, 0x59, 0xFC, 0x97, 0x0F, 0xCA, 0x6F, 0xD7, 0xAF, 0xC9, 0x69, 0xFD, 0xA3, 0x9F, 0xE7,
+    0x0F, 0xFF, 0xFD, 0x72, 0xFF, 0xFF, 0x97, 0x3A, 0xFF, 0xFC, 0x77, 0xAF, 0xFA, 0x97, 0x74, 0x99,
+    0x97, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x76, 0x9F, 0xA7, 0x75, 0xAF, 0xC7, 0x75, 0x9F, 0xC7, 0x76,
+    0xAE, 0x77, 0x77, 0x71, 0x77, 0x09, 0xFA, 0x77, 0x09, 0xFA, 0x69, 0x9A, 0x99, 0x4A, 0xF9, 0x39,
+    0xFF, 0xA2, 0xFC, 0x3A, 0xFF, 0xEA, 0xFC, 0x92, 0xAF, 0xFF, 0xFC, 0xA3, 0xFD, 0xAA, 0xAF, 0xF9,
+    0x3A, 0xFC, 0x4F, 0xCA, 0x5F, 0xC9, 0x49, 0xFC, 0x5F, 0xC6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F,
+    0xA6, 0xFC, 0x49, 0xFC, 0x6F, 0xC4, 0x9F, 0xC6, 0xFC, 0x5F, 0xC6, 0xFC, 0x5F, 0xC9, 0x4A, 0xFC,
+    0x5A, 0xFC, 0x39, 0xFC, 0x96, 0xFE, 0xAF, 0xE7, 0x9F, 0xFF, 0xC7, 0x19, 0xFF, 0xE9, 0x73, 0xAF,
+    0xEA, 0x77, 0x09, 0x99, 0x77, 0x77, 0x71, 0x9A, 0xCA, 0x77, 0x2F, 0xC7, 0x70, 0x9F, 0xC7, 0x71,
+    0xFC, 0x77, 0x19, 0xE9, 0x77, 0x77, 0x10, 0x0F, 0xA7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F, 0xC7, 0x0F, 0xC9, 0x0F, 0xC9, 0x7F, 0xC1, 0xFC,
+    0xA6, 0xAF, 0xC1, 0x9F, 0xCA, 0x4A, 0xFC, 0xA2, 0xFF, 0xFF, 0xC4, 0xFF, 0xFE, 0x95, 0xFF, 0xFC,
+    0x70, 0x9F, 0xFC, 0x97, 0x59, 0x99, 0x77, 0x77, 0x5A, 0xCA, 0x97, 0x7F, 0xC7, 0x7F, 0xC9, 0x76,
+    0xFC, 0x77, 0x9E, 0x97, 0x77, 0x50, 0x77, 0x1A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9,
+    0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0,
+    0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95,
+    0xFC, 0x0A, 0xFA, 0x4A, 0xFC, 0x0A, 0xFC, 0x92, 0x9F, 0xD0, 0x9F, 0xEA, 0xFF, 0x1F, 0xFF, 0xF2,
+    0xFF, 0xCA, 0x0F, 0x3A, 0xFD, 0x91, 0xF6, 0x99, 0x77, 0x77, 0x19, 0xAC, 0xA7, 0x5F, 0xC7, 0x39,
+    0xFC, 0x74, 0xFC, 0x74, 0x9E, 0x97, 0x77, 0x00, 0x77, 0x72, 0xAF, 0xC9, 0x75, 0xAF, 0xD9, 0x74,
+    0x9A, 0xAF, 0xA7, 0x70, 0xF7, 0x79, 0xEA, 0x76, 0xFC, 0x77, 0xE9, 0x77, 0x0A, 0xAA, 0x77, 0x77,
+    0xFA, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90,
+    0xFC, 0x70, 0xFC, 0x90, 0xFC, 0x97, 0xFC, 0x1F, 0xCA, 0x6A, 0xFC, 0x19, 0xFC, 0xA4, 0xAF, 0xCA,
+    0x2F, 0xFF, 0xFC, 0x4F, 0xFF, 0xE9, 0x5F, 0xFF, 0xC7, 0x09, 0xFF, 0xC9, 0x75, 0x99, 0x97, 0x00,
+    0x5A, 0xAA, 0xA9, 0x73, 0xAF, 0xD7, 0x2A, 0xFD, 0xA7, 0x49, 0xF7, 0x5F, 0x73, 0x9F, 0x97, 0x3F,
+    0x97, 0x4E, 0x77, 0x77, 0x73, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A,
+    0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F,
+    0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF, 0x95, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0xAF,
+    0xA4, 0xAF, 0xC0, 0xAF, 0xC9, 0x29, 0xFD, 0x09, 0xFE, 0xAF, 0xF1, 0xFF, 0xFF, 0x2F, 0xFC, 0xA0,
+    0xF3, 0xAF, 0xD9, 0x1F, 0x69, 0x97, 0x10, 0x72, 0x9A, 0xAA, 0xAA, 0x77, 0x49, 0xFC, 0x97, 0x74,
+    0xFC, 0x97, 0x74, 0xFC, 0x77, 0x5A, 0xEA, 0x77, 0x59, 0xE9, 0x77, 0x77, 0x69, 0x99, 0x97, 0x76,
+    0x9F, 0xA0, 0xFA, 0x70, 0xAF, 0x90, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x1F, 0xC7, 0x0A,
+    0xF9, 0xAF, 0xA1, 0xFC, 0x70, 0xAF, 0xFD, 0x2F, 0xC7, 0x0A, 0xFF, 0xC3, 0xFC, 0x70, 0xAF, 0xE9,
+    0x4F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9,
+    0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9,
+    0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC9, 0x7F, 0xC7, 0x0F, 0xC7,
+    0x0F, 0xCA, 0x6A, 0xFC, 0x70, 0x9F, 0xCA, 0x4A, 0xFC, 0xA7, 0x1F, 0xFF, 0xFC, 0x73, 0xFF, 0xFE,
+    0x97, 0x4F, 0xFF, 0xC7, 0x79, 0xFF, 0xC9, 0x77, 0x49, 0x99, 0x77, 0x71, 0xAA, 0xAA, 0xA7, 0x72,
+    0xFC, 0xA7, 0x71, 0xAF, 0xA7, 0x71, 0x9F, 0x97, 0x71, 0x9F, 0x77, 0x3E, 0xA7, 0x0A, 0xF9, 0x77,
+    0x2F, 0xC7, 0x73, 0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0x9F, 0xA0, 0xAF, 0x95, 0xFC, 0x9F, 0xC1, 0xAF,
+    0x95, 0xFF, 0xD9, 0x1A, 0xF9, 0x5F, 0xFC, 0x92, 0xAF, 0x95, 0xFD, 0xA9, 0x4A, 0xF9, 0x5F, 0xC7,
+    0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95,
+    0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0xA4, 0xAF, 0xC7, 0xAF, 0xC9, 0x29, 0xFD, 0x79, 0xFE, 0xAF,
+    0xF7, 0x0F, 0xFF, 0xF7, 0x1F, 0xFC, 0xA0, 0xF7, 0x2A, 0xFD, 0x91, 0xF7, 0x59, 0x97, 0x70, 0x39,
+    0xAA, 0xAA, 0xA7, 0x76, 0xFC, 0xA7, 0x76, 0xFC, 0x97, 0x76, 0xAF, 0x77, 0x79, 0xF7, 0x77, 0x0E,
+    0xA7, 0x77, 0x74, 0x99, 0x99, 0x77, 0x69, 0xFA, 0x0F, 0xA7, 0x0A, 0xF9, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x0A, 0xF9, 0x0F, 0xC1, 0xFC, 0x70, 0xAF, 0x9A, 0xFA, 0x1F, 0xC7, 0x0A, 0xFF, 0xD2, 0xFC, 0x70,
+    0xAF, 0xFC, 0x3F, 0xC7, 0x0A, 0xFE, 0x94, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC,
+    0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC,
+    0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC,
+    0x70, 0xFC, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0xFC, 0xA6, 0xAF, 0xC7, 0x09, 0xFC, 0xA4, 0xAF, 0xCA,
+    0x71, 0xFF, 0xFF, 0xC7, 0x3F, 0xFF, 0xE9, 0x74, 0xFF, 0xFC, 0x77, 0x9F, 0xFC, 0x97, 0x74, 0x99,
+    0x97, 0x70, 0x2A, 0xAA, 0xAA, 0x97, 0x72, 0x9F, 0xC7, 0x73, 0x9F, 0xC7, 0x74, 0xFA, 0x77, 0x4A,
+    0xEA, 0x77, 0x49, 0xE6, 0xAF, 0x97, 0x72, 0xFC, 0x77, 0x3F, 0xC0, 0xAF, 0x95, 0xFC, 0x09, 0xFA,
+    0x0A, 0xF9, 0x5F, 0xC9, 0xFC, 0x1A, 0xF9, 0x5F, 0xFD, 0x91, 0xAF, 0x95, 0xFF, 0xC9, 0x2A, 0xF9,
+    0x5F, 0xDA, 0x94, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F,
+    0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xFA, 0x4A, 0xFC, 0x7A,
+    0xFC, 0x92, 0x9F, 0xD7, 0x9F, 0xEA, 0xFF, 0x70, 0xFF, 0xFF, 0x71, 0xFF, 0xCA, 0x0F, 0x72, 0xAF,
+    0xD9, 0x1F, 0x75, 0x99, 0x77, 0x00, 0x77, 0x77, 0x19, 0xFC, 0x97, 0x74, 0xAF, 0xD9, 0x77, 0x39,
+    0xAA, 0xFC, 0x77, 0x7F, 0x77, 0x69, 0xEA, 0x77, 0x5F, 0xC7, 0x76, 0xE9, 0x77, 0x7A, 0xAA, 0x73,
+    0x99, 0x99, 0x77, 0x69, 0xFA, 0x0F, 0xA7, 0x0A, 0xF9, 0x0A, 0xF9, 0x0F, 0xC7, 0x0A, 0xF9, 0x0F,
+    0xC1, 0xFC, 0x70, 0xAF, 0x9A, 0xFA, 0x1F, 0xC7, 0x0A, 0xFF, 0xD2, 0xFC, 0x70, 0xAF, 0xFC, 0x3F,
+    0xC7, 0x0A, 0xFE, 0x94, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97,
+    0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97,
+    0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xAF, 0x97, 0xFC, 0x70, 0xFC, 0x97,
+    0xFC, 0x70, 0xFC, 0x70, 0xFC, 0xA6, 0xAF, 0xC7, 0x09, 0xFC, 0xA4, 0xAF, 0xCA, 0x71, 0xFF, 0xFF,
+    0xC7, 0x3F, 0xFF, 0xE9, 0x74, 0xFF, 0xFC, 0x77, 0x9F, 0xFC, 0x97, 0x74, 0x99, 0x97, 0x70, 0x59,
+    0xAA, 0xA9, 0x77, 0x29, 0xFD, 0x77, 0x19, 0xFD, 0xA7, 0x73, 0x9F, 0x77, 0x4F, 0x77, 0x29, 0xAE,
+    0x97, 0x72, 0xF9, 0x77, 0x3E, 0x70, 0xAF, 0x97, 0x72, 0xFC, 0x77, 0x3F, 0xC0, 0xAF, 0x95, 0xFC,
+    0x09, 0xFA, 0x0A, 0xF9, 0x5F, 0xC9, 0xFC, 0x1A, 0xF9, 0x5F, 0xFD, 0x91, 0xAF, 0x95, 0xFF, 0xC9,
+    0x2A, 0xF9, 0x5F, 0xDA, 0x94, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A,
+    0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xFA, 0x4A,
+    0xFC, 0x7A, 0xFC, 0x92, 0x9F, 0xD7, 0x9F, 0xEA, 0xFF, 0x70, 0xFF, 0xFF, 0x71, 0xFF, 0xCA, 0x0F,
+    0x72, 0xAF, 0xD9, 0x1F, 0x75, 0x99, 0x77, 0x00, 0x77, 0x77, 0x1F, 0xA2, 0x9D, 0x77, 0xFE, 0xAA,
+    0xE7, 0x6A, 0xFF, 0xEA, 0x76, 0xE1, 0xAF, 0xD7, 0x7D, 0x93, 0x9C, 0xA9, 0x77, 0x77, 0x39, 0x99,
+    0x97, 0x76, 0x9F, 0xA0, 0xFA, 0x70, 0xAF, 0x90, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x1F,
+    0xC7, 0x0A, 0xF9, 0xAF, 0xA1, 0xFC, 0x70, 0xAF, 0xFD, 0x2F, 0xC7, 0x0A, 0xFF, 0xC3, 0xFC, 0x70,
+    0xAF, 0xE9, 0x4F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7,
+    0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7,
+    0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC9, 0x7F, 0xC7,
+    0x0F, 0xC7, 0x0F, 0xCA, 0x6A, 0xFC, 0x70, 0x9F, 0xCA, 0x4A, 0xFC, 0xA7, 0x1F, 0xFF, 0xFC, 0x73,
+    0xFF, 0xFE, 0x97, 0x4F, 0xFF, 0xC7, 0x79, 0xFF, 0xC9, 0x77, 0x49, 0x99, 0x77, 0x77, 0x74, 0xAE,
+    0xA3, 0xDA, 0x73, 0xAF, 0xDA, 0xAE, 0x97, 0x29, 0xFF, 0xF7, 0x3A, 0xD9, 0x09, 0xFD, 0x97, 0x3A,
+    0xCA, 0x39, 0xAC, 0xA5, 0xAF, 0x97, 0x72, 0xFC, 0x77, 0x3F, 0xC0, 0xAF, 0x95, 0xFC, 0x09, 0xFA,
+    0x0A, 0xF9, 0x5F, 0xC9, 0xFC, 0x1A, 0xF9, 0x5F, 0xFD, 0x91, 0xAF, 0x95, 0xFF, 0xC9, 0x2A, 0xF9,
+    0x5F, 0xDA, 0x94, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F,
+    0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xFA, 0x4A, 0xFC, 0x7A,
+    0xFC, 0x92, 0x9F, 0xD7, 0x9F, 0xEA, 0xFF, 0x70, 0xFF, 0xFF, 0x71, 0xFF, 0xCA, 0x0F, 0x72, 0xAF,
+    0xD9, 0x1F, 0x75, 0x99, 0x77, 0x00, 0x77, 0x69, 0x99, 0x97, 0x76, 0x9F, 0xA0, 0xFA, 0x70, 0xAF,
+    0x90, 0xAF, 0x90, 0xFC, 0x70, 0xAF, 0x90, 0xFC, 0x1F, 0xC7, 0x0A, 0xF9, 0xAF, 0xA1, 0xFC, 0x70,
+    0xAF, 0xFD, 0x2F, 0xC7, 0x0A, 0xFF, 0xC3, 0xFC, 0x70, 0xAF, 0xE9, 0x4F, 0xC7, 0x0A, 0xF9, 0x7F,
+    0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F,
+    0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0A, 0xF9, 0x7F,
+    0xC7, 0x0A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0F, 0xCA, 0x6A, 0xFC, 0x70,
+    0x9F, 0xCA, 0x4A, 0xFC, 0xA7, 0x1F, 0xFF, 0xFC, 0x73, 0xFF, 0xFE, 0x97, 0x4F, 0xFF, 0xC7, 0x79,
+    0xFF, 0xC9, 0x77, 0x49, 0x99, 0x77, 0x77, 0x77, 0x3A, 0xCA, 0x97, 0x76, 0xFC, 0x77, 0x6F, 0xC9,
+    0x77, 0x5F, 0xC7, 0x76, 0x9E, 0x97, 0x77, 0x77, 0x30, 0x77, 0x2A, 0xF9, 0x77, 0x2F, 0xC7, 0x73,
+    0xFC, 0x0A, 0xF9, 0x5F, 0xC0, 0x9F, 0xA0, 0xAF, 0x95, 0xFC, 0x9F, 0xC1, 0xAF, 0x95, 0xFF, 0xD9,
+    0x1A, 0xF9, 0x5F, 0xFC, 0x92, 0xAF, 0x95, 0xFD, 0xA9, 0x4A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC,
+    0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9, 0x5F, 0xC7, 0xAF, 0x95, 0xFC, 0x7A, 0xF9,
+    0x5F, 0xC7, 0xAF, 0xA4, 0xAF, 0xC7, 0xAF, 0xC9, 0x29, 0xFD, 0x79, 0xFE, 0xAF, 0xF7, 0x0F, 0xFF,
+    0xF7, 0x1F, 0xFC, 0xA0, 0xF7, 0x2A, 0xFD, 0x91, 0xF7, 0x59, 0x97, 0x77, 0x77, 0x79, 0xAC, 0xA7,
+    0x74, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x3F, 0xC7, 0x73, 0x9E, 0x97, 0x77, 0x76, 0x49, 0xAA, 0xAA,
+    0xA7, 0x7F, 0xCA, 0x77, 0xAF, 0x97, 0x7A, 0xF9, 0x77, 0x9F, 0x77, 0x1A, 0xDA, 0x77, 0x77, 0x77,
+    0xAF, 0xA7, 0x0A, 0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC, 0xA2, 0xFC, 0x59, 0xFC, 0x3A,
+    0xFA, 0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96, 0xFC, 0x19, 0xFC, 0x7A, 0xFA,
+    0x0A, 0xF9, 0x70, 0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF, 0xC7, 0x39, 0xFE, 0x75, 0xFD,
+    0xA7, 0x59, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77,
+    0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x70, 0x39, 0xAA, 0xAA, 0xA7, 0x6F, 0xD7, 0x6A, 0xFA, 0x76, 0xAF,
+    0x97, 0x69, 0xF7, 0x70, 0xAD, 0xA7, 0x77, 0x77, 0x5A, 0xFA, 0x69, 0xFC, 0x09, 0xFC, 0x6A, 0xF9,
+    0x1F, 0xC6, 0xFC, 0x2A, 0xFA, 0x49, 0xFA, 0x3F, 0xC4, 0xAF, 0x93, 0xAF, 0x4F, 0xC4, 0x9F, 0xA2,
+    0x9F, 0xA5, 0xFC, 0x2A, 0xF6, 0xAF, 0x2F, 0xC7, 0xFA, 0x09, 0xF9, 0x7A, 0xF0, 0xAF, 0x70, 0x9F,
+    0x0F, 0xA7, 0x1F, 0xAF, 0x97, 0x1A, 0xFF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0x9F, 0xD7, 0x5F,
+    0xC9, 0x75, 0xFC, 0x75, 0x9F, 0xA7, 0x5F, 0xC7, 0x49, 0xFD, 0x71, 0xFF, 0xC7, 0x2F, 0xFA, 0x72,
+    0xFE, 0x97, 0x3A, 0xFA, 0x74, 0xAF, 0xA7, 0x0A, 0xFA, 0x9F, 0xC7, 0x9F, 0xC1, 0xFC, 0xA6, 0xFC,
+    0xA2, 0xFC, 0x59, 0xFC, 0x3A, 0xFA, 0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC5, 0xAF, 0xA2, 0xFC, 0x96,
+    0xFC, 0x19, 0xFC, 0x7A, 0xFA, 0x0A, 0xF9, 0x70, 0xFC, 0x9F, 0xC7, 0x19, 0xFF, 0xC9, 0x72, 0xFF,
+    0xC7, 0x39, 0xFE, 0x75, 0xFD, 0xA7, 0x59, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC,
+    0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xCA,
+    0x77, 0x0F, 0xC7, 0x69, 0xFC, 0x77, 0xFC, 0x77, 0xAE, 0x97, 0x77, 0x40, 0x77, 0x3A, 0xFA, 0x69,
+    0xFC, 0x09, 0xFC, 0x6A, 0xF9, 0x1F, 0xC6, 0xFC, 0x2A, 0xFA, 0x49, 0xFA, 0x3F, 0xC4, 0xAF, 0x93,
+    0xAF, 0x4F, 0xC4, 0x9F, 0xA2, 0x9F, 0xA5, 0xFC, 0x2A, 0xF6, 0xAF, 0x2F, 0xC7, 0xFA, 0x09, 0xF9,
+    0x7A, 0xF0, 0xAF, 0x70, 0x9F, 0x0F, 0xA7, 0x1F, 0xAF, 0x97, 0x1A, 0xFF, 0x73, 0xFE, 0xA7, 0x3A,
+    0xFD, 0x74, 0x9F, 0xD7, 0x5F, 0xC9, 0x75, 0xFC, 0x75, 0x9F, 0xA7, 0x5F, 0xC2, 0xAC, 0xA6, 0x9F,
+    0xD1, 0xFC, 0x2F, 0xFC, 0x2F, 0xC2, 0xFF, 0xA2, 0xFC, 0x2F, 0xE9, 0x39, 0xE9, 0x2A, 0xFA, 0x74,
+    0x77, 0x73, 0xFC, 0xA7, 0x6F, 0xE7, 0x5A, 0xAA, 0xF9, 0x77, 0x9E, 0x97, 0x7A, 0xE9, 0x75, 0x9F,
+    0xA7, 0x69, 0xE7, 0x71, 0xAA, 0x97, 0x77, 0x5A, 0xFA, 0x70, 0xAF, 0xA9, 0xFC, 0x79, 0xFC, 0x1F,
+    0xCA, 0x6F, 0xCA, 0x2F, 0xC5, 0x9F, 0xC3, 0xAF, 0xA4, 0xFC, 0xA4, 0xFC, 0x39, 0xFC, 0x5A, 0xFA,
+    0x2F, 0xC9, 0x6F, 0xC1, 0x9F, 0xC7, 0xAF, 0xA0, 0xAF, 0x97, 0x0F, 0xC9, 0xFC, 0x71, 0x9F, 0xFC,
+    0x97, 0x2F, 0xFC, 0x73, 0x9F, 0xE7, 0x5F, 0xDA, 0x75, 0x9F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F,
+    0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x59, 0xAA, 0xAA,
+    0x97, 0x5F, 0xDA, 0x74, 0xFE, 0x97, 0x39, 0x1A, 0xEA, 0x76, 0x9E, 0xA7, 0x59, 0xF7, 0x59, 0xF7,
+    0x7E, 0x77, 0x77, 0x77, 0x0A, 0xFA, 0x69, 0xFC, 0x09, 0xFC, 0x6A, 0xF9, 0x1F, 0xC6, 0xFC, 0x2A,
+    0xFA, 0x49, 0xFA, 0x3F, 0xC4, 0xAF, 0x93, 0xAF, 0x4F, 0xC4, 0x9F, 0xA2, 0x9F, 0xA5, 0xFC, 0x2A,
+    0xF6, 0xAF, 0x2F, 0xC7, 0xFA, 0x09, 0xF9, 0x7A, 0xF0, 0xAF, 0x70, 0x9F, 0x0F, 0xA7, 0x1F, 0xAF,
+    0x97, 0x1A, 0xFF, 0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0x9F, 0xD7, 0x5F, 0xC9, 0x75, 0xFC, 0x75,
+    0x9F, 0xA7, 0x5F, 0xC7, 0x49, 0xFD, 0x71, 0xFF, 0xC7, 0x2F, 0xFA, 0x72, 0xFE, 0x97, 0x3A, 0xFA,
+    0x74, 0x77, 0x72, 0xFA, 0x29, 0xD7, 0x0F, 0xEA, 0xAE, 0x7A, 0xFF, 0xEA, 0x7E, 0x1A, 0xFD, 0x70,
+    0xD9, 0x39, 0xCA, 0x97, 0x77, 0x77, 0x7A, 0xFA, 0x70, 0xAF, 0xA9, 0xFC, 0x79, 0xFC, 0x1F, 0xCA,
+    0x6F, 0xCA, 0x2F, 0xC5, 0x9F, 0xC3, 0xAF, 0xA4, 0xFC, 0xA4, 0xFC, 0x39, 0xFC, 0x5A, 0xFA, 0x2F,
+    0xC9, 0x6F, 0xC1, 0x9F, 0xC7, 0xAF, 0xA0, 0xAF, 0x97, 0x0F, 0xC9, 0xFC, 0x71, 0x9F, 0xFC, 0x97,
+    0x2F, 0xFC, 0x73, 0x9F, 0xE7, 0x5F, 0xDA, 0x75, 0x9F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x77, 0x70, 0xFA, 0x29,
+    0xD9, 0x6F, 0xEA, 0xAE, 0x6A, 0xFF, 0xEA, 0x6E, 0x90, 0xAF, 0xD7, 0xD9, 0x39, 0xAC, 0x97, 0x77,
+    0x77, 0x5A, 0xFA, 0x69, 0xFC, 0x09, 0xFC, 0x6A, 0xF9, 0x1F, 0xC6, 0xFC, 0x2A, 0xFA, 0x49, 0xFA,
+    0x3F, 0xC4, 0xAF, 0x93, 0xAF, 0x4F, 0xC4, 0x9F, 0xA2, 0x9F, 0xA5, 0xFC, 0x2A, 0xF6, 0xAF, 0x2F,
+    0xC7, 0xFA, 0x09, 0xF9, 0x7A, 0xF0, 0xAF, 0x70, 0x9F, 0x0F, 0xA7, 0x1F, 0xAF, 0x97, 0x1A, 0xFF,
+    0x73, 0xFE, 0xA7, 0x3A, 0xFD, 0x74, 0x9F, 0xD7, 0x5F, 0xC9, 0x75, 0xFC, 0x75, 0x9F, 0xA7, 0x5F,
+    0xC7, 0x49, 0xFD, 0x71, 0xFF, 0xC7, 0x2F, 0xFA, 0x72, 0xFE, 0x97, 0x3A, 0xFA, 0x74, 0x3C, 0x7D,
+    0x7D, 0x1A, 0xFE, 0x0A, 0xC2, 0xD1, 0xAA, 0x1A, 0xC2, 0xAA, 0x1C, 0x3A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x3C, 0x6C, 0xA5, 0xD5, 0xFE,
+    0xA1, 0xCA, 0x2C, 0xA2, 0xCA, 0x1A, 0xA3, 0xC1, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F,
+    0xFA, 0x71, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x0F, 0xFA, 0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0x77, 0x00, 0xAF, 0xFF, 0xC9,
+    0xAF, 0xFF, 0xC9, 0xAF, 0xFF, 0xC9, 0xAF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xD0, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0xAF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x74, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39,
+    0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9,
+    0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA,
+    0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39,
+    0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9,
+    0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA,
+    0x39, 0xE9, 0xAA, 0xA9, 0x4A, 0xAA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF,
+    0xD0, 0xFF, 0xFD, 0x77, 0x76, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xD0, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x2A, 0xDA, 0x19, 0xEA, 0x1A, 0xE9, 0x1F, 0x19, 0xF1, 0xFA,
+    0x1F, 0xA0, 0x9F, 0x91, 0x99, 0x99, 0x10, 0x1F, 0xA1, 0xFA, 0x09, 0xF9, 0x0A, 0xF1, 0xFA, 0x1F,
+    0x2F, 0x19, 0xE9, 0x29, 0x99, 0x20, 0x19, 0xF2, 0xAF, 0x2F, 0xA2, 0xF9, 0x19, 0xF2, 0xAE, 0xA2,
+    0xAE, 0x3F, 0x39, 0x99, 0x30, 0x9F, 0x19, 0xF9, 0x1F, 0xA1, 0xAF, 0x19, 0xF2, 0xF2, 0xAE, 0x92,
+    0xEA, 0x29, 0x99, 0x90, 0x2A, 0xDA, 0x29, 0xE9, 0x19, 0xEA, 0x2A, 0xE2, 0xAE, 0x92, 0xF2, 0xF2,
+    0xAE, 0xA1, 0x9F, 0x2F, 0x91, 0xFA, 0x2F, 0x91, 0xFA, 0x1A, 0xF1, 0x9F, 0x91, 0xFC, 0x29, 0x99,
+    0x92, 0x99, 0x99, 0x91, 0x1F, 0xA1, 0x9F, 0x91, 0xFA, 0x1A, 0xF1, 0x9F, 0x91, 0xFC, 0x1A, 0xF2,
+    0xFA, 0x1F, 0xA2, 0xF2, 0xF2, 0x9F, 0x2F, 0x2A, 0xE9, 0x19, 0xE9, 0x2F, 0x39, 0x99, 0x39, 0x99,
+    0x30, 0x09, 0xF9, 0x1A, 0xF1, 0xAF, 0x2F, 0xC1, 0xAF, 0x2F, 0x91, 0xFA, 0x19, 0xF2, 0xF2, 0xAF,
+    0x19, 0xF2, 0xAE, 0x91, 0xAE, 0x92, 0xF2, 0xF3, 0xEA, 0x29, 0x99, 0x93, 0x99, 0x93, 0x9F, 0x2A,
+    0xEA, 0x19, 0xF9, 0x1A, 0xF2, 0xFA, 0x19, 0xF2, 0xAF, 0x2F, 0x91, 0x9F, 0x2A, 0xEA, 0x2F, 0x29,
+    0xF2, 0xAE, 0x92, 0xF3, 0xEA, 0x2A, 0xE3, 0x99, 0x99, 0x39, 0x99, 0x00, 0x49, 0x99, 0x97, 0x2F,
+    0xA7, 0x1A, 0xE9, 0x71, 0xAE, 0x97, 0x19, 0xE7, 0x29, 0xE7, 0x3E, 0x6E, 0xAA, 0xEA, 0xAE, 0x1F,
+    0xFF, 0xC1, 0xFF, 0xFC, 0x1D, 0xAA, 0xAE, 0xAA, 0xAD, 0x6E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x29,
+    0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x2A, 0xE9, 0x71, 0xAE, 0x97, 0x1A, 0xE9, 0x71, 0xAE,
+    0x97, 0x1F, 0xA7, 0x1F, 0xA7, 0x1F, 0xA4, 0x59, 0x99, 0x97, 0x1A, 0xF7, 0x19, 0xEA, 0x72, 0xEA,
+    0x72, 0xE9, 0x72, 0xE6, 0xAA, 0x99, 0x9E, 0x99, 0x9A, 0xA9, 0x0F, 0xFF, 0xC9, 0x0F, 0xFF, 0xC9,
+    0x0F, 0xFF, 0xC9, 0x5E, 0x73, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x72, 0xEA, 0x72, 0xE9, 0x5A,
+    0x99, 0x90, 0xE9, 0x09, 0x9A, 0x90, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x90, 0xFF, 0xFC, 0x90, 0x93,
+    0xE3, 0x96, 0xE9, 0x72, 0xE9, 0x71, 0x9E, 0xA7, 0x19, 0xEA, 0x71, 0xAF, 0x40, 0x39, 0x95, 0xAF,
+    0xC2, 0xAF, 0xE1, 0xFF, 0xA9, 0xFF, 0xC9, 0xFF, 0xC9, 0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0x90, 0x9F,
+    0xE3, 0xAE, 0xA1, 0x74, 0xCA, 0x71, 0xE9, 0x7F, 0xC6, 0xFD, 0xA4, 0xFF, 0x92, 0xFF, 0xCA, 0x1F,
+    0xFA, 0x2F, 0xE4, 0xFC, 0x95, 0xEA, 0x7D, 0x71, 0x97, 0x10, 0x7A, 0xE9, 0x09, 0xFC, 0x0A, 0xFC,
+    0x09, 0xFC, 0x1F, 0xA2, 0x99, 0x20, 0x77, 0x19, 0xEA, 0x49, 0xE9, 0x1F, 0xC9, 0x3F, 0xC1, 0xFC,
+    0xA2, 0x9F, 0xC9, 0x0F, 0xC9, 0x29, 0xFC, 0x90, 0xAF, 0x4A, 0xF3, 0x99, 0x69, 0x99, 0x10, 0x77,
+    0x72, 0x9E, 0xA4, 0xAE, 0x93, 0x9E, 0xA1, 0xFC, 0x92, 0xAF, 0xC3, 0xFC, 0x90, 0xFC, 0xA2, 0xAF,
+    0xC3, 0xFC, 0xA0, 0xFC, 0x92, 0xAF, 0xC3, 0xFC, 0x90, 0xAF, 0x4F, 0x93, 0xAF, 0x39, 0x96, 0x99,
+    0x79, 0x91, 0x79, 0xEA, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F, 0xC9, 0x0A, 0xF3, 0x99, 0x10, 0x70, 0xAF,
+    0xE0, 0xAC, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x71, 0xFE, 0xA6, 0xCA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x59, 0x92, 0xFF, 0xCA, 0x99, 0x99, 0x99, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0xA5, 0xFF, 0x2A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xFF,
+    0x99, 0x99, 0x99, 0xAC, 0x59, 0xC5, 0x9C, 0x59, 0xC5, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x77, 0x77, 0x73, 0xFC, 0x97,
+    0x0A, 0xE9, 0x77, 0x29, 0xFE, 0x97, 0xF7, 0x73, 0xFF, 0xC6, 0xAE, 0x97, 0x72, 0x9F, 0x0A, 0xEA,
+    0x5E, 0xA7, 0x73, 0xAE, 0x91, 0xF4, 0xF7, 0x74, 0xF2, 0xAE, 0x39, 0xEA, 0x77, 0x4F, 0x2A, 0xE9,
+    0x2F, 0x77, 0x5F, 0x2A, 0xE9, 0x19, 0xEA, 0x77, 0x5F, 0x2A, 0xE9, 0x1F, 0x77, 0x6F, 0x2F, 0x1A,
+    0xE9, 0x19, 0xAA, 0xA7, 0x09, 0xAA, 0x93, 0xAE, 0x91, 0xF1, 0xF1, 0xFD, 0xA4, 0x9F, 0xD9, 0x2F,
+    0x9A, 0xEA, 0x0A, 0xE9, 0x0F, 0xFA, 0x29, 0xFF, 0x91, 0xAF, 0xF1, 0xEA, 0x0A, 0xFA, 0xF2, 0xFA,
+    0xFC, 0x2F, 0xE9, 0x0F, 0x1F, 0x19, 0xEA, 0x09, 0xF1, 0xF3, 0x9A, 0xCA, 0xA1, 0x9E, 0xA1, 0xF2,
+    0xF0, 0x9E, 0x91, 0x9E, 0x97, 0x1F, 0x2E, 0xA2, 0xF0, 0xAE, 0x91, 0x9E, 0xA7, 0x09, 0xEA, 0x19,
+    0xEA, 0x2F, 0x0A, 0xE9, 0x19, 0xEA, 0x70, 0xF3, 0xEA, 0x2F, 0x0A, 0xE9, 0x19, 0xEA, 0x7A, 0xE9,
+    0x3E, 0xA2, 0xF0, 0xAE, 0x91, 0x9E, 0xA7, 0xF4, 0xF2, 0xF0, 0x9E, 0xA1, 0xAE, 0x96, 0xAE, 0x94,
+    0xAE, 0x90, 0xAE, 0xA1, 0xF1, 0xF7, 0xEA, 0x59, 0xFF, 0xC2, 0xAF, 0xFA, 0x6F, 0x7A, 0xFE, 0x93,
+    0xFF, 0x69, 0xEA, 0x70, 0x9F, 0xC9, 0x5A, 0xFC, 0x77, 0x70, 0x97, 0x29, 0x94, 0x77, 0x77, 0x77,
+    0x71, 0x9F, 0xC9, 0x70, 0x9E, 0x97, 0x77, 0x70, 0x9F, 0xEA, 0x7F, 0x77, 0x77, 0x1F, 0xFC, 0x95,
+    0xAE, 0x97, 0x77, 0x70, 0x9F, 0x0A, 0xF5, 0xF7, 0x77, 0x71, 0xAE, 0x91, 0xF4, 0xAE, 0x77, 0x77,
+    0x2F, 0x2A, 0xE9, 0x3E, 0xA7, 0x77, 0x72, 0xF2, 0xAE, 0x92, 0xF7, 0x77, 0x73, 0xF2, 0xAE, 0x91,
+    0x9E, 0xA7, 0x77, 0x73, 0xF2, 0xAE, 0x91, 0xF7, 0x77, 0x74, 0xF2, 0xF1, 0x9E, 0x91, 0x9A, 0xAA,
+    0x97, 0x9A, 0xA9, 0x70, 0x9A, 0xA9, 0x4A, 0xE9, 0x1F, 0x1F, 0x1F, 0xE4, 0x9F, 0xDA, 0x4A, 0xFD,
+    0x39, 0xF9, 0xFA, 0x0A, 0xE9, 0x0F, 0xFC, 0x3F, 0xF9, 0x2A, 0xFF, 0x3A, 0xFF, 0x1F, 0x09, 0xFA,
+    0xF9, 0x1A, 0xFA, 0xF2, 0xFF, 0xCA, 0x3F, 0xE9, 0x0A, 0xE9, 0x0F, 0x90, 0x9F, 0x1F, 0x1A, 0xE9,
+    0x09, 0xEA, 0x1F, 0x49, 0xAC, 0xAA, 0x2E, 0xA1, 0xF2, 0xF0, 0x9E, 0xA1, 0x9E, 0xA0, 0xAE, 0x91,
+    0xAE, 0x97, 0x2F, 0x2F, 0x2F, 0x09, 0xEA, 0x2F, 0x0F, 0x29, 0xEA, 0x71, 0x9E, 0xA2, 0xF2, 0xAE,
+    0x99, 0xEA, 0x2F, 0x0F, 0x29, 0xEA, 0x71, 0xF3, 0xF2, 0xF0, 0x9E, 0xA2, 0xF0, 0xF2, 0x9E, 0xA7,
+    0x09, 0xE9, 0x3F, 0x2F, 0x09, 0xEA, 0x2F, 0x0A, 0xE9, 0x1A, 0xE9, 0x70, 0xF4, 0xF2, 0xF1, 0xF1,
+    0x9E, 0xA0, 0xAE, 0x91, 0xAE, 0x97, 0xAE, 0x94, 0xAE, 0xA0, 0x9E, 0xA1, 0xF1, 0xF9, 0x1F, 0x1F,
+    0x70, 0xF6, 0xFF, 0xC9, 0x19, 0xFF, 0xC2, 0xFF, 0xCA, 0x7A, 0xE9, 0x69, 0xFE, 0xA3, 0xFF, 0x93,
+    0xFF, 0x70, 0xEA, 0x70, 0x9F, 0xCA, 0x5A, 0xFC, 0x95, 0xFC, 0xA7, 0x77, 0x19, 0x72, 0x99, 0x72,
+    0x99, 0x40, 0x39, 0xF4, 0xFA, 0x39, 0xF4, 0xF4, 0x9E, 0xA4, 0xF4, 0x9E, 0x5E, 0xA5, 0xDA, 0x50,
+    0x39, 0xF2, 0xF9, 0x3F, 0xA1, 0x9F, 0x39, 0xF2, 0xF4, 0xF2, 0x9E, 0xA3, 0x9E, 0xA2, 0xF4, 0xF2,
+    0x9E, 0x93, 0x9E, 0x3E, 0xA4, 0xEA, 0x29, 0xE5, 0xDA, 0x3A, 0xD9, 0x40, 0x39, 0xF2, 0xF9, 0x1A,
+    0xEA, 0x4F, 0xA1, 0x9F, 0x2F, 0x49, 0xF2, 0xF2, 0xAE, 0xA4, 0xF2, 0x9E, 0xA2, 0xF4, 0x9E, 0xA2,
+    0xF2, 0xAE, 0x94, 0xF2, 0x9E, 0x92, 0xEA, 0x49, 0xE3, 0xEA, 0x2A, 0xE5, 0xEA, 0x29, 0xE3, 0xE9,
+    0x5D, 0xA3, 0xAD, 0x92, 0x9D, 0xA5, 0x0F, 0x94, 0x9F, 0x5F, 0x95, 0xF5, 0x9E, 0x95, 0xF6, 0xE9,
+    0x5A, 0xE6, 0xAD, 0x90, 0x0F, 0x91, 0xAE, 0xA4, 0x9F, 0x2F, 0x5F, 0x91, 0x9E, 0xA5, 0xF2, 0xF5,
+    0x9E, 0x92, 0xEA, 0x5F, 0x29, 0xE6, 0xE9, 0x2E, 0xA5, 0xAE, 0x3E, 0x6A, 0xD9, 0x29, 0xDA, 0x0F,
+    0x91, 0xAE, 0xA2, 0xF5, 0x9F, 0x2F, 0x2A, 0xEA, 0x5F, 0x91, 0x9E, 0xA2, 0xF6, 0xF2, 0xF2, 0x9E,
+    0xA5, 0x9E, 0x92, 0xEA, 0x2A, 0xE6, 0xF2, 0x9E, 0x3E, 0xA6, 0xE9, 0x2E, 0xA2, 0x9E, 0x6A, 0xE3,
+    0xE3, 0xEA, 0x6A, 0xD9, 0x29, 0xDA, 0x3E, 0x00, 0x49, 0xC9, 0x71, 0xE7, 0x09, 0xEA, 0x7F, 0xC6,
+    0x9D, 0x9D, 0xA5, 0xE0, 0xAD, 0x49, 0xD9, 0x1D, 0xA3, 0xAD, 0x2A, 0xD3, 0xDA, 0x3D, 0xA1, 0xAD,
+    0x4A, 0xD1, 0xDA, 0x5D, 0xA0, 0x5A, 0x7A, 0xDA, 0x4A, 0xFA, 0x29, 0xFC, 0x3F, 0xC3, 0xFC, 0x92,
+    0xFC, 0x92, 0xAF, 0xA3, 0x9F, 0xC4, 0xAF, 0xA4, 0xFC, 0x94, 0xFC, 0x94, 0xFC, 0x49, 0xFA, 0x49,
+    0xD9, 0x69, 0x20, 0x2A, 0x69, 0xE4, 0x9F, 0xA4, 0xAF, 0xA4, 0xFC, 0x94, 0xFC, 0x49, 0xFC, 0x4A,
+    0xFA, 0x3A, 0xFA, 0x2A, 0xFA, 0x29, 0xFC, 0x3F, 0xC3, 0xFC, 0x92, 0x9F, 0x95, 0xAC, 0xA7, 0x95,
+    0x77, 0x74, 0x96, 0xAE, 0x69, 0x49, 0xD5, 0xFA, 0x4A, 0xCA, 0x29, 0xF3, 0x9F, 0xA3, 0xAE, 0xA2,
+    0xFC, 0x3F, 0x92, 0xAF, 0x93, 0xFC, 0x29, 0xDA, 0x2A, 0xF9, 0x5F, 0xC7, 0xAF, 0x97, 0xFC, 0x5A,
+    0xF9, 0x71, 0xFC, 0x3A, 0xF9, 0x73, 0xFC, 0x1A, 0xF9, 0x75, 0xFC, 0xAF, 0x97, 0xAE, 0x3F, 0xF9,
+    0x2F, 0x1F, 0xA3, 0xFD, 0x92, 0x9F, 0xA9, 0xFC, 0x3A, 0xFC, 0x39, 0xFA, 0x0F, 0xA2, 0xAF, 0xE3,
+    0xF9, 0x1A, 0xA9, 0x2A, 0xFF, 0xC2, 0x9A, 0xA9, 0x7A, 0xF9, 0x0F, 0xC7, 0x4A, 0xF9, 0x2F, 0xC7,
+    0x2A, 0xF9, 0x4F, 0xC7, 0x0A, 0xF9, 0x6F, 0xC6, 0xAF, 0x92, 0x99, 0x3F, 0xC4, 0xAF, 0x92, 0xF3,
+    0xFC, 0x29, 0xF9, 0x29, 0xFA, 0x3F, 0xA2, 0xAD, 0x93, 0x9F, 0xA4, 0xE4, 0xA9, 0x5F, 0x95, 0xC7,
+    0x59, 0xAA, 0x97, 0x20, 0x0F, 0xC9, 0x29, 0xFC, 0x1F, 0xC9, 0x2A, 0xFC, 0x1F, 0xC9, 0x2A, 0xFC,
+    0x1F, 0xC9, 0x29, 0xFC, 0x1F, 0xC9, 0x29, 0xFC, 0x1F, 0xC9, 0x29, 0xFC, 0x1F, 0xC3, 0x9F, 0xA1,
+    0xFC, 0x39, 0xFA, 0x1A, 0xF4, 0xFA, 0x1A, 0xF4, 0xFA, 0x1A, 0xF4, 0xFA, 0x1A, 0xF4, 0xF9, 0x19,
+    0xF4, 0xF9, 0x19, 0xF4, 0xF9, 0x19, 0xF4, 0xF9, 0x19, 0xEA, 0x4F, 0x39, 0x99, 0x69, 0x99, 0x77,
+    0x77, 0x49, 0xEA, 0x4A, 0xE2, 0xFC, 0x92, 0xAF, 0xC1, 0xFC, 0xA2, 0xAF, 0xC1, 0xFC, 0x92, 0xAF,
+    0xC1, 0xAF, 0x4F, 0x93, 0x99, 0x69, 0x92, 0x77, 0x2A, 0xFE, 0x93, 0x9F, 0xFF, 0x2A, 0xFF, 0xFC,
+    0x2F, 0xFF, 0xCA, 0x1A, 0xFD, 0x1F, 0xC4, 0xF1, 0x9F, 0x4F, 0x19, 0xF4, 0xF1, 0xAF, 0x4F, 0x09,
+    0xF9, 0x4F, 0xAF, 0xC5, 0xFF, 0xA6, 0xFE, 0xA7, 0xAF, 0xC9, 0x70, 0xAF, 0x97, 0x1A, 0xF7, 0x2A,
+    0xF7, 0x77, 0x77, 0x77, 0x3E, 0xA7, 0x2F, 0xC9, 0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x71, 0x9F, 0x74,
+    0x99, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x4C, 0x97, 0x6C, 0x90, 0xD7,
+    0x5D, 0x19, 0xD7, 0x3A, 0xCA, 0x29, 0xD9, 0x70, 0xE4, 0x9E, 0xA9, 0x19, 0x9F, 0x69, 0xFF, 0xDA,
+    0x71, 0x9A, 0xFA, 0x95, 0x79, 0x99, 0x97, 0x49, 0xFF, 0x97, 0x0A, 0xFF, 0xE6, 0xE9, 0x59, 0xE9,
+    0x3D, 0xA7, 0x19, 0xD2, 0xAC, 0xA7, 0x39, 0xD1, 0xD7, 0x5A, 0xC9, 0x09, 0x77, 0xA0, 0x72, 0x99,
+    0x72, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA,
+    0x71, 0x9D, 0x97, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xEA, 0x70, 0xAF, 0x70, 0xD9, 0xD9, 0x6A,
+    0xD0, 0x9D, 0x6D, 0x91, 0xD9, 0x4A, 0xD2, 0xAD, 0x4D, 0xA3, 0xD9, 0x2A, 0xD4, 0xAD, 0x2D, 0xA5,
+    0xD9, 0x00, 0x77, 0x09, 0x99, 0x77, 0x77, 0x0A, 0xEA, 0x77, 0x77, 0x9E, 0x97, 0x77, 0x79, 0xE9,
+    0x77, 0x77, 0x0E, 0x77, 0x73, 0xCA, 0x92, 0xE2, 0x9A, 0xC7, 0x75, 0xFC, 0x9E, 0xAF, 0xC7, 0x74,
+    0x9F, 0xFF, 0xE9, 0x77, 0x39, 0xFF, 0xFE, 0xA7, 0x76, 0x99, 0xAF, 0xCA, 0x99, 0x97, 0x77, 0x2F,
+    0xE7, 0x77, 0x4A, 0xEA, 0xEA, 0x77, 0x72, 0x9F, 0x0F, 0x97, 0x77, 0x1F, 0x90, 0x9F, 0x77, 0x70,
+    0x9F, 0x2F, 0x97, 0x71, 0xAA, 0xAA, 0x39, 0xCA, 0x29, 0xC9, 0x3A, 0xAA, 0xA7, 0x3F, 0x77, 0x9F,
+    0x73, 0xF7, 0x70, 0xEA, 0x73, 0xAE, 0x77, 0x0E, 0xA7, 0x3A, 0xE7, 0x70, 0xE9, 0x59, 0xDA, 0x90,
+    0x9D, 0xA1, 0x9A, 0xD4, 0xDA, 0x91, 0xE9, 0x09, 0xAD, 0x9A, 0xFF, 0xFE, 0x4F, 0xFF, 0xEA, 0xAF,
+    0xFF, 0xE4, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0x4F, 0xFF, 0xEA, 0x4F, 0xD7, 0x6F, 0xCA, 0x70, 0x9F,
+    0xDA, 0x74, 0xAF, 0xD9, 0x7F, 0xAE, 0x97, 0x29, 0xEA, 0xF6, 0xF9, 0x0F, 0x71, 0x9F, 0x09, 0xF4,
+    0xAF, 0x1A, 0xF7, 0x0F, 0xA1, 0xFA, 0x39, 0xEA, 0x2E, 0x97, 0x09, 0xE2, 0x9E, 0x95, 0x9C, 0x3A,
+    0xA7, 0x49, 0xA3, 0xC9, 0x30, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x71, 0x74, 0x9E,
+    0x97, 0x4F, 0x74, 0x9E, 0x97, 0x4F, 0x74, 0xAE, 0x97, 0x4F, 0x74, 0xAE, 0x74, 0x9E, 0xA7, 0x4F,
+    0x74, 0x9E, 0xA7, 0x4F, 0x74, 0x9E, 0x97, 0x4F, 0x74, 0xAE, 0x97, 0x4F, 0x74, 0xAE, 0x75, 0xEA,
+    0x74, 0xF7, 0x49, 0xEA, 0x74, 0xF7, 0x49, 0xE9, 0x74, 0xF7, 0x4A, 0xE9, 0x74, 0xF7, 0x40, 0xAF,
+    0xE0, 0xAF, 0xE0, 0xAF, 0xE0, 0xAF, 0xAA, 0xA0, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAF, 0xE0, 0xAF, 0xE0, 0xAF, 0xE0,
+    0xAF, 0x99, 0x90, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE,
+    0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAF, 0xE0, 0xAF, 0xE0, 0xAF, 0xE1, 0x99, 0x99, 0x99, 0x90, 0x0F,
+    0xEA, 0x0F, 0xEA, 0x0F, 0xEA, 0x0A, 0xAA, 0xFA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x3A, 0xEA, 0x0F, 0xEA, 0x0F, 0xEA, 0x0F, 0xEA,
+    0x09, 0x99, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA3,
+    0xAE, 0xA3, 0xAE, 0xA3, 0xAE, 0xA0, 0xFE, 0xA0, 0xFE, 0xA0, 0xFE, 0xA0, 0x99, 0x99, 0x99, 0x90,
+    0x77, 0x77, 0x1A, 0xFE, 0xA5, 0x9A, 0xFE, 0x92, 0x9F, 0xFF, 0x91, 0x9F, 0xFF, 0x1A, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x09, 0xFF, 0xFC, 0xA0, 0xAD, 0x93, 0x9F, 0xC1, 0xDA, 0x93, 0xAF,
+    0xC1, 0x96, 0xAF, 0x72, 0xFC, 0x71, 0xAF, 0x72, 0xFC, 0x71, 0xFC, 0x72, 0xFA, 0x70, 0xAF, 0xA7,
+    0x1F, 0xC9, 0x7A, 0xFC, 0x71, 0xFC, 0xA7, 0xFD, 0x70, 0x9F, 0xD7, 0xFD, 0x70, 0x9F, 0xCA, 0x7F,
+    0xCA, 0x71, 0xFC, 0x97, 0x0F, 0x97, 0x19, 0xF9, 0x71, 0xF7, 0x29, 0xEA, 0x71, 0x9E, 0xA7, 0x2A,
+    0xE9, 0x72, 0x99, 0x97, 0x49, 0x99, 0x77, 0x77, 0x77, 0x77, 0x71, 0xEA, 0x72, 0x9E, 0xA7, 0x1F,
+    0xCA, 0x71, 0xFC, 0x97, 0x0F, 0xCA, 0x71, 0xFC, 0x97, 0x0F, 0xCA, 0x71, 0xFC, 0x97, 0x09, 0xF7,
+    0x2A, 0xF7, 0x39, 0x97, 0x59, 0x96, 0x77, 0x72, 0xAF, 0xEA, 0x5F, 0xC9, 0x9F, 0xFF, 0x93, 0xFC,
+    0x9A, 0xFF, 0xFC, 0x3F, 0xC9, 0x0F, 0xFF, 0xD2, 0xFC, 0x90, 0xAD, 0x93, 0x9F, 0xC2, 0xFC, 0x29,
+    0x6A, 0xF2, 0xFC, 0x72, 0xAF, 0x2F, 0xC7, 0x2F, 0xC2, 0xFC, 0x71, 0xAF, 0xA2, 0xFC, 0x70, 0xAF,
+    0xC3, 0xFC, 0x7F, 0xD4, 0xAF, 0x6F, 0xD5, 0xAF, 0x5F, 0xCA, 0x6A, 0xF5, 0xF9, 0x7A, 0xEA, 0x5F,
+    0x70, 0xAE, 0xA4, 0x9E, 0xA7, 0x09, 0xEA, 0x59, 0x99, 0x72, 0x99, 0x97, 0x77, 0x77, 0x76, 0xEA,
+    0x70, 0x9E, 0xA4, 0xFC, 0xA7, 0xFC, 0x93, 0xFC, 0xA6, 0x9F, 0xC9, 0x3F, 0xCA, 0x7F, 0xC9, 0x39,
+    0xF7, 0x0A, 0xF6, 0x99, 0x72, 0x99, 0x91, 0x77, 0x70, 0xFC, 0x93, 0x9A, 0xFD, 0xA9, 0x3F, 0xC9,
+    0x1A, 0xFF, 0xEA, 0x2F, 0xC9, 0x1F, 0xFF, 0xCA, 0x1F, 0xC9, 0x1A, 0xFF, 0xFC, 0x90, 0xFC, 0x92,
+    0xDA, 0x93, 0xFC, 0xA0, 0xFC, 0x92, 0x97, 0xFA, 0x0F, 0xC7, 0x4F, 0xA0, 0xFC, 0x73, 0x9F, 0xA0,
+    0xAF, 0x73, 0xFC, 0x1A, 0xF7, 0x19, 0xFC, 0xA1, 0xAF, 0x70, 0xAF, 0xCA, 0x2A, 0xF7, 0xAF, 0xC9,
+    0x39, 0xF7, 0xFC, 0x94, 0x9F, 0x6A, 0xF6, 0x9F, 0x6A, 0xE9, 0x69, 0xEA, 0x6A, 0xE7, 0x09, 0x99,
+    0x70, 0x99, 0x97, 0x77, 0x77, 0x77, 0x9E, 0xA6, 0xAE, 0x96, 0xFC, 0x94, 0x9F, 0xC6, 0xFC, 0xA4,
+    0x9F, 0xC9, 0x5F, 0xC9, 0x49, 0xFC, 0x6A, 0xF6, 0xFA, 0x70, 0x99, 0x70, 0x99, 0x96, 0x77, 0x0A,
+    0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0x73,
+    0xF9, 0x72, 0xAF, 0x73, 0xF7, 0x3F, 0xA7, 0x29, 0xF7, 0x3F, 0x97, 0x2A, 0xF7, 0x29, 0xF9, 0x72,
+    0xFA, 0x72, 0x9F, 0x73, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0x97, 0x2F, 0xC7, 0x00, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x59, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xDA, 0x19, 0xDA, 0xAA, 0xFF, 0xD9, 0x09,
+    0xD2, 0xFF, 0xE0, 0x9D, 0x2F, 0xFE, 0x99, 0xD2, 0xFF, 0xEA, 0x9D, 0x2F, 0xFE, 0xA9, 0xD2, 0xFF,
+    0xEA, 0x9D, 0x2F, 0xFE, 0xA9, 0xD2, 0xFF, 0xEA, 0x9D, 0x2F, 0xFE, 0xA9, 0xD2, 0xFF, 0xE9, 0x9D,
+    0x2F, 0xFE, 0x09, 0xD2, 0xFF, 0xDA, 0x09, 0xD2, 0xFF, 0xCA, 0x19, 0xD2, 0xFF, 0x92, 0x9D, 0x2D,
+    0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09,
+    0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA,
+    0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x77, 0x20, 0x77, 0x5A, 0xFF,
+    0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xFF, 0x09, 0xFF, 0xDA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xFF,
+    0xEA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xFF,
+    0xEA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xFF, 0xEA, 0x1A, 0xD0, 0xAF, 0xFD, 0xA1, 0xAD, 0x1F,
+    0xFE, 0xAA, 0xE1, 0x9F, 0xFF, 0xE2, 0x9F, 0xFF, 0xD5, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77,
+    0x3F, 0xFF, 0xC9, 0x4F, 0xFF, 0xE3, 0xFF, 0xFF, 0x2D, 0xA1, 0xFF, 0xE9, 0x1D, 0xA1, 0xFF, 0xEA,
+    0x1D, 0xA1, 0xFF, 0xF1, 0xDA, 0x1F, 0xFF, 0x1D, 0xA1, 0xFF, 0xF1, 0xDA, 0x1F, 0xFF, 0x1D, 0xA1,
+    0xFF, 0xF1, 0xDA, 0x1F, 0xFF, 0x1D, 0xA1, 0xFF, 0xEA, 0x1D, 0xA1, 0xFF, 0xE9, 0x1E, 0xAA, 0xFF,
+    0xE2, 0xFF, 0xFE, 0x92, 0xFF, 0xFD, 0x4A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x95, 0x69, 0x99, 0x97,
+    0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xAD, 0xA7, 0x9C, 0x92, 0xAD, 0xA2, 0x9A, 0xA1, 0xAF, 0xAA, 0xDA,
+    0xAF, 0xA1, 0xFF, 0xFF, 0x1F, 0xFF, 0xF3, 0x99, 0x9F, 0xD9, 0x99, 0x79, 0xFD, 0x97, 0x1F, 0xF7,
+    0x0F, 0x99, 0xF6, 0xAF, 0x1F, 0xA5, 0xAE, 0xA1, 0x9E, 0xA7, 0xAC, 0x3C, 0xA7, 0x76, 0x19, 0xA9,
+    0x3A, 0xF2, 0xFC, 0xA1, 0xFC, 0xA1, 0xFC, 0x92, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x72, 0xFC, 0x2A,
+    0xF2, 0x9F, 0x3F, 0x92, 0xAE, 0xA2, 0x9F, 0x3F, 0x39, 0xE9, 0x39, 0x99, 0x00, 0x79, 0x99, 0x97,
+    0x49, 0xFF, 0x97, 0x0A, 0xFF, 0xE6, 0xE9, 0x59, 0xE9, 0x3D, 0xA7, 0x19, 0xD2, 0xAC, 0xA7, 0x39,
+    0xD1, 0xD7, 0x5A, 0xC9, 0x09, 0x77, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xC9, 0x76, 0xC9, 0x0D, 0x75, 0xD1, 0x9D, 0x73, 0xAC, 0xA2, 0x9D, 0x97, 0x0E, 0x49, 0xEA, 0x91,
+    0x99, 0xF6, 0x9F, 0xFD, 0xA7, 0x19, 0xAF, 0xA9, 0x50, 0x69, 0x99, 0x97, 0x5F, 0x75, 0xF7, 0x5F,
+    0x75, 0xAD, 0xA7, 0x9C, 0x92, 0xAD, 0xA2, 0x9A, 0xA1, 0xAF, 0xAA, 0xDA, 0xAF, 0xA1, 0xFF, 0xFF,
+    0x1F, 0xFF, 0xF3, 0x99, 0x9F, 0xD9, 0x99, 0x79, 0xFD, 0x97, 0x1F, 0xF7, 0x0F, 0x99, 0xF6, 0xAF,
+    0x1F, 0xA5, 0xAE, 0xA1, 0x9E, 0xA7, 0xAC, 0x3C, 0xA7, 0x77, 0x59, 0x99, 0x97, 0x5F, 0x75, 0xF7,
+    0x5F, 0x75, 0xAD, 0xA7, 0x9C, 0x92, 0xAD, 0xA2, 0x9A, 0xA1, 0xAF, 0xAA, 0xDA, 0xAF, 0xA1, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xF3, 0x99, 0x9F, 0xD9, 0x99, 0x79, 0xFD, 0x97, 0x1F, 0xF7, 0x0F, 0x99, 0xF6,
+    0xAF, 0x1F, 0xA5, 0xAE, 0xA1, 0x9E, 0xA7, 0xAC, 0x3C, 0xA7, 0x76, 0x76, 0xF4, 0xEA, 0xAF, 0xA2,
+    0xAE, 0x9F, 0xCA, 0x2F, 0x0A, 0xFA, 0x19, 0xEA, 0x1F, 0x2F, 0x71, 0xF7, 0x0A, 0xE9, 0x70, 0xF7,
+    0x09, 0xEA, 0x70, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x70, 0xAE, 0x97, 0x0F, 0x70, 0x9E,
+    0xA7, 0x0F, 0x71, 0xF7, 0x0A, 0xE9, 0x70, 0xF2, 0xAE, 0x19, 0xEA, 0x19, 0xFC, 0x0F, 0x2A, 0xFC,
+    0x9E, 0xA2, 0xAF, 0xCA, 0xE9, 0x3F, 0x97, 0x19, 0x91, 0x59, 0x99, 0x99, 0x77, 0x79, 0xFF, 0xDA,
+    0x99, 0x72, 0xAD, 0x2A, 0xFF, 0xFF, 0xAA, 0x93, 0x9E, 0xA1, 0xAF, 0xFF, 0xFF, 0xFF, 0x2E, 0x95,
+    0x9A, 0xAF, 0xFF, 0xE2, 0xAD, 0x74, 0x99, 0xAF, 0xF9, 0x77, 0x77, 0x30, 0x70, 0x99, 0x75, 0x9A,
+    0xFE, 0x97, 0x0A, 0xFF, 0xE6, 0xEA, 0x59, 0xE4, 0xAC, 0xA7, 0x1A, 0xD2, 0x9C, 0xA7, 0x39, 0xD1,
+    0xD7, 0x5A, 0xC9, 0x09, 0x97, 0x6A, 0x00, 0x6A, 0xAA, 0x75, 0xE7, 0x09, 0xC2, 0xE1, 0xAC, 0x39,
+    0xE1, 0xE0, 0xAE, 0x3F, 0x9E, 0xAE, 0xA4, 0xFF, 0xDA, 0x6F, 0xFA, 0x3F, 0xFF, 0xFA, 0xFF, 0xFF,
+    0xAF, 0xFF, 0xFA, 0x3A, 0xFE, 0x96, 0xAF, 0xFC, 0x5A, 0xEA, 0xFE, 0x39, 0xEA, 0x0E, 0x0F, 0x3A,
+    0xCA, 0x1E, 0x1D, 0x94, 0x92, 0xE7, 0x5E, 0x60, 0x73, 0x99, 0x97, 0x4F, 0xC7, 0x3F, 0xC9, 0x71,
+    0x9F, 0xC9, 0x72, 0xFC, 0x74, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x09, 0x97, 0x4A, 0xF7, 0x3F,
+    0xCA, 0x72, 0xFC, 0xA7, 0x2F, 0xC9, 0x73, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x99,
+    0x97, 0x4F, 0xC7, 0x3F, 0xC9, 0x71, 0x9F, 0xC9, 0x72, 0xFC, 0x74, 0xAC, 0xA1, 0x39, 0xF1, 0x9F,
+    0x2F, 0x2F, 0x4F, 0xA1, 0xFA, 0x1F, 0xA1, 0xFA, 0x39, 0xF1, 0x9F, 0x19, 0xF1, 0x9F, 0x4F, 0x2F,
+    0x2F, 0x91, 0xF9, 0x39, 0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x4F, 0x2F, 0x2F, 0x2F, 0x49,
+    0xE2, 0x9E, 0x91, 0x9E, 0x91, 0x9E, 0x94, 0xEA, 0x2E, 0xA2, 0xEA, 0x2E, 0xA5, 0xDA, 0x3E, 0x3E,
+    0x3E, 0x50, 0x73, 0x99, 0x97, 0x76, 0xFC, 0x77, 0x5F, 0xC9, 0x77, 0x39, 0xFC, 0x97, 0x74, 0xFC,
+    0x77, 0x6A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x99, 0x77, 0x09, 0x99, 0x2A,
+    0xF7, 0x6F, 0xA1, 0xFC, 0xA7, 0x49, 0xFC, 0x1F, 0xCA, 0x74, 0x9F, 0xC1, 0xFC, 0x97, 0x5F, 0xC2,
+    0xAA, 0xA9, 0x76, 0x9A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x97, 0x76,
+    0xFC, 0x77, 0x5F, 0xC9, 0x77, 0x39, 0xFC, 0x97, 0x74, 0xFC, 0x77, 0x6A, 0xCA, 0x73, 0x19, 0x99,
+    0x77, 0x09, 0x99, 0x2A, 0xF7, 0x6F, 0xA1, 0xFC, 0xA7, 0x49, 0xFC, 0x1F, 0xCA, 0x74, 0x9F, 0xC1,
+    0xFC, 0x97, 0x5F, 0xC2, 0xAA, 0xA9, 0x77, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x19, 0x99, 0x77, 0x6F, 0xC7, 0x75, 0xFC, 0x97, 0x73, 0x9F, 0xC9, 0x77, 0x4F, 0xC7, 0x76, 0xAA,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0x97, 0x70, 0x99, 0x3A, 0xF7, 0x6F, 0xA1,
+    0xFC, 0xA7, 0x49, 0xFC, 0x1F, 0xCA, 0x74, 0x9F, 0xC1, 0xFC, 0x97, 0x5F, 0xC2, 0xAC, 0xA9, 0x76,
+    0x9A, 0xCA, 0x10, 0x79, 0xEA, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F, 0xC9, 0x09, 0xF3, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x9E, 0xA1, 0xFC, 0x90, 0xFC, 0xA0, 0xFC, 0x90, 0x9F, 0x39, 0x91, 0x77,
+    0x74, 0x9E, 0xA7, 0x7F, 0xC7, 0x69, 0xFC, 0x97, 0x6F, 0xC9, 0x76, 0xAE, 0xA7, 0x71, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x79, 0xAA, 0x72, 0xAA, 0x92, 0xAF, 0x70, 0xFC, 0x1F, 0xCA, 0x69, 0xFC,
+    0x1F, 0xCA, 0x69, 0xFC, 0x1F, 0xC9, 0x7F, 0xC2, 0xAD, 0x97, 0x09, 0xDA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x29, 0xEA, 0x77, 0xFC, 0x76, 0x9F, 0xC9, 0x76, 0xFC, 0x97, 0x6A, 0xEA, 0x77,
+    0x19, 0x97, 0x00, 0x72, 0xAE, 0x77, 0x6A, 0xE7, 0x6A, 0xDA, 0x3A, 0xE3, 0x9D, 0xA5, 0x9F, 0xA2,
+    0xAE, 0x3F, 0xC4, 0xAF, 0xC2, 0xAE, 0x29, 0xFC, 0x4A, 0xFC, 0x2A, 0xE2, 0x9F, 0xC4, 0x9F, 0x92,
+    0xAE, 0x3F, 0xC6, 0xAA, 0x93, 0xAE, 0x4A, 0xA9, 0x76, 0xAE, 0x77, 0x6A, 0xE7, 0x76, 0xAE, 0x73,
+    0xAF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD, 0x0A, 0xFF, 0xFF, 0xFF,
+    0xC7, 0x3A, 0xE7, 0x76, 0xAE, 0x77, 0x6A, 0xE7, 0x79, 0x94, 0xAE, 0x49, 0x99, 0x59, 0xF9, 0x2A,
+    0xE3, 0xFA, 0x4A, 0xFC, 0x2A, 0xE2, 0x9F, 0xC4, 0xAF, 0xC2, 0xAE, 0x29, 0xFC, 0x4A, 0xFA, 0x2A,
+    0xE2, 0x9F, 0xC5, 0xAD, 0xA3, 0xAE, 0x3A, 0xE9, 0x75, 0xAE, 0x77, 0x6A, 0xE7, 0x77, 0x76, 0x79,
+    0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0xA0, 0x9F, 0x77, 0x77, 0x5E, 0xA1, 0xFC, 0xA0, 0xFC, 0xA0,
+    0xFC, 0xA0, 0x9F, 0x39, 0x97, 0x77, 0x7A, 0xD9, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F, 0xCA, 0x0A, 0xF9,
+    0x19, 0xAA, 0x10, 0x19, 0x99, 0x2A, 0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xAF, 0x2A, 0xAA, 0x97, 0x1A,
+    0xCA, 0x91, 0xFC, 0x90, 0xFC, 0xA0, 0xFC, 0xA0, 0xAF, 0x39, 0x97, 0x19, 0xEA, 0x1F, 0xC9, 0x0F,
+    0xCA, 0x0F, 0xC9, 0x09, 0xEA, 0x72, 0x99, 0x2A, 0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0x91, 0xAC,
+    0xA9, 0x00, 0xFF, 0x99, 0x9D, 0x99, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5D, 0x2F, 0xF2, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFF, 0xCA,
+    0x99, 0x99, 0xAD, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0xA3, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xAF, 0xDA, 0x0F, 0xD1,
+    0xAF, 0xA2, 0xF3, 0xAD, 0xA4, 0xD5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x72, 0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x29, 0xF9, 0x1F,
+    0xD0, 0xAF, 0xDA, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x59, 0x92, 0x2A, 0xA4, 0xAD, 0xA2, 0xAC, 0x1C, 0xA0, 0xAC, 0x3C, 0xA0, 0xD1, 0xD2, 0xF4,
+    0xD5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99,
+    0x20, 0xFA, 0x29, 0x99, 0xCA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xD2, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x49, 0x99, 0x6F, 0xDA,
+    0x3F, 0xFA, 0x1A, 0xFF, 0xC1, 0xF9, 0x0F, 0xA0, 0xF1, 0x9E, 0xA9, 0xF2, 0xF9, 0xF2, 0xF9, 0xF2,
+    0xF0, 0xF2, 0xF0, 0xF1, 0x9F, 0x0F, 0x90, 0xFA, 0x09, 0xFF, 0xC2, 0xFF, 0xA3, 0xFD, 0xA6, 0x99,
+    0x93, 0x0A, 0xC9, 0x0A, 0xE0, 0x9E, 0x6A, 0xA9, 0x09, 0xE0, 0x9E, 0x09, 0xE0, 0x9E, 0x09, 0xE0,
+    0x9E, 0x09, 0xE0, 0x9E, 0x09, 0xE0, 0x9E, 0x19, 0x99, 0x00, 0x77, 0x2F, 0x96, 0xAF, 0x95, 0x9F,
+    0xC9, 0x5F, 0xD9, 0x4A, 0xD9, 0xE9, 0x39, 0xDA, 0x9E, 0x93, 0xE0, 0x9E, 0x92, 0xAD, 0x19, 0xE9,
+    0x19, 0xE9, 0x9A, 0xEA, 0x90, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAE, 0xAA, 0x69,
+    0xE9, 0x79, 0xE9, 0x76, 0x73, 0xFF, 0xA1, 0xFF, 0xA1, 0xEA, 0xAA, 0xAA, 0x91, 0xE7, 0xDA, 0x69,
+    0xFE, 0x91, 0x9F, 0xFA, 0x19, 0xA9, 0x9A, 0xF9, 0x59, 0xEA, 0x6E, 0xA9, 0x49, 0xEA, 0xAC, 0xA9,
+    0x9A, 0xF0, 0xAF, 0xFA, 0x09, 0xFE, 0x94, 0x99, 0x94, 0x69, 0x99, 0x94, 0xAF, 0xD3, 0xFF, 0x2F,
+    0xCA, 0x99, 0x91, 0x9E, 0xA6, 0xF7, 0xEA, 0x9F, 0x2F, 0xFD, 0x09, 0xFA, 0x9A, 0xEA, 0x0E, 0x92,
+    0xF0, 0xE9, 0x2F, 0x0E, 0xA2, 0xF0, 0xAE, 0xA9, 0xAE, 0xA1, 0xFF, 0xC3, 0xAF, 0xD6, 0x99, 0x93,
+    0x74, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE7, 0xE9, 0x6A, 0xE7, 0xE9, 0x6A, 0xE7, 0xEA, 0x6A, 0xE7,
+    0xEA, 0x6A, 0xE7, 0xF6, 0xAE, 0x96, 0xF7, 0x70, 0x39, 0x99, 0x95, 0x9F, 0xE2, 0x9F, 0xFC, 0x1A,
+    0xE9, 0x0A, 0xE9, 0x0A, 0xDA, 0x2E, 0x90, 0xAE, 0x19, 0xE2, 0xFF, 0x93, 0xFD, 0xA3, 0xFF, 0xA1,
+    0xF9, 0x9F, 0xA0, 0xE9, 0x2F, 0x0E, 0x92, 0xAE, 0x0F, 0x90, 0x9E, 0xA0, 0xAF, 0xFC, 0x2A, 0xFE,
+    0x59, 0x99, 0x93, 0x39, 0x99, 0x95, 0x9F, 0xD9, 0x29, 0xFF, 0xA1, 0xFA, 0x9F, 0x1E, 0xA2, 0xEA,
+    0x9E, 0x92, 0xAE, 0x0E, 0xA2, 0xF0, 0xF9, 0x9A, 0xF0, 0xAF, 0xFD, 0x19, 0xF0, 0xEA, 0x7E, 0x96,
+    0xF2, 0xA9, 0x9A, 0xFA, 0x2F, 0xF3, 0xFD, 0xA4, 0x99, 0x99, 0x94, 0x29, 0xD6, 0x9D, 0x95, 0x9D,
+    0x95, 0x9D, 0x92, 0xFF, 0xFF, 0xF2, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x92, 0x71, 0xFF,
+    0xFF, 0xF7, 0x10, 0xFF, 0xFF, 0xF0, 0x99, 0x99, 0x99, 0x99, 0x72, 0xFF, 0xFF, 0xF7, 0x10, 0x79,
+    0xDA, 0x1E, 0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1A, 0xD9, 0x1A, 0xD9, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x91, 0xAD, 0x91, 0x9D, 0xA2, 0xE2, 0xAD, 0x92, 0xE2, 0xAD, 0x92, 0x99, 0x90, 0x59, 0xDA, 0x2E,
+    0x29, 0xDA, 0x2E, 0x2A, 0xD9, 0x19, 0xDA, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x19, 0xDA, 0x1A,
+    0xD9, 0x1E, 0x2E, 0x1A, 0xD9, 0x09, 0xDA, 0x19, 0x99, 0x20, 0x0A, 0xA1, 0x9A, 0xAA, 0x91, 0x9D,
+    0x9F, 0xDA, 0x09, 0xFC, 0xAF, 0x09, 0xEA, 0x2E, 0x99, 0xE3, 0xEA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A,
+    0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x09, 0x99, 0x39,
+    0x99, 0x00, 0x49, 0x99, 0x6F, 0xDA, 0x3F, 0xFA, 0x1A, 0xFF, 0xC1, 0xF9, 0x0F, 0xA0, 0xF1, 0x9E,
+    0xA9, 0xF2, 0xF9, 0xF2, 0xF9, 0xF2, 0xF0, 0xF2, 0xF0, 0xF1, 0x9F, 0x0F, 0x90, 0xFA, 0x09, 0xFF,
+    0xC2, 0xFF, 0xA3, 0xFD, 0xA6, 0x99, 0x93, 0x74, 0xAE, 0x3F, 0xC1, 0x9F, 0xD0, 0xAF, 0xE0, 0x9E,
+    0xAE, 0x1A, 0xA0, 0x9E, 0x49, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE, 0x4A, 0xE4, 0xAE,
+    0x71, 0x39, 0x99, 0x95, 0xAF, 0xDA, 0x2F, 0xFC, 0x91, 0xAE, 0xAF, 0xC2, 0xAA, 0x2F, 0x7F, 0x69,
+    0xEA, 0x6F, 0x6F, 0x95, 0xF9, 0x5F, 0x95, 0xF9, 0x5F, 0xFD, 0x90, 0xFF, 0xD9, 0x0F, 0xFD, 0x97,
+    0x30, 0x39, 0x99, 0x95, 0xAF, 0xDA, 0x2F, 0xFC, 0xA1, 0x9D, 0xA9, 0xAF, 0x29, 0x39, 0xE7, 0xAE,
+    0x49, 0x9A, 0xE9, 0x3A, 0xFC, 0x5A, 0xFD, 0x96, 0x9A, 0xE9, 0x7E, 0xA0, 0x95, 0xEA, 0x0E, 0xAA,
+    0xAF, 0x90, 0xFF, 0xD1, 0xAF, 0xEA, 0x59, 0x99, 0x93, 0x77, 0x2F, 0x96, 0xAF, 0x95, 0x9F, 0xC9,
+    0x5F, 0xD9, 0x4A, 0xD9, 0xE9, 0x39, 0xDA, 0x9E, 0x93, 0xE0, 0x9E, 0x92, 0xAD, 0x19, 0xE9, 0x19,
+    0xE9, 0x9A, 0xEA, 0x90, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x9A, 0xAA, 0xAA, 0xAE, 0xAA, 0x69, 0xE9,
+    0x79, 0xE9, 0x76, 0x73, 0xFF, 0xA1, 0xFF, 0xA1, 0xEA, 0xAA, 0xAA, 0x91, 0xE7, 0xDA, 0x69, 0xFE,
+    0x91, 0x9F, 0xFA, 0x19, 0xA9, 0x9A, 0xF9, 0x59, 0xEA, 0x6E, 0xA9, 0x49, 0xEA, 0xAC, 0xA9, 0x9A,
+    0xF0, 0xAF, 0xFA, 0x09, 0xFE, 0x94, 0x99, 0x94, 0x69, 0x99, 0x94, 0xAF, 0xD3, 0xFF, 0x2F, 0xCA,
+    0x99, 0x91, 0x9E, 0xA6, 0xF7, 0xEA, 0x9F, 0x2F, 0xFD, 0x09, 0xFA, 0x9A, 0xEA, 0x0E, 0x92, 0xF0,
+    0xE9, 0x2F, 0x0E, 0xA2, 0xF0, 0xAE, 0xA9, 0xAE, 0xA1, 0xFF, 0xC3, 0xAF, 0xD6, 0x99, 0x93, 0x74,
+    0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE7, 0xE9, 0x6A, 0xE7, 0xE9, 0x6A, 0xE7, 0xEA, 0x6A, 0xE7, 0xEA,
+    0x6A, 0xE7, 0xF6, 0xAE, 0x96, 0xF7, 0x70, 0x39, 0x99, 0x95, 0x9F, 0xE2, 0x9F, 0xFC, 0x1A, 0xE9,
+    0x0A, 0xE9, 0x0A, 0xDA, 0x2E, 0x90, 0xAE, 0x19, 0xE2, 0xFF, 0x93, 0xFD, 0xA3, 0xFF, 0xA1, 0xF9,
+    0x9F, 0xA0, 0xE9, 0x2F, 0x0E, 0x92, 0xAE, 0x0F, 0x90, 0x9E, 0xA0, 0xAF, 0xFC, 0x2A, 0xFE, 0x59,
+    0x99, 0x93, 0x39, 0x99, 0x95, 0x9F, 0xD9, 0x29, 0xFF, 0xA1, 0xFA, 0x9F, 0x1E, 0xA2, 0xEA, 0x9E,
+    0x92, 0xAE, 0x0E, 0xA2, 0xF0, 0xF9, 0x9A, 0xF0, 0xAF, 0xFD, 0x19, 0xF0, 0xEA, 0x7E, 0x96, 0xF2,
+    0xA9, 0x9A, 0xFA, 0x2F, 0xF3, 0xFD, 0xA4, 0x99, 0x99, 0x94, 0x29, 0xD6, 0x9D, 0x95, 0x9D, 0x95,
+    0x9D, 0x92, 0xFF, 0xFF, 0xF2, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x92, 0x71, 0xFF, 0xFF,
+    0xF7, 0x10, 0xFF, 0xFF, 0xF0, 0x99, 0x99, 0x99, 0x99, 0x72, 0xFF, 0xFF, 0xF7, 0x10, 0x79, 0xDA,
+    0x1E, 0x1A, 0xD9, 0x1E, 0x19, 0xDA, 0x1A, 0xD9, 0x1A, 0xD9, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x91,
+    0xAD, 0x91, 0x9D, 0xA2, 0xE2, 0xAD, 0x92, 0xE2, 0xAD, 0x92, 0x99, 0x90, 0x59, 0xDA, 0x2E, 0x29,
+    0xDA, 0x2E, 0x2A, 0xD9, 0x19, 0xDA, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x19, 0xDA, 0x1A, 0xD9,
+    0x1E, 0x2E, 0x1A, 0xD9, 0x09, 0xDA, 0x19, 0x99, 0x20, 0x29, 0xAF, 0x93, 0xAF, 0xEA, 0x3C, 0xA9,
+    0x9A, 0xE7, 0x0E, 0x93, 0x99, 0xAA, 0xE9, 0x1F, 0xFC, 0x90, 0xF9, 0x1E, 0x90, 0xE9, 0x2E, 0x90,
+    0xE9, 0x19, 0xE9, 0x0F, 0xFD, 0x91, 0xFC, 0xA0, 0xD9, 0x29, 0x99, 0x50, 0x2A, 0xEA, 0x92, 0x9F,
+    0xEA, 0x1E, 0xA9, 0x9E, 0x9A, 0xDA, 0x29, 0xDA, 0xEA, 0xAA, 0xAA, 0xFF, 0xFF, 0xCA, 0xAA, 0xAA,
+    0xAA, 0x9E, 0xA6, 0x9E, 0x93, 0x91, 0xFF, 0xC9, 0x1A, 0xFE, 0x49, 0x99, 0x92, 0x2A, 0xEA, 0x93,
+    0x9F, 0xF2, 0xEA, 0x99, 0xEA, 0x0A, 0xE2, 0x9E, 0x0E, 0x93, 0xE9, 0xE9, 0x3E, 0x9E, 0x93, 0xE9,
+    0xAD, 0xA3, 0xE9, 0x9E, 0x91, 0xAE, 0x1A, 0xFF, 0x92, 0xAF, 0xD9, 0x59, 0x99, 0x40, 0x9A, 0xAA,
+    0x3A, 0xAA, 0xA1, 0xF1, 0x9E, 0x92, 0xE9, 0x0E, 0xA3, 0x9E, 0xAE, 0x5A, 0xFC, 0x7F, 0xA6, 0xAF,
+    0xC6, 0xFD, 0xA4, 0xEA, 0x0E, 0x92, 0xAE, 0x19, 0xE1, 0x9E, 0x3A, 0xE7, 0x50, 0x19, 0xAF, 0x93,
+    0x9F, 0xF9, 0x19, 0xCA, 0x99, 0x9F, 0x70, 0xEA, 0x7A, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0xE3, 0xAD,
+    0xA0, 0xAD, 0xA2, 0xE9, 0x1F, 0xFA, 0x3F, 0xDA, 0x69, 0x99, 0x30, 0x9E, 0x79, 0xE7, 0x9E, 0x79,
+    0xE7, 0x9E, 0x0A, 0xE9, 0x19, 0xFF, 0xD0, 0x9F, 0xA9, 0xF9, 0x9E, 0x92, 0xE9, 0x9E, 0x3E, 0xA9,
+    0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3,
+    0xAD, 0xA7, 0x30, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x3A, 0xAA, 0xA0, 0x9E,
+    0x2A, 0xE1, 0x9E, 0x1A, 0xE2, 0x9E, 0x0A, 0xE3, 0x9E, 0xAE, 0x49, 0xFE, 0x49, 0xFE, 0xA3, 0x9E,
+    0x90, 0xE9, 0x29, 0xE1, 0x9E, 0x91, 0x9E, 0x2A, 0xE1, 0x9E, 0x3F, 0x75, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x30, 0x9A, 0xA1, 0xAE, 0x91,
+    0xAE, 0xA1, 0x9D, 0xAF, 0xDA, 0xFE, 0x09, 0xFA, 0xAF, 0xCA, 0x9A, 0xE9, 0x9E, 0x91, 0x9E, 0xA2,
+    0xEA, 0x9E, 0x3E, 0x92, 0xAD, 0xA9, 0xE3, 0xE3, 0xAD, 0xA9, 0xE3, 0xE3, 0xAD, 0xA9, 0xE3, 0xE3,
+    0xAD, 0xA9, 0xE3, 0xE3, 0xAD, 0xA9, 0xE3, 0xE3, 0xAD, 0xA9, 0xE3, 0xE3, 0xAD, 0xA7, 0x72, 0x9A,
+    0xA1, 0xAE, 0xA1, 0x9D, 0xAF, 0xE0, 0x9F, 0xA9, 0xF9, 0x9E, 0x92, 0xE9, 0x9E, 0x3A, 0xDA, 0x9E,
+    0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A,
+    0xDA, 0x73, 0x9A, 0xA9, 0x0A, 0xE9, 0x19, 0xDA, 0xFD, 0x90, 0x9F, 0xAA, 0xF0, 0x9E, 0x92, 0xE9,
+    0x9E, 0x3E, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xA9, 0xE3, 0xEA, 0x9E, 0xA1, 0xAE, 0x09, 0xFF,
+    0xCA, 0x09, 0xEA, 0xFA, 0x19, 0xE1, 0x99, 0x39, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x70, 0x19, 0xAF,
+    0xA1, 0x9F, 0xEA, 0x0E, 0xA9, 0x9A, 0xC1, 0xE9, 0x5A, 0xFA, 0x4A, 0xFC, 0xA4, 0xAF, 0xA5, 0xAE,
+    0x0A, 0x39, 0xE0, 0xFF, 0xA0, 0xFE, 0xA3, 0x99, 0x99, 0x20, 0x73, 0xD9, 0x49, 0xD9, 0x39, 0xFA,
+    0xA9, 0x9F, 0xEA, 0x9A, 0xEA, 0xAA, 0x91, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0xA4,
+    0xAF, 0xCA, 0x2F, 0xCA, 0x39, 0x99, 0x10, 0x77, 0x7A, 0xFD, 0xA7, 0x09, 0xFF, 0xC9, 0x69, 0xFF,
+    0xD7, 0xFF, 0xDA, 0x6A, 0xFC, 0x39, 0x96, 0xFC, 0x75, 0xFA, 0x75, 0xF9, 0x2A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x09, 0xF9, 0x19, 0xFF, 0xC9, 0x9F, 0x91, 0x9F, 0xFC, 0x90, 0xF9, 0x19, 0xFF, 0xC9, 0x0F,
+    0xA1, 0x9F, 0x6F, 0xC1, 0x9F, 0x69, 0xFC, 0xAA, 0xF9, 0x99, 0x99, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFC, 0x79, 0xAF, 0x99, 0x99, 0x97, 0x09, 0xF7, 0x59, 0xF7, 0x59, 0xFF, 0xC7, 0x09,
+    0xFF, 0xC9, 0x79, 0xFF, 0xC9, 0x79, 0xFF, 0xC9, 0x71, 0x99, 0x29, 0x97, 0x3D, 0x90, 0x9D, 0x72,
+    0x9D, 0x1A, 0xD7, 0x09, 0xAF, 0xEA, 0x6A, 0xFF, 0xF9, 0x3F, 0xFF, 0xD9, 0x2F, 0xFF, 0xE2, 0xFF,
+    0xC1, 0xAE, 0xA1, 0xAF, 0xC9, 0xAD, 0x1D, 0xA3, 0xFC, 0x90, 0xDA, 0x1D, 0x92, 0x9F, 0xC1, 0xD9,
+    0x1D, 0x3A, 0xF9, 0x1D, 0x19, 0xD3, 0xFC, 0x90, 0x9D, 0x1A, 0xD3, 0xFC, 0x1A, 0xD1, 0xDA, 0x3F,
+    0xC1, 0xDA, 0x1D, 0x93, 0xFC, 0x1D, 0x91, 0xD4, 0xAF, 0x90, 0xD1, 0x9D, 0x4A, 0xFA, 0x9D, 0x1A,
+    0xD4, 0x9F, 0xCA, 0xD1, 0xDA, 0x5F, 0xEA, 0x1D, 0x95, 0x9F, 0xDA, 0x1D, 0x19, 0xA9, 0x2F, 0xFF,
+    0xE9, 0x3F, 0xFF, 0xD9, 0x4A, 0xFF, 0xF9, 0x5F, 0xFE, 0x96, 0xD9, 0x09, 0xD9, 0x72, 0xD1, 0x9D,
+    0x72, 0x9D, 0x1A, 0xCA, 0x60, 0x77, 0x79, 0xAF, 0xDA, 0x96, 0xFF, 0xF3, 0x9F, 0xFF, 0xC3, 0xFF,
+    0xFC, 0x92, 0xFD, 0xA3, 0x9A, 0xC2, 0x9F, 0xC9, 0x72, 0xFC, 0xA7, 0x3F, 0xC7, 0x39, 0xFA, 0x73,
+    0xAF, 0x92, 0xAA, 0x91, 0xAA, 0xA0, 0xAF, 0x91, 0x9E, 0x0F, 0x0F, 0xC2, 0x9E, 0xAF, 0x0F, 0xC2,
+    0x9F, 0xF0, 0xFC, 0x91, 0x9F, 0xCA, 0x99, 0x0A, 0xF9, 0x19, 0xFA, 0x3A, 0xFA, 0x19, 0xF4, 0x9F,
+    0xC1, 0x9F, 0x5F, 0xC1, 0x9F, 0x5F, 0xD0, 0x9F, 0x59, 0xFC, 0xAA, 0xF1, 0x99, 0x2F, 0xFF, 0xDA,
+    0x3F, 0xFF, 0xCA, 0x4F, 0xFF, 0xA5, 0x9F, 0xFC, 0xA7, 0x29, 0x99, 0x50, 0x2F, 0xFF, 0xD3, 0xFF,
+    0xFD, 0x92, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x92, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x93, 0xFC, 0x74,
+    0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFF, 0xFC, 0xA3, 0xFF, 0xFC, 0xA3, 0xFF, 0xFC,
+    0xA3, 0xFF, 0xFC, 0xA3, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x71, 0x9F, 0xFF, 0x49, 0xFF, 0xF4, 0x9A,
+    0xAF, 0xCA, 0xAA, 0xAA, 0x7F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x10, 0x77, 0x79, 0xAF,
+    0xDA, 0x96, 0xAF, 0xFD, 0xA4, 0xAF, 0xFE, 0x5F, 0xFF, 0x4A, 0xFC, 0x39, 0xA9, 0x4A, 0xF9, 0x73,
+    0xAF, 0x74, 0xAF, 0x71, 0x99, 0x9F, 0xCA, 0x99, 0x99, 0x93, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xC3,
+    0x99, 0x9F, 0xCA, 0x99, 0x99, 0x96, 0xAF, 0x71, 0x9A, 0xAF, 0xDA, 0xAA, 0xAA, 0x3A, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xFC, 0x6F, 0xC7, 0x4F, 0xC7, 0x3A, 0xF9, 0x72, 0xAF, 0xA7, 0x2A, 0xFF, 0xFF, 0x9A,
+    0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x90, 0x77, 0x77, 0x76, 0xE7, 0x77, 0x0A, 0xDA,
+    0x77, 0x70, 0xE7, 0x71, 0x9A, 0x99, 0x2A, 0xE9, 0xAA, 0x94, 0xAE, 0xA0, 0x9F, 0xEA, 0x0F, 0xFC,
+    0xA2, 0xAF, 0x9F, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xFF, 0xFD, 0x90, 0xAF, 0xEA, 0xAF, 0xFC, 0xA9,
+    0xAF, 0xD0, 0xAF, 0xCA, 0x3F, 0xE3, 0xAF, 0xC0, 0xAF, 0xC4, 0x9F, 0xC9, 0x4F, 0xC0, 0xAF, 0xA4,
+    0x9F, 0xC5, 0xFC, 0x0A, 0xFA, 0x5F, 0xC5, 0xFC, 0x0A, 0xF9, 0x5F, 0xC5, 0xFC, 0x0A, 0xF9, 0x49,
+    0xFC, 0x5F, 0xC0, 0xAF, 0x94, 0xAF, 0xC5, 0xFC, 0x0A, 0xF9, 0x4F, 0xD5, 0xFC, 0x0A, 0xF9, 0x3A,
+    0xFD, 0x5F, 0xC0, 0xAF, 0x93, 0xFE, 0x5F, 0xC0, 0xAF, 0x92, 0xAF, 0xE5, 0xFC, 0x0A, 0xF9, 0x2F,
+    0xF5, 0xFC, 0x0A, 0xF9, 0x1A, 0xFF, 0x5F, 0xC0, 0xAF, 0x91, 0xEA, 0xFC, 0x5F, 0xC7, 0x9E, 0x77,
+    0x70, 0xE9, 0x77, 0x79, 0xE7, 0x77, 0x0A, 0xAA, 0x97, 0x72, 0x1A, 0xF9, 0x4A, 0xDA, 0x3A, 0xFC,
+    0x4F, 0x3A, 0xFC, 0x4F, 0x3A, 0xFC, 0xA3, 0xF3, 0xAF, 0xD3, 0xF3, 0xAD, 0xAE, 0x3F, 0x3A, 0xDA,
+    0xAD, 0x92, 0xF3, 0xAE, 0x9E, 0x2F, 0x19, 0xAF, 0xAE, 0xAA, 0xAF, 0xA9, 0xAF, 0xFF, 0xFC, 0xAA,
+    0xFF, 0xFF, 0xCA, 0x1A, 0xE0, 0x9E, 0x1F, 0x3A, 0xE1, 0xE9, 0x0F, 0x19, 0xAF, 0xAA, 0xFA, 0xFA,
+    0xAA, 0xFF, 0xFF, 0xCA, 0xAF, 0xFF, 0xFC, 0xA1, 0xAE, 0x2A, 0xD9, 0xAE, 0x3A, 0xE2, 0x9D, 0xAA,
+    0xE3, 0xAE, 0x3E, 0xAE, 0x3A, 0xE3, 0xFE, 0x3A, 0xE3, 0xAF, 0xD3, 0xAE, 0x4F, 0xD3, 0xAE, 0x4F,
+    0xD3, 0xAE, 0x4A, 0xFC, 0x10, 0x9F, 0xEA, 0xA9, 0x77, 0x9F, 0xFE, 0x97, 0x59, 0xFF, 0xFA, 0x74,
+    0x9F, 0xFF, 0xC9, 0x73, 0x9F, 0xA9, 0x9A, 0xFD, 0x73, 0x9F, 0x93, 0xFC, 0x97, 0x29, 0xF9, 0x3A,
+    0xF9, 0x2A, 0xAA, 0x49, 0xF9, 0x39, 0xFA, 0x2E, 0x49, 0xF9, 0x39, 0xF9, 0x1A, 0xE4, 0x9F, 0x93,
+    0xAF, 0x91, 0xF4, 0x9F, 0x92, 0x9F, 0xC1, 0xAF, 0xF0, 0x9F, 0xAA, 0xAF, 0xDA, 0x9F, 0xFD, 0x99,
+    0xFF, 0xFC, 0x0F, 0xFE, 0x99, 0xFF, 0xF9, 0x0A, 0xAF, 0xCA, 0xAA, 0xA0, 0x9F, 0xFD, 0xA4, 0xAF,
+    0x49, 0xFA, 0xAA, 0x99, 0x6A, 0xF4, 0x9F, 0x97, 0x2A, 0xF4, 0x9F, 0x97, 0x2A, 0xF4, 0x9F, 0x97,
+    0x2A, 0xF4, 0x9F, 0x97, 0x29, 0xF4, 0x9F, 0x97, 0x29, 0xFC, 0x99, 0xA9, 0x9F, 0x97, 0x3F, 0xF9,
+    0x9F, 0x97, 0x3A, 0xFE, 0x99, 0xF9, 0x74, 0xAF, 0xD9, 0x77, 0x59, 0x92, 0x9F, 0xEA, 0xA7, 0x71,
+    0xAF, 0xFE, 0x77, 0xAF, 0xFF, 0x76, 0xAF, 0xFF, 0xA7, 0x5A, 0xF9, 0x99, 0xFD, 0x75, 0xAF, 0x3F,
+    0xC5, 0x9A, 0xA9, 0x92, 0xAF, 0x3A, 0xF9, 0x2F, 0xFA, 0x0A, 0xF3, 0x9F, 0x91, 0xFF, 0xD0, 0xAF,
+    0x3A, 0xF1, 0xAF, 0xFC, 0xA0, 0xAF, 0x3F, 0xC1, 0xFC, 0x19, 0xAC, 0x90, 0xAF, 0x90, 0x9F, 0xCA,
+    0x1F, 0x96, 0xAF, 0xFF, 0x2F, 0xC6, 0xAF, 0xFE, 0x3F, 0xD9, 0x4A, 0xFF, 0xD4, 0x9F, 0xE3, 0xAF,
+    0xFD, 0x94, 0x9F, 0xEA, 0x1A, 0xF1, 0xFC, 0x6F, 0xEA, 0x0A, 0xF1, 0xAF, 0x96, 0x9F, 0xD0, 0xAF,
+    0x2F, 0xC7, 0x0F, 0xC9, 0xAF, 0x2F, 0xC7, 0x1F, 0x9A, 0xF2, 0x9F, 0xA1, 0x95, 0xF9, 0xAF, 0x3F,
+    0xC1, 0xDA, 0x90, 0x9A, 0xF0, 0xAF, 0x3A, 0xFA, 0x0F, 0xFE, 0x0A, 0xF4, 0xFC, 0x0F, 0xFD, 0x1A,
+    0xF4, 0xAF, 0xAA, 0xFE, 0xA7, 0x75, 0x99, 0x95, 0x0E, 0xA4, 0xF9, 0x4E, 0xA1, 0xF4, 0xFA, 0x4E,
+    0xA1, 0xF3, 0x9F, 0xC3, 0x9E, 0xA1, 0xF3, 0x9F, 0xC3, 0x9E, 0x91, 0xAE, 0x3A, 0xFC, 0x3A, 0xE2,
+    0xAE, 0x92, 0xAD, 0xAD, 0x92, 0xF2, 0x9E, 0x92, 0xE9, 0xD9, 0x2F, 0x3E, 0xA2, 0xE9, 0xDA, 0x2E,
+    0xA3, 0xEA, 0x2D, 0xA0, 0xE2, 0xEA, 0x3F, 0x19, 0xDA, 0x0E, 0x19, 0xE9, 0x3F, 0x1A, 0xDA, 0x0E,
+    0x90, 0xAE, 0x91, 0xAF, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE9, 0x09, 0x9E, 0xA9, 0xE9, 0x9A,
+    0xE9, 0xF9, 0x93, 0xE9, 0x0E, 0x19, 0xE0, 0xEA, 0x5E, 0xA9, 0xE2, 0xE0, 0xE9, 0x5A, 0xDA, 0xAD,
+    0xA2, 0xE9, 0xE9, 0x5A, 0xEA, 0xD9, 0x2E, 0xAE, 0x69, 0xFD, 0x92, 0xAF, 0xD7, 0xFD, 0x3A, 0xFC,
+    0xA7, 0xFD, 0x39, 0xFC, 0xA7, 0xFC, 0xA4, 0xFC, 0x97, 0xAF, 0xA4, 0xFC, 0x70, 0xAF, 0x94, 0xFC,
+    0x40, 0x0F, 0xFE, 0xA9, 0x69, 0xEA, 0x0F, 0xFF, 0xDA, 0x4A, 0xF0, 0xFF, 0xFF, 0x3A, 0xF0, 0xFF,
+    0xFF, 0xA2, 0xAF, 0x0F, 0x69, 0xFC, 0x2A, 0xF0, 0xF7, 0x9F, 0x91, 0xAF, 0x0F, 0x2A, 0xAA, 0xA1,
+    0xFA, 0x1A, 0xF0, 0xF1, 0x9F, 0x1A, 0xF1, 0xAF, 0x0F, 0x19, 0xF1, 0x9F, 0x1A, 0xF0, 0xF1, 0x9F,
+    0x19, 0xF1, 0xAF, 0x0F, 0x19, 0xF1, 0x9F, 0x1A, 0xF0, 0xF1, 0x9F, 0x19, 0xF1, 0xAF, 0x0F, 0x19,
+    0xF1, 0x9F, 0x1A, 0xF0, 0xF1, 0x9F, 0x19, 0xF1, 0xAF, 0x0F, 0x19, 0xF1, 0x9F, 0x1A, 0xF0, 0xF1,
+    0x9F, 0x19, 0xF1, 0xAF, 0x0F, 0x19, 0xF1, 0x9F, 0x1A, 0xEA, 0x0F, 0x19, 0xF1, 0x9F, 0x1F, 0xA0,
+    0xF1, 0x9F, 0x79, 0xF9, 0x0F, 0x19, 0xF7, 0xFC, 0x1F, 0x19, 0xFA, 0xAA, 0xAA, 0xAF, 0xDA, 0x1F,
+    0x19, 0xFF, 0xFF, 0x2F, 0x19, 0xFF, 0xFD, 0xA3, 0xF1, 0x9F, 0xFF, 0xA4, 0x74, 0x99, 0x99, 0x77,
+    0x9F, 0xA7, 0x69, 0xFA, 0x71, 0x9A, 0xAA, 0xAF, 0xDA, 0xA7, 0xAF, 0xFF, 0x7A, 0xFF, 0xF7, 0x9A,
+    0xAA, 0xAA, 0xFC, 0xAA, 0x74, 0x9F, 0xA7, 0x09, 0x99, 0x91, 0x9F, 0xA6, 0xFE, 0x09, 0xFA, 0x49,
+    0xFF, 0xC9, 0xFA, 0x4F, 0xFF, 0xEA, 0x3A, 0xFD, 0xAA, 0xAF, 0xDA, 0x3F, 0xD3, 0x9F, 0xCA, 0x3F,
+    0xCA, 0x4A, 0xFA, 0x29, 0xFC, 0x59, 0xFA, 0x29, 0xFC, 0x6F, 0xA2, 0x9F, 0xC6, 0xFA, 0x29, 0xFC,
+    0x6F, 0xA2, 0x9F, 0xC9, 0x49, 0xFA, 0x3F, 0xCA, 0x4A, 0xFA, 0x3F, 0xD9, 0x29, 0xFC, 0xA3, 0xAF,
+    0xEA, 0xFE, 0xA4, 0xFF, 0xFE, 0xA5, 0xFF, 0xA0, 0xFA, 0x6A, 0xFC, 0x91, 0xAE, 0xA7, 0x09, 0x97,
+    0x77, 0x77, 0x77, 0x1F, 0xFF, 0xCA, 0x6F, 0xFF, 0xCA, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x40, 0x79, 0xAF, 0xCA, 0x79, 0xFF, 0xDA, 0x4A, 0xFF, 0xE9, 0x3A, 0xFF, 0xF3, 0x9F, 0xCA, 0x92,
+    0x9C, 0x93, 0xFC, 0xA7, 0x3F, 0xC7, 0x3A, 0xF9, 0x71, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x93, 0xFF,
+    0xFC, 0xA3, 0xFF, 0xFC, 0xA3, 0x99, 0xFC, 0x99, 0x99, 0x99, 0x95, 0xFC, 0x72, 0xAA, 0xFC, 0xAA,
+    0xAA, 0xA9, 0x4F, 0xFF, 0xA4, 0xFF, 0xFA, 0x6A, 0xF9, 0x73, 0x9F, 0xA7, 0x4F, 0xC9, 0x73, 0xAF,
+    0xCA, 0x49, 0xA4, 0xFF, 0xFC, 0x5F, 0xFF, 0x6F, 0xFE, 0x79, 0xFF, 0x97, 0x39, 0x99, 0x30, 0x1A,
+    0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x4F, 0xC3, 0xAF, 0x93, 0x9F, 0xA3, 0xAF, 0x93, 0xFC, 0x4A, 0xF9,
+    0x2A, 0xF9, 0x4A, 0xF9, 0x2F, 0xA5, 0xAF, 0x91, 0xFC, 0x6A, 0xF9, 0x09, 0xF9, 0x6A, 0xF9, 0x0F,
+    0xC7, 0xAF, 0x9A, 0xF7, 0x9F, 0xCA, 0xFC, 0x99, 0x99, 0x2A, 0xFF, 0xFF, 0xA1, 0xAF, 0xFF, 0xFA,
+    0x1A, 0xFF, 0xFF, 0xA3, 0xAF, 0xC9, 0xFA, 0x7A, 0xF9, 0x0A, 0xF7, 0xAF, 0x91, 0xFC, 0x6A, 0xF9,
+    0x1A, 0xF9, 0x5A, 0xF9, 0x2F, 0xC5, 0xAF, 0x92, 0xAF, 0xA4, 0xAF, 0x93, 0xFC, 0x4A, 0xF9, 0x3A,
+    0xFA, 0x3A, 0xF9, 0x4F, 0xC3, 0xAF, 0x94, 0xAF, 0xC0, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9,
+    0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x9F, 0xC9, 0x99, 0x99, 0x97, 0xFC,
+    0x75, 0xFC, 0x09, 0xCA, 0x71, 0xFC, 0xAE, 0x71, 0xFF, 0x72, 0xFD, 0xA7, 0x3F, 0xC9, 0x73, 0xAF,
+    0xC7, 0x3F, 0xE0, 0x9C, 0xA5, 0xAF, 0xFF, 0x5E, 0x9F, 0xF7, 0xA1, 0xFD, 0xA7, 0x3F, 0xC7, 0x4A,
+    0xFC, 0x72, 0x9F, 0xE7, 0x1A, 0xFF, 0x71, 0xAD, 0x9F, 0xC7, 0x2A, 0x1F, 0xC7, 0x5F, 0xC7, 0x5F,
+    0xC6, 0x77, 0x77, 0x29, 0xAF, 0xFA, 0x97, 0x73, 0xFF, 0xFD, 0x97, 0x71, 0xFF, 0xFE, 0xA7, 0x70,
+    0x9F, 0xFF, 0xEA, 0x77, 0x0C, 0xA9, 0x5A, 0xFD, 0x97, 0x77, 0x2F, 0xD7, 0x71, 0x9F, 0x93, 0xFC,
+    0x77, 0x1A, 0xF4, 0xAF, 0x97, 0x70, 0xFC, 0x49, 0xFA, 0x77, 0x0F, 0xA5, 0xFA, 0x77, 0x9F, 0x95,
+    0xFC, 0x77, 0xAF, 0x95, 0xFA, 0x77, 0xFC, 0x59, 0xFA, 0x49, 0x99, 0x7F, 0xC5, 0xAF, 0x92, 0xAF,
+    0xD9, 0x4F, 0xA5, 0xFC, 0x2F, 0xFC, 0xA2, 0x9F, 0x94, 0x9F, 0xC1, 0xFC, 0xAF, 0xC2, 0xAF, 0x5F,
+    0xCA, 0x09, 0xF2, 0xAE, 0x91, 0xFC, 0x4A, 0xFC, 0x1F, 0x93, 0xEA, 0x1F, 0xC3, 0xAF, 0xC9, 0x1F,
+    0x4E, 0xA1, 0xFA, 0x1A, 0xFD, 0xA1, 0x9F, 0x39, 0xE9, 0x09, 0xFF, 0xFD, 0x2A, 0xF3, 0xF1, 0xAF,
+    0xFF, 0xA3, 0xFD, 0xAA, 0xFA, 0x1F, 0xFF, 0x94, 0xFF, 0xF2, 0xFF, 0xA9, 0x7F, 0xAF, 0xCA, 0x77,
+    0x49, 0xF1, 0x99, 0x77, 0x7A, 0xEA, 0x77, 0x73, 0xF9, 0x77, 0x73, 0xF7, 0x77, 0x4F, 0x77, 0x73,
+    0x9E, 0xA7, 0x77, 0x3A, 0xEA, 0x77, 0x73, 0xF9, 0x72, 0x77, 0x73, 0xAF, 0xCA, 0x72, 0xFF, 0xC7,
+    0x0F, 0xFD, 0xA6, 0x9F, 0xCA, 0xFC, 0x6A, 0xF9, 0x1F, 0x6F, 0xC2, 0xF9, 0x5F, 0xC2, 0xF9, 0x5A,
+    0xF2, 0xF6, 0xAF, 0x90, 0x9F, 0x69, 0xFC, 0x0A, 0xF7, 0xFC, 0x9F, 0x97, 0x9F, 0xFC, 0x71, 0xFF,
+    0x97, 0x1A, 0xFE, 0x73, 0xFD, 0x79, 0xC2, 0x9F, 0xC7, 0xD9, 0x19, 0xFC, 0xA5, 0x9E, 0x1F, 0xE5,
+    0xF9, 0xAF, 0xEA, 0x3A, 0xFF, 0xAF, 0xC3, 0xFF, 0xA0, 0xFC, 0x91, 0xAE, 0x9F, 0x19, 0xFA, 0x1E,
+    0x1A, 0xD9, 0x2F, 0xC0, 0xAD, 0xA2, 0xD3, 0xFC, 0x79, 0x4A, 0xF9, 0x74, 0x9F, 0x97, 0x49, 0xF9,
+    0x74, 0xFC, 0x97, 0x1F, 0xF7, 0x2F, 0xEA, 0x72, 0xFE, 0x73, 0xFA, 0x92, 0x1A, 0xFE, 0xAA, 0x97,
+    0xFF, 0xF9, 0x5F, 0xFF, 0xCA, 0x4F, 0xFF, 0xD4, 0xFC, 0x3F, 0xCA, 0x19, 0xAF, 0xCA, 0xAA, 0xAA,
+    0xFC, 0xA9, 0xFF, 0xFF, 0xEA, 0xAF, 0xDA, 0xAA, 0xAF, 0xDA, 0x1F, 0xC4, 0xAF, 0x92, 0xFC, 0x4A,
+    0xF9, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x9F, 0xC9, 0x99, 0x9A, 0xFA, 0x92, 0xFC, 0x29, 0xFC,
+    0x93, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0x5F, 0xFE, 0xA6, 0xFC, 0xAA, 0xA9, 0x97, 0x0F, 0xC7, 0x5F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x30, 0x72, 0x99, 0x77, 0x19, 0xDA, 0x76,
+    0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x5F, 0xFF, 0xE4, 0xFF, 0xFE, 0xA3, 0xFF, 0xDA, 0x09, 0xAD,
+    0x3A, 0xFD, 0x09, 0xDA, 0x70, 0xFD, 0x19, 0xDA, 0x79, 0xFC, 0x29, 0xDA, 0x7A, 0xFC, 0x29, 0xDA,
+    0x7F, 0xC9, 0x29, 0xDA, 0x7F, 0xC9, 0x29, 0xDA, 0x99, 0x99, 0x99, 0x1F, 0xC3, 0x9F, 0xFC, 0x90,
+    0xFC, 0x39, 0xFF, 0xC9, 0x0F, 0xC3, 0x9F, 0xFC, 0x90, 0xFC, 0x92, 0x9F, 0xFC, 0x90, 0xFC, 0xA2,
+    0x9D, 0xA0, 0x9F, 0x90, 0xAF, 0xC2, 0x9D, 0xA0, 0x9F, 0x90, 0x9F, 0xC9, 0x19, 0xDA, 0x09, 0xF9,
+    0x1F, 0xD1, 0x9D, 0xA0, 0x9F, 0x91, 0x9F, 0xD9, 0x9D, 0xA0, 0xAF, 0x92, 0xAF, 0xFF, 0xF9, 0x3F,
+    0xFF, 0xF9, 0x4A, 0xFF, 0xFD, 0x96, 0xAF, 0xFD, 0xA9, 0x72, 0xAD, 0xA7, 0x70, 0x9D, 0xA7, 0x70,
+    0x9A, 0xA9, 0x60, 0x7F, 0xCA, 0x76, 0x9F, 0xD7, 0x6A, 0xFD, 0x97, 0x5F, 0xEA, 0x74, 0x9F, 0xF7,
+    0x4A, 0xEA, 0xF9, 0x73, 0xF9, 0xAE, 0xA7, 0x29, 0xF0, 0x9F, 0x72, 0xFC, 0x1F, 0x94, 0xAF, 0xFF,
+    0xFF, 0x9A, 0xFF, 0xFF, 0xF9, 0x9A, 0xAA, 0xFC, 0xAA, 0xAA, 0xFC, 0xAA, 0xA4, 0xFA, 0x3F, 0xA6,
+    0x9F, 0x93, 0xAF, 0x3A, 0xFF, 0xFF, 0xF9, 0xAF, 0xFF, 0xFF, 0x99, 0x9A, 0xFA, 0x99, 0x99, 0x99,
+    0xFC, 0xA9, 0x2F, 0xC6, 0x9F, 0x93, 0xFC, 0x7F, 0xC2, 0x9F, 0x97, 0xFC, 0x2F, 0xC7, 0x09, 0xF9,
+    0x1F, 0xC7, 0x1F, 0xC0, 0x9F, 0xA7, 0x1F, 0xC0, 0xFC, 0x72, 0xAF, 0x90, 0x77, 0x69, 0xAF, 0xE9,
+    0x6A, 0xFF, 0xF5, 0xAF, 0xFF, 0xC5, 0xFF, 0xFC, 0xA4, 0xE9, 0x92, 0xAF, 0xC7, 0x5F, 0xC7, 0x5A,
+    0xF9, 0x74, 0xFC, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xCA, 0x9A, 0xFF, 0xFF, 0xCA, 0xAF,
+    0xFF, 0xFC, 0xA4, 0xAF, 0xFC, 0x7F, 0xFC, 0x94, 0x9A, 0xAF, 0xFC, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF,
+    0xFF, 0xCA, 0xAF, 0xFF, 0xFC, 0xA1, 0xFC, 0x74, 0x9F, 0xA7, 0x5F, 0xC7, 0x5F, 0xCA, 0x59, 0xD3,
+    0xAF, 0xFF, 0xD4, 0xFF, 0xFD, 0x49, 0xFF, 0xFC, 0x6A, 0xFF, 0xC9, 0x72, 0x99, 0x99, 0x60, 0x72,
+    0x99, 0x77, 0x09, 0xDA, 0x74, 0x9A, 0xFD, 0xA9, 0x70, 0xFF, 0xFA, 0x49, 0xFF, 0xFC, 0xA3, 0x9F,
+    0xFF, 0xD9, 0x3F, 0xDA, 0xAD, 0xA9, 0xE3, 0xAF, 0xC9, 0x09, 0xDA, 0x29, 0x3F, 0xCA, 0x19, 0xDA,
+    0x69, 0xFC, 0x29, 0xDA, 0x6A, 0xFA, 0x29, 0xDA, 0x6F, 0xC9, 0x29, 0xDA, 0x6F, 0xC9, 0x29, 0xDA,
+    0x6F, 0xC3, 0x9D, 0xA6, 0xFC, 0x39, 0xDA, 0x6F, 0xC3, 0x9D, 0xA6, 0xFC, 0x92, 0x9D, 0xA6, 0xFC,
+    0xA2, 0x9D, 0xA6, 0xAF, 0xC2, 0x9D, 0xA6, 0x9F, 0xC2, 0x9D, 0xA7, 0xFD, 0x19, 0xDA, 0x79, 0xFD,
+    0x99, 0xDA, 0x09, 0xAC, 0x4F, 0xFF, 0xE5, 0xFF, 0xFD, 0x6A, 0xFF, 0xF7, 0x9A, 0xFF, 0xA9, 0x73,
+    0xAD, 0xA7, 0x79, 0xDA, 0x77, 0x9A, 0xA9, 0x50, 0x77, 0x72, 0x9E, 0x4A, 0xE7, 0x1A, 0xE4, 0xF7,
+    0x1F, 0x39, 0xF7, 0x09, 0xF9, 0x2A, 0xF7, 0xAF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xFC, 0x1A, 0xAF, 0xCA, 0xAA, 0xAF, 0xCA, 0xAA, 0xAA, 0x3F, 0xC3, 0xFC, 0x70, 0xFC, 0x3F, 0xC7,
+    0x0F, 0xC3, 0xFC, 0x70, 0xFC, 0x3F, 0xC7, 0x0F, 0xC3, 0xFC, 0x70, 0xFC, 0x3F, 0xC7, 0x0F, 0xC3,
+    0xFC, 0x70, 0xFC, 0x3F, 0xC7, 0x0F, 0xC3, 0xFC, 0x70, 0xFC, 0x3F, 0xC7, 0x0F, 0xC3, 0xFD, 0xAA,
+    0xD3, 0xFC, 0x3A, 0xFF, 0xC3, 0xFC, 0x4F, 0xFC, 0x3F, 0xC5, 0xAF, 0xDA, 0x77, 0x09, 0x99, 0x30,
+    0x77, 0x77, 0x29, 0xAF, 0xDA, 0x97, 0x4A, 0xFF, 0xEA, 0x71, 0xFF, 0xFC, 0xA7, 0x09, 0xFF, 0xFC,
+    0x71, 0xFD, 0x39, 0xDA, 0x71, 0xFC, 0x77, 0x2F, 0xC7, 0x72, 0xFC, 0x77, 0x2F, 0xD7, 0x71, 0xAF,
+    0xDA, 0x77, 0x0F, 0xFA, 0x77, 0xFF, 0xC9, 0x76, 0xAF, 0xFC, 0x76, 0x9F, 0xFC, 0x77, 0x0A, 0xFD,
+    0x97, 0x70, 0x9F, 0xD2, 0xAA, 0x91, 0xAA, 0xA9, 0x09, 0xAA, 0xA1, 0xFC, 0x1F, 0xAF, 0xCA, 0xFC,
+    0x09, 0xF0, 0x9C, 0xAA, 0xE9, 0x9E, 0xA0, 0xAD, 0x09, 0xF1, 0xCA, 0x9D, 0x91, 0xAD, 0x2D, 0x99,
+    0xEA, 0x1A, 0xF9, 0x1A, 0xD2, 0xDA, 0xF9, 0x2A, 0xFC, 0xAE, 0x19, 0xFD, 0xA4, 0x9F, 0xFF, 0xFA,
+    0x6D, 0xAA, 0xFF, 0xDA, 0x70, 0xD9, 0x1A, 0xD9, 0x99, 0xD9, 0x71, 0xD9, 0x1A, 0xD2, 0xD9, 0x71,
+    0xAA, 0x29, 0xA9, 0x2A, 0xA6, 0x0F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x99,
+    0xFF, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x69, 0xFF,
+    0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x96, 0xFC, 0x75, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC,
+    0x75, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x60, 0xAF, 0xFF, 0xD0, 0xFF, 0xFE, 0x0A, 0xAA, 0xAF, 0xDA,
+    0xAA, 0xAA, 0x5A, 0xFA, 0x72, 0xFC, 0x49, 0x99, 0x99, 0x9A, 0xFA, 0x99, 0x90, 0xFF, 0xFE, 0x0F,
+    0xFF, 0xE6, 0xAF, 0x97, 0x1F, 0xC7, 0x09, 0xFC, 0xA4, 0xFF, 0xD5, 0xFF, 0xA6, 0xFD, 0xA7, 0x09,
+    0xFC, 0x72, 0xAF, 0xA7, 0x2F, 0xC9, 0x71, 0xAF, 0xC7, 0x2F, 0xCA, 0x71, 0x9F, 0xC7, 0x2F, 0xD7,
+    0x19, 0xFC, 0x97, 0x1A, 0xFC, 0x72, 0xFD, 0x30, 0x29, 0xF7, 0x5A, 0xF9, 0x74, 0xAF, 0x97, 0x4A,
+    0xF9, 0x0A, 0xD9, 0x7A, 0xFF, 0xC9, 0x7A, 0xFF, 0xA6, 0x9F, 0xEA, 0x97, 0xFF, 0x97, 0x1F, 0xF9,
+    0x0A, 0xD9, 0x4A, 0x90, 0xAF, 0xFC, 0x97, 0xAF, 0xFA, 0x69, 0xFE, 0xA9, 0x7F, 0xF9, 0x4A, 0xAA,
+    0xA0, 0xFF, 0x93, 0x9F, 0x0A, 0x90, 0xAF, 0x93, 0x9F, 0x3A, 0xF9, 0x3A, 0xF3, 0xAF, 0x93, 0xFA,
+    0x3A, 0xF9, 0x29, 0xF9, 0x3A, 0xF9, 0x2F, 0xC4, 0xAF, 0x90, 0x9F, 0xC9, 0x4A, 0xFF, 0xF5, 0xAF,
+    0xFE, 0x6A, 0xFF, 0xCA, 0x7A, 0xFE, 0xA7, 0x39, 0x99, 0x72, 0x77, 0x74, 0x9F, 0xA7, 0x73, 0xAD,
+    0xAA, 0xE7, 0x72, 0xD2, 0xAD, 0x97, 0x70, 0xAC, 0xA3, 0xE7, 0x70, 0xAD, 0x3E, 0x77, 0x0A, 0xEA,
+    0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x94, 0x9F, 0xFF, 0xFF, 0xDA, 0x3F, 0xFF, 0xFF, 0xF3,
+    0xFF, 0xFF, 0xFE, 0xA3, 0x9A, 0xFF, 0xFF, 0xFC, 0x7E, 0x73, 0x9E, 0x96, 0xE3, 0x97, 0x0D, 0x96,
+    0xE1, 0x9D, 0x90, 0x9C, 0xA3, 0xD9, 0x6E, 0x0A, 0xFA, 0xEA, 0x2D, 0x7F, 0xDA, 0xFF, 0x9E, 0x7F,
+    0xC1, 0x9E, 0x9A, 0xFC, 0x97, 0xF3, 0x9C, 0x29, 0xAC, 0xA7, 0x0F, 0xC7, 0x73, 0x9F, 0xE7, 0x72,
+    0x9D, 0x0A, 0xFA, 0x93, 0x9A, 0x97, 0x5F, 0xFF, 0xA7, 0x59, 0xFF, 0xEA, 0x77, 0xFF, 0xDA, 0x77,
+    0x09, 0xFF, 0x97, 0x74, 0x99, 0x70, 0x72, 0xAE, 0xA7, 0x75, 0xAF, 0x77, 0x5A, 0xF7, 0x75, 0xAF,
+    0x77, 0x5A, 0xF7, 0x75, 0xAF, 0x77, 0x49, 0xFC, 0x97, 0x79, 0xAF, 0xFF, 0xA7, 0x2F, 0xFF, 0xFC,
+    0xA6, 0x9F, 0xFF, 0xFE, 0xA5, 0xFF, 0xFF, 0xFC, 0xA3, 0xFD, 0x91, 0xAF, 0x2A, 0xFC, 0x29, 0xFC,
+    0x3A, 0xF3, 0xAF, 0xA1, 0xAF, 0x4A, 0xF4, 0xFC, 0x1F, 0xC4, 0xAF, 0x4A, 0xF1, 0xFA, 0x4A, 0xF4,
+    0x9F, 0x90, 0xFA, 0x4A, 0xF4, 0x9F, 0x99, 0xF9, 0x4A, 0xF4, 0x9F, 0x99, 0xF9, 0x59, 0x99, 0x94,
+    0x9F, 0x99, 0xF9, 0x76, 0x9F, 0x99, 0xF9, 0x76, 0x9F, 0x99, 0xF9, 0x76, 0x9F, 0x99, 0xF9, 0x76,
+    0x9F, 0x99, 0xF9, 0x76, 0x9F, 0x90, 0x2F, 0xFC, 0xAA, 0x97, 0xFF, 0xFC, 0xA5, 0xFF, 0xFD, 0xA4,
+    0xFF, 0xFE, 0x93, 0xFC, 0x99, 0x99, 0xAF, 0xD3, 0xFC, 0x49, 0xFC, 0x92, 0xFC, 0x5F, 0xC9, 0x2F,
+    0xC5, 0xAF, 0x92, 0xFC, 0x5F, 0xC9, 0x2F, 0xC4, 0xAF, 0xC0, 0x9A, 0xAF, 0xCA, 0xAA, 0xAF, 0xDA,
+    0x0A, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF, 0xF9, 0x1A, 0xFF, 0xFD, 0xA3, 0x9A, 0xAF, 0xCA, 0xAA, 0xA9,
+    0x97, 0x0F, 0xC7, 0x6F, 0xC7, 0x3A, 0xFF, 0xF6, 0xAF, 0xFF, 0x6A, 0xFF, 0xF6, 0x99, 0x9F, 0xC9,
+    0x99, 0x99, 0x71, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x73, 0x70, 0xAA, 0x1A, 0xA9, 0x77, 0x0D, 0x90,
+    0xDA, 0x77, 0x9D, 0xAA, 0xDA, 0x75, 0x9F, 0xFD, 0xA7, 0x2F, 0xFF, 0xD9, 0x7F, 0xFF, 0xFA, 0x5F,
+    0xF9, 0x0F, 0xF9, 0x3A, 0xFC, 0x9D, 0x90, 0xDA, 0xAF, 0xC3, 0xFC, 0x1D, 0x90, 0xDA, 0x0F, 0xCA,
+    0x1A, 0xFA, 0x1D, 0x90, 0xDA, 0x09, 0xFC, 0x1F, 0xC9, 0x1D, 0x90, 0xDA, 0x1F, 0xC1, 0xFC, 0x2D,
+    0x90, 0xDA, 0x1F, 0xC9, 0x0F, 0xC2, 0xD9, 0x0D, 0xA1, 0xAF, 0x90, 0xFC, 0x2D, 0x90, 0xDA, 0x1A,
+    0xFA, 0x0F, 0xC2, 0x99, 0x19, 0x93, 0x99, 0x99, 0x1F, 0xC7, 0x72, 0xAF, 0x97, 0x71, 0x9F, 0xA7,
+    0x72, 0xFC, 0x77, 0x29, 0xFC, 0x77, 0x2A, 0xFC, 0x77, 0x29, 0xFC, 0xA9, 0x75, 0x9A, 0xFF, 0xFF,
+    0xD3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0x77, 0x1A, 0xCA, 0x1D, 0x7A, 0xCA,
+    0x1D, 0x7A, 0xCA, 0x1D, 0x4F, 0xFD, 0x93, 0xFF, 0xF2, 0xFF, 0xFC, 0x90, 0xFF, 0xFD, 0x0F, 0xC9,
+    0x9A, 0xFD, 0x0F, 0xC3, 0xFC, 0x9F, 0xC3, 0xFC, 0x9F, 0xC3, 0xFC, 0x9F, 0xC3, 0xFC, 0x0F, 0xC9,
+    0x99, 0xFC, 0xA0, 0xFF, 0xFC, 0x1F, 0xFF, 0x2F, 0xFF, 0xC9, 0x0F, 0xCA, 0xAA, 0xFD, 0x0F, 0xC3,
+    0xFC, 0xAF, 0xC3, 0x9F, 0xFD, 0x39, 0xFF, 0xD3, 0x9F, 0xFD, 0x3A, 0xFF, 0xD2, 0xAF, 0xCA, 0xFF,
+    0xFD, 0x0F, 0xFF, 0xCA, 0x0F, 0xFF, 0x91, 0xFF, 0xDA, 0x6A, 0xCA, 0x1D, 0x7A, 0xCA, 0x1D, 0x7A,
+    0xCA, 0x1D, 0x70, 0x92, 0x99, 0x40, 0x69, 0x9A, 0x99, 0x79, 0xFF, 0xCA, 0x3A, 0xFF, 0xE2, 0xAF,
+    0xFE, 0x91, 0x9F, 0xDA, 0xAA, 0xE2, 0xFD, 0x59, 0x2F, 0xC7, 0x19, 0xFC, 0x71, 0xAF, 0xA7, 0x1A,
+    0xFA, 0x71, 0xAF, 0xA7, 0x1A, 0xFA, 0x71, 0x9F, 0xC7, 0x2F, 0xC9, 0x71, 0xFD, 0x94, 0xAA, 0x19,
+    0xFE, 0xAF, 0xA2, 0xAF, 0xFE, 0xA3, 0xAF, 0xFD, 0xA4, 0x9A, 0xFE, 0xA7, 0x19, 0x99, 0x77, 0x59,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xFE, 0xA9, 0xFF, 0xFE, 0xA9, 0xFF,
+    0xFE, 0xA7, 0x70, 0x77, 0x77, 0x75, 0xC9, 0x77, 0x73, 0xE9, 0x77, 0x71, 0xFC, 0x97, 0x77, 0xFE,
+    0x97, 0x75, 0xFF, 0xC9, 0x77, 0x3F, 0xFE, 0x97, 0x71, 0xEA, 0x92, 0x9A, 0xE9, 0x77, 0xDA, 0x70,
+    0xE9, 0x75, 0xEA, 0x71, 0xE9, 0x73, 0xFC, 0x19, 0xAA, 0xA3, 0xF9, 0x71, 0xFD, 0xAF, 0xC9, 0x2A,
+    0xF9, 0x7F, 0xFF, 0xCA, 0x2A, 0xFC, 0x95, 0xFF, 0xFD, 0x3F, 0xE9, 0x3F, 0xFF, 0xD3, 0x9F, 0xF9,
+    0x1F, 0xFF, 0xD3, 0x9F, 0xFD, 0x90, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x1F, 0xFE, 0xA2, 0xAF, 0xFE,
+    0x93, 0xFF, 0xD9, 0x2F, 0xFE, 0x95, 0xFF, 0xC9, 0x19, 0xFF, 0xD9, 0x7F, 0xFF, 0xFF, 0xC9, 0x71,
+    0xFF, 0xFF, 0xE9, 0x73, 0xFE, 0x99, 0xAF, 0xE9, 0x75, 0xFC, 0x3F, 0xD9, 0x77, 0xF3, 0xAF, 0x97,
+    0x71, 0xE3, 0xF9, 0x77, 0x3E, 0x99, 0xAE, 0x97, 0x75, 0xFE, 0x97, 0x77, 0xFC, 0x97, 0x77, 0x1E,
+    0x97, 0x77, 0x3C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 7, 25, 9, 1, 24, 44, 0 }, // !
-    { 12, 9, 16, 2, 24, 27, 44 }, // "
-    { 21, 24, 22, 0, 24, 126, 71 }, // #
-    { 17, 28, 19, 1, 26, 119, 197 }, // $
-    { 29, 26, 31, 1, 25, 189, 316 }, // %
-    { 24, 26, 26, 1, 25, 156, 505 }, // &
-    { 5, 9, 9, 2, 24, 12, 661 }, // '
-    { 10, 30, 12, 1, 24, 75, 673 }, // (
-    { 9, 30, 11, 1, 24, 68, 748 }, // )
-    { 18, 17, 19, 0, 26, 77, 816 }, // *
-    { 17, 17, 19, 1, 20, 73, 893 }, // +
-    { 7, 9, 10, 1, 4, 16, 966 }, // ,
-    { 10, 5, 11, 0, 11, 13, 982 }, // -
-    { 7, 7, 9, 1, 6, 13, 995 }, // .
-    { 14, 25, 15, 0, 24, 88, 1008 }, // /
-    { 17, 26, 19, 1, 25, 111, 1096 }, // 0
-    { 13, 24, 19, 1, 24, 78, 1207 }, // 1
-    { 17, 25, 19, 1, 25, 107, 1285 }, // 2
-    { 17, 26, 19, 1, 25, 111, 1392 }, // 3
-    { 19, 24, 20, 0, 24, 114, 1503 }, // 4
-    { 17, 25, 19, 1, 24, 107, 1617 }, // 5
-    { 17, 26, 19, 1, 25, 111, 1724 }, // 6
-    { 18, 24, 19, 0, 24, 108, 1835 }, // 7
-    { 17, 26, 19, 1, 25, 111, 1943 }, // 8
-    { 17, 26, 19, 1, 25, 111, 2054 }, // 9
-    { 7, 20, 9, 1, 19, 35, 2165 }, // :
-    { 7, 24, 10, 1, 19, 42, 2200 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2242 }, // <
-    { 17, 11, 19, 1, 17, 47, 2319 }, // =
-    { 17, 18, 19, 1, 21, 77, 2366 }, // >
-    { 16, 26, 17, 0, 25, 104, 2443 }, // ?
-    { 28, 27, 30, 1, 24, 189, 2547 }, // @
-    { 24, 24, 25, 0, 24, 144, 2736 }, // A
-    { 19, 24, 22, 2, 24, 114, 2880 }, // B
-    { 20, 26, 22, 1, 25, 130, 2994 }, // C
-    { 21, 24, 24, 2, 24, 126, 3124 }, // D
-    { 14, 24, 19, 3, 24, 84, 3250 }, // E
-    { 14, 24, 18, 3, 24, 84, 3334 }, // F
-    { 21, 26, 24, 1, 25, 137, 3418 }, // G
-    { 20, 24, 26, 3, 24, 120, 3555 }, // H
-    { 11, 24, 13, 1, 24, 66, 3675 }, // I
-    { 12, 31, 11, -3, 24, 93, 3741 }, // J
-    { 20, 24, 24, 3, 24, 120, 3834 }, // K
-    { 16, 24, 19, 2, 24, 96, 3954 }, // L
-    { 26, 24, 31, 3, 24, 156, 4050 }, // M
-    { 22, 24, 27, 3, 24, 132, 4206 }, // N
-    { 24, 26, 26, 1, 25, 156, 4338 }, // O
-    { 18, 24, 21, 2, 24, 108, 4494 }, // P
-    { 24, 31, 26, 1, 25, 186, 4602 }, // Q
-    { 20, 24, 23, 2, 24, 120, 4788 }, // R
-    { 17, 26, 19, 1, 25, 111, 4908 }, // S
-    { 19, 24, 20, 0, 24, 114, 5019 }, // T
-    { 21, 25, 25, 2, 24, 132, 5133 }, // U
-    { 22, 24, 23, 0, 24, 132, 5265 }, // V
-    { 33, 24, 34, 0, 24, 198, 5397 }, // W
-    { 23, 24, 24, 0, 24, 138, 5595 }, // X
-    { 21, 24, 22, 0, 24, 126, 5733 }, // Y
-    { 19, 24, 20, 0, 24, 114, 5859 }, // Z
-    { 9, 30, 12, 2, 24, 68, 5973 }, // [
-    { 14, 25, 15, 0, 24, 88, 6041 }, // <backslash>
-    { 9, 30, 11, 0, 24, 68, 6129 }, // ]
-    { 19, 16, 20, 0, 24, 76, 6197 }, // ^
-    { 15, 3, 15, -1, -3, 12, 6273 }, // _
-    { 10, 6, 12, 1, 26, 15, 6285 }, // `
-    { 17, 20, 20, 1, 19, 85, 6300 }, // a
-    { 18, 27, 21, 2, 26, 122, 6385 }, // b
-    { 16, 20, 18, 1, 19, 80, 6507 }, // c
-    { 18, 27, 21, 1, 26, 122, 6587 }, // d
-    { 18, 20, 20, 1, 19, 90, 6709 }, // e
-    { 15, 26, 16, 0, 26, 98, 6799 }, // f
-    { 18, 27, 21, 1, 19, 122, 6897 }, // g
-    { 18, 26, 22, 2, 26, 117, 7019 }, // h
-    { 6, 26, 10, 2, 26, 39, 7136 }, // i
-    { 10, 34, 10, -2, 26, 85, 7175 }, // j
-    { 19, 26, 22, 2, 26, 124, 7260 }, // k
-    { 6, 26, 10, 2, 26, 39, 7384 }, // l
-    { 29, 19, 33, 2, 19, 138, 7423 }, // m
-    { 18, 19, 22, 2, 19, 86, 7561 }, // n
-    { 19, 20, 21, 1, 19, 95, 7647 }, // o
-    { 18, 27, 21, 2, 19, 122, 7742 }, // p
-    { 18, 27, 21, 1, 19, 122, 7864 }, // q
-    { 13, 19, 16, 2, 19, 62, 7986 }, // r
-    { 15, 20, 17, 1, 19, 75, 8048 }, // s
-    { 14, 24, 15, 0, 23, 84, 8123 }, // t
-    { 18, 20, 22, 2, 19, 90, 8207 }, // u
-    { 20, 19, 21, 0, 19, 95, 8297 }, // v
-    { 29, 19, 30, 0, 19, 138, 8392 }, // w
-    { 20, 19, 21, 0, 19, 95, 8530 }, // x
-    { 20, 27, 21, 0, 19, 135, 8625 }, // y
-    { 15, 19, 17, 1, 19, 72, 8760 }, // z
-    { 12, 30, 13, 0, 24, 90, 8832 }, // {
-    { 4, 34, 18, 7, 26, 34, 8922 }, // |
-    { 12, 30, 14, 1, 24, 90, 8956 }, // }
-    { 17, 7, 19, 1, 15, 30, 9046 }, // ~
-    { 0, 0, 9, 0, 0, 0, 9076 }, //  
-    { 7, 25, 10, 1, 19, 44, 9076 }, // ¡
-    { 15, 26, 19, 2, 25, 98, 9120 }, // ¢
-    { 18, 25, 20, 1, 25, 113, 9218 }, // £
-    { 17, 16, 19, 1, 20, 68, 9331 }, // ¤
-    { 19, 24, 20, 0, 24, 114, 9399 }, // ¥
-    { 4, 34, 18, 7, 26, 34, 9513 }, // ¦
-    { 14, 27, 16, 1, 26, 95, 9547 }, // §
-    { 12, 6, 20, 4, 26, 18, 9642 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 9660 }, // ©
-    { 12, 13, 13, 0, 25, 39, 9829 }, // ª
-    { 19, 16, 21, 1, 17, 76, 9868 }, // «
-    { 17, 10, 19, 1, 14, 43, 9944 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 9987 }, // ­
-    { 26, 26, 28, 1, 25, 169, 10000 }, // ®
-    { 18, 4, 18, -1, 29, 18, 10169 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 10187 }, // °
-    { 17, 21, 19, 1, 21, 90, 10226 }, // ±
-    { 12, 16, 13, 0, 29, 48, 10316 }, // ²
-    { 12, 16, 13, 0, 29, 48, 10364 }, // ³
-    { 10, 6, 12, 1, 26, 15, 10412 }, // ´
-    { 18, 27, 22, 2, 19, 122, 10427 }, // µ
-    { 18, 31, 22, 1, 26, 140, 10549 }, // ¶
-    { 7, 7, 9, 1, 15, 13, 10689 }, // ·
-    { 9, 8, 10, 0, 0, 18, 10702 }, // ¸
-    { 9, 16, 13, 1, 29, 36, 10720 }, // ¹
-    { 12, 13, 13, 0, 25, 39, 10756 }, // º
-    { 19, 16, 21, 1, 17, 76, 10795 }, // »
-    { 28, 24, 29, 0, 24, 168, 10871 }, // ¼
-    { 28, 24, 29, 0, 24, 168, 11039 }, // ½
-    { 27, 25, 29, 1, 25, 169, 11207 }, // ¾
-    { 16, 25, 17, 0, 19, 100, 11376 }, // ¿
-    { 24, 32, 25, 0, 32, 192, 11476 }, // À
-    { 24, 32, 25, 0, 32, 192, 11668 }, // Á
-    { 24, 32, 25, 0, 32, 192, 11860 }, // Â
-    { 24, 32, 25, 0, 32, 192, 12052 }, // Ã
-    { 24, 32, 25, 0, 32, 192, 12244 }, // Ä
-    { 24, 29, 25, 0, 29, 174, 12436 }, // Å
-    { 30, 24, 32, 0, 24, 180, 12610 }, // Æ
-    { 20, 33, 22, 1, 25, 165, 12790 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 12955 }, // È
-    { 14, 32, 19, 3, 32, 112, 13067 }, // É
-    { 14, 32, 19, 3, 32, 112, 13179 }, // Ê
-    { 14, 32, 19, 3, 32, 112, 13291 }, // Ë
-    { 12, 32, 13, 0, 32, 96, 13403 }, // Ì
-    { 12, 32, 14, 1, 32, 96, 13499 }, // Í
-    { 15, 32, 15, -1, 32, 120, 13595 }, // Î
-    { 13, 32, 14, 0, 32, 104, 13715 }, // Ï
-    { 23, 24, 24, 0, 24, 138, 13819 }, // Ð
-    { 22, 32, 27, 3, 32, 176, 13957 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 14133 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 14331 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 14529 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 14727 }, // Õ
-    { 24, 33, 26, 1, 32, 198, 14925 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 15123 }, // ×
-    { 24, 28, 26, 1, 26, 168, 15183 }, // Ø
-    { 21, 33, 25, 2, 32, 174, 15351 }, // Ù
-    { 21, 33, 25, 2, 32, 174, 15525 }, // Ú
-    { 21, 33, 25, 2, 32, 174, 15699 }, // Û
-    { 21, 33, 25, 2, 32, 174, 15873 }, // Ü
-    { 21, 32, 22, 0, 32, 168, 16047 }, // Ý
-    { 17, 24, 21, 3, 24, 102, 16215 }, // Þ
-    { 21, 27, 24, 2, 26, 142, 16317 }, // ß
-    { 17, 27, 20, 1, 26, 115, 16459 }, // à
-    { 17, 27, 20, 1, 26, 115, 16574 }, // á
-    { 17, 27, 20, 1, 26, 115, 16689 }, // â
-    { 17, 27, 20, 1, 26, 115, 16804 }, // ã
-    { 17, 27, 20, 1, 26, 115, 16919 }, // ä
-    { 17, 29, 20, 1, 28, 124, 17034 }, // å
-    { 29, 20, 31, 1, 19, 145, 17158 }, // æ
-    { 16, 27, 18, 1, 19, 108, 17303 }, // ç
-    { 18, 27, 20, 1, 26, 122, 17411 }, // è
-    { 18, 27, 20, 1, 26, 122, 17533 }, // é
-    { 18, 27, 20, 1, 26, 122, 17655 }, // ê
-    { 18, 27, 20, 1, 26, 122, 17777 }, // ë
-    { 11, 26, 11, -1, 26, 72, 17899 }, // ì
-    { 10, 26, 13, 2, 26, 65, 17971 }, // í
-    { 14, 26, 13, -2, 26, 91, 18036 }, // î
-    { 12, 26, 12, -1, 26, 78, 18127 }, // ï
-    { 19, 27, 21, 1, 26, 129, 18205 }, // ð
-    { 18, 26, 22, 2, 26, 117, 18334 }, // ñ
-    { 19, 27, 21, 1, 26, 129, 18451 }, // ò
-    { 19, 27, 21, 1, 26, 129, 18580 }, // ó
-    { 19, 27, 21, 1, 26, 129, 18709 }, // ô
-    { 19, 27, 21, 1, 26, 129, 18838 }, // õ
-    { 19, 27, 21, 1, 26, 129, 18967 }, // ö
-    { 17, 17, 19, 1, 20, 73, 19096 }, // ÷
-    { 19, 22, 21, 1, 20, 105, 19169 }, // ø
-    { 18, 27, 22, 2, 26, 122, 19274 }, // ù
-    { 18, 27, 22, 2, 26, 122, 19396 }, // ú
-    { 18, 27, 22, 2, 26, 122, 19518 }, // û
-    { 18, 27, 22, 2, 26, 122, 19640 }, // ü
-    { 20, 34, 21, 0, 26, 170, 19762 }, // ý
-    { 18, 34, 21, 2, 26, 153, 19932 }, // þ
-    { 20, 34, 21, 0, 26, 170, 20085 }, // ÿ
-    { 24, 30, 25, 0, 30, 180, 20255 }, // Ā
-    { 17, 25, 20, 1, 24, 107, 20435 }, // ā
-    { 24, 32, 25, 0, 32, 192, 20542 }, // Ă
-    { 17, 27, 20, 1, 26, 115, 20734 }, // ă
-    { 24, 32, 25, 0, 24, 192, 20849 }, // Ą
-    { 17, 27, 20, 1, 19, 115, 21041 }, // ą
-    { 20, 33, 22, 1, 32, 165, 21156 }, // Ć
-    { 16, 27, 18, 1, 26, 108, 21321 }, // ć
-    { 20, 33, 22, 1, 32, 165, 21429 }, // Ĉ
-    { 16, 27, 18, 1, 26, 108, 21594 }, // ĉ
-    { 20, 33, 22, 1, 32, 165, 21702 }, // Ċ
-    { 16, 27, 18, 1, 26, 108, 21867 }, // ċ
-    { 20, 33, 22, 1, 32, 165, 21975 }, // Č
-    { 17, 27, 19, 1, 26, 115, 22140 }, // č
-    { 21, 32, 24, 2, 32, 168, 22255 }, // Ď
-    { 25, 27, 27, 1, 26, 169, 22423 }, // ď
-    { 23, 24, 24, 0, 24, 138, 22592 }, // Đ
-    { 21, 27, 23, 1, 26, 142, 22730 }, // đ
-    { 14, 30, 19, 3, 30, 105, 22872 }, // Ē
-    { 18, 25, 20, 1, 24, 113, 22977 }, // ē
-    { 14, 32, 19, 3, 32, 112, 23090 }, // Ĕ
-    { 18, 27, 20, 1, 26, 122, 23202 }, // ĕ
-    { 14, 32, 19, 3, 32, 112, 23324 }, // Ė
-    { 18, 27, 20, 1, 26, 122, 23436 }, // ė
-    { 14, 32, 19, 3, 24, 112, 23558 }, // Ę
-    { 18, 27, 20, 1, 19, 122, 23670 }, // ę
-    { 15, 32, 19, 3, 32, 120, 23792 }, // Ě
-    { 18, 27, 20, 1, 26, 122, 23912 }, // ě
-    { 21, 33, 24, 1, 32, 174, 24034 }, // Ĝ
-    { 18, 34, 21, 1, 26, 153, 24208 }, // ĝ
-    { 21, 33, 24, 1, 32, 174, 24361 }, // Ğ
-    { 18, 34, 21, 1, 26, 153, 24535 }, // ğ
-    { 21, 33, 24, 1, 32, 174, 24688 }, // Ġ
-    { 18, 34, 21, 1, 26, 153, 24862 }, // ġ
-    { 21, 33, 24, 1, 25, 174, 25015 }, // Ģ
-    { 18, 34, 21, 1, 26, 153, 25189 }, // ģ
-    { 20, 32, 26, 3, 32, 160, 25342 }, // Ĥ
-    { 22, 33, 22, -2, 33, 182, 25502 }, // ĥ
-    { 26, 24, 27, 0, 24, 156, 25684 }, // Ħ
-    { 20, 26, 22, 0, 26, 130, 25840 }, // ħ
-    { 15, 32, 14, -2, 32, 120, 25970 }, // Ĩ
-    { 14, 26, 13, -2, 26, 91, 26090 }, // ĩ
-    { 12, 30, 13, 0, 30, 90, 26181 }, // Ī
-    { 12, 24, 12, -1, 24, 72, 26271 }, // ī
-    { 14, 32, 15, 0, 32, 112, 26343 }, // Ĭ
-    { 14, 26, 13, -2, 26, 91, 26455 }, // ĭ
-    { 11, 32, 13, 1, 24, 88, 26546 }, // Į
-    { 7, 34, 10, 1, 26, 60, 26634 }, // į
-    { 11, 32, 13, 1, 32, 88, 26694 }, // İ
-    { 6, 19, 10, 2, 19, 29, 26782 }, // ı
-    { 21, 31, 24, 1, 24, 163, 26811 }, // Ĳ
-    { 16, 34, 20, 2, 26, 136, 26974 }, // ĳ
-    { 16, 39, 14, -3, 32, 156, 27110 }, // Ĵ
-    { 14, 34, 13, -2, 26, 119, 27266 }, // ĵ
-    { 20, 32, 24, 3, 24, 160, 27385 }, // Ķ
-    { 19, 34, 22, 2, 26, 162, 27545 }, // ķ
-    { 19, 19, 22, 2, 19, 91, 27707 }, // ĸ
-    { 16, 32, 19, 2, 32, 128, 27798 }, // Ĺ
-    { 10, 33, 13, 2, 33, 83, 27926 }, // ĺ
-    { 16, 32, 19, 2, 24, 128, 28009 }, // Ļ
-    { 6, 34, 10, 2, 26, 51, 28137 }, // ļ
-    { 17, 24, 20, 2, 24, 102, 28188 }, // Ľ
-    { 13, 26, 16, 2, 26, 85, 28290 }, // ľ
-    { 16, 24, 19, 2, 24, 96, 28375 }, // Ŀ
-    { 12, 26, 15, 2, 26, 78, 28471 }, // ŀ
-    { 18, 24, 19, 0, 24, 108, 28549 }, // Ł
-    { 12, 26, 12, -1, 26, 78, 28657 }, // ł
-    { 22, 32, 27, 3, 32, 176, 28735 }, // Ń
-    { 18, 26, 22, 2, 26, 117, 28911 }, // ń
-    { 22, 32, 27, 3, 24, 176, 29028 }, // Ņ
-    { 18, 27, 22, 2, 19, 122, 29204 }, // ņ
-    { 22, 32, 27, 3, 32, 176, 29326 }, // Ň
-    { 18, 26, 22, 2, 26, 117, 29502 }, // ň
-    { 25, 24, 26, -1, 24, 150, 29619 }, // ŉ
-    { 22, 31, 27, 3, 24, 171, 29769 }, // Ŋ
-    { 18, 27, 22, 2, 19, 122, 29940 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 30062 }, // Ō
-    { 19, 25, 21, 1, 24, 119, 30248 }, // ō
-    { 24, 33, 26, 1, 32, 198, 30367 }, // Ŏ
-    { 19, 27, 21, 1, 26, 129, 30565 }, // ŏ
-    { 24, 33, 26, 1, 32, 198, 30694 }, // Ő
-    { 19, 27, 21, 1, 26, 129, 30892 }, // ő
-    { 30, 26, 32, 1, 25, 195, 31021 }, // Œ
-    { 31, 20, 33, 1, 19, 155, 31216 }, // œ
-    { 20, 32, 23, 2, 32, 160, 31371 }, // Ŕ
-    { 14, 26, 17, 2, 26, 91, 31531 }, // ŕ
-    { 20, 32, 23, 2, 24, 160, 31622 }, // Ŗ
-    { 13, 27, 16, 2, 19, 88, 31782 }, // ŗ
-    { 20, 32, 23, 2, 32, 160, 31870 }, // Ř
-    { 15, 26, 17, 1, 26, 98, 32030 }, // ř
-    { 17, 33, 19, 1, 32, 141, 32128 }, // Ś
-    { 15, 27, 17, 1, 26, 102, 32269 }, // ś
-    { 17, 33, 19, 1, 32, 141, 32371 }, // Ŝ
-    { 15, 27, 17, 1, 26, 102, 32512 }, // ŝ
-    { 17, 33, 19, 1, 25, 141, 32614 }, // Ş
-    { 15, 27, 17, 1, 19, 102, 32755 }, // ş
-    { 17, 33, 19, 1, 32, 141, 32857 }, // Š
-    { 15, 27, 17, 1, 26, 102, 32998 }, // š
-    { 19, 32, 20, 0, 24, 152, 33100 }, // Ţ
-    { 14, 31, 15, 0, 23, 109, 33252 }, // ţ
-    { 19, 32, 20, 0, 32, 152, 33361 }, // Ť
-    { 19, 27, 20, 0, 26, 129, 33513 }, // ť
-    { 19, 24, 20, 0, 24, 114, 33642 }, // Ŧ
-    { 14, 24, 15, 0, 23, 84, 33756 }, // ŧ
-    { 21, 33, 25, 2, 32, 174, 33840 }, // Ũ
-    { 18, 27, 22, 2, 26, 122, 34014 }, // ũ
-    { 21, 31, 25, 2, 30, 163, 34136 }, // Ū
-    { 18, 25, 22, 2, 24, 113, 34299 }, // ū
-    { 21, 33, 25, 2, 32, 174, 34412 }, // Ŭ
-    { 18, 27, 22, 2, 26, 122, 34586 }, // ŭ
-    { 21, 35, 25, 2, 34, 184, 34708 }, // Ů
-    { 18, 29, 22, 2, 28, 131, 34892 }, // ů
-    { 21, 33, 25, 2, 32, 174, 35023 }, // Ű
-    { 18, 27, 22, 2, 26, 122, 35197 }, // ű
-    { 21, 32, 25, 2, 24, 168, 35319 }, // Ų
-    { 18, 27, 22, 2, 19, 122, 35487 }, // ų
-    { 33, 32, 34, 0, 32, 264, 35609 }, // Ŵ
-    { 29, 26, 30, 0, 26, 189, 35873 }, // ŵ
-    { 21, 32, 22, 0, 32, 168, 36062 }, // Ŷ
-    { 20, 34, 21, 0, 26, 170, 36230 }, // ŷ
-    { 21, 32, 22, 0, 32, 168, 36400 }, // Ÿ
-    { 19, 32, 20, 0, 32, 152, 36568 }, // Ź
-    { 15, 26, 17, 1, 26, 98, 36720 }, // ź
-    { 19, 32, 20, 0, 32, 152, 36818 }, // Ż
-    { 15, 26, 17, 1, 26, 98, 36970 }, // ż
-    { 19, 32, 20, 0, 32, 152, 37068 }, // Ž
-    { 15, 26, 17, 1, 26, 98, 37220 }, // ž
-    { 12, 26, 15, 2, 26, 78, 37318 }, // ſ
-    { 28, 27, 30, 1, 26, 189, 37396 }, // Ơ
-    { 23, 22, 25, 1, 21, 127, 37585 }, // ơ
-    { 34, 26, 38, 1, 25, 221, 37712 }, // Ƣ
-    { 28, 27, 31, 1, 19, 189, 37933 }, // ƣ
-    { 24, 24, 25, 0, 24, 144, 38122 }, // Ƥ
-    { 18, 34, 21, 2, 26, 153, 38266 }, // ƥ
-    { 20, 28, 24, 3, 24, 140, 38419 }, // Ʀ
-    { 16, 26, 18, 1, 25, 104, 38559 }, // Ƨ
-    { 15, 20, 17, 1, 19, 75, 38663 }, // ƨ
-    { 19, 24, 20, 0, 24, 114, 38738 }, // Ʃ
-    { 17, 34, 17, -1, 26, 145, 38852 }, // ƪ
-    { 14, 31, 15, 0, 23, 109, 38997 }, // ƫ
-    { 20, 24, 21, 0, 24, 120, 39106 }, // Ƭ
-    { 14, 27, 15, 0, 26, 95, 39226 }, // ƭ
-    { 19, 32, 20, 0, 24, 152, 39321 }, // Ʈ
-    { 28, 27, 31, 2, 26, 189, 39473 }, // Ư
-    { 25, 22, 28, 2, 21, 138, 39662 }, // ư
-    { 10, 6, 0, -18, 26, 15, 39800 }, // ̀
-    { 11, 6, 0, -13, 26, 17, 39815 }, // ́
-    { 14, 6, 8, -7, 26, 21, 39832 }, // ̂
-    { 15, 6, 0, -19, 26, 23, 39853 }, // ̃
-    { 12, 4, 7, -6, 24, 12, 39876 }, // ̄
-    { 14, 5, 8, -7, 29, 18, 39888 }, // ̅
-    { 14, 6, 8, -7, 26, 21, 39906 }, // ̆
-    { 6, 6, 4, -3, 26, 9, 39927 }, // ̇
-    { 12, 6, 7, -6, 26, 18, 39936 }, // ̈
-    { 8, 9, 0, -14, 28, 18, 39954 }, // ̉
-    { 9, 8, 5, -5, 28, 18, 39972 }, // ̊
-    { 16, 6, 11, -6, 26, 24, 39990 }, // ̋
-    { 15, 6, 9, -7, 26, 23, 40014 }, // ̌
-    { 4, 7, 3, -2, 26, 7, 40037 }, // ̍
-    { 10, 7, 6, -5, 26, 18, 40044 }, // ̎
-    { 14, 6, 0, -19, 26, 21, 40062 }, // ̏
-    { 12, 9, 7, -6, 29, 27, 40083 }, // ̐
-    { 14, 6, 8, -7, 26, 21, 40110 }, // ̑
-    { 8, 9, 5, -4, 24, 18, 40131 }, // ̒
-    { 8, 9, 5, -4, 24, 18, 40149 }, // ̓
-    { 8, 9, 5, -4, 24, 18, 40167 }, // ̔
-    { 8, 9, 5, -4, 24, 18, 40185 }, // ̕
-    { 11, 6, 6, -6, -1, 17, 40203 }, // ̖
-    { 10, 6, 6, -5, -1, 15, 40220 }, // ̗
-    { 6, 8, 4, -3, 0, 12, 40235 }, // ̘
-    { 6, 8, 4, -3, 0, 12, 40247 }, // ̙
-    { 9, 9, 10, 0, 26, 21, 40259 }, // ̚
-    { 9, 9, 6, -4, 26, 21, 40280 }, // ̛
-    { 5, 8, 3, -3, 0, 10, 40301 }, // ̜
-    { 8, 6, 5, -4, -1, 12, 40311 }, // ̝
-    { 8, 6, 5, -4, -1, 12, 40323 }, // ̞
-    { 8, 8, 5, -4, 0, 16, 40335 }, // ̟
-    { 8, 3, 5, -4, -3, 6, 40351 }, // ̠
-    { 8, 10, 1, -8, 2, 20, 40357 }, // ̡
-    { 8, 10, 9, 0, 2, 20, 40377 }, // ̢
-    { 7, 6, 0, -15, -2, 11, 40397 }, // ̣
-    { 12, 6, 7, -6, -1, 18, 40408 }, // ̤
-    { 9, 8, 5, -5, 0, 18, 40426 }, // ̥
-    { 6, 6, 4, -3, -2, 9, 40444 }, // ̦
-    { 8, 8, 5, -4, 0, 16, 40453 }, // ̧
-    { 8, 9, 5, -4, 1, 18, 40469 }, // ̨
-    { 4, 7, 3, -2, -1, 7, 40487 }, // ̩
-    { 12, 7, 7, -6, -1, 21, 40494 }, // ̪
-    { 14, 4, 8, -7, -2, 14, 40515 }, // ̫
-    { 15, 6, 9, -7, -1, 23, 40529 }, // ̬
-    { 14, 6, 8, -7, -1, 21, 40552 }, // ̭
-    { 14, 6, 8, -7, -1, 21, 40573 }, // ̮
-    { 14, 6, 8, -7, -1, 21, 40594 }, // ̯
-    { 14, 6, 8, -7, -1, 21, 40615 }, // ̰
-    { 12, 4, 7, -6, -2, 12, 40636 }, // ̱
-    { 16, 3, 9, -8, -3, 12, 40648 }, // ̲
-    { 15, 8, 8, -8, 0, 30, 40660 }, // ̳
-    { 15, 6, 9, -7, 13, 23, 40690 }, // ̴
-    { 14, 5, 8, -7, 12, 18, 40713 }, // ̵
-    { 26, 4, 14, -13, 11, 26, 40731 }, // ̶
-    { 12, 10, 7, -6, 14, 30, 40757 }, // ̷
-    { 14, 28, 8, -7, 26, 98, 40787 }, // ̸
-    { 5, 8, 4, -2, 0, 10, 40885 }, // ̹
-    { 12, 7, 7, -6, -1, 21, 40895 }, // ̺
-    { 14, 8, 8, -7, 0, 28, 40916 }, // ̻
-    { 14, 4, 8, -7, -2, 14, 40944 }, // ̼
-    { 8, 7, 5, -4, 26, 14, 40958 }, // ̽
-    { 6, 10, 4, -3, 29, 15, 40972 }, // ̾
-    { 14, 8, 7, -8, 33, 28, 40987 }, // ̿
-    { 11, 6, 4, -8, 26, 17, 41015 }, // ̀
-    { 10, 6, 9, -2, 26, 15, 41032 }, // ́
-    { 14, 6, 8, -7, 26, 21, 41047 }, // ͂
-    { 7, 7, 4, -4, 26, 13, 41068 }, // ̓
-    { 18, 6, 12, -7, 26, 27, 41081 }, // ̈́
-    { 7, 7, 6, -2, -1, 13, 41108 }, // ͅ
-    { 16, 7, 9, -8, 26, 28, 41121 }, // ͆
-    { 14, 8, 7, -8, 0, 28, 41149 }, // ͇
-    { 10, 7, 6, -5, -1, 18, 41177 }, // ͈
-    { 8, 6, 5, -4, -2, 12, 41195 }, // ͉
-    { 14, 8, 8, -7, 26, 28, 41207 }, // ͊
-    { 14, 14, 8, -7, 32, 49, 41235 }, // ͋
-    { 12, 9, 7, -6, 29, 27, 41284 }, // ͌
-    { 12, 7, 7, -6, -1, 21, 41311 }, // ͍
-    { 8, 8, 5, -4, 0, 16, 41332 }, // ͎
-    { 24, 24, 13, -12, 24, 144, 41348 }, // ͏
-    { 6, 8, 4, -3, 27, 12, 41492 }, // ͐
-    { 5, 8, 4, -2, 27, 10, 41504 }, // ͑
-    { 12, 9, 7, -6, 29, 27, 41514 }, // ͒
-    { 8, 7, 5, -4, -1, 14, 41541 }, // ͓
-    { 6, 7, 4, -3, -1, 11, 41555 }, // ͔
-    { 6, 7, 4, -3, -1, 11, 41566 }, // ͕
-    { 14, 7, 8, -7, -1, 25, 41577 }, // ͖
-    { 5, 8, 4, -2, 27, 10, 41602 }, // ͗
-    { 6, 6, 10, 3, 26, 9, 41612 }, // ͘
-    { 8, 7, 5, -4, -1, 14, 41621 }, // ͙
-    { 14, 8, 8, -7, 0, 28, 41635 }, // ͚
-    { 8, 8, 5, -4, 27, 16, 41663 }, // ͛
-    { 28, 7, 15, -14, -1, 49, 41679 }, // ͜
-    { 28, 7, 15, -14, 26, 49, 41728 }, // ͝
-    { 20, 3, 11, -10, 23, 15, 41777 }, // ͞
-    { 20, 3, 11, -10, -2, 15, 41792 }, // ͟
-    { 28, 6, 15, -14, 26, 42, 41807 }, // ͠
-    { 28, 8, 15, -14, 30, 56, 41849 }, // ͡
-    { 27, 8, 15, -13, 0, 54, 41905 }, // ͢
-    { 8, 9, 5, -4, 29, 18, 41959 }, // ͣ
-    { 9, 9, 6, -4, 29, 21, 41977 }, // ͤ
-    { 3, 11, 3, -1, 31, 9, 41998 }, // ͥ
-    { 9, 9, 6, -4, 29, 21, 42007 }, // ͦ
-    { 9, 8, 6, -4, 28, 18, 42028 }, // ͧ
-    { 7, 9, 5, -3, 29, 16, 42046 }, // ͨ
-    { 8, 11, 5, -4, 31, 22, 42062 }, // ͩ
-    { 9, 11, 6, -4, 31, 25, 42084 }, // ͪ
-    { 13, 9, 8, -6, 29, 30, 42109 }, // ͫ
-    { 6, 9, 5, -2, 29, 14, 42139 }, // ͬ
-    { 7, 10, 5, -3, 30, 18, 42153 }, // ͭ
-    { 9, 8, 6, -4, 28, 18, 42171 }, // ͮ
-    { 10, 8, 6, -5, 28, 20, 42189 }, // ͯ
-    { 24, 24, 25, 0, 24, 144, 42209 }, // Α
-    { 19, 24, 22, 2, 24, 114, 42353 }, // Β
-    { 13, 24, 18, 3, 24, 78, 42467 }, // Γ
-    { 23, 24, 24, 0, 24, 138, 42545 }, // Δ
-    { 14, 24, 19, 3, 24, 84, 42683 }, // Ε
-    { 19, 24, 20, 0, 24, 114, 42767 }, // Ζ
-    { 20, 24, 26, 3, 24, 120, 42881 }, // Η
-    { 24, 26, 26, 1, 25, 156, 43001 }, // Θ
-    { 11, 24, 13, 1, 24, 66, 43157 }, // Ι
-    { 20, 24, 24, 3, 24, 120, 43223 }, // Κ
-    { 23, 24, 24, 0, 24, 138, 43343 }, // Λ
-    { 26, 24, 31, 3, 24, 156, 43481 }, // Μ
-    { 22, 24, 27, 3, 24, 132, 43637 }, // Ν
-    { 18, 24, 21, 1, 24, 108, 43769 }, // Ξ
-    { 24, 26, 26, 1, 25, 156, 43877 }, // Ο
-    { 20, 24, 25, 3, 24, 120, 44033 }, // Π
-    { 18, 24, 21, 2, 24, 108, 44153 }, // Ρ
-    { 19, 24, 20, 0, 24, 114, 44261 }, // Σ
-    { 19, 24, 20, 0, 24, 114, 44375 }, // Τ
-    { 21, 24, 22, 0, 24, 126, 44489 }, // Υ
-    { 28, 25, 30, 1, 24, 175, 44615 }, // Φ
-    { 23, 24, 24, 0, 24, 138, 44790 }, // Χ
-    { 25, 24, 29, 2, 24, 150, 44928 }, // Ψ
-    { 24, 25, 26, 1, 25, 150, 45078 }, // Ω
-    { 20, 20, 22, 1, 19, 100, 45228 }, // α
-    { 18, 34, 21, 2, 26, 153, 45328 }, // β
-    { 18, 26, 19, 0, 19, 117, 45481 }, // γ
-    { 18, 27, 20, 1, 26, 122, 45598 }, // δ
-    { 15, 20, 17, 1, 19, 75, 45720 }, // ε
-    { 16, 33, 18, 1, 26, 132, 45795 }, // ζ
-    { 18, 27, 21, 2, 19, 122, 45927 }, // η
-    { 18, 27, 20, 1, 26, 122, 46049 }, // θ
-    { 11, 20, 14, 2, 19, 55, 46171 }, // ι
-    { 19, 19, 22, 2, 19, 91, 46226 }, // κ
-    { 20, 27, 21, 0, 26, 135, 46317 }, // λ
-    { 20, 27, 23, 2, 19, 135, 46452 }, // μ
-    { 18, 19, 19, 0, 19, 86, 46587 }, // ν
-    { 16, 33, 18, 1, 26, 132, 46673 }, // ξ
-    { 19, 20, 21, 1, 19, 95, 46805 }, // ο
-    { 24, 20, 25, 0, 19, 120, 46900 }, // π
-    { 18, 27, 21, 1, 19, 122, 47020 }, // ρ
-    { 16, 26, 18, 1, 19, 104, 47142 }, // ς
-    { 20, 20, 22, 1, 19, 100, 47246 }, // σ
-    { 17, 20, 18, 0, 19, 85, 47346 }, // τ
-    { 18, 20, 21, 2, 19, 90, 47431 }, // υ
-    { 25, 34, 27, 1, 26, 213, 47521 }, // φ
-    { 21, 28, 22, 0, 19, 147, 47734 }, // χ
-    { 24, 34, 28, 2, 26, 204, 47881 }, // ψ
-    { 27, 20, 29, 1, 19, 135, 48085 }, // ω
-    { 24, 32, 25, 0, 24, 192, 48220 }, // Ạ
-    { 17, 27, 20, 1, 19, 115, 48412 }, // ạ
-    { 24, 34, 25, 0, 34, 204, 48527 }, // Ả
-    { 17, 29, 20, 1, 28, 124, 48731 }, // ả
-    { 24, 33, 25, 0, 33, 198, 48855 }, // Ấ
-    { 20, 29, 22, 1, 28, 145, 49053 }, // ấ
-    { 24, 33, 25, 0, 33, 198, 49198 }, // Ầ
-    { 19, 29, 20, -1, 28, 138, 49396 }, // ầ
-    { 24, 35, 25, 0, 35, 210, 49534 }, // Ẩ
-    { 19, 31, 21, 1, 30, 148, 49744 }, // ẩ
-    { 24, 36, 25, 0, 36, 216, 49892 }, // Ẫ
-    { 17, 31, 20, 1, 30, 132, 50108 }, // ẫ
-    { 24, 40, 25, 0, 32, 240, 50240 }, // Ậ
-    { 17, 34, 20, 1, 26, 145, 50480 }, // ậ
-    { 24, 34, 25, 0, 34, 204, 50625 }, // Ắ
-    { 17, 30, 20, 1, 29, 128, 50829 }, // ắ
-    { 24, 34, 25, 0, 34, 204, 50957 }, // Ằ
-    { 17, 30, 20, 1, 29, 128, 51161 }, // ằ
-    { 24, 35, 25, 0, 35, 210, 51289 }, // Ẳ
-    { 17, 31, 20, 1, 30, 132, 51499 }, // ẳ
-    { 24, 36, 25, 0, 36, 216, 51631 }, // Ẵ
-    { 17, 31, 20, 1, 30, 132, 51847 }, // ẵ
-    { 24, 40, 25, 0, 32, 240, 51979 }, // Ặ
-    { 17, 34, 20, 1, 26, 145, 52219 }, // ặ
-    { 14, 32, 19, 3, 24, 112, 52364 }, // Ẹ
-    { 18, 27, 20, 1, 19, 122, 52476 }, // ẹ
-    { 14, 34, 19, 3, 34, 119, 52598 }, // Ẻ
-    { 18, 29, 20, 1, 28, 131, 52717 }, // ẻ
-    { 14, 32, 19, 3, 32, 112, 52848 }, // Ẽ
-    { 18, 27, 20, 1, 26, 122, 52960 }, // ẽ
-    { 18, 33, 21, 2, 33, 149, 53082 }, // Ế
-    { 21, 29, 23, 1, 28, 153, 53231 }, // ế
-    { 20, 33, 19, -3, 33, 165, 53384 }, // Ề
-    { 20, 29, 20, -1, 28, 145, 53549 }, // ề
-    { 17, 35, 20, 2, 35, 149, 53694 }, // Ể
-    { 19, 31, 21, 1, 30, 148, 53843 }, // ể
-    { 14, 36, 19, 3, 36, 126, 53991 }, // Ễ
-    { 18, 31, 20, 1, 30, 140, 54117 }, // ễ
-    { 14, 40, 19, 3, 32, 140, 54257 }, // Ệ
-    { 18, 34, 20, 1, 26, 153, 54397 }, // ệ
-    { 11, 34, 13, 1, 34, 94, 54550 }, // Ỉ
-    { 9, 28, 11, 1, 28, 63, 54644 }, // ỉ
-    { 11, 32, 13, 1, 24, 88, 54707 }, // Ị
-    { 6, 34, 10, 2, 26, 51, 54795 }, // ị
-    { 24, 33, 26, 1, 25, 198, 54846 }, // Ọ
-    { 19, 27, 21, 1, 19, 129, 55044 }, // ọ
-    { 24, 35, 26, 1, 34, 210, 55173 }, // Ỏ
-    { 19, 29, 21, 1, 28, 138, 55383 }, // ỏ
-    { 24, 34, 26, 1, 33, 204, 55521 }, // Ố
-    { 21, 29, 23, 1, 28, 153, 55725 }, // ố
-    { 24, 34, 26, 1, 33, 204, 55878 }, // Ồ
-    { 21, 29, 21, -1, 28, 153, 56082 }, // ồ
-    { 24, 36, 26, 1, 35, 216, 56235 }, // Ổ
-    { 19, 31, 21, 1, 30, 148, 56451 }, // ổ
-    { 24, 37, 26, 1, 36, 222, 56599 }, // Ỗ
-    { 19, 31, 21, 1, 30, 148, 56821 }, // ỗ
-    { 24, 40, 26, 1, 32, 240, 56969 }, // Ộ
-    { 19, 34, 21, 1, 26, 162, 57209 }, // ộ
-    { 28, 33, 30, 1, 32, 231, 57371 }, // Ớ
-    { 23, 27, 25, 1, 26, 156, 57602 }, // ớ
-    { 28, 33, 30, 1, 32, 231, 57758 }, // Ờ
-    { 23, 27, 25, 1, 26, 156, 57989 }, // ờ
-    { 28, 35, 30, 1, 34, 245, 58145 }, // Ở
-    { 23, 29, 25, 1, 28, 167, 58390 }, // ở
-    { 28, 33, 30, 1, 32, 231, 58557 }, // Ỡ
-    { 23, 27, 25, 1, 26, 156, 58788 }, // ỡ
-    { 28, 34, 30, 1, 26, 238, 58944 }, // Ợ
-    { 23, 29, 25, 1, 21, 167, 59182 }, // ợ
-    { 21, 32, 25, 2, 24, 168, 59349 }, // Ụ
-    { 18, 27, 22, 2, 19, 122, 59517 }, // ụ
-    { 21, 35, 25, 2, 34, 184, 59639 }, // Ủ
-    { 18, 29, 22, 2, 28, 131, 59823 }, // ủ
-    { 28, 33, 31, 2, 32, 231, 59954 }, // Ứ
-    { 25, 27, 28, 2, 26, 169, 60185 }, // ứ
-    { 28, 33, 31, 2, 32, 231, 60354 }, // Ừ
-    { 25, 27, 28, 2, 26, 169, 60585 }, // ừ
-    { 28, 35, 31, 2, 34, 245, 60754 }, // Ử
-    { 25, 29, 28, 2, 28, 182, 60999 }, // ử
-    { 28, 33, 31, 2, 32, 231, 61181 }, // Ữ
-    { 25, 27, 28, 2, 26, 169, 61412 }, // ữ
-    { 28, 34, 31, 2, 26, 238, 61581 }, // Ự
-    { 25, 29, 28, 2, 21, 182, 61819 }, // ự
-    { 21, 32, 22, 0, 32, 168, 62001 }, // Ỳ
-    { 20, 34, 21, 0, 26, 170, 62169 }, // ỳ
-    { 21, 32, 22, 0, 24, 168, 62339 }, // Ỵ
-    { 20, 27, 21, 0, 19, 135, 62507 }, // ỵ
-    { 21, 34, 22, 0, 34, 179, 62642 }, // Ỷ
-    { 20, 36, 21, 0, 28, 180, 62821 }, // ỷ
-    { 21, 32, 22, 0, 32, 168, 63001 }, // Ỹ
-    { 20, 34, 21, 0, 26, 170, 63169 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 63339 }, //  
-    { 0, 0, 33, 0, 0, 0, 63339 }, //  
-    { 0, 0, 17, 0, 0, 0, 63339 }, //  
-    { 0, 0, 33, 0, 0, 0, 63339 }, //  
-    { 0, 0, 11, 0, 0, 0, 63339 }, //  
-    { 0, 0, 8, 0, 0, 0, 63339 }, //  
-    { 0, 0, 6, 0, 0, 0, 63339 }, //  
-    { 0, 0, 19, 0, 0, 0, 63339 }, //  
-    { 0, 0, 9, 0, 0, 0, 63339 }, //  
-    { 0, 0, 6, 0, 0, 0, 63339 }, //  
-    { 0, 0, 3, 0, 0, 0, 63339 }, //  
-    { 0, 0, 1, 0, 0, 0, 63339 }, // ​
-    { 0, 0, 1, 0, 0, 0, 63339 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 63339 }, // ‍
-    { 9, 28, 9, -1, 23, 63, 63339 }, // ‎
-    { 9, 28, 2, -8, 23, 63, 63402 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 63465 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 63478 }, // ‑
-    { 17, 5, 19, 1, 14, 22, 63491 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 63513 }, // –
-    { 32, 4, 34, 1, 11, 32, 63528 }, // —
-    { 32, 4, 34, 1, 11, 32, 63560 }, // ―
-    { 13, 34, 18, 3, 26, 111, 63592 }, // ‖
-    { 15, 8, 15, -1, 0, 30, 63703 }, // ‗
-    { 7, 9, 8, 0, 24, 16, 63733 }, // ‘
-    { 7, 9, 8, 0, 24, 16, 63749 }, // ’
-    { 8, 9, 10, 0, 5, 18, 63765 }, // ‚
-    { 7, 9, 8, 0, 24, 16, 63783 }, // ‛
-    { 15, 9, 16, 0, 24, 34, 63799 }, // “
-    { 15, 9, 16, 0, 24, 34, 63833 }, // ”
-    { 15, 9, 17, 1, 4, 34, 63867 }, // „
-    { 15, 9, 16, 0, 24, 34, 63901 }, // ‟
-    { 15, 26, 17, 1, 26, 98, 63935 }, // †
-    { 15, 26, 17, 1, 26, 98, 64033 }, // ‡
-    { 10, 11, 13, 1, 18, 28, 64131 }, // •
-    { 12, 13, 14, 1, 19, 39, 64159 }, // ‣
-    { 7, 7, 17, 5, 6, 13, 64198 }, // ․
-    { 17, 7, 19, 1, 6, 30, 64211 }, // ‥
-    { 26, 7, 29, 1, 6, 46, 64241 }, // …
-    { 7, 7, 9, 1, 12, 13, 64287 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 64300 }, //  
-    { 0, 0, 20, 0, 0, 0, 64300 }, //  
-    { 9, 26, 9, -1, 21, 59, 64300 }, // ‪
-    { 9, 26, 2, -8, 21, 59, 64359 }, // ‫
-    { 8, 28, 5, -4, 23, 56, 64418 }, // ‬
-    { 8, 28, 5, -4, 23, 56, 64474 }, // ‭
-    { 8, 28, 5, -4, 23, 56, 64530 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 64586 }, //  
-    { 41, 26, 43, 1, 25, 267, 64586 }, // ‰
-    { 55, 26, 56, 0, 25, 358, 64853 }, // ‱
-    { 10, 9, 12, 1, 24, 23, 65211 }, // ′
-    { 17, 9, 19, 1, 24, 39, 65234 }, // ″
-    { 25, 9, 27, 1, 24, 57, 65273 }, // ‴
-    { 10, 9, 14, 1, 24, 23, 65330 }, // ‵
-    { 17, 9, 21, 1, 24, 39, 65353 }, // ‶
-    { 25, 9, 29, 1, 24, 57, 65392 }, // ‷
-    { 13, 11, 14, 0, 3, 36, 65449 }, // ‸
-    { 10, 16, 12, 1, 17, 40, 65485 }, // ‹
-    { 10, 16, 12, 1, 17, 40, 65525 }, // ›
-    { 26, 26, 28, 1, 25, 169, 65565 }, // ※
-    { 17, 25, 19, 1, 24, 107, 65734 }, // ‼
-    { 16, 26, 17, 0, 25, 104, 65841 }, // ‽
-    { 18, 4, 18, -1, 29, 18, 65945 }, // ‾
-    { 20, 8, 21, 0, 0, 40, 65963 }, // ‿
-    { 20, 8, 21, 0, 27, 40, 66003 }, // ⁀
-    { 14, 22, 15, 0, 14, 77, 66043 }, // ⁁
-    { 37, 31, 38, 0, 26, 287, 66120 }, // ⁂
-    { 10, 5, 12, 1, 11, 13, 66407 }, // ⁃
-    { 18, 24, 12, -7, 24, 108, 66420 }, // ⁄
-    { 9, 30, 12, 2, 24, 68, 66528 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 66596 }, // ⁆
-    { 31, 26, 32, 0, 25, 202, 66664 }, // ⁇
-    { 24, 26, 25, 0, 25, 156, 66866 }, // ⁈
-    { 24, 26, 26, 1, 25, 156, 67022 }, // ⁉
-    { 17, 19, 20, 1, 19, 81, 67178 }, // ⁊
-    { 18, 31, 22, 2, 26, 140, 67259 }, // ⁋
-    { 18, 18, 22, 1, 19, 81, 67399 }, // ⁌
-    { 19, 18, 22, 2, 19, 86, 67480 }, // ⁍
-    { 18, 17, 19, 0, 9, 77, 67566 }, // ⁎
-    { 8, 24, 10, 1, 19, 48, 67643 }, // ⁏
-    { 20, 35, 21, 0, 27, 175, 67691 }, // ⁐
-    { 18, 34, 19, 0, 26, 153, 67866 }, // ⁑
-    { 14, 26, 15, 0, 25, 91, 68019 }, // ⁒
-    { 32, 7, 34, 1, 13, 56, 68110 }, // ⁓
-    { 20, 8, 21, 0, 0, 40, 68166 }, // ⁔
-    { 17, 17, 19, 1, 17, 73, 68206 }, // ⁕
-    { 17, 26, 19, 1, 25, 111, 68279 }, // ⁖
-    { 31, 9, 33, 1, 24, 70, 68390 }, // ⁗
-    { 27, 26, 29, 1, 25, 176, 68460 }, // ⁘
-    { 27, 26, 29, 1, 25, 176, 68636 }, // ⁙
-    { 7, 26, 10, 1, 25, 46, 68812 }, // ⁚
-    { 21, 28, 23, 1, 27, 147, 68858 }, // ⁛
-    { 27, 27, 29, 1, 25, 183, 69005 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 69188 }, // ⁝
-    { 7, 26, 10, 1, 25, 46, 69236 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 69282 }, //  
-    { 0, 0, 20, 0, 0, 0, 69282 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 69282 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 69282 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 69282 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 69282 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 69282 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 69282 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 69282 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 69282 }, // ⁩
-    { 8, 28, 5, -4, 23, 56, 69282 }, // ⁪
-    { 8, 28, 5, -4, 23, 56, 69338 }, // ⁫
-    { 8, 28, 5, -4, 23, 56, 69394 }, // ⁬
-    { 8, 29, 5, -4, 24, 58, 69450 }, // ⁭
-    { 8, 28, 5, -4, 23, 56, 69508 }, // ⁮
-    { 8, 28, 5, -4, 23, 56, 69564 }, // ⁯
-    { 12, 16, 13, 0, 29, 48, 69620 }, // ⁰
-    { 5, 16, 7, 1, 25, 20, 69668 }, // ⁱ
-    { 13, 16, 14, 0, 29, 52, 69688 }, // ⁴
-    { 11, 16, 13, 1, 29, 44, 69740 }, // ⁵
-    { 12, 16, 13, 0, 29, 48, 69784 }, // ⁶
-    { 12, 16, 13, 0, 29, 48, 69832 }, // ⁷
-    { 12, 16, 13, 0, 29, 48, 69880 }, // ⁸
-    { 12, 16, 13, 0, 29, 48, 69928 }, // ⁹
-    { 10, 10, 12, 1, 25, 25, 69976 }, // ⁺
-    { 10, 4, 12, 1, 22, 10, 70001 }, // ⁻
-    { 10, 7, 12, 1, 23, 18, 70011 }, // ⁼
-    { 6, 20, 9, 2, 31, 30, 70029 }, // ⁽
-    { 6, 20, 8, 0, 31, 30, 70059 }, // ⁾
-    { 12, 12, 14, 1, 21, 36, 70089 }, // ⁿ
-    { 12, 16, 13, 0, 11, 48, 70125 }, // ₀
-    { 9, 16, 13, 1, 11, 36, 70173 }, // ₁
-    { 12, 16, 13, 0, 11, 48, 70209 }, // ₂
-    { 12, 16, 13, 0, 11, 48, 70257 }, // ₃
-    { 13, 16, 14, 0, 11, 52, 70305 }, // ₄
-    { 11, 16, 13, 1, 11, 44, 70357 }, // ₅
-    { 12, 16, 13, 0, 11, 48, 70401 }, // ₆
-    { 12, 16, 13, 0, 11, 48, 70449 }, // ₇
-    { 12, 16, 13, 0, 11, 48, 70497 }, // ₈
-    { 12, 16, 13, 0, 11, 48, 70545 }, // ₉
-    { 10, 10, 12, 1, 8, 25, 70593 }, // ₊
-    { 10, 4, 12, 1, 5, 10, 70618 }, // ₋
-    { 10, 7, 12, 1, 6, 18, 70628 }, // ₌
-    { 6, 20, 9, 2, 13, 30, 70646 }, // ₍
-    { 6, 20, 8, 0, 13, 30, 70676 }, // ₎
-    { 12, 12, 13, 0, 8, 36, 70706 }, // ₐ
-    { 11, 12, 13, 1, 8, 33, 70742 }, // ₑ
-    { 12, 12, 14, 1, 8, 36, 70775 }, // ₒ
-    { 13, 12, 14, 0, 8, 39, 70811 }, // ₓ
-    { 12, 12, 13, 0, 8, 36, 70850 }, // ₔ
-    { 12, 16, 14, 1, 12, 48, 70886 }, // ₕ
-    { 13, 16, 15, 1, 12, 52, 70934 }, // ₖ
-    { 4, 16, 6, 1, 12, 16, 70986 }, // ₗ
-    { 19, 12, 21, 1, 8, 57, 71002 }, // ₘ
-    { 12, 12, 14, 1, 8, 36, 71059 }, // ₙ
-    { 12, 16, 14, 1, 8, 48, 71095 }, // ₚ
-    { 10, 12, 11, 0, 8, 30, 71143 }, // ₛ
-    { 9, 15, 10, 0, 11, 34, 71173 }, // ₜ
-    { 19, 25, 20, 0, 25, 119, 71207 }, // ₠
-    { 19, 28, 21, 1, 26, 133, 71326 }, // ₡
-    { 18, 26, 20, 1, 25, 117, 71459 }, // ₢
-    { 18, 24, 19, 0, 24, 108, 71576 }, // ₣
-    { 18, 25, 20, 1, 25, 113, 71684 }, // ₤
-    { 29, 27, 33, 2, 23, 196, 71797 }, // ₥
-    { 19, 24, 20, 0, 24, 114, 71993 }, // ₦
-    { 27, 25, 30, 2, 24, 169, 72107 }, // ₧
-    { 28, 25, 31, 2, 24, 175, 72276 }, // ₨
-    { 25, 24, 26, 0, 24, 150, 72451 }, // ₩
-    { 26, 24, 31, 2, 24, 156, 72601 }, // ₪
-    { 21, 32, 23, 1, 26, 168, 72757 }, // ₫
-    { 18, 25, 20, 1, 24, 113, 72925 }, // €
-    { 20, 24, 21, 0, 24, 120, 73038 }, // ₭
-    { 19, 24, 20, 0, 24, 114, 73158 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 73272 }, // ₯
-    { 19, 33, 20, 0, 25, 157, 73545 }, // ₰
-    { 19, 24, 20, 0, 24, 114, 73702 }, // ₱
-    { 21, 29, 24, 1, 26, 153, 73816 }, // ₲
-    { 22, 24, 23, 0, 24, 132, 73969 }, // ₳
-    { 19, 26, 20, 0, 25, 124, 74101 }, // ₴
-    { 20, 29, 22, 1, 26, 145, 74225 }, // ₵
-    { 23, 24, 24, 0, 23, 138, 74370 }, // ₶
-    { 24, 28, 25, 0, 25, 168, 74508 }, // ₷
-    { 19, 24, 20, 0, 24, 114, 74676 }, // ₸
-    { 16, 24, 19, 2, 24, 96, 74790 }, // ₹
-    { 19, 25, 20, 0, 24, 119, 74886 }, // ₺
-    { 27, 26, 28, 0, 25, 176, 75005 }, // ₻
-    { 27, 24, 29, 1, 24, 162, 75181 }, // ₼
-    { 20, 24, 21, 0, 24, 120, 75343 }, // ₽
-    { 24, 26, 26, 1, 26, 156, 75463 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 75619 }, // ₿
-    { 16, 25, 18, 1, 19, 100, 75739 }, // ⃀
-    { 17, 5, 19, 1, 14, 22, 75839 }, // −
-    { 31, 32, 33, 1, 26, 248, 75861 }, // �
+    { 7, 25, 9, 1, 24, 42, 0 }, // !
+    { 12, 9, 16, 2, 24, 29, 42 }, // "
+    { 21, 24, 22, 0, 24, 92, 71 }, // #
+    { 17, 28, 19, 1, 26, 92, 163 }, // $
+    { 29, 26, 31, 1, 25, 125, 255 }, // %
+    { 24, 26, 26, 1, 25, 103, 380 }, // &
+    { 5, 9, 9, 2, 24, 12, 483 }, // '
+    { 10, 30, 12, 1, 24, 48, 495 }, // (
+    { 9, 30, 11, 1, 24, 46, 543 }, // )
+    { 18, 17, 19, 0, 26, 49, 589 }, // *
+    { 17, 17, 19, 1, 20, 49, 638 }, // +
+    { 7, 9, 10, 1, 4, 15, 687 }, // ,
+    { 10, 5, 11, 0, 11, 9, 702 }, // -
+    { 7, 7, 9, 1, 6, 12, 711 }, // .
+    { 14, 25, 15, 0, 24, 45, 723 }, // /
+    { 17, 26, 19, 1, 25, 78, 768 }, // 0
+    { 13, 24, 19, 1, 24, 52, 846 }, // 1
+    { 17, 25, 19, 1, 25, 64, 898 }, // 2
+    { 17, 26, 19, 1, 25, 72, 962 }, // 3
+    { 19, 24, 20, 0, 24, 74, 1034 }, // 4
+    { 17, 25, 19, 1, 24, 71, 1108 }, // 5
+    { 17, 26, 19, 1, 25, 76, 1179 }, // 6
+    { 18, 24, 19, 0, 24, 63, 1255 }, // 7
+    { 17, 26, 19, 1, 25, 82, 1318 }, // 8
+    { 17, 26, 19, 1, 25, 79, 1400 }, // 9
+    { 7, 20, 9, 1, 19, 26, 1479 }, // :
+    { 7, 24, 10, 1, 19, 30, 1505 }, // ;
+    { 17, 18, 19, 1, 21, 48, 1535 }, // <
+    { 17, 11, 19, 1, 17, 39, 1583 }, // =
+    { 17, 18, 19, 1, 21, 49, 1622 }, // >
+    { 16, 26, 17, 0, 25, 59, 1671 }, // ?
+    { 28, 27, 30, 1, 24, 139, 1730 }, // @
+    { 24, 24, 25, 0, 24, 92, 1869 }, // A
+    { 19, 24, 22, 2, 24, 84, 1961 }, // B
+    { 20, 26, 22, 1, 25, 73, 2045 }, // C
+    { 21, 24, 24, 2, 24, 89, 2118 }, // D
+    { 14, 24, 19, 3, 24, 64, 2207 }, // E
+    { 14, 24, 18, 3, 24, 62, 2271 }, // F
+    { 21, 26, 24, 1, 25, 91, 2333 }, // G
+    { 20, 24, 26, 3, 24, 90, 2424 }, // H
+    { 11, 24, 13, 1, 24, 40, 2514 }, // I
+    { 12, 31, 11, -3, 24, 54, 2554 }, // J
+    { 20, 24, 24, 3, 24, 81, 2608 }, // K
+    { 16, 24, 19, 2, 24, 52, 2689 }, // L
+    { 26, 24, 31, 3, 24, 117, 2741 }, // M
+    { 22, 24, 27, 3, 24, 100, 2858 }, // N
+    { 24, 26, 26, 1, 25, 103, 2958 }, // O
+    { 18, 24, 21, 2, 24, 68, 3061 }, // P
+    { 24, 31, 26, 1, 25, 121, 3129 }, // Q
+    { 20, 24, 23, 2, 24, 81, 3250 }, // R
+    { 17, 26, 19, 1, 25, 72, 3331 }, // S
+    { 19, 24, 20, 0, 24, 60, 3403 }, // T
+    { 21, 25, 25, 2, 24, 96, 3463 }, // U
+    { 22, 24, 23, 0, 24, 77, 3559 }, // V
+    { 33, 24, 34, 0, 24, 130, 3636 }, // W
+    { 23, 24, 24, 0, 24, 87, 3766 }, // X
+    { 21, 24, 22, 0, 24, 70, 3853 }, // Y
+    { 19, 24, 20, 0, 24, 72, 3923 }, // Z
+    { 9, 30, 12, 2, 24, 63, 3995 }, // [
+    { 14, 25, 15, 0, 24, 49, 4058 }, // <backslash>
+    { 9, 30, 11, 0, 24, 64, 4107 }, // ]
+    { 19, 16, 20, 0, 24, 48, 4171 }, // ^
+    { 15, 3, 15, -1, -3, 13, 4219 }, // _
+    { 10, 6, 12, 1, 26, 13, 4232 }, // `
+    { 17, 20, 20, 1, 19, 70, 4245 }, // a
+    { 18, 27, 21, 2, 26, 93, 4315 }, // b
+    { 16, 20, 18, 1, 19, 55, 4408 }, // c
+    { 18, 27, 21, 1, 26, 90, 4463 }, // d
+    { 18, 20, 20, 1, 19, 62, 4553 }, // e
+    { 15, 26, 16, 0, 26, 71, 4615 }, // f
+    { 18, 27, 21, 1, 19, 95, 4686 }, // g
+    { 18, 26, 22, 2, 26, 89, 4781 }, // h
+    { 6, 26, 10, 2, 26, 38, 4870 }, // i
+    { 10, 34, 10, -2, 26, 66, 4908 }, // j
+    { 19, 26, 22, 2, 26, 89, 4974 }, // k
+    { 6, 26, 10, 2, 26, 41, 5063 }, // l
+    { 29, 19, 33, 2, 19, 103, 5104 }, // m
+    { 18, 19, 22, 2, 19, 69, 5207 }, // n
+    { 19, 20, 21, 1, 19, 68, 5276 }, // o
+    { 18, 27, 21, 2, 19, 93, 5344 }, // p
+    { 18, 27, 21, 1, 19, 89, 5437 }, // q
+    { 13, 19, 16, 2, 19, 46, 5526 }, // r
+    { 15, 20, 17, 1, 19, 57, 5572 }, // s
+    { 14, 24, 15, 0, 23, 54, 5629 }, // t
+    { 18, 20, 22, 2, 19, 67, 5683 }, // u
+    { 20, 19, 21, 0, 19, 59, 5750 }, // v
+    { 29, 19, 30, 0, 19, 97, 5809 }, // w
+    { 20, 19, 21, 0, 19, 63, 5906 }, // x
+    { 20, 27, 21, 0, 19, 78, 5969 }, // y
+    { 15, 19, 17, 1, 19, 48, 6047 }, // z
+    { 12, 30, 13, 0, 24, 55, 6095 }, // {
+    { 4, 34, 18, 7, 26, 35, 6150 }, // |
+    { 12, 30, 14, 1, 24, 59, 6185 }, // }
+    { 17, 7, 19, 1, 15, 24, 6244 }, // ~
+    { 0, 0, 9, 0, 0, 0, 6268 }, //  
+    { 7, 25, 10, 1, 19, 39, 6268 }, // ¡
+    { 15, 26, 19, 2, 25, 63, 6307 }, // ¢
+    { 18, 25, 20, 1, 25, 69, 6370 }, // £
+    { 17, 16, 19, 1, 20, 51, 6439 }, // ¤
+    { 19, 24, 20, 0, 24, 75, 6490 }, // ¥
+    { 4, 34, 18, 7, 26, 31, 6565 }, // ¦
+    { 14, 27, 16, 1, 26, 73, 6596 }, // §
+    { 12, 6, 20, 4, 26, 14, 6669 }, // ¨
+    { 26, 26, 28, 1, 25, 122, 6683 }, // ©
+    { 12, 13, 13, 0, 25, 38, 6805 }, // ª
+    { 19, 16, 21, 1, 17, 58, 6843 }, // «
+    { 17, 10, 19, 1, 14, 30, 6901 }, // ¬
+    { 10, 5, 11, 0, 11, 9, 6931 }, // ­
+    { 26, 26, 28, 1, 25, 124, 6940 }, // ®
+    { 18, 4, 18, -1, 29, 24, 7064 }, // ¯
+    { 12, 13, 14, 1, 25, 31, 7088 }, // °
+    { 17, 21, 19, 1, 21, 66, 7119 }, // ±
+    { 12, 16, 13, 0, 29, 32, 7185 }, // ²
+    { 12, 16, 13, 0, 29, 40, 7217 }, // ³
+    { 10, 6, 12, 1, 26, 13, 7257 }, // ´
+    { 18, 27, 22, 2, 19, 88, 7270 }, // µ
+    { 18, 31, 22, 1, 26, 123, 7358 }, // ¶
+    { 7, 7, 9, 1, 15, 12, 7481 }, // ·
+    { 9, 8, 10, 0, 0, 16, 7493 }, // ¸
+    { 9, 16, 13, 1, 29, 26, 7509 }, // ¹
+    { 12, 13, 13, 0, 25, 33, 7535 }, // º
+    { 19, 16, 21, 1, 17, 58, 7568 }, // »
+    { 28, 24, 29, 0, 24, 113, 7626 }, // ¼
+    { 28, 24, 29, 0, 24, 107, 7739 }, // ½
+    { 27, 25, 29, 1, 25, 113, 7846 }, // ¾
+    { 16, 25, 17, 0, 19, 60, 7959 }, // ¿
+    { 24, 32, 25, 0, 32, 113, 8019 }, // À
+    { 24, 32, 25, 0, 32, 114, 8132 }, // Á
+    { 24, 32, 25, 0, 32, 115, 8246 }, // Â
+    { 24, 32, 25, 0, 32, 115, 8361 }, // Ã
+    { 24, 32, 25, 0, 32, 113, 8476 }, // Ä
+    { 24, 29, 25, 0, 29, 108, 8589 }, // Å
+    { 30, 24, 32, 0, 24, 118, 8697 }, // Æ
+    { 20, 33, 22, 1, 25, 91, 8815 }, // Ç
+    { 14, 32, 19, 3, 32, 81, 8906 }, // È
+    { 14, 32, 19, 3, 32, 79, 8987 }, // É
+    { 14, 32, 19, 3, 32, 83, 9066 }, // Ê
+    { 14, 32, 19, 3, 32, 81, 9149 }, // Ë
+    { 12, 32, 13, 0, 32, 57, 9230 }, // Ì
+    { 12, 32, 14, 1, 32, 57, 9287 }, // Í
+    { 15, 32, 15, -1, 32, 70, 9344 }, // Î
+    { 13, 32, 14, 0, 32, 59, 9414 }, // Ï
+    { 23, 24, 24, 0, 24, 95, 9473 }, // Ð
+    { 22, 32, 27, 3, 32, 124, 9568 }, // Ñ
+    { 24, 33, 26, 1, 32, 122, 9692 }, // Ò
+    { 24, 33, 26, 1, 32, 123, 9814 }, // Ó
+    { 24, 33, 26, 1, 32, 126, 9937 }, // Ô
+    { 24, 33, 26, 1, 32, 126, 10063 }, // Õ
+    { 24, 33, 26, 1, 32, 123, 10189 }, // Ö
+    { 15, 16, 19, 2, 20, 49, 10312 }, // ×
+    { 24, 28, 26, 1, 26, 115, 10361 }, // Ø
+    { 21, 33, 25, 2, 32, 115, 10476 }, // Ù
+    { 21, 33, 25, 2, 32, 115, 10591 }, // Ú
+    { 21, 33, 25, 2, 32, 117, 10706 }, // Û
+    { 21, 33, 25, 2, 32, 117, 10823 }, // Ü
+    { 21, 32, 22, 0, 32, 89, 10940 }, // Ý
+    { 17, 24, 21, 3, 24, 64, 11029 }, // Þ
+    { 21, 27, 24, 2, 26, 110, 11093 }, // ß
+    { 17, 27, 20, 1, 26, 86, 11203 }, // à
+    { 17, 27, 20, 1, 26, 86, 11289 }, // á
+    { 17, 27, 20, 1, 26, 88, 11375 }, // â
+    { 17, 27, 20, 1, 26, 90, 11463 }, // ã
+    { 17, 27, 20, 1, 26, 87, 11553 }, // ä
+    { 17, 29, 20, 1, 28, 95, 11640 }, // å
+    { 29, 20, 31, 1, 19, 101, 11735 }, // æ
+    { 16, 27, 18, 1, 19, 71, 11836 }, // ç
+    { 18, 27, 20, 1, 26, 78, 11907 }, // è
+    { 18, 27, 20, 1, 26, 79, 11985 }, // é
+    { 18, 27, 20, 1, 26, 81, 12064 }, // ê
+    { 18, 27, 20, 1, 26, 79, 12145 }, // ë
+    { 11, 26, 11, -1, 26, 51, 12224 }, // ì
+    { 10, 26, 13, 2, 26, 50, 12275 }, // í
+    { 14, 26, 13, -2, 26, 54, 12325 }, // î
+    { 12, 26, 12, -1, 26, 52, 12379 }, // ï
+    { 19, 27, 21, 1, 26, 90, 12431 }, // ð
+    { 18, 26, 22, 2, 26, 89, 12521 }, // ñ
+    { 19, 27, 21, 1, 26, 85, 12610 }, // ò
+    { 19, 27, 21, 1, 26, 85, 12695 }, // ó
+    { 19, 27, 21, 1, 26, 87, 12780 }, // ô
+    { 19, 27, 21, 1, 26, 87, 12867 }, // õ
+    { 19, 27, 21, 1, 26, 84, 12954 }, // ö
+    { 17, 17, 19, 1, 20, 45, 13038 }, // ÷
+    { 19, 22, 21, 1, 20, 79, 13083 }, // ø
+    { 18, 27, 22, 2, 26, 84, 13162 }, // ù
+    { 18, 27, 22, 2, 26, 85, 13246 }, // ú
+    { 18, 27, 22, 2, 26, 88, 13331 }, // û
+    { 18, 27, 22, 2, 26, 84, 13419 }, // ü
+    { 20, 34, 21, 0, 26, 96, 13503 }, // ý
+    { 18, 34, 21, 2, 26, 111, 13599 }, // þ
+    { 20, 34, 21, 0, 26, 96, 13710 }, // ÿ
+    { 24, 30, 25, 0, 30, 109, 13806 }, // Ā
+    { 17, 25, 20, 1, 24, 87, 13915 }, // ā
+    { 24, 32, 25, 0, 32, 117, 14002 }, // Ă
+    { 17, 27, 20, 1, 26, 90, 14119 }, // ă
+    { 24, 32, 25, 0, 24, 116, 14209 }, // Ą
+    { 17, 27, 20, 1, 19, 88, 14325 }, // ą
+    { 20, 33, 22, 1, 32, 90, 14413 }, // Ć
+    { 16, 27, 18, 1, 26, 72, 14503 }, // ć
+    { 20, 33, 22, 1, 32, 94, 14575 }, // Ĉ
+    { 16, 27, 18, 1, 26, 74, 14669 }, // ĉ
+    { 20, 33, 22, 1, 32, 89, 14743 }, // Ċ
+    { 16, 27, 18, 1, 26, 70, 14832 }, // ċ
+    { 20, 33, 22, 1, 32, 95, 14902 }, // Č
+    { 17, 27, 19, 1, 26, 75, 14997 }, // č
+    { 21, 32, 24, 2, 32, 112, 15072 }, // Ď
+    { 25, 27, 27, 1, 26, 108, 15184 }, // ď
+    { 23, 24, 24, 0, 24, 95, 15292 }, // Đ
+    { 21, 27, 23, 1, 26, 100, 15387 }, // đ
+    { 14, 30, 19, 3, 30, 82, 15487 }, // Ē
+    { 18, 25, 20, 1, 24, 79, 15569 }, // ē
+    { 14, 32, 19, 3, 32, 84, 15648 }, // Ĕ
+    { 18, 27, 20, 1, 26, 82, 15732 }, // ĕ
+    { 14, 32, 19, 3, 32, 78, 15814 }, // Ė
+    { 18, 27, 20, 1, 26, 77, 15892 }, // ė
+    { 14, 32, 19, 3, 24, 83, 15969 }, // Ę
+    { 18, 27, 20, 1, 19, 78, 16052 }, // ę
+    { 15, 32, 19, 3, 32, 89, 16130 }, // Ě
+    { 18, 27, 20, 1, 26, 82, 16219 }, // ě
+    { 21, 33, 24, 1, 32, 113, 16301 }, // Ĝ
+    { 18, 34, 21, 1, 26, 114, 16414 }, // ĝ
+    { 21, 33, 24, 1, 32, 114, 16528 }, // Ğ
+    { 18, 34, 21, 1, 26, 116, 16642 }, // ğ
+    { 21, 33, 24, 1, 32, 108, 16758 }, // Ġ
+    { 18, 34, 21, 1, 26, 109, 16866 }, // ġ
+    { 21, 33, 24, 1, 25, 106, 16975 }, // Ģ
+    { 18, 34, 21, 1, 26, 108, 17081 }, // ģ
+    { 20, 32, 26, 3, 32, 111, 17189 }, // Ĥ
+    { 22, 33, 22, -2, 33, 116, 17300 }, // ĥ
+    { 26, 24, 27, 0, 24, 110, 17416 }, // Ħ
+    { 20, 26, 22, 0, 26, 100, 17526 }, // ħ
+    { 15, 32, 14, -2, 32, 70, 17626 }, // Ĩ
+    { 14, 26, 13, -2, 26, 57, 17696 }, // ĩ
+    { 12, 30, 13, 0, 30, 56, 17753 }, // Ī
+    { 12, 24, 12, -1, 24, 52, 17809 }, // ī
+    { 14, 32, 15, 0, 32, 71, 17861 }, // Ĭ
+    { 14, 26, 13, -2, 26, 57, 17932 }, // ĭ
+    { 11, 32, 13, 1, 24, 56, 17989 }, // Į
+    { 7, 34, 10, 1, 26, 64, 18045 }, // į
+    { 11, 32, 13, 1, 32, 51, 18109 }, // İ
+    { 6, 19, 10, 2, 19, 28, 18160 }, // ı
+    { 21, 31, 24, 1, 24, 107, 18188 }, // Ĳ
+    { 16, 34, 20, 2, 26, 105, 18295 }, // ĳ
+    { 16, 39, 14, -3, 32, 87, 18400 }, // Ĵ
+    { 14, 34, 13, -2, 26, 72, 18487 }, // ĵ
+    { 20, 32, 24, 3, 24, 96, 18559 }, // Ķ
+    { 19, 34, 22, 2, 26, 103, 18655 }, // ķ
+    { 19, 19, 22, 2, 19, 69, 18758 }, // ĸ
+    { 16, 32, 19, 2, 32, 70, 18827 }, // Ĺ
+    { 10, 33, 13, 2, 33, 67, 18897 }, // ĺ
+    { 16, 32, 19, 2, 24, 66, 18964 }, // Ļ
+    { 6, 34, 10, 2, 26, 52, 19030 }, // ļ
+    { 17, 24, 20, 2, 24, 60, 19082 }, // Ľ
+    { 13, 26, 16, 2, 26, 63, 19142 }, // ľ
+    { 16, 24, 19, 2, 24, 60, 19205 }, // Ŀ
+    { 12, 26, 15, 2, 26, 60, 19265 }, // ŀ
+    { 18, 24, 19, 0, 24, 58, 19325 }, // Ł
+    { 12, 26, 12, -1, 26, 56, 19383 }, // ł
+    { 22, 32, 27, 3, 32, 120, 19439 }, // Ń
+    { 18, 26, 22, 2, 26, 87, 19559 }, // ń
+    { 22, 32, 27, 3, 24, 117, 19646 }, // Ņ
+    { 18, 27, 22, 2, 19, 85, 19763 }, // ņ
+    { 22, 32, 27, 3, 32, 124, 19848 }, // Ň
+    { 18, 26, 22, 2, 26, 90, 19972 }, // ň
+    { 25, 24, 26, -1, 24, 94, 20062 }, // ŉ
+    { 22, 31, 27, 3, 24, 117, 20156 }, // Ŋ
+    { 18, 27, 22, 2, 19, 91, 20273 }, // ŋ
+    { 24, 31, 26, 1, 30, 121, 20364 }, // Ō
+    { 19, 25, 21, 1, 24, 81, 20485 }, // ō
+    { 24, 33, 26, 1, 32, 128, 20566 }, // Ŏ
+    { 19, 27, 21, 1, 26, 89, 20694 }, // ŏ
+    { 24, 33, 26, 1, 32, 130, 20783 }, // Ő
+    { 19, 27, 21, 1, 26, 92, 20913 }, // ő
+    { 30, 26, 32, 1, 25, 128, 21005 }, // Œ
+    { 31, 20, 33, 1, 19, 106, 21133 }, // œ
+    { 20, 32, 23, 2, 32, 99, 21239 }, // Ŕ
+    { 14, 26, 17, 2, 26, 61, 21338 }, // ŕ
+    { 20, 32, 23, 2, 24, 96, 21399 }, // Ŗ
+    { 13, 27, 16, 2, 19, 59, 21495 }, // ŗ
+    { 20, 32, 23, 2, 32, 103, 21554 }, // Ř
+    { 15, 26, 17, 1, 26, 71, 21657 }, // ř
+    { 17, 33, 19, 1, 32, 88, 21728 }, // Ś
+    { 15, 27, 17, 1, 26, 73, 21816 }, // ś
+    { 17, 33, 19, 1, 32, 91, 21889 }, // Ŝ
+    { 15, 27, 17, 1, 26, 76, 21980 }, // ŝ
+    { 17, 33, 19, 1, 25, 87, 22056 }, // Ş
+    { 15, 27, 17, 1, 19, 72, 22143 }, // ş
+    { 17, 33, 19, 1, 32, 91, 22215 }, // Š
+    { 15, 27, 17, 1, 26, 76, 22306 }, // š
+    { 19, 32, 20, 0, 24, 79, 22382 }, // Ţ
+    { 14, 31, 15, 0, 23, 71, 22461 }, // ţ
+    { 19, 32, 20, 0, 32, 82, 22532 }, // Ť
+    { 19, 27, 20, 0, 26, 67, 22614 }, // ť
+    { 19, 24, 20, 0, 24, 66, 22681 }, // Ŧ
+    { 14, 24, 15, 0, 23, 58, 22747 }, // ŧ
+    { 21, 33, 25, 2, 32, 118, 22805 }, // Ũ
+    { 18, 27, 22, 2, 26, 88, 22923 }, // ũ
+    { 21, 31, 25, 2, 30, 112, 23011 }, // Ū
+    { 18, 25, 22, 2, 24, 83, 23123 }, // ū
+    { 21, 33, 25, 2, 32, 120, 23206 }, // Ŭ
+    { 18, 27, 22, 2, 26, 87, 23326 }, // ŭ
+    { 21, 35, 25, 2, 34, 124, 23413 }, // Ů
+    { 18, 29, 22, 2, 28, 92, 23537 }, // ů
+    { 21, 33, 25, 2, 32, 124, 23629 }, // Ű
+    { 18, 27, 22, 2, 26, 92, 23753 }, // ű
+    { 21, 32, 25, 2, 24, 114, 23845 }, // Ų
+    { 18, 27, 22, 2, 19, 86, 23959 }, // ų
+    { 33, 32, 34, 0, 32, 157, 24045 }, // Ŵ
+    { 29, 26, 30, 0, 26, 122, 24202 }, // ŵ
+    { 21, 32, 22, 0, 32, 91, 24324 }, // Ŷ
+    { 20, 34, 21, 0, 26, 98, 24415 }, // ŷ
+    { 21, 32, 22, 0, 32, 90, 24513 }, // Ÿ
+    { 19, 32, 20, 0, 32, 89, 24603 }, // Ź
+    { 15, 26, 17, 1, 26, 64, 24692 }, // ź
+    { 19, 32, 20, 0, 32, 88, 24756 }, // Ż
+    { 15, 26, 17, 1, 26, 63, 24844 }, // ż
+    { 19, 32, 20, 0, 32, 93, 24907 }, // Ž
+    { 15, 26, 17, 1, 26, 67, 25000 }, // ž
+    { 12, 26, 15, 2, 26, 57, 25067 }, // ſ
+    { 28, 27, 30, 1, 26, 115, 25124 }, // Ơ
+    { 23, 22, 25, 1, 21, 81, 25239 }, // ơ
+    { 34, 26, 38, 1, 25, 154, 25320 }, // Ƣ
+    { 28, 27, 31, 1, 19, 126, 25474 }, // ƣ
+    { 24, 24, 25, 0, 24, 87, 25600 }, // Ƥ
+    { 18, 34, 21, 2, 26, 114, 25687 }, // ƥ
+    { 20, 28, 24, 3, 24, 87, 25801 }, // Ʀ
+    { 16, 26, 18, 1, 25, 73, 25888 }, // Ƨ
+    { 15, 20, 17, 1, 19, 57, 25961 }, // ƨ
+    { 19, 24, 20, 0, 24, 71, 26018 }, // Ʃ
+    { 17, 34, 17, -1, 26, 91, 26089 }, // ƪ
+    { 14, 31, 15, 0, 23, 68, 26180 }, // ƫ
+    { 20, 24, 21, 0, 24, 71, 26248 }, // Ƭ
+    { 14, 27, 15, 0, 26, 67, 26319 }, // ƭ
+    { 19, 32, 20, 0, 24, 78, 26386 }, // Ʈ
+    { 28, 27, 31, 2, 26, 112, 26464 }, // Ư
+    { 25, 22, 28, 2, 21, 83, 26576 }, // ư
+    { 10, 6, 0, -18, 26, 12, 26659 }, // ̀
+    { 11, 6, 0, -13, 26, 13, 26671 }, // ́
+    { 14, 6, 8, -7, 26, 17, 26684 }, // ̂
+    { 15, 6, 0, -19, 26, 19, 26701 }, // ̃
+    { 12, 4, 7, -6, 24, 14, 26720 }, // ̄
+    { 14, 5, 8, -7, 29, 14, 26734 }, // ̅
+    { 14, 6, 8, -7, 26, 19, 26748 }, // ̆
+    { 6, 6, 4, -3, 26, 10, 26767 }, // ̇
+    { 12, 6, 7, -6, 26, 14, 26777 }, // ̈
+    { 8, 9, 0, -14, 28, 18, 26791 }, // ̉
+    { 9, 8, 5, -5, 28, 19, 26809 }, // ̊
+    { 16, 6, 11, -6, 26, 23, 26828 }, // ̋
+    { 15, 6, 9, -7, 26, 18, 26851 }, // ̌
+    { 4, 7, 3, -2, 26, 10, 26869 }, // ̍
+    { 10, 7, 6, -5, 26, 18, 26879 }, // ̎
+    { 14, 6, 0, -19, 26, 22, 26897 }, // ̏
+    { 12, 9, 7, -6, 29, 23, 26919 }, // ̐
+    { 14, 6, 8, -7, 26, 17, 26942 }, // ̑
+    { 8, 9, 5, -4, 24, 16, 26959 }, // ̒
+    { 8, 9, 5, -4, 24, 14, 26975 }, // ̓
+    { 8, 9, 5, -4, 24, 15, 26989 }, // ̔
+    { 8, 9, 5, -4, 24, 14, 27004 }, // ̕
+    { 11, 6, 6, -6, -1, 13, 27018 }, // ̖
+    { 10, 6, 6, -5, -1, 13, 27031 }, // ̗
+    { 6, 8, 4, -3, 0, 10, 27044 }, // ̘
+    { 6, 8, 4, -3, 0, 10, 27054 }, // ̙
+    { 9, 9, 10, 0, 26, 23, 27064 }, // ̚
+    { 9, 9, 6, -4, 26, 16, 27087 }, // ̛
+    { 5, 8, 3, -3, 0, 12, 27103 }, // ̜
+    { 8, 6, 5, -4, -1, 9, 27115 }, // ̝
+    { 8, 6, 5, -4, -1, 13, 27124 }, // ̞
+    { 8, 8, 5, -4, 0, 14, 27137 }, // ̟
+    { 8, 3, 5, -4, -3, 5, 27151 }, // ̠
+    { 8, 10, 1, -8, 2, 17, 27156 }, // ̡
+    { 8, 10, 9, 0, 2, 17, 27173 }, // ̢
+    { 7, 6, 0, -15, -2, 11, 27190 }, // ̣
+    { 12, 6, 7, -6, -1, 14, 27201 }, // ̤
+    { 9, 8, 5, -5, 0, 19, 27215 }, // ̥
+    { 6, 6, 4, -3, -2, 10, 27234 }, // ̦
+    { 8, 8, 5, -4, 0, 14, 27244 }, // ̧
+    { 8, 9, 5, -4, 1, 17, 27258 }, // ̨
+    { 4, 7, 3, -2, -1, 10, 27275 }, // ̩
+    { 12, 7, 7, -6, -1, 21, 27285 }, // ̪
+    { 14, 4, 8, -7, -2, 15, 27306 }, // ̫
+    { 15, 6, 9, -7, -1, 18, 27321 }, // ̬
+    { 14, 6, 8, -7, -1, 17, 27339 }, // ̭
+    { 14, 6, 8, -7, -1, 19, 27356 }, // ̮
+    { 14, 6, 8, -7, -1, 17, 27375 }, // ̯
+    { 14, 6, 8, -7, -1, 19, 27392 }, // ̰
+    { 12, 4, 7, -6, -2, 14, 27411 }, // ̱
+    { 16, 3, 9, -8, -3, 12, 27425 }, // ̲
+    { 15, 8, 8, -8, 0, 32, 27437 }, // ̳
+    { 15, 6, 9, -7, 13, 21, 27469 }, // ̴
+    { 14, 5, 8, -7, 12, 14, 27490 }, // ̵
+    { 26, 4, 14, -13, 11, 24, 27504 }, // ̶
+    { 12, 10, 7, -6, 14, 19, 27528 }, // ̷
+    { 14, 28, 8, -7, 26, 59, 27547 }, // ̸
+    { 5, 8, 4, -2, 0, 12, 27606 }, // ̹
+    { 12, 7, 7, -6, -1, 21, 27618 }, // ̺
+    { 14, 8, 8, -7, 0, 30, 27639 }, // ̻
+    { 14, 4, 8, -7, -2, 16, 27669 }, // ̼
+    { 8, 7, 5, -4, 26, 18, 27685 }, // ̽
+    { 6, 10, 4, -3, 29, 16, 27703 }, // ̾
+    { 14, 8, 7, -8, 33, 29, 27719 }, // ̿
+    { 11, 6, 4, -8, 26, 13, 27748 }, // ̀
+    { 10, 6, 9, -2, 26, 14, 27761 }, // ́
+    { 14, 6, 8, -7, 26, 19, 27775 }, // ͂
+    { 7, 7, 4, -4, 26, 11, 27794 }, // ̓
+    { 18, 6, 12, -7, 26, 22, 27805 }, // ̈́
+    { 7, 7, 6, -2, -1, 14, 27827 }, // ͅ
+    { 16, 7, 9, -8, 26, 31, 27841 }, // ͆
+    { 14, 8, 7, -8, 0, 29, 27872 }, // ͇
+    { 10, 7, 6, -5, -1, 18, 27901 }, // ͈
+    { 8, 6, 5, -4, -2, 8, 27919 }, // ͉
+    { 14, 8, 8, -7, 26, 25, 27927 }, // ͊
+    { 14, 14, 8, -7, 32, 35, 27952 }, // ͋
+    { 12, 9, 7, -6, 29, 29, 27987 }, // ͌
+    { 12, 7, 7, -6, -1, 17, 28016 }, // ͍
+    { 8, 8, 5, -4, 0, 11, 28033 }, // ͎
+    { 24, 24, 13, -12, 24, 96, 28044 }, // ͏
+    { 6, 8, 4, -3, 27, 12, 28140 }, // ͐
+    { 5, 8, 4, -2, 27, 12, 28152 }, // ͑
+    { 12, 9, 7, -6, 29, 23, 28164 }, // ͒
+    { 8, 7, 5, -4, -1, 13, 28187 }, // ͓
+    { 6, 7, 4, -3, -1, 12, 28200 }, // ͔
+    { 6, 7, 4, -3, -1, 12, 28212 }, // ͕
+    { 14, 7, 8, -7, -1, 25, 28224 }, // ͖
+    { 5, 8, 4, -2, 27, 15, 28249 }, // ͗
+    { 6, 6, 10, 3, 26, 11, 28264 }, // ͘
+    { 8, 7, 5, -4, -1, 17, 28275 }, // ͙
+    { 14, 8, 8, -7, 0, 27, 28292 }, // ͚
+    { 8, 8, 5, -4, 27, 11, 28319 }, // ͛
+    { 28, 7, 15, -14, -1, 35, 28330 }, // ͜
+    { 28, 7, 15, -14, 26, 35, 28365 }, // ͝
+    { 20, 3, 11, -10, 23, 23, 28400 }, // ͞
+    { 20, 3, 11, -10, -2, 23, 28423 }, // ͟
+    { 28, 6, 15, -14, 26, 32, 28446 }, // ͠
+    { 28, 8, 15, -14, 30, 34, 28478 }, // ͡
+    { 27, 8, 15, -13, 0, 34, 28512 }, // ͢
+    { 8, 9, 5, -4, 29, 19, 28546 }, // ͣ
+    { 9, 9, 6, -4, 29, 20, 28565 }, // ͤ
+    { 3, 11, 3, -1, 31, 12, 28585 }, // ͥ
+    { 9, 9, 6, -4, 29, 21, 28597 }, // ͦ
+    { 9, 8, 6, -4, 28, 21, 28618 }, // ͧ
+    { 7, 9, 5, -3, 29, 18, 28639 }, // ͨ
+    { 8, 11, 5, -4, 31, 25, 28657 }, // ͩ
+    { 9, 11, 6, -4, 31, 26, 28682 }, // ͪ
+    { 13, 9, 8, -6, 29, 36, 28708 }, // ͫ
+    { 6, 9, 5, -2, 29, 13, 28744 }, // ͬ
+    { 7, 10, 5, -3, 30, 17, 28757 }, // ͭ
+    { 9, 8, 6, -4, 28, 20, 28774 }, // ͮ
+    { 10, 8, 6, -5, 28, 20, 28794 }, // ͯ
+    { 24, 24, 25, 0, 24, 92, 28814 }, // Α
+    { 19, 24, 22, 2, 24, 84, 28906 }, // Β
+    { 13, 24, 18, 3, 24, 40, 28990 }, // Γ
+    { 23, 24, 24, 0, 24, 85, 29030 }, // Δ
+    { 14, 24, 19, 3, 24, 64, 29115 }, // Ε
+    { 19, 24, 20, 0, 24, 72, 29179 }, // Ζ
+    { 20, 24, 26, 3, 24, 90, 29251 }, // Η
+    { 24, 26, 26, 1, 25, 107, 29341 }, // Θ
+    { 11, 24, 13, 1, 24, 40, 29448 }, // Ι
+    { 20, 24, 24, 3, 24, 81, 29488 }, // Κ
+    { 23, 24, 24, 0, 24, 86, 29569 }, // Λ
+    { 26, 24, 31, 3, 24, 117, 29655 }, // Μ
+    { 22, 24, 27, 3, 24, 100, 29772 }, // Ν
+    { 18, 24, 21, 1, 24, 65, 29872 }, // Ξ
+    { 24, 26, 26, 1, 25, 103, 29937 }, // Ο
+    { 20, 24, 25, 3, 24, 86, 30040 }, // Π
+    { 18, 24, 21, 2, 24, 68, 30126 }, // Ρ
+    { 19, 24, 20, 0, 24, 71, 30194 }, // Σ
+    { 19, 24, 20, 0, 24, 60, 30265 }, // Τ
+    { 21, 24, 22, 0, 24, 70, 30325 }, // Υ
+    { 28, 25, 30, 1, 24, 117, 30395 }, // Φ
+    { 23, 24, 24, 0, 24, 87, 30512 }, // Χ
+    { 25, 24, 29, 2, 24, 99, 30599 }, // Ψ
+    { 24, 25, 26, 1, 25, 103, 30698 }, // Ω
+    { 20, 20, 22, 1, 19, 75, 30801 }, // α
+    { 18, 34, 21, 2, 26, 117, 30876 }, // β
+    { 18, 26, 19, 0, 19, 76, 30993 }, // γ
+    { 18, 27, 20, 1, 26, 81, 31069 }, // δ
+    { 15, 20, 17, 1, 19, 57, 31150 }, // ε
+    { 16, 33, 18, 1, 26, 91, 31207 }, // ζ
+    { 18, 27, 21, 2, 19, 86, 31298 }, // η
+    { 18, 27, 20, 1, 26, 88, 31384 }, // θ
+    { 11, 20, 14, 2, 19, 41, 31472 }, // ι
+    { 19, 19, 22, 2, 19, 69, 31513 }, // κ
+    { 20, 27, 21, 0, 26, 83, 31582 }, // λ
+    { 20, 27, 23, 2, 19, 92, 31665 }, // μ
+    { 18, 19, 19, 0, 19, 58, 31757 }, // ν
+    { 16, 33, 18, 1, 26, 95, 31815 }, // ξ
+    { 19, 20, 21, 1, 19, 68, 31910 }, // ο
+    { 24, 20, 25, 0, 19, 77, 31978 }, // π
+    { 18, 27, 21, 1, 19, 81, 32055 }, // ρ
+    { 16, 26, 18, 1, 19, 69, 32136 }, // ς
+    { 20, 20, 22, 1, 19, 72, 32205 }, // σ
+    { 17, 20, 18, 0, 19, 55, 32277 }, // τ
+    { 18, 20, 21, 2, 19, 68, 32332 }, // υ
+    { 25, 34, 27, 1, 26, 127, 32400 }, // φ
+    { 21, 28, 22, 0, 19, 90, 32527 }, // χ
+    { 24, 34, 28, 2, 26, 122, 32617 }, // ψ
+    { 27, 20, 29, 1, 19, 88, 32739 }, // ω
+    { 24, 32, 25, 0, 24, 110, 32827 }, // Ạ
+    { 17, 27, 20, 1, 19, 84, 32937 }, // ạ
+    { 24, 34, 25, 0, 34, 119, 33021 }, // Ả
+    { 17, 29, 20, 1, 28, 90, 33140 }, // ả
+    { 24, 33, 25, 0, 33, 124, 33230 }, // Ấ
+    { 20, 29, 22, 1, 28, 98, 33354 }, // ấ
+    { 24, 33, 25, 0, 33, 124, 33452 }, // Ầ
+    { 19, 29, 20, -1, 28, 98, 33576 }, // ầ
+    { 24, 35, 25, 0, 35, 129, 33674 }, // Ẩ
+    { 19, 31, 21, 1, 30, 101, 33803 }, // ẩ
+    { 24, 36, 25, 0, 36, 133, 33904 }, // Ẫ
+    { 17, 31, 20, 1, 30, 102, 34037 }, // ẫ
+    { 24, 40, 25, 0, 32, 134, 34139 }, // Ậ
+    { 17, 34, 20, 1, 26, 102, 34273 }, // ậ
+    { 24, 34, 25, 0, 34, 124, 34375 }, // Ắ
+    { 17, 30, 20, 1, 29, 96, 34499 }, // ắ
+    { 24, 34, 25, 0, 34, 125, 34595 }, // Ằ
+    { 17, 30, 20, 1, 29, 97, 34720 }, // ằ
+    { 24, 35, 25, 0, 35, 127, 34817 }, // Ẳ
+    { 17, 31, 20, 1, 30, 98, 34944 }, // ẳ
+    { 24, 36, 25, 0, 36, 132, 35042 }, // Ẵ
+    { 17, 31, 20, 1, 30, 103, 35174 }, // ẵ
+    { 24, 40, 25, 0, 32, 135, 35277 }, // Ặ
+    { 17, 34, 20, 1, 26, 105, 35412 }, // ặ
+    { 14, 32, 19, 3, 24, 78, 35517 }, // Ẹ
+    { 18, 27, 20, 1, 19, 76, 35595 }, // ẹ
+    { 14, 34, 19, 3, 34, 84, 35671 }, // Ẻ
+    { 18, 29, 20, 1, 28, 83, 35755 }, // ẻ
+    { 14, 32, 19, 3, 32, 85, 35838 }, // Ẽ
+    { 18, 27, 20, 1, 26, 82, 35923 }, // ẽ
+    { 18, 33, 21, 2, 33, 95, 36005 }, // Ế
+    { 21, 29, 23, 1, 28, 90, 36100 }, // ế
+    { 20, 33, 19, -3, 33, 97, 36190 }, // Ề
+    { 20, 29, 20, -1, 28, 90, 36287 }, // ề
+    { 17, 35, 20, 2, 35, 99, 36377 }, // Ể
+    { 19, 31, 21, 1, 30, 94, 36476 }, // ể
+    { 14, 36, 19, 3, 36, 98, 36570 }, // Ễ
+    { 18, 31, 20, 1, 30, 94, 36668 }, // ễ
+    { 14, 40, 19, 3, 32, 97, 36762 }, // Ệ
+    { 18, 34, 20, 1, 26, 94, 36859 }, // ệ
+    { 11, 34, 13, 1, 34, 57, 36953 }, // Ỉ
+    { 9, 28, 11, 1, 28, 52, 37010 }, // ỉ
+    { 11, 32, 13, 1, 24, 52, 37062 }, // Ị
+    { 6, 34, 10, 2, 26, 48, 37114 }, // ị
+    { 24, 33, 26, 1, 25, 120, 37162 }, // Ọ
+    { 19, 27, 21, 1, 19, 83, 37282 }, // ọ
+    { 24, 35, 26, 1, 34, 128, 37365 }, // Ỏ
+    { 19, 29, 21, 1, 28, 90, 37493 }, // ỏ
+    { 24, 34, 26, 1, 33, 132, 37583 }, // Ố
+    { 21, 29, 23, 1, 28, 94, 37715 }, // ố
+    { 24, 34, 26, 1, 33, 131, 37809 }, // Ồ
+    { 21, 29, 21, -1, 28, 95, 37940 }, // ồ
+    { 24, 36, 26, 1, 35, 138, 38035 }, // Ổ
+    { 19, 31, 21, 1, 30, 97, 38173 }, // ổ
+    { 24, 37, 26, 1, 36, 140, 38270 }, // Ỗ
+    { 19, 31, 21, 1, 30, 98, 38410 }, // ỗ
+    { 24, 40, 26, 1, 32, 143, 38508 }, // Ộ
+    { 19, 34, 21, 1, 26, 103, 38651 }, // ộ
+    { 28, 33, 30, 1, 32, 133, 38754 }, // Ớ
+    { 23, 27, 25, 1, 26, 97, 38887 }, // ớ
+    { 28, 33, 30, 1, 32, 134, 38984 }, // Ờ
+    { 23, 27, 25, 1, 26, 99, 39118 }, // ờ
+    { 28, 35, 30, 1, 34, 139, 39217 }, // Ở
+    { 23, 29, 25, 1, 28, 102, 39356 }, // ở
+    { 28, 33, 30, 1, 32, 137, 39458 }, // Ỡ
+    { 23, 27, 25, 1, 26, 100, 39595 }, // ỡ
+    { 28, 34, 30, 1, 26, 133, 39695 }, // Ợ
+    { 23, 29, 25, 1, 21, 99, 39828 }, // ợ
+    { 21, 32, 25, 2, 24, 111, 39927 }, // Ụ
+    { 18, 27, 22, 2, 19, 82, 40038 }, // ụ
+    { 21, 35, 25, 2, 34, 120, 40120 }, // Ủ
+    { 18, 29, 22, 2, 28, 87, 40240 }, // ủ
+    { 28, 33, 31, 2, 32, 132, 40327 }, // Ứ
+    { 25, 27, 28, 2, 26, 100, 40459 }, // ứ
+    { 28, 33, 31, 2, 32, 131, 40559 }, // Ừ
+    { 25, 27, 28, 2, 26, 100, 40690 }, // ừ
+    { 28, 35, 31, 2, 34, 137, 40790 }, // Ử
+    { 25, 29, 28, 2, 28, 105, 40927 }, // ử
+    { 28, 33, 31, 2, 32, 133, 41032 }, // Ữ
+    { 25, 27, 28, 2, 26, 105, 41165 }, // ữ
+    { 28, 34, 31, 2, 26, 131, 41270 }, // Ự
+    { 25, 29, 28, 2, 21, 100, 41401 }, // ự
+    { 21, 32, 22, 0, 32, 89, 41501 }, // Ỳ
+    { 20, 34, 21, 0, 26, 95, 41590 }, // ỳ
+    { 21, 32, 22, 0, 24, 87, 41685 }, // Ỵ
+    { 20, 27, 21, 0, 19, 84, 41772 }, // ỵ
+    { 21, 34, 22, 0, 34, 93, 41856 }, // Ỷ
+    { 20, 36, 21, 0, 28, 100, 41949 }, // ỷ
+    { 21, 32, 22, 0, 32, 91, 42049 }, // Ỹ
+    { 20, 34, 21, 0, 26, 98, 42140 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 42238 }, //  
+    { 0, 0, 33, 0, 0, 0, 42238 }, //  
+    { 0, 0, 17, 0, 0, 0, 42238 }, //  
+    { 0, 0, 33, 0, 0, 0, 42238 }, //  
+    { 0, 0, 11, 0, 0, 0, 42238 }, //  
+    { 0, 0, 8, 0, 0, 0, 42238 }, //  
+    { 0, 0, 6, 0, 0, 0, 42238 }, //  
+    { 0, 0, 19, 0, 0, 0, 42238 }, //  
+    { 0, 0, 9, 0, 0, 0, 42238 }, //  
+    { 0, 0, 6, 0, 0, 0, 42238 }, //  
+    { 0, 0, 3, 0, 0, 0, 42238 }, //  
+    { 0, 0, 1, 0, 0, 0, 42238 }, // ​
+    { 0, 0, 1, 0, 0, 0, 42238 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 42238 }, // ‍
+    { 9, 28, 9, -1, 23, 45, 42238 }, // ‎
+    { 9, 28, 2, -8, 23, 46, 42283 }, // ‏
+    { 10, 5, 11, 0, 11, 9, 42329 }, // ‐
+    { 10, 5, 11, 0, 11, 9, 42338 }, // ‑
+    { 17, 5, 19, 1, 14, 18, 42347 }, // ‒
+    { 15, 4, 17, 1, 11, 12, 42365 }, // –
+    { 32, 4, 34, 1, 11, 20, 42377 }, // —
+    { 32, 4, 34, 1, 11, 20, 42397 }, // ―
+    { 13, 34, 18, 3, 26, 102, 42417 }, // ‖
+    { 15, 8, 15, -1, 0, 31, 42519 }, // ‗
+    { 7, 9, 8, 0, 24, 17, 42550 }, // ‘
+    { 7, 9, 8, 0, 24, 15, 42567 }, // ’
+    { 8, 9, 10, 0, 5, 15, 42582 }, // ‚
+    { 7, 9, 8, 0, 24, 15, 42597 }, // ‛
+    { 15, 9, 16, 0, 24, 32, 42612 }, // “
+    { 15, 9, 16, 0, 24, 29, 42644 }, // ”
+    { 15, 9, 17, 1, 4, 29, 42673 }, // „
+    { 15, 9, 16, 0, 24, 30, 42702 }, // ‟
+    { 15, 26, 17, 1, 26, 59, 42732 }, // †
+    { 15, 26, 17, 1, 26, 70, 42791 }, // ‡
+    { 10, 11, 13, 1, 18, 22, 42861 }, // •
+    { 12, 13, 14, 1, 19, 23, 42883 }, // ‣
+    { 7, 7, 17, 5, 6, 12, 42906 }, // ․
+    { 17, 7, 19, 1, 6, 25, 42918 }, // ‥
+    { 26, 7, 29, 1, 6, 35, 42943 }, // …
+    { 7, 7, 9, 1, 12, 12, 42978 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 42990 }, //  
+    { 0, 0, 20, 0, 0, 0, 42990 }, //  
+    { 9, 26, 9, -1, 21, 39, 42990 }, // ‪
+    { 9, 26, 2, -8, 21, 39, 43029 }, // ‫
+    { 8, 28, 5, -4, 23, 39, 43068 }, // ‬
+    { 8, 28, 5, -4, 23, 44, 43107 }, // ‭
+    { 8, 28, 5, -4, 23, 44, 43151 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 43195 }, //  
+    { 41, 26, 43, 1, 25, 178, 43195 }, // ‰
+    { 55, 26, 56, 0, 25, 229, 43373 }, // ‱
+    { 10, 9, 12, 1, 24, 14, 43602 }, // ′
+    { 17, 9, 19, 1, 24, 28, 43616 }, // ″
+    { 25, 9, 27, 1, 24, 42, 43644 }, // ‴
+    { 10, 9, 14, 1, 24, 14, 43686 }, // ‵
+    { 17, 9, 21, 1, 24, 27, 43700 }, // ‶
+    { 25, 9, 29, 1, 24, 41, 43727 }, // ‷
+    { 13, 11, 14, 0, 3, 29, 43768 }, // ‸
+    { 10, 16, 12, 1, 17, 30, 43797 }, // ‹
+    { 10, 16, 12, 1, 17, 29, 43827 }, // ›
+    { 26, 26, 28, 1, 25, 116, 43856 }, // ※
+    { 17, 25, 19, 1, 24, 83, 43972 }, // ‼
+    { 16, 26, 17, 0, 25, 59, 44055 }, // ‽
+    { 18, 4, 18, -1, 29, 24, 44114 }, // ‾
+    { 20, 8, 21, 0, 0, 26, 44138 }, // ‿
+    { 20, 8, 21, 0, 27, 26, 44164 }, // ⁀
+    { 14, 22, 15, 0, 14, 52, 44190 }, // ⁁
+    { 37, 31, 38, 0, 26, 163, 44242 }, // ⁂
+    { 10, 5, 12, 1, 11, 9, 44405 }, // ⁃
+    { 18, 24, 12, -7, 24, 49, 44414 }, // ⁄
+    { 9, 30, 12, 2, 24, 64, 44463 }, // ⁅
+    { 9, 30, 11, 0, 24, 65, 44527 }, // ⁆
+    { 31, 26, 32, 0, 25, 118, 44592 }, // ⁇
+    { 24, 26, 25, 0, 25, 97, 44710 }, // ⁈
+    { 24, 26, 26, 1, 25, 103, 44807 }, // ⁉
+    { 17, 19, 20, 1, 19, 47, 44910 }, // ⁊
+    { 18, 31, 22, 2, 26, 112, 44957 }, // ⁋
+    { 18, 18, 22, 1, 19, 66, 45069 }, // ⁌
+    { 19, 18, 22, 2, 19, 62, 45135 }, // ⁍
+    { 18, 17, 19, 0, 9, 49, 45197 }, // ⁎
+    { 8, 24, 10, 1, 19, 31, 45246 }, // ⁏
+    { 20, 35, 21, 0, 27, 76, 45277 }, // ⁐
+    { 18, 34, 19, 0, 26, 98, 45353 }, // ⁑
+    { 14, 26, 15, 0, 25, 62, 45451 }, // ⁒
+    { 32, 7, 34, 1, 13, 35, 45513 }, // ⁓
+    { 20, 8, 21, 0, 0, 27, 45548 }, // ⁔
+    { 17, 17, 19, 1, 17, 49, 45575 }, // ⁕
+    { 17, 26, 19, 1, 25, 53, 45624 }, // ⁖
+    { 31, 9, 33, 1, 24, 53, 45677 }, // ⁗
+    { 27, 26, 29, 1, 25, 76, 45730 }, // ⁘
+    { 27, 26, 29, 1, 25, 85, 45806 }, // ⁙
+    { 7, 26, 10, 1, 25, 28, 45891 }, // ⁚
+    { 21, 28, 23, 1, 27, 68, 45919 }, // ⁛
+    { 27, 27, 29, 1, 25, 108, 45987 }, // ⁜
+    { 7, 27, 9, 1, 26, 36, 46095 }, // ⁝
+    { 7, 26, 10, 1, 25, 47, 46131 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 46178 }, //  
+    { 0, 0, 20, 0, 0, 0, 46178 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 46178 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 46178 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 46178 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 46178 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 46178 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 46178 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 46178 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 46178 }, // ⁩
+    { 8, 28, 5, -4, 23, 44, 46178 }, // ⁪
+    { 8, 28, 5, -4, 23, 46, 46222 }, // ⁫
+    { 8, 28, 5, -4, 23, 43, 46268 }, // ⁬
+    { 8, 29, 5, -4, 24, 44, 46311 }, // ⁭
+    { 8, 28, 5, -4, 23, 46, 46355 }, // ⁮
+    { 8, 28, 5, -4, 23, 43, 46401 }, // ⁯
+    { 12, 16, 13, 0, 29, 37, 46444 }, // ⁰
+    { 5, 16, 7, 1, 25, 25, 46481 }, // ⁱ
+    { 13, 16, 14, 0, 29, 42, 46506 }, // ⁴
+    { 11, 16, 13, 1, 29, 37, 46548 }, // ⁵
+    { 12, 16, 13, 0, 29, 39, 46585 }, // ⁶
+    { 12, 16, 13, 0, 29, 24, 46624 }, // ⁷
+    { 12, 16, 13, 0, 29, 43, 46648 }, // ⁸
+    { 12, 16, 13, 0, 29, 40, 46691 }, // ⁹
+    { 10, 10, 12, 1, 25, 19, 46731 }, // ⁺
+    { 10, 4, 12, 1, 22, 5, 46750 }, // ⁻
+    { 10, 7, 12, 1, 23, 12, 46755 }, // ⁼
+    { 6, 20, 9, 2, 31, 30, 46767 }, // ⁽
+    { 6, 20, 8, 0, 31, 29, 46797 }, // ⁾
+    { 12, 12, 14, 1, 21, 40, 46826 }, // ⁿ
+    { 12, 16, 13, 0, 11, 37, 46866 }, // ₀
+    { 9, 16, 13, 1, 11, 26, 46903 }, // ₁
+    { 12, 16, 13, 0, 11, 32, 46929 }, // ₂
+    { 12, 16, 13, 0, 11, 40, 46961 }, // ₃
+    { 13, 16, 14, 0, 11, 42, 47001 }, // ₄
+    { 11, 16, 13, 1, 11, 37, 47043 }, // ₅
+    { 12, 16, 13, 0, 11, 39, 47080 }, // ₆
+    { 12, 16, 13, 0, 11, 24, 47119 }, // ₇
+    { 12, 16, 13, 0, 11, 43, 47143 }, // ₈
+    { 12, 16, 13, 0, 11, 40, 47186 }, // ₉
+    { 10, 10, 12, 1, 8, 19, 47226 }, // ₊
+    { 10, 4, 12, 1, 5, 5, 47245 }, // ₋
+    { 10, 7, 12, 1, 6, 12, 47250 }, // ₌
+    { 6, 20, 9, 2, 13, 30, 47262 }, // ₍
+    { 6, 20, 8, 0, 13, 29, 47292 }, // ₎
+    { 12, 12, 13, 0, 8, 35, 47321 }, // ₐ
+    { 11, 12, 13, 1, 8, 33, 47356 }, // ₑ
+    { 12, 12, 14, 1, 8, 33, 47389 }, // ₒ
+    { 13, 12, 14, 0, 8, 31, 47422 }, // ₓ
+    { 12, 12, 13, 0, 8, 30, 47453 }, // ₔ
+    { 12, 16, 14, 1, 12, 40, 47483 }, // ₕ
+    { 13, 16, 15, 1, 12, 41, 47523 }, // ₖ
+    { 4, 16, 6, 1, 12, 16, 47564 }, // ₗ
+    { 19, 12, 21, 1, 8, 51, 47580 }, // ₘ
+    { 12, 12, 14, 1, 8, 35, 47631 }, // ₙ
+    { 12, 16, 14, 1, 8, 44, 47666 }, // ₚ
+    { 10, 12, 11, 0, 8, 28, 47710 }, // ₛ
+    { 9, 15, 10, 0, 11, 29, 47738 }, // ₜ
+    { 19, 25, 20, 0, 25, 81, 47767 }, // ₠
+    { 19, 28, 21, 1, 26, 109, 47848 }, // ₡
+    { 18, 26, 20, 1, 25, 87, 47957 }, // ₢
+    { 18, 24, 19, 0, 24, 65, 48044 }, // ₣
+    { 18, 25, 20, 1, 25, 76, 48109 }, // ₤
+    { 29, 27, 33, 2, 23, 129, 48185 }, // ₥
+    { 19, 24, 20, 0, 24, 91, 48314 }, // ₦
+    { 27, 25, 30, 2, 24, 119, 48405 }, // ₧
+    { 28, 25, 31, 2, 24, 124, 48524 }, // ₨
+    { 25, 24, 26, 0, 24, 121, 48648 }, // ₩
+    { 26, 24, 31, 2, 24, 123, 48769 }, // ₪
+    { 21, 32, 23, 1, 26, 117, 48892 }, // ₫
+    { 18, 25, 20, 1, 24, 78, 49009 }, // €
+    { 20, 24, 21, 0, 24, 90, 49087 }, // ₭
+    { 19, 24, 20, 0, 24, 72, 49177 }, // ₮
+    { 33, 33, 34, 0, 25, 152, 49249 }, // ₯
+    { 19, 33, 20, 0, 25, 99, 49401 }, // ₰
+    { 19, 24, 20, 0, 24, 78, 49500 }, // ₱
+    { 21, 29, 24, 1, 26, 121, 49578 }, // ₲
+    { 22, 24, 23, 0, 24, 89, 49699 }, // ₳
+    { 19, 26, 20, 0, 25, 83, 49788 }, // ₴
+    { 20, 29, 22, 1, 26, 105, 49871 }, // ₵
+    { 23, 24, 24, 0, 23, 88, 49976 }, // ₶
+    { 24, 28, 25, 0, 25, 117, 50064 }, // ₷
+    { 19, 24, 20, 0, 24, 66, 50181 }, // ₸
+    { 16, 24, 19, 2, 24, 65, 50247 }, // ₹
+    { 19, 25, 20, 0, 24, 82, 50312 }, // ₺
+    { 27, 26, 28, 0, 25, 108, 50394 }, // ₻
+    { 27, 24, 29, 1, 24, 96, 50502 }, // ₼
+    { 20, 24, 21, 0, 24, 83, 50598 }, // ₽
+    { 24, 26, 26, 1, 26, 113, 50681 }, // ₾
+    { 15, 32, 19, 3, 28, 92, 50794 }, // ₿
+    { 16, 25, 18, 1, 19, 74, 50886 }, // ⃀
+    { 17, 5, 19, 1, 14, 19, 50960 }, // −
+    { 31, 32, 33, 1, 26, 132, 50979 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
@@ -5579,4 +4017,5 @@ static const EpdFontData notosans_16_bold = {
     36,
     -10,
     true,
+    true,
 };
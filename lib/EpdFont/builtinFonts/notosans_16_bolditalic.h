@@ -2,5875 +2,3990 @@
  * generated by fontconvert.py
  * name: notosans_16_bolditalic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_bolditalicBitmaps[81313] = {
-    0x00, 0x3F, 0xF4, 0x01, 0xFF, 0xD0, 0x07, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x03, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0x80, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x02, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0xC0, 0x0B, 0xFF, 0x00, 0x0F,
-    0xF4, 0x00, 0x05, 0x00, 0x00, 0x1F, 0xE0, 0xFF, 0x4B, 0xF8, 0x3F, 0xC3, 0xFD, 0x1F, 0xF0, 0xFF,
-    0x07, 0xF8, 0x3F, 0x82, 0xFD, 0x1F, 0xD0, 0xBF, 0x07, 0xF0, 0x3F, 0x82, 0xFC, 0x0F, 0xD0, 0xBD,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x41, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00,
-    0x00, 0xFE, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x01, 0x5B, 0xF5, 0x7F, 0xD5, 0x40, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xF7, 0xE6, 0xF0, 0x02, 0xFF, 0x4F,
-    0x40, 0x00, 0x0B, 0xFC, 0x3C, 0x00, 0x00, 0x2F, 0xF9, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x03, 0xD7, 0xFF, 0x00, 0x00, 0x0F, 0x0F,
-    0xFC, 0x09, 0x00, 0x7C, 0x7F, 0xE0, 0x3F, 0x92, 0xF7, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xE9, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC2,
-    0xFD, 0x00, 0xBF, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x03,
-    0xFC, 0x1F, 0xE1, 0xFD, 0x0A, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF, 0xF0, 0x3F, 0xEF, 0xFC,
-    0xFF, 0x3F, 0xFF, 0xE0, 0xBF, 0xFF, 0xCB, 0xF2, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0x4F, 0xF4,
-    0xFF, 0x40, 0x6E, 0x43, 0xF8, 0x7F, 0x82, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x00,
-    0xFF, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x0F, 0xF1, 0xFF,
-    0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x03, 0xFC,
-    0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x07,
-    0xFC, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0x9F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x2F, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFC, 0x0F, 0xFF, 0x3F, 0xF8, 0x3F, 0xE0, 0x7F, 0xF0, 0x3F, 0xF7, 0xFF, 0x02, 0xFF, 0x40,
-    0x7F, 0xFF, 0xF4, 0x0F, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xFC, 0x00, 0xFF,
-    0xF0, 0x07, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0x02, 0xFF, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE2, 0xFE, 0x3F, 0xD3, 0xFC, 0x3F, 0x87, 0xF4, 0x7F, 0x0B, 0xF0, 0xBD, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0F,
-    0xF4, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x0E, 0x00, 0xFD, 0x00, 0x07, 0xF8, 0x3F, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x14, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xD1, 0x64, 0x0B, 0xFE,
-    0xFC, 0x00, 0x0B, 0xFC, 0x7F, 0x00, 0x02, 0xFE, 0x0F, 0xE0, 0x00, 0x1F, 0x03, 0xFC, 0x00, 0x01,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x02, 0xAA, 0xBF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x7F, 0xD0, 0x2F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFC,
-    0x01, 0xFE, 0x00, 0x15, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xFF, 0x2F, 0xFC, 0xBF, 0xF1, 0xFF, 0x40, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8,
-    0x2F, 0xF8, 0x0B, 0xFF, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0xFF, 0xC3,
-    0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x0F, 0xFC, 0xBF, 0xE0, 0x00,
-    0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x02, 0xFF, 0x8F, 0xFC, 0x00, 0x3F, 0xF4, 0xFF,
-    0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0xC0, 0x0F, 0xFD, 0x0F, 0xFC, 0x01, 0xFF,
-    0xC0, 0xBF, 0xE0, 0x7F, 0xF4, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xEF, 0xFC, 0x03, 0xFC, 0x3F, 0xE0, 0x07, 0x81, 0xFF, 0x40, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0x41, 0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xFF, 0xC0, 0x01, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x03, 0xE0, 0x0F, 0xFF, 0x00, 0x10, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x1A, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF4, 0xE4, 0x00, 0x1F, 0xFF, 0x0F, 0xFE, 0xBF, 0xFF, 0xD0,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xDF, 0xF4, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x3F, 0xE2,
-    0xFF, 0x00, 0x02, 0xFF, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x3F, 0xE0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x0F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xE5, 0x55, 0x40, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2D, 0x00,
-    0x0B, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0x81, 0x50, 0x00, 0x1F, 0xF1, 0xFF, 0xF0, 0x02, 0xFF, 0xBF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xF5, 0xFF, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x03, 0xFF,
-    0x07, 0xFD, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x1F, 0xFC, 0x03, 0xFF, 0xEF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x05, 0x55, 0x55, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFA, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0xD0, 0x0F,
-    0xF8, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x42,
-    0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xD0, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x02, 0xFF, 0x80, 0xFF, 0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0xBF, 0xF9, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xD1, 0xFF, 0xC0, 0x1F, 0xF8, 0xBF, 0xD0, 0x03, 0xFE,
-    0x3F, 0xF0, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x1F,
-    0xFE, 0x2F, 0xFD, 0x6F, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xEF, 0xF0, 0x0F, 0xFF,
-    0xCF, 0xFC, 0x00, 0x6A, 0x47, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xE0, 0x2F, 0xAF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x2F, 0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x07, 0xFF, 0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0x00, 0x7F, 0xD0, 0x00, 0x50, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x03,
-    0xFE, 0x00, 0x07, 0xFD, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0x7F, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x10, 0x2A, 0xAA, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x55, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x3E, 0x00, 0xFF, 0xD0, 0x40, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xF4,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x95, 0x5B, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x05,
-    0x50, 0x07, 0xF8, 0x07, 0xF8, 0x01, 0xFF, 0xFF, 0x43, 0xFC, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0x42,
-    0xFC, 0x1F, 0xD0, 0x3F, 0xFA, 0xFF, 0x01, 0xFC, 0x2F, 0xC0, 0xBF, 0x80, 0xBF, 0x01, 0xFC, 0x3F,
-    0x80, 0xFF, 0x00, 0xFE, 0x01, 0xFC, 0x3F, 0x42, 0xFD, 0x00, 0xFD, 0x02, 0xFC, 0x7F, 0x43, 0xFC,
-    0x01, 0xFC, 0x03, 0xFC, 0x7F, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x7F, 0x03, 0xF8, 0x03, 0xF8,
-    0x0B, 0xF0, 0x7F, 0x03, 0xF8, 0x0F, 0xF8, 0x1F, 0xE0, 0x7F, 0x43, 0xFE, 0x6F, 0xFD, 0xBF, 0xC0,
-    0x3F, 0x82, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0x3F, 0xC0, 0xBF, 0xF4, 0xFF, 0xFC, 0x00, 0x2F, 0xD0,
-    0x1A, 0x80, 0x1A, 0x90, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x01, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC,
-    0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4,
-    0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x40, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF5, 0x5B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x3F, 0xF0,
-    0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80,
-    0x6F, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x1B, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xE0, 0x00,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xE0, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x02, 0xFF, 0x40,
-    0x00, 0xFF, 0xD0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xE0,
-    0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x0F, 0xFC,
-    0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55,
-    0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAA, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA,
-    0xA9, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE4, 0x06, 0xF0,
-    0x01, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x55,
-    0x50, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x43, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF,
-    0xFF, 0x03, 0xFF, 0x00, 0x6A, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x40,
-    0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA, 0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x14, 0x6F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC7, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x02,
-    0xFE, 0xFF, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xF6,
-    0xFE, 0x00, 0x0F, 0xF6, 0xFC, 0x00, 0xFF, 0x3F, 0xE0, 0x01, 0xFF, 0x2F, 0xC0, 0x2F, 0xD3, 0xFD,
-    0x00, 0x1F, 0xF2, 0xFC, 0x03, 0xFC, 0x7F, 0xC0, 0x02, 0xFF, 0x2F, 0xC0, 0xBF, 0x4B, 0xFC, 0x00,
-    0x3F, 0xE2, 0xFD, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x1F, 0xD2, 0xFD, 0x0F, 0xF4, 0x00, 0x7F,
-    0xC1, 0xFD, 0x3F, 0xC1, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xDB, 0xF4, 0x2F, 0xF0, 0x00, 0xFF, 0x81,
-    0xFE, 0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF,
-    0xFC, 0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0x40, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00,
-    0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00,
-    0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF,
-    0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0,
-    0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01,
-    0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0,
-    0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F, 0xFF,
-    0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00,
-    0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF,
-    0xC0, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF,
-    0xAB, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0xA5, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x47, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x0B,
-    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0xBF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
-    0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFE, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x0F, 0xFD, 0x03, 0xFF, 0x00, 0x0F,
-    0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xD0, 0x2F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x6E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x79, 0x00, 0x2F, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x2F, 0xF4, 0xBF, 0xC0, 0x00, 0x3F, 0xF0, 0xBF, 0xC0, 0x00, 0xBF, 0xD0, 0xBF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x7F, 0xC0, 0x02, 0xFF, 0x40, 0x7F, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xD0, 0x0B,
-    0xFD, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x3F, 0xD0, 0x2F, 0xF4, 0x00, 0x3F, 0xD0, 0x3F, 0xF0,
-    0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x00, 0x3F, 0xE1, 0xFF, 0x40, 0x00,
-    0x2F, 0xE3, 0xFF, 0x00, 0x00, 0x2F, 0xE7, 0xFD, 0x00, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x00, 0x1F,
-    0xEF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x7F, 0xC0, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0xFF, 0x80, 0x01, 0xFF,
-    0xC0, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF4, 0xFF, 0x80, 0x03, 0xFF, 0xC0,
-    0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0x80, 0x0F, 0xFF, 0xD0, 0x0B,
-    0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0x80, 0x3F, 0xEF, 0xD0, 0x2F, 0xF4,
-    0x0B, 0xF8, 0x07, 0xFA, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0x2F, 0xD0, 0x7F, 0xD0, 0x0B,
-    0xFC, 0x1F, 0xF2, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xC3, 0xFD, 0x2F, 0xD0, 0xFF, 0x40, 0x0B, 0xFC,
-    0x7F, 0xC1, 0xFD, 0x2F, 0xF0, 0x00, 0xBF, 0xCB, 0xF8, 0x1F, 0xD3, 0xFE, 0x00, 0x0B, 0xF8, 0xFF,
-    0x01, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x9F, 0xE0, 0x1F, 0xDF, 0xF8, 0x00, 0x07, 0xFB, 0xFC, 0x01,
-    0xFD, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF4,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF,
-    0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x15,
-    0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xA4, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0x40, 0x00, 0x55, 0x54, 0x00, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x2F, 0xD0, 0x0B, 0xF8, 0x01, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
-    0x40, 0x2F, 0xE0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFD, 0x00, 0xBF,
-    0x40, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF4, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xAF, 0xFC,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0B, 0xF6,
-    0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x0B, 0xF4, 0x0F, 0xF0, 0x00,
-    0xFE, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x02,
-    0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xC2, 0xA4, 0x00, 0x00, 0xA8, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xE1, 0x55, 0x55, 0x55, 0x00, 0x2A, 0xA0, 0x3F, 0xF4, 0x0F, 0xF8, 0x07, 0xFC, 0x01, 0xFD,
-    0x00, 0xBE, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF, 0x41, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07,
-    0xFD, 0x07, 0xFE, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x07, 0xFF, 0x02,
-    0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x9F, 0xE0, 0x00, 0x7F, 0xF4, 0xBF, 0x80, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x00, 0x00, 0xBF, 0xCB, 0xFF, 0x40, 0x03, 0xFF, 0xBF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x7F, 0xFC, 0x02, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F,
-    0xFD, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0x80, 0x0B, 0xFD, 0x07, 0xFC, 0x00,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4,
-    0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xF4, 0x0F, 0xFE, 0x02, 0xFF, 0xFA, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xCF, 0xFF, 0xF4, 0x01, 0xFE, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80, 0x3F, 0xFF,
-    0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x94, 0x2F, 0xF4, 0x00, 0x1F, 0xFE, 0x2F, 0xF0, 0x00,
-    0xBF, 0xFF, 0xBF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xDB, 0xFF, 0xD0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0xFF, 0x80, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0xBF, 0xD0, 0x03, 0xFE, 0x00, 0xBF, 0xE0, 0x0B, 0xFE, 0x00, 0x7F, 0xF0, 0x1F, 0xFD, 0x00,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x07,
-    0xFF, 0x87, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x81, 0xFF, 0x83, 0xFF,
-    0x40, 0x3F, 0xE1, 0xFF, 0x80, 0x0F, 0xF8, 0xBF, 0xD0, 0x1F, 0xFD, 0x3F, 0xFA, 0xBF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0xF9, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x58, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2B, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07,
-    0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC,
-    0x00, 0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74,
-    0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x40, 0x00, 0xBF,
-    0xCB, 0xFF, 0x80, 0x03, 0xFF, 0xBF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x6F,
-    0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xF4, 0x0F, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF,
-    0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0x40, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00,
-    0x2F, 0xF0, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x07, 0xFE,
-    0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x4B, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x3F, 0xF7,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F,
-    0xF8, 0x00, 0x07, 0xFD, 0x07, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x1F,
-    0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE,
-    0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x06, 0x50, 0x00, 0x2F, 0xC2, 0xFF,
-    0xE0, 0x1F, 0xFF, 0x00, 0x0F, 0xF2, 0xFF, 0xFD, 0x2F, 0xFF, 0xE0, 0x03, 0xFE, 0xFF, 0xFF, 0xDF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xFF, 0xEB, 0xFF, 0x40, 0xBF, 0xF8, 0x0F, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x1F, 0xF4, 0x0F, 0xFD, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x03,
-    0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xF8, 0x00,
-    0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF4,
-    0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x3F, 0xEF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF,
-    0x40, 0xFF, 0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03,
-    0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEB, 0xFF,
-    0x40, 0xFF, 0xE0, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8,
-    0xBF, 0xD0, 0x03, 0xFF, 0x47, 0xFE, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xEF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x02, 0xFC, 0x2F, 0xFD, 0x00, 0x00,
-    0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0x00, 0x0B,
-    0xFF, 0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F,
-    0xE0, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xFD,
-    0x03, 0xFF, 0x80, 0x0B, 0xFF, 0xEB, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xAF,
-    0xFF, 0xD0, 0x00, 0x7F, 0xD2, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x05, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xDB, 0xFF, 0xD0, 0x3F, 0xF8, 0x07, 0xFF, 0x01, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x03,
-    0xFD, 0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0xBF, 0xD0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x2F, 0xF8, 0x07, 0xFF, 0x01, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x7F, 0xE0, 0x00, 0x7F, 0xF4, 0xFF, 0x40, 0x00, 0x04, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0xFF, 0x6F, 0xFC, 0x00,
-    0xFF, 0xBF, 0xF8, 0x01, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xF9, 0x10, 0x03, 0xFF, 0xD0, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xA5, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0x01, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x50, 0x00, 0xBF, 0xD0, 0xBE, 0x9B, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x2B, 0xFF, 0xAA, 0x40, 0x3F,
-    0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0xEF, 0x00, 0x3F, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02,
-    0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80,
-    0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x07, 0xFF,
-    0x00, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF7, 0xFC, 0x00, 0x7F, 0xFF, 0x8F, 0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xC0, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFE, 0x3F, 0xE0, 0x00, 0xFF, 0xC3,
-    0xFE, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x0F,
-    0xFC, 0x02, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF0, 0x3F, 0xF0, 0x01, 0xFF, 0x0B, 0xFD, 0x00, 0x0F,
-    0xF0, 0xFF, 0xC0, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x0F, 0xF7, 0xFE, 0x00, 0x00, 0xFF, 0xBF, 0xC0,
-    0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x07, 0xFE, 0xFF, 0x80, 0x2F, 0xFD, 0x00, 0xFF, 0xCF, 0xF8, 0x03, 0xFF, 0xD0,
-    0x0F, 0xF8, 0xFF, 0x80, 0x7F, 0xFD, 0x02, 0xFF, 0x0F, 0xF8, 0x0F, 0xEF, 0xD0, 0x3F, 0xE0, 0xBF,
-    0x81, 0xFD, 0xFD, 0x0B, 0xFD, 0x0B, 0xF8, 0x3F, 0xCF, 0xD0, 0xFF, 0xC0, 0xBF, 0x83, 0xF8, 0xFD,
-    0x1F, 0xF4, 0x0B, 0xF8, 0xBF, 0x0F, 0xD3, 0xFF, 0x00, 0xBF, 0x8F, 0xF0, 0xFD, 0x3F, 0xD0, 0x07,
-    0xF9, 0xFD, 0x0F, 0xDB, 0xFC, 0x00, 0x7F, 0xBF, 0xC0, 0xFD, 0xFF, 0x40, 0x07, 0xFB, 0xF8, 0x0F,
-    0xEF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
-    0x3F, 0xF4, 0x0B, 0xFF, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0x00, 0xBF, 0xDB, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x01, 0xFF,
-    0x80, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF8, 0x00,
-    0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x7F,
-    0xD0, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xAA, 0xAF, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x02, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x1E, 0x90,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x2F, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xC0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x03, 0xFE, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xBF,
-    0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x73, 0xFF,
-    0xFF, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x06, 0xFF, 0xFF, 0x84, 0x00, 0x06, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0,
-    0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF0,
-    0x02, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xD5, 0xB4, 0x0F, 0xFF, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF4, 0x01, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x00, 0x0F, 0xFE, 0x01, 0xA0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1A, 0xBF, 0xFA, 0xA4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x02, 0xFE, 0xFF, 0xEF, 0xF0, 0xBF, 0xFF, 0xFF, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0x47, 0xFD, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x07, 0xF0,
-    0x0F, 0xE0, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x0F, 0xFE, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x6A, 0x4B, 0xC0, 0x08, 0x00,
-    0x00, 0x80, 0x0B, 0xFC, 0x00, 0x07, 0xFE, 0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x03, 0xFD, 0x00, 0x2F,
-    0xF4, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x01, 0xFF, 0x40,
-    0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0xBF, 0x9F, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0A, 0xBF,
-    0xFF, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0x6F, 0xF5,
-    0x50, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1A, 0xBF, 0xFA, 0x90, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0xBF, 0xE5, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xBF,
-    0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x6A, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xEB, 0xFC, 0x00, 0xBF, 0xC0,
-    0x0A, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xFB, 0xFF, 0x80, 0x0F, 0xF0, 0x3F, 0xF0, 0x07,
-    0xF8, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xC0, 0x0F, 0xFD, 0x3F, 0xD0,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x0B, 0x40, 0x0B, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x81, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F, 0xC3, 0xFD, 0x3F, 0x82, 0xFC, 0x04, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x16, 0x50, 0x2F, 0x80, 0x07, 0xC0, 0x1F, 0xFF, 0xD0, 0xBD, 0x00, 0xF4,
-    0x07, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFD, 0x00, 0x40, 0x1F, 0x43, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0xF8, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC7, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x7C,
-    0x07, 0xD0, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xD0, 0x00,
-    0x00, 0x07, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x82,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0xF4, 0x0F, 0x40, 0xFF, 0xAB, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xFF,
-    0xFC, 0x07, 0xD0, 0x03, 0xF0, 0x02, 0xA9, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x87,
-    0xC0, 0x7F, 0xFF, 0xF0, 0x3F, 0xEB, 0xFC, 0x2F, 0xC0, 0xFE, 0x0F, 0xE0, 0x3F, 0x47, 0xF0, 0x0F,
-    0xC1, 0xFC, 0x03, 0xF0, 0xBF, 0x02, 0xF8, 0x2F, 0xC0, 0xFD, 0x07, 0xFE, 0xFF, 0x00, 0xBF, 0xEB,
-    0xC0, 0x06, 0x91, 0x90, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0x7F,
-    0xE0, 0x7F, 0xE0, 0x0F, 0xFC, 0x1F, 0xFD, 0x03, 0xFF, 0x43, 0xFF, 0x40, 0xFF, 0xE0, 0xFF, 0xE0,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x0B, 0xFF, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0xBF, 0xE0, 0x03, 0xFF, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x3F, 0xF4, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x7F, 0xD0, 0x03, 0xE4, 0x03, 0xE4, 0x00, 0x10, 0x00, 0x10, 0x00, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x8F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x1B, 0xF8, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x05, 0x55, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0xFF, 0xFF,
-    0x00, 0xBD, 0x00, 0xF4, 0x0F, 0xFF, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xFC, 0x0B, 0xE0, 0x1F, 0x43,
-    0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x3C, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xC7, 0xC0, 0x0F, 0xC0,
-    0x7E, 0x00, 0x7C, 0x7C, 0x00, 0xFD, 0x6F, 0xC0, 0x07, 0xC7, 0xC0, 0x0F, 0xFF, 0xF0, 0x00, 0x7C,
-    0x7C, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xC3, 0xC0, 0x0F, 0xC2, 0xF0, 0x00, 0xBC, 0x3D, 0x00, 0xFC,
-    0x0F, 0xC0, 0x0F, 0x82, 0xF0, 0x0F, 0xC0, 0xBD, 0x00, 0xF4, 0x0F, 0x40, 0xFC, 0x03, 0xF0, 0x2F,
-    0x00, 0xBC, 0x0F, 0xC0, 0x1F, 0x87, 0xD0, 0x03, 0xF0, 0x54, 0x00, 0x55, 0xFC, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA,
-    0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x6A, 0xAA, 0xAA, 0xA8, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7F, 0x41, 0xFD, 0xBE, 0x00, 0xBE,
-    0xBE, 0x00, 0x7F, 0xBE, 0x00, 0xBE, 0x7F, 0x41, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF4, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xAA,
-    0xBF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x0A, 0xAA, 0xAA,
-    0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0x50, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xEF, 0xFC, 0x00, 0x90, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF,
-    0xE0, 0x0F, 0x9B, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xC0, 0x05, 0x7F, 0xC0, 0x03, 0xFF,
-    0x80, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC1, 0x00, 0x0F, 0xF0, 0xBA, 0x6F,
-    0xF8, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x6A, 0x90, 0x1F, 0xFC,
-    0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x01, 0xFF,
-    0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x2F, 0xFF, 0xBF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFB, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0xBF, 0x00, 0x07, 0xFE, 0xFF,
-    0x4B, 0xF0, 0x00, 0xBF, 0xD1, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x55, 0x55, 0x40, 0x1F, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xF0, 0x3E, 0x7F, 0xFF, 0xFF, 0x03, 0xEB, 0xFF,
-    0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xFF, 0x03, 0xEB, 0xFF, 0xFF, 0xF0, 0x3E, 0xBF, 0xFF, 0xFF, 0x03,
-    0xE7, 0xFF, 0xFF, 0xF0, 0x3E, 0x3F, 0xFF, 0xFF, 0x03, 0xE3, 0xFF, 0xFF, 0xF0, 0x3E, 0x1F, 0xFF,
-    0xFF, 0x03, 0xE0, 0xBF, 0xFF, 0xF0, 0x3E, 0x01, 0xFF, 0xFF, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E,
-    0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01,
-    0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x1F,
-    0x03, 0xE0, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x47, 0xFF,
-    0x2F, 0xFC, 0xFF, 0xF1, 0xFF, 0x00, 0x50, 0x00, 0x02, 0xF4, 0x01, 0xFE, 0x00, 0x7F, 0xF0, 0x03,
-    0xFC, 0x00, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0xFF, 0xE0, 0xBF, 0xFD, 0x7F, 0xFF, 0xCB, 0xFF, 0xFC, 0x3E, 0x3F, 0x81, 0x07, 0xF4, 0x00, 0xBF,
-    0x40, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFD, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0xF4, 0x0F, 0xFB, 0xFC, 0x1F, 0xD1, 0xFC, 0x3F, 0x80,
-    0xFD, 0x3F, 0x40, 0xFC, 0x3F, 0x01, 0xFC, 0x3F, 0x02, 0xFC, 0x3F, 0x47, 0xF4, 0x3F, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xC0, 0x02, 0xF9, 0x00, 0x00, 0x14, 0x00, 0x14, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x07,
-    0xFD, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x02, 0xFF, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x1F,
-    0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x0B, 0xFE, 0x0B, 0xFD, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x3F,
-    0xF4, 0x3F, 0xF4, 0x0F, 0xFD, 0x0F, 0xFD, 0x02, 0xFF, 0x83, 0xFF, 0x80, 0xBF, 0xE0, 0xBF, 0xE0,
-    0x07, 0xFC, 0x07, 0xFC, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xBF,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x7F, 0x40, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0x80, 0x1F, 0xFF, 0xF0,
-    0x00, 0x3F, 0xC0, 0x02, 0xE3, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x10, 0xFF, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0B,
-    0xF4, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xF4, 0x03, 0xFD, 0x00, 0xFF, 0x03, 0xF8, 0x03, 0xFF, 0x40,
-    0x7F, 0x83, 0xFC, 0x03, 0xFF, 0xC0, 0x2F, 0xD2, 0xFD, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x01, 0xFD, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0xBF, 0x00, 0x00,
-    0xBF, 0x40, 0xFD, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0xFD, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xD0, 0x2F, 0xD0, 0x0A, 0xAA, 0xFF, 0xA0, 0x1F, 0xE0,
-    0x00, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00,
-    0x7F, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xE3, 0xFC, 0x00, 0x3F, 0xC0, 0x00,
-    0x01, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xF0, 0x05, 0x40, 0x00, 0x3F, 0xC0, 0x7F, 0x47,
-    0xFF, 0xF0, 0x00, 0xFF, 0x03, 0xF8, 0xBF, 0xFF, 0xF0, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xD2, 0xFC, 0x01, 0x80, 0xFF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x02,
-    0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0xBE, 0xBF, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x7F, 0x40,
-    0x07, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x6F, 0xD0, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xF4,
-    0x07, 0xFD, 0x7E, 0x6F, 0xFC, 0x3F, 0x80, 0x3F, 0xF1, 0xFF, 0xFF, 0xD3, 0xFC, 0x03, 0xFF, 0xC7,
-    0xFF, 0xF8, 0x2F, 0xD0, 0x3F, 0xFF, 0x00, 0x55, 0x01, 0xFE, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xF0, 0x1F, 0xDF, 0xD0, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x0F, 0xC3,
-    0xFC, 0x00, 0x00, 0x7F, 0x80, 0xFD, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xF4, 0x00,
-    0x3F, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFD, 0x00, 0xAA, 0xAF, 0xFA, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x10, 0xFF, 0xE0, 0x1F, 0x8B, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xD1, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07,
-    0xFD, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4,
-    0x0B, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0x8B, 0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01,
-    0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00,
-    0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80,
-    0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBC, 0x00, 0x00, 0x03,
-    0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0x00, 0x2E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0x03, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0x55,
-    0x56, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x2F,
-    0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x03, 0xFE,
-    0x2F, 0xE0, 0x00, 0x00, 0x3F, 0xD2, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xE7,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0xDF,
-    0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0,
-    0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00,
-    0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xEF, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xEB, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x7F, 0xF1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x07, 0xFF, 0x55, 0x54, 0x00, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0xAA, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x55, 0x5F, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0x80, 0x6F, 0x40, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x1B, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x03, 0xFD, 0x07,
-    0xFC, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x03, 0xF4, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0F,
-    0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F,
-    0xC0, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x40,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xE3, 0xFF, 0xFF, 0xF4,
-    0x0B, 0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x17, 0xFF, 0x54,
-    0x01, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0,
-    0x01, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x07,
-    0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xD1, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01,
-    0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00,
-    0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4,
-    0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00,
-    0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F,
-    0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00,
-    0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0,
-    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07,
-    0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC,
-    0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4,
-    0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03,
-    0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80,
-    0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD,
-    0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02,
-    0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0,
-    0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFD, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40, 0x00, 0x03, 0xF8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-    0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0,
-    0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF,
-    0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7E, 0x1F, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x06, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F,
-    0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4,
-    0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00,
-    0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
-    0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F,
-    0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0xD0, 0x2F, 0x80, 0x03, 0xF4, 0x7F, 0xE0, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x07, 0xFE,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFC, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x3F, 0xC0,
-    0x07, 0xFC, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x3F, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x80,
-    0x2F, 0xFE, 0x00, 0x7F, 0xF4, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0x40, 0x0B, 0xFF, 0xF0, 0x1F, 0xFC,
-    0x00, 0xBF, 0xFF, 0xC0, 0xFF, 0xD0, 0x07, 0xFA, 0xFF, 0x43, 0xFF, 0x00, 0x3F, 0xCB, 0xFD, 0x1F,
-    0xF8, 0x03, 0xFC, 0x2F, 0xF0, 0xBF, 0xD0, 0x2F, 0xC0, 0xFF, 0xC3, 0xFF, 0x01, 0xFD, 0x03, 0xFF,
-    0x0F, 0xFC, 0x1F, 0xE0, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0x00, 0x7F, 0xE0, 0xFF, 0xCF, 0xF0, 0x03,
-    0xFF, 0x03, 0xFF, 0xBF, 0x40, 0x1F, 0xFC, 0x0F, 0xFF, 0xF4, 0x00, 0xFF, 0xD0, 0x2F, 0xFF, 0x80,
-    0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFE, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0xF0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-    0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07,
-    0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00,
-    0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00, 0x00, 0x03, 0xFD,
-    0x07, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F,
-    0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0,
-    0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x0F,
-    0xF4, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF,
-    0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40,
-    0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF,
-    0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x01, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x3F,
-    0xF8, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x40, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xD6, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xF8, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x4B, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD3, 0xD5, 0x7F, 0xF8, 0x00, 0x03,
-    0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xF0, 0xBF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00,
-    0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-    0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0,
-    0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8,
-    0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80,
-    0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7,
-    0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x0B, 0xF8, 0x07, 0xD0, 0x00, 0xFF, 0xFE, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0x4B, 0xFF, 0xC0, 0x00, 0xF4, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF0,
-    0x00, 0x0B, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80,
-    0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x9F, 0xD0, 0x00, 0x00, 0xBC, 0x0F,
-    0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0xFF, 0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF,
-    0x40, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF,
-    0xD2, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x65, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xDF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xDB, 0xFF, 0xFD, 0x0F, 0xFC, 0x0F, 0xFE, 0x02, 0xFF, 0xF0,
-    0x07, 0xFC, 0x1F, 0xFC, 0x01, 0xFF, 0xC0, 0x0B, 0xFC, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xFC,
-    0x3F, 0xF0, 0x00, 0xFF, 0xEA, 0xFF, 0xF4, 0x3F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xE0,
-    0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0xFA, 0x50, 0x00, 0xBF, 0xD0, 0x07, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFF, 0x80, 0x01,
-    0x40, 0x3F, 0xFE, 0xFF, 0xFF, 0xE5, 0x6F, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x87, 0xE3, 0xFF, 0xF9, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80,
-    0x3F, 0xFF, 0xBF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F,
-    0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x7F, 0xF4,
-    0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xEA, 0x40,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08, 0x03, 0xFF, 0xE5,
-    0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80,
-    0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00,
-    0x3F, 0xD0, 0x7F, 0x80, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F,
-    0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF,
-    0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE,
-    0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00,
-    0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0xFF, 0x4F, 0xF8, 0x00, 0x3F, 0xD3, 0xFD, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0x40, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE,
-    0x00, 0x3F, 0xE2, 0xFF, 0x40, 0x7F, 0xF4, 0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xEA, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x08, 0x03, 0xFF, 0xE5, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x2F, 0xF4, 0x00,
-    0xFF, 0x80, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xBF, 0xD0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x01, 0xFF,
-    0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00,
-    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x00, 0xBF, 0xCB, 0xF4, 0x2F, 0xE0, 0x3F, 0xC7, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0xBF, 0x87, 0xFC, 0x2F, 0xE1, 0xFF, 0x07, 0xF0,
-    0x3F, 0x40, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x3C, 0x00,
-    0x01, 0xFF, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0x2F, 0xF0, 0x00, 0x03, 0x40, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xFD, 0x7F, 0xC0, 0x1F, 0xFF, 0xFB, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFA, 0xFF, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xC3, 0xFF, 0x00, 0x2F, 0xFC, 0x7F, 0xE0,
-    0x01, 0xFF, 0xCB, 0xFD, 0x00, 0x2F, 0xF8, 0xFF, 0xC0, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x3F, 0xF0,
-    0xFF, 0xC0, 0x07, 0xFF, 0x0B, 0xFD, 0x00, 0xFF, 0xD0, 0x7F, 0xF9, 0xBF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xD0, 0x3F, 0x00, 0x01, 0xFF, 0xFE, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xE1, 0xFF, 0xF4, 0x00, 0x0B, 0xC0, 0x1B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0x2F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x02, 0xFF, 0xE0, 0x2F,
-    0xF4, 0x02, 0xFF, 0xC0, 0x2F, 0xF4, 0x03, 0xFF, 0x40, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F, 0xF0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x0F,
-    0xFC, 0x00, 0xBF, 0xD0, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x1F, 0xF4, 0x00, 0xFF, 0xC0, 0x2F, 0xF0,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x7F, 0xE0, 0x03,
-    0xFF, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF,
-    0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE,
-    0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3,
-    0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01,
-    0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F,
-    0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4,
-    0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xF4, 0x0B, 0xC0, 0x00, 0xFF, 0xFE, 0xBF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x01, 0xF0, 0x02, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFA, 0xFF, 0xD0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x7F, 0xF0,
-    0x03, 0xFF, 0x03, 0xFF, 0x40, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC1, 0xFF, 0x80, 0x03, 0xFF, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x2F, 0xF4, 0x00, 0xFF, 0xD0, 0x7F,
-    0xE0, 0x07, 0xFF, 0x01, 0xFF, 0xC0, 0x7F, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x00,
-    0xFF, 0x0F, 0xF4, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07,
-    0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x97, 0xFF,
-    0x40, 0x3F, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0xFC, 0x0F, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0x8B, 0xF3, 0xFF, 0x07, 0xFD, 0x7F, 0x0F, 0xFC, 0x2F, 0xFB, 0xF4,
-    0x7F, 0xE0, 0xBF, 0xFF, 0x82, 0xFF, 0x41, 0xFF, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0xC0, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xAF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x2F, 0x01, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0,
-    0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF,
-    0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F,
-    0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xAA, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0,
-    0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF,
-    0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF,
-    0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F,
-    0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00,
-    0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x02, 0xFF,
-    0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02,
-    0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80,
-    0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0,
-    0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF,
-    0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0x00, 0xBF, 0x87, 0xFC, 0x00, 0x02,
-    0xFE, 0x2F, 0xF0, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0,
-    0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0,
-    0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF,
-    0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F,
-    0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x3F,
-    0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4,
-    0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00, 0x02,
-    0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19, 0x00, 0x00,
-    0x0B, 0xFC, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0xFF, 0xD0, 0x03,
-    0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x2F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFC, 0x00, 0x7F, 0xF4, 0x0F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xBF, 0xFF, 0x40, 0x01, 0xFF, 0x8B, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x14, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0,
-    0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03,
-    0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x55, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00,
-    0x1F, 0xF4, 0x3F, 0xD0, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x0F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0x82, 0xFF, 0x40, 0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0xFF, 0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF,
-    0x40, 0xFF, 0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF,
-    0xC0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03,
-    0xFF, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF,
-    0xD2, 0xFE, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x01, 0xA0, 0x00, 0x00,
-    0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00,
-    0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF,
-    0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5,
-    0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF,
-    0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x0A, 0x80, 0x02, 0x90, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x02,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0,
-    0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF,
-    0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF,
-    0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x0B, 0xF8,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x8B,
-    0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xD0, 0x3F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x07, 0xFE,
-    0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x3F,
-    0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xFF, 0x9F, 0xE0, 0x00, 0x7F, 0xF4, 0xBF, 0x80, 0x00, 0x04, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA5, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0x9B, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x60, 0x03,
-    0xFF, 0xFB, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0x41, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0x8F, 0xF0, 0x00, 0xFF, 0x41, 0xFE, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFF, 0x9B, 0xD0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x60,
-    0x03, 0xFF, 0xFB, 0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xF4, 0x01, 0x80, 0x3F, 0xFF, 0xBF, 0x80,
-    0x1F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x69, 0x00, 0x0A, 0x90, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xD2, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x01, 0xBD, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x40, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x01, 0xB4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x90, 0x07, 0xF8, 0x07, 0xF8, 0x00,
-    0x2F, 0xD2, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x6F, 0x40, 0x0F, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x18, 0x00, 0x3F, 0xFF, 0xBF, 0x80, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x06, 0xA0, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x0F,
-    0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x7F, 0xE0,
-    0x00, 0x2F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0x05, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x65, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0xF6, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x07, 0xFC, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xE0, 0x0B, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF5, 0x6F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x3F, 0xFC,
-    0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x0F, 0xFC, 0x00, 0x0B, 0xFE, 0x2F, 0xFF, 0xFF, 0x40, 0xBF, 0xE3, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xD7, 0xFF, 0xFF, 0xF0, 0x0F, 0xFC, 0x17, 0xFF, 0x54, 0x01,
-    0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xF8, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xD0, 0x01,
-    0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xC1, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2A, 0xAF, 0xFA, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x01, 0x90, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xBF, 0xE0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xDB, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x00,
-    0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x40,
-    0x07, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x3F, 0xE0,
-    0x00, 0x7F, 0xE0, 0x0B, 0xFE, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF7, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x3F,
-    0x40, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50, 0x00, 0x00, 0xBF,
-    0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xE0, 0x7F, 0xE0, 0xFF, 0xD0, 0x0F, 0xF8, 0x7F, 0xE0, 0x03,
-    0xFE, 0x2F, 0xF4, 0x07, 0xFF, 0x4F, 0xFE, 0xAF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFE, 0xA4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x80, 0x3F, 0xFE, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x69, 0x00, 0x00,
-    0xFC, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xD0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1A, 0x40, 0x0A, 0x80, 0x02, 0xF8,
-    0x01, 0xFC, 0x00, 0x1F, 0xFA, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F,
-    0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFE, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0xFF, 0x87, 0xFE, 0x00, 0x3F, 0xE2, 0xFF,
-    0x40, 0x7F, 0xF4, 0xFF, 0xEA, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xEA, 0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08,
-    0x03, 0xFF, 0xE5, 0xBF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00,
-    0x02, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x81, 0xFF,
-    0x83, 0xFF, 0x40, 0x3F, 0xE1, 0xFF, 0x80, 0x0F, 0xF8, 0xBF, 0xD0, 0x1F, 0xFD, 0x3F, 0xFA, 0xBF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0xF9, 0x6F, 0xC0, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x17, 0xF8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x2A, 0x40, 0x00, 0x3F, 0x80, 0x7F, 0xC0, 0x00, 0x0B, 0xF8, 0xBF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF5,
-    0x55, 0x50, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAA,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1A, 0x40, 0x02, 0xA4, 0x00, 0x7F, 0x80, 0x7F, 0x80,
-    0x00, 0xBF, 0x4B, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x0F, 0xFE, 0xAF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xEA, 0x40, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x03, 0xFF,
-    0xE5, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x5F, 0xF0, 0x00, 0x00, 0x7F,
-    0xC0, 0xBF, 0x40, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA9, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x0A, 0x80, 0x00, 0x02, 0xF8,
-    0x01, 0xFC, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x01, 0xA4, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x03, 0xFE, 0xAF, 0xF0, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFE, 0x40, 0x6F, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x55, 0x55, 0x02,
-    0xFF, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xF4, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x3F, 0xFF, 0xF0,
-    0x3F, 0xF0, 0x06, 0xAF, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x03, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x2F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xE4, 0x06, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x05, 0x55, 0x50, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0x43, 0xFF,
-    0x40, 0x3F, 0xFF, 0xF0, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x6A, 0xFF, 0xE0, 0x3F,
-    0xF0, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02,
-    0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0x3F, 0xFF, 0xE7, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x07, 0xFF,
-    0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x2F, 0xF8, 0x01, 0xFF,
-    0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x0F, 0xFF, 0xBF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x00, 0x01, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x74, 0x00,
-    0x7F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8,
-    0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA,
-    0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x40, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xE7, 0xFC, 0x00, 0x03, 0xFD, 0x07, 0xF8, 0x00, 0x3F,
-    0x80, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x06, 0x50, 0x00, 0x2F,
-    0xF2, 0xFF, 0xE0, 0x00, 0xFF, 0xEF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xDB,
-    0xFF, 0x40, 0xBF, 0xF8, 0x0B, 0xFD, 0x03, 0xFF, 0xC0, 0x2F, 0xF4, 0x0F, 0xFD, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0,
-    0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFE, 0x00, 0x3F, 0xF0, 0x1F, 0xF4, 0x00, 0xFF,
-    0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x6B, 0xFF, 0xEA, 0xAA, 0xFF, 0xE9, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0A, 0xFF, 0xFA, 0xAA, 0xBF,
-    0xFA, 0x80, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFE, 0xAA, 0xAB, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xAF,
-    0xFF, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x6B, 0xFF, 0xAA,
-    0x40, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x64, 0x00, 0x03, 0xFF, 0x2F, 0xFE, 0x00,
-    0x0F, 0xFB, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF9, 0xBF, 0xF0, 0x0F, 0xFF,
-    0x40, 0xFF, 0xC0, 0x3F, 0xF8, 0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x0F, 0xFC, 0x00,
-    0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x7F, 0xD0, 0x3F, 0x00, 0x1F, 0xFF, 0xEF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E,
-    0x1F, 0xFF, 0x40, 0x0B, 0xC0, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x0B, 0xF8, 0x03, 0xE0, 0xBF, 0xFE, 0xBF, 0x07, 0xFF, 0xFF, 0xFC, 0x2F, 0x47, 0xFF, 0xC0, 0xB8,
-    0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x55,
-    0x55, 0x41, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1A, 0x00, 0x0A,
-    0x80, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x2F, 0xFA, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x0A, 0x80, 0x02, 0x90,
-    0xFD, 0x00, 0xBE, 0x0F, 0xFA, 0xBF, 0xC0, 0x7F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0xFA,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0x80,
-    0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF,
-    0x80, 0x02, 0xFF, 0xFE, 0x40, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xF4, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x07,
-    0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B,
-    0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xF8, 0x00, 0xBF, 0xFF, 0xFC, 0x02,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x14, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0xFF, 0xE0,
-    0x0B, 0xFE, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x01, 0x90, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x2F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFC,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00,
-    0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x14, 0x6F, 0xFD, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xCB, 0xF4, 0x00,
-    0x0B, 0xF8, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F,
-    0xFC, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC7, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD,
-    0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFF, 0x00, 0x3F, 0xF0,
-    0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x0B, 0xFF, 0x00, 0x07, 0xFE, 0x0B, 0xFF, 0x00, 0x02, 0xFF, 0x4B,
-    0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x3F, 0xF8, 0x00, 0x07, 0xFD, 0x07, 0xFF,
-    0x00, 0x02, 0xFF, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF,
-    0xC0, 0x03, 0xFF, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0xBF, 0xD1, 0xFF, 0xC0,
-    0x00, 0x2F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xF9, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0x7F, 0xF0, 0x00, 0x03, 0xFE, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x00,
-    0xBF, 0xC0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0A,
-    0xA8, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x06, 0xA8, 0x00, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x1F, 0xF0, 0x00,
-    0x3F, 0xF0, 0x3F, 0xC0, 0x00, 0x3F, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0xE0, 0x69, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x54, 0x15, 0x50, 0x00, 0xFF, 0xC3,
-    0xFD, 0x00, 0x1F, 0xF8, 0xBF, 0xC0, 0x02, 0xFF, 0x4F, 0xF0, 0x00, 0x3F, 0xF1, 0xFD, 0x00, 0x03,
-    0xFF, 0x3F, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x05, 0x00, 0x1F, 0xF8, 0x0F, 0xF4, 0x07, 0xFD, 0x0B, 0xFF,
-    0x02, 0xFF, 0x42, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x06, 0x40, 0x1F, 0xF8, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0x80, 0x50, 0x02, 0xFF, 0x43, 0xFD, 0x03, 0xFF, 0x0B, 0xFE, 0x03, 0xFF, 0x0F, 0xFE, 0x03,
-    0xFF, 0x0B, 0xFC, 0x07, 0xFE, 0x01, 0x90, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xD5, 0x00, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0x54, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4,
-    0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xD0, 0x00,
-    0xBF, 0xE4, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x0B, 0xFF, 0xE0, 0xBF, 0xFF,
-    0x40, 0xBF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF,
-    0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4,
-    0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF,
-    0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD,
-    0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF,
-    0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF,
-    0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x03, 0xFC, 0xBF, 0xFF, 0x80, 0x0F,
-    0xFB, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x6F, 0xFD, 0x02, 0xFF, 0xE0, 0x2F, 0xF4, 0x0B, 0xFF, 0x00,
-    0xBF, 0xD0, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0,
-    0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x03, 0xFF, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F,
-    0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03,
-    0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00,
-    0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC,
-    0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00,
-    0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F,
-    0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00,
-    0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80,
-    0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00,
-    0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40,
-    0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF,
-    0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0xFA,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80, 0x3F,
-    0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02, 0xFF,
-    0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF, 0x4F,
-    0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00, 0xFF,
-    0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFF,
-    0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x6A, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0xBF, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xCB, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFB, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x2F, 0xF4,
-    0x00, 0xBF, 0xF0, 0x0B, 0xFD, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02,
-    0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F,
-    0xF8, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x16, 0x40, 0x1F, 0xE1, 0xFE, 0x1F, 0xFF, 0x43, 0xFC, 0x1F, 0xD7, 0xFF,
-    0xFC, 0x15, 0x42, 0xFE, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x9F, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x00, 0x7F, 0xF4, 0x03, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xD0,
-    0x07, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x1F, 0xF4,
-    0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x03, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8,
-    0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x1F, 0xF0,
-    0x00, 0x7F, 0xBF, 0xE0, 0x02, 0xFF, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x4F,
-    0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xBF, 0xC0, 0x3F, 0xD0, 0x01, 0xFF, 0x07, 0xFD, 0x07, 0xFC,
-    0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0xBF, 0xC0, 0x02, 0xFF, 0x02, 0xFF, 0x0F, 0xF8, 0x00, 0x3F, 0xE0,
-    0x0F, 0xF4, 0xFF, 0x80, 0x03, 0xFD, 0x00, 0xFF, 0xCF, 0xF4, 0x00, 0x7F, 0xC0, 0x07, 0xFD, 0xFF,
-    0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xF4,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFF,
-    0xC0, 0x02, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFD,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x02, 0xFC, 0x2F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF,
-    0xFE, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0,
-    0x2F, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xD0, 0x7F, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF,
-    0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF,
-    0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0xBE, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFF, 0xAF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xBA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD,
-    0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x06, 0x80, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0x0F, 0xFA, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4,
-    0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0xA0, 0xAA, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0xBF, 0xC0, 0x00, 0x00, 0x0F,
-    0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x07, 0xFF,
-    0xD0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00,
-    0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x00,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00,
-    0xFF, 0xE0, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF4, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xA0, 0xAA, 0x80, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0xFF, 0x83, 0xFD, 0x00,
-    0x00, 0x2F, 0xE0, 0xFF, 0x40, 0x00, 0x07, 0xF4, 0x2F, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0xBF, 0xF4,
-    0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0F,
-    0xFC, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xE0, 0x07,
-    0xFF, 0x00, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0x40, 0xBF, 0xF5, 0x55,
-    0x50, 0x07, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFA, 0xAA, 0xA0, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x01, 0x65, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0x9B, 0xFF, 0xFE, 0x0B, 0xFD, 0x0F, 0xFD, 0x02, 0xFF, 0xF4, 0x03,
-    0xFE, 0x2F, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x3F,
-    0xF0, 0x00, 0xFF, 0xEA, 0xFF, 0xF8, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xD0, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x40,
-    0x3F, 0xFE, 0xFF, 0xFF, 0xF5, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00,
-    0x7F, 0xF0, 0x02, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0x1F, 0xFC, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x2F, 0xF4,
-    0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xD0, 0x0B, 0xFD, 0x00, 0x2F, 0xFC,
-    0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xAA, 0x40,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0xBF, 0x4B,
-    0xFC, 0x00, 0x3F, 0xDB, 0xFF, 0x00, 0x0F, 0xFB, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xF9, 0x10, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xF0, 0x6F, 0xFE, 0x00, 0x3F, 0xF0, 0x0B, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0xBF, 0xD0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFE, 0x0B, 0xFD, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x0F,
-    0xFD, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0xBF, 0xF0, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00,
-    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xBF, 0x4B, 0xFC, 0x00, 0x0F, 0xF6, 0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xF9, 0x10, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x0A, 0x80, 0x00, 0x07, 0xF4, 0x0B, 0xF8, 0x00,
-    0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x6F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF,
-    0xE0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xD0, 0x00, 0x0B, 0xFD, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xD0,
-    0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xF8,
-    0x00, 0xFF, 0xD0, 0x02, 0xFF, 0x40, 0x0B, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x2A, 0x00, 0x06, 0x90, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x1F, 0xF1,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0xBF, 0x4B, 0xFC, 0x00, 0x0F, 0xF6, 0xFF,
-    0xC0, 0x00, 0xFF, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xF9, 0x10, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x1B, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1E, 0x40, 0x0B, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x14,
-    0x00, 0x2F, 0xF4, 0x0B, 0xE9, 0xBF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x0F, 0xF8, 0x0F,
-    0xF0, 0x00, 0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x1B, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x1E, 0x40, 0x0B, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x5F, 0xF0, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x2F, 0xFC, 0x07, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xE0, 0x14,
-    0x00, 0x2F, 0xF4, 0x0B, 0xE9, 0xBF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFE, 0x00,
-    0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x80, 0x6E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x79, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0x01, 0xF0, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x50, 0x00,
-    0xBF, 0xD0, 0xBE, 0x9B, 0xFF, 0xC0, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x00, 0x6F, 0xFF,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xF9,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0xA9, 0x00, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x2F,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xE0, 0x1B, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x79, 0x00, 0x2F, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x1B, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x1A, 0x80, 0x0B, 0xF4, 0x0B, 0xF8,
-    0x00, 0x3F, 0xC3, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xF0, 0x1F, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x05, 0x00, 0x0B, 0xFD, 0x00, 0xBE, 0x9B, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x2B, 0xFF, 0xAA, 0x40, 0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xEF, 0x00, 0x3F,
-    0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF,
-    0xD0, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x06, 0xA0, 0x00, 0xFF, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x1F, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15,
-    0x5F, 0xFE, 0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x02,
-    0xBF, 0xFA, 0xA4, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0x5F, 0xFE, 0x54, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xC0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF8, 0x0A, 0xFF, 0xEA, 0x90, 0x03, 0xFE, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x05, 0xBF, 0xE5, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xEF, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xF0, 0x00,
-    0x00, 0xFF, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE1, 0xBF, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F,
-    0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07,
-    0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00,
-    0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00,
-    0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x0B, 0xF8, 0x07, 0xD0, 0x00, 0xBF, 0xFE, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0x47,
-    0xFF, 0xC0, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF,
-    0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03,
-    0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0,
-    0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC,
-    0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x50,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F,
-    0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F, 0xFC, 0x00,
-    0xBF, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0xF0,
-    0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0, 0x01, 0xFF,
-    0xFE, 0x3F, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x68, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x01, 0xFF, 0xAB, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F,
-    0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF,
-    0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0x90, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xFF, 0xAB,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC,
-    0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
-    0xE0, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F,
-    0xF4, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x0F, 0xF8, 0x01,
-    0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0xBF, 0xF8, 0x03, 0xFF, 0xEF, 0xFF, 0xD0,
-    0x0F, 0xFF, 0xFD, 0xFF, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xAF, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00,
-    0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF,
-    0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0,
-    0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xDF, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00, 0x07, 0xFB,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F,
-    0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F,
-    0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x0B, 0xFF, 0x80, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0,
-    0x01, 0xFF, 0xFE, 0x3F, 0xC0, 0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xAA, 0x0A, 0xA8, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x3F,
-    0xD0, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0x42, 0xFC, 0x00, 0x00, 0x00, 0xF8,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x40, 0x00, 0xFF,
-    0xC0, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00,
-    0x03, 0xFF, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0F,
-    0xFC, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0x00,
-    0x2F, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0xBF, 0xE0, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA4, 0x6A, 0x90, 0x00, 0x02, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x0F, 0xD0,
-    0x00, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xF0, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x03, 0xFE, 0x00,
-    0x7F, 0xF0, 0x00, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFE,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x7F,
-    0xF4, 0x3F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0,
-    0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF,
-    0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03,
-    0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01,
-    0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0B, 0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B,
-    0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x2F, 0xF8, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x80,
-    0x3F, 0xFC, 0x03, 0xFF, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF7, 0xFC,
-    0x00, 0x7F, 0xFF, 0x8F, 0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xC0, 0x00, 0x14, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xCF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xEF, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD,
-    0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xCF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF4, 0xFF,
-    0x80, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x7F, 0xE0, 0xFF, 0x80,
-    0x0F, 0xFF, 0xD0, 0x0B, 0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0xBF, 0x80, 0x3F,
-    0xEF, 0xD0, 0x2F, 0xF4, 0x0B, 0xF8, 0x07, 0xFA, 0xFD, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0x2F,
-    0xD0, 0x7F, 0xD0, 0x0B, 0xFC, 0x1F, 0xF2, 0xFD, 0x0F, 0xFC, 0x00, 0xBF, 0xC3, 0xFD, 0x2F, 0xD0,
-    0xFF, 0x40, 0x0B, 0xFC, 0x7F, 0xC1, 0xFD, 0x2F, 0xF0, 0x00, 0xBF, 0xCB, 0xF8, 0x1F, 0xD3, 0xFE,
-    0x00, 0x0B, 0xF8, 0xFF, 0x01, 0xFD, 0x7F, 0xC0, 0x00, 0xBF, 0x9F, 0xE0, 0x1F, 0xDF, 0xF8, 0x00,
-    0x07, 0xFB, 0xFC, 0x01, 0xFD, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xF4, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0xFF, 0x40, 0x00, 0x00,
-    0x02, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x7F, 0xEF,
-    0xF8, 0x02, 0xFF, 0xD0, 0x0F, 0xFC, 0xFF, 0x80, 0x3F, 0xFD, 0x00, 0xFF, 0x8F, 0xF8, 0x07, 0xFF,
-    0xD0, 0x2F, 0xF0, 0xFF, 0x80, 0xFE, 0xFD, 0x03, 0xFE, 0x0B, 0xF8, 0x1F, 0xDF, 0xD0, 0xBF, 0xD0,
-    0xBF, 0x83, 0xFC, 0xFD, 0x0F, 0xFC, 0x0B, 0xF8, 0x3F, 0x8F, 0xD1, 0xFF, 0x40, 0xBF, 0x8B, 0xF0,
-    0xFD, 0x3F, 0xF0, 0x0B, 0xF8, 0xFF, 0x0F, 0xD3, 0xFD, 0x00, 0x7F, 0x9F, 0xD0, 0xFD, 0xBF, 0xC0,
-    0x07, 0xFB, 0xFC, 0x0F, 0xDF, 0xF4, 0x00, 0x7F, 0xBF, 0x80, 0xFE, 0xFF, 0x00, 0x07, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0x80,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF5, 0xFF,
-    0x00, 0x01, 0xFF, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00,
-    0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0,
-    0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4,
-    0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE,
-    0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0x9F, 0xF4, 0x00, 0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0xD0, 0x00, 0x1F, 0xF0, 0xFF, 0x40, 0x00, 0x3F, 0x83,
-    0xFC, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF,
-    0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x15, 0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0A, 0xAA, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x15,
-    0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF4, 0x02, 0xAA, 0xBF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x1A, 0x80, 0x00, 0x0B, 0xF4, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0xC3, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x15, 0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1A, 0x80, 0x01, 0xA4, 0x00, 0x3F, 0xC0, 0x7F, 0xC0,
-    0x00, 0x7F, 0x87, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x2A, 0xAB, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x64, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80,
-    0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x3F,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB,
-    0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x03,
-    0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x3F,
-    0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0x90, 0x7F, 0xFF, 0xD0, 0x2F, 0xFC,
-    0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x82, 0xFF, 0x40, 0x00, 0x03, 0xFF,
-    0x00, 0x1F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x80, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0xBF, 0xFC, 0x00, 0x1F, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x01, 0x64,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xF9, 0xBF, 0xFC, 0x0F, 0xFE, 0x01,
-    0xFF, 0xC0, 0x0F, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF4,
-    0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0xBF, 0xD0,
-    0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x7F, 0xF0, 0x1F, 0xFE,
-    0x00, 0x7F, 0xD0, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x05, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xA4, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F,
-    0xF6, 0xFF, 0x95, 0xBF, 0xFC, 0x7F, 0xC2, 0xFF, 0x40, 0x1F, 0xFC, 0x7F, 0x43, 0xFF, 0x00, 0x0F,
-    0xFC, 0x3F, 0x43, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE,
-    0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFE, 0xAB, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFA, 0xA5, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD4,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x19,
-    0x00, 0x00, 0x0B, 0xFC, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFE, 0xBF, 0xFC, 0x00, 0x2F, 0xFD, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0xFF,
-    0xD0, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x7F, 0xD0, 0x03, 0xFF,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0x7F, 0xF4, 0x0F, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFE, 0xBF, 0xFF, 0x40, 0x01, 0xFF, 0x8B, 0xFF, 0x40, 0x00,
-    0xBF, 0xD0, 0x14, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x54, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFA, 0xBF, 0xFD,
-    0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0xBF,
-    0xE0, 0x07, 0xFE, 0x02, 0xFF, 0x40, 0x3F, 0xF4, 0x0F, 0xFC, 0x07, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xC3, 0xFF, 0x00, 0x03, 0xFF, 0x0B, 0xFE, 0x00, 0x1F, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x03, 0xE4, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x7C, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x90, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4,
-    0x03, 0xFF, 0xFF, 0xFC, 0x02, 0xE4, 0x1F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xBF, 0xFC, 0x00, 0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0x90, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x40,
-    0x7F, 0xF5, 0x5B, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x40,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x55, 0x55, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x55, 0x00, 0x2F, 0xFF, 0x02, 0xFF, 0xFF, 0x0F, 0xDB, 0xFD, 0x7D, 0x0F, 0xF4,
-    0xF8, 0x7F, 0xD3, 0xFF, 0xFF, 0x43, 0xFF, 0xFC, 0x01, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFD,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x02, 0xFF,
-    0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFD, 0x00, 0x2F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x43, 0xFF, 0xFF, 0x4F, 0xFF, 0xFD, 0x1F, 0xFF, 0xF4, 0x0B, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x2B, 0xFF, 0xAA, 0x40,
-    0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0xEB, 0x80, 0x3F, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF,
-    0xFC, 0x00, 0x1F, 0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x6B, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xF5, 0x7F, 0xF5, 0x55, 0x1F, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xF4, 0x07, 0xFD,
-    0x00, 0x00, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xF9, 0x90, 0x0B, 0xFD, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0x82, 0xBF, 0xFA, 0xA4, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0xF0, 0x03, 0xFF, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE,
-    0x55, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x1F, 0xF4, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xCF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xFB, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x43,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x00, 0xFC, 0x00, 0xAA, 0x80, 0x3F, 0xF8, 0x07, 0xFE, 0x00, 0xFF,
-    0x80, 0x3F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0x00, 0x7F, 0xDB, 0xF8, 0x1F, 0xF0, 0x2F, 0xD3, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x50, 0x1F,
-    0xF4, 0x0F, 0xC1, 0xFF, 0xFE, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x7E, 0x1F, 0xFF, 0x41, 0xF0, 0x06,
-    0xE0, 0x00, 0x15, 0x55, 0x55, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFC, 0x55, 0x55, 0x55, 0x40,
-    0x68, 0x00, 0x2A, 0x2F, 0x80, 0x1F, 0xCB, 0xFA, 0xBF, 0xD0, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0,
-    0x00, 0xAE, 0x90, 0x00, 0x05, 0x03, 0xFD, 0xBF, 0xEF, 0xFE, 0xBF, 0xC1, 0x90, 0x00, 0x00, 0x00,
-    0x2F, 0x41, 0xF8, 0x7F, 0xC3, 0xFC, 0xBF, 0xC7, 0xFC, 0x7F, 0x43, 0xF8, 0x04, 0x00, 0x40, 0x6A,
-    0x80, 0xFF, 0xF4, 0xFF, 0xFC, 0x43, 0xFC, 0x02, 0xFC, 0x1B, 0xF4, 0x3F, 0xD0, 0x3F, 0x00, 0x00,
-    0x00, 0x0B, 0xE4, 0x0F, 0xFF, 0x8B, 0xE7, 0xF3, 0xF0, 0x3D, 0xFC, 0x1F, 0x6F, 0xAF, 0xC3, 0xFF,
-    0xD0, 0x2F, 0x90, 0x00, 0x6A, 0x82, 0xA9, 0x01, 0xFF, 0x4B, 0xFC, 0x03, 0xFD, 0x1F, 0xF0, 0x0F,
-    0xF4, 0x3F, 0xC0, 0x2F, 0xC0, 0xFE, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x2A, 0x40, 0x06, 0xA0, 0xBF,
-    0x00, 0xBF, 0x40, 0xFF, 0x0F, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xF4, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x06, 0x90, 0xFD, 0x0F, 0xC1, 0xFC, 0x2F, 0xC2, 0xF8, 0x3F, 0x43, 0xF0, 0x7F, 0x05,
-    0x50, 0x0A, 0x80, 0xA8, 0x0F, 0xC2, 0xFC, 0x1F, 0xC2, 0xF8, 0x2F, 0x83, 0xF4, 0x3F, 0x83, 0xF0,
-    0x3F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0x2A, 0x91, 0xAA, 0x02, 0xFF, 0x1F, 0xF0, 0x0F, 0xF4, 0xBF,
-    0x40, 0x3F, 0x83, 0xFC, 0x01, 0xFC, 0x0F, 0xD0, 0x07, 0xD0, 0x3E, 0x00, 0x14, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0xFF, 0x40, 0x68, 0xFF, 0x1A, 0xBC, 0x28, 0x3E, 0x7E, 0x00, 0xFC, 0x3F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x1A, 0x90, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFC, 0x3F, 0x40, 0x3F, 0x4F, 0x80, 0x07, 0xD0, 0x00, 0xBF, 0x00, 0x3F, 0xC0, 0x3F,
-    0xD0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x15, 0x40, 0x00, 0x02,
-    0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFE,
-    0x00, 0x55, 0x00, 0x00, 0xFF, 0x7F, 0xEF, 0xFA, 0xFE, 0xBF, 0x9F, 0xE3, 0xF8, 0xFE, 0x15, 0x00,
-    0x02, 0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x01,
-    0xFE, 0x00, 0x55, 0x00, 0x00, 0x6A, 0x90, 0x3F, 0xF0, 0x1F, 0xF0, 0x0B, 0xF8, 0x03, 0xFC, 0x00,
-    0xBD, 0x00, 0x6A, 0x90, 0x1F, 0xFC, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x1F, 0xF0, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x0B, 0x9F, 0xFD, 0xBF, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x10, 0x00, 0x00,
-    0x0F, 0x00, 0x1F, 0x00, 0x1F, 0xFD, 0x2F, 0xFC, 0x3D, 0x00, 0x3C, 0x00, 0x14, 0x00, 0x05, 0x55,
-    0x54, 0xFF, 0xFF, 0xE2, 0xAA, 0xAF, 0x40, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x6A, 0x80, 0x0F, 0xFC, 0x01,
-    0xFF, 0x80, 0x3F, 0xF0, 0x1F, 0xFD, 0x0B, 0xFF, 0x80, 0xBF, 0xD0, 0x0F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0xFC, 0x3F, 0xC7, 0xD0, 0xBC, 0x0B, 0xC0, 0x3F, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x01, 0xE0, 0x02, 0xE0, 0x03, 0xD0, 0x7F, 0xFD, 0xBF, 0xFD, 0x15, 0x55, 0x0F, 0xFF, 0xC2,
-    0xBF, 0xA0, 0x0F, 0x40, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x2B,
-    0xFA, 0x3F, 0xFE, 0x17, 0xD4, 0x07, 0xC0, 0x06, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFE, 0x00,
-    0x6A, 0x40, 0x2F, 0xE0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x8A, 0xBF, 0xD3, 0xFF,
-    0xF0, 0xFF, 0xF0, 0x2F, 0xE0, 0x00, 0x1A, 0x90, 0x3F, 0xD0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0xC0,
-    0xBF, 0xC0, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xFE, 0x02, 0xA8, 0x0B, 0xD0, 0xFF, 0xD3, 0xFF, 0x4F,
-    0xFC, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFC, 0x3F, 0xC3, 0xFD, 0x3F, 0xC3,
-    0xFD, 0x3F, 0x82, 0xFC, 0x04, 0x00, 0x10, 0x0B, 0xE4, 0x0F, 0xFF, 0x4B, 0xE7, 0xF3, 0xE0, 0x7D,
-    0xF8, 0x1F, 0x6F, 0xAF, 0xC3, 0xFF, 0xD0, 0x2F, 0x90, 0x0F, 0xF8, 0xBF, 0xC3, 0xFD, 0x1F, 0xE0,
-    0xFE, 0x01, 0x50, 0x00, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0xF0, 0x02, 0xFD, 0x00, 0xBF, 0x4F,
-    0xFF, 0xC3, 0xFF, 0xE0, 0xFF, 0x90, 0x07, 0xF4, 0x7F, 0x07, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFF,
-    0xDB, 0xFF, 0x4B, 0xFC, 0x00, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xC0, 0x7F,
-    0x02, 0xFC, 0x0F, 0xE0, 0x3F, 0x40, 0x54, 0x00, 0x05, 0x55, 0x55, 0x51, 0xFF, 0xFF, 0xFE, 0x2F,
-    0xAA, 0xAB, 0xD2, 0xE0, 0x00, 0x3C, 0x3D, 0x00, 0x07, 0xC3, 0xC0, 0x00, 0xB8, 0x14, 0x00, 0x01,
-    0x00, 0xB0, 0x0D, 0x03, 0xEC, 0x0F, 0x82, 0xE7, 0xFF, 0xFF, 0xF0, 0x7E, 0x4B, 0xE0, 0x69, 0x00,
-    0x0A, 0x93, 0xF8, 0x07, 0xFC, 0x2F, 0xE2, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x0F, 0xFF, 0xC0, 0x02, 0xFF, 0xFE, 0x00, 0xBF, 0xCF,
-    0xF4, 0x3F, 0xE0, 0x3F, 0xCB, 0xF4, 0x00, 0xFD, 0x2A, 0x00, 0x0A, 0x4F, 0xC0, 0x0F, 0xD3, 0xFE,
-    0xAF, 0xF0, 0xBF, 0xFF, 0xF4, 0x0B, 0xFF, 0xF4, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x6A, 0x40, 0x01,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xEF, 0xFC, 0x7F, 0x00, 0x7F, 0x1F, 0x40, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x50, 0x1F, 0xF4, 0x0F, 0xC1, 0xFF, 0xFE, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0, 0x7E,
-    0x1F, 0xFF, 0x41, 0xF0, 0x06, 0xE0, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x55, 0x40,
-    0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0x90,
-    0x00, 0x00, 0x00, 0x40, 0xBF, 0xD0, 0x3E, 0x2F, 0xFF, 0xAF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD, 0x1F,
-    0xFF, 0x0B, 0x80, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0xFC, 0x00,
-    0x0F, 0xFE, 0x00, 0xBF, 0xFC, 0x07, 0xFF, 0xD0, 0x3F, 0xFE, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0x40,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x0F, 0xC0, 0x7D, 0x03, 0xD0, 0x7D, 0x3F, 0xC7, 0xF0, 0x10, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x3D, 0x3F, 0xAA, 0xAB, 0xC3,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x0F, 0xAA,
-    0xAB, 0xD0, 0xE0, 0x00, 0x3C, 0x1D, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x78, 0x3F, 0xFF, 0xFF, 0x42,
-    0xAA, 0xAA, 0xA0, 0x07, 0xF4, 0xBE, 0x0B, 0xEF, 0xFB, 0xE7, 0x81, 0xF0, 0x3E, 0xC0, 0x34, 0x0E,
-    0x08, 0x08, 0x2F, 0x3E, 0x0F, 0xF8, 0x0B, 0xF0, 0x1F, 0xF0, 0x7D, 0xFC, 0x20, 0x20, 0x00, 0x6C,
-    0x03, 0xFC, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x03, 0xE0, 0x2F, 0xC0,
-    0x29, 0x00, 0x05, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFF, 0x1A, 0xAA, 0xAA, 0xA4,
-    0x2A, 0x90, 0x3F, 0xF0, 0x1F, 0xF4, 0x0B, 0xF8, 0x02, 0xFC, 0x00, 0xBD, 0x01, 0xAA, 0x80, 0x3F,
-    0xF4, 0x0B, 0xFD, 0x01, 0xFF, 0x40, 0x3F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0xBF,
-    0xD0, 0x3E, 0x2F, 0xFF, 0xAF, 0xD3, 0xFF, 0xFF, 0xFC, 0xBD, 0x1F, 0xFF, 0x0B, 0x80, 0x1B, 0x80,
-    0x7F, 0x87, 0xFF, 0x6F, 0xF0, 0x7F, 0x0F, 0xD0, 0xB4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x02,
-    0xF8, 0x3F, 0xF4, 0xFD, 0x7F, 0xC7, 0xFE, 0x3F, 0xEB, 0xF8, 0xBF, 0x83, 0xFD, 0xBF, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x41, 0xFC, 0x00, 0x40, 0x0F, 0xE0, 0x7F, 0x42, 0xFD, 0x0F, 0xFE, 0x3F, 0xF4, 0x3F,
-    0xC0, 0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xAA, 0xAA, 0xFC, 0x3D, 0x00, 0x00,
-    0xB8, 0x3C, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x00, 0x50, 0x05, 0x55, 0x55,
-    0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0, 0x6A, 0xAA, 0xAA, 0x90, 0x1A, 0x42, 0xA0,
-    0xFD, 0x0F, 0xC3, 0xF4, 0x7F, 0x1F, 0xC2, 0xFC, 0x7F, 0x0F, 0xE2, 0xF8, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xFE, 0xFF, 0xE0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x00, 0x01, 0x00, 0x00,
-    0x54, 0xF0, 0x50, 0xBF, 0xF4, 0x78, 0x7F, 0xFF, 0xBD, 0x3D, 0x3F, 0xFE, 0x0E, 0x1E, 0x69, 0x00,
-    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0A, 0x00, 0x02, 0xFD, 0x02, 0xD3, 0xFF, 0xE6, 0xF1, 0xF5, 0xFF, 0xF4,
-    0xF0, 0x07, 0xF4, 0x00, 0x19, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x68, 0x01, 0x90, 0x3F, 0xFD, 0x7C, 0x0B, 0xFF, 0xFF, 0x80, 0xF0,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xB4, 0x0F, 0xFF, 0xAF, 0x02, 0xE6, 0xFF, 0xD0,
-    0x3C, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB0, 0x2D, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF8, 0x0F, 0x81, 0xF4, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xBE,
-    0x0B, 0xFD, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0, 0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE, 0xFF,
-    0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0x00, 0x50,
-    0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00, 0x03,
-    0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70, 0x00,
-    0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F,
-    0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x40, 0xBF, 0x40, 0xBE, 0x0B,
-    0xEB, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x40, 0xBC, 0x3F, 0xC7, 0xD0, 0xBC, 0x0B, 0xC0, 0x3F, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x3F, 0x95, 0xFD, 0x7D,
-    0x00, 0x3E, 0xBC, 0xBE, 0x3E, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x08, 0x20,
-    0x3E, 0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F,
-    0x8F, 0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x20, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0xBD, 0x0B, 0xF4,
-    0xFD, 0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x40, 0x3F, 0x03, 0xFD, 0x0F, 0xC0, 0x1F, 0x8B,
-    0xB8, 0x1F, 0xE3, 0xCF, 0x2F, 0x81, 0xE2, 0xDA, 0x00, 0xB0, 0x38, 0x00, 0x01, 0xE0, 0x1F, 0x80,
-    0xBC, 0x07, 0xC0, 0xBC, 0x7F, 0x8B, 0xE0, 0x50, 0x00, 0x05, 0x03, 0xFD, 0xBF, 0xEF, 0xFE, 0xBF,
-    0xC1, 0x90, 0x01, 0x90, 0x00, 0x74, 0x02, 0xEE, 0xE0, 0xBF, 0xF8, 0x07, 0xF4, 0x03, 0xDF, 0x00,
-    0x62, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0x47, 0xEB, 0xFE, 0xF6, 0xC0, 0xB8, 0x0F, 0xF0,
-    0x1D, 0x03, 0xEC, 0x0B, 0x80, 0xF7, 0xEF, 0xFE, 0xF4, 0x7F, 0x8B, 0xF4, 0x00, 0x00, 0xE0, 0x07,
-    0x40, 0x2F, 0xFC, 0xFF, 0xF0, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x93, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0xFF, 0xF9,
-    0x55, 0x6B, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x87, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xFF, 0xF9, 0x55, 0x6B,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x06, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFC, 0x1A, 0xAA, 0xAA, 0xAA, 0xA4, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x0B, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7E, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x02, 0xE0, 0x00, 0x00,
-    0x06, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x05, 0xAA, 0x94, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xEA, 0xBF, 0xFF, 0xD0, 0x03,
-    0xFF, 0x90, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x82, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xD2, 0xFB,
-    0xF0, 0xF4, 0x7C, 0x7C, 0x2E, 0x2F, 0x0F, 0x4B, 0xCB, 0xC0, 0xFF, 0xF0, 0x05, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0xF9, 0xF0, 0xB8, 0x7C, 0x3F, 0xFD, 0x0F, 0x50, 0x03, 0xD0, 0x40, 0xBF,
-    0xF0, 0x01, 0x50, 0x00, 0x07, 0x42, 0xE0, 0x00, 0x3C, 0x1F, 0x0B, 0x83, 0xD0, 0xF0, 0x7C, 0x2E,
-    0x01, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x2F, 0xBE, 0x3D, 0x1F, 0x7C, 0x1F, 0xB8, 0x2E, 0x7C, 0x7C,
-    0x3F, 0xF4, 0x05, 0x40, 0x1E, 0x0F, 0x4B, 0x43, 0xC3, 0xC1, 0xF0, 0xF0, 0xB8, 0x7C, 0x3D, 0x1F,
-    0x2F, 0x03, 0xFB, 0xC0, 0x14, 0x50, 0x00, 0x00, 0x2F, 0xE2, 0xFA, 0x5F, 0x00, 0xB8, 0x02, 0xE0,
-    0x0B, 0xC1, 0x0F, 0xFC, 0x05, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0xBE, 0xF4,
-    0x2F, 0xBF, 0x03, 0xD1, 0xF0, 0x7C, 0x1E, 0x0B, 0x83, 0xD0, 0x7C, 0x7C, 0x03, 0xFF, 0xC0, 0x05,
-    0x14, 0x00, 0x02, 0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x1F, 0xBD, 0x0B, 0xEB, 0xC3, 0xE1, 0xF0,
-    0xF0, 0x7C, 0x7C, 0x2E, 0x2E, 0x0F, 0x4F, 0x43, 0xC1, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0xB7,
-    0xF2, 0xF8, 0x0F, 0xEF, 0xFB, 0xC0, 0xF4, 0xBC, 0x3C, 0x1F, 0x0F, 0x43, 0xC2, 0xE0, 0xF0, 0x7C,
-    0x3D, 0x1F, 0x0B, 0x83, 0xC2, 0xE0, 0xF4, 0x14, 0x04, 0x05, 0x00, 0x00, 0x00, 0x3D, 0xF1, 0xFF,
-    0x8B, 0xC0, 0x3E, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0x10, 0x00, 0x01, 0x40, 0x0E, 0x02, 0xFF,
-    0x4B, 0xE8, 0x1F, 0x00, 0x78, 0x02, 0xD0, 0x0F, 0x40, 0x3F, 0xC0, 0x15, 0x00, 0xB4, 0x2E, 0xB4,
-    0x3C, 0xB8, 0xF4, 0x79, 0xF0, 0x7B, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0x14, 0x00, 0x07, 0xC3, 0xE0,
-    0x3D, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xFB, 0xD0, 0x2F, 0x1F, 0x01, 0x40,
-    0x50, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF,
-    0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xFD,
-    0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x0B, 0xF8,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x8B,
-    0xFD, 0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xFF, 0xFA, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07,
-    0xFE, 0x00, 0x3F, 0xF4, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F,
-    0xF5, 0x5B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F, 0xF8,
-    0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0,
-    0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x00, 0x00, 0x07, 0xFD, 0x2F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC1, 0xFF, 0x00, 0x00, 0x1F, 0xF4, 0x1F, 0xF0, 0x00, 0x03, 0xFF, 0x01,
-    0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x0F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x40,
-    0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x01, 0xFF, 0x80,
-    0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x00, 0x0B, 0xFD, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0xD5,
-    0x55, 0x5B, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5,
-    0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x15, 0x55, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F,
-    0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF0,
-    0x00, 0x2F, 0xF4, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xEA, 0xAA, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B,
-    0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE,
-    0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00,
-    0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F,
-    0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF,
-    0x2F, 0xFF, 0x4F, 0xFD, 0x2F, 0xF8, 0xBF, 0xFC, 0x3F, 0xF0, 0xFF, 0xD3, 0xFF, 0xF0, 0xFF, 0xC3,
-    0xFF, 0x0F, 0xFF, 0x87, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xD0, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
-    0xF4, 0x00, 0x2F, 0xF4, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-    0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0xBF, 0xF0, 0x00, 0x00,
-    0xBF, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC7, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xCF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xAF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x07,
-    0xFE, 0x0F, 0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x0B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
-    0xFF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xEF, 0xF4, 0x00, 0x00, 0xBF, 0xCF, 0xF4, 0x00, 0x00, 0xFF,
-    0x8F, 0xF8, 0x00, 0x02, 0xFF, 0x4F, 0xF8, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x00, 0x0B, 0xFD, 0x0B,
-    0xFC, 0x00, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x2F, 0xF4, 0x0B, 0xFC, 0x00, 0x3F, 0xF0, 0x07, 0xFC,
-    0x00, 0xBF, 0xD0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x02, 0xFF, 0x40, 0x07, 0xFD, 0x03,
-    0xFF, 0x00, 0x03, 0xFD, 0x0B, 0xFD, 0x00, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x03, 0xFE, 0x2F, 0xF4,
-    0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xBF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xD0, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFE,
-    0xFF, 0x00, 0x0B, 0xFB, 0xFC, 0x00, 0x3F, 0xEF, 0xF0, 0x00, 0xFF, 0x7F, 0xC0, 0x0B, 0xF6, 0xFE,
-    0x00, 0x0F, 0xF6, 0xFC, 0x00, 0xFF, 0x3F, 0xE0, 0x01, 0xFF, 0x2F, 0xC0, 0x2F, 0xD3, 0xFD, 0x00,
-    0x1F, 0xF2, 0xFC, 0x03, 0xFC, 0x7F, 0xC0, 0x02, 0xFF, 0x2F, 0xC0, 0xBF, 0x4B, 0xFC, 0x00, 0x3F,
-    0xE2, 0xFD, 0x0F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x1F, 0xD2, 0xFD, 0x0F, 0xF4, 0x00, 0x7F, 0xC1,
-    0xFD, 0x3F, 0xC1, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xDB, 0xF4, 0x2F, 0xF0, 0x00, 0xFF, 0x81, 0xFE,
-    0xFF, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x0F, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0xFF, 0x40, 0xFF, 0xFC,
-    0x03, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0x40, 0x7F, 0xC0, 0x02, 0xFF, 0x00, 0xFF, 0xF0, 0x0B,
-    0xFC, 0x00, 0x3F, 0xE0, 0x0F, 0xFD, 0x00, 0xFF, 0xC0, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x0F, 0xF8,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0xFF, 0x80, 0x07, 0xFF, 0xFD, 0x00, 0x1F, 0xF4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x0B,
-    0xFA, 0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x5F, 0xF4, 0x03, 0xFE, 0x00, 0x0F, 0xF4, 0xFF, 0x80,
-    0x3F, 0xD0, 0x01, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x00, 0x2F, 0xF0, 0x7F, 0xD0, 0xBF, 0xC0, 0x02,
-    0xFF, 0x03, 0xFE, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x2F, 0xF0, 0xFF, 0x80, 0x03, 0xFD, 0x01, 0xFF,
-    0x4F, 0xF4, 0x00, 0x7F, 0xC0, 0x0F, 0xF9, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xDF, 0xF0, 0x00,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0x40, 0x03,
-    0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x00,
-    0x3F, 0xE0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x15, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0xAA,
-    0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF4, 0x00,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00,
-    0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xF5, 0x5F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE, 0x00, 0x2F, 0xF4,
-    0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0xFF, 0xC0,
-    0x1F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xAB, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFE, 0xA5, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F,
-    0xF9, 0x55, 0x55, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x15, 0x5F, 0xFE, 0x55, 0x40, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40,
-    0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF,
-    0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F,
-    0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x6F, 0xF9, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFA, 0x7F,
-    0xE6, 0xFF, 0xF8, 0x07, 0xFF, 0x40, 0x3F, 0xD0, 0x2F, 0xFC, 0x0F, 0xFC, 0x00, 0x7F, 0xC0, 0x0F,
-    0xFD, 0x1F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0xFD, 0x3F,
-    0xF0, 0x00, 0xFF, 0x40, 0x07, 0xFD, 0x3F, 0xE0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x3F, 0xE0, 0x01,
-    0xFF, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x3F, 0xF8, 0x03, 0xFE, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFE, 0x43, 0xFD, 0x07, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x02, 0xFF, 0xC0, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFF,
-    0x40, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x00, 0xBF, 0xF0,
-    0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0x80, 0x1F, 0xF4, 0x2F, 0xF0,
-    0x03, 0xFE, 0x00, 0xBF, 0xC0, 0xFF, 0xC0, 0x1F, 0xF4, 0x02, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0xD0,
-    0x0F, 0xFC, 0x0F, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xD0, 0x0F, 0xFC, 0x01, 0xFF, 0x42,
-    0xFF, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x0F, 0xFC, 0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x3F, 0xE0, 0x0B,
-    0xFC, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFD, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0x2F,
-    0xF0, 0x1F, 0xF8, 0x03, 0xFE, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x1F, 0xF4, 0x0F, 0xFD, 0x00, 0xFF,
-    0xF9, 0xBF, 0xD6, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x03,
-    0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x40, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00,
-    0x01, 0xFF, 0x40, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xE0, 0xBF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x3F, 0xC0,
-    0x0F, 0xFF, 0xFD, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xDB, 0xFF, 0xD0, 0x3F, 0xF8,
-    0x0B, 0xFF, 0x01, 0xFF, 0xC0, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xFF,
-    0x41, 0xFF, 0x80, 0x07, 0xFD, 0x0B, 0xFD, 0x00, 0x2F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF, 0xC0, 0xBF,
-    0xD0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x2F, 0xF4, 0x0B, 0xFF, 0x02, 0xFF, 0xD0, 0x1F, 0xFF, 0xBF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x5F, 0xFF, 0x00, 0x7F, 0xF0, 0x2F, 0xF8,
-    0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xE6, 0xFF,
-    0xE0, 0x00, 0x3F, 0xF4, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xE0, 0x03,
-    0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x7F, 0xD0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x40, 0x01, 0xFF, 0x8F, 0xFF, 0xD0, 0x00, 0x2F, 0xF4, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x1F,
-    0xFF, 0x40, 0x00, 0x3F, 0xF1, 0xBF, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xE0,
-    0x02, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x1F, 0xFC, 0x00, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFE, 0xBF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xE7, 0xFF, 0xF8, 0x00, 0x07, 0xFD, 0x01, 0x50, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x0F,
-    0xFC, 0x3F, 0xE0, 0x07, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0x80,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF4, 0x07, 0xFC, 0x0B, 0xFC, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x7F,
-    0xC2, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFD, 0x5B, 0xF4, 0x00, 0x2F, 0xF4, 0x00, 0x60, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0x47, 0xFF, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x3F, 0xF4, 0x01, 0xFF, 0x80, 0x3F,
-    0xF0, 0x01, 0xFF, 0xC0, 0x7F, 0xD0, 0x01, 0xFF, 0xC0, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0xBF, 0xD0,
-    0x02, 0xFF, 0x80, 0xBF, 0xD0, 0x03, 0xFF, 0x00, 0xBF, 0xF0, 0x0F, 0xFF, 0x00, 0x7F, 0xFE, 0xBF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0x69, 0x40, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0x41, 0xBC, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x02, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFE, 0xA8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x80, 0x3F, 0xFE, 0xAF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFE, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x55, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x55, 0x56, 0xFF, 0xC0, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x02,
-    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x02, 0xFC, 0x1F, 0xFE, 0x00, 0x0F, 0xF2, 0xFF,
-    0xFE, 0x00, 0x3F, 0xEF, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xF4, 0x0B, 0xFF, 0x80, 0xBF, 0xD0,
-    0x2F, 0xFC, 0x02, 0xFF, 0x40, 0xFF, 0xD0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x1F, 0xF8,
-    0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x3F, 0xE0, 0x03, 0xFF, 0x01, 0xFF, 0x40, 0x0F, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x3F,
-    0xF0, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0xFF, 0xC0, 0x1F, 0xFC, 0x07, 0xFD, 0x03,
-    0xFF, 0x00, 0x3F, 0xE0, 0x7F, 0xE0, 0x03, 0xFE, 0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0xFF, 0xC0, 0x07,
-    0xFE, 0x1F, 0xFC, 0x00, 0x7F, 0xE2, 0xFF, 0xEA, 0xAF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFE, 0x00, 0x2F, 0xF8, 0x7F, 0xD0, 0x02, 0xFF,
-    0x4B, 0xFD, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x07, 0xFF, 0x0B, 0xFC, 0x00, 0xBF, 0xD0, 0xBF, 0xD0,
-    0x0F, 0xFC, 0x07, 0xFD, 0x03, 0xFF, 0x40, 0x3F, 0xF5, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0B, 0xFD, 0x00, 0xBF, 0xC0, 0x0F, 0xFC, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x07, 0xFE,
-    0x00, 0xBF, 0xF0, 0x0B, 0xFF, 0xEA, 0x7F, 0xFF, 0xE3, 0xFF, 0xFD, 0x0B, 0xFF, 0xC0, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xC0, 0x0F, 0xFC, 0x02, 0xFF, 0xC0,
-    0x03, 0xFE, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0x82, 0xFF, 0xC0, 0x00, 0xBF, 0xD2, 0xFF, 0xC0, 0x00,
-    0x3F, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xF9, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0x7F, 0xF0, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0x41, 0xFF, 0xC0, 0x00, 0xBF,
-    0xC0, 0x3F, 0xF4, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x07, 0xFE,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x2A, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00,
-    0x0F, 0xF5, 0xFF, 0x00, 0x00, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0x40, 0x00, 0xBF,
-    0xC0, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-    0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0xBF, 0xFE, 0x1F, 0xF8, 0x00, 0x7F, 0xFD, 0x3F, 0xF4, 0x00, 0x3F,
-    0xFC, 0xBF, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFC, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x2F, 0xF0, 0x01,
-    0xFF, 0x80, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFD, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x2F, 0xFF,
-    0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF7, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x7F, 0xF8, 0x07, 0xFE,
-    0xFF, 0x42, 0xFF, 0x40, 0x7F, 0xD1, 0x40, 0x01, 0x40, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0xFF, 0xC3, 0xFE, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x0F,
-    0xFC, 0x3F, 0xE0, 0x07, 0xFE, 0x0F, 0xF8, 0x01, 0xFF, 0x42, 0xFE, 0x00, 0xBF, 0xC0, 0xBF, 0x80,
-    0x3F, 0xF0, 0x2F, 0xF0, 0x1F, 0xF4, 0x07, 0xFC, 0x0B, 0xFC, 0x01, 0xFF, 0x03, 0xFE, 0x00, 0x3F,
-    0xC2, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0x40, 0x03, 0xFC, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x5B, 0xFF, 0x94, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x07, 0xFF, 0xEA, 0xA0, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEB, 0xFF, 0x40, 0xFF, 0xE0, 0x1F,
-    0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFE,
-    0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8, 0xBF, 0xD0, 0x03, 0xFF,
-    0x47, 0xFE, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xFF, 0xEA, 0xAF, 0xFE, 0xA4, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x00,
-    0x01, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x7F,
-    0xE0, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFD,
-    0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xEB, 0x00,
-    0x0F, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xAF,
-    0xFD, 0x00, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0x2F, 0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF,
-    0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x0B, 0xFE, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFD, 0x01, 0xFF, 0x80, 0x2F, 0xFC, 0x01, 0xFF,
-    0xC0, 0x7F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0x40, 0x07, 0xFE, 0x3F, 0xFD, 0x00, 0x0B, 0xFD, 0x01, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x59, 0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xE6, 0xF4, 0x0F, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xEB, 0xFF, 0xA8,
-    0x0F, 0xFE, 0x00, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0xBF, 0xD0, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFD, 0x00, 0x3F, 0xFE, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xBF, 0xFA, 0xA8,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xAC, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xC0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF,
-    0x80, 0x0B, 0xFD, 0x0B, 0xFD, 0x00, 0x2F, 0xF0, 0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03,
-    0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x3F, 0xF0, 0xBF, 0xD0, 0x00, 0xFF, 0xC3,
-    0xFF, 0x00, 0x07, 0xFE, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0x80,
-    0x0F, 0xFE, 0x03, 0xFF, 0x00, 0xBF, 0xF0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x05, 0x94, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0x81, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0x47, 0xFE, 0x2F, 0xF8, 0x0F, 0xFD, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x2F, 0xFC, 0x0F, 0xF8, 0x0B, 0xFC, 0x3F, 0xF4, 0x1F, 0xF4, 0x0B, 0xFD, 0x3F,
-    0xF0, 0x2F, 0xF0, 0x0F, 0xFC, 0x7F, 0xE0, 0x2F, 0xF0, 0x0F, 0xFC, 0x7F, 0xE0, 0x3F, 0xE0, 0x1F,
-    0xFC, 0x7F, 0xE0, 0x3F, 0xE0, 0x2F, 0xF8, 0x7F, 0xE0, 0x7F, 0xD0, 0x3F, 0xF4, 0x3F, 0xF0, 0xBF,
-    0xC0, 0xFF, 0xF0, 0x3F, 0xF8, 0xFF, 0xC7, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xF8,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x83, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x01, 0xFF, 0xFD,
-    0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xFC, 0x00, 0xBF, 0xD0, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x42,
-    0xFF, 0x40, 0xFF, 0xC0, 0xBF, 0xC0, 0xBF, 0xD0, 0x7F, 0xE0, 0x3F, 0xF0, 0x2F, 0xF4, 0x2F, 0xF4,
-    0x0F, 0xF8, 0x0B, 0xFD, 0x0B, 0xFC, 0x03, 0xFE, 0x02, 0xFF, 0x43, 0xFF, 0x01, 0xFF, 0x40, 0xBF,
-    0xD0, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xF0, 0x7F, 0xE0, 0x3F, 0xF0, 0x0F, 0xFC, 0x2F, 0xF4, 0x0F,
-    0xF8, 0x03, 0xFF, 0x0F, 0xFC, 0x07, 0xFD, 0x01, 0xFF, 0x83, 0xFF, 0x01, 0xFF, 0x00, 0xBF, 0xD0,
-    0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x2F, 0xF4, 0x0F, 0xFC, 0x0F, 0xF8,
-    0x2F, 0xFC, 0x03, 0xFF, 0xEB, 0xFF, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x0F, 0xF8, 0x00, 0x55, 0x00, 0x3F, 0xF1, 0xFF, 0x40, 0x1F, 0xF0,
-    0x03, 0xFF, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFE, 0x3F,
-    0xE0, 0x03, 0xFD, 0x00, 0x3F, 0xD3, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xFD, 0x3F, 0xE0, 0x07, 0xFC,
-    0x00, 0xFF, 0xC3, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0xF0, 0x1F, 0xFC, 0x03, 0xFF, 0x02,
-    0xFF, 0xEB, 0xFF, 0xFA, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x87,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00,
-    0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00,
-    0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x00,
-    0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F,
-    0xF5, 0x55, 0x6F, 0xF4, 0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x8B, 0xFD,
-    0x00, 0x00, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x3F, 0xC0, 0x0B, 0xFF, 0xFD, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xEB, 0xFF, 0xD0,
-    0x3F, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 0xC0, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x3F, 0xF0, 0x3F, 0xF0,
-    0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x07, 0xFD, 0x07, 0xFE, 0x00, 0x2F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF,
-    0xC0, 0xBF, 0xE0, 0x07, 0xFF, 0x02, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x02, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xBF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x9F, 0xE0, 0x00, 0x7F, 0xF4,
-    0xBF, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xAB, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x3F,
-    0xE3, 0xFC, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x07, 0xFD,
-    0x0F, 0xF4, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x2F, 0xF0, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x55, 0x56,
-    0xFF, 0x42, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0xBF, 0xD0, 0x00, 0x03,
-    0xFE, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xEF, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1A, 0x90,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF,
-    0x00, 0x2F, 0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF, 0x40, 0xFF,
-    0xF0, 0x1F, 0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03,
-    0xFE, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x3F, 0xFE,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF, 0xD2, 0xFE,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x1F, 0xFE, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0xA8, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00,
-    0x00, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xF7,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x40, 0x00, 0xFF, 0xF0,
-    0x1F, 0xFD, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xD2, 0xFE, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xE3, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xBF,
-    0xC0, 0x00, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xD3,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x1F, 0xF4,
-    0x02, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x83, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0xFE, 0x00, 0x00, 0x65, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0xFE, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0x00, 0x2F,
-    0xFF, 0xF7, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xAF, 0xFF, 0x40, 0xFF, 0xF0, 0x1F,
-    0xFD, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x03, 0xFE, 0x03,
-    0xFF, 0x00, 0x1F, 0xF4, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x7F, 0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x80,
-    0x1F, 0xFC, 0x0B, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x0B, 0xFF, 0x40, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x7F, 0x80, 0x01, 0xFF, 0xD2, 0xFE, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xF7,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xD3, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0xC0,
-    0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x1F, 0xFE, 0x2F, 0x40, 0x00, 0x1F, 0xFF, 0xC6, 0x00, 0x00, 0x1F, 0xF7,
-    0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x00, 0x2F, 0xFF, 0xF7,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xAF, 0xFF, 0x40, 0x0F, 0xFF, 0x01, 0xFF,
-    0xD0, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFE,
-    0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0xBF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0,
-    0x02, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x40,
-    0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00,
-    0x01, 0xFF, 0xD2, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xBE,
-    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0x6F, 0x40, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0x7F, 0x40, 0x00,
-    0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xDF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00,
-    0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40,
-    0x00, 0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00,
-    0x07, 0xFE, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x02, 0xF1, 0xBF, 0xD0, 0x00, 0x06, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xBF, 0x40,
-    0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02,
-    0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80,
-    0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE,
-    0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F,
-    0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00,
-    0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00,
-    0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF,
-    0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F,
-    0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC,
-    0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x3F, 0xD0, 0x00, 0x2F, 0xE0, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02,
-    0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01,
-    0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0,
-    0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8,
-    0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x14, 0x1F, 0x85, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0xBC, 0x00, 0x00, 0x03,
-    0xE0, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFD,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x03, 0xFE, 0x00, 0x00,
-    0x1F, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0xBF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40, 0x2F, 0xF4, 0x00,
-    0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0x92, 0xF4, 0xA4, 0x00, 0x0F, 0x8A,
-    0x0B, 0xC0, 0x00, 0x2F, 0x40, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x0B,
-    0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xFF, 0x9F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0xBF,
-    0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xE0, 0x03, 0xFF, 0x03,
-    0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x7F, 0xE0, 0x02, 0xFF, 0x01, 0xFF, 0x80,
-    0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x2F, 0xFD,
-    0x00, 0xFF, 0xFB, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF9, 0xFE, 0x00, 0x07,
-    0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7D, 0x05, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0xBC,
-    0x00, 0x00, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00,
-    0x00, 0x07, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x4F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xD0, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x03,
-    0xFE, 0x00, 0x00, 0x1F, 0xF4, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x2F, 0xF0, 0x00, 0x07, 0xFD,
-    0x00, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x55, 0x56, 0xFF, 0x40,
-    0x2F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x0B, 0xFD, 0x00, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC2, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x93, 0xE0, 0xA4,
-    0x00, 0x0F, 0x82, 0x8B, 0xC0, 0x00, 0x2F, 0x40, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0xBF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xC3, 0xFC, 0x00, 0xBF, 0xFF, 0x9F, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFE, 0xBF, 0xFD, 0x03, 0xFF, 0xC0, 0x7F, 0xF4, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0xBF, 0xE0,
-    0x03, 0xFF, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x7F, 0xE0, 0x02, 0xFF,
-    0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B, 0xFE, 0x00, 0x7F, 0xF0, 0x2F, 0xF8, 0x03, 0xFF, 0x80, 0x7F,
-    0xF0, 0x2F, 0xFD, 0x00, 0xFF, 0xFB, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xF9,
-    0xFE, 0x00, 0x07, 0xFF, 0x4B, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x50, 0xBE, 0x14, 0x00, 0x00, 0x03, 0xD3, 0xD2, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x2F, 0xE0,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x00, 0x1F, 0xF4, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFD, 0x55, 0x5B, 0xFD, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xF4, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x0B,
-    0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0A, 0x4F, 0xD2, 0x90, 0x00, 0x3E,
-    0x28, 0x2F, 0x00, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xFC,
-    0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFE, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA,
-    0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC,
-    0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE,
-    0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF,
-    0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00,
-    0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x7F,
-    0xF8, 0x00, 0x00, 0x02, 0x90, 0x1A, 0x40, 0x00, 0x00, 0x05, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3E,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xFF, 0xAB, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0xC3, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01,
-    0xFF, 0x40, 0xBF, 0x80, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00,
-    0x3F, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00,
-    0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x07,
-    0xFF, 0x4B, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x02, 0xF0, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF, 0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE,
-    0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF, 0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF,
-    0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B,
-    0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01, 0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01,
-    0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0x90, 0x01, 0xA0, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xDF, 0xF0, 0x00, 0x00, 0x03,
-    0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x00,
-    0x07, 0xFD, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80,
-    0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x0B, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x00, 0x3F, 0xF5, 0x55, 0x6F, 0xF4, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xD0, 0x0F, 0xFC,
-    0x00, 0x00, 0xFF, 0x80, 0xBF, 0xD0, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0x90, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xAB,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x0F, 0xF0, 0x02, 0xFF,
-    0xFF, 0x7F, 0xC0, 0x2F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFA, 0xFF, 0xF4, 0x0F, 0xFF, 0x01, 0xFF,
-    0xD0, 0x7F, 0xF0, 0x03, 0xFF, 0x02, 0xFF, 0x80, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F,
-    0xF0, 0x01, 0xFF, 0x41, 0xFF, 0x80, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x01,
-    0xFF, 0xC0, 0xBF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0xBF, 0xF4, 0x03, 0xFF, 0xEF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE7, 0xF8, 0x00, 0x1F, 0xFD, 0x2F, 0xE0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0x81, 0xFF, 0x83, 0xFF, 0x40, 0x3F, 0xE1, 0xFF,
-    0x80, 0x0F, 0xF8, 0xBF, 0xD0, 0x1F, 0xFD, 0x3F, 0xFA, 0xBF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x07,
-    0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFA, 0x90, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0xF9, 0x6F, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0x80, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xE0, 0x7F, 0xE0, 0xFF, 0xD0,
-    0x0F, 0xF8, 0x7F, 0xE0, 0x03, 0xFE, 0x2F, 0xF4, 0x07, 0xFF, 0x4F, 0xFE, 0xAF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFE, 0xA4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x3F, 0xFE, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0xF8, 0x0B, 0xC0, 0x00, 0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xF0, 0xBF, 0xF8, 0x00, 0x00, 0xF4, 0x02, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xF5,
-    0x55, 0x50, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xEA, 0xAA,
-    0x80, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0xF4, 0x0F, 0xC0,
-    0x01, 0xFF, 0xFE, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0x1F, 0xFF, 0x40, 0x01, 0xF0,
-    0x06, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xE0, 0x7F, 0xE0, 0x0F,
-    0xFD, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFE, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x0F, 0xFE, 0xAF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xEA, 0x40, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x03, 0xFF,
-    0xE5, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xFA, 0xAA, 0xA0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFF,
-    0xFC, 0xA4, 0x00, 0x00, 0x2F, 0xE7, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x3F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x07, 0xFF, 0x40, 0x00, 0xFF, 0xEA, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08, 0x00, 0x00,
-    0x3F, 0xFE, 0x5B, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0x4F, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xC2, 0xFF, 0xD0, 0x00, 0xA6, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x7F, 0x40, 0x02, 0xFD, 0x0B, 0xF0,
-    0x01, 0xF8, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xE0, 0x7F, 0xE0, 0xFF, 0xD0,
-    0x0F, 0xF8, 0x7F, 0xE0, 0x03, 0xFE, 0x2F, 0xF4, 0x07, 0xFF, 0x4F, 0xFE, 0xAF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFE, 0xA4, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x80, 0x3F, 0xFE, 0x5B, 0xF0, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x3D,
-    0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC3, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x55, 0x54, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFC, 0x3E, 0x40, 0x00, 0x2F, 0xFF, 0x8A, 0x00, 0x00, 0x2F, 0xEB,
-    0xF0, 0x00, 0x00, 0x2F, 0xD0, 0xBE, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xFD, 0x00, 0xFF,
-    0x80, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x40, 0x7F, 0xF4, 0x00, 0xFF, 0xEA, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xEA, 0x40, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x08, 0x00,
-    0x03, 0xFF, 0xE5, 0xBF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x2E, 0x00, 0x00, 0x3F, 0xFE, 0xFD, 0x00, 0x00, 0xBE, 0xFF, 0xF8, 0x00,
-    0x00, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4F, 0xE0, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x14, 0x01, 0x40, 0x00, 0x2F, 0xF4, 0x7D, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xF8, 0x7F,
-    0xF0, 0x00, 0x09, 0x00, 0x54, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00,
-    0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0xFE, 0x00, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80, 0x0F, 0xF8,
-    0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x40,
-    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00,
-    0x03, 0xFD, 0x07, 0xFC, 0x00, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF5, 0x55, 0x50, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xAA, 0xAA, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80, 0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x94, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xF8, 0x1F, 0xF8, 0x0F, 0xFD, 0x00, 0xFF, 0x81, 0xFF, 0x80,
-    0x0F, 0xF8, 0x2F, 0xF4, 0x07, 0xFF, 0x43, 0xFF, 0xAB, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFE, 0xA4, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x02, 0x00, 0x3F, 0xFE, 0x5B, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xAB, 0xFC, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x0F, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x00, 0x43,
-    0xFC, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xBF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0B, 0xFC, 0x00, 0x01,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0,
-    0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x01,
-    0xFF, 0x80, 0x02, 0xFF, 0x40, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFE,
-    0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0xBF, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEB, 0xFF, 0x40, 0xFF, 0xE0, 0x1F, 0xFC, 0x1F, 0xFC,
-    0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC,
-    0x7F, 0xE0, 0x00, 0xFF, 0xCB, 0xFD, 0x00, 0x1F, 0xF8, 0xBF, 0xD0, 0x03, 0xFF, 0x47, 0xFE, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xD0, 0x7F, 0xFD, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x2F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x43, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x40, 0x00, 0x03,
-    0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0x43, 0xFF, 0x40, 0x00, 0x2F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x2F, 0xFC,
-    0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFD, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x04, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01,
-    0xBF, 0x80, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F,
-    0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F,
-    0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF,
-    0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83,
-    0xF4, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFD,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00,
-    0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0xFC, 0xA4, 0x00, 0x00, 0x2F, 0xE7,
-    0xF4, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xAF, 0xFD, 0x00,
-    0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07, 0xFE,
-    0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xBC, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xF4, 0x00, 0x00, 0x07, 0xF4, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x1F, 0xFF, 0x40, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x0B, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0xFF,
-    0xC0, 0x00, 0x03, 0xFF, 0x47, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x2F, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x2F,
-    0xF8, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x03, 0xFF, 0x80, 0x00,
-    0x3F, 0xF8, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x7F, 0xFD, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x40, 0x00, 0xA6, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0x9F, 0xD0, 0x00, 0x1F, 0xD0, 0xBF, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F, 0xFE, 0x01, 0xFF, 0xC1, 0xFF,
-    0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF,
-    0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD, 0x00, 0x3F, 0xF4, 0x7F, 0xE0,
-    0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0xFD, 0x00, 0x00, 0x00,
-    0xBF, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x87, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF4, 0x1F,
-    0xFF, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0xBF,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFC, 0x00, 0x00, 0x3F,
-    0xF4, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0xF8, 0x00,
-    0x03, 0xFF, 0x80, 0x0B, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xFC, 0x3F, 0x40, 0x00,
-    0x2F, 0xFF, 0x8A, 0x00, 0x00, 0x2F, 0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0xBF, 0x00, 0x00, 0x1F,
-    0x80, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xAF, 0xFD, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40,
-    0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x00,
-    0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x7F, 0xE0, 0x07,
-    0xFF, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xEF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0x00, 0x00, 0x00,
-    0xBF, 0xFE, 0xFC, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xF2, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
-    0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF,
-    0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00,
-    0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF,
-    0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x2F, 0xF4, 0x7D,
-    0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0xF8, 0x7F, 0xF0, 0x00, 0x0A, 0x00, 0x54, 0x00, 0x00, 0x06,
-    0xAA, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0xFE, 0x00,
-    0x07, 0xE0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F,
-    0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD,
-    0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0xBF, 0x40,
-    0x00, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFD, 0x07, 0xFF, 0xD0, 0x07, 0xFF,
-    0x80, 0x03, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x02, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x0F,
-    0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD1, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x4B, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x0B, 0xFE, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF4, 0x3F, 0xF4, 0x00,
-    0x02, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x02, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xD0, 0x1F, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x8F, 0xF0, 0x00, 0x3F, 0xD0, 0x7F, 0x80,
-    0x0B, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x1F, 0xFF,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xBF, 0xF4, 0x0F,
-    0xFE, 0x01, 0xFF, 0xC1, 0xFF, 0xC0, 0x0F, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x0F,
-    0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFC, 0xBF, 0xD0, 0x01, 0xFF, 0x8B, 0xFD,
-    0x00, 0x3F, 0xF4, 0x7F, 0xE0, 0x07, 0xFF, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xFE, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80,
-    0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x80, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFD, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40,
-    0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF,
-    0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0x00,
-    0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xD0, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF,
-    0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0,
-    0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
-    0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x7F, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0x80,
-    0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
-    0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x69, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0xBF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x01,
-    0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0,
-    0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x07,
-    0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x03, 0xF1, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0B, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x07, 0xFD, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3E, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x7C, 0x00, 0xB9,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-    0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xEB, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0,
-    0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF, 0x80, 0x00,
-    0xBF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x7F, 0xFF, 0x40, 0x1F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x2F, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xFE,
-    0x00, 0x07, 0xFF, 0x80, 0x02, 0xFF, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xF8,
-    0x00, 0x1F, 0xFF, 0xF0, 0x3F, 0xF0, 0x00, 0xBF, 0xFF, 0xFD, 0xBF, 0xD0, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x07, 0xFF, 0xEB, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xD0, 0x00, 0x1F, 0xFC,
-    0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x01, 0xFF,
-    0x80, 0x00, 0xBF, 0xD0, 0x03, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xF0,
-    0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0,
-    0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-    0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE,
-    0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F, 0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF,
-    0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x3F, 0xF0, 0x02, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x0B,
-    0xFD, 0x00, 0x3F, 0xF0, 0x2F, 0xF0, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFF, 0x00,
-    0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x03, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF8,
-    0x0F, 0xFC, 0x00, 0xFF, 0xD0, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xF7, 0xFC, 0x00, 0x7F, 0xFF, 0x8F,
-    0xF0, 0x00, 0x7F, 0xF4, 0x3F, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x6B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x03,
-    0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0x40,
-    0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xF0,
-    0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xD0, 0x2F, 0xF8, 0x00, 0x0F, 0xFC,
-    0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x02, 0xFF,
-    0x80, 0x7F, 0xE0, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x7F,
-    0xF0, 0x0B, 0xFD, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x7F,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x2F, 0xF4, 0x00, 0xFF,
-    0xC0, 0xBF, 0xC0, 0x07, 0xFE, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x7F,
-    0xE0, 0x03, 0xFF, 0x02, 0xFF, 0x40, 0x0F, 0xF8, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xF0, 0x03,
-    0xFF, 0x40, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFC, 0x0B, 0xFF, 0x80,
-    0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xDF, 0xF0, 0x01, 0xFF, 0xFE, 0x3F, 0xC0, 0x01, 0xFF,
-    0xD0, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0xFF,
-    0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xEF, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xF9, 0x00, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC3, 0xFF,
-    0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0xFF, 0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x0F,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF,
-    0xEF, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFC, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F,
-    0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xBF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x1F,
-    0xF4, 0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x03, 0xFF, 0x00,
-    0x00, 0xFF, 0xCF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x2F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x3F, 0xF0, 0x01, 0xFF, 0x4F, 0xFC, 0x00, 0xFF,
-    0xC0, 0x0B, 0xFE, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xC0, 0x07, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFC, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xEF,
-    0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x06,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0xFF,
-    0x80, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xD0,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x2F, 0xF8, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x02, 0xE4, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x03, 0xFF,
-    0x00, 0x1F, 0xF4, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xBF, 0xEF, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xF9, 0x00, 0x00,
-    0x3F, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x0B, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xE0, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xBF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xEF, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE3, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x1F, 0xF4,
-    0x00, 0x0B, 0xFC, 0x3F, 0xF0, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x00,
-    0xFF, 0xCF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFD, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0xFF, 0xC0, 0x07, 0xFD, 0x3F,
-    0xF0, 0x03, 0xFF, 0x00, 0x2F, 0xFB, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF,
-    0xD0, 0x03, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x1F, 0xFE, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xC0,
-    0x0F, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xF0, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x43,
-    0xFC, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF,
-    0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x2F,
-    0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x7F, 0xC0,
-    0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF4, 0x00, 0x00,
-    0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7,
-    0xFE, 0x00, 0x0F, 0xFD, 0x0F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0,
-    0x3F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFB, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x02, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00,
-    0x0F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x2F, 0xF8,
-    0x00, 0x01, 0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x0B, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x3F,
-    0xF0, 0x00, 0x00, 0x3F, 0xD2, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x03, 0xFE,
-    0x7F, 0xD0, 0x00, 0x00, 0x0B, 0xFA, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xBD, 0x00, 0x00, 0x07, 0xFF, 0x4F,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x3F, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 0xC0, 0x01, 0xFF, 0xF8,
-    0x02, 0xFD, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x6F, 0xF4,
-    0x00, 0x2F, 0xFC, 0x7F, 0xE0, 0x00, 0xFF, 0xD0, 0xFF, 0xC0, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x7F,
-    0xF0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF8, 0x00, 0x3F, 0xE1, 0xFF, 0xC0, 0x00,
-    0xFF, 0xCF, 0xFC, 0x00, 0x02, 0xFF, 0xBF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x43, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0B, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x00,
-    0xBF, 0xE0, 0x00, 0x07, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x2F, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x4B, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF9, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xEB, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0xBF, 0xD0, 0x3E, 0x00, 0x0B, 0xFF, 0xFB, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xF4,
-    0x7F, 0xFC, 0x00, 0x0B, 0x80, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF6, 0xFF, 0x40, 0x02, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xFD, 0x0F,
-    0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x01, 0xFF, 0x42,
-    0xFF, 0x80, 0x03, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0xFF, 0xC0, 0x00, 0x2F, 0xFB, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x7D, 0x00, 0x00,
-    0x0F, 0xFF, 0xEB, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xF4, 0xBF, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x1E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xE0, 0x00, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00,
-    0x2F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x2F, 0xF0, 0x0B, 0xFE, 0x00, 0x00, 0x7F,
-    0xC0, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFD, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF4, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xD3, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xF4, 0x00,
-    0x00, 0x02, 0xFE, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2, 0xFF, 0xFC,
-    0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x0E,
-    0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x05, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x15, 0x55, 0x55, 0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8,
-    0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE,
-    0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F,
-    0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF,
-    0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7,
-    0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD,
-    0xFE, 0x00, 0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xE0, 0x07, 0xF7, 0xF8, 0x01, 0xFD, 0xFE, 0x00, 0x7F,
-    0x6A, 0x40, 0x0A, 0x80, 0x05, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xF0,
-    0x2A, 0xAA, 0xAA, 0xA0, 0x00, 0x3F, 0x80, 0x2F, 0xD0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x03,
-    0xFF, 0x01, 0xFF, 0x40, 0xFF, 0xC0, 0x15, 0x50, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xD0, 0x3F, 0xF0,
-    0x1F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xF4, 0x0B, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00,
-    0x15, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0xC1, 0xFC, 0x05,
-    0x40, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x1F, 0xF0, 0x3F, 0xC0, 0x0F, 0xF4,
-    0x2F, 0xE0, 0x07, 0xFC, 0x0F, 0xF4, 0x03, 0xFE, 0x0B, 0xFC, 0x01, 0xFF, 0x43, 0xFE, 0x00, 0xFF,
-    0xC2, 0xFF, 0x00, 0x15, 0x50, 0x55, 0x40, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x02, 0xFF, 0x07, 0xFE,
-    0x03, 0xFF, 0x0B, 0xFC, 0x07, 0xFC, 0x0F, 0xF8, 0x0B, 0xF8, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F, 0xD0,
-    0x2F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x00, 0x15, 0x00, 0x55, 0x00, 0x02, 0xFF, 0x07, 0xFD,
-    0x03, 0xFF, 0x0B, 0xFC, 0x07, 0xFD, 0x0F, 0xF8, 0x0F, 0xFC, 0x1F, 0xF0, 0x0F, 0xF0, 0x3F, 0xE0,
-    0x2F, 0xE0, 0x3F, 0xC0, 0x3F, 0xC0, 0xBF, 0x40, 0x7F, 0x80, 0xFF, 0x00, 0x15, 0x00, 0x54, 0x00,
-    0x7F, 0xC1, 0xFF, 0x1F, 0xF0, 0x7F, 0xC7, 0xFC, 0x0F, 0xF0, 0xFF, 0x03, 0xFC, 0x3F, 0xC0, 0xFF,
-    0x4B, 0xF0, 0x2F, 0xD1, 0xFD, 0x07, 0xF4, 0x3F, 0x40, 0xFD, 0x05, 0x40, 0x15, 0x00, 0x00, 0x01,
-    0x54, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xEB, 0xFA, 0xFC, 0x7F, 0xFF, 0xFF, 0xE2,
-    0xFF, 0xFF, 0xFF, 0x4B, 0xEB, 0xFA, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x29, 0x5F, 0xD5, 0xA0, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x25, 0x4F, 0xD5, 0x60, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x50, 0x3F, 0x40, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0x87, 0xFF, 0xFC, 0xBF, 0xFF, 0xDB, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xEB, 0xFF, 0xFD, 0x7F, 0xFF, 0xC2, 0xFF, 0xF4, 0x07, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x7D, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFD, 0x2F, 0xFF, 0x80, 0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC2, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0xBF, 0xC0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x02, 0xFC, 0x7F, 0xF0, 0x0B, 0xFE, 0xBF, 0xF0, 0x0F, 0xFE, 0xBF, 0xF0, 0x0F, 0xFE,
-    0x7F, 0xD0, 0x0B, 0xFC, 0x05, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x01, 0xFE, 0x00, 0x7F, 0x87, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF6, 0xFF, 0xC0, 0xBF, 0xF0, 0x1F,
-    0xFD, 0xBF, 0xF0, 0x2F, 0xFC, 0x07, 0xFF, 0x1F, 0xF4, 0x07, 0xFD, 0x00, 0xFF, 0x80, 0x50, 0x00,
-    0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFF, 0x5F, 0xFD, 0x7F, 0xF0, 0xFF, 0x80, 0x50,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF,
-    0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00,
-    0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC2, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x1F, 0xE1, 0xFD, 0x0A, 0x90, 0x00, 0x0A, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF,
-    0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xEF, 0xFC, 0xFF, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xCB, 0xF2, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFC, 0x7F, 0x4F, 0xF4, 0xFF, 0x4F, 0xF4,
-    0xBF, 0x40, 0x6E, 0x43, 0xF8, 0x7F, 0x82, 0xFD, 0x7F, 0xC2, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD,
-    0x0B, 0xF6, 0xFD, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0xCF, 0xF0, 0x3F, 0xC0, 0x00,
-    0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0xFF,
-    0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x2F, 0xD3, 0xFC, 0x2F, 0xD0, 0x00, 0xBF, 0x40, 0x0F,
-    0xF1, 0xFF, 0x0F, 0xF1, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x00,
-    0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0xFD,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0B, 0xF4, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xD0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0xE1,
-    0xFD, 0x0A, 0x90, 0x00, 0x0A, 0x90, 0x00, 0x06, 0x90, 0x0F, 0xF0, 0xFF, 0x4F, 0xE2, 0xFF, 0xF0,
-    0x02, 0xFF, 0xF0, 0x02, 0xFF, 0xF0, 0x3F, 0xEF, 0xFC, 0xFF, 0x3F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF0, 0xBF, 0xFF, 0xCB, 0xF2, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFC, 0x7F, 0x4F, 0xF4, 0xFF, 0x4F, 0xF4, 0xBF, 0x4F, 0xF4, 0xBF, 0x40, 0x6E, 0x43, 0xF8,
-    0x7F, 0x82, 0xFD, 0x7F, 0xC2, 0xFD, 0x7F, 0xC2, 0xFD, 0x00, 0x00, 0x3F, 0xC2, 0xFD, 0x0B, 0xF6,
-    0xFD, 0x0B, 0xF6, 0xFE, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x3F, 0xCF, 0xF0, 0x3F, 0xCF,
-    0xF4, 0x2F, 0xD0, 0x00, 0x1F, 0xD0, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x3F, 0xC0, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0xFF, 0x07, 0xFC, 0xFF, 0x07, 0xFC, 0xFF, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x03,
-    0xFC, 0x2F, 0xD3, 0xFC, 0x2F, 0xD3, 0xFC, 0x2F, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0x0F,
-    0xF1, 0xFF, 0x0F, 0xF5, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x03,
-    0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x01, 0xFF,
-    0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x0B, 0xF8, 0x0F, 0xF4, 0x01, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xD0,
-    0x3F, 0xC0, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x03,
-    0xF4, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0xBF, 0x40,
-    0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x0F, 0xF4, 0x0F, 0xF0,
-    0x2F, 0xE0, 0x07, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0xF8, 0x0B, 0xF0, 0x02, 0xFC,
-    0x03, 0xFC, 0x07, 0xF4, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xFC, 0x00, 0xBE, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x03, 0xFC, 0x00, 0xBF, 0x00,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x2F, 0x40, 0x3F, 0xC0, 0x7F, 0x80, 0x0B, 0xF8, 0x0F, 0xF4, 0x00,
-    0xFF, 0x01, 0xFE, 0x00, 0x2F, 0xD0, 0x3F, 0xC0, 0x03, 0xFC, 0x07, 0xF4, 0x00, 0xBF, 0x00, 0xFF,
-    0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x01, 0xFC, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0xC0,
-    0x7F, 0x80, 0xBF, 0x40, 0x2F, 0xE0, 0x3F, 0xD0, 0x7F, 0xC0, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x1F, 0xE0, 0x03, 0xFC, 0x07, 0xF4, 0x0B, 0xF0, 0x02, 0xFC, 0x03, 0xFC,
-    0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFD, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0xFD, 0x00, 0x2F,
-    0x40, 0x3F, 0x00, 0x7E, 0x00, 0x02, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xD0,
-    0x00, 0x7E, 0xE0, 0x00, 0xF4, 0xF0, 0x02, 0xF0, 0xF0, 0x07, 0xD0, 0xF4, 0x0F, 0x80, 0xB8, 0x2F,
-    0x00, 0x78, 0x3D, 0x00, 0x7C, 0x00, 0x08, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03,
-    0xFF, 0x40, 0xFF, 0xE0, 0x2F, 0xF8, 0x0B, 0xFF, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x3F, 0xF4,
-    0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xD0, 0x03, 0xE4, 0x00, 0x10, 0x00, 0x00, 0x14, 0x00,
-    0x2F, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0B,
-    0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF4, 0x0F, 0xFD, 0x02, 0xFF, 0x80, 0xBF, 0xE0, 0x07, 0xFC, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0F, 0xF0,
-    0x00, 0x20, 0x00, 0xBC, 0x00, 0x7F, 0xE0, 0x02, 0xF0, 0x0B, 0xFC, 0x01, 0xFF, 0x80, 0x2F, 0xF0,
-    0x0F, 0xFC, 0x03, 0xFC, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x01, 0x40, 0x2F, 0xF4, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x0F, 0xFC, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x40, 0x10, 0x1F,
-    0xE0, 0x0F, 0xFF, 0xF4, 0x07, 0xF4, 0xFF, 0xC0, 0x0F, 0xFF, 0x40, 0x3F, 0xF3, 0xFF, 0x00, 0x2F,
-    0xFC, 0x00, 0xFF, 0xCB, 0xFC, 0x02, 0xFF, 0xFC, 0x02, 0xFF, 0x06, 0x80, 0x2F, 0xFF, 0xFC, 0x01,
-    0x90, 0x00, 0x02, 0xFF, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x0F, 0xFC, 0x00, 0x2F, 0xF4, 0x0B, 0xE0, 0x0F, 0xFC, 0x02, 0xFF, 0x40, 0x7F, 0xD0, 0x0F, 0xF8,
-    0x03, 0xF4, 0x01, 0xFF, 0x80, 0x0F, 0xD0, 0x03, 0x40, 0x07, 0xFD, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x0B, 0xFE, 0x00, 0x7F, 0xF4, 0x0F, 0xFD, 0x00,
-    0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x2F, 0xF8, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x01, 0xFF, 0x40,
-    0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0xBF, 0xC0, 0x03, 0xFE, 0x00, 0xFF,
-    0xC0, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF, 0x00,
-    0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0x3F, 0xF0, 0x0F, 0xFD, 0x00, 0xBF, 0xF0,
-    0x1F, 0xFD, 0x00, 0xBF, 0xF0, 0x1F, 0xFC, 0x00, 0x3F, 0xD0, 0x0F, 0xF4, 0x00, 0x05, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFD, 0x7F, 0xD0, 0x4F, 0xF0, 0xFF, 0x40, 0x3F, 0x83, 0xFD,
-    0x01, 0xFD, 0x2F, 0xF0, 0x0B, 0xF6, 0xFF, 0x80, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x6A, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0xAB, 0x40, 0x00, 0x00,
-    0x78, 0xF0, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xBC, 0x03, 0xF9, 0x06, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x00,
-    0x2C, 0x3C, 0x00, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0x01, 0xF4,
-    0xF0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xBC, 0x0B, 0x80, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x7C, 0x00, 0x1F, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-    0x07, 0xC0, 0xFF, 0x40, 0x64, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x0B, 0xF4, 0x0B, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x10, 0x00, 0xBF, 0x40, 0x00, 0x40, 0x0F, 0xE0, 0x00, 0x00, 0x40,
-    0x0B, 0xF0, 0x00, 0x0F, 0x40, 0xFD, 0x00, 0x00, 0x0F, 0x80, 0xFE, 0x00, 0x01, 0xFF, 0x4F, 0xC0,
-    0x00, 0x00, 0xFF, 0x8F, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x5A, 0x80, 0x2F, 0xFF, 0xFD, 0x56, 0x81,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x40, 0x3F, 0xFB, 0xF0, 0x00, 0x00, 0x2F, 0xF7, 0xF0, 0x00, 0x0F,
-    0xFC, 0x7F, 0x40, 0x00, 0x0B, 0xFD, 0x3F, 0x80, 0x00, 0x7F, 0x43, 0xFC, 0x00, 0x00, 0x3F, 0x82,
-    0xFC, 0x00, 0x00, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0xB0, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE2, 0xFF, 0xFE, 0x3F, 0xFF, 0xD3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0xA4, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0x54, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x55, 0x54, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xAF, 0xFC,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x5B, 0xFC,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x6F, 0xFE,
-    0x40, 0x1F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xF8, 0x03, 0xFF, 0x47, 0xD0, 0x0F, 0xFC, 0x04,
-    0x00, 0x1F, 0xF4, 0x10, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x3F, 0xFD, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFF, 0xF4, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x01,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFC, 0x03, 0xE0, 0x0F, 0xFD, 0x07, 0xFF, 0x00, 0x40, 0x01, 0xFF, 0x41, 0xFF,
-    0x80, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x0F, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xF8, 0x01, 0xFF, 0x40,
-    0x00, 0xFF, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x07, 0xFF,
-    0x40, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x0B, 0xFC,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x1B, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x2F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xE0, 0x3F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFD, 0x01, 0xF4, 0x07, 0xFF, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0xBF, 0xE0, 0x1F, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x3F, 0xF0, 0x00, 0x07, 0xFF, 0xD0, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xD0, 0x00,
-    0x3F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00,
-    0x0B, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x55, 0x55, 0x57, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFE, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xBC, 0x1F, 0xFF, 0xFF, 0xCB, 0xC1, 0xFF, 0xFF, 0xFC, 0xBC, 0x1F, 0xFF,
-    0xFF, 0xDB, 0xC1, 0xFF, 0xFF, 0xFD, 0xBC, 0x1F, 0xFF, 0xFF, 0xEB, 0xC1, 0xFF, 0xFF, 0xFE, 0xBC,
-    0x1F, 0xFF, 0xFF, 0xDB, 0xC1, 0xFF, 0xFF, 0xFD, 0xBC, 0x1F, 0xFF, 0xFF, 0xCB, 0xC1, 0xFF, 0xFF,
-    0xFC, 0xBC, 0x1F, 0xFF, 0xFF, 0x4B, 0xC1, 0xFF, 0xFF, 0xE0, 0xBC, 0x1F, 0xFF, 0xF4, 0x0B, 0xC1,
-    0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F,
-    0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00,
-    0xBC, 0x1F, 0x40, 0x00, 0x0B, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3, 0xFF, 0xFF,
-    0xF4, 0x2F, 0x7F, 0xFF, 0xFF, 0x42, 0xF7, 0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF3,
-    0xFF, 0xFF, 0xF4, 0x2F, 0x3F, 0xFF, 0xFF, 0x42, 0xF2, 0xFF, 0xFF, 0xF4, 0x2F, 0x1F, 0xFF, 0xFF,
-    0xAB, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xAA, 0xAA, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF4, 0xBC, 0x0F, 0xFF, 0xFF, 0xCB, 0xC0, 0xFF, 0xFF, 0xFC, 0xBC, 0x0F, 0xFF, 0xFF, 0xDB, 0xC0,
-    0xFF, 0xFF, 0xFE, 0xBC, 0x0F, 0xFF, 0xFF, 0xEB, 0xC0, 0xFF, 0xFF, 0xFE, 0xBC, 0x0F, 0xFF, 0xFF,
-    0xEB, 0xC0, 0xFF, 0xFF, 0xFE, 0xBC, 0x0F, 0xFF, 0xFF, 0xDB, 0xC0, 0xFF, 0xFF, 0xFC, 0xBE, 0xAF,
-    0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFC, 0x06, 0xAA, 0xAA, 0xA4, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x2D, 0x02, 0xFC, 0x00, 0x0F, 0xF4, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0x81, 0x60, 0x0F,
-    0xFB, 0xF0, 0x00, 0x1F, 0xF8, 0xFE, 0x00, 0x07, 0xFC, 0x2F, 0xC0, 0x00, 0x3D, 0x07, 0xF8, 0x00,
-    0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x54, 0x00, 0xBF, 0xC0, 0x7F, 0xF0,
-    0x2F, 0xFC, 0x07, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x80, 0x2F,
-    0xE0, 0x0B, 0xF8, 0x02, 0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xD0, 0x03, 0xF4, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x2C,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x0B, 0x40,
-    0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F,
-    0xE4, 0x1B, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x38, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x83, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x05, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xF4, 0x59, 0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x2F, 0xF1, 0xFC,
-    0x00, 0x00, 0x2F, 0xE0, 0xFE, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x00, 0x00, 0x01, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2D, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xD2,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x05, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFC, 0x16, 0x00, 0x03, 0xFE, 0xFD, 0x00,
-    0x00, 0x1F, 0xF8, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xD0, 0x7F, 0x80, 0x00,
-    0x00, 0x40, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0xFE, 0xBF, 0xE0, 0x2F, 0xDF, 0xFE, 0x03, 0xFC, 0xBF, 0xE0, 0x7F, 0x83, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xF0,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F,
-    0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0F, 0xF0, 0x2F, 0xC1, 0xFE, 0x07, 0xFF, 0x3F, 0xC0, 0xBF, 0xF7, 0xF8, 0x0B, 0xFF, 0xBF, 0x40,
-    0x3F, 0xD0, 0x00, 0x00, 0x50, 0x00, 0x1B, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x68, 0x02, 0xFF, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x1B, 0xFC, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x01, 0xAF, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x1F, 0xD0, 0x02, 0xF4, 0x1F, 0x40,
-    0x00, 0x1F, 0x0F, 0x00, 0x00, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x3C, 0x40, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x04, 0x0F, 0xC0, 0x40, 0x00, 0xF8, 0x3F,
-    0x0B, 0x80, 0x0B, 0xF8, 0xFC, 0xBF, 0x40, 0x0F, 0xFB, 0xFB, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xCF, 0xCF, 0xF4, 0x00, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x80, 0xFC, 0x08, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x3F, 0xC1, 0xFE, 0x0B, 0xF8, 0x3F, 0xD0, 0x0B, 0xF8, 0x3F, 0xD1, 0xFF, 0x0B,
-    0xF8, 0x01, 0xFF, 0x0B, 0xF8, 0x3F, 0xD1, 0xFF, 0x00, 0x3F, 0xD0, 0xFF, 0x0B, 0xF8, 0x3F, 0xD0,
-    0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0x07, 0xF8, 0x00, 0xFF, 0x07, 0xF8, 0x2F, 0xC0, 0xFF, 0x00, 0x2F,
-    0xC0, 0xFF, 0x03, 0xF8, 0x2F, 0xC0, 0x03, 0xF4, 0x1F, 0xC0, 0xFF, 0x03, 0xF4, 0x00, 0xBE, 0x03,
-    0xF4, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x19, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFC, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x00, 0x0F,
-    0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xE3, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0,
-    0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x1A, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF4,
-    0x00, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFD, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0xA8, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x01, 0x40, 0xBF, 0xC3, 0xFF, 0x4F, 0xFD, 0x3F,
-    0xF0, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xFF, 0xC3, 0xFF,
-    0x4F, 0xFD, 0x3F, 0xF0, 0x1A, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x04, 0x02, 0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x3F, 0xF4, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x40,
-    0x00, 0x2F, 0xFC, 0x3F, 0xF0, 0x00, 0x01, 0xFF, 0xC1, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0F, 0xE0, 0x01, 0x40, 0x00,
-    0x7F, 0xC0, 0x3F, 0x80, 0x7F, 0xC0, 0x03, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x03,
-    0xF8, 0x0F, 0xFE, 0x00, 0x2F, 0xF4, 0x0F, 0xE0, 0x2F, 0xF4, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xBF, 0xEA, 0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x90, 0x0F, 0xE0, 0x06, 0x80, 0x00, 0xBF, 0xD0, 0x3F, 0x80,
-    0xBF, 0xC0, 0x03, 0xFF, 0x80, 0xFE, 0x03, 0xFF, 0x40, 0x0F, 0xFE, 0x03, 0xF8, 0x0F, 0xFD, 0x00,
-    0x2F, 0xF4, 0x0F, 0xE0, 0x2F, 0xF0, 0x00, 0x1A, 0x40, 0x3F, 0x80, 0x2A, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x87, 0xFC, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x43, 0xFF, 0x4F, 0xFE, 0x3F, 0xF8, 0xBF, 0xD0,
-    0x68, 0x00, 0x05, 0x47, 0xFE, 0xBF, 0xFB, 0xFF, 0x7F, 0xE1, 0xA4, 0x00, 0x01, 0xB8, 0x7F, 0xEB,
-    0xFF, 0xBF, 0xF3, 0xFD, 0x05, 0x00, 0x00, 0x2F, 0xCB, 0xFF, 0xBF, 0xFB, 0xFF, 0x2F, 0xC0, 0x00,
-    0x05, 0x03, 0xFD, 0xBF, 0xFB, 0xFF, 0x7F, 0xE1, 0xB8, 0xFF, 0xFF, 0x57, 0xD5, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01,
-    0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xFF, 0xFF, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xBF, 0xFE, 0x3F, 0xFC, 0x2F, 0xF8, 0x0F,
-    0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01,
-    0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x1F, 0xF4, 0x3F, 0xFC, 0xBF,
-    0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x02, 0x80, 0x0B, 0xE0, 0x2C,
-    0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF,
-    0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
-    0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x15, 0x00, 0x01, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0x2F, 0xE2, 0xFE, 0x3F, 0xC1, 0xFE, 0x7F, 0x81, 0xFE,
-    0xBF, 0x42, 0xFD, 0xFF, 0x42, 0xFD, 0xFF, 0x03, 0xFC, 0xFF, 0x07, 0xFC, 0xFF, 0x4F, 0xF4, 0xBF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x01, 0x50, 0x00, 0x00, 0xB4, 0x0B, 0xF0, 0x1F,
-    0x80, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xBE, 0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x02, 0xFC, 0x0B, 0xE0,
-    0x3F, 0x40, 0xFC, 0x07, 0xF0, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x00, 0xFD, 0xFF, 0x00,
-    0x3F, 0x8F, 0xE0, 0x0B, 0xE1, 0xFD, 0x02, 0xFC, 0x2F, 0xD0, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAF, 0xFE, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x07, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x06, 0xAF, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0xB9, 0x6F, 0xF4, 0x2F, 0xFF, 0xF8, 0x07, 0xFF, 0xF4, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x01, 0x54, 0x00, 0xBF, 0xFE, 0x03, 0xFF, 0xFD, 0x0F, 0xFE, 0xAC, 0x2F,
-    0xD0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x7F, 0xD0, 0xBF, 0xFF, 0xF4, 0xFF, 0xDB, 0xF8, 0xFF, 0x03,
-    0xFC, 0xFE, 0x03, 0xFC, 0xFE, 0x03, 0xF8, 0xBF, 0x9F, 0xF0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0x40,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFC,
-    0x00, 0x02, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0x80,
-    0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x2F, 0xFF, 0x00, 0x3F, 0xFF,
-    0xF0, 0x1F, 0xE2, 0xFD, 0x07, 0xF0, 0x7F, 0x41, 0xFE, 0x2F, 0xC0, 0x3F, 0xFF, 0xD0, 0x03, 0xFF,
-    0x80, 0x0B, 0xFF, 0xF4, 0x0B, 0xF9, 0xFF, 0x47, 0xF8, 0x1F, 0xE1, 0xFD, 0x07, 0xF8, 0x7F, 0x83,
-    0xFD, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0x54, 0x00, 0x00, 0x15, 0x00, 0x02, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xF8, 0x2F, 0xE7, 0xFC, 0x3F, 0x80, 0xFD, 0x7F, 0x40, 0xFD, 0x7F, 0x41, 0xFD,
-    0x3F, 0xDB, 0xFD, 0x3F, 0xFF, 0xFC, 0x0F, 0xFA, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0xAA,
-    0xFF, 0xD0, 0xFF, 0xFF, 0x40, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF0,
-    0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x07, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x7C, 0x00, 0x01, 0xA0, 0x00, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x00, 0xBC, 0x02, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x40,
-    0x3F, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0xBC, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x1A, 0x00, 0x00, 0x64, 0x00, 0x1F, 0x00, 0x03,
-    0xD0, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0F,
-    0xC0, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-    0x0B, 0xC0, 0x06, 0x80, 0x00, 0x02, 0x82, 0xA0, 0x0B, 0xCF, 0xFC, 0x0F, 0xFE, 0xFE, 0x0F, 0xF0,
-    0xBE, 0x0F, 0xC0, 0xBE, 0x1F, 0xC0, 0xBD, 0x2F, 0x40, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x01, 0xFC,
-    0x7F, 0x02, 0xF8, 0xBE, 0x03, 0xF4, 0x54, 0x01, 0x50, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x2F, 0xF1, 0xFE, 0x3F, 0xD0, 0xFF, 0x3F, 0xC1, 0xFF, 0x7F, 0x81,
-    0xFE, 0xBF, 0x42, 0xFE, 0xBF, 0x43, 0xFD, 0xBF, 0x43, 0xFC, 0xBF, 0x4B, 0xF8, 0x7F, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xD0, 0x0F, 0xFF, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x07,
-    0xFF, 0x40, 0xBF, 0xFC, 0x1F, 0xFF, 0xF0, 0xBF, 0xFF, 0xC0, 0xF5, 0xFE, 0x01, 0x0B, 0xF4, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x2F, 0xFF, 0x40, 0x3F, 0xFF, 0xF0, 0x0F,
-    0xFF, 0xFE, 0x00, 0xC0, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x7F, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x0B, 0xAB, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x05, 0x7F, 0xD0,
-    0x03, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0xBE, 0x6F, 0xFC, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xFF,
-    0x80, 0x2F, 0xDF, 0xD0, 0x1F, 0xCB, 0xF0, 0x1F, 0xC3, 0xFC, 0x0F, 0xD0, 0xFE, 0x0B, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFC, 0xAA, 0xAF, 0xFA, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x02, 0x9B, 0xFD, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x39, 0x5B, 0xFC, 0x0F, 0xFF, 0xFC, 0x03, 0xFF,
-    0xF8, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0x54, 0x00, 0x1F, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x2F,
-    0xFA, 0xA4, 0x1F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFA, 0xFE, 0x01, 0xFF, 0xFF, 0xE0, 0x7F,
-    0xD7, 0xFC, 0x2F, 0xD0, 0x7F, 0x0B, 0xF0, 0x1F, 0xC1, 0xFC, 0x0B, 0xF0, 0x3F, 0xDB, 0xF8, 0x0B,
-    0xFF, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x7F, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x2F, 0xFF, 0x40, 0x2F, 0xFF, 0xF0, 0x0F, 0xF1, 0xFE, 0x07, 0xF4, 0x3F, 0x80, 0xFE, 0x2F,
-    0xC0, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xF8, 0x07, 0xFD, 0xFF, 0x43, 0xFC, 0x0F,
-    0xF0, 0xFE, 0x03, 0xFC, 0x3F, 0xC2, 0xFE, 0x0B, 0xFF, 0xFF, 0x00, 0xBF, 0xFE, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x15, 0x00, 0x02, 0xFF, 0xE0, 0x0B, 0xFF, 0xFC, 0x1F, 0xF6, 0xFD, 0x3F, 0xC0, 0xFE,
-    0x3F, 0x80, 0xFE, 0x3F, 0x80, 0xFE, 0x3F, 0xD7, 0xFE, 0x2F, 0xFF, 0xFD, 0x0B, 0xFA, 0xFC, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0xF0, 0xAA, 0xBF, 0xE0, 0xBF, 0xFF, 0x40, 0xBF, 0xF8, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0A, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x55,
-    0x55, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x07, 0xD0,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x0B, 0xC0,
-    0x00, 0xA0, 0x00, 0x00, 0x28, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x1F, 0x00, 0x07,
-    0xD0, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7D,
-    0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x02, 0x90, 0x00, 0x01, 0xFD,
-    0x2A, 0x0B, 0xFF, 0xBE, 0x1F, 0xFB, 0xFD, 0x3F, 0x81, 0xFC, 0x7F, 0x01, 0xFC, 0xBF, 0x01, 0xF8,
-    0xBE, 0x03, 0xF4, 0xFE, 0x07, 0xF0, 0xBF, 0x1F, 0xF0, 0x7F, 0xFF, 0xE0, 0x2F, 0xF7, 0xD0, 0x01,
-    0x40, 0x00, 0x00, 0xBF, 0x90, 0x1F, 0xFF, 0xD1, 0xFE, 0x2F, 0x8F, 0xD0, 0x7E, 0x7F, 0x07, 0xF6,
-    0xFF, 0xFF, 0x8B, 0xFF, 0x90, 0x2F, 0x40, 0x00, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0x01, 0xFF, 0xFC,
-    0x00, 0x55, 0x00, 0x00, 0xBF, 0x80, 0x2F, 0xFF, 0xC1, 0xFE, 0xBF, 0x8F, 0xD0, 0x7F, 0x7F, 0x01,
-    0xFE, 0xF8, 0x07, 0xFB, 0xD0, 0x2F, 0xFF, 0x40, 0xFD, 0xBF, 0x0B, 0xF0, 0xFF, 0xFF, 0x41, 0xFF,
-    0xF0, 0x00, 0x54, 0x00, 0x02, 0xA4, 0x0A, 0x90, 0x2F, 0xC3, 0xFC, 0x00, 0xFC, 0xBF, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x2F, 0xFF, 0x00,
-    0x07, 0xF3, 0xF4, 0x01, 0xFD, 0x2F, 0xC0, 0x3F, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x90, 0x07, 0xFF, 0xF4, 0x07, 0x56, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x05, 0xFD, 0x07, 0xFF, 0xFD,
-    0x1F, 0xFA, 0xFC, 0x3F, 0x42, 0xF8, 0x3F, 0x07, 0xF0, 0x3F, 0xFF, 0xD0, 0x1F, 0xFF, 0x40, 0x01,
-    0x50, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02,
-    0xF5, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xEB, 0xF4, 0x1F, 0xD0, 0xFD, 0x0B, 0xF0, 0x3F, 0x43,
-    0xF4, 0x0F, 0xC0, 0xFC, 0x07, 0xF0, 0x7F, 0x02, 0xF8, 0x1F, 0x80, 0xFD, 0x0B, 0xD0, 0x3F, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0A, 0x90, 0x3F, 0x43, 0xF8, 0x03, 0xF0, 0xFD, 0x00, 0x7F,
-    0x3F, 0x40, 0x0B, 0xEF, 0xD0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x01, 0xFD, 0xBE, 0x00,
-    0x2F, 0x83, 0xF0, 0x03, 0xF4, 0x3F, 0x80, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF4, 0x03, 0xF0, 0x07, 0xF0, 0x0B, 0xE0,
-    0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xA1,
-    0xFC, 0x0B, 0xE0, 0x0F, 0xAF, 0xFC, 0xFF, 0xE0, 0x3F, 0xEB, 0xFF, 0xBF, 0xC1, 0xFD, 0x0F, 0xF0,
-    0x3F, 0x0B, 0xF0, 0x3F, 0x41, 0xFC, 0x3F, 0x40, 0xFC, 0x0B, 0xE0, 0xFC, 0x07, 0xF0, 0x3F, 0x43,
-    0xF0, 0x2F, 0x80, 0xFC, 0x1F, 0x80, 0xFD, 0x03, 0xF0, 0xBD, 0x03, 0xF0, 0x1F, 0x83, 0xF4, 0x1F,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x92, 0xF8, 0x00, 0xFB, 0xFF, 0xC0, 0x7F, 0xEB,
-    0xF0, 0x2F, 0xC0, 0xFC, 0x0F, 0xE0, 0x3F, 0x03, 0xF0, 0x1F, 0xC1, 0xFC, 0x0B, 0xE0, 0x7E, 0x02,
-    0xF4, 0x2F, 0x40, 0xFC, 0x0F, 0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA4,
-    0xBD, 0x00, 0x0F, 0xBF, 0xF8, 0x01, 0xFF, 0x7F, 0xC0, 0x2F, 0xC0, 0xFC, 0x03, 0xF4, 0x0F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7E, 0x03, 0xF8, 0x0B, 0xF0, 0xBF, 0x00, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xDF, 0xF4, 0x01, 0xF8, 0x14, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xFF, 0xFE, 0x1F, 0xD5, 0xC2, 0xFC, 0x00,
-    0x1F, 0xF4, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0x80, 0x02, 0xFC, 0x40, 0x2F, 0x8B, 0xFF, 0xF4, 0xBF,
-    0xFD, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x6F, 0xE9, 0xBF, 0xFF, 0x5B,
-    0xFA, 0x81, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-    0xF4, 0x0F, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00,
-    0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x01, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x2A, 0xAA,
-    0xA4, 0xFF, 0xC0, 0xFF, 0xFF, 0xD3, 0xFE, 0x07, 0xFF, 0xFF, 0x0F, 0xF8, 0x2F, 0xFF, 0xFC, 0x3F,
-    0xE0, 0xBF, 0x80, 0x00, 0xFF, 0xC3, 0xFD, 0x00, 0x03, 0xFF, 0xEF, 0xF9, 0x54, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xE5, 0x50,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x05, 0x00, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x7C, 0x00, 0x00, 0x1B, 0xFE,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0x9B, 0xF4, 0x07, 0xFF, 0xEF, 0x0B, 0xE0, 0x0F, 0xFF, 0x3E, 0x0F, 0x40, 0x2F,
-    0xFC, 0x3D, 0x1F, 0x00, 0x3F, 0xF4, 0xBC, 0x3E, 0x00, 0x7F, 0xF0, 0xF4, 0x3C, 0x00, 0xBF, 0xE1,
-    0xF0, 0xBC, 0x00, 0xBF, 0xD3, 0xE0, 0xF4, 0x00, 0xFF, 0xC3, 0xD1, 0xF0, 0x00, 0xFF, 0xCB, 0xC3,
-    0xE0, 0x00, 0xFF, 0xCF, 0x83, 0xD0, 0x00, 0xFF, 0xEF, 0x0B, 0xC0, 0x00, 0xBF, 0xFE, 0x0F, 0x40,
-    0x00, 0x7F, 0xFD, 0x1F, 0x1C, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE4, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0x00, 0x0B,
-    0xC3, 0xE0, 0x00, 0x00, 0x0F, 0x83, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0xF4, 0x06, 0xF0, 0x07, 0xFF, 0x80, 0x00, 0x10, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x1A, 0x42, 0xD0,
-    0x7F, 0xF0, 0x3F, 0x4F, 0xD0, 0xBF, 0xE0, 0x3F, 0x7F, 0xC0, 0xBF, 0xD0, 0x7F, 0xFF, 0xC0, 0xFF,
-    0xD0, 0xBF, 0xE4, 0x40, 0xFF, 0xC0, 0xBF, 0xC0, 0x00, 0xFF, 0xC0, 0xFF, 0x40, 0x00, 0xFF, 0xD0,
-    0xFF, 0x00, 0x00, 0xBF, 0xE1, 0xFF, 0x00, 0x00, 0x7F, 0xF2, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFE,
-    0x6C, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xF9, 0x55, 0x54, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xAF, 0xFF, 0xA9, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFE, 0x01, 0xA0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x7F, 0xF9, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x5F, 0xFE, 0x55, 0x40, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xAF, 0xFE, 0xAA, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x64, 0x03, 0xFA,
-    0x50, 0x00, 0x2F, 0xC2, 0xFF, 0xE2, 0xFF, 0xFF, 0x00, 0x0F, 0xF2, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFD, 0xBF, 0xFF, 0xEB, 0xFF, 0x40, 0xBF,
-    0xF8, 0x0F, 0xFF, 0xC0, 0xBF, 0xD0, 0x2F, 0xFC, 0x02, 0xFF, 0xC0, 0x1F, 0xF4, 0x0F, 0xFD, 0x00,
-    0xFF, 0xE0, 0x0B, 0xFD, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0F, 0xFC,
-    0x00, 0xFF, 0xC0, 0xBF, 0xD0, 0x0B, 0xFE, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x03, 0xFF, 0x40, 0x1F,
-    0xF4, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x0B, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0x01,
-    0xFF, 0x40, 0xFF, 0xF8, 0x00, 0xFF, 0xC0, 0xBF, 0xC0, 0xFF, 0xFD, 0x00, 0x3F, 0xE0, 0x3F, 0xF0,
-    0x7F, 0xFF, 0x40, 0x1F, 0xF4, 0x0F, 0xFC, 0x3F, 0xFF, 0xC0, 0x0B, 0xFC, 0x07, 0xFE, 0x3F, 0xBF,
-    0xF0, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0xBE, 0x00, 0x0B, 0xFF, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xC0, 0x0F,
-    0xE0, 0x00, 0xFF, 0xF0, 0x07, 0xF4, 0x00, 0x7F, 0xFC, 0x02, 0xFC, 0x00, 0x1F, 0xFF, 0x40, 0xFF,
-    0x00, 0x0B, 0xFB, 0xD0, 0x3F, 0x80, 0x03, 0xFA, 0xF4, 0x1F, 0xD0, 0x0A, 0xFF, 0xFF, 0xAF, 0xFA,
-    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xF1, 0xFC, 0x3F, 0x80,
-    0x03, 0xF8, 0x7F, 0x1F, 0xD0, 0x0A, 0xFF, 0xBF, 0xEF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF0, 0x3F, 0x3F, 0x80, 0x03, 0xF8, 0x0F, 0xDF, 0xD0, 0x00,
-    0xFD, 0x03, 0xFB, 0xF0, 0x00, 0x7F, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xC0, 0x2F, 0xFE, 0x00, 0x0F,
-    0xF0, 0x0B, 0xFF, 0x40, 0x03, 0xF8, 0x01, 0xFF, 0xD0, 0x01, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF5, 0xBF,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xC0,
-    0xA8, 0x00, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x3F, 0x80,
-    0x00, 0x3F, 0xE0, 0x0B, 0xFD, 0x1F, 0xD0, 0x00, 0x0F, 0xF4, 0x0B, 0xFF, 0x1F, 0xFF, 0xF0, 0x07,
-    0xFE, 0xAF, 0xFF, 0xAF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x86, 0xFF, 0xEA, 0x40, 0x3F, 0xFF, 0xFE, 0x40, 0x3F, 0xD0, 0x00, 0x1F, 0xFA, 0x94, 0x00,
-    0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x0F, 0xFD, 0x70, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE6, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x01, 0xFF,
-    0xC0, 0x06, 0x50, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x07, 0xFF, 0xFD, 0x00, 0x3F, 0xF0, 0x0F, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0x7F, 0xF3, 0xFF, 0xFF, 0xD0, 0x07, 0xFD, 0x03, 0xFF, 0x9F,
-    0xF8, 0x1F, 0x00, 0x2F, 0xF5, 0xBF, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0x80, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x1F, 0xFF,
-    0x80, 0x0F, 0xFC, 0x2F, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xE0, 0xBF, 0xD0, 0x00, 0x0F, 0xFD,
-    0x01, 0xFF, 0x41, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x0B, 0xFD, 0x03, 0xFE, 0x10, 0x00, 0x7F, 0xC0,
-    0x3F, 0xF0, 0x0F, 0xFC, 0xBD, 0x5B, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF2, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFE, 0x00, 0xBF, 0xDB, 0xFF, 0xFF, 0x80, 0x1F, 0xF4, 0x01, 0xFF, 0x8B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x07, 0xF0,
-    0x02, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xFC, 0x01, 0xFD, 0x00, 0x7F, 0x00, 0x7F, 0xF0,
-    0x0F, 0xF0, 0x02, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0x80, 0x0B, 0xF0, 0x0F, 0xFE, 0x02, 0xFC, 0x00,
-    0x2F, 0xC0, 0xBE, 0xF8, 0x0F, 0xF0, 0x00, 0xBF, 0x03, 0xF7, 0xE0, 0x3F, 0x40, 0x02, 0xFC, 0x1F,
-    0xDF, 0x82, 0xFC, 0x00, 0x0F, 0xF0, 0xBD, 0xBD, 0x0F, 0xE0, 0x00, 0x3F, 0x83, 0xF6, 0xF4, 0x7F,
-    0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x5F,
-    0xE7, 0xF5, 0xFE, 0xBF, 0x54, 0x00, 0x3F, 0x6F, 0x83, 0xF2, 0xFC, 0x00, 0x00, 0xFD, 0xFD, 0x0F,
-    0xCF, 0xE0, 0x00, 0x03, 0xF7, 0xF0, 0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0xFE, 0xFC, 0x00,
-    0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0x00, 0x00, 0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00, 0x01, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x02, 0xFD, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFD, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xFE, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x01,
-    0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x0A, 0xA0, 0xFF, 0x0B, 0xF8, 0x01, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F,
-    0xF4, 0x02, 0xFE, 0x1F, 0xF0, 0xFF, 0x0F, 0xF0, 0x03, 0xFD, 0x2F, 0xE1, 0xFF, 0x0F, 0xF0, 0x03,
-    0xFC, 0x3F, 0xD2, 0xFE, 0x1F, 0xE0, 0x03, 0xFC, 0x3F, 0xC3, 0xFD, 0x2F, 0xE0, 0x07, 0xF8, 0x7F,
-    0xC3, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0x7F, 0x87, 0xFC, 0x3F, 0xC0, 0x0F, 0xF4, 0xBF, 0x87, 0xF8,
-    0x7F, 0xC0, 0x0F, 0xF0, 0xFF, 0x4B, 0xF8, 0xBF, 0x80, 0x1F, 0xF0, 0xFF, 0x0F, 0xF4, 0xFF, 0x40,
-    0x2F, 0xE1, 0xFF, 0x0F, 0xF0, 0xFF, 0x00, 0x2F, 0xD2, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xC3,
-    0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xC3, 0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0x87, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0x4B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xAA, 0xBF, 0xEA, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00,
-    0x00, 0x64, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xF6, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xE0, 0x03, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x0B, 0xFD,
-    0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x1F, 0xFD, 0x00, 0x00,
-    0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFD, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x05, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x1E, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0x6F, 0xFD, 0x55, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xD5, 0x54, 0x00, 0x00, 0xBF, 0xD0,
-    0x00, 0x00, 0x02, 0xBF, 0xFE, 0xA8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x06, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xF0, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x40, 0x02, 0xFF,
-    0x40, 0x3F, 0xF8, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x00,
-    0xFF, 0x80, 0xFF, 0xD0, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0xBF, 0xF0, 0x00,
-    0x00, 0xFF, 0xC3, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x3F, 0xF4, 0x00, 0x01, 0x6F, 0xFE, 0xFF, 0xD5,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xFE, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x83, 0xFF, 0x00, 0x00, 0x0B, 0xFD,
-    0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x0B, 0xFF, 0x00,
-    0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x05, 0x57, 0xFF, 0x95, 0x50, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x2D, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x10, 0x00, 0x01, 0xFF, 0xF8, 0xB4, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0x1F, 0xBF, 0xFF, 0xD0, 0x00, 0x09, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-    0x7D, 0xFF, 0xC0, 0x00, 0x00, 0x20, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x90, 0x01,
-    0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x40, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xF0, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x05, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xD0, 0x2F, 0xFF, 0x40,
-    0x0F, 0xF8, 0x00, 0x3F, 0xF0, 0x7F, 0xFF, 0xF8, 0x07, 0xFD, 0x00, 0x1F, 0xFC, 0x3F, 0xFA, 0xFF,
-    0x02, 0xFF, 0x00, 0x0F, 0xFE, 0x1F, 0xF0, 0x2F, 0xD0, 0xFF, 0xC0, 0x0B, 0xFF, 0x0F, 0xF4, 0x07,
-    0xF8, 0x3F, 0xF0, 0x0B, 0xFF, 0x43, 0xFC, 0x00, 0xFE, 0x0F, 0xF8, 0x2F, 0xFF, 0x81, 0xFF, 0x00,
-    0x7F, 0x47, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xC0, 0x3F, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE,
-    0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xE4, 0x00, 0x03, 0xFE,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xC1, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xE0, 0x00, 0x02, 0xFF, 0x42,
-    0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x1F, 0xF4,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x9F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x09, 0x03,
-    0xFF, 0x40, 0x00, 0x01, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x0F, 0xFF, 0xC0, 0x00, 0x0F, 0xF7,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xC7, 0xFE, 0x00, 0x0F, 0xDF,
-    0xF4, 0x7F, 0xE0, 0x03, 0xF8, 0x7E, 0x03, 0xFF, 0x00, 0xBF, 0x03, 0x80, 0x3F, 0xF0, 0x00, 0x00,
-    0x10, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0xBF, 0xC1, 0xBF, 0xF0, 0x01, 0x7F, 0xF5, 0x5F, 0xFD, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFD, 0x03, 0xFF, 0x80, 0x02,
-    0xFF, 0x9B, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0xA4, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x6F, 0x40,
-    0x1F, 0xFF, 0x5F, 0x80, 0x10, 0x03, 0xFF, 0xC2, 0xF4, 0x00, 0x00, 0xBF, 0xF0, 0x2F, 0x00, 0x00,
-    0x0F, 0xFE, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x2F, 0xF8, 0x07, 0xE5, 0x55,
-    0x43, 0xFF, 0x40, 0xBF, 0xFF, 0xF8, 0x3F, 0xF4, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0x00, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xF0, 0x0F, 0xEB, 0xFF, 0x03, 0xFF, 0x01, 0xF4, 0x3F, 0xE0, 0x3F, 0xF0, 0x2F, 0x07,
-    0xFE, 0x03, 0xFF, 0x43, 0xF0, 0xBF, 0xD0, 0x2F, 0xFC, 0x3F, 0x0F, 0xFC, 0x01, 0xFF, 0xFB, 0xE1,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFD, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xF3, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xAB, 0xFF, 0xAB, 0xFF, 0xA8, 0x00, 0x0F,
-    0xFC, 0x0B, 0xFC, 0x00, 0x00, 0xBF, 0xD0, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x06, 0xFF, 0xD5, 0x5B, 0xFE, 0x40, 0x0B, 0xFD, 0x00, 0x1F, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF4, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x90, 0x7F,
-    0xF4, 0x00, 0x04, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4,
-    0x0A, 0xAA, 0xAA, 0xBF, 0xF9, 0x2F, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x6B, 0xFF, 0xFF, 0xEA, 0xA4, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x6D, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xF7, 0xF2, 0xF4, 0x07, 0xFF, 0x83, 0xE0, 0x10, 0x0F, 0xFE, 0x07,
-    0xE0, 0x00, 0x1F, 0xFC, 0x0B, 0xD0, 0x00, 0x3F, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x0F, 0xC0,
-    0x00, 0x7F, 0xE0, 0x0F, 0x80, 0x00, 0xBF, 0xD0, 0x1F, 0x40, 0x00, 0xFF, 0xD0, 0x2F, 0x40, 0x00,
-    0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0xFF, 0xC0, 0x7E, 0x00, 0x00, 0xFF,
-    0xC0, 0xBD, 0x00, 0x00, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0xBF, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0xFD,
-    0xFC, 0x6C, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x2F,
-    0xF0, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0A, 0xFF, 0xEA, 0xBF, 0xFA, 0xA0, 0x00, 0xFF, 0x80, 0x7F,
-    0xE0, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0xD0, 0x00, 0x02, 0xFF, 0x40, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-    0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF,
-    0x00, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xEF, 0x00, 0x2F, 0xF4,
-    0x03, 0xFF, 0xFF, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x06, 0x90, 0x68, 0x1A, 0x0F, 0xF8, 0x03, 0xFE, 0x7F, 0xAF, 0xE3, 0xFE, 0x02, 0xDF, 0xFB, 0xFE,
-    0xFC, 0xFF, 0x40, 0xB7, 0xF4, 0xFD, 0x3F, 0x7F, 0xC0, 0x1F, 0xFC, 0x3F, 0x0F, 0xFF, 0xE0, 0x03,
-    0xFF, 0xEF, 0x87, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xEF, 0xFF, 0xFF,
-    0x90, 0x00, 0x03, 0xF0, 0xBD, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x29,
-    0x0A, 0x42, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFE, 0xAA, 0x40, 0x6B, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x56, 0xFF, 0x94, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x00, 0x0B, 0xFC, 0x06, 0x80, 0x00, 0x2F, 0xFB, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
-    0x6F, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x68, 0x00, 0x53, 0xFF,
-    0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x3F, 0xF0, 0x02, 0xFF, 0x00, 0xFF, 0x80, 0x0F, 0xF8, 0x07,
-    0xFD, 0x00, 0x7F, 0xD0, 0x2F, 0xF0, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x0B,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x7D,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x43, 0xE0, 0x00, 0x00, 0x0F, 0xF5, 0xF8, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xF8, 0x00, 0x01, 0xFD, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x40, 0x2F,
-    0x0B, 0x0D, 0x03, 0xD0, 0x0F, 0xCF, 0xEF, 0xC1, 0xF0, 0x03, 0xFF, 0xFF, 0xF9, 0xFC, 0x00, 0xFF,
-    0xDF, 0xEF, 0xFC, 0x00, 0x3F, 0x82, 0x82, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x14, 0x00, 0x06, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFE,
-    0x0F, 0xF8, 0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xD0, 0x3F, 0xF0, 0x0F, 0xFD, 0x01, 0xFF, 0x00,
-    0xBF, 0xD0, 0x3F, 0xF0, 0x0B, 0xFC, 0x02, 0xFF, 0x41, 0xFF, 0x40, 0x3F, 0xE0, 0x0B, 0xFC, 0x0B,
-    0xFD, 0x00, 0xFF, 0x40, 0x3F, 0xF0, 0x3F, 0xF0, 0x07, 0xFD, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F,
-    0xF0, 0x03, 0xFE, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0xC0, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFD, 0x5B, 0xFF, 0x80,
-    0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFE, 0x00,
-    0x1F, 0xF4, 0x01, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0xFF, 0xD0, 0x03, 0xFF, 0x01, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xBF,
-    0xE5, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xF9, 0x7F, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0xF0, 0x40, 0x07, 0xFF, 0x8F,
-    0x07, 0xC0, 0x00, 0x3F, 0xFC, 0x7C, 0x2E, 0x00, 0x00, 0xFF, 0xD2, 0xE0, 0xF4, 0x00, 0x07, 0xFF,
-    0x0F, 0x43, 0xD0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE5, 0x40, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0x03,
-    0xD1, 0xF0, 0x00, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0x0F, 0xFF, 0xBE, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xE5, 0xFF, 0xF4, 0x00,
-    0xFF, 0x40, 0xFF, 0xD0, 0x07, 0xFC, 0x03, 0xFF, 0x40, 0x2F, 0xF0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
-    0x7F, 0xF0, 0x03, 0xFE, 0x5B, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE, 0xBF, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF4, 0x01, 0xFF,
-    0x40, 0x7F, 0xE0, 0x0B, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0x80, 0x3F,
-    0xF8, 0x03, 0xFE, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xF0, 0xF4, 0x00, 0x00, 0x07, 0x83,
-    0xC0, 0x00, 0x00, 0x2E, 0x1F, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0xF3, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE4, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F,
-    0xFF, 0xBF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF,
-    0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4,
-    0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00,
+static const uint8_t notosans_16_bolditalicBitmaps[51158] = {
+    0x4F, 0xC9, 0x39, 0xFC, 0x93, 0x9F, 0xC4, 0xAF, 0xA4, 0xFC, 0x94, 0xFC, 0x5F, 0xC4, 0x9F, 0xA4,
+    0x9F, 0x94, 0xAF, 0x5F, 0xC5, 0xFA, 0x5F, 0x94, 0x9F, 0x59, 0xF5, 0xAE, 0xA6, 0x99, 0x97, 0x77,
+    0x39, 0xEA, 0x5F, 0xC4, 0xAF, 0xC4, 0xAF, 0xC5, 0xF9, 0x69, 0x96, 0x09, 0xEA, 0x1F, 0x90, 0xAE,
+    0xA1, 0xF1, 0xF9, 0x09, 0xF1, 0xF1, 0x9E, 0xA1, 0xEA, 0x1A, 0xE9, 0x09, 0xE9, 0x1A, 0xE1, 0x9E,
+    0x2E, 0xA1, 0xAE, 0x2E, 0x91, 0xAD, 0x92, 0xE2, 0x70, 0xAD, 0xA2, 0xAD, 0x97, 0x2E, 0xA2, 0xE9,
+    0x72, 0xE9, 0x19, 0xE7, 0x2A, 0xE2, 0xAE, 0x72, 0xEA, 0x2E, 0x97, 0x2E, 0x91, 0x9E, 0x72, 0x9E,
+    0x91, 0xAE, 0x59, 0xFF, 0xFF, 0xDA, 0x19, 0xFF, 0xFF, 0xDA, 0x19, 0xFF, 0xFF, 0xD9, 0x5A, 0xE9,
+    0x1F, 0x72, 0xEA, 0x2E, 0x97, 0x2E, 0x91, 0x9E, 0x72, 0x9E, 0x2A, 0xE6, 0xFF, 0xFF, 0xE2, 0xFF,
+    0xFF, 0xE1, 0x9F, 0xFF, 0xFD, 0xA2, 0x99, 0x9A, 0xE9, 0x99, 0xF9, 0x99, 0x96, 0xF2, 0xE9, 0x72,
+    0xE9, 0x19, 0xE7, 0x29, 0xE2, 0xAE, 0x72, 0xAE, 0x2E, 0xA7, 0x2E, 0xA2, 0xE9, 0x72, 0xE9, 0x1A,
+    0xE7, 0x00, 0x73, 0x99, 0x77, 0x9D, 0x77, 0xAC, 0xA7, 0x49, 0xAF, 0xA9, 0x70, 0xAF, 0xFE, 0x5F,
+    0xFF, 0xC4, 0xFF, 0xFC, 0x93, 0x9F, 0xC9, 0xDA, 0x9A, 0xD4, 0xAF, 0x90, 0xD9, 0x70, 0xAF, 0x1D,
+    0x71, 0xAF, 0xA9, 0xD7, 0x19, 0xFE, 0xA7, 0x2F, 0xFA, 0x72, 0xFF, 0xC9, 0x71, 0xAF, 0xFA, 0x72,
+    0xAF, 0xE9, 0x71, 0xAF, 0xEA, 0x71, 0xD9, 0x9F, 0xC7, 0x1D, 0x1F, 0xC2, 0xA9, 0x39, 0xD0, 0x9F,
+    0xA2, 0xEA, 0x90, 0xAD, 0x9F, 0xC9, 0x2F, 0xFF, 0xE3, 0xFF, 0xFD, 0x4A, 0xFF, 0xEA, 0x70, 0x9A,
+    0xEA, 0xA9, 0x74, 0xAC, 0xA7, 0x7D, 0x97, 0x7D, 0x72, 0x77, 0x77, 0xAF, 0x97, 0x0A, 0xDA, 0x59,
+    0xFE, 0x96, 0x9E, 0x95, 0xFF, 0xC5, 0x9E, 0xA5, 0xFC, 0x9F, 0x5F, 0x6F, 0x1A, 0xE9, 0x3A, 0xE6,
+    0xAE, 0xA1, 0xAE, 0x92, 0x9E, 0x96, 0xF9, 0x1F, 0x92, 0xEA, 0x7F, 0x2F, 0x2F, 0x70, 0xF2, 0xF1,
+    0xAE, 0x71, 0xF1, 0x9E, 0xA0, 0x9E, 0x91, 0xAA, 0xA9, 0x3F, 0x1F, 0x90, 0xEA, 0x0A, 0xFD, 0x2F,
+    0xAF, 0xC0, 0xF0, 0xFF, 0xA1, 0xAF, 0xF0, 0xAE, 0x0A, 0xFF, 0xC2, 0xFE, 0x09, 0xE9, 0x0F, 0x90,
+    0xF9, 0x29, 0xAC, 0xA9, 0x1E, 0xA0, 0x9E, 0xA1, 0xAE, 0x97, 0x0F, 0x1A, 0xE9, 0x1A, 0xE9, 0x7A,
+    0xE2, 0xF2, 0xF7, 0x9E, 0x92, 0xF2, 0xF7, 0xEA, 0x3F, 0x19, 0xF6, 0xF4, 0xF1, 0xAE, 0x95, 0xAE,
+    0x94, 0xF0, 0x9F, 0x59, 0xEA, 0x5F, 0xFC, 0x95, 0xF6, 0x9F, 0xEA, 0x5F, 0x70, 0x9F, 0xC9, 0x77,
+    0x69, 0x60, 0x77, 0x76, 0xAF, 0xCA, 0x75, 0x9F, 0xFC, 0x97, 0x3F, 0xFE, 0x72, 0xFD, 0xAF, 0xC9,
+    0x71, 0xFA, 0x2F, 0xA7, 0x09, 0xF3, 0xFA, 0x70, 0x9F, 0x29, 0xF9, 0x70, 0x9F, 0x2F, 0xC7, 0x2F,
+    0xA9, 0xFC, 0x97, 0x2F, 0xFD, 0x97, 0x39, 0xFF, 0x97, 0x39, 0xFE, 0x93, 0xAF, 0x3F, 0xFC, 0x4F,
+    0xA2, 0xFF, 0xE2, 0xAF, 0x2F, 0xD0, 0xFC, 0xA1, 0xFA, 0x19, 0xFC, 0x2F, 0xC9, 0xFC, 0x2A, 0xF9,
+    0x29, 0xFF, 0xC9, 0x2F, 0xC9, 0x3A, 0xFF, 0x3F, 0xC9, 0x4F, 0xE4, 0xFD, 0x39, 0xFD, 0x94, 0xAF,
+    0xFF, 0xFC, 0x5F, 0xFF, 0xFD, 0x49, 0xFF, 0xEA, 0xFC, 0x95, 0xAF, 0xEA, 0x1A, 0xFC, 0x70, 0x99,
+    0x97, 0x50, 0x09, 0xEA, 0x0A, 0xEA, 0x0F, 0x90, 0xF1, 0xEA, 0x09, 0xE9, 0x09, 0xE1, 0xAE, 0x1A,
+    0xD9, 0x10, 0x7A, 0xE9, 0x6F, 0xA6, 0xAE, 0xA6, 0x9F, 0x7F, 0x96, 0xFA, 0x69, 0xF7, 0xFA, 0x69,
+    0xF7, 0xFA, 0x69, 0xF7, 0xAF, 0x7F, 0xA7, 0xF9, 0x69, 0xF7, 0xAF, 0x7A, 0xEA, 0x7A, 0xEA, 0x7F,
+    0xA7, 0xFA, 0x7F, 0xA7, 0xAE, 0xA7, 0xAE, 0xA7, 0x9F, 0x70, 0xF7, 0x0F, 0x70, 0xAE, 0x97, 0x0F,
+    0x70, 0xF7, 0x19, 0x99, 0x60, 0x77, 0x4F, 0x71, 0x9E, 0xA7, 0x1F, 0x71, 0xF7, 0x1F, 0x97, 0x0A,
+    0xEA, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F, 0x71, 0xF7, 0x1F, 0x70, 0x9F, 0x70, 0x9F, 0x70, 0x9F,
+    0x70, 0xAF, 0x70, 0xFA, 0x70, 0xF9, 0x79, 0xF7, 0x0A, 0xF7, 0x0F, 0x97, 0x9F, 0x70, 0xFA, 0x79,
+    0xF7, 0x0F, 0x97, 0xAF, 0x79, 0xF7, 0x0F, 0x97, 0xFA, 0x7A, 0xEA, 0x70, 0x99, 0x99, 0x70, 0x79,
+    0x97, 0x6F, 0x97, 0x3F, 0x74, 0xEA, 0x6C, 0xA3, 0xE9, 0x59, 0xEA, 0x1E, 0x6F, 0xFC, 0xA3, 0x99,
+    0x0A, 0xFF, 0xFE, 0x39, 0xFF, 0xEA, 0x49, 0xFF, 0xDA, 0x3A, 0xFD, 0x90, 0x99, 0xA9, 0x2A, 0xFA,
+    0xE6, 0xAF, 0x09, 0xE6, 0xAE, 0xA1, 0xEA, 0x69, 0xD2, 0xF7, 0x93, 0xAE, 0x97, 0x49, 0x50, 0x6E,
+    0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA6, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA,
+    0xAA, 0xA0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x6E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E,
+    0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x49, 0x99, 0x60, 0x2A, 0xF9, 0x2F, 0xC2, 0x9F, 0x92, 0xAF, 0x3F,
+    0x92, 0x9F, 0x3F, 0x39, 0xEA, 0x49, 0x99, 0x40, 0x0A, 0xFF, 0x0F, 0xFA, 0x0F, 0xF9, 0x9F, 0xF9,
+    0x71, 0x79, 0xE9, 0x09, 0xFC, 0x0A, 0xFC, 0x0A, 0xFC, 0x09, 0xF9, 0x29, 0x92, 0x74, 0x9F, 0x97,
+    0x4F, 0xA7, 0x49, 0xF7, 0x5F, 0xA7, 0x4A, 0xF7, 0x5F, 0xA7, 0x4A, 0xF7, 0x5F, 0x97, 0x4A, 0xF7,
+    0x49, 0xF9, 0x74, 0xFA, 0x74, 0x9F, 0x75, 0xFA, 0x74, 0xAF, 0x75, 0xF9, 0x74, 0xAF, 0x75, 0xF9,
+    0x74, 0xFC, 0x74, 0x9F, 0x97, 0x4F, 0xA7, 0x49, 0xF7, 0x5F, 0xA7, 0x4A, 0xF7, 0x5F, 0x97, 0x77,
+    0x70, 0x77, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xFC, 0x69, 0xFF, 0xE4, 0x9F, 0xFF, 0x93, 0xFC, 0xA1,
+    0xAF, 0xA2, 0xAF, 0xC3, 0xFC, 0x2F, 0xC4, 0xFC, 0x19, 0xFA, 0x4F, 0xC1, 0xFC, 0x94, 0xFC, 0x1F,
+    0xC5, 0xFC, 0x09, 0xFC, 0x5F, 0xC0, 0xAF, 0xA5, 0xFC, 0x0A, 0xF9, 0x49, 0xFA, 0x0F, 0xC5, 0xAF,
+    0xA0, 0xFC, 0x5F, 0xC9, 0x0F, 0xC5, 0xFC, 0x1F, 0xC4, 0x9F, 0xA1, 0xFC, 0x4F, 0xC9, 0x1F, 0xC3,
+    0x9F, 0xC2, 0xAF, 0xA1, 0x9F, 0xC9, 0x29, 0xFF, 0xFA, 0x4F, 0xFF, 0x6F, 0xFD, 0x70, 0xAF, 0xD9,
+    0x73, 0x99, 0x97, 0x10, 0x70, 0x9F, 0x70, 0xFD, 0x6A, 0xFE, 0x49, 0xFF, 0xA3, 0xAF, 0xFC, 0x91,
+    0x9F, 0xFE, 0x2A, 0xFC, 0xAF, 0xC3, 0xF1, 0xFA, 0x39, 0xCA, 0x19, 0xF9, 0x70, 0xAF, 0x97, 0x0F,
+    0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x70, 0x9F, 0x97, 0x0A, 0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA,
+    0x70, 0xAF, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x1F, 0xA7, 0x09, 0xFA, 0x70, 0xAF, 0x94, 0x77, 0x72,
+    0xAF, 0xDA, 0x70, 0xAF, 0xFD, 0x6F, 0xFF, 0xC4, 0xFF, 0xFD, 0x94, 0xF9, 0x19, 0xFC, 0xA4, 0x9C,
+    0xA4, 0x9F, 0xC5, 0x96, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73,
+    0xFC, 0xA7, 0x3F, 0xCA, 0x73, 0xFC, 0xA7, 0x29, 0xFC, 0xA7, 0x29, 0xFC, 0x97, 0x2A, 0xFC, 0x97,
+    0x2A, 0xFC, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x72, 0xFF, 0xFE, 0xA1, 0x9F, 0xFF, 0xE9, 0x19, 0xFF,
+    0xFE, 0x2A, 0xFF, 0xFE, 0x20, 0x77, 0x79, 0xAF, 0xDA, 0x69, 0xFF, 0xE9, 0x4F, 0xFF, 0xC4, 0xAF,
+    0xFF, 0xA4, 0xDA, 0x3F, 0xD4, 0x96, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3F, 0xC7, 0x2A, 0xFC,
+    0x96, 0xFF, 0xC9, 0x69, 0xFD, 0xA9, 0x70, 0xAF, 0xF7, 0x09, 0xAA, 0xAF, 0xD9, 0x73, 0x9F, 0xC7,
+    0x4A, 0xF9, 0x73, 0x9F, 0x97, 0x3A, 0xF9, 0x73, 0xFC, 0x90, 0xCA, 0x95, 0x9F, 0xD1, 0xFC, 0xAA,
+    0xFF, 0x91, 0xFF, 0xFD, 0xA2, 0xFF, 0xFC, 0x94, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x71, 0x74, 0x9F,
+    0xA7, 0x4F, 0xCA, 0x73, 0xFD, 0x97, 0x2F, 0xE9, 0x71, 0xAF, 0xE7, 0x1A, 0xFF, 0x70, 0x9F, 0xFA,
+    0x70, 0xF9, 0xF9, 0x7F, 0xA9, 0xF7, 0xFA, 0x0A, 0xF6, 0xAF, 0x1F, 0xC5, 0xAF, 0x2F, 0xA4, 0x9F,
+    0x29, 0xF9, 0x4F, 0x92, 0xAF, 0x4F, 0xA3, 0xFC, 0x3A, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0xC9, 0x0F,
+    0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xC7, 0x2F, 0xC7, 0x5F, 0xA7, 0x49, 0xF9, 0x74, 0xAF, 0x97, 0x4A,
+    0xF4, 0x5F, 0xFF, 0x59, 0xFF, 0xF5, 0xAF, 0xFF, 0x5F, 0xFF, 0xA5, 0xFA, 0x99, 0x99, 0x99, 0x95,
+    0x9F, 0x75, 0xAF, 0x75, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xFF, 0xA7, 0x0F, 0xFE, 0xA6, 0xFF, 0xFA,
+    0x5A, 0xFF, 0xF6, 0x94, 0xAF, 0xC9, 0x74, 0xFC, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC9,
+    0x73, 0x9F, 0xC2, 0xAC, 0x95, 0xAF, 0xCA, 0x2A, 0xFF, 0xFD, 0x3A, 0xFF, 0xFC, 0x93, 0xAF, 0xFF,
+    0x95, 0x9F, 0xFC, 0x97, 0x39, 0x99, 0x72, 0x77, 0x72, 0x9F, 0xEA, 0x6A, 0xFF, 0xCA, 0x5F, 0xFE,
+    0x94, 0xFF, 0xF4, 0xFD, 0xA7, 0x1A, 0xFC, 0x73, 0xFC, 0x73, 0xAF, 0x74, 0xFA, 0x19, 0x99, 0x69,
+    0xF0, 0x9F, 0xD4, 0xAF, 0xAF, 0xF3, 0xFF, 0xFD, 0xA2, 0xFE, 0x99, 0xFD, 0x19, 0xFC, 0xA3, 0xFC,
+    0x19, 0xFC, 0x4F, 0xC1, 0xAF, 0x94, 0xFC, 0x1A, 0xF9, 0x4F, 0xC1, 0xAF, 0x94, 0xFC, 0x19, 0xF9,
+    0x3A, 0xF9, 0x2F, 0xC2, 0x9F, 0xC3, 0xFD, 0xAF, 0xDA, 0x39, 0xFF, 0xF5, 0xAF, 0xFC, 0xA7, 0x9F,
+    0xE9, 0x73, 0x99, 0x97, 0x00, 0x2F, 0xFF, 0xEA, 0x19, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xE9, 0x1F,
+    0xFF, 0xF2, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFC, 0x97, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA,
+    0x74, 0xFC, 0x74, 0xFC, 0x97, 0x39, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFA, 0x73, 0x9F, 0xC7, 0x4F,
+    0xCA, 0x73, 0xAF, 0xC7, 0x4F, 0xC9, 0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFC, 0xA7, 0x3A, 0xFC,
+    0x74, 0xFC, 0x97, 0x3F, 0xD7, 0x39, 0xFC, 0x74, 0x77, 0x71, 0x9A, 0xFD, 0x97, 0x0A, 0xFF, 0xCA,
+    0x6A, 0xFF, 0xEA, 0x49, 0xFC, 0xAA, 0xFD, 0x4F, 0xC3, 0xFC, 0x93, 0xFA, 0x39, 0xF9, 0x3F, 0xA3,
+    0x9F, 0x4F, 0xC3, 0xFC, 0x4A, 0xF9, 0x1A, 0xF9, 0x5F, 0xCA, 0xFC, 0xA6, 0x9F, 0xFC, 0x97, 0x0F,
+    0xEA, 0x70, 0xAF, 0xFC, 0x96, 0xFD, 0xAF, 0xC9, 0x4F, 0xCA, 0x19, 0xFC, 0x3A, 0xFA, 0x3A, 0xFA,
+    0x2F, 0xC5, 0xFA, 0x2F, 0xC5, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC9, 0x3A, 0xF9, 0x2A, 0xFC, 0xA9,
+    0x9F, 0xD4, 0xFF, 0xFC, 0x94, 0x9F, 0xFE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x00, 0x77, 0x6A,
+    0xFD, 0x96, 0x9F, 0xFC, 0xA4, 0xAF, 0xFE, 0xA2, 0x9F, 0xFF, 0xC2, 0xFC, 0xA2, 0xFC, 0x90, 0x9F,
+    0xC3, 0x9F, 0xA0, 0xAF, 0x94, 0xFA, 0x0F, 0xC5, 0xFC, 0x0F, 0xC4, 0x9F, 0xA0, 0xFC, 0x4A, 0xFA,
+    0x0F, 0xC3, 0x9F, 0xCA, 0x0A, 0xFC, 0x99, 0xAF, 0xD9, 0x09, 0xFF, 0xFD, 0x91, 0xFF, 0xCA, 0xF3,
+    0xFE, 0x0F, 0xC4, 0x9A, 0xAA, 0x90, 0x9F, 0x97, 0x2F, 0xC7, 0x29, 0xFA, 0x72, 0xFC, 0x71, 0xAF,
+    0xCA, 0x2A, 0xDA, 0xAF, 0xF3, 0xAF, 0xFE, 0x4A, 0xFF, 0xCA, 0x5A, 0xFE, 0xA7, 0x29, 0x99, 0x72,
+    0x49, 0xA9, 0x5F, 0xC3, 0xAF, 0xC3, 0xAF, 0xC3, 0xAF, 0xA4, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x29, 0xE9, 0x39, 0xFC, 0x3A, 0xFC, 0x3A, 0xFC, 0x39, 0xF9, 0x59, 0x95, 0x69, 0xA9, 0x7F, 0xC5,
+    0xAF, 0xC5, 0xAF, 0xC5, 0xAF, 0xA6, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xF6,
+    0xFA, 0x59, 0xF9, 0x5F, 0xA5, 0x9F, 0x6A, 0xEA, 0x6F, 0x69, 0xE9, 0x79, 0x99, 0x70, 0x77, 0xA7,
+    0x5A, 0xD7, 0x3A, 0xF7, 0x1A, 0xFD, 0x7A, 0xFD, 0xA9, 0x5A, 0xFD, 0xA6, 0xAF, 0xDA, 0x6A, 0xFD,
+    0xA7, 0xFD, 0x97, 0x1F, 0xC9, 0x72, 0xFE, 0xA9, 0x70, 0x9F, 0xF9, 0x71, 0xAF, 0xEA, 0x71, 0xAF,
+    0xF9, 0x70, 0x9F, 0xE7, 0x29, 0xAF, 0x75, 0xAD, 0x77, 0x90, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x77, 0x77, 0x29, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x77, 0x00, 0x09, 0x77,
+    0xD9, 0x75, 0xF9, 0x73, 0xFD, 0x97, 0x19, 0xFE, 0x97, 0x19, 0xFE, 0x97, 0x19, 0xAF, 0xD9, 0x72,
+    0xAF, 0xD9, 0x72, 0xAF, 0xD7, 0x2A, 0xFC, 0x79, 0xFE, 0xA5, 0xAF, 0xEA, 0x49, 0xAF, 0xEA, 0x4A,
+    0xFF, 0x96, 0xFD, 0xA9, 0x70, 0xFA, 0x73, 0xD9, 0x75, 0x97, 0x60, 0x77, 0x19, 0xAF, 0xD9, 0x39,
+    0xFF, 0xE2, 0xFF, 0xFA, 0x19, 0xFF, 0xF2, 0xDA, 0x3F, 0xC9, 0x19, 0x59, 0xF9, 0x70, 0xAF, 0x97,
+    0x0F, 0xC7, 0x9F, 0xC9, 0x6A, 0xFC, 0xA6, 0xFD, 0xA6, 0xFD, 0x96, 0xAF, 0xC7, 0x0F, 0xA7, 0x09,
+    0xF7, 0x1A, 0xEA, 0x77, 0x77, 0x77, 0x59, 0xEA, 0x71, 0xFC, 0x70, 0x9F, 0xC9, 0x79, 0xFC, 0x71,
+    0xF9, 0x72, 0x99, 0x72, 0x73, 0x9A, 0xAD, 0xAA, 0x97, 0x70, 0x9F, 0xFF, 0x97, 0x39, 0xFF, 0xFE,
+    0xA7, 0x1F, 0xDA, 0x99, 0x99, 0x9A, 0xFD, 0x7F, 0xC9, 0x70, 0x9F, 0xA5, 0xFA, 0x74, 0xF4, 0xAE,
+    0xA5, 0x99, 0x99, 0x39, 0xEA, 0x29, 0xEA, 0x39, 0xFF, 0x91, 0xF2, 0xF3, 0xFF, 0xD9, 0x1A, 0xE1,
+    0x9E, 0x92, 0xFC, 0xAA, 0xF2, 0x9E, 0x1A, 0xE2, 0xAE, 0xA2, 0xAE, 0x29, 0xE1, 0xEA, 0x2F, 0x3E,
+    0xA2, 0x9E, 0x1E, 0x91, 0xAE, 0x93, 0xE9, 0x2A, 0xE0, 0x9E, 0x91, 0xF3, 0x9E, 0x3F, 0x09, 0xE2,
+    0xEA, 0x3F, 0x3E, 0xA0, 0x9E, 0x2E, 0xA3, 0xEA, 0x2A, 0xE1, 0x9E, 0x2E, 0xA2, 0xFA, 0x19, 0xEA,
+    0x19, 0xE9, 0x1F, 0xA9, 0xAF, 0xC9, 0xAF, 0x3E, 0xA1, 0xAF, 0xEA, 0xFF, 0x93, 0xF2, 0xAF, 0xC9,
+    0x0F, 0xE5, 0xAE, 0x92, 0x9A, 0xAA, 0x39, 0xAA, 0xA9, 0x7F, 0x77, 0x7A, 0xF9, 0x77, 0x6F, 0xD9,
+    0x49, 0xAD, 0xA7, 0x3A, 0xFF, 0xFD, 0xA7, 0x49, 0xFF, 0xFC, 0x97, 0x69, 0xAF, 0xDA, 0xA9, 0x77,
+    0x77, 0x50, 0x73, 0xAF, 0xC9, 0x75, 0xFD, 0xA7, 0x4A, 0xFE, 0x73, 0x9F, 0xF7, 0x3F, 0xAF, 0x72,
+    0x9F, 0x9F, 0x72, 0xFA, 0x0F, 0x71, 0x9F, 0x90, 0xF9, 0x70, 0xFC, 0x1F, 0x97, 0x9F, 0x91, 0xF9,
+    0x7F, 0xC2, 0xFA, 0x69, 0xF9, 0x2A, 0xEA, 0x6F, 0xC3, 0xAF, 0x59, 0xF9, 0x3A, 0xF5, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0xAF, 0xFF, 0xF9, 0x2F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x91,
+    0xAF, 0x97, 0xF9, 0x1F, 0xC7, 0x0F, 0xA0, 0xAF, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0xAF, 0x97,
+    0x1F, 0xC0, 0x5F, 0xFA, 0xA9, 0x70, 0x9F, 0xFF, 0x96, 0xAF, 0xFF, 0xC9, 0x5F, 0xFF, 0xE5, 0xFC,
+    0x99, 0x99, 0xFD, 0x94, 0xFC, 0x4F, 0xC9, 0x39, 0xFA, 0x4F, 0xC9, 0x3A, 0xF9, 0x4F, 0xC4, 0xFC,
+    0x49, 0xFA, 0x4F, 0xC9, 0x99, 0x9A, 0xFC, 0x49, 0xFF, 0xFC, 0xA5, 0x9F, 0xFE, 0xA7, 0xAF, 0xFF,
+    0xA6, 0xFC, 0xAA, 0xAA, 0xFD, 0x5F, 0xC4, 0xFC, 0x93, 0x9F, 0xA4, 0x9F, 0xA3, 0xAF, 0x94, 0x9F,
+    0xA3, 0xFC, 0x59, 0xFA, 0x3F, 0xC5, 0xFC, 0x93, 0xFC, 0x39, 0xFD, 0x39, 0xFF, 0xFE, 0xA3, 0xAF,
+    0xFF, 0xDA, 0x4F, 0xFF, 0xD9, 0x5F, 0xFE, 0xA9, 0x60, 0x77, 0x75, 0x9F, 0xEA, 0x97, 0x09, 0xFF,
+    0xF9, 0x5F, 0xFF, 0xD9, 0x4F, 0xFF, 0xE4, 0xAF, 0xDA, 0x29, 0xAD, 0x93, 0x9F, 0xCA, 0x79, 0x4F,
+    0xD7, 0x59, 0xFC, 0x76, 0xFC, 0xA7, 0x6F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC9, 0x76,
+    0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x97, 0x6F, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xD9, 0x39,
+    0xAC, 0x95, 0xFF, 0xFD, 0x96, 0xFF, 0xFC, 0x97, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x97, 0x49, 0x99,
+    0x71, 0x5F, 0xEA, 0xA9, 0x72, 0x9F, 0xFE, 0xA7, 0x0A, 0xFF, 0xFC, 0x7F, 0xFF, 0xE6, 0xFC, 0x99,
+    0x9A, 0xFD, 0xA5, 0xFC, 0x4F, 0xD4, 0x9F, 0xA5, 0xFC, 0x4A, 0xF9, 0x5F, 0xC9, 0x3F, 0xC6, 0xAF,
+    0x93, 0xFC, 0x6A, 0xFA, 0x29, 0xFC, 0x6A, 0xFA, 0x29, 0xFA, 0x6A, 0xF9, 0x2A, 0xF9, 0x6F, 0xC9,
+    0x2F, 0xC7, 0xFC, 0x3F, 0xC6, 0x9F, 0xC2, 0x9F, 0xA6, 0xFC, 0xA2, 0xAF, 0x95, 0x9F, 0xC3, 0xFC,
+    0x94, 0x9F, 0xCA, 0x3F, 0xC4, 0x9F, 0xD4, 0xFC, 0x19, 0x9F, 0xE9, 0x39, 0xFF, 0xFE, 0x94, 0xAF,
+    0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x7F, 0xFD, 0xA9, 0x70, 0x5F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF,
+    0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF,
+    0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF,
+    0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97,
+    0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9,
+    0x40, 0x5F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0x95, 0xFC, 0x99, 0x99,
+    0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFC, 0xAA,
+    0xAA, 0xAA, 0xA6, 0x9F, 0xFF, 0x6A, 0xFF, 0xF6, 0xFF, 0xFC, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0x95,
+    0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75,
+    0xFC, 0x76, 0xFC, 0x75, 0x77, 0x76, 0x9A, 0xFE, 0xA9, 0x70, 0x9F, 0xFF, 0xC9, 0x5A, 0xFF, 0xFD,
+    0x5A, 0xFF, 0xFD, 0xA4, 0xAF, 0xDA, 0x92, 0x9A, 0xD4, 0x9F, 0xD9, 0x79, 0x4F, 0xD7, 0x69, 0xFC,
+    0x97, 0x6F, 0xCA, 0x77, 0xFC, 0x77, 0x9F, 0xC4, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFA, 0x3F, 0xFC,
+    0x91, 0xFC, 0x93, 0xFF, 0xC2, 0xFC, 0x4F, 0xFC, 0x2F, 0xC3, 0x9A, 0xAA, 0xFC, 0xA2, 0xFC, 0x7A,
+    0xF9, 0x2F, 0xC9, 0x6F, 0xC3, 0xFC, 0xA6, 0xFC, 0x3A, 0xFC, 0x6F, 0xC4, 0xFD, 0x93, 0xAF, 0xA4,
+    0xAF, 0xFF, 0xE9, 0x5F, 0xFF, 0xE7, 0xFF, 0xFD, 0x70, 0x9F, 0xFC, 0xA9, 0x75, 0x99, 0x97, 0x10,
+    0x5F, 0xA6, 0x9F, 0x94, 0x9F, 0xA6, 0xFC, 0x5A, 0xF9, 0x6F, 0xC5, 0xFC, 0x96, 0xFC, 0x5F, 0xC6,
+    0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5,
+    0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x49, 0xFF, 0xFF, 0xC9, 0x49, 0xFF, 0xFF, 0xC5, 0xAF, 0xFF,
+    0xFC, 0x5F, 0xFF, 0xFC, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC9, 0x4A, 0xF9, 0x6F, 0xC5,
+    0xFC, 0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96,
+    0xFC, 0x5F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F, 0xA4, 0x4F, 0xFD, 0x94, 0xFF, 0xD9, 0x39, 0xFF, 0xD5,
+    0xAF, 0xEA, 0x97, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x72, 0xFC, 0x71,
+    0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71,
+    0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x0A, 0xFD, 0xA5, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xDA,
+    0x40, 0x73, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC,
+    0x73, 0x9F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF,
+    0xA7, 0x3F, 0xC9, 0x73, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC,
+    0x73, 0x9F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x3A, 0xFC, 0x69, 0x90, 0x9A, 0xFC,
+    0x96, 0xFF, 0xD6, 0x9F, 0xFC, 0x79, 0xFF, 0x97, 0x0F, 0xCA, 0x97, 0x77, 0x30, 0x5F, 0xA5, 0xAF,
+    0xC5, 0x9F, 0xA4, 0x9F, 0xC9, 0x5A, 0xF9, 0x39, 0xFC, 0xA6, 0xFC, 0x4F, 0xCA, 0x7F, 0xC3, 0xFD,
+    0x70, 0xFA, 0x2F, 0xD7, 0x09, 0xF9, 0x1A, 0xFC, 0x71, 0xAF, 0x90, 0x9F, 0xC9, 0x71, 0xFC, 0x09,
+    0xFC, 0x97, 0x2F, 0xC0, 0xFC, 0xA7, 0x29, 0xFA, 0xAF, 0xA7, 0x39, 0xFF, 0xD7, 0x4A, 0xFF, 0xD7,
+    0x4F, 0xFE, 0xA7, 0x3F, 0xDA, 0xFC, 0x72, 0x9F, 0xA1, 0xFC, 0x97, 0x1A, 0xF9, 0x1A, 0xFA, 0x71,
+    0xFC, 0x29, 0xFC, 0x71, 0xFC, 0x3F, 0xC9, 0x70, 0xFC, 0x3A, 0xFC, 0x79, 0xFA, 0x4F, 0xC7, 0xAF,
+    0x94, 0xFC, 0xA6, 0xFC, 0x59, 0xFC, 0x6F, 0xC6, 0xFC, 0x94, 0x5F, 0xA7, 0x19, 0xFA, 0x71, 0xAF,
+    0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7,
+    0x19, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9,
+    0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xFF, 0xC1, 0xAF, 0xFF, 0xA1, 0xFF, 0xFC, 0x91,
+    0xFF, 0xFC, 0x90, 0x5F, 0xD9, 0x70, 0x9F, 0xD9, 0x49, 0xFD, 0xA7, 0x0F, 0xE5, 0xAF, 0xDA, 0x7A,
+    0xFE, 0x5F, 0xEA, 0x7F, 0xF5, 0xFE, 0xA6, 0xAF, 0xEA, 0x5F, 0xF6, 0xFF, 0x94, 0x9F, 0xF5, 0xAE,
+    0xAF, 0x5A, 0xEA, 0xF5, 0xFA, 0xF5, 0xF9, 0xF4, 0xAE, 0x9A, 0xEA, 0x5F, 0x9A, 0xE4, 0xF0, 0xFA,
+    0x49, 0xF0, 0xAE, 0x3A, 0xE9, 0x0F, 0x94, 0x9F, 0x0A, 0xE3, 0xF0, 0x9F, 0x5A, 0xF0, 0xAE, 0x2A,
+    0xE9, 0x0A, 0xF5, 0xFA, 0x0A, 0xE9, 0x1F, 0x1F, 0xA5, 0xF9, 0x09, 0xE9, 0x0A, 0xE9, 0x1F, 0x94,
+    0x9F, 0x19, 0xE9, 0x0F, 0x19, 0xF9, 0x4A, 0xF1, 0x9E, 0x9A, 0xE9, 0x1A, 0xF5, 0xFA, 0x19, 0xEA,
+    0xF2, 0xAF, 0x5F, 0x92, 0xFE, 0x92, 0xFA, 0x5F, 0x92, 0xFE, 0x3F, 0x94, 0x9F, 0x3F, 0xD9, 0x29,
+    0xF5, 0xAF, 0x3F, 0xD3, 0xAF, 0x5F, 0xA3, 0xFC, 0x93, 0xFC, 0x5F, 0x93, 0xFC, 0x4F, 0xA4, 0x5F,
+    0xCA, 0x70, 0xF9, 0x49, 0xFD, 0x79, 0xF5, 0xAF, 0xD9, 0x6A, 0xF5, 0xFE, 0xA6, 0xFA, 0x5F, 0xF6,
+    0xFA, 0x49, 0xFF, 0x94, 0x9F, 0x94, 0x9F, 0xFA, 0x49, 0xF5, 0xAE, 0xAA, 0xF4, 0xAF, 0x5F, 0x99,
+    0xF9, 0x3F, 0xA5, 0xF9, 0x0F, 0xA3, 0xF9, 0x49, 0xF1, 0xAF, 0x29, 0xF5, 0xAF, 0x19, 0xF9, 0x1A,
+    0xF5, 0xAF, 0x2F, 0xA1, 0xFC, 0x5F, 0xA2, 0xAF, 0x1F, 0xA5, 0xF9, 0x29, 0xF9, 0x0F, 0x94, 0x9F,
+    0x4F, 0xA9, 0xF5, 0xAF, 0x4F, 0xC9, 0xF5, 0xFC, 0x49, 0xFF, 0xC5, 0xFA, 0x5F, 0xFA, 0x5F, 0x95,
+    0xFF, 0x94, 0x9F, 0x69, 0xFE, 0x5A, 0xF7, 0xFE, 0x5F, 0xA7, 0xFD, 0xA5, 0xFA, 0x7A, 0xFC, 0x94,
+    0x77, 0x77, 0x9F, 0xE9, 0x73, 0xAF, 0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F,
+    0xD9, 0x39, 0xFC, 0xA5, 0xFD, 0x3F, 0xCA, 0x69, 0xFC, 0x2A, 0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x70,
+    0xFC, 0x91, 0xFC, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x1F, 0xC9, 0x0A, 0xFA, 0x71, 0xFC, 0x1F, 0xC9,
+    0x71, 0xFC, 0x1F, 0xC7, 0x19, 0xFC, 0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7, 0x1F, 0xC9, 0x1F, 0xC9,
+    0x7A, 0xFC, 0x2F, 0xCA, 0x7F, 0xCA, 0x2A, 0xFC, 0x6F, 0xD4, 0xFD, 0x92, 0x9F, 0xD9, 0x4A, 0xFF,
+    0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x0F, 0xFF, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x73, 0x5F, 0xFA,
+    0x97, 0x19, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC, 0x6F, 0xFF, 0xDA, 0x5F, 0xC9, 0x99, 0x9F, 0xD5, 0xFC,
+    0x4F, 0xC9, 0x39, 0xFA, 0x4A, 0xF9, 0x3A, 0xF9, 0x4A, 0xF9, 0x3F, 0xC5, 0xAF, 0x93, 0xFC, 0x5F,
+    0xC3, 0x9F, 0xA3, 0x9F, 0xD3, 0x9F, 0xCA, 0xAA, 0xFE, 0x93, 0xAF, 0xFF, 0xDA, 0x4F, 0xFF, 0xD9,
+    0x5F, 0xFF, 0xA6, 0x9F, 0xCA, 0xAA, 0x99, 0x71, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x60, 0x77, 0x77, 0x9F, 0xE9, 0x73, 0xAF,
+    0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F, 0xD9, 0x39, 0xFC, 0xA5, 0xFD, 0x3F,
+    0xCA, 0x69, 0xFC, 0x29, 0xFC, 0x70, 0xFC, 0x2F, 0xCA, 0x70, 0xFC, 0x91, 0xFC, 0x71, 0xFC, 0x90,
+    0x9F, 0xC7, 0x1F, 0xC9, 0x0A, 0xFA, 0x71, 0xFC, 0x1F, 0xC9, 0x71, 0xFC, 0x1F, 0xC7, 0x19, 0xFC,
+    0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7, 0x1F, 0xC9, 0x1F, 0xC7, 0x0A, 0xFC, 0x2F, 0xC9, 0x69, 0xFC,
+    0x92, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x2A, 0xFD, 0x94, 0xAF, 0xFF, 0xE9, 0x6F, 0xFF, 0xD9, 0x70,
+    0xFF, 0xF7, 0x39, 0xFF, 0xC7, 0x79, 0x9F, 0xCA, 0x77, 0x1F, 0xC9, 0x77, 0x0A, 0xFC, 0x77, 0x1F,
+    0xCA, 0x77, 0x0A, 0xFC, 0x77, 0x1A, 0xAA, 0xAA, 0xA3, 0x5F, 0xEA, 0xA9, 0x70, 0x9F, 0xFE, 0x96,
+    0xAF, 0xFF, 0x95, 0xFF, 0xFD, 0x5F, 0xC1, 0x9A, 0xFC, 0xA4, 0xFC, 0x3A, 0xFA, 0x39, 0xFA, 0x39,
+    0xFC, 0x3A, 0xF9, 0x39, 0xFA, 0x3F, 0xC4, 0xAF, 0xA3, 0xFC, 0x4F, 0xC9, 0x29, 0xFC, 0x29, 0xFD,
+    0x39, 0xFF, 0xFD, 0x4A, 0xFF, 0xFC, 0x5F, 0xFF, 0x96, 0xFF, 0xF6, 0x9F, 0xA1, 0xAF, 0x95, 0xAF,
+    0x91, 0x9F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC3, 0xAF, 0xA4, 0xFC, 0x39, 0xFC, 0x39, 0xFA, 0x4F,
+    0xC9, 0x2A, 0xF9, 0x4A, 0xFC, 0x2F, 0xC6, 0xFC, 0x2F, 0xC6, 0xFC, 0xA0, 0x77, 0x71, 0x9A, 0xFD,
+    0xA7, 0x0A, 0xFF, 0xE5, 0xFF, 0xFA, 0x4A, 0xFF, 0xF5, 0xFC, 0xA2, 0x9A, 0xCA, 0x49, 0xFC, 0x74,
+    0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0x9F, 0xC7, 0x5F, 0xD9, 0x73, 0xAF, 0xDA, 0x73, 0xFF, 0x73, 0xFF,
+    0x73, 0xAF, 0xDA, 0x73, 0x9F, 0xD7, 0x49, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xAF, 0x97, 0x4F, 0xC3,
+    0x9C, 0xA9, 0x4A, 0xFC, 0x39, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xC4, 0x9F, 0xFE, 0xA6, 0x9A, 0xFE,
+    0xA9, 0x73, 0x99, 0x97, 0x20, 0x09, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF,
+    0xF9, 0x19, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA,
+    0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x74, 0xFC,
+    0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA,
+    0x74, 0xAF, 0x97, 0x20, 0x29, 0xFA, 0x6A, 0xF3, 0xAF, 0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC,
+    0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0x92, 0x9F, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC,
+    0x3F, 0xC6, 0x9F, 0xA2, 0x9F, 0xC6, 0xAF, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC,
+    0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0xA2, 0x9F, 0xA6, 0xFC, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59,
+    0xFC, 0x3A, 0xF9, 0x5A, 0xFA, 0x3A, 0xFA, 0x49, 0xFC, 0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF,
+    0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x71, 0x9F, 0xFA, 0x77, 0x99, 0x97, 0x30, 0xFA, 0x70,
+    0xAF, 0x9F, 0xC7, 0x0F, 0xC0, 0xFC, 0x7A, 0xF9, 0x0A, 0xF7, 0xFC, 0x1A, 0xF6, 0xAF, 0x91, 0xAF,
+    0x6F, 0xC2, 0x9F, 0x5A, 0xF9, 0x29, 0xF5, 0xFC, 0x39, 0xF9, 0x3A, 0xF9, 0x4F, 0x93, 0xFC, 0x5F,
+    0x92, 0xAF, 0x95, 0xF9, 0x2F, 0xC6, 0xFA, 0x19, 0xF9, 0x6F, 0xA1, 0xFC, 0x7F, 0xA0, 0x9F, 0x97,
+    0xAE, 0xA0, 0xFC, 0x70, 0xAE, 0xA9, 0xF9, 0x70, 0xAE, 0xAA, 0xF7, 0x19, 0xEA, 0xF9, 0x71, 0x9F,
+    0xF7, 0x3F, 0xE9, 0x73, 0xFE, 0x74, 0xFD, 0x97, 0x4F, 0xD7, 0x30, 0xFA, 0x69, 0xF7, 0xFA, 0xFA,
+    0x6F, 0xC6, 0xAF, 0x9F, 0xA5, 0x9F, 0xC6, 0xFC, 0x0F, 0xA5, 0xFD, 0x59, 0xF9, 0x0F, 0xA5, 0xFD,
+    0x5F, 0xC1, 0xFA, 0x4A, 0xFD, 0x49, 0xFA, 0x1F, 0xA4, 0xFE, 0x93, 0xAF, 0x2F, 0xA3, 0xAF, 0xE9,
+    0x3F, 0xA2, 0xAE, 0xA3, 0xFA, 0xE9, 0x2A, 0xF9, 0x2A, 0xEA, 0x29, 0xEA, 0xAE, 0x92, 0xFC, 0x3A,
+    0xF2, 0xF0, 0xAE, 0x91, 0x9F, 0x93, 0xAF, 0x19, 0xF0, 0xAE, 0x91, 0xFC, 0x4A, 0xF1, 0xF9, 0x0A,
+    0xE9, 0x1F, 0x94, 0xAF, 0x09, 0xF1, 0x9E, 0x90, 0xAF, 0x5A, 0xF0, 0xAE, 0xA1, 0x9E, 0x90, 0xFA,
+    0x5A, 0xEA, 0x0F, 0x29, 0xE9, 0x9F, 0x6A, 0xEA, 0x9E, 0xA2, 0x9E, 0x9F, 0xA6, 0x9E, 0xAF, 0x39,
+    0xE9, 0xF9, 0x69, 0xFE, 0xA3, 0x9F, 0xF7, 0x9F, 0xE9, 0x39, 0xFE, 0x97, 0x9F, 0xE4, 0x9F, 0xE7,
+    0x09, 0xFD, 0x94, 0x9F, 0xD9, 0x70, 0x9F, 0xD5, 0x9F, 0xD7, 0x19, 0xFC, 0x96, 0xFC, 0xA7, 0x10,
+    0x5F, 0xC7, 0xFC, 0xA5, 0xFC, 0x95, 0xAF, 0xC6, 0xAF, 0xA4, 0x9F, 0xC7, 0x9F, 0xC4, 0xFC, 0x97,
+    0x0F, 0xC3, 0xFC, 0xA7, 0x1A, 0xF9, 0x1A, 0xFC, 0x73, 0xFC, 0x09, 0xFC, 0x74, 0xFC, 0x0F, 0xC9,
+    0x74, 0xAF, 0xFC, 0xA7, 0x6F, 0xFC, 0x77, 0xFF, 0x77, 0x0A, 0xFD, 0x97, 0x79, 0xFE, 0x97, 0x7F,
+    0xFA, 0x76, 0xFF, 0xD7, 0x5A, 0xFC, 0xAF, 0x97, 0x39, 0xFC, 0x09, 0xFA, 0x73, 0xFC, 0x91, 0xFC,
+    0x72, 0xFC, 0xA2, 0xFC, 0x97, 0x0A, 0xFC, 0x39, 0xFC, 0x79, 0xFC, 0x94, 0xFC, 0x7F, 0xCA, 0x5F,
+    0xCA, 0x5F, 0xD6, 0xAF, 0xC4, 0xAF, 0xC7, 0x9F, 0xC9, 0x30, 0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF,
+    0xC0, 0x9F, 0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3, 0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49,
+    0xF9, 0x1A, 0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7, 0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71,
+    0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x30, 0x4A, 0xFF,
+    0xFD, 0x94, 0xFF, 0xFE, 0x94, 0xFF, 0xFE, 0x49, 0xFF, 0xFE, 0x59, 0x99, 0x99, 0x99, 0x9F, 0xD7,
+    0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xAF, 0xC7, 0x59, 0xFC, 0x97,
+    0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F,
+    0xD7, 0x5A, 0xFC, 0x75, 0x9F, 0xCA, 0x75, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFE,
+    0x93, 0xFF, 0xFF, 0x40, 0x59, 0xFE, 0x6A, 0xFE, 0x6F, 0xF6, 0xFA, 0xAA, 0x95, 0x9F, 0x71, 0xAE,
+    0xA7, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0x71,
+    0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xAE, 0x97, 0x1F,
+    0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0xA7, 0x1F, 0xEA, 0x6F, 0xE9, 0x59, 0xFE, 0x96,
+    0x99, 0x99, 0x99, 0x96, 0x9F, 0x4F, 0x4F, 0x4F, 0x93, 0xAE, 0x93, 0xAE, 0xA3, 0x9E, 0xA3, 0x9F,
+    0x4F, 0x4F, 0x4F, 0x93, 0xAE, 0xA3, 0x9E, 0xA3, 0x9F, 0x4F, 0x4F, 0x4F, 0x93, 0xAE, 0x93, 0xAE,
+    0xA3, 0x9F, 0x4F, 0x4F, 0x4F, 0x93, 0xF9, 0x70, 0x6F, 0xE9, 0x59, 0xFE, 0x95, 0xAF, 0xE6, 0x9A,
+    0xAF, 0xC7, 0x19, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F,
+    0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x19, 0xEA,
+    0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x6A, 0xFE,
+    0x6F, 0xF6, 0xFE, 0xA6, 0x99, 0x99, 0x99, 0x96, 0x71, 0xAD, 0x75, 0x9E, 0x97, 0x4F, 0xA7, 0x3A,
+    0xFC, 0x72, 0x9F, 0xD9, 0x71, 0xFE, 0xA7, 0x0A, 0xE9, 0xAE, 0x70, 0xEA, 0x09, 0xE7, 0xF2, 0xE9,
+    0x5A, 0xE9, 0x2F, 0x5E, 0xA3, 0x9E, 0x4F, 0x5E, 0x92, 0x9E, 0x95, 0xEA, 0x2F, 0x6A, 0xE1, 0xF7,
+    0x9E, 0x1A, 0xAA, 0x97, 0x0A, 0xAA, 0x00, 0x0A, 0xFF, 0xFA, 0x0F, 0xFF, 0xCA, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x00, 0x0A, 0xAA, 0xAA, 0x2F, 0xC9, 0x2F, 0xA2, 0x9F, 0x39, 0xE9, 0x3A,
+    0xDA, 0x69, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA,
+    0xAF, 0xD9, 0x2F, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA,
+    0x2F, 0xC4, 0x9F, 0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF,
+    0xA3, 0xFC, 0xA2, 0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E,
+    0xA5, 0x9F, 0xC9, 0x0A, 0xEA, 0x70, 0x97, 0x40, 0x59, 0x99, 0x99, 0x75, 0xFA, 0x74, 0x9F, 0x97,
+    0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xF9, 0x19, 0xA9, 0x7A, 0xF0, 0xAF,
+    0xC9, 0x5F, 0xCA, 0xFE, 0x5F, 0xFF, 0xCA, 0x39, 0xFD, 0xA9, 0xFD, 0x3A, 0xFC, 0x3F, 0xC9, 0x2F,
+    0xC9, 0x3A, 0xF9, 0x2F, 0xC4, 0xAF, 0x92, 0xFA, 0x4A, 0xF9, 0x19, 0xF5, 0xFC, 0x2A, 0xF5, 0xFC,
+    0x2F, 0xC4, 0x9F, 0xA2, 0xFC, 0x4A, 0xF9, 0x2F, 0xC3, 0x9F, 0xC2, 0x9F, 0xC9, 0x2F, 0xCA, 0x2A,
+    0xFD, 0xAA, 0xFD, 0x3F, 0xFF, 0xD9, 0x3F, 0x0F, 0xF9, 0x39, 0xEA, 0x1F, 0xD7, 0x69, 0x97, 0x79,
+    0xAA, 0x99, 0x79, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF, 0xDA, 0x29, 0xFD, 0xA9, 0xAD, 0x92, 0xFD,
+    0x70, 0x9F, 0xC7, 0x1F, 0xC9, 0x71, 0xFC, 0x71, 0x9F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1A,
+    0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x93, 0x9A, 0x3F, 0xEA, 0xEA, 0x39, 0xFF, 0xDA, 0x4A, 0xFF,
+    0xCA, 0x59, 0xFE, 0xA7, 0x19, 0x99, 0x60, 0x76, 0x99, 0x99, 0x76, 0x9F, 0xA7, 0x5A, 0xF9, 0x75,
+    0xFC, 0x76, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0xA7, 0x9A, 0x99, 0x1A, 0xF9, 0x59, 0xFC, 0xA0, 0xAF,
+    0x5A, 0xFE, 0xAF, 0xC4, 0xAF, 0xFF, 0xCA, 0x39, 0xFD, 0x9A, 0xFD, 0x93, 0xFC, 0xA2, 0x9F, 0xC3,
+    0x9F, 0xC4, 0xFC, 0x3A, 0xF9, 0x4F, 0xC3, 0xFC, 0x5F, 0xA3, 0xFC, 0x5F, 0x92, 0x9F, 0xA4, 0x9F,
+    0x39, 0xF9, 0x4A, 0xF3, 0xAF, 0x94, 0xFA, 0x3A, 0xFA, 0x3A, 0xFA, 0x39, 0xFC, 0x29, 0xFC, 0x94,
+    0xFD, 0xAF, 0xE5, 0xFF, 0xFD, 0x6F, 0xF9, 0xEA, 0x69, 0xFC, 0xA0, 0x9E, 0x97, 0x19, 0x97, 0x40,
+    0x79, 0x9A, 0x99, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC, 0xA1, 0x9F, 0xA1,
+    0xFC, 0x93, 0xFA, 0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA, 0xAA, 0xFE, 0x09,
+    0xFF, 0xFD, 0x19, 0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F, 0xA7, 0x29, 0xFC,
+    0x6A, 0x3F, 0xDA, 0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7, 0x19, 0x99, 0x70,
+    0x75, 0x99, 0x99, 0x76, 0xAF, 0xE7, 0x3A, 0xFE, 0xA7, 0x29, 0xFF, 0x97, 0x2F, 0xCA, 0x99, 0xA7,
+    0x3F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x49, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x70, 0xFF, 0xE7,
+    0x1A, 0xAF, 0xCA, 0xAA, 0xA7, 0x3F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97,
+    0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xA7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x69,
+    0xFA, 0x76, 0x9F, 0x97, 0x6A, 0xF9, 0x76, 0xFC, 0x76, 0x9F, 0xC7, 0x59, 0xFC, 0xA7, 0x2A, 0xFF,
+    0x73, 0xAF, 0xEA, 0x73, 0xAF, 0xDA, 0x74, 0x9F, 0xA9, 0x75, 0x79, 0xA9, 0x97, 0x5A, 0xFD, 0x1F,
+    0x5F, 0xFA, 0x9F, 0x4A, 0xFF, 0xFC, 0xA3, 0x9F, 0xDA, 0xAF, 0xD9, 0x3F, 0xD2, 0x9F, 0xC9, 0x29,
+    0xFC, 0x4F, 0xC3, 0xAF, 0xA4, 0xFC, 0x3F, 0xC5, 0xFA, 0x3F, 0xC4, 0x9F, 0x92, 0x9F, 0xA4, 0xAF,
+    0x39, 0xFA, 0x4F, 0xC3, 0xAF, 0xA3, 0x9F, 0xC3, 0xAF, 0xA3, 0xFC, 0xA3, 0x9F, 0xC2, 0xAF, 0xC9,
+    0x4F, 0xDA, 0xFE, 0x5F, 0xFF, 0xD5, 0x9F, 0xE9, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x75, 0xAF, 0x97,
+    0x5F, 0xC7, 0x59, 0xFA, 0x49, 0xC9, 0x49, 0xFC, 0x94, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x69, 0xFF,
+    0xDA, 0x70, 0x9A, 0xFD, 0xA7, 0x10, 0x59, 0x99, 0x99, 0x75, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF9,
+    0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xF9, 0x19, 0xA9, 0x96, 0xAF, 0x0A, 0xFC, 0xA5,
+    0xFC, 0xAF, 0xEA, 0x4F, 0xFF, 0xD3, 0x9F, 0xE9, 0xAF, 0xC9, 0x2A, 0xFC, 0xA2, 0xAF, 0x92, 0xFD,
+    0x3A, 0xF9, 0x2F, 0xC9, 0x3A, 0xF9, 0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA,
+    0x2F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF9, 0x2F, 0xA4, 0xFC, 0x29, 0xF9, 0x4F, 0xC2, 0xAF, 0x49,
+    0xFA, 0x2F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x20, 0x69, 0x97, 0xF9, 0x4A,
+    0xFA, 0x4F, 0xCA, 0x4A, 0xF6, 0x9A, 0x97, 0x77, 0x3A, 0xF9, 0x4F, 0xC5, 0xFC, 0x49, 0xFA, 0x4A,
+    0xF9, 0x4F, 0xC5, 0xFC, 0x5F, 0xC4, 0x9F, 0xA4, 0xAF, 0x94, 0xFC, 0x5F, 0xC5, 0xFA, 0x49, 0xFA,
+    0x4A, 0xF9, 0x4F, 0xC5, 0xFC, 0x49, 0xFA, 0x40, 0x73, 0x99, 0x74, 0xF9, 0x71, 0xAF, 0xA7, 0x1A,
+    0xFA, 0x71, 0x9F, 0x73, 0x9A, 0x97, 0x77, 0x77, 0x2A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F,
+    0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1A,
+    0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7,
+    0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x1F, 0xD5, 0x9F, 0xF9, 0x59, 0xFF, 0x69, 0xFE, 0x70,
+    0xFC, 0x97, 0x00, 0x59, 0x99, 0x99, 0x77, 0xFA, 0x76, 0x9F, 0x97, 0x6A, 0xF9, 0x76, 0xFC, 0x77,
+    0xFC, 0x76, 0x9F, 0xA7, 0x69, 0xF9, 0x76, 0xAF, 0x4A, 0xFC, 0x4F, 0xC3, 0xAF, 0xC5, 0xFC, 0x2A,
+    0xFC, 0x59, 0xFA, 0x1A, 0xFC, 0x6A, 0xF9, 0x0A, 0xFC, 0x7F, 0xC0, 0x9F, 0xC7, 0x0F, 0xC9, 0xFC,
+    0x71, 0xFF, 0xD7, 0x19, 0xFF, 0xCA, 0x71, 0xAF, 0xFD, 0x71, 0xFF, 0xEA, 0x70, 0xFD, 0x9F, 0xC7,
+    0x0F, 0xA1, 0xFC, 0xA6, 0x9F, 0x91, 0x9F, 0xC6, 0xAF, 0x3F, 0xC9, 0x5F, 0xC3, 0x9F, 0xC5, 0xFC,
+    0x4F, 0xC9, 0x39, 0xFA, 0x4A, 0xFC, 0x30, 0x59, 0x99, 0x99, 0x5F, 0xC4, 0x9F, 0xA4, 0xAF, 0x94,
+    0xFC, 0x5F, 0xC4, 0x9F, 0xA4, 0x9F, 0x94, 0xAF, 0x94, 0xFC, 0x5F, 0xC4, 0x9F, 0xA4, 0xAF, 0x94,
+    0xFC, 0x5F, 0xC5, 0xFC, 0x49, 0xFA, 0x4A, 0xF9, 0x4F, 0xC5, 0xFC, 0x49, 0xFA, 0x49, 0xFA, 0x4A,
+    0xF9, 0x4F, 0xC5, 0xFC, 0x49, 0xFA, 0x40, 0x73, 0x9A, 0x96, 0x9A, 0x99, 0x6A, 0xE1, 0xAF, 0xCA,
+    0x29, 0xFD, 0x5F, 0x0A, 0xFE, 0x90, 0xAF, 0xEA, 0x4F, 0xAF, 0xFC, 0x9F, 0xFC, 0x39, 0xFE, 0x9A,
+    0xFF, 0xAA, 0xFC, 0x92, 0xAF, 0xCA, 0x2F, 0xE2, 0xAF, 0x92, 0xAF, 0xC3, 0xAF, 0xC3, 0x9F, 0x92,
+    0xFC, 0x93, 0xFC, 0xA3, 0xAF, 0x92, 0xFC, 0x4F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC4, 0xFC, 0x2A,
+    0xF9, 0x39, 0xFA, 0x4F, 0xA2, 0xFC, 0x4A, 0xF9, 0x39, 0xF9, 0x2F, 0xC4, 0xFC, 0x4A, 0xF9, 0x2F,
+    0xA4, 0xFC, 0x4F, 0xC2, 0x9F, 0x94, 0xFA, 0x4F, 0xC2, 0xAF, 0x49, 0xF9, 0x4F, 0xA2, 0xFC, 0x4A,
+    0xF9, 0x39, 0xF9, 0x2F, 0xC4, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x4F, 0xC2, 0x73, 0x9A, 0x99,
+    0x6A, 0xE1, 0xAF, 0xCA, 0x5F, 0x0A, 0xFE, 0xA4, 0xFA, 0xFF, 0xC3, 0x9F, 0xE9, 0xAF, 0xC9, 0x2A,
+    0xFC, 0xA2, 0xAF, 0x92, 0xAF, 0xC3, 0xAF, 0x92, 0xFC, 0x93, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F,
+    0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x92, 0xFA, 0x4F, 0xC2,
+    0x9F, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F,
+    0xC2, 0x79, 0xAA, 0x97, 0x29, 0xFF, 0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9,
+    0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC, 0x4F, 0xC1, 0xFC, 0x94, 0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA,
+    0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A, 0xF9, 0x49, 0xFA, 0x0A, 0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39,
+    0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2, 0xFD, 0xAF, 0xE3, 0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9,
+    0x73, 0x99, 0x97, 0x00, 0x75, 0x9A, 0x97, 0x1A, 0xE1, 0xAF, 0xC9, 0x7F, 0x0F, 0xF7, 0xFF, 0xFC,
+    0xA5, 0x9F, 0xDA, 0x9F, 0xD5, 0xAF, 0xC3, 0xFC, 0x94, 0xAF, 0x93, 0xAF, 0x94, 0xFC, 0x4A, 0xF9,
+    0x4F, 0xA4, 0xAF, 0x93, 0x9F, 0x5F, 0xC4, 0xAF, 0x5F, 0xC4, 0xFC, 0x49, 0xFC, 0x4F, 0xC4, 0xAF,
+    0x94, 0xFC, 0x39, 0xFC, 0x49, 0xFC, 0x92, 0xFC, 0xA4, 0xAF, 0xDA, 0xAF, 0xD5, 0xFF, 0xFD, 0x95,
+    0xFA, 0xAF, 0xE9, 0x59, 0xF9, 0x0A, 0xFC, 0x7A, 0xF9, 0x29, 0x97, 0x1A, 0xF7, 0x7F, 0xC7, 0x7F,
+    0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x60, 0x69, 0xA9, 0x97, 0x49, 0xFD,
+    0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xD9, 0xAF, 0xD9, 0x2F, 0xCA, 0x29, 0xFC,
+    0x29, 0xFC, 0x4F, 0xC2, 0xAF, 0x94, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC5, 0xF9, 0x19, 0xFA, 0x49,
+    0xF2, 0x9F, 0x94, 0xAF, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0xA3, 0xAF, 0xA2, 0x9F, 0xC2, 0x9F, 0xC9,
+    0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD5, 0xFE, 0x9F, 0xA5, 0x9F, 0xC9, 0x0F, 0x97, 0x09, 0x2A, 0xF9,
+    0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFC, 0x75, 0xFC, 0x50,
+    0x73, 0x9A, 0xA4, 0xAE, 0x90, 0xAF, 0x4F, 0x9A, 0xFC, 0x4F, 0xAF, 0xCA, 0x39, 0xFF, 0xD9, 0x3A,
+    0xFD, 0xA9, 0x09, 0x4F, 0xD9, 0x70, 0xFC, 0xA7, 0x1F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA,
+    0x71, 0x69, 0xAA, 0x99, 0x79, 0xFF, 0xC9, 0x39, 0xFF, 0xE3, 0xFF, 0xE9, 0x2A, 0xFC, 0x29, 0xD3,
+    0xAF, 0x97, 0x1A, 0xFA, 0x71, 0xAF, 0xD7, 0x1F, 0xEA, 0x79, 0xFF, 0x79, 0xFF, 0x70, 0x9F, 0xD9,
+    0x71, 0xFC, 0xA7, 0x1A, 0xFA, 0x19, 0x95, 0xAF, 0x91, 0xAD, 0xAA, 0x9A, 0xFD, 0x2A, 0xFF, 0xEA,
+    0x2A, 0xFF, 0xDA, 0x39, 0xAF, 0xF9, 0x70, 0x99, 0x97, 0x00, 0x77, 0x3E, 0x97, 0x0A, 0xE7, 0x1F,
+    0x70, 0xAF, 0x6A, 0xFF, 0xD1, 0xFF, 0xF0, 0x9F, 0xFE, 0xA1, 0xAA, 0xFC, 0xAA, 0xAA, 0x93, 0xFA,
+    0x79, 0xF9, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0x9F, 0x97, 0xAF, 0x70, 0xFC, 0x70,
+    0xFC, 0x70, 0xFD, 0xAD, 0x4F, 0xFC, 0x4A, 0xFF, 0x5A, 0xFD, 0xA7, 0x09, 0x96, 0x77, 0x5F, 0xC4,
+    0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F,
+    0xC4, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x4A, 0xFA,
+    0x2F, 0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD, 0x3F, 0xC2, 0xAF, 0xCA, 0x3F, 0xDA,
+    0xFE, 0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC, 0x91, 0xF7, 0x99, 0x74, 0x77, 0x2F,
+    0xA5, 0xAF, 0xA0, 0xFA, 0x5F, 0xC1, 0xFA, 0x4A, 0xFA, 0x1F, 0xC4, 0xFC, 0x2F, 0xC3, 0xAF, 0x92,
+    0xAF, 0x3F, 0xC3, 0xAF, 0x2A, 0xF9, 0x39, 0xF2, 0xFC, 0x49, 0xF1, 0xAF, 0x95, 0xF1, 0xFC, 0x6F,
+    0x9A, 0xF7, 0xF9, 0xFA, 0x7F, 0xAF, 0x70, 0xAF, 0xEA, 0x70, 0xAF, 0xE7, 0x19, 0xFD, 0xA7, 0x19,
+    0xFD, 0x73, 0xFC, 0x97, 0x00, 0x77, 0x71, 0xFA, 0x4F, 0xC9, 0x39, 0xFA, 0xFA, 0x3A, 0xFC, 0x93,
+    0xFC, 0x0F, 0xA3, 0xFD, 0x93, 0xFA, 0x0F, 0xA2, 0x9F, 0xD9, 0x2A, 0xF1, 0xFA, 0x2E, 0xAE, 0x92,
+    0xFA, 0x1A, 0xEA, 0x19, 0xE9, 0xE9, 0x1A, 0xF9, 0x1A, 0xEA, 0x1F, 0x0E, 0x91, 0xFC, 0x2A, 0xEA,
+    0x1E, 0xA0, 0xE9, 0x09, 0xF9, 0x2A, 0xEA, 0x0A, 0xE1, 0xE9, 0x0F, 0xC3, 0xAE, 0xA0, 0xF1, 0xE9,
+    0x0F, 0x93, 0x9E, 0xA9, 0xE9, 0x1E, 0x9A, 0xF4, 0x9E, 0xAF, 0x2E, 0x9F, 0x94, 0x9E, 0xAE, 0xA2,
+    0xEA, 0xF5, 0x9F, 0xE3, 0xFE, 0x95, 0x9F, 0xDA, 0x3F, 0xE6, 0x9F, 0xD4, 0xFD, 0xA7, 0xFD, 0x4F,
+    0xD7, 0x0F, 0xC9, 0x4F, 0xCA, 0x70, 0x77, 0x72, 0xFC, 0x4F, 0xD5, 0xFC, 0x92, 0xAF, 0xC6, 0x9F,
+    0xA1, 0x9F, 0xC7, 0x0F, 0xC1, 0xFC, 0x97, 0x0A, 0xF9, 0xAF, 0xA7, 0x2F, 0xFC, 0xA7, 0x3F, 0xFC,
+    0x74, 0x9F, 0xE7, 0x6F, 0xD9, 0x75, 0xAF, 0xD7, 0x59, 0xFE, 0xA7, 0x39, 0xFF, 0xC7, 0x3F, 0xCA,
+    0xF9, 0x71, 0xFC, 0x90, 0xFC, 0x70, 0xFC, 0xA1, 0xFC, 0x96, 0xAF, 0xC2, 0x9F, 0xA5, 0x9F, 0xC4,
+    0xFC, 0x49, 0xFC, 0xA4, 0xFC, 0xA3, 0x77, 0x73, 0xFA, 0x5A, 0xFA, 0x5F, 0xA5, 0xFC, 0x6F, 0xC4,
+    0xAF, 0xA6, 0xFC, 0x4F, 0xC7, 0xAF, 0x3A, 0xFA, 0x79, 0xF3, 0xFC, 0x70, 0x9F, 0x2A, 0xF9, 0x71,
+    0xF9, 0x1F, 0xC7, 0x2F, 0x90, 0xAF, 0x97, 0x2F, 0x90, 0xFC, 0x73, 0xFA, 0x9F, 0x97, 0x3A, 0xEA,
+    0xAF, 0x74, 0x9E, 0xAF, 0x97, 0x49, 0xFE, 0xA7, 0x6F, 0xE7, 0x7F, 0xDA, 0x77, 0xFD, 0x77, 0x0A,
+    0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0xA7, 0x79, 0xFC, 0x77, 0x9F, 0xC9, 0x73, 0x9F, 0xFA, 0x74,
+    0x9F, 0xF7, 0x59, 0xFD, 0xA7, 0x7F, 0xA7, 0x70, 0x77, 0x49, 0xFF, 0xF3, 0xAF, 0xFE, 0xA3, 0xFF,
+    0xF9, 0x3A, 0xAA, 0xAA, 0xAF, 0xD7, 0x19, 0xFC, 0x71, 0x9F, 0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xCA,
+    0x71, 0xAF, 0xC7, 0x1A, 0xFC, 0x71, 0x9F, 0xC7, 0x2F, 0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xCA, 0x71,
+    0xAF, 0xFF, 0x3F, 0xFF, 0xC2, 0x9F, 0xFF, 0xA2, 0x9F, 0xFF, 0xA2, 0x71, 0x9A, 0xDA, 0x70, 0xFC,
+    0xA7, 0xFD, 0x96, 0x9F, 0xD9, 0x6F, 0xC7, 0x1F, 0x97, 0x09, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71,
+    0xF9, 0x71, 0xF7, 0x1F, 0xC6, 0x9A, 0xFC, 0x95, 0x9F, 0xDA, 0x6A, 0xFA, 0x70, 0xFD, 0x70, 0x9A,
+    0xFC, 0x71, 0x9F, 0x72, 0xF9, 0x71, 0xF7, 0x2F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F,
+    0x97, 0x1F, 0xCA, 0x70, 0xFD, 0x97, 0x9F, 0xC9, 0x70, 0x9F, 0x97, 0x49, 0x50, 0x3A, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE9, 0xAA, 0xA0,
+    0x49, 0xCA, 0xA9, 0x70, 0xAF, 0xA7, 0xAF, 0xC9, 0x6F, 0xDA, 0x70, 0xFC, 0x70, 0xAE, 0xA7, 0x0A,
+    0xEA, 0x70, 0xF9, 0x70, 0xF7, 0x09, 0xF7, 0x0A, 0xEA, 0x70, 0xAF, 0x70, 0x9F, 0xA7, 0x0F, 0xE7,
+    0xAF, 0xA5, 0x9F, 0xD9, 0x49, 0xFE, 0x5F, 0xC9, 0x69, 0xF7, 0x0A, 0xF7, 0x0A, 0xEA, 0x70, 0xF9,
+    0x70, 0xF7, 0x09, 0xF7, 0x0F, 0xA5, 0x9A, 0xFC, 0x95, 0xAF, 0xD6, 0xAF, 0xC9, 0x6A, 0xEA, 0x71,
+    0x97, 0x30, 0x29, 0x99, 0x97, 0x29, 0xFE, 0x94, 0x9C, 0x0F, 0xFE, 0xAA, 0xE0, 0xFF, 0xFF, 0x0C,
+    0xA9, 0x19, 0xAF, 0xFA, 0x09, 0x69, 0xAF, 0x97, 0x71, 0x77, 0x0A, 0xE9, 0x49, 0xFC, 0x4F, 0xD4,
+    0xFC, 0xA4, 0x9F, 0x79, 0x77, 0x75, 0xEA, 0x59, 0xEA, 0x5A, 0xEA, 0x5F, 0x95, 0xF5, 0x9F, 0x5A,
+    0xF5, 0xFA, 0x5F, 0xA4, 0x9F, 0x94, 0xFC, 0x5F, 0xC4, 0x9F, 0xC4, 0xAF, 0xA4, 0xFC, 0xA4, 0xFC,
+    0x97, 0x60, 0x77, 0x70, 0xAD, 0x97, 0x3E, 0x73, 0x9E, 0x99, 0x69, 0xFF, 0xC9, 0x39, 0xFF, 0xD3,
+    0x9F, 0xFE, 0x3F, 0xD9, 0x99, 0xAC, 0x92, 0xFD, 0x71, 0xFC, 0x71, 0xAF, 0xA7, 0x1F, 0xC7, 0x2F,
+    0xC7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x72, 0xFC, 0x93, 0x9C, 0x3F, 0xFF,
+    0x39, 0xFF, 0xE4, 0x9F, 0xFD, 0x6A, 0xFD, 0xA7, 0x0E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x49, 0x97,
+    0x00, 0x77, 0x77, 0x09, 0xFD, 0xA9, 0x73, 0xFF, 0xE7, 0x1F, 0xFE, 0xA7, 0x09, 0xFF, 0xE7, 0x1F,
+    0xCA, 0x29, 0xAA, 0x70, 0x9F, 0xC7, 0x7A, 0xF9, 0x77, 0xAF, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x74,
+    0x9A, 0xAA, 0xFC, 0xAA, 0xAA, 0x97, 0xAF, 0xFF, 0x97, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x73, 0xFC,
+    0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0xFC, 0x76, 0x9F, 0xC9, 0x75, 0xAF, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x40, 0x77, 0x2A, 0xC7, 0x0C, 0xA2, 0xAE,
+    0xAF, 0xCA, 0xF1, 0xAF, 0xFF, 0xCA, 0x2A, 0xFF, 0xEA, 0x39, 0xF9, 0x09, 0xF9, 0x3A, 0xE4, 0xEA,
+    0x3E, 0xA4, 0x9E, 0x3E, 0xA4, 0x9E, 0x3F, 0x4A, 0xE3, 0x9E, 0xA2, 0x9E, 0xA4, 0xFC, 0xAF, 0xC9,
+    0x3F, 0xFF, 0xC2, 0xFF, 0xFE, 0x2D, 0xA0, 0x9A, 0xAA, 0x90, 0xAD, 0x4A, 0x70, 0xA2, 0x1A, 0xF6,
+    0x9F, 0xA1, 0x9F, 0x95, 0xFC, 0x3F, 0x94, 0xAF, 0x93, 0xFA, 0x4F, 0xC4, 0xAF, 0x3F, 0xC5, 0x9F,
+    0x29, 0xF9, 0x6F, 0x91, 0xFA, 0x7F, 0x90, 0xAF, 0x70, 0xAE, 0xA9, 0xF9, 0x70, 0x9F, 0xFA, 0x72,
+    0xFF, 0x73, 0xFE, 0x97, 0x0A, 0xAA, 0xFE, 0xAA, 0xA6, 0xFF, 0xFC, 0x59, 0xFF, 0xFA, 0x69, 0x99,
+    0xAF, 0x99, 0x99, 0x72, 0xAF, 0x72, 0x9A, 0xAA, 0xFC, 0xAA, 0xA9, 0x6F, 0xFF, 0xC5, 0x9F, 0xFF,
+    0xA6, 0x99, 0x9A, 0xFA, 0x99, 0x97, 0x2A, 0xF7, 0x6F, 0xC7, 0x6F, 0xA7, 0x20, 0x3A, 0xEA, 0xEA,
+    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xE7, 0x77, 0x9A, 0xAA, 0xAE, 0xAE,
+    0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0x9A, 0xAA, 0x70, 0x99, 0x99, 0x97,
+    0x09, 0xFF, 0xA5, 0xAF, 0xFD, 0x93, 0x9F, 0xCA, 0xAF, 0x4A, 0xF4, 0xAA, 0x4F, 0x97, 0x3F, 0xC7,
+    0x39, 0xFC, 0xA7, 0x2A, 0xFD, 0xA7, 0x9F, 0xFC, 0x59, 0xFA, 0xFC, 0xA4, 0xF2, 0xFC, 0x39, 0xEA,
+    0x3F, 0x3A, 0xE9, 0x3F, 0x39, 0xF3, 0xF4, 0xFC, 0x90, 0xF9, 0x4A, 0xFF, 0xC9, 0x69, 0xFE, 0x97,
+    0x1A, 0xFD, 0x73, 0xFC, 0x97, 0x3F, 0x97, 0x3F, 0x92, 0xAC, 0x94, 0xAF, 0x3A, 0xFF, 0xEA, 0x3A,
+    0xFF, 0xDA, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x71, 0x74, 0x9D, 0xA1, 0x9E, 0x1F, 0x1F, 0x90, 0xF1,
+    0xF9, 0x0E, 0xA1, 0xAE, 0x29, 0x59, 0x10, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x59, 0xFF, 0xF9,
+    0x72, 0xAE, 0xA4, 0x9A, 0xEA, 0x70, 0xE9, 0x71, 0xAD, 0xA6, 0xE4, 0x99, 0xA9, 0x92, 0xAD, 0xA4,
+    0x9D, 0x39, 0xFE, 0x91, 0xAD, 0x93, 0xD9, 0x29, 0xFF, 0x3E, 0x29, 0xD3, 0xE9, 0x39, 0x39, 0xD9,
+    0x1D, 0xA2, 0xAD, 0x97, 0x2D, 0xA1, 0xD3, 0xE7, 0x3A, 0xD0, 0x9D, 0x29, 0xDA, 0x73, 0x9D, 0x09,
+    0xD2, 0x9D, 0x97, 0x39, 0xD0, 0x9D, 0x29, 0xD9, 0x73, 0x9D, 0x09, 0xD2, 0x9D, 0x97, 0x39, 0xD1,
+    0xD3, 0xDA, 0x73, 0xAD, 0x1D, 0x92, 0xE7, 0x3D, 0xA1, 0xAD, 0x29, 0xDA, 0x72, 0xD9, 0x2D, 0x92,
+    0xFA, 0xAA, 0xD3, 0xAD, 0x3A, 0xD3, 0xAF, 0xE2, 0x9D, 0x94, 0xE4, 0xAA, 0xAA, 0x92, 0x9E, 0x59,
+    0xE7, 0x2A, 0xE7, 0x9E, 0xA9, 0x59, 0xF7, 0x2A, 0xFF, 0xFA, 0x75, 0xAF, 0xFA, 0x77, 0x29, 0x99,
+    0x73, 0x77, 0x9E, 0xA0, 0x9D, 0x29, 0xFF, 0xC2, 0xFA, 0xAF, 0x1A, 0xE2, 0xEA, 0x1E, 0xA2, 0xE9,
+    0x09, 0xE3, 0xE1, 0x9E, 0x3E, 0x1A, 0xE2, 0xAD, 0xA1, 0xAE, 0x2E, 0x91, 0x9F, 0xAF, 0x3A, 0xFA,
+    0xAD, 0x49, 0xAA, 0x90, 0x9A, 0x92, 0x5A, 0x6A, 0x79, 0xD9, 0x39, 0xD9, 0x49, 0xFA, 0x19, 0xFA,
+    0x3F, 0xC1, 0x9F, 0xC9, 0x2F, 0xC9, 0x1F, 0xC9, 0x2F, 0xCA, 0x1F, 0xCA, 0x2F, 0xCA, 0x1F, 0xCA,
+    0x2A, 0xFC, 0x1A, 0xFC, 0x3A, 0xFA, 0x1A, 0xFA, 0x4F, 0xC2, 0xFC, 0x4A, 0xF9, 0x1F, 0xC9, 0x39,
+    0xFA, 0x19, 0xFA, 0x4F, 0xC2, 0xFC, 0x49, 0xF9, 0x19, 0xF9, 0x4D, 0xA9, 0x3D, 0xA9, 0x59, 0x69,
+    0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x74, 0xAE, 0x0A, 0xFF, 0x0F,
+    0xFA, 0x0F, 0xF9, 0x9F, 0xF9, 0x71, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x59, 0xFF, 0xF9, 0x72,
+    0xAE, 0xA4, 0x9A, 0xEA, 0x70, 0xE9, 0x71, 0xAD, 0xA6, 0xE1, 0x99, 0x99, 0x99, 0x4A, 0xDA, 0x49,
+    0xD2, 0xFF, 0x3A, 0xD9, 0x3D, 0x92, 0xFF, 0xC3, 0xE2, 0x9D, 0x3E, 0x2A, 0xDA, 0x29, 0xD9, 0x1D,
+    0xA3, 0xE3, 0xE3, 0xDA, 0x1D, 0x4E, 0x3E, 0x3A, 0xD0, 0x9D, 0x4E, 0x29, 0xDA, 0x39, 0xD0, 0x9D,
+    0x4E, 0x99, 0xAE, 0x49, 0xD0, 0x9D, 0x4F, 0xF5, 0x9D, 0x09, 0xD4, 0xFE, 0xA5, 0x9D, 0x1D, 0x4E,
+    0x1A, 0xD5, 0xAD, 0x1D, 0x93, 0xE2, 0xE4, 0xDA, 0x1A, 0xD3, 0xE2, 0xAD, 0x93, 0xD9, 0x2D, 0x92,
+    0xE3, 0xE2, 0xAD, 0x3A, 0xD2, 0xE3, 0x9D, 0xA0, 0x9D, 0x94, 0xE1, 0x99, 0x94, 0x99, 0x99, 0xE5,
+    0x9E, 0x72, 0xAE, 0x79, 0xEA, 0x95, 0x9F, 0x72, 0xAF, 0xFF, 0xA7, 0x5A, 0xFF, 0xA7, 0x72, 0x99,
+    0x97, 0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x76, 0xAF, 0xA4, 0xFF, 0x2F, 0xFD, 0x09, 0xE9,
+    0x19, 0xE9, 0xAD, 0xA3, 0xAD, 0xAA, 0xDA, 0x39, 0xEA, 0xDA, 0x3A, 0xDA, 0x9E, 0x91, 0x9E, 0x90,
+    0xFF, 0xD2, 0xFF, 0x93, 0xAF, 0xA7, 0x60, 0x6E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E,
+    0xA7, 0x4E, 0xA6, 0xAA, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF,
+    0xFF, 0x6E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x49, 0x99, 0x7A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x69,
+    0x99, 0x79, 0xFD, 0xA4, 0xAF, 0xFA, 0x39, 0xEA, 0xFC, 0x4A, 0x92, 0xF7, 0x1F, 0x70, 0x9E, 0xA7,
+    0x9F, 0x7A, 0xF7, 0xFA, 0x7F, 0x96, 0x9F, 0x96, 0x9F, 0xFD, 0x2F, 0xFD, 0xA2, 0xFF, 0xDA, 0x77,
+    0x59, 0x99, 0x69, 0xFD, 0xA3, 0x9F, 0xFA, 0x3D, 0xA9, 0xAF, 0x70, 0xAE, 0x70, 0xF4, 0x99, 0x9F,
+    0x5F, 0xCA, 0x59, 0xFD, 0x70, 0x9F, 0x70, 0xAE, 0x19, 0x5F, 0x1A, 0xCA, 0xA9, 0xAF, 0xA1, 0xAF,
+    0xFC, 0x29, 0xFE, 0xA6, 0x99, 0x99, 0x50, 0x39, 0xAA, 0xAA, 0x92, 0x9F, 0xC3, 0xFC, 0x3A, 0xF3,
+    0x9E, 0xA4, 0xEA, 0x40, 0x77, 0x73, 0xAF, 0x49, 0xFA, 0x5F, 0xC4, 0x9F, 0x95, 0xFC, 0x4A, 0xF5,
+    0x9F, 0xA4, 0xFC, 0x5A, 0xF9, 0x4F, 0xC5, 0xAF, 0x49, 0xFA, 0x5F, 0xC4, 0xAF, 0x95, 0xFC, 0x4F,
+    0xC5, 0x9F, 0xA4, 0xFC, 0x5A, 0xF9, 0x39, 0xFA, 0x5F, 0xC4, 0xAF, 0x95, 0xFC, 0x4F, 0xC9, 0x5F,
+    0xC3, 0xAF, 0xC5, 0x9F, 0xC2, 0x9F, 0xD5, 0xAF, 0xDA, 0xFE, 0xA5, 0xFF, 0xEA, 0xE9, 0x5F, 0xFD,
+    0x9A, 0xE5, 0x9F, 0xAF, 0x90, 0xAE, 0x5A, 0xF9, 0x09, 0x97, 0x4A, 0xF7, 0x70, 0xFC, 0x77, 0x0F,
+    0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x59, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x39, 0xFF, 0xFC, 0xA1, 0xAF, 0xFF, 0xDA, 0x09, 0xFF, 0xFE, 0xA0, 0xFF, 0xE2, 0xDA, 0x0F,
+    0xFE, 0x2D, 0xA9, 0xFF, 0xE2, 0xDA, 0xAF, 0xFE, 0x2D, 0xAA, 0xFF, 0xE2, 0xDA, 0xAF, 0xFE, 0x2D,
+    0xAA, 0xFF, 0xE2, 0xDA, 0x9F, 0xFE, 0x2D, 0xA0, 0xFF, 0xE2, 0xDA, 0x0F, 0xFE, 0x2D, 0xA0, 0x9F,
+    0xFD, 0x2D, 0xA1, 0xAF, 0xFC, 0x2D, 0xA2, 0x9F, 0xF2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2,
+    0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70,
+    0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D,
+    0xA7, 0x09, 0xD2, 0xDA, 0x70, 0x9D, 0x2D, 0xA7, 0x71, 0x7A, 0xE9, 0x09, 0xFC, 0x0A, 0xFC, 0x0F,
+    0xD0, 0x9F, 0x39, 0x92, 0x2A, 0xD9, 0x39, 0xEA, 0x39, 0xFC, 0x4F, 0x4F, 0x09, 0xFE, 0x09, 0xFD,
+    0x91, 0xFA, 0x91, 0x76, 0x9F, 0x3F, 0xCA, 0x1A, 0xFD, 0x99, 0xFF, 0x0A, 0xFF, 0x1D, 0xA0, 0xEA,
+    0x19, 0x19, 0xE9, 0x4A, 0xE9, 0x4F, 0x5F, 0x49, 0xEA, 0x4A, 0xE9, 0x4F, 0x5F, 0x74, 0x3A, 0xF9,
+    0x4F, 0xE9, 0x2F, 0xAF, 0x19, 0xE9, 0x09, 0xE1, 0xEA, 0x2E, 0x90, 0xE9, 0x2E, 0x1E, 0x29, 0xE1,
+    0xE2, 0xAE, 0x1E, 0x90, 0x9E, 0x91, 0xFF, 0xC3, 0xFE, 0x5A, 0xDA, 0x93, 0x49, 0x95, 0x99, 0x5A,
+    0xE3, 0xAE, 0x49, 0xF9, 0x19, 0xF9, 0x4F, 0xC2, 0xFA, 0x4A, 0xF2, 0xAF, 0x49, 0xFA, 0x19, 0xFA,
+    0x4F, 0xC2, 0xFC, 0x4A, 0xFA, 0x1A, 0xF9, 0x29, 0xFC, 0x19, 0xFC, 0x3F, 0xC9, 0x1F, 0xC9, 0x2F,
+    0xC9, 0x1F, 0xC9, 0x2A, 0xFA, 0x1F, 0xCA, 0x2A, 0xFA, 0x1A, 0xFA, 0x39, 0xF2, 0x9F, 0x6D, 0x49,
+    0xD7, 0x77, 0x77, 0x75, 0x9F, 0x70, 0xEA, 0x5A, 0xFC, 0x7A, 0xE4, 0x9F, 0xDA, 0x69, 0xE9, 0x3F,
+    0xF9, 0x6E, 0xA3, 0x9F, 0xF6, 0xF5, 0xAC, 0xA0, 0xF5, 0xAE, 0x79, 0x1F, 0x49, 0xE9, 0x71, 0x9E,
+    0xA4, 0xEA, 0x72, 0xAE, 0x93, 0xF7, 0x3F, 0x3A, 0xE9, 0x73, 0xF2, 0x9E, 0x93, 0xF9, 0x3F, 0x2E,
+    0xA3, 0xFC, 0x92, 0x9E, 0xA1, 0xF3, 0xFD, 0x3A, 0xE9, 0x0A, 0xE9, 0x2A, 0xFD, 0x70, 0x9E, 0xA2,
+    0xAF, 0xDA, 0x70, 0xF2, 0x9E, 0x9E, 0x97, 0xF2, 0x9E, 0x0A, 0xE7, 0xAE, 0x92, 0xE9, 0x0F, 0x69,
+    0xEA, 0x2E, 0x91, 0xF6, 0xF2, 0x9F, 0xFE, 0x93, 0xF3, 0xAF, 0xFE, 0x92, 0xAE, 0x93, 0xAA, 0xAA,
+    0xAA, 0xFA, 0xA2, 0x9E, 0xA7, 0x2F, 0x4F, 0x73, 0xEA, 0x77, 0x73, 0x77, 0x77, 0x9F, 0x70, 0xEA,
+    0x7A, 0xFC, 0x7F, 0x69, 0xFD, 0xA6, 0xAE, 0x95, 0xFF, 0x95, 0x9E, 0xA5, 0x9F, 0xF6, 0xF7, 0xAC,
+    0xA0, 0xF5, 0xF7, 0x19, 0x1F, 0x4A, 0xE9, 0x73, 0x9E, 0xA3, 0x9E, 0xA7, 0x4A, 0xE9, 0x3F, 0x75,
+    0xF3, 0xAE, 0x39, 0x99, 0x7F, 0x29, 0xE9, 0x09, 0xFE, 0x5F, 0x2E, 0xA0, 0xAF, 0xFC, 0x39, 0xEA,
+    0x1F, 0x2F, 0xFC, 0x3A, 0xE9, 0x0A, 0xE3, 0x9A, 0x2F, 0x97, 0x9E, 0x97, 0x0F, 0x70, 0xEA, 0x70,
+    0x9F, 0x7F, 0x70, 0x9F, 0x7A, 0xE9, 0x79, 0xF7, 0x9E, 0xA7, 0xAF, 0x70, 0xF7, 0xFA, 0x70, 0xF7,
+    0xF9, 0x70, 0xAE, 0x95, 0x9F, 0xFD, 0x39, 0xEA, 0x6A, 0xFF, 0xD3, 0xF7, 0xFF, 0xDA, 0x77, 0x74,
+    0x59, 0x99, 0x77, 0x49, 0xFE, 0x71, 0xEA, 0x4F, 0xFC, 0x7F, 0x5A, 0xDA, 0xAF, 0x6A, 0xE9, 0x72,
+    0x9E, 0x94, 0x9E, 0xA7, 0x3A, 0xE5, 0xF7, 0x09, 0x99, 0xAE, 0x94, 0xAE, 0x71, 0xFC, 0xA5, 0x9E,
+    0x97, 0x1F, 0xD9, 0x4E, 0xA7, 0x49, 0xF3, 0xF7, 0x6A, 0xE2, 0xAE, 0x77, 0xAE, 0x19, 0xE9, 0x29,
+    0xF9, 0x9D, 0xA9, 0xAF, 0xC1, 0xEA, 0x3F, 0xC0, 0x9F, 0xFC, 0x90, 0xF3, 0xFD, 0x09, 0xFE, 0xA1,
+    0xAE, 0x92, 0xFE, 0x39, 0x99, 0x92, 0x9E, 0xA2, 0xAF, 0xDA, 0x72, 0xF2, 0x9E, 0x9E, 0x97, 0x1F,
+    0x29, 0xE0, 0xAE, 0x71, 0xAE, 0x92, 0xE1, 0xF7, 0x09, 0xEA, 0x2E, 0x91, 0xF7, 0x0F, 0x29, 0xFF,
+    0xE9, 0x5F, 0x3A, 0xFF, 0xE5, 0xAE, 0x93, 0xAA, 0xAA, 0xAA, 0xFA, 0xA4, 0x9E, 0xA7, 0x2F, 0x6F,
+    0x73, 0xEA, 0x77, 0x75, 0x71, 0x9A, 0x97, 0x1F, 0xA7, 0xAF, 0xC7, 0xFD, 0x7A, 0xF9, 0x70, 0xAD,
+    0xA7, 0x77, 0x77, 0x72, 0xF7, 0x0A, 0xF7, 0x9F, 0x96, 0xAF, 0xC6, 0xFD, 0x59, 0xFD, 0x94, 0x9F,
+    0xD6, 0xFC, 0xA6, 0xAF, 0x97, 0xFC, 0x70, 0xFC, 0x59, 0x1F, 0xCA, 0x29, 0xDA, 0x0A, 0xFF, 0xF1,
+    0xFF, 0xF9, 0x09, 0xFF, 0xDA, 0x3A, 0xFC, 0xA9, 0x20, 0x73, 0xAA, 0xAA, 0xA7, 0x7F, 0xC9, 0x77,
+    0xFA, 0x77, 0x9F, 0x77, 0x09, 0xE9, 0x77, 0x09, 0xDA, 0x77, 0x77, 0x77, 0x7A, 0xFC, 0x97, 0x5F,
+    0xDA, 0x74, 0xAF, 0xE7, 0x39, 0xFF, 0x73, 0xFA, 0xF7, 0x29, 0xF9, 0xF7, 0x2F, 0xA0, 0xF7, 0x19,
+    0xF9, 0x0F, 0x97, 0x0F, 0xC1, 0xF9, 0x79, 0xF9, 0x1F, 0x97, 0xFC, 0x2F, 0xA6, 0x9F, 0x92, 0xAE,
+    0xA6, 0xFC, 0x3A, 0xF5, 0x9F, 0x93, 0xAF, 0x5F, 0xFF, 0xE4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x3A,
+    0xFF, 0xFF, 0x92, 0xFC, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x1A, 0xF9, 0x7F, 0x91, 0xFC, 0x70, 0xFA,
+    0x0A, 0xF9, 0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xCA, 0xF9, 0x71, 0xFC, 0x77, 0x0A, 0xAA, 0xAA, 0x77,
+    0x0F, 0xCA, 0x77, 0x9F, 0xA7, 0x70, 0xFA, 0x77, 0x0F, 0x97, 0x70, 0x9E, 0x77, 0x77, 0x77, 0x77,
+    0xAF, 0xC9, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74,
+    0xFA, 0x0F, 0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2,
+    0xFA, 0x70, 0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A,
+    0xFF, 0xFE, 0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF,
+    0x97, 0xF9, 0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71,
+    0xFC, 0x10, 0x75, 0xAA, 0xAA, 0xA9, 0x77, 0xFE, 0x76, 0xFF, 0xA7, 0x4F, 0xA0, 0xF7, 0x3F, 0xA2,
+    0xF7, 0x1A, 0xE5, 0xE9, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xC9, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75,
+    0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F, 0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC,
+    0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70, 0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3,
+    0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE, 0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9,
+    0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9, 0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97,
+    0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x10, 0x77, 0x49, 0x97, 0x39, 0xF9, 0x2A,
+    0xD7, 0x3F, 0xEA, 0xAE, 0x72, 0xAF, 0xFE, 0x97, 0x2E, 0x1A, 0xFC, 0xA7, 0x29, 0xD4, 0xAC, 0xA9,
+    0x77, 0x77, 0x77, 0x76, 0xAF, 0xC9, 0x77, 0x0F, 0xDA, 0x77, 0xAF, 0xE7, 0x69, 0xFF, 0x76, 0xFA,
+    0xF7, 0x59, 0xF9, 0xF7, 0x5F, 0xA0, 0xF7, 0x49, 0xF9, 0x0F, 0x97, 0x3F, 0xC1, 0xF9, 0x72, 0x9F,
+    0x91, 0xF9, 0x72, 0xFC, 0x2F, 0xA7, 0x19, 0xF9, 0x2A, 0xEA, 0x71, 0xFC, 0x3A, 0xF7, 0x09, 0xF9,
+    0x3A, 0xF7, 0x0F, 0xFF, 0xE7, 0xAF, 0xFF, 0xE7, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0x95, 0xFC, 0x99,
+    0x99, 0x99, 0x9A, 0xF9, 0x4A, 0xF9, 0x7F, 0x94, 0xFC, 0x70, 0xFA, 0x3A, 0xF9, 0x70, 0xFA, 0x3F,
+    0xC7, 0x1F, 0xC2, 0xAF, 0x97, 0x1F, 0xC2, 0x77, 0x77, 0x1E, 0x2E, 0x97, 0x2F, 0xA0, 0xAE, 0xA7,
+    0x2F, 0x90, 0xAE, 0xA7, 0x2A, 0xE1, 0x9E, 0x75, 0x94, 0x97, 0x77, 0x77, 0x77, 0x1A, 0xFC, 0x97,
+    0x6F, 0xDA, 0x75, 0xAF, 0xE7, 0x49, 0xFF, 0x74, 0xFA, 0xF7, 0x39, 0xF9, 0xF7, 0x3F, 0xA0, 0xF7,
+    0x29, 0xF9, 0x0F, 0x97, 0x1F, 0xC1, 0xF9, 0x70, 0x9F, 0x91, 0xF9, 0x70, 0xFC, 0x2F, 0xA7, 0x9F,
+    0x92, 0xAE, 0xA7, 0xFC, 0x3A, 0xF6, 0x9F, 0x93, 0xAF, 0x6F, 0xFF, 0xE5, 0xAF, 0xFF, 0xE5, 0xFF,
+    0xFF, 0x4A, 0xFF, 0xFF, 0x93, 0xFC, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x2A, 0xF9, 0x7F, 0x92, 0xFC,
+    0x70, 0xFA, 0x1A, 0xF9, 0x70, 0xFA, 0x1F, 0xC7, 0x1F, 0xC0, 0xAF, 0x97, 0x1F, 0xC0, 0x75, 0x9E,
+    0x97, 0x6F, 0xDA, 0x74, 0x9D, 0xA9, 0xE9, 0x73, 0xAD, 0x2D, 0xA7, 0x3A, 0xD2, 0xD9, 0x73, 0x9E,
+    0x9E, 0x97, 0x4F, 0xDA, 0x76, 0x9D, 0xA9, 0x77, 0x77, 0x77, 0x7A, 0xFC, 0x97, 0x5F, 0xDA, 0x74,
+    0xAF, 0xE7, 0x39, 0xFF, 0x73, 0xFA, 0xF7, 0x29, 0xF9, 0xF7, 0x2F, 0xA0, 0xF7, 0x19, 0xF9, 0x0F,
+    0x97, 0x0F, 0xC1, 0xF9, 0x79, 0xF9, 0x1F, 0x97, 0xFC, 0x2F, 0xA6, 0x9F, 0x92, 0xAE, 0xA6, 0xFC,
+    0x3A, 0xF5, 0x9F, 0x93, 0xAF, 0x5F, 0xFF, 0xE4, 0xAF, 0xFF, 0xE4, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF,
+    0x92, 0xFC, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x1A, 0xF9, 0x7F, 0x91, 0xFC, 0x70, 0xFA, 0x0A, 0xF9,
+    0x70, 0xFA, 0x0F, 0xC7, 0x1F, 0xCA, 0xF9, 0x71, 0xFC, 0x76, 0xFF, 0xFF, 0xCA, 0x75, 0xFF, 0xFF,
+    0xDA, 0x74, 0x9F, 0xFF, 0xFD, 0x97, 0x4F, 0xFF, 0xFE, 0x97, 0x3A, 0xFA, 0xAF, 0xC9, 0x99, 0x99,
+    0x99, 0x97, 0x39, 0xFC, 0x09, 0xFA, 0x77, 0x3F, 0xC1, 0xAF, 0x97, 0x72, 0xAF, 0xA1, 0xFC, 0x77,
+    0x3F, 0xC2, 0xFC, 0x77, 0x2F, 0xC9, 0x19, 0xFC, 0x99, 0x99, 0x99, 0x97, 0x29, 0xFC, 0x2A, 0xFF,
+    0xF7, 0x2F, 0xC3, 0xAF, 0xFF, 0x71, 0xAF, 0xA3, 0xFF, 0xFC, 0x70, 0x9F, 0xC4, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x70, 0xFF, 0xFE, 0xA7, 0x7A, 0xFF, 0xFE, 0x97, 0x69, 0xFF, 0xFF, 0x77, 0xFF, 0xFF,
+    0xC7, 0x6A, 0xFC, 0x99, 0x99, 0x99, 0x9F, 0xC7, 0x6F, 0xC6, 0x9F, 0xA7, 0x5F, 0xCA, 0x6A, 0xFF,
+    0xFA, 0x49, 0xFC, 0x7F, 0xFF, 0xC9, 0x4F, 0xC9, 0x7F, 0xFF, 0xC4, 0xAF, 0xA7, 0x9F, 0xFF, 0xC4,
+    0x77, 0x75, 0x9F, 0xEA, 0x97, 0x09, 0xFF, 0xF9, 0x5F, 0xFF, 0xD9, 0x4F, 0xFF, 0xE4, 0xAF, 0xDA,
+    0x29, 0xAD, 0x93, 0x9F, 0xCA, 0x79, 0x4F, 0xD7, 0x59, 0xFC, 0x76, 0xFC, 0xA7, 0x6F, 0xC7, 0x69,
+    0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC9, 0x76, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x97, 0x6F,
+    0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xD9, 0x39, 0xAC, 0x95, 0xFF, 0xFD, 0x96, 0xFF, 0xFC, 0x97, 0xFF,
+    0xF9, 0x70, 0xAF, 0xFA, 0x97, 0x4E, 0x97, 0x7A, 0xE9, 0x77, 0xAF, 0x97, 0x70, 0xF7, 0x70, 0xF7,
+    0x4A, 0xFD, 0xA7, 0x4A, 0xFD, 0x75, 0xAF, 0xA7, 0x10, 0x70, 0xAA, 0xAA, 0x97, 0x6F, 0xC7, 0x69,
+    0xF9, 0x76, 0xAF, 0x77, 0xAE, 0x77, 0x0A, 0xD9, 0x77, 0x77, 0x77, 0x1F, 0xFF, 0xC5, 0x9F, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA,
+    0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF,
+    0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75,
+    0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F,
+    0xFF, 0xC9, 0x40, 0x75, 0xAA, 0xAA, 0xA7, 0x5F, 0xCA, 0x74, 0x9F, 0xA7, 0x5F, 0xA7, 0x5F, 0x97,
+    0x59, 0xE7, 0x77, 0x77, 0x73, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA,
+    0x5F, 0xC9, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC,
+    0x99, 0x99, 0x99, 0x99, 0x59, 0xFF, 0xFA, 0x59, 0xFF, 0xF9, 0x5A, 0xFF, 0xF6, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC, 0x75,
+    0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x94, 0x72, 0xAA, 0xAA, 0xA9,
+    0x74, 0xFE, 0x73, 0xFF, 0xA7, 0x1F, 0xA0, 0xF7, 0x0F, 0x91, 0x9F, 0x6A, 0xDA, 0x49, 0xE7, 0x77,
+    0x77, 0x6F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99,
+    0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99,
+    0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC,
+    0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A,
+    0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x40, 0x77, 0x73, 0x9E, 0x2E, 0x97, 0x0F, 0x90,
+    0xAE, 0xA7, 0x0F, 0x90, 0xFA, 0x70, 0xAE, 0x1A, 0xE7, 0x39, 0x49, 0x77, 0x77, 0x77, 0x0F, 0xFF,
+    0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F,
+    0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF,
+    0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F,
+    0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x40, 0x6A, 0xAA, 0xA9, 0x72, 0xFC, 0x72, 0x9F, 0x97, 0x2A, 0xEA,
+    0x73, 0xAE, 0x74, 0xAD, 0x97, 0x77, 0x76, 0xFF, 0xD9, 0x4F, 0xFD, 0x93, 0x9F, 0xFD, 0x5A, 0xFE,
+    0xA9, 0x7F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1A, 0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA,
+    0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7,
+    0x2F, 0xC7, 0x19, 0xFA, 0x70, 0xAF, 0xDA, 0x59, 0xFF, 0xD4, 0xAF, 0xFD, 0x4F, 0xFD, 0xA4, 0x72,
+    0x9A, 0xAA, 0xAA, 0x73, 0xFC, 0x97, 0x2A, 0xF9, 0x72, 0x9F, 0x97, 0x3F, 0x74, 0xAD, 0xA7, 0x77,
+    0x77, 0x6F, 0xFD, 0x96, 0xFF, 0xD9, 0x59, 0xFF, 0xD7, 0xAF, 0xEA, 0x97, 0x1F, 0xC7, 0x39, 0xFA,
+    0x73, 0xAF, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7,
+    0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x72,
+    0xAF, 0xDA, 0x79, 0xFF, 0xD6, 0xAF, 0xFD, 0x6F, 0xFD, 0xA6, 0x70, 0xAA, 0xAA, 0xA7, 0x3F, 0xE7,
+    0x1F, 0xF9, 0x7F, 0xA9, 0xF6, 0xF9, 0x19, 0xEA, 0x4E, 0xA4, 0x9E, 0x77, 0x77, 0x71, 0xFF, 0xD9,
+    0x6F, 0xFD, 0x95, 0x9F, 0xFD, 0x7A, 0xFE, 0xA9, 0x71, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73,
+    0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x74, 0xFC,
+    0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x2A, 0xFD, 0xA7, 0x9F,
+    0xFD, 0x6A, 0xFF, 0xD6, 0xFF, 0xDA, 0x60, 0x77, 0x69, 0xDA, 0x19, 0xE6, 0xF1, 0xF9, 0x5F, 0x1F,
+    0x95, 0xEA, 0x1A, 0xE7, 0x95, 0x97, 0x77, 0x77, 0x0F, 0xFD, 0x95, 0xFF, 0xD9, 0x49, 0xFF, 0xD6,
+    0xAF, 0xEA, 0x97, 0x0F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7,
+    0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97,
+    0x2F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x71, 0xAF, 0xDA, 0x69, 0xFF, 0xD5, 0xAF, 0xFD, 0x5F, 0xFD,
+    0xA5, 0x5F, 0xEA, 0xA9, 0x72, 0x9F, 0xFE, 0xA7, 0x0A, 0xFF, 0xFC, 0x7F, 0xFF, 0xE6, 0xFC, 0x99,
+    0x9A, 0xFD, 0xA5, 0xFC, 0x4F, 0xD4, 0x9F, 0xA5, 0xFC, 0x4A, 0xF9, 0x5F, 0xC9, 0x3F, 0xC6, 0xAF,
+    0x93, 0xFC, 0x6A, 0xFA, 0x0A, 0xFF, 0xD9, 0x2A, 0xFA, 0x0F, 0xFE, 0x92, 0xAF, 0x90, 0xFF, 0xE3,
+    0xFC, 0x99, 0xFF, 0xE3, 0xFC, 0x19, 0x9F, 0xC9, 0x99, 0x39, 0xFC, 0x29, 0xFA, 0x6F, 0xCA, 0x2A,
+    0xF9, 0x59, 0xFC, 0x3F, 0xC9, 0x49, 0xFC, 0xA3, 0xFC, 0x49, 0xFD, 0x4F, 0xC1, 0x99, 0xFE, 0x93,
+    0x9F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA7, 0xFF, 0xDA, 0x97, 0x00, 0x77, 0x49,
+    0x97, 0x6A, 0xEA, 0x29, 0xDA, 0x74, 0xAF, 0xDA, 0xAE, 0x74, 0x9F, 0xFE, 0xA7, 0x4A, 0xD9, 0x09,
+    0xFD, 0x75, 0xDA, 0x39, 0xDA, 0x77, 0x77, 0x77, 0x76, 0xFC, 0xA7, 0x0F, 0x94, 0x9F, 0xD7, 0x9F,
+    0x5A, 0xFD, 0x96, 0xAF, 0x5F, 0xEA, 0x6F, 0xA5, 0xFF, 0x6F, 0xA4, 0x9F, 0xF9, 0x49, 0xF9, 0x49,
+    0xFF, 0xA4, 0x9F, 0x5A, 0xEA, 0xAF, 0x4A, 0xF5, 0xF9, 0x9F, 0x93, 0xFA, 0x5F, 0x90, 0xFA, 0x3F,
+    0x94, 0x9F, 0x1A, 0xF2, 0x9F, 0x5A, 0xF1, 0x9F, 0x91, 0xAF, 0x5A, 0xF2, 0xFA, 0x1F, 0xC5, 0xFA,
+    0x2A, 0xF1, 0xFA, 0x5F, 0x92, 0x9F, 0x90, 0xF9, 0x49, 0xF4, 0xFA, 0x9F, 0x5A, 0xF4, 0xFC, 0x9F,
+    0x5F, 0xC4, 0x9F, 0xFC, 0x5F, 0xA5, 0xFF, 0xA5, 0xF9, 0x5F, 0xF9, 0x49, 0xF6, 0x9F, 0xE5, 0xAF,
+    0x7F, 0xE5, 0xFA, 0x7F, 0xDA, 0x5F, 0xA7, 0xAF, 0xC9, 0x40, 0x71, 0x9A, 0xAA, 0xA7, 0x71, 0x9F,
+    0xA7, 0x71, 0xFC, 0x77, 0x2F, 0x97, 0x72, 0xF7, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x49, 0xFE, 0x97,
+    0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F,
+    0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F,
+    0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71,
+    0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7,
+    0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA,
+    0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x30, 0x76, 0x9A, 0xAA, 0xA9, 0x77, 0x0F,
+    0xC9, 0x77, 0xFC, 0x97, 0x7A, 0xF7, 0x70, 0x9F, 0x77, 0x1E, 0xA7, 0x77, 0x77, 0x77, 0x59, 0xFE,
+    0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA,
+    0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7,
+    0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC,
+    0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC,
+    0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF,
+    0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x30, 0x73, 0x9A, 0xAA, 0xAA, 0x77,
+    0x9F, 0xDA, 0x75, 0x9F, 0xF7, 0x49, 0xF9, 0xAE, 0xA7, 0x29, 0xF2, 0xAE, 0x97, 0x1E, 0xA4, 0xAD,
+    0xA7, 0x77, 0x77, 0x77, 0x09, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F,
+    0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2,
+    0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F,
+    0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC,
+    0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD,
+    0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97,
+    0x30, 0x77, 0x39, 0x73, 0x9F, 0x92, 0xE7, 0x19, 0xFE, 0xAE, 0x97, 0x1F, 0xFF, 0x71, 0x9D, 0xA0,
+    0x9F, 0xD9, 0x71, 0xAD, 0x39, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x29, 0xFE, 0x97, 0x3A, 0xFF, 0xE7,
+    0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6,
+    0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC,
+    0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC,
+    0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF,
+    0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9,
+    0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x30, 0x77, 0x77, 0x09, 0xDA, 0x19, 0xE7, 0x4F, 0x1F, 0x97,
+    0x29, 0xF1, 0xF9, 0x73, 0xEA, 0x1F, 0x75, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xE9, 0x73, 0xAF,
+    0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F, 0xD9, 0x39, 0xFC, 0xA5, 0xFD, 0x3F,
+    0xCA, 0x69, 0xFC, 0x2A, 0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x70, 0xFC, 0x91, 0xFC, 0x71, 0xFC, 0x90,
+    0x9F, 0xC7, 0x1F, 0xC9, 0x0A, 0xFA, 0x71, 0xFC, 0x1F, 0xC9, 0x71, 0xFC, 0x1F, 0xC7, 0x19, 0xFC,
+    0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7, 0x1F, 0xC9, 0x1F, 0xC9, 0x7A, 0xFC, 0x2F, 0xCA, 0x7F, 0xCA,
+    0x2A, 0xFC, 0x6F, 0xD4, 0xFD, 0x92, 0x9F, 0xD9, 0x4A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x0F,
+    0xFF, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x73, 0x77, 0x1A, 0xA7, 0xC9, 0x2A, 0xDA, 0x5E, 0x90,
+    0x9F, 0xA3, 0xFC, 0x19, 0xFA, 0x1F, 0xC3, 0x9F, 0xAF, 0xC5, 0x9F, 0xF7, 0x9F, 0xD7, 0x1F, 0xCA,
+    0x70, 0xFE, 0xA6, 0xFF, 0xCA, 0x4F, 0xC0, 0x9F, 0xA2, 0xFC, 0x29, 0xFA, 0x1F, 0x49, 0xF2, 0xD6,
+    0x9D, 0x75, 0x92, 0x77, 0x77, 0x72, 0xC7, 0x29, 0xFE, 0x90, 0xE9, 0x6A, 0xFF, 0xFD, 0x6F, 0xFF,
+    0xE9, 0x5F, 0xFF, 0xF5, 0xAF, 0xCA, 0x3A, 0xFC, 0xA3, 0x9F, 0xC9, 0x4F, 0xE3, 0xFC, 0x94, 0xAF,
+    0xE2, 0x9F, 0xC4, 0xAF, 0xF2, 0xFC, 0x93, 0x9E, 0xAA, 0xF9, 0x1F, 0xC4, 0xF0, 0xAF, 0x90, 0x9F,
+    0xA3, 0xF1, 0xAF, 0x1A, 0xF9, 0x2A, 0xE2, 0xFC, 0x1F, 0xC2, 0x9E, 0x92, 0xFC, 0x1F, 0xC1, 0x9E,
+    0xA3, 0xFC, 0x1F, 0xC1, 0xF3, 0x9F, 0xA1, 0xFC, 0x0F, 0x4F, 0xC2, 0xFC, 0xAE, 0x93, 0x9F, 0xC2,
+    0xFF, 0x94, 0xFC, 0x92, 0xAF, 0xDA, 0x4F, 0xD4, 0xFD, 0x39, 0xFD, 0x94, 0xAF, 0xFF, 0xE9, 0x5A,
+    0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xD9, 0x6E, 0xA9, 0xFF, 0x97, 0x1D, 0x39, 0x99, 0x77, 0x77, 0x20,
+    0x79, 0xAA, 0xAA, 0x97, 0x70, 0xFC, 0x77, 0x0A, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xF7, 0x72, 0xAD,
+    0x97, 0x77, 0x77, 0x74, 0x9F, 0xA6, 0xAF, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x96, 0xFC, 0x3F, 0xC6,
+    0x9F, 0xA3, 0xFC, 0x6A, 0xF9, 0x29, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xC3,
+    0xFC, 0x69, 0xFA, 0x29, 0xFC, 0x6A, 0xF9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6,
+    0x9F, 0xA3, 0xFC, 0x6A, 0xFA, 0x29, 0xFA, 0x6F, 0xC9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x95, 0x9F,
+    0xC3, 0xAF, 0x95, 0xAF, 0xA3, 0xAF, 0xA4, 0x9F, 0xC4, 0x9F, 0xC9, 0x29, 0xFC, 0xA5, 0xFF, 0xFE,
+    0x6A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x97, 0x19, 0xFF, 0xA7, 0x79, 0x99, 0x73, 0x75, 0xAA, 0xAA,
+    0xA7, 0x7F, 0xC9, 0x76, 0xAF, 0x97, 0x69, 0xF9, 0x77, 0xF7, 0x70, 0xAD, 0xA7, 0x77, 0x77, 0x76,
+    0x9F, 0xA6, 0xAF, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A,
+    0xF9, 0x29, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xC3, 0xFC, 0x69, 0xFA, 0x29,
+    0xFC, 0x6A, 0xF9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A,
+    0xFA, 0x29, 0xFA, 0x6F, 0xC9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x95, 0x9F, 0xC3, 0xAF, 0x95, 0xAF,
+    0xA3, 0xAF, 0xA4, 0x9F, 0xC4, 0x9F, 0xC9, 0x29, 0xFC, 0xA5, 0xFF, 0xFE, 0x6A, 0xFF, 0xFC, 0x97,
+    0xAF, 0xFE, 0x97, 0x19, 0xFF, 0xA7, 0x79, 0x99, 0x73, 0x72, 0xAA, 0xAA, 0xA7, 0x7F, 0xE7, 0x5F,
+    0xF9, 0x73, 0xFA, 0x9F, 0x72, 0xF9, 0x19, 0xEA, 0x70, 0xAD, 0xA4, 0x9E, 0x77, 0x77, 0x77, 0x19,
+    0xFA, 0x6A, 0xF3, 0xAF, 0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF,
+    0x92, 0x9F, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F, 0xC6, 0x9F, 0xA2, 0x9F,
+    0xC6, 0xAF, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF,
+    0xA2, 0x9F, 0xA6, 0xFC, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC, 0x3A, 0xF9, 0x5A, 0xFA,
+    0x3A, 0xFA, 0x49, 0xFC, 0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A,
+    0xFF, 0xE9, 0x71, 0x9F, 0xFA, 0x77, 0x99, 0x97, 0x30, 0x77, 0x75, 0x9E, 0x2E, 0x97, 0x2F, 0x90,
+    0xAE, 0xA7, 0x2F, 0x90, 0xFA, 0x72, 0xAE, 0x1A, 0xE7, 0x59, 0x49, 0x77, 0x77, 0x77, 0x39, 0xFA,
+    0x6A, 0xF3, 0xAF, 0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0x92,
+    0x9F, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F, 0xC6, 0x9F, 0xA2, 0x9F, 0xC6,
+    0xAF, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0xA2,
+    0x9F, 0xA6, 0xFC, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC, 0x3A, 0xF9, 0x5A, 0xFA, 0x3A,
+    0xFA, 0x49, 0xFC, 0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF,
+    0xE9, 0x71, 0x9F, 0xFA, 0x77, 0x99, 0x97, 0x30, 0x71, 0x9A, 0xAA, 0xAA, 0x74, 0xFC, 0x97, 0x3F,
+    0xC9, 0x73, 0xAF, 0x74, 0x9F, 0x75, 0xEA, 0x77, 0x77, 0x75, 0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF,
+    0xC0, 0x9F, 0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3, 0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49,
+    0xF9, 0x1A, 0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7, 0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71,
+    0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x30, 0x5F, 0xA7,
+    0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFF, 0xCA, 0x97, 0x0F, 0xFE, 0xA6, 0x9F, 0xFF,
+    0xC5, 0xAF, 0xFF, 0xC9, 0x4F, 0xC2, 0x9F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC3, 0x9F, 0xC4, 0xFC, 0x39,
+    0xFA, 0x4F, 0xC3, 0xAF, 0x93, 0x9F, 0xC3, 0xFC, 0x4F, 0xCA, 0x3F, 0xC2, 0x9F, 0xD3, 0x9F, 0xFF,
+    0xDA, 0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xCA, 0x5F, 0xFE, 0xA7, 0xFC, 0x99, 0x73, 0x9F, 0xA7, 0x5A,
+    0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x77, 0x99, 0x99, 0x97, 0x72, 0x9F, 0xFC, 0x97, 0x6F, 0xFF,
+    0xA7, 0x4F, 0xFF, 0xDA, 0x72, 0x9F, 0xD9, 0x9A, 0xFD, 0x72, 0xFC, 0xA3, 0x9F, 0xC7, 0x2F, 0xC5,
+    0xFC, 0x71, 0x9F, 0xA5, 0xFC, 0x71, 0xAF, 0x94, 0xFC, 0xA7, 0x1F, 0xC3, 0xAF, 0xD7, 0x2F, 0xC2,
+    0xFE, 0x72, 0x9F, 0xA1, 0xFD, 0x97, 0x3A, 0xF9, 0x09, 0xFC, 0x75, 0xAF, 0x90, 0xAF, 0xA7, 0x5F,
+    0xC1, 0xAF, 0xC7, 0x5F, 0xC1, 0x9F, 0xD9, 0x72, 0x9F, 0xA2, 0xAF, 0xD9, 0x71, 0xAF, 0x93, 0xAF,
+    0xD9, 0x70, 0xFC, 0x59, 0xFD, 0x70, 0xFC, 0x69, 0xFC, 0x70, 0xFC, 0x7F, 0xC7, 0x9F, 0xA7, 0xFC,
+    0x7A, 0xF9, 0x0D, 0x99, 0x99, 0xFC, 0xA7, 0xFC, 0x1F, 0xFE, 0x70, 0xFC, 0x1F, 0xFD, 0x97, 0x9F,
+    0xC1, 0xAF, 0xEA, 0x71, 0x9F, 0xA4, 0x99, 0x97, 0x4A, 0xF9, 0x77, 0x4F, 0xC7, 0x74, 0xFD, 0x77,
+    0x1F, 0xF9, 0x77, 0x1F, 0xF7, 0x72, 0xFE, 0x77, 0x3F, 0xC9, 0x77, 0x30, 0x6A, 0xAA, 0xAA, 0x75,
+    0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x76, 0xAE, 0x97, 0x6A, 0xDA, 0x77, 0x76, 0x9A, 0x99, 0x74, 0xAF,
+    0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC,
+    0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA,
+    0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A,
+    0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7,
+    0x09, 0x74, 0x73, 0xAA, 0xAA, 0xA9, 0x73, 0xAF, 0xC7, 0x39, 0xFC, 0x74, 0xFA, 0x74, 0xAE, 0xA7,
+    0x49, 0xE9, 0x77, 0x77, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF, 0xCA,
+    0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2,
+    0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39,
+    0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49,
+    0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x70, 0xAA, 0xAA, 0xA9, 0x73, 0xAF,
+    0xD7, 0x2A, 0xFE, 0xA7, 0x0A, 0xF0, 0xF9, 0x6A, 0xEA, 0x2F, 0x5A, 0xE9, 0x4E, 0x97, 0x77, 0x29,
+    0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA, 0xAF, 0xD9,
+    0x2F, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC4,
+    0x9F, 0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF, 0xA3, 0xFC,
+    0xA2, 0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E, 0xA5, 0x9F,
+    0xC9, 0x0A, 0xEA, 0x70, 0x97, 0x40, 0x77, 0x99, 0x7A, 0xEA, 0x29, 0xD9, 0x5F, 0xEA, 0xAE, 0x59,
+    0xFF, 0xEA, 0x5E, 0x90, 0xAF, 0xD6, 0xD9, 0x3A, 0xCA, 0x97, 0x77, 0x49, 0xA9, 0x97, 0x4A, 0xFD,
+    0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA, 0xAF, 0xD9, 0x2F, 0xD2, 0x9F, 0xC9,
+    0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC4, 0x9F, 0x91, 0x9F, 0xA4,
+    0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF, 0xA3, 0xFC, 0xA2, 0x9F, 0xC2, 0xAF,
+    0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E, 0xA5, 0x9F, 0xC9, 0x0A, 0xEA, 0x70,
+    0x97, 0x40, 0x77, 0x71, 0xE2, 0xAD, 0x97, 0xAE, 0xA0, 0x9F, 0x7F, 0xA0, 0xAF, 0x7A, 0xE1, 0x9E,
+    0x97, 0x19, 0x49, 0x77, 0x75, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF,
+    0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F,
+    0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA,
+    0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD,
+    0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x70, 0x9E, 0x97, 0x4F, 0xDA,
+    0x72, 0x9D, 0xA9, 0xE9, 0x71, 0xAD, 0x2D, 0x97, 0x1A, 0xD2, 0xD9, 0x71, 0x9D, 0xA9, 0xE7, 0x3F,
+    0xDA, 0x74, 0x9D, 0xA9, 0x77, 0x76, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF,
+    0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA,
+    0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A,
+    0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF,
+    0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x69, 0xA9, 0x97, 0x09,
+    0xA9, 0x97, 0x0A, 0xFD, 0x1E, 0x9F, 0xE9, 0x5F, 0xFC, 0x9F, 0xFF, 0x93, 0xAF, 0xFF, 0xFF, 0xE2,
+    0x9F, 0xD9, 0xAF, 0xF9, 0x1F, 0xC2, 0xFC, 0xA2, 0xAF, 0xD3, 0x9F, 0x19, 0xFC, 0x39, 0xFC, 0x4A,
+    0xF1, 0xAF, 0x94, 0xFC, 0x3A, 0xFC, 0x1F, 0xC5, 0xFC, 0xAA, 0xAF, 0xD9, 0x1F, 0xC4, 0x9F, 0xFF,
+    0xC9, 0x19, 0xFA, 0x4A, 0xFF, 0xEA, 0x39, 0xF9, 0x4F, 0xEA, 0xA9, 0x95, 0xAF, 0x93, 0x9F, 0xC7,
+    0x3A, 0xFA, 0x3F, 0xD7, 0x39, 0xFC, 0x2A, 0xFD, 0xA5, 0x99, 0x3F, 0xDA, 0xFF, 0xCA, 0x99, 0x9A,
+    0xDA, 0x3F, 0xFF, 0xFF, 0xEA, 0x4F, 0xEA, 0x9F, 0xFF, 0xC9, 0x49, 0xFC, 0xA0, 0x9D, 0xA0, 0xFE,
+    0xA9, 0x70, 0x97, 0x29, 0x99, 0x70, 0x79, 0xAA, 0x99, 0x79, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF,
+    0xDA, 0x29, 0xFD, 0xA9, 0xAD, 0x92, 0xFD, 0x70, 0x9F, 0xC7, 0x1F, 0xC9, 0x71, 0xFC, 0x71, 0x9F,
+    0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1A, 0xFA, 0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x93, 0x9A, 0x3F,
+    0xEA, 0xEA, 0x39, 0xFF, 0xDA, 0x4A, 0xFF, 0xCA, 0x59, 0xFE, 0xA7, 0x9E, 0x97, 0x2F, 0x97, 0x2A,
+    0xF9, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x7F, 0xE9, 0x7F, 0xE7, 0x0A, 0xF9, 0x70, 0x6A, 0xAA, 0xA9,
+    0x73, 0xFC, 0x73, 0x9F, 0x97, 0x39, 0xF7, 0x4A, 0xE9, 0x74, 0xAD, 0xA7, 0x77, 0x39, 0x9A, 0x99,
+    0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC, 0xA1, 0x9F, 0xA1, 0xFC, 0x93, 0xFA,
+    0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA, 0xAA, 0xFE, 0x09, 0xFF, 0xFD, 0x19,
+    0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F, 0xA7, 0x29, 0xFC, 0x6A, 0x3F, 0xDA,
+    0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7, 0x19, 0x99, 0x70, 0x73, 0xAA, 0xAA,
+    0xA7, 0x3F, 0xCA, 0x72, 0xAF, 0xA7, 0x29, 0xF9, 0x73, 0xF9, 0x73, 0xAD, 0xA7, 0x77, 0x79, 0x9A,
+    0x99, 0x72, 0xAF, 0xEA, 0x69, 0xFF, 0xE4, 0x9F, 0xFF, 0x93, 0xFC, 0xA1, 0x9F, 0xA2, 0xFC, 0x93,
+    0xFA, 0x19, 0xFA, 0x4F, 0xA1, 0xAF, 0x92, 0x9F, 0xC9, 0x1F, 0xCA, 0xAA, 0xFE, 0x19, 0xFF, 0xFD,
+    0x29, 0xFF, 0xF9, 0x3A, 0xFD, 0xAA, 0xA9, 0x6A, 0xF9, 0x73, 0x9F, 0xA7, 0x39, 0xFC, 0x6A, 0x4F,
+    0xDA, 0x99, 0xAE, 0x49, 0xFF, 0xF5, 0xAF, 0xFE, 0x69, 0xFF, 0xA7, 0x29, 0x99, 0x70, 0x70, 0xAA,
+    0xAA, 0xA9, 0x72, 0xFE, 0x71, 0xFF, 0x97, 0xFA, 0x0F, 0x6F, 0x91, 0x9E, 0xA4, 0xAD, 0xA4, 0x9E,
+    0x77, 0x72, 0x99, 0xA9, 0x97, 0x2A, 0xFE, 0xA6, 0x9F, 0xFE, 0x49, 0xFF, 0xF9, 0x3F, 0xCA, 0x19,
+    0xFA, 0x2F, 0xC9, 0x3F, 0xA1, 0x9F, 0xA4, 0xFA, 0x1A, 0xF9, 0x29, 0xFC, 0x91, 0xFC, 0xAA, 0xAF,
+    0xE1, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0x93, 0xAF, 0xDA, 0xAA, 0x96, 0xAF, 0x97, 0x39, 0xFA, 0x73,
+    0x9F, 0xC6, 0xA4, 0xFD, 0xA9, 0x9A, 0xE4, 0x9F, 0xFF, 0x5A, 0xFF, 0xE6, 0x9F, 0xFA, 0x72, 0x99,
+    0x97, 0x00, 0x77, 0x69, 0xE2, 0xE6, 0xF9, 0x0F, 0xA5, 0xF9, 0x0F, 0x95, 0xF1, 0xAE, 0x79, 0x59,
+    0x77, 0x72, 0x99, 0xA9, 0x97, 0x1A, 0xFE, 0xA5, 0x9F, 0xFE, 0x39, 0xFF, 0xF9, 0x2F, 0xCA, 0x19,
+    0xFA, 0x1F, 0xC9, 0x3F, 0xA0, 0x9F, 0xA4, 0xFA, 0x0A, 0xF9, 0x29, 0xFC, 0x90, 0xFC, 0xAA, 0xAF,
+    0xE0, 0x9F, 0xFF, 0xD1, 0x9F, 0xFF, 0x92, 0xAF, 0xDA, 0xAA, 0x95, 0xAF, 0x97, 0x29, 0xFA, 0x72,
+    0x9F, 0xC6, 0xA3, 0xFD, 0xA9, 0x9A, 0xE3, 0x9F, 0xFF, 0x4A, 0xFF, 0xE5, 0x9F, 0xFA, 0x71, 0x99,
+    0x97, 0x2A, 0xAA, 0xAA, 0x4A, 0xF9, 0x4F, 0xA4, 0x9F, 0x59, 0xEA, 0x59, 0xDA, 0x77, 0x7A, 0xF9,
+    0x3F, 0xC4, 0xFC, 0x39, 0xFA, 0x3A, 0xF9, 0x3F, 0xC4, 0xFC, 0x4F, 0xC3, 0x9F, 0xA3, 0xAF, 0x93,
+    0xFC, 0x4F, 0xC4, 0xFA, 0x39, 0xFA, 0x3A, 0xF9, 0x3F, 0xC4, 0xFC, 0x39, 0xFA, 0x30, 0x79, 0xAA,
+    0xAA, 0x96, 0x9F, 0xC7, 0xFC, 0x7F, 0xC7, 0xAE, 0xA7, 0x0E, 0x97, 0x77, 0x74, 0xAF, 0x97, 0xFC,
+    0x70, 0xFC, 0x79, 0xFA, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0xAF, 0x97,
+    0xFC, 0x70, 0xFC, 0x70, 0xFA, 0x79, 0xFA, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0x49,
+    0xAA, 0xAA, 0xA6, 0xAF, 0xD9, 0x4A, 0xFF, 0x3A, 0xF0, 0xAE, 0x91, 0xAE, 0xA2, 0xF0, 0x9E, 0x94,
+    0xAD, 0xA7, 0x77, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0xAF, 0x97, 0xFC, 0x70, 0xFC,
+    0x70, 0xFC, 0x79, 0xFA, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0F, 0xA7, 0x9F, 0xA7, 0xAF, 0x97,
+    0xFC, 0x70, 0xFC, 0x79, 0xFA, 0x70, 0x77, 0xE9, 0x1A, 0xDA, 0x1A, 0xEA, 0x09, 0xF1, 0xAE, 0xA0,
+    0x9F, 0x19, 0xE2, 0xE9, 0x39, 0x49, 0x77, 0x77, 0xAF, 0x96, 0xFC, 0x7F, 0xC6, 0x9F, 0xA6, 0xAF,
+    0x96, 0xFC, 0x7F, 0xC7, 0xFC, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x7F, 0xA6, 0x9F, 0xA6,
+    0xAF, 0x96, 0xFC, 0x7F, 0xC6, 0x9F, 0xA6, 0x77, 0x71, 0xAC, 0xA3, 0xD7, 0x9F, 0x9A, 0xEA, 0x6A,
+    0xFF, 0xC9, 0x79, 0xFD, 0x97, 0x09, 0xFE, 0x70, 0xAF, 0xFC, 0x7A, 0xE0, 0xAF, 0x70, 0xC9, 0x2F,
+    0xA7, 0x4A, 0xF5, 0xAF, 0xC9, 0x9F, 0x39, 0xFF, 0xAF, 0x29, 0xFF, 0xFD, 0x2F, 0xDA, 0xAF, 0xE1,
+    0xFD, 0x3F, 0xD1, 0xFC, 0x4A, 0xFC, 0x09, 0xFA, 0x49, 0xFC, 0x0A, 0xF9, 0x4A, 0xFA, 0x0F, 0xC5,
+    0xAF, 0x90, 0xFC, 0x5F, 0xC1, 0xFC, 0x49, 0xFC, 0x1A, 0xF9, 0x3F, 0xC9, 0x19, 0xFC, 0xA9, 0xAF,
+    0xCA, 0x3F, 0xFF, 0xC5, 0xFF, 0xE7, 0xAF, 0xE9, 0x73, 0x99, 0x97, 0x00, 0x77, 0x19, 0x70, 0x9F,
+    0x92, 0xE6, 0x9F, 0xEA, 0xE9, 0x6F, 0xFF, 0x69, 0xDA, 0x09, 0xFD, 0x96, 0xAD, 0x39, 0xAC, 0xA7,
+    0x77, 0x72, 0x9A, 0x99, 0x7A, 0xE1, 0xAF, 0xCA, 0x6F, 0x0A, 0xFE, 0xA5, 0xFA, 0xFF, 0xC4, 0x9F,
+    0xE9, 0xAF, 0xC9, 0x3A, 0xFC, 0xA2, 0xAF, 0x93, 0xAF, 0xC3, 0xAF, 0x93, 0xFC, 0x93, 0xAF, 0x93,
+    0xFC, 0x4F, 0xC3, 0x9F, 0xA4, 0xFC, 0x3A, 0xF9, 0x4F, 0xA3, 0xFC, 0x49, 0xF9, 0x3F, 0xC4, 0xAF,
+    0x93, 0xFA, 0x4F, 0xC3, 0x9F, 0x94, 0xFC, 0x3A, 0xF4, 0x9F, 0xA3, 0xFC, 0x49, 0xF9, 0x3F, 0xC4,
+    0xAF, 0x39, 0xFA, 0x4F, 0xC3, 0x59, 0xAA, 0xAA, 0x97, 0x4F, 0xC7, 0x49, 0xF7, 0x5A, 0xEA, 0x75,
+    0xF7, 0x6A, 0xD9, 0x77, 0x75, 0x9A, 0xA9, 0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x39,
+    0xFD, 0xAA, 0xFC, 0x92, 0xFC, 0xA2, 0x9F, 0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC1, 0xFC,
+    0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF, 0x94, 0xFC,
+    0x90, 0x9F, 0xA3, 0x9F, 0xC1, 0x9F, 0xC2, 0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF, 0xF5, 0xAF,
+    0xFD, 0x79, 0xFE, 0x97, 0x39, 0x99, 0x70, 0x73, 0xAA, 0xAA, 0xA7, 0x3F, 0xCA, 0x72, 0xAF, 0xA7,
+    0x29, 0xF9, 0x73, 0xF9, 0x73, 0xAD, 0xA7, 0x77, 0x79, 0xAA, 0x97, 0x29, 0xFF, 0x7A, 0xFF, 0xD9,
+    0x4A, 0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9, 0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC, 0x4F, 0xC1, 0xFC,
+    0x94, 0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A, 0xF9, 0x49, 0xFA,
+    0x0A, 0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39, 0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2, 0xFD, 0xAF, 0xE3,
+    0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9, 0x73, 0x99, 0x97, 0x00, 0x70, 0xAA, 0xAA, 0xA9, 0x72,
+    0xFE, 0x71, 0xFF, 0x97, 0xFA, 0x0F, 0x6F, 0x91, 0x9E, 0xA4, 0xAD, 0xA4, 0x9E, 0x77, 0x72, 0x9A,
+    0xA9, 0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x39, 0xFD, 0xAA, 0xFC, 0x92, 0xFC, 0xA2,
+    0x9F, 0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09,
+    0xFA, 0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF, 0x94, 0xFC, 0x90, 0x9F, 0xA3, 0x9F, 0xC1, 0x9F,
+    0xC2, 0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF, 0xF5, 0xAF, 0xFD, 0x79, 0xFE, 0x97, 0x39, 0x99,
+    0x70, 0x77, 0x99, 0x69, 0xF9, 0x2A, 0xD6, 0xFE, 0xAA, 0xE5, 0xAF, 0xFE, 0x95, 0xE1, 0xAF, 0xCA,
+    0x59, 0xD4, 0xAC, 0xA9, 0x77, 0x75, 0x9A, 0xA9, 0x73, 0x9F, 0xF7, 0x0A, 0xFF, 0xD9, 0x5A, 0xFF,
+    0xF4, 0x9F, 0xDA, 0xAF, 0xC9, 0x3F, 0xCA, 0x29, 0xFC, 0x29, 0xFC, 0x4F, 0xC2, 0xFC, 0x94, 0xFC,
+    0x2F, 0xC5, 0xFC, 0x19, 0xFA, 0x5F, 0xC1, 0x9F, 0xA5, 0xFC, 0x1A, 0xF9, 0x49, 0xFA, 0x1A, 0xF9,
+    0x4F, 0xC9, 0x19, 0xFA, 0x39, 0xFC, 0x29, 0xFC, 0x29, 0xFC, 0xA3, 0xFD, 0xAF, 0xE4, 0x9F, 0xFF,
+    0x6A, 0xFF, 0xD7, 0x09, 0xFE, 0x97, 0x49, 0x99, 0x71, 0x77, 0x79, 0xDA, 0x2E, 0x7F, 0x90, 0xFA,
+    0x6F, 0x1F, 0x96, 0xEA, 0x1A, 0xE7, 0x09, 0x59, 0x77, 0x74, 0x9A, 0xA9, 0x72, 0x9F, 0xF7, 0xAF,
+    0xFD, 0x94, 0xAF, 0xFF, 0x39, 0xFD, 0xAA, 0xFC, 0x92, 0xFC, 0xA2, 0x9F, 0xC1, 0x9F, 0xC4, 0xFC,
+    0x1F, 0xC9, 0x4F, 0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0xAF, 0x94,
+    0x9F, 0xA0, 0xAF, 0x94, 0xFC, 0x90, 0x9F, 0xA3, 0x9F, 0xC1, 0x9F, 0xC2, 0x9F, 0xCA, 0x2F, 0xDA,
+    0xFE, 0x39, 0xFF, 0xF5, 0xAF, 0xFD, 0x79, 0xFE, 0x97, 0x39, 0x99, 0x70, 0x69, 0xD9, 0x73, 0x9F,
+    0x73, 0x9F, 0x73, 0x9F, 0x74, 0xAD, 0x97, 0x77, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF7, 0x77, 0x09, 0x97, 0x5F, 0x73, 0x9F, 0x73, 0x9F,
+    0x74, 0xEA, 0x75, 0x99, 0x60, 0x77, 0x73, 0x9A, 0xA9, 0x19, 0xA7, 0x9F, 0xFE, 0x5A, 0xFF, 0xEA,
+    0x4A, 0xFF, 0xF4, 0x9F, 0xCA, 0x99, 0xFC, 0x93, 0xFC, 0x29, 0xFD, 0x29, 0xFA, 0x19, 0xFE, 0x2F,
+    0xC2, 0xFF, 0x2F, 0xA1, 0xFF, 0xC1, 0x9F, 0xA0, 0xAE, 0x0F, 0xC1, 0x9F, 0x99, 0xE1, 0xFC, 0x1A,
+    0xFA, 0xE9, 0x09, 0xFA, 0x1A, 0xFE, 0xA1, 0xAF, 0x91, 0x9F, 0xDA, 0x2F, 0xC2, 0x9F, 0xD2, 0xFC,
+    0xA3, 0xFD, 0xAA, 0xFD, 0x4A, 0xFF, 0xF5, 0xFF, 0xF5, 0xFF, 0xE9, 0x6A, 0xD2, 0x99, 0x97, 0x29,
+    0x77, 0x6A, 0xAA, 0xAA, 0x75, 0xAF, 0x97, 0x5F, 0xA7, 0x59, 0xF7, 0x69, 0xE9, 0x76, 0x9D, 0xA7,
+    0x77, 0x77, 0x5F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2,
+    0xAF, 0x49, 0xFA, 0x2F, 0xC4, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F,
+    0xA2, 0xFC, 0x4A, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD, 0x3F, 0xC2,
+    0xAF, 0xCA, 0x3F, 0xDA, 0xFE, 0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC, 0x91, 0xF7,
+    0x99, 0x74, 0x73, 0xAA, 0xAA, 0xA9, 0x73, 0xAF, 0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x4A, 0xEA, 0x74,
+    0x9E, 0x97, 0x77, 0x77, 0x6F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9,
+    0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F, 0xC4, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A,
+    0xF9, 0x4F, 0xA2, 0xFC, 0x4A, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD,
+    0x3F, 0xC2, 0xAF, 0xCA, 0x3F, 0xDA, 0xFE, 0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC,
+    0x91, 0xF7, 0x99, 0x74, 0x70, 0x9A, 0xAA, 0xA9, 0x73, 0xAF, 0xD9, 0x71, 0xAF, 0xF7, 0x0A, 0xF0,
+    0xF9, 0x6A, 0xEA, 0x2F, 0x59, 0xE9, 0x4E, 0x97, 0x77, 0x77, 0x1F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A,
+    0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F, 0xC4, 0xAF, 0x92, 0xFC,
+    0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x4A, 0xFA, 0x2F, 0xC4, 0xFC, 0x92,
+    0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD, 0x3F, 0xC2, 0xAF, 0xCA, 0x3F, 0xDA, 0xFE, 0x93, 0xFF, 0xC9,
+    0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC, 0x91, 0xF7, 0x99, 0x74, 0x77, 0x71, 0xE9, 0x1A, 0xD9, 0x7A,
+    0xEA, 0x09, 0xF7, 0xAE, 0xA0, 0xAF, 0x79, 0xE1, 0x9E, 0x97, 0x19, 0x49, 0x77, 0x77, 0x74, 0xFC,
+    0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2,
+    0xFC, 0x4A, 0xF9, 0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0xAF,
+    0xA2, 0xFC, 0x4F, 0xC9, 0x2F, 0xA3, 0x9F, 0xC3, 0xFA, 0x3F, 0xD3, 0xFC, 0x2A, 0xFC, 0xA3, 0xFD,
+    0xAF, 0xE9, 0x3F, 0xFC, 0x9F, 0x49, 0xFE, 0xA0, 0xF5, 0x9F, 0xC9, 0x1F, 0x79, 0x97, 0x40, 0x75,
+    0x9A, 0xAA, 0xA9, 0x77, 0x9F, 0xC7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xAE, 0xA7, 0x71, 0xE9,
+    0x77, 0x77, 0x77, 0x72, 0xFA, 0x5A, 0xFA, 0x5F, 0xA5, 0xFC, 0x6F, 0xC4, 0xAF, 0xA6, 0xFC, 0x4F,
+    0xC7, 0xAF, 0x3A, 0xFA, 0x79, 0xF3, 0xFC, 0x70, 0x9F, 0x2A, 0xF9, 0x71, 0xF9, 0x1F, 0xC7, 0x2F,
+    0x90, 0xAF, 0x97, 0x2F, 0x90, 0xFC, 0x73, 0xFA, 0x9F, 0x97, 0x3A, 0xEA, 0xAF, 0x74, 0x9E, 0xAF,
+    0x97, 0x49, 0xFE, 0xA7, 0x6F, 0xE7, 0x7F, 0xDA, 0x77, 0xFD, 0x77, 0x0A, 0xFA, 0x77, 0x0F, 0xC7,
+    0x70, 0xAF, 0xA7, 0x79, 0xFC, 0x77, 0x9F, 0xC9, 0x73, 0x9F, 0xFA, 0x74, 0x9F, 0xF7, 0x59, 0xFD,
+    0xA7, 0x7F, 0xA7, 0x70, 0x79, 0x99, 0x99, 0x77, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC,
+    0x77, 0xFC, 0x76, 0x9F, 0xA7, 0x69, 0xF9, 0x19, 0xA9, 0x71, 0xAF, 0x0A, 0xFC, 0x97, 0xFC, 0xAF,
+    0xE7, 0xFF, 0xFD, 0x59, 0xFD, 0xAA, 0xFD, 0x5A, 0xFC, 0x92, 0xFC, 0x94, 0xFC, 0xA3, 0xFC, 0x94,
+    0xFC, 0x4A, 0xF9, 0x4F, 0xA4, 0xFC, 0x93, 0x9F, 0x94, 0xFC, 0x4A, 0xF5, 0xFC, 0x4F, 0xC4, 0x9F,
+    0xC4, 0xFC, 0x4F, 0xCA, 0x4F, 0xC3, 0x9F, 0xC4, 0x9F, 0xC9, 0x2F, 0xCA, 0x4A, 0xFF, 0xFD, 0x5F,
+    0xFF, 0xD9, 0x5F, 0xAA, 0xFE, 0x95, 0x9F, 0xA0, 0xAF, 0xC9, 0x6A, 0xF9, 0x29, 0x97, 0x1A, 0xF7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x60, 0x77, 0x77,
+    0xAD, 0x91, 0xAD, 0xA7, 0x39, 0xF1, 0xF7, 0x3A, 0xF0, 0x9F, 0x73, 0x9E, 0x91, 0xEA, 0x75, 0x94,
+    0x97, 0x77, 0x77, 0x77, 0x0F, 0xA5, 0xAF, 0xA5, 0xFA, 0x5F, 0xC6, 0xFC, 0x4A, 0xFA, 0x6F, 0xC4,
+    0xFC, 0x7A, 0xF3, 0xAF, 0xA7, 0x9F, 0x3F, 0xC7, 0x09, 0xF2, 0xAF, 0x97, 0x1F, 0x91, 0xFC, 0x72,
+    0xF9, 0x0A, 0xF9, 0x72, 0xF9, 0x0F, 0xC7, 0x3F, 0xA9, 0xF9, 0x73, 0xAE, 0xAA, 0xF7, 0x49, 0xEA,
+    0xF9, 0x74, 0x9F, 0xEA, 0x76, 0xFE, 0x77, 0xFD, 0xA7, 0x7F, 0xD7, 0x70, 0xAF, 0xA7, 0x70, 0xFC,
+    0x77, 0x0A, 0xFA, 0x77, 0x9F, 0xC7, 0x79, 0xFC, 0x97, 0x39, 0xFF, 0xA7, 0x49, 0xFF, 0x75, 0x9F,
+    0xDA, 0x77, 0xFA, 0x77, 0x00, 0x73, 0x99, 0x99, 0x99, 0x99, 0x99, 0x72, 0xAF, 0xFC, 0x97, 0x2F,
+    0xFD, 0x73, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x0A, 0xFC, 0x97, 0x6F, 0xDA, 0x75, 0xAF, 0xE7, 0x49,
+    0xFF, 0x74, 0xFA, 0xF7, 0x39, 0xF9, 0xF7, 0x3F, 0xA0, 0xF7, 0x29, 0xF9, 0x0F, 0x97, 0x1F, 0xC1,
+    0xF9, 0x70, 0x9F, 0x91, 0xF9, 0x70, 0xFC, 0x2F, 0xA7, 0x9F, 0x92, 0xAE, 0xA7, 0xFC, 0x3A, 0xF6,
+    0x9F, 0x93, 0xAF, 0x6F, 0xFF, 0xE5, 0xAF, 0xFF, 0xE5, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x93, 0xFC,
+    0x99, 0x99, 0x99, 0x9A, 0xF9, 0x2A, 0xF9, 0x7F, 0x92, 0xFC, 0x70, 0xFA, 0x1A, 0xF9, 0x70, 0xFA,
+    0x1F, 0xC7, 0x1F, 0xC0, 0xAF, 0x97, 0x1F, 0xC0, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0xAF, 0xFC,
+    0xA7, 0xFF, 0xD9, 0x7F, 0xFD, 0x77, 0x74, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3,
+    0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A,
+    0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC,
+    0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4,
+    0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x72, 0xAA, 0x94,
+    0x9A, 0xA7, 0x29, 0xE4, 0xE7, 0x3F, 0xAA, 0xAE, 0xA7, 0x3F, 0xFD, 0x75, 0xFF, 0x97, 0x69, 0xAD,
+    0xA9, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xC9, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F,
+    0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F, 0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19,
+    0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70, 0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9,
+    0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE, 0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99,
+    0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9, 0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC,
+    0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x10, 0x5A, 0xAA, 0x5A, 0xA9, 0x6E, 0x4E, 0x96, 0xFA, 0xAA,
+    0xF7, 0xAF, 0xFC, 0x97, 0x0A, 0xFE, 0x97, 0x29, 0xAD, 0xA9, 0x77, 0x76, 0x9A, 0x99, 0x74, 0xAF,
+    0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC,
+    0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA,
+    0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A,
+    0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7,
+    0x09, 0x74, 0x73, 0xAF, 0xC9, 0x75, 0xFD, 0xA7, 0x4A, 0xFE, 0x73, 0x9F, 0xF7, 0x3F, 0xAF, 0x72,
+    0x9F, 0x9F, 0x72, 0xFA, 0x0F, 0x71, 0x9F, 0x90, 0xF9, 0x70, 0xFC, 0x1F, 0x97, 0x9F, 0x91, 0xF9,
+    0x7F, 0xC2, 0xFA, 0x69, 0xF9, 0x2A, 0xEA, 0x6F, 0xC3, 0xAF, 0x59, 0xF9, 0x3A, 0xF5, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0xAF, 0xFF, 0xF9, 0x2F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x91,
+    0xAF, 0x97, 0xF9, 0x1F, 0xC7, 0x0F, 0xA0, 0xAF, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0xAF, 0x97,
+    0x1F, 0xC7, 0x6A, 0xDA, 0x77, 0xEA, 0x77, 0xF7, 0x79, 0xE9, 0x77, 0x9E, 0x97, 0x79, 0xFD, 0x76,
+    0xFD, 0x77, 0xAE, 0xA7, 0x76, 0x69, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF,
+    0xFC, 0xA2, 0x9F, 0xDA, 0xAF, 0xD9, 0x2F, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4,
+    0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC4, 0x9F, 0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF,
+    0xA3, 0x9F, 0xC2, 0xAF, 0xA3, 0xFC, 0xA2, 0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF,
+    0xD4, 0x9F, 0xEA, 0x9E, 0xA5, 0x9F, 0xC9, 0x0A, 0xEA, 0x70, 0x92, 0x9E, 0x75, 0xAE, 0x75, 0x9E,
+    0x76, 0xEA, 0x76, 0xF7, 0x6F, 0xD9, 0x73, 0xAF, 0xC9, 0x74, 0xAF, 0x77, 0x70, 0x76, 0xAA, 0xAA,
+    0xA7, 0x6F, 0xCA, 0x75, 0xAF, 0xA7, 0x59, 0xF9, 0x76, 0xF9, 0x76, 0xAE, 0x77, 0x77, 0x77, 0x70,
+    0x9F, 0xEA, 0x97, 0x09, 0xFF, 0xF9, 0x5F, 0xFF, 0xD9, 0x4F, 0xFF, 0xE4, 0xAF, 0xDA, 0x29, 0xAD,
+    0x93, 0x9F, 0xCA, 0x79, 0x4F, 0xD7, 0x59, 0xFC, 0x76, 0xFC, 0xA7, 0x6F, 0xC7, 0x69, 0xFA, 0x76,
+    0xAF, 0x97, 0x6F, 0xC9, 0x76, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x97, 0x6F, 0xCA, 0x76,
+    0xAF, 0xC7, 0x7F, 0xD9, 0x39, 0xAC, 0x95, 0xFF, 0xFD, 0x96, 0xFF, 0xFC, 0x97, 0xFF, 0xF9, 0x70,
+    0xAF, 0xFA, 0x97, 0x49, 0x99, 0x71, 0x72, 0xAA, 0xAA, 0xA7, 0x2F, 0xCA, 0x71, 0xAF, 0xA7, 0x19,
+    0xF9, 0x72, 0xF9, 0x72, 0xAE, 0x77, 0x76, 0x9A, 0xA9, 0x97, 0x09, 0xFF, 0xC5, 0xAF, 0xFD, 0x4A,
+    0xFF, 0xDA, 0x39, 0xFD, 0xA9, 0xAD, 0x93, 0xFD, 0x71, 0x9F, 0xC7, 0x2F, 0xC9, 0x72, 0xFC, 0x72,
+    0x9F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0xA7, 0x2A, 0xFA, 0x72, 0x9F, 0xA7, 0x29, 0xFC, 0x93, 0x9A,
+    0x4F, 0xEA, 0xEA, 0x49, 0xFF, 0xDA, 0x5A, 0xFF, 0xCA, 0x69, 0xFE, 0xA7, 0x29, 0x99, 0x70, 0x73,
+    0xAA, 0xAA, 0xA9, 0x75, 0xFE, 0x74, 0xFF, 0x97, 0x2F, 0xA0, 0xF7, 0x1F, 0x91, 0x9E, 0xA7, 0xAD,
+    0xA4, 0x9E, 0x77, 0x77, 0x77, 0x39, 0xFE, 0xA9, 0x70, 0x9F, 0xFF, 0x95, 0xFF, 0xFD, 0x94, 0xFF,
+    0xFE, 0x4A, 0xFD, 0xA2, 0x9A, 0xD9, 0x39, 0xFC, 0xA7, 0x94, 0xFD, 0x75, 0x9F, 0xC7, 0x6F, 0xCA,
+    0x76, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7,
+    0x7F, 0xC9, 0x76, 0xFC, 0xA7, 0x6A, 0xFC, 0x77, 0xFD, 0x93, 0x9A, 0xC9, 0x5F, 0xFF, 0xD9, 0x6F,
+    0xFF, 0xC9, 0x7F, 0xFF, 0x97, 0x0A, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x10, 0x7A, 0xAA, 0xAA, 0x97,
+    0x1F, 0xE7, 0x0F, 0xF9, 0x6F, 0xA0, 0xF5, 0xF9, 0x19, 0xEA, 0x3A, 0xDA, 0x49, 0xE7, 0x77, 0x19,
+    0xAA, 0x99, 0x70, 0x9F, 0xFC, 0x5A, 0xFF, 0xD4, 0xAF, 0xFD, 0xA3, 0x9F, 0xDA, 0x9A, 0xD9, 0x3F,
+    0xD7, 0x19, 0xFC, 0x72, 0xFC, 0x97, 0x2F, 0xC7, 0x29, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xFA, 0x72,
+    0xAF, 0xA7, 0x29, 0xFA, 0x72, 0x9F, 0xC9, 0x39, 0xA4, 0xFE, 0xAE, 0xA4, 0x9F, 0xFD, 0xA5, 0xAF,
+    0xFC, 0xA6, 0x9F, 0xEA, 0x72, 0x99, 0x97, 0x75, 0x97, 0x71, 0xAE, 0xA7, 0x69, 0xFC, 0x76, 0x9F,
+    0xC7, 0x7F, 0x97, 0x70, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x9F, 0xEA, 0x97, 0x09, 0xFF, 0xF9, 0x5F,
+    0xFF, 0xD9, 0x4F, 0xFF, 0xE4, 0xAF, 0xDA, 0x29, 0xAD, 0x93, 0x9F, 0xCA, 0x79, 0x4F, 0xD7, 0x59,
+    0xFC, 0x76, 0xFC, 0xA7, 0x6F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC9, 0x76, 0xFC, 0x77,
+    0xFC, 0x77, 0xFC, 0x77, 0xFC, 0x97, 0x6F, 0xCA, 0x76, 0xAF, 0xC7, 0x7F, 0xD9, 0x39, 0xAC, 0x95,
+    0xFF, 0xFD, 0x96, 0xFF, 0xFC, 0x97, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x97, 0x49, 0x99, 0x71, 0x71,
+    0x97, 0x4A, 0xEA, 0x71, 0x9F, 0xC7, 0x19, 0xFC, 0x72, 0xF9, 0x73, 0xAA, 0x97, 0x77, 0x39, 0xAA,
+    0x99, 0x79, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF, 0xDA, 0x29, 0xFD, 0xA9, 0xAD, 0x92, 0xFD, 0x70,
+    0x9F, 0xC7, 0x1F, 0xC9, 0x71, 0xFC, 0x71, 0x9F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0xA7, 0x1A, 0xFA,
+    0x71, 0x9F, 0xA7, 0x19, 0xFC, 0x93, 0x9A, 0x3F, 0xEA, 0xEA, 0x39, 0xFF, 0xDA, 0x4A, 0xFF, 0xCA,
+    0x59, 0xFE, 0xA7, 0x19, 0x99, 0x60, 0x79, 0xAA, 0x95, 0xAA, 0xA9, 0x79, 0xEA, 0x29, 0xEA, 0x71,
+    0xAE, 0x90, 0xAE, 0xA7, 0x3F, 0xFA, 0x74, 0xAF, 0xDA, 0x76, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x19,
+    0xFE, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x5A, 0xFD, 0xA2, 0x9A, 0xD9,
+    0x49, 0xFC, 0xA7, 0x95, 0xFD, 0x76, 0x9F, 0xC7, 0x7F, 0xCA, 0x77, 0xFC, 0x77, 0x9F, 0xA7, 0x7A,
+    0xF9, 0x77, 0xFC, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x97, 0x7F, 0xCA,
+    0x77, 0xAF, 0xC7, 0x70, 0xFD, 0x93, 0x9A, 0xC9, 0x6F, 0xFF, 0xD9, 0x7F, 0xFF, 0xC9, 0x70, 0xFF,
+    0xF9, 0x71, 0xAF, 0xFA, 0x97, 0x59, 0x99, 0x72, 0x39, 0xAA, 0x95, 0xAA, 0xA9, 0x39, 0xEA, 0x29,
+    0xEA, 0x5A, 0xE9, 0x0A, 0xEA, 0x7F, 0xFA, 0x70, 0xAF, 0xDA, 0x72, 0xFC, 0xA7, 0x77, 0x69, 0xAA,
+    0x99, 0x71, 0x9F, 0xFC, 0x6A, 0xFF, 0xD5, 0xAF, 0xFD, 0xA4, 0x9F, 0xDA, 0x9A, 0xD9, 0x4F, 0xD7,
+    0x29, 0xFC, 0x73, 0xFC, 0x97, 0x3F, 0xC7, 0x39, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xFA, 0x73, 0xAF,
+    0xA7, 0x39, 0xFA, 0x73, 0x9F, 0xC9, 0x39, 0xA5, 0xFE, 0xAE, 0xA5, 0x9F, 0xFD, 0xA6, 0xAF, 0xFC,
+    0xA7, 0x9F, 0xEA, 0x73, 0x99, 0x97, 0x00, 0x70, 0xAA, 0xA9, 0x49, 0xAA, 0xA7, 0x1A, 0xE9, 0x2A,
+    0xE9, 0x72, 0xF1, 0xF9, 0x73, 0x9F, 0xF9, 0x75, 0xFE, 0x97, 0x69, 0xFC, 0xA7, 0x77, 0x77, 0x77,
+    0x0F, 0xEA, 0xA9, 0x73, 0x9F, 0xFE, 0xA7, 0x1A, 0xFF, 0xFC, 0x70, 0xFF, 0xFE, 0x7F, 0xC9, 0x99,
+    0xAF, 0xDA, 0x6F, 0xC4, 0xFD, 0x59, 0xFA, 0x5F, 0xC5, 0xAF, 0x95, 0xFC, 0x94, 0xFC, 0x6A, 0xF9,
+    0x4F, 0xC6, 0xAF, 0xA3, 0x9F, 0xC6, 0xAF, 0xA3, 0x9F, 0xA6, 0xAF, 0x93, 0xAF, 0x96, 0xFC, 0x93,
+    0xFC, 0x7F, 0xC4, 0xFC, 0x69, 0xFC, 0x39, 0xFA, 0x6F, 0xCA, 0x3A, 0xF9, 0x59, 0xFC, 0x4F, 0xC9,
+    0x49, 0xFC, 0xA4, 0xFC, 0x49, 0xFD, 0x5F, 0xC1, 0x99, 0xFE, 0x94, 0x9F, 0xFF, 0xE9, 0x5A, 0xFF,
+    0xFD, 0x96, 0xFF, 0xFC, 0xA7, 0x0F, 0xFD, 0xA9, 0x71, 0x76, 0x99, 0x99, 0x29, 0x99, 0x99, 0x75,
+    0x9F, 0xA1, 0xF9, 0x75, 0xAF, 0x90, 0xAF, 0x76, 0xFC, 0x1F, 0x77, 0xFC, 0x09, 0xE9, 0x77, 0xFA,
+    0x0E, 0x97, 0x79, 0xFA, 0x76, 0x9A, 0x99, 0x1A, 0xF9, 0x74, 0x9F, 0xCA, 0x0A, 0xF7, 0x4A, 0xFE,
+    0xAF, 0xC7, 0x3A, 0xFF, 0xFC, 0xA7, 0x29, 0xFD, 0x9A, 0xFD, 0x97, 0x2F, 0xCA, 0x29, 0xFC, 0x72,
+    0x9F, 0xC4, 0xFC, 0x72, 0xAF, 0x94, 0xFC, 0x72, 0xFC, 0x5F, 0xA7, 0x2F, 0xC5, 0xF9, 0x71, 0x9F,
+    0xA4, 0x9F, 0x72, 0x9F, 0x94, 0xAF, 0x72, 0xAF, 0x94, 0xFA, 0x72, 0xAF, 0xA3, 0xAF, 0xA7, 0x29,
+    0xFC, 0x29, 0xFC, 0x97, 0x3F, 0xDA, 0xFE, 0x74, 0xFF, 0xFD, 0x75, 0xFF, 0x9E, 0xA7, 0x59, 0xFC,
+    0xA0, 0x9E, 0x97, 0x70, 0x99, 0x77, 0x30, 0x5F, 0xEA, 0xA9, 0x72, 0x9F, 0xFE, 0xA7, 0x0A, 0xFF,
+    0xFC, 0x7F, 0xFF, 0xE6, 0xFC, 0x99, 0x9A, 0xFD, 0xA5, 0xFC, 0x4F, 0xD4, 0x9F, 0xA5, 0xFC, 0x4A,
+    0xF9, 0x5F, 0xC9, 0x3F, 0xC6, 0xAF, 0x93, 0xFC, 0x6A, 0xFA, 0x0A, 0xFF, 0xD9, 0x2A, 0xFA, 0x0F,
+    0xFE, 0x92, 0xAF, 0x90, 0xFF, 0xE3, 0xFC, 0x99, 0xFF, 0xE3, 0xFC, 0x19, 0x9F, 0xC9, 0x99, 0x39,
+    0xFC, 0x29, 0xFA, 0x6F, 0xCA, 0x2A, 0xF9, 0x59, 0xFC, 0x3F, 0xC9, 0x49, 0xFC, 0xA3, 0xFC, 0x49,
+    0xFD, 0x4F, 0xC1, 0x99, 0xFE, 0x93, 0x9F, 0xFF, 0xE9, 0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA7,
+    0xFF, 0xDA, 0x97, 0x00, 0x76, 0x99, 0x99, 0x77, 0x09, 0xFA, 0x77, 0xAF, 0x97, 0x29, 0xAA, 0xAA,
+    0xFD, 0xA9, 0x70, 0xFF, 0xF9, 0x70, 0xFF, 0xF7, 0x1A, 0xAA, 0xAA, 0xFA, 0xAA, 0x75, 0xAF, 0x97,
+    0x19, 0xA9, 0x2A, 0xF7, 0x0A, 0xFC, 0xA0, 0xFC, 0x7F, 0xFA, 0xFA, 0x6F, 0xFF, 0xD9, 0x5A, 0xFD,
+    0x9A, 0xFD, 0x6F, 0xCA, 0x29, 0xFC, 0x5A, 0xFA, 0x4F, 0xC5, 0xFC, 0x5F, 0xA5, 0xFC, 0x5F, 0x94,
+    0x9F, 0xA4, 0x9F, 0x59, 0xFA, 0x4A, 0xF5, 0xAF, 0x94, 0xFA, 0x59, 0xFA, 0x3A, 0xFA, 0x59, 0xFC,
+    0x29, 0xFC, 0x96, 0xFD, 0xAF, 0xE7, 0xFF, 0xFD, 0x70, 0xFF, 0x9E, 0xA7, 0x1F, 0xCA, 0x1E, 0x97,
+    0x39, 0x97, 0x60, 0x79, 0x99, 0x99, 0x99, 0x99, 0x97, 0x1A, 0xFF, 0xC9, 0x70, 0xFF, 0xD7, 0x1F,
+    0xFD, 0x77, 0x77, 0x77, 0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F,
+    0xC9, 0x99, 0x99, 0x99, 0x96, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x99,
+    0x99, 0x99, 0x99, 0x59, 0xFF, 0xFA, 0x59, 0xFF, 0xF9, 0x5A, 0xFF, 0xF6, 0xFC, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F,
+    0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x94, 0x59, 0x99, 0x99, 0x99, 0x99,
+    0x96, 0xFF, 0xD9, 0x5F, 0xFD, 0x6F, 0xFC, 0xA7, 0x77, 0x19, 0x9A, 0x99, 0x71, 0xAF, 0xEA, 0x59,
+    0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC, 0xA1, 0x9F, 0xA1, 0xFC, 0x93, 0xFA, 0x09, 0xFA, 0x4F, 0xA0,
+    0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA, 0xAA, 0xFE, 0x09, 0xFF, 0xFD, 0x19, 0xFF, 0xF9, 0x2A, 0xFD,
+    0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F, 0xA7, 0x29, 0xFC, 0x6A, 0x3F, 0xDA, 0x99, 0xAE, 0x39, 0xFF,
+    0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7, 0x19, 0x99, 0x70, 0x7A, 0xA9, 0x49, 0xAA, 0x97, 0xE4, 0xE9,
+    0x7F, 0xAA, 0xAF, 0x70, 0xAF, 0xFC, 0x97, 0x1F, 0xF9, 0x73, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x71,
+    0xFF, 0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xC9, 0x99, 0x99, 0x99,
+    0x96, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x59,
+    0xFF, 0xFA, 0x59, 0xFF, 0xF9, 0x5A, 0xFF, 0xF6, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xC7, 0x59,
+    0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF,
+    0xA5, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x94, 0x49, 0xAA, 0x94, 0xAA, 0xA5, 0xAD, 0xA3, 0x9E, 0x59,
+    0xFA, 0xAF, 0xA6, 0xFF, 0xD7, 0x9F, 0xF7, 0x2A, 0xAD, 0xA9, 0x77, 0x75, 0x99, 0xA9, 0x97, 0x2A,
+    0xFE, 0xA6, 0x9F, 0xFE, 0x49, 0xFF, 0xF9, 0x3F, 0xCA, 0x19, 0xFA, 0x2F, 0xC9, 0x3F, 0xA1, 0x9F,
+    0xA4, 0xFA, 0x1A, 0xF9, 0x29, 0xFC, 0x91, 0xFC, 0xAA, 0xAF, 0xE1, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0x93, 0xAF, 0xDA, 0xAA, 0x96, 0xAF, 0x97, 0x39, 0xFA, 0x73, 0x9F, 0xC6, 0xA4, 0xFD, 0xA9, 0x9A,
+    0xE4, 0x9F, 0xFF, 0x5A, 0xFF, 0xE6, 0x9F, 0xFA, 0x72, 0x99, 0x97, 0x00, 0x74, 0x99, 0x77, 0xAF,
+    0x76, 0xFC, 0x75, 0x9F, 0xC7, 0x6F, 0xA7, 0x79, 0xA9, 0x77, 0x77, 0x77, 0x2F, 0xFF, 0xC5, 0x9F,
+    0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59,
+    0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F,
+    0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA,
+    0x5F, 0xFF, 0xC9, 0x40, 0x72, 0x97, 0x5A, 0xEA, 0x72, 0x9F, 0xC7, 0x29, 0xFC, 0x73, 0xF9, 0x74,
+    0xAA, 0x97, 0x77, 0x49, 0x9A, 0x99, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC,
+    0xA1, 0x9F, 0xA1, 0xFC, 0x93, 0xFA, 0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA,
+    0xAA, 0xFE, 0x09, 0xFF, 0xFD, 0x19, 0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F,
+    0xA7, 0x29, 0xFC, 0x6A, 0x3F, 0xDA, 0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7,
+    0x19, 0x99, 0x70, 0x5F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC,
+    0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99,
+    0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA,
+    0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF,
+    0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x75, 0xAD, 0xA7, 0x6E, 0xA7, 0x6E,
+    0xA7, 0x69, 0xE9, 0x76, 0xAE, 0x97, 0x69, 0xFD, 0x75, 0xFD, 0x76, 0xFA, 0x77, 0x72, 0x79, 0x9A,
+    0x99, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC, 0xA1, 0x9F, 0xA1, 0xFC, 0x93,
+    0xFA, 0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA, 0xAA, 0xFE, 0x09, 0xFF, 0xFD,
+    0x19, 0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F, 0xA7, 0x29, 0xFC, 0x6A, 0x3F,
+    0xDA, 0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7, 0x19, 0x9E, 0xA7, 0x3E, 0xA7,
+    0x3A, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x97, 0x39, 0xFD, 0x72, 0xFD, 0x73, 0xAE, 0xA4, 0x69, 0xAA,
+    0x95, 0xAA, 0xA9, 0x7E, 0xA2, 0x9F, 0x70, 0xAE, 0xA0, 0xAF, 0x72, 0xFF, 0xC7, 0x39, 0xFE, 0x75,
+    0xFD, 0x77, 0x77, 0x77, 0x4F, 0xFF, 0xC6, 0x9F, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xFF, 0xFC, 0xA6,
+    0xFC, 0x99, 0x99, 0x99, 0x99, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC9,
+    0x99, 0x99, 0x99, 0x96, 0x9F, 0xFF, 0xA6, 0x9F, 0xFF, 0x96, 0xAF, 0xFF, 0x7F, 0xCA, 0xAA, 0xAA,
+    0xAA, 0xA7, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x69,
+    0xFF, 0xFC, 0x6A, 0xFF, 0xFA, 0x6F, 0xFF, 0xCA, 0x6F, 0xFF, 0xC9, 0x50, 0x49, 0xAA, 0x95, 0xAA,
+    0xA9, 0x49, 0xEA, 0x29, 0xEA, 0x6A, 0xE9, 0x0A, 0xEA, 0x70, 0xFF, 0xA7, 0x1A, 0xFD, 0xA7, 0x3F,
+    0xCA, 0x77, 0x77, 0x99, 0xA9, 0x97, 0x3A, 0xFE, 0xA7, 0x9F, 0xFE, 0x59, 0xFF, 0xF9, 0x4F, 0xCA,
+    0x19, 0xFA, 0x3F, 0xC9, 0x3F, 0xA2, 0x9F, 0xA4, 0xFA, 0x2A, 0xF9, 0x29, 0xFC, 0x92, 0xFC, 0xAA,
+    0xAF, 0xE2, 0x9F, 0xFF, 0xD3, 0x9F, 0xFF, 0x94, 0xAF, 0xDA, 0xAA, 0x97, 0xAF, 0x97, 0x49, 0xFA,
+    0x74, 0x9F, 0xC6, 0xA5, 0xFD, 0xA9, 0x9A, 0xE5, 0x9F, 0xFF, 0x6A, 0xFF, 0xE7, 0x9F, 0xFA, 0x73,
+    0x99, 0x97, 0x10, 0x73, 0x9A, 0xAA, 0xAA, 0x76, 0x9F, 0xDA, 0x74, 0x9F, 0xF7, 0x39, 0xF9, 0x9F,
+    0x71, 0x9F, 0x2A, 0xE9, 0x70, 0xEA, 0x4A, 0xE7, 0x77, 0x77, 0x75, 0x9A, 0xFE, 0xA9, 0x70, 0x9F,
+    0xFF, 0xC9, 0x5A, 0xFF, 0xFD, 0x5A, 0xFF, 0xFD, 0xA4, 0xAF, 0xDA, 0x92, 0x9A, 0xD4, 0x9F, 0xD9,
+    0x79, 0x4F, 0xD7, 0x69, 0xFC, 0x97, 0x6F, 0xCA, 0x77, 0xFC, 0x77, 0x9F, 0xC4, 0x99, 0x99, 0x99,
+    0x99, 0x2A, 0xFA, 0x3F, 0xFC, 0x91, 0xFC, 0x93, 0xFF, 0xC2, 0xFC, 0x4F, 0xFC, 0x2F, 0xC3, 0x9A,
+    0xAA, 0xFC, 0xA2, 0xFC, 0x7A, 0xF9, 0x2F, 0xC9, 0x6F, 0xC3, 0xFC, 0xA6, 0xFC, 0x3A, 0xFC, 0x6F,
+    0xC4, 0xFD, 0x93, 0xAF, 0xA4, 0xAF, 0xFF, 0xE9, 0x5F, 0xFF, 0xE7, 0xFF, 0xFD, 0x70, 0x9F, 0xFC,
+    0xA9, 0x75, 0x99, 0x97, 0x10, 0x71, 0xAA, 0xAA, 0xA9, 0x74, 0xFE, 0x73, 0xFF, 0xA7, 0x1F, 0xA0,
+    0xF7, 0x0F, 0x92, 0xF6, 0xAD, 0xA4, 0x9E, 0x97, 0x77, 0x49, 0xA9, 0x97, 0x5A, 0xFD, 0x1F, 0x5F,
+    0xFA, 0x9F, 0x4A, 0xFF, 0xFC, 0xA3, 0x9F, 0xDA, 0xAF, 0xD9, 0x3F, 0xD2, 0x9F, 0xC9, 0x29, 0xFC,
+    0x4F, 0xC3, 0xAF, 0xA4, 0xFC, 0x3F, 0xC5, 0xFA, 0x3F, 0xC4, 0x9F, 0x92, 0x9F, 0xA4, 0xAF, 0x39,
+    0xFA, 0x4F, 0xC3, 0xAF, 0xA3, 0x9F, 0xC3, 0xAF, 0xA3, 0xFC, 0xA3, 0x9F, 0xC2, 0xAF, 0xC9, 0x4F,
+    0xDA, 0xFE, 0x5F, 0xFF, 0xD5, 0x9F, 0xE9, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x75, 0xAF, 0x97, 0x5F,
+    0xC7, 0x59, 0xFA, 0x49, 0xC9, 0x49, 0xFC, 0x94, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x69, 0xFF, 0xDA,
+    0x70, 0x9A, 0xFD, 0xA7, 0x10, 0x70, 0x9A, 0xA9, 0x4A, 0xAA, 0x71, 0xAD, 0xA3, 0x9E, 0x71, 0x9F,
+    0xAA, 0xFA, 0x72, 0xFF, 0xD7, 0x39, 0xFF, 0x76, 0xAA, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x09, 0xAF,
+    0xEA, 0x97, 0x09, 0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0xD5, 0xAF, 0xFF, 0xDA, 0x4A, 0xFD, 0xA9, 0x29,
+    0xAD, 0x49, 0xFD, 0x97, 0x94, 0xFD, 0x76, 0x9F, 0xC9, 0x76, 0xFC, 0xA7, 0x7F, 0xC7, 0x79, 0xFC,
+    0x49, 0x99, 0x99, 0x99, 0x92, 0xAF, 0xA3, 0xFF, 0xC9, 0x1F, 0xC9, 0x3F, 0xFC, 0x2F, 0xC4, 0xFF,
+    0xC2, 0xFC, 0x39, 0xAA, 0xAF, 0xCA, 0x2F, 0xC7, 0xAF, 0x92, 0xFC, 0x96, 0xFC, 0x3F, 0xCA, 0x6F,
+    0xC3, 0xAF, 0xC6, 0xFC, 0x4F, 0xD9, 0x3A, 0xFA, 0x4A, 0xFF, 0xFE, 0x95, 0xFF, 0xFE, 0x7F, 0xFF,
+    0xD7, 0x09, 0xFF, 0xCA, 0x97, 0x59, 0x99, 0x71, 0x6A, 0xA9, 0x49, 0xAA, 0x97, 0xE4, 0xE9, 0x7F,
+    0xAA, 0xAF, 0x70, 0xAF, 0xFC, 0x97, 0x1F, 0xF9, 0x73, 0x9A, 0xDA, 0x97, 0x77, 0x70, 0x9A, 0x99,
+    0x75, 0xAF, 0xD1, 0xF5, 0xFF, 0xA9, 0xF4, 0xAF, 0xFF, 0xCA, 0x39, 0xFD, 0xAA, 0xFD, 0x93, 0xFD,
+    0x29, 0xFC, 0x92, 0x9F, 0xC4, 0xFC, 0x3A, 0xFA, 0x4F, 0xC3, 0xFC, 0x5F, 0xA3, 0xFC, 0x49, 0xF9,
+    0x29, 0xFA, 0x4A, 0xF3, 0x9F, 0xA4, 0xFC, 0x3A, 0xFA, 0x39, 0xFC, 0x3A, 0xFA, 0x3F, 0xCA, 0x39,
+    0xFC, 0x2A, 0xFC, 0x94, 0xFD, 0xAF, 0xE5, 0xFF, 0xFD, 0x59, 0xFE, 0x9F, 0xA6, 0x9F, 0xC0, 0x9F,
+    0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x75, 0x9F, 0xA4, 0x9C, 0x94, 0x9F, 0xC9, 0x49, 0xFF, 0xFA, 0x59,
+    0xFF, 0xF6, 0x9F, 0xFD, 0xA7, 0x09, 0xAF, 0xDA, 0x71, 0x75, 0x99, 0x77, 0x2F, 0x97, 0x79, 0xFC,
+    0x77, 0xAF, 0xA7, 0x79, 0xF9, 0x77, 0x09, 0xAA, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x70,
+    0x9F, 0xFF, 0xC9, 0x5A, 0xFF, 0xFD, 0x5A, 0xFF, 0xFD, 0xA4, 0xAF, 0xDA, 0x92, 0x9A, 0xD4, 0x9F,
+    0xD9, 0x79, 0x4F, 0xD7, 0x69, 0xFC, 0x97, 0x6F, 0xCA, 0x77, 0xFC, 0x77, 0x9F, 0xC4, 0x99, 0x99,
+    0x99, 0x99, 0x2A, 0xFA, 0x3F, 0xFC, 0x91, 0xFC, 0x93, 0xFF, 0xC2, 0xFC, 0x4F, 0xFC, 0x2F, 0xC3,
+    0x9A, 0xAA, 0xFC, 0xA2, 0xFC, 0x7A, 0xF9, 0x2F, 0xC9, 0x6F, 0xC3, 0xFC, 0xA6, 0xFC, 0x3A, 0xFC,
+    0x6F, 0xC4, 0xFD, 0x93, 0xAF, 0xA4, 0xAF, 0xFF, 0xE9, 0x5F, 0xFF, 0xE7, 0xFF, 0xFD, 0x70, 0x9F,
+    0xFC, 0xA9, 0x75, 0x99, 0x97, 0x10, 0x73, 0x99, 0x77, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xC7, 0x6F,
+    0xA7, 0x79, 0xA9, 0x77, 0x77, 0x19, 0xA9, 0x97, 0x5A, 0xFD, 0x1F, 0x5F, 0xFA, 0x9F, 0x4A, 0xFF,
+    0xFC, 0xA3, 0x9F, 0xDA, 0xAF, 0xD9, 0x3F, 0xD2, 0x9F, 0xC9, 0x29, 0xFC, 0x4F, 0xC3, 0xAF, 0xA4,
+    0xFC, 0x3F, 0xC5, 0xFA, 0x3F, 0xC4, 0x9F, 0x92, 0x9F, 0xA4, 0xAF, 0x39, 0xFA, 0x4F, 0xC3, 0xAF,
+    0xA3, 0x9F, 0xC3, 0xAF, 0xA3, 0xFC, 0xA3, 0x9F, 0xC2, 0xAF, 0xC9, 0x4F, 0xDA, 0xFE, 0x5F, 0xFF,
+    0xD5, 0x9F, 0xE9, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x59, 0xFA, 0x49,
+    0xC9, 0x49, 0xFC, 0x94, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x69, 0xFF, 0xDA, 0x70, 0x9A, 0xFD, 0xA7,
+    0x10, 0x77, 0x76, 0x9A, 0xFE, 0xA9, 0x70, 0x9F, 0xFF, 0xC9, 0x5A, 0xFF, 0xFD, 0x5A, 0xFF, 0xFD,
+    0xA4, 0xAF, 0xDA, 0x92, 0x9A, 0xD4, 0x9F, 0xD9, 0x79, 0x4F, 0xD7, 0x69, 0xFC, 0x97, 0x6F, 0xCA,
+    0x77, 0xFC, 0x77, 0x9F, 0xC4, 0x99, 0x99, 0x99, 0x99, 0x2A, 0xFA, 0x3F, 0xFC, 0x91, 0xFC, 0x93,
+    0xFF, 0xC2, 0xFC, 0x4F, 0xFC, 0x2F, 0xC3, 0x9A, 0xAA, 0xFC, 0xA2, 0xFC, 0x7A, 0xF9, 0x2F, 0xC9,
+    0x6F, 0xC3, 0xFC, 0xA6, 0xFC, 0x3A, 0xFC, 0x6F, 0xC4, 0xFD, 0x93, 0xAF, 0xA4, 0xAF, 0xFF, 0xE9,
+    0x5F, 0xFF, 0xE7, 0xFF, 0xFD, 0x70, 0x9F, 0xFC, 0xA9, 0x75, 0x99, 0x97, 0x77, 0x76, 0x9F, 0x77,
+    0x0F, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x70, 0xE9, 0x77, 0x19, 0x99, 0x74, 0x74, 0xAA, 0x97,
+    0x7E, 0x97, 0x6F, 0x76, 0xAE, 0xA7, 0x59, 0xF7, 0x6A, 0xEA, 0x77, 0x77, 0x19, 0xA9, 0x97, 0x5A,
+    0xFD, 0x1F, 0x5F, 0xFA, 0x9F, 0x4A, 0xFF, 0xFC, 0xA3, 0x9F, 0xDA, 0xAF, 0xD9, 0x3F, 0xD2, 0x9F,
+    0xC9, 0x29, 0xFC, 0x4F, 0xC3, 0xAF, 0xA4, 0xFC, 0x3F, 0xC5, 0xFA, 0x3F, 0xC4, 0x9F, 0x92, 0x9F,
+    0xA4, 0xAF, 0x39, 0xFA, 0x4F, 0xC3, 0xAF, 0xA3, 0x9F, 0xC3, 0xAF, 0xA3, 0xFC, 0xA3, 0x9F, 0xC2,
+    0xAF, 0xC9, 0x4F, 0xDA, 0xFE, 0x5F, 0xFF, 0xD5, 0x9F, 0xE9, 0xFA, 0x69, 0xFC, 0x09, 0xFA, 0x75,
+    0xAF, 0x97, 0x5F, 0xC7, 0x59, 0xFA, 0x49, 0xC9, 0x49, 0xFC, 0x94, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF,
+    0x69, 0xFF, 0xDA, 0x70, 0x9A, 0xFD, 0xA7, 0x10, 0x74, 0xAA, 0xAA, 0xA9, 0x77, 0x0F, 0xE7, 0x7F,
+    0xFA, 0x75, 0xFA, 0x0F, 0x74, 0xF9, 0x19, 0xEA, 0x72, 0xAD, 0xA4, 0x9E, 0x77, 0x77, 0x77, 0x70,
+    0xFA, 0x69, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC, 0x5F, 0xC9, 0x6F, 0xC5, 0xFC, 0x69,
+    0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xFC, 0x5A, 0xF9, 0x6F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA4, 0x9F, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xFC, 0x5A, 0xFF, 0xFF,
+    0xC5, 0xFF, 0xFF, 0xCA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xFC, 0x94, 0xAF, 0x96, 0xFC, 0x5F,
+    0xC9, 0x6F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xFC, 0x5A, 0xF9, 0x6F,
+    0xC5, 0xFC, 0x7F, 0xC5, 0xFC, 0x69, 0xFA, 0x40, 0x6A, 0xAA, 0xAA, 0x74, 0xFE, 0x72, 0xFF, 0x97,
+    0x0F, 0xA9, 0xF7, 0xF9, 0x19, 0xEA, 0x5E, 0xA4, 0x9E, 0x77, 0x74, 0x99, 0x99, 0x97, 0x5F, 0xA7,
+    0x49, 0xF9, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0x9F, 0x91, 0x9A, 0x99,
+    0x6A, 0xF0, 0xAF, 0xCA, 0x5F, 0xCA, 0xFE, 0xA4, 0xFF, 0xFD, 0x39, 0xFE, 0x9A, 0xFC, 0x92, 0xAF,
+    0xCA, 0x2A, 0xF9, 0x2F, 0xD3, 0xAF, 0x92, 0xFC, 0x93, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4,
+    0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x92, 0xFA, 0x4F, 0xC2, 0x9F,
+    0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2,
+    0x5F, 0xA6, 0x9F, 0x96, 0x9F, 0xA6, 0xFC, 0x96, 0xAF, 0x96, 0xFC, 0x49, 0xAA, 0xFD, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xCA, 0xA9, 0x1F, 0xFF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFF, 0xE9, 0x1A, 0xAF, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xFC, 0xAA, 0xA4, 0xAF, 0x96, 0xFC, 0x7F, 0xC6, 0x9F, 0xC7, 0xFC, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xFA, 0x69, 0xFF, 0xFF, 0xC9, 0x6A, 0xFF, 0xFF, 0xC7, 0xAF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC,
+    0xA7, 0xFC, 0x6A, 0xFA, 0x69, 0xFA, 0x6F, 0xC9, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x96, 0xFC, 0x7F,
+    0xC6, 0x9F, 0xA7, 0xFC, 0x6A, 0xF9, 0x69, 0xFA, 0x6F, 0xC7, 0xAF, 0x96, 0xFC, 0x7F, 0xC7, 0xFC,
+    0x7F, 0xC6, 0x9F, 0xA6, 0x59, 0x99, 0x99, 0x75, 0xFA, 0x74, 0x9F, 0x97, 0x2A, 0xAF, 0xDA, 0xAA,
+    0xA5, 0x9F, 0xFF, 0x5A, 0xFF, 0xEA, 0x59, 0xAA, 0xFC, 0xAA, 0xAA, 0x97, 0x9F, 0x97, 0x4A, 0xF2,
+    0x9A, 0x97, 0xFC, 0x0A, 0xFC, 0xA5, 0xFA, 0xFF, 0x93, 0x9F, 0xFF, 0xD3, 0xAF, 0xDA, 0x9A, 0xFC,
+    0x3F, 0xD9, 0x2F, 0xC3, 0xFC, 0xA3, 0xAF, 0x3F, 0xC4, 0xFC, 0x29, 0xFC, 0x4F, 0xC2, 0xAF, 0x94,
+    0xFA, 0x2F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF9, 0x2F, 0xA4, 0xFC, 0x29, 0xF9, 0x4F, 0xC2, 0xAF,
+    0x93, 0x9F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0x77, 0x96, 0x9F,
+    0x92, 0xE4, 0x9F, 0xEA, 0xE9, 0x4F, 0xFF, 0x49, 0xDA, 0x09, 0xFD, 0x94, 0xAD, 0x39, 0xAC, 0xA7,
+    0x77, 0x77, 0x3F, 0xFD, 0x96, 0xFF, 0xD9, 0x59, 0xFF, 0xD7, 0xAF, 0xEA, 0x97, 0x1F, 0xC7, 0x39,
+    0xFA, 0x73, 0xAF, 0x97, 0x3A, 0xF7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F,
+    0xC7, 0x4F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA,
+    0x72, 0xAF, 0xDA, 0x79, 0xFF, 0xD6, 0xAF, 0xFD, 0x6F, 0xFD, 0xA6, 0x74, 0x93, 0xAE, 0xA3, 0xDA,
+    0x1A, 0xFD, 0xAA, 0xE1, 0x9F, 0xFF, 0x1A, 0xD9, 0x09, 0xFD, 0x2A, 0xCA, 0x39, 0xAC, 0xA7, 0x77,
+    0x74, 0xAF, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x70, 0xAF, 0x97, 0x0F, 0xC7, 0x1F, 0xC7,
+    0x1F, 0xC7, 0x09, 0xFA, 0x70, 0xAF, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x1F, 0xA7, 0x09, 0xFA, 0x70,
+    0xAF, 0x97, 0x0F, 0xC7, 0x1F, 0xC7, 0x09, 0xFA, 0x70, 0x59, 0x99, 0x99, 0x99, 0x99, 0x96, 0xFF,
+    0xD6, 0xFF, 0xD5, 0x9F, 0xFC, 0xA7, 0x77, 0x77, 0xFF, 0xD9, 0x5F, 0xFD, 0x94, 0x9F, 0xFD, 0x6A,
+    0xFE, 0xA9, 0x70, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xAF, 0x73, 0xFC, 0x73, 0xFC, 0x72,
+    0x9F, 0xA7, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72,
+    0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x1A, 0xFD, 0xA6, 0x9F, 0xFD, 0x5A, 0xFF, 0xD5, 0xFF, 0xDA,
+    0x50, 0x29, 0x99, 0x99, 0x99, 0x99, 0x91, 0x9F, 0xFC, 0xA1, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x97,
+    0x77, 0x5A, 0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x7F, 0xC6, 0x9F,
+    0xA6, 0xAF, 0x96, 0xFC, 0x7F, 0xC7, 0xFA, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA,
+    0x60, 0x49, 0xAA, 0x5A, 0xAA, 0x5A, 0xDA, 0x39, 0xE5, 0xAF, 0xAA, 0xF9, 0x6F, 0xFD, 0x79, 0xFF,
+    0x72, 0xAA, 0xCA, 0xA9, 0x77, 0x77, 0x74, 0xFF, 0xD9, 0x6F, 0xFD, 0x95, 0x9F, 0xFD, 0x7A, 0xFE,
+    0xA9, 0x71, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x9F,
+    0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC,
+    0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x2A, 0xFD, 0xA7, 0x9F, 0xFD, 0x6A, 0xFF, 0xD6, 0xFF, 0xDA, 0x60,
+    0x1A, 0xAA, 0x5A, 0xA9, 0x1E, 0x93, 0xAD, 0xA1, 0xFA, 0xAA, 0xF2, 0x9F, 0xFC, 0xA3, 0xAF, 0xEA,
+    0x59, 0xAD, 0xAA, 0x77, 0x77, 0x3A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0xAF, 0x97, 0xFC,
+    0x70, 0xFC, 0x70, 0xFC, 0x79, 0xFA, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x0F, 0xA7, 0x9F, 0xA7,
+    0xAF, 0x97, 0xFC, 0x70, 0xFC, 0x79, 0xFA, 0x70, 0x4F, 0xFD, 0x94, 0xFF, 0xD9, 0x39, 0xFF, 0xD5,
+    0xAF, 0xEA, 0x97, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x72, 0xFC, 0x71,
+    0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71,
+    0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x0A, 0xFD, 0xA5, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xDA,
+    0x70, 0x9E, 0x72, 0xAE, 0x72, 0x9E, 0x73, 0xEA, 0x73, 0xF7, 0x3F, 0xD9, 0x70, 0xAF, 0xC9, 0x71,
+    0xAF, 0x77, 0x70, 0x70, 0x99, 0x71, 0xF9, 0x6A, 0xFA, 0x6F, 0xCA, 0x6A, 0xF7, 0x09, 0xA9, 0x77,
+    0x77, 0x1A, 0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x7F, 0xC6, 0x9F,
+    0xA6, 0xAF, 0x96, 0xFC, 0x7F, 0xC7, 0xFA, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA,
+    0x79, 0xE7, 0xAE, 0x79, 0xE7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0F, 0xD6, 0xAF, 0xC7, 0xAF, 0x77, 0x20,
+    0x72, 0x97, 0x4F, 0xA7, 0x19, 0xFC, 0x71, 0xAF, 0xC7, 0x19, 0xF9, 0x72, 0x9A, 0xA7, 0x77, 0x77,
+    0x0F, 0xFD, 0x94, 0xFF, 0xD9, 0x39, 0xFF, 0xD5, 0xAF, 0xEA, 0x97, 0xFC, 0x71, 0x9F, 0xA7, 0x1A,
+    0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC,
+    0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x0A, 0xFD,
+    0xA5, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xDA, 0x40, 0x75, 0xAF, 0x93, 0xFC, 0x4F, 0xC3, 0x9F,
+    0xA3, 0xAF, 0x93, 0xFC, 0x4F, 0xC4, 0xFC, 0x39, 0xFA, 0x3A, 0xF9, 0x3F, 0xC4, 0xFC, 0x4F, 0xA3,
+    0x9F, 0xA3, 0xAF, 0x93, 0xFC, 0x4F, 0xC3, 0x9F, 0xA3, 0x4F, 0xFD, 0x93, 0xFC, 0x5F, 0xFD, 0x93,
+    0xFC, 0x49, 0xFF, 0xD3, 0x9F, 0xA5, 0xAF, 0xEA, 0x93, 0xAF, 0x97, 0xFC, 0x6F, 0xC7, 0x9F, 0xA6,
+    0xFC, 0x7A, 0xF9, 0x59, 0xFC, 0x7A, 0xF6, 0xAF, 0xA7, 0xFC, 0x6A, 0xF9, 0x7F, 0xC6, 0xFC, 0x79,
+    0xFA, 0x6F, 0xC7, 0xAF, 0x95, 0x9F, 0xA7, 0xFC, 0x6A, 0xF9, 0x7F, 0xC6, 0xFC, 0x97, 0xFC, 0x6F,
+    0xC7, 0x9F, 0xA6, 0xFC, 0x7A, 0xF9, 0x59, 0xFA, 0x7F, 0xC6, 0xAF, 0x97, 0xFC, 0x6F, 0xC7, 0x9F,
+    0xA6, 0xFC, 0x6A, 0xFD, 0xA4, 0x9F, 0xC4, 0x9F, 0xFD, 0x3A, 0xFA, 0x4A, 0xFF, 0xD3, 0xAF, 0x94,
+    0xFF, 0xDA, 0x3F, 0xC7, 0x73, 0x9F, 0xC7, 0x73, 0xFC, 0xA7, 0x69, 0x19, 0xFD, 0x76, 0x9F, 0xFC,
+    0xA7, 0x69, 0xFF, 0xC7, 0x79, 0xFF, 0x77, 0x09, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x69, 0x97, 0x99,
+    0x7F, 0x94, 0xF9, 0x4A, 0xFA, 0x3A, 0xFA, 0x4F, 0xCA, 0x3A, 0xFA, 0x4A, 0xF4, 0x9F, 0x69, 0xA9,
+    0x69, 0xA9, 0x77, 0x77, 0x77, 0xAF, 0x93, 0xAF, 0x94, 0xFC, 0x4F, 0xC5, 0xFC, 0x4F, 0xC4, 0x9F,
+    0xA3, 0x9F, 0xA4, 0xAF, 0x93, 0xAF, 0x94, 0xFC, 0x4A, 0xF9, 0x4F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC,
+    0x49, 0xFA, 0x39, 0xFA, 0x4A, 0xF9, 0x3A, 0xF9, 0x4F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC, 0x5F, 0xA4,
+    0xFC, 0x49, 0xFA, 0x39, 0xFA, 0x4A, 0xF9, 0x3A, 0xF9, 0x4F, 0xC4, 0xFC, 0x5F, 0xC4, 0xFC, 0x49,
+    0xFA, 0x39, 0xFA, 0x76, 0x9F, 0xA7, 0x6A, 0xF9, 0x76, 0xFC, 0x76, 0xFD, 0x72, 0x9F, 0xF9, 0x72,
+    0x9F, 0xEA, 0x73, 0x9F, 0xE7, 0x5F, 0xC9, 0x70, 0x74, 0xAA, 0xAA, 0xA9, 0x76, 0xFE, 0x75, 0xFF,
+    0xA7, 0x3F, 0xA0, 0xF7, 0x2F, 0xA2, 0xF7, 0x0A, 0xE5, 0xE9, 0x77, 0x77, 0x77, 0x7A, 0xF7, 0x70,
+    0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xC7,
+    0x79, 0xFA, 0x77, 0xAF, 0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xFA, 0x77, 0xFC,
+    0x97, 0x7F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x79,
+    0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9, 0x77, 0xFC, 0x77, 0xAF, 0xC7, 0x29, 0x90, 0x9A, 0xFC, 0x97,
+    0x2F, 0xFD, 0x72, 0x9F, 0xFC, 0x73, 0x9F, 0xF9, 0x74, 0xFC, 0xA9, 0x77, 0x77, 0x30, 0x71, 0x9A,
+    0xAA, 0xAA, 0x73, 0xAF, 0xD9, 0x71, 0xAF, 0xF7, 0x0A, 0xF0, 0xAE, 0x96, 0xAE, 0xA2, 0xF5, 0x9E,
+    0x94, 0xAD, 0xA7, 0x77, 0x77, 0x6A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xFA,
+    0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74,
+    0xAF, 0x97, 0x4F, 0xC7, 0x4F, 0xD7, 0x09, 0xFF, 0x97, 0x09, 0xFF, 0x71, 0x9F, 0xE7, 0x3F, 0xC9,
+    0x73, 0x5F, 0xA5, 0xAF, 0xC5, 0x9F, 0xA4, 0x9F, 0xC9, 0x5A, 0xF9, 0x39, 0xFC, 0xA6, 0xFC, 0x4F,
+    0xCA, 0x7F, 0xC3, 0xFD, 0x70, 0xFA, 0x2F, 0xD7, 0x09, 0xF9, 0x1A, 0xFC, 0x71, 0xAF, 0x90, 0x9F,
+    0xC9, 0x71, 0xFC, 0x09, 0xFC, 0x97, 0x2F, 0xC0, 0xFC, 0xA7, 0x29, 0xFA, 0xAF, 0xA7, 0x39, 0xFF,
+    0xD7, 0x4A, 0xFF, 0xD7, 0x4F, 0xFE, 0xA7, 0x3F, 0xDA, 0xFC, 0x72, 0x9F, 0xA1, 0xFC, 0x97, 0x1A,
+    0xF9, 0x1A, 0xFA, 0x71, 0xFC, 0x29, 0xFC, 0x71, 0xFC, 0x3F, 0xC9, 0x70, 0xFC, 0x3A, 0xFC, 0x79,
+    0xFA, 0x4F, 0xC7, 0xAF, 0x94, 0xFC, 0xA6, 0xFC, 0x59, 0xFC, 0x6F, 0xC6, 0xFC, 0x97, 0x77, 0x77,
+    0x77, 0x29, 0xF9, 0x77, 0x1A, 0xF7, 0x72, 0xF7, 0x72, 0xAE, 0x97, 0x72, 0xEA, 0x77, 0x39, 0x99,
+    0x77, 0x59, 0x99, 0x99, 0x77, 0xFA, 0x76, 0x9F, 0x97, 0x6A, 0xF9, 0x76, 0xFC, 0x77, 0xFC, 0x76,
+    0x9F, 0xA7, 0x69, 0xF9, 0x76, 0xAF, 0x4A, 0xFC, 0x4F, 0xC3, 0xAF, 0xC5, 0xFC, 0x2A, 0xFC, 0x59,
+    0xFA, 0x1A, 0xFC, 0x6A, 0xF9, 0x0A, 0xFC, 0x7F, 0xC0, 0x9F, 0xC7, 0x0F, 0xC9, 0xFC, 0x71, 0xFF,
+    0xD7, 0x19, 0xFF, 0xCA, 0x71, 0xAF, 0xFD, 0x71, 0xFF, 0xEA, 0x70, 0xFD, 0x9F, 0xC7, 0x0F, 0xA1,
+    0xFC, 0xA6, 0x9F, 0x91, 0x9F, 0xC6, 0xAF, 0x3F, 0xC9, 0x5F, 0xC3, 0x9F, 0xC5, 0xFC, 0x4F, 0xC9,
+    0x39, 0xFA, 0x4A, 0xFC, 0x77, 0x77, 0x77, 0x3F, 0x97, 0x6A, 0xF7, 0x7F, 0x97, 0x69, 0xE9, 0x77,
+    0xEA, 0x77, 0x09, 0x99, 0x75, 0x77, 0x70, 0xAF, 0x4A, 0xFC, 0x4F, 0xC3, 0xAF, 0xC5, 0xFC, 0x2A,
+    0xFC, 0x59, 0xFA, 0x1A, 0xFC, 0x6A, 0xF9, 0x09, 0xFC, 0x7A, 0xF0, 0x9F, 0xC7, 0x0F, 0xA9, 0xFC,
+    0x71, 0xFF, 0xD7, 0x19, 0xFF, 0xCA, 0x71, 0xAF, 0xFD, 0x71, 0xFF, 0xEA, 0x70, 0xFD, 0x9F, 0xC7,
+    0x0F, 0xA1, 0xFC, 0xA6, 0x9F, 0x91, 0x9F, 0xC6, 0xAF, 0x3F, 0xC9, 0x5F, 0xC3, 0x9F, 0xC5, 0xFC,
+    0x4F, 0xC9, 0x39, 0xFA, 0x4A, 0xFC, 0x30, 0x71, 0x9A, 0xAA, 0xAA, 0x72, 0xFC, 0x97, 0x1A, 0xF9,
+    0x71, 0x9F, 0x97, 0x2F, 0x73, 0xAD, 0xA7, 0x77, 0x77, 0x5F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97,
+    0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x29,
+    0xFA, 0x72, 0x9F, 0x97, 0x2A, 0xF9, 0x72, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xA7, 0x2A, 0xF9, 0x72,
+    0xFC, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0xA2, 0xFF, 0xFC, 0x92, 0xFF,
+    0xFC, 0x91, 0x71, 0xAA, 0xAA, 0xA7, 0x1F, 0xC9, 0x70, 0xAF, 0x97, 0x09, 0xF9, 0x71, 0xF7, 0x2A,
+    0xDA, 0x77, 0x73, 0x99, 0x99, 0x97, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F,
+    0xC7, 0x19, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A,
+    0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC,
+    0x71, 0x9F, 0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0x5F,
+    0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x2F, 0xA7, 0x19, 0xFA, 0x71, 0xAF,
+    0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0x9F, 0x97, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC,
+    0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xFF, 0xC1, 0xAF,
+    0xFF, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x97, 0x77, 0x75, 0xFC, 0x71, 0x9F, 0x72, 0xAE, 0xA7,
+    0x2F, 0x72, 0xAE, 0x73, 0x99, 0x97, 0x10, 0x79, 0x99, 0x99, 0x7F, 0xC6, 0x9F, 0xA6, 0xAF, 0x96,
+    0xFC, 0x7F, 0xC6, 0x9F, 0xA6, 0x9F, 0x96, 0xAF, 0x96, 0xFC, 0x7F, 0xC6, 0x9F, 0xA6, 0xAF, 0x96,
+    0xFC, 0x7F, 0xC7, 0xFC, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA, 0x69, 0xFA, 0x6A,
+    0xF9, 0x6F, 0xC7, 0xFC, 0x69, 0xFA, 0x77, 0x77, 0x09, 0xF9, 0x6F, 0xA7, 0xF7, 0xAE, 0x97, 0xE9,
+    0x70, 0x99, 0x97, 0x00, 0x5F, 0xA2, 0x9A, 0xAA, 0xA5, 0x9F, 0xA2, 0xFA, 0x5A, 0xF9, 0x19, 0xF6,
+    0xFC, 0x2F, 0x7F, 0xC2, 0xE9, 0x7F, 0xA1, 0x9A, 0xA9, 0x79, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0x97, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xFC, 0x95, 0xFF, 0xFC, 0x94, 0x59, 0x99, 0x99, 0x19, 0x99, 0x99, 0x5F, 0xC1, 0xF9, 0x49, 0xFA,
+    0x0A, 0xF5, 0xAF, 0x90, 0xF6, 0xFC, 0x09, 0xE9, 0x6F, 0xC0, 0xE9, 0x69, 0xFA, 0x73, 0x9F, 0x97,
+    0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x74,
+    0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x39, 0xFA, 0x73,
+    0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39, 0xFA, 0x73, 0x5F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97,
+    0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC3, 0x99,
+    0x49, 0xFA, 0x2F, 0x92, 0x9F, 0x91, 0xAF, 0xC2, 0xAF, 0x91, 0xAF, 0xA2, 0xFC, 0x29, 0xF3, 0xFC,
+    0x39, 0xA9, 0x39, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFF, 0xFC,
+    0x2A, 0xFF, 0xFA, 0x2F, 0xFF, 0xC9, 0x2F, 0xFF, 0xC9, 0x10, 0x59, 0x99, 0x99, 0x72, 0xFC, 0x71,
+    0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x19, 0xF9, 0x71, 0xAF, 0x97,
+    0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x29, 0x94, 0xAF, 0x91, 0xF9, 0x2F, 0xC1, 0xAF, 0xA2, 0xFC,
+    0x1F, 0xCA, 0x2F, 0xC1, 0xAF, 0x29, 0xFA, 0x29, 0xA9, 0x3A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71,
+    0x9F, 0xA7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0x6F, 0xA7,
+    0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x99,
+    0x97, 0x0F, 0xF7, 0x0F, 0xFA, 0x7F, 0xFC, 0x6A, 0xFE, 0x95, 0x9F, 0xE9, 0x6F, 0xF7, 0x09, 0xFE,
+    0x71, 0xFD, 0xA7, 0x19, 0xAF, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFF, 0xFC, 0x2A,
+    0xFF, 0xFA, 0x2F, 0xFF, 0xC9, 0x2F, 0xFF, 0xC9, 0x00, 0x69, 0x99, 0x96, 0xFC, 0x6F, 0xC6, 0xFA,
+    0x59, 0xF9, 0x5A, 0xF6, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5, 0x9F, 0x95, 0xAF, 0xA9, 0x4F, 0xE4, 0xFE,
+    0x92, 0x9F, 0xEA, 0x1A, 0xFD, 0xA1, 0xAF, 0xE9, 0x2A, 0xFE, 0x4F, 0xDA, 0x4A, 0xFC, 0x95, 0xAF,
+    0x6F, 0xC6, 0xFC, 0x6F, 0xA5, 0x9F, 0x95, 0xAF, 0x6F, 0xC5, 0x77, 0x09, 0xAA, 0xAA, 0x97, 0x72,
+    0x9F, 0xC7, 0x73, 0xFC, 0x77, 0x3F, 0xC7, 0x73, 0xAE, 0xA7, 0x74, 0xE9, 0x77, 0x77, 0x77, 0x77,
+    0x1F, 0xCA, 0x70, 0xF9, 0x49, 0xFD, 0x79, 0xF5, 0xAF, 0xD9, 0x6A, 0xF5, 0xFE, 0xA6, 0xFA, 0x5F,
+    0xF6, 0xFA, 0x49, 0xFF, 0x94, 0x9F, 0x94, 0x9F, 0xFA, 0x49, 0xF5, 0xAE, 0xAA, 0xF4, 0xAF, 0x5F,
+    0x99, 0xF9, 0x3F, 0xA5, 0xF9, 0x0F, 0xA3, 0xF9, 0x49, 0xF1, 0xAF, 0x29, 0xF5, 0xAF, 0x19, 0xF9,
+    0x1A, 0xF5, 0xAF, 0x2F, 0xA1, 0xFC, 0x5F, 0xA2, 0xAF, 0x1F, 0xA5, 0xF9, 0x29, 0xF9, 0x0F, 0x94,
+    0x9F, 0x4F, 0xA9, 0xF5, 0xAF, 0x4F, 0xC9, 0xF5, 0xFC, 0x49, 0xFF, 0xC5, 0xFA, 0x5F, 0xFA, 0x5F,
+    0x95, 0xFF, 0x94, 0x9F, 0x69, 0xFE, 0x5A, 0xF7, 0xFE, 0x5F, 0xA7, 0xFD, 0xA5, 0xFA, 0x7A, 0xFC,
+    0x94, 0x74, 0x9A, 0xAA, 0xA9, 0x74, 0xFC, 0x97, 0x3F, 0xC9, 0x73, 0xAF, 0x74, 0x9F, 0x75, 0xEA,
+    0x77, 0x77, 0x39, 0xA9, 0x96, 0xAE, 0x1A, 0xFC, 0xA5, 0xF0, 0xAF, 0xEA, 0x4F, 0xAF, 0xFC, 0x39,
+    0xFE, 0x9A, 0xFC, 0x92, 0xAF, 0xCA, 0x2A, 0xF9, 0x2A, 0xFC, 0x3A, 0xF9, 0x2F, 0xC9, 0x3A, 0xF9,
+    0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A,
+    0xF9, 0x2F, 0xA4, 0xFC, 0x29, 0xF9, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F, 0xC4, 0x9F, 0x92, 0xFC,
+    0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x20, 0x5F, 0xCA, 0x70, 0xF9, 0x49, 0xFD, 0x79, 0xF5, 0xAF, 0xD9,
+    0x6A, 0xF5, 0xFE, 0xA6, 0xFA, 0x5F, 0xF6, 0xFA, 0x49, 0xFF, 0x94, 0x9F, 0x94, 0x9F, 0xFA, 0x49,
+    0xF5, 0xAE, 0xAA, 0xF4, 0xAF, 0x5F, 0x99, 0xF9, 0x3F, 0xA5, 0xF9, 0x0F, 0xA3, 0xF9, 0x49, 0xF1,
+    0xAF, 0x29, 0xF5, 0xAF, 0x19, 0xF9, 0x1A, 0xF5, 0xAF, 0x2F, 0xA1, 0xFC, 0x5F, 0xA2, 0xAF, 0x1F,
+    0xA5, 0xF9, 0x29, 0xF9, 0x0F, 0x94, 0x9F, 0x4F, 0xA9, 0xF5, 0xAF, 0x4F, 0xC9, 0xF5, 0xFC, 0x49,
+    0xFF, 0xC5, 0xFA, 0x5F, 0xFA, 0x5F, 0x95, 0xFF, 0x94, 0x9F, 0x69, 0xFE, 0x5A, 0xF7, 0xFE, 0x5F,
+    0xA7, 0xFD, 0xA5, 0xFA, 0x7A, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x70, 0xFC, 0x77, 0x39, 0xF7, 0x74,
+    0xAE, 0xA7, 0x74, 0xF7, 0x74, 0xAE, 0x77, 0x59, 0x99, 0x77, 0x00, 0x73, 0x9A, 0x99, 0x6A, 0xE1,
+    0xAF, 0xCA, 0x5F, 0x0A, 0xFE, 0xA4, 0xFA, 0xFF, 0xC3, 0x9F, 0xE9, 0xAF, 0xC9, 0x2A, 0xFC, 0xA2,
+    0xAF, 0x92, 0xAF, 0xC3, 0xAF, 0x92, 0xFC, 0x93, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC,
+    0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x92, 0xFA, 0x4F, 0xC2, 0x9F, 0x94,
+    0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC7, 0x77,
+    0x77, 0x6F, 0x97, 0x4A, 0xF7, 0x5F, 0x97, 0x49, 0xE9, 0x75, 0xEA, 0x76, 0x99, 0x97, 0x30, 0x72,
+    0xAA, 0xA5, 0x9A, 0xA9, 0x74, 0xF3, 0xF9, 0x74, 0x9F, 0x09, 0xF7, 0x7A, 0xFF, 0x77, 0x1F, 0xE7,
+    0x72, 0xAF, 0xC9, 0x77, 0x77, 0x77, 0x77, 0xFC, 0xA7, 0x0F, 0x94, 0x9F, 0xD7, 0x9F, 0x5A, 0xFD,
+    0x96, 0xAF, 0x5F, 0xEA, 0x6F, 0xA5, 0xFF, 0x6F, 0xA4, 0x9F, 0xF9, 0x49, 0xF9, 0x49, 0xFF, 0xA4,
+    0x9F, 0x5A, 0xEA, 0xAF, 0x4A, 0xF5, 0xF9, 0x9F, 0x93, 0xFA, 0x5F, 0x90, 0xFA, 0x3F, 0x94, 0x9F,
+    0x1A, 0xF2, 0x9F, 0x5A, 0xF1, 0x9F, 0x91, 0xAF, 0x5A, 0xF2, 0xFA, 0x1F, 0xC5, 0xFA, 0x2A, 0xF1,
+    0xFA, 0x5F, 0x92, 0x9F, 0x90, 0xF9, 0x49, 0xF4, 0xFA, 0x9F, 0x5A, 0xF4, 0xFC, 0x9F, 0x5F, 0xC4,
+    0x9F, 0xFC, 0x5F, 0xA5, 0xFF, 0xA5, 0xF9, 0x5F, 0xF9, 0x49, 0xF6, 0x9F, 0xE5, 0xAF, 0x7F, 0xE5,
+    0xFA, 0x7F, 0xDA, 0x5F, 0xA7, 0xAF, 0xC9, 0x40, 0x6A, 0xAA, 0x94, 0x9A, 0xAA, 0x7A, 0xE9, 0x2A,
+    0xE9, 0x70, 0xF1, 0xF9, 0x71, 0x9F, 0xF9, 0x73, 0xFE, 0x97, 0x49, 0xFC, 0xA7, 0x77, 0x75, 0x9A,
+    0x99, 0x70, 0xAE, 0x1A, 0xFC, 0xA7, 0xF0, 0xAF, 0xEA, 0x6F, 0xAF, 0xFC, 0x59, 0xFE, 0x9A, 0xFC,
+    0x94, 0xAF, 0xCA, 0x2A, 0xF9, 0x4A, 0xFC, 0x3A, 0xF9, 0x4F, 0xC9, 0x3A, 0xF9, 0x4F, 0xC4, 0xFC,
+    0x49, 0xFA, 0x4F, 0xC4, 0xAF, 0x94, 0xFA, 0x4F, 0xC4, 0x9F, 0x94, 0xFC, 0x4A, 0xF9, 0x4F, 0xA4,
+    0xFC, 0x49, 0xF9, 0x4F, 0xC4, 0xAF, 0x49, 0xFA, 0x4F, 0xC4, 0x9F, 0x94, 0xFC, 0x4A, 0xF4, 0x9F,
+    0xA4, 0xFC, 0x40, 0x3F, 0xA7, 0x79, 0xF9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x7A, 0xF7, 0x70, 0xF9,
+    0x79, 0x9A, 0x93, 0x9E, 0xA0, 0x9E, 0xA0, 0x9F, 0xD9, 0x1F, 0x19, 0xE9, 0x9F, 0xF1, 0x99, 0x99,
+    0x1A, 0xEA, 0xFF, 0xCA, 0x6F, 0xEA, 0x9F, 0xCA, 0x6F, 0xD2, 0x9F, 0xC5, 0x9F, 0xC9, 0x3F, 0xC5,
+    0xAF, 0xC4, 0xFA, 0x5F, 0xC9, 0x39, 0xF9, 0x5F, 0xC4, 0xAF, 0x95, 0xFA, 0x4F, 0xC5, 0x9F, 0x94,
+    0xFC, 0x5A, 0xF9, 0x4F, 0xA5, 0xFC, 0x49, 0xF9, 0x5F, 0xC4, 0xAF, 0x59, 0xFA, 0x4F, 0xC5, 0x9F,
+    0x94, 0xFC, 0x5A, 0xF4, 0x9F, 0xA5, 0xFC, 0x49, 0xF9, 0x10, 0x5F, 0xC9, 0x70, 0xF5, 0x9F, 0xD7,
+    0x9F, 0x5A, 0xFD, 0x7A, 0xF5, 0xFE, 0xA6, 0xFA, 0x5F, 0xF6, 0xF9, 0x5F, 0xF9, 0x49, 0xF5, 0x9E,
+    0xAF, 0xA4, 0xAF, 0x5A, 0xEA, 0xAF, 0x4F, 0xC5, 0xF9, 0x0F, 0x93, 0xFA, 0x5F, 0x90, 0xAF, 0x3F,
+    0x94, 0x9F, 0x19, 0xF9, 0x19, 0xF5, 0x9F, 0x2F, 0xA1, 0xAF, 0x5A, 0xF2, 0xAF, 0x1F, 0xA5, 0xFA,
+    0x3F, 0x90, 0xFA, 0x5F, 0x93, 0xFC, 0x0F, 0x94, 0x9F, 0x49, 0xF9, 0xF5, 0xAF, 0x5F, 0xFC, 0x5F,
+    0xA5, 0xAF, 0xEA, 0x5F, 0x95, 0x9F, 0xE9, 0x5F, 0x96, 0xFE, 0x94, 0x9F, 0x7A, 0xFD, 0x5A, 0xF7,
+    0x0F, 0xD5, 0xFA, 0x70, 0xFC, 0xA5, 0xF9, 0x70, 0x9F, 0x97, 0x73, 0x9F, 0x77, 0x4F, 0xC7, 0x72,
+    0x9F, 0xC9, 0x75, 0x9F, 0xFD, 0x76, 0x9F, 0xFC, 0x77, 0x9F, 0xF7, 0x71, 0xFC, 0xA9, 0x71, 0x73,
+    0x9A, 0x99, 0x6A, 0xE1, 0xAF, 0xCA, 0x5F, 0x0A, 0xFE, 0xA4, 0xFA, 0xFF, 0xC3, 0x9F, 0xE9, 0xAF,
+    0xC9, 0x2A, 0xFC, 0xA2, 0xAF, 0x92, 0xAF, 0xC3, 0xAF, 0x92, 0xFC, 0x93, 0xAF, 0x92, 0xFC, 0x4F,
+    0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x92, 0xFA,
+    0x4F, 0xC2, 0x9F, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29,
+    0xFA, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x3A, 0xFC, 0x71, 0xFF, 0xA7, 0x1F,
+    0xF7, 0x2F, 0xE7, 0x3A, 0xFA, 0x60, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x74, 0xFF, 0xD7, 0x39,
+    0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x19, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F,
+    0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F,
+    0xC2, 0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71,
+    0xFC, 0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71,
+    0xAF, 0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6,
+    0xFD, 0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72,
+    0x9F, 0xF9, 0x77, 0x09, 0x97, 0x30, 0x59, 0x99, 0x99, 0x99, 0x99, 0x97, 0xFF, 0xD7, 0xFF, 0xD7,
+    0xFF, 0xCA, 0x77, 0x73, 0x9A, 0xA9, 0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x39, 0xFD,
+    0xAA, 0xFC, 0x92, 0xFC, 0xA2, 0x9F, 0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC1, 0xFC, 0x5F,
+    0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF, 0x94, 0xFC, 0x90,
+    0x9F, 0xA3, 0x9F, 0xC1, 0x9F, 0xC2, 0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF, 0xF5, 0xAF, 0xFD,
+    0x79, 0xFE, 0x97, 0x39, 0x99, 0x70, 0x70, 0x9A, 0xA5, 0xAA, 0xA7, 0x2A, 0xDA, 0x39, 0xE7, 0x2A,
+    0xFA, 0xAF, 0x97, 0x3F, 0xFD, 0x74, 0x9F, 0xF7, 0x7A, 0xAC, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x39,
+    0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F,
+    0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F,
+    0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1,
+    0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2,
+    0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F,
+    0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97, 0x30, 0x5A, 0xA9, 0x49, 0xAA,
+    0x59, 0xE4, 0xE6, 0xFA, 0xAA, 0xEA, 0x6F, 0xFD, 0x70, 0xFF, 0x97, 0x19, 0xAD, 0xA9, 0x77, 0x75,
+    0x9A, 0xA9, 0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x39, 0xFD, 0xAA, 0xFC, 0x92, 0xFC,
+    0xA2, 0x9F, 0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC,
+    0x09, 0xFA, 0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF, 0x94, 0xFC, 0x90, 0x9F, 0xA3, 0x9F, 0xC1,
+    0x9F, 0xC2, 0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF, 0xF5, 0xAF, 0xFD, 0x79, 0xFE, 0x97, 0x39,
+    0x99, 0x70, 0x74, 0x9A, 0xAA, 0xA1, 0xAA, 0xAA, 0x97, 0x39, 0xF9, 0x0A, 0xF7, 0x4F, 0x90, 0x9F,
+    0x74, 0xF9, 0x1F, 0x74, 0xAE, 0x2E, 0xA7, 0x49, 0xDA, 0x29, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x9F,
+    0xE9, 0x75, 0xAF, 0xFE, 0x73, 0xFF, 0xFD, 0x71, 0xFF, 0xFF, 0x7F, 0xE9, 0x19, 0xFD, 0x95, 0x9F,
+    0xCA, 0x5F, 0xD5, 0xFC, 0xA6, 0x9F, 0xC4, 0xAF, 0xC7, 0x0F, 0xC4, 0xFC, 0x97, 0x0F, 0xC9, 0x3F,
+    0xC7, 0x1F, 0xC9, 0x29, 0xFC, 0x71, 0xFC, 0x92, 0xAF, 0xA7, 0x1F, 0xC3, 0xFC, 0x97, 0x1F, 0xC3,
+    0xFC, 0x71, 0x9F, 0xC3, 0xFC, 0x71, 0xAF, 0xA3, 0xFC, 0x71, 0xFC, 0x93, 0xFC, 0x97, 0xAF, 0xC4,
+    0xFC, 0xA7, 0xFC, 0xA4, 0xAF, 0xC6, 0xFD, 0x6F, 0xD9, 0x29, 0xFD, 0x96, 0xAF, 0xFF, 0xEA, 0x70,
+    0xFF, 0xFD, 0xA7, 0x2F, 0xFF, 0x97, 0x49, 0xFF, 0x97, 0x72, 0x99, 0x75, 0x70, 0x9A, 0xAA, 0xA1,
+    0xAA, 0xAA, 0xA7, 0x1F, 0xA0, 0x9F, 0x97, 0x0F, 0xA1, 0xF9, 0x70, 0xAE, 0xA1, 0xF9, 0x70, 0x9E,
+    0x91, 0xAE, 0x72, 0xDA, 0x3D, 0xA7, 0x77, 0x73, 0x9A, 0xA9, 0x76, 0x9F, 0xF7, 0x3A, 0xFF, 0xD9,
+    0x70, 0xAF, 0xFF, 0x79, 0xFD, 0xAA, 0xFC, 0x96, 0xFC, 0xA2, 0x9F, 0xC5, 0x9F, 0xC4, 0xFC, 0x5F,
+    0xC9, 0x4F, 0xC5, 0xFC, 0x5F, 0xC4, 0x9F, 0xA5, 0xFC, 0x49, 0xFA, 0x5F, 0xC4, 0xAF, 0x94, 0x9F,
+    0xA4, 0xAF, 0x94, 0xFC, 0x94, 0x9F, 0xA3, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xCA, 0x6F, 0xDA, 0xFE,
+    0x79, 0xFF, 0xF7, 0x1A, 0xFF, 0xD7, 0x39, 0xFE, 0x97, 0x79, 0x99, 0x74, 0x77, 0x77, 0x59, 0xFF,
+    0xFF, 0xF6, 0x9F, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xFE, 0xA4, 0xFF, 0xFF, 0xFF, 0x93, 0xAF, 0xD9,
+    0x2A, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x39, 0xFC, 0xA5, 0xFA, 0x73, 0xFC, 0xA5, 0x9F, 0xA7, 0x29,
+    0xFC, 0x6A, 0xF9, 0x72, 0xFC, 0x96, 0xFC, 0x73, 0xFC, 0x7F, 0xC9, 0x99, 0x99, 0x99, 0x92, 0x9F,
+    0xA6, 0x9F, 0xFF, 0x92, 0xAF, 0x96, 0xAF, 0xFF, 0x3F, 0xC9, 0x6A, 0xFF, 0xF3, 0xFC, 0x7F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA3, 0xFC, 0x7F, 0xC7, 0x3F, 0xC6, 0x9F, 0xA7, 0x3F, 0xC6, 0xAF, 0x97, 0x3F,
+    0xC9, 0x5F, 0xC7, 0x4A, 0xFC, 0x5F, 0xC7, 0x5F, 0xD3, 0x9F, 0xC7, 0x5A, 0xFF, 0xFF, 0xFE, 0x6F,
+    0xFF, 0xFF, 0xDA, 0x7F, 0xFF, 0xFF, 0xC9, 0x70, 0x9F, 0xFF, 0xFE, 0x74, 0x99, 0x97, 0x73, 0x69,
+    0x9A, 0x99, 0x69, 0x9A, 0x99, 0x70, 0x9F, 0xE9, 0x2A, 0xFE, 0xA5, 0xFF, 0xDA, 0x9F, 0xFD, 0xA3,
+    0xFF, 0xFF, 0xFF, 0x2A, 0xFC, 0xA9, 0xAF, 0xFA, 0x1A, 0xF9, 0x1F, 0xC9, 0x2A, 0xFD, 0x93, 0xFA,
+    0x0A, 0xFA, 0x39, 0xFC, 0xA3, 0x9F, 0x90, 0xFC, 0x5F, 0xC3, 0x9F, 0xC1, 0xFC, 0x5F, 0xCA, 0xAA,
+    0xFD, 0xA0, 0x9F, 0xA4, 0x9F, 0xFF, 0xCA, 0x19, 0xFA, 0x49, 0xFF, 0xF9, 0x2A, 0xF9, 0x4A, 0xFD,
+    0xAA, 0xA9, 0x5A, 0xF9, 0x4F, 0xC7, 0x39, 0xFA, 0x3A, 0xFC, 0x97, 0x29, 0xFC, 0x29, 0xFE, 0x69,
+    0x3F, 0xDA, 0xFF, 0xD9, 0x99, 0xAE, 0x39, 0xFF, 0xFF, 0xFE, 0x4A, 0xFF, 0xC9, 0xAF, 0xFE, 0x59,
+    0xFD, 0xA2, 0x9F, 0xFA, 0x71, 0x99, 0x70, 0x99, 0x97, 0x75, 0x9A, 0xAA, 0xAA, 0x76, 0xFC, 0x97,
+    0x5A, 0xF9, 0x75, 0x9F, 0x97, 0x6F, 0x77, 0xAD, 0xA7, 0x77, 0x77, 0x75, 0xFE, 0xAA, 0x97, 0x19,
+    0xFF, 0xE9, 0x7A, 0xFF, 0xF9, 0x6F, 0xFF, 0xD6, 0xFC, 0x19, 0xAF, 0xCA, 0x5F, 0xC3, 0xAF, 0xA4,
+    0x9F, 0xA3, 0x9F, 0xC4, 0xAF, 0x93, 0x9F, 0xA4, 0xFC, 0x4A, 0xFA, 0x4F, 0xC4, 0xFC, 0x93, 0x9F,
+    0xC2, 0x9F, 0xD4, 0x9F, 0xFF, 0xD5, 0xAF, 0xFF, 0xC6, 0xFF, 0xF9, 0x7F, 0xFF, 0x79, 0xFA, 0x1A,
+    0xF9, 0x6A, 0xF9, 0x19, 0xFC, 0x6F, 0xC9, 0x2F, 0xC6, 0xFC, 0x3A, 0xFA, 0x5F, 0xC3, 0x9F, 0xC4,
+    0x9F, 0xA4, 0xFC, 0x93, 0xAF, 0x94, 0xAF, 0xC3, 0xFC, 0x6F, 0xC3, 0xFC, 0x6F, 0xCA, 0x10, 0x72,
+    0xAA, 0xAA, 0xA9, 0x71, 0xAF, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2A, 0xEA, 0x72, 0x9E, 0x97, 0x77,
+    0x71, 0x9A, 0xA5, 0xAE, 0x90, 0xAF, 0x5F, 0x9A, 0xFC, 0x5F, 0xAF, 0xCA, 0x49, 0xFF, 0xD9, 0x4A,
+    0xFD, 0xA9, 0x09, 0x5F, 0xD9, 0x71, 0xFC, 0xA7, 0x2F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F,
+    0xC7, 0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA,
+    0x72, 0x5F, 0xEA, 0xA9, 0x70, 0x9F, 0xFE, 0x96, 0xAF, 0xFF, 0x95, 0xFF, 0xFD, 0x5F, 0xC1, 0x9A,
+    0xFC, 0xA4, 0xFC, 0x3A, 0xFA, 0x39, 0xFA, 0x39, 0xFC, 0x3A, 0xF9, 0x39, 0xFA, 0x3F, 0xC4, 0xAF,
+    0xA3, 0xFC, 0x4F, 0xC9, 0x29, 0xFC, 0x29, 0xFD, 0x39, 0xFF, 0xFD, 0x4A, 0xFF, 0xFC, 0x5F, 0xFF,
+    0x96, 0xFF, 0xF6, 0x9F, 0xA1, 0xAF, 0x95, 0xAF, 0x91, 0x9F, 0xC5, 0xFC, 0x92, 0xFC, 0x5F, 0xC3,
+    0xAF, 0xA4, 0xFC, 0x39, 0xFC, 0x39, 0xFA, 0x4F, 0xC9, 0x2A, 0xF9, 0x4A, 0xFC, 0x2F, 0xC6, 0xFC,
+    0x2F, 0xC6, 0xFC, 0xA7, 0x77, 0x77, 0x6A, 0xF7, 0x6F, 0xA7, 0x59, 0xF7, 0x6F, 0x76, 0x9E, 0x97,
+    0x79, 0x97, 0x40, 0x75, 0x9A, 0xA6, 0xAE, 0x90, 0xAF, 0x6F, 0x9A, 0xFC, 0x6F, 0xAF, 0xCA, 0x59,
+    0xFF, 0xD9, 0x5A, 0xFD, 0xA9, 0x09, 0x6F, 0xD9, 0x72, 0xFC, 0xA7, 0x3F, 0xC7, 0x39, 0xFA, 0x73,
+    0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F,
+    0xC7, 0x39, 0xFA, 0x77, 0x77, 0x77, 0x9F, 0x97, 0x3A, 0xF7, 0x4F, 0x74, 0x9E, 0x97, 0x4E, 0xA7,
+    0x59, 0x99, 0x75, 0x79, 0xAA, 0x95, 0xAA, 0xA7, 0x09, 0xE9, 0x2A, 0xEA, 0x71, 0xF9, 0x0F, 0xA7,
+    0x3F, 0xFA, 0x74, 0xAF, 0xDA, 0x76, 0xFC, 0xA7, 0x77, 0x77, 0x76, 0xFE, 0xAA, 0x97, 0x29, 0xFF,
+    0xE9, 0x70, 0xAF, 0xFF, 0x97, 0xFF, 0xFD, 0x7F, 0xC1, 0x9A, 0xFC, 0xA6, 0xFC, 0x3A, 0xFA, 0x59,
+    0xFA, 0x39, 0xFC, 0x5A, 0xF9, 0x39, 0xFA, 0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4F, 0xC9, 0x49, 0xFC,
+    0x29, 0xFD, 0x59, 0xFF, 0xFD, 0x6A, 0xFF, 0xFC, 0x7F, 0xFF, 0x97, 0x0F, 0xFF, 0x70, 0x9F, 0xA1,
+    0xAF, 0x97, 0xAF, 0x91, 0x9F, 0xC7, 0xFC, 0x92, 0xFC, 0x7F, 0xC3, 0xAF, 0xA6, 0xFC, 0x39, 0xFC,
+    0x59, 0xFA, 0x4F, 0xC9, 0x4A, 0xF9, 0x4A, 0xFC, 0x4F, 0xC6, 0xFC, 0x4F, 0xC6, 0xFC, 0xA2, 0x4A,
+    0xAA, 0x59, 0xAA, 0x94, 0xF3, 0xF5, 0x9F, 0x09, 0xF7, 0xAF, 0xF7, 0x1F, 0xE7, 0x2A, 0xFC, 0x97,
+    0x77, 0x71, 0x9A, 0xA6, 0xAE, 0x90, 0xAF, 0x6F, 0x9A, 0xFC, 0x6F, 0xAF, 0xCA, 0x59, 0xFF, 0xD9,
+    0x5A, 0xFD, 0xA9, 0x09, 0x6F, 0xD9, 0x72, 0xFC, 0xA7, 0x3F, 0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x97,
+    0x3F, 0xC7, 0x4F, 0xC7, 0x4F, 0xA7, 0x39, 0xFA, 0x73, 0xAF, 0x97, 0x3F, 0xC7, 0x4F, 0xC7, 0x39,
+    0xFA, 0x73, 0x74, 0xAA, 0xAA, 0xA7, 0x4A, 0xFA, 0x73, 0x9F, 0xA7, 0x4F, 0xA7, 0x4F, 0x97, 0x49,
+    0xE9, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x70, 0xAF, 0xFE, 0x5F, 0xFF, 0xA4, 0xAF, 0xFF, 0x5F,
+    0xCA, 0x29, 0xAC, 0xA4, 0x9F, 0xC7, 0x4A, 0xFA, 0x74, 0xAF, 0xA7, 0x49, 0xFC, 0x75, 0xFD, 0x97,
+    0x3A, 0xFD, 0xA7, 0x3F, 0xF7, 0x3F, 0xF7, 0x3A, 0xFD, 0xA7, 0x39, 0xFD, 0x74, 0x9F, 0xC9, 0x74,
+    0xFC, 0x97, 0x4A, 0xF9, 0x74, 0xFC, 0x39, 0xCA, 0x94, 0xAF, 0xC3, 0x9F, 0xFF, 0xCA, 0x39, 0xFF,
+    0xFC, 0x49, 0xFF, 0xEA, 0x69, 0xAF, 0xEA, 0x97, 0x39, 0x99, 0x72, 0x71, 0x9A, 0xAA, 0xAA, 0x72,
+    0xFC, 0x97, 0x1F, 0xC9, 0x71, 0xAF, 0x97, 0x19, 0xF7, 0x3A, 0xDA, 0x77, 0x75, 0x9A, 0xA9, 0x97,
+    0x09, 0xFF, 0xC9, 0x49, 0xFF, 0xE4, 0xFF, 0xE9, 0x3A, 0xFC, 0x29, 0xD4, 0xAF, 0x97, 0x2A, 0xFA,
+    0x72, 0xAF, 0xD7, 0x2F, 0xEA, 0x70, 0x9F, 0xF7, 0x09, 0xFF, 0x71, 0x9F, 0xD9, 0x72, 0xFC, 0xA7,
+    0x2A, 0xFA, 0x29, 0x95, 0xAF, 0x92, 0xAD, 0xAA, 0x9A, 0xFD, 0x3A, 0xFF, 0xEA, 0x3A, 0xFF, 0xDA,
+    0x49, 0xAF, 0xF9, 0x71, 0x99, 0x97, 0x10, 0x71, 0xAA, 0xAA, 0xA9, 0x73, 0xFE, 0x72, 0xFF, 0xA7,
+    0x0F, 0xA0, 0xF7, 0xFA, 0x2F, 0x5A, 0xE5, 0xE9, 0x77, 0x77, 0x74, 0x9A, 0xFD, 0xA7, 0x0A, 0xFF,
+    0xE5, 0xFF, 0xFA, 0x4A, 0xFF, 0xF5, 0xFC, 0xA2, 0x9A, 0xCA, 0x49, 0xFC, 0x74, 0xAF, 0xA7, 0x4A,
+    0xFA, 0x74, 0x9F, 0xC7, 0x5F, 0xD9, 0x73, 0xAF, 0xDA, 0x73, 0xFF, 0x73, 0xFF, 0x73, 0xAF, 0xDA,
+    0x73, 0x9F, 0xD7, 0x49, 0xFC, 0x97, 0x4F, 0xC9, 0x74, 0xAF, 0x97, 0x4F, 0xC3, 0x9C, 0xA9, 0x4A,
+    0xFC, 0x39, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xC4, 0x9F, 0xFE, 0xA6, 0x9A, 0xFE, 0xA9, 0x73, 0x99,
+    0x97, 0x20, 0x69, 0xAA, 0xAA, 0xA7, 0x19, 0xFD, 0xA7, 0x9F, 0xF6, 0x9F, 0x99, 0xF4, 0x9F, 0x2A,
+    0xE9, 0x3E, 0xA4, 0xAE, 0x77, 0x70, 0x9A, 0xA9, 0x97, 0x09, 0xFF, 0xC9, 0x49, 0xFF, 0xE4, 0xFF,
+    0xE9, 0x3A, 0xFC, 0x29, 0xD4, 0xAF, 0x97, 0x2A, 0xFA, 0x72, 0xAF, 0xD7, 0x2F, 0xEA, 0x70, 0x9F,
+    0xF7, 0x09, 0xFF, 0x71, 0x9F, 0xD9, 0x72, 0xFC, 0xA7, 0x2A, 0xFA, 0x29, 0x95, 0xAF, 0x92, 0xAD,
+    0xAA, 0x9A, 0xFD, 0x3A, 0xFF, 0xEA, 0x3A, 0xFF, 0xDA, 0x49, 0xAF, 0xF9, 0x71, 0x99, 0x97, 0x10,
+    0x77, 0x71, 0x9A, 0xFD, 0xA7, 0x0A, 0xFF, 0xE5, 0xFF, 0xFA, 0x4A, 0xFF, 0xF5, 0xFC, 0xA2, 0x9A,
+    0xCA, 0x49, 0xFC, 0x74, 0xAF, 0xA7, 0x4A, 0xFA, 0x74, 0x9F, 0xC7, 0x5F, 0xD9, 0x73, 0xAF, 0xDA,
+    0x73, 0xFF, 0x73, 0xFF, 0x73, 0xAF, 0xDA, 0x73, 0x9F, 0xD7, 0x49, 0xFC, 0x97, 0x4F, 0xC9, 0x74,
+    0xAF, 0x97, 0x4F, 0xC3, 0x9C, 0xA9, 0x4A, 0xFC, 0x39, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xC4, 0x9F,
+    0xFE, 0xA6, 0x9A, 0xFE, 0xA9, 0x73, 0xE9, 0x75, 0x9E, 0xA7, 0x5A, 0xFA, 0x76, 0xF7, 0x6F, 0x72,
+    0x9C, 0xAF, 0xC7, 0x29, 0xFD, 0x97, 0x29, 0xFA, 0x72, 0x69, 0xAA, 0x99, 0x79, 0xFF, 0xC9, 0x39,
+    0xFF, 0xE3, 0xFF, 0xE9, 0x2A, 0xFC, 0x29, 0xD3, 0xAF, 0x97, 0x1A, 0xFA, 0x71, 0xAF, 0xD7, 0x1F,
+    0xEA, 0x79, 0xFF, 0x79, 0xFF, 0x70, 0x9F, 0xD9, 0x71, 0xFC, 0xA7, 0x1A, 0xFA, 0x19, 0x95, 0xAF,
+    0x91, 0xAD, 0xAA, 0x9A, 0xFD, 0x2A, 0xFF, 0xEA, 0x2A, 0xFF, 0xDA, 0x39, 0xAF, 0xF9, 0x70, 0xE9,
+    0x72, 0x9E, 0xA7, 0x29, 0xFC, 0x73, 0xF7, 0x3F, 0x79, 0xFE, 0x79, 0xFD, 0x97, 0x0F, 0xA9, 0x70,
+    0x59, 0xAA, 0xA5, 0xAA, 0xA9, 0x6F, 0x29, 0xF7, 0xAE, 0xA0, 0xAF, 0x71, 0xFF, 0xC7, 0x29, 0xFE,
+    0x74, 0xAF, 0xC7, 0x77, 0x77, 0x73, 0x9A, 0xFD, 0xA7, 0x1A, 0xFF, 0xE6, 0xFF, 0xFA, 0x5A, 0xFF,
+    0xF6, 0xFC, 0xA2, 0x9A, 0xCA, 0x59, 0xFC, 0x75, 0xAF, 0xA7, 0x5A, 0xFA, 0x75, 0x9F, 0xC7, 0x6F,
+    0xD9, 0x74, 0xAF, 0xDA, 0x74, 0xFF, 0x74, 0xFF, 0x74, 0xAF, 0xDA, 0x74, 0x9F, 0xD7, 0x59, 0xFC,
+    0x97, 0x5F, 0xC9, 0x75, 0xAF, 0x97, 0x5F, 0xC4, 0x9C, 0xA9, 0x4A, 0xFC, 0x49, 0xFF, 0xFC, 0xA4,
+    0x9F, 0xFF, 0xC5, 0x9F, 0xFE, 0xA7, 0x9A, 0xFE, 0xA9, 0x74, 0x99, 0x97, 0x30, 0x3A, 0xAA, 0x94,
+    0x9A, 0xAA, 0x4A, 0xE9, 0x2A, 0xEA, 0x5F, 0x1F, 0xA6, 0x9F, 0xFA, 0x70, 0xFE, 0xA7, 0x19, 0xFC,
+    0xA7, 0x77, 0x59, 0xAA, 0x99, 0x71, 0x9F, 0xFC, 0x95, 0x9F, 0xFE, 0x5F, 0xFE, 0x94, 0xAF, 0xC2,
+    0x9D, 0x5A, 0xF9, 0x73, 0xAF, 0xA7, 0x3A, 0xFD, 0x73, 0xFE, 0xA7, 0x19, 0xFF, 0x71, 0x9F, 0xF7,
+    0x29, 0xFD, 0x97, 0x3F, 0xCA, 0x73, 0xAF, 0xA3, 0x99, 0x5A, 0xF9, 0x3A, 0xDA, 0xA9, 0xAF, 0xD4,
+    0xAF, 0xFE, 0xA4, 0xAF, 0xFD, 0xA5, 0x9A, 0xFF, 0x97, 0x29, 0x99, 0x72, 0x09, 0xFF, 0xFF, 0x1A,
+    0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF9, 0x19, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F,
+    0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC,
+    0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xFC,
+    0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x5A, 0xD9, 0x75, 0x9E, 0xA7, 0x5A,
+    0xFC, 0x76, 0xF7, 0x6F, 0x72, 0x9F, 0xE7, 0x29, 0xFD, 0x97, 0x29, 0xFA, 0x74, 0x77, 0x3E, 0x97,
+    0x0A, 0xE7, 0x1F, 0x70, 0xAF, 0x6A, 0xFF, 0xD1, 0xFF, 0xF0, 0x9F, 0xFE, 0xA1, 0xAA, 0xFC, 0xAA,
+    0xAA, 0x93, 0xFA, 0x79, 0xF9, 0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0x9F, 0x97, 0xAF,
+    0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFD, 0xAD, 0x4F, 0xFC, 0x4A, 0xFF, 0x5A, 0xFD, 0xA6, 0xAD, 0xA7,
+    0x09, 0xEA, 0x70, 0x9F, 0xC7, 0x1F, 0x71, 0xF9, 0x49, 0xFE, 0x59, 0xFD, 0x96, 0xFA, 0x96, 0x4A,
+    0xAA, 0x59, 0xAA, 0xA5, 0xF3, 0xF9, 0x6F, 0x09, 0xF7, 0x0A, 0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFC,
+    0x97, 0x77, 0x77, 0x39, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF9, 0x19,
+    0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF,
+    0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC,
+    0x74, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF,
+    0x97, 0x20, 0x74, 0x99, 0x99, 0x74, 0xAF, 0x74, 0xF7, 0x4A, 0xEA, 0x7E, 0x90, 0xEA, 0x7A, 0xE0,
+    0x9E, 0x70, 0xF7, 0x4A, 0xF7, 0x2A, 0xFF, 0xD5, 0xFF, 0xF4, 0x9F, 0xFE, 0xA5, 0xAA, 0xFC, 0xAA,
+    0xAA, 0x97, 0xFA, 0x73, 0x9F, 0x97, 0x3A, 0xF9, 0x73, 0xFC, 0x74, 0xFC, 0x73, 0x9F, 0xA7, 0x39,
+    0xF9, 0x73, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x74, 0xFD, 0xAD, 0x70, 0xFF, 0xC7, 0x0A, 0xFF, 0x71,
+    0xAF, 0xDA, 0x74, 0x99, 0x72, 0x09, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF,
+    0xF9, 0x19, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA,
+    0x74, 0xAF, 0x97, 0x0A, 0xFF, 0xF5, 0xFF, 0xFC, 0x5F, 0xFF, 0xA4, 0x9F, 0xFF, 0x95, 0x99, 0x9F,
+    0xCA, 0x99, 0x97, 0x1F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0xA7, 0x4F, 0xC9, 0x74, 0xFC,
+    0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x72, 0x77, 0x5E, 0x97, 0x1A, 0xE7, 0x2F, 0x71, 0xAF,
+    0x7A, 0xFF, 0xD2, 0xFF, 0xF1, 0x9F, 0xFE, 0xA2, 0xAA, 0xFC, 0xAA, 0xAA, 0x94, 0xFA, 0x70, 0x9F,
+    0x96, 0x99, 0xAF, 0xA9, 0x99, 0x3F, 0xFE, 0x3F, 0xFD, 0xA2, 0x9F, 0xFD, 0x94, 0x9F, 0x97, 0x0A,
+    0xF7, 0x1F, 0xC7, 0x1F, 0xC7, 0x1F, 0xDA, 0xD5, 0xFF, 0xC5, 0xAF, 0xF6, 0xAF, 0xDA, 0x71, 0x99,
+    0x60, 0x77, 0x19, 0x97, 0x19, 0xF9, 0x2A, 0xD7, 0x1F, 0xEA, 0xEA, 0x70, 0xFF, 0xF7, 0x1D, 0xA0,
+    0x9A, 0xFC, 0xA7, 0x09, 0xD4, 0xAC, 0xA9, 0x77, 0x77, 0x77, 0x29, 0xFA, 0x6A, 0xF3, 0xAF, 0x96,
+    0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0x92, 0x9F, 0xA6, 0xFC, 0x3A,
+    0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F, 0xC6, 0x9F, 0xA2, 0x9F, 0xC6, 0xAF, 0x92, 0xAF, 0xA6,
+    0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0xA2, 0x9F, 0xA6, 0xFC, 0x92,
+    0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC, 0x3A, 0xF9, 0x5A, 0xFA, 0x3A, 0xFA, 0x49, 0xFC, 0x49,
+    0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x71, 0x9F, 0xFA,
+    0x77, 0x99, 0x97, 0x30, 0x77, 0x99, 0x7A, 0xEA, 0x29, 0xD9, 0x5A, 0xFD, 0xAA, 0xE5, 0x9F, 0xFE,
+    0xA5, 0xAD, 0x90, 0x9F, 0xD6, 0xDA, 0x39, 0xDA, 0x77, 0x77, 0x73, 0xFC, 0x49, 0xF9, 0x2F, 0xC4,
+    0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x4A, 0xF9, 0x2F,
+    0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0xAF, 0xA2, 0xFC, 0x4F, 0xC9,
+    0x2F, 0xA3, 0x9F, 0xC3, 0xFA, 0x3F, 0xD3, 0xFC, 0x2A, 0xFC, 0xA3, 0xFD, 0xAF, 0xE9, 0x3F, 0xFC,
+    0x9F, 0x49, 0xFE, 0xA0, 0xF5, 0x9F, 0xC9, 0x1F, 0x79, 0x97, 0x40, 0x79, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x3F, 0xFD, 0x73, 0xFF, 0xD7, 0x3F, 0xFC, 0xA7, 0x77, 0x77, 0x72, 0x9F, 0xA6, 0xAF, 0x3A,
+    0xF9, 0x6F, 0xC3, 0xFC, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xF9, 0x29, 0xFA, 0x6F,
+    0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xC3, 0xFC, 0x69, 0xFA, 0x29, 0xFC, 0x6A, 0xF9, 0x2A,
+    0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xFA, 0x29, 0xFA, 0x6F,
+    0xC9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x95, 0x9F, 0xC3, 0xAF, 0x95, 0xAF, 0xA3, 0xAF, 0xA4, 0x9F,
+    0xC4, 0x9F, 0xC9, 0x29, 0xFC, 0xA5, 0xFF, 0xFE, 0x6A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x97, 0x19,
+    0xFF, 0xA7, 0x79, 0x99, 0x73, 0x69, 0x99, 0x99, 0x99, 0x99, 0x97, 0x9F, 0xFC, 0xA7, 0xAF, 0xFC,
+    0x97, 0xAF, 0xFC, 0x77, 0x77, 0x73, 0xFC, 0x49, 0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2,
+    0xAF, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x4A, 0xF9, 0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F,
+    0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0xAF, 0xA2, 0xFC, 0x4F, 0xC9, 0x2F, 0xA3, 0x9F, 0xC3, 0xFA,
+    0x3F, 0xD3, 0xFC, 0x2A, 0xFC, 0xA3, 0xFD, 0xAF, 0xE9, 0x3F, 0xFC, 0x9F, 0x49, 0xFE, 0xA0, 0xF5,
+    0x9F, 0xC9, 0x1F, 0x79, 0x97, 0x40, 0x7A, 0xA9, 0x49, 0xAA, 0x71, 0x9E, 0x4E, 0x71, 0x9F, 0xAA,
+    0xAE, 0xA7, 0x2F, 0xFD, 0x74, 0xFF, 0x76, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x74, 0x9F, 0xA6, 0xAF,
+    0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xF9, 0x29, 0xFA,
+    0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xC3, 0xFC, 0x69, 0xFA, 0x29, 0xFC, 0x6A, 0xF9,
+    0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xFA, 0x29, 0xFA,
+    0x6F, 0xC9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF, 0x95, 0x9F, 0xC3, 0xAF, 0x95, 0xAF, 0xA3, 0xAF, 0xA4,
+    0x9F, 0xC4, 0x9F, 0xC9, 0x29, 0xFC, 0xA5, 0xFF, 0xFE, 0x6A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x97,
+    0x19, 0xFF, 0xA7, 0x79, 0x99, 0x73, 0x5A, 0xAA, 0x5A, 0xA9, 0x6E, 0x93, 0xAD, 0xA6, 0xFA, 0xAA,
+    0xF7, 0x9F, 0xFC, 0xA7, 0x0A, 0xFE, 0xA7, 0x29, 0xAD, 0xAA, 0x77, 0x77, 0x75, 0xFC, 0x49, 0xF9,
+    0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x4A,
+    0xF9, 0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0xAF, 0xA2, 0xFC,
+    0x4F, 0xC9, 0x2F, 0xA3, 0x9F, 0xC3, 0xFA, 0x3F, 0xD3, 0xFC, 0x2A, 0xFC, 0xA3, 0xFD, 0xAF, 0xE9,
+    0x3F, 0xFC, 0x9F, 0x49, 0xFE, 0xA0, 0xF5, 0x9F, 0xC9, 0x1F, 0x79, 0x97, 0x40, 0x72, 0xAD, 0xA7,
+    0x70, 0xFD, 0x97, 0x5E, 0xAA, 0xE7, 0x5D, 0xA1, 0x9D, 0x75, 0xDA, 0x19, 0xD7, 0x5E, 0xAA, 0xE7,
+    0x6F, 0xD9, 0x77, 0xAD, 0xA7, 0x77, 0x77, 0x75, 0x9F, 0xA6, 0xAF, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC,
+    0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xF9, 0x29, 0xFA, 0x6F, 0xC3, 0xAF, 0x96, 0xFC,
+    0x3F, 0xC6, 0x9F, 0xC3, 0xFC, 0x69, 0xFA, 0x29, 0xFC, 0x6A, 0xF9, 0x2A, 0xFA, 0x6F, 0xC3, 0xAF,
+    0x96, 0xFC, 0x3F, 0xC6, 0x9F, 0xA3, 0xFC, 0x6A, 0xFA, 0x29, 0xFA, 0x6F, 0xC9, 0x2A, 0xFA, 0x6F,
+    0xC3, 0xAF, 0x95, 0x9F, 0xC3, 0xAF, 0x95, 0xAF, 0xA3, 0xAF, 0xA4, 0x9F, 0xC4, 0x9F, 0xC9, 0x29,
+    0xFC, 0xA5, 0xFF, 0xFE, 0x6A, 0xFF, 0xFC, 0x97, 0xAF, 0xFE, 0x97, 0x19, 0xFF, 0xA7, 0x79, 0x99,
+    0x73, 0x70, 0x9E, 0x97, 0x4A, 0xFC, 0xA7, 0x29, 0xE9, 0xE9, 0x71, 0xAD, 0x2D, 0xA7, 0x1A, 0xD2,
+    0xDA, 0x71, 0x9E, 0xAE, 0x97, 0x2A, 0xFC, 0xA7, 0x49, 0xDA, 0x97, 0x77, 0x77, 0x5F, 0xC4, 0x9F,
+    0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F, 0xC4,
+    0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x4A, 0xFA, 0x2F,
+    0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD, 0x3F, 0xC2, 0xAF, 0xCA, 0x3F, 0xDA, 0xFE,
+    0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC, 0x91, 0xF7, 0x99, 0x74, 0x72, 0x9A, 0xAA,
+    0xA1, 0xAA, 0xAA, 0xA7, 0x3F, 0xA0, 0x9F, 0x97, 0x2F, 0xA1, 0xF9, 0x72, 0xAE, 0x91, 0xF9, 0x72,
+    0x9E, 0x91, 0xAE, 0x74, 0xDA, 0x3D, 0xA7, 0x77, 0x77, 0x77, 0x09, 0xFA, 0x6A, 0xF5, 0xAF, 0x96,
+    0xFC, 0x5F, 0xC9, 0x6F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xFC, 0x5A,
+    0xF9, 0x6F, 0xC5, 0xFC, 0x69, 0xFC, 0x5F, 0xC6, 0x9F, 0xA4, 0x9F, 0xC6, 0xAF, 0x94, 0xAF, 0xA6,
+    0xFC, 0x5A, 0xF9, 0x6F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0xA4, 0x9F, 0xA6, 0xFC, 0x94,
+    0xAF, 0xA6, 0xFC, 0x5A, 0xF9, 0x59, 0xFC, 0x5A, 0xF9, 0x5A, 0xFA, 0x5A, 0xFA, 0x49, 0xFC, 0x69,
+    0xFC, 0x92, 0x9F, 0xCA, 0x7F, 0xFF, 0xE7, 0x0A, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xE9, 0x73, 0x9F,
+    0xFA, 0x77, 0x19, 0x99, 0x75, 0x71, 0xAA, 0xAA, 0x90, 0x9A, 0xAA, 0xA9, 0x70, 0xAF, 0x1F, 0xC7,
+    0x09, 0xF1, 0xAF, 0x71, 0xF1, 0x9E, 0xA7, 0x1E, 0xA2, 0xE9, 0x71, 0x9D, 0x92, 0xAD, 0x97, 0x77,
+    0x77, 0x73, 0xFC, 0x49, 0xF9, 0x5F, 0xC4, 0xAF, 0x59, 0xFA, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A,
+    0xF4, 0x9F, 0xA5, 0xFC, 0x4A, 0xF9, 0x5F, 0xC4, 0xFC, 0x59, 0xFA, 0x4F, 0xC5, 0xAF, 0x94, 0xFA,
+    0x5F, 0xC4, 0xAF, 0xA5, 0xFC, 0x4F, 0xC9, 0x5F, 0xA3, 0x9F, 0xC6, 0xFA, 0x3F, 0xD6, 0xFC, 0x2A,
+    0xFC, 0xA6, 0xFD, 0xAF, 0xE9, 0x6F, 0xFC, 0x9F, 0x79, 0xFE, 0xA0, 0xF7, 0x09, 0xFC, 0x91, 0xF7,
+    0x29, 0x97, 0x70, 0x29, 0xFA, 0x6A, 0xF3, 0xAF, 0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69,
+    0xFA, 0x3F, 0xC6, 0xAF, 0x92, 0x9F, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F,
+    0xC6, 0x9F, 0xA2, 0x9F, 0xC6, 0xAF, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69,
+    0xFA, 0x3F, 0xC6, 0xAF, 0xA2, 0x9F, 0xA6, 0xFC, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC,
+    0x3A, 0xF9, 0x5A, 0xFA, 0x3A, 0xFA, 0x49, 0xFC, 0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6,
+    0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x71, 0x9F, 0xFA, 0x76, 0xAE, 0x97, 0x7A, 0xE7, 0x70, 0x9E,
+    0x77, 0x1E, 0xA7, 0x71, 0xF7, 0x71, 0xFD, 0x97, 0x6A, 0xFC, 0x97, 0x7A, 0xF7, 0x77, 0x71, 0x77,
+    0x5F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x49,
+    0xFA, 0x2F, 0xC4, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC,
+    0x4A, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F, 0xA3, 0xFD, 0x3F, 0xC2, 0xAF, 0xCA,
+    0x3F, 0xDA, 0xFE, 0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F, 0x59, 0xFC, 0x91, 0xF7, 0x99, 0x3E,
+    0x97, 0x49, 0xE9, 0x75, 0xE9, 0x75, 0xAE, 0x76, 0xF7, 0x6F, 0xD9, 0x73, 0x9F, 0xC9, 0x74, 0x9F,
+    0x97, 0x77, 0x74, 0x9A, 0xAA, 0xA9, 0x77, 0x6A, 0xFD, 0x97, 0x74, 0xAF, 0xF7, 0x73, 0xAF, 0x0F,
+    0x97, 0x71, 0xAE, 0xA2, 0xF7, 0x70, 0x9E, 0x94, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x3F, 0xA6, 0x9F,
+    0x7F, 0xAF, 0xA6, 0xFC, 0x6A, 0xF9, 0xFA, 0x59, 0xFC, 0x6F, 0xC0, 0xFA, 0x5F, 0xD5, 0x9F, 0x90,
+    0xFA, 0x5F, 0xD5, 0xFC, 0x1F, 0xA4, 0xAF, 0xD4, 0x9F, 0xA1, 0xFA, 0x4F, 0xE9, 0x3A, 0xF2, 0xFA,
+    0x3A, 0xFE, 0x93, 0xFA, 0x2A, 0xEA, 0x3F, 0xAE, 0x92, 0xAF, 0x92, 0xAE, 0xA2, 0x9E, 0xAA, 0xE9,
+    0x2F, 0xC3, 0xAF, 0x2F, 0x0A, 0xE9, 0x19, 0xF9, 0x3A, 0xF1, 0x9F, 0x0A, 0xE9, 0x1F, 0xC4, 0xAF,
+    0x1F, 0x90, 0xAE, 0x91, 0xF9, 0x4A, 0xF0, 0x9F, 0x19, 0xE9, 0x0A, 0xF5, 0xAF, 0x0A, 0xEA, 0x19,
+    0xE9, 0x0F, 0xA5, 0xAE, 0xA0, 0xF2, 0x9E, 0x99, 0xF6, 0xAE, 0xA9, 0xEA, 0x29, 0xE9, 0xFA, 0x69,
+    0xEA, 0xF3, 0x9E, 0x9F, 0x96, 0x9F, 0xEA, 0x39, 0xFF, 0x79, 0xFE, 0x93, 0x9F, 0xE9, 0x79, 0xFE,
+    0x49, 0xFE, 0x70, 0x9F, 0xD9, 0x49, 0xFD, 0x97, 0x09, 0xFD, 0x59, 0xFD, 0x71, 0x9F, 0xC9, 0x6F,
+    0xCA, 0x71, 0x72, 0xAA, 0xAA, 0xA9, 0x77, 0x2A, 0xFD, 0x77, 0x1A, 0xFF, 0x77, 0xAF, 0x0F, 0x97,
+    0x5A, 0xEA, 0x2F, 0x74, 0x9E, 0x94, 0xE9, 0x77, 0x77, 0x77, 0x71, 0xFA, 0x4F, 0xC9, 0x39, 0xFA,
+    0xFA, 0x3A, 0xFC, 0x93, 0xFC, 0x0F, 0xA3, 0xFD, 0x93, 0xFA, 0x0F, 0xA2, 0x9F, 0xD9, 0x2A, 0xF1,
+    0xFA, 0x2E, 0xAE, 0x92, 0xFA, 0x1A, 0xEA, 0x19, 0xE9, 0xE9, 0x1A, 0xF9, 0x1A, 0xEA, 0x1F, 0x0E,
+    0x91, 0xFC, 0x2A, 0xEA, 0x1E, 0xA0, 0xE9, 0x09, 0xF9, 0x2A, 0xEA, 0x0A, 0xE1, 0xE9, 0x0F, 0xC3,
+    0xAE, 0xA0, 0xF1, 0xE9, 0x0F, 0x93, 0x9E, 0xA9, 0xE9, 0x1E, 0x9A, 0xF4, 0x9E, 0xAF, 0x2E, 0x9F,
+    0x94, 0x9E, 0xAE, 0xA2, 0xEA, 0xF5, 0x9F, 0xE3, 0xFE, 0x95, 0x9F, 0xDA, 0x3F, 0xE6, 0x9F, 0xD4,
+    0xFD, 0xA7, 0xFD, 0x4F, 0xD7, 0x0F, 0xC9, 0x4F, 0xCA, 0x70, 0x69, 0xAA, 0xAA, 0xA7, 0x39, 0xFD,
+    0xA7, 0x19, 0xFF, 0x70, 0x9F, 0x99, 0xF6, 0x9F, 0x2A, 0xE9, 0x5E, 0xA4, 0xAE, 0x77, 0x77, 0x70,
+    0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF, 0xC0, 0x9F, 0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3,
+    0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49, 0xF9, 0x1A, 0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7,
+    0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49,
+    0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A,
+    0xF7, 0x5F, 0xC7, 0x30, 0x72, 0x9A, 0xAA, 0xAA, 0x77, 0x9F, 0xD9, 0x75, 0x9F, 0xF7, 0x49, 0xF9,
+    0xAE, 0xA7, 0x29, 0xF2, 0xF7, 0x19, 0xE9, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x5F, 0xA5, 0xAF, 0xA5,
+    0xFA, 0x5F, 0xC6, 0xFC, 0x4A, 0xFA, 0x6F, 0xC4, 0xFC, 0x7A, 0xF3, 0xAF, 0xA7, 0x9F, 0x3F, 0xC7,
+    0x09, 0xF2, 0xAF, 0x97, 0x1F, 0x91, 0xFC, 0x72, 0xF9, 0x0A, 0xF9, 0x72, 0xF9, 0x0F, 0xC7, 0x3F,
+    0xA9, 0xF9, 0x73, 0xAE, 0xAA, 0xF7, 0x49, 0xEA, 0xF9, 0x74, 0x9F, 0xEA, 0x76, 0xFE, 0x77, 0xFD,
+    0xA7, 0x7F, 0xD7, 0x70, 0xAF, 0xA7, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0x9F, 0xC7, 0x79, 0xFC,
+    0x97, 0x39, 0xFF, 0xA7, 0x49, 0xFF, 0x75, 0x9F, 0xDA, 0x77, 0xFA, 0x77, 0x00, 0x77, 0x7A, 0xDA,
+    0x19, 0xE7, 0x0F, 0x1F, 0x96, 0x9F, 0x1F, 0x97, 0xEA, 0x1F, 0x71, 0x94, 0x97, 0x77, 0x77, 0x3A,
+    0xF7, 0xAF, 0x9A, 0xF9, 0x5A, 0xFC, 0x09, 0xFA, 0x5F, 0xC9, 0x1F, 0xC4, 0xFC, 0xA2, 0xFC, 0x39,
+    0xFC, 0x3A, 0xF9, 0x2F, 0xC4, 0x9F, 0x91, 0xAF, 0xA5, 0xFA, 0x09, 0xFC, 0x6F, 0xC0, 0xFC, 0x7A,
+    0xFA, 0xF9, 0x79, 0xFF, 0xC7, 0x1F, 0xF7, 0x2F, 0xE9, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0x74, 0x9F,
+    0xA7, 0x49, 0xF9, 0x74, 0xAF, 0x75, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x74, 0xAF,
+    0x75, 0xFC, 0x73, 0x75, 0x9A, 0xAA, 0xA9, 0x75, 0x9F, 0xC7, 0x6F, 0xC7, 0x6A, 0xF7, 0x69, 0xF7,
+    0x7E, 0xA7, 0x77, 0x77, 0x74, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF, 0xE4, 0x9F, 0xFF,
+    0xE5, 0x99, 0x99, 0x99, 0x99, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F,
+    0xD7, 0x5A, 0xFC, 0x75, 0x9F, 0xC9, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97,
+    0x49, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xAF, 0xC7, 0x59, 0xFC, 0xA7, 0x5F, 0xFF, 0xEA,
+    0x3A, 0xFF, 0xFE, 0x93, 0xAF, 0xFF, 0xE9, 0x3F, 0xFF, 0xF4, 0x73, 0xAA, 0xAA, 0xA9, 0x72, 0xAF,
+    0xC7, 0x29, 0xFC, 0x73, 0xFA, 0x73, 0xAE, 0xA7, 0x39, 0xE9, 0x77, 0x77, 0x74, 0x9F, 0xFF, 0x4A,
+    0xFF, 0xEA, 0x4F, 0xFF, 0x94, 0xAA, 0xAA, 0xAA, 0xFD, 0x72, 0x9F, 0xC7, 0x29, 0xFC, 0x97, 0x2F,
+    0xC9, 0x72, 0xFC, 0xA7, 0x2A, 0xFC, 0x72, 0xAF, 0xC7, 0x29, 0xFC, 0x73, 0xFC, 0x97, 0x2F, 0xC9,
+    0x72, 0xFC, 0xA7, 0x2A, 0xFF, 0xF4, 0xFF, 0xFC, 0x39, 0xFF, 0xFA, 0x39, 0xFF, 0xFA, 0x30, 0x74,
+    0x99, 0x77, 0x1F, 0x97, 0x6A, 0xFA, 0x76, 0xAF, 0xA7, 0x6A, 0xF7, 0x70, 0x9A, 0x97, 0x77, 0x77,
+    0x74, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xE9, 0x4F, 0xFF, 0xE4, 0x9F, 0xFF, 0xE5, 0x99, 0x99, 0x99,
+    0x99, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5A, 0xFC, 0x75,
+    0x9F, 0xC9, 0x75, 0xFC, 0xA7, 0x5F, 0xD7, 0x5F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F,
+    0xCA, 0x75, 0xFD, 0x75, 0xAF, 0xC7, 0x59, 0xFC, 0xA7, 0x5F, 0xFF, 0xEA, 0x3A, 0xFF, 0xFE, 0x93,
+    0xAF, 0xFF, 0xE9, 0x3F, 0xFF, 0xF4, 0x72, 0x99, 0x74, 0x9F, 0x73, 0xFC, 0x97, 0x2F, 0xC7, 0x3F,
+    0xC7, 0x49, 0xA9, 0x77, 0x77, 0x71, 0x9F, 0xFF, 0x3A, 0xFF, 0xEA, 0x3F, 0xFF, 0x93, 0xAA, 0xAA,
+    0xAA, 0xFD, 0x71, 0x9F, 0xC7, 0x19, 0xFC, 0x97, 0x1F, 0xC9, 0x71, 0xFC, 0xA7, 0x1A, 0xFC, 0x71,
+    0xAF, 0xC7, 0x19, 0xFC, 0x72, 0xFC, 0x97, 0x1F, 0xC9, 0x71, 0xFC, 0xA7, 0x1A, 0xFF, 0xF3, 0xFF,
+    0xFC, 0x29, 0xFF, 0xFA, 0x29, 0xFF, 0xFA, 0x20, 0x7A, 0xAA, 0x94, 0x9A, 0xAA, 0x70, 0xAE, 0x92,
+    0xAE, 0x97, 0x1F, 0x1F, 0x97, 0x29, 0xFF, 0x97, 0x4F, 0xE9, 0x75, 0x9F, 0xCA, 0x77, 0x77, 0x77,
+    0x5A, 0xFF, 0xFD, 0x95, 0xFF, 0xFE, 0x95, 0xFF, 0xFE, 0x59, 0xFF, 0xFE, 0x69, 0x99, 0x99, 0x99,
+    0x9F, 0xD7, 0x6A, 0xFC, 0x97, 0x59, 0xFC, 0xA7, 0x6F, 0xCA, 0x76, 0xFD, 0x76, 0xAF, 0xC7, 0x69,
+    0xFC, 0x97, 0x6F, 0xCA, 0x76, 0xFD, 0x76, 0xFD, 0x76, 0xAF, 0xC9, 0x75, 0x9F, 0xCA, 0x76, 0xFC,
+    0xA7, 0x6F, 0xD7, 0x6A, 0xFC, 0x76, 0x9F, 0xCA, 0x76, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xFE, 0x94, 0xFF, 0xFF, 0x50, 0x49, 0xAA, 0xA5, 0x9A, 0xA9, 0x5F, 0x29, 0xF6, 0x9E, 0xA0,
+    0x9F, 0x70, 0xFF, 0xC7, 0x19, 0xFE, 0x73, 0xAF, 0xC7, 0x77, 0x77, 0x69, 0xFF, 0xF5, 0xAF, 0xFE,
+    0xA5, 0xFF, 0xF9, 0x5A, 0xAA, 0xAA, 0xAF, 0xD7, 0x39, 0xFC, 0x73, 0x9F, 0xC9, 0x73, 0xFC, 0x97,
+    0x3F, 0xCA, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73, 0xFC, 0x97, 0x3F,
+    0xCA, 0x73, 0xAF, 0xFF, 0x5F, 0xFF, 0xC4, 0x9F, 0xFF, 0xA4, 0x9F, 0xFF, 0xA4, 0x75, 0x99, 0x99,
+    0x75, 0xFE, 0x97, 0x2F, 0xF7, 0x2F, 0xFC, 0x71, 0x9F, 0xCA, 0x9A, 0x97, 0x1A, 0xF9, 0x75, 0xFC,
+    0x76, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x97,
+    0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x59, 0xF9, 0x75, 0xAF, 0x76, 0xFC, 0x76,
+    0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x76, 0xFA, 0x75, 0x9F, 0xA7, 0x5F,
+    0xC9, 0x74, 0xAF, 0xC7, 0x2F, 0xFA, 0x72, 0xFF, 0x73, 0xFE, 0x74, 0xAF, 0xA7, 0x50, 0x77, 0x59,
+    0x99, 0x99, 0x77, 0x6F, 0xC7, 0x09, 0xFE, 0x93, 0x9F, 0xA6, 0xAF, 0xFE, 0x91, 0xAF, 0x95, 0xFF,
+    0xFD, 0x99, 0xFA, 0x5F, 0xFF, 0xFF, 0xC5, 0xAF, 0xD9, 0x2A, 0xFF, 0xA5, 0x9F, 0xCA, 0x5A, 0xFD,
+    0x96, 0xFC, 0xA7, 0xFC, 0x79, 0xFC, 0x70, 0xFC, 0x7F, 0xC9, 0x70, 0xFC, 0x96, 0xFC, 0x71, 0xFC,
+    0x95, 0x9F, 0xA7, 0x1F, 0xC6, 0xAF, 0x97, 0x1F, 0xC6, 0xFC, 0x97, 0x1F, 0xC6, 0xFC, 0x71, 0x9F,
+    0xC6, 0xFC, 0x71, 0xAF, 0xA6, 0xFC, 0x71, 0xFC, 0x7F, 0xC7, 0x0A, 0xFC, 0x7F, 0xC9, 0x7F, 0xC9,
+    0x7A, 0xFC, 0x6F, 0xD7, 0x1F, 0xD3, 0x9F, 0xD9, 0x71, 0xAF, 0xFF, 0xE9, 0x73, 0xFF, 0xFD, 0xA7,
+    0x5F, 0xFF, 0x97, 0x79, 0xFF, 0x97, 0x74, 0x99, 0x97, 0x71, 0x77, 0x1A, 0xF9, 0x77, 0x1F, 0xC7,
+    0x09, 0xAA, 0x94, 0x9F, 0xA5, 0x9F, 0xF2, 0xFC, 0x5A, 0xFF, 0xD9, 0xAF, 0x94, 0xAF, 0xFF, 0xFA,
+    0x49, 0xFD, 0xAA, 0xFF, 0x95, 0xFC, 0xA2, 0x9F, 0xC9, 0x69, 0xFC, 0x4F, 0xC7, 0xFC, 0x94, 0xFC,
+    0x7F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6A, 0xF9,
+    0x4F, 0xC9, 0x69, 0xFA, 0x39, 0xFC, 0x79, 0xFC, 0x29, 0xFC, 0xA7, 0x0F, 0xDA, 0xFE, 0x71, 0x9F,
+    0xFF, 0x73, 0xAF, 0xFD, 0x75, 0x9F, 0xE9, 0x77, 0x19, 0x99, 0x76, 0x77, 0x77, 0x72, 0xAF, 0xDA,
+    0x94, 0x9F, 0xCA, 0x72, 0xAF, 0xFE, 0x2F, 0xFC, 0x97, 0xFF, 0xFD, 0x9F, 0xFE, 0x6F, 0xFF, 0xFF,
+    0xFE, 0xA4, 0xFD, 0xA9, 0x19, 0xFF, 0x92, 0xAF, 0xC3, 0xAF, 0xC9, 0x5F, 0xD5, 0xFC, 0x3F, 0xC9,
+    0x69, 0xFC, 0x5F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC5, 0xFC, 0x2F, 0xC7, 0x1F, 0xC5, 0xFC, 0x19, 0xFC,
+    0x71, 0xFC, 0x5F, 0xA1, 0xAF, 0x97, 0x1F, 0xC4, 0x9F, 0x91, 0xFC, 0x72, 0xFC, 0x4A, 0xF2, 0xFC,
+    0x71, 0x9F, 0xA4, 0xFC, 0x2F, 0xC7, 0x1A, 0xFA, 0x4F, 0xA2, 0xFC, 0x71, 0xFC, 0x93, 0x9F, 0xA1,
+    0x9F, 0xC7, 0x09, 0xFC, 0x4A, 0xF9, 0x2F, 0xC7, 0x0F, 0xCA, 0x4A, 0xF3, 0xFC, 0x79, 0xFC, 0x5F,
+    0xC3, 0xFC, 0xA5, 0x9F, 0xCA, 0x5F, 0xA3, 0x9F, 0xCA, 0x3A, 0xFD, 0x59, 0xF9, 0x4F, 0xFF, 0xF9,
+    0x5A, 0xF5, 0x9F, 0xFF, 0xD9, 0x6F, 0xC6, 0x9F, 0xFF, 0x70, 0xFC, 0x70, 0xAF, 0xEA, 0x97, 0x1F,
+    0xA7, 0x39, 0x99, 0x77, 0x60, 0x79, 0xAA, 0x96, 0x99, 0xA9, 0x71, 0x9F, 0xF2, 0x9F, 0xDA, 0x6A,
+    0xFF, 0xD9, 0xFF, 0xD4, 0xAF, 0xFF, 0xFF, 0xDA, 0x29, 0xFD, 0xAA, 0xFE, 0xA9, 0xAF, 0xD2, 0xFC,
+    0xA2, 0x9F, 0xC4, 0xFC, 0x19, 0xFC, 0x4F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC4, 0xFC, 0x1F, 0xC5,
+    0xFC, 0x4F, 0xA0, 0x9F, 0xA5, 0xFC, 0x39, 0xF9, 0x09, 0xFA, 0x5F, 0xC3, 0xAF, 0x90, 0xAF, 0x94,
+    0x9F, 0xA3, 0xFC, 0x1A, 0xF9, 0x4F, 0xC9, 0x3F, 0xC1, 0x9F, 0xA3, 0x9F, 0xC3, 0x9F, 0xA1, 0x9F,
+    0xC2, 0x9F, 0xCA, 0x39, 0xF9, 0x2F, 0xDA, 0xFE, 0x4A, 0xF3, 0x9F, 0xFF, 0x5F, 0xC4, 0xAF, 0xFD,
+    0x6F, 0xC5, 0x9F, 0xE9, 0x69, 0xFA, 0x70, 0x99, 0x97, 0x1A, 0xF9, 0x77, 0x5A, 0xF7, 0x76, 0xFC,
+    0x77, 0x6F, 0xA7, 0x75, 0x9F, 0xA7, 0x75, 0xAF, 0x97, 0x75, 0xFC, 0x77, 0x6F, 0xC4, 0x39, 0xAA,
+    0xFF, 0xCA, 0xA9, 0x7F, 0xFF, 0xFC, 0xA4, 0xFF, 0xFF, 0xEA, 0x2A, 0xFF, 0xFF, 0xF9, 0x1F, 0xC9,
+    0xAF, 0xA9, 0x99, 0xAF, 0xD0, 0x9F, 0x1A, 0xF9, 0x39, 0xFC, 0x09, 0xE9, 0x1F, 0xC5, 0xFC, 0x1E,
+    0x91, 0xFC, 0x5F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F, 0xA4, 0x9F, 0xC6, 0xAF, 0x93, 0x9F, 0xCA, 0x6F,
+    0xCA, 0xAA, 0xAF, 0xE7, 0xFF, 0xFE, 0x97, 0xFF, 0xFD, 0x70, 0x9F, 0xFF, 0x97, 0x1A, 0xFA, 0xAA,
+    0xA9, 0x97, 0x4F, 0xC7, 0x72, 0xFC, 0x77, 0x19, 0xFA, 0x77, 0x1A, 0xF9, 0x77, 0x1A, 0xF7, 0x72,
+    0xFC, 0x77, 0x2F, 0xC7, 0x71, 0x9F, 0xA7, 0x60, 0x72, 0x9A, 0xA9, 0x76, 0xAF, 0xC9, 0x74, 0xAF,
+    0xD9, 0x73, 0x9F, 0xE9, 0x73, 0xAF, 0xC9, 0x97, 0x4F, 0xC7, 0x69, 0xFA, 0x76, 0x9F, 0x91, 0x9A,
+    0x97, 0x1A, 0xF0, 0xAF, 0xC9, 0x7F, 0xCA, 0xFE, 0x7F, 0xFF, 0xD5, 0x9F, 0xDA, 0xAF, 0xD5, 0xAF,
+    0xC9, 0x2F, 0xC9, 0x4F, 0xCA, 0x3F, 0xC9, 0x4F, 0xC4, 0xAF, 0x94, 0xFA, 0x4F, 0xC9, 0x39, 0xF9,
+    0x4F, 0xC4, 0xAF, 0x5F, 0xC4, 0xFC, 0x49, 0xFC, 0x4F, 0xC4, 0xFC, 0xA4, 0xFC, 0x39, 0xFC, 0x49,
+    0xFC, 0x92, 0xFC, 0xA4, 0xAF, 0xFF, 0xD5, 0xFF, 0xFD, 0x95, 0xFA, 0xAF, 0xE9, 0x59, 0xFA, 0x0A,
+    0xFC, 0x96, 0xAF, 0x92, 0x99, 0x71, 0xAF, 0x77, 0xFC, 0x77, 0xFC, 0x76, 0x9F, 0xA7, 0x6A, 0xF9,
+    0x76, 0xFC, 0x77, 0xFC, 0x76, 0x5F, 0xA7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xCA, 0x99, 0x97,
+    0x1F, 0xFD, 0xA6, 0x9F, 0xFF, 0x59, 0xFF, 0xFC, 0x4A, 0xFA, 0xAA, 0xFD, 0x93, 0xFC, 0x3F, 0xCA,
+    0x3F, 0xC3, 0x9F, 0xA2, 0x9F, 0xA3, 0x9F, 0xA2, 0xAF, 0xA3, 0x9F, 0xA2, 0xAF, 0x93, 0xFC, 0x92,
+    0xFC, 0x29, 0xFD, 0x3F, 0xFF, 0xD9, 0x29, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0x94, 0xFF, 0xEA, 0x6F,
+    0xC1, 0xFC, 0x6F, 0xC1, 0xAF, 0xA4, 0x9F, 0xA2, 0xFC, 0x4A, 0xF9, 0x2F, 0xC9, 0x3F, 0xC3, 0x9F,
+    0xC3, 0xFC, 0x4F, 0xC7, 0x5A, 0xFA, 0x74, 0x9F, 0xC7, 0x5F, 0xC9, 0x75, 0x99, 0x99, 0x10, 0x77,
+    0x79, 0xAF, 0xD9, 0x6A, 0xFF, 0xE5, 0xAF, 0xFF, 0x5F, 0xFF, 0x94, 0xDA, 0x92, 0xAF, 0xA7, 0x4F,
+    0xC7, 0x4F, 0xC7, 0x3A, 0xFA, 0x72, 0xAF, 0xC9, 0x70, 0xAF, 0xE6, 0x9F, 0xFC, 0x59, 0xFF, 0xD5,
+    0xAF, 0xFC, 0x95, 0xFF, 0xC9, 0x69, 0xFD, 0xA7, 0x1F, 0xD7, 0x3F, 0xC7, 0x39, 0xFA, 0x73, 0x9F,
+    0xA7, 0x4F, 0xC9, 0x49, 0xD3, 0xFF, 0xFD, 0x39, 0xFF, 0xFC, 0x4A, 0xFF, 0xF5, 0x9F, 0xFA, 0x97,
+    0x29, 0x99, 0x70, 0x59, 0x9A, 0xA9, 0x96, 0x9F, 0xFC, 0x93, 0x9F, 0xFE, 0x93, 0xFF, 0xF3, 0xAC,
+    0xA9, 0x19, 0xFC, 0x97, 0x1A, 0xF9, 0x71, 0xFC, 0x79, 0xAF, 0xD5, 0xAF, 0xF9, 0x3A, 0xFF, 0xC9,
+    0x3F, 0xFC, 0xA4, 0xFE, 0xA9, 0x59, 0xFC, 0xA7, 0x09, 0xF9, 0x71, 0xAF, 0x95, 0x92, 0x9F, 0xC9,
+    0x99, 0x9A, 0xD3, 0xFF, 0xF3, 0x9F, 0xFE, 0x5A, 0xFE, 0xA9, 0x70, 0x99, 0x96, 0x5F, 0xFF, 0xD9,
+    0x49, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xD5, 0xAF, 0xFF, 0xD5, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x99,
+    0x6F, 0xC7, 0x7A, 0xF7, 0x79, 0xFA, 0x77, 0xFC, 0x77, 0x9F, 0x97, 0x7F, 0xC7, 0x7A, 0xF7, 0x69,
+    0xFA, 0x75, 0x9F, 0xA7, 0x59, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x76, 0xFC, 0x97, 0x5F, 0xC9, 0x75,
+    0xAF, 0xA7, 0x59, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xE9, 0x3A, 0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0x40,
+    0x39, 0x99, 0x94, 0xAF, 0xD2, 0xAF, 0xF1, 0xE9, 0xAF, 0x99, 0xD9, 0x1F, 0x90, 0xDA, 0x09, 0xF9,
+    0x0F, 0xFC, 0x91, 0xFF, 0x39, 0x9F, 0xC5, 0xFA, 0x49, 0xF9, 0x4A, 0xF5, 0xFC, 0x5F, 0xC5, 0xFA,
+    0x49, 0xF9, 0x4A, 0xF5, 0xFC, 0x5F, 0xA4, 0x9F, 0xA4, 0x9F, 0x94, 0xAF, 0x5F, 0xC5, 0xFA, 0x49,
+    0xF9, 0x4A, 0xF5, 0xFC, 0x5F, 0xC5, 0xFA, 0x5F, 0xC2, 0x91, 0xFF, 0xC9, 0x0F, 0xFC, 0x90, 0x9F,
+    0xF9, 0x2A, 0xFA, 0x90, 0x77, 0x3E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0xAF, 0x6A, 0xFF, 0xD1, 0xFF,
+    0xF0, 0x9F, 0xFE, 0xA1, 0xAA, 0xFC, 0xAA, 0xAA, 0x93, 0xFA, 0x79, 0xF9, 0x7A, 0xF9, 0x7F, 0xC7,
+    0x0F, 0xC7, 0x9F, 0xA7, 0x9F, 0x97, 0xAF, 0x70, 0xFC, 0x70, 0xFC, 0x70, 0xFD, 0xAA, 0xCA, 0x3F,
+    0xFC, 0x93, 0xAF, 0xF5, 0xAF, 0xE7, 0x09, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0x97, 0x0F, 0x59, 0xAA,
+    0xFC, 0x59, 0xFD, 0x95, 0x9F, 0xCA, 0x69, 0xF9, 0x60, 0x39, 0xAA, 0xFF, 0xFC, 0x92, 0xFF, 0xFF,
+    0xC9, 0x1F, 0xFF, 0xFD, 0x1A, 0xFF, 0xFF, 0xD1, 0xFC, 0x99, 0x9F, 0xC9, 0x99, 0x99, 0x90, 0x9F,
+    0x29, 0xFA, 0x69, 0xE9, 0x29, 0xF9, 0x7E, 0x92, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA,
+    0x76, 0xAF, 0x97, 0x6A, 0xF7, 0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7,
+    0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x20, 0x70, 0x99,
+    0x99, 0x7F, 0xDA, 0x5F, 0xEA, 0x4F, 0xFA, 0x4F, 0xCA, 0x9A, 0x93, 0xAF, 0x97, 0xFC, 0x70, 0xFC,
+    0x6A, 0xFF, 0xD1, 0xFF, 0xF0, 0x9F, 0xFE, 0xA1, 0xAA, 0xFC, 0xAA, 0xAA, 0x93, 0xFA, 0x79, 0xF9,
+    0x7A, 0xF9, 0x7F, 0xC7, 0x0F, 0xC7, 0x9F, 0xA7, 0x9F, 0x97, 0xAF, 0x70, 0xFC, 0x70, 0xFC, 0x70,
+    0xFD, 0xAD, 0x4F, 0xFC, 0x4A, 0xFF, 0x5A, 0xFD, 0xA7, 0x09, 0x96, 0x09, 0xFF, 0xFF, 0x1A, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF9, 0x19, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F, 0xC7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x5F, 0xA7, 0x49,
+    0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF9, 0x74,
+    0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x75, 0xFC, 0x74, 0x9F,
+    0xC7, 0x5F, 0xF7, 0x2F, 0xF7, 0x29, 0xFE, 0x74, 0xAF, 0xA7, 0x00, 0x77, 0x79, 0x99, 0x97, 0x77,
+    0xAF, 0xA2, 0x9F, 0x96, 0xAF, 0x1F, 0xC3, 0xAF, 0x96, 0xFC, 0x1F, 0xA3, 0xFC, 0x7F, 0xC0, 0xFC,
+    0x4F, 0xC6, 0x9F, 0xFD, 0x94, 0xFC, 0x6A, 0xFF, 0xC9, 0x49, 0xFA, 0x6F, 0xF9, 0x6A, 0xF9, 0x6F,
+    0xC7, 0x2F, 0xC7, 0xFC, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x19, 0xFA, 0x6F,
+    0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFA, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF,
+    0x97, 0x1A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x5A, 0xFA, 0x72, 0xAF, 0xA5,
+    0xFC, 0x73, 0x9F, 0xC9, 0x29, 0xFC, 0xA7, 0x4F, 0xFF, 0xE7, 0x5A, 0xFF, 0xFC, 0x77, 0xAF, 0xFE,
+    0x77, 0x19, 0xFF, 0x97, 0x75, 0x99, 0x97, 0x73, 0x77, 0x4F, 0xC7, 0x75, 0xFC, 0x77, 0x4A, 0xF9,
+    0x3F, 0xC4, 0x9F, 0x90, 0xFC, 0x4F, 0xC4, 0xAF, 0xAF, 0xC4, 0x9F, 0xA4, 0xFF, 0xD5, 0xAF, 0x94,
+    0xFF, 0xA6, 0xAF, 0x49, 0xFC, 0xA9, 0x70, 0xFC, 0x4A, 0xF9, 0x72, 0xFC, 0x4F, 0xC7, 0x29, 0xFA,
+    0x4F, 0xC7, 0x2A, 0xF9, 0x4F, 0xA7, 0x2F, 0xC4, 0xAF, 0xA7, 0x2F, 0xC4, 0xFC, 0x97, 0x2F, 0xA3,
+    0x9F, 0xC7, 0x3F, 0xA3, 0xFD, 0x72, 0x9F, 0xC2, 0xAF, 0xCA, 0x73, 0xFD, 0xAF, 0xE9, 0x73, 0xFF,
+    0xCA, 0xF7, 0x49, 0xFE, 0xA0, 0xF7, 0x59, 0xFC, 0x91, 0xF7, 0x79, 0x97, 0x74, 0x9A, 0xAA, 0xA2,
+    0x9F, 0xA2, 0xFC, 0x3F, 0x93, 0xF4, 0xE0, 0x3A, 0xAA, 0xAA, 0x3F, 0xCA, 0x29, 0xFA, 0x3F, 0xA3,
+    0xF9, 0x39, 0xE5, 0x49, 0xAA, 0xAA, 0xA6, 0x9F, 0xDA, 0x49, 0xFF, 0x39, 0xF9, 0xAE, 0xA1, 0x9F,
+    0x2A, 0xE9, 0x0E, 0xA4, 0xAD, 0xA0, 0x73, 0x99, 0x29, 0xF9, 0x2E, 0x19, 0xFE, 0xAE, 0xA1, 0xFF,
+    0xF1, 0x9D, 0xA0, 0x9F, 0xD9, 0x19, 0xD3, 0x9A, 0xCA, 0x30, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0xFF, 0xDA, 0xFF, 0xCA, 0xAF, 0xFC, 0x90, 0x76, 0x9F, 0xFF, 0xC0, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF,
+    0xC0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x9A, 0xA5, 0xAA, 0xA0, 0xAD, 0xA3, 0x9E, 0x0A,
+    0xEA, 0xAA, 0xF9, 0x1F, 0xFD, 0x29, 0xFE, 0xA5, 0xAA, 0xCA, 0xA9, 0x30, 0x19, 0x92, 0xF9, 0xAF,
+    0xAF, 0xCA, 0xAF, 0x19, 0xA9, 0x10, 0x74, 0xAD, 0x91, 0x9D, 0xA0, 0x9F, 0x1F, 0x0A, 0xF0, 0x9F,
+    0x09, 0xE9, 0x1E, 0xA2, 0x94, 0x92, 0x9A, 0xAA, 0xA2, 0xFD, 0x90, 0xFE, 0x09, 0x1F, 0x3A, 0xE1,
+    0x9A, 0xE9, 0x1F, 0x92, 0xE7, 0x30, 0x1A, 0xDA, 0x92, 0xFD, 0xA0, 0xAD, 0xA9, 0xE0, 0xE2, 0xD9,
+    0xE1, 0x9D, 0x9A, 0xDA, 0xAE, 0x1F, 0xD9, 0x2A, 0xDA, 0x91, 0x39, 0xAA, 0xAA, 0x1A, 0xAA, 0xA9,
+    0x29, 0xF9, 0x0A, 0xF3, 0xF9, 0x09, 0xF3, 0xF9, 0x1F, 0x3A, 0xE2, 0xEA, 0x39, 0xDA, 0x29, 0xD9,
+    0x40, 0x0A, 0xAA, 0x94, 0x9A, 0xAA, 0x1A, 0xE3, 0xAE, 0x92, 0xF1, 0xF9, 0x39, 0xFF, 0x95, 0xFE,
+    0x96, 0x9F, 0xC9, 0x40, 0x19, 0xAA, 0x91, 0xE9, 0x1E, 0x19, 0xE1, 0xAE, 0x1A, 0xDA, 0x1E, 0x91,
+    0xE1, 0x9E, 0x19, 0x99, 0x91, 0x1A, 0xAA, 0x2A, 0xAA, 0x2E, 0x1A, 0xE1, 0x9E, 0x1A, 0xDA, 0x1A,
+    0xDA, 0x1E, 0x91, 0xEA, 0x1E, 0x2E, 0x90, 0x9E, 0x75, 0x0A, 0xAA, 0xA9, 0x09, 0xAA, 0xAA, 0x2A,
+    0xF0, 0x9F, 0x3F, 0x90, 0xAE, 0x93, 0xEA, 0x1F, 0x39, 0xE2, 0xE9, 0x39, 0xD9, 0x2D, 0xA0, 0x49,
+    0x97, 0x0A, 0xE7, 0xF9, 0x29, 0xAA, 0x0F, 0x09, 0xAA, 0xAD, 0x1A, 0xA1, 0xDA, 0x9D, 0xA3, 0xE1,
+    0xFF, 0xCA, 0x2F, 0xEA, 0x49, 0xAD, 0xA9, 0x20, 0x49, 0xAA, 0xA9, 0x5F, 0xF3, 0xFF, 0xD1, 0xAF,
+    0xFD, 0x1E, 0x93, 0xE9, 0x0D, 0xA4, 0x9D, 0x90, 0x3A, 0xE4, 0xF3, 0xF9, 0x29, 0xF3, 0xFA, 0x29,
+    0xF3, 0xFC, 0x29, 0xF9, 0x39, 0x99, 0x93, 0x2A, 0xF3, 0xFC, 0x29, 0xF9, 0x2F, 0xC3, 0xF9, 0x2A,
+    0xEA, 0x3F, 0x39, 0xEA, 0x39, 0x99, 0x94, 0xF9, 0xFA, 0xFA, 0xAE, 0xAA, 0xEA, 0x9E, 0xA0, 0xEA,
+    0x0E, 0xA0, 0x99, 0x90, 0x2A, 0xF3, 0xFC, 0x29, 0xF9, 0x2F, 0xC3, 0xF9, 0x2A, 0xEA, 0x3F, 0x39,
+    0xEA, 0x39, 0x99, 0x94, 0x9A, 0xAA, 0xA9, 0x2F, 0xC2, 0x9F, 0x3A, 0xEA, 0x3F, 0x4A, 0xD9, 0x39,
+    0xAA, 0xAA, 0x92, 0x9F, 0xC3, 0xFC, 0x3A, 0xF3, 0x9F, 0x4E, 0xA4, 0x72, 0x9D, 0x3A, 0xCA, 0x9F,
+    0xC9, 0xAF, 0xC3, 0x9D, 0x39, 0xCA, 0x49, 0x10, 0x71, 0xD4, 0x9D, 0x49, 0xFC, 0x90, 0xAF, 0xC1,
+    0xD9, 0x4D, 0x59, 0x94, 0x19, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFC, 0xA0, 0xAA, 0xAA, 0xAA, 0xAD,
+    0x97, 0xD7, 0x0D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x70, 0xAA, 0x10, 0x39, 0xAA, 0xAA, 0x4F,
+    0xC3, 0x9F, 0xA3, 0xFC, 0x29, 0xFC, 0x91, 0xAF, 0xCA, 0x2A, 0xF9, 0x3D, 0xA9, 0x77, 0x39, 0x2E,
+    0x1F, 0x09, 0xD9, 0x1A, 0xD2, 0xAD, 0x3E, 0x29, 0xCA, 0x70, 0x39, 0x94, 0x9C, 0xA4, 0xAC, 0xA4,
+    0xD9, 0x19, 0xFD, 0x9A, 0xFD, 0x90, 0x09, 0x99, 0x99, 0x99, 0x1F, 0xE1, 0xAA, 0xEA, 0xA3, 0xD9,
+    0x5D, 0x6D, 0x30, 0x73, 0xD4, 0x9D, 0x2A, 0xAE, 0xAA, 0x0F, 0xDA, 0x09, 0x9D, 0x99, 0x29, 0xD4,
+    0x9A, 0x92, 0x79, 0xFE, 0xAF, 0xDA, 0x39, 0xAA, 0xA9, 0x3A, 0xEA, 0x3F, 0x93, 0xF3, 0x9F, 0x3A,
+    0xEA, 0x0A, 0xAA, 0xF9, 0x0F, 0xE1, 0xFD, 0x2A, 0xEA, 0x30, 0x09, 0xAA, 0xA9, 0x2F, 0x92, 0xF3,
+    0xF2, 0x9F, 0x2A, 0xF2, 0x9F, 0xDA, 0x0F, 0xDA, 0x09, 0xFC, 0xA2, 0xAA, 0xAA, 0x00, 0x1A, 0xD9,
+    0x1F, 0xC9, 0x0F, 0xC9, 0x0F, 0xC1, 0x9E, 0x97, 0x74, 0x9D, 0xA1, 0x9E, 0x1F, 0x1F, 0x90, 0xF1,
+    0xF9, 0x0E, 0xA1, 0xAE, 0x29, 0x59, 0x10, 0x1A, 0xDA, 0x92, 0xFD, 0x90, 0xAD, 0xA9, 0xE0, 0xDA,
+    0x19, 0xD9, 0xDA, 0x19, 0xD9, 0xAD, 0xAA, 0xE1, 0xFD, 0x92, 0xAD, 0xA9, 0x10, 0x1F, 0xA0, 0xAF,
+    0x1F, 0x90, 0x9E, 0xA1, 0xEA, 0x29, 0x99, 0x30, 0x2A, 0xDA, 0x4E, 0xA3, 0x9F, 0xC4, 0xAE, 0x93,
+    0xAE, 0x90, 0xFE, 0x1F, 0xDA, 0x1F, 0xA9, 0x10, 0x19, 0xE9, 0x09, 0xE1, 0x9E, 0x2F, 0x2F, 0x2F,
+    0xD9, 0xAF, 0xC9, 0x0A, 0xF7, 0x2A, 0xAA, 0x29, 0xE2, 0xAD, 0xA2, 0xE9, 0x2E, 0x29, 0xE2, 0xAE,
+    0x2E, 0xA2, 0xE9, 0x29, 0x99, 0x20, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFE, 0xA0,
+    0xAD, 0xAA, 0xAA, 0xAA, 0xAD, 0x90, 0xAC, 0xA6, 0xD1, 0xD9, 0x59, 0xD1, 0xD6, 0xAC, 0xA1, 0x99,
+    0x79, 0x10, 0xAC, 0x3C, 0x92, 0xDA, 0xC2, 0xDA, 0x1A, 0xCA, 0x9F, 0xFE, 0x19, 0xDA, 0x90, 0xAD,
+    0xA1, 0x9A, 0xA9, 0x5A, 0xAA, 0x90, 0xEA, 0x29, 0xF1, 0xAE, 0xA0, 0xAF, 0x3F, 0xFC, 0x49, 0xFE,
+    0x6F, 0xD4, 0x4A, 0xAA, 0xAA, 0x96, 0xFE, 0x5A, 0xFE, 0xA3, 0xAF, 0x0F, 0x91, 0xFA, 0x2F, 0x0A,
+    0xE9, 0x4E, 0x90, 0x0A, 0xAA, 0x5A, 0xA9, 0x0E, 0x4E, 0x90, 0xFA, 0xAA, 0xF1, 0xAF, 0xFC, 0x92,
+    0xAF, 0xE9, 0x49, 0xAD, 0xA9, 0x30, 0x39, 0xAA, 0xA9, 0x59, 0xFE, 0xA2, 0x9F, 0xFC, 0x91, 0xFC,
+    0xAF, 0xC0, 0x9E, 0x39, 0xE0, 0x9D, 0x94, 0xAD, 0x00, 0x73, 0x99, 0x29, 0xF9, 0x2E, 0x19, 0xFE,
+    0xAE, 0xA1, 0xFF, 0xF1, 0x9D, 0xA0, 0x9F, 0xD9, 0x19, 0xD3, 0x9A, 0xCA, 0x30, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x91, 0xFF, 0xD9, 0x0F, 0xFD, 0x1F, 0xFD, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xFE, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF,
+    0xFC, 0x1A, 0xFF, 0xFA, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x19, 0xFF, 0xFC,
+    0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0x73, 0x92, 0xAF, 0x92, 0xDA, 0x0A, 0xFD, 0xAA,
+    0xE9, 0x0F, 0xFF, 0x0A, 0xD9, 0x09, 0xFD, 0x1A, 0xCA, 0x39, 0xAC, 0xA2, 0x77, 0xFF, 0xFC, 0x99,
+    0xFF, 0xFC, 0x09, 0xFF, 0xFC, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x72, 0xAF,
+    0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xEA, 0x77, 0x72, 0x70, 0xA9, 0x79, 0xE6,
+    0xFC, 0xA3, 0xAF, 0xD2, 0x9F, 0xD9, 0x2F, 0xDA, 0x3A, 0xFA, 0x6E, 0x97, 0x9A, 0x70, 0x77, 0x99,
+    0x97, 0x79, 0xE7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0xAD, 0xA7, 0x69,
+    0xE7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0xAD, 0xA7, 0x69, 0xE7, 0x7E,
+    0x97, 0x69, 0xE7, 0x7E, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0xAD, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x69,
+    0xE7, 0x7E, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0x7D, 0x92, 0xE2, 0x9D, 0x92, 0xD9, 0x19, 0xD9, 0x0F,
+    0x09, 0xE2, 0x93, 0x19, 0x97, 0x99, 0x1D, 0x69, 0xCA, 0x09, 0xD6, 0xAC, 0xA0, 0xAC, 0xA6, 0xD9,
+    0x0E, 0xAA, 0xAA, 0xAA, 0xAD, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x77, 0xFF,
+    0xEA, 0x1D, 0xAA, 0xAA, 0xAA, 0xAD, 0x91, 0xCA, 0x6D, 0x19, 0xC9, 0x6D, 0x1A, 0xC9, 0x59, 0xCA,
+    0x1F, 0xFE, 0x91, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x19, 0xE9, 0x0A, 0xDA, 0x1A, 0xDA, 0xFA,
+    0xDA, 0x9C, 0xA1, 0x9D, 0x2D, 0xAC, 0x3C, 0x92, 0xCA, 0x1A, 0x2A, 0x1A, 0xD0, 0xDA, 0x1F, 0xA2,
+    0xAE, 0x29, 0xF1, 0x9D, 0x9E, 0x1A, 0x2A, 0x10, 0x39, 0xAC, 0x3F, 0x29, 0xD4, 0xAC, 0xA4, 0x9D,
+    0x5D, 0xA4, 0xAD, 0x4D, 0xA2, 0xAE, 0x3A, 0xA9, 0x30, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x0A, 0xFF, 0xFC, 0x0F, 0xFF, 0xCA, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A,
+    0xFF, 0xFC, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0A, 0xAA, 0xA9, 0x2F, 0xC2, 0x9F,
+    0x92, 0xAE, 0xA3, 0xAE, 0x4A, 0xD9, 0x29, 0xAA, 0xAA, 0xA3, 0xFC, 0x92, 0xAF, 0x92, 0x9F, 0x93,
+    0xF4, 0xAD, 0xA5, 0x73, 0x92, 0xAF, 0x92, 0xDA, 0x0A, 0xFD, 0xAA, 0xE9, 0x0F, 0xFF, 0x0A, 0xD9,
+    0x09, 0xFD, 0x1A, 0xCA, 0x39, 0xAC, 0xA2, 0x9E, 0xA0, 0x9F, 0xC9, 0xAF, 0x19, 0xE1, 0xE9, 0x1A,
+    0xC9, 0x60, 0x69, 0xFC, 0x5A, 0xDA, 0x1F, 0xC9, 0x0E, 0x99, 0xF0, 0x9F, 0xA0, 0xFA, 0xAE, 0xA0,
+    0xAE, 0xA1, 0xF9, 0xAE, 0x1F, 0x2F, 0x29, 0x19, 0xE4, 0x92, 0x1E, 0xA1, 0x9E, 0x91, 0xAE, 0x91,
+    0xFC, 0xA0, 0xFC, 0x91, 0xF0, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFC, 0x1A,
+    0xDA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1D, 0x97, 0xAC, 0xA1, 0xD7, 0x0D, 0x90, 0x9D, 0x70, 0xD2, 0x97,
+    0x19, 0x91, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFC, 0x1A, 0xFF, 0xFA, 0x77,
+    0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x19, 0xFF, 0xFC, 0x19, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x91, 0x09, 0xAA, 0x91, 0xAA, 0xA1, 0xE9, 0x1E, 0x1E, 0x90, 0x9E, 0x09, 0xE1, 0xAE,
+    0x09, 0xE1, 0xEA, 0x0A, 0xDA, 0x1E, 0x97, 0x30, 0x9F, 0xDA, 0xFC, 0xA3, 0xD9, 0x3D, 0x4D, 0x39,
+    0xD0, 0x69, 0x79, 0x99, 0x0D, 0x19, 0x91, 0xAF, 0xC9, 0x09, 0xCA, 0x09, 0xFE, 0xAD, 0x90, 0xD9,
+    0x0F, 0xDA, 0x1C, 0xA0, 0x9C, 0xA9, 0xAA, 0x95, 0x9C, 0x77, 0x30, 0x69, 0x71, 0x9E, 0x70, 0xF7,
+    0x0F, 0x71, 0xAA, 0x6A, 0xE9, 0x2A, 0xC9, 0x0F, 0xDA, 0x9A, 0xD0, 0x9D, 0x99, 0xFD, 0x90, 0xD3,
+    0x9E, 0x95, 0x9A, 0x97, 0x09, 0xE9, 0x7A, 0xE9, 0x7A, 0xE7, 0x29, 0x60, 0x39, 0xAA, 0x39, 0xA9,
+    0x2F, 0xD9, 0x9D, 0x2A, 0xFF, 0xCA, 0x2D, 0x2A, 0xEA, 0x77, 0x2E, 0xA2, 0xAC, 0x92, 0xFD, 0xAA,
+    0xD2, 0xAC, 0xA9, 0xAF, 0xC9, 0x2D, 0x3A, 0xCA, 0x30, 0x79, 0x6A, 0xC2, 0xAC, 0x92, 0x9F, 0xFC,
+    0x91, 0xFF, 0xDA, 0x2D, 0xA1, 0x9D, 0x94, 0xA9, 0x19, 0xA7, 0x70, 0x71, 0x9C, 0x3A, 0xDA, 0x1A,
+    0xF9, 0x19, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x20, 0xAF, 0x3A, 0xFA, 0x3F, 0xAF, 0xC9, 0x2A, 0xFA,
+    0x29, 0xFE, 0x77, 0x3F, 0x77, 0x3F, 0x59, 0x90, 0xD0, 0x99, 0x5D, 0x99, 0x5A, 0xC0, 0xAA, 0x0C,
+    0xA5, 0x99, 0x5C, 0xA7, 0xAC, 0x73, 0xA9, 0x79, 0xA7, 0x2A, 0x73, 0xA9, 0x39, 0x91, 0x9C, 0x73,
+    0xCA, 0x19, 0x9D, 0x77, 0x3F, 0x1A, 0x97, 0x4C, 0x1F, 0x1C, 0x97, 0x39, 0xC1, 0xF7, 0x73, 0xDA,
+    0xA1, 0x9C, 0x73, 0xCA, 0x1A, 0xA3, 0x9C, 0x73, 0xC9, 0x71, 0xA9, 0x79, 0xA7, 0x3C, 0xA7, 0xAC,
+    0x75, 0xAC, 0x09, 0x90, 0xCA, 0x7D, 0x59, 0xA0, 0xD0, 0xA9, 0x5F, 0x77, 0x3F, 0x77, 0x3F, 0xE3,
+    0xAF, 0xA3, 0xFF, 0xD9, 0x2A, 0xFA, 0x29, 0xFC, 0x5D, 0x92, 0xAE, 0x92, 0xAD, 0xA1, 0xAD, 0xAA,
+    0xEA, 0x0D, 0x97, 0x00, 0x39, 0x2A, 0xD1, 0xF0, 0x9D, 0x91, 0xAD, 0x2A, 0xD3, 0xE2, 0x9D, 0x70,
+    0x49, 0x99, 0x59, 0xFD, 0xA2, 0x9F, 0xFC, 0x1E, 0xA9, 0x99, 0xE9, 0x9D, 0x94, 0xDA, 0xAD, 0x0A,
+    0xDA, 0x0D, 0xA3, 0xF7, 0xF7, 0x9C, 0xA4, 0x1A, 0x1A, 0x2D, 0xAE, 0x2F, 0x92, 0xF2, 0xFC, 0xA1,
+    0x9C, 0x90, 0xCA, 0x70, 0x39, 0x91, 0x9D, 0xA9, 0xEA, 0x0E, 0x2A, 0xE9, 0x2A, 0xDA, 0x3A, 0xA0,
+    0x0A, 0x5D, 0xA3, 0x9E, 0xA3, 0xAD, 0x91, 0xAE, 0x90, 0xE9, 0x2C, 0x93, 0x97, 0x3D, 0xA9, 0x3E,
+    0x2F, 0x91, 0xE3, 0x9D, 0xA0, 0xAC, 0xAC, 0xA1, 0x9E, 0xA0, 0xD0, 0xD0, 0xAD, 0xA1, 0x9C, 0xA0,
+    0xAC, 0x9A, 0xA3, 0xAC, 0x2C, 0xA0, 0x69, 0xCA, 0x29, 0xDA, 0x2A, 0xD2, 0x9D, 0x2A, 0xD0, 0x9E,
+    0xA0, 0xAD, 0xA1, 0x99, 0x30, 0x19, 0x92, 0xF9, 0xAF, 0xAF, 0xCA, 0xAF, 0x19, 0xA9, 0x10, 0x29,
+    0xA9, 0x59, 0xC9, 0x3A, 0xCA, 0xCA, 0xCA, 0x1A, 0xFC, 0xA2, 0x9E, 0x93, 0xD9, 0xD3, 0x9A, 0x0A,
+    0x91, 0x75, 0x9E, 0xA0, 0xAE, 0x90, 0x9D, 0xAA, 0xFA, 0xD9, 0xAC, 0x2A, 0xCA, 0x2F, 0x29, 0xC9,
+    0x2D, 0xAC, 0x2A, 0xCA, 0x2D, 0x9D, 0xAF, 0xCA, 0xD9, 0x09, 0xEA, 0x0A, 0xE9, 0x00, 0x7C, 0xA3,
+    0x9C, 0x93, 0xAF, 0xC0, 0xFD, 0x4C, 0xA3, 0x9C, 0x97, 0x9A, 0xA9, 0x77, 0x1A, 0xAA, 0x90, 0xE9,
+    0x77, 0xF1, 0xAE, 0xA7, 0x39, 0xAF, 0x3F, 0xDA, 0x99, 0x99, 0x99, 0xAA, 0xFD, 0x5F, 0xFF, 0xFD,
+    0xA7, 0x9F, 0xFF, 0xDA, 0x74, 0x9A, 0xFE, 0xA9, 0x70, 0x9A, 0xA9, 0x77, 0x1A, 0xAA, 0x09, 0xE9,
+    0x76, 0x9E, 0xA1, 0xFA, 0x73, 0x9F, 0xC3, 0xFD, 0xA9, 0x99, 0x99, 0x9A, 0xAF, 0xCA, 0x5F, 0xFF,
+    0xFD, 0x97, 0xAF, 0xFF, 0xDA, 0x73, 0x9A, 0xAF, 0xDA, 0xA9, 0x70, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xFA, 0xAF, 0xFF, 0xF9, 0xAF, 0xFF, 0xF0, 0x09, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFF, 0xF9, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC,
+    0x00, 0x59, 0x97, 0x79, 0x93, 0xAF, 0xFA, 0x97, 0x0A, 0xD2, 0xFF, 0xFE, 0xAA, 0xAA, 0xAE, 0xA1,
+    0xFF, 0xFF, 0xFF, 0x19, 0xDA, 0x59, 0xAF, 0xFE, 0xA2, 0xAC, 0xA7, 0x39, 0xAA, 0xAA, 0xAA, 0x40,
+    0x71, 0x99, 0xAA, 0xAA, 0xA9, 0x97, 0x69, 0xFF, 0xFC, 0x97, 0x19, 0xFF, 0xFF, 0xC7, 0xFF, 0xAA,
+    0xAA, 0xFF, 0x94, 0xFC, 0xA9, 0x70, 0x9F, 0xC3, 0xF9, 0x75, 0x9E, 0xA1, 0xAD, 0xA7, 0x70, 0x9E,
+    0x00, 0x77, 0x77, 0x77, 0x9A, 0x77, 0x70, 0x9D, 0x3F, 0xFF, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0xFF,
+    0xC1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAD, 0xA7, 0x76, 0x9C, 0x97,
+    0x77, 0x94, 0x72, 0xAD, 0xAA, 0xC9, 0x0A, 0xDA, 0xE1, 0xD9, 0x09, 0xD0, 0x9D, 0x1A, 0xCA, 0x0A,
+    0xD1, 0xD9, 0x0A, 0xD0, 0xAD, 0x2F, 0xD3, 0x99, 0x09, 0x91, 0x73, 0xAE, 0x92, 0xDA, 0x9D, 0x1A,
+    0xCA, 0x09, 0xD1, 0xFD, 0x91, 0xD9, 0x94, 0xD9, 0x19, 0x2A, 0xFC, 0x49, 0x99, 0x20, 0x19, 0xC9,
+    0x1A, 0xCA, 0x6D, 0x19, 0xD1, 0xAC, 0xA1, 0xD9, 0x1D, 0x19, 0xD1, 0xAC, 0xA2, 0x92, 0x71, 0x9E,
+    0xA1, 0xAD, 0xAD, 0xA0, 0xD9, 0x09, 0xD9, 0xD1, 0x9D, 0xAC, 0xA1, 0xAC, 0xA9, 0xD0, 0x9D, 0x1F,
+    0xC9, 0x29, 0x99, 0x20, 0x09, 0xCA, 0x1D, 0x90, 0xAC, 0x91, 0xD1, 0xD1, 0x9D, 0x1D, 0x1A, 0xCA,
+    0x09, 0xD1, 0xD9, 0x09, 0xD0, 0xAD, 0x2E, 0xAD, 0x39, 0x90, 0x99, 0x10, 0x70, 0xAE, 0xA0, 0xAD,
+    0xAA, 0x99, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAD, 0x19, 0x1F, 0xC2, 0x99, 0x91, 0x6D, 0x69, 0xD6,
+    0xAC, 0xA2, 0xAD, 0xAD, 0x91, 0xAD, 0xAE, 0x2D, 0x90, 0x9D, 0x19, 0xD1, 0x9C, 0xA1, 0xAC, 0xA1,
+    0xD9, 0x19, 0xD0, 0x9D, 0x3F, 0xD4, 0x99, 0x09, 0x92, 0x2A, 0xC9, 0x5D, 0x95, 0xD5, 0x9D, 0xAD,
+    0x91, 0xAD, 0xAA, 0xD1, 0xDA, 0x09, 0xD1, 0xD1, 0x9D, 0x09, 0xD1, 0xAC, 0xA0, 0xAC, 0xA1, 0xD9,
+    0x0D, 0x91, 0xD1, 0x99, 0x29, 0x90, 0x77, 0xAC, 0x9E, 0x0A, 0xDA, 0x2E, 0xAF, 0xAD, 0x2D, 0x90,
+    0xAD, 0x1D, 0x19, 0xD1, 0xD9, 0x1D, 0x1A, 0xCA, 0x1D, 0x19, 0xD1, 0xD9, 0x09, 0xD1, 0xAC, 0xA1,
+    0xD1, 0xAC, 0xA1, 0xD9, 0x19, 0x92, 0x92, 0x99, 0x10, 0x70, 0xD9, 0xD0, 0x9F, 0xA0, 0xAD, 0x3D,
+    0xA3, 0xD4, 0xD3, 0x9D, 0x49, 0x40, 0x29, 0x94, 0xCA, 0x2A, 0xF9, 0x0A, 0xDA, 0xA1, 0x9D, 0x39,
+    0xCA, 0x3A, 0xC9, 0x3D, 0x93, 0xF3, 0x99, 0x91, 0xAC, 0x91, 0xAC, 0xAA, 0xC9, 0x1D, 0x0A, 0xCA,
+    0x0D, 0x90, 0x9C, 0xA9, 0xD1, 0x9C, 0xAD, 0x3E, 0xA3, 0xE4, 0x99, 0x40, 0x19, 0xD1, 0xDA, 0x2D,
+    0x9D, 0xA3, 0xAE, 0xA5, 0xE5, 0xF4, 0xDA, 0xD9, 0x2A, 0xD0, 0x9D, 0x29, 0x92, 0x99, 0x10, 0x73,
+    0xAF, 0xC9, 0x75, 0xFD, 0xA7, 0x4A, 0xFE, 0x73, 0x9F, 0xF7, 0x3F, 0xAF, 0x72, 0x9F, 0x9F, 0x72,
+    0xFA, 0x0F, 0x71, 0x9F, 0x90, 0xF9, 0x70, 0xFC, 0x1F, 0x97, 0x9F, 0x91, 0xF9, 0x7F, 0xC2, 0xFA,
+    0x69, 0xF9, 0x2A, 0xEA, 0x6F, 0xC3, 0xAF, 0x59, 0xF9, 0x3A, 0xF5, 0xFF, 0xFE, 0x4A, 0xFF, 0xFE,
+    0x4F, 0xFF, 0xF3, 0xAF, 0xFF, 0xF9, 0x2F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x91, 0xAF, 0x97, 0xF9,
+    0x1F, 0xC7, 0x0F, 0xA0, 0xAF, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0xAF, 0x97, 0x1F, 0xC0, 0x5F,
+    0xFA, 0xA9, 0x70, 0x9F, 0xFF, 0x96, 0xAF, 0xFF, 0xC9, 0x5F, 0xFF, 0xE5, 0xFC, 0x99, 0x99, 0xFD,
+    0x94, 0xFC, 0x4F, 0xC9, 0x39, 0xFA, 0x4F, 0xC9, 0x3A, 0xF9, 0x4F, 0xC4, 0xFC, 0x49, 0xFA, 0x4F,
+    0xC9, 0x99, 0x9A, 0xFC, 0x49, 0xFF, 0xFC, 0xA5, 0x9F, 0xFE, 0xA7, 0xAF, 0xFF, 0xA6, 0xFC, 0xAA,
+    0xAA, 0xFD, 0x5F, 0xC4, 0xFC, 0x93, 0x9F, 0xA4, 0x9F, 0xA3, 0xAF, 0x94, 0x9F, 0xA3, 0xFC, 0x59,
+    0xFA, 0x3F, 0xC5, 0xFC, 0x93, 0xFC, 0x39, 0xFD, 0x39, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xDA, 0x4F,
+    0xFF, 0xD9, 0x5F, 0xFE, 0xA9, 0x60, 0x5F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xFC, 0x95, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC7, 0x59, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC7, 0x50, 0x73, 0x9F, 0xD7, 0x6F, 0xE7, 0x5A, 0xFE, 0x97, 0x4F, 0xF9, 0x73, 0xAF, 0xFA,
+    0x73, 0xF9, 0xAE, 0xA7, 0x2A, 0xF0, 0xAF, 0x71, 0x9F, 0x90, 0xAF, 0x71, 0xFC, 0x19, 0xF7, 0x09,
+    0xF9, 0x19, 0xF7, 0x0F, 0xC2, 0x9F, 0x96, 0xAF, 0x93, 0xF9, 0x6F, 0xC4, 0xFA, 0x5A, 0xF9, 0x4F,
+    0xA5, 0xFA, 0x5F, 0xC4, 0xAF, 0x6A, 0xF3, 0x9F, 0xA6, 0xAF, 0x3F, 0xC7, 0xAF, 0x91, 0x9F, 0xA7,
+    0x9F, 0x91, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xFA, 0x09, 0xFF, 0xFF, 0xEA, 0x0F, 0xFF, 0xFF,
+    0xC9, 0xFF, 0xFF, 0xFA, 0x9F, 0xFF, 0xFF, 0x90, 0x5F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF,
+    0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97,
+    0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF,
+    0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F,
+    0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x40,
+    0x4A, 0xFF, 0xFD, 0x94, 0xFF, 0xFE, 0x94, 0xFF, 0xFE, 0x49, 0xFF, 0xFE, 0x59, 0x99, 0x99, 0x99,
+    0x9F, 0xD7, 0x5A, 0xFC, 0x97, 0x49, 0xFC, 0xA7, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xAF, 0xC7, 0x59,
+    0xFC, 0x97, 0x5F, 0xCA, 0x75, 0xFD, 0x75, 0xFD, 0x75, 0xAF, 0xC9, 0x74, 0x9F, 0xCA, 0x75, 0xFC,
+    0xA7, 0x5F, 0xD7, 0x5A, 0xFC, 0x75, 0x9F, 0xCA, 0x75, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xE9, 0x3A,
+    0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0x40, 0x5F, 0xA6, 0x9F, 0x94, 0x9F, 0xA6, 0xFC, 0x5A, 0xF9, 0x6F,
+    0xC5, 0xFC, 0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF,
+    0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x49, 0xFF, 0xFF, 0xC9,
+    0x49, 0xFF, 0xFF, 0xC5, 0xAF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA,
+    0x6F, 0xC9, 0x4A, 0xF9, 0x6F, 0xC5, 0xFC, 0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9,
+    0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC, 0x5F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F, 0xA4, 0x77, 0x77,
+    0x9F, 0xE9, 0x73, 0xAF, 0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F, 0xD9, 0x39,
+    0xFC, 0xA5, 0xFD, 0x3F, 0xCA, 0x69, 0xFC, 0x2A, 0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x70, 0xFC, 0x91,
+    0xFC, 0x71, 0xFC, 0x90, 0x9F, 0xC0, 0xAF, 0xD9, 0x0F, 0xC9, 0x0A, 0xFA, 0x0A, 0xFD, 0x1F, 0xC1,
+    0xFC, 0x90, 0xFE, 0x1F, 0xC1, 0xFC, 0x1F, 0xDA, 0x09, 0xFC, 0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7,
+    0x1F, 0xC9, 0x1F, 0xC9, 0x7A, 0xFC, 0x2F, 0xCA, 0x7F, 0xCA, 0x2A, 0xFC, 0x6F, 0xD4, 0xFD, 0x92,
+    0x9F, 0xD9, 0x4A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x0F, 0xFF, 0x97, 0x29, 0xFF, 0x97, 0x70,
+    0x99, 0x73, 0x4F, 0xFD, 0x94, 0xFF, 0xD9, 0x39, 0xFF, 0xD5, 0xAF, 0xEA, 0x97, 0xFC, 0x71, 0x9F,
+    0xA7, 0x1A, 0xF9, 0x71, 0xAF, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC,
+    0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7,
+    0x0A, 0xFD, 0xA5, 0x9F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xDA, 0x40, 0x5F, 0xA5, 0xAF, 0xC5, 0x9F,
+    0xA4, 0x9F, 0xC9, 0x5A, 0xF9, 0x39, 0xFC, 0xA6, 0xFC, 0x4F, 0xCA, 0x7F, 0xC3, 0xFD, 0x70, 0xFA,
+    0x2F, 0xD7, 0x09, 0xF9, 0x1A, 0xFC, 0x71, 0xAF, 0x90, 0x9F, 0xC9, 0x71, 0xFC, 0x09, 0xFC, 0x97,
+    0x2F, 0xC0, 0xFC, 0xA7, 0x29, 0xFA, 0xAF, 0xA7, 0x39, 0xFF, 0xD7, 0x4A, 0xFF, 0xD7, 0x4F, 0xFE,
+    0xA7, 0x3F, 0xDA, 0xFC, 0x72, 0x9F, 0xA1, 0xFC, 0x97, 0x1A, 0xF9, 0x1A, 0xFA, 0x71, 0xFC, 0x29,
+    0xFC, 0x71, 0xFC, 0x3F, 0xC9, 0x70, 0xFC, 0x3A, 0xFC, 0x79, 0xFA, 0x4F, 0xC7, 0xAF, 0x94, 0xFC,
+    0xA6, 0xFC, 0x59, 0xFC, 0x6F, 0xC6, 0xFC, 0x94, 0x73, 0xFC, 0xA7, 0x4A, 0xFD, 0x74, 0xFE, 0x73,
+    0xAF, 0xE7, 0x3F, 0xF7, 0x2A, 0xFF, 0x72, 0xFA, 0xF9, 0x70, 0xAF, 0x0F, 0x97, 0x0F, 0xA0, 0xFA,
+    0x7A, 0xF9, 0x0F, 0xA7, 0xFC, 0x1F, 0xA6, 0xAF, 0x91, 0xAF, 0x6F, 0xC2, 0xAF, 0x5A, 0xF9, 0x2A,
+    0xF5, 0xFC, 0x39, 0xF4, 0xAF, 0x93, 0x9F, 0x4F, 0xC4, 0x9F, 0x92, 0xAF, 0x94, 0x9F, 0x92, 0xFC,
+    0x6F, 0x91, 0xAF, 0x96, 0xFA, 0x1F, 0xC7, 0xFA, 0x0A, 0xF9, 0x7F, 0xC0, 0xFC, 0x70, 0xFC, 0xAF,
+    0x97, 0x0F, 0xC0, 0x5F, 0xD9, 0x70, 0x9F, 0xD9, 0x49, 0xFD, 0xA7, 0x0F, 0xE5, 0xAF, 0xDA, 0x7A,
+    0xFE, 0x5F, 0xEA, 0x7F, 0xF5, 0xFE, 0xA6, 0xAF, 0xEA, 0x5F, 0xF6, 0xFF, 0x94, 0x9F, 0xF5, 0xAE,
+    0xAF, 0x5A, 0xEA, 0xF5, 0xFA, 0xF5, 0xF9, 0xF4, 0xAE, 0x9A, 0xEA, 0x5F, 0x9A, 0xE4, 0xF0, 0xFA,
+    0x49, 0xF0, 0xAE, 0x3A, 0xE9, 0x0F, 0x94, 0x9F, 0x0A, 0xE3, 0xF0, 0x9F, 0x5A, 0xF0, 0xAE, 0x2A,
+    0xE9, 0x0A, 0xF5, 0xFA, 0x0A, 0xE9, 0x1F, 0x1F, 0xA5, 0xF9, 0x09, 0xE9, 0x0A, 0xE9, 0x1F, 0x94,
+    0x9F, 0x19, 0xE9, 0x0F, 0x19, 0xF9, 0x4A, 0xF1, 0x9E, 0x9A, 0xE9, 0x1A, 0xF5, 0xFA, 0x19, 0xEA,
+    0xF2, 0xAF, 0x5F, 0x92, 0xFE, 0x92, 0xFA, 0x5F, 0x92, 0xFE, 0x3F, 0x94, 0x9F, 0x3F, 0xD9, 0x29,
+    0xF5, 0xAF, 0x3F, 0xD3, 0xAF, 0x5F, 0xA3, 0xFC, 0x93, 0xFC, 0x5F, 0x93, 0xFC, 0x4F, 0xA4, 0x5F,
+    0xCA, 0x70, 0xF9, 0x49, 0xFD, 0x79, 0xF5, 0xAF, 0xD9, 0x6A, 0xF5, 0xFE, 0xA6, 0xFA, 0x5F, 0xF6,
+    0xFA, 0x49, 0xFF, 0x94, 0x9F, 0x94, 0x9F, 0xFA, 0x49, 0xF5, 0xAE, 0xAA, 0xF4, 0xAF, 0x5F, 0x99,
+    0xF9, 0x3F, 0xA5, 0xF9, 0x0F, 0xA3, 0xF9, 0x49, 0xF1, 0xAF, 0x29, 0xF5, 0xAF, 0x19, 0xF9, 0x1A,
+    0xF5, 0xAF, 0x2F, 0xA1, 0xFC, 0x5F, 0xA2, 0xAF, 0x1F, 0xA5, 0xF9, 0x29, 0xF9, 0x0F, 0x94, 0x9F,
+    0x4F, 0xA9, 0xF5, 0xAF, 0x4F, 0xC9, 0xF5, 0xFC, 0x49, 0xFF, 0xC5, 0xFA, 0x5F, 0xFA, 0x5F, 0x95,
+    0xFF, 0x94, 0x9F, 0x69, 0xFE, 0x5A, 0xF7, 0xFE, 0x5F, 0xA7, 0xFD, 0xA5, 0xFA, 0x7A, 0xFC, 0x94,
+    0x49, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xC9, 0x59, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x70, 0xFF,
+    0xDA, 0x79, 0xFF, 0xDA, 0x7A, 0xFF, 0xD9, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x75, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xD9, 0x3A, 0xFF, 0xFD, 0x4F, 0xFF,
+    0xE4, 0x77, 0x77, 0x9F, 0xE9, 0x73, 0xAF, 0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91,
+    0x9F, 0xD9, 0x39, 0xFC, 0xA5, 0xFD, 0x3F, 0xCA, 0x69, 0xFC, 0x2A, 0xFC, 0x70, 0xFC, 0x2F, 0xC9,
+    0x70, 0xFC, 0x91, 0xFC, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x1F, 0xC9, 0x0A, 0xFA, 0x71, 0xFC, 0x1F,
+    0xC9, 0x71, 0xFC, 0x1F, 0xC7, 0x19, 0xFC, 0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7, 0x1F, 0xC9, 0x1F,
+    0xC9, 0x7A, 0xFC, 0x2F, 0xCA, 0x7F, 0xCA, 0x2A, 0xFC, 0x6F, 0xD4, 0xFD, 0x92, 0x9F, 0xD9, 0x4A,
+    0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x0F, 0xFF, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x73, 0x5F,
+    0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xFC, 0x94, 0xAF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFD, 0x5F, 0xC9, 0x99,
+    0x99, 0x99, 0xAF, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC, 0x5F, 0xC6,
+    0x9F, 0xC5, 0xFC, 0x69, 0xFA, 0x49, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC,
+    0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xFA, 0x49, 0xFA, 0x6F, 0xC9, 0x4A, 0xF9, 0x6F, 0xC5, 0xFC,
+    0x96, 0xFC, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6F, 0xC5, 0xAF, 0x96, 0xFC,
+    0x5F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F, 0xA4, 0x5F, 0xFA, 0x97, 0x19, 0xFF, 0xEA, 0x7A, 0xFF, 0xFC,
+    0x6F, 0xFF, 0xDA, 0x5F, 0xC9, 0x99, 0x9F, 0xD5, 0xFC, 0x4F, 0xC9, 0x39, 0xFA, 0x4A, 0xF9, 0x3A,
+    0xF9, 0x4A, 0xF9, 0x3F, 0xC5, 0xAF, 0x93, 0xFC, 0x5F, 0xC3, 0x9F, 0xA3, 0x9F, 0xD3, 0x9F, 0xCA,
+    0xAA, 0xFE, 0x93, 0xAF, 0xFF, 0xDA, 0x4F, 0xFF, 0xD9, 0x5F, 0xFF, 0xA6, 0x9F, 0xCA, 0xAA, 0x99,
+    0x71, 0xAF, 0x97, 0x6F, 0xC7, 0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F, 0xC7,
+    0x7F, 0xC7, 0x60, 0x5F, 0xFF, 0xD9, 0x49, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xD5, 0xAF, 0xFF, 0xD5,
+    0xAF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x7A, 0xF7, 0x79, 0xFA, 0x77, 0xFC, 0x77, 0x9F,
+    0x97, 0x7F, 0xC7, 0x7A, 0xF7, 0x69, 0xFA, 0x75, 0x9F, 0xA7, 0x59, 0xFC, 0x76, 0xFC, 0x76, 0xFC,
+    0x76, 0xFC, 0x97, 0x5F, 0xC9, 0x75, 0xAF, 0xA7, 0x59, 0xFF, 0xFE, 0xA3, 0xAF, 0xFF, 0xE9, 0x3A,
+    0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0x40, 0x09, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x1F, 0xFF, 0xFA, 0x1F,
+    0xFF, 0xF9, 0x19, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x7F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49,
+    0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFC, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x74,
+    0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xFC, 0x97, 0x4F, 0xC7, 0x5F, 0xC7, 0x49,
+    0xFA, 0x74, 0xAF, 0x97, 0x20, 0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF, 0xC0, 0x9F, 0xA5, 0xFC, 0x91,
+    0xFC, 0x4F, 0xCA, 0x2F, 0xC3, 0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49, 0xF9, 0x1A, 0xFA, 0x5F, 0xA0,
+    0x9F, 0xC6, 0xFC, 0x0F, 0xC7, 0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2A,
+    0xFD, 0x73, 0x9F, 0xC7, 0x49, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49,
+    0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x30, 0x77, 0x77, 0x71, 0xAF, 0x77, 0x6F, 0xA7,
+    0x73, 0x99, 0xAF, 0xA9, 0x97, 0x59, 0xFF, 0xFE, 0x97, 0x09, 0xFF, 0xFF, 0xDA, 0x6A, 0xFF, 0xFF,
+    0xFC, 0x4A, 0xFD, 0xAA, 0x9F, 0xA9, 0xAF, 0xDA, 0x29, 0xFC, 0x93, 0xF9, 0x2A, 0xFC, 0x2F, 0xC4,
+    0x9F, 0x4F, 0xC9, 0x09, 0xF9, 0x4A, 0xF4, 0x9F, 0x90, 0xFC, 0x5F, 0xA4, 0x9F, 0x90, 0xFC, 0x5F,
+    0x94, 0x9F, 0x90, 0xFA, 0x49, 0xF9, 0x4A, 0xF1, 0xFA, 0x49, 0xF5, 0xFC, 0x1F, 0xC4, 0xAF, 0x49,
+    0xFA, 0x1F, 0xCA, 0x3F, 0xA3, 0x9F, 0xC2, 0x9F, 0xCA, 0x91, 0xF9, 0x19, 0xFD, 0x93, 0xFF, 0xFF,
+    0xFD, 0xA5, 0xFF, 0xFF, 0xF9, 0x7A, 0xFF, 0xFF, 0xA7, 0x39, 0xAF, 0xFD, 0xA9, 0x77, 0x1F, 0x97,
+    0x75, 0x9F, 0x77, 0x6A, 0xF7, 0x77, 0x99, 0x99, 0x75, 0x5F, 0xC7, 0xFC, 0xA5, 0xFC, 0x95, 0xAF,
+    0xC6, 0xAF, 0xA4, 0x9F, 0xC7, 0x9F, 0xC4, 0xFC, 0x97, 0x0F, 0xC3, 0xFC, 0xA7, 0x1A, 0xF9, 0x1A,
+    0xFC, 0x73, 0xFC, 0x09, 0xFC, 0x74, 0xFC, 0x0F, 0xC9, 0x74, 0xAF, 0xFC, 0xA7, 0x6F, 0xFC, 0x77,
+    0xFF, 0x77, 0x0A, 0xFD, 0x97, 0x79, 0xFE, 0x97, 0x7F, 0xFA, 0x76, 0xFF, 0xD7, 0x5A, 0xFC, 0xAF,
+    0x97, 0x39, 0xFC, 0x09, 0xFA, 0x73, 0xFC, 0x91, 0xFC, 0x72, 0xFC, 0xA2, 0xFC, 0x97, 0x0A, 0xFC,
+    0x39, 0xFC, 0x79, 0xFC, 0x94, 0xFC, 0x7F, 0xCA, 0x5F, 0xCA, 0x5F, 0xD6, 0xAF, 0xC4, 0xAF, 0xC7,
+    0x9F, 0xC9, 0x30, 0x19, 0xF9, 0x3A, 0xEA, 0x39, 0xF9, 0x1A, 0xF4, 0xFA, 0x3A, 0xF2, 0xFC, 0x39,
+    0xF9, 0x3A, 0xF2, 0xFC, 0x39, 0xF9, 0x3F, 0xC2, 0xFA, 0x3A, 0xF4, 0xFA, 0x19, 0xF9, 0x3F, 0xC3,
+    0x9F, 0x91, 0xAF, 0x4F, 0xA3, 0xAF, 0x2F, 0xC3, 0x9F, 0x93, 0xFC, 0x2F, 0xA3, 0xAF, 0x4F, 0xA2,
+    0xFA, 0x3F, 0xC3, 0x9F, 0x91, 0x9F, 0x93, 0xFC, 0x3A, 0xF2, 0x9F, 0xA3, 0xFA, 0x3F, 0xC3, 0xFC,
+    0x29, 0xF9, 0x2F, 0xC9, 0x3F, 0xDA, 0x9A, 0xF9, 0x9A, 0xFD, 0x4A, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF,
+    0xE7, 0x0A, 0xFF, 0xFE, 0xA7, 0x3A, 0xFF, 0xDA, 0x97, 0x70, 0xAF, 0x77, 0x5F, 0xC7, 0x75, 0xFA,
+    0x77, 0x49, 0xF9, 0x77, 0x4A, 0xF7, 0x75, 0xAF, 0x76, 0x77, 0x77, 0x29, 0xAF, 0xE9, 0x74, 0x9F,
+    0xFF, 0x72, 0xAF, 0xFF, 0xD9, 0x7A, 0xFF, 0xFF, 0x6A, 0xFD, 0x92, 0x9F, 0xDA, 0x5F, 0xCA, 0x6F,
+    0xD4, 0xAF, 0xA7, 0x9F, 0xC4, 0xFC, 0x71, 0xFC, 0x92, 0x9F, 0xC7, 0x1F, 0xC9, 0x2A, 0xF9, 0x71,
+    0xFC, 0x92, 0xFC, 0x72, 0xFC, 0x3F, 0xC7, 0x2F, 0xC3, 0xFC, 0x72, 0xFC, 0x3F, 0xC7, 0x19, 0xF9,
+    0x3F, 0xC7, 0x1A, 0xF4, 0xAF, 0x71, 0xFA, 0x49, 0xF9, 0x7A, 0xF6, 0xFA, 0x69, 0xF7, 0x9F, 0x94,
+    0x9F, 0x71, 0xAF, 0x92, 0xFC, 0x95, 0xFF, 0xC2, 0x9F, 0xFC, 0x2F, 0xFC, 0x29, 0xFF, 0xC1, 0x9F,
+    0xFC, 0x2A, 0xFF, 0xA1, 0xAF, 0xFA, 0x2F, 0xFC, 0x91, 0x69, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4F,
+    0xFC, 0x9E, 0xA3, 0xFF, 0xFD, 0xA2, 0x9F, 0xD9, 0xAF, 0xD9, 0x2F, 0xCA, 0x2A, 0xFC, 0x29, 0xFC,
+    0x4F, 0xC2, 0xFC, 0x94, 0xFA, 0x2F, 0xC5, 0xF9, 0x19, 0xFA, 0x49, 0xF9, 0x1A, 0xF9, 0x4A, 0xF2,
+    0xAF, 0x94, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xAF, 0x93, 0xAF, 0x92, 0xAF, 0xC2, 0xAF, 0xC9, 0x29,
+    0xFD, 0xAF, 0xFC, 0x91, 0xFF, 0xFF, 0x29, 0xFE, 0x99, 0xFD, 0x39, 0xFC, 0x2A, 0xFA, 0x59, 0x96,
+    0x99, 0x30, 0x74, 0x99, 0x99, 0x76, 0x9F, 0xF9, 0x72, 0xFF, 0xEA, 0x70, 0xAF, 0xFF, 0x96, 0x9F,
+    0xCA, 0x9A, 0xFC, 0xA6, 0xFC, 0x92, 0x9F, 0xC6, 0xFC, 0x4F, 0xC5, 0x9F, 0xA4, 0xFA, 0x5A, 0xF9,
+    0x39, 0xF9, 0x5F, 0xC4, 0xFC, 0x6F, 0xC3, 0xFC, 0x95, 0x9F, 0xA0, 0xFE, 0x96, 0xAF, 0x90, 0xFC,
+    0x97, 0x0A, 0xF0, 0x9F, 0xD9, 0x7F, 0xC0, 0x9A, 0xFD, 0x96, 0xFC, 0x39, 0xFC, 0x59, 0xFA, 0x4A,
+    0xF9, 0x4A, 0xF9, 0x4A, 0xFA, 0x4F, 0xC5, 0xAF, 0xA4, 0xFC, 0x5A, 0xFA, 0x4F, 0xA5, 0xFC, 0x93,
+    0x9F, 0xC4, 0xFD, 0x4A, 0xFE, 0xAA, 0xFD, 0xA4, 0xFF, 0xFF, 0x5F, 0xFF, 0xE5, 0x9F, 0xA9, 0xFE,
+    0xA6, 0x9F, 0x92, 0x99, 0x97, 0x1A, 0xF7, 0x70, 0xFC, 0x77, 0x0F, 0xC7, 0x79, 0xFA, 0x77, 0xAF,
+    0x97, 0x7A, 0xF7, 0x70, 0xFC, 0x77, 0x77, 0x09, 0xF9, 0x4F, 0xC1, 0xFA, 0x4F, 0xC1, 0xFA, 0x4F,
+    0xC1, 0xFA, 0x39, 0xFA, 0x1F, 0xA3, 0x9F, 0x91, 0xFA, 0x3A, 0xF2, 0xAE, 0xA3, 0xFC, 0x2A, 0xF2,
+    0x9F, 0x92, 0x9F, 0x2A, 0xF3, 0x9F, 0x2F, 0xA3, 0x9F, 0x1A, 0xF5, 0xF0, 0x9F, 0x95, 0xF0, 0xFA,
+    0x6F, 0xFC, 0x7F, 0xF7, 0x0A, 0xFD, 0x97, 0x0A, 0xFC, 0x97, 0x1F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA,
+    0x72, 0x9F, 0x97, 0x2A, 0xF7, 0x3F, 0xC7, 0x3F, 0xC7, 0x29, 0xFA, 0x72, 0x71, 0x99, 0x99, 0x97,
+    0x4A, 0xFF, 0xA7, 0x0F, 0xFF, 0x6F, 0xFF, 0xC5, 0x9F, 0xC9, 0x99, 0xAE, 0x95, 0xAF, 0x94, 0x9A,
+    0x6A, 0xF9, 0x75, 0x9F, 0xC7, 0x6F, 0xCA, 0x75, 0x9F, 0xD7, 0x5A, 0xFD, 0x72, 0xFF, 0xD7, 0x9F,
+    0xFE, 0xA5, 0x9F, 0xC9, 0x09, 0xFC, 0x5F, 0xC3, 0xFC, 0x93, 0xFC, 0x93, 0x9F, 0xA3, 0xFC, 0x49,
+    0xFC, 0x29, 0xF9, 0x49, 0xFC, 0x2A, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x4A, 0xFA, 0x2A, 0xF9, 0x4F,
+    0xC3, 0xAF, 0xC3, 0xFD, 0x39, 0xFD, 0xAA, 0xFD, 0x94, 0xFF, 0xFC, 0x96, 0xFF, 0xE9, 0x70, 0xAF,
+    0xEA, 0x75, 0x99, 0x97, 0x20, 0x69, 0x9A, 0xA9, 0x97, 0x9F, 0xFA, 0x4A, 0xFF, 0xDA, 0x29, 0xFF,
+    0xE3, 0xAF, 0x91, 0x9A, 0xD3, 0xFA, 0x72, 0xFA, 0x72, 0x9F, 0x97, 0x2F, 0xF7, 0x0F, 0xDA, 0x6A,
+    0xFE, 0x95, 0xFC, 0xAA, 0xAA, 0x5F, 0xC9, 0x71, 0xFC, 0x72, 0xFC, 0x5A, 0x3F, 0xDA, 0xAA, 0xE3,
+    0xAF, 0xFE, 0x4F, 0xFE, 0x5A, 0xFE, 0xA9, 0x70, 0x99, 0x96, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x4F, 0xFF, 0xD4, 0xFF, 0xFD, 0x4F, 0xFF, 0xCA, 0x49, 0x99, 0x99, 0x99, 0xAF, 0xC7, 0x39,
+    0xFC, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73, 0xAF, 0xC7, 0x3F, 0xD7, 0x3F, 0xD7, 0x3A, 0xFC, 0x73,
+    0x9F, 0xC7, 0x4F, 0xC7, 0x4F, 0xC9, 0x73, 0x9F, 0xC7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x75,
+    0xFC, 0x75, 0xFC, 0xA7, 0x4F, 0xDA, 0x73, 0xAF, 0xEA, 0x72, 0xFF, 0xC9, 0x71, 0xAF, 0xF9, 0x71,
+    0x9F, 0xF7, 0x39, 0xFD, 0x97, 0x4F, 0xC9, 0x74, 0xAF, 0x75, 0xFC, 0x75, 0xFA, 0x74, 0xAF, 0x75,
+    0xAA, 0xAA, 0x96, 0x73, 0x9A, 0x99, 0x6A, 0xE1, 0x9F, 0xCA, 0x5F, 0x0A, 0xFE, 0xA4, 0xFA, 0xFF,
+    0xC3, 0x9F, 0xE9, 0xAF, 0xC9, 0x2A, 0xFC, 0xA2, 0xAF, 0x92, 0xAF, 0xC3, 0xAF, 0x92, 0xFC, 0x93,
+    0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x49, 0xF9, 0x2F,
+    0xC4, 0xAF, 0x92, 0xFA, 0x4F, 0xC2, 0x9F, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC, 0x49, 0xF9,
+    0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x93, 0x70, 0x99, 0x99, 0x73, 0xAF, 0xE7, 0x0F,
+    0xFD, 0x6F, 0xFF, 0x4F, 0xCA, 0x1F, 0xC3, 0x9F, 0xC2, 0x9F, 0x92, 0xFC, 0x4F, 0xA1, 0x9F, 0xA4,
+    0xFA, 0x1A, 0xF9, 0x4F, 0xA1, 0xFC, 0x49, 0xFA, 0x09, 0xFC, 0x49, 0xFA, 0x0A, 0xFC, 0xAA, 0xAA,
+    0xAF, 0xC9, 0x0F, 0xFF, 0xF9, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0x09, 0xFA, 0x4A, 0xFA, 0x09, 0xF9,
+    0x4A, 0xF9, 0x0A, 0xF9, 0x4F, 0xC1, 0xAF, 0x93, 0x9F, 0xC1, 0xAF, 0x4A, 0xF9, 0x1A, 0xF9, 0x3F,
+    0xC2, 0x9F, 0x92, 0xFC, 0x93, 0xFC, 0x99, 0xFD, 0x4A, 0xFF, 0xE6, 0xFF, 0xD7, 0x0A, 0xFD, 0xA7,
+    0x49, 0x97, 0x10, 0x74, 0xFC, 0x4F, 0xC3, 0x9F, 0xA3, 0xAF, 0x93, 0xAF, 0x4F, 0xC4, 0xFC, 0x39,
+    0xFA, 0x3A, 0xF9, 0x3F, 0xC4, 0xFC, 0x4F, 0xC3, 0x9F, 0xA3, 0xAF, 0xC3, 0xAF, 0xDA, 0xAA, 0x9F,
+    0xFA, 0x0F, 0xF9, 0x1A, 0xFD, 0x49, 0x99, 0x20, 0x77, 0x70, 0xAF, 0x4A, 0xFC, 0x4F, 0xC3, 0xAF,
+    0xC5, 0xFA, 0x2A, 0xFC, 0x59, 0xFA, 0x1A, 0xFC, 0x6A, 0xF9, 0x0A, 0xFC, 0x7F, 0xC0, 0x9F, 0xC7,
+    0x0F, 0xA9, 0xFC, 0x71, 0xFF, 0xD7, 0x19, 0xFF, 0xCA, 0x71, 0xAF, 0xFD, 0x71, 0xFF, 0xEA, 0x70,
+    0xFD, 0x9F, 0xC7, 0x9F, 0xA1, 0xFC, 0xA6, 0x9F, 0x91, 0x9F, 0xC6, 0xAF, 0x3F, 0xC9, 0x5F, 0xC3,
+    0x9F, 0xC5, 0xFC, 0x4F, 0xC9, 0x39, 0xFA, 0x4A, 0xFC, 0x30, 0x59, 0x99, 0x99, 0x75, 0x9F, 0xDA,
+    0x73, 0xAF, 0xE9, 0x72, 0xFF, 0xC7, 0x2A, 0xAA, 0xFD, 0x76, 0x9F, 0x97, 0x6F, 0xA7, 0x6F, 0xA7,
+    0x6F, 0xC7, 0x5A, 0xFC, 0x75, 0xFD, 0x74, 0xFE, 0x97, 0x29, 0xFE, 0xA7, 0x2F, 0xFA, 0x71, 0x9F,
+    0x9F, 0x71, 0xF9, 0x9F, 0x70, 0xAF, 0x09, 0xF7, 0x0F, 0xA1, 0xF9, 0x6A, 0xF2, 0xFA, 0x6F, 0xA2,
+    0xFA, 0x5F, 0xC3, 0xFC, 0x49, 0xFA, 0x3F, 0xC9, 0x3F, 0xC4, 0xAF, 0xDA, 0x09, 0xFA, 0x49, 0xFD,
+    0x90, 0xFC, 0x95, 0xFD, 0x0A, 0xFC, 0x6A, 0xFC, 0x77, 0x99, 0x20, 0x77, 0x73, 0xAF, 0x93, 0x9F,
+    0xA5, 0xFC, 0x4A, 0xF9, 0x5F, 0xC4, 0xAF, 0x59, 0xFA, 0x4F, 0xC5, 0xAF, 0x94, 0xFC, 0x5A, 0xF4,
+    0x9F, 0xA5, 0xFC, 0x4A, 0xF9, 0x5F, 0xC4, 0xFC, 0x59, 0xFA, 0x4F, 0xC5, 0xAF, 0x93, 0x9F, 0xA5,
+    0xFC, 0x4A, 0xF9, 0x5F, 0xC4, 0xFC, 0x95, 0xFC, 0x3A, 0xFC, 0x59, 0xFC, 0x29, 0xFD, 0x5A, 0xFD,
+    0xAF, 0xFD, 0x3F, 0xFE, 0x9F, 0xCA, 0x3F, 0xFD, 0x09, 0xFC, 0xA2, 0x9F, 0xAF, 0x91, 0xAF, 0x92,
+    0x9F, 0x90, 0x99, 0x59, 0x94, 0xAF, 0x77, 0x0F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7A, 0xF9,
+    0x77, 0xFC, 0x77, 0x0F, 0xC7, 0x70, 0x77, 0x09, 0xF9, 0x4F, 0xC1, 0xFA, 0x4F, 0xC1, 0xFA, 0x4F,
+    0xC1, 0xFA, 0x39, 0xFA, 0x1F, 0xA3, 0x9F, 0x91, 0xAE, 0xA3, 0xAF, 0x2A, 0xEA, 0x3F, 0xC2, 0xAF,
+    0x29, 0xF9, 0x29, 0xF2, 0xAF, 0x39, 0xF2, 0xFA, 0x4F, 0x1A, 0xF5, 0xF0, 0x9F, 0x95, 0xF0, 0xFA,
+    0x6F, 0xFC, 0x7F, 0xF7, 0x0A, 0xFD, 0x97, 0x0A, 0xFC, 0x97, 0x1A, 0xF9, 0x70, 0x39, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x93, 0xFF, 0xFD, 0x3F, 0xFF, 0xCA, 0x29, 0xFF, 0xFC, 0x93, 0x99, 0xAF,
+    0xCA, 0x99, 0x69, 0xFA, 0x73, 0xFA, 0x73, 0xAF, 0x74, 0xFC, 0x74, 0xFC, 0x97, 0x3A, 0xFC, 0x97,
+    0x3F, 0xFD, 0xA7, 0x9F, 0xFA, 0x6A, 0xFF, 0xC9, 0x49, 0xFD, 0xAA, 0xAA, 0xA4, 0x9F, 0xC9, 0x72,
+    0xFC, 0x73, 0x9F, 0xA7, 0x3A, 0xF9, 0x73, 0xFC, 0xA7, 0x3A, 0xFC, 0x73, 0xAF, 0xD9, 0x72, 0xFF,
+    0x97, 0x09, 0xFF, 0xC7, 0x09, 0xFF, 0xC7, 0x1A, 0xFE, 0xA7, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x4F,
+    0xC7, 0x39, 0xFA, 0x73, 0xAF, 0x74, 0xFA, 0x73, 0xAA, 0xAA, 0xA6, 0x79, 0xAA, 0x97, 0x29, 0xFF,
+    0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9, 0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC,
+    0x4F, 0xC1, 0xFC, 0x94, 0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A,
+    0xF9, 0x49, 0xFA, 0x0A, 0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39, 0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2,
+    0xFD, 0xAF, 0xE3, 0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9, 0x73, 0x99, 0x97, 0x00, 0x77, 0x70,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFF, 0xD1, 0xAA, 0xAF, 0xCA, 0xAA, 0xAA,
+    0xFC, 0xAA, 0xA9, 0x4F, 0xC3, 0x9F, 0xA7, 0x0F, 0xC3, 0xAF, 0x97, 0x0F, 0xA3, 0xFC, 0x70, 0x9F,
+    0x93, 0xFC, 0x70, 0xAF, 0x93, 0xFA, 0x70, 0xFC, 0x39, 0xFA, 0x70, 0xFC, 0x3A, 0xF9, 0x79, 0xFA,
+    0x3F, 0xC7, 0x0A, 0xF9, 0x3F, 0xC7, 0x0A, 0xF4, 0xFC, 0x70, 0xFC, 0x4F, 0xCA, 0xAC, 0x5F, 0xC4,
+    0xFF, 0x49, 0xFA, 0x4A, 0xFE, 0x4A, 0xF9, 0x5A, 0xFC, 0xA7, 0x72, 0x99, 0x95, 0x72, 0x9A, 0xA9,
+    0x74, 0x9F, 0xF7, 0x1A, 0xFF, 0xD7, 0x9F, 0xFF, 0x6F, 0xDA, 0xAF, 0xC9, 0x49, 0xFC, 0x2A, 0xFA,
+    0x4A, 0xF9, 0x29, 0xFC, 0x4F, 0xC4, 0xFC, 0x4F, 0xC4, 0xFC, 0x39, 0xFA, 0x39, 0xFC, 0x3A, 0xF9,
+    0x3A, 0xFA, 0x3F, 0xC4, 0xFC, 0xA3, 0xFC, 0x4F, 0xC9, 0x29, 0xFA, 0x3A, 0xFC, 0x39, 0xFC, 0x29,
+    0xFC, 0xA3, 0xAF, 0xFF, 0xD4, 0xFF, 0xFD, 0x94, 0xFF, 0xFC, 0x94, 0x9F, 0xA0, 0xFD, 0x95, 0xAF,
+    0x92, 0x99, 0x70, 0xAF, 0x76, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76,
+    0xFC, 0x75, 0x79, 0x9A, 0x99, 0x70, 0xAF, 0xF9, 0x39, 0xFF, 0xD3, 0x9F, 0xFE, 0x29, 0xFD, 0xA9,
+    0xAD, 0x92, 0xFD, 0x70, 0x9F, 0xC7, 0x1F, 0xC9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x19,
+    0xFA, 0x71, 0x9F, 0xC7, 0x19, 0xFC, 0x97, 0x1F, 0xD9, 0x70, 0xAF, 0xE9, 0x7F, 0xFC, 0x96, 0xAF,
+    0xF9, 0x69, 0xFF, 0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xF9, 0x71, 0xFC,
+    0x71, 0x9A, 0xAA, 0xA4, 0x77, 0x71, 0x9A, 0xFF, 0xF3, 0x9F, 0xFF, 0xDA, 0x2A, 0xFF, 0xFE, 0x91,
+    0x9F, 0xDA, 0xAF, 0xCA, 0xAA, 0x2F, 0xCA, 0x3F, 0x49, 0xFC, 0x4F, 0xA3, 0xFC, 0x94, 0xFC, 0x3F,
+    0xC5, 0xFC, 0x29, 0xFA, 0x5F, 0xC2, 0x9F, 0xA5, 0xFC, 0x2A, 0xF9, 0x49, 0xFA, 0x2A, 0xF9, 0x4A,
+    0xF9, 0x29, 0xFA, 0x4F, 0xC4, 0xFC, 0x3F, 0xC9, 0x4F, 0xDA, 0xAF, 0xD5, 0x9F, 0xFF, 0x79, 0xFF,
+    0xCA, 0x71, 0x9F, 0xE9, 0x75, 0x99, 0x73, 0x77, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x09, 0xFF, 0xFD,
+    0xA0, 0x9A, 0xAA, 0xAF, 0xCA, 0xAA, 0xAA, 0x6F, 0xC7, 0x29, 0xFA, 0x72, 0xAF, 0x97, 0x2F, 0xC7,
+    0x3F, 0xC7, 0x3F, 0xA7, 0x29, 0xF9, 0x72, 0xAF, 0x97, 0x2F, 0xC7, 0x3F, 0xC7, 0x3F, 0xDA, 0xAC,
+    0x7F, 0xFC, 0x79, 0xFF, 0x70, 0xAF, 0xDA, 0x73, 0x99, 0x70, 0x77, 0x5F, 0xC4, 0xAF, 0x3F, 0xC4,
+    0xAF, 0x29, 0xFA, 0x4A, 0xF9, 0x1A, 0xF9, 0x4A, 0xF2, 0xAF, 0x5F, 0xC2, 0xFC, 0x5F, 0xC2, 0xFC,
+    0x5F, 0xC1, 0x9F, 0xA5, 0xFC, 0x1A, 0xF9, 0x5F, 0xC1, 0xFC, 0x59, 0xFA, 0x1F, 0xC5, 0xAF, 0x91,
+    0xFA, 0x5F, 0xC2, 0xFA, 0x4F, 0xCA, 0x2F, 0xC3, 0xAF, 0xC3, 0xFD, 0xAF, 0xE9, 0x3A, 0xFF, 0xF9,
+    0x5F, 0xFE, 0x97, 0xAF, 0xE9, 0x74, 0x99, 0x72, 0x59, 0x69, 0x9A, 0x99, 0x71, 0xDA, 0x39, 0xFE,
+    0x96, 0xFA, 0x19, 0xFF, 0xC9, 0x4F, 0xD9, 0x0F, 0xFE, 0x3A, 0xFC, 0x90, 0x9F, 0xA0, 0xAF, 0xA2,
+    0xFC, 0x91, 0xFC, 0x2F, 0xC1, 0xAF, 0xC2, 0xFA, 0x2A, 0xF1, 0xFC, 0x91, 0x9F, 0x92, 0xAF, 0x90,
+    0xFC, 0x2A, 0xF3, 0xFC, 0x09, 0xFA, 0x2A, 0xF3, 0xFC, 0x09, 0xFA, 0x2F, 0xA2, 0x9F, 0xC0, 0x9F,
+    0xA2, 0xFA, 0x2A, 0xFA, 0x09, 0xFA, 0x19, 0xF9, 0x2F, 0xC9, 0x1F, 0xC1, 0xAF, 0x2F, 0xD2, 0xFC,
+    0xA0, 0xFC, 0x09, 0xFD, 0x39, 0xFF, 0xFF, 0xD9, 0x4F, 0xFF, 0xFC, 0x96, 0xAF, 0xFF, 0xD7, 0x19,
+    0xAF, 0xFC, 0xA9, 0x75, 0xFC, 0x77, 0x2F, 0xA7, 0x72, 0xF9, 0x77, 0x19, 0xF7, 0x72, 0xAF, 0x77,
+    0x2F, 0xC7, 0x72, 0xFA, 0x77, 0x19, 0xF9, 0x74, 0x59, 0x97, 0x73, 0xFC, 0xA7, 0xFC, 0x4F, 0xDA,
+    0x5F, 0xC5, 0xFE, 0x49, 0xF9, 0x49, 0xFE, 0x93, 0xFA, 0x71, 0xFA, 0x2F, 0xC7, 0x2A, 0xF1, 0x9F,
+    0x97, 0x29, 0xF1, 0xFA, 0x74, 0xF9, 0xAF, 0x75, 0xFF, 0xC7, 0x6A, 0xFE, 0x97, 0x69, 0xFD, 0xA7,
+    0x70, 0xFD, 0x77, 0x1F, 0xC9, 0x77, 0x09, 0xFC, 0x77, 0x1F, 0xD9, 0x77, 0xAF, 0xDA, 0x76, 0x9F,
+    0xF7, 0x6F, 0xFC, 0x75, 0xAF, 0x9F, 0x97, 0x39, 0xF1, 0xFA, 0x73, 0xFA, 0x1F, 0xC7, 0x2F, 0xC2,
+    0xAF, 0xA7, 0x0A, 0xF9, 0x29, 0xFE, 0x95, 0xFA, 0x4F, 0xE5, 0xFC, 0x5A, 0xFD, 0x4A, 0xF9, 0x69,
+    0xF9, 0x77, 0x74, 0x75, 0x99, 0x99, 0x77, 0x3F, 0xC7, 0x73, 0xFA, 0x77, 0x29, 0xF9, 0x77, 0x2A,
+    0xF7, 0x73, 0xAF, 0x77, 0x3F, 0xC7, 0x73, 0xFA, 0x72, 0xFC, 0x29, 0xF9, 0x1A, 0xF9, 0x2F, 0xC2,
+    0xAF, 0x2A, 0xF9, 0x19, 0xFA, 0x2F, 0xC2, 0xAF, 0x91, 0xAF, 0x92, 0xFA, 0x2A, 0xF9, 0x1A, 0xF3,
+    0xFA, 0x2A, 0xF9, 0x1F, 0xC2, 0x9F, 0x92, 0xAF, 0x91, 0xFC, 0x2A, 0xF3, 0xFC, 0x19, 0xFA, 0x2F,
+    0xC3, 0xFC, 0x1A, 0xF9, 0x2F, 0xA3, 0xFC, 0x1F, 0xC2, 0x9F, 0x92, 0x9F, 0xA1, 0xFC, 0x29, 0xF3,
+    0xAF, 0x91, 0xFC, 0x2A, 0xF3, 0xFC, 0x2F, 0xC2, 0xFC, 0x2A, 0xF9, 0x2F, 0xC2, 0xFA, 0x1A, 0xFC,
+    0x3F, 0xDA, 0xAF, 0xCA, 0xFD, 0x49, 0xFF, 0xFF, 0xD6, 0xAF, 0xFF, 0xEA, 0x71, 0xAF, 0xFE, 0x97,
+    0x69, 0xFA, 0x77, 0x29, 0xF9, 0x77, 0x2A, 0xF7, 0x73, 0xFC, 0x77, 0x3F, 0xA7, 0x73, 0xF9, 0x77,
+    0x29, 0xF9, 0x77, 0x2A, 0xF7, 0x50, 0x77, 0x76, 0xAF, 0x71, 0xFA, 0x4A, 0xF7, 0x29, 0xF3, 0x9F,
+    0x97, 0x3F, 0x92, 0xFA, 0x74, 0xFA, 0x1A, 0xF7, 0x5F, 0xA1, 0xFA, 0x49, 0x99, 0x94, 0xFC, 0x09,
+    0xF9, 0x39, 0xF4, 0xFC, 0x0A, 0xF4, 0x9F, 0x4F, 0xC0, 0xFC, 0x4A, 0xEA, 0x4F, 0xA0, 0xFA, 0x4F,
+    0x94, 0xF9, 0x0F, 0xA4, 0xF4, 0x9F, 0x90, 0xFA, 0x39, 0xF4, 0xFC, 0x1F, 0xA3, 0xFC, 0x39, 0xFA,
+    0x1F, 0xC2, 0x9F, 0xC3, 0xFC, 0x2A, 0xFC, 0xAA, 0xFE, 0xAA, 0xFC, 0xA3, 0xFF, 0xC9, 0xAF, 0xFD,
+    0x49, 0xFE, 0xA0, 0x9F, 0xFC, 0x69, 0xFC, 0xA2, 0x9F, 0xD9, 0x72, 0x99, 0x79, 0x97, 0x73, 0xAF,
+    0xC9, 0x75, 0xFD, 0xA7, 0x4A, 0xFE, 0x73, 0x9F, 0xF7, 0x3F, 0xAF, 0x72, 0x9F, 0x9F, 0x72, 0xFA,
+    0x0F, 0x71, 0x9F, 0x90, 0xF9, 0x70, 0xFC, 0x1F, 0x97, 0x9F, 0x91, 0xF9, 0x7F, 0xC2, 0xFA, 0x69,
+    0xF9, 0x2A, 0xEA, 0x6F, 0xC3, 0xAF, 0x59, 0xF9, 0x3A, 0xF5, 0xFF, 0xFE, 0x4A, 0xFF, 0xFE, 0x4F,
+    0xFF, 0xF3, 0xAF, 0xFF, 0xF9, 0x2F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x91, 0xAF, 0x97, 0xF9, 0x1F,
+    0xC7, 0x0F, 0xA0, 0xAF, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0xAF, 0x97, 0x1F, 0xC7, 0x77, 0x77,
+    0x71, 0xAD, 0x97, 0x7F, 0xC7, 0x7F, 0xC9, 0x76, 0xFC, 0x77, 0xAE, 0x97, 0x77, 0x50, 0x69, 0xA9,
+    0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA, 0xAF, 0xD9, 0x2F,
+    0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC4, 0x9F,
+    0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF, 0xA3, 0xFC, 0xA2,
+    0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E, 0xA5, 0x9F, 0xC9,
+    0x0A, 0xEA, 0x70, 0x97, 0x77, 0x73, 0x9D, 0xA7, 0x59, 0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x75,
+    0xEA, 0x77, 0x75, 0x77, 0x77, 0x1A, 0xFC, 0x97, 0x5A, 0xFD, 0x75, 0xAA, 0xAF, 0x97, 0x79, 0xE9,
+    0x77, 0xAE, 0x76, 0xAF, 0x97, 0x6E, 0xA7, 0x70, 0xAA, 0xA7, 0x77, 0x74, 0xAF, 0xC9, 0x75, 0xFD,
+    0xA7, 0x4A, 0xFE, 0x73, 0x9F, 0xF7, 0x3F, 0xAF, 0x72, 0x9F, 0x9F, 0x72, 0xFA, 0x0F, 0x71, 0x9F,
+    0x90, 0xF9, 0x70, 0xFC, 0x1F, 0x97, 0x9F, 0x91, 0xF9, 0x7F, 0xC2, 0xFA, 0x69, 0xF9, 0x2A, 0xEA,
+    0x6F, 0xC3, 0xAF, 0x59, 0xF9, 0x3A, 0xF5, 0xFF, 0xFE, 0x4A, 0xFF, 0xFE, 0x4F, 0xFF, 0xF3, 0xAF,
+    0xFF, 0xF9, 0x2F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x91, 0xAF, 0x97, 0xF9, 0x1F, 0xC7, 0x0F, 0xA0,
+    0xAF, 0x97, 0x0F, 0xA0, 0xFC, 0x71, 0xFC, 0xAF, 0x97, 0x1F, 0xC0, 0x70, 0x9A, 0xAA, 0x97, 0x49,
+    0xFD, 0x73, 0x9F, 0xDA, 0x75, 0x9E, 0xA7, 0x6E, 0x97, 0x4A, 0xF7, 0x4A, 0xEA, 0x75, 0xAD, 0x97,
+    0x77, 0x79, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF, 0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA,
+    0xAF, 0xD9, 0x2F, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F, 0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA,
+    0x2F, 0xC4, 0x9F, 0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF,
+    0xA3, 0xFC, 0xA2, 0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA, 0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E,
+    0xA5, 0x9F, 0xC9, 0x0A, 0xEA, 0x70, 0x97, 0x40, 0x77, 0x69, 0xAA, 0xA9, 0x77, 0x6E, 0xA7, 0x6F,
+    0xC2, 0xEA, 0x76, 0xFD, 0xA0, 0xE9, 0x76, 0xFF, 0x77, 0x2F, 0x1A, 0xE7, 0x70, 0xEA, 0x3E, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xFC, 0x97, 0x74, 0xFD, 0xA7, 0x73, 0xAF, 0xE7, 0x72, 0x9F, 0xF7,
+    0x72, 0xFA, 0xF7, 0x71, 0x9F, 0x9F, 0x77, 0x1F, 0xA0, 0xF7, 0x70, 0x9F, 0x90, 0xF9, 0x77, 0xFC,
+    0x1F, 0x97, 0x69, 0xF9, 0x1F, 0x97, 0x6F, 0xC2, 0xFA, 0x75, 0x9F, 0x92, 0xAE, 0xA7, 0x5F, 0xC3,
+    0xAF, 0x74, 0x9F, 0x93, 0xAF, 0x74, 0xFF, 0xFE, 0x73, 0xAF, 0xFF, 0xE7, 0x3F, 0xFF, 0xF7, 0x2A,
+    0xFF, 0xFF, 0x97, 0x1F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x97, 0x0A, 0xF9, 0x7F, 0x97, 0x0F, 0xC7,
+    0x0F, 0xA7, 0xAF, 0x97, 0x0F, 0xA7, 0xFC, 0x71, 0xFC, 0x6A, 0xF9, 0x71, 0xFC, 0x60, 0x77, 0x77,
+    0x70, 0xAE, 0xA7, 0x70, 0x9E, 0xA7, 0x09, 0xFC, 0xA1, 0xE9, 0x70, 0x9F, 0xE0, 0xAA, 0xA7, 0x2F,
+    0x9E, 0xA7, 0x4E, 0xA2, 0xE7, 0x3A, 0xD9, 0x39, 0xDA, 0x77, 0x77, 0x39, 0xA9, 0x97, 0x70, 0xAF,
+    0xD1, 0xF7, 0x0A, 0xFF, 0x9F, 0x7A, 0xFF, 0xFC, 0xA6, 0x9F, 0xDA, 0xAF, 0xD9, 0x6F, 0xD2, 0x9F,
+    0xC9, 0x59, 0xFC, 0x4F, 0xC6, 0xAF, 0xA4, 0xFC, 0x6F, 0xC5, 0xFA, 0x6F, 0xC4, 0x9F, 0x95, 0x9F,
+    0xA4, 0xAF, 0x69, 0xFA, 0x4F, 0xC6, 0xAF, 0xA3, 0x9F, 0xC6, 0xAF, 0xA3, 0xFC, 0xA6, 0x9F, 0xC2,
+    0xAF, 0xC9, 0x7F, 0xDA, 0xFE, 0x70, 0xFF, 0xFD, 0x70, 0x9F, 0xEA, 0x9E, 0xA7, 0x19, 0xFC, 0x90,
+    0xAE, 0xA7, 0x49, 0x77, 0x00, 0x59, 0xAA, 0xA9, 0x77, 0x1E, 0xA7, 0x72, 0xE2, 0xFC, 0x73, 0xDA,
+    0x0F, 0xDA, 0x75, 0xFF, 0x74, 0xF1, 0xAE, 0x72, 0xEA, 0x3E, 0x97, 0x77, 0x77, 0x77, 0xAF, 0xC9,
+    0x76, 0xFD, 0xA7, 0x5A, 0xFE, 0x74, 0x9F, 0xF7, 0x4F, 0xAF, 0x73, 0x9F, 0x9F, 0x73, 0xFA, 0x0F,
+    0x72, 0x9F, 0x90, 0xF9, 0x71, 0xFC, 0x1F, 0x97, 0x09, 0xF9, 0x1F, 0x97, 0x0F, 0xC2, 0xFA, 0x79,
+    0xF9, 0x2A, 0xEA, 0x7F, 0xC3, 0xAF, 0x69, 0xF9, 0x3A, 0xF6, 0xFF, 0xFE, 0x5A, 0xFF, 0xFE, 0x5F,
+    0xFF, 0xF4, 0xAF, 0xFF, 0xF9, 0x3F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x92, 0xAF, 0x97, 0xF9, 0x2F,
+    0xC7, 0x0F, 0xA1, 0xAF, 0x97, 0x0F, 0xA1, 0xFC, 0x71, 0xFC, 0x0A, 0xF9, 0x71, 0xFC, 0x00, 0x77,
+    0x4E, 0xA7, 0x69, 0xE7, 0x7A, 0xD9, 0x09, 0xFC, 0xA7, 0x9A, 0x99, 0xFE, 0x72, 0xF9, 0xEA, 0x70,
+    0xEA, 0x2E, 0x7A, 0xD9, 0x39, 0xDA, 0x77, 0x73, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9,
+    0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC,
+    0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4,
+    0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF,
+    0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x77, 0x49,
+    0xAA, 0x97, 0x75, 0xF9, 0x77, 0x49, 0x9D, 0xA7, 0x76, 0xDA, 0x74, 0x9F, 0xC1, 0xAE, 0x75, 0xFD,
+    0xA0, 0xD7, 0x6F, 0xF7, 0x70, 0xF1, 0xEA, 0x76, 0xEA, 0x3E, 0x97, 0x77, 0x77, 0x77, 0x73, 0xAF,
+    0xC9, 0x77, 0x2F, 0xDA, 0x77, 0x1A, 0xFE, 0x77, 0x09, 0xFF, 0x77, 0x0F, 0xAF, 0x77, 0x9F, 0x9F,
+    0x77, 0xFA, 0x0F, 0x76, 0x9F, 0x90, 0xF9, 0x75, 0xFC, 0x1F, 0x97, 0x49, 0xF9, 0x1F, 0x97, 0x4F,
+    0xC2, 0xFA, 0x73, 0x9F, 0x92, 0xAE, 0xA7, 0x3F, 0xC3, 0xAF, 0x72, 0x9F, 0x93, 0xAF, 0x72, 0xFF,
+    0xFE, 0x71, 0xAF, 0xFF, 0xE7, 0x1F, 0xFF, 0xF7, 0x0A, 0xFF, 0xFF, 0x97, 0xFC, 0x99, 0x99, 0x99,
+    0x9A, 0xF9, 0x6A, 0xF9, 0x7F, 0x96, 0xFC, 0x70, 0xFA, 0x5A, 0xF9, 0x70, 0xFA, 0x5F, 0xC7, 0x1F,
+    0xC4, 0xAF, 0x97, 0x1F, 0xC4, 0x77, 0x77, 0x4A, 0xE7, 0x70, 0xAF, 0x77, 0x1A, 0xD7, 0x70, 0x9D,
+    0xA7, 0x9F, 0xCA, 0x0A, 0xD9, 0x79, 0xFE, 0x09, 0xA7, 0x09, 0xF9, 0xEA, 0x71, 0x9E, 0xA1, 0x9E,
+    0x71, 0xE9, 0x39, 0xDA, 0x77, 0x77, 0x9A, 0x99, 0x76, 0xAF, 0xD1, 0xF6, 0xAF, 0xF9, 0xF5, 0xAF,
+    0xFF, 0xCA, 0x49, 0xFD, 0xAA, 0xFD, 0x94, 0xFD, 0x29, 0xFC, 0x93, 0x9F, 0xC4, 0xFC, 0x4A, 0xFA,
+    0x4F, 0xC4, 0xFC, 0x5F, 0xA4, 0xFC, 0x49, 0xF9, 0x39, 0xFA, 0x4A, 0xF4, 0x9F, 0xA4, 0xFC, 0x4A,
+    0xFA, 0x39, 0xFC, 0x4A, 0xFA, 0x3F, 0xCA, 0x49, 0xFC, 0x2A, 0xFC, 0x95, 0xFD, 0xAF, 0xE6, 0xFF,
+    0xFD, 0x69, 0xFE, 0xA9, 0xEA, 0x79, 0xFC, 0x90, 0xAE, 0xA7, 0x29, 0x76, 0x77, 0x77, 0x3E, 0xA2,
+    0xDA, 0x73, 0xFD, 0xAE, 0x73, 0xAD, 0xAF, 0xDA, 0x73, 0xD2, 0x9A, 0xD9, 0x77, 0x99, 0x99, 0x97,
+    0x70, 0xFD, 0x97, 0x6F, 0xF7, 0x5F, 0x99, 0xE9, 0x73, 0xEA, 0x29, 0xE7, 0x77, 0x77, 0x77, 0x3A,
+    0xFC, 0x97, 0x7F, 0xDA, 0x76, 0xAF, 0xE7, 0x59, 0xFF, 0x75, 0xFA, 0xF7, 0x49, 0xF9, 0xF7, 0x4F,
+    0xA0, 0xF7, 0x39, 0xF9, 0x0F, 0x97, 0x2F, 0xC1, 0xF9, 0x71, 0x9F, 0x91, 0xF9, 0x71, 0xFC, 0x2F,
+    0xA7, 0x09, 0xF9, 0x2A, 0xEA, 0x70, 0xFC, 0x3A, 0xF7, 0x9F, 0x93, 0xAF, 0x7F, 0xFF, 0xE6, 0xAF,
+    0xFF, 0xE6, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0x94, 0xFC, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x3A, 0xF9,
+    0x7F, 0x93, 0xFC, 0x70, 0xFA, 0x2A, 0xF9, 0x70, 0xFA, 0x2F, 0xC7, 0x1F, 0xC1, 0xAF, 0x97, 0x1F,
+    0xC1, 0x70, 0x99, 0x49, 0x97, 0x9F, 0xA1, 0xDA, 0x7F, 0xFD, 0x96, 0xAD, 0x09, 0xAF, 0x97, 0x9A,
+    0x49, 0x97, 0x4A, 0xAA, 0xAA, 0x97, 0x3F, 0xE7, 0x2F, 0xAE, 0x97, 0x0F, 0x1A, 0xE7, 0xE9, 0x39,
+    0xD9, 0x77, 0x73, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29,
+    0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC,
+    0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC,
+    0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE,
+    0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x75, 0xAA, 0xAA, 0xA9, 0x77, 0xFE, 0x76,
+    0xFF, 0xA7, 0x4F, 0xA0, 0xF7, 0x3F, 0xA2, 0xF7, 0x1A, 0xE5, 0xE9, 0x77, 0x77, 0x77, 0x71, 0xAF,
+    0xC9, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA,
+    0x0F, 0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA,
+    0x70, 0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF,
+    0xFE, 0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97,
+    0xF9, 0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC,
+    0x77, 0x77, 0x77, 0x7A, 0xD9, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x77, 0x1A, 0xE9,
+    0x77, 0x77, 0x10, 0x70, 0xAA, 0xAA, 0xA9, 0x73, 0xAF, 0xD7, 0x2A, 0xFE, 0xA7, 0x0A, 0xF0, 0xF9,
+    0x6A, 0xEA, 0x2F, 0x59, 0xE9, 0x4E, 0x97, 0x77, 0x29, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFF,
+    0x9F, 0x3A, 0xFF, 0xFC, 0xA2, 0x9F, 0xDA, 0xAF, 0xD9, 0x2F, 0xD2, 0x9F, 0xC9, 0x19, 0xFC, 0x4F,
+    0xC2, 0xAF, 0xA4, 0xFC, 0x2F, 0xC5, 0xFA, 0x2F, 0xC4, 0x9F, 0x91, 0x9F, 0xA4, 0xAF, 0x29, 0xFA,
+    0x4F, 0xC2, 0xAF, 0xA3, 0x9F, 0xC2, 0xAF, 0xA3, 0xFC, 0xA2, 0x9F, 0xC2, 0xAF, 0xC9, 0x3F, 0xDA,
+    0xFE, 0x4F, 0xFF, 0xD4, 0x9F, 0xEA, 0x9E, 0xA5, 0x9F, 0xC9, 0x0A, 0xEA, 0x70, 0x97, 0x77, 0x73,
+    0x9D, 0xA7, 0x59, 0xFA, 0x74, 0xAF, 0xA7, 0x4A, 0xF9, 0x75, 0xEA, 0x77, 0x75, 0x77, 0x0A, 0xAA,
+    0x97, 0x71, 0xAD, 0xA7, 0x59, 0x91, 0x9D, 0xA0, 0x99, 0x73, 0xD9, 0x0D, 0x90, 0xAD, 0x73, 0xDA,
+    0x39, 0xDA, 0x73, 0xAE, 0xAA, 0xF7, 0x5F, 0xF9, 0x76, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x5A, 0xFC,
+    0x97, 0x7F, 0xDA, 0x76, 0xAF, 0xE7, 0x59, 0xFF, 0x75, 0xFA, 0xF7, 0x49, 0xF9, 0xF7, 0x4F, 0xA0,
+    0xF7, 0x39, 0xF9, 0x0F, 0x97, 0x2F, 0xC1, 0xF9, 0x71, 0x9F, 0x91, 0xF9, 0x71, 0xFC, 0x2F, 0xA7,
+    0x09, 0xF9, 0x2A, 0xEA, 0x70, 0xFC, 0x3A, 0xF7, 0x9F, 0x93, 0xAF, 0x7F, 0xFF, 0xE6, 0xAF, 0xFF,
+    0xE6, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0x94, 0xFC, 0x99, 0x99, 0x99, 0x9A, 0xF9, 0x3A, 0xF9, 0x7F,
+    0x93, 0xFC, 0x70, 0xFA, 0x2A, 0xF9, 0x70, 0xFA, 0x2F, 0xC7, 0x1F, 0xC1, 0xAF, 0x97, 0x1F, 0xC1,
+    0x77, 0x76, 0xE9, 0x75, 0xE9, 0x71, 0xAA, 0x90, 0xAD, 0x90, 0xAA, 0x96, 0xDA, 0x0A, 0xA1, 0xAD,
+    0x7A, 0xD9, 0x2A, 0xDA, 0x79, 0xFF, 0xC7, 0x1A, 0xFE, 0x73, 0x9A, 0xDA, 0x97, 0x77, 0x69, 0xA9,
+    0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFE, 0xA9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92,
+    0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49,
+    0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA,
+    0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC,
+    0x90, 0xAE, 0xA7, 0x09, 0x74, 0x74, 0xAA, 0xA9, 0x77, 0x3E, 0x77, 0x09, 0x90, 0x9D, 0x91, 0x99,
+    0x73, 0xD9, 0x09, 0xD0, 0xAD, 0x73, 0xDA, 0x39, 0xDA, 0x73, 0xAE, 0xAA, 0xF7, 0x5F, 0xF9, 0x75,
+    0x9F, 0xCA, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xC9, 0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7,
+    0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F, 0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97,
+    0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70, 0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79,
+    0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE, 0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9,
+    0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9, 0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2,
+    0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x10, 0x77, 0x72, 0x9E, 0x77, 0xE7, 0x4A, 0xA9, 0x0D,
+    0xA1, 0xAA, 0x96, 0xDA, 0x1A, 0xA0, 0xAD, 0x7A, 0xD9, 0x2A, 0xDA, 0x79, 0xFF, 0xC7, 0x1A, 0xFE,
+    0x73, 0x9A, 0xDA, 0x97, 0x77, 0x69, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFE, 0xA9, 0xF3, 0xAF,
+    0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA,
+    0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A,
+    0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF,
+    0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x76, 0xDA, 0x77, 0x3F,
+    0x77, 0x39, 0xD7, 0x69, 0x91, 0xAD, 0xA0, 0x99, 0x73, 0xD9, 0x0D, 0x90, 0xAD, 0x73, 0xDA, 0x39,
+    0xDA, 0x73, 0xAE, 0xAA, 0xF7, 0x5F, 0xF9, 0x75, 0x9F, 0xCA, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xC9,
+    0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F,
+    0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70,
+    0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9,
+    0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x10,
+    0x72, 0x97, 0x70, 0xEA, 0x76, 0x99, 0xD7, 0x79, 0xD7, 0x2A, 0xA9, 0x0E, 0x90, 0xAA, 0x96, 0xDA,
+    0x0A, 0xA1, 0xAD, 0x7A, 0xD9, 0x2A, 0xDA, 0x79, 0xFF, 0xC7, 0x1A, 0xFE, 0x73, 0x9A, 0xDA, 0x97,
+    0x77, 0x69, 0xA9, 0x97, 0x4A, 0xFD, 0x1F, 0x4A, 0xFE, 0xA9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD,
+    0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F,
+    0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A,
+    0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9,
+    0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x77, 0x77, 0x3F, 0x91, 0xAD, 0x73, 0xFF, 0xD9,
+    0x72, 0xAD, 0x99, 0xFC, 0xA7, 0x3A, 0xA9, 0x29, 0xAA, 0x97, 0x49, 0x96, 0x99, 0x73, 0xDA, 0x4A,
+    0xD7, 0x3F, 0xAA, 0xAF, 0x73, 0x9F, 0xFC, 0x75, 0x9F, 0xDA, 0x77, 0x77, 0x77, 0x74, 0xAF, 0xC9,
+    0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F,
+    0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70,
+    0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9,
+    0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x10,
+    0x70, 0x99, 0x49, 0x97, 0x9F, 0xC9, 0x0A, 0xD7, 0xFF, 0xD9, 0x6A, 0xD1, 0x9F, 0x97, 0x77, 0x2D,
+    0x95, 0xD9, 0x6E, 0x92, 0x9E, 0x7A, 0xFF, 0xCA, 0x70, 0xFF, 0xA7, 0x29, 0xAD, 0xAA, 0x77, 0x76,
+    0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3, 0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD,
+    0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A, 0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC,
+    0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC, 0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F,
+    0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4, 0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59,
+    0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x74, 0x72, 0xAA, 0x94, 0x9A, 0xA7, 0x29, 0xE4, 0xE7, 0x3F, 0xAA,
+    0xAE, 0xA7, 0x3F, 0xFD, 0x75, 0xFF, 0x97, 0x69, 0xAD, 0xA9, 0x77, 0x77, 0x77, 0x75, 0xAF, 0xC9,
+    0x77, 0xFD, 0xA7, 0x6A, 0xFE, 0x75, 0x9F, 0xF7, 0x5F, 0xAF, 0x74, 0x9F, 0x9F, 0x74, 0xFA, 0x0F,
+    0x73, 0x9F, 0x90, 0xF9, 0x72, 0xFC, 0x1F, 0x97, 0x19, 0xF9, 0x1F, 0x97, 0x1F, 0xC2, 0xFA, 0x70,
+    0x9F, 0x92, 0xAE, 0xA7, 0x0F, 0xC3, 0xAF, 0x79, 0xF9, 0x3A, 0xF7, 0xFF, 0xFE, 0x6A, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xF5, 0xAF, 0xFF, 0xF9, 0x4F, 0xC9, 0x99, 0x99, 0x99, 0xAF, 0x93, 0xAF, 0x97, 0xF9,
+    0x3F, 0xC7, 0x0F, 0xA2, 0xAF, 0x97, 0x0F, 0xA2, 0xFC, 0x71, 0xFC, 0x1A, 0xF9, 0x71, 0xFC, 0x77,
+    0x77, 0x77, 0x7A, 0xD9, 0x77, 0x1F, 0xC7, 0x71, 0xFC, 0x97, 0x70, 0xFC, 0x77, 0x1A, 0xE9, 0x77,
+    0x77, 0x10, 0x5A, 0xAA, 0x5A, 0xA9, 0x6E, 0x4E, 0x96, 0xFA, 0xAA, 0xF7, 0xAF, 0xFC, 0x97, 0x0A,
+    0xFE, 0xA7, 0x29, 0xAD, 0xA9, 0x77, 0x76, 0x9A, 0x99, 0x74, 0xAF, 0xD1, 0xF4, 0xAF, 0xF9, 0xF3,
+    0xAF, 0xFF, 0xCA, 0x29, 0xFD, 0xAA, 0xFD, 0x92, 0xFD, 0x29, 0xFC, 0x91, 0x9F, 0xC4, 0xFC, 0x2A,
+    0xFA, 0x4F, 0xC2, 0xFC, 0x5F, 0xA2, 0xFC, 0x49, 0xF9, 0x19, 0xFA, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC,
+    0x2A, 0xFA, 0x39, 0xFC, 0x2A, 0xFA, 0x3F, 0xCA, 0x29, 0xFC, 0x2A, 0xFC, 0x93, 0xFD, 0xAF, 0xE4,
+    0xFF, 0xFD, 0x49, 0xFE, 0xA9, 0xEA, 0x59, 0xFC, 0x90, 0xAE, 0xA7, 0x09, 0x77, 0x77, 0x39, 0xDA,
+    0x75, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xAF, 0x97, 0x5E, 0xA7, 0x77, 0x50, 0x5F, 0xFF, 0xC5, 0x9F,
+    0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF, 0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59,
+    0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F,
+    0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA, 0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9,
+    0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F, 0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA,
+    0x5F, 0xFF, 0xC9, 0x77, 0x77, 0x77, 0x2A, 0xD9, 0x76, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x76,
+    0xAE, 0x77, 0x76, 0x79, 0x9A, 0x99, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC,
+    0xA1, 0x9F, 0xA1, 0xFC, 0x93, 0xFA, 0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA,
+    0xAA, 0xFE, 0x09, 0xFF, 0xFD, 0x19, 0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F,
+    0xA7, 0x29, 0xFC, 0x6A, 0x3F, 0xDA, 0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7,
+    0x19, 0x99, 0x77, 0x74, 0x9A, 0xCA, 0x74, 0xFC, 0x72, 0xAF, 0xC7, 0x29, 0xFA, 0x73, 0xEA, 0x77,
+    0x71, 0x77, 0x75, 0xAF, 0xA7, 0x5F, 0xE7, 0x4A, 0xAA, 0xF9, 0x76, 0xAE, 0x97, 0x6F, 0x75, 0xFC,
+    0x76, 0xE9, 0x77, 0xAA, 0xA7, 0x77, 0x7F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F,
+    0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x40, 0x70, 0xAA,
+    0xAA, 0x97, 0x2A, 0xFC, 0xA7, 0x1A, 0xFD, 0x74, 0xAE, 0x97, 0x3A, 0xE7, 0x29, 0xAE, 0xA7, 0x2F,
+    0x97, 0x3E, 0x77, 0x75, 0x99, 0xA9, 0x97, 0x1A, 0xFE, 0xA5, 0x9F, 0xFE, 0x39, 0xFF, 0xF9, 0x2F,
+    0xCA, 0x19, 0xFA, 0x1F, 0xC9, 0x3F, 0xA0, 0x9F, 0xA4, 0xFA, 0x0A, 0xF9, 0x29, 0xFC, 0x90, 0xFC,
+    0xAA, 0xAF, 0xE0, 0x9F, 0xFF, 0xD1, 0x9F, 0xFF, 0x92, 0xAF, 0xDA, 0xAA, 0x95, 0xAF, 0x97, 0x29,
+    0xFA, 0x72, 0x9F, 0xC6, 0xA3, 0xFD, 0xA9, 0x9A, 0xE3, 0x9F, 0xFF, 0x4A, 0xFF, 0xE5, 0x9F, 0xFA,
+    0x71, 0x99, 0x97, 0x77, 0x19, 0x97, 0x1F, 0xA2, 0xAD, 0x70, 0xFE, 0xAA, 0xE7, 0xAF, 0xFE, 0x97,
+    0xE1, 0xAF, 0xCA, 0x70, 0xD9, 0x3A, 0xCA, 0x97, 0x77, 0x77, 0x72, 0xFF, 0xFC, 0x69, 0xFF, 0xFC,
+    0x6A, 0xFF, 0xFA, 0x6F, 0xFF, 0xCA, 0x6F, 0xC9, 0x99, 0x99, 0x99, 0x97, 0xFC, 0x76, 0x9F, 0xA7,
+    0x6A, 0xF9, 0x76, 0xFC, 0x77, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x69, 0xFF, 0xFA, 0x69, 0xFF, 0xF9,
+    0x6A, 0xFF, 0xF7, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xC7, 0x69, 0xFA, 0x76, 0xAF, 0x97, 0x6F,
+    0xC9, 0x76, 0xFC, 0x77, 0xFC, 0x76, 0x9F, 0xFF, 0xC6, 0xAF, 0xFF, 0xA6, 0xFF, 0xFC, 0xA6, 0xFF,
+    0xFC, 0x95, 0x77, 0x99, 0x69, 0xF9, 0x2E, 0x59, 0xFE, 0xAE, 0xA5, 0xFF, 0xF5, 0x9D, 0xA0, 0x9F,
+    0xD9, 0x59, 0xD3, 0x9A, 0xCA, 0x97, 0x77, 0x59, 0x9A, 0x99, 0x73, 0xAF, 0xEA, 0x79, 0xFF, 0xE5,
+    0x9F, 0xFF, 0x94, 0xFC, 0xA1, 0x9F, 0xA3, 0xFC, 0x93, 0xFA, 0x29, 0xFA, 0x4F, 0xA2, 0xAF, 0x92,
+    0x9F, 0xC9, 0x2F, 0xCA, 0xAA, 0xFE, 0x29, 0xFF, 0xFD, 0x39, 0xFF, 0xF9, 0x4A, 0xFD, 0xAA, 0xA9,
+    0x7A, 0xF9, 0x74, 0x9F, 0xA7, 0x49, 0xFC, 0x6A, 0x5F, 0xDA, 0x99, 0xAE, 0x59, 0xFF, 0xF6, 0xAF,
+    0xFE, 0x79, 0xFF, 0xA7, 0x39, 0x99, 0x71, 0x77, 0x39, 0xAA, 0xA9, 0x77, 0x3E, 0xA7, 0x3F, 0xC2,
+    0xEA, 0x73, 0xFD, 0xA0, 0xE9, 0x73, 0xFF, 0x77, 0xF1, 0xF7, 0x5E, 0xA3, 0xE9, 0x77, 0x77, 0x77,
+    0x75, 0xFF, 0xFC, 0x72, 0x9F, 0xFF, 0xC7, 0x2A, 0xFF, 0xFA, 0x72, 0xFF, 0xFC, 0xA7, 0x2F, 0xC9,
+    0x99, 0x99, 0x99, 0x97, 0x3F, 0xC7, 0x72, 0x9F, 0xA7, 0x72, 0xAF, 0x97, 0x72, 0xFC, 0x77, 0x3F,
+    0xC9, 0x99, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xFA, 0x72, 0x9F, 0xFF, 0x97, 0x2A, 0xFF, 0xF7, 0x3F,
+    0xCA, 0xAA, 0xAA, 0xAA, 0xA7, 0x3F, 0xC7, 0x72, 0x9F, 0xA7, 0x72, 0xAF, 0x97, 0x72, 0xFC, 0x97,
+    0x72, 0xFC, 0x77, 0x3F, 0xC7, 0x72, 0x9F, 0xFF, 0xC7, 0x2A, 0xFF, 0xFA, 0x72, 0xFF, 0xFC, 0xA7,
+    0x2F, 0xFF, 0xC9, 0x71, 0x77, 0x77, 0x70, 0xF7, 0x71, 0xAE, 0x71, 0xAF, 0xC9, 0x09, 0xE7, 0x1A,
+    0xFE, 0x0A, 0xA9, 0x71, 0xAE, 0xA9, 0xE9, 0x73, 0xAE, 0x91, 0xAE, 0x72, 0x9D, 0xA4, 0xAD, 0x97,
+    0x77, 0x74, 0x99, 0xA9, 0x97, 0x7A, 0xFE, 0xA7, 0x39, 0xFF, 0xE7, 0x19, 0xFF, 0xF9, 0x70, 0xFC,
+    0xA1, 0x9F, 0xA7, 0xFC, 0x93, 0xFA, 0x69, 0xFA, 0x4F, 0xA6, 0xAF, 0x92, 0x9F, 0xC9, 0x6F, 0xCA,
+    0xAA, 0xFE, 0x69, 0xFF, 0xFD, 0x79, 0xFF, 0xF9, 0x70, 0xAF, 0xDA, 0xAA, 0x97, 0x3A, 0xF9, 0x77,
+    0x09, 0xFA, 0x77, 0x09, 0xFC, 0x6A, 0x71, 0xFD, 0xA9, 0x9A, 0xE7, 0x19, 0xFF, 0xF7, 0x2A, 0xFF,
+    0xE7, 0x39, 0xFF, 0xA7, 0x79, 0x99, 0x75, 0x29, 0xAA, 0xA9, 0x77, 0xEA, 0x77, 0x0E, 0x2F, 0xC7,
+    0x09, 0xD9, 0x0F, 0xDA, 0x73, 0xFF, 0x72, 0xF1, 0xF7, 0x0E, 0xA3, 0xE9, 0x77, 0x77, 0x76, 0xFF,
+    0xFC, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xC9, 0x99, 0x99, 0x99, 0x96,
+    0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x59, 0xFF,
+    0xFA, 0x59, 0xFF, 0xF9, 0x5A, 0xFF, 0xF6, 0xFC, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xC7, 0x59, 0xFA,
+    0x75, 0xAF, 0x97, 0x5F, 0xC9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5,
+    0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0x94, 0x77, 0x19, 0xE9, 0x74, 0xEA, 0x75, 0xE1, 0xAF, 0xC9, 0x5A,
+    0xA9, 0xAF, 0xE7, 0xAE, 0xA9, 0xE9, 0x5A, 0xE9, 0x1A, 0xE4, 0x9D, 0xA4, 0xAD, 0x97, 0x77, 0x09,
+    0x9A, 0x99, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xE3, 0x9F, 0xFF, 0x92, 0xFC, 0xA1, 0x9F, 0xA1, 0xFC,
+    0x93, 0xFA, 0x09, 0xFA, 0x4F, 0xA0, 0xAF, 0x92, 0x9F, 0xC9, 0x0F, 0xCA, 0xAA, 0xFE, 0x09, 0xFF,
+    0xFD, 0x19, 0xFF, 0xF9, 0x2A, 0xFD, 0xAA, 0xA9, 0x5A, 0xF9, 0x72, 0x9F, 0xA7, 0x29, 0xFC, 0x6A,
+    0x3F, 0xDA, 0x99, 0xAE, 0x39, 0xFF, 0xF4, 0xAF, 0xFE, 0x59, 0xFF, 0xA7, 0x19, 0x99, 0x70, 0x77,
+    0x19, 0xAA, 0x97, 0x72, 0xF9, 0x77, 0x19, 0x9E, 0x77, 0x3D, 0xA7, 0x19, 0xFC, 0x1A, 0xE7, 0x2F,
+    0xDA, 0x0D, 0x97, 0x2F, 0xF7, 0x5F, 0x1E, 0xA7, 0x3E, 0xA3, 0xE9, 0x77, 0x77, 0x77, 0x7F, 0xFF,
+    0xC7, 0x09, 0xFF, 0xFC, 0x70, 0xAF, 0xFF, 0xA7, 0x0F, 0xFF, 0xCA, 0x70, 0xFC, 0x99, 0x99, 0x99,
+    0x99, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC7, 0x71, 0xFC, 0x99, 0x99,
+    0x99, 0x99, 0x70, 0x9F, 0xFF, 0xA7, 0x09, 0xFF, 0xF9, 0x70, 0xAF, 0xFF, 0x71, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x71, 0xFC, 0x77, 0x09, 0xFA, 0x77, 0x0A, 0xF9, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC7,
+    0x71, 0xFC, 0x77, 0x09, 0xFF, 0xFC, 0x70, 0xAF, 0xFF, 0xA7, 0x0F, 0xFF, 0xCA, 0x70, 0xFF, 0xFC,
+    0x97, 0x77, 0x77, 0x4E, 0xA7, 0x70, 0xF9, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x70, 0xFD, 0x1D, 0xA9,
+    0x7A, 0xFD, 0xA0, 0xAA, 0x70, 0xAE, 0xAA, 0xE7, 0x2A, 0xE9, 0x1A, 0xDA, 0x70, 0x9D, 0xA4, 0xAD,
+    0x77, 0x77, 0x19, 0x9A, 0x99, 0x75, 0xAF, 0xEA, 0x71, 0x9F, 0xFE, 0x79, 0xFF, 0xF9, 0x6F, 0xCA,
+    0x19, 0xFA, 0x5F, 0xC9, 0x3F, 0xA4, 0x9F, 0xA4, 0xFA, 0x4A, 0xF9, 0x29, 0xFC, 0x94, 0xFC, 0xAA,
+    0xAF, 0xE4, 0x9F, 0xFF, 0xD5, 0x9F, 0xFF, 0x96, 0xAF, 0xDA, 0xAA, 0x97, 0x1A, 0xF9, 0x76, 0x9F,
+    0xA7, 0x69, 0xFC, 0x6A, 0x7F, 0xDA, 0x99, 0xAE, 0x79, 0xFF, 0xF7, 0x0A, 0xFF, 0xE7, 0x19, 0xFF,
+    0xA7, 0x59, 0x99, 0x73, 0x77, 0x75, 0xAD, 0xA2, 0xAC, 0xA7, 0x0F, 0xDA, 0xE9, 0x7A, 0xDA, 0xFD,
+    0xA7, 0x0D, 0x92, 0xAD, 0x97, 0x49, 0x99, 0x99, 0x75, 0xFD, 0x97, 0x3F, 0xF7, 0x2F, 0x90, 0xEA,
+    0x70, 0xEA, 0x3E, 0x97, 0x77, 0x77, 0x6F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F,
+    0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x40, 0x70, 0x99,
+    0x39, 0x97, 0xAF, 0x90, 0x9D, 0x95, 0xAF, 0xFD, 0x6D, 0xA0, 0x9F, 0xC7, 0xA9, 0x39, 0x99, 0x72,
+    0x9A, 0xAA, 0xAA, 0x72, 0x9F, 0xD9, 0x70, 0x9F, 0xF7, 0xAE, 0xA1, 0xEA, 0x59, 0xDA, 0x4A, 0xD7,
+    0x77, 0x39, 0x9A, 0x99, 0x72, 0xAF, 0xEA, 0x69, 0xFF, 0xE4, 0x9F, 0xFF, 0x93, 0xFC, 0xA1, 0x9F,
+    0xA2, 0xFC, 0x93, 0xFA, 0x19, 0xFA, 0x4F, 0xA1, 0xAF, 0x92, 0x9F, 0xC9, 0x1F, 0xCA, 0xAA, 0xFE,
+    0x19, 0xFF, 0xFD, 0x29, 0xFF, 0xF9, 0x3A, 0xFD, 0xAA, 0xA9, 0x6A, 0xF9, 0x73, 0x9F, 0xA7, 0x39,
+    0xFC, 0x6A, 0x4F, 0xDA, 0x99, 0xAE, 0x49, 0xFF, 0xF5, 0xAF, 0xFE, 0x69, 0xFF, 0xA7, 0x29, 0x99,
+    0x70, 0x72, 0xAA, 0xAA, 0xA9, 0x74, 0xFE, 0x73, 0xFF, 0xA7, 0x1F, 0xA0, 0xF7, 0x0F, 0x91, 0x9F,
+    0x6A, 0xDA, 0x49, 0xE7, 0x77, 0x77, 0x6F, 0xFF, 0xC5, 0x9F, 0xFF, 0xC5, 0xAF, 0xFF, 0xA5, 0xFF,
+    0xFC, 0xA5, 0xFC, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0xAF, 0x97, 0x5F, 0xC7,
+    0x6F, 0xC9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xA5, 0x9F, 0xFF, 0x95, 0xAF, 0xFF, 0x6F, 0xCA,
+    0xAA, 0xAA, 0xAA, 0xA6, 0xFC, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x75, 0xFC, 0x97, 0x5F, 0xC7, 0x6F,
+    0xC7, 0x59, 0xFF, 0xFC, 0x5A, 0xFF, 0xFA, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9, 0x77, 0x77, 0x77,
+    0x2A, 0xD9, 0x76, 0xFC, 0x75, 0x9F, 0xC7, 0x59, 0xFC, 0x76, 0xAE, 0x77, 0x76, 0x70, 0xAA, 0xAA,
+    0xA9, 0x72, 0xFE, 0x71, 0xFF, 0x97, 0xFA, 0x0F, 0x6F, 0x91, 0x9E, 0xA4, 0xAD, 0xA4, 0x9E, 0x77,
+    0x72, 0x99, 0xA9, 0x97, 0x2A, 0xFE, 0xA6, 0x9F, 0xFE, 0x49, 0xFF, 0xF9, 0x3F, 0xCA, 0x19, 0xFA,
+    0x2F, 0xC9, 0x3F, 0xA1, 0x9F, 0xA4, 0xFA, 0x1A, 0xF9, 0x29, 0xFC, 0x91, 0xFC, 0xAA, 0xAF, 0xE1,
+    0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0x93, 0xAF, 0xDA, 0xAA, 0x96, 0xAF, 0x97, 0x39, 0xFA, 0x73, 0x9F,
+    0xC6, 0xA4, 0xFD, 0xA9, 0x9A, 0xE4, 0x9F, 0xFF, 0x5A, 0xFF, 0xE6, 0x9F, 0xFA, 0x72, 0x99, 0x97,
+    0x77, 0x69, 0xAC, 0xA7, 0x5F, 0xC7, 0x3A, 0xFC, 0x73, 0x9F, 0xA7, 0x4E, 0xA7, 0x77, 0x30, 0x77,
+    0x7F, 0xCA, 0x71, 0xFE, 0x70, 0xAA, 0xAF, 0x73, 0xAE, 0x73, 0xF7, 0x1F, 0xC7, 0x2E, 0x97, 0x3A,
+    0xA9, 0x77, 0x70, 0xFF, 0xD9, 0x4F, 0xFD, 0x93, 0x9F, 0xFD, 0x5A, 0xFE, 0xA9, 0x7F, 0xC7, 0x19,
+    0xFA, 0x71, 0xAF, 0x97, 0x1A, 0xF7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x2F, 0xC7, 0x19, 0xFA,
+    0x70, 0xAF, 0xDA, 0x59, 0xFF, 0xD4, 0xAF, 0xFD, 0x4F, 0xFD, 0xA4, 0x49, 0xAA, 0xA9, 0x7F, 0xD9,
+    0x5F, 0xE5, 0x91, 0xF7, 0x0F, 0x69, 0xAE, 0x96, 0xF9, 0x69, 0xE7, 0x77, 0x71, 0xAF, 0x96, 0xFC,
+    0x7F, 0xC6, 0x9F, 0xA6, 0xAF, 0x96, 0xFC, 0x7F, 0xC7, 0xFC, 0x69, 0xFA, 0x6A, 0xF9, 0x6F, 0xC7,
+    0xFC, 0x7F, 0xA6, 0x9F, 0xA6, 0xAF, 0x96, 0xFC, 0x7F, 0xC6, 0x9F, 0xA6, 0x4F, 0xFD, 0x94, 0xFF,
+    0xD9, 0x39, 0xFF, 0xD5, 0xAF, 0xEA, 0x97, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xAF, 0x72,
+    0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x71, 0x9F,
+    0xA7, 0x1A, 0xF9, 0x71, 0xFC, 0x72, 0xFC, 0x71, 0x9F, 0xA7, 0x0A, 0xFD, 0xA5, 0x9F, 0xFD, 0x4A,
+    0xFF, 0xD4, 0xFF, 0xDA, 0x77, 0x77, 0x7A, 0xD9, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xAE,
+    0x97, 0x77, 0x00, 0x79, 0x97, 0x0F, 0x95, 0xAF, 0xA5, 0xFC, 0xA5, 0xAF, 0x79, 0xA9, 0x77, 0x76,
+    0xAF, 0x95, 0xFC, 0x6F, 0xC5, 0x9F, 0xA5, 0xAF, 0x95, 0xFC, 0x6F, 0xC6, 0xFC, 0x59, 0xFA, 0x5A,
+    0xF9, 0x5F, 0xC6, 0xFC, 0x6F, 0xA5, 0x9F, 0xA5, 0xAF, 0x95, 0xFC, 0x6F, 0xC5, 0x9F, 0xA7, 0x77,
+    0x59, 0xDA, 0x69, 0xFA, 0x5A, 0xFC, 0x5A, 0xFA, 0x6E, 0xA7, 0x72, 0x77, 0x77, 0x9F, 0xE9, 0x73,
+    0xAF, 0xFE, 0x71, 0xFF, 0xFD, 0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F, 0xD9, 0x39, 0xFC, 0xA5, 0xFD,
+    0x3F, 0xCA, 0x69, 0xFC, 0x2A, 0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x70, 0xFC, 0x91, 0xFC, 0x71, 0xFC,
+    0x90, 0x9F, 0xC7, 0x1F, 0xC9, 0x0A, 0xFA, 0x71, 0xFC, 0x1F, 0xC9, 0x71, 0xFC, 0x1F, 0xC7, 0x19,
+    0xFC, 0x1F, 0xC7, 0x1A, 0xFA, 0x1F, 0xC7, 0x1F, 0xC9, 0x1F, 0xC9, 0x7A, 0xFC, 0x2F, 0xCA, 0x7F,
+    0xCA, 0x2A, 0xFC, 0x6F, 0xD4, 0xFD, 0x92, 0x9F, 0xD9, 0x4A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7,
+    0x0F, 0xFF, 0x97, 0x29, 0xFF, 0x97, 0x70, 0x99, 0x77, 0x77, 0x71, 0xAD, 0xA7, 0x71, 0xAF, 0xA7,
+    0x70, 0xFC, 0xA7, 0x70, 0xFC, 0x97, 0x70, 0x9E, 0xA7, 0x77, 0x72, 0x79, 0xAA, 0x97, 0x29, 0xFF,
+    0x7A, 0xFF, 0xD9, 0x4A, 0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9, 0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC,
+    0x4F, 0xC1, 0xFC, 0x94, 0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A,
+    0xF9, 0x49, 0xFA, 0x0A, 0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39, 0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2,
+    0xFD, 0xAF, 0xE3, 0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9, 0x73, 0x99, 0x97, 0x77, 0x7A, 0xD9,
+    0x74, 0xFC, 0x73, 0x9F, 0xC7, 0x39, 0xFC, 0x74, 0xAE, 0x77, 0x73, 0x77, 0x77, 0x2F, 0xCA, 0x77,
+    0x0F, 0xDA, 0x77, 0xCA, 0xAF, 0x77, 0x2A, 0xE7, 0x71, 0x9E, 0xA7, 0x70, 0xFA, 0x77, 0x09, 0xE9,
+    0x77, 0x2A, 0xA9, 0x77, 0x77, 0x69, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF,
+    0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F,
+    0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7,
+    0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71,
+    0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29,
+    0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09,
+    0x97, 0x30, 0x79, 0xAA, 0xAA, 0x74, 0xFD, 0xA7, 0x2F, 0xE7, 0x29, 0x1A, 0xE9, 0x74, 0xAE, 0x73,
+    0x9A, 0xEA, 0x73, 0xF9, 0x74, 0xE7, 0x77, 0x79, 0xAA, 0x97, 0x29, 0xFF, 0x7A, 0xFF, 0xD9, 0x4A,
+    0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9, 0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC, 0x4F, 0xC1, 0xFC, 0x94,
+    0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A, 0xF9, 0x49, 0xFA, 0x0A,
+    0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39, 0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2, 0xFD, 0xAF, 0xE3, 0x9F,
+    0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9, 0x73, 0x99, 0x97, 0x00, 0x77, 0x5A, 0xAA, 0xA7, 0x75, 0xAE,
+    0x97, 0x4A, 0xFA, 0x19, 0xE9, 0x74, 0x9F, 0xD9, 0x9E, 0x75, 0x9F, 0xF7, 0x70, 0x9E, 0xA1, 0xE9,
+    0x76, 0x9E, 0x92, 0x9E, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFE, 0x97, 0x7A, 0xFF, 0xE7, 0x5F, 0xFF,
+    0xD7, 0x3F, 0xFF, 0xF7, 0x1F, 0xE9, 0x19, 0xFD, 0x97, 0x9F, 0xCA, 0x5F, 0xD7, 0xFC, 0xA6, 0x9F,
+    0xC6, 0xAF, 0xC7, 0x0F, 0xC6, 0xFC, 0x97, 0x0F, 0xC9, 0x5F, 0xC7, 0x1F, 0xC9, 0x49, 0xFC, 0x71,
+    0xFC, 0x94, 0xAF, 0xA7, 0x1F, 0xC5, 0xFC, 0x97, 0x1F, 0xC5, 0xFC, 0x71, 0x9F, 0xC5, 0xFC, 0x71,
+    0xAF, 0xA5, 0xFC, 0x71, 0xFC, 0x95, 0xFC, 0x97, 0xAF, 0xC6, 0xFC, 0xA7, 0xFC, 0xA6, 0xAF, 0xC6,
+    0xFD, 0x70, 0xFD, 0x92, 0x9F, 0xD9, 0x70, 0xAF, 0xFF, 0xEA, 0x72, 0xFF, 0xFD, 0xA7, 0x4F, 0xFF,
+    0x97, 0x69, 0xFF, 0x97, 0x74, 0x99, 0x77, 0x77, 0x77, 0x70, 0xF7, 0x71, 0xAE, 0x71, 0xAF, 0xC9,
+    0x09, 0xE7, 0x1A, 0xFE, 0x0A, 0xA9, 0x71, 0xAE, 0xA9, 0xE9, 0x73, 0x9E, 0x91, 0xAE, 0x72, 0x9D,
+    0xA4, 0xAD, 0x97, 0x77, 0x74, 0x9A, 0xA9, 0x77, 0x9F, 0xF7, 0x4A, 0xFF, 0xD9, 0x71, 0xAF, 0xFF,
+    0x70, 0x9F, 0xDA, 0xAF, 0xC9, 0x7F, 0xCA, 0x29, 0xFC, 0x69, 0xFC, 0x4F, 0xC6, 0xFC, 0x94, 0xFC,
+    0x6F, 0xC5, 0xFC, 0x59, 0xFA, 0x5F, 0xC5, 0x9F, 0xA5, 0xFC, 0x5A, 0xF9, 0x49, 0xFA, 0x5A, 0xF9,
+    0x4F, 0xC9, 0x59, 0xFA, 0x39, 0xFC, 0x69, 0xFC, 0x29, 0xFC, 0xA7, 0xFD, 0xAF, 0xE7, 0x09, 0xFF,
+    0xF7, 0x2A, 0xFF, 0xD7, 0x49, 0xFE, 0x97, 0x70, 0x99, 0x97, 0x50, 0x4A, 0xAA, 0xA7, 0x72, 0x9E,
+    0x77, 0x3A, 0xDA, 0x1A, 0xFA, 0x73, 0xAD, 0x09, 0xFD, 0x97, 0x59, 0xFF, 0x74, 0x9E, 0xA1, 0xE9,
+    0x72, 0x9E, 0x92, 0x9E, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xE9, 0x73, 0xAF, 0xFE, 0x71, 0xFF, 0xFD,
+    0x7F, 0xFF, 0xF5, 0xFE, 0x91, 0x9F, 0xD9, 0x39, 0xFC, 0xA5, 0xFD, 0x3F, 0xCA, 0x69, 0xFC, 0x2A,
+    0xFC, 0x70, 0xFC, 0x2F, 0xC9, 0x70, 0xFC, 0x91, 0xFC, 0x71, 0xFC, 0x90, 0x9F, 0xC7, 0x1F, 0xC9,
+    0x0A, 0xFA, 0x71, 0xFC, 0x1F, 0xC9, 0x71, 0xFC, 0x1F, 0xC7, 0x19, 0xFC, 0x1F, 0xC7, 0x1A, 0xFA,
+    0x1F, 0xC7, 0x1F, 0xC9, 0x1F, 0xC9, 0x7A, 0xFC, 0x2F, 0xCA, 0x7F, 0xCA, 0x2A, 0xFC, 0x6F, 0xD4,
+    0xFD, 0x92, 0x9F, 0xD9, 0x4A, 0xFF, 0xFE, 0xA6, 0xFF, 0xFD, 0xA7, 0x0F, 0xFF, 0x97, 0x29, 0xFF,
+    0x97, 0x70, 0x99, 0x73, 0x77, 0x29, 0xE9, 0x75, 0xEA, 0x76, 0xE1, 0xAF, 0xC9, 0x6A, 0xA9, 0xAF,
+    0xE7, 0x0A, 0xEA, 0x9E, 0x96, 0x9E, 0x91, 0xAE, 0x59, 0xDA, 0x4A, 0xD9, 0x77, 0x72, 0x9A, 0xA9,
+    0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF, 0xFF, 0x39, 0xFD, 0xAA, 0xFC, 0x92, 0xFC, 0xA2, 0x9F,
+    0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F, 0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA,
+    0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF, 0x94, 0xFC, 0x90, 0x9F, 0xA3, 0x9F, 0xC1, 0x9F, 0xC2,
+    0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF, 0xF5, 0xAF, 0xFD, 0x79, 0xFE, 0x97, 0x39, 0x99, 0x70,
+    0x77, 0x3A, 0xAA, 0x77, 0x49, 0xF7, 0x74, 0x9A, 0xD9, 0x77, 0x49, 0xD7, 0x4A, 0xFA, 0x1E, 0x97,
+    0x3A, 0xFD, 0x09, 0xD7, 0x4A, 0xFE, 0xA7, 0x69, 0xEA, 0x09, 0xE9, 0x74, 0x9E, 0x92, 0x9E, 0x77,
+    0x77, 0x77, 0x77, 0x9F, 0xE9, 0x75, 0xAF, 0xFE, 0x73, 0xFF, 0xFD, 0x71, 0xFF, 0xFF, 0x7F, 0xE9,
+    0x19, 0xFD, 0x95, 0x9F, 0xCA, 0x5F, 0xD5, 0xFC, 0xA6, 0x9F, 0xC4, 0xAF, 0xC7, 0x0F, 0xC4, 0xFC,
+    0x97, 0x0F, 0xC9, 0x3F, 0xC7, 0x1F, 0xC9, 0x29, 0xFC, 0x71, 0xFC, 0x92, 0xAF, 0xA7, 0x1F, 0xC3,
+    0xFC, 0x97, 0x1F, 0xC3, 0xFC, 0x71, 0x9F, 0xC3, 0xFC, 0x71, 0xAF, 0xA3, 0xFC, 0x71, 0xFC, 0x93,
+    0xFC, 0x97, 0xAF, 0xC4, 0xFC, 0xA7, 0xFC, 0xA4, 0xAF, 0xC6, 0xFD, 0x6F, 0xD9, 0x29, 0xFD, 0x96,
+    0xAF, 0xFF, 0xEA, 0x70, 0xFF, 0xFD, 0xA7, 0x2F, 0xFF, 0x97, 0x49, 0xFF, 0x97, 0x72, 0x99, 0x75,
+    0x77, 0x77, 0x4E, 0xA7, 0x70, 0xF9, 0x77, 0x1D, 0xA7, 0x70, 0x9D, 0x97, 0xFD, 0x1E, 0x97, 0xAF,
+    0xDA, 0x0A, 0xA7, 0x0A, 0xEA, 0xAE, 0x72, 0xAE, 0x91, 0xAE, 0x70, 0x9D, 0xA4, 0xAD, 0x77, 0x77,
+    0x19, 0xAA, 0x97, 0x59, 0xFF, 0x72, 0xAF, 0xFD, 0x97, 0xAF, 0xFF, 0x69, 0xFD, 0xAA, 0xFC, 0x95,
+    0xFC, 0xA2, 0x9F, 0xC4, 0x9F, 0xC4, 0xFC, 0x4F, 0xC9, 0x4F, 0xC4, 0xFC, 0x5F, 0xC3, 0x9F, 0xA5,
+    0xFC, 0x39, 0xFA, 0x5F, 0xC3, 0xAF, 0x94, 0x9F, 0xA3, 0xAF, 0x94, 0xFC, 0x93, 0x9F, 0xA3, 0x9F,
+    0xC4, 0x9F, 0xC2, 0x9F, 0xCA, 0x5F, 0xDA, 0xFE, 0x69, 0xFF, 0xF7, 0x0A, 0xFF, 0xD7, 0x29, 0xFE,
+    0x97, 0x69, 0x99, 0x73, 0x77, 0x77, 0x19, 0xE9, 0x2D, 0x73, 0xAF, 0xDA, 0xE7, 0x3E, 0xAF, 0xD7,
+    0x39, 0xD2, 0x9D, 0xA7, 0x70, 0x99, 0x99, 0x77, 0x09, 0xFD, 0x76, 0x9F, 0xE9, 0x74, 0x9F, 0x0A,
+    0xE7, 0x39, 0xE9, 0x2A, 0xE7, 0x77, 0x77, 0x77, 0x19, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF,
+    0xD7, 0xFF, 0xFF, 0x5F, 0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2,
+    0xAF, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC,
+    0x90, 0xAF, 0xA7, 0x1F, 0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF,
+    0xA1, 0xFC, 0x71, 0xFC, 0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD,
+    0x4F, 0xD9, 0x29, 0xFD, 0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F,
+    0xF9, 0x77, 0x09, 0x97, 0x30, 0x70, 0x99, 0x39, 0x97, 0xAF, 0x90, 0x9D, 0x95, 0xAF, 0xFD, 0x6D,
+    0xA0, 0x9F, 0xC7, 0xAA, 0x39, 0x99, 0x72, 0x9A, 0xAA, 0xAA, 0x72, 0x9F, 0xD9, 0x70, 0x9F, 0xF7,
+    0x9E, 0xA1, 0xEA, 0x59, 0xDA, 0x4A, 0xD7, 0x77, 0x39, 0xAA, 0x97, 0x29, 0xFF, 0x7A, 0xFF, 0xD9,
+    0x4A, 0xFF, 0xF3, 0x9F, 0xDA, 0xAF, 0xC9, 0x2F, 0xCA, 0x29, 0xFC, 0x19, 0xFC, 0x4F, 0xC1, 0xFC,
+    0x94, 0xFC, 0x1F, 0xC5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x0A, 0xF9, 0x49, 0xFA,
+    0x0A, 0xF9, 0x4F, 0xC9, 0x09, 0xFA, 0x39, 0xFC, 0x19, 0xFC, 0x29, 0xFC, 0xA2, 0xFD, 0xAF, 0xE3,
+    0x9F, 0xFF, 0x5A, 0xFF, 0xD7, 0x9F, 0xE9, 0x73, 0x99, 0x97, 0x00, 0x73, 0x9A, 0xAA, 0xAA, 0x77,
+    0x9F, 0xDA, 0x75, 0x9F, 0xF7, 0x49, 0xF9, 0xAE, 0xA7, 0x29, 0xF2, 0xAE, 0x97, 0x1E, 0xA4, 0xAD,
+    0xA7, 0x77, 0x77, 0x77, 0x09, 0xFE, 0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xFF, 0xD7, 0xFF, 0xFF, 0x5F,
+    0xE9, 0x19, 0xFD, 0x93, 0x9F, 0xCA, 0x5F, 0xD3, 0xFC, 0xA6, 0x9F, 0xC2, 0xAF, 0xC7, 0x0F, 0xC2,
+    0xFC, 0x97, 0x0F, 0xC9, 0x1F, 0xC7, 0x1F, 0xC9, 0x09, 0xFC, 0x71, 0xFC, 0x90, 0xAF, 0xA7, 0x1F,
+    0xC1, 0xFC, 0x97, 0x1F, 0xC1, 0xFC, 0x71, 0x9F, 0xC1, 0xFC, 0x71, 0xAF, 0xA1, 0xFC, 0x71, 0xFC,
+    0x91, 0xFC, 0x97, 0xAF, 0xC2, 0xFC, 0xA7, 0xFC, 0xA2, 0xAF, 0xC6, 0xFD, 0x4F, 0xD9, 0x29, 0xFD,
+    0x94, 0xAF, 0xFF, 0xEA, 0x6F, 0xFF, 0xDA, 0x70, 0xFF, 0xF9, 0x72, 0x9F, 0xF9, 0x77, 0x09, 0x97,
+    0x77, 0x77, 0x1A, 0xDA, 0x77, 0x1A, 0xFA, 0x77, 0x0F, 0xCA, 0x77, 0x0F, 0xC9, 0x77, 0x09, 0xEA,
+    0x77, 0x77, 0x20, 0x70, 0xAA, 0xAA, 0xA9, 0x72, 0xFE, 0x71, 0xFF, 0x97, 0xFA, 0x0F, 0x6F, 0x91,
+    0x9E, 0xA4, 0xAD, 0xA4, 0x9E, 0x77, 0x72, 0x9A, 0xA9, 0x72, 0x9F, 0xF7, 0xAF, 0xFD, 0x94, 0xAF,
+    0xFF, 0x39, 0xFD, 0xAA, 0xFC, 0x92, 0xFC, 0xA2, 0x9F, 0xC1, 0x9F, 0xC4, 0xFC, 0x1F, 0xC9, 0x4F,
+    0xC1, 0xFC, 0x5F, 0xC0, 0x9F, 0xA5, 0xFC, 0x09, 0xFA, 0x5F, 0xC0, 0xAF, 0x94, 0x9F, 0xA0, 0xAF,
+    0x94, 0xFC, 0x90, 0x9F, 0xA3, 0x9F, 0xC1, 0x9F, 0xC2, 0x9F, 0xCA, 0x2F, 0xDA, 0xFE, 0x39, 0xFF,
+    0xF5, 0xAF, 0xFD, 0x79, 0xFE, 0x97, 0x39, 0x99, 0x77, 0x77, 0xAD, 0x97, 0x4F, 0xC7, 0x39, 0xFC,
+    0x73, 0x9F, 0xC7, 0x4A, 0xE7, 0x77, 0x30, 0x75, 0xAA, 0xAA, 0xA7, 0x75, 0xFC, 0xA7, 0x74, 0x9F,
+    0xA7, 0x75, 0xFA, 0x77, 0x5F, 0x97, 0x75, 0x9E, 0x77, 0x77, 0x39, 0x99, 0x99, 0x77, 0x6F, 0xC7,
+    0x09, 0xFE, 0x93, 0x9F, 0xA6, 0xAF, 0xFE, 0x91, 0xAF, 0x95, 0xFF, 0xFD, 0x99, 0xFA, 0x5F, 0xFF,
+    0xFF, 0xC5, 0xAF, 0xD9, 0x2A, 0xFF, 0xA5, 0x9F, 0xCA, 0x5A, 0xFD, 0x96, 0xFC, 0xA7, 0xFC, 0x79,
+    0xFC, 0x70, 0xFC, 0x7F, 0xC9, 0x70, 0xFC, 0x96, 0xFC, 0x71, 0xFC, 0x95, 0x9F, 0xA7, 0x1F, 0xC6,
+    0xAF, 0x97, 0x1F, 0xC6, 0xFC, 0x97, 0x1F, 0xC6, 0xFC, 0x71, 0x9F, 0xC6, 0xFC, 0x71, 0xAF, 0xA6,
+    0xFC, 0x71, 0xFC, 0x7F, 0xC7, 0x0A, 0xFC, 0x7F, 0xC9, 0x7F, 0xC9, 0x7A, 0xFC, 0x6F, 0xD7, 0x1F,
+    0xD3, 0x9F, 0xD9, 0x71, 0xAF, 0xFF, 0xE9, 0x73, 0xFF, 0xFD, 0xA7, 0x5F, 0xFF, 0x97, 0x79, 0xFF,
+    0x97, 0x74, 0x99, 0x97, 0x71, 0x73, 0xAA, 0xAA, 0xA7, 0x71, 0xFC, 0x97, 0x70, 0xAF, 0x97, 0x70,
+    0x9F, 0x97, 0x71, 0xF7, 0x72, 0xAD, 0xA5, 0xAF, 0x97, 0x71, 0xFC, 0x70, 0x9A, 0xA9, 0x49, 0xFA,
+    0x59, 0xFF, 0x2F, 0xC5, 0xAF, 0xFD, 0x9A, 0xF9, 0x4A, 0xFF, 0xFF, 0xA4, 0x9F, 0xDA, 0xAF, 0xF9,
+    0x5F, 0xCA, 0x29, 0xFC, 0x96, 0x9F, 0xC4, 0xFC, 0x7F, 0xC9, 0x4F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F,
+    0xA5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xAF, 0x94, 0xFC, 0x96, 0x9F, 0xA3,
+    0x9F, 0xC7, 0x9F, 0xC2, 0x9F, 0xCA, 0x70, 0xFD, 0xAF, 0xE7, 0x19, 0xFF, 0xF7, 0x3A, 0xFF, 0xD7,
+    0x59, 0xFE, 0x97, 0x71, 0x99, 0x97, 0x60, 0x70, 0xAA, 0xAA, 0xA7, 0x76, 0xFC, 0x97, 0x76, 0xFA,
+    0x77, 0x69, 0xF7, 0x77, 0x9E, 0x97, 0x77, 0xAD, 0xA7, 0x77, 0x71, 0x99, 0x99, 0x97, 0x76, 0xFC,
+    0x70, 0x9F, 0xE9, 0x39, 0xFA, 0x6A, 0xFF, 0xE9, 0x1A, 0xF9, 0x5F, 0xFF, 0xD9, 0x9F, 0xA5, 0xFF,
+    0xFF, 0xFC, 0x5A, 0xFD, 0x92, 0xAF, 0xFA, 0x59, 0xFC, 0xA5, 0xAF, 0xD9, 0x6F, 0xCA, 0x7F, 0xC7,
+    0x9F, 0xC7, 0x0F, 0xC7, 0xFC, 0x97, 0x0F, 0xC9, 0x6F, 0xC7, 0x1F, 0xC9, 0x59, 0xFA, 0x71, 0xFC,
+    0x6A, 0xF9, 0x71, 0xFC, 0x6F, 0xC9, 0x71, 0xFC, 0x6F, 0xC7, 0x19, 0xFC, 0x6F, 0xC7, 0x1A, 0xFA,
+    0x6F, 0xC7, 0x1F, 0xC7, 0xFC, 0x70, 0xAF, 0xC7, 0xFC, 0x97, 0xFC, 0x97, 0xAF, 0xC6, 0xFD, 0x71,
+    0xFD, 0x39, 0xFD, 0x97, 0x1A, 0xFF, 0xFE, 0x97, 0x3F, 0xFF, 0xDA, 0x75, 0xFF, 0xF9, 0x77, 0x9F,
+    0xF9, 0x77, 0x49, 0x99, 0x77, 0x10, 0x59, 0xAA, 0xAA, 0x97, 0x72, 0xFC, 0x77, 0x2A, 0xF7, 0x73,
+    0xAE, 0xA7, 0x73, 0xF7, 0x74, 0xAD, 0x93, 0xAF, 0x97, 0x71, 0xFC, 0x70, 0x9A, 0xA9, 0x49, 0xFA,
+    0x59, 0xFF, 0x2F, 0xC5, 0xAF, 0xFD, 0x9A, 0xF9, 0x4A, 0xFF, 0xFF, 0xA4, 0x9F, 0xDA, 0xAF, 0xF9,
+    0x5F, 0xCA, 0x29, 0xFC, 0x96, 0x9F, 0xC4, 0xFC, 0x7F, 0xC9, 0x4F, 0xC7, 0xFC, 0x5F, 0xC6, 0x9F,
+    0xA5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xAF, 0x94, 0xFC, 0x96, 0x9F, 0xA3,
+    0x9F, 0xC7, 0x9F, 0xC2, 0x9F, 0xCA, 0x70, 0xFD, 0xAF, 0xE7, 0x19, 0xFF, 0xF7, 0x3A, 0xFF, 0xD7,
+    0x59, 0xFE, 0x97, 0x71, 0x99, 0x97, 0x60, 0x77, 0x77, 0x6F, 0xCA, 0x77, 0x5F, 0xE7, 0x74, 0xCA,
+    0xAF, 0x77, 0x7A, 0xE7, 0x77, 0xEA, 0x77, 0x5F, 0xC7, 0x75, 0x9E, 0x97, 0x77, 0xAA, 0x96, 0x99,
+    0x99, 0x97, 0x76, 0xFC, 0x70, 0x9F, 0xE9, 0x39, 0xFA, 0x6A, 0xFF, 0xE9, 0x1A, 0xF9, 0x5F, 0xFF,
+    0xD9, 0x9F, 0xA5, 0xFF, 0xFF, 0xFC, 0x5A, 0xFD, 0x92, 0xAF, 0xFA, 0x59, 0xFC, 0xA5, 0xAF, 0xD9,
+    0x6F, 0xCA, 0x7F, 0xC7, 0x9F, 0xC7, 0x0F, 0xC7, 0xFC, 0x97, 0x0F, 0xC9, 0x6F, 0xC7, 0x1F, 0xC9,
+    0x59, 0xFA, 0x71, 0xFC, 0x6A, 0xF9, 0x71, 0xFC, 0x6F, 0xC9, 0x71, 0xFC, 0x6F, 0xC7, 0x19, 0xFC,
+    0x6F, 0xC7, 0x1A, 0xFA, 0x6F, 0xC7, 0x1F, 0xC7, 0xFC, 0x70, 0xAF, 0xC7, 0xFC, 0x97, 0xFC, 0x97,
+    0xAF, 0xC6, 0xFD, 0x71, 0xFD, 0x39, 0xFD, 0x97, 0x1A, 0xFF, 0xFE, 0x97, 0x3F, 0xFF, 0xDA, 0x75,
+    0xFF, 0xF9, 0x77, 0x9F, 0xF9, 0x77, 0x49, 0x99, 0x77, 0x10, 0x79, 0xAA, 0xAA, 0x77, 0x2F, 0xDA,
+    0x77, 0x0F, 0xE7, 0x70, 0x91, 0xAE, 0x97, 0x72, 0xAE, 0x77, 0x19, 0xAE, 0xA7, 0x71, 0xF9, 0x77,
+    0x2E, 0x5A, 0xF9, 0x77, 0x1F, 0xC7, 0x09, 0xAA, 0x94, 0x9F, 0xA5, 0x9F, 0xF2, 0xFC, 0x5A, 0xFF,
+    0xD9, 0xAF, 0x94, 0xAF, 0xFF, 0xFA, 0x49, 0xFD, 0xAA, 0xFF, 0x95, 0xFC, 0xA2, 0x9F, 0xC9, 0x69,
+    0xFC, 0x4F, 0xC7, 0xFC, 0x94, 0xFC, 0x7F, 0xC5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC,
+    0x6A, 0xF9, 0x49, 0xFA, 0x6A, 0xF9, 0x4F, 0xC9, 0x69, 0xFA, 0x39, 0xFC, 0x79, 0xFC, 0x29, 0xFC,
+    0xA7, 0x0F, 0xDA, 0xFE, 0x71, 0x9F, 0xFF, 0x73, 0xAF, 0xFD, 0x75, 0x9F, 0xE9, 0x77, 0x19, 0x99,
+    0x76, 0x77, 0x19, 0x97, 0x79, 0xF9, 0x2A, 0xD7, 0x7F, 0xEA, 0xAD, 0xA7, 0x6F, 0xFF, 0x97, 0x6E,
+    0x09, 0xAF, 0xCA, 0x76, 0x9D, 0x4A, 0xCA, 0x97, 0x77, 0x79, 0x99, 0x99, 0x77, 0x6F, 0xC7, 0x09,
+    0xFE, 0x93, 0x9F, 0xA6, 0xAF, 0xFE, 0x91, 0xAF, 0x95, 0xFF, 0xFD, 0x99, 0xFA, 0x5F, 0xFF, 0xFF,
+    0xC5, 0xAF, 0xD9, 0x2A, 0xFF, 0xA5, 0x9F, 0xCA, 0x5A, 0xFD, 0x96, 0xFC, 0xA7, 0xFC, 0x79, 0xFC,
+    0x70, 0xFC, 0x7F, 0xC9, 0x70, 0xFC, 0x96, 0xFC, 0x71, 0xFC, 0x95, 0x9F, 0xA7, 0x1F, 0xC6, 0xAF,
+    0x97, 0x1F, 0xC6, 0xFC, 0x97, 0x1F, 0xC6, 0xFC, 0x71, 0x9F, 0xC6, 0xFC, 0x71, 0xAF, 0xA6, 0xFC,
+    0x71, 0xFC, 0x7F, 0xC7, 0x0A, 0xFC, 0x7F, 0xC9, 0x7F, 0xC9, 0x7A, 0xFC, 0x6F, 0xD7, 0x1F, 0xD3,
+    0x9F, 0xD9, 0x71, 0xAF, 0xFF, 0xE9, 0x73, 0xFF, 0xFD, 0xA7, 0x5F, 0xFF, 0x97, 0x79, 0xFF, 0x97,
+    0x74, 0x99, 0x97, 0x71, 0x77, 0x99, 0x73, 0x9F, 0x92, 0xAD, 0x73, 0xFE, 0xAE, 0xA7, 0x2F, 0xFF,
+    0x73, 0xDA, 0x09, 0xAF, 0xCA, 0x72, 0x9D, 0x4A, 0xCA, 0x91, 0xAF, 0x97, 0x71, 0xFC, 0x70, 0x9A,
+    0xA9, 0x49, 0xFA, 0x59, 0xFF, 0x2F, 0xC5, 0xAF, 0xFD, 0x9A, 0xF9, 0x4A, 0xFF, 0xFF, 0xA4, 0x9F,
+    0xDA, 0xAF, 0xF9, 0x5F, 0xCA, 0x29, 0xFC, 0x96, 0x9F, 0xC4, 0xFC, 0x7F, 0xC9, 0x4F, 0xC7, 0xFC,
+    0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0xAF, 0x94, 0x9F, 0xA6, 0xAF, 0x94, 0xFC,
+    0x96, 0x9F, 0xA3, 0x9F, 0xC7, 0x9F, 0xC2, 0x9F, 0xCA, 0x70, 0xFD, 0xAF, 0xE7, 0x19, 0xFF, 0xF7,
+    0x3A, 0xFF, 0xD7, 0x59, 0xFE, 0x97, 0x71, 0x99, 0x97, 0x60, 0x77, 0x59, 0x99, 0x99, 0x77, 0x6F,
+    0xC7, 0x09, 0xFE, 0x93, 0x9F, 0xA6, 0xAF, 0xFE, 0x91, 0xAF, 0x95, 0xFF, 0xFD, 0x99, 0xFA, 0x5F,
+    0xFF, 0xFF, 0xC5, 0xAF, 0xD9, 0x2A, 0xFF, 0xA5, 0x9F, 0xCA, 0x5A, 0xFD, 0x96, 0xFC, 0xA7, 0xFC,
+    0x79, 0xFC, 0x70, 0xFC, 0x7F, 0xC9, 0x70, 0xFC, 0x96, 0xFC, 0x71, 0xFC, 0x95, 0x9F, 0xA7, 0x1F,
+    0xC6, 0xAF, 0x97, 0x1F, 0xC6, 0xFC, 0x97, 0x1F, 0xC6, 0xFC, 0x71, 0x9F, 0xC6, 0xFC, 0x71, 0xAF,
+    0xA6, 0xFC, 0x71, 0xFC, 0x7F, 0xC7, 0x0A, 0xFC, 0x7F, 0xC9, 0x7F, 0xC9, 0x7A, 0xFC, 0x6F, 0xD7,
+    0x1F, 0xD3, 0x9F, 0xD9, 0x71, 0xAF, 0xFF, 0xE9, 0x73, 0xFF, 0xFD, 0xA7, 0x5F, 0xFF, 0x97, 0x79,
+    0xFF, 0x97, 0x74, 0x99, 0x97, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x76, 0x9F, 0xA7, 0x75, 0xAF, 0xA7,
+    0x75, 0xAF, 0x97, 0x76, 0xEA, 0x77, 0x77, 0x75, 0x77, 0x1A, 0xF9, 0x77, 0x1F, 0xC7, 0x09, 0xAA,
+    0x94, 0x9F, 0xA5, 0x9F, 0xF2, 0xFC, 0x5A, 0xFF, 0xD9, 0xAF, 0x94, 0xAF, 0xFF, 0xFA, 0x49, 0xFD,
+    0xAA, 0xFF, 0x95, 0xFC, 0xA2, 0x9F, 0xC9, 0x69, 0xFC, 0x4F, 0xC7, 0xFC, 0x94, 0xFC, 0x7F, 0xC5,
+    0xFC, 0x69, 0xFA, 0x5F, 0xC6, 0x9F, 0xA5, 0xFC, 0x6A, 0xF9, 0x49, 0xFA, 0x6A, 0xF9, 0x4F, 0xC9,
+    0x69, 0xFA, 0x39, 0xFC, 0x79, 0xFC, 0x29, 0xFC, 0xA7, 0x0F, 0xDA, 0xFE, 0x71, 0x9F, 0xFF, 0x73,
+    0xAF, 0xFD, 0x75, 0x9F, 0xE9, 0x77, 0x19, 0x99, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x72, 0x9F, 0xA7,
+    0x71, 0xAF, 0xA7, 0x71, 0xAF, 0x97, 0x72, 0xEA, 0x77, 0x77, 0x60, 0x29, 0xFA, 0x6A, 0xF3, 0xAF,
+    0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0x92, 0x9F, 0xA6, 0xFC,
+    0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F, 0xC6, 0x9F, 0xA2, 0x9F, 0xC6, 0xAF, 0x92, 0xAF,
+    0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0xA2, 0x9F, 0xA6, 0xFC,
+    0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC, 0x3A, 0xF9, 0x5A, 0xFA, 0x3A, 0xFA, 0x49, 0xFC,
+    0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF, 0xE9, 0x71, 0x9F,
+    0xFA, 0x77, 0x99, 0x97, 0x77, 0x76, 0xAD, 0xA7, 0x70, 0xAF, 0x97, 0x7F, 0xC9, 0x77, 0xFC, 0x77,
+    0x09, 0xE9, 0x77, 0x77, 0x20, 0x77, 0x5F, 0xC4, 0x9F, 0x92, 0xFC, 0x4A, 0xF2, 0x9F, 0xA4, 0xFC,
+    0x2A, 0xF9, 0x4F, 0xC2, 0xAF, 0x49, 0xFA, 0x2F, 0xC4, 0xAF, 0x92, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4,
+    0xFC, 0x2A, 0xF9, 0x4F, 0xA2, 0xFC, 0x4A, 0xFA, 0x2F, 0xC4, 0xFC, 0x92, 0xFA, 0x39, 0xFC, 0x3F,
+    0xA3, 0xFD, 0x3F, 0xC2, 0xAF, 0xCA, 0x3F, 0xDA, 0xFE, 0x93, 0xFF, 0xC9, 0xF4, 0x9F, 0xEA, 0x0F,
+    0x59, 0xFC, 0x91, 0xF7, 0x99, 0x77, 0x77, 0x39, 0xDA, 0x75, 0x9F, 0xA7, 0x4A, 0xFA, 0x74, 0xAF,
+    0x97, 0x5E, 0xA7, 0x77, 0x50, 0x77, 0x77, 0x9F, 0xC9, 0x76, 0x9F, 0xD9, 0x75, 0x9A, 0xAF, 0xA7,
+    0x71, 0xEA, 0x77, 0x0A, 0xE7, 0x7A, 0xF9, 0x77, 0xEA, 0x77, 0x1A, 0xAA, 0x77, 0x77, 0x09, 0xFA,
+    0x6A, 0xF3, 0xAF, 0x96, 0xFC, 0x3F, 0xC9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0x92,
+    0x9F, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFC, 0x3F, 0xC6, 0x9F, 0xA2, 0x9F, 0xC6,
+    0xAF, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x6F, 0xC3, 0xFC, 0x69, 0xFA, 0x3F, 0xC6, 0xAF, 0xA2,
+    0x9F, 0xA6, 0xFC, 0x92, 0xAF, 0xA6, 0xFC, 0x3A, 0xF9, 0x59, 0xFC, 0x3A, 0xF9, 0x5A, 0xFA, 0x3A,
+    0xFA, 0x49, 0xFC, 0x49, 0xFC, 0x92, 0x9F, 0xCA, 0x5F, 0xFF, 0xE6, 0xAF, 0xFF, 0xC9, 0x7A, 0xFF,
+    0xE9, 0x71, 0x9F, 0xFA, 0x77, 0x99, 0x97, 0x30, 0x70, 0x9A, 0xAA, 0x97, 0x5F, 0xD9, 0x73, 0xFE,
+    0x73, 0x91, 0xF7, 0x6F, 0x74, 0x9F, 0x74, 0x9E, 0xA7, 0x59, 0xDA, 0x77, 0x77, 0x76, 0xFC, 0x49,
+    0xF9, 0x2F, 0xC4, 0xAF, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFC, 0x2A, 0xF4, 0x9F, 0xA2, 0xFC,
+    0x4A, 0xF9, 0x2F, 0xC4, 0xFC, 0x29, 0xFA, 0x4F, 0xC2, 0xAF, 0x94, 0xFA, 0x2F, 0xC4, 0xAF, 0xA2,
+    0xFC, 0x4F, 0xC9, 0x2F, 0xA3, 0x9F, 0xC3, 0xFA, 0x3F, 0xD3, 0xFC, 0x2A, 0xFC, 0xA3, 0xFD, 0xAF,
+    0xE9, 0x3F, 0xFC, 0x9F, 0x49, 0xFE, 0xA0, 0xF5, 0x9F, 0xC9, 0x1F, 0x79, 0x97, 0x40, 0x74, 0x9A,
+    0xAA, 0xAA, 0x77, 0x6F, 0xC9, 0x77, 0x5A, 0xF9, 0x77, 0x59, 0xF9, 0x77, 0x6F, 0x77, 0x7A, 0xDA,
+    0x77, 0x77, 0x69, 0x99, 0x97, 0x77, 0xAF, 0xA2, 0x9F, 0x96, 0xAF, 0x1F, 0xC3, 0xAF, 0x96, 0xFC,
+    0x1F, 0xA3, 0xFC, 0x7F, 0xC0, 0xFC, 0x4F, 0xC6, 0x9F, 0xFD, 0x94, 0xFC, 0x6A, 0xFF, 0xC9, 0x49,
+    0xFA, 0x6F, 0xF9, 0x6A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFC, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F,
+    0xA6, 0xAF, 0x97, 0x19, 0xFA, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFA, 0x72, 0xFC,
+    0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x1A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2A,
+    0xF9, 0x5A, 0xFA, 0x72, 0xAF, 0xA5, 0xFC, 0x73, 0x9F, 0xC9, 0x29, 0xFC, 0xA7, 0x4F, 0xFF, 0xE7,
+    0x5A, 0xFF, 0xFC, 0x77, 0xAF, 0xFE, 0x77, 0x19, 0xFF, 0x97, 0x75, 0x99, 0x97, 0x73, 0x73, 0xAA,
+    0xAA, 0xA9, 0x77, 0x3A, 0xFC, 0x77, 0x39, 0xFA, 0x77, 0x4F, 0xA7, 0x74, 0xFA, 0x77, 0x49, 0xE9,
+    0x7F, 0xC7, 0x75, 0xFC, 0x77, 0x4A, 0xF9, 0x3F, 0xC4, 0x9F, 0x90, 0xFC, 0x4F, 0xC4, 0xAF, 0xAF,
+    0xC4, 0x9F, 0xA4, 0xFF, 0xD5, 0xAF, 0x94, 0xFF, 0xA6, 0xAF, 0x49, 0xFC, 0xA9, 0x70, 0xFC, 0x4A,
+    0xF9, 0x72, 0xFC, 0x4F, 0xC7, 0x29, 0xFA, 0x4F, 0xC7, 0x2A, 0xF9, 0x4F, 0xA7, 0x2F, 0xC4, 0xAF,
+    0xA7, 0x2F, 0xC4, 0xFC, 0x97, 0x2F, 0xA3, 0x9F, 0xC7, 0x3F, 0xA3, 0xFD, 0x72, 0x9F, 0xC2, 0xAF,
+    0xCA, 0x73, 0xFD, 0xAF, 0xE9, 0x73, 0xFF, 0xCA, 0xF7, 0x49, 0xFE, 0xA0, 0xF7, 0x59, 0xFC, 0x91,
+    0xF7, 0x79, 0x97, 0x74, 0x70, 0xAA, 0xAA, 0x97, 0x77, 0xFC, 0x77, 0x79, 0xF9, 0x77, 0x7A, 0xF7,
+    0x77, 0x0A, 0xE7, 0x77, 0x1A, 0xD9, 0x77, 0x77, 0x49, 0x99, 0x97, 0x77, 0xAF, 0xA2, 0x9F, 0x96,
+    0xAF, 0x1F, 0xC3, 0xAF, 0x96, 0xFC, 0x1F, 0xA3, 0xFC, 0x7F, 0xC0, 0xFC, 0x4F, 0xC6, 0x9F, 0xFD,
+    0x94, 0xFC, 0x6A, 0xFF, 0xC9, 0x49, 0xFA, 0x6F, 0xF9, 0x6A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFC,
+    0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x19, 0xFA, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F,
+    0xC7, 0x2F, 0xC7, 0xFA, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x1A, 0xF9, 0x6F,
+    0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x5A, 0xFA, 0x72, 0xAF, 0xA5, 0xFC, 0x73, 0x9F, 0xC9,
+    0x29, 0xFC, 0xA7, 0x4F, 0xFF, 0xE7, 0x5A, 0xFF, 0xFC, 0x77, 0xAF, 0xFE, 0x77, 0x19, 0xFF, 0x97,
+    0x75, 0x99, 0x97, 0x73, 0x6A, 0xAA, 0xAA, 0x77, 0x5A, 0xF9, 0x77, 0x5F, 0xC7, 0x76, 0xF7, 0x76,
+    0x9E, 0xA7, 0x76, 0x9E, 0x6F, 0xC7, 0x75, 0xFC, 0x77, 0x4A, 0xF9, 0x3F, 0xC4, 0x9F, 0x90, 0xFC,
+    0x4F, 0xC4, 0xAF, 0xAF, 0xC4, 0x9F, 0xA4, 0xFF, 0xD5, 0xAF, 0x94, 0xFF, 0xA6, 0xAF, 0x49, 0xFC,
+    0xA9, 0x70, 0xFC, 0x4A, 0xF9, 0x72, 0xFC, 0x4F, 0xC7, 0x29, 0xFA, 0x4F, 0xC7, 0x2A, 0xF9, 0x4F,
+    0xA7, 0x2F, 0xC4, 0xAF, 0xA7, 0x2F, 0xC4, 0xFC, 0x97, 0x2F, 0xA3, 0x9F, 0xC7, 0x3F, 0xA3, 0xFD,
+    0x72, 0x9F, 0xC2, 0xAF, 0xCA, 0x73, 0xFD, 0xAF, 0xE9, 0x73, 0xFF, 0xCA, 0xF7, 0x49, 0xFE, 0xA0,
+    0xF7, 0x59, 0xFC, 0x91, 0xF7, 0x79, 0x97, 0x74, 0x77, 0x77, 0x69, 0xFC, 0x97, 0x75, 0x9F, 0xD9,
+    0x77, 0x49, 0xAA, 0xFA, 0x77, 0x70, 0xEA, 0x77, 0x7A, 0xE7, 0x76, 0xAF, 0x97, 0x76, 0xEA, 0x77,
+    0x70, 0xAA, 0xA7, 0x19, 0x99, 0x97, 0x77, 0xAF, 0xA2, 0x9F, 0x96, 0xAF, 0x1F, 0xC3, 0xAF, 0x96,
+    0xFC, 0x1F, 0xA3, 0xFC, 0x7F, 0xC0, 0xFC, 0x4F, 0xC6, 0x9F, 0xFD, 0x94, 0xFC, 0x6A, 0xFF, 0xC9,
+    0x49, 0xFA, 0x6F, 0xF9, 0x6A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFC, 0x72, 0xFC, 0x69, 0xFA, 0x71,
+    0x9F, 0xA6, 0xAF, 0x97, 0x19, 0xFA, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7, 0xFA, 0x72,
+    0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x1A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7,
+    0x2A, 0xF9, 0x5A, 0xFA, 0x72, 0xAF, 0xA5, 0xFC, 0x73, 0x9F, 0xC9, 0x29, 0xFC, 0xA7, 0x4F, 0xFF,
+    0xE7, 0x5A, 0xFF, 0xFC, 0x77, 0xAF, 0xFE, 0x77, 0x19, 0xFF, 0x97, 0x75, 0x99, 0x97, 0x73, 0x70,
+    0x9A, 0xAA, 0x97, 0x75, 0xFD, 0x97, 0x73, 0xFE, 0x77, 0x39, 0x1F, 0x77, 0x6F, 0x77, 0x49, 0xF7,
+    0x74, 0x9E, 0xA7, 0x75, 0x9D, 0xA7, 0xFC, 0x77, 0x5F, 0xC7, 0x74, 0xAF, 0x93, 0xFC, 0x49, 0xF9,
+    0x0F, 0xC4, 0xFC, 0x4A, 0xFA, 0xFC, 0x49, 0xFA, 0x4F, 0xFD, 0x5A, 0xF9, 0x4F, 0xFA, 0x6A, 0xF4,
+    0x9F, 0xCA, 0x97, 0x0F, 0xC4, 0xAF, 0x97, 0x2F, 0xC4, 0xFC, 0x72, 0x9F, 0xA4, 0xFC, 0x72, 0xAF,
+    0x94, 0xFA, 0x72, 0xFC, 0x4A, 0xFA, 0x72, 0xFC, 0x4F, 0xC9, 0x72, 0xFA, 0x39, 0xFC, 0x73, 0xFA,
+    0x3F, 0xD7, 0x29, 0xFC, 0x2A, 0xFC, 0xA7, 0x3F, 0xDA, 0xFE, 0x97, 0x3F, 0xFC, 0xAF, 0x74, 0x9F,
+    0xEA, 0x0F, 0x75, 0x9F, 0xC9, 0x1F, 0x77, 0x99, 0x77, 0x40, 0x77, 0x19, 0x97, 0x70, 0x9F, 0x92,
+    0xE7, 0x79, 0xFE, 0xAE, 0xA7, 0x7F, 0xFF, 0x77, 0x9D, 0xA0, 0x9F, 0xD9, 0x77, 0x9D, 0x39, 0xAC,
+    0xA7, 0x77, 0x73, 0x99, 0x99, 0x77, 0x7A, 0xFA, 0x29, 0xF9, 0x6A, 0xF1, 0xFC, 0x3A, 0xF9, 0x6F,
+    0xC1, 0xFA, 0x3F, 0xC7, 0xFC, 0x0F, 0xC4, 0xFC, 0x69, 0xFF, 0xD9, 0x4F, 0xC6, 0xAF, 0xFC, 0x94,
+    0x9F, 0xA6, 0xFF, 0x96, 0xAF, 0x96, 0xFC, 0x72, 0xFC, 0x7F, 0xC7, 0x2F, 0xC6, 0x9F, 0xA7, 0x19,
+    0xFA, 0x6A, 0xF9, 0x71, 0x9F, 0xA6, 0xFC, 0x72, 0xAF, 0x96, 0xFC, 0x72, 0xFC, 0x7F, 0xA7, 0x2F,
+    0xC6, 0x9F, 0xA7, 0x19, 0xFA, 0x6A, 0xF9, 0x71, 0xAF, 0x96, 0xFC, 0x72, 0xAF, 0x96, 0xFC, 0x72,
+    0xAF, 0x95, 0xAF, 0xA7, 0x2A, 0xFA, 0x5F, 0xC7, 0x39, 0xFC, 0x92, 0x9F, 0xCA, 0x74, 0xFF, 0xFE,
+    0x75, 0xAF, 0xFF, 0xC7, 0x7A, 0xFF, 0xE7, 0x71, 0x9F, 0xF9, 0x77, 0x59, 0x99, 0x77, 0x30, 0x77,
+    0x99, 0x77, 0xFA, 0x2A, 0xD7, 0x6F, 0xEA, 0xAE, 0x75, 0xAF, 0xFE, 0x97, 0x5E, 0x1A, 0xFC, 0xA7,
+    0x6D, 0x93, 0xAC, 0xA9, 0x4F, 0xC7, 0x75, 0xFC, 0x77, 0x4A, 0xF9, 0x3F, 0xC4, 0x9F, 0x90, 0xFC,
+    0x4F, 0xC4, 0xAF, 0xAF, 0xC4, 0x9F, 0xA4, 0xFF, 0xD5, 0xAF, 0x94, 0xFF, 0xA6, 0xAF, 0x49, 0xFC,
+    0xA9, 0x70, 0xFC, 0x4A, 0xF9, 0x72, 0xFC, 0x4F, 0xC7, 0x29, 0xFA, 0x4F, 0xC7, 0x2A, 0xF9, 0x4F,
+    0xA7, 0x2F, 0xC4, 0xAF, 0xA7, 0x2F, 0xC4, 0xFC, 0x97, 0x2F, 0xA3, 0x9F, 0xC7, 0x3F, 0xA3, 0xFD,
+    0x72, 0x9F, 0xC2, 0xAF, 0xCA, 0x73, 0xFD, 0xAF, 0xE9, 0x73, 0xFF, 0xCA, 0xF7, 0x49, 0xFE, 0xA0,
+    0xF7, 0x59, 0xFC, 0x91, 0xF7, 0x79, 0x97, 0x74, 0x77, 0x79, 0x99, 0x97, 0x77, 0xAF, 0xA2, 0x9F,
+    0x96, 0xAF, 0x1F, 0xC3, 0xAF, 0x96, 0xFC, 0x1F, 0xA3, 0xFC, 0x7F, 0xC0, 0xFC, 0x4F, 0xC6, 0x9F,
+    0xFD, 0x94, 0xFC, 0x6A, 0xFF, 0xC9, 0x49, 0xFA, 0x6F, 0xF9, 0x6A, 0xF9, 0x6F, 0xC7, 0x2F, 0xC7,
+    0xFC, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x19, 0xFA, 0x6F, 0xC7, 0x2A, 0xF9,
+    0x6F, 0xC7, 0x2F, 0xC7, 0xFA, 0x72, 0xFC, 0x69, 0xFA, 0x71, 0x9F, 0xA6, 0xAF, 0x97, 0x1A, 0xF9,
+    0x6F, 0xC7, 0x2A, 0xF9, 0x6F, 0xC7, 0x2A, 0xF9, 0x5A, 0xFA, 0x72, 0xAF, 0xA5, 0xFC, 0x73, 0x9F,
+    0xC9, 0x29, 0xFC, 0xA7, 0x4F, 0xFF, 0xE7, 0x5A, 0xFF, 0xFC, 0x77, 0xAF, 0xFE, 0x77, 0x19, 0xFF,
+    0x97, 0x75, 0x99, 0x97, 0x77, 0x77, 0x75, 0x9D, 0xA7, 0x77, 0x9F, 0xA7, 0x76, 0xAF, 0xA7, 0x76,
+    0xAF, 0x97, 0x77, 0xEA, 0x77, 0x77, 0x77, 0x00, 0x77, 0x4F, 0xC7, 0x75, 0xFC, 0x77, 0x4A, 0xF9,
+    0x3F, 0xC4, 0x9F, 0x90, 0xFC, 0x4F, 0xC4, 0xAF, 0xAF, 0xC4, 0x9F, 0xA4, 0xFF, 0xD5, 0xAF, 0x94,
+    0xFF, 0xA6, 0xAF, 0x49, 0xFC, 0xA9, 0x70, 0xFC, 0x4A, 0xF9, 0x72, 0xFC, 0x4F, 0xC7, 0x29, 0xFA,
+    0x4F, 0xC7, 0x2A, 0xF9, 0x4F, 0xA7, 0x2F, 0xC4, 0xAF, 0xA7, 0x2F, 0xC4, 0xFC, 0x97, 0x2F, 0xA3,
+    0x9F, 0xC7, 0x3F, 0xA3, 0xFD, 0x72, 0x9F, 0xC2, 0xAF, 0xCA, 0x73, 0xFD, 0xAF, 0xE9, 0x73, 0xFF,
+    0xCA, 0xF7, 0x49, 0xFE, 0xA0, 0xF7, 0x59, 0xFC, 0x91, 0xF7, 0x79, 0x97, 0x77, 0x77, 0x74, 0xAD,
+    0x97, 0x75, 0xFC, 0x97, 0x74, 0xFC, 0x97, 0x74, 0xFC, 0x77, 0x59, 0xE9, 0x77, 0x77, 0x74, 0x49,
+    0xAA, 0xAA, 0x97, 0x5F, 0xC7, 0x59, 0xF7, 0x6A, 0xEA, 0x76, 0xF7, 0x7A, 0xD9, 0x77, 0x77, 0x73,
+    0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF, 0xC0, 0x9F, 0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3,
+    0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49, 0xF9, 0x1A, 0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7,
+    0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49,
+    0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A,
+    0xF7, 0x5F, 0xC7, 0x30, 0x70, 0x9A, 0xAA, 0xA7, 0x71, 0x9F, 0xA7, 0x71, 0xAF, 0x77, 0x2F, 0x97,
+    0x72, 0xF7, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x1F, 0xA5, 0xAF, 0xA5, 0xFA, 0x5F, 0xC6, 0xFC, 0x4A,
+    0xFA, 0x6F, 0xC4, 0xFC, 0x7A, 0xF3, 0xAF, 0xA7, 0x9F, 0x3F, 0xC7, 0x09, 0xF2, 0xAF, 0x97, 0x1F,
+    0x91, 0xFC, 0x72, 0xF9, 0x0A, 0xF9, 0x72, 0xF9, 0x0F, 0xC7, 0x3F, 0xA9, 0xF9, 0x73, 0xAE, 0xAA,
+    0xF7, 0x49, 0xEA, 0xF9, 0x74, 0x9F, 0xEA, 0x76, 0xFE, 0x77, 0xFD, 0xA7, 0x7F, 0xD7, 0x70, 0xAF,
+    0xA7, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0x9F, 0xC7, 0x79, 0xFC, 0x97, 0x39, 0xFF, 0xA7, 0x49,
+    0xFF, 0x75, 0x9F, 0xDA, 0x77, 0xFA, 0x77, 0x00, 0xAF, 0x7A, 0xF9, 0xAF, 0x95, 0xAF, 0xC0, 0x9F,
+    0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3, 0x9F, 0xC3, 0xAF, 0x92, 0xFC, 0x49, 0xF9, 0x1A,
+    0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7, 0xAF, 0xAF, 0x97, 0x9F, 0xFC, 0x71, 0xFF, 0x72,
+    0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49, 0xFA, 0x74, 0x9F, 0x97, 0x4A, 0xF7, 0x5F, 0xC7,
+    0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x77, 0x77, 0x73, 0xAD, 0x97,
+    0x5F, 0xC7, 0x5F, 0xC7, 0x5F, 0xC7, 0x5A, 0xE9, 0x77, 0x77, 0x77, 0x73, 0xFA, 0x5A, 0xFA, 0x5F,
+    0xA5, 0xFC, 0x6F, 0xC4, 0xAF, 0xA6, 0xFC, 0x4F, 0xC7, 0xAF, 0x3A, 0xFA, 0x79, 0xF3, 0xFC, 0x70,
+    0x9F, 0x2A, 0xF9, 0x71, 0xF9, 0x1F, 0xC7, 0x2F, 0x90, 0xAF, 0x97, 0x2F, 0x90, 0xFC, 0x73, 0xFA,
+    0x9F, 0x97, 0x3A, 0xEA, 0xAF, 0x74, 0x9E, 0xAF, 0x97, 0x49, 0xFE, 0xA7, 0x6F, 0xE7, 0x7F, 0xDA,
+    0x77, 0xFD, 0x77, 0x0A, 0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0xA7, 0x79, 0xFC, 0x1A, 0xD9, 0x71,
+    0x9F, 0xC9, 0x0F, 0xC5, 0x9F, 0xFA, 0x1F, 0xC5, 0x9F, 0xF2, 0xFC, 0x59, 0xFD, 0xA3, 0xAE, 0x96,
+    0xFA, 0x77, 0x00, 0x77, 0x70, 0x9F, 0xC9, 0x73, 0x9F, 0xD9, 0x72, 0x9A, 0xAF, 0xA7, 0x6E, 0xA7,
+    0x5A, 0xE9, 0x73, 0x9F, 0x97, 0x4A, 0xDA, 0x76, 0x9A, 0xA7, 0x77, 0x3A, 0xF7, 0xAF, 0x9A, 0xF9,
+    0x5A, 0xFC, 0x09, 0xFA, 0x5F, 0xC9, 0x1F, 0xC4, 0xFC, 0xA2, 0xFC, 0x39, 0xFC, 0x3A, 0xF9, 0x2F,
+    0xC4, 0x9F, 0x91, 0xAF, 0xA5, 0xFA, 0x09, 0xFC, 0x6F, 0xC0, 0xFC, 0x7A, 0xFA, 0xF9, 0x79, 0xFF,
+    0xC7, 0x1F, 0xF7, 0x2F, 0xE9, 0x72, 0xAF, 0xD7, 0x39, 0xFC, 0x74, 0x9F, 0xA7, 0x49, 0xF9, 0x74,
+    0xAF, 0x75, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x74, 0xAF, 0x75, 0xFC, 0x73, 0x72,
+    0x9A, 0xAA, 0x97, 0x71, 0xFD, 0x97, 0x7F, 0xE7, 0x79, 0x1F, 0x77, 0x2F, 0x77, 0x09, 0xF9, 0x77,
+    0x9F, 0x77, 0x19, 0xDA, 0x77, 0x77, 0x77, 0x72, 0xFA, 0x5A, 0xFA, 0x5F, 0xA5, 0xFC, 0x6F, 0xC4,
+    0xAF, 0xA6, 0xFC, 0x4F, 0xC7, 0xAF, 0x3A, 0xFA, 0x79, 0xF3, 0xFC, 0x70, 0x9F, 0x2A, 0xF9, 0x71,
+    0xF9, 0x1F, 0xC7, 0x2F, 0x90, 0xAF, 0x97, 0x2F, 0x90, 0xFC, 0x73, 0xFA, 0x9F, 0x97, 0x3A, 0xEA,
+    0xAF, 0x74, 0x9E, 0xAF, 0x97, 0x49, 0xFE, 0xA7, 0x6F, 0xE7, 0x7F, 0xDA, 0x77, 0xFD, 0x77, 0x0A,
+    0xFA, 0x77, 0x0F, 0xC7, 0x70, 0xAF, 0xA7, 0x79, 0xFC, 0x77, 0x9F, 0xC9, 0x73, 0x9F, 0xFA, 0x74,
+    0x9F, 0xF7, 0x59, 0xFD, 0xA7, 0x7F, 0xA7, 0x70, 0x76, 0x97, 0xAF, 0x92, 0xDA, 0x5A, 0xFE, 0xAE,
+    0x95, 0xFF, 0xF5, 0x9D, 0x90, 0x9F, 0xD6, 0xAC, 0xA3, 0x9A, 0xCA, 0x77, 0x77, 0x72, 0xAF, 0x7A,
+    0xF9, 0xAF, 0x95, 0xAF, 0xC0, 0x9F, 0xA5, 0xFC, 0x91, 0xFC, 0x4F, 0xCA, 0x2F, 0xC3, 0x9F, 0xC3,
+    0xAF, 0x92, 0xFC, 0x49, 0xF9, 0x1A, 0xFA, 0x5F, 0xA0, 0x9F, 0xC6, 0xFC, 0x0F, 0xC7, 0xAF, 0xAF,
+    0x97, 0x9F, 0xFC, 0x71, 0xFF, 0x72, 0xFE, 0x97, 0x2A, 0xFD, 0x73, 0x9F, 0xC7, 0x49, 0xFA, 0x74,
+    0x9F, 0x97, 0x4A, 0xF7, 0x5F, 0xC7, 0x5F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4A, 0xF7, 0x5F,
+    0xC7, 0x30, 0x77, 0x19, 0x97, 0x3A, 0xEA, 0x29, 0xD9, 0x71, 0xFE, 0xAA, 0xE7, 0x19, 0xFF, 0xEA,
+    0x71, 0xAD, 0x90, 0xAF, 0xD7, 0x2D, 0xA3, 0x9C, 0xAA, 0x77, 0x77, 0x77, 0x7F, 0xA5, 0xAF, 0xA5,
+    0xFA, 0x5F, 0xC6, 0xFC, 0x4A, 0xFA, 0x6F, 0xC4, 0xFC, 0x7A, 0xF3, 0xAF, 0xA7, 0x9F, 0x3F, 0xC7,
+    0x09, 0xF2, 0xAF, 0x97, 0x1F, 0x91, 0xFC, 0x72, 0xF9, 0x0A, 0xF9, 0x72, 0xF9, 0x0F, 0xC7, 0x3F,
+    0xA9, 0xF9, 0x73, 0xAE, 0xAA, 0xF7, 0x49, 0xEA, 0xF9, 0x74, 0x9F, 0xEA, 0x76, 0xFE, 0x77, 0xFD,
+    0xA7, 0x7F, 0xD7, 0x70, 0xAF, 0xA7, 0x70, 0xFC, 0x77, 0x0A, 0xFA, 0x77, 0x9F, 0xC7, 0x79, 0xFC,
+    0x97, 0x39, 0xFF, 0xA7, 0x49, 0xFF, 0x75, 0x9F, 0xDA, 0x77, 0xFA, 0x77, 0x00, 0x3C, 0x7D, 0x7D,
+    0x1A, 0xFE, 0x0A, 0xC2, 0xD1, 0xAA, 0x1A, 0xC2, 0xAA, 0x1C, 0x3A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x3C, 0x6C, 0xA5, 0xD5, 0xFE, 0xA1,
+    0xCA, 0x2C, 0xA2, 0xCA, 0x1A, 0xA3, 0xC1, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0x0A, 0xFF, 0x0F, 0xFA, 0x0F, 0xF9, 0x9F, 0xF9,
+    0x71, 0x0A, 0xFF, 0x0F, 0xFA, 0x0F, 0xF9, 0x9F, 0xF9, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xFF, 0xFE, 0xA9, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x00, 0x0A, 0xFF, 0xFC, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xCA, 0x00,
+    0x0A, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xCA, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xCA, 0x00, 0x74, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA,
+    0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39,
+    0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9,
+    0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA,
+    0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39,
+    0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9,
+    0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xEA, 0x39, 0xE9, 0xAA, 0xA9, 0x4A, 0xAA, 0x00, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xC1, 0x9F, 0xFF, 0xC7, 0x77, 0x71, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x4E, 0xA3,
+    0xAE, 0x92, 0x9F, 0x3F, 0xA2, 0x9F, 0x3F, 0xC2, 0x9F, 0x92, 0xFC, 0x39, 0x99, 0x99, 0x20, 0x3F,
+    0x92, 0xAF, 0x92, 0xFC, 0x29, 0xF9, 0x2A, 0xEA, 0x3F, 0x3A, 0xEA, 0x3F, 0x49, 0x99, 0x40, 0x2A,
+    0xF3, 0xFC, 0x29, 0xF9, 0x2F, 0xC3, 0xF9, 0x2A, 0xEA, 0x3F, 0x39, 0xEA, 0x49, 0x99, 0x40, 0x9F,
+    0x09, 0xF1, 0xF1, 0xF1, 0xF1, 0xAE, 0x1A, 0xE1, 0x9E, 0x29, 0x99, 0x00, 0x4E, 0x92, 0xAD, 0xA4,
+    0xAE, 0x29, 0xEA, 0x39, 0xF2, 0xF4, 0xF9, 0x1A, 0xEA, 0x39, 0xF2, 0xF9, 0x3F, 0xA1, 0xAF, 0x39,
+    0xF9, 0x1F, 0xA3, 0xFC, 0x1A, 0xF4, 0x99, 0x99, 0x91, 0x99, 0x99, 0x93, 0x3F, 0x91, 0xFA, 0x2A,
+    0xF1, 0x9F, 0xA2, 0xFC, 0x1A, 0xF2, 0x9F, 0x2F, 0xA2, 0xAE, 0xA1, 0x9F, 0x3F, 0x2F, 0x92, 0xAE,
+    0xA2, 0xF3, 0xF2, 0xAE, 0x49, 0x99, 0x39, 0x99, 0x93, 0x2A, 0xF1, 0x9F, 0x92, 0xFC, 0x1A, 0xF2,
+    0x9F, 0x91, 0xFA, 0x2F, 0xC1, 0x9F, 0x3F, 0x2F, 0xA2, 0xAE, 0xA2, 0xF3, 0xF2, 0xAE, 0x92, 0x9E,
+    0xA2, 0xF4, 0x99, 0x93, 0x99, 0x94, 0x9F, 0x19, 0xF0, 0x9F, 0x19, 0xF0, 0x9F, 0x2F, 0x1F, 0x2F,
+    0x1F, 0x2F, 0x90, 0xAE, 0x2A, 0xE9, 0x09, 0xE9, 0x19, 0xE9, 0x1E, 0x92, 0xE9, 0x19, 0x99, 0x39,
+    0x99, 0x00, 0x69, 0x99, 0x97, 0x1A, 0xF7, 0x1F, 0x97, 0x1F, 0x72, 0xEA, 0x72, 0xE9, 0x72, 0xE6,
+    0xEA, 0xAE, 0xAA, 0xE0, 0x9F, 0xFF, 0xA0, 0xAF, 0xFF, 0x90, 0xAD, 0xAA, 0xEA, 0xAA, 0xD9, 0x5E,
+    0x72, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xE7, 0x2F, 0x71, 0x9E,
+    0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xF7, 0x1F, 0xC7, 0x00, 0x70, 0x99,
+    0x99, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3A, 0xE9, 0x73, 0xAE, 0x74, 0xAD, 0xA7, 0xAA, 0x99, 0x9E,
+    0x99, 0x9A, 0xA3, 0xFF, 0xFC, 0x29, 0xFF, 0xFC, 0x2A, 0xFF, 0xFA, 0x7A, 0xDA, 0x74, 0xEA, 0x73,
+    0xAE, 0xA7, 0x3F, 0x97, 0x3F, 0x74, 0xEA, 0x7A, 0x99, 0x90, 0xE9, 0x99, 0x9A, 0x3F, 0xFF, 0xC2,
+    0x9F, 0xFF, 0xC2, 0xAF, 0xFF, 0xA2, 0x99, 0x2E, 0x92, 0x97, 0x0E, 0x74, 0xAE, 0x74, 0xF7, 0x4F,
+    0x73, 0xAF, 0x70, 0x39, 0x95, 0xFC, 0xA2, 0xFE, 0xA0, 0x9F, 0xF0, 0xAF, 0xF9, 0xAF, 0xFA, 0xAF,
+    0xFA, 0xAF, 0xF9, 0x9F, 0xF1, 0xAF, 0xD9, 0x29, 0xF9, 0x10, 0x29, 0x71, 0xC9, 0x79, 0xD9, 0x6A,
+    0xEA, 0x5F, 0xCA, 0x4F, 0xE3, 0xFF, 0x19, 0xFF, 0x90, 0xAF, 0xDA, 0x2F, 0xCA, 0x4E, 0xA5, 0x9D,
+    0x79, 0x97, 0x00, 0x70, 0xAE, 0x1A, 0xFA, 0x0F, 0xCA, 0x0F, 0xCA, 0x0A, 0xF2, 0x99, 0x91, 0x77,
+    0x09, 0xE9, 0x4A, 0xE0, 0x9F, 0xC3, 0xAF, 0xAA, 0xFC, 0x3F, 0xCA, 0xAF, 0xC3, 0xFC, 0xA9, 0xF9,
+    0x3A, 0xF2, 0x99, 0x69, 0x99, 0x10, 0x77, 0x71, 0x9E, 0x93, 0x9E, 0xA3, 0x9E, 0xA0, 0x9F, 0xC3,
+    0xFC, 0x3F, 0xC9, 0xAF, 0xC2, 0xAF, 0xC2, 0x9F, 0xC9, 0xAF, 0xC2, 0xAF, 0xC2, 0x9F, 0xC0, 0x9F,
+    0x92, 0x9F, 0x93, 0xFA, 0x29, 0x96, 0x99, 0x69, 0x92, 0x79, 0xEA, 0x1F, 0xC9, 0x9F, 0xC9, 0x9F,
+    0xC1, 0xFA, 0x29, 0x92, 0x70, 0xAF, 0xE0, 0xAC, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x71, 0xFE, 0xA6, 0xCA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x69, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xFF, 0xCA, 0x99, 0x99, 0x99, 0xC9, 0x5C,
+    0x95, 0xC9, 0x5C, 0xA5, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xFF, 0x99, 0x99, 0x99, 0xAC, 0x59, 0xC5, 0x9C, 0x59, 0xC5, 0xAF,
+    0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59,
+    0x92, 0x77, 0x77, 0x73, 0xAF, 0x97, 0x0A, 0xDA, 0x77, 0x19, 0xFE, 0x96, 0x9E, 0x97, 0x71, 0xFF,
+    0xC5, 0x9E, 0xA7, 0x71, 0xFC, 0x9F, 0x5F, 0x77, 0x2F, 0x1A, 0xE9, 0x3A, 0xE7, 0x72, 0xAE, 0xA1,
+    0xAE, 0x92, 0x9E, 0x97, 0x72, 0xF9, 0x1F, 0x92, 0xEA, 0x77, 0x3F, 0x2F, 0x2F, 0x77, 0x4F, 0x2F,
+    0x1A, 0xE7, 0x75, 0xF1, 0x9E, 0xA0, 0x9E, 0x91, 0xAA, 0xA9, 0x7A, 0xAA, 0x93, 0xF1, 0xF9, 0x0E,
+    0xA0, 0xAF, 0xD4, 0xAF, 0xD2, 0xFA, 0xFC, 0x0F, 0x0F, 0xFA, 0x2A, 0xFF, 0x1A, 0xFF, 0x0A, 0xE0,
+    0xAF, 0xFC, 0x19, 0xFF, 0xC2, 0xFE, 0x09, 0xE9, 0x0F, 0x90, 0xF9, 0x0F, 0x90, 0xAE, 0x92, 0x9A,
+    0xCA, 0x91, 0xEA, 0x09, 0xEA, 0x1A, 0xE9, 0x9F, 0x1A, 0xE9, 0x70, 0xF1, 0xAE, 0x91, 0xAE, 0x9A,
+    0xE9, 0x1A, 0xE9, 0x7A, 0xE2, 0xF2, 0xF0, 0xF2, 0xF7, 0x9E, 0x92, 0xF2, 0xF0, 0xF2, 0xF7, 0xEA,
+    0x3F, 0x19, 0xF0, 0xF1, 0x9F, 0x6F, 0x4F, 0x1A, 0xE9, 0x0F, 0x1A, 0xE9, 0x5A, 0xE9, 0x4F, 0x09,
+    0xF1, 0xF0, 0x9F, 0x59, 0xEA, 0x5F, 0xFC, 0x91, 0xFF, 0xC9, 0x5F, 0x69, 0xFE, 0xA2, 0x9F, 0xEA,
+    0x5F, 0x70, 0x9F, 0xC9, 0x49, 0xFC, 0xA7, 0x76, 0x97, 0x29, 0x60, 0x77, 0x77, 0x77, 0x7A, 0xF9,
+    0x70, 0xAD, 0xA7, 0x77, 0x59, 0xFE, 0x96, 0x9E, 0x97, 0x77, 0x5F, 0xFC, 0x59, 0xEA, 0x77, 0x75,
+    0xFC, 0x9F, 0x5F, 0x77, 0x76, 0xF1, 0xAE, 0x93, 0xAE, 0x77, 0x76, 0xAE, 0xA1, 0xAE, 0x92, 0x9E,
+    0x97, 0x77, 0x6F, 0x91, 0xF9, 0x2E, 0xA7, 0x77, 0x7F, 0x2F, 0x2F, 0x77, 0x77, 0x0F, 0x2F, 0x1A,
+    0xE7, 0x77, 0x71, 0xF1, 0x9E, 0xA0, 0x9E, 0x91, 0xAA, 0xA9, 0x7A, 0xAA, 0x97, 0x9A, 0xA9, 0x3F,
+    0x1F, 0x90, 0xEA, 0x0A, 0xFD, 0x4A, 0xFD, 0x4A, 0xFD, 0x2F, 0xAF, 0xC0, 0xF0, 0xFF, 0xA2, 0xAF,
+    0xF2, 0xAF, 0xF1, 0xAF, 0xF0, 0xAE, 0x0A, 0xFF, 0xC1, 0x9F, 0xFC, 0x19, 0xFF, 0xC2, 0xFE, 0x09,
+    0xE9, 0x0F, 0x90, 0xF9, 0x0F, 0x90, 0xAE, 0x90, 0xF9, 0x0A, 0xE9, 0x29, 0xAC, 0xA9, 0x1E, 0xA0,
+    0x9E, 0xA1, 0xAE, 0x99, 0xF1, 0xAE, 0x99, 0xF1, 0xAE, 0x97, 0x0F, 0x1A, 0xE9, 0x1A, 0xE9, 0xAE,
+    0x91, 0xAE, 0x9A, 0xEA, 0x1A, 0xE9, 0x7A, 0xE2, 0xF2, 0xF0, 0xF2, 0xF0, 0xF9, 0x1A, 0xE9, 0x69,
+    0xE9, 0x2F, 0x2F, 0x0F, 0x2F, 0x0F, 0x2F, 0x7E, 0xA3, 0xF1, 0x9F, 0x0F, 0x19, 0xF0, 0xF2, 0xF6,
+    0xF4, 0xF1, 0xAE, 0x90, 0xF1, 0xAE, 0x90, 0xF1, 0xAE, 0xA5, 0xAE, 0x94, 0xF0, 0x9F, 0x1F, 0x09,
+    0xF1, 0xF9, 0x9F, 0x59, 0xEA, 0x5F, 0xFC, 0x91, 0xFF, 0xC9, 0x1A, 0xFF, 0xA5, 0xF6, 0x9F, 0xEA,
+    0x29, 0xFE, 0xA3, 0xFF, 0x5F, 0x70, 0x9F, 0xC9, 0x49, 0xFC, 0xA4, 0x9F, 0xCA, 0x77, 0x69, 0x72,
+    0x97, 0x29, 0x60, 0x4F, 0x4A, 0xEA, 0x39, 0xF4, 0xF9, 0x39, 0xEA, 0x4F, 0x4A, 0xE5, 0xE9, 0x4A,
+    0xDA, 0x50, 0x4F, 0x29, 0xEA, 0x4A, 0xEA, 0x2F, 0x93, 0x9F, 0x2A, 0xEA, 0x4F, 0x92, 0xF4, 0x9E,
+    0xA2, 0xF5, 0xF2, 0x9E, 0xA4, 0xAE, 0x3F, 0x5E, 0x92, 0x9E, 0x5A, 0xDA, 0x3E, 0x95, 0x4F, 0x29,
+    0xEA, 0x2A, 0xE9, 0x3A, 0xEA, 0x2F, 0x91, 0x9F, 0x39, 0xF2, 0xAE, 0xA2, 0xF9, 0x3F, 0x92, 0xF2,
+    0xAE, 0xA3, 0x9E, 0xA2, 0xF3, 0xF4, 0xF2, 0x9E, 0xA2, 0xAE, 0x4A, 0xE3, 0xF2, 0x9E, 0x94, 0xE9,
+    0x29, 0xE3, 0xF4, 0xAD, 0xA3, 0xE9, 0x29, 0xE5, 0x0F, 0x4A, 0xEA, 0x4F, 0x4A, 0xE9, 0x4F, 0x4A,
+    0xE5, 0xEA, 0x49, 0xE5, 0xAD, 0x90, 0x0F, 0x29, 0xEA, 0x4A, 0xEA, 0x2F, 0x94, 0xF2, 0x9E, 0xA4,
+    0xAE, 0x92, 0xF5, 0xF2, 0x9E, 0x94, 0xAE, 0x3F, 0x5E, 0xA2, 0x9E, 0x94, 0x9E, 0x3A, 0xDA, 0x5A,
+    0xD9, 0x3E, 0x00, 0x0F, 0x29, 0xEA, 0x2A, 0xE9, 0x3A, 0xEA, 0x2F, 0x91, 0x9F, 0x4F, 0x29, 0xEA,
+    0x2F, 0x93, 0xAE, 0x92, 0xF2, 0x9E, 0xA4, 0xF2, 0x9E, 0x92, 0xAE, 0x4A, 0xE3, 0xF3, 0xEA, 0x4E,
+    0xA2, 0x9E, 0x92, 0xAE, 0x49, 0xE3, 0xAD, 0xA3, 0xE9, 0x4A, 0xD9, 0x3E, 0x39, 0xDA, 0x6A, 0xA7,
+    0x0A, 0xD7, 0x0E, 0x7F, 0x95, 0x9D, 0xAC, 0xA5, 0xD9, 0x0D, 0x4A, 0xD1, 0xD3, 0x9D, 0x91, 0xD9,
+    0x2D, 0xA2, 0xAC, 0xA1, 0xAD, 0x39, 0xCA, 0x1D, 0x93, 0x9D, 0x00, 0x5A, 0x79, 0xD9, 0x49, 0xFA,
+    0x3F, 0xC3, 0xFC, 0x92, 0xFC, 0xA2, 0xAF, 0xA2, 0xAF, 0xC3, 0xAF, 0xA4, 0xFC, 0x4F, 0xC9, 0x39,
+    0xFA, 0x4F, 0xC4, 0x9F, 0x94, 0xDA, 0x95, 0x95, 0x49, 0x95, 0xAE, 0x49, 0xF9, 0x4F, 0xC4, 0xAF,
+    0x49, 0xFA, 0x4F, 0xC4, 0xAF, 0xA2, 0x9F, 0xC3, 0xFC, 0x92, 0xFC, 0x92, 0xAF, 0xA2, 0xAF, 0xA3,
+    0x9F, 0x6D, 0x77, 0x73, 0x99, 0x77, 0xA6, 0xF6, 0xA5, 0xAD, 0x49, 0xFA, 0x4A, 0xD3, 0xAF, 0x39,
+    0xFA, 0x3A, 0xF3, 0xFC, 0x3F, 0x3A, 0xF9, 0x4F, 0xC3, 0x99, 0x3A, 0xF9, 0x6F, 0xC7, 0xAF, 0x97,
+    0x0F, 0xC5, 0xAF, 0x97, 0x2F, 0xC3, 0xAF, 0x97, 0x4F, 0xC1, 0xAF, 0x97, 0x6F, 0xCA, 0xF9, 0x39,
+    0x29, 0xEA, 0x3F, 0xF9, 0x29, 0xE9, 0x0F, 0xC4, 0xFD, 0x93, 0xFC, 0x0F, 0xC4, 0xAF, 0xC4, 0xFC,
+    0x0A, 0xF3, 0xAF, 0xE3, 0xAF, 0x19, 0xAA, 0x3A, 0xFF, 0xC3, 0x9A, 0x97, 0x0A, 0xF9, 0x0F, 0xC7,
+    0x5A, 0xF9, 0x2F, 0xC7, 0x3A, 0xF9, 0x4F, 0xC7, 0x1A, 0xF9, 0x6F, 0xC7, 0xAF, 0x97, 0x0F, 0xC5,
+    0xAF, 0x92, 0xAD, 0xA3, 0xFC, 0x3A, 0xF9, 0x29, 0xF9, 0x3F, 0xA3, 0xE9, 0x39, 0xFA, 0x4E, 0x94,
+    0xC9, 0x49, 0xF9, 0x5C, 0x97, 0x59, 0xDA, 0x73, 0x4F, 0xC9, 0x2A, 0xFA, 0x39, 0xFC, 0x92, 0xFC,
+    0x93, 0x9F, 0xC2, 0x9F, 0xC4, 0xAF, 0xA2, 0x9F, 0xC4, 0xFC, 0x92, 0xAF, 0xA4, 0xFC, 0x3F, 0xC9,
+    0x4F, 0xC3, 0xFC, 0x49, 0xFA, 0x3F, 0xC4, 0x9F, 0x92, 0x9F, 0xA4, 0xAF, 0x39, 0xF9, 0x4F, 0xC3,
+    0xAF, 0x5F, 0xA3, 0xFC, 0x5F, 0x93, 0xFA, 0x49, 0xF4, 0xF9, 0x49, 0xF3, 0x9F, 0x5A, 0xEA, 0x39,
+    0xF6, 0x99, 0x95, 0x99, 0x97, 0x77, 0x77, 0x59, 0xEA, 0x39, 0xEA, 0x5F, 0xC3, 0xFC, 0x93, 0xAF,
+    0xC2, 0x9F, 0xC9, 0x3A, 0xFC, 0x29, 0xFC, 0x5F, 0x93, 0xF9, 0x69, 0x96, 0x99, 0x60, 0x77, 0x2A,
+    0xFD, 0xA3, 0x9F, 0xFE, 0x2F, 0xFF, 0xA1, 0x9F, 0xFF, 0x2F, 0xD9, 0x9F, 0x91, 0x90, 0xF1, 0xF9,
+    0x3E, 0xA1, 0xF9, 0x29, 0xE9, 0x0A, 0xF3, 0xAE, 0x9A, 0xFA, 0x3A, 0xFF, 0xC4, 0xFF, 0xA5, 0xFE,
+    0x96, 0xFD, 0x79, 0xFA, 0x70, 0xAF, 0x71, 0xAE, 0xA7, 0x77, 0x77, 0x76, 0xEA, 0x71, 0xFC, 0x97,
+    0x0F, 0xC9, 0x70, 0xFC, 0x71, 0xFA, 0x72, 0x99, 0x72, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x0F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77,
+    0x09, 0xC7, 0x4A, 0xAA, 0xC9, 0x72, 0x9C, 0xA0, 0xD7, 0x19, 0xD1, 0xAC, 0xA7, 0xAD, 0x3E, 0xA9,
+    0x19, 0xAE, 0x5F, 0xFD, 0x79, 0xAF, 0xA9, 0x40, 0x79, 0x99, 0x97, 0x29, 0xFE, 0xA7, 0xAF, 0xFD,
+    0x94, 0xAD, 0xA5, 0xAD, 0x3A, 0xD7, 0x09, 0xD1, 0x9C, 0xA7, 0x2A, 0xC1, 0xD7, 0x4C, 0xA0, 0x97,
+    0x59, 0x00, 0x75, 0x99, 0x75, 0xAD, 0x74, 0x9D, 0x97, 0x4D, 0xA7, 0x4A, 0xD7, 0x49, 0xD9, 0x74,
+    0xE7, 0x4A, 0xD7, 0x5D, 0xA7, 0x4E, 0x74, 0x9D, 0x97, 0x4D, 0xA7, 0x4A, 0xD9, 0x73, 0x9E, 0x97,
+    0x3F, 0xA7, 0x2A, 0xD9, 0xD7, 0x19, 0xD9, 0x0D, 0x71, 0xE1, 0xD9, 0x7A, 0xD2, 0xAC, 0xA7, 0xDA,
+    0x2A, 0xD6, 0xE3, 0x9D, 0x59, 0xD9, 0x4D, 0x94, 0x77, 0x29, 0x97, 0x77, 0x73, 0xAE, 0x97, 0x77,
+    0x70, 0xF7, 0x77, 0x71, 0xF7, 0x77, 0x3C, 0xA3, 0xE9, 0x77, 0x72, 0x9E, 0xA1, 0xE7, 0x77, 0x3A,
+    0xFF, 0xC3, 0x99, 0x77, 0x5A, 0xFF, 0xFE, 0x77, 0x70, 0x9F, 0xFF, 0x77, 0x71, 0x9F, 0xFD, 0xA7,
+    0x77, 0x09, 0xFD, 0x91, 0x9A, 0x97, 0x77, 0xAF, 0xAE, 0x77, 0x73, 0xAF, 0x99, 0xE9, 0x77, 0x72,
+    0xAE, 0xA1, 0xF7, 0x75, 0x9A, 0x92, 0x9D, 0x2F, 0x92, 0x9A, 0x97, 0x6F, 0x96, 0xAE, 0x92, 0xAE,
+    0xA7, 0x4F, 0x70, 0x95, 0xAE, 0x96, 0x94, 0xEA, 0x71, 0x94, 0xAE, 0x7D, 0x92, 0xE9, 0x71, 0xDA,
+    0x2E, 0xA6, 0x9F, 0x90, 0xE7, 0x2F, 0xA0, 0xE9, 0x6F, 0xFD, 0x99, 0x9A, 0xAA, 0x3A, 0xFF, 0xC9,
+    0x99, 0x9A, 0xA1, 0x9A, 0xFF, 0xFD, 0x4A, 0xFF, 0xFD, 0x59, 0xFF, 0xDA, 0x79, 0xFF, 0xE5, 0xAF,
+    0xFD, 0xA7, 0x9F, 0xFE, 0x4A, 0xFD, 0x97, 0x39, 0xFE, 0x39, 0x3F, 0xCA, 0xE7, 0x2A, 0xF9, 0xE7,
+    0xFC, 0x09, 0xE9, 0x70, 0xAF, 0x90, 0xEA, 0x69, 0xE9, 0x1F, 0x71, 0xEA, 0x1A, 0xE7, 0x0C, 0xA2,
+    0xAE, 0x97, 0x1A, 0xC2, 0x9E, 0xA7, 0x49, 0xDA, 0x77, 0x0D, 0xA9, 0x77, 0x77, 0x71, 0x09, 0xFE,
+    0xA0, 0xAF, 0xEA, 0x0F, 0xF9, 0x0F, 0xF7, 0x20, 0x77, 0x1E, 0x97, 0x70, 0xF7, 0x70, 0xAE, 0x77,
+    0x09, 0xE9, 0x77, 0x0E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x77, 0x09, 0xE9, 0x77, 0x0E, 0xA7, 0x70,
+    0xF7, 0x70, 0xAE, 0x97, 0x79, 0xEA, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x0A, 0xE9, 0x77, 0x9E, 0xA7,
+    0x70, 0xF7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x79, 0xEA, 0x77, 0x0F, 0x77, 0x0F, 0x77, 0x0A, 0xE9,
+    0x77, 0x9E, 0xA7, 0x70, 0x59, 0xFE, 0x6A, 0xFE, 0x6F, 0xF6, 0xFA, 0xAA, 0x95, 0x9F, 0x71, 0xAE,
+    0xA7, 0x1F, 0x97, 0x1F, 0x72, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF7, 0x2F, 0xE9,
+    0x59, 0xFE, 0x6A, 0xFE, 0x6F, 0xA9, 0x99, 0x6F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1A, 0xE9, 0x71,
+    0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xFA, 0x71, 0xFE, 0xA6, 0xFE, 0x95, 0x9F, 0xE9,
+    0x69, 0x99, 0x99, 0x99, 0x60, 0x6F, 0xE9, 0x59, 0xFE, 0x95, 0xAF, 0xE6, 0x9A, 0xAF, 0xC7, 0x19,
+    0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1F, 0x72,
+    0xF6, 0xFF, 0x6F, 0xEA, 0x59, 0xFE, 0x96, 0x99, 0xAF, 0x71, 0x9F, 0x71, 0x9E, 0xA7, 0x1A, 0xEA,
+    0x71, 0xF9, 0x71, 0xF7, 0x19, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xF6, 0xAF, 0xE6, 0xFF, 0x6F,
+    0xEA, 0x69, 0x99, 0x99, 0x99, 0x60, 0x77, 0x77, 0x09, 0xAF, 0xD9, 0x59, 0xAF, 0xCA, 0x93, 0x9F,
+    0xFE, 0x2A, 0xFF, 0xDA, 0x2F, 0xFF, 0xA1, 0xFF, 0xF9, 0x19, 0xFF, 0xF1, 0xAF, 0xFF, 0x2D, 0xA3,
+    0xFC, 0x90, 0x9D, 0x93, 0xFC, 0x29, 0x59, 0xF9, 0x19, 0x5F, 0xC7, 0x1A, 0xF9, 0x70, 0xFC, 0x71,
+    0xFC, 0x70, 0x9F, 0xA7, 0x9F, 0xC9, 0x7A, 0xFC, 0x7A, 0xFC, 0xA7, 0xFD, 0x96, 0xFD, 0xA6, 0x9F,
+    0xD9, 0x6F, 0xD9, 0x7F, 0xD7, 0xAF, 0xC7, 0x0F, 0xCA, 0x70, 0xFA, 0x70, 0x9F, 0x97, 0x09, 0xF7,
+    0x1A, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9E, 0xA7, 0x1A,
+    0xE9, 0x71, 0xFC, 0x70, 0x9F, 0xC7, 0x09, 0xFC, 0x97, 0xAF, 0xC7, 0x09, 0xFC, 0x70, 0xAF, 0xC7,
+    0x1F, 0x97, 0x09, 0xF7, 0x39, 0x97, 0x49, 0x97, 0x20, 0x77, 0x73, 0x9A, 0xFD, 0x95, 0x9F, 0xC1,
+    0x9F, 0xFE, 0x4F, 0xD1, 0xFF, 0xFA, 0x3F, 0xCA, 0x19, 0xFF, 0xF3, 0xFC, 0x3D, 0xA3, 0xFC, 0x91,
+    0x9F, 0xC3, 0x95, 0x9F, 0x91, 0x9F, 0xA7, 0x2A, 0xF9, 0x1A, 0xF9, 0x72, 0xFC, 0x2F, 0xC7, 0x19,
+    0xFC, 0x92, 0xFC, 0x70, 0xAF, 0xCA, 0x3F, 0xA7, 0xFD, 0xA3, 0x9F, 0x96, 0xFD, 0x94, 0x9F, 0x6A,
+    0xFC, 0x6A, 0xF6, 0xFA, 0x7F, 0xA5, 0x9F, 0x70, 0xF9, 0x5A, 0xEA, 0x70, 0xF7, 0x74, 0x99, 0x99,
+    0x77, 0x77, 0x77, 0x79, 0xEA, 0x70, 0xF6, 0xFC, 0x7A, 0xFA, 0x49, 0xFC, 0x96, 0xFC, 0xA4, 0x9F,
+    0xC7, 0xFC, 0x95, 0xF9, 0x7A, 0xF7, 0x99, 0x72, 0x99, 0x96, 0x77, 0x76, 0xFC, 0x93, 0x9A, 0xFC,
+    0xA6, 0x9F, 0xC9, 0x1A, 0xFF, 0xD9, 0x49, 0xFC, 0x19, 0xFF, 0xF4, 0xAF, 0xA2, 0xFF, 0xFA, 0x3F,
+    0xC9, 0x29, 0xD9, 0x29, 0xFC, 0x3F, 0xC7, 0x3F, 0xC3, 0xFC, 0x73, 0xFC, 0x29, 0xFA, 0x72, 0xAF,
+    0xA2, 0x9F, 0x97, 0x1A, 0xFC, 0x3A, 0xF7, 0x1F, 0xD9, 0x3F, 0xC7, 0x9F, 0xD9, 0x4F, 0xA6, 0x9F,
+    0xCA, 0x6F, 0x96, 0xFC, 0x96, 0x9F, 0x69, 0xF9, 0x79, 0xF6, 0xFA, 0x70, 0xAE, 0xA6, 0xF7, 0x29,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9E, 0xA6, 0xAE, 0x71, 0xFC, 0x59, 0xFA, 0x7A, 0xFC, 0x5F,
+    0xD7, 0xAF, 0xC5, 0xFC, 0xA7, 0x0F, 0x95, 0x9F, 0x72, 0x99, 0x71, 0x99, 0x71, 0x77, 0x0F, 0xFF,
+    0xF9, 0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xA7, 0x29, 0xF7, 0x3F,
+    0x97, 0x2A, 0xF7, 0x3F, 0x97, 0x2F, 0xA7, 0x29, 0xF7, 0x3F, 0xA7, 0x2A, 0xF7, 0x3F, 0x97, 0x2F,
+    0xC7, 0x29, 0xF9, 0x72, 0xFA, 0x72, 0xAF, 0x72, 0x9F, 0xA7, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x96, 0xAF, 0xFF, 0xC9, 0x2A, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xE9, 0x0A, 0xD1, 0x9F, 0xFE, 0x0A,
+    0xD1, 0x9F, 0xFE, 0x0A, 0xD1, 0x9F, 0xFE, 0x9A, 0xD1, 0x9F, 0xFE, 0x9A, 0xD1, 0x9F, 0xFE, 0xAA,
+    0xD1, 0x9F, 0xFE, 0xAA, 0xD1, 0x9F, 0xFE, 0x9A, 0xD1, 0x9F, 0xFE, 0x9A, 0xD1, 0x9F, 0xFE, 0x0A,
+    0xD1, 0x9F, 0xFE, 0x0A, 0xD1, 0x9F, 0xFD, 0x90, 0xAD, 0x19, 0xFF, 0xCA, 0x1A, 0xD1, 0x9F, 0xF9,
+    0x2A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97,
+    0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97,
+    0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97, 0x0A, 0xD1, 0x9D, 0x97,
+    0x0A, 0xD1, 0x9D, 0x97, 0x77, 0x20, 0x77, 0x5A, 0xFF, 0xFC, 0x2F, 0xFF, 0xE1, 0xFF, 0xFF, 0x09,
+    0xFF, 0xD9, 0x1A, 0xD0, 0xFF, 0xE9, 0x1A, 0xD0, 0xFF, 0xE9, 0x1A, 0xD0, 0xFF, 0xE9, 0x1A, 0xD9,
+    0xFF, 0xE9, 0x1A, 0xD9, 0xFF, 0xE9, 0x1A, 0xD0, 0xFF, 0xE9, 0x1A, 0xD0, 0xFF, 0xE9, 0x1A, 0xD0,
+    0xFF, 0xE9, 0x1A, 0xD0, 0xAF, 0xFD, 0x91, 0xAD, 0x09, 0xFF, 0xDA, 0xAA, 0xE1, 0xAF, 0xFF, 0xE2,
+    0xAF, 0xFF, 0xD4, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x1A, 0xFF, 0xFA, 0x3A, 0xFF,
+    0xFD, 0x91, 0xAF, 0xFF, 0xE9, 0x0A, 0xD2, 0xFF, 0xE0, 0xAD, 0x2F, 0xFE, 0x0A, 0xD2, 0xFF, 0xE9,
+    0xAD, 0x2F, 0xFE, 0xAA, 0xD2, 0xFF, 0xEA, 0xAD, 0x2F, 0xFE, 0xAA, 0xD2, 0xFF, 0xEA, 0xAD, 0x2F,
+    0xFE, 0xAA, 0xD2, 0xFF, 0xE9, 0xAD, 0x2F, 0xFE, 0x0A, 0xDA, 0xAA, 0xFF, 0xDA, 0x0A, 0xFF, 0xFE,
+    0x1A, 0xFF, 0xFD, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x40, 0x79, 0x76, 0x9E, 0xA7, 0x39,
+    0xEA, 0x73, 0xAE, 0x6A, 0xC9, 0x2A, 0xE6, 0xF9, 0x0E, 0x95, 0x9F, 0xFC, 0x39, 0x90, 0x9F, 0xFF,
+    0xE3, 0x9A, 0xFF, 0xE5, 0xFF, 0xE4, 0xFD, 0xA1, 0x99, 0xA3, 0xFA, 0xE6, 0x9F, 0xA0, 0xEA, 0x59,
+    0xF1, 0xAE, 0x7D, 0x91, 0x9E, 0xA7, 0x93, 0xEA, 0x74, 0x96, 0x39, 0x99, 0x4A, 0xF2, 0x9F, 0xC2,
+    0xAF, 0xC2, 0x9F, 0xC3, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAE, 0xA3, 0xFA, 0x3A, 0xEA,
+    0x3A, 0xEA, 0x3A, 0xEA, 0x39, 0xEA, 0x39, 0xE9, 0x4E, 0x94, 0x99, 0x94, 0x73, 0x99, 0x99, 0x76,
+    0x9F, 0xEA, 0x73, 0xAF, 0xFD, 0x97, 0x0A, 0xDA, 0x5A, 0xD7, 0xAD, 0x70, 0x9D, 0x59, 0xCA, 0x72,
+    0xAC, 0x5D, 0x74, 0xCA, 0x49, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x09, 0xC7, 0x4A, 0xA4, 0xAC, 0x97, 0x29, 0xCA, 0x5D, 0x71, 0x9D, 0x6A, 0xCA, 0x7A,
+    0xD7, 0x0E, 0xA9, 0x19, 0xAE, 0x72, 0xFF, 0xD7, 0x49, 0xAF, 0xA9, 0x71, 0x72, 0x99, 0x77, 0x1F,
+    0x97, 0x6F, 0x77, 0xEA, 0x71, 0xCA, 0x3E, 0x97, 0x09, 0xEA, 0x1E, 0x71, 0xFF, 0xCA, 0x39, 0x93,
+    0xAF, 0xFF, 0xE6, 0x9F, 0xFE, 0xA7, 0x9F, 0xFD, 0xA6, 0xAF, 0xD9, 0x09, 0x9A, 0x95, 0xAF, 0xAE,
+    0x71, 0xAF, 0x09, 0xE7, 0x1A, 0xEA, 0x1E, 0xA7, 0x19, 0xD2, 0xF7, 0x29, 0x3A, 0xE9, 0x77, 0x97,
+    0x59, 0x77, 0x19, 0xEA, 0x76, 0x9E, 0xA7, 0x6A, 0xE7, 0x1A, 0xC9, 0x2A, 0xE7, 0x1F, 0x90, 0xAD,
+    0xA7, 0x09, 0xFF, 0xC3, 0x99, 0x39, 0xFF, 0xFE, 0x95, 0x9A, 0xFF, 0xE7, 0x0F, 0xFE, 0x7F, 0xE1,
+    0x99, 0xA6, 0xFA, 0xE9, 0x70, 0x9F, 0xA0, 0xEA, 0x70, 0x9F, 0x1A, 0xE7, 0x2D, 0x91, 0x9E, 0xA7,
+    0x29, 0x3E, 0xA7, 0x79, 0x71, 0x76, 0xF4, 0xEA, 0xAF, 0xA2, 0xAE, 0x9F, 0xCA, 0x2F, 0x0A, 0xFA,
+    0x19, 0xEA, 0x1F, 0x2F, 0x71, 0xF7, 0x0A, 0xE9, 0x70, 0xF7, 0x09, 0xEA, 0x70, 0xF7, 0x09, 0xEA,
+    0x70, 0xAE, 0x97, 0x0F, 0x70, 0xAE, 0x97, 0x0F, 0x70, 0x9E, 0xA7, 0x0F, 0x71, 0xF7, 0x0A, 0xE9,
+    0x70, 0xF2, 0xAE, 0x19, 0xEA, 0x19, 0xFC, 0x0F, 0x2A, 0xFC, 0x9E, 0xA2, 0xAF, 0xCA, 0xE9, 0x3F,
+    0x97, 0x19, 0x91, 0x49, 0xAE, 0xAA, 0x97, 0x69, 0xAA, 0x3A, 0xFF, 0xFA, 0x97, 0x1E, 0x2A, 0xFF,
+    0xFF, 0xCA, 0xA9, 0x90, 0x9A, 0xF1, 0x9F, 0xFF, 0xFF, 0xFF, 0x91, 0xF5, 0x9A, 0xAF, 0xFF, 0xE9,
+    0x2E, 0x73, 0x9A, 0xFF, 0xD4, 0x99, 0x77, 0x19, 0x99, 0x99, 0x50, 0x79, 0x97, 0x3A, 0xFD, 0xA6,
+    0x9F, 0xFD, 0x93, 0x9E, 0x94, 0xAD, 0x91, 0x9D, 0x97, 0x9D, 0x1D, 0x72, 0x9C, 0x9A, 0xC7, 0x4D,
+    0x09, 0x74, 0x90, 0x77, 0x72, 0xE7, 0x39, 0x2E, 0x29, 0x6D, 0xA1, 0xE1, 0xAC, 0xA4, 0xAE, 0xA0,
+    0xE0, 0xAE, 0x94, 0xFA, 0xEA, 0xF6, 0xFF, 0xE7, 0x0F, 0xFC, 0x49, 0xFF, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xFC, 0x09, 0xFF, 0xFF, 0xC4, 0x9F, 0xFA, 0x70, 0xAF, 0xFC, 0xA6, 0xAF, 0xFE, 0xA4, 0xAF, 0x0E,
+    0x0F, 0x94, 0xE1, 0xE1, 0xE6, 0xA2, 0xE2, 0xA7, 0x3E, 0x77, 0x99, 0x97, 0x73, 0x99, 0x73, 0x9F,
+    0x97, 0x1A, 0xFC, 0x71, 0xAF, 0xC7, 0x19, 0xFA, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x72, 0x9A,
+    0x97, 0x3F, 0xC7, 0x2F, 0xC9, 0x71, 0xFC, 0x97, 0x1F, 0xC7, 0x3A, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x59, 0xAA, 0x97, 0x29, 0xFA, 0x71, 0xAF, 0xC7, 0x1A, 0xFC, 0x71, 0x9F, 0xA7, 0x29, 0xAA,
+    0x90, 0x4F, 0x19, 0xEA, 0x1A, 0xEA, 0x1F, 0x93, 0xAE, 0xA1, 0xF9, 0x09, 0xF1, 0xAE, 0xA3, 0x9F,
+    0x1A, 0xEA, 0x1F, 0x90, 0x9F, 0x4F, 0x91, 0xF1, 0xAE, 0xA1, 0xF9, 0x39, 0xEA, 0x1F, 0x2F, 0x19,
+    0xEA, 0x4F, 0x19, 0xEA, 0x1A, 0xE2, 0xF4, 0xAE, 0x2F, 0x2E, 0xA1, 0xAE, 0x5E, 0x91, 0x9E, 0x2F,
+    0x2E, 0x94, 0xAD, 0xA2, 0xE9, 0x19, 0xE2, 0xAD, 0xA5, 0x73, 0x99, 0x77, 0x59, 0xF9, 0x77, 0x3A,
+    0xFC, 0x77, 0x3A, 0xFC, 0x77, 0x39, 0xFA, 0x77, 0x4A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x49, 0xA9, 0x77, 0x9A, 0x92, 0xFC, 0x75, 0xAF, 0x1F, 0xC9, 0x74, 0xFC, 0xA0, 0xFC, 0x97,
+    0x4F, 0xCA, 0x0F, 0xC7, 0x5F, 0xC9, 0x1A, 0xCA, 0x77, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x73, 0x9A, 0xA9, 0x77, 0x49, 0xF9, 0x77, 0x3A, 0xFC, 0x77, 0x3A, 0xFC, 0x77, 0x39, 0xF9,
+    0x77, 0x49, 0xAA, 0x97, 0x20, 0x19, 0x99, 0x77, 0x09, 0x92, 0xAF, 0x75, 0x9F, 0x1F, 0xC9, 0x74,
+    0xFC, 0xA0, 0xFC, 0x97, 0x4F, 0xCA, 0x0F, 0xC7, 0x5A, 0xF9, 0x1A, 0xD9, 0x76, 0xAD, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAA, 0x97, 0x74, 0x9F, 0xA7, 0x73, 0xAF, 0xC7, 0x73, 0xAF,
+    0xC7, 0x73, 0x9F, 0xA7, 0x74, 0x9A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xAA,
+    0x77, 0x9A, 0xA2, 0xFC, 0x75, 0xFC, 0x1F, 0xC9, 0x74, 0xFC, 0x90, 0xFC, 0x97, 0x4F, 0xC9, 0x0F,
+    0xC7, 0x5F, 0xC2, 0xAA, 0xA7, 0x79, 0xAA, 0x10, 0x29, 0x92, 0xAF, 0x1F, 0xC9, 0x0F, 0xC9, 0x0F,
+    0xC1, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAC, 0xA2, 0xFC, 0x1F, 0xC9, 0x0F, 0xC9,
+    0x0F, 0xC2, 0x9A, 0xA1, 0x70, 0xAD, 0xA7, 0x70, 0xFC, 0x97, 0x7F, 0xCA, 0x77, 0xFC, 0xA7, 0x79,
+    0xF7, 0x72, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0x75, 0x93, 0xAE, 0xA7, 0x1F, 0x91,
+    0xFC, 0x97, 0x9F, 0xC0, 0x9F, 0xC9, 0x7A, 0xFC, 0x1F, 0xC7, 0x09, 0xFC, 0x19, 0xE9, 0x71, 0xAE,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xAC, 0xA9, 0x77, 0x0A, 0xF9, 0x77, 0xFC, 0xA7,
+    0x7F, 0xCA, 0x77, 0xAF, 0x97, 0x70, 0x9A, 0xA7, 0x10, 0x73, 0xAA, 0xA9, 0x77, 0x6E, 0xA7, 0x79,
+    0x94, 0xEA, 0x49, 0x96, 0x9F, 0x3E, 0xA2, 0x9F, 0x5F, 0xCA, 0x2E, 0xA2, 0xFC, 0xA4, 0xFC, 0xA2,
+    0xEA, 0x2F, 0xCA, 0x4A, 0xF9, 0x2E, 0xA2, 0xAF, 0x95, 0xAD, 0x93, 0xEA, 0x3A, 0xD9, 0x76, 0xEA,
+    0x77, 0x6E, 0xA7, 0x76, 0xEA, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x90, 0xFF, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xFF, 0xCA, 0x73,
+    0xEA, 0x77, 0x6E, 0xA7, 0x76, 0xEA, 0x76, 0x9A, 0xA9, 0x3E, 0xA3, 0x9A, 0xA6, 0xAF, 0x92, 0xEA,
+    0x2A, 0xF5, 0xFC, 0xA2, 0xEA, 0x2F, 0xC9, 0x4F, 0xCA, 0x2E, 0xA2, 0xFC, 0x94, 0xAF, 0x92, 0xEA,
+    0x2A, 0xF6, 0x9A, 0xA9, 0x3E, 0xA3, 0xAA, 0xA7, 0x7E, 0xA7, 0x76, 0xEA, 0x77, 0x77, 0x50, 0x79,
+    0xF1, 0xFC, 0xA0, 0xFC, 0xA0, 0xFC, 0xA0, 0x9F, 0x77, 0x77, 0x5E, 0xA1, 0xFC, 0xA0, 0xFC, 0xA0,
+    0xFC, 0xA0, 0x9F, 0x39, 0x97, 0x77, 0x7A, 0xD9, 0x1F, 0xC9, 0x0F, 0xCA, 0x0F, 0xCA, 0x0A, 0xF9,
+    0x19, 0xAA, 0x10, 0x19, 0x99, 0x09, 0xFA, 0xAF, 0xCA, 0xFC, 0x9F, 0xA0, 0x9A, 0xA9, 0x79, 0xAC,
+    0xA0, 0x9F, 0xAA, 0xFC, 0xAF, 0xC0, 0xF9, 0x19, 0x97, 0x0A, 0xE0, 0xAF, 0xCA, 0xFC, 0xAF, 0xC0,
+    0xAE, 0x70, 0x99, 0x2F, 0x9A, 0xFC, 0xAF, 0xC9, 0xFA, 0x09, 0xAC, 0xA0, 0xFF, 0x99, 0x9D, 0x99,
+    0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5D, 0x2F, 0xF2, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFF, 0xCA, 0x99, 0x99, 0xAD, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0xA3, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xAF, 0xDA, 0x0F, 0xD1, 0xAF, 0xA2, 0xF3, 0xAD, 0xA4, 0xD5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59,
+    0x92, 0x72, 0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x29, 0xF9, 0x1F, 0xD0, 0xAF, 0xDA, 0x2A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x2A, 0xA4, 0xAD,
+    0xA2, 0xAC, 0x1C, 0xA0, 0xAC, 0x3C, 0xA0, 0xD1, 0xD2, 0xF4, 0xD5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFA, 0x29, 0x99, 0xCA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xD2, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x49, 0x99, 0x69, 0xFD, 0x39, 0xFF, 0x2F, 0xFC, 0x90, 0xAE,
+    0xA0, 0xAE, 0xA0, 0xF1, 0x9E, 0xA9, 0xEA, 0x19, 0xEA, 0xAE, 0x91, 0xAE, 0x9F, 0x91, 0xAE, 0x9F,
+    0x2F, 0x0F, 0x19, 0xF0, 0xF9, 0x0F, 0x90, 0xAF, 0xFC, 0x2F, 0xF3, 0x9F, 0xD6, 0x99, 0x95, 0x3A,
+    0xC9, 0x2A, 0xE2, 0x9D, 0xA7, 0x1A, 0xAA, 0x29, 0xE2, 0xAD, 0xA2, 0xE9, 0x2E, 0x29, 0xE2, 0xAE,
+    0x2A, 0xDA, 0x2E, 0x92, 0xE2, 0x9E, 0x29, 0x99, 0x92, 0x77, 0x5A, 0xF7, 0xAF, 0xC6, 0x9F, 0xCA,
+    0x59, 0xFD, 0x95, 0xFE, 0x5E, 0x9F, 0x4E, 0xA0, 0xEA, 0x3A, 0xDA, 0x09, 0xE9, 0x2A, 0xE1, 0xAE,
+    0x92, 0xFF, 0xF1, 0xFF, 0xF1, 0xAA, 0xAA, 0xAF, 0xCA, 0x96, 0x9E, 0x97, 0x0A, 0xE7, 0x71, 0x77,
+    0xAF, 0xF3, 0xFF, 0xC3, 0xFF, 0xA2, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xFE, 0x94, 0xFF, 0x93, 0x9A,
+    0xAA, 0xFC, 0x70, 0xF7, 0x0F, 0x70, 0xF1, 0xAC, 0xA9, 0x9A, 0xF9, 0x1A, 0xFF, 0xA2, 0x9F, 0xE9,
+    0x69, 0x99, 0x60, 0x69, 0x99, 0x94, 0xAF, 0xDA, 0x2F, 0xF9, 0x1F, 0xCA, 0xAA, 0xC1, 0xAE, 0x96,
+    0xEA, 0x69, 0xE9, 0xF9, 0x1A, 0xFF, 0xC9, 0x0F, 0xC9, 0xAE, 0xA0, 0xF2, 0xF0, 0xEA, 0x2F, 0x0E,
+    0xA2, 0xEA, 0x0A, 0xEA, 0x9F, 0x2F, 0xFA, 0x3F, 0xD9, 0x69, 0x99, 0x40, 0x75, 0x9F, 0xFD, 0x90,
+    0xAF, 0xFD, 0x1A, 0xFF, 0xD7, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE,
+    0x96, 0x9F, 0x7F, 0x7A, 0xEA, 0x69, 0xF7, 0x74, 0x59, 0x99, 0x7A, 0xFD, 0x4F, 0xFC, 0x29, 0xEA,
+    0x0A, 0xE9, 0x19, 0xE1, 0x9E, 0x91, 0x9E, 0xA0, 0xAE, 0x3F, 0xF9, 0x4F, 0xCA, 0x4A, 0xFE, 0x92,
+    0xAE, 0xA9, 0xF9, 0x09, 0xEA, 0x19, 0xEA, 0x09, 0xE9, 0x19, 0xEA, 0x09, 0xEA, 0x1F, 0x91, 0xFF,
+    0xD3, 0xFE, 0xA6, 0x99, 0x99, 0x40, 0x49, 0x99, 0x6A, 0xFC, 0xA3, 0xFF, 0xA1, 0xAE, 0xA9, 0xF1,
+    0xEA, 0x2E, 0x99, 0xE9, 0x2E, 0x99, 0xE9, 0x19, 0xE9, 0x0F, 0x9A, 0xF9, 0x0F, 0xFD, 0x2F, 0xAA,
+    0xE7, 0xEA, 0x6F, 0x1A, 0xAA, 0xAF, 0xC9, 0x1F, 0xF9, 0x2F, 0xDA, 0x49, 0x99, 0x97, 0x39, 0xCA,
+    0x79, 0xD7, 0x9D, 0x7A, 0xD4, 0xFF, 0xCA, 0x0F, 0xFC, 0xA3, 0x9D, 0x79, 0xD7, 0x9D, 0x79, 0xAA,
+    0x30, 0x9F, 0xFC, 0x99, 0xFF, 0xC9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x00, 0x71, 0xFF, 0xFF, 0xF7,
+    0x73, 0xFF, 0xFF, 0xF7, 0x10, 0x4A, 0xA9, 0x3A, 0xD3, 0xAD, 0x93, 0xDA, 0x3E, 0x39, 0xD9, 0x3E,
+    0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4E, 0x4E, 0x4E, 0x4E, 0x4A, 0xD4, 0xAD, 0x5D, 0x94, 0xDA, 0x49,
+    0xAA, 0x30, 0x39, 0xA9, 0x59, 0xD6, 0xD9, 0x5E, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5,
+    0xE5, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xDA, 0x4A, 0xD4, 0x9D, 0xA4, 0xE4, 0xAD, 0x49, 0xAA, 0x50,
+    0x2A, 0xA1, 0xAA, 0xA3, 0xAD, 0x0F, 0xC2, 0xFC, 0xAE, 0xA1, 0xF1, 0xAD, 0xA1, 0xE2, 0xAD, 0xA0,
+    0x9E, 0x2A, 0xD9, 0x0A, 0xD9, 0x2E, 0x1E, 0x3E, 0x1E, 0x29, 0xE0, 0x9E, 0x2A, 0xDA, 0x0A, 0xDA,
+    0x2E, 0x90, 0x99, 0x93, 0x99, 0x91, 0x59, 0x99, 0x6F, 0xD3, 0x9F, 0xF2, 0xFF, 0xCA, 0x0A, 0xF0,
+    0x9E, 0xA0, 0xF9, 0x1F, 0x0F, 0x19, 0xF9, 0xEA, 0x19, 0xEA, 0xAE, 0x91, 0xAE, 0xAA, 0xE9, 0x1F,
+    0x9A, 0xE9, 0x1F, 0x0A, 0xE9, 0x0A, 0xEA, 0x09, 0xFF, 0xC2, 0xFF, 0x93, 0xFD, 0x95, 0x99, 0x99,
+    0x40, 0x77, 0x0A, 0xEA, 0x39, 0xFC, 0x92, 0xAF, 0xD1, 0x9F, 0xF1, 0xAF, 0xF2, 0xD9, 0x9E, 0xA2,
+    0x91, 0xAE, 0x95, 0xF6, 0xF6, 0xF5, 0x9E, 0xA5, 0xAE, 0x95, 0xF6, 0xF7, 0x50, 0x59, 0x99, 0x96,
+    0xAF, 0xD9, 0x3F, 0xFC, 0x3F, 0xFC, 0xA3, 0xC2, 0x9E, 0xA7, 0x9E, 0x97, 0xF7, 0xF9, 0x6F, 0x95,
+    0x9F, 0x95, 0xAF, 0x6A, 0xEA, 0x6F, 0xFD, 0x90, 0x9F, 0xFD, 0x90, 0x9F, 0xFD, 0x76, 0x59, 0x99,
+    0x69, 0xFE, 0x4F, 0xFC, 0x3A, 0xCA, 0xAA, 0xF7, 0x0A, 0xE7, 0x0A, 0xE4, 0x99, 0x9F, 0x94, 0xFC,
+    0xA5, 0x9F, 0xD7, 0x09, 0xF7, 0x0A, 0xE7, 0x0F, 0x1A, 0xDA, 0x9A, 0xFC, 0x1A, 0xFF, 0xC2, 0x9F,
+    0xEA, 0x69, 0x99, 0x95, 0x77, 0x39, 0xF9, 0x6F, 0xC6, 0xFD, 0x5F, 0xDA, 0x4A, 0xFD, 0xA3, 0xAE,
+    0x9E, 0x92, 0x9E, 0x0A, 0xE2, 0x9E, 0x1F, 0x2E, 0x91, 0xEA, 0x1A, 0xFF, 0xE9, 0xAF, 0xFE, 0x0A,
+    0xAA, 0xAA, 0xAF, 0xAA, 0x6F, 0x79, 0xEA, 0x77, 0x77, 0x0F, 0xFA, 0x29, 0xFF, 0x92, 0xAF, 0xF3,
+    0xE7, 0x1E, 0x70, 0x9F, 0xDA, 0x4A, 0xFF, 0x4A, 0xA9, 0xAF, 0x97, 0x9E, 0xA7, 0x9E, 0x97, 0xAE,
+    0x91, 0xCA, 0x99, 0x9A, 0xF2, 0xFF, 0xC3, 0xFE, 0xA6, 0x99, 0x99, 0x50, 0x69, 0x99, 0x95, 0x9F,
+    0xE3, 0xAF, 0xEA, 0x2A, 0xFA, 0xAA, 0xA9, 0x19, 0xF7, 0xAE, 0x70, 0xEA, 0xAE, 0xA2, 0x9F, 0xFC,
+    0xA1, 0x9F, 0x99, 0xF1, 0xAE, 0x91, 0x9E, 0x1A, 0xE2, 0x9E, 0x19, 0xE2, 0xAE, 0x2F, 0x9A, 0xEA,
+    0x2A, 0xFF, 0x4A, 0xFC, 0xA7, 0x99, 0x95, 0x76, 0xFF, 0xDA, 0x09, 0xFF, 0xD9, 0x09, 0xFF, 0xD7,
+    0x9E, 0xA7, 0xF7, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE, 0x96, 0x9E, 0xA7, 0xF7, 0xAE, 0x96, 0x9F,
+    0x7F, 0x77, 0x40, 0x59, 0x99, 0x96, 0xAF, 0xD9, 0x3A, 0xFF, 0x3F, 0x09, 0xEA, 0x19, 0xE9, 0x1E,
+    0xA2, 0xEA, 0x0A, 0xE3, 0xAF, 0xE9, 0x4F, 0xD4, 0x9F, 0xEA, 0x29, 0xF9, 0xF9, 0x1F, 0x2F, 0x1E,
+    0xA2, 0xF1, 0xF1, 0xAE, 0xA1, 0xAF, 0xFC, 0x3A, 0xFD, 0xA6, 0x99, 0x99, 0x40, 0x49, 0x99, 0x6A,
+    0xFC, 0xA3, 0xAF, 0xF1, 0x9F, 0x9A, 0xE9, 0x0F, 0x2E, 0xA0, 0xEA, 0x2E, 0xA0, 0xEA, 0x2E, 0xA0,
+    0xF9, 0x9F, 0xA0, 0xAF, 0xFC, 0x91, 0xAE, 0xAA, 0xE7, 0xEA, 0x6F, 0x1A, 0xAA, 0xAA, 0xFA, 0x1A,
+    0xFE, 0x92, 0xAF, 0xCA, 0x59, 0x99, 0x96, 0x3D, 0x7D, 0x7D, 0x69, 0xD3, 0xFF, 0xFF, 0xF3, 0xD7,
+    0xD7, 0xD7, 0xAA, 0x30, 0xFF, 0xCA, 0xFF, 0xCA, 0x99, 0x99, 0x99, 0x99, 0x90, 0x72, 0xAF, 0xFC,
+    0x0A, 0xFF, 0xC7, 0x76, 0xAF, 0xFC, 0x0A, 0xFF, 0xC7, 0x30, 0x49, 0xAA, 0x49, 0xD9, 0x4D, 0xA4,
+    0xE4, 0xAD, 0x94, 0xE4, 0x9D, 0x94, 0xE5, 0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0x9D, 0x95, 0xD9, 0x5D, 0xA5, 0xAD, 0x6A, 0xA4, 0x4A, 0xA6, 0xD9, 0x5E, 0x5A, 0xD5, 0x9D,
+    0x59, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x49, 0xD9, 0x4E, 0x49,
+    0xD9, 0x4E, 0x4A, 0xD4, 0x9D, 0x94, 0xAA, 0x94, 0x29, 0xE9, 0x0A, 0xAA, 0x1A, 0xFC, 0xAD, 0xA0,
+    0x9F, 0xAF, 0x90, 0xEA, 0x19, 0xE0, 0x9E, 0x29, 0xE0, 0xAE, 0x29, 0xDA, 0x0A, 0xDA, 0x2E, 0x90,
+    0xEA, 0x19, 0xE1, 0xAE, 0x09, 0xF1, 0x9F, 0xFA, 0x2A, 0xF9, 0xD9, 0x49, 0x96, 0x3A, 0xEA, 0x92,
+    0x9F, 0xE9, 0x09, 0xEA, 0x0A, 0xDA, 0x0E, 0x91, 0x9D, 0xA9, 0xE1, 0x9E, 0x9A, 0xFF, 0xA0, 0xAF,
+    0xCA, 0x92, 0xAD, 0x96, 0xAE, 0x39, 0x2F, 0xF2, 0x9F, 0xE4, 0x99, 0x99, 0x30, 0x3A, 0xEA, 0x3A,
+    0xFE, 0x19, 0xEA, 0xAE, 0xA0, 0xE9, 0x19, 0xE9, 0xE2, 0x9E, 0xAD, 0xA2, 0x9E, 0xAD, 0x92, 0xAF,
+    0xD9, 0x2E, 0x9A, 0xE1, 0xAE, 0x1F, 0xF9, 0x19, 0xFD, 0x59, 0x99, 0x40, 0x2A, 0xAA, 0x92, 0xAA,
+    0xA9, 0x2A, 0xE1, 0xF4, 0xE0, 0xAE, 0x5A, 0xFD, 0x69, 0xFC, 0x70, 0xF9, 0x7A, 0xF9, 0x6A, 0xFD,
+    0x59, 0xE0, 0xE9, 0x39, 0xE9, 0x0A, 0xE3, 0xEA, 0x19, 0xE7, 0x70, 0x29, 0xAE, 0xA9, 0x39, 0xFE,
+    0x92, 0x9C, 0x99, 0x9A, 0xE7, 0x0E, 0x95, 0x99, 0xE9, 0x19, 0xFF, 0x90, 0x9F, 0xAA, 0xE1, 0xE9,
+    0x1A, 0xDA, 0x1E, 0x19, 0xE2, 0xFF, 0x92, 0x9F, 0xD9, 0x59, 0x99, 0x50, 0x3E, 0x97, 0x0E, 0x71,
+    0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x99, 0xE9, 0x3F, 0xFC, 0x3F, 0xAA, 0xE9, 0x19, 0xE9, 0x1E, 0x91,
+    0xAE, 0x2E, 0x91, 0xE9, 0x2E, 0x2E, 0x29, 0xE1, 0x9E, 0x2A, 0xDA, 0x19, 0xDA, 0x2E, 0x91, 0xAD,
+    0x92, 0xE2, 0xE3, 0xE7, 0x60, 0x3E, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x92, 0xAA,
+    0xA9, 0x2E, 0x91, 0xEA, 0x3E, 0x1E, 0x93, 0x9E, 0x0E, 0x94, 0xAD, 0xAE, 0x95, 0xFD, 0xA6, 0xFE,
+    0x59, 0xE9, 0xAD, 0xA4, 0xAD, 0xA1, 0xE4, 0xE9, 0x1E, 0xA3, 0xE2, 0x9E, 0x77, 0x00, 0x3A, 0xDA,
+    0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x93, 0xE3, 0x9E, 0x3A, 0xDA, 0x3E, 0x93, 0xE4, 0xE3,
+    0x9E, 0x3A, 0xDA, 0x3E, 0x97, 0x20, 0x29, 0xAA, 0x09, 0xE2, 0xAD, 0xA3, 0xDA, 0xAF, 0xC0, 0xFC,
+    0xA2, 0xFA, 0xAF, 0xCA, 0xF1, 0x9E, 0x91, 0xF2, 0xE1, 0xAE, 0x2E, 0x91, 0x9E, 0x1E, 0x92, 0xE2,
+    0xAD, 0xA1, 0xE2, 0x9E, 0x2E, 0x91, 0xE2, 0xAD, 0xA2, 0xE1, 0x9D, 0xA2, 0xE9, 0x2E, 0x1A, 0xD9,
+    0x2E, 0x29, 0xDA, 0x1E, 0x91, 0x9E, 0x2A, 0xDA, 0x77, 0x30, 0x2A, 0xA9, 0x0A, 0xDA, 0x4D, 0xAF,
+    0xD2, 0x9F, 0xAA, 0xE2, 0xAE, 0x2E, 0x2E, 0xA2, 0xE2, 0xE2, 0x9E, 0x19, 0xE2, 0xAD, 0xA1, 0x9D,
+    0xA2, 0xAD, 0x91, 0xAD, 0x92, 0xE2, 0xE3, 0xE2, 0xE2, 0x9E, 0x76, 0x3A, 0xA9, 0x0A, 0xD9, 0x5D,
+    0xAF, 0xCA, 0x39, 0xF9, 0xF3, 0xAE, 0x2E, 0x3E, 0x92, 0xE3, 0xE3, 0xE2, 0x9E, 0x29, 0xE2, 0x9D,
+    0xA2, 0xEA, 0x2A, 0xE1, 0xAE, 0x3F, 0xFC, 0x93, 0xE9, 0xF9, 0x39, 0xDA, 0x19, 0x95, 0xAD, 0xA7,
+    0x1E, 0x97, 0x1E, 0x71, 0x9E, 0x71, 0x2A, 0xFA, 0x2F, 0xEA, 0x09, 0xE9, 0x99, 0xC1, 0xAE, 0x59,
+    0xF9, 0x4A, 0xFA, 0x49, 0xFA, 0x5A, 0xE0, 0x93, 0xAD, 0xA0, 0xAF, 0xE9, 0x0A, 0xFD, 0x93, 0x99,
+    0x94, 0x73, 0x9D, 0x5D, 0xA3, 0x9A, 0xEA, 0xA9, 0xAF, 0xE9, 0x9A, 0xEA, 0xAA, 0x19, 0xE4, 0xAD,
+    0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0x9E, 0x49, 0xFC, 0x92, 0xFC, 0x93, 0x99, 0x93, 0x77, 0x70, 0x9F,
+    0xDA, 0x97, 0x0F, 0xFD, 0x7F, 0xFD, 0x96, 0xFF, 0xE6, 0xAF, 0xC9, 0x29, 0x96, 0xFC, 0x74, 0x9F,
+    0x97, 0x4A, 0xF2, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xC2, 0xFF, 0xC9, 0x0F, 0xA1, 0x9F, 0xFC,
+    0x1F, 0xA1, 0xAF, 0xFC, 0x1F, 0xA1, 0xAE, 0xA6, 0xFC, 0x1F, 0x96, 0xFD, 0xAF, 0xA9, 0x99, 0x92,
+    0x9F, 0xFF, 0xDA, 0x3A, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0x97, 0x9F, 0xA9, 0x99, 0x97, 0x1F, 0x75,
+    0x9F, 0x75, 0xAF, 0xFA, 0x70, 0xFF, 0xCA, 0x70, 0xFF, 0xC9, 0x79, 0xFF, 0xC3, 0x74, 0x99, 0x29,
+    0x97, 0x3A, 0xD1, 0xDA, 0x73, 0xD9, 0x09, 0xD7, 0x19, 0xAF, 0xAE, 0x7A, 0xFF, 0xE9, 0x49, 0xFF,
+    0xFC, 0x93, 0xAF, 0xFF, 0xD3, 0xAF, 0xFA, 0x9A, 0xE9, 0x29, 0xFD, 0xAD, 0x1A, 0xDA, 0x3F, 0xD0,
+    0xDA, 0x1D, 0x93, 0xAF, 0xC1, 0xD9, 0x09, 0xD4, 0xFC, 0x90, 0xAD, 0x1D, 0xA3, 0x9F, 0xC1, 0xD9,
+    0x1D, 0x4A, 0xFA, 0x09, 0xD1, 0xAD, 0x4A, 0xF9, 0x0D, 0xA1, 0xD9, 0x4F, 0xC1, 0xD9, 0x09, 0xD5,
+    0xFC, 0x0A, 0xD1, 0xDA, 0x5F, 0xC0, 0xDA, 0x1D, 0x95, 0xFC, 0xAD, 0x1A, 0xD6, 0xAF, 0xDA, 0x1D,
+    0x96, 0x9F, 0xD9, 0x09, 0xD0, 0x9C, 0x5F, 0xFF, 0xD6, 0xFF, 0xFC, 0x69, 0xFF, 0xF7, 0xFF, 0xDA,
+    0x97, 0xD9, 0x0A, 0xD9, 0x72, 0xAD, 0x1D, 0xA7, 0x3D, 0xA1, 0xD9, 0x71, 0x77, 0x73, 0x9F, 0xEA,
+    0x97, 0x9F, 0xFF, 0x94, 0xAF, 0xFF, 0xC4, 0xFF, 0xFD, 0xA3, 0xAF, 0xD9, 0x29, 0xAD, 0x39, 0xFC,
+    0xA7, 0x93, 0xFD, 0x74, 0x9F, 0xC7, 0x5A, 0xFA, 0x75, 0xFC, 0x29, 0xAA, 0x91, 0xAC, 0x91, 0x9F,
+    0xC2, 0xE9, 0x0E, 0x91, 0xAF, 0xA2, 0xE9, 0xF2, 0xAF, 0x91, 0x9F, 0xF2, 0xFC, 0x91, 0xAF, 0xA9,
+    0x09, 0x2F, 0xC2, 0xAF, 0x6F, 0xC2, 0xF9, 0x6F, 0xC9, 0x1F, 0x7A, 0xFA, 0x09, 0xF7, 0x9F, 0xC0,
+    0xAE, 0xA7, 0x0F, 0xFD, 0xA9, 0xAC, 0x5A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC7, 0xFF, 0xF7, 0x0A, 0xFF,
+    0xA9, 0x73, 0x99, 0x97, 0x10, 0x59, 0xFF, 0xF9, 0x5F, 0xFF, 0xC9, 0x5F, 0xFF, 0xC6, 0xFF, 0xFC,
+    0x59, 0xFA, 0x99, 0x99, 0x99, 0x99, 0x5A, 0xF9, 0x75, 0xFC, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x5A,
+    0xFA, 0x75, 0xAF, 0xFF, 0x6F, 0xFF, 0xA6, 0xFF, 0xFA, 0x59, 0xFF, 0xF9, 0x5A, 0xF9, 0x75, 0xFC,
+    0x76, 0xFC, 0x73, 0xAF, 0xFE, 0x7F, 0xFF, 0x7A, 0xAF, 0xDA, 0xAA, 0x97, 0x1F, 0xC7, 0x6F, 0xC7,
+    0x59, 0xFA, 0x75, 0x9F, 0x97, 0x40, 0x77, 0x77, 0x09, 0xFD, 0xA9, 0x73, 0xFF, 0xE7, 0x1F, 0xFE,
+    0xA7, 0x0A, 0xFF, 0xE7, 0x1F, 0xCA, 0x29, 0xAA, 0x70, 0x9F, 0xC7, 0x7A, 0xF9, 0x77, 0xFC, 0x75,
+    0x99, 0x9F, 0xCA, 0x99, 0x99, 0x96, 0x9F, 0xFF, 0xC9, 0x6A, 0xFF, 0xFC, 0x97, 0x99, 0xFC, 0xA9,
+    0x99, 0x99, 0x72, 0xFC, 0x75, 0xAA, 0xAF, 0xCA, 0xAA, 0xAA, 0x96, 0x9F, 0xFF, 0xC9, 0x6A, 0xFF,
+    0xFC, 0x72, 0xFC, 0x97, 0x7F, 0xC7, 0x7F, 0xC7, 0x69, 0xFC, 0x97, 0x5A, 0xFF, 0xFE, 0xA4, 0xAF,
+    0xFF, 0xE9, 0x4F, 0xFF, 0xF9, 0x4F, 0xFF, 0xF4, 0x77, 0x77, 0x77, 0x1E, 0x97, 0x77, 0xAD, 0xA7,
+    0x77, 0x9E, 0x77, 0x19, 0xA9, 0x3E, 0xAA, 0x99, 0x6A, 0xE1, 0xAF, 0xCA, 0x0A, 0xFF, 0x5F, 0x0A,
+    0xFE, 0xAF, 0xFC, 0xA4, 0xFA, 0xFF, 0xFF, 0xE3, 0x9F, 0xE9, 0xAF, 0xFA, 0xAF, 0xC9, 0x2A, 0xFC,
+    0xA2, 0xFE, 0x2A, 0xF9, 0x2A, 0xFC, 0x3A, 0xFC, 0x39, 0xF9, 0x2F, 0xC9, 0x3F, 0xCA, 0x3A, 0xF9,
+    0x2F, 0xC4, 0xFC, 0x4F, 0xC2, 0x9F, 0xA4, 0xFC, 0x4F, 0xC2, 0xAF, 0x93, 0xAF, 0xA4, 0xFA, 0x2F,
+    0xC4, 0xFC, 0x93, 0x9F, 0x92, 0xFC, 0x3F, 0xD4, 0xAF, 0x92, 0xFA, 0x2A, 0xFD, 0x4F, 0xC2, 0x9F,
+    0x92, 0xFD, 0xA4, 0xFC, 0x2A, 0xF2, 0xFE, 0x94, 0xFA, 0x2F, 0xC1, 0x9F, 0xE9, 0x39, 0xF9, 0x2F,
+    0xC1, 0xFF, 0x4A, 0xF2, 0x9F, 0xA0, 0xEA, 0xFC, 0x4F, 0xC7, 0x09, 0xE7, 0x77, 0x0E, 0x77, 0x70,
+    0xEA, 0x77, 0x70, 0xAA, 0xA7, 0x74, 0x49, 0xFA, 0x4A, 0xDA, 0x5A, 0xFC, 0x4E, 0xA5, 0xFD, 0x4E,
+    0xA5, 0xFD, 0x39, 0xE9, 0x49, 0xFD, 0x3A, 0xE5, 0x9F, 0xD9, 0x2F, 0x5A, 0xEA, 0xD9, 0x2E, 0xA5,
+    0xEA, 0xAD, 0x91, 0x9E, 0x93, 0xAA, 0xFF, 0xAA, 0xFA, 0xA2, 0xFF, 0xFF, 0xD1, 0x9F, 0xFF, 0xFC,
+    0xA3, 0xAE, 0x09, 0xE1, 0xEA, 0x5E, 0xA0, 0x9E, 0x09, 0xE9, 0x3A, 0xAF, 0xAF, 0xAF, 0xCA, 0x2F,
+    0xFF, 0xFD, 0x19, 0xFF, 0xFF, 0xC9, 0x3F, 0x2E, 0x0E, 0xA5, 0xEA, 0x2E, 0x9E, 0x95, 0xE9, 0x2E,
+    0xAE, 0x59, 0xE3, 0xAF, 0xD5, 0xAE, 0x3A, 0xFC, 0xA5, 0xF3, 0xAF, 0xC9, 0x5E, 0xA3, 0x9F, 0xC9,
+    0x49, 0xE9, 0x39, 0xFC, 0x50, 0x5F, 0xDA, 0xA9, 0x77, 0x29, 0xFF, 0xD9, 0x77, 0x09, 0xFF, 0xE9,
+    0x77, 0xAF, 0xFF, 0x77, 0xFC, 0x99, 0xAF, 0xC9, 0x76, 0xFA, 0x29, 0xFA, 0x75, 0x9F, 0x93, 0xFC,
+    0x2A, 0xAA, 0x7A, 0xF4, 0xFC, 0x19, 0xE7, 0xFC, 0x39, 0xFA, 0x1E, 0xA7, 0xFA, 0x3A, 0xF9, 0x09,
+    0xE9, 0x7F, 0x92, 0xAF, 0xC0, 0x9F, 0xF3, 0x9F, 0xAA, 0xAF, 0xDA, 0xAF, 0xFC, 0x3A, 0xFF, 0xFC,
+    0x9F, 0xFC, 0xA3, 0xFF, 0xFA, 0x09, 0xAF, 0xCA, 0xAA, 0x93, 0xFF, 0xDA, 0x93, 0xF9, 0x69, 0xFA,
+    0xAA, 0x99, 0x59, 0xF7, 0x9F, 0x72, 0xAF, 0x7A, 0xF7, 0x2A, 0xEA, 0x7F, 0xC7, 0x2F, 0x97, 0xFA,
+    0x72, 0xF9, 0x69, 0xF9, 0x72, 0xFC, 0x99, 0xC3, 0xAF, 0x73, 0xFF, 0x3A, 0xF7, 0x3A, 0xFE, 0x3F,
+    0xA7, 0x4A, 0xFC, 0xA7, 0x77, 0x99, 0x94, 0x49, 0xFD, 0xA9, 0x77, 0x5F, 0xFD, 0xA7, 0x73, 0xFF,
+    0xEA, 0x77, 0x2F, 0xFF, 0x97, 0x70, 0x9F, 0xA9, 0xAF, 0xCA, 0x77, 0x0A, 0xF2, 0x9F, 0xC4, 0x9A,
+    0x99, 0x7F, 0xC3, 0xFC, 0x19, 0xFF, 0x94, 0xFC, 0x3F, 0xC0, 0x9F, 0xFD, 0x39, 0xFA, 0x29, 0xFC,
+    0x0F, 0xFD, 0x93, 0x9F, 0x92, 0xFC, 0xA9, 0xFA, 0x19, 0xD4, 0xAF, 0x99, 0xAF, 0xD0, 0xAF, 0x72,
+    0xFF, 0xFC, 0x90, 0xAF, 0x72, 0xFF, 0xFA, 0x1A, 0xFC, 0x70, 0x9F, 0xFE, 0x93, 0xFD, 0xA6, 0xAF,
+    0xFD, 0xA4, 0x9F, 0xE5, 0xFC, 0x1F, 0xC5, 0x9F, 0xDA, 0x4F, 0xC1, 0xAF, 0x7F, 0xD4, 0xFA, 0x1A,
+    0xF9, 0x7F, 0xC9, 0x29, 0xF9, 0x19, 0xF9, 0x79, 0xF9, 0x2A, 0xF9, 0x2F, 0xA0, 0x95, 0x9F, 0x3F,
+    0xC3, 0xFC, 0x0A, 0xD9, 0x99, 0xAF, 0xC3, 0xFC, 0x3F, 0xC0, 0xAF, 0xFD, 0x93, 0xFA, 0x3A, 0xF9,
+    0xAF, 0xFC, 0xA3, 0x9F, 0x93, 0x9F, 0xA0, 0xAF, 0xE9, 0x77, 0x70, 0x99, 0x97, 0x29, 0xE5, 0xEA,
+    0x4A, 0xE3, 0x9E, 0x4A, 0xF4, 0xEA, 0x39, 0xE4, 0xFC, 0x39, 0xE9, 0x39, 0xE3, 0x9F, 0xC3, 0xF4,
+    0xAE, 0x3F, 0xCA, 0x3E, 0xA4, 0xAE, 0x3F, 0xCA, 0x2A, 0xE5, 0xAE, 0x2A, 0xDA, 0xDA, 0x2F, 0x5A,
+    0xE2, 0xE9, 0xDA, 0x2E, 0x95, 0xAE, 0x19, 0xE9, 0xDA, 0x1A, 0xE6, 0xF1, 0xAD, 0x9A, 0xD9, 0x1E,
+    0xA6, 0xEA, 0x1E, 0x9A, 0xD9, 0x09, 0xE9, 0x4F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFE, 0x39, 0x9E,
+    0xA9, 0xE9, 0x9E, 0xAA, 0xE9, 0x99, 0x5E, 0x9A, 0xDA, 0x1E, 0x0A, 0xE7, 0x0E, 0x9E, 0x91, 0xE0,
+    0xEA, 0x70, 0xE9, 0xE2, 0xE9, 0xE7, 0x1E, 0xAD, 0xA2, 0xEA, 0xE7, 0x09, 0xFD, 0x3F, 0xD9, 0x70,
+    0x9F, 0xD3, 0xFD, 0x71, 0x9F, 0xC9, 0x3F, 0xCA, 0x71, 0x9F, 0xC4, 0xFC, 0x97, 0x19, 0xFA, 0x4F,
+    0xC7, 0x2A, 0xF5, 0xFA, 0x70, 0x4A, 0xFF, 0xAA, 0x69, 0xEA, 0x4F, 0xFF, 0xA4, 0xAE, 0xA3, 0x9F,
+    0xFF, 0xCA, 0x3A, 0xE9, 0x3A, 0xFF, 0xFD, 0x92, 0xF4, 0xAE, 0x95, 0xFA, 0x2F, 0x4F, 0x69, 0xF1,
+    0x9F, 0x4F, 0x1A, 0xAA, 0xA1, 0xF1, 0xAE, 0xA3, 0x9F, 0x1F, 0x1F, 0x1F, 0x93, 0xAE, 0xA0, 0x9F,
+    0x1F, 0x1F, 0x4F, 0x90, 0xAE, 0xA0, 0x9F, 0x1F, 0x4F, 0x1F, 0x90, 0xAE, 0xA0, 0x9E, 0xA4, 0xF1,
+    0xF1, 0xF9, 0x0A, 0xEA, 0x39, 0xEA, 0x09, 0xF1, 0xF1, 0xF9, 0x3A, 0xEA, 0x09, 0xEA, 0x09, 0xF1,
+    0xF4, 0xF9, 0x0A, 0xEA, 0x09, 0xEA, 0x09, 0xF4, 0xF1, 0xF9, 0x0A, 0xEA, 0x0A, 0xEA, 0x39, 0xF1,
+    0xF1, 0xF9, 0x0F, 0x93, 0xAE, 0xA0, 0x9F, 0x1F, 0x1F, 0x4A, 0xE9, 0x0A, 0xEA, 0x6A, 0xEA, 0x4F,
+    0x1F, 0x95, 0xAF, 0x5F, 0x1F, 0xAA, 0xAA, 0xAA, 0xFC, 0xA4, 0x9F, 0x1F, 0xFF, 0xE5, 0xAE, 0xA0,
+    0x9F, 0xFF, 0xCA, 0x6F, 0x90, 0xAF, 0xFE, 0xA7, 0x00, 0x77, 0x99, 0x99, 0x77, 0x19, 0xFA, 0x77,
+    0x0A, 0xF9, 0x73, 0x9A, 0xAA, 0xAF, 0xDA, 0x97, 0x1F, 0xFF, 0x97, 0x1F, 0xFF, 0x72, 0xAA, 0xAA,
+    0xAF, 0xAA, 0xA7, 0x6A, 0xF9, 0x72, 0x9A, 0x92, 0xAF, 0x71, 0xAF, 0xCA, 0x0F, 0xC7, 0x0F, 0xFA,
+    0xFA, 0x7F, 0xFF, 0xD9, 0x6A, 0xFD, 0x9A, 0xFD, 0x7F, 0xCA, 0x29, 0xFC, 0x6A, 0xFA, 0x4F, 0xC6,
+    0xFC, 0x5F, 0xA6, 0xFC, 0x5F, 0x95, 0x9F, 0xA4, 0x9F, 0x69, 0xFA, 0x4A, 0xF6, 0xAF, 0x94, 0xFA,
+    0x69, 0xFA, 0x3A, 0xFA, 0x69, 0xFC, 0x29, 0xFC, 0x97, 0xFD, 0xAF, 0xE7, 0x0F, 0xFF, 0xD7, 0x1F,
+    0xF9, 0xEA, 0x72, 0xFC, 0xA1, 0xE9, 0x74, 0x99, 0x77, 0x77, 0x77, 0x74, 0x9F, 0xFF, 0xC7, 0x0A,
+    0xFF, 0xFC, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x71, 0x77, 0x77, 0xAF, 0xD9, 0x72, 0xAF,
+    0xFD, 0x70, 0xFF, 0xEA, 0x7A, 0xFF, 0xE7, 0x9F, 0xCA, 0x29, 0xCA, 0x7F, 0xC9, 0x75, 0xAF, 0xA7,
+    0x6F, 0xC7, 0x49, 0x9A, 0xFC, 0x99, 0x99, 0x97, 0xFF, 0xFC, 0x7F, 0xFF, 0xC7, 0x9A, 0xFC, 0x99,
+    0x99, 0x99, 0x70, 0xAF, 0x97, 0x4A, 0xAF, 0xDA, 0xAA, 0xA7, 0x0F, 0xFF, 0x70, 0xFF, 0xEA, 0x72,
+    0xFC, 0x77, 0xFC, 0x77, 0xAF, 0x97, 0x69, 0xFC, 0x93, 0x9A, 0x70, 0xFF, 0xF7, 0x0A, 0xFF, 0xE7,
+    0x1F, 0xFE, 0x72, 0x9F, 0xF9, 0x75, 0x99, 0x97, 0x00, 0x5F, 0xA4, 0xAF, 0xC5, 0x9F, 0xA3, 0x9F,
+    0xC9, 0x5A, 0xF9, 0x3F, 0xCA, 0x6F, 0xC3, 0xAF, 0xC7, 0xFC, 0x29, 0xFC, 0x70, 0xFA, 0x2F, 0xC9,
+    0x79, 0xFA, 0x1F, 0xCA, 0x70, 0xAF, 0x90, 0xAF, 0xC7, 0x1F, 0xC1, 0xFC, 0x72, 0xFC, 0x0F, 0xC9,
+    0x79, 0x9A, 0xFC, 0xAF, 0xC9, 0x99, 0x5F, 0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0x49, 0xFF, 0xFF, 0xA7,
+    0xFD, 0xAF, 0xA7, 0x19, 0xFA, 0x1F, 0xC7, 0x1A, 0xF9, 0x1F, 0xC7, 0x1F, 0xC2, 0xAF, 0xA7, 0x0F,
+    0xC2, 0x9F, 0xC7, 0x0F, 0xC3, 0xFC, 0x79, 0xFA, 0x3F, 0xC9, 0x6A, 0xF9, 0x3A, 0xFC, 0x6F, 0xC4,
+    0x9F, 0xC6, 0xFC, 0x5F, 0xC9, 0x40, 0x19, 0xFF, 0xFF, 0x2A, 0xFF, 0xFF, 0x2F, 0xFF, 0xFA, 0x2F,
+    0xFF, 0xF9, 0x29, 0x99, 0x99, 0xFC, 0xA9, 0x99, 0x99, 0x70, 0xFC, 0x76, 0xFC, 0x0A, 0xC9, 0x72,
+    0xFF, 0xA7, 0x19, 0xFE, 0x97, 0x2A, 0xFC, 0xA7, 0x4F, 0xC9, 0x74, 0xAF, 0xC1, 0x97, 0x09, 0xFD,
+    0xA0, 0xAC, 0x96, 0xAF, 0xFE, 0xA5, 0x9D, 0xAF, 0xF9, 0x7A, 0x90, 0xFD, 0xA7, 0x4F, 0xC7, 0x5F,
+    0xCA, 0x73, 0xAF, 0xD9, 0x71, 0x9F, 0xF7, 0x29, 0xD9, 0xFC, 0x73, 0xA1, 0xFC, 0x75, 0x9F, 0xA7,
+    0x5A, 0xF9, 0x72, 0x77, 0x77, 0x29, 0xAF, 0xFA, 0x77, 0x4F, 0xFF, 0xD7, 0x72, 0xFF, 0xFE, 0x97,
+    0x70, 0x9F, 0xFF, 0xE9, 0x77, 0x0C, 0xA9, 0x49, 0xAF, 0xD7, 0x77, 0x29, 0xFD, 0x77, 0x19, 0xF9,
+    0x29, 0xFC, 0x77, 0x1A, 0xF4, 0xAF, 0x97, 0x70, 0xFC, 0x49, 0xFA, 0x77, 0x0F, 0xA5, 0xFA, 0x77,
+    0x9F, 0x95, 0xFC, 0x77, 0xAF, 0x95, 0xFA, 0x77, 0xFC, 0x59, 0xFA, 0x49, 0x99, 0x7F, 0xC5, 0xAF,
+    0x92, 0xAF, 0xD9, 0x4F, 0xA5, 0xFC, 0x19, 0xFF, 0xCA, 0x29, 0xF9, 0x49, 0xFC, 0x1F, 0xCA, 0xAF,
+    0x2A, 0xF5, 0xFC, 0xA0, 0x9F, 0x2A, 0xE9, 0x1F, 0xC4, 0xAF, 0xC1, 0xF9, 0x29, 0xEA, 0x1F, 0xC3,
+    0xAF, 0xC9, 0x1F, 0x4E, 0xA1, 0xFA, 0x1A, 0xFD, 0xA1, 0x9F, 0x39, 0xE9, 0x09, 0xFF, 0xFD, 0x2A,
+    0xF3, 0xF1, 0xAF, 0xFF, 0xA3, 0xFD, 0xAA, 0xFC, 0x1F, 0xFF, 0x94, 0xFF, 0xF2, 0xFF, 0xA9, 0x7F,
+    0xAF, 0xCA, 0x77, 0x49, 0xEA, 0x19, 0x97, 0x77, 0xAE, 0xA7, 0x77, 0x3F, 0x97, 0x77, 0x3F, 0x77,
+    0x74, 0xF7, 0x77, 0x39, 0xEA, 0x77, 0x73, 0xAE, 0xA7, 0x77, 0x3F, 0x97, 0x20, 0x77, 0x77, 0x2A,
+    0xFC, 0x97, 0x49, 0xFF, 0xA7, 0x3F, 0xFD, 0x72, 0xAF, 0xCA, 0xFA, 0x71, 0xFC, 0x19, 0xEA, 0x70,
+    0x9F, 0xA1, 0x9E, 0xA7, 0x0A, 0xF9, 0x1A, 0xEA, 0x70, 0xAF, 0x91, 0xF9, 0x70, 0xAF, 0x90, 0x9F,
+    0x71, 0x9F, 0x90, 0xF9, 0x71, 0x9F, 0xA9, 0xF7, 0x3F, 0xFC, 0x74, 0xFF, 0x97, 0x4A, 0xFD, 0xA7,
+    0x59, 0xFC, 0xA7, 0x2A, 0x92, 0xFC, 0x97, 0x19, 0xCA, 0x2F, 0xCA, 0x71, 0xE1, 0xFE, 0x70, 0xF9,
+    0xFF, 0x7A, 0xFF, 0xFC, 0x95, 0x9F, 0xF0, 0x9F, 0xA5, 0xE9, 0xF9, 0x09, 0xFA, 0x4E, 0xA0, 0x9D,
+    0xA2, 0xFC, 0x3A, 0xE2, 0xCA, 0x3F, 0xC7, 0x29, 0x4F, 0xC7, 0x70, 0xFC, 0x77, 0x9F, 0xA7, 0x7F,
+    0xC9, 0x74, 0xFF, 0x75, 0xFE, 0xA7, 0x5F, 0xDA, 0x76, 0xFA, 0x96, 0x4A, 0xFD, 0xAA, 0x97, 0x2F,
+    0xFE, 0x70, 0x9F, 0xFF, 0x79, 0xFF, 0xFA, 0x6A, 0xF1, 0x9A, 0xFC, 0x49, 0x9F, 0xC9, 0x99, 0x9F,
+    0xC9, 0x92, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xCA, 0x3A, 0xF4, 0xFC, 0x5F, 0xC4, 0xFC, 0x3F, 0xFF,
+    0xFD, 0x2F, 0xFF, 0xFD, 0x3A, 0xF9, 0x2F, 0xCA, 0x5A, 0xFA, 0x9A, 0xFD, 0x6F, 0xFF, 0xC9, 0x6F,
+    0xFF, 0x70, 0xFF, 0xD9, 0x70, 0x9F, 0xAA, 0xA9, 0x73, 0xAF, 0x77, 0xFC, 0x77, 0xFA, 0x76, 0x9F,
+    0x97, 0x6A, 0xF9, 0x76, 0xAF, 0x77, 0x74, 0x9A, 0xA7, 0x72, 0xE7, 0x69, 0xAF, 0xEA, 0x97, 0x09,
+    0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xF4, 0xAF, 0xFD, 0x09, 0xAD, 0x93, 0x9F, 0xD9,
+    0x9D, 0xA3, 0x94, 0xFD, 0x1A, 0xD9, 0x70, 0xAF, 0xC2, 0xAD, 0x71, 0xFC, 0xA2, 0xE7, 0x09, 0xFC,
+    0x3D, 0xA7, 0x0A, 0xFA, 0x29, 0xDA, 0x99, 0x99, 0x99, 0x91, 0xFC, 0x92, 0xAF, 0xFC, 0xA1, 0xFC,
+    0x92, 0xFF, 0xD9, 0x1F, 0xC3, 0xFF, 0xD2, 0xFC, 0x3E, 0xAA, 0xFC, 0x2F, 0xC2, 0x9D, 0x91, 0xFA,
+    0x2F, 0xC2, 0xAD, 0x19, 0xFA, 0x2F, 0xC9, 0x1E, 0x1A, 0xF9, 0x2A, 0xFC, 0x1E, 0x1F, 0xC3, 0x9F,
+    0xDA, 0xDA, 0x09, 0xFC, 0x4F, 0xFF, 0xFA, 0x5F, 0xFF, 0xE9, 0x6F, 0xFF, 0xD7, 0x09, 0xFF, 0xCA,
+    0xA7, 0x39, 0xDA, 0x97, 0x70, 0xAD, 0x97, 0x71, 0x9A, 0xA7, 0x30, 0x73, 0xFC, 0xA7, 0x7A, 0xFD,
+    0x77, 0xFE, 0x76, 0xAF, 0xE7, 0x6F, 0xF7, 0x5A, 0xFF, 0x75, 0xF9, 0xF9, 0x73, 0xAF, 0x0F, 0x97,
+    0x3F, 0xA0, 0xFA, 0x6F, 0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0xEA, 0x2A, 0xAA, 0xFC, 0xAA, 0xAF, 0xCA,
+    0xAA, 0x6F, 0xC2, 0xAF, 0x70, 0xAF, 0x92, 0xAF, 0x5F, 0xFF, 0xFE, 0xA2, 0xFF, 0xFF, 0xEA, 0x29,
+    0xAF, 0xC9, 0x99, 0x99, 0xAF, 0xA9, 0x4A, 0xF9, 0x49, 0xF9, 0x5F, 0xC6, 0xF9, 0x4A, 0xF9, 0x6F,
+    0xA4, 0xFC, 0x7F, 0xA3, 0xAF, 0x97, 0xFC, 0x3F, 0xC7, 0x0F, 0xC2, 0xFC, 0x97, 0x0F, 0xC2, 0x77,
+    0x72, 0x9F, 0xDA, 0x97, 0x0F, 0xFE, 0xA7, 0xFF, 0xFA, 0x6A, 0xFF, 0xF7, 0xDA, 0x91, 0x9F, 0xC9,
+    0x69, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xF9, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFC, 0xA9,
+    0x0A, 0xFF, 0xFF, 0xC9, 0x0A, 0xFF, 0xFF, 0xC5, 0xAF, 0xFC, 0xA7, 0xFF, 0xCA, 0x59, 0xAA, 0xFF,
+    0xDA, 0xAA, 0xAA, 0x90, 0xAF, 0xFF, 0xFC, 0x90, 0xAF, 0xFF, 0xFC, 0x29, 0xFA, 0x75, 0xAF, 0x76,
+    0xAF, 0x97, 0x5A, 0xFC, 0x49, 0xAC, 0x95, 0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0x96, 0xFF, 0xF9, 0x79,
+    0xFF, 0xA7, 0x49, 0x99, 0x71, 0x74, 0x99, 0x77, 0x0E, 0x74, 0x9A, 0xFE, 0x97, 0x9F, 0xFF, 0x94,
+    0xFF, 0xFD, 0x93, 0xFF, 0xFE, 0x3A, 0xFD, 0x9E, 0x0A, 0xD9, 0x29, 0xFC, 0xA1, 0xDA, 0x29, 0x3F,
+    0xCA, 0x19, 0xDA, 0x69, 0xFC, 0x2A, 0xD9, 0x6F, 0xC9, 0x2E, 0x7F, 0xC3, 0xE6, 0x9F, 0xA3, 0xDA,
+    0x6A, 0xF9, 0x29, 0xD9, 0x6F, 0xC9, 0x2A, 0xD9, 0x6F, 0xC3, 0xE7, 0xFC, 0x3E, 0x7F, 0xC2, 0x9D,
+    0xA7, 0xFC, 0x2A, 0xD9, 0x7F, 0xC9, 0x1A, 0xD7, 0x0A, 0xFC, 0x1E, 0x71, 0xFD, 0x9E, 0x09, 0xAC,
+    0x5A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC7, 0xFF, 0xF7, 0x0A, 0xFF, 0xA9, 0x72, 0x9E, 0x77, 0x9D, 0xA7,
+    0x79, 0xAA, 0x72, 0x77, 0x76, 0xE9, 0x4E, 0x72, 0xAE, 0x4A, 0xE7, 0x2F, 0x4F, 0x71, 0xAF, 0x3F,
+    0xA7, 0xAF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xC1, 0x9F, 0xFF, 0xFF, 0xA2, 0xAA, 0xFC, 0xAA, 0xAA,
+    0xFC, 0xAA, 0xAA, 0x5F, 0xA2, 0x9F, 0xA7, 0x09, 0xF9, 0x2A, 0xF9, 0x70, 0xAF, 0x92, 0xFC, 0x71,
+    0xFC, 0x3F, 0xC7, 0x1F, 0xC3, 0xFA, 0x70, 0x9F, 0xA2, 0x9F, 0x97, 0x09, 0xF9, 0x2A, 0xF9, 0x70,
+    0xAF, 0x3F, 0xC7, 0x1F, 0xC3, 0xFC, 0x71, 0xFC, 0x3F, 0xC7, 0x09, 0xFA, 0x3F, 0xDA, 0xD4, 0xAF,
+    0x93, 0xFF, 0xC4, 0xAF, 0x4A, 0xFF, 0x4F, 0xC5, 0xAF, 0xDA, 0x77, 0x19, 0x99, 0x60, 0x77, 0x77,
+    0x6A, 0xFD, 0xA9, 0x75, 0xAF, 0xFE, 0x73, 0xAF, 0xFF, 0x72, 0x9F, 0xFF, 0x97, 0x2F, 0xD9, 0x29,
+    0xD7, 0x3F, 0xC7, 0x72, 0x9F, 0xC7, 0x72, 0x9F, 0xC7, 0x73, 0xFC, 0x97, 0x72, 0xFD, 0x97, 0x71,
+    0x9F, 0xDA, 0x77, 0x1A, 0xFE, 0x77, 0x1A, 0xFE, 0x77, 0x1A, 0xFE, 0x77, 0x19, 0xFD, 0x77, 0x3F,
+    0xC9, 0x39, 0xAA, 0x91, 0x9A, 0xA1, 0x9A, 0xA1, 0xFA, 0x3F, 0xA9, 0xEA, 0xAE, 0xA0, 0xFA, 0x2A,
+    0xC9, 0xFA, 0xFA, 0xE0, 0xF9, 0x2A, 0xC9, 0xE9, 0x0E, 0x90, 0xE9, 0xF3, 0x9F, 0xC1, 0xE1, 0xFE,
+    0xA4, 0xFD, 0xAD, 0xA0, 0x9F, 0xE6, 0xFF, 0xFF, 0xA7, 0xAD, 0xAF, 0xFD, 0xA9, 0x70, 0xE1, 0xAD,
+    0x99, 0xE7, 0x3E, 0x1E, 0x1E, 0x73, 0xAA, 0x91, 0xAA, 0x91, 0xAA, 0x97, 0x10, 0x19, 0xFF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xEA, 0x1F, 0xFF, 0xF9, 0x1F, 0xFF, 0xF2, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x77, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFF, 0x2F, 0xFF,
+    0xF1, 0x9F, 0xFF, 0xF1, 0xAF, 0xFF, 0xEA, 0x7F, 0xC7, 0x49, 0xFA, 0x74, 0xAF, 0x97, 0x4F, 0xC7,
+    0x5F, 0xC7, 0x49, 0xFC, 0x74, 0x9F, 0xA7, 0x4A, 0xF9, 0x74, 0xFC, 0x75, 0xFC, 0x74, 0x9F, 0xC7,
+    0x49, 0xFA, 0x74, 0xAF, 0x97, 0x10, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xD2, 0x9F, 0xFA, 0xAA, 0xAA,
+    0x92, 0x9A, 0xAF, 0xE7, 0x4F, 0xC9, 0x73, 0xAF, 0xA5, 0x9F, 0xFF, 0xCA, 0x2A, 0xFF, 0xFC, 0x93,
+    0x99, 0x99, 0x9A, 0xFA, 0x99, 0x71, 0xFC, 0x71, 0x9A, 0xFC, 0xA6, 0xFF, 0xD6, 0x9F, 0xFA, 0x7A,
+    0xFC, 0xA9, 0x71, 0x9F, 0xA7, 0x4F, 0xC7, 0x4A, 0xFA, 0x74, 0xFC, 0x74, 0xAF, 0xA7, 0x4F, 0xC7,
+    0x4A, 0xF9, 0x73, 0x9F, 0xC7, 0x4F, 0xC9, 0x73, 0x9F, 0xC7, 0x5A, 0xEA, 0x75, 0xFA, 0x74, 0x9F,
+    0x97, 0x4A, 0xF2, 0x9A, 0xA7, 0xAF, 0xAF, 0xA7, 0xFF, 0xD9, 0x49, 0xAF, 0xFA, 0x96, 0xFE, 0xA7,
+    0x19, 0xFE, 0x29, 0xAA, 0x49, 0x90, 0xFC, 0xAF, 0xA7, 0xFF, 0xD9, 0x49, 0xAF, 0xFA, 0x96, 0xFE,
+    0xA7, 0x19, 0xFE, 0x72, 0x99, 0x0F, 0xC4, 0xAF, 0x3F, 0xA4, 0xFA, 0x29, 0xF9, 0x39, 0xF9, 0x2A,
+    0xF4, 0xFC, 0x3F, 0xC3, 0xFC, 0xA3, 0xFC, 0x1A, 0xFD, 0x4F, 0xFF, 0xC4, 0x9F, 0xFF, 0x5A, 0xFF,
+    0xDA, 0x6F, 0xFC, 0xA7, 0x29, 0x99, 0x97, 0x30, 0x77, 0x69, 0xF7, 0x69, 0xFD, 0x75, 0xE0, 0x9D,
+    0xA7, 0x39, 0xD9, 0x1E, 0x73, 0xAD, 0x91, 0xDA, 0x73, 0xF9, 0x9D, 0xA7, 0x3A, 0xFF, 0xFF, 0xC9,
+    0x19, 0xFF, 0xFF, 0xD9, 0x1F, 0xFF, 0xFE, 0x2A, 0xFF, 0xFF, 0xC9, 0x4D, 0xA7, 0x9E, 0x93, 0x9D,
+    0x97, 0x1D, 0x93, 0xAD, 0x1A, 0xC1, 0xC9, 0x2D, 0x93, 0xE0, 0xEA, 0xE1, 0x9D, 0x4F, 0xFE, 0xA9,
+    0xE4, 0xFC, 0x9E, 0xAF, 0xC5, 0xEA, 0x1A, 0xA1, 0xAD, 0xA4, 0x9F, 0x76, 0xAF, 0xC9, 0x75, 0xFE,
+    0x93, 0x99, 0x69, 0xA0, 0xAF, 0xFC, 0x97, 0x2F, 0xFC, 0x73, 0x9F, 0xF7, 0x49, 0xFD, 0xA7, 0x70,
+    0x97, 0x10, 0x76, 0xAE, 0xA7, 0x75, 0xFA, 0x77, 0x5F, 0xA7, 0x74, 0x9F, 0x97, 0x74, 0xAF, 0x77,
+    0x5F, 0xC7, 0x75, 0xFA, 0x77, 0x09, 0xAF, 0xFD, 0xA7, 0x3A, 0xFF, 0xFE, 0xA7, 0x0F, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xFF, 0x94, 0xFD, 0xA1, 0xFA, 0x09, 0xFD, 0x39, 0xFC, 0x29, 0xF9, 0x2F, 0xC3, 0xFC,
+    0x92, 0x9F, 0x3A, 0xF9, 0x2F, 0xC3, 0xAF, 0x3A, 0xF9, 0x19, 0xF9, 0x3F, 0xA3, 0xAF, 0x2A, 0xF9,
+    0x3F, 0x93, 0xFC, 0x2F, 0xC3, 0x9F, 0x93, 0xFC, 0x2F, 0xC3, 0x9F, 0x4F, 0xA2, 0xFA, 0x74, 0x9F,
+    0x91, 0x9F, 0x97, 0x4A, 0xF2, 0xAF, 0x75, 0xFC, 0x2F, 0xC7, 0x5F, 0xC2, 0xFC, 0x75, 0xFA, 0x10,
+    0x6A, 0xFE, 0xAA, 0x72, 0xFF, 0xEA, 0x70, 0xFF, 0xFA, 0x69, 0xFF, 0xFC, 0x95, 0xAF, 0x99, 0x9A,
+    0xFC, 0xA5, 0xFC, 0x39, 0xFC, 0x5F, 0xC4, 0xFC, 0x49, 0xFA, 0x4F, 0xA4, 0x9F, 0x93, 0x9F, 0xA4,
+    0xAF, 0x4F, 0xC9, 0x4F, 0xC2, 0x9F, 0xD2, 0x9F, 0xFF, 0xF9, 0x2A, 0xFF, 0xFE, 0x93, 0xFF, 0xFE,
+    0x94, 0xFF, 0xFC, 0x97, 0x9F, 0xC7, 0x7F, 0xA7, 0x59, 0xAF, 0xA9, 0x99, 0x71, 0xFF, 0xEA, 0x70,
+    0xFF, 0xE9, 0x79, 0xFF, 0xE9, 0x71, 0x9F, 0xA7, 0x69, 0xF9, 0x76, 0xAF, 0x75, 0x77, 0x77, 0x4D,
+    0x19, 0xD7, 0x69, 0xD1, 0xAC, 0xA7, 0x6A, 0xCA, 0x1D, 0x97, 0x59, 0xFE, 0x97, 0x29, 0xFF, 0xF9,
+    0x7A, 0xFF, 0xFC, 0x96, 0xFF, 0xFE, 0x95, 0xFF, 0xA9, 0x9F, 0xC5, 0xAF, 0xF9, 0x1D, 0x19, 0x49,
+    0xFC, 0xA0, 0xD1, 0x9D, 0x7F, 0xD0, 0x9D, 0x1A, 0xCA, 0x7F, 0xC9, 0x0A, 0xCA, 0x1D, 0x96, 0x9F,
+    0xC1, 0xD9, 0x1D, 0x96, 0xAF, 0xA7, 0x70, 0xAF, 0x97, 0x70, 0xFC, 0x97, 0x70, 0xAF, 0x97, 0x70,
+    0xAF, 0x97, 0x71, 0xFA, 0x77, 0x1F, 0xC7, 0x72, 0xFC, 0x77, 0x19, 0xFC, 0x77, 0x1A, 0xFC, 0xA9,
+    0x99, 0x7A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xCA, 0x4F, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xFC, 0x93,
+    0x77, 0x73, 0xAC, 0xA1, 0xD7, 0x3D, 0x90, 0x9D, 0x73, 0xD9, 0x0A, 0xCA, 0x70, 0xFD, 0xAD, 0xA7,
+    0x9F, 0xFD, 0xA6, 0xAF, 0xFE, 0xA5, 0xFF, 0xFC, 0x5F, 0xA9, 0x9F, 0xD9, 0x4F, 0x92, 0xFC, 0x93,
+    0x9F, 0x3F, 0xC9, 0x3A, 0xF3, 0xFC, 0x4F, 0xC2, 0x9F, 0xC4, 0xFA, 0x99, 0xAF, 0xC4, 0x9F, 0xFF,
+    0x59, 0xFF, 0xD9, 0x6A, 0xFF, 0xE6, 0xFC, 0xAA, 0xFD, 0x5F, 0xA2, 0xFC, 0x93, 0x9F, 0x92, 0x9F,
+    0xA3, 0xAF, 0x39, 0xFC, 0x3F, 0xC3, 0x9F, 0xA3, 0xFA, 0x3F, 0xCA, 0x3F, 0xA1, 0x9F, 0xD3, 0x9F,
+    0xFF, 0xCA, 0x3A, 0xFF, 0xFC, 0x4F, 0xFF, 0xA5, 0xFF, 0xD9, 0x71, 0x9D, 0x1D, 0x97, 0x29, 0xCA,
+    0x1D, 0x73, 0xAC, 0xA0, 0x9D, 0x74, 0x92, 0x97, 0x10, 0x0A, 0xFF, 0x0F, 0xFA, 0x0F, 0xF9, 0x9F,
+    0xF9, 0x71, 0x77, 0x77, 0x75, 0xC9, 0x77, 0x73, 0xE9, 0x77, 0x71, 0xFC, 0x97, 0x77, 0xFE, 0x97,
+    0x75, 0xFF, 0xC9, 0x77, 0x3F, 0xFE, 0x97, 0x71, 0xEA, 0x92, 0x9A, 0xE9, 0x77, 0xDA, 0x70, 0xE9,
+    0x75, 0xEA, 0x71, 0xE9, 0x73, 0xFC, 0x19, 0xAA, 0xA3, 0xF9, 0x71, 0xFD, 0xAF, 0xC9, 0x2A, 0xF9,
+    0x7F, 0xFF, 0xCA, 0x2A, 0xFC, 0x95, 0xFF, 0xFD, 0x3F, 0xE9, 0x3F, 0xFF, 0xD3, 0x9F, 0xF9, 0x1F,
+    0xFF, 0xD3, 0x9F, 0xFD, 0x90, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x1F, 0xFE, 0xA2, 0xAF, 0xFE, 0x93,
+    0xFF, 0xD9, 0x2F, 0xFE, 0x95, 0xFF, 0xC9, 0x19, 0xFF, 0xD9, 0x7F, 0xFF, 0xFF, 0xC9, 0x71, 0xFF,
+    0xFF, 0xE9, 0x73, 0xFE, 0x99, 0xAF, 0xE9, 0x75, 0xFC, 0x3F, 0xD9, 0x77, 0xF3, 0xAF, 0x97, 0x71,
+    0xE3, 0xF9, 0x77, 0x3E, 0x99, 0xAE, 0x97, 0x75, 0xFE, 0x97, 0x77, 0xFC, 0x97, 0x77, 0x1E, 0x97,
+    0x77, 0x3C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 11, 25, 12, 0, 24, 69, 0 }, // !
-    { 13, 9, 17, 3, 24, 30, 69 }, // "
-    { 22, 24, 23, 0, 24, 132, 99 }, // #
-    { 19, 28, 20, 0, 26, 133, 231 }, // $
-    { 27, 26, 29, 1, 25, 176, 364 }, // %
-    { 23, 26, 25, 1, 25, 150, 540 }, // &
-    { 6, 9, 10, 3, 24, 14, 690 }, // '
-    { 13, 30, 15, 1, 24, 98, 704 }, // (
-    { 14, 31, 12, -3, 25, 109, 802 }, // )
-    { 17, 17, 20, 2, 26, 73, 911 }, // *
-    { 17, 17, 19, 1, 20, 73, 984 }, // +
-    { 9, 9, 10, -2, 4, 21, 1057 }, // ,
-    { 10, 5, 11, 0, 11, 13, 1078 }, // -
-    { 7, 7, 10, 0, 6, 13, 1091 }, // .
-    { 19, 25, 18, -2, 24, 119, 1104 }, // /
-    { 18, 26, 20, 1, 25, 117, 1223 }, // 0
-    { 15, 24, 18, 2, 24, 90, 1340 }, // 1
-    { 19, 25, 19, -1, 25, 119, 1430 }, // 2
-    { 18, 26, 19, 0, 25, 117, 1549 }, // 3
-    { 19, 24, 19, -1, 24, 114, 1666 }, // 4
-    { 19, 25, 20, 0, 24, 119, 1780 }, // 5
-    { 18, 26, 20, 1, 25, 117, 1899 }, // 6
-    { 19, 24, 21, 1, 24, 114, 2016 }, // 7
-    { 19, 26, 20, 0, 25, 124, 2130 }, // 8
-    { 17, 26, 19, 1, 25, 111, 2254 }, // 9
-    { 10, 20, 11, 0, 19, 50, 2365 }, // :
-    { 12, 24, 11, -2, 19, 72, 2415 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2487 }, // <
-    { 17, 11, 19, 1, 17, 47, 2564 }, // =
-    { 17, 18, 19, 1, 21, 77, 2611 }, // >
-    { 15, 26, 18, 2, 25, 98, 2688 }, // ?
-    { 28, 28, 30, 1, 24, 196, 2786 }, // @
-    { 21, 24, 21, -2, 24, 126, 2982 }, // A
-    { 21, 24, 22, 0, 24, 126, 3108 }, // B
-    { 21, 26, 23, 1, 25, 137, 3234 }, // C
-    { 22, 24, 23, 0, 24, 132, 3371 }, // D
-    { 20, 24, 21, 0, 24, 120, 3503 }, // E
-    { 20, 24, 21, 0, 24, 120, 3623 }, // F
-    { 22, 26, 24, 1, 25, 143, 3743 }, // G
-    { 24, 24, 25, 0, 24, 144, 3886 }, // H
-    { 16, 24, 16, -1, 24, 96, 4030 }, // I
-    { 18, 32, 13, -6, 24, 144, 4126 }, // J
-    { 24, 24, 25, 0, 24, 144, 4270 }, // K
-    { 16, 24, 17, 0, 24, 96, 4414 }, // L
-    { 30, 24, 31, 0, 24, 180, 4510 }, // M
-    { 26, 24, 27, 0, 24, 156, 4690 }, // N
-    { 23, 26, 25, 1, 25, 150, 4846 }, // O
-    { 21, 24, 22, 0, 24, 126, 4996 }, // P
-    { 23, 31, 25, 1, 25, 179, 5122 }, // Q
-    { 20, 24, 21, 0, 24, 120, 5301 }, // R
-    { 19, 26, 20, 0, 25, 124, 5421 }, // S
-    { 19, 24, 22, 2, 24, 114, 5545 }, // T
-    { 22, 25, 25, 2, 24, 138, 5659 }, // U
-    { 20, 24, 24, 3, 24, 120, 5797 }, // V
-    { 30, 24, 34, 3, 24, 180, 5917 }, // W
-    { 25, 24, 24, -2, 24, 150, 6097 }, // X
-    { 19, 24, 23, 3, 24, 114, 6247 }, // Y
-    { 21, 24, 21, -1, 24, 126, 6361 }, // Z
-    { 15, 30, 15, -1, 24, 113, 6487 }, // [
-    { 9, 25, 14, 3, 24, 57, 6600 }, // <backslash>
-    { 15, 30, 13, -3, 24, 113, 6657 }, // ]
-    { 18, 16, 19, 0, 24, 72, 6770 }, // ^
-    { 15, 3, 13, -4, -3, 12, 6842 }, // _
-    { 8, 6, 13, 4, 26, 12, 6854 }, // `
-    { 19, 20, 21, 1, 19, 95, 6866 }, // a
-    { 19, 27, 20, 0, 26, 129, 6961 }, // b
-    { 16, 20, 18, 1, 19, 80, 7090 }, // c
-    { 20, 27, 22, 1, 26, 135, 7170 }, // d
-    { 17, 20, 19, 1, 19, 85, 7305 }, // e
-    { 21, 34, 18, -4, 26, 179, 7390 }, // f
-    { 20, 27, 21, 0, 19, 135, 7569 }, // g
-    { 19, 26, 20, 0, 26, 124, 7704 }, // h
-    { 11, 26, 12, 0, 26, 72, 7828 }, // i
-    { 16, 34, 12, -5, 26, 136, 7900 }, // j
-    { 21, 26, 22, 0, 26, 137, 8036 }, // k
-    { 11, 26, 12, 0, 26, 72, 8173 }, // l
-    { 29, 19, 30, 0, 19, 138, 8245 }, // m
-    { 19, 19, 20, 0, 19, 91, 8383 }, // n
-    { 18, 20, 20, 1, 19, 90, 8474 }, // o
-    { 21, 27, 20, -2, 19, 142, 8564 }, // p
-    { 19, 27, 21, 1, 19, 129, 8706 }, // q
-    { 16, 19, 17, 0, 19, 76, 8835 }, // r
-    { 16, 20, 17, 0, 19, 80, 8911 }, // s
-    { 14, 24, 16, 1, 23, 84, 8991 }, // t
-    { 19, 20, 21, 1, 19, 95, 9075 }, // u
-    { 18, 19, 20, 1, 19, 86, 9170 }, // v
-    { 26, 19, 29, 2, 19, 124, 9256 }, // w
-    { 22, 19, 21, -2, 19, 105, 9380 }, // x
-    { 23, 27, 21, -3, 19, 156, 9485 }, // y
-    { 17, 19, 17, -1, 19, 81, 9641 }, // z
-    { 15, 30, 15, -1, 24, 113, 9722 }, // {
-    { 4, 34, 18, 7, 26, 34, 9835 }, // |
-    { 14, 30, 13, -2, 24, 105, 9869 }, // }
-    { 17, 7, 19, 1, 15, 30, 9974 }, // ~
-    { 0, 0, 9, 0, 0, 0, 10004 }, //  
-    { 11, 26, 10, -2, 19, 72, 10004 }, // ¡
-    { 16, 26, 19, 2, 25, 104, 10076 }, // ¢
-    { 22, 25, 22, -1, 25, 138, 10180 }, // £
-    { 17, 16, 19, 1, 20, 68, 10318 }, // ¤
-    { 20, 24, 22, 1, 24, 120, 10386 }, // ¥
-    { 4, 34, 18, 7, 26, 34, 10506 }, // ¦
-    { 17, 27, 18, 0, 26, 115, 10540 }, // §
-    { 12, 6, 19, 6, 26, 18, 10655 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 10673 }, // ©
-    { 13, 13, 16, 2, 25, 43, 10842 }, // ª
-    { 18, 16, 20, 1, 17, 72, 10885 }, // «
-    { 17, 10, 19, 1, 14, 43, 10957 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 11000 }, // ­
-    { 26, 26, 28, 1, 25, 169, 11013 }, // ®
-    { 16, 4, 20, 3, 29, 16, 11182 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 11198 }, // °
-    { 17, 21, 19, 1, 21, 90, 11237 }, // ±
-    { 14, 16, 16, 1, 29, 56, 11327 }, // ²
-    { 13, 16, 16, 2, 29, 52, 11383 }, // ³
-    { 10, 6, 14, 3, 26, 15, 11435 }, // ´
-    { 22, 27, 21, -2, 19, 149, 11450 }, // µ
-    { 18, 31, 22, 2, 26, 140, 11599 }, // ¶
-    { 7, 7, 10, 2, 15, 13, 11739 }, // ·
-    { 9, 8, 7, -4, 0, 18, 11752 }, // ¸
-    { 10, 16, 14, 3, 29, 40, 11770 }, // ¹
-    { 12, 12, 15, 2, 24, 36, 11810 }, // º
-    { 18, 16, 19, 0, 17, 72, 11846 }, // »
-    { 25, 26, 28, 2, 25, 163, 11918 }, // ¼
-    { 27, 26, 30, 2, 25, 176, 12081 }, // ½
-    { 27, 26, 29, 1, 25, 176, 12257 }, // ¾
-    { 14, 25, 16, -1, 19, 88, 12433 }, // ¿
-    { 21, 32, 21, -2, 32, 168, 12521 }, // À
-    { 23, 32, 22, -2, 32, 184, 12689 }, // Á
-    { 23, 32, 22, -2, 32, 184, 12873 }, // Â
-    { 24, 32, 23, -2, 32, 192, 13057 }, // Ã
-    { 22, 32, 21, -2, 32, 176, 13249 }, // Ä
-    { 21, 34, 21, -2, 34, 179, 13425 }, // Å
-    { 33, 24, 32, -2, 24, 198, 13604 }, // Æ
-    { 21, 33, 23, 1, 25, 174, 13802 }, // Ç
-    { 20, 32, 21, 0, 32, 160, 13976 }, // È
-    { 20, 32, 21, 0, 32, 160, 14136 }, // É
-    { 20, 32, 21, 0, 32, 160, 14296 }, // Ê
-    { 20, 32, 21, 0, 32, 160, 14456 }, // Ë
-    { 16, 32, 16, -1, 32, 128, 14616 }, // Ì
-    { 18, 32, 18, -1, 32, 144, 14744 }, // Í
-    { 18, 32, 18, -1, 32, 144, 14888 }, // Î
-    { 17, 32, 17, -1, 32, 136, 15032 }, // Ï
-    { 22, 24, 23, 0, 24, 132, 15168 }, // Ð
-    { 26, 32, 27, 0, 32, 208, 15300 }, // Ñ
-    { 23, 33, 25, 1, 32, 190, 15508 }, // Ò
-    { 23, 33, 25, 1, 32, 190, 15698 }, // Ó
-    { 23, 33, 25, 1, 32, 190, 15888 }, // Ô
-    { 23, 33, 25, 1, 32, 190, 16078 }, // Õ
-    { 23, 33, 25, 1, 32, 190, 16268 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 16458 }, // ×
-    { 23, 28, 25, 1, 26, 161, 16522 }, // Ø
-    { 22, 33, 25, 2, 32, 182, 16683 }, // Ù
-    { 22, 33, 25, 2, 32, 182, 16865 }, // Ú
-    { 22, 33, 25, 2, 32, 182, 17047 }, // Û
-    { 22, 33, 25, 2, 32, 182, 17229 }, // Ü
-    { 19, 32, 23, 3, 32, 152, 17411 }, // Ý
-    { 20, 24, 21, 0, 24, 120, 17563 }, // Þ
-    { 27, 34, 23, -5, 26, 230, 17683 }, // ß
-    { 19, 27, 21, 1, 26, 129, 17913 }, // à
-    { 19, 27, 21, 1, 26, 129, 18042 }, // á
-    { 19, 27, 21, 1, 26, 129, 18171 }, // â
-    { 19, 27, 21, 1, 26, 129, 18300 }, // ã
-    { 19, 27, 21, 1, 26, 129, 18429 }, // ä
-    { 19, 29, 21, 1, 28, 138, 18558 }, // å
-    { 28, 20, 30, 1, 19, 140, 18696 }, // æ
-    { 16, 27, 18, 1, 19, 108, 18836 }, // ç
-    { 17, 27, 19, 1, 26, 115, 18944 }, // è
-    { 18, 27, 20, 1, 26, 122, 19059 }, // é
-    { 18, 27, 20, 1, 26, 122, 19181 }, // ê
-    { 17, 27, 19, 1, 26, 115, 19303 }, // ë
-    { 10, 26, 11, 0, 26, 65, 19418 }, // ì
-    { 14, 26, 15, 0, 26, 91, 19483 }, // í
-    { 14, 26, 15, 0, 26, 91, 19574 }, // î
-    { 13, 26, 14, 0, 26, 85, 19665 }, // ï
-    { 18, 27, 20, 1, 26, 122, 19750 }, // ð
-    { 20, 26, 21, 0, 26, 130, 19872 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 20002 }, // ò
-    { 18, 27, 20, 1, 26, 122, 20124 }, // ó
-    { 18, 27, 20, 1, 26, 122, 20246 }, // ô
-    { 19, 27, 21, 1, 26, 129, 20368 }, // õ
-    { 18, 27, 20, 1, 26, 122, 20497 }, // ö
-    { 17, 17, 19, 1, 20, 73, 20619 }, // ÷
-    { 19, 22, 20, 0, 20, 105, 20692 }, // ø
-    { 19, 27, 21, 1, 26, 129, 20797 }, // ù
-    { 19, 27, 21, 1, 26, 129, 20926 }, // ú
-    { 19, 27, 21, 1, 26, 129, 21055 }, // û
-    { 19, 27, 21, 1, 26, 129, 21184 }, // ü
-    { 23, 34, 21, -3, 26, 196, 21313 }, // ý
-    { 21, 34, 20, -2, 26, 179, 21509 }, // þ
-    { 23, 34, 21, -3, 26, 196, 21688 }, // ÿ
-    { 22, 30, 21, -2, 30, 165, 21884 }, // Ā
-    { 19, 25, 21, 1, 24, 119, 22049 }, // ā
-    { 23, 32, 22, -2, 32, 184, 22168 }, // Ă
-    { 19, 27, 21, 1, 26, 129, 22352 }, // ă
-    { 21, 33, 21, -2, 24, 174, 22481 }, // Ą
-    { 19, 28, 21, 1, 19, 133, 22655 }, // ą
-    { 21, 33, 23, 1, 32, 174, 22788 }, // Ć
-    { 17, 27, 19, 1, 26, 115, 22962 }, // ć
-    { 21, 33, 23, 1, 32, 174, 23077 }, // Ĉ
-    { 17, 27, 19, 1, 26, 115, 23251 }, // ĉ
-    { 21, 33, 23, 1, 32, 174, 23366 }, // Ċ
-    { 16, 27, 18, 1, 26, 108, 23540 }, // ċ
-    { 22, 33, 24, 1, 32, 182, 23648 }, // Č
-    { 18, 27, 20, 1, 26, 122, 23830 }, // č
-    { 23, 32, 24, 0, 32, 184, 23952 }, // Ď
-    { 27, 27, 29, 1, 26, 183, 24136 }, // ď
-    { 22, 24, 23, 0, 24, 132, 24319 }, // Đ
-    { 22, 27, 24, 1, 26, 149, 24451 }, // đ
-    { 20, 30, 21, 0, 30, 150, 24600 }, // Ē
-    { 17, 25, 19, 1, 24, 107, 24750 }, // ē
-    { 20, 32, 21, 0, 32, 160, 24857 }, // Ĕ
-    { 18, 27, 20, 1, 26, 122, 25017 }, // ĕ
-    { 20, 32, 21, 0, 32, 160, 25139 }, // Ė
-    { 17, 27, 19, 1, 26, 115, 25299 }, // ė
-    { 20, 33, 21, 0, 24, 165, 25414 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 25579 }, // ę
-    { 21, 32, 22, 0, 32, 168, 25694 }, // Ě
-    { 19, 27, 21, 1, 26, 129, 25862 }, // ě
-    { 22, 33, 24, 1, 32, 182, 25991 }, // Ĝ
-    { 20, 34, 21, 0, 26, 170, 26173 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 26343 }, // Ğ
-    { 20, 34, 21, 0, 26, 170, 26525 }, // ğ
-    { 22, 33, 24, 1, 32, 182, 26695 }, // Ġ
-    { 20, 34, 21, 0, 26, 170, 26877 }, // ġ
-    { 22, 33, 24, 1, 25, 182, 27047 }, // Ģ
-    { 20, 34, 21, 0, 26, 170, 27229 }, // ģ
-    { 24, 32, 25, 0, 32, 192, 27399 }, // Ĥ
-    { 19, 33, 20, 0, 33, 157, 27591 }, // ĥ
-    { 26, 24, 27, 0, 24, 156, 27748 }, // Ħ
-    { 19, 26, 20, 0, 26, 124, 27904 }, // ħ
-    { 18, 32, 18, -1, 32, 144, 28028 }, // Ĩ
-    { 15, 26, 16, 0, 26, 98, 28172 }, // ĩ
-    { 17, 30, 17, -1, 30, 128, 28270 }, // Ī
-    { 13, 24, 14, 0, 24, 78, 28398 }, // ī
-    { 18, 32, 18, -1, 32, 144, 28476 }, // Ĭ
-    { 14, 26, 15, 0, 26, 91, 28620 }, // ĭ
-    { 16, 33, 16, -1, 24, 132, 28711 }, // Į
-    { 13, 35, 12, -2, 26, 114, 28843 }, // į
-    { 16, 32, 16, -1, 32, 128, 28957 }, // İ
-    { 10, 19, 11, 0, 19, 48, 29085 }, // ı
-    { 26, 32, 26, -1, 24, 208, 29133 }, // Ĳ
-    { 21, 34, 22, 0, 26, 179, 29341 }, // ĳ
-    { 22, 40, 17, -6, 32, 220, 29520 }, // Ĵ
-    { 19, 34, 15, -5, 26, 162, 29740 }, // ĵ
-    { 24, 32, 25, 0, 24, 192, 29902 }, // Ķ
-    { 21, 34, 22, 0, 26, 179, 30094 }, // ķ
-    { 21, 19, 22, 0, 19, 100, 30273 }, // ĸ
-    { 17, 32, 18, 0, 32, 136, 30373 }, // Ĺ
-    { 16, 33, 17, 0, 33, 132, 30509 }, // ĺ
-    { 16, 32, 17, 0, 24, 128, 30641 }, // Ļ
-    { 13, 34, 12, -2, 26, 111, 30769 }, // ļ
-    { 20, 24, 21, 0, 24, 120, 30880 }, // Ľ
-    { 18, 26, 19, 0, 26, 117, 31000 }, // ľ
-    { 17, 24, 18, 0, 24, 102, 31117 }, // Ŀ
-    { 16, 26, 17, 0, 26, 104, 31219 }, // ŀ
-    { 17, 24, 17, -1, 24, 102, 31323 }, // Ł
-    { 12, 26, 13, 0, 26, 78, 31425 }, // ł
-    { 26, 32, 27, 0, 32, 208, 31503 }, // Ń
-    { 19, 26, 20, 0, 26, 124, 31711 }, // ń
-    { 26, 32, 27, 0, 24, 208, 31835 }, // Ņ
-    { 19, 27, 20, 0, 19, 129, 32043 }, // ņ
-    { 26, 32, 27, 0, 32, 208, 32172 }, // Ň
-    { 21, 26, 22, 0, 26, 137, 32380 }, // ň
-    { 22, 24, 24, 0, 24, 132, 32517 }, // ŉ
-    { 26, 31, 27, 0, 24, 202, 32649 }, // Ŋ
-    { 19, 27, 20, 0, 19, 129, 32851 }, // ŋ
-    { 23, 31, 25, 1, 30, 179, 32980 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 33159 }, // ō
-    { 23, 33, 25, 1, 32, 190, 33272 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 33462 }, // ŏ
-    { 25, 33, 27, 1, 32, 207, 33584 }, // Ő
-    { 22, 27, 24, 1, 26, 149, 33791 }, // ő
-    { 30, 26, 33, 2, 25, 195, 33940 }, // Œ
-    { 28, 20, 30, 1, 19, 140, 34135 }, // œ
-    { 21, 32, 22, 0, 32, 168, 34275 }, // Ŕ
-    { 17, 26, 18, 0, 26, 111, 34443 }, // ŕ
-    { 20, 32, 21, 0, 24, 160, 34554 }, // Ŗ
-    { 18, 27, 17, -2, 19, 122, 34714 }, // ŗ
-    { 22, 32, 23, 0, 32, 176, 34836 }, // Ř
-    { 18, 26, 19, 0, 26, 117, 35012 }, // ř
-    { 19, 33, 20, 0, 32, 157, 35129 }, // Ś
-    { 17, 27, 18, 0, 26, 115, 35286 }, // ś
-    { 19, 33, 20, 0, 32, 157, 35401 }, // Ŝ
-    { 17, 27, 18, 0, 26, 115, 35558 }, // ŝ
-    { 19, 33, 20, 0, 25, 157, 35673 }, // Ş
-    { 16, 27, 17, 0, 19, 108, 35830 }, // ş
-    { 20, 33, 21, 0, 32, 165, 35938 }, // Š
-    { 18, 27, 19, 0, 26, 122, 36103 }, // š
-    { 19, 32, 22, 2, 24, 152, 36225 }, // Ţ
-    { 14, 31, 16, 1, 23, 109, 36377 }, // ţ
-    { 19, 32, 22, 2, 32, 152, 36486 }, // Ť
-    { 18, 27, 20, 1, 26, 122, 36638 }, // ť
-    { 19, 24, 22, 2, 24, 114, 36760 }, // Ŧ
-    { 15, 24, 16, 0, 23, 90, 36874 }, // ŧ
-    { 22, 33, 25, 2, 32, 182, 36964 }, // Ũ
-    { 19, 27, 21, 1, 26, 129, 37146 }, // ũ
-    { 22, 31, 25, 2, 30, 171, 37275 }, // Ū
-    { 19, 25, 21, 1, 24, 119, 37446 }, // ū
-    { 22, 33, 25, 2, 32, 182, 37565 }, // Ŭ
-    { 19, 27, 21, 1, 26, 129, 37747 }, // ŭ
-    { 22, 35, 25, 2, 34, 193, 37876 }, // Ů
-    { 19, 29, 21, 1, 28, 138, 38069 }, // ů
-    { 24, 33, 27, 2, 32, 198, 38207 }, // Ű
-    { 22, 27, 24, 1, 26, 149, 38405 }, // ű
-    { 22, 33, 25, 2, 24, 182, 38554 }, // Ų
-    { 19, 28, 21, 1, 19, 133, 38736 }, // ų
-    { 30, 32, 34, 3, 32, 240, 38869 }, // Ŵ
-    { 26, 26, 29, 2, 26, 169, 39109 }, // ŵ
-    { 19, 32, 23, 3, 32, 152, 39278 }, // Ŷ
-    { 23, 34, 21, -3, 26, 196, 39430 }, // ŷ
-    { 19, 32, 23, 3, 32, 152, 39626 }, // Ÿ
-    { 21, 32, 21, -1, 32, 168, 39778 }, // Ź
-    { 18, 26, 18, -1, 26, 117, 39946 }, // ź
-    { 21, 32, 21, -1, 32, 168, 40063 }, // Ż
-    { 17, 26, 17, -1, 26, 111, 40231 }, // ż
-    { 22, 32, 22, -1, 32, 176, 40342 }, // Ž
-    { 19, 26, 19, -1, 26, 124, 40518 }, // ž
-    { 20, 34, 17, -4, 26, 170, 40642 }, // ſ
-    { 28, 27, 31, 2, 26, 189, 40812 }, // Ơ
-    { 24, 22, 26, 1, 21, 132, 41001 }, // ơ
-    { 34, 26, 36, 1, 25, 221, 41133 }, // Ƣ
-    { 28, 27, 30, 1, 19, 189, 41354 }, // ƣ
-    { 24, 24, 26, 1, 24, 144, 41543 }, // Ƥ
-    { 21, 34, 20, -2, 26, 179, 41687 }, // ƥ
-    { 19, 28, 20, 0, 24, 133, 41866 }, // Ʀ
-    { 18, 26, 19, 0, 25, 117, 41999 }, // Ƨ
-    { 16, 20, 17, 0, 19, 80, 42116 }, // ƨ
-    { 21, 24, 21, -1, 24, 126, 42196 }, // Ʃ
-    { 11, 34, 12, 0, 26, 94, 42322 }, // ƪ
-    { 14, 31, 16, 1, 23, 109, 42416 }, // ƫ
-    { 21, 24, 23, 1, 24, 126, 42525 }, // Ƭ
-    { 14, 27, 16, 1, 26, 95, 42651 }, // ƭ
-    { 19, 32, 22, 2, 24, 152, 42746 }, // Ʈ
-    { 29, 27, 32, 2, 26, 196, 42898 }, // Ư
-    { 27, 22, 29, 1, 21, 149, 43094 }, // ư
-    { 8, 6, 0, -14, 26, 12, 43243 }, // ̀
-    { 10, 6, 3, -8, 26, 15, 43255 }, // ́
-    { 14, 6, 10, -5, 26, 21, 43270 }, // ̂
-    { 15, 6, 1, -15, 26, 23, 43291 }, // ̃
-    { 11, 4, 9, -3, 24, 11, 43314 }, // ̄
-    { 15, 5, 12, -4, 29, 19, 43325 }, // ̅
-    { 13, 6, 11, -3, 26, 20, 43344 }, // ̆
-    { 6, 6, 7, 0, 26, 9, 43364 }, // ̇
-    { 12, 6, 10, -3, 26, 18, 43373 }, // ̈
-    { 8, 9, 0, -10, 28, 18, 43391 }, // ̉
-    { 9, 8, 9, -1, 28, 18, 43409 }, // ̊
-    { 16, 6, 13, -4, 26, 24, 43427 }, // ̋
-    { 15, 6, 12, -4, 26, 23, 43451 }, // ̌
-    { 6, 10, 7, 0, 26, 15, 43474 }, // ̍
-    { 12, 7, 10, -3, 26, 21, 43489 }, // ̎
-    { 14, 6, 0, -16, 26, 21, 43510 }, // ̏
-    { 12, 9, 10, -3, 29, 27, 43531 }, // ̐
-    { 13, 6, 10, -4, 26, 20, 43558 }, // ̑
-    { 9, 9, 8, -2, 24, 21, 43578 }, // ̒
-    { 9, 9, 8, -2, 24, 21, 43599 }, // ̓
-    { 5, 9, 6, 0, 24, 12, 43620 }, // ̔
-    { 9, 9, 8, -2, 24, 21, 43632 }, // ̕
-    { 8, 6, 2, -7, -1, 12, 43653 }, // ̖
-    { 10, 6, 3, -8, -1, 15, 43665 }, // ̗
-    { 7, 8, 2, -6, 0, 14, 43680 }, // ̘
-    { 8, 8, 2, -7, 0, 16, 43694 }, // ̙
-    { 11, 10, 14, 2, 26, 28, 43710 }, // ̚
-    { 10, 9, 9, -2, 26, 23, 43738 }, // ̛
-    { 6, 9, 5, -2, 0, 14, 43761 }, // ̜
-    { 8, 6, 2, -7, -1, 12, 43775 }, // ̝
-    { 9, 6, 3, -7, -1, 14, 43787 }, // ̞
-    { 8, 8, 2, -7, 0, 16, 43801 }, // ̟
-    { 8, 3, 2, -7, -2, 6, 43817 }, // ̠
-    { 9, 10, 3, -7, 2, 23, 43823 }, // ̡
-    { 8, 10, 5, -4, 2, 20, 43846 }, // ̢
-    { 7, 6, 0, -16, -2, 11, 43866 }, // ̣
-    { 12, 6, 4, -9, -1, 18, 43877 }, // ̤
-    { 9, 8, 3, -7, 0, 18, 43895 }, // ̥
-    { 7, 6, 10, 2, -2, 11, 43913 }, // ̦
-    { 9, 8, 3, -7, 0, 18, 43924 }, // ̧
-    { 7, 9, 2, -6, 0, 16, 43942 }, // ̨
-    { 7, 10, 2, -6, -1, 18, 43958 }, // ̩
-    { 14, 7, 5, -10, -1, 25, 43976 }, // ̪
-    { 13, 4, 5, -9, -2, 13, 44001 }, // ̫
-    { 14, 6, 6, -9, -1, 21, 44014 }, // ̬
-    { 14, 6, 5, -10, -1, 21, 44035 }, // ̭
-    { 13, 6, 5, -9, -1, 20, 44056 }, // ̮
-    { 13, 6, 5, -9, -1, 20, 44076 }, // ̯
-    { 15, 6, 6, -10, -1, 23, 44096 }, // ̰
-    { 12, 4, 4, -9, -2, 12, 44119 }, // ̱
-    { 17, 3, 7, -11, -3, 13, 44131 }, // ̲
-    { 16, 8, 6, -11, 0, 32, 44144 }, // ̳
-    { 14, 6, 8, -7, 13, 21, 44176 }, // ̴
-    { 15, 5, 8, -8, 11, 19, 44197 }, // ̵
-    { 26, 5, 14, -13, 12, 33, 44216 }, // ̶
-    { 12, 9, 7, -6, 14, 27, 44249 }, // ̷
-    { 20, 28, 11, -10, 26, 140, 44276 }, // ̸
-    { 6, 9, 4, -3, 0, 14, 44416 }, // ̹
-    { 14, 7, 5, -10, -1, 25, 44430 }, // ̺
-    { 14, 8, 5, -10, 0, 28, 44455 }, // ̻
-    { 13, 4, 5, -9, -2, 13, 44483 }, // ̼
-    { 8, 7, 8, -1, 26, 14, 44496 }, // ̽
-    { 8, 10, 8, -1, 29, 20, 44510 }, // ̾
-    { 15, 8, 12, -4, 33, 30, 44530 }, // ̿
-    { 8, 6, 6, -3, 26, 12, 44560 }, // ̀
-    { 10, 6, 11, 0, 26, 15, 44572 }, // ́
-    { 14, 6, 20, 5, 26, 21, 44587 }, // ͂
-    { 6, 7, 7, 0, 26, 11, 44608 }, // ̓
-    { 18, 6, 14, -5, 26, 27, 44619 }, // ̈́
-    { 7, 6, 3, -5, -2, 11, 44646 }, // ͅ
-    { 16, 7, 12, -5, 26, 28, 44657 }, // ͆
-    { 16, 8, 6, -11, 0, 32, 44685 }, // ͇
-    { 11, 7, 4, -8, -1, 20, 44717 }, // ͈
-    { 7, 6, 2, -6, -2, 11, 44737 }, // ͉
-    { 13, 8, 10, -4, 26, 26, 44748 }, // ͊
-    { 13, 14, 11, -3, 32, 46, 44774 }, // ͋
-    { 14, 9, 11, -4, 29, 32, 44820 }, // ͌
-    { 13, 7, 5, -9, -1, 23, 44852 }, // ͍
-    { 7, 8, 2, -6, 0, 14, 44875 }, // ͎
-    { 24, 24, 13, -12, 24, 144, 44889 }, // ͏
-    { 6, 8, 7, 0, 27, 12, 45033 }, // ͐
-    { 6, 9, 11, 4, 29, 14, 45045 }, // ͑
-    { 12, 9, 10, -3, 29, 27, 45059 }, // ͒
-    { 8, 7, 3, -6, -1, 14, 45086 }, // ͓
-    { 6, 7, 2, -5, -1, 11, 45100 }, // ͔
-    { 7, 7, 3, -5, -1, 13, 45111 }, // ͕
-    { 13, 7, 6, -8, -1, 23, 45124 }, // ͖
-    { 6, 9, 10, 3, 28, 14, 45147 }, // ͗
-    { 6, 6, 7, 0, 26, 9, 45161 }, // ͘
-    { 9, 7, 3, -7, -1, 16, 45170 }, // ͙
-    { 13, 8, 5, -9, 0, 26, 45186 }, // ͚
-    { 7, 8, 8, 0, 27, 14, 45212 }, // ͛
-    { 26, 7, 12, -15, -1, 46, 45226 }, // ͜
-    { 26, 7, 17, -10, 26, 46, 45272 }, // ͝
-    { 18, 4, 13, -6, 24, 18, 45318 }, // ͞
-    { 19, 4, 8, -12, -1, 19, 45336 }, // ͟
-    { 27, 6, 18, -10, 26, 41, 45355 }, // ͠
-    { 27, 7, 18, -10, 29, 48, 45396 }, // ͡
-    { 27, 8, 11, -17, 0, 54, 45444 }, // ͢
-    { 9, 9, 9, -1, 29, 21, 45498 }, // ͣ
-    { 9, 9, 9, -1, 29, 21, 45519 }, // ͤ
-    { 5, 11, 7, 1, 31, 14, 45540 }, // ͥ
-    { 8, 9, 8, -1, 29, 18, 45554 }, // ͦ
-    { 9, 8, 9, -1, 28, 18, 45572 }, // ͧ
-    { 7, 9, 8, 0, 29, 16, 45590 }, // ͨ
-    { 10, 11, 10, -1, 31, 28, 45606 }, // ͩ
-    { 9, 11, 8, -2, 31, 25, 45634 }, // ͪ
-    { 14, 9, 11, -4, 29, 32, 45659 }, // ͫ
-    { 7, 9, 8, 0, 29, 16, 45691 }, // ͬ
-    { 7, 10, 8, 0, 30, 18, 45707 }, // ͭ
-    { 8, 8, 9, 0, 28, 16, 45725 }, // ͮ
-    { 10, 8, 9, -2, 28, 20, 45741 }, // ͯ
-    { 21, 24, 21, -2, 24, 126, 45761 }, // Α
-    { 21, 24, 22, 0, 24, 126, 45887 }, // Β
-    { 20, 24, 21, 0, 24, 120, 46013 }, // Γ
-    { 22, 24, 22, -2, 24, 132, 46133 }, // Δ
-    { 20, 24, 21, 0, 24, 120, 46265 }, // Ε
-    { 21, 24, 21, -1, 24, 126, 46385 }, // Ζ
-    { 24, 24, 25, 0, 24, 144, 46511 }, // Η
-    { 23, 26, 25, 1, 25, 150, 46655 }, // Θ
-    { 16, 24, 16, -1, 24, 96, 46805 }, // Ι
-    { 24, 24, 25, 0, 24, 144, 46901 }, // Κ
-    { 20, 24, 20, -2, 24, 120, 47045 }, // Λ
-    { 30, 24, 31, 0, 24, 180, 47165 }, // Μ
-    { 26, 24, 27, 0, 24, 156, 47345 }, // Ν
-    { 20, 24, 21, 0, 24, 120, 47501 }, // Ξ
-    { 23, 26, 25, 1, 25, 150, 47621 }, // Ο
-    { 24, 24, 25, 0, 24, 144, 47771 }, // Π
-    { 21, 24, 22, 0, 24, 126, 47915 }, // Ρ
-    { 21, 24, 21, -1, 24, 126, 48041 }, // Σ
-    { 19, 24, 22, 2, 24, 114, 48167 }, // Τ
-    { 19, 24, 23, 3, 24, 114, 48281 }, // Υ
-    { 28, 26, 30, 1, 25, 182, 48395 }, // Φ
-    { 25, 24, 24, -2, 24, 150, 48577 }, // Χ
-    { 27, 24, 31, 3, 24, 162, 48727 }, // Ψ
-    { 25, 25, 25, -1, 25, 157, 48889 }, // Ω
-    { 19, 20, 21, 1, 19, 95, 49046 }, // α
-    { 22, 34, 21, -2, 26, 187, 49141 }, // β
-    { 17, 26, 19, 1, 19, 111, 49328 }, // γ
-    { 20, 27, 22, 1, 26, 135, 49439 }, // δ
-    { 16, 20, 17, 0, 19, 80, 49574 }, // ε
-    { 19, 33, 20, 0, 26, 157, 49654 }, // ζ
-    { 19, 27, 20, 0, 19, 129, 49811 }, // η
-    { 18, 27, 20, 1, 26, 122, 49940 }, // θ
-    { 10, 20, 13, 1, 19, 50, 50062 }, // ι
-    { 21, 19, 22, 0, 19, 100, 50112 }, // κ
-    { 20, 27, 19, -2, 26, 135, 50212 }, // λ
-    { 22, 27, 21, -2, 19, 149, 50347 }, // μ
-    { 17, 19, 19, 1, 19, 81, 50496 }, // ν
-    { 18, 33, 20, 1, 26, 149, 50577 }, // ξ
-    { 18, 20, 20, 1, 19, 90, 50726 }, // ο
-    { 24, 20, 26, 1, 19, 120, 50816 }, // π
-    { 20, 27, 19, -2, 19, 135, 50936 }, // ρ
-    { 16, 26, 18, 1, 19, 104, 51071 }, // ς
-    { 20, 20, 22, 1, 19, 100, 51175 }, // σ
-    { 17, 20, 19, 1, 19, 85, 51275 }, // τ
-    { 19, 20, 21, 1, 19, 95, 51360 }, // υ
-    { 24, 27, 26, 1, 19, 162, 51455 }, // φ
-    { 24, 28, 23, -2, 19, 168, 51617 }, // χ
-    { 25, 34, 27, 1, 26, 213, 51785 }, // ψ
-    { 26, 20, 28, 1, 19, 130, 51998 }, // ω
-    { 21, 32, 21, -2, 24, 168, 52128 }, // Ạ
-    { 19, 27, 21, 1, 19, 129, 52296 }, // ạ
-    { 21, 34, 21, -2, 34, 179, 52425 }, // Ả
-    { 19, 29, 21, 1, 28, 138, 52604 }, // ả
-    { 28, 33, 27, -2, 33, 231, 52742 }, // Ấ
-    { 23, 29, 25, 1, 28, 167, 52973 }, // ấ
-    { 22, 33, 21, -2, 33, 182, 53140 }, // Ầ
-    { 19, 29, 21, 1, 28, 138, 53322 }, // ầ
-    { 26, 35, 25, -2, 35, 228, 53460 }, // Ẩ
-    { 21, 31, 23, 1, 30, 163, 53688 }, // ẩ
-    { 23, 36, 22, -2, 36, 207, 53851 }, // Ẫ
-    { 19, 31, 21, 1, 30, 148, 54058 }, // ẫ
-    { 23, 40, 22, -2, 32, 230, 54206 }, // Ậ
-    { 19, 34, 21, 1, 26, 162, 54436 }, // ậ
-    { 23, 34, 22, -2, 34, 196, 54598 }, // Ắ
-    { 19, 30, 21, 1, 29, 143, 54794 }, // ắ
-    { 23, 34, 22, -2, 34, 196, 54937 }, // Ằ
-    { 19, 30, 21, 1, 29, 143, 55133 }, // ằ
-    { 23, 35, 22, -2, 35, 202, 55276 }, // Ẳ
-    { 19, 31, 21, 1, 30, 148, 55478 }, // ẳ
-    { 23, 36, 22, -2, 36, 207, 55626 }, // Ẵ
-    { 19, 31, 21, 1, 30, 148, 55833 }, // ẵ
-    { 23, 40, 22, -2, 32, 230, 55981 }, // Ặ
-    { 19, 34, 21, 1, 26, 162, 56211 }, // ặ
-    { 20, 32, 21, 0, 24, 160, 56373 }, // Ẹ
-    { 17, 27, 19, 1, 19, 115, 56533 }, // ẹ
-    { 20, 34, 21, 0, 34, 170, 56648 }, // Ẻ
-    { 17, 29, 19, 1, 28, 124, 56818 }, // ẻ
-    { 21, 32, 22, 0, 32, 168, 56942 }, // Ẽ
-    { 19, 27, 21, 1, 26, 129, 57110 }, // ẽ
-    { 25, 33, 26, 0, 33, 207, 57239 }, // Ế
-    { 23, 29, 25, 1, 28, 167, 57446 }, // ế
-    { 20, 33, 21, 0, 33, 165, 57613 }, // Ề
-    { 17, 29, 19, 1, 28, 124, 57778 }, // ề
-    { 23, 35, 24, 0, 35, 202, 57902 }, // Ể
-    { 21, 31, 23, 1, 30, 163, 58104 }, // ể
-    { 20, 36, 21, 0, 36, 180, 58267 }, // Ễ
-    { 18, 31, 20, 1, 30, 140, 58447 }, // ễ
-    { 20, 40, 21, 0, 32, 200, 58587 }, // Ệ
-    { 18, 34, 20, 1, 26, 153, 58787 }, // ệ
-    { 16, 34, 16, -1, 34, 136, 58940 }, // Ỉ
-    { 13, 28, 14, 0, 28, 91, 59076 }, // ỉ
-    { 16, 32, 16, -1, 24, 128, 59167 }, // Ị
-    { 12, 34, 12, -1, 26, 102, 59295 }, // ị
-    { 23, 33, 25, 1, 25, 190, 59397 }, // Ọ
-    { 18, 27, 20, 1, 19, 122, 59587 }, // ọ
-    { 23, 35, 25, 1, 34, 202, 59709 }, // Ỏ
-    { 18, 29, 20, 1, 28, 131, 59911 }, // ỏ
-    { 27, 34, 29, 1, 33, 230, 60042 }, // Ố
-    { 23, 29, 25, 1, 28, 167, 60272 }, // ố
-    { 23, 34, 25, 1, 33, 196, 60439 }, // Ồ
-    { 18, 29, 20, 1, 28, 131, 60635 }, // ồ
-    { 25, 36, 27, 1, 35, 225, 60766 }, // Ổ
-    { 21, 31, 23, 1, 30, 163, 60991 }, // ổ
-    { 23, 37, 25, 1, 36, 213, 61154 }, // Ỗ
-    { 18, 31, 20, 1, 30, 140, 61367 }, // ỗ
-    { 23, 40, 25, 1, 32, 230, 61507 }, // Ộ
-    { 18, 34, 20, 1, 26, 153, 61737 }, // ộ
-    { 28, 33, 31, 2, 32, 231, 61890 }, // Ớ
-    { 24, 27, 26, 1, 26, 162, 62121 }, // ớ
-    { 28, 33, 31, 2, 32, 231, 62283 }, // Ờ
-    { 24, 27, 26, 1, 26, 162, 62514 }, // ờ
-    { 28, 35, 31, 2, 34, 245, 62676 }, // Ở
-    { 24, 29, 26, 1, 28, 174, 62921 }, // ở
-    { 28, 33, 31, 2, 32, 231, 63095 }, // Ỡ
-    { 24, 27, 26, 1, 26, 162, 63326 }, // ỡ
-    { 28, 34, 31, 2, 26, 238, 63488 }, // Ợ
-    { 24, 29, 26, 1, 21, 174, 63726 }, // ợ
-    { 22, 32, 25, 2, 24, 176, 63900 }, // Ụ
-    { 19, 27, 21, 1, 19, 129, 64076 }, // ụ
-    { 22, 35, 25, 2, 34, 193, 64205 }, // Ủ
-    { 19, 29, 21, 1, 28, 138, 64398 }, // ủ
-    { 29, 33, 32, 2, 32, 240, 64536 }, // Ứ
-    { 27, 27, 29, 1, 26, 183, 64776 }, // ứ
-    { 29, 33, 32, 2, 32, 240, 64959 }, // Ừ
-    { 27, 27, 29, 1, 26, 183, 65199 }, // ừ
-    { 29, 35, 32, 2, 34, 254, 65382 }, // Ử
-    { 27, 29, 29, 1, 28, 196, 65636 }, // ử
-    { 29, 33, 32, 2, 32, 240, 65832 }, // Ữ
-    { 27, 27, 29, 1, 26, 183, 66072 }, // ữ
-    { 29, 34, 32, 2, 26, 247, 66255 }, // Ự
-    { 27, 29, 29, 1, 21, 196, 66502 }, // ự
-    { 19, 32, 23, 3, 32, 152, 66698 }, // Ỳ
-    { 23, 34, 21, -3, 26, 196, 66850 }, // ỳ
-    { 19, 32, 23, 3, 24, 152, 67046 }, // Ỵ
-    { 23, 27, 21, -3, 19, 156, 67198 }, // ỵ
-    { 19, 34, 23, 3, 34, 162, 67354 }, // Ỷ
-    { 23, 36, 21, -3, 28, 207, 67516 }, // ỷ
-    { 19, 32, 23, 3, 32, 152, 67723 }, // Ỹ
-    { 23, 34, 21, -3, 26, 196, 67875 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 68071 }, //  
-    { 0, 0, 33, 0, 0, 0, 68071 }, //  
-    { 0, 0, 17, 0, 0, 0, 68071 }, //  
-    { 0, 0, 33, 0, 0, 0, 68071 }, //  
-    { 0, 0, 11, 0, 0, 0, 68071 }, //  
-    { 0, 0, 8, 0, 0, 0, 68071 }, //  
-    { 0, 0, 6, 0, 0, 0, 68071 }, //  
-    { 0, 0, 18, 0, 0, 0, 68071 }, //  
-    { 0, 0, 10, 0, 0, 0, 68071 }, //  
-    { 0, 0, 6, 0, 0, 0, 68071 }, //  
-    { 0, 0, 3, 0, 0, 0, 68071 }, //  
-    { 0, 0, 1, 0, 0, 0, 68071 }, // ​
-    { 0, 0, 1, 0, 0, 0, 68071 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 68071 }, // ‍
-    { 9, 28, 9, -1, 23, 63, 68071 }, // ‎
-    { 9, 28, 2, -8, 23, 63, 68134 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 68197 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 68210 }, // ‑
-    { 17, 5, 19, 1, 14, 22, 68223 }, // ‒
-    { 16, 4, 17, 0, 11, 16, 68245 }, // –
-    { 32, 4, 33, 0, 11, 32, 68261 }, // —
-    { 32, 4, 33, 0, 11, 32, 68293 }, // ―
-    { 13, 34, 18, 3, 26, 111, 68325 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 68436 }, // ‗
-    { 9, 9, 11, 1, 24, 21, 68468 }, // ‘
-    { 9, 9, 11, 1, 24, 21, 68489 }, // ’
-    { 9, 9, 9, -2, 4, 21, 68510 }, // ‚
-    { 6, 9, 10, 3, 24, 14, 68531 }, // ‛
-    { 17, 9, 19, 1, 24, 39, 68545 }, // “
-    { 16, 9, 18, 1, 24, 36, 68584 }, // ”
-    { 16, 9, 17, -2, 4, 36, 68620 }, // „
-    { 13, 9, 17, 3, 24, 30, 68656 }, // ‟
-    { 15, 26, 19, 3, 26, 98, 68686 }, // †
-    { 17, 26, 19, 1, 26, 111, 68784 }, // ‡
-    { 10, 11, 13, 2, 18, 28, 68895 }, // •
-    { 11, 13, 13, 1, 19, 36, 68923 }, // ‣
-    { 7, 7, 17, 3, 6, 13, 68959 }, // ․
-    { 16, 7, 19, 0, 6, 28, 68972 }, // ‥
-    { 25, 7, 28, 0, 6, 44, 69000 }, // …
-    { 7, 7, 11, 2, 13, 13, 69044 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 69057 }, //  
-    { 0, 0, 20, 0, 0, 0, 69057 }, //  
-    { 9, 26, 9, -1, 21, 59, 69057 }, // ‪
-    { 9, 26, 2, -8, 21, 59, 69116 }, // ‫
-    { 8, 28, 5, -4, 23, 56, 69175 }, // ‬
-    { 8, 28, 5, -4, 23, 56, 69231 }, // ‭
-    { 8, 28, 5, -4, 23, 56, 69287 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 69343 }, //  
-    { 39, 26, 41, 1, 25, 254, 69343 }, // ‰
-    { 51, 26, 53, 1, 25, 332, 69597 }, // ‱
-    { 10, 9, 13, 2, 24, 23, 69929 }, // ′
-    { 18, 9, 21, 2, 24, 41, 69952 }, // ″
-    { 25, 9, 28, 2, 24, 57, 69993 }, // ‴
-    { 9, 9, 12, 2, 24, 21, 70050 }, // ‵
-    { 17, 9, 20, 2, 24, 39, 70071 }, // ‶
-    { 24, 9, 27, 2, 24, 54, 70110 }, // ‷
-    { 12, 11, 12, -3, 3, 33, 70164 }, // ‸
-    { 10, 16, 12, 1, 17, 40, 70197 }, // ‹
-    { 10, 16, 11, 0, 17, 40, 70237 }, // ›
-    { 27, 26, 29, 1, 25, 176, 70277 }, // ※
-    { 20, 25, 21, 0, 24, 125, 70453 }, // ‼
-    { 15, 26, 18, 2, 25, 98, 70578 }, // ‽
-    { 16, 4, 20, 3, 29, 16, 70676 }, // ‾
-    { 17, 8, 18, -2, 0, 34, 70692 }, // ‿
-    { 18, 8, 21, 2, 27, 36, 70726 }, // ⁀
-    { 17, 22, 15, -3, 14, 94, 70762 }, // ⁁
-    { 38, 31, 38, -1, 26, 295, 70856 }, // ⁂
-    { 10, 5, 11, 0, 11, 13, 71151 }, // ⁃
-    { 22, 24, 14, -9, 24, 132, 71164 }, // ⁄
-    { 15, 30, 15, -1, 24, 113, 71296 }, // ⁅
-    { 15, 30, 13, -3, 24, 113, 71409 }, // ⁆
-    { 30, 26, 33, 2, 25, 195, 71522 }, // ⁇
-    { 25, 26, 28, 2, 25, 163, 71717 }, // ⁈
-    { 26, 26, 27, 0, 25, 169, 71880 }, // ⁉
-    { 17, 19, 20, 2, 19, 81, 72049 }, // ⁊
-    { 18, 31, 22, 3, 26, 140, 72130 }, // ⁋
-    { 18, 18, 21, 1, 19, 81, 72270 }, // ⁌
-    { 18, 18, 21, 2, 19, 81, 72351 }, // ⁍
-    { 17, 17, 18, -1, 9, 73, 72432 }, // ⁎
-    { 9, 24, 11, 1, 19, 54, 72505 }, // ⁏
-    { 22, 35, 21, -2, 27, 193, 72559 }, // ⁐
-    { 20, 34, 20, -1, 26, 170, 72752 }, // ⁑
-    { 14, 26, 15, 0, 25, 91, 72922 }, // ⁒
-    { 32, 7, 34, 1, 13, 56, 73013 }, // ⁓
-    { 17, 8, 18, -3, 0, 34, 73069 }, // ⁔
-    { 19, 19, 20, 0, 18, 91, 73103 }, // ⁕
-    { 16, 26, 19, 1, 25, 104, 73194 }, // ⁖
-    { 30, 9, 33, 2, 24, 68, 73298 }, // ⁗
-    { 26, 26, 28, 1, 25, 169, 73366 }, // ⁘
-    { 26, 26, 28, 1, 25, 169, 73535 }, // ⁙
-    { 7, 26, 9, 1, 25, 46, 73704 }, // ⁚
-    { 22, 27, 24, 1, 26, 149, 73750 }, // ⁛
-    { 27, 27, 28, 0, 25, 183, 73899 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 74082 }, // ⁝
-    { 6, 26, 10, 2, 25, 39, 74130 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 74169 }, //  
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 74169 }, // ⁩
-    { 8, 28, 5, -4, 23, 56, 74169 }, // ⁪
-    { 8, 28, 5, -4, 23, 56, 74225 }, // ⁫
-    { 8, 28, 5, -4, 23, 56, 74281 }, // ⁬
-    { 8, 29, 5, -4, 24, 58, 74337 }, // ⁭
-    { 8, 28, 5, -4, 23, 56, 74395 }, // ⁮
-    { 8, 28, 5, -4, 23, 56, 74451 }, // ⁯
-    { 12, 16, 16, 3, 29, 48, 74507 }, // ⁰
-    { 7, 16, 10, 2, 25, 28, 74555 }, // ⁱ
-    { 14, 16, 16, 1, 29, 56, 74583 }, // ⁴
-    { 13, 16, 16, 2, 29, 52, 74639 }, // ⁵
-    { 12, 16, 16, 3, 29, 48, 74691 }, // ⁶
-    { 13, 16, 17, 3, 29, 52, 74739 }, // ⁷
-    { 13, 16, 16, 2, 29, 52, 74791 }, // ⁸
-    { 12, 16, 16, 3, 29, 48, 74843 }, // ⁹
-    { 11, 10, 15, 3, 25, 28, 74891 }, // ⁺
-    { 11, 3, 15, 3, 21, 9, 74919 }, // ⁻
-    { 10, 8, 15, 4, 24, 20, 74928 }, // ⁼
-    { 8, 19, 13, 4, 30, 38, 74948 }, // ⁽
-    { 9, 19, 10, 0, 30, 43, 74986 }, // ⁾
-    { 12, 12, 15, 2, 21, 36, 75029 }, // ⁿ
-    { 12, 16, 13, -1, 11, 48, 75065 }, // ₀
-    { 11, 16, 13, -1, 11, 44, 75113 }, // ₁
-    { 13, 16, 13, -2, 11, 52, 75157 }, // ₂
-    { 13, 16, 13, -2, 11, 52, 75209 }, // ₃
-    { 13, 16, 13, -2, 11, 52, 75261 }, // ₄
-    { 13, 16, 13, -2, 11, 52, 75313 }, // ₅
-    { 13, 16, 13, -1, 11, 52, 75365 }, // ₆
-    { 13, 16, 13, -1, 11, 52, 75417 }, // ₇
-    { 13, 16, 13, -2, 11, 52, 75469 }, // ₈
-    { 12, 16, 13, -1, 11, 48, 75521 }, // ₉
-    { 10, 10, 13, 0, 8, 25, 75569 }, // ₊
-    { 10, 3, 13, 0, 4, 8, 75594 }, // ₋
-    { 11, 8, 13, 0, 6, 22, 75602 }, // ₌
-    { 9, 19, 10, 0, 13, 43, 75624 }, // ₍
-    { 9, 19, 7, -4, 13, 43, 75667 }, // ₎
-    { 12, 12, 13, -1, 8, 36, 75710 }, // ₐ
-    { 11, 12, 12, -1, 8, 33, 75746 }, // ₑ
-    { 11, 12, 13, -1, 8, 33, 75779 }, // ₒ
-    { 14, 12, 12, -3, 8, 42, 75812 }, // ₓ
-    { 12, 12, 12, -2, 8, 36, 75854 }, // ₔ
-    { 13, 16, 15, -1, 12, 52, 75890 }, // ₕ
-    { 14, 16, 14, -1, 12, 56, 75942 }, // ₖ
-    { 8, 16, 8, -1, 12, 32, 75998 }, // ₗ
-    { 19, 12, 21, -1, 8, 57, 76030 }, // ₘ
-    { 13, 12, 13, -2, 8, 39, 76087 }, // ₙ
-    { 14, 16, 13, -3, 8, 56, 76126 }, // ₚ
-    { 10, 12, 11, -1, 8, 30, 76182 }, // ₛ
-    { 9, 15, 9, -1, 11, 34, 76212 }, // ₜ
-    { 19, 25, 21, 1, 25, 119, 76246 }, // ₠
-    { 20, 28, 22, 1, 26, 140, 76365 }, // ₡
-    { 20, 26, 22, 1, 25, 130, 76505 }, // ₢
-    { 20, 24, 21, 0, 24, 120, 76635 }, // ₣
-    { 22, 25, 22, -1, 25, 138, 76755 }, // ₤
-    { 29, 27, 30, 0, 23, 196, 76893 }, // ₥
-    { 21, 24, 22, 0, 24, 126, 77089 }, // ₦
-    { 29, 25, 30, 0, 24, 182, 77215 }, // ₧
-    { 31, 25, 32, 0, 24, 194, 77397 }, // ₨
-    { 27, 24, 28, 0, 24, 162, 77591 }, // ₩
-    { 28, 24, 30, 1, 24, 168, 77753 }, // ₪
-    { 23, 32, 24, 0, 26, 184, 77921 }, // ₫
-    { 21, 26, 22, 0, 25, 137, 78105 }, // €
-    { 23, 24, 24, 0, 24, 138, 78242 }, // ₭
-    { 20, 24, 22, 1, 24, 120, 78380 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 78500 }, // ₯
-    { 22, 33, 21, -2, 25, 182, 78773 }, // ₰
-    { 21, 24, 22, 0, 24, 126, 78955 }, // ₱
-    { 22, 29, 24, 1, 26, 160, 79081 }, // ₲
-    { 23, 24, 22, -2, 24, 138, 79241 }, // ₳
-    { 20, 26, 21, 0, 25, 130, 79379 }, // ₴
-    { 20, 29, 23, 2, 26, 145, 79509 }, // ₵
-    { 24, 24, 25, 0, 23, 144, 79654 }, // ₶
-    { 25, 28, 25, -1, 25, 175, 79798 }, // ₷
-    { 19, 24, 21, 1, 24, 114, 79973 }, // ₸
-    { 18, 24, 21, 2, 24, 108, 80087 }, // ₹
-    { 19, 25, 20, 0, 24, 119, 80195 }, // ₺
-    { 21, 26, 24, 2, 25, 137, 80314 }, // ₻
-    { 27, 24, 27, -1, 24, 162, 80451 }, // ₼
-    { 21, 24, 21, -1, 24, 126, 80613 }, // ₽
-    { 23, 28, 23, -1, 28, 161, 80739 }, // ₾
-    { 19, 32, 20, 0, 28, 152, 80900 }, // ₿
-    { 10, 5, 11, 0, 11, 13, 81052 }, // −
-    { 31, 32, 33, 1, 26, 248, 81065 }, // �
+    { 11, 25, 12, 0, 24, 43, 0 }, // !
+    { 13, 9, 17, 3, 24, 29, 43 }, // "
+    { 22, 24, 23, 0, 24, 90, 72 }, // #
+    { 19, 28, 20, 0, 26, 87, 162 }, // $
+    { 27, 26, 29, 1, 25, 121, 249 }, // %
+    { 23, 26, 25, 1, 25, 96, 370 }, // &
+    { 6, 9, 10, 3, 24, 16, 466 }, // '
+    { 13, 30, 15, 1, 24, 51, 482 }, // (
+    { 14, 31, 12, -3, 25, 58, 533 }, // )
+    { 17, 17, 20, 2, 26, 48, 591 }, // *
+    { 17, 17, 19, 1, 20, 41, 639 }, // +
+    { 9, 9, 10, -2, 4, 16, 680 }, // ,
+    { 10, 5, 11, 0, 11, 9, 696 }, // -
+    { 7, 7, 10, 0, 6, 12, 705 }, // .
+    { 19, 25, 18, -2, 24, 52, 717 }, // /
+    { 18, 26, 20, 1, 25, 83, 769 }, // 0
+    { 15, 24, 18, 2, 24, 58, 852 }, // 1
+    { 19, 25, 19, -1, 25, 71, 910 }, // 2
+    { 18, 26, 19, 0, 25, 73, 981 }, // 3
+    { 19, 24, 19, -1, 24, 67, 1054 }, // 4
+    { 19, 25, 20, 0, 24, 70, 1121 }, // 5
+    { 18, 26, 20, 1, 25, 78, 1191 }, // 6
+    { 19, 24, 21, 1, 24, 67, 1269 }, // 7
+    { 19, 26, 20, 0, 25, 86, 1336 }, // 8
+    { 17, 26, 19, 1, 25, 82, 1422 }, // 9
+    { 10, 20, 11, 0, 19, 28, 1504 }, // :
+    { 12, 24, 11, -2, 19, 34, 1532 }, // ;
+    { 17, 18, 19, 1, 21, 44, 1566 }, // <
+    { 17, 11, 19, 1, 17, 36, 1610 }, // =
+    { 17, 18, 19, 1, 21, 45, 1646 }, // >
+    { 15, 26, 18, 2, 25, 57, 1691 }, // ?
+    { 28, 28, 30, 1, 24, 142, 1748 }, // @
+    { 21, 24, 21, -2, 24, 80, 1890 }, // A
+    { 21, 24, 22, 0, 24, 87, 1970 }, // B
+    { 21, 26, 23, 1, 25, 72, 2057 }, // C
+    { 22, 24, 23, 0, 24, 88, 2129 }, // D
+    { 20, 24, 21, 0, 24, 72, 2217 }, // E
+    { 20, 24, 21, 0, 24, 67, 2289 }, // F
+    { 22, 26, 24, 1, 25, 92, 2356 }, // G
+    { 24, 24, 25, 0, 24, 88, 2448 }, // H
+    { 16, 24, 16, -1, 24, 57, 2536 }, // I
+    { 18, 32, 13, -6, 24, 76, 2593 }, // J
+    { 24, 24, 25, 0, 24, 93, 2669 }, // K
+    { 16, 24, 17, 0, 24, 57, 2762 }, // L
+    { 30, 24, 31, 0, 24, 124, 2819 }, // M
+    { 26, 24, 27, 0, 24, 97, 2943 }, // N
+    { 23, 26, 25, 1, 25, 94, 3040 }, // O
+    { 21, 24, 22, 0, 24, 76, 3134 }, // P
+    { 23, 31, 25, 1, 25, 111, 3210 }, // Q
+    { 20, 24, 21, 0, 24, 83, 3321 }, // R
+    { 19, 26, 20, 0, 25, 73, 3404 }, // S
+    { 19, 24, 22, 2, 24, 63, 3477 }, // T
+    { 22, 25, 25, 2, 24, 90, 3540 }, // U
+    { 20, 24, 24, 3, 24, 77, 3630 }, // V
+    { 30, 24, 34, 3, 24, 133, 3707 }, // W
+    { 25, 24, 24, -2, 24, 90, 3840 }, // X
+    { 19, 24, 23, 3, 24, 68, 3930 }, // Y
+    { 21, 24, 21, -1, 24, 70, 3998 }, // Z
+    { 15, 30, 15, -1, 24, 64, 4068 }, // [
+    { 9, 25, 14, 3, 24, 36, 4132 }, // <backslash>
+    { 15, 30, 13, -3, 24, 64, 4168 }, // ]
+    { 18, 16, 19, 0, 24, 47, 4232 }, // ^
+    { 15, 3, 13, -4, -3, 14, 4279 }, // _
+    { 8, 6, 13, 4, 26, 12, 4293 }, // `
+    { 19, 20, 21, 1, 19, 71, 4305 }, // a
+    { 19, 27, 20, 0, 26, 87, 4376 }, // b
+    { 16, 20, 18, 1, 19, 56, 4463 }, // c
+    { 20, 27, 22, 1, 26, 89, 4519 }, // d
+    { 17, 20, 19, 1, 19, 64, 4608 }, // e
+    { 21, 34, 18, -4, 26, 90, 4672 }, // f
+    { 20, 27, 21, 0, 19, 92, 4762 }, // g
+    { 19, 26, 20, 0, 26, 86, 4854 }, // h
+    { 11, 26, 12, 0, 26, 44, 4940 }, // i
+    { 16, 34, 12, -5, 26, 75, 4984 }, // j
+    { 21, 26, 22, 0, 26, 84, 5059 }, // k
+    { 11, 26, 12, 0, 26, 48, 5143 }, // l
+    { 29, 19, 30, 0, 19, 102, 5191 }, // m
+    { 19, 19, 20, 0, 19, 68, 5293 }, // n
+    { 18, 20, 20, 1, 19, 67, 5361 }, // o
+    { 21, 27, 20, -2, 19, 87, 5428 }, // p
+    { 19, 27, 21, 1, 19, 85, 5515 }, // q
+    { 16, 19, 17, 0, 19, 49, 5600 }, // r
+    { 16, 20, 17, 0, 19, 57, 5649 }, // s
+    { 14, 24, 16, 1, 23, 51, 5706 }, // t
+    { 19, 20, 21, 1, 19, 65, 5757 }, // u
+    { 18, 19, 20, 1, 19, 55, 5822 }, // v
+    { 26, 19, 29, 2, 19, 97, 5877 }, // w
+    { 22, 19, 21, -2, 19, 64, 5974 }, // x
+    { 23, 27, 21, -3, 19, 82, 6038 }, // y
+    { 17, 19, 17, -1, 19, 51, 6120 }, // z
+    { 15, 30, 15, -1, 24, 66, 6171 }, // {
+    { 4, 34, 18, 7, 26, 35, 6237 }, // |
+    { 14, 30, 13, -2, 24, 66, 6272 }, // }
+    { 17, 7, 19, 1, 15, 23, 6338 }, // ~
+    { 0, 0, 9, 0, 0, 0, 6361 }, //  
+    { 11, 26, 10, -2, 19, 41, 6361 }, // ¡
+    { 16, 26, 19, 2, 25, 63, 6402 }, // ¢
+    { 22, 25, 22, -1, 25, 73, 6465 }, // £
+    { 17, 16, 19, 1, 20, 52, 6538 }, // ¤
+    { 20, 24, 22, 1, 24, 79, 6590 }, // ¥
+    { 4, 34, 18, 7, 26, 31, 6669 }, // ¦
+    { 17, 27, 18, 0, 26, 76, 6700 }, // §
+    { 12, 6, 19, 6, 26, 15, 6776 }, // ¨
+    { 26, 26, 28, 1, 25, 122, 6791 }, // ©
+    { 13, 13, 16, 2, 25, 37, 6913 }, // ª
+    { 18, 16, 20, 1, 17, 59, 6950 }, // «
+    { 17, 10, 19, 1, 14, 28, 7009 }, // ¬
+    { 10, 5, 11, 0, 11, 9, 7037 }, // ­
+    { 26, 26, 28, 1, 25, 124, 7046 }, // ®
+    { 16, 4, 20, 3, 29, 22, 7170 }, // ¯
+    { 12, 13, 14, 1, 25, 31, 7192 }, // °
+    { 17, 21, 19, 1, 21, 56, 7223 }, // ±
+    { 14, 16, 16, 1, 29, 33, 7279 }, // ²
+    { 13, 16, 16, 2, 29, 39, 7312 }, // ³
+    { 10, 6, 14, 3, 26, 13, 7351 }, // ´
+    { 22, 27, 21, -2, 19, 87, 7364 }, // µ
+    { 18, 31, 22, 2, 26, 110, 7451 }, // ¶
+    { 7, 7, 10, 2, 15, 11, 7561 }, // ·
+    { 9, 8, 7, -4, 0, 15, 7572 }, // ¸
+    { 10, 16, 14, 3, 29, 27, 7587 }, // ¹
+    { 12, 12, 15, 2, 24, 30, 7614 }, // º
+    { 18, 16, 19, 0, 17, 54, 7644 }, // »
+    { 25, 26, 28, 2, 25, 105, 7698 }, // ¼
+    { 27, 26, 30, 2, 25, 101, 7803 }, // ½
+    { 27, 26, 29, 1, 25, 116, 7904 }, // ¾
+    { 14, 25, 16, -1, 19, 53, 8020 }, // ¿
+    { 21, 32, 21, -2, 32, 98, 8073 }, // À
+    { 23, 32, 22, -2, 32, 103, 8171 }, // Á
+    { 23, 32, 22, -2, 32, 104, 8274 }, // Â
+    { 24, 32, 23, -2, 32, 109, 8378 }, // Ã
+    { 22, 32, 21, -2, 32, 103, 8487 }, // Ä
+    { 21, 34, 21, -2, 34, 107, 8590 }, // Å
+    { 33, 24, 32, -2, 24, 119, 8697 }, // Æ
+    { 21, 33, 23, 1, 25, 89, 8816 }, // Ç
+    { 20, 32, 21, 0, 32, 90, 8905 }, // È
+    { 20, 32, 21, 0, 32, 89, 8995 }, // É
+    { 20, 32, 21, 0, 32, 93, 9084 }, // Ê
+    { 20, 32, 21, 0, 32, 93, 9177 }, // Ë
+    { 16, 32, 16, -1, 32, 73, 9270 }, // Ì
+    { 18, 32, 18, -1, 32, 75, 9343 }, // Í
+    { 18, 32, 18, -1, 32, 77, 9418 }, // Î
+    { 17, 32, 17, -1, 32, 74, 9495 }, // Ï
+    { 22, 24, 23, 0, 24, 93, 9569 }, // Ð
+    { 26, 32, 27, 0, 32, 124, 9662 }, // Ñ
+    { 23, 33, 25, 1, 32, 112, 9786 }, // Ò
+    { 23, 33, 25, 1, 32, 113, 9898 }, // Ó
+    { 23, 33, 25, 1, 32, 118, 10011 }, // Ô
+    { 23, 33, 25, 1, 32, 118, 10129 }, // Õ
+    { 23, 33, 25, 1, 32, 113, 10247 }, // Ö
+    { 16, 16, 19, 2, 20, 43, 10360 }, // ×
+    { 23, 28, 25, 1, 26, 109, 10403 }, // Ø
+    { 22, 33, 25, 2, 32, 109, 10512 }, // Ù
+    { 22, 33, 25, 2, 32, 108, 10621 }, // Ú
+    { 22, 33, 25, 2, 32, 112, 10729 }, // Û
+    { 22, 33, 25, 2, 32, 111, 10841 }, // Ü
+    { 19, 32, 23, 3, 32, 86, 10952 }, // Ý
+    { 20, 24, 21, 0, 24, 72, 11038 }, // Þ
+    { 27, 34, 23, -5, 26, 134, 11110 }, // ß
+    { 19, 27, 21, 1, 26, 86, 11244 }, // à
+    { 19, 27, 21, 1, 26, 88, 11330 }, // á
+    { 19, 27, 21, 1, 26, 92, 11418 }, // â
+    { 19, 27, 21, 1, 26, 92, 11510 }, // ã
+    { 19, 27, 21, 1, 26, 89, 11602 }, // ä
+    { 19, 29, 21, 1, 28, 97, 11691 }, // å
+    { 28, 20, 30, 1, 19, 106, 11788 }, // æ
+    { 16, 27, 18, 1, 19, 71, 11894 }, // ç
+    { 17, 27, 19, 1, 26, 80, 11965 }, // è
+    { 18, 27, 20, 1, 26, 81, 12045 }, // é
+    { 18, 27, 20, 1, 26, 84, 12126 }, // ê
+    { 17, 27, 19, 1, 26, 79, 12210 }, // ë
+    { 10, 26, 11, 0, 26, 45, 12289 }, // ì
+    { 14, 26, 15, 0, 26, 49, 12334 }, // í
+    { 14, 26, 15, 0, 26, 55, 12383 }, // î
+    { 13, 26, 14, 0, 26, 49, 12438 }, // ï
+    { 18, 27, 20, 1, 26, 85, 12487 }, // ð
+    { 20, 26, 21, 0, 26, 89, 12572 }, // ñ
+    { 18, 27, 20, 1, 26, 82, 12661 }, // ò
+    { 18, 27, 20, 1, 26, 84, 12743 }, // ó
+    { 18, 27, 20, 1, 26, 86, 12827 }, // ô
+    { 19, 27, 21, 1, 26, 88, 12913 }, // õ
+    { 18, 27, 20, 1, 26, 83, 13001 }, // ö
+    { 17, 17, 19, 1, 20, 41, 13084 }, // ÷
+    { 19, 22, 20, 0, 20, 76, 13125 }, // ø
+    { 19, 27, 21, 1, 26, 81, 13201 }, // ù
+    { 19, 27, 21, 1, 26, 82, 13282 }, // ú
+    { 19, 27, 21, 1, 26, 86, 13364 }, // û
+    { 19, 27, 21, 1, 26, 85, 13450 }, // ü
+    { 23, 34, 21, -3, 26, 101, 13535 }, // ý
+    { 21, 34, 20, -2, 26, 106, 13636 }, // þ
+    { 23, 34, 21, -3, 26, 103, 13742 }, // ÿ
+    { 22, 30, 21, -2, 30, 99, 13845 }, // Ā
+    { 19, 25, 21, 1, 24, 85, 13944 }, // ā
+    { 23, 32, 22, -2, 32, 106, 14029 }, // Ă
+    { 19, 27, 21, 1, 26, 91, 14135 }, // ă
+    { 21, 33, 21, -2, 24, 99, 14226 }, // Ą
+    { 19, 28, 21, 1, 19, 88, 14325 }, // ą
+    { 21, 33, 23, 1, 32, 89, 14413 }, // Ć
+    { 17, 27, 19, 1, 26, 73, 14502 }, // ć
+    { 21, 33, 23, 1, 32, 93, 14575 }, // Ĉ
+    { 17, 27, 19, 1, 26, 75, 14668 }, // ĉ
+    { 21, 33, 23, 1, 32, 88, 14743 }, // Ċ
+    { 16, 27, 18, 1, 26, 71, 14831 }, // ċ
+    { 22, 33, 24, 1, 32, 98, 14902 }, // Č
+    { 18, 27, 20, 1, 26, 79, 15000 }, // č
+    { 23, 32, 24, 0, 32, 114, 15079 }, // Ď
+    { 27, 27, 29, 1, 26, 110, 15193 }, // ď
+    { 22, 24, 23, 0, 24, 93, 15303 }, // Đ
+    { 22, 27, 24, 1, 26, 95, 15396 }, // đ
+    { 20, 30, 21, 0, 30, 88, 15491 }, // Ē
+    { 17, 25, 19, 1, 24, 78, 15579 }, // ē
+    { 20, 32, 21, 0, 32, 94, 15657 }, // Ĕ
+    { 18, 27, 20, 1, 26, 85, 15751 }, // ĕ
+    { 20, 32, 21, 0, 32, 88, 15836 }, // Ė
+    { 17, 27, 19, 1, 26, 79, 15924 }, // ė
+    { 20, 33, 21, 0, 24, 91, 16003 }, // Ę
+    { 17, 27, 19, 1, 19, 80, 16094 }, // ę
+    { 21, 32, 22, 0, 32, 94, 16174 }, // Ě
+    { 19, 27, 21, 1, 26, 87, 16268 }, // ě
+    { 22, 33, 24, 1, 32, 114, 16355 }, // Ĝ
+    { 20, 34, 21, 0, 26, 112, 16469 }, // ĝ
+    { 22, 33, 24, 1, 32, 115, 16581 }, // Ğ
+    { 20, 34, 21, 0, 26, 113, 16696 }, // ğ
+    { 22, 33, 24, 1, 32, 109, 16809 }, // Ġ
+    { 20, 34, 21, 0, 26, 107, 16918 }, // ġ
+    { 22, 33, 24, 1, 25, 108, 17025 }, // Ģ
+    { 20, 34, 21, 0, 26, 107, 17133 }, // ģ
+    { 24, 32, 25, 0, 32, 112, 17240 }, // Ĥ
+    { 19, 33, 20, 0, 33, 104, 17352 }, // ĥ
+    { 26, 24, 27, 0, 24, 100, 17456 }, // Ħ
+    { 19, 26, 20, 0, 26, 89, 17556 }, // ħ
+    { 18, 32, 18, -1, 32, 78, 17645 }, // Ĩ
+    { 15, 26, 16, 0, 26, 62, 17723 }, // ĩ
+    { 17, 30, 17, -1, 30, 72, 17785 }, // Ī
+    { 13, 24, 14, 0, 24, 48, 17857 }, // ī
+    { 18, 32, 18, -1, 32, 79, 17905 }, // Ĭ
+    { 14, 26, 15, 0, 26, 56, 17984 }, // ĭ
+    { 16, 33, 16, -1, 24, 75, 18040 }, // Į
+    { 13, 35, 12, -2, 26, 61, 18115 }, // į
+    { 16, 32, 16, -1, 32, 73, 18176 }, // İ
+    { 10, 19, 11, 0, 19, 32, 18249 }, // ı
+    { 26, 32, 26, -1, 24, 116, 18281 }, // Ĳ
+    { 21, 34, 22, 0, 26, 107, 18397 }, // ĳ
+    { 22, 40, 17, -6, 32, 102, 18504 }, // Ĵ
+    { 19, 34, 15, -5, 26, 83, 18606 }, // ĵ
+    { 24, 32, 25, 0, 24, 112, 18689 }, // Ķ
+    { 21, 34, 22, 0, 26, 100, 18801 }, // ķ
+    { 21, 19, 22, 0, 19, 66, 18901 }, // ĸ
+    { 17, 32, 18, 0, 32, 75, 18967 }, // Ĺ
+    { 16, 33, 17, 0, 33, 77, 19042 }, // ĺ
+    { 16, 32, 17, 0, 24, 72, 19119 }, // Ļ
+    { 13, 34, 12, -2, 26, 61, 19191 }, // ļ
+    { 20, 24, 21, 0, 24, 65, 19252 }, // Ľ
+    { 18, 26, 19, 0, 26, 68, 19317 }, // ľ
+    { 17, 24, 18, 0, 24, 65, 19385 }, // Ŀ
+    { 16, 26, 17, 0, 26, 68, 19450 }, // ŀ
+    { 17, 24, 17, -1, 24, 59, 19518 }, // Ł
+    { 12, 26, 13, 0, 26, 49, 19577 }, // ł
+    { 26, 32, 27, 0, 32, 119, 19626 }, // Ń
+    { 19, 26, 20, 0, 26, 85, 19745 }, // ń
+    { 26, 32, 27, 0, 24, 117, 19830 }, // Ņ
+    { 19, 27, 20, 0, 19, 84, 19947 }, // ņ
+    { 26, 32, 27, 0, 32, 121, 20031 }, // Ň
+    { 21, 26, 22, 0, 26, 91, 20152 }, // ň
+    { 22, 24, 24, 0, 24, 87, 20243 }, // ŉ
+    { 26, 31, 27, 0, 24, 117, 20330 }, // Ŋ
+    { 19, 27, 20, 0, 19, 87, 20447 }, // ŋ
+    { 23, 31, 25, 1, 30, 112, 20534 }, // Ō
+    { 18, 25, 20, 1, 24, 80, 20646 }, // ō
+    { 23, 33, 25, 1, 32, 118, 20726 }, // Ŏ
+    { 18, 27, 20, 1, 26, 86, 20844 }, // ŏ
+    { 25, 33, 27, 1, 32, 122, 20930 }, // Ő
+    { 22, 27, 24, 1, 26, 96, 21052 }, // ő
+    { 30, 26, 33, 2, 25, 115, 21148 }, // Œ
+    { 28, 20, 30, 1, 19, 106, 21263 }, // œ
+    { 21, 32, 22, 0, 32, 102, 21369 }, // Ŕ
+    { 17, 26, 18, 0, 26, 66, 21471 }, // ŕ
+    { 20, 32, 21, 0, 24, 98, 21537 }, // Ŗ
+    { 18, 27, 17, -2, 19, 64, 21635 }, // ŗ
+    { 22, 32, 23, 0, 32, 108, 21699 }, // Ř
+    { 18, 26, 19, 0, 26, 67, 21807 }, // ř
+    { 19, 33, 20, 0, 32, 89, 21874 }, // Ś
+    { 17, 27, 18, 0, 26, 76, 21963 }, // ś
+    { 19, 33, 20, 0, 32, 91, 22039 }, // Ŝ
+    { 17, 27, 18, 0, 26, 78, 22130 }, // ŝ
+    { 19, 33, 20, 0, 25, 89, 22208 }, // Ş
+    { 16, 27, 17, 0, 19, 71, 22297 }, // ş
+    { 20, 33, 21, 0, 32, 93, 22368 }, // Š
+    { 18, 27, 19, 0, 26, 79, 22461 }, // š
+    { 19, 32, 22, 2, 24, 81, 22540 }, // Ţ
+    { 14, 31, 16, 1, 23, 66, 22621 }, // ţ
+    { 19, 32, 22, 2, 32, 83, 22687 }, // Ť
+    { 18, 27, 20, 1, 26, 67, 22770 }, // ť
+    { 19, 24, 22, 2, 24, 67, 22837 }, // Ŧ
+    { 15, 24, 16, 0, 23, 57, 22904 }, // ŧ
+    { 22, 33, 25, 2, 32, 115, 22961 }, // Ũ
+    { 19, 27, 21, 1, 26, 87, 23076 }, // ũ
+    { 22, 31, 25, 2, 30, 106, 23163 }, // Ū
+    { 19, 25, 21, 1, 24, 81, 23269 }, // ū
+    { 22, 33, 25, 2, 32, 112, 23350 }, // Ŭ
+    { 19, 27, 21, 1, 26, 87, 23462 }, // ŭ
+    { 22, 35, 25, 2, 34, 116, 23549 }, // Ů
+    { 19, 29, 21, 1, 28, 92, 23665 }, // ů
+    { 24, 33, 27, 2, 32, 120, 23757 }, // Ű
+    { 22, 27, 24, 1, 26, 94, 23877 }, // ű
+    { 22, 33, 25, 2, 24, 108, 23971 }, // Ų
+    { 19, 28, 21, 1, 19, 83, 24079 }, // ų
+    { 30, 32, 34, 3, 32, 160, 24162 }, // Ŵ
+    { 26, 26, 29, 2, 26, 120, 24322 }, // ŵ
+    { 19, 32, 23, 3, 32, 90, 24442 }, // Ŷ
+    { 23, 34, 21, -3, 26, 105, 24532 }, // ŷ
+    { 19, 32, 23, 3, 32, 86, 24637 }, // Ÿ
+    { 21, 32, 21, -1, 32, 87, 24723 }, // Ź
+    { 18, 26, 18, -1, 26, 69, 24810 }, // ź
+    { 21, 32, 21, -1, 32, 87, 24879 }, // Ż
+    { 17, 26, 17, -1, 26, 66, 24966 }, // ż
+    { 22, 32, 22, -1, 32, 94, 25032 }, // Ž
+    { 19, 26, 19, -1, 26, 71, 25126 }, // ž
+    { 20, 34, 17, -4, 26, 81, 25197 }, // ſ
+    { 28, 27, 31, 2, 26, 108, 25278 }, // Ơ
+    { 24, 22, 26, 1, 21, 81, 25386 }, // ơ
+    { 34, 26, 36, 1, 25, 138, 25467 }, // Ƣ
+    { 28, 27, 30, 1, 19, 121, 25605 }, // ƣ
+    { 24, 24, 26, 1, 24, 90, 25726 }, // Ƥ
+    { 21, 34, 20, -2, 26, 109, 25816 }, // ƥ
+    { 19, 28, 20, 0, 24, 90, 25925 }, // Ʀ
+    { 18, 26, 19, 0, 25, 68, 26015 }, // Ƨ
+    { 16, 20, 17, 0, 19, 58, 26083 }, // ƨ
+    { 21, 24, 21, -1, 24, 67, 26141 }, // Ʃ
+    { 11, 34, 12, 0, 26, 68, 26208 }, // ƪ
+    { 14, 31, 16, 1, 23, 69, 26276 }, // ƫ
+    { 21, 24, 23, 1, 24, 69, 26345 }, // Ƭ
+    { 14, 27, 16, 1, 26, 61, 26414 }, // ƭ
+    { 19, 32, 22, 2, 24, 80, 26475 }, // Ʈ
+    { 29, 27, 32, 2, 26, 109, 26555 }, // Ư
+    { 27, 22, 29, 1, 21, 85, 26664 }, // ư
+    { 8, 6, 0, -14, 26, 10, 26749 }, // ̀
+    { 10, 6, 3, -8, 26, 12, 26759 }, // ́
+    { 14, 6, 10, -5, 26, 19, 26771 }, // ̂
+    { 15, 6, 1, -15, 26, 20, 26790 }, // ̃
+    { 11, 4, 9, -3, 24, 13, 26810 }, // ̄
+    { 15, 5, 12, -4, 29, 17, 26823 }, // ̅
+    { 13, 6, 11, -3, 26, 20, 26840 }, // ̆
+    { 6, 6, 7, 0, 26, 10, 26860 }, // ̇
+    { 12, 6, 10, -3, 26, 16, 26870 }, // ̈
+    { 8, 9, 0, -10, 28, 16, 26886 }, // ̉
+    { 9, 8, 9, -1, 28, 20, 26902 }, // ̊
+    { 16, 6, 13, -4, 26, 23, 26922 }, // ̋
+    { 15, 6, 12, -4, 26, 19, 26945 }, // ̌
+    { 6, 10, 7, 0, 26, 17, 26964 }, // ̍
+    { 12, 7, 10, -3, 26, 20, 26981 }, // ̎
+    { 14, 6, 0, -16, 26, 22, 27001 }, // ̏
+    { 12, 9, 10, -3, 29, 25, 27023 }, // ̐
+    { 13, 6, 10, -4, 26, 16, 27048 }, // ̑
+    { 9, 9, 8, -2, 24, 15, 27064 }, // ̒
+    { 9, 9, 8, -2, 24, 16, 27079 }, // ̓
+    { 5, 9, 6, 0, 24, 13, 27095 }, // ̔
+    { 9, 9, 8, -2, 24, 16, 27108 }, // ̕
+    { 8, 6, 2, -7, -1, 11, 27124 }, // ̖
+    { 10, 6, 3, -8, -1, 12, 27135 }, // ̗
+    { 7, 8, 2, -6, 0, 13, 27147 }, // ̘
+    { 8, 8, 2, -7, 0, 12, 27160 }, // ̙
+    { 11, 10, 14, 2, 26, 24, 27172 }, // ̚
+    { 10, 9, 9, -2, 26, 18, 27196 }, // ̛
+    { 6, 9, 5, -2, 0, 12, 27214 }, // ̜
+    { 8, 6, 2, -7, -1, 12, 27226 }, // ̝
+    { 9, 6, 3, -7, -1, 13, 27238 }, // ̞
+    { 8, 8, 2, -7, 0, 15, 27251 }, // ̟
+    { 8, 3, 2, -7, -2, 4, 27266 }, // ̠
+    { 9, 10, 3, -7, 2, 20, 27270 }, // ̡
+    { 8, 10, 5, -4, 2, 20, 27290 }, // ̢
+    { 7, 6, 0, -16, -2, 10, 27310 }, // ̣
+    { 12, 6, 4, -9, -1, 15, 27320 }, // ̤
+    { 9, 8, 3, -7, 0, 22, 27335 }, // ̥
+    { 7, 6, 10, 2, -2, 11, 27357 }, // ̦
+    { 9, 8, 3, -7, 0, 16, 27368 }, // ̧
+    { 7, 9, 2, -6, 0, 13, 27384 }, // ̨
+    { 7, 10, 2, -6, -1, 17, 27397 }, // ̩
+    { 14, 7, 5, -10, -1, 28, 27414 }, // ̪
+    { 13, 4, 5, -9, -2, 15, 27442 }, // ̫
+    { 14, 6, 6, -9, -1, 17, 27457 }, // ̬
+    { 14, 6, 5, -10, -1, 17, 27474 }, // ̭
+    { 13, 6, 5, -9, -1, 19, 27491 }, // ̮
+    { 13, 6, 5, -9, -1, 19, 27510 }, // ̯
+    { 15, 6, 6, -10, -1, 20, 27529 }, // ̰
+    { 12, 4, 4, -9, -2, 13, 27549 }, // ̱
+    { 17, 3, 7, -11, -3, 13, 27562 }, // ̲
+    { 16, 8, 6, -11, 0, 33, 27575 }, // ̳
+    { 14, 6, 8, -7, 13, 20, 27608 }, // ̴
+    { 15, 5, 8, -8, 11, 17, 27628 }, // ̵
+    { 26, 5, 14, -13, 12, 15, 27645 }, // ̶
+    { 12, 9, 7, -6, 14, 18, 27660 }, // ̷
+    { 20, 28, 11, -10, 26, 57, 27678 }, // ̸
+    { 6, 9, 4, -3, 0, 12, 27735 }, // ̹
+    { 14, 7, 5, -10, -1, 27, 27747 }, // ̺
+    { 14, 8, 5, -10, 0, 27, 27774 }, // ̻
+    { 13, 4, 5, -9, -2, 16, 27801 }, // ̼
+    { 8, 7, 8, -1, 26, 15, 27817 }, // ̽
+    { 8, 10, 8, -1, 29, 17, 27832 }, // ̾
+    { 15, 8, 12, -4, 33, 33, 27849 }, // ̿
+    { 8, 6, 6, -3, 26, 12, 27882 }, // ̀
+    { 10, 6, 11, 0, 26, 13, 27894 }, // ́
+    { 14, 6, 20, 5, 26, 20, 27907 }, // ͂
+    { 6, 7, 7, 0, 26, 11, 27927 }, // ̓
+    { 18, 6, 14, -5, 26, 24, 27938 }, // ̈́
+    { 7, 6, 3, -5, -2, 11, 27962 }, // ͅ
+    { 16, 7, 12, -5, 26, 29, 27973 }, // ͆
+    { 16, 8, 6, -11, 0, 33, 28002 }, // ͇
+    { 11, 7, 4, -8, -1, 21, 28035 }, // ͈
+    { 7, 6, 2, -6, -2, 9, 28056 }, // ͉
+    { 13, 8, 10, -4, 26, 26, 28065 }, // ͊
+    { 13, 14, 11, -3, 32, 33, 28091 }, // ͋
+    { 14, 9, 11, -4, 29, 29, 28124 }, // ͌
+    { 13, 7, 5, -9, -1, 18, 28153 }, // ͍
+    { 7, 8, 2, -6, 0, 13, 28171 }, // ͎
+    { 24, 24, 13, -12, 24, 96, 28184 }, // ͏
+    { 6, 8, 7, 0, 27, 12, 28280 }, // ͐
+    { 6, 9, 11, 4, 29, 12, 28292 }, // ͑
+    { 12, 9, 10, -3, 29, 23, 28304 }, // ͒
+    { 8, 7, 3, -6, -1, 13, 28327 }, // ͓
+    { 6, 7, 2, -5, -1, 12, 28340 }, // ͔
+    { 7, 7, 3, -5, -1, 12, 28352 }, // ͕
+    { 13, 7, 6, -8, -1, 26, 28364 }, // ͖
+    { 6, 9, 10, 3, 28, 15, 28390 }, // ͗
+    { 6, 6, 7, 0, 26, 10, 28405 }, // ͘
+    { 9, 7, 3, -7, -1, 18, 28415 }, // ͙
+    { 13, 8, 5, -9, 0, 29, 28433 }, // ͚
+    { 7, 8, 8, 0, 27, 11, 28462 }, // ͛
+    { 26, 7, 12, -15, -1, 32, 28473 }, // ͜
+    { 26, 7, 17, -10, 26, 34, 28505 }, // ͝
+    { 18, 4, 13, -6, 24, 18, 28539 }, // ͞
+    { 19, 4, 8, -12, -1, 20, 28557 }, // ͟
+    { 27, 6, 18, -10, 26, 31, 28577 }, // ͠
+    { 27, 7, 18, -10, 29, 33, 28608 }, // ͡
+    { 27, 8, 11, -17, 0, 33, 28641 }, // ͢
+    { 9, 9, 9, -1, 29, 24, 28674 }, // ͣ
+    { 9, 9, 9, -1, 29, 20, 28698 }, // ͤ
+    { 5, 11, 7, 1, 31, 16, 28718 }, // ͥ
+    { 8, 9, 8, -1, 29, 22, 28734 }, // ͦ
+    { 9, 8, 9, -1, 28, 24, 28756 }, // ͧ
+    { 7, 9, 8, 0, 29, 17, 28780 }, // ͨ
+    { 10, 11, 10, -1, 31, 28, 28797 }, // ͩ
+    { 9, 11, 8, -2, 31, 29, 28825 }, // ͪ
+    { 14, 9, 11, -4, 29, 35, 28854 }, // ͫ
+    { 7, 9, 8, 0, 29, 13, 28889 }, // ͬ
+    { 7, 10, 8, 0, 30, 18, 28902 }, // ͭ
+    { 8, 8, 9, 0, 28, 20, 28920 }, // ͮ
+    { 10, 8, 9, -2, 28, 19, 28940 }, // ͯ
+    { 21, 24, 21, -2, 24, 80, 28959 }, // Α
+    { 21, 24, 22, 0, 24, 87, 29039 }, // Β
+    { 20, 24, 21, 0, 24, 61, 29126 }, // Γ
+    { 22, 24, 22, -2, 24, 85, 29187 }, // Δ
+    { 20, 24, 21, 0, 24, 72, 29272 }, // Ε
+    { 21, 24, 21, -1, 24, 70, 29344 }, // Ζ
+    { 24, 24, 25, 0, 24, 88, 29414 }, // Η
+    { 23, 26, 25, 1, 25, 100, 29502 }, // Θ
+    { 16, 24, 16, -1, 24, 57, 29602 }, // Ι
+    { 24, 24, 25, 0, 24, 93, 29659 }, // Κ
+    { 20, 24, 20, -2, 24, 75, 29752 }, // Λ
+    { 30, 24, 31, 0, 24, 124, 29827 }, // Μ
+    { 26, 24, 27, 0, 24, 97, 29951 }, // Ν
+    { 20, 24, 21, 0, 24, 65, 30048 }, // Ξ
+    { 23, 26, 25, 1, 25, 94, 30113 }, // Ο
+    { 24, 24, 25, 0, 24, 88, 30207 }, // Π
+    { 21, 24, 22, 0, 24, 76, 30295 }, // Ρ
+    { 21, 24, 21, -1, 24, 67, 30371 }, // Σ
+    { 19, 24, 22, 2, 24, 63, 30438 }, // Τ
+    { 19, 24, 23, 3, 24, 68, 30501 }, // Υ
+    { 28, 26, 30, 1, 25, 112, 30569 }, // Φ
+    { 25, 24, 24, -2, 24, 90, 30681 }, // Χ
+    { 27, 24, 31, 3, 24, 102, 30771 }, // Ψ
+    { 25, 25, 25, -1, 25, 96, 30873 }, // Ω
+    { 19, 20, 21, 1, 19, 73, 30969 }, // α
+    { 22, 34, 21, -2, 26, 116, 31042 }, // β
+    { 17, 26, 19, 1, 19, 70, 31158 }, // γ
+    { 20, 27, 22, 1, 26, 89, 31228 }, // δ
+    { 16, 20, 17, 0, 19, 53, 31317 }, // ε
+    { 19, 33, 20, 0, 26, 89, 31370 }, // ζ
+    { 19, 27, 20, 0, 19, 86, 31459 }, // η
+    { 18, 27, 20, 1, 26, 90, 31545 }, // θ
+    { 10, 20, 13, 1, 19, 37, 31635 }, // ι
+    { 21, 19, 22, 0, 19, 66, 31672 }, // κ
+    { 20, 27, 19, -2, 26, 81, 31738 }, // λ
+    { 22, 27, 21, -2, 19, 91, 31819 }, // μ
+    { 17, 19, 19, 1, 19, 55, 31910 }, // ν
+    { 18, 33, 20, 1, 26, 94, 31965 }, // ξ
+    { 18, 20, 20, 1, 19, 67, 32059 }, // ο
+    { 24, 20, 26, 1, 19, 79, 32126 }, // π
+    { 20, 27, 19, -2, 19, 85, 32205 }, // ρ
+    { 16, 26, 18, 1, 19, 66, 32290 }, // ς
+    { 20, 20, 22, 1, 19, 67, 32356 }, // σ
+    { 17, 20, 19, 1, 19, 51, 32423 }, // τ
+    { 19, 20, 21, 1, 19, 62, 32474 }, // υ
+    { 24, 27, 26, 1, 19, 112, 32536 }, // φ
+    { 24, 28, 23, -2, 19, 91, 32648 }, // χ
+    { 25, 34, 27, 1, 26, 131, 32739 }, // ψ
+    { 26, 20, 28, 1, 19, 88, 32870 }, // ω
+    { 21, 32, 21, -2, 24, 96, 32958 }, // Ạ
+    { 19, 27, 21, 1, 19, 85, 33054 }, // ạ
+    { 21, 34, 21, -2, 34, 104, 33139 }, // Ả
+    { 19, 29, 21, 1, 28, 93, 33243 }, // ả
+    { 28, 33, 27, -2, 33, 118, 33336 }, // Ấ
+    { 23, 29, 25, 1, 28, 103, 33454 }, // ấ
+    { 22, 33, 21, -2, 33, 106, 33557 }, // Ầ
+    { 19, 29, 21, 1, 28, 95, 33663 }, // ầ
+    { 26, 35, 25, -2, 35, 119, 33758 }, // Ẩ
+    { 21, 31, 23, 1, 30, 103, 33877 }, // ẩ
+    { 23, 36, 22, -2, 36, 117, 33980 }, // Ẫ
+    { 19, 31, 21, 1, 30, 104, 34097 }, // ẫ
+    { 23, 40, 22, -2, 32, 122, 34201 }, // Ậ
+    { 19, 34, 21, 1, 26, 106, 34323 }, // ậ
+    { 23, 34, 22, -2, 34, 115, 34429 }, // Ắ
+    { 19, 30, 21, 1, 29, 101, 34544 }, // ắ
+    { 23, 34, 22, -2, 34, 115, 34645 }, // Ằ
+    { 19, 30, 21, 1, 29, 100, 34760 }, // ằ
+    { 23, 35, 22, -2, 35, 116, 34860 }, // Ẳ
+    { 19, 31, 21, 1, 30, 104, 34976 }, // ẳ
+    { 23, 36, 22, -2, 36, 120, 35080 }, // Ẵ
+    { 19, 31, 21, 1, 30, 102, 35200 }, // ẵ
+    { 23, 40, 22, -2, 32, 124, 35302 }, // Ặ
+    { 19, 34, 21, 1, 26, 106, 35426 }, // ặ
+    { 20, 32, 21, 0, 24, 87, 35532 }, // Ẹ
+    { 17, 27, 19, 1, 19, 78, 35619 }, // ẹ
+    { 20, 34, 21, 0, 34, 93, 35697 }, // Ẻ
+    { 17, 29, 19, 1, 28, 85, 35790 }, // ẻ
+    { 21, 32, 22, 0, 32, 95, 35875 }, // Ẽ
+    { 19, 27, 21, 1, 26, 85, 35970 }, // ẽ
+    { 25, 33, 26, 0, 33, 109, 36055 }, // Ế
+    { 23, 29, 25, 1, 28, 99, 36164 }, // ế
+    { 20, 33, 21, 0, 33, 95, 36263 }, // Ề
+    { 17, 29, 19, 1, 28, 89, 36358 }, // ề
+    { 23, 35, 24, 0, 35, 114, 36447 }, // Ể
+    { 21, 31, 23, 1, 30, 99, 36561 }, // ể
+    { 20, 36, 21, 0, 36, 106, 36660 }, // Ễ
+    { 18, 31, 20, 1, 30, 99, 36766 }, // ễ
+    { 20, 40, 21, 0, 32, 108, 36865 }, // Ệ
+    { 18, 34, 20, 1, 26, 98, 36973 }, // ệ
+    { 16, 34, 16, -1, 34, 76, 37071 }, // Ỉ
+    { 13, 28, 14, 0, 28, 49, 37147 }, // ỉ
+    { 16, 32, 16, -1, 24, 71, 37196 }, // Ị
+    { 12, 34, 12, -1, 26, 56, 37267 }, // ị
+    { 23, 33, 25, 1, 25, 112, 37323 }, // Ọ
+    { 18, 27, 20, 1, 19, 80, 37435 }, // ọ
+    { 23, 35, 25, 1, 34, 119, 37515 }, // Ỏ
+    { 18, 29, 20, 1, 28, 88, 37634 }, // ỏ
+    { 27, 34, 29, 1, 33, 125, 37722 }, // Ố
+    { 23, 29, 25, 1, 28, 100, 37847 }, // ố
+    { 23, 34, 25, 1, 33, 121, 37947 }, // Ồ
+    { 18, 29, 20, 1, 28, 92, 38068 }, // ồ
+    { 25, 36, 27, 1, 35, 128, 38160 }, // Ổ
+    { 21, 31, 23, 1, 30, 100, 38288 }, // ổ
+    { 23, 37, 25, 1, 36, 129, 38388 }, // Ỗ
+    { 18, 31, 20, 1, 30, 102, 38517 }, // ỗ
+    { 23, 40, 25, 1, 32, 136, 38619 }, // Ộ
+    { 18, 34, 20, 1, 26, 100, 38755 }, // ộ
+    { 28, 33, 31, 2, 32, 126, 38855 }, // Ớ
+    { 24, 27, 26, 1, 26, 98, 38981 }, // ớ
+    { 28, 33, 31, 2, 32, 127, 39079 }, // Ờ
+    { 24, 27, 26, 1, 26, 97, 39206 }, // ờ
+    { 28, 35, 31, 2, 34, 131, 39303 }, // Ở
+    { 24, 29, 26, 1, 28, 103, 39434 }, // ở
+    { 28, 33, 31, 2, 32, 131, 39537 }, // Ỡ
+    { 24, 27, 26, 1, 26, 102, 39668 }, // ỡ
+    { 28, 34, 31, 2, 26, 126, 39770 }, // Ợ
+    { 24, 29, 26, 1, 21, 99, 39896 }, // ợ
+    { 22, 32, 25, 2, 24, 106, 39995 }, // Ụ
+    { 19, 27, 21, 1, 19, 80, 40101 }, // ụ
+    { 22, 35, 25, 2, 34, 115, 40181 }, // Ủ
+    { 19, 29, 21, 1, 28, 86, 40296 }, // ủ
+    { 29, 33, 32, 2, 32, 128, 40382 }, // Ứ
+    { 27, 27, 29, 1, 26, 102, 40510 }, // ứ
+    { 29, 33, 32, 2, 32, 128, 40612 }, // Ừ
+    { 27, 27, 29, 1, 26, 100, 40740 }, // ừ
+    { 29, 35, 32, 2, 34, 135, 40840 }, // Ử
+    { 27, 29, 29, 1, 28, 107, 40975 }, // ử
+    { 29, 33, 32, 2, 32, 133, 41082 }, // Ữ
+    { 27, 27, 29, 1, 26, 105, 41215 }, // ữ
+    { 29, 34, 32, 2, 26, 128, 41320 }, // Ự
+    { 27, 29, 29, 1, 21, 103, 41448 }, // ự
+    { 19, 32, 23, 3, 32, 85, 41551 }, // Ỳ
+    { 23, 34, 21, -3, 26, 100, 41636 }, // ỳ
+    { 19, 32, 23, 3, 24, 82, 41736 }, // Ỵ
+    { 23, 27, 21, -3, 19, 89, 41818 }, // ỵ
+    { 19, 34, 23, 3, 34, 92, 41907 }, // Ỷ
+    { 23, 36, 21, -3, 28, 105, 41999 }, // ỷ
+    { 19, 32, 23, 3, 32, 90, 42104 }, // Ỹ
+    { 23, 34, 21, -3, 26, 107, 42194 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 42301 }, //  
+    { 0, 0, 33, 0, 0, 0, 42301 }, //  
+    { 0, 0, 17, 0, 0, 0, 42301 }, //  
+    { 0, 0, 33, 0, 0, 0, 42301 }, //  
+    { 0, 0, 11, 0, 0, 0, 42301 }, //  
+    { 0, 0, 8, 0, 0, 0, 42301 }, //  
+    { 0, 0, 6, 0, 0, 0, 42301 }, //  
+    { 0, 0, 18, 0, 0, 0, 42301 }, //  
+    { 0, 0, 10, 0, 0, 0, 42301 }, //  
+    { 0, 0, 6, 0, 0, 0, 42301 }, //  
+    { 0, 0, 3, 0, 0, 0, 42301 }, //  
+    { 0, 0, 1, 0, 0, 0, 42301 }, // ​
+    { 0, 0, 1, 0, 0, 0, 42301 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 42301 }, // ‍
+    { 9, 28, 9, -1, 23, 45, 42301 }, // ‎
+    { 9, 28, 2, -8, 23, 46, 42346 }, // ‏
+    { 10, 5, 11, 0, 11, 9, 42392 }, // ‐
+    { 10, 5, 11, 0, 11, 9, 42401 }, // ‑
+    { 17, 5, 19, 1, 14, 26, 42410 }, // ‒
+    { 16, 4, 17, 0, 11, 12, 42436 }, // –
+    { 32, 4, 33, 0, 11, 20, 42448 }, // —
+    { 32, 4, 33, 0, 11, 20, 42468 }, // ―
+    { 13, 34, 18, 3, 26, 102, 42488 }, // ‖
+    { 16, 8, 13, -4, 0, 32, 42590 }, // ‗
+    { 9, 9, 11, 1, 24, 17, 42622 }, // ‘
+    { 9, 9, 11, 1, 24, 16, 42639 }, // ’
+    { 9, 9, 9, -2, 4, 16, 42655 }, // ‚
+    { 6, 9, 10, 3, 24, 13, 42671 }, // ‛
+    { 17, 9, 19, 1, 24, 32, 42684 }, // “
+    { 16, 9, 18, 1, 24, 29, 42716 }, // ”
+    { 16, 9, 17, -2, 4, 29, 42745 }, // „
+    { 13, 9, 17, 3, 24, 28, 42774 }, // ‟
+    { 15, 26, 19, 3, 26, 60, 42802 }, // †
+    { 17, 26, 19, 1, 26, 69, 42862 }, // ‡
+    { 10, 11, 13, 2, 18, 23, 42931 }, // •
+    { 11, 13, 13, 1, 19, 25, 42954 }, // ‣
+    { 7, 7, 17, 3, 6, 12, 42979 }, // ․
+    { 16, 7, 19, 0, 6, 23, 42991 }, // ‥
+    { 25, 7, 28, 0, 6, 35, 43014 }, // …
+    { 7, 7, 11, 2, 13, 11, 43049 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 43060 }, //  
+    { 0, 0, 20, 0, 0, 0, 43060 }, //  
+    { 9, 26, 9, -1, 21, 39, 43060 }, // ‪
+    { 9, 26, 2, -8, 21, 39, 43099 }, // ‫
+    { 8, 28, 5, -4, 23, 39, 43138 }, // ‬
+    { 8, 28, 5, -4, 23, 44, 43177 }, // ‭
+    { 8, 28, 5, -4, 23, 44, 43221 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 43265 }, //  
+    { 39, 26, 41, 1, 25, 170, 43265 }, // ‰
+    { 51, 26, 53, 1, 25, 216, 43435 }, // ‱
+    { 10, 9, 13, 2, 24, 15, 43651 }, // ′
+    { 18, 9, 21, 2, 24, 28, 43666 }, // ″
+    { 25, 9, 28, 2, 24, 42, 43694 }, // ‴
+    { 9, 9, 12, 2, 24, 14, 43736 }, // ‵
+    { 17, 9, 20, 2, 24, 29, 43750 }, // ‶
+    { 24, 9, 27, 2, 24, 43, 43779 }, // ‷
+    { 12, 11, 12, -3, 3, 29, 43822 }, // ‸
+    { 10, 16, 12, 1, 17, 29, 43851 }, // ‹
+    { 10, 16, 11, 0, 17, 27, 43880 }, // ›
+    { 27, 26, 29, 1, 25, 117, 43907 }, // ※
+    { 20, 25, 21, 0, 24, 86, 44024 }, // ‼
+    { 15, 26, 18, 2, 25, 59, 44110 }, // ‽
+    { 16, 4, 20, 3, 29, 22, 44169 }, // ‾
+    { 17, 8, 18, -2, 0, 25, 44191 }, // ‿
+    { 18, 8, 21, 2, 27, 26, 44216 }, // ⁀
+    { 17, 22, 15, -3, 14, 54, 44242 }, // ⁁
+    { 38, 31, 38, -1, 26, 166, 44296 }, // ⁂
+    { 10, 5, 11, 0, 11, 10, 44462 }, // ⁃
+    { 22, 24, 14, -9, 24, 60, 44472 }, // ⁄
+    { 15, 30, 15, -1, 24, 65, 44532 }, // ⁅
+    { 15, 30, 13, -3, 24, 65, 44597 }, // ⁆
+    { 30, 26, 33, 2, 25, 115, 44662 }, // ⁇
+    { 25, 26, 28, 2, 25, 97, 44777 }, // ⁈
+    { 26, 26, 27, 0, 25, 99, 44874 }, // ⁉
+    { 17, 19, 20, 2, 19, 46, 44973 }, // ⁊
+    { 18, 31, 22, 3, 26, 123, 45019 }, // ⁋
+    { 18, 18, 21, 1, 19, 68, 45142 }, // ⁌
+    { 18, 18, 21, 2, 19, 65, 45210 }, // ⁍
+    { 17, 17, 18, -1, 9, 47, 45275 }, // ⁎
+    { 9, 24, 11, 1, 19, 34, 45322 }, // ⁏
+    { 22, 35, 21, -2, 27, 80, 45356 }, // ⁐
+    { 20, 34, 20, -1, 26, 105, 45436 }, // ⁑
+    { 14, 26, 15, 0, 25, 62, 45541 }, // ⁒
+    { 32, 7, 34, 1, 13, 40, 45603 }, // ⁓
+    { 17, 8, 18, -3, 0, 24, 45643 }, // ⁔
+    { 19, 19, 20, 0, 18, 57, 45667 }, // ⁕
+    { 16, 26, 19, 1, 25, 53, 45724 }, // ⁖
+    { 30, 9, 33, 2, 24, 56, 45777 }, // ⁗
+    { 26, 26, 28, 1, 25, 76, 45833 }, // ⁘
+    { 26, 26, 28, 1, 25, 83, 45909 }, // ⁙
+    { 7, 26, 9, 1, 25, 28, 45992 }, // ⁚
+    { 22, 27, 24, 1, 26, 69, 46020 }, // ⁛
+    { 27, 27, 28, 0, 25, 118, 46089 }, // ⁜
+    { 7, 27, 9, 1, 26, 36, 46207 }, // ⁝
+    { 6, 26, 10, 2, 25, 41, 46243 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 46284 }, //  
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 46284 }, // ⁩
+    { 8, 28, 5, -4, 23, 44, 46284 }, // ⁪
+    { 8, 28, 5, -4, 23, 46, 46328 }, // ⁫
+    { 8, 28, 5, -4, 23, 43, 46374 }, // ⁬
+    { 8, 29, 5, -4, 24, 44, 46417 }, // ⁭
+    { 8, 28, 5, -4, 23, 46, 46461 }, // ⁮
+    { 8, 28, 5, -4, 23, 43, 46507 }, // ⁯
+    { 12, 16, 16, 3, 29, 41, 46550 }, // ⁰
+    { 7, 16, 10, 2, 25, 26, 46591 }, // ⁱ
+    { 14, 16, 16, 1, 29, 38, 46617 }, // ⁴
+    { 13, 16, 16, 2, 29, 36, 46655 }, // ⁵
+    { 12, 16, 16, 3, 29, 41, 46691 }, // ⁶
+    { 13, 16, 17, 3, 29, 28, 46732 }, // ⁷
+    { 13, 16, 16, 2, 29, 46, 46760 }, // ⁸
+    { 12, 16, 16, 3, 29, 40, 46806 }, // ⁹
+    { 11, 10, 15, 3, 25, 19, 46846 }, // ⁺
+    { 11, 3, 15, 3, 21, 11, 46865 }, // ⁻
+    { 10, 8, 15, 4, 24, 9, 46876 }, // ⁼
+    { 8, 19, 13, 4, 30, 29, 46885 }, // ⁽
+    { 9, 19, 10, 0, 30, 30, 46914 }, // ⁾
+    { 12, 12, 15, 2, 21, 38, 46944 }, // ⁿ
+    { 12, 16, 13, -1, 11, 43, 46982 }, // ₀
+    { 11, 16, 13, -1, 11, 28, 47025 }, // ₁
+    { 13, 16, 13, -2, 11, 33, 47053 }, // ₂
+    { 13, 16, 13, -2, 11, 38, 47086 }, // ₃
+    { 13, 16, 13, -2, 11, 36, 47124 }, // ₄
+    { 13, 16, 13, -2, 11, 36, 47160 }, // ₅
+    { 13, 16, 13, -1, 11, 43, 47196 }, // ₆
+    { 13, 16, 13, -1, 11, 28, 47239 }, // ₇
+    { 13, 16, 13, -2, 11, 42, 47267 }, // ₈
+    { 12, 16, 13, -1, 11, 42, 47309 }, // ₉
+    { 10, 10, 13, 0, 8, 13, 47351 }, // ₊
+    { 10, 3, 13, 0, 4, 9, 47364 }, // ₋
+    { 11, 8, 13, 0, 6, 13, 47373 }, // ₌
+    { 9, 19, 10, 0, 13, 31, 47386 }, // ₍
+    { 9, 19, 7, -4, 13, 31, 47417 }, // ₎
+    { 12, 12, 13, -1, 8, 37, 47448 }, // ₐ
+    { 11, 12, 12, -1, 8, 32, 47485 }, // ₑ
+    { 11, 12, 13, -1, 8, 31, 47517 }, // ₒ
+    { 14, 12, 12, -3, 8, 31, 47548 }, // ₓ
+    { 12, 12, 12, -2, 8, 33, 47579 }, // ₔ
+    { 13, 16, 15, -1, 12, 41, 47612 }, // ₕ
+    { 14, 16, 14, -1, 12, 41, 47653 }, // ₖ
+    { 8, 16, 8, -1, 12, 24, 47694 }, // ₗ
+    { 19, 12, 21, -1, 8, 52, 47718 }, // ₘ
+    { 13, 12, 13, -2, 8, 33, 47770 }, // ₙ
+    { 14, 16, 13, -3, 8, 43, 47803 }, // ₚ
+    { 10, 12, 11, -1, 8, 27, 47846 }, // ₛ
+    { 9, 15, 9, -1, 11, 28, 47873 }, // ₜ
+    { 19, 25, 21, 1, 25, 80, 47901 }, // ₠
+    { 20, 28, 22, 1, 26, 111, 47981 }, // ₡
+    { 20, 26, 22, 1, 25, 89, 48092 }, // ₢
+    { 20, 24, 21, 0, 24, 65, 48181 }, // ₣
+    { 22, 25, 22, -1, 25, 82, 48246 }, // ₤
+    { 29, 27, 30, 0, 23, 126, 48328 }, // ₥
+    { 21, 24, 22, 0, 24, 95, 48454 }, // ₦
+    { 29, 25, 30, 0, 24, 114, 48549 }, // ₧
+    { 31, 25, 32, 0, 24, 134, 48663 }, // ₨
+    { 27, 24, 28, 0, 24, 120, 48797 }, // ₩
+    { 28, 24, 30, 1, 24, 132, 48917 }, // ₪
+    { 23, 32, 24, 0, 26, 113, 49049 }, // ₫
+    { 21, 26, 22, 0, 25, 79, 49162 }, // €
+    { 23, 24, 24, 0, 24, 93, 49241 }, // ₭
+    { 20, 24, 22, 1, 24, 77, 49334 }, // ₮
+    { 33, 33, 34, 0, 25, 154, 49411 }, // ₯
+    { 22, 33, 21, -2, 25, 110, 49565 }, // ₰
+    { 21, 24, 22, 0, 24, 75, 49675 }, // ₱
+    { 22, 29, 24, 1, 26, 117, 49750 }, // ₲
+    { 23, 24, 22, -2, 24, 84, 49867 }, // ₳
+    { 20, 26, 21, 0, 25, 86, 49951 }, // ₴
+    { 20, 29, 23, 2, 26, 94, 50037 }, // ₵
+    { 24, 24, 25, 0, 23, 91, 50131 }, // ₶
+    { 25, 28, 25, -1, 25, 111, 50222 }, // ₷
+    { 19, 24, 21, 1, 24, 73, 50333 }, // ₸
+    { 18, 24, 21, 2, 24, 68, 50406 }, // ₹
+    { 19, 25, 20, 0, 24, 78, 50474 }, // ₺
+    { 21, 26, 24, 2, 25, 90, 50552 }, // ₻
+    { 27, 24, 27, -1, 24, 94, 50642 }, // ₼
+    { 21, 24, 21, -1, 24, 77, 50736 }, // ₽
+    { 23, 28, 23, -1, 28, 99, 50813 }, // ₾
+    { 19, 32, 20, 0, 28, 105, 50912 }, // ₿
+    { 10, 5, 11, 0, 11, 9, 51017 }, // −
+    { 31, 32, 33, 1, 26, 132, 51026 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_bolditalicIntervals[] = {
@@ -5904,4 +4019,5 @@ static const EpdFontData notosans_16_bolditalic = {
     36,
     -10,
     true,
+    true,
 };
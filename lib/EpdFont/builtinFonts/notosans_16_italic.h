@@ -2,5408 +2,3739 @@
  * generated by fontconvert.py
  * name: notosans_16_italic
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_italicBitmaps[73856] = {
-    0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00,
-    0xBE, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x03, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x0F,
-    0x81, 0xF4, 0x7E, 0x0B, 0xD2, 0xF4, 0x3F, 0x0B, 0xC0, 0xFC, 0x3F, 0x03, 0xD0, 0xF4, 0x0F, 0x03,
-    0xC0, 0x7C, 0x0F, 0x01, 0xE0, 0x74, 0x07, 0x40, 0x00, 0x00, 0x3D, 0x00, 0xB4, 0x00, 0x00, 0x1F,
-    0x00, 0x3C, 0x00, 0x00, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x0B, 0x80, 0x00, 0x00, 0xF0,
-    0x03, 0xD0, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x2A, 0xAF, 0xEA,
-    0xBF, 0xAA, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x57, 0xF5, 0x5F, 0xD5, 0x50, 0x00, 0xF4, 0x03,
-    0xE0, 0x00, 0x00, 0x3C, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x2E,
-    0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-    0x00, 0x03, 0xE0, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00,
-    0x00, 0x2E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x01, 0xBD, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xD3, 0xD1, 0xE0, 0x0B, 0xD0, 0xF0, 0x00, 0x03, 0xF0, 0x7C, 0x00, 0x00, 0xF8, 0x2E, 0x00,
-    0x00, 0x3F, 0x0B, 0x40, 0x00, 0x0B, 0xE3, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xC3, 0xF0, 0x00, 0x00,
-    0xF0, 0x7D, 0x00, 0x00, 0x78, 0x1F, 0x40, 0x00, 0x2E, 0x0B, 0xD0, 0x40, 0x0F, 0x47, 0xF0, 0x3E,
-    0x43, 0xDB, 0xF4, 0x0F, 0xFF, 0xFF, 0xF4, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xE0, 0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xC0, 0x07,
-    0xE0, 0xF8, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0xBC,
-    0x00, 0x2E, 0x00, 0xBC, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0xF8,
-    0x0F, 0x80, 0x00, 0x7C, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x7C, 0x1A, 0x40, 0x7C,
-    0x03, 0xE0, 0xF4, 0xFF, 0xF0, 0x3D, 0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x3F, 0x6F, 0x8B, 0xC7, 0xD0,
-    0xBC, 0x1F, 0xFE, 0x1F, 0x0F, 0x80, 0x7C, 0x06, 0xE4, 0x3D, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-    0x2F, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0xBC, 0x00, 0x07, 0xC0, 0x3D, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x03,
-    0xE0, 0x01, 0xF0, 0x00, 0x3F, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0x0F, 0x80, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x86, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xC1, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0x00, 0x01, 0x40, 0xBF, 0x4B, 0xE0, 0x03, 0xF0, 0xBE, 0x00, 0xFC, 0x01, 0xF8, 0x7F, 0x00, 0x1F,
-    0xC0, 0xFC, 0x2F, 0x40, 0x02, 0xF8, 0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0xBE, 0x03, 0xF0, 0x00, 0x03,
-    0xFF, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0xE0, 0x03, 0xF9, 0x06, 0xFE,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x1F, 0xC0, 0x07, 0xFF, 0xF8, 0x02, 0xFC, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x87, 0xE2, 0xF4, 0xBC, 0x3F, 0x0F, 0x43, 0xC0, 0xF0, 0x74, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x24, 0x01, 0xF0, 0x00, 0x3F, 0x41, 0xE0, 0x00, 0x7F, 0xF6, 0xC0, 0x00, 0x06, 0xFF,
-    0xEB, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x2F, 0xE0, 0x59, 0x00, 0xFC, 0xF0, 0x00, 0x03, 0xF0,
-    0xF4, 0x00, 0x0F, 0xD0, 0xBC, 0x00, 0x0F, 0x80, 0x7D, 0x00, 0x02, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x57, 0xE5, 0x55, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
-    0x0F, 0x80, 0x2F, 0x00, 0x3D, 0x00, 0x14, 0x00, 0x05, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1,
-    0x55, 0x54, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0x97,
-    0xF8, 0x00, 0xBF, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x0B, 0xD0, 0x3F, 0x40, 0x01, 0xF8, 0x1F, 0xC0,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x01, 0xF8, 0x7E,
-    0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0,
-    0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0F,
-    0xC0, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x03, 0xF0, 0x07, 0xE0, 0x03, 0xF8, 0x00, 0xFE, 0x47,
-    0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0x40, 0xFF, 0xFC, 0x2F, 0xF7, 0xF0, 0xFE, 0x1F, 0x81,
-    0xD0, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x07,
-    0xFE, 0x5B, 0xFC, 0x00, 0x2D, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAA, 0xA8, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x00,
-    0x07, 0xFE, 0x5B, 0xFC, 0x00, 0x2D, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x6A, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0x00, 0x00, 0x2F, 0xC0, 0x7E, 0x50, 0x6F, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0x01,
-    0xF8, 0xF4, 0x00, 0x00, 0x7F, 0x2F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0xFD, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x0B, 0xE0, 0x0B, 0xC0, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAB, 0xFA, 0x80, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x69, 0x00, 0x00, 0x3F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x40, 0x00, 0x0B, 0xF0, 0x3E, 0x40, 0x6F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xE5, 0x64, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x6F, 0xE0, 0x00, 0xFC, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFD, 0x6F, 0xF0, 0x1F, 0xF4, 0x00, 0xFD, 0x0B, 0xF0, 0x00, 0x2F, 0x83, 0xF8, 0x00,
-    0x07, 0xE0, 0xFC, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0,
-    0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x07, 0xE0, 0x1F, 0xC0, 0x03, 0xF0, 0x03, 0xFD, 0x0B, 0xF8, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFD, 0x5B, 0xF4, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x07, 0xF0,
-    0x00, 0x3F, 0x42, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x07, 0xF8, 0x0F, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0x3F, 0x80, 0x2F, 0xE0, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF4,
-    0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x5B, 0xF4, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0xBD, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0,
-    0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x01, 0xFF, 0x01,
-    0xFE, 0x46, 0xFF, 0xC0, 0x2F, 0xFF, 0xF7, 0xE0, 0x01, 0xFF, 0xD2, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x06, 0x51, 0x7F, 0xE0, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xFD, 0x02, 0xFD, 0x02, 0xFD, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x3F, 0xC0, 0x7F, 0xC0, 0x3F, 0x40, 0x04, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x1F, 0x40, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0xBF, 0xE0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x2F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02,
-    0xF9, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x01, 0xFE, 0x5B, 0xF8, 0x08, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x1F, 0x80, 0x00, 0x10, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0x40, 0x7C, 0x0B, 0xC0,
-    0x0B, 0xFF, 0xFF, 0x00, 0xF4, 0x3E, 0x00, 0xBE, 0x00, 0xF4, 0x03, 0xD1, 0xF0, 0x0B, 0xD0, 0x07,
-    0xC0, 0x0F, 0x4B, 0xC0, 0x3E, 0x00, 0x2F, 0x00, 0x3D, 0x3E, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xF0,
-    0xF4, 0x0F, 0xC0, 0x03, 0xD0, 0x07, 0xC3, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x2F, 0x0F, 0x40, 0xF8,
-    0x00, 0xFC, 0x00, 0xF4, 0x3D, 0x03, 0xE0, 0x07, 0xF0, 0x0B, 0xC0, 0xF4, 0x0F, 0xC0, 0x7F, 0xC0,
-    0x7D, 0x03, 0xE0, 0x1F, 0xEF, 0xCF, 0xEF, 0xE0, 0x0F, 0xC0, 0x2F, 0xFC, 0x1F, 0xFD, 0x00, 0x1F,
-    0x40, 0x05, 0x00, 0x05, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xD4, 0x16, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00,
-    0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03,
-    0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF,
-    0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x80, 0x02, 0xFC,
-    0x00, 0xBD, 0x00, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F,
-    0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x0B, 0xD0, 0x00, 0x7F, 0x40, 0x3F, 0xEA, 0xBF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00,
-    0xBD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x00, 0x3F, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0xFF,
-    0x00, 0xFE, 0xAA, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F,
-    0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55,
-    0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-    0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01,
-    0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F,
-    0xEA, 0xAF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA,
-    0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA,
-    0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFA, 0xAB, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x18, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAA, 0xA4, 0x1F, 0xC0, 0x00, 0xFF, 0xFE,
-    0x0B, 0xE0, 0x00, 0x3F, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x2F, 0x80, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE5, 0x5B, 0xF8, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01,
-    0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x25, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8,
-    0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF,
-    0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03,
-    0xF4, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02,
-    0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0xF0, 0x00,
-    0x00, 0xFE, 0xF0, 0x00, 0xFD, 0xF0, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x07, 0xD7, 0xE0, 0x01, 0xF4, 0xF8, 0x00, 0x0F, 0xC7, 0xD0, 0x02,
-    0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x3E, 0x0F, 0xC0, 0x03, 0xF0, 0xBC,
-    0x00, 0xBC, 0x0F, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xF8, 0x1F, 0x80, 0x07, 0xD0, 0x7C, 0x02, 0xF0,
-    0x2F, 0x40, 0x0B, 0xC0, 0x7D, 0x03, 0xD0, 0x3F, 0x00, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x3F, 0x00,
-    0x0F, 0x80, 0x3D, 0x1F, 0x40, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x3F, 0x00, 0x7E, 0x00, 0x2F, 0x40,
-    0x3E, 0x7D, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x01, 0xF8,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D,
-    0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00,
-    0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F,
-    0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0,
-    0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02,
-    0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xE0, 0x02, 0xFD, 0x00, 0xBD, 0x00,
-    0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x1F,
-    0xF4, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xA5, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01,
-    0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00,
-    0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07,
-    0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0x80, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0,
-    0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x00,
-    0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x17, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x0B,
-    0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55, 0xBF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x02,
-    0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00,
-    0xFD, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAB, 0xF8, 0x00, 0xBF, 0x00, 0x01, 0x40, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x01, 0x00, 0x00, 0xBF, 0x00, 0x7E, 0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xF4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02,
-    0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07,
-    0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x2F, 0xCB, 0xC0,
-    0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0B, 0xE0, 0x7D, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x02,
-    0xF8, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x0B, 0xD0, 0x00, 0x2F, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0xBD, 0x00,
-    0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x3E, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x00, 0x03,
-    0xFB, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x1F, 0x80,
-    0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x0B,
-    0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xEF, 0x00, 0x02, 0xF4, 0x0F, 0x80, 0x02, 0xF7, 0xD0,
-    0x00, 0xFC, 0x03, 0xE0, 0x00, 0xF8, 0xF4, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x7C, 0x3D, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x1F, 0x43, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x0F, 0xC0, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x07, 0xD0, 0x3E, 0x02, 0xF4, 0x00, 0x3F, 0x03,
-    0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF4, 0x03, 0xE0, 0x7D, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x3F, 0x2F, 0x00, 0x0F, 0xCB,
-    0xC0, 0x00, 0x0B, 0xCF, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0x02, 0xF7, 0xC0, 0x00, 0xBD, 0xF0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0xBC,
-    0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F,
-    0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00,
-    0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC,
-    0x00, 0x0B, 0xEA, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0x55,
-    0x40, 0x00, 0x7D, 0x00, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xD0,
-    0x0F, 0x40, 0x3E, 0x00, 0xFC, 0x02, 0xF0, 0x0B, 0xC0, 0x1F, 0x00, 0x7D, 0x00, 0xF8, 0x03, 0xE0,
-    0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xD0, 0x0F, 0x80, 0x3E, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0xBF, 0xFC, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x7F, 0xFC,
-    0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00, 0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x0B,
-    0x80, 0xF4, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x02, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00,
-    0xBC, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x0B,
-    0xC7, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xD1, 0x55, 0x55, 0x55, 0x00, 0x2A, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5,
-    0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E,
-    0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F,
-    0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E,
-    0x0B, 0xFD, 0x00, 0x0B, 0xD7, 0xFF, 0xF4, 0x00, 0xFD, 0xF9, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0xFD,
-    0x00, 0xFF, 0x00, 0x07, 0xE0, 0x1F, 0xD0, 0x00, 0x7E, 0x02, 0xFC, 0x00, 0x07, 0xE0, 0x3F, 0x40,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0xFD, 0x00, 0x07, 0xF0, 0x1F, 0xF0, 0x01,
-    0xFD, 0x02, 0xFB, 0xD0, 0xBF, 0x80, 0x2E, 0x3F, 0xFF, 0xE0, 0x03, 0xD0, 0xBF, 0xF4, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00,
-    0x3F, 0xE5, 0x68, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x1F, 0xE0, 0x1B, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x0F,
-    0xF5, 0x7E, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00,
-    0xFC, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x7E, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x7E, 0x00,
-    0x03, 0xF8, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF0, 0x7E, 0xBC,
-    0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x1F, 0xFD, 0x0F, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03,
-    0xF8, 0x01, 0xF8, 0x2F, 0x80, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41,
-    0xBF, 0xD0, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x5B, 0xF5, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x29, 0xFE,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0x1F, 0x00, 0x0F, 0xF5, 0x6E, 0xFC,
-    0x00, 0xFE, 0x00, 0x3F, 0xE0, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x01,
-    0xF8, 0x00, 0x2F, 0xD0, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x0F, 0xF4, 0x7E, 0xBC, 0x00, 0x1F, 0xFF,
-    0xE3, 0xF0, 0x00, 0x1F, 0xFD, 0x0F, 0x80, 0x00, 0x01, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x08, 0x00, 0x07, 0xF0, 0x00, 0x3F,
-    0x96, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x0B, 0xFE, 0x00, 0x0B, 0xD7, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x6F, 0xC0,
-    0x0F, 0xFC, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x0B, 0xD0, 0x1F, 0xD0, 0x00, 0xBD, 0x02, 0xFC, 0x00,
-    0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xF8, 0x07,
-    0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x06, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF8,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0xBD, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x26, 0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01,
-    0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02,
-    0xF1, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-    0x2F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B,
-    0xFC, 0x00, 0xBF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0x03, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x7F, 0x4F,
-    0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xBD, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBD,
-    0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x1F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x3F,
-    0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x1F,
-    0x80, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x07, 0xC0, 0xFF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x0F, 0xDF, 0xD6, 0xFD, 0x00, 0xFF, 0xD0,
-    0x0F, 0xD0, 0x1F, 0xF0, 0x00, 0xBE, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x02,
-    0xF4, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8,
-    0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD,
-    0x5F, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBD,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1,
-    0xF8, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F,
-    0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xE4, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0xFD, 0x00,
-    0x02, 0xF1, 0xFF, 0xFD, 0x00, 0x0F, 0xDF, 0x97, 0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x00, 0xFF,
-    0x00, 0x07, 0xE0, 0x07, 0xF4, 0x00, 0x1F, 0x80, 0x2F, 0xC0, 0x00, 0x7E, 0x00, 0xFD, 0x00, 0x01,
-    0xF8, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0x80, 0x00, 0x3F, 0x40, 0x7D, 0x00, 0x00, 0xFC, 0x02,
-    0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x01, 0xFF, 0x00,
-    0x1F, 0xD0, 0x0B, 0xEF, 0x42, 0xFE, 0x00, 0x2F, 0x3F, 0xFF, 0xE0, 0x00, 0xFC, 0x2F, 0xFD, 0x00,
-    0x03, 0xF0, 0x05, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C,
-    0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00,
-    0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x7F, 0x03,
-    0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01,
-    0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F,
-    0xC1, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x07, 0xFF, 0x47, 0xE0, 0x00, 0x01, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x7F, 0xC0, 0x0B, 0xC7, 0xFF, 0x00, 0x3F, 0x7E, 0xA4,
-    0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0xBC, 0x0B, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xF0, 0xF4, 0x02, 0xFD, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xD0, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x50, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x1F, 0x80,
-    0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x07, 0xF0, 0x0F,
-    0xC0, 0x03, 0xF4, 0x02, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x7E, 0x00,
-    0x07, 0xD0, 0x3F, 0x00, 0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x0F, 0x87, 0xD0,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x0F, 0xC0, 0x02,
-    0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0xBB, 0xD0, 0x03, 0xF0,
-    0x3F, 0x00, 0x3D, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x2F, 0x3D, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x4F,
-    0x40, 0xBD, 0x00, 0xFC, 0x0B, 0xC3, 0xD0, 0x3F, 0x00, 0x3F, 0x03, 0xE0, 0xF8, 0x1F, 0x40, 0x0B,
-    0xC1, 0xF0, 0x3E, 0x0F, 0xC0, 0x02, 0xF0, 0xF8, 0x0F, 0x87, 0xE0, 0x00, 0xBC, 0x7C, 0x03, 0xE2,
-    0xF0, 0x00, 0x2F, 0x3E, 0x00, 0xB8, 0xF8, 0x00, 0x0B, 0xCF, 0x00, 0x2E, 0xBC, 0x00, 0x02, 0xFB,
-    0x80, 0x0B, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0xC0,
-    0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0xFD, 0x00,
-    0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x2F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x03, 0xF7, 0xE0,
-    0x00, 0x00, 0x2F, 0x8B, 0xC0, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x7E, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00,
-    0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00,
-    0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x15, 0x56, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1A, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x0F, 0xE4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF9, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x01, 0x1F, 0xFF,
-    0xF8, 0x02, 0xCB, 0xE6, 0xFF, 0xFF, 0xF2, 0x40, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xB8, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xE0, 0x06, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0x5B, 0xC0, 0x07, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x96, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x04, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x02, 0xAF, 0xFA, 0xA8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x15, 0xFD, 0x55,
-    0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x08, 0x00, 0x00, 0x20, 0xF8, 0x7F, 0x93, 0xE2, 0xFF,
-    0xFF, 0xFF, 0x02, 0xFE, 0x5B, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x3D, 0x00, 0x0B, 0x81, 0xF0, 0x00,
-    0x1F, 0x07, 0xC0, 0x00, 0x3C, 0x0F, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0xFC,
-    0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0x7F, 0xFA, 0xF8, 0xB0, 0x05, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00, 0xFC, 0x01, 0xF4,
-    0x00, 0x0F, 0xD0, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x3F,
-    0x00, 0x00, 0x7D, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00,
-    0x07, 0xC7, 0xD0, 0x00, 0x00, 0x0F, 0x7F, 0x00, 0x00, 0x05, 0x7F, 0xF5, 0x40, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x01, 0xAA, 0xFE, 0xA9, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x2A, 0xBF, 0xEA, 0x80, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x14, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFD, 0x00, 0x14, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x0F, 0x80, 0xBF, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x03, 0xD0, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x3E,
-    0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0xFF, 0x9F, 0xC0, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0xE4, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x06,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x47, 0xD0, 0x7D, 0xBD, 0x0B, 0xD7,
-    0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x3E, 0x00, 0x05, 0x40, 0x0F, 0x80, 0x0B, 0x80, 0x0B, 0xFF, 0xC0, 0x3D, 0x00,
-    0xF0, 0x07, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xFD, 0x00, 0x40, 0x0F, 0x43, 0xC0, 0x2F, 0x40,
-    0x00, 0x00, 0x78, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3C,
-    0x78, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x78, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0x82, 0xD0, 0x0F, 0x80, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0xBF, 0xAB, 0xC0, 0x0F, 0x00, 0xB8, 0x01,
-    0xFF, 0xFC, 0x03, 0xD0, 0x03, 0xD0, 0x01, 0xA5, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xA0, 0x7F, 0xBB, 0x83, 0xD0, 0x7D, 0x1E, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0E, 0x0E, 0x00,
-    0xB4, 0x78, 0x03, 0xD0, 0xF0, 0x2F, 0x03, 0xFB, 0xFC, 0x03, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x7C, 0x03, 0xD0, 0x07, 0xE0, 0x3F, 0x00, 0x7E, 0x02, 0xF0, 0x0B, 0xE0,
-    0x2F, 0x40, 0xBF, 0x02, 0xF8, 0x07, 0xF0, 0x1F, 0xC0, 0x1F, 0x80, 0xFC, 0x00, 0x3F, 0x02, 0xF4,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFC, 0x0B, 0xC0, 0x01, 0xF4, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x00,
-    0x03, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x55, 0x6F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1A, 0x05, 0x55, 0x42, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0xBF,
-    0xFE, 0x00, 0x3D, 0x00, 0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xBC, 0x07, 0xE0, 0x0F,
-    0x43, 0xC0, 0x0B, 0xC0, 0x3F, 0x00, 0x78, 0x3C, 0x00, 0xBC, 0x03, 0xF0, 0x03, 0xC7, 0x80, 0x0B,
-    0xC0, 0x3E, 0x00, 0x3C, 0x78, 0x00, 0xBD, 0x6F, 0xC0, 0x03, 0xC7, 0x80, 0x0B, 0xFF, 0xF0, 0x00,
-    0x3C, 0x78, 0x00, 0xBE, 0xBE, 0x00, 0x03, 0xC3, 0xC0, 0x0B, 0xC2, 0xF0, 0x00, 0x3C, 0x3C, 0x00,
-    0xBC, 0x0F, 0xC0, 0x07, 0x82, 0xD0, 0x0B, 0xC0, 0x7D, 0x00, 0xB4, 0x0F, 0x00, 0xBC, 0x03, 0xF0,
-    0x0F, 0x00, 0xB8, 0x0B, 0xC0, 0x1F, 0x83, 0xD0, 0x03, 0xD0, 0x54, 0x00, 0x54, 0xBC, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x00, 0xBC, 0x3D, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3D,
-    0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x05, 0x55, 0xF9, 0x55, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x40, 0x01, 0xFF, 0xF4, 0x03, 0xFA, 0xFC, 0x01, 0x40, 0x7C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x02, 0xFF, 0xF0, 0x03, 0xE6, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0xAF, 0xD0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x10, 0x02, 0xF0, 0x7E, 0xAF, 0xD0, 0x3F, 0xFF,
-    0x40, 0x01, 0x50, 0x00, 0x00, 0x69, 0x00, 0xFD, 0x03, 0xF4, 0x0B, 0xD0, 0x1F, 0x40, 0x3C, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00,
-    0x07, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F,
-    0xC0, 0x03, 0xF0, 0x00, 0xBF, 0x80, 0x07, 0xF0, 0x01, 0xFF, 0x40, 0x0B, 0xFC, 0x1F, 0xDF, 0x40,
-    0x0B, 0xFF, 0xFF, 0x2F, 0x00, 0x0F, 0xDF, 0xF8, 0x2F, 0x00, 0x0F, 0x81, 0x40, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF,
-    0xFF, 0xF5, 0x5E, 0x3F, 0xFF, 0xFD, 0x07, 0x9F, 0xFF, 0xFF, 0x41, 0xEB, 0xFF, 0xFF, 0xD0, 0x7B,
-    0xFF, 0xFF, 0xF4, 0x1E, 0xFF, 0xFF, 0xFD, 0x07, 0xBF, 0xFF, 0xFF, 0x41, 0xEF, 0xFF, 0xFF, 0xD0,
-    0x7A, 0xFF, 0xFF, 0xF4, 0x1E, 0x7F, 0xFF, 0xFD, 0x07, 0x8F, 0xFF, 0xFF, 0x41, 0xE2, 0xFF, 0xFF,
-    0xD0, 0x78, 0x3F, 0xFF, 0xF4, 0x1E, 0x01, 0xFF, 0xFD, 0x07, 0x80, 0x00, 0x0B, 0x41, 0xE0, 0x00,
-    0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B, 0x41, 0xE0,
-    0x00, 0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B, 0x41,
-    0xE0, 0x00, 0x02, 0xD0, 0x78, 0x00, 0x00, 0xB4, 0x1E, 0x00, 0x00, 0x2D, 0x07, 0x80, 0x00, 0x0B,
-    0x41, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x03, 0xC0,
-    0x1E, 0x00, 0xFE, 0x00, 0x7D, 0x00, 0xF4, 0x07, 0xDB, 0xFE, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7E,
-    0x02, 0xFD, 0x1F, 0xBC, 0x3D, 0x7C, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0xF4, 0x01, 0xF0, 0x01, 0xF0,
-    0x02, 0xE0, 0x03, 0xD0, 0x03, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0x00, 0x7F, 0xBE, 0x03, 0xD0, 0x3C, 0x1E, 0x00, 0xB4, 0xF0, 0x02, 0xD3, 0xC0, 0x0B, 0x4F,
-    0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x0F, 0x41, 0xFA, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x08, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0xBC, 0x07, 0xD0, 0x00,
-    0xF8, 0x0F, 0xC0, 0x02, 0xF0, 0x1F, 0x40, 0x07, 0xE0, 0x3F, 0x00, 0x2F, 0xC0, 0xBD, 0x01, 0xFC,
-    0x07, 0xF0, 0x0F, 0xC0, 0x7F, 0x00, 0xFC, 0x07, 0xF0, 0x0B, 0xC0, 0x3F, 0x00, 0x7D, 0x03, 0xF0,
-    0x00, 0x90, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0xB8, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0x00, 0x7E, 0xF0, 0x00, 0x03, 0xD0, 0x0F,
-    0x5F, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xE0, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xD0, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00,
-    0x00, 0xB8, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0xFC, 0x00, 0xF0, 0x0F, 0xC0, 0x2F,
-    0xC0, 0x1F, 0x02, 0xF0, 0x07, 0xF8, 0x02, 0xF0, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x3C,
-    0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x1F, 0x00, 0x00, 0xBC, 0x03, 0xD2, 0xE0, 0x00, 0x1F, 0x40, 0xB8,
-    0x2D, 0x00, 0x03, 0xE0, 0x1F, 0x03, 0xD0, 0x00, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x2F, 0x00, 0x7F,
-    0xFF, 0xFC, 0x07, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0x40, 0x07, 0xEF, 0x00, 0x00, 0x3E, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2E, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xB8, 0x01, 0xF4, 0x05, 0x40, 0x00, 0xF4, 0x03, 0xE0, 0xBF, 0xF4,
-    0x00, 0xF0, 0x0F, 0xC3, 0xFA, 0xFC, 0x01, 0xF0, 0x2F, 0x00, 0x40, 0x3D, 0x02, 0xF0, 0x7D, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0F,
-    0x80, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07,
-    0x80, 0x3E, 0xAF, 0xC0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x6F, 0x40, 0x01, 0xF4, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0xFC, 0x10,
-    0x02, 0xF0, 0x2F, 0x00, 0xBF, 0x0F, 0xAB, 0xF4, 0x1F, 0x00, 0x7F, 0x83, 0xFF, 0xF4, 0x0F, 0x40,
-    0x7F, 0xD0, 0x05, 0x40, 0x0F, 0x80, 0x3C, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x7C, 0x00, 0x00,
-    0x07, 0xC0, 0x3D, 0x1E, 0x00, 0x00, 0x03, 0xD0, 0x2E, 0x0B, 0x80, 0x00, 0x03, 0xE0, 0x1F, 0x03,
-    0xD0, 0x00, 0x02, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0xF4,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x03,
-    0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xD0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF8,
-    0x07, 0xE0, 0xBF, 0xFF, 0xFC, 0x0B, 0xFF, 0xF8, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x80,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x00,
-    0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x00,
-    0x7F, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC2, 0xF8,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3D, 0x00, 0x00, 0x1E,
-    0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB,
-    0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x3C, 0x00,
-    0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x00, 0x01, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B,
-    0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,
-    0x01, 0xD0, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x1B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02,
-    0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB,
-    0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xD3,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x42, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xFA, 0xAA, 0xA0, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xF8, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAB, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE,
-    0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8,
-    0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xD4, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFC,
-    0x00, 0x00, 0x0B, 0xD3, 0xD0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xF8, 0xF8, 0x00, 0x1F,
-    0x40, 0xF4, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0x90, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0xFC, 0x0F, 0xC0, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0B, 0xE4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x7F,
-    0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x3F,
-    0x1A, 0xFA, 0xA9, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00,
-    0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40,
-    0x00, 0x00, 0x1F, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xF4, 0x00, 0x00, 0x0B, 0x42, 0xFF,
-    0x80, 0x00, 0x00, 0x28, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0xFF,
-    0x40, 0x00, 0x0B, 0xD0, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0xFD, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xE3, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0x8B, 0xC0, 0x00, 0xBC,
-    0x00, 0x7D, 0x1F, 0x80, 0x03, 0xF0, 0x02, 0xF0, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0xBD, 0x00,
-    0x7E, 0x00, 0x3F, 0x00, 0xF8, 0x02, 0xF4, 0x00, 0xF8, 0x03, 0xF0, 0x0B, 0xC0, 0x07, 0xD0, 0x07,
-    0xD0, 0x3F, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x2F, 0x07, 0xE0, 0x03, 0xE0,
-    0x00, 0x7E, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0xFC, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF7, 0xF0, 0x02,
-    0xF0, 0x00, 0x03, 0xEF, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0xF0,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x7F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B,
-    0xEB, 0xE0, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF,
-    0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00,
-    0xFD, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2F,
-    0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xE0,
-    0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE0,
-    0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x00,
-    0x3F, 0x02, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF,
-    0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x00,
-    0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00,
-    0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x06, 0x00, 0x00, 0x07, 0xFE,
-    0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFB, 0xD0, 0x00, 0x02, 0xE0, 0xBF, 0xF0, 0x00, 0x00, 0xA0, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F,
-    0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B,
-    0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F,
-    0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2,
-    0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03,
-    0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00,
-    0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x80, 0x00,
-    0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x24, 0x3F,
-    0x00, 0x00, 0xBD, 0x1F, 0xC0, 0x02, 0xF8, 0x07, 0xF0, 0x0B, 0xE0, 0x01, 0xFC, 0x2F, 0x80, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xBE, 0x7F, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x0B, 0xE0, 0x07, 0xF0, 0x2F, 0x80, 0x01, 0xFC, 0x2E,
-    0x00, 0x00, 0x7C, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0xFC, 0x00, 0x0B,
-    0xFE, 0x5B, 0xFF, 0xC0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xFC, 0x00,
-    0x3F, 0x40, 0x00, 0x7F, 0xF4, 0x02, 0xF8, 0x00, 0x03, 0xFB, 0xE0, 0x0F, 0xC0, 0x00, 0x3F, 0x1F,
-    0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x3F, 0x03, 0xF4, 0x00, 0x2F, 0x80, 0xFC, 0x0F, 0xC0, 0x01, 0xF8,
-    0x03, 0xF0, 0x7F, 0x00, 0x0F, 0xC0, 0x1F, 0xC1, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x0B, 0xE0, 0x0F,
-    0xD0, 0x02, 0xF8, 0x2F, 0x80, 0xBE, 0x00, 0x0F, 0xD0, 0xBE, 0x07, 0xE0, 0x00, 0x3F, 0x02, 0xF8,
-    0x3F, 0x00, 0x02, 0xFC, 0x07, 0xF3, 0xF0, 0x00, 0x0F, 0xD0, 0x0F, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0xE5, 0x6F, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x2F, 0xFF, 0xD0, 0x00, 0x01, 0xD0, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07,
-    0xE0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0,
-    0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00,
-    0x07, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4,
-    0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F,
-    0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFD,
-    0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x07, 0xD0, 0x00, 0x00,
-    0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0,
-    0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x56, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x00, 0xB4, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00,
-    0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E,
-    0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00,
-    0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xAA, 0x40,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0x0B, 0xF4, 0x01, 0xF8,
-    0x00, 0x2F, 0xC0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x03, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0xFC, 0x00,
-    0x2F, 0xE0, 0x0F, 0xEA, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xA4, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFD, 0x01, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0x40,
-    0x7F, 0x80, 0x00, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3E, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xFC, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xF8, 0x00,
-    0x1F, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0,
-    0x00, 0x0B, 0xD3, 0xD0, 0x2F, 0xD0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xC1, 0xFF,
-    0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x05, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x26, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00,
-    0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8,
-    0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF,
-    0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80,
-    0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F,
-    0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0x80, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x01, 0xE0, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03,
-    0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0,
-    0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F,
-    0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x01, 0x80, 0x00, 0x7F, 0xE0, 0x3C, 0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x01, 0xE0,
-    0xBF, 0xF0, 0x00, 0x2C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00,
-    0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0,
-    0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x07,
-    0xE0, 0x7E, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5,
-    0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00,
-    0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E,
-    0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F,
-    0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFA, 0xF0, 0x00, 0x00, 0x1D, 0x07, 0x80, 0x00, 0x02, 0xC0, 0x38,
-    0x00, 0x00, 0x1E, 0x0B, 0x40, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C,
-    0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00,
-    0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03,
-    0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03,
-    0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F,
-    0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0xB0, 0xBF, 0xE0, 0x00, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF,
-    0xC0, 0x0F, 0xF5, 0x7E, 0xFF, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xE0, 0xBF, 0x00,
-    0x0F, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0xFF, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x0F, 0xD0, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0xFC, 0x06, 0xFF, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0x00,
-    0x01, 0xFF, 0xFF, 0x90, 0x07, 0xE0, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x82, 0xF7, 0xFF, 0x80, 0x6D, 0x01, 0xFF, 0xFC, 0x7E, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFE, 0x07, 0x87, 0xFF, 0xF4, 0x00, 0x05, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xE5, 0x68, 0x03, 0xF8,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0F, 0x50, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x7F, 0x40, 0xFE,
-    0x00, 0x7E, 0x0B, 0xE0, 0x01, 0xF8, 0x3F, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x7F, 0x0F, 0xD0, 0x6F,
-    0xF4, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x90, 0x07, 0xE4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06, 0xD0, 0x0B,
-    0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8, 0x0B, 0xE0, 0x01, 0xF8, 0x0F,
-    0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x2F, 0xFC, 0x00, 0x02, 0xF4, 0xF8, 0x00, 0x2F, 0x41, 0xF4, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x7F,
-    0x40, 0xFE, 0x00, 0x7E, 0x0B, 0xE0, 0x01, 0xF8, 0x3F, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x7F, 0x0F,
-    0xD0, 0x6F, 0xF4, 0x3F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x90, 0x07, 0xE4, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06,
-    0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x10, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x0F, 0xC0, 0x03, 0xD0, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x03,
-    0xFD, 0x5F, 0xD0, 0x3F, 0x80, 0x1F, 0x82, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x02, 0xF4, 0x7E, 0x00,
-    0x1F, 0xC3, 0xF4, 0x1B, 0xFD, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x01, 0xF9, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01,
-    0xFE, 0x01, 0xB4, 0x02, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0,
-    0x01, 0xF8, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8,
-    0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-    0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0xE0, 0x02, 0xF5, 0xF4, 0x0F, 0xC0, 0xBC, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00,
-    0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x04, 0x03, 0xE0, 0x3D, 0x07, 0xE0, 0x7E, 0x03,
-    0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x7C, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xF4, 0xFC,
-    0x00, 0x00, 0x74, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x06,
-    0xA8, 0x1F, 0x00, 0x07, 0xFF, 0xF9, 0xF4, 0x02, 0xFF, 0xAF, 0xEF, 0x40, 0xBF, 0x40, 0x1F, 0xF4,
-    0x0F, 0xC0, 0x00, 0xBF, 0x42, 0xF4, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x7E, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x07, 0xF0, 0x02, 0xFD, 0x06, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24,
-    0x00, 0x03, 0xFE, 0x02, 0xD0, 0x00, 0x2F, 0xFF, 0xBF, 0x00, 0x00, 0xF0, 0x7F, 0xF0, 0x00, 0x07,
-    0x40, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x03, 0xFF,
-    0x80, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x03, 0xF7, 0xF5, 0xBF, 0x40, 0x0F, 0xFD, 0x00, 0xFD, 0x00,
-    0x7F, 0xC0, 0x02, 0xF8, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0xBD,
-    0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x7E,
-    0x00, 0x02, 0xF8, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xF5, 0x7F,
-    0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC2, 0xF4, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0,
-    0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03,
-    0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xF5, 0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F,
-    0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00,
-    0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x0F, 0x40,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xF5, 0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F,
-    0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x50, 0x02, 0x40,
-    0x03, 0xFF, 0x02, 0xD0, 0x02, 0xFF, 0xFA, 0xF0, 0x00, 0xF0, 0x7F, 0xF4, 0x00, 0x74, 0x01, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E,
-    0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x02,
-    0xF0, 0x2F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x2E, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x00, 0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0x15,
-    0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0xFF, 0xE3, 0xE0, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7F, 0xD5, 0xFF, 0x40, 0x0F, 0xD0, 0x07, 0xF8, 0x02, 0xF4, 0x01, 0xFF, 0xC0, 0x3F, 0x00, 0x3E,
-    0xFC, 0x0B, 0xD0, 0x0F, 0xCB, 0xC0, 0xFC, 0x02, 0xF0, 0xBC, 0x0F, 0xC0, 0x7D, 0x0F, 0xC0, 0xF8,
-    0x1F, 0x80, 0xFC, 0x1F, 0x43, 0xE0, 0x0F, 0x81, 0xF4, 0xFC, 0x01, 0xF4, 0x1F, 0xAF, 0x00, 0x3F,
-    0x00, 0xFF, 0xD0, 0x0B, 0xD0, 0x0F, 0xF8, 0x01, 0xFC, 0x00, 0x7F, 0x80, 0xBF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xF7, 0xFF, 0xE0, 0x00, 0x1D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B,
-    0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0,
-    0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8,
-    0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F,
-    0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x07, 0xD0, 0x3D, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD,
-    0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E,
-    0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00,
-    0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00,
-    0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x04, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x2D, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80,
-    0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF,
-    0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xFF, 0x40, 0x00, 0xBD, 0x7F, 0xFF, 0x40, 0x03, 0xF7,
-    0xE5, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x01, 0xFD, 0x00, 0x07,
-    0xE0, 0x0B, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x07,
-    0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x07, 0xF4, 0x02, 0xFB, 0xD0, 0xBF, 0x80,
-    0x0B, 0xCF, 0xFF, 0xF8, 0x00, 0x3F, 0x0B, 0xFF, 0x40, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x42, 0xF4,
-    0x00, 0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00,
-    0x1F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00, 0x01,
-    0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x25, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80,
-    0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF,
-    0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00,
-    0x3F, 0xAF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x01,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAF,
-    0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0x40, 0x0A, 0x00, 0x00, 0x78, 0x01, 0xF0, 0x00,
-    0x03, 0xFA, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F,
-    0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00,
-    0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80,
-    0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE,
-    0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0,
-    0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00,
-    0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0,
-    0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0,
-    0x00, 0x01, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00,
-    0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xF9, 0x5A, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x07, 0xF8, 0x06, 0xC0, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x00, 0x7E, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x02, 0xF5, 0xF4, 0x00, 0x3F, 0x02, 0xF0, 0x02, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF9, 0x5A, 0x00, 0xFE,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06, 0xC0, 0x0B,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0,
-    0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFE, 0x56,
-    0x80, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x01,
-    0xB0, 0x02, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x28,
-    0x00, 0x18, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFE, 0xAB, 0xF4, 0x00, 0x7F, 0xD0, 0x00, 0x10, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x55, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x95, 0xA0, 0x03, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0,
-    0x1B, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x19, 0x00, 0x00, 0x03, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00,
-    0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02,
-    0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF,
-    0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0x00, 0x0F,
-    0xFF, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xF5, 0x7E, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFE, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x00, 0x03,
-    0xF0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xF8, 0x00, 0x7F, 0xE0, 0x00, 0xBD, 0x00, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x80, 0x0F,
-    0xC0, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0xBD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0xBF, 0xFF,
-    0xFC, 0x00, 0x3F, 0x1A, 0xFA, 0xA9, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xE0, 0x00, 0x01, 0xFD, 0x01, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0xBD, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x06, 0xFF, 0x00, 0x0F, 0xEA, 0xAF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x15,
-    0x5B, 0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xFE, 0x0B, 0xC0, 0x00, 0x1F, 0xFF, 0xF3,
-    0xF0, 0x00, 0x1F, 0xF5, 0x6E, 0xFC, 0x00, 0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F,
-    0x40, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xFD, 0x00,
-    0x03, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0xFF, 0x07, 0xEB, 0xC0, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00,
-    0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x40,
-    0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0A,
-    0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xF8,
-    0x2F, 0x80, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41, 0xBF, 0xD0, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x2F, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x90, 0x02, 0x80, 0x00, 0x1E, 0x00,
-    0x7C, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x0F, 0xEB, 0xF4,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8,
-    0x0B, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x0B, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFD, 0x5F, 0xD0, 0x3F, 0x80,
-    0x1F, 0x82, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x02, 0xF4, 0x7E, 0x00, 0x1F, 0xC3, 0xF4, 0x1B, 0xFD,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE4, 0x01, 0xF9, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xB4, 0x02, 0xFF,
-    0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x80,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xF8, 0x2F, 0x80, 0x07,
-    0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41, 0xBF, 0xD0, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x01, 0x7D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x90, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x09, 0x00, 0x0A, 0x00, 0x0F, 0x40, 0x7D, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x02, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xFF, 0x57, 0xF4, 0x03, 0xF8, 0x01, 0xF8,
-    0x0B, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x02, 0xF4, 0x1F, 0x80, 0x07, 0xF0, 0x3F, 0x41, 0xBF, 0xD0,
-    0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40,
-    0x0B, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x4F,
-    0x80, 0x00, 0x00, 0x2F, 0x41, 0xF4, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xEA, 0xAF, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x60, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x06, 0xAA, 0x90, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xFD, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x1F,
-    0xE0, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0x95, 0x6F, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x02, 0xF0,
-    0x2F, 0x00, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0xF0, 0x00, 0x7F, 0xFF, 0xC7, 0xC0, 0x03, 0xFD, 0x5B, 0xBF, 0x00, 0x3F,
-    0x80, 0x0F, 0xF8, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00,
-    0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00,
-    0x0B, 0xF4, 0x00, 0xFC, 0x00, 0xBF, 0xD0, 0x03, 0xFD, 0x1F, 0xAF, 0x00, 0x07, 0xFF, 0xF8, 0xFC,
-    0x00, 0x07, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE5, 0xBF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x18, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xAA, 0xBF,
-    0x80, 0x07, 0xFD, 0x00, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1A, 0xAA, 0x41,
-    0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFF, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0x00, 0x0B,
-    0xFE, 0x55, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x80, 0x02, 0x80, 0x00, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x1F,
-    0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x1F, 0xFF, 0xF1, 0xF0, 0x00,
-    0xFF, 0x56, 0xEF, 0xC0, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xE0,
-    0x00, 0x3F, 0x80, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0x47, 0xEB,
-    0xC0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00, 0x00, 0x10, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x80, 0x00,
-    0x7F, 0x00, 0x03, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0A, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x07, 0xFF, 0xAA, 0xBF, 0x80, 0x07, 0xFD, 0x00, 0x01, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x1A, 0xAA, 0x41, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFF, 0xF4, 0x2F,
-    0x80, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x7F,
-    0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x7F,
-    0x80, 0x00, 0x3F, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00,
-    0x1F, 0xFF, 0xF1, 0xF0, 0x00, 0xFF, 0x56, 0xEF, 0xC0, 0x0F, 0xE0, 0x03, 0xFE, 0x00, 0xBF, 0x00,
-    0x07, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x02, 0xFD, 0x00, 0x3F, 0x00, 0x2F,
-    0xF4, 0x00, 0xFF, 0x47, 0xEB, 0xC0, 0x01, 0xFF, 0xFE, 0x3F, 0x00, 0x01, 0xFF, 0xD0, 0xF8, 0x00,
-    0x00, 0x10, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x03, 0xF9, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0x00, 0x0A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFA, 0xAB, 0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x18,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAA, 0xA4, 0x1F, 0xC0, 0x00, 0xFF, 0xFE, 0x0B,
-    0xE0, 0x00, 0x3F, 0xFF, 0x42, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x2F,
-    0x80, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xE5, 0x5B, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0xF0, 0x00,
-    0x7F, 0xFF, 0xC7, 0xC0, 0x03, 0xFD, 0x5B, 0xBF, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x02, 0xFC, 0x00,
-    0x1F, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF0,
-    0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x00, 0xFC, 0x00, 0xBF,
-    0xD0, 0x03, 0xFD, 0x1F, 0xAF, 0x00, 0x07, 0xFF, 0xF8, 0xFC, 0x00, 0x07, 0xFF, 0x43, 0xE0, 0x00,
-    0x00, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x02, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE5, 0xBF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
-    0x00, 0x2B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x00, 0x2F, 0x41,
-    0xF0, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x1F, 0xFD, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xBF, 0xE0, 0x00, 0xBD,
-    0x7F, 0xFF, 0x80, 0x0F, 0xDF, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0xBD,
-    0x01, 0xFD, 0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x07, 0xD0, 0x2F, 0x40, 0x00,
-    0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC2, 0xAF, 0xEA, 0xAA, 0xAB, 0xFE, 0x90, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xEA, 0xAA, 0xAF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x16,
-    0xFD, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xF9, 0x00, 0x0B, 0xC3, 0xFF, 0xF4, 0x00, 0xFC,
-    0xFE, 0xBF, 0xC0, 0x0F, 0xFD, 0x00, 0xFD, 0x00, 0xFF, 0x40, 0x0B, 0xD0, 0x1F, 0xD0, 0x00, 0xBD,
-    0x02, 0xFC, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x01, 0xF8, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x7D, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x40, 0x02, 0x00, 0x03, 0xFE, 0x02, 0xC0, 0x03,
-    0xFF, 0xFB, 0xF0, 0x00, 0xF0, 0x7F, 0xF0, 0x00, 0x74, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x01, 0x80, 0x7F, 0xE0,
-    0x3C, 0x0F, 0xFF, 0xEF, 0x42, 0xE0, 0xBF, 0xF0, 0x28, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA4, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xBE, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x06,
-    0xAA, 0xA9, 0x0B, 0xFF, 0xFD, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0xEB, 0xF8,
-    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x06, 0x00, 0x0A, 0x02, 0xE0, 0x07, 0x80, 0x7F, 0xAF, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x6E, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F,
-    0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0x80, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x00, 0x3D,
-    0x00, 0x00, 0xF4, 0x00, 0x03, 0xFA, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x2F, 0x90,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF8, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0xBD, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x02, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0xD0,
-    0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0x80, 0x2F, 0x40, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x0B, 0xC0, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xF9, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x01, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x2F, 0x40, 0x0B, 0xFF, 0xFC, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x15, 0xBF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x40, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xBD, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x0B, 0xD0, 0x01,
-    0xF8, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x1F,
-    0x40, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0xBC, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x67, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x25, 0x7F, 0xC0,
-    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x02,
-    0xF5, 0xF4, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x02, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x9B, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00,
-    0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80,
-    0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF4, 0x00,
-    0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00,
-    0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00,
-    0x00, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02, 0xF1, 0xFC, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00,
-    0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F,
-    0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x01, 0xF8, 0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02, 0xF0,
-    0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-    0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02,
-    0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03,
-    0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA7,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1A, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x03,
-    0xF0, 0x07, 0xC0, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0xBD, 0x01, 0xE0, 0x00, 0x2F, 0x00, 0xA0, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xEA, 0xAA, 0xA0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x50,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0xFC, 0x3F, 0x00, 0x07, 0xE1, 0xF0, 0x00, 0x2F, 0x4F, 0x40, 0x00,
-    0xBC, 0x78, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x03, 0xF0, 0x01, 0x40, 0x3F, 0x00, 0xBE, 0x03, 0xE0, 0x0F, 0xE0, 0x7E, 0x00, 0xBC, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x7F, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x14, 0x00, 0xF8, 0xBE, 0x01, 0xF4, 0xFE, 0x02, 0xF4, 0x7C, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x0B, 0xD1, 0xC0, 0x00, 0xFD, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xD0,
-    0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x23, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x2F,
-    0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00,
-    0x0F, 0xED, 0x00, 0xFF, 0xD0, 0x2F, 0xF0, 0x0B, 0xF4, 0x07, 0xFF, 0x00, 0xBF, 0xF0, 0x01, 0x7E,
-    0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03,
-    0xFD, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0,
-    0x03, 0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02,
-    0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4,
-    0x01, 0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40,
-    0x1F, 0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F,
-    0x80, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0,
-    0x0B, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F,
-    0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x7C, 0x0F, 0xFE, 0x00, 0x0B, 0xC7, 0xFF, 0xFC, 0x00, 0xFD, 0xFD, 0x6F, 0xD0, 0x0F,
-    0xFD, 0x00, 0xFD, 0x01, 0xFF, 0x00, 0x0B, 0xE0, 0x2F, 0xD0, 0x00, 0xBD, 0x03, 0xFC, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x02, 0xF8, 0x0B, 0xE0,
-    0x00, 0x2F, 0x40, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x07, 0xF0,
-    0x1F, 0x80, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03,
-    0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0,
-    0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01,
-    0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F,
-    0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80,
-    0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B,
-    0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07,
-    0xC0, 0xFF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x0F, 0xDF, 0xD6, 0xFD, 0x00, 0xFF, 0xD0, 0x0F,
-    0xD0, 0x1F, 0xF0, 0x00, 0xBE, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x00, 0xFD, 0x03, 0xF4,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x02, 0xF4,
-    0x0F, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8, 0x00,
-    0x0B, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x40, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD,
-    0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03,
-    0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0,
-    0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01,
-    0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F,
-    0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80,
-    0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B,
-    0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0,
-    0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x90, 0x00,
-    0xA0, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x03, 0xD2, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x7C, 0x0F, 0xFE, 0x00, 0x02, 0xF1, 0xFF, 0xFF, 0x00, 0x0F, 0xDF, 0xD6, 0xFD,
-    0x00, 0x3F, 0xF4, 0x03, 0xF4, 0x01, 0xFF, 0x00, 0x0B, 0xE0, 0x0B, 0xF4, 0x00, 0x2F, 0x40, 0x3F,
-    0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00,
-    0xBE, 0x00, 0xBE, 0x00, 0x02, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x04, 0x00, 0x3F, 0x0F, 0xC1, 0xFF, 0xD0, 0x7C, 0x0F, 0x8F, 0xFF, 0xF4,
-    0x14, 0x1F, 0xBF, 0x97, 0xFC, 0x00, 0x2F, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0xBE,
-    0x00, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x00,
-    0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF7, 0xE0,
-    0x00, 0x1F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D, 0x00, 0x3E, 0x2F, 0x40, 0x02, 0xF0, 0x01, 0xF4,
-    0x3E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x3F, 0x00, 0x3F, 0x01, 0xF4, 0x01, 0xF8, 0x00,
-    0xFC, 0x03, 0xF0, 0x0B, 0xD0, 0x03, 0xE0, 0x0B, 0xC0, 0x3F, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0xFC,
-    0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0xBD, 0x1F, 0x80, 0x0F, 0x80, 0x00, 0xF8,
-    0xBD, 0x00, 0x7E, 0x00, 0x02, 0xF2, 0xF0, 0x02, 0xF4, 0x00, 0x07, 0xDF, 0xC0, 0x0B, 0xC0, 0x00,
-    0x0F, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x07, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x15, 0x6F, 0xD0,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xBF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF,
-    0x80, 0x0F, 0xDF, 0x96, 0xFC, 0x00, 0xFF, 0xC0, 0x0B, 0xD0, 0x0F, 0xF0, 0x00, 0xBD, 0x01, 0xFD,
-    0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x07, 0xE0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xBD, 0x02,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x02, 0x6F, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x1A,
-    0xAA, 0xA4, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02,
-    0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F,
-    0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x00,
-    0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00,
-    0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E,
-    0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0,
-    0x1F, 0xE4, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x0B, 0x80, 0x1E, 0x00, 0x00, 0x01, 0xFE, 0xBF,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x9B, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x01, 0xFC,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x00, 0x01, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xAF,
-    0x80, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xF2, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x19, 0x00, 0x03, 0xC0,
-    0x0F, 0x00, 0x00, 0xFE, 0xAF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD5, 0xFF, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x1F, 0x87, 0xE0, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x02, 0xF8, 0x0F, 0xD0, 0x01, 0xFC, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x02, 0xA0, 0x00, 0x00,
-    0x01, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC2, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00,
-    0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F,
-    0xF9, 0x5B, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x81, 0xA4, 0x00, 0x00, 0xBD, 0x0F, 0xC0,
-    0x00, 0x07, 0xD0, 0xFC, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x2D,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF5, 0x7F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x07, 0xE0,
-    0x1F, 0x80, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x07, 0xF9, 0x1B, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFA, 0x6B,
-    0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xEA, 0xAA, 0x80, 0x7F, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x57, 0xFE, 0xAA, 0xA9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0x00, 0x3F, 0xD5, 0xFF, 0x2F, 0xD5, 0xFE, 0x03, 0xF8, 0x00, 0xBF, 0xF8, 0x00, 0xFC, 0x2F,
-    0x80, 0x00, 0xFF, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x0F,
-    0xE0, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0xBF, 0xE0, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFD,
-    0x07, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xE4, 0x6F, 0xCF, 0xE4, 0x1B, 0x80,
-    0x2F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD, 0x00, 0x0B, 0xF0, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07,
-    0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55, 0xBF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFD, 0x0B,
-    0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF0, 0x00, 0xBC, 0x7F, 0xF0, 0x00, 0xFD, 0xFA, 0x90,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x01, 0xFD, 0x00, 0xBD,
-    0x00, 0x0B, 0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F,
-    0x01, 0xF8, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x55,
-    0xBF, 0xF0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x1F, 0x40, 0x03,
-    0xF0, 0x02, 0xF4, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x00, 0xFD, 0x0B, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xF0, 0x00, 0x3F, 0x7E, 0xA4, 0x00, 0x0F, 0xFD,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x60, 0x00, 0x02, 0xE0, 0x1F, 0x80, 0x00, 0x03, 0xE1, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xF4, 0x00, 0xBD, 0x00, 0x0B, 0xF0, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x56, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x0B,
-    0xD0, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00,
-    0x0F, 0xD0, 0x2F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x03, 0xE0, 0x1F, 0x40,
-    0x00, 0x3D, 0x2F, 0x40, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF0, 0x00, 0x2F, 0x1F,
-    0xFC, 0x00, 0x0F, 0xDF, 0xA9, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFA, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x10, 0x00, 0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF,
-    0x80, 0x3F, 0x95, 0xBC, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x3D, 0x00, 0xBF, 0x40, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x0B, 0xD7, 0xD0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFA, 0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x10,
-    0x00, 0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x7E, 0x03, 0xE0, 0x03, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0x95, 0xBC, 0x02,
-    0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x3D, 0x00, 0xBF, 0x40,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAB, 0xF8, 0x00, 0xBF,
-    0x00, 0x01, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x01, 0x00, 0x00, 0xBF, 0x00, 0x7E,
-    0x55, 0xBF, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xE0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0x95, 0xBC, 0x0B,
-    0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0xF4, 0x02, 0xFD, 0x0F, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x01, 0x90, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFA,
-    0xBF, 0x80, 0x0B, 0xF0, 0x00, 0x14, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x10, 0x00,
-    0x0B, 0xF0, 0x07, 0xE5, 0x5B, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x18, 0x00, 0x2E, 0x01, 0xF8, 0x00, 0x0F, 0x87,
-    0xE0, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xF9, 0x5B,
-    0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0xF4, 0x02, 0xFD, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0xFF, 0x00,
-    0x0B, 0xFF, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x24, 0x00, 0x28, 0x00,
-    0x0F, 0x80, 0x7D, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF4, 0x00, 0x1D, 0x3E, 0x00, 0x03, 0xC7, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1B,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x17, 0xF5, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x10, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05,
-    0x5F, 0xD5, 0x40, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0xC0, 0x5F, 0xD5, 0x50, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xBF,
-    0xAA, 0x00, 0xFF, 0xFF, 0xC0, 0x2B, 0xFA, 0xA0, 0x01, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00,
-    0x0F, 0xF8, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x00, 0x07, 0x82, 0xFF, 0xC0, 0x00, 0x01,
-    0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40,
-    0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00,
-    0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00,
-    0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0x00, 0x3F, 0xE0, 0x2C, 0x00, 0x0F, 0xFF, 0xEF, 0xC0, 0x00,
-    0xF0, 0x7F, 0xF0, 0x00, 0x1D, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03,
-    0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43,
-    0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x1F, 0x80, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x0B,
-    0xD0, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFF,
-    0x55, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xA9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01,
-    0xF4, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8,
-    0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81,
-    0xFA, 0xF0, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x00, 0x60, 0x00, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xFA, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x7E, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00,
-    0x03, 0xFC, 0x00, 0x1F, 0xF5, 0x5B, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00, 0x3C, 0x00,
-    0xF0, 0x00, 0x03, 0xFA, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x01, 0xF4, 0x0B, 0xD0,
-    0x00, 0x2F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00,
-    0x3F, 0x80, 0x3F, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0x81, 0xFA, 0xF0, 0x01,
-    0xFF, 0xFE, 0x2F, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x00, 0x00, 0x74,
-    0x0E, 0x00, 0x00, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00,
-    0x2F, 0x40, 0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x0F,
-    0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x7E,
-    0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00,
-    0x7F, 0xD5, 0x6F, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0xFA, 0xF4, 0x00, 0x00, 0x1E, 0x03, 0xC0, 0x00, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x0F, 0x07, 0x80,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F,
-    0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF,
-    0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF,
-    0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x06, 0x80, 0x00, 0x00,
-    0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x02, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x01,
-    0xF8, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x40, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0xF8,
-    0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x55, 0xBF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0x68, 0x00, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x00, 0x7D,
-    0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x02, 0x80, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x0B,
-    0xD0, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x00, 0x7E, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0x00, 0x2F, 0xF4,
-    0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E,
-    0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80,
-    0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80,
-    0x00, 0xFF, 0x00, 0x07, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE4,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07,
-    0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4,
-    0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50,
-    0x0B, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE4, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD3, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC7, 0xE0, 0x00, 0x0F, 0xF0, 0x00,
-    0x0B, 0xD1, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x03, 0xEF, 0x00, 0x02, 0xF4,
-    0x0F, 0x80, 0x02, 0xF7, 0xD0, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0xF8, 0xF4, 0x00, 0x7E, 0x00, 0xF8,
-    0x00, 0x7C, 0x3D, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x1F,
-    0x43, 0xD0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x07, 0xD0, 0x3E,
-    0x02, 0xF4, 0x00, 0x3F, 0x03, 0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x0F, 0xC0, 0xF4, 0x03, 0xE0, 0x7D,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x00,
-    0x3F, 0x2F, 0x00, 0x0F, 0xCB, 0xC0, 0x00, 0x0B, 0xCF, 0x80, 0x02, 0xF3, 0xE0, 0x00, 0x02, 0xF7,
-    0xC0, 0x00, 0xBD, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xF0,
-    0x00, 0x3F, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0xBB, 0xD0, 0x03, 0xF0, 0x3F, 0x00, 0x3D, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x2F, 0x3D, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0x4F, 0x40, 0xBD, 0x00, 0xFC, 0x0B, 0xC3, 0xD0, 0x3F, 0x00, 0x3F, 0x03,
-    0xE0, 0xF8, 0x1F, 0x40, 0x0B, 0xC1, 0xF0, 0x3E, 0x0F, 0xC0, 0x02, 0xF0, 0xF8, 0x0F, 0x87, 0xE0,
-    0x00, 0xBC, 0x7C, 0x03, 0xE2, 0xF0, 0x00, 0x2F, 0x3E, 0x00, 0xB8, 0xF8, 0x00, 0x0B, 0xCF, 0x00,
-    0x2E, 0xBC, 0x00, 0x02, 0xFB, 0x80, 0x0B, 0xBE, 0x00, 0x00, 0x7F, 0xD0, 0x02, 0xFF, 0x40, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0xC0, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00,
-    0x7D, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3,
-    0xF0, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xFC, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00,
-    0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00,
-    0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x02, 0xF0, 0x2F,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x02, 0xD0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x0F, 0xD0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00,
-    0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA,
-    0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xEA,
-    0xAA, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFD, 0x00, 0x15, 0x56, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x18, 0x00, 0x19, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xBC,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0x40, 0x02, 0x40, 0x00,
-    0xF4, 0x0B, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x01, 0x55, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x26, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xFA,
-    0x6F, 0xFC, 0x3F, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xF8, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0xFD, 0x00, 0x1F,
-    0xF5, 0x7F, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0x7E, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00,
-    0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE4, 0x6F, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x9B, 0xFE, 0xFF, 0x9B, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFF,
-    0xD0, 0x03, 0xF4, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x3F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x1F, 0x82, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x02, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x07,
-    0xD1, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0x4B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFC,
-    0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1F, 0x82,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBD, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x7F,
-    0x80, 0x00, 0xFF, 0x00, 0x01, 0xF8, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x6F, 0xFF, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0xE2, 0xFF, 0xFC, 0x01, 0xFF, 0x57, 0xFF, 0xD5, 0xFD, 0x03, 0xF8,
-    0x00, 0xFE, 0x00, 0x7E, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x7E,
-    0x2F, 0x40, 0x00, 0x7E, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x7E,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x7E, 0x00,
-    0x00, 0xFC, 0x02, 0xF4, 0x7E, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x3F, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x3F, 0x40, 0x0F, 0xE0, 0x03, 0xF0, 0x1F, 0xE0, 0x7F, 0x80, 0x07, 0xE0, 0x0B, 0xFF, 0xFE, 0x00,
-    0x0B, 0xD0, 0x01, 0xFF, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xBF, 0xFF, 0xE9, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x0F, 0xC0, 0x03, 0xFC, 0x7D, 0x0F, 0xC0, 0x00,
-    0xFC, 0x7D, 0x1F, 0xC0, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x00, 0xBD,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x00,
-    0xBD, 0x00, 0x2F, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFE,
-    0xAA, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xFF, 0x40, 0x00, 0xBD, 0x7F, 0xFF, 0x40,
-    0x03, 0xF7, 0xE5, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x01, 0xFD,
-    0x00, 0x07, 0xE0, 0x0B, 0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x03,
-    0xF4, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x07, 0xF4, 0x02, 0xFB, 0xD0,
-    0xBF, 0x80, 0x0B, 0xCF, 0xFF, 0xF8, 0x00, 0x3F, 0x0B, 0xFF, 0x40, 0x00, 0xFC, 0x01, 0x40, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x07, 0xF5, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0xFC, 0x01,
-    0xBF, 0x80, 0x0F, 0xC0, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x00, 0xFD, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x07,
-    0xF4, 0x0B, 0xD0, 0x06, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x01, 0xFE,
-    0xAB, 0xE0, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x01, 0xFE,
-    0xAF, 0xF8, 0x00, 0x08, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x2F, 0xE5, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x3E, 0x46, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x06, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00, 0xBF, 0xFD, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x7F, 0x40, 0x6E, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFA,
-    0xAA, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xA4,
-    0x03, 0xFF, 0xC3, 0xFF, 0xF8, 0xF8, 0x3F, 0x3E, 0x0F, 0xCF, 0xEB, 0xF2, 0xFF, 0xF8, 0x1B, 0xFD,
-    0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xE0, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFE, 0x68, 0x2F, 0xFF, 0x01, 0xFF, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x2B, 0xF4, 0x00, 0x3F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xC0, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0xBE, 0x00, 0x01, 0xF4, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x0B, 0xFF, 0x00, 0x2F, 0xFF,
-    0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x1B,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00,
-    0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x41, 0x00, 0x2F,
-    0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x0B, 0xFA, 0x40, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0xF8, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x07, 0xE1, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x56, 0xFF, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0B, 0xC2, 0xF4, 0x03,
-    0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xF8,
-    0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x68, 0x07, 0xE0, 0x3F, 0x00,
-    0xF8, 0x07, 0xC0, 0x1D, 0x00, 0x69, 0x01, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x78, 0x00,
-    0x00, 0x29, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x02, 0xF5, 0xF4, 0x3F, 0x02, 0xF2, 0xE0, 0x02,
-    0xD0, 0x01, 0x40, 0x06, 0x07, 0xFE, 0x03, 0xC3, 0xFF, 0xFB, 0xE1, 0xE0, 0xBF, 0xF0, 0xB0, 0x02,
-    0xE0, 0x00, 0x1A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xC1, 0x55, 0x55, 0x54, 0x60, 0x00, 0xAB, 0x80, 0x2E, 0x7F, 0xAF,
-    0xC2, 0xFF, 0xF4, 0x06, 0xE8, 0x00, 0x14, 0x7E, 0xBE, 0x7C, 0x00, 0x04, 0x00, 0x47, 0xD0, 0x7D,
-    0xBD, 0x0B, 0xD7, 0xC0, 0x78, 0x15, 0x01, 0xFF, 0x46, 0x6F, 0x00, 0x3D, 0x02, 0xF0, 0xBF, 0x43,
-    0xD0, 0x1E, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x3E, 0xBD, 0x78, 0x0F, 0x74, 0x0F, 0x3C,
-    0x1E, 0x2F, 0xFC, 0x06, 0xE0, 0x00, 0xA4, 0x1A, 0x00, 0xFC, 0x1F, 0xC0, 0xBD, 0x0F, 0xC0, 0x7D,
-    0x0F, 0xC0, 0x7C, 0x0B, 0x80, 0x28, 0x03, 0x80, 0x00, 0x64, 0x00, 0x64, 0xF4, 0x0B, 0xC2, 0xF0,
-    0xFC, 0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0x40, 0xBC, 0x0B, 0xC0, 0xF8,
-    0x0F, 0x41, 0xF4, 0x2F, 0x03, 0xF0, 0x3E, 0x01, 0x40, 0x05, 0x01, 0x41, 0xF0, 0x7D, 0x2F, 0x0B,
-    0xC3, 0xF0, 0xBC, 0x3E, 0x0F, 0x87, 0xD0, 0xF4, 0x00, 0x00, 0x00, 0x29, 0x06, 0x90, 0x3F, 0x07,
-    0xF0, 0x1F, 0x82, 0xF0, 0x0B, 0xC0, 0xF8, 0x03, 0xE0, 0x3D, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x60, 0x60, 0xA1, 0xE0, 0x07, 0xC3, 0xFA, 0xFD,
-    0x0B, 0xFF, 0xD0, 0x06, 0xE8, 0x00, 0x00, 0x69, 0x00, 0x1F, 0xFF, 0x41, 0xFF, 0xFF, 0x0F, 0x40,
-    0x3C, 0x38, 0x00, 0x70, 0x00, 0xB4, 0x07, 0xC0, 0x3E, 0x02, 0xF0, 0x0F, 0xC0, 0xBD, 0x07, 0xF0,
-    0x2F, 0x80, 0x54, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0,
-    0x2F, 0x00, 0x50, 0x00, 0x3E, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0B, 0xC1, 0xF0, 0x7C, 0x05, 0x00,
-    0x02, 0xF4, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xBC, 0x03, 0xD0, 0x2F, 0x00, 0x50, 0x00,
-    0x2A, 0x00, 0xBD, 0x00, 0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x02, 0xD0, 0x00, 0xA8, 0x03, 0xF8, 0x0B,
-    0xE0, 0x1F, 0x80, 0x3E, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x78, 0x7F, 0xF8, 0xBF,
-    0xF4, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x1F, 0xFD, 0x2F,
-    0xFD, 0x2D, 0x00, 0x3C, 0x00, 0x14, 0x00, 0x15, 0x55, 0x57, 0xFF, 0xFF, 0x6A, 0xAB, 0xE0, 0x00,
-    0x3D, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x00, 0xA0,
-    0x00, 0x15, 0x00, 0xBE, 0x00, 0xFD, 0x01, 0xFC, 0x03, 0xF4, 0x2F, 0xD0, 0x3E, 0x00, 0x10, 0x00,
-    0x00, 0x02, 0xF2, 0xF4, 0xF0, 0x74, 0x1E, 0x03, 0xE0, 0x24, 0x00, 0x50, 0x01, 0xF0, 0x01, 0xE0,
-    0x02, 0xD0, 0x7F, 0xFE, 0x7F, 0xFD, 0x15, 0x54, 0xBF, 0xFD, 0xAF, 0xE8, 0x0B, 0x40, 0x0F, 0x40,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0xAF, 0xE8, 0x3F, 0xFF, 0x05, 0xF5, 0x00,
-    0x3C, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFE, 0x00, 0x15, 0x00, 0x3E, 0x00, 0x7D,
-    0x00, 0xBC, 0x00, 0xFC, 0x00, 0xFC, 0x01, 0xF8, 0x6B, 0xF0, 0x7F, 0xE0, 0x7F, 0x40, 0x05, 0x40,
-    0x3E, 0x01, 0xF4, 0x0B, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0xE9, 0x2F, 0xF4, 0x2F, 0xC0,
-    0x3C, 0xFD, 0xFD, 0x78, 0x04, 0x00, 0x43, 0xF0, 0x3F, 0x3F, 0x03, 0xF2, 0xD0, 0x2D, 0x00, 0x00,
-    0x0B, 0xF8, 0x3E, 0xBE, 0x38, 0x0F, 0x78, 0x0F, 0x3C, 0x1F, 0x2F, 0xFD, 0x06, 0xE0, 0x07, 0xE0,
-    0xBC, 0x0F, 0x42, 0xE0, 0x7C, 0x01, 0x00, 0x02, 0xD0, 0x0F, 0x00, 0xBE, 0x00, 0x7E, 0x00, 0xBC,
-    0x03, 0xE7, 0xFF, 0x1F, 0xE0, 0x03, 0xC1, 0xF0, 0x3C, 0x0B, 0x80, 0xB8, 0x0B, 0xFC, 0x3F, 0xC0,
-    0x00, 0x05, 0x43, 0xE0, 0xF4, 0x7C, 0x2F, 0x0F, 0xC3, 0xE1, 0xF4, 0x7C, 0x15, 0x00, 0x05, 0x55,
-    0x55, 0x50, 0xFF, 0xFF, 0xFE, 0x1F, 0xAA, 0xAB, 0xE2, 0xE0, 0x00, 0x3D, 0x3D, 0x00, 0x03, 0xC3,
-    0xC0, 0x00, 0x7C, 0x14, 0x00, 0x01, 0x00, 0x74, 0x0E, 0x02, 0xC7, 0x42, 0xF0, 0x7C, 0x3F, 0xFF,
-    0xFF, 0x01, 0xFD, 0x2F, 0x80, 0xA0, 0x00, 0x62, 0xF0, 0x0F, 0x83, 0xE1, 0xF8, 0x07, 0xFF, 0x80,
-    0x0F, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x69, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xF2,
-    0xF0, 0x3E, 0x03, 0xF2, 0xD0, 0x02, 0xC0, 0xA0, 0x00, 0x9F, 0x40, 0x3D, 0xBE, 0xAF, 0xC3, 0xFF,
-    0xF0, 0x06, 0xE4, 0x00, 0x00, 0x69, 0x00, 0x2F, 0xFF, 0x01, 0xFF, 0xFF, 0x0F, 0x40, 0x3C, 0x34,
-    0x00, 0xB0, 0x01, 0x40, 0x02, 0x03, 0xFE, 0x03, 0xC3, 0xFF, 0xFB, 0xE1, 0xE0, 0xBF, 0xF0, 0xB0,
-    0x02, 0xA0, 0x00, 0x2A, 0xAA, 0xA3, 0xFF, 0xFF, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF2, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF,
-    0xFD, 0x15, 0x55, 0x55, 0x50, 0x00, 0x50, 0x01, 0x40, 0xBF, 0xD0, 0x38, 0x0F, 0xFF, 0xEF, 0x42,
-    0xD0, 0xBF, 0xE0, 0x38, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xD1, 0x55, 0x55, 0x54, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x1F, 0xE0, 0x0B,
-    0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x7E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x41, 0xF0, 0x2D, 0x0B, 0x47, 0xCF, 0xD2,
-    0x40, 0x05, 0x00, 0x00, 0x50, 0xF0, 0x00, 0x1E, 0x1F, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x3D, 0x3F,
-    0xAA, 0xAB, 0xC3, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xAA, 0xAB, 0xD0, 0xE0, 0x00, 0x3C, 0x1D, 0x00, 0x03, 0xC2, 0xD0, 0x00, 0x78, 0x3F,
-    0xFF, 0xFF, 0x42, 0xAA, 0xAA, 0xA0, 0x07, 0xF4, 0xBE, 0x0B, 0xEF, 0xFB, 0xE7, 0x81, 0xF0, 0x3E,
-    0xC0, 0x34, 0x0E, 0x08, 0x08, 0x2F, 0x3E, 0x0F, 0xF8, 0x0B, 0xF0, 0x1F, 0xF0, 0x7D, 0xFC, 0x20,
-    0x20, 0x00, 0x6C, 0x02, 0xFC, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x02, 0xF0, 0x03,
-    0xE0, 0x2F, 0xC0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA, 0xAA, 0x8B, 0xFF, 0xFF, 0xFE, 0x15,
-    0x55, 0x55, 0x50, 0x29, 0x00, 0xFC, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x00, 0xA8,
-    0x03, 0xF8, 0x0B, 0xE0, 0x1F, 0x80, 0x3E, 0x00, 0xB4, 0x00, 0x01, 0x50, 0x02, 0x43, 0xFF, 0x42,
-    0xD2, 0xFF, 0xFE, 0xF0, 0xF0, 0x7F, 0xF4, 0x34, 0x01, 0xA4, 0x00, 0xBE, 0x3F, 0xE0, 0xF8, 0x2E,
-    0x1F, 0x06, 0x00, 0x00, 0x0F, 0xD0, 0x01, 0x0B, 0xE1, 0x07, 0xD3, 0xF3, 0xF2, 0xF6, 0xF4, 0xFC,
-    0x78, 0xF4, 0x3D, 0x00, 0x78, 0x00, 0x00, 0x14, 0x03, 0xE0, 0x7D, 0x0B, 0xD0, 0xBF, 0xC2, 0xF8,
-    0x05, 0x55, 0x55, 0x54, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xAA, 0xAA, 0xBC, 0x3D, 0x00, 0x00, 0x7C,
-    0x3C, 0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0xF4, 0x10, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xAA, 0xAA, 0xA0, 0x7F, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x55, 0x50, 0x05, 0x01, 0x50, 0xF8,
-    0x3E, 0x1F, 0x43, 0xD1, 0xF0, 0x7D, 0x2F, 0x0B, 0xC3, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x3F, 0xFC, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x05, 0x3C,
-    0x14, 0x07, 0xFF, 0x83, 0x80, 0xFF, 0xFE, 0xF4, 0x2D, 0x2F, 0xFE, 0x03, 0x87, 0x9A, 0x40, 0x00,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x14, 0x00, 0x0B, 0xF4, 0x0B, 0x0B, 0xFF, 0x9B, 0xC3, 0xD7, 0xFF, 0xD2, 0xD0, 0x1F, 0xD0,
-    0x00, 0x24, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x50, 0x01,
-    0x42, 0xFF, 0x82, 0xD1, 0xFB, 0xFF, 0xF0, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x03,
-    0x83, 0xFF, 0xD7, 0xD1, 0xE5, 0xFF, 0xE0, 0xB0, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0xB0,
-    0x2D, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF8, 0x0F, 0x81, 0xF4, 0x00, 0x90, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xBE, 0x0B, 0xFD, 0x07, 0xC0, 0x2E, 0x00, 0xF4, 0x03, 0xC0,
-    0xBF, 0xC0, 0x2F, 0xF8, 0x03, 0xFE, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00,
-    0xB2, 0x8E, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x09, 0x00, 0x50, 0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x90, 0x00, 0x00, 0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xA0, 0x70, 0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E,
-    0x00, 0x00, 0xF0, 0x00, 0x63, 0xC9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF,
-    0x00, 0x0F, 0x40, 0xBF, 0x40, 0xBE, 0x0B, 0xEB, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE3, 0xE2,
-    0xD0, 0xB0, 0x2D, 0x03, 0xD0, 0x60, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x1F, 0xFF, 0xC3, 0xE5, 0x7E,
-    0xB8, 0x00, 0xE5, 0x0B, 0x05, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x01, 0xE0, 0x00, 0x08, 0x20, 0x3E,
-    0xFC, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F, 0x8F,
-    0xC0, 0xBF, 0x40, 0xBE, 0x00, 0xA0, 0x20, 0x00, 0xF8, 0x01, 0xFE, 0x00, 0xBD, 0x0B, 0xF4, 0xFD,
-    0x03, 0x40, 0x00, 0x40, 0x00, 0x00, 0x3E, 0x40, 0x3F, 0x03, 0xFD, 0x0F, 0xC0, 0x1F, 0x8B, 0xB8,
-    0x1F, 0xE3, 0xCF, 0x2F, 0x81, 0xE2, 0xDA, 0x00, 0xB0, 0x38, 0x04, 0x03, 0xC0, 0xB8, 0x0F, 0x03,
-    0xC2, 0xE3, 0xF0, 0x90, 0x14, 0xBE, 0xFE, 0x7C, 0x00, 0x01, 0x90, 0x00, 0x74, 0x02, 0xEE, 0xE0,
-    0xBF, 0xF8, 0x07, 0xF4, 0x03, 0xDF, 0x00, 0x62, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xBF, 0x47,
-    0xEB, 0xFE, 0xF6, 0xC0, 0xB8, 0x0F, 0xF0, 0x1D, 0x03, 0xEC, 0x0B, 0x80, 0xF7, 0xEF, 0xFE, 0xF4,
-    0x7F, 0x8B, 0xF4, 0x00, 0x00, 0xE0, 0x07, 0x40, 0x2F, 0xFC, 0xFF, 0xF0, 0x03, 0x80, 0x1D, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x29, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x40, 0x00,
-    0x00, 0x07, 0xF0, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xFA, 0xBF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x6A, 0xA4, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x29, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xE4, 0x00,
-    0x00, 0xBF, 0xC0, 0x07, 0xFF, 0xFA, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x01, 0xAA, 0xA4, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x6A, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x15, 0x50, 0x00, 0x00, 0x01, 0x80, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x3C, 0x0F, 0xFA, 0xFF,
-    0xFF, 0xA5, 0xAF, 0x42, 0xF0, 0x00, 0x1B, 0xFF, 0xFF, 0xD0, 0x28, 0x00, 0x00, 0x01, 0xAA, 0x90,
-    0x00, 0x00, 0x00, 0x05, 0xA5, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x40, 0x00, 0x1F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x68, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x03, 0x83, 0xC2, 0x80, 0xE0, 0xD0, 0x34,
-    0x30, 0x1C, 0x0C, 0x0F, 0x03, 0xEE, 0x80, 0x14, 0x00, 0x07, 0xE0, 0xB0, 0xE3, 0x03, 0x6E, 0xF4,
-    0xA0, 0x02, 0xC0, 0x03, 0xAA, 0x01, 0x50, 0x01, 0x00, 0xD0, 0x00, 0x18, 0x0D, 0x03, 0x01, 0xC0,
-    0xB0, 0x38, 0x0D, 0x01, 0x00, 0x02, 0xF4, 0x0E, 0x0D, 0x38, 0x0A, 0x34, 0x0A, 0x30, 0x0D, 0x34,
-    0x1C, 0x2E, 0xB4, 0x01, 0x40, 0x0C, 0x03, 0x07, 0x01, 0xC2, 0xC0, 0xA0, 0xE0, 0x34, 0x34, 0x1C,
-    0x0C, 0x0F, 0x03, 0xAE, 0x80, 0x14, 0x00, 0x02, 0xF4, 0x74, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x01,
-    0xC0, 0x03, 0xEA, 0x01, 0x50, 0x00, 0x01, 0x80, 0x00, 0xA0, 0x00, 0x34, 0x0B, 0x9C, 0x0D, 0x0F,
-    0x0E, 0x03, 0x83, 0x00, 0xD1, 0xC0, 0x70, 0x70, 0x3C, 0x0F, 0xBA, 0x00, 0x50, 0x00, 0x07, 0x00,
-    0x0B, 0x00, 0x0E, 0x00, 0x0D, 0xBC, 0x1F, 0x4A, 0x1C, 0x0A, 0x28, 0x0D, 0x34, 0x0C, 0x30, 0x1C,
-    0x70, 0x2C, 0x00, 0x10, 0x08, 0xF8, 0x7D, 0x1E, 0x0E, 0x4B, 0x2C, 0x0E, 0x07, 0x34, 0x1C, 0x0A,
-    0x30, 0x2C, 0x0D, 0x70, 0x38, 0x0C, 0xA0, 0x34, 0x1C, 0x40, 0x10, 0x04, 0x09, 0xB8, 0x3D, 0x00,
-    0xD0, 0x07, 0x00, 0x28, 0x00, 0xD0, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0xD0, 0x7F, 0xC1, 0xC0,
-    0x28, 0x03, 0x40, 0x30, 0x07, 0x00, 0x39, 0x01, 0x50, 0x60, 0x0C, 0x70, 0x28, 0x30, 0x70, 0x30,
-    0xD0, 0x36, 0xC0, 0x37, 0x40, 0x2E, 0x00, 0x04, 0x00, 0x09, 0x06, 0x02, 0xC7, 0x00, 0x3B, 0x00,
-    0x0B, 0x00, 0x07, 0xD0, 0x03, 0x5C, 0x03, 0x43, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0,
-    0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0x03, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xE0,
-    0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x0B, 0xD0,
-    0x00, 0x7F, 0x40, 0x3F, 0xEA, 0xBF, 0xF0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1F, 0x80, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00,
-    0x0F, 0xE0, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0xAA, 0xBF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0xF4,
-    0x00, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40,
-    0x3F, 0x00, 0x00, 0x07, 0xD0, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x0B,
-    0xFA, 0xAA, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA,
-    0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x02, 0xFE, 0xAA, 0xAA, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00,
-    0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9,
-    0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00,
-    0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00,
-    0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x15, 0x55, 0x50, 0x3F, 0x7F, 0x0F, 0xFF, 0xFD,
-    0x1F, 0xDF, 0x83, 0xFF, 0xFF, 0x47, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0F,
-    0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xF4,
-    0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0xBD, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x00, 0x3F,
-    0x7F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFE,
-    0x1F, 0x80, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x03, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00,
-    0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xEF,
-    0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8B, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0,
-    0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x07, 0xD0, 0x00, 0x02, 0xF8, 0x07, 0xD0, 0x00,
-    0x03, 0xF0, 0x03, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F,
-    0x40, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x01, 0xFC, 0x00,
-    0x02, 0xF4, 0x03, 0xF4, 0x00, 0x01, 0xF4, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x00,
-    0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0xBE, 0xF0, 0x00,
-    0x00, 0xFE, 0xF0, 0x00, 0xFD, 0xF0, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x03, 0xF3,
-    0xF0, 0x00, 0xF8, 0xF4, 0x00, 0x07, 0xD7, 0xE0, 0x01, 0xF4, 0xF8, 0x00, 0x0F, 0xC7, 0xD0, 0x02,
-    0xF0, 0xF8, 0x00, 0x1F, 0x0B, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x3E, 0x0F, 0xC0, 0x03, 0xF0, 0xBC,
-    0x00, 0xBC, 0x0F, 0xC0, 0x03, 0xE0, 0xBC, 0x00, 0xF8, 0x1F, 0x80, 0x07, 0xD0, 0x7C, 0x02, 0xF0,
-    0x2F, 0x40, 0x0B, 0xC0, 0x7D, 0x03, 0xD0, 0x3F, 0x00, 0x0F, 0xC0, 0x3D, 0x0F, 0xC0, 0x3F, 0x00,
-    0x0F, 0x80, 0x3D, 0x1F, 0x40, 0x3F, 0x00, 0x1F, 0x80, 0x3E, 0x3F, 0x00, 0x7E, 0x00, 0x2F, 0x40,
-    0x3E, 0x7D, 0x00, 0xBD, 0x00, 0x2F, 0x00, 0x2F, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0xE0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x01, 0xF8,
-    0x00, 0xBC, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xFF,
-    0x00, 0x00, 0x07, 0xD0, 0x03, 0xFD, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0xBF, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x8F, 0xC0, 0x00, 0x7D,
-    0x00, 0x3E, 0x2F, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x7E, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00,
-    0x3F, 0x00, 0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xE0, 0x0B, 0xD0, 0x03, 0xE0, 0x0F,
-    0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0xFC, 0x00, 0xBC, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0,
-    0x00, 0xBC, 0x1F, 0x80, 0x0F, 0x80, 0x01, 0xF8, 0xBD, 0x00, 0x7E, 0x00, 0x03, 0xF2, 0xF0, 0x02,
-    0xF4, 0x00, 0x0B, 0xDF, 0xC0, 0x0B, 0xC0, 0x00, 0x0F, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00,
-    0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F,
-    0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80,
-    0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00,
-    0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5,
-    0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x0B,
-    0xD0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x01,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0xC0, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x07, 0xE0, 0x02, 0xFD, 0x00, 0xBD, 0x00, 0x0B, 0xE0, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0B, 0xFA, 0xA5, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFA, 0xAA, 0xAA, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0,
-    0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00,
-    0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0xBF, 0x94, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x07, 0xD0, 0x6F, 0xF0, 0x07, 0xF8, 0x00, 0xBC, 0x00, 0x7F,
-    0x40, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x1F, 0x80, 0x00, 0xFC, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x2F, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0xFD, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0xBD, 0x00, 0x0B, 0xE0, 0x7F, 0x40, 0x0F, 0xC0, 0x02,
-    0xFC, 0x03, 0xFD, 0x00, 0xFC, 0x01, 0xFF, 0x40, 0x0F, 0xFF, 0xAF, 0xEB, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x1F, 0x9F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x40,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x2F, 0x40, 0x07, 0xE0,
-    0x01, 0xFC, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x2F, 0x40, 0x07, 0xE0, 0x01,
-    0xF8, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x00,
-    0x3F, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xF0, 0x0B, 0xD0, 0x0F, 0xD0,
-    0x00, 0xFF, 0x43, 0xF4, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x06, 0xBF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0x96, 0xFF, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x40, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBD, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x0B, 0xD0, 0x00, 0x6A, 0xBF, 0xC0, 0x3F, 0xEA, 0x90, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x7F,
-    0xFF, 0xC7, 0xC0, 0x1F, 0xF5, 0x7E, 0xF8, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBE, 0x00, 0x07, 0xF4,
-    0x0F, 0xC0, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00,
-    0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xFC, 0x07,
-    0xE0, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0F, 0xF4, 0x07, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0xC1, 0xFA,
-    0xF4, 0x01, 0xFF, 0xFE, 0x2F, 0xF0, 0x07, 0xFF, 0x40, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01,
-    0xFD, 0x01, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x05, 0x6F, 0xD0, 0x00, 0x3F, 0x0F, 0xFD, 0x00,
-    0x00, 0x7E, 0x0F, 0xFE, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x01, 0xF4, 0x00, 0x02, 0xF4, 0x02, 0xF4,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x0B, 0xFD, 0x00, 0xBF, 0x80, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xC7, 0xFF, 0xF4,
-    0x00, 0x0F, 0xC0, 0x15, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF9, 0xF8, 0x00, 0x07,
-    0xE3, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x7E, 0x0B, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xBC, 0x01, 0xF0,
-    0x03, 0xE0, 0x07, 0xD0, 0x3F, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x3D, 0x1F, 0x80, 0x00, 0xF4, 0xFC,
-    0x00, 0x03, 0xEF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x01, 0xFE, 0x03,
-    0xF4, 0x00, 0x7F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0x3E, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x7D, 0x00, 0x00, 0x7E, 0x0B, 0xD0, 0x00, 0x07,
-    0xE0, 0xBD, 0x00, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x03, 0xF4, 0x02, 0xFD,
-    0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x3F, 0x95, 0xBC,
-    0x02, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0xFE, 0xA4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x2F, 0xFA, 0x40, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x1B,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE4,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0xC0,
-    0xFF, 0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0xC0, 0x0F, 0xDF, 0x96, 0xFD, 0x00, 0xFF, 0xD0, 0x0F, 0xD0,
-    0x1F, 0xF0, 0x00, 0xBE, 0x02, 0xFD, 0x00, 0x0B, 0xD0, 0x3F, 0xC0, 0x00, 0xFD, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x02, 0xF4, 0x0F,
-    0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x0B,
-    0xE0, 0x2F, 0x40, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFE, 0x02, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x01,
-    0xF4, 0x0F, 0xC0, 0x00, 0x7E, 0x07, 0xD0, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x07, 0xD0, 0xFC, 0x00,
-    0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF5,
-    0x55, 0x5B, 0xE0, 0xF8, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x07,
-    0xD0, 0x00, 0x2F, 0x81, 0xF4, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x03, 0xF0,
-    0x03, 0xF0, 0x02, 0xF8, 0x00, 0xBF, 0x07, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0,
-    0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x40, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00,
-    0x7E, 0x00, 0x7E, 0x00, 0x7F, 0x41, 0x3F, 0xFE, 0x1F, 0xFD, 0x00, 0x50, 0x00, 0x7D, 0x00, 0x1F,
-    0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x01, 0xF8,
-    0x1F, 0xC0, 0x00, 0x1F, 0x47, 0xF0, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x0B,
-    0xE0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x02,
-    0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xBD, 0xF4, 0x00, 0x00, 0x1F, 0x4F, 0x80, 0x00, 0x03, 0xF0, 0xF8,
-    0x00, 0x00, 0x7D, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x3F,
-    0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x1F, 0x80, 0x00, 0x2F, 0xE3, 0xF0, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x2F, 0x40, 0x00,
-    0xBC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x01, 0xF8,
-    0x00, 0x7E, 0x00, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x0F, 0xD0, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x01,
-    0xFF, 0x80, 0x0B, 0xF8, 0x1B, 0xDF, 0x80, 0x0B, 0xFF, 0xFF, 0x0F, 0xF4, 0x0F, 0xDF, 0xF8, 0x0F,
-    0xF0, 0x0F, 0x81, 0x40, 0x01, 0x40, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xF9, 0xF8, 0x00, 0x07,
-    0xE3, 0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x7D, 0x0B, 0xC0, 0x02, 0xF0, 0x2F, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0xBC, 0x01, 0xF0,
-    0x03, 0xE0, 0x07, 0xD0, 0x3F, 0x00, 0x0F, 0x41, 0xF4, 0x00, 0x3D, 0x1F, 0x80, 0x00, 0xF4, 0xFC,
-    0x00, 0x03, 0xEF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x55, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE4, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0x40,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x02,
-    0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00,
-    0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xE4,
-    0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xAF, 0xEA, 0xAB, 0xFA, 0x90, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-    0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0x57, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x7E,
-    0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x7E,
-    0x01, 0xF8, 0x00, 0x07, 0xE0, 0x1F, 0x40, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x01, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x0B, 0xF0, 0x0B, 0xFE, 0x02, 0xFC, 0x00,
-    0xBE, 0xFF, 0xFF, 0x40, 0x0F, 0xC7, 0xFF, 0xC0, 0x00, 0xF8, 0x01, 0x40, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0x68, 0x03, 0xF8, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x40,
-    0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFE, 0xAF, 0xEA, 0x00, 0xFE, 0x00,
-    0x2F, 0x00, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x07, 0xE0,
-    0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07,
-    0xF0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xF8, 0x0B, 0xF4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xC6, 0xAB, 0xFE, 0xAA, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFE, 0x04, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x0F,
-    0xC0, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03, 0xF0, 0x00,
-    0x7F, 0x00, 0xBF, 0x41, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xE0,
-    0x2F, 0xFF, 0xC0, 0x0B, 0xF0, 0x1F, 0xD6, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x03, 0xF4, 0x03,
-    0xE0, 0x0B, 0xD1, 0xFC, 0x01, 0xF4, 0x02, 0xF4, 0xBD, 0x00, 0xBC, 0x00, 0xBD, 0x3F, 0x00, 0x3F,
-    0x00, 0x2F, 0x4F, 0xC0, 0x0F, 0x80, 0x0F, 0xC3, 0xE0, 0x07, 0xE0, 0x03, 0xF1, 0xF8, 0x02, 0xF4,
-    0x01, 0xF8, 0x3E, 0x00, 0xBC, 0x00, 0xFD, 0x0F, 0xC0, 0x3F, 0x00, 0x7F, 0x03, 0xF0, 0x0F, 0x80,
-    0x3F, 0x40, 0xBF, 0x07, 0xD0, 0x7F, 0x80, 0x0F, 0xF6, 0xF5, 0xBF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x5F, 0xD0, 0x00,
-    0x7E, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00,
-    0x7D, 0x00, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0xBD, 0x00, 0x00, 0x00, 0x1F, 0x47, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0xBC, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00,
-    0xFD, 0x00, 0x0F, 0xE5, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xF4, 0x03, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0x7D,
-    0x00, 0xFC, 0x07, 0xE0, 0x0B, 0xC0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xF8, 0x00, 0xF8, 0x1F, 0x80, 0x2F, 0x40, 0x1F, 0x81, 0xF4, 0x02,
-    0xF0, 0x02, 0xF4, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x3F, 0x00,
-    0x7E, 0x00, 0xFC, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x80, 0x2F, 0xC0, 0xFC, 0x0B, 0xF0, 0x00, 0xFF,
-    0x4F, 0xDB, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-    0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x7E, 0x0F,
-    0xC0, 0x01, 0xF0, 0x00, 0x7E, 0x1F, 0x80, 0x02, 0xF0, 0x00, 0x7E, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x7D, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0x3F, 0x00, 0x07, 0xD0, 0x00, 0xFC, 0x3F, 0x00, 0x0B,
-    0xC0, 0x00, 0xFC, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x2F,
-    0x40, 0x3F, 0xD0, 0x0B, 0xE0, 0x1F, 0xD1, 0xFA, 0xF4, 0x2F, 0xC0, 0x0B, 0xFF, 0xF0, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA,
-    0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7,
-    0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00,
-    0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01,
-    0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0,
-    0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00,
-    0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8,
-    0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF,
-    0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0xF7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x82, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7F, 0x0B, 0xC0,
-    0x00, 0x00, 0x7F, 0xE2, 0x40, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xC0, 0x00,
-    0x00, 0x38, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x00,
-    0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x07, 0xE0,
-    0x00, 0x3F, 0x80, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xF0,
-    0x7F, 0xBC, 0x00, 0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x00, 0x1F, 0xFD, 0x0B, 0x80, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x0F, 0xC0, 0x00, 0x00, 0x09, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x03,
-    0xD0, 0x7C, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0,
-    0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xFC, 0x00, 0x00, 0x08, 0x7F, 0xE0, 0x00,
-    0x00, 0x1F, 0xAF, 0x00, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x00, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00,
-    0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8,
-    0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF,
-    0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xC2, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x40,
-    0x00, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xCF,
-    0xC0, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFE,
-    0xAA, 0xAB, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x1F, 0xC3, 0xD0, 0x00, 0x00, 0x7F, 0xE1, 0x00, 0x00, 0x01, 0xFA, 0xF0,
-    0x00, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x00,
-    0xFF, 0x57, 0xEF, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x7E, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x01, 0xFC,
-    0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00,
-    0x3F, 0xC1, 0xFE, 0xF0, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xC0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x7D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x0B,
-    0xD0, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xF8, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x1F, 0xF8, 0x1E, 0x00, 0x03, 0xEF, 0xFF,
-    0xC0, 0x00, 0xB4, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x00, 0xE0, 0x01, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF,
-    0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40,
-    0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E,
-    0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF,
-    0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x01, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x3D, 0x00, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xDF, 0x80,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00,
-    0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x07, 0xD0, 0x00, 0x03,
-    0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xAA, 0xAB, 0xF0, 0x01, 0xFC, 0x00, 0x02,
-    0xF4, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x2F, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x4F, 0x80, 0x00,
-    0x0B, 0xC0, 0x7C, 0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F,
-    0x80, 0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F,
-    0x03, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00,
-    0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40,
-    0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4,
-    0x2E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x01, 0x06, 0x05, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x3E,
-    0x5B, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC,
-    0x00, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAF, 0xC0,
-    0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x3F, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x06, 0x06, 0x06, 0x00, 0x00, 0xB8, 0x01, 0xF0,
-    0x00, 0x03, 0xEA, 0xBD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0,
-    0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F,
-    0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF,
-    0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x01, 0x02, 0x45, 0x00, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x3E, 0x5B,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00,
-    0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x01, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAF, 0xC0, 0x01,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x06, 0x02, 0x06, 0x00, 0x00, 0xB8, 0x01, 0xF0, 0x00,
-    0x03, 0xEA, 0xBD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xC0, 0x0F,
-    0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F, 0xC0, 0x00, 0x3F,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x00,
-    0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x80,
-    0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0, 0x01, 0xFF, 0xFE,
-    0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x42, 0xC1, 0x40, 0x00, 0x00, 0x78, 0x00, 0xF0,
-    0x00, 0x00, 0x0F, 0x96, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xDF, 0x80, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00,
-    0x2F, 0x40, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFE,
-    0xAA, 0xAB, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x80,
-    0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x60, 0xA0, 0x60, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x00, 0x3E, 0xAB, 0xD0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80, 0x0F, 0xF8,
-    0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF4, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F,
-    0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x1F, 0xF8, 0x1E, 0x00,
-    0x00, 0x03, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0xB4, 0x1F, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3E, 0x5B, 0xE0,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xDF,
-    0x80, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0xBC, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x02, 0xF4,
-    0x07, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE,
-    0xAA, 0xAB, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x02, 0xF4, 0x00, 0x7E,
-    0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00,
-    0x2F, 0xF4, 0x1D, 0x00, 0x07, 0xEF, 0xFF, 0xC0, 0x00, 0xB0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x0B, 0x80, 0x1F, 0x00, 0x00, 0x7E, 0xAB, 0xD0, 0x00, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFC, 0x7C, 0x00, 0xFF, 0x57, 0xEF, 0xC0, 0x3F, 0x80,
-    0x0F, 0xF8, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x03, 0xF8, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x3F,
-    0x00, 0x2F, 0xF4, 0x03, 0xFC, 0x1F, 0xEF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x7F, 0xF4, 0x2E,
-    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x03,
-    0xC0, 0x00, 0x00, 0x3F, 0xAF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x00, 0xBD, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0x80, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFA, 0xAA, 0xAF, 0xC0, 0x01, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7E,
-    0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0A, 0x00, 0x00, 0x78,
-    0x01, 0xF0, 0x00, 0x03, 0xFA, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x3C, 0x00, 0x3F, 0xFF,
-    0xC7, 0xC0, 0x0F, 0xF5, 0x7E, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0x80, 0xBF, 0x00, 0x07, 0xF4, 0x0F,
-    0xC0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x3F, 0x00, 0x00, 0xBD, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x01, 0xFC, 0x07, 0xE0,
-    0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0B, 0xF4, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x3F, 0xC1, 0xFE, 0xF0,
-    0x01, 0xFF, 0xFE, 0x2F, 0x00, 0x07, 0xFF, 0x42, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0xFD, 0x03, 0xF8, 0x01, 0xF8, 0x2F,
-    0x80, 0x07, 0xE0, 0xFC, 0x00, 0x2F, 0x47, 0xE0, 0x01, 0xFC, 0x3F, 0x41, 0xBF, 0xD0, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFE, 0x40, 0x1F, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x2F, 0xFF, 0xFD, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xBD,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xEA, 0xAA, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x05, 0xBF, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x57, 0xF4,
-    0x0F, 0xE0, 0x07, 0xE0, 0xBE, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xBD, 0x1F, 0x80, 0x07, 0xF0, 0xFD,
-    0x06, 0xFF, 0x43, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0x00, 0x7E, 0x40, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x6D,
-    0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x60, 0x00, 0x07, 0xFE, 0x03, 0xC0, 0x00, 0x3F, 0xFF, 0xBE, 0x00, 0x01, 0xE0, 0xBF, 0xF0, 0x00,
-    0x0B, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA,
-    0x90, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0x40, 0x02, 0x00, 0x03, 0xFE, 0x03, 0xC0, 0x03, 0xFF, 0xFB, 0xE0, 0x01, 0xE0, 0xBF,
-    0xF0, 0x00, 0x70, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xD5, 0xFD, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x2F,
-    0x80, 0x07, 0xE0, 0x0F, 0xC0, 0x02, 0xF4, 0x07, 0xE0, 0x01, 0xFC, 0x03, 0xF4, 0x1B, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x01,
-    0xB4, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0xBC, 0x00,
-    0x00, 0x01, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00,
-    0x00, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x0B, 0xC0, 0x00, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x07,
-    0xE7, 0xC0, 0x00, 0x00, 0x1F, 0x41, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x57, 0xF4, 0x00, 0x03, 0xF8, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x01, 0xF8, 0x00,
-    0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0x3F, 0x41, 0xBF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x1B, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0x07, 0xF0, 0x00, 0x00, 0x61, 0xFF, 0x80, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x00, 0x1F, 0x42,
-    0xE0, 0x00, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA,
-    0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xC0, 0x00, 0x24, 0xFF, 0x80, 0x00, 0x1F,
-    0x9F, 0x00, 0x01, 0xF4, 0x1F, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0x57, 0xF4, 0x0F, 0xE0, 0x07, 0xE0,
-    0xBE, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0xBD, 0x1F, 0x80, 0x07, 0xF0, 0xFD, 0x06, 0xFF, 0x43, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xF9, 0x00, 0x7E, 0x40, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x6D, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07,
-    0xF0, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x10, 0x00, 0x00, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0x07, 0xD0,
-    0xB8, 0x00, 0x00, 0x07, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xAA, 0xAA, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x2B, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0x0F, 0x80, 0x00, 0x03, 0xFE, 0x14, 0x00, 0x00, 0x7E, 0x7C,
-    0x00, 0x00, 0x07, 0xD0, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFD,
-    0x5F, 0xD0, 0x00, 0x3F, 0x80, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x02, 0xF4,
-    0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x1B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xE4, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xB4, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x14, 0x00, 0x01, 0xFF, 0x41, 0xE0, 0x00, 0x0F, 0xBF, 0xFF, 0x00, 0x00, 0xB4,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xAF, 0x00, 0x00, 0x01, 0xF4, 0x2E, 0x00, 0x00, 0x1E, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x40, 0x00, 0xFF, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00,
-    0x7F, 0xE0, 0x38, 0x00, 0x0F, 0xBF, 0xFF, 0x00, 0x01, 0xD0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7E, 0x7C, 0x00, 0x00, 0x1F,
-    0x41, 0xF0, 0x00, 0x03, 0x80, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x57, 0xF4, 0x00, 0x3F, 0x80,
-    0x1F, 0x80, 0x0B, 0xE0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x07, 0xF0, 0x03,
-    0xF4, 0x1B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x7E, 0x40, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFE, 0x01, 0xB4, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xD3, 0xD0, 0x00, 0x02, 0xF0, 0x1F, 0x00, 0x00, 0x78, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xA4, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0xA8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x02, 0xF4, 0xF8,
-    0x00, 0x2F, 0x41, 0xF4, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xF5, 0x7F, 0x40, 0xFE, 0x00, 0x7E, 0x0B, 0xE0,
-    0x01, 0xF8, 0x3F, 0x00, 0x0B, 0xD1, 0xF8, 0x00, 0x7F, 0x0F, 0xD0, 0x6F, 0xF4, 0x3F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0x90, 0x07, 0xE4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x06, 0xD0, 0x0B, 0xFF, 0xFF, 0x40, 0x07,
-    0xFF, 0xF4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFD, 0x00, 0x00, 0xBE, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x16, 0xFC, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xF8, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0,
-    0x00, 0x07, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00,
-    0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD,
-    0x00, 0x02, 0xF9, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0,
-    0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x40, 0x02,
-    0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0,
-    0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB,
-    0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8,
-    0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC7, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8,
-    0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x07, 0xFD, 0x5F, 0xF0, 0x03, 0xF8, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC7, 0xE0, 0x00,
-    0x03, 0xF1, 0xF8, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xC0, 0x1F, 0xE4, 0x6F, 0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80,
-    0x01, 0xFE, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00,
-    0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00,
-    0x07, 0xFB, 0xE0, 0x00, 0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00,
-    0x7F, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0x6F, 0x40, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x57, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x2F, 0x47, 0xE0,
-    0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x07, 0xF0, 0x07, 0xF9, 0x1B, 0xF4, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x59, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x2F, 0xFA, 0x6F, 0xFC, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x47, 0xD0, 0x00, 0x00, 0xFF,
-    0xCA, 0x00, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0xF0, 0x00, 0x00, 0x28, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x57, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x00,
-    0x7E, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x02, 0xF8,
-    0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x1F, 0xE4, 0x6F, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x87, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xEB, 0xC0, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x07, 0x80, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0xBF, 0x80, 0x01, 0xFE, 0x00, 0x7F,
-    0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0x00, 0xBE, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00,
-    0x00, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00,
-    0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xFD, 0x00, 0x00, 0x24,
-    0xFF, 0xC0, 0x00, 0x00, 0xFD, 0xF4, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xA0, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0x57, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0xFC, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF1, 0xF8, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x07, 0xF0, 0x07, 0xF9, 0x1B, 0xF4, 0x00, 0xBF, 0xFF, 0xF4, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x7E, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x7E, 0xBC,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xE9, 0xBF, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xE0, 0x00,
-    0x7F, 0x40, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0x00, 0xBE,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF4,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00,
-    0x2B, 0xD0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x47, 0x80,
-    0x00, 0x03, 0xFF, 0x04, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x28,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x07, 0xFD, 0x5F, 0xF0, 0x00, 0x3F, 0x80, 0x0B, 0xE0, 0x02,
-    0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x01, 0xF8,
-    0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0xFD,
-    0x00, 0x1F, 0xC0, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x40, 0x00, 0x01, 0xFF,
-    0x41, 0xE0, 0x00, 0x01, 0xFB, 0xFF, 0xF0, 0x00, 0x00, 0xB0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xAF,
-    0x00, 0x00, 0x00, 0x1F, 0x42, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
-    0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F,
-    0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB,
-    0xE0, 0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F,
-    0xE0, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00,
-    0x3F, 0xE4, 0x3C, 0x00, 0x0F, 0xEF, 0xFF, 0x40, 0x00, 0xE0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x0F,
-    0x80, 0xF0, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0x57, 0xFC, 0x00, 0x3F, 0x80,
-    0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00,
-    0x7E, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x3F,
-    0x40, 0x07, 0xF0, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x5F, 0x40, 0x00, 0x00, 0x3F, 0x02, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xA6, 0xFF, 0xC0,
-    0x02, 0xFE, 0x00, 0x07, 0xF8, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0,
-    0xBE, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7E,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0x80, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x00, 0x03, 0xF6, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x43, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x02, 0xFF,
-    0x95, 0xBF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x1F, 0x80, 0xF8, 0x00, 0x0F, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x1F, 0xF5, 0x7F, 0xC0, 0x0F, 0xE0, 0x02,
-    0xF8, 0x0B, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x07, 0xE1, 0xF8,
-    0x00, 0x02, 0xF4, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x7F, 0x00,
-    0x7F, 0x91, 0xBF, 0x40, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0F,
-    0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xFA, 0x6F, 0xFC, 0x3F, 0x00, 0x0B, 0xF8,
-    0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0x00, 0x07,
-    0xFF, 0xFF, 0x0F, 0xD0, 0x01, 0xFF, 0x57, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xF4, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x46, 0xFD, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xFA, 0x6F, 0xFC, 0x3F, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFF, 0xC0,
-    0x01, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xBF,
-    0xE5, 0x6F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xD0,
-    0x01, 0xFF, 0x57, 0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x7E,
-    0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xC0, 0x02, 0xFF, 0xA6, 0xFF, 0xC3, 0xF0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x26, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xA8, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0xD0, 0x01, 0xFF, 0x57,
-    0xFF, 0xF4, 0x00, 0x3F, 0x80, 0x0B, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x07, 0xE0,
-    0x00, 0x0B, 0xD0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x40, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x46, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x03, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00,
-    0x1E, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x07, 0xFF, 0xE4, 0x00, 0xFD, 0x00,
-    0x07, 0xFF, 0xFF, 0xE0, 0x1F, 0xC0, 0x02, 0xFF, 0xA6, 0xFF, 0xC3, 0xF0, 0x00, 0xBF, 0x80, 0x01,
-    0xFF, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0xBE, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x0B, 0xFE, 0x56, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x02, 0x40,
-    0x00, 0x00, 0xFF, 0xD0, 0xB4, 0x00, 0x00, 0x2F, 0xFF, 0xEF, 0x00, 0x00, 0x03, 0xC1, 0xFF, 0xD0,
-    0x00, 0x00, 0x34, 0x01, 0xA4, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x7F, 0xF8, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0xFD, 0x00, 0x1F, 0xF5, 0x7F,
-    0xFF, 0x40, 0x03, 0xF8, 0x00, 0xBF, 0x40, 0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
-    0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE4, 0x6F, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x0F, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFE, 0x01, 0xFC, 0x00, 0x2F, 0xFA, 0x6F, 0xFC, 0x3F, 0x00, 0x0B, 0xF8, 0x00, 0x1F, 0xFF,
-    0xC0, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xBF, 0xE5, 0x6F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xF8, 0x03, 0xF0,
-    0x00, 0x7F, 0xFF, 0xF0, 0xFD, 0x00, 0x1F, 0xF5, 0x7F, 0xFF, 0x40, 0x03, 0xF8, 0x00, 0xBF, 0x40,
-    0x00, 0xBE, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE4, 0x6F,
-    0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B,
-    0xD0, 0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x7E,
-    0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40,
-    0x00, 0x02, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x00,
-    0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xFD, 0x56,
-    0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07,
-    0xE0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4,
-    0x03, 0xF8, 0x1F, 0xAF, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0,
-    0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00,
-    0x00, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x02,
-    0xF4, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x55, 0xBF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x16, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x1F, 0x40,
-    0xBD, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00,
-    0x7E, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x2F, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x3F, 0x00, 0x2F, 0xF4, 0x03, 0xF8, 0x1F, 0xAF,
-    0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0xBF, 0xF4, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x03, 0xF0, 0x00, 0x00,
-    0x7E, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xD5, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4,
-    0x00, 0x0B, 0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0x80,
-    0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x00, 0x1F, 0xFF,
-    0xE2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x83, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0x7E, 0x1F, 0xC0, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xFF,
-    0xD0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD5, 0x6F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01,
-    0xF4, 0x00, 0x0B, 0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xFF,
-    0x80, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xE2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF0,
-    0x00, 0x00, 0x3E, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD3, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x55, 0xBF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x69, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0B, 0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x03,
-    0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFA,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x2F, 0xFC, 0x00, 0x00,
-    0x00, 0x02, 0xC0, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x87, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0x80, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x1F, 0xF5, 0x5B, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x01, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0x80, 0x00, 0x00,
-    0x1E, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0x00, 0xB8, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0B, 0xC2, 0xF4, 0x03, 0xF0, 0x00,
-    0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07,
-    0xE0, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x3F, 0x81, 0xFA, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x43,
-    0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x3F, 0x40, 0x3F, 0x00,
-    0x00, 0x07, 0xE1, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0xBF,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFD, 0x56, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0x0B, 0xC2, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xCB, 0xE0, 0x03,
-    0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x81, 0xFA,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE2, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x43, 0xE0, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0,
-    0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00,
-    0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0,
-    0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFD, 0x00, 0x1F, 0x80, 0x1F, 0x80, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00,
-    0x3E, 0xBD, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF7, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x78, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x00, 0x1F,
-    0xC0, 0xFC, 0x00, 0x02, 0x5B, 0xF0, 0x0B, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01,
-    0xF8, 0xBD, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x03, 0xEB,
-    0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x9B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x0F,
-    0xC0, 0x00, 0x00, 0x02, 0xF1, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF7,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0x5B,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x09, 0x00, 0x03, 0xFF, 0x02, 0xD0, 0x00, 0xBF, 0xFE, 0xBC, 0x00, 0x0F, 0x07, 0xFF,
-    0x40, 0x01, 0xD0, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x3F, 0x00, 0x01, 0xFC,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xD0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-    0x3F, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x0B, 0xC1, 0xF8, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00,
-    0x03, 0xEB, 0xD0, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x05,
-    0x00, 0x00, 0x02, 0xFF, 0x40, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xBD, 0x00, 0x00, 0x0B, 0x42, 0xFF,
-    0x80, 0x00, 0x00, 0xE0, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x3E,
-    0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x00, 0x02,
-    0xF0, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x1F, 0x40, 0x00, 0x00, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x25, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2, 0xFF, 0xFC, 0xB0, 0x3C, 0x28, 0x2C, 0x0A, 0x0C,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00,
-    0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x0E, 0x03, 0x80, 0xE0, 0xA0, 0x0C, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x05, 0x05,
-    0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x05, 0x55, 0x42, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xC1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x55, 0x55, 0x55, 0x54, 0x05, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x85,
-    0x55, 0x55, 0x54, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x54, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x54, 0x50, 0x00, 0x4F, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E,
-    0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4,
-    0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02,
-    0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF,
-    0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0xF4, 0x02, 0xEF, 0x40,
-    0x2E, 0xF4, 0x02, 0xEF, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xA0, 0x3F, 0xFF, 0xFF, 0xF0, 0x15, 0x55, 0x55, 0x50, 0x00, 0xB4, 0x07, 0xC0, 0x3E, 0x02, 0xF0,
-    0x0F, 0xC0, 0xFD, 0x07, 0xF0, 0x3F, 0x80, 0x54, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0xBE, 0x03, 0xF0,
-    0x1F, 0x80, 0xFC, 0x03, 0xD0, 0x2F, 0x00, 0x50, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x3F, 0x02, 0xF4,
-    0x0F, 0xC0, 0x7D, 0x03, 0xE0, 0x1F, 0x00, 0x10, 0x00, 0x3E, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0B,
-    0xC1, 0xF0, 0x3C, 0x05, 0x00, 0x00, 0xB4, 0x0B, 0x40, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x2F,
-    0x02, 0xF4, 0x0F, 0xC0, 0xFC, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x3F, 0x03, 0xF8, 0x2F, 0x80, 0x54,
-    0x05, 0x40, 0x00, 0x02, 0xF4, 0x2F, 0x80, 0xFC, 0x0F, 0xD0, 0xBE, 0x07, 0xF0, 0x3F, 0x03, 0xF4,
-    0x1F, 0x80, 0xF8, 0x0F, 0xC0, 0xBC, 0x03, 0xD0, 0x3E, 0x02, 0xF0, 0x1F, 0x00, 0x50, 0x05, 0x00,
-    0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x3F, 0x82, 0xF8, 0x03, 0xF0, 0x3F, 0x00, 0xBD, 0x0B, 0xE0, 0x0F,
-    0xC0, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x3E, 0x03, 0xF0, 0x07, 0xC0, 0x3C, 0x00, 0x10, 0x01, 0x00,
-    0x00, 0x7E, 0x07, 0xD7, 0xE0, 0xBD, 0x3F, 0x07, 0xE3, 0xF0, 0x7E, 0x3F, 0x03, 0xE2, 0xF0, 0x3E,
-    0x1F, 0x02, 0xE0, 0xF0, 0x1F, 0x05, 0x00, 0x50, 0x00, 0x01, 0x50, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0xFE,
-    0xBE, 0xBF, 0x3F, 0xFF, 0xFF, 0x9E, 0x9F, 0xAA, 0xD0, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x02, 0x94, 0xF5, 0x68, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x15, 0x1E, 0x05, 0x40, 0xBF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0x40, 0x40, 0x3C, 0x01,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x2F, 0xF4, 0x7F, 0xFC, 0xBF, 0xFD, 0xFF, 0xFE, 0xBF,
-    0xFE, 0xBF, 0xFD, 0x3F, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xFF, 0x00, 0x0F, 0xFF, 0x40, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x47, 0xFF, 0xD0, 0x2F, 0xE0, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD3, 0xFD, 0xFF, 0x3F, 0x41, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0xF8, 0x3F, 0xC0, 0x2F, 0xC7, 0xFC, 0x03, 0xFC, 0x3F, 0x40, 0x3F, 0x80,
-    0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0xBC, 0x00, 0x7E, 0x3F, 0xC0,
-    0x2F, 0xD0, 0x0F, 0xF7, 0xFC, 0x02, 0xFD, 0x00, 0xFF, 0x3F, 0x40, 0x2F, 0xC0, 0x0F, 0xD0, 0x40,
-    0x00, 0x50, 0x00, 0x14, 0x00, 0x0B, 0xC7, 0xF6, 0xFD, 0xBF, 0x05, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xCB, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00,
-    0xD0, 0x00, 0xD0, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x01, 0x40, 0xFF, 0xFF, 0x55, 0x5B, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x2E, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x1F, 0x07, 0xC1, 0xA4, 0x00, 0x06, 0x90, 0x1F, 0x00, 0xF8, 0x3D, 0x3F, 0xFC,
-    0x00, 0xFF, 0xF0, 0x3D, 0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x0F, 0xEB, 0xE0, 0xFD, 0xBE, 0x2F, 0x1F,
-    0x42, 0xF0, 0xBC, 0x0B, 0xC1, 0xFF, 0xE1, 0xF0, 0xF8, 0x07, 0xC3, 0xE0, 0x1F, 0x01, 0xB9, 0x0F,
-    0x47, 0xC0, 0x1F, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x7C, 0xBC, 0x01, 0xF0, 0x00,
-    0x0B, 0xC0, 0xF8, 0x02, 0xF3, 0xE0, 0x0B, 0xC0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x8F, 0x40, 0x3E,
-    0x00, 0x03, 0xD0, 0x0F, 0x40, 0x3D, 0x3D, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x3D, 0x01, 0xF0, 0xF0,
-    0x07, 0xC0, 0x02, 0xF0, 0x00, 0xF4, 0x0F, 0x83, 0xD0, 0x3E, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0xBC,
-    0x0F, 0x82, 0xF0, 0x00, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x2F, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x83, 0xE0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x0B, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x02, 0xE0,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x1F, 0x07, 0xC1, 0xA4, 0x00, 0x06, 0x90, 0x00, 0x1A, 0x41, 0xF0, 0x0F, 0x83, 0xD3, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x3D, 0x07, 0xC3, 0xE3, 0xFA, 0xF8, 0x0F, 0xEB, 0xE0, 0x3F, 0xAF,
-    0x4F, 0xDB, 0xE2, 0xF1, 0xF4, 0x2F, 0x0B, 0xC0, 0xBC, 0x2F, 0x03, 0xF1, 0xFF, 0xE1, 0xF0, 0xF8,
-    0x07, 0xC3, 0xD0, 0x1F, 0x0F, 0x40, 0xBC, 0x1B, 0x90, 0xF4, 0x7C, 0x01, 0xF1, 0xF0, 0x07, 0xCB,
-    0xC0, 0x1F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x7C, 0xBC, 0x01, 0xF3, 0xE0, 0x0B, 0xC0, 0x00, 0xBC,
-    0x0F, 0x80, 0x2F, 0x3E, 0x00, 0xBC, 0xF4, 0x02, 0xE0, 0x00, 0x7C, 0x03, 0xD0, 0x0B, 0x8F, 0x40,
-    0x3E, 0x3D, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF4, 0x03, 0xD3, 0xD0, 0x0F, 0x5F, 0x00, 0x3C, 0x00,
-    0x3E, 0x00, 0x3D, 0x01, 0xF0, 0xF0, 0x07, 0xC7, 0xC0, 0x2F, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0xF8,
-    0x3D, 0x03, 0xE1, 0xF0, 0x0F, 0x40, 0x1F, 0x00, 0x03, 0xF0, 0xBC, 0x0F, 0x82, 0xF0, 0x3E, 0x0B,
-    0xC0, 0x0F, 0x40, 0x00, 0x7F, 0xFD, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0xD0, 0x0F, 0x80, 0x00, 0x0B,
-    0xFD, 0x00, 0x2F, 0xF4, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x40, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x2E,
-    0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x02, 0xF0, 0x3F, 0x00,
-    0x3E, 0x0B, 0xC0, 0x0B, 0xC0, 0xF8, 0x00, 0xF4, 0x1F, 0x00, 0x2E, 0x03, 0xC0, 0x03, 0xC0, 0x78,
-    0x00, 0x74, 0x0A, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC1, 0xF8, 0x03, 0xF0, 0xBD, 0x0F, 0xC0, 0x2F,
-    0x03, 0xF0, 0x7D, 0x00, 0xF8, 0x2F, 0x03, 0xF0, 0x0B, 0xC0, 0xF8, 0x1F, 0x00, 0x3D, 0x07, 0xC0,
-    0xF8, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x74, 0x0A, 0x00, 0xE0, 0x00,
-    0x7D, 0x0F, 0x83, 0xE0, 0xBC, 0x1F, 0x03, 0xD0, 0xB4, 0x1E, 0x03, 0x80, 0x7D, 0x1F, 0x40, 0xF8,
-    0x3E, 0x03, 0xE0, 0xFC, 0x0B, 0xC1, 0xF0, 0x1F, 0x03, 0xC0, 0x3D, 0x0F, 0x40, 0xB4, 0x2E, 0x01,
-    0xE0, 0x7C, 0x03, 0x80, 0xF0, 0x7D, 0x1F, 0x43, 0xE0, 0x3E, 0x0F, 0x83, 0xF0, 0x3E, 0x0F, 0xC2,
-    0xF0, 0x2F, 0x07, 0xC1, 0xF0, 0x1F, 0x03, 0xC0, 0xF4, 0x0F, 0x43, 0xD0, 0xB8, 0x0B, 0x42, 0xE0,
-    0x78, 0x07, 0x81, 0xF0, 0x3C, 0x03, 0x80, 0xF0, 0x2C, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x7C, 0xB0, 0x00, 0x3C, 0x1D, 0x00, 0x2D, 0x03, 0xC0,
-    0x1E, 0x00, 0xF0, 0x0F, 0x00, 0x2D, 0x0F, 0x40, 0x03, 0x8B, 0x80, 0x00, 0xF0, 0x00, 0x04, 0x00,
-    0x07, 0xC0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xF8, 0x00, 0x3F,
-    0x00, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x03, 0xE0, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7D, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x10, 0x2F, 0x00,
-    0x03, 0xF8, 0x00, 0x0F, 0x41, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x07, 0xF0, 0x01, 0xE0, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x90, 0x01, 0xFF, 0xF0, 0x00, 0xA4, 0x3F,
-    0x00, 0x07, 0xFC, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x00, 0x0F, 0xFF,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7E, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF4, 0x08, 0x00, 0x03,
-    0xF4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x0B,
-    0xF0, 0x0F, 0xE0, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x7F, 0x00,
-    0x1F, 0xC0, 0x2F, 0x80, 0x0B, 0xE0, 0x0F, 0xD0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x07, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x1F, 0x00, 0x07, 0xC0,
-    0x0B, 0xC0, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x2F, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x07, 0xFC, 0x0B, 0xF8, 0x00, 0xFD, 0x01, 0xFC, 0x00,
-    0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFB, 0xF8, 0x08, 0x7E, 0x1F, 0xC0, 0x0B, 0xD0, 0xFC, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC0,
-    0xFC, 0x00, 0xF8, 0x1F, 0x80, 0x1F, 0x43, 0xF4, 0x01, 0xF0, 0xFE, 0x00, 0x2F, 0x7F, 0x80, 0x03,
-    0xFF, 0xD0, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x2A, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFF, 0xC6, 0xAA, 0xAA, 0xA9, 0x00, 0x30, 0x00, 0x00, 0x01,
-    0x87, 0x40, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x0F, 0x02, 0xE0, 0x00, 0x07, 0xC0, 0x0F, 0x80,
-    0x02, 0xF4, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0xBF, 0x55, 0xFD, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x0B, 0x80,
-    0x00, 0x03, 0x81, 0xD0, 0x00, 0x00, 0x2C, 0x38, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3D, 0xD0, 0x00,
-    0x00, 0xF0, 0xE0, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x0B, 0x40, 0xB0, 0x00,
-    0x0E, 0x00, 0xB4, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xAF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x81, 0x68,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC2,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0xA4, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x10, 0x02, 0xE0, 0x00, 0x00, 0x10,
-    0x03, 0xD0, 0x00, 0x7D, 0x02, 0xD0, 0x00, 0x00, 0xBD, 0x03, 0xC0, 0x00, 0xBF, 0xD3, 0xC0, 0x00,
-    0x00, 0xFF, 0xD3, 0xC0, 0x00, 0x1B, 0xFF, 0xD5, 0xA9, 0x00, 0x1B, 0xFF, 0x95, 0xA8, 0x00, 0x6F,
-    0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x2F, 0xD6, 0xBD, 0x00, 0x00, 0x3F, 0xDA, 0xFC,
-    0x00, 0xBE, 0xE0, 0x00, 0x00, 0x00, 0xFA, 0xD0, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x03, 0xF1,
-    0xF0, 0x00, 0x0F, 0xD0, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x2F, 0x80, 0xBC, 0x00, 0x00,
-    0x2F, 0x40, 0xFC, 0x00, 0x0B, 0x00, 0x7D, 0x00, 0x00, 0x0E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xE3, 0xFF, 0xF4, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x0B, 0xEA,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD5, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0xBF, 0xFC, 0x00, 0x06, 0xAF, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x05, 0x6F, 0x40,
-    0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x7F, 0xFC, 0x00, 0x01, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x1B, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF4, 0x1F, 0xE5, 0xBF,
-    0x80, 0xFE, 0x5B, 0xFC, 0x08, 0x00, 0x1F, 0xC0, 0x50, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0xE0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0xFD, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xC1, 0xFE,
-    0x5B, 0xF8, 0x01, 0xFC, 0x08, 0x00, 0x1F, 0xC0, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00,
-    0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0xBC, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xC0,
-    0x00, 0x2F, 0xE0, 0x00, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xFC, 0x00, 0x01, 0xF0,
-    0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x00, 0x3D,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x01, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xFF, 0xD0, 0x00, 0x2F, 0xC0, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0x80, 0xBF, 0x97, 0xFD, 0x00, 0x3F, 0x40, 0x20, 0x00, 0xBE, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x01, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x02, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00,
-    0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00,
-    0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xC5, 0x55, 0x55, 0x57, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC2, 0xE5, 0x7F, 0xFF, 0xF8, 0xB4, 0x0F, 0xFF, 0xFF, 0x2D, 0x03, 0xFF, 0xFF, 0xEB,
-    0x40, 0xFF, 0xFF, 0xFE, 0xD0, 0x3F, 0xFF, 0xFF, 0xB4, 0x0F, 0xFF, 0xFF, 0xED, 0x03, 0xFF, 0xFF,
-    0xFB, 0x40, 0xFF, 0xFF, 0xFE, 0xD0, 0x3F, 0xFF, 0xFF, 0xB4, 0x0F, 0xFF, 0xFF, 0xAD, 0x03, 0xFF,
-    0xFF, 0xDB, 0x40, 0xFF, 0xFF, 0xF2, 0xD0, 0x3F, 0xFF, 0xF0, 0xB4, 0x0F, 0xFF, 0xE0, 0x2D, 0x03,
-    0xC0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00, 0x2D,
-    0x03, 0xC0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0x00,
-    0x2D, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0xF0, 0x00, 0x02, 0xD0, 0x3C, 0x00, 0x00, 0xB4, 0x0F, 0x00,
-    0x00, 0x2D, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xD0, 0x2F,
-    0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x57, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F, 0xFF, 0xFF, 0x02,
-    0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF,
-    0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D,
-    0x2F, 0xFF, 0xFF, 0x02, 0xD0, 0xFF, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFF, 0xAB, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x1A, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3D, 0x5F, 0xFF, 0xFF, 0x03, 0xC0, 0xBF, 0xFF, 0xF8, 0x3C, 0x0B, 0xFF, 0xFF, 0xC3, 0xC0, 0xBF,
-    0xFF, 0xFC, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xE3,
-    0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFC, 0x3C, 0x0B, 0xFF,
-    0xFF, 0xC3, 0xC0, 0xBF, 0xFF, 0xF8, 0x3E, 0xAF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x2A,
-    0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x18, 0x00, 0xF4, 0x00, 0x0F, 0xE0, 0x3C, 0x00, 0x03, 0xFF, 0x9E,
-    0x00, 0x00, 0x06, 0xFF, 0xEF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x07, 0xFC, 0x16, 0x80, 0x07,
-    0xDB, 0x40, 0x00, 0x0B, 0xE1, 0xF0, 0x00, 0x0B, 0xF0, 0x3D, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00,
-    0x24, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x40, 0x0F, 0xD0, 0xBF, 0x42, 0xFD, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0xBC, 0x01, 0xF0, 0x03, 0xC0,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x55, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x80, 0x01, 0xD0,
-    0x00, 0x00, 0x2C, 0x00, 0x38, 0x00, 0x00, 0x00, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x01,
-    0x80, 0x07, 0x40, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0x80, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x90, 0x07, 0xC0, 0x00, 0x03, 0xF4, 0x1E, 0x00, 0x00,
-    0x1F, 0xFD, 0xB0, 0x00, 0x00, 0x06, 0xFF, 0xEB, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x02,
-    0xFE, 0x05, 0x90, 0x00, 0x3F, 0x3C, 0x00, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x3F, 0x42, 0xF0,
-    0x00, 0x00, 0xF8, 0x07, 0xD0, 0x00, 0x00, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x80, 0x0F, 0x40, 0x00, 0x0B, 0xE0, 0x3C, 0x00, 0x00,
-    0x2F, 0xF8, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xEF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x07,
-    0xFC, 0x16, 0x80, 0x00, 0x7D, 0xB8, 0x00, 0x00, 0x07, 0xE1, 0xF0, 0x00, 0x00, 0x7F, 0x03, 0xE0,
-    0x00, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x01, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xCB, 0xF0, 0x03, 0xE2, 0xFC, 0x01, 0xF4, 0x3D, 0x00, 0xBC,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x0A, 0x43, 0xF0, 0x0B, 0xF0, 0xF4, 0x02, 0xFC, 0xBC, 0x00,
-    0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0xE4,
-    0x00, 0x00, 0x02, 0xD0, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x1B, 0xFF, 0xFA,
-    0x57, 0xF4, 0x78, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x1C, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0x9A, 0xF8, 0x00, 0x3E,
-    0x00, 0x03, 0xE0, 0x0F, 0x40, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x00, 0x38, 0x74, 0x00, 0x00, 0x02,
-    0xC1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x80,
-    0xB8, 0x0D, 0x00, 0x3E, 0x0B, 0x83, 0xF0, 0x00, 0xF8, 0xB8, 0xFC, 0x00, 0x03, 0xEB, 0xBF, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x01, 0x55, 0xBF, 0xF9, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xFF,
-    0xFA, 0xAA, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xBF, 0x00, 0x00, 0xFC, 0xB8, 0xFC, 0x00,
-    0x3F, 0x0B, 0x83, 0xF0, 0x02, 0xC0, 0xB8, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x00, 0xBD, 0x0F, 0xC1, 0xF4, 0x2F, 0x00, 0x3F,
-    0x0B, 0xD0, 0xFC, 0x1F, 0x80, 0x2F, 0x03, 0xF0, 0x7D, 0x0F, 0xC0, 0x0F, 0x82, 0xF0, 0x3E, 0x07,
-    0xD0, 0x0B, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x03, 0xD0, 0x7C, 0x0F, 0x41, 0xF0, 0x02, 0xE0, 0x3C,
-    0x07, 0xC0, 0xF4, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x00, 0x74, 0x0A, 0x01, 0xD0, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B,
-    0xE3, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1A, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x42, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0xFE, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x83, 0xF4, 0xFE, 0x3F, 0x41, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x3F,
-    0x40, 0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x1E, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0F,
-    0x80, 0x09, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x03, 0xF8, 0x00,
-    0x3F, 0x40, 0x3E, 0x00, 0xFD, 0x00, 0x01, 0x40, 0x0F, 0x80, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xD5, 0x55, 0x55, 0x7E, 0x55, 0x55, 0x50, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x10,
-    0x00, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0xFE, 0x00,
-    0xF8, 0x07, 0xF0, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB,
-    0xF6, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xFD, 0xBF, 0x9F, 0xD2, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00, 0x00, 0x1F, 0x8F,
-    0xF3, 0xFC, 0xBF, 0x05, 0x00, 0x00, 0x50, 0xBF, 0x3F, 0xCF, 0xF1, 0xF8, 0x00, 0x00, 0x02, 0x93,
-    0xFC, 0xFF, 0x3F, 0xC2, 0x90, 0x00, 0x00, 0x1F, 0x8F, 0xF3, 0xFC, 0xBF, 0x05, 0x00, 0xFF, 0xFF,
-    0x57, 0xD5, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07,
-    0xE0, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xBF, 0xFE,
-    0x3F, 0xFC, 0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0,
-    0x1F, 0xF4, 0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0x02, 0x80, 0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40,
-    0x00, 0x19, 0x00, 0x07, 0xFF, 0x40, 0x7E, 0xBF, 0x03, 0xE0, 0x3D, 0x2F, 0x00, 0xF4, 0xF4, 0x03,
-    0xE3, 0xC0, 0x0F, 0x5F, 0x00, 0x3D, 0xBC, 0x00, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x2E, 0x2F, 0x00,
-    0xF4, 0x7C, 0x0B, 0xC0, 0xFE, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0xE0, 0x00, 0x01, 0x40, 0x3C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xF0, 0x0E, 0x01, 0xE0, 0x2D, 0x03,
-    0xC0, 0x3C, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xF4,
-    0x00, 0x1E, 0xF4, 0x00, 0x7C, 0xF0, 0x00, 0xF1, 0xF0, 0x03, 0xD2, 0xE0, 0x0B, 0x43, 0xD0, 0x2E,
-    0x03, 0xC0, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x40, 0xF0, 0x00, 0x0B,
-    0x80, 0x00, 0x3D, 0x00, 0x00, 0xFB, 0x90, 0x07, 0xFF, 0xE0, 0x04, 0x0B, 0xC0, 0x00, 0x0F, 0x40,
-    0x00, 0x3D, 0x00, 0x00, 0xF4, 0x40, 0x0B, 0xC3, 0xEA, 0xFD, 0x0B, 0xFF, 0xD0, 0x01, 0x50, 0x00,
-    0x00, 0x01, 0x50, 0x01, 0xFF, 0xE0, 0x1F, 0xEA, 0x41, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0x78, 0x00,
-    0x03, 0xDB, 0xF4, 0x0F, 0xFF, 0xF4, 0x7E, 0x03, 0xE1, 0xF0, 0x07, 0xC7, 0xC0, 0x1E, 0x1F, 0x00,
-    0xB8, 0x7C, 0x07, 0xC0, 0xFE, 0xBE, 0x00, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-    0x80, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-    0x0B, 0xC0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0xBF, 0xF4, 0x02, 0xF9, 0xBC, 0x03, 0xD0, 0x3D, 0x03, 0xC0, 0x3D, 0x03, 0xD0, 0x7C, 0x01, 0xF6,
-    0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xD0, 0x1F, 0x42, 0xF0, 0x3D, 0x00, 0xF4, 0x3C, 0x00, 0xF4,
-    0x3D, 0x01, 0xF0, 0x2F, 0x9B, 0xE0, 0x0B, 0xFF, 0x40, 0x00, 0x54, 0x00, 0x00, 0x14, 0x00, 0x0B,
-    0xFF, 0x00, 0xBE, 0xBF, 0x07, 0xD0, 0x3C, 0x2E, 0x00, 0xF4, 0xF4, 0x03, 0xD3, 0xD0, 0x0F, 0x4F,
-    0x80, 0xFC, 0x1F, 0xFF, 0xF0, 0x1F, 0xDB, 0x80, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x02,
-    0xAB, 0xF4, 0x0F, 0xFE, 0x00, 0x05, 0x40, 0x00, 0x00, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x7F, 0xFF, 0xE6, 0xAF, 0xA9, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x6A, 0xAA, 0x90, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0xAA, 0xA9, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x40, 0x0B,
-    0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xD0,
-    0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xB8, 0x00, 0x0F, 0x00, 0x02, 0xC0,
-    0x00, 0x00, 0xF0, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0xC0, 0x0F,
-    0x40, 0x2E, 0x00, 0xB8, 0x00, 0x01, 0x01, 0x90, 0x07, 0x6F, 0xF8, 0x0B, 0xF4, 0x7C, 0x0F, 0xC0,
-    0x3C, 0x0F, 0x40, 0x3C, 0x1F, 0x00, 0x7C, 0x2D, 0x00, 0xB8, 0x3C, 0x00, 0xB4, 0x3C, 0x00, 0xF0,
-    0x7C, 0x00, 0xF0, 0x78, 0x01, 0xE0, 0x50, 0x01, 0x40, 0x00, 0x19, 0x00, 0x07, 0xFF, 0x40, 0x7F,
-    0xBF, 0x03, 0xE0, 0x3D, 0x1F, 0x00, 0xB8, 0xF8, 0x02, 0xE3, 0xD0, 0x0B, 0x8F, 0x00, 0x3E, 0x7C,
-    0x00, 0xF5, 0xF0, 0x03, 0xC7, 0xC0, 0x2F, 0x1F, 0x00, 0xF8, 0x3D, 0x0B, 0xC0, 0xFE, 0xFD, 0x00,
-    0xFF, 0xD0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xBF, 0x9F, 0xFD, 0xB8, 0xF0, 0x07, 0xC0,
-    0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0x7C, 0x02, 0xE0, 0x0F, 0x40, 0x3D, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF4, 0x03, 0xFA, 0xFC, 0x01, 0x40, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x01, 0xFF, 0xF4, 0x03, 0xEA, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x7C, 0x00, 0x06, 0xF4, 0x00, 0xFF, 0x80, 0x00, 0xAF, 0xD0, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0xF4, 0x10, 0x02, 0xF0, 0x3E, 0xAF, 0xD0, 0x3F, 0xFF, 0x40, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xB8,
-    0x00, 0x3D, 0xF4, 0x00, 0xB4, 0xF0, 0x02, 0xE0, 0xF0, 0x07, 0xC1, 0xF0, 0x0F, 0x02, 0xE0, 0x3F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x3F, 0xFF, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3C,
-    0x00, 0x00, 0xFB, 0x90, 0x07, 0xFF, 0xE0, 0x04, 0x0B, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x40, 0x0B, 0xC3, 0xEA, 0xFC, 0x0B, 0xFF, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0xBF, 0xF0, 0x1F, 0xEA, 0x40, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x02, 0xE7, 0xF4,
-    0x0F, 0xFF, 0xF4, 0x3F, 0x02, 0xF0, 0xF4, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0xB8, 0x3D, 0x03,
-    0xD0, 0xBE, 0xBE, 0x00, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x0B,
-    0xFF, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-    0x0F, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x07, 0xFF, 0x80, 0x7E,
-    0x6F, 0x43, 0xE0, 0x2E, 0x0F, 0x40, 0xB8, 0x2E, 0x03, 0xD0, 0x3E, 0xBD, 0x00, 0xBF, 0xC0, 0x0F,
-    0xEF, 0x80, 0xF8, 0x1F, 0x4B, 0x80, 0x3E, 0x3D, 0x00, 0xB8, 0xB8, 0x03, 0xD1, 0xFD, 0xBF, 0x01,
-    0xFF, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x14, 0x00, 0x07, 0xFF, 0x00, 0xBE, 0xBF, 0x03, 0xD0, 0x3D,
-    0x2F, 0x00, 0xB4, 0xB8, 0x02, 0xD3, 0xE0, 0x0F, 0x4B, 0xC0, 0xBD, 0x0F, 0xFF, 0xF0, 0x1F, 0xE7,
-    0xC0, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x42, 0xAB, 0xF4, 0x0B, 0xFE, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x60, 0x00, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x0B, 0x00, 0x3F, 0xFF, 0xE2, 0xAF, 0xAA,
-    0x00, 0xB0, 0x00, 0x0B, 0x00, 0x00, 0xB0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x2A,
-    0xAA, 0xA0, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE2, 0xAA,
-    0xA9, 0x00, 0x3C, 0x00, 0xF4, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40, 0x2F, 0x00, 0x3D, 0x00, 0x7C,
-    0x00, 0xBC, 0x00, 0xB8, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xB8, 0x00, 0x7C,
-    0x00, 0x3C, 0x00, 0x2D, 0x00, 0x00, 0xB0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x2D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xB8, 0x00, 0xF4, 0x02,
-    0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x2F, 0x00, 0x7C, 0x00, 0x00, 0x69, 0x08, 0x03, 0xFF, 0xAC, 0x0F,
-    0x40, 0xF8, 0x2D, 0x00, 0xF4, 0x3C, 0x00, 0xF4, 0x78, 0x00, 0xF0, 0xB4, 0x00, 0xF0, 0xB4, 0x02,
-    0xE0, 0xB4, 0x07, 0xD0, 0x7C, 0x2F, 0xC0, 0x2F, 0xF2, 0xC0, 0x05, 0x40, 0x00, 0x00, 0x6A, 0x00,
-    0x3F, 0xFC, 0x0F, 0x02, 0xD2, 0xD0, 0x2D, 0x3C, 0x0B, 0xC7, 0xFF, 0xE0, 0xBA, 0x50, 0x0B, 0x40,
-    0x00, 0xB4, 0x00, 0x03, 0xD0, 0x60, 0x1F, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x6A, 0x00, 0x1F, 0xFF,
-    0x40, 0xF4, 0x0F, 0x0F, 0x40, 0x2D, 0x3C, 0x00, 0xB6, 0xD0, 0x02, 0xDB, 0x40, 0x0F, 0x2D, 0x00,
-    0x3C, 0xB4, 0x02, 0xD0, 0xF4, 0x2E, 0x01, 0xFF, 0xE0, 0x00, 0x54, 0x00, 0x01, 0x80, 0x0A, 0x00,
-    0xB4, 0x0F, 0x40, 0x0F, 0x0B, 0x40, 0x02, 0xD7, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x0B, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x03, 0xED, 0x00, 0x03, 0xC3, 0xC0, 0x03, 0xC0, 0xB4, 0x03, 0xD0, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0xFF, 0xFC, 0x04, 0x02, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x1A, 0xFF, 0x0F, 0xEA, 0xE3, 0xD0, 0x2D, 0x38, 0x07, 0xC3, 0xC1, 0xF0, 0x2F, 0xFC, 0x00, 0x14,
-    0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x86, 0x90, 0x2D,
-    0xFF, 0xE0, 0xFE, 0x03, 0xC3, 0xE0, 0x0F, 0x1F, 0x00, 0x38, 0x74, 0x01, 0xE2, 0xC0, 0x0B, 0x4F,
-    0x00, 0x3C, 0x38, 0x00, 0xF1, 0xD0, 0x07, 0x8B, 0x40, 0x2D, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x64, 0x2D, 0x07, 0xC0, 0xF0, 0x78,
-    0x03, 0xC7, 0x80, 0x1E, 0xB8, 0x00, 0x7F, 0xC0, 0x02, 0xFB, 0x80, 0x0F, 0x0F, 0x00, 0x38, 0x1E,
-    0x01, 0xD0, 0x3C, 0x0B, 0x40, 0x78, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x2D, 0x03, 0xC0, 0x3C, 0x07,
-    0x80, 0xB4, 0x0F, 0x00, 0xF0, 0x0E, 0x01, 0xD0, 0x2C, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xB4, 0x00,
-    0x00, 0x02, 0x06, 0x80, 0x2A, 0x00, 0xB7, 0xFF, 0x1F, 0xFC, 0x0F, 0xD0, 0x7B, 0x42, 0xD0, 0xF4,
-    0x07, 0xC0, 0x2D, 0x0F, 0x00, 0x78, 0x02, 0xC1, 0xE0, 0x0B, 0x00, 0x3C, 0x2C, 0x00, 0xF0, 0x03,
-    0x83, 0xC0, 0x0E, 0x00, 0x74, 0x3C, 0x01, 0xE0, 0x0B, 0x07, 0x80, 0x2D, 0x00, 0xF0, 0xB4, 0x03,
-    0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0xE4, 0x03, 0xDF, 0xFD, 0x03, 0xF4, 0x2E,
-    0x07, 0xD0, 0x1E, 0x0B, 0x80, 0x2D, 0x0F, 0x00, 0x3D, 0x0F, 0x00, 0x3C, 0x1E, 0x00, 0x7C, 0x2D,
-    0x00, 0xB8, 0x3C, 0x00, 0xF4, 0x3C, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0xA8, 0x00, 0x3D,
-    0xFF, 0xC0, 0x0F, 0xD0, 0xB8, 0x07, 0xC0, 0x0E, 0x02, 0xE0, 0x03, 0x80, 0xF0, 0x01, 0xE0, 0x3C,
-    0x00, 0xB4, 0x1F, 0x00, 0x3C, 0x07, 0xC0, 0x2E, 0x02, 0xF8, 0x2F, 0x00, 0xF3, 0xFF, 0x00, 0x38,
-    0x14, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01,
-    0xA9, 0x03, 0xFF, 0xF1, 0xE0, 0x00, 0x74, 0x00, 0x0F, 0x40, 0x01, 0xFC, 0x00, 0x0B, 0xD0, 0x00,
-    0x7C, 0x00, 0x0F, 0x24, 0x0B, 0x8F, 0xFF, 0x80, 0x15, 0x00, 0x02, 0x80, 0x03, 0x40, 0x1F, 0xA8,
-    0xBF, 0xFC, 0x0F, 0x00, 0x1E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x74, 0x00,
-    0x78, 0x00, 0x3F, 0xC0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x19, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x6A, 0xAA, 0x5F, 0x80, 0x3F, 0xFF,
-    0xEB, 0xD0, 0x0F, 0xEA, 0xA6, 0xF4, 0x07, 0xD0, 0x00, 0xBD, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xEA, 0xA0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x17,
-    0xF9, 0x55, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x0B, 0x83, 0xC0, 0x00, 0x00, 0x3C, 0x1F, 0x00,
-    0x00, 0x01, 0xFA, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF,
-    0xE0, 0xFB, 0x00, 0x2F, 0xDF, 0x07, 0xC0, 0x01, 0xFC, 0x7C, 0x2D, 0x00, 0x0F, 0xC2, 0xD0, 0xF0,
-    0x00, 0xBE, 0x0F, 0x07, 0x80, 0x03, 0xF0, 0xB8, 0x3D, 0x00, 0x1F, 0x83, 0xC1, 0xF0, 0x00, 0xBD,
-    0x1F, 0x0B, 0x40, 0x03, 0xF0, 0xB4, 0x3C, 0x00, 0x0F, 0xC3, 0xC1, 0xE0, 0x00, 0x3F, 0x2E, 0x0F,
-    0x00, 0x00, 0xFC, 0xF0, 0x7C, 0x00, 0x03, 0xF7, 0xC2, 0xD0, 0x00, 0x0F, 0xFD, 0x0F, 0x00, 0x00,
-    0x1F, 0xF0, 0x78, 0x00, 0x00, 0x3F, 0xC3, 0xC0, 0x00, 0x00, 0x7F, 0xEF, 0xAF, 0x40, 0x01, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0B, 0x5F, 0xFF, 0x90, 0x00, 0x3C, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0xF0, 0x00,
-    0x00, 0x0F, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xAA, 0xFC, 0x00, 0xFF, 0x40, 0x01, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xA0, 0x6D, 0x07, 0xE0, 0x0F, 0x3F, 0xE0, 0xBD, 0x01, 0xFF, 0xEC,
-    0x0F, 0xC0, 0x2F, 0xE0, 0x00, 0xFC, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00,
-    0x7F, 0x0F, 0x80, 0x00, 0x03, 0xFD, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x9B, 0xC0, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x15, 0xFD, 0x54, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x2B, 0xFE, 0xA8, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x56, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x04, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0xBF, 0x55, 0x50, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0A, 0xBF, 0xAA, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xAF, 0xEA, 0xA8,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xAA, 0xAA, 0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x0B, 0xFC, 0x0F, 0xFF,
-    0xE0, 0x00, 0xBC, 0x7F, 0xFF, 0x3F, 0xFF, 0xF8, 0x00, 0xFD, 0xF9, 0x7F, 0xFF, 0x96, 0xFC, 0x00,
-    0xFF, 0xC0, 0x0F, 0xFD, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBD, 0x01, 0xFD, 0x00,
-    0x0F, 0xE0, 0x00, 0xBC, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x2F, 0x80,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x7F, 0x40, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0xFF, 0x00, 0x02, 0xF4,
-    0x07, 0xD0, 0x02, 0xFF, 0x00, 0x02, 0xF0, 0x0B, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x0F, 0xFD, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x2F, 0xFC, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x3C, 0xFC,
-    0x00, 0x0B, 0xD0, 0x2F, 0x40, 0xF8, 0xFC, 0x00, 0x0F, 0xC0, 0x2F, 0x01, 0xF1, 0xF8, 0x00, 0x0F,
-    0xC0, 0x3F, 0x03, 0xD2, 0xF4, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xF4, 0x00, 0x0F, 0xE0, 0x00, 0xF4, 0x00, 0x1F,
-    0xF0, 0x01, 0xF0, 0x00, 0x2F, 0xF0, 0x02, 0xF0, 0x00, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x3E, 0xF0,
-    0x03, 0xE0, 0x00, 0x3D, 0xF4, 0x07, 0xD0, 0x00, 0x7C, 0xF8, 0x07, 0xC0, 0x0A, 0xFE, 0xFE, 0xAF,
-    0xE8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0A, 0xFE, 0xFE, 0xAF, 0xE8, 0x01, 0xF4, 0x7C, 0x1F, 0x40,
-    0x01, 0xF0, 0x7C, 0x2F, 0x00, 0x2B, 0xFA, 0xFF, 0xBF, 0xA0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1B,
-    0xE5, 0x7F, 0xBE, 0x50, 0x07, 0xD0, 0x2E, 0x7C, 0x00, 0x0B, 0xC0, 0x2F, 0xBC, 0x00, 0x0B, 0xC0,
-    0x1F, 0xBC, 0x00, 0x0F, 0x80, 0x1F, 0xF8, 0x00, 0x0F, 0x40, 0x0F, 0xF4, 0x00, 0x1F, 0x00, 0x0F,
-    0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0x42, 0xD0, 0x00, 0xFC, 0x00, 0x3F,
-    0x07, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0xFE, 0x7F, 0xFE, 0x01, 0xF4,
-    0x07, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xF1, 0x7F, 0x95, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0x00,
-    0x03, 0xFA, 0x90, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x10,
-    0x3F, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x02, 0xF4, 0x2F,
-    0xFE, 0x00, 0x2F, 0x40, 0x0F, 0xC3, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x3F, 0x2F, 0xD5, 0xB0, 0x03,
-    0xF0, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC3, 0xF0, 0x00, 0x00, 0x7E, 0x57, 0xFD,
-    0x0F, 0xC0, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x3F, 0x40, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0x40,
-    0x00, 0x3F, 0x07, 0xE0, 0x00, 0xBF, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0x0B, 0xD0,
-    0x3F, 0x00, 0x00, 0x7F, 0x40, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x00, 0xFC, 0x01, 0xF4, 0x00,
-    0x00, 0xFC, 0x03, 0xE0, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0xBD, 0x00, 0x3F, 0x2D, 0x01, 0xFD, 0x03, 0xF0, 0x00, 0xFD, 0xBF, 0xFF, 0xE0, 0x0F, 0xC0, 0x02,
-    0xF4, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xFC, 0x00,
-    0x3D, 0x01, 0xF0, 0x01, 0xFC, 0x00, 0xBC, 0x02, 0xF0, 0x02, 0xFC, 0x00, 0xF8, 0x02, 0xF0, 0x03,
-    0xFC, 0x01, 0xF4, 0x02, 0xF0, 0x07, 0xBC, 0x02, 0xF0, 0x02, 0xF0, 0x0F, 0x7C, 0x03, 0xE0, 0x02,
-    0xF0, 0x1F, 0x78, 0x07, 0xC0, 0x03, 0xF0, 0x2E, 0x78, 0x0B, 0xC0, 0x03, 0xE0, 0x3C, 0x78, 0x0F,
-    0x40, 0x03, 0xE0, 0x7C, 0xB8, 0x1F, 0x00, 0x03, 0xE0, 0xF8, 0xB8, 0x3F, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xD3, 0xD0, 0xF4, 0xF8, 0x00, 0x03,
-    0xD7, 0xC0, 0xF4, 0xF4, 0x00, 0x03, 0xCB, 0x80, 0xF5, 0xF0, 0x00, 0x03, 0xCF, 0x40, 0xF2, 0xE0,
-    0x00, 0x07, 0xDF, 0x00, 0xF3, 0xC0, 0x00, 0x07, 0xEE, 0x00, 0xF7, 0xC0, 0x00, 0x07, 0xFC, 0x00,
-    0xFB, 0x40, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00,
-    0x00, 0xBC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0xAA, 0xAB, 0xF4, 0x00, 0xF8,
-    0x00, 0x2F, 0x00, 0x01, 0xFC, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0x3E,
-    0x00, 0x00, 0x7D, 0x02, 0xF0, 0x00, 0x7D, 0x02, 0x90, 0x7D, 0x03, 0xF0, 0x00, 0xBC, 0x07, 0xC0,
-    0x7C, 0x03, 0xE0, 0x00, 0xFC, 0x0B, 0xC0, 0xBC, 0x07, 0xD0, 0x00, 0xF8, 0x0F, 0xC0, 0xFC, 0x0B,
-    0xC0, 0x00, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0xC0, 0x01, 0xF4, 0x1F, 0x41, 0xF4, 0x0F, 0x80, 0x02,
-    0xF0, 0x2F, 0x01, 0xF0, 0x0F, 0x40, 0x03, 0xF0, 0x3F, 0x02, 0xF0, 0x1F, 0x40, 0x03, 0xE0, 0x3E,
-    0x03, 0xF0, 0x2F, 0x00, 0x07, 0xD0, 0x3E, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xC0, 0x7D, 0x07, 0xD0,
-    0x3E, 0x00, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0, 0x7D, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0xBC, 0x00,
-    0x0F, 0x80, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x41, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x01,
-    0xF5, 0x55, 0x7F, 0xD0, 0x00, 0x2F, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3E, 0x03, 0xFF, 0xFF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x15, 0x5B, 0xE4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x02, 0xFF, 0x82, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x7F, 0xD5, 0xBB, 0xF0, 0x00,
-    0x0F, 0xE0, 0x02, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80,
-    0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xC0, 0x0B, 0xFD,
-    0x00, 0x00, 0xFF, 0x07, 0xEB, 0xC0, 0x00, 0x07, 0xFF, 0xF8, 0xBC, 0x00, 0x00, 0x1F, 0xFD, 0x0F,
-    0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0x55, 0x55,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xAA, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x20, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x17, 0xF5, 0x55, 0x00, 0x00, 0xBF, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x95, 0xB8, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40,
-    0x03, 0xF0, 0x00, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0xBD, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x01,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0xBD, 0x3F, 0x80, 0x00, 0x01, 0x7F, 0x7F, 0xD5, 0x50, 0x02, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFE, 0x1F, 0x80, 0x00, 0x00, 0xBD,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xE0,
-    0x03, 0xF4, 0x00, 0x01, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC3, 0xC0, 0x00, 0x00, 0x7E, 0xBF, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD1, 0xE0,
-    0x00, 0x3F, 0x6F, 0x7F, 0x80, 0x00, 0xE0, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0x00, 0x34, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA5, 0x6F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0x80, 0x01, 0xF4, 0x00,
-    0x03, 0xF0, 0x1F, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x97, 0xF8, 0x03, 0xF0, 0x00,
-    0x0F, 0xD0, 0xBD, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0xFC, 0x07, 0xE0, 0x00,
-    0x7F, 0x41, 0xF8, 0x00, 0xFC, 0x0B, 0xD0, 0x01, 0xFE, 0x02, 0xF4, 0x00, 0xFC, 0x0B, 0xC0, 0x1F,
-    0xF8, 0x03, 0xF0, 0x02, 0xF8, 0x0F, 0xEA, 0xFF, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x90, 0x00, 0x07, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xF4, 0xBC, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x3F,
-    0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-    0x2F, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x02, 0xF7,
-    0xD0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xD0, 0xFF, 0xC0,
-    0x00, 0x01, 0xFC, 0xBD, 0xF0, 0x00, 0x00, 0xFF, 0x7D, 0x3D, 0x00, 0x00, 0xFA, 0xFE, 0x0F, 0x80,
-    0x00, 0xBC, 0x7F, 0x03, 0xE0, 0x00, 0x7D, 0x0F, 0x00, 0xFC, 0x00, 0x3E, 0x02, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x09, 0x6F, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xAB, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x7F, 0x00, 0x00,
-    0xBD, 0x00, 0x1F, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2B, 0xFE, 0xAA, 0xBF, 0xE8, 0x01, 0xF8,
-    0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x17, 0xF5, 0x55, 0x7F, 0x50, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x6B, 0xFA, 0xAA, 0xFE, 0x90, 0x07, 0xE0, 0x02, 0xFC, 0x00, 0x0B, 0xD1, 0x6F, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFA, 0xFE, 0x00, 0x1F, 0xF4,
-    0x78, 0x06, 0x00, 0x0F, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x00, 0x00, 0x07, 0xF0, 0x03,
-    0xC0, 0x00, 0x03, 0xF4, 0x01, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0xB8, 0x00, 0x00, 0xBE, 0x00, 0x3D,
-    0x00, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xEA, 0xA9, 0x07, 0xF0, 0x01, 0xFF,
-    0xFF, 0x82, 0xF8, 0x00, 0xBF, 0xFF, 0xD0, 0xBE, 0x00, 0x3D, 0x03, 0xF0, 0x2F, 0x80, 0x0F, 0x00,
-    0xFC, 0x0B, 0xE0, 0x07, 0xC0, 0x3F, 0x01, 0xFC, 0x01, 0xE0, 0x1F, 0x80, 0x3F, 0x00, 0xB4, 0x0B,
-    0xD0, 0x0F, 0xF0, 0x3D, 0x03, 0xF0, 0x01, 0xFE, 0x0F, 0x00, 0xFC, 0x00, 0x2F, 0xFB, 0xD6, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3D, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0x0B, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x03,
-    0xF4, 0x00, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x02,
-    0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-    0x07, 0xFA, 0xBF, 0xE0, 0x00, 0x02, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x06, 0xAA, 0xAA,
-    0xAF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0A, 0xAA, 0xAF, 0xFF, 0xA8, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x2A, 0xFF, 0xFE, 0xAA, 0xA0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xF5, 0x55, 0x55, 0x50, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF9,
-    0x56, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFB, 0xF4, 0x00, 0x7F, 0xD1, 0xE0, 0x10,
-    0x00, 0xFE, 0x02, 0xD0, 0x00, 0x03, 0xF8, 0x03, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x00, 0x0F,
-    0xD0, 0x07, 0xC0, 0x00, 0x1F, 0xC0, 0x0B, 0x80, 0x00, 0x2F, 0x80, 0x0B, 0x40, 0x00, 0x3F, 0x00,
-    0x0F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0x00, 0x00, 0xBE, 0x00, 0x2E,
-    0x00, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0xBE, 0x00, 0x3C, 0x00, 0x00, 0xBE, 0x00, 0x3C, 0x00,
-    0x00, 0x7F, 0x00, 0x78, 0x00, 0x00, 0x3F, 0x00, 0xB8, 0x00, 0x00, 0x3F, 0xC0, 0xF4, 0x00, 0x00,
-    0x1F, 0xE0, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xF5, 0xB8, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xE4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x00, 0x07, 0x40, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x02, 0xF0,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x5F, 0xD5, 0x5F, 0xD5, 0x40, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x01,
-    0xF8, 0x00, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0xBD,
-    0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x41, 0x00, 0x2F, 0x00, 0x0F, 0xFF,
-    0xC0, 0x0F, 0xC0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xAB, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x14, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x0A, 0x42, 0x80, 0xA4, 0x1F, 0xC0, 0x3F, 0xCF, 0xF3, 0xFC, 0x0F, 0xC0, 0x72, 0xF0,
-    0xBD, 0x1D, 0x1F, 0xC0, 0x76, 0xD0, 0x78, 0x1D, 0x2F, 0x80, 0x3F, 0xC0, 0xB0, 0x1D, 0x7F, 0x00,
-    0x1F, 0xD0, 0xF0, 0x2E, 0xFD, 0x00, 0x0B, 0xFF, 0xFA, 0xBF, 0xF4, 0x00, 0x07, 0xAF, 0xFF, 0xFE,
-    0x40, 0x00, 0x0B, 0x01, 0xD5, 0x74, 0x00, 0x00, 0x0F, 0x02, 0xC0, 0x70, 0x00, 0x00, 0x09, 0x02,
-    0x80, 0x60, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xAA, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x56, 0xFF, 0x55, 0x50, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0x5A, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x3F, 0x90, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x06, 0xC0, 0x00, 0x1F, 0x86, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0x90,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xBF, 0x00, 0xBC, 0x00, 0x41, 0xF9, 0xBF, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x02, 0xEB, 0xF0,
-    0x00, 0x0A, 0x80, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x3F, 0x80, 0x0B,
-    0xD0, 0x0B, 0xFC, 0x00, 0x3F, 0xAB, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xE0, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xFE,
-    0xAA, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0x00, 0x00, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xD0, 0x03,
-    0xC1, 0xC0, 0x80, 0x2D, 0x00, 0x7C, 0x7D, 0x3E, 0x02, 0xC0, 0x0B, 0xEF, 0xFF, 0xF4, 0x3C, 0x00,
-    0xBF, 0x8F, 0xD7, 0xEF, 0x40, 0x0B, 0xD0, 0x74, 0x1F, 0xE0, 0x02, 0xF8, 0x00, 0x00, 0x10, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2E, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x47, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xD5, 0x68, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x05, 0xBF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xE0, 0x3F, 0x07, 0xFC, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0xBD, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x7E, 0x0F, 0xD0, 0x02, 0xF4,
-    0x00, 0xBD, 0x0F, 0xC0, 0x01, 0x50, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF4,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xAB, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xFE, 0x00, 0x0B, 0xD0, 0x00, 0x2F,
-    0xC0, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7F,
-    0x00, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xE0,
-    0x00, 0xFC, 0x05, 0xBF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x5F, 0xE5, 0x50, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0A,
-    0xFF, 0xAA, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0x5F, 0xE5, 0x54, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0xF0, 0x00,
-    0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x40,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x03, 0xC5,
-    0x00, 0x07, 0xF8, 0xF0, 0x78, 0x00, 0x00, 0xFD, 0x1E, 0x0B, 0x40, 0x00, 0x3F, 0x81, 0xE0, 0xF0,
-    0x00, 0x07, 0xF0, 0x2D, 0x0F, 0x00, 0x00, 0xBE, 0x03, 0xC0, 0xF0, 0x00, 0x0F, 0xC0, 0x3C, 0x1E,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xAA, 0xBF,
-    0xFE, 0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x0B, 0x47, 0x80,
-    0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x07, 0xE0,
-    0x03, 0xFC, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x2F, 0x40, 0x0B, 0xF0, 0x03, 0xFE, 0xAF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x2F, 0xC0, 0x0B,
-    0xD0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x07,
-    0xE0, 0x1F, 0x40, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x07, 0xF8, 0x03, 0xFA,
-    0xAB, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xC2, 0xD0, 0x00,
-    0x00, 0x3C, 0x3C, 0x00, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x05, 0x55,
-    0x42, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE4, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xBF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_italicBitmaps[47144] = {
+    0x49, 0xE5, 0xAE, 0x5E, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAD, 0xA5, 0xAD, 0x95, 0xE6, 0xE6, 0xDA,
+    0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x6D, 0x95, 0x9D, 0x79, 0x97, 0x77, 0x19, 0xD9, 0x5F, 0x49,
+    0xF5, 0xE9, 0x69, 0x60, 0x1D, 0xA1, 0x9D, 0x90, 0x9D, 0xA1, 0xAD, 0x90, 0xAD, 0x91, 0xE1, 0xAD,
+    0x2E, 0x1E, 0x2D, 0x91, 0xD9, 0x2D, 0x2D, 0x29, 0xD2, 0xD2, 0x9C, 0xA1, 0x9C, 0x92, 0x9C, 0x91,
+    0x70, 0xD9, 0x3A, 0xC9, 0x71, 0x9D, 0x4D, 0x72, 0xAD, 0x39, 0xD7, 0x2D, 0x93, 0xAC, 0xA7, 0x2D,
+    0x4D, 0x97, 0x19, 0xD3, 0x9D, 0x72, 0xDA, 0x3A, 0xD5, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xEA, 0xAA,
+    0xA1, 0xFF, 0xFF, 0xDA, 0x19, 0x99, 0x9E, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x5D, 0x93, 0xDA, 0x72,
+    0xD4, 0xD9, 0x71, 0x9D, 0x39, 0xD7, 0x2D, 0xA3, 0xAC, 0xA7, 0x2D, 0x93, 0xDA, 0x5F, 0xFF, 0xFE,
+    0x1F, 0xFF, 0xFE, 0x5D, 0x93, 0xDA, 0x72, 0xD4, 0xD9, 0x71, 0x9D, 0x39, 0xD7, 0x2D, 0xA3, 0xAC,
+    0xA7, 0x2D, 0x93, 0xD9, 0x71, 0x9D, 0x39, 0xD7, 0x2A, 0xCA, 0x3A, 0xD7, 0x00, 0x72, 0x97, 0x6D,
+    0x97, 0x5D, 0x74, 0x9A, 0xD9, 0x71, 0xAF, 0xFA, 0x49, 0xFF, 0xE4, 0xE9, 0x0D, 0x90, 0x9C, 0xA3,
+    0xAD, 0x91, 0xD7, 0x0E, 0x19, 0xD7, 0x0D, 0xA1, 0xAC, 0xA7, 0x0E, 0x1A, 0xC9, 0x70, 0xAD, 0xA0,
+    0xD7, 0x2F, 0xD7, 0x3F, 0xD9, 0x72, 0x9F, 0xCA, 0x72, 0xFD, 0xA7, 0x1D, 0x1E, 0x71, 0xD1, 0x9D,
+    0x97, 0x9C, 0xA1, 0x9D, 0x97, 0xAC, 0xA1, 0xAD, 0x91, 0x94, 0xD9, 0x09, 0xE2, 0xDA, 0x91, 0xD9,
+    0xAE, 0x92, 0xFF, 0xF9, 0x39, 0xAF, 0xFA, 0x71, 0x9D, 0xA7, 0x5D, 0x76, 0xD7, 0x59, 0xD7, 0x10,
+    0x77, 0x73, 0x9F, 0x97, 0x0A, 0xCA, 0x4A, 0xFD, 0x7A, 0xD4, 0x9D, 0xA1, 0xDA, 0x59, 0xD9, 0x4D,
+    0xA2, 0xAD, 0x5D, 0xA4, 0x9D, 0x3A, 0xD4, 0xAD, 0x5A, 0xCA, 0x3A, 0xD3, 0x9D, 0x6D, 0x93, 0xAC,
+    0xA3, 0xD9, 0x6D, 0x93, 0xDA, 0x2D, 0xA6, 0x9D, 0x4D, 0x91, 0xAD, 0x79, 0xD3, 0x9D, 0x19, 0xD1,
+    0x9A, 0xA9, 0x29, 0xD3, 0xDA, 0x1D, 0x90, 0xFD, 0x2D, 0x91, 0x9D, 0x1D, 0xA0, 0xEA, 0xAD, 0xA1,
+    0xE9, 0xAD, 0xA0, 0xAD, 0x09, 0xD9, 0x1A, 0xD1, 0x9F, 0xCA, 0x09, 0xD1, 0xDA, 0x29, 0xD2, 0x9A,
+    0xCA, 0x91, 0xD9, 0x09, 0xD3, 0x9D, 0x70, 0xDA, 0x1A, 0xD3, 0x9D, 0x7A, 0xD2, 0xDA, 0x3A, 0xD6,
+    0x9D, 0x3D, 0x93, 0xAC, 0xA6, 0xD9, 0x3D, 0x93, 0xD9, 0x5D, 0xA4, 0xD9, 0x29, 0xD5, 0xAD, 0x5D,
+    0x92, 0xDA, 0x49, 0xD6, 0xE1, 0xAD, 0x5D, 0x96, 0x9F, 0xD9, 0x4D, 0xA7, 0x0A, 0xF9, 0x77, 0x39,
+    0x95, 0x77, 0x74, 0xAF, 0xC9, 0x73, 0x9F, 0xF9, 0x71, 0x9E, 0xA0, 0x9A, 0xE7, 0x1E, 0x93, 0xAD,
+    0x97, 0x0E, 0x49, 0xD9, 0x70, 0xDA, 0x49, 0xD9, 0x70, 0xDA, 0x4E, 0x71, 0xE3, 0xAD, 0xA7, 0x1A,
+    0xD1, 0x9E, 0xA7, 0x29, 0xFE, 0x97, 0x4F, 0xCA, 0x75, 0xAF, 0x97, 0x4A, 0xFE, 0x69, 0x92, 0xAE,
+    0x90, 0xAD, 0xA4, 0xE1, 0xAD, 0xA3, 0xE3, 0x9D, 0xA0, 0x9E, 0x49, 0xE2, 0xE1, 0xAD, 0x95, 0xAD,
+    0xA0, 0xAD, 0x91, 0xE7, 0xEA, 0xDA, 0x2E, 0x70, 0xFC, 0x3E, 0x70, 0xF4, 0xAD, 0xA6, 0xFC, 0xA4,
+    0xEA, 0x91, 0x9A, 0xEA, 0xE9, 0x3A, 0xFF, 0xD9, 0x09, 0xE4, 0x9F, 0xEA, 0x3A, 0xE6, 0x99, 0x97,
+    0x40, 0x1D, 0xA0, 0x9D, 0xA0, 0xAD, 0x90, 0xAD, 0x1E, 0x1D, 0x91, 0xD2, 0xD1, 0x9C, 0x91, 0x7A,
+    0xCA, 0x7A, 0xD7, 0xAD, 0x96, 0x9D, 0xA7, 0xE7, 0xAD, 0x96, 0x9D, 0xA7, 0xE7, 0x9D, 0xA7, 0xE7,
+    0x0E, 0x79, 0xD9, 0x7E, 0x70, 0xE7, 0x0D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xAD, 0x70, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0x9D, 0x97, 0x9D, 0x97, 0x0D, 0xA7, 0x0E, 0x70, 0xAD, 0x71,
+    0xD9, 0x70, 0xAC, 0xA7, 0x19, 0x96, 0x6D, 0x71, 0xDA, 0x70, 0xAD, 0x71, 0xD9, 0x70, 0xDA, 0x70,
+    0xE7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x79, 0xDA, 0x7E, 0x70, 0xDA, 0x7A, 0xD7, 0x9D,
+    0xA7, 0xE7, 0xAD, 0x96, 0x9D, 0xA7, 0xDA, 0x7E, 0x70, 0x99, 0x70, 0x79, 0x76, 0xE7, 0x4D, 0xA7,
+    0x39, 0xD6, 0xA9, 0x39, 0xD6, 0xE9, 0x19, 0xCA, 0x59, 0xFC, 0x9A, 0xC7, 0x09, 0xAF, 0xCA, 0xAF,
+    0xA5, 0xFF, 0xCA, 0x4A, 0xEA, 0x19, 0x9A, 0x93, 0xE0, 0xD7, 0x0E, 0x1D, 0x96, 0xE9, 0x1A, 0xD6,
+    0xDA, 0x29, 0xD9, 0x6A, 0x4E, 0x74, 0xAA, 0x93, 0x6D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97,
+    0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x95, 0xAF, 0xFF, 0xEA, 0xFF, 0xFE, 0x99, 0x99, 0x99, 0x9D, 0xA9,
+    0x99, 0x99, 0x96, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0x99,
+    0x60, 0x29, 0xE3, 0xAD, 0xA3, 0xE3, 0x9D, 0xA3, 0xE4, 0xDA, 0x3A, 0xD4, 0xD9, 0x49, 0x94, 0x19,
+    0x99, 0x99, 0x99, 0x1A, 0xFE, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x00, 0x59, 0xD9, 0x0F, 0x9F,
+    0x0E, 0x91, 0x91, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0xAD, 0x97, 0x4E, 0x74,
+    0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x4A, 0xD9, 0x74,
+    0xE7, 0x4E, 0x74, 0x9D, 0xA7, 0x4E, 0x74, 0x9D, 0xA7, 0x4E, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0xAD,
+    0x97, 0x39, 0xE7, 0x40, 0x77, 0x79, 0xFC, 0xA7, 0x0A, 0xFF, 0x6F, 0xA9, 0x9E, 0xA4, 0xAE, 0x4E,
+    0x39, 0xE5, 0xAD, 0x92, 0xE9, 0x59, 0xDA, 0x19, 0xE7, 0xE1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x09,
+    0xE7, 0x9D, 0xA0, 0x9D, 0xA7, 0x9D, 0xA0, 0xAD, 0x97, 0x9D, 0xA0, 0xE7, 0x0A, 0xD9, 0x0E, 0x70,
+    0xE1, 0xE7, 0x0E, 0x1E, 0x79, 0xDA, 0x1E, 0x7A, 0xD9, 0x1E, 0x7E, 0x2E, 0x6A, 0xDA, 0x2E, 0x95,
+    0xE3, 0x9D, 0xA4, 0xEA, 0x4E, 0xA9, 0x09, 0xF5, 0x9F, 0xFA, 0x79, 0xFD, 0x97, 0x39, 0x97, 0x00,
+    0x69, 0xDA, 0x5A, 0xEA, 0x39, 0xFC, 0x92, 0xFE, 0x1A, 0xF9, 0xE1, 0xEA, 0x09, 0xDA, 0x19, 0xC9,
+    0x19, 0xD9, 0x6A, 0xD7, 0xE7, 0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE7, 0xDA, 0x69, 0xDA, 0x6A,
+    0xD9, 0x6E, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6A, 0xD7, 0xE7, 0xE4, 0x77, 0x70, 0x9A, 0xFC, 0xA7,
+    0x9F, 0xFD, 0x59, 0xFA, 0x99, 0xAF, 0x5A, 0xC9, 0x49, 0xE9, 0x75, 0xAD, 0xA7, 0x59, 0xDA, 0x75,
+    0xAD, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x5A, 0xD9, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0xAE,
+    0x74, 0xAE, 0x74, 0xAE, 0x74, 0xF7, 0x4E, 0xA7, 0x4E, 0xA7, 0x4E, 0x97, 0x39, 0xE9, 0x73, 0x9F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xFF, 0xFD, 0x2F, 0xFF, 0xE2, 0x77, 0x70, 0x9F, 0xDA, 0x7A,
+    0xFF, 0xD5, 0x9F, 0xA9, 0x9A, 0xF5, 0xAC, 0x95, 0xE9, 0x75, 0xAD, 0x97, 0x5A, 0xD9, 0x75, 0xAD,
+    0x97, 0x5E, 0x75, 0xAD, 0xA7, 0x4A, 0xDA, 0x79, 0xAA, 0xAF, 0xA7, 0x0F, 0xD9, 0x71, 0x9F, 0xE9,
+    0x75, 0xAE, 0x97, 0x59, 0xE7, 0x6A, 0xD9, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0xAD, 0xA7, 0x5E,
+    0x39, 0x70, 0xAE, 0x29, 0xDA, 0x99, 0x19, 0xAF, 0x39, 0xFF, 0xF5, 0x9A, 0xFF, 0x97, 0x29, 0x99,
+    0x71, 0x75, 0xE9, 0x74, 0xF7, 0x4F, 0xC7, 0x3A, 0xFC, 0x72, 0xAD, 0x9D, 0xA7, 0x19, 0xDA, 0x0D,
+    0x97, 0x09, 0xE0, 0xAD, 0x71, 0xE1, 0xE7, 0x0E, 0x2E, 0x7E, 0x91, 0x9D, 0xA6, 0xAD, 0x92, 0xAD,
+    0x95, 0xAD, 0xA3, 0xAD, 0x59, 0xDA, 0x4E, 0x5E, 0x5D, 0xA4, 0xE5, 0x9D, 0xA3, 0xE6, 0xAD, 0x92,
+    0x9F, 0xFF, 0xFC, 0xAF, 0xFF, 0xFA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xA7, 0x29, 0xD9,
+    0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA4, 0x5F, 0xFD, 0xA4, 0x9F, 0xFD, 0xA4, 0xFF, 0xE9,
+    0x4D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD7, 0x5E, 0x99, 0xAA, 0x97,
+    0x0F, 0xFC, 0xA6, 0xFF, 0xE7, 0x4A, 0xE9, 0x74, 0xAE, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x74,
+    0x9E, 0x74, 0xE9, 0x19, 0x70, 0xAE, 0x2D, 0xA9, 0x29, 0xAF, 0x3F, 0xFF, 0x5A, 0xFF, 0x97, 0x19,
+    0x99, 0x71, 0x77, 0x70, 0x9A, 0xFD, 0x7F, 0xFC, 0x59, 0xFA, 0x99, 0x9A, 0x94, 0x9E, 0xA7, 0x3E,
+    0x97, 0x3E, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x90, 0x9A, 0xEA, 0x5E, 0x0F,
+    0xF4, 0xFD, 0x99, 0xAF, 0x29, 0xF9, 0x4E, 0x91, 0xAE, 0x6A, 0xDA, 0x1E, 0xA6, 0x9D, 0xA1, 0xE7,
+    0x0D, 0xA1, 0xE7, 0x9D, 0xA1, 0xE7, 0xAD, 0x91, 0xE7, 0xE2, 0xAD, 0x95, 0x9D, 0xA2, 0x9E, 0x5E,
+    0x4F, 0x91, 0xAE, 0xA5, 0xFF, 0xCA, 0x7A, 0xFD, 0x97, 0x29, 0x99, 0x70, 0x1F, 0xFF, 0xDA, 0x1F,
+    0xFF, 0xD9, 0x09, 0xFF, 0xFD, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9,
+    0x74, 0xE7, 0x4E, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x4A, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9E,
+    0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x4E, 0x97, 0x39, 0xDA, 0x74, 0xE7,
+    0x40, 0x77, 0x70, 0x9F, 0xD9, 0x70, 0xFF, 0xCA, 0x6F, 0x99, 0x9A, 0xE9, 0x49, 0xE4, 0x9E, 0x4E,
+    0x6E, 0x4E, 0x6E, 0x4E, 0x6E, 0x4E, 0x59, 0xDA, 0x4A, 0xDA, 0x39, 0xE6, 0xE9, 0x1A, 0xE7, 0x0F,
+    0xEA, 0x71, 0xAF, 0xC7, 0x1A, 0xFE, 0xA6, 0x9E, 0xA2, 0xF5, 0xE9, 0x4E, 0xA3, 0xE9, 0x6E, 0x3E,
+    0x7E, 0x29, 0xDA, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x7E, 0x3E, 0x95, 0xEA, 0x3A, 0xEA,
+    0x29, 0xF5, 0xFF, 0xE7, 0xAF, 0xEA, 0x73, 0x99, 0x97, 0x00, 0x77, 0x69, 0xAF, 0xC9, 0x7A, 0xFF,
+    0xA5, 0xFA, 0x99, 0xAE, 0x93, 0xAE, 0x49, 0xE3, 0xE6, 0xE2, 0xAD, 0x96, 0xAD, 0x91, 0xE7, 0xAD,
+    0x91, 0xE7, 0xAD, 0x91, 0xE7, 0xAD, 0x91, 0xE7, 0xE9, 0x1E, 0x69, 0xE2, 0xAD, 0xA4, 0x9F, 0x29,
+    0xEA, 0x90, 0x9A, 0xFC, 0x3A, 0xFF, 0x9D, 0xA4, 0x9F, 0xC9, 0x0A, 0xD9, 0x74, 0xE7, 0x49, 0xDA,
+    0x74, 0xE7, 0x49, 0xE7, 0x4E, 0x73, 0x9E, 0xA3, 0x9A, 0x99, 0x09, 0x9F, 0xA4, 0x9F, 0xFC, 0x95,
+    0x9F, 0xEA, 0x72, 0x99, 0x97, 0x20, 0x49, 0x5E, 0x92, 0xAE, 0x92, 0xAE, 0x92, 0x9D, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x71, 0x9D, 0x93, 0xF2, 0x9F, 0x3E, 0x94, 0x94, 0x69, 0x7E, 0x94, 0xAE, 0x94,
+    0xAE, 0x94, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9E, 0x5E, 0xA5, 0xE5, 0xAD, 0x95,
+    0xE5, 0x9D, 0x95, 0xDA, 0x59, 0xD7, 0x97, 0x77, 0x76, 0xAC, 0x74, 0xAE, 0x72, 0xAF, 0xA7, 0x0A,
+    0xFA, 0x70, 0xAF, 0x97, 0x0A, 0xF9, 0x70, 0xAF, 0x97, 0x09, 0xF9, 0x72, 0xAE, 0x97, 0x39, 0xFC,
+    0x97, 0x4A, 0xFA, 0x74, 0xAF, 0xC9, 0x73, 0x9F, 0xCA, 0x73, 0x9A, 0xFA, 0x74, 0xAE, 0x76, 0x9C,
+    0x77, 0x10, 0x77, 0x9F, 0xFF, 0xE9, 0xFF, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xE9, 0xFF, 0xFD, 0xA0, 0x77, 0x0A, 0xA7, 0x6A, 0xDA, 0x74,
+    0x9F, 0xA7, 0x49, 0xFA, 0x74, 0x9F, 0xA7, 0x49, 0xAE, 0xA7, 0x5A, 0xEA, 0x75, 0xAE, 0xA7, 0x4A,
+    0xE7, 0x19, 0xAF, 0x97, 0x9F, 0xC9, 0x7A, 0xFA, 0x79, 0xFC, 0xA7, 0x9F, 0xC9, 0x71, 0xAD, 0xA9,
+    0x73, 0xAA, 0x77, 0x77, 0x77, 0x09, 0xFD, 0x93, 0xAF, 0xFD, 0x29, 0xEA, 0x99, 0xAE, 0xA2, 0xA5,
+    0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xE7, 0x1E, 0xA7, 0x9E, 0xA7, 0xAE, 0xA7,
+    0xAE, 0x97, 0x9E, 0x71, 0xE7, 0x19, 0xD7, 0x2A, 0xD7, 0x39, 0x77, 0x77, 0x69, 0xD9, 0x71, 0xEA,
+    0x70, 0x9E, 0xA7, 0x09, 0xE7, 0x29, 0x97, 0x20, 0x73, 0x9A, 0xAA, 0xCA, 0xA9, 0x77, 0x9A, 0xFF,
+    0xDA, 0x74, 0xFC, 0xAA, 0x99, 0xAA, 0xF9, 0x70, 0x9E, 0xA7, 0x09, 0xE9, 0x6A, 0xDA, 0x74, 0xE5,
+    0xAD, 0xA7, 0x59, 0xD9, 0x39, 0xDA, 0x79, 0x6E, 0x3D, 0xA4, 0x9F, 0xE9, 0x29, 0xD2, 0xAD, 0x4A,
+    0xFF, 0xC3, 0xD9, 0x1D, 0xA3, 0xAD, 0xA3, 0xD9, 0x3D, 0x90, 0x9D, 0x3A, 0xD9, 0x39, 0xD4, 0xD9,
+    0x0A, 0xD3, 0xDA, 0x4A, 0xD4, 0xD9, 0x0D, 0xA2, 0x9D, 0x5D, 0xA4, 0xD1, 0xD9, 0x2E, 0x5D, 0x93,
+    0x9D, 0x1D, 0x92, 0xDA, 0x49, 0xD4, 0xAD, 0x1D, 0x92, 0xDA, 0x4E, 0x4D, 0x91, 0xD9, 0x2D, 0xA3,
+    0x9E, 0x3A, 0xD2, 0xD9, 0x2E, 0x29, 0xF2, 0x9D, 0x92, 0xDA, 0x29, 0xEA, 0xE0, 0xEA, 0xEA, 0x3E,
+    0x3A, 0xFC, 0x19, 0xFC, 0x94, 0x9D, 0x94, 0x99, 0x59, 0x99, 0x7E, 0x77, 0x79, 0xDA, 0x77, 0x7A,
+    0xE7, 0x29, 0x73, 0xAF, 0x99, 0x19, 0x9A, 0xE7, 0x49, 0xFF, 0xFC, 0x76, 0x9A, 0xFD, 0xA9, 0x77,
+    0x77, 0x40, 0x74, 0xE7, 0x7A, 0xE9, 0x76, 0xF9, 0x75, 0xFC, 0xA7, 0x49, 0xD9, 0xDA, 0x74, 0xE0,
+    0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xE1, 0xAD, 0x72, 0x9D, 0xA1, 0xAD, 0x72, 0xE2, 0xAD, 0x97, 0x0A,
+    0xD9, 0x29, 0xD9, 0x70, 0xE3, 0x9D, 0xA7, 0xAD, 0x94, 0xDA, 0x7E, 0x5E, 0x6A, 0xFF, 0xF5, 0x9F,
+    0xFF, 0xC5, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x49, 0xE7, 0xAD, 0x93, 0xE7, 0x0A, 0xD9, 0x29, 0xDA,
+    0x70, 0x9D, 0xA2, 0xE7, 0x19, 0xDA, 0x1A, 0xDA, 0x72, 0xE1, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xE0,
+    0x4A, 0xFE, 0xA9, 0x70, 0xFF, 0xEA, 0x6F, 0xFF, 0xA4, 0x9D, 0xA5, 0xAE, 0x4A, 0xD9, 0x6E, 0xA3,
+    0xAD, 0x96, 0xAD, 0xA3, 0xE7, 0xAD, 0xA3, 0xE7, 0xAD, 0x92, 0x9D, 0xA6, 0x9E, 0x3A, 0xD9, 0x59,
+    0xE9, 0x3F, 0xAA, 0xAA, 0xFC, 0x5F, 0xFD, 0xA9, 0x6F, 0xFE, 0xA5, 0x9D, 0xA5, 0xAE, 0x4A, 0xD9,
+    0x6A, 0xDA, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x29, 0xDA, 0x70, 0xE2, 0x9D, 0x97, 0x9E, 0x2A, 0xD9,
+    0x7E, 0xA2, 0xE7, 0xF3, 0xEA, 0xAA, 0xAA, 0xAF, 0xC3, 0x9F, 0xFF, 0xC4, 0xAF, 0xFD, 0xA6, 0x77,
+    0x74, 0xAF, 0xE9, 0x70, 0xAF, 0xFE, 0x59, 0xFC, 0xAA, 0xAA, 0xE9, 0x49, 0xF9, 0x69, 0x5E, 0xA7,
+    0x6E, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7,
+    0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xF7,
+    0x79, 0xEA, 0x77, 0xAF, 0xA9, 0x99, 0x9A, 0xCA, 0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x49,
+    0x99, 0x70, 0x4A, 0xFD, 0xAA, 0x97, 0x2F, 0xFE, 0x97, 0x0F, 0xFF, 0xA6, 0x9D, 0xA4, 0x9F, 0xA5,
+    0xAD, 0x96, 0xAE, 0x5A, 0xD9, 0x7E, 0xA4, 0xE7, 0x09, 0xE4, 0xE7, 0x1E, 0x39, 0xDA, 0x71, 0xE3,
+    0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D, 0xA7, 0x19, 0xE2, 0xAD,
+    0x97, 0x1A, 0xDA, 0x2E, 0x72, 0xE3, 0xE7, 0x1A, 0xE2, 0x9D, 0xA7, 0x09, 0xE9, 0x29, 0xD9, 0x70,
+    0xEA, 0x3A, 0xD9, 0x69, 0xF4, 0xE5, 0x9A, 0xF5, 0xEA, 0xAA, 0xAA, 0xFC, 0xA5, 0x9F, 0xFF, 0x96,
+    0xAF, 0xFA, 0x97, 0x10, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97,
+    0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F,
+    0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0x9D,
+    0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xEA,
+    0x40, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E,
+    0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE,
+    0x94, 0x9F, 0xFE, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0xAD, 0x97,
+    0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x50, 0x77, 0x75, 0xAF, 0xEA, 0x97, 0x0A, 0xFF,
+    0xF5, 0x9F, 0xCA, 0xAA, 0xAA, 0xEA, 0x49, 0xF9, 0x69, 0xA5, 0xF7, 0x7F, 0x77, 0x9E, 0x77, 0x0E,
+    0x97, 0x79, 0xE7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71, 0xE6, 0x9A, 0xAA, 0xAA, 0xA9, 0x19, 0xE6,
+    0xFE, 0xA1, 0xAD, 0xA6, 0xFE, 0x91, 0xAD, 0xA7, 0x2E, 0x2A, 0xDA, 0x72, 0xE2, 0xAD, 0xA7, 0x2E,
+    0x29, 0xE7, 0x19, 0xDA, 0x3E, 0x71, 0xAD, 0x93, 0xF7, 0x0E, 0x49, 0xEA, 0x7E, 0x5A, 0xFA, 0x99,
+    0x99, 0xAE, 0xA6, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x10, 0x4A, 0xD9, 0x71,
+    0xDA, 0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0x9D, 0x97, 0x1E, 0x4A,
+    0xD9, 0x70, 0x9D, 0xA4, 0xE7, 0x19, 0xD9, 0x4E, 0x71, 0xAD, 0x93, 0x9D, 0xA7, 0x1E, 0x4A, 0xD9,
+    0x71, 0xE4, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA4, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x49, 0xDA,
+    0x71, 0xE4, 0xAD, 0x97, 0x1E, 0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x4D, 0xA7, 0x1E, 0x49,
+    0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1D, 0xA4, 0xE7, 0x19, 0xDA, 0x4E, 0x71, 0xAD, 0x93, 0x9D, 0xA7,
+    0x1E, 0x49, 0xD9, 0x71, 0xE4, 0x4A, 0xFE, 0x94, 0xFF, 0x96, 0xAD, 0xA9, 0x70, 0xAD, 0x97, 0x1E,
+    0x72, 0xE7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD,
+    0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71,
+    0xAD, 0xA6, 0x9F, 0xEA, 0x4A, 0xFF, 0x40, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73,
+    0x9D, 0x97, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x74,
+    0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x4D, 0xA7, 0x39, 0xDA, 0x73, 0xAD, 0x97,
+    0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x97, 0x3E, 0x73, 0xEA, 0x6A, 0x99, 0x9F,
+    0x7F, 0xE9, 0x7F, 0xCA, 0x72, 0x99, 0x73, 0x4A, 0xD7, 0x0E, 0x5E, 0x7E, 0x95, 0xE6, 0xE9, 0x59,
+    0xDA, 0x5E, 0x96, 0xAD, 0x94, 0xE9, 0x7A, 0xD4, 0xE9, 0x70, 0xE3, 0xE9, 0x71, 0xE2, 0xE9, 0x71,
+    0x9D, 0xA1, 0xEA, 0x72, 0xAD, 0x90, 0xEA, 0x73, 0xE9, 0xEA, 0x74, 0xFE, 0xA7, 0x4F, 0xF7, 0x39,
+    0xEA, 0x09, 0xDA, 0x72, 0xAD, 0x92, 0xE7, 0x2E, 0x3A, 0xD9, 0x71, 0xE3, 0x9E, 0x70, 0x9D, 0xA4,
+    0xE9, 0x79, 0xD9, 0x49, 0xDA, 0x7A, 0xD9, 0x5E, 0x7E, 0x6A, 0xDA, 0x6E, 0x69, 0xE5, 0x9D, 0xA7,
+    0xE9, 0x4A, 0xD9, 0x79, 0xE4, 0x4A, 0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0A,
+    0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xDA,
+    0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x1E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFA, 0xFF, 0xEA, 0x4A, 0xE9, 0x73, 0xAF, 0x5F, 0xA7, 0x3F,
+    0xC5, 0xFC, 0x72, 0xAF, 0xA4, 0x9F, 0xC7, 0x2F, 0xC9, 0x4A, 0xDA, 0xD7, 0x1E, 0xAD, 0x5E, 0x9D,
+    0x70, 0x9D, 0x9E, 0x5D, 0xA0, 0xD9, 0x7E, 0x0E, 0x5D, 0xA0, 0xD9, 0x69, 0xD9, 0x9D, 0xA4, 0x9D,
+    0x90, 0xDA, 0x6E, 0x09, 0xD9, 0x4A, 0xD1, 0xDA, 0x59, 0xD1, 0xAD, 0x5E, 0x1E, 0x5D, 0xA1, 0xE5,
+    0xE1, 0xAD, 0x4A, 0xD2, 0xE5, 0xDA, 0x1A, 0xD4, 0xDA, 0x19, 0xDA, 0x49, 0xD9, 0x19, 0xD3, 0xAD,
+    0x2A, 0xD9, 0x4A, 0xD2, 0x9D, 0x92, 0xD9, 0x2E, 0x5E, 0x3D, 0x91, 0xE3, 0xE5, 0xDA, 0x3D, 0x90,
+    0x9D, 0x93, 0xE4, 0x9D, 0xA3, 0xDA, 0x0E, 0x39, 0xDA, 0x4A, 0xD9, 0x3D, 0xA9, 0xD9, 0x3A, 0xD9,
+    0x4A, 0xD4, 0xAF, 0xA4, 0xE5, 0xE4, 0xAF, 0x5E, 0x5D, 0xA4, 0x9E, 0xA4, 0x9D, 0xA4, 0x9D, 0x94,
+    0x9E, 0x59, 0xDA, 0x4A, 0xD6, 0xDA, 0x5A, 0xD9, 0x40, 0x4A, 0xDA, 0x72, 0xDA, 0x4F, 0x71, 0x9D,
+    0x94, 0xF9, 0x70, 0xAD, 0x93, 0x9F, 0xC7, 0x0E, 0x4A, 0xFC, 0x70, 0xE4, 0xE9, 0xDA, 0x7D, 0xA4,
+    0xDA, 0x0E, 0x69, 0xD9, 0x4D, 0xA0, 0xAD, 0x6A, 0xD4, 0x9D, 0x90, 0x9D, 0xA5, 0xE4, 0xAD, 0x2E,
+    0x5E, 0x4E, 0x2A, 0xD9, 0x39, 0xDA, 0x4E, 0x3D, 0xA3, 0xAD, 0x94, 0xDA, 0x3E, 0x3A, 0xD4, 0x9D,
+    0x93, 0x9D, 0x92, 0xE4, 0xAD, 0x5E, 0x2D, 0xA4, 0xE5, 0xAD, 0x19, 0xDA, 0x4D, 0xA5, 0x9D, 0xA0,
+    0xAD, 0x93, 0x9D, 0xA6, 0xE0, 0xAD, 0x4A, 0xD9, 0x6A, 0xD9, 0xE4, 0xAD, 0x70, 0xDA, 0xDA, 0x4E,
+    0x70, 0xFC, 0x94, 0xDA, 0x70, 0x9F, 0x49, 0xD9, 0x71, 0xF4, 0xAD, 0x72, 0xAE, 0x40, 0x77, 0x74,
+    0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E,
+    0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74,
+    0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD,
+    0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E,
+    0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9,
+    0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x4A, 0xFD, 0xAA, 0x70, 0xFF, 0xDA, 0x6F, 0xFE, 0xA4,
+    0x9D, 0xA4, 0xAE, 0x93, 0xAD, 0x95, 0xAD, 0xA3, 0xAD, 0x96, 0xE3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D,
+    0xA6, 0x9D, 0xA2, 0xAD, 0x96, 0xE9, 0x2E, 0x6A, 0xE3, 0xE4, 0x9F, 0x93, 0xFF, 0xF9, 0x39, 0xFF,
+    0xDA, 0x5A, 0xEA, 0xAA, 0xA9, 0x97, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97,
+    0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x50, 0x77, 0x74, 0x9F, 0xDA, 0x97, 0x19, 0xFF,
+    0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E,
+    0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7,
+    0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD,
+    0xA7, 0x4E, 0x0A, 0xDA, 0x73, 0xAD, 0xA0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3,
+    0x9E, 0xA6, 0xAE, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0x96, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69,
+    0x9E, 0x97, 0x70, 0x9E, 0x77, 0x1F, 0x77, 0x1E, 0xA7, 0x70, 0x9E, 0x97, 0x70, 0xAA, 0xAA, 0x30,
+    0x4A, 0xFD, 0xA9, 0x70, 0xFF, 0xDA, 0x6F, 0xFF, 0x49, 0xDA, 0x49, 0xE9, 0x3A, 0xD9, 0x5A, 0xE3,
+    0xAD, 0x96, 0xE3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0xAD, 0x96, 0xE9, 0x2E, 0x6E,
+    0xA3, 0xE9, 0x99, 0x9A, 0xFC, 0x4F, 0xFE, 0xA4, 0x9F, 0xFC, 0x96, 0xAD, 0x92, 0xAD, 0x96, 0xE4,
+    0xE6, 0xE4, 0xE5, 0x9D, 0xA4, 0xAD, 0xA4, 0x9D, 0x95, 0xE4, 0xAD, 0x95, 0xE9, 0x3E, 0x6A, 0xDA,
+    0x3E, 0x7E, 0x29, 0xDA, 0x7E, 0x91, 0xAD, 0x97, 0x9E, 0x10, 0x77, 0x70, 0x9A, 0xFD, 0x97, 0xFF,
+    0xE5, 0xFC, 0xAA, 0xAE, 0xA4, 0xAE, 0x69, 0x94, 0xE7, 0x59, 0xE7, 0x59, 0xDA, 0x75, 0x9E, 0x75,
+    0x9E, 0x76, 0xF9, 0x75, 0xFA, 0x75, 0xFC, 0x97, 0x4A, 0xFA, 0x74, 0x9F, 0xA7, 0x5A, 0xE9, 0x75,
+    0xEA, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0xEA, 0x39, 0x7A, 0xE3, 0x9D, 0xA9, 0x99, 0x9A,
+    0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0xA7, 0x29, 0x99, 0x97, 0x10, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF,
+    0xE9, 0xFF, 0xFF, 0x6A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E,
+    0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A,
+    0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x73, 0x3E, 0x72, 0xDA,
+    0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7,
+    0x2E, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E,
+    0x3E, 0x72, 0xDA, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E,
+    0x72, 0xE3, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70,
+    0x9E, 0x4E, 0x70, 0xE9, 0x4E, 0xA6, 0xF5, 0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF,
+    0x97, 0x69, 0x97, 0x30, 0xAD, 0x73, 0xE0, 0xE7, 0x2A, 0xE0, 0xAD, 0x72, 0xE1, 0xAD, 0x97, 0x0A,
+    0xDA, 0x19, 0xD9, 0x70, 0xE2, 0x9D, 0xA7, 0xAD, 0xA2, 0x9D, 0xA7, 0xE4, 0xDA, 0x6A, 0xDA, 0x4E,
+    0x6E, 0x5E, 0x5A, 0xDA, 0x5E, 0x5E, 0x6A, 0xD4, 0xAD, 0x96, 0xAD, 0x4E, 0x7A, 0xD9, 0x2A, 0xD9,
+    0x79, 0xD9, 0x2E, 0x70, 0x9D, 0xA1, 0xAD, 0x97, 0x1D, 0xA1, 0xE7, 0x2D, 0xA0, 0xAD, 0x97, 0x2E,
+    0x0D, 0xA7, 0x3E, 0xAD, 0x74, 0xFC, 0xA7, 0x4A, 0xF7, 0x5A, 0xEA, 0x75, 0x9E, 0x74, 0x9D, 0x97,
+    0x0E, 0x70, 0xAD, 0x09, 0xDA, 0x7A, 0xE7, 0x9E, 0x09, 0xDA, 0x7F, 0x7A, 0xD9, 0x09, 0xDA, 0x6A,
+    0xF7, 0xE1, 0x9D, 0xA6, 0xDA, 0xD6, 0xAD, 0x92, 0xDA, 0x5A, 0xD9, 0xD9, 0x5E, 0x3D, 0xA5, 0xDA,
+    0x0D, 0x94, 0x9D, 0xA3, 0xDA, 0x49, 0xD1, 0xD9, 0x4E, 0x4E, 0x4E, 0x1D, 0x93, 0x9D, 0xA4, 0xE3,
+    0x9D, 0x91, 0xD9, 0x3E, 0x5E, 0x3E, 0x2D, 0x93, 0xE5, 0xE2, 0x9D, 0x92, 0xDA, 0x2A, 0xD9, 0x5E,
+    0x2E, 0x3D, 0xA2, 0xE6, 0xE2, 0xD9, 0x3D, 0xA1, 0x9D, 0x96, 0xE1, 0xAD, 0x4D, 0xA1, 0xE7, 0xE1,
+    0xDA, 0x4D, 0xA0, 0x9D, 0x97, 0xE0, 0xAD, 0x5E, 0x0A, 0xD7, 0x0A, 0xD0, 0xDA, 0x5A, 0xD0, 0xDA,
+    0x70, 0xAD, 0x9D, 0x6A, 0xD9, 0xD7, 0x1A, 0xFA, 0x6A, 0xFA, 0x71, 0xAF, 0x7A, 0xF7, 0x2A, 0xF7,
+    0xAF, 0x72, 0xAE, 0x97, 0x9E, 0x97, 0x29, 0xE7, 0x09, 0xE7, 0x20, 0x5D, 0xA7, 0x1D, 0xA6, 0xE7,
+    0x0E, 0x96, 0x9D, 0xA6, 0xAD, 0x97, 0x0E, 0x5A, 0xDA, 0x71, 0xAD, 0x93, 0x9E, 0x72, 0x9D, 0xA3,
+    0xE7, 0x4E, 0x2E, 0x97, 0x4A, 0xD9, 0x0A, 0xD9, 0x76, 0xDA, 0x9D, 0xA7, 0x7F, 0xD7, 0x70, 0x9F,
+    0x77, 0x2E, 0x97, 0x71, 0xFA, 0x77, 0x0A, 0xFC, 0x77, 0x9D, 0xA9, 0xD9, 0x76, 0xE1, 0xDA, 0x75,
+    0xE2, 0xE7, 0x4A, 0xD9, 0x29, 0xD9, 0x72, 0x9D, 0xA4, 0xE7, 0x19, 0xE5, 0xE7, 0x1E, 0x69, 0xDA,
+    0x7E, 0x97, 0xE6, 0xAD, 0xA7, 0x0E, 0x94, 0x9E, 0x71, 0x9D, 0xA4, 0xAD, 0x71, 0x9D, 0xA0, 0xAD,
+    0x97, 0x0E, 0x19, 0xDA, 0x7E, 0x92, 0xE6, 0x9E, 0x3E, 0x6E, 0x4A, 0xD9, 0x4E, 0x94, 0x9D, 0xA3,
+    0x9D, 0xA6, 0xE3, 0xE7, 0xE2, 0xE9, 0x7A, 0xD1, 0x9D, 0xA7, 0x09, 0xD9, 0x0E, 0x72, 0xDA, 0xAD,
+    0x97, 0x2A, 0xFA, 0x73, 0x9F, 0x75, 0xE9, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76,
+    0xE7, 0x6D, 0xA7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x74, 0x5F, 0xFF, 0xD6, 0xFF, 0xFD, 0x59,
+    0xFF, 0xFC, 0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAD, 0xA7, 0x79, 0xE7,
+    0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x7E,
+    0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xE9, 0x77, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA5, 0xFF, 0xFE, 0x5F, 0xFF, 0xDA, 0x40, 0x6F, 0xD6, 0x9F, 0xD6, 0xAD, 0xAA, 0xAA, 0x6E, 0x72,
+    0xDA, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7,
+    0x2A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x2D, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2F, 0xDA,
+    0x6F, 0xD9, 0x69, 0x99, 0x99, 0x96, 0x9D, 0x93, 0xD9, 0x3D, 0xA3, 0xE3, 0xE3, 0xAD, 0x39, 0xD3,
+    0x9D, 0x93, 0xD9, 0x3D, 0xA3, 0xE3, 0xAD, 0x3A, 0xD3, 0x9D, 0x39, 0xD9, 0x3D, 0xA3, 0xDA, 0x3E,
+    0x3A, 0xD3, 0xAD, 0x39, 0xD9, 0x3D, 0x93, 0xDA, 0x3D, 0xA0, 0x59, 0xFD, 0x6A, 0xFD, 0x69, 0xAA,
+    0xAD, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A,
+    0xD7, 0x2E, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xDA,
+    0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x71, 0x9D, 0xA6, 0xFD, 0x95, 0x9F, 0xD7, 0x99, 0x99, 0x99, 0x60, 0x6D, 0x75, 0x9E, 0x74, 0xF9,
+    0x72, 0x9D, 0xAD, 0x72, 0xDA, 0x0D, 0x97, 0x1D, 0x1A, 0xD7, 0x0A, 0xCA, 0x2D, 0x97, 0xD9, 0x2A,
+    0xD6, 0xAD, 0x4D, 0x95, 0xD9, 0x4A, 0xD4, 0xAD, 0x6D, 0x93, 0xD9, 0x6A, 0xD2, 0xAD, 0x70, 0xD9,
+    0x1D, 0xA7, 0x0A, 0xD0, 0x9D, 0x72, 0xD9, 0x77, 0x00, 0x0A, 0xFF, 0xFA, 0x0F, 0xFF, 0xC9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x0A, 0xAA, 0x3E, 0x93, 0xE3, 0x9D, 0x93, 0xAD, 0x4A,
+    0xC0, 0x77, 0x7A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A,
+    0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9,
+    0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A,
+    0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30,
+    0x69, 0x97, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59,
+    0xDA, 0x1A, 0xF9, 0x5A, 0xD9, 0x9F, 0xE9, 0x4E, 0x9D, 0xA9, 0x9F, 0x4F, 0xC4, 0xE9, 0x3F, 0x59,
+    0xDA, 0x29, 0xE9, 0x59, 0xDA, 0x2A, 0xE6, 0x9D, 0xA2, 0xE9, 0x69, 0xDA, 0x2E, 0x7A, 0xD9, 0x19,
+    0xDA, 0x7E, 0x91, 0x9D, 0x97, 0xE2, 0xAD, 0x96, 0x9E, 0x2E, 0x96, 0xE9, 0x2E, 0x95, 0x9E, 0x29,
+    0xF4, 0x9E, 0x92, 0xAD, 0xAD, 0x91, 0xAE, 0xA3, 0xAC, 0xA0, 0xFF, 0xA4, 0xD9, 0x1A, 0xFC, 0x97,
+    0x49, 0x97, 0x77, 0x49, 0xFD, 0xA5, 0xFF, 0xC4, 0xFA, 0x99, 0x9A, 0xA3, 0xEA, 0x71, 0xAE, 0x72,
+    0xE7, 0x2A, 0xDA, 0x72, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7,
+    0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2, 0x9A, 0xC4, 0xAF, 0xFC, 0x59, 0xFE, 0x97, 0x09, 0x99, 0x50,
+    0x77, 0x99, 0x97, 0x7D, 0xA7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x7D, 0xA7, 0x69,
+    0xD9, 0x6A, 0xFA, 0x1A, 0xD6, 0xFF, 0x0E, 0x5F, 0x99, 0x9D, 0xAE, 0x4E, 0xA4, 0xFA, 0x3A, 0xE5,
+    0x9E, 0x93, 0xE7, 0xE3, 0x9D, 0xA7, 0xE3, 0xE9, 0x7E, 0x3E, 0x79, 0xDA, 0x3E, 0x7A, 0xD9, 0x29,
+    0xDA, 0x7E, 0x39, 0xDA, 0x69, 0xE3, 0x9D, 0xA6, 0xEA, 0x39, 0xDA, 0x5A, 0xE9, 0x4E, 0x4A, 0xF9,
+    0x4F, 0x19, 0xDA, 0xAD, 0x59, 0xFE, 0xA0, 0xAD, 0x69, 0xFC, 0x91, 0xDA, 0x71, 0x97, 0x40, 0x77,
+    0x4A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1,
+    0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D,
+    0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF,
+    0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x60, 0x75, 0x99, 0x99, 0x74, 0xFD, 0xA7, 0x2F, 0xE9, 0x71,
+    0x9E, 0x76, 0xE7, 0x7E, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x59, 0xAF, 0xDA, 0x70, 0xFF, 0xCA, 0x70,
+    0x99, 0xAE, 0x99, 0x97, 0x3A, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9,
+    0x76, 0xE7, 0x7E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xDA, 0x76,
+    0x9D, 0x97, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6E, 0x73, 0xAA, 0x9E, 0xA7, 0x3A,
+    0xFC, 0x74, 0xAE, 0xA7, 0x50, 0x77, 0x71, 0xAF, 0xA2, 0xD5, 0x9F, 0xF0, 0x9D, 0x5F, 0x99, 0x9A,
+    0xCA, 0xE4, 0xEA, 0x4F, 0xA3, 0xAE, 0x59, 0xE9, 0x3E, 0x7E, 0x39, 0xDA, 0x7E, 0x3E, 0x96, 0x9E,
+    0x3E, 0x79, 0xDA, 0x3E, 0x7A, 0xD9, 0x29, 0xDA, 0x7E, 0x39, 0xDA, 0x69, 0xE3, 0x9D, 0xA6, 0xEA,
+    0x39, 0xDA, 0x5A, 0xE9, 0x4E, 0x4A, 0xF9, 0x4F, 0x90, 0x9D, 0xAA, 0xD5, 0x9F, 0xEA, 0x0E, 0x69,
+    0xFC, 0x91, 0xDA, 0x71, 0x93, 0x9D, 0x97, 0x6A, 0xD7, 0x7E, 0x76, 0xAD, 0xA5, 0xA6, 0x9E, 0x6E,
+    0xA9, 0x9A, 0xF9, 0x6F, 0xFD, 0x97, 0x0A, 0xAF, 0xA9, 0x70, 0x69, 0x97, 0x6E, 0x76, 0xE7, 0x59,
+    0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0xA1, 0xAF, 0xA5, 0xAD, 0x99,
+    0xFE, 0xA4, 0xE9, 0xDA, 0x99, 0xAE, 0x4F, 0xC4, 0xAD, 0x93, 0xF5, 0xAD, 0x92, 0x9E, 0x95, 0xAD,
+    0x92, 0xAE, 0x6E, 0x3E, 0x96, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD, 0x92,
+    0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2A, 0xD9, 0x6A, 0xD9, 0x2A,
+    0xD7, 0xE3, 0xE7, 0xE2, 0x59, 0xA6, 0xE4, 0x9E, 0x5D, 0x97, 0x77, 0x69, 0xD9, 0x4A, 0xD9, 0x4E,
+    0x5E, 0x5D, 0xA4, 0x9D, 0xA4, 0xAD, 0x94, 0xE5, 0xE4, 0x9D, 0xA4, 0x9D, 0x94, 0xAD, 0x94, 0xE5,
+    0xE4, 0x9D, 0xA4, 0xAD, 0x94, 0xAD, 0x5E, 0x40, 0x72, 0x9A, 0x73, 0xE7, 0x19, 0xE7, 0x2D, 0x97,
+    0x77, 0x77, 0x72, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A,
+    0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA,
+    0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x19,
+    0xDA, 0x6A, 0x9A, 0xE9, 0x6F, 0xCA, 0x7F, 0x97, 0x59, 0x99, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7,
+    0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x49, 0xE4, 0xAD, 0x93, 0x9E, 0x5E, 0x39,
+    0xE6, 0xE2, 0x9E, 0x7D, 0xA1, 0x9E, 0x79, 0xD9, 0x09, 0xE7, 0x0A, 0xD0, 0x9E, 0x71, 0xE0, 0xE7,
+    0x2F, 0xE7, 0x19, 0xFE, 0xA7, 0x0A, 0xEA, 0x0E, 0x70, 0xAD, 0x91, 0xAD, 0xA7, 0xE3, 0xE7, 0xE3,
+    0xAD, 0x95, 0x9D, 0xA4, 0xE5, 0xAD, 0x94, 0xE9, 0x4E, 0x59, 0xE4, 0xE6, 0xE9, 0x20, 0x69, 0x96,
+    0xE6, 0xE5, 0x9D, 0xA5, 0xAD, 0x95, 0xAD, 0x6E, 0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x6E, 0x6D,
+    0xA5, 0x9D, 0x95, 0xAD, 0x95, 0xE6, 0xE5, 0x9D, 0xA5, 0xAD, 0x95, 0xAD, 0x6E, 0x6E, 0x59, 0xDA,
+    0x5A, 0xD9, 0x5E, 0x6E, 0x50, 0x77, 0x77, 0x9D, 0x2A, 0xF4, 0xAF, 0xA5, 0xAD, 0x09, 0xFE, 0x2F,
+    0xEA, 0x4E, 0x9D, 0xA9, 0x9E, 0x90, 0xDA, 0x99, 0xAE, 0x4F, 0xC4, 0xDA, 0xD9, 0x3E, 0x93, 0xF5,
+    0xF9, 0x4A, 0xD9, 0x29, 0xE9, 0x5E, 0xA5, 0xAD, 0x3A, 0xE5, 0x9E, 0x6E, 0x3E, 0x95, 0x9D, 0xA6,
+    0xE3, 0xE6, 0xAD, 0x95, 0x9D, 0xA2, 0x9D, 0xA6, 0xE6, 0xAD, 0x92, 0x9D, 0x96, 0xE6, 0xAD, 0x3A,
+    0xD6, 0x9D, 0xA6, 0xE3, 0xE6, 0xAD, 0x96, 0xE3, 0xE6, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0xE6, 0xAD,
+    0x92, 0xAD, 0x96, 0xE6, 0xE3, 0xAD, 0x69, 0xDA, 0x6E, 0x3E, 0x6A, 0xD9, 0x6D, 0xA2, 0x73, 0x99,
+    0x79, 0xD2, 0xFC, 0xA5, 0xAD, 0x09, 0xFF, 0x4E, 0x9E, 0x99, 0xAE, 0x93, 0xFC, 0x93, 0xE9, 0x29,
+    0xF5, 0xAD, 0xA2, 0xAE, 0x95, 0xAD, 0x92, 0xF6, 0xE9, 0x2E, 0x96, 0xE3, 0xE6, 0x9E, 0x29, 0xE6,
+    0xAD, 0xA2, 0xAD, 0xA6, 0xAD, 0x92, 0xE9, 0x6E, 0x3E, 0x7E, 0x3E, 0x69, 0xE2, 0x9D, 0xA6, 0xAD,
+    0xA2, 0xAD, 0x96, 0xE9, 0x2E, 0x96, 0xE3, 0xE7, 0xE2, 0x77, 0x69, 0xFC, 0xA7, 0x9F, 0xFC, 0x59,
+    0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70,
+    0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D,
+    0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96,
+    0x9F, 0xDA, 0x74, 0x97, 0x00, 0x77, 0x79, 0xD2, 0xAF, 0x96, 0xAD, 0x09, 0xFE, 0x95, 0xE9, 0xDA,
+    0x99, 0xF5, 0xFC, 0x4E, 0x94, 0xF5, 0x9D, 0xA3, 0x9E, 0x95, 0x9D, 0xA3, 0xAE, 0x69, 0xDA, 0x3E,
+    0x96, 0x9D, 0xA3, 0xE7, 0xAD, 0x93, 0xDA, 0x7E, 0x92, 0x9D, 0x97, 0xE3, 0xAD, 0x96, 0x9E, 0x3E,
+    0x96, 0xE9, 0x3E, 0x95, 0x9E, 0x39, 0xF4, 0x9E, 0x93, 0xAD, 0xAD, 0x91, 0xAE, 0xA4, 0xAD, 0x0F,
+    0xFA, 0x5E, 0x1A, 0xFC, 0x96, 0xE3, 0x99, 0x70, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x77,
+    0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD9, 0x76, 0x77, 0x7A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99,
+    0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9E, 0x7E, 0x2E, 0x96, 0x9E,
+    0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA,
+    0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xDA, 0xAD, 0x49, 0xFE, 0xA0, 0xE5, 0x9F,
+    0xC9, 0x09, 0xDA, 0x70, 0x93, 0x9D, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD,
+    0x97, 0x5E, 0x76, 0xE5, 0x77, 0x29, 0xD1, 0x9F, 0x4A, 0xD0, 0x9F, 0xC4, 0xE9, 0xDA, 0xAA, 0x94,
+    0xFC, 0x97, 0x0F, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x29, 0xD9,
+    0x72, 0xAD, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x20, 0x77,
+    0x2A, 0xFD, 0x93, 0x9F, 0xFC, 0xA2, 0xEA, 0x99, 0x9A, 0xD2, 0xAD, 0xA7, 0x1A, 0xD7, 0x2A, 0xD9,
+    0x71, 0x9E, 0x72, 0xFA, 0x71, 0xFC, 0x97, 0x0A, 0xFA, 0x71, 0xAE, 0x97, 0x1A, 0xE7, 0x2E, 0x72,
+    0xE7, 0x19, 0xE1, 0xD9, 0x3A, 0xE9, 0x1F, 0xFD, 0xA2, 0x9F, 0xF9, 0x79, 0x99, 0x60, 0x49, 0xC9,
+    0x70, 0xD7, 0x0A, 0xD7, 0x0E, 0x59, 0xAF, 0xF0, 0x9F, 0xFD, 0x19, 0x9E, 0x99, 0x99, 0x93, 0xE7,
+    0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x91, 0x94, 0xAF, 0xD5, 0xAF, 0xC7, 0x99, 0x50, 0x29, 0xD9, 0x6A, 0xD3, 0xE7,
+    0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E, 0x3E,
+    0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3, 0xE6,
+    0xEA, 0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5,
+    0xAF, 0xC9, 0x1D, 0xA7, 0x99, 0x73, 0x9D, 0x97, 0x0E, 0x09, 0xDA, 0x7A, 0xD9, 0x1E, 0x7E, 0x2E,
+    0x6E, 0x92, 0xE5, 0x9E, 0x3E, 0x5E, 0x93, 0xAD, 0x49, 0xDA, 0x4A, 0xD9, 0x3E, 0x59, 0xD9, 0x29,
+    0xDA, 0x59, 0xD9, 0x2E, 0x7D, 0xA1, 0xAD, 0xA7, 0xDA, 0x1E, 0x70, 0xDA, 0x09, 0xD9, 0x70, 0xE0,
+    0xE7, 0x1A, 0xD9, 0xD9, 0x71, 0xAF, 0xC7, 0x2A, 0xF9, 0x72, 0x9F, 0x71, 0x0D, 0xA5, 0x9E, 0x6E,
+    0x1E, 0x5A, 0xE5, 0x9D, 0xA1, 0xE5, 0xF5, 0xE9, 0x1E, 0x4A, 0xCA, 0xD9, 0x4E, 0x2E, 0x4D, 0x9D,
+    0x93, 0xAD, 0x92, 0xE3, 0xAD, 0x0D, 0x93, 0xE3, 0xE3, 0xD9, 0x0D, 0x92, 0xAD, 0x93, 0xE2, 0xAD,
+    0x1D, 0x92, 0xE4, 0xE2, 0xDA, 0x1D, 0xA1, 0x9D, 0x94, 0xAD, 0x19, 0xD2, 0xDA, 0x1E, 0x5A, 0xD1,
+    0xDA, 0x2D, 0xA0, 0x9D, 0xA5, 0xAD, 0x09, 0xD3, 0xDA, 0x0A, 0xD6, 0xAD, 0x0D, 0xA3, 0xAC, 0xA0,
+    0xDA, 0x6A, 0xD0, 0xD4, 0xAC, 0xAA, 0xD7, 0xAD, 0xAC, 0xA4, 0xAC, 0xAD, 0xA7, 0x9F, 0x94, 0xAF,
+    0x97, 0x9F, 0x5A, 0xF7, 0x09, 0xE9, 0x59, 0xE9, 0x70, 0x4D, 0xA6, 0xAD, 0xA4, 0xE5, 0x9E, 0x59,
+    0xDA, 0x39, 0xE7, 0xE3, 0xE7, 0x09, 0xD9, 0x1E, 0x97, 0x1E, 0x0A, 0xD9, 0x72, 0xAD, 0xAD, 0xA7,
+    0x4F, 0xC7, 0x5A, 0xE7, 0x6F, 0x75, 0xFC, 0x97, 0x3E, 0x9D, 0xA7, 0x2A, 0xDA, 0x0A, 0xD7, 0x19,
+    0xDA, 0x19, 0xDA, 0x79, 0xE3, 0xE7, 0xE4, 0x9D, 0xA5, 0xE9, 0x5E, 0x4E, 0xA6, 0xAD, 0x92, 0x49,
+    0xDA, 0x70, 0xE6, 0xDA, 0x7A, 0xD9, 0x6E, 0x7E, 0x7E, 0x6E, 0x97, 0xE5, 0x9E, 0x70, 0xAD, 0x5E,
+    0x71, 0x9D, 0x93, 0x9D, 0xA7, 0x19, 0xDA, 0x3E, 0x73, 0xDA, 0x29, 0xDA, 0x73, 0xE2, 0xE7, 0x4E,
+    0x19, 0xDA, 0x74, 0xAD, 0x1E, 0x75, 0xAD, 0x09, 0xD9, 0x75, 0x9D, 0x0E, 0x76, 0x9D, 0x9D, 0x97,
+    0x7F, 0xC7, 0x70, 0xF9, 0x77, 0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x71, 0xAD,
+    0xA7, 0x70, 0x9E, 0x75, 0xA9, 0x9A, 0xE7, 0x6F, 0xD9, 0x76, 0xFA, 0x77, 0x39, 0xFF, 0xD9, 0x39,
+    0xFF, 0xD9, 0x49, 0x99, 0x99, 0x9A, 0xE7, 0x3E, 0x97, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x29, 0xE7,
+    0x3E, 0x73, 0xE9, 0x72, 0xE9, 0x72, 0xAD, 0xA7, 0x29, 0xE7, 0x29, 0xE7, 0x3E, 0x73, 0xE9, 0x72,
+    0xAD, 0xA7, 0x3F, 0xFE, 0xA2, 0x9F, 0xFE, 0x92, 0x70, 0x9A, 0xAC, 0x70, 0xAF, 0x79, 0xFA, 0x7E,
+    0x71, 0x9D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72,
+    0xE7, 0x1E, 0x96, 0xFC, 0xA6, 0x9E, 0xA7, 0x09, 0xF9, 0x72, 0xE7, 0x29, 0xD9, 0x71, 0x9D, 0x97,
+    0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A,
+    0xE9, 0x71, 0xFA, 0x70, 0x9E, 0xA7, 0x73, 0x09, 0x90, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D,
+    0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x40, 0x5A, 0xCA, 0x97, 0x1F, 0xA7,
+    0x0A, 0xF9, 0x71, 0x9D, 0x97, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19,
+    0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x72, 0x9D, 0x97, 0x2E, 0xA9, 0x71, 0xAE, 0x97, 0xAF, 0x7E, 0xA9,
+    0x7A, 0xD9, 0x71, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A,
+    0xD9, 0x71, 0xE7, 0x09, 0xEA, 0x7F, 0xC7, 0x0E, 0xA7, 0x19, 0x73, 0x1A, 0xEA, 0x96, 0x90, 0x9F,
+    0xFA, 0x3A, 0xC0, 0xAD, 0xA9, 0xAF, 0xFD, 0x0A, 0x94, 0x9A, 0xFD, 0x73, 0x99, 0x93, 0x76, 0x9E,
+    0x5F, 0x5F, 0x5E, 0x96, 0x97, 0x77, 0x3D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x95, 0x9D, 0x6A,
+    0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD9, 0x5E, 0x6E, 0x59, 0xE5, 0xAD, 0xA5, 0xE9, 0x5E, 0x97,
+    0x60, 0x77, 0x7D, 0x97, 0x3D, 0x73, 0x9D, 0x97, 0x0A, 0xFE, 0x49, 0xFF, 0xC3, 0x9E, 0xA3, 0x9A,
+    0x3E, 0x97, 0x1E, 0xA7, 0x19, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x29, 0xDA,
+    0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0xA7, 0x29, 0xF9, 0x99, 0xAD, 0x49, 0xFF, 0xC6,
+    0xAF, 0xCA, 0x70, 0xD7, 0x39, 0xD7, 0x3A, 0xCA, 0x74, 0x97, 0x00, 0x77, 0x77, 0x9F, 0xD9, 0x73,
+    0xFF, 0xD7, 0x1F, 0xA9, 0x9A, 0xDA, 0x70, 0xAD, 0xA5, 0x97, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x09,
+    0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x71, 0xE7, 0x70, 0x9D, 0xA7, 0x5A, 0xAA, 0xFA, 0xAA, 0xAA,
+    0x70, 0xFF, 0xF7, 0x09, 0x99, 0xE9, 0x99, 0x99, 0x97, 0x3D, 0xA7, 0x70, 0x9D, 0x97, 0x70, 0xAD,
+    0x97, 0x70, 0xE7, 0x71, 0xDA, 0x77, 0x0E, 0x77, 0x0A, 0xD9, 0x76, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x94, 0xFF, 0xFE, 0xA3, 0x9F, 0xFF, 0xE9, 0x30, 0x1A, 0x71, 0xA1, 0xDA, 0x09, 0xEA, 0x90,
+    0xDA, 0x0A, 0xFF, 0xF2, 0xAE, 0xA9, 0x9A, 0xE3, 0xAD, 0x49, 0xD9, 0x2D, 0x95, 0xAC, 0xA1, 0x9D,
+    0x69, 0xD1, 0x9D, 0x7D, 0x2D, 0x69, 0xD2, 0xDA, 0x5D, 0xA2, 0x9D, 0xA3, 0xE3, 0xFF, 0xEA, 0x1E,
+    0x9F, 0xCA, 0xAD, 0xA0, 0xAC, 0x39, 0x92, 0xAC, 0x97, 0x60, 0x1D, 0xA7, 0x1A, 0xD2, 0xE7, 0x0A,
+    0xDA, 0x2A, 0xD7, 0x0E, 0x39, 0xD9, 0x6E, 0x94, 0xDA, 0x59, 0xDA, 0x5E, 0x5E, 0x6A, 0xD4, 0xE7,
+    0x9D, 0x92, 0x9D, 0xA7, 0x0D, 0xA2, 0xE7, 0x1A, 0xD1, 0xE7, 0x29, 0xD0, 0x9D, 0x97, 0x3D, 0x9E,
+    0x71, 0x99, 0x9F, 0xC9, 0x99, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF, 0x97, 0x19, 0xD9, 0x76, 0xAD, 0x72,
+    0x9A, 0xAA, 0xAE, 0xAA, 0xAA, 0x95, 0xAF, 0xFE, 0x95, 0xAA, 0xAA, 0xFA, 0xAA, 0xA7, 0x29, 0xD9,
+    0x76, 0xAD, 0x77, 0xE7, 0x7D, 0xA7, 0x30, 0x09, 0x90, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D,
+    0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD1, 0x99, 0x77, 0x75, 0xAA, 0x09,
+    0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0,
+    0x9D, 0x40, 0x70, 0x99, 0x99, 0x97, 0x1F, 0xFA, 0x59, 0xFF, 0xD5, 0xE9, 0x49, 0x95, 0xDA, 0x74,
+    0x9D, 0xA7, 0x5E, 0x97, 0x49, 0xEA, 0x74, 0xFC, 0xA7, 0x1F, 0xF9, 0x6D, 0xA2, 0xAE, 0x5E, 0x4A,
+    0xDA, 0x4D, 0x95, 0xE4, 0xD9, 0x5D, 0xA4, 0xE4, 0x9D, 0x94, 0xAE, 0x3E, 0x6F, 0xA9, 0xE7, 0x0A,
+    0xFC, 0xA7, 0x3A, 0xF7, 0x5E, 0xA7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x4C, 0xA9, 0x3A, 0xE5, 0xFF,
+    0xD9, 0x59, 0xAF, 0xDA, 0x77, 0x70, 0x19, 0x49, 0x09, 0xD9, 0x19, 0xD9, 0xAD, 0x91, 0xAD, 0x99,
+    0xCA, 0x29, 0xCA, 0x00, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x5A, 0xFA, 0xAA, 0xFC, 0x97, 0x2E,
+    0xA6, 0x9A, 0xDA, 0x70, 0xDA, 0x72, 0x9D, 0xA6, 0xDA, 0x59, 0x99, 0x4D, 0xA4, 0xAC, 0xA4, 0xAF,
+    0xD3, 0xD9, 0x3D, 0x39, 0xFF, 0x39, 0xD2, 0xAC, 0x93, 0xE9, 0x39, 0x4D, 0x91, 0xD3, 0xAD, 0x97,
+    0x29, 0xCA, 0x1D, 0x3E, 0x74, 0xD0, 0x9C, 0xA3, 0xDA, 0x74, 0xD0, 0x9C, 0xA3, 0xD9, 0x74, 0xD0,
+    0x9C, 0xA3, 0xD9, 0x74, 0xD0, 0x9C, 0xA3, 0xD9, 0x74, 0xD1, 0xD3, 0xDA, 0x74, 0xD1, 0xD3, 0xAD,
+    0x73, 0x9C, 0xA1, 0xAC, 0x93, 0xDA, 0x72, 0xAC, 0x92, 0xD3, 0xAE, 0xAA, 0xAD, 0x4D, 0x3A, 0xCA,
+    0x39, 0xFE, 0x3D, 0x94, 0xD9, 0x49, 0xAA, 0x99, 0x3A, 0xD5, 0x9D, 0xA7, 0x3E, 0x79, 0xE9, 0x7A,
+    0xE7, 0x2A, 0xEA, 0xA9, 0x9A, 0xFA, 0x75, 0xAF, 0xFA, 0x77, 0x29, 0x99, 0x73, 0x76, 0xEA, 0x0A,
+    0xA1, 0x9E, 0xAC, 0xAC, 0xA1, 0xD9, 0x19, 0xD9, 0x09, 0xCA, 0x3D, 0x1D, 0x4D, 0x1D, 0x4C, 0xA1,
+    0xCA, 0x3A, 0xC9, 0x09, 0xCA, 0x3D, 0x91, 0xD2, 0xAD, 0x2E, 0xAF, 0x3E, 0xA0, 0xCA, 0x74, 0x59,
+    0x74, 0x9D, 0x3D, 0x93, 0x9D, 0xA2, 0xE3, 0x9D, 0xA2, 0xAD, 0x3A, 0xDA, 0x2A, 0xD9, 0x2A, 0xE2,
+    0xAD, 0xA2, 0x9E, 0x29, 0xE3, 0x9D, 0xA2, 0xE5, 0xE2, 0xAD, 0x94, 0x9D, 0xA2, 0xE5, 0xE2, 0xAD,
+    0x59, 0xD9, 0x2D, 0xA5, 0xE2, 0x9D, 0x6C, 0xA3, 0xD7, 0x71, 0xAF, 0xFF, 0xEA, 0xFF, 0xFE, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x49,
+    0xD7, 0x49, 0xAA, 0x19, 0x99, 0x99, 0x99, 0x1A, 0xFE, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x00,
+    0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x5A, 0xFA, 0xAA, 0xFC, 0x97, 0x2E, 0xA6, 0x9A, 0xDA, 0x70,
+    0xDA, 0x72, 0x9D, 0xA6, 0xDA, 0x75, 0xDA, 0x4A, 0xCA, 0x2A, 0xFD, 0xA4, 0xD9, 0x3D, 0x3A, 0xFF,
+    0x39, 0xD2, 0xAC, 0x93, 0xAD, 0x29, 0xDA, 0x3D, 0x91, 0xD4, 0xAD, 0x3E, 0x39, 0xCA, 0x1D, 0x4A,
+    0xD3, 0xE4, 0xD0, 0x9C, 0xA4, 0xAD, 0x3D, 0xA4, 0xD0, 0x9C, 0xA4, 0xAD, 0x99, 0xAE, 0x5D, 0x09,
+    0xCA, 0x4A, 0xFE, 0x6D, 0x09, 0xCA, 0x4A, 0xDA, 0xAD, 0xA6, 0xD1, 0xD4, 0xAD, 0x1A, 0xD6, 0xD1,
+    0xD4, 0xAD, 0x2E, 0x49, 0xCA, 0x1A, 0xC9, 0x3A, 0xD2, 0x9D, 0x93, 0xAC, 0x92, 0xD3, 0xAD, 0x3E,
+    0x3D, 0x3A, 0xCA, 0x2A, 0xD3, 0x9D, 0xA1, 0xD9, 0x4D, 0x91, 0x99, 0x94, 0x99, 0x90, 0xAD, 0x59,
+    0xDA, 0x73, 0xE7, 0x9E, 0x97, 0xAE, 0x72, 0xAE, 0xAA, 0x99, 0xAF, 0xA7, 0x5A, 0xFF, 0xA7, 0x72,
+    0x99, 0x97, 0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xFC, 0x09, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x76, 0xAF, 0xA4, 0xFF, 0x2A, 0xD3, 0xAD, 0x1D, 0x94, 0xD1, 0xD5,
+    0xD9, 0x0D, 0x5D, 0x90, 0xD9, 0x4D, 0x1A, 0xD3, 0xAD, 0x2F, 0xF4, 0xAF, 0xA7, 0x60, 0x6D, 0x97,
+    0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D, 0x96, 0xAF, 0xFF, 0xE0, 0xAF,
+    0xFF, 0xE1, 0x99, 0x99, 0x99, 0xDA, 0x99, 0x99, 0x99, 0x7D, 0x97, 0x5D, 0x97, 0x5D, 0x97, 0x5D,
+    0x97, 0x5D, 0x97, 0x5D, 0x97, 0x77, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xFE, 0x0A, 0xFF, 0xFE, 0x00, 0x59, 0x99, 0x59, 0xFD, 0x93, 0xEA, 0xAE, 0x39, 0x92, 0x9D, 0x71,
+    0xD7, 0x09, 0xD7, 0x0D, 0xA7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7D, 0xA7, 0xDA, 0x69, 0xD9, 0x7F, 0xFC,
+    0x1A, 0xFF, 0xC7, 0x50, 0x49, 0x99, 0x95, 0xAF, 0xD4, 0xDA, 0x9A, 0xE7, 0x09, 0xD7, 0x1D, 0x70,
+    0x9D, 0x69, 0xAD, 0x5F, 0x96, 0xAA, 0xE9, 0x70, 0xAD, 0x71, 0xD7, 0x1D, 0x29, 0x4A, 0xD1, 0x9D,
+    0xAA, 0xAE, 0x92, 0xFE, 0x95, 0x99, 0x95, 0x39, 0xAA, 0x93, 0xE9, 0x2E, 0x92, 0xAD, 0x92, 0x9D,
+    0x93, 0xD4, 0x49, 0xD9, 0x69, 0xD9, 0x4A, 0xD9, 0x6A, 0xD5, 0xE7, 0xE5, 0xE7, 0xE5, 0xE6, 0x9D,
+    0xA4, 0x9D, 0xA6, 0xAD, 0x94, 0xAD, 0x96, 0xAD, 0x5E, 0x7E, 0x5E, 0x7E, 0x5D, 0xA6, 0x9D, 0xA4,
+    0x9D, 0x96, 0xE9, 0x4A, 0xD9, 0x6E, 0x5E, 0x6F, 0x5E, 0x5A, 0xEA, 0x49, 0xE4, 0x9F, 0x94, 0xAF,
+    0x19, 0xE9, 0xD9, 0x4A, 0xFF, 0xC0, 0xAD, 0x5E, 0x9F, 0xA1, 0xAD, 0x5D, 0xA1, 0x99, 0x73, 0x9D,
+    0x97, 0x7A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x70, 0x59,
+    0x99, 0x99, 0x99, 0x99, 0x93, 0x9F, 0xFF, 0xA1, 0xFF, 0xFD, 0xA0, 0xAF, 0xFC, 0x99, 0x99, 0xCA,
+    0x0F, 0xFD, 0x91, 0x9C, 0xA9, 0xFF, 0xD9, 0x19, 0xCA, 0xAF, 0xFD, 0x91, 0x9C, 0xAF, 0xFE, 0x91,
+    0x9C, 0xAF, 0xFE, 0x91, 0x9C, 0xAF, 0xFE, 0x91, 0x9C, 0xAF, 0xFE, 0x91, 0x9C, 0xAA, 0xFF, 0xD9,
+    0x19, 0xCA, 0x9F, 0xFD, 0x91, 0x9C, 0xA0, 0xFF, 0xD9, 0x19, 0xCA, 0x0A, 0xFF, 0xC9, 0x19, 0xCA,
+    0x1F, 0xFC, 0x91, 0x9C, 0xA2, 0x9F, 0xE9, 0x19, 0xCA, 0x70, 0xAC, 0x91, 0x9C, 0xA7, 0x0A, 0xC9,
+    0x19, 0xCA, 0x70, 0xAC, 0x91, 0x9C, 0xA7, 0x0A, 0xC9, 0x19, 0xCA, 0x70, 0xAC, 0x91, 0x9C, 0xA7,
+    0x0A, 0xC9, 0x19, 0xCA, 0x70, 0xAC, 0x91, 0x9C, 0xA7, 0x0A, 0xC9, 0x19, 0xCA, 0x70, 0xAC, 0x91,
+    0x9C, 0xA7, 0x0A, 0xC9, 0x19, 0xCA, 0x70, 0xAC, 0x91, 0x9C, 0xA7, 0x0A, 0xC9, 0x19, 0xCA, 0x70,
+    0xAC, 0x91, 0x9C, 0xA7, 0x70, 0x59, 0xD9, 0x0F, 0x9F, 0x0E, 0x91, 0x91, 0x2D, 0x39, 0xCA, 0x3E,
+    0xA3, 0x9D, 0x93, 0xD9, 0x29, 0xD9, 0xAF, 0xA0, 0xF9, 0x10, 0x73, 0x9D, 0xA2, 0xAE, 0x90, 0x9D,
+    0xAD, 0x1D, 0x99, 0xD4, 0xAD, 0x4D, 0xA4, 0xD9, 0x39, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x94, 0xD9,
+    0x39, 0xD4, 0xAD, 0x72, 0x76, 0xAE, 0xA3, 0x9E, 0xAD, 0xA2, 0xD9, 0x2D, 0x19, 0xCA, 0x3A, 0xC9,
+    0x0D, 0x4A, 0xC9, 0x0D, 0x4A, 0xC9, 0x0D, 0x4D, 0x1D, 0x4D, 0x1D, 0x3D, 0x91, 0x9D, 0xAA, 0xDA,
+    0x3A, 0xFA, 0x75, 0x29, 0x94, 0xA5, 0x9D, 0x3D, 0x95, 0xDA, 0x2A, 0xD5, 0xAD, 0x29, 0xD9, 0x5D,
+    0xA2, 0xE5, 0xAD, 0x29, 0xD9, 0x49, 0xDA, 0x2E, 0x4A, 0xE2, 0xAD, 0x92, 0x9E, 0x29, 0xE3, 0xE2,
+    0x9E, 0x3E, 0x29, 0xE3, 0xAD, 0x3E, 0x39, 0xD9, 0x2E, 0x5A, 0x93, 0xAC, 0x77, 0x40, 0x77, 0x72,
+    0x9D, 0xA7, 0x0A, 0xCA, 0x4A, 0xE9, 0x79, 0xD3, 0x9D, 0xAD, 0x70, 0xD9, 0x3D, 0x99, 0xD7, 0xDA,
+    0x7A, 0xCA, 0x6A, 0xD7, 0x0D, 0xA5, 0x9D, 0x71, 0xD9, 0x5D, 0x97, 0x09, 0xD5, 0xDA, 0x71, 0xAD,
+    0x4A, 0xD7, 0x2A, 0xCA, 0x39, 0xD9, 0x72, 0xD9, 0x3D, 0xA3, 0xE4, 0xD3, 0xE3, 0xAE, 0x39, 0xD2,
+    0xAD, 0x39, 0xEA, 0x3A, 0xD1, 0x9D, 0x92, 0x9F, 0x97, 0x0D, 0xA3, 0xD0, 0xD7, 0x0E, 0x3D, 0x09,
+    0xD7, 0xAD, 0x3D, 0x90, 0xAC, 0xA6, 0x9D, 0x92, 0xAC, 0xA1, 0xAC, 0x96, 0xDA, 0x29, 0xD2, 0xD9,
+    0x5E, 0x3F, 0xFD, 0x3A, 0xD3, 0x9F, 0xFD, 0x29, 0xD9, 0x71, 0xAC, 0xA4, 0xDA, 0x72, 0xD9, 0x3E,
+    0x73, 0xD7, 0x77, 0x10, 0x77, 0x74, 0x9D, 0xA7, 0x0A, 0xCA, 0x6A, 0xE9, 0x79, 0xD9, 0x49, 0xDA,
+    0xD7, 0x0D, 0xA5, 0xD9, 0x9D, 0x7E, 0x71, 0xAC, 0xA6, 0xAD, 0x72, 0xDA, 0x59, 0xD9, 0x72, 0xD9,
+    0x5D, 0xA7, 0x29, 0xD5, 0xE7, 0x3A, 0xD4, 0xAD, 0x74, 0xAC, 0xA3, 0x9D, 0x92, 0x99, 0x96, 0xD9,
+    0x3D, 0xA1, 0xAF, 0xC9, 0x4D, 0x3E, 0x1E, 0xAA, 0xE3, 0x9D, 0x2A, 0xD3, 0x93, 0xD9, 0x2A, 0xD1,
+    0x9D, 0x97, 0x0D, 0x97, 0xDA, 0x71, 0xD7, 0xAD, 0x71, 0xAD, 0x69, 0xD7, 0x1A, 0xD7, 0xD9, 0x70,
+    0xAD, 0x7D, 0xA7, 0x0A, 0xD7, 0xAD, 0x70, 0xE7, 0x9D, 0x70, 0xDA, 0x70, 0xD9, 0x7D, 0xA7, 0x0D,
+    0xA7, 0xFF, 0xC2, 0xAD, 0x79, 0xFF, 0xC7, 0x77, 0x10, 0x59, 0x99, 0x77, 0x29, 0xFD, 0x97, 0x19,
+    0xCA, 0x3D, 0xAA, 0xAE, 0x70, 0x9D, 0x97, 0x1D, 0x97, 0xDA, 0x72, 0xD9, 0x6E, 0x72, 0x9D, 0x6A,
+    0xD7, 0x19, 0xAD, 0x95, 0x9D, 0x97, 0xFA, 0x7D, 0xA7, 0x0A, 0xAE, 0x95, 0xAD, 0x74, 0x9D, 0x49,
+    0xD7, 0x6D, 0x93, 0xD9, 0x76, 0xD9, 0x2D, 0xA3, 0xE1, 0x94, 0xAD, 0x2A, 0xD3, 0xAE, 0x1D, 0xAA,
+    0xAE, 0x91, 0x9D, 0x39, 0xEA, 0x1F, 0xE9, 0x2D, 0x92, 0x9F, 0x93, 0x99, 0x94, 0xDA, 0x3D, 0x0D,
+    0x73, 0xAD, 0x3D, 0x99, 0xD7, 0x29, 0xD3, 0xD9, 0x09, 0xCA, 0x72, 0xD9, 0x2A, 0xCA, 0x1A, 0xCA,
+    0x71, 0xDA, 0x29, 0xD2, 0xD9, 0x70, 0xAD, 0x3F, 0xFD, 0x69, 0xD3, 0x9F, 0xFD, 0x6D, 0x97, 0x1A,
+    0xCA, 0x7D, 0xA7, 0x2D, 0x96, 0xAD, 0x73, 0xD9, 0x77, 0x73, 0x77, 0x59, 0xDA, 0x70, 0xF7, 0x9E,
+    0xA7, 0x0E, 0x72, 0x97, 0x77, 0x73, 0x9D, 0x71, 0xAD, 0x71, 0xDA, 0x70, 0xE7, 0x9E, 0x96, 0xAE,
+    0x96, 0xF7, 0xF7, 0xAD, 0xA7, 0x0E, 0x70, 0x9D, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xDA,
+    0x70, 0x9E, 0xA2, 0x9D, 0xA1, 0xAF, 0xFD, 0x2A, 0xFE, 0xA5, 0x99, 0x99, 0x40, 0x72, 0x9A, 0xA9,
+    0x77, 0x0E, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1D, 0x97, 0x71, 0xCA, 0x77, 0x77, 0x77, 0x7E,
+    0x77, 0xAE, 0x97, 0x6F, 0x97, 0x5F, 0xCA, 0x74, 0x9D, 0x9D, 0xA7, 0x4E, 0x0E, 0x73, 0x9D, 0xA0,
+    0xE7, 0x3E, 0x1A, 0xD7, 0x29, 0xDA, 0x1A, 0xD7, 0x2E, 0x2A, 0xD9, 0x70, 0xAD, 0x92, 0x9D, 0x97,
+    0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4D, 0xA7, 0xE5, 0xE6, 0xAF, 0xFF, 0x59, 0xFF, 0xFC, 0x5E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xE4, 0x9E, 0x7A, 0xD9, 0x3E, 0x70, 0xAD, 0x92, 0x9D, 0xA7, 0x09, 0xDA, 0x2E,
+    0x71, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xE0, 0xAD, 0xA7, 0x3E, 0x00, 0x77, 0x0A, 0xAA,
+    0x77, 0x0A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x70, 0xAC, 0x97, 0x77, 0x77, 0x77,
+    0x3E, 0x77, 0x0A, 0xE9, 0x77, 0xF9, 0x76, 0xFC, 0xA7, 0x59, 0xD9, 0xDA, 0x75, 0xE0, 0xE7, 0x49,
+    0xDA, 0x0E, 0x74, 0xE1, 0xAD, 0x73, 0x9D, 0xA1, 0xAD, 0x73, 0xE2, 0xAD, 0x97, 0x1A, 0xD9, 0x29,
+    0xD9, 0x71, 0xE3, 0x9D, 0xA7, 0x0A, 0xD9, 0x4D, 0xA7, 0x0E, 0x5E, 0x7A, 0xFF, 0xF6, 0x9F, 0xFF,
+    0xC6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x59, 0xE7, 0xAD, 0x94, 0xE7, 0x0A, 0xD9, 0x39, 0xDA, 0x70,
+    0x9D, 0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xDA, 0x72, 0xE2, 0xE7, 0x3E, 0x1A, 0xDA, 0x73, 0xE1, 0x75,
+    0x9A, 0xA7, 0x7A, 0xEA, 0x75, 0x9F, 0xC7, 0x49, 0xDA, 0x0D, 0xA7, 0x29, 0xD9, 0x2D, 0x97, 0x09,
+    0xCA, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x4E, 0x77, 0xAE, 0x97, 0x6F, 0x97, 0x5F, 0xCA, 0x74, 0x9D,
+    0x9D, 0xA7, 0x4E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3E, 0x1A, 0xD7, 0x29, 0xDA, 0x1A, 0xD7, 0x2E,
+    0x2A, 0xD9, 0x70, 0xAD, 0x92, 0x9D, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4D, 0xA7, 0xE5, 0xE6,
+    0xAF, 0xFF, 0x59, 0xFF, 0xFC, 0x5E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0x9E, 0x7A, 0xD9, 0x3E, 0x70,
+    0xAD, 0x92, 0x9D, 0xA7, 0x09, 0xDA, 0x2E, 0x71, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xE0,
+    0xAD, 0xA7, 0x3E, 0x00, 0x73, 0x99, 0x5A, 0x73, 0xFA, 0x2D, 0x72, 0xFE, 0xAD, 0xA7, 0x19, 0xD1,
+    0x9F, 0xC7, 0x29, 0xC4, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x3E, 0x77, 0x1A, 0xE9, 0x77, 0x0F, 0x97,
+    0x7F, 0xCA, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0E, 0x75, 0x9D, 0xA0, 0xE7, 0x5E, 0x1A, 0xD7, 0x49,
+    0xDA, 0x1A, 0xD7, 0x4E, 0x2A, 0xD9, 0x72, 0xAD, 0x92, 0x9D, 0x97, 0x2E, 0x39, 0xDA, 0x71, 0xAD,
+    0x94, 0xDA, 0x71, 0xE5, 0xE7, 0x0A, 0xFF, 0xF7, 0x9F, 0xFF, 0xC7, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x69, 0xE7, 0xAD, 0x95, 0xE7, 0x0A, 0xD9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x19, 0xDA, 0x3A,
+    0xDA, 0x72, 0xE3, 0xE7, 0x3E, 0x2A, 0xDA, 0x73, 0xE2, 0x73, 0x94, 0x97, 0x3E, 0x2E, 0x72, 0xE2,
+    0xE7, 0x2A, 0xC9, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE7, 0x7A, 0xE9, 0x76, 0xF9, 0x75,
+    0xFC, 0xA7, 0x49, 0xD9, 0xDA, 0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xE1, 0xAD, 0x72, 0x9D,
+    0xA1, 0xAD, 0x72, 0xE2, 0xAD, 0x97, 0x0A, 0xD9, 0x29, 0xD9, 0x70, 0xE3, 0x9D, 0xA7, 0xAD, 0x94,
+    0xDA, 0x7E, 0x5E, 0x6A, 0xFF, 0xF5, 0x9F, 0xFF, 0xC5, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x49, 0xE7,
+    0xAD, 0x93, 0xE7, 0x0A, 0xD9, 0x29, 0xDA, 0x70, 0x9D, 0xA2, 0xE7, 0x19, 0xDA, 0x1A, 0xDA, 0x72,
+    0xE1, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xE0, 0x77, 0x77, 0x0F, 0x97, 0x5D, 0xAA, 0xD9, 0x73, 0x9C,
+    0xA2, 0xD7, 0x39, 0xC9, 0x2D, 0x74, 0xD1, 0x9C, 0xA7, 0x4A, 0xFC, 0x76, 0x9A, 0xCA, 0x77, 0x77,
+    0x77, 0x7E, 0x77, 0xAE, 0x97, 0x6F, 0x97, 0x5F, 0xCA, 0x74, 0x9D, 0x9D, 0xA7, 0x4E, 0x0E, 0x73,
+    0x9D, 0xA0, 0xE7, 0x3E, 0x1A, 0xD7, 0x29, 0xDA, 0x1A, 0xD7, 0x2E, 0x2A, 0xD9, 0x70, 0xAD, 0x92,
+    0x9D, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4D, 0xA7, 0xE5, 0xE6, 0xAF, 0xFF, 0x59, 0xFF, 0xFC,
+    0x5E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0x9E, 0x7A, 0xD9, 0x3E, 0x70, 0xAD, 0x92, 0x9D, 0xA7, 0x09,
+    0xDA, 0x2E, 0x71, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xE0, 0xAD, 0xA7, 0x3E, 0x00, 0x76,
+    0xAF, 0xFF, 0xDA, 0x75, 0xAF, 0xFF, 0xEA, 0x75, 0xFF, 0xFF, 0x97, 0x4E, 0x90, 0xE7, 0x75, 0x9D,
+    0xA1, 0xE7, 0x75, 0xE1, 0x9D, 0xA7, 0x74, 0xAD, 0x91, 0xAD, 0x97, 0x73, 0x9E, 0x2E, 0x77, 0x4E,
+    0x3E, 0x77, 0x3A, 0xDA, 0x29, 0xDA, 0x77, 0x29, 0xE3, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0x72, 0xE9,
+    0x3A, 0xFF, 0xE7, 0x1A, 0xDA, 0x4F, 0xFE, 0xA7, 0x1E, 0x5E, 0x77, 0x1F, 0xFF, 0xA7, 0x70, 0x9F,
+    0xFF, 0x97, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xE9, 0x77, 0xEA, 0x6E, 0x77, 0x9E, 0x7E, 0x77, 0xE9,
+    0x69, 0xDA, 0x76, 0xAD, 0xA7, 0xAD, 0x97, 0x59, 0xE7, 0x0E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xE9,
+    0x70, 0xFF, 0xF4, 0xAE, 0x71, 0xFF, 0xF4, 0x77, 0x74, 0xAF, 0xE9, 0x70, 0xAF, 0xFE, 0x59, 0xFC,
+    0xAA, 0xAA, 0xE9, 0x49, 0xF9, 0x69, 0x5E, 0xA7, 0x6E, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x69, 0xE7,
+    0x7A, 0xDA, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x7A, 0xDA, 0x77,
+    0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xF7, 0x79, 0xEA, 0x77, 0xAF, 0xA9, 0x99, 0x9A, 0xCA,
+    0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x3D, 0x99, 0x77, 0xCA, 0x77, 0x0E, 0xA7, 0x70, 0x9D,
+    0x97, 0x70, 0xDA, 0x77, 0x0D, 0x97, 0x4A, 0xFC, 0x75, 0xAE, 0x97, 0x20, 0x79, 0xAA, 0x97, 0x59,
+    0xE7, 0x6A, 0xD7, 0x7D, 0xA7, 0x7D, 0x77, 0x9C, 0xA7, 0x77, 0x77, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF,
+    0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD,
+    0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97,
+    0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xEA, 0x40, 0x75, 0xAA, 0xA7, 0x5E, 0xA7, 0x4A, 0xDA, 0x74,
+    0x9D, 0xA7, 0x5D, 0xA7, 0x5A, 0xC9, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0x94, 0xFF, 0xF5, 0xFF, 0xF4,
+    0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xFA,
+    0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x94, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E,
+    0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49,
+    0xFF, 0xF4, 0xAF, 0xFE, 0xA4, 0x72, 0xAA, 0xA7, 0x5A, 0xE9, 0x73, 0xAF, 0xC7, 0x2A, 0xD9, 0x0D,
+    0x97, 0x0A, 0xD2, 0x9D, 0x79, 0xCA, 0x49, 0xC9, 0x77, 0x77, 0x71, 0xAF, 0xFE, 0x94, 0xFF, 0xF5,
+    0xFF, 0xF4, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9,
+    0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x94, 0x9D, 0xA7, 0x5A, 0xD9, 0x75,
+    0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x49, 0xFF, 0xF4, 0xAF, 0xFE, 0xA4, 0x70, 0x94, 0x97, 0x1D, 0xA2, 0xDA, 0x79, 0xDA, 0x19,
+    0xDA, 0x70, 0xD3, 0xD7, 0x77, 0x77, 0x77, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA,
+    0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59,
+    0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF,
+    0x4A, 0xFF, 0xEA, 0x40, 0x59, 0xAA, 0x97, 0x2E, 0x72, 0x9D, 0x97, 0x2E, 0x73, 0xD9, 0x73, 0xCA,
+    0x77, 0x77, 0x2A, 0xFE, 0x94, 0xFF, 0x96, 0xAD, 0xA9, 0x70, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19,
+    0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72,
+    0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0xAD, 0xA6, 0x9F,
+    0xEA, 0x4A, 0xFF, 0x40, 0x73, 0xAA, 0xA7, 0x3A, 0xE7, 0x29, 0xE7, 0x3E, 0x73, 0xDA, 0x73, 0x9C,
+    0xA7, 0x77, 0x77, 0x1A, 0xFE, 0x96, 0xFF, 0x97, 0x0A, 0xDA, 0x97, 0x2A, 0xD9, 0x73, 0xE7, 0x4E,
+    0x73, 0x9D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73,
+    0xE7, 0x4E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x4D, 0xA7, 0x3A, 0xDA,
+    0x70, 0x9F, 0xEA, 0x6A, 0xFF, 0x60, 0x70, 0x9A, 0xA7, 0x2A, 0xEA, 0x70, 0x9F, 0xC7, 0x9D, 0xA0,
+    0xDA, 0x59, 0xD9, 0x2D, 0x93, 0x9C, 0xA4, 0x9C, 0xA7, 0x77, 0x72, 0xAF, 0xE9, 0x5F, 0xF9, 0x7A,
+    0xDA, 0x97, 0x1A, 0xD9, 0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xE7,
+    0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97,
+    0x2E, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xDA, 0x79, 0xFE, 0xA5, 0xAF, 0xF5, 0x69, 0x49, 0x6E, 0x2E,
+    0x5E, 0x2E, 0x5A, 0xC9, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x1A, 0xFE, 0x95, 0xFF, 0x97, 0xAD, 0xA9,
+    0x71, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xE7,
+    0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7,
+    0x3E, 0x73, 0xDA, 0x72, 0xAD, 0xA7, 0x9F, 0xEA, 0x5A, 0xFF, 0x50, 0x4A, 0xFD, 0xAA, 0x97, 0x2F,
+    0xFE, 0x97, 0x0F, 0xFF, 0xA6, 0x9D, 0xA4, 0x9F, 0xA5, 0xAD, 0x96, 0xAE, 0x5A, 0xD9, 0x7E, 0xA4,
+    0xE7, 0x09, 0xE4, 0xE7, 0x1E, 0x39, 0xDA, 0x71, 0xE3, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE0, 0x9F,
+    0xFD, 0x5E, 0x0A, 0xFF, 0xD5, 0xE0, 0x9A, 0xAD, 0xAA, 0xAA, 0xA9, 0x49, 0xE2, 0xAD, 0x97, 0x1A,
+    0xDA, 0x2E, 0x72, 0xE3, 0xE7, 0x1A, 0xE2, 0x9D, 0xA7, 0x09, 0xE9, 0x29, 0xD9, 0x70, 0xEA, 0x3A,
+    0xD9, 0x69, 0xF4, 0xE5, 0x9A, 0xF5, 0xEA, 0xAA, 0xAA, 0xFC, 0xA5, 0x9F, 0xFF, 0x96, 0xAF, 0xFA,
+    0x97, 0x10, 0x73, 0x99, 0x49, 0x97, 0x39, 0xF9, 0x2D, 0x73, 0xFE, 0xAD, 0x97, 0x2A, 0xC9, 0x1A,
+    0xFA, 0x73, 0xAA, 0x39, 0xAA, 0x97, 0x77, 0x77, 0x76, 0xAD, 0xA7, 0x2D, 0xA4, 0xF7, 0x19, 0xD9,
+    0x4F, 0x97, 0x0A, 0xD9, 0x39, 0xFC, 0x70, 0xE4, 0xAF, 0xC7, 0x0E, 0x4E, 0x9D, 0xA7, 0xDA, 0x4D,
+    0xA0, 0xE6, 0x9D, 0x94, 0xDA, 0x0A, 0xD6, 0xAD, 0x49, 0xD9, 0x09, 0xDA, 0x5E, 0x4A, 0xD2, 0xE5,
+    0xE4, 0xE2, 0xAD, 0x93, 0x9D, 0xA4, 0xE3, 0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE3, 0xAD, 0x49, 0xD9,
+    0x39, 0xD9, 0x2E, 0x4A, 0xD5, 0xE2, 0xDA, 0x4E, 0x5A, 0xD1, 0x9D, 0xA4, 0xDA, 0x59, 0xDA, 0x0A,
+    0xD9, 0x39, 0xDA, 0x6E, 0x0A, 0xD4, 0xAD, 0x96, 0xAD, 0x9E, 0x4A, 0xD7, 0x0D, 0xAD, 0xA4, 0xE7,
+    0x0F, 0xC9, 0x4D, 0xA7, 0x09, 0xF4, 0x9D, 0x97, 0x1F, 0x4A, 0xD7, 0x2A, 0xE4, 0x71, 0x9A, 0xA7,
+    0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x72, 0xDA, 0x77, 0x19, 0xD7, 0x72, 0x9C, 0x97, 0x77, 0x77, 0x76,
+    0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E,
+    0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74,
+    0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD,
+    0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E,
+    0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9,
+    0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x76, 0x9A, 0xAA, 0x77, 0x0E, 0x97, 0x7E, 0x97, 0x7A,
+    0xD9, 0x77, 0x9D, 0x97, 0x70, 0xD7, 0x77, 0x77, 0x77, 0x09, 0xFD, 0xA9, 0x71, 0x9F, 0xFD, 0xA7,
+    0xAF, 0xAA, 0x9A, 0xFC, 0x5A, 0xEA, 0x59, 0xEA, 0x39, 0xE9, 0x79, 0xE3, 0xE9, 0x71, 0xE9, 0x1A,
+    0xDA, 0x72, 0xAD, 0xA1, 0xE7, 0x39, 0xE0, 0xAD, 0xA7, 0x4E, 0x0E, 0x97, 0x4E, 0x0E, 0x75, 0xE9,
+    0xE7, 0x49, 0xE9, 0xDA, 0x74, 0x9E, 0xAD, 0xA7, 0x4A, 0xDA, 0xAD, 0xA7, 0x4E, 0x9A, 0xDA, 0x73,
+    0x9E, 0x0A, 0xDA, 0x73, 0xAE, 0x09, 0xE7, 0x3E, 0x91, 0xE7, 0x2F, 0x2F, 0x70, 0xAE, 0x39, 0xEA,
+    0x6F, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0xA6, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69, 0x99, 0x71,
+    0x74, 0xAA, 0x97, 0x70, 0xF7, 0x7A, 0xFA, 0x75, 0xAD, 0x99, 0xD9, 0x73, 0xE2, 0xAD, 0x72, 0xAC,
+    0xA4, 0xAC, 0x97, 0x77, 0x77, 0x73, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF,
+    0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA,
+    0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D,
+    0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7,
+    0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA,
+    0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x72, 0x99, 0x49,
+    0xA7, 0x19, 0xFA, 0x2D, 0x71, 0xFE, 0xAD, 0x97, 0x0A, 0xCA, 0x1A, 0xFC, 0x71, 0xAA, 0x4A, 0xAA,
+    0x77, 0x77, 0x77, 0x49, 0xFD, 0xA9, 0x71, 0x9F, 0xFD, 0xA7, 0xAF, 0xAA, 0x9A, 0xFC, 0x5A, 0xEA,
+    0x59, 0xEA, 0x39, 0xE9, 0x79, 0xE3, 0xE9, 0x71, 0xE9, 0x1A, 0xDA, 0x72, 0xAD, 0xA1, 0xE7, 0x39,
+    0xE0, 0xAD, 0xA7, 0x4E, 0x0E, 0x97, 0x4E, 0x0E, 0x75, 0xE9, 0xE7, 0x49, 0xE9, 0xDA, 0x74, 0x9E,
+    0xAD, 0xA7, 0x4A, 0xDA, 0xAD, 0xA7, 0x4E, 0x9A, 0xDA, 0x73, 0x9E, 0x0A, 0xDA, 0x73, 0xAE, 0x09,
+    0xE7, 0x3E, 0x91, 0xE7, 0x2F, 0x2F, 0x70, 0xAE, 0x39, 0xEA, 0x6F, 0x94, 0xAF, 0xA9, 0x99, 0xAF,
+    0xA6, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69, 0x99, 0x71, 0x72, 0x94, 0x97, 0x4D, 0xA2, 0xDA,
+    0x72, 0x9D, 0xA1, 0x9D, 0xA7, 0x3D, 0x3D, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xDA, 0x97, 0x19,
+    0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97,
+    0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0,
+    0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9,
+    0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A,
+    0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76,
+    0x99, 0x97, 0x10, 0x77, 0x1C, 0x71, 0xA9, 0x1E, 0x7A, 0xD9, 0x09, 0xE5, 0xAD, 0xA2, 0x9E, 0x3A,
+    0xDA, 0x49, 0xE1, 0xAD, 0xA6, 0x9F, 0xDA, 0x70, 0x9F, 0xA7, 0x2F, 0x72, 0xAF, 0xC7, 0x0A, 0xDA,
+    0x9E, 0x6A, 0xDA, 0x19, 0xE4, 0xAD, 0xA3, 0x9E, 0x2A, 0xDA, 0x59, 0xE1, 0xAC, 0xA7, 0x9D, 0x29,
+    0x71, 0x91, 0x77, 0x77, 0x72, 0xAA, 0x71, 0x9F, 0xDA, 0x19, 0xDA, 0x69, 0xFF, 0xDA, 0xE6, 0xAF,
+    0xA9, 0x9A, 0xFD, 0x6A, 0xEA, 0x59, 0xEA, 0x59, 0xE9, 0x6A, 0xF5, 0xE9, 0x69, 0xFC, 0x93, 0xAD,
+    0xA7, 0xEA, 0xDA, 0x3E, 0x7E, 0x09, 0xE2, 0xAD, 0xA6, 0xE9, 0x1E, 0x2E, 0x95, 0xAD, 0xA2, 0xE2,
+    0xE5, 0x9D, 0xA3, 0xE1, 0x9E, 0x5E, 0x39, 0xE1, 0x9D, 0xA4, 0xE4, 0x9E, 0x1A, 0xDA, 0x3E, 0x94,
+    0xAD, 0xA1, 0xAD, 0xA2, 0xAD, 0xA5, 0xE9, 0x1A, 0xDA, 0x19, 0xDA, 0x6E, 0x2A, 0xDA, 0x1E, 0x6A,
+    0xE2, 0x9E, 0x0E, 0x7E, 0x93, 0xFD, 0x96, 0xF4, 0xFC, 0x96, 0xAE, 0x59, 0xF6, 0xAE, 0x96, 0xFC,
+    0xA9, 0x99, 0xAF, 0xA6, 0xFF, 0xFD, 0x96, 0xE9, 0x0A, 0xFE, 0x97, 0x09, 0xC9, 0x49, 0x99, 0x77,
+    0x77, 0x10, 0x70, 0x9A, 0xA9, 0x77, 0x1E, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x77, 0x2D, 0x97, 0x71,
+    0x9C, 0xA7, 0x77, 0x77, 0x73, 0xE7, 0x2D, 0xA3, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92,
+    0xAD, 0x97, 0x1A, 0xD3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D, 0xA7, 0x19, 0xDA, 0x29, 0xDA, 0x71,
+    0xAD, 0x92, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2D, 0xA2, 0x9D, 0xA7, 0x19, 0xDA, 0x2A,
+    0xD9, 0x71, 0xAD, 0x92, 0xAD, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x29, 0xDA, 0x71, 0xE3, 0x9D, 0xA7, 0x09, 0xE4, 0xE7, 0x0E, 0x94, 0xEA, 0x6F, 0x59, 0xF9,
+    0x99, 0x9A, 0xF7, 0xAF, 0xFE, 0x71, 0x9F, 0xF9, 0x76, 0x99, 0x73, 0x76, 0xAA, 0xA7, 0x70, 0xEA,
+    0x77, 0xAD, 0xA7, 0x79, 0xDA, 0x77, 0x0D, 0xA7, 0x70, 0xAC, 0x97, 0x77, 0x77, 0x74, 0xE7, 0x2D,
+    0xA3, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1A, 0xD3, 0xE7, 0x2E, 0x3E,
+    0x72, 0xE2, 0x9D, 0xA7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1E, 0x3E, 0x72,
+    0xE3, 0xE7, 0x2D, 0xA2, 0x9D, 0xA7, 0x19, 0xDA, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0xAD, 0x72, 0xE3,
+    0xE7, 0x2E, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x29, 0xDA, 0x71, 0xE3, 0x9D, 0xA7,
+    0x09, 0xE4, 0xE7, 0x0E, 0x94, 0xEA, 0x6F, 0x59, 0xF9, 0x99, 0x9A, 0xF7, 0xAF, 0xFE, 0x71, 0x9F,
+    0xF9, 0x76, 0x99, 0x73, 0x73, 0xAA, 0xA7, 0x70, 0xAE, 0x97, 0x6A, 0xFC, 0x75, 0xAD, 0x90, 0xDA,
+    0x73, 0xAD, 0x91, 0x9D, 0x97, 0x19, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x0E, 0x72, 0xDA, 0x3E,
+    0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E,
+    0x29, 0xDA, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E,
+    0x72, 0xDA, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72,
+    0xE3, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E,
+    0x4E, 0x70, 0xE9, 0x4E, 0xA6, 0xF5, 0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97,
+    0x69, 0x97, 0x30, 0x71, 0x94, 0x97, 0x4E, 0x2E, 0x73, 0xE2, 0xE7, 0x3A, 0xC9, 0x2A, 0xC9, 0x77,
+    0x77, 0x77, 0x77, 0x5E, 0x72, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9,
+    0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9,
+    0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xDA, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0xAD, 0x97,
+    0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72, 0xE3, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92,
+    0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E, 0x4E, 0x70, 0xE9, 0x4E, 0xA6, 0xF5, 0x9F, 0x99, 0x99,
+    0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97, 0x69, 0x97, 0x30, 0x72, 0xAA, 0xA7, 0x5A, 0xE7, 0x49,
+    0xE7, 0x5E, 0x75, 0xE7, 0x59, 0xCA, 0x77, 0x77, 0x73, 0xAD, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x0E,
+    0x19, 0xDA, 0x7E, 0x92, 0xE6, 0x9E, 0x3E, 0x6E, 0x4A, 0xD9, 0x4E, 0x94, 0x9D, 0xA3, 0x9D, 0xA6,
+    0xE3, 0xE7, 0xE2, 0xE9, 0x7A, 0xD1, 0x9D, 0xA7, 0x09, 0xD9, 0x0E, 0x72, 0xDA, 0xAD, 0x97, 0x2A,
+    0xFA, 0x73, 0x9F, 0x75, 0xE9, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D,
+    0xA7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x74, 0x4A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75,
+    0xAE, 0xAA, 0xAA, 0x97, 0x0A, 0xFF, 0xCA, 0x6F, 0xFF, 0x5E, 0x4A, 0xE9, 0x39, 0xDA, 0x5A, 0xE3,
+    0xAD, 0x96, 0xE3, 0xE7, 0xE3, 0xE7, 0xE3, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xAD, 0xA2, 0xAD, 0x95,
+    0x9E, 0x3E, 0x5A, 0xEA, 0x3E, 0xAA, 0xAF, 0xDA, 0x39, 0xFF, 0xE9, 0x49, 0xFD, 0xAA, 0x97, 0xAD,
+    0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x50, 0x76, 0x99, 0x99, 0x97, 0x70, 0xAF,
+    0xEA, 0x75, 0xFF, 0xDA, 0x73, 0xAE, 0x92, 0x9E, 0x73, 0xE5, 0xAD, 0x97, 0x1A, 0xD9, 0x5A, 0xD9,
+    0x71, 0xE6, 0xE7, 0x2E, 0x5A, 0xDA, 0x71, 0x9D, 0xA4, 0xEA, 0x72, 0xAD, 0x92, 0x9E, 0xA7, 0x3E,
+    0x29, 0xE9, 0x74, 0xE2, 0xE7, 0x6D, 0xA1, 0x9D, 0x97, 0x59, 0xD9, 0x19, 0xD9, 0x75, 0xAD, 0x92,
+    0xE9, 0x74, 0xE3, 0xAE, 0x97, 0x3E, 0x4A, 0xEA, 0x71, 0x9D, 0xA5, 0x9E, 0x97, 0x09, 0xD9, 0x69,
+    0xE7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x79, 0xE7, 0xAD, 0x90,
+    0xD9, 0x2A, 0xE9, 0x7E, 0x1F, 0xFC, 0xA7, 0x0E, 0x19, 0xFE, 0x97, 0x1E, 0x49, 0x99, 0x73, 0x9D,
+    0xA7, 0x73, 0xAD, 0x97, 0x73, 0xE7, 0x73, 0x9D, 0xA7, 0x70, 0xA9, 0xAE, 0x77, 0x1F, 0xC9, 0x77,
+    0x1F, 0x97, 0x71, 0x69, 0xAA, 0x97, 0x59, 0xE7, 0x6A, 0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xCA,
+    0x77, 0x77, 0x76, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2,
+    0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD,
+    0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4,
+    0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x73,
+    0x74, 0xAA, 0xA7, 0x5E, 0xA7, 0x4A, 0xDA, 0x74, 0x9D, 0xA7, 0x5D, 0xA7, 0x5A, 0xC9, 0x77, 0x77,
+    0x77, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2, 0xAE, 0x59,
+    0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D,
+    0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4, 0xAF, 0x93,
+    0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x73, 0x71, 0xAA,
+    0xA7, 0x5A, 0xE9, 0x73, 0xAF, 0xC7, 0x2A, 0xD9, 0x0D, 0xA7, 0x0A, 0xD2, 0x9D, 0x79, 0xCA, 0x49,
+    0xCA, 0x77, 0x77, 0x73, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F,
+    0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7,
+    0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93,
+    0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09,
+    0x73, 0x79, 0x94, 0x9A, 0x69, 0xFA, 0x2D, 0x6F, 0xEA, 0xDA, 0x59, 0xCA, 0x1A, 0xFC, 0x6A, 0xC4,
+    0xAC, 0xA7, 0x77, 0x77, 0x4A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4,
+    0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E,
+    0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9,
+    0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70,
+    0x97, 0x30, 0x79, 0x49, 0x71, 0xDA, 0x2D, 0xA7, 0x9D, 0xA1, 0x9D, 0xA7, 0x0D, 0x3D, 0x77, 0x77,
+    0x77, 0x76, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2, 0xAE,
+    0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91,
+    0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4, 0xAF,
+    0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x73, 0x77,
+    0x71, 0x9F, 0x97, 0x3D, 0xAA, 0xD7, 0x29, 0xC9, 0x19, 0xCA, 0x71, 0xAC, 0x3C, 0xA7, 0x19, 0xCA,
+    0x1A, 0xC9, 0x72, 0xFD, 0x74, 0xAD, 0xA7, 0x77, 0x77, 0x6A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F,
+    0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9,
+    0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6,
+    0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5,
+    0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30, 0x77, 0x77, 0xAF, 0x91, 0xAC, 0x1A, 0xFA, 0x59, 0xFE,
+    0x90, 0xD9, 0xFF, 0x4F, 0x99, 0x9D, 0xAF, 0xC9, 0x99, 0xE9, 0x2E, 0xA3, 0x9F, 0xCA, 0x39, 0xDA,
+    0x1A, 0xE5, 0xFA, 0x49, 0xDA, 0x1E, 0x6F, 0x5A, 0xD9, 0x09, 0xDA, 0x6E, 0x94, 0x9E, 0x1E, 0x96,
+    0xE2, 0x9A, 0xF2, 0xE7, 0xFF, 0xE3, 0xE6, 0x9F, 0xFA, 0x93, 0x9D, 0xA6, 0xAD, 0xA9, 0x71, 0x9D,
+    0xA6, 0xE9, 0x72, 0x9D, 0xA5, 0xAE, 0xA7, 0x29, 0xDA, 0x49, 0xFC, 0x73, 0xE3, 0x9F, 0xD9, 0x72,
+    0xEA, 0x1A, 0xD9, 0xFC, 0xA2, 0x9A, 0xC9, 0x29, 0xFE, 0x09, 0xDA, 0xFF, 0xC9, 0x39, 0xFA, 0x19,
+    0xCA, 0x09, 0xFE, 0x96, 0x99, 0x72, 0x99, 0x60, 0x77, 0x49, 0xFD, 0xA5, 0xFF, 0xC4, 0xFA, 0x99,
+    0x9A, 0xA3, 0xEA, 0x71, 0xAE, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0x9D,
+    0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2, 0x9A, 0xC4, 0xAF, 0xFC,
+    0x59, 0xFE, 0x97, 0xD9, 0x97, 0x19, 0xCA, 0x73, 0xE9, 0x73, 0xAD, 0x97, 0x3D, 0x97, 0x29, 0xD9,
+    0x7A, 0xFA, 0x70, 0xF9, 0x70, 0x59, 0xAA, 0x97, 0x3E, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xD9, 0x73,
+    0x9C, 0xA7, 0x77, 0x76, 0xAF, 0xCA, 0x6F, 0xFC, 0x4F, 0x99, 0x9E, 0x92, 0xEA, 0x39, 0xDA, 0x1A,
+    0xDA, 0x49, 0xDA, 0x1E, 0x5A, 0xD9, 0x09, 0xDA, 0x49, 0xE1, 0xE9, 0x19, 0xAF, 0x91, 0xFF, 0xE3,
+    0xFF, 0xA9, 0x39, 0xDA, 0x97, 0x19, 0xDA, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2,
+    0x9A, 0xC9, 0x3A, 0xFF, 0xC9, 0x49, 0xFE, 0x97, 0x09, 0x96, 0x73, 0xAA, 0xA7, 0x3E, 0xA7, 0x2A,
+    0xDA, 0x72, 0x9D, 0xA7, 0x3D, 0xA7, 0x3A, 0xC9, 0x77, 0x77, 0x72, 0xAF, 0xCA, 0x7F, 0xFC, 0x5F,
+    0x99, 0x9E, 0x93, 0xEA, 0x39, 0xDA, 0x2A, 0xDA, 0x49, 0xDA, 0x2E, 0x5A, 0xD9, 0x19, 0xDA, 0x49,
+    0xE2, 0xE9, 0x19, 0xAF, 0x92, 0xFF, 0xE4, 0xFF, 0xA9, 0x49, 0xDA, 0x97, 0x29, 0xDA, 0x73, 0x9D,
+    0xA7, 0x4E, 0x74, 0xE9, 0x73, 0x9E, 0xA2, 0x9A, 0xC9, 0x4A, 0xFF, 0xC9, 0x59, 0xFE, 0x97, 0x19,
+    0x97, 0x70, 0xAA, 0xA7, 0x2A, 0xE9, 0x70, 0xAF, 0xC7, 0xAD, 0x90, 0xDA, 0x5A, 0xD9, 0x19, 0xD9,
+    0x39, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x3A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3,
+    0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9,
+    0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97,
+    0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x60, 0x69, 0x49, 0x6E,
+    0x2E, 0x5E, 0x2E, 0x5D, 0x92, 0xD9, 0x77, 0x77, 0x77, 0x2A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99,
+    0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E,
+    0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73,
+    0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x60,
+    0x29, 0xAA, 0x59, 0xDA, 0x5E, 0x6D, 0xA5, 0x9D, 0x69, 0xC9, 0x77, 0x59, 0xD9, 0x4A, 0xD9, 0x4E,
+    0x5E, 0x5D, 0xA4, 0x9D, 0xA4, 0xAD, 0x94, 0xE5, 0xE4, 0x9D, 0xA4, 0x9D, 0x94, 0xAD, 0x94, 0xE5,
+    0xE4, 0x9D, 0xA4, 0xAD, 0x94, 0xAD, 0x5E, 0x40, 0x79, 0xAA, 0xA7, 0xE9, 0x6E, 0x96, 0xAD, 0x96,
+    0x9D, 0x97, 0xD7, 0x77, 0x70, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xDA, 0x79, 0xDA, 0x7A,
+    0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9,
+    0x7A, 0xD7, 0x0E, 0x70, 0x5A, 0xA9, 0x7F, 0x6A, 0xFA, 0x4A, 0xD9, 0x9D, 0x92, 0xE2, 0xAD, 0x1A,
+    0xCA, 0x4A, 0xC9, 0x77, 0x73, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xDA, 0x79, 0xDA, 0x7A,
+    0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9,
+    0x7A, 0xD7, 0x0E, 0x70, 0x39, 0x49, 0x3D, 0xA2, 0xD9, 0x19, 0xDA, 0x19, 0xDA, 0x2D, 0x3D, 0x77,
+    0x77, 0x70, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xDA, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70,
+    0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7A, 0xD7, 0x0E,
+    0x70, 0x77, 0x71, 0xAC, 0xA2, 0x9D, 0x70, 0xEA, 0x0A, 0xE7, 0x1F, 0xDA, 0x72, 0xAF, 0x72, 0x9F,
+    0xD9, 0x70, 0xAE, 0x90, 0xE7, 0x09, 0xC9, 0x29, 0xD9, 0x76, 0xE7, 0x6A, 0xD7, 0x9A, 0xAA, 0xA1,
+    0x9D, 0x59, 0xFE, 0xA9, 0xD9, 0x3A, 0xFA, 0xAE, 0xAD, 0x92, 0xAE, 0x93, 0x9F, 0x92, 0xE6, 0xAE,
+    0x91, 0xAD, 0x96, 0x9E, 0x2E, 0x70, 0xE1, 0x9D, 0xA7, 0x0E, 0x19, 0xDA, 0x79, 0xDA, 0x1A, 0xD9,
+    0x7A, 0xD9, 0x1A, 0xD9, 0x7E, 0x29, 0xDA, 0x6A, 0xDA, 0x3E, 0x59, 0xE4, 0xAE, 0x91, 0x9A, 0xE6,
+    0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x10, 0x70, 0x99, 0x5A, 0x97, 0xFA, 0x2A, 0xC9, 0x6A,
+    0xFD, 0xAE, 0x7D, 0x19, 0xFC, 0x79, 0xC9, 0x39, 0xAA, 0x77, 0x77, 0x19, 0x97, 0x09, 0xD2, 0xFC,
+    0xA6, 0xAD, 0x09, 0xFF, 0x5E, 0x9E, 0x99, 0xAE, 0x94, 0xFC, 0x93, 0xE9, 0x39, 0xF5, 0xAD, 0xA3,
+    0xAE, 0x95, 0xAD, 0x93, 0xF6, 0xE9, 0x3E, 0x96, 0xE4, 0xE6, 0x9E, 0x39, 0xE6, 0xAD, 0xA3, 0xAD,
+    0xA6, 0xAD, 0x93, 0xE9, 0x6E, 0x4E, 0x7E, 0x4E, 0x69, 0xE3, 0x9D, 0xA6, 0xAD, 0xA3, 0xAD, 0x96,
+    0xE9, 0x3E, 0x96, 0xE4, 0xE7, 0xE3, 0x6A, 0xA9, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x76, 0xDA,
+    0x76, 0xAC, 0x77, 0x77, 0x74, 0x9F, 0xCA, 0x79, 0xFF, 0xC5, 0x9F, 0x99, 0x9F, 0x4E, 0xA4, 0xAD,
+    0xA2, 0xAD, 0xA6, 0xE2, 0xE7, 0xE1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0x70, 0xE0, 0x9D, 0xA7,
+    0x0E, 0x09, 0xDA, 0x79, 0xDA, 0x09, 0xDA, 0x7A, 0xD9, 0x09, 0xDA, 0x7E, 0x2E, 0x6A, 0xDA, 0x2E,
+    0x94, 0x9E, 0x39, 0xEA, 0x90, 0x9A, 0xE9, 0x4A, 0xFF, 0xC9, 0x69, 0xFD, 0xA7, 0x49, 0x70, 0x73,
+    0xAA, 0xA9, 0x73, 0xAE, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x49, 0xCA, 0x77, 0x77, 0x75, 0x9F, 0xCA,
+    0x79, 0xFF, 0xC5, 0x9F, 0x99, 0x9F, 0x4E, 0xA4, 0xAD, 0xA2, 0xAD, 0xA6, 0xE2, 0xE7, 0xE1, 0xAD,
+    0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0x70, 0xE0, 0x9D, 0xA7, 0x0E, 0x09, 0xDA, 0x79, 0xDA, 0x09, 0xDA,
+    0x7A, 0xD9, 0x09, 0xDA, 0x7E, 0x2E, 0x6A, 0xDA, 0x2E, 0x94, 0x9E, 0x39, 0xEA, 0x90, 0x9A, 0xE9,
+    0x4A, 0xFF, 0xC9, 0x69, 0xFD, 0xA7, 0x49, 0x70, 0x70, 0x9A, 0xA7, 0x49, 0xEA, 0x72, 0x9F, 0xC9,
+    0x70, 0x9D, 0xA0, 0xE7, 0x9D, 0xA2, 0xDA, 0x6D, 0x94, 0xD7, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x9F,
+    0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E,
+    0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD,
+    0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF,
+    0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x69, 0x99, 0x4A, 0x95, 0xFC, 0x2A, 0xC9, 0x4A, 0xFD,
+    0xAA, 0xD5, 0xD1, 0x9F, 0xC9, 0x49, 0xC9, 0x39, 0xAA, 0x97, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x9F,
+    0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E,
+    0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD,
+    0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF,
+    0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x69, 0x49, 0x70, 0xAD, 0x2A, 0xD7, 0xE2, 0xE7, 0xAC,
+    0xA2, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x29, 0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA,
+    0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09,
+    0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD,
+    0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97,
+    0x00, 0x69, 0x97, 0x59, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x59, 0xA7, 0x77, 0x77, 0x1A, 0xFF, 0xFE,
+    0x0A, 0xFF, 0xFE, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x09, 0xDA,
+    0x74, 0xAE, 0x74, 0xAE, 0x75, 0xD9, 0x60, 0x77, 0x77, 0x1C, 0x79, 0xFC, 0xA0, 0xDA, 0x5F, 0xFE,
+    0x49, 0xF9, 0x99, 0xF9, 0x4E, 0x93, 0x9E, 0xA3, 0xAD, 0x93, 0x9F, 0xC3, 0xE4, 0xDA, 0xE2, 0xAD,
+    0x93, 0xE0, 0xAD, 0x2E, 0x3A, 0xD1, 0xAD, 0x2E, 0x29, 0xD9, 0x1E, 0x2D, 0xA1, 0x9D, 0xA2, 0xE1,
+    0x9D, 0x91, 0xDA, 0x3D, 0xA1, 0x9D, 0x90, 0xE3, 0x9D, 0x91, 0x9D, 0xAA, 0xD4, 0xE3, 0xFC, 0x93,
+    0xAD, 0x93, 0xFA, 0x39, 0xE4, 0x9E, 0xA2, 0xAE, 0x5F, 0xFE, 0x5A, 0xD9, 0xFD, 0xA6, 0x9C, 0x93,
+    0x97, 0x77, 0x20, 0x69, 0xAA, 0x97, 0x6E, 0x76, 0x9D, 0x97, 0x6E, 0x77, 0xD9, 0x77, 0xCA, 0x77,
+    0x77, 0x73, 0x9D, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xD9,
+    0x2A, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD, 0x92,
+    0xAD, 0x96, 0xE3, 0xE6, 0x9E, 0x3E, 0x6E, 0xA3, 0xE5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xEA, 0x19,
+    0xDA, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x5A, 0xFC, 0x91, 0xDA, 0x79, 0x97, 0x30, 0x74, 0xAA, 0xA7,
+    0x5A, 0xE7, 0x49, 0xE7, 0x5E, 0x75, 0xDA, 0x75, 0x9C, 0xA7, 0x77, 0x77, 0x49, 0xD9, 0x6A, 0xD3,
+    0xE7, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E,
+    0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3,
+    0xE6, 0xEA, 0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A,
+    0xD5, 0xAF, 0xC9, 0x1D, 0xA7, 0x99, 0x73, 0x71, 0x9A, 0xA7, 0x5A, 0xEA, 0x73, 0x9F, 0xC7, 0x29,
+    0xDA, 0x0D, 0xA7, 0x09, 0xD9, 0x2D, 0x96, 0x9C, 0xA4, 0x9C, 0xA7, 0x77, 0x77, 0x09, 0xD9, 0x6A,
+    0xD3, 0xE7, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E,
+    0x7E, 0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69,
+    0xE3, 0xE6, 0xEA, 0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA,
+    0x0A, 0xD5, 0xAF, 0xC9, 0x1D, 0xA7, 0x99, 0x73, 0x79, 0x49, 0x71, 0xE2, 0xE7, 0x0E, 0x2E, 0x70,
+    0xAC, 0x92, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x29, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE3, 0xE6,
+    0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x29, 0xDA, 0x69,
+    0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3, 0xE6, 0xEA, 0x3E, 0x5A, 0xE9,
+    0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0xAF, 0xC9, 0x1D, 0xA7,
+    0x99, 0x73, 0x76, 0x9A, 0xA9, 0x77, 0x1E, 0x97, 0x70, 0xE9, 0x77, 0x0A, 0xD9, 0x77, 0x09, 0xD9,
+    0x77, 0x1D, 0x77, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0x0E, 0x6D, 0xA7, 0xAD, 0x96, 0xE7, 0xE7, 0xE6,
+    0xE9, 0x7E, 0x59, 0xE7, 0x0A, 0xD5, 0xE7, 0x19, 0xD9, 0x39, 0xDA, 0x71, 0x9D, 0xA3, 0xE7, 0x3D,
+    0xA2, 0x9D, 0xA7, 0x3E, 0x2E, 0x74, 0xE1, 0x9D, 0xA7, 0x4A, 0xD1, 0xE7, 0x5A, 0xD0, 0x9D, 0x97,
+    0x59, 0xD0, 0xE7, 0x69, 0xD9, 0xD9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x70, 0xEA, 0x77, 0x1E, 0x77,
+    0x19, 0xDA, 0x77, 0x1E, 0x77, 0x1A, 0xDA, 0x77, 0x09, 0xE7, 0x5A, 0x99, 0xAE, 0x76, 0xFD, 0x97,
+    0x6F, 0xA7, 0x70, 0x79, 0x97, 0x7E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6A, 0xD7, 0x7E,
+    0x77, 0xE7, 0x69, 0xDA, 0x1A, 0xF9, 0x6A, 0xD9, 0x9F, 0xE9, 0x5E, 0x9D, 0xA9, 0x9F, 0x5F, 0xC4,
+    0xE9, 0x4F, 0x59, 0xDA, 0x39, 0xE9, 0x59, 0xDA, 0x3A, 0xE6, 0x9D, 0xA3, 0xE9, 0x69, 0xDA, 0x3E,
+    0x7A, 0xD9, 0x29, 0xDA, 0x7E, 0x92, 0x9D, 0x97, 0xE3, 0xAD, 0x96, 0x9E, 0x3E, 0x96, 0xE9, 0x3E,
+    0x95, 0x9E, 0x39, 0xF4, 0x9E, 0x93, 0xAD, 0xAD, 0x91, 0xAE, 0xA4, 0xAD, 0x0F, 0xFA, 0x5E, 0x1A,
+    0xFC, 0x96, 0xE3, 0x99, 0x70, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x77, 0xDA, 0x76, 0x9D,
+    0x97, 0x6A, 0xD9, 0x76, 0x72, 0x94, 0x97, 0x49, 0xD9, 0x19, 0xD9, 0x73, 0xAD, 0x91, 0xAD, 0x97,
+    0x39, 0xCA, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9D, 0xA7, 0x0E, 0x6D, 0xA7, 0xAD, 0x96,
+    0xE7, 0xE7, 0xE6, 0xE9, 0x7E, 0x59, 0xE7, 0x0A, 0xD5, 0xE7, 0x19, 0xD9, 0x39, 0xDA, 0x71, 0x9D,
+    0xA3, 0xE7, 0x3D, 0xA2, 0x9D, 0xA7, 0x3E, 0x2E, 0x74, 0xE1, 0x9D, 0xA7, 0x4A, 0xD1, 0xE7, 0x5A,
+    0xD0, 0x9D, 0x97, 0x59, 0xD0, 0xE7, 0x69, 0xD9, 0xD9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x70, 0xEA,
+    0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77, 0x1E, 0x77, 0x1A, 0xDA, 0x77, 0x09, 0xE7, 0x5A, 0x99, 0xAE,
+    0x76, 0xFD, 0x97, 0x6F, 0xA7, 0x70, 0x72, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x19, 0xFF, 0xA7, 0x19,
+    0xFF, 0x97, 0x77, 0x77, 0x74, 0xE7, 0x7A, 0xE9, 0x76, 0xF9, 0x75, 0xFC, 0xA7, 0x49, 0xD9, 0xDA,
+    0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xE1, 0xAD, 0x72, 0x9D, 0xA1, 0xAD, 0x72, 0xE2, 0xAD,
+    0x97, 0x0A, 0xD9, 0x29, 0xD9, 0x70, 0xE3, 0x9D, 0xA7, 0xAD, 0x94, 0xDA, 0x7E, 0x5E, 0x6A, 0xFF,
+    0xF5, 0x9F, 0xFF, 0xC5, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x49, 0xE7, 0xAD, 0x93, 0xE7, 0x0A, 0xD9,
+    0x29, 0xDA, 0x70, 0x9D, 0xA2, 0xE7, 0x19, 0xDA, 0x1A, 0xDA, 0x72, 0xE1, 0xE7, 0x3E, 0x0A, 0xDA,
+    0x73, 0xE0, 0x6A, 0xAA, 0xAA, 0xAA, 0xA9, 0x79, 0xFF, 0x97, 0xAF, 0xF7, 0x77, 0x77, 0x4A, 0xFA,
+    0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7,
+    0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29,
+    0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xEA,
+    0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30, 0x72, 0xA9, 0x49, 0xA7,
+    0x3D, 0x4D, 0x73, 0xEA, 0xAE, 0xA7, 0x39, 0xFD, 0xA7, 0x6A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x1E,
+    0x77, 0x0A, 0xE9, 0x77, 0xF9, 0x76, 0xFC, 0xA7, 0x59, 0xD9, 0xDA, 0x75, 0xE0, 0xE7, 0x49, 0xDA,
+    0x0E, 0x74, 0xE1, 0xAD, 0x73, 0x9D, 0xA1, 0xAD, 0x73, 0xE2, 0xAD, 0x97, 0x1A, 0xD9, 0x29, 0xD9,
+    0x71, 0xE3, 0x9D, 0xA7, 0x0A, 0xD9, 0x4D, 0xA7, 0x0E, 0x5E, 0x7A, 0xFF, 0xF6, 0x9F, 0xFF, 0xC6,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x59, 0xE7, 0xAD, 0x94, 0xE7, 0x0A, 0xD9, 0x39, 0xDA, 0x70, 0x9D,
+    0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xDA, 0x72, 0xE2, 0xE7, 0x3E, 0x1A, 0xDA, 0x73, 0xE1, 0x6A, 0x94,
+    0xAA, 0x79, 0xCA, 0x39, 0xD7, 0x0E, 0xAA, 0xE9, 0x70, 0xAF, 0xDA, 0x72, 0x9A, 0xDA, 0x77, 0x77,
+    0x76, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2, 0xAE, 0x59,
+    0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D,
+    0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4, 0xAF, 0x93,
+    0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x73, 0x74, 0xE7,
+    0x7A, 0xE9, 0x76, 0xF9, 0x75, 0xFC, 0xA7, 0x49, 0xD9, 0xDA, 0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0E,
+    0x73, 0xE1, 0xAD, 0x72, 0x9D, 0xA1, 0xAD, 0x72, 0xE2, 0xAD, 0x97, 0x0A, 0xD9, 0x29, 0xD9, 0x70,
+    0xE3, 0x9D, 0xA7, 0xAD, 0x94, 0xDA, 0x7E, 0x5E, 0x6A, 0xFF, 0xF5, 0x9F, 0xFF, 0xC5, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x49, 0xE7, 0xAD, 0x93, 0xE7, 0x0A, 0xD9, 0x29, 0xDA, 0x70, 0x9D, 0xA2, 0xE7,
+    0x19, 0xDA, 0x1A, 0xDA, 0x72, 0xE1, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xE7, 0x7A, 0xCA, 0x77, 0xDA,
+    0x77, 0xAC, 0xA7, 0x70, 0xD7, 0x71, 0xD7, 0x71, 0xEA, 0x97, 0x69, 0xEA, 0x77, 0x50, 0x77, 0x7A,
+    0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92,
+    0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E,
+    0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19,
+    0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x93, 0xAC, 0xA7, 0x5D, 0xA7,
+    0x5A, 0xCA, 0x76, 0xD7, 0x7D, 0x77, 0xEA, 0x97, 0x49, 0xEA, 0x77, 0x60, 0x76, 0x9A, 0xA9, 0x76,
+    0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xAD, 0x77, 0x9C, 0xA7, 0x77, 0x77, 0x76, 0xAF, 0xE9, 0x70, 0xAF,
+    0xFE, 0x59, 0xFC, 0xAA, 0xAA, 0xE9, 0x49, 0xF9, 0x69, 0x5E, 0xA7, 0x6E, 0xA7, 0x69, 0xE7, 0x7E,
+    0x97, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xAD, 0xA7,
+    0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xF7, 0x79, 0xEA, 0x77, 0xAF, 0xA9,
+    0x99, 0x9A, 0xCA, 0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x49, 0x99, 0x70, 0x72, 0x9A, 0xAA,
+    0x72, 0xE9, 0x71, 0xE9, 0x71, 0xAD, 0x97, 0x19, 0xD9, 0x72, 0xD7, 0x77, 0x77, 0x09, 0xFD, 0xA5,
+    0xFF, 0xC4, 0xFA, 0x99, 0x9A, 0xA3, 0xEA, 0x71, 0xAE, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE7, 0x3E,
+    0x72, 0x9E, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2,
+    0x9A, 0xC4, 0xAF, 0xFC, 0x59, 0xFE, 0x97, 0x09, 0x99, 0x50, 0x73, 0x9A, 0xA7, 0x79, 0xF7, 0x6F,
+    0xC9, 0x74, 0xE0, 0xAD, 0x72, 0x9D, 0xA2, 0xDA, 0x71, 0xD9, 0x4D, 0x77, 0x77, 0x77, 0x2A, 0xFE,
+    0x97, 0x0A, 0xFF, 0xE5, 0x9F, 0xCA, 0xAA, 0xAE, 0x94, 0x9F, 0x96, 0x95, 0xEA, 0x76, 0xEA, 0x76,
+    0x9E, 0x77, 0xE9, 0x76, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x77, 0x0E, 0x77, 0x9E, 0x77, 0xAD, 0xA7,
+    0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0F, 0x77, 0x9E, 0xA7,
+    0x7A, 0xFA, 0x99, 0x99, 0xAC, 0xA7, 0xAF, 0xFD, 0xA7, 0x09, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x00,
+    0x70, 0xAA, 0x97, 0x2F, 0x71, 0xAF, 0xA7, 0xAD, 0x99, 0xD9, 0x5E, 0x2A, 0xD4, 0xAC, 0xA4, 0xAC,
+    0x97, 0x77, 0x73, 0x9F, 0xDA, 0x5F, 0xFC, 0x4F, 0xA9, 0x99, 0xAA, 0x3E, 0xA7, 0x1A, 0xE7, 0x2E,
+    0x72, 0xAD, 0xA7, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x73,
+    0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29, 0xAC, 0x4A, 0xFF, 0xC5, 0x9F, 0xE9, 0x70, 0x99, 0x95, 0x74,
+    0x99, 0x77, 0x0E, 0x97, 0x7E, 0x97, 0x7E, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xE9, 0x70, 0xAF,
+    0xFE, 0x59, 0xFC, 0xAA, 0xAA, 0xE9, 0x49, 0xF9, 0x69, 0x5E, 0xA7, 0x6E, 0xA7, 0x69, 0xE7, 0x7E,
+    0x97, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xAD, 0xA7,
+    0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xF7, 0x79, 0xEA, 0x77, 0xAF, 0xA9,
+    0x99, 0x9A, 0xCA, 0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x49, 0x99, 0x70, 0x70, 0x99, 0x73,
+    0x9D, 0xA7, 0x2A, 0xE7, 0x29, 0xD9, 0x77, 0x77, 0x77, 0x59, 0xFD, 0xA5, 0xFF, 0xC4, 0xFA, 0x99,
+    0x9A, 0xA3, 0xEA, 0x71, 0xAE, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0x9D,
+    0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2, 0x9A, 0xC4, 0xAF, 0xFC,
+    0x59, 0xFE, 0x97, 0x09, 0x99, 0x50, 0x70, 0xAA, 0x59, 0xA7, 0x1A, 0xD3, 0xDA, 0x72, 0xDA, 0x09,
+    0xDA, 0x73, 0x9F, 0xCA, 0x75, 0xFA, 0x76, 0x9D, 0xA7, 0x77, 0x77, 0x75, 0xAF, 0xE9, 0x70, 0xAF,
+    0xFE, 0x59, 0xFC, 0xAA, 0xAA, 0xE9, 0x49, 0xF9, 0x69, 0x5E, 0xA7, 0x6E, 0xA7, 0x69, 0xE7, 0x7E,
+    0x97, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE7, 0x70, 0xE7, 0x79, 0xE7, 0x7A, 0xDA, 0x77, 0xAD, 0xA7,
+    0x7A, 0xDA, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xF7, 0x79, 0xEA, 0x77, 0xAF, 0xA9,
+    0x99, 0x9A, 0xCA, 0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x49, 0x99, 0x70, 0x49, 0xA9, 0x49,
+    0xA9, 0x5D, 0x92, 0xAD, 0x6A, 0xD1, 0xE7, 0x0F, 0xD7, 0x19, 0xF7, 0x3E, 0x77, 0x77, 0x72, 0x9F,
+    0xDA, 0x6F, 0xFC, 0x5F, 0xA9, 0x99, 0xAA, 0x4E, 0xA7, 0x2A, 0xE7, 0x3E, 0x73, 0xAD, 0xA7, 0x3E,
+    0x74, 0xE7, 0x39, 0xE7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x74, 0xE7, 0x4E, 0x97, 0x39,
+    0xEA, 0x29, 0xAC, 0x5A, 0xFF, 0xC6, 0x9F, 0xE9, 0x71, 0x99, 0x96, 0x70, 0x9A, 0x94, 0x9A, 0x97,
+    0x2D, 0x92, 0xAD, 0x73, 0x9D, 0x1E, 0x75, 0xFD, 0x76, 0x9F, 0x77, 0x0A, 0xD9, 0x77, 0x77, 0x77,
+    0x3A, 0xFD, 0xAA, 0x97, 0x2F, 0xFE, 0x97, 0x0F, 0xFF, 0xA6, 0x9D, 0xA4, 0x9F, 0xA5, 0xAD, 0x96,
+    0xAE, 0x5A, 0xD9, 0x7E, 0xA4, 0xE7, 0x09, 0xE4, 0xE7, 0x1E, 0x39, 0xDA, 0x71, 0xE3, 0xAD, 0x97,
+    0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D, 0xA7, 0x19, 0xE2, 0xAD, 0x97, 0x1A,
+    0xDA, 0x2E, 0x72, 0xE3, 0xE7, 0x1A, 0xE2, 0x9D, 0xA7, 0x09, 0xE9, 0x29, 0xD9, 0x70, 0xEA, 0x3A,
+    0xD9, 0x69, 0xF4, 0xE5, 0x9A, 0xF5, 0xEA, 0xAA, 0xAA, 0xFC, 0xA5, 0x9F, 0xFF, 0x96, 0xAF, 0xFA,
+    0x97, 0x10, 0x77, 0x99, 0x92, 0x99, 0x77, 0x0D, 0xA1, 0xAD, 0x77, 0x9D, 0xA1, 0xDA, 0x77, 0xAD,
+    0x90, 0xAD, 0x77, 0x0E, 0x1D, 0x77, 0x1E, 0x0A, 0xC9, 0x77, 0x1D, 0xA7, 0x74, 0x9D, 0x97, 0x4A,
+    0xFA, 0x1A, 0xD7, 0x4F, 0xF0, 0xE7, 0x3F, 0x99, 0x9D, 0xAE, 0x72, 0xEA, 0x4F, 0xA7, 0x1A, 0xE5,
+    0x9E, 0x97, 0x1E, 0x7E, 0x71, 0x9D, 0xA7, 0xE7, 0x1E, 0x97, 0xE7, 0x1E, 0x79, 0xDA, 0x71, 0xE7,
+    0xAD, 0x97, 0x09, 0xDA, 0x7E, 0x71, 0x9D, 0xA6, 0x9E, 0x71, 0x9D, 0xA6, 0xEA, 0x71, 0x9D, 0xA5,
+    0xAE, 0x97, 0x2E, 0x4A, 0xF9, 0x72, 0xF1, 0x9D, 0xAA, 0xD7, 0x39, 0xFE, 0xA0, 0xAD, 0x74, 0x9F,
+    0xC9, 0x1D, 0xA7, 0x79, 0x77, 0x20, 0x4A, 0xFD, 0xAA, 0x97, 0x2F, 0xFE, 0x97, 0x0F, 0xFF, 0xA6,
+    0x9D, 0xA4, 0x9F, 0xA5, 0xAD, 0x96, 0xAE, 0x5A, 0xD9, 0x7E, 0xA4, 0xE7, 0x09, 0xE4, 0xE7, 0x1E,
+    0x39, 0xDA, 0x71, 0xE3, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE0, 0x9F, 0xFD, 0x5E, 0x0A, 0xFF, 0xD5,
+    0xE0, 0x9A, 0xAD, 0xAA, 0xAA, 0xA9, 0x49, 0xE2, 0xAD, 0x97, 0x1A, 0xDA, 0x2E, 0x72, 0xE3, 0xE7,
+    0x1A, 0xE2, 0x9D, 0xA7, 0x09, 0xE9, 0x29, 0xD9, 0x70, 0xEA, 0x3A, 0xD9, 0x69, 0xF4, 0xE5, 0x9A,
+    0xF5, 0xEA, 0xAA, 0xAA, 0xFC, 0xA5, 0x9F, 0xFF, 0x96, 0xAF, 0xFA, 0x97, 0x10, 0x77, 0x99, 0x97,
+    0x71, 0xDA, 0x77, 0x09, 0xDA, 0x73, 0x99, 0x99, 0x9A, 0xDA, 0x97, 0x1F, 0xFE, 0xA7, 0x0F, 0xFE,
+    0x97, 0x59, 0xDA, 0x77, 0x09, 0xD9, 0x70, 0xAF, 0xA1, 0xAD, 0x79, 0xFF, 0x0E, 0x69, 0xF9, 0x99,
+    0xAC, 0xAE, 0x6E, 0xA4, 0xAE, 0xA5, 0xAE, 0x59, 0xE9, 0x5E, 0x7E, 0x59, 0xDA, 0x7E, 0x5E, 0x97,
+    0xE5, 0xE7, 0x9D, 0xA5, 0xE7, 0xAD, 0x94, 0x9D, 0xA7, 0xE5, 0x9D, 0xA6, 0x9E, 0x59, 0xDA, 0x6E,
+    0xA5, 0x9D, 0xA5, 0xAE, 0x96, 0xE4, 0xAF, 0x96, 0xF1, 0x9D, 0xAA, 0xD7, 0x9F, 0xEA, 0x0A, 0xD7,
+    0x09, 0xFC, 0x91, 0xDA, 0x73, 0x97, 0x60, 0x7A, 0xAA, 0xAA, 0xAA, 0xA9, 0x7A, 0xFF, 0x97, 0xAF,
+    0xF7, 0x77, 0x77, 0x2A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A,
+    0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE,
+    0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0x9D, 0x97,
+    0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xEA, 0x40,
+    0x5A, 0xAA, 0xAA, 0xAA, 0xA9, 0x49, 0xFF, 0xA4, 0x9F, 0xF9, 0x77, 0x77, 0x3A, 0xFC, 0xA6, 0xFF,
+    0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D,
+    0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7,
+    0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9,
+    0x70, 0x99, 0x60, 0x69, 0xA9, 0x4A, 0xA7, 0x9C, 0xA3, 0x9D, 0x70, 0xEA, 0xAE, 0x97, 0x0A, 0xFD,
+    0xA7, 0x29, 0xAD, 0xA7, 0x77, 0x77, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75,
+    0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA,
+    0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0x4A,
+    0xFF, 0xEA, 0x40, 0x5A, 0x94, 0x9A, 0x59, 0xD3, 0x9D, 0x6E, 0xAA, 0xE9, 0x69, 0xFD, 0xA7, 0x1A,
+    0xDA, 0x97, 0x77, 0x77, 0x0A, 0xFC, 0xA7, 0xFF, 0xC5, 0xF9, 0x99, 0xE9, 0x3E, 0xA3, 0x9D, 0xA2,
+    0xAD, 0xA4, 0x9D, 0xA2, 0xE5, 0xAD, 0x91, 0x9D, 0xA4, 0x9E, 0x2E, 0x91, 0x9A, 0xF9, 0x2F, 0xFE,
+    0x4F, 0xFA, 0x94, 0x9D, 0xA9, 0x72, 0x9D, 0xA7, 0x39, 0xDA, 0x74, 0xE7, 0x4E, 0x97, 0x39, 0xEA,
+    0x29, 0xAC, 0x94, 0xAF, 0xFC, 0x95, 0x9F, 0xE9, 0x71, 0x99, 0x70, 0x72, 0x9A, 0x76, 0x9E, 0x75,
+    0xAE, 0x75, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA,
+    0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59,
+    0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF,
+    0x4A, 0xFF, 0xEA, 0x40, 0x71, 0xA9, 0x73, 0xE7, 0x29, 0xE7, 0x3D, 0xA7, 0x77, 0x77, 0x75, 0xAF,
+    0xCA, 0x6F, 0xFC, 0x4F, 0x99, 0x9E, 0x92, 0xEA, 0x39, 0xDA, 0x1A, 0xDA, 0x49, 0xDA, 0x1E, 0x5A,
+    0xD9, 0x09, 0xDA, 0x49, 0xE1, 0xE9, 0x19, 0xAF, 0x91, 0xFF, 0xE3, 0xFF, 0xA9, 0x39, 0xDA, 0x97,
+    0x19, 0xDA, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0xA2, 0x9A, 0xC9, 0x3A, 0xFF, 0xC9,
+    0x49, 0xFE, 0x97, 0x09, 0x96, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD,
+    0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75,
+    0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF,
+    0xEA, 0x74, 0x9D, 0x75, 0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0xA7, 0x6D, 0x97, 0x6E, 0xAA, 0x74, 0x9F,
+    0x77, 0x70, 0x77, 0x4A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD,
+    0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F,
+    0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29,
+    0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xEA, 0x70, 0x99, 0xD9, 0x72, 0xD9, 0x72, 0xD9, 0x72, 0x9D,
+    0x73, 0x9D, 0x73, 0x9E, 0xA9, 0x71, 0xAE, 0x97, 0x72, 0x7A, 0x95, 0xA9, 0x7D, 0x92, 0xAD, 0x70,
+    0x9D, 0x1E, 0x72, 0xFD, 0x73, 0x9F, 0x75, 0xAD, 0x97, 0x77, 0x77, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF,
+    0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD,
+    0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97,
+    0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xEA, 0x40, 0x5A, 0x95, 0xAA, 0x5D, 0x92, 0x9D, 0x95, 0x9D,
+    0x90, 0xAD, 0x97, 0xAF, 0xC9, 0x71, 0xF9, 0x72, 0xAD, 0x97, 0x77, 0x77, 0x1A, 0xFC, 0xA7, 0xFF,
+    0xC5, 0xF9, 0x99, 0xE9, 0x3E, 0xA3, 0x9D, 0xA2, 0xAD, 0xA4, 0x9D, 0xA2, 0xE5, 0xAD, 0x91, 0x9D,
+    0xA4, 0x9E, 0x2E, 0x91, 0x9A, 0xF9, 0x2F, 0xFE, 0x4F, 0xFA, 0x94, 0x9D, 0xA9, 0x72, 0x9D, 0xA7,
+    0x39, 0xDA, 0x74, 0xE7, 0x4E, 0x97, 0x39, 0xEA, 0x29, 0xAC, 0x94, 0xAF, 0xFC, 0x95, 0x9F, 0xE9,
+    0x71, 0x99, 0x70, 0x74, 0xAA, 0xA7, 0x70, 0xAE, 0x97, 0x6A, 0xFC, 0x75, 0xAD, 0x90, 0xDA, 0x73,
+    0xAD, 0x91, 0x9D, 0x97, 0x19, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x4A, 0xFE, 0xA9, 0x70, 0xAF,
+    0xFF, 0x59, 0xFC, 0xAA, 0xAA, 0xAE, 0xA4, 0x9F, 0x96, 0x9A, 0x5F, 0x77, 0xF7, 0x79, 0xE7, 0x70,
+    0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x1E, 0x69, 0xAA, 0xAA, 0xAA, 0x91, 0x9E,
+    0x6F, 0xEA, 0x1A, 0xDA, 0x6F, 0xE9, 0x1A, 0xDA, 0x72, 0xE2, 0xAD, 0xA7, 0x2E, 0x2A, 0xDA, 0x72,
+    0xE2, 0x9E, 0x71, 0x9D, 0xA3, 0xE7, 0x1A, 0xD9, 0x3F, 0x70, 0xE4, 0x9E, 0xA7, 0xE5, 0xAF, 0xA9,
+    0x99, 0x9A, 0xEA, 0x6A, 0xFF, 0xF9, 0x70, 0xAF, 0xFA, 0x97, 0x49, 0x99, 0x71, 0x72, 0xAA, 0x97,
+    0x6F, 0x75, 0xAF, 0xC7, 0x3A, 0xD9, 0x9D, 0x97, 0x1A, 0xD2, 0xAD, 0x70, 0xAC, 0xA4, 0xAC, 0x97,
+    0x77, 0x77, 0x6A, 0xFA, 0x2D, 0x59, 0xFF, 0x09, 0xD5, 0xF9, 0x99, 0xAC, 0xAE, 0x4E, 0xA4, 0xFA,
+    0x3A, 0xE5, 0x9E, 0x93, 0xE7, 0xE3, 0x9D, 0xA7, 0xE3, 0xE9, 0x69, 0xE3, 0xE7, 0x9D, 0xA3, 0xE7,
+    0xAD, 0x92, 0x9D, 0xA7, 0xE3, 0x9D, 0xA6, 0x9E, 0x39, 0xDA, 0x6E, 0xA3, 0x9D, 0xA5, 0xAE, 0x94,
+    0xE4, 0xAF, 0x94, 0xF9, 0x09, 0xDA, 0xAD, 0x59, 0xFE, 0xA0, 0xE6, 0x9F, 0xC9, 0x1D, 0xA7, 0x19,
+    0x39, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x6A, 0xDA, 0x5A, 0x69, 0xE6, 0xEA, 0x99, 0xAF, 0x96, 0xFF,
+    0xD9, 0x70, 0xAA, 0xFA, 0x97, 0x00, 0x71, 0xA9, 0x49, 0xA7, 0x29, 0xD3, 0x9D, 0x73, 0xEA, 0xAE,
+    0x97, 0x39, 0xFD, 0xA7, 0x6A, 0xDA, 0x97, 0x77, 0x77, 0x76, 0xAF, 0xEA, 0x97, 0x0A, 0xFF, 0xF5,
+    0x9F, 0xCA, 0xAA, 0xAA, 0xEA, 0x49, 0xF9, 0x69, 0xA5, 0xF7, 0x7F, 0x77, 0x9E, 0x77, 0x0E, 0x97,
+    0x79, 0xE7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71, 0xE6, 0x9A, 0xAA, 0xAA, 0xA9, 0x19, 0xE6, 0xFE,
+    0xA1, 0xAD, 0xA6, 0xFE, 0x91, 0xAD, 0xA7, 0x2E, 0x2A, 0xDA, 0x72, 0xE2, 0xAD, 0xA7, 0x2E, 0x29,
+    0xE7, 0x19, 0xDA, 0x3E, 0x71, 0xAD, 0x93, 0xF7, 0x0E, 0x49, 0xEA, 0x7E, 0x5A, 0xFA, 0x99, 0x99,
+    0xAE, 0xA6, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x10, 0x69, 0xA5, 0xAA, 0x70,
+    0x9C, 0xA3, 0x9C, 0xA7, 0x09, 0xEA, 0xAE, 0x72, 0xAF, 0xD9, 0x73, 0x9A, 0xCA, 0xA7, 0x77, 0x77,
+    0x71, 0xAF, 0xA2, 0xD5, 0x9F, 0xF0, 0x9D, 0x5F, 0x99, 0x9A, 0xCA, 0xE4, 0xEA, 0x4F, 0xA3, 0xAE,
+    0x59, 0xE9, 0x3E, 0x7E, 0x39, 0xDA, 0x7E, 0x3E, 0x96, 0x9E, 0x3E, 0x79, 0xDA, 0x3E, 0x7A, 0xD9,
+    0x29, 0xDA, 0x7E, 0x39, 0xDA, 0x69, 0xE3, 0x9D, 0xA6, 0xEA, 0x39, 0xDA, 0x5A, 0xE9, 0x4E, 0x4A,
+    0xF9, 0x4F, 0x90, 0x9D, 0xAA, 0xD5, 0x9F, 0xEA, 0x0E, 0x69, 0xFC, 0x91, 0xDA, 0x71, 0x93, 0x9D,
+    0x97, 0x6A, 0xD7, 0x7E, 0x76, 0xAD, 0xA5, 0xA6, 0x9E, 0x6E, 0xA9, 0x9A, 0xF9, 0x6F, 0xFD, 0x97,
+    0x0A, 0xAF, 0xA9, 0x70, 0x75, 0xA9, 0x77, 0x1E, 0x77, 0x09, 0xE7, 0x71, 0xDA, 0x77, 0x77, 0x77,
+    0x77, 0x74, 0xAF, 0xEA, 0x97, 0x0A, 0xFF, 0xF5, 0x9F, 0xCA, 0xAA, 0xAA, 0xEA, 0x49, 0xF9, 0x69,
+    0xA5, 0xF7, 0x7F, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71,
+    0xE6, 0x9A, 0xAA, 0xAA, 0xA9, 0x19, 0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFE, 0x91, 0xAD, 0xA7, 0x2E,
+    0x2A, 0xDA, 0x72, 0xE2, 0xAD, 0xA7, 0x2E, 0x29, 0xE7, 0x19, 0xDA, 0x3E, 0x71, 0xAD, 0x93, 0xF7,
+    0x0E, 0x49, 0xEA, 0x7E, 0x5A, 0xFA, 0x99, 0x99, 0xAE, 0xA6, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA9,
+    0x74, 0x99, 0x97, 0x10, 0x72, 0x9A, 0x77, 0x9E, 0x76, 0xAE, 0x76, 0x9D, 0x97, 0x77, 0x77, 0x77,
+    0x74, 0xAF, 0xA2, 0xD5, 0x9F, 0xF0, 0x9D, 0x5F, 0x99, 0x9A, 0xCA, 0xE4, 0xEA, 0x4F, 0xA3, 0xAE,
+    0x59, 0xE9, 0x3E, 0x7E, 0x39, 0xDA, 0x7E, 0x3E, 0x96, 0x9E, 0x3E, 0x79, 0xDA, 0x3E, 0x7A, 0xD9,
+    0x29, 0xDA, 0x7E, 0x39, 0xDA, 0x69, 0xE3, 0x9D, 0xA6, 0xEA, 0x39, 0xDA, 0x5A, 0xE9, 0x4E, 0x4A,
+    0xF9, 0x4F, 0x90, 0x9D, 0xAA, 0xD5, 0x9F, 0xEA, 0x0E, 0x69, 0xFC, 0x91, 0xDA, 0x71, 0x93, 0x9D,
+    0x97, 0x6A, 0xD7, 0x7E, 0x76, 0xAD, 0xA5, 0xA6, 0x9E, 0x6E, 0xA9, 0x9A, 0xF9, 0x6F, 0xFD, 0x97,
+    0x0A, 0xAF, 0xA9, 0x70, 0x77, 0x75, 0xAF, 0xEA, 0x97, 0x0A, 0xFF, 0xF5, 0x9F, 0xCA, 0xAA, 0xAA,
+    0xEA, 0x49, 0xF9, 0x69, 0xA5, 0xF7, 0x7F, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAD,
+    0x97, 0x70, 0xE7, 0x71, 0xE6, 0x9A, 0xAA, 0xAA, 0xA9, 0x19, 0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFE,
+    0x91, 0xAD, 0xA7, 0x2E, 0x2A, 0xDA, 0x72, 0xE2, 0xAD, 0xA7, 0x2E, 0x29, 0xE7, 0x19, 0xDA, 0x3E,
+    0x71, 0xAD, 0x93, 0xF7, 0x0E, 0x49, 0xEA, 0x7E, 0x5A, 0xFA, 0x99, 0x99, 0xAE, 0xA6, 0xAF, 0xFF,
+    0x97, 0x0A, 0xFF, 0xA9, 0x74, 0x99, 0x97, 0x77, 0x75, 0x9D, 0x97, 0x70, 0xE7, 0x70, 0x9D, 0x97,
+    0x70, 0xDA, 0x77, 0x09, 0xD7, 0x72, 0x97, 0x50, 0x74, 0x9A, 0x77, 0x9D, 0x77, 0xD9, 0x76, 0xE7,
+    0x69, 0xD9, 0x76, 0xAD, 0x77, 0x77, 0x77, 0x2A, 0xFA, 0x2D, 0x59, 0xFF, 0x09, 0xD5, 0xF9, 0x99,
+    0xAC, 0xAE, 0x4E, 0xA4, 0xFA, 0x3A, 0xE5, 0x9E, 0x93, 0xE7, 0xE3, 0x9D, 0xA7, 0xE3, 0xE9, 0x69,
+    0xE3, 0xE7, 0x9D, 0xA3, 0xE7, 0xAD, 0x92, 0x9D, 0xA7, 0xE3, 0x9D, 0xA6, 0x9E, 0x39, 0xDA, 0x6E,
+    0xA3, 0x9D, 0xA5, 0xAE, 0x94, 0xE4, 0xAF, 0x94, 0xF9, 0x09, 0xDA, 0xAD, 0x59, 0xFE, 0xA0, 0xE6,
+    0x9F, 0xC9, 0x1D, 0xA7, 0x19, 0x39, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x6A, 0xDA, 0x5A, 0x69, 0xE6,
+    0xEA, 0x99, 0xAF, 0x96, 0xFF, 0xD9, 0x70, 0xAA, 0xFA, 0x97, 0x00, 0x74, 0xAA, 0xA7, 0x71, 0xAE,
+    0x97, 0x7A, 0xFC, 0x76, 0xAD, 0x90, 0xDA, 0x74, 0xAD, 0x91, 0x9D, 0x73, 0x9C, 0xA4, 0x9C, 0xA7,
+    0x77, 0x77, 0x73, 0xAD, 0x97, 0x1D, 0xA4, 0xE7, 0x19, 0xDA, 0x4E, 0x71, 0xAD, 0x93, 0x9D, 0xA7,
+    0x1E, 0x49, 0xD9, 0x71, 0xE4, 0xAD, 0x97, 0x09, 0xDA, 0x4E, 0x71, 0x9D, 0x94, 0xE7, 0x1A, 0xD9,
+    0x39, 0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1E, 0x4A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x4F, 0xFF,
+    0xF9, 0x4F, 0xFF, 0xF4, 0x9D, 0xA7, 0x1E, 0x4A, 0xD9, 0x71, 0xE4, 0xE7, 0x19, 0xDA, 0x4E, 0x71,
+    0xAD, 0x94, 0xDA, 0x71, 0xE4, 0x9D, 0xA7, 0x1E, 0x4A, 0xD9, 0x71, 0xDA, 0x4E, 0x71, 0x9D, 0xA4,
+    0xE7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0x9D, 0x97, 0x1E, 0x40, 0x69, 0xAA, 0x75, 0x9E, 0xA7,
+    0x39, 0xFC, 0x97, 0x19, 0xDA, 0x0E, 0x70, 0x9D, 0xA2, 0xDA, 0x7D, 0x94, 0xD7, 0x77, 0x59, 0x97,
+    0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0xA1,
+    0xAF, 0xA5, 0xAD, 0x99, 0xFE, 0xA4, 0xE9, 0xDA, 0x99, 0xAE, 0x4F, 0xC4, 0xAD, 0x93, 0xF5, 0xAD,
+    0x92, 0x9E, 0x95, 0xAD, 0x92, 0xAE, 0x6E, 0x3E, 0x96, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2,
+    0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2A,
+    0xD9, 0x6A, 0xD9, 0x2A, 0xD7, 0xE3, 0xE7, 0xE2, 0x4A, 0xD7, 0x2D, 0xA7, 0xE7, 0x19, 0xDA, 0x7E,
+    0x71, 0xAD, 0x96, 0x9D, 0xA7, 0x1E, 0x49, 0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xE1, 0xAA, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xA9, 0x4E, 0x71, 0xAD, 0x96, 0x9D, 0xA7, 0x1E, 0x7A, 0xD9,
+    0x71, 0xE7, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x7F, 0xFF, 0xF9, 0x7F, 0xFF, 0xF7, 0x9D, 0xA7,
+    0x1E, 0x7A, 0xD9, 0x71, 0xE7, 0xE7, 0x19, 0xDA, 0x7E, 0x71, 0xAD, 0x96, 0x9D, 0xA7, 0x1E, 0x79,
+    0xD9, 0x71, 0xE7, 0xAD, 0x97, 0x09, 0xDA, 0x7E, 0x71, 0x9D, 0xA7, 0xE7, 0x1A, 0xD9, 0x69, 0xDA,
+    0x71, 0xE7, 0xAD, 0x97, 0x1E, 0x70, 0x69, 0x97, 0x6E, 0x76, 0xE7, 0x39, 0x9A, 0xE9, 0x99, 0x99,
+    0x6F, 0xFE, 0x6F, 0xFD, 0xA7, 0x0E, 0x76, 0xDA, 0x75, 0x9D, 0x91, 0x9E, 0xA9, 0x5A, 0xD1, 0xFE,
+    0x94, 0xE0, 0xEA, 0xAF, 0x4F, 0xC9, 0x3E, 0x93, 0xF9, 0x4A, 0xD9, 0x29, 0xE9, 0x5A, 0xD9, 0x2A,
+    0xE6, 0xE3, 0xE9, 0x6E, 0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD7,
+    0xE3, 0xE7, 0xE3, 0xE7, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2A, 0xD9, 0x6A, 0xD9, 0x2A, 0xD7, 0xE3,
+    0xE7, 0xE2, 0x69, 0x95, 0xA6, 0xFA, 0x2A, 0xC5, 0xFE, 0xAE, 0x5D, 0x19, 0xFC, 0x59, 0xC9, 0x3A,
+    0xAA, 0x77, 0x77, 0x71, 0xAF, 0xE9, 0x7F, 0xF9, 0x71, 0xAD, 0xA9, 0x73, 0xAD, 0x97, 0x4E, 0x75,
+    0xE7, 0x49, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97,
+    0x4E, 0x75, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xDA, 0x74, 0xAD,
+    0xA7, 0x19, 0xFE, 0xA7, 0xAF, 0xF7, 0x39, 0x94, 0x9A, 0x29, 0xFA, 0x2D, 0x2F, 0xEA, 0xD9, 0x1A,
+    0xCA, 0x1A, 0xFC, 0x2A, 0xA4, 0xAA, 0xA7, 0x77, 0x72, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xE7, 0x2E,
+    0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x19, 0xD9, 0x71,
+    0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x71, 0x5A, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x49, 0xFF, 0xA4, 0x9F, 0xF9, 0x77, 0x77, 0x2A, 0xFE, 0x95, 0xFF, 0x97, 0xAD,
+    0xA9, 0x71, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x73,
+    0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72,
+    0xE7, 0x3E, 0x73, 0xDA, 0x72, 0xAD, 0xA7, 0x9F, 0xEA, 0x5A, 0xFF, 0x50, 0x19, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x91, 0xAF, 0xF9, 0x1A, 0xFF, 0x77, 0x74, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xDA,
+    0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x79,
+    0xDA, 0x7A, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0x5A, 0x94, 0x9A, 0x6D, 0x4D, 0x6E, 0xAA, 0xEA, 0x69,
+    0xFD, 0xA7, 0x1A, 0xDA, 0x97, 0x77, 0x77, 0xAF, 0xE9, 0x6F, 0xF9, 0x70, 0xAD, 0xA9, 0x72, 0xAD,
+    0x97, 0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0x9D, 0x97, 0x3A, 0xD7, 0x4E, 0x74, 0xE7, 0x39, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x74,
+    0xDA, 0x73, 0xAD, 0xA7, 0x09, 0xFE, 0xA6, 0xAF, 0xF6, 0x19, 0xA5, 0xAA, 0x2A, 0xCA, 0x39, 0xCA,
+    0x29, 0xEA, 0xAE, 0x4A, 0xFD, 0x95, 0x9A, 0xCA, 0xA7, 0x77, 0x71, 0x9D, 0x97, 0x0A, 0xD9, 0x70,
+    0xE7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x09,
+    0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xD7, 0x1E, 0x70,
+    0x4A, 0xFE, 0x94, 0xFF, 0x96, 0xAD, 0xA9, 0x70, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71,
+    0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0xAD, 0xA6, 0x9F, 0xEA, 0x4A,
+    0xFF, 0x70, 0xAC, 0x97, 0x1D, 0x97, 0x1D, 0x97, 0x19, 0xD7, 0x2A, 0xD7, 0x29, 0xEA, 0x97, 0x0A,
+    0xE9, 0x77, 0x40, 0x79, 0xA7, 0x0E, 0x69, 0xE7, 0xD9, 0x77, 0x77, 0x69, 0xD9, 0x6A, 0xD9, 0x6E,
+    0x7E, 0x7D, 0xA6, 0x9D, 0xA6, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA6, 0x9D, 0x96, 0xAD, 0x96, 0xE7,
+    0xE6, 0x9D, 0xA6, 0xAD, 0x96, 0xAD, 0x7E, 0x79, 0xCA, 0x6A, 0xCA, 0x6A, 0xD7, 0xD9, 0x7D, 0x97,
+    0xEA, 0xA5, 0x9E, 0xA7, 0x70, 0x71, 0xA9, 0x72, 0xE7, 0x19, 0xE7, 0x2D, 0xA7, 0x77, 0x77, 0x70,
+    0xAF, 0xE9, 0x4F, 0xF9, 0x6A, 0xDA, 0x97, 0x0A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xE7,
+    0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2D, 0xA7, 0x1A, 0xDA, 0x69, 0xFE, 0xA4, 0xAF,
+    0xF4, 0x39, 0xD9, 0x3A, 0xD9, 0x3E, 0x4E, 0x4D, 0xA3, 0x9D, 0xA3, 0xAD, 0x93, 0xE4, 0xE3, 0x9D,
+    0xA3, 0x9D, 0x93, 0xAD, 0x93, 0xE4, 0xE3, 0x9D, 0xA3, 0xAD, 0x93, 0xAD, 0x4E, 0x30, 0x4A, 0xFE,
+    0x93, 0xAD, 0x5F, 0xF9, 0x3E, 0x7A, 0xDA, 0x94, 0x9D, 0xA7, 0xAD, 0x95, 0x9D, 0xA7, 0xE6, 0xAD,
+    0x97, 0xE6, 0xE7, 0x9D, 0xA6, 0xE7, 0x9D, 0x95, 0x9D, 0xA7, 0xAD, 0x6A, 0xD9, 0x7E, 0x6A, 0xD7,
+    0x0E, 0x6E, 0x79, 0xDA, 0x6E, 0x7A, 0xD9, 0x59, 0xDA, 0x7E, 0x6A, 0xD9, 0x7E, 0x6E, 0x70, 0xE6,
+    0xE7, 0x9D, 0xA6, 0xE7, 0xAD, 0x95, 0x9D, 0xA7, 0xE6, 0xAD, 0x97, 0xE6, 0xE7, 0x0D, 0xA6, 0xE7,
+    0xAD, 0xA5, 0x9D, 0xA4, 0x9F, 0xEA, 0x3A, 0xD9, 0x4A, 0xFF, 0x3A, 0xD9, 0x77, 0x1E, 0x77, 0x19,
+    0xE7, 0x71, 0xE9, 0x74, 0x99, 0x9A, 0xF7, 0x49, 0xFE, 0x75, 0x9F, 0xCA, 0x77, 0x09, 0x97, 0x30,
+    0x59, 0xA6, 0x99, 0x6E, 0x4A, 0xD9, 0x49, 0xE4, 0xE9, 0x5D, 0x94, 0xAD, 0x77, 0x77, 0x77, 0x72,
+    0x9D, 0x94, 0xAD, 0x5A, 0xD9, 0x4E, 0x5E, 0x5D, 0xA5, 0xE4, 0x9D, 0xA5, 0xDA, 0x4A, 0xD9, 0x49,
+    0xDA, 0x4E, 0x5A, 0xD9, 0x4E, 0x5E, 0x5D, 0xA5, 0xE4, 0x9D, 0x94, 0x9D, 0xA4, 0xAD, 0x59, 0xD9,
+    0x4E, 0x5A, 0xD9, 0x4E, 0x5E, 0x49, 0xDA, 0x5E, 0x4A, 0xD9, 0x49, 0xDA, 0x4A, 0xD5, 0xAD, 0x94,
+    0xE5, 0xAD, 0x5E, 0x5E, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xE9,
+    0x71, 0x9A, 0x9F, 0x72, 0xAF, 0xC7, 0x39, 0xEA, 0x70, 0x74, 0x9A, 0xA7, 0x79, 0xEA, 0x75, 0x9F,
+    0xC9, 0x73, 0x9D, 0xA0, 0xE7, 0x29, 0xDA, 0x2D, 0xA7, 0x1D, 0x94, 0xD7, 0x77, 0x77, 0x74, 0xAD,
+    0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7, 0x79, 0xD9, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77,
+    0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E,
+    0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7,
+    0x7A, 0xD9, 0x77, 0xE9, 0x77, 0xE7, 0x7E, 0xA7, 0x2A, 0x99, 0x9F, 0x73, 0xFE, 0x97, 0x3F, 0xCA,
+    0x76, 0x99, 0x77, 0x72, 0xAA, 0x97, 0x4F, 0x73, 0xAF, 0xC7, 0x1A, 0xD9, 0x9D, 0x97, 0xAD, 0x2A,
+    0xD6, 0xAC, 0xA4, 0xAC, 0x97, 0x77, 0x77, 0x29, 0xD9, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x5D,
+    0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75,
+    0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xDA, 0x74,
+    0xAD, 0x97, 0x4E, 0x74, 0x9D, 0xA7, 0x1A, 0x9A, 0xE9, 0x71, 0xFC, 0xA7, 0x2F, 0x97, 0x20, 0x4A,
+    0xD7, 0x0E, 0x5E, 0x7E, 0x95, 0xE6, 0xE9, 0x59, 0xDA, 0x5E, 0x96, 0xAD, 0x94, 0xE9, 0x7A, 0xD4,
+    0xE9, 0x70, 0xE3, 0xE9, 0x71, 0xE2, 0xE9, 0x71, 0x9D, 0xA1, 0xEA, 0x72, 0xAD, 0x90, 0xEA, 0x73,
+    0xE9, 0xEA, 0x74, 0xFE, 0xA7, 0x4F, 0xF7, 0x39, 0xEA, 0x09, 0xDA, 0x72, 0xAD, 0x92, 0xE7, 0x2E,
+    0x3A, 0xD9, 0x71, 0xE3, 0x9E, 0x70, 0x9D, 0xA4, 0xE9, 0x79, 0xD9, 0x49, 0xDA, 0x7A, 0xD9, 0x5E,
+    0x7E, 0x6A, 0xDA, 0x6E, 0x69, 0xE5, 0x9D, 0xA7, 0xE9, 0x4A, 0xD9, 0x79, 0xE7, 0x77, 0x77, 0x74,
+    0xDA, 0x77, 0x0A, 0xD9, 0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77, 0x1D, 0x77, 0x29, 0x77, 0x59, 0x99,
+    0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x49,
+    0xE4, 0xAD, 0x93, 0x9E, 0x5E, 0x39, 0xE6, 0xE2, 0x9E, 0x7D, 0xA1, 0x9E, 0x79, 0xD9, 0x09, 0xE7,
+    0x0A, 0xD0, 0x9E, 0x71, 0xE0, 0xE7, 0x2F, 0xE7, 0x19, 0xFE, 0xA7, 0x0A, 0xEA, 0x0E, 0x70, 0xAD,
+    0x91, 0xAD, 0xA7, 0xE3, 0xE7, 0xE3, 0xAD, 0x95, 0x9D, 0xA4, 0xE5, 0xAD, 0x94, 0xE9, 0x4E, 0x59,
+    0xE4, 0xE6, 0xE9, 0x77, 0x77, 0x74, 0xE7, 0x59, 0xD9, 0x75, 0xDA, 0x75, 0x9D, 0x76, 0xD7, 0x79,
+    0x74, 0x39, 0xD9, 0x49, 0xE4, 0xAD, 0x93, 0x9E, 0x5E, 0x39, 0xE6, 0xE2, 0x9E, 0x69, 0xDA, 0x19,
+    0xE7, 0x9D, 0x90, 0x9E, 0x70, 0xAD, 0x1E, 0x71, 0xE0, 0xE7, 0x2F, 0xE7, 0x19, 0xFE, 0xA7, 0x0A,
+    0xEA, 0x0E, 0x70, 0xAD, 0x91, 0xAD, 0xA7, 0xE3, 0xE7, 0xE3, 0xAD, 0x95, 0x9D, 0xA4, 0xE5, 0xAD,
+    0x94, 0xE9, 0x4E, 0x59, 0xE4, 0xE6, 0xE9, 0x20, 0x71, 0xAA, 0xA7, 0x1E, 0xA7, 0x0A, 0xDA, 0x70,
+    0x9D, 0xA7, 0x1D, 0xA7, 0x1A, 0xC9, 0x77, 0x77, 0x5A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71,
+    0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2D,
+    0xA7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD9,
+    0x71, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0x0A, 0xFF, 0xEA, 0x00, 0x71, 0xAA,
+    0xA7, 0x1A, 0xE7, 0x09, 0xE7, 0x1E, 0x71, 0xE7, 0x19, 0xCA, 0x77, 0x71, 0x99, 0x72, 0xE7, 0x2E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71,
+    0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x4A,
+    0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xE7, 0x09, 0xDA,
+    0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7,
+    0x09, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF,
+    0xFA, 0xFF, 0xEA, 0x77, 0x76, 0xE7, 0x09, 0xD9, 0x70, 0xDA, 0x70, 0x9D, 0x71, 0xD7, 0x29, 0x70,
+    0x70, 0x99, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7A, 0xD7, 0x0E, 0x70, 0xE7, 0x9D, 0xA7,
+    0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD,
+    0x97, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x77, 0x70, 0xE7, 0x9D,
+    0x97, 0xDA, 0x79, 0xD7, 0x0D, 0x71, 0x97, 0x10, 0x4A, 0xD4, 0x9A, 0xA5, 0xE4, 0xE5, 0xE3, 0x9D,
+    0x59, 0xDA, 0x3D, 0xA5, 0xAD, 0x92, 0x9C, 0xA6, 0xAD, 0x3A, 0xA7, 0xE7, 0x5E, 0x74, 0x9D, 0xA7,
+    0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xDA, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74,
+    0x9D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x39, 0xFF,
+    0xF3, 0xAF, 0xFE, 0xA3, 0x69, 0x92, 0x99, 0x6E, 0x1A, 0xD9, 0x5E, 0x1E, 0x59, 0xDA, 0x09, 0xD6,
+    0xAD, 0x90, 0xD9, 0x6A, 0xD0, 0x9C, 0xA7, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7,
+    0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9,
+    0x72, 0xAD, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x72, 0x4A, 0xD7,
+    0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71,
+    0xAD, 0x97, 0x1E, 0x49, 0x93, 0xE3, 0xAD, 0xA2, 0xDA, 0x3E, 0xA1, 0x9D, 0xA3, 0xAD, 0x2A, 0xD9,
+    0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x09, 0xFF, 0xF0, 0xAF, 0xFE, 0xA0, 0x69, 0x97, 0x0E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD,
+    0x97, 0xAD, 0x70, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE1, 0x99, 0x4D, 0xA0, 0xAD,
+    0xA2, 0x9D, 0x90, 0xEA, 0x2A, 0xD9, 0x09, 0xD3, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7A, 0xD7,
+    0x0E, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0x5A, 0xD7, 0x2E, 0x72, 0xE7, 0x19,
+    0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x09, 0xC6, 0xE9,
+    0xEA, 0x5F, 0xDA, 0x6F, 0xA6, 0x9F, 0x96, 0xFC, 0x96, 0x9F, 0xC7, 0x0A, 0x0E, 0x71, 0x9D, 0xA7,
+    0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xF0, 0xAF,
+    0xFE, 0xA0, 0x69, 0x96, 0xE6, 0xE5, 0x9D, 0xA5, 0xAD, 0x95, 0xAD, 0x6E, 0x6E, 0x59, 0xDA, 0x5A,
+    0xD9, 0x5E, 0x6E, 0xAC, 0x93, 0xFC, 0x92, 0xAF, 0x3A, 0xE9, 0x29, 0xFC, 0x3A, 0xFC, 0x49, 0x9D,
+    0xA5, 0x9D, 0x95, 0xAD, 0x6E, 0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x6E, 0x50, 0x77, 0x9A, 0xA9,
+    0x77, 0x2E, 0x97, 0x71, 0xE9, 0x77, 0x1A, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x2D, 0x77, 0x77, 0x77,
+    0x72, 0xAD, 0xA7, 0x2D, 0xA4, 0xF7, 0x19, 0xD9, 0x4F, 0x97, 0x0A, 0xD9, 0x39, 0xFC, 0x70, 0xE4,
+    0xAF, 0xC7, 0x0E, 0x4E, 0x9D, 0xA7, 0xDA, 0x4D, 0xA0, 0xE6, 0x9D, 0x94, 0xDA, 0x0A, 0xD6, 0xAD,
+    0x49, 0xD9, 0x09, 0xDA, 0x5E, 0x4A, 0xD2, 0xE5, 0xE4, 0xE2, 0xAD, 0x93, 0x9D, 0xA4, 0xE3, 0xDA,
+    0x3A, 0xD9, 0x4D, 0xA3, 0xE3, 0xAD, 0x49, 0xD9, 0x39, 0xD9, 0x2E, 0x4A, 0xD5, 0xE2, 0xDA, 0x4E,
+    0x5A, 0xD1, 0x9D, 0xA4, 0xDA, 0x59, 0xDA, 0x0A, 0xD9, 0x39, 0xDA, 0x6E, 0x0A, 0xD4, 0xAD, 0x96,
+    0xAD, 0x9E, 0x4A, 0xD7, 0x0D, 0xAD, 0xA4, 0xE7, 0x0F, 0xC9, 0x4D, 0xA7, 0x09, 0xF4, 0x9D, 0x97,
+    0x1F, 0x4A, 0xD7, 0x2A, 0xE4, 0x75, 0xAA, 0xA7, 0x5A, 0xE7, 0x49, 0xE7, 0x5E, 0x75, 0xDA, 0x75,
+    0x9C, 0xA7, 0x77, 0x72, 0x99, 0x79, 0xD2, 0xFC, 0xA5, 0xAD, 0x09, 0xFF, 0x4E, 0x9E, 0x99, 0xAE,
+    0x93, 0xFC, 0x93, 0xE9, 0x29, 0xF5, 0xAD, 0xA2, 0xAE, 0x95, 0xAD, 0x92, 0xF6, 0xE9, 0x2E, 0x96,
+    0xE3, 0xE6, 0x9E, 0x29, 0xE6, 0xAD, 0xA2, 0xAD, 0xA6, 0xAD, 0x92, 0xE9, 0x6E, 0x3E, 0x7E, 0x3E,
+    0x69, 0xE2, 0x9D, 0xA6, 0xAD, 0xA2, 0xAD, 0x96, 0xE9, 0x2E, 0x96, 0xE3, 0xE7, 0xE2, 0x4A, 0xDA,
+    0x72, 0xDA, 0x4F, 0x71, 0x9D, 0x94, 0xF9, 0x70, 0xAD, 0x93, 0x9F, 0xC7, 0x0E, 0x4A, 0xFC, 0x70,
+    0xE4, 0xE9, 0xDA, 0x7D, 0xA4, 0xDA, 0x0E, 0x69, 0xD9, 0x4D, 0xA0, 0xAD, 0x6A, 0xD4, 0x9D, 0x90,
+    0x9D, 0xA5, 0xE4, 0xAD, 0x2E, 0x5E, 0x4E, 0x2A, 0xD9, 0x39, 0xDA, 0x4E, 0x3D, 0xA3, 0xAD, 0x94,
+    0xDA, 0x3E, 0x3A, 0xD4, 0x9D, 0x93, 0x9D, 0x92, 0xE4, 0xAD, 0x5E, 0x2D, 0xA4, 0xE5, 0xAD, 0x19,
+    0xDA, 0x4D, 0xA5, 0x9D, 0xA0, 0xAD, 0x93, 0x9D, 0xA6, 0xE0, 0xAD, 0x4A, 0xD9, 0x6A, 0xD9, 0xE4,
+    0xAD, 0x70, 0xDA, 0xDA, 0x4E, 0x70, 0xFC, 0x94, 0xDA, 0x70, 0x9F, 0x49, 0xD9, 0x71, 0xF4, 0xAD,
+    0x72, 0xAE, 0x77, 0x77, 0x77, 0x71, 0x9D, 0x97, 0x72, 0xE7, 0x72, 0x9D, 0x77, 0x3D, 0xA7, 0x72,
+    0x9C, 0xA7, 0x74, 0x97, 0x70, 0x73, 0x99, 0x79, 0xD2, 0xFC, 0xA5, 0xAD, 0x09, 0xFF, 0x4E, 0x9E,
+    0x99, 0xAE, 0x93, 0xFC, 0x93, 0xE9, 0x29, 0xF5, 0xAD, 0xA2, 0xAE, 0x95, 0xAD, 0x92, 0xF6, 0xE9,
+    0x2E, 0x96, 0xE3, 0xE6, 0x9E, 0x29, 0xE6, 0xAD, 0xA2, 0xAD, 0xA6, 0xAD, 0x92, 0xE9, 0x6E, 0x3E,
+    0x7E, 0x3E, 0x69, 0xE2, 0x9D, 0xA6, 0xAD, 0xA2, 0xAD, 0x96, 0xE9, 0x2E, 0x96, 0xE3, 0xE7, 0xE7,
+    0x77, 0x77, 0x4A, 0xD9, 0x75, 0xE7, 0x59, 0xD7, 0x6D, 0x97, 0x59, 0xCA, 0x76, 0x99, 0x73, 0x71,
+    0x9A, 0x59, 0xA9, 0x73, 0x9D, 0x3A, 0xD7, 0x5A, 0xD1, 0xE7, 0x7F, 0xD7, 0x70, 0xAF, 0x77, 0x2E,
+    0x77, 0x77, 0x77, 0x71, 0xAD, 0xA7, 0x2D, 0xA4, 0xF7, 0x19, 0xD9, 0x4F, 0x97, 0x0A, 0xD9, 0x39,
+    0xFC, 0x70, 0xE4, 0xAF, 0xC7, 0x0E, 0x4E, 0x9D, 0xA7, 0xDA, 0x4D, 0xA0, 0xE6, 0x9D, 0x94, 0xDA,
+    0x0A, 0xD6, 0xAD, 0x49, 0xD9, 0x09, 0xDA, 0x5E, 0x4A, 0xD2, 0xE5, 0xE4, 0xE2, 0xAD, 0x93, 0x9D,
+    0xA4, 0xE3, 0xDA, 0x3A, 0xD9, 0x4D, 0xA3, 0xE3, 0xAD, 0x49, 0xD9, 0x39, 0xD9, 0x2E, 0x4A, 0xD5,
+    0xE2, 0xDA, 0x4E, 0x5A, 0xD1, 0x9D, 0xA4, 0xDA, 0x59, 0xDA, 0x0A, 0xD9, 0x39, 0xDA, 0x6E, 0x0A,
+    0xD4, 0xAD, 0x96, 0xAD, 0x9E, 0x4A, 0xD7, 0x0D, 0xAD, 0xA4, 0xE7, 0x0F, 0xC9, 0x4D, 0xA7, 0x09,
+    0xF4, 0x9D, 0x97, 0x1F, 0x4A, 0xD7, 0x2A, 0xE4, 0x7A, 0x95, 0xAA, 0x70, 0xDA, 0x29, 0xD9, 0x71,
+    0xD9, 0x0A, 0xD9, 0x72, 0xAF, 0xC9, 0x74, 0xF9, 0x75, 0x9D, 0xA7, 0x77, 0x73, 0x99, 0x70, 0x9D,
+    0x2F, 0xCA, 0x6A, 0xD0, 0x9F, 0xF5, 0xE9, 0xE9, 0x9A, 0xE9, 0x4F, 0xC9, 0x3E, 0x93, 0x9F, 0x5A,
+    0xDA, 0x3A, 0xE9, 0x5A, 0xD9, 0x3F, 0x6E, 0x93, 0xE9, 0x6E, 0x4E, 0x69, 0xE3, 0x9E, 0x6A, 0xDA,
+    0x3A, 0xDA, 0x6A, 0xD9, 0x3E, 0x96, 0xE4, 0xE7, 0xE4, 0xE6, 0x9E, 0x39, 0xDA, 0x6A, 0xDA, 0x3A,
+    0xD9, 0x6E, 0x93, 0xE9, 0x6E, 0x4E, 0x7E, 0x30, 0x29, 0xDA, 0x77, 0xEA, 0x77, 0xE7, 0x7A, 0xDA,
+    0x77, 0xE7, 0x79, 0xD9, 0x70, 0x95, 0xE1, 0xE1, 0x9F, 0xC9, 0x19, 0xD2, 0xDA, 0x0F, 0xF9, 0x19,
+    0x91, 0x9D, 0xAE, 0xA9, 0x9F, 0x5A, 0xFC, 0x4E, 0x5A, 0xF5, 0xE5, 0xF6, 0xE5, 0xE9, 0x59, 0xE4,
+    0x9E, 0x6A, 0xDA, 0x4A, 0xDA, 0x6A, 0xD9, 0x4E, 0x96, 0xE5, 0xE7, 0xE5, 0xE6, 0x9E, 0x49, 0xDA,
+    0x6A, 0xDA, 0x4A, 0xDA, 0x6E, 0x94, 0xE9, 0x6E, 0x5E, 0x7E, 0x49, 0xE6, 0x9D, 0xA4, 0xAD, 0xA6,
+    0xAD, 0xA2, 0x4A, 0xDA, 0x72, 0xDA, 0x4F, 0x71, 0x9D, 0x94, 0xF9, 0x70, 0xAD, 0x93, 0x9F, 0xC7,
+    0x0E, 0x4A, 0xFC, 0x70, 0xE4, 0xE9, 0xDA, 0x69, 0xDA, 0x4D, 0xA0, 0xE6, 0x9D, 0x94, 0xDA, 0x0A,
+    0xD9, 0x5A, 0xD4, 0x9D, 0x91, 0xDA, 0x5E, 0x4A, 0xD2, 0xE5, 0xE4, 0xE2, 0x9D, 0x93, 0x9D, 0xA4,
+    0xE3, 0xE3, 0xAD, 0x94, 0xDA, 0x3A, 0xD3, 0xE4, 0x9D, 0x93, 0x9D, 0xA2, 0xE4, 0xAD, 0x5E, 0x2D,
+    0xA4, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0xDA, 0x6D, 0xA0, 0xAD, 0x93, 0x9D, 0xA6, 0xAD, 0x0A, 0xD4,
+    0xAD, 0x96, 0x9D, 0x9E, 0x4A, 0xD7, 0x0F, 0xCA, 0x4E, 0x70, 0xAF, 0x94, 0xDA, 0x71, 0xF4, 0x9D,
+    0x97, 0x1F, 0x4A, 0xD7, 0x29, 0xE7, 0x72, 0x9D, 0xA7, 0x72, 0xAD, 0x97, 0x71, 0x9E, 0x75, 0x99,
+    0x99, 0xAE, 0x97, 0x5F, 0xE9, 0x76, 0xFD, 0x97, 0x71, 0x99, 0x72, 0x77, 0x59, 0xD2, 0xAF, 0xA5,
+    0xAD, 0x09, 0xFE, 0xA4, 0xE9, 0xDA, 0x99, 0xAE, 0x4F, 0xC4, 0xAD, 0x93, 0xF5, 0xAD, 0x92, 0x9E,
+    0x95, 0xAD, 0x92, 0xAE, 0x6E, 0x3E, 0x96, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96,
+    0xAD, 0x92, 0xAD, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xDA, 0x2A, 0xD9, 0x6A,
+    0xD9, 0x2A, 0xD7, 0xE3, 0xE7, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x5A, 0xDA,
+    0x72, 0xA9, 0xAE, 0x72, 0x9F, 0xC9, 0x73, 0xF9, 0x50, 0x70, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x72,
+    0xAF, 0xF9, 0x72, 0xAF, 0xF7, 0x77, 0x77, 0x74, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA,
+    0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7,
+    0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74,
+    0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0,
+    0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9,
+    0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x5A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x7F, 0xFC, 0x69, 0xFF, 0xA7, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x9F, 0xFC,
+    0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E,
+    0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90,
+    0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC,
+    0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x70, 0x9A, 0x5A, 0xA7, 0x2A, 0xCA, 0x39, 0xCA, 0x72, 0x9E,
+    0xAA, 0xE7, 0x4A, 0xFD, 0x97, 0x59, 0xAC, 0xAA, 0x77, 0x77, 0x77, 0x69, 0xFD, 0xA9, 0x71, 0x9F,
+    0xFD, 0xA7, 0xAF, 0xAA, 0x9A, 0xFC, 0x5A, 0xEA, 0x59, 0xEA, 0x39, 0xE9, 0x79, 0xE3, 0xE9, 0x71,
+    0xE9, 0x1A, 0xDA, 0x72, 0xAD, 0xA1, 0xE7, 0x39, 0xE0, 0xAD, 0xA7, 0x4E, 0x0E, 0x97, 0x4E, 0x0E,
+    0x75, 0xE9, 0xE7, 0x49, 0xE9, 0xDA, 0x74, 0x9E, 0xAD, 0xA7, 0x4A, 0xDA, 0xAD, 0xA7, 0x4E, 0x9A,
+    0xDA, 0x73, 0x9E, 0x0A, 0xDA, 0x73, 0xAE, 0x09, 0xE7, 0x3E, 0x91, 0xE7, 0x2F, 0x2F, 0x70, 0xAE,
+    0x39, 0xEA, 0x6F, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0xA6, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69,
+    0x99, 0x71, 0x5A, 0xA4, 0x9A, 0x96, 0xD4, 0xD7, 0xEA, 0xAA, 0xDA, 0x70, 0xFE, 0x72, 0xAD, 0xA9,
+    0x77, 0x77, 0x73, 0x9F, 0xCA, 0x79, 0xFF, 0xC5, 0x9F, 0x99, 0x9F, 0x4E, 0xA4, 0xAD, 0xA2, 0xAD,
+    0xA6, 0xE2, 0xE7, 0xE1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0x70, 0xE0, 0x9D, 0xA7, 0x0E, 0x09,
+    0xDA, 0x79, 0xDA, 0x09, 0xDA, 0x7A, 0xD9, 0x09, 0xDA, 0x7E, 0x2E, 0x6A, 0xDA, 0x2E, 0x94, 0x9E,
+    0x39, 0xEA, 0x90, 0x9A, 0xE9, 0x4A, 0xFF, 0xC9, 0x69, 0xFD, 0xA7, 0x49, 0x70, 0x74, 0x9A, 0xA2,
+    0xAA, 0xA7, 0x49, 0xE1, 0xAD, 0x97, 0x4E, 0x19, 0xDA, 0x74, 0xAD, 0x2D, 0xA7, 0x4A, 0xD2, 0xD9,
+    0x75, 0xCA, 0x29, 0xC9, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xDA, 0x97, 0x39, 0xFF, 0xDA, 0x71, 0xAF,
+    0xAA, 0x9A, 0xFC, 0x7A, 0xEA, 0x59, 0xEA, 0x59, 0xE9, 0x79, 0xE5, 0xE9, 0x71, 0xE9, 0x3A, 0xDA,
+    0x72, 0xAD, 0xA3, 0xE7, 0x39, 0xE2, 0xAD, 0xA7, 0x4E, 0x2E, 0x97, 0x4E, 0x2E, 0x75, 0xE1, 0x9E,
+    0x74, 0x9E, 0x19, 0xDA, 0x74, 0x9E, 0x1A, 0xDA, 0x74, 0xAD, 0xA1, 0xAD, 0xA7, 0x4E, 0x91, 0xAD,
+    0xA7, 0x39, 0xE2, 0xAD, 0xA7, 0x3A, 0xE2, 0x9E, 0x73, 0xE9, 0x3E, 0x72, 0xF4, 0xF7, 0x0A, 0xE5,
+    0x9E, 0xA6, 0xF9, 0x6A, 0xFA, 0x99, 0x9A, 0xFA, 0x70, 0xAF, 0xFE, 0x97, 0x3A, 0xFE, 0x97, 0x70,
+    0x99, 0x97, 0x30, 0x71, 0xAA, 0xA1, 0x9A, 0xA9, 0x70, 0xAD, 0x91, 0xE7, 0x09, 0xD9, 0x1E, 0x71,
+    0xD9, 0x1A, 0xD7, 0x1D, 0x91, 0x9D, 0x71, 0xAC, 0x92, 0xCA, 0x77, 0x77, 0x77, 0x09, 0xFC, 0xA7,
+    0x19, 0xFF, 0xC7, 0x9F, 0x99, 0x9F, 0x6E, 0xA4, 0xAD, 0xA4, 0xAD, 0xA6, 0xE4, 0xE7, 0xE3, 0xAD,
+    0x97, 0xE3, 0xE7, 0x0E, 0x3E, 0x70, 0xE2, 0x9D, 0xA7, 0x0E, 0x29, 0xDA, 0x79, 0xDA, 0x29, 0xDA,
+    0x7A, 0xD9, 0x29, 0xDA, 0x7E, 0x4E, 0x6A, 0xDA, 0x4E, 0x94, 0x9E, 0x59, 0xEA, 0x90, 0x9A, 0xE9,
+    0x6A, 0xFF, 0xC9, 0x70, 0x9F, 0xDA, 0x76, 0x97, 0x20, 0x77, 0x77, 0x39, 0xFF, 0xFF, 0xDA, 0x59,
+    0xFF, 0xFF, 0xFA, 0x4A, 0xFA, 0xA9, 0xAA, 0xFF, 0xF9, 0x3A, 0xEA, 0x5E, 0x74, 0x9E, 0x96, 0xE7,
+    0x4E, 0x96, 0x9D, 0xA7, 0x3A, 0xDA, 0x79, 0xDA, 0x73, 0xE7, 0x0A, 0xD9, 0x72, 0xAD, 0xA7, 0x0E,
+    0x73, 0xE9, 0x70, 0xE7, 0x3E, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0x29, 0xE7, 0x0A, 0xFF, 0xE2,
+    0x9D, 0xA7, 0x0F, 0xFE, 0xA2, 0xAD, 0xA7, 0x0E, 0x73, 0xAD, 0xA7, 0x0E, 0x73, 0xAD, 0xA7, 0x9D,
+    0xA7, 0x3A, 0xDA, 0x7A, 0xD9, 0x73, 0x9E, 0x7E, 0x75, 0xE7, 0xE7, 0x5F, 0x6E, 0x75, 0x9E, 0xA4,
+    0x9D, 0xA7, 0x6A, 0xFA, 0x99, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0x96, 0xAF, 0xFF, 0xFE, 0x97, 0x0A,
+    0xFF, 0xFF, 0xC7, 0x49, 0x97, 0x71, 0x77, 0x77, 0x09, 0xFC, 0xA4, 0x9F, 0xCA, 0x6F, 0xFC, 0x2A,
+    0xFF, 0x4F, 0x99, 0x9F, 0x0A, 0xE9, 0x99, 0xEA, 0x2E, 0xA4, 0xAF, 0xCA, 0x4E, 0x1A, 0xDA, 0x6F,
+    0xC5, 0xE1, 0xE7, 0xF5, 0x9D, 0xA0, 0xAD, 0x97, 0xEA, 0x49, 0xE1, 0xE7, 0x0E, 0x91, 0x9A, 0xFA,
+    0x1E, 0x70, 0xFF, 0xE9, 0x19, 0xDA, 0x70, 0xFF, 0xA9, 0x39, 0xDA, 0x70, 0xE9, 0x71, 0x9D, 0xA7,
+    0xAE, 0x72, 0x9D, 0xA7, 0xF7, 0x3E, 0x6A, 0xF7, 0x3E, 0x94, 0x9F, 0xCA, 0x72, 0x9E, 0xA9, 0x09,
+    0xAE, 0x0E, 0xA9, 0x19, 0xAC, 0xA3, 0xAF, 0xFC, 0x19, 0xFF, 0xCA, 0x49, 0xFD, 0x93, 0x9F, 0xEA,
+    0x77, 0x49, 0x99, 0x50, 0x75, 0xAA, 0xA9, 0x74, 0xAE, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x59, 0xCA,
+    0x77, 0x77, 0x75, 0xAF, 0xDA, 0x97, 0x0F, 0xFD, 0xA6, 0xFF, 0xF4, 0x9D, 0xA4, 0x9E, 0x93, 0xAD,
+    0x95, 0xAE, 0x3A, 0xD9, 0x6E, 0x3E, 0x7E, 0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x2A, 0xD9, 0x6E,
+    0x92, 0xE6, 0xEA, 0x3E, 0x99, 0x99, 0xAF, 0xC4, 0xFF, 0xEA, 0x49, 0xFF, 0xC9, 0x6A, 0xD9, 0x2A,
+    0xD9, 0x6E, 0x4E, 0x6E, 0x4E, 0x59, 0xDA, 0x4A, 0xDA, 0x49, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E, 0x93,
+    0xE6, 0xAD, 0xA3, 0xE7, 0xE2, 0x9D, 0xA7, 0xE9, 0x1A, 0xD9, 0x79, 0xE1, 0x73, 0xAA, 0xA7, 0x3A,
+    0xE7, 0x29, 0xE7, 0x3E, 0x73, 0xDA, 0x73, 0x9C, 0xA7, 0x77, 0x77, 0x09, 0xD1, 0x9F, 0x5A, 0xD0,
+    0x9F, 0xC5, 0xE9, 0xDA, 0xAA, 0x95, 0xFC, 0x97, 0x1F, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x3E, 0x97,
+    0x3E, 0x73, 0x9D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9,
+    0x73, 0xAD, 0x74, 0xE7, 0x30, 0x4A, 0xFD, 0xA9, 0x70, 0xFF, 0xDA, 0x6F, 0xFF, 0x49, 0xDA, 0x49,
+    0xE9, 0x3A, 0xD9, 0x5A, 0xE3, 0xAD, 0x96, 0xE3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2,
+    0xAD, 0x96, 0xE9, 0x2E, 0x6E, 0xA3, 0xE9, 0x99, 0x9A, 0xFC, 0x4F, 0xFE, 0xA4, 0x9F, 0xFC, 0x96,
+    0xAD, 0x92, 0xAD, 0x96, 0xE4, 0xE6, 0xE4, 0xE5, 0x9D, 0xA4, 0xAD, 0xA4, 0x9D, 0x95, 0xE4, 0xAD,
+    0x95, 0xE9, 0x3E, 0x6A, 0xDA, 0x3E, 0x7E, 0x29, 0xDA, 0x7E, 0x91, 0xAD, 0x97, 0x9E, 0x77, 0x77,
+    0x73, 0xE7, 0x59, 0xD9, 0x75, 0xDA, 0x75, 0x9D, 0x76, 0xD7, 0x79, 0x74, 0x77, 0x69, 0xD1, 0x9F,
+    0x6A, 0xD0, 0x9F, 0xC6, 0xE9, 0xDA, 0xAA, 0x96, 0xFC, 0x97, 0x2F, 0x73, 0x9E, 0x97, 0x3A, 0xE7,
+    0x4E, 0x97, 0x4E, 0x74, 0x9D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x74, 0x9D, 0xA7,
+    0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x77, 0x77, 0x7E, 0x74, 0x9D, 0x97, 0x4E, 0x74, 0x9D, 0x75,
+    0xD9, 0x75, 0x99, 0x75, 0x7A, 0x95, 0x9A, 0x70, 0xAC, 0xA2, 0x9D, 0xA7, 0x1D, 0xA0, 0x9D, 0xA7,
+    0x29, 0xFC, 0xA7, 0x4F, 0xA7, 0x59, 0xDA, 0x77, 0x77, 0x77, 0xAF, 0xDA, 0x97, 0x1F, 0xFD, 0xA7,
+    0xFF, 0xF5, 0x9D, 0xA4, 0x9E, 0x94, 0xAD, 0x95, 0xAE, 0x4A, 0xD9, 0x6E, 0x4E, 0x7E, 0x4E, 0x7E,
+    0x39, 0xDA, 0x69, 0xDA, 0x3A, 0xD9, 0x6E, 0x93, 0xE6, 0xEA, 0x4E, 0x99, 0x99, 0xAF, 0xC5, 0xFF,
+    0xEA, 0x59, 0xFF, 0xC9, 0x7A, 0xD9, 0x2A, 0xD9, 0x7E, 0x4E, 0x7E, 0x4E, 0x69, 0xDA, 0x4A, 0xDA,
+    0x59, 0xD9, 0x5E, 0x5A, 0xD9, 0x5E, 0x94, 0xE6, 0xAD, 0xA4, 0xE7, 0xE3, 0x9D, 0xA7, 0xE9, 0x2A,
+    0xD9, 0x79, 0xE2, 0x5A, 0x95, 0xAA, 0x6D, 0xA2, 0x9D, 0x97, 0xD9, 0x0A, 0xD9, 0x70, 0xAF, 0xC9,
+    0x72, 0xF9, 0x73, 0xAD, 0xA7, 0x77, 0x77, 0x29, 0xD1, 0x9F, 0x6A, 0xD0, 0x9F, 0xC6, 0xE9, 0xDA,
+    0xAA, 0x96, 0xFC, 0x97, 0x2F, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4E, 0x97, 0x4E, 0x74, 0x9D, 0xA7,
+    0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xAD, 0x75, 0xE7,
+    0x40, 0x75, 0xAA, 0xA7, 0x5E, 0x97, 0x4A, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xD9, 0x75, 0xAC, 0x97,
+    0x77, 0x77, 0x79, 0xAF, 0xD9, 0x7F, 0xFE, 0x5F, 0xCA, 0xAA, 0xEA, 0x4A, 0xE6, 0x99, 0x4E, 0x75,
+    0x9E, 0x75, 0x9D, 0xA7, 0x59, 0xE7, 0x59, 0xE7, 0x6F, 0x97, 0x5F, 0xA7, 0x5F, 0xC9, 0x74, 0xAF,
+    0xA7, 0x49, 0xFA, 0x75, 0xAE, 0x97, 0x5E, 0xA7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5E, 0xA3,
+    0x97, 0xAE, 0x39, 0xDA, 0x99, 0x99, 0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFA, 0x72, 0x99, 0x99,
+    0x71, 0x72, 0xAA, 0xA9, 0x71, 0xAE, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x29, 0xCA, 0x77, 0x77, 0x7A,
+    0xFD, 0x94, 0x9F, 0xFC, 0xA3, 0xEA, 0x99, 0x9A, 0xD3, 0xAD, 0xA7, 0x2A, 0xD7, 0x3A, 0xD9, 0x72,
+    0x9E, 0x73, 0xFA, 0x72, 0xFC, 0x97, 0x1A, 0xFA, 0x72, 0xAE, 0x97, 0x2A, 0xE7, 0x3E, 0x73, 0xE7,
+    0x29, 0xE2, 0xD9, 0x3A, 0xE9, 0x2F, 0xFD, 0xA3, 0x9F, 0xF9, 0x70, 0x99, 0x97, 0x72, 0xAA, 0x97,
+    0x5F, 0x97, 0x3A, 0xFC, 0x72, 0xAD, 0x99, 0xD9, 0x70, 0xAD, 0x29, 0xD7, 0x9C, 0xA4, 0xAC, 0x97,
+    0x77, 0x77, 0x39, 0xAF, 0xD9, 0x7F, 0xFE, 0x5F, 0xCA, 0xAA, 0xEA, 0x4A, 0xE6, 0x99, 0x4E, 0x75,
+    0x9E, 0x75, 0x9D, 0xA7, 0x59, 0xE7, 0x59, 0xE7, 0x6F, 0x97, 0x5F, 0xA7, 0x5F, 0xC9, 0x74, 0xAF,
+    0xA7, 0x49, 0xFA, 0x75, 0xAE, 0x97, 0x5E, 0xA7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x5E, 0xA3,
+    0x97, 0xAE, 0x39, 0xDA, 0x99, 0x99, 0xAF, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xFA, 0x72, 0x99, 0x99,
+    0x71, 0x79, 0xAA, 0x72, 0x9E, 0xA7, 0x09, 0xFC, 0x96, 0x9D, 0xA0, 0xE5, 0x9D, 0xA2, 0xDA, 0x4D,
+    0x94, 0xD7, 0x77, 0x73, 0xAF, 0xD9, 0x49, 0xFF, 0xCA, 0x3E, 0xA9, 0x99, 0xAD, 0x3A, 0xDA, 0x72,
+    0xAD, 0x73, 0xAD, 0x97, 0x29, 0xE7, 0x3F, 0xA7, 0x2F, 0xC9, 0x71, 0xAF, 0xA7, 0x2A, 0xE9, 0x72,
+    0xAE, 0x73, 0xE7, 0x3E, 0x72, 0x9E, 0x2D, 0x93, 0xAE, 0x92, 0xFF, 0xDA, 0x39, 0xFF, 0x97, 0x09,
+    0x99, 0x70, 0x77, 0x70, 0x9A, 0xFD, 0x97, 0xFF, 0xE5, 0xFC, 0xAA, 0xAE, 0xA4, 0xAE, 0x69, 0x94,
+    0xE7, 0x59, 0xE7, 0x59, 0xDA, 0x75, 0x9E, 0x75, 0x9E, 0x76, 0xF9, 0x75, 0xFA, 0x75, 0xFC, 0x97,
+    0x4A, 0xFA, 0x74, 0x9F, 0xA7, 0x5A, 0xE9, 0x75, 0xEA, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75,
+    0xEA, 0x39, 0x7A, 0xE3, 0x9D, 0xA9, 0x99, 0x9A, 0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0xA7, 0x29,
+    0xAC, 0xA7, 0x6D, 0x76, 0x9E, 0x77, 0xE7, 0x69, 0xD7, 0x6E, 0x72, 0x9F, 0xC9, 0x72, 0x9E, 0xA7,
+    0x20, 0x77, 0x2A, 0xFD, 0x93, 0x9F, 0xFC, 0xA2, 0xEA, 0x99, 0x9A, 0xD2, 0xAD, 0xA7, 0x1A, 0xD7,
+    0x2A, 0xD9, 0x71, 0x9E, 0x72, 0xFA, 0x71, 0xFC, 0x97, 0x0A, 0xFA, 0x71, 0xAE, 0x97, 0x1A, 0xE7,
+    0x2E, 0x72, 0xE7, 0x19, 0xE1, 0xD9, 0x3A, 0xE9, 0x1F, 0xFD, 0xA2, 0x9F, 0xF9, 0x7A, 0xC9, 0x72,
+    0xD7, 0x2A, 0xDA, 0x72, 0x9D, 0xA7, 0x2A, 0xCA, 0x72, 0xDA, 0x69, 0xFC, 0x7A, 0xEA, 0x70, 0x69,
+    0xA9, 0x49, 0xA9, 0x7D, 0x92, 0xAD, 0x70, 0xAD, 0x1E, 0x72, 0xFD, 0x73, 0x9F, 0x75, 0xE9, 0x77,
+    0x77, 0x76, 0x9A, 0xFD, 0x97, 0xFF, 0xE5, 0xFC, 0xAA, 0xAE, 0xA4, 0xAE, 0x69, 0x94, 0xE7, 0x59,
+    0xE7, 0x59, 0xDA, 0x75, 0x9E, 0x75, 0x9E, 0x76, 0xF9, 0x75, 0xFA, 0x75, 0xFC, 0x97, 0x4A, 0xFA,
+    0x74, 0x9F, 0xA7, 0x5A, 0xE9, 0x75, 0xEA, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0xEA, 0x39,
+    0x7A, 0xE3, 0x9D, 0xA9, 0x99, 0x9A, 0xF9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0xA7, 0x29, 0x99, 0x97,
+    0x10, 0x4A, 0x95, 0x9A, 0x5A, 0xCA, 0x29, 0xDA, 0x6D, 0xA0, 0x9D, 0xA7, 0x9F, 0xCA, 0x71, 0xFA,
+    0x72, 0x9D, 0xA7, 0x77, 0x77, 0x1A, 0xFD, 0x95, 0x9F, 0xFC, 0xA4, 0xEA, 0x99, 0x9A, 0xD4, 0xAD,
+    0xA7, 0x3A, 0xD7, 0x4A, 0xD9, 0x73, 0x9E, 0x74, 0xFA, 0x73, 0xFC, 0x97, 0x2A, 0xFA, 0x73, 0xAE,
+    0x97, 0x3A, 0xE7, 0x4E, 0x74, 0xE7, 0x39, 0xE3, 0xD9, 0x3A, 0xE9, 0x3F, 0xFD, 0xA4, 0x9F, 0xF9,
+    0x71, 0x99, 0x97, 0x00, 0x09, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xE9, 0x0F, 0xFF, 0xF7, 0xAD, 0x97,
+    0x5E, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A,
+    0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6E,
+    0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x69, 0xCA, 0x76, 0xD7, 0x69, 0xE7, 0x7E, 0x76, 0xAD,
+    0x76, 0xE7, 0x29, 0xFC, 0x73, 0x9E, 0xA7, 0x40, 0x49, 0xC9, 0x70, 0xD7, 0x0A, 0xD7, 0x0E, 0x59,
+    0xAF, 0xF0, 0x9F, 0xFD, 0x19, 0x9E, 0x99, 0x99, 0x93, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E,
+    0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x91, 0x94, 0xAF,
+    0xD5, 0xAF, 0xC6, 0xD9, 0x7A, 0xC9, 0x70, 0xE9, 0x70, 0xAD, 0x71, 0xD9, 0x7A, 0xD5, 0xFC, 0xA5,
+    0xEA, 0x96, 0x4A, 0x95, 0xAA, 0x6D, 0xA2, 0x9D, 0x96, 0x9D, 0x90, 0xAD, 0x97, 0x0A, 0xFC, 0x97,
+    0x2F, 0x97, 0x3A, 0xD9, 0x77, 0x77, 0x79, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x9F, 0xFF, 0xF6, 0xAD,
+    0x97, 0x4E, 0x75, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7,
+    0x4A, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x30, 0x72, 0x99, 0x72, 0x9D, 0x97, 0x1E, 0x71,
+    0x9D, 0x95, 0x9C, 0x90, 0xDA, 0x6D, 0x09, 0xCA, 0x6A, 0xD7, 0x2E, 0x79, 0xAF, 0xF2, 0x9F, 0xFD,
+    0x39, 0x9E, 0x99, 0x99, 0x95, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71,
+    0x9D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72, 0xE9, 0x19, 0x6A, 0xFD,
+    0x7A, 0xFC, 0x71, 0x99, 0x70, 0x09, 0xFF, 0xFE, 0x90, 0xAF, 0xFF, 0xE9, 0x0F, 0xFF, 0xF7, 0xAD,
+    0x97, 0x5E, 0x76, 0xE7, 0x59, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x72, 0x99, 0x99, 0xE9,
+    0x99, 0x95, 0xFF, 0xF9, 0x4F, 0xFF, 0x71, 0xE9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9,
+    0x75, 0xE7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x73, 0x59, 0xC9, 0x71, 0xD7,
+    0x1A, 0xD7, 0x1E, 0x69, 0xAF, 0xF1, 0x9F, 0xFD, 0x29, 0x9E, 0x99, 0x99, 0x94, 0xE7, 0x1D, 0xA7,
+    0x09, 0xDA, 0x6A, 0xAE, 0xAA, 0xAA, 0x3F, 0xFC, 0x3A, 0xAE, 0xAA, 0xAA, 0x49, 0xDA, 0x70, 0x9D,
+    0x97, 0x0A, 0xD9, 0x70, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x91, 0x95, 0xAF, 0xD6, 0xAF, 0xC7, 0x09,
+    0x95, 0x71, 0x99, 0x5A, 0x72, 0xFA, 0x2D, 0x71, 0xFE, 0xAD, 0xA7, 0x09, 0xCA, 0x1A, 0xFC, 0x71,
+    0x9C, 0x4A, 0xCA, 0x77, 0x77, 0x77, 0x1E, 0x72, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0x9D,
+    0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xDA, 0x29, 0xDA, 0x71, 0x9D,
+    0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72, 0xE3, 0xE7, 0x19, 0xDA, 0x29, 0xDA,
+    0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E, 0x4E, 0x70, 0xE9, 0x4E, 0xA6, 0xF5,
+    0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97, 0x69, 0x97, 0x30, 0x79, 0x95, 0xA7,
+    0xFA, 0x2A, 0xC6, 0xFE, 0xAE, 0x6D, 0x19, 0xFC, 0x69, 0xC9, 0x3A, 0xAA, 0x77, 0x77, 0x71, 0x9D,
+    0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2A, 0xD9, 0x6A,
+    0xD3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x96, 0xE3,
+    0xE6, 0x9E, 0x3E, 0x6E, 0xA3, 0xE5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xEA, 0x19, 0xDA, 0xAD, 0x49,
+    0xFE, 0xA0, 0xAD, 0x5A, 0xFC, 0x91, 0xDA, 0x79, 0x97, 0x30, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0x97,
+    0x29, 0xFF, 0xA7, 0x29, 0xFF, 0x97, 0x77, 0x77, 0x70, 0xE7, 0x2D, 0xA3, 0xE7, 0x19, 0xDA, 0x29,
+    0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1A, 0xD3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D, 0xA7, 0x19,
+    0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2D, 0xA2, 0x9D,
+    0xA7, 0x19, 0xDA, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0xAD, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x71, 0x9D,
+    0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x29, 0xDA, 0x71, 0xE3, 0x9D, 0xA7, 0x09, 0xE4, 0xE7, 0x0E, 0x94,
+    0xEA, 0x6F, 0x59, 0xF9, 0x99, 0x9A, 0xF7, 0xAF, 0xFE, 0x71, 0x9F, 0xF9, 0x76, 0x99, 0x73, 0x6A,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x79, 0xFF, 0xA7, 0x9F, 0xF9, 0x77, 0x77, 0x70, 0x9D, 0x96, 0xAD, 0x3E,
+    0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69, 0xD9, 0x2A, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3,
+    0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD, 0x92, 0xAD, 0x96, 0xE3, 0xE6, 0x9E, 0x3E,
+    0x6E, 0xA3, 0xE5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xEA, 0x19, 0xDA, 0xAD, 0x49, 0xFE, 0xA0, 0xAD,
+    0x5A, 0xFC, 0x91, 0xDA, 0x79, 0x97, 0x30, 0x70, 0xA9, 0x49, 0xA7, 0x29, 0xD3, 0x9D, 0x73, 0xEA,
+    0xAE, 0x97, 0x39, 0xFD, 0xA7, 0x6A, 0xDA, 0x97, 0x77, 0x77, 0x72, 0xE7, 0x2D, 0xA3, 0xE7, 0x19,
+    0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1A, 0xD3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D,
+    0xA7, 0x19, 0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2D,
+    0xA2, 0x9D, 0xA7, 0x19, 0xDA, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0xAD, 0x72, 0xE3, 0xE7, 0x2E, 0x3E,
+    0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x29, 0xDA, 0x71, 0xE3, 0x9D, 0xA7, 0x09, 0xE4, 0xE7,
+    0x0E, 0x94, 0xEA, 0x6F, 0x59, 0xF9, 0x99, 0x9A, 0xF7, 0xAF, 0xFE, 0x71, 0x9F, 0xF9, 0x76, 0x99,
+    0x73, 0x6A, 0x94, 0x9A, 0x70, 0xD4, 0xD7, 0x0E, 0xAA, 0xEA, 0x70, 0x9F, 0xDA, 0x73, 0xAD, 0xA9,
+    0x77, 0x77, 0x72, 0x9D, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x69,
+    0xD9, 0x2A, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD,
+    0x92, 0xAD, 0x96, 0xE3, 0xE6, 0x9E, 0x3E, 0x6E, 0xA3, 0xE5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xEA,
+    0x19, 0xDA, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x5A, 0xFC, 0x91, 0xDA, 0x79, 0x97, 0x30, 0x77, 0x77,
+    0xF9, 0x76, 0xDA, 0xAD, 0x97, 0x49, 0xC9, 0x2C, 0xA7, 0x49, 0xC9, 0x2D, 0x74, 0x9C, 0xA1, 0x9C,
+    0xA7, 0x5F, 0xD7, 0x79, 0xAC, 0xA7, 0x77, 0x77, 0x73, 0xE7, 0x2D, 0xA3, 0xE7, 0x19, 0xDA, 0x29,
+    0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1A, 0xD3, 0xE7, 0x2E, 0x3E, 0x72, 0xE2, 0x9D, 0xA7, 0x19,
+    0xDA, 0x29, 0xDA, 0x71, 0xAD, 0x92, 0xAD, 0x97, 0x1E, 0x3E, 0x72, 0xE3, 0xE7, 0x2D, 0xA2, 0x9D,
+    0xA7, 0x19, 0xDA, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0xAD, 0x72, 0xE3, 0xE7, 0x2E, 0x3E, 0x71, 0x9D,
+    0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x29, 0xDA, 0x71, 0xE3, 0x9D, 0xA7, 0x09, 0xE4, 0xE7, 0x0E, 0x94,
+    0xEA, 0x6F, 0x59, 0xF9, 0x99, 0x9A, 0xF7, 0xAF, 0xFE, 0x71, 0x9F, 0xF9, 0x76, 0x99, 0x73, 0x77,
+    0x72, 0xF9, 0x73, 0xDA, 0xAD, 0x97, 0x19, 0xCA, 0x2D, 0x71, 0x9C, 0x92, 0xD7, 0x2D, 0x19, 0xCA,
+    0x72, 0xAF, 0xC7, 0x49, 0xAC, 0xA7, 0x77, 0x77, 0x39, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE3,
+    0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x29, 0xDA,
+    0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3, 0xE6, 0xEA, 0x3E, 0x5A,
+    0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0xAF, 0xC9, 0x1D,
+    0xA7, 0x99, 0x73, 0x73, 0x9A, 0xA9, 0x19, 0xAA, 0x74, 0xE1, 0x9D, 0xA7, 0x3A, 0xD2, 0xE7, 0x39,
+    0xD2, 0xE7, 0x39, 0xD2, 0xAC, 0xA7, 0x4C, 0xA2, 0x9C, 0xA7, 0x77, 0x77, 0x74, 0xE7, 0x2D, 0xA4,
+    0xE7, 0x19, 0xDA, 0x39, 0xDA, 0x71, 0xAD, 0x93, 0xAD, 0x97, 0x1A, 0xD4, 0xE7, 0x2E, 0x4E, 0x72,
+    0xE3, 0x9D, 0xA7, 0x19, 0xDA, 0x39, 0xDA, 0x71, 0xAD, 0x93, 0xAD, 0x97, 0x1E, 0x4E, 0x72, 0xE4,
+    0xE7, 0x2D, 0xA3, 0x9D, 0xA7, 0x19, 0xDA, 0x3A, 0xD9, 0x71, 0xAD, 0x93, 0xAD, 0x72, 0xE4, 0xE7,
+    0x2E, 0x4E, 0x71, 0x9D, 0xA3, 0x9D, 0xA7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0x9D, 0xA7, 0x09,
+    0xE5, 0xE7, 0x0E, 0x95, 0xEA, 0x6F, 0x69, 0xF9, 0x99, 0x9A, 0xF7, 0x0A, 0xFF, 0xE7, 0x29, 0xFF,
+    0x97, 0x79, 0x97, 0x40, 0x72, 0xAA, 0x91, 0x9A, 0xA7, 0x2E, 0x19, 0xE7, 0x1A, 0xD9, 0x1E, 0x71,
+    0x9D, 0x91, 0xAD, 0x72, 0xD9, 0x1A, 0xD7, 0x2A, 0xA3, 0xCA, 0x77, 0x77, 0x77, 0x9D, 0x96, 0xAD,
+    0x5E, 0x7E, 0x5E, 0x7E, 0x5E, 0x69, 0xDA, 0x49, 0xDA, 0x69, 0xD9, 0x4A, 0xD9, 0x6A, 0xD5, 0xE7,
+    0xE5, 0xE7, 0xE4, 0x9D, 0xA6, 0x9D, 0xA4, 0x9D, 0x96, 0xAD, 0x94, 0xAD, 0x96, 0xE5, 0xE6, 0x9E,
+    0x5E, 0x6E, 0xA5, 0xE5, 0xAE, 0x95, 0xE4, 0xAF, 0x95, 0xEA, 0x19, 0xDA, 0xAD, 0x69, 0xFE, 0xA0,
+    0xAD, 0x7A, 0xFC, 0x91, 0xDA, 0x71, 0x99, 0x75, 0x3E, 0x72, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0x9D,
+    0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x29, 0xDA, 0x71, 0x9D,
+    0xA2, 0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xDA, 0x29, 0xDA,
+    0x71, 0x9D, 0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72, 0xE3, 0xE7, 0x19, 0xDA,
+    0x29, 0xDA, 0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E, 0x4E, 0x70, 0xE9, 0x4E,
+    0xA6, 0xF5, 0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97, 0x59, 0xDA, 0x77, 0x0D,
+    0x97, 0x70, 0xAC, 0xA7, 0x71, 0xD7, 0x71, 0x9D, 0x77, 0x2E, 0xA9, 0x77, 0xAE, 0xA7, 0x77, 0x70,
+    0x29, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD,
+    0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9,
+    0x6E, 0x3E, 0x69, 0xE3, 0xE6, 0xEA, 0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA,
+    0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0xAF, 0xC9, 0x1D, 0xA7, 0x99, 0x3A, 0xCA, 0x75, 0xDA, 0x75, 0xAC,
+    0xA7, 0x6D, 0x77, 0xD7, 0x7E, 0xA9, 0x74, 0x9E, 0xA7, 0x76, 0x75, 0xAA, 0xA7, 0x77, 0x0A, 0xE9,
+    0x77, 0x6A, 0xFC, 0x77, 0x5A, 0xD9, 0x0D, 0xA7, 0x73, 0xAD, 0x91, 0x9D, 0x77, 0x29, 0xCA, 0x49,
+    0xCA, 0x77, 0x77, 0x77, 0x77, 0x29, 0xD9, 0x70, 0xE7, 0x0A, 0xD0, 0x9D, 0xA7, 0xAE, 0x79, 0xE0,
+    0x9D, 0xA7, 0xF7, 0xAD, 0x90, 0x9D, 0xA6, 0xAF, 0x7E, 0x19, 0xDA, 0x6D, 0xAD, 0x6A, 0xD9, 0x2D,
+    0xA5, 0xAD, 0x9D, 0x95, 0xE3, 0xDA, 0x5D, 0xA0, 0xD9, 0x49, 0xDA, 0x3D, 0xA4, 0x9D, 0x1D, 0x94,
+    0xE4, 0xE4, 0xE1, 0xD9, 0x39, 0xDA, 0x4E, 0x39, 0xD9, 0x1D, 0x93, 0xE5, 0xE3, 0xE2, 0xD9, 0x3E,
+    0x5E, 0x29, 0xD9, 0x2D, 0xA2, 0xAD, 0x95, 0xE2, 0xE3, 0xDA, 0x2E, 0x6E, 0x2D, 0x93, 0xDA, 0x19,
+    0xD9, 0x6E, 0x1A, 0xD4, 0xDA, 0x1E, 0x7E, 0x1D, 0xA4, 0xDA, 0x09, 0xD9, 0x7E, 0x0A, 0xD5, 0xE0,
+    0xAD, 0x70, 0xAD, 0x0D, 0xA5, 0xAD, 0x0D, 0xA7, 0x0A, 0xD9, 0xD6, 0xAD, 0x9D, 0x71, 0xAF, 0xA6,
+    0xAF, 0xA7, 0x1A, 0xF7, 0xAF, 0x72, 0xAF, 0x7A, 0xF7, 0x2A, 0xE9, 0x79, 0xE9, 0x72, 0x9E, 0x70,
+    0x9E, 0x72, 0x73, 0x9A, 0xA7, 0x74, 0x9E, 0xA7, 0x72, 0x9F, 0xC7, 0x71, 0x9D, 0xA0, 0xE7, 0x79,
+    0xD9, 0x2D, 0x97, 0x6C, 0xA5, 0xCA, 0x77, 0x77, 0x77, 0x71, 0xDA, 0x59, 0xE6, 0xE1, 0xE5, 0xAE,
+    0x59, 0xDA, 0x1E, 0x5F, 0x5E, 0x91, 0xE4, 0xAC, 0xAD, 0x94, 0xE2, 0xE4, 0xD9, 0xD9, 0x3A, 0xD9,
+    0x2E, 0x3A, 0xD0, 0xD9, 0x3E, 0x3E, 0x3D, 0x90, 0xD9, 0x2A, 0xD9, 0x3E, 0x2A, 0xD1, 0xD9, 0x2E,
+    0x4E, 0x2D, 0xA1, 0xDA, 0x19, 0xD9, 0x4A, 0xD1, 0x9D, 0x2D, 0xA1, 0xE5, 0xAD, 0x1D, 0xA2, 0xDA,
+    0x09, 0xDA, 0x5A, 0xD0, 0x9D, 0x3D, 0xA0, 0xAD, 0x6A, 0xD0, 0xDA, 0x3A, 0xCA, 0x0D, 0xA6, 0xAD,
+    0x0D, 0x4A, 0xCA, 0xAD, 0x7A, 0xDA, 0xCA, 0x4A, 0xCA, 0xDA, 0x79, 0xF9, 0x4A, 0xF9, 0x79, 0xF5,
+    0xAF, 0x70, 0x9E, 0x95, 0x9E, 0x97, 0x79, 0xAA, 0x75, 0x9E, 0xA7, 0x39, 0xFC, 0x72, 0x9D, 0xA0,
+    0xE7, 0x09, 0xD9, 0x2D, 0x97, 0xD5, 0xCA, 0x77, 0x77, 0x7A, 0xD7, 0x19, 0xDA, 0x0A, 0xD9, 0x70,
+    0xE1, 0x9D, 0xA7, 0xE9, 0x2E, 0x69, 0xE3, 0xE6, 0xE4, 0xAD, 0x94, 0xE9, 0x49, 0xDA, 0x39, 0xDA,
+    0x6E, 0x3E, 0x7E, 0x2E, 0x97, 0xAD, 0x19, 0xDA, 0x70, 0x9D, 0x90, 0xE7, 0x2D, 0xAA, 0xD9, 0x72,
+    0xAF, 0xA7, 0x39, 0xF7, 0x5E, 0x97, 0x5E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x76,
+    0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x40, 0x74, 0xAA, 0x97, 0x71, 0xF7, 0x70, 0xFC,
+    0xA7, 0x6E, 0x09, 0xD7, 0x5E, 0x2A, 0xD7, 0x3A, 0xC9, 0x4A, 0xC9, 0x77, 0x77, 0x77, 0x39, 0xDA,
+    0x70, 0xE6, 0xDA, 0x7A, 0xD9, 0x6E, 0x7E, 0x7E, 0x6E, 0x97, 0xE5, 0x9E, 0x70, 0xAD, 0x5E, 0x71,
+    0x9D, 0x93, 0x9D, 0xA7, 0x19, 0xDA, 0x3E, 0x73, 0xDA, 0x29, 0xDA, 0x73, 0xE2, 0xE7, 0x4E, 0x19,
+    0xDA, 0x74, 0xAD, 0x1E, 0x75, 0xAD, 0x09, 0xD9, 0x75, 0x9D, 0x0E, 0x76, 0x9D, 0x9D, 0x97, 0x7F,
+    0xC7, 0x70, 0xF9, 0x77, 0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x71, 0xAD, 0xA7,
+    0x70, 0x9E, 0x75, 0xA9, 0x9A, 0xE7, 0x6F, 0xD9, 0x76, 0xFA, 0x77, 0x59, 0x49, 0x71, 0xAD, 0x2A,
+    0xD7, 0x0E, 0x2E, 0x70, 0xAC, 0x92, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x1A, 0xD7, 0x19, 0xDA, 0x0A,
+    0xD9, 0x70, 0xE1, 0x9D, 0xA7, 0xE9, 0x2E, 0x69, 0xE3, 0xE6, 0xE4, 0xAD, 0x94, 0xE9, 0x49, 0xDA,
+    0x39, 0xDA, 0x6E, 0x3E, 0x7E, 0x2E, 0x97, 0xAD, 0x19, 0xDA, 0x70, 0x9D, 0x90, 0xE7, 0x2D, 0xAA,
+    0xD9, 0x72, 0xAF, 0xA7, 0x39, 0xF7, 0x5E, 0x97, 0x5E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7,
+    0x6E, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x40, 0x76, 0x9A, 0xA9, 0x77, 0x0E,
+    0x97, 0x7E, 0x97, 0x7A, 0xD9, 0x77, 0x9D, 0x97, 0x70, 0xCA, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xD6,
+    0xFF, 0xFD, 0x59, 0xFF, 0xFC, 0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAD,
+    0xA7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x77,
+    0x0E, 0x97, 0x7E, 0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xE9, 0x77, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA5, 0xFF, 0xFE, 0x5F, 0xFF, 0xDA, 0x40, 0x74, 0xAA, 0xA7, 0x4E, 0xA7, 0x3A,
+    0xDA, 0x73, 0x9D, 0xA7, 0x4D, 0xA7, 0x4A, 0xC9, 0x77, 0x77, 0x72, 0x9F, 0xFD, 0x94, 0x9F, 0xFD,
+    0x95, 0x99, 0x99, 0x99, 0xAE, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xE7,
+    0x4E, 0x97, 0x3E, 0x97, 0x3A, 0xDA, 0x73, 0x9E, 0x73, 0x9E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xDA,
+    0x74, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x30, 0x74, 0x99, 0x77, 0x1A, 0xDA, 0x77, 0x0E, 0xA7, 0x70,
+    0xAD, 0x77, 0x77, 0x77, 0x77, 0x72, 0xFF, 0xFD, 0x6F, 0xFF, 0xD5, 0x9F, 0xFF, 0xCA, 0x77, 0xAE,
+    0x77, 0x9E, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7A, 0xDA, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x0E, 0x97,
+    0x7E, 0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E,
+    0x77, 0x0E, 0x97, 0x7E, 0x97, 0x7A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xE5, 0xFF,
+    0xFD, 0xA4, 0x71, 0x9A, 0x74, 0x9E, 0x73, 0xAE, 0x73, 0x9D, 0x97, 0x77, 0x77, 0x76, 0x9F, 0xFD,
+    0x93, 0x9F, 0xFD, 0x94, 0x99, 0x99, 0x99, 0xAE, 0x73, 0xE9, 0x72, 0xAD, 0xA7, 0x2A, 0xDA, 0x72,
+    0x9E, 0x73, 0xE7, 0x3E, 0x97, 0x2E, 0x97, 0x2A, 0xDA, 0x72, 0x9E, 0x72, 0x9E, 0x73, 0xE7, 0x3E,
+    0x97, 0x2A, 0xDA, 0x73, 0xFF, 0xEA, 0x29, 0xFF, 0xE9, 0x20, 0x70, 0x9A, 0x59, 0xA9, 0x71, 0x9D,
+    0x3E, 0x73, 0xAD, 0x09, 0xE7, 0x5F, 0xD7, 0x6A, 0xF7, 0x70, 0xE7, 0x77, 0x77, 0x75, 0xFF, 0xFD,
+    0x6F, 0xFF, 0xD5, 0x9F, 0xFF, 0xCA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7A,
+    0xDA, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7A, 0xE7, 0x79, 0xE7, 0x70, 0xE7,
+    0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x7E, 0x97, 0x7A, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xE5, 0xFF, 0xFD, 0xA4, 0x6A, 0x95, 0xA9, 0x6D, 0x92, 0xAD,
+    0x79, 0xD1, 0xE7, 0x1F, 0xD7, 0x29, 0xF7, 0x4A, 0xD9, 0x77, 0x77, 0x71, 0x9F, 0xFD, 0x94, 0x9F,
+    0xFD, 0x95, 0x99, 0x99, 0x99, 0xAE, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x74,
+    0xE7, 0x4E, 0x97, 0x3E, 0x97, 0x3A, 0xDA, 0x73, 0x9E, 0x73, 0x9E, 0x74, 0xE7, 0x4E, 0x97, 0x3A,
+    0xDA, 0x74, 0xFF, 0xEA, 0x39, 0xFF, 0xE9, 0x30, 0x75, 0x99, 0x99, 0x75, 0x9F, 0xD7, 0x39, 0xFE,
+    0x73, 0xE9, 0x76, 0x9D, 0xA7, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97,
+    0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D,
+    0xA7, 0x7A, 0xD9, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xE7,
+    0x70, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0xAD, 0xA7, 0x4A, 0x9A, 0xE7,
+    0x5F, 0xC9, 0x75, 0xF9, 0x75, 0x77, 0x69, 0x99, 0x77, 0x5A, 0xDA, 0x79, 0xFD, 0xA9, 0x4E, 0x95,
+    0x9F, 0xFD, 0xA2, 0x9E, 0x5A, 0xFA, 0xA9, 0xAF, 0xC1, 0xE5, 0xAE, 0xA5, 0x9F, 0xE5, 0x9E, 0x97,
+    0x9F, 0xA6, 0xE9, 0x71, 0xE9, 0x6A, 0xDA, 0x72, 0xAD, 0xA6, 0xE7, 0x39, 0xE5, 0xAD, 0xA7, 0x4E,
+    0x5E, 0x97, 0x4E, 0x5E, 0x75, 0xE4, 0x9E, 0x74, 0x9E, 0x49, 0xDA, 0x74, 0x9E, 0x4A, 0xDA, 0x74,
+    0xAD, 0xA4, 0xAD, 0xA7, 0x4E, 0x94, 0xAD, 0xA7, 0x39, 0xE5, 0xAD, 0xA7, 0x3A, 0xE5, 0x9E, 0x73,
+    0xE9, 0x6E, 0x72, 0xF7, 0xF7, 0x0A, 0xE7, 0x09, 0xEA, 0x6F, 0x97, 0x1A, 0xFA, 0x99, 0x9A, 0xFA,
+    0x73, 0xAF, 0xFE, 0x97, 0x6A, 0xFE, 0x97, 0x73, 0x99, 0x97, 0x60, 0x77, 0x1A, 0xAA, 0x77, 0x19,
+    0xE7, 0x71, 0xAD, 0xA6, 0x9F, 0xCA, 0x3E, 0x59, 0xFF, 0xC1, 0xE9, 0x49, 0xF9, 0x99, 0xFE, 0x95,
+    0xEA, 0x4A, 0xE9, 0x6A, 0xDA, 0x6E, 0x7E, 0x7E, 0x6A, 0xD9, 0x7E, 0x6E, 0x70, 0xE6, 0xE7, 0x0E,
+    0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x9D, 0xA5, 0x9D, 0xA7, 0xAD, 0x95, 0x9D, 0xA7, 0xE7, 0xE6,
+    0xAD, 0xA7, 0xE9, 0x49, 0xE7, 0x09, 0xEA, 0x90, 0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0x97, 0x39, 0xFD,
+    0xA7, 0x71, 0x97, 0x50, 0x77, 0x77, 0x69, 0xFD, 0xA5, 0xAF, 0xC9, 0x79, 0xFF, 0xDA, 0x1A, 0xFF,
+    0x95, 0xAF, 0xAA, 0x9A, 0xFA, 0xFA, 0x9A, 0xF4, 0xAE, 0xA5, 0xAF, 0xC9, 0x4E, 0x92, 0x9E, 0x97,
+    0xF6, 0x9D, 0xA2, 0xE9, 0x71, 0xE6, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E, 0x95, 0x9D, 0xA1, 0xE7, 0x3A,
+    0xDA, 0x5A, 0xD9, 0x09, 0xDA, 0x73, 0xAD, 0xA5, 0xE1, 0xE9, 0x73, 0xAD, 0xA5, 0xE1, 0xE7, 0x4A,
+    0xDA, 0x49, 0xDA, 0x09, 0xE7, 0x4A, 0xDA, 0x49, 0xD9, 0x09, 0xDA, 0x74, 0xE9, 0x4A, 0xD9, 0x0A,
+    0xDA, 0x74, 0xE9, 0x4E, 0x1A, 0xDA, 0x73, 0x9E, 0x5E, 0x1A, 0xDA, 0x73, 0xAE, 0x49, 0xDA, 0x1A,
+    0xDA, 0x73, 0xE9, 0x4A, 0xD9, 0x19, 0xE7, 0x29, 0xE5, 0xAD, 0x3E, 0x72, 0xEA, 0x5E, 0x3F, 0x70,
+    0xF6, 0xE3, 0x9E, 0xA6, 0xF6, 0x9D, 0xA4, 0xAF, 0xA9, 0x99, 0xAF, 0x96, 0xAD, 0x95, 0xAF, 0xFE,
+    0x70, 0xE7, 0x9A, 0xFE, 0x97, 0x1E, 0x73, 0x99, 0x77, 0x40, 0x77, 0x75, 0x9F, 0xC9, 0x29, 0xFC,
+    0x59, 0xFF, 0xA0, 0xAF, 0xE3, 0x9F, 0x99, 0x9F, 0xD9, 0x99, 0xE9, 0x2E, 0xA4, 0xEA, 0x39, 0xDA,
+    0x1A, 0xDA, 0x5A, 0xD9, 0x39, 0xDA, 0x1E, 0x69, 0xDA, 0x39, 0xDA, 0x0A, 0xD9, 0x69, 0xDA, 0x39,
+    0xD9, 0x0E, 0x79, 0xDA, 0x3A, 0xD9, 0x0E, 0x79, 0xDA, 0x3E, 0x09, 0xDA, 0x7A, 0xD9, 0x3E, 0x09,
+    0xDA, 0x7E, 0x39, 0xDA, 0x09, 0xDA, 0x7E, 0x3A, 0xD9, 0x09, 0xDA, 0x6A, 0xDA, 0x3E, 0x2E, 0x6E,
+    0x4E, 0x2E, 0x94, 0xEA, 0x4E, 0x29, 0xEA, 0x19, 0xEA, 0x49, 0xDA, 0x3A, 0xFF, 0xA5, 0xAD, 0x94,
+    0x9F, 0xD9, 0x6E, 0x77, 0x4E, 0x77, 0x39, 0xDA, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x77, 0x3E,
+    0x77, 0x4E, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x30, 0x29, 0xAF, 0xFA, 0xA9, 0x5F, 0xFF, 0xE9,
+    0x2F, 0xFF, 0xFC, 0x91, 0xE1, 0xE5, 0xF0, 0x9D, 0x91, 0xE6, 0xE0, 0x9D, 0x90, 0x9E, 0x6A, 0xD9,
+    0x49, 0xDA, 0x6A, 0xD9, 0x4A, 0xD9, 0x6A, 0xD9, 0x4E, 0x7E, 0x5E, 0x69, 0xE4, 0x9D, 0xA6, 0xE9,
+    0x4A, 0xD9, 0x4A, 0xF5, 0xAF, 0xFE, 0xA6, 0xFF, 0xE9, 0x7E, 0xAA, 0xAA, 0xA9, 0x71, 0x9D, 0xA7,
+    0x7A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E,
+    0x76, 0x70, 0x99, 0x97, 0x6F, 0xC7, 0x4A, 0xFC, 0x74, 0xE7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE7,
+    0x7E, 0x76, 0x9D, 0xA1, 0xAF, 0x96, 0xAD, 0x99, 0xFE, 0x95, 0xE9, 0xDA, 0x99, 0xF5, 0xFC, 0x4E,
+    0x94, 0xF5, 0x9D, 0xA3, 0x9E, 0x95, 0x9D, 0xA3, 0xAE, 0x69, 0xDA, 0x3E, 0x96, 0x9D, 0xA3, 0xE7,
+    0xAD, 0x92, 0x9D, 0xA7, 0xE9, 0x29, 0xD9, 0x7E, 0x3A, 0xD9, 0x69, 0xE3, 0xE9, 0x6E, 0x93, 0xE9,
+    0x59, 0xE3, 0x9F, 0x49, 0xE9, 0x3A, 0xDA, 0xD9, 0x1A, 0xEA, 0x4A, 0xD0, 0xFF, 0xA5, 0xE1, 0xAF,
+    0xC9, 0x6E, 0x39, 0x97, 0x09, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x7D, 0xA7, 0x69, 0xD9,
+    0x76, 0xAD, 0x97, 0x60, 0x4A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xE9, 0x99, 0x97, 0x1A, 0xFF, 0xCA,
+    0x6A, 0xFF, 0xE5, 0xE3, 0x9A, 0xEA, 0x4E, 0x59, 0xE3, 0x9D, 0xA6, 0xE3, 0xAD, 0x96, 0xE9, 0x2E,
+    0x7E, 0x3E, 0x7E, 0x3E, 0x69, 0xDA, 0x29, 0xDA, 0x59, 0xE9, 0x2A, 0xD9, 0x39, 0xAE, 0xA3, 0xFF,
+    0xF9, 0x4F, 0xFD, 0x95, 0x9E, 0xAA, 0xAA, 0xDA, 0x69, 0xD9, 0x3E, 0x6A, 0xD9, 0x3A, 0xD9, 0x5E,
+    0x49, 0xDA, 0x5E, 0x5E, 0x49, 0xDA, 0x5A, 0xD9, 0x3A, 0xD9, 0x59, 0xE7, 0x6E, 0x76, 0xAD, 0xA7,
+    0x59, 0xE7, 0x69, 0x99, 0x20, 0x77, 0x79, 0xAF, 0xD9, 0x7F, 0xFD, 0xA6, 0x9E, 0xAA, 0xAF, 0xA6,
+    0xA5, 0x9E, 0x76, 0xE9, 0x75, 0xAD, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x5F, 0x73, 0x9F, 0x72, 0xAF,
+    0xC9, 0x79, 0xFD, 0xA7, 0xAF, 0xDA, 0x70, 0xFD, 0x97, 0x1F, 0xA9, 0x72, 0xAE, 0x75, 0xE7, 0x59,
+    0xE7, 0x59, 0xDA, 0x75, 0x9E, 0x76, 0xE9, 0x75, 0xAE, 0xA9, 0x99, 0x9A, 0xDA, 0x5F, 0xFE, 0xA6,
+    0x9F, 0xFA, 0x72, 0x99, 0x97, 0x00, 0x77, 0x29, 0xAF, 0xD5, 0x9F, 0xFC, 0x94, 0xDA, 0x90, 0x9A,
+    0xE7, 0x3E, 0x73, 0xAD, 0x73, 0xE7, 0x19, 0xEA, 0x69, 0xAF, 0xC5, 0xAF, 0xDA, 0x4A, 0xFD, 0x95,
+    0xAF, 0x97, 0x9E, 0x97, 0x1A, 0xDA, 0x72, 0xAD, 0x97, 0x2A, 0xDA, 0x72, 0x9E, 0x92, 0x9A, 0xCA,
+    0x3A, 0xFF, 0xCA, 0x49, 0xFE, 0xA7, 0x09, 0x99, 0x60, 0x5A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD6, 0xFF,
+    0xFC, 0xA6, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE7, 0x71, 0xAD, 0x97,
+    0x71, 0xE7, 0x71, 0xAD, 0x97, 0x70, 0x9D, 0x97, 0x79, 0xDA, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0A,
+    0xD7, 0x70, 0xAD, 0x97, 0x79, 0xDA, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0A, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xE5, 0xFF, 0xFD, 0xA4, 0x29, 0xAA, 0x93, 0xFD, 0x1F, 0xEA,
+    0x0D, 0xA1, 0xE0, 0xDA, 0x1E, 0x0E, 0xAA, 0xE0, 0xAF, 0xDA, 0x19, 0xAF, 0x94, 0xAD, 0x5E, 0x5D,
+    0xA4, 0x9D, 0xA4, 0xAD, 0x94, 0xE5, 0xE5, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xE4, 0x9D, 0xA4,
+    0xAD, 0x94, 0xAD, 0x5E, 0x5E, 0x49, 0xDA, 0x4A, 0xD9, 0x4E, 0x5E, 0x5E, 0x5E, 0x5E, 0xA9, 0xAA,
+    0x1A, 0xFD, 0x29, 0xF9, 0x00, 0x49, 0xC9, 0x70, 0xD7, 0x0A, 0xD7, 0x0E, 0x59, 0xAF, 0xF0, 0x9F,
+    0xFD, 0x19, 0x9E, 0x99, 0x99, 0x93, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D,
+    0xA7, 0x9D, 0x97, 0xAD, 0x97, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x91, 0x94, 0xAF, 0xD5, 0xAF, 0xC7,
+    0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA5, 0xAA, 0xE9, 0x5F, 0xC6, 0xEA, 0x60, 0x29,
+    0xAF, 0xFF, 0xCA, 0x1F, 0xFF, 0xFA, 0x0F, 0xFF, 0xFC, 0x90, 0xE3, 0x9D, 0xA6, 0x9D, 0x93, 0xAD,
+    0xA6, 0x9D, 0x93, 0xAD, 0x97, 0x6E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xE7,
+    0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0xAD,
+    0x97, 0x6E, 0x77, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x97, 0x20, 0x79, 0x99, 0x6A, 0xFC, 0x4A, 0xFD,
+    0x4E, 0x96, 0x9D, 0xA7, 0xAD, 0x70, 0xE7, 0x0E, 0x59, 0xAF, 0xF0, 0x9F, 0xFD, 0x19, 0x9E, 0x99,
+    0x99, 0x93, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0x9D, 0x97, 0xAD,
+    0x97, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x91, 0x94, 0xAF, 0xD5, 0xAF, 0xC7, 0x99, 0x50, 0x9F, 0xFF,
+    0xE9, 0xAF, 0xFF, 0xE9, 0xFF, 0xFF, 0x6A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74,
+    0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74,
+    0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE9, 0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7,
+    0x5E, 0x74, 0x9E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xAD, 0xA7, 0x4A, 0xEA, 0xA9, 0x72, 0xFC,
+    0x97, 0x3A, 0xE9, 0x70, 0x77, 0x79, 0x99, 0x77, 0x6A, 0xE3, 0xE7, 0x2D, 0xA1, 0xE9, 0x3E, 0x71,
+    0x9D, 0xA0, 0x9E, 0x39, 0xDA, 0x71, 0xAD, 0x90, 0xE4, 0xAD, 0x97, 0x1A, 0xFD, 0x94, 0xE7, 0x2F,
+    0xCA, 0x6E, 0x72, 0xE9, 0x79, 0xDA, 0x71, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0xAD, 0x97, 0x0A, 0xD9,
+    0x71, 0xE7, 0x1E, 0x72, 0xE7, 0x1E, 0x72, 0xE7, 0x09, 0xDA, 0x71, 0x9D, 0xA7, 0x0A, 0xD9, 0x71,
+    0xAD, 0x97, 0x0A, 0xD7, 0x2E, 0x71, 0xE7, 0x2E, 0x71, 0xE7, 0x19, 0xDA, 0x70, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x70, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7, 0x09, 0xE7, 0x2E, 0x70, 0xE9, 0x72, 0xEA, 0x6F,
+    0x73, 0x9F, 0x99, 0x99, 0xAF, 0x75, 0xAF, 0xFE, 0x77, 0x9F, 0xF9, 0x77, 0x49, 0x99, 0x77, 0x00,
+    0x77, 0x39, 0xAA, 0x97, 0x73, 0xE9, 0x77, 0x3E, 0x39, 0xD9, 0x6A, 0xD1, 0xAD, 0x93, 0xE7, 0xE0,
+    0xAD, 0xA4, 0xE7, 0xFD, 0xA5, 0xE6, 0x9F, 0xA6, 0x9D, 0xA6, 0x9D, 0x97, 0x0A, 0xD9, 0x6A, 0xD7,
+    0x1E, 0x7E, 0x71, 0xE7, 0xE7, 0x09, 0xDA, 0x69, 0xDA, 0x70, 0x9D, 0x96, 0xAD, 0x97, 0x0A, 0xD9,
+    0x6E, 0x71, 0xE6, 0x9E, 0x71, 0xE6, 0xEA, 0x71, 0xE5, 0xAE, 0x97, 0x1E, 0x4A, 0xF9, 0x71, 0xEA,
+    0x19, 0xDA, 0xAD, 0x72, 0x9F, 0xEA, 0x0A, 0xD7, 0x3A, 0xFC, 0x91, 0xDA, 0x75, 0x99, 0x77, 0x10,
+    0x9A, 0xA2, 0x9D, 0xA2, 0xE3, 0xDA, 0x29, 0xD3, 0x9C, 0x90, 0x39, 0xAA, 0x92, 0x9E, 0x3E, 0x3E,
+    0x3A, 0xD3, 0x9C, 0xA4, 0x4A, 0xA9, 0x6F, 0x5F, 0xCA, 0x3A, 0xD9, 0x9D, 0x91, 0xE2, 0xAD, 0x0A,
+    0xCA, 0x4A, 0xC9, 0x29, 0x94, 0x9A, 0x19, 0xFA, 0x2D, 0x1F, 0xEA, 0xDA, 0x09, 0xCA, 0x1A, 0xFC,
+    0x1A, 0xC4, 0xAC, 0xA2, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x1F, 0xFA, 0x00, 0x75, 0x9F,
+    0xFF, 0x0A, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9A, 0x5A, 0xAA, 0xCA, 0x3A,
+    0xCA, 0x9E, 0xAA, 0xE1, 0xAF, 0xD9, 0x29, 0xAC, 0xAA, 0x20, 0x09, 0x90, 0x9D, 0xAA, 0xDA, 0x9D,
+    0x40, 0x19, 0x49, 0x09, 0xD9, 0x19, 0xD9, 0xAD, 0x91, 0xAD, 0x99, 0xD2, 0x9C, 0xA0, 0x09, 0x99,
+    0x29, 0xF9, 0x09, 0xA9, 0xAD, 0x4D, 0x92, 0xAD, 0x1A, 0xE9, 0x1D, 0x92, 0x9C, 0xA4, 0x94, 0x71,
+    0xF9, 0x1D, 0xAA, 0xD9, 0x9C, 0xA2, 0xD9, 0xC9, 0x2D, 0x0D, 0x19, 0xCA, 0x0A, 0xFC, 0x29, 0xAC,
+    0xA1, 0x3A, 0xA9, 0x19, 0xAA, 0x3E, 0x19, 0xE2, 0xAD, 0x91, 0xE2, 0x9D, 0x91, 0xE2, 0x9D, 0x2A,
+    0xCA, 0x3A, 0xA3, 0xCA, 0x40, 0x9A, 0x94, 0x9A, 0x90, 0xD9, 0x2A, 0xD1, 0xAD, 0x1E, 0x3F, 0xD4,
+    0x9F, 0x6E, 0x93, 0x29, 0x92, 0xAD, 0x2A, 0xD2, 0xDA, 0x2D, 0x91, 0x9D, 0x91, 0xAD, 0x2E, 0x2D,
+    0xA2, 0x99, 0x20, 0x19, 0x92, 0x99, 0x19, 0xD1, 0x9D, 0x90, 0xAD, 0x1A, 0xD1, 0xE1, 0xAD, 0x1D,
+    0xA1, 0xDA, 0x09, 0xD9, 0x1D, 0x97, 0x20, 0x0A, 0xA9, 0x19, 0xAA, 0x92, 0xE1, 0x9E, 0x29, 0xDA,
+    0x1A, 0xD3, 0xAD, 0x2D, 0xA3, 0xDA, 0x2D, 0x93, 0xD2, 0x9C, 0xA0, 0x76, 0xAD, 0x7E, 0x7E, 0x39,
+    0xA1, 0x9A, 0x1A, 0xA0, 0x9C, 0xA3, 0x9D, 0x1E, 0xAA, 0xE9, 0x1A, 0xFD, 0x93, 0x9A, 0xCA, 0xA3,
+    0x39, 0xAA, 0x94, 0x9F, 0xD9, 0x19, 0xFF, 0x1D, 0x93, 0xD1, 0xCA, 0x49, 0xC0, 0x3A, 0xC9, 0x29,
+    0xD3, 0xDA, 0x2A, 0xD3, 0xE2, 0xAD, 0x91, 0x9E, 0x2A, 0xDA, 0x29, 0x99, 0x30, 0x2A, 0xD9, 0x2E,
+    0x29, 0xDA, 0x2E, 0x29, 0xDA, 0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0x99, 0x40, 0x0D, 0xA1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xAD, 0x19, 0xD1, 0x9D, 0x29, 0x90, 0x2A, 0xD9, 0x2E, 0x29, 0xDA, 0x2E, 0x29, 0xDA,
+    0x2A, 0xD3, 0xD9, 0x2A, 0xD3, 0x99, 0x40, 0x0A, 0xAA, 0x3A, 0xD9, 0x3E, 0x39, 0xD9, 0x3A, 0xD4,
+    0xAC, 0x90, 0x3A, 0xAA, 0x3E, 0xA2, 0xAD, 0xA2, 0x9D, 0xA3, 0xDA, 0x3A, 0xC9, 0x40, 0x73, 0x9D,
+    0x49, 0xCA, 0x09, 0xFC, 0xA0, 0xAF, 0xC9, 0x4D, 0x49, 0xD5, 0x92, 0x71, 0xD9, 0x4D, 0x49, 0xFC,
+    0x90, 0xAF, 0xC9, 0x0A, 0xC9, 0x4D, 0x59, 0x94, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x9A,
+    0xAA, 0xAA, 0xAD, 0xA6, 0xD9, 0x6D, 0x69, 0xD6, 0xAC, 0xA6, 0xD9, 0x6D, 0x7A, 0xA1, 0x49, 0x99,
+    0x3A, 0xDA, 0x3E, 0x92, 0x9E, 0x3E, 0x91, 0xAE, 0x92, 0xDA, 0x49, 0x50, 0x6A, 0xD0, 0xAD, 0x90,
+    0xD1, 0x9C, 0x91, 0x9C, 0xA2, 0xDA, 0x2A, 0x90, 0x39, 0x94, 0x9D, 0x49, 0xCA, 0x4A, 0xC9, 0x19,
+    0xFD, 0xA9, 0xFD, 0x90, 0x09, 0x99, 0x99, 0x90, 0xAF, 0xD9, 0xAA, 0xEA, 0xA2, 0xAC, 0x94, 0xD9,
+    0x4D, 0x30, 0x74, 0xD5, 0x9D, 0x3A, 0xAE, 0xAA, 0x1F, 0xE1, 0x99, 0xD9, 0x94, 0xD6, 0xAA, 0x30,
+    0x79, 0xFE, 0xAF, 0xDA, 0x49, 0x99, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4E, 0x4E, 0x39, 0xDA, 0x09,
+    0xAA, 0xE1, 0x9F, 0xA1, 0x9E, 0x92, 0x19, 0x99, 0x3D, 0xA2, 0x9D, 0x92, 0xAD, 0x3E, 0x3E, 0x3D,
+    0xA3, 0xEA, 0xA9, 0x0A, 0xF9, 0x1A, 0xE0, 0x0D, 0x0E, 0x9E, 0x99, 0xCA, 0x00, 0x19, 0x49, 0x1E,
+    0x2E, 0x0E, 0x2E, 0x0A, 0xC9, 0x2A, 0xC9, 0x71, 0xAE, 0xA1, 0xDA, 0xAD, 0xA0, 0xCA, 0x2D, 0x9C,
+    0xA2, 0xD0, 0xD1, 0x9D, 0x0A, 0xFC, 0x91, 0x9A, 0xCA, 0x10, 0x19, 0xDA, 0x1A, 0xD2, 0xD9, 0x1A,
+    0xCA, 0x19, 0xD3, 0x93, 0x2A, 0xC9, 0x3D, 0x3A, 0xDA, 0x39, 0xDA, 0x3A, 0xD3, 0xDA, 0x9F, 0xC0,
+    0x9E, 0xA1, 0x2D, 0x19, 0xD2, 0xD2, 0xAC, 0xA2, 0xAC, 0xA2, 0xAF, 0x1F, 0x60, 0x19, 0x99, 0x1D,
+    0xA1, 0xD9, 0x09, 0xD1, 0xAD, 0x1E, 0x1D, 0xA0, 0x9D, 0x90, 0x9D, 0x19, 0x99, 0x10, 0x19, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xEA, 0x09, 0xDA, 0xAA, 0xAA, 0xAA, 0xDA, 0x0A, 0xCA, 0x6D,
+    0x90, 0xD9, 0x6D, 0x1D, 0x69, 0xD1, 0x99, 0x79, 0x10, 0x9C, 0x92, 0xCA, 0x2A, 0xC0, 0x9C, 0x91,
+    0xAD, 0x19, 0xD1, 0xFF, 0xE2, 0x9E, 0x90, 0xAD, 0xA2, 0xAA, 0x59, 0xA0, 0xAD, 0x3D, 0xA1, 0xDA,
+    0x09, 0xDA, 0x29, 0xFC, 0xA4, 0xFA, 0x59, 0xDA, 0x40, 0x39, 0xAA, 0x96, 0xF5, 0xFC, 0xA3, 0xE0,
+    0xAD, 0x2D, 0xA2, 0xE0, 0xAC, 0x94, 0xAC, 0x00, 0xAA, 0x5A, 0x9D, 0x93, 0xD9, 0xAD, 0xAA, 0xAE,
+    0x1F, 0xE3, 0x9A, 0xCA, 0x92, 0x39, 0xAA, 0x94, 0xAF, 0xD2, 0x9F, 0xF1, 0xD9, 0x3D, 0x1C, 0x94,
+    0xAC, 0x00, 0x29, 0x95, 0xA2, 0xFA, 0x2D, 0x1F, 0xEA, 0xDA, 0x09, 0xCA, 0x1A, 0xFC, 0x1A, 0xC4,
+    0xAA, 0xA2, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFC, 0x9F, 0xF9, 0x9F, 0xFF, 0xC0, 0xAF, 0xFF,
+    0xC7, 0x70, 0x77, 0xAF, 0xFF, 0xA0, 0xFF, 0xFC, 0x97, 0x77, 0x59, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xAF, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x39, 0x94, 0x99, 0x2A,
+    0xF9, 0x2C, 0xA2, 0xFE, 0xAD, 0x91, 0xAC, 0x91, 0xAF, 0xA2, 0xCA, 0x39, 0xAA, 0x92, 0x76, 0xFF,
+    0xFA, 0x9F, 0xFF, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0xFD, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x0A, 0xC5, 0x9E, 0xA3, 0xAE, 0xA2, 0xAF, 0x29, 0xF9,
+    0x39, 0xDA, 0x6A, 0x70, 0x77, 0x09, 0x97, 0x70, 0xDA, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x7A, 0xD7,
+    0x70, 0xD9, 0x77, 0xE7, 0x79, 0xD9, 0x77, 0xDA, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x70,
+    0xD9, 0x77, 0xE7, 0x79, 0xD9, 0x77, 0xDA, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x70, 0xD9,
+    0x77, 0xE7, 0x79, 0xD7, 0x70, 0xDA, 0x77, 0x9D, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x70, 0xD9, 0x77,
+    0xAD, 0x77, 0x5A, 0xC9, 0x19, 0xD2, 0xAC, 0x91, 0xAC, 0x90, 0x9D, 0x0E, 0x90, 0xA9, 0x20, 0x19,
+    0x97, 0x99, 0x1D, 0x69, 0xCA, 0x09, 0xD6, 0xAC, 0xA0, 0xAC, 0xA6, 0xD9, 0x0E, 0xAA, 0xAA, 0xAA,
+    0xAD, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x77, 0xFF, 0xEA, 0x1D, 0xAA, 0xAA,
+    0xAA, 0xAD, 0x91, 0xCA, 0x6D, 0x19, 0xC9, 0x6D, 0x1A, 0xC9, 0x59, 0xCA, 0x1F, 0xFE, 0x91, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x19, 0xE9, 0x0A, 0xDA, 0x1A, 0xDA, 0xFA, 0xDA, 0x9C, 0xA1, 0x9D,
+    0x2D, 0xAC, 0x3C, 0x92, 0xCA, 0x1A, 0x2A, 0x1A, 0xD0, 0xDA, 0x1F, 0xA2, 0xAE, 0x29, 0xF1, 0x9D,
+    0x9E, 0x1A, 0x2A, 0x10, 0x39, 0xAC, 0x3A, 0xE2, 0x9D, 0x4A, 0xCA, 0x49, 0xD5, 0xDA, 0x4A, 0xD4,
+    0xDA, 0x2A, 0xE3, 0xAA, 0x93, 0x77, 0xAF, 0xFF, 0xA0, 0xFF, 0xFC, 0x97, 0x77, 0x59, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x0A,
+    0xA9, 0x3E, 0x39, 0xDA, 0x3A, 0xD4, 0xDA, 0x4D, 0x00, 0x3A, 0xAA, 0x3E, 0xA2, 0xAD, 0xA2, 0x9D,
+    0xA3, 0xDA, 0x3A, 0xC9, 0x40, 0x29, 0x99, 0x4A, 0x91, 0xFC, 0x91, 0xAC, 0x90, 0xAF, 0xEA, 0xD1,
+    0xD1, 0x9F, 0xC9, 0x1C, 0x93, 0x9A, 0xA9, 0x10, 0xAD, 0xA0, 0xFA, 0x1D, 0xA1, 0xAC, 0xA0, 0x9D,
+    0x19, 0xA1, 0x5E, 0x94, 0x91, 0xAD, 0xA0, 0x91, 0x9D, 0x90, 0xE0, 0xE0, 0xAD, 0x9A, 0xD9, 0x0E,
+    0x09, 0xCA, 0x0D, 0x91, 0xD9, 0x39, 0xCA, 0x60, 0x09, 0x93, 0xDA, 0x19, 0xD9, 0x1A, 0xD9, 0x1A,
+    0xF1, 0xAD, 0xA0, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFC, 0x1A, 0xDA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xD1, 0xD9, 0x79, 0xD1, 0xD7, 0x0A, 0xCA, 0x1D, 0x70, 0xD9, 0x19, 0x71, 0x99,
+    0x10, 0x77, 0x09, 0xFF, 0xFC, 0x1A, 0xFF, 0xFA, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x19, 0xFF, 0xFC, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x19, 0x92, 0x99, 0x91,
+    0xDA, 0x1D, 0xA0, 0x9D, 0x91, 0xD9, 0x09, 0xD1, 0x9D, 0x90, 0xAD, 0x1A, 0xD1, 0xE1, 0xE7, 0x20,
+    0x0F, 0xD1, 0xFD, 0x49, 0xD4, 0xAC, 0xA4, 0xD9, 0x4D, 0x10, 0x69, 0x97, 0x09, 0x90, 0xD1, 0x99,
+    0x29, 0xFC, 0xA1, 0xCA, 0x2F, 0xEA, 0xD9, 0x1A, 0xC9, 0x0A, 0xFC, 0xA2, 0xCA, 0x09, 0xCA, 0x9A,
+    0xA9, 0x7C, 0x77, 0x50, 0x5A, 0xC9, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0x99, 0x6A, 0xE9, 0x2A,
+    0xC1, 0xAF, 0xCA, 0x9A, 0xD1, 0xD9, 0x9F, 0xD9, 0x0A, 0xC9, 0x29, 0xE9, 0x6A, 0x97, 0x1E, 0x71,
+    0xE7, 0x19, 0xA6, 0x39, 0x94, 0x99, 0x1A, 0xFA, 0x1A, 0xC9, 0x09, 0xDA, 0xFE, 0x1D, 0x29, 0xF7,
+    0x70, 0x9A, 0xA9, 0x3C, 0xA1, 0xFD, 0x99, 0xD9, 0x09, 0xCA, 0x99, 0xFC, 0xA1, 0xAC, 0x39, 0xAC,
+    0x92, 0x79, 0x6A, 0xC2, 0xAC, 0x92, 0x9F, 0xFC, 0x91, 0xFF, 0xDA, 0x2D, 0xA1, 0x9D, 0x94, 0xA9,
+    0x19, 0xA7, 0x70, 0x71, 0x9C, 0x3A, 0xDA, 0x1A, 0xF9, 0x19, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x20,
+    0xAF, 0x3A, 0xFA, 0x3F, 0xAF, 0xC9, 0x2A, 0xFA, 0x29, 0xFE, 0x77, 0x3F, 0x77, 0x3F, 0x59, 0x90,
+    0xD0, 0x99, 0x5D, 0x99, 0x5A, 0xC0, 0xAA, 0x0C, 0xA5, 0x99, 0x5C, 0xA7, 0xAC, 0x73, 0xA9, 0x79,
+    0xA7, 0x2A, 0x73, 0xA9, 0x39, 0x91, 0x9C, 0x73, 0xCA, 0x19, 0x9D, 0x77, 0x3F, 0x1A, 0x97, 0x4C,
+    0x1F, 0x1C, 0x97, 0x39, 0xC1, 0xF7, 0x73, 0xDA, 0xA1, 0x9C, 0x73, 0xCA, 0x1A, 0xA3, 0x9C, 0x73,
+    0xC9, 0x71, 0xA9, 0x79, 0xA7, 0x3C, 0xA7, 0xAC, 0x75, 0xAC, 0x09, 0x90, 0xCA, 0x7D, 0x59, 0xA0,
+    0xD0, 0xA9, 0x5F, 0x77, 0x3F, 0x77, 0x3F, 0xE3, 0xAF, 0xA3, 0xFF, 0xD9, 0x2A, 0xFA, 0x29, 0xFC,
+    0x5D, 0x92, 0xAE, 0x92, 0xAD, 0xA1, 0xAD, 0xAA, 0xEA, 0x0D, 0x97, 0x00, 0x6D, 0xA0, 0xDA, 0x0A,
+    0xC9, 0x1A, 0xC2, 0xAC, 0x92, 0xD9, 0x19, 0xA1, 0x73, 0x9A, 0xF2, 0x9F, 0xE1, 0xDA, 0x99, 0x9D,
+    0xAA, 0xCA, 0x4C, 0xA9, 0x91, 0xAC, 0x19, 0x92, 0xAD, 0xA5, 0xAD, 0xA5, 0x9C, 0xA3, 0x1A, 0x1A,
+    0x2D, 0xAE, 0x2F, 0x92, 0xF2, 0xFC, 0xA1, 0x9C, 0x90, 0xCA, 0x70, 0x39, 0x91, 0x9D, 0xA9, 0xEA,
+    0x0E, 0x2A, 0xE9, 0x2A, 0xDA, 0x3A, 0xA0, 0x0A, 0x5D, 0xA3, 0x9E, 0xA3, 0xAD, 0x91, 0xAE, 0x90,
+    0xE9, 0x2C, 0x93, 0x97, 0x3D, 0xA9, 0x3E, 0x2F, 0x91, 0xE3, 0x9D, 0xA0, 0xAC, 0xAC, 0xA1, 0x9E,
+    0xA0, 0xD0, 0xD0, 0xAD, 0xA1, 0x9C, 0xA0, 0xAC, 0x9A, 0xA3, 0xAC, 0x2C, 0xA0, 0x19, 0x3D, 0x2A,
+    0xCA, 0x2D, 0x2D, 0x1A, 0xCA, 0x0E, 0x1A, 0x91, 0x09, 0x90, 0xAD, 0xAE, 0xA9, 0xD4, 0x29, 0xA9,
+    0x59, 0xC9, 0x3A, 0xCA, 0xCA, 0xCA, 0x1A, 0xFC, 0xA2, 0x9E, 0x93, 0xD9, 0xD3, 0x9A, 0x0A, 0x91,
+    0x75, 0x9E, 0xA0, 0xAE, 0x90, 0x9D, 0xAA, 0xFA, 0xD9, 0xAC, 0x2A, 0xCA, 0x2F, 0x29, 0xC9, 0x2D,
+    0xAC, 0x2A, 0xCA, 0x2D, 0x9D, 0xAF, 0xCA, 0xD9, 0x09, 0xEA, 0x0A, 0xE9, 0x00, 0x7C, 0xA3, 0x9C,
+    0x93, 0xAF, 0xC0, 0xFD, 0x4C, 0xA3, 0x9C, 0x97, 0x9A, 0x97, 0x71, 0xAA, 0x99, 0xD9, 0x77, 0xAD,
+    0x1E, 0x97, 0x49, 0xE3, 0xF9, 0x70, 0x9F, 0x5F, 0xEA, 0xAA, 0xFD, 0xA7, 0x9F, 0xFF, 0xA7, 0x49,
+    0x9A, 0xAA, 0xAA, 0x97, 0x00, 0xAA, 0x97, 0x71, 0xAA, 0x9A, 0xD7, 0x70, 0xE1, 0xE7, 0x59, 0xE2,
+    0x9E, 0xA9, 0x70, 0xAF, 0x49, 0xFE, 0xAA, 0xFE, 0xA7, 0x9F, 0xFF, 0xA7, 0x49, 0xAA, 0xAA, 0xAA,
+    0x97, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFF, 0xF0, 0x9F, 0xFF,
+    0xEA, 0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xFF, 0xFE, 0xAA, 0xFF, 0xFE,
+    0x90, 0x49, 0x99, 0x99, 0x74, 0x9A, 0x3A, 0xFF, 0xA9, 0x70, 0xD2, 0xFA, 0xAF, 0xFA, 0xA9, 0x9A,
+    0xAD, 0x91, 0xAD, 0x69, 0xAF, 0xFD, 0x92, 0xAA, 0x73, 0x9A, 0xAA, 0xAA, 0x93, 0x71, 0x99, 0xAA,
+    0x99, 0x75, 0x9F, 0xFE, 0xA9, 0x79, 0xFF, 0xFE, 0xA5, 0xFA, 0x97, 0x9F, 0x3E, 0xA7, 0x49, 0xE1,
+    0xE7, 0x79, 0xD9, 0x9A, 0xA7, 0x71, 0x9A, 0xA0, 0x77, 0x39, 0x77, 0x79, 0xC9, 0x19, 0xFF, 0xFF,
+    0xFD, 0xA0, 0xFF, 0xFF, 0xFF, 0x97, 0x73, 0xAD, 0x77, 0x59, 0xA7, 0x77, 0x30, 0x2A, 0xD0, 0xA2,
+    0xCA, 0x1D, 0x1A, 0xA2, 0xCA, 0x1C, 0x92, 0xC9, 0x1C, 0x29, 0xC2, 0xC2, 0xD2, 0xDA, 0xCA, 0xA3,
+    0x99, 0x40, 0x19, 0xDA, 0x1A, 0xC1, 0xCA, 0x0C, 0x2C, 0x9A, 0xCA, 0xD9, 0x0A, 0xA4, 0xAC, 0x5C,
+    0xAA, 0xAA, 0x29, 0x99, 0x10, 0x29, 0x3C, 0x96, 0x9A, 0x2C, 0x92, 0xC2, 0x9C, 0x2A, 0xC2, 0xCA,
+    0x2C, 0x92, 0x92, 0x2A, 0xD9, 0x2C, 0xA1, 0xC9, 0x0C, 0xA2, 0xAA, 0x0C, 0x92, 0xAA, 0x0C, 0x3C,
+    0x90, 0xC9, 0x19, 0xC1, 0xAC, 0xAA, 0xC9, 0x39, 0x92, 0x1C, 0x3C, 0x19, 0xC2, 0x9C, 0x1A, 0xC2,
+    0xAA, 0x1C, 0xA2, 0xC9, 0x1C, 0x91, 0x9C, 0x2C, 0x2D, 0x2C, 0xAA, 0xCA, 0xA3, 0x99, 0x40, 0x2A,
+    0xD9, 0x09, 0xC9, 0x3C, 0xA4, 0xC4, 0x9C, 0x49, 0xC5, 0xDA, 0xAA, 0x29, 0x99, 0x10, 0x69, 0xA6,
+    0xAA, 0x6C, 0x92, 0xAC, 0xA9, 0xC2, 0xC9, 0x1D, 0x1C, 0xA2, 0xCA, 0x1C, 0x3C, 0x90, 0x9C, 0x29,
+    0xC1, 0x9C, 0x2D, 0x2D, 0xAC, 0xAA, 0x39, 0x94, 0x19, 0xC5, 0xAC, 0x5C, 0xA5, 0xC9, 0xAD, 0x19,
+    0xD9, 0x0A, 0xA0, 0x9C, 0x2A, 0xA0, 0xAA, 0x2C, 0x90, 0xC9, 0x2C, 0x1C, 0x29, 0xC0, 0x9C, 0x2A,
+    0xC5, 0x91, 0x1A, 0x0D, 0xA0, 0x9D, 0x90, 0x9C, 0xA1, 0xCA, 0x90, 0xAC, 0x0A, 0xC2, 0xCA, 0x19,
+    0xC0, 0xC9, 0x19, 0xC2, 0xAA, 0x0C, 0x2A, 0xC2, 0xC9, 0x9C, 0x2C, 0xA2, 0xC0, 0xAA, 0x2C, 0x91,
+    0x9C, 0x09, 0x39, 0x39, 0x00, 0x1A, 0x9A, 0xCA, 0x1D, 0x93, 0xC9, 0x39, 0xC4, 0xAA, 0x4C, 0x94,
+    0xC5, 0x94, 0x7C, 0x91, 0x9F, 0x19, 0xC3, 0xAA, 0x3C, 0x93, 0xC3, 0x9C, 0x4C, 0xA9, 0x29, 0x99,
+    0x10, 0x9A, 0x3C, 0x09, 0xC2, 0xAA, 0x1C, 0x19, 0xC2, 0xC1, 0xC9, 0x2C, 0x9A, 0xC3, 0xC9, 0xC9,
+    0x3A, 0xCA, 0x59, 0x40, 0x1A, 0x91, 0x9A, 0x2A, 0xC0, 0x9C, 0x4C, 0xAC, 0x5A, 0xC5, 0x9D, 0x94,
+    0xC9, 0x9C, 0x3C, 0x91, 0xC9, 0x19, 0x96, 0x74, 0xE7, 0x7A, 0xE9, 0x76, 0xF9, 0x75, 0xFC, 0xA7,
+    0x49, 0xD9, 0xDA, 0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xE1, 0xAD, 0x72, 0x9D, 0xA1, 0xAD,
+    0x72, 0xE2, 0xAD, 0x97, 0x0A, 0xD9, 0x29, 0xD9, 0x70, 0xE3, 0x9D, 0xA7, 0xAD, 0x94, 0xDA, 0x7E,
+    0x5E, 0x6A, 0xFF, 0xF5, 0x9F, 0xFF, 0xC5, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x49, 0xE7, 0xAD, 0x93,
+    0xE7, 0x0A, 0xD9, 0x29, 0xDA, 0x70, 0x9D, 0xA2, 0xE7, 0x19, 0xDA, 0x1A, 0xDA, 0x72, 0xE1, 0xE7,
+    0x3E, 0x0A, 0xDA, 0x73, 0xE0, 0x4A, 0xFE, 0xA9, 0x70, 0xFF, 0xEA, 0x6F, 0xFF, 0xA4, 0x9D, 0xA5,
+    0xAE, 0x4A, 0xD9, 0x6E, 0xA3, 0xAD, 0x96, 0xAD, 0xA3, 0xE7, 0xAD, 0xA3, 0xE7, 0xAD, 0x92, 0x9D,
+    0xA6, 0x9E, 0x3A, 0xD9, 0x59, 0xE9, 0x3F, 0xAA, 0xAA, 0xFC, 0x5F, 0xFD, 0xA9, 0x6F, 0xFE, 0xA5,
+    0x9D, 0xA5, 0xAE, 0x4A, 0xD9, 0x6A, 0xDA, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x29, 0xDA, 0x70, 0xE2,
+    0x9D, 0x97, 0x9E, 0x2A, 0xD9, 0x7E, 0xA2, 0xE7, 0xF3, 0xEA, 0xAA, 0xAA, 0xAF, 0xC3, 0x9F, 0xFF,
+    0xC4, 0xAF, 0xFD, 0xA6, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97,
+    0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6E, 0x75, 0x9D,
+    0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76,
+    0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x50, 0x74, 0xAD, 0xA7, 0x70, 0xF7, 0x7F, 0xC7, 0x69, 0xFC,
+    0x76, 0xE9, 0xD9, 0x74, 0xAD, 0x90, 0xD9, 0x74, 0xDA, 0x1D, 0xA7, 0x3A, 0xD2, 0xE7, 0x3D, 0xA2,
+    0xAD, 0x72, 0xE3, 0xAD, 0x71, 0x9D, 0xA3, 0x9D, 0x97, 0x0E, 0x49, 0xD9, 0x7A, 0xD9, 0x5D, 0xA7,
+    0xE6, 0xDA, 0x6A, 0xD9, 0x6E, 0x59, 0xDA, 0x7E, 0x5E, 0x70, 0xAD, 0x49, 0xDA, 0x70, 0xAD, 0x93,
+    0xE7, 0x19, 0xD9, 0x2A, 0xDA, 0x72, 0xDA, 0x2E, 0x73, 0xE1, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE1, 0xFF, 0xFF, 0xE0, 0x9F, 0xFF, 0xFE, 0x00, 0x4A, 0xFF, 0xE9, 0x4F, 0xFF, 0x5F, 0xFF,
+    0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5F,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76,
+    0xE7, 0x59, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4,
+    0x9F, 0xFF, 0x4A, 0xFF, 0xEA, 0x40, 0x5F, 0xFF, 0xD6, 0xFF, 0xFD, 0x59, 0xFF, 0xFC, 0xA7, 0x7A,
+    0xE7, 0x79, 0xE7, 0x70, 0xE9, 0x77, 0xEA, 0x77, 0xAD, 0xA7, 0x79, 0xE7, 0x79, 0xE7, 0x70, 0xE9,
+    0x77, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x97, 0x7E, 0xA7, 0x7A, 0xE7, 0x79,
+    0xE7, 0x70, 0xE9, 0x77, 0xE9, 0x77, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xFF, 0xFE, 0x5F,
+    0xFF, 0xDA, 0x40, 0x4A, 0xD9, 0x71, 0xDA, 0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x39, 0xDA,
+    0x71, 0xE4, 0x9D, 0x97, 0x1E, 0x4A, 0xD9, 0x70, 0x9D, 0xA4, 0xE7, 0x19, 0xD9, 0x4E, 0x71, 0xAD,
+    0x93, 0x9D, 0xA7, 0x1E, 0x4A, 0xD9, 0x71, 0xE4, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA4, 0xFF,
+    0xFF, 0x94, 0xFF, 0xFF, 0x49, 0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1E, 0x4E, 0x71, 0x9D, 0xA4, 0xE7,
+    0x1A, 0xD9, 0x4D, 0xA7, 0x1E, 0x49, 0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1D, 0xA4, 0xE7, 0x19, 0xDA,
+    0x4E, 0x71, 0xAD, 0x93, 0x9D, 0xA7, 0x1E, 0x49, 0xD9, 0x71, 0xE4, 0x77, 0x74, 0x9F, 0xDA, 0x97,
+    0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E,
+    0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74,
+    0xE0, 0xE1, 0x99, 0x99, 0x99, 0x99, 0x92, 0xE9, 0xE1, 0xFF, 0xC9, 0x09, 0xE9, 0xDA, 0x1F, 0xFC,
+    0x90, 0x9E, 0xAD, 0xA7, 0x4A, 0xDA, 0xAD, 0xA7, 0x4E, 0x9A, 0xDA, 0x73, 0x9E, 0x0A, 0xDA, 0x73,
+    0xAE, 0x09, 0xE7, 0x3E, 0x91, 0xE7, 0x2F, 0x2F, 0x70, 0xAE, 0x39, 0xEA, 0x6F, 0x94, 0xAF, 0xA9,
+    0x99, 0xAF, 0xA6, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69, 0x99, 0x71, 0x4A, 0xFE, 0x94, 0xFF,
+    0x96, 0xAD, 0xA9, 0x70, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7,
+    0x2E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x71, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0xAD, 0xA6, 0x9F, 0xEA, 0x4A, 0xFF, 0x40, 0x4A, 0xD7,
+    0x0E, 0x5E, 0x7E, 0x95, 0xE6, 0xE9, 0x59, 0xDA, 0x5E, 0x96, 0xAD, 0x94, 0xE9, 0x7A, 0xD4, 0xE9,
+    0x70, 0xE3, 0xE9, 0x71, 0xE2, 0xE9, 0x71, 0x9D, 0xA1, 0xEA, 0x72, 0xAD, 0x90, 0xEA, 0x73, 0xE9,
+    0xEA, 0x74, 0xFE, 0xA7, 0x4F, 0xF7, 0x39, 0xEA, 0x09, 0xDA, 0x72, 0xAD, 0x92, 0xE7, 0x2E, 0x3A,
+    0xD9, 0x71, 0xE3, 0x9E, 0x70, 0x9D, 0xA4, 0xE9, 0x79, 0xD9, 0x49, 0xDA, 0x7A, 0xD9, 0x5E, 0x7E,
+    0x6A, 0xDA, 0x6E, 0x69, 0xE5, 0x9D, 0xA7, 0xE9, 0x4A, 0xD9, 0x79, 0xE4, 0x74, 0xE7, 0x7A, 0xE9,
+    0x76, 0xF9, 0x75, 0xAF, 0xA7, 0x49, 0xDA, 0xDA, 0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0A, 0xD7, 0x3E,
+    0x1A, 0xD7, 0x29, 0xDA, 0x1A, 0xD7, 0x2E, 0x29, 0xD9, 0x70, 0xAD, 0xA2, 0x9D, 0x97, 0x0E, 0x4D,
+    0xA7, 0xAD, 0x94, 0xDA, 0x7E, 0x5E, 0x6A, 0xD9, 0x5E, 0x59, 0xE6, 0xE5, 0xE9, 0x6A, 0xD4, 0x9E,
+    0x7A, 0xD9, 0x3E, 0x97, 0x9D, 0x92, 0x9E, 0x70, 0x9D, 0xA2, 0xE7, 0x2D, 0xA1, 0xAD, 0xA7, 0x2E,
+    0x1E, 0x73, 0xE0, 0xAD, 0xA7, 0x3E, 0x00, 0x4A, 0xE9, 0x73, 0xAF, 0x5F, 0xA7, 0x3F, 0xC5, 0xFC,
+    0x72, 0xAF, 0xA4, 0x9F, 0xC7, 0x2F, 0xC9, 0x4A, 0xDA, 0xD7, 0x1E, 0xAD, 0x5E, 0x9D, 0x70, 0x9D,
+    0x9E, 0x5D, 0xA0, 0xD9, 0x7E, 0x0E, 0x5D, 0xA0, 0xD9, 0x69, 0xD9, 0x9D, 0xA4, 0x9D, 0x90, 0xDA,
+    0x6E, 0x09, 0xD9, 0x4A, 0xD1, 0xDA, 0x59, 0xD1, 0xAD, 0x5E, 0x1E, 0x5D, 0xA1, 0xE5, 0xE1, 0xAD,
+    0x4A, 0xD2, 0xE5, 0xDA, 0x1A, 0xD4, 0xDA, 0x19, 0xDA, 0x49, 0xD9, 0x19, 0xD3, 0xAD, 0x2A, 0xD9,
+    0x4A, 0xD2, 0x9D, 0x92, 0xD9, 0x2E, 0x5E, 0x3D, 0x91, 0xE3, 0xE5, 0xDA, 0x3D, 0x90, 0x9D, 0x93,
+    0xE4, 0x9D, 0xA3, 0xDA, 0x0E, 0x39, 0xDA, 0x4A, 0xD9, 0x3D, 0xA9, 0xD9, 0x3A, 0xD9, 0x4A, 0xD4,
+    0xAF, 0xA4, 0xE5, 0xE4, 0xAF, 0x5E, 0x5D, 0xA4, 0x9E, 0xA4, 0x9D, 0xA4, 0x9D, 0x94, 0x9E, 0x59,
+    0xDA, 0x4A, 0xD6, 0xDA, 0x5A, 0xD9, 0x40, 0x4A, 0xDA, 0x72, 0xDA, 0x4F, 0x71, 0x9D, 0x94, 0xF9,
+    0x70, 0xAD, 0x93, 0x9F, 0xC7, 0x0E, 0x4A, 0xFC, 0x70, 0xE4, 0xE9, 0xDA, 0x7D, 0xA4, 0xDA, 0x0E,
+    0x69, 0xD9, 0x4D, 0xA0, 0xAD, 0x6A, 0xD4, 0x9D, 0x90, 0x9D, 0xA5, 0xE4, 0xAD, 0x2E, 0x5E, 0x4E,
+    0x2A, 0xD9, 0x39, 0xDA, 0x4E, 0x3D, 0xA3, 0xAD, 0x94, 0xDA, 0x3E, 0x3A, 0xD4, 0x9D, 0x93, 0x9D,
+    0x92, 0xE4, 0xAD, 0x5E, 0x2D, 0xA4, 0xE5, 0xAD, 0x19, 0xDA, 0x4D, 0xA5, 0x9D, 0xA0, 0xAD, 0x93,
+    0x9D, 0xA6, 0xE0, 0xAD, 0x4A, 0xD9, 0x6A, 0xD9, 0xE4, 0xAD, 0x70, 0xDA, 0xDA, 0x4E, 0x70, 0xFC,
+    0x94, 0xDA, 0x70, 0x9F, 0x49, 0xD9, 0x71, 0xF4, 0xAD, 0x72, 0xAE, 0x40, 0x59, 0xFF, 0xFA, 0x5A,
+    0xFF, 0xFA, 0x5A, 0xFF, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA7, 0x09, 0xFF, 0xD7, 0x0A, 0xFF, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFE, 0x4F, 0xFF,
+    0xDA, 0x30, 0x77, 0x74, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE,
+    0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73,
+    0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49,
+    0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0,
+    0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A,
+    0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x4A, 0xFF, 0xFE, 0xA4, 0xFF,
+    0xFF, 0xA4, 0xFF, 0xFF, 0x93, 0x9D, 0xA7, 0x1E, 0x49, 0xD9, 0x71, 0xE4, 0xAD, 0x97, 0x09, 0xDA,
+    0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1E, 0x4A, 0xD7,
+    0x19, 0xDA, 0x4E, 0x71, 0xAD, 0x94, 0xE7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0xAD, 0x97, 0x1E,
+    0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x4D, 0xA7, 0x1E, 0x49, 0xDA, 0x71, 0xE4, 0xAD, 0x97,
+    0x1E, 0x4E, 0x71, 0x9D, 0xA4, 0xE7, 0x1A, 0xD9, 0x39, 0xDA, 0x71, 0xE4, 0x9D, 0x97, 0x1E, 0x40,
+    0x4A, 0xFD, 0xAA, 0x70, 0xFF, 0xDA, 0x6F, 0xFE, 0xA4, 0x9D, 0xA4, 0xAE, 0x93, 0xAD, 0x95, 0xAD,
+    0xA3, 0xAD, 0x96, 0xE3, 0xE7, 0xE3, 0xE7, 0xE2, 0x9D, 0xA6, 0x9D, 0xA2, 0xAD, 0x96, 0xE9, 0x2E,
+    0x6A, 0xE3, 0xE4, 0x9F, 0x93, 0xFF, 0xF9, 0x39, 0xFF, 0xDA, 0x5A, 0xEA, 0xAA, 0xA9, 0x97, 0xE7,
+    0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD,
+    0x97, 0x50, 0x5A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD6, 0xFF, 0xFC, 0xA6, 0xE7, 0x71, 0x9D, 0xA7, 0x71,
+    0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE7, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x71, 0xAD, 0x97, 0x70, 0x9D,
+    0x97, 0x79, 0xDA, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0A, 0xD7, 0x70, 0xAD, 0x97, 0x79, 0xDA, 0x77,
+    0x9E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xE5,
+    0xFF, 0xFD, 0xA4, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0xFF, 0xFF, 0x6A, 0xD9, 0x74, 0xE7, 0x5E,
+    0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x4A,
+    0xD9, 0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xDA,
+    0x74, 0xAD, 0x97, 0x4E, 0x73, 0xAD, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x0E, 0x19, 0xDA, 0x7E, 0x92,
+    0xE6, 0x9E, 0x3E, 0x6E, 0x4A, 0xD9, 0x4E, 0x94, 0x9D, 0xA3, 0x9D, 0xA6, 0xE3, 0xE7, 0xE2, 0xE9,
+    0x7A, 0xD1, 0x9D, 0xA7, 0x09, 0xD9, 0x0E, 0x72, 0xDA, 0xAD, 0x97, 0x2A, 0xFA, 0x73, 0x9F, 0x75,
+    0xE9, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xDA, 0x75,
+    0xAD, 0x97, 0x5E, 0x74, 0x74, 0x9D, 0x97, 0x75, 0xAD, 0x97, 0x72, 0x99, 0xAE, 0xA9, 0x97, 0x49,
+    0xAF, 0xFF, 0xC9, 0x70, 0xFF, 0xFF, 0xD5, 0x9F, 0xA9, 0x19, 0xD9, 0x19, 0xAF, 0x39, 0xEA, 0x4A,
+    0xD4, 0x9E, 0x92, 0xE9, 0x5E, 0x59, 0xE1, 0xAD, 0xA6, 0xE6, 0xE1, 0xE6, 0x9D, 0xA6, 0xE0, 0x9D,
+    0xA6, 0xAD, 0x96, 0xE0, 0xAD, 0x96, 0xAD, 0x7E, 0x0E, 0x96, 0xE7, 0xE0, 0xE9, 0x6E, 0x69, 0xDA,
+    0x0E, 0x95, 0x9D, 0xA6, 0xE1, 0xAD, 0xA5, 0xAD, 0x95, 0xAD, 0xA1, 0x9E, 0x94, 0xE5, 0xAE, 0x3F,
+    0x93, 0xE3, 0x9F, 0x94, 0xFD, 0xAA, 0xEA, 0xAF, 0xD7, 0xAF, 0xFF, 0xE9, 0x72, 0x9A, 0xFF, 0xAA,
+    0x97, 0x70, 0xE7, 0x76, 0xE7, 0x75, 0x9D, 0xA7, 0x50, 0x5D, 0xA7, 0x1D, 0xA6, 0xE7, 0x0E, 0x96,
+    0x9D, 0xA6, 0xAD, 0x97, 0x0E, 0x5A, 0xDA, 0x71, 0xAD, 0x93, 0x9E, 0x72, 0x9D, 0xA3, 0xE7, 0x4E,
+    0x2E, 0x97, 0x4A, 0xD9, 0x0A, 0xD9, 0x76, 0xDA, 0x9D, 0xA7, 0x7F, 0xD7, 0x70, 0x9F, 0x77, 0x2E,
+    0x97, 0x71, 0xFA, 0x77, 0x0A, 0xFC, 0x77, 0x9D, 0xA9, 0xD9, 0x76, 0xE1, 0xDA, 0x75, 0xE2, 0xE7,
+    0x4A, 0xD9, 0x29, 0xD9, 0x72, 0x9D, 0xA4, 0xE7, 0x19, 0xE5, 0xE7, 0x1E, 0x69, 0xDA, 0x7E, 0x97,
+    0xE6, 0xAD, 0xA7, 0x0E, 0x94, 0x9E, 0x71, 0x9D, 0xA4, 0x2E, 0x5A, 0xD5, 0xAD, 0x92, 0xE5, 0xE5,
+    0xE2, 0x9D, 0xA5, 0xE5, 0xE2, 0xAD, 0x94, 0x9D, 0xA4, 0x9E, 0x2E, 0x94, 0xAD, 0x94, 0x9D, 0xA2,
+    0xE5, 0xE5, 0xAD, 0x92, 0xE5, 0xE5, 0xE2, 0x9D, 0xA4, 0x9E, 0x5E, 0x2A, 0xD9, 0x49, 0xDA, 0x49,
+    0xDA, 0x2E, 0x94, 0xAD, 0x94, 0xAD, 0x92, 0xE5, 0xE5, 0xE3, 0xE9, 0x4E, 0x49, 0xDA, 0x3E, 0x93,
+    0x9D, 0xA4, 0xE4, 0xAE, 0x3A, 0xD9, 0x3E, 0x95, 0xF9, 0x1E, 0x91, 0x9E, 0xA6, 0x9F, 0xFF, 0xE9,
+    0x70, 0x9F, 0xFF, 0xA7, 0x49, 0xAA, 0xFA, 0xA9, 0x77, 0x1A, 0xD9, 0x77, 0x4E, 0x77, 0x5E, 0x77,
+    0x5E, 0x77, 0x49, 0xDA, 0x77, 0x4A, 0xD9, 0x75, 0x77, 0x77, 0x09, 0xAF, 0xE9, 0x74, 0xFF, 0xF9,
+    0x70, 0x9F, 0xCA, 0x99, 0xAF, 0xC9, 0x69, 0xEA, 0x69, 0xF6, 0xE9, 0x71, 0xE9, 0x4A, 0xDA, 0x72,
+    0xAE, 0x4E, 0x73, 0x9E, 0x3A, 0xDA, 0x74, 0xE3, 0xE7, 0x5E, 0x3E, 0x75, 0xE2, 0x9E, 0x75, 0xE2,
+    0xAD, 0xA7, 0x5E, 0x2A, 0xDA, 0x74, 0x9D, 0xA2, 0xAD, 0xA7, 0x4A, 0xD9, 0x2A, 0xDA, 0x74, 0xE3,
+    0x9E, 0x73, 0x9D, 0xA4, 0xE7, 0x3E, 0x5E, 0x97, 0x1A, 0xD9, 0x59, 0xE7, 0x0A, 0xDA, 0x7A, 0xD9,
+    0x6A, 0xDA, 0x71, 0xE5, 0xAD, 0x95, 0x9A, 0xAA, 0xAF, 0x3F, 0xAA, 0xAA, 0x91, 0xAF, 0xF2, 0x9F,
+    0xF9, 0x1F, 0xFA, 0x2A, 0xFF, 0x20, 0x77, 0x7A, 0xFA, 0x2D, 0x49, 0xFF, 0x09, 0xD3, 0x9F, 0x99,
+    0x9D, 0xAD, 0xA3, 0xEA, 0x4F, 0xA2, 0xAD, 0xA5, 0x9E, 0x92, 0xE6, 0x9E, 0x2A, 0xDA, 0x69, 0xE2,
+    0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0xAE, 0x29,
+    0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xF9, 0x29, 0xE4, 0xAF, 0x4F, 0x19, 0xDA, 0xAD, 0x93, 0x9F, 0xEA,
+    0x0A, 0xF3, 0x9F, 0xC9, 0x2E, 0xA5, 0x99, 0x69, 0x30, 0x73, 0x99, 0x99, 0x74, 0x9F, 0xEA, 0x71,
+    0xAF, 0xFC, 0xA7, 0x9E, 0x92, 0x9E, 0x96, 0xE5, 0xAD, 0xA5, 0x9D, 0xA6, 0xE5, 0xE7, 0xE5, 0xE7,
+    0xDA, 0x49, 0xDA, 0x6A, 0xD9, 0x4A, 0xD9, 0x6E, 0x5E, 0x6E, 0x95, 0xE1, 0x99, 0x9A, 0xE9, 0x6E,
+    0x1F, 0xC9, 0x79, 0xDA, 0x1F, 0xCA, 0x7A, 0xD9, 0x49, 0xE6, 0xE6, 0x9D, 0xA5, 0xE7, 0xE4, 0x9D,
+    0xA7, 0xAD, 0x93, 0x9D, 0x97, 0xAD, 0x93, 0xAD, 0x97, 0xAD, 0x4E, 0x70, 0xE4, 0xE7, 0x9D, 0xA3,
+    0x9E, 0x7E, 0x93, 0xAF, 0x93, 0xAE, 0xA4, 0xAF, 0xFF, 0xA5, 0xE0, 0x9F, 0xE9, 0x6E, 0x39, 0x99,
+    0x70, 0x9D, 0xA7, 0x7A, 0xD9, 0x77, 0xE7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD9,
+    0x77, 0x9D, 0x97, 0xDA, 0x9D, 0xA6, 0x9D, 0xA0, 0xDA, 0x69, 0xDA, 0x0D, 0xA6, 0xAD, 0x90, 0xE6,
+    0xE1, 0xE6, 0xE1, 0xE5, 0x9D, 0xA1, 0xAD, 0x5A, 0xD2, 0xAD, 0x5D, 0xA2, 0xAD, 0x4A, 0xD3, 0x9D,
+    0x4D, 0xA3, 0x9D, 0x92, 0xE5, 0xD9, 0x19, 0xD9, 0x5D, 0x90, 0x9D, 0xA6, 0xD9, 0x0E, 0x7D, 0xAE,
+    0x70, 0xFC, 0x71, 0xAE, 0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xE7,
+    0x3E, 0x72, 0x71, 0x99, 0x99, 0x73, 0xAF, 0xE9, 0x7F, 0xFD, 0xA5, 0xAD, 0xA3, 0x9D, 0x6E, 0x76,
+    0xE7, 0x6E, 0x76, 0xAD, 0x97, 0x6E, 0x97, 0x59, 0xE9, 0x74, 0xAF, 0xA7, 0x1A, 0xFE, 0xA6, 0x9E,
+    0xA2, 0xE9, 0x49, 0xE9, 0x4E, 0x4E, 0x6A, 0xD9, 0x2A, 0xD9, 0x69, 0xDA, 0x2E, 0x70, 0xDA, 0x19,
+    0xDA, 0x70, 0xE1, 0x9D, 0x97, 0x9D, 0xA1, 0xAD, 0x97, 0x9D, 0xA1, 0xAD, 0x97, 0xE9, 0x19, 0xDA,
+    0x69, 0xE3, 0xE9, 0x5E, 0x93, 0xAE, 0x92, 0xAE, 0xA5, 0xFF, 0xDA, 0x7A, 0xFD, 0xA7, 0x49, 0x97,
+    0x10, 0x77, 0x4A, 0xFD, 0x94, 0x9F, 0xFC, 0x93, 0xEA, 0x99, 0x9A, 0xD3, 0xAD, 0xA7, 0x2A, 0xD7,
+    0x3A, 0xD7, 0x39, 0xD9, 0x73, 0xEA, 0xAA, 0x97, 0x0F, 0xCA, 0x6A, 0xFA, 0xA9, 0x5E, 0x97, 0x1A,
+    0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3A, 0xE9, 0x29, 0xAC, 0x4F, 0xFD, 0x5A, 0xFE, 0xA7, 0x99,
+    0x96, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93, 0xAF, 0xFF, 0x3A, 0xFF, 0xE9, 0x73, 0x9D, 0xA7,
+    0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE9, 0x73, 0xAD, 0xA7, 0x4E, 0x74, 0xE9, 0x73, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x97, 0x4F, 0x75, 0xFA, 0x97, 0x29, 0xFD, 0xA7, 0x2A, 0xFD, 0x73, 0x9A, 0xF7, 0x49,
+    0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x73, 0x9D, 0xA7, 0x4A, 0xAA, 0x60, 0x73, 0x99, 0x79,
+    0xD2, 0xFC, 0xA5, 0xAD, 0x09, 0xFF, 0x4E, 0x9D, 0xA9, 0x9A, 0xE9, 0x3F, 0xC9, 0x3E, 0x92, 0x9F,
+    0x5A, 0xDA, 0x2A, 0xE9, 0x5A, 0xD9, 0x2F, 0x6E, 0x92, 0xE9, 0x6E, 0x3E, 0x69, 0xE2, 0x9E, 0x6A,
+    0xDA, 0x2A, 0xDA, 0x6A, 0xD9, 0x2E, 0x96, 0xE3, 0xE7, 0xE3, 0xE6, 0x9E, 0x29, 0xDA, 0x6A, 0xDA,
+    0x2A, 0xD9, 0x6E, 0x92, 0xE9, 0x6E, 0x3E, 0x7E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE9, 0x75,
+    0xE7, 0x59, 0xE7, 0x5A, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x40, 0x70, 0x99, 0x99, 0x72, 0xAF, 0xD9,
+    0x7F, 0xFC, 0x95, 0xEA, 0x2A, 0xE4, 0xAD, 0xA4, 0xE4, 0xE5, 0xAD, 0x92, 0xAD, 0x95, 0x9D, 0x92,
+    0xE6, 0x9D, 0xA1, 0x9D, 0x96, 0x9D, 0xA1, 0xAD, 0x79, 0xD9, 0x1E, 0x7A, 0xD9, 0x09, 0xDA, 0x7E,
+    0x1A, 0xFF, 0xFD, 0x1F, 0xFF, 0xE1, 0xE9, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x1D, 0xA7, 0xAD, 0x91,
+    0xDA, 0x7E, 0x19, 0xDA, 0x7E, 0x19, 0xD9, 0x6A, 0xDA, 0x19, 0xD9, 0x6E, 0x29, 0xDA, 0x59, 0xDA,
+    0x29, 0xDA, 0x5E, 0x4E, 0x4A, 0xDA, 0x4A, 0xE1, 0x9F, 0x6F, 0xFC, 0x70, 0xFD, 0x97, 0x39, 0x97,
+    0x10, 0x29, 0xD9, 0x3E, 0x4E, 0x4E, 0x39, 0xDA, 0x3A, 0xD9, 0x3E, 0x4E, 0x4D, 0xA3, 0x9D, 0x93,
+    0xAD, 0x93, 0xE4, 0xE3, 0x9D, 0xA3, 0x9D, 0xA3, 0x9E, 0x91, 0x90, 0xFD, 0xA0, 0x9F, 0xC9, 0x39,
+    0x91, 0x39, 0xD9, 0x49, 0xE4, 0xAD, 0x93, 0x9E, 0x5E, 0x39, 0xE6, 0xE2, 0x9E, 0x69, 0xDA, 0x19,
+    0xE7, 0x9D, 0x90, 0x9E, 0x70, 0xAD, 0x1E, 0x71, 0xE0, 0xE7, 0x2F, 0xE7, 0x19, 0xFE, 0xA7, 0x0A,
+    0xEA, 0x0E, 0x70, 0xAD, 0x91, 0xAD, 0xA7, 0xE3, 0xE7, 0xE3, 0xAD, 0x95, 0x9D, 0xA4, 0xE5, 0xAD,
+    0x94, 0xE9, 0x4E, 0x59, 0xE4, 0xE6, 0xE9, 0x20, 0x59, 0x99, 0x97, 0x4A, 0xFC, 0x97, 0x2F, 0xE7,
+    0x6E, 0xA7, 0x6E, 0x76, 0xAD, 0x76, 0xAD, 0x97, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x5F, 0x74, 0xAF,
+    0x74, 0xFC, 0x73, 0xAD, 0x9D, 0x97, 0x19, 0xD9, 0x0D, 0xA7, 0x1E, 0x1D, 0xA7, 0x09, 0xD9, 0x1E,
+    0x70, 0xE2, 0xE7, 0x9D, 0x92, 0xAD, 0x7E, 0x3A, 0xD9, 0x5A, 0xD9, 0x39, 0xDA, 0x5E, 0x5D, 0xA4,
+    0xAD, 0x95, 0xE3, 0x9E, 0x6E, 0x3E, 0x7E, 0x91, 0x9D, 0xA7, 0xAE, 0xA0, 0xE7, 0x09, 0xEA, 0x76,
+    0x91, 0x49, 0xDA, 0x69, 0xD9, 0x4A, 0xD9, 0x6A, 0xD5, 0xE7, 0xE5, 0xE7, 0xE5, 0xE6, 0x9D, 0xA4,
+    0x9D, 0xA6, 0xAD, 0x94, 0xAD, 0x96, 0xAD, 0x5E, 0x7E, 0x5E, 0x7E, 0x5D, 0xA6, 0x9D, 0xA4, 0x9D,
+    0x96, 0xE9, 0x4A, 0xD9, 0x6E, 0x5E, 0x6F, 0x5E, 0x59, 0xEA, 0x49, 0xE4, 0x9F, 0xA4, 0xAE, 0xA1,
+    0x9A, 0xD9, 0xDA, 0x4A, 0xFF, 0xC1, 0xF9, 0x2E, 0x9F, 0xA2, 0xF3, 0xDA, 0x19, 0x95, 0x99, 0x39,
+    0xDA, 0x77, 0xAD, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x0D, 0xA7, 0x79, 0xD9, 0x77, 0xAD, 0x97, 0x70,
+    0x9D, 0x97, 0xDA, 0x9D, 0xA6, 0x9D, 0xA0, 0xDA, 0x69, 0xDA, 0x0D, 0xA6, 0xAD, 0x90, 0xE6, 0xE1,
+    0xE6, 0xE1, 0xE5, 0x9D, 0x91, 0xAD, 0x5A, 0xD2, 0xAD, 0x5D, 0xA2, 0xAD, 0x4A, 0xD3, 0x9D, 0x4D,
+    0xA3, 0x9D, 0x92, 0xE5, 0xD9, 0x19, 0xD9, 0x5D, 0x90, 0x9D, 0xA6, 0xD9, 0x0E, 0x7D, 0xAE, 0x70,
+    0xFC, 0x71, 0xF7, 0x00, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xEA, 0x3F, 0xFE, 0xA9,
+    0x59, 0xDA, 0x97, 0x29, 0xD9, 0x73, 0x9D, 0x97, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5A, 0xE7,
+    0x5F, 0xAA, 0x99, 0x97, 0x0A, 0xFE, 0x69, 0xFF, 0x95, 0xEA, 0x73, 0xE7, 0x4E, 0x75, 0xDA, 0x74,
+    0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0xA7, 0x4A, 0xE7, 0x5F, 0x74, 0xAF, 0xA7, 0x3A, 0xFC, 0xA9,
+    0x71, 0x9F, 0xDA, 0x73, 0x9F, 0x97, 0x4A, 0xDA, 0x74, 0xAD, 0x97, 0x4A, 0xD7, 0x5E, 0x74, 0xAD,
+    0x75, 0xAA, 0x96, 0x77, 0x69, 0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA,
+    0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70,
+    0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9,
+    0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x0F,
+    0xFF, 0xFE, 0x09, 0xFF, 0xFF, 0xE0, 0x9A, 0xAA, 0xEA, 0xAA, 0xAA, 0xAE, 0xAA, 0xA9, 0x4E, 0x5E,
+    0x79, 0xDA, 0x5E, 0x7A, 0xD9, 0x49, 0xDA, 0x7E, 0x5A, 0xD9, 0x7E, 0x5E, 0x70, 0xDA, 0x5E, 0x79,
+    0xDA, 0x5E, 0x7A, 0xD9, 0x49, 0xDA, 0x7E, 0x5A, 0xD9, 0x7E, 0x5E, 0x79, 0xDA, 0x5E, 0x7A, 0xD9,
+    0x5E, 0x7E, 0x6E, 0x7E, 0x6F, 0xC9, 0x4E, 0x69, 0xF9, 0x77, 0x09, 0x95, 0x77, 0x71, 0x9F, 0xCA,
+    0x71, 0xFF, 0xC7, 0xF9, 0x99, 0xF5, 0x9E, 0x4E, 0x94, 0xE5, 0x9D, 0xA3, 0x9D, 0xA6, 0xE3, 0xAD,
+    0x96, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x96, 0xAD, 0x92, 0xAD,
+    0x7E, 0x3E, 0x69, 0xE3, 0xE6, 0xE9, 0x29, 0xE5, 0xAE, 0x3A, 0xFA, 0x2A, 0xE4, 0xAD, 0xAF, 0xF9,
+    0x4E, 0x09, 0xFD, 0x6D, 0xA3, 0x99, 0x79, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA7,
+    0x59, 0xD9, 0x75, 0xAD, 0x97, 0x50, 0x77, 0x49, 0xFD, 0xA5, 0xFF, 0xC4, 0xF9, 0x99, 0x9A, 0xA3,
+    0xEA, 0x71, 0xAD, 0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x2E, 0x73, 0xE7, 0x3D, 0xA7, 0x29, 0xDA, 0x72,
+    0x9D, 0xA7, 0x29, 0xE7, 0x3E, 0x73, 0xF7, 0x3F, 0xA7, 0x19, 0xFD, 0x97, 0x0A, 0xFD, 0x71, 0x9F,
+    0xA7, 0x2A, 0xE7, 0x29, 0xDA, 0x72, 0x9D, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2A, 0xAA, 0x40, 0x69,
+    0xAF, 0xFC, 0xA4, 0xAF, 0xFF, 0xA2, 0x9F, 0xCA, 0xAA, 0xEA, 0xAA, 0x3E, 0xA4, 0xAD, 0x5E, 0xA5,
+    0x9D, 0xA3, 0x9E, 0x7E, 0x3A, 0xD9, 0x7E, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x29, 0xE7, 0x0E, 0x29,
+    0xDA, 0x70, 0xE2, 0x9D, 0xA7, 0x9D, 0xA2, 0x9E, 0x7E, 0x4E, 0x69, 0xE4, 0xEA, 0x5E, 0x59, 0xEA,
+    0x2A, 0xE9, 0x6A, 0xFF, 0xC9, 0x70, 0x9F, 0xDA, 0x75, 0x99, 0x72, 0x0F, 0xFF, 0xC0, 0x9F, 0xFF,
+    0xC0, 0x9A, 0xAA, 0xAF, 0xAA, 0xAA, 0xA5, 0xAD, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xEA, 0x19,
+    0x79, 0xFD, 0x70, 0xAF, 0xC7, 0x29, 0x96, 0x29, 0xD9, 0x6D, 0xA2, 0xE7, 0xE2, 0xE7, 0xE2, 0xE7,
+    0xE1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0x79, 0xDA, 0x09, 0xDA, 0x7A, 0xD9,
+    0x09, 0xDA, 0x7E, 0x90, 0xAD, 0x97, 0xE1, 0xE7, 0x9D, 0xA1, 0xE7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE5,
+    0x9E, 0x3A, 0xE9, 0x19, 0xF9, 0x4F, 0xFD, 0x96, 0xFE, 0xA7, 0x29, 0x99, 0x70, 0x77, 0x71, 0xAA,
+    0x49, 0xFC, 0x6A, 0xDA, 0x2A, 0xFE, 0x4A, 0xE2, 0x9E, 0x99, 0xAE, 0x29, 0xE3, 0xE3, 0xE2, 0xE9,
+    0x3D, 0xA3, 0xAD, 0x90, 0x9E, 0x39, 0xD9, 0x3A, 0xD9, 0x0A, 0xD9, 0x3A, 0xD4, 0xAD, 0x90, 0xE4,
+    0xE4, 0xAD, 0x90, 0xE4, 0xDA, 0x4E, 0x1D, 0xA3, 0x9D, 0xA4, 0xE0, 0x9D, 0xA3, 0xAD, 0x93, 0x9D,
+    0xA1, 0xDA, 0x3A, 0xD4, 0xE9, 0x1E, 0x3E, 0x39, 0xE2, 0xE3, 0xDA, 0x3E, 0x92, 0xAE, 0x19, 0xD9,
+    0x19, 0xEA, 0x4F, 0x9A, 0xD9, 0x9A, 0xEA, 0x6F, 0xFF, 0x97, 0x0A, 0xFF, 0x97, 0x49, 0xDA, 0x97,
+    0x79, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x71, 0xDA, 0x77, 0x09, 0xD9, 0x77, 0x0A, 0xD9, 0x77,
+    0x0A, 0xD7, 0x40, 0x39, 0xE7, 0x1E, 0x4A, 0xF7, 0xE9, 0x49, 0x9E, 0x95, 0x9D, 0xA7, 0x9D, 0xA5,
+    0xE7, 0x1E, 0x4E, 0x72, 0xAD, 0x39, 0xD9, 0x72, 0x9D, 0x92, 0xE7, 0x4D, 0xA1, 0xE7, 0x5E, 0x09,
+    0xD9, 0x75, 0xAD, 0x9D, 0xA7, 0x69, 0xFC, 0x77, 0x0F, 0x97, 0x70, 0xEA, 0x77, 0x1E, 0x97, 0x70,
+    0xAE, 0xA7, 0x79, 0xFC, 0x77, 0xDA, 0xE7, 0x6A, 0xD0, 0xAD, 0x97, 0x49, 0xD9, 0x09, 0xDA, 0x74,
+    0xE2, 0xE7, 0x3A, 0xD3, 0xE7, 0x29, 0xDA, 0x39, 0xD9, 0x71, 0xE5, 0xE7, 0x0E, 0x95, 0xEA, 0x99,
+    0x49, 0xDA, 0x69, 0xFC, 0x4E, 0x70, 0x9E, 0x93, 0x74, 0x99, 0x77, 0x29, 0xDA, 0x77, 0x1A, 0xD9,
+    0x77, 0x1A, 0xD7, 0x72, 0xE7, 0x72, 0xDA, 0x77, 0x19, 0xD9, 0x77, 0x1A, 0xD9, 0x71, 0x9D, 0x93,
+    0xE3, 0xE3, 0xE4, 0xE3, 0xE3, 0xE4, 0xDA, 0x3E, 0x3E, 0x39, 0xD9, 0x3E, 0x29, 0xDA, 0x3A, 0xD4,
+    0xE2, 0xAD, 0x93, 0xE4, 0xE2, 0xE4, 0xE4, 0xE2, 0xE3, 0x9D, 0xA4, 0xDA, 0x19, 0xDA, 0x3A, 0xD9,
+    0x39, 0xDA, 0x19, 0xD9, 0x3A, 0xD4, 0xAD, 0x91, 0xAD, 0x93, 0xE4, 0xE2, 0xE4, 0xDA, 0x39, 0xDA,
+    0x2E, 0x39, 0xDA, 0x3E, 0x3A, 0xD9, 0x2A, 0xD9, 0x2A, 0xDA, 0x3A, 0xE2, 0xE2, 0xAE, 0x5F, 0x90,
+    0xE9, 0xAF, 0x69, 0xFF, 0xFA, 0x71, 0xAF, 0xFA, 0x76, 0xAD, 0x97, 0x71, 0xE7, 0x72, 0xE7, 0x72,
+    0xDA, 0x77, 0x19, 0xD9, 0x77, 0x1A, 0xD7, 0x72, 0xE7, 0x72, 0xDA, 0x74, 0x49, 0xDA, 0x71, 0x9D,
+    0x95, 0xE7, 0x3E, 0x4E, 0x74, 0xE3, 0xAD, 0x97, 0x4A, 0xD9, 0x2E, 0x75, 0x9D, 0x91, 0xAD, 0x97,
+    0x59, 0xDA, 0x1E, 0x59, 0xD5, 0x9D, 0xA0, 0x9D, 0xA5, 0xAD, 0x59, 0xDA, 0x0A, 0xD9, 0x5E, 0x59,
+    0xD9, 0x0E, 0x6D, 0xA5, 0xAD, 0x90, 0xE5, 0x9D, 0x95, 0xE1, 0xE5, 0xAD, 0x6E, 0x1E, 0x5E, 0x59,
+    0xDA, 0x1E, 0x49, 0xE5, 0xE2, 0xAD, 0x93, 0xF9, 0x3A, 0xDA, 0x29, 0xE9, 0x09, 0xDA, 0xAD, 0x91,
+    0xAE, 0x4A, 0xFE, 0x1F, 0xF6, 0xAF, 0xC2, 0x9F, 0xCA, 0x71, 0x99, 0x79, 0x96, 0x74, 0xE7, 0x7A,
+    0xE9, 0x76, 0xF9, 0x75, 0xFC, 0xA7, 0x49, 0xD9, 0xDA, 0x74, 0xE0, 0xE7, 0x39, 0xDA, 0x0E, 0x73,
+    0xE1, 0xAD, 0x72, 0x9D, 0xA1, 0xAD, 0x72, 0xE2, 0xAD, 0x97, 0x0A, 0xD9, 0x29, 0xD9, 0x70, 0xE3,
+    0x9D, 0xA7, 0xAD, 0x94, 0xDA, 0x7E, 0x5E, 0x6A, 0xFF, 0xF5, 0x9F, 0xFF, 0xC5, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x49, 0xE7, 0xAD, 0x93, 0xE7, 0x0A, 0xD9, 0x29, 0xDA, 0x70, 0x9D, 0xA2, 0xE7, 0x19,
+    0xDA, 0x1A, 0xDA, 0x72, 0xE1, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xE7, 0x77, 0x77, 0x79, 0xCA, 0x77,
+    0x0E, 0x97, 0x7E, 0x77, 0x09, 0xC9, 0x71, 0x77, 0x7A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99,
+    0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E,
+    0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA,
+    0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F,
+    0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x77, 0x72, 0xD7, 0x6E, 0x97, 0x5E, 0x97, 0x59, 0xCA, 0x72, 0x74,
+    0x9D, 0xA9, 0x76, 0xAF, 0xC7, 0x70, 0x9D, 0x77, 0x1D, 0x77, 0xAD, 0xA7, 0x6E, 0x97, 0x69, 0xCA,
+    0x77, 0x09, 0xC9, 0x77, 0x77, 0x4E, 0x77, 0xAE, 0x97, 0x6F, 0x97, 0x5F, 0xCA, 0x74, 0x9D, 0x9D,
+    0xA7, 0x4E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3E, 0x1A, 0xD7, 0x29, 0xDA, 0x1A, 0xD7, 0x2E, 0x2A,
+    0xD9, 0x70, 0xAD, 0x92, 0x9D, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4D, 0xA7, 0xE5, 0xE6, 0xAF,
+    0xFF, 0x59, 0xFF, 0xFC, 0x5E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0x9E, 0x7A, 0xD9, 0x3E, 0x70, 0xAD,
+    0x92, 0x9D, 0xA7, 0x09, 0xDA, 0x2E, 0x71, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xE0, 0xAD,
+    0xA7, 0x3E, 0x00, 0x71, 0x99, 0x76, 0xAF, 0x97, 0x39, 0x9A, 0xE7, 0x69, 0xD7, 0x6A, 0xD7, 0x4F,
+    0x74, 0x9D, 0x97, 0x5A, 0xC9, 0x77, 0x97, 0x77, 0x6A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99,
+    0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E,
+    0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA,
+    0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F,
+    0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30, 0x77, 0x4A, 0xD9, 0x77, 0x39, 0xD9, 0x76, 0xE1, 0x9D, 0x97,
+    0x6F, 0xA0, 0xAA, 0x77, 0xE9, 0xD9, 0x77, 0x0D, 0x91, 0x9D, 0x77, 0xCA, 0x49, 0xC9, 0x77, 0x77,
+    0x77, 0x77, 0x3E, 0x77, 0x4A, 0xE9, 0x77, 0x3F, 0x97, 0x72, 0xFC, 0xA7, 0x71, 0x9D, 0x9D, 0xA7,
+    0x71, 0xE0, 0xE7, 0x70, 0x9D, 0xA0, 0xE7, 0x70, 0xE1, 0xAD, 0x77, 0x9D, 0xA1, 0xAD, 0x77, 0xE2,
+    0xAD, 0x97, 0x5A, 0xD9, 0x29, 0xD9, 0x75, 0xE3, 0x9D, 0xA7, 0x4A, 0xD9, 0x4D, 0xA7, 0x4E, 0x5E,
+    0x73, 0xAF, 0xFF, 0x72, 0x9F, 0xFF, 0xC7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE7, 0x19, 0xE7, 0xAD,
+    0x97, 0x0E, 0x70, 0xAD, 0x97, 0x9D, 0xA7, 0x09, 0xDA, 0x7E, 0x71, 0x9D, 0xA6, 0xAD, 0xA7, 0x2E,
+    0x6E, 0x73, 0xE5, 0xAD, 0xA7, 0x3E, 0x50, 0x77, 0x77, 0x5E, 0x97, 0x7A, 0xD7, 0x29, 0xE1, 0xAD,
+    0x72, 0x9F, 0xA0, 0xA9, 0x72, 0x9D, 0xAA, 0xD7, 0x49, 0xD9, 0x19, 0xD7, 0x3C, 0xA4, 0x9C, 0x97,
+    0x77, 0x77, 0x74, 0xAF, 0xA2, 0xD7, 0x0F, 0xF0, 0x9D, 0x7F, 0x99, 0x9D, 0xAE, 0x6E, 0xA4, 0xFA,
+    0x5A, 0xE5, 0x9E, 0x95, 0xE7, 0xE5, 0x9D, 0xA7, 0xE5, 0xE9, 0x7E, 0x5E, 0x79, 0xDA, 0x5E, 0x7A,
+    0xD9, 0x49, 0xDA, 0x7E, 0x59, 0xDA, 0x69, 0xE5, 0x9D, 0xA6, 0xEA, 0x59, 0xDA, 0x5A, 0xE9, 0x6E,
+    0x4A, 0xF9, 0x6F, 0x19, 0xEA, 0xD7, 0x9F, 0xEA, 0x0A, 0xD7, 0x09, 0xFC, 0x91, 0xAC, 0xA7, 0x39,
+    0x76, 0x6A, 0xD7, 0x71, 0xD9, 0x77, 0x1D, 0x2E, 0x74, 0xA9, 0x0F, 0xA7, 0x5E, 0x9D, 0x97, 0x3D,
+    0x91, 0x9D, 0x72, 0xCA, 0x49, 0xC9, 0x77, 0x77, 0x77, 0x4E, 0x77, 0xAE, 0x97, 0x6F, 0x97, 0x5F,
+    0xCA, 0x74, 0x9D, 0x9D, 0xA7, 0x4E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3E, 0x1A, 0xD7, 0x29, 0xDA,
+    0x1A, 0xD7, 0x2E, 0x2A, 0xD9, 0x70, 0xAD, 0x92, 0x9D, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9, 0x4D,
+    0xA7, 0xE5, 0xE6, 0xAF, 0xFF, 0x59, 0xFF, 0xFC, 0x5E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0x9E, 0x7A,
+    0xD9, 0x3E, 0x70, 0xAD, 0x92, 0x9D, 0xA7, 0x09, 0xDA, 0x2E, 0x71, 0x9D, 0xA1, 0xAD, 0xA7, 0x2E,
+    0x1E, 0x73, 0xE0, 0xAD, 0xA7, 0x3E, 0x00, 0x77, 0x4A, 0xD7, 0x7D, 0x97, 0x7D, 0x19, 0xE7, 0x2A,
+    0x09, 0xFA, 0x72, 0x9D, 0xAA, 0xD7, 0x19, 0xD9, 0x19, 0xD7, 0x0C, 0xA4, 0x9C, 0x97, 0x77, 0x77,
+    0x3A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E,
+    0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA,
+    0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F,
+    0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30, 0x77, 0x29,
+    0xA9, 0x77, 0x4A, 0xE7, 0x75, 0x9C, 0x97, 0x73, 0x9D, 0x76, 0xE1, 0xAC, 0xA7, 0x6F, 0xA0, 0x99,
+    0x76, 0xE9, 0xD9, 0x77, 0xD9, 0x19, 0xD7, 0x6C, 0xA4, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x70, 0xE7,
+    0x73, 0xAE, 0x97, 0x72, 0xF9, 0x77, 0x1F, 0xCA, 0x77, 0x09, 0xD9, 0xDA, 0x77, 0x0E, 0x0E, 0x77,
+    0x9D, 0xA0, 0xE7, 0x7E, 0x1A, 0xD7, 0x69, 0xDA, 0x1A, 0xD7, 0x6E, 0x2A, 0xD9, 0x74, 0xAD, 0x92,
+    0x9D, 0x97, 0x4E, 0x39, 0xDA, 0x73, 0xAD, 0x94, 0xDA, 0x73, 0xE5, 0xE7, 0x2A, 0xFF, 0xF7, 0x19,
+    0xFF, 0xFC, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x70, 0x9E, 0x7A, 0xD9, 0x7E, 0x70, 0xAD, 0x96,
+    0x9D, 0xA7, 0x09, 0xDA, 0x6E, 0x71, 0x9D, 0xA5, 0xAD, 0xA7, 0x2E, 0x5E, 0x73, 0xE4, 0xAD, 0xA7,
+    0x3E, 0x40, 0x76, 0xAA, 0xA7, 0x70, 0xAA, 0xD7, 0x71, 0xAC, 0x77, 0x09, 0xD7, 0x19, 0xE1, 0xD9,
+    0x71, 0x9F, 0xA0, 0x97, 0x29, 0xDA, 0xAD, 0x73, 0x9D, 0x91, 0x9D, 0x72, 0xCA, 0x49, 0xC9, 0x77,
+    0x77, 0x77, 0x1A, 0xFA, 0x2D, 0x7F, 0xF0, 0x9D, 0x6F, 0x99, 0x9D, 0xAE, 0x5E, 0xA4, 0xFA, 0x4A,
+    0xE5, 0x9E, 0x94, 0xE7, 0xE4, 0x9D, 0xA7, 0xE4, 0xE9, 0x7E, 0x4E, 0x79, 0xDA, 0x4E, 0x7A, 0xD9,
+    0x39, 0xDA, 0x7E, 0x49, 0xDA, 0x69, 0xE4, 0x9D, 0xA6, 0xEA, 0x49, 0xDA, 0x5A, 0xE9, 0x5E, 0x4A,
+    0xF9, 0x5F, 0x19, 0xEA, 0xD6, 0x9F, 0xEA, 0x0A, 0xD7, 0x9F, 0xC9, 0x1A, 0xCA, 0x72, 0x97, 0x50,
+    0x74, 0x99, 0x59, 0x74, 0xFA, 0x2D, 0x73, 0xFF, 0xD9, 0x72, 0x9C, 0x92, 0xAE, 0x97, 0x49, 0x77,
+    0x70, 0xE7, 0x72, 0xFA, 0x77, 0x0E, 0x9D, 0x97, 0x6D, 0x91, 0x9D, 0x75, 0xCA, 0x49, 0xC9, 0x77,
+    0x77, 0x77, 0x75, 0xE7, 0x72, 0xAE, 0x97, 0x71, 0xF9, 0x77, 0x0F, 0xCA, 0x77, 0x9D, 0x9D, 0xA7,
+    0x7E, 0x0E, 0x76, 0x9D, 0xA0, 0xE7, 0x6E, 0x1A, 0xD7, 0x59, 0xDA, 0x1A, 0xD7, 0x5E, 0x2A, 0xD9,
+    0x73, 0xAD, 0x92, 0x9D, 0x97, 0x3E, 0x39, 0xDA, 0x72, 0xAD, 0x94, 0xDA, 0x72, 0xE5, 0xE7, 0x1A,
+    0xFF, 0xF7, 0x09, 0xFF, 0xFC, 0x70, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x79, 0xE7, 0xAD, 0x96, 0xE7,
+    0x0A, 0xD9, 0x59, 0xDA, 0x70, 0x9D, 0xA5, 0xE7, 0x19, 0xDA, 0x4A, 0xDA, 0x72, 0xE4, 0xE7, 0x3E,
+    0x3A, 0xDA, 0x73, 0xE3, 0x70, 0x99, 0x49, 0x96, 0x9F, 0xA1, 0x9C, 0xA6, 0xDA, 0xFE, 0x6A, 0xC9,
+    0x2A, 0xE9, 0x77, 0x73, 0x9E, 0x74, 0x9F, 0xA7, 0x29, 0xDA, 0xAD, 0x71, 0x9D, 0x91, 0x9D, 0x70,
+    0xCA, 0x49, 0xC9, 0x77, 0x77, 0x73, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3,
+    0xEA, 0x4F, 0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D,
+    0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5,
+    0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC,
+    0xA7, 0x09, 0x73, 0x75, 0x9A, 0xA7, 0x7A, 0xEA, 0x75, 0x9F, 0xC7, 0x49, 0xDA, 0x0D, 0xA7, 0x29,
+    0xD9, 0x2D, 0x97, 0x09, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x77, 0x4E, 0x77, 0xAE, 0x97, 0x6F, 0x97,
+    0x5F, 0xCA, 0x74, 0x9D, 0x9D, 0xA7, 0x4E, 0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3E, 0x1A, 0xD7, 0x29,
+    0xDA, 0x1A, 0xD7, 0x2E, 0x2A, 0xD9, 0x70, 0xAD, 0x92, 0x9D, 0x97, 0x0E, 0x39, 0xDA, 0x7A, 0xD9,
+    0x4D, 0xA7, 0xE5, 0xE6, 0xAF, 0xFF, 0x59, 0xFF, 0xFC, 0x5E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE4, 0x9E,
+    0x7A, 0xD9, 0x3E, 0x70, 0xAD, 0x92, 0x9D, 0xA7, 0x09, 0xDA, 0x2E, 0x71, 0x9D, 0xA1, 0xAD, 0xA7,
+    0x2E, 0x1E, 0x73, 0xE0, 0xAD, 0xA7, 0x3E, 0x77, 0x77, 0x77, 0x9C, 0xA7, 0x70, 0xE9, 0x77, 0xE7,
+    0x70, 0x9C, 0x97, 0x10, 0x71, 0xAA, 0xA7, 0x5A, 0xE9, 0x73, 0xAF, 0xC7, 0x2A, 0xD9, 0x0D, 0xA7,
+    0x0A, 0xD2, 0x9D, 0x79, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x73, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4,
+    0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E,
+    0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA,
+    0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD,
+    0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x77, 0x77, 0x2D, 0x76, 0xE9, 0x75, 0xE9, 0x75, 0x9C, 0xA7,
+    0x20, 0x77, 0x77, 0x5E, 0x77, 0x0E, 0x77, 0x0A, 0xCA, 0x75, 0x91, 0x9A, 0x19, 0x97, 0x29, 0xCA,
+    0x4D, 0x73, 0xDA, 0x99, 0xAD, 0xA7, 0x39, 0xFD, 0xA7, 0x59, 0xAD, 0xA9, 0x77, 0x77, 0x77, 0x71,
+    0xE7, 0x70, 0xAE, 0x97, 0x7F, 0x97, 0x6F, 0xCA, 0x75, 0x9D, 0x9D, 0xA7, 0x5E, 0x0E, 0x74, 0x9D,
+    0xA0, 0xE7, 0x4E, 0x1A, 0xD7, 0x39, 0xDA, 0x1A, 0xD7, 0x3E, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0x9D,
+    0x97, 0x1E, 0x39, 0xDA, 0x70, 0xAD, 0x94, 0xDA, 0x70, 0xE5, 0xE7, 0xAF, 0xFF, 0x69, 0xFF, 0xFC,
+    0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE5, 0x9E, 0x7A, 0xD9, 0x4E, 0x70, 0xAD, 0x93, 0x9D, 0xA7, 0x09,
+    0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0xAD, 0xA7, 0x2E, 0x2E, 0x73, 0xE1, 0xAD, 0xA7, 0x3E, 0x10, 0x77,
+    0x76, 0xDA, 0x75, 0xDA, 0x75, 0xD9, 0x71, 0x9A, 0x19, 0xA1, 0x9A, 0x7A, 0xCA, 0x39, 0xD7, 0x0D,
+    0xAA, 0xAA, 0xD9, 0x70, 0xAF, 0xD9, 0x72, 0x9A, 0xDA, 0x77, 0x77, 0x76, 0xAF, 0xA2, 0xD5, 0xFF,
+    0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3, 0xEA, 0x4F, 0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA,
+    0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E,
+    0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE,
+    0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC, 0xA7, 0x09, 0x73, 0x77, 0x77, 0x0A, 0xD7, 0x72, 0xD9, 0x77,
+    0x2D, 0x77, 0x92, 0xA9, 0x09, 0x97, 0x29, 0xCA, 0x4D, 0x73, 0xDA, 0x99, 0xAD, 0xA7, 0x39, 0xFD,
+    0xA7, 0x59, 0xAD, 0xA9, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x70, 0xAE, 0x97, 0x7F, 0x97, 0x6F, 0xCA,
+    0x75, 0x9D, 0x9D, 0xA7, 0x5E, 0x0E, 0x74, 0x9D, 0xA0, 0xE7, 0x4E, 0x1A, 0xD7, 0x39, 0xDA, 0x1A,
+    0xD7, 0x3E, 0x2A, 0xD9, 0x71, 0xAD, 0x92, 0x9D, 0x97, 0x1E, 0x39, 0xDA, 0x70, 0xAD, 0x94, 0xDA,
+    0x70, 0xE5, 0xE7, 0xAF, 0xFF, 0x69, 0xFF, 0xFC, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xE5, 0x9E, 0x7A,
+    0xD9, 0x4E, 0x70, 0xAD, 0x93, 0x9D, 0xA7, 0x09, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0xAD, 0xA7, 0x2E,
+    0x2E, 0x73, 0xE1, 0xAD, 0xA7, 0x3E, 0x10, 0x77, 0x71, 0xE7, 0x7D, 0x97, 0x7D, 0x73, 0x9A, 0x2A,
+    0x19, 0xA7, 0xAC, 0xA3, 0x9D, 0x70, 0xDA, 0xAA, 0xAD, 0x97, 0x0A, 0xFD, 0x97, 0x29, 0xAD, 0xA7,
+    0x77, 0x77, 0x6A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A,
+    0xE5, 0x9E, 0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9,
+    0x19, 0xDA, 0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A,
+    0xF9, 0x3F, 0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30,
+    0x77, 0x77, 0x2F, 0x77, 0x2A, 0xC9, 0x77, 0x1A, 0xC9, 0x77, 0x9D, 0xA7, 0x59, 0x1A, 0xC1, 0x99,
+    0x72, 0x9C, 0xA4, 0xD7, 0x3D, 0xA9, 0x9A, 0xDA, 0x73, 0x9F, 0xDA, 0x75, 0x9A, 0xDA, 0x97, 0x77,
+    0x77, 0x77, 0x1E, 0x77, 0x0A, 0xE9, 0x77, 0xF9, 0x76, 0xFC, 0xA7, 0x59, 0xD9, 0xDA, 0x75, 0xE0,
+    0xE7, 0x49, 0xDA, 0x0E, 0x74, 0xE1, 0xAD, 0x73, 0x9D, 0xA1, 0xAD, 0x73, 0xE2, 0xAD, 0x97, 0x1A,
+    0xD9, 0x29, 0xD9, 0x71, 0xE3, 0x9D, 0xA7, 0x0A, 0xD9, 0x4D, 0xA7, 0x0E, 0x5E, 0x7A, 0xFF, 0xF6,
+    0x9F, 0xFF, 0xC6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x59, 0xE7, 0xAD, 0x94, 0xE7, 0x0A, 0xD9, 0x39,
+    0xDA, 0x70, 0x9D, 0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xDA, 0x72, 0xE2, 0xE7, 0x3E, 0x1A, 0xDA, 0x73,
+    0xE1, 0x72, 0x97, 0x7E, 0xA7, 0x7A, 0xC7, 0x7D, 0x75, 0xAD, 0x97, 0x19, 0xA1, 0xAA, 0x19, 0xA7,
+    0xAC, 0xA3, 0x9D, 0x70, 0xDA, 0xAA, 0xAD, 0x97, 0x0A, 0xFD, 0x97, 0x29, 0xAD, 0xA7, 0x77, 0x77,
+    0x6A, 0xFA, 0x2D, 0x5F, 0xF0, 0x9D, 0x4F, 0x99, 0x9D, 0xAE, 0x3E, 0xA4, 0xFA, 0x2A, 0xE5, 0x9E,
+    0x92, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0xE9, 0x7E, 0x2E, 0x79, 0xDA, 0x2E, 0x7A, 0xD9, 0x19, 0xDA,
+    0x7E, 0x29, 0xDA, 0x69, 0xE2, 0x9D, 0xA6, 0xEA, 0x29, 0xDA, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3F,
+    0x19, 0xEA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0x9F, 0xC9, 0x1A, 0xCA, 0x70, 0x97, 0x30, 0x74, 0x99,
+    0x49, 0x97, 0x29, 0xFA, 0x19, 0xCA, 0x72, 0xDA, 0xFE, 0x72, 0xAC, 0x91, 0x9F, 0x97, 0x39, 0x77,
+    0x49, 0x69, 0x73, 0x9C, 0xA4, 0xD7, 0x4D, 0xA9, 0x9A, 0xDA, 0x74, 0x9F, 0xDA, 0x76, 0x9A, 0xDA,
+    0x97, 0x77, 0x77, 0x77, 0x4E, 0x77, 0x1A, 0xE9, 0x77, 0x0F, 0x97, 0x7F, 0xCA, 0x76, 0x9D, 0x9D,
+    0xA7, 0x6E, 0x0E, 0x75, 0x9D, 0xA0, 0xE7, 0x5E, 0x1A, 0xD7, 0x49, 0xDA, 0x1A, 0xD7, 0x4E, 0x2A,
+    0xD9, 0x72, 0xAD, 0x92, 0x9D, 0x97, 0x2E, 0x39, 0xDA, 0x71, 0xAD, 0x94, 0xDA, 0x71, 0xE5, 0xE7,
+    0x0A, 0xFF, 0xF7, 0x9F, 0xFF, 0xC7, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x69, 0xE7, 0xAD, 0x95, 0xE7,
+    0x0A, 0xD9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x19, 0xDA, 0x3A, 0xDA, 0x72, 0xE3, 0xE7, 0x3E,
+    0x2A, 0xDA, 0x73, 0xE2, 0x70, 0x99, 0x49, 0x96, 0xAF, 0x91, 0x9C, 0x95, 0x9D, 0xAF, 0xE6, 0xAC,
+    0x29, 0xF7, 0x77, 0x19, 0x95, 0x99, 0x7A, 0xCA, 0x39, 0xD7, 0x9D, 0xAA, 0xAA, 0xD9, 0x70, 0xAF,
+    0xD9, 0x72, 0x9A, 0xDA, 0x77, 0x77, 0x76, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA,
+    0xE3, 0xEA, 0x4F, 0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7,
+    0x9D, 0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D,
+    0xA5, 0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91,
+    0xAC, 0xA7, 0x09, 0x73, 0x72, 0xA9, 0x49, 0xA7, 0x3D, 0x4D, 0x73, 0xEA, 0xAE, 0xA7, 0x39, 0xFD,
+    0xA7, 0x6A, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x1E, 0x77, 0x0A, 0xE9, 0x77, 0xF9, 0x76, 0xFC, 0xA7,
+    0x59, 0xD9, 0xDA, 0x75, 0xE0, 0xE7, 0x49, 0xDA, 0x0E, 0x74, 0xE1, 0xAD, 0x73, 0x9D, 0xA1, 0xAD,
+    0x73, 0xE2, 0xAD, 0x97, 0x1A, 0xD9, 0x29, 0xD9, 0x71, 0xE3, 0x9D, 0xA7, 0x0A, 0xD9, 0x4D, 0xA7,
+    0x0E, 0x5E, 0x7A, 0xFF, 0xF6, 0x9F, 0xFF, 0xC6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x59, 0xE7, 0xAD,
+    0x94, 0xE7, 0x0A, 0xD9, 0x39, 0xDA, 0x70, 0x9D, 0xA3, 0xE7, 0x19, 0xDA, 0x2A, 0xDA, 0x72, 0xE2,
+    0xE7, 0x3E, 0x1A, 0xDA, 0x73, 0xE7, 0x77, 0x77, 0x72, 0x9C, 0xA7, 0x71, 0xE9, 0x77, 0x0E, 0x77,
+    0x19, 0xC9, 0x72, 0x6A, 0x94, 0xAA, 0x79, 0xCA, 0x39, 0xD7, 0x0E, 0xAA, 0xE9, 0x70, 0xAF, 0xDA,
+    0x72, 0x9A, 0xDA, 0x77, 0x77, 0x76, 0xAF, 0xA2, 0xD5, 0xFF, 0x09, 0xD4, 0xF9, 0x99, 0xDA, 0xE3,
+    0xEA, 0x4F, 0xA2, 0xAE, 0x59, 0xE9, 0x2E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E, 0x97, 0xE2, 0xE7, 0x9D,
+    0xA2, 0xE7, 0xAD, 0x91, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E, 0x29, 0xDA, 0x6E, 0xA2, 0x9D, 0xA5,
+    0xAE, 0x93, 0xE4, 0xAF, 0x93, 0xF1, 0x9E, 0xAD, 0x49, 0xFE, 0xA0, 0xAD, 0x59, 0xFC, 0x91, 0xAC,
+    0xA7, 0x09, 0x77, 0x77, 0x2D, 0x76, 0xE9, 0x75, 0xE9, 0x75, 0x9C, 0xA7, 0x20, 0x4A, 0xFF, 0xE9,
+    0x4F, 0xFF, 0x5F, 0xFF, 0x49, 0xDA, 0x75, 0xAD, 0x97, 0x5A, 0xD7, 0x6E, 0x76, 0xE7, 0x59, 0xDA,
+    0x75, 0xAD, 0x97, 0x5F, 0xAA, 0xAA, 0xAA, 0xA9, 0x5F, 0xFE, 0x95, 0xFF, 0xE9, 0x49, 0xDA, 0x75,
+    0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0x9D, 0x97, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xEA, 0x77, 0x77, 0x75, 0xAC, 0x97, 0x5A, 0xDA,
+    0x75, 0xAD, 0xA7, 0x6C, 0xA7, 0x20, 0x77, 0x4A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E,
+    0xA3, 0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A,
+    0xF9, 0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E,
+    0x97, 0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x77, 0x71, 0x9C,
+    0xA7, 0x3E, 0x97, 0x2E, 0x73, 0x9C, 0x97, 0x71, 0xAD, 0xA9, 0x74, 0xFC, 0x97, 0x6A, 0xD7, 0x6A,
+    0xCA, 0x74, 0x9A, 0xD9, 0x73, 0xAE, 0x97, 0x4A, 0xC9, 0x76, 0xAC, 0x77, 0x74, 0xAF, 0xFE, 0x94,
+    0xFF, 0xF5, 0xFF, 0xF4, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7,
+    0x5A, 0xD9, 0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x94, 0x9D, 0xA7, 0x5A,
+    0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xF4, 0xAF, 0xFE, 0xA4, 0x70, 0x99, 0x73, 0xAF, 0x97, 0x09, 0x9A,
+    0xE7, 0x4D, 0x73, 0xAD, 0x71, 0xAE, 0x71, 0x9D, 0x97, 0x29, 0xCA, 0x74, 0x97, 0x77, 0x1A, 0xFC,
+    0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD,
+    0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71,
+    0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94,
+    0x9F, 0xE9, 0x70, 0x99, 0x60, 0x70, 0x99, 0x49, 0xA7, 0x9F, 0xA2, 0xD7, 0xFE, 0xAD, 0xA6, 0x9C,
+    0xA1, 0xAF, 0xC7, 0xAC, 0x4A, 0xCA, 0x77, 0x77, 0x75, 0xAF, 0xFE, 0x95, 0xFF, 0xF6, 0xFF, 0xF5,
+    0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xFA,
+    0xAA, 0xAA, 0xAA, 0x96, 0xFF, 0xE9, 0x6F, 0xFE, 0x95, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x7E,
+    0x76, 0x9D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x59,
+    0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0x69, 0x95, 0xA6, 0xFA, 0x2D, 0x5F, 0xEA, 0xDA, 0x49, 0xCA, 0x1A,
+    0xFC, 0x59, 0xC4, 0xAC, 0xA7, 0x77, 0x77, 0x2A, 0xFC, 0xA7, 0x0F, 0xFC, 0x6F, 0x99, 0x9E, 0x94,
+    0xEA, 0x39, 0xDA, 0x3A, 0xDA, 0x49, 0xDA, 0x3E, 0x5A, 0xD9, 0x29, 0xDA, 0x49, 0xE3, 0xE9, 0x19,
+    0xAF, 0x93, 0xFF, 0xE5, 0xFF, 0xA9, 0x59, 0xDA, 0x97, 0x39, 0xDA, 0x74, 0x9D, 0xA7, 0x5E, 0x75,
+    0xE9, 0x74, 0x9E, 0xA2, 0x9A, 0xC9, 0x5A, 0xFF, 0xC9, 0x69, 0xFE, 0x97, 0x29, 0x97, 0x00, 0x77,
+    0x1E, 0x97, 0x70, 0xAD, 0x97, 0x29, 0xE1, 0xAD, 0x73, 0x9F, 0xA0, 0xAA, 0x73, 0x9D, 0xAA, 0xD7,
+    0x59, 0xD9, 0x1A, 0xCA, 0x73, 0x9C, 0xA4, 0x9C, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xE9, 0x70, 0xFF,
+    0xF7, 0x1F, 0xFF, 0x70, 0x9D, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xAD, 0x77, 0x2E, 0x77, 0x2E, 0x77,
+    0x19, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1F, 0xAA, 0xAA, 0xAA, 0xA9, 0x71, 0xFF, 0xE9, 0x71, 0xFF,
+    0xE9, 0x70, 0x9D, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x72, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0x9D,
+    0x97, 0x71, 0xAD, 0x97, 0x71, 0xE7, 0x72, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x70, 0x9F, 0xFF, 0x70,
+    0xAF, 0xFE, 0xA7, 0x00, 0x77, 0x77, 0x3A, 0xD9, 0x76, 0xAD, 0x97, 0x09, 0xE1, 0xAD, 0x72, 0xFA,
+    0x0A, 0xA7, 0x19, 0xDA, 0x9D, 0x73, 0x9D, 0x91, 0x9D, 0x72, 0xCA, 0x5C, 0x97, 0x77, 0x77, 0x72,
+    0xAF, 0xCA, 0x73, 0xFF, 0xC7, 0x1F, 0x99, 0x9E, 0x97, 0xEA, 0x39, 0xDA, 0x6A, 0xDA, 0x49, 0xDA,
+    0x6E, 0x5A, 0xD9, 0x59, 0xDA, 0x49, 0xE6, 0xE9, 0x19, 0xAF, 0x96, 0xFF, 0xE7, 0x0F, 0xFA, 0x97,
+    0x09, 0xDA, 0x97, 0x69, 0xDA, 0x77, 0x9D, 0xA7, 0x70, 0xE7, 0x70, 0xE9, 0x77, 0x9E, 0xA2, 0x9A,
+    0xC9, 0x70, 0xAF, 0xFC, 0x97, 0x19, 0xFE, 0x97, 0x59, 0x97, 0x30, 0x3D, 0xA7, 0x7D, 0x77, 0x0D,
+    0x19, 0xE7, 0x19, 0xA0, 0x9F, 0xA7, 0x29, 0xDA, 0xAD, 0x71, 0x9D, 0x91, 0xAC, 0xA7, 0x9C, 0xA4,
+    0x9C, 0x77, 0x77, 0x72, 0xAF, 0xFE, 0x94, 0xFF, 0xF5, 0xFF, 0xF4, 0x9D, 0xA7, 0x5A, 0xD9, 0x75,
+    0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x95, 0xFF,
+    0xE9, 0x5F, 0xFE, 0x94, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x59, 0xD9,
+    0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xF4, 0xAF, 0xFE, 0xA4,
+    0x77, 0x0A, 0xD7, 0x4D, 0x97, 0x4D, 0x19, 0xE7, 0xA9, 0x0F, 0xA7, 0x9D, 0xA9, 0xD6, 0x9D, 0x91,
+    0x9D, 0x5C, 0xA5, 0xC9, 0x77, 0x77, 0x3A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3,
+    0x9D, 0xA1, 0xAD, 0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9,
+    0x1F, 0xFE, 0x3F, 0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97,
+    0x29, 0xEA, 0x29, 0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x60, 0x77, 0xAA, 0x97,
+    0x71, 0xF7, 0x72, 0xAC, 0x77, 0x19, 0xD7, 0x29, 0xE1, 0xDA, 0x72, 0x9F, 0xA0, 0x97, 0x39, 0xDA,
+    0xAD, 0x74, 0x9D, 0x91, 0xAC, 0xA7, 0x29, 0xCA, 0x49, 0xC7, 0x77, 0x77, 0x73, 0xAF, 0xFE, 0x97,
+    0xFF, 0xF7, 0x0F, 0xFF, 0x79, 0xDA, 0x77, 0x0A, 0xD9, 0x77, 0x0A, 0xD7, 0x71, 0xE7, 0x71, 0xE7,
+    0x70, 0x9D, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xFA, 0xAA, 0xAA, 0xAA, 0x97, 0x0F, 0xFE, 0x97, 0x0F,
+    0xFE, 0x97, 0x9D, 0xA7, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0x9D,
+    0x97, 0x70, 0xAD, 0x97, 0x70, 0xE7, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x79, 0xFF, 0xF7, 0xAF,
+    0xFE, 0xA7, 0x75, 0xAA, 0xA7, 0x7A, 0xAD, 0x77, 0x0A, 0xC9, 0x76, 0x9D, 0x70, 0x9E, 0x1D, 0xA7,
+    0x1F, 0xA0, 0x99, 0x70, 0x9D, 0xA9, 0xD7, 0x29, 0xD9, 0x19, 0xD7, 0x1C, 0xA5, 0xC9, 0x77, 0x77,
+    0x77, 0xAF, 0xCA, 0x72, 0xFF, 0xC7, 0x0F, 0x99, 0x9E, 0x96, 0xEA, 0x39, 0xDA, 0x5A, 0xDA, 0x49,
+    0xDA, 0x5E, 0x5A, 0xD9, 0x49, 0xDA, 0x49, 0xE5, 0xE9, 0x19, 0xAF, 0x95, 0xFF, 0xE7, 0xFF, 0xA9,
+    0x79, 0xDA, 0x97, 0x59, 0xDA, 0x76, 0x9D, 0xA7, 0x7E, 0x77, 0xE9, 0x76, 0x9E, 0xA2, 0x9A, 0xC9,
+    0x7A, 0xFF, 0xC9, 0x70, 0x9F, 0xE9, 0x74, 0x99, 0x72, 0x71, 0x99, 0x49, 0x97, 0x9F, 0x91, 0x9C,
+    0xA7, 0xDA, 0xFE, 0x7A, 0xC9, 0x19, 0xF9, 0x77, 0x75, 0x9E, 0x75, 0x9F, 0xA7, 0x39, 0xDA, 0xAD,
+    0x72, 0x9D, 0x91, 0xAC, 0xA7, 0x09, 0xCA, 0x49, 0xC9, 0x77, 0x77, 0x74, 0xAF, 0xFE, 0x95, 0xFF,
+    0xF6, 0xFF, 0xF5, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xAD, 0x77, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A,
+    0xD9, 0x76, 0xFA, 0xAA, 0xAA, 0xAA, 0x96, 0xFF, 0xE9, 0x6F, 0xFE, 0x95, 0x9D, 0xA7, 0x6A, 0xD9,
+    0x76, 0xE7, 0x7E, 0x76, 0x9D, 0xA7, 0x69, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x77, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x59, 0xFF, 0xF5, 0xAF, 0xFE, 0xA5, 0x79, 0x94, 0x99, 0x69, 0xFA, 0x2C, 0xA6, 0xDA,
+    0xFE, 0x69, 0xC9, 0x2A, 0xE9, 0x77, 0x73, 0x9E, 0x75, 0xFA, 0x72, 0x9D, 0xA9, 0xD7, 0x19, 0xD9,
+    0x19, 0xD7, 0x0C, 0xA4, 0x9C, 0x97, 0x77, 0x77, 0x4A, 0xFC, 0xA7, 0x1F, 0xFC, 0x7F, 0x99, 0x9E,
+    0x95, 0xEA, 0x39, 0xDA, 0x4A, 0xDA, 0x49, 0xDA, 0x4E, 0x5A, 0xD9, 0x39, 0xDA, 0x49, 0xE4, 0xE9,
+    0x19, 0xAF, 0x94, 0xFF, 0xE6, 0xFF, 0xA9, 0x69, 0xDA, 0x97, 0x49, 0xDA, 0x75, 0x9D, 0xA7, 0x6E,
+    0x76, 0xE9, 0x75, 0x9E, 0xA2, 0x9A, 0xC9, 0x6A, 0xFF, 0xC9, 0x79, 0xFE, 0x97, 0x39, 0x97, 0x10,
+    0x72, 0xAA, 0xA7, 0x5A, 0xE9, 0x73, 0xAF, 0xC7, 0x2A, 0xD9, 0x0D, 0x97, 0x0A, 0xD2, 0x9D, 0x79,
+    0xCA, 0x49, 0xC9, 0x77, 0x77, 0x71, 0xAF, 0xFE, 0x94, 0xFF, 0xF5, 0xFF, 0xF4, 0x9D, 0xA7, 0x5A,
+    0xD9, 0x75, 0xAD, 0x76, 0xE7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xFA, 0xAA, 0xAA, 0xAA,
+    0x95, 0xFF, 0xE9, 0x5F, 0xFE, 0x94, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9D, 0xA7,
+    0x59, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x49, 0xFF, 0xF4, 0xAF,
+    0xFE, 0xA7, 0x77, 0x77, 0x5A, 0xC9, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x76, 0xCA, 0x72, 0x70, 0xAA,
+    0xA7, 0x2A, 0xE9, 0x70, 0xAF, 0xC7, 0xAD, 0x90, 0xDA, 0x5A, 0xD9, 0x19, 0xD9, 0x39, 0xCA, 0x49,
+    0xCA, 0x77, 0x77, 0x3A, 0xFC, 0xA6, 0xFF, 0xC4, 0xF9, 0x99, 0xE9, 0x2E, 0xA3, 0x9D, 0xA1, 0xAD,
+    0xA4, 0x9D, 0xA1, 0xE5, 0xAD, 0x90, 0x9D, 0xA4, 0x9E, 0x1E, 0x91, 0x9A, 0xF9, 0x1F, 0xFE, 0x3F,
+    0xFA, 0x93, 0x9D, 0xA9, 0x71, 0x9D, 0xA7, 0x29, 0xDA, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x29,
+    0xAC, 0x93, 0xAF, 0xFC, 0x94, 0x9F, 0xE9, 0x70, 0x99, 0x77, 0x71, 0x9C, 0xA7, 0x3E, 0x97, 0x2E,
+    0x73, 0x9C, 0x97, 0x79, 0xDA, 0xA7, 0x19, 0xFC, 0x73, 0x9D, 0x74, 0xD7, 0x29, 0xDA, 0x71, 0xEA,
+    0x71, 0x9D, 0x73, 0x9C, 0x97, 0x77, 0xAF, 0xE9, 0x5F, 0xF9, 0x7A, 0xDA, 0x97, 0x1A, 0xD9, 0x72,
+    0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A,
+    0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x3D, 0xA7,
+    0x2A, 0xDA, 0x79, 0xFE, 0xA5, 0xAF, 0xF5, 0x59, 0x97, 0x0A, 0xF9, 0x59, 0x9A, 0xE7, 0x1D, 0x70,
+    0xAD, 0x6A, 0xE6, 0x9D, 0x97, 0x9C, 0xA7, 0x19, 0x77, 0x49, 0xD9, 0x7A, 0xD9, 0x7E, 0x70, 0xE7,
+    0x0D, 0xA7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x79, 0xD9, 0x7A, 0xD9, 0x7E, 0x70,
+    0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xAD, 0x70, 0xE7, 0x4A, 0xFE, 0x94, 0xFF, 0x96, 0xAD, 0xA9, 0x70,
+    0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x19,
+    0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E,
+    0x72, 0xDA, 0x71, 0xAD, 0xA6, 0x9F, 0xEA, 0x4A, 0xFF, 0x77, 0x77, 0x29, 0xCA, 0x72, 0xE9, 0x71,
+    0xE7, 0x29, 0xC9, 0x70, 0x69, 0xA7, 0xE5, 0x9E, 0x6D, 0x97, 0x77, 0x72, 0x9D, 0x95, 0xAD, 0x95,
+    0xE6, 0xE6, 0xDA, 0x59, 0xDA, 0x5A, 0xD9, 0x5E, 0x6E, 0x59, 0xDA, 0x59, 0xD9, 0x5A, 0xD9, 0x5E,
+    0x6E, 0x59, 0xDA, 0x5A, 0xD9, 0x5A, 0xD6, 0xE7, 0x77, 0x19, 0xCA, 0x6E, 0x95, 0xE6, 0xAC, 0x95,
+    0x77, 0x74, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E,
+    0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A,
+    0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA,
+    0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73,
+    0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A,
+    0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x77, 0x75, 0xAC, 0x97, 0x70, 0xAD, 0xA7, 0x70,
+    0xAD, 0xA7, 0x71, 0xCA, 0x73, 0x77, 0x69, 0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA,
+    0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09,
+    0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD,
+    0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97,
+    0x77, 0x6A, 0xCA, 0x74, 0x9E, 0x74, 0x9E, 0x75, 0xAC, 0x71, 0x73, 0xAD, 0xA9, 0x77, 0xFC, 0x97,
+    0x71, 0xAD, 0x77, 0x1A, 0xCA, 0x77, 0x9A, 0xD9, 0x76, 0xAE, 0x97, 0x7A, 0xC9, 0x77, 0x1A, 0xC7,
+    0x77, 0x73, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E,
+    0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A,
+    0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA,
+    0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73,
+    0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A,
+    0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x71, 0x99, 0x75, 0xFA, 0x73, 0xA9, 0xAD,
+    0x97, 0x5A, 0xCA, 0x74, 0x9D, 0x97, 0x29, 0xEA, 0x73, 0xDA, 0x75, 0xD7, 0x69, 0x97, 0x77, 0x49,
+    0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA, 0x2A, 0xDA, 0x6E, 0x2E, 0x7E,
+    0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x9D, 0xA0,
+    0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9, 0x49, 0xE3, 0x9E, 0xA9, 0x09,
+    0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x77, 0x3E, 0x77, 0x3A, 0xD7, 0x59,
+    0xDA, 0x1A, 0xD7, 0x59, 0xF9, 0x9A, 0x97, 0x59, 0xDA, 0xAD, 0x77, 0x9D, 0x91, 0xAC, 0xA7, 0x59,
+    0xCA, 0x49, 0xC7, 0x77, 0x77, 0x77, 0x59, 0xFD, 0xA9, 0x74, 0x9F, 0xFD, 0xA7, 0x2A, 0xFA, 0xA9,
+    0xAF, 0xC7, 0x0A, 0xEA, 0x59, 0xEA, 0x69, 0xE9, 0x79, 0xE6, 0xE9, 0x71, 0xE9, 0x4A, 0xDA, 0x72,
+    0xAD, 0xA4, 0xE7, 0x39, 0xE3, 0xAD, 0xA7, 0x4E, 0x3E, 0x97, 0x4E, 0x3E, 0x75, 0xE2, 0x9E, 0x74,
+    0x9E, 0x29, 0xDA, 0x74, 0x9E, 0x2A, 0xDA, 0x74, 0xAD, 0xA2, 0xAD, 0xA7, 0x4E, 0x92, 0xAD, 0xA7,
+    0x39, 0xE3, 0xAD, 0xA7, 0x3A, 0xE3, 0x9E, 0x73, 0xE9, 0x4E, 0x72, 0xF5, 0xF7, 0x0A, 0xE6, 0x9E,
+    0xA6, 0xF9, 0x7A, 0xFA, 0x99, 0x9A, 0xFA, 0x71, 0xAF, 0xFE, 0x97, 0x4A, 0xFE, 0x97, 0x71, 0x99,
+    0x97, 0x40, 0x77, 0x77, 0x39, 0xDA, 0x76, 0x9D, 0xA7, 0x1E, 0x90, 0x9D, 0x97, 0x1F, 0xC0, 0xAA,
+    0x72, 0xE9, 0xD9, 0x73, 0xDA, 0x2D, 0x72, 0xAA, 0x5A, 0xA7, 0x77, 0x77, 0x72, 0x9F, 0xCA, 0x72,
+    0x9F, 0xFC, 0x70, 0x9F, 0x99, 0x9F, 0x7E, 0xA4, 0xAD, 0xA5, 0xAD, 0xA6, 0xE5, 0xE7, 0xE4, 0xAD,
+    0x97, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE3, 0x9D, 0xA7, 0x0E, 0x39, 0xDA, 0x79, 0xDA, 0x39, 0xDA,
+    0x7A, 0xD9, 0x39, 0xDA, 0x7E, 0x5E, 0x6A, 0xDA, 0x5E, 0x94, 0x9E, 0x69, 0xEA, 0x90, 0x9A, 0xE9,
+    0x7A, 0xFF, 0xC9, 0x71, 0x9F, 0xDA, 0x77, 0x97, 0x30, 0x5D, 0xA7, 0x72, 0xD7, 0x72, 0x9C, 0xA1,
+    0x9D, 0xA7, 0x49, 0xA0, 0x9F, 0x97, 0x59, 0xDA, 0xAD, 0x74, 0x9D, 0x91, 0xAC, 0xA7, 0x29, 0xCA,
+    0x49, 0xC7, 0x77, 0x77, 0x74, 0x9F, 0xDA, 0x97, 0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5,
+    0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E, 0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E,
+    0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74, 0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7,
+    0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74, 0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A,
+    0xE0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7, 0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99,
+    0x9A, 0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9, 0x76, 0x99, 0x97, 0x10, 0x77, 0x29, 0xD7, 0x6A,
+    0xCA, 0x76, 0xAC, 0x91, 0xE9, 0x70, 0xA9, 0x0F, 0xC7, 0x2E, 0x9D, 0x97, 0x0D, 0xA2, 0xD7, 0xAA,
+    0x5A, 0xA7, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA,
+    0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70,
+    0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9,
+    0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x00, 0x77,
+    0x1A, 0xA9, 0x77, 0x3F, 0x77, 0x4D, 0x77, 0x39, 0xCA, 0x74, 0x9D, 0xA1, 0xD9, 0x74, 0x9F, 0x90,
+    0xA7, 0x59, 0xDA, 0xAD, 0x76, 0x9D, 0x91, 0xAC, 0xA7, 0x49, 0xCA, 0x49, 0xC7, 0x77, 0x77, 0x77,
+    0x29, 0xFD, 0xA9, 0x73, 0x9F, 0xFD, 0xA7, 0x1A, 0xFA, 0xA9, 0xAF, 0xC7, 0xAE, 0xA5, 0x9E, 0xA5,
+    0x9E, 0x97, 0x9E, 0x5E, 0x97, 0x1E, 0x93, 0xAD, 0xA7, 0x2A, 0xDA, 0x3E, 0x73, 0x9E, 0x2A, 0xDA,
+    0x74, 0xE2, 0xE9, 0x74, 0xE2, 0xE7, 0x5E, 0x19, 0xE7, 0x49, 0xE1, 0x9D, 0xA7, 0x49, 0xE1, 0xAD,
+    0xA7, 0x4A, 0xDA, 0x1A, 0xDA, 0x74, 0xE9, 0x1A, 0xDA, 0x73, 0x9E, 0x2A, 0xDA, 0x73, 0xAE, 0x29,
+    0xE7, 0x3E, 0x93, 0xE7, 0x2F, 0x4F, 0x70, 0xAE, 0x59, 0xEA, 0x6F, 0x96, 0xAF, 0xA9, 0x99, 0xAF,
+    0xA7, 0x0A, 0xFF, 0xE9, 0x73, 0xAF, 0xE9, 0x77, 0x09, 0x99, 0x73, 0x75, 0x9A, 0xA9, 0x76, 0xAA,
+    0xD9, 0x77, 0x9C, 0xA7, 0x69, 0xD7, 0x1E, 0x90, 0x9C, 0xA7, 0x1F, 0xC1, 0x97, 0x1E, 0x9D, 0x97,
+    0x2D, 0xA2, 0xD7, 0x1A, 0xA5, 0xAA, 0x77, 0x77, 0x77, 0x9F, 0xCA, 0x71, 0x9F, 0xFC, 0x79, 0xF9,
+    0x99, 0xF6, 0xEA, 0x4A, 0xDA, 0x4A, 0xDA, 0x6E, 0x4E, 0x7E, 0x3A, 0xD9, 0x7E, 0x3E, 0x70, 0xE3,
+    0xE7, 0x0E, 0x29, 0xDA, 0x70, 0xE2, 0x9D, 0xA7, 0x9D, 0xA2, 0x9D, 0xA7, 0xAD, 0x92, 0x9D, 0xA7,
+    0xE4, 0xE6, 0xAD, 0xA4, 0xE9, 0x49, 0xE5, 0x9E, 0xA9, 0x09, 0xAE, 0x96, 0xAF, 0xFC, 0x97, 0x09,
+    0xFD, 0xA7, 0x69, 0x72, 0x73, 0x95, 0x99, 0x71, 0x9F, 0x91, 0x9C, 0xA7, 0x09, 0xDA, 0xFE, 0x71,
+    0xAC, 0x29, 0xF7, 0x77, 0x72, 0x9D, 0xA7, 0x79, 0xF9, 0x75, 0x9D, 0xAA, 0xD7, 0x49, 0xD9, 0x1A,
+    0xCA, 0x72, 0x9C, 0xA4, 0xAC, 0x77, 0x77, 0x77, 0x49, 0xFD, 0xA9, 0x71, 0x9F, 0xFD, 0xA7, 0xAF,
+    0xAA, 0x9A, 0xFC, 0x5A, 0xEA, 0x59, 0xEA, 0x39, 0xE9, 0x79, 0xE3, 0xE9, 0x71, 0xE9, 0x1A, 0xDA,
+    0x72, 0xAD, 0xA1, 0xE7, 0x39, 0xE0, 0xAD, 0xA7, 0x4E, 0x0E, 0x97, 0x4E, 0x0E, 0x75, 0xE9, 0xE7,
+    0x49, 0xE9, 0xDA, 0x74, 0x9E, 0xAD, 0xA7, 0x4A, 0xDA, 0xAD, 0xA7, 0x4E, 0x9A, 0xDA, 0x73, 0x9E,
+    0x0A, 0xDA, 0x73, 0xAE, 0x09, 0xE7, 0x3E, 0x91, 0xE7, 0x2F, 0x2F, 0x70, 0xAE, 0x39, 0xEA, 0x6F,
+    0x94, 0xAF, 0xA9, 0x99, 0xAF, 0xA6, 0xAF, 0xFE, 0x97, 0x1A, 0xFE, 0x97, 0x69, 0x99, 0x71, 0x79,
+    0x95, 0x97, 0xFA, 0x91, 0xD6, 0xEA, 0xFD, 0x96, 0xCA, 0x2A, 0xEA, 0x77, 0x74, 0xE9, 0x74, 0xFC,
+    0x73, 0xE9, 0xDA, 0x71, 0xDA, 0x2D, 0x70, 0xAA, 0x5A, 0xA7, 0x77, 0x77, 0x49, 0xFC, 0xA7, 0x09,
+    0xFF, 0xC6, 0x9F, 0x99, 0x9F, 0x5E, 0xA4, 0xAD, 0xA3, 0xAD, 0xA6, 0xE3, 0xE7, 0xE2, 0xAD, 0x97,
+    0xE2, 0xE7, 0x0E, 0x2E, 0x70, 0xE1, 0x9D, 0xA7, 0x0E, 0x19, 0xDA, 0x79, 0xDA, 0x19, 0xDA, 0x7A,
+    0xD9, 0x19, 0xDA, 0x7E, 0x3E, 0x6A, 0xDA, 0x3E, 0x94, 0x9E, 0x49, 0xEA, 0x90, 0x9A, 0xE9, 0x5A,
+    0xFF, 0xC9, 0x79, 0xFD, 0xA7, 0x59, 0x71, 0x74, 0xAA, 0x97, 0x70, 0xF7, 0x7A, 0xFA, 0x75, 0xAD,
+    0x99, 0xD9, 0x73, 0xE2, 0xAD, 0x72, 0xAC, 0xA4, 0xAC, 0x97, 0x77, 0x77, 0x73, 0x9F, 0xDA, 0x97,
+    0x19, 0xFF, 0xDA, 0x7A, 0xFA, 0xA9, 0xAF, 0xC5, 0xAE, 0xA5, 0x9E, 0xA3, 0x9E, 0x97, 0x9E, 0x3E,
+    0x97, 0x1E, 0x91, 0xAD, 0xA7, 0x2A, 0xDA, 0x1E, 0x73, 0x9E, 0x0A, 0xDA, 0x74, 0xE0, 0xE9, 0x74,
+    0xE0, 0xE7, 0x5E, 0x9E, 0x74, 0x9E, 0x9D, 0xA7, 0x49, 0xEA, 0xDA, 0x74, 0xAD, 0xAA, 0xDA, 0x74,
+    0xE9, 0xAD, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x3A, 0xE0, 0x9E, 0x73, 0xE9, 0x1E, 0x72, 0xF2, 0xF7,
+    0x0A, 0xE3, 0x9E, 0xA6, 0xF9, 0x4A, 0xFA, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xE9, 0x71, 0xAF, 0xE9,
+    0x76, 0x99, 0x97, 0x77, 0x75, 0xAC, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0xAD, 0xA7, 0x71, 0xCA, 0x73,
+    0x70, 0x9A, 0xA7, 0x49, 0xEA, 0x72, 0x9F, 0xC9, 0x70, 0x9D, 0xA0, 0xE7, 0x9D, 0xA2, 0xDA, 0x6D,
+    0x94, 0xD7, 0x77, 0x77, 0x19, 0xFC, 0xA7, 0x9F, 0xFC, 0x59, 0xF9, 0x99, 0xF4, 0xEA, 0x4A, 0xDA,
+    0x2A, 0xDA, 0x6E, 0x2E, 0x7E, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xE7, 0x0E, 0x09, 0xDA, 0x70,
+    0xE0, 0x9D, 0xA7, 0x9D, 0xA0, 0x9D, 0xA7, 0xAD, 0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0xAD, 0xA2, 0xE9,
+    0x49, 0xE3, 0x9E, 0xA9, 0x09, 0xAE, 0x94, 0xAF, 0xFC, 0x96, 0x9F, 0xDA, 0x74, 0x97, 0x77, 0x6A,
+    0xCA, 0x74, 0x9E, 0x74, 0x9E, 0x75, 0xAC, 0x71, 0x76, 0xAA, 0xA7, 0x75, 0xEA, 0x77, 0x4A, 0xDA,
+    0x77, 0x49, 0xDA, 0x77, 0x5D, 0xA7, 0x75, 0xAC, 0x97, 0x77, 0x72, 0x99, 0x97, 0x75, 0xAD, 0xA7,
+    0x9F, 0xDA, 0x94, 0xE9, 0x59, 0xFF, 0xDA, 0x29, 0xE5, 0xAF, 0xAA, 0x9A, 0xFC, 0x1E, 0x5A, 0xEA,
+    0x59, 0xFE, 0x59, 0xE9, 0x79, 0xFA, 0x6E, 0x97, 0x1E, 0x96, 0xAD, 0xA7, 0x2A, 0xDA, 0x6E, 0x73,
+    0x9E, 0x5A, 0xDA, 0x74, 0xE5, 0xE9, 0x74, 0xE5, 0xE7, 0x5E, 0x49, 0xE7, 0x49, 0xE4, 0x9D, 0xA7,
+    0x49, 0xE4, 0xAD, 0xA7, 0x4A, 0xDA, 0x4A, 0xDA, 0x74, 0xE9, 0x4A, 0xDA, 0x73, 0x9E, 0x5A, 0xDA,
+    0x73, 0xAE, 0x59, 0xE7, 0x3E, 0x96, 0xE7, 0x2F, 0x7F, 0x70, 0xAE, 0x70, 0x9E, 0xA6, 0xF9, 0x71,
+    0xAF, 0xA9, 0x99, 0xAF, 0xA7, 0x3A, 0xFF, 0xE9, 0x76, 0xAF, 0xE9, 0x77, 0x39, 0x99, 0x76, 0x73,
+    0x9A, 0xA9, 0x77, 0x09, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xAD, 0x77, 0x19, 0xCA, 0x6A, 0xAA,
+    0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA6, 0x9F, 0xCA, 0x3E, 0x59, 0xFF, 0xC1, 0xE9, 0x49, 0xF9, 0x99,
+    0xFE, 0x95, 0xEA, 0x4A, 0xE9, 0x6A, 0xDA, 0x6E, 0x7E, 0x7E, 0x6A, 0xD9, 0x7E, 0x6E, 0x70, 0xE6,
+    0xE7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x9D, 0xA5, 0x9D, 0xA7, 0xAD, 0x95, 0x9D, 0xA7,
+    0xE7, 0xE6, 0xAD, 0xA7, 0xE9, 0x49, 0xE7, 0x09, 0xEA, 0x90, 0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0x97,
+    0x39, 0xFD, 0xA7, 0x71, 0x97, 0x50, 0x70, 0x9A, 0xA9, 0x77, 0x6E, 0x77, 0x6A, 0xD9, 0x77, 0x6E,
+    0x77, 0x7D, 0x97, 0x76, 0x9C, 0xA7, 0x77, 0x71, 0x99, 0x97, 0x75, 0xAD, 0xA7, 0x9F, 0xDA, 0x94,
+    0xE9, 0x59, 0xFF, 0xDA, 0x29, 0xE5, 0xAF, 0xAA, 0x9A, 0xFC, 0x1E, 0x5A, 0xEA, 0x59, 0xFE, 0x59,
+    0xE9, 0x79, 0xFA, 0x6E, 0x97, 0x1E, 0x96, 0xAD, 0xA7, 0x2A, 0xDA, 0x6E, 0x73, 0x9E, 0x5A, 0xDA,
+    0x74, 0xE5, 0xE9, 0x74, 0xE5, 0xE7, 0x5E, 0x49, 0xE7, 0x49, 0xE4, 0x9D, 0xA7, 0x49, 0xE4, 0xAD,
+    0xA7, 0x4A, 0xDA, 0x4A, 0xDA, 0x74, 0xE9, 0x4A, 0xDA, 0x73, 0x9E, 0x5A, 0xDA, 0x73, 0xAE, 0x59,
+    0xE7, 0x3E, 0x96, 0xE7, 0x2F, 0x7F, 0x70, 0xAE, 0x70, 0x9E, 0xA6, 0xF9, 0x71, 0xAF, 0xA9, 0x99,
+    0xAF, 0xA7, 0x3A, 0xFF, 0xE9, 0x76, 0xAF, 0xE9, 0x77, 0x39, 0x99, 0x76, 0x6A, 0xA9, 0x77, 0x2E,
+    0x77, 0x29, 0xDA, 0x77, 0x2A, 0xD7, 0x73, 0xDA, 0x77, 0x3A, 0xC5, 0xAA, 0xA7, 0x71, 0x9E, 0x77,
+    0x1A, 0xDA, 0x69, 0xFC, 0xA3, 0xE5, 0x9F, 0xFC, 0x1E, 0x94, 0x9F, 0x99, 0x9F, 0xE9, 0x5E, 0xA4,
+    0xAE, 0x96, 0xAD, 0xA6, 0xE7, 0xE7, 0xE6, 0xAD, 0x97, 0xE6, 0xE7, 0x0E, 0x6E, 0x70, 0xE5, 0x9D,
+    0xA7, 0x0E, 0x59, 0xDA, 0x79, 0xDA, 0x59, 0xDA, 0x7A, 0xD9, 0x59, 0xDA, 0x7E, 0x7E, 0x6A, 0xDA,
+    0x7E, 0x94, 0x9E, 0x70, 0x9E, 0xA9, 0x09, 0xAE, 0x97, 0x1A, 0xFF, 0xC9, 0x73, 0x9F, 0xDA, 0x77,
+    0x19, 0x75, 0x73, 0xAD, 0xA9, 0x77, 0x4F, 0xC9, 0x77, 0x6A, 0xD7, 0x76, 0xAC, 0xA7, 0x74, 0x9A,
+    0xD9, 0x77, 0x3A, 0xE9, 0x77, 0x4A, 0xC9, 0x77, 0x6A, 0xC7, 0x09, 0x99, 0x77, 0x5A, 0xDA, 0x79,
+    0xFD, 0xA9, 0x4E, 0x95, 0x9F, 0xFD, 0xA2, 0x9E, 0x5A, 0xFA, 0xA9, 0xAF, 0xC1, 0xE5, 0xAE, 0xA5,
+    0x9F, 0xE5, 0x9E, 0x97, 0x9F, 0xA6, 0xE9, 0x71, 0xE9, 0x6A, 0xDA, 0x72, 0xAD, 0xA6, 0xE7, 0x39,
+    0xE5, 0xAD, 0xA7, 0x4E, 0x5E, 0x97, 0x4E, 0x5E, 0x75, 0xE4, 0x9E, 0x74, 0x9E, 0x49, 0xDA, 0x74,
+    0x9E, 0x4A, 0xDA, 0x74, 0xAD, 0xA4, 0xAD, 0xA7, 0x4E, 0x94, 0xAD, 0xA7, 0x39, 0xE5, 0xAD, 0xA7,
+    0x3A, 0xE5, 0x9E, 0x73, 0xE9, 0x6E, 0x72, 0xF7, 0xF7, 0x0A, 0xE7, 0x09, 0xEA, 0x6F, 0x97, 0x1A,
+    0xFA, 0x99, 0x9A, 0xFA, 0x73, 0xAF, 0xFE, 0x97, 0x6A, 0xFE, 0x97, 0x73, 0x99, 0x97, 0x60, 0x71,
+    0x99, 0x77, 0x2F, 0xA7, 0x70, 0xA9, 0xAD, 0x97, 0x72, 0xAC, 0xA7, 0x71, 0x9D, 0x97, 0x79, 0xEA,
+    0x77, 0x0D, 0xA7, 0x72, 0xD6, 0xAA, 0xA7, 0x19, 0x95, 0x9E, 0x77, 0x1A, 0xDA, 0x69, 0xFC, 0xA3,
+    0xE5, 0x9F, 0xFC, 0x1E, 0x94, 0x9F, 0x99, 0x9F, 0xE9, 0x5E, 0xA4, 0xAE, 0x96, 0xAD, 0xA6, 0xE7,
+    0xE7, 0xE6, 0xAD, 0x97, 0xE6, 0xE7, 0x0E, 0x6E, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x79,
+    0xDA, 0x59, 0xDA, 0x7A, 0xD9, 0x59, 0xDA, 0x7E, 0x7E, 0x6A, 0xDA, 0x7E, 0x94, 0x9E, 0x70, 0x9E,
+    0xA9, 0x09, 0xAE, 0x97, 0x1A, 0xFF, 0xC9, 0x73, 0x9F, 0xDA, 0x77, 0x19, 0x75, 0x71, 0x99, 0x5A,
+    0x77, 0xFA, 0x2D, 0x76, 0xFE, 0xAD, 0xA7, 0x59, 0xCA, 0x1A, 0xFC, 0x76, 0x9C, 0x4A, 0xCA, 0x77,
+    0x77, 0x99, 0x97, 0x75, 0xAD, 0xA7, 0x9F, 0xDA, 0x94, 0xE9, 0x59, 0xFF, 0xDA, 0x29, 0xE5, 0xAF,
+    0xAA, 0x9A, 0xFC, 0x1E, 0x5A, 0xEA, 0x59, 0xFE, 0x59, 0xE9, 0x79, 0xFA, 0x6E, 0x97, 0x1E, 0x96,
+    0xAD, 0xA7, 0x2A, 0xDA, 0x6E, 0x73, 0x9E, 0x5A, 0xDA, 0x74, 0xE5, 0xE9, 0x74, 0xE5, 0xE7, 0x5E,
+    0x49, 0xE7, 0x49, 0xE4, 0x9D, 0xA7, 0x49, 0xE4, 0xAD, 0xA7, 0x4A, 0xDA, 0x4A, 0xDA, 0x74, 0xE9,
+    0x4A, 0xDA, 0x73, 0x9E, 0x5A, 0xDA, 0x73, 0xAE, 0x59, 0xE7, 0x3E, 0x96, 0xE7, 0x2F, 0x7F, 0x70,
+    0xAE, 0x70, 0x9E, 0xA6, 0xF9, 0x71, 0xAF, 0xA9, 0x99, 0xAF, 0xA7, 0x3A, 0xFF, 0xE9, 0x76, 0xAF,
+    0xE9, 0x77, 0x39, 0x99, 0x76, 0x69, 0x99, 0x4A, 0x97, 0x2F, 0xC9, 0x1A, 0xC9, 0x71, 0xAF, 0xEA,
+    0xD7, 0x2D, 0x19, 0xFC, 0x97, 0x2C, 0x93, 0x9A, 0xA9, 0x2A, 0xAA, 0x77, 0x19, 0xE7, 0x71, 0xAD,
+    0xA6, 0x9F, 0xCA, 0x3E, 0x59, 0xFF, 0xC1, 0xE9, 0x49, 0xF9, 0x99, 0xFE, 0x95, 0xEA, 0x4A, 0xE9,
+    0x6A, 0xDA, 0x6E, 0x7E, 0x7E, 0x6A, 0xD9, 0x7E, 0x6E, 0x70, 0xE6, 0xE7, 0x0E, 0x59, 0xDA, 0x70,
+    0xE5, 0x9D, 0xA7, 0x9D, 0xA5, 0x9D, 0xA7, 0xAD, 0x95, 0x9D, 0xA7, 0xE7, 0xE6, 0xAD, 0xA7, 0xE9,
+    0x49, 0xE7, 0x09, 0xEA, 0x90, 0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0x97, 0x39, 0xFD, 0xA7, 0x71, 0x97,
+    0x50, 0x77, 0x69, 0x99, 0x77, 0x5A, 0xDA, 0x79, 0xFD, 0xA9, 0x4E, 0x95, 0x9F, 0xFD, 0xA2, 0x9E,
+    0x5A, 0xFA, 0xA9, 0xAF, 0xC1, 0xE5, 0xAE, 0xA5, 0x9F, 0xE5, 0x9E, 0x97, 0x9F, 0xA6, 0xE9, 0x71,
+    0xE9, 0x6A, 0xDA, 0x72, 0xAD, 0xA6, 0xE7, 0x39, 0xE5, 0xAD, 0xA7, 0x4E, 0x5E, 0x97, 0x4E, 0x5E,
+    0x75, 0xE4, 0x9E, 0x74, 0x9E, 0x49, 0xDA, 0x74, 0x9E, 0x4A, 0xDA, 0x74, 0xAD, 0xA4, 0xAD, 0xA7,
+    0x4E, 0x94, 0xAD, 0xA7, 0x39, 0xE5, 0xAD, 0xA7, 0x3A, 0xE5, 0x9E, 0x73, 0xE9, 0x6E, 0x72, 0xF7,
+    0xF7, 0x0A, 0xE7, 0x09, 0xEA, 0x6F, 0x97, 0x1A, 0xFA, 0x99, 0x9A, 0xFA, 0x73, 0xAF, 0xFE, 0x97,
+    0x6A, 0xFE, 0x97, 0x73, 0x99, 0x97, 0x77, 0x77, 0x6A, 0xC9, 0x77, 0x59, 0xE7, 0x75, 0x9E, 0x77,
+    0x6A, 0xC7, 0x71, 0x77, 0x1A, 0xAA, 0x77, 0x19, 0xE7, 0x71, 0xAD, 0xA6, 0x9F, 0xCA, 0x3E, 0x59,
+    0xFF, 0xC1, 0xE9, 0x49, 0xF9, 0x99, 0xFE, 0x95, 0xEA, 0x4A, 0xE9, 0x6A, 0xDA, 0x6E, 0x7E, 0x7E,
+    0x6A, 0xD9, 0x7E, 0x6E, 0x70, 0xE6, 0xE7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x9D, 0xA5,
+    0x9D, 0xA7, 0xAD, 0x95, 0x9D, 0xA7, 0xE7, 0xE6, 0xAD, 0xA7, 0xE9, 0x49, 0xE7, 0x09, 0xEA, 0x90,
+    0x9A, 0xE9, 0x71, 0xAF, 0xFC, 0x97, 0x39, 0xFD, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x0D, 0x77, 0x2E,
+    0x97, 0x71, 0xE9, 0x77, 0x19, 0xCA, 0x76, 0x3E, 0x72, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7,
+    0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x29, 0xDA, 0x71, 0x9D, 0xA2,
+    0x9D, 0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xDA, 0x29, 0xDA, 0x71,
+    0x9D, 0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72, 0xE3, 0xE7, 0x19, 0xDA, 0x29,
+    0xDA, 0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E, 0x4E, 0x70, 0xE9, 0x4E, 0xA6,
+    0xF5, 0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97, 0x69, 0x97, 0x77, 0x76, 0xAC,
+    0x97, 0x70, 0x9E, 0x77, 0x0A, 0xDA, 0x77, 0x1A, 0xA7, 0x40, 0x29, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3,
+    0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D, 0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E,
+    0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9, 0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3, 0xE6, 0xEA,
+    0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1, 0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0xAF,
+    0xC9, 0x1D, 0xA7, 0x99, 0x77, 0x77, 0x19, 0xCA, 0x76, 0xE9, 0x75, 0xE7, 0x69, 0xC9, 0x72, 0x72,
+    0xAD, 0xA9, 0x77, 0xFC, 0x97, 0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x79, 0xAD, 0x97, 0x6A, 0xE9, 0x77,
+    0xAC, 0x97, 0x71, 0xAC, 0x77, 0x77, 0x0E, 0x72, 0xDA, 0x3E, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x1A,
+    0xD9, 0x2A, 0xD9, 0x71, 0xAD, 0x3E, 0x72, 0xE3, 0xE7, 0x2E, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0x9D,
+    0xA7, 0x1A, 0xD9, 0x2A, 0xD9, 0x71, 0xE3, 0xE7, 0x2E, 0x3E, 0x72, 0xDA, 0x29, 0xDA, 0x71, 0x9D,
+    0xA2, 0xAD, 0x97, 0x1A, 0xD9, 0x2A, 0xD7, 0x2E, 0x3E, 0x72, 0xE3, 0xE7, 0x19, 0xDA, 0x29, 0xDA,
+    0x71, 0xAD, 0x92, 0x9D, 0xA7, 0x1E, 0x39, 0xDA, 0x70, 0x9E, 0x4E, 0x70, 0xE9, 0x4E, 0xA6, 0xF5,
+    0x9F, 0x99, 0x99, 0xAF, 0x7A, 0xFF, 0xE7, 0x19, 0xFF, 0x97, 0x69, 0x97, 0x30, 0x71, 0x99, 0x76,
+    0xAF, 0x97, 0x39, 0x9A, 0xE7, 0x7D, 0x76, 0xAD, 0x74, 0xAE, 0x74, 0x9D, 0x97, 0x59, 0xCA, 0x77,
+    0x97, 0x77, 0x39, 0xD9, 0x6A, 0xD3, 0xE7, 0xE3, 0xE7, 0xE3, 0xE6, 0x9D, 0xA2, 0x9D, 0xA6, 0x9D,
+    0x92, 0xAD, 0x96, 0xAD, 0x3E, 0x7E, 0x3E, 0x7E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xD9,
+    0x2A, 0xD9, 0x6E, 0x3E, 0x69, 0xE3, 0xE6, 0xEA, 0x3E, 0x5A, 0xE9, 0x3E, 0x4A, 0xF9, 0x3E, 0xA1,
+    0x9D, 0xAA, 0xD4, 0x9F, 0xEA, 0x0A, 0xD5, 0xAF, 0xC9, 0x1D, 0xA7, 0x99, 0x73, 0x76, 0xAA, 0xA7,
+    0x76, 0xEA, 0x77, 0x5A, 0xDA, 0x77, 0x59, 0xDA, 0x77, 0x6D, 0xA7, 0x76, 0xAC, 0x97, 0x77, 0x74,
+    0x99, 0x97, 0x76, 0xAE, 0x3E, 0x72, 0xDA, 0x1E, 0x93, 0xE7, 0x19, 0xDA, 0x09, 0xE3, 0x9D, 0xA7,
+    0x1A, 0xD9, 0x0E, 0x4A, 0xD9, 0x71, 0xAF, 0xD9, 0x4E, 0x72, 0xFC, 0xA6, 0xE7, 0x2E, 0x97, 0x9D,
+    0xA7, 0x19, 0xDA, 0x70, 0x9D, 0xA7, 0x1A, 0xD9, 0x70, 0xAD, 0x97, 0x1E, 0x71, 0xE7, 0x2E, 0x71,
+    0xE7, 0x2E, 0x70, 0x9D, 0xA7, 0x19, 0xDA, 0x70, 0xAD, 0x97, 0x1A, 0xD9, 0x70, 0xAD, 0x72, 0xE7,
+    0x1E, 0x72, 0xE7, 0x1E, 0x71, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0xAD, 0x97, 0x09, 0xDA, 0x71, 0xE7,
+    0x19, 0xDA, 0x70, 0x9E, 0x72, 0xE7, 0x0E, 0x97, 0x2E, 0xA6, 0xF7, 0x39, 0xF9, 0x99, 0x9A, 0xF7,
+    0x5A, 0xFF, 0xE7, 0x79, 0xFF, 0x97, 0x74, 0x99, 0x97, 0x70, 0x74, 0xAA, 0xA7, 0x73, 0xEA, 0x77,
+    0x2A, 0xDA, 0x77, 0x29, 0xDA, 0x77, 0x3D, 0xA7, 0x73, 0xAC, 0x97, 0x9A, 0xA9, 0x77, 0x3E, 0x97,
+    0x73, 0xE3, 0x9D, 0x96, 0xAD, 0x1A, 0xD9, 0x3E, 0x7E, 0x0A, 0xDA, 0x4E, 0x7F, 0xDA, 0x5E, 0x69,
+    0xFA, 0x69, 0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x96, 0xAD, 0x71, 0xE7, 0xE7, 0x1E, 0x7E, 0x70, 0x9D,
+    0xA6, 0x9D, 0xA7, 0x09, 0xD9, 0x6A, 0xD9, 0x70, 0xAD, 0x96, 0xE7, 0x1E, 0x69, 0xE7, 0x1E, 0x6E,
+    0xA7, 0x1E, 0x5A, 0xE9, 0x71, 0xE4, 0xAF, 0x97, 0x1E, 0xA1, 0x9D, 0xAA, 0xD7, 0x29, 0xFE, 0xA0,
+    0xAD, 0x73, 0xAF, 0xC9, 0x1D, 0xA7, 0x59, 0x97, 0x71, 0x70, 0x9A, 0xA9, 0x77, 0x69, 0xE7, 0x77,
+    0xAD, 0x77, 0x70, 0xDA, 0x77, 0x70, 0xD9, 0x77, 0x79, 0xCA, 0x77, 0x77, 0x39, 0x99, 0x77, 0x6A,
+    0xE3, 0xE7, 0x2D, 0xA1, 0xE9, 0x3E, 0x71, 0x9D, 0xA0, 0x9E, 0x39, 0xDA, 0x71, 0xAD, 0x90, 0xE4,
+    0xAD, 0x97, 0x1A, 0xFD, 0x94, 0xE7, 0x2F, 0xCA, 0x6E, 0x72, 0xE9, 0x79, 0xDA, 0x71, 0x9D, 0xA7,
+    0x09, 0xDA, 0x71, 0xAD, 0x97, 0x0A, 0xD9, 0x71, 0xE7, 0x1E, 0x72, 0xE7, 0x1E, 0x72, 0xE7, 0x09,
+    0xDA, 0x71, 0x9D, 0xA7, 0x0A, 0xD9, 0x71, 0xAD, 0x97, 0x0A, 0xD7, 0x2E, 0x71, 0xE7, 0x2E, 0x71,
+    0xE7, 0x19, 0xDA, 0x70, 0x9D, 0xA7, 0x1A, 0xD9, 0x70, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0xA7, 0x09,
+    0xE7, 0x2E, 0x70, 0xE9, 0x72, 0xEA, 0x6F, 0x73, 0x9F, 0x99, 0x99, 0xAF, 0x75, 0xAF, 0xFE, 0x77,
+    0x9F, 0xF9, 0x77, 0x49, 0x99, 0x77, 0x00, 0x69, 0xAA, 0x97, 0x73, 0x9E, 0x77, 0x4A, 0xD9, 0x77,
+    0x4E, 0x77, 0x5D, 0x97, 0x74, 0x9C, 0xA6, 0x9A, 0xA9, 0x77, 0x3E, 0x97, 0x73, 0xE3, 0x9D, 0x96,
+    0xAD, 0x1A, 0xD9, 0x3E, 0x7E, 0x0A, 0xDA, 0x4E, 0x7F, 0xDA, 0x5E, 0x69, 0xFA, 0x69, 0xDA, 0x69,
+    0xD9, 0x70, 0xAD, 0x96, 0xAD, 0x71, 0xE7, 0xE7, 0x1E, 0x7E, 0x70, 0x9D, 0xA6, 0x9D, 0xA7, 0x09,
+    0xD9, 0x6A, 0xD9, 0x70, 0xAD, 0x96, 0xE7, 0x1E, 0x69, 0xE7, 0x1E, 0x6E, 0xA7, 0x1E, 0x5A, 0xE9,
+    0x71, 0xE4, 0xAF, 0x97, 0x1E, 0xA1, 0x9D, 0xAA, 0xD7, 0x29, 0xFE, 0xA0, 0xAD, 0x73, 0xAF, 0xC9,
+    0x1D, 0xA7, 0x59, 0x97, 0x71, 0x72, 0xAD, 0xA9, 0x77, 0x5F, 0xCA, 0x77, 0x7A, 0xD7, 0x77, 0xAD,
+    0x77, 0x59, 0xAD, 0x97, 0x74, 0x9E, 0x97, 0x75, 0xAC, 0x97, 0x77, 0xAC, 0x72, 0x99, 0x97, 0x76,
+    0xAE, 0x3E, 0x72, 0xDA, 0x1E, 0x93, 0xE7, 0x19, 0xDA, 0x09, 0xE3, 0x9D, 0xA7, 0x1A, 0xD9, 0x0E,
+    0x4A, 0xD9, 0x71, 0xAF, 0xD9, 0x4E, 0x72, 0xFC, 0xA6, 0xE7, 0x2E, 0x97, 0x9D, 0xA7, 0x19, 0xDA,
+    0x70, 0x9D, 0xA7, 0x1A, 0xD9, 0x70, 0xAD, 0x97, 0x1E, 0x71, 0xE7, 0x2E, 0x71, 0xE7, 0x2E, 0x70,
+    0x9D, 0xA7, 0x19, 0xDA, 0x70, 0xAD, 0x97, 0x1A, 0xD9, 0x70, 0xAD, 0x72, 0xE7, 0x1E, 0x72, 0xE7,
+    0x1E, 0x71, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0xAD, 0x97, 0x09, 0xDA, 0x71, 0xE7, 0x19, 0xDA, 0x70,
+    0x9E, 0x72, 0xE7, 0x0E, 0x97, 0x2E, 0xA6, 0xF7, 0x39, 0xF9, 0x99, 0x9A, 0xF7, 0x5A, 0xFF, 0xE7,
+    0x79, 0xFF, 0x97, 0x74, 0x99, 0x97, 0x70, 0x71, 0x99, 0x77, 0x4A, 0xF9, 0x77, 0x19, 0xA9, 0xE7,
+    0x75, 0xD7, 0x74, 0xAD, 0x77, 0x2A, 0xE9, 0x77, 0x2D, 0x97, 0x73, 0x9C, 0xA7, 0x9A, 0xA9, 0x71,
+    0x97, 0x0E, 0x97, 0x73, 0xE3, 0x9D, 0x96, 0xAD, 0x1A, 0xD9, 0x3E, 0x7E, 0x0A, 0xDA, 0x4E, 0x7F,
+    0xDA, 0x5E, 0x69, 0xFA, 0x69, 0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x96, 0xAD, 0x71, 0xE7, 0xE7, 0x1E,
+    0x7E, 0x70, 0x9D, 0xA6, 0x9D, 0xA7, 0x09, 0xD9, 0x6A, 0xD9, 0x70, 0xAD, 0x96, 0xE7, 0x1E, 0x69,
+    0xE7, 0x1E, 0x6E, 0xA7, 0x1E, 0x5A, 0xE9, 0x71, 0xE4, 0xAF, 0x97, 0x1E, 0xA1, 0x9D, 0xAA, 0xD7,
+    0x29, 0xFE, 0xA0, 0xAD, 0x73, 0xAF, 0xC9, 0x1D, 0xA7, 0x59, 0x97, 0x71, 0x71, 0x99, 0x49, 0xA7,
+    0x79, 0xFA, 0x2D, 0x77, 0xFE, 0xAD, 0x97, 0x6A, 0xCA, 0x1A, 0xFC, 0x77, 0xAC, 0x4A, 0xAA, 0x77,
+    0x77, 0x19, 0x99, 0x77, 0x6A, 0xE3, 0xE7, 0x2D, 0xA1, 0xE9, 0x3E, 0x71, 0x9D, 0xA0, 0x9E, 0x39,
+    0xDA, 0x71, 0xAD, 0x90, 0xE4, 0xAD, 0x97, 0x1A, 0xFD, 0x94, 0xE7, 0x2F, 0xCA, 0x6E, 0x72, 0xE9,
+    0x79, 0xDA, 0x71, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0xAD, 0x97, 0x0A, 0xD9, 0x71, 0xE7, 0x1E, 0x72,
+    0xE7, 0x1E, 0x72, 0xE7, 0x09, 0xDA, 0x71, 0x9D, 0xA7, 0x0A, 0xD9, 0x71, 0xAD, 0x97, 0x0A, 0xD7,
+    0x2E, 0x71, 0xE7, 0x2E, 0x71, 0xE7, 0x19, 0xDA, 0x70, 0x9D, 0xA7, 0x1A, 0xD9, 0x70, 0x9D, 0xA7,
+    0x1E, 0x71, 0x9D, 0xA7, 0x09, 0xE7, 0x2E, 0x70, 0xE9, 0x72, 0xEA, 0x6F, 0x73, 0x9F, 0x99, 0x99,
+    0xAF, 0x75, 0xAF, 0xFE, 0x77, 0x9F, 0xF9, 0x77, 0x49, 0x99, 0x77, 0x00, 0x79, 0x94, 0x9A, 0x74,
+    0x9F, 0xA2, 0xD7, 0x4F, 0xEA, 0xDA, 0x73, 0x9C, 0xA1, 0xAF, 0xC7, 0x4A, 0xC4, 0xAC, 0xA4, 0x9A,
+    0xA9, 0x77, 0x3E, 0x97, 0x73, 0xE3, 0x9D, 0x96, 0xAD, 0x1A, 0xD9, 0x3E, 0x7E, 0x0A, 0xDA, 0x4E,
+    0x7F, 0xDA, 0x5E, 0x69, 0xFA, 0x69, 0xDA, 0x69, 0xD9, 0x70, 0xAD, 0x96, 0xAD, 0x71, 0xE7, 0xE7,
+    0x1E, 0x7E, 0x70, 0x9D, 0xA6, 0x9D, 0xA7, 0x09, 0xD9, 0x6A, 0xD9, 0x70, 0xAD, 0x96, 0xE7, 0x1E,
+    0x69, 0xE7, 0x1E, 0x6E, 0xA7, 0x1E, 0x5A, 0xE9, 0x71, 0xE4, 0xAF, 0x97, 0x1E, 0xA1, 0x9D, 0xAA,
+    0xD7, 0x29, 0xFE, 0xA0, 0xAD, 0x73, 0xAF, 0xC9, 0x1D, 0xA7, 0x59, 0x97, 0x71, 0x77, 0x79, 0x99,
+    0x77, 0x6A, 0xE3, 0xE7, 0x2D, 0xA1, 0xE9, 0x3E, 0x71, 0x9D, 0xA0, 0x9E, 0x39, 0xDA, 0x71, 0xAD,
+    0x90, 0xE4, 0xAD, 0x97, 0x1A, 0xFD, 0x94, 0xE7, 0x2F, 0xCA, 0x6E, 0x72, 0xE9, 0x79, 0xDA, 0x71,
+    0x9D, 0xA7, 0x09, 0xDA, 0x71, 0xAD, 0x97, 0x0A, 0xD9, 0x71, 0xE7, 0x1E, 0x72, 0xE7, 0x1E, 0x72,
+    0xE7, 0x09, 0xDA, 0x71, 0x9D, 0xA7, 0x0A, 0xD9, 0x71, 0xAD, 0x97, 0x0A, 0xD7, 0x2E, 0x71, 0xE7,
+    0x2E, 0x71, 0xE7, 0x19, 0xDA, 0x70, 0x9D, 0xA7, 0x1A, 0xD9, 0x70, 0x9D, 0xA7, 0x1E, 0x71, 0x9D,
+    0xA7, 0x09, 0xE7, 0x2E, 0x70, 0xE9, 0x72, 0xEA, 0x6F, 0x73, 0x9F, 0x99, 0x99, 0xAF, 0x75, 0xAF,
+    0xFE, 0x77, 0x9F, 0xF9, 0x77, 0x49, 0x99, 0x77, 0x77, 0x77, 0x1A, 0xC9, 0x77, 0x6A, 0xE7, 0x76,
+    0xAD, 0xA7, 0x77, 0xCA, 0x77, 0x20, 0x77, 0x39, 0xAA, 0x97, 0x73, 0xE9, 0x77, 0x3E, 0x39, 0xD9,
+    0x6A, 0xD1, 0xAD, 0x93, 0xE7, 0xE0, 0xAD, 0xA4, 0xE7, 0xFD, 0xA5, 0xE6, 0x9F, 0xA6, 0x9D, 0xA6,
+    0x9D, 0x97, 0x0A, 0xD9, 0x6A, 0xD7, 0x1E, 0x7E, 0x71, 0xE7, 0xE7, 0x09, 0xDA, 0x69, 0xDA, 0x70,
+    0x9D, 0x96, 0xAD, 0x97, 0x0A, 0xD9, 0x6E, 0x71, 0xE6, 0x9E, 0x71, 0xE6, 0xEA, 0x71, 0xE5, 0xAE,
+    0x97, 0x1E, 0x4A, 0xF9, 0x71, 0xEA, 0x19, 0xDA, 0xAD, 0x72, 0x9F, 0xEA, 0x0A, 0xD7, 0x3A, 0xFC,
+    0x91, 0xDA, 0x75, 0x99, 0x77, 0x77, 0x76, 0xAC, 0x97, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x74,
+    0xCA, 0x77, 0x00, 0x5A, 0xA9, 0x76, 0xE7, 0x69, 0xDA, 0x76, 0xAD, 0x77, 0xDA, 0x77, 0xD7, 0x77,
+    0x77, 0x2A, 0xD7, 0x19, 0xDA, 0x0A, 0xD9, 0x70, 0xE1, 0x9D, 0xA7, 0xE9, 0x2E, 0x69, 0xE3, 0xE6,
+    0xE4, 0xAD, 0x94, 0xE9, 0x49, 0xDA, 0x39, 0xDA, 0x6E, 0x3E, 0x7E, 0x2E, 0x97, 0xAD, 0x19, 0xDA,
+    0x70, 0x9D, 0x90, 0xE7, 0x2D, 0xAA, 0xD9, 0x72, 0xAF, 0xA7, 0x39, 0xF7, 0x5E, 0x97, 0x5E, 0x75,
+    0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6E, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7,
+    0x40, 0x71, 0xAA, 0xA7, 0x72, 0xAD, 0xA7, 0x72, 0xE7, 0x72, 0x9D, 0x97, 0x72, 0x9D, 0x77, 0x3A,
+    0xC9, 0x77, 0x77, 0x77, 0x69, 0xDA, 0x70, 0xE6, 0xDA, 0x7A, 0xD9, 0x6E, 0x7E, 0x7E, 0x6E, 0x97,
+    0xE5, 0x9E, 0x70, 0xAD, 0x5E, 0x71, 0x9D, 0x93, 0x9D, 0xA7, 0x19, 0xDA, 0x3E, 0x73, 0xDA, 0x29,
+    0xDA, 0x73, 0xE2, 0xE7, 0x4E, 0x19, 0xDA, 0x74, 0xAD, 0x1E, 0x75, 0xAD, 0x09, 0xD9, 0x75, 0x9D,
+    0x0E, 0x76, 0x9D, 0x9D, 0x97, 0x7F, 0xC7, 0x70, 0xF9, 0x77, 0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9D,
+    0xA7, 0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x70, 0x9E, 0x75, 0xA9, 0x9A, 0xE7, 0x6F, 0xD9, 0x76, 0xFA,
+    0x77, 0xAD, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x0E, 0x19, 0xDA, 0x7E, 0x92, 0xE6, 0x9E, 0x3E, 0x6E,
+    0x4A, 0xD9, 0x4E, 0x94, 0x9D, 0xA3, 0x9D, 0xA6, 0xE3, 0xE7, 0xE2, 0xE9, 0x7A, 0xD1, 0x9D, 0xA7,
+    0x09, 0xD9, 0x0E, 0x72, 0xDA, 0xAD, 0x97, 0x2A, 0xFA, 0x73, 0x9F, 0x75, 0xE9, 0x75, 0xE7, 0x59,
+    0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x77,
+    0x77, 0x77, 0x2D, 0x76, 0xE9, 0x75, 0xE9, 0x75, 0x9C, 0xA7, 0x50, 0x49, 0xDA, 0x70, 0xE6, 0xDA,
+    0x7A, 0xD9, 0x6E, 0x7E, 0x7E, 0x6E, 0x97, 0xE5, 0x9E, 0x70, 0xAD, 0x5E, 0x71, 0x9D, 0x93, 0x9D,
+    0xA7, 0x19, 0xDA, 0x3E, 0x73, 0xDA, 0x29, 0xDA, 0x73, 0xE2, 0xE7, 0x4E, 0x19, 0xDA, 0x74, 0xAD,
+    0x1E, 0x75, 0xAD, 0x09, 0xD9, 0x75, 0x9D, 0x0E, 0x76, 0x9D, 0x9D, 0x97, 0x7F, 0xC7, 0x70, 0xF9,
+    0x77, 0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xE1, 0x9C, 0xA7, 0x4A, 0xDA, 0x1E, 0x97,
+    0x29, 0xE2, 0xE7, 0xA9, 0x9A, 0xE3, 0xAC, 0x97, 0xFD, 0x97, 0x6F, 0xA7, 0x70, 0x6A, 0xDA, 0x97,
+    0x4F, 0xC9, 0x76, 0xDA, 0x76, 0xAC, 0xA7, 0x49, 0xAD, 0x74, 0xAD, 0xA7, 0x5D, 0x97, 0x6D, 0x77,
+    0x72, 0xAD, 0x71, 0x9D, 0xA0, 0xAD, 0x97, 0x0E, 0x19, 0xDA, 0x7E, 0x92, 0xE6, 0x9E, 0x3E, 0x6E,
+    0x4A, 0xD9, 0x4E, 0x94, 0x9D, 0xA3, 0x9D, 0xA6, 0xE3, 0xE7, 0xE2, 0xE9, 0x7A, 0xD1, 0x9D, 0xA7,
+    0x09, 0xD9, 0x0E, 0x72, 0xDA, 0xAD, 0x97, 0x2A, 0xFA, 0x73, 0x9F, 0x75, 0xE9, 0x75, 0xE7, 0x59,
+    0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xE7, 0x6D, 0xA7, 0x59, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x74,
+    0x74, 0x99, 0x77, 0x2F, 0xC7, 0x70, 0xA9, 0xAD, 0xA7, 0x72, 0xAC, 0xA7, 0x72, 0xDA, 0x77, 0x9E,
+    0xA7, 0x70, 0xAC, 0xA7, 0x72, 0xD7, 0x73, 0x99, 0x77, 0x77, 0x29, 0xDA, 0x70, 0xE6, 0xDA, 0x7A,
+    0xD9, 0x6E, 0x7E, 0x7E, 0x6E, 0x97, 0xE5, 0x9E, 0x70, 0xAD, 0x5E, 0x71, 0x9D, 0x93, 0x9D, 0xA7,
+    0x19, 0xDA, 0x3E, 0x73, 0xDA, 0x29, 0xDA, 0x73, 0xE2, 0xE7, 0x4E, 0x19, 0xDA, 0x74, 0xAD, 0x1E,
+    0x75, 0xAD, 0x09, 0xD9, 0x75, 0x9D, 0x0E, 0x76, 0x9D, 0x9D, 0x97, 0x7F, 0xC7, 0x70, 0xF9, 0x77,
+    0x0E, 0xA7, 0x71, 0xE7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x70, 0x9E, 0x75, 0xA9,
+    0x9A, 0xE7, 0x6F, 0xD9, 0x76, 0xFA, 0x77, 0x59, 0x95, 0xA9, 0x6F, 0xC2, 0xAC, 0x95, 0xAF, 0xDA,
+    0xAD, 0x6D, 0x19, 0xFC, 0x95, 0x9C, 0x93, 0x9A, 0xA7, 0x77, 0x77, 0x0A, 0xD7, 0x19, 0xDA, 0x0A,
+    0xD9, 0x70, 0xE1, 0x9D, 0xA7, 0xE9, 0x2E, 0x69, 0xE3, 0xE6, 0xE4, 0xAD, 0x94, 0xE9, 0x49, 0xDA,
+    0x39, 0xDA, 0x6E, 0x3E, 0x7E, 0x2E, 0x97, 0xAD, 0x19, 0xDA, 0x70, 0x9D, 0x90, 0xE7, 0x2D, 0xAA,
+    0xD9, 0x72, 0xAF, 0xA7, 0x39, 0xF7, 0x5E, 0x97, 0x5E, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7,
+    0x6E, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x40, 0x72, 0x99, 0x49, 0x97, 0x2A,
+    0xF9, 0x2C, 0xA7, 0x19, 0xFE, 0xAD, 0x97, 0x1A, 0xC9, 0x1A, 0xFA, 0x72, 0xCA, 0x39, 0xAA, 0x97,
+    0x77, 0x77, 0x74, 0x9D, 0xA7, 0x0E, 0x6D, 0xA7, 0xAD, 0x96, 0xE7, 0xE7, 0xE6, 0xE9, 0x7E, 0x59,
+    0xE7, 0x0A, 0xD5, 0xE7, 0x19, 0xD9, 0x39, 0xDA, 0x71, 0x9D, 0xA3, 0xE7, 0x3D, 0xA2, 0x9D, 0xA7,
+    0x3E, 0x2E, 0x74, 0xE1, 0x9D, 0xA7, 0x4A, 0xD1, 0xE7, 0x5A, 0xD0, 0x9D, 0x97, 0x59, 0xD0, 0xE7,
+    0x69, 0xD9, 0xD9, 0x77, 0xFC, 0x77, 0x0F, 0x97, 0x70, 0xEA, 0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77,
+    0x1E, 0x77, 0x1A, 0xDA, 0x77, 0x09, 0xE7, 0x5A, 0x99, 0xAE, 0x76, 0xFD, 0x97, 0x6F, 0xA7, 0x70,
+    0x3C, 0x7D, 0x7D, 0x1A, 0xFE, 0x0A, 0xC2, 0xD1, 0xAA, 0x1A, 0xC2, 0xAA, 0x1C, 0x3A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x3C, 0x6C, 0xA5,
+    0xD5, 0xFE, 0xA1, 0xCA, 0x2C, 0xA2, 0xCA, 0x1A, 0xA3, 0xC1, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0x19, 0x99, 0x99, 0x99, 0x1A,
+    0xFE, 0x1F, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x00, 0x19, 0x99, 0x99, 0x99, 0x1A, 0xFE, 0x1F, 0xF1,
+    0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x1A, 0xFF, 0xFD, 0x90, 0xFF, 0xFE, 0x19, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFA, 0x0F,
+    0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x00, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0x0F, 0xFF, 0xFF, 0xFF, 0xCA, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x99, 0x59, 0x0D, 0x93,
+    0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC,
+    0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD,
+    0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93,
+    0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC,
+    0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD,
+    0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93, 0xAC, 0xAD, 0x93,
+    0xAC, 0xA7, 0x10, 0x77, 0x1F, 0xFF, 0xC1, 0x9F, 0xFF, 0xC7, 0x77, 0x71, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA2, 0xFF, 0xFC, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x3A, 0xC9, 0x29,
+    0xD3, 0xDA, 0x2A, 0xD3, 0xE2, 0xE9, 0x19, 0xE2, 0xEA, 0x29, 0x99, 0x30, 0x2A, 0xD9, 0x2E, 0x2A,
+    0xDA, 0x2E, 0x29, 0xDA, 0x2E, 0x3D, 0x92, 0xAD, 0x39, 0x94, 0x29, 0xE2, 0xEA, 0x2E, 0x2A, 0xD9,
+    0x2E, 0x29, 0xD9, 0x2D, 0xA2, 0x9D, 0x49, 0x40, 0x0D, 0xA1, 0xE1, 0xE1, 0xE1, 0xE1, 0xAD, 0x19,
+    0xD2, 0xD2, 0x99, 0x00, 0x3A, 0xC9, 0x2A, 0xC9, 0x29, 0xD2, 0x9D, 0x3D, 0xA2, 0xE2, 0xAD, 0x2A,
+    0xD9, 0x2E, 0x2E, 0x2E, 0x91, 0xAD, 0xA1, 0x9E, 0x2E, 0x2E, 0xA1, 0xAD, 0xA2, 0x99, 0x92, 0x99,
+    0x93, 0x2A, 0xD9, 0x1A, 0xDA, 0x2E, 0x2E, 0x91, 0xAD, 0xA1, 0x9E, 0x2E, 0x2E, 0x91, 0x9D, 0xA2,
+    0xDA, 0x2E, 0x2A, 0xD3, 0xD9, 0x2D, 0xA2, 0xAD, 0x29, 0xD3, 0x99, 0x39, 0x94, 0x29, 0xE1, 0x9E,
+    0x3E, 0xA1, 0xAD, 0xA3, 0xE2, 0xE3, 0xAD, 0x91, 0xAD, 0xA3, 0xE2, 0xE3, 0x9D, 0x91, 0x9D, 0x93,
+    0xDA, 0x2E, 0x39, 0xD3, 0xD5, 0x94, 0x95, 0x9D, 0xA1, 0x9D, 0x99, 0xDA, 0x1A, 0xD9, 0x0E, 0x19,
+    0xDA, 0x0E, 0x19, 0xDA, 0x0E, 0x2D, 0xA0, 0xAD, 0x2D, 0xA0, 0x9D, 0x2A, 0xCA, 0x1D, 0x29, 0xD1,
+    0x99, 0x39, 0x90, 0x69, 0x99, 0x70, 0xAD, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x1D, 0xA7, 0x1D, 0x97,
+    0x1D, 0x5E, 0xAA, 0xDA, 0xAE, 0x0F, 0xFE, 0xA9, 0xCA, 0xA9, 0xDA, 0xAA, 0xAC, 0x94, 0xD7, 0x2D,
+    0x71, 0x9C, 0xA7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x70, 0x70, 0x99,
+    0x97, 0x39, 0xE7, 0x3A, 0xD9, 0x73, 0xAD, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0xAA, 0x99, 0x0D, 0x99,
+    0x9A, 0xA3, 0xFF, 0xF2, 0x9F, 0xFE, 0xA7, 0xAC, 0x97, 0x4D, 0x97, 0x39, 0xD9, 0x73, 0xAD, 0x97,
+    0x3E, 0x74, 0xE7, 0x4D, 0x97, 0x4D, 0x70, 0x99, 0x90, 0x9C, 0xA1, 0x99, 0x92, 0xAF, 0xFE, 0xA2,
+    0xAF, 0xFE, 0x92, 0x93, 0xD3, 0x97, 0x0D, 0x74, 0xAD, 0x74, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x70,
+    0x29, 0x93, 0xAF, 0x90, 0x9F, 0xD0, 0xAF, 0xD9, 0xFE, 0xAA, 0xFD, 0xAA, 0xFD, 0x90, 0xFD, 0x2A,
+    0xDA, 0x10, 0x75, 0xC9, 0x79, 0xDA, 0x6A, 0xF5, 0xFD, 0x93, 0xFE, 0xA2, 0xFF, 0x90, 0x9F, 0xD9,
+    0x2A, 0xEA, 0x5D, 0x97, 0x71, 0x59, 0xD9, 0x0F, 0x9F, 0x0E, 0x91, 0x91, 0x76, 0x9D, 0x94, 0xDA,
+    0x1F, 0x3A, 0xE0, 0x9F, 0x3F, 0x1E, 0x93, 0xEA, 0x29, 0x69, 0x91, 0x77, 0x69, 0xD9, 0x4A, 0xD4,
+    0x9D, 0xA0, 0xF3, 0xAE, 0x93, 0xF9, 0xF3, 0xAE, 0x93, 0xF0, 0xE9, 0x3A, 0xE4, 0xE9, 0x19, 0x69,
+    0x96, 0x99, 0x00, 0x5A, 0xD0, 0x9E, 0x9A, 0xE9, 0xAE, 0x19, 0x91, 0x70, 0xAF, 0xE0, 0xAC, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x69, 0x96, 0x71, 0xFE, 0xA6, 0xCA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92,
+    0xFF, 0xCA, 0x99, 0x99, 0x99, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0xA5, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xFF, 0x99, 0x99, 0x99,
+    0xAC, 0x59, 0xC5, 0x9C, 0x59, 0xC5, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x77, 0x77, 0x69, 0xF9, 0x70, 0xAC, 0xA7, 0x7A,
+    0xFD, 0x7A, 0xD7, 0x79, 0xDA, 0x1D, 0xA5, 0x9D, 0x97, 0x7D, 0xA2, 0xAD, 0x5D, 0xA7, 0x79, 0xD3,
+    0xAD, 0x4A, 0xD7, 0x70, 0xAC, 0xA3, 0xAD, 0x39, 0xD7, 0x71, 0xD9, 0x3A, 0xCA, 0x3D, 0x97, 0x71,
+    0xD9, 0x3D, 0xA2, 0xDA, 0x77, 0x19, 0xD4, 0xD9, 0x1A, 0xD7, 0x72, 0x9D, 0x39, 0xD1, 0x9D, 0x19,
+    0xAA, 0x96, 0x9A, 0xA9, 0x29, 0xD3, 0xDA, 0x1D, 0x90, 0xFD, 0x4F, 0xD2, 0xD9, 0x19, 0xD1, 0xDA,
+    0x0E, 0xAA, 0xDA, 0x2E, 0xAA, 0xDA, 0x1E, 0x9A, 0xDA, 0x0A, 0xD0, 0x9D, 0x91, 0xAD, 0x1A, 0xD2,
+    0xAD, 0x19, 0xFC, 0xA0, 0x9D, 0x1D, 0xA2, 0x9D, 0x1D, 0xA2, 0x9D, 0x29, 0xAC, 0xA9, 0x1D, 0x90,
+    0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD7, 0x0D, 0xA1, 0xAD, 0x39, 0xD0, 0xAD, 0x39, 0xD7, 0xAD, 0x2D,
+    0xA3, 0xAD, 0x0D, 0xA3, 0xAD, 0x69, 0xD3, 0xD9, 0x3A, 0xCA, 0x0D, 0x93, 0xDA, 0x6D, 0x93, 0xD9,
+    0x3D, 0x90, 0xD9, 0x3D, 0x95, 0xDA, 0x4D, 0x92, 0x9D, 0x1D, 0x39, 0xD5, 0xAD, 0x5D, 0x92, 0xDA,
+    0x1D, 0x92, 0xDA, 0x49, 0xD6, 0xE1, 0xAD, 0x2D, 0xA1, 0xAD, 0x5D, 0x96, 0x9F, 0xD9, 0x2A, 0xFD,
+    0x94, 0xDA, 0x70, 0xAF, 0x94, 0xAF, 0x97, 0x73, 0x99, 0x70, 0x96, 0x77, 0x77, 0x77, 0x09, 0xF9,
+    0x70, 0xAC, 0xA7, 0x77, 0x1A, 0xFD, 0x7A, 0xD7, 0x77, 0x19, 0xDA, 0x1D, 0xA5, 0x9D, 0x97, 0x77,
+    0x1D, 0xA2, 0xAD, 0x5D, 0xA7, 0x77, 0x19, 0xD3, 0xAD, 0x4A, 0xD7, 0x77, 0x2A, 0xCA, 0x3A, 0xD3,
+    0x9D, 0x77, 0x73, 0xD9, 0x3A, 0xCA, 0x3D, 0x97, 0x77, 0x3D, 0x93, 0xDA, 0x2D, 0xA7, 0x77, 0x39,
+    0xD4, 0xD9, 0x1A, 0xD7, 0x77, 0x49, 0xD3, 0x9D, 0x19, 0xD1, 0x9A, 0xA9, 0x69, 0xAA, 0x96, 0x9A,
+    0xA9, 0x19, 0xD3, 0xDA, 0x1D, 0x90, 0xFD, 0x4F, 0xD4, 0xFD, 0x1D, 0x91, 0x9D, 0x1D, 0xA0, 0xEA,
+    0xAD, 0xA2, 0xEA, 0xAD, 0xA2, 0xEA, 0xAD, 0x90, 0xE9, 0xAD, 0xA0, 0xAD, 0x09, 0xD9, 0x1A, 0xD1,
+    0xAD, 0x2A, 0xD1, 0xAD, 0x2E, 0x09, 0xFC, 0xA0, 0x9D, 0x1D, 0xA2, 0x9D, 0x1D, 0x92, 0x9D, 0x1D,
+    0x92, 0xAD, 0x19, 0xAC, 0xA9, 0x1D, 0x90, 0x9D, 0x39, 0xD0, 0x9D, 0x39, 0xD0, 0xAD, 0x39, 0xD7,
+    0xDA, 0x1A, 0xD3, 0x9D, 0x0A, 0xD3, 0x9D, 0x0D, 0xA3, 0xAD, 0x6A, 0xD2, 0xDA, 0x3A, 0xD0, 0xDA,
+    0x3A, 0xD0, 0xD9, 0x3A, 0xCA, 0x59, 0xD3, 0xD9, 0x3A, 0xCA, 0x0D, 0x93, 0xDA, 0x0D, 0x93, 0xD9,
+    0x5D, 0x93, 0xD9, 0x3D, 0x90, 0xD9, 0x3D, 0x99, 0xD4, 0xD5, 0xDA, 0x4D, 0x92, 0x9D, 0x1D, 0x39,
+    0xD0, 0x9D, 0x3A, 0xD4, 0xAD, 0x5D, 0x92, 0xDA, 0x1D, 0x92, 0xDA, 0x09, 0xD3, 0xD9, 0x39, 0xD6,
+    0xE1, 0xAD, 0x2D, 0xA1, 0xAD, 0x2D, 0xA1, 0xAD, 0x4D, 0x96, 0x9F, 0xD9, 0x2A, 0xFD, 0x92, 0xAF,
+    0xD9, 0x3D, 0xA7, 0x0A, 0xF9, 0x4A, 0xF9, 0x4F, 0xC9, 0x77, 0x29, 0x97, 0x09, 0x71, 0x95, 0x3A,
+    0xD9, 0x3E, 0x3A, 0xD4, 0xDA, 0x3A, 0xD4, 0xD9, 0x3A, 0xCA, 0x4D, 0x49, 0xC9, 0x40, 0x3A, 0xD9,
+    0x1E, 0x4E, 0x1A, 0xD9, 0x3A, 0xD2, 0xE4, 0xDA, 0x1A, 0xD4, 0xAD, 0x2D, 0xA4, 0xD9, 0x19, 0xD4,
+    0xAC, 0xA2, 0xD5, 0xD2, 0x9C, 0xA4, 0x9C, 0x92, 0xAA, 0x50, 0x3A, 0xD9, 0x1E, 0x19, 0xDA, 0x3E,
+    0x1A, 0xD9, 0x1E, 0x3A, 0xD2, 0xE1, 0x9D, 0x93, 0xDA, 0x1A, 0xD2, 0xE3, 0xAD, 0x2D, 0xA1, 0x9D,
+    0x4D, 0x91, 0x9D, 0x2D, 0xA3, 0xAC, 0xA2, 0xD2, 0x9D, 0x4D, 0x29, 0xCA, 0x2D, 0x49, 0xC9, 0x2A,
+    0xA3, 0xCA, 0x40, 0x9D, 0x91, 0xDA, 0x1D, 0xA1, 0xAD, 0x19, 0xD2, 0xD9, 0x1A, 0xC9, 0x19, 0xCA,
+    0x2C, 0xA0, 0x9D, 0x90, 0x9D, 0x92, 0xDA, 0x1D, 0xA2, 0xDA, 0x1E, 0x2A, 0xD1, 0x9D, 0x29, 0xD2,
+    0xD3, 0xD9, 0x1D, 0x92, 0xAC, 0x91, 0xAC, 0xA2, 0x9C, 0xA1, 0x9D, 0x3C, 0xA2, 0xD0, 0x9D, 0x90,
+    0x9D, 0x91, 0xDA, 0x2D, 0xA1, 0xDA, 0x1E, 0x2D, 0xA1, 0xE1, 0xAD, 0x2A, 0xD1, 0x9D, 0x19, 0xD2,
+    0x9D, 0x2D, 0x2D, 0x92, 0xD9, 0x1D, 0x91, 0xAC, 0xA2, 0xAC, 0x91, 0xAC, 0xA1, 0x9C, 0xA2, 0x9C,
+    0xA1, 0x9D, 0x2D, 0x3C, 0xA2, 0xD2, 0xAC, 0x00, 0x69, 0xA7, 0x2D, 0x97, 0x0E, 0xA7, 0xAC, 0xAD,
+    0x69, 0xD0, 0xAC, 0x6D, 0x19, 0xC9, 0x4A, 0xC9, 0x2D, 0x39, 0xCA, 0x3D, 0x3D, 0x4A, 0xC9, 0x1D,
+    0x95, 0xCA, 0x0A, 0xCA, 0x6D, 0x00, 0x59, 0x69, 0xD4, 0x9D, 0xA3, 0x9D, 0xA3, 0x9E, 0x39, 0xE3,
+    0x9E, 0x49, 0xDA, 0x5E, 0x59, 0xD9, 0x5E, 0x59, 0xD9, 0x5E, 0x6C, 0xA7, 0x30, 0x29, 0x95, 0x9D,
+    0x6D, 0xA5, 0xAD, 0x6D, 0xA5, 0xAD, 0x6D, 0xA5, 0xE4, 0xEA, 0x3E, 0x93, 0xAD, 0x93, 0xAD, 0x93,
+    0x9D, 0x95, 0xC9, 0x76, 0x77, 0x73, 0x97, 0xAD, 0x97, 0x92, 0xAD, 0x6E, 0xA6, 0xD9, 0x19, 0xE5,
+    0xEA, 0x5E, 0x39, 0xE4, 0x9C, 0xA5, 0xE5, 0x9E, 0x73, 0xE7, 0x9E, 0x71, 0xE7, 0x19, 0xE7, 0xE7,
+    0x39, 0xE5, 0xE7, 0x59, 0xE3, 0xE7, 0x79, 0xE1, 0xE7, 0x19, 0xA9, 0x49, 0xFD, 0x5A, 0xA9, 0x1E,
+    0x59, 0xF5, 0x9E, 0x09, 0xE9, 0x5F, 0x59, 0xE1, 0xE5, 0xFD, 0x5E, 0x71, 0xE0, 0x9E, 0x77, 0x0E,
+    0x29, 0xE7, 0x6E, 0x49, 0xE7, 0x4E, 0x69, 0xDA, 0x72, 0xE7, 0x09, 0xDA, 0x70, 0xE7, 0x29, 0xDA,
+    0x6E, 0x59, 0x94, 0x9D, 0xA4, 0xE5, 0xE9, 0x49, 0xDA, 0x2A, 0xD6, 0xEA, 0x59, 0xD9, 0x2A, 0x7E,
+    0x96, 0x9A, 0x75, 0x99, 0x73, 0x49, 0xE3, 0xAD, 0xA4, 0xAE, 0x3E, 0xA4, 0xEA, 0x3E, 0x94, 0xE9,
+    0x3E, 0x5E, 0x39, 0xE4, 0x9E, 0x3A, 0xDA, 0x4A, 0xDA, 0x3E, 0x94, 0xAD, 0x93, 0xE5, 0xE4, 0xE5,
+    0xE3, 0x9D, 0xA5, 0xDA, 0x39, 0xD9, 0x49, 0xD9, 0x3A, 0xD5, 0xAD, 0x4E, 0x5E, 0x4D, 0xA5, 0xDA,
+    0x4D, 0x95, 0xD9, 0x39, 0xD5, 0x9D, 0x4A, 0xD6, 0x99, 0x59, 0x77, 0x77, 0x79, 0xD9, 0x3A, 0xD5,
+    0xF2, 0x9E, 0xA3, 0x9F, 0x2A, 0xEA, 0x4E, 0x92, 0x9E, 0x69, 0x59, 0x95, 0x77, 0x09, 0xFD, 0x93,
+    0xAF, 0xFD, 0x29, 0xFD, 0xAE, 0xA2, 0xA0, 0x9D, 0xA0, 0x9E, 0x4A, 0xD9, 0x1E, 0x4E, 0x2E, 0x4E,
+    0x2E, 0x4D, 0xA1, 0x9D, 0xA3, 0x9D, 0x91, 0xE9, 0x39, 0xD1, 0xEA, 0x4A, 0xD9, 0xEA, 0x5F, 0xD9,
+    0x6F, 0xC9, 0x7F, 0x70, 0x9E, 0x71, 0x9D, 0x72, 0xAD, 0x73, 0x97, 0x77, 0x76, 0x9D, 0x97, 0x1E,
+    0xA7, 0x09, 0xEA, 0x70, 0x9E, 0x72, 0x99, 0x72, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09,
+    0xFF, 0xFC, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x0C, 0x74, 0x9A, 0x09, 0xC9, 0x73,
+    0xCA, 0x1D, 0x72, 0xD2, 0xAC, 0xA7, 0x9D, 0x4D, 0xA5, 0xAD, 0x95, 0xFF, 0xCA, 0x70, 0x9A, 0xFA,
+    0x60, 0x79, 0x99, 0x97, 0x3A, 0xFD, 0xA7, 0xAE, 0x99, 0x99, 0xE9, 0x4A, 0xD6, 0x9D, 0x3A, 0xCA,
+    0x71, 0xCA, 0x19, 0xC9, 0x72, 0xAC, 0x1C, 0xA7, 0x4C, 0x90, 0x97, 0x59, 0x00, 0x75, 0x99, 0x74,
+    0xAC, 0x97, 0x39, 0xCA, 0x74, 0xD7, 0x49, 0xC9, 0x74, 0xD7, 0x4A, 0xC9, 0x73, 0x9C, 0xA7, 0x4D,
+    0x74, 0xAC, 0x97, 0x4D, 0x74, 0xAC, 0x74, 0x9D, 0x74, 0xE7, 0x3A, 0xE7, 0x3D, 0x9C, 0x97, 0x1D,
+    0x1C, 0xA7, 0x09, 0xCA, 0x1D, 0x70, 0xD2, 0xD7, 0xAC, 0x92, 0xAC, 0x7C, 0xA3, 0xAC, 0x95, 0xD4,
+    0x9C, 0xA4, 0x77, 0x29, 0x77, 0x77, 0x2E, 0x77, 0x77, 0x0D, 0xA7, 0x77, 0x70, 0xD9, 0x77, 0x71,
+    0xA9, 0x4D, 0x77, 0x72, 0xE9, 0x19, 0xCA, 0x77, 0x72, 0xFC, 0xAA, 0xC9, 0x77, 0x74, 0xAF, 0xCA,
+    0xAF, 0xC7, 0x77, 0x1F, 0xFD, 0x77, 0x70, 0xAE, 0xA1, 0x99, 0xAA, 0x77, 0x7A, 0xD0, 0xD7, 0x77,
+    0x4E, 0x1A, 0xCA, 0x77, 0x72, 0xE9, 0x19, 0xD7, 0x77, 0x2D, 0xA3, 0xDA, 0x77, 0x72, 0xA4, 0xE7,
+    0x73, 0x9D, 0x97, 0x0A, 0xA9, 0x3A, 0xCA, 0x74, 0x9D, 0x97, 0x7A, 0xD7, 0x4A, 0xD7, 0x70, 0xAD,
+    0x69, 0x4A, 0xCA, 0x72, 0x94, 0xD9, 0x59, 0xD9, 0x2A, 0xC9, 0x71, 0xAD, 0x92, 0xD6, 0xAF, 0x90,
+    0xD7, 0x2F, 0xC9, 0x0D, 0x79, 0xAF, 0xD9, 0x99, 0xAA, 0xA9, 0x49, 0xAF, 0xCA, 0x99, 0x9A, 0xAA,
+    0x49, 0xAF, 0xFC, 0x97, 0x9A, 0xFF, 0xC5, 0xAE, 0x99, 0xAA, 0xD9, 0x70, 0xF9, 0xAA, 0xE4, 0xAD,
+    0xAC, 0xA7, 0x5D, 0xAA, 0xC9, 0x70, 0xE1, 0xD7, 0x4E, 0x09, 0xD7, 0xE9, 0x1D, 0xA7, 0x2E, 0x2D,
+    0x95, 0xAD, 0xA2, 0xAD, 0x71, 0xAD, 0x92, 0xE6, 0xAC, 0x39, 0xD9, 0x71, 0xCA, 0x3A, 0xD7, 0x5D,
+    0x97, 0x79, 0xD9, 0x77, 0x77, 0x70, 0x71, 0xAF, 0xDA, 0x0F, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x00,
+    0x77, 0x09, 0xCA, 0x77, 0x09, 0xD9, 0x77, 0x0D, 0xA7, 0x70, 0xE7, 0x70, 0xAD, 0x77, 0x09, 0xD9,
+    0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77, 0x09, 0xD7, 0x71, 0xD9, 0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77,
+    0x09, 0xD7, 0x71, 0xD9, 0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77, 0x09, 0xD7, 0x71, 0xD9, 0x77, 0x0D,
+    0xA7, 0x70, 0xAD, 0x77, 0x09, 0xD7, 0x71, 0xD9, 0x77, 0x0D, 0xA7, 0x70, 0xAD, 0x77, 0x10, 0x6F,
+    0xD6, 0x9F, 0xD6, 0xAD, 0xAA, 0xAA, 0x6E, 0x72, 0xDA, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7,
+    0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2A, 0xD7, 0x2E, 0x99, 0x97, 0xFD, 0x95, 0x9F,
+    0xD6, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71,
+    0x9D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xFD, 0xA6, 0xFD, 0x96, 0x99, 0x99, 0x99, 0x60, 0x59,
+    0xFD, 0x6A, 0xFD, 0x69, 0xAA, 0xAD, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72,
+    0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x2D, 0xA6, 0x99, 0x9A, 0xD9, 0x59, 0xFD,
+    0x69, 0xFD, 0x72, 0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xAD, 0x72, 0xE7, 0x19, 0xDA, 0x6F, 0xD9, 0x59, 0xFD, 0x79, 0x99, 0x99,
+    0x96, 0x77, 0x76, 0x9F, 0xD9, 0x59, 0xAF, 0xCA, 0x3A, 0xFF, 0xD3, 0xFF, 0xD9, 0x19, 0xEA, 0x99,
+    0xAE, 0xA2, 0xEA, 0x99, 0xAF, 0x2A, 0x59, 0xE2, 0x99, 0x5E, 0x97, 0x1E, 0x72, 0xAD, 0x97, 0x1E,
+    0x72, 0xAD, 0x97, 0x1E, 0x72, 0xAD, 0x97, 0x09, 0xDA, 0x72, 0xE7, 0x1E, 0x72, 0xAD, 0xA7, 0x0E,
+    0xA7, 0x1A, 0xE7, 0x9E, 0xA7, 0x1F, 0x7A, 0xEA, 0x70, 0x9F, 0x7A, 0xE9, 0x70, 0x9E, 0xA7, 0x9E,
+    0x72, 0xE9, 0x70, 0xE7, 0x2A, 0xD7, 0x19, 0xD7, 0x3D, 0xA7, 0x1A, 0xD7, 0x29, 0xD7, 0x39, 0x74,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x19, 0xD9, 0x72, 0xDA, 0x71, 0xEA, 0x71, 0xF7, 0x09, 0xEA, 0x71,
+    0xF7, 0x09, 0xE7, 0x2E, 0xA7, 0x19, 0x97, 0x49, 0x97, 0x10, 0x77, 0x70, 0x9F, 0xD9, 0x6E, 0x90,
+    0xAF, 0xFD, 0x49, 0xE1, 0x9E, 0xA9, 0x9A, 0xEA, 0x39, 0xE2, 0xA5, 0x9E, 0x3A, 0xDA, 0x72, 0xE3,
+    0xE9, 0x72, 0xE3, 0xE7, 0x3E, 0x3E, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2E, 0x3A, 0xD9, 0x71, 0xEA,
+    0x3A, 0xD7, 0x09, 0xEA, 0x4E, 0x7A, 0xEA, 0x5D, 0xA6, 0xAE, 0x95, 0x9D, 0x95, 0x9E, 0x79, 0xD6,
+    0xE7, 0x0A, 0xD5, 0x9D, 0x71, 0xDA, 0x5A, 0xD7, 0x1D, 0x96, 0x97, 0x29, 0x97, 0x77, 0x77, 0x71,
+    0x9D, 0x97, 0x0D, 0xA5, 0xEA, 0x7F, 0x49, 0xEA, 0x7F, 0x49, 0xE7, 0x0E, 0xA5, 0x99, 0x72, 0x99,
+    0x50, 0x77, 0x74, 0x9E, 0x4A, 0xFD, 0x96, 0xAE, 0x2F, 0xFD, 0xA5, 0xEA, 0x2A, 0xEA, 0x99, 0xF9,
+    0x4E, 0x93, 0xA5, 0xAD, 0xA4, 0xE7, 0x39, 0xE3, 0x9E, 0x74, 0xE3, 0xAD, 0xA7, 0x39, 0xDA, 0x3A,
+    0xD9, 0x73, 0xAD, 0x93, 0xE7, 0x39, 0xE4, 0xE7, 0x29, 0xE5, 0xDA, 0x71, 0xAE, 0x94, 0x9D, 0x97,
+    0x0A, 0xE9, 0x5A, 0xD7, 0x0F, 0x7E, 0x7A, 0xDA, 0x70, 0xDA, 0x7D, 0xA7, 0x1D, 0x96, 0xAD, 0x71,
+    0x9D, 0x7D, 0xA7, 0x29, 0x97, 0x99, 0x77, 0x77, 0x77, 0x71, 0x9D, 0x96, 0xAD, 0x71, 0xF5, 0x9E,
+    0x97, 0x9F, 0x5A, 0xE9, 0x70, 0xE9, 0x5A, 0xE7, 0x29, 0x70, 0x99, 0x71, 0xAF, 0xFF, 0xE0, 0xFF,
+    0xFF, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE7, 0x4A, 0xD7, 0x49, 0xDA, 0x74, 0xE7, 0x4A,
+    0xD9, 0x74, 0xE7, 0x4A, 0xD7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9E, 0x74, 0xE7, 0x49,
+    0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9E, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99, 0x95, 0xAF, 0xFF,
+    0xA2, 0xAF, 0xFF, 0xD1, 0xAC, 0xA9, 0x99, 0xFF, 0xCA, 0x0A, 0xC9, 0x2F, 0xFD, 0x0A, 0xC9, 0x2F,
+    0xFD, 0xAA, 0xC9, 0x2F, 0xFE, 0xAC, 0x92, 0xFF, 0xEA, 0xC9, 0x2F, 0xFE, 0xAC, 0x92, 0xFF, 0xEA,
+    0xC9, 0x2F, 0xFE, 0xAC, 0x92, 0xFF, 0xEA, 0xC9, 0x2F, 0xFD, 0xAA, 0xC9, 0x2F, 0xFD, 0x9A, 0xC9,
+    0x2F, 0xFD, 0x0A, 0xC9, 0x2F, 0xFC, 0x1A, 0xC9, 0x2F, 0xEA, 0x2A, 0xC9, 0x2D, 0x70, 0xAC, 0x92,
+    0xD7, 0x0A, 0xC9, 0x2D, 0x70, 0xAC, 0x92, 0xD7, 0x0A, 0xC9, 0x2D, 0x70, 0xAC, 0x92, 0xD7, 0x0A,
+    0xC9, 0x2D, 0x70, 0xAC, 0x92, 0xD7, 0x0A, 0xC9, 0x2D, 0x70, 0xAC, 0x92, 0xD7, 0x0A, 0xC9, 0x2D,
+    0x70, 0xAC, 0x92, 0xD7, 0x0A, 0xC9, 0x2D, 0x77, 0x71, 0x4A, 0xAF, 0xFD, 0x92, 0xAF, 0xFF, 0xC9,
+    0x1A, 0xFF, 0xC9, 0x99, 0xD9, 0x09, 0xFF, 0xD2, 0xAC, 0x90, 0xAF, 0xFD, 0x2A, 0xC9, 0x0F, 0xFE,
+    0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE,
+    0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0A, 0xFF, 0xD2, 0xAC, 0x91, 0xFF,
+    0xD2, 0xAC, 0x91, 0xAF, 0xFC, 0xAA, 0xAD, 0x92, 0xAF, 0xFF, 0xC9, 0x49, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x0F, 0xFE, 0xA9, 0x4F, 0xFF, 0xD3, 0xD9, 0x99, 0xFF, 0xD2, 0xD2, 0xAF, 0xFC, 0xA1,
+    0xD2, 0xAF, 0xFD, 0x1D, 0x2A, 0xFF, 0xD1, 0xD2, 0xAF, 0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0x90, 0xD2,
+    0xAF, 0xFD, 0xA0, 0xD2, 0xAF, 0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0x1D, 0x2A,
+    0xFF, 0xD1, 0xD2, 0xAF, 0xFC, 0xA1, 0xDA, 0xAA, 0xFF, 0xD2, 0xFF, 0xFD, 0x3A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA4, 0x77, 0x70, 0xAD, 0x75, 0xE7, 0x5D, 0xA6, 0x9A, 0x4D, 0x96, 0xEA, 0x2D, 0x7F,
+    0xCA, 0x9C, 0xA7, 0x19, 0xAF, 0xCA, 0xFC, 0x6A, 0xFF, 0xC5, 0x9F, 0x19, 0x9A, 0xA4, 0x9D, 0x9A,
+    0xC9, 0x70, 0xAD, 0xA0, 0x9D, 0x7A, 0xE2, 0xD9, 0x6A, 0xD3, 0xE7, 0xA9, 0x3A, 0xD9, 0x74, 0x9C,
+    0x94, 0x39, 0x4E, 0x91, 0xAE, 0x91, 0xAE, 0x91, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x76, 0xE3, 0xE3,
+    0xE3, 0xE3, 0xAD, 0x3A, 0xD3, 0x9D, 0x4D, 0x49, 0x93, 0x73, 0x99, 0x99, 0x77, 0xAF, 0xDA, 0x73,
+    0xAE, 0x99, 0x99, 0xE9, 0x70, 0xAD, 0x69, 0xD7, 0xAC, 0xA7, 0x1C, 0xA5, 0x9C, 0x97, 0x2A, 0xC5,
+    0xCA, 0x74, 0xC9, 0x49, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x1C, 0x74, 0x9A, 0x49, 0xC9, 0x73, 0xCA, 0x5D, 0x72, 0xD6, 0xAC, 0xA7, 0x9D, 0x70, 0xDA,
+    0x5A, 0xD9, 0x71, 0xFF, 0xCA, 0x74, 0x9A, 0xFA, 0x72, 0x72, 0x97, 0x71, 0xE7, 0x7D, 0xA7, 0x69,
+    0xD7, 0x1A, 0x93, 0x9D, 0x71, 0xE9, 0x19, 0xCA, 0x70, 0x9F, 0xC9, 0xAC, 0x73, 0x9A, 0xFC, 0xAA,
+    0xFA, 0x70, 0xFF, 0xCA, 0x7A, 0xEA, 0x19, 0x9A, 0x96, 0xE0, 0xD7, 0x3E, 0x1D, 0x97, 0x1E, 0x91,
+    0xAD, 0x71, 0xDA, 0x29, 0xD9, 0x71, 0xA4, 0xE7, 0x7A, 0xA9, 0x77, 0x77, 0x77, 0x0A, 0xD9, 0x76,
+    0xAD, 0x77, 0xAD, 0x71, 0xA4, 0xD9, 0x70, 0xAD, 0xA2, 0xD7, 0x1A, 0xFA, 0x0D, 0x73, 0x9A, 0xFC,
+    0xAF, 0xC9, 0x79, 0xFF, 0xC9, 0x69, 0xF1, 0x99, 0xAA, 0x69, 0xD9, 0xAC, 0xA7, 0x29, 0xDA, 0x09,
+    0xD7, 0x19, 0xE2, 0xDA, 0x70, 0x9D, 0x3A, 0xD7, 0x19, 0x93, 0x9D, 0x97, 0x7C, 0xA7, 0x74, 0x9D,
+    0xA4, 0x9D, 0x0A, 0xE4, 0xDA, 0x0A, 0xE3, 0x9D, 0x91, 0xD9, 0x3A, 0xD7, 0x1D, 0x97, 0x09, 0xD7,
+    0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD,
+    0x71, 0xDA, 0x70, 0x9D, 0x71, 0xE7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0xA7, 0x09, 0xD4, 0xAA, 0x91,
+    0xE3, 0xAE, 0x1D, 0x93, 0xAE, 0x0A, 0xD4, 0x9E, 0x72, 0x91, 0x49, 0x99, 0x97, 0x71, 0x93, 0xAF,
+    0xFA, 0x97, 0x3A, 0xC9, 0x1F, 0xFF, 0xCA, 0x97, 0x9D, 0x1D, 0xA5, 0x9A, 0xFE, 0xAA, 0x99, 0x9E,
+    0x90, 0x9C, 0xA7, 0x29, 0xFF, 0xE9, 0x19, 0xC7, 0x69, 0x9A, 0xEA, 0x93, 0x70, 0x97, 0x49, 0xFE,
+    0x97, 0xFA, 0x9A, 0xAD, 0xA5, 0xDA, 0x6D, 0xA3, 0xD9, 0x70, 0xD2, 0xD7, 0x3C, 0xA0, 0x9C, 0x97,
+    0x3A, 0xC1, 0x97, 0x49, 0x10, 0x79, 0xC9, 0x76, 0xAC, 0xA7, 0x19, 0xA2, 0xAC, 0xA2, 0xC9, 0x4D,
+    0xA1, 0xAC, 0xA1, 0xE5, 0xDA, 0x0A, 0xCA, 0x0E, 0x7D, 0xAA, 0xCA, 0xE7, 0x1F, 0xE5, 0x99, 0x99,
+    0x9A, 0xFC, 0xA9, 0x99, 0x99, 0x0F, 0xFF, 0xFC, 0x0A, 0xAA, 0xAA, 0xFD, 0xAA, 0xAA, 0xAA, 0x5F,
+    0xE7, 0x1E, 0xAC, 0xAE, 0x7E, 0x0A, 0xCA, 0x0E, 0x5E, 0x1A, 0xCA, 0x1E, 0x4A, 0xC2, 0xAC, 0xA2,
+    0xCA, 0x71, 0xAC, 0xA7, 0x6A, 0xCA, 0x77, 0x70, 0x77, 0x71, 0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x72,
+    0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xCA, 0x73, 0xEA, 0x72, 0xEA, 0x72, 0xE7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x73, 0xE9, 0x71, 0x9E, 0x97, 0x2E, 0x97, 0x29, 0xA9,
+    0x00, 0x3A, 0xD9, 0x1E, 0x19, 0xD9, 0x1A, 0xD4, 0xE1, 0xAD, 0x91, 0xE1, 0x9D, 0xA3, 0xAD, 0x2E,
+    0x19, 0xD9, 0x1E, 0x4D, 0xA1, 0xAD, 0x2D, 0xA1, 0x9D, 0x93, 0xAD, 0x2D, 0xA1, 0x9D, 0x2D, 0xA4,
+    0xD9, 0x19, 0xD2, 0xD9, 0x19, 0xD4, 0xAC, 0xA2, 0xD2, 0x9D, 0x2D, 0x94, 0xD2, 0x9C, 0xA2, 0xD2,
+    0x9D, 0x49, 0xC9, 0x2A, 0xA2, 0x9C, 0x92, 0xAC, 0x50, 0x77, 0x77, 0x3E, 0x77, 0x49, 0xE9, 0x77,
+    0x39, 0xE9, 0x77, 0x49, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19,
+    0xCA, 0x77, 0x09, 0xCA, 0x1E, 0x97, 0x7E, 0xA0, 0xEA, 0x77, 0xEA, 0x0E, 0x77, 0x0E, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x97, 0x76, 0xE7, 0x74, 0x9E, 0x97, 0x74,
+    0xE7, 0x75, 0x9A, 0x97, 0x20, 0x77, 0x71, 0xE9, 0x77, 0xAD, 0xA0, 0xEA, 0x77, 0xF0, 0xE9, 0x77,
+    0xEA, 0x09, 0xAA, 0x77, 0x1A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xE7, 0x74, 0x9E, 0x97, 0x73, 0x9E, 0x97, 0x74, 0xAC, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0x99, 0x77, 0x19, 0x91, 0xE9, 0x77, 0xE9, 0x0E, 0xA7, 0x69, 0xEA, 0x0E,
+    0x97, 0x7E, 0x91, 0xA9, 0x77, 0x1A, 0x90, 0x5E, 0x1E, 0xA0, 0xEA, 0x0A, 0xD7, 0x77, 0x77, 0x77,
+    0x77, 0x71, 0x9A, 0xA1, 0xE9, 0x0E, 0xA0, 0xE9, 0x19, 0x10, 0x7A, 0xD7, 0x70, 0xEA, 0x77, 0xEA,
+    0x77, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x97, 0x59, 0x2E, 0x97, 0x19,
+    0xDA, 0x1E, 0xA7, 0x1F, 0x1E, 0x97, 0x1A, 0xE1, 0x9C, 0xA7, 0x3A, 0xC9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xAA, 0x77, 0x0E, 0xA7, 0x7E, 0xA7, 0x7E, 0x97, 0x70, 0x97, 0x10,
+    0x72, 0x99, 0x97, 0x75, 0xDA, 0x77, 0x5D, 0xA7, 0x6A, 0x94, 0xDA, 0x4A, 0x96, 0xEA, 0x3D, 0xA3,
+    0xE9, 0x5E, 0xA3, 0xDA, 0x3E, 0xA5, 0xE9, 0x3D, 0xA3, 0xE9, 0x69, 0x94, 0xDA, 0x49, 0x97, 0x6D,
+    0xA7, 0x75, 0xDA, 0x77, 0x5D, 0xA7, 0x75, 0xDA, 0x72, 0xAF, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFF,
+    0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x97, 0x3D, 0xA7, 0x75,
+    0xDA, 0x77, 0x5D, 0xA7, 0x69, 0x5D, 0xA4, 0x97, 0xE9, 0x3D, 0xA3, 0xE6, 0xEA, 0x3D, 0xA2, 0x9E,
+    0x95, 0xEA, 0x3D, 0xA2, 0x9E, 0x69, 0xCA, 0x4D, 0xA3, 0xAC, 0xA7, 0x6D, 0xA7, 0x75, 0xDA, 0x77,
+    0x5A, 0xA9, 0x72, 0x5E, 0x0A, 0xE9, 0xAE, 0x90, 0xE7, 0x77, 0x29, 0xA9, 0x09, 0xE9, 0xAE, 0xA9,
+    0xE9, 0x0A, 0xCA, 0x77, 0x72, 0xE0, 0xAE, 0x9A, 0xEA, 0x9E, 0x29, 0x10, 0x49, 0xDA, 0x0F, 0x0F,
+    0x0A, 0xE1, 0x99, 0x79, 0x91, 0xAE, 0x0F, 0x0F, 0x09, 0xDA, 0x73, 0xAA, 0x90, 0xF0, 0xF0, 0xF1,
+    0xAA, 0x97, 0x29, 0xDA, 0x0F, 0x0F, 0x0A, 0xE1, 0x99, 0x10, 0xFF, 0x99, 0x9D, 0x99, 0x92, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5D, 0x2F, 0xF2, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFF, 0xCA, 0x99, 0x99, 0xAD, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0xA3, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x59, 0x92, 0xAF, 0xDA, 0x0F, 0xD1, 0xAF, 0xA2, 0xF3, 0xAD, 0xA4, 0xD5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x72,
+    0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x29, 0xF9, 0x1F, 0xD0, 0xAF, 0xDA, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x2A, 0xA4, 0xAD, 0xA2, 0xAC,
+    0x1C, 0xA0, 0xAC, 0x3C, 0xA0, 0xD1, 0xD2, 0xF4, 0xD5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFA, 0x29, 0x99, 0xCA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xD2, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x59, 0x92, 0x49, 0xA9, 0x59, 0xFC, 0x92, 0x9D, 0xAA, 0xE2, 0xDA, 0x2D, 0x90, 0xAD,
+    0x3D, 0x90, 0xD9, 0x3D, 0xA0, 0xD4, 0xD9, 0x9D, 0x4D, 0x9A, 0xD4, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A,
+    0xCA, 0x3A, 0xCA, 0x0A, 0xD3, 0xD9, 0x09, 0xD2, 0xAD, 0x2E, 0xAE, 0x39, 0xFC, 0x69, 0x99, 0x40,
+    0x71, 0xD3, 0xCA, 0x70, 0x99, 0x3D, 0x3C, 0xA2, 0x9C, 0x92, 0xAC, 0x3D, 0x3C, 0xA2, 0x9C, 0xA2,
+    0xAC, 0x92, 0xD3, 0xD3, 0x99, 0x20, 0x77, 0x3E, 0x7A, 0xDA, 0x6A, 0xE9, 0x59, 0xCA, 0xD9, 0x49,
+    0xD0, 0xD5, 0xD0, 0x9D, 0x4D, 0x90, 0xAC, 0xA3, 0xAC, 0x91, 0xD9, 0x2A, 0xCA, 0x2D, 0x3F, 0xFD,
+    0x09, 0xFF, 0xD6, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x77, 0x75, 0xAF, 0xD9, 0x2F, 0xE9, 0x2D, 0x7A,
+    0xCA, 0x7D, 0x97, 0xDA, 0xCA, 0x93, 0x9F, 0xDA, 0x39, 0x2A, 0xD7, 0x0D, 0x97, 0xD9, 0x7D, 0x90,
+    0x94, 0xAD, 0x1D, 0xAA, 0xAE, 0x91, 0xAF, 0xD9, 0x49, 0x99, 0x50, 0x69, 0x99, 0x49, 0xFC, 0xA2,
+    0x9E, 0xAA, 0xA9, 0x19, 0xD9, 0x6D, 0x96, 0x9C, 0xA7, 0xD9, 0xAE, 0x92, 0xFF, 0x90, 0x9D, 0xA2,
+    0xDA, 0x09, 0xD3, 0x9D, 0x09, 0xD3, 0x9C, 0xA0, 0x9D, 0x3A, 0xCA, 0x09, 0xD2, 0x9D, 0x2E, 0xAA,
+    0xDA, 0x3F, 0xCA, 0x59, 0x99, 0x40, 0x75, 0xAF, 0xF2, 0xAF, 0xF7, 0x0D, 0x97, 0xAD, 0x79, 0xD7,
+    0x0D, 0xA7, 0xAD, 0x70, 0xD9, 0x7E, 0x79, 0xD7, 0x0D, 0xA7, 0xAD, 0x79, 0xD9, 0x7E, 0x77, 0x30,
+    0x59, 0x99, 0x6A, 0xFC, 0x93, 0xAD, 0xA9, 0xAD, 0x3D, 0x92, 0xD9, 0x2D, 0x3D, 0x92, 0xD9, 0x19,
+    0xD3, 0x9D, 0x9A, 0xD9, 0x4F, 0xA4, 0x9F, 0xD9, 0x29, 0xD9, 0x1A, 0xD2, 0xD9, 0x3D, 0x91, 0xD4,
+    0xD9, 0x1D, 0x92, 0x9D, 0x2A, 0xDA, 0x9A, 0xDA, 0x3A, 0xFC, 0x96, 0x99, 0x94, 0x49, 0x96, 0xAF,
+    0xC3, 0xAD, 0xAA, 0xE1, 0x9D, 0x92, 0xD1, 0xAC, 0xA3, 0xD9, 0x0D, 0x93, 0xD9, 0x0D, 0x93, 0xD9,
+    0x0D, 0xA2, 0xE1, 0x9F, 0xF2, 0x9E, 0x9A, 0xCA, 0x7D, 0x96, 0xAD, 0x6A, 0xD2, 0xAA, 0xAA, 0xE9,
+    0x2F, 0xCA, 0x59, 0x99, 0x60, 0x3A, 0xA7, 0xD7, 0xD7, 0xD3, 0x9F, 0xFA, 0x9A, 0xAA, 0xDA, 0xAA,
+    0x93, 0xD7, 0xD7, 0xD7, 0x99, 0x30, 0x71, 0x9F, 0xFA, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xF9,
+    0x9F, 0xF9, 0x77, 0x39, 0xFF, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0x49, 0xCA, 0x49, 0xD5, 0xD9,
+    0x4A, 0xCA, 0x49, 0xD5, 0xDA, 0x5D, 0x59, 0xD5, 0xAC, 0xA5, 0xD9, 0x5D, 0x95, 0xD6, 0xD6, 0xD9,
+    0x5D, 0x95, 0xAC, 0xA6, 0xD6, 0xAC, 0x40, 0x3D, 0x5A, 0xC9, 0x49, 0xD5, 0xD5, 0xD5, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x49, 0xD4, 0xAD, 0x4D, 0x93, 0x9D, 0x4A, 0xCA, 0x39, 0xD4, 0xD9, 0x3A, 0xCA,
+    0x3A, 0xCA, 0x40, 0x29, 0x29, 0xA9, 0x39, 0xC9, 0xAF, 0xA2, 0xAE, 0x90, 0x9D, 0x2E, 0x3D, 0x2D,
+    0x93, 0xD1, 0x9D, 0x39, 0xD1, 0xAC, 0x93, 0xAC, 0xA1, 0xD4, 0xAC, 0x91, 0xD4, 0xD1, 0x9D, 0x4D,
+    0x19, 0xCA, 0x39, 0xCA, 0x19, 0x94, 0x99, 0x20, 0x49, 0xA9, 0x59, 0xFC, 0x92, 0x9E, 0xAE, 0x2D,
+    0xA2, 0xD9, 0x09, 0xD3, 0xAC, 0xA0, 0xDA, 0x3A, 0xCA, 0x0D, 0x93, 0xAC, 0xA0, 0xD4, 0xDA, 0x9D,
+    0x4D, 0x99, 0xD4, 0xD0, 0x9D, 0x3A, 0xD0, 0x9D, 0x3D, 0xA1, 0xD9, 0x1A, 0xD2, 0xEA, 0xE9, 0x3F,
+    0xC9, 0x59, 0x99, 0x40, 0x72, 0xE1, 0xAE, 0xA9, 0xFC, 0x9A, 0xCA, 0x0D, 0x39, 0xD3, 0xAD, 0x3D,
+    0xA3, 0xD9, 0x29, 0xD3, 0x9D, 0x3A, 0xCA, 0x3D, 0x93, 0xD9, 0x29, 0xD7, 0x10, 0x59, 0x99, 0x6F,
+    0xD9, 0x3E, 0xAA, 0xE3, 0x99, 0x3D, 0x97, 0x0D, 0x97, 0x9D, 0x70, 0xDA, 0x7A, 0xD7, 0xAD, 0x7A,
+    0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x7F, 0xFC, 0x19, 0xFF, 0xC7, 0x50, 0x59, 0x99, 0x59, 0xFD, 0x93,
+    0xDA, 0xAA, 0xE7, 0x1D, 0x97, 0x0D, 0x97, 0x9D, 0x69, 0xAD, 0x94, 0xFA, 0x6A, 0xAE, 0x97, 0x09,
+    0xD7, 0x1D, 0x97, 0x0D, 0x91, 0x94, 0xAD, 0x2D, 0xAA, 0xAE, 0x92, 0xFE, 0x95, 0x99, 0x95, 0x77,
+    0x3A, 0xD9, 0x69, 0xE7, 0xF6, 0xDA, 0xCA, 0x5D, 0x9D, 0x94, 0xAC, 0x90, 0xD4, 0xAC, 0xA1, 0xD3,
+    0x9D, 0x19, 0xD3, 0xD2, 0xAC, 0xA2, 0xFF, 0xD9, 0x0F, 0xFD, 0x69, 0xD7, 0x0A, 0xCA, 0x70, 0xAC,
+    0xA7, 0x60, 0x75, 0xAF, 0xD9, 0x2F, 0xE2, 0x9D, 0x7A, 0xCA, 0x7D, 0x70, 0xDA, 0xCA, 0x93, 0x9F,
+    0xDA, 0x39, 0x2A, 0xD7, 0x0D, 0x97, 0xD9, 0x7D, 0x19, 0x4A, 0xD1, 0xDA, 0xAA, 0xE2, 0xAF, 0xD5,
+    0x99, 0x95, 0x69, 0x99, 0x5A, 0xFC, 0x29, 0xEA, 0xAA, 0x92, 0xD9, 0x6D, 0xA6, 0x9D, 0x7A, 0xCA,
+    0x9E, 0x92, 0xFF, 0x91, 0xE2, 0xAD, 0x1D, 0x92, 0x9D, 0x09, 0xD3, 0x9D, 0x09, 0xD3, 0xAC, 0xA1,
+    0xD9, 0x2D, 0x91, 0xAD, 0xAA, 0xDA, 0x3F, 0xCA, 0x69, 0x94, 0x75, 0xAF, 0xF9, 0x1A, 0xFF, 0x70,
+    0xDA, 0x7A, 0xD7, 0x0D, 0x97, 0xDA, 0x79, 0xD7, 0x0D, 0xA7, 0xAD, 0x79, 0xD9, 0x7D, 0xA7, 0x9D,
+    0x70, 0xDA, 0x7A, 0xD7, 0x73, 0x49, 0x99, 0x59, 0xFC, 0xA2, 0x9D, 0xA9, 0xAD, 0x91, 0xDA, 0x2A,
+    0xCA, 0x1D, 0x92, 0xAC, 0xA1, 0xAC, 0xA2, 0xD9, 0x2D, 0xAA, 0xD9, 0x3A, 0xF4, 0xEA, 0xDA, 0x2D,
+    0xA1, 0x9D, 0x90, 0xAC, 0xA3, 0xDA, 0x0D, 0x93, 0xAC, 0xA0, 0xAC, 0xA3, 0xD9, 0x09, 0xE9, 0xAE,
+    0x29, 0xFC, 0xA5, 0x99, 0x94, 0x49, 0x96, 0x9F, 0xC3, 0xAD, 0xAA, 0xE2, 0xD9, 0x2D, 0x90, 0xAD,
+    0x3A, 0xC9, 0x0A, 0xCA, 0x3A, 0xC9, 0x0D, 0xA3, 0xD9, 0x0A, 0xD2, 0xAD, 0x91, 0xFF, 0x29, 0xEA,
+    0x9D, 0x7D, 0x96, 0x9D, 0x69, 0xD9, 0x1A, 0xAA, 0xAE, 0x92, 0xAF, 0xA5, 0x99, 0x96, 0x39, 0xA7,
+    0xAC, 0x7A, 0xC7, 0xAC, 0x4F, 0xFA, 0x0A, 0xAA, 0xDA, 0xAA, 0xA3, 0xAC, 0x7A, 0xC7, 0xAC, 0x70,
+    0x93, 0x72, 0xFF, 0xC0, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x0F, 0xFA, 0x0F, 0xFA, 0x77, 0x4F, 0xFA,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x4D, 0x4D, 0x93, 0xDA, 0x3A, 0xD4, 0xD9, 0x3A, 0xD4, 0xD9, 0x39,
+    0xD4, 0xAD, 0x4A, 0xCA, 0x4D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4A, 0xCA, 0x49, 0xD5, 0xD5, 0xAC,
+    0x93, 0x3A, 0xC5, 0x9C, 0xA5, 0xD5, 0xD5, 0xD9, 0x4D, 0x94, 0xAC, 0x94, 0xD9, 0x4D, 0x94, 0xD4,
+    0x9D, 0x4A, 0xCA, 0x4D, 0x93, 0xAD, 0x4D, 0x4D, 0xA3, 0xAD, 0x39, 0xD4, 0x39, 0xAA, 0x91, 0xA3,
+    0xFC, 0xAA, 0xC2, 0xD9, 0x2D, 0xA1, 0xAC, 0x93, 0xD9, 0x1D, 0x4D, 0x90, 0x9C, 0xA4, 0xD1, 0xAC,
+    0x94, 0xD1, 0xAC, 0x93, 0xAC, 0xA1, 0xAC, 0x92, 0x9D, 0x91, 0x9D, 0x1A, 0xE3, 0xAF, 0x0A, 0xC4,
+    0x99, 0x96, 0x39, 0xAA, 0xA4, 0xFD, 0x2D, 0x2A, 0xC9, 0x0A, 0xC9, 0x2A, 0xC9, 0x0D, 0x2A, 0xD0,
+    0x9F, 0xDA, 0x1A, 0xCA, 0xA9, 0x93, 0xAC, 0x96, 0xAC, 0x97, 0xD9, 0x19, 0xA2, 0x9F, 0xD4, 0x99,
+    0x93, 0x39, 0xAA, 0xA4, 0x9F, 0xD9, 0x2D, 0x92, 0xD1, 0xD9, 0x3A, 0xC9, 0x0D, 0x4A, 0xC9, 0xAC,
+    0x94, 0xAC, 0x9A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x3A, 0xC9, 0x1D, 0x91, 0xAC, 0xA2,
+    0x9F, 0xCA, 0x59, 0x99, 0x40, 0x29, 0xA4, 0xAA, 0x3A, 0xC9, 0x2D, 0x94, 0xD1, 0xAC, 0x95, 0xAC,
+    0x99, 0xCA, 0x7E, 0xA7, 0x0A, 0xD7, 0x09, 0xE7, 0x0D, 0xAC, 0x96, 0xD1, 0xD5, 0xD2, 0xAC, 0x93,
+    0xD9, 0x3D, 0x77, 0x29, 0xAA, 0xA9, 0x3F, 0xE2, 0x93, 0xAC, 0xA7, 0xD7, 0xD2, 0x9A, 0xAF, 0x1E,
+    0xAA, 0xAC, 0xA0, 0xD9, 0x2A, 0xC9, 0x0C, 0xA2, 0x9D, 0x1D, 0x19, 0xD2, 0xAF, 0xC5, 0x99, 0x40,
+    0x29, 0xC9, 0x7A, 0xC7, 0x0D, 0x70, 0xD7, 0x9C, 0xA0, 0x9A, 0xA9, 0x2A, 0xC9, 0xFC, 0xA1, 0xEA,
+    0x2D, 0x1D, 0xA3, 0xD0, 0x9D, 0x4C, 0xA0, 0x9C, 0x93, 0x9C, 0xA0, 0xAC, 0x4A, 0xC9, 0x0D, 0x4D,
+    0x1C, 0xA4, 0xD0, 0x9C, 0x93, 0x9C, 0xA0, 0xAC, 0x93, 0xAC, 0x97, 0x30, 0x29, 0xC9, 0x7A, 0xC7,
+    0x0D, 0x70, 0xD7, 0x9C, 0xA2, 0x9A, 0x91, 0xAC, 0x91, 0x9D, 0x2D, 0x19, 0xCA, 0x3D, 0x09, 0xCA,
+    0x39, 0xCA, 0xAC, 0xA4, 0x9F, 0x5A, 0xDA, 0xCA, 0x4D, 0x1D, 0x4C, 0xA1, 0x9C, 0xA2, 0x9C, 0x92,
+    0xD2, 0xAC, 0x92, 0x9C, 0xA7, 0x40, 0x29, 0xCA, 0x2A, 0xC9, 0x2D, 0x3D, 0x29, 0xCA, 0x2A, 0xC9,
+    0x2D, 0x3D, 0x3C, 0xA2, 0x9C, 0x92, 0xAC, 0x3D, 0x3D, 0x29, 0xCA, 0x2A, 0xC9, 0x70, 0x2A, 0x19,
+    0xAA, 0x3A, 0xAA, 0x3A, 0xC9, 0xFC, 0x09, 0xFC, 0x2E, 0x91, 0x9C, 0xAC, 0x91, 0xAC, 0x91, 0xD9,
+    0x29, 0xD3, 0xAC, 0x91, 0xD3, 0x9C, 0xA3, 0xAC, 0x19, 0xCA, 0x3A, 0xC4, 0xD1, 0xAC, 0x4D, 0x4C,
+    0xA1, 0xD4, 0xCA, 0x39, 0xC9, 0x1D, 0x39, 0xCA, 0x3A, 0xC1, 0x9C, 0xA3, 0xAC, 0x93, 0xD1, 0xAC,
+    0x93, 0xD4, 0xD7, 0x73, 0x29, 0xA1, 0xAC, 0xA9, 0x3D, 0x9F, 0xC9, 0x2E, 0x91, 0xAC, 0xA1, 0x9D,
+    0x92, 0x9C, 0xA1, 0xAC, 0xA3, 0xAC, 0x91, 0xD4, 0xD9, 0x1D, 0x4D, 0x19, 0xCA, 0x39, 0xD1, 0xAC,
+    0x93, 0xAC, 0xA1, 0xD4, 0xD9, 0x1D, 0x4D, 0x75, 0x39, 0x91, 0xAA, 0xA5, 0xD9, 0xFC, 0x4E, 0x91,
+    0xAC, 0xA2, 0x9D, 0x4C, 0xA2, 0xAC, 0xA4, 0xCA, 0x2D, 0x49, 0xCA, 0x2D, 0x4A, 0xC9, 0x19, 0xD4,
+    0xD2, 0x9D, 0x3A, 0xCA, 0x2A, 0xDA, 0x1A, 0xD3, 0xD0, 0xFC, 0x4C, 0xA1, 0x99, 0x59, 0xC9, 0x71,
+    0xAC, 0x72, 0xD7, 0x2D, 0x71, 0x29, 0xAA, 0xA9, 0x2F, 0xE0, 0x9C, 0xA5, 0x9C, 0x96, 0xD9, 0x59,
+    0xE6, 0xAD, 0x95, 0x9D, 0x6D, 0x0A, 0x92, 0xAC, 0xA0, 0xFD, 0xA3, 0x99, 0x93, 0x2A, 0xA5, 0xC9,
+    0x39, 0xDA, 0xAA, 0x0A, 0xFD, 0x2D, 0x49, 0xCA, 0x4A, 0xC9, 0x4D, 0x5D, 0x49, 0xCA, 0x49, 0xC9,
+    0x49, 0xCA, 0x5F, 0x49, 0x93, 0x77, 0x59, 0xFC, 0xA9, 0x7F, 0xFA, 0x6F, 0x91, 0x9A, 0x95, 0xAD,
+    0xA7, 0x4E, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0x9D, 0xA3, 0x9A, 0xAA, 0xAA, 0xAA, 0x99, 0xDA, 0x3F,
+    0xFA, 0xAD, 0x93, 0xEA, 0xAA, 0xAA, 0x9A, 0xD9, 0x29, 0xD9, 0x5A, 0xD9, 0x2A, 0xD6, 0x9D, 0xA2,
+    0xE7, 0xE9, 0x1E, 0x7A, 0xFF, 0xAA, 0xAA, 0xA3, 0x9F, 0xFF, 0x59, 0x9E, 0xA9, 0x99, 0x99, 0x7E,
+    0x75, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x97, 0x4A, 0xD9, 0x74, 0xFF, 0xA7, 0xFF, 0x92, 0x73, 0x99,
+    0x29, 0x73, 0xAC, 0xA1, 0xD7, 0x3D, 0x19, 0xD7, 0x29, 0xDA, 0xAD, 0x97, 0x0A, 0xFF, 0xC9, 0x59,
+    0xFF, 0xE9, 0x4A, 0xFC, 0xA1, 0xDA, 0xC4, 0xAE, 0x9D, 0x19, 0xD5, 0x9E, 0x09, 0xD1, 0xAC, 0x95,
+    0xE1, 0xAC, 0x91, 0xD5, 0xAD, 0xA1, 0xD1, 0x9C, 0xA5, 0xE1, 0xAC, 0xA1, 0xD9, 0x49, 0xDA, 0x1D,
+    0x19, 0xD5, 0xAD, 0x90, 0x9D, 0x1A, 0xC9, 0x5E, 0x1A, 0xC9, 0x1D, 0x6E, 0x1D, 0x19, 0xCA, 0x6E,
+    0x0A, 0xCA, 0x1D, 0x7E, 0x0D, 0x19, 0xD7, 0xE9, 0xD1, 0xAC, 0x97, 0xFC, 0x91, 0xD7, 0x09, 0xF1,
+    0x9C, 0xA7, 0x1F, 0x1D, 0x72, 0x9F, 0xAD, 0xAA, 0xD9, 0x59, 0xFF, 0xE9, 0x5A, 0xC9, 0x9F, 0xDA,
+    0x96, 0xD1, 0xAC, 0xA7, 0x2A, 0xCA, 0x1D, 0x73, 0xD1, 0x9D, 0x72, 0x77, 0x71, 0xAF, 0xDA, 0x7A,
+    0xFF, 0xD5, 0xFC, 0xAA, 0xAA, 0xE4, 0xF9, 0x59, 0x4F, 0x74, 0x9E, 0x75, 0xE9, 0x74, 0x9D, 0xA7,
+    0x5E, 0x97, 0x5E, 0x3A, 0xA1, 0x9A, 0xC9, 0x19, 0xDA, 0x3D, 0x0F, 0xA1, 0xAD, 0x92, 0x9F, 0xCA,
+    0xC2, 0xE3, 0xAE, 0xA5, 0xE3, 0xEA, 0x6E, 0x3E, 0x7E, 0x29, 0xDA, 0x7E, 0x29, 0xD9, 0x7E, 0x91,
+    0xAD, 0x70, 0xAD, 0xA1, 0xE7, 0x09, 0xE1, 0xDA, 0x71, 0xF9, 0xD9, 0x71, 0x9F, 0xDA, 0x9A, 0xD6,
+    0x9F, 0xFD, 0x70, 0xAF, 0xEA, 0x72, 0x99, 0x97, 0x00, 0x69, 0xFF, 0xE9, 0x6A, 0xFF, 0xE7, 0xFF,
+    0xF7, 0xE7, 0x79, 0xDA, 0x77, 0xAD, 0x97, 0x7A, 0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0x97,
+    0x7A, 0xD9, 0x77, 0xEA, 0xAA, 0xAA, 0xAA, 0xA9, 0x7F, 0xFE, 0x70, 0xFF, 0xE7, 0x9D, 0x97, 0x7A,
+    0xD7, 0x70, 0xE7, 0x59, 0x99, 0xE9, 0x99, 0x97, 0x1F, 0xFD, 0x71, 0xAA, 0xFA, 0xAA, 0xA7, 0x3A,
+    0xD7, 0x70, 0xE7, 0x70, 0xDA, 0x77, 0x9D, 0xA7, 0x50, 0x77, 0x77, 0xAF, 0xD9, 0x73, 0xFF, 0xD7,
+    0x1F, 0x99, 0x9A, 0xDA, 0x70, 0xAD, 0xA5, 0x97, 0x1E, 0x77, 0x09, 0xDA, 0x77, 0x0A, 0xD9, 0x77,
+    0x0A, 0xD7, 0x71, 0xE7, 0x69, 0x9A, 0xE9, 0x99, 0x99, 0x97, 0xAF, 0xFE, 0x97, 0xAF, 0xFE, 0x73,
+    0xE7, 0x71, 0xE7, 0x6A, 0xAA, 0xEA, 0xAA, 0xAA, 0x97, 0xAF, 0xFE, 0x97, 0x9A, 0xAE, 0xAA, 0xAA,
+    0xAA, 0x73, 0xE7, 0x70, 0x9D, 0xA7, 0x70, 0xE7, 0x70, 0xAD, 0x97, 0x6A, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x4F, 0xFF, 0xEA, 0x39, 0xFF, 0xFE, 0x93, 0x77, 0x77, 0x77, 0xAC, 0xA7, 0x77, 0x9D,
+    0x77, 0x70, 0xD9, 0x77, 0x7A, 0xD7, 0x29, 0xD2, 0xAF, 0x2F, 0xEA, 0x5A, 0xD0, 0x9F, 0xE0, 0xFF,
+    0xCA, 0x4E, 0x9D, 0xA9, 0x9F, 0xEA, 0x99, 0xAE, 0x4F, 0xC4, 0xFC, 0x93, 0xE9, 0x3F, 0x5F, 0x94,
+    0xAD, 0x92, 0x9E, 0x95, 0xEA, 0x5A, 0xD3, 0xAE, 0x59, 0xE6, 0xE3, 0xE9, 0x5A, 0xDA, 0x6E, 0x3E,
+    0x59, 0xE9, 0x59, 0xDA, 0x29, 0xDA, 0x5F, 0x6A, 0xD9, 0x29, 0xD9, 0x4A, 0xF6, 0xAD, 0x3A, 0xD5,
+    0xFA, 0x6E, 0x3E, 0x4F, 0xC9, 0x6E, 0x3E, 0x3A, 0xFC, 0x69, 0xDA, 0x29, 0xDA, 0x3D, 0x0E, 0x6A,
+    0xD9, 0x2A, 0xD9, 0x2D, 0xA0, 0xE6, 0xE3, 0xAD, 0x29, 0xD0, 0x9D, 0xA6, 0xE3, 0xE2, 0xD9, 0x0A,
+    0xD9, 0x6D, 0xA7, 0x0A, 0xCA, 0x77, 0x79, 0xD7, 0x77, 0x0D, 0x97, 0x77, 0x9A, 0xA7, 0x74, 0x5E,
+    0x95, 0xD9, 0x6E, 0xA5, 0xD9, 0x59, 0xF4, 0x9D, 0x6A, 0xF4, 0xAD, 0x6F, 0xC4, 0xE6, 0xDA, 0xD4,
+    0xDA, 0x6D, 0x9D, 0x92, 0x9D, 0x95, 0x9D, 0x0D, 0xA2, 0x9D, 0x4A, 0xAE, 0xAE, 0xAA, 0xAE, 0xAA,
+    0x2F, 0xFF, 0xFC, 0x2A, 0xAE, 0xAE, 0xAA, 0xAE, 0xAA, 0x39, 0xD9, 0x09, 0xD1, 0x9D, 0x95, 0x9D,
+    0x19, 0xD1, 0xAD, 0x4A, 0xAE, 0xAA, 0xFA, 0xEA, 0xA1, 0x9F, 0xFF, 0xFC, 0x29, 0xAD, 0xA9, 0x99,
+    0xEA, 0xDA, 0x99, 0x39, 0xD9, 0x2A, 0xCA, 0x9D, 0x6A, 0xD3, 0xAD, 0xAD, 0x6A, 0xD3, 0x9D, 0xAD,
+    0x6D, 0xA3, 0x9F, 0xA6, 0xD9, 0x4F, 0x95, 0x9D, 0x5F, 0x6A, 0xD5, 0xF6, 0xE5, 0xEA, 0x50, 0x5F,
+    0xCA, 0x97, 0x79, 0xFF, 0x97, 0x5A, 0xFF, 0xC9, 0x74, 0xAD, 0x3F, 0x74, 0xE4, 0xE9, 0x73, 0xDA,
+    0x4A, 0xD9, 0x72, 0x9D, 0xA4, 0xAD, 0x97, 0x2A, 0xD9, 0x4A, 0xD9, 0x1A, 0xC9, 0x5E, 0x5E, 0x19,
+    0xD6, 0xE4, 0x9E, 0x1E, 0x6D, 0xA4, 0xEA, 0x9F, 0xDA, 0x29, 0xD9, 0x29, 0xFF, 0xFA, 0x2A, 0xFF,
+    0xD0, 0x99, 0xEA, 0x99, 0x92, 0xFF, 0xC9, 0x3E, 0x6E, 0xAA, 0xA9, 0x6E, 0x59, 0xDA, 0x72, 0xDA,
+    0x5A, 0xD9, 0x71, 0x9D, 0x95, 0xAD, 0x72, 0xAD, 0x6E, 0x72, 0xE6, 0xDA, 0x72, 0xDA, 0x59, 0xDA,
+    0x72, 0xDA, 0x5A, 0xD9, 0x72, 0xE1, 0x92, 0xE7, 0x3F, 0xD2, 0xE7, 0x39, 0xFC, 0x77, 0x39, 0x93,
+    0x5F, 0xCA, 0xA7, 0x72, 0x9F, 0xFA, 0x77, 0x0A, 0xFF, 0xC9, 0x77, 0xE3, 0xAE, 0x77, 0xE4, 0xE7,
+    0x7D, 0xA4, 0xE9, 0x75, 0x9D, 0x94, 0xAD, 0x91, 0xAF, 0xCA, 0x4A, 0xD9, 0x4E, 0x1F, 0xF9, 0x3E,
+    0x5E, 0x0A, 0xE9, 0x99, 0xAC, 0x4E, 0x4A, 0xDA, 0x0E, 0x71, 0x9D, 0xA3, 0x9E, 0x1E, 0x71, 0x9D,
+    0xA9, 0x99, 0xF9, 0x1E, 0x71, 0xAF, 0xFC, 0x92, 0xE9, 0x70, 0xFF, 0xA4, 0x9E, 0x97, 0xE1, 0x9D,
+    0xA5, 0xAE, 0xA5, 0x9D, 0xA2, 0xE6, 0xAE, 0xA4, 0xAD, 0x92, 0xE7, 0x9E, 0x93, 0xE3, 0xAD, 0x97,
+    0x9E, 0x3E, 0x39, 0xD9, 0x70, 0xE3, 0xDA, 0x39, 0xDA, 0x70, 0xE2, 0x9D, 0xA4, 0xE7, 0x9E, 0x2A,
+    0xD9, 0x4E, 0x0A, 0xC9, 0x29, 0xE9, 0x2E, 0x5E, 0x9A, 0xFF, 0xA3, 0xE5, 0xAD, 0x90, 0xAF, 0xD9,
+    0x77, 0x59, 0x96, 0x29, 0xD5, 0xE5, 0xD9, 0x29, 0xD4, 0x9E, 0x4A, 0xD3, 0xAD, 0x4A, 0xE4, 0xDA,
+    0x3A, 0xD4, 0xF3, 0x9D, 0x93, 0xAD, 0x39, 0xCA, 0xD3, 0xAD, 0x4A, 0xD3, 0xD9, 0xD3, 0xDA, 0x4A,
+    0xD2, 0x9D, 0x9C, 0xA2, 0x9D, 0x5E, 0x2A, 0xCA, 0x9C, 0xA2, 0xAD, 0x5D, 0xA2, 0xD0, 0x9C, 0xA2,
+    0xD9, 0x5D, 0xA1, 0x9D, 0x0A, 0xCA, 0x19, 0xD6, 0xDA, 0x1D, 0xA0, 0xAC, 0xA1, 0xE4, 0xFF, 0xFF,
+    0xF9, 0x2F, 0xFF, 0xFF, 0x5D, 0x90, 0xD9, 0x1D, 0x90, 0xDA, 0x7D, 0x99, 0xD2, 0xD9, 0x0D, 0x97,
+    0xD0, 0xAC, 0xA2, 0xD9, 0x9D, 0x70, 0xD0, 0xD9, 0x2D, 0x0A, 0xCA, 0x79, 0xD9, 0xD3, 0xD0, 0xD7,
+    0x09, 0xDA, 0xCA, 0x3D, 0x9D, 0x70, 0x9F, 0x4D, 0xAC, 0x97, 0x09, 0xF4, 0xF7, 0x19, 0xE9, 0x4E,
+    0xA7, 0x1A, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xE7, 0x00, 0x5F, 0xFA, 0x97, 0xAD, 0x59, 0xFF, 0xE9,
+    0x5E, 0x59, 0xDA, 0xAA, 0xAA, 0xAA, 0xE9, 0x4D, 0xA5, 0xAD, 0x69, 0xE3, 0x9D, 0x95, 0xE7, 0xAD,
+    0x3A, 0xD6, 0xDA, 0x79, 0xD9, 0x2A, 0xD5, 0x9D, 0x92, 0xAA, 0x91, 0x9D, 0x92, 0xE5, 0xAD, 0x29,
+    0xD2, 0x9D, 0x3D, 0xA5, 0xE2, 0xAD, 0x2A, 0xD2, 0x9D, 0x95, 0xDA, 0x2E, 0x2E, 0x2A, 0xD6, 0xDA,
+    0x2D, 0xA2, 0xDA, 0x2E, 0x59, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x2D, 0xA5, 0xAD, 0x2A, 0xD2, 0x9D,
+    0x3D, 0x95, 0xE2, 0xE2, 0xAD, 0x29, 0xD9, 0x5D, 0xA2, 0xDA, 0x2E, 0x2A, 0xD5, 0x9D, 0x92, 0xDA,
+    0x2D, 0xA2, 0xE5, 0x9D, 0x29, 0xD9, 0x19, 0xD9, 0x2D, 0xA5, 0xAD, 0x2A, 0xD2, 0xAD, 0x29, 0xD9,
+    0x5E, 0x2E, 0x70, 0xAD, 0x6D, 0xA2, 0xDA, 0x79, 0xDA, 0x59, 0xD9, 0x19, 0xD9, 0x69, 0xE6, 0xAD,
+    0x29, 0xD9, 0x99, 0x99, 0x99, 0xF9, 0x6A, 0xD2, 0xAF, 0xFF, 0x97, 0xDA, 0x2F, 0xFD, 0xA9, 0x70,
+    0x77, 0x09, 0x99, 0x77, 0x2D, 0xA7, 0x71, 0x9D, 0xA7, 0x49, 0x99, 0x99, 0xAD, 0xA9, 0x72, 0xFF,
+    0xEA, 0x71, 0xFF, 0xE9, 0x76, 0x9D, 0xA7, 0x71, 0x9D, 0x97, 0x1A, 0xFA, 0x1A, 0xD7, 0x09, 0xFF,
+    0x0E, 0x79, 0xF9, 0x99, 0xAC, 0xAE, 0x7E, 0xA4, 0xAE, 0xA6, 0xAE, 0x59, 0xE9, 0x6E, 0x7E, 0x69,
+    0xDA, 0x7E, 0x6E, 0x97, 0xE6, 0xE7, 0x9D, 0xA6, 0xE7, 0xAD, 0x95, 0x9D, 0xA7, 0xE6, 0x9D, 0xA6,
+    0x9E, 0x69, 0xDA, 0x6E, 0xA6, 0x9D, 0xA5, 0xAE, 0x97, 0xE4, 0xAF, 0x97, 0xF1, 0x9D, 0xAA, 0xD7,
+    0x09, 0xFE, 0xA0, 0xAD, 0x71, 0x9F, 0xC9, 0x1D, 0xA7, 0x49, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xFF,
+    0xC7, 0xAF, 0xFF, 0xA7, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x77, 0x75, 0x9A, 0xFC,
+    0x97, 0x2A, 0xFF, 0xC7, 0x0F, 0xAA, 0xAA, 0xDA, 0x7E, 0xA5, 0xA7, 0xEA, 0x76, 0x9E, 0x77, 0xE7,
+    0x79, 0xDA, 0x77, 0xE9, 0x74, 0xAF, 0xFE, 0xA6, 0xFF, 0xFA, 0x70, 0xAD, 0x97, 0x7E, 0x76, 0x99,
+    0xE9, 0x99, 0x99, 0x97, 0xAF, 0xFD, 0xA7, 0xFF, 0xE9, 0x71, 0x9D, 0xA7, 0x70, 0xE7, 0x70, 0xE7,
+    0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0F, 0xA9, 0x99, 0xAC, 0xA7, 0x1F, 0xFC, 0xA7, 0x2A, 0xFE, 0x97,
+    0x59, 0x97, 0x00, 0x4A, 0xD7, 0x0E, 0x5E, 0x7E, 0x95, 0xE6, 0xE9, 0x59, 0xDA, 0x5E, 0x96, 0xAD,
+    0x94, 0xE9, 0x7A, 0xD4, 0xE9, 0x70, 0xE3, 0xE9, 0x71, 0xE2, 0xE9, 0x71, 0x9D, 0xA1, 0xEA, 0x72,
+    0xAD, 0x90, 0xEA, 0x71, 0x99, 0xE9, 0xF9, 0x99, 0x99, 0x4A, 0xFF, 0xFE, 0x93, 0xFF, 0xFF, 0x69,
+    0xEA, 0x09, 0xDA, 0x72, 0xAD, 0x92, 0xE7, 0x2E, 0x3A, 0xD9, 0x71, 0xE3, 0x9E, 0x70, 0x9D, 0xA4,
+    0xE9, 0x79, 0xD9, 0x49, 0xDA, 0x7A, 0xD9, 0x5E, 0x7E, 0x6A, 0xDA, 0x6E, 0x69, 0xE5, 0x9D, 0xA7,
+    0xE9, 0x4A, 0xD9, 0x79, 0xE4, 0x19, 0xFF, 0xFE, 0x91, 0xAF, 0xFF, 0xE9, 0x1F, 0xFF, 0xF7, 0x0A,
+    0xD9, 0x76, 0xE7, 0x7E, 0x77, 0xE1, 0xD7, 0x29, 0xDA, 0xAE, 0x72, 0xAF, 0xCA, 0x73, 0xFA, 0x74,
+    0x9E, 0x97, 0x4F, 0xA7, 0x3A, 0xFC, 0x90, 0x9C, 0xA6, 0xE9, 0xAD, 0x9E, 0xA6, 0xCA, 0x1F, 0xD9,
+    0x73, 0xFA, 0x74, 0xAE, 0x74, 0x9F, 0x97, 0x3F, 0xD7, 0x29, 0xE9, 0xE7, 0x3C, 0x91, 0xE7, 0x69,
+    0xDA, 0x76, 0xAD, 0x97, 0x6E, 0x73, 0x77, 0x77, 0x19, 0xAF, 0xEA, 0x97, 0x73, 0xFF, 0xFC, 0x77,
+    0x2A, 0xDA, 0xA9, 0x99, 0xAF, 0xC9, 0x77, 0x19, 0x70, 0xAE, 0x97, 0x74, 0x99, 0x4A, 0xE7, 0x73,
+    0xAD, 0x94, 0xAD, 0xA7, 0x72, 0xE6, 0xE7, 0x72, 0xE6, 0xE9, 0x77, 0x1D, 0xA6, 0xAD, 0x97, 0x70,
+    0x9D, 0x96, 0x9D, 0xA7, 0x70, 0xAD, 0x96, 0x9D, 0xA7, 0x70, 0xE7, 0x9D, 0xA7, 0x70, 0xE7, 0xAD,
+    0x97, 0x70, 0xDA, 0x7E, 0x93, 0xAF, 0xA5, 0x9D, 0x97, 0xE2, 0x9F, 0xF4, 0xAD, 0x79, 0xDA, 0x2E,
+    0xA9, 0x9E, 0xA3, 0xE7, 0xE9, 0x1A, 0xD9, 0x3E, 0x3E, 0x6A, 0xE2, 0xE4, 0xE2, 0x9D, 0xA5, 0x9E,
+    0x91, 0x9D, 0xA4, 0xE2, 0xAD, 0x94, 0x9E, 0xA2, 0xAD, 0x94, 0xE2, 0xAD, 0x39, 0xFA, 0x3E, 0x4A,
+    0xDA, 0x2E, 0xAA, 0xAF, 0xC9, 0x4E, 0xA2, 0xAE, 0x3F, 0xFC, 0xA6, 0xFF, 0xD9, 0x29, 0xFD, 0xA9,
+    0x79, 0xDA, 0xFC, 0xA7, 0x75, 0xAD, 0x29, 0x97, 0x77, 0xE7, 0x77, 0x4E, 0x77, 0x74, 0xDA, 0x77,
+    0x73, 0x9D, 0x97, 0x77, 0x3A, 0xD7, 0x77, 0x4E, 0x77, 0x74, 0xDA, 0x73, 0x77, 0x77, 0x2F, 0xA7,
+    0x6F, 0xDA, 0x74, 0xE9, 0x0A, 0xD7, 0x39, 0xD9, 0x19, 0xD9, 0x72, 0xAD, 0x3D, 0x97, 0x2E, 0x29,
+    0xD7, 0x3D, 0xA2, 0xAD, 0x73, 0xDA, 0x2D, 0xA7, 0x3D, 0xA1, 0xAD, 0x74, 0xDA, 0x1D, 0xA7, 0x4D,
+    0xA0, 0xAD, 0x75, 0xAD, 0x9D, 0x97, 0x5A, 0xFA, 0x76, 0x9F, 0x77, 0x0E, 0x77, 0x09, 0xDA, 0x73,
+    0xC3, 0xF7, 0x2D, 0x91, 0xFC, 0x71, 0x9E, 0x0A, 0xD9, 0xD7, 0x1F, 0x9D, 0x90, 0xD9, 0x7D, 0xAA,
+    0xEA, 0x1D, 0xA6, 0xAD, 0x09, 0xE2, 0xDA, 0x59, 0xD9, 0x1D, 0x3E, 0x5D, 0xA2, 0xA9, 0x3A, 0xD7,
+    0x71, 0xAD, 0x77, 0x1A, 0xD7, 0x71, 0xE7, 0x71, 0xDA, 0x77, 0x0A, 0xD9, 0x74, 0xA9, 0x9A, 0xE7,
+    0x5F, 0xD9, 0x75, 0xAE, 0xA7, 0x4A, 0xFC, 0xAA, 0x97, 0x2F, 0xFD, 0x70, 0x9E, 0xAA, 0xAF, 0xA7,
+    0x9D, 0x93, 0x9E, 0x7A, 0xD9, 0x49, 0xDA, 0x3A, 0xFF, 0xFF, 0xC1, 0xAA, 0xFA, 0xAA, 0xAA, 0xAF,
+    0xAA, 0x39, 0xDA, 0x59, 0xDA, 0x5A, 0xD9, 0x5A, 0xD9, 0x39, 0x9E, 0x99, 0x99, 0x99, 0x9E, 0x99,
+    0x1A, 0xFF, 0xFF, 0xC1, 0x9A, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA, 0xA9, 0x39, 0xDA, 0x4A, 0xE6, 0xAD,
+    0x90, 0x99, 0xAF, 0x7F, 0xFE, 0x70, 0xFF, 0xA9, 0x71, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD9, 0x77,
+    0xE7, 0x70, 0xE7, 0x79, 0xDA, 0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x70, 0x74, 0x97, 0x72, 0xAC, 0xA7,
+    0x6A, 0xFE, 0xA9, 0x70, 0xAF, 0xFF, 0x59, 0xFF, 0xAA, 0xEA, 0x49, 0xF9, 0x09, 0xCA, 0x29, 0xA5,
+    0xF2, 0xAC, 0x97, 0x1F, 0x3D, 0x71, 0x9E, 0x4D, 0x71, 0xE9, 0x39, 0xD7, 0x09, 0xE4, 0xAC, 0xA7,
+    0x0A, 0xDA, 0x4D, 0x97, 0x0E, 0x5D, 0x71, 0xE5, 0xDA, 0xAA, 0xAA, 0xA9, 0x19, 0xE4, 0x9F, 0xFA,
+    0x1A, 0xDA, 0x4A, 0xFF, 0x91, 0xAD, 0xA4, 0xD9, 0x2E, 0x2A, 0xDA, 0x4D, 0x3E, 0x2A, 0xDA, 0x39,
+    0xD3, 0xE2, 0x9E, 0x39, 0xCA, 0x29, 0xDA, 0x3E, 0x3A, 0xC9, 0x2A, 0xD9, 0x3F, 0x2D, 0x92, 0xE4,
+    0x9E, 0xA1, 0xD3, 0xE5, 0xAF, 0xAD, 0x99, 0xAE, 0xA6, 0xAF, 0xFF, 0x97, 0x0A, 0xFF, 0xA9, 0x73,
+    0xD9, 0x97, 0x70, 0xD7, 0x72, 0xAA, 0x73, 0x74, 0xE7, 0x71, 0xAE, 0x97, 0x70, 0xF9, 0x77, 0xFC,
+    0xA7, 0x69, 0xDA, 0xDA, 0x76, 0xE0, 0xE7, 0x59, 0xDA, 0x0E, 0x75, 0xE1, 0xAD, 0x74, 0x9D, 0xA1,
+    0xAD, 0x79, 0xFF, 0xFF, 0xCA, 0x2A, 0xFF, 0xFF, 0xCA, 0x59, 0xE9, 0x29, 0xDA, 0x71, 0xAD, 0x94,
+    0xDA, 0x71, 0xE5, 0xE5, 0xAF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0xA4, 0xE9, 0x6A, 0xD9, 0x59, 0xE7,
+    0xAD, 0x95, 0xE9, 0x79, 0xD9, 0x49, 0xE7, 0x09, 0xDA, 0x4E, 0x72, 0xDA, 0x3A, 0xDA, 0x72, 0xE3,
+    0xE7, 0x3E, 0x2A, 0xDA, 0x73, 0xE2, 0x77, 0x72, 0x9A, 0xFD, 0x97, 0x1F, 0xFD, 0xA7, 0x09, 0xEA,
+    0xAA, 0xFA, 0x70, 0xA5, 0x9E, 0x77, 0x0E, 0x97, 0x7A, 0xD9, 0x77, 0xAD, 0x97, 0x7E, 0x39, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xA2, 0xFF, 0xFF, 0xC2, 0xAA, 0xAA, 0xAA, 0xAA, 0xFD, 0xAA, 0xA7,
+    0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x7A, 0xAA, 0xFE, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xFF, 0xC2, 0x9F,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x3E, 0x77, 0x9E, 0x77, 0x9D, 0xA7, 0x79, 0xE7, 0x70, 0xE9,
+    0x77, 0xAE, 0xA9, 0x99, 0x9A, 0xDA, 0x7F, 0xFE, 0xA7, 0x09, 0xFF, 0xA7, 0x49, 0x99, 0x71, 0x74,
+    0x97, 0x71, 0xAC, 0xA7, 0x5A, 0xFD, 0xA9, 0x70, 0xAF, 0xFE, 0x59, 0xFF, 0xAE, 0x94, 0x9F, 0x90,
+    0x9C, 0xA2, 0x95, 0xEA, 0x2A, 0xC9, 0x70, 0xEA, 0x3D, 0x97, 0x9E, 0x4D, 0x70, 0xE9, 0x39, 0xD7,
+    0x9E, 0x4A, 0xCA, 0x7A, 0xDA, 0x4A, 0xC9, 0x7E, 0x5D, 0x70, 0xE5, 0xD7, 0x9E, 0x49, 0xD7, 0xAD,
+    0xA4, 0xAC, 0xA7, 0xAD, 0xA4, 0xD9, 0x7A, 0xDA, 0x4D, 0x70, 0xAD, 0xA4, 0xD7, 0x09, 0xE3, 0x9C,
+    0xA7, 0x1E, 0x3A, 0xCA, 0x71, 0xF2, 0xD9, 0x71, 0x9E, 0xA1, 0xD7, 0x3A, 0xFA, 0xD9, 0x9A, 0xCA,
+    0x7A, 0xFF, 0xDA, 0x70, 0x9F, 0xFA, 0x97, 0x3D, 0x97, 0x70, 0xD7, 0x71, 0xAA, 0x72, 0x59, 0xC9,
+    0x4A, 0xC9, 0x71, 0xD5, 0xD7, 0x1A, 0xD4, 0xAD, 0x71, 0xE4, 0xDA, 0x69, 0xAF, 0xFF, 0xF1, 0x9F,
+    0xFF, 0xFC, 0xA2, 0x99, 0xE9, 0x99, 0x99, 0xE9, 0x99, 0x95, 0xE4, 0xE7, 0x1E, 0x39, 0xDA, 0x70,
+    0x9D, 0xA3, 0xAD, 0x97, 0x0A, 0xD9, 0x3A, 0xD7, 0x1E, 0x4E, 0x71, 0xE4, 0xE7, 0x09, 0xDA, 0x39,
+    0xDA, 0x70, 0x9D, 0x93, 0xAD, 0x97, 0x0A, 0xD9, 0x3E, 0x71, 0xE4, 0xE7, 0x1E, 0x4E, 0x70, 0x9D,
+    0xA4, 0xE7, 0x0A, 0xD9, 0x4E, 0x91, 0x94, 0xAD, 0x5F, 0xE4, 0xE6, 0xAF, 0xC7, 0x70, 0x99, 0x50,
+    0x77, 0x77, 0x49, 0xAF, 0xDA, 0x75, 0xAF, 0xFD, 0x73, 0xFC, 0xAA, 0xAF, 0x72, 0xAE, 0x95, 0x99,
+    0x72, 0xE9, 0x77, 0x29, 0xE7, 0x73, 0x9E, 0x77, 0x39, 0xE7, 0x74, 0xE9, 0x77, 0x3F, 0x97, 0x73,
+    0xFA, 0x77, 0x3F, 0xC9, 0x77, 0x2A, 0xFA, 0x77, 0x3F, 0xC7, 0x73, 0xAE, 0x97, 0x73, 0xAE, 0x4A,
+    0xA9, 0x1A, 0xA2, 0xAA, 0x91, 0x9E, 0x3F, 0x0F, 0x0F, 0x2E, 0x29, 0xC0, 0xAD, 0x1A, 0xD9, 0x09,
+    0xC9, 0x09, 0xE2, 0x9C, 0x9A, 0xC9, 0x19, 0xCA, 0x19, 0xC9, 0x0A, 0xDA, 0x3F, 0x2A, 0xC2, 0x9C,
+    0x99, 0xE4, 0x9E, 0x91, 0xD2, 0xAC, 0xAE, 0x95, 0xAF, 0xEA, 0xAA, 0xFC, 0x96, 0x9C, 0xAA, 0xFF,
+    0xCA, 0x97, 0x0A, 0xC2, 0x9C, 0x99, 0x99, 0xC9, 0x72, 0xD2, 0xAC, 0x29, 0xC7, 0x3A, 0x92, 0xAA,
+    0x29, 0xA7, 0x10, 0x09, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFD, 0x97, 0x77, 0x71,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xFD, 0xA0, 0xFF, 0xFE, 0x96, 0xE7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97,
+    0x4E, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x72, 0x19, 0xFF,
+    0xFC, 0x2A, 0xFF, 0xFC, 0x29, 0x99, 0xAF, 0x99, 0x99, 0x99, 0x7A, 0xDA, 0x75, 0xE7, 0x5E, 0x95,
+    0xAF, 0xFF, 0xC2, 0xFF, 0xFC, 0xA7, 0x1E, 0x74, 0xAD, 0xA7, 0x3A, 0xE6, 0x99, 0x9A, 0xAF, 0x7F,
+    0xEA, 0x70, 0xEA, 0x97, 0x39, 0xDA, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xE7, 0x5A, 0xDA, 0x75, 0xE7,
+    0x5A, 0xD9, 0x74, 0x9E, 0x75, 0xE9, 0x74, 0x9E, 0x70, 0x59, 0xD9, 0x76, 0xAD, 0x97, 0x6E, 0x77,
+    0xE3, 0x9A, 0xC7, 0x9D, 0xA0, 0x9A, 0xEA, 0x7A, 0xFE, 0xA9, 0x79, 0xFC, 0xA9, 0x70, 0xFD, 0x97,
+    0x29, 0xDA, 0xE3, 0xAD, 0x49, 0x19, 0xDA, 0x9A, 0xFA, 0x7A, 0xFE, 0x97, 0x9A, 0xFA, 0x97, 0x09,
+    0xFD, 0x73, 0xAC, 0xAA, 0xE7, 0xAA, 0xA3, 0x9D, 0xA7, 0xE3, 0xAD, 0x96, 0x9D, 0xA3, 0xE7, 0xE4,
+    0xE6, 0x9E, 0x39, 0xDA, 0x6E, 0x93, 0xAD, 0x95, 0xEA, 0x4A, 0xD9, 0x3A, 0xF5, 0xEA, 0xAA, 0xFC,
+    0xA6, 0xFF, 0xD9, 0x69, 0xFE, 0xA9, 0x73, 0x99, 0x74, 0x77, 0x70, 0xAE, 0x97, 0x7F, 0xD9, 0x75,
+    0xAC, 0xA1, 0xDA, 0x75, 0xD2, 0x9D, 0x75, 0xD2, 0x9D, 0x75, 0xD9, 0x1A, 0xCA, 0x75, 0xFA, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xF9, 0x5A, 0xD7, 0x1A, 0xD5, 0xAC,
+    0xA7, 0x2D, 0x5D, 0x97, 0x2A, 0xC9, 0x4D, 0x19, 0xC2, 0xA3, 0xAC, 0x93, 0x9D, 0x09, 0xD9, 0x0D,
+    0xA2, 0xAC, 0x4A, 0xDA, 0xFF, 0x91, 0xD4, 0xAE, 0xA0, 0xE9, 0x9D, 0xAD, 0x94, 0xAD, 0x91, 0x9C,
+    0x91, 0x9E, 0xA4, 0xAD, 0xA7, 0x19, 0x5A, 0xF7, 0x7A, 0xCA, 0xAD, 0x77, 0x09, 0x09, 0xDA, 0x77,
+    0x2F, 0x99, 0x99, 0xAA, 0x74, 0xFF, 0xC7, 0x5A, 0xFD, 0x97, 0x70, 0x99, 0x71, 0x76, 0xDA, 0x77,
+    0x39, 0xDA, 0x77, 0x39, 0xDA, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x4E, 0x77, 0x39, 0xDA, 0x77,
+    0x09, 0x9A, 0xFA, 0x97, 0x39, 0xFF, 0xFC, 0x70, 0xFF, 0xFF, 0x95, 0xFA, 0x2E, 0x19, 0xF4, 0xF3,
+    0x9D, 0xA3, 0xE9, 0x29, 0xE4, 0xAD, 0x93, 0x9D, 0xA2, 0xE9, 0x4E, 0x5E, 0x2E, 0x5E, 0x5E, 0x19,
+    0xDA, 0x5E, 0x5E, 0x1A, 0xD9, 0x49, 0xDA, 0x49, 0xDA, 0x1E, 0x94, 0xAD, 0x94, 0xAD, 0x91, 0xE5,
+    0x99, 0x95, 0xE9, 0x09, 0xE7, 0x6E, 0x19, 0xDA, 0x76, 0xE1, 0xAD, 0x97, 0x59, 0xDA, 0x1E, 0x76,
+    0xAD, 0x91, 0xE7, 0x6E, 0x10, 0x6A, 0xFE, 0xAA, 0x97, 0x1F, 0xFF, 0x70, 0xEA, 0xAA, 0xFE, 0x69,
+    0xDA, 0x5A, 0xEA, 0x5A, 0xD9, 0x6A, 0xE5, 0xAD, 0x97, 0xE5, 0xE7, 0x0E, 0x5E, 0x79, 0xE4, 0x9D,
+    0xA7, 0xAD, 0xA4, 0xAD, 0x97, 0xE5, 0xE6, 0x9E, 0xA5, 0xE2, 0x99, 0xAF, 0xA3, 0xFF, 0xFE, 0x93,
+    0x9F, 0xFF, 0xC9, 0x69, 0x9E, 0xA9, 0x99, 0x97, 0x4E, 0x77, 0x1E, 0x76, 0xAA, 0xFA, 0xAA, 0xAA,
+    0x70, 0x9F, 0xFE, 0x70, 0x99, 0x9E, 0xA9, 0x99, 0x99, 0x73, 0xE7, 0x71, 0xE7, 0x70, 0x9D, 0xA7,
+    0x70, 0xAD, 0x97, 0x60, 0x77, 0x77, 0x2A, 0xC9, 0x1D, 0x76, 0xD2, 0xD7, 0x6D, 0x19, 0xCA, 0x75,
+    0x9F, 0xDA, 0x97, 0x2A, 0xFF, 0xE7, 0x9F, 0xFF, 0xA6, 0x9F, 0xD2, 0xD0, 0x99, 0x59, 0xEA, 0x0D,
+    0x19, 0xCA, 0x70, 0xE9, 0x09, 0xCA, 0x1A, 0xC9, 0x7E, 0xA1, 0x9C, 0xA1, 0xD7, 0x9E, 0x2A, 0xC9,
+    0x1D, 0x7A, 0xDA, 0x2D, 0x2D, 0x7E, 0x3D, 0x19, 0xCA, 0x7E, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA,
+    0x77, 0x1A, 0xD9, 0x77, 0x19, 0xD9, 0x77, 0x19, 0xDA, 0x77, 0x2E, 0x77, 0x2E, 0x97, 0x71, 0x9E,
+    0x77, 0x2A, 0xDA, 0x77, 0x2A, 0xE9, 0x73, 0x9A, 0xAA, 0xAA, 0xFD, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF,
+    0xC4, 0xFF, 0xFF, 0xC3, 0x77, 0x72, 0xD1, 0xD7, 0x29, 0xCA, 0x1D, 0x72, 0xAC, 0x90, 0x9C, 0xA7,
+    0xAF, 0xFA, 0x7F, 0xFD, 0xA6, 0xFF, 0xE9, 0x49, 0xDA, 0x4F, 0x4A, 0xD9, 0x5E, 0x4A, 0xD9, 0x5E,
+    0x93, 0xE6, 0xE4, 0xE6, 0xE3, 0x9D, 0xA5, 0xAD, 0xA3, 0xAD, 0x94, 0xAE, 0x4F, 0xAA, 0xAF, 0xC5,
+    0xFF, 0xCA, 0x7F, 0xFD, 0xA5, 0x9D, 0xA4, 0xAE, 0x4A, 0xD9, 0x5E, 0x93, 0xE6, 0xAD, 0xA3, 0xE6,
+    0x9E, 0x29, 0xDA, 0x69, 0xDA, 0x29, 0xD9, 0x6A, 0xDA, 0x2A, 0xD9, 0x6E, 0x3E, 0x59, 0xEA, 0x3E,
+    0xAA, 0xAA, 0xAF, 0xC3, 0x9F, 0xFE, 0xA4, 0xAF, 0xFC, 0xA7, 0x1D, 0x1A, 0xC9, 0x72, 0xD1, 0xD7,
+    0x29, 0xCA, 0x1D, 0x73, 0x92, 0x97, 0x10, 0x19, 0x99, 0x99, 0x99, 0x1A, 0xFE, 0x1F, 0xF1, 0x99,
+    0x99, 0x99, 0x99, 0x00, 0x77, 0x77, 0x75, 0xC9, 0x77, 0x73, 0xE9, 0x77, 0x71, 0xFC, 0x97, 0x77,
+    0xFE, 0x97, 0x75, 0xFF, 0xC9, 0x77, 0x3F, 0xFE, 0x97, 0x71, 0xEA, 0x92, 0x9A, 0xE9, 0x77, 0xDA,
+    0x70, 0xE9, 0x75, 0xEA, 0x71, 0xE9, 0x73, 0xFC, 0x19, 0xAA, 0xA3, 0xF9, 0x71, 0xFD, 0xAF, 0xC9,
+    0x2A, 0xF9, 0x7F, 0xFF, 0xCA, 0x2A, 0xFC, 0x95, 0xFF, 0xFD, 0x3F, 0xE9, 0x3F, 0xFF, 0xD3, 0x9F,
+    0xF9, 0x1F, 0xFF, 0xD3, 0x9F, 0xFD, 0x90, 0xFF, 0xFC, 0x39, 0xFF, 0xE9, 0x1F, 0xFE, 0xA2, 0xAF,
+    0xFE, 0x93, 0xFF, 0xD9, 0x2F, 0xFE, 0x95, 0xFF, 0xC9, 0x19, 0xFF, 0xD9, 0x7F, 0xFF, 0xFF, 0xC9,
+    0x71, 0xFF, 0xFF, 0xE9, 0x73, 0xFE, 0x99, 0xAF, 0xE9, 0x75, 0xFC, 0x3F, 0xD9, 0x77, 0xF3, 0xAF,
+    0x97, 0x71, 0xE3, 0xF9, 0x77, 0x3E, 0x99, 0xAE, 0x97, 0x75, 0xFE, 0x97, 0x77, 0xFC, 0x97, 0x77,
+    0x1E, 0x97, 0x77, 0x3C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 10, 25, 11, 0, 24, 63, 0 }, // !
-    { 11, 9, 15, 3, 24, 25, 63 }, // "
-    { 21, 24, 23, 1, 24, 126, 88 }, // #
-    { 17, 28, 19, 1, 26, 119, 214 }, // $
-    { 24, 26, 27, 2, 25, 156, 333 }, // %
-    { 21, 26, 23, 1, 25, 137, 489 }, // &
-    { 5, 9, 9, 3, 24, 12, 626 }, // '
-    { 12, 30, 14, 1, 24, 90, 638 }, // (
-    { 12, 30, 10, -3, 24, 90, 728 }, // )
-    { 16, 16, 20, 3, 26, 64, 818 }, // *
-    { 16, 17, 19, 2, 20, 68, 882 }, // +
-    { 8, 9, 9, -2, 4, 18, 950 }, // ,
-    { 10, 4, 11, 0, 11, 10, 968 }, // -
-    { 5, 6, 9, 0, 5, 8, 978 }, // .
-    { 17, 24, 16, -2, 24, 102, 986 }, // /
-    { 17, 26, 19, 1, 25, 111, 1088 }, // 0
-    { 11, 24, 18, 4, 24, 66, 1199 }, // 1
-    { 18, 25, 19, 0, 25, 113, 1265 }, // 2
-    { 18, 26, 19, 0, 25, 117, 1378 }, // 3
-    { 18, 24, 19, 0, 24, 108, 1495 }, // 4
-    { 17, 25, 19, 1, 24, 107, 1603 }, // 5
-    { 17, 26, 20, 2, 25, 111, 1710 }, // 6
-    { 17, 24, 20, 2, 24, 102, 1821 }, // 7
-    { 18, 26, 20, 1, 25, 117, 1923 }, // 8
-    { 17, 26, 19, 1, 25, 111, 2040 }, // 9
-    { 8, 20, 9, 0, 19, 40, 2151 }, // :
-    { 10, 24, 9, -2, 19, 60, 2191 }, // ;
-    { 17, 18, 20, 2, 21, 77, 2251 }, // <
-    { 16, 10, 19, 2, 17, 40, 2328 }, // =
-    { 17, 18, 20, 2, 21, 77, 2368 }, // >
-    { 14, 26, 17, 2, 25, 91, 2445 }, // ?
-    { 27, 28, 29, 1, 24, 189, 2536 }, // @
-    { 20, 24, 19, -2, 24, 120, 2725 }, // A
-    { 19, 24, 21, 1, 24, 114, 2845 }, // B
-    { 20, 26, 23, 2, 25, 130, 2959 }, // C
-    { 21, 24, 23, 1, 24, 126, 3089 }, // D
-    { 18, 24, 20, 1, 24, 108, 3215 }, // E
-    { 18, 24, 20, 1, 24, 108, 3323 }, // F
-    { 21, 26, 24, 2, 25, 137, 3431 }, // G
-    { 22, 24, 24, 1, 24, 132, 3568 }, // H
-    { 14, 24, 14, -1, 24, 84, 3700 }, // I
-    { 16, 31, 11, -6, 24, 124, 3784 }, // J
-    { 21, 24, 23, 1, 24, 126, 3908 }, // K
-    { 13, 24, 16, 1, 24, 78, 4034 }, // L
-    { 28, 24, 30, 1, 24, 168, 4112 }, // M
-    { 23, 24, 25, 1, 24, 138, 4280 }, // N
-    { 21, 26, 24, 2, 25, 137, 4418 }, // O
-    { 18, 24, 20, 1, 24, 108, 4555 }, // P
-    { 21, 31, 24, 2, 25, 163, 4663 }, // Q
-    { 18, 24, 20, 1, 24, 108, 4826 }, // R
-    { 18, 26, 19, 0, 25, 117, 4934 }, // S
-    { 17, 24, 21, 3, 24, 102, 5051 }, // T
-    { 21, 25, 24, 2, 24, 132, 5153 }, // U
-    { 19, 24, 23, 3, 24, 114, 5285 }, // V
-    { 29, 24, 33, 3, 24, 174, 5399 }, // W
-    { 23, 24, 22, -2, 24, 138, 5573 }, // X
-    { 18, 24, 22, 3, 24, 108, 5711 }, // Y
-    { 21, 24, 21, -1, 24, 126, 5819 }, // Z
-    { 14, 30, 14, -1, 24, 105, 5945 }, // [
-    { 7, 24, 12, 3, 24, 42, 6050 }, // <backslash>
-    { 14, 30, 12, -3, 24, 105, 6092 }, // ]
-    { 17, 16, 19, 1, 24, 68, 6197 }, // ^
-    { 15, 3, 13, -4, -3, 12, 6265 }, // _
-    { 7, 6, 12, 4, 26, 11, 6277 }, // `
-    { 18, 20, 20, 1, 19, 90, 6288 }, // a
-    { 18, 27, 19, 0, 26, 122, 6378 }, // b
-    { 15, 20, 17, 1, 19, 75, 6500 }, // c
-    { 19, 27, 21, 1, 26, 129, 6575 }, // d
-    { 15, 20, 17, 1, 19, 75, 6704 }, // e
-    { 19, 34, 16, -4, 26, 162, 6779 }, // f
-    { 19, 27, 20, 0, 19, 129, 6941 }, // g
-    { 18, 26, 19, 0, 26, 117, 7070 }, // h
-    { 9, 25, 10, 0, 25, 57, 7187 }, // i
-    { 14, 33, 10, -5, 25, 116, 7244 }, // j
-    { 18, 26, 19, 0, 26, 117, 7360 }, // k
-    { 10, 26, 11, 0, 26, 65, 7477 }, // l
-    { 28, 19, 29, 0, 19, 133, 7542 }, // m
-    { 18, 19, 19, 0, 19, 86, 7675 }, // n
-    { 17, 20, 19, 1, 19, 85, 7761 }, // o
-    { 19, 27, 19, -1, 19, 129, 7846 }, // p
-    { 18, 27, 20, 1, 19, 122, 7975 }, // q
-    { 15, 19, 16, 0, 19, 72, 8097 }, // r
-    { 14, 20, 15, 0, 19, 70, 8169 }, // s
-    { 12, 23, 14, 1, 22, 69, 8239 }, // t
-    { 18, 19, 20, 1, 18, 86, 8308 }, // u
-    { 17, 18, 19, 1, 18, 77, 8394 }, // v
-    { 25, 18, 27, 1, 18, 113, 8471 }, // w
-    { 19, 18, 18, -2, 18, 86, 8584 }, // x
-    { 22, 26, 19, -4, 18, 143, 8670 }, // y
-    { 16, 18, 16, -1, 18, 72, 8813 }, // z
-    { 14, 30, 15, 0, 24, 105, 8885 }, // {
-    { 4, 35, 18, 8, 26, 35, 8990 }, // |
-    { 14, 30, 13, -2, 24, 105, 9025 }, // }
-    { 17, 5, 20, 2, 14, 22, 9130 }, // ~
-    { 0, 0, 9, 0, 0, 0, 9152 }, //  
-    { 10, 26, 10, -1, 19, 65, 9152 }, // ¡
-    { 15, 26, 19, 3, 25, 98, 9217 }, // ¢
-    { 21, 25, 21, -1, 25, 132, 9315 }, // £
-    { 15, 15, 18, 2, 19, 57, 9447 }, // ¤
-    { 19, 24, 22, 2, 24, 114, 9504 }, // ¥
-    { 4, 35, 18, 8, 26, 35, 9618 }, // ¦
-    { 17, 27, 18, 0, 26, 115, 9653 }, // §
-    { 10, 4, 18, 7, 25, 10, 9768 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 9778 }, // ©
-    { 11, 13, 14, 2, 25, 36, 9947 }, // ª
-    { 15, 15, 17, 1, 16, 57, 9983 }, // «
-    { 16, 9, 19, 2, 13, 36, 10040 }, // ¬
-    { 10, 4, 11, 0, 11, 10, 10076 }, // ­
-    { 26, 26, 28, 1, 25, 169, 10086 }, // ®
-    { 15, 3, 19, 3, 28, 12, 10255 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 10267 }, // °
-    { 17, 20, 20, 2, 20, 85, 10303 }, // ±
-    { 12, 16, 15, 2, 29, 48, 10388 }, // ²
-    { 12, 16, 15, 2, 29, 48, 10436 }, // ³
-    { 8, 6, 12, 3, 26, 12, 10484 }, // ´
-    { 20, 26, 20, -1, 18, 130, 10496 }, // µ
-    { 17, 31, 22, 3, 26, 132, 10626 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 10758 }, // ·
-    { 7, 8, 7, -3, 0, 14, 10766 }, // ¸
-    { 8, 16, 13, 4, 29, 32, 10780 }, // ¹
-    { 11, 13, 14, 2, 25, 36, 10812 }, // º
-    { 15, 15, 16, 0, 16, 57, 10848 }, // »
-    { 22, 26, 25, 2, 25, 143, 10905 }, // ¼
-    { 24, 26, 27, 2, 25, 156, 11048 }, // ½
-    { 25, 26, 27, 1, 25, 163, 11204 }, // ¾
-    { 13, 26, 14, -1, 19, 85, 11367 }, // ¿
-    { 20, 32, 19, -2, 32, 160, 11452 }, // À
-    { 21, 32, 20, -2, 32, 168, 11612 }, // Á
-    { 20, 32, 19, -2, 32, 160, 11780 }, // Â
-    { 22, 31, 21, -2, 31, 171, 11940 }, // Ã
-    { 20, 31, 19, -2, 31, 155, 12111 }, // Ä
-    { 20, 34, 19, -2, 34, 170, 12266 }, // Å
-    { 31, 24, 30, -2, 24, 186, 12436 }, // Æ
-    { 20, 33, 23, 2, 25, 165, 12622 }, // Ç
-    { 18, 32, 20, 1, 32, 144, 12787 }, // È
-    { 18, 32, 20, 1, 32, 144, 12931 }, // É
-    { 18, 32, 20, 1, 32, 144, 13075 }, // Ê
-    { 18, 31, 20, 1, 31, 140, 13219 }, // Ë
-    { 14, 32, 14, -1, 32, 112, 13359 }, // Ì
-    { 16, 32, 16, -1, 32, 128, 13471 }, // Í
-    { 15, 32, 15, -1, 32, 120, 13599 }, // Î
-    { 15, 31, 15, -1, 31, 117, 13719 }, // Ï
-    { 21, 24, 23, 1, 24, 126, 13836 }, // Ð
-    { 23, 31, 25, 1, 31, 179, 13962 }, // Ñ
-    { 21, 33, 24, 2, 32, 174, 14141 }, // Ò
-    { 21, 33, 24, 2, 32, 174, 14315 }, // Ó
-    { 21, 33, 24, 2, 32, 174, 14489 }, // Ô
-    { 21, 32, 24, 2, 31, 168, 14663 }, // Õ
-    { 21, 32, 24, 2, 31, 168, 14831 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 14999 }, // ×
-    { 23, 28, 25, 1, 26, 161, 15063 }, // Ø
-    { 21, 33, 24, 2, 32, 174, 15224 }, // Ù
-    { 21, 33, 24, 2, 32, 174, 15398 }, // Ú
-    { 21, 33, 24, 2, 32, 174, 15572 }, // Û
-    { 21, 32, 24, 2, 31, 168, 15746 }, // Ü
-    { 18, 32, 22, 3, 32, 144, 15914 }, // Ý
-    { 18, 24, 20, 1, 24, 108, 16058 }, // Þ
-    { 24, 34, 20, -5, 26, 204, 16166 }, // ß
-    { 18, 27, 20, 1, 26, 122, 16370 }, // à
-    { 18, 27, 20, 1, 26, 122, 16492 }, // á
-    { 18, 27, 20, 1, 26, 122, 16614 }, // â
-    { 18, 26, 20, 1, 25, 117, 16736 }, // ã
-    { 18, 26, 20, 1, 25, 117, 16853 }, // ä
-    { 18, 29, 20, 1, 28, 131, 16970 }, // å
-    { 26, 20, 28, 1, 19, 130, 17101 }, // æ
-    { 15, 27, 17, 1, 19, 102, 17231 }, // ç
-    { 15, 27, 17, 1, 26, 102, 17333 }, // è
-    { 16, 27, 18, 1, 26, 108, 17435 }, // é
-    { 15, 27, 17, 1, 26, 102, 17543 }, // ê
-    { 15, 26, 17, 1, 25, 98, 17645 }, // ë
-    { 9, 26, 10, 0, 26, 59, 17743 }, // ì
-    { 12, 26, 13, 0, 26, 78, 17802 }, // í
-    { 12, 26, 13, 0, 26, 78, 17880 }, // î
-    { 12, 25, 13, 0, 25, 75, 17958 }, // ï
-    { 18, 27, 20, 1, 26, 122, 18033 }, // ð
-    { 19, 25, 20, 0, 25, 119, 18155 }, // ñ
-    { 17, 27, 19, 1, 26, 115, 18274 }, // ò
-    { 17, 27, 19, 1, 26, 115, 18389 }, // ó
-    { 17, 27, 19, 1, 26, 115, 18504 }, // ô
-    { 17, 26, 19, 1, 25, 111, 18619 }, // õ
-    { 17, 26, 19, 1, 25, 111, 18730 }, // ö
-    { 17, 16, 20, 2, 20, 68, 18841 }, // ÷
-    { 18, 22, 19, 0, 20, 99, 18909 }, // ø
-    { 18, 27, 20, 1, 26, 122, 19008 }, // ù
-    { 18, 27, 20, 1, 26, 122, 19130 }, // ú
-    { 18, 27, 20, 1, 26, 122, 19252 }, // û
-    { 18, 26, 20, 1, 25, 117, 19374 }, // ü
-    { 22, 34, 19, -4, 26, 187, 19491 }, // ý
-    { 19, 34, 19, -1, 26, 162, 19678 }, // þ
-    { 22, 33, 19, -4, 25, 182, 19840 }, // ÿ
-    { 20, 29, 19, -2, 29, 145, 20022 }, // Ā
-    { 18, 24, 20, 1, 23, 108, 20167 }, // ā
-    { 21, 31, 20, -2, 31, 163, 20275 }, // Ă
-    { 18, 26, 20, 1, 25, 117, 20438 }, // ă
-    { 20, 32, 19, -2, 24, 160, 20555 }, // Ą
-    { 18, 27, 20, 1, 19, 122, 20715 }, // ą
-    { 20, 33, 23, 2, 32, 165, 20837 }, // Ć
-    { 15, 27, 17, 1, 26, 102, 21002 }, // ć
-    { 20, 33, 23, 2, 32, 165, 21104 }, // Ĉ
-    { 15, 27, 17, 1, 26, 102, 21269 }, // ĉ
-    { 20, 32, 23, 2, 31, 160, 21371 }, // Ċ
-    { 15, 26, 17, 1, 25, 98, 21531 }, // ċ
-    { 20, 33, 23, 2, 32, 165, 21629 }, // Č
-    { 16, 27, 18, 1, 26, 108, 21794 }, // č
-    { 21, 32, 23, 1, 32, 168, 21902 }, // Ď
-    { 25, 27, 27, 1, 26, 169, 22070 }, // ď
-    { 21, 24, 23, 1, 24, 126, 22239 }, // Đ
-    { 21, 27, 23, 1, 26, 142, 22365 }, // đ
-    { 18, 29, 20, 1, 29, 131, 22507 }, // Ē
-    { 15, 24, 17, 1, 23, 90, 22638 }, // ē
-    { 18, 31, 20, 1, 31, 140, 22728 }, // Ĕ
-    { 16, 26, 18, 1, 25, 104, 22868 }, // ĕ
-    { 18, 31, 20, 1, 31, 140, 22972 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 23112 }, // ė
-    { 18, 32, 20, 1, 24, 144, 23210 }, // Ę
-    { 15, 27, 17, 1, 19, 102, 23354 }, // ę
-    { 18, 32, 20, 1, 32, 144, 23456 }, // Ě
-    { 16, 27, 18, 1, 26, 108, 23600 }, // ě
-    { 21, 33, 24, 2, 32, 174, 23708 }, // Ĝ
-    { 19, 34, 20, 0, 26, 162, 23882 }, // ĝ
-    { 21, 32, 24, 2, 31, 168, 24044 }, // Ğ
-    { 19, 33, 20, 0, 25, 157, 24212 }, // ğ
-    { 21, 32, 24, 2, 31, 168, 24369 }, // Ġ
-    { 19, 33, 20, 0, 25, 157, 24537 }, // ġ
-    { 21, 33, 24, 2, 25, 174, 24694 }, // Ģ
-    { 19, 34, 20, 0, 26, 162, 24868 }, // ģ
-    { 22, 32, 24, 1, 32, 176, 25030 }, // Ĥ
-    { 18, 33, 19, 0, 33, 149, 25206 }, // ĥ
-    { 25, 24, 27, 1, 24, 150, 25355 }, // Ħ
-    { 18, 26, 19, 0, 26, 117, 25505 }, // ħ
-    { 17, 31, 17, -1, 31, 132, 25622 }, // Ĩ
-    { 14, 25, 15, 0, 25, 88, 25754 }, // ĩ
-    { 15, 29, 15, -1, 29, 109, 25842 }, // Ī
-    { 12, 23, 13, 0, 23, 69, 25951 }, // ī
-    { 16, 31, 16, -1, 31, 124, 26020 }, // Ĭ
-    { 13, 25, 14, 0, 25, 82, 26144 }, // ĭ
-    { 14, 32, 14, -1, 24, 112, 26226 }, // Į
-    { 11, 33, 10, -2, 25, 91, 26338 }, // į
-    { 14, 31, 14, -1, 31, 109, 26429 }, // İ
-    { 8, 18, 9, 0, 18, 36, 26538 }, // ı
-    { 22, 31, 22, -1, 24, 171, 26574 }, // Ĳ
-    { 18, 33, 19, 0, 25, 149, 26745 }, // ĳ
-    { 20, 39, 15, -6, 32, 195, 26894 }, // Ĵ
-    { 17, 34, 13, -5, 26, 145, 27089 }, // ĵ
-    { 21, 32, 23, 1, 24, 168, 27234 }, // Ķ
-    { 18, 34, 19, 0, 26, 153, 27402 }, // ķ
-    { 18, 18, 19, 0, 18, 81, 27555 }, // ĸ
-    { 14, 32, 16, 1, 32, 112, 27636 }, // Ĺ
-    { 14, 33, 15, 0, 33, 116, 27748 }, // ĺ
-    { 13, 32, 16, 1, 24, 104, 27864 }, // Ļ
-    { 12, 34, 11, -2, 26, 102, 27968 }, // ļ
-    { 17, 24, 19, 1, 24, 102, 28070 }, // Ľ
-    { 15, 26, 16, 0, 26, 98, 28172 }, // ľ
-    { 14, 24, 16, 1, 24, 84, 28270 }, // Ŀ
-    { 12, 26, 13, 0, 26, 78, 28354 }, // ŀ
-    { 14, 24, 16, 0, 24, 84, 28432 }, // Ł
-    { 10, 26, 11, 0, 26, 65, 28516 }, // ł
-    { 23, 32, 25, 1, 32, 184, 28581 }, // Ń
-    { 18, 26, 19, 0, 26, 117, 28765 }, // ń
-    { 23, 32, 25, 1, 24, 184, 28882 }, // Ņ
-    { 18, 27, 19, 0, 19, 122, 29066 }, // ņ
-    { 23, 32, 25, 1, 32, 184, 29188 }, // Ň
-    { 19, 26, 20, 0, 26, 124, 29372 }, // ň
-    { 20, 24, 22, 1, 24, 120, 29496 }, // ŉ
-    { 23, 31, 25, 1, 24, 179, 29616 }, // Ŋ
-    { 18, 27, 19, 0, 19, 122, 29795 }, // ŋ
-    { 21, 30, 24, 2, 29, 158, 29917 }, // Ō
-    { 17, 24, 19, 1, 23, 102, 30075 }, // ō
-    { 21, 32, 24, 2, 31, 168, 30177 }, // Ŏ
-    { 17, 26, 19, 1, 25, 111, 30345 }, // ŏ
-    { 23, 33, 26, 2, 32, 190, 30456 }, // Ő
-    { 19, 27, 21, 1, 26, 129, 30646 }, // ő
-    { 28, 26, 31, 2, 25, 182, 30775 }, // Œ
-    { 27, 20, 29, 1, 19, 135, 30957 }, // œ
-    { 18, 32, 20, 1, 32, 144, 31092 }, // Ŕ
-    { 16, 26, 17, 0, 26, 104, 31236 }, // ŕ
-    { 18, 32, 20, 1, 24, 144, 31340 }, // Ŗ
-    { 17, 27, 16, -2, 19, 115, 31484 }, // ŗ
-    { 19, 32, 21, 1, 32, 152, 31599 }, // Ř
-    { 17, 26, 18, 0, 26, 111, 31751 }, // ř
-    { 18, 33, 19, 0, 32, 149, 31862 }, // Ś
-    { 15, 27, 16, 0, 26, 102, 32011 }, // ś
-    { 18, 33, 19, 0, 32, 149, 32113 }, // Ŝ
-    { 15, 27, 16, 0, 26, 102, 32262 }, // ŝ
-    { 18, 33, 19, 0, 25, 149, 32364 }, // Ş
-    { 14, 27, 15, 0, 19, 95, 32513 }, // ş
-    { 18, 33, 19, 0, 32, 149, 32608 }, // Š
-    { 16, 27, 17, 0, 26, 108, 32757 }, // š
-    { 18, 32, 21, 2, 24, 144, 32865 }, // Ţ
-    { 12, 30, 14, 1, 22, 90, 33009 }, // ţ
-    { 17, 32, 21, 3, 32, 136, 33099 }, // Ť
-    { 14, 27, 16, 1, 26, 95, 33235 }, // ť
-    { 18, 24, 21, 2, 24, 108, 33330 }, // Ŧ
-    { 13, 23, 14, 0, 22, 75, 33438 }, // ŧ
-    { 21, 32, 24, 2, 31, 168, 33513 }, // Ũ
-    { 18, 26, 20, 1, 25, 117, 33681 }, // ũ
-    { 21, 30, 24, 2, 29, 158, 33798 }, // Ū
-    { 18, 24, 20, 1, 23, 108, 33956 }, // ū
-    { 21, 32, 24, 2, 31, 168, 34064 }, // Ŭ
-    { 18, 26, 20, 1, 25, 117, 34232 }, // ŭ
-    { 21, 35, 24, 2, 34, 184, 34349 }, // Ů
-    { 18, 29, 20, 1, 28, 131, 34533 }, // ů
-    { 22, 33, 25, 2, 32, 182, 34664 }, // Ű
-    { 20, 27, 22, 1, 26, 135, 34846 }, // ű
-    { 21, 32, 24, 2, 24, 168, 34981 }, // Ų
-    { 18, 26, 20, 1, 18, 117, 35149 }, // ų
-    { 29, 32, 33, 3, 32, 232, 35266 }, // Ŵ
-    { 25, 26, 27, 1, 26, 163, 35498 }, // ŵ
-    { 18, 32, 22, 3, 32, 144, 35661 }, // Ŷ
-    { 22, 34, 19, -4, 26, 187, 35805 }, // ŷ
-    { 18, 31, 22, 3, 31, 140, 35992 }, // Ÿ
-    { 21, 32, 21, -1, 32, 168, 36132 }, // Ź
-    { 17, 26, 17, -1, 26, 111, 36300 }, // ź
-    { 21, 31, 21, -1, 31, 163, 36411 }, // Ż
-    { 16, 25, 16, -1, 25, 100, 36574 }, // ż
-    { 21, 32, 21, -1, 32, 168, 36674 }, // Ž
-    { 17, 26, 17, -1, 26, 111, 36842 }, // ž
-    { 20, 34, 16, -5, 26, 170, 36953 }, // ſ
-    { 26, 27, 29, 2, 26, 176, 37123 }, // Ơ
-    { 22, 22, 24, 1, 21, 121, 37299 }, // ơ
-    { 31, 26, 34, 2, 25, 202, 37420 }, // Ƣ
-    { 24, 27, 27, 1, 19, 162, 37622 }, // ƣ
-    { 20, 24, 23, 2, 24, 120, 37784 }, // Ƥ
-    { 19, 34, 19, -1, 26, 162, 37904 }, // ƥ
-    { 18, 28, 20, 1, 24, 126, 38066 }, // Ʀ
-    { 18, 26, 19, 0, 25, 117, 38192 }, // Ƨ
-    { 15, 20, 16, 0, 19, 75, 38309 }, // ƨ
-    { 21, 24, 21, -1, 24, 126, 38384 }, // Ʃ
-    { 9, 34, 10, 0, 26, 77, 38510 }, // ƪ
-    { 12, 30, 14, 1, 22, 90, 38587 }, // ƫ
-    { 19, 24, 22, 2, 24, 114, 38677 }, // Ƭ
-    { 12, 27, 14, 1, 26, 81, 38791 }, // ƭ
-    { 17, 32, 21, 3, 24, 136, 38872 }, // Ʈ
-    { 27, 27, 30, 2, 26, 183, 39008 }, // Ư
-    { 24, 22, 26, 1, 21, 132, 39191 }, // ư
-    { 6, 6, 0, -13, 26, 9, 39323 }, // ̀
-    { 8, 6, 1, -8, 26, 12, 39332 }, // ́
-    { 11, 6, 9, -3, 26, 17, 39344 }, // ̂
-    { 13, 5, 0, -14, 25, 17, 39361 }, // ̃
-    { 11, 3, 9, -3, 23, 9, 39378 }, // ̄
-    { 14, 4, 12, -3, 29, 14, 39387 }, // ̅
-    { 10, 5, 9, -2, 25, 13, 39401 }, // ̆
-    { 4, 5, 6, 1, 25, 5, 39414 }, // ̇
-    { 10, 4, 9, -2, 25, 10, 39419 }, // ̈
-    { 7, 9, 0, -10, 28, 16, 39429 }, // ̉
-    { 8, 8, 8, -1, 28, 16, 39445 }, // ̊
-    { 13, 6, 12, -2, 26, 20, 39461 }, // ̋
-    { 11, 6, 10, -2, 26, 17, 39481 }, // ̌
-    { 6, 10, 7, 0, 26, 15, 39498 }, // ̍
-    { 10, 7, 9, -2, 26, 18, 39513 }, // ̎
-    { 12, 6, 0, -17, 26, 18, 39531 }, // ̏
-    { 11, 9, 10, -2, 29, 25, 39549 }, // ̐
-    { 11, 5, 9, -3, 25, 14, 39574 }, // ̑
-    { 7, 9, 7, -1, 24, 16, 39588 }, // ̒
-    { 7, 9, 7, -1, 24, 16, 39604 }, // ̓
-    { 5, 9, 6, 0, 24, 12, 39620 }, // ̔
-    { 7, 9, 7, -1, 24, 16, 39632 }, // ̕
-    { 7, 6, 1, -7, -1, 11, 39648 }, // ̖
-    { 8, 6, 4, -5, -1, 12, 39659 }, // ̗
-    { 8, 8, 3, -6, 0, 16, 39671 }, // ̘
-    { 8, 8, 2, -7, 0, 16, 39687 }, // ̙
-    { 10, 10, 14, 3, 26, 25, 39703 }, // ̚
-    { 8, 8, 7, -2, 26, 16, 39728 }, // ̛
-    { 5, 8, 4, -2, 0, 10, 39744 }, // ̜
-    { 8, 6, 2, -7, -1, 12, 39754 }, // ̝
-    { 8, 6, 3, -6, -1, 12, 39766 }, // ̞
-    { 9, 8, 3, -7, 0, 18, 39778 }, // ̟
-    { 8, 3, 2, -7, -2, 6, 39796 }, // ̠
-    { 8, 10, 2, -7, 2, 20, 39802 }, // ̡
-    { 7, 10, 4, -4, 2, 18, 39822 }, // ̢
-    { 4, 4, 0, -14, -2, 4, 39840 }, // ̣
-    { 10, 4, 3, -8, -2, 10, 39844 }, // ̤
-    { 8, 8, 2, -7, 0, 16, 39854 }, // ̥
-    { 6, 6, 9, 2, -2, 9, 39870 }, // ̦
-    { 7, 8, 2, -6, 0, 14, 39879 }, // ̧
-    { 6, 8, 2, -5, 0, 12, 39893 }, // ̨
-    { 5, 10, 1, -5, -1, 13, 39905 }, // ̩
-    { 14, 7, 5, -10, -1, 25, 39918 }, // ̪
-    { 14, 4, 6, -9, -2, 14, 39943 }, // ̫
-    { 11, 6, 5, -7, -1, 17, 39957 }, // ̬
-    { 11, 6, 4, -8, -1, 17, 39974 }, // ̭
-    { 10, 5, 4, -7, -1, 13, 39991 }, // ̮
-    { 11, 5, 4, -8, -1, 14, 40004 }, // ̯
-    { 13, 5, 5, -9, -1, 17, 40018 }, // ̰
-    { 10, 3, 3, -8, -2, 8, 40035 }, // ̱
-    { 15, 3, 6, -10, -3, 12, 40043 }, // ̲
-    { 15, 8, 6, -10, 0, 30, 40055 }, // ̳
-    { 14, 5, 8, -7, 12, 18, 40085 }, // ̴
-    { 14, 4, 8, -7, 12, 14, 40103 }, // ̵
-    { 24, 3, 13, -12, 11, 18, 40117 }, // ̶
-    { 10, 8, 6, -5, 14, 20, 40135 }, // ̷
-    { 20, 28, 11, -10, 26, 140, 40155 }, // ̸
-    { 5, 8, 4, -2, 0, 10, 40295 }, // ̹
-    { 14, 7, 5, -10, -1, 25, 40305 }, // ̺
-    { 14, 8, 5, -10, 0, 28, 40330 }, // ̻
-    { 13, 4, 5, -9, -2, 13, 40358 }, // ̼
-    { 8, 7, 8, -1, 26, 14, 40371 }, // ̽
-    { 8, 10, 8, -1, 29, 20, 40385 }, // ̾
-    { 15, 8, 13, -3, 33, 30, 40405 }, // ̿
-    { 7, 6, 6, -2, 26, 11, 40435 }, // ̀
-    { 8, 6, 10, 1, 26, 12, 40446 }, // ́
-    { 13, 5, 19, 5, 25, 17, 40458 }, // ͂
-    { 5, 6, 7, 1, 26, 8, 40475 }, // ̓
-    { 13, 6, 11, -3, 26, 20, 40483 }, // ̈́
-    { 6, 6, 3, -4, -2, 9, 40503 }, // ͅ
-    { 16, 7, 12, -5, 26, 28, 40512 }, // ͆
-    { 16, 8, 7, -10, 0, 32, 40540 }, // ͇
-    { 10, 7, 3, -8, -1, 18, 40572 }, // ͈
-    { 8, 6, 3, -6, -2, 12, 40590 }, // ͉
-    { 14, 8, 11, -4, 26, 28, 40602 }, // ͊
-    { 13, 12, 11, -3, 31, 39, 40630 }, // ͋
-    { 13, 9, 11, -3, 29, 30, 40669 }, // ͌
-    { 13, 7, 5, -9, -1, 23, 40699 }, // ͍
-    { 7, 8, 2, -6, 0, 14, 40722 }, // ͎
-    { 24, 24, 13, -12, 24, 144, 40736 }, // ͏
-    { 6, 8, 7, 0, 27, 12, 40880 }, // ͐
-    { 5, 8, 10, 4, 28, 10, 40892 }, // ͑
-    { 10, 9, 9, -2, 29, 23, 40902 }, // ͒
-    { 8, 7, 3, -6, -1, 14, 40925 }, // ͓
-    { 6, 7, 2, -5, -1, 11, 40939 }, // ͔
-    { 7, 7, 3, -5, -1, 13, 40950 }, // ͕
-    { 13, 7, 6, -8, -1, 23, 40963 }, // ͖
-    { 5, 8, 9, 3, 28, 10, 40986 }, // ͗
-    { 4, 5, 6, 1, 25, 5, 40996 }, // ͘
-    { 9, 7, 3, -7, -1, 16, 41001 }, // ͙
-    { 13, 8, 5, -9, 0, 26, 41017 }, // ͚
-    { 7, 8, 8, 0, 27, 14, 41043 }, // ͛
-    { 24, 7, 11, -14, -1, 42, 41057 }, // ͜
-    { 24, 7, 16, -9, 26, 42, 41099 }, // ͝
-    { 18, 3, 13, -6, 23, 14, 41141 }, // ͞
-    { 17, 3, 7, -11, -2, 13, 41155 }, // ͟
-    { 26, 5, 17, -10, 25, 33, 41168 }, // ͠
-    { 24, 7, 16, -9, 29, 42, 41201 }, // ͡
-    { 25, 7, 10, -16, -1, 44, 41243 }, // ͢
-    { 9, 8, 9, -1, 28, 18, 41287 }, // ͣ
-    { 7, 8, 8, 0, 28, 14, 41305 }, // ͤ
-    { 5, 11, 7, 1, 31, 14, 41319 }, // ͥ
-    { 8, 8, 8, -1, 28, 16, 41333 }, // ͦ
-    { 9, 8, 9, -1, 28, 18, 41349 }, // ͧ
-    { 7, 8, 8, 0, 28, 14, 41367 }, // ͨ
-    { 9, 11, 9, -1, 31, 25, 41381 }, // ͩ
-    { 8, 11, 8, -1, 31, 22, 41406 }, // ͪ
-    { 12, 8, 10, -3, 28, 24, 41428 }, // ͫ
-    { 7, 8, 8, 0, 28, 14, 41452 }, // ͬ
-    { 6, 10, 8, 1, 30, 15, 41466 }, // ͭ
-    { 8, 8, 9, 0, 28, 16, 41481 }, // ͮ
-    { 9, 8, 9, -1, 28, 18, 41497 }, // ͯ
-    { 20, 24, 19, -2, 24, 120, 41515 }, // Α
-    { 19, 24, 21, 1, 24, 114, 41635 }, // Β
-    { 18, 24, 20, 1, 24, 108, 41749 }, // Γ
-    { 21, 24, 20, -2, 24, 126, 41857 }, // Δ
-    { 18, 24, 20, 1, 24, 108, 41983 }, // Ε
-    { 21, 24, 21, -1, 24, 126, 42091 }, // Ζ
-    { 22, 24, 24, 1, 24, 132, 42217 }, // Η
-    { 21, 26, 24, 2, 25, 137, 42349 }, // Θ
-    { 14, 24, 14, -1, 24, 84, 42486 }, // Ι
-    { 21, 24, 23, 1, 24, 126, 42570 }, // Κ
-    { 20, 24, 19, -2, 24, 120, 42696 }, // Λ
-    { 28, 24, 30, 1, 24, 168, 42816 }, // Μ
-    { 23, 24, 25, 1, 24, 138, 42984 }, // Ν
-    { 20, 24, 20, -1, 24, 120, 43122 }, // Ξ
-    { 21, 26, 24, 2, 25, 137, 43242 }, // Ο
-    { 22, 24, 24, 1, 24, 132, 43379 }, // Π
-    { 18, 24, 20, 1, 24, 108, 43511 }, // Ρ
-    { 21, 24, 21, -1, 24, 126, 43619 }, // Σ
-    { 17, 24, 21, 3, 24, 102, 43745 }, // Τ
-    { 18, 24, 22, 3, 24, 108, 43847 }, // Υ
-    { 26, 24, 29, 2, 24, 156, 43955 }, // Φ
-    { 23, 24, 22, -2, 24, 138, 44111 }, // Χ
-    { 25, 24, 29, 3, 24, 150, 44249 }, // Ψ
-    { 24, 25, 24, -1, 25, 150, 44399 }, // Ω
-    { 18, 20, 20, 1, 19, 90, 44549 }, // α
-    { 20, 34, 20, -1, 26, 170, 44639 }, // β
-    { 15, 25, 17, 1, 18, 94, 44809 }, // γ
-    { 18, 27, 20, 1, 26, 122, 44903 }, // δ
-    { 15, 20, 16, 0, 19, 75, 45025 }, // ε
-    { 17, 33, 18, 0, 26, 141, 45100 }, // ζ
-    { 18, 27, 19, 0, 19, 122, 45241 }, // η
-    { 17, 27, 19, 1, 26, 115, 45363 }, // θ
-    { 8, 19, 10, 1, 18, 38, 45478 }, // ι
-    { 18, 18, 19, 0, 18, 81, 45516 }, // κ
-    { 18, 27, 18, -2, 26, 122, 45597 }, // λ
-    { 20, 26, 20, -1, 18, 130, 45719 }, // μ
-    { 15, 18, 17, 1, 18, 68, 45849 }, // ν
-    { 17, 33, 19, 1, 26, 141, 45917 }, // ξ
-    { 17, 20, 19, 1, 19, 85, 46058 }, // ο
-    { 21, 19, 23, 1, 18, 100, 46143 }, // π
-    { 18, 27, 18, -1, 19, 122, 46243 }, // ρ
-    { 15, 26, 17, 1, 19, 98, 46365 }, // ς
-    { 19, 19, 21, 1, 18, 91, 46463 }, // σ
-    { 15, 19, 17, 1, 18, 72, 46554 }, // τ
-    { 17, 19, 19, 1, 18, 81, 46626 }, // υ
-    { 21, 27, 23, 1, 19, 142, 46707 }, // φ
-    { 22, 26, 21, -2, 18, 143, 46849 }, // χ
-    { 22, 34, 24, 1, 26, 187, 46992 }, // ψ
-    { 24, 19, 26, 1, 18, 114, 47179 }, // ω
-    { 20, 30, 19, -2, 24, 150, 47293 }, // Ạ
-    { 18, 25, 20, 1, 19, 113, 47443 }, // ạ
-    { 20, 33, 19, -2, 33, 165, 47556 }, // Ả
-    { 18, 29, 20, 1, 28, 131, 47721 }, // ả
-    { 25, 33, 24, -2, 33, 207, 47852 }, // Ấ
-    { 21, 29, 23, 1, 28, 153, 48059 }, // ấ
-    { 20, 33, 19, -2, 33, 165, 48212 }, // Ầ
-    { 18, 29, 20, 1, 28, 131, 48377 }, // ầ
-    { 24, 35, 23, -2, 35, 210, 48508 }, // Ẩ
-    { 20, 30, 22, 1, 29, 150, 48718 }, // ẩ
-    { 23, 36, 22, -2, 36, 207, 48868 }, // Ẫ
-    { 18, 31, 20, 1, 30, 140, 49075 }, // ẫ
-    { 20, 38, 19, -2, 32, 190, 49215 }, // Ậ
-    { 18, 32, 20, 1, 26, 144, 49405 }, // ậ
-    { 21, 35, 20, -2, 35, 184, 49549 }, // Ắ
-    { 18, 30, 20, 1, 29, 135, 49733 }, // ắ
-    { 21, 35, 20, -2, 35, 184, 49868 }, // Ằ
-    { 18, 30, 20, 1, 29, 135, 50052 }, // ằ
-    { 21, 36, 20, -2, 36, 189, 50187 }, // Ẳ
-    { 18, 31, 20, 1, 30, 140, 50376 }, // ẳ
-    { 22, 36, 21, -2, 36, 198, 50516 }, // Ẵ
-    { 18, 31, 20, 1, 30, 140, 50714 }, // ẵ
-    { 21, 37, 20, -2, 31, 195, 50854 }, // Ặ
-    { 18, 31, 20, 1, 25, 140, 51049 }, // ặ
-    { 18, 30, 20, 1, 24, 135, 51189 }, // Ẹ
-    { 15, 25, 17, 1, 19, 94, 51324 }, // ẹ
-    { 18, 33, 20, 1, 33, 149, 51418 }, // Ẻ
-    { 15, 29, 17, 1, 28, 109, 51567 }, // ẻ
-    { 19, 31, 21, 1, 31, 148, 51676 }, // Ẽ
-    { 17, 26, 19, 1, 25, 111, 51824 }, // ẽ
-    { 22, 33, 24, 1, 33, 182, 51935 }, // Ế
-    { 20, 29, 22, 1, 28, 145, 52117 }, // ế
-    { 18, 33, 20, 1, 33, 149, 52262 }, // Ề
-    { 15, 29, 17, 1, 28, 109, 52411 }, // ề
-    { 21, 35, 23, 1, 35, 184, 52520 }, // Ể
-    { 19, 30, 21, 1, 29, 143, 52704 }, // ể
-    { 19, 36, 21, 1, 36, 171, 52847 }, // Ễ
-    { 18, 31, 20, 1, 30, 140, 53018 }, // ễ
-    { 18, 38, 20, 1, 32, 171, 53158 }, // Ệ
-    { 15, 32, 17, 1, 26, 120, 53329 }, // ệ
-    { 15, 33, 15, -1, 33, 124, 53449 }, // Ỉ
-    { 12, 28, 13, 0, 28, 84, 53573 }, // ỉ
-    { 14, 30, 14, -1, 24, 105, 53657 }, // Ị
-    { 10, 31, 10, -1, 25, 78, 53762 }, // ị
-    { 21, 31, 24, 2, 25, 163, 53840 }, // Ọ
-    { 17, 25, 19, 1, 19, 107, 54003 }, // ọ
-    { 21, 34, 24, 2, 33, 179, 54110 }, // Ỏ
-    { 17, 29, 19, 1, 28, 124, 54289 }, // ỏ
-    { 24, 34, 27, 2, 33, 204, 54413 }, // Ố
-    { 20, 29, 22, 1, 28, 145, 54617 }, // ố
-    { 21, 34, 24, 2, 33, 179, 54762 }, // Ồ
-    { 17, 29, 19, 1, 28, 124, 54941 }, // ồ
-    { 23, 36, 26, 2, 35, 207, 55065 }, // Ổ
-    { 19, 30, 21, 1, 29, 143, 55272 }, // ổ
-    { 21, 37, 24, 2, 36, 195, 55415 }, // Ỗ
-    { 18, 31, 20, 1, 30, 140, 55610 }, // ỗ
-    { 21, 38, 24, 2, 32, 200, 55750 }, // Ộ
-    { 17, 32, 19, 1, 26, 136, 55950 }, // ộ
-    { 26, 33, 29, 2, 32, 215, 56086 }, // Ớ
-    { 22, 27, 24, 1, 26, 149, 56301 }, // ớ
-    { 26, 33, 29, 2, 32, 215, 56450 }, // Ờ
-    { 22, 27, 24, 1, 26, 149, 56665 }, // ờ
-    { 26, 34, 29, 2, 33, 221, 56814 }, // Ở
-    { 22, 29, 24, 1, 28, 160, 57035 }, // ở
-    { 26, 32, 29, 2, 31, 208, 57195 }, // Ỡ
-    { 22, 26, 24, 1, 25, 143, 57403 }, // ỡ
-    { 26, 32, 29, 2, 26, 208, 57546 }, // Ợ
-    { 22, 27, 24, 1, 21, 149, 57754 }, // ợ
-    { 21, 30, 24, 2, 24, 158, 57903 }, // Ụ
-    { 18, 24, 20, 1, 18, 108, 58061 }, // ụ
-    { 21, 34, 24, 2, 33, 179, 58169 }, // Ủ
-    { 18, 29, 20, 1, 28, 131, 58348 }, // ủ
-    { 27, 33, 30, 2, 32, 223, 58479 }, // Ứ
-    { 24, 27, 26, 1, 26, 162, 58702 }, // ứ
-    { 27, 33, 30, 2, 32, 223, 58864 }, // Ừ
-    { 24, 27, 26, 1, 26, 162, 59087 }, // ừ
-    { 27, 34, 30, 2, 33, 230, 59249 }, // Ử
-    { 24, 29, 26, 1, 28, 174, 59479 }, // ử
-    { 27, 32, 30, 2, 31, 216, 59653 }, // Ữ
-    { 24, 26, 26, 1, 25, 156, 59869 }, // ữ
-    { 27, 32, 30, 2, 26, 216, 60025 }, // Ự
-    { 24, 27, 26, 1, 21, 162, 60241 }, // ự
-    { 18, 32, 22, 3, 32, 144, 60403 }, // Ỳ
-    { 22, 34, 19, -4, 26, 187, 60547 }, // ỳ
-    { 18, 30, 22, 3, 24, 135, 60734 }, // Ỵ
-    { 22, 26, 19, -4, 18, 143, 60869 }, // ỵ
-    { 18, 33, 22, 3, 33, 149, 61012 }, // Ỷ
-    { 22, 36, 19, -4, 28, 198, 61161 }, // ỷ
-    { 18, 31, 22, 3, 31, 140, 61359 }, // Ỹ
-    { 22, 33, 19, -4, 25, 182, 61499 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 61681 }, //  
-    { 0, 0, 33, 0, 0, 0, 61681 }, //  
-    { 0, 0, 17, 0, 0, 0, 61681 }, //  
-    { 0, 0, 33, 0, 0, 0, 61681 }, //  
-    { 0, 0, 11, 0, 0, 0, 61681 }, //  
-    { 0, 0, 8, 0, 0, 0, 61681 }, //  
-    { 0, 0, 6, 0, 0, 0, 61681 }, //  
-    { 0, 0, 18, 0, 0, 0, 61681 }, //  
-    { 0, 0, 9, 0, 0, 0, 61681 }, //  
-    { 0, 0, 6, 0, 0, 0, 61681 }, //  
-    { 0, 0, 3, 0, 0, 0, 61681 }, //  
-    { 0, 0, 1, 0, 0, 0, 61681 }, // ​
-    { 0, 0, 1, 0, 0, 0, 61681 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 61681 }, // ‍
-    { 9, 28, 9, -1, 23, 63, 61681 }, // ‎
-    { 9, 28, 2, -8, 23, 63, 61744 }, // ‏
-    { 10, 4, 11, 0, 11, 10, 61807 }, // ‐
-    { 10, 4, 11, 0, 11, 10, 61817 }, // ‑
-    { 17, 4, 19, 1, 14, 17, 61827 }, // ‒
-    { 15, 4, 16, 0, 11, 15, 61844 }, // –
-    { 31, 4, 32, 0, 11, 31, 61859 }, // —
-    { 31, 4, 32, 0, 11, 31, 61890 }, // ―
-    { 10, 35, 18, 5, 26, 88, 61921 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 62009 }, // ‗
-    { 7, 9, 10, 2, 24, 16, 62041 }, // ‘
-    { 7, 9, 10, 2, 24, 16, 62057 }, // ’
-    { 7, 9, 8, -2, 4, 16, 62073 }, // ‚
-    { 5, 9, 9, 3, 24, 12, 62089 }, // ‛
-    { 13, 9, 16, 2, 24, 30, 62101 }, // “
-    { 13, 9, 16, 2, 24, 30, 62131 }, // ”
-    { 14, 9, 14, -2, 4, 32, 62161 }, // „
-    { 10, 9, 14, 3, 24, 23, 62193 }, // ‟
-    { 13, 26, 17, 3, 26, 85, 62216 }, // †
-    { 16, 26, 18, 1, 26, 104, 62301 }, // ‡
-    { 8, 9, 13, 3, 17, 18, 62405 }, // •
-    { 11, 11, 13, 1, 18, 31, 62423 }, // ‣
-    { 5, 6, 17, 4, 5, 8, 62454 }, // ․
-    { 14, 6, 17, 0, 5, 21, 62462 }, // ‥
-    { 22, 6, 26, 0, 5, 33, 62483 }, // …
-    { 5, 6, 9, 2, 12, 8, 62516 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 62524 }, //  
-    { 0, 0, 20, 0, 0, 0, 62524 }, //  
-    { 9, 26, 9, -1, 21, 59, 62524 }, // ‪
-    { 9, 26, 2, -8, 21, 59, 62583 }, // ‫
-    { 8, 28, 5, -4, 23, 56, 62642 }, // ‬
-    { 8, 28, 5, -4, 23, 56, 62698 }, // ‭
-    { 8, 28, 5, -4, 23, 56, 62754 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 62810 }, //  
-    { 35, 26, 38, 2, 25, 228, 62810 }, // ‰
-    { 45, 26, 48, 2, 25, 293, 63038 }, // ‱
-    { 8, 9, 11, 2, 24, 18, 63331 }, // ′
-    { 14, 9, 17, 2, 24, 32, 63349 }, // ″
-    { 19, 9, 22, 2, 24, 43, 63381 }, // ‴
-    { 5, 9, 10, 4, 24, 12, 63424 }, // ‵
-    { 11, 9, 16, 4, 24, 25, 63436 }, // ‶
-    { 16, 9, 21, 4, 24, 36, 63461 }, // ‷
-    { 13, 11, 13, -3, 3, 36, 63497 }, // ‸
-    { 9, 15, 11, 1, 16, 34, 63533 }, // ‹
-    { 9, 15, 10, 0, 16, 34, 63567 }, // ›
-    { 26, 26, 28, 1, 25, 169, 63601 }, // ※
-    { 17, 25, 18, 0, 24, 107, 63770 }, // ‼
-    { 14, 26, 17, 2, 25, 91, 63877 }, // ‽
-    { 15, 3, 19, 3, 28, 12, 63968 }, // ‾
-    { 18, 7, 18, -2, -1, 32, 63980 }, // ‿
-    { 18, 8, 21, 2, 27, 36, 64012 }, // ⁀
-    { 16, 22, 13, -4, 14, 88, 64048 }, // ⁁
-    { 36, 31, 37, 0, 26, 279, 64136 }, // ⁂
-    { 9, 4, 10, 0, 11, 9, 64415 }, // ⁃
-    { 21, 24, 14, -8, 24, 126, 64424 }, // ⁄
-    { 14, 30, 14, -1, 24, 105, 64550 }, // ⁅
-    { 14, 30, 12, -3, 24, 105, 64655 }, // ⁆
-    { 28, 26, 31, 2, 25, 182, 64760 }, // ⁇
-    { 22, 26, 25, 2, 25, 143, 64942 }, // ⁈
-    { 24, 26, 25, 0, 25, 156, 65085 }, // ⁉
-    { 17, 18, 20, 2, 18, 77, 65241 }, // ⁊
-    { 17, 31, 21, 3, 26, 132, 65318 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 65450 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 65527 }, // ⁍
-    { 17, 16, 18, -1, 9, 68, 65604 }, // ⁎
-    { 7, 24, 9, 1, 19, 42, 65672 }, // ⁏
-    { 22, 35, 21, -2, 27, 193, 65714 }, // ⁐
-    { 19, 33, 20, 0, 26, 157, 65907 }, // ⁑
-    { 13, 26, 14, 0, 25, 85, 66064 }, // ⁒
-    { 29, 6, 33, 3, 13, 44, 66149 }, // ⁓
-    { 18, 8, 18, -3, 0, 36, 66193 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 66229 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 66310 }, // ⁖
-    { 25, 9, 28, 2, 24, 57, 66408 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 66465 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 66628 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 66791 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 66824 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 66954 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 67117 }, // ⁝
-    { 5, 26, 9, 3, 25, 33, 67149 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 67182 }, //  
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 67182 }, // ⁩
-    { 8, 28, 5, -4, 23, 56, 67182 }, // ⁪
-    { 8, 28, 5, -4, 23, 56, 67238 }, // ⁫
-    { 8, 28, 5, -4, 23, 56, 67294 }, // ⁬
-    { 8, 29, 5, -4, 24, 58, 67350 }, // ⁭
-    { 8, 28, 5, -4, 23, 56, 67408 }, // ⁮
-    { 8, 28, 5, -4, 23, 56, 67464 }, // ⁯
-    { 11, 16, 15, 3, 29, 44, 67520 }, // ⁰
-    { 6, 16, 9, 2, 25, 24, 67564 }, // ⁱ
-    { 12, 16, 15, 2, 29, 48, 67588 }, // ⁴
-    { 11, 16, 15, 3, 29, 44, 67636 }, // ⁵
-    { 11, 16, 15, 3, 29, 44, 67680 }, // ⁶
-    { 12, 16, 16, 3, 29, 48, 67724 }, // ⁷
-    { 12, 16, 15, 2, 29, 48, 67772 }, // ⁸
-    { 11, 16, 15, 3, 29, 44, 67820 }, // ⁹
-    { 10, 10, 14, 3, 25, 25, 67864 }, // ⁺
-    { 10, 3, 14, 3, 22, 8, 67889 }, // ⁻
-    { 10, 6, 14, 3, 23, 15, 67897 }, // ⁼
-    { 9, 18, 13, 3, 30, 41, 67912 }, // ⁽
-    { 8, 18, 9, 0, 30, 36, 67953 }, // ⁾
-    { 12, 12, 15, 2, 21, 36, 67989 }, // ⁿ
-    { 11, 16, 12, -1, 11, 44, 68025 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 68069 }, // ₁
-    { 12, 16, 12, -2, 11, 48, 68097 }, // ₂
-    { 12, 16, 12, -2, 11, 48, 68145 }, // ₃
-    { 12, 16, 12, -2, 11, 48, 68193 }, // ₄
-    { 11, 16, 12, -1, 11, 44, 68241 }, // ₅
-    { 11, 16, 12, -1, 11, 44, 68285 }, // ₆
-    { 12, 16, 12, -1, 11, 48, 68329 }, // ₇
-    { 11, 16, 12, -1, 11, 44, 68377 }, // ₈
-    { 11, 16, 12, -1, 11, 44, 68421 }, // ₉
-    { 10, 10, 11, -1, 7, 25, 68465 }, // ₊
-    { 10, 3, 11, -1, 4, 8, 68490 }, // ₋
-    { 10, 6, 11, -1, 5, 15, 68498 }, // ₌
-    { 8, 18, 9, 0, 12, 36, 68513 }, // ₍
-    { 8, 18, 6, -4, 12, 36, 68549 }, // ₎
-    { 12, 12, 12, -1, 8, 36, 68585 }, // ₐ
-    { 10, 12, 11, -1, 8, 30, 68621 }, // ₑ
-    { 11, 12, 12, -1, 8, 33, 68651 }, // ₒ
-    { 13, 12, 11, -3, 8, 39, 68684 }, // ₓ
-    { 10, 12, 11, -2, 8, 30, 68723 }, // ₔ
-    { 11, 16, 15, 0, 12, 44, 68753 }, // ₕ
-    { 11, 16, 12, 0, 12, 44, 68797 }, // ₖ
-    { 6, 16, 8, 0, 12, 24, 68841 }, // ₗ
-    { 18, 12, 21, 0, 8, 54, 68865 }, // ₘ
-    { 12, 12, 13, -2, 8, 36, 68919 }, // ₙ
-    { 13, 16, 13, -3, 8, 52, 68955 }, // ₚ
-    { 9, 12, 10, -1, 8, 27, 69007 }, // ₛ
-    { 8, 14, 8, -1, 10, 28, 69034 }, // ₜ
-    { 17, 25, 20, 2, 25, 107, 69062 }, // ₠
-    { 19, 28, 21, 1, 26, 133, 69169 }, // ₡
-    { 18, 26, 21, 2, 25, 117, 69302 }, // ₢
-    { 20, 24, 21, 0, 24, 120, 69419 }, // ₣
-    { 21, 25, 21, -1, 25, 132, 69539 }, // ₤
-    { 28, 27, 29, 0, 23, 189, 69671 }, // ₥
-    { 20, 24, 21, 0, 24, 120, 69860 }, // ₦
-    { 24, 25, 25, 0, 24, 150, 69980 }, // ₧
-    { 27, 25, 28, 0, 24, 169, 70130 }, // ₨
-    { 24, 24, 25, 0, 24, 144, 70299 }, // ₩
-    { 28, 24, 29, 0, 24, 168, 70443 }, // ₪
-    { 22, 32, 23, 0, 26, 176, 70611 }, // ₫
-    { 20, 26, 22, 1, 25, 130, 70787 }, // €
-    { 21, 24, 23, 1, 24, 126, 70917 }, // ₭
-    { 19, 24, 21, 1, 24, 114, 71043 }, // ₮
-    { 32, 33, 33, 0, 25, 264, 71157 }, // ₯
-    { 21, 33, 20, -2, 25, 174, 71421 }, // ₰
-    { 20, 24, 22, 1, 24, 120, 71595 }, // ₱
-    { 21, 29, 24, 2, 26, 153, 71715 }, // ₲
-    { 22, 24, 21, -2, 24, 132, 71868 }, // ₳
-    { 20, 26, 20, -1, 25, 130, 72000 }, // ₴
-    { 20, 29, 23, 2, 26, 145, 72130 }, // ₵
-    { 21, 23, 22, 0, 22, 121, 72275 }, // ₶
-    { 24, 28, 24, -1, 25, 168, 72396 }, // ₷
-    { 17, 24, 20, 2, 24, 102, 72564 }, // ₸
-    { 17, 24, 21, 3, 24, 102, 72666 }, // ₹
-    { 19, 25, 20, 0, 24, 119, 72768 }, // ₺
-    { 22, 26, 24, 1, 25, 143, 72887 }, // ₻
-    { 24, 24, 25, -1, 24, 144, 73030 }, // ₼
-    { 21, 24, 21, -1, 24, 126, 73174 }, // ₽
-    { 22, 28, 22, -1, 28, 154, 73300 }, // ₾
-    { 18, 32, 20, 1, 28, 144, 73454 }, // ₿
-    { 10, 4, 11, 0, 11, 10, 73598 }, // −
-    { 31, 32, 33, 1, 26, 248, 73608 }, // �
+    { 10, 25, 11, 0, 24, 36, 0 }, // !
+    { 11, 9, 15, 3, 24, 28, 36 }, // "
+    { 21, 24, 23, 1, 24, 93, 64 }, // #
+    { 17, 28, 19, 1, 26, 83, 157 }, // $
+    { 24, 26, 27, 2, 25, 129, 240 }, // %
+    { 21, 26, 23, 1, 25, 96, 369 }, // &
+    { 5, 9, 9, 3, 24, 14, 465 }, // '
+    { 12, 30, 14, 1, 24, 55, 479 }, // (
+    { 12, 30, 10, -3, 24, 53, 534 }, // )
+    { 16, 16, 20, 3, 26, 45, 587 }, // *
+    { 16, 17, 19, 2, 20, 41, 632 }, // +
+    { 8, 9, 9, -2, 4, 14, 673 }, // ,
+    { 10, 4, 11, 0, 11, 13, 687 }, // -
+    { 5, 6, 9, 0, 5, 7, 700 }, // .
+    { 17, 24, 16, -2, 24, 49, 707 }, // /
+    { 17, 26, 19, 1, 25, 76, 756 }, // 0
+    { 11, 24, 18, 4, 24, 43, 832 }, // 1
+    { 18, 25, 19, 0, 25, 64, 875 }, // 2
+    { 18, 26, 19, 0, 25, 70, 939 }, // 3
+    { 18, 24, 19, 0, 24, 71, 1009 }, // 4
+    { 17, 25, 19, 1, 24, 58, 1080 }, // 5
+    { 17, 26, 20, 2, 25, 74, 1138 }, // 6
+    { 17, 24, 20, 2, 24, 53, 1212 }, // 7
+    { 18, 26, 20, 1, 25, 73, 1265 }, // 8
+    { 17, 26, 19, 1, 25, 76, 1338 }, // 9
+    { 8, 20, 9, 0, 19, 21, 1414 }, // :
+    { 10, 24, 9, -2, 19, 28, 1435 }, // ;
+    { 17, 18, 20, 2, 21, 43, 1463 }, // <
+    { 16, 10, 19, 2, 17, 24, 1506 }, // =
+    { 17, 18, 20, 2, 21, 42, 1530 }, // >
+    { 14, 26, 17, 2, 25, 52, 1572 }, // ?
+    { 27, 28, 29, 1, 24, 138, 1624 }, // @
+    { 20, 24, 19, -2, 24, 78, 1762 }, // A
+    { 19, 24, 21, 1, 24, 79, 1840 }, // B
+    { 20, 26, 23, 2, 25, 67, 1919 }, // C
+    { 21, 24, 23, 1, 24, 82, 1986 }, // D
+    { 18, 24, 20, 1, 24, 61, 2068 }, // E
+    { 18, 24, 20, 1, 24, 56, 2129 }, // F
+    { 21, 26, 24, 2, 25, 84, 2185 }, // G
+    { 22, 24, 24, 1, 24, 88, 2269 }, // H
+    { 14, 24, 14, -1, 24, 50, 2357 }, // I
+    { 16, 31, 11, -6, 24, 64, 2407 }, // J
+    { 21, 24, 23, 1, 24, 78, 2471 }, // K
+    { 13, 24, 16, 1, 24, 52, 2549 }, // L
+    { 28, 24, 30, 1, 24, 128, 2601 }, // M
+    { 23, 24, 25, 1, 24, 101, 2729 }, // N
+    { 21, 26, 24, 2, 25, 89, 2830 }, // O
+    { 18, 24, 20, 1, 24, 66, 2919 }, // P
+    { 21, 31, 24, 2, 25, 103, 2985 }, // Q
+    { 18, 24, 20, 1, 24, 74, 3088 }, // R
+    { 18, 26, 19, 0, 25, 65, 3162 }, // S
+    { 17, 24, 21, 3, 24, 50, 3227 }, // T
+    { 21, 25, 24, 2, 24, 87, 3277 }, // U
+    { 19, 24, 23, 3, 24, 74, 3364 }, // V
+    { 29, 24, 33, 3, 24, 125, 3438 }, // W
+    { 23, 24, 22, -2, 24, 80, 3563 }, // X
+    { 18, 24, 22, 3, 24, 63, 3643 }, // Y
+    { 21, 24, 21, -1, 24, 61, 3706 }, // Z
+    { 14, 30, 14, -1, 24, 63, 3767 }, // [
+    { 7, 24, 12, 3, 24, 36, 3830 }, // <backslash>
+    { 14, 30, 12, -3, 24, 65, 3866 }, // ]
+    { 17, 16, 19, 1, 24, 46, 3931 }, // ^
+    { 15, 3, 13, -4, -3, 14, 3977 }, // _
+    { 7, 6, 12, 4, 26, 10, 3991 }, // `
+    { 18, 20, 20, 1, 19, 63, 4001 }, // a
+    { 18, 27, 19, 0, 26, 82, 4064 }, // b
+    { 15, 20, 17, 1, 19, 46, 4146 }, // c
+    { 19, 27, 21, 1, 26, 79, 4192 }, // d
+    { 15, 20, 17, 1, 19, 56, 4271 }, // e
+    { 19, 34, 16, -4, 26, 78, 4327 }, // f
+    { 19, 27, 20, 0, 19, 85, 4405 }, // g
+    { 18, 26, 19, 0, 26, 74, 4490 }, // h
+    { 9, 25, 10, 0, 25, 36, 4564 }, // i
+    { 14, 33, 10, -5, 25, 64, 4600 }, // j
+    { 18, 26, 19, 0, 26, 70, 4664 }, // k
+    { 10, 26, 11, 0, 26, 39, 4734 }, // l
+    { 28, 19, 29, 0, 19, 89, 4773 }, // m
+    { 18, 19, 19, 0, 19, 59, 4862 }, // n
+    { 17, 20, 19, 1, 19, 60, 4921 }, // o
+    { 19, 27, 19, -1, 19, 82, 4981 }, // p
+    { 18, 27, 20, 1, 19, 77, 5063 }, // q
+    { 15, 19, 16, 0, 19, 43, 5140 }, // r
+    { 14, 20, 15, 0, 19, 47, 5183 }, // s
+    { 12, 23, 14, 1, 22, 45, 5230 }, // t
+    { 18, 19, 20, 1, 18, 59, 5275 }, // u
+    { 17, 18, 19, 1, 18, 54, 5334 }, // v
+    { 25, 18, 27, 1, 18, 93, 5388 }, // w
+    { 19, 18, 18, -2, 18, 54, 5481 }, // x
+    { 22, 26, 19, -4, 18, 77, 5535 }, // y
+    { 16, 18, 16, -1, 18, 44, 5612 }, // z
+    { 14, 30, 15, 0, 24, 63, 5656 }, // {
+    { 4, 35, 18, 8, 26, 52, 5719 }, // |
+    { 14, 30, 13, -2, 24, 64, 5771 }, // }
+    { 17, 5, 20, 2, 14, 19, 5835 }, // ~
+    { 0, 0, 9, 0, 0, 0, 5854 }, //  
+    { 10, 26, 10, -1, 19, 35, 5854 }, // ¡
+    { 15, 26, 19, 3, 25, 58, 5889 }, // ¢
+    { 21, 25, 21, -1, 25, 78, 5947 }, // £
+    { 15, 15, 18, 2, 19, 49, 6025 }, // ¤
+    { 19, 24, 22, 2, 24, 77, 6074 }, // ¥
+    { 4, 35, 18, 8, 26, 43, 6151 }, // ¦
+    { 17, 27, 18, 0, 26, 68, 6194 }, // §
+    { 10, 4, 18, 7, 25, 14, 6262 }, // ¨
+    { 26, 26, 28, 1, 25, 121, 6276 }, // ©
+    { 11, 13, 14, 2, 25, 34, 6397 }, // ª
+    { 15, 15, 17, 1, 16, 43, 6431 }, // «
+    { 16, 9, 19, 2, 13, 25, 6474 }, // ¬
+    { 10, 4, 11, 0, 11, 13, 6499 }, // ­
+    { 26, 26, 28, 1, 25, 131, 6512 }, // ®
+    { 15, 3, 19, 3, 28, 18, 6643 }, // ¯
+    { 12, 12, 14, 1, 25, 25, 6661 }, // °
+    { 17, 20, 20, 2, 20, 55, 6686 }, // ±
+    { 12, 16, 15, 2, 29, 31, 6741 }, // ²
+    { 12, 16, 15, 2, 29, 35, 6772 }, // ³
+    { 8, 6, 12, 3, 26, 11, 6807 }, // ´
+    { 20, 26, 20, -1, 18, 77, 6818 }, // µ
+    { 17, 31, 22, 3, 26, 134, 6895 }, // ¶
+    { 5, 6, 9, 2, 15, 7, 7029 }, // ·
+    { 7, 8, 7, -3, 0, 14, 7036 }, // ¸
+    { 8, 16, 13, 4, 29, 26, 7050 }, // ¹
+    { 11, 13, 14, 2, 25, 31, 7076 }, // º
+    { 15, 15, 16, 0, 16, 43, 7107 }, // »
+    { 22, 26, 25, 2, 25, 102, 7150 }, // ¼
+    { 24, 26, 27, 2, 25, 101, 7252 }, // ½
+    { 25, 26, 27, 1, 25, 113, 7353 }, // ¾
+    { 13, 26, 14, -1, 19, 51, 7466 }, // ¿
+    { 20, 32, 19, -2, 32, 96, 7517 }, // À
+    { 21, 32, 20, -2, 32, 98, 7613 }, // Á
+    { 20, 32, 19, -2, 32, 101, 7711 }, // Â
+    { 22, 31, 21, -2, 31, 101, 7812 }, // Ã
+    { 20, 31, 19, -2, 31, 94, 7913 }, // Ä
+    { 20, 34, 19, -2, 34, 104, 8007 }, // Å
+    { 31, 24, 30, -2, 24, 104, 8111 }, // Æ
+    { 20, 33, 23, 2, 25, 85, 8215 }, // Ç
+    { 18, 32, 20, 1, 32, 76, 8300 }, // È
+    { 18, 32, 20, 1, 32, 77, 8376 }, // É
+    { 18, 32, 20, 1, 32, 82, 8453 }, // Ê
+    { 18, 31, 20, 1, 31, 77, 8535 }, // Ë
+    { 14, 32, 14, -1, 32, 64, 8612 }, // Ì
+    { 16, 32, 16, -1, 32, 66, 8676 }, // Í
+    { 15, 32, 15, -1, 32, 70, 8742 }, // Î
+    { 15, 31, 15, -1, 31, 63, 8812 }, // Ï
+    { 21, 24, 23, 1, 24, 87, 8875 }, // Ð
+    { 23, 31, 25, 1, 31, 123, 8962 }, // Ñ
+    { 21, 33, 24, 2, 32, 106, 9085 }, // Ò
+    { 21, 33, 24, 2, 32, 105, 9191 }, // Ó
+    { 21, 33, 24, 2, 32, 109, 9296 }, // Ô
+    { 21, 32, 24, 2, 31, 109, 9405 }, // Õ
+    { 21, 32, 24, 2, 31, 105, 9514 }, // Ö
+    { 16, 16, 19, 2, 20, 47, 9619 }, // ×
+    { 23, 28, 25, 1, 26, 112, 9666 }, // Ø
+    { 21, 33, 24, 2, 32, 105, 9778 }, // Ù
+    { 21, 33, 24, 2, 32, 105, 9883 }, // Ú
+    { 21, 33, 24, 2, 32, 111, 9988 }, // Û
+    { 21, 32, 24, 2, 31, 103, 10099 }, // Ü
+    { 18, 32, 22, 3, 32, 78, 10202 }, // Ý
+    { 18, 24, 20, 1, 24, 66, 10280 }, // Þ
+    { 24, 34, 20, -5, 26, 121, 10346 }, // ß
+    { 18, 27, 20, 1, 26, 77, 10467 }, // à
+    { 18, 27, 20, 1, 26, 78, 10544 }, // á
+    { 18, 27, 20, 1, 26, 83, 10622 }, // â
+    { 18, 26, 20, 1, 25, 81, 10705 }, // ã
+    { 18, 26, 20, 1, 25, 77, 10786 }, // ä
+    { 18, 29, 20, 1, 28, 88, 10863 }, // å
+    { 26, 20, 28, 1, 19, 97, 10951 }, // æ
+    { 15, 27, 17, 1, 19, 61, 11048 }, // ç
+    { 15, 27, 17, 1, 26, 69, 11109 }, // è
+    { 16, 27, 18, 1, 26, 71, 11178 }, // é
+    { 15, 27, 17, 1, 26, 76, 11249 }, // ê
+    { 15, 26, 17, 1, 25, 67, 11325 }, // ë
+    { 9, 26, 10, 0, 26, 40, 11392 }, // ì
+    { 12, 26, 13, 0, 26, 44, 11432 }, // í
+    { 12, 26, 13, 0, 26, 48, 11476 }, // î
+    { 12, 25, 13, 0, 25, 45, 11524 }, // ï
+    { 18, 27, 20, 1, 26, 87, 11569 }, // ð
+    { 19, 25, 20, 0, 25, 78, 11656 }, // ñ
+    { 17, 27, 19, 1, 26, 73, 11734 }, // ò
+    { 17, 27, 19, 1, 26, 73, 11807 }, // ó
+    { 17, 27, 19, 1, 26, 79, 11880 }, // ô
+    { 17, 26, 19, 1, 25, 80, 11959 }, // õ
+    { 17, 26, 19, 1, 25, 74, 12039 }, // ö
+    { 17, 16, 20, 2, 20, 38, 12113 }, // ÷
+    { 18, 22, 19, 0, 20, 76, 12151 }, // ø
+    { 18, 27, 20, 1, 26, 74, 12227 }, // ù
+    { 18, 27, 20, 1, 26, 74, 12301 }, // ú
+    { 18, 27, 20, 1, 26, 81, 12375 }, // û
+    { 18, 26, 20, 1, 25, 74, 12456 }, // ü
+    { 22, 34, 19, -4, 26, 97, 12530 }, // ý
+    { 19, 34, 19, -1, 26, 97, 12627 }, // þ
+    { 22, 33, 19, -4, 25, 98, 12724 }, // ÿ
+    { 20, 29, 19, -2, 29, 92, 12822 }, // Ā
+    { 18, 24, 20, 1, 23, 74, 12914 }, // ā
+    { 21, 31, 20, -2, 31, 98, 12988 }, // Ă
+    { 18, 26, 20, 1, 25, 80, 13086 }, // ă
+    { 20, 32, 19, -2, 24, 96, 13166 }, // Ą
+    { 18, 27, 20, 1, 19, 78, 13262 }, // ą
+    { 20, 33, 23, 2, 32, 81, 13340 }, // Ć
+    { 15, 27, 17, 1, 26, 61, 13421 }, // ć
+    { 20, 33, 23, 2, 32, 86, 13482 }, // Ĉ
+    { 15, 27, 17, 1, 26, 63, 13568 }, // ĉ
+    { 20, 32, 23, 2, 31, 78, 13631 }, // Ċ
+    { 15, 26, 17, 1, 25, 57, 13709 }, // ċ
+    { 20, 33, 23, 2, 32, 87, 13766 }, // Č
+    { 16, 27, 18, 1, 26, 62, 13853 }, // č
+    { 21, 32, 23, 1, 32, 103, 13915 }, // Ď
+    { 25, 27, 27, 1, 26, 100, 14018 }, // ď
+    { 21, 24, 23, 1, 24, 87, 14118 }, // Đ
+    { 21, 27, 23, 1, 26, 90, 14205 }, // đ
+    { 18, 29, 20, 1, 29, 73, 14295 }, // Ē
+    { 15, 24, 17, 1, 23, 67, 14368 }, // ē
+    { 18, 31, 20, 1, 31, 80, 14435 }, // Ĕ
+    { 16, 26, 18, 1, 25, 72, 14515 }, // ĕ
+    { 18, 31, 20, 1, 31, 73, 14587 }, // Ė
+    { 15, 26, 17, 1, 25, 65, 14660 }, // ė
+    { 18, 32, 20, 1, 24, 77, 14725 }, // Ę
+    { 15, 27, 17, 1, 19, 71, 14802 }, // ę
+    { 18, 32, 20, 1, 32, 79, 14873 }, // Ě
+    { 16, 27, 18, 1, 26, 75, 14952 }, // ě
+    { 21, 33, 24, 2, 32, 106, 15027 }, // Ĝ
+    { 19, 34, 20, 0, 26, 105, 15133 }, // ĝ
+    { 21, 32, 24, 2, 31, 102, 15238 }, // Ğ
+    { 19, 33, 20, 0, 25, 104, 15340 }, // ğ
+    { 21, 32, 24, 2, 31, 96, 15444 }, // Ġ
+    { 19, 33, 20, 0, 25, 96, 15540 }, // ġ
+    { 21, 33, 24, 2, 25, 100, 15636 }, // Ģ
+    { 19, 34, 20, 0, 26, 99, 15736 }, // ģ
+    { 22, 32, 24, 1, 32, 112, 15835 }, // Ĥ
+    { 18, 33, 19, 0, 33, 93, 15947 }, // ĥ
+    { 25, 24, 27, 1, 24, 94, 16040 }, // Ħ
+    { 18, 26, 19, 0, 26, 76, 16134 }, // ħ
+    { 17, 31, 17, -1, 31, 68, 16210 }, // Ĩ
+    { 14, 25, 15, 0, 25, 56, 16278 }, // ĩ
+    { 15, 29, 15, -1, 29, 62, 16334 }, // Ī
+    { 12, 23, 13, 0, 23, 43, 16396 }, // ī
+    { 16, 31, 16, -1, 31, 66, 16439 }, // Ĭ
+    { 13, 25, 14, 0, 25, 55, 16505 }, // ĭ
+    { 14, 32, 14, -1, 24, 67, 16560 }, // Į
+    { 11, 33, 10, -2, 25, 50, 16627 }, // į
+    { 14, 31, 14, -1, 31, 60, 16677 }, // İ
+    { 8, 18, 9, 0, 18, 29, 16737 }, // ı
+    { 22, 31, 22, -1, 24, 98, 16766 }, // Ĳ
+    { 18, 33, 19, 0, 25, 89, 16864 }, // ĳ
+    { 20, 39, 15, -6, 32, 90, 16953 }, // Ĵ
+    { 17, 34, 13, -5, 26, 76, 17043 }, // ĵ
+    { 21, 32, 23, 1, 24, 95, 17119 }, // Ķ
+    { 18, 34, 19, 0, 26, 83, 17214 }, // ķ
+    { 18, 18, 19, 0, 18, 55, 17297 }, // ĸ
+    { 14, 32, 16, 1, 32, 70, 17352 }, // Ĺ
+    { 14, 33, 15, 0, 33, 65, 17422 }, // ĺ
+    { 13, 32, 16, 1, 24, 65, 17487 }, // Ļ
+    { 12, 34, 11, -2, 26, 56, 17552 }, // ļ
+    { 17, 24, 19, 1, 24, 60, 17608 }, // Ľ
+    { 15, 26, 16, 0, 26, 58, 17668 }, // ľ
+    { 14, 24, 16, 1, 24, 58, 17726 }, // Ŀ
+    { 12, 26, 13, 0, 26, 50, 17784 }, // ŀ
+    { 14, 24, 16, 0, 24, 56, 17834 }, // Ł
+    { 10, 26, 11, 0, 26, 43, 17890 }, // ł
+    { 23, 32, 25, 1, 32, 120, 17933 }, // Ń
+    { 18, 26, 19, 0, 26, 73, 18053 }, // ń
+    { 23, 32, 25, 1, 24, 119, 18126 }, // Ņ
+    { 18, 27, 19, 0, 19, 74, 18245 }, // ņ
+    { 23, 32, 25, 1, 32, 121, 18319 }, // Ň
+    { 19, 26, 20, 0, 26, 80, 18440 }, // ň
+    { 20, 24, 22, 1, 24, 74, 18520 }, // ŉ
+    { 23, 31, 25, 1, 24, 121, 18594 }, // Ŋ
+    { 18, 27, 19, 0, 19, 78, 18715 }, // ŋ
+    { 21, 30, 24, 2, 29, 102, 18793 }, // Ō
+    { 17, 24, 19, 1, 23, 71, 18895 }, // ō
+    { 21, 32, 24, 2, 31, 108, 18966 }, // Ŏ
+    { 17, 26, 19, 1, 25, 75, 19074 }, // ŏ
+    { 23, 33, 26, 2, 32, 118, 19149 }, // Ő
+    { 19, 27, 21, 1, 26, 86, 19267 }, // ő
+    { 28, 26, 31, 2, 25, 109, 19353 }, // Œ
+    { 27, 20, 29, 1, 19, 94, 19462 }, // œ
+    { 18, 32, 20, 1, 32, 88, 19556 }, // Ŕ
+    { 16, 26, 17, 0, 26, 57, 19644 }, // ŕ
+    { 18, 32, 20, 1, 24, 87, 19701 }, // Ŗ
+    { 17, 27, 16, -2, 19, 56, 19788 }, // ŗ
+    { 19, 32, 21, 1, 32, 95, 19844 }, // Ř
+    { 17, 26, 18, 0, 26, 62, 19939 }, // ř
+    { 18, 33, 19, 0, 32, 80, 20001 }, // Ś
+    { 15, 27, 16, 0, 26, 60, 20081 }, // ś
+    { 18, 33, 19, 0, 32, 84, 20141 }, // Ŝ
+    { 15, 27, 16, 0, 26, 65, 20225 }, // ŝ
+    { 18, 33, 19, 0, 25, 79, 20290 }, // Ş
+    { 14, 27, 15, 0, 19, 62, 20369 }, // ş
+    { 18, 33, 19, 0, 32, 82, 20431 }, // Š
+    { 16, 27, 17, 0, 26, 67, 20513 }, // š
+    { 18, 32, 21, 2, 24, 68, 20580 }, // Ţ
+    { 12, 30, 14, 1, 22, 58, 20648 }, // ţ
+    { 17, 32, 21, 3, 32, 71, 20706 }, // Ť
+    { 14, 27, 16, 1, 26, 60, 20777 }, // ť
+    { 18, 24, 21, 2, 24, 55, 20837 }, // Ŧ
+    { 13, 23, 14, 0, 22, 53, 20892 }, // ŧ
+    { 21, 32, 24, 2, 31, 108, 20945 }, // Ũ
+    { 18, 26, 20, 1, 25, 77, 21053 }, // ũ
+    { 21, 30, 24, 2, 29, 101, 21130 }, // Ū
+    { 18, 24, 20, 1, 23, 72, 21231 }, // ū
+    { 21, 32, 24, 2, 31, 106, 21303 }, // Ŭ
+    { 18, 26, 20, 1, 25, 77, 21409 }, // ŭ
+    { 21, 35, 24, 2, 34, 113, 21486 }, // Ů
+    { 18, 29, 20, 1, 28, 84, 21599 }, // ů
+    { 22, 33, 25, 2, 32, 113, 21683 }, // Ű
+    { 20, 27, 22, 1, 26, 84, 21796 }, // ű
+    { 21, 32, 24, 2, 24, 104, 21880 }, // Ų
+    { 18, 26, 20, 1, 18, 74, 21984 }, // ų
+    { 29, 32, 33, 3, 32, 152, 22058 }, // Ŵ
+    { 25, 26, 27, 1, 26, 116, 22210 }, // ŵ
+    { 18, 32, 22, 3, 32, 83, 22326 }, // Ŷ
+    { 22, 34, 19, -4, 26, 98, 22409 }, // ŷ
+    { 18, 31, 22, 3, 31, 80, 22507 }, // Ÿ
+    { 21, 32, 21, -1, 32, 79, 22587 }, // Ź
+    { 17, 26, 17, -1, 26, 61, 22666 }, // ź
+    { 21, 31, 21, -1, 31, 75, 22727 }, // Ż
+    { 16, 25, 16, -1, 25, 56, 22802 }, // ż
+    { 21, 32, 21, -1, 32, 80, 22858 }, // Ž
+    { 17, 26, 17, -1, 26, 62, 22938 }, // ž
+    { 20, 34, 16, -5, 26, 77, 23000 }, // ſ
+    { 26, 27, 29, 2, 26, 102, 23077 }, // Ơ
+    { 22, 22, 24, 1, 21, 73, 23179 }, // ơ
+    { 31, 26, 34, 2, 25, 134, 23252 }, // Ƣ
+    { 24, 27, 27, 1, 19, 111, 23386 }, // ƣ
+    { 20, 24, 23, 2, 24, 72, 23497 }, // Ƥ
+    { 19, 34, 19, -1, 26, 99, 23569 }, // ƥ
+    { 18, 28, 20, 1, 24, 81, 23668 }, // Ʀ
+    { 18, 26, 19, 0, 25, 65, 23749 }, // Ƨ
+    { 15, 20, 16, 0, 19, 51, 23814 }, // ƨ
+    { 21, 24, 21, -1, 24, 65, 23865 }, // Ʃ
+    { 9, 34, 10, 0, 26, 59, 23930 }, // ƪ
+    { 12, 30, 14, 1, 22, 58, 23989 }, // ƫ
+    { 19, 24, 22, 2, 24, 59, 24047 }, // Ƭ
+    { 12, 27, 14, 1, 26, 52, 24106 }, // ƭ
+    { 17, 32, 21, 3, 24, 70, 24158 }, // Ʈ
+    { 27, 27, 30, 2, 26, 108, 24228 }, // Ư
+    { 24, 22, 26, 1, 21, 80, 24336 }, // ư
+    { 6, 6, 0, -13, 26, 10, 24416 }, // ̀
+    { 8, 6, 1, -8, 26, 10, 24426 }, // ́
+    { 11, 6, 9, -3, 26, 15, 24436 }, // ̂
+    { 13, 5, 0, -14, 25, 17, 24451 }, // ̃
+    { 11, 3, 9, -3, 23, 10, 24468 }, // ̄
+    { 14, 4, 12, -3, 29, 13, 24478 }, // ̅
+    { 10, 5, 9, -2, 25, 15, 24491 }, // ̆
+    { 4, 5, 6, 1, 25, 7, 24506 }, // ̇
+    { 10, 4, 9, -2, 25, 13, 24513 }, // ̈
+    { 7, 9, 0, -10, 28, 17, 24526 }, // ̉
+    { 8, 8, 8, -1, 28, 18, 24543 }, // ̊
+    { 13, 6, 12, -2, 26, 20, 24561 }, // ̋
+    { 11, 6, 10, -2, 26, 14, 24581 }, // ̌
+    { 6, 10, 7, 0, 26, 16, 24595 }, // ̍
+    { 10, 7, 9, -2, 26, 20, 24611 }, // ̎
+    { 12, 6, 0, -17, 26, 20, 24631 }, // ̏
+    { 11, 9, 10, -2, 29, 21, 24651 }, // ̐
+    { 11, 5, 9, -3, 25, 13, 24672 }, // ̑
+    { 7, 9, 7, -1, 24, 16, 24685 }, // ̒
+    { 7, 9, 7, -1, 24, 15, 24701 }, // ̓
+    { 5, 9, 6, 0, 24, 12, 24716 }, // ̔
+    { 7, 9, 7, -1, 24, 15, 24728 }, // ̕
+    { 7, 6, 1, -7, -1, 11, 24743 }, // ̖
+    { 8, 6, 4, -5, -1, 12, 24754 }, // ̗
+    { 8, 8, 3, -6, 0, 13, 24766 }, // ̘
+    { 8, 8, 2, -7, 0, 13, 24779 }, // ̙
+    { 10, 10, 14, 3, 26, 22, 24792 }, // ̚
+    { 8, 8, 7, -2, 26, 14, 24814 }, // ̛
+    { 5, 8, 4, -2, 0, 12, 24828 }, // ̜
+    { 8, 6, 2, -7, -1, 12, 24840 }, // ̝
+    { 8, 6, 3, -6, -1, 14, 24852 }, // ̞
+    { 9, 8, 3, -7, 0, 14, 24866 }, // ̟
+    { 8, 3, 2, -7, -2, 4, 24880 }, // ̠
+    { 8, 10, 2, -7, 2, 18, 24884 }, // ̡
+    { 7, 10, 4, -4, 2, 17, 24902 }, // ̢
+    { 4, 4, 0, -14, -2, 6, 24919 }, // ̣
+    { 10, 4, 3, -8, -2, 10, 24925 }, // ̤
+    { 8, 8, 2, -7, 0, 19, 24935 }, // ̥
+    { 6, 6, 9, 2, -2, 10, 24954 }, // ̦
+    { 7, 8, 2, -6, 0, 14, 24964 }, // ̧
+    { 6, 8, 2, -5, 0, 11, 24978 }, // ̨
+    { 5, 10, 1, -5, -1, 17, 24989 }, // ̩
+    { 14, 7, 5, -10, -1, 27, 25006 }, // ̪
+    { 14, 4, 6, -9, -2, 16, 25033 }, // ̫
+    { 11, 6, 5, -7, -1, 16, 25049 }, // ̬
+    { 11, 6, 4, -8, -1, 15, 25065 }, // ̭
+    { 10, 5, 4, -7, -1, 13, 25080 }, // ̮
+    { 11, 5, 4, -8, -1, 13, 25093 }, // ̯
+    { 13, 5, 5, -9, -1, 16, 25106 }, // ̰
+    { 10, 3, 3, -8, -2, 9, 25122 }, // ̱
+    { 15, 3, 6, -10, -3, 7, 25131 }, // ̲
+    { 15, 8, 6, -10, 0, 26, 25138 }, // ̳
+    { 14, 5, 8, -7, 12, 18, 25164 }, // ̴
+    { 14, 4, 8, -7, 12, 13, 25182 }, // ̵
+    { 24, 3, 13, -12, 11, 27, 25195 }, // ̶
+    { 10, 8, 6, -5, 14, 14, 25222 }, // ̷
+    { 20, 28, 11, -10, 26, 62, 25236 }, // ̸
+    { 5, 8, 4, -2, 0, 13, 25298 }, // ̹
+    { 14, 7, 5, -10, -1, 27, 25311 }, // ̺
+    { 14, 8, 5, -10, 0, 27, 25338 }, // ̻
+    { 13, 4, 5, -9, -2, 16, 25365 }, // ̼
+    { 8, 7, 8, -1, 26, 15, 25381 }, // ̽
+    { 8, 10, 8, -1, 29, 17, 25396 }, // ̾
+    { 15, 8, 13, -3, 33, 26, 25413 }, // ̿
+    { 7, 6, 6, -2, 26, 10, 25439 }, // ̀
+    { 8, 6, 10, 1, 26, 12, 25449 }, // ́
+    { 13, 5, 19, 5, 25, 19, 25461 }, // ͂
+    { 5, 6, 7, 1, 26, 10, 25480 }, // ̓
+    { 13, 6, 11, -3, 26, 22, 25490 }, // ̈́
+    { 6, 6, 3, -4, -2, 11, 25512 }, // ͅ
+    { 16, 7, 12, -5, 26, 30, 25523 }, // ͆
+    { 16, 8, 7, -10, 0, 27, 25553 }, // ͇
+    { 10, 7, 3, -8, -1, 20, 25580 }, // ͈
+    { 8, 6, 3, -6, -2, 10, 25600 }, // ͉
+    { 14, 8, 11, -4, 26, 26, 25610 }, // ͊
+    { 13, 12, 11, -3, 31, 31, 25636 }, // ͋
+    { 13, 9, 11, -3, 29, 30, 25667 }, // ͌
+    { 13, 7, 5, -9, -1, 18, 25697 }, // ͍
+    { 7, 8, 2, -6, 0, 13, 25715 }, // ͎
+    { 24, 24, 13, -12, 24, 96, 25728 }, // ͏
+    { 6, 8, 7, 0, 27, 12, 25824 }, // ͐
+    { 5, 8, 10, 4, 28, 12, 25836 }, // ͑
+    { 10, 9, 9, -2, 29, 22, 25848 }, // ͒
+    { 8, 7, 3, -6, -1, 13, 25870 }, // ͓
+    { 6, 7, 2, -5, -1, 12, 25883 }, // ͔
+    { 7, 7, 3, -5, -1, 12, 25895 }, // ͕
+    { 13, 7, 6, -8, -1, 26, 25907 }, // ͖
+    { 5, 8, 9, 3, 28, 11, 25933 }, // ͗
+    { 4, 5, 6, 1, 25, 6, 25944 }, // ͘
+    { 9, 7, 3, -7, -1, 18, 25950 }, // ͙
+    { 13, 8, 5, -9, 0, 29, 25968 }, // ͚
+    { 7, 8, 8, 0, 27, 11, 25997 }, // ͛
+    { 24, 7, 11, -14, -1, 29, 26008 }, // ͜
+    { 24, 7, 16, -9, 26, 29, 26037 }, // ͝
+    { 18, 3, 13, -6, 23, 16, 26066 }, // ͞
+    { 17, 3, 7, -11, -2, 15, 26082 }, // ͟
+    { 26, 5, 17, -10, 25, 28, 26097 }, // ͠
+    { 24, 7, 16, -9, 29, 27, 26125 }, // ͡
+    { 25, 7, 10, -16, -1, 21, 26152 }, // ͢
+    { 9, 8, 9, -1, 28, 21, 26173 }, // ͣ
+    { 7, 8, 8, 0, 28, 19, 26194 }, // ͤ
+    { 5, 11, 7, 1, 31, 14, 26213 }, // ͥ
+    { 8, 8, 8, -1, 28, 22, 26227 }, // ͦ
+    { 9, 8, 9, -1, 28, 22, 26249 }, // ͧ
+    { 7, 8, 8, 0, 28, 15, 26271 }, // ͨ
+    { 9, 11, 9, -1, 31, 26, 26286 }, // ͩ
+    { 8, 11, 8, -1, 31, 26, 26312 }, // ͪ
+    { 12, 8, 10, -3, 28, 35, 26338 }, // ͫ
+    { 7, 8, 8, 0, 28, 13, 26373 }, // ͬ
+    { 6, 10, 8, 1, 30, 15, 26386 }, // ͭ
+    { 8, 8, 9, 0, 28, 19, 26401 }, // ͮ
+    { 9, 8, 9, -1, 28, 19, 26420 }, // ͯ
+    { 20, 24, 19, -2, 24, 78, 26439 }, // Α
+    { 19, 24, 21, 1, 24, 79, 26517 }, // Β
+    { 18, 24, 20, 1, 24, 51, 26596 }, // Γ
+    { 21, 24, 20, -2, 24, 82, 26647 }, // Δ
+    { 18, 24, 20, 1, 24, 61, 26729 }, // Ε
+    { 21, 24, 21, -1, 24, 61, 26790 }, // Ζ
+    { 22, 24, 24, 1, 24, 88, 26851 }, // Η
+    { 21, 26, 24, 2, 25, 97, 26939 }, // Θ
+    { 14, 24, 14, -1, 24, 50, 27036 }, // Ι
+    { 21, 24, 23, 1, 24, 78, 27086 }, // Κ
+    { 20, 24, 19, -2, 24, 75, 27164 }, // Λ
+    { 28, 24, 30, 1, 24, 128, 27239 }, // Μ
+    { 23, 24, 25, 1, 24, 101, 27367 }, // Ν
+    { 20, 24, 20, -1, 24, 54, 27468 }, // Ξ
+    { 21, 26, 24, 2, 25, 89, 27522 }, // Ο
+    { 22, 24, 24, 1, 24, 85, 27611 }, // Π
+    { 18, 24, 20, 1, 24, 66, 27696 }, // Ρ
+    { 21, 24, 21, -1, 24, 65, 27762 }, // Σ
+    { 17, 24, 21, 3, 24, 50, 27827 }, // Τ
+    { 18, 24, 22, 3, 24, 63, 27877 }, // Υ
+    { 26, 24, 29, 2, 24, 101, 27940 }, // Φ
+    { 23, 24, 22, -2, 24, 80, 28041 }, // Χ
+    { 25, 24, 29, 3, 24, 95, 28121 }, // Ψ
+    { 24, 25, 24, -1, 25, 94, 28216 }, // Ω
+    { 18, 20, 20, 1, 19, 67, 28310 }, // α
+    { 20, 34, 20, -1, 26, 104, 28377 }, // β
+    { 15, 25, 17, 1, 18, 65, 28481 }, // γ
+    { 18, 27, 20, 1, 26, 79, 28546 }, // δ
+    { 15, 20, 16, 0, 19, 48, 28625 }, // ε
+    { 17, 33, 18, 0, 26, 76, 28673 }, // ζ
+    { 18, 27, 19, 0, 19, 77, 28749 }, // η
+    { 17, 27, 19, 1, 26, 87, 28826 }, // θ
+    { 8, 19, 10, 1, 18, 32, 28913 }, // ι
+    { 18, 18, 19, 0, 18, 55, 28945 }, // κ
+    { 18, 27, 18, -2, 26, 73, 29000 }, // λ
+    { 20, 26, 20, -1, 18, 79, 29073 }, // μ
+    { 15, 18, 17, 1, 18, 52, 29152 }, // ν
+    { 17, 33, 19, 1, 26, 79, 29204 }, // ξ
+    { 17, 20, 19, 1, 19, 60, 29283 }, // ο
+    { 21, 19, 23, 1, 18, 61, 29343 }, // π
+    { 18, 27, 18, -1, 19, 74, 29404 }, // ρ
+    { 15, 26, 17, 1, 19, 57, 29478 }, // ς
+    { 19, 19, 21, 1, 18, 60, 29535 }, // σ
+    { 15, 19, 17, 1, 18, 44, 29595 }, // τ
+    { 17, 19, 19, 1, 18, 54, 29639 }, // υ
+    { 21, 27, 23, 1, 19, 102, 29693 }, // φ
+    { 22, 26, 21, -2, 18, 85, 29795 }, // χ
+    { 22, 34, 24, 1, 26, 116, 29880 }, // ψ
+    { 24, 19, 26, 1, 18, 81, 29996 }, // ω
+    { 20, 30, 19, -2, 24, 90, 30077 }, // Ạ
+    { 18, 25, 20, 1, 19, 72, 30167 }, // ạ
+    { 20, 33, 19, -2, 33, 100, 30239 }, // Ả
+    { 18, 29, 20, 1, 28, 83, 30339 }, // ả
+    { 25, 33, 24, -2, 33, 113, 30422 }, // Ấ
+    { 21, 29, 23, 1, 28, 90, 30535 }, // ấ
+    { 20, 33, 19, -2, 33, 102, 30625 }, // Ầ
+    { 18, 29, 20, 1, 28, 87, 30727 }, // ầ
+    { 24, 35, 23, -2, 35, 116, 30814 }, // Ẩ
+    { 20, 30, 22, 1, 29, 94, 30930 }, // ẩ
+    { 23, 36, 22, -2, 36, 116, 31024 }, // Ẫ
+    { 18, 31, 20, 1, 30, 95, 31140 }, // ẫ
+    { 20, 38, 19, -2, 32, 113, 31235 }, // Ậ
+    { 18, 32, 20, 1, 26, 93, 31348 }, // ậ
+    { 21, 35, 20, -2, 35, 110, 31441 }, // Ắ
+    { 18, 30, 20, 1, 29, 90, 31551 }, // ắ
+    { 21, 35, 20, -2, 35, 110, 31641 }, // Ằ
+    { 18, 30, 20, 1, 29, 89, 31751 }, // ằ
+    { 21, 36, 20, -2, 36, 113, 31840 }, // Ẳ
+    { 18, 31, 20, 1, 30, 93, 31953 }, // ẳ
+    { 22, 36, 21, -2, 36, 118, 32046 }, // Ẵ
+    { 18, 31, 20, 1, 30, 96, 32164 }, // ẵ
+    { 21, 37, 20, -2, 31, 111, 32260 }, // Ặ
+    { 18, 31, 20, 1, 25, 90, 32371 }, // ặ
+    { 18, 30, 20, 1, 24, 73, 32461 }, // Ẹ
+    { 15, 25, 17, 1, 19, 65, 32534 }, // ẹ
+    { 18, 33, 20, 1, 33, 82, 32599 }, // Ẻ
+    { 15, 29, 17, 1, 28, 76, 32681 }, // ẻ
+    { 19, 31, 21, 1, 31, 80, 32757 }, // Ẽ
+    { 17, 26, 19, 1, 25, 74, 32837 }, // ẽ
+    { 22, 33, 24, 1, 33, 101, 32911 }, // Ế
+    { 20, 29, 22, 1, 28, 87, 33012 }, // ế
+    { 18, 33, 20, 1, 33, 85, 33099 }, // Ề
+    { 15, 29, 17, 1, 28, 77, 33184 }, // ề
+    { 21, 35, 23, 1, 35, 101, 33261 }, // Ể
+    { 19, 30, 21, 1, 29, 87, 33362 }, // ể
+    { 19, 36, 21, 1, 36, 95, 33449 }, // Ễ
+    { 18, 31, 20, 1, 30, 88, 33544 }, // ễ
+    { 18, 38, 20, 1, 32, 94, 33632 }, // Ệ
+    { 15, 32, 17, 1, 26, 85, 33726 }, // ệ
+    { 15, 33, 15, -1, 33, 68, 33811 }, // Ỉ
+    { 12, 28, 13, 0, 28, 49, 33879 }, // ỉ
+    { 14, 30, 14, -1, 24, 60, 33928 }, // Ị
+    { 10, 31, 10, -1, 25, 44, 33988 }, // ị
+    { 21, 31, 24, 2, 25, 101, 34032 }, // Ọ
+    { 17, 25, 19, 1, 19, 69, 34133 }, // ọ
+    { 21, 34, 24, 2, 33, 111, 34202 }, // Ỏ
+    { 17, 29, 19, 1, 28, 81, 34313 }, // ỏ
+    { 24, 34, 27, 2, 33, 120, 34394 }, // Ố
+    { 20, 29, 22, 1, 28, 87, 34514 }, // ố
+    { 21, 34, 24, 2, 33, 115, 34601 }, // Ồ
+    { 17, 29, 19, 1, 28, 83, 34716 }, // ồ
+    { 23, 36, 26, 2, 35, 124, 34799 }, // Ổ
+    { 19, 30, 21, 1, 29, 89, 34923 }, // ổ
+    { 21, 37, 24, 2, 36, 123, 35012 }, // Ỗ
+    { 18, 31, 20, 1, 30, 88, 35135 }, // ỗ
+    { 21, 38, 24, 2, 32, 121, 35223 }, // Ộ
+    { 17, 32, 19, 1, 26, 88, 35344 }, // ộ
+    { 26, 33, 29, 2, 32, 119, 35432 }, // Ớ
+    { 22, 27, 24, 1, 26, 87, 35551 }, // ớ
+    { 26, 33, 29, 2, 32, 118, 35638 }, // Ờ
+    { 22, 27, 24, 1, 26, 86, 35756 }, // ờ
+    { 26, 34, 29, 2, 33, 125, 35842 }, // Ở
+    { 22, 29, 24, 1, 28, 94, 35967 }, // ở
+    { 26, 32, 29, 2, 31, 120, 36061 }, // Ỡ
+    { 22, 26, 24, 1, 25, 92, 36181 }, // ỡ
+    { 26, 32, 29, 2, 26, 114, 36273 }, // Ợ
+    { 22, 27, 24, 1, 21, 84, 36387 }, // ợ
+    { 21, 30, 24, 2, 24, 99, 36471 }, // Ụ
+    { 18, 24, 20, 1, 18, 69, 36570 }, // ụ
+    { 21, 34, 24, 2, 33, 110, 36639 }, // Ủ
+    { 18, 29, 20, 1, 28, 80, 36749 }, // ủ
+    { 27, 33, 30, 2, 32, 125, 36829 }, // Ứ
+    { 24, 27, 26, 1, 26, 95, 36954 }, // ứ
+    { 27, 33, 30, 2, 32, 126, 37049 }, // Ừ
+    { 24, 27, 26, 1, 26, 94, 37175 }, // ừ
+    { 27, 34, 30, 2, 33, 130, 37269 }, // Ử
+    { 24, 29, 26, 1, 28, 101, 37399 }, // ử
+    { 27, 32, 30, 2, 31, 128, 37500 }, // Ữ
+    { 24, 26, 26, 1, 25, 97, 37628 }, // ữ
+    { 27, 32, 30, 2, 26, 121, 37725 }, // Ự
+    { 24, 27, 26, 1, 21, 93, 37846 }, // ự
+    { 18, 32, 22, 3, 32, 78, 37939 }, // Ỳ
+    { 22, 34, 19, -4, 26, 96, 38017 }, // ỳ
+    { 18, 30, 22, 3, 24, 74, 38113 }, // Ỵ
+    { 22, 26, 19, -4, 18, 82, 38187 }, // ỵ
+    { 18, 33, 22, 3, 33, 83, 38269 }, // Ỷ
+    { 22, 36, 19, -4, 28, 103, 38352 }, // ỷ
+    { 18, 31, 22, 3, 31, 84, 38455 }, // Ỹ
+    { 22, 33, 19, -4, 25, 101, 38539 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 38640 }, //  
+    { 0, 0, 33, 0, 0, 0, 38640 }, //  
+    { 0, 0, 17, 0, 0, 0, 38640 }, //  
+    { 0, 0, 33, 0, 0, 0, 38640 }, //  
+    { 0, 0, 11, 0, 0, 0, 38640 }, //  
+    { 0, 0, 8, 0, 0, 0, 38640 }, //  
+    { 0, 0, 6, 0, 0, 0, 38640 }, //  
+    { 0, 0, 18, 0, 0, 0, 38640 }, //  
+    { 0, 0, 9, 0, 0, 0, 38640 }, //  
+    { 0, 0, 6, 0, 0, 0, 38640 }, //  
+    { 0, 0, 3, 0, 0, 0, 38640 }, //  
+    { 0, 0, 1, 0, 0, 0, 38640 }, // ​
+    { 0, 0, 1, 0, 0, 0, 38640 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 38640 }, // ‍
+    { 9, 28, 9, -1, 23, 45, 38640 }, // ‎
+    { 9, 28, 2, -8, 23, 46, 38685 }, // ‏
+    { 10, 4, 11, 0, 11, 13, 38731 }, // ‐
+    { 10, 4, 11, 0, 11, 13, 38744 }, // ‑
+    { 17, 4, 19, 1, 14, 16, 38757 }, // ‒
+    { 15, 4, 16, 0, 11, 21, 38773 }, // –
+    { 31, 4, 32, 0, 11, 41, 38794 }, // —
+    { 31, 4, 32, 0, 11, 41, 38835 }, // ―
+    { 10, 35, 18, 5, 26, 103, 38876 }, // ‖
+    { 16, 8, 13, -4, 0, 26, 38979 }, // ‗
+    { 7, 9, 10, 2, 24, 15, 39005 }, // ‘
+    { 7, 9, 10, 2, 24, 14, 39020 }, // ’
+    { 7, 9, 8, -2, 4, 14, 39034 }, // ‚
+    { 5, 9, 9, 3, 24, 12, 39048 }, // ‛
+    { 13, 9, 16, 2, 24, 29, 39060 }, // “
+    { 13, 9, 16, 2, 24, 28, 39089 }, // ”
+    { 14, 9, 14, -2, 4, 26, 39117 }, // „
+    { 10, 9, 14, 3, 24, 28, 39143 }, // ‟
+    { 13, 26, 17, 3, 26, 59, 39171 }, // †
+    { 16, 26, 18, 1, 26, 66, 39230 }, // ‡
+    { 8, 9, 13, 3, 17, 18, 39296 }, // •
+    { 11, 11, 13, 1, 18, 19, 39314 }, // ‣
+    { 5, 6, 17, 4, 5, 7, 39333 }, // ․
+    { 14, 6, 17, 0, 5, 15, 39340 }, // ‥
+    { 22, 6, 26, 0, 5, 24, 39355 }, // …
+    { 5, 6, 9, 2, 12, 8, 39379 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 39387 }, //  
+    { 0, 0, 20, 0, 0, 0, 39387 }, //  
+    { 9, 26, 9, -1, 21, 39, 39387 }, // ‪
+    { 9, 26, 2, -8, 21, 39, 39426 }, // ‫
+    { 8, 28, 5, -4, 23, 39, 39465 }, // ‬
+    { 8, 28, 5, -4, 23, 44, 39504 }, // ‭
+    { 8, 28, 5, -4, 23, 44, 39548 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 39592 }, //  
+    { 35, 26, 38, 2, 25, 179, 39592 }, // ‰
+    { 45, 26, 48, 2, 25, 228, 39771 }, // ‱
+    { 8, 9, 11, 2, 24, 15, 39999 }, // ′
+    { 14, 9, 17, 2, 24, 28, 40014 }, // ″
+    { 19, 9, 22, 2, 24, 41, 40042 }, // ‴
+    { 5, 9, 10, 4, 24, 15, 40083 }, // ‵
+    { 11, 9, 16, 4, 24, 28, 40098 }, // ‶
+    { 16, 9, 21, 4, 24, 42, 40126 }, // ‷
+    { 13, 11, 13, -3, 3, 30, 40168 }, // ‸
+    { 9, 15, 11, 1, 16, 23, 40198 }, // ‹
+    { 9, 15, 10, 0, 16, 23, 40221 }, // ›
+    { 26, 26, 28, 1, 25, 97, 40244 }, // ※
+    { 17, 25, 18, 0, 24, 71, 40341 }, // ‼
+    { 14, 26, 17, 2, 25, 60, 40412 }, // ‽
+    { 15, 3, 19, 3, 28, 18, 40472 }, // ‾
+    { 18, 7, 18, -2, -1, 23, 40490 }, // ‿
+    { 18, 8, 21, 2, 27, 28, 40513 }, // ⁀
+    { 16, 22, 13, -4, 14, 53, 40541 }, // ⁁
+    { 36, 31, 37, 0, 26, 164, 40594 }, // ⁂
+    { 9, 4, 10, 0, 11, 10, 40758 }, // ⁃
+    { 21, 24, 14, -8, 24, 63, 40768 }, // ⁄
+    { 14, 30, 14, -1, 24, 64, 40831 }, // ⁅
+    { 14, 30, 12, -3, 24, 66, 40895 }, // ⁆
+    { 28, 26, 31, 2, 25, 105, 40961 }, // ⁇
+    { 22, 26, 25, 2, 25, 87, 41066 }, // ⁈
+    { 24, 26, 25, 0, 25, 91, 41153 }, // ⁉
+    { 17, 18, 20, 2, 18, 44, 41244 }, // ⁊
+    { 17, 31, 21, 3, 26, 113, 41288 }, // ⁋
+    { 18, 17, 21, 1, 18, 73, 41401 }, // ⁌
+    { 18, 17, 21, 2, 18, 65, 41474 }, // ⁍
+    { 17, 16, 18, -1, 9, 46, 41539 }, // ⁎
+    { 7, 24, 9, 1, 19, 24, 41585 }, // ⁏
+    { 22, 35, 21, -2, 27, 80, 41609 }, // ⁐
+    { 19, 33, 20, 0, 26, 101, 41689 }, // ⁑
+    { 13, 26, 14, 0, 25, 60, 41790 }, // ⁒
+    { 29, 6, 33, 3, 13, 34, 41850 }, // ⁓
+    { 18, 8, 18, -3, 0, 25, 41884 }, // ⁔
+    { 18, 18, 19, 0, 17, 67, 41909 }, // ⁕
+    { 15, 26, 17, 1, 25, 41, 41976 }, // ⁖
+    { 25, 9, 28, 2, 24, 56, 42017 }, // ⁗
+    { 25, 26, 27, 1, 25, 60, 42073 }, // ⁘
+    { 25, 26, 28, 1, 25, 66, 42133 }, // ⁙
+    { 5, 26, 7, 1, 25, 19, 42199 }, // ⁚
+    { 20, 26, 22, 1, 25, 54, 42218 }, // ⁛
+    { 25, 26, 27, 1, 25, 99, 42272 }, // ⁜
+    { 5, 25, 9, 2, 24, 25, 42371 }, // ⁝
+    { 5, 26, 9, 3, 25, 30, 42396 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 42426 }, //  
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 42426 }, // ⁩
+    { 8, 28, 5, -4, 23, 44, 42426 }, // ⁪
+    { 8, 28, 5, -4, 23, 46, 42470 }, // ⁫
+    { 8, 28, 5, -4, 23, 43, 42516 }, // ⁬
+    { 8, 29, 5, -4, 24, 44, 42559 }, // ⁭
+    { 8, 28, 5, -4, 23, 46, 42603 }, // ⁮
+    { 8, 28, 5, -4, 23, 43, 42649 }, // ⁯
+    { 11, 16, 15, 3, 29, 44, 42692 }, // ⁰
+    { 6, 16, 9, 2, 25, 22, 42736 }, // ⁱ
+    { 12, 16, 15, 2, 29, 35, 42758 }, // ⁴
+    { 11, 16, 15, 3, 29, 34, 42793 }, // ⁵
+    { 11, 16, 15, 3, 29, 43, 42827 }, // ⁶
+    { 12, 16, 16, 3, 29, 26, 42870 }, // ⁷
+    { 12, 16, 15, 2, 29, 45, 42896 }, // ⁸
+    { 11, 16, 15, 3, 29, 40, 42941 }, // ⁹
+    { 10, 10, 14, 3, 25, 17, 42981 }, // ⁺
+    { 10, 3, 14, 3, 22, 8, 42998 }, // ⁻
+    { 10, 6, 14, 3, 23, 13, 43006 }, // ⁼
+    { 9, 18, 13, 3, 30, 28, 43019 }, // ⁽
+    { 8, 18, 9, 0, 30, 28, 43047 }, // ⁾
+    { 12, 12, 15, 2, 21, 37, 43075 }, // ⁿ
+    { 11, 16, 12, -1, 11, 44, 43112 }, // ₀
+    { 7, 16, 12, 1, 11, 25, 43156 }, // ₁
+    { 12, 16, 12, -2, 11, 30, 43181 }, // ₂
+    { 12, 16, 12, -2, 11, 36, 43211 }, // ₃
+    { 12, 16, 12, -2, 11, 35, 43247 }, // ₄
+    { 11, 16, 12, -1, 11, 32, 43282 }, // ₅
+    { 11, 16, 12, -1, 11, 40, 43314 }, // ₆
+    { 12, 16, 12, -1, 11, 27, 43354 }, // ₇
+    { 11, 16, 12, -1, 11, 48, 43381 }, // ₈
+    { 11, 16, 12, -1, 11, 41, 43429 }, // ₉
+    { 10, 10, 11, -1, 7, 19, 43470 }, // ₊
+    { 10, 3, 11, -1, 4, 8, 43489 }, // ₋
+    { 10, 6, 11, -1, 5, 12, 43497 }, // ₌
+    { 8, 18, 9, 0, 12, 28, 43509 }, // ₍
+    { 8, 18, 6, -4, 12, 27, 43537 }, // ₎
+    { 12, 12, 12, -1, 8, 38, 43564 }, // ₐ
+    { 10, 12, 11, -1, 8, 31, 43602 }, // ₑ
+    { 11, 12, 12, -1, 8, 36, 43633 }, // ₒ
+    { 13, 12, 11, -3, 8, 30, 43669 }, // ₓ
+    { 10, 12, 11, -2, 8, 29, 43699 }, // ₔ
+    { 11, 16, 15, 0, 12, 44, 43728 }, // ₕ
+    { 11, 16, 12, 0, 12, 42, 43772 }, // ₖ
+    { 6, 16, 8, 0, 12, 24, 43814 }, // ₗ
+    { 18, 12, 21, 0, 8, 54, 43838 }, // ₘ
+    { 12, 12, 13, -2, 8, 36, 43892 }, // ₙ
+    { 13, 16, 13, -3, 8, 45, 43928 }, // ₚ
+    { 9, 12, 10, -1, 8, 24, 43973 }, // ₛ
+    { 8, 14, 8, -1, 10, 24, 43997 }, // ₜ
+    { 17, 25, 20, 2, 25, 73, 44021 }, // ₠
+    { 19, 28, 21, 1, 26, 109, 44094 }, // ₡
+    { 18, 26, 21, 2, 25, 78, 44203 }, // ₢
+    { 20, 24, 21, 0, 24, 64, 44281 }, // ₣
+    { 21, 25, 21, -1, 25, 80, 44345 }, // ₤
+    { 28, 27, 29, 0, 23, 118, 44425 }, // ₥
+    { 20, 24, 21, 0, 24, 96, 44543 }, // ₦
+    { 24, 25, 25, 0, 24, 97, 44639 }, // ₧
+    { 27, 25, 28, 0, 24, 115, 44736 }, // ₨
+    { 24, 24, 25, 0, 24, 118, 44851 }, // ₩
+    { 28, 24, 29, 0, 24, 135, 44969 }, // ₪
+    { 22, 32, 23, 0, 26, 108, 45104 }, // ₫
+    { 20, 26, 22, 1, 25, 71, 45212 }, // €
+    { 21, 24, 23, 1, 24, 82, 45283 }, // ₭
+    { 19, 24, 21, 1, 24, 65, 45365 }, // ₮
+    { 32, 33, 33, 0, 25, 150, 45430 }, // ₯
+    { 21, 33, 20, -2, 25, 105, 45580 }, // ₰
+    { 20, 24, 22, 1, 24, 86, 45685 }, // ₱
+    { 21, 29, 24, 2, 26, 108, 45771 }, // ₲
+    { 22, 24, 21, -2, 24, 79, 45879 }, // ₳
+    { 20, 26, 20, -1, 25, 89, 45958 }, // ₴
+    { 20, 29, 23, 2, 26, 95, 46047 }, // ₵
+    { 21, 23, 22, 0, 22, 82, 46142 }, // ₶
+    { 24, 28, 24, -1, 25, 115, 46224 }, // ₷
+    { 17, 24, 20, 2, 24, 59, 46339 }, // ₸
+    { 17, 24, 21, 3, 24, 59, 46398 }, // ₹
+    { 19, 25, 20, 0, 24, 80, 46457 }, // ₺
+    { 22, 26, 24, 1, 25, 100, 46537 }, // ₻
+    { 24, 24, 25, -1, 24, 88, 46637 }, // ₼
+    { 21, 24, 21, -1, 24, 79, 46725 }, // ₽
+    { 22, 28, 22, -1, 28, 96, 46804 }, // ₾
+    { 18, 32, 20, 1, 28, 99, 46900 }, // ₿
+    { 10, 4, 11, 0, 11, 13, 46999 }, // −
+    { 31, 32, 33, 1, 26, 132, 47012 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
@@ -5437,4 +3768,5 @@ static const EpdFontData notosans_16_italic = {
     36,
     -10,
     true,
+    true,
 };
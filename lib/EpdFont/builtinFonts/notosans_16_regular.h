@@ -2,5089 +2,3615 @@
  * generated by fontconvert.py
  * name: notosans_16_regular
  * size: 16
- * mode: 2-bit
- * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_regularBitmaps[68736] = {
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xF8, 0x2E,
-    0x0B, 0x82, 0xE0, 0xB8, 0x2D, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00,
-    0xBC, 0x0B, 0xDB, 0xC0, 0xBD, 0xBC, 0x0B, 0xDB, 0xC0, 0x7C, 0xBC, 0x07, 0xC7, 0xC0, 0x7C, 0x7C,
-    0x03, 0xC7, 0xC0, 0x3C, 0x38, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x01, 0xE0, 0x00, 0x00, 0x3D, 0x00,
-    0xF8, 0x00, 0x00, 0x0F, 0x00, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00, 0x02, 0xF0, 0x07,
-    0xC0, 0x00, 0x00, 0xB8, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x2A, 0xAF, 0xEA, 0xBF,
-    0xA9, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x56, 0xF5, 0x5B, 0xD5, 0x50, 0x00, 0xB8, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x00,
-    0x00, 0x02, 0xF0, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0xBC, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00,
-    0x03, 0xC0, 0x0F, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x1B, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0x9B, 0x96,
-    0xF0, 0xBD, 0x0B, 0x80, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0xFC, 0x0B, 0x80, 0x00, 0xFD, 0x0B, 0x80,
-    0x00, 0x7F, 0x8B, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x0B, 0x87, 0xF8, 0x00, 0x0B, 0x80, 0xFC, 0x00, 0x0B, 0x80,
-    0xBC, 0x00, 0x0B, 0x80, 0xFC, 0x40, 0x0B, 0x81, 0xFC, 0xFE, 0x5B, 0xAF, 0xF4, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0x00, 0x02, 0xF4, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3E,
-    0x01, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0xF4, 0x03,
-    0xF0, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0xF4, 0x0F, 0x80, 0x00, 0x07,
-    0xC0, 0x0F, 0x41, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xF4, 0x3E, 0x06, 0x90, 0x03, 0xD0, 0x1F, 0x0B,
-    0xC3, 0xFF, 0xC0, 0x2E, 0x02, 0xF0, 0xF4, 0xBE, 0xBF, 0x01, 0xF9, 0xBD, 0x2F, 0x0F, 0x40, 0xF4,
-    0x0B, 0xFF, 0x83, 0xD1, 0xF0, 0x0F, 0x80, 0x1B, 0x90, 0xFC, 0x2F, 0x00, 0xBC, 0x00, 0x00, 0x1F,
-    0x02, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x03, 0xE0, 0x07,
-    0xC0, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x3D,
-    0x00, 0x1F, 0x00, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0xF4, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x01, 0xFE, 0x5B, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00,
-    0x03, 0xE0, 0x0B, 0xF4, 0x7F, 0x80, 0x07, 0xD0, 0x1F, 0xC0, 0x1F, 0xE0, 0x0F, 0xC0, 0x3F, 0x40,
-    0x07, 0xF8, 0x0F, 0xC0, 0x3F, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xFE, 0x00, 0x0F, 0xF9, 0x57, 0xFF, 0x7F, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00, 0xBF,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0x7C,
-    0x7C, 0x7C, 0x38, 0x00, 0x3E, 0x00, 0xBC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x1F,
-    0x80, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD,
-    0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F,
-    0x80, 0x0F, 0xC0, 0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x7D, 0x00, 0x04, 0xBC,
-    0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x02, 0xF4, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x00,
-    0x7E, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF8, 0x03, 0xF0, 0x07,
-    0xF0, 0x0B, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7D, 0x00, 0x10, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24,
-    0x03, 0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03,
-    0xF4, 0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x45, 0x55, 0xFD, 0x55, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x1F, 0xC2, 0xF4, 0x3F, 0x03, 0xE0, 0x3D, 0x07, 0xC0,
-    0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00, 0x0F, 0xCB, 0xF6, 0xFE,
-    0x7F, 0x01, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x07, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x0F, 0xF5,
-    0x7F, 0xC0, 0x0F, 0xE0, 0x02, 0xF8, 0x03, 0xF0, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0xFC,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xC7, 0xE0, 0x00, 0x02, 0xF5,
-    0xF8, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x2F, 0x5F, 0x80, 0x00, 0x0B, 0xD7, 0xE0, 0x00, 0x02,
-    0xF5, 0xF8, 0x00, 0x00, 0xBD, 0x3E, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0x80, 0x00, 0xBD, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x3F,
-    0x91, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x01, 0xFF, 0x00, 0xBF, 0xF0, 0x3F, 0xFF, 0x0F, 0xE3, 0xF3, 0xF8, 0x3F, 0x0D,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFF, 0xE5, 0xBF, 0xD0, 0x1F, 0x40, 0x02,
-    0xFC, 0x01, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xFE, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x95, 0xBF, 0xD0, 0x2E, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x01, 0xAA, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x14, 0x00, 0x00, 0x7F, 0x4B, 0xE4, 0x01, 0xBF, 0xC2, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE,
-    0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x3D, 0xFC, 0x00, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x00, 0xBC, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xAF, 0xEA,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x6A, 0x90, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x04, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x40, 0x00, 0x07, 0xF0, 0xF9, 0x41, 0x7F, 0xD0,
-    0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0x95, 0x50, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x6F, 0xE4, 0x00, 0xFC, 0xBF, 0xFF, 0xC0, 0x3F,
-    0xBE, 0x5B, 0xFC, 0x0F, 0xF8, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x3F, 0xD0, 0x7F, 0xC0, 0x03, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x2F, 0xE5,
-    0x6F, 0xE0, 0x0F, 0xC0, 0x00, 0xFD, 0x07, 0xD0, 0x00, 0x1F, 0x82, 0xF4, 0x00, 0x07, 0xE0, 0xBD,
-    0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xBD, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0xD0, 0xBF, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0x81, 0xFF,
-    0x40, 0x7F, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xE0, 0x00,
-    0x02, 0xF5, 0xF8, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x1F, 0xC1, 0xFE,
-    0x00, 0x6F, 0xD0, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xE5, 0xBF,
-    0xC0, 0x1F, 0xC0, 0x02, 0xF8, 0x0F, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0xF8, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0x2F, 0x1F, 0x80, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x01, 0xFD, 0x2F, 0x80, 0x01, 0xFF, 0x43, 0xFD, 0x06, 0xFF, 0xC0, 0x3F, 0xFF, 0xF2, 0xF0,
-    0x02, 0xFF, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x40, 0x1B,
-    0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04,
-    0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0xBF, 0x6F, 0xE7, 0xF0, 0x10, 0x01, 0x01, 0xFC, 0x2F, 0xD2, 0xFD, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x1F, 0xC2, 0xF8, 0x3F, 0x03, 0xF0, 0x7D, 0x0B, 0xC0, 0xF8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x03, 0xFA, 0x5B, 0xF8, 0x24,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xAF,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x95, 0x6F, 0xF8,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x05, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x02,
-    0xFF, 0xFD, 0x00, 0xF4, 0x0F, 0x80, 0x0F, 0xFF, 0xFE, 0x00, 0xF8, 0x1F, 0x00, 0x3F, 0x40, 0x3E,
-    0x00, 0xBC, 0x2F, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x7C,
-    0x3D, 0x01, 0xF4, 0x00, 0x3E, 0x00, 0x7C, 0x3D, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0x7C, 0x3D, 0x01,
-    0xF0, 0x00, 0x3D, 0x00, 0xBC, 0x3D, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0xF8, 0x3D, 0x00, 0xF8, 0x00,
-    0xFD, 0x00, 0xF0, 0x3E, 0x00, 0xBD, 0x02, 0xFF, 0x03, 0xE0, 0x2F, 0x00, 0x3F, 0xEF, 0xCF, 0xEF,
-    0xC0, 0x1F, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x50, 0x00, 0x50, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x2F, 0xF9, 0x45, 0xAF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xE9,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x0B, 0xF8, 0xFC, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xFC,
-    0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xFA, 0xAB, 0xFE, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0x8F, 0xC0, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x00,
-    0xBE, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x00, 0xFE, 0xFC, 0x00, 0x00, 0xFF, 0x3F, 0xAA, 0xAB, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0x43, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFA, 0xAB, 0xF4, 0x03, 0xFD, 0x00, 0x01, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0xBC,
-    0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x55, 0x00, 0x00, 0xBF,
-    0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00,
-    0x02, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0xD0, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC,
-    0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0xFE, 0xAA, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF,
-    0xFA, 0xAB, 0xFC, 0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE,
-    0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0,
-    0x00, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5,
-    0x56, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B,
-    0xDF, 0xFA, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00,
-    0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x85, 0x5B, 0xF0, 0xBF,
-    0xFE, 0x0B, 0xFF, 0x40, 0x05, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F,
-    0xC2, 0xFC, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F,
-    0x40, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0,
-    0x00, 0x01, 0xFD, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0xF4, 0x00, 0x00, 0x0F, 0xBF, 0xFC, 0xF8, 0x00, 0x00, 0x1F, 0x3F, 0xFC, 0xFC, 0x00, 0x00, 0x3F,
-    0x3F, 0xFC, 0x7D, 0x00, 0x00, 0x3D, 0x3F, 0xFC, 0x3F, 0x00, 0x00, 0xBC, 0x3F, 0xFC, 0x2F, 0x00,
-    0x00, 0xF8, 0x3F, 0xFC, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0xFC,
-    0x0B, 0xD0, 0x03, 0xE0, 0x3F, 0xFC, 0x03, 0xE0, 0x0B, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x3F, 0xFC, 0x00, 0xFC, 0x2F, 0x00, 0x3F, 0xFC, 0x00, 0xBC,
-    0x3E, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00,
-    0x3F, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00,
-    0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC,
-    0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC,
-    0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01,
-    0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F,
-    0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC,
-    0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0xA4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x0B, 0xF8, 0xFC, 0x00,
-    0x02, 0xFC, 0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0xFD, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xAA, 0x90, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x1F, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x40, 0xBF, 0xFF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00,
-    0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5, 0x56, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xF0,
-    0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0,
-    0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F,
-    0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F,
-    0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBE,
-    0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x00, 0x07, 0xD7, 0xD0, 0x00, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0x7E, 0xF0, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x02, 0xF7, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x7E, 0x2F, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x02, 0xF0,
-    0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3E, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0xBD, 0x01, 0xF4, 0x0B, 0xD0, 0x1F, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x0F,
-    0x80, 0xBD, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0xBC,
-    0x0F, 0xC0, 0x00, 0x2F, 0x4B, 0xC0, 0x01, 0xF8, 0x7D, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x00, 0xFC, 0xF8, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x1F, 0x7E,
-    0x00, 0x00, 0x07, 0xEF, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x2F, 0xC0, 0x00,
-    0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x3F,
-    0x00, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00,
-    0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x01, 0xFC,
-    0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B,
-    0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0x1F, 0xFF, 0xC7, 0xFA, 0xA1, 0xF8,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0,
-    0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80,
-    0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00,
-    0x1F, 0x80, 0x07, 0xE0, 0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0x05, 0x55, 0x40, 0x7D, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0x0F, 0xFF, 0xD2, 0xAB,
-    0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B,
-    0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F,
-    0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0xFF, 0xFD, 0x3F, 0xFF, 0x45, 0x55, 0x40, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x7E, 0xF0, 0x00, 0x00,
-    0x3E, 0x3D, 0x00, 0x00, 0x0F, 0x0B, 0xC0, 0x00, 0x0B, 0x80, 0xF4, 0x00, 0x03, 0xD0, 0x2F, 0x00,
-    0x02, 0xF0, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x02,
-    0xF0, 0x2F, 0x00, 0x00, 0x3D, 0x0F, 0x80, 0x00, 0x0B, 0xC7, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00,
-    0x3F, 0x40, 0x1F, 0xC0, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFD, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xF9, 0x46, 0xFD, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xA5, 0x5F, 0xCF, 0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x03, 0xF7, 0xE0,
-    0x00, 0x1F, 0xDF, 0xC0, 0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0xF0, 0x7F, 0xFE,
-    0x07, 0xC0, 0x05, 0x40, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xFF, 0x40, 0x0F, 0x9F, 0xFF, 0xFC, 0x03,
-    0xFF, 0x95, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x0F,
-    0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0x4F, 0xE0,
-    0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x1F, 0xF0, 0x3D, 0xBF, 0xFF, 0xF0, 0x0F,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01,
-    0xFF, 0xFF, 0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xFD, 0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x2F, 0xFD, 0x0F, 0x80, 0xBF, 0xFF, 0xF3, 0xE0, 0x7F, 0x95, 0x7F, 0xF8, 0x3F, 0x80, 0x02,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8F, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x0B, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xE4,
-    0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xAA, 0xA0,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x55, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF4,
-    0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x1B, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x01, 0x6F, 0x95, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x42, 0xE0, 0x1F, 0xFF, 0xFC, 0xF8, 0x1F, 0xF5, 0x6F, 0xFE, 0x0F, 0xE0, 0x00, 0xFF,
-    0x87, 0xF0, 0x00, 0x0F, 0xE2, 0xF4, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x3F, 0x00,
-    0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x07, 0xE2, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x01, 0xFE, 0x0B,
-    0xF8, 0x06, 0xFF, 0x80, 0xBF, 0xFF, 0xF7, 0xE0, 0x07, 0xFF, 0xE0, 0xF8, 0x00, 0x05, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x14, 0x00, 0x03,
-    0xFC, 0x0F, 0xE9, 0x5B, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B,
-    0xFF, 0x80, 0x3E, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFD, 0x3F, 0x80,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x18, 0x1F, 0xC7, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x00, 0x00, 0x18, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x2F, 0x8A, 0x6F, 0xC3, 0xFF, 0xE0, 0xBF, 0xD0,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x2F, 0x80, 0x3E, 0x00, 0xBF,
-    0x00, 0x3E, 0x02, 0xFC, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x3E, 0x7F, 0x00,
-    0x00, 0x3E, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x3F, 0x03, 0xF8,
-    0x00, 0x3E, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x3E, 0x00, 0x0F,
-    0xE0, 0x3E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x01, 0xFC, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xFD, 0x00, 0xBF, 0xF8,
-    0x03, 0xD7, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xFE, 0x56, 0xFE, 0xF9, 0x5B, 0xF8, 0x3F, 0xC0,
-    0x02, 0xFF, 0x40, 0x03, 0xF0, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4,
-    0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5,
-    0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x42,
-    0xFF, 0xE0, 0x03, 0xD7, 0xFF, 0xFF, 0x00, 0xFF, 0xE5, 0x6F, 0xF0, 0x3F, 0xD0, 0x00, 0xFE, 0x0F,
-    0xE0, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xD3, 0xF8, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0x03, 0xF8, 0x3F, 0xF8,
-    0x07, 0xFC, 0x0F, 0xAF, 0xFF, 0xFC, 0x03, 0xE1, 0xFF, 0xF8, 0x00, 0xFC, 0x01, 0x40, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0x42, 0xE0, 0x1F, 0xFF, 0xFC, 0xF8, 0x1F, 0xE5, 0x5F, 0xFE, 0x0F, 0xE0,
-    0x00, 0xBF, 0x87, 0xF0, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F,
-    0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x7E,
-    0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x02,
-    0xFE, 0x0B, 0xF8, 0x06, 0xFF, 0x80, 0xBF, 0xFF, 0xF7, 0xE0, 0x07, 0xFF, 0xE1, 0xF8, 0x00, 0x05,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xC3, 0xFD, 0x05, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xBD, 0x7D, 0x00, 0x6F, 0xC7, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F,
-    0xFD, 0x00, 0x01, 0x40, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01,
-    0xF8, 0x1F, 0x80, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02,
-    0xF0, 0x7E, 0x00, 0x00, 0x7E, 0x2F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x02, 0xF7, 0xD0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7D, 0x00, 0x02,
-    0xFC, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xFD, 0x00, 0x0F,
-    0xC2, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFC, 0x1F, 0x80, 0x0F, 0xAF, 0x00, 0x1F, 0x80, 0xFC, 0x00,
-    0xF5, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x1F, 0x0F, 0x80, 0x3F, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x03,
-    0xF0, 0x07, 0xE0, 0x3E, 0x07, 0xD0, 0x7D, 0x00, 0x3F, 0x07, 0xD0, 0x3E, 0x0B, 0xC0, 0x03, 0xF0,
-    0xBC, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x4F, 0x80, 0x2F, 0x0F, 0x80, 0x00, 0xF9, 0xF4, 0x00, 0xF5,
-    0xF4, 0x00, 0x0F, 0xEF, 0x00, 0x0F, 0xAF, 0x00, 0x00, 0xBE, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x07,
-    0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0xFC, 0x00,
-    0x2F, 0x80, 0x3F, 0x40, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x0F, 0xFE, 0x00, 0x00, 0x03, 0xF6, 0xF4, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x7F,
-    0x00, 0x03, 0xF4, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x00, 0x7F, 0x03, 0xF4,
-    0x00, 0x02, 0xF8, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0,
-    0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00,
-    0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07, 0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x69, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF9, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x2B, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xF4,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x1F, 0xE4, 0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x14, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0xA8, 0x00,
-    0x03, 0xFE, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x7F, 0x80, 0x07, 0xFE, 0x00, 0xBF, 0x40, 0x03, 0xF0, 0x00,
-    0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-    0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x01, 0xFF, 0x00, 0x3F, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x02, 0xD7, 0xE6, 0xFF, 0xFF, 0xF5, 0x80, 0x02,
-    0xFF, 0xF4, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFD, 0x3F, 0x01, 0x00, 0x00,
-    0x00, 0x2D, 0x0B, 0x42, 0xE0, 0xB8, 0x3E, 0x0F, 0x83, 0xE0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF1, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xBD, 0x40, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x1F, 0xF4, 0x06,
-    0x43, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x40, 0xFF, 0xA6, 0xBC, 0x07, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x56, 0xF4, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x05, 0x7F,
-    0x95, 0x54, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xFE, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x10, 0x07, 0x42, 0xF6, 0xFF, 0xE7, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xF4, 0x07, 0xF0, 0x01, 0xF0, 0x00, 0x3D, 0x00, 0xB8, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0xF0,
-    0x0F, 0x40, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x1F, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x0B,
-    0xC0, 0x07, 0xFE, 0x6F, 0xF4, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xF0, 0x6A, 0x43, 0xE0, 0x10, 0x00,
-    0x00, 0x10, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0xBD,
-    0x03, 0xF4, 0x00, 0x03, 0xF0, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x0B, 0xD0, 0x01, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFB, 0xD0, 0x00, 0x01, 0x57, 0xFF, 0x55, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x05, 0x57, 0xF5, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xAA, 0xBF, 0xAA,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x14, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
-    0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x00, 0x00, 0x15, 0x54, 0x00, 0x2F, 0xFF, 0xFD, 0x0F, 0xFF,
-    0xFF, 0xD1, 0xF8, 0x00, 0x18, 0x2F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0x80, 0x7F, 0xC2, 0xF0, 0x00,
-    0xBE, 0x2F, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x2F, 0x1F, 0x80, 0x03, 0xF0, 0xFF, 0x40, 0x7D, 0x03,
-    0xFF, 0xAF, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE3, 0xE4, 0x01, 0xFD, 0x3F, 0xFF, 0xFF, 0x41, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0xFC, 0x0B, 0xC3, 0xF0, 0x2F, 0x4B, 0x80,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0B,
-    0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x3E, 0x00, 0x05, 0x40, 0x0F, 0x80, 0x0B, 0x80, 0x0B, 0xFF, 0xC0, 0x3D, 0x00, 0xF0,
-    0x07, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xFD, 0x00, 0x40, 0x0F, 0x43, 0xC0, 0x2F, 0x40, 0x00,
-    0x00, 0x78, 0x3C, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x78,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xC7, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x3C, 0x78, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xC3, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x02, 0xF0, 0x00, 0x00, 0x07, 0x82,
-    0xD0, 0x0F, 0x80, 0x00, 0x00, 0xB4, 0x0F, 0x00, 0xBF, 0xAB, 0xC0, 0x0F, 0x00, 0xB8, 0x01, 0xFF,
-    0xFC, 0x03, 0xD0, 0x03, 0xD0, 0x01, 0xA5, 0x00, 0xBC, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x3F,
-    0xBF, 0x81, 0x00, 0x3C, 0x00, 0x03, 0xD0, 0x1A, 0xBD, 0x2F, 0xFF, 0xDB, 0xC0, 0x3D, 0xF4, 0x03,
-    0xDF, 0x40, 0x7D, 0xBE, 0x6F, 0xD2, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00,
-    0xF8, 0x07, 0xD0, 0x0F, 0xC0, 0x7F, 0x00, 0xBD, 0x03, 0xF0, 0x0B, 0xE0, 0x3F, 0x00, 0x7E, 0x03,
-    0xF4, 0x07, 0xF0, 0x2F, 0x80, 0x2F, 0x80, 0xFD, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x3F, 0x41, 0xFC,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xB0, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55,
-    0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB,
-    0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0xAF, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x0B, 0x80, 0xBF, 0xFE, 0x00,
-    0x3D, 0x00, 0xF0, 0x0B, 0xFF, 0xFC, 0x01, 0xF0, 0x2D, 0x00, 0xBC, 0x07, 0xE0, 0x0F, 0x43, 0xC0,
-    0x0B, 0xC0, 0x3F, 0x00, 0x78, 0x3C, 0x00, 0xBC, 0x03, 0xF0, 0x03, 0xC7, 0x80, 0x0B, 0xC0, 0x3E,
-    0x00, 0x3C, 0x78, 0x00, 0xBD, 0x6F, 0xC0, 0x03, 0xC7, 0x80, 0x0B, 0xFF, 0xF0, 0x00, 0x3C, 0x78,
-    0x00, 0xBE, 0xBE, 0x00, 0x03, 0xC3, 0xC0, 0x0B, 0xC2, 0xF0, 0x00, 0x3C, 0x3C, 0x00, 0xBC, 0x0F,
-    0xC0, 0x07, 0x82, 0xD0, 0x0B, 0xC0, 0x7D, 0x00, 0xB4, 0x0F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0x00,
-    0xB8, 0x0B, 0xC0, 0x1F, 0x83, 0xD0, 0x03, 0xD0, 0x54, 0x00, 0x54, 0xBC, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0xA5, 0xBF, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x00, 0xBC, 0x3D, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x3D,
-    0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0xFD, 0x55, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x47, 0xFF, 0xFF, 0xFF, 0xF5,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x03, 0xFA, 0xBE, 0x02, 0x00, 0x7C, 0x00,
-    0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00,
-    0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x7F, 0xFF, 0x03, 0xF9, 0xBF, 0x05, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0xC0, 0x00, 0xBD, 0x01, 0xFF, 0xD0, 0x02, 0xAF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80, 0x00,
-    0x3E, 0x00, 0x01, 0xF5, 0xFA, 0xAF, 0xC7, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x01, 0xA8, 0x03, 0xF8,
-    0x0B, 0xE0, 0x1F, 0x80, 0x3E, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0xBF,
-    0x3F, 0x80, 0x01, 0xFF, 0x3F, 0xE0, 0x1B, 0xFF, 0x3F, 0xFF, 0xFF, 0x2F, 0x3E, 0x7F, 0xF8, 0x2F,
-    0x3E, 0x01, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x55, 0x40, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xAB, 0xD0, 0xFF, 0xFF,
-    0xF0, 0x2D, 0x1F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3,
-    0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF,
-    0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x0F,
-    0xFF, 0xFF, 0x02, 0xD0, 0x3F, 0xFF, 0xF0, 0x2D, 0x00, 0xBF, 0xFF, 0x02, 0xD0, 0x00, 0x00, 0xF0,
-    0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00,
-    0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02,
-    0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00,
-    0x0F, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF6,
-    0xFE, 0x7F, 0x01, 0x00, 0x03, 0xC0, 0x0B, 0x40, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0xBC,
-    0xBF, 0xF4, 0x7F, 0x90, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xDF, 0xEF, 0x7C, 0x7C, 0x41, 0xF0, 0x07,
-    0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFE, 0xFC, 0x1F, 0x00, 0xBC, 0xB4, 0x00, 0xF3, 0xD0, 0x02,
-    0xDF, 0x00, 0x0B, 0x7C, 0x00, 0x2D, 0xB4, 0x00, 0xF5, 0xF0, 0x07, 0xC2, 0xFA, 0xBD, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0xF4, 0x0F, 0xC0, 0x03, 0xF0, 0x1F, 0xC0, 0x03,
-    0xF0, 0x1F, 0x80, 0x07, 0xF0, 0x2F, 0x80, 0x07, 0xE0, 0x3F, 0x40, 0x0B, 0xE0, 0x3F, 0x00, 0x1F,
-    0xC0, 0xBD, 0x00, 0xFC, 0x07, 0xE0, 0x0F, 0xD0, 0x7F, 0x00, 0xBD, 0x03, 0xF0, 0x0B, 0xE0, 0x3F,
-    0x00, 0x7E, 0x02, 0xF4, 0x00, 0xB0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x1E, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0xBD,
-    0x7C, 0x00, 0x01, 0xF0, 0x00, 0x20, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x7C, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0x40, 0x00, 0x7C, 0x02, 0xF0, 0x0B, 0xE0, 0x00,
-    0x7C, 0x03, 0xD0, 0x0F, 0xE0, 0x00, 0x7C, 0x0F, 0x80, 0x3F, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0xB7,
-    0xE0, 0x00, 0x14, 0x3E, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0xBC, 0x03, 0xC3, 0xE0, 0x00, 0x00, 0xF4,
-    0x0B, 0x43, 0xE0, 0x00, 0x03, 0xE0, 0x1E, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x3D, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0xBF, 0xFF, 0xFE, 0x00, 0x2F, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x7C, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7D, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0F, 0x40, 0x01, 0xFF, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0xF8, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x14, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x02,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3E, 0x01, 0xA4, 0x00, 0x03, 0xE0, 0x2F, 0x0F,
-    0xFF, 0xC0, 0x00, 0xF8, 0x0F, 0x4F, 0xE6, 0xFC, 0x00, 0x3E, 0x0F, 0x80, 0x80, 0x1F, 0x00, 0x0F,
-    0x87, 0xC0, 0x00, 0x03, 0xD0, 0x01, 0x43, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xF0, 0x07, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F, 0x40,
-    0x3F, 0xFF, 0xE0, 0x00, 0x02, 0xF0, 0x02, 0x80, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x6F,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x15, 0x00, 0x00, 0x0F, 0x80, 0xF4, 0x07,
-    0xE0, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0xFE, 0x0B, 0x90, 0x7F, 0x07, 0xC0, 0x2F, 0xE0, 0x7F, 0xFF,
-    0xD0, 0xF8, 0x07, 0xAE, 0x00, 0x6A, 0x90, 0x2F, 0x00, 0xF3, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x3D,
-    0x3E, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0x83, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x3E, 0x00, 0x00,
-    0x03, 0xE0, 0x3D, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0x40, 0x3F,
-    0xFF, 0xFE, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x04, 0x2F, 0xE4, 0x1B, 0xD0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x55,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7E, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x02, 0xD0, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x78, 0x00, 0x00, 0x3F, 0xFF, 0xAF,
-    0x00, 0x00, 0x03, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x74, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xB8, 0x07,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01,
-    0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x02, 0xE6, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0xB4, 0x00, 0x00, 0x00, 0x3C, 0x0F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00,
-    0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xEA, 0xAA, 0xA0, 0x00, 0x0F, 0xC0, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xAA, 0xAA, 0x81, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFA, 0xAB, 0xF4, 0x03, 0xFD, 0x00,
-    0x01, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xF9, 0x55, 0xBC, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x1A, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD0, 0x3F, 0x01, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x7D, 0x03, 0xE0, 0x07, 0xE0,
-    0x3F, 0x00, 0x3C, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x6A, 0x00, 0x0F, 0xD0, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-    0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x0A, 0x90, 0x02,
-    0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x01, 0xF4, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x8B, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0xFF, 0xCB, 0xFF, 0xFC, 0x00, 0xA8, 0x00, 0x02,
-    0xFF, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xCB, 0xD0, 0x3E, 0x02, 0xF4, 0xB4, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x2F, 0xFF, 0xF0, 0x01, 0xFE, 0x40, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF0, 0x10, 0x01, 0x0F, 0xC0,
-    0xBC, 0xFC, 0x0B, 0xDB, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
-    0xBF, 0xFF, 0xC0, 0x7F, 0x90, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0,
-    0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF4, 0x0B, 0xFF, 0xFC, 0xBF, 0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBD, 0x00, 0x02, 0xFF, 0x40,
-    0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0xBD, 0x00, 0x00, 0x02, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xCF, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0xFF, 0xFF, 0xFD, 0x00,
-    0x0F, 0xDA, 0xFF, 0xAA, 0x80, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0xBD, 0x00, 0x00, 0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xAA,
-    0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x05, 0x00, 0x00, 0x3F, 0xF0, 0x0E, 0x00, 0x00, 0xFF, 0xFE, 0xBD, 0x00, 0x00, 0xF0, 0x7F,
-    0xF8, 0x00, 0x01, 0xD0, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC,
-    0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC,
-    0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B,
-    0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE,
-    0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0,
-    0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC,
-    0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC,
-    0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F,
-    0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xE5, 0xBF,
-    0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x02, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x0B,
-    0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x80,
-    0x00, 0x00, 0xBF, 0xD0, 0x3C, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0x80, 0x00, 0x03, 0xC0, 0xBF, 0xF0,
-    0x00, 0x00, 0x38, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x7D, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-    0x00, 0x01, 0xCB, 0xD0, 0x00, 0x1F, 0x8F, 0xD0, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD1,
-    0xFC, 0x00, 0x0F, 0xEF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x1F, 0xCF, 0xD0, 0x01, 0xFC, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD1, 0xFC, 0x00, 0x0F, 0xD7,
-    0xC0, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x6F, 0xFF,
-    0x91, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0xC0, 0x07, 0xF8, 0x00,
-    0x03, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xFF, 0x83, 0xF0, 0x00,
-    0x02, 0xF4, 0xFC, 0x7F, 0x00, 0x00, 0x7E, 0x0F, 0xDB, 0xE0, 0x00, 0x0F, 0xC0, 0xBE, 0xFD, 0x00,
-    0x02, 0xF0, 0x07, 0xFF, 0xD0, 0x00, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0,
-    0x03, 0xF0, 0x00, 0x3F, 0xFD, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xD0, 0x1F, 0x80, 0x00, 0x7F, 0xBE,
-    0x03, 0xF0, 0x00, 0x0B, 0xE7, 0xF0, 0xBD, 0x00, 0x00, 0xFD, 0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC3,
-    0xFF, 0xF0, 0x00, 0x02, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0,
-    0x07, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0x4B, 0xFF, 0xFE, 0x00,
-    0x00, 0xA0, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02,
-    0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x07, 0x80,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0,
-    0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F,
-    0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFE, 0xAA, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0xFC,
-    0x00, 0x1F, 0xF4, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC,
-    0x00, 0x0B, 0xF4, 0xFF, 0xAB, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0x90, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFD, 0x00, 0x6F, 0xC0, 0x3F, 0x40, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x3F, 0x00,
-    0x00, 0xBD, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x02, 0xFC, 0x00,
-    0x3F, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x03, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x00, 0x07, 0xFD, 0x03,
-    0xF0, 0x00, 0x0B, 0xF4, 0x3F, 0x00, 0x00, 0x2F, 0xC3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0xB8, 0x02, 0xFC, 0x3F,
-    0x0B, 0xFF, 0xFF, 0x43, 0xF0, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57,
-    0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD,
-    0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0x8F, 0xC0, 0x01, 0xF4, 0x0F, 0xC0, 0x0F, 0x40, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E,
-    0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F,
-    0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF,
-    0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x20, 0x07, 0xFE, 0x02, 0xD0, 0x3F, 0xFF, 0xAF, 0x01, 0xE0, 0x7F, 0xF4, 0x0B, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF,
-    0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE,
-    0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x10, 0x01, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x2D, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07,
-    0xFF, 0xFF, 0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55,
-    0xFC, 0xFE, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD,
-    0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0x0E,
-    0x03, 0xC0, 0x00, 0x74, 0x0F, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8,
-    0x03, 0xE5, 0x1B, 0xF4, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x1A, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC3, 0xFE, 0x95, 0x7F, 0x3F, 0x80,
-    0x00, 0xFD, 0xFC, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x7F, 0x7F, 0x00, 0x03,
-    0xFC, 0xFE, 0x00, 0xBF, 0xF1, 0xFF, 0xFF, 0xD7, 0xC1, 0xFF, 0xF8, 0x1F, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xE0, 0x02, 0xF9, 0x17, 0xFB, 0xF4, 0x1F, 0xE0, 0x01, 0x00, 0x03, 0xFF, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x16, 0xAB, 0xFE, 0xAA, 0xAB, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xA5, 0x6F, 0xEA, 0xAA, 0xAA, 0x0F, 0xE0, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x5F,
-    0xE4, 0x16, 0xD0, 0x7F, 0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0x40, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA,
-    0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x02, 0xA0, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x01, 0xF8, 0x0B,
-    0xD0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F,
-    0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5,
-    0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x10, 0x01, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xD0, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16,
-    0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x2A, 0x40,
-    0x2F, 0xC0, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0xA8, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x29, 0x00, 0x00, 0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x0B,
-    0xE3, 0xF0, 0x1F, 0x40, 0xFC, 0x3C, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x04, 0x00, 0x43, 0xE0, 0x3F, 0x7E, 0x03, 0xF3, 0xD0, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-    0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x07, 0xC0, 0x00, 0x2F, 0xE6, 0xFC,
-    0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0x87, 0xF0, 0x00, 0x03, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0A, 0xE9, 0x2F, 0x40, 0x0F, 0xFF, 0xFD, 0xF8, 0x03, 0xFF, 0xAF, 0xFF, 0xC0, 0xFE, 0x00,
-    0x0B, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3,
-    0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x0F, 0xC2, 0xF8, 0x00, 0x01, 0xF8, 0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x20, 0x01, 0xFF, 0x80, 0xB0, 0x03, 0xFF, 0xFA, 0xF0, 0x0B, 0x41, 0xFF, 0xD0, 0x0B, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF,
-    0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD,
-    0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC,
-    0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1,
-    0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF,
-    0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07,
-    0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F,
-    0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0,
-    0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x02, 0xF5, 0xFC, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82,
-    0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00,
-    0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F,
-    0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F,
-    0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x18, 0x00, 0x0B, 0xFD, 0x03, 0xC0, 0x01, 0xFF, 0xFE, 0xF8, 0x00, 0x2D, 0x0B, 0xFF,
-    0x00, 0x02, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD,
-    0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00,
-    0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xD0, 0x3E, 0x00, 0x00, 0xBE, 0x07,
-    0xF0, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x45,
-    0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x02, 0xFF, 0xF4, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F,
-    0xE0, 0x01, 0xFF, 0x01, 0xFC, 0x00, 0x3F, 0xF4, 0x2F, 0x40, 0x0B, 0xDF, 0xC3, 0xF0, 0x01, 0xF4,
-    0xFC, 0x3F, 0x00, 0x3E, 0x0F, 0xD3, 0xF0, 0x0F, 0xC0, 0xBD, 0x3F, 0x02, 0xF4, 0x0B, 0xD3, 0xF0,
-    0x7E, 0x00, 0xFD, 0x3F, 0x0F, 0xC0, 0x0F, 0xC2, 0xF6, 0xF0, 0x00, 0xFC, 0x1F, 0xFD, 0x00, 0x2F,
-    0x80, 0xFF, 0x80, 0x07, 0xF0, 0x07, 0xFD, 0x06, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x1F, 0xAF,
-    0xFF, 0x80, 0x00, 0x70, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF,
-    0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
-    0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF,
-    0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00,
-    0x00, 0xBE, 0x3F, 0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x03, 0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x10, 0x01, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xF4, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF,
-    0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F,
-    0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80,
-    0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0,
-    0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F,
-    0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x0F,
-    0x9F, 0xFF, 0xFC, 0x03, 0xFF, 0x95, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00,
-    0x00, 0x3F, 0x4F, 0xE0, 0x00, 0x0F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x1F, 0xF0, 0x3E,
-    0xBF, 0xFF, 0xF0, 0x0F, 0x87, 0xFF, 0xE0, 0x03, 0xF0, 0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x3F,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x02, 0xD0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x2F,
-    0x4F, 0xC0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00,
-    0xFC, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xF8,
-    0x0B, 0xD0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00,
-    0x2F, 0x3F, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xF0,
-    0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA9, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03,
-    0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40,
-    0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE,
-    0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01,
-    0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xAA, 0x80, 0x0B, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0xF9, 0x46, 0xFD, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0xFF, 0xA5, 0x5F, 0xCF,
-    0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0xF0, 0x7F, 0xFE, 0x07, 0xC0, 0x05, 0x40,
-    0x00, 0x00, 0x18, 0x00, 0x09, 0x00, 0x00, 0x01, 0xE0, 0x02, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0x80, 0x00, 0x90,
-    0x0B, 0x40, 0x0F, 0x40, 0x1F, 0xEA, 0xFC, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94,
-    0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8,
-    0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00,
-    0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xE5, 0x1B, 0xF4, 0x01, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06,
-    0xAB, 0xFC, 0x02, 0xFF, 0xFF, 0xFC, 0x0F, 0xFA, 0x55, 0xFC, 0x3F, 0x80, 0x00, 0xFC, 0x7F, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x03, 0xFC, 0x3F, 0x80,
-    0x2F, 0xFC, 0x1F, 0xFF, 0xFD, 0x7C, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x15, 0x00, 0xB8, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x07, 0xFA, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD, 0x00, 0xFF,
-    0x40, 0x00, 0x60, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x1F, 0xFF, 0xFE, 0x03, 0xFE, 0x5A, 0xD0, 0xFE, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xD0, 0x5E, 0x01, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFF, 0xFD, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0xB4,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE,
-    0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD, 0x00, 0xFF, 0x40, 0x00, 0x60, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1F,
-    0x8F, 0xD0, 0x01, 0xF8, 0x0B, 0xC0, 0x0F, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xE5, 0xAD, 0x03, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x41, 0x78, 0x01, 0xFF, 0xFF,
-    0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xAA, 0xBF, 0x40, 0x3F, 0xD0, 0x00, 0x18, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x95, 0x5B, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF9, 0x01, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xE5, 0xAD, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x05, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x1F, 0x80, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0xAA, 0xFD,
-    0x00, 0xFF, 0x40, 0x00, 0x60, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x55, 0x6F, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0x40, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x0B, 0xD0, 0x1F,
-    0x80, 0x0B, 0xD2, 0xF8, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x80, 0x3F,
-    0xE5, 0xAD, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0x41, 0x78, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x01,
-    0x90, 0x00, 0x64, 0x00, 0x00, 0xF8, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0xD0,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x03,
-    0xF4, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xFF, 0x40,
-    0xFE, 0xAA, 0xBF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x50, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xD0,
-    0x00, 0x00, 0x01, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0x40, 0x00, 0x00, 0x01, 0xF8, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x0F, 0x80,
-    0x00, 0x2F, 0xFF, 0xFC, 0xF8, 0x00, 0x07, 0xF9, 0x57, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x0B, 0xF8,
-    0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x00,
-    0x2F, 0x80, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80,
-    0x6F, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0xF8, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBD, 0x00, 0x02, 0xFF, 0x40, 0x0B, 0xD0, 0x00, 0x02, 0xFC, 0x00,
-    0xBD, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0x02, 0xF8,
-    0x0B, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xCF, 0xFF, 0xFF, 0xD0, 0x00, 0xFD, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xDA, 0xFF, 0xAA, 0x80, 0x00,
-    0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x0B, 0xD0, 0x00, 0x00,
-    0x2F, 0x80, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0xBD, 0x00, 0x00,
-    0x2F, 0xC0, 0x0B, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0xBF, 0xAA, 0xBF, 0xFD, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0x55, 0x6F, 0xD4, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x2F, 0xFD, 0x1F, 0x80, 0x01, 0xFF, 0xFF, 0x8F, 0x80, 0x07, 0xFD, 0x5B, 0xFF, 0x80, 0x0F,
-    0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x3F, 0x00,
-    0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00,
-    0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x2F,
-    0x80, 0x2F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x06, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x06,
-    0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xAA, 0xAA, 0x80, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFE, 0x00, 0x0F, 0xE4, 0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82,
-    0xF4, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFA, 0xAA, 0xAA, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F,
-    0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x0A, 0x00, 0x06, 0x00, 0xF0,
-    0x00, 0xF0, 0x07, 0xEA, 0xBE, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA,
-    0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0x80, 0x00, 0x90, 0x00, 0xB8, 0x00, 0xB4,
-    0x00, 0x0F, 0xEA, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE,
-    0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA,
-    0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3,
-    0xFA, 0xAA, 0xAB, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0xE9, 0x00, 0x00, 0x7F, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x0F, 0xE4, 0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x03,
-    0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA,
-    0xAA, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x5B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xE8, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x09, 0x00, 0x06, 0x40, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0xBD,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x02, 0x80, 0x00, 0xA0, 0x00, 0xBD, 0x01, 0xF8, 0x00, 0x0B,
-    0xD1, 0xF8, 0x00, 0x00, 0xBE, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA,
-    0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x07, 0xE0,
-    0x2F, 0x40, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC,
-    0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01,
-    0xA4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0xFC, 0x07, 0xE0, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x0B, 0x80, 0x7F, 0xFF, 0xF3, 0xE0, 0x7F, 0xD5, 0xBF, 0xF8, 0x3F, 0x80, 0x03,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x07, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xDF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x50, 0x00,
-    0x0F, 0xF0, 0x3F, 0xA5, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x06, 0x00, 0x02, 0x40, 0x00, 0x0B, 0x80, 0x0B, 0x40, 0x00, 0x03, 0xFA, 0xBF, 0x00, 0x00, 0x01,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB,
-    0xFC, 0x03, 0xFE, 0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0x3F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00,
-    0x3F, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x90, 0x00, 0xA0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0B, 0xEA, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
-    0x2E, 0x01, 0xFF, 0xFF, 0xCF, 0x81, 0xFF, 0x56, 0xFF, 0xE0, 0xFE, 0x00, 0x0F, 0xF8, 0x7F, 0x00,
-    0x00, 0xFE, 0x2F, 0x40, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8,
-    0xFD, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x6F,
-    0xF8, 0x0B, 0xFF, 0xFF, 0x7E, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x50, 0x03, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x00, 0x3F, 0xC0, 0xFE,
-    0x95, 0xBF, 0xC0, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFE,
-    0x00, 0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x2E, 0x01, 0xFF,
-    0xFF, 0xCF, 0x81, 0xFF, 0x56, 0xFF, 0xE0, 0xFE, 0x00, 0x0F, 0xF8, 0x7F, 0x00, 0x00, 0xFE, 0x2F,
-    0x40, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x3E,
-    0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00,
-    0x7E, 0x2F, 0x80, 0x00, 0x3F, 0x83, 0xF4, 0x00, 0x1F, 0xE0, 0xBF, 0x80, 0x6F, 0xF8, 0x0B, 0xFF,
-    0xFF, 0x7E, 0x00, 0x7F, 0xFE, 0x0F, 0x80, 0x00, 0x50, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x00, 0x3F, 0xC0, 0xFE, 0x95, 0xBF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFA, 0xAB, 0xFC, 0x03, 0xFE, 0x00,
-    0x00, 0x24, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xAA, 0xA9, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0F, 0xE0, 0x00,
-    0x00, 0x3F, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0x02, 0xFF, 0xE5, 0x56, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x0B, 0x80, 0x7F, 0xFF, 0xF3, 0xE0, 0x7F, 0xD5, 0xBF, 0xF8, 0x3F, 0x80, 0x03,
-    0xFE, 0x1F, 0xC0, 0x00, 0x3F, 0x8B, 0xD0, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xFC,
-    0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x07, 0xF8,
-    0x2F, 0xE0, 0x1B, 0xFE, 0x02, 0xFF, 0xFF, 0xDF, 0x80, 0x1F, 0xFF, 0x83, 0xE0, 0x00, 0x14, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x50, 0x00,
-    0x0F, 0xF0, 0x3F, 0xA5, 0x6F, 0xF0, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0B, 0xE3,
-    0xF0, 0x00, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xFA, 0xAA, 0xAA, 0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00,
-    0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00,
-    0x3C, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x0B, 0xFF, 0x80, 0x00, 0x3E, 0x7F, 0xFF, 0xF4, 0x00, 0x3F, 0xF9, 0x57,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEA, 0xBF, 0xAA, 0xAA, 0xAA, 0xFF, 0xA4, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0xEA, 0xAA, 0xAA, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40,
-    0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0x7F, 0x55, 0x54, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x16, 0x50, 0x00, 0x3E, 0x1F, 0xFF, 0xE0, 0x03,
-    0xEB, 0xFF, 0xFF, 0x80, 0x3F, 0xF4, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x01, 0x40, 0x01, 0x43, 0xFF, 0x00, 0xE3, 0xFF, 0xFA,
-    0xF4, 0xF0, 0x7F, 0xF8, 0x74, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFC, 0x00, 0x1F, 0xE4, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x01, 0x40, 0x02, 0x07,
-    0xFE, 0x02, 0xC3, 0xFF, 0xFA, 0xF2, 0xD0, 0x7F, 0xF4, 0xB0, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2A, 0xAA,
-    0xA5, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x82, 0xFF,
-    0xFF, 0x00, 0x7F, 0x90, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xF0, 0x6A, 0xAA,
-    0xA2, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00,
-    0x29, 0xE0, 0x01, 0xE3, 0xFA, 0xBF, 0x03, 0xFF, 0xF4, 0x02, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF8, 0x2F, 0xFF, 0xF0, 0x07, 0xF9, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0xFF,
-    0xC2, 0xFF, 0xFF, 0x00, 0xA0, 0x00, 0x66, 0xD0, 0x03, 0xC7, 0xEA, 0xBF, 0x0B, 0xFF, 0xF0, 0x06,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00,
-    0x2E, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x7F, 0xA0, 0x0B, 0xFC, 0x00,
-    0x14, 0x01, 0x80, 0x1F, 0xC0, 0x7F, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0x00, 0xF0,
-    0x0B, 0x80, 0x3D, 0x00, 0xF4, 0x03, 0xFA, 0x47, 0xFD, 0x01, 0x40, 0x00, 0x90, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xBF, 0xFF, 0xC1,
-    0xFE, 0x40, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x2F, 0xFF, 0xFB, 0xFF,
-    0xFC, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
-    0x3F, 0x3F, 0x3F, 0xBF, 0xFF, 0x80, 0x2F, 0x6F, 0xFF, 0xF0, 0x0B, 0xD0, 0x7F, 0x90, 0x02, 0xF4,
-    0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00,
-    0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0, 0x3F,
-    0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x0B, 0xD0,
-    0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFD, 0x00, 0x0B,
-    0xDB, 0xFF, 0xFC, 0x02, 0xF6, 0xFF, 0xFF, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x01, 0x40, 0x00, 0x18, 0x00, 0x05, 0x1F, 0xC0, 0x0B, 0xD7, 0xF0, 0x03,
-    0xF8, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x7D, 0x3F, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00,
-    0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x4F, 0xC0,
-    0x0B, 0xD3, 0xF0, 0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD3, 0xF0,
-    0x02, 0xF4, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x02, 0x6F, 0xF0, 0x00, 0xFF, 0xF0, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x1F, 0x8B,
-    0xD0, 0x03, 0xE0, 0x2F, 0x40, 0xB4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x05, 0x5B, 0xF0,
-    0x00, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
-    0xFF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE3, 0xF0, 0x1F, 0x40, 0xFC, 0x3C, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBE, 0x00, 0xA6, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xBF,
-    0xD0, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0xFE,
-    0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF8, 0xBF, 0x00,
-    0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
-    0x02, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0xFC, 0x00, 0x02, 0xFC,
-    0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x02, 0xF8, 0x3E, 0x00, 0x0B, 0xE0, 0x3E, 0x00, 0x2F, 0x80, 0x3E, 0x00,
-    0xBF, 0x00, 0x3E, 0x02, 0xFC, 0x00, 0x3E, 0x0B, 0xF0, 0x00, 0x3E, 0x1F, 0xC0, 0x00, 0x3E, 0x7F,
-    0x00, 0x00, 0x3E, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x8B, 0xF0, 0x00, 0x3F, 0x03,
-    0xF8, 0x00, 0x3E, 0x00, 0xFD, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x3E, 0x00, 0x2F, 0xC0, 0x3E, 0x00,
-    0x0F, 0xE0, 0x3E, 0x00, 0x03, 0xF4, 0x3E, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x0B, 0xF0, 0x3F, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xFF,
-    0xD0, 0x00, 0x3F, 0xD7, 0xF0, 0x00, 0x3F, 0x42, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0xA9, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF,
-    0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x00, 0xA8, 0x03, 0xF8, 0x07, 0xF0,
-    0x0F, 0xC0, 0x3F, 0x00, 0x78, 0x00, 0x00, 0x00, 0x15, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x4B, 0xC3, 0xE1, 0xF0, 0xB4, 0x14, 0x00, 0xBC, 0x00, 0x07, 0xDF, 0xC0, 0x00, 0x7D, 0xFC, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0xF4, 0xFC, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x80, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x15, 0x01, 0x43, 0xF0, 0xFC,
-    0x3F, 0x0F, 0x83, 0xF0, 0xF0, 0x3F, 0x1E, 0x03, 0xF2, 0xC0, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x24, 0x0F, 0xC0, 0x0F, 0xD0, 0xFC, 0x00, 0xFD, 0x0F, 0xC0, 0x0B, 0xC0, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE,
-    0x15, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x24, 0x3F, 0x3F, 0x4F, 0xCF, 0xD3,
-    0xF2, 0xF0, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x0B, 0x40, 0x00, 0x3F, 0x5F, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x13,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x50, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80,
-    0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x40, 0x1F, 0xBD, 0x01,
-    0xFF, 0xE0, 0x1F, 0xF4, 0x0B, 0xF8, 0x03, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8,
-    0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF,
-    0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4,
-    0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40,
-    0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00,
-    0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC,
-    0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC,
-    0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0,
-    0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBC, 0xFF,
-    0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC, 0xFF, 0xF4,
-    0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC, 0x3F, 0x40,
-    0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC, 0xFC, 0x03, 0xF4, 0x00,
-    0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC, 0x00, 0x3F, 0x40, 0xBC,
-    0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00, 0x03, 0xF0, 0xBC, 0xFC,
-    0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00,
-    0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B,
-    0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0xF8, 0x00,
-    0x00, 0x1F, 0x87, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00,
-    0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00,
-    0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC,
-    0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC,
-    0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00,
-    0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00,
-    0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x02, 0x40, 0x01, 0x90, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0xFC,
-    0x2F, 0x40, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF4, 0x3F, 0xF9,
-    0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xC2, 0xE0,
-    0x7F, 0xFD, 0x02, 0xE0, 0xFC, 0xFF, 0xFF, 0xE0, 0x50, 0x3F, 0xFD, 0x56, 0xFD, 0x00, 0x0F, 0xF8,
-    0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x00,
-    0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0xBC, 0xBE, 0x00, 0x00, 0x00,
-    0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0xBC,
-    0xFF, 0xF8, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00, 0xBC, 0xFC,
-    0x3F, 0x80, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xF0, 0x00, 0xBC, 0xFC, 0x03,
-    0xF8, 0x00, 0xBC, 0xFC, 0x00, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xBF, 0x00, 0xBC, 0xFC, 0x00, 0x3F,
-    0x80, 0xBC, 0xFC, 0x00, 0x0F, 0xC0, 0xBC, 0xFC, 0x00, 0x07, 0xF0, 0xBC, 0xFC, 0x00, 0x03, 0xF8,
-    0xBC, 0xFC, 0x00, 0x00, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x3F, 0xFC,
-    0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x05, 0x5B, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFF, 0x90, 0x3D,
-    0x7F, 0xFF, 0xF4, 0x3F, 0xF9, 0x57, 0xFC, 0x3F, 0xD0, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x7F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x26, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07,
-    0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00, 0x7F,
-    0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xFD,
-    0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE, 0x00,
-    0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00,
-    0x0B, 0xEA, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD,
-    0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00,
-    0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF,
-    0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x60, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0xBE, 0xAB,
-    0xE0, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F,
-    0xD0, 0x0F, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B,
-    0xD3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x2F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x0A, 0x80, 0x00, 0x00,
-    0x2F, 0x82, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0xA8, 0x00, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0xFC,
-    0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x2C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD,
-    0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD,
-    0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00,
-    0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xF9,
-    0x6B, 0xFF, 0xFF, 0xFF, 0x0B, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFE, 0xAA, 0xA8, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xF7, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0xF9,
-    0x56, 0xFF, 0xAA, 0xAA, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x02, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x40, 0x0F,
-    0xE5, 0x6F, 0xE3, 0xF9, 0x1B, 0xF0, 0x0F, 0xD0, 0x00, 0xBF, 0xF4, 0x00, 0x7F, 0x07, 0xE0, 0x00,
-    0x0F, 0xF8, 0x00, 0x0F, 0xD2, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xBF, 0xCF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xF0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0xA8, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF9, 0x06,
-    0xFC, 0xFF, 0x40, 0x6F, 0x00, 0x7F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0x90, 0x00, 0x01, 0x40, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80,
-    0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00,
-    0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F,
-    0xE5, 0x56, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD,
-    0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC,
-    0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B,
-    0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xA4, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0,
-    0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xFD,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5, 0x56, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F,
-    0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xBC, 0x01,
-    0xF4, 0x00, 0x02, 0xF4, 0xBD, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xA4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xC0, 0x00, 0xBF, 0x80, 0xFC,
-    0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B,
-    0xD0, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xF8, 0x0F, 0xE5,
-    0x56, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xFD, 0x00, 0xFD, 0x00,
-    0x0F, 0xC0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xE0,
-    0xFC, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x02, 0xFC, 0x64, 0x00, 0x19, 0x3E, 0x00, 0xBC, 0x0F,
-    0xC3, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x0B, 0xFC, 0x3D, 0x3F, 0xFC, 0x3D, 0xBE, 0x98, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0,
-    0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0, 0x06, 0xFC, 0x7F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x01, 0xF8, 0x0B, 0xD0, 0x03, 0xD0,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95,
-    0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1A,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0x5F, 0xC0, 0x0B, 0xC0, 0x7E, 0x01,
-    0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xD0, 0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0,
-    0x06, 0xFC, 0x7F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00,
-    0x14, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9,
-    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0xBD, 0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE,
-    0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC3, 0xFD, 0x05, 0xF4, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xBD, 0x7D, 0x00, 0x6F, 0xC7, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x02, 0xF4, 0x07, 0xE0, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x2F, 0xBE, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFE, 0xAB, 0xF8, 0x1F, 0xC0, 0x00, 0x14,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF9, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD,
-    0x10, 0x00, 0x01, 0xFC, 0x7F, 0x95, 0x5F, 0xF4, 0x7F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFE, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x19, 0x00, 0x06, 0x40, 0xF8, 0x02, 0xF0, 0x03, 0xF0, 0xFC, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xD0, 0x5F, 0x43, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xD7, 0xD0, 0x06, 0xFC, 0x7F, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x15, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0x40,
-    0x00, 0x0F, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00,
-    0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x90, 0x00, 0x64, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0xBD, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF0, 0x00,
-    0xF0, 0x00, 0xF0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x17, 0xF5, 0x54, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x15, 0x5F, 0xD5, 0x40, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x2B, 0xFA, 0xA4, 0x3F, 0xFF, 0xFC, 0x2B,
-    0xFA, 0xA8, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0x40,
-    0x00, 0x05, 0x00, 0x08, 0x00, 0x02, 0xFF, 0x80, 0xB0, 0x00, 0x1F, 0xFF, 0xEB, 0xC0, 0x00, 0xB4,
-    0x2F, 0xFD, 0x00, 0x02, 0x80, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00,
-    0x00, 0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xBE,
-    0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x01, 0xFF, 0x80, 0xB0,
-    0x03, 0xFF, 0xFA, 0xF0, 0x0B, 0x41, 0xFF, 0xD0, 0x0B, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F,
-    0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF,
-    0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xA0, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x95, 0x6F, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01,
-    0xAA, 0xAA, 0x80, 0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F,
-    0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0xA0, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0xEA, 0xBE, 0x00, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x03, 0xF2, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0xBE, 0x0F,
-    0xF0, 0x00, 0x0B, 0xF0, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x02, 0x80, 0x01, 0x90, 0x02, 0xD0, 0x03, 0xC0, 0x01,
-    0xFA, 0xAF, 0xC0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F,
-    0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xF9, 0xF4, 0x00, 0x00, 0x07, 0x40,
-    0xF0, 0x00, 0x00, 0x1D, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F,
-    0x00, 0x00, 0x00, 0xFC, 0xBE, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xFC, 0x00,
-    0x02, 0xFC, 0x03, 0xFE, 0x55, 0xBF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x3E,
-    0x7E, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x74, 0x0F, 0x00, 0x00, 0x3C, 0x1F, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00,
-    0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF,
-    0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x80, 0xA8, 0x00, 0x00,
-    0x7F, 0x0B, 0xE0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x2F, 0x02, 0xF0, 0x00, 0x00, 0xF4, 0x1F,
-    0x00, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x1A, 0x02, 0xA0, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0xFC, 0x0F, 0xC0, 0x01, 0xF4, 0x2F, 0x00, 0x03, 0xD0, 0x3D, 0x00, 0x0B, 0x40, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F,
-    0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00,
-    0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC,
-    0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00,
-    0x02, 0xF8, 0x3F, 0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x56, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x1F,
-    0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0x3F,
-    0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00,
-    0x3F, 0x1F, 0x80, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x01, 0xFC, 0x7E, 0x00,
-    0x00, 0xBF, 0x0F, 0xC0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x2F, 0xF0, 0xBF, 0x80, 0x6F, 0xFC, 0x0F,
-    0xFF, 0xFF, 0x3F, 0x00, 0xBF, 0xFE, 0x0F, 0xC0, 0x00, 0x50, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F,
-    0xE8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF5,
-    0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0x0B,
-    0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0x7E, 0xF0, 0x00, 0x0B, 0xD0, 0x3F,
-    0x00, 0x02, 0xF7, 0xE0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0xFC, 0x02, 0xF4,
-    0x00, 0x7E, 0x2F, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x02, 0xF0, 0x7D, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x0F, 0xC0, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0xBD, 0x01,
-    0xF4, 0x0B, 0xD0, 0x1F, 0x80, 0x01, 0xF8, 0x0F, 0xC0, 0x0F, 0x80, 0xBD, 0x00, 0x03, 0xF0, 0x3F,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF4, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0x2F, 0x4B, 0xC0,
-    0x01, 0xF8, 0x7D, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0xFC, 0xF8, 0x00,
-    0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x07, 0xEF, 0x00, 0x00,
-    0x3E, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x02, 0xFC, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x3F,
-    0xC0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0xBF, 0xF0, 0x00, 0xFC,
-    0x1F, 0x80, 0x0F, 0xAF, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0xF5, 0xF4, 0x02, 0xF4, 0x0F, 0xC0, 0x1F,
-    0x0F, 0x80, 0x3F, 0x00, 0xBD, 0x03, 0xF0, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x3E, 0x07, 0xD0, 0x7D,
-    0x00, 0x3F, 0x07, 0xD0, 0x3E, 0x0B, 0xC0, 0x03, 0xF0, 0xBC, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x4F,
-    0x80, 0x2F, 0x0F, 0x80, 0x00, 0xF9, 0xF4, 0x00, 0xF5, 0xF4, 0x00, 0x0F, 0xEF, 0x00, 0x0F, 0xAF,
-    0x00, 0x00, 0xBE, 0xE0, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xFD, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x7E,
-    0x02, 0xF0, 0x00, 0x03, 0xD0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80,
-    0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0,
-    0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x01, 0xF8, 0xFD, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00,
-    0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E,
-    0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00,
-    0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0,
-    0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0,
-    0x3F, 0x00, 0x00, 0x0B, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0xFD,
-    0x00, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFD, 0x00,
-    0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x69, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x07, 0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x90, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x09, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC1, 0x55,
-    0x56, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x4B,
-    0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xD0, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x7D, 0x00, 0xF8, 0x00,
-    0x07, 0xE1, 0xF8, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF,
-    0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x19,
-    0x00, 0x06, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x15, 0x55, 0x6F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF5, 0x55, 0x54, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFD, 0x00, 0x15, 0x40, 0x0F, 0xFF, 0xC0,
-    0xFF, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x6F, 0xFF, 0x90, 0x02, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x02, 0xFF, 0xE5, 0xBF, 0xF8,
-    0x7E, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00,
-    0x02, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x1F,
-    0xE0, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFE, 0x01, 0xF8,
-    0x00, 0xFF, 0xFF, 0xF4, 0xFC, 0x00, 0xFF, 0x55, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F,
-    0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x1F,
-    0x80, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0xD0, 0x00, 0x07,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x01, 0xBF, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFC, 0x00, 0xBF, 0xE9, 0xAF, 0xFA, 0xFE, 0x5B, 0xFC, 0x0B, 0xF8,
-    0x00, 0x0B, 0xFF, 0x00, 0x07, 0xF4, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xE3, 0xF8, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0xFC, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF0, 0x3F, 0xF5, 0x57, 0xFE, 0x00, 0x00,
-    0x0F, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xFF, 0x90, 0x2F, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x3F, 0xFF, 0xC0, 0x1F, 0xE5, 0x6F, 0xFE,
-    0x57, 0xFC, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x0B, 0xD2, 0xF4,
-    0x00, 0x03, 0xF0, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x2F, 0x40,
-    0x1F, 0x4F, 0xC0, 0x00, 0x0B, 0xE0, 0x07, 0xD3, 0xF0, 0x00, 0x02, 0xF8, 0x01, 0xF4, 0xFC, 0x00,
-    0x00, 0xBD, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0x4B, 0xD0, 0x00, 0x0F, 0xC0, 0x07,
-    0xD1, 0xF8, 0x00, 0x07, 0xF0, 0x01, 0xF4, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x7D, 0x07, 0xF8, 0x07,
-    0xF8, 0x00, 0x1F, 0x40, 0x7F, 0xFF, 0xF8, 0x00, 0x07, 0xD0, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xF4,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xD0, 0xFC, 0x00, 0x1F, 0xF0, 0xBC, 0x0F, 0xC0, 0x00, 0x3F, 0x8B, 0xC0, 0xFC,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00,
-    0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xEA, 0xA9, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xFF, 0x80, 0x0F, 0x9F, 0xFF, 0xFC,
-    0x03, 0xFF, 0x95, 0xBF, 0xC0, 0xFF, 0x40, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
-    0x0F, 0xD3, 0xF0, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0,
-    0x00, 0x07, 0xE3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x3F, 0x4F,
-    0xE0, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x0F, 0xE0, 0xFF, 0xE0, 0x1F, 0xF0, 0x3E, 0xBF, 0xFF, 0xF0,
-    0x0F, 0x87, 0xFF, 0xE0, 0x03, 0xF0, 0x05, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE5, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x00, 0xFD, 0x00, 0x5F, 0xF4, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0xFD, 0x0F,
-    0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFD, 0x00, 0x0F, 0xEA, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF4,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x0F, 0xC0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x07, 0xFA, 0xAF, 0xF4, 0x02, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x05, 0x0F, 0xF9, 0x56,
-    0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0xF9, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0xFF, 0x80,
-    0x0B, 0xFF, 0x80, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x3F, 0x90, 0x07, 0xC1, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x54, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA,
-    0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x54, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0xFE, 0x7F, 0x00, 0x02,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFE,
-    0x59, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x3F, 0xFD, 0x00, 0x01, 0xBD, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x1A, 0xFC, 0x00, 0x2F, 0xF8,
-    0x00, 0x1F, 0xE0, 0x06, 0xFF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xAF, 0x40, 0x2F, 0x40, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x50, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xF8, 0x02, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x17, 0xF5, 0x54, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFD,
-    0x00, 0x2F, 0xFD, 0x00, 0x01, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0x90, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x2F, 0x43,
-    0xF3, 0xF0, 0x00, 0x00, 0x0B, 0xD1, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0xBF, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xE5,
-    0x5B, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xD0, 0x00, 0x03, 0xE0, 0xFC, 0x7E, 0x00, 0x00,
-    0x3F, 0x3F, 0x47, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x00, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x1B, 0xFF, 0x00, 0x00,
-    0xFF, 0xFF, 0xF3, 0xF0, 0x00, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x3C, 0x01, 0xA4, 0x0F, 0xD0,
-    0xFD, 0x0B, 0xE0, 0x3E, 0x02, 0xD0, 0x00, 0x00, 0x69, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-    0x0F, 0xD7, 0xF0, 0x2F, 0x00, 0xFC, 0x78, 0x00, 0x2D, 0x01, 0x40, 0x01, 0x43, 0xFF, 0x00, 0xE2,
-    0xFF, 0xFE, 0xF4, 0xF0, 0x7F, 0xFC, 0x34, 0x01, 0xA8, 0x00, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55,
-    0x24, 0x00, 0x18, 0x3C, 0x00, 0x3C, 0x2F, 0xAA, 0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x14,
-    0xBE, 0xBE, 0x7D, 0x00, 0x10, 0x00, 0x4B, 0xC0, 0x7D, 0xBD, 0x07, 0xE7, 0xC0, 0x3C, 0x15, 0x01,
-    0xFF, 0x81, 0x6F, 0x40, 0x2E, 0x00, 0xF4, 0x2F, 0xC0, 0xF4, 0x03, 0xC0, 0x05, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x3E, 0x7D, 0xB4, 0x1E, 0xB0, 0x0E, 0x78, 0x2E, 0x3F, 0xFC, 0x0B, 0xE0, 0x00, 0xA4,
-    0x1A, 0x40, 0xFD, 0x0F, 0xD0, 0x7E, 0x0B, 0xE0, 0x3F, 0x03, 0xE0, 0x2F, 0x02, 0xE0, 0x0E, 0x00,
-    0xE0, 0x00, 0x64, 0x00, 0x19, 0x3E, 0x00, 0xBC, 0x0F, 0xC3, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF,
-    0x40, 0x00, 0xBE, 0x00, 0x14, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x50, 0x05, 0xF8, 0x2F, 0xF8,
-    0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0x00, 0x00, 0x2A, 0x02, 0xA0, 0x0F, 0xD0, 0xFD, 0x00,
-    0xFC, 0x0F, 0xC0, 0x0F, 0x81, 0xF4, 0x01, 0xF0, 0x1F, 0x00, 0x0E, 0x01, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x24, 0x28, 0x18, 0x3C, 0x00, 0x3C, 0x2F,
-    0xAA, 0xF8, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x6A, 0x00, 0x0B, 0xFF, 0xE0, 0x1F, 0xEB,
-    0xF8, 0x3D, 0x00, 0x3C, 0x38, 0x00, 0x2C, 0x02, 0xC0, 0x7C, 0x0B, 0xC0, 0xF8, 0x2F, 0x43, 0xF0,
-    0x3F, 0x07, 0xF0, 0x15, 0x00, 0x0F, 0xD0, 0xFC, 0x1F, 0xC1, 0xF8, 0x2F, 0x03, 0xF0, 0x3D, 0x07,
-    0xC0, 0x14, 0x00, 0x7E, 0x07, 0xF0, 0x3F, 0x02, 0xF4, 0x1F, 0x80, 0xFC, 0x0B, 0xC0, 0x3C, 0x01,
-    0x40, 0x0B, 0xD0, 0xFD, 0x0F, 0xC1, 0xF8, 0x2F, 0x43, 0xF0, 0x3E, 0x03, 0xC0, 0x14, 0x00, 0x2A,
-    0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2C, 0x00, 0xA8, 0x02, 0xFC, 0x07,
-    0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0x01, 0xF0, 0x05, 0x00, 0x0F, 0x40, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0xF4, 0x05, 0x00, 0x15,
-    0x55, 0x4B, 0xFF, 0xFC, 0x6A, 0xAB, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03,
-    0xC0, 0x00, 0x3C, 0x00, 0x02, 0x80, 0x00, 0x14, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xFC, 0x07, 0xF4,
-    0x7F, 0xD0, 0x7F, 0x00, 0x10, 0x00, 0x05, 0x3F, 0x78, 0xB0, 0xB0, 0x78, 0x2F, 0x05, 0x01, 0x40,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xFE, 0x7F, 0xFD, 0x15, 0x54, 0xBF, 0xFE, 0x6B, 0xE9,
-    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x6F, 0xF9, 0xBF, 0xFE,
-    0x17, 0xD4, 0x03, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x50, 0x2F, 0x02,
-    0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xFA, 0xFE, 0xFF, 0xCB, 0xE4, 0x54, 0x0F, 0x80, 0xF8, 0x0F,
-    0x80, 0xF8, 0x0F, 0x80, 0xFC, 0x0B, 0xFA, 0x7F, 0xF1, 0xBE, 0x3C, 0xBE, 0xBE, 0x3C, 0x10, 0x00,
-    0x4B, 0xC0, 0x7D, 0xBD, 0x07, 0xE7, 0xC0, 0x3C, 0x00, 0x00, 0x1F, 0xF4, 0x3E, 0x7D, 0xB4, 0x1E,
-    0xB0, 0x0E, 0x78, 0x2E, 0x3F, 0xFC, 0x0B, 0xE0, 0x0F, 0xC0, 0xF8, 0x1F, 0x42, 0xE0, 0x3C, 0x01,
-    0x00, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0xF4, 0x00, 0xBC, 0x00, 0x3D, 0x00, 0x7C, 0x7F, 0xF8, 0x3F,
-    0xD0, 0x01, 0x00, 0xF4, 0x2E, 0x07, 0xC0, 0xB8, 0x0B, 0xC0, 0xBF, 0xA3, 0xFF, 0x01, 0x40, 0x14,
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x00, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAF, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0x50, 0x00, 0x05, 0x78, 0x0F, 0x01, 0xD3, 0xC0,
-    0xF0, 0x3C, 0x2F, 0xFF, 0xFF, 0x80, 0x7E, 0x0B, 0xD0, 0x64, 0x00, 0x19, 0x3E, 0x00, 0xBC, 0x0F,
-    0xC3, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x69, 0x00, 0x00, 0xFF,
-    0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xD7, 0xF0, 0x2F, 0x01, 0xF8, 0x78, 0x00, 0x2D, 0x24, 0x00, 0x18,
-    0x3C, 0x00, 0x3C, 0x2F, 0xAA, 0xF4, 0x0F, 0xFF, 0xE0, 0x01, 0xBE, 0x40, 0x00, 0x6A, 0x00, 0x0B,
-    0xFF, 0xE0, 0x1F, 0xEB, 0xF8, 0x3D, 0x00, 0x3C, 0x38, 0x00, 0x2C, 0x01, 0x50, 0x01, 0x80, 0xBF,
-    0xD0, 0x3C, 0x2F, 0xFF, 0xEF, 0x83, 0xC0, 0xBF, 0xF0, 0x38, 0x00, 0xB8, 0x00, 0xAA, 0xAA, 0xAF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x01, 0x40, 0x02,
-    0x0B, 0xFD, 0x02, 0xC7, 0xFF, 0xFA, 0xF2, 0xD0, 0xBF, 0xF0, 0xA0, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x1F, 0xE0, 0x0B, 0xF8, 0x0B, 0xFC, 0x07, 0xFD, 0x00, 0x7E, 0x00, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x50, 0xFC, 0x2E, 0x0F, 0x0F, 0x2E, 0xFC, 0x50, 0x50, 0x00, 0x05, 0xF4,
-    0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x1F, 0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
-    0x55, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAB, 0xD7, 0x80, 0x00, 0x2D, 0x78,
-    0x00, 0x02, 0xD7, 0x80, 0x00, 0x2D, 0x7F, 0xFF, 0xFF, 0xD2, 0xAA, 0xAA, 0xA8, 0x0B, 0xF5, 0xFE,
-    0x02, 0xFB, 0xFE, 0xF8, 0x3C, 0x0F, 0x03, 0xC7, 0x40, 0xB0, 0x1D, 0x14, 0x14, 0x3D, 0x7C, 0x2F,
-    0xF4, 0x0B, 0xE0, 0x1F, 0xF4, 0x3D, 0xBC, 0x14, 0x24, 0x06, 0xC2, 0xFC, 0x3D, 0x03, 0xD0, 0x2F,
-    0x00, 0xF8, 0x07, 0xC0, 0xBC, 0x3F, 0x43, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF,
-    0xF5, 0x55, 0x55, 0x55, 0x2A, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x2C,
-    0x00, 0xA8, 0x02, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, 0x2F, 0x00, 0x38, 0x00, 0x01, 0x50, 0x01, 0x80,
-    0xBF, 0xD0, 0x3C, 0x2F, 0xFF, 0xEF, 0x83, 0xC0, 0xBF, 0xF0, 0x38, 0x00, 0xB8, 0x00, 0x7F, 0x07,
-    0xFC, 0x07, 0xC0, 0x7C, 0x0F, 0x40, 0x90, 0x00, 0x0F, 0xD0, 0x01, 0x07, 0xF0, 0x03, 0xF2, 0xF5,
-    0xF4, 0xFC, 0xFC, 0x7E, 0x2E, 0x3D, 0x0F, 0x00, 0x0E, 0x00, 0x00, 0x14, 0x03, 0xD0, 0x3D, 0x03,
-    0xE0, 0x3F, 0xE0, 0xFD, 0x15, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFD, 0x7E, 0xAA, 0xAA, 0xBD,
-    0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x3D, 0x14, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x55, 0x50, 0x05, 0xF8, 0x2F,
-    0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0xF8, 0x2F, 0x00, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x01, 0x40, 0x00, 0x15, 0x3C, 0x18, 0x0B, 0xFF, 0x83,
-    0xC2, 0xFF, 0xFE, 0xF8, 0x3C, 0x2F, 0xFF, 0x03, 0x87, 0xCA, 0x80, 0x00, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x50, 0x00,
-    0x07, 0xF8, 0x03, 0xC1, 0xFF, 0xF9, 0xB8, 0x3D, 0x1F, 0xFF, 0x43, 0xC0, 0x2F, 0xD0, 0x00, 0x05,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x06, 0x80, 0x09, 0x2F,
-    0xF8, 0x2D, 0x3E, 0xBF, 0xFC, 0x74, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1E, 0x3F, 0xFE,
-    0x7D, 0x78, 0x7F, 0xFC, 0x70, 0x06, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x41, 0xD0, 0x2F, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFD, 0x0F, 0x41, 0xF0, 0x02, 0x41, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x0B, 0xE0, 0x2F, 0xF8, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xBF, 0xC0, 0x2F, 0xF8,
-    0x03, 0xFE, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x53, 0xC5, 0x00, 0x0F, 0x50, 0x00, 0xB2, 0x8E, 0x00, 0x05,
-    0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x09, 0x00, 0x00, 0x60, 0x00, 0x00, 0x20, 0x00, 0x00,
-    0x09, 0x00, 0x50, 0x70, 0x00, 0x00, 0x0E, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x90,
-    0x00, 0x00, 0x03, 0x0F, 0xF0, 0xD0, 0x00, 0x00, 0x07, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xA0, 0x70, 0x00, 0x00, 0x0E, 0x0A, 0x00, 0x70, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB1, 0x4E, 0x00, 0x00, 0xF0, 0x00,
-    0x63, 0xC9, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x2F, 0xF8, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xF8, 0x07, 0xFF, 0x00, 0x0F, 0x40, 0x7F,
-    0x80, 0xBE, 0x0B, 0xE7, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE1, 0xD0, 0xB4, 0x1E, 0x03,
-    0xF0, 0x2C, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x2F, 0x96, 0xF8, 0x3C, 0x00, 0x3C, 0x14, 0x3C,
-    0x14, 0x00, 0xBE, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x28, 0x00, 0x08, 0x20, 0x3E, 0xFC, 0x0F, 0xF4,
-    0x0F, 0xF0, 0x3F, 0xF8, 0x1D, 0x38, 0x00, 0x00, 0x00, 0x50, 0x7E, 0x7F, 0x8F, 0xC0, 0xBF, 0x40,
-    0xBE, 0x00, 0xA0, 0x40, 0x0F, 0x90, 0x3F, 0xD0, 0x7E, 0x1F, 0xEB, 0xE0, 0xA0, 0x00, 0x20, 0x00,
-    0x00, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0xE0, 0xBF, 0x00, 0x2F, 0x4F, 0xF0, 0x0B, 0xF5, 0xE7, 0x83,
-    0xF4, 0x2C, 0x3C, 0x34, 0x03, 0x81, 0xD0, 0x00, 0x2E, 0x07, 0xE0, 0x3C, 0x0B, 0x03, 0xC7, 0xD1,
-    0x90, 0x14, 0x7E, 0xBF, 0x7D, 0x00, 0x02, 0x80, 0x13, 0xC4, 0x3F, 0xFC, 0x7F, 0xFD, 0x0B, 0xE0,
-    0x2E, 0xB8, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x5F, 0xE0, 0x3F, 0xBF, 0xEF, 0xC7, 0x80,
-    0xF0, 0x2C, 0x74, 0x0F, 0x01, 0xD7, 0x80, 0xF0, 0x2C, 0x3F, 0xBF, 0xEF, 0xC0, 0xBF, 0x0F, 0xE0,
-    0x00, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xAF, 0xFF, 0xF4,
-    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x93, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0xBF, 0x90, 0x00, 0x00, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xAF, 0xFF, 0xF4, 0x00, 0x01,
-    0xBF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00,
-    0x50, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x1E, 0x3F, 0xFB, 0xFF, 0xFF, 0xEA, 0xAF, 0xC7, 0x80, 0x00,
-    0x1B, 0xFF, 0xFF, 0xF4, 0xA0, 0x00, 0x00, 0x01, 0x6A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F,
-    0xF9, 0x40, 0x16, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x04, 0x1C, 0x00, 0x0D, 0x0B, 0xFD, 0x38, 0x0D, 0x30, 0x0D, 0x3D, 0xBD, 0x05, 0x40, 0x07,
-    0xF4, 0x1C, 0x1D, 0x34, 0x0A, 0x3F, 0xFF, 0x34, 0x00, 0x28, 0x00, 0x0F, 0xA9, 0x01, 0x54, 0x11,
-    0xC0, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC1, 0x00, 0x0B, 0xF4, 0x0B, 0x07, 0x43, 0x00, 0xB1, 0xC0,
-    0x1C, 0x70, 0x07, 0x0D, 0x02, 0x81, 0xEB, 0xC0, 0x05, 0x40, 0x30, 0x0A, 0x30, 0x0A, 0x30, 0x0A,
-    0x30, 0x0A, 0x30, 0x0A, 0x34, 0x0E, 0x2E, 0xBE, 0x05, 0x40, 0x0B, 0xF0, 0xF0, 0x47, 0x00, 0x1C,
-    0x00, 0x70, 0x00, 0xD0, 0x01, 0xEA, 0x40, 0x54, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x0B, 0xEA,
-    0x38, 0x1E, 0x70, 0x0E, 0x70, 0x0A, 0x70, 0x0A, 0x34, 0x0E, 0x2E, 0xBE, 0x01, 0x40, 0x30, 0x00,
-    0x34, 0x00, 0x34, 0x00, 0x36, 0xF8, 0x3C, 0x0E, 0x34, 0x0B, 0x34, 0x0B, 0x34, 0x0B, 0x34, 0x0B,
-    0x34, 0x0B, 0x10, 0x01, 0x67, 0xF1, 0xFD, 0x1E, 0x0B, 0x82, 0xC7, 0x01, 0xC0, 0x31, 0xC0, 0x70,
-    0x0C, 0x70, 0x1C, 0x03, 0x1C, 0x07, 0x00, 0xC7, 0x01, 0xC0, 0x30, 0x40, 0x10, 0x04, 0x67, 0xCB,
-    0xD0, 0xB0, 0x0B, 0x00, 0xB0, 0x0B, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x00, 0xD0, 0x2F, 0xE0, 0xD0,
-    0x0D, 0x00, 0xD0, 0x0D, 0x00, 0xD0, 0x0B, 0x90, 0x15, 0x30, 0x07, 0x0D, 0x03, 0x81, 0xC0, 0xC0,
-    0x34, 0xB0, 0x0A, 0x34, 0x00, 0xDC, 0x00, 0x3D, 0x00, 0x01, 0x00, 0x24, 0x09, 0x03, 0x4B, 0x00,
-    0x77, 0x00, 0x0B, 0x40, 0x03, 0xE0, 0x03, 0x8E, 0x02, 0xC0, 0xD0, 0x40, 0x04, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0xBF, 0xFF, 0xE9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x00,
-    0x0B, 0xF8, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x7F, 0x0F, 0xFA, 0xAB, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0x00, 0x00, 0x7F, 0x8F, 0xC0, 0x00, 0x03,
-    0xF7, 0xF0, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0xFF, 0x3F, 0xAA, 0xAB, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF9, 0x00, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xF7, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0xBC, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x7D, 0x00, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x01,
-    0xF8, 0x00, 0x7E, 0x00, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00, 0x2F,
-    0x40, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x02, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x1F, 0xEA, 0xAA, 0xAA, 0xAF, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00,
-    0x01, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xFA, 0xAA, 0xAA,
-    0xBF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x55, 0x55, 0x50,
-    0x3F, 0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x01,
-    0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0xFC,
-    0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x0F, 0xC2, 0xFC, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xF8,
-    0xBF, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-    0x0F, 0xC0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0xFC, 0x00,
-    0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0xF0, 0xFC, 0x00, 0x00, 0x3F, 0x8F, 0xC0, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0xF4, 0xF4, 0x00, 0x00,
-    0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0xF8, 0x00, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0xF8, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0x40, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xF4, 0x00, 0x00, 0x0F, 0xBF, 0xFC, 0xF8, 0x00, 0x00,
-    0x1F, 0x3F, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0xFC, 0x7D, 0x00, 0x00, 0x3D, 0x3F, 0xFC, 0x3F,
-    0x00, 0x00, 0xBC, 0x3F, 0xFC, 0x2F, 0x00, 0x00, 0xF8, 0x3F, 0xFC, 0x1F, 0x80, 0x01, 0xF4, 0x3F,
-    0xFC, 0x0F, 0xC0, 0x02, 0xF0, 0x3F, 0xFC, 0x0B, 0xD0, 0x03, 0xE0, 0x3F, 0xFC, 0x03, 0xE0, 0x0B,
-    0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x01, 0xF4, 0x1F, 0x40, 0x3F, 0xFC, 0x00,
-    0xFC, 0x2F, 0x00, 0x3F, 0xFC, 0x00, 0xBC, 0x3E, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7D, 0x00, 0x3F,
-    0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xBE, 0x00,
-    0x00, 0x00, 0xBC, 0xFF, 0x80, 0x00, 0x00, 0xBC, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0xFF, 0xF0, 0x00,
-    0x00, 0xBC, 0xFF, 0xF4, 0x00, 0x00, 0xBC, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0xFC, 0xBF, 0x00, 0x00,
-    0xBC, 0xFC, 0x3F, 0x40, 0x00, 0xBC, 0xFC, 0x1F, 0xC0, 0x00, 0xBC, 0xFC, 0x0B, 0xE0, 0x00, 0xBC,
-    0xFC, 0x03, 0xF4, 0x00, 0xBC, 0xFC, 0x01, 0xFC, 0x00, 0xBC, 0xFC, 0x00, 0xFE, 0x00, 0xBC, 0xFC,
-    0x00, 0x3F, 0x40, 0xBC, 0xFC, 0x00, 0x2F, 0xC0, 0xBC, 0xFC, 0x00, 0x0F, 0xE0, 0xBC, 0xFC, 0x00,
-    0x03, 0xF0, 0xBC, 0xFC, 0x00, 0x02, 0xFC, 0xBC, 0xFC, 0x00, 0x00, 0xFD, 0xBC, 0xFC, 0x00, 0x00,
-    0x7F, 0xBC, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B,
-    0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00,
-    0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00,
-    0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00,
-    0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x03, 0xF3, 0xF0,
-    0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0xFF, 0xA4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x0B, 0xF8, 0xFC, 0x00, 0x02,
-    0xFC, 0xFC, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00,
-    0xFD, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x02, 0xFC, 0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xAA, 0x90, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xEA, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4,
-    0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00,
-    0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xE4, 0x1F, 0x81, 0xBF, 0xD0, 0x0F, 0xF0,
-    0x01, 0xF8, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF8, 0x3F, 0x40, 0x01, 0xF8, 0x00,
-    0x1F, 0xC3, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD7, 0xF0,
-    0x00, 0x1F, 0x80, 0x00, 0xBD, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0xFC, 0x3F, 0x40, 0x01, 0xF8, 0x00, 0x0F, 0xC2, 0xF8, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x0F,
-    0xE0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x7F, 0xC0, 0x1F, 0x80, 0x2F, 0xD0, 0x01, 0xFF, 0xEA, 0xFE,
-    0xBF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xE8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xF4, 0x2F, 0xC0, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00,
-    0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x00, 0xBD,
-    0x00, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0x1F,
-    0x83, 0xF0, 0x00, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00,
-    0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0xBE, 0x00, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x2F, 0x00, 0x0B,
-    0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00,
-    0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00,
-    0x0B, 0xDF, 0xC0, 0x03, 0xF0, 0x00, 0xBD, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xDF, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xCB, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x3F,
-    0x00, 0x2F, 0x83, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0xF4, 0x3F, 0x02, 0xFE, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x6B, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xF9, 0x6F, 0xFD, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00,
-    0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x40,
-    0x01, 0xFC, 0x00, 0x2A, 0xAF, 0xE0, 0x0B, 0xFA, 0xA8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x0B, 0x80, 0x01,
-    0xFF, 0xFF, 0xCF, 0x80, 0x07, 0xF9, 0x57, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x1F, 0xC0,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x3F, 0x80,
-    0x0F, 0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x06, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xCF, 0xFC, 0x00,
-    0x7F, 0xFE, 0x03, 0xFC, 0x00, 0x01, 0x40, 0x00, 0x50, 0x00, 0x05, 0x54, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x1F, 0xF0, 0x2F, 0xC0, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x2F, 0x43, 0xF0, 0x00, 0x07, 0xE0, 0xFC, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0xFC, 0x15, 0xBF, 0x00, 0x3F, 0x0F, 0xFE, 0x00,
-    0x0F, 0xC3, 0xFF, 0xF8, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x2F, 0x4F, 0xC0, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x0B, 0xF0, 0xFF, 0x90, 0x1F, 0xF4, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0xEF, 0xFF, 0xE0, 0x03, 0xF0, 0x15, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x2F, 0x40,
-    0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xE0, 0x1F, 0x80, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0xBC,
-    0x00, 0xBC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x1F, 0x40, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBC, 0x07,
-    0xD0, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x03, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xF0, 0x03, 0xF4, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x08, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0xF4, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x03, 0xF4, 0x00, 0x3F,
-    0x42, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00,
-    0x03, 0xF7, 0xE0, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x3E, 0x7F, 0x00, 0x00, 0x1F, 0x8F, 0xD0,
-    0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0xE0, 0x1F, 0xF0, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x0B,
-    0xFF, 0xFF, 0xD1, 0xFE, 0x45, 0xBC, 0x3F, 0x40, 0x00, 0x43, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x0B, 0xF9, 0x50, 0x00, 0x1F, 0xFF, 0x40, 0x07, 0xFF, 0xF4, 0x02, 0xFC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x3F, 0xE4, 0x06, 0xD0, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x55, 0x00, 0x05, 0x55,
-    0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0B,
-    0xFF, 0x80, 0x3D, 0x7F, 0xFF, 0xF0, 0x3F, 0xF9, 0x5B, 0xFC, 0x3F, 0xD0, 0x00, 0xFC, 0x3F, 0x80,
-    0x00, 0xBD, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0x7E, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0x54, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x1F, 0xE0, 0x0B, 0xE0, 0x00, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1,
-    0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x03,
-    0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0,
-    0x00, 0x03, 0xF2, 0xF0, 0x00, 0x01, 0xF8, 0xBD, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x1F, 0xC0, 0x7E, 0x00, 0x0F, 0xD0, 0x0F, 0xE4, 0x1F, 0xE0, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01,
-    0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07,
-    0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xFF, 0x41,
-    0xFF, 0xD0, 0x01, 0x40, 0x3F, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x2F, 0xC0,
-    0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x01, 0xFD, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3F, 0x0F, 0xE0, 0x00,
-    0x3F, 0x3F, 0x80, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xD7, 0xF0, 0x00,
-    0x3F, 0x42, 0xF8, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x2F, 0xC0,
-    0x3F, 0x00, 0x0F, 0xE0, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x01, 0xFC, 0x55, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFB,
-    0xC0, 0x00, 0x00, 0x3F, 0x7D, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0xBC, 0x2F, 0x00, 0x00,
-    0x0F, 0xC1, 0xF8, 0x00, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x07,
-    0xE0, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x1F,
-    0x80, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x3F, 0xDB, 0xE0, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00,
-    0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F,
-    0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x2F, 0xF0, 0x0F, 0xF9, 0x06,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x2F, 0xF0, 0xF9, 0xFF, 0xE0, 0x3F, 0xC3, 0xE0, 0x14, 0x00, 0x04,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x2F, 0x40, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xBC, 0x00, 0x03, 0xE0,
-    0x1F, 0x80, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x1F,
-    0x40, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x03, 0xF3,
-    0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05,
-    0x55, 0x55, 0x50, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x90, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xE5, 0x54, 0x00, 0x2F, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0x80, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE,
-    0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x15, 0xFD, 0x55, 0x5B, 0xE5, 0x40, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-    0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00,
-    0x7E, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x03, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xD5, 0x7F, 0xC0, 0x2F,
-    0xC0, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x07, 0xE2, 0xF4, 0x00, 0x00, 0xFC,
-    0xBD, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00,
-    0xFC, 0xBD, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x0F, 0xD2, 0xF8, 0x00,
-    0x07, 0xF0, 0xBF, 0xE4, 0x1B, 0xF0, 0x2F, 0xFF, 0xFF, 0xF4, 0x0B, 0xDB, 0xFF, 0xE0, 0x02, 0xF0,
-    0x05, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0x95, 0xB4,
-    0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x40,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x2A, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xF9, 0x6F,
-    0xD5, 0x02, 0xFC, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x01, 0xFE, 0x41, 0xBF, 0x00, 0x01,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0x15, 0x7F, 0x95, 0x54, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x05, 0x40, 0x7D, 0x00, 0x00, 0xF8, 0x7E, 0x00,
-    0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00,
-    0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00,
-    0x00, 0x7E, 0x7E, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x03, 0xF4, 0x2F, 0xD0, 0x1F, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF,
-    0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x6F,
-    0x9B, 0xF8, 0x00, 0xBF, 0x01, 0xF8, 0x0F, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x42, 0xF8, 0x01,
-    0xF8, 0x01, 0xFC, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xF0, 0x01, 0xF8, 0x00, 0xFD, 0x3F, 0x00,
-    0x1F, 0x80, 0x0B, 0xD3, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xD3, 0xF0,
-    0x01, 0xF8, 0x00, 0xFC, 0x2F, 0x40, 0x1F, 0x80, 0x1F, 0xC0, 0xFC, 0x01, 0xF8, 0x03, 0xF4, 0x0B,
-    0xF0, 0x1F, 0x80, 0xBF, 0x00, 0x2F, 0xE5, 0xF8, 0xBF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xBC, 0x3F, 0xE0, 0x00, 0x01, 0xF8, 0x1B, 0xF4, 0x00, 0x03, 0xF0,
-    0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x2F, 0x40, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x07,
-    0xE3, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x2F, 0x43, 0xF0, 0x00,
-    0x00, 0x7E, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0xD5, 0x1F, 0x80, 0x00, 0x0F, 0xFE, 0x3F, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x3F,
-    0x00, 0x3E, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0x03, 0xF1, 0xF8, 0x00, 0xFC,
-    0x00, 0xBD, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x5F, 0x80, 0x0F, 0xC0, 0x07, 0xE7, 0xE0, 0x03, 0xF0,
-    0x01, 0xF9, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0x9F, 0x80, 0x0F, 0xC0,
-    0x03, 0xE7, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0xF8, 0x00, 0xFC, 0x00, 0xBD, 0x3F, 0x00, 0x3F, 0x00,
-    0x3F, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xC1, 0xFC, 0x03, 0xF0, 0x1F, 0xD0, 0x2F, 0xE4, 0xFD, 0x7F,
-    0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x7E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF1, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00, 0xF8, 0x00, 0x2F, 0x6F, 0x00,
-    0x03, 0xE0, 0x00, 0xBD, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF7, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xDF,
-    0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x6F, 0x00, 0x03, 0xE0, 0x00, 0xBD, 0xBD, 0x00, 0x0F, 0xC0, 0x03,
-    0xF1, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xC3, 0xF4, 0x03, 0xFD, 0x00, 0xBE, 0x07, 0xF4, 0x2F, 0x7D,
-    0x0B, 0xF0, 0x0B, 0xFF, 0xF4, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0x40, 0xBF, 0xF4, 0x00, 0x00, 0x50,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB,
-    0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00,
-    0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0xF9, 0x46, 0xFD, 0x01, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x06, 0xAB, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xA5, 0x5F, 0xCF, 0xE0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00,
-    0x1F, 0xDF, 0xC0, 0x00, 0xFF, 0x3F, 0x80, 0x2F, 0xFC, 0x7F, 0xFF, 0xF5, 0xF0, 0x7F, 0xFE, 0x07,
-    0xC0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x5B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00,
-    0x03, 0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00,
-    0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x5B, 0xE0, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xE5, 0x1B, 0xF4, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x1A, 0xAF, 0xF0, 0x2F, 0xFF, 0xFF, 0xC3, 0xFE, 0x95, 0x7F, 0x3F, 0x80, 0x00,
-    0xFD, 0xFC, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x7F, 0x7F, 0x00, 0x03, 0xFC,
-    0xFE, 0x00, 0xBF, 0xF1, 0xFF, 0xFF, 0xD7, 0xC1, 0xFF, 0xF8, 0x1F, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x15, 0x02, 0xF0, 0x00,
-    0x00, 0x0B, 0xFC, 0x78, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00,
-    0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x1F, 0xFC, 0xA0, 0x00, 0x03, 0xE7, 0xE0, 0x00,
-    0x00, 0xF8, 0x0F, 0x80, 0x00, 0x2D, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x03, 0xE5, 0x1B, 0xF4, 0x00,
-    0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x6A, 0xBF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xA5, 0x5F, 0xC0, 0x3F,
-    0x80, 0x00, 0xFC, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x1F,
-    0xC0, 0x7F, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x02, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x7C, 0x00, 0x7F,
-    0xFE, 0x07, 0xC0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x15, 0x00, 0x00, 0x00, 0x0B, 0x8B, 0xFC, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00,
-    0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00,
-    0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x01, 0x93,
-    0xFF, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0xF9,
-    0x46, 0xFD, 0x00, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x01, 0xAA, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x03, 0xFE, 0x95, 0x7F, 0x0F, 0xE0,
-    0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x7F, 0x1F, 0xC0,
-    0x00, 0xFF, 0x0F, 0xE0, 0x0B, 0xFF, 0x07, 0xFF, 0xFF, 0x5F, 0x01, 0xFF, 0xF8, 0x1F, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x15, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xF8, 0x70, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00,
-    0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01,
-    0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0xF0,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x1D, 0x00, 0x00, 0xFF, 0xC2,
-    0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x74, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3E,
-    0x51, 0xBF, 0x40, 0x04, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1A, 0xAF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0xFE, 0x95, 0x7F,
-    0x03, 0xF8, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,
-    0x7F, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0xBF, 0xF0, 0x1F, 0xFF, 0xFD, 0x7C, 0x01, 0xFF,
-    0xF8, 0x1F, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x02, 0xE4, 0x0B, 0x00, 0x00, 0x00, 0xFF, 0xF6,
-    0xE0, 0x00, 0x00, 0x1E, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0x80, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3E,
-    0x1F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00,
-    0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00,
-    0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF,
-    0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00,
-    0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x14, 0x00, 0x40, 0x03, 0xFE, 0x07, 0x40,
-    0x1F, 0xBF, 0xFC, 0x00, 0xF0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0xF8, 0x0F, 0x80, 0x0B, 0x40, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF,
-    0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0,
-    0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B,
-    0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x2F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0xBD, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x1F, 0x8F, 0xD0, 0x01, 0xF8, 0x0B,
-    0xC0, 0x0F, 0x40, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9,
-    0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xE1, 0xF4, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01,
-    0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x01, 0x81, 0x81, 0x80, 0x07, 0x40, 0x0F, 0x00, 0x0F, 0x96, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x0B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF,
-    0xFF, 0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC,
-    0xFE, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC,
-    0x00, 0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xF4,
-    0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF4, 0x00, 0x00,
-    0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFA, 0xAA, 0xAB, 0xF4, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0xF4, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x01, 0x81, 0x81, 0x80,
-    0x07, 0x40, 0x0F, 0x00, 0x0F, 0x96, 0xF8, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0B, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94,
-    0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF, 0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7,
-    0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8,
-    0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F, 0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x7A, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x41, 0xD0, 0x00, 0x00,
-    0x0F, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40,
-    0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E,
-    0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x06, 0x0A, 0x06, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x3E, 0x5B, 0xF0, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x2B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF, 0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9,
-    0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF, 0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x0A, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xE0, 0x00, 0x00,
-    0x1E, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0x80, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x01, 0xD0, 0x00, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x00, 0x40, 0x02, 0xFE, 0x03, 0x80, 0x1F, 0xBF, 0xFC,
-    0x00, 0xB0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1D, 0x00, 0x3C, 0x00,
-    0x3E, 0x5B, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x51, 0xBF, 0x40, 0x40, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xAA, 0xFF,
-    0x02, 0xFF, 0xFF, 0xFC, 0x3F, 0xE9, 0x57, 0xF3, 0xF8, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0xFD, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xCF, 0xE0, 0x0B, 0xFF, 0x1F, 0xFF,
-    0xFD, 0x7C, 0x1F, 0xFF, 0x81, 0xF0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x0A, 0x00, 0x00,
-    0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0xEA, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xF0,
-    0x00, 0x00, 0x00, 0x3E, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B,
-    0xD0, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xAA, 0xAA, 0xBF, 0x40, 0x07, 0xE0,
-    0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x02, 0xF4,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x90, 0x07, 0x80, 0x0B, 0x40, 0x0F, 0xEA,
-    0xFC, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x94, 0x6F, 0xD0, 0x10, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x6A, 0xBF, 0xC0, 0xBF,
-    0xFF, 0xFF, 0x0F, 0xFA, 0x55, 0xFC, 0xFE, 0x00, 0x03, 0xF7, 0xF0, 0x00, 0x0F, 0xDF, 0x80, 0x00,
-    0x3F, 0x7E, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x0F, 0xF3, 0xF8, 0x02, 0xFF, 0xC7, 0xFF, 0xFF, 0x5F,
-    0x07, 0xFF, 0xE0, 0x7C, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA,
-    0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0F, 0xE4, 0x6F, 0xE0, 0x0F, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x2F, 0x82, 0xF4, 0x00,
-    0x03, 0xF0, 0xFC, 0x00, 0x00, 0xFC, 0x3F, 0xAA, 0xAA, 0xBF, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFA,
-    0xAA, 0xAA, 0xA0, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xFD, 0x41, 0x6D, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x56, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x50, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x56, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xF9, 0x1B, 0xF8, 0x03, 0xF4, 0x00,
-    0x3F, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x3F, 0x0F, 0xEA,
-    0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA, 0xA8, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x01, 0xFF, 0x50, 0x5B, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0xBF, 0xD0, 0x3C, 0x1F, 0xFF, 0xEF, 0xC2, 0xD0, 0xBF, 0xF0,
-    0x28, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA,
-    0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x14, 0x00, 0x24, 0x00, 0x7F, 0xE0, 0x1D, 0x00, 0x3F, 0xFF, 0xAF, 0x00, 0x1E, 0x07, 0xFF, 0x80,
-    0x07, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFE, 0x46, 0xFE, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x7E, 0x00,
-    0x02, 0xF8, 0x2F, 0x40, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0F, 0xC3, 0xFA, 0xAA, 0xAB, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAA, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16,
-    0xD0, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x15, 0x01, 0xF0, 0x00, 0x7F, 0xC3, 0xC0, 0x00, 0xFF,
-    0xF0, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x80, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x3F, 0x43, 0xD0, 0x00, 0x0F, 0xFD, 0x64, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0xBC, 0x0B,
-    0xC0, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xF9, 0x1B, 0xF8, 0x00, 0xFD, 0x00, 0x0F,
-    0xC0, 0x1F, 0x80, 0x00, 0xBE, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x3F, 0x03, 0xFA,
-    0xAA, 0xAB, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFA, 0xAA, 0xAA, 0xA0, 0x3F, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0xD4, 0x16, 0xD0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x50,
-    0x00, 0x03, 0xC3, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0xB8, 0x02,
-    0xE0, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF,
-    0xFE, 0x0F, 0xFF, 0xFF, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xEA, 0xAA,
-    0xA9, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xE0, 0x00, 0x02, 0x8B, 0xFD, 0x00, 0x00, 0x0B,
-    0xDB, 0xC0, 0x00, 0x07, 0xC0, 0xBC, 0x00, 0x03, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x03, 0xF9, 0x1B, 0xF8,
-    0x03, 0xF4, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x3F, 0x0F, 0xEA, 0xAA, 0xAF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFE, 0xAA, 0xAA, 0xA8, 0x3F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x5B, 0x40, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03,
-    0x80, 0x00, 0x00, 0x1E, 0x00, 0x15, 0x03, 0xE0, 0x01, 0xFF, 0x0E, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xF8, 0x3E, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x4F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0xAA, 0xAA, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xAA,
-    0x93, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x05, 0xF0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x01,
-    0xFD, 0x1D, 0x00, 0x00, 0xFF, 0xC2, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xB8, 0x0F, 0x80, 0x00,
-    0x74, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00,
-    0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4,
-    0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x02, 0xF4, 0x07,
-    0x00, 0xBF, 0xF5, 0xF0, 0x0F, 0x1F, 0xFD, 0x00, 0x80, 0x1A, 0x40, 0x00, 0x05, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0x0F, 0x80, 0x0F, 0x80, 0x2E, 0x00, 0x40, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0xAA, 0xAA,
-    0x9F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x04, 0x00, 0x50, 0x00, 0x2F, 0xF4, 0x38,
-    0x00, 0x0F, 0xBF, 0xFD, 0x00, 0x0B, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0xBC, 0x0B, 0xC0, 0x00, 0x78,
-    0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80, 0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE,
-    0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01,
-    0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0A, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x2F, 0x4F, 0xC0, 0x0B, 0xD0, 0x3F, 0x00, 0xE0, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x8F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0F, 0xEA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xF8,
-    0xBD, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x3F, 0x91, 0xBF, 0x80,
-    0x3F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03,
-    0xF0, 0xFE, 0xAA, 0xAA, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xEA, 0xAA, 0xAA, 0x83, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xF5, 0x05, 0xB4, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xF8, 0x02, 0xFF, 0xC0, 0x00, 0xF4,
-    0x00, 0x3D, 0x00, 0x2F, 0x00, 0x7F, 0x00, 0x1E, 0x00, 0x07, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xEB,
-    0xFF, 0xFC, 0x1F, 0xE4, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x42, 0xFF,
-    0xFF, 0xBF, 0xFF, 0xC0, 0x54, 0x03, 0xFF, 0x09, 0xBF, 0x00, 0x7C, 0x02, 0xF0, 0x7F, 0x43, 0xE0,
-    0x0B, 0x00, 0x04, 0x00, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0xBF, 0xFF, 0xAF, 0xFF, 0xF0, 0x7F, 0x90, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0x78, 0x00, 0x18, 0x1F, 0xC7, 0xF0, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3,
-    0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xB4, 0x7F, 0x1F, 0xC2, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0,
-    0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xD5, 0x7F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x7F, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x2F, 0x40, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0xFE,
-    0x00, 0x07, 0xF0, 0x03, 0xF9, 0x06, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8,
-    0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F,
-    0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x01, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57,
-    0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00,
-    0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC,
-    0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x3C, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02,
-    0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00,
-    0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8,
-    0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02,
-    0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x2F, 0x82, 0xE0, 0x00, 0x0B, 0xFE, 0x28, 0x00, 0x01, 0xFA, 0xF4, 0x00,
-    0x00, 0x7D, 0x07, 0xD0, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00,
-    0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02,
-    0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00,
-    0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00,
-    0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00,
-    0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95,
-    0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x2F, 0xC0, 0x00, 0x01, 0x87, 0xFE, 0x00, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3D,
-    0x07, 0xD0, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00,
-    0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F,
-    0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x15, 0x03,
-    0xE0, 0x00, 0x00, 0x03, 0xFC, 0x38, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFE,
-    0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00, 0x00, 0x7F,
-    0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x2F, 0x82, 0xC0, 0x00, 0x0B, 0xFE, 0x18, 0x00, 0x01, 0xFA, 0xF4, 0x00,
-    0x00, 0x7D, 0x07, 0xD0, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00,
-    0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02,
-    0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x07, 0x00, 0x00, 0x00, 0x7F,
-    0xF9, 0xF0, 0x00, 0x00, 0x0F, 0x1B, 0xFD, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x40, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x2E, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFE, 0x5B, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xDB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xD0, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x10, 0x00, 0x03, 0xFE, 0x0B, 0x00, 0x00, 0xBB, 0xFF, 0xF0, 0x00, 0x0E, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xFA,
-    0xF4, 0x00, 0x00, 0x3D, 0x07, 0xD0, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57,
-    0xFD, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00,
-    0xBD, 0x3F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC,
-    0x00, 0x02, 0xF8, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4,
-    0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00,
-    0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0x0F, 0xE0, 0x00, 0x00,
-    0x7F, 0x02, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x81, 0xFD,
-    0x00, 0x00, 0x07, 0xF0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x2F, 0xF9, 0x56, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x00, 0x00, 0xBD, 0x03,
-    0xF0, 0x00, 0x1E, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFD, 0x57, 0xFD, 0x00, 0xFE, 0x00, 0x07,
-    0xF0, 0x1F, 0xC0, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00, 0x0F,
-    0xD3, 0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x40, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xE0,
-    0x00, 0x7F, 0x00, 0x3F, 0x90, 0x6F, 0xD0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x06, 0xFF,
-    0xF9, 0x00, 0x2F, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x2F, 0xFE, 0x5B, 0xFF, 0x87, 0xE0,
-    0x1F, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xF0, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBE,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0xBF, 0xE5, 0x5B, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0x00, 0x3F,
-    0xD5, 0x7F, 0xFF, 0x40, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x0B, 0xD0,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00,
-    0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00,
-    0x07, 0xF0, 0x00, 0x0F, 0xE4, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x2F,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x2F, 0xFE, 0x5B, 0xFF, 0x87, 0xE0, 0x1F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBE, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x01,
-    0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xE5,
-    0x5B, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x2F, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0xFF, 0xFD, 0x3F, 0x00, 0x3F, 0xD5, 0x7F, 0xFF,
-    0x40, 0x3F, 0x80, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0,
-    0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00,
-    0x0F, 0xE4, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFC,
-    0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x7E, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0xFE, 0x00, 0x00,
-    0x0B, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0xE0, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x56, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0xA9, 0x00, 0x00, 0x40, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x02, 0xFF, 0xF8, 0x07, 0xE0, 0x03, 0xFF, 0xFF, 0xD3, 0xF0, 0x03,
-    0xFD, 0x57, 0xFF, 0xF4, 0x03, 0xF8, 0x00, 0x1F, 0xF0, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0xBD,
-    0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF4, 0x03, 0xF0,
-    0x00, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xD0,
-    0x00, 0x7F, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x01, 0x80, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xBD, 0x00, 0x7F, 0xFF, 0xFF, 0xD0,
-    0x3F, 0x00, 0xBF, 0xF9, 0x6F, 0xFE, 0x1F, 0x80, 0x7F, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0x02, 0xFF, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x00, 0x00,
-    0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x07, 0xF8, 0x00, 0x02, 0xFF, 0x95, 0x6F, 0xF8, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x18, 0x00, 0x00, 0x2F, 0xF4, 0x0F, 0x00, 0x00, 0x1F, 0xFF, 0xEF, 0x80,
-    0x00, 0x0F, 0x42, 0xFF, 0xC0, 0x00, 0x03, 0x80, 0x0B, 0x80, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0xFE, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0xFC,
-    0x00, 0xFF, 0x55, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0xFC, 0x00, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x90, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFC, 0x02, 0xFF, 0xE5, 0xBF, 0xF8, 0x7E, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xFE, 0x55, 0xBF, 0xE0, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0xBF, 0xFE, 0x01, 0xF8, 0x00, 0xFF, 0xFF, 0xF4, 0xFC, 0x00, 0xFF, 0x55, 0xFF,
-    0xFD, 0x00, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0x40, 0x3F, 0x00, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x90, 0x2F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00,
-    0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00,
-    0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02,
-    0xF7, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x02, 0xF8, 0x3F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E,
-    0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E,
-    0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00, 0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F,
-    0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8, 0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0,
-    0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00,
-    0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7,
-    0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0xFC, 0x00,
-    0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x2F, 0x7F, 0x00, 0x00, 0x00,
-    0xBD, 0xFC, 0x00, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x3F, 0x2F,
-    0x80, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0xFF, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x95,
-    0x6F, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x05, 0xBE, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00,
-    0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00,
-    0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00,
-    0x3F, 0x7E, 0x00, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x7E, 0x00, 0x00, 0xBF, 0x3F, 0x00, 0x00,
-    0xFF, 0x3F, 0x40, 0x02, 0xFF, 0x2F, 0xE0, 0x1B, 0xFF, 0x0F, 0xFF, 0xFF, 0x3F, 0x02, 0xFF, 0xF8,
-    0x2F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x3F, 0x00, 0x00,
-    0x00, 0xBD, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x2F, 0x4F, 0xC3, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE, 0x55, 0xBF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x7D, 0x00, 0x00, 0x3E, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF3, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xFE,
-    0x07, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0,
-    0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x07,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x02,
-    0xFF, 0x00, 0x02, 0xFE, 0x01, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x2F, 0xFF,
-    0x82, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0x3F, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x2F, 0x4F, 0xC3, 0xF0, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xFE,
-    0x55, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x3E, 0x0F, 0xC7, 0xE0, 0x00, 0x03, 0xF3, 0xF4, 0x7E,
-    0x00, 0x00, 0x3F, 0xFE, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00,
-    0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0x3F, 0x40, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x01, 0xBF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x3F,
-    0x00, 0x00, 0x2F, 0xFF, 0x82, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x2F,
-    0x47, 0xE3, 0xF0, 0x00, 0x00, 0x0B, 0xD3, 0xF0, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x3F, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0xF4, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x69, 0x00, 0x01,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x7D, 0x00, 0x00, 0x3E, 0x0F, 0xC7, 0xE0,
-    0x00, 0x03, 0xF3, 0xF4, 0x7E, 0x00, 0x00, 0x3F, 0xFE, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x40, 0x7E,
-    0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00,
-    0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0xBF, 0x00,
-    0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFF, 0x00, 0x02, 0xFE, 0x01, 0xBF, 0xF0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x2F, 0xFF, 0x82, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x0B, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xEB, 0xC0, 0x00, 0x00, 0x0B, 0x42, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0x80, 0x0A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0xFC, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x3F,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x20, 0x00, 0x00,
-    0x1F, 0xF8, 0x0B, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0xF0, 0x00, 0x00, 0xB4, 0x1F, 0xFD, 0x00, 0x00,
-    0x0B, 0x00, 0x2A, 0x40, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC7, 0xD0, 0x00, 0x03, 0xE0, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x47, 0xE0, 0x00, 0x03, 0xFF,
-    0xE0, 0x7E, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x00,
-    0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x1B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xF0, 0x00, 0x02, 0xFF,
-    0xF8, 0x2F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x2F, 0x43, 0xF3, 0xF0, 0x00, 0x00, 0x0B,
-    0xD1, 0xF8, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x02,
-    0xF8, 0x00, 0x02, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xE5, 0x5B, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC7, 0xD0, 0x00, 0x03, 0xE0, 0xFC, 0x7E, 0x00, 0x00, 0x3F, 0x3F, 0x47, 0xE0, 0x00, 0x03,
-    0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x3F, 0xF4, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-    0x03, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00,
-    0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF4,
-    0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xE0, 0x1B, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xF0, 0x00, 0x02,
-    0xFF, 0xF8, 0x2F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01,
-    0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0B,
-    0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0xFD, 0x00,
-    0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01,
-    0xF4, 0x3E, 0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0x5B, 0xF8, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x0B, 0xE0, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x2F, 0x80, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x01,
-    0xF8, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x1F, 0x9F, 0x80, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x01, 0xF8, 0x0F,
-    0xC0, 0x00, 0xBD, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x02, 0xF4, 0x03, 0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x01, 0xF4, 0x3E,
-    0x00, 0x00, 0x3F, 0x2F, 0x40, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x00, 0xFB, 0xE0, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0B, 0xD1, 0xE0, 0x00, 0x03, 0xF0, 0xFE, 0x00, 0x03, 0xF4, 0x3F, 0x81,
-    0x5B, 0xF8, 0x07, 0x80, 0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x07, 0xE7, 0xF0, 0x00, 0x00,
-    0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x2F, 0x80, 0x00, 0xBE, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x02, 0xF8,
-    0x0F, 0xD0, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xE3, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0x80,
-    0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x5B, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x07, 0xE0,
-    0x01, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00,
-    0xFC, 0x0F, 0xC0, 0x00, 0x1F, 0x43, 0xE0, 0x00, 0x03, 0xF2, 0xF4, 0x00, 0x00, 0xBC, 0xFC, 0x00,
-    0x00, 0x0F, 0xBE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x15, 0xBF, 0x80, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x01, 0xFF, 0x80, 0xB4, 0x00, 0x0F, 0xFF, 0xEB,
-    0xC0, 0x00, 0x78, 0x1F, 0xFD, 0x00, 0x02, 0xC0, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00,
-    0x00, 0x2F, 0x80, 0xFC, 0x00, 0x00, 0xFC, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x0B, 0xE0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00,
-    0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0x00, 0x7F, 0xE0, 0x1D, 0x00,
-    0x3F, 0xFF, 0xAF, 0x00, 0x1E, 0x07, 0xFF, 0x80, 0x07, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0x0F, 0xC2, 0xF4, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0xFC, 0x01, 0xF8,
-    0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0xF8, 0x0B, 0xD0, 0x00,
-    0x3F, 0x03, 0xF0, 0x00, 0x07, 0xD0, 0xF8, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x00, 0x2F, 0x3F, 0x00,
-    0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x05, 0x6F, 0xE0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC2, 0xFF, 0xFC, 0xB0, 0x3C, 0x28,
-    0x2C, 0x0A, 0x0C, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFF, 0xFE, 0x0E, 0x03, 0x80, 0xE0,
-    0xA0, 0x0C, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A,
-    0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28,
-    0x00, 0x05, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x2F, 0xFF, 0xDB,
-    0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF,
-    0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x10, 0x00, 0x52, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2,
-    0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F,
-    0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01,
-    0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80,
-    0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8,
-    0x01, 0xF2, 0xE0, 0x07, 0xCB, 0x80, 0x1F, 0x2E, 0x00, 0x7C, 0xB8, 0x01, 0xF2, 0xE0, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55,
-    0x55, 0x02, 0xD0, 0x7C, 0x0B, 0xC0, 0xF8, 0x1F, 0x43, 0xF4, 0x3F, 0x07, 0xF0, 0x15, 0x00, 0x0F,
-    0xD0, 0xFC, 0x1F, 0xC2, 0xF8, 0x2F, 0x03, 0xF0, 0x3D, 0x07, 0xC0, 0x10, 0x00, 0x1F, 0xC2, 0xFC,
-    0x2F, 0x43, 0xF0, 0x3F, 0x07, 0xD0, 0xBC, 0x0B, 0x80, 0x50, 0x00, 0x7E, 0x07, 0xF0, 0x3F, 0x02,
-    0xF4, 0x1F, 0x80, 0xFC, 0x0B, 0xC0, 0x3D, 0x01, 0x40, 0x02, 0xC0, 0x2D, 0x07, 0xC0, 0x3D, 0x0B,
-    0xC0, 0xBC, 0x0F, 0x80, 0xFC, 0x1F, 0x41, 0xF8, 0x3F, 0x02, 0xF4, 0x3F, 0x03, 0xF0, 0x7F, 0x07,
-    0xF0, 0x15, 0x01, 0x50, 0x0F, 0xD0, 0xBD, 0x0F, 0xC0, 0xFD, 0x1F, 0xC0, 0xFC, 0x2F, 0x41, 0xF8,
-    0x2F, 0x02, 0xF4, 0x3E, 0x03, 0xF0, 0x3D, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0x10, 0x01, 0x40, 0x1F,
-    0xC0, 0xFC, 0x2F, 0xC1, 0xFC, 0x2F, 0x42, 0xF8, 0x3F, 0x03, 0xF4, 0x3F, 0x03, 0xF0, 0x7D, 0x03,
-    0xE0, 0xBC, 0x07, 0xC0, 0xB8, 0x0B, 0x80, 0x50, 0x05, 0x00, 0x7E, 0x07, 0xF0, 0x7F, 0x03, 0xF0,
-    0x3F, 0x03, 0xF4, 0x2F, 0x42, 0xF4, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0xFC, 0x0B, 0xC0, 0x7C, 0x03,
-    0xC0, 0x3D, 0x01, 0x40, 0x14, 0x00, 0x15, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0, 0x03, 0xFA, 0xFA, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xEE, 0x9B, 0x9A, 0xF0, 0x02, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x95,
-    0x2E, 0x15, 0x8F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xD0, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x2E, 0x00, 0x05, 0x42, 0xD0, 0x54, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC,
-    0x40, 0x1D, 0x00, 0x40, 0x02, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x40, 0x1F, 0xF8, 0x3F, 0xFD, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
-    0xFF, 0x3F, 0xFE, 0x3F, 0xFD, 0x0B, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x0B, 0xD0, 0x02, 0xFF, 0x40,
-    0xBF, 0xFC, 0x2F, 0xFF, 0xDB, 0xFF, 0xD2, 0xFF, 0x80, 0xBE, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x8B, 0xF6, 0xFD, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0xBF,
-    0x40, 0x2F, 0xDB, 0xF8, 0x02, 0xFD, 0x7F, 0x00, 0x1F, 0xC0, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xBD, 0xBF, 0x40, 0x3F, 0xC0, 0x0F, 0xFB, 0xF8, 0x03,
-    0xFC, 0x00, 0xFF, 0x7F, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x40, 0x00, 0x50, 0x00, 0x14, 0x00, 0x0F,
-    0xCB, 0xF6, 0xFE, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xCB, 0x00, 0x02, 0x80, 0x00, 0xA0,
-    0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80,
-    0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00,
-    0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00,
-    0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00,
-    0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02,
-    0x80, 0x00, 0xA0, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x55, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xE0, 0x00,
-    0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0x55, 0x5B,
-    0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x3C, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xD0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x0F, 0x43, 0xE0, 0x69, 0x00, 0x00, 0x68, 0x00, 0xF4, 0x07, 0xC2, 0xF0, 0xFF, 0xF0,
-    0x01, 0xFF, 0xE0, 0x2E, 0x02, 0xF0, 0xF4, 0xBE, 0xBF, 0x00, 0xFE, 0xBD, 0x07, 0xE6, 0xF4, 0xBC,
-    0x3D, 0x03, 0xD0, 0xBC, 0x0B, 0xC0, 0xBF, 0xF8, 0x3D, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0xF0, 0x06,
-    0xE4, 0x3F, 0x0B, 0xC0, 0x2F, 0x0F, 0x40, 0x3D, 0x00, 0x00, 0x1F, 0x02, 0xE0, 0x07, 0xC3, 0xC0,
-    0x0F, 0x80, 0x00, 0x0F, 0x80, 0xF8, 0x01, 0xF1, 0xF0, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x3E, 0x00,
-    0x7C, 0x7C, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x1F, 0x0F, 0x00, 0x3E, 0x00, 0x02, 0xF0,
-    0x02, 0xF0, 0x0B, 0xC3, 0xD0, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x7C, 0x03, 0xE0, 0xF8, 0x07, 0xC0,
-    0x00, 0xBC, 0x00, 0x0F, 0x81, 0xF4, 0x1F, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xF8, 0x03,
-    0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x1F, 0x80, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x3D, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0x80, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x0F, 0x43, 0xE0, 0x19, 0x00, 0x00, 0x69, 0x00, 0x00, 0x69, 0x00, 0xF4, 0x07, 0xD1, 0xF0,
-    0xBF, 0xF8, 0x00, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x3F, 0x02, 0xF0, 0xF8, 0x7F, 0xBF, 0x40, 0xBF,
-    0xBF, 0x00, 0xFE, 0xFE, 0x07, 0xE6, 0xF8, 0x7C, 0x3F, 0x03, 0xF0, 0x3E, 0x07, 0xE0, 0xBD, 0x0B,
-    0xC0, 0xBF, 0xFC, 0x3E, 0x0F, 0x40, 0x7C, 0x1F, 0x00, 0xBC, 0x3F, 0x00, 0xF8, 0x06, 0xE4, 0x2F,
-    0x07, 0xC0, 0x0F, 0x4B, 0xC0, 0x1F, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x0F, 0x41, 0xF0, 0x03, 0xE3,
-    0xF0, 0x07, 0xC3, 0xD0, 0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x7C, 0x00, 0xF8, 0xF8, 0x01, 0xF4, 0xF4,
-    0x02, 0xF0, 0x00, 0x03, 0xD0, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x7D, 0x3D, 0x00, 0xBC, 0x00, 0x03,
-    0xF0, 0x07, 0xC0, 0x0F, 0x8B, 0xC0, 0x1F, 0x0F, 0x40, 0x2F, 0x00, 0x01, 0xF0, 0x01, 0xF4, 0x03,
-    0xD2, 0xF0, 0x0B, 0xC3, 0xE0, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x3E, 0x01, 0xF0, 0x7C, 0x03, 0xF0,
-    0xBC, 0x03, 0xD0, 0x00, 0x7C, 0x00, 0x0B, 0xC0, 0xFC, 0x0F, 0x81, 0xF4, 0x1F, 0x42, 0xF0, 0x00,
-    0x3E, 0x00, 0x00, 0xFF, 0xFD, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x2F, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x1F, 0xFC, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x7D, 0x00, 0xFC, 0x02, 0xF0, 0x03, 0xE0, 0x0B, 0xC0, 0x0F, 0x40,
-    0x2E, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0x0F, 0xC0, 0xF8, 0x02, 0xF0, 0x2F,
-    0x00, 0x3E, 0x03, 0xD0, 0x0B, 0xC0, 0xBC, 0x00, 0xF4, 0x0F, 0x00, 0x2E, 0x02, 0xE0, 0x03, 0xC0,
-    0x3C, 0x00, 0x74, 0x0B, 0x40, 0x00, 0x00, 0x7D, 0x0B, 0xC0, 0xBC, 0x00, 0xFC, 0x0F, 0x81, 0xF8,
-    0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x03, 0xE0, 0x3D, 0x07, 0xD0, 0x0B, 0xC0, 0xBC, 0x0F, 0x80, 0x0F,
-    0x40, 0xF0, 0x1F, 0x00, 0x2E, 0x02, 0xE0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x7C, 0x00, 0x74, 0x0B,
-    0x40, 0xB0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x03, 0xD0, 0x02, 0xF0, 0x00,
-    0xF4, 0x00, 0x7C, 0x00, 0x2C, 0x7D, 0x0F, 0x80, 0x0F, 0xC2, 0xF0, 0x01, 0xF4, 0x3E, 0x00, 0x3F,
-    0x07, 0xC0, 0x03, 0xD0, 0xB8, 0x00, 0xBC, 0x0F, 0x00, 0x0F, 0x42, 0xE0, 0x01, 0xF0, 0x3C, 0x00,
-    0x2C, 0x07, 0x80, 0x7D, 0x0F, 0x82, 0xF0, 0x00, 0xFC, 0x2F, 0x03, 0xE0, 0x01, 0xF4, 0x3E, 0x0B,
-    0xC0, 0x03, 0xF0, 0x7C, 0x0F, 0x80, 0x03, 0xD0, 0xB8, 0x1F, 0x00, 0x0B, 0xC0, 0xF0, 0x2E, 0x00,
-    0x0F, 0x42, 0xE0, 0x3C, 0x00, 0x1F, 0x03, 0xC0, 0x78, 0x00, 0x2C, 0x07, 0x80, 0xB0, 0x00, 0x09,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xDF, 0x00, 0x00, 0xF2, 0xD0, 0x00, 0xB4,
-    0x3C, 0x00, 0x3C, 0x0B, 0x40, 0x2D, 0x00, 0xF0, 0x0F, 0x00, 0x2D, 0x0B, 0x40, 0x03, 0xC3, 0xC0,
-    0x00, 0xB4, 0x00, 0x04, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x0B, 0xD0, 0x0B, 0xE0, 0x07, 0xE0, 0x07,
-    0xF0, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7E, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xF8,
-    0x00, 0xBE, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xF4, 0x0B, 0xD0, 0x2F, 0x80, 0x7E, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2F, 0x40, 0x00, 0x10, 0x2F,
-    0x00, 0x03, 0xF8, 0x00, 0x0F, 0x41, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x07, 0xF0, 0x01, 0xE0,
-    0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xC0, 0x00, 0x01, 0x90, 0x01, 0xFF, 0xF0, 0x00, 0xA4,
-    0x3F, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xC7, 0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x3F, 0x00, 0x0F,
-    0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x05, 0x00, 0x1F,
-    0x80, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x7E, 0x02, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF4, 0x08, 0x00,
-    0x03, 0xF4, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x0F, 0xC0,
-    0x2F, 0xC3, 0xF0, 0x0B, 0xF0, 0xFC, 0x01, 0xFC, 0x3F, 0x00, 0x7E, 0x0F, 0xC0, 0x1F, 0x83, 0xF0,
-    0x07, 0xE0, 0xFC, 0x01, 0xF8, 0x3F, 0x00, 0x3E, 0x0F, 0xC0, 0x0F, 0x43, 0xF0, 0x03, 0xD0, 0xF8,
-    0x00, 0xF4, 0x2E, 0x00, 0x3D, 0x0B, 0x80, 0x0F, 0x42, 0xE0, 0x03, 0xC0, 0xB8, 0x00, 0xF0, 0x2D,
-    0x00, 0x3C, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7E, 0x2F,
-    0xD0, 0x3F, 0xCB, 0xF8, 0x0F, 0xF1, 0xFC, 0x02, 0xFC, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x03, 0xEF, 0xC2, 0xFC, 0x00, 0xBC, 0x07, 0xD0, 0x0B,
-    0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xF0, 0x0B, 0xC0, 0x3E, 0x00, 0xBC, 0x03, 0xE0, 0x07, 0xC0, 0xBC,
-    0x00, 0x7C, 0x1F, 0x80, 0x07, 0xCB, 0xE0, 0x00, 0x7E, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x40, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA0, 0x24, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x00, 0x2C,
-    0x0F, 0x00, 0x00, 0x00, 0xB4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00,
-    0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x95, 0xBF, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0x40, 0x00,
-    0x00, 0xF0, 0x1D, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x1D, 0x10, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xDB,
-    0x40, 0x03, 0xC3, 0xC0, 0x0B, 0x82, 0xC0, 0x0F, 0x01, 0xE0, 0x1E, 0x00, 0xF0, 0x3D, 0x00, 0x78,
-    0x7C, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x0B, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE5, 0xE1,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x6A, 0xFF, 0xEA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x04, 0x00, 0x40, 0x01, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x24, 0x03, 0xD0, 0x05,
-    0x00, 0x14, 0x01, 0xF0, 0x02, 0x0F, 0xE4, 0xF5, 0xBF, 0xC0, 0x0B, 0xF9, 0x3C, 0x6F, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF8, 0x6A, 0xFF, 0xFA, 0x94, 0x00, 0x5A, 0xBF, 0xFE,
-    0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xEF, 0x00, 0x00, 0x00,
-    0x03, 0xEF, 0xC0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xF1, 0xF8, 0x00, 0x03, 0xF0, 0xBE,
-    0x00, 0x00, 0x01, 0xF8, 0x3F, 0x40, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x07, 0xF0, 0x00,
-    0xBC, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x01, 0x40,
-    0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xDB, 0xFF, 0xF5, 0x55, 0x54, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0x7E, 0xA9, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7E, 0x55, 0x7F, 0xFF, 0x7F, 0xFF, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D,
-    0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7F, 0xFF, 0x7F,
-    0xFF, 0x15, 0x55, 0x3F, 0xFF, 0x4F, 0xFF, 0xD2, 0xAB, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B,
-    0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F,
-    0x45, 0x5F, 0xD3, 0xFF, 0xF4, 0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD,
-    0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4,
-    0xFF, 0xFD, 0x3F, 0xFF, 0x45, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0xF4, 0x00, 0x6F, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xA5, 0xBF, 0x83,
-    0xFA, 0x5B, 0xFC, 0x24, 0x00, 0x0F, 0xC2, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x1F, 0x87, 0xFF, 0xFF, 0xF0, 0x0B, 0xF0, 0xFE, 0x96, 0xFE,
-    0x02, 0xFC, 0x24, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x3E,
-    0x07, 0xE0, 0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0x80, 0x00, 0x03, 0xF4, 0x03, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0xF4, 0x00, 0x07, 0xF4, 0x00,
-    0x3D, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F,
-    0x80, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF,
-    0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x6F, 0xFF, 0x80,
-    0x3F, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0x03, 0xFE, 0x5B, 0xFC, 0x3F, 0x01, 0x40, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
-    0x00, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00,
-    0x0F, 0xE0, 0x3E, 0x00, 0x00, 0x3F, 0x80, 0x2E, 0x00, 0x00, 0xFD, 0x00, 0x2E, 0x00, 0x02, 0xF4,
-    0x00, 0x2E, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x03, 0xD0, 0x00, 0x2D, 0x00, 0x03, 0xD0, 0x00,
-    0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x00, 0x7F, 0x00,
-    0x0B, 0xF0, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xC5, 0x55, 0x55, 0x57, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x0F, 0xAB, 0xFF,
-    0xFF, 0x83, 0xC0, 0xBF, 0xFF, 0xF4, 0xF0, 0x2F, 0xFF, 0xFF, 0x3C, 0x0B, 0xFF, 0xFF, 0xCF, 0x02,
-    0xFF, 0xFF, 0xF7, 0xC0, 0xBF, 0xFF, 0xFE, 0xF0, 0x2F, 0xFF, 0xFF, 0xBC, 0x0B, 0xFF, 0xFF, 0xEF,
-    0x02, 0xFF, 0xFF, 0xFB, 0xC0, 0xBF, 0xFF, 0xFD, 0xF0, 0x2F, 0xFF, 0xFF, 0x3C, 0x0B, 0xFF, 0xFF,
-    0xCF, 0x02, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xE0, 0xF0, 0x2F, 0xFF, 0xD0, 0x3C, 0x0B, 0x40,
-    0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x3C, 0x0B,
-    0x40, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00, 0x3C,
-    0x0B, 0x40, 0x00, 0x0F, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0xB4, 0x00, 0x00, 0xF0, 0x2D, 0x00, 0x00,
-    0x3C, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF,
-    0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x57, 0xD1, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F, 0xFF, 0xFF, 0x02, 0xD3,
-    0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF,
-    0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x3F, 0xFF, 0xFF, 0x02, 0xD3, 0xFF, 0xFF, 0xF0, 0x2D, 0x2F,
-    0xFF, 0xFF, 0x02, 0xD0, 0xFF, 0xFF, 0xF0, 0x2D, 0x0B, 0xFF, 0xFF, 0xAB, 0xD0, 0x2F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x1A, 0xAA, 0xAA, 0x90, 0x3F, 0xFF, 0xFF, 0x90, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3D,
-    0x5F, 0xFF, 0xFF, 0x03, 0xC0, 0xBF, 0xFF, 0xF8, 0x3C, 0x0B, 0xFF, 0xFF, 0xC3, 0xC0, 0xBF, 0xFF,
-    0xFC, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xE3, 0xC0,
-    0xBF, 0xFF, 0xFD, 0x3C, 0x0B, 0xFF, 0xFF, 0xD3, 0xC0, 0xBF, 0xFF, 0xFC, 0x3C, 0x0B, 0xFF, 0xFF,
-    0xC3, 0xC0, 0xBF, 0xFF, 0xF8, 0x3E, 0xAF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA,
-    0xAA, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x03, 0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00,
-    0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00,
-    0x10, 0x01, 0x00, 0x04, 0x03, 0xF4, 0x7F, 0x87, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x42, 0xF8, 0x0F, 0xC0,
-    0xFC, 0x07, 0xC0, 0x3D, 0x02, 0xE0, 0x05, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0x95, 0xBF, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0x40, 0x00, 0x00, 0xF0,
-    0x1D, 0x00, 0x00, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x1D, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x00, 0x2C, 0x0F, 0x00, 0x00,
-    0x00, 0xB4, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x03, 0xC0, 0x05, 0x7F, 0x93,
-    0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x3F,
-    0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xD0, 0x02, 0xF0,
-    0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x24, 0x03,
-    0xC0, 0x05, 0x7F, 0x93, 0xC6, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0x1A, 0xBF, 0xFE, 0xA5, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x3F, 0xBC, 0x00, 0x00, 0xBD, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xF4,
-    0x0F, 0xD0, 0x02, 0xF0, 0x0B, 0xC0, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x07,
-    0xCB, 0xF0, 0x03, 0xE2, 0xFC, 0x01, 0xF4, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0,
-    0x0A, 0x43, 0xF0, 0x0B, 0xF0, 0xF4, 0x02, 0xFC, 0xBC, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0xF4, 0xBD, 0x00, 0x1B, 0xFF, 0xFE, 0x56, 0xF8, 0x3C, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xF8, 0x0D, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x96, 0xBF, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x0B,
-    0x40, 0x00, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x01, 0x80, 0xB8, 0x0D,
-    0x00, 0x3E, 0x0B, 0x83, 0xF0, 0x00, 0xF8, 0xB8, 0xFC, 0x00, 0x03, 0xEB, 0xBF, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x01, 0x55, 0xBF, 0xF9, 0x55, 0x3F, 0xFF, 0xFF, 0xFF, 0xF2, 0xAA, 0xFF, 0xFA, 0xAA,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFB, 0xBF, 0x00, 0x00, 0xFC, 0xB8, 0xFC, 0x00, 0x3F, 0x0B,
-    0x83, 0xF0, 0x02, 0xC0, 0xB8, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x00, 0x7D, 0x0B, 0xC0, 0xF8, 0x1F, 0x40, 0x3F, 0x07, 0xD0,
-    0xBC, 0x0F, 0xC0, 0x2F, 0x03, 0xF0, 0x3D, 0x0B, 0xC0, 0x0F, 0x81, 0xF0, 0x2F, 0x03, 0xE0, 0x0B,
-    0xC0, 0xF8, 0x0F, 0x02, 0xF0, 0x03, 0xD0, 0x7C, 0x0B, 0x80, 0xF4, 0x02, 0xE0, 0x3D, 0x03, 0xC0,
-    0xB8, 0x00, 0xF0, 0x1E, 0x02, 0xD0, 0x3C, 0x00, 0x74, 0x0B, 0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F,
-    0x8F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF8,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x42, 0x40,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0F, 0xC3, 0xF8, 0xFE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x83, 0xF4, 0xFE, 0x3F, 0x41, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x3F, 0x40, 0x00,
-    0x01, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x1E, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x02, 0x40, 0x0F, 0x80, 0x09,
-    0x00, 0x03, 0xF8, 0x03, 0xE0, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x03, 0xF8, 0x00, 0x3F, 0x40,
-    0x3E, 0x00, 0xFD, 0x00, 0x01, 0x40, 0x0F, 0x80, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5,
-    0x55, 0x55, 0x7E, 0x55, 0x55, 0x50, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x0F,
-    0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x03, 0xF8, 0x03, 0xE0, 0x1F, 0xD0, 0x00, 0xFE, 0x00, 0xF8, 0x07,
-    0xF0, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFD,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xFD, 0xBF, 0x9F, 0xD2, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x2F, 0xDB, 0xF9, 0xFC, 0x04, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFD,
-    0x3F, 0x01, 0x00, 0x00, 0x10, 0x7F, 0x2F, 0xEB, 0xF4, 0xFC, 0x00, 0x00, 0x02, 0xA1, 0xFD, 0xBF,
-    0x9F, 0xD2, 0x90, 0x00, 0x00, 0x0F, 0xCB, 0xF6, 0xFE, 0x7F, 0x01, 0x00, 0xFF, 0xFF, 0x57, 0xD5,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0xFF, 0xFF, 0xE5, 0x5B, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x0B,
-    0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xBF, 0xFE, 0x3F, 0xFC,
-    0x2F, 0xF8, 0x0F, 0xF0, 0x0B, 0xE0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x03, 0xC0, 0x07, 0xD0, 0x0F, 0xF0, 0x1F, 0xF4,
-    0x3F, 0xFC, 0xBF, 0xFE, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x02, 0x80,
-    0x0B, 0xE0, 0x2C, 0x38, 0xB0, 0x0E, 0x3C, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0xFF, 0x80, 0x57, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x03, 0xC0, 0xFF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-    0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x01, 0x40, 0x00, 0x14,
-    0x00, 0x1F, 0xFE, 0x00, 0xFE, 0xFE, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0xF8, 0xF4, 0x02, 0xF7, 0xC0,
-    0x07, 0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF3, 0xD0, 0x0B, 0xCF, 0x80, 0x3E, 0x2F,
-    0x01, 0xF4, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x05, 0x00, 0x00, 0xF3, 0x80, 0x10, 0xE3, 0x8E,
-    0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x3F, 0xD0, 0x00, 0xB7, 0xD0, 0x01, 0xE3, 0xD0, 0x03, 0xC3, 0xD0, 0x0F, 0x43, 0xD0, 0x1E, 0x03,
-    0xD0, 0x3C, 0x03, 0xD0, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x7E, 0xAA, 0x87, 0x80, 0x00,
-    0x78, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0xF4, 0x10, 0x1F, 0xC0, 0x00, 0x3E, 0x00,
-    0x02, 0xE0, 0x00, 0x3E, 0x40, 0x07, 0xDF, 0xAA, 0xFC, 0xFF, 0xFE, 0x00, 0x55, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0xFF, 0xF0, 0x07, 0xFA, 0xA0, 0x0F, 0x80, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x3C, 0xBF, 0x80, 0x7F, 0xFF, 0xF0, 0x7F, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x3C,
-    0x00, 0x7C, 0x2F, 0x00, 0xF8, 0x0F, 0xEB, 0xF0, 0x03, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00,
-    0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x00,
-    0xF9, 0xBF, 0x0B, 0xC0, 0x3D, 0x2E, 0x00, 0xF4, 0xBC, 0x07, 0xC0, 0xFE, 0xBD, 0x00, 0xFF, 0xD0,
-    0x0B, 0xEF, 0xD0, 0xBC, 0x0B, 0xD3, 0xD0, 0x0B, 0x8F, 0x00, 0x1F, 0x3D, 0x00, 0xF8, 0xBE, 0x6F,
-    0xC0, 0xBF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x02, 0xF9, 0xBE, 0x0F, 0x40,
-    0x3D, 0x7C, 0x00, 0xB9, 0xF0, 0x01, 0xF7, 0xC0, 0x0B, 0xCF, 0x80, 0x7F, 0x1F, 0xFF, 0xBC, 0x1F,
-    0xF5, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03, 0xE0, 0x2A, 0xBF, 0x00, 0xFF, 0xE0, 0x01,
-    0x54, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0xAB, 0xFA, 0x8F, 0xFF,
-    0xFC, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x09, 0x00, 0xAA, 0xAA, 0x8F, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x6A, 0xAA, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCF,
-    0xFF, 0xFC, 0x00, 0x00, 0x78, 0x0F, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0xB4, 0x0F, 0x40, 0xF0, 0x0F,
-    0x00, 0xF0, 0x0F, 0x40, 0xB4, 0x07, 0x80, 0x3C, 0x03, 0xD0, 0x1F, 0x00, 0xB4, 0x02, 0x80, 0x00,
-    0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x3D, 0x02, 0xD0, 0x2D, 0x02, 0xD0,
-    0x2D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF4, 0x1F, 0x03, 0xD0, 0x64, 0x00, 0x10, 0x15, 0x00, 0xEB,
-    0xFF, 0x83, 0xF4, 0x1F, 0x4F, 0x00, 0x1E, 0x3C, 0x00, 0x38, 0xF0, 0x00, 0xE3, 0x80, 0x03, 0x8E,
-    0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x85, 0x00, 0x05, 0x00, 0x14, 0x00,
-    0x1F, 0xFE, 0x00, 0xFE, 0xFE, 0x0B, 0xC0, 0x7C, 0x3E, 0x00, 0xF8, 0xF4, 0x02, 0xF7, 0xC0, 0x07,
-    0xDF, 0x00, 0x1F, 0x7C, 0x00, 0x7D, 0xF0, 0x01, 0xF3, 0xD0, 0x0B, 0xCF, 0x80, 0x3E, 0x2F, 0x01,
-    0xF4, 0x3F, 0xBF, 0x80, 0x3F, 0xF8, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBF, 0xDF, 0xEF,
-    0x7C, 0x7C, 0x41, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
-    0x01, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x54, 0x00, 0x2F, 0xFE, 0x03, 0xFA, 0xBE, 0x02, 0x00, 0x7C,
-    0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x40, 0x01, 0xF4,
-    0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x7F, 0xFF, 0x03, 0xF9, 0xBF, 0x05, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xC0, 0x00, 0xBD, 0x01, 0xFF, 0xD0, 0x02, 0xAF, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x3E, 0x00, 0x01, 0xF5, 0xFA, 0xAF, 0xC7, 0xFF, 0xF8, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xD0, 0x00, 0xB7, 0xD0, 0x01, 0xE3, 0xD0, 0x03,
-    0xC3, 0xD0, 0x0F, 0x43, 0xD0, 0x1E, 0x03, 0xD0, 0x3C, 0x03, 0xD0, 0xBF, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xFD, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFC, 0x7E, 0xAA, 0x87, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0xBF, 0xF8, 0x0B, 0xFF,
-    0xF4, 0x10, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0x3E, 0x40, 0x07, 0xDF, 0xAA, 0xFC,
-    0xFF, 0xFE, 0x00, 0x55, 0x00, 0x00, 0x05, 0x40, 0x00, 0xFF, 0xF0, 0x07, 0xFA, 0xA0, 0x0F, 0x80,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0xBF, 0x80, 0x7F, 0xFF, 0xF0, 0x7F, 0x00, 0xF8,
-    0x7C, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x7C, 0x2F, 0x00, 0xF8, 0x0F, 0xEB, 0xF0, 0x03,
-    0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x80, 0x00, 0x3D,
-    0x00, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8,
-    0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x1F, 0xFF, 0x00, 0xF9, 0xBF, 0x0B, 0xC0, 0x3D, 0x2E, 0x00, 0xF4, 0xBC,
-    0x07, 0xC0, 0xFE, 0xBD, 0x00, 0xFF, 0xD0, 0x0B, 0xEF, 0xD0, 0xBC, 0x0B, 0xD3, 0xD0, 0x0B, 0x8F,
-    0x00, 0x1F, 0x3D, 0x00, 0xF8, 0xBE, 0x6F, 0xC0, 0xBF, 0xFC, 0x00, 0x15, 0x00, 0x00, 0x54, 0x00,
-    0x2F, 0xFE, 0x02, 0xF9, 0xBE, 0x0F, 0x40, 0x3D, 0x7C, 0x00, 0xB9, 0xF0, 0x01, 0xF7, 0xC0, 0x0B,
-    0xCF, 0x80, 0x7F, 0x1F, 0xFF, 0xBC, 0x1F, 0xF5, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x3C, 0x00, 0x03,
-    0xE0, 0x2A, 0xBF, 0x00, 0xFF, 0xE0, 0x01, 0x54, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x00, 0x00, 0xE0,
-    0x00, 0x0E, 0x00, 0xAB, 0xFA, 0x8F, 0xFF, 0xFC, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00,
-    0x09, 0x00, 0xAA, 0xAA, 0x8F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x8F, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x0F, 0x02, 0xE0, 0x3C,
-    0x07, 0xC0, 0xB4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x40, 0xB4, 0x07, 0x80, 0x3C, 0x03,
-    0xD0, 0x1F, 0x00, 0xB4, 0x02, 0x80, 0x00, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x03,
-    0xC0, 0x3D, 0x02, 0xD0, 0x2D, 0x02, 0xD0, 0x2D, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF4, 0x1F, 0x03,
-    0xD0, 0x64, 0x00, 0x06, 0xA9, 0x02, 0xFF, 0xF8, 0x04, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x02, 0xD1,
-    0xFF, 0xFD, 0x7D, 0x02, 0xDF, 0x00, 0x2D, 0xF0, 0x03, 0xDF, 0x81, 0xFD, 0x3F, 0xF8, 0xD0, 0x54,
-    0x00, 0x01, 0xA9, 0x00, 0x3F, 0xFE, 0x03, 0xD0, 0x2D, 0x1E, 0x00, 0x3C, 0xB4, 0x00, 0xF3, 0xFF,
-    0xFF, 0xCF, 0x40, 0x00, 0x2D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x01, 0x40, 0xBF, 0xFD, 0x00,
-    0x15, 0x40, 0x01, 0xA9, 0x00, 0x3F, 0xFF, 0x03, 0xD0, 0x1F, 0x1E, 0x00, 0x1E, 0xB4, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x03, 0xED, 0x00, 0x1E, 0x7C, 0x00, 0xB4, 0xB8, 0x0B, 0xC0, 0xBF, 0xF8,
-    0x00, 0x15, 0x00, 0x24, 0x00, 0x64, 0x2E, 0x00, 0xF0, 0x0F, 0x43, 0xD0, 0x03, 0xCB, 0x80, 0x01,
-    0xFF, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xDF, 0x00, 0x0B, 0x83, 0xC0, 0x1F, 0x01,
-    0xE0, 0x3C, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1A, 0xA4, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0xF1, 0xAA, 0xAB, 0xCF, 0xFF, 0xFF, 0x3C, 0x00, 0x3C, 0xB4, 0x01, 0xE0,
-    0xF4, 0x1F, 0x00, 0xFF, 0xE0, 0x00, 0x14, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00,
-    0x0E, 0x00, 0x00, 0x38, 0x6A, 0x40, 0xEF, 0xFF, 0xC3, 0xE0, 0x0F, 0x4F, 0x00, 0x1E, 0x3C, 0x00,
-    0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80,
-    0x03, 0x80, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38,
-    0x00, 0x90, 0xE0, 0x1F, 0x03, 0x81, 0xF0, 0x0E, 0x1F, 0x00, 0x39, 0xF0, 0x00, 0xFF, 0x80, 0x03,
-    0xEB, 0x80, 0x0F, 0x0F, 0x40, 0x38, 0x0F, 0x00, 0xE0, 0x1F, 0x03, 0x80, 0x2F, 0x00, 0x00, 0x00,
-    0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x80, 0x20, 0x6A, 0x01, 0xA9,
-    0x03, 0xBF, 0xFD, 0xBF, 0xF8, 0x3E, 0x01, 0xFC, 0x03, 0xD3, 0xC0, 0x0F, 0x40, 0x1D, 0x3C, 0x00,
-    0xF0, 0x01, 0xE3, 0x80, 0x0F, 0x00, 0x1E, 0x38, 0x00, 0xF0, 0x01, 0xE3, 0x80, 0x0F, 0x00, 0x1E,
-    0x38, 0x00, 0xF0, 0x01, 0xE3, 0x80, 0x0F, 0x00, 0x1E, 0x38, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x6A, 0x40, 0xEF, 0xFF, 0xC3, 0xE0, 0x0F, 0x4F, 0x00, 0x1E, 0x3C, 0x00, 0x38,
-    0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8E, 0x00, 0x0E, 0x38, 0x00, 0x38, 0xE0, 0x00, 0xE3, 0x80, 0x03,
-    0x80, 0x00, 0x00, 0x20, 0x6A, 0x40, 0x3B, 0xFF, 0xE0, 0x3E, 0x00, 0xF4, 0x3C, 0x00, 0x7C, 0x3C,
-    0x00, 0x3C, 0x38, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3D, 0x00, 0x78, 0x3F, 0x41,
-    0xF0, 0x3A, 0xFF, 0xD0, 0x38, 0x15, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x06, 0xA8, 0x1F, 0xFF, 0xCF, 0x00, 0x03, 0xC0, 0x00, 0x7D, 0x00, 0x07, 0xF9,
-    0x00, 0x1B, 0xE0, 0x00, 0x3D, 0x00, 0x07, 0x64, 0x07, 0xCF, 0xFF, 0xD0, 0x15, 0x00, 0x07, 0x00,
-    0x0B, 0x00, 0x1F, 0xA8, 0xBF, 0xFC, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x07, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFE, 0x40, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0x80, 0xB0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xAA, 0xAA,
-    0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xEA, 0xAA, 0xF4, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0xFC,
-    0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x02, 0xFC, 0x0F, 0xC0, 0x00, 0x3F, 0xFF, 0xFA, 0xA9, 0x02, 0xFF,
-    0xFF, 0xFF, 0x40, 0x01, 0x7F, 0x55, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x00,
-    0x78, 0x2E, 0x00, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xF0, 0x7F, 0x80, 0x7F, 0x5E, 0x0B, 0x80, 0x0F, 0xD2, 0xD0, 0xF4, 0x01, 0xFC, 0x3D,
-    0x0F, 0x00, 0x3F, 0x43, 0xC0, 0xF0, 0x03, 0xF0, 0x3C, 0x1E, 0x00, 0x3F, 0x07, 0x82, 0xE0, 0x07,
-    0xE0, 0xB4, 0x3D, 0x00, 0x7E, 0x0F, 0x43, 0xC0, 0x03, 0xE0, 0xF0, 0x3C, 0x00, 0x3F, 0x1F, 0x07,
-    0x80, 0x03, 0xF1, 0xE0, 0xB4, 0x00, 0x2F, 0x6D, 0x0F, 0x40, 0x01, 0xFF, 0xC0, 0xF0, 0x00, 0x0F,
-    0xFC, 0x0F, 0x00, 0x00, 0x3F, 0xD1, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xAF, 0x80, 0x0B, 0xFF, 0xFF,
-    0xF8, 0x00, 0xF6, 0xFF, 0xF9, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x78, 0x00, 0x00, 0x1E,
-    0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x02, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x56, 0xFD, 0x03, 0xFD, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x06,
-    0x42, 0xE4, 0xFC, 0x03, 0xE7, 0xFD, 0x3F, 0x00, 0xFF, 0xFB, 0x4F, 0xC0, 0x3F, 0xD0, 0x03, 0xF0,
-    0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x3F, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0xFC, 0x00, 0x00, 0xFE, 0x3F, 0x00,
-    0x00, 0x1F, 0xFF, 0xC5, 0xB0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF0, 0x0B,
-    0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x1A, 0xFE, 0xAA, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x01, 0xAF, 0xFA, 0xA0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x01, 0xFE, 0x56, 0xF8, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x06, 0xBF, 0xAA, 0xA8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x6B, 0xFE, 0xAA, 0x80, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x15, 0xFE, 0x55, 0x50, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xFE, 0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x2F, 0xFD, 0x0F, 0xFF, 0xF8, 0x03, 0xD7, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFC, 0x0F, 0xFE, 0x56, 0xFF, 0xF9, 0x5B, 0xF8, 0x3F, 0xC0, 0x02, 0xFF, 0x40, 0x03, 0xF0,
-    0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xD3, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x4F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xD3, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x7D, 0x3F,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x03, 0xDF,
-    0xC0, 0x00, 0x1F, 0x4F, 0xC0, 0x1F, 0x3F, 0x00, 0x00, 0x7D, 0x3F, 0x00, 0xF8, 0xFC, 0x00, 0x01,
-    0xF4, 0xFC, 0x07, 0xC3, 0xF0, 0x00, 0x07, 0xD3, 0xF0, 0x2E, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x00, 0x0F,
-    0xF0, 0x00, 0xBC, 0x00, 0x3F, 0xD0, 0x02, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xC0, 0x03, 0xFF, 0x00,
-    0x2F, 0x00, 0x0F, 0xBD, 0x00, 0xBC, 0x00, 0x3D, 0xFC, 0x02, 0xF0, 0x00, 0xF5, 0xF0, 0x0B, 0xC0,
-    0x6B, 0xFB, 0xFA, 0xBF, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0xBF, 0xAF, 0xAB, 0xFA, 0x40, 0xF4,
-    0x3E, 0x07, 0xC0, 0x03, 0xE0, 0xBC, 0x1F, 0x01, 0xAF, 0xEB, 0xFE, 0xFE, 0xAB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x95, 0xF9, 0x5B, 0xEB, 0xE5, 0x03, 0xE0, 0x0F, 0x9F, 0x00, 0x0F, 0x80, 0x3F, 0x7C, 0x00,
-    0x3E, 0x00, 0x7E, 0xF0, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0x80,
-    0x07, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0xF8, 0x00, 0x2F, 0xC0, 0x7F, 0xFA, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0x40, 0x2F,
-    0xE0, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x1E, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0xB8, 0x01,
-    0xF4, 0x00, 0x3F, 0x03, 0xE0, 0x07, 0xD0, 0x02, 0xFC, 0x7F, 0xFF, 0x1F, 0x40, 0x6F, 0xCB, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFD, 0x16, 0xFD, 0x51, 0xFF, 0xFF, 0xD0, 0x03, 0xE0, 0x07, 0xFA, 0x90, 0x00,
-    0x0F, 0x80, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00,
-    0x00, 0x03, 0xE0, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xF8, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0x9F, 0x40, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x3F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF8,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0xFC, 0x07, 0xFF, 0xD0, 0xF8, 0x00, 0x3F, 0x07, 0xFF, 0xFC, 0x3E, 0x00,
-    0x1F, 0x83, 0xF8, 0x5E, 0x0F, 0x80, 0x0B, 0xD1, 0xF8, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x7D, 0x00,
-    0x00, 0xF9, 0x5B, 0xF8, 0x1F, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0xBF, 0xD0, 0x03, 0xE0, 0x7F, 0x00, 0x0B, 0xFE, 0x00, 0xF8, 0x0F, 0xC0, 0x00, 0x7F, 0xF0,
-    0x3E, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xE0, 0x0B, 0xE0,
-    0x00, 0x02, 0xF4, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x7D, 0x3E, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x4F,
-    0x80, 0x07, 0xF2, 0xD0, 0x1F, 0xC3, 0xE0, 0x00, 0xFD, 0xBF, 0xFF, 0xD0, 0xF8, 0x00, 0x1F, 0x9F,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x7D, 0x00, 0x1F, 0x80, 0x03, 0xE3, 0xD0,
-    0x02, 0xFC, 0x00, 0x3E, 0x3E, 0x00, 0x2F, 0xC0, 0x07, 0xD3, 0xF0, 0x03, 0xFD, 0x00, 0x7C, 0x2F,
-    0x00, 0x3E, 0xE0, 0x0B, 0xC1, 0xF0, 0x07, 0xDE, 0x00, 0xBC, 0x1F, 0x40, 0x79, 0xF0, 0x0F, 0x80,
-    0xF4, 0x0B, 0x8F, 0x00, 0xF8, 0x0F, 0x80, 0xF4, 0xF4, 0x0F, 0x40, 0xFC, 0x0F, 0x4F, 0x41, 0xF0,
-    0x0B, 0xC1, 0xF4, 0xB8, 0x2F, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3D, 0x2E, 0x03, 0xC3, 0xE0, 0x03, 0xE3, 0xD0, 0x3D, 0x3D, 0x00, 0x3E, 0x3D, 0x02, 0xD3,
-    0xC0, 0x02, 0xF3, 0xC0, 0x2E, 0x7C, 0x00, 0x1F, 0x7C, 0x01, 0xF7, 0xC0, 0x00, 0xF7, 0x80, 0x0F,
-    0xB8, 0x00, 0x0F, 0xF8, 0x00, 0xFB, 0x80, 0x00, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xE9,
-    0x00, 0x02, 0xE3, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0x3F, 0xAA, 0xAF, 0xF0, 0x03, 0xF3, 0xE0, 0x00,
-    0x2F, 0x80, 0x3F, 0x3E, 0x00, 0x00, 0xFC, 0x03, 0xF3, 0xE0, 0x00, 0x07, 0xD0, 0x3F, 0x3E, 0x02,
-    0x90, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0,
-    0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E,
-    0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3,
-    0xE0, 0x3E, 0x03, 0xE0, 0x3F, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xF3, 0xE0, 0x3E, 0x03, 0xE0, 0x3F,
-    0x3E, 0x03, 0xE0, 0x00, 0x03, 0xE3, 0xE0, 0x3E, 0x00, 0x00, 0x7D, 0x3E, 0x03, 0xE0, 0x00, 0x1F,
-    0xC3, 0xE0, 0x3E, 0x55, 0x5B, 0xF4, 0x3E, 0x03, 0xFF, 0xFF, 0xFD, 0x03, 0xE0, 0x3F, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x01, 0x55, 0x6F, 0xD4, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x2F, 0xFD, 0x1F, 0x80, 0x01, 0xFF,
-    0xFF, 0x8F, 0x80, 0x07, 0xFD, 0x5B, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x1F, 0xC0, 0x00,
-    0x3F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x1F, 0x80,
-    0x3F, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x2F, 0x80, 0x00, 0x3F, 0x80, 0x0F,
-    0xD0, 0x00, 0xBF, 0x80, 0x0B, 0xF8, 0x06, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xCF, 0x80, 0x00, 0x7F,
-    0xFE, 0x0F, 0x80, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0x9A, 0xFC, 0x00, 0x2F, 0xD0, 0x00, 0x50, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0x7F, 0x55, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x6F, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xF4, 0x02, 0xF0, 0x00, 0x0B, 0xE0, 0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x02, 0xF0, 0x00, 0x3F,
-    0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x03, 0xF4, 0x00, 0x02, 0xF0, 0x0B, 0xE0, 0x00,
-    0x02, 0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0xFC, 0x00, 0x00, 0x16,
-    0xF7, 0xF9, 0x55, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFE,
-    0x7E, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xF0, 0x07,
-    0xE0, 0x00, 0x02, 0xF0, 0x02, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x7F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xD0, 0x02, 0xF0, 0x00, 0x07, 0xF0,
-    0x02, 0xF0, 0x00, 0x02, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC1, 0xE0, 0x00, 0x00, 0x3F, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x1E, 0x00, 0x0F, 0xE3, 0xF3, 0xFC, 0x00, 0x1D, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00,
-    0xFE, 0x3F, 0x00, 0x00, 0x01, 0xD0, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xA5, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF4, 0x02, 0xFF, 0x80, 0x01,
-    0xF4, 0x00, 0x03, 0xF0, 0x1F, 0xFF, 0xF0, 0x02, 0xF0, 0x00, 0x07, 0xE0, 0x3F, 0x97, 0xF8, 0x03,
-    0xF0, 0x00, 0x0F, 0xD0, 0xBD, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x7F, 0x41, 0xF8, 0x00, 0xFC, 0x0B, 0xD0, 0x01, 0xFE, 0x02, 0xF4, 0x00, 0xFC, 0x0B,
-    0xC0, 0x1F, 0xF8, 0x03, 0xF0, 0x02, 0xF8, 0x0F, 0xEA, 0xFF, 0xD0, 0x03, 0xF8, 0x0B, 0xF0, 0x0F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x1F, 0xFF, 0x90, 0x00, 0x07, 0xEF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x0B, 0xE1,
-    0xFC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0x0F, 0xC0, 0xBC, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x7D, 0x1F,
-    0x00, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x10, 0x0B, 0xE0, 0x00, 0x0B, 0x00, 0xFF, 0x00,
-    0x00, 0xF4, 0x2F, 0xF8, 0x00, 0x2F, 0xC7, 0xDF, 0xC0, 0x03, 0xFE, 0xFC, 0xBD, 0x00, 0xBD, 0xFF,
-    0x03, 0xE0, 0x0F, 0x4F, 0xE0, 0x3F, 0x03, 0xF0, 0x3C, 0x01, 0xF4, 0x7D, 0x02, 0x40, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x09, 0x6F, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xAB,
-    0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x7F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE6, 0xBF, 0xAA, 0xAB, 0xFE, 0x80, 0xFC, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x5F,
-    0xD5, 0x55, 0xBE, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xFE, 0xAA, 0xAF, 0xE9, 0x03, 0xF0, 0x00,
-    0xFE, 0x00, 0x0F, 0xC1, 0x6F, 0xF0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xEB, 0xFC, 0x03,
-    0xFE, 0x0B, 0x80, 0x24, 0x0F, 0xF4, 0x0B, 0x80, 0x00, 0x1F, 0xC0, 0x0B, 0x80, 0x00, 0x3F, 0x80,
-    0x0B, 0x80, 0x00, 0x7F, 0x00, 0x0B, 0x80, 0x00, 0xBE, 0x00, 0x0B, 0x80, 0x00, 0xFD, 0x00, 0x0B,
-    0x80, 0x00, 0xFD, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00, 0x0B, 0xEA, 0xA9, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0x80, 0x7F, 0xBE, 0x00, 0x0B, 0x80, 0x3F,
-    0x7F, 0x00, 0x0B, 0x80, 0x3F, 0x3F, 0x40, 0x0B, 0x80, 0x3F, 0x2F, 0xC0, 0x0B, 0x80, 0x3F, 0x0F,
-    0xE0, 0x0B, 0x80, 0x3F, 0x07, 0xFC, 0x0B, 0x80, 0x3F, 0x02, 0xFF, 0xEB, 0x96, 0xFF, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xC0,
-    0x00, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xD0,
-    0x00, 0x00, 0x1F, 0x81, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x0B, 0xD0,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x0B, 0xE0,
-    0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x7E, 0x00, 0x00, 0x0B, 0xE0,
-    0x3F, 0x40, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x47, 0xE0, 0x00, 0x00, 0x07, 0xE3,
-    0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xEA, 0xBF, 0xF0, 0x02, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x80, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x56, 0xFF, 0x95, 0x55, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xEA, 0xAA,
-    0xAA, 0xA1, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x14, 0x07, 0xFE, 0x55, 0xAF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xEF,
-    0xAF, 0xD0, 0x0F, 0xF4, 0x3C, 0x06, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0x0B, 0xF0, 0x03, 0xC0, 0x00,
-    0x3F, 0x40, 0x0F, 0x00, 0x01, 0xFC, 0x00, 0x3C, 0x00, 0x0B, 0xE0, 0x00, 0xF0, 0x00, 0x3F, 0x40,
-    0x03, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xF0,
-    0x00, 0x3F, 0x40, 0x03, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0x00, 0x02, 0xF8, 0x00, 0x3C, 0x00, 0x07,
-    0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xD0, 0x03, 0xC0, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x7F, 0x80,
-    0x3C, 0x00, 0x00, 0xBF, 0x80, 0xF0, 0x00, 0x00, 0xBF, 0xEB, 0xD6, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x00, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x01, 0xF0, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x17, 0xF9, 0x6B, 0xF5, 0x54, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03,
-    0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0xF0,
-    0x02, 0xF4, 0x00, 0x03, 0xF0, 0x01, 0xFD, 0x05, 0x03, 0xF0, 0x00, 0xFF, 0xFE, 0x03, 0xF0, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF9, 0x5B, 0xF8, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x28, 0x0A, 0x80, 0xA4, 0x07, 0xE3, 0xFD,
-    0xFF, 0xDF, 0xFC, 0x0F, 0x8C, 0x7D, 0x0F, 0xD0, 0xF0, 0x3E, 0x35, 0xF0, 0x1E, 0x02, 0xD1, 0xF4,
-    0xBB, 0x80, 0x74, 0x0B, 0x4F, 0xC0, 0xBF, 0x41, 0xD0, 0x2E, 0xFD, 0x00, 0xBF, 0xFF, 0xEA, 0xFF,
-    0xD0, 0x00, 0xEB, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0x80, 0x79, 0x5B, 0x40, 0x00, 0x0E, 0x01, 0xD0,
-    0x2D, 0x00, 0x00, 0x24, 0x02, 0x40, 0x60, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA,
-    0xAA, 0xAA, 0xA9, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xD1, 0x6F, 0xF9, 0x55, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFD, 0x00, 0x06, 0xBF, 0xE0,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x6C,
-    0x00, 0x00, 0xFC, 0x6F, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x00, 0x7E, 0xFC, 0x02, 0xF0, 0x00, 0x43, 0xF1, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xE4, 0x00, 0x01, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x02, 0xA1, 0xE7, 0xF0, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x01,
-    0xFE, 0x00, 0x03, 0xF5, 0xBF, 0xE0, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x07, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0xBF, 0xAA, 0xAA, 0xA4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x0A, 0x02, 0x40, 0x2D,
-    0x00, 0x03, 0xD3, 0xF4, 0xBD, 0x02, 0xD0, 0x00, 0x3E, 0xFF, 0xFF, 0xF4, 0x3C, 0x00, 0x03, 0xFE,
-    0x2F, 0xD7, 0xEF, 0xC0, 0x00, 0x3F, 0x80, 0xB0, 0x0F, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE5, 0x56, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFA, 0x40, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFE, 0x03, 0xF0, 0x7F, 0xE0,
-    0x0B, 0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF0, 0x02, 0xF8, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0xFC, 0x2F, 0x40, 0x03, 0xF0, 0x00, 0xBD, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x7E, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x3F, 0x00, 0x02, 0x90, 0x00, 0x3F,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xFF,
-    0xFE, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xEA, 0xFF, 0xF8, 0x00, 0xFC, 0x00, 0x0F,
-    0xF0, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x00,
-    0x01, 0xFD, 0x00, 0xFD, 0x41, 0xBF, 0xE0, 0xBF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x80,
-    0x01, 0x7F, 0x95, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xAF,
-    0xFA, 0xA8, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0xFE, 0x55, 0x40, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x90, 0x64, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xF5, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFE, 0x0B, 0xFF,
-    0x80, 0x0B, 0xF2, 0xE0, 0xB4, 0xFD, 0x01, 0xFC, 0x2E, 0x0B, 0x43, 0xF0, 0x3F, 0x42, 0xE0, 0xB4,
-    0x2F, 0x83, 0xF0, 0x2E, 0x0B, 0x40, 0xFC, 0x7E, 0x02, 0xE0, 0xB4, 0x0F, 0xDB, 0xD0, 0x2E, 0x0B,
-    0x40, 0xBD, 0xFD, 0x02, 0xE0, 0xB4, 0x0B, 0xEF, 0xD0, 0x2E, 0x0B, 0x40, 0x7E, 0xFD, 0x00, 0x40,
-    0x50, 0x01, 0x5B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x17,
-    0xFF, 0xAA, 0xAA, 0xA0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x43, 0xC0, 0x00, 0x2D, 0x0F, 0x00, 0x00, 0xB4, 0x3C, 0x00, 0xBF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0x00, 0x07, 0xF8, 0xFC, 0x00, 0x07,
-    0xF3, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x07, 0xE3,
-    0xF0, 0x00, 0x7F, 0x0F, 0xFA, 0xAF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xF0,
-    0x00, 0x7F, 0xCF, 0xC0, 0x00, 0x3F, 0x7F, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0x0B, 0xF3, 0xFA, 0xAA, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xD0, 0xF0, 0x00, 0x0B, 0x43, 0xC0, 0x00,
-    0x2D, 0x0F, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xD0, 0x7F, 0xE5, 0xBC, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B,
-    0xF9, 0x06, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F,
-    0xFF, 0xFF, 0xFF, 0xD1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE4, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0xC1, 0xA8, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xBF, 0xF4, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x5B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x0F, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x5B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_16_regularBitmaps[45149] = {
+    0x0E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0xA1, 0xAC, 0xA1, 0xAC,
+    0xA1, 0xAC, 0xA1, 0xAC, 0xA1, 0xAC, 0x92, 0x97, 0x4E, 0x0A, 0xE9, 0xAE, 0xA9, 0xE2, 0x91, 0xAD,
+    0x2A, 0xD9, 0xAD, 0x2A, 0xD9, 0xAD, 0x2A, 0xD9, 0xAD, 0x29, 0xD0, 0xAD, 0x29, 0xD0, 0x9D, 0x29,
+    0xD0, 0x9D, 0x3D, 0x09, 0xD3, 0xD1, 0xCA, 0x3C, 0xA0, 0x7A, 0xC9, 0x39, 0xCA, 0x72, 0xD9, 0x3D,
+    0xA7, 0x2D, 0x4D, 0x97, 0x19, 0xD4, 0xD7, 0x2A, 0xD3, 0x9D, 0x72, 0xAC, 0xA3, 0xAD, 0x72, 0xD9,
+    0x3A, 0xCA, 0x5A, 0xAA, 0xAA, 0xEA, 0xAA, 0xAE, 0xAA, 0xA9, 0x1F, 0xFF, 0xFD, 0xA1, 0x99, 0x99,
+    0xAD, 0x99, 0x99, 0xAD, 0x99, 0x99, 0x95, 0xAC, 0xA3, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x2D, 0x93,
+    0xD9, 0x71, 0x9D, 0x4D, 0x72, 0xAD, 0x39, 0xD6, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFD, 0xA5, 0xD9,
+    0x3D, 0x97, 0x2D, 0x4D, 0x72, 0x9D, 0x39, 0xD7, 0x2A, 0xD3, 0xAD, 0x72, 0xDA, 0x3A, 0xCA, 0x72,
+    0xD9, 0x3D, 0x97, 0x2D, 0x4D, 0x96, 0x69, 0x75, 0xAC, 0xA7, 0x4A, 0xCA, 0x73, 0x9A, 0xCA, 0x97,
+    0x9F, 0xFD, 0x92, 0x9F, 0xFF, 0x19, 0xEA, 0x9A, 0xCA, 0x99, 0xAD, 0x1A, 0xD9, 0x1A, 0xCA, 0x6E,
+    0x2A, 0xCA, 0x6E, 0x2A, 0xCA, 0x6E, 0x91, 0xAC, 0xA6, 0x9E, 0xA0, 0xAC, 0xA7, 0xAF, 0xDA, 0x70,
+    0x9F, 0xEA, 0x70, 0x9F, 0xEA, 0x70, 0xAF, 0xE7, 0xAC, 0xA0, 0x9E, 0xA6, 0xAC, 0xA2, 0xE6, 0xAC,
+    0xA2, 0xAD, 0x6A, 0xCA, 0x2E, 0x09, 0x4A, 0xCA, 0x19, 0xE0, 0xEA, 0x99, 0xAC, 0xAA, 0xF9, 0x0F,
+    0xFF, 0xC9, 0x19, 0xFF, 0xDA, 0x70, 0x9A, 0xCA, 0x74, 0xAC, 0xA7, 0x4A, 0xCA, 0x74, 0xAC, 0xA6,
+    0x77, 0x74, 0xAE, 0xA7, 0x1D, 0x96, 0xFE, 0x7A, 0xD6, 0xAD, 0x91, 0xDA, 0x6D, 0x96, 0xDA, 0x29,
+    0xD5, 0xAD, 0x7D, 0x93, 0xD5, 0xD9, 0x69, 0xD4, 0xD9, 0x3E, 0x79, 0xD4, 0xD9, 0x29, 0xD7, 0x09,
+    0xD4, 0xD9, 0x2D, 0xA7, 0x09, 0xD4, 0xD9, 0x19, 0xD7, 0x2D, 0x4D, 0x91, 0xDA, 0x19, 0xAA, 0x94,
+    0xD9, 0x29, 0xD1, 0xAD, 0x1F, 0xD3, 0xAC, 0xA2, 0xAD, 0x1D, 0x90, 0xAD, 0xAA, 0xE2, 0x9D, 0xA9,
+    0xAD, 0x90, 0xAD, 0x1D, 0x92, 0xD9, 0x2A, 0xFC, 0xA1, 0xD9, 0x09, 0xD3, 0xDA, 0x39, 0xAC, 0xA9,
+    0x1E, 0x1A, 0xD3, 0xAD, 0x71, 0x9D, 0x2A, 0xCA, 0x39, 0xD7, 0x1D, 0xA2, 0xDA, 0x39, 0xD7, 0x09,
+    0xD3, 0xDA, 0x39, 0xD7, 0x0D, 0xA3, 0xAC, 0xA3, 0x9D, 0x7A, 0xD4, 0xAD, 0x3A, 0xD7, 0xD9, 0x49,
+    0xD3, 0xDA, 0x6A, 0xD6, 0xDA, 0x19, 0xD9, 0x6D, 0x96, 0x9F, 0xDA, 0x6E, 0x70, 0x9F, 0xA7, 0x75,
+    0x99, 0x40, 0x77, 0x74, 0x9F, 0xD9, 0x76, 0xAF, 0xFA, 0x74, 0x9E, 0xA9, 0x9A, 0xE9, 0x73, 0xE9,
+    0x39, 0xDA, 0x73, 0xE5, 0xE7, 0x3E, 0x5E, 0x73, 0xE4, 0x9D, 0xA7, 0x39, 0xDA, 0x3E, 0x97, 0x4E,
+    0x90, 0x9E, 0xA7, 0x6E, 0xAE, 0xA7, 0x79, 0xFC, 0x97, 0x79, 0xFC, 0x97, 0x7A, 0xFE, 0x96, 0xDA,
+    0x3A, 0xE9, 0x09, 0xEA, 0x49, 0xD9, 0x29, 0xE3, 0x9E, 0xA3, 0xE3, 0xE9, 0x49, 0xEA, 0x2E, 0x3E,
+    0x69, 0xEA, 0x0E, 0x93, 0xE7, 0x9F, 0xE4, 0xE7, 0x09, 0xFC, 0x5E, 0x71, 0xAF, 0x5A, 0xE7, 0xFD,
+    0xA5, 0xFA, 0x99, 0x99, 0xFC, 0x9E, 0xA4, 0x9F, 0xFE, 0xA2, 0xEA, 0x5A, 0xFE, 0xA5, 0xF7, 0x99,
+    0x97, 0x50, 0xAD, 0x0A, 0xD0, 0xAD, 0x0A, 0xD0, 0xAD, 0x09, 0xD0, 0x9D, 0x09, 0xD1, 0xCA, 0x00,
+    0x4D, 0xA3, 0xAD, 0x39, 0xDA, 0x3E, 0x39, 0xD9, 0x3E, 0x39, 0xDA, 0x3A, 0xD9, 0x3E, 0x4E, 0x39,
+    0xDA, 0x39, 0xDA, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x39,
+    0xDA, 0x39, 0xDA, 0x4E, 0x4E, 0x4A, 0xDA, 0x4E, 0x4E, 0x93, 0x9D, 0xA4, 0xAD, 0x5E, 0x49, 0xD9,
+    0x59, 0x00, 0xAD, 0x5E, 0x49, 0xD9, 0x4E, 0x49, 0xDA, 0x4E, 0x4A, 0xD9, 0x39, 0xDA, 0x4E, 0x4E,
+    0x4A, 0xD9, 0x3A, 0xD9, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA,
+    0x3A, 0xD9, 0x3E, 0x93, 0xE4, 0xE3, 0xAD, 0xA3, 0xE3, 0x9E, 0x3A, 0xD9, 0x3D, 0xA3, 0xE3, 0x9D,
+    0x94, 0x95, 0x69, 0x97, 0x49, 0xDA, 0x73, 0x9D, 0xA7, 0x4D, 0x97, 0x4D, 0x96, 0xA9, 0x3D, 0x49,
+    0x99, 0xEA, 0x90, 0xD0, 0x9A, 0xEA, 0xAF, 0xFF, 0xE0, 0x9A, 0xAA, 0xFD, 0xAA, 0xA9, 0x95, 0xF9,
+    0x71, 0xEA, 0xD7, 0x0A, 0xD9, 0x0E, 0x69, 0xE1, 0xAD, 0xA5, 0xE9, 0x2E, 0x94, 0xAD, 0x3A, 0xD7,
+    0x94, 0x93, 0x6A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC,
+    0xA7, 0x5A, 0xCA, 0x69, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99,
+    0x97, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x76,
+    0x97, 0x1E, 0x91, 0xE1, 0x9E, 0x1A, 0xD9, 0x1E, 0x2D, 0xA2, 0xD9, 0x19, 0xD3, 0x93, 0x70, 0xAF,
+    0xE9, 0xAF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x00, 0x5E, 0x0A, 0xE9, 0xAE, 0xA9, 0xE2, 0x91, 0x70,
+    0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0x71, 0xE7, 0x09, 0xD9, 0x70, 0xE7, 0x1D, 0xA7, 0x0A, 0xD9,
+    0x70, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x71, 0xE7, 0x09, 0xD9, 0x70, 0xE7, 0x1D, 0xA7, 0x0A, 0xD9,
+    0x70, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA7, 0x0A, 0xD7, 0x1E, 0x70, 0x9D,
+    0x97, 0x00, 0x77, 0x5A, 0xFC, 0xA7, 0x9F, 0xFC, 0x6F, 0x99, 0x9F, 0x4E, 0xA4, 0xAD, 0xA3, 0xE6,
+    0xE2, 0xAD, 0x96, 0x9D, 0xA1, 0xE7, 0x0E, 0x1E, 0x70, 0xE1, 0xE7, 0x0A, 0xD0, 0x9D, 0xA7, 0x0A,
+    0xD9, 0x9D, 0xA7, 0x0A, 0xD9, 0x9D, 0xA7, 0x0A, 0xD9, 0x9D, 0xA7, 0x0A, 0xD9, 0x9D, 0xA7, 0x0A,
+    0xD9, 0x9D, 0xA7, 0x0A, 0xD9, 0x0D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1, 0xE7, 0x0E, 0x1A, 0xD9,
+    0x69, 0xDA, 0x2D, 0xA6, 0xAD, 0x92, 0xE9, 0x49, 0xE4, 0xEA, 0x90, 0x9A, 0xE9, 0x49, 0xFF, 0xC9,
+    0x7A, 0xFD, 0x97, 0x29, 0x99, 0x60, 0x6A, 0xCA, 0x49, 0xF3, 0xAF, 0xC2, 0xFE, 0x1E, 0xA0, 0xE0,
+    0xEA, 0x1E, 0x1C, 0x92, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE0, 0x77, 0x49, 0xFD, 0xA6, 0xAF, 0xFD, 0x93, 0xFC, 0xA9, 0x9A,
+    0xF9, 0x29, 0xD9, 0x5A, 0xE3, 0x97, 0x0E, 0x75, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4E,
+    0x74, 0x9D, 0xA7, 0x4E, 0x74, 0xAD, 0xA7, 0x3A, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x90, 0x77, 0x39, 0xAF, 0xDA, 0x59, 0xFF, 0xEA, 0x3F, 0xA9,
+    0x99, 0xAF, 0x92, 0xAC, 0xA6, 0xAE, 0x75, 0xE9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xE7, 0x49,
+    0xE7, 0x3A, 0xE6, 0x9A, 0xAA, 0xAF, 0x7F, 0xE9, 0x70, 0xFF, 0xCA, 0x73, 0x9A, 0xF7, 0x5E, 0xA7,
+    0x49, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x74, 0x9E, 0x09, 0x97, 0x09, 0xE9, 0x0A, 0xDA, 0x93, 0x9A,
+    0xF1, 0xAF, 0xFF, 0xA3, 0x9F, 0xFC, 0xA9, 0x70, 0x99, 0x99, 0x70, 0x72, 0x9E, 0x76, 0xF7, 0x5F,
+    0xC7, 0x4A, 0xFC, 0x74, 0xD9, 0xE7, 0x3E, 0x0E, 0x72, 0xAD, 0x1E, 0x71, 0x9D, 0xA1, 0xE7, 0x1E,
+    0x2E, 0x70, 0xAD, 0x3E, 0x79, 0xD9, 0x3E, 0x7D, 0xA4, 0xE6, 0xE5, 0xE5, 0x9D, 0x95, 0xE5, 0xDA,
+    0x6E, 0x4E, 0x7E, 0x39, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAE, 0xAA, 0xA7, 0x4E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x30, 0x09, 0xFF, 0xE9, 0x2A, 0xFF,
+    0xEA, 0x2A, 0xFF, 0xE9, 0x2A, 0xD7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xDA, 0x74, 0xDA, 0x74, 0xDA,
+    0x9A, 0xAA, 0xA9, 0x59, 0xFF, 0xDA, 0x4F, 0xFF, 0x93, 0x95, 0x9F, 0x74, 0xEA, 0x73, 0x9E, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x73, 0xAD, 0xA0, 0x97, 0x09, 0xE1, 0xDA, 0x99, 0x19, 0x9F, 0x91,
+    0xFF, 0xF9, 0x3A, 0xFF, 0xA7, 0x19, 0x99, 0x70, 0x77, 0x79, 0xFD, 0xA6, 0x9F, 0xFA, 0x5A, 0xFA,
+    0x99, 0x99, 0x94, 0xAE, 0x97, 0x3E, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E,
+    0x19, 0xAE, 0xA9, 0x4E, 0x0A, 0xFF, 0x3E, 0xAD, 0xA9, 0x9A, 0xF2, 0xFA, 0x5E, 0xA1, 0xEA, 0x7E,
+    0x1E, 0x70, 0xAD, 0x90, 0xE7, 0x09, 0xD9, 0x0E, 0x70, 0x9D, 0x90, 0xE7, 0x09, 0xD9, 0x0A, 0xD9,
+    0x7A, 0xD9, 0x1E, 0x7E, 0x2A, 0xDA, 0x5A, 0xDA, 0x3F, 0x91, 0x9F, 0x5F, 0xFD, 0x7A, 0xFD, 0xA7,
+    0x39, 0x96, 0x9F, 0xFF, 0xE9, 0xAF, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74,
+    0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x4A,
+    0xD9, 0x74, 0xE7, 0x4A, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x49, 0xE7, 0x4E, 0x97, 0x39,
+    0xE7, 0x4E, 0x97, 0x4E, 0x71, 0x77, 0x49, 0xAF, 0xCA, 0x96, 0xAF, 0xFC, 0xA4, 0xAE, 0xA9, 0x99,
+    0xAE, 0xA3, 0xE6, 0xE9, 0x19, 0xD9, 0x69, 0xDA, 0x1A, 0xD9, 0x69, 0xDA, 0x1A, 0xD9, 0x69, 0xDA,
+    0x19, 0xDA, 0x6A, 0xD9, 0x2E, 0xA4, 0x9D, 0xA4, 0xF9, 0x1A, 0xE6, 0xFF, 0xA7, 0x0F, 0xDA, 0x70,
+    0xFF, 0xC5, 0x9E, 0xA1, 0x9F, 0x92, 0x9E, 0x59, 0xE9, 0x1E, 0x79, 0xE1, 0xDA, 0x70, 0xAD, 0x09,
+    0xDA, 0x70, 0xAD, 0x99, 0xDA, 0x70, 0xAD, 0x90, 0xE7, 0x0E, 0x1E, 0x96, 0x9E, 0x19, 0xEA, 0x39,
+    0xAE, 0x92, 0x9F, 0xFE, 0x95, 0xAF, 0xEA, 0x72, 0x99, 0x96, 0x77, 0x49, 0xAF, 0xC9, 0x7A, 0xFF,
+    0xC5, 0xAE, 0xA9, 0x9A, 0xF3, 0x9E, 0x5A, 0xDA, 0x2E, 0x96, 0xE2, 0xE7, 0x0D, 0xA1, 0xDA, 0x70,
+    0xE0, 0x9D, 0xA7, 0x0A, 0xD0, 0x9D, 0xA7, 0x0A, 0xD1, 0xDA, 0x70, 0xE9, 0x0E, 0x79, 0xE9, 0x0A,
+    0xDA, 0x59, 0xF9, 0x1F, 0x91, 0x9A, 0xFC, 0x3F, 0xFC, 0x0A, 0xD4, 0xAF, 0xCA, 0x1E, 0x75, 0xE7,
+    0x5D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0xAE, 0x49, 0x39, 0xAF, 0x5A, 0xFF, 0xA6,
+    0xAF, 0xDA, 0x97, 0x19, 0x99, 0x71, 0x19, 0x2E, 0x0A, 0xE9, 0xAE, 0x90, 0xE7, 0x77, 0x77, 0x73,
+    0xE0, 0xAE, 0x9A, 0xEA, 0x9E, 0x29, 0x10, 0x29, 0x29, 0xE1, 0xAE, 0x90, 0xAE, 0x91, 0xE7, 0x77,
+    0x77, 0x77, 0x59, 0xE1, 0x9E, 0x1A, 0xDA, 0x1E, 0x2E, 0x19, 0xD9, 0x1A, 0xD2, 0xDA, 0x29, 0x93,
+    0x77, 0x76, 0x9C, 0x97, 0x39, 0xE9, 0x71, 0x9F, 0xC7, 0x09, 0xFA, 0x70, 0x9F, 0xA7, 0x09, 0xFA,
+    0x70, 0x9F, 0xA7, 0x1F, 0x97, 0x29, 0xE9, 0x74, 0xAF, 0xA7, 0x49, 0xFC, 0x97, 0x39, 0xFC, 0xA7,
+    0x4A, 0xFA, 0x97, 0x3A, 0xFC, 0x74, 0x9E, 0x97, 0x59, 0xC9, 0x77, 0x00, 0x77, 0x1F, 0xFF, 0xE1,
+    0xFF, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFF,
+    0xE1, 0xFF, 0xFE, 0x00, 0x77, 0x09, 0xC9, 0x75, 0x9E, 0x97, 0x4A, 0xF9, 0x74, 0xAF, 0x97, 0x4A,
+    0xF9, 0x74, 0xAF, 0x97, 0x4A, 0xF9, 0x74, 0x9F, 0x74, 0x9E, 0x97, 0x1A, 0xFA, 0x79, 0xAF, 0x97,
+    0x9F, 0xC9, 0x7A, 0xFA, 0x97, 0xFC, 0xA7, 0x19, 0xE9, 0x73, 0x9C, 0x97, 0x77, 0x60, 0x77, 0x9A,
+    0xFD, 0x92, 0x9F, 0xFE, 0x2E, 0xAA, 0x99, 0xAE, 0xA1, 0xA9, 0x6E, 0x72, 0x9D, 0x97, 0x2D, 0xA7,
+    0x19, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0xE9, 0x79, 0xE9, 0x79, 0xE9, 0x70, 0xE7, 0x1E, 0x72,
+    0xD9, 0x71, 0x9D, 0x72, 0x9D, 0x73, 0x99, 0x77, 0x77, 0x69, 0xD9, 0x71, 0xF7, 0x1F, 0x71, 0xEA,
+    0x72, 0x99, 0x60, 0x72, 0x9A, 0xAD, 0xAA, 0x97, 0x70, 0x9F, 0xFE, 0xA7, 0x5F, 0xCA, 0x99, 0x99,
+    0xAF, 0xA7, 0x19, 0xEA, 0x70, 0x9E, 0xA7, 0x9E, 0x74, 0xAD, 0xA5, 0x9D, 0xA7, 0x6A, 0xD9, 0x4E,
+    0x79, 0x96, 0xE3, 0x9D, 0x5A, 0xFE, 0x93, 0xD9, 0x2D, 0xA4, 0xFF, 0xCA, 0x3D, 0xA1, 0x9D, 0x4E,
+    0x93, 0xDA, 0x3A, 0xD1, 0xAD, 0x3A, 0xD5, 0xDA, 0x39, 0xD1, 0xDA, 0x3D, 0xA5, 0xDA, 0x39, 0xD1,
+    0xD9, 0x29, 0xD9, 0x5D, 0xA3, 0x9D, 0x1D, 0x92, 0x9D, 0x6D, 0x93, 0x9D, 0x1D, 0x92, 0x9D, 0x6D,
+    0x93, 0xAD, 0x1D, 0x92, 0x9D, 0x94, 0x9D, 0x93, 0xDA, 0x1D, 0x93, 0xDA, 0x4E, 0x93, 0xD2, 0xDA,
+    0x3A, 0xD9, 0x2A, 0xF2, 0xDA, 0x2A, 0xD4, 0xFA, 0xE0, 0xEA, 0xE3, 0x9D, 0x5F, 0xCA, 0x2F, 0xC5,
+    0xDA, 0x69, 0x95, 0x99, 0x79, 0xD9, 0x77, 0x70, 0xE9, 0x77, 0x70, 0xEA, 0x72, 0x99, 0x73, 0xAF,
+    0xA9, 0x90, 0x99, 0xAA, 0xDA, 0x74, 0x9F, 0xFF, 0xC9, 0x77, 0xAA, 0xFC, 0xAA, 0x97, 0x00, 0x70,
+    0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76,
+    0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A,
+    0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF,
+    0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39,
+    0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76,
+    0xE0, 0xAF, 0xFA, 0xA9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE1, 0xE7, 0xAE, 0xA0, 0xE7, 0x0A, 0xE0,
+    0xE7, 0x1E, 0x0E, 0x71, 0xE0, 0xE7, 0x1E, 0x0E, 0x70, 0xAD, 0xA0, 0xE7, 0x9E, 0x1F, 0xAA, 0xAA,
+    0xAF, 0xA2, 0xFF, 0xF9, 0x3F, 0xFF, 0xD9, 0x1E, 0x79, 0xEA, 0x0E, 0x71, 0xE9, 0xE7, 0x1A, 0xDA,
+    0xE7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x1A, 0xFD, 0x71, 0xEA, 0xE7, 0x0F, 0x0E, 0xAA, 0xAA, 0xAA,
+    0xAF, 0xC9, 0x0F, 0xFF, 0xD9, 0x1F, 0xFE, 0xA9, 0x30, 0x77, 0x71, 0xAF, 0xEA, 0x96, 0xAF, 0xFF,
+    0x39, 0xFC, 0xAA, 0xAA, 0xAE, 0x93, 0xF9, 0x69, 0xA3, 0xF7, 0x5A, 0xE7, 0x6E, 0x97, 0x59, 0xE7,
+    0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xE9, 0x76, 0xE9, 0x76, 0xAD, 0xA7,
+    0x69, 0xE7, 0x7E, 0x97, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xAF, 0xA9, 0x99, 0x99, 0xAD,
+    0x5A, 0xFF, 0xF7, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x95, 0xAF, 0xFA, 0xA9, 0x7F, 0xFF, 0xCA, 0x5F,
+    0xFF, 0xE9, 0x3E, 0x7A, 0xF9, 0x2E, 0x71, 0xAE, 0x91, 0xE7, 0x2A, 0xE1, 0xE7, 0x3E, 0x90, 0xE7,
+    0x3A, 0xDA, 0x0E, 0x73, 0x9E, 0x0E, 0x74, 0xE0, 0xE7, 0x4E, 0x0E, 0x74, 0xE9, 0xE7, 0x4E, 0x9E,
+    0x74, 0xE0, 0xE7, 0x4E, 0x0E, 0x73, 0x9E, 0x0E, 0x73, 0xAD, 0xA0, 0xE7, 0x3E, 0x90, 0xE7, 0x2F,
+    0x1E, 0x71, 0xAE, 0x2E, 0x79, 0xF9, 0x2E, 0xAA, 0xAA, 0xAA, 0xFD, 0x93, 0xFF, 0xFC, 0xA5, 0xFF,
+    0xDA, 0x97, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xC0, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x69, 0xFF, 0xFC, 0x93, 0xFD, 0xAA, 0xAA, 0xAF,
+    0x3F, 0xA7, 0x0A, 0x92, 0xF9, 0x75, 0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97,
+    0x7E, 0x97, 0x7E, 0x70, 0xAA, 0xAA, 0xAA, 0xA9, 0xE7, 0x9F, 0xFE, 0x79, 0xFF, 0xE9, 0x73, 0x9E,
+    0xAD, 0xA7, 0x4E, 0x9E, 0x74, 0xE0, 0xE9, 0x73, 0xE0, 0xAE, 0x73, 0xE1, 0xEA, 0x72, 0xE1, 0x9F,
+    0x71, 0xE2, 0xAF, 0xCA, 0x99, 0x99, 0x9A, 0xF3, 0x9F, 0xFF, 0xE5, 0x9F, 0xFD, 0xA9, 0x72, 0x99,
+    0x99, 0x50, 0xAD, 0x73, 0x9D, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x90, 0xAF,
+    0xEA, 0xAF, 0xF1, 0x9E, 0xA9, 0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x91, 0xAF, 0xFA, 0xFF, 0x5A, 0xD6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0xAD, 0xA0, 0x99, 0x99, 0xAE, 0x1A, 0xFD, 0xA1, 0xAF,
+    0xC9, 0x49, 0x95, 0xAD, 0x71, 0x9D, 0xA0, 0xE7, 0x09, 0xE1, 0xE7, 0x9E, 0x2E, 0x7E, 0x92, 0xE6,
+    0xE9, 0x3E, 0x5E, 0x94, 0xE4, 0xEA, 0x5E, 0x3A, 0xDA, 0x6E, 0x2A, 0xDA, 0x7E, 0x1A, 0xE7, 0x0E,
+    0x09, 0xE7, 0x1E, 0xAF, 0xA7, 0x0F, 0xFC, 0x97, 0xFA, 0x0A, 0xE7, 0xEA, 0x2E, 0xA6, 0xE4, 0xE9,
+    0x5E, 0x49, 0xE5, 0xE5, 0xAE, 0x4E, 0x6E, 0xA3, 0xE6, 0x9E, 0x92, 0xE7, 0xAE, 0x2E, 0x70, 0xF1,
+    0xE7, 0x1E, 0xA0, 0xE7, 0x19, 0xE9, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xA0, 0xAE, 0xA7, 0x59, 0xFF, 0xC7, 0x5F, 0xFD, 0xA7, 0x39, 0xFF, 0xE7, 0x3A, 0xFF, 0xAD, 0x97,
+    0x2D, 0xAF, 0xD0, 0xDA, 0x71, 0x9D, 0x0F, 0xD0, 0xE7, 0x1E, 0x0F, 0xD0, 0x9D, 0x97, 0x0D, 0x90,
+    0xFD, 0x1E, 0x7A, 0xD1, 0xFD, 0x1A, 0xD7, 0xDA, 0x1F, 0xD1, 0x9D, 0xA5, 0x9D, 0x91, 0xFD, 0x2E,
+    0x5A, 0xD2, 0xFD, 0x2A, 0xD9, 0x4D, 0xA2, 0xFD, 0x3D, 0xA3, 0xAD, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD,
+    0x39, 0xD9, 0x19, 0xD9, 0x3F, 0xD4, 0xE1, 0xAD, 0x4F, 0xD4, 0xAD, 0x1D, 0xA4, 0xFD, 0x49, 0xDA,
+    0x9D, 0x94, 0xFD, 0x5F, 0xD5, 0xFD, 0x5A, 0xFA, 0x5F, 0xD6, 0xF6, 0xFD, 0x6F, 0x6F, 0xD6, 0x9D,
+    0x96, 0xE0, 0xAD, 0xA7, 0x3A, 0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7, 0x2A, 0xD0, 0xFD, 0x71, 0xAD,
+    0x0F, 0xD9, 0x70, 0xAD, 0x0E, 0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7, 0xAD, 0x0E, 0x1E, 0x96, 0xAD,
+    0x0E, 0x19, 0xE6, 0xAD, 0x0E, 0x2A, 0xDA, 0x5A, 0xD0, 0xE3, 0xE9, 0x4A, 0xD0, 0xE3, 0x9E, 0x4A,
+    0xD0, 0xE4, 0xEA, 0x3A, 0xD0, 0xE5, 0xE9, 0x2A, 0xD0, 0xE5, 0xAE, 0x2A, 0xD0, 0xE6, 0xEA, 0x1A,
+    0xD0, 0xE7, 0xE1, 0xAD, 0x0E, 0x7A, 0xE0, 0xAD, 0x0E, 0x70, 0xE9, 0xAD, 0x0E, 0x70, 0x9E, 0xAD,
+    0x0E, 0x71, 0xAF, 0xC0, 0xE7, 0x2F, 0xC0, 0xE7, 0x29, 0xF0, 0xE7, 0x3A, 0xE0, 0x77, 0x73, 0x9A,
+    0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E,
+    0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD,
+    0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA,
+    0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71,
+    0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF,
+    0xA7, 0x79, 0x97, 0x10, 0xAF, 0xEA, 0xA9, 0x4F, 0xFF, 0xA2, 0xFF, 0xFD, 0x1E, 0x6A, 0xEA, 0x0E,
+    0x7A, 0xE0, 0xE7, 0x0E, 0x9E, 0x70, 0xAD, 0x9E, 0x70, 0xAD, 0x9E, 0x70, 0xE9, 0xE7, 0x0E, 0x0E,
+    0x7A, 0xE0, 0xE5, 0x9F, 0x1F, 0xFF, 0xC9, 0x1F, 0xFE, 0xA3, 0xFA, 0xAA, 0xAA, 0x95, 0xE7, 0x4E,
+    0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x40, 0x77, 0x73, 0x9A, 0xFD,
+    0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7,
+    0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE,
+    0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA,
+    0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xE1, 0x9E, 0x97, 0x19, 0xE3,
+    0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xFA, 0x71, 0xAF, 0xFA, 0x77,
+    0x99, 0xF7, 0x72, 0xEA, 0x77, 0x19, 0xEA, 0x77, 0x19, 0xEA, 0x77, 0x1A, 0xEA, 0x77, 0x1A, 0xAA,
+    0xA9, 0x00, 0xAF, 0xEA, 0xA9, 0x6F, 0xFF, 0xA4, 0xFF, 0xFD, 0x3E, 0x6A, 0xEA, 0x2E, 0x79, 0xE2,
+    0xE7, 0x0E, 0x91, 0xE7, 0x0A, 0xD9, 0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0E, 0x91, 0xE7, 0x0E, 0x2E,
+    0x7E, 0xA2, 0xEA, 0x99, 0x99, 0x9A, 0xEA, 0x3F, 0xFF, 0x94, 0xFF, 0xE6, 0xE9, 0x3E, 0x95, 0xE4,
+    0x9E, 0x5E, 0x5A, 0xDA, 0x4E, 0x6E, 0x93, 0xE6, 0x9E, 0x3E, 0x7E, 0x92, 0xE7, 0x9E, 0x2E, 0x70,
+    0xAD, 0xA1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xE0, 0x77, 0x39, 0xAF, 0xDA, 0x94, 0xFF, 0xF2, 0xFC,
+    0xAA, 0xAA, 0xEA, 0x19, 0xE7, 0x99, 0x1E, 0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F,
+    0x97, 0x29, 0xFC, 0xA7, 0x2F, 0xDA, 0x97, 0x09, 0xFD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x74, 0xE9,
+    0x73, 0xAD, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x09, 0x70, 0x9E, 0x09, 0xEA, 0x99,
+    0x99, 0x9F, 0x90, 0x9F, 0xFF, 0x92, 0xAF, 0xFC, 0xA7, 0x09, 0x99, 0x96, 0xAF, 0xFF, 0xFC, 0x0A,
+    0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E,
+    0x71, 0xAD, 0xA1, 0xF7, 0xAE, 0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74,
+    0x99, 0x97, 0xAD, 0x74, 0x9D, 0xAA, 0xDA, 0x73, 0xAD, 0xA0, 0xE7, 0x3E, 0x1E, 0x97, 0x19, 0xE1,
+    0x9D, 0xA7, 0x1A, 0xD9, 0x2E, 0x71, 0xE3, 0xE9, 0x79, 0xE3, 0x9D, 0xA7, 0xAD, 0x94, 0xE7, 0xE5,
+    0xAD, 0x95, 0x9D, 0xA5, 0x9E, 0x5E, 0x96, 0xE5, 0xE7, 0xAD, 0x93, 0x9D, 0xA7, 0x9E, 0x3E, 0x97,
+    0x0E, 0x3E, 0x71, 0xAD, 0xA1, 0xAD, 0xA7, 0x2E, 0x1E, 0x73, 0xE1, 0xE7, 0x39, 0xD9, 0x9D, 0x97,
+    0x4D, 0xAA, 0xD7, 0x5F, 0xD7, 0x59, 0xF9, 0x76, 0xF7, 0x7A, 0xDA, 0x70, 0x9D, 0xA7, 0x1E, 0x71,
+    0xAD, 0x99, 0xE7, 0x0A, 0xE9, 0x70, 0xE1, 0xE7, 0x0F, 0xA7, 0x0E, 0x1A, 0xD9, 0x7F, 0xC7, 0x9D,
+    0xA1, 0x9D, 0xA6, 0x9D, 0xAD, 0x7A, 0xD9, 0x2E, 0x6A, 0xD9, 0xDA, 0x6E, 0x3E, 0x6E, 0x0E, 0x6E,
+    0x3A, 0xD9, 0x49, 0xDA, 0x0A, 0xD5, 0x9D, 0xA3, 0x9D, 0xA4, 0xAD, 0x19, 0xD9, 0x4A, 0xD9, 0x4E,
+    0x4E, 0x2D, 0xA4, 0xE5, 0xE4, 0xDA, 0x2E, 0x4E, 0x5A, 0xD9, 0x29, 0xD9, 0x2A, 0xD9, 0x29, 0xDA,
+    0x59, 0xDA, 0x2E, 0x4D, 0xA2, 0xAD, 0x96, 0xE2, 0xE4, 0xE2, 0xE7, 0xE1, 0x9D, 0x94, 0xAD, 0x2E,
+    0x7A, 0xD9, 0x0A, 0xD5, 0x9D, 0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xE6, 0xE0, 0xAD, 0x71, 0xE0, 0xDA,
+    0x6A, 0xD0, 0xE7, 0x1E, 0x9D, 0x96, 0x9D, 0x9D, 0xA7, 0x19, 0xDA, 0xD7, 0x0D, 0xAD, 0x97, 0x2F,
+    0xC7, 0x0F, 0xC7, 0x3F, 0x97, 0x0A, 0xF7, 0x3A, 0xE7, 0x2E, 0xA7, 0x39, 0xE7, 0x2E, 0x95, 0x0E,
+    0x72, 0x9D, 0x91, 0xAE, 0x71, 0xE3, 0xE9, 0x7E, 0x94, 0xE6, 0x9D, 0xA5, 0xAD, 0xA5, 0xE7, 0xE9,
+    0x3A, 0xD9, 0x79, 0xE2, 0x9D, 0xA7, 0x1A, 0xDA, 0x1E, 0x73, 0xE0, 0xAD, 0x97, 0x39, 0xFD, 0x75,
+    0xAF, 0x77, 0xEA, 0x76, 0xAF, 0x76, 0xFC, 0xA7, 0x4E, 0x0E, 0x97, 0x29, 0xDA, 0x1E, 0x72, 0xE2,
+    0xAD, 0xA7, 0x0A, 0xD9, 0x3E, 0x96, 0x9D, 0xA4, 0x9E, 0x6E, 0x6A, 0xDA, 0x4A, 0xD9, 0x7E, 0x39,
+    0xE7, 0x0A, 0xE2, 0xE7, 0x2E, 0x90, 0xAD, 0xA7, 0x29, 0xE0, 0xAD, 0x97, 0x29, 0xDA, 0x9E, 0x72,
+    0xE1, 0xE9, 0x70, 0xAD, 0xA2, 0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A, 0xDA, 0x4A,
+    0xD9, 0x6E, 0x4E, 0x7A, 0xDA, 0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97, 0x2E, 0xAD,
+    0xA7, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x73, 0xAD,
+    0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E,
+    0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39,
+    0xE7, 0x4E, 0x97, 0x3A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF,
+    0x9F, 0xE0, 0x9F, 0xE0, 0x9E, 0xAA, 0xAA, 0x09, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49,
+    0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49,
+    0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49,
+    0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xFE, 0x09, 0xFE, 0x19, 0x99, 0x99, 0x99, 0x00,
+    0x9D, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0x9D, 0xA7, 0x1E, 0x71,
+    0xAD, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0x9D, 0xA7, 0x1E, 0x71,
+    0xAD, 0x97, 0x1D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0x9D, 0xA7, 0x1E, 0x00,
+    0x0F, 0xE1, 0xFE, 0x90, 0xAA, 0xAA, 0xE9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A,
+    0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A,
+    0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A,
+    0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x0F, 0xE9, 0x0F, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x00,
+    0x6D, 0x75, 0x9E, 0x74, 0xF9, 0x72, 0x9D, 0xAD, 0x72, 0xDA, 0x0D, 0x97, 0x1D, 0x1A, 0xD7, 0x0A,
+    0xCA, 0x2D, 0x97, 0xD9, 0x2A, 0xD6, 0xAD, 0x4D, 0x95, 0xD9, 0x4A, 0xD4, 0xAD, 0x6D, 0x93, 0xD9,
+    0x6A, 0xD2, 0xAD, 0x70, 0xD9, 0x1D, 0xA7, 0x0A, 0xD0, 0x9D, 0x72, 0xD9, 0x77, 0x00, 0x0F, 0xFF,
+    0xE0, 0xFF, 0xFE, 0x77, 0x9A, 0xAA, 0x4E, 0x93, 0x9E, 0x49, 0xDA, 0x49, 0xD9, 0x49, 0xCA, 0x00,
+    0x77, 0x29, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E,
+    0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9,
+    0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x09, 0x99, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5D, 0xA1, 0xAF, 0xC9, 0x4D, 0xA9, 0xFF, 0xC3, 0xFC, 0xA9, 0x99,
+    0xAF, 0x2F, 0x95, 0xEA, 0x1E, 0xA6, 0x9E, 0x1E, 0x70, 0xE9, 0x0E, 0x70, 0xAD, 0x90, 0xE7, 0x09,
+    0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x0A, 0xD9, 0x0E,
+    0x70, 0xE9, 0x0E, 0xA7, 0xE1, 0xF6, 0xEA, 0x1F, 0xCA, 0x29, 0xF2, 0xD9, 0xAF, 0xFC, 0x3D, 0x19,
+    0xFD, 0xA7, 0x39, 0x96, 0x77, 0x29, 0xFD, 0xA9, 0x29, 0xFF, 0xCA, 0x2F, 0xA9, 0x9A, 0xAC, 0x91,
+    0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x97, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xF9, 0x19, 0x9C, 0xA2, 0x9F, 0xFC, 0xA4, 0xAF, 0xE9, 0x79,
+    0x93, 0x75, 0x99, 0x75, 0x9D, 0xA7, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xDA, 0x74, 0x9D, 0xA7,
+    0x49, 0xDA, 0x74, 0x9D, 0xA4, 0xAF, 0xC9, 0x1D, 0xA2, 0xAF, 0xFC, 0x0D, 0xA1, 0x9E, 0xA9, 0x99,
+    0x9F, 0xCA, 0x1E, 0xA5, 0xAE, 0xA0, 0x9E, 0x7E, 0xA0, 0xE9, 0x7A, 0xDA, 0x0E, 0x70, 0x9D, 0xA0,
+    0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D,
+    0xA0, 0xE9, 0x7A, 0xDA, 0x0A, 0xDA, 0x7E, 0xA1, 0xE9, 0x5A, 0xEA, 0x1A, 0xEA, 0x29, 0xAF, 0xA2,
+    0xAF, 0xFC, 0x0D, 0xA3, 0x9F, 0xDA, 0x1D, 0xA6, 0x99, 0x70, 0x77, 0x5A, 0xFC, 0xA9, 0x7F, 0xFC,
+    0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7,
+    0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39,
+    0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x69, 0x99, 0x99, 0x59, 0xFD, 0xA4, 0xFE, 0x93,
+    0xEA, 0x70, 0xE7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x69, 0xAF, 0xF1, 0xAF, 0xFD, 0x29,
+    0x9A, 0xDA, 0x99, 0x99, 0x49, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA,
+    0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70,
+    0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x50, 0x77, 0x5A, 0xFC, 0x91, 0xAC, 0xA2,
+    0x9F, 0xFC, 0x0D, 0xA1, 0x9F, 0x99, 0x9A, 0xFC, 0xA1, 0xEA, 0x5F, 0xA0, 0x9E, 0x7E, 0xA0, 0xAD,
+    0x97, 0xAD, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0,
+    0xE7, 0x1D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x97, 0x9D, 0xA0, 0xAD, 0xA7, 0xEA, 0x1E, 0x95, 0x9E,
+    0xA1, 0xAE, 0xA2, 0x9A, 0xFA, 0x2A, 0xFF, 0xC9, 0xDA, 0x39, 0xFD, 0xA1, 0xDA, 0x69, 0x94, 0xDA,
+    0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE2, 0x99, 0x7F, 0x2E, 0xAA, 0x99, 0x9A, 0xF3, 0xAF, 0xFE,
+    0x59, 0xAF, 0xDA, 0x93, 0x09, 0x99, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE7, 0x4E, 0x1A, 0xFC, 0xA3, 0xDA, 0x9F, 0xFC, 0x91, 0xFC, 0xA9, 0x99, 0x9F, 0x1F, 0x95, 0xE9,
+    0x0E, 0xA6, 0x9D, 0xA0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E,
+    0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E,
+    0x70, 0xE0, 0xE7, 0x0E, 0x09, 0xA1, 0x9E, 0x09, 0xE1, 0xDA, 0x77, 0x0D, 0xA1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0x49, 0xA5,
+    0x9E, 0x49, 0xE5, 0xDA, 0x77, 0x77, 0x0D, 0xA5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xDA, 0x4A, 0xDA, 0x0A,
+    0xA9, 0xAE, 0x1F, 0xDA, 0x1A, 0xF9, 0x20, 0x09, 0x97, 0x5D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D,
+    0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA6, 0xAD, 0xA1, 0xDA, 0x5A, 0xDA, 0x2D, 0xA4,
+    0xAD, 0xA3, 0xDA, 0x3A, 0xE4, 0xDA, 0x2A, 0xE5, 0xDA, 0x1A, 0xE6, 0xDA, 0x09, 0xE7, 0xDA, 0x9E,
+    0x70, 0xDA, 0xF9, 0x7F, 0xF7, 0xEA, 0x0A, 0xE6, 0xE2, 0xEA, 0x5D, 0xA3, 0xE9, 0x4D, 0xA3, 0x9E,
+    0x4D, 0xA4, 0xAE, 0x3D, 0xA5, 0xEA, 0x2D, 0xA6, 0xE9, 0x1D, 0xA6, 0x9E, 0x00, 0x09, 0x99, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x77, 0x73, 0xD2, 0xAF, 0xC9, 0x3A, 0xFC, 0xA3,
+    0xD9, 0x9F, 0xFA, 0x09, 0xFF, 0xC2, 0xFC, 0xA9, 0x99, 0xAE, 0xAD, 0xA9, 0x99, 0xAE, 0xA1, 0xF5,
+    0xAF, 0x95, 0xE1, 0xEA, 0x6F, 0x6A, 0xD9, 0x0E, 0x7E, 0x96, 0xAD, 0x90, 0xE7, 0xE7, 0x9D, 0x90,
+    0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90,
+    0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90,
+    0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0x77, 0x0D, 0x2A, 0xFC,
+    0xA3, 0xD9, 0x9F, 0xFC, 0x91, 0xFC, 0xA9, 0x99, 0x9F, 0x1F, 0x95, 0xEA, 0x0E, 0xA6, 0x9D, 0xA0,
+    0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7,
+    0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E,
+    0x77, 0x6A, 0xFD, 0xA7, 0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A,
+    0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A,
+    0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59,
+    0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x77, 0x1D, 0x91,
+    0xAF, 0xCA, 0x4D, 0x99, 0xFF, 0xC3, 0xFC, 0xA9, 0x99, 0xAF, 0x2F, 0x95, 0xEA, 0x1E, 0xA6, 0x9E,
+    0x1E, 0x70, 0xE9, 0x0E, 0x70, 0xAD, 0x90, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09,
+    0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x0A, 0xD9, 0x0E, 0x70, 0xE9, 0x0E, 0xA6, 0x9E, 0x1F, 0x6E,
+    0xA1, 0xFC, 0xA2, 0x9F, 0x2D, 0xAA, 0xFF, 0xC3, 0xDA, 0x09, 0xFD, 0xA4, 0xE3, 0x99, 0x7E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x74, 0x77, 0x5A, 0xFC, 0x91, 0xAC, 0xA2, 0x9F,
+    0xFC, 0x0D, 0xA1, 0x9E, 0xA9, 0x99, 0x9F, 0xCA, 0x1E, 0xA5, 0xAE, 0xA0, 0x9E, 0x7E, 0xA0, 0xE9,
+    0x7A, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0,
+    0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE9, 0x7A, 0xDA, 0x0A, 0xDA, 0x7E, 0xA1, 0xE9, 0x5A,
+    0xEA, 0x1A, 0xEA, 0x29, 0xAF, 0xA2, 0xAF, 0xFC, 0x9D, 0xA3, 0x9F, 0xDA, 0x09, 0xDA, 0x69, 0x93,
+    0x9D, 0xA7, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xDA, 0x74, 0x9D, 0xA7, 0x49, 0xDA, 0x74, 0x9D,
+    0xA7, 0x49, 0xDA, 0x74, 0xD2, 0xAF, 0x1D, 0x90, 0xFD, 0x1D, 0x9A, 0xDA, 0xA9, 0xA1, 0xFC, 0x6F,
+    0x7E, 0x97, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0x77, 0x09, 0xFE, 0xA3, 0xFF, 0xE1, 0xF9, 0x19, 0x9D, 0x91, 0xE7, 0x19,
+    0xDA, 0x72, 0xE7, 0x2F, 0x97, 0x1F, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xA7,
+    0x19, 0xE7, 0x2A, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD9, 0x9D, 0x93, 0x9A, 0xE0, 0x9F, 0xFE, 0x2A,
+    0xFF, 0xA7, 0x99, 0x95, 0x3D, 0x71, 0xD7, 0x09, 0xD7, 0x0E, 0x69, 0xFF, 0xC0, 0x9F, 0xFD, 0x19,
+    0x9E, 0x99, 0x99, 0x93, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xAE, 0x97, 0xFE, 0x94, 0xAF, 0xC9, 0x69, 0x92, 0x9D, 0xA7,
+    0x0D, 0xA9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70,
+    0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9,
+    0xDA, 0x79, 0xE9, 0xDA, 0x7A, 0xE0, 0xE7, 0xF0, 0xE9, 0x5A, 0xF0, 0xAE, 0xA2, 0x9A, 0xFC, 0x1F,
+    0xFD, 0x0E, 0x2A, 0xFD, 0xA1, 0xAD, 0x59, 0x97, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9,
+    0x0E, 0x70, 0xE1, 0xAD, 0x96, 0x9D, 0xA1, 0x9D, 0xA6, 0xE9, 0x2E, 0x6E, 0x3A, 0xD9, 0x49, 0xDA,
+    0x4E, 0x4E, 0x5E, 0x4E, 0x59, 0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x7A, 0xD1, 0x9D, 0xA7, 0x9D, 0xA0,
+    0xAD, 0x71, 0xE0, 0xE7, 0x1A, 0xD9, 0xD9, 0x72, 0xFC, 0x73, 0xFA, 0x73, 0x9E, 0x95, 0x9D, 0x96,
+    0xAE, 0x69, 0xDA, 0x9E, 0x6F, 0x6A, 0xD9, 0x0E, 0x6F, 0x95, 0xE1, 0xAD, 0x94, 0xAF, 0xC5, 0xE1,
+    0x9D, 0xA4, 0xDA, 0xAD, 0x49, 0xDA, 0x2E, 0x4D, 0x99, 0xD9, 0x3A, 0xD9, 0x2E, 0x39, 0xD1, 0xDA,
+    0x3E, 0x3A, 0xD9, 0x2E, 0x1E, 0x3E, 0x39, 0xDA, 0x2D, 0xA1, 0x9D, 0x91, 0x9D, 0x94, 0xE1, 0x9D,
+    0x92, 0xDA, 0x1A, 0xD5, 0xE1, 0xAD, 0x3E, 0x1E, 0x5A, 0xD9, 0x0D, 0xA3, 0xAD, 0x1D, 0xA6, 0xDA,
+    0x9D, 0x94, 0xD9, 0x9D, 0x96, 0xEA, 0xD5, 0xDA, 0xAD, 0x7A, 0xDA, 0xCA, 0x5A, 0xFC, 0x79, 0xF9,
+    0x59, 0xFA, 0x70, 0xF7, 0xF9, 0x70, 0xEA, 0x7A, 0xE4, 0x0A, 0xD9, 0x7A, 0xD9, 0x2E, 0x6A, 0xDA,
+    0x39, 0xE5, 0xE5, 0xAD, 0xA3, 0xE9, 0x6E, 0x2A, 0xDA, 0x79, 0xE1, 0xE7, 0x1A, 0xDA, 0xE7, 0x3F,
+    0xCA, 0x74, 0xF7, 0x49, 0xF7, 0x4F, 0xCA, 0x72, 0xE9, 0xAD, 0x97, 0x0A, 0xDA, 0x1E, 0x70, 0xE2,
+    0x9E, 0x6E, 0x93, 0xAD, 0xA4, 0xAD, 0xA5, 0xE9, 0x29, 0xE6, 0x9E, 0x2E, 0x97, 0xAD, 0xA0, 0xAD,
+    0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1, 0xAD, 0x96, 0x9D, 0xA2, 0xE6, 0xAD,
+    0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4, 0xE5, 0xAD, 0x93, 0xE6, 0xDA, 0x2A, 0xD9, 0x6E,
+    0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9, 0x70, 0xAD, 0x0E, 0x72, 0xDA, 0xDA, 0x72, 0xFC,
+    0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x74, 0xE9, 0x79, 0x99,
+    0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0x97, 0x20, 0x0F, 0xFF, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99,
+    0x9A, 0xE7, 0x1E, 0x97, 0x0A, 0xDA, 0x70, 0x9E, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xE7,
+    0x1E, 0x97, 0x09, 0xDA, 0x71, 0xE7, 0x1E, 0x97, 0x0A, 0xDA, 0x70, 0x9E, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xAF, 0xFF, 0x9A, 0xFF, 0xF9, 0x79, 0xAA, 0x96, 0xFA, 0x5F, 0xA9, 0x4A, 0xDA, 0x7E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0xAD, 0x94, 0xAA, 0xEA, 0x5E, 0xA7,
+    0xFC, 0x97, 0x9E, 0x97, 0x9D, 0xA7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE9, 0x79, 0xEA, 0x96, 0xAF, 0xA6, 0x9E, 0xA7, 0x30, 0x09, 0x91, 0xD9, 0x0D, 0x90, 0xD9,
+    0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D,
+    0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90,
+    0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x30, 0xAA, 0xA7,
+    0xFA, 0x5A, 0xFC, 0x7E, 0x96, 0x9D, 0xA7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7,
+    0xE7, 0xE9, 0x7F, 0xA9, 0x59, 0xEA, 0x49, 0xFA, 0x3A, 0xE9, 0x5E, 0x7D, 0xA7, 0xDA, 0x7D, 0xA7,
+    0xDA, 0x7D, 0xA7, 0xDA, 0x69, 0xDA, 0x6A, 0xD9, 0x49, 0xF4, 0xFC, 0x94, 0xEA, 0x77, 0x10, 0x19,
+    0xEA, 0x97, 0x90, 0xFF, 0xA9, 0x2A, 0xC9, 0x9D, 0xA9, 0xAF, 0xFD, 0x99, 0xA5, 0xAF, 0xD9, 0x73,
+    0x99, 0x92, 0x5E, 0x0A, 0xE9, 0xAE, 0x90, 0xE2, 0x97, 0x4A, 0xC9, 0x1A, 0xC9, 0x1A, 0xCA, 0x1A,
+    0xCA, 0x1D, 0xA1, 0xDA, 0x1D, 0xA1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0x9E, 0x09,
+    0xE5, 0x77, 0x3A, 0xD7, 0x2A, 0xD7, 0x2A, 0xD9, 0x95, 0x9F, 0xFC, 0x29, 0xFF, 0xD1, 0x9F, 0x92,
+    0x9A, 0x91, 0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE9, 0x71, 0xAD, 0xA7, 0x19, 0xE7, 0x2F, 0x69, 0x2F, 0xAA, 0x9A, 0xAD, 0x29, 0xFF, 0xD4, 0x9F,
+    0xDA, 0x7A, 0xD7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x39, 0x50, 0x77, 0x69, 0xAF, 0xCA, 0x96, 0xAF,
+    0xFD, 0x4A, 0xEA, 0x99, 0x9A, 0xD9, 0x4E, 0x69, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74,
+    0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x71, 0xAF, 0xFF, 0x3F, 0xFF, 0xC3, 0x99,
+    0x9E, 0xA9, 0x99, 0x99, 0x96, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xE7,
+    0x5E, 0x74, 0xE7, 0x3A, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0x77,
+    0x19, 0xC9, 0x39, 0x39, 0xC9, 0x1A, 0xD9, 0xAF, 0xCA, 0x9D, 0xA2, 0xFF, 0xFC, 0x4E, 0x92, 0x9E,
+    0x49, 0xD6, 0xD9, 0x3A, 0xCA, 0x6A, 0xD3, 0xD9, 0x7D, 0x3D, 0x97, 0xD3, 0xD9, 0x69, 0xD3, 0xAD,
+    0x6D, 0xA4, 0xDA, 0x4A, 0xD4, 0x9F, 0xA9, 0xAF, 0x92, 0x9F, 0xFF, 0xC9, 0x1A, 0xD1, 0x9A, 0xAA,
+    0x91, 0xDA, 0x29, 0x72, 0x91, 0x9D, 0xA7, 0x2A, 0xD9, 0x0E, 0x72, 0xE1, 0x9D, 0xA7, 0x0A, 0xD9,
+    0x2E, 0x97, 0xE3, 0x9E, 0x6A, 0xD5, 0xAD, 0x94, 0x9D, 0xA6, 0xE4, 0xE7, 0xAD, 0x92, 0x9D, 0xA7,
+    0x0E, 0x2E, 0x71, 0xAD, 0x90, 0x9D, 0xA7, 0x2E, 0x0E, 0x73, 0xAD, 0xAD, 0x97, 0x09, 0x99, 0x9F,
+    0xC9, 0x99, 0x95, 0xFF, 0xFC, 0x5F, 0xFF, 0xC7, 0x2E, 0x77, 0xE7, 0x29, 0x99, 0x99, 0xE9, 0x99,
+    0x99, 0x5F, 0xFF, 0xC5, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xA7, 0x2E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x09, 0x91, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D,
+    0x90, 0xD9, 0x0D, 0x90, 0x99, 0x77, 0x75, 0xAA, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9,
+    0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x93, 0x49, 0x99, 0x99, 0x95, 0xAF,
+    0xFC, 0x91, 0xFF, 0xE9, 0x09, 0xDA, 0x59, 0xA1, 0xAD, 0x72, 0xAD, 0x97, 0x19, 0xE9, 0x71, 0xAF,
+    0x97, 0x0A, 0xFC, 0xA5, 0x9F, 0xFA, 0x3D, 0xA2, 0x9F, 0x1A, 0xD5, 0xAD, 0xA0, 0xAD, 0x6E, 0x0A,
+    0xD6, 0xAD, 0x09, 0xDA, 0x5E, 0x1F, 0x92, 0x9D, 0x92, 0xFC, 0xAA, 0xDA, 0x49, 0xFE, 0x70, 0xAF,
+    0xA7, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x19, 0xDA, 0x0D, 0xA9, 0x39, 0xE9, 0x0F, 0xFE, 0x91,
+    0x9A, 0xFE, 0xA7, 0x70, 0x19, 0x49, 0x2E, 0x2A, 0xD1, 0xE2, 0xAD, 0x90, 0xAC, 0xA2, 0x9D, 0x00,
+    0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x5A, 0xFA, 0xAA, 0xFC, 0x97, 0x2E, 0xA6, 0x9A, 0xDA, 0x70,
+    0xDA, 0x72, 0x9D, 0xA6, 0xDA, 0x59, 0x99, 0x4D, 0xA4, 0xAC, 0xA4, 0xAF, 0xD3, 0xD9, 0x3D, 0x39,
+    0xFF, 0x39, 0xD2, 0xAC, 0x93, 0xE9, 0x39, 0x4D, 0x91, 0xD3, 0xAD, 0x97, 0x29, 0xCA, 0x1D, 0x3E,
+    0x74, 0xD0, 0x9C, 0xA3, 0xDA, 0x74, 0xD0, 0x9C, 0xA3, 0xD9, 0x74, 0xD0, 0x9C, 0xA3, 0xD9, 0x74,
+    0xD0, 0x9C, 0xA3, 0xD9, 0x74, 0xD1, 0xD3, 0xDA, 0x74, 0xD1, 0xD3, 0xAD, 0x73, 0x9C, 0xA1, 0xAC,
+    0x93, 0xDA, 0x72, 0xAC, 0x92, 0xD3, 0xAE, 0xAA, 0xAD, 0x4D, 0x3A, 0xCA, 0x39, 0xFE, 0x3D, 0x94,
+    0xD9, 0x49, 0xAA, 0x99, 0x3A, 0xD5, 0x9D, 0xA7, 0x3E, 0x79, 0xE9, 0x7A, 0xE7, 0x2A, 0xEA, 0xA9,
+    0x9A, 0xFA, 0x75, 0xAF, 0xFA, 0x77, 0x29, 0x99, 0x73, 0x72, 0x9A, 0xFA, 0x2E, 0xAE, 0xA1, 0x94,
+    0xD7, 0xD9, 0x29, 0xAA, 0xAD, 0x90, 0xAF, 0xE9, 0xAD, 0x3D, 0x9D, 0x93, 0xD9, 0xD9, 0x29, 0xD9,
+    0xAD, 0xA9, 0xAE, 0x90, 0xAF, 0x99, 0xC9, 0x71, 0x59, 0x49, 0x6D, 0xA2, 0x9D, 0x93, 0xE2, 0x9E,
+    0x3A, 0xD9, 0x2E, 0x3A, 0xDA, 0x2E, 0x39, 0xDA, 0x2E, 0x92, 0x9E, 0x2A, 0xDA, 0x3A, 0xDA, 0x2E,
+    0x94, 0xE9, 0x2E, 0x5E, 0x91, 0x9E, 0x5E, 0x29, 0xDA, 0x49, 0xE2, 0xAD, 0xA4, 0x9D, 0xA2, 0xE9,
+    0x4A, 0xC4, 0xCA, 0x77, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xD9, 0x75, 0xD9, 0x75, 0xD9, 0x75, 0xD9, 0x75, 0xD9, 0x75, 0xD9, 0x75, 0xAA, 0x00, 0x70,
+    0xAF, 0xE9, 0xAF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x5A,
+    0xFA, 0xAA, 0xFC, 0x97, 0x2E, 0xA6, 0x9A, 0xDA, 0x70, 0xDA, 0x72, 0x9D, 0xA6, 0xDA, 0x75, 0xDA,
+    0x4A, 0xCA, 0x2A, 0xFD, 0xA4, 0xD9, 0x3D, 0x3A, 0xFF, 0x39, 0xD2, 0xAC, 0x93, 0xAD, 0x29, 0xDA,
+    0x3D, 0x91, 0xD4, 0xAD, 0x3E, 0x39, 0xCA, 0x1D, 0x4A, 0xD3, 0xE4, 0xD0, 0x9C, 0xA4, 0xAD, 0x3D,
+    0xA4, 0xD0, 0x9C, 0xA4, 0xAD, 0x99, 0xAE, 0x5D, 0x09, 0xCA, 0x4A, 0xFE, 0x6D, 0x09, 0xCA, 0x4A,
+    0xDA, 0xAD, 0xA6, 0xD1, 0xD4, 0xAD, 0x1A, 0xD6, 0xD1, 0xD4, 0xAD, 0x2E, 0x49, 0xCA, 0x1A, 0xC9,
+    0x3A, 0xD2, 0x9D, 0x93, 0xAC, 0x92, 0xD3, 0xAD, 0x3E, 0x3D, 0x3A, 0xCA, 0x2A, 0xD3, 0x9D, 0xA1,
+    0xD9, 0x4D, 0x91, 0x99, 0x94, 0x99, 0x90, 0xAD, 0x59, 0xDA, 0x73, 0xE7, 0x9E, 0x97, 0xAE, 0x72,
+    0xAE, 0xAA, 0x99, 0xAF, 0xA7, 0x5A, 0xFF, 0xA7, 0x72, 0x99, 0x97, 0x30, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x76, 0xAF, 0xA4, 0xFF, 0x2A, 0xD3, 0xAD, 0x1D, 0x94, 0xD1, 0xD5, 0xD9, 0x0D, 0x5D, 0x90,
+    0xD9, 0x4D, 0x1A, 0xD3, 0xAD, 0x2F, 0xF4, 0xAF, 0xA7, 0x60, 0x6A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A,
+    0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x69, 0xFF, 0xFE, 0x99, 0xFF,
+    0xFE, 0x90, 0x99, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x97, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7,
+    0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x77, 0x70, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x39, 0x99, 0x5A, 0xFC, 0xA2, 0xEA, 0xAA, 0xDA, 0x2A,
+    0x39, 0xD7, 0x0D, 0x79, 0xD7, 0xAD, 0x69, 0xD6, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95,
+    0x9D, 0x96, 0xFF, 0xC1, 0xFF, 0xC7, 0x30, 0x39, 0x99, 0x49, 0xFE, 0x2E, 0xA9, 0xAE, 0x19, 0x93,
+    0x9D, 0x70, 0xD7, 0x9D, 0x6A, 0xD9, 0x29, 0xFC, 0x94, 0xAA, 0xAE, 0xA7, 0x9D, 0x97, 0xDA, 0x7D,
+    0xA6, 0x9D, 0x99, 0xDA, 0xAA, 0xAE, 0x09, 0xFE, 0xA4, 0x99, 0x99, 0x30, 0x29, 0xAA, 0xA3, 0xEA,
+    0x2A, 0xDA, 0x29, 0xDA, 0x3D, 0xA3, 0x9C, 0xA4, 0x0D, 0xA7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E,
+    0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E,
+    0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x9E, 0x0E, 0x7A, 0xE0, 0xEA, 0x59, 0xF0, 0xFA,
+    0x29, 0xAF, 0xC0, 0xFF, 0xE0, 0xAD, 0x0D, 0xA9, 0xFC, 0xA1, 0xAD, 0x0D, 0xA2, 0x99, 0x7E, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x73, 0x69, 0x99, 0x99, 0x99, 0x99, 0x94, 0xAF,
+    0xFF, 0x92, 0xFF, 0xCA, 0xAA, 0xD9, 0x1F, 0xFD, 0x2A, 0xC9, 0x09, 0xFF, 0xD2, 0xAC, 0x90, 0xFF,
+    0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0xFF,
+    0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0xFF, 0xE2, 0xAC, 0x90, 0x9F,
+    0xFD, 0x2A, 0xC9, 0x1F, 0xFD, 0x2A, 0xC9, 0x2F, 0xFC, 0x2A, 0xC9, 0x3A, 0xFE, 0x2A, 0xC9, 0x71,
+    0xD2, 0xAC, 0x97, 0x1D, 0x2A, 0xC9, 0x71, 0xD2, 0xAC, 0x97, 0x1D, 0x2A, 0xC9, 0x71, 0xD2, 0xAC,
+    0x97, 0x1D, 0x2A, 0xC9, 0x71, 0xD2, 0xAC, 0x97, 0x1D, 0x2A, 0xC9, 0x71, 0xD2, 0xAC, 0x97, 0x1D,
+    0x2A, 0xC9, 0x71, 0xD2, 0xAC, 0x97, 0x1D, 0x2A, 0xC9, 0x71, 0xD2, 0xAC, 0x97, 0x71, 0x5E, 0x0A,
+    0xE9, 0xAE, 0xA9, 0xE2, 0x91, 0x2D, 0x4A, 0xC9, 0x4F, 0x49, 0xE4, 0x9D, 0x4A, 0xD0, 0xAF, 0xC9,
+    0x09, 0xEA, 0x91, 0x71, 0x9E, 0x1A, 0xF9, 0xEA, 0xD9, 0xD0, 0x9D, 0x09, 0x19, 0xD3, 0x9D, 0x39,
+    0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x60, 0x74, 0x9F, 0xA3, 0xAE,
+    0xAE, 0x19, 0xD3, 0xAD, 0x0A, 0xC9, 0x4D, 0x0D, 0x94, 0xAC, 0x9D, 0x5A, 0xC9, 0xD5, 0xAC, 0x9A,
+    0xC9, 0x4D, 0x99, 0xD3, 0x9D, 0x1A, 0xDA, 0xAA, 0xD9, 0x2A, 0xFC, 0x75, 0x19, 0x49, 0x59, 0xD9,
+    0x2E, 0x5E, 0x29, 0xE5, 0xE2, 0x9D, 0xA4, 0x9E, 0x2A, 0xDA, 0x49, 0xDA, 0x2E, 0x94, 0xAD, 0xA2,
+    0xE4, 0x9E, 0x2A, 0xD9, 0x3E, 0x29, 0xDA, 0x3E, 0x91, 0x9E, 0x3A, 0xD9, 0x2E, 0x3A, 0xDA, 0x2E,
+    0x39, 0xDA, 0x2A, 0xD9, 0x4A, 0xC3, 0x9C, 0xA7, 0x73, 0x3A, 0xCA, 0x71, 0x9C, 0xA5, 0x9F, 0x71,
+    0xD9, 0x4A, 0xFC, 0x70, 0xAD, 0x4A, 0xD9, 0x9D, 0x79, 0xD6, 0xA1, 0x9D, 0x7D, 0xA7, 0x19, 0xD6,
+    0xAD, 0x72, 0x9D, 0x6D, 0x97, 0x29, 0xD5, 0xAD, 0x73, 0x9D, 0x49, 0xD7, 0x49, 0xD4, 0xDA, 0x39,
+    0x96, 0x9D, 0x3A, 0xD3, 0xAD, 0xA5, 0x9D, 0x3D, 0x93, 0xEA, 0x59, 0xD2, 0xDA, 0x3F, 0xA5, 0x9D,
+    0x19, 0xD3, 0xAC, 0x9D, 0xA6, 0x99, 0x1D, 0xA2, 0x9D, 0x0D, 0xA7, 0x1A, 0xD3, 0xD1, 0xDA, 0x71,
+    0xD9, 0x2A, 0xC9, 0x1D, 0xA7, 0x0D, 0xA2, 0x9C, 0xA2, 0xDA, 0x79, 0xD3, 0xD9, 0x2D, 0xA7, 0xD9,
+    0x2A, 0xFF, 0xDA, 0x4A, 0xD3, 0x9F, 0xFD, 0x93, 0x9D, 0x73, 0xDA, 0x5D, 0xA7, 0x3D, 0xA4, 0x9D,
+    0x74, 0xDA, 0x10, 0x39, 0xD9, 0x70, 0x9C, 0xA7, 0xAE, 0xA7, 0x0D, 0x95, 0x9F, 0xCA, 0x7A, 0xD6,
+    0xDA, 0x0D, 0xA6, 0x9D, 0x79, 0x91, 0xDA, 0x6D, 0xA7, 0x3D, 0xA5, 0xAD, 0x74, 0xDA, 0x5D, 0x97,
+    0x4D, 0xA4, 0xAD, 0x75, 0xDA, 0x39, 0xD7, 0x6D, 0xA3, 0xDA, 0x29, 0xAA, 0x97, 0xDA, 0x2A, 0xD1,
+    0xFE, 0x6D, 0xA2, 0xD9, 0x0E, 0xA9, 0xAE, 0x5D, 0xA1, 0xDA, 0x2A, 0x39, 0xD5, 0xDA, 0x09, 0xD7,
+    0x1D, 0x94, 0x99, 0x1D, 0xA7, 0x09, 0xD7, 0x0A, 0xD7, 0x1A, 0xCA, 0x70, 0xD9, 0x70, 0x9D, 0x70,
+    0xDA, 0x70, 0x9D, 0x97, 0x9D, 0x70, 0x9D, 0x97, 0x0D, 0x97, 0x9D, 0x97, 0x0A, 0xD7, 0x9D, 0x97,
+    0x09, 0xD7, 0x9D, 0x97, 0x1D, 0xA7, 0xFF, 0xC3, 0x9D, 0x70, 0xFF, 0xC0, 0x77, 0x73, 0xAF, 0xC9,
+    0x72, 0xD9, 0x3F, 0xFA, 0x70, 0xAD, 0x4A, 0xA3, 0xAD, 0x70, 0xD9, 0x73, 0xD7, 0xDA, 0x73, 0x9D,
+    0x69, 0xD7, 0x4D, 0xA6, 0xD9, 0x79, 0xFC, 0xA6, 0xAD, 0x70, 0x9F, 0xCA, 0x59, 0xD9, 0x74, 0x9A,
+    0xD4, 0xDA, 0x77, 0xDA, 0x29, 0xD3, 0x99, 0x97, 0x1D, 0xA2, 0xD9, 0x29, 0xDA, 0x71, 0xD9, 0x1A,
+    0xD3, 0xEA, 0x1A, 0xCA, 0x91, 0x9E, 0x19, 0xD3, 0xAE, 0xA1, 0x9F, 0xF9, 0x1D, 0xA2, 0x9C, 0xAA,
+    0xCA, 0x39, 0xAA, 0xAA, 0x92, 0xAD, 0x3D, 0x0D, 0xA7, 0x4D, 0x92, 0xD9, 0x0D, 0xA7, 0x3A, 0xCA,
+    0x2A, 0xCA, 0x1D, 0xA7, 0x29, 0xD3, 0xD2, 0xDA, 0x72, 0xDA, 0x2D, 0x92, 0xE7, 0x1A, 0xD2, 0x9F,
+    0xFD, 0xA7, 0xD9, 0x3F, 0xFD, 0xA6, 0xDA, 0x72, 0xDA, 0x79, 0xD7, 0x3D, 0xA7, 0xD9, 0x73, 0xDA,
+    0x10, 0x77, 0x4E, 0x71, 0xAE, 0x97, 0x0A, 0xE9, 0x71, 0xE7, 0x39, 0x77, 0x77, 0x7A, 0xCA, 0x72,
+    0xAC, 0xA7, 0x2D, 0xA7, 0x1A, 0xD9, 0x70, 0x9E, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0x9E,
+    0x71, 0xE7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x2E, 0x79, 0x1A, 0xEA, 0x91, 0x9A, 0xD9, 0x1A,
+    0xFF, 0xE2, 0xAF, 0xF9, 0x69, 0x99, 0x93, 0x59, 0xAA, 0x97, 0x72, 0xE9, 0x77, 0x19, 0xE7, 0x72,
+    0x9D, 0xA7, 0x72, 0x9D, 0x97, 0x72, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x5E, 0x77, 0x2E, 0xA7, 0x70,
+    0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A,
+    0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD,
+    0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD,
+    0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00, 0x73, 0xAA, 0xA9,
+    0x77, 0x0A, 0xE7, 0x71, 0xE7, 0x71, 0xE9, 0x77, 0x0A, 0xD9, 0x77, 0x1D, 0x77, 0x77, 0x77, 0x77,
+    0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76,
+    0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A,
+    0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF,
+    0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39,
+    0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76,
+    0xE0, 0x70, 0xAA, 0xA7, 0x71, 0xAE, 0xA7, 0x79, 0xFC, 0xA7, 0x59, 0xDA, 0x0A, 0xD9, 0x74, 0xDA,
+    0x2A, 0xD9, 0x72, 0xAC, 0x94, 0x9D, 0x77, 0x77, 0x77, 0x72, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7,
+    0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91,
+    0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70,
+    0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73,
+    0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0x69, 0x95, 0x99, 0x72, 0xFA,
+    0x29, 0xCA, 0x71, 0xFE, 0xAA, 0xD7, 0x2D, 0x19, 0xFC, 0xA7, 0x19, 0xC9, 0x39, 0xAA, 0x97, 0x77,
+    0x77, 0x77, 0x3E, 0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E,
+    0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29,
+    0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF,
+    0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E,
+    0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D,
+    0xA0, 0xE7, 0x6E, 0x00, 0x69, 0x49, 0x75, 0xE2, 0xAD, 0x74, 0xE2, 0xE9, 0x73, 0xAC, 0xA2, 0x9C,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69,
+    0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9,
+    0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E,
+    0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA,
+    0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90,
+    0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0x77, 0x75, 0xAF, 0x77, 0xAC, 0xA9, 0xAD, 0x76, 0xD2,
+    0xAC, 0x76, 0xCA, 0x2A, 0xC9, 0x75, 0xD2, 0xD7, 0x69, 0xFC, 0xA7, 0x79, 0xEA, 0x77, 0x0A, 0xF7,
+    0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91,
+    0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70,
+    0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73,
+    0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0x73, 0xAF, 0xFF, 0xE9, 0x72,
+    0x9F, 0xFF, 0xF9, 0x72, 0xFF, 0xFF, 0xC9, 0x71, 0x9D, 0xA1, 0xE7, 0x73, 0xE9, 0x1E, 0x77, 0x29,
+    0xE2, 0xE7, 0x72, 0xAD, 0x92, 0xE7, 0x72, 0xE3, 0xE7, 0x71, 0xAD, 0x93, 0xE7, 0x71, 0xE4, 0xE7,
+    0x70, 0xAD, 0x94, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0x7E, 0x5F, 0xFE, 0xA6, 0xAD, 0x95, 0xFF, 0xEA,
+    0x6E, 0x6E, 0x76, 0xAF, 0xFF, 0xC7, 0x6F, 0xFF, 0xD7, 0x59, 0xEA, 0xAA, 0xAA, 0xAA, 0xAE, 0x75,
+    0xE7, 0x0E, 0x74, 0x9D, 0xA7, 0x0E, 0x74, 0xE7, 0x1E, 0x73, 0x9E, 0x71, 0xE7, 0x3E, 0x97, 0x1E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0x9E, 0x72, 0xFF, 0xF9, 0x0E, 0x97, 0x2F, 0xFF, 0x90, 0x77, 0x71,
+    0xAF, 0xEA, 0x96, 0xAF, 0xFF, 0x39, 0xFC, 0xAA, 0xAA, 0xAE, 0x93, 0xF9, 0x69, 0xA3, 0xF7, 0x5A,
+    0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xE9,
+    0x76, 0xE9, 0x76, 0xAD, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xEA, 0x76,
+    0xAF, 0xA9, 0x99, 0x99, 0xAD, 0x5A, 0xFF, 0xF7, 0xAF, 0xFC, 0xA7, 0x2A, 0xCA, 0x97, 0x6D, 0x77,
+    0x9E, 0xA7, 0x79, 0xDA, 0x77, 0xAC, 0xA7, 0x7D, 0xA7, 0x3F, 0xD7, 0x4F, 0xA6, 0x2A, 0xAA, 0x97,
+    0x1A, 0xE7, 0x2E, 0x97, 0x2E, 0x73, 0xE7, 0x3A, 0xC9, 0x77, 0x77, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA,
+    0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x79,
+    0xAA, 0xA7, 0x1E, 0xA7, 0x0A, 0xDA, 0x70, 0x9E, 0x71, 0xE7, 0x19, 0xCA, 0x77, 0x77, 0x1A, 0xFF,
+    0xF9, 0xFF, 0xFC, 0xAF, 0xFF, 0xC9, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFC, 0xAF,
+    0xFF, 0xCA, 0x49, 0xAA, 0x97, 0x1F, 0x97, 0xFD, 0x6A, 0xD9, 0x0E, 0x4A, 0xD9, 0x2E, 0x29, 0xCA,
+    0x5A, 0xCA, 0x77, 0x74, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC,
+    0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x71, 0x94, 0x9D, 0x92, 0xDA, 0x39, 0xDA, 0x2E,
+    0x4D, 0x3A, 0xC9, 0x77, 0x77, 0x73, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0,
+    0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x9A, 0xAA, 0x5E, 0x94, 0x9E, 0x59,
+    0xDA, 0x59, 0xD9, 0x59, 0xCA, 0x77, 0x3A, 0xFE, 0xAA, 0xFF, 0x19, 0xEA, 0x93, 0xE5, 0xE5, 0xE5,
+    0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE9,
+    0x1A, 0xFF, 0xAF, 0xF0, 0x5A, 0xAA, 0x94, 0xAE, 0x5E, 0x94, 0xE9, 0x49, 0xD9, 0x5D, 0x97, 0x77,
+    0xAF, 0xEA, 0x0A, 0xFF, 0x29, 0xEA, 0x94, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE9, 0x2A, 0xFF, 0x0A, 0xFF, 0x00, 0x3A,
+    0xAA, 0x7A, 0xF5, 0x9F, 0xCA, 0x4E, 0x0A, 0xD9, 0x2D, 0xA2, 0xAD, 0x90, 0xAC, 0x94, 0x9D, 0x77,
+    0x71, 0xAF, 0xEA, 0x2A, 0xFF, 0x49, 0xEA, 0x96, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE9, 0x4A, 0xFF, 0x2A, 0xFF, 0x10, 0x09, 0x49, 0x1E, 0x2A, 0xD0, 0xE2, 0xAD,
+    0x9A, 0xCA, 0x29, 0xD7, 0x77, 0x6A, 0xFE, 0xA0, 0xAF, 0xF2, 0x9E, 0xA9, 0x4E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x92,
+    0xAF, 0xF0, 0xAF, 0xF0, 0x19, 0xFF, 0xAA, 0x97, 0x1A, 0xFF, 0xFA, 0x7A, 0xFF, 0xFD, 0x95, 0xAD,
+    0x96, 0xAF, 0x94, 0xAD, 0x97, 0x0A, 0xE4, 0xAD, 0x97, 0x1F, 0x3A, 0xD9, 0x72, 0xE9, 0x2A, 0xD9,
+    0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x29, 0xE2, 0xAD, 0x97, 0x3E, 0x2A, 0xDA, 0x73, 0xE0, 0xFF, 0xE9,
+    0x5E, 0x9F, 0xFE, 0x95, 0xE9, 0xAA, 0xFA, 0xAA, 0xAA, 0x6E, 0x2A, 0xD9, 0x73, 0xE2, 0xAD, 0x97,
+    0x29, 0xE2, 0xAD, 0x97, 0x2A, 0xDA, 0x2A, 0xD9, 0x72, 0xE9, 0x2A, 0xD9, 0x71, 0xF3, 0xAD, 0x97,
+    0x0A, 0xE4, 0xAD, 0x96, 0x9F, 0x94, 0xAE, 0xAA, 0xAA, 0xAF, 0xD9, 0x5A, 0xFF, 0xFA, 0x7A, 0xFF,
+    0xCA, 0x97, 0x59, 0x95, 0x99, 0x70, 0xFC, 0x3C, 0xA7, 0xFE, 0xAA, 0xD9, 0x7D, 0x19, 0xFC, 0xA7,
+    0x9C, 0x93, 0x9A, 0xA9, 0x77, 0x77, 0x75, 0xAD, 0xA7, 0x3A, 0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7,
+    0x2A, 0xD0, 0xFD, 0x71, 0xAD, 0x0F, 0xD9, 0x70, 0xAD, 0x0E, 0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7,
+    0xAD, 0x0E, 0x1E, 0x96, 0xAD, 0x0E, 0x19, 0xE6, 0xAD, 0x0E, 0x2A, 0xDA, 0x5A, 0xD0, 0xE3, 0xE9,
+    0x4A, 0xD0, 0xE3, 0x9E, 0x4A, 0xD0, 0xE4, 0xEA, 0x3A, 0xD0, 0xE5, 0xE9, 0x2A, 0xD0, 0xE5, 0xAE,
+    0x2A, 0xD0, 0xE6, 0xEA, 0x1A, 0xD0, 0xE7, 0xE1, 0xAD, 0x0E, 0x7A, 0xE0, 0xAD, 0x0E, 0x70, 0xE9,
+    0xAD, 0x0E, 0x70, 0x9E, 0xAD, 0x0E, 0x71, 0xAF, 0xC0, 0xE7, 0x2F, 0xC0, 0xE7, 0x29, 0xF0, 0xE7,
+    0x3A, 0xE0, 0x6A, 0xAA, 0x77, 0x2F, 0x77, 0x2E, 0x97, 0x72, 0xE7, 0x73, 0xDA, 0x77, 0x3A, 0xC9,
+    0x77, 0x77, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA,
+    0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7,
+    0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9,
+    0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7,
+    0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6,
+    0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0x73, 0x9A, 0xAA, 0x77, 0x1E, 0x97, 0x70,
+    0xAD, 0xA7, 0x70, 0x9D, 0xA7, 0x71, 0xDA, 0x77, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFD,
+    0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7,
+    0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE,
+    0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA,
+    0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E,
+    0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7,
+    0x79, 0x97, 0x10, 0x70, 0x9A, 0xA9, 0x77, 0x1F, 0x77, 0x0F, 0xD7, 0x6E, 0x99, 0xE7, 0x4A, 0xD3,
+    0xDA, 0x72, 0x9C, 0xA5, 0xAC, 0x97, 0x77, 0x77, 0x76, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96,
+    0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD,
+    0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F,
+    0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E,
+    0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A,
+    0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0x69, 0x99,
+    0x49, 0xA7, 0x2A, 0xF9, 0x2D, 0x71, 0x9F, 0xEA, 0xDA, 0x71, 0xD2, 0xAF, 0xC7, 0x2C, 0xA4, 0xAC,
+    0xA7, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A, 0xFC,
+    0xA4, 0x9E, 0xA7, 0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0, 0x9E,
+    0x75, 0xE9, 0xAD, 0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD,
+    0x97, 0x6F, 0xD9, 0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1, 0xEA,
+    0x73, 0xAD, 0xA1, 0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA,
+    0x6A, 0xFF, 0xFA, 0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x75, 0x97, 0x49, 0xD9, 0x2D, 0xA7, 0x3A,
+    0xD9, 0x19, 0xDA, 0x74, 0xD3, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x71, 0x9F,
+    0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE,
+    0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD,
+    0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9,
+    0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79,
+    0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10,
+    0x77, 0xA9, 0x70, 0x9C, 0x0A, 0xD9, 0x69, 0xDA, 0x0E, 0x94, 0x9E, 0x2E, 0x92, 0x9E, 0x4E, 0x90,
+    0x9E, 0x6E, 0xAE, 0x70, 0xFC, 0x71, 0xAE, 0xA7, 0x09, 0xFC, 0x96, 0x9E, 0x0E, 0x94, 0x9E, 0x2E,
+    0x92, 0x9E, 0x4E, 0x90, 0x9E, 0x6E, 0x99, 0xD7, 0x0D, 0x97, 0x49, 0x00, 0x77, 0x1A, 0x70, 0x9A,
+    0xFD, 0xA9, 0x09, 0xD9, 0x49, 0xFF, 0xFE, 0x4A, 0xFC, 0xA9, 0x9A, 0xFD, 0x49, 0xEA, 0x7F, 0x93,
+    0xEA, 0x70, 0xFC, 0x2A, 0xE7, 0x0F, 0xDA, 0x1E, 0x70, 0xAD, 0x90, 0xE0, 0x9E, 0x79, 0xDA, 0x1E,
+    0x9A, 0xDA, 0x7E, 0x2A, 0xDA, 0xE9, 0x6A, 0xD3, 0x9F, 0xD9, 0x59, 0xD9, 0x4F, 0xD6, 0xE5, 0xFD,
+    0x5E, 0x6F, 0xD9, 0x3A, 0xD9, 0x6F, 0xD9, 0x29, 0xDA, 0x69, 0xEA, 0xDA, 0x2E, 0x7A, 0xDA, 0x9E,
+    0x1A, 0xD9, 0x7E, 0x90, 0xE0, 0x9D, 0xA7, 0x0E, 0x1F, 0xE7, 0x0A, 0xDA, 0x19, 0xFC, 0x70, 0x9E,
+    0x3A, 0xEA, 0x79, 0xEA, 0x39, 0xFC, 0xA9, 0x99, 0x9A, 0xFA, 0x4F, 0xFF, 0xEA, 0x4A, 0xD9, 0x0A,
+    0xFF, 0xA7, 0xAA, 0x59, 0x97, 0x77, 0x70, 0x4A, 0xAA, 0x97, 0x6A, 0xE7, 0x7E, 0xA7, 0x7E, 0x77,
+    0x0E, 0x77, 0x0A, 0xC9, 0x77, 0x77, 0x74, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0,
+    0x9E, 0x71, 0xAD, 0xA1, 0xF7, 0xAE, 0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA,
+    0x74, 0x99, 0x97, 0x71, 0x9A, 0xAA, 0x76, 0xEA, 0x75, 0xAD, 0xA7, 0x6E, 0x76, 0xE7, 0x69, 0xCA,
+    0x77, 0x77, 0x76, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E, 0x71, 0xAD, 0xA1,
+    0xF7, 0xAE, 0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74, 0x99, 0x97, 0x69,
+    0xAA, 0x97, 0x6F, 0x97, 0x4F, 0xD7, 0x3A, 0xD9, 0x0E, 0x71, 0xAD, 0x92, 0xE7, 0x9C, 0xA5, 0xAC,
+    0xA7, 0x77, 0x77, 0x1E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xE0, 0xAD, 0xA7, 0x2E, 0x09, 0xE7, 0x1A, 0xDA,
+    0x1F, 0x7A, 0xE3, 0xFA, 0x99, 0x99, 0xAF, 0x94, 0xFF, 0xF9, 0x69, 0xFF, 0xA7, 0x49, 0x99, 0x70,
+    0x59, 0x49, 0x71, 0x9D, 0x92, 0xDA, 0x70, 0x9D, 0xA2, 0xE7, 0x1D, 0x3A, 0xC9, 0x77, 0x77, 0x77,
+    0x75, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E, 0x71, 0xAD, 0xA1, 0xF7, 0xAE,
+    0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74, 0x99, 0x97, 0x72, 0xAA, 0xA7,
+    0x6A, 0xE7, 0x59, 0xE7, 0x6E, 0x76, 0xAD, 0x77, 0xCA, 0x77, 0x77, 0x76, 0xAD, 0x97, 0x29, 0xDA,
+    0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAD, 0xA2, 0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A,
+    0xDA, 0x4A, 0xD9, 0x6E, 0x4E, 0x7A, 0xDA, 0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97,
+    0x2E, 0xAD, 0xA7, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0xAD, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0xAA, 0xAA,
+    0xAA, 0x95, 0xFF, 0xF9, 0x2F, 0xFF, 0xCA, 0x1E, 0x59, 0xF9, 0x0E, 0x7A, 0xE0, 0xE7, 0x0E, 0x9E,
+    0x70, 0xAD, 0x9E, 0x70, 0xAD, 0x9E, 0x70, 0xAD, 0x9E, 0x70, 0xE0, 0xE7, 0xAE, 0x0E, 0x6A, 0xE9,
+    0x0F, 0xAA, 0xAF, 0xD9, 0x1F, 0xFF, 0x92, 0xFF, 0xA9, 0x5E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E,
+    0x74, 0x59, 0x99, 0x99, 0x71, 0x9F, 0xFA, 0x6A, 0xFF, 0xE9, 0x3A, 0xE9, 0x39, 0xAE, 0x3E, 0x96,
+    0xE9, 0x2E, 0x7A, 0xD9, 0x2E, 0x7A, 0xD9, 0x2E, 0x69, 0xE3, 0xE5, 0x9E, 0x4E, 0x4A, 0xE5, 0xE3,
+    0xAE, 0x6E, 0x3E, 0x7E, 0x3E, 0x7E, 0x3E, 0x96, 0xE3, 0x9E, 0xA5, 0xE4, 0xAF, 0x4E, 0x59, 0xF9,
+    0x2E, 0x7A, 0xE9, 0x1E, 0x70, 0xAE, 0x1E, 0x71, 0xAD, 0x90, 0xE7, 0x19, 0xDA, 0x0E, 0x71, 0x9D,
+    0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x1A, 0xCA, 0x3A, 0xE1, 0xE1, 0xAF, 0xFC, 0x91, 0xE2, 0xAF, 0xE9,
+    0x73, 0x99, 0x94, 0x3A, 0xAA, 0x97, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0x4A,
+    0xCA, 0x77, 0x77, 0x59, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD,
+    0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0,
+    0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09,
+    0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x71, 0xAA, 0xA7, 0x2F, 0x71, 0x9E,
+    0x72, 0xE7, 0x2A, 0xD7, 0x29, 0xCA, 0x77, 0x77, 0x79, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99,
+    0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE,
+    0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6,
+    0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x6A,
+    0xAA, 0x72, 0xFA, 0x70, 0xAF, 0xC9, 0x6A, 0xDA, 0x0E, 0x59, 0xD9, 0x2E, 0x4D, 0x94, 0xAC, 0xA7,
+    0x77, 0x72, 0x9F, 0xE9, 0x39, 0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73,
+    0xE7, 0x3E, 0x73, 0xE5, 0x9A, 0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6,
+    0xE9, 0xE7, 0xE9, 0xDA, 0x7E, 0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC,
+    0x99, 0xD1, 0x9F, 0xDA, 0x19, 0xD4, 0x99, 0x96, 0x49, 0x95, 0xA3, 0x9F, 0xA2, 0xAC, 0x92, 0xFE,
+    0xAA, 0xD2, 0x9C, 0xA1, 0x9F, 0xC9, 0x2A, 0xC4, 0x9A, 0xA9, 0x77, 0x77, 0x39, 0xFE, 0x93, 0x9F,
+    0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA,
+    0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9,
+    0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D,
+    0x49, 0x99, 0x60, 0x49, 0x49, 0x6D, 0xA2, 0xE4, 0x9E, 0x2E, 0x5A, 0xC9, 0x2A, 0xCA, 0x77, 0x77,
+    0x77, 0x29, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E,
+    0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9,
+    0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x77, 0x4F, 0xA7, 0x0D, 0xA9, 0xDA, 0x7C, 0xA2,
+    0xD6, 0x9C, 0x92, 0xD7, 0xD1, 0x9D, 0x7A, 0xFC, 0x97, 0x09, 0xAC, 0xA7, 0x77, 0x76, 0x9F, 0xE9,
+    0x39, 0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73, 0xE7, 0x3E, 0x73, 0xE5,
+    0x9A, 0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6, 0xE9, 0xE7, 0xE9, 0xDA,
+    0x7E, 0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC, 0x99, 0xD1, 0x9F, 0xDA,
+    0x19, 0xD4, 0x99, 0x96, 0x77, 0x75, 0x9A, 0xFD, 0x93, 0xAF, 0xC9, 0x5F, 0xFE, 0x09, 0xFF, 0xA4,
+    0xAD, 0xA9, 0x09, 0x9E, 0xAE, 0x91, 0x9E, 0xA4, 0x96, 0xFC, 0x5E, 0x74, 0xAE, 0x95, 0x9D, 0xA7,
+    0x39, 0xE7, 0xE7, 0x39, 0xE7, 0xE5, 0x99, 0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xAA, 0xAE, 0x3A, 0xFF,
+    0xFF, 0xFD, 0x2F, 0xAA, 0x99, 0x9A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0xA5, 0x9D, 0xA7,
+    0x39, 0xE6, 0x9E, 0x73, 0x9D, 0xA6, 0xAE, 0x73, 0x9D, 0xA6, 0xFA, 0x72, 0x9E, 0x5A, 0xFC, 0x97,
+    0x2E, 0xA2, 0x9E, 0x99, 0xEA, 0x91, 0x99, 0xAC, 0x91, 0x9F, 0xFC, 0x91, 0x9F, 0xFD, 0x92, 0x9F,
+    0xDA, 0x49, 0xFF, 0x96, 0x99, 0x97, 0x19, 0x99, 0x50, 0x77, 0x29, 0xFD, 0xA9, 0x29, 0xFF, 0xCA,
+    0x2F, 0xA9, 0x9A, 0xAC, 0x91, 0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xF9, 0x19, 0x9C, 0xA2, 0x9F,
+    0xFC, 0xA4, 0xAF, 0xE9, 0x6A, 0xCA, 0x72, 0xD7, 0x29, 0xEA, 0x72, 0x9D, 0x97, 0x2A, 0xCA, 0x72,
+    0xDA, 0x6F, 0xD7, 0xFA, 0x30, 0x39, 0xAA, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5A, 0xD9, 0x75, 0xAD,
+    0x76, 0x9C, 0xA7, 0x77, 0x77, 0x4A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E,
+    0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74,
+    0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19,
+    0x99, 0x50, 0x71, 0xAA, 0xA7, 0x4A, 0xE7, 0x39, 0xE7, 0x4E, 0x74, 0xAD, 0x75, 0xD7, 0x77, 0x77,
+    0x6A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD,
+    0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F,
+    0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x6A, 0xAA, 0x74,
+    0xAE, 0xA7, 0x2A, 0xFC, 0x97, 0x09, 0xDA, 0x0E, 0x96, 0x9D, 0xA2, 0xAD, 0x95, 0xD9, 0x49, 0xD7,
+    0x77, 0x77, 0x1A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D,
+    0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF,
+    0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA,
+    0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x49,
+    0x49, 0x70, 0xE2, 0xAD, 0x7E, 0x2E, 0x7A, 0xC9, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x73, 0xAF, 0xCA,
+    0x97, 0xFF, 0xCA, 0x5E, 0xA9, 0x09, 0xAE, 0xA3, 0xE9, 0x5E, 0x29, 0xDA, 0x6A, 0xDA, 0x1A, 0xD9,
+    0x7E, 0x1E, 0x70, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x1E, 0x75, 0xE7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xF9, 0x91, 0x99,
+    0xAC, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xF9, 0x71, 0x99, 0x95, 0x0A, 0xAA, 0x93, 0xAE, 0x4A, 0xDA,
+    0x4A, 0xD9, 0x4A, 0xD5, 0xAC, 0x97, 0x73, 0xDA, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x00, 0x3A, 0xAA, 0x3E, 0xA2, 0x9E, 0x3E,
+    0x3E, 0x39, 0xCA, 0x77, 0x5D, 0xA4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3, 0x4A, 0xA9, 0x7F, 0x95, 0xAF, 0xC9, 0x3A, 0xDA, 0x0E,
+    0x29, 0xD9, 0x2E, 0x1D, 0x5A, 0xCA, 0x77, 0x74, 0xDA, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE3, 0x19, 0x49, 0x1D, 0xA2, 0xE9, 0xDA, 0x2E, 0x0D, 0x92, 0xAC, 0xA7, 0x77, 0x71,
+    0xDA, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x6E, 0x20, 0x59, 0x77, 0x9D, 0x92, 0x9D, 0x7A, 0xEA, 0x9A, 0xE7, 0x09, 0xFD, 0xA7, 0x2A,
+    0xFA, 0x71, 0x9F, 0xE9, 0x79, 0xEA, 0x09, 0xE7, 0x0C, 0xA3, 0x9E, 0x76, 0xAD, 0x97, 0x6E, 0x7A,
+    0xAC, 0xAA, 0x90, 0xAD, 0x94, 0xFF, 0xC9, 0xDA, 0x3F, 0xCA, 0xAF, 0xE2, 0xEA, 0x5A, 0xF1, 0x9E,
+    0x7A, 0xE1, 0xE9, 0x70, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90,
+    0xE7, 0x1E, 0x1E, 0x71, 0xE1, 0xAD, 0xA7, 0x9D, 0xA2, 0xE9, 0x6E, 0x39, 0xEA, 0x39, 0xEA, 0x49,
+    0xFF, 0xDA, 0x7A, 0xFD, 0xA9, 0x73, 0x99, 0x70, 0x49, 0x95, 0xA4, 0x9F, 0xA2, 0xAC, 0x4F, 0xEA,
+    0xAD, 0x3A, 0xC9, 0x19, 0xFC, 0x93, 0xAC, 0x4A, 0xAA, 0x97, 0x77, 0x73, 0xD2, 0xAF, 0xCA, 0x3D,
+    0x99, 0xFF, 0xC9, 0x1F, 0xCA, 0x99, 0x99, 0xF1, 0xF9, 0x5E, 0xA0, 0xEA, 0x69, 0xDA, 0x0E, 0x70,
+    0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0,
+    0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0x4A,
+    0xAA, 0x76, 0xAE, 0x76, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xAC, 0x97, 0x77, 0x77, 0x6A, 0xFD, 0xA7,
+    0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70,
+    0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9,
+    0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A,
+    0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x71, 0x9A, 0xAA, 0x75, 0xEA, 0x74, 0xAD,
+    0xA7, 0x49, 0xDA, 0x75, 0xDA, 0x75, 0x9C, 0xA7, 0x77, 0x77, 0x70, 0xAF, 0xDA, 0x79, 0xFF, 0xD9,
+    0x5F, 0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71,
+    0xE1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E,
+    0x1A, 0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F,
+    0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x69, 0xAA, 0x97, 0x5F, 0x97, 0x3F, 0xD7, 0x2A, 0xD9,
+    0x9E, 0x70, 0xAD, 0x92, 0xE6, 0x9C, 0xA5, 0xAC, 0x97, 0x77, 0x77, 0x3A, 0xFD, 0xA7, 0x9F, 0xFD,
+    0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7,
+    0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71,
+    0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49,
+    0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x49, 0x99, 0x49, 0xA6, 0xAF, 0x92, 0xD5, 0x9F, 0xEA,
+    0xDA, 0x5A, 0xC9, 0x1A, 0xFC, 0x6A, 0xA4, 0xAC, 0xA7, 0x77, 0x77, 0x5A, 0xFD, 0xA7, 0x9F, 0xFD,
+    0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7,
+    0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71,
+    0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49,
+    0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x73, 0x97, 0x09, 0xD9, 0x2D, 0xA7, 0xAD, 0xA1, 0x9E,
+    0x70, 0xD3, 0xD9, 0x77, 0x77, 0x77, 0x76, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x5F, 0x99, 0x99, 0xF9,
+    0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71, 0xE1, 0xE7, 0x1E, 0x90,
+    0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E, 0x1A, 0xD9, 0x70, 0xE1,
+    0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xDA,
+    0x74, 0x99, 0x70, 0x79, 0x76, 0xE7, 0x49, 0xE9, 0x74, 0xE7, 0x59, 0xA9, 0x77, 0x77, 0x70, 0x9F,
+    0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x71,
+    0xE7, 0x49, 0xE9, 0x73, 0x9E, 0x97, 0x4A, 0xCA, 0x60, 0x75, 0x99, 0x6A, 0xFD, 0x90, 0xDA, 0x4F,
+    0xFF, 0x4F, 0x99, 0x99, 0xF9, 0x3E, 0xA4, 0x9F, 0x29, 0xE5, 0xFC, 0x91, 0xAD, 0x94, 0xAD, 0x9E,
+    0x1E, 0x49, 0xD9, 0x0E, 0x1E, 0x4D, 0xA1, 0xE9, 0x0E, 0x3E, 0x2A, 0xD9, 0x0E, 0x2A, 0xD9, 0x2A,
+    0xD9, 0x0E, 0x19, 0xDA, 0x3E, 0x90, 0xE1, 0xE4, 0xE1, 0xAD, 0x9A, 0xD5, 0xE1, 0x9F, 0xC9, 0x4A,
+    0xDA, 0x2F, 0xA4, 0x9E, 0x39, 0xF9, 0x19, 0xAE, 0x93, 0xAF, 0xFE, 0x93, 0x9D, 0xAA, 0xFD, 0xA6,
+    0x9C, 0x39, 0x97, 0x77, 0x10, 0x3A, 0xAA, 0x97, 0x3A, 0xE7, 0x4A, 0xDA, 0x74, 0xAD, 0x97, 0x4A,
+    0xD7, 0x5A, 0xC9, 0x77, 0x77, 0x49, 0xDA, 0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D,
+    0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E,
+    0x95, 0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70,
+    0x71, 0xAA, 0xA7, 0x3E, 0xA7, 0x29, 0xE7, 0x3E, 0x73, 0xE7, 0x39, 0xCA, 0x77, 0x77, 0x69, 0xDA,
+    0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E,
+    0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95, 0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1,
+    0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0x6A, 0xA9, 0x73, 0xF9, 0x71, 0xAF, 0xC9,
+    0x7A, 0xDA, 0x0E, 0x69, 0xD9, 0x2E, 0x5D, 0x5A, 0xCA, 0x77, 0x77, 0x19, 0xDA, 0x70, 0xDA, 0x9D,
+    0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E,
+    0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95, 0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2,
+    0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0x49, 0x49, 0x7D, 0xA2, 0xE5, 0x9D, 0xA2, 0xE6, 0xD9, 0x2A,
+    0xCA, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E,
+    0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95,
+    0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0x71,
+    0xAA, 0xA7, 0x4A, 0xE7, 0x39, 0xE7, 0x4E, 0x74, 0xAD, 0x75, 0xD7, 0x77, 0x77, 0x1A, 0xD9, 0x70,
+    0x9D, 0xA9, 0xDA, 0x70, 0xAD, 0x90, 0xE7, 0x0E, 0x1A, 0xD9, 0x69, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E,
+    0x6E, 0x39, 0xDA, 0x49, 0xDA, 0x4E, 0x4E, 0x5A, 0xD9, 0x3E, 0x6D, 0xA2, 0xAD, 0x96, 0xE2, 0xE7,
+    0x9D, 0x91, 0xDA, 0x70, 0xE0, 0xAD, 0x97, 0x0A, 0xD0, 0xE7, 0x2D, 0xAD, 0xA7, 0x2F, 0xC7, 0x39,
+    0xF7, 0x4E, 0x97, 0x4E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x4E, 0x97, 0x99, 0x9A, 0xEA,
+    0x70, 0xAF, 0xD7, 0x1A, 0xF9, 0x72, 0x09, 0x99, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5E, 0x1A, 0xFC, 0xA4, 0xDA, 0x9F, 0xFC, 0x3F, 0xCA, 0x99, 0x9A, 0xF2, 0xF9,
+    0x5E, 0xA1, 0xEA, 0x7E, 0x1E, 0x70, 0xE9, 0x0E, 0x70, 0xAD, 0x90, 0xE7, 0x09, 0xDA, 0x0E, 0x70,
+    0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x0A, 0xD9, 0x0E, 0x70, 0xE9, 0x0E,
+    0xA7, 0xE1, 0xF6, 0xEA, 0x1F, 0xCA, 0x29, 0xF2, 0xDA, 0xAF, 0xFC, 0x3D, 0xA0, 0x9F, 0xDA, 0x4E,
+    0x39, 0x97, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x40, 0x49, 0x49, 0x70,
+    0xE2, 0xAD, 0x7E, 0x2E, 0x7A, 0xC9, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x6A, 0xD9, 0x70, 0x9D, 0xA9,
+    0xDA, 0x70, 0xAD, 0x90, 0xE7, 0x0E, 0x1A, 0xD9, 0x69, 0xDA, 0x2E, 0x6A, 0xD9, 0x2E, 0x6E, 0x39,
+    0xDA, 0x49, 0xDA, 0x4E, 0x4E, 0x5A, 0xD9, 0x3E, 0x6D, 0xA2, 0xAD, 0x96, 0xE2, 0xE7, 0x9D, 0x91,
+    0xDA, 0x70, 0xE0, 0xAD, 0x97, 0x0A, 0xD0, 0xE7, 0x2D, 0xAD, 0xA7, 0x2F, 0xC7, 0x39, 0xF7, 0x4E,
+    0x97, 0x4E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x4E, 0x97, 0x99, 0x9A, 0xEA, 0x70, 0xAF,
+    0xD7, 0x1A, 0xF9, 0x72, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0x97, 0x29, 0xFF, 0xCA, 0x72, 0x9F, 0xFC,
+    0x97, 0x77, 0x77, 0x77, 0x2E, 0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D,
+    0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29,
+    0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7,
+    0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09,
+    0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA,
+    0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0xAF, 0xFC, 0x93, 0x9F,
+    0xFC, 0x77, 0x77, 0x39, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD,
+    0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0,
+    0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09,
+    0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x49, 0xA6, 0xA9, 0x72, 0x9C, 0xA4,
+    0xAC, 0xA7, 0x3E, 0xAA, 0xAE, 0x74, 0x9F, 0xE9, 0x76, 0xAA, 0xCA, 0xA7, 0x77, 0x77, 0x77, 0x5E,
+    0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D,
+    0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD,
+    0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF,
+    0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E,
+    0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E,
+    0x00, 0x2A, 0xA6, 0xA9, 0x3A, 0xC9, 0x4D, 0x93, 0x9E, 0xAA, 0xAE, 0x5A, 0xFE, 0x70, 0xAD, 0xA9,
+    0x77, 0x77, 0x59, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA,
+    0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF,
+    0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x70, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7,
+    0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91,
+    0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70,
+    0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73,
+    0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE7, 0x71, 0x9D, 0x77, 0x2D, 0x77,
+    0x2D, 0x97, 0x72, 0xD7, 0x73, 0xD9, 0x77, 0x2E, 0xAA, 0x77, 0x09, 0xF9, 0x77, 0x19, 0x91, 0x77,
+    0x39, 0xFE, 0x94, 0x9F, 0xFD, 0xA4, 0xDA, 0x99, 0x09, 0xAE, 0x93, 0x96, 0xAD, 0xA7, 0x4E, 0x74,
+    0xE7, 0x4E, 0x69, 0xAA, 0xAA, 0xF3, 0xAF, 0xFE, 0x2F, 0xAA, 0x99, 0x99, 0xE1, 0xEA, 0x6E, 0x09,
+    0xE7, 0xE0, 0x9D, 0xA7, 0xE0, 0x9D, 0xA6, 0x9E, 0x09, 0xE6, 0xF1, 0xEA, 0x3A, 0xFC, 0x19, 0xFF,
+    0xC9, 0x9D, 0x29, 0xFD, 0xA1, 0x9D, 0x59, 0x99, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x39, 0xD7, 0x4A,
+    0xD7, 0x4A, 0xD7, 0x49, 0xEA, 0xA7, 0x2A, 0xF7, 0x49, 0x90, 0x73, 0xAA, 0xA9, 0x75, 0xAE, 0x76,
+    0xE9, 0x75, 0xE9, 0x75, 0x9D, 0x97, 0x6D, 0x97, 0x77, 0x77, 0x73, 0xAF, 0xEA, 0x96, 0xAF, 0xFF,
+    0x39, 0xFC, 0xAA, 0xAA, 0xAE, 0x93, 0xF9, 0x69, 0xA3, 0xF7, 0x5A, 0xE7, 0x6E, 0x97, 0x59, 0xE7,
+    0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xE9, 0x76, 0xE9, 0x76, 0xAD, 0xA7,
+    0x69, 0xE7, 0x7E, 0x97, 0x6F, 0x76, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xAF, 0xA9, 0x99, 0x99, 0xAD,
+    0x5A, 0xFF, 0xF7, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x95, 0x71, 0xAA, 0xA7, 0x1A, 0xE7, 0x09, 0xE7,
+    0x1E, 0x71, 0xAD, 0x72, 0xCA, 0x77, 0x77, 0x59, 0xFD, 0xA9, 0x29, 0xFF, 0xCA, 0x2F, 0xA9, 0x9A,
+    0xAC, 0x91, 0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xF9, 0x19, 0x9C, 0xA2, 0x9F, 0xFC, 0xA4, 0xAF,
+    0xE9, 0x79, 0x93, 0x70, 0xAA, 0xA7, 0x6A, 0xF7, 0x49, 0xFC, 0xA7, 0x3E, 0x0A, 0xD9, 0x71, 0xDA,
+    0x2A, 0xD9, 0x7A, 0xC9, 0x49, 0xD7, 0x77, 0x77, 0x7A, 0xFE, 0xA9, 0x6A, 0xFF, 0xF3, 0x9F, 0xCA,
+    0xAA, 0xAA, 0xE9, 0x3F, 0x96, 0x9A, 0x3F, 0x75, 0xAE, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xAD, 0xA7,
+    0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x77, 0xE7, 0x7E, 0x97, 0x6E, 0x97, 0x6A, 0xDA, 0x76, 0x9E, 0x77,
+    0xE9, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0xA7, 0x6A, 0xFA, 0x99, 0x99, 0x9A, 0xD5, 0xAF, 0xFF,
+    0x7A, 0xFF, 0xCA, 0x72, 0x99, 0x99, 0x50, 0x6A, 0xAA, 0x72, 0xFA, 0x70, 0xAF, 0xC9, 0x69, 0xDA,
+    0x0E, 0x94, 0x9D, 0xA2, 0xAD, 0x4D, 0x94, 0x9C, 0xA7, 0x77, 0x73, 0x9F, 0xDA, 0x93, 0x9F, 0xFC,
+    0xA3, 0xFA, 0x99, 0xAA, 0xC9, 0x2E, 0xA7, 0x19, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xEA, 0x72, 0x9F, 0x91, 0x99, 0xCA, 0x39,
+    0xFF, 0xCA, 0x5A, 0xFE, 0x97, 0x09, 0x94, 0x71, 0xA9, 0x77, 0xE7, 0x7E, 0x97, 0x6A, 0xD7, 0x77,
+    0x77, 0x77, 0x76, 0xAF, 0xEA, 0x96, 0xAF, 0xFF, 0x39, 0xFC, 0xAA, 0xAA, 0xAE, 0x93, 0xF9, 0x69,
+    0xA3, 0xF7, 0x5A, 0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6A, 0xDA, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE7,
+    0x7E, 0x77, 0xE9, 0x76, 0xE9, 0x76, 0xAD, 0xA7, 0x69, 0xE7, 0x7E, 0x97, 0x6F, 0x76, 0x9E, 0xA7,
+    0x6A, 0xEA, 0x76, 0xAF, 0xA9, 0x99, 0x99, 0xAD, 0x5A, 0xFF, 0xF7, 0xAF, 0xFC, 0xA7, 0x29, 0x99,
+    0x95, 0x69, 0xA7, 0x3E, 0x72, 0xE7, 0x2E, 0x77, 0x77, 0x77, 0x29, 0xFD, 0xA9, 0x29, 0xFF, 0xCA,
+    0x2F, 0xA9, 0x9A, 0xAC, 0x91, 0xEA, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x97, 0x19, 0xE7, 0x2E, 0xA7, 0x19, 0xF9, 0x19, 0x9C, 0xA2, 0x9F,
+    0xFC, 0xA4, 0xAF, 0xE9, 0x79, 0x93, 0x4A, 0xA6, 0xAA, 0x79, 0xD9, 0x3D, 0xA7, 0x09, 0xDA, 0x09,
+    0xDA, 0x72, 0xAD, 0xAE, 0x74, 0xAF, 0x76, 0xE9, 0x77, 0x77, 0x77, 0x2A, 0xFE, 0xA9, 0x6A, 0xFF,
+    0xF3, 0x9F, 0xCA, 0xAA, 0xAA, 0xE9, 0x3F, 0x96, 0x9A, 0x3F, 0x75, 0xAE, 0x76, 0xE9, 0x75, 0x9E,
+    0x76, 0xAD, 0xA7, 0x6E, 0x97, 0x6E, 0x97, 0x6E, 0x77, 0xE7, 0x7E, 0x97, 0x6E, 0x97, 0x6A, 0xDA,
+    0x76, 0x9E, 0x77, 0xE9, 0x76, 0xF7, 0x69, 0xEA, 0x76, 0xAE, 0xA7, 0x6A, 0xFA, 0x99, 0x99, 0x9A,
+    0xD5, 0xAF, 0xFF, 0x7A, 0xFF, 0xCA, 0x72, 0x99, 0x99, 0x50, 0x2A, 0xA6, 0xAA, 0x3A, 0xD9, 0x29,
+    0xDA, 0x4A, 0xD9, 0x0A, 0xDA, 0x6E, 0xAD, 0xA7, 0x0F, 0xC7, 0x19, 0xE7, 0x77, 0x77, 0x9F, 0xDA,
+    0x93, 0x9F, 0xFC, 0xA3, 0xFA, 0x99, 0xAA, 0xC9, 0x2E, 0xA7, 0x19, 0xE7, 0x2A, 0xD9, 0x72, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xEA, 0x72, 0x9F, 0x91,
+    0x99, 0xCA, 0x39, 0xFF, 0xCA, 0x5A, 0xFE, 0x97, 0x09, 0x94, 0x29, 0xA9, 0x59, 0xA9, 0x70, 0xDA,
+    0x3A, 0xD7, 0x2E, 0x1E, 0x73, 0x9F, 0xD7, 0x59, 0xF9, 0x76, 0xAD, 0xA7, 0x77, 0x77, 0x70, 0xAF,
+    0xFA, 0xA9, 0x7F, 0xFF, 0xCA, 0x5F, 0xFF, 0xE9, 0x3E, 0x7A, 0xF9, 0x2E, 0x71, 0xAE, 0x91, 0xE7,
+    0x2A, 0xE1, 0xE7, 0x3E, 0x90, 0xE7, 0x3A, 0xDA, 0x0E, 0x73, 0x9E, 0x0E, 0x74, 0xE0, 0xE7, 0x4E,
+    0x0E, 0x74, 0xE9, 0xE7, 0x4E, 0x9E, 0x74, 0xE0, 0xE7, 0x4E, 0x0E, 0x73, 0x9E, 0x0E, 0x73, 0xAD,
+    0xA0, 0xE7, 0x3E, 0x90, 0xE7, 0x2F, 0x1E, 0x71, 0xAE, 0x2E, 0x79, 0xF9, 0x2E, 0xAA, 0xAA, 0xAA,
+    0xFD, 0x93, 0xFF, 0xFC, 0xA5, 0xFF, 0xDA, 0x97, 0x75, 0x99, 0x29, 0x99, 0x74, 0x9D, 0xA1, 0xE7,
+    0x49, 0xDA, 0x09, 0xD9, 0x74, 0x9D, 0xA0, 0x9D, 0x75, 0x9D, 0xA0, 0xAC, 0x97, 0x59, 0xDA, 0x0D,
+    0x76, 0x9D, 0xA7, 0x71, 0x9D, 0xA7, 0x1A, 0xFC, 0x91, 0xDA, 0x7A, 0xFF, 0xC0, 0xDA, 0x69, 0xEA,
+    0x99, 0x99, 0xFC, 0xA6, 0xEA, 0x5A, 0xEA, 0x59, 0xE7, 0xEA, 0x5E, 0x97, 0xAD, 0xA5, 0xE7, 0x09,
+    0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7, 0x09, 0xDA, 0x5E, 0x71, 0xDA, 0x5E, 0x70, 0x9D, 0xA5, 0xE7,
+    0x09, 0xDA, 0x5E, 0x97, 0xAD, 0xA5, 0xAD, 0xA7, 0xEA, 0x6E, 0x95, 0xAE, 0xA6, 0xAE, 0xA2, 0x9A,
+    0xFA, 0x7A, 0xFF, 0xC0, 0xDA, 0x70, 0x9F, 0xDA, 0x1D, 0xA7, 0x39, 0x97, 0x40, 0x19, 0xFF, 0xAA,
+    0x97, 0x1A, 0xFF, 0xFA, 0x7A, 0xFF, 0xFD, 0x95, 0xAD, 0x96, 0xAF, 0x94, 0xAD, 0x97, 0x0A, 0xE4,
+    0xAD, 0x97, 0x1F, 0x3A, 0xD9, 0x72, 0xE9, 0x2A, 0xD9, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x29, 0xE2,
+    0xAD, 0x97, 0x3E, 0x2A, 0xDA, 0x73, 0xE0, 0xFF, 0xE9, 0x5E, 0x9F, 0xFE, 0x95, 0xE9, 0xAA, 0xFA,
+    0xAA, 0xAA, 0x6E, 0x2A, 0xD9, 0x73, 0xE2, 0xAD, 0x97, 0x29, 0xE2, 0xAD, 0x97, 0x2A, 0xDA, 0x2A,
+    0xD9, 0x72, 0xE9, 0x2A, 0xD9, 0x71, 0xF3, 0xAD, 0x97, 0x0A, 0xE4, 0xAD, 0x96, 0x9F, 0x94, 0xAE,
+    0xAA, 0xAA, 0xAF, 0xD9, 0x5A, 0xFF, 0xFA, 0x7A, 0xFF, 0xCA, 0x97, 0x75, 0x99, 0x77, 0x09, 0xDA,
+    0x77, 0x9D, 0xA7, 0x19, 0x99, 0x99, 0x9A, 0xE9, 0x96, 0x9F, 0xFF, 0x69, 0xFF, 0xF7, 0x59, 0xDA,
+    0x77, 0x9D, 0xA7, 0xAF, 0xC9, 0x09, 0xDA, 0x59, 0xFF, 0xA0, 0xDA, 0x49, 0xF9, 0x99, 0xAF, 0xCA,
+    0x4E, 0xA5, 0xFA, 0x39, 0xE7, 0xEA, 0x3E, 0x97, 0xAD, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x70, 0x9D,
+    0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x71, 0xDA, 0x3E, 0x70, 0x9D, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x97,
+    0xAD, 0xA3, 0xAD, 0xA7, 0xEA, 0x4E, 0x95, 0xAE, 0xA4, 0xAE, 0xA2, 0x9A, 0xFA, 0x5A, 0xFF, 0xC0,
+    0xDA, 0x69, 0xFD, 0xA1, 0xDA, 0x71, 0x99, 0x72, 0x19, 0xAA, 0xAA, 0xAA, 0xAA, 0xA3, 0xFF, 0xD3,
+    0xAF, 0xFC, 0x77, 0x75, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC,
+    0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x29, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0x9F, 0xFC,
+    0x95, 0x9F, 0xFC, 0x97, 0x77, 0x77, 0x1A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA,
+    0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9,
+    0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97,
+    0x19, 0x99, 0x50, 0x1A, 0xA5, 0x9A, 0x3D, 0x5D, 0x39, 0xDA, 0xAA, 0xAD, 0xA4, 0xAF, 0xE6, 0x9A,
+    0xDA, 0x97, 0x77, 0x7A, 0xFF, 0xF9, 0xFF, 0xFC, 0xAF, 0xFF, 0xC9, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0xFF, 0xFC, 0xAF, 0xFF, 0xCA, 0x29, 0xA6, 0xA9, 0x5A, 0xCA, 0x4A, 0xC9, 0x6E, 0xAA,
+    0xAE, 0x79, 0xFE, 0x72, 0xAA, 0xCA, 0x97, 0x77, 0x77, 0x4A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA,
+    0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7,
+    0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9,
+    0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x59, 0xA7, 0x29, 0xDA, 0x71, 0xAE, 0x72, 0xD9, 0x77, 0x77,
+    0x76, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F,
+    0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x7A, 0x76, 0xE7, 0x5E, 0x75, 0xE7, 0x77, 0x77, 0x77, 0x6A, 0xFC,
+    0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD,
+    0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19,
+    0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA,
+    0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA7, 0x09,
+    0xD7, 0x2D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x2D, 0x97, 0x2E, 0xAA, 0x97, 0x9F, 0x97, 0x19, 0x91,
+    0x77, 0x5A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6,
+    0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74,
+    0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0xC7, 0x19, 0x99, 0xAC, 0xA7, 0x49,
+    0xD7, 0x5D, 0x97, 0x49, 0xD7, 0x59, 0xD7, 0x6E, 0xAA, 0x73, 0xAF, 0x75, 0x99, 0x20, 0x1A, 0x95,
+    0x9A, 0x92, 0xE3, 0xAD, 0x93, 0xE1, 0xAD, 0x95, 0xFD, 0x96, 0x9F, 0xA7, 0x09, 0xDA, 0x77, 0x77,
+    0x0A, 0xFF, 0xF9, 0xFF, 0xFC, 0xAF, 0xFF, 0xC9, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF,
+    0xFC, 0xAF, 0xFF, 0xCA, 0x2A, 0xA6, 0xAA, 0x5A, 0xD9, 0x29, 0xDA, 0x6A, 0xD9, 0x09, 0xDA, 0x70,
+    0xAD, 0xAD, 0xA7, 0x2F, 0xC7, 0x4E, 0x77, 0x77, 0x75, 0xAF, 0xCA, 0x97, 0xFF, 0xCA, 0x5E, 0xA9,
+    0x09, 0xAE, 0xA3, 0xE9, 0x5E, 0x29, 0xDA, 0x6A, 0xDA, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xE1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0x75,
+    0xE7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xF9, 0x91, 0x99, 0xAC, 0x93, 0x9F, 0xFE, 0x95,
+    0xAF, 0xF9, 0x71, 0x99, 0x95, 0x71, 0xAA, 0xA7, 0x7A, 0xEA, 0x75, 0xAF, 0xC9, 0x73, 0x9D, 0xA0,
+    0xE9, 0x71, 0x9D, 0xA2, 0xAD, 0x97, 0x0D, 0x94, 0x9D, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xEA, 0x96,
+    0x9F, 0xFF, 0xC9, 0x3F, 0xDA, 0xAA, 0xAA, 0xF3, 0xFA, 0x70, 0xA9, 0x2F, 0x97, 0x59, 0xE7, 0x7E,
+    0xA7, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE7, 0x0A, 0xAA, 0xAA, 0xAA, 0x9E,
+    0x79, 0xFF, 0xE7, 0x9F, 0xFE, 0x97, 0x39, 0xEA, 0xDA, 0x74, 0xE9, 0xE7, 0x4E, 0x0E, 0x97, 0x3E,
+    0x0A, 0xE7, 0x3E, 0x1E, 0xA7, 0x2E, 0x19, 0xF7, 0x1E, 0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x39,
+    0xFF, 0xFE, 0x59, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x95, 0x69, 0xAA, 0x97, 0x39, 0xF7, 0x3F, 0xD7,
+    0x1E, 0x09, 0xDA, 0x7E, 0x29, 0xDA, 0x59, 0xCA, 0x5A, 0xC9, 0x77, 0x77, 0x70, 0xAF, 0xC9, 0x1A,
+    0xCA, 0x29, 0xFF, 0xC0, 0xDA, 0x19, 0xF9, 0x99, 0xAF, 0xCA, 0x1E, 0xA5, 0xFA, 0x09, 0xE7, 0xEA,
+    0x0A, 0xD9, 0x7A, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x71, 0xDA, 0x0E, 0x71,
+    0xDA, 0x0E, 0x71, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE9, 0x79, 0xDA, 0x0A, 0xDA, 0x7E, 0xA1, 0xE9,
+    0x59, 0xEA, 0x1A, 0xEA, 0x29, 0xAF, 0xA2, 0xAF, 0xFC, 0x9D, 0xA3, 0x9F, 0xDA, 0x1D, 0xA6, 0x99,
+    0x4D, 0xA7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x29, 0x97, 0xF2, 0xEA, 0xA9, 0x99, 0xAF, 0x3A,
+    0xFF, 0xE5, 0x9A, 0xFD, 0xA9, 0x30, 0x59, 0xA6, 0xA9, 0x70, 0xAC, 0xA4, 0xAC, 0x97, 0x1E, 0xAA,
+    0xAE, 0x72, 0x9F, 0xE7, 0x5A, 0xAC, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xEA, 0x96, 0x9F, 0xFF,
+    0xC9, 0x3F, 0xDA, 0xAA, 0xAA, 0xF3, 0xFA, 0x70, 0xA9, 0x2F, 0x97, 0x59, 0xE7, 0x7E, 0xA7, 0x69,
+    0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE7, 0x0A, 0xAA, 0xAA, 0xAA, 0x9E, 0x79, 0xFF,
+    0xE7, 0x9F, 0xFE, 0x97, 0x39, 0xEA, 0xDA, 0x74, 0xE9, 0xE7, 0x4E, 0x0E, 0x97, 0x3E, 0x0A, 0xE7,
+    0x3E, 0x1E, 0xA7, 0x2E, 0x19, 0xF7, 0x1E, 0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAF, 0x39, 0xFF, 0xFE,
+    0x59, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x95, 0x3A, 0x95, 0xAA, 0x6D, 0x49, 0xD6, 0xAD, 0xAA, 0xAE,
+    0x97, 0xFE, 0xA7, 0x19, 0xAD, 0xA7, 0x77, 0x77, 0x4A, 0xFC, 0x91, 0xAC, 0xA2, 0x9F, 0xFC, 0x0D,
+    0xA1, 0x9F, 0x99, 0x9A, 0xFC, 0xA1, 0xEA, 0x5F, 0xA0, 0x9E, 0x7E, 0xA0, 0xAD, 0x97, 0xAD, 0xA0,
+    0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0,
+    0xE7, 0x09, 0xDA, 0x0E, 0x97, 0x9D, 0xA0, 0xAD, 0xA7, 0xEA, 0x1E, 0x95, 0x9E, 0xA1, 0xAE, 0xA2,
+    0x9A, 0xFA, 0x2A, 0xFF, 0xC9, 0xDA, 0x39, 0xFD, 0xA1, 0xDA, 0x69, 0x94, 0xDA, 0x74, 0x9D, 0xA7,
+    0x4A, 0xD9, 0x74, 0xE2, 0x99, 0x7F, 0x2E, 0xAA, 0x99, 0x9A, 0xF3, 0xAF, 0xFE, 0x59, 0xAF, 0xDA,
+    0x93, 0x72, 0xA7, 0x71, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xEA,
+    0x96, 0x9F, 0xFF, 0xC9, 0x3F, 0xDA, 0xAA, 0xAA, 0xF3, 0xFA, 0x70, 0xA9, 0x2F, 0x97, 0x59, 0xE7,
+    0x7E, 0xA7, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE7, 0x0A, 0xAA, 0xAA, 0xAA,
+    0x9E, 0x79, 0xFF, 0xE7, 0x9F, 0xFE, 0x97, 0x39, 0xEA, 0xDA, 0x74, 0xE9, 0xE7, 0x4E, 0x0E, 0x97,
+    0x3E, 0x0A, 0xE7, 0x3E, 0x1E, 0xA7, 0x2E, 0x19, 0xF7, 0x1E, 0x2A, 0xFC, 0xA9, 0x99, 0x99, 0xAF,
+    0x39, 0xFF, 0xFE, 0x59, 0xFF, 0xDA, 0x97, 0x29, 0x99, 0x95, 0x79, 0x97, 0x5A, 0xD9, 0x74, 0xEA,
+    0x74, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x5A, 0xFC, 0x91, 0xAC, 0xA2, 0x9F, 0xFC, 0x0D, 0xA1, 0x9F,
+    0x99, 0x9A, 0xFC, 0xA1, 0xEA, 0x5F, 0xA0, 0x9E, 0x7E, 0xA0, 0xAD, 0x97, 0xAD, 0xA0, 0xE7, 0x09,
+    0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x09,
+    0xDA, 0x0E, 0x97, 0x9D, 0xA0, 0xAD, 0xA7, 0xEA, 0x1E, 0x95, 0x9E, 0xA1, 0xAE, 0xA2, 0x9A, 0xFA,
+    0x2A, 0xFF, 0xC9, 0xDA, 0x39, 0xFD, 0xA1, 0xDA, 0x69, 0x94, 0xDA, 0x74, 0x9D, 0xA7, 0x4A, 0xD9,
+    0x74, 0xE2, 0x99, 0x7F, 0x2E, 0xAA, 0x99, 0x9A, 0xF3, 0xAF, 0xFE, 0x59, 0xAF, 0xDA, 0x93, 0x77,
+    0x72, 0x9A, 0xFE, 0xA9, 0x69, 0xFF, 0xFC, 0x93, 0xFD, 0xAA, 0xAA, 0xAF, 0x3F, 0xA7, 0x0A, 0x92,
+    0xF9, 0x75, 0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0xAD, 0xA7, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x70,
+    0xAA, 0xAA, 0xAA, 0xA9, 0xE7, 0x9F, 0xFE, 0x79, 0xFF, 0xE9, 0x73, 0x9E, 0xAD, 0xA7, 0x4E, 0x9E,
+    0x74, 0xE0, 0xE9, 0x73, 0xE0, 0xAE, 0x73, 0xE1, 0xEA, 0x72, 0xE1, 0x9F, 0x71, 0xE2, 0xAF, 0xCA,
+    0x99, 0x99, 0x9A, 0xF3, 0x9F, 0xFF, 0xE5, 0x9F, 0xFD, 0xA9, 0x72, 0x99, 0x99, 0x77, 0x77, 0x39,
+    0xD9, 0x77, 0xAD, 0x77, 0x0D, 0xA7, 0x70, 0xD7, 0x70, 0xAC, 0x97, 0x70, 0x99, 0x70, 0x70, 0x9A,
+    0x75, 0x9D, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xE7, 0x5D, 0xA7, 0x77, 0x77, 0x5A, 0xFC, 0x91, 0xAC,
+    0xA2, 0x9F, 0xFC, 0x0D, 0xA1, 0x9F, 0x99, 0x9A, 0xFC, 0xA1, 0xEA, 0x5F, 0xA0, 0x9E, 0x7E, 0xA0,
+    0xAD, 0x97, 0xAD, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x1D,
+    0xA0, 0xE7, 0x1D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x97, 0x9D, 0xA0, 0xAD, 0xA7, 0xEA, 0x1E, 0x95,
+    0x9E, 0xA1, 0xAE, 0xA2, 0x9A, 0xFA, 0x2A, 0xFF, 0xC9, 0xDA, 0x39, 0xFD, 0xA1, 0xDA, 0x69, 0x94,
+    0xDA, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE2, 0x99, 0x7F, 0x2E, 0xAA, 0x99, 0x9A, 0xF3, 0xAF,
+    0xFE, 0x59, 0xAF, 0xDA, 0x93, 0x7A, 0xAA, 0x76, 0xFA, 0x74, 0xAF, 0xC9, 0x72, 0xAD, 0xA0, 0xE7,
+    0x19, 0xD9, 0x2E, 0x70, 0xD9, 0x4A, 0xCA, 0x77, 0x77, 0x71, 0xAD, 0x73, 0x9D, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x9F,
+    0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x90, 0x4A, 0xA9, 0x77, 0xF9, 0x75, 0xAF, 0xC9, 0x73, 0xAD,
+    0xA0, 0xE7, 0x29, 0xD9, 0x2E, 0x71, 0xD5, 0xAC, 0xA7, 0x77, 0x70, 0x99, 0x97, 0x70, 0xE7, 0x70,
+    0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xE1, 0xAF, 0xCA, 0x7D,
+    0xA9, 0xFF, 0xC9, 0x5F, 0xCA, 0x99, 0x99, 0xF5, 0xF9, 0x5E, 0x94, 0xEA, 0x69, 0xDA, 0x4E, 0x70,
+    0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4,
+    0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE0, 0x2A,
+    0xD7, 0x39, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x92, 0xFF, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xFF, 0xFA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xA9, 0x2E,
+    0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x5F, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E,
+    0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD,
+    0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x92, 0x29,
+    0x99, 0x76, 0xE7, 0x6E, 0x74, 0x99, 0xE9, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xF4, 0xAF, 0xFE, 0xA7,
+    0xE7, 0x6E, 0x76, 0xE2, 0x99, 0xA9, 0x96, 0xDA, 0x09, 0xFE, 0xA4, 0xDA, 0xAF, 0xFC, 0xA3, 0xFC,
+    0x93, 0xAE, 0x3F, 0x6A, 0xDA, 0x2E, 0x97, 0xE2, 0xE7, 0x0E, 0x2E, 0x70, 0xE2, 0xE7, 0x0E, 0x2E,
+    0x70, 0xE2, 0xE7, 0x0E, 0x2E, 0x70, 0xE2, 0xE7, 0x0E, 0x2E, 0x70, 0xE2, 0xE7, 0x0E, 0x2E, 0x70,
+    0xE2, 0xE7, 0x0E, 0x2E, 0x70, 0xE0, 0x29, 0x95, 0x99, 0x1F, 0xC3, 0xCA, 0x0F, 0xEA, 0xAD, 0x90,
+    0xD1, 0x9F, 0xCA, 0x09, 0xC9, 0x39, 0xAA, 0x97, 0x77, 0x5A, 0xFE, 0xA3, 0xAF, 0xF5, 0x9E, 0xA9,
+    0x7E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x95, 0xAF, 0xF3, 0xAF,
+    0xF1, 0x29, 0x95, 0xA1, 0x9F, 0xA2, 0xAC, 0x1F, 0xEA, 0xAD, 0x0A, 0xC9, 0x19, 0xFC, 0x90, 0xAC,
+    0x4A, 0xAA, 0x97, 0x77, 0x70, 0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE4,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xCA, 0x9F, 0xFC, 0x97, 0x76, 0xAF, 0xEA, 0x1A, 0xFF,
+    0x39, 0xEA, 0x95, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0x3A, 0xFF, 0x1A, 0xFF, 0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x0A, 0xFF, 0xC0, 0xAF, 0xFC, 0x77, 0x72, 0xDA, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
+    0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x30, 0x9A, 0x6A, 0xA9, 0xCA, 0x49, 0xCA,
+    0x0E, 0xAA, 0xAE, 0x2F, 0xE9, 0x3A, 0xAC, 0xAA, 0x77, 0x71, 0xAF, 0xEA, 0x1A, 0xFF, 0x39, 0xEA,
+    0x95, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE9, 0x3A, 0xFF, 0x1A, 0xFF, 0x00, 0xAA, 0x59, 0xA9, 0xAC, 0x94, 0xD0, 0x9D,
+    0xAA, 0xAA, 0xE1, 0xAF, 0xE3, 0x9A, 0xDA, 0x97, 0x77, 0x4D, 0xA7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE3, 0xAF, 0xEA, 0xAF, 0xF1,
+    0x9E, 0xA9, 0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x91, 0xAF, 0xFA, 0xFF, 0x4A, 0xCA, 0x4A, 0xCA, 0x5D, 0x5A, 0xD5,
+    0xAD, 0x59, 0xEA, 0xA3, 0xAF, 0x59, 0x90, 0x29, 0xA3, 0x9E, 0x29, 0xE3, 0xDA, 0x77, 0x70, 0xDA,
+    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x29, 0xD3, 0xD3, 0xAC, 0xA3, 0xD9, 0x3D, 0x93, 0xEA, 0xA9, 0x09, 0xF9, 0x29, 0x91, 0x3A,
+    0x95, 0xE9, 0x4E, 0x94, 0xAD, 0x77, 0x75, 0xAF, 0xEA, 0xAF, 0xF1, 0x9E, 0xA9, 0x3E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x91, 0xAF, 0xFA, 0xFF, 0x0D, 0xA0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xAF, 0xEA, 0x3A, 0xD9, 0xAF, 0xF3, 0xAD, 0x91, 0x9E,
+    0xA9, 0x4A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E,
+    0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A,
+    0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9,
+    0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x6A, 0xD9, 0x2E, 0x95, 0xAD, 0x9A, 0xFF, 0x3A, 0xD9,
+    0xAF, 0xF3, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xE7, 0x49, 0xE7, 0x09, 0x99, 0xAE, 0xA7, 0x9F, 0xE7,
+    0x09, 0xFC, 0xA7, 0x39, 0x95, 0x09, 0xA6, 0x99, 0x09, 0xE4, 0xAD, 0x99, 0xE4, 0xEA, 0x0D, 0xA4,
+    0x9D, 0x97, 0x77, 0x77, 0xDA, 0x49, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9,
+    0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E,
+    0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A,
+    0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x0E, 0x4A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70,
+    0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xE5, 0xA9, 0xAF, 0x5F, 0xD6, 0xFA, 0x20, 0x5A, 0xAA, 0x71, 0xAE,
+    0xA7, 0x9F, 0xC9, 0x59, 0xDA, 0x0A, 0xD9, 0x4D, 0xA2, 0xAD, 0x92, 0xAC, 0x94, 0x9D, 0x77, 0x77,
+    0x2A, 0xD7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x71, 0xAD, 0xA4, 0x99, 0x99, 0xAE, 0x5A, 0xFD, 0xA5,
+    0xAF, 0xC9, 0x70, 0x99, 0x71, 0x4A, 0xA9, 0x7F, 0x95, 0xAF, 0xC9, 0x3A, 0xDA, 0x0E, 0x29, 0xD9,
+    0x2E, 0x1D, 0x5A, 0xCA, 0x77, 0x74, 0xDA, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E,
+    0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xDA, 0x7A, 0xDA, 0x3A, 0xA9, 0xAE, 0x4F, 0xDA, 0x4A, 0xF9,
+    0x50, 0xAD, 0x71, 0x9D, 0xA0, 0xE7, 0x09, 0xE1, 0xE7, 0x9E, 0x2E, 0x7E, 0x92, 0xE6, 0xE9, 0x3E,
+    0x5E, 0x94, 0xE4, 0xEA, 0x5E, 0x3A, 0xDA, 0x6E, 0x2A, 0xDA, 0x7E, 0x1A, 0xE7, 0x0E, 0x09, 0xE7,
+    0x1E, 0xAF, 0xA7, 0x0F, 0xFC, 0x97, 0xFA, 0x0A, 0xE7, 0xEA, 0x2E, 0xA6, 0xE4, 0xE9, 0x5E, 0x49,
+    0xE5, 0xE5, 0xAE, 0x4E, 0x6E, 0xA3, 0xE6, 0x9E, 0x92, 0xE7, 0xAE, 0x2E, 0x70, 0xF1, 0xE7, 0x1E,
+    0xA0, 0xE7, 0x19, 0xE9, 0x77, 0x77, 0x72, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xAC, 0xA7, 0x6D,
+    0x77, 0x97, 0x20, 0x09, 0x97, 0x5D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D, 0xA7, 0x4D,
+    0xA7, 0x4D, 0xA7, 0x4D, 0xA6, 0xAD, 0xA1, 0xDA, 0x5A, 0xDA, 0x2D, 0xA4, 0xAD, 0xA3, 0xDA, 0x3A,
+    0xE4, 0xDA, 0x2A, 0xE5, 0xDA, 0x1A, 0xE6, 0xDA, 0x09, 0xE7, 0xDA, 0x9E, 0x70, 0xDA, 0xF9, 0x7F,
+    0xF7, 0xEA, 0x0A, 0xE6, 0xE2, 0xEA, 0x5D, 0xA3, 0xE9, 0x4D, 0xA3, 0x9E, 0x4D, 0xA4, 0xAE, 0x3D,
+    0xA5, 0xEA, 0x2D, 0xA6, 0xE9, 0x1D, 0xA6, 0x9E, 0x77, 0x77, 0x6E, 0x74, 0xDA, 0x73, 0x9D, 0x74,
+    0xAC, 0xA7, 0x4D, 0x75, 0x97, 0x10, 0x0E, 0x6A, 0xDA, 0x1E, 0x5A, 0xE2, 0xE4, 0xAE, 0x3E, 0x39,
+    0xE4, 0xE2, 0x9E, 0x94, 0xE2, 0xE9, 0x5E, 0x1E, 0xA6, 0xE0, 0xEA, 0x7E, 0xAE, 0xA7, 0xFF, 0x96,
+    0xF9, 0x9E, 0x6E, 0x91, 0xAD, 0xA5, 0xE3, 0xE9, 0x4E, 0x39, 0xE4, 0xE4, 0xAE, 0x3E, 0x5E, 0xA2,
+    0xE6, 0xE9, 0x1E, 0x69, 0xE0, 0x3A, 0xAA, 0x97, 0x1A, 0xE7, 0x2E, 0x97, 0x1E, 0x97, 0x19, 0xD9,
+    0x72, 0xD9, 0x77, 0x77, 0x71, 0xAD, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFC, 0xA0, 0xFF, 0xFC,
+    0xA0, 0x3A, 0xAA, 0x3E, 0xA2, 0x9E, 0x3E, 0x3E, 0x39, 0xCA, 0x75, 0x99, 0x94, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xA7, 0x77, 0x71, 0xE7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xAC, 0xA7, 0x2D, 0x73, 0x97, 0x09, 0x99,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+    0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x73, 0xAD, 0x90, 0xAD, 0x1D, 0xA0, 0x9D,
+    0x1A, 0xC9, 0x19, 0x92, 0xAD, 0x69, 0xD9, 0xE6, 0x9D, 0x9E, 0x6A, 0xD0, 0xE6, 0xD9, 0x0E, 0x6D,
+    0x1E, 0x6A, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xCA, 0xFF, 0xFC, 0xA0, 0x09, 0x99, 0x29, 0x91, 0xE1, 0xE1, 0xE1, 0xDA, 0x1E, 0x1D, 0x2E, 0x09,
+    0xCA, 0x2E, 0x0A, 0xC3, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE5, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x5A, 0x92, 0xE4, 0xE9, 0x1E, 0x4E, 0x91, 0xE4,
+    0xAD, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x09, 0x99, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x1A, 0x91, 0xE0, 0xE9, 0x0E, 0x0E, 0x90, 0xE0, 0xAD, 0x1E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x40, 0x2A, 0xD7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x2A, 0xC9, 0x7E, 0x99, 0xF7, 0xFE, 0xA7, 0x0F,
+    0xCA, 0x71, 0xAF, 0x97, 0x1F, 0xC7, 0x3F, 0xC7, 0x39, 0x0E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E,
+    0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x92, 0xFF, 0xFC, 0xA2, 0xFF, 0xFC, 0xA0, 0x39, 0x96, 0x9D,
+    0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D, 0xA5, 0x9D,
+    0xA5, 0x9D, 0xA0, 0x93, 0x9D, 0xAD, 0x92, 0x9F, 0xCA, 0x29, 0xF9, 0x2A, 0xEA, 0x3F, 0xCA, 0x3A,
+    0xFA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59,
+    0xDA, 0x59, 0xDA, 0x20, 0x72, 0xAA, 0xA9, 0x76, 0xAE, 0x77, 0xE9, 0x76, 0xE9, 0x76, 0x9D, 0x97,
+    0x7D, 0x97, 0x77, 0x77, 0x70, 0xAD, 0xA7, 0x3A, 0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7, 0x2A, 0xD0,
+    0xFD, 0x71, 0xAD, 0x0F, 0xD9, 0x70, 0xAD, 0x0E, 0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7, 0xAD, 0x0E,
+    0x1E, 0x96, 0xAD, 0x0E, 0x19, 0xE6, 0xAD, 0x0E, 0x2A, 0xDA, 0x5A, 0xD0, 0xE3, 0xE9, 0x4A, 0xD0,
+    0xE3, 0x9E, 0x4A, 0xD0, 0xE4, 0xEA, 0x3A, 0xD0, 0xE5, 0xE9, 0x2A, 0xD0, 0xE5, 0xAE, 0x2A, 0xD0,
+    0xE6, 0xEA, 0x1A, 0xD0, 0xE7, 0xE1, 0xAD, 0x0E, 0x7A, 0xE0, 0xAD, 0x0E, 0x70, 0xE9, 0xAD, 0x0E,
+    0x70, 0x9E, 0xAD, 0x0E, 0x71, 0xAF, 0xC0, 0xE7, 0x2F, 0xC0, 0xE7, 0x29, 0xF0, 0xE7, 0x3A, 0xE0,
+    0x71, 0xAA, 0xA7, 0x3E, 0xA7, 0x29, 0xE7, 0x3E, 0x73, 0xE7, 0x39, 0xCA, 0x77, 0x77, 0x7D, 0x2A,
+    0xFC, 0xA3, 0xD9, 0x9F, 0xFC, 0x91, 0xFC, 0xA9, 0x99, 0x9F, 0x1F, 0x95, 0xEA, 0x0E, 0xA6, 0x9D,
+    0xA0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0,
+    0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7,
+    0x0E, 0xAD, 0xA7, 0x3A, 0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7, 0x2A, 0xD0, 0xFD, 0x71, 0xAD, 0x0F,
+    0xD9, 0x70, 0xAD, 0x0E, 0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7, 0xAD, 0x0E, 0x1E, 0x96, 0xAD, 0x0E,
+    0x19, 0xE6, 0xAD, 0x0E, 0x2A, 0xDA, 0x5A, 0xD0, 0xE3, 0xE9, 0x4A, 0xD0, 0xE3, 0x9E, 0x4A, 0xD0,
+    0xE4, 0xEA, 0x3A, 0xD0, 0xE5, 0xE9, 0x2A, 0xD0, 0xE5, 0xAE, 0x2A, 0xD0, 0xE6, 0xEA, 0x1A, 0xD0,
+    0xE7, 0xE1, 0xAD, 0x0E, 0x7A, 0xE0, 0xAD, 0x0E, 0x70, 0xE9, 0xAD, 0x0E, 0x70, 0x9E, 0xAD, 0x0E,
+    0x71, 0xAF, 0xC0, 0xE7, 0x2F, 0xC0, 0xE7, 0x29, 0xF0, 0xE7, 0x3A, 0xE7, 0x77, 0x77, 0x71, 0xDA,
+    0x77, 0x9D, 0x97, 0x7A, 0xD7, 0x70, 0xD9, 0x77, 0x9D, 0x77, 0x19, 0x72, 0x77, 0x0D, 0x2A, 0xFC,
+    0xA3, 0xD9, 0x9F, 0xFC, 0x91, 0xFC, 0xA9, 0x99, 0x9F, 0x1F, 0x95, 0xEA, 0x0E, 0xA6, 0x9D, 0xA0,
+    0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7,
+    0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E,
+    0x77, 0x77, 0x6A, 0xD9, 0x73, 0xAD, 0x74, 0xDA, 0x73, 0x9D, 0x74, 0xAC, 0x97, 0x49, 0x97, 0x3A,
+    0xA6, 0xAA, 0x70, 0x9D, 0x93, 0xDA, 0x71, 0x9D, 0xA0, 0x9D, 0xA7, 0x3A, 0xDA, 0xE7, 0x5A, 0xF7,
+    0x7E, 0x97, 0x77, 0x77, 0x7A, 0xDA, 0x73, 0xAD, 0x0F, 0xA7, 0x2A, 0xD0, 0xFC, 0x72, 0xAD, 0x0F,
+    0xD7, 0x1A, 0xD0, 0xFD, 0x97, 0x0A, 0xD0, 0xE9, 0xE7, 0x0A, 0xD0, 0xE0, 0xAE, 0x7A, 0xD0, 0xE1,
+    0xE9, 0x6A, 0xD0, 0xE1, 0x9E, 0x6A, 0xD0, 0xE2, 0xAD, 0xA5, 0xAD, 0x0E, 0x3E, 0x94, 0xAD, 0x0E,
+    0x39, 0xE4, 0xAD, 0x0E, 0x4E, 0xA3, 0xAD, 0x0E, 0x5E, 0x92, 0xAD, 0x0E, 0x5A, 0xE2, 0xAD, 0x0E,
+    0x6E, 0xA1, 0xAD, 0x0E, 0x7E, 0x1A, 0xD0, 0xE7, 0xAE, 0x0A, 0xD0, 0xE7, 0x0E, 0x9A, 0xD0, 0xE7,
+    0x09, 0xEA, 0xD0, 0xE7, 0x1A, 0xFC, 0x0E, 0x72, 0xFC, 0x0E, 0x72, 0x9F, 0x0E, 0x73, 0xAE, 0x00,
+    0x2A, 0x95, 0x9A, 0x94, 0xAD, 0x3A, 0xD9, 0x5E, 0x1A, 0xD9, 0x7F, 0xD9, 0x71, 0xFA, 0x72, 0x9D,
+    0xA7, 0x77, 0x76, 0xD2, 0xAF, 0xCA, 0x3D, 0x99, 0xFF, 0xC9, 0x1F, 0xCA, 0x99, 0x99, 0xF1, 0xF9,
+    0x5E, 0xA0, 0xEA, 0x69, 0xDA, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E,
+    0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70,
+    0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0x09, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77,
+    0x1E, 0x77, 0x09, 0xD9, 0x77, 0x0A, 0xD1, 0xAC, 0xA1, 0x9F, 0xD9, 0x2A, 0xCA, 0x1E, 0x0F, 0xFC,
+    0xA1, 0x99, 0x2F, 0xD9, 0x99, 0x9A, 0xE9, 0x5F, 0xA5, 0xAE, 0x5F, 0x7E, 0x5E, 0xA7, 0xE5, 0xE9,
+    0x7A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A,
+    0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5, 0xE7, 0x0A, 0xD5,
+    0xE7, 0x0A, 0xD0, 0xAD, 0xA7, 0x3A, 0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7, 0x2A, 0xD0, 0xFD, 0x71,
+    0xAD, 0x0F, 0xDA, 0x70, 0xAD, 0x0E, 0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7, 0xAD, 0x0E, 0x1E, 0xA6,
+    0xAD, 0x0E, 0x19, 0xE6, 0xAD, 0x0E, 0x2A, 0xE5, 0xAD, 0x0E, 0x3E, 0xA4, 0xAD, 0x0E, 0x4E, 0x4A,
+    0xD0, 0xE4, 0xAE, 0x3A, 0xD0, 0xE5, 0xEA, 0x2A, 0xD0, 0xE6, 0xE2, 0xAD, 0x0E, 0x69, 0xE1, 0xAD,
+    0x0E, 0x7E, 0xA0, 0xAD, 0x0E, 0x70, 0xE0, 0xAD, 0x0E, 0x70, 0x9E, 0xAD, 0x0E, 0x71, 0xFD, 0x0E,
+    0x72, 0xFC, 0x0E, 0x72, 0x9F, 0x0E, 0x73, 0xAE, 0x0E, 0x74, 0xE7, 0x70, 0xAD, 0x77, 0x0E, 0x77,
+    0x9D, 0xA7, 0x29, 0x99, 0x9A, 0xE9, 0x72, 0xAF, 0xDA, 0x73, 0xAF, 0xC9, 0x76, 0x99, 0x50, 0x77,
+    0x0D, 0x2A, 0xFC, 0xA9, 0x2D, 0x99, 0xFF, 0xC9, 0x1F, 0xCA, 0x99, 0x99, 0xF1, 0xF9, 0x5E, 0xA0,
+    0xEA, 0x69, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E,
+    0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70, 0xE0, 0xE7, 0x0E, 0x0E, 0x70,
+    0xE0, 0xE7, 0x0E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x73, 0x9D, 0xA7, 0x0A, 0x9A, 0xE9, 0x70,
+    0xFD, 0x71, 0xFA, 0x10, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x3F, 0xFD, 0x73, 0xAF, 0xFC, 0x77,
+    0x77, 0x77, 0x79, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA4, 0x9E,
+    0xA7, 0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0, 0x9E, 0x75, 0xE9,
+    0xAD, 0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x97, 0x6F,
+    0xD9, 0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1, 0xEA, 0x73, 0xAD,
+    0xA1, 0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA, 0x6A, 0xFF,
+    0xFA, 0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0xFF, 0xD7, 0xAF,
+    0xFC, 0x77, 0x77, 0x74, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x5F, 0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E,
+    0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71, 0xE1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9,
+    0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E, 0x1A, 0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA,
+    0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70,
+    0x5A, 0x95, 0x9A, 0x73, 0xD5, 0xD7, 0x3A, 0xDA, 0xAA, 0xAD, 0xA7, 0x4F, 0xEA, 0x76, 0x9A, 0xDA,
+    0x97, 0x77, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A, 0xFC,
+    0xA4, 0x9E, 0xA7, 0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0, 0x9E,
+    0x75, 0xE9, 0xAD, 0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD,
+    0x97, 0x6F, 0xD9, 0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1, 0xEA,
+    0x73, 0xAD, 0xA1, 0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA,
+    0x6A, 0xFF, 0xFA, 0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x3A, 0xA5, 0x9A, 0x7D, 0x5D, 0x7A, 0xDA,
+    0xAA, 0xAD, 0xA7, 0x0A, 0xFD, 0xA7, 0x29, 0xAD, 0xA9, 0x77, 0x77, 0x76, 0xAF, 0xDA, 0x79, 0xFF,
+    0xD9, 0x5F, 0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E,
+    0x71, 0xE1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7,
+    0x1E, 0x1A, 0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94,
+    0x9F, 0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x7A, 0xAA, 0x2A, 0xAA, 0x73, 0xAD, 0xA1, 0xAD,
+    0xA7, 0x3E, 0x19, 0xE7, 0x3A, 0xD2, 0xE7, 0x39, 0xD2, 0x9D, 0x74, 0xAC, 0x3C, 0xA7, 0x77, 0x77,
+    0x77, 0x29, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA4, 0x9E, 0xA7,
+    0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0, 0x9E, 0x75, 0xE9, 0xAD,
+    0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x97, 0x6F, 0xD9,
+    0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1, 0xEA, 0x73, 0xAD, 0xA1,
+    0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA, 0x6A, 0xFF, 0xFA,
+    0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x5A, 0xAA, 0x2A, 0xAA, 0x7A, 0xDA, 0x1A, 0xDA, 0x7E, 0x2E,
+    0x7A, 0xD2, 0xE7, 0x9D, 0x29, 0xD7, 0x0A, 0xC3, 0xCA, 0x77, 0x77, 0x77, 0xAF, 0xDA, 0x79, 0xFF,
+    0xD9, 0x5F, 0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E,
+    0x71, 0xE1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7,
+    0x1E, 0x1A, 0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94,
+    0x9F, 0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x77, 0x77, 0x09, 0xFF, 0xFF, 0xEA, 0x39, 0xFF,
+    0xFF, 0xFD, 0x2A, 0xFC, 0xA9, 0x9A, 0xAF, 0xFF, 0xC1, 0xAE, 0xA6, 0xAD, 0x97, 0x2E, 0xA7, 0xAD,
+    0x97, 0x1A, 0xE7, 0x0A, 0xD9, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xAD, 0x97, 0x0A, 0xDA,
+    0x71, 0xAD, 0x97, 0x0E, 0x97, 0x1A, 0xD9, 0x70, 0xE7, 0x2A, 0xEA, 0xAA, 0xAA, 0xAA, 0xA0, 0xE7,
+    0x2A, 0xFF, 0xE9, 0xE7, 0x2A, 0xFF, 0xE9, 0xE7, 0x2A, 0xD9, 0x70, 0xE9, 0x71, 0xAD, 0x97, 0x0A,
+    0xDA, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1A, 0xD9, 0x71, 0xE7, 0x1A, 0xD9, 0x71, 0xEA, 0x70, 0xAD,
+    0x97, 0x19, 0xE9, 0x7A, 0xD9, 0x72, 0xAE, 0xA6, 0xAD, 0x97, 0x3A, 0xFA, 0x99, 0x99, 0xAF, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA3, 0xAF, 0xFF, 0xFF, 0xD5, 0xAF, 0xFF, 0xFF, 0x70, 0x99, 0x99, 0x75, 0x77,
+    0x77, 0x1A, 0xFD, 0x94, 0xAF, 0xCA, 0x69, 0xFF, 0xCA, 0x2F, 0xFC, 0x94, 0xEA, 0x99, 0x9A, 0xEA,
+    0x0E, 0xA9, 0x09, 0xAE, 0x3E, 0x95, 0xAF, 0xC9, 0x49, 0xE1, 0x9D, 0xA7, 0xFA, 0x6E, 0x90, 0xAD,
+    0x97, 0xAE, 0x96, 0x9D, 0xA0, 0xE7, 0x09, 0xE7, 0x9D, 0xA0, 0xE7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xF0, 0xE7, 0x1F, 0xFF, 0xE0, 0xE7, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0E, 0x71, 0xE7,
+    0x4E, 0x70, 0x9E, 0x74, 0xE9, 0x7A, 0xE9, 0x73, 0x9D, 0xA7, 0xFC, 0x74, 0xE9, 0x5A, 0xFC, 0xA7,
+    0x4E, 0xA9, 0x19, 0xAE, 0x0F, 0x92, 0x9A, 0xD3, 0x9F, 0xFD, 0x2F, 0xFE, 0x5A, 0xFD, 0xA4, 0x9F,
+    0xEA, 0x97, 0x09, 0x97, 0x29, 0x99, 0x40, 0x70, 0xAA, 0xA7, 0x5F, 0x74, 0x9E, 0x75, 0xE7, 0x5A,
+    0xD7, 0x59, 0xCA, 0x77, 0x77, 0x75, 0xAF, 0xEA, 0xA9, 0x6F, 0xFF, 0xA4, 0xFF, 0xFD, 0x3E, 0x6A,
+    0xEA, 0x2E, 0x79, 0xE2, 0xE7, 0x0E, 0x91, 0xE7, 0x0A, 0xD9, 0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0E,
+    0x91, 0xE7, 0x0E, 0x2E, 0x7E, 0xA2, 0xEA, 0x99, 0x99, 0x9A, 0xEA, 0x3F, 0xFF, 0x94, 0xFF, 0xE6,
+    0xE9, 0x3E, 0x95, 0xE4, 0x9E, 0x5E, 0x5A, 0xDA, 0x4E, 0x6E, 0x93, 0xE6, 0x9E, 0x3E, 0x7E, 0x92,
+    0xE7, 0x9E, 0x2E, 0x70, 0xAD, 0xA1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xE0, 0x69, 0xAA, 0x97, 0xE9,
+    0x6E, 0xA6, 0x9D, 0xA7, 0xDA, 0x7A, 0xCA, 0x77, 0x75, 0xD2, 0xAF, 0x1D, 0x90, 0xFD, 0x1D, 0x9A,
+    0xDA, 0xA9, 0xA1, 0xFC, 0x6F, 0x7E, 0x97, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xAF, 0xEA, 0xA9, 0x6F, 0xFF, 0xA4, 0xFF,
+    0xFD, 0x3E, 0x6A, 0xEA, 0x2E, 0x79, 0xE2, 0xE7, 0x0E, 0x91, 0xE7, 0x0A, 0xD9, 0x1E, 0x70, 0xAD,
+    0x91, 0xE7, 0x0E, 0x91, 0xE7, 0x0E, 0x2E, 0x7E, 0xA2, 0xEA, 0x99, 0x99, 0x9A, 0xEA, 0x3F, 0xFF,
+    0x94, 0xFF, 0xE6, 0xE9, 0x3E, 0x95, 0xE4, 0x9E, 0x5E, 0x5A, 0xDA, 0x4E, 0x6E, 0x93, 0xE6, 0x9E,
+    0x3E, 0x7E, 0x92, 0xE7, 0x9E, 0x2E, 0x70, 0xAD, 0xA1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xE7, 0x77,
+    0x77, 0x3E, 0x76, 0xDA, 0x75, 0x9D, 0x76, 0xAC, 0xA7, 0x6D, 0x77, 0x97, 0x20, 0x74, 0xD2, 0xAF,
+    0x1D, 0x90, 0xFD, 0x1D, 0x9A, 0xDA, 0xA9, 0xA1, 0xFC, 0x6F, 0x7E, 0x97, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x77, 0x77, 0x0A,
+    0xD9, 0x7E, 0x70, 0xD9, 0x79, 0xD7, 0x0A, 0xC9, 0x70, 0x99, 0x71, 0x1A, 0xA6, 0xAA, 0x6A, 0xD3,
+    0x9D, 0x97, 0xAD, 0x90, 0xAD, 0x97, 0x1E, 0xAD, 0xA7, 0x3F, 0xA7, 0x49, 0xE7, 0x77, 0x77, 0x4A,
+    0xFE, 0xAA, 0x96, 0xFF, 0xFA, 0x4F, 0xFF, 0xD3, 0xE6, 0xAE, 0xA2, 0xE7, 0x9E, 0x2E, 0x70, 0xE9,
+    0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0A, 0xD9, 0x1E, 0x70, 0xE9, 0x1E, 0x70, 0xE2, 0xE7, 0xEA, 0x2E,
+    0xA9, 0x99, 0x99, 0xAE, 0xA3, 0xFF, 0xF9, 0x4F, 0xFE, 0x6E, 0x93, 0xE9, 0x5E, 0x49, 0xE5, 0xE5,
+    0xAD, 0xA4, 0xE6, 0xE9, 0x3E, 0x69, 0xE3, 0xE7, 0xE9, 0x2E, 0x79, 0xE2, 0xE7, 0x0A, 0xDA, 0x1E,
+    0x71, 0xE9, 0x0E, 0x71, 0xAE, 0x00, 0x9A, 0x95, 0x9A, 0x90, 0xDA, 0x3A, 0xD2, 0xE1, 0xE3, 0x9F,
+    0xD5, 0x9F, 0x96, 0xAD, 0xA7, 0x77, 0x4D, 0x2A, 0xF1, 0xD9, 0x0F, 0xD1, 0xD9, 0xAD, 0xAA, 0x9A,
+    0x1F, 0xC6, 0xF7, 0xE9, 0x7E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x71, 0xAA, 0xA7, 0x3A, 0xE7, 0x29, 0xE7, 0x3E, 0x73, 0xAD,
+    0x74, 0xD7, 0x77, 0x77, 0x29, 0xAF, 0xDA, 0x94, 0xFF, 0xF2, 0xFC, 0xAA, 0xAA, 0xEA, 0x19, 0xE7,
+    0x99, 0x1E, 0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x97, 0x29, 0xFC, 0xA7, 0x2F,
+    0xDA, 0x97, 0x09, 0xFD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xDA,
+    0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x09, 0x70, 0x9E, 0x09, 0xEA, 0x99, 0x99, 0x9F, 0x90, 0x9F, 0xFF,
+    0x92, 0xAF, 0xFC, 0xA7, 0x09, 0x99, 0x96, 0x79, 0xAA, 0x97, 0x1E, 0x97, 0x0E, 0xA7, 0x09, 0xDA,
+    0x71, 0xDA, 0x71, 0xAC, 0xA7, 0x77, 0x74, 0x9F, 0xEA, 0x3F, 0xFE, 0x1F, 0x91, 0x99, 0xD9, 0x1E,
+    0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xF9, 0x71, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7, 0x09,
+    0xFA, 0x71, 0x9E, 0x72, 0xAD, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x99, 0xD9, 0x39, 0xAE, 0x09, 0xFF,
+    0xE2, 0xAF, 0xFA, 0x79, 0x99, 0x50, 0x6A, 0xAA, 0x73, 0xAE, 0xA7, 0x1A, 0xFC, 0x97, 0x9D, 0xA0,
+    0xE9, 0x59, 0xDA, 0x2A, 0xD9, 0x4D, 0x94, 0x9D, 0x77, 0x77, 0x59, 0xAF, 0xDA, 0x94, 0xFF, 0xF2,
+    0xFC, 0xAA, 0xAA, 0xEA, 0x19, 0xE7, 0x99, 0x1E, 0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE7,
+    0x4F, 0x97, 0x29, 0xFC, 0xA7, 0x2F, 0xDA, 0x97, 0x09, 0xFD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x74,
+    0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x09, 0x70, 0x9E, 0x09, 0xEA,
+    0x99, 0x99, 0x9F, 0x90, 0x9F, 0xFF, 0x92, 0xAF, 0xFC, 0xA7, 0x09, 0x99, 0x96, 0x49, 0xAA, 0x97,
+    0x1F, 0x70, 0xFD, 0x6E, 0x99, 0xE4, 0xAD, 0x29, 0xDA, 0x29, 0xCA, 0x5A, 0xC9, 0x77, 0x77, 0x9F,
+    0xEA, 0x3F, 0xFE, 0x1F, 0x91, 0x99, 0xD9, 0x1E, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xF9, 0x71, 0xFC,
+    0x97, 0x0A, 0xFC, 0xA7, 0x0A, 0xFC, 0xA7, 0x09, 0xFA, 0x71, 0x9E, 0x72, 0xAD, 0x97, 0x19, 0xD9,
+    0x71, 0xAD, 0x99, 0xD9, 0x39, 0xAE, 0x09, 0xFF, 0xE2, 0xAF, 0xFA, 0x79, 0x99, 0x50, 0x77, 0x39,
+    0xAF, 0xDA, 0x94, 0xFF, 0xF2, 0xFC, 0xAA, 0xAA, 0xEA, 0x19, 0xE7, 0x99, 0x1E, 0x97, 0x3E, 0x74,
+    0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x97, 0x29, 0xFC, 0xA7, 0x2F, 0xDA, 0x97, 0x09, 0xFD, 0xA7,
+    0x2A, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xD9,
+    0x09, 0x70, 0x9E, 0x09, 0xEA, 0x99, 0x99, 0x9F, 0x90, 0x9F, 0xFF, 0x92, 0xAF, 0xFC, 0xA7, 0x09,
+    0xAC, 0xA7, 0x4D, 0x74, 0x9E, 0xA7, 0x49, 0xDA, 0x74, 0xAD, 0x74, 0xDA, 0x70, 0xAF, 0xC9, 0x70,
+    0xAE, 0xA6, 0x77, 0x09, 0xFE, 0xA3, 0xFF, 0xE1, 0xF9, 0x19, 0x9D, 0x91, 0xE7, 0x19, 0xDA, 0x72,
+    0xE7, 0x2F, 0x97, 0x1F, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xA7, 0x19, 0xE7,
+    0x2A, 0xD9, 0x71, 0x9D, 0x97, 0x1A, 0xD9, 0x9D, 0x93, 0x9A, 0xE0, 0x9F, 0xFE, 0x2A, 0xFF, 0xA7,
+    0x9D, 0x72, 0x9C, 0xA7, 0x2F, 0x97, 0x2A, 0xD7, 0x3D, 0x97, 0x19, 0xD6, 0x9F, 0xCA, 0x69, 0xF9,
+    0x40, 0x2A, 0xA6, 0xAA, 0x4A, 0xD9, 0x29, 0xDA, 0x5A, 0xD9, 0x09, 0xDA, 0x7A, 0xDA, 0xDA, 0x71,
+    0xFC, 0x73, 0xE7, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x94, 0xFF, 0xF2, 0xFC, 0xAA, 0xAA, 0xEA, 0x19,
+    0xE7, 0x99, 0x1E, 0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x4F, 0x97, 0x29, 0xFC, 0xA7,
+    0x2F, 0xDA, 0x97, 0x09, 0xFD, 0xA7, 0x2A, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x39,
+    0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x09, 0x70, 0x9E, 0x09, 0xEA, 0x99, 0x99, 0x9F, 0x90, 0x9F,
+    0xFF, 0x92, 0xAF, 0xFC, 0xA7, 0x09, 0x99, 0x96, 0x09, 0xA9, 0x59, 0xA9, 0x2D, 0xA3, 0xAD, 0x4E,
+    0x1E, 0x59, 0xFD, 0x79, 0xF9, 0x70, 0xAD, 0xA7, 0x77, 0x73, 0x9F, 0xEA, 0x3F, 0xFE, 0x1F, 0x91,
+    0x99, 0xD9, 0x1E, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xF9, 0x71, 0xFC, 0x97, 0x0A, 0xFC, 0xA7, 0x0A,
+    0xFC, 0xA7, 0x09, 0xFA, 0x71, 0x9E, 0x72, 0xAD, 0x97, 0x19, 0xD9, 0x71, 0xAD, 0x99, 0xD9, 0x39,
+    0xAE, 0x09, 0xFF, 0xE2, 0xAF, 0xFA, 0x79, 0x99, 0x50, 0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0,
+    0xAF, 0xFF, 0xFC, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x7A, 0xC9, 0x77, 0xD7, 0x7A, 0xEA, 0x77, 0xAD, 0x97, 0x7D, 0xA7, 0x7D, 0xA7,
+    0x3F, 0xD7, 0x4F, 0xA7, 0x3D, 0x71, 0xD7, 0x09, 0xD7, 0x0E, 0x69, 0xFF, 0xC0, 0x9F, 0xFD, 0x19,
+    0x9E, 0x99, 0x99, 0x93, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xAE, 0x97, 0xFE, 0x94, 0xAF, 0xC9, 0x5A, 0xC9, 0x70, 0xD7,
+    0x0A, 0xE9, 0x70, 0xAD, 0x97, 0x0D, 0x97, 0x0D, 0x94, 0xFD, 0x5F, 0xA2, 0x3A, 0x95, 0x9A, 0x97,
+    0xE3, 0xAD, 0x97, 0x0E, 0x1A, 0xD9, 0x72, 0xFD, 0x97, 0x4F, 0xA7, 0x59, 0xDA, 0x77, 0x77, 0x75,
+    0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x74, 0x99, 0x74, 0x9D, 0xA7, 0x3A,
+    0xD7, 0x4D, 0xA4, 0xD5, 0xD5, 0xD4, 0x9C, 0xA4, 0x9D, 0x74, 0xE7, 0x29, 0xFF, 0xC4, 0x9F, 0xFD,
+    0x59, 0x9E, 0x99, 0x99, 0x97, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E,
+    0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xE9, 0x73, 0xFE, 0x97, 0x0A, 0xFC, 0x97, 0x29,
+    0x96, 0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x79, 0xDA, 0x76, 0x9D, 0xA7,
+    0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x72, 0x99, 0x99, 0x9E,
+    0x99, 0x99, 0x6F, 0xFF, 0xA5, 0xFF, 0xFA, 0x71, 0x9E, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0x9D,
+    0xA7, 0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xDA, 0x76, 0x9D, 0xA7,
+    0x69, 0xDA, 0x70, 0x3D, 0x71, 0xD7, 0x09, 0xD7, 0x0E, 0x69, 0xFF, 0xC0, 0x9F, 0xFD, 0x19, 0x9E,
+    0x99, 0x99, 0x93, 0xE7, 0x0E, 0x70, 0xE6, 0xAA, 0xEA, 0xAA, 0xA9, 0x1F, 0xFD, 0x1A, 0xAE, 0xAA,
+    0xAA, 0xA3, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xAE, 0x97, 0xFE, 0x94, 0xAF,
+    0xC9, 0x69, 0x92, 0x59, 0x95, 0xA7, 0xAF, 0xA2, 0xAC, 0x69, 0xFE, 0xAA, 0xD6, 0xAC, 0x91, 0xAF,
+    0xC9, 0x6A, 0xA4, 0xAC, 0xA7, 0x77, 0x77, 0x3E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xE0, 0xAD, 0xA7, 0x2E,
+    0x09, 0xE7, 0x1A, 0xDA, 0x1F, 0x7A, 0xE3, 0xFA, 0x99, 0x99, 0xAF, 0x94, 0xFF, 0xF9, 0x69, 0xFF,
+    0xA7, 0x49, 0x99, 0x70, 0x49, 0x95, 0xA4, 0x9F, 0xA2, 0xAC, 0x4F, 0xEA, 0xAD, 0x3A, 0xC9, 0x19,
+    0xFC, 0x93, 0xAC, 0x4A, 0xAA, 0x97, 0x77, 0x72, 0x9D, 0xA7, 0x0D, 0xA9, 0xDA, 0x70, 0xE9, 0xDA,
+    0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70,
+    0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x79, 0xE9, 0xDA, 0x7A, 0xE0,
+    0xE7, 0xF0, 0xE9, 0x5A, 0xF0, 0xAE, 0xA2, 0x9A, 0xFC, 0x1F, 0xFD, 0x0E, 0x2A, 0xFD, 0xA1, 0xAD,
+    0x59, 0x97, 0x39, 0xAA, 0xAA, 0xAA, 0xAA, 0xA7, 0x0F, 0xFD, 0x70, 0xAF, 0xFC, 0x77, 0x77, 0x72,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E, 0x71, 0xAD, 0xA1, 0xF7, 0xAE, 0x3F,
+    0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74, 0x99, 0x97, 0x29, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA5, 0xAF, 0xFC, 0x5A, 0xFF, 0xC7, 0x77, 0x72, 0x9D, 0xA7, 0x0D, 0xA9, 0xDA, 0x70, 0xE9,
+    0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA,
+    0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x79, 0xE9, 0xDA, 0x7A,
+    0xE0, 0xE7, 0xF0, 0xE9, 0x5A, 0xF0, 0xAE, 0xA2, 0x9A, 0xFC, 0x1F, 0xFD, 0x0E, 0x2A, 0xFD, 0xA1,
+    0xAD, 0x59, 0x97, 0x3A, 0xA5, 0x9A, 0x70, 0xD5, 0xD7, 0x09, 0xDA, 0xAA, 0xAD, 0xA7, 0x1A, 0xFE,
+    0x73, 0x9A, 0xDA, 0x97, 0x77, 0x77, 0x4E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xE0, 0xAD, 0xA7, 0x2E, 0x09,
+    0xE7, 0x1A, 0xDA, 0x1F, 0x7A, 0xE3, 0xFA, 0x99, 0x99, 0xAF, 0x94, 0xFF, 0xF9, 0x69, 0xFF, 0xA7,
+    0x49, 0x99, 0x70, 0x2A, 0xA5, 0x9A, 0x94, 0xAC, 0x94, 0xD5, 0x9D, 0xAA, 0xAA, 0xE6, 0xAF, 0xE7,
+    0x09, 0xAD, 0xA9, 0x77, 0x77, 0x49, 0xDA, 0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D,
+    0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E,
+    0x95, 0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70,
+    0x77, 0x70, 0x9F, 0xA7, 0x4D, 0xA9, 0xD9, 0x72, 0x9C, 0x92, 0xD7, 0x29, 0xC9, 0x2D, 0x72, 0x9C,
+    0xA1, 0x9C, 0xA7, 0x3F, 0xD7, 0x59, 0xAC, 0xA7, 0x77, 0x77, 0x5E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xE0,
+    0xAD, 0xA7, 0x2E, 0x09, 0xE7, 0x1A, 0xDA, 0x1F, 0x7A, 0xE3, 0xFA, 0x99, 0x99, 0xAF, 0x94, 0xFF,
+    0xF9, 0x69, 0xFF, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x5F, 0xA7, 0x1D, 0xA9, 0xDA, 0x79, 0xCA, 0x2D,
+    0x79, 0xC9, 0x2D, 0x70, 0xD1, 0x9D, 0x70, 0xAF, 0xC9, 0x71, 0x9A, 0xCA, 0x77, 0x77, 0x59, 0xDA,
+    0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7,
+    0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E,
+    0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95, 0xAF, 0x0A, 0xEA, 0x29, 0xAF, 0xC1,
+    0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0x5A, 0xAA, 0x2A, 0xAA, 0x70, 0x9E, 0x1A,
+    0xDA, 0x70, 0xE2, 0xE7, 0x0A, 0xD2, 0xAD, 0x71, 0xD9, 0x19, 0xD7, 0x1A, 0xC9, 0x2A, 0xC7, 0x77,
+    0x77, 0x5E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xE0, 0xAD, 0xA7, 0x2E, 0x09, 0xE7, 0x1A, 0xDA, 0x1F, 0x7A,
+    0xE3, 0xFA, 0x99, 0x99, 0xAF, 0x94, 0xFF, 0xF9, 0x69, 0xFF, 0xA7, 0x49, 0x99, 0x70, 0x49, 0xAA,
+    0x2A, 0xAA, 0x59, 0xE1, 0x9E, 0x5E, 0x2E, 0x59, 0xD9, 0x1A, 0xD6, 0xD9, 0x2D, 0x95, 0xAC, 0x92,
+    0xAC, 0x77, 0x77, 0x59, 0xDA, 0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E,
+    0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D,
+    0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95, 0xAF,
+    0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E, 0x71, 0xAD, 0xA1, 0xF7, 0xAE, 0x3F, 0xA9, 0x99,
+    0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFC, 0x97, 0x39, 0x99, 0xAC, 0xA7, 0x7D, 0x77, 0xAC, 0xA7,
+    0x7D, 0xA7, 0x7D, 0xA7, 0x7A, 0xEA, 0x97, 0x5F, 0xA7, 0x79, 0x93, 0x9D, 0xA7, 0x0D, 0xA0, 0x9D,
+    0xA7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x0E,
+    0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x0E, 0x09, 0xDA, 0x70, 0xE0, 0x9D, 0xA7, 0x0E, 0x09, 0xDA,
+    0x70, 0xE0, 0x9D, 0xA7, 0x9E, 0x09, 0xDA, 0x7A, 0xE1, 0xE7, 0xF1, 0xE9, 0x5A, 0xF1, 0xAE, 0xA2,
+    0x9A, 0xFC, 0x2F, 0xFD, 0x0E, 0x3A, 0xFD, 0xA1, 0xE6, 0x99, 0x3A, 0xCA, 0x74, 0x9D, 0x75, 0xD7,
+    0x59, 0xD7, 0x59, 0xD7, 0x6E, 0xAA, 0x73, 0xAF, 0x75, 0x99, 0x10, 0x75, 0xAA, 0xA7, 0x77, 0x2A,
+    0xEA, 0x77, 0x70, 0xAF, 0xC9, 0x77, 0x69, 0xDA, 0x0E, 0x97, 0x74, 0x9D, 0xA2, 0xAD, 0x97, 0x73,
+    0xD9, 0x49, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x9D, 0xA7, 0x1E, 0x71, 0xAD, 0x99, 0xE7, 0x0A, 0xE9,
+    0x70, 0xE1, 0xE7, 0x0F, 0xA7, 0x0E, 0x1A, 0xD9, 0x7F, 0xC7, 0x9D, 0xA1, 0x9D, 0xA6, 0x9D, 0xAD,
+    0x7A, 0xD9, 0x2E, 0x6A, 0xD9, 0xDA, 0x6E, 0x3E, 0x6E, 0x0E, 0x6E, 0x3A, 0xD9, 0x49, 0xDA, 0x0A,
+    0xD5, 0x9D, 0xA3, 0x9D, 0xA4, 0xAD, 0x19, 0xD9, 0x4A, 0xD9, 0x4E, 0x4E, 0x2D, 0xA4, 0xE5, 0xE4,
+    0xDA, 0x2E, 0x4E, 0x5A, 0xD9, 0x29, 0xD9, 0x2A, 0xD9, 0x29, 0xDA, 0x59, 0xDA, 0x2E, 0x4D, 0xA2,
+    0xAD, 0x96, 0xE2, 0xE4, 0xE2, 0xE7, 0xE1, 0x9D, 0x94, 0xAD, 0x2E, 0x7A, 0xD9, 0x0A, 0xD5, 0x9D,
+    0xA0, 0x9D, 0x97, 0x9D, 0xA0, 0xE6, 0xE0, 0xAD, 0x71, 0xE0, 0xDA, 0x6A, 0xD0, 0xE7, 0x1E, 0x9D,
+    0x96, 0x9D, 0x9D, 0xA7, 0x19, 0xDA, 0xD7, 0x0D, 0xAD, 0x97, 0x2F, 0xC7, 0x0F, 0xC7, 0x3F, 0x97,
+    0x0A, 0xF7, 0x3A, 0xE7, 0x2E, 0xA7, 0x39, 0xE7, 0x2E, 0x95, 0x72, 0x9A, 0xA9, 0x77, 0x5F, 0x77,
+    0x4F, 0xD7, 0x72, 0xE9, 0x9E, 0x77, 0x0A, 0xD9, 0x2E, 0x76, 0x9C, 0xA5, 0xAC, 0x97, 0x77, 0x77,
+    0x77, 0x29, 0xD9, 0x6A, 0xE6, 0x9D, 0xA9, 0xE6, 0xF6, 0xAD, 0x90, 0xE6, 0xF9, 0x5E, 0x1A, 0xD9,
+    0x4A, 0xFC, 0x5E, 0x19, 0xDA, 0x4D, 0xAA, 0xD4, 0x9D, 0xA2, 0xE4, 0xD9, 0x9D, 0x93, 0xAD, 0x92,
+    0xE3, 0x9D, 0x1D, 0xA3, 0xE3, 0xAD, 0x92, 0xE1, 0xE3, 0xE3, 0x9D, 0xA2, 0xDA, 0x19, 0xD9, 0x19,
+    0xD9, 0x4E, 0x19, 0xD9, 0x2D, 0xA1, 0xAD, 0x5E, 0x1A, 0xD3, 0xE1, 0xE5, 0xAD, 0x90, 0xDA, 0x3A,
+    0xD1, 0xDA, 0x6D, 0xA9, 0xD9, 0x4D, 0x99, 0xD9, 0x6E, 0xAD, 0x5D, 0xAA, 0xD7, 0xAD, 0xAC, 0xA5,
+    0xAF, 0xC7, 0x9F, 0x95, 0x9F, 0xA7, 0x0F, 0x7F, 0x97, 0x0E, 0xA7, 0xAE, 0x40, 0x7A, 0xAA, 0x76,
+    0xFA, 0x74, 0xAF, 0xC9, 0x72, 0x9D, 0xA0, 0xE9, 0x70, 0x9D, 0xA2, 0xAD, 0x70, 0xD9, 0x49, 0xCA,
+    0x77, 0x77, 0x71, 0xAD, 0x97, 0x29, 0xDA, 0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAD, 0xA2, 0xE7, 0x0E,
+    0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A, 0xDA, 0x4A, 0xD9, 0x6E, 0x4E, 0x7A, 0xDA, 0x2E, 0x97,
+    0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97, 0x2E, 0xAD, 0xA7, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0x9E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x6A, 0xAA,
+    0x74, 0xAE, 0xA7, 0x2A, 0xFC, 0x97, 0x09, 0xDA, 0x0E, 0x96, 0x9D, 0xA2, 0xAD, 0x95, 0xD9, 0x49,
+    0xD7, 0x77, 0x74, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1, 0xAD, 0x96,
+    0x9D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4, 0xE5, 0xAD, 0x93, 0xE6,
+    0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9, 0x70, 0xAD, 0x0E, 0x72,
+    0xDA, 0xDA, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E,
+    0x74, 0xE9, 0x79, 0x99, 0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0x97, 0x20, 0x59, 0x49, 0x72, 0xDA,
+    0x2E, 0x71, 0xE2, 0xE7, 0x1A, 0xC9, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x75, 0xAD, 0x97, 0x29, 0xDA,
+    0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAD, 0xA2, 0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A,
+    0xDA, 0x4A, 0xD9, 0x6E, 0x4E, 0x7A, 0xDA, 0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97,
+    0x2E, 0xAD, 0xA7, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x71, 0xAA, 0xA9, 0x73, 0xAE, 0x74, 0xE9, 0x73, 0xE9,
+    0x73, 0x9D, 0x97, 0x4D, 0x97, 0x77, 0x77, 0x09, 0xFF, 0xFE, 0x99, 0xFF, 0xFE, 0x99, 0xFF, 0xFE,
+    0x97, 0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73,
+    0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0x73, 0x9E, 0x74, 0xE9, 0x73,
+    0xAE, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF,
+    0xAF, 0xFF, 0xF0, 0x79, 0xAA, 0x97, 0x09, 0xE9, 0x70, 0xE9, 0x70, 0xAD, 0x97, 0x09, 0xD9, 0x71,
+    0xAC, 0x97, 0x77, 0x72, 0xFF, 0xF1, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x71, 0xE9, 0x70,
+    0xAD, 0xA7, 0x09, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1E, 0x71, 0xE9, 0x70, 0x9D, 0xA7,
+    0x1E, 0x71, 0xE9, 0x70, 0xAD, 0xA7, 0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xF9, 0xAF,
+    0xFF, 0x90, 0x7A, 0x97, 0x5E, 0x75, 0xE9, 0x74, 0xAD, 0x77, 0x77, 0x77, 0x71, 0x9F, 0xFF, 0xE9,
+    0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39,
+    0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A,
+    0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0x5A, 0x97, 0x2A, 0xD9, 0x71, 0xEA, 0x71, 0x9D,
+    0x77, 0x77, 0x77, 0x0F, 0xFF, 0x1F, 0xFF, 0x19, 0x99, 0x99, 0x99, 0x9A, 0xE7, 0x1E, 0x97, 0x0A,
+    0xDA, 0x70, 0x9E, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0x9E, 0x71, 0xE7, 0x1E, 0x97, 0x09, 0xDA, 0x71,
+    0xE7, 0x1E, 0x97, 0x0A, 0xDA, 0x70, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0x9A, 0xFF,
+    0xF9, 0x2A, 0xA6, 0xAA, 0x59, 0xD9, 0x3D, 0xA6, 0x9D, 0xA0, 0x9D, 0xA7, 0x0A, 0xDA, 0xE7, 0x2A,
+    0xF7, 0x4E, 0x97, 0x77, 0x77, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x73, 0xAD,
+    0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E,
+    0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39,
+    0xE7, 0x4E, 0x97, 0x3A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF,
+    0x09, 0xA9, 0x59, 0xA2, 0x9D, 0xA3, 0xE3, 0x9D, 0xA1, 0xE5, 0x9F, 0xD7, 0xAF, 0x71, 0xAD, 0x97,
+    0x77, 0x71, 0xFF, 0xF1, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x71, 0xE9, 0x70, 0xAD, 0xA7,
+    0x09, 0xE7, 0x1E, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1E, 0x71, 0xE9, 0x70, 0x9D, 0xA7, 0x1E, 0x71,
+    0xE9, 0x70, 0xAD, 0xA7, 0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xF9, 0xAF, 0xFF, 0x90,
+    0x49, 0x99, 0x94, 0xFE, 0x2F, 0xEA, 0x1A, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE6, 0x77, 0x59,
+    0x97, 0x75, 0xAD, 0xA5, 0x9A, 0xFD, 0xA9, 0x4A, 0xD9, 0x39, 0xFF, 0xF9, 0x2E, 0x3A, 0xFC, 0xA9,
+    0x9A, 0xFC, 0xA0, 0x9D, 0xA2, 0x9E, 0xA7, 0xAF, 0xE3, 0xEA, 0x71, 0xAF, 0xA3, 0xAE, 0x73, 0xEA,
+    0x4E, 0x75, 0xE3, 0x9E, 0x75, 0xE9, 0x2A, 0xDA, 0x75, 0xAD, 0xA2, 0xE9, 0x75, 0x9E, 0x2E, 0x97,
+    0x59, 0xE2, 0xE7, 0x7E, 0x2E, 0x77, 0xE2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2, 0xAD, 0xA7,
+    0x5A, 0xDA, 0x29, 0xE7, 0x5E, 0x93, 0xE7, 0x5E, 0x4E, 0xA7, 0x3A, 0xDA, 0x49, 0xE9, 0x71, 0x9E,
+    0x6A, 0xEA, 0x79, 0xEA, 0x7A, 0xFA, 0x99, 0x99, 0xAF, 0xA7, 0x1A, 0xFF, 0xF9, 0x74, 0xAF, 0xFA,
+    0x77, 0x29, 0x97, 0x40, 0x77, 0x0A, 0xAA, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x5A, 0xFD, 0xA2, 0x9D,
+    0xA4, 0xFF, 0xD9, 0x0E, 0x4F, 0x99, 0x99, 0xFE, 0x93, 0xEA, 0x59, 0xF4, 0x9E, 0x7A, 0xDA, 0x4A,
+    0xD9, 0x70, 0xE4, 0xE7, 0x1E, 0x4E, 0x71, 0xE9, 0x3E, 0x71, 0xAD, 0x93, 0xE7, 0x1A, 0xD9, 0x3E,
+    0x71, 0xAD, 0x93, 0xE7, 0x1E, 0x4A, 0xD9, 0x70, 0xE4, 0x9D, 0xA7, 0xAD, 0xA5, 0xE9, 0x59, 0xE7,
+    0xEA, 0x92, 0xAE, 0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x20, 0x77, 0x77, 0x4A,
+    0xFE, 0x94, 0x9A, 0xFC, 0xA6, 0xAF, 0xFE, 0x91, 0xAF, 0xFC, 0x4A, 0xFA, 0xA9, 0xAA, 0xFA, 0xAE,
+    0xA9, 0x9A, 0xF2, 0xAE, 0xA6, 0xAF, 0xC5, 0x9E, 0x90, 0x9E, 0x97, 0x09, 0xE9, 0x6A, 0xDA, 0x0E,
+    0xA7, 0x2A, 0xDA, 0x69, 0xDA, 0x0E, 0x74, 0xE7, 0xE9, 0xE7, 0x4E, 0x96, 0xEA, 0xDA, 0x74, 0xAD,
+    0xA6, 0xFD, 0x97, 0x49, 0xE6, 0xFD, 0x97, 0x49, 0xE6, 0xFD, 0x75, 0x9E, 0x6F, 0xD7, 0x59, 0xE6,
+    0xFD, 0x97, 0x49, 0xE6, 0xFD, 0x97, 0x49, 0xE6, 0xEA, 0xDA, 0x74, 0xAD, 0xA6, 0xE9, 0xE7, 0x4E,
+    0x96, 0xE0, 0xE7, 0x4E, 0x7E, 0x0E, 0xA7, 0x2A, 0xDA, 0x7E, 0x09, 0xE9, 0x70, 0x9E, 0x70, 0xE1,
+    0xAE, 0x96, 0x9E, 0xA7, 0x0E, 0x2F, 0xC9, 0x99, 0x99, 0xFA, 0x71, 0xE3, 0xAF, 0xFE, 0xA7, 0x2E,
+    0x49, 0xAF, 0xEA, 0x74, 0xE7, 0x09, 0x99, 0x77, 0x20, 0x77, 0x75, 0xAF, 0xCA, 0x92, 0xAF, 0xC5,
+    0x9F, 0xFC, 0xA0, 0xFF, 0x39, 0xEA, 0x99, 0x9A, 0xFC, 0xA9, 0x99, 0xF2, 0xE9, 0x5E, 0xA4, 0xE1,
+    0x9E, 0x69, 0xDA, 0x4A, 0xD9, 0x0A, 0xD9, 0x7E, 0x49, 0xD9, 0x0E, 0x70, 0xAD, 0x93, 0x9D, 0x90,
+    0xE7, 0x0A, 0xD9, 0x39, 0xD9, 0x0E, 0x70, 0xAD, 0xA3, 0x9D, 0x90, 0xE7, 0x0A, 0xDA, 0x39, 0xD9,
+    0x0E, 0x70, 0xAD, 0x93, 0x9D, 0x90, 0xE7, 0x0A, 0xD9, 0x39, 0xD9, 0x0A, 0xD9, 0x7E, 0x49, 0xD9,
+    0x09, 0xDA, 0x69, 0xE4, 0x9D, 0x91, 0xE9, 0x5E, 0x94, 0x9D, 0x91, 0x9E, 0xA2, 0x9E, 0xA5, 0x9D,
+    0x92, 0x9F, 0xFC, 0xA6, 0x9D, 0x94, 0xAF, 0xD9, 0x79, 0xD9, 0x79, 0x97, 0x29, 0xD9, 0x77, 0x49,
+    0xD9, 0x77, 0x49, 0xD9, 0x77, 0x49, 0xD9, 0x77, 0x49, 0xD9, 0x77, 0x49, 0xD9, 0x77, 0x49, 0xD9,
+    0x77, 0x49, 0xD9, 0x19, 0xAF, 0xFD, 0xA9, 0x6A, 0xFF, 0xFF, 0x92, 0x9F, 0xFF, 0xFD, 0x91, 0xAD,
+    0x91, 0xE5, 0x9F, 0x1A, 0xD2, 0xE7, 0xEA, 0x0A, 0xD2, 0xE7, 0x9E, 0x6E, 0x70, 0xE6, 0xE7, 0x0E,
+    0x6E, 0x70, 0xE6, 0xE7, 0x9E, 0x6E, 0x7E, 0x96, 0xE5, 0x9F, 0x7F, 0xFF, 0xC7, 0x0F, 0xFE, 0xA7,
+    0x1E, 0xAA, 0xAA, 0xAA, 0x97, 0x3E, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2E,
+    0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2E, 0x74, 0x29, 0x99, 0x97, 0x3F, 0xC7, 0x2A, 0xFC, 0x72, 0xE9,
+    0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xDA, 0x1A, 0xFC, 0xA4, 0xDA, 0x9F, 0xFC, 0x3F, 0xCA,
+    0x99, 0x9A, 0xF2, 0xF9, 0x5E, 0xA1, 0xEA, 0x69, 0xE1, 0xE7, 0x0E, 0x90, 0xE7, 0x0A, 0xD9, 0x0E,
+    0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0xAD,
+    0x90, 0xE7, 0x0E, 0x90, 0xEA, 0x69, 0xE1, 0xF6, 0xEA, 0x1F, 0xCA, 0x29, 0xF2, 0xDA, 0xAF, 0xFC,
+    0x3D, 0xA0, 0x9F, 0xDA, 0x4E, 0x39, 0x97, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x75,
+    0xE7, 0x40, 0xAD, 0x76, 0xE7, 0x6E, 0x76, 0xEA, 0x99, 0x99, 0x99, 0x7F, 0xFF, 0x94, 0xFF, 0xFC,
+    0xA3, 0xE9, 0x39, 0x9F, 0x92, 0xE7, 0xAE, 0x2E, 0x70, 0xE9, 0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0A,
+    0xD9, 0x1E, 0x70, 0xAD, 0x91, 0xE7, 0x0E, 0x2E, 0x7A, 0xDA, 0x2E, 0x94, 0x9F, 0x3F, 0xFF, 0xC4,
+    0xFF, 0xE9, 0x5E, 0xAA, 0xAA, 0xAE, 0x6E, 0x49, 0xE5, 0xE5, 0xE9, 0x4E, 0x59, 0xE4, 0xE6, 0xAD,
+    0xA3, 0xE7, 0xE9, 0x2E, 0x7A, 0xE7, 0x6E, 0xA7, 0x59, 0xE7, 0x6E, 0xA7, 0x69, 0x99, 0x00, 0x77,
+    0x29, 0xAF, 0xDA, 0x5F, 0xFE, 0x93, 0x9E, 0xAA, 0xAA, 0xF9, 0x3A, 0x6A, 0xE7, 0x4A, 0xD9, 0x73,
+    0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x29, 0xE7, 0x2A, 0xEA, 0x79, 0xAF, 0xC6, 0x9F, 0xDA,
+    0x59, 0xFD, 0xA6, 0xAF, 0xC9, 0x7A, 0xF7, 0x2E, 0xA7, 0x29, 0xE7, 0x39, 0xDA, 0x73, 0x9D, 0xA7,
+    0x4E, 0x74, 0xEA, 0x70, 0x99, 0x1F, 0xA9, 0x99, 0x9A, 0xEA, 0x19, 0xFF, 0xFA, 0x39, 0xFF, 0xC9,
+    0x70, 0x99, 0x94, 0x77, 0x9F, 0xEA, 0x39, 0xFF, 0xD3, 0xDA, 0x91, 0x9F, 0x72, 0xE7, 0x2A, 0xD9,
+    0x71, 0xE7, 0x09, 0xF6, 0x9F, 0xC5, 0xAF, 0xCA, 0x4A, 0xFC, 0xA5, 0xAF, 0x97, 0xE9, 0x70, 0x9D,
+    0xA7, 0x19, 0xD9, 0x71, 0x9D, 0xA7, 0x2E, 0xA9, 0x39, 0xD1, 0x9F, 0xFE, 0x3A, 0xFF, 0xA6, 0x99,
+    0x94, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x0A, 0xE7, 0x5F, 0x75, 0xEA, 0x75,
+    0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5A, 0xE7, 0x5F, 0x75, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE7,
+    0x4E, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xE7, 0x4E, 0x97, 0x3A, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0x29, 0x99, 0x97, 0x1F, 0xD7,
+    0xFE, 0xA6, 0xDA, 0x1E, 0x6D, 0x91, 0xAD, 0x6E, 0xA9, 0xE6, 0xAF, 0xE7, 0x9F, 0xD7, 0x3A, 0xD7,
+    0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7,
+    0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7,
+    0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x3A, 0xD9, 0x72, 0x9D, 0xA7, 0x3E, 0xA9, 0x9A,
+    0x96, 0xAF, 0xDA, 0x79, 0xAF, 0x90, 0x3D, 0x71, 0xD7, 0x09, 0xD7, 0x0E, 0x69, 0xFF, 0xC0, 0x9F,
+    0xFD, 0x19, 0x9E, 0x99, 0x99, 0x93, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xAE, 0x97, 0xFE, 0x94, 0xFD, 0x96, 0x9A, 0xD9,
+    0x79, 0xD9, 0x79, 0xD9, 0x79, 0xD9, 0x79, 0xD5, 0x9A, 0xAE, 0x5A, 0xFA, 0x59, 0xEA, 0x10, 0x19,
+    0xAF, 0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xCA, 0xAD, 0x93, 0xAD, 0x96, 0xAD, 0x4A,
+    0xD9, 0x6A, 0xD4, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A,
+    0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9,
+    0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76, 0xAD, 0x97, 0x6A, 0xD9, 0x76,
+    0xAD, 0x96, 0x59, 0x99, 0x95, 0x9F, 0xCA, 0x4F, 0xDA, 0x3A, 0xDA, 0x7E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE6, 0x9F, 0xFC, 0x09, 0xFF, 0xD1, 0x99, 0xE9, 0x99, 0x99, 0x3E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE9, 0x7A, 0xE9, 0x7F, 0xE9,
+    0x4A, 0xFC, 0x96, 0x99, 0x20, 0xAF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x70,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xFA, 0xA9, 0x73, 0x9F, 0xC9, 0x74, 0x9A, 0xE4, 0x77,
+    0x49, 0x99, 0x77, 0x5E, 0x0E, 0x73, 0xAD, 0x91, 0xE0, 0xE7, 0x3A, 0xD9, 0x09, 0xDA, 0x0E, 0x73,
+    0xAD, 0x90, 0xE1, 0xE7, 0x3A, 0xFD, 0x91, 0xE7, 0x3A, 0xFC, 0x3E, 0x73, 0xAD, 0xA5, 0xE7, 0x3A,
+    0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E,
+    0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD,
+    0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xE6, 0xAD, 0xA7, 0x2E, 0x7E, 0x71, 0xAD, 0xA7, 0xAE, 0x7A,
+    0xE7, 0x1F, 0xA9, 0x99, 0x9A, 0xF9, 0x72, 0xFF, 0xF9, 0x74, 0x9F, 0xFA, 0x77, 0x29, 0x99, 0x75,
+    0x77, 0x19, 0xAA, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x09, 0xD9, 0x70, 0xDA, 0x1E, 0x09, 0xDA, 0x70,
+    0xE0, 0xE9, 0x09, 0xDA, 0x70, 0xFD, 0xA1, 0x9D, 0xA7, 0x0F, 0xC9, 0x29, 0xDA, 0x70, 0xE5, 0x9D,
+    0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E,
+    0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x9E, 0x59, 0xDA, 0x7A, 0xE6, 0xE7, 0xF6, 0xE9, 0x5A, 0xF6,
+    0xAE, 0xA2, 0x9A, 0xFC, 0x7F, 0xFD, 0x0E, 0x70, 0xAF, 0xDA, 0x1A, 0xD7, 0x39, 0x97, 0x50, 0x0A,
+    0xAA, 0x4E, 0xA4, 0xE5, 0xE5, 0xDA, 0x5D, 0x00, 0x29, 0xAA, 0x92, 0xE9, 0x1E, 0x91, 0xAD, 0xA2,
+    0xDA, 0x2A, 0xC9, 0x30, 0x39, 0xAA, 0x97, 0xF6, 0xFD, 0x4E, 0x99, 0xE2, 0xAD, 0x3E, 0x09, 0xCA,
+    0x5A, 0xC9, 0x29, 0x95, 0x99, 0x1F, 0xC3, 0xCA, 0x0A, 0xFE, 0xAD, 0x90, 0xD1, 0x9F, 0xD1, 0xC9,
+    0x39, 0xAA, 0xA1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xDA, 0xFF, 0xC0, 0x75, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0A, 0x95, 0x9A, 0x1D, 0x5D, 0x1A, 0xDA, 0xAA,
+    0xAD, 0xA2, 0xFE, 0xA4, 0x9A, 0xDA, 0x92, 0x09, 0x90, 0xAD, 0xAA, 0xDA, 0x9D, 0x93, 0x09, 0x59,
+    0x0A, 0xD2, 0x9D, 0x9A, 0xD9, 0x19, 0xDA, 0x9D, 0x3D, 0x00, 0x09, 0x99, 0x29, 0xFA, 0x19, 0x9A,
+    0xD9, 0x3A, 0xCA, 0x3D, 0x91, 0xAE, 0x2D, 0x93, 0xD4, 0x99, 0x20, 0x70, 0x9F, 0x91, 0xDA, 0x9D,
+    0x9A, 0xC9, 0x19, 0xCA, 0xAC, 0x3C, 0xA9, 0xCA, 0x1A, 0xCA, 0x0F, 0xD2, 0xAD, 0xA1, 0x3A, 0xA9,
+    0x19, 0xAA, 0x92, 0xE9, 0x1E, 0x91, 0x9D, 0xA1, 0xAD, 0xA2, 0xE2, 0xDA, 0x2A, 0xD2, 0xAC, 0xA3,
+    0xCA, 0x3C, 0xA3, 0x9A, 0x95, 0x9A, 0x90, 0xDA, 0x3A, 0xD2, 0xE1, 0xE3, 0x9F, 0xD5, 0x9F, 0x96,
+    0xAD, 0xA3, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x9D, 0x99, 0xD9, 0x9D, 0x93, 0x99, 0x39, 0x9D, 0xA1,
+    0xAF, 0xA1, 0xAF, 0xA1, 0xAF, 0xA1, 0xAF, 0xA1, 0xAD, 0x70, 0x0A, 0xAA, 0x2A, 0xAA, 0x3E, 0x91,
+    0xE9, 0x3E, 0x2E, 0x4D, 0xA1, 0x9D, 0x93, 0x9D, 0x29, 0xD5, 0xCA, 0x29, 0xCA, 0x77, 0x9D, 0x97,
+    0xAD, 0xA7, 0xAD, 0xA4, 0xA9, 0x1A, 0xA1, 0x9A, 0x1D, 0x5D, 0x1A, 0xDA, 0xAA, 0xAD, 0xA2, 0xFE,
+    0xA4, 0x9A, 0xDA, 0x92, 0x39, 0xAA, 0xA5, 0xAF, 0xDA, 0x29, 0xEA, 0xAE, 0xA1, 0xD9, 0x4D, 0x1C,
+    0xA5, 0xAC, 0x00, 0x2A, 0xC2, 0x9D, 0x2A, 0xD2, 0xDA, 0x1A, 0xD9, 0x1E, 0x2E, 0x19, 0xE2, 0x99,
+    0x91, 0x1E, 0x91, 0xE1, 0x9E, 0x19, 0xDA, 0x1A, 0xD2, 0xE2, 0xD9, 0x19, 0xD3, 0x99, 0x20, 0x9D,
+    0xA1, 0x9E, 0x2E, 0x2A, 0xD9, 0x19, 0xDA, 0x2E, 0x2A, 0xD3, 0xD3, 0x99, 0x00, 0x1A, 0xD9, 0x1E,
+    0x91, 0xE1, 0x9D, 0xA1, 0xAD, 0x91, 0xE2, 0xDA, 0x2D, 0x39, 0x92, 0x0A, 0xAA, 0x4E, 0xA4, 0xE9,
+    0x4E, 0x5D, 0xA5, 0xAC, 0x00, 0x3A, 0xAA, 0x3A, 0xE2, 0x9E, 0x3E, 0x3A, 0xD4, 0xCA, 0x40, 0x70,
+    0x9D, 0x29, 0xFF, 0xFD, 0x29, 0xD2, 0x9D, 0x39, 0x90, 0x5D, 0x92, 0xD9, 0x2F, 0xFF, 0xD9, 0x2D,
+    0x92, 0x99, 0x30, 0x09, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xF0, 0x9A, 0xAA, 0xAA, 0xAD, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7A, 0xA0, 0x49, 0x94, 0xE9, 0x3E, 0x39, 0xE2, 0x9E, 0x90, 0x9F, 0x91, 0x9E,
+    0x49, 0x50, 0x19, 0x90, 0xE9, 0xCA, 0x0A, 0xC1, 0xAC, 0x19, 0xCA, 0x1A, 0xD1, 0x99, 0x29, 0x95,
+    0xD5, 0xD5, 0xD2, 0xAF, 0xDA, 0x9F, 0xD9, 0x09, 0x99, 0x99, 0x90, 0xAF, 0xDA, 0x9A, 0xAD, 0xAA,
+    0x92, 0xD5, 0xD5, 0xD2, 0x72, 0xD5, 0xD2, 0x9A, 0xFA, 0x9A, 0xFD, 0xA0, 0x99, 0xD9, 0x93, 0xD5,
+    0xAA, 0x20, 0x7F, 0xFF, 0xF0, 0x29, 0x99, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xEA,
+    0xAE, 0xAF, 0xC0, 0xAD, 0xA9, 0x00, 0x99, 0x92, 0xDA, 0x2D, 0xA2, 0xDA, 0x2D, 0xA2, 0xDA, 0x2E,
+    0x2A, 0xEA, 0xA9, 0xFC, 0x09, 0xAD, 0xA0, 0x0D, 0x0A, 0xDA, 0xAD, 0xA0, 0xD0, 0x09, 0x59, 0x0A,
+    0xD2, 0x9D, 0x9A, 0xD9, 0x19, 0xDA, 0x9D, 0x3D, 0x00, 0x70, 0x9F, 0x91, 0xDA, 0x9D, 0x9A, 0xC9,
+    0x19, 0xCA, 0xAC, 0x3C, 0xA9, 0xCA, 0x1A, 0xCA, 0x0F, 0xD2, 0xAD, 0xA1, 0x1E, 0x2D, 0xA1, 0x9D,
+    0x91, 0xAC, 0xA2, 0xD3, 0x93, 0x2D, 0x49, 0xCA, 0x4F, 0x94, 0xAD, 0x5D, 0x93, 0x9D, 0x09, 0xFC,
+    0xA1, 0xF9, 0x10, 0x29, 0x3D, 0x91, 0xAC, 0xA1, 0x9D, 0x2A, 0xCA, 0x2A, 0xD2, 0xAE, 0xAA, 0x0F,
+    0xC2, 0x99, 0x00, 0x09, 0x90, 0x9D, 0x99, 0xD9, 0x9D, 0x99, 0xD9, 0x9D, 0x93, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xF9, 0x59, 0xF9, 0x59, 0xF9, 0x59, 0xD9,
+    0x97, 0x99, 0x9C, 0xA2, 0xD2, 0x9C, 0x90, 0xD2, 0xD2, 0xD1, 0xAF, 0xFD, 0xA2, 0x9D, 0xA1, 0xAD,
+    0x91, 0x9A, 0x95, 0x9A, 0x90, 0xDA, 0x3A, 0xD2, 0xE1, 0xE3, 0x9F, 0xD5, 0x9F, 0x96, 0xAD, 0xA3,
+    0x39, 0xAA, 0x97, 0xF6, 0xFD, 0x4E, 0x99, 0xE2, 0xAD, 0x29, 0xDA, 0x09, 0xCA, 0x5A, 0xC9, 0x0A,
+    0x95, 0x9A, 0x1D, 0x5D, 0x1A, 0xDA, 0xAA, 0xAD, 0x92, 0xFE, 0xA4, 0x9A, 0xDA, 0x92, 0x39, 0xAA,
+    0xA5, 0xAF, 0xDA, 0x29, 0xEA, 0xAE, 0xA1, 0xD9, 0x4D, 0x1C, 0xA5, 0xAC, 0x00, 0x29, 0x99, 0x49,
+    0xA2, 0xAF, 0x92, 0xD1, 0xAF, 0xEA, 0xDA, 0x1D, 0x2A, 0xFC, 0x2C, 0xA4, 0xAC, 0xA2, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xDA, 0xFF, 0xC0, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x77, 0x75, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xD9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x29, 0x95, 0xA1, 0xAF, 0x92, 0xAC, 0x09, 0xFE, 0xAA, 0xD0, 0xAC,
+    0x91, 0xAF, 0xC1, 0xAA, 0x4A, 0xAA, 0x20, 0x75, 0xFF, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF,
+    0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x0A,
+    0xC5, 0x9E, 0xA3, 0xAE, 0xA2, 0xAF, 0x29, 0xF9, 0x39, 0xDA, 0x6A, 0x70, 0x72, 0x99, 0x73, 0xD9,
+    0x71, 0xAD, 0x72, 0xDA, 0x71, 0x9D, 0x72, 0xDA, 0x72, 0xD9, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0x9D,
+    0x72, 0xE7, 0x2D, 0x97, 0x1A, 0xD7, 0x2D, 0xA7, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0x97, 0x1A, 0xD7,
+    0x2D, 0xA7, 0x19, 0xD7, 0x2A, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2D, 0xA7, 0x2D, 0x97, 0x1A, 0xD7,
+    0x2D, 0xA7, 0x19, 0xD7, 0x20, 0x99, 0x1E, 0x1A, 0xCA, 0x1D, 0x1D, 0x0A, 0xCA, 0xE0, 0x99, 0x10,
+    0x99, 0x79, 0x9D, 0x95, 0x9F, 0x95, 0x9F, 0x95, 0x9F, 0xCA, 0xAA, 0xAA, 0xAF, 0xFF, 0xE9, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x75, 0x9F, 0xFF, 0x99, 0xDA, 0xAA, 0xAA, 0xAA, 0xAD, 0x99, 0xCA,
+    0x7A, 0xC9, 0x9C, 0xA7, 0xAC, 0x99, 0xCA, 0x7A, 0xC9, 0x9F, 0xFF, 0x90, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x00, 0x1A, 0xE9, 0x9E, 0xA2, 0xAD, 0xAF, 0xAD, 0xA1, 0xD2, 0xD2, 0xD0, 0x9C, 0x92,
+    0xAC, 0x29, 0xC9, 0x09, 0x91, 0x99, 0x1D, 0x99, 0xD1, 0xAF, 0x92, 0xAD, 0xA2, 0x9F, 0x91, 0xD9,
+    0xAD, 0x19, 0x91, 0xA9, 0x00, 0x19, 0xAC, 0x1A, 0xE1, 0xD9, 0x2D, 0x92, 0xAD, 0x3D, 0xA2, 0x9D,
+    0x2A, 0xD1, 0xE9, 0x1C, 0xA2, 0x75, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x0A, 0xAA, 0x4E, 0xA4,
+    0xE9, 0x4E, 0x5D, 0xA5, 0xAC, 0x00, 0x3A, 0xAA, 0x3A, 0xE2, 0x9E, 0x3E, 0x3A, 0xD4, 0xCA, 0x40,
+    0x29, 0x99, 0x49, 0xA2, 0xAF, 0x92, 0xD1, 0xAF, 0xEA, 0xDA, 0x1D, 0x2A, 0xFC, 0x2C, 0xA4, 0xAC,
+    0xA2, 0x9E, 0x19, 0xF2, 0x9D, 0x29, 0xD2, 0xD9, 0x2A, 0x91, 0x5E, 0x94, 0x91, 0x9E, 0x4E, 0x0A,
+    0xD9, 0x9D, 0x90, 0xE0, 0xE0, 0x9D, 0xA0, 0xAC, 0xA0, 0xD9, 0x1D, 0x5C, 0xA5, 0x09, 0x93, 0xD9,
+    0x2D, 0x92, 0xDA, 0x2F, 0xA1, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF,
+    0xD9, 0x9D, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xD9, 0x9D, 0x71, 0xD9, 0x9D, 0x71, 0xD9, 0x9D, 0x71,
+    0xD9, 0x09, 0x97, 0x19, 0x90, 0x75, 0xFF, 0xFF, 0xFF, 0xF7, 0x77, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x99, 0x39, 0x9D, 0xA1,
+    0xAF, 0xA1, 0xAF, 0xA1, 0xAF, 0xA1, 0xAF, 0xA1, 0xAD, 0x70, 0x0F, 0xD1, 0xFD, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x00, 0x69, 0x97, 0x99, 0x90, 0xD1, 0x9A, 0x2A, 0xFC, 0xA1, 0xD1, 0xAF, 0xEA, 0xDA, 0x1D,
+    0x1A, 0xFD, 0x2C, 0xA0, 0x9D, 0x0A, 0xAA, 0x7C, 0x77, 0x50, 0x5A, 0xA7, 0x29, 0xDA, 0x71, 0x9D,
+    0x97, 0x29, 0x97, 0x9E, 0xA3, 0xD1, 0x9F, 0xDA, 0x9A, 0xCA, 0x1D, 0x90, 0x9F, 0xD9, 0x1D, 0x3A,
+    0xE9, 0x79, 0x97, 0x29, 0xD9, 0x71, 0xAD, 0xA7, 0x2A, 0xA5, 0x19, 0xAA, 0x4A, 0x90, 0xAF, 0xA1,
+    0xAC, 0x90, 0xDA, 0xAF, 0xD0, 0x9C, 0x92, 0xAE, 0x97, 0x6E, 0xA2, 0x9C, 0xA0, 0xFD, 0xA9, 0xD9,
+    0x9C, 0xA0, 0x9F, 0xD0, 0x9C, 0x39, 0xAC, 0xA1, 0x75, 0x9C, 0x91, 0x9C, 0x92, 0xAF, 0xFA, 0x09,
+    0xFF, 0xD9, 0x1D, 0x91, 0x9D, 0x4A, 0x91, 0x9A, 0x76, 0x72, 0xAA, 0x4A, 0xDA, 0x2A, 0xFA, 0x3D,
+    0x5D, 0x5D, 0x5D, 0x20, 0xAF, 0x3A, 0xFA, 0x3F, 0xAF, 0xC9, 0x2A, 0xFA, 0x29, 0xFE, 0x77, 0x3F,
+    0x77, 0x3F, 0x59, 0x90, 0xD0, 0x99, 0x5D, 0x99, 0x5A, 0xC0, 0xAA, 0x0C, 0xA5, 0x99, 0x5C, 0xA7,
+    0xAC, 0x73, 0xA9, 0x79, 0xA7, 0x2A, 0x73, 0xA9, 0x39, 0x91, 0x9C, 0x73, 0xCA, 0x19, 0x9D, 0x77,
+    0x3F, 0x1A, 0x97, 0x4C, 0x1F, 0x1C, 0x97, 0x39, 0xC1, 0xF7, 0x73, 0xDA, 0xA1, 0x9C, 0x73, 0xCA,
+    0x1A, 0xA3, 0x9C, 0x73, 0xC9, 0x71, 0xA9, 0x79, 0xA7, 0x3C, 0xA7, 0xAC, 0x75, 0xAC, 0x09, 0x90,
+    0xCA, 0x7D, 0x59, 0xA0, 0xD0, 0xA9, 0x5F, 0x77, 0x3F, 0x77, 0x3F, 0xE3, 0xAF, 0xA3, 0xFF, 0xD9,
+    0x2A, 0xFA, 0x29, 0xFC, 0x5D, 0x92, 0x9E, 0xA2, 0xAD, 0xA1, 0xAD, 0xA9, 0xEA, 0x0D, 0x97, 0x00,
+    0x59, 0xD1, 0xDA, 0x09, 0xC9, 0x1A, 0xC9, 0x19, 0xCA, 0x2E, 0x2A, 0xC0, 0x2A, 0xFA, 0x4F, 0xF2,
+    0xAD, 0xA9, 0x9A, 0xDA, 0x1D, 0x5D, 0x19, 0x91, 0xD1, 0x99, 0x4A, 0xDA, 0x7A, 0xDA, 0x70, 0xAA,
+    0x40, 0x1A, 0x1A, 0x2D, 0xAE, 0x2F, 0x92, 0xF2, 0xFC, 0xA1, 0x9C, 0x90, 0xCA, 0x70, 0x39, 0x91,
+    0x9D, 0xA9, 0xEA, 0x0E, 0x2A, 0xE9, 0x2A, 0xDA, 0x3A, 0xA0, 0x94, 0xDA, 0x92, 0xF9, 0x19, 0xDA,
+    0x09, 0xEA, 0xAD, 0xA1, 0xAA, 0x30, 0x0A, 0x74, 0xDA, 0x4D, 0xA2, 0x9E, 0xA1, 0xAE, 0x4A, 0xD9,
+    0x0F, 0x3A, 0xE9, 0x9C, 0xA9, 0xCA, 0x1E, 0x91, 0xAC, 0x1D, 0x1C, 0x93, 0xCA, 0x19, 0xC9, 0x4A,
+    0xCA, 0x19, 0xDA, 0x2D, 0x2A, 0xC2, 0xD0, 0x9D, 0x90, 0x9A, 0x91, 0x09, 0x90, 0x9D, 0xAA, 0xE9,
+    0xD9, 0x30, 0x2A, 0xA3, 0x90, 0xD0, 0x91, 0xFD, 0x09, 0xFD, 0x91, 0xAD, 0xA2, 0xAC, 0xAA, 0xCA,
+    0x2A, 0x1A, 0x10, 0x77, 0xAE, 0x99, 0xEA, 0x2E, 0xAF, 0xAE, 0x09, 0xCA, 0x2D, 0x2A, 0xC0, 0x9C,
+    0x92, 0xD2, 0x9C, 0x99, 0xCA, 0x2D, 0x2A, 0xC1, 0xEA, 0xFA, 0xE2, 0xAE, 0x1E, 0xA1, 0x71, 0xCA,
+    0x49, 0xC5, 0xFD, 0x1F, 0xD5, 0xCA, 0x49, 0xC7, 0x10, 0x9A, 0x97, 0x73, 0x9A, 0x90, 0xD9, 0x77,
+    0x19, 0xD1, 0xAD, 0xA7, 0x7A, 0xD9, 0x2A, 0xEA, 0x97, 0x19, 0xAE, 0x94, 0x9F, 0xFA, 0xAF, 0xF9,
+    0x79, 0xAF, 0xFF, 0xA9, 0x75, 0x9A, 0xAA, 0xAA, 0xA9, 0x70, 0x9A, 0x97, 0x73, 0x9A, 0x90, 0xD9,
+    0x77, 0x19, 0xD1, 0xAD, 0xA7, 0x7A, 0xD9, 0x2A, 0xEA, 0x97, 0x19, 0xAE, 0x94, 0x9F, 0xFA, 0xAF,
+    0xF9, 0x79, 0xAF, 0xFF, 0xA9, 0x75, 0x9A, 0xAA, 0xAA, 0xA9, 0x70, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xF7, 0x73, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xF7, 0x73, 0x39, 0x99, 0x99, 0x76, 0x99, 0x1A, 0xFF, 0xCA, 0x97,
+    0x09, 0xCA, 0x0F, 0xCA, 0xFF, 0xDA, 0xAA, 0xAA, 0xE0, 0x9C, 0xA7, 0x9A, 0xFF, 0xE9, 0x0A, 0xA7,
+    0x49, 0x9A, 0xAA, 0xAA, 0x92, 0x77, 0x77, 0x9A, 0xFF, 0xDA, 0x97, 0x19, 0xFF, 0xFF, 0x96, 0xFC,
+    0xA9, 0x93, 0x99, 0xAF, 0xC4, 0xEA, 0x75, 0xAE, 0x2E, 0x77, 0x1E, 0x0A, 0xD7, 0x73, 0xDA, 0x77,
+    0x71, 0x77, 0x59, 0x77, 0x71, 0xAC, 0x92, 0xFF, 0xFF, 0xFF, 0xA1, 0xFF, 0xFF, 0xFF, 0xC7, 0x76,
+    0xAC, 0xA7, 0x77, 0xA9, 0x77, 0x75, 0x1A, 0xE9, 0x29, 0x19, 0xC6, 0xC9, 0x1A, 0xF9, 0x0C, 0xA2,
+    0xC9, 0x0C, 0x3C, 0x90, 0xD9, 0xAD, 0x91, 0x99, 0x92, 0x19, 0xE9, 0x19, 0xC1, 0x9C, 0x90, 0xC9,
+    0x2A, 0xA0, 0xFE, 0x0C, 0x95, 0xAA, 0x6D, 0xAA, 0xA9, 0x29, 0x99, 0x90, 0x09, 0x09, 0xC3, 0x9C,
+    0x09, 0xC0, 0x9C, 0x09, 0xC0, 0x9C, 0x09, 0xC0, 0x9C, 0x19, 0x00, 0x1A, 0xE9, 0x2A, 0xC1, 0x9C,
+    0x91, 0xC3, 0xAC, 0x09, 0xC3, 0x9C, 0x09, 0xC3, 0x9C, 0x1C, 0x92, 0xAA, 0x19, 0xCA, 0xAD, 0x49,
+    0x99, 0x20, 0x0C, 0x3A, 0xA0, 0xC3, 0xAA, 0x0C, 0x3A, 0xA0, 0xC3, 0xAA, 0x0C, 0x3A, 0xA0, 0xC9,
+    0x2C, 0xA0, 0xAC, 0xAA, 0xDA, 0x19, 0x99, 0x20, 0x1A, 0xE1, 0xD1, 0x90, 0x9C, 0x49, 0xC4, 0x9C,
+    0x5C, 0x94, 0x9C, 0xAA, 0xA9, 0x29, 0x99, 0x00, 0x5A, 0xA5, 0xAA, 0x5A, 0xA1, 0xAD, 0xAA, 0xA0,
+    0xCA, 0x19, 0xCA, 0x9C, 0x3C, 0xA9, 0xC3, 0xAA, 0x9C, 0x3A, 0xA0, 0xC9, 0x2C, 0xA0, 0xAC, 0xAA,
+    0xDA, 0x29, 0x92, 0x0C, 0x6C, 0x95, 0xC9, 0x5C, 0x9A, 0xDA, 0x1D, 0x2C, 0xA0, 0xC9, 0x2A, 0xC0,
+    0xC9, 0x2A, 0xC0, 0xC9, 0x2A, 0xC0, 0xC9, 0x2A, 0xC0, 0xC9, 0x2A, 0xC0, 0x94, 0x90, 0x9A, 0x9E,
+    0x09, 0xE9, 0x09, 0xCA, 0x1A, 0xCA, 0x1A, 0xC0, 0x9C, 0x29, 0xC3, 0xC0, 0x9C, 0x29, 0xC3, 0xC0,
+    0x9C, 0x29, 0xC3, 0xC0, 0x9C, 0x29, 0xC3, 0xC0, 0x9C, 0x29, 0xC3, 0xC1, 0x93, 0x93, 0x90, 0x9A,
+    0x9D, 0x0A, 0xD9, 0x1A, 0xC3, 0xAC, 0x3A, 0xC3, 0xAC, 0x3A, 0xC4, 0x93, 0x7C, 0x92, 0xAE, 0xA1,
+    0xC9, 0x3C, 0x93, 0xC9, 0x3C, 0x93, 0xC9, 0x3A, 0xCA, 0x92, 0x99, 0x90, 0x0C, 0x39, 0xC1, 0xC9,
+    0x2C, 0xA1, 0x9C, 0x2C, 0x3C, 0x90, 0xAC, 0x3A, 0xA0, 0xC9, 0x4C, 0x9C, 0x5D, 0x96, 0x93, 0x0A,
+    0x92, 0xA9, 0x2C, 0x90, 0xAC, 0x39, 0xC9, 0xC5, 0xAC, 0x95, 0xDA, 0x4C, 0xA0, 0xCA, 0x2A, 0xC2,
+    0xC9, 0x19, 0x49, 0x00, 0x70, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9,
+    0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72,
+    0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E,
+    0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70,
+    0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D,
+    0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0xAF, 0xFA, 0xA9, 0x4F, 0xFF, 0xCA, 0x2F, 0xFF, 0xE1, 0xE7,
+    0xAE, 0xA0, 0xE7, 0x0A, 0xE0, 0xE7, 0x1E, 0x0E, 0x71, 0xE0, 0xE7, 0x1E, 0x0E, 0x70, 0xAD, 0xA0,
+    0xE7, 0x9E, 0x1F, 0xAA, 0xAA, 0xAF, 0xA2, 0xFF, 0xF9, 0x3F, 0xFF, 0xD9, 0x1E, 0x79, 0xEA, 0x0E,
+    0x71, 0xE9, 0xE7, 0x1A, 0xDA, 0xE7, 0x19, 0xFD, 0x71, 0x9F, 0xD7, 0x1A, 0xFD, 0x71, 0xEA, 0xE7,
+    0x0F, 0x0E, 0xAA, 0xAA, 0xAA, 0xAF, 0xC9, 0x0F, 0xFF, 0xD9, 0x1F, 0xFE, 0xA9, 0x30, 0xAF, 0xFE,
+    0xAF, 0xFF, 0xFF, 0xFC, 0xAE, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0x70, 0xE7, 0x70, 0x9E, 0xA7, 0x7A, 0xF7, 0x7F, 0xC9, 0x75, 0x9D, 0x9E,
+    0x75, 0xE0, 0xAD, 0x74, 0x9D, 0xA1, 0xDA, 0x73, 0xAD, 0x2E, 0x73, 0xE2, 0x9D, 0x97, 0x19, 0xD9,
+    0x3E, 0x71, 0xE4, 0xAD, 0x70, 0x9D, 0xA4, 0x9D, 0xA7, 0xAD, 0x6E, 0x7E, 0x6A, 0xD9, 0x5A, 0xD9,
+    0x7E, 0x5E, 0x70, 0xE4, 0x9D, 0xA7, 0x09, 0xDA, 0x3A, 0xD9, 0x71, 0xE3, 0xE7, 0x2A, 0xD9, 0x1A,
+    0xD9, 0x73, 0xE1, 0xE7, 0x4E, 0x09, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xAF, 0xFF,
+    0xFF, 0xAF, 0xFF, 0xFF, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC,
+    0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF,
+    0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7,
+    0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97,
+    0x3A, 0xE7, 0x39, 0xE7, 0x4E, 0x97, 0x3A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF,
+    0xFA, 0xFF, 0xFF, 0xAD, 0x73, 0x9D, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E,
+    0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73,
+    0xAD, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x9F, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0x9E, 0x73,
+    0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD,
+    0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x9E, 0x73, 0xAD, 0x90,
+    0x77, 0x73, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA,
+    0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A,
+    0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x91, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xD2, 0xFF,
+    0xD2, 0xFD, 0x2F, 0xFD, 0x2F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7,
+    0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA,
+    0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0xAF,
+    0xEA, 0xAF, 0xF1, 0x9E, 0xA9, 0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x91, 0xAF, 0xFA, 0xFF, 0xAD, 0x71, 0x9D, 0xA0,
+    0xE7, 0x09, 0xE1, 0xE7, 0x9E, 0x2E, 0x7E, 0x92, 0xE6, 0xE9, 0x3E, 0x5E, 0x94, 0xE4, 0xEA, 0x5E,
+    0x3A, 0xDA, 0x6E, 0x2A, 0xDA, 0x7E, 0x1A, 0xE7, 0x0E, 0x09, 0xE7, 0x1E, 0xAF, 0xA7, 0x0F, 0xFC,
+    0x97, 0xFA, 0x0A, 0xE7, 0xEA, 0x2E, 0xA6, 0xE4, 0xE9, 0x5E, 0x49, 0xE5, 0xE5, 0xAE, 0x4E, 0x6E,
+    0xA3, 0xE6, 0x9E, 0x92, 0xE7, 0xAE, 0x2E, 0x70, 0xF1, 0xE7, 0x1E, 0xA0, 0xE7, 0x19, 0xE9, 0x79,
+    0xDA, 0x77, 0x0A, 0xE7, 0x70, 0xF9, 0x76, 0x9F, 0xA7, 0x6E, 0xAD, 0x76, 0xD9, 0x0D, 0x97, 0x4A,
+    0xD1, 0xE7, 0x4E, 0x1A, 0xD7, 0x39, 0xD9, 0x2D, 0xA7, 0x2A, 0xD3, 0xE7, 0x2E, 0x39, 0xD9, 0x70,
+    0x9D, 0x94, 0xDA, 0x70, 0xE5, 0xE7, 0x0D, 0xA5, 0x9D, 0x96, 0xAD, 0x96, 0xE6, 0xE7, 0xE6, 0xDA,
+    0x79, 0xDA, 0x4A, 0xD9, 0x70, 0xE4, 0xE7, 0x1A, 0xD9, 0x29, 0xDA, 0x71, 0x9D, 0xA2, 0xAD, 0x97,
+    0x2E, 0x2E, 0x73, 0xAD, 0x90, 0x9D, 0xA7, 0x39, 0xDA, 0x0E, 0x75, 0xE0, 0xAE, 0xA7, 0x59, 0xFF,
+    0xC7, 0x5F, 0xFD, 0xA7, 0x39, 0xFF, 0xE7, 0x3A, 0xFF, 0xAD, 0x97, 0x2D, 0xAF, 0xD0, 0xDA, 0x71,
+    0x9D, 0x0F, 0xD0, 0xE7, 0x1E, 0x0F, 0xD0, 0x9D, 0x97, 0x0D, 0x90, 0xFD, 0x1E, 0x7A, 0xD1, 0xFD,
+    0x1A, 0xD7, 0xDA, 0x1F, 0xD1, 0x9D, 0xA5, 0x9D, 0x91, 0xFD, 0x2E, 0x5A, 0xD2, 0xFD, 0x2A, 0xD9,
+    0x4D, 0xA2, 0xFD, 0x3D, 0xA3, 0xAD, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x39, 0xD9, 0x19, 0xD9, 0x3F,
+    0xD4, 0xE1, 0xAD, 0x4F, 0xD4, 0xAD, 0x1D, 0xA4, 0xFD, 0x49, 0xDA, 0x9D, 0x94, 0xFD, 0x5F, 0xD5,
+    0xFD, 0x5A, 0xFA, 0x5F, 0xD6, 0xF6, 0xFD, 0x6F, 0x6F, 0xD6, 0x9D, 0x96, 0xE0, 0xAD, 0xA7, 0x3A,
+    0xD0, 0xFA, 0x72, 0xAD, 0x0F, 0xC7, 0x2A, 0xD0, 0xFD, 0x71, 0xAD, 0x0F, 0xD9, 0x70, 0xAD, 0x0E,
+    0x9E, 0x70, 0xAD, 0x0E, 0x0A, 0xE7, 0xAD, 0x0E, 0x1E, 0x96, 0xAD, 0x0E, 0x19, 0xE6, 0xAD, 0x0E,
+    0x2A, 0xDA, 0x5A, 0xD0, 0xE3, 0xE9, 0x4A, 0xD0, 0xE3, 0x9E, 0x4A, 0xD0, 0xE4, 0xEA, 0x3A, 0xD0,
+    0xE5, 0xE9, 0x2A, 0xD0, 0xE5, 0xAE, 0x2A, 0xD0, 0xE6, 0xEA, 0x1A, 0xD0, 0xE7, 0xE1, 0xAD, 0x0E,
+    0x7A, 0xE0, 0xAD, 0x0E, 0x70, 0xE9, 0xAD, 0x0E, 0x70, 0x9E, 0xAD, 0x0E, 0x71, 0xAF, 0xC0, 0xE7,
+    0x2F, 0xC0, 0xE7, 0x29, 0xF0, 0xE7, 0x3A, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xE0, 0x9F, 0xFF,
+    0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1F, 0xFF, 0xA3, 0xFF, 0xFC, 0x3F, 0xFF, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x77, 0x73, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF,
+    0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1,
+    0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7,
+    0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90,
+    0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA,
+    0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0xAF, 0xFF, 0xFC,
+    0x0F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E,
+    0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E,
+    0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73,
+    0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xE7, 0x3E, 0x0E, 0x73, 0xE0, 0xAF, 0xEA, 0xA9, 0x4F, 0xFF,
+    0xA2, 0xFF, 0xFD, 0x1E, 0x6A, 0xEA, 0x0E, 0x7A, 0xE0, 0xE7, 0x0E, 0x9E, 0x70, 0xAD, 0x9E, 0x70,
+    0xAD, 0x9E, 0x70, 0xE9, 0xE7, 0x0E, 0x0E, 0x7A, 0xE0, 0xE5, 0x9F, 0x1F, 0xFF, 0xC9, 0x1F, 0xFE,
+    0xA3, 0xFA, 0xAA, 0xAA, 0x95, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E,
+    0x74, 0xE7, 0x40, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9, 0x0A, 0xE7, 0x5F, 0x75,
+    0xEA, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5A, 0xE7, 0x5F, 0x75, 0xE9, 0x73, 0xAD, 0xA7,
+    0x39, 0xE7, 0x4E, 0x74, 0xE9, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xE7, 0x4E, 0x97,
+    0x3A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0xAF, 0xFF, 0xFC,
+    0x0A, 0xFF, 0xFF, 0xC0, 0xAF, 0xFF, 0xFC, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0xAD, 0x97, 0x29, 0xDA, 0x9E, 0x72, 0xE1, 0xE9, 0x70,
+    0xAD, 0xA2, 0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A, 0xDA, 0x4A, 0xD9, 0x6E, 0x4E,
+    0x7A, 0xDA, 0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97, 0x2E, 0xAD, 0xA7, 0x39, 0xFC,
+    0x75, 0xFA, 0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x72, 0x9D, 0x97, 0x75, 0x9D, 0xA7, 0x72, 0x99, 0x9A, 0xEA, 0x99, 0x74, 0x9F, 0xFF,
+    0xD9, 0x70, 0xFF, 0xFF, 0xD9, 0x5F, 0xA9, 0x19, 0xDA, 0x19, 0xAF, 0x93, 0xF4, 0x9D, 0xA4, 0xF2,
+    0x9E, 0x59, 0xDA, 0x5E, 0xA1, 0xE9, 0x59, 0xDA, 0x59, 0xE1, 0xE6, 0x9D, 0xA6, 0xE1, 0xE6, 0x9D,
+    0xA6, 0xAD, 0x99, 0xE6, 0x9D, 0xA6, 0xAD, 0x99, 0xE6, 0x9D, 0xA6, 0xAD, 0x90, 0xE6, 0x9D, 0xA6,
+    0xE1, 0xE9, 0x59, 0xDA, 0x6E, 0x1A, 0xDA, 0x59, 0xDA, 0x5A, 0xDA, 0x2E, 0xA4, 0x9D, 0xA4, 0x9E,
+    0x39, 0xF3, 0x9D, 0xA3, 0xAE, 0x94, 0x9F, 0xCA, 0xAA, 0xEA, 0xAF, 0xCA, 0x7F, 0xFF, 0xF9, 0x72,
+    0xAA, 0xFF, 0xAA, 0x77, 0x19, 0xDA, 0x77, 0x59, 0xDA, 0x77, 0x59, 0xDA, 0x72, 0x0E, 0x72, 0x9D,
+    0x91, 0xAE, 0x71, 0xE3, 0xE9, 0x7E, 0x94, 0xE6, 0x9D, 0xA5, 0xAD, 0xA5, 0xE7, 0xE9, 0x3A, 0xD9,
+    0x79, 0xE2, 0x9D, 0xA7, 0x1A, 0xDA, 0x1E, 0x73, 0xE0, 0xAD, 0x97, 0x39, 0xFD, 0x75, 0xAF, 0x77,
+    0xEA, 0x76, 0xAF, 0x76, 0xFC, 0xA7, 0x4E, 0x0E, 0x97, 0x29, 0xDA, 0x1E, 0x72, 0xE2, 0xAD, 0xA7,
+    0x0A, 0xD9, 0x3E, 0x96, 0x9D, 0xA4, 0x9E, 0x6E, 0x6A, 0xDA, 0x4A, 0xD9, 0x7E, 0x39, 0xE7, 0x0A,
+    0xE2, 0xE7, 0x2E, 0x90, 0xAD, 0xA7, 0x29, 0xE0, 0xE5, 0xAD, 0x5A, 0xD9, 0xE5, 0xE5, 0xAD, 0x9E,
+    0x5E, 0x5A, 0xD9, 0xE5, 0xE5, 0xAD, 0x9E, 0x5E, 0x5A, 0xD9, 0xE5, 0xE5, 0xAD, 0x9E, 0x5E, 0x5A,
+    0xD9, 0xE5, 0xE5, 0xAD, 0x9E, 0x5E, 0x5E, 0x9E, 0x5E, 0x5E, 0x0E, 0x94, 0xE5, 0xE0, 0xAD, 0xA4,
+    0xE5, 0xE1, 0xE4, 0xE4, 0xAD, 0xA1, 0xEA, 0x3E, 0x39, 0xE3, 0xF9, 0x1E, 0x2A, 0xEA, 0x39, 0xFF,
+    0xFE, 0xA6, 0xAF, 0xFF, 0x97, 0x19, 0xAA, 0xFA, 0x97, 0x7E, 0x77, 0x2E, 0x77, 0x2E, 0x77, 0x2E,
+    0x77, 0x2E, 0x77, 0x2E, 0x71, 0x77, 0x76, 0x9A, 0xFD, 0xA9, 0x73, 0x9F, 0xFF, 0x97, 0x0A, 0xFC,
+    0xA9, 0x9A, 0xFC, 0x96, 0xAE, 0xA7, 0xAE, 0x95, 0xEA, 0x71, 0xAE, 0x4E, 0xA7, 0x3E, 0xA3, 0xE7,
+    0x5E, 0x29, 0xE7, 0x5E, 0x91, 0xAD, 0x97, 0x5A, 0xDA, 0x1E, 0x97, 0x59, 0xE1, 0xE7, 0x69, 0xE1,
+    0xE7, 0x69, 0xE1, 0xE9, 0x75, 0x9E, 0x1E, 0x97, 0x59, 0xDA, 0x1A, 0xDA, 0x75, 0xAD, 0x91, 0x9E,
+    0x75, 0xE3, 0xE7, 0x49, 0xE3, 0x9D, 0xA7, 0x3E, 0x94, 0xAD, 0x97, 0x1A, 0xDA, 0x6E, 0x97, 0x9E,
+    0x70, 0xE9, 0x59, 0xE5, 0xAA, 0xAA, 0xAE, 0xA3, 0xAE, 0xAA, 0xAA, 0xA1, 0xFF, 0xC3, 0xFF, 0xC1,
+    0xFF, 0xC3, 0xFF, 0xC0, 0x77, 0x70, 0xAF, 0xC9, 0x1A, 0xCA, 0x59, 0xFF, 0xC0, 0xDA, 0x49, 0xEA,
+    0x99, 0x99, 0xFC, 0xA4, 0xE9, 0x5A, 0xEA, 0x39, 0xE7, 0xEA, 0x3E, 0x97, 0xAD, 0xA3, 0xE7, 0x09,
+    0xDA, 0x3E, 0x70, 0x9D, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x71, 0xDA, 0x3E, 0x70, 0x9D, 0xA3, 0xE7,
+    0x09, 0xDA, 0x3E, 0x97, 0xAD, 0xA3, 0xAD, 0xA7, 0xEA, 0x4E, 0x95, 0xAE, 0xA4, 0xAE, 0xA2, 0x9A,
+    0xFC, 0x5A, 0xFF, 0xC0, 0xFC, 0x49, 0xFD, 0xA2, 0xF7, 0x99, 0x69, 0x91, 0x59, 0x99, 0x99, 0x71,
+    0xAF, 0xEA, 0x6F, 0xFE, 0x4F, 0x92, 0x9F, 0x2A, 0xE6, 0xE2, 0xE7, 0xAD, 0x91, 0xE7, 0x9D, 0xA1,
+    0xE7, 0x9D, 0x91, 0xE7, 0xAD, 0x91, 0xE7, 0xE2, 0xE6, 0xAD, 0x92, 0xE1, 0x99, 0x9A, 0xE4, 0xE1,
+    0xFC, 0xA5, 0xE1, 0xFE, 0xA3, 0xE6, 0xAE, 0x2E, 0x79, 0xDA, 0x1E, 0x70, 0xE1, 0xE7, 0x0A, 0xD9,
+    0x0E, 0x70, 0x9D, 0xA0, 0xE7, 0x09, 0xDA, 0x0E, 0x70, 0xAD, 0x90, 0xE7, 0x0E, 0x90, 0xE7, 0xAE,
+    0x1F, 0xA9, 0x29, 0xF9, 0x1F, 0xFF, 0xC9, 0x2E, 0xAF, 0xEA, 0x4E, 0x29, 0x99, 0x7E, 0x75, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x74, 0xAD, 0x71, 0xAD, 0x0A, 0xD9, 0x70, 0xAD, 0x1E,
+    0x70, 0xE1, 0xE7, 0x0E, 0x19, 0xD9, 0x7E, 0x2E, 0x7E, 0x2A, 0xD7, 0xDA, 0x29, 0xDA, 0x59, 0xD9,
+    0x3E, 0x5A, 0xD4, 0xAD, 0x5E, 0x49, 0xDA, 0x39, 0xD9, 0x5E, 0x3E, 0x6A, 0xD2, 0x9D, 0x97, 0xDA,
+    0x1E, 0x70, 0xE0, 0xE9, 0x70, 0xAF, 0xCA, 0x72, 0xFC, 0x73, 0xF7, 0x4A, 0xD9, 0x74, 0xAD, 0x97,
+    0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x60, 0x79, 0x99, 0x97,
+    0x19, 0xFF, 0x95, 0x9F, 0xFE, 0x4E, 0x93, 0x9D, 0xA3, 0xAD, 0x96, 0xA4, 0xAD, 0x97, 0x4A, 0xDA,
+    0x75, 0xE9, 0x74, 0xAE, 0xA7, 0x49, 0xF9, 0x72, 0x9F, 0xD9, 0x7F, 0xAA, 0xEA, 0x5E, 0xA2, 0x9E,
+    0xA3, 0xE9, 0x5E, 0x91, 0xAD, 0xA7, 0xE1, 0xE7, 0x0A, 0xD9, 0x9D, 0xA7, 0x09, 0xDA, 0x9D, 0xA7,
+    0x1E, 0x9D, 0xA7, 0x1E, 0x9D, 0xA7, 0x1D, 0xA9, 0xE7, 0x09, 0xDA, 0x0E, 0x97, 0xE9, 0x0A, 0xE6,
+    0xAE, 0x2F, 0xA2, 0x9F, 0x4A, 0xFF, 0xD6, 0x9F, 0xEA, 0x73, 0x99, 0x60, 0x77, 0x09, 0xAF, 0xDA,
+    0x92, 0xAF, 0xFD, 0x90, 0x9E, 0xA9, 0x09, 0x9A, 0xD1, 0xE9, 0x69, 0x1E, 0x72, 0xE7, 0x29, 0xDA,
+    0x72, 0xAE, 0xA9, 0x99, 0x69, 0xFD, 0x94, 0x9F, 0xE9, 0x3A, 0xE7, 0x1E, 0x71, 0x9D, 0xA7, 0x19,
+    0xDA, 0x71, 0x9E, 0x72, 0xFA, 0x92, 0x9A, 0xC9, 0x1F, 0xFE, 0x92, 0xAF, 0xFA, 0x69, 0x99, 0x93,
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xF2, 0xFF, 0xF7, 0x2A, 0xD9, 0x71, 0x9D, 0xA7,
+    0x2E, 0x72, 0xE7, 0x2A, 0xD9, 0x71, 0xAD, 0xA7, 0x19, 0xE7, 0x2E, 0x72, 0xAD, 0x97, 0x19, 0xE7,
+    0x2E, 0x72, 0xAD, 0x97, 0x2E, 0x72, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x97,
+    0x2A, 0xEA, 0x72, 0xFC, 0xA9, 0x70, 0xAF, 0xEA, 0x7A, 0xFE, 0x97, 0x09, 0xAF, 0x73, 0xE7, 0x3E,
+    0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xD9, 0x72, 0xAA, 0xA1, 0x77, 0x0D, 0x2A, 0xFC, 0xA3, 0xD9, 0x9F,
+    0xFC, 0x2F, 0xCA, 0x99, 0x9A, 0xF1, 0xF9, 0x5E, 0x1E, 0xA6, 0xAD, 0x90, 0xE7, 0x9D, 0xA0, 0xE7,
+    0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D,
+    0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0, 0xE7, 0x9D, 0xA0,
+    0xE7, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73,
+    0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA0, 0x69, 0x99, 0x97, 0x2F, 0xEA, 0x69, 0xFF, 0xD5, 0xEA,
+    0x29, 0xEA, 0x3A, 0xDA, 0x5E, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0xAD, 0x90, 0xE7,
+    0x09, 0xDA, 0x0E, 0x71, 0xE0, 0xE7, 0x1E, 0x0E, 0x71, 0xE0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xE7,
+    0x1E, 0x0E, 0x71, 0xE0, 0xE7, 0x1E, 0x0E, 0x71, 0xE0, 0xAD, 0x70, 0x9D, 0xA0, 0xAD, 0x97, 0xAD,
+    0x90, 0x9D, 0xA7, 0xE2, 0xE6, 0x9E, 0x29, 0xDA, 0x5E, 0x93, 0xEA, 0x91, 0x9E, 0xA5, 0xFF, 0xD7,
+    0xAF, 0xDA, 0x73, 0x99, 0x60, 0x0D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D,
+    0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA5, 0xDA,
+    0x5E, 0x5E, 0xA4, 0x9F, 0xD9, 0x19, 0xFC, 0x94, 0x99, 0x10, 0x0E, 0x6A, 0xDA, 0x1E, 0x5A, 0xE2,
+    0xE4, 0xAE, 0x3E, 0x39, 0xE4, 0xE2, 0x9E, 0x94, 0xE2, 0xE9, 0x5E, 0x1E, 0xA6, 0xE0, 0xEA, 0x7E,
+    0xAE, 0xA7, 0xFF, 0x96, 0xF9, 0x9E, 0x6E, 0x91, 0xAD, 0xA5, 0xE3, 0xE9, 0x4E, 0x39, 0xE4, 0xE4,
+    0xAE, 0x3E, 0x5E, 0xA2, 0xE6, 0xE9, 0x1E, 0x69, 0xE0, 0x99, 0x99, 0x75, 0xFD, 0x73, 0xFE, 0x76,
+    0xAE, 0x76, 0xAD, 0x97, 0x6E, 0x76, 0xE7, 0x69, 0xDA, 0x75, 0x9E, 0x75, 0xAE, 0x97, 0x4F, 0xA7,
+    0x39, 0xDA, 0xD7, 0x3E, 0x9D, 0x97, 0x2D, 0x90, 0xE7, 0x1A, 0xD1, 0xAD, 0x71, 0xE1, 0x9D, 0xA7,
+    0x0D, 0xA2, 0xE7, 0xAD, 0x3A, 0xD9, 0x6E, 0x39, 0xDA, 0x59, 0xDA, 0x4E, 0x5A, 0xD5, 0xAD, 0x94,
+    0xE6, 0xE3, 0x9D, 0xA6, 0xE3, 0xE9, 0x69, 0xDA, 0x2E, 0x70, 0xF9, 0xAD, 0xA7, 0x0A, 0xE9, 0x76,
+    0x91, 0x0D, 0xA7, 0x0D, 0xA3, 0xE7, 0x0E, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x3E, 0x70, 0xE3, 0xE7,
+    0x0E, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x3E, 0x70, 0xE3, 0xE7, 0x0E, 0x3E, 0x70, 0xE3, 0xE7, 0x9E,
+    0x3E, 0x7A, 0xE3, 0xE7, 0xF3, 0xEA, 0x5A, 0xF3, 0xFA, 0x91, 0x9A, 0xFC, 0x92, 0xFF, 0xE0, 0xAF,
+    0x1D, 0xA9, 0xFC, 0xA2, 0xF1, 0xDA, 0x29, 0x96, 0x92, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x77, 0xE7, 0x60, 0xAD, 0x71, 0xAD, 0x0A, 0xD9, 0x70, 0xAD, 0x1E, 0x70, 0xE1, 0xE7, 0x0E,
+    0x19, 0xD9, 0x7E, 0x2E, 0x7E, 0x2A, 0xD7, 0xDA, 0x29, 0xDA, 0x59, 0xD9, 0x3E, 0x5A, 0xD4, 0xAD,
+    0x5E, 0x49, 0xDA, 0x39, 0xD9, 0x5E, 0x3E, 0x6A, 0xD2, 0x9D, 0xA6, 0x9D, 0xA1, 0xE7, 0x0E, 0x0E,
+    0x97, 0x0A, 0xFC, 0xA7, 0x2F, 0xC7, 0x3F, 0x60, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0xFF,
+    0xF2, 0xFF, 0xEA, 0x49, 0xDA, 0x97, 0x0A, 0xD9, 0x71, 0x9D, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73,
+    0xE7, 0x39, 0xE7, 0x3A, 0xFA, 0x99, 0x99, 0x95, 0xAF, 0xF4, 0xAF, 0xFA, 0x3E, 0x97, 0x1E, 0x72,
+    0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x97, 0x29, 0xEA, 0x72, 0xAF, 0xA9, 0x70,
+    0xAF, 0xEA, 0x7A, 0xFE, 0x97, 0x09, 0xAF, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xD9,
+    0x72, 0xAA, 0xA1, 0x77, 0x6A, 0xFD, 0xA7, 0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59,
+    0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD,
+    0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD,
+    0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97,
+    0x9F, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xF1, 0x99, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x99, 0x94,
+    0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6,
+    0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D, 0xA7, 0xE6, 0x9D,
+    0xA7, 0xE6, 0x9D, 0xA7, 0xE7, 0xE7, 0xE7, 0xFC, 0xA4, 0xE7, 0x0F, 0xA7, 0x71, 0x99, 0x20, 0x77,
+    0x49, 0xFD, 0xA7, 0xFF, 0xD9, 0x4F, 0x99, 0x99, 0xF3, 0xAE, 0x5A, 0xE2, 0xE7, 0xE9, 0x09, 0xDA,
+    0x79, 0xDA, 0x0A, 0xD9, 0x70, 0xE0, 0xAD, 0x97, 0x0E, 0x0A, 0xD9, 0x70, 0xE0, 0xAD, 0x97, 0x0E,
+    0x0A, 0xD9, 0x70, 0xE0, 0xAD, 0x97, 0x0E, 0x0A, 0xD9, 0x79, 0xDA, 0x0A, 0xD9, 0x7E, 0x90, 0xAD,
+    0xA6, 0x9E, 0x1A, 0xFA, 0x91, 0x9A, 0xE2, 0xAF, 0xFF, 0x92, 0xAD, 0x9A, 0xFD, 0xA4, 0xAD, 0x39,
+    0x97, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74,
+    0xAD, 0x97, 0x40, 0x77, 0x3A, 0xFE, 0x93, 0x9F, 0xFC, 0xA3, 0xFA, 0x99, 0x9A, 0xC9, 0x2E, 0xA7,
+    0x19, 0xE7, 0x2A, 0xD9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE9, 0x72,
+    0x9E, 0x73, 0xF7, 0x3F, 0xA9, 0x71, 0xFE, 0xA7, 0x9F, 0xE9, 0x70, 0x9A, 0xF7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xDA, 0x72, 0xAD, 0x97, 0x2A, 0xAA, 0x10, 0x59, 0xAA, 0xFF, 0xC9, 0x3A, 0xFF, 0xFC,
+    0x92, 0xFC, 0xA9, 0x9A, 0xE9, 0x99, 0x2A, 0xE5, 0xAD, 0x94, 0xE7, 0xE3, 0xAD, 0x97, 0xAD, 0x92,
+    0xE7, 0x09, 0xDA, 0x2E, 0x71, 0xE2, 0xE7, 0x1E, 0x2E, 0x71, 0xE2, 0xE7, 0x1E, 0x2E, 0x71, 0xE2,
+    0xE7, 0x09, 0xDA, 0x2A, 0xDA, 0x7E, 0x4E, 0x95, 0xAE, 0x49, 0xEA, 0x91, 0x9A, 0xE6, 0x9F, 0xFD,
+    0x71, 0xAF, 0xDA, 0x75, 0x99, 0x70, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD9, 0x09, 0x99, 0x9E, 0xA9,
+    0x99, 0x99, 0x95, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x3A,
+    0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x3A, 0xDA,
+    0x74, 0xEA, 0x73, 0xAF, 0xE9, 0x7A, 0xFD, 0x97, 0x29, 0x99, 0x20, 0x9D, 0x97, 0xDA, 0x09, 0xDA,
+    0x7E, 0x09, 0xDA, 0x7E, 0x09, 0xDA, 0x7A, 0xD9, 0x9D, 0xA7, 0xAD, 0x99, 0xDA, 0x79, 0xDA, 0x9D,
+    0xA7, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x9D, 0xA7, 0x9D, 0xA9, 0xDA, 0x79, 0xDA, 0x9D, 0xA7, 0x9D,
+    0xA9, 0xDA, 0x7A, 0xD9, 0x9D, 0xA7, 0xE1, 0xE6, 0x9E, 0x1E, 0x95, 0xE9, 0x1A, 0xE9, 0x29, 0xEA,
+    0x3F, 0xFE, 0x5A, 0xFE, 0x97, 0x19, 0x99, 0x60, 0x71, 0x99, 0x77, 0x29, 0xDA, 0x77, 0x19, 0xDA,
+    0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x76,
+    0xAF, 0xF9, 0x71, 0xAF, 0xFF, 0xA6, 0xAE, 0xA9, 0xAD, 0xA9, 0xAE, 0xA4, 0xAE, 0x29, 0xDA, 0x2E,
+    0xA3, 0xE3, 0x9D, 0xA3, 0xE9, 0x1A, 0xDA, 0x39, 0xDA, 0x39, 0xE1, 0xE4, 0x9D, 0xA4, 0xE1, 0xE4,
+    0x9D, 0xA4, 0xE9, 0x0E, 0x49, 0xDA, 0x4A, 0xD9, 0x0E, 0x49, 0xDA, 0x4A, 0xD9, 0x0E, 0x49, 0xDA,
+    0x4E, 0x90, 0xE4, 0x9D, 0xA4, 0xE1, 0xAD, 0x93, 0x9D, 0xA3, 0x9E, 0x2E, 0x39, 0xDA, 0x3E, 0x92,
+    0xAE, 0x29, 0xDA, 0x2A, 0xE4, 0xAE, 0xA9, 0x9D, 0xA0, 0xAF, 0x6A, 0xFF, 0xFA, 0x71, 0xAF, 0xFA,
+    0x97, 0x59, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77,
+    0x19, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x19, 0xDA, 0x70, 0x0E, 0xA7, 0x2A, 0xD1, 0xFA, 0x70, 0x9D,
+    0xA1, 0x9A, 0xE9, 0x7E, 0x49, 0xE6, 0x9D, 0xA5, 0xE6, 0xE6, 0x9D, 0xA4, 0xAD, 0x97, 0xE4, 0xE7,
+    0x09, 0xDA, 0x2A, 0xD7, 0x2E, 0x2D, 0xA7, 0x29, 0xDA, 0x0E, 0x74, 0xE9, 0xD9, 0x74, 0x9F, 0xC7,
+    0x6F, 0x97, 0x6A, 0xE7, 0x7F, 0x76, 0xAF, 0xA7, 0x49, 0xDA, 0xE7, 0x4E, 0x0A, 0xDA, 0x72, 0xAD,
+    0x91, 0xE7, 0x19, 0xDA, 0x2A, 0xD9, 0x70, 0xE4, 0xE7, 0xAD, 0x94, 0xAD, 0x96, 0xE6, 0xE5, 0xE9,
+    0x6A, 0xE9, 0x99, 0x09, 0xDA, 0x70, 0xFC, 0xA0, 0xE7, 0x2A, 0xE9, 0x70, 0x99, 0x97, 0x71, 0xE7,
+    0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x71, 0xE7, 0x09, 0xD9, 0x4E, 0x4D,
+    0xA0, 0x9D, 0xA4, 0xE4, 0xE0, 0x9D, 0xA4, 0xE4, 0xE0, 0x9D, 0xA4, 0xE4, 0xAD, 0x99, 0xDA, 0x4E,
+    0x49, 0xD9, 0x9D, 0xA4, 0xE4, 0x9D, 0xA9, 0xDA, 0x4E, 0x49, 0xDA, 0x9D, 0xA4, 0xE5, 0xDA, 0x9D,
+    0xA4, 0xE5, 0xDA, 0x9D, 0xA4, 0xE5, 0xDA, 0x9D, 0xA4, 0xE4, 0x9D, 0xA0, 0xDA, 0x4E, 0x4A, 0xD9,
+    0x0E, 0x4E, 0x4E, 0x1E, 0x93, 0xE3, 0x9E, 0x19, 0xE3, 0xE2, 0x9E, 0x92, 0xAE, 0xA9, 0x0E, 0x99,
+    0xFA, 0x4A, 0xFF, 0xFC, 0x96, 0x9A, 0xFF, 0xCA, 0x74, 0x9E, 0x77, 0x1E, 0x77, 0x1E, 0x77, 0x1E,
+    0x77, 0x1E, 0x77, 0x1E, 0x77, 0x1E, 0x77, 0x1E, 0x70, 0x2D, 0xA7, 0x2D, 0xA4, 0xE7, 0x39, 0xDA,
+    0x29, 0xDA, 0x74, 0xE2, 0xE7, 0x59, 0xDA, 0x1E, 0x76, 0xE0, 0x9D, 0xA7, 0x6E, 0x0A, 0xD9, 0x5D,
+    0xA5, 0xAD, 0x9A, 0xD6, 0xDA, 0x5A, 0xD9, 0xE6, 0xDA, 0x59, 0xD9, 0xE6, 0xDA, 0x59, 0xD9, 0xE6,
+    0xDA, 0x59, 0xD9, 0xAD, 0x6D, 0xA5, 0xAD, 0x9A, 0xD9, 0x5E, 0x5E, 0x09, 0xDA, 0x49, 0xE5, 0xE1,
+    0xE9, 0x3F, 0x93, 0xAD, 0xA1, 0x9E, 0x91, 0xAD, 0x9D, 0x91, 0xAE, 0x3A, 0xFE, 0x90, 0xFF, 0x94,
+    0xAF, 0xC9, 0x2A, 0xFC, 0x97, 0x09, 0x96, 0x99, 0x50, 0x70, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7,
+    0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91,
+    0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70,
+    0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73,
+    0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE7, 0x77, 0x77, 0x75, 0x9C, 0xA7,
+    0x72, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0x9C, 0xA7, 0x10, 0x77, 0x29, 0xFE, 0x93, 0x9F, 0xFD, 0xA3,
+    0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2,
+    0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69,
+    0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99,
+    0x77, 0x74, 0xAC, 0x97, 0x29, 0xE7, 0x29, 0xE7, 0x3A, 0xC9, 0x40, 0x79, 0x99, 0x77, 0x2F, 0xC7,
+    0x70, 0x99, 0xAD, 0xA7, 0x72, 0x9D, 0x77, 0x2A, 0xD7, 0x70, 0xAE, 0x97, 0x70, 0xDA, 0x77, 0x2D,
+    0x77, 0x49, 0x77, 0x77, 0x71, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9,
+    0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72,
+    0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E,
+    0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70,
+    0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D,
+    0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0x59, 0x99, 0x72, 0x9F, 0xA7, 0x19, 0x9A, 0xDA, 0x73, 0xAC,
+    0xA7, 0x3D, 0xA7, 0x1A, 0xE7, 0x2D, 0x97, 0x3D, 0x74, 0x99, 0x77, 0x70, 0x9F, 0xE9, 0x39, 0xFF,
+    0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9A, 0xAA,
+    0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6, 0xE9, 0xE7, 0xE9, 0xDA, 0x7E, 0x9D,
+    0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC, 0x99, 0xD1, 0x9F, 0xDA, 0x19, 0xD4,
+    0x99, 0x96, 0x77, 0x9A, 0xA7, 0x72, 0xDA, 0x73, 0x99, 0x92, 0xAD, 0x73, 0xAF, 0x09, 0xCA, 0x73,
+    0x9F, 0xCA, 0x75, 0x9D, 0xA0, 0x9D, 0x97, 0x4D, 0x93, 0xD9, 0x73, 0x96, 0x97, 0x77, 0x75, 0xE7,
+    0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA,
+    0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4,
+    0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF,
+    0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7,
+    0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0,
+    0x77, 0x77, 0xE7, 0x5E, 0x79, 0xE1, 0x9D, 0x79, 0xFC, 0x0A, 0xA7, 0x0D, 0xA9, 0xDA, 0x71, 0xDA,
+    0x2D, 0xA7, 0xAC, 0x94, 0xAC, 0x77, 0x77, 0x74, 0x9F, 0xE9, 0x69, 0xFF, 0xDA, 0x6D, 0xA9, 0x90,
+    0x9A, 0xE9, 0x59, 0x6A, 0xDA, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x09, 0xAA, 0xAA, 0xF5, 0xAF, 0xFE,
+    0x4F, 0xAA, 0x99, 0x99, 0xE3, 0xEA, 0x6E, 0x29, 0xE7, 0xE2, 0x9D, 0xA7, 0xE2, 0x9D, 0xA6, 0x9E,
+    0x29, 0xE6, 0xF3, 0xEA, 0x3A, 0xFC, 0x39, 0xFF, 0xC9, 0x9D, 0x49, 0xFD, 0xA1, 0x9D, 0x79, 0x99,
+    0x71, 0x1A, 0xA9, 0x77, 0x2A, 0xD9, 0x77, 0x2A, 0xD2, 0x99, 0x97, 0x5A, 0xCA, 0x0A, 0xF7, 0x79,
+    0xFC, 0xA7, 0x59, 0xDA, 0x09, 0xD9, 0x74, 0xD9, 0x3D, 0x97, 0x39, 0x69, 0x77, 0x77, 0x5E, 0x77,
+    0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0,
+    0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E,
+    0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD,
+    0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72,
+    0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00,
+    0x77, 0x0E, 0x74, 0x9D, 0x97, 0x49, 0xD1, 0x9E, 0x79, 0xA9, 0x0F, 0xC7, 0x1E, 0x9D, 0xA7, 0xDA,
+    0x2D, 0xA5, 0xAC, 0x94, 0xAC, 0x97, 0x77, 0x75, 0x9F, 0xE9, 0x49, 0xFF, 0xDA, 0x4D, 0xA9, 0x90,
+    0x9A, 0xE9, 0x39, 0x6A, 0xDA, 0x74, 0xE7, 0x4E, 0x74, 0xE6, 0x9A, 0xAA, 0xAF, 0x3A, 0xFF, 0xE2,
+    0xFA, 0xA9, 0x99, 0x9E, 0x1E, 0xA6, 0xE0, 0x9E, 0x7E, 0x09, 0xDA, 0x7E, 0x09, 0xDA, 0x69, 0xE0,
+    0x9E, 0x6F, 0x1E, 0xA3, 0xAF, 0xC1, 0x9F, 0xFC, 0x99, 0xD2, 0x9F, 0xDA, 0x19, 0xD5, 0x99, 0x96,
+    0x75, 0xAA, 0x97, 0x72, 0xF7, 0x73, 0xAC, 0x97, 0x72, 0xAC, 0x74, 0x99, 0x91, 0x9D, 0x97, 0x3A,
+    0xEA, 0x09, 0xC7, 0x4A, 0xFC, 0x97, 0x59, 0xD9, 0x0A, 0xD9, 0x73, 0x9D, 0x39, 0xD7, 0x49, 0x69,
+    0x77, 0x77, 0x5E, 0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E,
+    0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29,
+    0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF,
+    0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E,
+    0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D,
+    0xA0, 0xE7, 0x6E, 0x00, 0x77, 0x74, 0xE9, 0x74, 0x99, 0xD7, 0x6A, 0xC7, 0x5A, 0xD6, 0x9E, 0x19,
+    0xC9, 0x7F, 0xC1, 0xA7, 0xE9, 0xE7, 0x0D, 0xA2, 0xDA, 0x69, 0xC9, 0x4A, 0xC9, 0x77, 0x77, 0x70,
+    0x9F, 0xE9, 0x59, 0xFF, 0xDA, 0x5D, 0xA9, 0x90, 0x9A, 0xE9, 0x49, 0x6A, 0xDA, 0x75, 0xE7, 0x5E,
+    0x75, 0xE7, 0x9A, 0xAA, 0xAF, 0x4A, 0xFF, 0xE3, 0xFA, 0xA9, 0x99, 0x9E, 0x2E, 0xA6, 0xE1, 0x9E,
+    0x7E, 0x19, 0xDA, 0x7E, 0x19, 0xDA, 0x69, 0xE1, 0x9E, 0x6F, 0x2E, 0xA3, 0xAF, 0xC2, 0x9F, 0xFC,
+    0x99, 0xD3, 0x9F, 0xDA, 0x19, 0xD6, 0x99, 0x97, 0x00, 0x6A, 0xCA, 0x92, 0xAC, 0x73, 0xFD, 0x9A,
+    0xCA, 0x72, 0x9C, 0xA0, 0x9F, 0xC7, 0x39, 0xA3, 0x9A, 0xA7, 0x70, 0x99, 0x97, 0x71, 0x9F, 0x77,
+    0x9F, 0xCA, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xD9, 0x3D, 0x97, 0x39, 0x69, 0x77, 0x77, 0x5E, 0x77,
+    0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0,
+    0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E,
+    0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD,
+    0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72,
+    0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00,
+    0x49, 0x94, 0x95, 0xFA, 0x19, 0xC9, 0x39, 0xDA, 0xFD, 0x4D, 0x2A, 0xE9, 0x77, 0x69, 0xE7, 0x2F,
+    0xC7, 0x0E, 0x9D, 0xA6, 0xDA, 0x2D, 0xA4, 0xAC, 0x94, 0xAC, 0x77, 0x77, 0x39, 0xFE, 0x93, 0x9F,
+    0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA,
+    0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9,
+    0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D,
+    0x49, 0x99, 0x60, 0x70, 0xAA, 0xA7, 0x71, 0xAF, 0x77, 0x9F, 0xCA, 0x76, 0xE0, 0xAD, 0x97, 0x4D,
+    0xA2, 0xAD, 0x97, 0x2A, 0xC9, 0x49, 0xD7, 0x77, 0x77, 0x77, 0x2E, 0x77, 0x2E, 0xA7, 0x70, 0xAF,
+    0x77, 0x0F, 0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9,
+    0x1E, 0x74, 0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97,
+    0x0A, 0xD9, 0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAE, 0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97,
+    0x3E, 0x2E, 0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x77, 0x77, 0x77, 0x59, 0xCA,
+    0x77, 0x2E, 0x97, 0x71, 0xE9, 0x77, 0x19, 0xCA, 0x71, 0x6A, 0xAA, 0x72, 0xFA, 0x70, 0xAF, 0xC9,
+    0x69, 0xDA, 0x0E, 0x94, 0x9D, 0xA2, 0xAD, 0x4D, 0x94, 0x9C, 0xA7, 0x77, 0x72, 0x9F, 0xE9, 0x39,
+    0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9A,
+    0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6, 0xE9, 0xE7, 0xE9, 0xDA, 0x7E,
+    0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC, 0x99, 0xD1, 0x9F, 0xDA, 0x19,
+    0xD4, 0x99, 0x97, 0x77, 0x4A, 0xC9, 0x72, 0xAE, 0x72, 0xAE, 0x73, 0xAC, 0x50, 0x72, 0x9A, 0xA9,
+    0x77, 0x1E, 0x77, 0x1A, 0xD7, 0x71, 0x9D, 0x77, 0xCA, 0x49, 0xCA, 0x73, 0xD9, 0x3D, 0x74, 0x9F,
+    0xEA, 0x75, 0x9F, 0xCA, 0x77, 0x19, 0x77, 0x77, 0x71, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70,
+    0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7,
+    0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD,
+    0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2,
+    0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE0, 0x77, 0x7E, 0x72, 0xAD, 0x72, 0x9D,
+    0x79, 0xA1, 0x9A, 0x19, 0xA4, 0x9C, 0x94, 0xD5, 0xDA, 0x99, 0xAD, 0xA5, 0x9F, 0xE7, 0x0A, 0xDA,
+    0x97, 0x77, 0x75, 0x9F, 0xE9, 0x39, 0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA,
+    0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9A, 0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E,
+    0xA6, 0xE9, 0xE7, 0xE9, 0xDA, 0x7E, 0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F,
+    0xFC, 0x99, 0xD1, 0x9F, 0xDA, 0x19, 0xD4, 0x99, 0x96, 0x6A, 0xA9, 0x77, 0x2A, 0xD7, 0x73, 0xAC,
+    0xA7, 0x73, 0xAC, 0x97, 0x7C, 0xA4, 0x9C, 0x97, 0x3D, 0x93, 0xD7, 0x49, 0xFE, 0xA7, 0x59, 0xFC,
+    0xA7, 0x71, 0x97, 0x77, 0x77, 0x1E, 0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F, 0xC9, 0x76, 0x9D,
+    0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74, 0xE2, 0xAD, 0x97,
+    0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9, 0x5E, 0x70, 0xE6,
+    0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x94, 0x9D, 0xA7,
+    0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E, 0x74, 0xE9, 0x09,
+    0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00, 0x77, 0x29, 0xD9, 0x73, 0xAD, 0x74, 0xAC, 0xA7, 0x09,
+    0xA1, 0x9A, 0x19, 0xA4, 0x9C, 0x94, 0xD5, 0xDA, 0x99, 0xAD, 0xA5, 0x9F, 0xE7, 0x0A, 0xDA, 0x97,
+    0x77, 0x75, 0x9F, 0xE9, 0x39, 0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73,
+    0xE7, 0x3E, 0x73, 0xE5, 0x9A, 0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6,
+    0xE9, 0xE7, 0xE9, 0xDA, 0x7E, 0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC,
+    0x99, 0xD1, 0x9F, 0xDA, 0x19, 0xD4, 0x99, 0x96, 0x79, 0xCA, 0xA7, 0x71, 0x9A, 0xAD, 0x77, 0x3D,
+    0x77, 0x29, 0xD7, 0x71, 0xAC, 0x97, 0x7C, 0xA1, 0x91, 0x9C, 0x97, 0x3D, 0x93, 0xD7, 0x49, 0xFE,
+    0xA7, 0x59, 0xFC, 0xA7, 0x71, 0x97, 0x77, 0x77, 0x1E, 0x77, 0x2E, 0xA7, 0x70, 0xAF, 0x77, 0x0F,
+    0xC9, 0x76, 0x9D, 0x9D, 0xA7, 0x6E, 0x0A, 0xD7, 0x6D, 0xA0, 0x9D, 0x97, 0x4A, 0xD9, 0x1E, 0x74,
+    0xE2, 0xAD, 0x97, 0x29, 0xDA, 0x29, 0xDA, 0x72, 0xAD, 0x4E, 0x72, 0xE4, 0xAD, 0x97, 0x0A, 0xD9,
+    0x5E, 0x70, 0xE6, 0xE7, 0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xFD, 0x6E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE,
+    0x94, 0x9D, 0xA7, 0x09, 0xDA, 0x4E, 0x72, 0xE3, 0x9E, 0x72, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x2E,
+    0x74, 0xE9, 0x09, 0xDA, 0x74, 0x9D, 0xA0, 0xE7, 0x6E, 0x00, 0x69, 0x74, 0xAE, 0x74, 0x9C, 0xA7,
+    0x4C, 0xA7, 0x2A, 0xD7, 0x9A, 0x1A, 0xA1, 0x9A, 0x49, 0xCA, 0x4D, 0x5D, 0xA9, 0x9A, 0xE5, 0x9F,
+    0xE7, 0x0A, 0xAC, 0xA9, 0x77, 0x77, 0x59, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE,
+    0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73, 0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA,
+    0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E, 0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA,
+    0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D, 0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x6A, 0xCA, 0x3A,
+    0xA7, 0x3F, 0xD9, 0x9C, 0xA7, 0x29, 0xCA, 0x09, 0xFC, 0x73, 0x9A, 0x39, 0xAA, 0x77, 0x77, 0x29,
+    0xCA, 0x49, 0xC9, 0x73, 0xD3, 0x9D, 0x74, 0xAF, 0xEA, 0x75, 0xAF, 0xCA, 0x77, 0x19, 0x77, 0x77,
+    0x71, 0xE7, 0x72, 0xEA, 0x77, 0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD,
+    0x76, 0xDA, 0x09, 0xD9, 0x74, 0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7,
+    0x2A, 0xD4, 0xE7, 0x2E, 0x4A, 0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6,
+    0xAF, 0xFF, 0xD6, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E,
+    0x39, 0xE7, 0x2A, 0xDA, 0x2A, 0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E,
+    0x76, 0xE0, 0x59, 0x49, 0x5A, 0xEA, 0x2C, 0xA3, 0x9D, 0xAF, 0xD4, 0xAC, 0x29, 0xE9, 0x77, 0x39,
+    0xA5, 0x9A, 0x49, 0xC9, 0x4D, 0x5D, 0xA9, 0x9A, 0xDA, 0x59, 0xFE, 0x70, 0xAD, 0xA9, 0x77, 0x77,
+    0x59, 0xFE, 0x93, 0x9F, 0xFD, 0xA3, 0xDA, 0x99, 0x09, 0xAE, 0x92, 0x96, 0xAD, 0xA7, 0x3E, 0x73,
+    0xE7, 0x3E, 0x59, 0xAA, 0xAA, 0xF2, 0xAF, 0xFE, 0x1F, 0xAA, 0x99, 0x99, 0xE0, 0xEA, 0x6E, 0x9E,
+    0x7E, 0x9D, 0xA7, 0xE9, 0xDA, 0x69, 0xE9, 0xE6, 0xF0, 0xEA, 0x3A, 0xFC, 0x09, 0xFF, 0xC9, 0x9D,
+    0x19, 0xFD, 0xA1, 0x9D, 0x49, 0x99, 0x60, 0x49, 0xA9, 0x5A, 0xA7, 0x3D, 0x49, 0xCA, 0x73, 0xEA,
+    0xAA, 0xE9, 0x74, 0xFE, 0x97, 0x69, 0xAC, 0xAA, 0x77, 0x77, 0x77, 0x75, 0xE7, 0x72, 0xEA, 0x77,
+    0x0A, 0xF7, 0x70, 0xFC, 0x97, 0x69, 0xD9, 0xDA, 0x76, 0xE0, 0xAD, 0x76, 0xDA, 0x09, 0xD9, 0x74,
+    0xAD, 0x91, 0xE7, 0x4E, 0x2A, 0xD9, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x2A, 0xD4, 0xE7, 0x2E, 0x4A,
+    0xD9, 0x70, 0xAD, 0x95, 0xE7, 0x0E, 0x6E, 0x79, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0xD6, 0xEA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xE9, 0x49, 0xDA, 0x70, 0x9D, 0xA4, 0xE7, 0x2E, 0x39, 0xE7, 0x2A, 0xDA, 0x2A,
+    0xD9, 0x73, 0xE2, 0xE7, 0x4E, 0x90, 0x9D, 0xA7, 0x49, 0xDA, 0x0E, 0x76, 0xE7, 0x77, 0x77, 0x75,
+    0x9C, 0xA7, 0x72, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0x9C, 0xA7, 0x10, 0x29, 0xA6, 0xA9, 0x39, 0xCA,
+    0x4A, 0xC9, 0x4E, 0xAA, 0xAE, 0x59, 0xFE, 0x97, 0xAA, 0xCA, 0x97, 0x77, 0x75, 0x9F, 0xE9, 0x39,
+    0xFF, 0xDA, 0x3D, 0xA9, 0x90, 0x9A, 0xE9, 0x29, 0x6A, 0xDA, 0x73, 0xE7, 0x3E, 0x73, 0xE5, 0x9A,
+    0xAA, 0xAF, 0x2A, 0xFF, 0xE1, 0xFA, 0xA9, 0x99, 0x9E, 0x0E, 0xA6, 0xE9, 0xE7, 0xE9, 0xDA, 0x7E,
+    0x9D, 0xA6, 0x9E, 0x9E, 0x6F, 0x0E, 0xA3, 0xAF, 0xC0, 0x9F, 0xFC, 0x99, 0xD1, 0x9F, 0xDA, 0x19,
+    0xD4, 0x99, 0x97, 0x77, 0x39, 0xCA, 0x73, 0xE9, 0x72, 0xE9, 0x72, 0x9C, 0xA5, 0xAF, 0xFF, 0x9F,
+    0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC,
+    0xA7, 0x77, 0x71, 0xD7, 0x2A, 0xDA, 0x71, 0xAD, 0xA7, 0x2D, 0x50, 0x77, 0x5A, 0xFC, 0xA9, 0x7F,
+    0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1,
+    0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9,
+    0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x77, 0x76, 0xD7, 0x5A, 0xDA, 0x74, 0xAD, 0xA7,
+    0x5D, 0x60, 0x49, 0x99, 0x71, 0xAF, 0xA7, 0x99, 0x9A, 0xD9, 0x72, 0xDA, 0x72, 0xD9, 0x70, 0xAE,
+    0x70, 0x9D, 0x97, 0x2D, 0x73, 0x97, 0x74, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72,
+    0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF,
+    0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x69, 0x99, 0x74, 0xAF, 0xA7,
+    0x29, 0x99, 0xAD, 0x97, 0x5D, 0xA7, 0x5D, 0x97, 0x3A, 0xE7, 0x39, 0xD9, 0x75, 0xCA, 0x76, 0x97,
+    0x77, 0x5A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6,
+    0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1,
+    0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74,
+    0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x39, 0x95,
+    0xA2, 0xAF, 0x92, 0xD1, 0x9F, 0xEA, 0xE1, 0xAC, 0x91, 0xAF, 0xC2, 0xAA, 0x4A, 0xAA, 0x77, 0x76,
+    0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFF,
+    0xCA, 0xFF, 0xFC, 0xA0, 0x49, 0x95, 0xA9, 0x49, 0xFA, 0x29, 0xC9, 0x4F, 0xEA, 0xAD, 0x49, 0xCA,
+    0x19, 0xFC, 0xA4, 0x9C, 0x49, 0xAA, 0x97, 0x77, 0x77, 0x2A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA,
+    0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7,
+    0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9,
+    0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x74, 0xAA, 0x97, 0x3E, 0x59, 0x99, 0x29, 0xD5, 0x9F, 0x1D,
+    0x6F, 0xD7, 0x0E, 0x1D, 0xA6, 0xDA, 0x3A, 0xCA, 0x59, 0x69, 0x97, 0x73, 0xAF, 0xFF, 0x91, 0xFF,
+    0xFC, 0xA1, 0xFF, 0xFC, 0x91, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4F,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xFC, 0x2F, 0xFF, 0xC2, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF, 0xCA, 0x1F,
+    0xFF, 0xCA, 0x10, 0x77, 0x77, 0xE7, 0x59, 0xD9, 0x7E, 0x91, 0xD9, 0x7F, 0xC9, 0x9A, 0x97, 0xAD,
+    0x9E, 0x71, 0xAD, 0x2A, 0xD7, 0x9C, 0xA4, 0x9C, 0xA7, 0x77, 0x77, 0x4A, 0xFC, 0xA9, 0x70, 0xFF,
+    0xCA, 0x6E, 0xA9, 0x09, 0xAE, 0xA4, 0xE9, 0x5E, 0x39, 0xDA, 0x6A, 0xDA, 0x2A, 0xD9, 0x7E, 0x2E,
+    0x70, 0xE2, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE2, 0xFF, 0xFE, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x2E, 0x76, 0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6E, 0xA7, 0x59, 0xF9, 0x91, 0x99, 0xAC, 0x94,
+    0x9F, 0xFE, 0x96, 0xAF, 0xF9, 0x72, 0x99, 0x96, 0x9A, 0xA7, 0x5D, 0xA7, 0x49, 0xD9, 0x29, 0x97,
+    0x0D, 0x1F, 0x72, 0xFD, 0x70, 0xE1, 0xE6, 0xAC, 0xA3, 0xAC, 0xA5, 0x97, 0x97, 0x73, 0xAF, 0xFF,
+    0x91, 0xFF, 0xFC, 0xA1, 0xFF, 0xFC, 0x91, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74,
+    0xE7, 0x4F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xFF, 0xFC, 0x2F, 0xFF, 0xC2, 0xE7, 0x4E, 0x74, 0xE7,
+    0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFF,
+    0xCA, 0x1F, 0xFF, 0xCA, 0x77, 0x0A, 0xD7, 0x6E, 0x76, 0xD9, 0x1E, 0xA7, 0x0A, 0xA0, 0xAF, 0x97,
+    0x1A, 0xD9, 0xAD, 0x70, 0x9D, 0x2A, 0xD7, 0xCA, 0x49, 0xCA, 0x77, 0x77, 0x71, 0xAF, 0xCA, 0x97,
+    0xFF, 0xCA, 0x5E, 0xA9, 0x09, 0xAE, 0xA3, 0xE9, 0x5E, 0x29, 0xDA, 0x6A, 0xDA, 0x1A, 0xD9, 0x7E,
+    0x1E, 0x70, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x1E, 0x75, 0xE7, 0x5E, 0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xF9, 0x91, 0x99, 0xAC,
+    0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xF9, 0x71, 0x99, 0x95, 0x71, 0x9A, 0x97, 0x3A, 0xE9, 0x74, 0xCA,
+    0x73, 0x9C, 0xA4, 0x99, 0x92, 0xDA, 0x49, 0xF1, 0xCA, 0x5F, 0xD7, 0xDA, 0x1D, 0xA5, 0xDA, 0x3A,
+    0xCA, 0x49, 0x69, 0x97, 0x71, 0xAF, 0xFF, 0x90, 0xFF, 0xFC, 0xA0, 0xFF, 0xFC, 0x90, 0xE7, 0x3E,
+    0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3F, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xC1, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xCA, 0x0F, 0xFF, 0xCA, 0x00, 0x77, 0x74, 0xE9, 0x74,
+    0x99, 0xD7, 0x69, 0xC9, 0x74, 0xAD, 0x69, 0xE9, 0x09, 0xC9, 0x7F, 0xC1, 0xA7, 0xE9, 0xE7, 0x0A,
+    0xCA, 0x2D, 0xA6, 0x9C, 0x94, 0x9C, 0x97, 0x77, 0x77, 0x1A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA,
+    0x90, 0x9A, 0xEA, 0x3E, 0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7,
+    0x5E, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9,
+    0x5A, 0xFF, 0x97, 0x19, 0x99, 0x50, 0x2A, 0xD9, 0x29, 0xC3, 0xAF, 0xC9, 0x9D, 0x3D, 0x09, 0xFC,
+    0x93, 0xA3, 0x9A, 0xA9, 0x70, 0x99, 0x72, 0xF7, 0x0F, 0xD6, 0xE1, 0xDA, 0x4D, 0xA3, 0xAC, 0xA3,
+    0x96, 0x99, 0x77, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA0, 0x59, 0x49, 0x96, 0xAF, 0x91, 0xCA, 0x6D, 0xAF, 0xD9,
+    0x5A, 0xC2, 0x9E, 0xA7, 0x77, 0x3E, 0x97, 0x3F, 0xC7, 0x2E, 0x9E, 0x70, 0xAD, 0x2A, 0xD6, 0x9C,
+    0xA4, 0x9C, 0x97, 0x77, 0x77, 0x1A, 0xFC, 0xA9, 0x7F, 0xFC, 0xA5, 0xEA, 0x90, 0x9A, 0xEA, 0x3E,
+    0x95, 0xE2, 0x9D, 0xA6, 0xAD, 0xA1, 0xAD, 0x97, 0xE1, 0xE7, 0x0E, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAE, 0x1F, 0xFF, 0xE1, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xE7, 0x5E, 0x75, 0xE9, 0x74,
+    0x9E, 0x75, 0xEA, 0x74, 0x9F, 0x99, 0x19, 0x9A, 0xC9, 0x39, 0xFF, 0xE9, 0x5A, 0xFF, 0x97, 0x19,
+    0x99, 0x50, 0x5A, 0xA9, 0x71, 0xF9, 0x7F, 0xD6, 0xAD, 0x90, 0xE4, 0xAD, 0x92, 0xE3, 0xCA, 0x5A,
+    0xCA, 0x77, 0x74, 0xAF, 0xFF, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0x9E, 0x72, 0xE7, 0x2E, 0x72, 0xE7,
+    0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0F, 0xFF, 0xC0, 0xFF, 0xFC, 0x0E,
+    0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0x9F, 0xFF, 0xCA, 0xFF, 0xFC, 0xA7, 0x77, 0x71, 0xD7, 0x2A, 0xDA, 0x71, 0xAD, 0xA7, 0x2D,
+    0x50, 0x6A, 0xAA, 0x74, 0xAE, 0xA7, 0x29, 0xFC, 0x97, 0x09, 0xDA, 0x0A, 0xD9, 0x7D, 0xA2, 0xAD,
+    0x95, 0xAC, 0x94, 0x9D, 0x77, 0x77, 0x71, 0xAF, 0xCA, 0x97, 0xFF, 0xCA, 0x5E, 0xA9, 0x09, 0xAE,
+    0xA3, 0xE9, 0x5E, 0x29, 0xDA, 0x6A, 0xDA, 0x1A, 0xD9, 0x7E, 0x1E, 0x70, 0xE1, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xE1, 0xFF, 0xFE, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0x75, 0xE7, 0x5E,
+    0x97, 0x49, 0xE7, 0x5E, 0xA7, 0x49, 0xF9, 0x91, 0x99, 0xAC, 0x93, 0x9F, 0xFE, 0x95, 0xAF, 0xF9,
+    0x71, 0x99, 0x97, 0x77, 0x6D, 0x75, 0xAD, 0xA7, 0x4A, 0xDA, 0x75, 0xD6, 0x19, 0xEA, 0x3A, 0xFC,
+    0x6D, 0x95, 0xD9, 0x4A, 0xD3, 0x9E, 0x49, 0xCA, 0x59, 0xC9, 0x73, 0xAF, 0xEA, 0xAF, 0xF1, 0x9E,
+    0xA9, 0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x91, 0xAF, 0xFA, 0xFF, 0x99, 0x93, 0xFC, 0x1A, 0x9A, 0xE3, 0x9D, 0x3A,
+    0xD1, 0x9E, 0x91, 0xDA, 0x3A, 0xC5, 0x97, 0x3D, 0xA3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xAF, 0xEA, 0xAF, 0xF1, 0x9E, 0xA9,
+    0x3E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x91, 0xAF, 0xFA, 0xFF, 0x77, 0x49, 0xCA, 0x5E, 0x94, 0xE9, 0x49, 0xCA, 0x20,
+    0x09, 0xA1, 0x9E, 0x09, 0xE1, 0xDA, 0x77, 0x0D, 0xA1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE7, 0x3A, 0xC9, 0x09, 0xE0, 0x9E, 0x1A,
+    0xC9, 0x00, 0x77, 0x73, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA,
+    0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7,
+    0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9,
+    0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7,
+    0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6,
+    0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x77, 0x77, 0x1D, 0x77, 0x2A, 0xDA, 0x77, 0x1A,
+    0xDA, 0x77, 0x2D, 0x71, 0x77, 0x6A, 0xFD, 0xA7, 0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA,
+    0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71,
+    0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7,
+    0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49,
+    0x97, 0x77, 0x71, 0xD7, 0x6A, 0xDA, 0x75, 0xAD, 0xA7, 0x6D, 0x70, 0x70, 0xEA, 0x77, 0x09, 0xFC,
+    0x97, 0x72, 0xDA, 0x77, 0x2A, 0xCA, 0x77, 0x19, 0xD9, 0x77, 0x0E, 0x97, 0x71, 0xD7, 0x73, 0xD7,
+    0x77, 0x75, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA,
+    0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A,
+    0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD,
+    0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA,
+    0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF,
+    0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0x69, 0x99, 0x76, 0xFA, 0x74, 0x99, 0xAD, 0xA7, 0x6A,
+    0xD7, 0x6A, 0xCA, 0x74, 0xAE, 0x75, 0xD9, 0x76, 0xD7, 0x79, 0x97, 0x77, 0x6A, 0xFD, 0xA7, 0x9F,
+    0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1,
+    0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E,
+    0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9,
+    0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x77, 0x0A, 0xA9, 0x77, 0x1A, 0xD7, 0x49, 0x92,
+    0x9D, 0x97, 0x3F, 0x1D, 0x74, 0xFD, 0x76, 0xE1, 0xE7, 0x4A, 0xCA, 0x3A, 0xCA, 0x73, 0x97, 0x97,
+    0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA,
+    0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A,
+    0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD,
+    0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA,
+    0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF,
+    0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0x77, 0x77, 0x9D, 0xA7, 0x5D, 0xA7, 0xAD, 0xA1, 0xAC,
+    0xA7, 0xAF, 0xA0, 0xAA, 0x79, 0xDA, 0xAD, 0x97, 0x09, 0xD9, 0x19, 0xD9, 0x7A, 0xA5, 0xAC, 0x77,
+    0x77, 0x74, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x5F, 0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E, 0x29, 0xE7,
+    0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71, 0xE1, 0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71,
+    0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E, 0x1A, 0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA, 0x2E, 0xA5,
+    0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x19, 0xAA,
+    0x77, 0x3E, 0x77, 0x3D, 0x92, 0x99, 0x76, 0xD1, 0xF9, 0x77, 0xFD, 0x76, 0xAD, 0x1E, 0x74, 0xAC,
+    0xA3, 0xAC, 0xA7, 0x39, 0x96, 0x97, 0x77, 0x71, 0x9A, 0xFD, 0xA9, 0x71, 0x9F, 0xFF, 0x96, 0xAF,
+    0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2, 0xAE, 0x73, 0xAD, 0xA1,
+    0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59, 0xFD, 0x97, 0x6F, 0xD7,
+    0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD, 0xA9, 0xE7, 0x5E, 0x90,
+    0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA, 0x79, 0xEA, 0x4A, 0xFA,
+    0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97, 0x10, 0x77, 0x19, 0xDA,
+    0x76, 0xAD, 0x77, 0xAD, 0x1A, 0xE7, 0x19, 0xA0, 0x9F, 0xA7, 0x29, 0xDA, 0x9D, 0xA7, 0x1D, 0x91,
+    0x9D, 0x97, 0xAC, 0x5A, 0xC7, 0x77, 0x77, 0x4A, 0xFD, 0xA7, 0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F,
+    0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA, 0x1A, 0xD9, 0x70, 0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9,
+    0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xE9, 0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E,
+    0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4, 0xEA, 0x91, 0x9A, 0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD,
+    0xA7, 0x49, 0x97, 0x75, 0x9A, 0x97, 0x72, 0xAE, 0x97, 0x73, 0xD7, 0x72, 0x9C, 0xA7, 0x39, 0x99,
+    0x2D, 0xA7, 0x4F, 0x1C, 0xA7, 0x4F, 0xD7, 0x6E, 0x1E, 0x74, 0xAC, 0xA3, 0xAC, 0xA7, 0x39, 0x79,
+    0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA4, 0x9E,
+    0xA7, 0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0, 0x9E, 0x75, 0xE9,
+    0xAD, 0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77, 0xFD, 0x97, 0x6F,
+    0xD9, 0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1, 0xEA, 0x73, 0xAD,
+    0xA1, 0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A, 0xFA, 0x6A, 0xFF,
+    0xFA, 0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x77, 0x75, 0xAD, 0xA7, 0x69, 0xAC, 0xA7, 0x7D, 0x75,
+    0x9D, 0x97, 0xAD, 0xA1, 0xAC, 0x70, 0xAF, 0xA0, 0x9A, 0x79, 0xDA, 0xAD, 0x97, 0x09, 0xD9, 0x19,
+    0xD9, 0x7A, 0xA5, 0xAC, 0x77, 0x77, 0x74, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x5F, 0x99, 0x99, 0xF9,
+    0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71, 0xE1, 0xE7, 0x1E, 0x90,
+    0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E, 0x1A, 0xD9, 0x70, 0xE1,
+    0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F, 0xFD, 0x97, 0xAF, 0xDA,
+    0x74, 0x99, 0x70, 0x6A, 0xD9, 0x29, 0xC7, 0x39, 0xFC, 0xA9, 0xD7, 0x3D, 0x09, 0xAF, 0x97, 0x3A,
+    0x93, 0xAA, 0x97, 0x70, 0x99, 0x77, 0x2F, 0x77, 0x0F, 0xD7, 0x6E, 0x1E, 0x74, 0xAC, 0xA3, 0xAC,
+    0xA7, 0x39, 0x79, 0x77, 0x77, 0x19, 0xAF, 0xDA, 0x97, 0x19, 0xFF, 0xF9, 0x6A, 0xFC, 0xA9, 0x9A,
+    0xFC, 0xA4, 0x9E, 0xA7, 0xAE, 0x93, 0xEA, 0x71, 0x9E, 0x2A, 0xE7, 0x3A, 0xDA, 0x1E, 0x75, 0xE0,
+    0x9E, 0x75, 0xE9, 0xAD, 0xA7, 0x5A, 0xDA, 0xE9, 0x75, 0x9F, 0xD9, 0x76, 0xFD, 0x77, 0xFD, 0x77,
+    0xFD, 0x97, 0x6F, 0xD9, 0x75, 0x9E, 0xAD, 0xA7, 0x5A, 0xDA, 0x9E, 0x75, 0xE9, 0x0E, 0x75, 0xE1,
+    0xEA, 0x73, 0xAD, 0xA1, 0x9E, 0x97, 0x19, 0xE3, 0xAE, 0xA7, 0x9E, 0xA4, 0xAF, 0xA9, 0x99, 0x9A,
+    0xFA, 0x6A, 0xFF, 0xFA, 0x71, 0xAF, 0xFA, 0x77, 0x99, 0x71, 0x59, 0x94, 0x97, 0x0F, 0xA1, 0xAC,
+    0x7A, 0xCA, 0xFE, 0x7C, 0xA2, 0xAE, 0x77, 0x75, 0xAD, 0xA7, 0x49, 0xFA, 0x72, 0x9D, 0xAA, 0xD9,
+    0x71, 0xD9, 0x19, 0xD9, 0x7A, 0xA5, 0xAC, 0x77, 0x77, 0x74, 0xAF, 0xDA, 0x79, 0xFF, 0xD9, 0x5F,
+    0x99, 0x99, 0xF9, 0x3E, 0xA5, 0x9E, 0x29, 0xE7, 0xAD, 0xA1, 0xAD, 0x97, 0x0E, 0x1E, 0x71, 0xE1,
+    0xE7, 0x1E, 0x90, 0xE7, 0x1A, 0xD9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1E, 0x90, 0xE7, 0x1E, 0x1A,
+    0xD9, 0x70, 0xE1, 0x9E, 0x7A, 0xDA, 0x2E, 0xA5, 0x9E, 0x4E, 0xA9, 0x19, 0xAE, 0x94, 0x9F, 0xFD,
+    0x97, 0xAF, 0xDA, 0x74, 0x99, 0x70, 0x70, 0x9A, 0xA9, 0x77, 0x1F, 0x77, 0x0F, 0xD7, 0x6E, 0x99,
+    0xE7, 0x4A, 0xD9, 0x2E, 0x72, 0x9C, 0xA5, 0xAC, 0x97, 0x77, 0x77, 0x76, 0x9A, 0xFD, 0xA9, 0x71,
+    0x9F, 0xFF, 0x96, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x49, 0xEA, 0x7A, 0xE9, 0x3E, 0xA7, 0x19, 0xE2,
+    0xAE, 0x73, 0xAD, 0xA1, 0xE7, 0x5E, 0x09, 0xE7, 0x5E, 0x9A, 0xDA, 0x75, 0xAD, 0xAE, 0x97, 0x59,
+    0xFD, 0x97, 0x6F, 0xD7, 0x7F, 0xD7, 0x7F, 0xD9, 0x76, 0xFD, 0x97, 0x59, 0xEA, 0xDA, 0x75, 0xAD,
+    0xA9, 0xE7, 0x5E, 0x90, 0xE7, 0x5E, 0x1E, 0xA7, 0x3A, 0xDA, 0x19, 0xE9, 0x71, 0x9E, 0x3A, 0xEA,
+    0x79, 0xEA, 0x4A, 0xFA, 0x99, 0x99, 0xAF, 0xA6, 0xAF, 0xFF, 0xA7, 0x1A, 0xFF, 0xA7, 0x79, 0x97,
+    0x77, 0x77, 0x1D, 0x77, 0x2A, 0xDA, 0x77, 0x1A, 0xDA, 0x77, 0x2D, 0x71, 0x69, 0xAA, 0x97, 0x5F,
+    0x97, 0x3F, 0xD7, 0x2A, 0xD9, 0x0E, 0x70, 0xAD, 0x92, 0xE6, 0x9C, 0xA5, 0xAC, 0xA7, 0x77, 0x77,
+    0x3A, 0xFD, 0xA7, 0x9F, 0xFD, 0x95, 0xF9, 0x99, 0x9F, 0x93, 0xEA, 0x59, 0xE2, 0x9E, 0x7A, 0xDA,
+    0x1A, 0xD9, 0x70, 0xE1, 0xE7, 0x1E, 0x1E, 0x71, 0xE9, 0x0E, 0x71, 0xAD, 0x90, 0xE7, 0x1A, 0xD9,
+    0x0E, 0x71, 0xE9, 0x0E, 0x71, 0xE1, 0xAD, 0x97, 0x0E, 0x19, 0xE7, 0xAD, 0xA2, 0xEA, 0x59, 0xE4,
+    0xEA, 0x91, 0x9A, 0xE9, 0x49, 0xFF, 0xD9, 0x7A, 0xFD, 0xA7, 0x49, 0x97, 0x77, 0x71, 0xD7, 0x6A,
+    0xDA, 0x75, 0xAD, 0xA7, 0x6D, 0x70, 0x73, 0x9A, 0xA9, 0x77, 0x39, 0xE7, 0x74, 0xE9, 0x77, 0x3A,
+    0xD9, 0x77, 0x39, 0xD9, 0x77, 0x4A, 0xC9, 0x77, 0x77, 0x29, 0x97, 0x75, 0xAD, 0xA5, 0x9A, 0xFD,
+    0xA9, 0x4A, 0xD9, 0x39, 0xFF, 0xF9, 0x2E, 0x3A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA0, 0x9D, 0xA2, 0x9E,
+    0xA7, 0xAF, 0xE3, 0xEA, 0x71, 0xAF, 0xA3, 0xAE, 0x73, 0xEA, 0x4E, 0x75, 0xE3, 0x9E, 0x75, 0xE9,
+    0x2A, 0xDA, 0x75, 0xAD, 0xA2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2, 0xE7, 0x7E, 0x2E, 0x77,
+    0xE2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2, 0xAD, 0xA7, 0x5A, 0xDA, 0x29, 0xE7, 0x5E, 0x93,
+    0xE7, 0x5E, 0x4E, 0xA7, 0x3A, 0xDA, 0x49, 0xE9, 0x71, 0x9E, 0x6A, 0xEA, 0x79, 0xEA, 0x7A, 0xFA,
+    0x99, 0x99, 0xAF, 0xA7, 0x1A, 0xFF, 0xF9, 0x74, 0xAF, 0xFA, 0x77, 0x29, 0x97, 0x40, 0x71, 0x9A,
+    0xA9, 0x77, 0x9E, 0x97, 0x7E, 0x97, 0x7A, 0xD9, 0x77, 0x9D, 0x97, 0x70, 0xAC, 0x96, 0xAA, 0xA9,
+    0x77, 0x0E, 0x97, 0x70, 0xE5, 0xAF, 0xDA, 0x29, 0xDA, 0x4F, 0xFD, 0x90, 0xE4, 0xF9, 0x99, 0x9F,
+    0xE9, 0x3E, 0xA5, 0x9F, 0x49, 0xE7, 0xAD, 0xA4, 0xAD, 0x97, 0x0E, 0x4E, 0x71, 0xE4, 0xE7, 0x1E,
+    0x93, 0xE7, 0x1A, 0xD9, 0x3E, 0x71, 0xAD, 0x93, 0xE7, 0x1A, 0xD9, 0x3E, 0x71, 0xE4, 0xAD, 0x97,
+    0x0E, 0x49, 0xDA, 0x7A, 0xDA, 0x5E, 0x95, 0x9E, 0x7E, 0xA9, 0x2A, 0xE9, 0x79, 0xFF, 0xD9, 0x72,
+    0xAF, 0xDA, 0x77, 0x99, 0x72, 0x6A, 0xAA, 0x77, 0x5E, 0xA7, 0x75, 0xE9, 0x77, 0x5E, 0x77, 0x6D,
+    0xA7, 0x76, 0xAC, 0x77, 0x77, 0x19, 0x97, 0x75, 0xAD, 0xA5, 0x9A, 0xFD, 0xA9, 0x4A, 0xD9, 0x39,
+    0xFF, 0xF9, 0x2E, 0x3A, 0xFC, 0xA9, 0x9A, 0xFC, 0xA0, 0x9D, 0xA2, 0x9E, 0xA7, 0xAF, 0xE3, 0xEA,
+    0x71, 0xAF, 0xA3, 0xAE, 0x73, 0xEA, 0x4E, 0x75, 0xE3, 0x9E, 0x75, 0xE9, 0x2A, 0xDA, 0x75, 0xAD,
+    0xA2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2, 0xE7, 0x7E, 0x2E, 0x77, 0xE2, 0xE9, 0x75, 0x9E,
+    0x2E, 0x97, 0x59, 0xE2, 0xAD, 0xA7, 0x5A, 0xDA, 0x29, 0xE7, 0x5E, 0x93, 0xE7, 0x5E, 0x4E, 0xA7,
+    0x3A, 0xDA, 0x49, 0xE9, 0x71, 0x9E, 0x6A, 0xEA, 0x79, 0xEA, 0x7A, 0xFA, 0x99, 0x99, 0xAF, 0xA7,
+    0x1A, 0xFF, 0xF9, 0x74, 0xAF, 0xFA, 0x77, 0x29, 0x97, 0x40, 0x4A, 0xAA, 0x77, 0x1A, 0xE7, 0x71,
+    0xE9, 0x77, 0x1E, 0x77, 0x2D, 0xA7, 0x72, 0xAC, 0x94, 0xAA, 0xA9, 0x77, 0x0E, 0x97, 0x70, 0xE5,
+    0xAF, 0xDA, 0x29, 0xDA, 0x4F, 0xFD, 0x90, 0xE4, 0xF9, 0x99, 0x9F, 0xE9, 0x3E, 0xA5, 0x9F, 0x49,
+    0xE7, 0xAD, 0xA4, 0xAD, 0x97, 0x0E, 0x4E, 0x71, 0xE4, 0xE7, 0x1E, 0x93, 0xE7, 0x1A, 0xD9, 0x3E,
+    0x71, 0xAD, 0x93, 0xE7, 0x1A, 0xD9, 0x3E, 0x71, 0xE4, 0xAD, 0x97, 0x0E, 0x49, 0xDA, 0x7A, 0xDA,
+    0x5E, 0x95, 0x9E, 0x7E, 0xA9, 0x2A, 0xE9, 0x79, 0xFF, 0xD9, 0x72, 0xAF, 0xDA, 0x77, 0x99, 0x72,
+    0x70, 0x99, 0x97, 0x74, 0xAF, 0x97, 0x72, 0x99, 0x9A, 0xD7, 0x76, 0xD9, 0x77, 0x5D, 0x97, 0x72,
+    0x9A, 0xDA, 0x77, 0x39, 0xD9, 0x77, 0x49, 0xCA, 0x77, 0x69, 0x72, 0x99, 0x77, 0x5A, 0xDA, 0x59,
+    0xAF, 0xDA, 0x94, 0xAD, 0x93, 0x9F, 0xFF, 0x92, 0xE3, 0xAF, 0xCA, 0x99, 0xAF, 0xCA, 0x09, 0xDA,
+    0x29, 0xEA, 0x7A, 0xFE, 0x3E, 0xA7, 0x1A, 0xFA, 0x3A, 0xE7, 0x3E, 0xA4, 0xE7, 0x5E, 0x39, 0xE7,
+    0x5E, 0x92, 0xAD, 0xA7, 0x5A, 0xDA, 0x2E, 0x97, 0x59, 0xE2, 0xE9, 0x75, 0x9E, 0x2E, 0x77, 0xE2,
+    0xE7, 0x7E, 0x2E, 0x97, 0x59, 0xE2, 0xE9, 0x75, 0x9E, 0x2A, 0xDA, 0x75, 0xAD, 0xA2, 0x9E, 0x75,
+    0xE9, 0x3E, 0x75, 0xE4, 0xEA, 0x73, 0xAD, 0xA4, 0x9E, 0x97, 0x19, 0xE6, 0xAE, 0xA7, 0x9E, 0xA7,
+    0xAF, 0xA9, 0x99, 0x9A, 0xFA, 0x71, 0xAF, 0xFF, 0x97, 0x4A, 0xFF, 0xA7, 0x72, 0x99, 0x74, 0x69,
+    0x99, 0x77, 0x0A, 0xF9, 0x76, 0x99, 0x9A, 0xD7, 0x72, 0xD9, 0x77, 0x1D, 0x97, 0x7A, 0xDA, 0x77,
+    0x9D, 0x97, 0x70, 0x9C, 0xA6, 0xAA, 0xA9, 0x79, 0x7E, 0x97, 0x70, 0xE5, 0xAF, 0xDA, 0x29, 0xDA,
+    0x4F, 0xFD, 0x90, 0xE4, 0xF9, 0x99, 0x9F, 0xE9, 0x3E, 0xA5, 0x9F, 0x49, 0xE7, 0xAD, 0xA4, 0xAD,
+    0x97, 0x0E, 0x4E, 0x71, 0xE4, 0xE7, 0x1E, 0x93, 0xE7, 0x1A, 0xD9, 0x3E, 0x71, 0xAD, 0x93, 0xE7,
+    0x1A, 0xD9, 0x3E, 0x71, 0xE4, 0xAD, 0x97, 0x0E, 0x49, 0xDA, 0x7A, 0xDA, 0x5E, 0x95, 0x9E, 0x7E,
+    0xA9, 0x2A, 0xE9, 0x79, 0xFF, 0xD9, 0x72, 0xAF, 0xDA, 0x77, 0x99, 0x72, 0x69, 0x99, 0x49, 0xA7,
+    0x5A, 0xF9, 0x2D, 0x74, 0x9F, 0xEA, 0xDA, 0x74, 0xD2, 0xAF, 0xC7, 0x5C, 0xA4, 0xAC, 0xA7, 0x77,
+    0x79, 0x97, 0x75, 0xAD, 0xA5, 0x9A, 0xFD, 0xA9, 0x4A, 0xD9, 0x39, 0xFF, 0xF9, 0x2E, 0x3A, 0xFC,
+    0xA9, 0x9A, 0xFC, 0xA0, 0x9D, 0xA2, 0x9E, 0xA7, 0xAF, 0xE3, 0xEA, 0x71, 0xAF, 0xA3, 0xAE, 0x73,
+    0xEA, 0x4E, 0x75, 0xE3, 0x9E, 0x75, 0xE9, 0x2A, 0xDA, 0x75, 0xAD, 0xA2, 0xE9, 0x75, 0x9E, 0x2E,
+    0x97, 0x59, 0xE2, 0xE7, 0x7E, 0x2E, 0x77, 0xE2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2, 0xAD,
+    0xA7, 0x5A, 0xDA, 0x29, 0xE7, 0x5E, 0x93, 0xE7, 0x5E, 0x4E, 0xA7, 0x3A, 0xDA, 0x49, 0xE9, 0x71,
+    0x9E, 0x6A, 0xEA, 0x79, 0xEA, 0x7A, 0xFA, 0x99, 0x99, 0xAF, 0xA7, 0x1A, 0xFF, 0xF9, 0x74, 0xAF,
+    0xFA, 0x77, 0x29, 0x97, 0x40, 0x49, 0x99, 0x49, 0xA7, 0x1A, 0xF9, 0x2D, 0x70, 0x9F, 0xEA, 0xDA,
+    0x70, 0xD9, 0x1A, 0xFC, 0x71, 0xCA, 0x4A, 0xCA, 0x3A, 0xAA, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x5A,
+    0xFD, 0xA2, 0x9D, 0xA4, 0xFF, 0xD9, 0x0E, 0x4F, 0x99, 0x99, 0xFE, 0x93, 0xEA, 0x59, 0xF4, 0x9E,
+    0x7A, 0xDA, 0x4A, 0xD9, 0x70, 0xE4, 0xE7, 0x1E, 0x4E, 0x71, 0xE9, 0x3E, 0x71, 0xAD, 0x93, 0xE7,
+    0x1A, 0xD9, 0x3E, 0x71, 0xAD, 0x93, 0xE7, 0x1E, 0x4A, 0xD9, 0x70, 0xE4, 0x9D, 0xA7, 0xAD, 0xA5,
+    0xE9, 0x59, 0xE7, 0xEA, 0x92, 0xAE, 0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x20,
+    0x77, 0x59, 0x97, 0x75, 0xAD, 0xA5, 0x9A, 0xFD, 0xA9, 0x4A, 0xD9, 0x39, 0xFF, 0xF9, 0x2E, 0x3A,
+    0xFC, 0xA9, 0x9A, 0xFC, 0xA0, 0x9D, 0xA2, 0x9E, 0xA7, 0xAF, 0xE3, 0xEA, 0x71, 0xAF, 0xA3, 0xAE,
+    0x73, 0xEA, 0x4E, 0x75, 0xE3, 0x9E, 0x75, 0xE9, 0x2A, 0xDA, 0x75, 0xAD, 0xA2, 0xE9, 0x75, 0x9E,
+    0x2E, 0x97, 0x59, 0xE2, 0xE7, 0x7E, 0x2E, 0x77, 0xE2, 0xE9, 0x75, 0x9E, 0x2E, 0x97, 0x59, 0xE2,
+    0xAD, 0xA7, 0x5A, 0xDA, 0x29, 0xE7, 0x5E, 0x93, 0xE7, 0x5E, 0x4E, 0xA7, 0x3A, 0xDA, 0x49, 0xE9,
+    0x71, 0x9E, 0x6A, 0xEA, 0x79, 0xEA, 0x7A, 0xFA, 0x99, 0x99, 0xAF, 0xA7, 0x1A, 0xFF, 0xF9, 0x74,
+    0xAF, 0xFA, 0x77, 0x29, 0x97, 0x77, 0x77, 0x7C, 0xA7, 0x75, 0xAD, 0xA7, 0x74, 0xAD, 0xA7, 0x75,
+    0xCA, 0x74, 0x77, 0x0A, 0xAA, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x5A, 0xFD, 0xA2, 0x9D, 0xA4, 0xFF,
+    0xD9, 0x0E, 0x4F, 0x99, 0x99, 0xFE, 0x93, 0xEA, 0x59, 0xF4, 0x9E, 0x7A, 0xDA, 0x4A, 0xD9, 0x70,
+    0xE4, 0xE7, 0x1E, 0x4E, 0x71, 0xE9, 0x3E, 0x71, 0xAD, 0x93, 0xE7, 0x1A, 0xD9, 0x3E, 0x71, 0xAD,
+    0x93, 0xE7, 0x1E, 0x4A, 0xD9, 0x70, 0xE4, 0x9D, 0xA7, 0xAD, 0xA5, 0xE9, 0x59, 0xE7, 0xEA, 0x92,
+    0xAE, 0x97, 0x9F, 0xFD, 0x97, 0x2A, 0xFD, 0xA7, 0x79, 0x97, 0x77, 0x77, 0xD7, 0x71, 0xAD, 0xA7,
+    0x70, 0xAD, 0xA7, 0x71, 0xD7, 0x20, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E,
+    0x71, 0xAD, 0xA1, 0xF7, 0xAE, 0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74,
+    0x99, 0x97, 0x77, 0x72, 0xAC, 0x77, 0xAE, 0x76, 0xAE, 0x77, 0xAC, 0x70, 0x9D, 0xA7, 0x0D, 0xA9,
+    0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA,
+    0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x70, 0xE9, 0xDA, 0x79,
+    0xE9, 0xDA, 0x7A, 0xE0, 0xE7, 0xF0, 0xE9, 0x5A, 0xF0, 0xAE, 0xA2, 0x9A, 0xFC, 0x1F, 0xFD, 0x0E,
+    0x2A, 0xFD, 0xA1, 0xAD, 0x59, 0x97, 0x77, 0x59, 0xCA, 0x74, 0xE9, 0x73, 0xE9, 0x73, 0x9C, 0xA6,
+    0x6E, 0xA7, 0x6F, 0xC9, 0x77, 0xDA, 0x77, 0xAD, 0x76, 0x9D, 0x97, 0x5E, 0x97, 0x6D, 0x77, 0x0D,
+    0x77, 0x73, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A,
+    0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9,
+    0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7,
+    0x3A, 0xD9, 0xE7, 0x3A, 0xD9, 0xE7, 0x3E, 0x0A, 0xDA, 0x72, 0xE0, 0x9E, 0x71, 0xAD, 0xA1, 0xF7,
+    0xAE, 0x3F, 0xA9, 0x99, 0x9A, 0xF9, 0x4F, 0xFF, 0x96, 0x9F, 0xFA, 0x74, 0x99, 0x97, 0x59, 0x99,
+    0x73, 0x9F, 0xA7, 0x29, 0x9A, 0xDA, 0x74, 0xAC, 0xA7, 0x4D, 0xA7, 0x2A, 0xE7, 0x3D, 0x97, 0x4D,
+    0x75, 0x99, 0x77, 0x69, 0xDA, 0x70, 0xDA, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E,
+    0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D,
+    0xA7, 0x0E, 0x9D, 0xA7, 0x0E, 0x9D, 0xA7, 0x9E, 0x9D, 0xA7, 0xAE, 0x0E, 0x7F, 0x0E, 0x95, 0xAF,
+    0x0A, 0xEA, 0x29, 0xAF, 0xC1, 0xFF, 0xD0, 0xE2, 0xAF, 0xDA, 0x1A, 0xD5, 0x99, 0x70, 0x71, 0x9A,
+    0xA9, 0x77, 0x4E, 0x97, 0x73, 0xEA, 0x77, 0x39, 0xDA, 0x77, 0x4D, 0xA7, 0x74, 0xAC, 0x97, 0x77,
+    0x73, 0x99, 0x97, 0x75, 0xE0, 0xE7, 0x3A, 0xD9, 0x1E, 0x0E, 0x73, 0xAD, 0x90, 0x9D, 0xA0, 0xE7,
+    0x3A, 0xD9, 0x0E, 0x1E, 0x73, 0xAF, 0xD9, 0x1E, 0x73, 0xAF, 0xC3, 0xE7, 0x3A, 0xDA, 0x5E, 0x73,
+    0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95,
+    0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A,
+    0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3E, 0x6A, 0xDA, 0x72, 0xE7, 0xE7, 0x1A, 0xDA, 0x7A, 0xE7,
+    0xAE, 0x71, 0xFA, 0x99, 0x99, 0xAF, 0x97, 0x2F, 0xFF, 0x97, 0x49, 0xFF, 0xA7, 0x72, 0x99, 0x97,
+    0x50, 0x70, 0x9A, 0xAA, 0x77, 0x1E, 0x97, 0x70, 0xAD, 0xA7, 0x70, 0x9D, 0xA7, 0x71, 0xDA, 0x77,
+    0x19, 0xCA, 0x70, 0x9A, 0xA9, 0x77, 0x1E, 0x97, 0x71, 0xE0, 0x9D, 0x97, 0x0D, 0xA1, 0xE0, 0x9D,
+    0xA7, 0x0E, 0x0E, 0x90, 0x9D, 0xA7, 0x0F, 0xDA, 0x19, 0xDA, 0x70, 0xFC, 0x92, 0x9D, 0xA7, 0x0E,
+    0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA,
+    0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x79, 0xE5, 0x9D, 0xA7, 0xAE, 0x6E, 0x7F, 0x6E, 0x95,
+    0xAF, 0x6A, 0xEA, 0x29, 0xAF, 0xC7, 0xFF, 0xD0, 0xE7, 0x0A, 0xFD, 0xA1, 0xAD, 0x73, 0x99, 0x75,
+    0x4A, 0xAA, 0x97, 0x74, 0xAE, 0x77, 0x5E, 0x97, 0x75, 0xE7, 0x76, 0xE7, 0x76, 0xAC, 0x97, 0x77,
+    0x71, 0x99, 0x97, 0x75, 0xE0, 0xE7, 0x3A, 0xD9, 0x1E, 0x0E, 0x73, 0xAD, 0x90, 0x9D, 0xA0, 0xE7,
+    0x3A, 0xD9, 0x0E, 0x1E, 0x73, 0xAF, 0xD9, 0x1E, 0x73, 0xAF, 0xC3, 0xE7, 0x3A, 0xDA, 0x5E, 0x73,
+    0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95,
+    0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A,
+    0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3E, 0x6A, 0xDA, 0x72, 0xE7, 0xE7, 0x1A, 0xDA, 0x7A, 0xE7,
+    0xAE, 0x71, 0xFA, 0x99, 0x99, 0xAF, 0x97, 0x2F, 0xFF, 0x97, 0x49, 0xFF, 0xA7, 0x72, 0x99, 0x97,
+    0x50, 0x3A, 0xAA, 0x97, 0x71, 0xAE, 0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x77, 0x3E, 0x77, 0x3A, 0xC9,
+    0x69, 0xAA, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x09, 0xD9, 0x70, 0xDA, 0x1E, 0x09, 0xDA, 0x70, 0xE0,
+    0xE9, 0x09, 0xDA, 0x70, 0xFD, 0xA1, 0x9D, 0xA7, 0x0F, 0xC9, 0x29, 0xDA, 0x70, 0xE5, 0x9D, 0xA7,
+    0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59,
+    0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x9E, 0x59, 0xDA, 0x7A, 0xE6, 0xE7, 0xF6, 0xE9, 0x5A, 0xF6, 0xAE,
+    0xA2, 0x9A, 0xFC, 0x7F, 0xFD, 0x0E, 0x70, 0xAF, 0xDA, 0x1A, 0xD7, 0x39, 0x97, 0x50, 0x6E, 0xA9,
+    0x77, 0x3F, 0xCA, 0x77, 0x5A, 0xD7, 0x75, 0x9D, 0x77, 0x49, 0xDA, 0x77, 0x3E, 0xA7, 0x74, 0xD9,
+    0x77, 0x5A, 0xC7, 0x29, 0x99, 0x77, 0x5E, 0x0E, 0x73, 0xAD, 0x91, 0xE0, 0xE7, 0x3A, 0xD9, 0x09,
+    0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE1, 0xE7, 0x3A, 0xFD, 0x91, 0xE7, 0x3A, 0xFC, 0x3E, 0x73, 0xAD,
+    0xA5, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7,
+    0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9,
+    0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xE6, 0xAD, 0xA7, 0x2E, 0x7E, 0x71, 0xAD,
+    0xA7, 0xAE, 0x7A, 0xE7, 0x1F, 0xA9, 0x99, 0x9A, 0xF9, 0x72, 0xFF, 0xF9, 0x74, 0x9F, 0xFA, 0x77,
+    0x29, 0x99, 0x75, 0x59, 0x99, 0x77, 0x2F, 0xC7, 0x70, 0x99, 0xAD, 0xA7, 0x72, 0x9D, 0x77, 0x2A,
+    0xCA, 0x77, 0x0A, 0xE7, 0x71, 0xDA, 0x77, 0x2D, 0x70, 0x9A, 0xA9, 0x69, 0x97, 0x0E, 0x97, 0x71,
+    0xE0, 0x9D, 0x97, 0x0D, 0xA1, 0xE0, 0x9D, 0xA7, 0x0E, 0x0E, 0x90, 0x9D, 0xA7, 0x0F, 0xDA, 0x19,
+    0xDA, 0x70, 0xFC, 0x92, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA,
+    0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x79, 0xE5,
+    0x9D, 0xA7, 0xAE, 0x6E, 0x7F, 0x6E, 0x95, 0xAF, 0x6A, 0xEA, 0x29, 0xAF, 0xC7, 0xFF, 0xD0, 0xE7,
+    0x0A, 0xFD, 0xA1, 0xAD, 0x73, 0x99, 0x75, 0x59, 0x95, 0xA7, 0x5A, 0xF9, 0x2A, 0xC7, 0x49, 0xFE,
+    0xAA, 0xD7, 0x4A, 0xC9, 0x1A, 0xFC, 0x75, 0xAA, 0x4A, 0xAA, 0x77, 0x77, 0x09, 0x99, 0x77, 0x5E,
+    0x0E, 0x73, 0xAD, 0x91, 0xE0, 0xE7, 0x3A, 0xD9, 0x09, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xE1, 0xE7,
+    0x3A, 0xFD, 0x91, 0xE7, 0x3A, 0xFC, 0x3E, 0x73, 0xAD, 0xA5, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD,
+    0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7,
+    0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9,
+    0x5E, 0x73, 0xE6, 0xAD, 0xA7, 0x2E, 0x7E, 0x71, 0xAD, 0xA7, 0xAE, 0x7A, 0xE7, 0x1F, 0xA9, 0x99,
+    0x9A, 0xF9, 0x72, 0xFF, 0xF9, 0x74, 0x9F, 0xFA, 0x77, 0x29, 0x99, 0x75, 0x49, 0x95, 0xA7, 0x29,
+    0xFA, 0x2A, 0xC7, 0x2F, 0xEA, 0xAD, 0x71, 0xAC, 0x91, 0x9F, 0xC9, 0x71, 0xAC, 0x4A, 0xAA, 0x94,
+    0x9A, 0xA9, 0x77, 0x1E, 0x97, 0x71, 0xE0, 0x9D, 0x97, 0x0D, 0xA1, 0xE0, 0x9D, 0xA7, 0x0E, 0x0E,
+    0x90, 0x9D, 0xA7, 0x0F, 0xDA, 0x19, 0xDA, 0x70, 0xFC, 0x92, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70,
+    0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D,
+    0xA7, 0x0E, 0x59, 0xDA, 0x79, 0xE5, 0x9D, 0xA7, 0xAE, 0x6E, 0x7F, 0x6E, 0x95, 0xAF, 0x6A, 0xEA,
+    0x29, 0xAF, 0xC7, 0xFF, 0xD0, 0xE7, 0x0A, 0xFD, 0xA1, 0xAD, 0x73, 0x99, 0x75, 0x77, 0x49, 0x99,
+    0x77, 0x5E, 0x0E, 0x73, 0xAD, 0x91, 0xE0, 0xE7, 0x3A, 0xD9, 0x09, 0xDA, 0x0E, 0x73, 0xAD, 0x90,
+    0xE1, 0xE7, 0x3A, 0xFD, 0x91, 0xE7, 0x3A, 0xFC, 0x3E, 0x73, 0xAD, 0xA5, 0xE7, 0x3A, 0xD9, 0x5E,
+    0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD,
+    0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7, 0x3A, 0xD9, 0x5E, 0x73, 0xAD, 0x95, 0xE7,
+    0x3A, 0xD9, 0x5E, 0x73, 0xE6, 0xAD, 0xA7, 0x2E, 0x7E, 0x71, 0xAD, 0xA7, 0xAE, 0x7A, 0xE7, 0x1F,
+    0xA9, 0x99, 0x9A, 0xF9, 0x72, 0xFF, 0xF9, 0x74, 0x9F, 0xFA, 0x77, 0x29, 0x99, 0x77, 0x77, 0x76,
+    0xAC, 0x97, 0x74, 0x9E, 0x77, 0x49, 0xE7, 0x75, 0xAC, 0x97, 0x50, 0x77, 0x19, 0xAA, 0x97, 0x71,
+    0xE9, 0x77, 0x1E, 0x09, 0xD9, 0x70, 0xDA, 0x1E, 0x09, 0xDA, 0x70, 0xE0, 0xE9, 0x09, 0xDA, 0x70,
+    0xFD, 0xA1, 0x9D, 0xA7, 0x0F, 0xC9, 0x29, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70,
+    0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D, 0xA7, 0x0E, 0x59, 0xDA, 0x70, 0xE5, 0x9D,
+    0xA7, 0x9E, 0x59, 0xDA, 0x7A, 0xE6, 0xE7, 0xF6, 0xE9, 0x5A, 0xF6, 0xAE, 0xA2, 0x9A, 0xFC, 0x7F,
+    0xFD, 0x0E, 0x70, 0xAF, 0xDA, 0x1A, 0xD7, 0x39, 0x97, 0x77, 0x77, 0x19, 0xCA, 0x77, 0x2E, 0x97,
+    0x71, 0xE9, 0x77, 0x19, 0xCA, 0x74, 0x49, 0xAA, 0x97, 0x69, 0xE7, 0x7A, 0xDA, 0x77, 0xAD, 0x97,
+    0x7A, 0xD7, 0x70, 0xAC, 0xA7, 0x77, 0x77, 0x4A, 0xD9, 0x72, 0x9D, 0xA9, 0xE7, 0x2E, 0x1E, 0x97,
+    0x0A, 0xDA, 0x2E, 0x70, 0xE3, 0xAD, 0xA6, 0xAD, 0xA4, 0xE6, 0xE5, 0xAD, 0xA4, 0xAD, 0x96, 0xE4,
+    0xE7, 0xAD, 0xA2, 0xE9, 0x70, 0xE1, 0x9E, 0x71, 0x9D, 0xA0, 0xE9, 0x72, 0xEA, 0xDA, 0x73, 0x9F,
+    0xC7, 0x5F, 0xA7, 0x59, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x70, 0x39, 0xAA, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5A, 0xD9, 0x75, 0xAD, 0x76, 0x9C,
+    0xA7, 0x77, 0x77, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1, 0xAD, 0x96,
+    0x9D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4, 0xE5, 0xAD, 0x93, 0xE6,
+    0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9, 0x70, 0xAD, 0x0E, 0x72,
+    0xDA, 0xDA, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E,
+    0x74, 0xE9, 0x79, 0x99, 0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0x97, 0x20, 0xAD, 0x97, 0x29, 0xDA,
+    0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAD, 0xA2, 0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A,
+    0xDA, 0x4A, 0xD9, 0x6E, 0x4E, 0x7A, 0xDA, 0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97,
+    0x2E, 0xAD, 0xA7, 0x39, 0xFC, 0x75, 0xFA, 0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x77, 0x77, 0x75, 0xAC, 0x97, 0x69, 0xE7, 0x69, 0xE7,
+    0x7A, 0xC9, 0x70, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1, 0xAD, 0x96,
+    0x9D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4, 0xE5, 0xAD, 0x93, 0xE6,
+    0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9, 0x70, 0xAD, 0x0E, 0x72,
+    0xDA, 0xDA, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x90, 0x9C,
+    0xA7, 0x0E, 0x1E, 0xA6, 0xE9, 0x1E, 0xA1, 0x99, 0x9A, 0xEA, 0x29, 0xCA, 0x2A, 0xFD, 0x71, 0xAF,
+    0x97, 0x20, 0x6A, 0xDA, 0x97, 0x5F, 0xCA, 0x77, 0xAD, 0x77, 0x0D, 0x76, 0x9E, 0x75, 0xEA, 0x76,
+    0xAC, 0x97, 0x7A, 0xC7, 0x77, 0x3A, 0xD9, 0x72, 0x9D, 0xA9, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xDA,
+    0x2E, 0x70, 0xE3, 0xAD, 0xA6, 0xAD, 0xA4, 0xE6, 0xE5, 0xAD, 0xA4, 0xAD, 0x96, 0xE4, 0xE7, 0xAD,
+    0xA2, 0xE9, 0x70, 0xE1, 0x9E, 0x71, 0x9D, 0xA0, 0xE9, 0x72, 0xEA, 0xDA, 0x73, 0x9F, 0xC7, 0x5F,
+    0xA7, 0x59, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x70, 0x59, 0x99, 0x75, 0xFC, 0x73, 0x99, 0xAE, 0x75, 0x9D, 0x75, 0xAD, 0x73, 0x9E, 0x97, 0x3A,
+    0xCA, 0x75, 0xAC, 0x97, 0x69, 0x77, 0x70, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E,
+    0x70, 0xE1, 0xAD, 0x96, 0x9D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4,
+    0xE5, 0xAD, 0x93, 0xE6, 0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9,
+    0x70, 0xAD, 0x0E, 0x72, 0xDA, 0xDA, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA,
+    0x74, 0xAD, 0x97, 0x4E, 0x74, 0xE9, 0x79, 0x99, 0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0x97, 0x20,
+    0x59, 0x95, 0xA7, 0x9F, 0xA2, 0xAC, 0x96, 0xFE, 0xAA, 0xD6, 0x9C, 0xA1, 0x9F, 0xC9, 0x6A, 0xC4,
+    0x9A, 0xA9, 0x77, 0x77, 0x72, 0xAD, 0x97, 0x29, 0xDA, 0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAD, 0xA2,
+    0xE7, 0x0E, 0x3A, 0xDA, 0x6A, 0xDA, 0x4E, 0x6E, 0x5A, 0xDA, 0x4A, 0xD9, 0x6E, 0x4E, 0x7A, 0xDA,
+    0x2E, 0x97, 0x0E, 0x19, 0xE7, 0x19, 0xDA, 0x0E, 0x97, 0x2E, 0xAD, 0xA7, 0x39, 0xFC, 0x75, 0xFA,
+    0x75, 0x9E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7,
+    0x49, 0x95, 0xA9, 0x49, 0xFA, 0x29, 0xC9, 0x4F, 0xEA, 0xAD, 0x49, 0xCA, 0x19, 0xFC, 0xA4, 0x9C,
+    0x49, 0xAA, 0x97, 0x77, 0x75, 0xAD, 0x97, 0x09, 0xDA, 0x9D, 0xA7, 0x0A, 0xD9, 0x0E, 0x70, 0xE1,
+    0xAD, 0x96, 0x9D, 0xA2, 0xE6, 0xAD, 0x92, 0xE6, 0xE3, 0x9D, 0xA4, 0x9D, 0xA4, 0xE4, 0xE5, 0xAD,
+    0x93, 0xE6, 0xDA, 0x2A, 0xD9, 0x6E, 0x2E, 0x79, 0xD9, 0x1D, 0xA7, 0x0E, 0x0A, 0xD9, 0x70, 0xAD,
+    0x0E, 0x72, 0xDA, 0xDA, 0x72, 0xFC, 0x73, 0x9F, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xAD,
+    0x97, 0x4E, 0x74, 0xE9, 0x79, 0x99, 0xAE, 0xA7, 0x0A, 0xFD, 0x71, 0xAF, 0x97, 0x20, 0x3C, 0x7D,
+    0x7D, 0x1A, 0xFE, 0x0A, 0xC2, 0xD1, 0xAA, 0x1A, 0xC2, 0xAA, 0x1C, 0x3A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x96, 0x3C, 0x6C, 0xA5, 0xD5, 0xFE,
+    0xA1, 0xCA, 0x2C, 0xA2, 0xCA, 0x1A, 0xA3, 0xC1, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0x70, 0xAF, 0xE9, 0xAF, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x00, 0x70, 0xAF, 0xE9, 0xAF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x0A, 0xFF,
+    0xFE, 0xAA, 0xFF, 0xFE, 0xA0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x76, 0xAF, 0xFF,
+    0xC9, 0xAF, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x76, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x77, 0x76, 0xAF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x09, 0x59, 0x90, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A,
+    0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39,
+    0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC,
+    0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D,
+    0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA,
+    0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0,
+    0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3,
+    0x9D, 0x0A, 0xCA, 0x39, 0xD0, 0xAC, 0xA3, 0x9D, 0x73, 0x77, 0xFF, 0xFD, 0x0F, 0xFF, 0xD7, 0x77,
+    0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xFD, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x90, 0x2A, 0xC9, 0x19, 0xD2, 0xAD, 0x2D, 0xA1, 0x9D, 0x91, 0xE9, 0x1E, 0x19, 0xE2, 0x99,
+    0x91, 0x1E, 0x91, 0xE1, 0x9E, 0x1A, 0xDA, 0x1A, 0xD2, 0xE2, 0xD9, 0x19, 0xD3, 0x93, 0x09, 0xE1,
+    0xAE, 0x1A, 0xD9, 0x1E, 0x2E, 0x19, 0xD9, 0x1A, 0xD2, 0xAC, 0xA2, 0x99, 0x30, 0x9D, 0xA1, 0x9E,
+    0x2E, 0x2A, 0xD9, 0x19, 0xDA, 0x2E, 0x2A, 0xD3, 0xD9, 0x29, 0x90, 0x2A, 0xC3, 0xAC, 0x91, 0x9D,
+    0x3D, 0x91, 0xAD, 0x2A, 0xD2, 0xDA, 0x2E, 0x19, 0xD9, 0x19, 0xDA, 0x1E, 0x2A, 0xD9, 0x1E, 0x2E,
+    0x19, 0xE1, 0x9E, 0x29, 0x99, 0x29, 0x99, 0x10, 0x1E, 0x91, 0xAD, 0x91, 0xE2, 0xE9, 0x09, 0xE2,
+    0xE1, 0xAD, 0x91, 0x9D, 0xA1, 0xAD, 0x2A, 0xD9, 0x1D, 0xA2, 0xE2, 0xD9, 0x2D, 0xA1, 0x9D, 0x29,
+    0xD3, 0x94, 0x99, 0x20, 0x09, 0xE2, 0xE1, 0xAE, 0x19, 0xE1, 0xAD, 0x91, 0xAD, 0xA1, 0xE2, 0xE9,
+    0x1E, 0x2E, 0x19, 0xD9, 0x2D, 0xA1, 0xAD, 0x29, 0xD2, 0xAC, 0xA2, 0xAC, 0xA2, 0x99, 0x39, 0x93,
+    0x9D, 0xA1, 0x9E, 0x19, 0xE2, 0xE2, 0xE2, 0xE9, 0x1A, 0xD9, 0x1A, 0xD9, 0x19, 0xDA, 0x2D, 0xA2,
+    0xDA, 0x2E, 0x2A, 0xD2, 0x9D, 0x3D, 0x3D, 0x92, 0x99, 0x39, 0x90, 0x49, 0x99, 0x71, 0xE7, 0x1E,
+    0x71, 0xDA, 0x71, 0xDA, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x4E, 0xAA, 0xDA, 0xAA, 0xFF, 0xFF, 0xAC,
+    0xAA, 0x9A, 0xCA, 0x9A, 0xAD, 0x4A, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x1A,
+    0xC9, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x40, 0x49, 0x99, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2A, 0xCA, 0x72, 0xAC,
+    0xA5, 0xA9, 0x99, 0x0A, 0xCA, 0x09, 0x99, 0xA0, 0xFF, 0xFC, 0x0F, 0xFF, 0xC5, 0xAC, 0x97, 0x2A,
+    0xCA, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xDA, 0x72, 0xAC, 0xA5, 0x99, 0x91, 0xAC, 0x91,
+    0x99, 0x90, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x93, 0x9C, 0x93, 0x95, 0xAC, 0xA7, 0x2D, 0xA7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x50, 0x39, 0x39, 0xFA, 0x1F, 0xD9, 0x9F, 0xE9, 0xFE, 0x9F, 0xE0, 0xFD, 0xA0,
+    0xFD, 0x91, 0xAE, 0x90, 0x70, 0xAA, 0x6A, 0xD9, 0x4A, 0xF9, 0x2A, 0xFD, 0x1A, 0xFE, 0x9A, 0xFD,
+    0x90, 0xAF, 0xA2, 0xAD, 0xA4, 0xAC, 0x77, 0x5D, 0xA0, 0xAE, 0x9A, 0xE9, 0x9E, 0x19, 0x91, 0x76,
+    0xE5, 0xDA, 0x0A, 0xE9, 0x3A, 0xE9, 0xAE, 0xA3, 0xAE, 0x99, 0xE4, 0x9E, 0x29, 0x69, 0x91, 0x77,
+    0x6E, 0x49, 0xDA, 0x4A, 0xD9, 0xAE, 0x93, 0xF4, 0xFA, 0xEA, 0x3F, 0x4F, 0x9E, 0x4A, 0xE4, 0xEA,
+    0x19, 0x69, 0x96, 0x99, 0x00, 0x5E, 0x0A, 0xE9, 0xAE, 0xA9, 0xE2, 0x91, 0x70, 0xAF, 0xE0, 0xAC,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6,
+    0xAA, 0x69, 0x96, 0x71, 0xFE, 0xA6, 0xCA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA,
+    0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A,
+    0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x6A, 0xA6, 0xAA, 0x69, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59,
+    0x92, 0xFF, 0xCA, 0x99, 0x99, 0x99, 0xC9, 0x5C, 0x95, 0xC9, 0x5C, 0xA5, 0xFF, 0x2A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xFF, 0x99, 0x99,
+    0x99, 0xAC, 0x59, 0xC5, 0x9C, 0x59, 0xC5, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x77, 0x77, 0x7A, 0xEA, 0x71, 0xD9, 0x77,
+    0x1F, 0xE7, 0xAD, 0x77, 0x1A, 0xD9, 0x1D, 0xA6, 0xD9, 0x77, 0x1D, 0xA2, 0x9D, 0x5A, 0xD7, 0x72,
+    0xD9, 0x3D, 0x5D, 0x97, 0x71, 0x9D, 0x4D, 0x93, 0xE7, 0x72, 0x9D, 0x4D, 0x92, 0x9D, 0x77, 0x39,
+    0xD4, 0xD9, 0x2D, 0xA7, 0x73, 0x9D, 0x4D, 0x91, 0x9D, 0x77, 0x5D, 0x4D, 0x91, 0xDA, 0x19, 0xAA,
+    0x97, 0x9A, 0xA4, 0xD9, 0x29, 0xD1, 0xAD, 0x1F, 0xD4, 0x9F, 0xCA, 0x2A, 0xCA, 0x2A, 0xD1, 0xD9,
+    0x0A, 0xDA, 0xAE, 0x3E, 0xAA, 0xD9, 0x19, 0xDA, 0x9A, 0xD9, 0x0A, 0xD1, 0xD9, 0x2D, 0x91, 0xAD,
+    0x2A, 0xD2, 0xAF, 0xCA, 0x1D, 0x90, 0x9D, 0x3D, 0xA1, 0xDA, 0x3D, 0x39, 0xAC, 0xA9, 0x1E, 0x1A,
+    0xD3, 0xAD, 0x1D, 0x93, 0xD9, 0x70, 0x9D, 0x2A, 0xCA, 0x39, 0xD1, 0xD4, 0xDA, 0x70, 0xDA, 0x2D,
+    0xA3, 0x9D, 0x09, 0xD4, 0xDA, 0x79, 0xD3, 0xDA, 0x39, 0xD0, 0x9D, 0x4D, 0xA7, 0xDA, 0x3A, 0xCA,
+    0x39, 0xD1, 0xD4, 0xDA, 0x6A, 0xD4, 0xAD, 0x3A, 0xD1, 0xD9, 0x3D, 0x96, 0xD9, 0x49, 0xD3, 0xDA,
+    0x1D, 0xA2, 0x9D, 0x6A, 0xD6, 0xDA, 0x19, 0xD9, 0x19, 0xD2, 0xE6, 0xD9, 0x69, 0xFD, 0xA3, 0xFE,
+    0x95, 0xE7, 0x09, 0xFA, 0x5F, 0xC9, 0x77, 0x49, 0x97, 0x19, 0x40, 0x77, 0x77, 0x77, 0x3A, 0xEA,
+    0x71, 0xAC, 0xA7, 0x77, 0x5F, 0xE7, 0x9D, 0x77, 0x75, 0xAD, 0x90, 0x9D, 0xA6, 0xDA, 0x77, 0x75,
+    0xDA, 0x2A, 0xD5, 0x9D, 0x77, 0x75, 0x9D, 0x93, 0xD9, 0x4D, 0xA7, 0x77, 0x59, 0xD4, 0xDA, 0x3A,
+    0xD7, 0x77, 0x69, 0xD4, 0xDA, 0x3D, 0x97, 0x77, 0x69, 0xD4, 0xDA, 0x2A, 0xD7, 0x77, 0x79, 0xD4,
+    0xDA, 0x2D, 0x97, 0x77, 0x79, 0xD4, 0xD9, 0x1D, 0xA2, 0x9A, 0x97, 0x9A, 0xA9, 0x79, 0xAA, 0x93,
+    0xD9, 0x29, 0xD9, 0x09, 0xD1, 0xAF, 0xCA, 0x4F, 0xD9, 0x39, 0xFD, 0x2E, 0x2A, 0xD1, 0xDA, 0x09,
+    0xEA, 0xE9, 0x2A, 0xEA, 0xE3, 0xEA, 0xEA, 0x19, 0xDA, 0x9A, 0xDA, 0x09, 0xD1, 0xE2, 0xE2, 0xDA,
+    0x19, 0xDA, 0x1A, 0xD9, 0x1A, 0xD2, 0xAF, 0xD1, 0xDA, 0x1D, 0x92, 0x9D, 0x19, 0xD3, 0xAD, 0x1E,
+    0x3D, 0xA2, 0x9A, 0xCA, 0x91, 0xAD, 0x19, 0xD4, 0xD9, 0x0A, 0xD3, 0x9D, 0x1D, 0xA3, 0xDA, 0x71,
+    0xD9, 0x19, 0xD4, 0xDA, 0x0E, 0x39, 0xD1, 0xD9, 0x3A, 0xD7, 0x0A, 0xD2, 0x9D, 0x4D, 0xA0, 0xDA,
+    0x39, 0xD9, 0x0D, 0x93, 0xAD, 0x70, 0xD9, 0x29, 0xD4, 0xDA, 0x0D, 0xA3, 0x9D, 0x90, 0xD9, 0x3A,
+    0xD7, 0xE3, 0x9D, 0x4D, 0xA0, 0xAD, 0x39, 0xD1, 0xD9, 0x3A, 0xD6, 0x9D, 0x49, 0xD9, 0x3D, 0x90,
+    0xAD, 0x3A, 0xD1, 0xDA, 0x3D, 0xA6, 0xDA, 0x5D, 0xA2, 0x9D, 0x19, 0xD3, 0xE1, 0xAD, 0x3D, 0x95,
+    0x9D, 0x6A, 0xD2, 0xE2, 0xDA, 0x19, 0xD9, 0x19, 0xD9, 0x1A, 0xD6, 0xDA, 0x7F, 0xE9, 0x29, 0xFE,
+    0x3F, 0xEA, 0x5A, 0xD7, 0x1F, 0xC9, 0x49, 0xFC, 0x5A, 0xFA, 0x77, 0x59, 0x71, 0x99, 0x71, 0x99,
+    0x30, 0x39, 0xD9, 0x3E, 0x3A, 0xD4, 0xDA, 0x3A, 0xD4, 0xD9, 0x3A, 0xCA, 0x4D, 0x49, 0xC9, 0x40,
+    0x39, 0xD9, 0x1A, 0xD4, 0xE2, 0xDA, 0x3A, 0xD2, 0xAD, 0x4D, 0xA2, 0xD9, 0x3A, 0xD2, 0xAD, 0x4D,
+    0x92, 0xD4, 0xAC, 0xA2, 0xAC, 0xA4, 0xD3, 0xD4, 0x9C, 0x92, 0xAC, 0x94, 0x39, 0xD9, 0x1A, 0xD2,
+    0xAD, 0x4E, 0x2D, 0xA1, 0x9D, 0xA3, 0xAD, 0x2A, 0xD2, 0xE4, 0xDA, 0x2D, 0x91, 0x9D, 0x93, 0xAD,
+    0x2A, 0xD2, 0xDA, 0x4D, 0x92, 0xD2, 0x9D, 0x4A, 0xCA, 0x2A, 0xCA, 0x2D, 0x94, 0xD3, 0xD2, 0x9D,
+    0x49, 0xC9, 0x2A, 0xC9, 0x2A, 0xC5, 0x9D, 0x94, 0xE4, 0x9D, 0x94, 0xE5, 0xD9, 0x4A, 0xD5, 0xD9,
+    0x49, 0xD5, 0xAC, 0x00, 0x9D, 0x91, 0xDA, 0x4E, 0x1A, 0xD4, 0x9D, 0x91, 0xDA, 0x4E, 0x19, 0xD5,
+    0xD9, 0x1A, 0xCA, 0x4A, 0xD2, 0xD5, 0xD9, 0x1A, 0xCA, 0x49, 0xD2, 0xD5, 0xAC, 0x29, 0xCA, 0x9D,
+    0x91, 0xDA, 0x1A, 0xD5, 0xE1, 0xAD, 0x2D, 0xA4, 0x9D, 0x91, 0xDA, 0x1A, 0xD5, 0xE1, 0x9D, 0x2D,
+    0xA5, 0xD9, 0x1A, 0xCA, 0x19, 0xD5, 0xAD, 0x2D, 0x2A, 0xCA, 0x5D, 0x91, 0xAC, 0xA2, 0xD5, 0x9D,
+    0x2D, 0x29, 0xCA, 0x5A, 0xC2, 0x9C, 0xA2, 0xAC, 0x00, 0x5A, 0x97, 0x1A, 0xD7, 0x1E, 0x97, 0xAC,
+    0x9D, 0x7D, 0x0A, 0xC9, 0x5A, 0xC9, 0x1D, 0x5D, 0x2A, 0xC9, 0x3A, 0xC9, 0x3D, 0x3D, 0x4A, 0xC9,
+    0x1A, 0xC9, 0x5D, 0x1D, 0x6A, 0xC9, 0x59, 0x6D, 0xA4, 0xE4, 0xAD, 0x93, 0xAD, 0xA3, 0x9D, 0xA3,
+    0x9E, 0x4A, 0xDA, 0x5E, 0x95, 0xE9, 0x5E, 0x59, 0xE5, 0x9D, 0xA5, 0xAC, 0x72, 0x19, 0x49, 0xD9,
+    0x4E, 0x5E, 0x49, 0xE4, 0x9D, 0xA4, 0xAD, 0xA3, 0x9E, 0x3E, 0x3E, 0x92, 0xAD, 0x92, 0xAD, 0xA2,
+    0x9D, 0xA4, 0xAC, 0x74, 0x77, 0x73, 0x97, 0xAD, 0x97, 0x92, 0xAD, 0x6E, 0xA6, 0xD9, 0x19, 0xE5,
+    0xEA, 0x5E, 0x39, 0xE4, 0x9C, 0xA5, 0xE5, 0x9E, 0x73, 0xE7, 0x9E, 0x71, 0xE7, 0x19, 0xE7, 0xE7,
+    0x39, 0xE5, 0xE7, 0x59, 0xE3, 0xE7, 0x79, 0xE1, 0xE7, 0x19, 0xA9, 0x49, 0xFD, 0x5A, 0xA9, 0x1E,
+    0x59, 0xF5, 0x9E, 0x09, 0xE9, 0x5F, 0x59, 0xE1, 0xE5, 0xFD, 0x5E, 0x71, 0xE0, 0x9E, 0x77, 0x0E,
+    0x29, 0xE7, 0x6E, 0x49, 0xE7, 0x4E, 0x69, 0xDA, 0x72, 0xE7, 0x09, 0xDA, 0x70, 0xE7, 0x29, 0xDA,
+    0x6E, 0x59, 0x94, 0x9D, 0xA4, 0xE5, 0xE9, 0x49, 0xDA, 0x2A, 0xD6, 0xEA, 0x59, 0xD9, 0x2A, 0x7E,
+    0x96, 0x9A, 0x75, 0x99, 0x73, 0x0E, 0x39, 0xDA, 0x1E, 0x3A, 0xE1, 0xE3, 0xAE, 0x1E, 0x39, 0xE1,
+    0xE3, 0x9D, 0xA1, 0xE3, 0x9D, 0xA1, 0xE3, 0x9D, 0xA1, 0xE3, 0x9D, 0xA1, 0xE4, 0xDA, 0x1E, 0x4D,
+    0x91, 0xE4, 0xD9, 0x1D, 0xA4, 0xD9, 0x1A, 0xCA, 0x4D, 0x91, 0xAC, 0xA4, 0xD9, 0x1A, 0xCA, 0x4D,
+    0x2A, 0xCA, 0x4D, 0x2A, 0xC9, 0x4D, 0x39, 0x69, 0x77, 0x74, 0xE3, 0x9D, 0xA0, 0xAE, 0x92, 0xF0,
+    0xAE, 0xA2, 0xF0, 0x9E, 0x3A, 0xE2, 0x95, 0x99, 0x10, 0x77, 0x9A, 0xFD, 0x93, 0xFF, 0xE2, 0xDA,
+    0xE1, 0xAE, 0x4A, 0xD2, 0x9D, 0x93, 0xAD, 0x3D, 0xA3, 0xAD, 0x3E, 0x3A, 0xD3, 0xDA, 0x3A, 0xD3,
+    0xDA, 0x39, 0xD2, 0xAD, 0x49, 0xD1, 0x9D, 0xA4, 0x9D, 0x0A, 0xDA, 0x59, 0xDA, 0xDA, 0x69, 0xF9,
+    0x79, 0xE9, 0x71, 0xDA, 0x72, 0xD9, 0x72, 0xD9, 0x77, 0x77, 0x77, 0x4A, 0xA7, 0x2A, 0xE7, 0x1F,
+    0x71, 0x9D, 0xA7, 0x29, 0x96, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF,
+    0xFC, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x97, 0x6C, 0x1D, 0x75, 0xAC,
+    0x2D, 0x73, 0xAC, 0x92, 0x9D, 0x71, 0xAC, 0xA4, 0x9D, 0xA5, 0x9D, 0xA7, 0xFF, 0xD9, 0x71, 0x9A,
+    0xFA, 0x95, 0x79, 0x99, 0x97, 0x49, 0xFF, 0x97, 0x0A, 0xEA, 0x99, 0x9A, 0xE6, 0xDA, 0x79, 0xD4,
+    0xAC, 0x97, 0x2D, 0x29, 0xC9, 0x74, 0xCA, 0x1D, 0x75, 0x9C, 0x90, 0x97, 0x79, 0x00, 0x71, 0x99,
+    0x70, 0xAC, 0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x97, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x70, 0xAC,
+    0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x70, 0x9D, 0x70, 0xE9, 0x7F, 0x6A, 0xC9, 0xAC, 0x95, 0xD1,
+    0xD4, 0xAC, 0xA1, 0xAC, 0x4D, 0x29, 0xCA, 0x29, 0xCA, 0x3D, 0x2D, 0x93, 0x9C, 0xA0, 0x9D, 0x5D,
+    0x00, 0x77, 0x09, 0x99, 0x77, 0x77, 0x1E, 0x77, 0x77, 0x1E, 0x77, 0x77, 0x1A, 0xD7, 0x77, 0x71,
+    0xAD, 0x77, 0x73, 0x99, 0x3A, 0xCA, 0x39, 0xA7, 0x75, 0xFA, 0x99, 0xCA, 0x09, 0xF7, 0x75, 0xFF,
+    0xFE, 0x97, 0x74, 0x99, 0xAA, 0xAF, 0xCA, 0xAA, 0xA9, 0x77, 0x72, 0xAF, 0x77, 0x76, 0x9D, 0x9D,
+    0xA7, 0x77, 0x5E, 0x0A, 0xD9, 0x77, 0x73, 0xE9, 0x1E, 0x77, 0x72, 0xAE, 0x2A, 0xE7, 0x77, 0x19,
+    0xDA, 0x3D, 0xA7, 0x73, 0x99, 0x94, 0x94, 0x95, 0x99, 0x74, 0x9E, 0x77, 0x0A, 0xD9, 0x74, 0xDA,
+    0x77, 0x0A, 0xD9, 0x74, 0xDA, 0x77, 0x09, 0xD7, 0x5D, 0x97, 0x70, 0x9D, 0x7A, 0x93, 0xD9, 0x39,
+    0x94, 0x99, 0x39, 0xD4, 0xA1, 0xEA, 0x90, 0xD9, 0x9A, 0xF4, 0xAE, 0xA9, 0x0D, 0x09, 0xAE, 0x99,
+    0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0xA0, 0x9A, 0xAA, 0xFD, 0xAA, 0xA9, 0x94, 0x99, 0xAA, 0xAF, 0xDA,
+    0xAA, 0x99, 0x5F, 0x97, 0x69, 0xF7, 0x2A, 0xDA, 0xD7, 0x6D, 0xAE, 0x70, 0x9D, 0x90, 0xE7, 0x4A,
+    0xD0, 0x9D, 0xA7, 0xE1, 0xAD, 0xA7, 0x29, 0xDA, 0x1E, 0x95, 0xEA, 0x2E, 0x97, 0x1E, 0x29, 0xE5,
+    0xAD, 0x3A, 0xD9, 0x71, 0xE3, 0xDA, 0x79, 0x49, 0x74, 0x99, 0x39, 0x40, 0x70, 0xAF, 0xE9, 0xAF,
+    0xE9, 0x99, 0x99, 0x99, 0x99, 0x00, 0x76, 0xD9, 0x75, 0xAD, 0x76, 0xD9, 0x75, 0xDA, 0x75, 0x9D,
+    0x76, 0xD9, 0x75, 0xAD, 0x75, 0x9D, 0x76, 0xDA, 0x75, 0xAD, 0x76, 0xD9, 0x75, 0xAD, 0x75, 0x9D,
+    0x76, 0xDA, 0x75, 0xAD, 0x76, 0xD9, 0x75, 0xDA, 0x75, 0x9D, 0x76, 0xDA, 0x75, 0xAD, 0x76, 0xD9,
+    0x75, 0xDA, 0x75, 0x9D, 0x76, 0xD9, 0x75, 0x9F, 0xE9, 0xFE, 0x9D, 0xAA, 0xAA, 0x99, 0xD9, 0x39,
+    0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9, 0x39,
+    0xD9, 0x39, 0xDA, 0x99, 0x99, 0x9F, 0xE9, 0xFE, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93,
+    0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9F, 0xE9,
+    0xFE, 0x09, 0x99, 0x99, 0x99, 0x0F, 0xE9, 0x0F, 0xE9, 0x0A, 0xAA, 0xAE, 0x94, 0xAD, 0x94, 0xAD,
+    0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD,
+    0x90, 0x99, 0x99, 0xE9, 0x0F, 0xE9, 0x0F, 0xE9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9,
+    0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x4A, 0xD9, 0x0F, 0xE9,
+    0x0F, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x00, 0x77, 0x75, 0x9A, 0xFD, 0x94, 0x9A, 0xFD, 0x92, 0x9F,
+    0xFE, 0x19, 0xFF, 0xE2, 0xEA, 0xA9, 0x9A, 0xEA, 0x1E, 0xAA, 0x99, 0xAF, 0x1A, 0x96, 0xE1, 0xA9,
+    0x6E, 0x97, 0x19, 0xD9, 0x71, 0x9D, 0xA7, 0x2D, 0xA7, 0x2D, 0xA7, 0x19, 0xDA, 0x72, 0xDA, 0x71,
+    0xAD, 0x97, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0xE9, 0x71, 0xE9, 0x79, 0xE9, 0x70, 0x9E, 0x97,
+    0x9E, 0x97, 0x09, 0xE9, 0x70, 0xE7, 0x2E, 0x97, 0x0E, 0x72, 0xE7, 0x2D, 0x97, 0x2D, 0x97, 0x19,
+    0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x29, 0xD7, 0x39, 0x97, 0x39, 0x97, 0x77, 0x77, 0x77, 0x72, 0x9D,
+    0x97, 0x19, 0xD9, 0x71, 0xF7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xEA, 0x71, 0xEA, 0x72, 0x99, 0x73,
+    0x99, 0x60, 0x77, 0x69, 0xAF, 0xD9, 0x49, 0xDA, 0x09, 0xFF, 0xE3, 0xAE, 0x1E, 0xAA, 0x99, 0xAE,
+    0xA2, 0xAE, 0x1A, 0x96, 0xE2, 0x9E, 0x72, 0x9D, 0x91, 0x9D, 0xA7, 0x3D, 0xA1, 0x9D, 0xA7, 0x29,
+    0xDA, 0x19, 0xDA, 0x72, 0xAD, 0x91, 0x9D, 0xA7, 0x2E, 0x3D, 0xA7, 0x1E, 0x93, 0xD9, 0x79, 0xE9,
+    0x4D, 0x96, 0x9E, 0x95, 0xD9, 0x6E, 0x7D, 0x95, 0xE7, 0x0D, 0x95, 0xD9, 0x70, 0xD5, 0x9D, 0x71,
+    0xD5, 0x9D, 0x71, 0xD6, 0x99, 0x72, 0x97, 0x77, 0x77, 0x79, 0xD9, 0x79, 0xDA, 0x4F, 0x7F, 0x4F,
+    0x7F, 0x4E, 0xA7, 0xAE, 0x59, 0x97, 0x19, 0x91, 0x77, 0x4E, 0x39, 0xAF, 0xDA, 0x3E, 0x2F, 0xFE,
+    0x2E, 0x2F, 0xA9, 0x9A, 0xF1, 0xE2, 0x99, 0x6E, 0x90, 0xE7, 0x4E, 0x0E, 0x74, 0xE0, 0xE7, 0x4E,
+    0x0E, 0x73, 0x9D, 0xA0, 0xE7, 0x3E, 0x1E, 0x72, 0xEA, 0x1E, 0x71, 0xEA, 0x2D, 0xA7, 0x0E, 0xA3,
+    0xAC, 0xA7, 0xE9, 0x4A, 0xCA, 0x6A, 0xD9, 0x5A, 0xCA, 0x6D, 0xA6, 0xAC, 0xA6, 0xD9, 0x6A, 0xC9,
+    0x6D, 0x97, 0x97, 0x99, 0x77, 0x77, 0x77, 0xE5, 0x9D, 0xA5, 0xAE, 0x94, 0xF5, 0xAE, 0xA4, 0xF5,
+    0x9E, 0x5A, 0xE7, 0x97, 0x99, 0x60, 0xAF, 0xFF, 0xE0, 0xFF, 0xFF, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xE7, 0x4A, 0xD7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x74, 0xE7, 0x4A, 0xD7, 0x49,
+    0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9E, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xE7, 0x4A, 0xD9, 0x73,
+    0x9E, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0xFF, 0xFC, 0x92, 0xDA, 0xAA, 0xFF, 0xCA, 0x1D,
+    0x2A, 0xFF, 0xC9, 0x0D, 0x2A, 0xFF, 0xD0, 0xD2, 0xAF, 0xFD, 0x0D, 0x2A, 0xFF, 0xD9, 0xD2, 0xAF,
+    0xFD, 0xAD, 0x2A, 0xFF, 0xDA, 0xD2, 0xAF, 0xFD, 0xAD, 0x2A, 0xFF, 0xDA, 0xD2, 0xAF, 0xFD, 0x9D,
+    0x2A, 0xFF, 0xD0, 0xD2, 0xAF, 0xFD, 0x0D, 0x2A, 0xFF, 0xC9, 0x0D, 0x2A, 0xFF, 0xA1, 0xD2, 0xAF,
+    0xE9, 0x2D, 0x2A, 0xC9, 0x70, 0xD2, 0xAC, 0x97, 0x0D, 0x2A, 0xC9, 0x70, 0xD2, 0xAC, 0x97, 0x0D,
+    0x2A, 0xC9, 0x70, 0xD2, 0xAC, 0x97, 0x0D, 0x2A, 0xC9, 0x70, 0xD2, 0xAC, 0x97, 0x0D, 0x2A, 0xC9,
+    0x70, 0xD2, 0xAC, 0x97, 0x0D, 0x2A, 0xC9, 0x70, 0xD2, 0xAC, 0x97, 0x0D, 0x2A, 0xC9, 0x77, 0x71,
+    0x4A, 0xAF, 0xFD, 0x92, 0xAF, 0xFF, 0xC9, 0x1A, 0xFF, 0xC9, 0x99, 0xD9, 0x09, 0xFF, 0xD2, 0xAC,
+    0x90, 0xAF, 0xFD, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A,
+    0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A, 0xC9, 0x0F, 0xFE, 0x2A,
+    0xC9, 0x0A, 0xFF, 0xD2, 0xAC, 0x91, 0xFF, 0xD2, 0xAC, 0x91, 0xAF, 0xFC, 0xAA, 0xAD, 0x92, 0xAF,
+    0xFF, 0xC9, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFE, 0xA9, 0x4F, 0xFF, 0xD3, 0xD9,
+    0x99, 0xFF, 0xD2, 0xD2, 0xAF, 0xFC, 0xA1, 0xD2, 0xAF, 0xFD, 0x1D, 0x2A, 0xFF, 0xD1, 0xD2, 0xAF,
+    0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0xA0, 0xD2, 0xAF, 0xFD, 0x90, 0xD2, 0xAF,
+    0xFD, 0x90, 0xD2, 0xAF, 0xFD, 0x1D, 0x2A, 0xFF, 0xD1, 0xD2, 0xAF, 0xFC, 0xA1, 0xDA, 0xAA, 0xFF,
+    0xD2, 0xFF, 0xFD, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA4, 0x69, 0x97, 0x49, 0xDA, 0x73, 0x9D,
+    0xA7, 0x4D, 0x97, 0x4D, 0x96, 0xA9, 0x3D, 0x49, 0x99, 0xEA, 0x90, 0xD0, 0x9A, 0xEA, 0xAF, 0xFF,
+    0xE0, 0x9A, 0xAA, 0xFD, 0xAA, 0xA9, 0x95, 0xF9, 0x71, 0xEA, 0xD7, 0x0A, 0xD9, 0x0E, 0x69, 0xE1,
+    0xAD, 0xA5, 0xE9, 0x2E, 0x94, 0xAD, 0x3A, 0xD7, 0x94, 0x93, 0x19, 0x3E, 0x90, 0x9E, 0xA0, 0x9E,
+    0xA1, 0xE7, 0x77, 0x77, 0x77, 0x6E, 0x2E, 0x91, 0xAD, 0xA2, 0xE2, 0xE2, 0x9D, 0x3D, 0x92, 0xAC,
+    0xA3, 0x99, 0x79, 0x99, 0x97, 0x49, 0xFF, 0x97, 0x0A, 0xEA, 0x99, 0x9A, 0xE6, 0xDA, 0x79, 0xD4,
+    0xAC, 0x97, 0x2D, 0x29, 0xC9, 0x74, 0xCA, 0x1D, 0x75, 0x9C, 0x90, 0x97, 0x79, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0x97, 0x6C, 0x1D, 0x75, 0xAC, 0x2D, 0x73, 0xAC, 0x92,
+    0x9D, 0x71, 0xAC, 0xA4, 0x9D, 0xA5, 0x9D, 0xA7, 0xFF, 0xD9, 0x71, 0x9A, 0xFA, 0x95, 0x69, 0x97,
+    0x49, 0xDA, 0x73, 0x9D, 0xA7, 0x4D, 0x97, 0x4D, 0x96, 0xA9, 0x3D, 0x49, 0x99, 0xEA, 0x90, 0xD0,
+    0x9A, 0xEA, 0xAF, 0xFF, 0xE0, 0x9A, 0xAA, 0xFD, 0xAA, 0xA9, 0x95, 0xF9, 0x71, 0xEA, 0xD7, 0x0A,
+    0xD9, 0x0E, 0x69, 0xE1, 0xAD, 0xA5, 0xE9, 0x2E, 0x94, 0xAD, 0x3A, 0xD7, 0x94, 0x97, 0x77, 0x29,
+    0x97, 0x49, 0xDA, 0x73, 0x9D, 0xA7, 0x4D, 0x97, 0x4D, 0x96, 0xA9, 0x3D, 0x49, 0x99, 0xEA, 0x90,
+    0xD0, 0x9A, 0xEA, 0xAF, 0xFF, 0xE0, 0x9A, 0xAA, 0xFD, 0xAA, 0xA9, 0x95, 0xF9, 0x71, 0xEA, 0xD7,
+    0x0A, 0xD9, 0x0E, 0x69, 0xE1, 0xAD, 0xA5, 0xE9, 0x2E, 0x94, 0xAD, 0x3A, 0xD7, 0x94, 0x93, 0x74,
+    0x9D, 0xA4, 0x9D, 0x0A, 0xE4, 0xDA, 0x0A, 0xE3, 0x9D, 0x91, 0xD9, 0x3A, 0xD7, 0x1D, 0x97, 0x09,
+    0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xDA, 0x71, 0xD9, 0x70,
+    0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x71, 0xE7, 0x1D, 0x97, 0x0A, 0xD7, 0x1D, 0xA7, 0x09, 0xD4, 0xAA,
+    0x91, 0xE3, 0xAE, 0x1D, 0x93, 0xAE, 0x0A, 0xD4, 0x9E, 0x72, 0x91, 0x49, 0x99, 0x99, 0x77, 0x09,
+    0x3A, 0xFF, 0xA9, 0x73, 0x9C, 0xA1, 0xFF, 0xFD, 0xA7, 0x0D, 0x90, 0xAD, 0x94, 0x9A, 0xFF, 0xA9,
+    0x99, 0xAD, 0xA1, 0xD7, 0x29, 0xAF, 0xFD, 0xA2, 0xC9, 0x76, 0x9A, 0xFA, 0x30, 0x70, 0x99, 0x76,
+    0xAF, 0xE9, 0x70, 0xAE, 0xA9, 0x9A, 0xAE, 0x6A, 0xCA, 0x7A, 0xD4, 0xAC, 0x97, 0x19, 0xD2, 0x9C,
+    0xA7, 0x39, 0xCA, 0x1D, 0x75, 0xAC, 0x90, 0x97, 0x79, 0x00, 0x79, 0xC9, 0x76, 0xAC, 0xA7, 0x19,
+    0xA2, 0xAC, 0xA2, 0xC9, 0x4D, 0xA1, 0xAC, 0xA1, 0xE5, 0xDA, 0x0A, 0xCA, 0x0E, 0x7D, 0xAA, 0xCA,
+    0xE7, 0x1F, 0xE5, 0x99, 0x99, 0x9A, 0xFC, 0xA9, 0x99, 0x99, 0x0F, 0xFF, 0xFC, 0x0A, 0xAA, 0xAA,
+    0xFD, 0xAA, 0xAA, 0xAA, 0x5F, 0xE7, 0x1E, 0xAC, 0xAE, 0x7E, 0x0A, 0xCA, 0x0E, 0x5E, 0x1A, 0xCA,
+    0x1E, 0x4A, 0xC2, 0xAC, 0xA2, 0xCA, 0x71, 0xAC, 0xA7, 0x6A, 0xCA, 0x77, 0x70, 0x77, 0x71, 0xE7,
+    0x29, 0xE9, 0x72, 0xE9, 0x72, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xCA, 0x73, 0xEA,
+    0x72, 0xEA, 0x72, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x73, 0xE9, 0x71, 0x9E,
+    0x97, 0x2E, 0x97, 0x29, 0xA9, 0x00, 0x39, 0xD9, 0x1A, 0xD2, 0xDA, 0x19, 0xD9, 0x3E, 0x19, 0xD9,
+    0x1A, 0xD2, 0xE3, 0xAD, 0x2E, 0x2D, 0x91, 0xAD, 0x4D, 0xA1, 0x9D, 0x2A, 0xD2, 0xDA, 0x3A, 0xD2,
+    0xDA, 0x2D, 0x2A, 0xD4, 0xD9, 0x19, 0xD2, 0xAC, 0xA2, 0xD9, 0x3A, 0xCA, 0x2D, 0x92, 0xD2, 0xAC,
+    0xA4, 0xD2, 0x9C, 0xA2, 0xAC, 0x92, 0xD4, 0x9C, 0x92, 0xAC, 0x3C, 0xA2, 0x9C, 0x94, 0x77, 0x77,
+    0x3E, 0x77, 0x49, 0xE9, 0x77, 0x39, 0xE9, 0x77, 0x49, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x19, 0xCA, 0x77, 0x09, 0xCA, 0x1E, 0x97, 0x7E, 0xA0, 0xEA, 0x77, 0xEA,
+    0x0E, 0x77, 0x0E, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x97, 0x76,
+    0xE7, 0x74, 0x9E, 0x97, 0x74, 0xE7, 0x75, 0x9A, 0x97, 0x20, 0x77, 0x71, 0xE9, 0x77, 0xAD, 0xA0,
+    0xEA, 0x77, 0xF0, 0xE9, 0x77, 0xEA, 0x09, 0xAA, 0x77, 0x1A, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0xE7, 0x74, 0x9E, 0x97, 0x73, 0x9E, 0x97, 0x74, 0xAC, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x99, 0x77, 0x19, 0x91, 0xE9, 0x77, 0xE9,
+    0x0E, 0xA7, 0x69, 0xEA, 0x0E, 0x97, 0x7E, 0x91, 0xA9, 0x77, 0x1A, 0x90, 0x5E, 0x1E, 0xA0, 0xEA,
+    0x0A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xA1, 0xE9, 0x0E, 0xA0, 0xE9, 0x19, 0x10, 0x7A,
+    0xD7, 0x70, 0xEA, 0x77, 0xEA, 0x77, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x97, 0x59, 0x2E, 0x97, 0x19, 0xDA, 0x1E, 0xA7, 0x1F, 0x1E, 0x97, 0x1A, 0xE1, 0x9C, 0xA7, 0x3A,
+    0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xAA, 0x77, 0x0E, 0xA7, 0x7E, 0xA7,
+    0x7E, 0x97, 0x70, 0x97, 0x10, 0x72, 0x99, 0x97, 0x75, 0xDA, 0x77, 0x5D, 0xA7, 0x6A, 0x94, 0xDA,
+    0x4A, 0x96, 0xEA, 0x3D, 0xA3, 0xE9, 0x5E, 0xA3, 0xDA, 0x3E, 0xA5, 0xE9, 0x3D, 0xA3, 0xE9, 0x69,
+    0x94, 0xDA, 0x49, 0x97, 0x6D, 0xA7, 0x75, 0xDA, 0x77, 0x5D, 0xA7, 0x75, 0xDA, 0x72, 0xAF, 0xFF,
+    0xFF, 0xE9, 0xAF, 0xFF, 0xFF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0xA9, 0x99, 0x99, 0x99,
+    0x99, 0x97, 0x3D, 0xA7, 0x75, 0xDA, 0x77, 0x5D, 0xA7, 0x69, 0x5D, 0xA4, 0x97, 0xE9, 0x3D, 0xA3,
+    0xE6, 0xEA, 0x3D, 0xA2, 0x9E, 0x95, 0xEA, 0x3D, 0xA2, 0x9E, 0x69, 0xCA, 0x4D, 0xA3, 0xAC, 0xA7,
+    0x6D, 0xA7, 0x75, 0xDA, 0x77, 0x5A, 0xA9, 0x72, 0x5E, 0x0A, 0xE9, 0xAE, 0x90, 0xE7, 0x77, 0x29,
+    0xA9, 0x09, 0xE9, 0xAE, 0xA9, 0xE9, 0x0A, 0xCA, 0x77, 0x72, 0xE0, 0xAE, 0x9A, 0xEA, 0x9E, 0x29,
+    0x10, 0x5E, 0x0A, 0xE9, 0xAE, 0x90, 0xE2, 0x97, 0x09, 0x19, 0xE0, 0xAE, 0xAA, 0xE9, 0x0E, 0x73,
+    0xAA, 0xA0, 0x9E, 0x9A, 0xEA, 0x9E, 0x90, 0xAA, 0x97, 0x3E, 0x0A, 0xE9, 0xAE, 0xA9, 0xE2, 0x91,
+    0xFF, 0x99, 0x9D, 0x99, 0x92, 0xAA, 0x5A, 0xA5, 0xAA, 0x5D, 0x2F, 0xF2, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFF, 0xCA, 0x99, 0x99,
+    0xAD, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0xA3, 0xAF, 0xFC, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0xAF, 0xDA, 0x0F, 0xD1, 0xAF, 0xA2,
+    0xF3, 0xAD, 0xA4, 0xD5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5,
+    0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x72, 0x99, 0x5D, 0x49, 0xD9, 0x3F, 0x29, 0xF9, 0x1F, 0xD0, 0xAF,
+    0xDA, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59,
+    0x92, 0x2A, 0xA4, 0xAD, 0xA2, 0xAC, 0x1C, 0xA0, 0xAC, 0x3C, 0xA0, 0xD1, 0xD2, 0xF4, 0xD5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0x99, 0x20, 0xFA,
+    0x29, 0x99, 0xCA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xD2, 0xFF, 0x2A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA,
+    0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A,
+    0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x5A, 0xA5, 0xAA, 0x59, 0x92, 0x49, 0x95, 0x9F, 0xCA, 0x3E, 0xAE,
+    0xA1, 0xAD, 0x29, 0xD1, 0xDA, 0x3D, 0xA0, 0xD9, 0x3A, 0xD9, 0xD4, 0x9D, 0x9D, 0x49, 0xD9, 0xD4,
+    0x9D, 0x9D, 0x49, 0xD0, 0xD9, 0x3A, 0xD0, 0xDA, 0x3D, 0xA0, 0xAD, 0x29, 0xD9, 0x1E, 0xAE, 0xA3,
+    0xFC, 0xA6, 0x99, 0x30, 0x3D, 0x0C, 0xA3, 0x91, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C,
+    0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0x99, 0x77, 0x1A, 0xD9, 0x69, 0xE9, 0x6F, 0x95, 0xAC,
+    0x9D, 0x94, 0x9C, 0xA0, 0xD9, 0x4D, 0x1D, 0x93, 0xD9, 0x1D, 0x92, 0x9C, 0xA2, 0xD9, 0x2D, 0x3D,
+    0x91, 0xAF, 0xFD, 0x9A, 0xFF, 0xD9, 0x6D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x50, 0x72, 0xFF, 0x09,
+    0xDA, 0xAA, 0xAA, 0xA0, 0x9C, 0xA6, 0x9C, 0xA6, 0x9C, 0xA6, 0xAF, 0xCA, 0x2A, 0xFE, 0x91, 0x92,
+    0x9E, 0x7D, 0xA6, 0xAC, 0xA6, 0xDA, 0x94, 0x9D, 0x9D, 0xAA, 0xAA, 0xE0, 0xFE, 0xA3, 0x99, 0x99,
+    0x30, 0x59, 0x99, 0x6F, 0xD3, 0x9E, 0xAA, 0xAA, 0x3D, 0xA7, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x0A,
+    0xEA, 0x29, 0xFF, 0xC1, 0x9E, 0x3D, 0xA0, 0x9D, 0x49, 0xD1, 0xD5, 0xD1, 0xD4, 0x9D, 0x1A, 0xD3,
+    0xDA, 0x2E, 0xAA, 0xE4, 0xFD, 0x96, 0x99, 0x40, 0x73, 0xFF, 0xD0, 0xFF, 0xCA, 0x7D, 0x96, 0x9D,
+    0x7D, 0x96, 0x9D, 0x7D, 0xA6, 0x9D, 0x7D, 0xA7, 0xD7, 0xAC, 0xA7, 0xD9, 0x6A, 0xD7, 0xD9, 0x77,
+    0x49, 0x95, 0x9F, 0xD3, 0xDA, 0x9A, 0xE1, 0xAD, 0x3D, 0x90, 0xAC, 0xA3, 0xD9, 0x0A, 0xD2, 0x9D,
+    0x2E, 0xAA, 0xD9, 0x3F, 0xC9, 0x3A, 0xDA, 0xE9, 0x1A, 0xD2, 0xAD, 0x90, 0xD9, 0x3A, 0xCA, 0x0D,
+    0x49, 0xD0, 0xD9, 0x3D, 0xA0, 0xAD, 0xA9, 0xAE, 0x2A, 0xFD, 0x59, 0x99, 0x30, 0x39, 0x99, 0x5A,
+    0xFC, 0xA2, 0xAD, 0xA9, 0xAD, 0xA1, 0xD9, 0x3D, 0x99, 0xD4, 0xAC, 0xA9, 0xD4, 0x9D, 0x9D, 0x4A,
+    0xD0, 0xDA, 0x29, 0xE0, 0x9F, 0xDA, 0xD1, 0x9F, 0x99, 0xCA, 0x7A, 0xCA, 0x7D, 0x7D, 0xA2, 0xAA,
+    0xAA, 0xE3, 0xFC, 0xA4, 0x99, 0x99, 0x40, 0x39, 0x70, 0xCA, 0x7C, 0xA7, 0xCA, 0x3A, 0xAA, 0xEA,
+    0xAA, 0x0F, 0xFC, 0x39, 0xCA, 0x7C, 0xA7, 0xCA, 0x7A, 0x93, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF,
+    0xC7, 0x20, 0x9A, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xC7, 0x74, 0xAF, 0xF0, 0xFF, 0xC0, 0x79, 0xCA,
+    0x2D, 0x2A, 0xCA, 0x2D, 0x29, 0xD2, 0xAC, 0x92, 0xD9, 0x2D, 0x3D, 0x3D, 0x3D, 0x92, 0xAC, 0x92,
+    0x9C, 0xA3, 0xD3, 0xD9, 0x29, 0xD3, 0xAC, 0x93, 0xAA, 0x00, 0x6D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA,
+    0x3D, 0x3D, 0x3D, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0xD3, 0xD2, 0x9C, 0xA2,
+    0xD9, 0x19, 0xD2, 0xD9, 0x19, 0xA9, 0x20, 0x09, 0x29, 0x99, 0x3C, 0xAA, 0xFC, 0xA1, 0xE9, 0x19,
+    0xD9, 0x0D, 0x49, 0xCA, 0x0D, 0x5C, 0xA0, 0xD5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C,
+    0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x09, 0x95, 0x99, 0x49, 0x95, 0x9F, 0xCA, 0x3E,
+    0xAE, 0xA1, 0xAD, 0x29, 0xD1, 0xDA, 0x3D, 0xA0, 0xD9, 0x3A, 0xD9, 0xD4, 0x9D, 0x9D, 0x49, 0xD9,
+    0xD4, 0x9D, 0x9D, 0x49, 0xD0, 0xD9, 0x3A, 0xD0, 0xDA, 0x3D, 0xA0, 0xAD, 0x29, 0xD9, 0x1E, 0xAE,
+    0xA3, 0xFC, 0xA6, 0x99, 0x30, 0x71, 0x9E, 0x1A, 0xF9, 0xEA, 0xD9, 0xD0, 0x9D, 0x09, 0x19, 0xD3,
+    0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x60, 0x39, 0x99,
+    0x5A, 0xFC, 0xA2, 0xEA, 0xAA, 0xDA, 0x2A, 0x39, 0xD7, 0x0D, 0x79, 0xD7, 0xAD, 0x69, 0xD6, 0x9D,
+    0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x96, 0xFF, 0xC1, 0xFF, 0xC7, 0x30, 0x39, 0x99,
+    0x49, 0xFE, 0x2E, 0xA9, 0xAE, 0x19, 0x93, 0x9D, 0x70, 0xD7, 0x9D, 0x6A, 0xD9, 0x29, 0xFC, 0x94,
+    0xAA, 0xAE, 0xA7, 0x9D, 0x97, 0xDA, 0x7D, 0xA6, 0x9D, 0x99, 0xDA, 0xAA, 0xAE, 0x09, 0xFE, 0xA4,
+    0x99, 0x99, 0x30, 0x77, 0x1A, 0xD9, 0x69, 0xE9, 0x6F, 0x95, 0xAC, 0x9D, 0x94, 0x9C, 0xA0, 0xD9,
+    0x4D, 0x1D, 0x93, 0xD9, 0x1D, 0x92, 0x9C, 0xA2, 0xD9, 0x2D, 0x3D, 0x91, 0xAF, 0xFD, 0x9A, 0xFF,
+    0xD9, 0x6D, 0x97, 0x0D, 0x97, 0x0D, 0x97, 0x50, 0x72, 0xFF, 0x09, 0xDA, 0xAA, 0xAA, 0xA0, 0x9C,
+    0xA6, 0x9C, 0xA6, 0x9C, 0xA6, 0xAF, 0xCA, 0x2A, 0xFE, 0x91, 0x92, 0x9E, 0x7D, 0xA6, 0xAC, 0xA6,
+    0xDA, 0x94, 0x9D, 0x9D, 0xAA, 0xAA, 0xE0, 0xFE, 0xA3, 0x99, 0x99, 0x30, 0x59, 0x99, 0x6F, 0xD3,
+    0x9E, 0xAA, 0xAA, 0x3D, 0xA7, 0xAC, 0xA7, 0x0D, 0x97, 0x0D, 0x0A, 0xEA, 0x29, 0xFF, 0xC1, 0x9E,
+    0x3D, 0xA0, 0x9D, 0x49, 0xD1, 0xD5, 0xD1, 0xD4, 0x9D, 0x1A, 0xD3, 0xDA, 0x2E, 0xAA, 0xE4, 0xFD,
+    0x96, 0x99, 0x40, 0x73, 0xFF, 0xD0, 0xFF, 0xCA, 0x7D, 0x96, 0x9D, 0x7D, 0x96, 0x9D, 0x7D, 0xA6,
+    0x9D, 0x7D, 0xA7, 0xD7, 0xAC, 0xA7, 0xD9, 0x6A, 0xD7, 0xD9, 0x77, 0x49, 0x95, 0x9F, 0xD3, 0xDA,
+    0x9A, 0xE1, 0xAD, 0x3D, 0x90, 0xAC, 0xA3, 0xD9, 0x0A, 0xD2, 0x9D, 0x2E, 0xAA, 0xD9, 0x3F, 0xC9,
+    0x3A, 0xDA, 0xE9, 0x1A, 0xD2, 0xAD, 0x90, 0xD9, 0x3A, 0xCA, 0x0D, 0x49, 0xD0, 0xD9, 0x3D, 0xA0,
+    0xAD, 0xA9, 0xAE, 0x2A, 0xFD, 0x59, 0x99, 0x30, 0x39, 0x99, 0x5A, 0xFC, 0xA2, 0xAD, 0xA9, 0xAD,
+    0xA1, 0xD9, 0x3D, 0x99, 0xD4, 0xAC, 0xA9, 0xD4, 0x9D, 0x9D, 0x4A, 0xD0, 0xDA, 0x29, 0xE0, 0x9F,
+    0xDA, 0xD1, 0x9F, 0x99, 0xCA, 0x7A, 0xCA, 0x7D, 0x7D, 0xA2, 0xAA, 0xAA, 0xE3, 0xFC, 0xA4, 0x99,
+    0x99, 0x40, 0x39, 0x70, 0xCA, 0x7C, 0xA7, 0xCA, 0x3A, 0xAA, 0xEA, 0xAA, 0x0F, 0xFC, 0x39, 0xCA,
+    0x7C, 0xA7, 0xCA, 0x7A, 0x93, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xC7, 0x20, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xFF, 0xC7, 0x74, 0xAF, 0xF0, 0xFF, 0xC0, 0x79, 0xCA, 0x2D, 0x2A, 0xCA, 0x2D, 0x29,
+    0xD2, 0xAC, 0x92, 0xD9, 0x2D, 0x3D, 0x3D, 0x3D, 0x92, 0xAC, 0x92, 0x9C, 0xA3, 0xD3, 0xD9, 0x29,
+    0xD3, 0xAC, 0x93, 0xAA, 0x00, 0x6D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3D, 0x3D, 0x92, 0xAC,
+    0x92, 0xAC, 0x92, 0xAC, 0x92, 0xAC, 0x92, 0xD3, 0xD2, 0x9C, 0xA2, 0xD9, 0x19, 0xD2, 0xD9, 0x19,
+    0xA9, 0x20, 0x19, 0xAA, 0xAA, 0x92, 0xAF, 0xDA, 0x29, 0x3D, 0x7A, 0xC9, 0x6A, 0xC9, 0x09, 0xFE,
+    0x99, 0xD9, 0x2A, 0xC9, 0xD4, 0xAC, 0x9D, 0x4D, 0x9D, 0xA1, 0x9E, 0x90, 0xFC, 0xA0, 0xC9, 0x19,
+    0x99, 0x40, 0x29, 0xAA, 0xA9, 0x4F, 0xDA, 0x2D, 0x92, 0xAC, 0x90, 0x9C, 0xA4, 0xD0, 0xAC, 0x94,
+    0xD0, 0xFF, 0xD0, 0xD9, 0x7A, 0xC9, 0x79, 0xD7, 0x0A, 0xD9, 0x29, 0x92, 0xAF, 0xD9, 0x49, 0x99,
+    0x92, 0x29, 0xAA, 0xA9, 0x4F, 0xE2, 0xD9, 0x29, 0xD0, 0x9C, 0xA4, 0x9C, 0xAA, 0xC9, 0x5F, 0x6F,
+    0x6D, 0xAC, 0x94, 0x9C, 0xA9, 0xD4, 0xAC, 0x90, 0xAC, 0xA2, 0xAD, 0x2A, 0xFC, 0xA5, 0x99, 0x93,
+    0x0A, 0x94, 0x9A, 0x91, 0xAC, 0xA3, 0xD3, 0xD9, 0x1D, 0x94, 0xD0, 0xAC, 0xA5, 0x9F, 0x7A, 0xD7,
+    0x0E, 0x96, 0xAC, 0x9D, 0x5A, 0xCA, 0x1D, 0x39, 0xD2, 0x9C, 0xA2, 0xD4, 0xAC, 0xA7, 0x40, 0x09,
+    0xAA, 0xAA, 0x93, 0x9F, 0xE9, 0x79, 0xD7, 0x09, 0xCA, 0x70, 0xD0, 0x9A, 0xAA, 0xAA, 0xAA, 0xD0,
+    0xFF, 0xD0, 0xD5, 0xD0, 0xAC, 0x93, 0x9C, 0xA1, 0xD9, 0x19, 0xD3, 0xFC, 0xA6, 0x99, 0x40, 0x0C,
+    0xA7, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA0, 0x9A, 0xAA, 0x92, 0xCA, 0xFE, 0x1D, 0xA3,
+    0xD9, 0x0D, 0x49, 0xCA, 0x0D, 0x5C, 0xA0, 0xCA, 0x5C, 0xA0, 0xCA, 0x5C, 0xA0, 0xCA, 0x5C, 0xA0,
+    0xCA, 0x5C, 0xA0, 0xCA, 0x5C, 0xA0, 0xCA, 0x5C, 0xA7, 0x20, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA7,
+    0x0C, 0xA7, 0x0C, 0xA4, 0xA9, 0x1C, 0xA2, 0x9D, 0x2C, 0xA1, 0x9D, 0x3C, 0xA0, 0x9D, 0x4C, 0xA9,
+    0xD5, 0xFA, 0x5D, 0xAA, 0xCA, 0x4D, 0x1D, 0x93, 0xCA, 0x2D, 0x3C, 0xA2, 0x9D, 0x2C, 0xA3, 0xAD,
+    0x73, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA,
+    0x0C, 0xA0, 0xCA, 0x0C, 0xA0, 0xCA, 0x0C, 0xA2, 0x0A, 0x19, 0xAA, 0xA2, 0x9A, 0xAA, 0x92, 0xCA,
+    0xFD, 0x9A, 0xFC, 0xA1, 0xDA, 0x29, 0xE3, 0xD9, 0x0D, 0x4D, 0x93, 0x9C, 0x90, 0xD4, 0xD4, 0x9C,
+    0xA0, 0xCA, 0x4D, 0x49, 0xCA, 0x0C, 0xA4, 0xD4, 0x9C, 0xA0, 0xCA, 0x4D, 0x49, 0xCA, 0x0C, 0xA4,
+    0xD4, 0x9C, 0xA0, 0xCA, 0x4D, 0x49, 0xCA, 0x0C, 0xA4, 0xD4, 0x9C, 0xA7, 0x71, 0x0A, 0x19, 0xAA,
+    0xA9, 0x2C, 0xAF, 0xE1, 0xDA, 0x3D, 0x90, 0xD4, 0x9C, 0xA0, 0xD5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C,
+    0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x0C, 0xA5, 0xCA, 0x72, 0x0A,
+    0x19, 0xAA, 0xA9, 0x3C, 0xAF, 0xDA, 0x2D, 0xA3, 0xD9, 0x1D, 0x49, 0xD1, 0xD5, 0xD1, 0xCA, 0x5D,
+    0x1D, 0x5D, 0x1D, 0x5D, 0x1D, 0x93, 0x9C, 0xA1, 0xE9, 0x19, 0xD2, 0xCA, 0xAF, 0xC9, 0x2C, 0xA1,
+    0x99, 0x94, 0xCA, 0x71, 0xCA, 0x71, 0xCA, 0x71, 0xCA, 0x70, 0x19, 0xAA, 0xAA, 0x19, 0xFE, 0x0D,
+    0x6D, 0x69, 0xD9, 0x59, 0xEA, 0x94, 0x9A, 0xDA, 0x6D, 0x95, 0x9C, 0x9A, 0x92, 0x9D, 0x0F, 0xE9,
+    0x29, 0x99, 0x30, 0x19, 0xC5, 0xAC, 0x49, 0xDA, 0xAA, 0x0A, 0xFD, 0x2D, 0x5D, 0x5D, 0x5D, 0x5D,
+    0x5D, 0x5D, 0x5D, 0xA4, 0x9F, 0x93, 0x99, 0x90, 0x77, 0x4A, 0xFC, 0xA9, 0x69, 0xFF, 0xA6, 0xEA,
+    0x2A, 0xC6, 0xE9, 0x74, 0xE7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE4, 0xAA, 0xAA, 0xAA, 0xAA, 0x9E,
+    0x4F, 0xFF, 0x4E, 0xAA, 0xAA, 0xAA, 0xAD, 0x93, 0xE5, 0x9D, 0xA3, 0xE6, 0xE3, 0xE6, 0xAE, 0x2E,
+    0x7F, 0xFC, 0xAA, 0xAA, 0xA9, 0x2A, 0xFF, 0xF9, 0x59, 0x9E, 0x99, 0x99, 0x97, 0x0E, 0x75, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5E, 0x75, 0xFF, 0xC7, 0xFF, 0xC0, 0x70, 0x99, 0x29, 0x97, 0x2D, 0x19, 0xCA,
+    0x71, 0x9C, 0xA1, 0xAC, 0xA7, 0x1A, 0xDA, 0x9D, 0x97, 0xAF, 0xFC, 0xA4, 0xAF, 0xFF, 0x3A, 0xFD,
+    0x19, 0xEA, 0x29, 0xE9, 0x9C, 0xA1, 0xAC, 0xA4, 0xE9, 0x0A, 0xC9, 0x1D, 0x93, 0x9E, 0x1D, 0x91,
+    0xD4, 0xE9, 0x1D, 0x2D, 0x4E, 0x2D, 0x19, 0xCA, 0x4E, 0x19, 0xCA, 0x1A, 0xCA, 0x39, 0xDA, 0x1A,
+    0xC9, 0x1D, 0x93, 0x9D, 0xA1, 0xD9, 0x1D, 0x5D, 0xA1, 0xD2, 0xD5, 0xE0, 0x9D, 0x19, 0xCA, 0x5E,
+    0x09, 0xCA, 0x1A, 0xC9, 0x5A, 0xD9, 0xAC, 0x91, 0xD9, 0x59, 0xFC, 0x2D, 0x7F, 0xC2, 0xD7, 0x0F,
+    0x90, 0x9C, 0xA7, 0x09, 0xFF, 0xAA, 0xDA, 0x4A, 0xFF, 0xEA, 0x4D, 0x9A, 0xFD, 0xA9, 0x5D, 0x2D,
+    0x71, 0x9D, 0x19, 0xCA, 0x71, 0x9C, 0xA1, 0xAC, 0x96, 0x77, 0x69, 0xAF, 0xDA, 0x95, 0xAF, 0xFD,
+    0xA3, 0xFC, 0x99, 0x9A, 0xE9, 0x2F, 0x96, 0x92, 0x9E, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAD, 0x97,
+    0x4E, 0x75, 0xE3, 0x9A, 0x91, 0xAC, 0xA9, 0x0E, 0x3D, 0xA9, 0xF9, 0x0E, 0x3F, 0xDA, 0xC9, 0x0E,
+    0x3F, 0x94, 0xE3, 0xE9, 0x5E, 0x3E, 0x6E, 0x3E, 0x6A, 0xD9, 0x2E, 0x69, 0xDA, 0x2E, 0x7E, 0x2E,
+    0x7A, 0xE1, 0xE7, 0x0E, 0xA0, 0xE7, 0x09, 0xFE, 0x09, 0x9A, 0xC4, 0x9F, 0xFE, 0x6A, 0xFF, 0xA7,
+    0x19, 0x99, 0x40, 0x2A, 0xFF, 0xF3, 0xAF, 0xFF, 0x3A, 0xFF, 0xF3, 0xAD, 0x75, 0xAD, 0x75, 0xAD,
+    0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAF, 0xFE, 0x93, 0xAF, 0xFE,
+    0xA3, 0xAF, 0xFE, 0x93, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x72, 0x9A, 0xAE, 0xAA, 0xAA, 0xA5, 0xAF,
+    0xFD, 0x94, 0x9A, 0xAF, 0xAA, 0xAA, 0x70, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x75, 0xAD, 0x72, 0x77,
+    0x69, 0xAF, 0xCA, 0x96, 0xAF, 0xFD, 0x49, 0xEA, 0x99, 0x9A, 0xDA, 0x4E, 0x95, 0x94, 0x9D, 0xA7,
+    0x49, 0xD9, 0x74, 0xAD, 0x97, 0x4A, 0xD9, 0x74, 0xAD, 0x97, 0x19, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA,
+    0x3F, 0xFF, 0xC3, 0x9A, 0xAF, 0xAA, 0xAA, 0xAA, 0x6A, 0xD9, 0x74, 0xAD, 0x97, 0x1A, 0xFF, 0xF3,
+    0xFF, 0xFC, 0x39, 0x99, 0xEA, 0x99, 0x99, 0x99, 0x6A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xE7, 0x3A,
+    0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0x77, 0x77, 0x73, 0xD9, 0x77,
+    0x69, 0xD7, 0x77, 0xD9, 0x77, 0x69, 0xD7, 0x1D, 0x2A, 0xFC, 0x91, 0xFF, 0xA3, 0xD9, 0x9F, 0xFA,
+    0x9F, 0xFD, 0x2F, 0xCA, 0x99, 0x9A, 0xFD, 0xA9, 0x99, 0xAE, 0xA1, 0xF5, 0xAF, 0x95, 0xE1, 0xEA,
+    0x6F, 0x6A, 0xD9, 0x0E, 0x7E, 0x96, 0xAD, 0x90, 0xE7, 0xE7, 0x9D, 0x90, 0xE7, 0xE7, 0x9D, 0x90,
+    0xE6, 0xAE, 0x79, 0xD9, 0x0E, 0x6F, 0x79, 0xD9, 0x0E, 0x59, 0xF7, 0x9D, 0x90, 0xE5, 0xFC, 0x79,
+    0xD9, 0x0E, 0x49, 0xFC, 0x79, 0xD9, 0x0E, 0x4D, 0x9E, 0x79, 0xD9, 0x0E, 0x39, 0xD0, 0xE7, 0x9D,
+    0x90, 0xE3, 0xDA, 0x0E, 0x79, 0xD9, 0x0E, 0x29, 0xD1, 0xE7, 0x9D, 0x90, 0xE2, 0xAC, 0xA1, 0xE7,
+    0x9D, 0x96, 0xD7, 0x77, 0xAC, 0xA7, 0x77, 0xD7, 0x77, 0x9A, 0xA7, 0x72, 0x2E, 0x95, 0x9D, 0x5F,
+    0x5A, 0xD5, 0xF9, 0x4A, 0xD5, 0xFA, 0x4A, 0xD5, 0xFC, 0x4A, 0xD5, 0xDA, 0xD9, 0x3A, 0xD5, 0xD9,
+    0xE3, 0xAD, 0x5D, 0x99, 0xD3, 0xAD, 0x29, 0xAA, 0xEA, 0xEA, 0xAA, 0xEA, 0xA9, 0xAF, 0xFF, 0xFC,
+    0xA9, 0xAA, 0xEA, 0xAD, 0xAA, 0xAE, 0xAA, 0x92, 0xD9, 0x1D, 0xA1, 0x9D, 0x5D, 0xA1, 0xAD, 0x19,
+    0xD2, 0x9A, 0xAE, 0xAA, 0xFA, 0xEA, 0xAA, 0xAF, 0xFF, 0xFC, 0xA9, 0x99, 0xDA, 0x99, 0x9A, 0xDA,
+    0xAD, 0xA9, 0x92, 0xDA, 0x3D, 0xA9, 0xD5, 0xDA, 0x3E, 0x9D, 0x5D, 0xA3, 0x9D, 0xAD, 0x5D, 0xA4,
+    0xFC, 0x5D, 0xA4, 0xAF, 0x5D, 0xA4, 0x9F, 0x5D, 0xA5, 0xF5, 0xDA, 0x5A, 0xE2, 0x9F, 0xCA, 0xA9,
+    0x75, 0x9F, 0xFC, 0xA7, 0x39, 0xFF, 0xE7, 0x29, 0xD9, 0x3A, 0xEA, 0x71, 0x9D, 0x94, 0x9E, 0x71,
+    0x9D, 0x95, 0xE7, 0x19, 0xD9, 0x5A, 0xD9, 0x70, 0x9D, 0x95, 0xAD, 0x91, 0x9C, 0xA3, 0x9D, 0x95,
+    0xAD, 0x91, 0xAC, 0xA3, 0x9D, 0x95, 0xE2, 0xDA, 0x39, 0xD9, 0x4A, 0xE0, 0x9F, 0xE0, 0x9D, 0x92,
+    0x9A, 0xE0, 0xAF, 0xF9, 0x9F, 0xFD, 0x90, 0x99, 0xAE, 0x99, 0x90, 0x9F, 0xFC, 0x94, 0xDA, 0x39,
+    0xEA, 0xAA, 0x97, 0xDA, 0x39, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x73, 0xDA,
+    0x39, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x73, 0xDA, 0x39, 0xD9, 0x73, 0xE9,
+    0x29, 0xD9, 0x73, 0xAF, 0xCA, 0x9D, 0x97, 0x4A, 0xFA, 0x77, 0x29, 0x91, 0x0F, 0xDA, 0x97, 0x70,
+    0xFF, 0xCA, 0x76, 0xEA, 0xAF, 0xCA, 0x75, 0xDA, 0x39, 0xE7, 0x5D, 0xA4, 0xAD, 0x97, 0x4D, 0xA4,
+    0x9D, 0xA7, 0x4D, 0xA5, 0xE2, 0x9F, 0xD9, 0x1D, 0xA5, 0xE1, 0x9F, 0xF1, 0xDA, 0x49, 0xDA, 0x1E,
+    0xA0, 0x99, 0xCA, 0x1D, 0xA4, 0xAD, 0x90, 0x9D, 0xA7, 0xDA, 0x4E, 0x19, 0xD9, 0x7D, 0xA9, 0x99,
+    0xAE, 0xA1, 0x9D, 0xA7, 0xFF, 0xCA, 0x3E, 0xA6, 0xFF, 0x94, 0xAF, 0x94, 0xDA, 0x19, 0xE5, 0xAF,
+    0xA3, 0xDA, 0x2E, 0x69, 0xFC, 0x2D, 0xA2, 0x9D, 0xA7, 0x9F, 0x1D, 0xA3, 0xE7, 0x1E, 0x1D, 0xA3,
+    0xAD, 0xA7, 0x0A, 0xD9, 0x0D, 0xA4, 0xE7, 0x09, 0xD9, 0x0D, 0xA4, 0xAD, 0x97, 0xAD, 0x90, 0xDA,
+    0x49, 0xE0, 0xAC, 0x92, 0x9E, 0x1D, 0xA5, 0xE9, 0xAF, 0xF9, 0x1D, 0xA5, 0x9D, 0xA9, 0xFE, 0x97,
+    0x72, 0x99, 0x94, 0x9D, 0x94, 0x9D, 0xA5, 0xDA, 0x0D, 0x94, 0xAE, 0x5D, 0xA0, 0xDA, 0x4A, 0xE4,
+    0x9D, 0x90, 0xE4, 0xF9, 0x39, 0xD1, 0xAD, 0x4D, 0xAC, 0xA3, 0xAD, 0x19, 0xD3, 0x9D, 0x9C, 0xA3,
+    0xAD, 0x19, 0xD9, 0x29, 0xCA, 0x9D, 0x3D, 0xA2, 0xD9, 0x2A, 0xCA, 0x0D, 0x3D, 0xA2, 0xDA, 0x2D,
+    0x90, 0xD9, 0x2D, 0x92, 0xE2, 0xD9, 0x0D, 0x91, 0x9D, 0x3A, 0xD1, 0x9D, 0x90, 0xAC, 0xA1, 0xAD,
+    0x1A, 0xFF, 0xFF, 0xFC, 0xAF, 0xFF, 0xFF, 0xC2, 0xD9, 0x0A, 0xCA, 0x2D, 0x1D, 0xA4, 0xDA, 0x0D,
+    0x92, 0xD9, 0x0D, 0x94, 0xDA, 0x0D, 0x92, 0xAC, 0x90, 0xD5, 0xAD, 0x0D, 0x3A, 0xCA, 0x9D, 0x59,
+    0xD9, 0xD3, 0x9D, 0x9D, 0x6D, 0x9C, 0xA4, 0xDA, 0xCA, 0x6F, 0xA4, 0xDA, 0xCA, 0x6F, 0x94, 0xF9,
+    0x6A, 0xE5, 0xAE, 0x7A, 0xE5, 0x9E, 0x79, 0xE5, 0x9E, 0x30, 0x0F, 0xFA, 0xA9, 0x6A, 0xCA, 0x0F,
+    0xFF, 0x5E, 0x0E, 0xAA, 0xAA, 0xAA, 0xF4, 0xE0, 0xDA, 0x6A, 0xDA, 0x3E, 0x0D, 0xA7, 0xE3, 0xE0,
+    0xDA, 0x79, 0xD9, 0x2E, 0x0D, 0xA2, 0xAA, 0x92, 0xDA, 0x2E, 0x0D, 0xA2, 0xDA, 0x2D, 0xA2, 0xE0,
+    0xDA, 0x2D, 0xA2, 0xDA, 0x2E, 0x0D, 0xA2, 0xDA, 0x2D, 0xA2, 0xE0, 0xDA, 0x2D, 0xA2, 0xDA, 0x2E,
+    0x0D, 0xA2, 0xDA, 0x2D, 0xA2, 0xE0, 0xDA, 0x2D, 0xA2, 0xDA, 0x2E, 0x0D, 0xA2, 0xDA, 0x2D, 0xA2,
+    0xE0, 0xDA, 0x2D, 0xA2, 0xDA, 0x2E, 0x0D, 0xA2, 0xDA, 0x2D, 0xA2, 0xE0, 0xDA, 0x2D, 0xA2, 0xDA,
+    0x2E, 0x0D, 0xA2, 0xDA, 0x2D, 0xA2, 0xE0, 0xDA, 0x2D, 0xA7, 0x0D, 0xA0, 0xDA, 0x2D, 0xA7, 0x9D,
+    0x90, 0xDA, 0x2D, 0xA6, 0x9E, 0x1D, 0xA2, 0xDA, 0x99, 0x99, 0x99, 0xAE, 0x91, 0xDA, 0x2F, 0xFF,
+    0x92, 0xDA, 0x2F, 0xFD, 0xA3, 0x75, 0x99, 0x77, 0x09, 0xDA, 0x77, 0x9D, 0xA7, 0x19, 0x99, 0x99,
+    0x9A, 0xE9, 0x96, 0x9F, 0xFF, 0x69, 0xFF, 0xF7, 0x59, 0xDA, 0x77, 0x9D, 0xA7, 0xAF, 0xC9, 0x09,
+    0xDA, 0x59, 0xFF, 0xA0, 0xDA, 0x49, 0xF9, 0x99, 0xAF, 0xCA, 0x4E, 0xA5, 0xFA, 0x39, 0xE7, 0xEA,
+    0x3E, 0x97, 0xAD, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x70, 0x9D, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x71,
+    0xDA, 0x3E, 0x70, 0x9D, 0xA3, 0xE7, 0x09, 0xDA, 0x3E, 0x97, 0xAD, 0xA3, 0xAD, 0xA7, 0xEA, 0x4E,
+    0x95, 0xAE, 0xA4, 0xAE, 0xA2, 0x9A, 0xFA, 0x5A, 0xFF, 0xC0, 0xDA, 0x69, 0xFD, 0xA1, 0xDA, 0x71,
+    0x99, 0x77, 0x77, 0x77, 0x5F, 0xFF, 0xE4, 0xFF, 0xFE, 0x77, 0x50, 0x77, 0x73, 0xAF, 0xDA, 0x70,
+    0xAF, 0xFD, 0x95, 0xAF, 0xA9, 0xAA, 0xE5, 0xAE, 0x95, 0x99, 0x5E, 0x76, 0xAD, 0xA7, 0x6E, 0x76,
+    0x9D, 0xA7, 0x6A, 0xDA, 0x74, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC, 0xA6, 0xE7, 0x7E, 0x75, 0x99, 0xE9,
+    0x99, 0x99, 0x99, 0x6F, 0xFF, 0xA5, 0xFF, 0xF9, 0x79, 0xDA, 0x77, 0xE7, 0x7E, 0x97, 0x69, 0xE7,
+    0x7F, 0x77, 0xFA, 0x99, 0x99, 0xAD, 0x7F, 0xFE, 0x70, 0x9F, 0xF9, 0x73, 0x99, 0x94, 0x29, 0xD7,
+    0x0A, 0xD9, 0x3A, 0xD7, 0xAD, 0xA4, 0xAD, 0x69, 0xE5, 0xAD, 0x6E, 0x6A, 0xD5, 0xE7, 0xAD, 0x4E,
+    0x97, 0xAD, 0x3A, 0xDA, 0x70, 0xAD, 0x29, 0xE7, 0x1A, 0xD2, 0xE7, 0x2A, 0xD1, 0xE7, 0x19, 0x9A,
+    0xD9, 0xEA, 0x99, 0x99, 0x99, 0x2A, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0x5A, 0xEA, 0x9D, 0xA7, 0x2A,
+    0xDA, 0x1E, 0x97, 0x1A, 0xD3, 0xE7, 0x1A, 0xD3, 0x9D, 0xA7, 0x0A, 0xD4, 0xAD, 0x97, 0xAD, 0x5E,
+    0x7A, 0xD5, 0x9E, 0x6A, 0xD6, 0xAD, 0xA5, 0xAD, 0x7E, 0x94, 0xAD, 0x79, 0xE4, 0xAD, 0x70, 0xAD,
+    0xA0, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xC9, 0x9F, 0xFF, 0xFC, 0x97, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x19, 0xCA, 0x72, 0xE0, 0xAE, 0x72, 0xFD, 0xA7, 0x3F, 0xC7, 0x4A, 0xEA, 0x73, 0x9F, 0xC7,
+    0x3A, 0xFD, 0x19, 0xCA, 0x5E, 0xA0, 0xE0, 0xF5, 0x9C, 0x91, 0xFD, 0x97, 0x3F, 0xC7, 0x4A, 0xEA,
+    0x73, 0x9F, 0xC7, 0x3A, 0xFD, 0x72, 0xEA, 0x0E, 0x72, 0x9C, 0x91, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x70, 0x77, 0x77, 0x19, 0xAF, 0xEA, 0x97, 0x73, 0xFF, 0xFC, 0x77, 0x2A, 0xDA, 0xA9, 0x99, 0xAF,
+    0xC9, 0x77, 0x19, 0x70, 0xAE, 0x97, 0x74, 0x99, 0x4A, 0xE7, 0x73, 0xAD, 0x94, 0xAD, 0xA7, 0x72,
+    0xE6, 0xE7, 0x72, 0xE6, 0xE9, 0x77, 0x1D, 0xA6, 0xAD, 0x97, 0x70, 0x9D, 0x96, 0x9D, 0xA7, 0x70,
+    0xAD, 0x96, 0x9D, 0xA7, 0x70, 0xE7, 0x9D, 0xA7, 0x70, 0xE7, 0xAD, 0x97, 0x70, 0xDA, 0x7E, 0x93,
+    0xAF, 0xA5, 0x9D, 0x97, 0xE2, 0x9F, 0xF4, 0xAD, 0x79, 0xDA, 0x2E, 0xA9, 0x9E, 0xA3, 0xE7, 0xE9,
+    0x1A, 0xD9, 0x3E, 0x3E, 0x6A, 0xE2, 0xE4, 0xE2, 0x9D, 0xA5, 0x9E, 0x91, 0x9D, 0xA4, 0xE2, 0xAD,
+    0x94, 0x9E, 0xA2, 0xAD, 0x94, 0xE2, 0xAD, 0x39, 0xFA, 0x3E, 0x4A, 0xDA, 0x2E, 0xAA, 0xAF, 0xC9,
+    0x4E, 0xA2, 0xAE, 0x3F, 0xFC, 0xA6, 0xFF, 0xD9, 0x29, 0xFD, 0xA9, 0x79, 0xDA, 0xFC, 0xA7, 0x75,
+    0xAD, 0x29, 0x97, 0x77, 0xE7, 0x77, 0x4E, 0x77, 0x74, 0xDA, 0x77, 0x73, 0x9D, 0x97, 0x77, 0x3A,
+    0xD7, 0x77, 0x4E, 0x77, 0x74, 0xDA, 0x73, 0x77, 0x73, 0xAF, 0x97, 0x2F, 0xE7, 0x1A, 0xDA, 0x09,
+    0xE7, 0x0E, 0x2E, 0x70, 0xDA, 0x2A, 0xD7, 0x0D, 0xA2, 0xAD, 0x70, 0xE2, 0xAD, 0x70, 0xE2, 0xE7,
+    0x0A, 0xD2, 0xDA, 0x70, 0x9D, 0x90, 0x9D, 0x72, 0xDA, 0x0A, 0xD7, 0x2E, 0x0D, 0x97, 0x29, 0xFC,
+    0x74, 0xF9, 0x74, 0xAE, 0x70, 0x93, 0xAD, 0xA7, 0xAC, 0x3F, 0x7D, 0x91, 0xAF, 0xA5, 0xAE, 0x09,
+    0xD9, 0xE5, 0xFA, 0xE0, 0xAD, 0x93, 0xAD, 0x9F, 0x2D, 0xA3, 0xD9, 0x0E, 0xA2, 0xE2, 0xE2, 0xD3,
+    0x9D, 0x90, 0x9D, 0x92, 0xA9, 0x4D, 0xA7, 0x6E, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xAD, 0x76, 0xE7,
+    0x2A, 0x99, 0xAD, 0xA7, 0x19, 0xFD, 0x73, 0xFA, 0x20, 0x2A, 0xFD, 0xA9, 0x71, 0xFF, 0xDA, 0x7E,
+    0xAA, 0xAF, 0xD6, 0xE4, 0x9E, 0xA5, 0xE5, 0x9E, 0x2A, 0xFF, 0xFF, 0xCA, 0x9A, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAF, 0xAA, 0x2E, 0x69, 0xDA, 0x4E, 0x69, 0xDA, 0x29, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xDA,
+    0x90, 0xAF, 0xFF, 0xFC, 0xA9, 0xAA, 0xEA, 0xAA, 0xAA, 0xAA, 0xEA, 0xA9, 0x2E, 0x5E, 0xA5, 0xE1,
+    0x99, 0xAF, 0x6F, 0xFD, 0xA7, 0xFF, 0xA9, 0x70, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x74, 0x72, 0x97, 0x71, 0xAC, 0xA7, 0x59, 0xAF, 0xEA, 0x96, 0x9F, 0xFF, 0xC9,
+    0x3F, 0xFC, 0xAA, 0xF3, 0xFA, 0x1A, 0xCA, 0x3A, 0x92, 0xF9, 0x2A, 0xCA, 0x79, 0xE4, 0xAC, 0xA7,
+    0xEA, 0x4A, 0xCA, 0x69, 0xE5, 0xAC, 0xA6, 0xAD, 0xA5, 0xAC, 0xA6, 0xE9, 0x5A, 0xCA, 0x6E, 0x95,
+    0xAC, 0xA6, 0xE6, 0xAD, 0xAA, 0xAA, 0xAA, 0x9E, 0x6A, 0xFF, 0xF6, 0xAF, 0xFF, 0x95, 0xAC, 0xA2,
+    0x9E, 0xAD, 0xA5, 0xAC, 0xA3, 0xE9, 0xE5, 0xAC, 0xA3, 0xE0, 0xE9, 0x4A, 0xCA, 0x3E, 0x0A, 0xE4,
+    0xAC, 0xA3, 0xE1, 0xEA, 0x3A, 0xCA, 0x3E, 0x19, 0xF2, 0xAC, 0xA3, 0xE2, 0xAF, 0xCA, 0xAC, 0xA9,
+    0x9A, 0xF3, 0x9F, 0xFF, 0xE5, 0x9F, 0xFD, 0xA9, 0x72, 0xAC, 0xA9, 0x77, 0xAC, 0xA7, 0x70, 0x9A,
+    0x96, 0x79, 0xDA, 0x77, 0x0F, 0x77, 0x9F, 0x97, 0x6A, 0xFC, 0x76, 0xEA, 0xD7, 0x59, 0xDA, 0x9D,
+    0xA7, 0x4A, 0xD1, 0xE7, 0x4E, 0x1A, 0xD9, 0x72, 0x9D, 0xA1, 0x9D, 0xA5, 0xAF, 0xFF, 0xFE, 0x0A,
+    0xFF, 0xFF, 0xE4, 0xAD, 0xA3, 0x9E, 0x70, 0xE5, 0xE7, 0x9E, 0x5A, 0xD9, 0x3A, 0xFF, 0xFF, 0xE0,
+    0xAF, 0xFF, 0xFE, 0x29, 0xE7, 0xAD, 0xA4, 0xAD, 0x97, 0x0E, 0x4E, 0x71, 0xE9, 0x29, 0xDA, 0x71,
+    0xAD, 0xA2, 0xE9, 0x72, 0xE2, 0xE7, 0x3E, 0x90, 0x9D, 0xA7, 0x39, 0xDA, 0x0E, 0x97, 0x4E, 0x00,
+    0x77, 0x59, 0xAF, 0xDA, 0x96, 0xFF, 0xF5, 0xFA, 0xAA, 0xAF, 0xC4, 0xA9, 0x69, 0xE9, 0x75, 0xAD,
+    0xA7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x0A, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xC7, 0x9A,
+    0xFA, 0x70, 0x9A, 0xFA, 0x70, 0x9F, 0xCA, 0x69, 0x99, 0xAF, 0xA9, 0x99, 0x99, 0x99, 0x99, 0xAF,
+    0xFF, 0xFC, 0x9F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0x9D,
+    0xA7, 0x59, 0xE7, 0x6E, 0xA7, 0x09, 0x92, 0x9F, 0xA9, 0x99, 0x9A, 0xAD, 0xA3, 0xAF, 0xFF, 0xA4,
+    0x9A, 0xFF, 0xA9, 0x71, 0x99, 0x96, 0x71, 0x99, 0x77, 0x0D, 0x75, 0xAF, 0xEA, 0x96, 0xAF, 0xFF,
+    0x39, 0xFC, 0xAD, 0xAA, 0xE9, 0x3F, 0x91, 0xD2, 0x9A, 0x3F, 0x3D, 0x7A, 0xE4, 0xD7, 0xE9, 0x4D,
+    0x69, 0xE5, 0xD6, 0xAD, 0xA5, 0xD6, 0xE9, 0x5D, 0x6E, 0x95, 0xD6, 0xE6, 0xD6, 0xE6, 0xD6, 0xE9,
+    0x5D, 0x6E, 0x95, 0xD6, 0xAD, 0xA5, 0xD6, 0x9E, 0x5D, 0x7E, 0x94, 0xD7, 0xF4, 0xD7, 0x9E, 0xA3,
+    0xD7, 0x0A, 0xEA, 0x2D, 0x71, 0xAF, 0xAA, 0xD9, 0x9A, 0xD5, 0xAF, 0xFF, 0x7A, 0xFF, 0xCA, 0x72,
+    0x9D, 0x97, 0x7D, 0x77, 0x0A, 0xA6, 0x3A, 0xC5, 0xD7, 0x1D, 0x5D, 0x71, 0xD4, 0x9D, 0x70, 0x9D,
+    0x4A, 0xD7, 0xAF, 0xFF, 0xF0, 0x9F, 0xFF, 0xFD, 0x19, 0x9E, 0xA9, 0x9A, 0xAE, 0x99, 0x99, 0x93,
+    0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4,
+    0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4E, 0x70, 0xE4, 0xE7, 0x0E, 0x4A, 0xD9, 0x7E, 0x49,
+    0xE9, 0x19, 0x92, 0xE5, 0xFE, 0xA2, 0xE6, 0xFD, 0xA7, 0x69, 0x92, 0x77, 0x77, 0x19, 0xAF, 0xDA,
+    0x97, 0x3A, 0xFF, 0xE7, 0x1F, 0xA9, 0x99, 0xAE, 0xA7, 0x09, 0xE7, 0x97, 0x1E, 0x97, 0x72, 0xE7,
+    0x73, 0xE7, 0x73, 0xE7, 0x73, 0xAE, 0x77, 0x3F, 0x97, 0x71, 0x9F, 0xC9, 0x77, 0x09, 0xFD, 0xA7,
+    0x70, 0x9F, 0xDA, 0x77, 0x1A, 0xFC, 0x77, 0x2A, 0xF7, 0x73, 0xE9, 0x1A, 0xA2, 0xAA, 0xA2, 0xAA,
+    0x92, 0x9D, 0xA0, 0xF9, 0xFC, 0x9F, 0xC2, 0xDA, 0x0C, 0x09, 0xD9, 0x1E, 0x91, 0xD2, 0xDA, 0x0C,
+    0x99, 0xD2, 0x9C, 0xA2, 0xAC, 0x90, 0x9D, 0x90, 0xAC, 0xAC, 0xA2, 0x9C, 0x92, 0xAC, 0x90, 0xE2,
+    0xAE, 0x91, 0x9C, 0x92, 0xAC, 0xAE, 0x93, 0xAF, 0xFA, 0xAA, 0xFC, 0x95, 0xCA, 0xAF, 0xFE, 0x97,
+    0xCA, 0x29, 0xCA, 0x99, 0x9A, 0xC9, 0x70, 0xCA, 0x29, 0xC9, 0x2A, 0xC9, 0x70, 0xA9, 0x3A, 0x92,
+    0x9A, 0x50, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x9F, 0xFF, 0xFA, 0x77, 0x77, 0x39, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xA6, 0x9D, 0xA7, 0x59,
+    0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA,
+    0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75,
+    0x9D, 0xA7, 0x59, 0xDA, 0x60, 0x9F, 0xFF, 0xC9, 0x9F, 0xFF, 0xC9, 0x09, 0x9A, 0xFA, 0x99, 0x99,
+    0x95, 0x9E, 0x73, 0x9D, 0xA7, 0x3E, 0x49, 0xFF, 0xFC, 0x99, 0xFF, 0xFC, 0x96, 0xE7, 0x29, 0xE7,
+    0x19, 0xE9, 0x59, 0xAA, 0xFA, 0x59, 0xFD, 0x97, 0xE9, 0x72, 0xAD, 0xA7, 0x3E, 0x73, 0x9E, 0x73,
+    0xE9, 0x73, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x39, 0xE7, 0x3E, 0x97, 0x29, 0xE4, 0x3A, 0xD7, 0x7E,
+    0x77, 0xE7, 0x7E, 0x39, 0xAC, 0x70, 0xE0, 0x9A, 0xF7, 0x0F, 0xFA, 0x70, 0xAF, 0xCA, 0x71, 0xFD,
+    0x97, 0x29, 0xDA, 0xE3, 0xAD, 0x59, 0x1E, 0x09, 0xFC, 0x70, 0xFE, 0xA9, 0x79, 0xFC, 0xA9, 0x70,
+    0x9F, 0xD7, 0xAA, 0xA0, 0x9C, 0xA9, 0xE7, 0xE4, 0xE7, 0xE4, 0xE7, 0xE4, 0xE6, 0x9D, 0xA4, 0xE6,
+    0xE5, 0xE5, 0x9E, 0x5E, 0x5E, 0x95, 0xE3, 0x9E, 0xA6, 0xE9, 0x9A, 0xFA, 0x7F, 0xFC, 0x97, 0x0F,
+    0xE9, 0x77, 0x71, 0x77, 0x73, 0x9E, 0xA7, 0x73, 0xAF, 0xD7, 0x72, 0xD2, 0xDA, 0x77, 0x09, 0xCA,
+    0x29, 0xD7, 0x70, 0xAD, 0x3D, 0x97, 0x79, 0xD9, 0x2D, 0x97, 0x70, 0xFA, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x96, 0xFF, 0xFF, 0xFA, 0x59, 0xAF, 0xFF, 0xFE, 0x70, 0xD9, 0x72, 0x9D, 0xA7, 0xD9,
+    0x73, 0x9D, 0x7D, 0x97, 0x4D, 0x96, 0xD9, 0x1A, 0xA2, 0xA9, 0x3A, 0xC9, 0x6D, 0x90, 0xE9, 0x0A,
+    0xD9, 0x2A, 0xC9, 0x6D, 0xAF, 0xFD, 0x91, 0xD7, 0xFA, 0x0A, 0xE9, 0x9D, 0xAE, 0x7E, 0xA2, 0xAC,
+    0x3F, 0x7A, 0xE7, 0x74, 0xAF, 0x97, 0x72, 0x9D, 0x0E, 0x77, 0x3A, 0x19, 0xDA, 0x77, 0x6A, 0xEA,
+    0x99, 0x99, 0x9A, 0x97, 0x6A, 0xFF, 0xC9, 0x77, 0x9A, 0xFE, 0x97, 0x73, 0x99, 0x70, 0x72, 0xDA,
+    0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x19, 0xAA, 0xEA,
+    0xA9, 0x73, 0x9F, 0xFF, 0xA7, 0x0F, 0xFF, 0xFA, 0x5F, 0xA2, 0xE1, 0x9F, 0xA3, 0xAE, 0x4E, 0x3A,
+    0xE3, 0xE9, 0x4E, 0x4A, 0xDA, 0x19, 0xE5, 0xE5, 0xE1, 0xAD, 0x95, 0xE5, 0xAD, 0x90, 0xE6, 0xE5,
+    0x9D, 0xA0, 0xE6, 0xE5, 0x9D, 0xA0, 0xE6, 0xE6, 0xE0, 0xE6, 0xAA, 0x96, 0xE0, 0xE7, 0x70, 0xE0,
+    0xE7, 0x70, 0xE0, 0xE7, 0x70, 0xE0, 0xE7, 0x70, 0xE0, 0xE7, 0x70, 0xE0, 0x2A, 0xFE, 0xAA, 0x97,
+    0xFF, 0xF9, 0x5F, 0xAA, 0xAF, 0xDA, 0x4E, 0x6F, 0x4E, 0x7E, 0xA3, 0xE7, 0x9E, 0x3E, 0x70, 0xE3,
+    0xE7, 0x0E, 0x3E, 0x70, 0xE3, 0xE7, 0xAD, 0xA3, 0xE6, 0x9E, 0x93, 0xE9, 0x91, 0x9A, 0xFA, 0x1A,
+    0xFF, 0xFD, 0xA2, 0xAF, 0xFF, 0xA5, 0x99, 0xEA, 0x99, 0x99, 0x72, 0xE7, 0x7E, 0x74, 0x9A, 0xAF,
+    0xAA, 0xAA, 0xA6, 0xAF, 0xFD, 0xA6, 0x99, 0x9E, 0xA9, 0x99, 0x99, 0x71, 0xE7, 0x7E, 0x77, 0xE7,
+    0x7E, 0x74, 0x69, 0xA9, 0x19, 0xA9, 0x75, 0xAC, 0xA1, 0xAC, 0x97, 0x5A, 0xD9, 0x9D, 0x97, 0x4A,
+    0xFF, 0xA7, 0x1A, 0xFF, 0xF9, 0x6F, 0xDA, 0x1A, 0xFC, 0xA4, 0xAE, 0x0A, 0xCA, 0x1A, 0xC9, 0x0E,
+    0x92, 0x9E, 0x1A, 0xCA, 0x1A, 0xC9, 0x1E, 0x2E, 0x91, 0xAC, 0xA1, 0xAC, 0x91, 0xAD, 0xA1, 0xE2,
+    0xAC, 0xA1, 0xAC, 0x92, 0xE0, 0x9D, 0xA2, 0xAC, 0xA1, 0xAC, 0x92, 0xE9, 0xAD, 0x92, 0xAC, 0xA1,
+    0xAC, 0x92, 0xAD, 0x9E, 0x92, 0xAC, 0xA1, 0xAC, 0x92, 0xAD, 0xAE, 0x92, 0xAC, 0xA1, 0xAC, 0x92,
+    0x9D, 0xAE, 0x93, 0x92, 0x99, 0x49, 0x99, 0xAD, 0x97, 0x71, 0xAD, 0xA7, 0x71, 0x9E, 0x77, 0x2E,
+    0x77, 0x2A, 0xDA, 0x77, 0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2E, 0xA7, 0x70, 0x99, 0xFC, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x10, 0x77, 0x1A, 0xC9, 0x1D, 0x7A, 0xC9,
+    0x1D, 0x7A, 0xC9, 0x1D, 0x4A, 0xFF, 0xC4, 0xFF, 0xF2, 0xFF, 0xFC, 0x1E, 0x59, 0xEA, 0x0E, 0x69,
+    0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE7, 0xE0, 0xE6, 0x9D, 0xA0, 0xE5, 0x9E, 0x1F, 0xAA, 0xAA, 0xF9,
+    0x1F, 0xFD, 0xA3, 0xFF, 0xFA, 0x1E, 0x59, 0xF0, 0xE7, 0xE9, 0xE7, 0xAD, 0xAE, 0x79, 0xFD, 0x79,
+    0xFD, 0x7A, 0xFD, 0x7E, 0xAE, 0x6A, 0xE0, 0xEA, 0xAA, 0xAA, 0xAF, 0xA0, 0xFF, 0xF9, 0x1F, 0xFD,
+    0xA6, 0xAC, 0x91, 0xD7, 0xAC, 0x91, 0xD7, 0xAC, 0x91, 0xD7, 0x09, 0x29, 0x50, 0x77, 0x2A, 0xFD,
+    0xA3, 0x9F, 0xFC, 0x91, 0x9F, 0xA9, 0x9A, 0xD2, 0xEA, 0x70, 0xAD, 0xA7, 0x1E, 0x72, 0xE7, 0x19,
+    0xDA, 0x71, 0x9D, 0xA7, 0x19, 0xDA, 0x71, 0x9D, 0xA7, 0x2E, 0x72, 0xE7, 0x2A, 0xDA, 0x71, 0x9E,
+    0x97, 0x1A, 0xEA, 0x91, 0x9A, 0xC9, 0x2A, 0xFF, 0xC9, 0x39, 0xFE, 0xA7, 0x09, 0x97, 0x72, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x1F, 0xFF, 0xA0, 0xFF, 0xF9, 0x9F, 0xFF, 0xE9, 0x9F, 0xFF, 0xE9,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x77, 0x77, 0x75, 0xC9, 0x77, 0x73, 0xE9,
+    0x77, 0x71, 0xFC, 0x97, 0x77, 0xFE, 0x97, 0x75, 0xFF, 0xC9, 0x77, 0x3F, 0xFE, 0x97, 0x71, 0xEA,
+    0x92, 0x9A, 0xE9, 0x77, 0xDA, 0x70, 0xE9, 0x75, 0xEA, 0x71, 0xE9, 0x73, 0xFC, 0x19, 0xAA, 0xA3,
+    0xF9, 0x71, 0xFD, 0xAF, 0xC9, 0x2A, 0xF9, 0x7F, 0xFF, 0xCA, 0x2A, 0xFC, 0x95, 0xFF, 0xFD, 0x3F,
+    0xE9, 0x3F, 0xFF, 0xD3, 0x9F, 0xF9, 0x1F, 0xFF, 0xD3, 0x9F, 0xFD, 0x90, 0xFF, 0xFC, 0x39, 0xFF,
+    0xE9, 0x1F, 0xFE, 0xA2, 0xAF, 0xFE, 0x93, 0xFF, 0xD9, 0x2F, 0xFE, 0x95, 0xFF, 0xC9, 0x19, 0xFF,
+    0xD9, 0x7F, 0xFF, 0xFF, 0xC9, 0x71, 0xFF, 0xFF, 0xE9, 0x73, 0xFE, 0x99, 0xAF, 0xE9, 0x75, 0xFC,
+    0x3F, 0xD9, 0x77, 0xF3, 0xAF, 0x97, 0x71, 0xE3, 0xF9, 0x77, 0x3E, 0x99, 0xAE, 0x97, 0x75, 0xFE,
+    0x97, 0x77, 0xFC, 0x97, 0x77, 0x1E, 0x97, 0x77, 0x3C, 0x97, 0x77, 0x77, 0x40,
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 5, 25, 9, 2, 24, 32, 0 }, // !
-    { 10, 9, 14, 2, 24, 23, 32 }, // "
-    { 21, 24, 22, 0, 24, 126, 55 }, // #
-    { 16, 28, 19, 2, 26, 112, 181 }, // $
-    { 26, 26, 28, 1, 25, 169, 293 }, // %
-    { 24, 26, 26, 1, 25, 156, 462 }, // &
-    { 4, 9, 8, 2, 24, 9, 618 }, // '
-    { 8, 30, 10, 1, 24, 60, 627 }, // (
-    { 8, 30, 10, 1, 24, 60, 687 }, // )
-    { 16, 16, 18, 1, 26, 64, 747 }, // *
-    { 17, 17, 19, 1, 20, 73, 811 }, // +
-    { 6, 9, 9, 1, 4, 14, 884 }, // ,
-    { 9, 4, 11, 1, 11, 9, 898 }, // -
-    { 5, 6, 9, 2, 5, 8, 907 }, // .
-    { 13, 24, 14, 0, 24, 78, 915 }, // /
-    { 17, 26, 19, 1, 25, 111, 993 }, // 0
-    { 10, 24, 19, 2, 24, 60, 1104 }, // 1
-    { 17, 25, 19, 1, 25, 107, 1164 }, // 2
-    { 17, 26, 19, 1, 25, 111, 1271 }, // 3
-    { 19, 24, 20, 0, 24, 114, 1382 }, // 4
-    { 16, 25, 19, 2, 24, 100, 1496 }, // 5
-    { 17, 26, 19, 1, 25, 111, 1596 }, // 6
-    { 17, 24, 19, 1, 24, 102, 1707 }, // 7
-    { 17, 26, 19, 1, 25, 111, 1809 }, // 8
-    { 17, 26, 19, 1, 25, 111, 1920 }, // 9
-    { 5, 20, 9, 2, 19, 25, 2031 }, // :
-    { 6, 24, 9, 1, 19, 36, 2056 }, // ;
-    { 17, 18, 19, 1, 21, 77, 2092 }, // <
-    { 17, 10, 19, 1, 17, 43, 2169 }, // =
-    { 17, 18, 19, 1, 21, 77, 2212 }, // >
-    { 14, 26, 15, 0, 25, 91, 2289 }, // ?
-    { 28, 27, 30, 1, 24, 189, 2380 }, // @
-    { 22, 24, 23, 0, 24, 132, 2569 }, // A
-    { 17, 24, 22, 3, 24, 102, 2701 }, // B
-    { 19, 26, 22, 2, 25, 124, 2803 }, // C
-    { 20, 24, 24, 3, 24, 120, 2927 }, // D
-    { 14, 24, 19, 3, 24, 84, 3047 }, // E
-    { 14, 24, 18, 3, 24, 84, 3131 }, // F
-    { 20, 26, 24, 2, 25, 130, 3215 }, // G
-    { 19, 24, 25, 3, 24, 114, 3345 }, // H
-    { 9, 24, 11, 1, 24, 54, 3459 }, // I
-    { 10, 31, 9, -3, 24, 78, 3513 }, // J
-    { 18, 24, 22, 3, 24, 108, 3591 }, // K
-    { 14, 24, 18, 3, 24, 84, 3699 }, // L
-    { 24, 24, 30, 3, 24, 144, 3783 }, // M
-    { 20, 24, 25, 3, 24, 120, 3927 }, // N
-    { 22, 26, 26, 2, 25, 143, 4047 }, // O
-    { 16, 24, 20, 3, 24, 96, 4190 }, // P
-    { 22, 31, 26, 2, 25, 171, 4286 }, // Q
-    { 18, 24, 22, 3, 24, 108, 4457 }, // R
-    { 16, 26, 18, 1, 25, 104, 4565 }, // S
-    { 19, 24, 20, 0, 24, 114, 4669 }, // T
-    { 19, 25, 24, 3, 24, 119, 4783 }, // U
-    { 20, 24, 21, 0, 24, 120, 4902 }, // V
-    { 31, 24, 32, 0, 24, 186, 5022 }, // W
-    { 20, 24, 21, 0, 24, 120, 5208 }, // X
-    { 19, 24, 20, 0, 24, 114, 5328 }, // Y
-    { 17, 24, 19, 1, 24, 102, 5442 }, // Z
-    { 9, 30, 12, 2, 24, 68, 5544 }, // [
-    { 13, 24, 14, 0, 24, 78, 5612 }, // <backslash>
-    { 9, 30, 11, 0, 24, 68, 5690 }, // ]
-    { 17, 16, 19, 1, 24, 68, 5758 }, // ^
-    { 16, 3, 16, -1, -3, 12, 5826 }, // _
-    { 8, 6, 10, 1, 26, 12, 5838 }, // `
-    { 15, 20, 19, 1, 19, 75, 5850 }, // a
-    { 17, 27, 21, 2, 26, 115, 5925 }, // b
-    { 14, 20, 16, 1, 19, 70, 6040 }, // c
-    { 17, 27, 21, 1, 26, 115, 6110 }, // d
-    { 17, 20, 19, 1, 19, 85, 6225 }, // e
-    { 13, 26, 14, 0, 26, 85, 6310 }, // f
-    { 17, 27, 21, 1, 19, 115, 6395 }, // g
-    { 16, 26, 21, 2, 26, 104, 6510 }, // h
-    { 5, 25, 9, 2, 25, 32, 6614 }, // i
-    { 9, 33, 9, -2, 25, 75, 6646 }, // j
-    { 16, 26, 19, 2, 26, 104, 6721 }, // k
-    { 4, 26, 9, 2, 26, 26, 6825 }, // l
-    { 27, 19, 31, 2, 19, 129, 6851 }, // m
-    { 16, 19, 21, 2, 19, 76, 6980 }, // n
-    { 18, 20, 20, 1, 19, 90, 7056 }, // o
-    { 17, 27, 21, 2, 19, 115, 7146 }, // p
-    { 17, 27, 21, 1, 19, 115, 7261 }, // q
-    { 12, 19, 15, 2, 19, 57, 7376 }, // r
-    { 14, 20, 16, 1, 19, 70, 7433 }, // s
-    { 12, 23, 13, 0, 22, 69, 7503 }, // t
-    { 16, 19, 21, 2, 18, 76, 7572 }, // u
-    { 17, 18, 18, 0, 18, 77, 7648 }, // v
-    { 26, 18, 27, 0, 18, 117, 7725 }, // w
-    { 18, 18, 19, 0, 18, 81, 7842 }, // x
-    { 17, 26, 18, 0, 18, 111, 7923 }, // y
-    { 14, 18, 16, 1, 18, 63, 8034 }, // z
-    { 12, 30, 13, 0, 24, 90, 8097 }, // {
-    { 4, 35, 18, 7, 26, 35, 8187 }, // |
-    { 11, 30, 13, 1, 24, 83, 8222 }, // }
-    { 17, 5, 19, 1, 14, 22, 8305 }, // ~
-    { 0, 0, 9, 0, 0, 0, 8327 }, //  
-    { 5, 26, 9, 2, 19, 33, 8327 }, // ¡
-    { 14, 26, 19, 3, 25, 91, 8360 }, // ¢
-    { 17, 25, 19, 1, 25, 107, 8451 }, // £
-    { 17, 16, 19, 1, 20, 68, 8558 }, // ¤
-    { 19, 24, 20, 0, 24, 114, 8626 }, // ¥
-    { 4, 35, 18, 7, 26, 35, 8740 }, // ¦
-    { 14, 27, 17, 1, 26, 95, 8775 }, // §
-    { 11, 4, 19, 4, 25, 11, 8870 }, // ¨
-    { 26, 26, 28, 1, 25, 169, 8881 }, // ©
-    { 10, 13, 12, 1, 25, 33, 9050 }, // ª
-    { 15, 15, 17, 1, 16, 57, 9083 }, // «
-    { 17, 9, 19, 1, 13, 39, 9140 }, // ¬
-    { 9, 4, 11, 1, 11, 9, 9179 }, // ­
-    { 26, 26, 28, 1, 25, 169, 9188 }, // ®
-    { 18, 3, 18, -1, 28, 14, 9357 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 9371 }, // °
-    { 17, 20, 19, 1, 20, 85, 9407 }, // ±
-    { 11, 16, 12, 0, 29, 44, 9492 }, // ²
-    { 11, 16, 12, 0, 29, 44, 9536 }, // ³
-    { 8, 6, 10, 1, 26, 12, 9580 }, // ´
-    { 16, 26, 21, 2, 18, 104, 9592 }, // µ
-    { 18, 31, 22, 1, 26, 140, 9696 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 9836 }, // ·
-    { 8, 8, 9, 0, 0, 16, 9844 }, // ¸
-    { 7, 16, 12, 1, 29, 28, 9860 }, // ¹
-    { 11, 13, 13, 1, 25, 36, 9888 }, // º
-    { 15, 15, 17, 1, 16, 57, 9924 }, // »
-    { 24, 24, 26, 1, 24, 144, 9981 }, // ¼
-    { 25, 24, 26, 0, 24, 150, 10125 }, // ½
-    { 26, 25, 27, 0, 25, 163, 10275 }, // ¾
-    { 14, 26, 15, 0, 19, 91, 10438 }, // ¿
-    { 22, 32, 23, 0, 32, 176, 10529 }, // À
-    { 22, 32, 23, 0, 32, 176, 10705 }, // Á
-    { 22, 32, 23, 0, 32, 176, 10881 }, // Â
-    { 22, 31, 23, 0, 31, 171, 11057 }, // Ã
-    { 22, 31, 23, 0, 31, 171, 11228 }, // Ä
-    { 22, 30, 23, 0, 30, 165, 11399 }, // Å
-    { 29, 24, 29, -1, 24, 174, 11564 }, // Æ
-    { 19, 33, 22, 2, 25, 157, 11738 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 11895 }, // È
-    { 14, 32, 19, 3, 32, 112, 12007 }, // É
-    { 14, 32, 19, 3, 32, 112, 12119 }, // Ê
-    { 14, 31, 19, 3, 31, 109, 12231 }, // Ë
-    { 9, 32, 11, 1, 32, 72, 12340 }, // Ì
-    { 10, 32, 12, 1, 32, 80, 12412 }, // Í
-    { 12, 32, 13, 0, 32, 96, 12492 }, // Î
-    { 10, 31, 12, 1, 31, 78, 12588 }, // Ï
-    { 22, 24, 24, 1, 24, 132, 12666 }, // Ð
-    { 20, 31, 25, 3, 31, 155, 12798 }, // Ñ
-    { 22, 33, 26, 2, 32, 182, 12953 }, // Ò
-    { 22, 33, 26, 2, 32, 182, 13135 }, // Ó
-    { 22, 33, 26, 2, 32, 182, 13317 }, // Ô
-    { 22, 32, 26, 2, 31, 176, 13499 }, // Õ
-    { 22, 32, 26, 2, 31, 176, 13675 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 13851 }, // ×
-    { 22, 27, 26, 2, 25, 149, 13911 }, // Ø
-    { 19, 33, 24, 3, 32, 157, 14060 }, // Ù
-    { 19, 33, 24, 3, 32, 157, 14217 }, // Ú
-    { 19, 33, 24, 3, 32, 157, 14374 }, // Û
-    { 19, 32, 24, 3, 31, 152, 14531 }, // Ü
-    { 19, 32, 20, 0, 32, 152, 14683 }, // Ý
-    { 16, 24, 20, 3, 24, 96, 14835 }, // Þ
-    { 18, 27, 21, 2, 26, 122, 14931 }, // ß
-    { 15, 27, 19, 1, 26, 102, 15053 }, // à
-    { 15, 27, 19, 1, 26, 102, 15155 }, // á
-    { 15, 27, 19, 1, 26, 102, 15257 }, // â
-    { 15, 26, 19, 1, 25, 98, 15359 }, // ã
-    { 15, 26, 19, 1, 25, 98, 15457 }, // ä
-    { 15, 29, 19, 1, 28, 109, 15555 }, // å
-    { 27, 20, 29, 1, 19, 135, 15664 }, // æ
-    { 14, 27, 16, 1, 19, 95, 15799 }, // ç
-    { 17, 27, 19, 1, 26, 115, 15894 }, // è
-    { 17, 27, 19, 1, 26, 115, 16009 }, // é
-    { 17, 27, 19, 1, 26, 115, 16124 }, // ê
-    { 17, 26, 19, 1, 25, 111, 16239 }, // ë
-    { 8, 26, 9, -1, 26, 52, 16350 }, // ì
-    { 8, 26, 11, 2, 26, 52, 16402 }, // í
-    { 12, 26, 11, -2, 26, 78, 16454 }, // î
-    { 10, 25, 10, -1, 25, 63, 16532 }, // ï
-    { 18, 27, 20, 1, 26, 122, 16595 }, // ð
-    { 16, 25, 21, 2, 25, 100, 16717 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 16817 }, // ò
-    { 18, 27, 20, 1, 26, 122, 16939 }, // ó
-    { 18, 27, 20, 1, 26, 122, 17061 }, // ô
-    { 18, 26, 20, 1, 25, 117, 17183 }, // õ
-    { 18, 26, 20, 1, 25, 117, 17300 }, // ö
-    { 17, 16, 19, 1, 20, 68, 17417 }, // ÷
-    { 18, 21, 20, 1, 19, 95, 17485 }, // ø
-    { 16, 27, 21, 2, 26, 108, 17580 }, // ù
-    { 16, 27, 21, 2, 26, 108, 17688 }, // ú
-    { 16, 27, 21, 2, 26, 108, 17796 }, // û
-    { 16, 26, 21, 2, 25, 104, 17904 }, // ü
-    { 17, 34, 18, 0, 26, 145, 18008 }, // ý
-    { 17, 34, 21, 2, 26, 145, 18153 }, // þ
-    { 17, 33, 18, 0, 25, 141, 18298 }, // ÿ
-    { 22, 29, 23, 0, 29, 160, 18439 }, // Ā
-    { 15, 24, 19, 1, 23, 90, 18599 }, // ā
-    { 22, 31, 23, 0, 31, 171, 18689 }, // Ă
-    { 15, 26, 19, 1, 25, 98, 18860 }, // ă
-    { 22, 32, 23, 0, 24, 176, 18958 }, // Ą
-    { 16, 27, 19, 1, 19, 108, 19134 }, // ą
-    { 19, 33, 22, 2, 32, 157, 19242 }, // Ć
-    { 14, 27, 16, 1, 26, 95, 19399 }, // ć
-    { 19, 33, 22, 2, 32, 157, 19494 }, // Ĉ
-    { 15, 27, 17, 1, 26, 102, 19651 }, // ĉ
-    { 19, 32, 22, 2, 31, 152, 19753 }, // Ċ
-    { 14, 26, 16, 1, 25, 91, 19905 }, // ċ
-    { 19, 33, 22, 2, 32, 157, 19996 }, // Č
-    { 15, 27, 17, 1, 26, 102, 20153 }, // č
-    { 20, 32, 24, 3, 32, 160, 20255 }, // Ď
-    { 22, 27, 24, 1, 26, 149, 20415 }, // ď
-    { 22, 24, 24, 1, 24, 132, 20564 }, // Đ
-    { 20, 27, 22, 1, 26, 135, 20696 }, // đ
-    { 14, 29, 19, 3, 29, 102, 20831 }, // Ē
-    { 17, 24, 19, 1, 23, 102, 20933 }, // ē
-    { 14, 31, 19, 3, 31, 109, 21035 }, // Ĕ
-    { 17, 26, 19, 1, 25, 111, 21144 }, // ĕ
-    { 14, 31, 19, 3, 31, 109, 21255 }, // Ė
-    { 17, 26, 19, 1, 25, 111, 21364 }, // ė
-    { 14, 32, 19, 3, 24, 112, 21475 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 21587 }, // ę
-    { 14, 32, 19, 3, 32, 112, 21702 }, // Ě
-    { 17, 27, 19, 1, 26, 115, 21814 }, // ě
-    { 20, 33, 24, 2, 32, 165, 21929 }, // Ĝ
-    { 17, 34, 21, 1, 26, 145, 22094 }, // ĝ
-    { 20, 32, 24, 2, 31, 160, 22239 }, // Ğ
-    { 17, 33, 21, 1, 25, 141, 22399 }, // ğ
-    { 20, 32, 24, 2, 31, 160, 22540 }, // Ġ
-    { 17, 33, 21, 1, 25, 141, 22700 }, // ġ
-    { 20, 33, 24, 2, 25, 165, 22841 }, // Ģ
-    { 17, 34, 21, 1, 26, 145, 23006 }, // ģ
-    { 19, 32, 25, 3, 32, 152, 23151 }, // Ĥ
-    { 20, 33, 21, -2, 33, 165, 23303 }, // ĥ
-    { 25, 24, 26, 0, 24, 150, 23468 }, // Ħ
-    { 18, 26, 21, 0, 26, 117, 23618 }, // ħ
-    { 13, 31, 13, -1, 31, 101, 23735 }, // Ĩ
-    { 13, 25, 12, -2, 25, 82, 23836 }, // ĩ
-    { 11, 29, 12, 0, 29, 80, 23918 }, // Ī
-    { 11, 23, 11, -1, 23, 64, 23998 }, // ī
-    { 11, 31, 12, 0, 31, 86, 24062 }, // Ĭ
-    { 11, 25, 11, -1, 25, 69, 24148 }, // ĭ
-    { 9, 32, 11, 1, 24, 72, 24217 }, // Į
-    { 7, 33, 9, 0, 25, 58, 24289 }, // į
-    { 9, 31, 11, 1, 31, 70, 24347 }, // İ
-    { 4, 18, 9, 2, 18, 18, 24417 }, // ı
-    { 17, 31, 20, 1, 24, 132, 24435 }, // Ĳ
-    { 13, 33, 17, 2, 25, 108, 24567 }, // ĳ
-    { 14, 39, 12, -3, 32, 137, 24675 }, // Ĵ
-    { 12, 34, 11, -2, 26, 102, 24812 }, // ĵ
-    { 18, 32, 22, 3, 24, 144, 24914 }, // Ķ
-    { 16, 34, 19, 2, 26, 136, 25058 }, // ķ
-    { 16, 18, 19, 2, 18, 72, 25194 }, // ĸ
-    { 15, 32, 18, 2, 32, 120, 25266 }, // Ĺ
-    { 8, 33, 11, 2, 33, 66, 25386 }, // ĺ
-    { 14, 32, 18, 3, 24, 112, 25452 }, // Ļ
-    { 5, 34, 9, 2, 26, 43, 25564 }, // ļ
-    { 14, 24, 18, 3, 24, 84, 25607 }, // Ľ
-    { 10, 26, 13, 2, 26, 65, 25691 }, // ľ
-    { 14, 24, 18, 3, 24, 84, 25756 }, // Ŀ
-    { 9, 26, 12, 2, 26, 59, 25840 }, // ŀ
-    { 17, 24, 18, 0, 24, 102, 25899 }, // Ł
-    { 10, 26, 10, -1, 26, 65, 26001 }, // ł
-    { 20, 32, 25, 3, 32, 160, 26066 }, // Ń
-    { 16, 26, 21, 2, 26, 104, 26226 }, // ń
-    { 20, 32, 25, 3, 24, 160, 26330 }, // Ņ
-    { 16, 27, 21, 2, 19, 108, 26490 }, // ņ
-    { 20, 32, 25, 3, 32, 160, 26598 }, // Ň
-    { 16, 26, 21, 2, 26, 104, 26758 }, // ň
-    { 21, 24, 23, 0, 24, 126, 26862 }, // ŉ
-    { 20, 31, 25, 3, 24, 155, 26988 }, // Ŋ
-    { 16, 27, 21, 2, 19, 108, 27143 }, // ŋ
-    { 22, 30, 26, 2, 29, 165, 27251 }, // Ō
-    { 18, 24, 20, 1, 23, 108, 27416 }, // ō
-    { 22, 32, 26, 2, 31, 176, 27524 }, // Ŏ
-    { 18, 26, 20, 1, 25, 117, 27700 }, // ŏ
-    { 22, 33, 26, 2, 32, 182, 27817 }, // Ő
-    { 18, 27, 20, 1, 26, 122, 27999 }, // ő
-    { 27, 26, 31, 2, 25, 176, 28121 }, // Œ
-    { 29, 20, 32, 1, 19, 145, 28297 }, // œ
-    { 18, 32, 22, 3, 32, 144, 28442 }, // Ŕ
-    { 12, 26, 15, 2, 26, 78, 28586 }, // ŕ
-    { 18, 32, 22, 3, 24, 144, 28664 }, // Ŗ
-    { 12, 27, 15, 2, 19, 81, 28808 }, // ŗ
-    { 18, 32, 22, 3, 32, 144, 28889 }, // Ř
-    { 12, 26, 15, 2, 26, 78, 29033 }, // ř
-    { 16, 33, 18, 1, 32, 132, 29111 }, // Ś
-    { 14, 27, 16, 1, 26, 95, 29243 }, // ś
-    { 16, 33, 18, 1, 32, 132, 29338 }, // Ŝ
-    { 14, 27, 16, 1, 26, 95, 29470 }, // ŝ
-    { 16, 33, 18, 1, 25, 132, 29565 }, // Ş
-    { 14, 27, 16, 1, 19, 95, 29697 }, // ş
-    { 16, 33, 18, 1, 32, 132, 29792 }, // Š
-    { 14, 27, 16, 1, 26, 95, 29924 }, // š
-    { 19, 32, 20, 0, 24, 152, 30019 }, // Ţ
-    { 12, 30, 13, 0, 22, 90, 30171 }, // ţ
-    { 19, 32, 20, 0, 32, 152, 30261 }, // Ť
-    { 16, 27, 17, 0, 26, 108, 30413 }, // ť
-    { 19, 24, 20, 0, 24, 114, 30521 }, // Ŧ
-    { 12, 23, 13, 0, 22, 69, 30635 }, // ŧ
-    { 19, 32, 24, 3, 31, 152, 30704 }, // Ũ
-    { 16, 26, 21, 2, 25, 104, 30856 }, // ũ
-    { 19, 30, 24, 3, 29, 143, 30960 }, // Ū
-    { 16, 24, 21, 2, 23, 96, 31103 }, // ū
-    { 19, 32, 24, 3, 31, 152, 31199 }, // Ŭ
-    { 16, 26, 21, 2, 25, 104, 31351 }, // ŭ
-    { 19, 35, 24, 3, 34, 167, 31455 }, // Ů
-    { 16, 29, 21, 2, 28, 116, 31622 }, // ů
-    { 19, 33, 24, 3, 32, 157, 31738 }, // Ű
-    { 16, 27, 21, 2, 26, 108, 31895 }, // ű
-    { 19, 32, 24, 3, 24, 152, 32003 }, // Ų
-    { 17, 26, 21, 2, 18, 111, 32155 }, // ų
-    { 31, 32, 32, 0, 32, 248, 32266 }, // Ŵ
-    { 26, 26, 27, 0, 26, 169, 32514 }, // ŵ
-    { 19, 32, 20, 0, 32, 152, 32683 }, // Ŷ
-    { 17, 34, 18, 0, 26, 145, 32835 }, // ŷ
-    { 19, 31, 20, 0, 31, 148, 32980 }, // Ÿ
-    { 17, 32, 19, 1, 32, 136, 33128 }, // Ź
-    { 14, 26, 16, 1, 26, 91, 33264 }, // ź
-    { 17, 31, 19, 1, 31, 132, 33355 }, // Ż
-    { 14, 25, 16, 1, 25, 88, 33487 }, // ż
-    { 17, 32, 19, 1, 32, 136, 33575 }, // Ž
-    { 14, 26, 16, 1, 26, 91, 33711 }, // ž
-    { 11, 26, 14, 2, 26, 72, 33802 }, // ſ
-    { 25, 27, 28, 2, 26, 169, 33874 }, // Ơ
-    { 21, 22, 23, 1, 21, 116, 34043 }, // ơ
-    { 31, 26, 36, 2, 25, 202, 34159 }, // Ƣ
-    { 25, 27, 28, 1, 19, 169, 34361 }, // ƣ
-    { 22, 24, 23, 0, 24, 132, 34530 }, // Ƥ
-    { 17, 34, 21, 2, 26, 145, 34662 }, // ƥ
-    { 18, 28, 22, 3, 24, 126, 34807 }, // Ʀ
-    { 16, 26, 18, 1, 25, 104, 34933 }, // Ƨ
-    { 14, 20, 16, 1, 19, 70, 35037 }, // ƨ
-    { 17, 24, 19, 1, 24, 102, 35107 }, // Ʃ
-    { 15, 34, 15, -1, 26, 128, 35209 }, // ƪ
-    { 12, 30, 13, 0, 22, 90, 35337 }, // ƫ
-    { 19, 24, 20, 0, 24, 114, 35427 }, // Ƭ
-    { 12, 27, 13, 0, 26, 81, 35541 }, // ƭ
-    { 19, 32, 20, 0, 24, 152, 35622 }, // Ʈ
-    { 25, 27, 29, 3, 26, 169, 35774 }, // Ư
-    { 22, 22, 25, 2, 21, 121, 35943 }, // ư
-    { 8, 6, 0, -17, 26, 12, 36064 }, // ̀
-    { 7, 6, 0, -11, 26, 11, 36076 }, // ́
-    { 12, 6, 7, -6, 26, 18, 36087 }, // ̂
-    { 13, 5, 0, -17, 25, 17, 36105 }, // ̃
-    { 10, 3, 6, -5, 23, 8, 36122 }, // ̄
-    { 14, 4, 8, -7, 29, 14, 36130 }, // ̅
-    { 12, 5, 7, -6, 25, 15, 36144 }, // ̆
-    { 4, 5, 3, -2, 25, 5, 36159 }, // ̇
-    { 10, 4, 6, -5, 25, 10, 36164 }, // ̈
-    { 7, 9, 0, -13, 28, 16, 36174 }, // ̉
-    { 8, 8, 5, -4, 28, 16, 36190 }, // ̊
-    { 13, 6, 9, -5, 26, 20, 36206 }, // ̋
-    { 12, 6, 7, -6, 26, 18, 36226 }, // ̌
-    { 4, 7, 3, -2, 26, 7, 36244 }, // ̍
-    { 8, 7, 5, -4, 26, 14, 36251 }, // ̎
-    { 13, 6, 0, -18, 26, 20, 36265 }, // ̏
-    { 12, 9, 7, -6, 29, 27, 36285 }, // ̐
-    { 12, 5, 7, -6, 25, 15, 36312 }, // ̑
-    { 6, 9, 4, -3, 24, 14, 36327 }, // ̒
-    { 6, 9, 4, -3, 24, 14, 36341 }, // ̓
-    { 6, 9, 4, -3, 24, 14, 36355 }, // ̔
-    { 6, 9, 4, -3, 24, 14, 36369 }, // ̕
-    { 8, 6, 5, -4, -1, 12, 36383 }, // ̖
-    { 8, 6, 5, -4, -1, 12, 36395 }, // ̗
-    { 6, 8, 4, -3, 0, 12, 36407 }, // ̘
-    { 6, 8, 4, -3, 0, 12, 36419 }, // ̙
-    { 10, 9, 11, 0, 26, 23, 36431 }, // ̚
-    { 8, 8, 5, -4, 26, 16, 36454 }, // ̛
-    { 4, 8, 3, -2, 0, 8, 36470 }, // ̜
-    { 8, 6, 5, -4, -1, 12, 36478 }, // ̝
-    { 8, 6, 5, -4, -1, 12, 36490 }, // ̞
-    { 8, 8, 5, -4, 0, 16, 36502 }, // ̟
-    { 8, 3, 5, -4, -2, 6, 36518 }, // ̠
-    { 6, 10, 1, -6, 2, 15, 36524 }, // ̡
-    { 6, 10, 7, 0, 2, 15, 36539 }, // ̢
-    { 4, 4, 0, -12, -2, 4, 36554 }, // ̣
-    { 10, 4, 6, -5, -2, 10, 36558 }, // ̤
-    { 8, 8, 5, -4, 0, 16, 36568 }, // ̥
-    { 6, 6, 4, -3, -2, 9, 36584 }, // ̦
-    { 8, 8, 5, -4, 0, 16, 36593 }, // ̧
-    { 6, 9, 4, -3, 1, 14, 36609 }, // ̨
-    { 4, 7, 3, -2, -1, 7, 36623 }, // ̩
-    { 12, 7, 7, -6, -1, 21, 36630 }, // ̪
-    { 14, 4, 8, -7, -2, 14, 36651 }, // ̫
-    { 12, 6, 7, -6, -1, 18, 36665 }, // ̬
-    { 12, 6, 7, -6, -1, 18, 36683 }, // ̭
-    { 12, 5, 7, -6, -1, 15, 36701 }, // ̮
-    { 12, 5, 7, -6, -1, 15, 36716 }, // ̯
-    { 14, 5, 8, -7, -1, 18, 36731 }, // ̰
-    { 10, 3, 6, -5, -2, 8, 36749 }, // ̱
-    { 16, 3, 9, -8, -3, 12, 36757 }, // ̲
-    { 14, 8, 8, -7, 0, 28, 36769 }, // ̳
-    { 13, 5, 8, -6, 12, 17, 36797 }, // ̴
-    { 14, 4, 8, -7, 12, 14, 36814 }, // ̵
-    { 24, 3, 13, -12, 11, 18, 36828 }, // ̶
-    { 10, 8, 6, -5, 14, 20, 36846 }, // ̷
-    { 14, 28, 8, -7, 26, 98, 36866 }, // ̸
-    { 4, 8, 3, -2, 0, 8, 36964 }, // ̹
-    { 12, 7, 7, -6, -1, 21, 36972 }, // ̺
-    { 14, 8, 8, -7, 0, 28, 36993 }, // ̻
-    { 14, 4, 8, -7, -2, 14, 37021 }, // ̼
-    { 8, 7, 5, -4, 26, 14, 37035 }, // ̽
-    { 6, 10, 4, -3, 29, 15, 37049 }, // ̾
-    { 14, 8, 8, -7, 33, 28, 37064 }, // ̿
-    { 8, 6, 3, -6, 26, 12, 37092 }, // ̀
-    { 8, 6, 7, -2, 26, 12, 37104 }, // ́
-    { 14, 5, 8, -7, 25, 18, 37116 }, // ͂
-    { 6, 6, 4, -3, 26, 9, 37134 }, // ̓
-    { 13, 6, 8, -6, 26, 20, 37143 }, // ̈́
-    { 6, 6, 5, -2, -2, 9, 37163 }, // ͅ
-    { 16, 7, 9, -8, 26, 28, 37172 }, // ͆
-    { 14, 8, 8, -7, 0, 28, 37200 }, // ͇
-    { 8, 7, 5, -4, -1, 14, 37228 }, // ͈
-    { 8, 6, 5, -4, -2, 12, 37242 }, // ͉
-    { 14, 8, 8, -7, 26, 28, 37254 }, // ͊
-    { 14, 12, 8, -7, 31, 42, 37282 }, // ͋
-    { 12, 9, 7, -6, 29, 27, 37324 }, // ͌
-    { 12, 7, 7, -6, -1, 21, 37351 }, // ͍
-    { 8, 8, 5, -4, 0, 16, 37372 }, // ͎
-    { 24, 24, 13, -12, 24, 144, 37388 }, // ͏
-    { 6, 8, 4, -3, 27, 12, 37532 }, // ͐
-    { 5, 8, 4, -2, 28, 10, 37544 }, // ͑
-    { 12, 8, 7, -6, 28, 24, 37554 }, // ͒
-    { 8, 7, 5, -4, -1, 14, 37578 }, // ͓
-    { 6, 7, 4, -3, -1, 11, 37592 }, // ͔
-    { 6, 7, 4, -3, -1, 11, 37603 }, // ͕
-    { 14, 7, 8, -7, -1, 25, 37614 }, // ͖
-    { 5, 8, 4, -2, 28, 10, 37639 }, // ͗
-    { 4, 5, 9, 4, 25, 5, 37649 }, // ͘
-    { 8, 7, 5, -4, -1, 14, 37654 }, // ͙
-    { 14, 8, 8, -7, 0, 28, 37668 }, // ͚
-    { 8, 8, 5, -4, 27, 16, 37696 }, // ͛
-    { 26, 7, 14, -13, -1, 46, 37712 }, // ͜
-    { 26, 7, 14, -13, 26, 46, 37758 }, // ͝
-    { 20, 3, 11, -10, 23, 15, 37804 }, // ͞
-    { 20, 3, 11, -10, -2, 15, 37819 }, // ͟
-    { 26, 5, 14, -13, 25, 33, 37834 }, // ͠
-    { 26, 8, 14, -13, 29, 52, 37867 }, // ͡
-    { 27, 7, 15, -13, -1, 48, 37919 }, // ͢
-    { 8, 8, 5, -4, 28, 16, 37967 }, // ͣ
-    { 8, 8, 5, -4, 28, 16, 37983 }, // ͤ
-    { 3, 11, 3, -1, 31, 9, 37999 }, // ͥ
-    { 9, 8, 6, -4, 28, 18, 38008 }, // ͦ
-    { 8, 8, 5, -4, 28, 16, 38026 }, // ͧ
-    { 7, 8, 5, -3, 28, 14, 38042 }, // ͨ
-    { 8, 11, 5, -4, 31, 22, 38056 }, // ͩ
-    { 8, 11, 5, -4, 31, 22, 38078 }, // ͪ
-    { 13, 8, 8, -6, 28, 26, 38100 }, // ͫ
-    { 6, 8, 5, -2, 28, 12, 38126 }, // ͬ
-    { 6, 10, 4, -3, 30, 15, 38138 }, // ͭ
-    { 9, 8, 6, -4, 28, 18, 38153 }, // ͮ
-    { 9, 8, 6, -4, 28, 18, 38171 }, // ͯ
-    { 22, 24, 23, 0, 24, 132, 38189 }, // Α
-    { 17, 24, 22, 3, 24, 102, 38321 }, // Β
-    { 13, 24, 17, 3, 24, 78, 38423 }, // Γ
-    { 21, 24, 22, 0, 24, 126, 38501 }, // Δ
-    { 14, 24, 19, 3, 24, 84, 38627 }, // Ε
-    { 17, 24, 19, 1, 24, 102, 38711 }, // Ζ
-    { 19, 24, 25, 3, 24, 114, 38813 }, // Η
-    { 22, 26, 26, 2, 25, 143, 38927 }, // Θ
-    { 9, 24, 11, 1, 24, 54, 39070 }, // Ι
-    { 18, 24, 22, 3, 24, 108, 39124 }, // Κ
-    { 21, 24, 22, 0, 24, 126, 39232 }, // Λ
-    { 24, 24, 30, 3, 24, 144, 39358 }, // Μ
-    { 20, 24, 25, 3, 24, 120, 39502 }, // Ν
-    { 17, 24, 21, 2, 24, 102, 39622 }, // Ξ
-    { 22, 26, 26, 2, 25, 143, 39724 }, // Ο
-    { 19, 24, 24, 3, 24, 114, 39867 }, // Π
-    { 16, 24, 20, 3, 24, 96, 39981 }, // Ρ
-    { 17, 24, 19, 1, 24, 102, 40077 }, // Σ
-    { 19, 24, 20, 0, 24, 114, 40179 }, // Τ
-    { 19, 24, 20, 0, 24, 114, 40293 }, // Υ
-    { 26, 24, 28, 1, 24, 156, 40407 }, // Φ
-    { 20, 24, 21, 0, 24, 120, 40563 }, // Χ
-    { 22, 24, 27, 3, 24, 132, 40683 }, // Ψ
-    { 24, 25, 25, 0, 25, 150, 40815 }, // Ω
-    { 20, 20, 22, 1, 19, 100, 40965 }, // α
-    { 17, 34, 20, 2, 26, 145, 41065 }, // β
-    { 17, 25, 18, 0, 18, 107, 41210 }, // γ
-    { 17, 27, 20, 1, 26, 115, 41317 }, // δ
-    { 14, 20, 16, 1, 19, 70, 41432 }, // ε
-    { 15, 33, 17, 1, 26, 124, 41502 }, // ζ
-    { 16, 27, 20, 2, 19, 108, 41626 }, // η
-    { 17, 27, 20, 1, 26, 115, 41734 }, // θ
-    { 9, 19, 12, 2, 18, 43, 41849 }, // ι
-    { 16, 18, 19, 2, 18, 72, 41892 }, // κ
-    { 18, 27, 19, 0, 26, 122, 41964 }, // λ
-    { 19, 26, 22, 2, 18, 124, 42086 }, // μ
-    { 17, 18, 18, 0, 18, 77, 42210 }, // ν
-    { 15, 33, 17, 1, 26, 124, 42287 }, // ξ
-    { 18, 20, 20, 1, 19, 90, 42411 }, // ο
-    { 22, 19, 23, 0, 18, 105, 42501 }, // π
-    { 17, 27, 20, 2, 19, 115, 42606 }, // ρ
-    { 15, 26, 17, 1, 19, 98, 42721 }, // ς
-    { 19, 19, 21, 1, 18, 91, 42819 }, // σ
-    { 16, 19, 17, 0, 18, 76, 42910 }, // τ
-    { 16, 19, 20, 2, 18, 76, 42986 }, // υ
-    { 22, 34, 24, 1, 26, 187, 43062 }, // φ
-    { 20, 26, 21, 0, 18, 130, 43249 }, // χ
-    { 21, 34, 25, 2, 26, 179, 43379 }, // ψ
-    { 23, 19, 27, 2, 18, 110, 43558 }, // ω
-    { 22, 30, 23, 0, 24, 165, 43668 }, // Ạ
-    { 15, 25, 19, 1, 19, 94, 43833 }, // ạ
-    { 22, 34, 23, 0, 34, 187, 43927 }, // Ả
-    { 15, 29, 19, 1, 28, 109, 44114 }, // ả
-    { 22, 33, 23, 0, 33, 182, 44223 }, // Ấ
-    { 18, 29, 20, 1, 28, 131, 44405 }, // ấ
-    { 22, 33, 23, 0, 33, 182, 44536 }, // Ầ
-    { 16, 29, 19, 0, 28, 116, 44718 }, // ầ
-    { 22, 35, 23, 0, 35, 193, 44834 }, // Ẩ
-    { 17, 31, 19, 1, 30, 132, 45027 }, // ẩ
-    { 22, 35, 23, 0, 35, 193, 45159 }, // Ẫ
-    { 15, 31, 19, 1, 30, 117, 45352 }, // ẫ
-    { 22, 38, 23, 0, 32, 209, 45469 }, // Ậ
-    { 15, 32, 19, 1, 26, 120, 45678 }, // ậ
-    { 22, 34, 23, 0, 34, 187, 45798 }, // Ắ
-    { 15, 30, 19, 1, 29, 113, 45985 }, // ắ
-    { 22, 34, 23, 0, 34, 187, 46098 }, // Ằ
-    { 15, 30, 19, 1, 29, 113, 46285 }, // ằ
-    { 22, 35, 23, 0, 35, 193, 46398 }, // Ẳ
-    { 15, 31, 19, 1, 30, 117, 46591 }, // ẳ
-    { 22, 35, 23, 0, 35, 193, 46708 }, // Ẵ
-    { 15, 31, 19, 1, 30, 117, 46901 }, // ẵ
-    { 22, 37, 23, 0, 31, 204, 47018 }, // Ặ
-    { 15, 31, 19, 1, 25, 117, 47222 }, // ặ
-    { 14, 30, 19, 3, 24, 105, 47339 }, // Ẹ
-    { 17, 25, 19, 1, 19, 107, 47444 }, // ẹ
-    { 14, 34, 19, 3, 34, 119, 47551 }, // Ẻ
-    { 17, 29, 19, 1, 28, 124, 47670 }, // ẻ
-    { 14, 31, 19, 3, 31, 109, 47794 }, // Ẽ
-    { 17, 26, 19, 1, 25, 111, 47903 }, // ẽ
-    { 16, 33, 20, 3, 33, 132, 48014 }, // Ế
-    { 18, 29, 20, 1, 28, 131, 48146 }, // ế
-    { 16, 33, 19, 1, 33, 132, 48277 }, // Ề
-    { 17, 29, 19, 1, 28, 124, 48409 }, // ề
-    { 15, 35, 19, 3, 35, 132, 48533 }, // Ể
-    { 17, 31, 19, 1, 30, 132, 48665 }, // ể
-    { 14, 35, 19, 3, 35, 123, 48797 }, // Ễ
-    { 17, 31, 19, 1, 30, 132, 48920 }, // ễ
-    { 14, 38, 19, 3, 32, 133, 49052 }, // Ệ
-    { 17, 32, 19, 1, 26, 136, 49185 }, // ệ
-    { 9, 33, 11, 1, 33, 75, 49321 }, // Ỉ
-    { 7, 28, 10, 2, 28, 49, 49396 }, // ỉ
-    { 9, 30, 11, 1, 24, 68, 49445 }, // Ị
-    { 5, 31, 9, 2, 25, 39, 49513 }, // ị
-    { 22, 31, 26, 2, 25, 171, 49552 }, // Ọ
-    { 18, 25, 20, 1, 19, 113, 49723 }, // ọ
-    { 22, 34, 26, 2, 33, 187, 49836 }, // Ỏ
-    { 18, 29, 20, 1, 28, 131, 50023 }, // ỏ
-    { 22, 34, 26, 2, 33, 187, 50154 }, // Ố
-    { 18, 29, 20, 1, 28, 131, 50341 }, // ố
-    { 22, 34, 26, 2, 33, 187, 50472 }, // Ồ
-    { 18, 29, 20, 1, 28, 131, 50659 }, // ồ
-    { 22, 36, 26, 2, 35, 198, 50790 }, // Ổ
-    { 18, 31, 20, 1, 30, 140, 50988 }, // ổ
-    { 22, 36, 26, 2, 35, 198, 51128 }, // Ỗ
-    { 18, 31, 20, 1, 30, 140, 51326 }, // ỗ
-    { 22, 38, 26, 2, 32, 209, 51466 }, // Ộ
-    { 18, 32, 20, 1, 26, 144, 51675 }, // ộ
-    { 25, 33, 28, 2, 32, 207, 51819 }, // Ớ
-    { 21, 27, 23, 1, 26, 142, 52026 }, // ớ
-    { 25, 33, 28, 2, 32, 207, 52168 }, // Ờ
-    { 21, 27, 23, 1, 26, 142, 52375 }, // ờ
-    { 25, 35, 28, 2, 34, 219, 52517 }, // Ở
-    { 21, 29, 23, 1, 28, 153, 52736 }, // ở
-    { 25, 32, 28, 2, 31, 200, 52889 }, // Ỡ
-    { 21, 26, 23, 1, 25, 137, 53089 }, // ỡ
-    { 25, 32, 28, 2, 26, 200, 53226 }, // Ợ
-    { 21, 27, 23, 1, 21, 142, 53426 }, // ợ
-    { 19, 30, 24, 3, 24, 143, 53568 }, // Ụ
-    { 16, 24, 21, 2, 18, 96, 53711 }, // ụ
-    { 19, 34, 24, 3, 33, 162, 53807 }, // Ủ
-    { 16, 29, 21, 2, 28, 116, 53969 }, // ủ
-    { 25, 33, 29, 3, 32, 207, 54085 }, // Ứ
-    { 22, 27, 25, 2, 26, 149, 54292 }, // ứ
-    { 25, 33, 29, 3, 32, 207, 54441 }, // Ừ
-    { 22, 27, 25, 2, 26, 149, 54648 }, // ừ
-    { 25, 34, 29, 3, 33, 213, 54797 }, // Ử
-    { 22, 29, 25, 2, 28, 160, 55010 }, // ử
-    { 25, 32, 29, 3, 31, 200, 55170 }, // Ữ
-    { 22, 26, 25, 2, 25, 143, 55370 }, // ữ
-    { 25, 32, 29, 3, 26, 200, 55513 }, // Ự
-    { 22, 27, 25, 2, 21, 149, 55713 }, // ự
-    { 19, 32, 20, 0, 32, 152, 55862 }, // Ỳ
-    { 17, 34, 18, 0, 26, 145, 56014 }, // ỳ
-    { 19, 30, 20, 0, 24, 143, 56159 }, // Ỵ
-    { 17, 26, 18, 0, 18, 111, 56302 }, // ỵ
-    { 19, 33, 20, 0, 33, 157, 56413 }, // Ỷ
-    { 17, 36, 18, 0, 28, 153, 56570 }, // ỷ
-    { 19, 31, 20, 0, 31, 148, 56723 }, // Ỹ
-    { 17, 33, 18, 0, 25, 141, 56871 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 57012 }, //  
-    { 0, 0, 33, 0, 0, 0, 57012 }, //  
-    { 0, 0, 17, 0, 0, 0, 57012 }, //  
-    { 0, 0, 33, 0, 0, 0, 57012 }, //  
-    { 0, 0, 11, 0, 0, 0, 57012 }, //  
-    { 0, 0, 8, 0, 0, 0, 57012 }, //  
-    { 0, 0, 6, 0, 0, 0, 57012 }, //  
-    { 0, 0, 19, 0, 0, 0, 57012 }, //  
-    { 0, 0, 9, 0, 0, 0, 57012 }, //  
-    { 0, 0, 6, 0, 0, 0, 57012 }, //  
-    { 0, 0, 3, 0, 0, 0, 57012 }, //  
-    { 0, 0, 1, 0, 0, 0, 57012 }, // ​
-    { 0, 0, 1, 0, 0, 0, 57012 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 57012 }, // ‍
-    { 9, 28, 9, -1, 23, 63, 57012 }, // ‎
-    { 9, 28, 2, -8, 23, 63, 57075 }, // ‏
-    { 9, 4, 11, 1, 11, 9, 57138 }, // ‐
-    { 9, 4, 11, 1, 11, 9, 57147 }, // ‑
-    { 17, 4, 19, 1, 14, 17, 57156 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 57173 }, // –
-    { 31, 4, 33, 1, 11, 31, 57188 }, // —
-    { 31, 4, 33, 1, 11, 31, 57219 }, // ―
-    { 11, 35, 18, 4, 26, 97, 57250 }, // ‖
-    { 15, 8, 15, -1, 0, 30, 57347 }, // ‗
-    { 6, 9, 7, 0, 24, 14, 57377 }, // ‘
-    { 6, 9, 7, 0, 24, 14, 57391 }, // ’
-    { 6, 9, 8, 1, 4, 14, 57405 }, // ‚
-    { 6, 9, 7, 0, 24, 14, 57419 }, // ‛
-    { 12, 9, 13, 0, 24, 27, 57433 }, // “
-    { 12, 9, 13, 0, 24, 27, 57460 }, // ”
-    { 12, 9, 14, 1, 4, 27, 57487 }, // „
-    { 12, 9, 13, 0, 24, 27, 57514 }, // ‟
-    { 13, 26, 17, 2, 26, 85, 57541 }, // †
-    { 14, 26, 17, 2, 26, 91, 57626 }, // ‡
-    { 8, 9, 13, 2, 17, 18, 57717 }, // •
-    { 9, 11, 12, 2, 18, 25, 57735 }, // ‣
-    { 5, 6, 17, 6, 5, 8, 57760 }, // ․
-    { 14, 6, 18, 2, 5, 21, 57768 }, // ‥
-    { 22, 6, 26, 2, 5, 33, 57789 }, // …
-    { 5, 6, 9, 2, 11, 8, 57822 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 57830 }, //  
-    { 0, 0, 20, 0, 0, 0, 57830 }, //  
-    { 9, 26, 9, -1, 21, 59, 57830 }, // ‪
-    { 9, 26, 2, -8, 21, 59, 57889 }, // ‫
-    { 8, 28, 5, -4, 23, 56, 57948 }, // ‬
-    { 8, 28, 5, -4, 23, 56, 58004 }, // ‭
-    { 8, 28, 5, -4, 23, 56, 58060 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 58116 }, //  
-    { 37, 26, 39, 1, 25, 241, 58116 }, // ‰
-    { 49, 26, 51, 1, 25, 319, 58357 }, // ‱
-    { 8, 9, 10, 1, 24, 18, 58676 }, // ′
-    { 14, 9, 16, 1, 24, 32, 58694 }, // ″
-    { 20, 9, 22, 1, 24, 45, 58726 }, // ‴
-    { 8, 9, 8, -1, 24, 18, 58771 }, // ‵
-    { 13, 9, 15, -1, 24, 30, 58789 }, // ‶
-    { 19, 9, 20, -1, 24, 43, 58819 }, // ‷
-    { 13, 11, 14, 0, 3, 36, 58862 }, // ‸
-    { 9, 15, 11, 1, 16, 34, 58898 }, // ‹
-    { 8, 15, 10, 1, 16, 30, 58932 }, // ›
-    { 26, 26, 28, 1, 25, 169, 58962 }, // ※
-    { 13, 25, 17, 2, 24, 82, 59131 }, // ‼
-    { 14, 26, 15, 0, 25, 91, 59213 }, // ‽
-    { 18, 3, 18, -1, 28, 14, 59304 }, // ‾
-    { 20, 7, 21, 0, -1, 35, 59318 }, // ‿
-    { 20, 8, 21, 0, 27, 40, 59353 }, // ⁀
-    { 12, 22, 13, 0, 14, 66, 59393 }, // ⁁
-    { 37, 31, 38, 0, 26, 287, 59459 }, // ⁂
-    { 9, 4, 11, 1, 11, 9, 59746 }, // ⁃
-    { 18, 24, 12, -7, 24, 108, 59755 }, // ⁄
-    { 8, 30, 11, 2, 24, 60, 59863 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 59923 }, // ⁆
-    { 28, 26, 29, 0, 25, 182, 59991 }, // ⁇
-    { 21, 26, 23, 0, 25, 137, 60173 }, // ⁈
-    { 20, 26, 23, 2, 25, 130, 60310 }, // ⁉
-    { 17, 18, 19, 1, 18, 77, 60440 }, // ⁊
-    { 17, 31, 22, 3, 26, 132, 60517 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 60649 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 60726 }, // ⁍
-    { 16, 16, 18, 1, 9, 64, 60803 }, // ⁎
-    { 6, 24, 8, 1, 19, 36, 60867 }, // ⁏
-    { 20, 35, 21, 0, 27, 175, 60903 }, // ⁐
-    { 16, 33, 18, 1, 26, 132, 61078 }, // ⁑
-    { 13, 26, 14, 0, 25, 85, 61210 }, // ⁒
-    { 29, 6, 33, 2, 13, 44, 61295 }, // ⁓
-    { 20, 8, 21, 0, 0, 40, 61339 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 61379 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 61460 }, // ⁖
-    { 25, 9, 27, 1, 24, 57, 61558 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 61615 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 61778 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 61941 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 61974 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 62104 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 62267 }, // ⁝
-    { 5, 26, 9, 2, 25, 33, 62299 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 62332 }, //  
-    { 0, 0, 20, 0, 0, 0, 62332 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 62332 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 62332 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 62332 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 62332 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 62332 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 62332 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 62332 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 62332 }, // ⁩
-    { 8, 28, 5, -4, 23, 56, 62332 }, // ⁪
-    { 8, 28, 5, -4, 23, 56, 62388 }, // ⁫
-    { 8, 28, 5, -4, 23, 56, 62444 }, // ⁬
-    { 8, 29, 5, -4, 24, 58, 62500 }, // ⁭
-    { 8, 28, 5, -4, 23, 56, 62558 }, // ⁮
-    { 8, 28, 5, -4, 23, 56, 62614 }, // ⁯
-    { 11, 16, 12, 0, 29, 44, 62670 }, // ⁰
-    { 3, 16, 6, 1, 25, 12, 62714 }, // ⁱ
-    { 12, 16, 13, 0, 29, 48, 62726 }, // ⁴
-    { 10, 16, 12, 1, 29, 40, 62774 }, // ⁵
-    { 12, 16, 13, 0, 29, 48, 62814 }, // ⁶
-    { 11, 16, 12, 0, 29, 44, 62862 }, // ⁷
-    { 11, 16, 12, 0, 29, 44, 62906 }, // ⁸
-    { 11, 16, 12, 0, 29, 44, 62950 }, // ⁹
-    { 10, 10, 12, 1, 25, 25, 62994 }, // ⁺
-    { 10, 3, 12, 1, 21, 8, 63019 }, // ⁻
-    { 10, 6, 12, 1, 23, 15, 63027 }, // ⁼
-    { 6, 19, 9, 2, 31, 29, 63042 }, // ⁽
-    { 6, 19, 8, 0, 31, 29, 63071 }, // ⁾
-    { 11, 12, 13, 1, 21, 33, 63100 }, // ⁿ
-    { 11, 16, 12, 0, 11, 44, 63133 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 63177 }, // ₁
-    { 11, 16, 12, 0, 11, 44, 63205 }, // ₂
-    { 11, 16, 12, 0, 11, 44, 63249 }, // ₃
-    { 12, 16, 13, 0, 11, 48, 63293 }, // ₄
-    { 10, 16, 12, 1, 11, 40, 63341 }, // ₅
-    { 12, 16, 13, 0, 11, 48, 63381 }, // ₆
-    { 11, 16, 12, 0, 11, 44, 63429 }, // ₇
-    { 11, 16, 12, 0, 11, 44, 63473 }, // ₈
-    { 11, 16, 12, 0, 11, 44, 63517 }, // ₉
-    { 10, 10, 12, 1, 7, 25, 63561 }, // ₊
-    { 10, 3, 12, 1, 3, 8, 63586 }, // ₋
-    { 10, 6, 12, 1, 5, 15, 63594 }, // ₌
-    { 6, 19, 9, 2, 13, 29, 63609 }, // ₍
-    { 6, 19, 8, 0, 13, 29, 63638 }, // ₎
-    { 10, 12, 12, 1, 8, 30, 63667 }, // ₐ
-    { 11, 12, 13, 1, 8, 33, 63697 }, // ₑ
-    { 11, 12, 13, 1, 8, 33, 63730 }, // ₒ
-    { 12, 12, 13, 0, 8, 36, 63763 }, // ₓ
-    { 11, 12, 13, 1, 8, 33, 63799 }, // ₔ
-    { 11, 16, 13, 1, 12, 44, 63832 }, // ₕ
-    { 11, 16, 13, 1, 12, 44, 63876 }, // ₖ
-    { 3, 16, 6, 1, 12, 12, 63920 }, // ₗ
-    { 18, 12, 20, 1, 8, 54, 63932 }, // ₘ
-    { 11, 12, 13, 1, 8, 33, 63986 }, // ₙ
-    { 12, 16, 14, 1, 8, 48, 64019 }, // ₚ
-    { 9, 12, 11, 1, 8, 27, 64067 }, // ₛ
-    { 8, 14, 9, 0, 10, 28, 64094 }, // ₜ
-    { 17, 25, 19, 1, 25, 107, 64122 }, // ₠
-    { 18, 28, 20, 1, 26, 126, 64229 }, // ₡
-    { 17, 26, 19, 1, 25, 111, 64355 }, // ₢
-    { 17, 24, 19, 1, 24, 102, 64466 }, // ₣
-    { 17, 25, 19, 1, 25, 107, 64568 }, // ₤
-    { 27, 27, 31, 2, 23, 183, 64675 }, // ₥
-    { 19, 24, 20, 0, 24, 114, 64858 }, // ₦
-    { 23, 25, 26, 2, 24, 144, 64972 }, // ₧
-    { 25, 25, 28, 2, 24, 157, 65116 }, // ₨
-    { 22, 24, 23, 0, 24, 132, 65273 }, // ₩
-    { 22, 24, 27, 2, 24, 132, 65405 }, // ₪
-    { 20, 32, 22, 1, 26, 160, 65537 }, // ₫
-    { 19, 26, 20, 0, 25, 124, 65697 }, // €
-    { 20, 24, 21, 0, 24, 120, 65821 }, // ₭
-    { 19, 24, 20, 0, 24, 114, 65941 }, // ₮
-    { 32, 33, 33, 0, 25, 264, 66055 }, // ₯
-    { 18, 33, 19, 0, 25, 149, 66319 }, // ₰
-    { 19, 24, 20, 0, 24, 114, 66468 }, // ₱
-    { 20, 29, 24, 2, 26, 145, 66582 }, // ₲
-    { 21, 24, 22, 0, 24, 126, 66727 }, // ₳
-    { 18, 26, 19, 0, 25, 117, 66853 }, // ₴
-    { 19, 29, 22, 2, 26, 138, 66970 }, // ₵
-    { 20, 23, 21, 0, 22, 115, 67108 }, // ₶
-    { 23, 28, 24, 0, 25, 161, 67223 }, // ₷
-    { 18, 24, 19, 0, 24, 108, 67384 }, // ₸
-    { 15, 24, 19, 2, 24, 90, 67492 }, // ₹
-    { 19, 25, 20, 0, 24, 119, 67582 }, // ₺
-    { 26, 26, 27, 0, 25, 169, 67701 }, // ₻
-    { 24, 24, 27, 1, 24, 144, 67870 }, // ₼
-    { 19, 24, 20, 0, 24, 114, 68014 }, // ₽
-    { 22, 26, 26, 2, 26, 143, 68128 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 68271 }, // ₿
-    { 14, 24, 16, 1, 19, 84, 68391 }, // ⃀
-    { 17, 3, 19, 1, 13, 13, 68475 }, // −
-    { 31, 32, 33, 1, 26, 248, 68488 }, // �
+    { 5, 25, 9, 2, 24, 31, 0 }, // !
+    { 10, 9, 14, 2, 24, 26, 31 }, // "
+    { 21, 24, 22, 0, 24, 93, 57 }, // #
+    { 16, 28, 19, 2, 26, 90, 150 }, // $
+    { 26, 26, 28, 1, 25, 130, 240 }, // %
+    { 24, 26, 26, 1, 25, 96, 370 }, // &
+    { 4, 9, 8, 2, 24, 14, 466 }, // '
+    { 8, 30, 10, 1, 24, 50, 480 }, // (
+    { 8, 30, 10, 1, 24, 48, 530 }, // )
+    { 16, 16, 18, 1, 26, 48, 578 }, // *
+    { 17, 17, 19, 1, 20, 47, 626 }, // +
+    { 6, 9, 9, 1, 4, 13, 673 }, // ,
+    { 9, 4, 11, 1, 11, 10, 686 }, // -
+    { 5, 6, 9, 2, 5, 7, 696 }, // .
+    { 13, 24, 14, 0, 24, 51, 703 }, // /
+    { 17, 26, 19, 1, 25, 84, 754 }, // 0
+    { 10, 24, 19, 2, 24, 32, 838 }, // 1
+    { 17, 25, 19, 1, 25, 65, 870 }, // 2
+    { 17, 26, 19, 1, 25, 68, 935 }, // 3
+    { 19, 24, 20, 0, 24, 64, 1003 }, // 4
+    { 16, 25, 19, 2, 24, 61, 1067 }, // 5
+    { 17, 26, 19, 1, 25, 74, 1128 }, // 6
+    { 17, 24, 19, 1, 24, 51, 1202 }, // 7
+    { 17, 26, 19, 1, 25, 85, 1253 }, // 8
+    { 17, 26, 19, 1, 25, 76, 1338 }, // 9
+    { 5, 20, 9, 2, 19, 17, 1414 }, // :
+    { 6, 24, 9, 1, 19, 25, 1431 }, // ;
+    { 17, 18, 19, 1, 21, 44, 1456 }, // <
+    { 17, 10, 19, 1, 17, 24, 1500 }, // =
+    { 17, 18, 19, 1, 21, 42, 1524 }, // >
+    { 14, 26, 15, 0, 25, 53, 1566 }, // ?
+    { 28, 27, 30, 1, 24, 140, 1619 }, // @
+    { 22, 24, 23, 0, 24, 82, 1759 }, // A
+    { 17, 24, 22, 3, 24, 72, 1841 }, // B
+    { 19, 26, 22, 2, 25, 64, 1913 }, // C
+    { 20, 24, 24, 3, 24, 73, 1977 }, // D
+    { 14, 24, 19, 3, 24, 52, 2050 }, // E
+    { 14, 24, 18, 3, 24, 45, 2102 }, // F
+    { 20, 26, 24, 2, 25, 79, 2147 }, // G
+    { 19, 24, 25, 3, 24, 77, 2226 }, // H
+    { 9, 24, 11, 1, 24, 29, 2303 }, // I
+    { 10, 31, 9, -3, 24, 39, 2332 }, // J
+    { 18, 24, 22, 3, 24, 67, 2371 }, // K
+    { 14, 24, 18, 3, 24, 43, 2438 }, // L
+    { 24, 24, 30, 3, 24, 97, 2481 }, // M
+    { 20, 24, 25, 3, 24, 91, 2578 }, // N
+    { 22, 26, 26, 2, 25, 87, 2669 }, // O
+    { 16, 24, 20, 3, 24, 56, 2756 }, // P
+    { 22, 31, 26, 2, 25, 102, 2812 }, // Q
+    { 18, 24, 22, 3, 24, 70, 2914 }, // R
+    { 16, 26, 18, 1, 25, 68, 2984 }, // S
+    { 19, 24, 20, 0, 24, 42, 3052 }, // T
+    { 19, 25, 24, 3, 24, 76, 3094 }, // U
+    { 20, 24, 21, 0, 24, 74, 3170 }, // V
+    { 31, 24, 32, 0, 24, 131, 3244 }, // W
+    { 20, 24, 21, 0, 24, 75, 3375 }, // X
+    { 19, 24, 20, 0, 24, 59, 3450 }, // Y
+    { 17, 24, 19, 1, 24, 59, 3509 }, // Z
+    { 9, 30, 12, 2, 24, 64, 3568 }, // [
+    { 13, 24, 14, 0, 24, 48, 3632 }, // <backslash>
+    { 9, 30, 11, 0, 24, 64, 3680 }, // ]
+    { 17, 16, 19, 1, 24, 46, 3744 }, // ^
+    { 16, 3, 16, -1, -3, 6, 3790 }, // _
+    { 8, 6, 10, 1, 26, 12, 3796 }, // `
+    { 15, 20, 19, 1, 19, 56, 3808 }, // a
+    { 17, 27, 21, 2, 26, 76, 3864 }, // b
+    { 14, 20, 16, 1, 19, 45, 3940 }, // c
+    { 17, 27, 21, 1, 26, 89, 3985 }, // d
+    { 17, 20, 19, 1, 19, 62, 4074 }, // e
+    { 13, 26, 14, 0, 26, 66, 4136 }, // f
+    { 17, 27, 21, 1, 19, 90, 4202 }, // g
+    { 16, 26, 21, 2, 26, 64, 4292 }, // h
+    { 5, 25, 9, 2, 25, 26, 4356 }, // i
+    { 9, 33, 9, -2, 25, 41, 4382 }, // j
+    { 16, 26, 19, 2, 26, 70, 4423 }, // k
+    { 4, 26, 9, 2, 26, 27, 4493 }, // l
+    { 27, 19, 31, 2, 19, 84, 4520 }, // m
+    { 16, 19, 21, 2, 19, 52, 4604 }, // n
+    { 18, 20, 20, 1, 19, 61, 4656 }, // o
+    { 17, 27, 21, 2, 19, 76, 4717 }, // p
+    { 17, 27, 21, 1, 19, 90, 4793 }, // q
+    { 12, 19, 15, 2, 19, 33, 4883 }, // r
+    { 14, 20, 16, 1, 19, 48, 4916 }, // s
+    { 12, 23, 13, 0, 22, 42, 4964 }, // t
+    { 16, 19, 21, 2, 18, 58, 5006 }, // u
+    { 17, 18, 18, 0, 18, 54, 5064 }, // v
+    { 26, 18, 27, 0, 18, 91, 5118 }, // w
+    { 18, 18, 19, 0, 18, 54, 5209 }, // x
+    { 17, 26, 18, 0, 18, 73, 5263 }, // y
+    { 14, 18, 16, 1, 18, 46, 5336 }, // z
+    { 12, 30, 13, 0, 24, 52, 5382 }, // {
+    { 4, 35, 18, 7, 26, 52, 5434 }, // |
+    { 11, 30, 13, 1, 24, 49, 5486 }, // }
+    { 17, 5, 19, 1, 14, 19, 5535 }, // ~
+    { 0, 0, 9, 0, 0, 0, 5554 }, //  
+    { 5, 26, 9, 2, 19, 31, 5554 }, // ¡
+    { 14, 26, 19, 3, 25, 57, 5585 }, // ¢
+    { 17, 25, 19, 1, 25, 69, 5642 }, // £
+    { 17, 16, 19, 1, 20, 54, 5711 }, // ¤
+    { 19, 24, 20, 0, 24, 75, 5765 }, // ¥
+    { 4, 35, 18, 7, 26, 43, 5840 }, // ¦
+    { 14, 27, 17, 1, 26, 73, 5883 }, // §
+    { 11, 4, 19, 4, 25, 12, 5956 }, // ¨
+    { 26, 26, 28, 1, 25, 121, 5968 }, // ©
+    { 10, 13, 12, 1, 25, 31, 6089 }, // ª
+    { 15, 15, 17, 1, 16, 44, 6120 }, // «
+    { 17, 9, 19, 1, 13, 27, 6164 }, // ¬
+    { 9, 4, 11, 1, 11, 10, 6191 }, // ­
+    { 26, 26, 28, 1, 25, 131, 6201 }, // ®
+    { 18, 3, 18, -1, 28, 21, 6332 }, // ¯
+    { 12, 12, 14, 1, 25, 25, 6353 }, // °
+    { 17, 20, 19, 1, 20, 61, 6378 }, // ±
+    { 11, 16, 12, 0, 29, 32, 6439 }, // ²
+    { 11, 16, 12, 0, 29, 37, 6471 }, // ³
+    { 8, 6, 10, 1, 26, 12, 6508 }, // ´
+    { 16, 26, 21, 2, 18, 65, 6520 }, // µ
+    { 18, 31, 22, 1, 26, 117, 6585 }, // ¶
+    { 5, 6, 9, 2, 15, 7, 6702 }, // ·
+    { 8, 8, 9, 0, 0, 14, 6709 }, // ¸
+    { 7, 16, 12, 1, 29, 25, 6723 }, // ¹
+    { 11, 13, 13, 1, 25, 32, 6748 }, // º
+    { 15, 15, 17, 1, 16, 45, 6780 }, // »
+    { 24, 24, 26, 1, 24, 106, 6825 }, // ¼
+    { 25, 24, 26, 0, 24, 105, 6931 }, // ½
+    { 26, 25, 27, 0, 25, 117, 7036 }, // ¾
+    { 14, 26, 15, 0, 19, 54, 7153 }, // ¿
+    { 22, 32, 23, 0, 32, 102, 7207 }, // À
+    { 22, 32, 23, 0, 32, 100, 7309 }, // Á
+    { 22, 32, 23, 0, 32, 106, 7409 }, // Â
+    { 22, 31, 23, 0, 31, 105, 7515 }, // Ã
+    { 22, 31, 23, 0, 31, 99, 7620 }, // Ä
+    { 22, 30, 23, 0, 30, 100, 7719 }, // Å
+    { 29, 24, 29, -1, 24, 99, 7819 }, // Æ
+    { 19, 33, 22, 2, 25, 79, 7918 }, // Ç
+    { 14, 32, 19, 3, 32, 66, 7997 }, // È
+    { 14, 32, 19, 3, 32, 67, 8063 }, // É
+    { 14, 32, 19, 3, 32, 70, 8130 }, // Ê
+    { 14, 31, 19, 3, 31, 66, 8200 }, // Ë
+    { 9, 32, 11, 1, 32, 42, 8266 }, // Ì
+    { 10, 32, 12, 1, 32, 43, 8308 }, // Í
+    { 12, 32, 13, 0, 32, 58, 8351 }, // Î
+    { 10, 31, 12, 1, 31, 43, 8409 }, // Ï
+    { 22, 24, 24, 1, 24, 94, 8452 }, // Ð
+    { 20, 31, 25, 3, 31, 112, 8546 }, // Ñ
+    { 22, 33, 26, 2, 32, 103, 8658 }, // Ò
+    { 22, 33, 26, 2, 32, 106, 8761 }, // Ó
+    { 22, 33, 26, 2, 32, 107, 8867 }, // Ô
+    { 22, 32, 26, 2, 31, 107, 8974 }, // Õ
+    { 22, 32, 26, 2, 31, 103, 9081 }, // Ö
+    { 15, 16, 19, 2, 20, 44, 9184 }, // ×
+    { 22, 27, 26, 2, 25, 107, 9228 }, // Ø
+    { 19, 33, 24, 3, 32, 92, 9335 }, // Ù
+    { 19, 33, 24, 3, 32, 92, 9427 }, // Ú
+    { 19, 33, 24, 3, 32, 97, 9519 }, // Û
+    { 19, 32, 24, 3, 31, 93, 9616 }, // Ü
+    { 19, 32, 20, 0, 32, 74, 9709 }, // Ý
+    { 16, 24, 20, 3, 24, 58, 9783 }, // Þ
+    { 18, 27, 21, 2, 26, 82, 9841 }, // ß
+    { 15, 27, 19, 1, 26, 71, 9923 }, // à
+    { 15, 27, 19, 1, 26, 69, 9994 }, // á
+    { 15, 27, 19, 1, 26, 73, 10063 }, // â
+    { 15, 26, 19, 1, 25, 75, 10136 }, // ã
+    { 15, 26, 19, 1, 25, 69, 10211 }, // ä
+    { 15, 29, 19, 1, 28, 76, 10280 }, // å
+    { 27, 20, 29, 1, 19, 101, 10356 }, // æ
+    { 14, 27, 16, 1, 19, 60, 10457 }, // ç
+    { 17, 27, 19, 1, 26, 77, 10517 }, // è
+    { 17, 27, 19, 1, 26, 75, 10594 }, // é
+    { 17, 27, 19, 1, 26, 82, 10669 }, // ê
+    { 17, 26, 19, 1, 25, 75, 10751 }, // ë
+    { 8, 26, 9, -1, 26, 32, 10826 }, // ì
+    { 8, 26, 11, 2, 26, 29, 10858 }, // í
+    { 12, 26, 11, -2, 26, 44, 10887 }, // î
+    { 10, 25, 10, -1, 25, 32, 10931 }, // ï
+    { 18, 27, 20, 1, 26, 85, 10963 }, // ð
+    { 16, 25, 21, 2, 25, 71, 11048 }, // ñ
+    { 18, 27, 20, 1, 26, 74, 11119 }, // ò
+    { 18, 27, 20, 1, 26, 78, 11193 }, // ó
+    { 18, 27, 20, 1, 26, 80, 11271 }, // ô
+    { 18, 26, 20, 1, 25, 80, 11351 }, // õ
+    { 18, 26, 20, 1, 25, 76, 11431 }, // ö
+    { 17, 16, 19, 1, 20, 38, 11507 }, // ÷
+    { 18, 21, 20, 1, 19, 76, 11545 }, // ø
+    { 16, 27, 21, 2, 26, 75, 11621 }, // ù
+    { 16, 27, 21, 2, 26, 73, 11696 }, // ú
+    { 16, 27, 21, 2, 26, 77, 11769 }, // û
+    { 16, 26, 21, 2, 25, 73, 11846 }, // ü
+    { 17, 34, 18, 0, 26, 87, 11919 }, // ý
+    { 17, 34, 21, 2, 26, 87, 12006 }, // þ
+    { 17, 33, 18, 0, 25, 87, 12093 }, // ÿ
+    { 22, 29, 23, 0, 29, 98, 12180 }, // Ā
+    { 15, 24, 19, 1, 23, 68, 12278 }, // ā
+    { 22, 31, 23, 0, 31, 103, 12346 }, // Ă
+    { 15, 26, 19, 1, 25, 72, 12449 }, // ă
+    { 22, 32, 23, 0, 24, 102, 12521 }, // Ą
+    { 16, 27, 19, 1, 19, 75, 12623 }, // ą
+    { 19, 33, 22, 2, 32, 79, 12698 }, // Ć
+    { 14, 27, 16, 1, 26, 58, 12777 }, // ć
+    { 19, 33, 22, 2, 32, 84, 12835 }, // Ĉ
+    { 15, 27, 17, 1, 26, 64, 12919 }, // ĉ
+    { 19, 32, 22, 2, 31, 74, 12983 }, // Ċ
+    { 14, 26, 16, 1, 25, 53, 13057 }, // ċ
+    { 19, 33, 22, 2, 32, 84, 13110 }, // Č
+    { 15, 27, 17, 1, 26, 64, 13194 }, // č
+    { 20, 32, 24, 3, 32, 94, 13258 }, // Ď
+    { 22, 27, 24, 1, 26, 101, 13352 }, // ď
+    { 22, 24, 24, 1, 24, 94, 13453 }, // Đ
+    { 20, 27, 22, 1, 26, 93, 13547 }, // đ
+    { 14, 29, 19, 3, 29, 64, 13640 }, // Ē
+    { 17, 24, 19, 1, 23, 75, 13704 }, // ē
+    { 14, 31, 19, 3, 31, 68, 13779 }, // Ĕ
+    { 17, 26, 19, 1, 25, 79, 13847 }, // ĕ
+    { 14, 31, 19, 3, 31, 63, 13926 }, // Ė
+    { 17, 26, 19, 1, 25, 70, 13989 }, // ė
+    { 14, 32, 19, 3, 24, 69, 14059 }, // Ę
+    { 17, 27, 19, 1, 19, 78, 14128 }, // ę
+    { 14, 32, 19, 3, 32, 70, 14206 }, // Ě
+    { 17, 27, 19, 1, 26, 81, 14276 }, // ě
+    { 20, 33, 24, 2, 32, 100, 14357 }, // Ĝ
+    { 17, 34, 21, 1, 26, 109, 14457 }, // ĝ
+    { 20, 32, 24, 2, 31, 97, 14566 }, // Ğ
+    { 17, 33, 21, 1, 25, 106, 14663 }, // ğ
+    { 20, 32, 24, 2, 31, 89, 14769 }, // Ġ
+    { 17, 33, 21, 1, 25, 101, 14858 }, // ġ
+    { 20, 33, 24, 2, 25, 95, 14959 }, // Ģ
+    { 17, 34, 21, 1, 26, 103, 15054 }, // ģ
+    { 19, 32, 25, 3, 32, 98, 15157 }, // Ĥ
+    { 20, 33, 21, -2, 33, 88, 15255 }, // ĥ
+    { 25, 24, 26, 0, 24, 96, 15343 }, // Ħ
+    { 18, 26, 21, 0, 26, 71, 15439 }, // ħ
+    { 13, 31, 13, -1, 31, 59, 15510 }, // Ĩ
+    { 13, 25, 12, -2, 25, 47, 15569 }, // ĩ
+    { 11, 29, 12, 0, 29, 43, 15616 }, // Ī
+    { 11, 23, 11, -1, 23, 31, 15659 }, // ī
+    { 11, 31, 12, 0, 31, 47, 15690 }, // Ĭ
+    { 11, 25, 11, -1, 25, 35, 15737 }, // ĭ
+    { 9, 32, 11, 1, 24, 43, 15772 }, // Į
+    { 7, 33, 9, 0, 25, 40, 15815 }, // į
+    { 9, 31, 11, 1, 31, 37, 15855 }, // İ
+    { 4, 18, 9, 2, 18, 19, 15892 }, // ı
+    { 17, 31, 20, 1, 24, 94, 15911 }, // Ĳ
+    { 13, 33, 17, 2, 25, 87, 16005 }, // ĳ
+    { 14, 39, 12, -3, 32, 73, 16092 }, // Ĵ
+    { 12, 34, 11, -2, 26, 60, 16165 }, // ĵ
+    { 18, 32, 22, 3, 24, 82, 16225 }, // Ķ
+    { 16, 34, 19, 2, 26, 83, 16307 }, // ķ
+    { 16, 18, 19, 2, 18, 47, 16390 }, // ĸ
+    { 15, 32, 18, 2, 32, 60, 16437 }, // Ĺ
+    { 8, 33, 11, 2, 33, 37, 16497 }, // ĺ
+    { 14, 32, 18, 3, 24, 56, 16534 }, // Ļ
+    { 5, 34, 9, 2, 26, 38, 16590 }, // ļ
+    { 14, 24, 18, 3, 24, 48, 16628 }, // Ľ
+    { 10, 26, 13, 2, 26, 36, 16676 }, // ľ
+    { 14, 24, 18, 3, 24, 47, 16712 }, // Ŀ
+    { 9, 26, 12, 2, 26, 34, 16759 }, // ŀ
+    { 17, 24, 18, 0, 24, 52, 16793 }, // Ł
+    { 10, 26, 10, -1, 26, 55, 16845 }, // ł
+    { 20, 32, 25, 3, 32, 108, 16900 }, // Ń
+    { 16, 26, 21, 2, 26, 65, 17008 }, // ń
+    { 20, 32, 25, 3, 24, 107, 17073 }, // Ņ
+    { 16, 27, 21, 2, 19, 67, 17180 }, // ņ
+    { 20, 32, 25, 3, 32, 113, 17247 }, // Ň
+    { 16, 26, 21, 2, 26, 70, 17360 }, // ň
+    { 21, 24, 23, 0, 24, 77, 17430 }, // ŉ
+    { 20, 31, 25, 3, 24, 108, 17507 }, // Ŋ
+    { 16, 27, 21, 2, 19, 69, 17615 }, // ŋ
+    { 22, 30, 26, 2, 29, 99, 17684 }, // Ō
+    { 18, 24, 20, 1, 23, 73, 17783 }, // ō
+    { 22, 32, 26, 2, 31, 105, 17856 }, // Ŏ
+    { 18, 26, 20, 1, 25, 79, 17961 }, // ŏ
+    { 22, 33, 26, 2, 32, 110, 18040 }, // Ő
+    { 18, 27, 20, 1, 26, 82, 18150 }, // ő
+    { 27, 26, 31, 2, 25, 119, 18232 }, // Œ
+    { 29, 20, 32, 1, 19, 104, 18351 }, // œ
+    { 18, 32, 22, 3, 32, 85, 18455 }, // Ŕ
+    { 12, 26, 15, 2, 26, 45, 18540 }, // ŕ
+    { 18, 32, 22, 3, 24, 84, 18585 }, // Ŗ
+    { 12, 27, 15, 2, 19, 46, 18669 }, // ŗ
+    { 18, 32, 22, 3, 32, 91, 18715 }, // Ř
+    { 12, 26, 15, 2, 26, 48, 18806 }, // ř
+    { 16, 33, 18, 1, 32, 81, 18854 }, // Ś
+    { 14, 27, 16, 1, 26, 63, 18935 }, // ś
+    { 16, 33, 18, 1, 32, 87, 18998 }, // Ŝ
+    { 14, 27, 16, 1, 26, 65, 19085 }, // ŝ
+    { 16, 33, 18, 1, 25, 84, 19150 }, // Ş
+    { 14, 27, 16, 1, 19, 63, 19234 }, // ş
+    { 16, 33, 18, 1, 32, 87, 19297 }, // Š
+    { 14, 27, 16, 1, 26, 65, 19384 }, // š
+    { 19, 32, 20, 0, 24, 59, 19449 }, // Ţ
+    { 12, 30, 13, 0, 22, 56, 19508 }, // ţ
+    { 19, 32, 20, 0, 32, 62, 19564 }, // Ť
+    { 16, 27, 17, 0, 26, 55, 19626 }, // ť
+    { 19, 24, 20, 0, 24, 66, 19681 }, // Ŧ
+    { 12, 23, 13, 0, 22, 48, 19747 }, // ŧ
+    { 19, 32, 24, 3, 31, 97, 19795 }, // Ũ
+    { 16, 26, 21, 2, 25, 78, 19892 }, // ũ
+    { 19, 30, 24, 3, 29, 90, 19970 }, // Ū
+    { 16, 24, 21, 2, 23, 71, 20060 }, // ū
+    { 19, 32, 24, 3, 31, 96, 20131 }, // Ŭ
+    { 16, 26, 21, 2, 25, 77, 20227 }, // ŭ
+    { 19, 35, 24, 3, 34, 103, 20304 }, // Ů
+    { 16, 29, 21, 2, 28, 82, 20407 }, // ů
+    { 19, 33, 24, 3, 32, 101, 20489 }, // Ű
+    { 16, 27, 21, 2, 26, 80, 20590 }, // ű
+    { 19, 32, 24, 3, 24, 93, 20670 }, // Ų
+    { 17, 26, 21, 2, 18, 80, 20763 }, // ų
+    { 31, 32, 32, 0, 32, 159, 20843 }, // Ŵ
+    { 26, 26, 27, 0, 26, 115, 21002 }, // ŵ
+    { 19, 32, 20, 0, 32, 81, 21117 }, // Ŷ
+    { 17, 34, 18, 0, 26, 94, 21198 }, // ŷ
+    { 19, 31, 20, 0, 31, 75, 21292 }, // Ÿ
+    { 17, 32, 19, 1, 32, 76, 21367 }, // Ź
+    { 14, 26, 16, 1, 26, 63, 21443 }, // ź
+    { 17, 31, 19, 1, 31, 70, 21506 }, // Ż
+    { 14, 25, 16, 1, 25, 57, 21576 }, // ż
+    { 17, 32, 19, 1, 32, 79, 21633 }, // Ž
+    { 14, 26, 16, 1, 26, 64, 21712 }, // ž
+    { 11, 26, 14, 2, 26, 30, 21776 }, // ſ
+    { 25, 27, 28, 2, 26, 102, 21806 }, // Ơ
+    { 21, 22, 23, 1, 21, 73, 21908 }, // ơ
+    { 31, 26, 36, 2, 25, 124, 21981 }, // Ƣ
+    { 25, 27, 28, 1, 19, 122, 22105 }, // ƣ
+    { 22, 24, 23, 0, 24, 68, 22227 }, // Ƥ
+    { 17, 34, 21, 2, 26, 91, 22295 }, // ƥ
+    { 18, 28, 22, 3, 24, 77, 22386 }, // Ʀ
+    { 16, 26, 18, 1, 25, 68, 22463 }, // Ƨ
+    { 14, 20, 16, 1, 19, 46, 22531 }, // ƨ
+    { 17, 24, 19, 1, 24, 58, 22577 }, // Ʃ
+    { 15, 34, 15, -1, 26, 75, 22635 }, // ƪ
+    { 12, 30, 13, 0, 22, 57, 22710 }, // ƫ
+    { 19, 24, 20, 0, 24, 67, 22767 }, // Ƭ
+    { 12, 27, 13, 0, 26, 51, 22834 }, // ƭ
+    { 19, 32, 20, 0, 24, 58, 22885 }, // Ʈ
+    { 25, 27, 29, 3, 26, 97, 22943 }, // Ư
+    { 22, 22, 25, 2, 21, 79, 23040 }, // ư
+    { 8, 6, 0, -17, 26, 9, 23119 }, // ̀
+    { 7, 6, 0, -11, 26, 12, 23128 }, // ́
+    { 12, 6, 7, -6, 26, 14, 23140 }, // ̂
+    { 13, 5, 0, -17, 25, 17, 23154 }, // ̃
+    { 10, 3, 6, -5, 23, 9, 23171 }, // ̄
+    { 14, 4, 8, -7, 29, 12, 23180 }, // ̅
+    { 12, 5, 7, -6, 25, 15, 23192 }, // ̆
+    { 4, 5, 3, -2, 25, 7, 23207 }, // ̇
+    { 10, 4, 6, -5, 25, 12, 23214 }, // ̈
+    { 7, 9, 0, -13, 28, 17, 23226 }, // ̉
+    { 8, 8, 5, -4, 28, 19, 23243 }, // ̊
+    { 13, 6, 9, -5, 26, 21, 23262 }, // ̋
+    { 12, 6, 7, -6, 26, 15, 23283 }, // ̌
+    { 4, 7, 3, -2, 26, 10, 23298 }, // ̍
+    { 8, 7, 5, -4, 26, 14, 23308 }, // ̎
+    { 13, 6, 0, -18, 26, 19, 23322 }, // ̏
+    { 12, 9, 7, -6, 29, 23, 23341 }, // ̐
+    { 12, 5, 7, -6, 25, 15, 23364 }, // ̑
+    { 6, 9, 4, -3, 24, 14, 23379 }, // ̒
+    { 6, 9, 4, -3, 24, 14, 23393 }, // ̓
+    { 6, 9, 4, -3, 24, 14, 23407 }, // ̔
+    { 6, 9, 4, -3, 24, 14, 23421 }, // ̕
+    { 8, 6, 5, -4, -1, 10, 23435 }, // ̖
+    { 8, 6, 5, -4, -1, 10, 23445 }, // ̗
+    { 6, 8, 4, -3, 0, 10, 23455 }, // ̘
+    { 6, 8, 4, -3, 0, 10, 23465 }, // ̙
+    { 10, 9, 11, 0, 26, 18, 23475 }, // ̚
+    { 8, 8, 5, -4, 26, 13, 23493 }, // ̛
+    { 4, 8, 3, -2, 0, 12, 23506 }, // ̜
+    { 8, 6, 5, -4, -1, 9, 23518 }, // ̝
+    { 8, 6, 5, -4, -1, 13, 23527 }, // ̞
+    { 8, 8, 5, -4, 0, 14, 23540 }, // ̟
+    { 8, 3, 5, -4, -2, 3, 23554 }, // ̠
+    { 6, 10, 1, -6, 2, 17, 23557 }, // ̡
+    { 6, 10, 7, 0, 2, 17, 23574 }, // ̢
+    { 4, 4, 0, -12, -2, 6, 23591 }, // ̣
+    { 10, 4, 6, -5, -2, 12, 23597 }, // ̤
+    { 8, 8, 5, -4, 0, 19, 23609 }, // ̥
+    { 6, 6, 4, -3, -2, 9, 23628 }, // ̦
+    { 8, 8, 5, -4, 0, 14, 23637 }, // ̧
+    { 6, 9, 4, -3, 1, 16, 23651 }, // ̨
+    { 4, 7, 3, -2, -1, 10, 23667 }, // ̩
+    { 12, 7, 7, -6, -1, 21, 23677 }, // ̪
+    { 14, 4, 8, -7, -2, 15, 23698 }, // ̫
+    { 12, 6, 7, -6, -1, 15, 23713 }, // ̬
+    { 12, 6, 7, -6, -1, 15, 23728 }, // ̭
+    { 12, 5, 7, -6, -1, 15, 23743 }, // ̮
+    { 12, 5, 7, -6, -1, 15, 23758 }, // ̯
+    { 14, 5, 8, -7, -1, 17, 23773 }, // ̰
+    { 10, 3, 6, -5, -2, 9, 23790 }, // ̱
+    { 16, 3, 9, -8, -3, 7, 23799 }, // ̲
+    { 14, 8, 8, -7, 0, 23, 23806 }, // ̳
+    { 13, 5, 8, -6, 12, 18, 23829 }, // ̴
+    { 14, 4, 8, -7, 12, 12, 23847 }, // ̵
+    { 24, 3, 13, -12, 11, 27, 23859 }, // ̶
+    { 10, 8, 6, -5, 14, 14, 23886 }, // ̷
+    { 14, 28, 8, -7, 26, 57, 23900 }, // ̸
+    { 4, 8, 3, -2, 0, 11, 23957 }, // ̹
+    { 12, 7, 7, -6, -1, 21, 23968 }, // ̺
+    { 14, 8, 8, -7, 0, 30, 23989 }, // ̻
+    { 14, 4, 8, -7, -2, 16, 24019 }, // ̼
+    { 8, 7, 5, -4, 26, 18, 24035 }, // ̽
+    { 6, 10, 4, -3, 29, 16, 24053 }, // ̾
+    { 14, 8, 8, -7, 33, 23, 24069 }, // ̿
+    { 8, 6, 3, -6, 26, 10, 24092 }, // ̀
+    { 8, 6, 7, -2, 26, 10, 24102 }, // ́
+    { 14, 5, 8, -7, 25, 17, 24112 }, // ͂
+    { 6, 6, 4, -3, 26, 9, 24129 }, // ̓
+    { 13, 6, 8, -6, 26, 19, 24138 }, // ̈́
+    { 6, 6, 5, -2, -2, 9, 24157 }, // ͅ
+    { 16, 7, 9, -8, 26, 31, 24166 }, // ͆
+    { 14, 8, 8, -7, 0, 23, 24197 }, // ͇
+    { 8, 7, 5, -4, -1, 14, 24220 }, // ͈
+    { 8, 6, 5, -4, -2, 8, 24234 }, // ͉
+    { 14, 8, 8, -7, 26, 24, 24242 }, // ͊
+    { 14, 12, 8, -7, 31, 32, 24266 }, // ͋
+    { 12, 9, 7, -6, 29, 30, 24298 }, // ͌
+    { 12, 7, 7, -6, -1, 17, 24328 }, // ͍
+    { 8, 8, 5, -4, 0, 11, 24345 }, // ͎
+    { 24, 24, 13, -12, 24, 96, 24356 }, // ͏
+    { 6, 8, 4, -3, 27, 12, 24452 }, // ͐
+    { 5, 8, 4, -2, 28, 12, 24464 }, // ͑
+    { 12, 8, 7, -6, 28, 21, 24476 }, // ͒
+    { 8, 7, 5, -4, -1, 13, 24497 }, // ͓
+    { 6, 7, 4, -3, -1, 12, 24510 }, // ͔
+    { 6, 7, 4, -3, -1, 12, 24522 }, // ͕
+    { 14, 7, 8, -7, -1, 25, 24534 }, // ͖
+    { 5, 8, 4, -2, 28, 12, 24559 }, // ͗
+    { 4, 5, 9, 4, 25, 7, 24571 }, // ͘
+    { 8, 7, 5, -4, -1, 17, 24578 }, // ͙
+    { 14, 8, 8, -7, 0, 27, 24595 }, // ͚
+    { 8, 8, 5, -4, 27, 11, 24622 }, // ͛
+    { 26, 7, 14, -13, -1, 33, 24633 }, // ͜
+    { 26, 7, 14, -13, 26, 33, 24666 }, // ͝
+    { 20, 3, 11, -10, 23, 14, 24699 }, // ͞
+    { 20, 3, 11, -10, -2, 14, 24713 }, // ͟
+    { 26, 5, 14, -13, 25, 30, 24727 }, // ͠
+    { 26, 8, 14, -13, 29, 28, 24757 }, // ͡
+    { 27, 7, 15, -13, -1, 21, 24785 }, // ͢
+    { 8, 8, 5, -4, 28, 19, 24806 }, // ͣ
+    { 8, 8, 5, -4, 28, 19, 24825 }, // ͤ
+    { 3, 11, 3, -1, 31, 15, 24844 }, // ͥ
+    { 9, 8, 6, -4, 28, 23, 24859 }, // ͦ
+    { 8, 8, 5, -4, 28, 22, 24882 }, // ͧ
+    { 7, 8, 5, -3, 28, 16, 24904 }, // ͨ
+    { 8, 11, 5, -4, 31, 27, 24920 }, // ͩ
+    { 8, 11, 5, -4, 31, 27, 24947 }, // ͪ
+    { 13, 8, 8, -6, 28, 33, 24974 }, // ͫ
+    { 6, 8, 5, -2, 28, 13, 25007 }, // ͬ
+    { 6, 10, 4, -3, 30, 16, 25020 }, // ͭ
+    { 9, 8, 6, -4, 28, 19, 25036 }, // ͮ
+    { 9, 8, 6, -4, 28, 21, 25055 }, // ͯ
+    { 22, 24, 23, 0, 24, 82, 25076 }, // Α
+    { 17, 24, 22, 3, 24, 72, 25158 }, // Β
+    { 13, 24, 17, 3, 24, 38, 25230 }, // Γ
+    { 21, 24, 22, 0, 24, 80, 25268 }, // Δ
+    { 14, 24, 19, 3, 24, 52, 25348 }, // Ε
+    { 17, 24, 19, 1, 24, 59, 25400 }, // Ζ
+    { 19, 24, 25, 3, 24, 77, 25459 }, // Η
+    { 22, 26, 26, 2, 25, 95, 25536 }, // Θ
+    { 9, 24, 11, 1, 24, 29, 25631 }, // Ι
+    { 18, 24, 22, 3, 24, 67, 25660 }, // Κ
+    { 21, 24, 22, 0, 24, 77, 25727 }, // Λ
+    { 24, 24, 30, 3, 24, 97, 25804 }, // Μ
+    { 20, 24, 25, 3, 24, 91, 25901 }, // Ν
+    { 17, 24, 21, 2, 24, 46, 25992 }, // Ξ
+    { 22, 26, 26, 2, 25, 87, 26038 }, // Ο
+    { 19, 24, 24, 3, 24, 62, 26125 }, // Π
+    { 16, 24, 20, 3, 24, 56, 26187 }, // Ρ
+    { 17, 24, 19, 1, 24, 58, 26243 }, // Σ
+    { 19, 24, 20, 0, 24, 42, 26301 }, // Τ
+    { 19, 24, 20, 0, 24, 59, 26343 }, // Υ
+    { 26, 24, 28, 1, 24, 107, 26402 }, // Φ
+    { 20, 24, 21, 0, 24, 75, 26509 }, // Χ
+    { 22, 24, 27, 3, 24, 77, 26584 }, // Ψ
+    { 24, 25, 25, 0, 25, 95, 26661 }, // Ω
+    { 20, 20, 22, 1, 19, 72, 26756 }, // α
+    { 17, 34, 20, 2, 26, 92, 26828 }, // β
+    { 17, 25, 18, 0, 18, 69, 26920 }, // γ
+    { 17, 27, 20, 1, 26, 79, 26989 }, // δ
+    { 14, 20, 16, 1, 19, 52, 27068 }, // ε
+    { 15, 33, 17, 1, 26, 73, 27120 }, // ζ
+    { 16, 27, 20, 2, 19, 78, 27193 }, // η
+    { 17, 27, 20, 1, 26, 78, 27271 }, // θ
+    { 9, 19, 12, 2, 18, 37, 27349 }, // ι
+    { 16, 18, 19, 2, 18, 47, 27386 }, // κ
+    { 18, 27, 19, 0, 26, 72, 27433 }, // λ
+    { 19, 26, 22, 2, 18, 67, 27505 }, // μ
+    { 17, 18, 18, 0, 18, 52, 27572 }, // ν
+    { 15, 33, 17, 1, 26, 75, 27624 }, // ξ
+    { 18, 20, 20, 1, 19, 61, 27699 }, // ο
+    { 22, 19, 23, 0, 18, 63, 27760 }, // π
+    { 17, 27, 20, 2, 19, 84, 27823 }, // ρ
+    { 15, 26, 17, 1, 19, 54, 27907 }, // ς
+    { 19, 19, 21, 1, 18, 61, 27961 }, // σ
+    { 16, 19, 17, 0, 18, 53, 28022 }, // τ
+    { 16, 19, 20, 2, 18, 61, 28075 }, // υ
+    { 22, 34, 24, 1, 26, 129, 28136 }, // φ
+    { 20, 26, 21, 0, 18, 82, 28265 }, // χ
+    { 21, 34, 25, 2, 26, 110, 28347 }, // ψ
+    { 23, 19, 27, 2, 18, 80, 28457 }, // ω
+    { 22, 30, 23, 0, 24, 96, 28537 }, // Ạ
+    { 15, 25, 19, 1, 19, 66, 28633 }, // ạ
+    { 22, 34, 23, 0, 34, 107, 28699 }, // Ả
+    { 15, 29, 19, 1, 28, 76, 28806 }, // ả
+    { 22, 33, 23, 0, 33, 110, 28882 }, // Ấ
+    { 18, 29, 20, 1, 28, 81, 28992 }, // ấ
+    { 22, 33, 23, 0, 33, 111, 29073 }, // Ầ
+    { 16, 29, 19, 0, 28, 80, 29184 }, // ầ
+    { 22, 35, 23, 0, 35, 116, 29264 }, // Ẩ
+    { 17, 31, 19, 1, 30, 85, 29380 }, // ẩ
+    { 22, 35, 23, 0, 35, 119, 29465 }, // Ẫ
+    { 15, 31, 19, 1, 30, 83, 29584 }, // ẫ
+    { 22, 38, 23, 0, 32, 118, 29667 }, // Ậ
+    { 15, 32, 19, 1, 26, 84, 29785 }, // ậ
+    { 22, 34, 23, 0, 34, 109, 29869 }, // Ắ
+    { 15, 30, 19, 1, 29, 79, 29978 }, // ắ
+    { 22, 34, 23, 0, 34, 110, 30057 }, // Ằ
+    { 15, 30, 19, 1, 29, 81, 30167 }, // ằ
+    { 22, 35, 23, 0, 35, 114, 30248 }, // Ẳ
+    { 15, 31, 19, 1, 30, 83, 30362 }, // ẳ
+    { 22, 35, 23, 0, 35, 117, 30445 }, // Ẵ
+    { 15, 31, 19, 1, 30, 85, 30562 }, // ẵ
+    { 22, 37, 23, 0, 31, 116, 30647 }, // Ặ
+    { 15, 31, 19, 1, 25, 82, 30763 }, // ặ
+    { 14, 30, 19, 3, 24, 62, 30845 }, // Ẹ
+    { 17, 25, 19, 1, 19, 71, 30907 }, // ẹ
+    { 14, 34, 19, 3, 34, 73, 30978 }, // Ẻ
+    { 17, 29, 19, 1, 28, 83, 31051 }, // ẻ
+    { 14, 31, 19, 3, 31, 70, 31134 }, // Ẽ
+    { 17, 26, 19, 1, 25, 82, 31204 }, // ẽ
+    { 16, 33, 20, 3, 33, 77, 31286 }, // Ế
+    { 18, 29, 20, 1, 28, 85, 31363 }, // ế
+    { 16, 33, 19, 1, 33, 76, 31448 }, // Ề
+    { 17, 29, 19, 1, 28, 85, 31524 }, // ề
+    { 15, 35, 19, 3, 35, 83, 31609 }, // Ể
+    { 17, 31, 19, 1, 30, 90, 31692 }, // ể
+    { 14, 35, 19, 3, 35, 81, 31782 }, // Ễ
+    { 17, 31, 19, 1, 30, 91, 31863 }, // ễ
+    { 14, 38, 19, 3, 32, 79, 31954 }, // Ệ
+    { 17, 32, 19, 1, 26, 91, 32033 }, // ệ
+    { 9, 33, 11, 1, 33, 44, 32124 }, // Ỉ
+    { 7, 28, 10, 2, 28, 34, 32168 }, // ỉ
+    { 9, 30, 11, 1, 24, 38, 32202 }, // Ị
+    { 5, 31, 9, 2, 25, 34, 32240 }, // ị
+    { 22, 31, 26, 2, 25, 98, 32274 }, // Ọ
+    { 18, 25, 20, 1, 19, 71, 32372 }, // ọ
+    { 22, 34, 26, 2, 33, 108, 32443 }, // Ỏ
+    { 18, 29, 20, 1, 28, 81, 32551 }, // ỏ
+    { 22, 34, 26, 2, 33, 111, 32632 }, // Ố
+    { 18, 29, 20, 1, 28, 87, 32743 }, // ố
+    { 22, 34, 26, 2, 33, 111, 32830 }, // Ồ
+    { 18, 29, 20, 1, 28, 86, 32941 }, // ồ
+    { 22, 36, 26, 2, 35, 116, 33027 }, // Ổ
+    { 18, 31, 20, 1, 30, 92, 33143 }, // ổ
+    { 22, 36, 26, 2, 35, 119, 33235 }, // Ỗ
+    { 18, 31, 20, 1, 30, 92, 33354 }, // ỗ
+    { 22, 38, 26, 2, 32, 118, 33446 }, // Ộ
+    { 18, 32, 20, 1, 26, 90, 33564 }, // ộ
+    { 25, 33, 28, 2, 32, 120, 33654 }, // Ớ
+    { 21, 27, 23, 1, 26, 87, 33774 }, // ớ
+    { 25, 33, 28, 2, 32, 117, 33861 }, // Ờ
+    { 21, 27, 23, 1, 26, 86, 33978 }, // ờ
+    { 25, 35, 28, 2, 34, 127, 34064 }, // Ở
+    { 21, 29, 23, 1, 28, 93, 34191 }, // ở
+    { 25, 32, 28, 2, 31, 121, 34284 }, // Ỡ
+    { 21, 26, 23, 1, 25, 91, 34405 }, // ỡ
+    { 25, 32, 28, 2, 26, 114, 34496 }, // Ợ
+    { 21, 27, 23, 1, 21, 84, 34610 }, // ợ
+    { 19, 30, 24, 3, 24, 86, 34694 }, // Ụ
+    { 16, 24, 21, 2, 18, 68, 34780 }, // ụ
+    { 19, 34, 24, 3, 33, 94, 34848 }, // Ủ
+    { 16, 29, 21, 2, 28, 80, 34942 }, // ủ
+    { 25, 33, 29, 3, 32, 115, 35022 }, // Ứ
+    { 22, 27, 25, 2, 26, 95, 35137 }, // ứ
+    { 25, 33, 29, 3, 32, 113, 35232 }, // Ừ
+    { 22, 27, 25, 2, 26, 93, 35345 }, // ừ
+    { 25, 34, 29, 3, 33, 117, 35438 }, // Ử
+    { 22, 29, 25, 2, 28, 100, 35555 }, // ử
+    { 25, 32, 29, 3, 31, 117, 35655 }, // Ữ
+    { 22, 26, 25, 2, 25, 97, 35772 }, // ữ
+    { 25, 32, 29, 3, 26, 110, 35869 }, // Ự
+    { 22, 27, 25, 2, 21, 91, 35979 }, // ự
+    { 19, 32, 20, 0, 32, 77, 36070 }, // Ỳ
+    { 17, 34, 18, 0, 26, 89, 36147 }, // ỳ
+    { 19, 30, 20, 0, 24, 71, 36236 }, // Ỵ
+    { 17, 26, 18, 0, 18, 79, 36307 }, // ỵ
+    { 19, 33, 20, 0, 33, 79, 36386 }, // Ỷ
+    { 17, 36, 18, 0, 28, 95, 36465 }, // ỷ
+    { 19, 31, 20, 0, 31, 80, 36560 }, // Ỹ
+    { 17, 33, 18, 0, 25, 94, 36640 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 36734 }, //  
+    { 0, 0, 33, 0, 0, 0, 36734 }, //  
+    { 0, 0, 17, 0, 0, 0, 36734 }, //  
+    { 0, 0, 33, 0, 0, 0, 36734 }, //  
+    { 0, 0, 11, 0, 0, 0, 36734 }, //  
+    { 0, 0, 8, 0, 0, 0, 36734 }, //  
+    { 0, 0, 6, 0, 0, 0, 36734 }, //  
+    { 0, 0, 19, 0, 0, 0, 36734 }, //  
+    { 0, 0, 9, 0, 0, 0, 36734 }, //  
+    { 0, 0, 6, 0, 0, 0, 36734 }, //  
+    { 0, 0, 3, 0, 0, 0, 36734 }, //  
+    { 0, 0, 1, 0, 0, 0, 36734 }, // ​
+    { 0, 0, 1, 0, 0, 0, 36734 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 36734 }, // ‍
+    { 9, 28, 9, -1, 23, 45, 36734 }, // ‎
+    { 9, 28, 2, -8, 23, 46, 36779 }, // ‏
+    { 9, 4, 11, 1, 11, 10, 36825 }, // ‐
+    { 9, 4, 11, 1, 11, 10, 36835 }, // ‑
+    { 17, 4, 19, 1, 14, 16, 36845 }, // ‒
+    { 15, 4, 17, 1, 11, 15, 36861 }, // –
+    { 31, 4, 33, 1, 11, 27, 36876 }, // —
+    { 31, 4, 33, 1, 11, 27, 36903 }, // ―
+    { 11, 35, 18, 4, 26, 119, 36930 }, // ‖
+    { 15, 8, 15, -1, 0, 25, 37049 }, // ‗
+    { 6, 9, 7, 0, 24, 15, 37074 }, // ‘
+    { 6, 9, 7, 0, 24, 13, 37089 }, // ’
+    { 6, 9, 8, 1, 4, 15, 37102 }, // ‚
+    { 6, 9, 7, 0, 24, 14, 37117 }, // ‛
+    { 12, 9, 13, 0, 24, 29, 37131 }, // “
+    { 12, 9, 13, 0, 24, 28, 37160 }, // ”
+    { 12, 9, 14, 1, 4, 28, 37188 }, // „
+    { 12, 9, 13, 0, 24, 27, 37216 }, // ‟
+    { 13, 26, 17, 2, 26, 58, 37243 }, // †
+    { 14, 26, 17, 2, 26, 63, 37301 }, // ‡
+    { 8, 9, 13, 2, 17, 16, 37364 }, // •
+    { 9, 11, 12, 2, 18, 19, 37380 }, // ‣
+    { 5, 6, 17, 6, 5, 8, 37399 }, // ․
+    { 14, 6, 18, 2, 5, 16, 37407 }, // ‥
+    { 22, 6, 26, 2, 5, 22, 37423 }, // …
+    { 5, 6, 9, 2, 11, 7, 37445 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 37452 }, //  
+    { 0, 0, 20, 0, 0, 0, 37452 }, //  
+    { 9, 26, 9, -1, 21, 39, 37452 }, // ‪
+    { 9, 26, 2, -8, 21, 39, 37491 }, // ‫
+    { 8, 28, 5, -4, 23, 39, 37530 }, // ‬
+    { 8, 28, 5, -4, 23, 44, 37569 }, // ‭
+    { 8, 28, 5, -4, 23, 44, 37613 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 37657 }, //  
+    { 37, 26, 39, 1, 25, 178, 37657 }, // ‰
+    { 49, 26, 51, 1, 25, 230, 37835 }, // ‱
+    { 8, 9, 10, 1, 24, 15, 38065 }, // ′
+    { 14, 9, 16, 1, 24, 28, 38080 }, // ″
+    { 20, 9, 22, 1, 24, 42, 38108 }, // ‴
+    { 8, 9, 8, -1, 24, 14, 38150 }, // ‵
+    { 13, 9, 15, -1, 24, 27, 38164 }, // ‶
+    { 19, 9, 20, -1, 24, 42, 38191 }, // ‷
+    { 13, 11, 14, 0, 3, 29, 38233 }, // ‸
+    { 9, 15, 11, 1, 16, 23, 38262 }, // ‹
+    { 8, 15, 10, 1, 16, 23, 38285 }, // ›
+    { 26, 26, 28, 1, 25, 97, 38308 }, // ※
+    { 13, 25, 17, 2, 24, 68, 38405 }, // ‼
+    { 14, 26, 15, 0, 25, 60, 38473 }, // ‽
+    { 18, 3, 18, -1, 28, 21, 38533 }, // ‾
+    { 20, 7, 21, 0, -1, 24, 38554 }, // ‿
+    { 20, 8, 21, 0, 27, 28, 38578 }, // ⁀
+    { 12, 22, 13, 0, 14, 51, 38606 }, // ⁁
+    { 37, 31, 38, 0, 26, 171, 38657 }, // ⁂
+    { 9, 4, 11, 1, 11, 10, 38828 }, // ⁃
+    { 18, 24, 12, -7, 24, 49, 38838 }, // ⁄
+    { 8, 30, 11, 2, 24, 62, 38887 }, // ⁅
+    { 9, 30, 11, 0, 24, 66, 38949 }, // ⁆
+    { 28, 26, 29, 0, 25, 107, 39015 }, // ⁇
+    { 21, 26, 23, 0, 25, 86, 39122 }, // ⁈
+    { 20, 26, 23, 2, 25, 78, 39208 }, // ⁉
+    { 17, 18, 19, 1, 18, 44, 39286 }, // ⁊
+    { 17, 31, 22, 3, 26, 110, 39330 }, // ⁋
+    { 18, 17, 21, 1, 18, 73, 39440 }, // ⁌
+    { 18, 17, 21, 2, 18, 65, 39513 }, // ⁍
+    { 16, 16, 18, 1, 9, 48, 39578 }, // ⁎
+    { 6, 24, 8, 1, 19, 24, 39626 }, // ⁏
+    { 20, 35, 21, 0, 27, 76, 39650 }, // ⁐
+    { 16, 33, 18, 1, 26, 97, 39726 }, // ⁑
+    { 13, 26, 14, 0, 25, 60, 39823 }, // ⁒
+    { 29, 6, 33, 2, 13, 34, 39883 }, // ⁓
+    { 20, 8, 21, 0, 0, 29, 39917 }, // ⁔
+    { 18, 18, 19, 0, 17, 67, 39946 }, // ⁕
+    { 15, 26, 17, 1, 25, 41, 40013 }, // ⁖
+    { 25, 9, 27, 1, 24, 56, 40054 }, // ⁗
+    { 25, 26, 27, 1, 25, 60, 40110 }, // ⁘
+    { 25, 26, 28, 1, 25, 66, 40170 }, // ⁙
+    { 5, 26, 7, 1, 25, 19, 40236 }, // ⁚
+    { 20, 26, 22, 1, 25, 54, 40255 }, // ⁛
+    { 25, 26, 27, 1, 25, 99, 40309 }, // ⁜
+    { 5, 25, 9, 2, 24, 25, 40408 }, // ⁝
+    { 5, 26, 9, 2, 25, 31, 40433 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 40464 }, //  
+    { 0, 0, 20, 0, 0, 0, 40464 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 40464 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 40464 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 40464 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 40464 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 40464 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 40464 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 40464 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 40464 }, // ⁩
+    { 8, 28, 5, -4, 23, 44, 40464 }, // ⁪
+    { 8, 28, 5, -4, 23, 46, 40508 }, // ⁫
+    { 8, 28, 5, -4, 23, 43, 40554 }, // ⁬
+    { 8, 29, 5, -4, 24, 44, 40597 }, // ⁭
+    { 8, 28, 5, -4, 23, 46, 40641 }, // ⁮
+    { 8, 28, 5, -4, 23, 43, 40687 }, // ⁯
+    { 11, 16, 12, 0, 29, 42, 40730 }, // ⁰
+    { 3, 16, 6, 1, 25, 20, 40772 }, // ⁱ
+    { 12, 16, 13, 0, 29, 37, 40792 }, // ⁴
+    { 10, 16, 12, 1, 29, 36, 40829 }, // ⁵
+    { 12, 16, 13, 0, 29, 39, 40865 }, // ⁶
+    { 11, 16, 12, 0, 29, 24, 40904 }, // ⁷
+    { 11, 16, 12, 0, 29, 45, 40928 }, // ⁸
+    { 11, 16, 12, 0, 29, 42, 40973 }, // ⁹
+    { 10, 10, 12, 1, 25, 19, 41015 }, // ⁺
+    { 10, 3, 12, 1, 21, 8, 41034 }, // ⁻
+    { 10, 6, 12, 1, 23, 12, 41042 }, // ⁼
+    { 6, 19, 9, 2, 31, 28, 41054 }, // ⁽
+    { 6, 19, 8, 0, 31, 29, 41082 }, // ⁾
+    { 11, 12, 13, 1, 21, 36, 41111 }, // ⁿ
+    { 11, 16, 12, 0, 11, 42, 41147 }, // ₀
+    { 7, 16, 12, 1, 11, 25, 41189 }, // ₁
+    { 11, 16, 12, 0, 11, 32, 41214 }, // ₂
+    { 11, 16, 12, 0, 11, 37, 41246 }, // ₃
+    { 12, 16, 13, 0, 11, 37, 41283 }, // ₄
+    { 10, 16, 12, 1, 11, 36, 41320 }, // ₅
+    { 12, 16, 13, 0, 11, 39, 41356 }, // ₆
+    { 11, 16, 12, 0, 11, 24, 41395 }, // ₇
+    { 11, 16, 12, 0, 11, 45, 41419 }, // ₈
+    { 11, 16, 12, 0, 11, 42, 41464 }, // ₉
+    { 10, 10, 12, 1, 7, 19, 41506 }, // ₊
+    { 10, 3, 12, 1, 3, 8, 41525 }, // ₋
+    { 10, 6, 12, 1, 5, 12, 41533 }, // ₌
+    { 6, 19, 9, 2, 13, 28, 41545 }, // ₍
+    { 6, 19, 8, 0, 13, 29, 41573 }, // ₎
+    { 10, 12, 12, 1, 8, 32, 41602 }, // ₐ
+    { 11, 12, 13, 1, 8, 31, 41634 }, // ₑ
+    { 11, 12, 13, 1, 8, 31, 41665 }, // ₒ
+    { 12, 12, 13, 0, 8, 31, 41696 }, // ₓ
+    { 11, 12, 13, 1, 8, 32, 41727 }, // ₔ
+    { 11, 16, 13, 1, 12, 43, 41759 }, // ₕ
+    { 11, 16, 13, 1, 12, 39, 41802 }, // ₖ
+    { 3, 16, 6, 1, 12, 23, 41841 }, // ₗ
+    { 18, 12, 20, 1, 8, 53, 41864 }, // ₘ
+    { 11, 12, 13, 1, 8, 34, 41917 }, // ₙ
+    { 12, 16, 14, 1, 8, 43, 41951 }, // ₚ
+    { 9, 12, 11, 1, 8, 25, 41994 }, // ₛ
+    { 8, 14, 9, 0, 10, 21, 42019 }, // ₜ
+    { 17, 25, 19, 1, 25, 65, 42040 }, // ₠
+    { 18, 28, 20, 1, 26, 112, 42105 }, // ₡
+    { 17, 26, 19, 1, 25, 74, 42217 }, // ₢
+    { 17, 24, 19, 1, 24, 60, 42291 }, // ₣
+    { 17, 25, 19, 1, 25, 76, 42351 }, // ₤
+    { 27, 27, 31, 2, 23, 113, 42427 }, // ₥
+    { 19, 24, 20, 0, 24, 97, 42540 }, // ₦
+    { 23, 25, 26, 2, 24, 111, 42637 }, // ₧
+    { 25, 25, 28, 2, 24, 119, 42748 }, // ₨
+    { 22, 24, 23, 0, 24, 119, 42867 }, // ₩
+    { 22, 24, 27, 2, 24, 123, 42986 }, // ₪
+    { 20, 32, 22, 1, 26, 102, 43109 }, // ₫
+    { 19, 26, 20, 0, 25, 67, 43211 }, // €
+    { 20, 24, 21, 0, 24, 83, 43278 }, // ₭
+    { 19, 24, 20, 0, 24, 64, 43361 }, // ₮
+    { 32, 33, 33, 0, 25, 150, 43425 }, // ₯
+    { 18, 33, 19, 0, 25, 98, 43575 }, // ₰
+    { 19, 24, 20, 0, 24, 75, 43673 }, // ₱
+    { 20, 29, 24, 2, 26, 109, 43748 }, // ₲
+    { 21, 24, 22, 0, 24, 79, 43857 }, // ₳
+    { 18, 26, 19, 0, 25, 86, 43936 }, // ₴
+    { 19, 29, 22, 2, 26, 80, 44022 }, // ₵
+    { 20, 23, 21, 0, 22, 69, 44102 }, // ₶
+    { 23, 28, 24, 0, 25, 119, 44171 }, // ₷
+    { 18, 24, 19, 0, 24, 67, 44290 }, // ₸
+    { 15, 24, 19, 2, 24, 56, 44357 }, // ₹
+    { 19, 25, 20, 0, 24, 70, 44413 }, // ₺
+    { 26, 26, 27, 0, 25, 107, 44483 }, // ₻
+    { 24, 24, 27, 1, 24, 78, 44590 }, // ₼
+    { 19, 24, 20, 0, 24, 70, 44668 }, // ₽
+    { 22, 26, 26, 2, 26, 120, 44738 }, // ₾
+    { 15, 32, 19, 3, 28, 83, 44858 }, // ₿
+    { 14, 24, 16, 1, 19, 61, 44941 }, // ⃀
+    { 17, 3, 19, 1, 13, 15, 45002 }, // −
+    { 31, 32, 33, 1, 26, 132, 45017 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
@@ -5118,4 +3644,5 @@ static const EpdFontData notosans_16_regular = {
     36,
     -10,
     true,
+    true,
 };
@@ -2,6165 +2,4185 @@
  * generated by fontconvert.py
  * name: notosans_18_regular
  * size: 18
- * mode: 2-bit
- * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_regularBitmaps[85948] = {
-    0x2F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC2, 0xFC, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x1F,
-    0x81, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x40, 0xF4, 0x0F, 0x40, 0xF0, 0x0F, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x7F, 0x02, 0xF9, 0xFC, 0x0B, 0xF7,
-    0xF0, 0x2F, 0x9F, 0x80, 0x7E, 0x3E, 0x01, 0xF8, 0xF8, 0x07, 0xD3, 0xE0, 0x0F, 0x4F, 0x40, 0x3D,
-    0x3D, 0x00, 0xF0, 0xF4, 0x03, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0x06, 0xAB, 0xFA, 0xAB, 0xFA, 0xA8, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xE0, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x15, 0x5F, 0xD5, 0x5F, 0xD5, 0x50, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x1F, 0x40, 0x00, 0x00, 0x2F,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFB, 0xFF, 0x03, 0xF8, 0x2F, 0x01, 0xA0, 0xBF, 0x02, 0xF0, 0x00,
-    0x0B, 0xE0, 0x2F, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0x2F, 0x00, 0x00, 0x3F, 0xD2,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xBF, 0xF4, 0x00, 0x02, 0xF0, 0x7F, 0xC0, 0x00, 0x2F,
-    0x00, 0xFC, 0x00, 0x02, 0xF0, 0x0F, 0xD0, 0x00, 0x2F, 0x00, 0xFD, 0x00, 0x02, 0xF0, 0x1F, 0xCB,
-    0x40, 0x2F, 0x0B, 0xF8, 0xBF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x1B, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x4B,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x80,
-    0x03, 0xF0, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x3F, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x0F, 0x80, 0x54, 0x00, 0x3F,
-    0x00, 0x3E, 0x0B, 0xC1, 0xFF, 0xE0, 0x0B, 0xC0, 0x1F, 0x43, 0xE1, 0xFF, 0xFE, 0x00, 0xF8, 0x0F,
-    0xC3, 0xF0, 0xFD, 0x0F, 0xD0, 0x2F, 0xEF, 0xE1, 0xF8, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xE0, 0xFC,
-    0x1F, 0x40, 0x3F, 0x00, 0x1A, 0x80, 0x7D, 0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x02, 0xF0,
-    0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x02, 0xF0, 0x00,
-    0x03, 0xF0, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0xFC,
-    0x00, 0x02, 0xF4, 0x3F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xFA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0x54,
-    0x00, 0xBF, 0xDF, 0xF8, 0x00, 0x0F, 0xD0, 0x0B, 0xFC, 0x0F, 0xF8, 0x00, 0x3F, 0x00, 0x3F, 0x80,
-    0x0F, 0xF8, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x0F, 0xF8, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x0F, 0xF8,
-    0x7F, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xF4, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x2F, 0xFE, 0xAB, 0xFF, 0xCB, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x0B,
-    0xFC, 0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x7F, 0x7F, 0x7E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0xBE,
-    0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x02,
-    0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-    0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x02, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x7D, 0x00, 0x0F, 0xC0,
-    0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xFE,
-    0x00, 0x2F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xF8, 0x00, 0xBE,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF0,
-    0x01, 0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x02, 0xF8, 0x01,
-    0xFC, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x15, 0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00,
-    0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF,
-    0x00, 0xBF, 0x40, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2A, 0xAA, 0xFE, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x2F, 0xC0, 0xFF, 0x03, 0xF4, 0x1F,
-    0xC0, 0x7F, 0x02, 0xF4, 0x0F, 0xC0, 0x3E, 0x01, 0xF0, 0x00, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xE1, 0x55, 0x54, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFA, 0xFF, 0x80, 0x03,
-    0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00,
-    0x02, 0xF8, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0x3F,
-    0x4F, 0xD0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xE3, 0xF0,
-    0x00, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00,
-    0x0F, 0xD3, 0xF4, 0x00, 0x00, 0x3F, 0x4F, 0xD0, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x03, 0xF0,
-    0x7F, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0xFE, 0x02, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF8,
-    0x00, 0x7F, 0x80, 0x07, 0xFE, 0x6B, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x3F, 0xD0, 0x07, 0xFF, 0x40, 0xBF,
-    0xFD, 0x0F, 0xF7, 0xF5, 0xFF, 0x4F, 0xD3, 0xF0, 0x3F, 0x46, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xEB, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0xBF, 0x80, 0x28, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x40, 0x00,
-    0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xEA, 0xFF, 0xC0, 0x2F, 0x90, 0x00, 0xBF, 0xC0, 0x24, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x5B, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0x00, 0x0A, 0xAB,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x74, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xA5, 0x6F,
-    0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xE7, 0xF0, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x1F, 0xC0, 0x00,
-    0x00, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x01, 0xFC, 0x00, 0x1F,
-    0x80, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x45, 0x50, 0x00, 0x03,
-    0xFF, 0xFF, 0xF9, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xE9, 0x56, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x4A, 0x00, 0x00, 0x1F, 0xF0, 0xBF, 0xA5, 0xAF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xAA, 0xA0, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x1B,
-    0xA4, 0x00, 0xBE, 0x2F, 0xFF, 0xF4, 0x0F, 0xDB, 0xFF, 0xFF, 0xE0, 0xFF, 0xF4, 0x00, 0xFF, 0x4F,
-    0xFC, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00,
-    0x0B, 0xEB, 0xD0, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0xFE, 0x3F,
-    0x40, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x02, 0xFC, 0x0F, 0xF0, 0x00, 0xBF, 0x40, 0x7F, 0xE5, 0xBF,
-    0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xEA, 0xFF, 0xD0, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00,
-    0xBE, 0x07, 0xF0, 0x00, 0x02, 0xF8, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x7F, 0x40, 0x03, 0xF8, 0x00, 0xBF, 0x80, 0x7F, 0xC0, 0x00, 0xBF, 0xEF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xEB, 0xFF, 0x40, 0x07, 0xFC, 0x01, 0xFF,
-    0x80, 0x3F, 0x80, 0x00, 0xBF, 0x42, 0xFC, 0x00, 0x00, 0xBF, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xE0, 0x00,
-    0x01, 0xFC, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x3F, 0xF9, 0x56, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xEA, 0xFF, 0x80, 0x0B, 0xF4, 0x00,
-    0xBF, 0x40, 0x7F, 0x40, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x3F, 0x4F, 0xD0,
-    0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0x3F, 0xD0, 0xFF, 0x00, 0x07,
-    0xFF, 0x41, 0xFF, 0xEA, 0xFD, 0xFD, 0x01, 0xFF, 0xFF, 0xD3, 0xF4, 0x00, 0x7F, 0xF8, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x09, 0x56, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFC, 0x7F,
-    0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x02, 0x80, 0x3F, 0xC1, 0xFF, 0x47, 0xFC, 0x0F, 0xF0, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x40, 0x3F, 0x80, 0xFD, 0x07, 0xF0, 0x2F, 0xC0, 0xFD, 0x03, 0xF0, 0x1F, 0x80, 0xBC,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x55,
-    0x55, 0x55, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x55, 0x55, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0x40, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xBF, 0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFE, 0xFF, 0xF0, 0x2E, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6B, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0xBE, 0x00, 0x01, 0x55, 0x40, 0x02, 0xF4, 0x0F, 0xC0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x0F, 0x82, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBC, 0x3F, 0x00, 0x2F, 0xD0, 0x0B, 0xD0,
-    0x07, 0xC3, 0xE0, 0x07, 0xF0, 0x00, 0xBC, 0x00, 0x3D, 0x7D, 0x00, 0xBD, 0x00, 0x0B, 0xC0, 0x03,
-    0xDB, 0xC0, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0xBC, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xEF,
-    0xC0, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x3D, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xCF, 0xC0,
-    0x0F, 0x80, 0x00, 0xFC, 0x00, 0xBC, 0xBC, 0x00, 0xFC, 0x00, 0x2F, 0xC0, 0x0F, 0x8B, 0xC0, 0x0B,
-    0xE0, 0x07, 0xFD, 0x02, 0xF0, 0x7D, 0x00, 0x3F, 0xD6, 0xF6, 0xF9, 0xFE, 0x03, 0xE0, 0x01, 0xFF,
-    0xFD, 0x0F, 0xFF, 0x80, 0x3F, 0x00, 0x02, 0xFE, 0x00, 0x2F, 0x90, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x05, 0xBF, 0x40,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x01, 0xBF, 0xE0, 0x7F, 0x00,
-    0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x1F,
-    0xD0, 0x7F, 0x55, 0x56, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0x55, 0x56, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00,
-    0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0x00, 0x00,
-    0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x1F, 0xC0, 0x01, 0x6F, 0xFD,
-    0x00, 0x7F, 0x00, 0x00, 0x0B, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x07, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xD1, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x87, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x81, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x1F, 0xC0,
-    0x00, 0x6F, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55,
-    0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA,
-    0xAA, 0xA8, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00, 0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFA,
-    0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00,
-    0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xFF,
-    0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF5, 0x55, 0x55, 0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xAA, 0xAA, 0xAA, 0xAF, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1,
-    0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00,
-    0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B,
-    0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0,
-    0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00,
-    0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xE0, 0x00, 0xFD,
-    0x00, 0x3F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xBF,
-    0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xC0, 0x7F, 0x40,
-    0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x3F, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF4,
-    0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x7E, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBD,
-    0xFD, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFD, 0x7E, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0xFD, 0x7E,
-    0x2F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x7E, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFD, 0x7E, 0x0F, 0xD0,
-    0x00, 0x0B, 0xE0, 0xFD, 0x7F, 0x07, 0xF0, 0x00, 0x0F, 0xC0, 0xFD, 0x7F, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0xFD, 0x7F, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFD,
-    0x7F, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xFD, 0x7F, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x2F, 0x82, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x1F, 0xC3,
-    0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xD7, 0xE0, 0x00, 0xFD, 0x7F, 0x00, 0x0B, 0xEB, 0xD0, 0x00,
-    0xFD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x7F,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xFD, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7,
-    0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x80, 0x00, 0x07, 0xF7, 0xE2, 0xFC, 0x00, 0x00, 0x7F,
-    0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x7E, 0x02, 0xFC, 0x00, 0x07,
-    0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x40, 0x07, 0xF7, 0xF0, 0x03, 0xFC, 0x00,
-    0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07, 0xF7, 0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x7F, 0x00, 0x03, 0xFC,
-    0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x00, 0x00, 0xBF, 0x43, 0xF7, 0xF0, 0x00, 0x03,
-    0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0xE3, 0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x7F, 0x00, 0x00,
-    0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xE9, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0x01, 0x7F,
-    0xF4, 0x7F, 0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0,
-    0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0F,
-    0xD7, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87, 0xF5, 0x56, 0xBF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xAA, 0x94, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x0B,
-    0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x3F, 0xC0,
-    0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00,
-    0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07,
-    0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2,
-    0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF4, 0x00, 0x00, 0x00, 0xFE,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0x3F,
-    0x80, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xEF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x1F, 0xC0,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x3F, 0x7E, 0x00, 0x00, 0x7F, 0x00,
-    0xFE, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x02, 0xF8, 0x02, 0xFC, 0x00, 0x0B, 0xE3, 0xF0, 0x00, 0x0F,
-    0xD0, 0x07, 0xF0, 0x00, 0x3F, 0x4B, 0xE0, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x1F, 0xC0,
-    0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBF, 0x00, 0x2F, 0x40,
-    0xFD, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x07,
-    0xF0, 0x03, 0xF0, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x2F, 0x80, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x2F,
-    0xC0, 0xFD, 0x00, 0x2F, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0x00, 0xFD, 0x1F, 0x80, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0xBD, 0x00, 0x02, 0xF8, 0xFE,
-    0x00, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x0F,
-    0xCF, 0xC0, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x3F, 0xBE, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x81, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x40, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x00,
-    0xBF, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0xBE, 0x00, 0x00,
-    0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00,
-    0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x7F, 0xFF, 0xDF, 0xFF, 0xF7, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00,
-    0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00,
-    0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0x40, 0x7E, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0xFF, 0xD3,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x00, 0x0F, 0x4B, 0xC0, 0x00, 0x00, 0x2F,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xC0, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x02, 0xF4,
-    0x7E, 0x00, 0x00, 0x00, 0xFC, 0x2A, 0xAA, 0xAA, 0xAA, 0x93, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x6A, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x00, 0x50, 0x00, 0x00, 0x55, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F, 0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2,
-    0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF, 0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFE, 0x00, 0xFD, 0xBF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x02, 0xFC,
-    0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00,
-    0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0xFD, 0xFF, 0x80, 0x00,
-    0x2F, 0xCF, 0xFD, 0x00, 0x0B, 0xF8, 0xFE, 0xFE, 0x5B, 0xFF, 0x0F, 0xCB, 0xFF, 0xFF, 0xC0, 0xF8,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40,
-    0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x05, 0x50, 0x07, 0xF0, 0x0B, 0xFF, 0xF4, 0x7F, 0x03, 0xFF, 0xFF, 0xE7, 0xF0, 0xFF, 0xD5, 0x6F,
-    0xFF, 0x2F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xBF, 0x00,
-    0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFE, 0x00, 0x07, 0xFF,
-    0x0F, 0xFE, 0x5B, 0xFB, 0xF0, 0x3F, 0xFF, 0xFD, 0x3F, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00,
-    0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF9,
-    0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x00, 0x0F, 0xF0, 0x14, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xF4, 0x05, 0x7F,
-    0x95, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0,
-    0xFF, 0xD5, 0x7F, 0xBF, 0x1F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE,
-    0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x57, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47,
-    0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55,
-    0x00, 0x0F, 0xD1, 0xFF, 0xFF, 0x40, 0xFD, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xE5, 0x6F, 0xF0, 0xFF,
-    0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00,
-    0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x0A, 0x0F, 0xE3, 0xFC,
-    0xFE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD,
-    0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x00,
-    0x02, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x2F, 0xF8, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x8F, 0xD0, 0x00, 0x7F, 0x83, 0xF4, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF4, 0x3F, 0xC0, 0x00,
-    0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x8B, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x01,
-    0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x07, 0xF8, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x68, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFE,
-    0x00, 0xBF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x0F, 0xEF, 0x95, 0xBF, 0xDF,
-    0xE5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x07, 0xFC, 0x00,
-    0x02, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFC, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD,
-    0x0F, 0xEF, 0xD5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00,
-    0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA,
-    0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0F,
-    0xC1, 0xFF, 0xFE, 0x00, 0xFC, 0xBF, 0xFF, 0xFC, 0x0F, 0xEF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00,
-    0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0,
-    0x00, 0x01, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0xFE, 0x00, 0x0B, 0xF8, 0xFF, 0xFE, 0x5B, 0xFF,
-    0x0F, 0xDB, 0xFF, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0,
-    0xFF, 0xD5, 0x7F, 0xBF, 0x2F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00,
-    0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF2, 0xFE,
-    0x00, 0x07, 0xFF, 0x0F, 0xFE, 0x5B, 0xFB, 0xF0, 0x3F, 0xFF, 0xFD, 0x7F, 0x00, 0x7F, 0xFF, 0x47,
-    0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x55, 0xFC, 0x0B, 0xFF, 0xFC,
-    0x3F, 0xFE, 0xFC, 0xFF, 0xA9, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0xE4,
-    0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x20, 0x00, 0x02, 0xFC,
-    0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00,
-    0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0F,
-    0xE0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x47, 0xF0, 0x00, 0x00, 0x1F, 0x8B, 0xE0, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x00, 0x00, 0x0B, 0xEF,
-    0x80, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF4, 0x2F,
-    0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x03, 0xF2, 0xF4, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x3F, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xF0, 0x07,
-    0xE0, 0xFC, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0xBD, 0x0F, 0xC0, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xC0,
-    0xBE, 0x03, 0xF4, 0x00, 0x2F, 0x81, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x40, 0x3F,
-    0x07, 0xF0, 0x00, 0x0F, 0xC3, 0xF0, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0xFD, 0x3E, 0x00, 0x1F, 0x8F,
-    0xD0, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0x00, 0x0F, 0xDF, 0x80,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xF4, 0x0F, 0xF0, 0x00, 0x0F, 0xE0, 0x03, 0xF8,
-    0x00, 0x2F, 0xC0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x82,
-    0xFC, 0x00, 0x00, 0x1F, 0xD7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x7F, 0x01, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x1F, 0xD0, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00,
-    0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F,
-    0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF,
-    0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x2B, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x0F, 0xF4, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x6F, 0x00, 0x29, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0xA9, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xC0,
-    0x03, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFF, 0x80, 0x03, 0xFF, 0x40, 0x00, 0xB9, 0x00, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0xE3, 0xFF, 0xFF, 0xFA, 0x6F, 0x8F,
-    0x40, 0x7F, 0xFF, 0xFD, 0x20, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03,
-    0xFC, 0x3F, 0xD7, 0xFD, 0x3F, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x05, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
-    0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF8, 0x2F, 0x82, 0xF8, 0x2F, 0x82, 0xF8, 0x3F,
-    0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xEF, 0xF8, 0x0F, 0xF8, 0x00, 0x10, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x01, 0x7C,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFA, 0xBF, 0xE0,
-    0x00, 0x7F, 0x80, 0x01, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x56, 0xFE, 0x55,
-    0x54, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x04, 0x00, 0x00, 0x01, 0x03, 0xD0, 0x5A, 0x40,
-    0xF8, 0x7F, 0x7F, 0xFF, 0xBF, 0x81, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xF4, 0x02, 0xFC, 0x00, 0xFC,
-    0x00, 0x0B, 0xD0, 0x0F, 0x40, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x1F,
-    0x02, 0xF0, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x0B, 0xE0,
-    0x01, 0xFC, 0x00, 0xFF, 0xE5, 0xBF, 0xD0, 0x3F, 0xFF, 0xFF, 0xFF, 0x47, 0xE1, 0xBF, 0xE1, 0xFC,
-    0x28, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x4F, 0xE0,
-    0x00, 0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x2F, 0x80, 0x00, 0x07, 0xF0, 0x03, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0xBE, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x02, 0xF8,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xE0, 0x1F, 0xC0, 0x00, 0x00, 0xFD,
-    0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x1A, 0xAF, 0xFF, 0xAA, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xAA, 0xBF,
-    0xEA, 0xA0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x29, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3E,
-    0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 0x5A,
-    0xA9, 0x00, 0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x00, 0x78, 0x7F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xBF, 0xF4, 0x0F, 0xD0, 0x1F, 0xF8, 0x3E, 0x00, 0x0B, 0xF5, 0xF4,
-    0x00, 0x0B, 0xE7, 0xD0, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x3E, 0x3F, 0xC0, 0x01, 0xF4, 0x7F, 0xE0,
-    0x0F, 0xC0, 0x3F, 0xFE, 0xFD, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x02, 0xFA, 0x40, 0x00, 0x0F, 0xDF,
-    0xE9, 0x56, 0xFF, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x01, 0xFC, 0x3F, 0x00, 0xFC, 0x04, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x06, 0xA9, 0x00, 0x3F,
-    0x00, 0x1F, 0x00, 0x0F, 0xFF, 0xF8, 0x03, 0xD0, 0x0F, 0x40, 0x0F, 0xFE, 0xFD, 0x00, 0x7C, 0x07,
-    0xC0, 0x0F, 0xE0, 0x01, 0x00, 0x0F, 0x42, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xF0, 0xF4, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x03, 0xD3, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x3C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xC2, 0xE0, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-    0x40, 0x2F, 0xE5, 0xAD, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xFF, 0xFF, 0x40, 0x3E, 0x00, 0x3F, 0x00,
-    0x0B, 0xFE, 0x40, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF9, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00,
-    0x03, 0xE0, 0x6F, 0xFF, 0x8F, 0xFA, 0xBE, 0xBD, 0x00, 0xFB, 0xE0, 0x03, 0xEF, 0x80, 0x1F, 0xAF,
-    0x96, 0xFE, 0x3F, 0xFE, 0x78, 0x1A, 0x40, 0x40, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0xE0, 0x0B,
-    0xD0, 0x03, 0xF4, 0x0B, 0xF0, 0x03, 0xF8, 0x07, 0xF0, 0x02, 0xFC, 0x03, 0xF4, 0x02, 0xFC, 0x03,
-    0xF8, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0xFD, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0xFE, 0x00, 0x0B, 0xF0,
-    0x0F, 0xE0, 0x00, 0xBF, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0xFE, 0x02, 0xFC, 0x00,
-    0x0F, 0xD0, 0x2F, 0xC0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x24, 0x00, 0x20, 0x2A, 0xAA, 0xAA, 0xAA,
-    0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x01, 0xAA, 0xA4, 0x00, 0x3F, 0x00, 0x1F, 0x00,
-    0xBF, 0xFF, 0xE0, 0x03, 0xD0, 0x0F, 0x40, 0x2F, 0xFF, 0xFD, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0xD0,
-    0x1F, 0xC0, 0x0F, 0x42, 0xE0, 0x02, 0xF4, 0x03, 0xF0, 0x01, 0xF0, 0xF4, 0x00, 0xBD, 0x00, 0xBC,
-    0x00, 0x3C, 0x3C, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F, 0x0F, 0x00, 0x0B, 0xD0, 0x3F, 0x80, 0x03,
-    0xD3, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xF4, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x3D, 0x3C,
-    0x00, 0x2F, 0x97, 0xF0, 0x00, 0x0F, 0x0F, 0x40, 0x0B, 0xD0, 0xBD, 0x00, 0x03, 0xC2, 0xE0, 0x02,
-    0xF4, 0x0F, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0xBD, 0x02, 0xF8, 0x00, 0xF8, 0x0F, 0x40, 0x2F, 0x40,
-    0x3F, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xD0, 0x07, 0xF0, 0x3E, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0xBD,
-    0x2F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF9, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0x80, 0x1F, 0xFF, 0xF4, 0x3F, 0x41, 0xFC, 0xBC, 0x00, 0x3E, 0xF8, 0x00, 0x2F, 0xF8,
-    0x00, 0x1F, 0xF8, 0x00, 0x2F, 0xBC, 0x00, 0x3E, 0x3E, 0x00, 0xBD, 0x2F, 0xFF, 0xF8, 0x07, 0xFF,
-    0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2A, 0xAA, 0xFE, 0xAA, 0xA4, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x01, 0xFF, 0x90, 0x1F, 0xFF, 0xF4, 0x2F, 0x91, 0xFC, 0x08, 0x00, 0x7D, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFD, 0x15, 0x55, 0x54, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFD, 0x03, 0xF4, 0x1F, 0xC0, 0x10,
-    0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x0F, 0xFF, 0x80, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x04,
-    0x00, 0x1F, 0x87, 0xE9, 0x6F, 0xC1, 0xFF, 0xFF, 0xD0, 0x06, 0xAA, 0x40, 0x00, 0x00, 0xAA, 0x00,
-    0xBF, 0x40, 0x3F, 0x80, 0x3F, 0x80, 0x2F, 0x80, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x00, 0x7F, 0xCF, 0xF8, 0x00, 0x0F, 0xFC, 0xFF, 0xF9,
-    0x5B, 0xEF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFD, 0x7F, 0xFD, 0x0B, 0xCF, 0xD0, 0x54, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A, 0xAA, 0xA4, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF,
-    0xFE, 0xAF, 0x87, 0xFF, 0xFF, 0xE0, 0x2E, 0x3F, 0xFF, 0xFF, 0x80, 0xB9, 0xFF, 0xFF, 0xFE, 0x02,
-    0xEB, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBB, 0xFF,
-    0xFF, 0xFE, 0x02, 0xEF, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF,
-    0x80, 0xBA, 0xFF, 0xFF, 0xFE, 0x02, 0xE7, 0xFF, 0xFF, 0xF8, 0x0B, 0x8F, 0xFF, 0xFF, 0xE0, 0x2E,
-    0x1F, 0xFF, 0xFF, 0x80, 0xB8, 0x1F, 0xFF, 0xFE, 0x02, 0xE0, 0x0B, 0xFF, 0xF8, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x2E, 0x02, 0xE0, 0x00, 0x00, 0xB8,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x2E, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00,
-    0x2E, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0xB8, 0x00, 0x00, 0x1D, 0x01, 0xD0, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x03,
-    0xD0, 0x07, 0xC0, 0x0F, 0xF4, 0x06, 0xFD, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x7F, 0xFC, 0x7F,
-    0xE0, 0x00, 0x2A, 0x01, 0xFF, 0x0B, 0xFF, 0x3F, 0xAF, 0x3D, 0x2F, 0x10, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x3F, 0x00, 0xBC, 0x7C,
-    0x00, 0x3D, 0xB8, 0x00, 0x2F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xB8, 0x00, 0x2F, 0xBC, 0x00,
-    0x3E, 0x3D, 0x00, 0x7D, 0x2F, 0x96, 0xF8, 0x0B, 0xFF, 0xE0, 0x00, 0x69, 0x00, 0x04, 0x00, 0x04,
-    0x00, 0x0F, 0x80, 0x2F, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x03, 0xF4,
-    0x0F, 0xE0, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0xFF, 0x01, 0xFD, 0x00,
-    0x2F, 0xC0, 0x3F, 0x40, 0x1F, 0xC0, 0x3F, 0x80, 0x1F, 0xD0, 0x3F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x0B, 0xF0, 0x1F, 0xD0, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x20, 0x00, 0x60,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xDB, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x3C, 0x2F, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xD0, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0xBF, 0x40, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xFD, 0x00,
-    0x03, 0xF0, 0x2F, 0x00, 0x3E, 0xF4, 0x00, 0x0F, 0xC1, 0xF8, 0x02, 0xE7, 0xD0, 0x00, 0x05, 0x0F,
-    0xC0, 0x1F, 0x1F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0xF4, 0xBD, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0x82,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x7C, 0x0B, 0xD0, 0x00, 0x01, 0xF8, 0x03, 0xD0, 0x2F, 0x40, 0x00,
-    0x0F, 0xC0, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0xBD, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xE0, 0x01,
-    0x55, 0x5B, 0xE4, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0xCF, 0x40,
-    0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x1F, 0x40, 0x15, 0x00, 0x00, 0x0F, 0x40, 0x3F, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0x40, 0xBD,
-    0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0x40, 0xF8, 0x2E, 0x00, 0xFC, 0x00, 0x0F, 0x43, 0xF0, 0x00, 0x00,
-    0x7D, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x00, 0x7D, 0x00, 0x05, 0x0F, 0xC0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x95, 0x54, 0x00, 0x7D, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xF8, 0x00, 0xB9, 0x07, 0xF0, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x03,
-    0xFF, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0xFE, 0x05, 0x00, 0x0B, 0xE0, 0x7D, 0x00,
-    0xFF, 0x81, 0xFE, 0xAF, 0xF0, 0x3F, 0x00, 0xBB, 0xE0, 0x7F, 0xFF, 0xF0, 0x2F, 0x00, 0x7C, 0xF8,
-    0x00, 0x6A, 0x40, 0x0F, 0x80, 0x3D, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x2E, 0x0F, 0x80, 0x00,
-    0x00, 0x07, 0xD0, 0x1F, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0x02,
-    0xF0, 0x0F, 0x80, 0x3E, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7D, 0x00, 0x15, 0x56, 0xFD, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x7C, 0x0F, 0xFF, 0xAF, 0xFD, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x64, 0x00,
-    0x24, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x78, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xF4, 0x00, 0x00, 0x2F,
-    0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x40, 0x01, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x0F, 0xE5, 0x55, 0x54, 0x00, 0x00, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x02,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE5, 0x55, 0x54, 0x00, 0x0B,
-    0xF5, 0x55, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00,
-    0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xD4, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00,
-    0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x3F,
-    0x80, 0x02, 0xF8, 0x0F, 0xD0, 0x0B, 0xD0, 0x02, 0xF4, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x50, 0x01, 0x40, 0x02, 0xF4, 0x0B, 0xD0, 0x03, 0xF8, 0x0B, 0xE0, 0x02, 0xF4, 0x07,
-    0xD0, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x6A, 0x40, 0x00,
-    0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x06, 0xFF, 0xE4, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x1B, 0xF9, 0x07, 0xFF, 0xFF, 0x2F, 0xFF, 0xFC,
-    0x00, 0x02, 0xA8, 0x00, 0x2F, 0xD0, 0x01, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xBE, 0x00, 0x07, 0xD0,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x06, 0xFF,
-    0xE4, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x1B, 0xF9, 0x07, 0xFF, 0xFF,
-    0x2F, 0xFF, 0xFC, 0x00, 0x6A, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0x8F, 0xD0,
-    0x2F, 0x80, 0xFD, 0x2F, 0x40, 0x0B, 0xD5, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x1B, 0xFF, 0x90, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6F,
-    0xE4, 0x01, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x14, 0x00, 0x52, 0xF4, 0x0B, 0xDF, 0xE0, 0x3F,
-    0xAF, 0x40, 0xBD, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F,
-    0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0x6F,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x00, 0x00, 0x02, 0xFC, 0xAB, 0xFE, 0xAA, 0x80, 0x00, 0x7F, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xCF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0,
-    0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x90,
-    0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x60, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0x00, 0x00, 0x3F, 0xFF,
-    0xE7, 0xE0, 0x00, 0x03, 0xD1, 0xFF, 0xFC, 0x00, 0x00, 0x78, 0x01, 0xFF, 0x40, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF,
-    0x80, 0x00, 0x00, 0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E,
-    0x7F, 0x80, 0x00, 0x07, 0xF7, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7,
-    0xE0, 0x7F, 0x80, 0x00, 0x7F, 0x7E, 0x02, 0xFC, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F,
-    0x7F, 0x00, 0x7F, 0x40, 0x07, 0xF7, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07,
-    0xF7, 0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x7F, 0x00, 0x03, 0xFC, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0,
-    0x3F, 0x7F, 0x00, 0x00, 0xBF, 0x43, 0xF7, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F,
-    0xE3, 0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00,
-    0x1F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0xBF, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x9B, 0xC0, 0x00, 0x00, 0x3E,
-    0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC7, 0xF4, 0x00, 0x03, 0xF8, 0xBF, 0x40, 0x03, 0xFC, 0x0B, 0xF4,
-    0x03, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x0B, 0xF7, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x40,
-    0x03, 0xFC, 0x0B, 0xF4, 0x03, 0xFC, 0x00, 0xBF, 0x43, 0xFC, 0x00, 0x0B, 0xF4, 0xFC, 0x00, 0x00,
-    0xBE, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x3F, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0x40, 0x00, 0x03, 0xF7, 0xF8, 0x3F, 0xC0, 0x00, 0x03,
-    0xF4, 0xBF, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x1F, 0xD7, 0xF4, 0x00, 0x01, 0xFC, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0xFD, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x7F, 0x00,
-    0x0B, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x02, 0xFE, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0xBF, 0xBF, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0xEF, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xF7, 0xF0, 0x0F, 0xD0, 0x00, 0x03,
-    0xF8, 0xFD, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x3F, 0xC7, 0xF0, 0x00, 0x00, 0xBF, 0x07, 0xF7, 0xF4,
-    0x00, 0x00, 0x3F, 0x80, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xFC, 0x00, 0x00, 0x2F, 0xE0,
-    0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x3F, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0x40, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0,
-    0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8,
-    0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00,
-    0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00,
-    0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03,
-    0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x07,
-    0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0xBF,
-    0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA, 0xAF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x00,
-    0x7E, 0x00, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00,
-    0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00,
-    0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00, 0x00,
-    0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0,
-    0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0x00, 0x01, 0xFF, 0x87, 0xF0, 0x00, 0x03, 0xFC, 0x7F,
-    0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00,
-    0xFE, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x3F, 0xC7, 0xF0,
-    0x00, 0x1F, 0xF4, 0x7F, 0xAA, 0xBF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFE, 0x40,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xF9, 0x01, 0xBF, 0xC0, 0x7F,
-    0x40, 0x00, 0x7F, 0x42, 0xF8, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x01, 0xFF, 0x00,
-    0x3F, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x3F, 0xF0, 0x03, 0xF4, 0x00, 0x3F,
-    0xF4, 0x0F, 0xD0, 0x00, 0x2F, 0xF8, 0x3F, 0x40, 0x00, 0x0F, 0xF8, 0xFD, 0x00, 0x00, 0x0B, 0xF7,
-    0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00,
-    0x00, 0x01, 0xFF, 0xF4, 0x14, 0x00, 0x0F, 0xEF, 0xD0, 0x7E, 0x55, 0xFF, 0x3F, 0x41, 0xFF, 0xFF,
-    0xF4, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0xBE, 0x02, 0xF8,
-    0x00, 0x7E, 0x00, 0x2F, 0x80, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06, 0x00,
-    0x2F, 0xF8, 0x03, 0xC0, 0x2F, 0xFF, 0xE6, 0xF0, 0x0F, 0x86, 0xFF, 0xF4, 0x03, 0xC0, 0x1F, 0xF8,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F,
-    0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00,
-    0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF,
-    0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x1F, 0x80, 0x7E, 0x00,
-    0x0B, 0xF0, 0x2F, 0xC0, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF,
-    0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F,
-    0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01,
-    0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0xF4, 0x7D, 0x00,
-    0x00, 0xB8, 0x0B, 0x80, 0x00, 0x2D, 0x01, 0xE0, 0x00, 0x07, 0x80, 0xF4, 0x00, 0x00, 0xFE, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBE, 0x51, 0xBF, 0xC0, 0x08,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x6B, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xA5, 0x47,
-    0xF2, 0xFE, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x0B, 0xF3, 0xF4, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x07, 0xFF, 0x2F, 0xF5, 0x5F, 0xEF, 0xC3, 0xFF,
-    0xFF, 0xE2, 0xF0, 0x2F, 0xFF, 0xD0, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-    0xFC, 0x00, 0x3F, 0x91, 0x7F, 0xEF, 0xE4, 0x6F, 0xE0, 0x01, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0x01,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xE5,
-    0x43, 0xFE, 0xAA, 0xAA, 0xA9, 0x2F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0xBF, 0xC0,
-    0x00, 0x14, 0x2F, 0xF5, 0x6F, 0xE1, 0xFF, 0xA5, 0xBF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0x90,
-    0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0,
-    0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC,
-    0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA,
-    0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96,
-    0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00,
-    0x02, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xF2, 0xFC,
-    0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00,
-    0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF,
-    0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x02,
-    0xFC, 0x07, 0xF0, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x2A, 0x80, 0x07, 0xF8, 0x00, 0xBF, 0x00,
-    0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x0B, 0xD0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00,
-    0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0xAA, 0x00, 0x7F, 0x80,
-    0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2A, 0x80,
-    0x00, 0x0B, 0xFD, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x7F, 0x2F, 0xC0, 0x1F, 0xC0, 0xBF, 0x03, 0xE0,
-    0x01, 0xFC, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x04, 0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x01, 0xFC, 0x3F, 0x00, 0xFC, 0x04,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0xBC,
-    0x00, 0x03, 0xFF, 0x1F, 0xF4, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0xBF, 0x80, 0x00, 0x2F, 0xC0, 0x7F, 0x40, 0x00, 0x34, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xAA, 0x43, 0xF4,
-    0x00, 0xFF, 0xFF, 0xE7, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x40, 0x0B, 0xFF, 0x4F, 0xF0,
-    0x00, 0x07, 0xFD, 0x7F, 0x00, 0x00, 0x07, 0xFA, 0xFC, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x00, 0xBE, 0xFD, 0x00, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xDB,
-    0xE0, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0xBF, 0x40,
-    0x00, 0xBF, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x64, 0x00, 0x18, 0x00, 0x2F, 0xF8, 0x03, 0xD0, 0x07,
-    0xFF, 0xF9, 0xBC, 0x00, 0xF8, 0x2F, 0xFF, 0x40, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0xFC, 0x1F, 0xFF, 0xF4, 0x0F, 0xCB,
-    0xFF, 0xFF, 0xD0, 0xFE, 0xFD, 0x56, 0xFF, 0x0F, 0xFD, 0x00, 0x07, 0xF8, 0xFF, 0x80, 0x00, 0x2F,
-    0xCF, 0xF0, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFE, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40,
-    0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00,
-    0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00,
-    0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F,
-    0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE,
-    0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00,
-    0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F,
-    0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F,
-    0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x14,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0,
-    0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00,
-    0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F,
-    0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5,
-    0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00,
-    0x00, 0x00, 0x19, 0x00, 0x06, 0x00, 0x03, 0xFF, 0x80, 0x3C, 0x00, 0x2F, 0xFF, 0xE7, 0xF0, 0x00,
-    0xF4, 0x7F, 0xFF, 0x40, 0x07, 0x80, 0x1F, 0xF4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00,
-    0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE,
-    0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0,
-    0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00,
-    0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x10,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07,
-    0xF8, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00,
-    0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F,
-    0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC,
-    0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xA9, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x0B, 0x00, 0x07, 0xFF, 0xFE, 0x7E, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFE,
-    0x56, 0xFF, 0x40, 0x7F, 0x80, 0x02, 0xFF, 0x03, 0xFC, 0x00, 0x1F, 0xFE, 0x1F, 0xC0, 0x00, 0xFE,
-    0xFC, 0xBF, 0x00, 0x0B, 0xE3, 0xF3, 0xF8, 0x00, 0x7F, 0x0F, 0xDF, 0xE0, 0x03, 0xF0, 0x3F, 0xBF,
-    0x40, 0x3F, 0x40, 0xFE, 0xFD, 0x02, 0xF8, 0x03, 0xFB, 0xF8, 0x1F, 0xC0, 0x0F, 0xEB, 0xE0, 0xFC,
-    0x00, 0x3F, 0x6F, 0xCB, 0xE0, 0x00, 0xFD, 0x3F, 0xBF, 0x00, 0x0B, 0xF0, 0xFF, 0xF0, 0x00, 0x3F,
-    0x80, 0xFF, 0x40, 0x03, 0xFC, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xFD,
-    0xBF, 0xFF, 0x80, 0x01, 0xD0, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00,
-    0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF,
-    0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF,
-    0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFC, 0xFE, 0x00, 0x00, 0x7E, 0x02,
-    0xF8, 0x00, 0x1F, 0x80, 0x0B, 0xE0, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF,
-    0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0xBF, 0x02, 0xFC, 0x00,
-    0x07, 0xE0, 0x1F, 0x80, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07,
-    0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0,
-    0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07,
-    0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F,
-    0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF,
-    0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFE, 0x00,
-    0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xFF, 0xD5, 0x7F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00,
-    0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x00, 0xFD, 0xFF,
-    0x80, 0x00, 0x2F, 0xCF, 0xFD, 0x00, 0x0B, 0xF8, 0xFF, 0xFE, 0x5B, 0xFF, 0x0F, 0xDB, 0xFF, 0xFF,
-    0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x50, 0x00, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x00, 0xBF, 0x02, 0xFC, 0x00, 0x00, 0x7E, 0x01,
-    0xF8, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x55, 0x55, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0,
-    0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00,
-    0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x55, 0x55,
-    0x54, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF8, 0x02,
-    0xF9, 0x46, 0xFF, 0x00, 0x20, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0x0B, 0xFE, 0x95, 0x1F, 0xCB, 0xF8, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x01, 0xFC, 0xFD, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x1F, 0xFC, 0xBF,
-    0xD5, 0x7F, 0xBF, 0x0F, 0xFF, 0xFF, 0x8B, 0xC0, 0xBF, 0xFF, 0x42, 0xF0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE5, 0x6F,
-    0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA,
-    0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x0B, 0xE5, 0x6F, 0x80, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F,
-    0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF,
-    0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB,
-    0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03,
-    0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0x94, 0x6F, 0xF0, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x01,
-    0xAF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xBF, 0xE9, 0x51, 0xFC, 0x2F, 0xE0, 0x00, 0x1F,
-    0xC3, 0xF8, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x02, 0xFC, 0x3F, 0x40,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x1F, 0xFC, 0x2F, 0xF5, 0x5F, 0xEF, 0xC0, 0xFF, 0xFF, 0xF8, 0xBC,
-    0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xD0, 0x00,
-    0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-    0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0xFD,
-    0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F,
-    0xFF, 0xAA, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x05, 0x54, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xFF, 0xF0, 0x00,
-    0x2F, 0xCB, 0xE0, 0x01, 0xFC, 0x0B, 0xE0, 0x1F, 0x80, 0x07, 0xE0, 0x10, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95,
-    0xBC, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF,
-    0xE0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0x40, 0x01, 0xB8, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x14, 0x00, 0xBF, 0xFE,
-    0xAB, 0xFD, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x15,
-    0x50, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40,
-    0x00, 0x7F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFF, 0xD0, 0xBF, 0xE5, 0x6F, 0x07, 0xF8, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x10,
-    0x2F, 0xFA, 0x6B, 0xD0, 0x2F, 0xFF, 0xFF, 0x40, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x0A, 0x40, 0x00, 0xA4, 0x00, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00,
-    0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF,
-    0xD0, 0x00, 0x6E, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x05, 0x00, 0x2F, 0xFF, 0xAA,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0xA8, 0x0F, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0xFD, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0x42, 0xFF, 0x95, 0xBC, 0x1F,
-    0xE0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x40, 0xBF, 0xE9, 0xAF, 0x40, 0xBF, 0xFF, 0xFD, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0xA8, 0x00, 0x0A, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0x00, 0x05, 0xBF, 0xF4, 0x01, 0xFC, 0x00,
-    0x00, 0x2F, 0xF4, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x47, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF4, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x1F, 0xC0, 0x00, 0x02, 0xFF, 0x40, 0x7F, 0x00, 0x01, 0xBF, 0xF4,
-    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x69, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xF4,
-    0x00, 0x00, 0x00, 0x07, 0xF2, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x05, 0x50, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x47, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xE7, 0xF0, 0x00, 0x0F, 0xFD, 0x56, 0xFF, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFE,
-    0x5B, 0xFB, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xD3, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xD0, 0x01, 0x6F, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x7F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFC, 0xAB, 0xFE, 0xAA, 0x80, 0x00, 0x7F, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0x1F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x00, 0x0F, 0xF0, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x6F, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x15, 0x55, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00, 0x1F,
-    0xFF, 0xD1, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x3F, 0xF9, 0x6F, 0xEF, 0xC0, 0x2F, 0xE0,
-    0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00,
-    0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00,
-    0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00,
-    0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE5, 0xBF, 0xBF, 0x00, 0x0F, 0xFF, 0xFF,
-    0x4F, 0xC0, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55,
-    0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x01, 0x55, 0x55, 0x50, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x15,
-    0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80,
-    0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x07, 0x80, 0x00, 0xB0, 0x03,
-    0xC0, 0x01, 0xF0, 0x03, 0xF9, 0x5B, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x74, 0x00, 0x3D, 0x00, 0x0F, 0x40,
-    0x02, 0xF9, 0x5B, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F,
-    0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03,
-    0xF8, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00,
-    0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x5F, 0x80, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x80, 0x00, 0xA8, 0x07, 0xF0, 0x07, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x06, 0x80, 0x00, 0xA8, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x03, 0xFB,
-    0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD7, 0xF4, 0x00, 0x00, 0x00,
-    0xFD, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00,
-    0x07, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0xBF, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40,
-    0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02,
-    0xFF, 0x80, 0x00, 0x03, 0xF8, 0x02, 0xFF, 0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x03, 0xF5, 0xFD, 0x00, 0x00, 0xFD,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0, 0xFF, 0xD5,
-    0x7F, 0xBF, 0x1F, 0xE0, 0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB,
-    0xF0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07,
-    0xFF, 0x0F, 0xFD, 0x57, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47, 0xF0, 0x00,
-    0x15, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x02, 0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x38, 0x00, 0x00, 0x07, 0xC0,
-    0x02, 0xF0, 0x00, 0x00, 0x0F, 0xE5, 0xBF, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF9, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF,
-    0xFE, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD0,
-    0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x00,
-    0xBF, 0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x02, 0xD0, 0x00, 0x38, 0x00, 0x2E, 0x00, 0x0B, 0x80, 0x00,
-    0xFE, 0x5B, 0xF4, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x3F,
-    0xFF, 0xFE, 0x3F, 0x0F, 0xFD, 0x57, 0xFB, 0xF1, 0xFE, 0x00, 0x07, 0xFF, 0x3F, 0x80, 0x00, 0x2F,
-    0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00,
-    0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0xE7, 0xF0,
-    0x07, 0xFF, 0xF4, 0x7F, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC1, 0xE4, 0x00, 0x0B, 0xF8, 0x1F,
-    0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xF9, 0x00,
-    0x01, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xEB, 0xF0, 0x00, 0x02, 0xFF,
-    0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xD0,
-    0x00, 0x00, 0x03, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x80,
-    0xBF, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0xFE, 0xAA, 0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1B, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x3F, 0xFF, 0xFE, 0x3F, 0x0F, 0xFD, 0x57, 0xFB, 0xF1, 0xFE, 0x00,
-    0x07, 0xFF, 0x3F, 0x80, 0x00, 0x2F, 0xF7, 0xF0, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0xBF, 0x7F,
-    0x00, 0x00, 0x0F, 0xF3, 0xF8, 0x00, 0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0x7F,
-    0xFF, 0x03, 0xFF, 0xFF, 0xE7, 0xF0, 0x07, 0xFF, 0xF4, 0x7F, 0x00, 0x01, 0x50, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xE4, 0x00, 0x0B, 0xF8, 0x1F, 0xFF, 0xBF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xE4, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE4, 0x00, 0x07, 0xC0,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xAF, 0xC0, 0x00, 0x0B, 0xFF, 0xFE, 0xBF,
-    0x00, 0x00, 0x2F, 0xFF, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x40, 0x00, 0x00,
-    0x0F, 0xE0, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x81, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x02, 0xFF, 0x80,
-    0x00, 0x03, 0xF8, 0x02, 0xFF, 0xFA, 0xAA, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x6F, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x03, 0xFF, 0xFF, 0xE3, 0xF0, 0xFF, 0xD5, 0x7F, 0xBF, 0x1F, 0xE0,
-    0x00, 0x7F, 0xF3, 0xF8, 0x00, 0x02, 0xFF, 0x7F, 0x00, 0x00, 0x0F, 0xFB, 0xF0, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x0B, 0xF7,
-    0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x57,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x7F, 0xFF, 0x47, 0xF0, 0x00, 0x15, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFC, 0x1E, 0x40, 0x00, 0xBF, 0x81, 0xFF, 0xFB, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x6F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x03,
-    0xF0, 0x01, 0xFC, 0x00, 0x00, 0x14, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x55, 0x55, 0x55, 0x6F, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFA, 0xAA, 0xAA, 0xAA, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x15, 0x40, 0x00, 0x00, 0xFD, 0x1F, 0xFF, 0xF4,
-    0x00, 0x03, 0xF6, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xEF, 0xE5, 0x6F, 0xF0, 0x00, 0x3F, 0xF4, 0x00,
-    0x1F, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x56, 0xFD, 0x55, 0x55, 0x55, 0x7F,
-    0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x56,
-    0xFD, 0x55, 0x55, 0x55, 0xBF, 0x55, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFD, 0x55, 0x55, 0x55,
-    0xBF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFE, 0xAA, 0xAA, 0xAA, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x01, 0x7F, 0x95, 0x55, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xAA, 0x40, 0x00,
-    0x3F, 0x4B, 0xFF, 0xFE, 0x00, 0x0F, 0xDF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xE4, 0x07, 0xFD, 0x00,
-    0xFF, 0xC0, 0x00, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x03, 0xF0, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x3F,
-    0x40, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0xFD,
-    0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0x90, 0x00, 0x60, 0x3F, 0xF8, 0x03, 0xC2, 0xFF, 0xFE, 0x7F, 0x0F,
-    0x47, 0xFF, 0xF4, 0x78, 0x01, 0xFF, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x6F, 0xE4, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x54, 0x00, 0x24, 0x1F, 0xFD, 0x02, 0xE0,
-    0xFF, 0xFE, 0x6F, 0x0B, 0x82, 0xFF, 0xF8, 0x3C, 0x00, 0xBF, 0x80, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x06, 0xFF, 0xE4, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xBF, 0x90, 0x1F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFC, 0x55, 0x55, 0x54, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x54,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFD, 0x00, 0x74, 0x00, 0x0B, 0x1F, 0x00, 0x07, 0xC3, 0xF9, 0x5B, 0xE0, 0x7F, 0xFF, 0xF0, 0x07,
-    0xFF, 0xE0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x00, 0x6F, 0xFE, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xBF, 0x90, 0x07, 0xFF, 0xFF,
-    0x02, 0xFF, 0xFF, 0xC0, 0x2C, 0x00, 0x07, 0x4F, 0x40, 0x03, 0xD1, 0xF9, 0x5B, 0xF0, 0x3F, 0xFF,
-    0xF4, 0x02, 0xFF, 0xF0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x7F,
-    0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0x01,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0xC0, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x3F, 0x80, 0xFF, 0x03, 0xF8, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0,
-    0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40,
-    0xFD, 0x03, 0xF4, 0x0B, 0x80, 0xBC, 0x07, 0xC0, 0x3F, 0x00, 0xF8, 0x03, 0xF0, 0x0B, 0xFF, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x64, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF,
-    0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x7F, 0xFF, 0xF0, 0x02, 0xF6, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xE1, 0xBF, 0xF9, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03,
-    0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01,
-    0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00,
-    0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x1F,
-    0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x06, 0xFE, 0x40, 0x03, 0xF9,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xEB, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x01, 0x90, 0xFE, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x7F, 0x4F, 0xE0, 0x00, 0xFC, 0x09,
-    0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x03, 0xF0, 0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03,
-    0xF0, 0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0,
-    0xFD, 0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0, 0xFD,
-    0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0, 0xFD, 0x00,
-    0x0F, 0xC3, 0xF4, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0xC0,
-    0x01, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0x5F, 0xD0, 0x03, 0xF4, 0x1F, 0xC0, 0x3F, 0x00,
-    0x0F, 0xC0, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x7F, 0x2F, 0xC0, 0x07,
-    0xF0, 0x2F, 0xC0, 0x3E, 0x00, 0x1F, 0xC0, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC,
-    0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF0,
-    0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xC0,
-    0x7F, 0x40, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01, 0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x3F,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x47,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00,
-    0xFF, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x02, 0xFD, 0x00, 0x1F, 0xC0, 0x00,
-    0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00,
-    0x0B, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x8F, 0xD0, 0x00, 0x7F, 0x83, 0xF4, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x3F, 0xC0, 0x03, 0xF4, 0x3F, 0xC0, 0x00,
-    0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x0F, 0xEF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0x8B, 0xF4, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x0F, 0xD0, 0x0F, 0xF0, 0x03, 0xF4, 0x01,
-    0xFE, 0x00, 0xFD, 0x00, 0x2F, 0xD0, 0x3F, 0x40, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0x3F, 0xC3, 0xF4,
-    0x00, 0x07, 0xF8, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x8F, 0xE0, 0x00, 0x7F, 0x83, 0xF8, 0x00, 0x3F, 0xC0, 0xFE,
-    0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x2F, 0xD0, 0x03, 0xF8, 0x1F, 0xD0, 0x00,
-    0xFE, 0x1F, 0xE0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xD7, 0xF4, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8, 0x01,
-    0xFE, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0xC3, 0xF8,
-    0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xAA, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xAA, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1A, 0x03, 0xF4, 0x3F,
-    0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43,
-    0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4,
-    0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xA8, 0x0F, 0xC1, 0xF8, 0x2F,
-    0x03, 0xD0, 0x7C, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00,
-    0xFC, 0x7F, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x01, 0xF0, 0x7F, 0x00, 0x02, 0xD0, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x68, 0x06, 0x9F, 0xD0, 0xFD, 0xFD, 0x0F, 0xCF, 0xD0, 0xF8, 0xFD, 0x1F, 0x0F, 0xD2, 0xE0,
-    0xFD, 0x14, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x06, 0x40, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0x00,
-    0x2F, 0xC0, 0x7F, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x06, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x68, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x0A, 0x3F, 0x4F, 0xEF, 0xD3, 0xFB, 0xF4, 0xFE, 0xFD, 0x09, 0x3F, 0x40, 0x0F, 0xD0,
-    0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x78, 0x00, 0x00, 0x7F, 0x0F, 0xF0,
-    0x00, 0x01, 0xFE, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x5F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xA8, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x10, 0x00, 0xFD, 0xF4,
-    0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x0F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x2E,
-    0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0xD0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0x7F, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x7E, 0xFF, 0x00,
-    0x00, 0x07, 0xF7, 0xE7, 0xF8, 0x00, 0x00, 0x7F, 0x7E, 0x2F, 0xC0, 0x00, 0x07, 0xF7, 0xE0, 0xFF,
-    0x00, 0x00, 0x7F, 0x7E, 0x07, 0xF8, 0x00, 0x07, 0xF7, 0xE0, 0x2F, 0xC0, 0x00, 0x7F, 0x7E, 0x00,
-    0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x07, 0xF4, 0x00, 0x7F, 0x7F, 0x00, 0x3F, 0xC0, 0x07, 0xF7, 0xF0,
-    0x00, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xF4, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x7F,
-    0x00, 0x00, 0xFE, 0x03, 0xF7, 0xF0, 0x00, 0x0B, 0xF4, 0x3F, 0x7F, 0x00, 0x00, 0x3F, 0xC3, 0xF7,
-    0xF0, 0x00, 0x01, 0xFE, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xFF,
-    0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1,
-    0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F,
-    0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00,
-    0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xE7, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x7F,
-    0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F, 0x80, 0x00, 0x07, 0xF7,
-    0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x7F, 0x80, 0x00, 0x7F,
-    0x7E, 0x02, 0xFC, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x40, 0x07,
-    0xF7, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07, 0xF7, 0xF0, 0x00, 0x7F, 0x40,
-    0x7F, 0x7F, 0x00, 0x03, 0xFC, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x3F, 0x7F, 0x00, 0x00, 0xBF,
-    0x43, 0xF7, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0xE3, 0xF7, 0xF0, 0x00, 0x00,
-    0xBF, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x7F, 0x00, 0x00,
-    0x00, 0xBF, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5, 0x6F,
-    0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0,
-    0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00,
-    0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC,
-    0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x29, 0x00, 0x02, 0x90, 0x00, 0x01, 0xF8, 0x01, 0xFC,
-    0x00, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0xD0, 0x00,
-    0x00, 0x07, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0xD0,
-    0x00, 0x00, 0x7F, 0x7E, 0xFF, 0x00, 0x00, 0x07, 0xF7, 0xE7, 0xF8, 0x00, 0x00, 0x7F, 0x7E, 0x2F,
-    0xC0, 0x00, 0x07, 0xF7, 0xE0, 0xFF, 0x00, 0x00, 0x7F, 0x7E, 0x07, 0xF8, 0x00, 0x07, 0xF7, 0xE0,
-    0x2F, 0xC0, 0x00, 0x7F, 0x7E, 0x00, 0xFF, 0x00, 0x07, 0xF7, 0xF0, 0x07, 0xF4, 0x00, 0x7F, 0x7F,
-    0x00, 0x3F, 0xC0, 0x07, 0xF7, 0xF0, 0x00, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x07, 0xF4, 0x07, 0xF7,
-    0xF0, 0x00, 0x3F, 0xC0, 0x7F, 0x7F, 0x00, 0x00, 0xFE, 0x03, 0xF7, 0xF0, 0x00, 0x0B, 0xF4, 0x3F,
-    0x7F, 0x00, 0x00, 0x3F, 0xC3, 0xF7, 0xF0, 0x00, 0x01, 0xFE, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF7,
-    0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B,
-    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x0A, 0x80, 0x00, 0xA8,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x1F, 0xD0, 0x00, 0x07, 0xFB, 0xF4, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF, 0xFD, 0x0F, 0xEF, 0xD5,
-    0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF,
-    0xF0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD,
-    0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00,
-    0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x55, 0x00, 0x1F, 0x43, 0xE0, 0xBF, 0xFF, 0x80, 0xBC, 0x0F, 0xCF,
-    0xFF, 0xFF, 0xC1, 0x40, 0x3F, 0xFE, 0x55, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xBF, 0x40, 0x03,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00,
-    0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC,
-    0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x7F, 0x80, 0x00, 0x00, 0x03,
-    0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x3F, 0x80, 0x00,
-    0x07, 0xF7, 0xE2, 0xFD, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0, 0x3F, 0x80,
-    0x00, 0x7F, 0x7E, 0x02, 0xFD, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F, 0x00, 0x3F,
-    0x80, 0x07, 0xF7, 0xF0, 0x01, 0xFD, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xF0, 0x07, 0xF7, 0xF0, 0x00,
-    0x3F, 0x80, 0x7F, 0x7F, 0x00, 0x01, 0xFD, 0x07, 0xF7, 0xF0, 0x00, 0x0B, 0xF0, 0x3F, 0x7F, 0x00,
-    0x00, 0x3F, 0x83, 0xF7, 0xF0, 0x00, 0x01, 0xFD, 0x3F, 0x7F, 0x00, 0x00, 0x0B, 0xF3, 0xF7, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0x7F, 0x00, 0x00, 0x01, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0xF7, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x0F, 0xC1, 0xFF, 0xFF, 0x40, 0xFC, 0x7F, 0xFF, 0xFE, 0x0F, 0xEF, 0xE5, 0x6F, 0xF4, 0xFF, 0xD0,
-    0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0xFC,
-    0xFE, 0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00,
-    0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00,
-    0x0F, 0xCF, 0xD0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0x01, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F,
-    0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0B,
-    0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFE,
-    0x56, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0xBF, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0x3F, 0xBF,
-    0x40, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00,
-    0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F,
-    0x80, 0xFE, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0x95, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x95, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFE,
-    0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00,
-    0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x2C, 0x00, 0x07,
-    0xC0, 0x01, 0xF0, 0x00, 0x0F, 0xE5, 0x6F, 0x80, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xE5, 0x6F, 0xF4, 0x07, 0xF8,
-    0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x00,
-    0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF,
-    0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00,
-    0x00, 0x0F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x1F, 0xF9, 0x5B, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x81, 0xA8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x2F, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
-    0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02,
-    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00,
-    0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0xAA,
-    0x00, 0x00, 0xFF, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x02,
-    0xF4, 0x0F, 0xC0, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0,
-    0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00,
-    0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA,
-    0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0,
-    0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0x90, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x55, 0x55, 0x52,
-    0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xCB, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x2F,
-    0xC0, 0x00, 0x00, 0x2F, 0xD5, 0x55, 0x54, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA,
-    0xAF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0x80, 0x0B, 0xFD, 0x57, 0xFE, 0x2F, 0xE5, 0x6F, 0xE0, 0x1F, 0xD0, 0x00, 0x7F,
-    0xBF, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0x00, 0x00, 0x07, 0xFA, 0xAA, 0xAA, 0xA9, 0xFE, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x14, 0x0B, 0xFE, 0x57, 0xFE,
-    0x2F, 0xF9, 0x5B, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xD0,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0,
-    0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F,
-    0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x01, 0xA9, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFC, 0x0B, 0xFF, 0xFC, 0x3F,
-    0xFE, 0xFC, 0xFF, 0xA9, 0xFF, 0xF4, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00, 0x00, 0x3F, 0xC0,
-    0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x7F, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x4F, 0xC0,
-    0xBF, 0xF3, 0xF0, 0xFF, 0xF8, 0xFC, 0xFF, 0xA9, 0x3F, 0xFD, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00,
-    0xA8, 0x00, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE9, 0x40, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x06, 0xFF, 0x80, 0x7F, 0x00,
-    0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x0B, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F,
-    0xD0, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x01, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x00, 0x7F,
-    0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x40, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x01,
-    0xFD, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02, 0xF8, 0x0B, 0xE0, 0xBE, 0x00, 0x3F, 0xBF, 0x80, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x43, 0xF0, 0x2F, 0xFC, 0x3F, 0x0F, 0xFF, 0x83, 0xF3, 0xFE, 0xA4, 0x3F, 0xFD, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00,
-    0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x90, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40,
-    0x00, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8,
-    0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF,
-    0xFE, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xC0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x1F, 0x80, 0x07,
-    0xE0, 0x00, 0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B,
-    0x41, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x03, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xA0,
-    0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00,
-    0x10, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0xFC, 0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B, 0x41, 0xFD, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00,
-    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01,
-    0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xBF,
-    0xFF, 0xFD, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x01, 0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10,
-    0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC,
-    0x20, 0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00,
-    0x00, 0x17, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x06, 0xFC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBF, 0xFC, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x01, 0xA0, 0x00, 0x2A, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x3F, 0x43,
-    0xF4, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
-    0x90, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 0x1B, 0x41, 0xFD,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x01, 0xFD, 0x38, 0x00, 0x00, 0x7F, 0xC3, 0xFF, 0xAA, 0xBF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x01, 0xBF, 0xFF, 0xFD, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x0A, 0x40, 0x01, 0xA0, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x02, 0xF8, 0x2F, 0x80, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x01,
-    0xFF, 0xFF, 0xE4, 0x0B, 0xFF, 0xFF, 0xF8, 0x2F, 0xE5, 0x16, 0xF0, 0x3F, 0x40, 0x00, 0x10, 0x3F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x20,
-    0x00, 0x02, 0xFC, 0x3F, 0x95, 0x5F, 0xF4, 0x3F, 0xFF, 0xFF, 0xE0, 0x1B, 0xFF, 0xFE, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0x80, 0x00, 0xF5, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x06, 0xFD, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0xBF, 0xFC, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0xA8, 0x00, 0x0A, 0x80, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x28,
-    0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x14, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xD5,
-    0x54, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0xFF, 0x95, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x28, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC2, 0xBF,
-    0xEA, 0xA0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x90, 0x00, 0x0B, 0xFF, 0x00, 0xB4,
-    0x00, 0x07, 0xFF, 0xF9, 0xBC, 0x00, 0x03, 0xE0, 0xBF, 0xFE, 0x00, 0x00, 0xF0, 0x02, 0xFE, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0,
-    0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF,
-    0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06, 0x00, 0x0B, 0xFE, 0x00, 0xF4, 0x01, 0xFF, 0xFE, 0x6F,
-    0x00, 0x3E, 0x0B, 0xFF, 0xD0, 0x03, 0xC0, 0x0B, 0xF8, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F,
-    0xD0, 0x00, 0x7F, 0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4,
-    0x3F, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0,
-    0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x03, 0xFE,
-    0x00, 0x01, 0xFF, 0x40, 0x3F, 0xFE, 0xAB, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x54, 0x00, 0x0F, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0x02, 0xF9,
-    0x5B, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFD, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F,
-    0xD2, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xBE, 0x56, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x01, 0xFF, 0x2F, 0xD0, 0x00, 0x7F,
-    0xF0, 0xFF, 0xD5, 0xBF, 0xBF, 0x07, 0xFF, 0xFF, 0xE3, 0xF0, 0x0B, 0xFF, 0xF4, 0x3F, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x3E,
-    0x1F, 0x40, 0x00, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x01, 0xF0,
-    0x2E, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00,
-    0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00,
-    0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x00, 0x02, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x7F,
-    0x4B, 0xF4, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x80, 0x00, 0x7F, 0xD0, 0x0F, 0xFF, 0xAA, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x0F, 0x47, 0xD0, 0x00, 0x01, 0xE0,
-    0x2E, 0x00, 0x00, 0x2D, 0x01, 0xE0, 0x00, 0x01, 0xF0, 0x2E, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD,
-    0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x02, 0xA8, 0x0A, 0x90, 0x00, 0x01, 0xFD, 0x0F, 0xF0, 0x00, 0x00, 0xFD, 0x07, 0xF0, 0x00,
-    0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0x00,
-    0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00,
-    0x00, 0x07, 0xF4, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0xFF, 0xFA,
-    0xAF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15,
-    0x40, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x6A, 0x00, 0x02, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0x41, 0xFC,
-    0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x01, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x01, 0xF0, 0x00, 0x01, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F,
-    0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE,
-    0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x55, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFD,
-    0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x07, 0xF0, 0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0xBF, 0x0F, 0xD0,
-    0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x1F, 0xF0, 0xBF, 0x40, 0x01, 0xFF, 0xC0, 0xFF, 0xD5, 0xBF,
-    0xBF, 0x01, 0xFF, 0xFF, 0xF8, 0xFC, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x05, 0x40, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC3, 0xF4, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x02, 0xFC, 0x2F,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0xFD, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x07, 0xF3, 0xF0, 0x00,
-    0x0B, 0xE0, 0x0B, 0xF0, 0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0xFD, 0x2F,
-    0x80, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x03, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F,
-    0x80, 0xFC, 0x00, 0x2F, 0x80, 0x02, 0xFC, 0x00, 0xBD, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0,
-    0x03, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xC0, 0x2F, 0xC0, 0x00,
-    0x3F, 0x80, 0xBE, 0x00, 0x3F, 0x40, 0xFE, 0x00, 0x00, 0xBF, 0x03, 0xF4, 0x00, 0xBE, 0x03, 0xF4,
-    0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x03, 0xF4, 0x7E, 0x00, 0x03, 0xF0,
-    0xBF, 0x00, 0x00, 0x0B, 0xE2, 0xF4, 0x00, 0x0B, 0xE3, 0xF8, 0x00, 0x00, 0x1F, 0xCF, 0xC0, 0x00,
-    0x1F, 0xCF, 0xD0, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0xFE, 0xF8,
-    0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0xBF,
-    0xC0, 0x00, 0x2F, 0x83, 0xF8, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFF, 0xE0,
-    0x00, 0x7F, 0x01, 0xFC, 0x00, 0x1F, 0x7F, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x03, 0xF2, 0xF4, 0x00,
-    0xFD, 0x00, 0xFE, 0x00, 0x3F, 0x1F, 0x80, 0x0F, 0xC0, 0x0B, 0xF0, 0x07, 0xE0, 0xFC, 0x01, 0xFC,
-    0x00, 0x3F, 0x00, 0xBD, 0x0F, 0xC0, 0x2F, 0x80, 0x03, 0xF4, 0x0F, 0xC0, 0xBE, 0x03, 0xF4, 0x00,
-    0x2F, 0x81, 0xF8, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x2F, 0x40, 0x3F, 0x07, 0xF0, 0x00, 0x0F,
-    0xC3, 0xF0, 0x02, 0xF4, 0xBE, 0x00, 0x00, 0xFD, 0x3E, 0x00, 0x1F, 0x8F, 0xD0, 0x00, 0x0B, 0xE7,
-    0xD0, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xBC, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF4, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xCF, 0xE0, 0x00, 0x00, 0xBE, 0x02, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0xBE, 0x00, 0x00,
-    0x40, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00,
-    0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00,
-    0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07,
-    0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x04, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00,
-    0x01, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F,
-    0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F,
-    0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2A, 0x80, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55,
-    0x57, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x01, 0xA0, 0x00, 0x1A, 0x00, 0x02, 0xF4, 0x02, 0xF4, 0x00,
-    0x03, 0xF8, 0x3F, 0x80, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1A, 0x00, 0x01, 0xA0, 0x0F, 0xD0, 0x0F, 0xD0, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x57,
-    0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x7F, 0xAA, 0xAA, 0xA8, 0xBF, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x6A, 0x90, 0x1F, 0xFF, 0xD1, 0xFF, 0xFF, 0x0F, 0xF4, 0x14,
-    0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4,
-    0x03, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFA, 0xFD,
-    0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0B, 0xFF, 0xAA, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x55, 0x40, 0x03, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xC0, 0x0B, 0xFF, 0xFF, 0xF4,
-    0xFE, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0x80, 0x00,
-    0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F,
-    0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF9, 0x5B, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFF, 0xF8, 0x02, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0x00, 0x1F, 0xF0, 0x1F, 0xF0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC7, 0xF4, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0xFE, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x3F, 0xC0,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0,
-    0xFF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC2, 0xFE, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x7F, 0x03, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x00, 0x01, 0xFC, 0x03, 0xFF, 0xEA, 0xBF, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54,
-    0x00, 0x01, 0x54, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xBF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x8F, 0xFF,
-    0xFD, 0x03, 0xFF, 0x56, 0xFF, 0xFD, 0x5B, 0xFC, 0x1F, 0xD0, 0x00, 0xBF, 0xC0, 0x07, 0xF4, 0xFE,
-    0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x03,
-    0xF4, 0x00, 0xBE, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x02, 0xFB, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x0B,
-    0xEF, 0xD0, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xBF, 0x40, 0x00, 0x02, 0xF8, 0x00, 0xBE, 0xFE, 0x00,
-    0x00, 0x0F, 0xE0, 0x02, 0xFA, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x0B, 0xEB, 0xF0, 0x00, 0x00, 0xFD,
-    0x00, 0x2F, 0x8F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0xBE, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x02, 0xF8,
-    0x7F, 0x80, 0x03, 0xFC, 0x00, 0x0B, 0xE0, 0xBF, 0xE5, 0xBF, 0xD0, 0x00, 0x2F, 0x80, 0xBF, 0xFF,
-    0xFD, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x02, 0xBF, 0xFF, 0xFE, 0x90, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x47, 0xF0, 0x01, 0x7F, 0xF4,
-    0xBD, 0x07, 0xF0, 0x00, 0x07, 0xFC, 0xBD, 0x07, 0xF0, 0x00, 0x01, 0xFD, 0x7E, 0x07, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xF5, 0x56, 0xBF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFA, 0xA9, 0x40, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x40, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x55, 0x00, 0x0F, 0xD1, 0xFF, 0xFE, 0x00, 0xFD, 0xBF, 0xFF, 0xFC, 0x0F, 0xEF, 0xD5, 0x7F, 0xF0,
-    0xFF, 0xD0, 0x00, 0x7F, 0x8F, 0xF8, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xF0, 0x00,
-    0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x0F, 0xEF, 0xF0, 0x00, 0x01, 0xFD, 0xFF, 0x80, 0x00, 0x3F, 0xCF, 0xFE, 0x00, 0x0B, 0xF8, 0xFF,
-    0xFE, 0x5B, 0xFF, 0x0F, 0xDB, 0xFF, 0xFF, 0xC0, 0xFD, 0x1F, 0xFF, 0xE0, 0x0F, 0xD0, 0x05, 0x40,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x80, 0x00, 0x7F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x7F, 0x00, 0x00,
-    0x2F, 0xD0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B,
-    0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x1F, 0xD0,
-    0x7F, 0x00, 0x00, 0x7F, 0xC0, 0x7F, 0x00, 0x06, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xAA, 0xBF, 0xC0, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00,
-    0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x01, 0xFD, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xD0, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x02,
-    0xE0, 0xBF, 0xFA, 0xAB, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xE4, 0x00, 0x00,
-    0x55, 0x40, 0x00, 0x00, 0x15, 0x50, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xE0, 0x0B,
-    0xE4, 0x5B, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFE, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x18, 0x2F, 0xF5, 0x56, 0xFC, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xE4, 0x00, 0x01, 0x54, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xA9, 0x00, 0x00,
-    0x03, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x7E, 0x03, 0xF0,
-    0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x01, 0xAB,
-    0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x07, 0xFF, 0xBC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x28,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x80,
-    0x00, 0x1B, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x02, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF4, 0x02,
-    0xFC, 0x00, 0x00, 0xBD, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x7E, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xFF, 0xF0, 0x03, 0xF8, 0x14, 0x01,
-    0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x0B,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xF8, 0x5F, 0xF5, 0x55, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xF9, 0x54, 0x01, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-    0x80, 0x00, 0x15, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7E,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0xFE, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0xBF, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0xFD,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x2F, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x56, 0xFE, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-    0x3F, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x40, 0x0F, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x50,
-    0x00, 0xAA, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x2F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x01, 0x40, 0x00,
-    0x00, 0x2A, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0x5F, 0xC0, 0x0F, 0xD0,
-    0x7F, 0x03, 0xF0, 0x00, 0xFC, 0x14, 0x00, 0x01, 0x40, 0x01, 0x90, 0x00, 0x60, 0x3F, 0xF8, 0x03,
-    0xC2, 0xFF, 0xFE, 0x6F, 0x0F, 0x47, 0xFF, 0xF4, 0x7C, 0x01, 0xFF, 0x40, 0x40, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xA9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0E, 0xB8,
-    0x00, 0x2E, 0x3F, 0x56, 0xFC, 0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x28, 0xBF,
-    0xFF, 0xBE, 0x14, 0x04, 0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x04,
-    0x00, 0x10, 0xBE, 0x43, 0xFF, 0xC5, 0x6F, 0x80, 0x3F, 0x00, 0xF8, 0x6F, 0xC2, 0xF8, 0x0B, 0x80,
-    0x1E, 0x00, 0x01, 0xA4, 0x00, 0xFF, 0xF0, 0x2F, 0x5B, 0xC3, 0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xD0,
-    0x3C, 0x1F, 0xAF, 0x80, 0xBF, 0xE0, 0x00, 0x10, 0x00, 0x01, 0xA8, 0x0A, 0xA0, 0x3F, 0x81, 0xFC,
-    0x0B, 0xF0, 0x3F, 0x40, 0xFC, 0x0B, 0xE0, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x00, 0x10, 0x01,
-    0x40, 0x00, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02, 0xF8, 0x0B, 0xE0, 0xBE, 0x00, 0x3F, 0xBF, 0x80,
-    0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x69, 0xBE, 0xBE, 0xBE, 0xBE,
-    0xBE, 0x69, 0x69, 0x06, 0x9B, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0,
-    0xBE, 0x69, 0x06, 0x90, 0x6A, 0x42, 0xA8, 0x00, 0xFF, 0x07, 0xF4, 0x00, 0xFD, 0x07, 0xF0, 0x01,
-    0xFC, 0x0B, 0xE0, 0x01, 0xF8, 0x0B, 0xC0, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x40, 0x05, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBE, 0x00, 0xB0, 0x14, 0x0E, 0xB8, 0x00,
-    0x2E, 0x7E, 0x96, 0xFC, 0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x01, 0xAA, 0x40,
-    0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x7D, 0x00, 0x7D, 0xB4, 0x00, 0x1E, 0x10, 0x00, 0x04, 0x02,
-    0xD0, 0x7D, 0x0B, 0xC0, 0xFC, 0x2F, 0x83, 0xF8, 0x3F, 0x4B, 0xF0, 0xFF, 0x05, 0x50, 0x0F, 0xE0,
-    0xFE, 0x1F, 0xD2, 0xFC, 0x2F, 0x83, 0xF0, 0x3F, 0x07, 0xD0, 0xBC, 0x05, 0x40, 0xBE, 0x0B, 0xF0,
-    0x7F, 0x03, 0xF4, 0x2F, 0x81, 0xFC, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x15, 0x0B, 0xE0, 0xFE, 0x1F,
-    0xD1, 0xFC, 0x2F, 0x83, 0xF4, 0x3F, 0x07, 0xD0, 0xBC, 0x05, 0x40, 0x6A, 0x40, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x04, 0x01, 0xAA, 0x03, 0xFC, 0x07, 0xF4, 0x0F,
-    0xD0, 0x3F, 0x40, 0x7D, 0x00, 0x10, 0x00, 0x00, 0x3D, 0x00, 0x3D, 0x2A, 0xBD, 0x7F, 0xFD, 0x2A,
-    0xFD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7E, 0xA8, 0x7F, 0xFD, 0x7F,
-    0xA8, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xA1, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x00,
-    0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-    0x00, 0x02, 0x80, 0x00, 0x69, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x07, 0xF4, 0x03, 0xFC, 0x0B, 0xFC,
-    0x0F, 0xFC, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0xCB, 0xE3, 0xC0, 0xF0, 0x3C, 0x0B,
-    0xE0, 0xBC, 0x01, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x5B, 0xE5, 0xFF, 0xFF,
-    0xBF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xD0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0xC0, 0x57, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03, 0xC0, 0x02, 0x80,
-    0x15, 0x55, 0x47, 0xFF, 0xFD, 0x3F, 0xFF, 0xC0, 0x00, 0xA8, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0xBF, 0xFA, 0xFF, 0xC7, 0xF8, 0x00, 0xA8, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x40, 0xBF, 0xF8, 0xFF, 0xE0, 0xBF, 0x40,
-    0x09, 0x0F, 0xE3, 0xF8, 0xFE, 0x09, 0x00, 0x04, 0x00, 0x10, 0x3F, 0x00, 0xFC, 0x7F, 0x00, 0xFC,
-    0x3F, 0x00, 0xFC, 0x04, 0x00, 0x10, 0x01, 0xA4, 0x00, 0xFF, 0xF0, 0x2F, 0x5B, 0xC3, 0xC0, 0x3C,
-    0x3C, 0x03, 0xC3, 0xD0, 0x3C, 0x1F, 0xAF, 0x80, 0xBF, 0xE0, 0x00, 0x10, 0x00, 0x0A, 0x90, 0xFC,
-    0x1F, 0x82, 0xF0, 0x3E, 0x07, 0xC0, 0x10, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0xE0, 0x06, 0xFC,
-    0x00, 0x3E, 0x00, 0x3E, 0x00, 0xBE, 0xBF, 0xFC, 0xBF, 0xD0, 0x00, 0x40, 0x03, 0xE0, 0x0F, 0xC0,
-    0x1F, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0xFC, 0x0F, 0xFC, 0x00, 0x00, 0x69, 0xBE,
-    0xBE, 0xBE, 0xBE, 0xBE, 0x69, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xEB,
-    0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x28, 0x02, 0x80, 0x28, 0x3C, 0x03, 0xC0, 0x3C, 0x2F, 0x5F, 0xF5, 0xF8, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x01, 0xA4, 0x1A, 0x40, 0x29, 0x00, 0x06, 0x82, 0xF8, 0x02, 0xF8, 0x0B, 0xE0, 0xBE, 0x00,
-    0x3F, 0xBF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2A,
-    0x80, 0x00, 0x0B, 0xFD, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x3F, 0x5F, 0xC0, 0x0F, 0xD0, 0x7F, 0x03,
-    0xF0, 0x00, 0xFC, 0x14, 0x00, 0x01, 0x40, 0xB0, 0x00, 0x0E, 0xB8, 0x00, 0x2E, 0x7E, 0x56, 0xFC,
-    0x2F, 0xFF, 0xF4, 0x07, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x01, 0xAA, 0x40, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFC, 0x7D, 0x00, 0x7D, 0xB4, 0x00, 0x1E, 0x10, 0x00, 0x04, 0x01, 0x90, 0x00, 0x91, 0xFF,
-    0xD0, 0x1E, 0x3F, 0xFF, 0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02, 0xFF, 0x05, 0x00, 0x00, 0x00,
-    0x15, 0x55, 0x54, 0xBF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFE, 0x15, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xAA,
-    0x97, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x01, 0x90,
-    0x00, 0x60, 0x3F, 0xF4, 0x03, 0xC3, 0xFF, 0xFD, 0x7E, 0x1F, 0x47, 0xFF, 0xF0, 0xB4, 0x01, 0xFF,
-    0x40, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x14, 0x00, 0x01, 0xFC,
-    0x00, 0x0B, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFF, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0x80, 0x00, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x3F, 0x07, 0xE0, 0x3C, 0x0F, 0x03, 0xCB, 0xE3, 0xE0, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0xBC, 0x00, 0x03, 0xEB, 0xC0, 0x00, 0x3E, 0xBC,
-    0x00, 0x03, 0xEB, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,
-    0x3C, 0x3D, 0x55, 0x55, 0x7C, 0x3F, 0xFF, 0xFF, 0xFC, 0x2A, 0xAA, 0xAA, 0xA8, 0x01, 0xA4, 0x1A,
-    0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0x0B, 0xF0, 0xB8, 0x3C, 0x03, 0xC0, 0x3C, 0x28, 0x02, 0x80,
-    0x28, 0x00, 0x00, 0x24, 0x18, 0xBD, 0x7E, 0x3F, 0xFC, 0x0F, 0xF0, 0x1F, 0xF4, 0x7F, 0xFD, 0x7C,
-    0x3D, 0x10, 0x04, 0x00, 0x41, 0xFD, 0x3F, 0x87, 0xD0, 0x3D, 0x02, 0xF0, 0x0F, 0xC0, 0x7C, 0x07,
-    0xD2, 0xFC, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x00, 0x7F, 0x80, 0x2F, 0xC0, 0x0B,
-    0xF0, 0x02, 0xF8, 0x00, 0xBD, 0x00, 0x04, 0x00, 0xAA, 0x00, 0xBF, 0x40, 0x3F, 0x80, 0x3F, 0x80,
-    0x2F, 0x80, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x01, 0x90, 0x00, 0x91, 0xFF, 0xD0, 0x1E, 0x3F, 0xFF,
-    0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xFF,
-    0xD0, 0xBD, 0x07, 0xD0, 0xBC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x14,
-    0x1F, 0xD1, 0x07, 0xE2, 0xFC, 0xFC, 0xBF, 0x3F, 0x4F, 0xD7, 0xE3, 0xE0, 0xFC, 0x04, 0x7C, 0x01,
-    0x00, 0x01, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF5, 0x3F, 0xF0, 0xFE, 0x2A, 0xAA, 0xAA,
-    0xAA, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xAA, 0xAA, 0xAF, 0xC3, 0xD0, 0x00, 0x00, 0x7C, 0x3D,
-    0x00, 0x00, 0x07, 0xC3, 0xD0, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
-    0x55, 0x69, 0x06, 0x9B, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0, 0xBE, 0xBE, 0x0B, 0xEB, 0xE0, 0xBE,
-    0x69, 0x06, 0x90, 0x7F, 0xFD, 0x7F, 0xFD, 0x2A, 0xBD, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x01, 0x80, 0x00, 0x19, 0x3D, 0x09, 0x1F, 0xFF, 0xC1, 0xE3, 0xFF, 0xFD, 0x7D, 0xBC,
-    0x3F, 0xFF, 0xCF, 0x47, 0xEF, 0xF0, 0x50, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x01, 0x90, 0x00, 0x91, 0xFF,
-    0xD0, 0x1E, 0x3F, 0xFF, 0xD7, 0xDB, 0xC1, 0xFF, 0xFC, 0xF4, 0x02, 0xFF, 0x01, 0x00, 0x50, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0xBF, 0x80, 0x3C, 0x2F, 0xFF, 0x9B, 0xC3, 0xD1, 0xFF, 0xF4, 0x3C, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xC1, 0xFF, 0xF4, 0x7C, 0x3E, 0x6F, 0xFF, 0x83, 0xC0, 0x2F,
-    0xF0, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x40, 0x0B, 0xD5, 0x7E, 0x03,
-    0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x80, 0x7C, 0x03, 0xD0, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x07, 0xE0, 0x1F, 0xF8, 0x1B, 0xE8, 0x03, 0xD0, 0x03, 0xD0, 0x03,
-    0xD0, 0x03, 0xD0, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F,
-    0xFD, 0x79, 0x50, 0x00, 0x55, 0x00, 0x05, 0x6D, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x78,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x0E, 0x3C, 0xB0, 0x00, 0x2D, 0x00, 0x00, 0x0E,
-    0x14, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x02,
-    0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x10, 0x1D, 0x00, 0x00, 0x00, 0x78, 0x04,
-    0x78, 0x04, 0x00, 0x00, 0x00, 0x10, 0x2D, 0x78, 0x10, 0x00, 0x00, 0x00, 0x04, 0x2D, 0x78, 0x3C,
-    0x00, 0x00, 0x00, 0x2D, 0x2D, 0x78, 0x24, 0x00, 0x00, 0x00, 0x18, 0x2D, 0x78, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x24, 0x1D, 0x00, 0x00, 0x00, 0x78, 0x18, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x01, 0x4D, 0x00, 0x71, 0x40, 0x00, 0x78, 0x00, 0x0E, 0x3C, 0xB0, 0x00, 0x2D, 0x78, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD, 0x7F, 0xF4, 0x03, 0xFF, 0xC0, 0x1F, 0xFD,
-    0x10, 0x00, 0xF8, 0x02, 0xFE, 0x40, 0xBF, 0x01, 0xFC, 0x7F, 0xE3, 0xF4, 0x09, 0x00, 0x01, 0x07,
-    0xD7, 0xE2, 0xE0, 0xB4, 0x2E, 0x07, 0xE0, 0x7D, 0x01, 0x00, 0x00, 0x55, 0x00, 0x0B, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFC, 0x7E, 0x41, 0xBD, 0xB8, 0x00, 0x1E, 0x60, 0x7D, 0x09, 0x00, 0xFF, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x3D, 0x7C, 0x3F, 0xFC, 0x0F, 0xF0,
-    0x1F, 0xF4, 0x7F, 0xFD, 0x2C, 0x3C, 0x00, 0x00, 0x00, 0x04, 0x01, 0xF1, 0xBF, 0x8F, 0xF4, 0x3F,
-    0x40, 0xBF, 0xC0, 0x2F, 0xC0, 0x07, 0x10, 0x00, 0xF4, 0x03, 0xFE, 0x01, 0xFF, 0x01, 0xFC, 0x7F,
-    0xE3, 0xF4, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x0B, 0xF8, 0x03, 0xF4, 0x02,
-    0xFD, 0x2F, 0xE0, 0x07, 0xF4, 0xF7, 0xC0, 0xBF, 0xC7, 0xCF, 0x4F, 0xE0, 0x3D, 0x1F, 0x38, 0x00,
-    0xF0, 0x3C, 0x50, 0x2F, 0x07, 0xF0, 0x3D, 0x0B, 0x43, 0xD7, 0xF2, 0xF0, 0x50, 0x00, 0x0A, 0x0F,
-    0xE3, 0xF8, 0xFE, 0x09, 0x00, 0x02, 0x80, 0x03, 0xC0, 0x77, 0xDD, 0xBF, 0xFE, 0x5F, 0xF5, 0x1F,
-    0xF4, 0x3E, 0xBC, 0x08, 0x20, 0x06, 0xF8, 0x2F, 0x90, 0x1F, 0xFF, 0xFF, 0xF4, 0x3D, 0x0B, 0xE0,
-    0x7C, 0x3C, 0x03, 0xC0, 0x3C, 0x3C, 0x03, 0xC0, 0x3C, 0x3D, 0x0B, 0xE0, 0x7C, 0x1F, 0xFF, 0xFF,
-    0xF4, 0x07, 0xF8, 0x2F, 0xD0, 0x04, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3F, 0xFD, 0x7F, 0xFC, 0x00,
-    0x3C, 0x00, 0x78, 0x00, 0x60, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x01, 0xFF, 0xE5, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x50, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x01,
-    0xFF, 0xE5, 0x00, 0x05, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x50, 0x00, 0x00, 0x15, 0x55, 0x55,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x15,
-    0x55, 0x55, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x01, 0x80, 0x7F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x3C,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFA, 0x55, 0x6F, 0x83, 0xF4, 0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C,
-    0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xAF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFD, 0x40, 0x00, 0x16, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x02, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC1, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0xBE,
-    0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x1E, 0xBC, 0x00, 0x0E, 0x00, 0x0E, 0x1F, 0xFF,
-    0x74, 0x0B, 0xB0, 0x0F, 0x74, 0x6F, 0x1F, 0xD6, 0x01, 0x50, 0x03, 0xEF, 0x03, 0x80, 0xB1, 0xD0,
-    0x1C, 0x7F, 0xFF, 0x5C, 0x00, 0x03, 0x40, 0x00, 0xB9, 0x18, 0x06, 0xFD, 0x00, 0x11, 0xC1, 0x04,
-    0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x01, 0x50, 0x07, 0xEF, 0x47, 0x40, 0xB2, 0xC0, 0x0D, 0xF0,
-    0x03, 0xAC, 0x00, 0xE7, 0x00, 0x74, 0xF4, 0x78, 0x0B, 0xF4, 0x00, 0x10, 0x01, 0x1C, 0x01, 0xC7,
-    0x00, 0x71, 0xC0, 0x1C, 0x70, 0x07, 0x1C, 0x01, 0xC7, 0x00, 0xB0, 0xE0, 0xBC, 0x1B, 0xE3, 0x00,
-    0x01, 0x50, 0x7E, 0xE7, 0x40, 0x2C, 0x00, 0xB0, 0x02, 0xC0, 0x07, 0x00, 0x0F, 0x45, 0x0B, 0xF4,
-    0x00, 0x02, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x05, 0x1C, 0x2E, 0xBB, 0x1D, 0x03, 0xCB, 0x00, 0x73,
-    0x80, 0x1C, 0xE0, 0x07, 0x2C, 0x02, 0xC3, 0xD1, 0xF0, 0x2F, 0x8C, 0x60, 0x00, 0x1C, 0x00, 0x07,
-    0x00, 0x01, 0xC1, 0x40, 0x7B, 0xBE, 0x1E, 0x02, 0xC7, 0x00, 0x31, 0xC0, 0x0C, 0x70, 0x03, 0x1C,
-    0x00, 0xC7, 0x00, 0x31, 0xC0, 0x0C, 0x10, 0x50, 0x05, 0x03, 0xBB, 0xEB, 0xBD, 0x3C, 0x0B, 0x80,
-    0xF3, 0x80, 0x70, 0x0B, 0x34, 0x07, 0x00, 0xB3, 0x40, 0x70, 0x0B, 0x34, 0x07, 0x00, 0xB3, 0x40,
-    0x70, 0x0B, 0x34, 0x03, 0x00, 0x60, 0x00, 0x4A, 0xBD, 0xB8, 0x0B, 0x00, 0xB0, 0x0B, 0x00, 0xB0,
-    0x0B, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x24, 0x01, 0xE5, 0x1F, 0xE8, 0x0D, 0x00, 0x34, 0x00, 0xD0,
-    0x03, 0x40, 0x0D, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x2C, 0x00, 0xD3, 0x40, 0xB0, 0xB0,
-    0x34, 0x1C, 0x1C, 0x03, 0x8E, 0x00, 0x77, 0x00, 0x0F, 0xC0, 0x01, 0xD0, 0x00, 0x10, 0x01, 0x0E,
-    0x03, 0x80, 0xD2, 0xC0, 0x1E, 0xC0, 0x02, 0xD0, 0x00, 0xFC, 0x00, 0xE3, 0x80, 0xF0, 0x38, 0x60,
-    0x06, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x7F, 0xFF, 0xFA, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0x00, 0x01, 0xBF, 0xE0, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00,
-    0x07, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x03,
-    0xF4, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x1F, 0xD0, 0x7F, 0x55, 0x56, 0xFF, 0x40,
-    0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0x55, 0x56, 0xFF, 0xD0, 0x7F,
-    0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00,
-    0x03, 0xFC, 0x7F, 0x00, 0x00, 0x07, 0xFC, 0x7F, 0x00, 0x00, 0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x7F, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xE4, 0x00, 0x7F, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x2F, 0x40,
-    0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F,
-    0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF5, 0x55, 0x55,
-    0x56, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xAA, 0xAA,
-    0xAA, 0xAF, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF,
-    0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0xFF, 0xFF, 0xFD, 0x0B, 0xFB, 0xF0, 0x3F, 0xFF,
-    0xFF, 0x42, 0xFE, 0xFC, 0x0F, 0xFF, 0xFF, 0xD0, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xC1, 0xBF, 0xF9, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
-    0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41,
-    0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFD, 0x1F, 0xC0, 0x00, 0x01, 0xFE,
-    0x07, 0xF0, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x00,
-    0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xC0, 0x7F, 0x40, 0x00, 0x07, 0xF0, 0x7F, 0x40, 0x00, 0x01,
-    0xFC, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xBF, 0xC0, 0x00, 0x01, 0xFF, 0x47, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0xBF, 0x80, 0x00, 0x1F,
-    0xC0, 0x0F, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
-    0x00, 0x02, 0xFD, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFC,
-    0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-    0x80, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x00, 0x00,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x0B,
-    0xE0, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00,
-    0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40,
-    0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x7F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x7E, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xFD, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0xBD, 0xFD, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0xFD, 0x7E, 0x3F, 0x40, 0x00, 0x01, 0xF8, 0xFD, 0x7E, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0xFD, 0x7E,
-    0x0F, 0xC0, 0x00, 0x03, 0xF0, 0xFD, 0x7E, 0x0F, 0xD0, 0x00, 0x0B, 0xE0, 0xFD, 0x7F, 0x07, 0xF0,
-    0x00, 0x0F, 0xC0, 0xFD, 0x7F, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFD, 0x7F, 0x02, 0xF8, 0x00, 0x2F,
-    0x40, 0xFD, 0x7F, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x7F, 0x00, 0xFD, 0x00, 0x7E, 0x00, 0xFD,
-    0x7F, 0x00, 0x7F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0xFD, 0x7F, 0x00,
-    0x2F, 0x82, 0xF4, 0x00, 0xFD, 0x7F, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x0F, 0xD7,
-    0xE0, 0x00, 0xFD, 0x7F, 0x00, 0x0B, 0xEB, 0xD0, 0x00, 0xFD, 0x7F, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFD, 0x7F, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD, 0x7F, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFD, 0x7F,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFD, 0x7F, 0x80, 0x00,
-    0x00, 0x03, 0xE7, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xFF, 0x80,
-    0x00, 0x00, 0x7F, 0x7F, 0xFD, 0x00, 0x00, 0x07, 0xF7, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x7E, 0x7F,
-    0x80, 0x00, 0x07, 0xF7, 0xE2, 0xFC, 0x00, 0x00, 0x7F, 0x7E, 0x0F, 0xF0, 0x00, 0x07, 0xF7, 0xE0,
-    0x7F, 0x80, 0x00, 0x7F, 0x7E, 0x02, 0xFC, 0x00, 0x07, 0xF7, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x7F,
-    0x00, 0x7F, 0x40, 0x07, 0xF7, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x7F, 0x00, 0x0F, 0xE0, 0x07, 0xF7,
-    0xF0, 0x00, 0x7F, 0x40, 0x7F, 0x7F, 0x00, 0x03, 0xFC, 0x07, 0xF7, 0xF0, 0x00, 0x0F, 0xE0, 0x3F,
-    0x7F, 0x00, 0x00, 0xBF, 0x43, 0xF7, 0xF0, 0x00, 0x03, 0xFC, 0x3F, 0x7F, 0x00, 0x00, 0x1F, 0xE3,
-    0xF7, 0xF0, 0x00, 0x00, 0xBF, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x15, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA, 0x40, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x06, 0xAA, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFC,
-    0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0,
-    0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0,
-    0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00,
-    0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00,
-    0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x00,
-    0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x7F, 0xFF, 0xE9,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0x01, 0x7F, 0xF4, 0x7F,
-    0x00, 0x00, 0x7F, 0xC7, 0xF0, 0x00, 0x01, 0xFD, 0x7F, 0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00,
-    0xFF, 0x7F, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x0F, 0xD7, 0xF0,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87, 0xF5, 0x56, 0xBF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF8,
-    0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xAA, 0x94, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x02,
-    0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x01,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xAF, 0xFB, 0xFF, 0xF8, 0x00, 0x3F, 0xF4, 0x03, 0xF4, 0x02, 0xFF, 0x80, 0x2F, 0xE0,
-    0x00, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0xFE, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0F, 0xD0, 0x00, 0x0B,
-    0xE3, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x2F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0xBF, 0x40,
-    0x03, 0xF4, 0x00, 0x2F, 0xD0, 0x0F, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xE5, 0x3F,
-    0x86, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x1F, 0x81, 0xFD, 0x00, 0x00, 0x03, 0xF4, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00,
-    0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0xBF, 0x00,
-    0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xE0, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0x0F,
-    0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF6, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0xBF, 0x00, 0x07,
-    0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF6,
-    0xFC, 0x00, 0x1F, 0xC0, 0x00, 0xFD, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x6F, 0xC0, 0x01, 0xFC,
-    0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x7F, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xFC, 0x3F,
-    0x40, 0x07, 0xF0, 0x00, 0xBF, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x82, 0xFC, 0x00, 0x7F, 0x00,
-    0x1F, 0xD0, 0x3F, 0xC0, 0x1F, 0xC0, 0x0F, 0xF0, 0x07, 0xFD, 0x07, 0xF0, 0x2F, 0xF0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x2F, 0xF8, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xC1, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xE2, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD1, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80, 0x03,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFE, 0x3F, 0x00, 0x3F, 0xF5, 0x5B, 0xEF, 0xC0, 0x2F, 0xD0, 0x00, 0x7F, 0xF0, 0x0F, 0xE0, 0x00,
-    0x0B, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x00,
-    0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00,
-    0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00,
-    0xBF, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F,
-    0xFC, 0x00, 0xFF, 0xE5, 0xBF, 0xBF, 0x90, 0x0F, 0xFF, 0xFF, 0x4F, 0xFE, 0x00, 0x7F, 0xFF, 0x40,
-    0xFF, 0x80, 0x00, 0x54, 0x00, 0x05, 0x00, 0x00, 0x06, 0xA9, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x40, 0x7F, 0xE0, 0x3F, 0xC0, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x03, 0xF8, 0xBF, 0x00, 0x00, 0x3F, 0x8B, 0xE0, 0x00, 0x02, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0x8F,
-    0xD0, 0x00, 0x03, 0xF4, 0xFD, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0xFD, 0x05, 0x5B,
-    0xF4, 0x0F, 0xD0, 0xFF, 0xF4, 0x00, 0xFD, 0x0F, 0xFF, 0xE0, 0x0F, 0xD0, 0x55, 0x7F, 0xD0, 0xFD,
-    0x00, 0x00, 0x7F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00,
-    0xBE, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xDF, 0xF4, 0x00, 0x07, 0xFC, 0xFF, 0xF9, 0x57, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0xFE, 0xBF, 0xFF, 0xE0, 0x0F, 0xD0, 0x15, 0x40, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x3F,
-    0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0xFD,
-    0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x0B, 0xD0, 0x0F, 0xD0, 0x00,
-    0x3F, 0x00, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x3F, 0x00,
-    0x02, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0x1F,
-    0x83, 0xF0, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x94,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x80, 0x1F, 0xE0,
-    0x00, 0xFE, 0x00, 0x01, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x41,
-    0xFF, 0x40, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0xE0, 0x00, 0x0F, 0xF0, 0x2F, 0xC0, 0x00, 0x03,
-    0xF4, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFC,
-    0x7F, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x3F,
-    0xC0, 0x00, 0x03, 0xF8, 0x1F, 0xD0, 0x00, 0x07, 0xF0, 0x0F, 0xF4, 0x00, 0x1F, 0xE0, 0x03, 0xFF,
-    0x96, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xF9,
-    0x56, 0xFC, 0x1F, 0xC0, 0x00, 0x14, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFE, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x04, 0x1F, 0xFE, 0x56, 0xFC, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x01, 0x54, 0x00, 0x1A, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x55, 0x00, 0x3F, 0x07, 0xFF, 0xF8, 0x0F, 0xCB, 0xFF, 0xFF, 0xC3, 0xFB, 0xF5, 0x5F, 0xFC, 0xFF,
-    0xD0, 0x00, 0xBF, 0x7F, 0xE0, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x02, 0xFB, 0xFC, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x06,
-    0xA9, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0x41, 0xBF,
-    0x80, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0xBF, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x00, 0xFC, 0x0F,
-    0xC0, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00,
-    0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0x03, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xEA, 0xAA, 0xAA, 0xFC, 0xFD, 0x00, 0x00, 0x03, 0xF3, 0xF4,
-    0x00, 0x00, 0x0F, 0xCF, 0xE0, 0x00, 0x00, 0x3F, 0x2F, 0x80, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00,
-    0x07, 0xF1, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0xFD, 0x0B, 0xE0, 0x00, 0x07, 0xF0,
-    0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0xE5, 0xBF, 0xD0, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4,
-    0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x07, 0xFD, 0x54, 0xFF, 0xFE, 0x0B, 0xFF, 0x80, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x8F, 0xE0, 0x00, 0x7F, 0x83, 0xF8, 0x00, 0x3F, 0xC0,
-    0xFE, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x2F, 0xD0, 0x03, 0xF8, 0x1F, 0xD0,
-    0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0F, 0xEF, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xD7, 0xF4, 0x00, 0x3F, 0xD0, 0xBF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8,
-    0x01, 0xFE, 0x00, 0xFE, 0x00, 0x2F, 0xD0, 0x3F, 0x80, 0x03, 0xFC, 0x0F, 0xE0, 0x00, 0x3F, 0xC3,
-    0xF8, 0x00, 0x07, 0xF8, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x6A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xEF, 0x40, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x00,
-    0x1F, 0x8F, 0xC0, 0x00, 0x00, 0x2F, 0x4B, 0xE0, 0x00, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x00, 0x7E,
-    0x03, 0xF4, 0x00, 0x00, 0xFD, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00,
-    0xFD, 0x00, 0x03, 0xF4, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x80, 0x0F, 0xD0, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0F, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xF4,
-    0x3F, 0x40, 0x00, 0x07, 0xFD, 0x7F, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x2F, 0xC0, 0xFE, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0xFF, 0xF9, 0x5F, 0xEF, 0xF5, 0xFF, 0xFF,
-    0xFF, 0x8B, 0xFE, 0xFD, 0x7F, 0xFD, 0x03, 0xFE, 0xFD, 0x05, 0x40, 0x00, 0x54, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC7, 0xF0,
-    0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x03, 0xF0, 0x7F, 0x00, 0x00,
-    0x1F, 0xC0, 0xFD, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x02, 0xF8, 0x07, 0xF0, 0x00, 0x0B, 0xD0,
-    0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD,
-    0x00, 0x3F, 0x40, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0xBF,
-    0x00, 0x00, 0x1F, 0x83, 0xF0, 0x00, 0x00, 0x3F, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xA8, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x6F, 0x90, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x50, 0x00, 0x00, 0xBF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x03, 0xFE, 0x55, 0x50, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xF4, 0x00,
-    0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0,
-    0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0,
-    0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00,
-    0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7,
-    0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80,
-    0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x15, 0xBF, 0x55, 0x55, 0xBF, 0x55, 0x00, 0x7F,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x94, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x7F,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x95, 0xBF, 0xC0, 0x0F, 0xF0, 0x00,
-    0x7F, 0xC0, 0x7F, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0xFF, 0x0F, 0xD0, 0x00, 0x01, 0xFC,
-    0x3F, 0x00, 0x00, 0x03, 0xF1, 0xFC, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x5F, 0xC0,
-    0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00,
-    0x7F, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x1F, 0xD1, 0xFF, 0x00, 0x01, 0xFF, 0x07,
-    0xFF, 0xE5, 0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x2F, 0xFF, 0xD0, 0x01, 0xFC, 0x01,
-    0x50, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x7F, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xF4, 0x0B, 0xFE, 0x56, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x07, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x6F,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xA5, 0xFE,
-    0x55, 0x0F, 0xF4, 0x00, 0x3F, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xD0,
-    0x7F, 0x00, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0xFD,
-    0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0xFE, 0x00,
-    0x00, 0x03, 0xF0, 0xBF, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00,
-    0x1F, 0xC0, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x0B, 0xFE, 0x57, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55, 0xFE, 0x55, 0x54, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x56,
-    0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x00, 0x1F, 0xC3, 0xF4, 0x00, 0x00, 0xFD,
-    0x3F, 0x40, 0x00, 0x0F, 0xD3, 0xF4, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x0B, 0xE3, 0xF4, 0x00,
-    0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0B, 0xF3,
-    0xF4, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x0B, 0xE3, 0xF4, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00,
-    0x0F, 0xD3, 0xF8, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x3F, 0x81, 0xFE, 0x00, 0x0F, 0xF0, 0x0F,
-    0xFD, 0x5B, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0x9F, 0xDB, 0xFF, 0x40, 0x0F, 0xF4, 0x0F, 0xC0, 0x7F, 0xC0, 0x2F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x3F, 0x40, 0x0F, 0xC0, 0x03, 0xF4, 0x7F, 0x00, 0x0F, 0xC0, 0x03,
-    0xF8, 0xBE, 0x00, 0x0F, 0xC0, 0x02, 0xFC, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F,
-    0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0xBF,
-    0x00, 0x0F, 0xC0, 0x02, 0xFC, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x3F, 0x40, 0x0F, 0xC0, 0x07,
-    0xF4, 0x2F, 0xC0, 0x0F, 0xC0, 0x0F, 0xF0, 0x0F, 0xF4, 0x0F, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0x9F,
-    0xEB, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0xF4, 0x00, 0x00, 0x1F, 0xC1, 0x7F, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0xBF,
-    0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x40, 0x02, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x3F,
-    0x40, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x2F,
-    0xBF, 0xC0, 0x00, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x2F,
-    0xC0, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xFB, 0x1F,
-    0xC0, 0x00, 0x00, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0x00, 0x0B, 0xE0, 0x03, 0xF4, 0x3F, 0x00, 0x0B, 0xE0, 0x02, 0xF8, 0x3F, 0x00, 0x0B, 0xE0,
-    0x01, 0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFC, 0x3F, 0x00,
-    0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xFD,
-    0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x3F, 0x00, 0x0B, 0xE0, 0x00, 0xBD, 0x3F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFD, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0xFD, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0xFC, 0x3F, 0x80,
-    0x0B, 0xE0, 0x01, 0xFC, 0x2F, 0xC0, 0x0B, 0xE0, 0x03, 0xF8, 0x0F, 0xE0, 0x0B, 0xE0, 0x0B, 0xF0,
-    0x0B, 0xF8, 0x0B, 0xE0, 0x2F, 0xE0, 0x03, 0xFF, 0xAF, 0xFB, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x42, 0xF8,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0x05, 0x00,
-    0x00, 0xFC, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0xBF,
-    0x00, 0x02, 0xF8, 0x00, 0x0F, 0xEB, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0xBF, 0x00, 0x02, 0xF8,
-    0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xD3,
-    0xF4, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0x81, 0xFD, 0x00, 0xBF,
-    0xE0, 0x07, 0xF4, 0x0B, 0xF9, 0x7F, 0x5F, 0xD6, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC0,
-    0x00, 0xBF, 0xF8, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4,
-    0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00,
-    0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F, 0x2F, 0xE0, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00,
-    0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF, 0xFE, 0x2F, 0x02, 0xFF,
-    0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x90, 0x00,
-    0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x11, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x06, 0xE9, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x15, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xBE, 0x51, 0xBF, 0xC0,
-    0x08, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x6B, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xA5,
-    0x47, 0xF2, 0xFE, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0x07, 0xFF, 0x2F, 0xF5, 0x5F, 0xEF, 0xC3,
-    0xFF, 0xFF, 0xE2, 0xF0, 0x2F, 0xFF, 0xD0, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00,
-    0x1F, 0xF0, 0x7D, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x60, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0,
-    0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFD, 0x0F, 0xC0, 0x00, 0x07,
-    0xFF, 0x4A, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0xBC, 0x00, 0x00, 0x40, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xF9, 0x46, 0xFF, 0x00,
-    0x00, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1A, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFE, 0x95, 0x1F, 0xC0, 0x2F, 0xE0, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00,
-    0x1F, 0xC0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x01, 0xFF, 0xC0, 0x2F, 0xF5, 0x5F, 0xEF, 0xC0, 0x0F, 0xFF, 0xFF, 0x8B, 0xC0,
-    0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x05, 0x40, 0x00, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x19, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x02,
-    0xF4, 0x1F, 0x80, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x15, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xF8, 0x00, 0x00, 0xA1, 0xFF, 0xD0, 0x00, 0x00,
-    0x3F, 0x7F, 0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x03, 0xE0, 0x02, 0xF0, 0x00, 0x10, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x20, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x6B,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFA, 0x54, 0x7F, 0x0B, 0xF8, 0x00, 0x07, 0xF0,
-    0xFE, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x00, 0xBF, 0x0F, 0xD0, 0x00,
-    0x0F, 0xF0, 0xFF, 0x00, 0x07, 0xFF, 0x0B, 0xFD, 0x57, 0xFB, 0xF0, 0x3F, 0xFF, 0xFE, 0x2F, 0x00,
-    0xBF, 0xFF, 0x42, 0xF0, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x74, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x20, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x00, 0x0F,
-    0x80, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00,
-    0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B,
-    0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F,
-    0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA,
-    0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0,
-    0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0x40, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF8, 0x2C, 0x00, 0x00,
-    0x7F, 0xF4, 0x70, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x02,
-    0xF0, 0x00, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x51, 0xBF, 0xC0, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x6B, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xA5, 0x47, 0xF0, 0x2F, 0xE0, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00,
-    0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x07, 0xFF,
-    0x02, 0xFF, 0x55, 0xFE, 0xFC, 0x03, 0xFF, 0xFF, 0xE2, 0xF0, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xF0, 0x00,
-    0x00, 0x03, 0xFF, 0xFB, 0xD0, 0x00, 0x00, 0x0B, 0x82, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x00,
-    0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F,
-    0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B,
-    0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00,
-    0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55,
-    0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE,
-    0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0,
-    0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x0B, 0x40, 0x0B, 0xFF, 0xD7,
-    0xC0, 0x03, 0xD6, 0xFF, 0xE0, 0x01, 0xD0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xDF, 0xC0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x0F,
-    0x80, 0x0B, 0xC0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00,
-    0x07, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF8, 0x02, 0xF9, 0x46, 0xFF, 0x00, 0x20, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x07, 0xF0, 0x01, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x0B, 0xFE, 0x95, 0x1F, 0xCB, 0xF8,
-    0x00, 0x07, 0xF3, 0xF8, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x2F, 0xCF,
-    0xD0, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x1F, 0xFC, 0xBF, 0xD5, 0x7F, 0xBF, 0x0F, 0xFF, 0xFF, 0x8B,
-    0xC0, 0xBF, 0xFF, 0x42, 0xF0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80,
-    0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF,
-    0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00,
-    0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x80, 0x00, 0x7F, 0x02, 0xF8,
-    0x00, 0x7E, 0x00, 0x1F, 0x80, 0x04, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F,
-    0x2F, 0xE0, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00,
-    0xBF, 0x3F, 0x40, 0x00, 0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF,
-    0xFE, 0x2F, 0x02, 0xFF, 0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x41, 0x41,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F,
-    0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0,
-    0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xA0, 0x60, 0x28, 0x00, 0x3D, 0x00,
-    0x1F, 0x00, 0x0B, 0xD4, 0x6F, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80,
-    0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F,
-    0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0x41,
-    0x41, 0xD0, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0,
-    0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07,
-    0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xA0, 0x60, 0x28, 0x00, 0x3C,
-    0x00, 0x1F, 0x00, 0x0B, 0xD4, 0x6F, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F,
-    0x80, 0x00, 0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF,
-    0x3F, 0xC0, 0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4,
-    0x2F, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x07, 0x42, 0x01, 0xD0, 0x00,
-    0x00, 0x07, 0xC0, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-    0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03,
-    0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00,
-    0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xAB, 0xC0, 0x00, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x28, 0x28, 0x0A, 0x00,
-    0x0B, 0x40, 0x03, 0xC0, 0x01, 0xF5, 0x17, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x1F, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x0B, 0xE5, 0x1B, 0xFC, 0x00, 0x80, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x06, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFA, 0x54, 0x7F, 0x2F, 0xE0, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00,
-    0x3F, 0xCF, 0xF0, 0x00, 0x7F, 0xF2, 0xFF, 0x55, 0xFE, 0xFC, 0x3F, 0xFF, 0xFE, 0x2F, 0x02, 0xFF,
-    0xFD, 0x0B, 0xC0, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0x0B, 0x82, 0xFF, 0xC0, 0x00, 0x00,
-    0x0A, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x01, 0xD0,
-    0x00, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xF5, 0x6F, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0,
-    0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-    0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00,
-    0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F,
-    0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE4, 0x07, 0x40,
-    0x07, 0xFF, 0xD7, 0xC0, 0x03, 0xD6, 0xFF, 0xE0, 0x00, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x02, 0x80, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0xBD, 0x46, 0xF4, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xF8, 0x02, 0xF9, 0x46, 0xFF, 0x00,
-    0x20, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xAF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x0B, 0xFE, 0x95,
-    0x1F, 0xCB, 0xF8, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x01, 0xFC, 0xFD, 0x00, 0x00, 0x7F, 0x7F, 0x00,
-    0x00, 0x2F, 0xCF, 0xD0, 0x00, 0x0F, 0xF3, 0xFC, 0x00, 0x1F, 0xFC, 0xBF, 0xD5, 0x7F, 0xBF, 0x0F,
-    0xFF, 0xFF, 0x8B, 0xC0, 0xBF, 0xFF, 0x42, 0xF0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0xE0, 0x00, 0x00, 0x0B, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0xD0, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0, 0x0B, 0xE0, 0x00, 0x00, 0x0F,
-    0xD0, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x55, 0x55, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0xAA, 0xAA, 0xBF, 0x80, 0x03, 0xF4,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00,
-    0x02, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0x00, 0x3D, 0x00, 0x0F,
-    0x40, 0x0B, 0xE5, 0x6F, 0xC0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x2F, 0x94, 0x6F, 0xF0, 0x02, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1A, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0xBF, 0xE9, 0x51, 0xFC, 0xBF, 0x80, 0x00, 0x7F, 0x3F, 0x80, 0x00,
-    0x1F, 0xCF, 0xD0, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x02, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x3F, 0xC0,
-    0x01, 0xFF, 0xCB, 0xFD, 0x57, 0xFB, 0xF0, 0xFF, 0xFF, 0xF8, 0xBC, 0x0B, 0xFF, 0xF4, 0x2F, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x1B, 0xA0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x04, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x06, 0xE8, 0x00, 0x00,
-    0x00, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8,
-    0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F,
-    0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x64, 0x00, 0x18, 0x03,
-    0xFF, 0x80, 0x3C, 0x0B, 0xFF, 0xF9, 0xFC, 0x0F, 0x47, 0xFF, 0xF4, 0x1E, 0x00, 0x7F, 0xD0, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x64, 0x00, 0x09, 0x00, 0x2F, 0xF8, 0x02, 0xD0,
-    0x07, 0xFF, 0xF9, 0xBC, 0x00, 0xF8, 0x2F, 0xFF, 0x80, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFF, 0x40, 0x0B, 0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF,
-    0x40, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0xFF, 0x43, 0xD0, 0x00, 0x3F, 0xFC, 0x64,
-    0x00, 0x0B, 0xE7, 0xF0, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x55, 0x55, 0x40, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0x55, 0x55, 0x54, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFF, 0x07, 0xD0, 0x00, 0x0F, 0xFE, 0x29, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xD0,
-    0xBD, 0x00, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xF4, 0x5F, 0xF4, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,
-    0x2F, 0xC2, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x01, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0xAA, 0xAA, 0xAA, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x50, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x15, 0x40, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xF4, 0x00, 0x00, 0xA2, 0xFF, 0xD0, 0x00,
-    0x00, 0xBE, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xFE, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xF5, 0x55, 0x55, 0x40, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x54, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x3F, 0xC0, 0x00, 0x01, 0xA3, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xAF, 0x80, 0x00, 0x02, 0xF8, 0x2F,
-    0x80, 0x00, 0x1F, 0x40, 0x1F, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x0B, 0xFD,
-    0x17, 0xFD, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC2, 0xF8, 0x00, 0x00, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xAA, 0xAA, 0xAA, 0x83, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x14, 0x01, 0xFF, 0xE5, 0xAF, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x2B,
-    0xE0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x03, 0xFD,
-    0x0E, 0x00, 0x03, 0xFF, 0xC2, 0x40, 0x02, 0xF9, 0xFC, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x01, 0xF0,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x1F,
-    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0x55, 0x55, 0x50, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x07, 0xF5, 0x55, 0x55, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x82, 0xD0, 0x00, 0x0F, 0xFE, 0x1C, 0x00, 0x03, 0xF7,
-    0xF4, 0x00, 0x00, 0xFD, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x01, 0x40, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x7F,
-    0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x2F,
-    0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0xFF, 0x40, 0xF0, 0x03,
-    0xFF, 0xFB, 0xE0, 0x07, 0x82, 0xFF, 0xC0, 0x0B, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBE, 0x7F, 0x00, 0x02, 0xF4, 0x1F, 0x80, 0x07,
-    0xC0, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0x80,
-    0x01, 0xFF, 0xF9, 0xF4, 0x00, 0x3E, 0x2F, 0xFF, 0x00, 0x03, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00,
-    0x0B, 0xD0, 0xBD, 0x00, 0x02, 0xF0, 0x01, 0xF0, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0B,
-    0xFD, 0x17, 0xFD, 0x01, 0xFD, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02,
-    0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0xAA, 0xAA, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x01, 0x40, 0x7F, 0xF9, 0x6B, 0xF4, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0x90,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0xBF, 0x3F, 0x80, 0x02, 0xF8, 0x0F, 0xE0, 0x07, 0xD0, 0x02, 0xF4, 0x01, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x7F, 0x55, 0x55, 0x54, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x07,
-    0xF2, 0xFC, 0x00, 0x01, 0xFC, 0x0B, 0xF0, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x01, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
-    0xFF, 0xF4, 0x00, 0xBF, 0xD1, 0x7F, 0xD0, 0x1F, 0xD0, 0x00, 0xBF, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-    0x7F, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFA, 0xAA, 0xAA, 0xA8, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x14, 0x07, 0xFF, 0x96, 0xBF, 0x40, 0x1F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xF8, 0x00, 0x07,
-    0xD0, 0x02, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFC, 0x1B, 0xFF, 0x90, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00,
-    0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0,
-    0x00, 0x6F, 0xE4, 0x1F, 0xFF, 0xFC, 0xBF, 0xFF, 0xF0, 0x7E, 0x80, 0xFF, 0xF4, 0x15, 0xFC, 0x00,
-    0xBC, 0x00, 0xFC, 0x0B, 0xF4, 0x1F, 0x90, 0x1F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F,
-    0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F,
-    0x40, 0x3F, 0x40, 0x3F, 0x40, 0x3F, 0x40, 0x7F, 0xFF, 0xF2, 0xFF, 0xFF, 0xC1, 0xBF, 0xF9, 0x00,
-    0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
-    0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC,
-    0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x06, 0xFE, 0x41, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x01,
-    0xFC, 0x00, 0x01, 0x80, 0x00, 0x0A, 0x0F, 0xE3, 0xFC, 0xFE, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F,
-    0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x90, 0xFE, 0x3F, 0xCF, 0xE0,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0,
-    0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7,
-    0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF,
-    0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F,
-    0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00,
-    0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F,
-    0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0,
-    0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00,
-    0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F,
-    0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02,
-    0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC2, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0xBF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xEA, 0xBF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xE9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x11, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x50, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xF9, 0x5B,
-    0xFD, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x7F, 0x00, 0x00, 0x0B, 0xF2,
-    0xFC, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0x3F, 0x7F, 0x80, 0x00, 0x00, 0xFE, 0xFD, 0x00,
-    0x00, 0x03, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x3F, 0xAF, 0x80, 0x00, 0x00,
-    0xFD, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0xFD, 0x00, 0x00, 0x2F, 0xC2, 0xFC, 0x00, 0x00, 0xFE, 0x03,
-    0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFE, 0x56, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0xBC, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x28, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x7F,
-    0xC0, 0x00, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xC2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x07,
-    0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xEA, 0xBF,
-    0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFD, 0x0F, 0x80, 0x00, 0x0B, 0xFF, 0x1A, 0x00, 0x00, 0x1F,
-    0xDF, 0xC0, 0x00, 0x00, 0x7E, 0x07, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x40, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0x56, 0xFF, 0x40, 0x1F, 0xE0, 0x00, 0x3F, 0xC0,
-    0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0xFE,
-    0x00, 0x00, 0x03, 0xF4, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0xFD, 0x00,
-    0x00, 0x03, 0xF8, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x00,
-    0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x3F,
-    0xC0, 0x07, 0xFE, 0x56, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x54, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x06,
-    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xBD, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC2, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF4, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0xEA, 0xBF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0xBF, 0x40, 0x00, 0x00, 0xA1, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF7, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x10, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x3F, 0x80, 0x00,
-    0x00, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x3F, 0x40, 0x00, 0x00,
-    0xFE, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x1F, 0xC0, 0x00, 0x00, 0xFC,
-    0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x01,
-    0xFF, 0x95, 0xBF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE1, 0x80, 0x00, 0x00,
-    0x01, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xBF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x5F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xEB, 0xF0, 0x00, 0x00,
-    0x00, 0x03, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x2F, 0xD0, 0x00, 0x00, 0x00,
-    0xFE, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x0B, 0xFD,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0xAB, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xF4, 0x3C, 0x00, 0x00, 0xBF, 0xF0, 0xA0, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x00, 0x7E, 0x07, 0xF0, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x04, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0xFF, 0x00,
-    0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0xFE, 0x00, 0x00, 0x03,
-    0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00, 0x00, 0xFE, 0xFE,
-    0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00, 0x3F, 0x0F, 0xD0, 0x00,
-    0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x7F, 0xE5, 0x6F, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xAF,
-    0x00, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x40, 0x1A, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00,
-    0x0B, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x02, 0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0xB0, 0x00, 0x0B, 0xFF, 0x9B, 0xC0, 0x00, 0x3D,
-    0x6F, 0xFD, 0x00, 0x01, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,
-    0x0F, 0x80, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x54, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x0B, 0xFE, 0x56, 0xFF,
-    0x40, 0x7F, 0x80, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xDF, 0xE0, 0x00, 0x00, 0x3F, 0xBF, 0x40, 0x00,
-    0x00, 0xFE, 0xFD, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xEB, 0xE0, 0x00, 0x00, 0x3F,
-    0x5F, 0xC0, 0x00, 0x00, 0xFC, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0xFE,
-    0x00, 0x03, 0xFC, 0x01, 0xFF, 0x95, 0xBF, 0xC0, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xBF, 0xFF,
-    0x80, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0xBF, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFA, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0B,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x02,
-    0xFF, 0x40, 0x00, 0x7F, 0xF0, 0x00, 0x2F, 0xFF, 0xAA, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x02, 0xF4,
-    0x00, 0x14, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0x95, 0xBF, 0xD0, 0x1F, 0xE0, 0x00,
-    0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0xBF, 0x2F, 0xC0, 0x00, 0x00, 0xFD,
-    0xFE, 0x00, 0x00, 0x03, 0xF7, 0xF8, 0x00, 0x00, 0x0F, 0xEF, 0xD0, 0x00, 0x00, 0x3F, 0xBF, 0x40,
-    0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0x00, 0x0F, 0xD7, 0xF0, 0x00, 0x00,
-    0x3F, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0xFF, 0x00,
-    0x7F, 0xE5, 0x6F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xD0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEB, 0xF4, 0x01, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F,
-    0xFE, 0xAA, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0x55, 0x00, 0x0F, 0xE0,
-    0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x2F, 0xFF, 0xFF, 0xD3, 0xF8, 0x02, 0xFF, 0x95, 0xBF, 0xFF,
-    0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00,
-    0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40,
-    0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xE5, 0x6F, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00,
-    0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xF0,
-    0x02, 0xFF, 0x80, 0x00, 0x7F, 0xEB, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x07, 0xF4, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x2F, 0xFE, 0xAA, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x01, 0x55, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0xFF, 0x80, 0x3F, 0x00,
-    0x2F, 0xFF, 0xFF, 0xD3, 0xF8, 0x02, 0xFF, 0x95, 0xBF, 0xFF, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xF8,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00,
-    0x00, 0x3F, 0x80, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xE5, 0x6F, 0xF4,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x47, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x06, 0xFF, 0xFE, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
-    0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0x00, 0x2F, 0xF8, 0x00, 0x07, 0xFE, 0xBF, 0x40,
-    0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x02, 0xFF, 0xEA, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0xE8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x15, 0x50, 0x00, 0xFE, 0x00, 0x1F, 0xFF,
-    0xF8, 0x03, 0xF0, 0x02, 0xFF, 0xFF, 0xFD, 0x3F, 0x80, 0x2F, 0xF9, 0x5B, 0xFF, 0xFC, 0x01, 0xFE,
-    0x00, 0x03, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x02,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0xFD, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x00,
-    0x3F, 0x80, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFC, 0x00,
-    0x00, 0x2F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07,
-    0xFE, 0x56, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0x40, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x0B, 0xFE, 0x00, 0x01, 0xFF, 0xAF, 0xD0, 0x07, 0xFC, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xBF,
-    0xFA, 0xAB, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x06, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x3C, 0x00, 0x00, 0x2F, 0xFF, 0xE7, 0xE0, 0x00, 0x00, 0xF4, 0x7F, 0xFF,
-    0x00, 0x00, 0x07, 0x80, 0x1F, 0xF4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x55, 0x40, 0x03, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x0F, 0xC0, 0x0B,
-    0xFF, 0xFF, 0xF4, 0xFE, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0xFE, 0x00,
-    0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF4, 0x00, 0x00,
-    0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x0F,
-    0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF9, 0x5B, 0xFD, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x1B, 0xFF, 0xF9, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x03, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x1F, 0xFA, 0xFD, 0x00, 0x7F, 0xC0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B,
-    0xFF, 0xAA, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x55, 0x40, 0x03, 0xF8, 0x00, 0x7F,
-    0xFF, 0xE0, 0x0F, 0xC0, 0x0B, 0xFF, 0xFF, 0xF4, 0xFE, 0x00, 0xBF, 0xE5, 0x6F, 0xFF, 0xF0, 0x07,
-    0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x03,
-    0xF8, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x00,
-    0x00, 0xFE, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x03, 0xF0,
-    0x00, 0x00, 0xBF, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xC0, 0x00,
-    0x1F, 0xF9, 0x5B, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xD2, 0xFD, 0x00,
-    0x00, 0x0F, 0xF0, 0x3F, 0xE0, 0x00, 0x1F, 0xF4, 0x03, 0xFF, 0xEA, 0xBF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00,
-    0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4,
-    0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07, 0xFF, 0x0F, 0xFD,
-    0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x15, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF,
-    0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0, 0x00, 0x00, 0x07, 0xFB, 0xF0,
-    0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xEF, 0xC0,
-    0x00, 0x00, 0x07, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0xFE, 0x00,
-    0x00, 0x01, 0xFD, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x40, 0x3F, 0xFE,
-    0xAB, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0x1B, 0xD0,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00,
-    0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3,
-    0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00,
-    0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F, 0x40, 0x00, 0x07, 0xF3, 0xF4, 0x00, 0x00, 0x7F, 0x3F,
-    0x40, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x1F, 0xF2, 0xFD, 0x00, 0x07,
-    0xFF, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0xBF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xFF,
-    0xD0, 0x3F, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-    0xF0, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD5, 0xBF, 0xBF, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0xBF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0F, 0xD0, 0x00,
-    0x01, 0xFC, 0x3F, 0x83, 0xF4, 0x00, 0x00, 0x7F, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xD0,
-    0x3F, 0x40, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xD0, 0x00, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xF0,
-    0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xD5, 0xBF, 0xBF, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x8F, 0xC0, 0x00, 0x00, 0xBF, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC1, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xDB, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0xEA, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x11, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0xFD, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0x3F, 0x40, 0x00, 0x07, 0xF2, 0xFC, 0x0F, 0xD0, 0x00, 0x01,
-    0xFF, 0xFD, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x3F,
-    0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFD, 0x5B, 0xFB, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x02, 0xD0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0x9B, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC1, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF8,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xE6, 0xF0,
-    0x00, 0x00, 0x0F, 0x86, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xC0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFE, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0xBF, 0x03, 0xF4, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x56, 0xFE, 0xFC,
-    0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x3F, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC1,
-    0xFC, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xF8, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xF0, 0xBF,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xEA, 0xBF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0xFE,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0xBF, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x02, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xD0,
-    0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x56, 0xFE, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x3F, 0x00,
-    0x00, 0x02, 0xFF, 0xFD, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x3F, 0x83,
-    0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0,
-    0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0,
-    0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8,
-    0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B,
-    0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC,
-    0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02,
-    0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0,
-    0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00,
-    0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00,
-    0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0,
-    0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03,
-    0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0,
-    0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02,
-    0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F,
-    0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB,
-    0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x19, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x7F, 0x00, 0xBB, 0xFF, 0x40, 0x19, 0x00, 0xBF, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x00, 0x1F, 0x87, 0xF4, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00,
-    0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40,
-    0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0,
-    0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0x1B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x6F,
-    0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F,
-    0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4,
-    0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00,
-    0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0,
-    0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00, 0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00,
-    0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x40, 0x01,
-    0x80, 0x00, 0x02, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0x7F, 0xFF, 0x9B, 0xC0, 0x00, 0x0F, 0x82, 0xFF,
-    0xF4, 0x00, 0x00, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xF4, 0x00,
-    0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xD0, 0x0B, 0xF0,
-    0x00, 0x02, 0xFC, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x0F,
-    0xE0, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x07, 0xF0, 0x00, 0x00,
-    0x1F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x19, 0x00,
-    0x06, 0x00, 0x00, 0xBF, 0xE0, 0x0F, 0x00, 0x02, 0xFF, 0xFE, 0x6F, 0x00, 0x03, 0xE1, 0xBF, 0xFD,
-    0x00, 0x03, 0xC0, 0x1F, 0xF8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x3F,
-    0x80, 0x00, 0x07, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0x0B, 0xE0,
-    0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00,
-    0xBF, 0x00, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBE, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x02, 0xF8,
-    0x00, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x00, 0x2F, 0x87, 0xF0, 0x00, 0x00, 0x0F, 0xCB, 0xE0, 0x00,
-    0x00, 0x0B, 0xDF, 0xC0, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x2D, 0x00, 0x02, 0xD1, 0xAA, 0xBD, 0xFF,
-    0xFF, 0xBC, 0x07, 0x8F, 0x07, 0x83, 0xC2, 0x80, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x40, 0x01, 0xE0,
-    0x01, 0xE0, 0x01, 0xFA, 0xA9, 0xBF, 0xFF, 0xCB, 0x40, 0xF0, 0xB4, 0x3C, 0x0A, 0x0F, 0x00, 0x03,
-    0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F,
-    0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x38, 0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x6A, 0xAA, 0x9B, 0xFF,
-    0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x6A, 0xAA, 0xAA, 0xAA, 0x2F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x55, 0x55, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
-    0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x29, 0x00, 0x19, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00,
-    0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F,
-    0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00,
-    0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F,
-    0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E,
-    0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF4, 0x55, 0x55,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x15, 0x55, 0x55, 0x55, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x7E, 0x02, 0xF4, 0x0F,
-    0xC0, 0x7F, 0x03, 0xF8, 0x0F, 0xE0, 0x7F, 0x40, 0x54, 0x00, 0x0B, 0xF0, 0x3F, 0xC0, 0xFE, 0x03,
-    0xF0, 0x1F, 0xC0, 0xBE, 0x03, 0xF0, 0x0F, 0x80, 0x7D, 0x00, 0x50, 0x00, 0x0F, 0xE0, 0xFE, 0x1F,
-    0xD2, 0xFC, 0x2F, 0x83, 0xF0, 0x3F, 0x07, 0xD0, 0xBC, 0x05, 0x40, 0x7F, 0x41, 0xFD, 0x03, 0xF8,
-    0x0B, 0xF0, 0x1F, 0xC0, 0x3F, 0x40, 0xBD, 0x00, 0xF8, 0x02, 0xF0, 0x01, 0x40, 0x01, 0xF0, 0x07,
-    0x80, 0x3F, 0x00, 0xF8, 0x07, 0xE0, 0x1F, 0x40, 0xBD, 0x03, 0xF4, 0x0F, 0xC0, 0x3F, 0x01, 0xFC,
-    0x0B, 0xF0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x1F, 0xD0, 0x7F, 0x42, 0xFD, 0x01, 0x50, 0x05, 0x40,
-    0x0B, 0xF0, 0x2F, 0x80, 0xFF, 0x03, 0xFC, 0x0F, 0xE0, 0x3F, 0x41, 0xFC, 0x07, 0xF0, 0x1F, 0xC0,
-    0xBF, 0x02, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x01, 0xF0, 0x01,
-    0x40, 0x15, 0x00, 0x0F, 0xE0, 0x3F, 0x83, 0xF8, 0x1F, 0xD1, 0xFD, 0x07, 0xF0, 0xBF, 0x02, 0xFC,
-    0x3F, 0x80, 0xFE, 0x0F, 0xC0, 0x3F, 0x03, 0xF0, 0x1F, 0x81, 0xF4, 0x07, 0xD0, 0xBC, 0x02, 0xF0,
-    0x15, 0x00, 0x50, 0x00, 0x7F, 0x01, 0xFC, 0x07, 0xF4, 0x1F, 0xD0, 0x3F, 0x80, 0xFE, 0x02, 0xFC,
-    0x0F, 0xE0, 0x1F, 0xC0, 0x7F, 0x00, 0xFC, 0x03, 0xF0, 0x0B, 0xD0, 0x2F, 0x40, 0x3E, 0x01, 0xF8,
-    0x02, 0xF0, 0x0F, 0xC0, 0x05, 0x00, 0x14, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xB8,
-    0x00, 0x04, 0x02, 0xD0, 0x05, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF6, 0xA5, 0xB9, 0x6A,
-    0x80, 0x02, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x3F, 0xEB,
-    0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBF, 0xAF, 0xF0, 0x00, 0xB8, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x15, 0x42, 0xE0, 0x56, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x50, 0xB8, 0x15, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x50, 0x00, 0xBF, 0xE0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x1F, 0xFF, 0x40, 0x2F, 0xD0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFF, 0x47, 0xFF, 0xFD, 0x1F, 0xFF, 0x80,
-    0x7F, 0xE0, 0x01, 0xFD, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2F, 0xDF, 0xFB, 0xFE,
-    0xBF, 0x46, 0x00, 0x05, 0x00, 0x00, 0x50, 0x3F, 0xC0, 0x03, 0xFC, 0x7F, 0xD0, 0x03, 0xFD, 0x3F,
-    0xD0, 0x03, 0xFD, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x50, 0x00,
-    0x19, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE7, 0xFD, 0x00, 0x7F, 0xC0, 0x0B, 0xFC, 0xFF, 0x40,
-    0x1F, 0xF0, 0x02, 0xFF, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7F, 0x81, 0x40, 0x00, 0x14, 0x00, 0x06,
-    0x40, 0x05, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x6A, 0xAA, 0xBF, 0xFF, 0xFF, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x02, 0xC0, 0x00, 0xAA, 0xAA, 0x7F, 0xFF, 0xF0, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-    0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-    0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7,
-    0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xD7, 0xAA, 0xA8, 0x70, 0x00, 0x07, 0x00, 0x00,
-    0x70, 0x00, 0x07, 0x00, 0x00, 0x75, 0x55, 0x47, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x7F, 0xFF, 0xD2, 0xAA, 0xAD, 0x00, 0x00, 0xD0, 0x00, 0x0D, 0x00, 0x00,
-    0xD0, 0x00, 0x0D, 0x15, 0x55, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x2F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0xBC, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x3E, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00,
-    0x3F, 0x00, 0x3E, 0x0B, 0xC1, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x02, 0xF0, 0x07, 0xD0, 0xF8, 0x7F,
-    0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x0F, 0x80, 0xFC, 0x3F, 0x0F, 0xD0, 0xFD, 0x03, 0xF4, 0x3F, 0x40,
-    0xBF, 0xBF, 0x87, 0xE0, 0xF8, 0x03, 0xE0, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xE0, 0xFC, 0x1F, 0x40,
-    0x3F, 0x07, 0xD0, 0x0F, 0xC0, 0x06, 0xA0, 0x1F, 0x42, 0xF0, 0x02, 0xF0, 0xBC, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xF0, 0x2F, 0x00, 0x1F, 0x4B, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0xBD, 0x03, 0xF0, 0x01,
-    0xF4, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x1F, 0x4F, 0xC0, 0x07, 0xD0, 0x00,
-    0x02, 0xF0, 0x02, 0xF0, 0x01, 0xF4, 0xBC, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x2F,
-    0x0B, 0xC0, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x01, 0xF4, 0x03, 0xF0, 0x7D, 0x00, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x0F, 0x80, 0x3E, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x0F, 0xD0,
-    0x2F, 0x43, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0xFC,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0xBD, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x3F, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3F,
-    0x03, 0xF0, 0x05, 0x40, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x3F, 0x00, 0x3F, 0x07, 0xD0,
-    0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x0B, 0xFF, 0x40, 0x2F, 0x00, 0x7E, 0x0F, 0xC3, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0x40, 0x2F, 0xFF, 0xD0, 0x1F, 0xC0, 0xFC, 0x2F, 0x47, 0xF0, 0xBF, 0x01, 0xFD,
-    0x1F, 0xC0, 0x3F, 0x47, 0xF0, 0x0F, 0xFF, 0xF8, 0x3E, 0x0F, 0xC0, 0x2F, 0x42, 0xF4, 0x0B, 0xD0,
-    0xBD, 0x01, 0xF8, 0x03, 0xFF, 0xE0, 0xBC, 0x0F, 0xC0, 0x1F, 0x83, 0xF0, 0x03, 0xE0, 0xFC, 0x00,
-    0xFC, 0x00, 0x6A, 0x40, 0xF8, 0x1F, 0x80, 0x0F, 0xC3, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x07,
-    0xD0, 0x1F, 0x40, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x1F,
-    0x40, 0x0F, 0xC7, 0xE0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x0F,
-    0xC3, 0xE0, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x0F, 0xC3, 0xE0,
-    0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x1F, 0x83, 0xF0, 0x03, 0xE0,
-    0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x2F, 0x42, 0xF4, 0x0B, 0xD0, 0xBD, 0x01,
-    0xF8, 0x00, 0x02, 0xF0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0xFD, 0x1F, 0xC0, 0x3F, 0x47, 0xF0, 0x00,
-    0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBF, 0xF4, 0x00, 0x2F, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x0F, 0xD0,
-    0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF4, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0xF8, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0xFD, 0x07, 0xF0, 0x01, 0xF8, 0x0F, 0xC0,
-    0x03, 0xF0, 0x1F, 0x80, 0x07, 0xD0, 0x2F, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x1F, 0x00, 0xB8, 0x00,
-    0x3E, 0x00, 0xF0, 0x00, 0x7C, 0x02, 0xD0, 0x00, 0x00, 0x2F, 0x40, 0xF8, 0x0B, 0xD0, 0x07, 0xF0,
-    0x2F, 0x40, 0xFC, 0x00, 0xFD, 0x03, 0xF0, 0x2F, 0x40, 0x1F, 0x80, 0xBC, 0x03, 0xF0, 0x03, 0xF0,
-    0x0F, 0x80, 0xBC, 0x00, 0x7D, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x3D, 0x02, 0xF0, 0x01, 0xF0,
-    0x0B, 0x80, 0x3D, 0x00, 0x3E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0xC0, 0x2D, 0x00, 0xF0, 0x00, 0xBD,
-    0x00, 0x0F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x01,
-    0xF0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0xBD, 0x07, 0xE0, 0x00, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F,
-    0x80, 0x03, 0xF0, 0x3F, 0x00, 0x07, 0xE0, 0x3E, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0x80, 0xF8,
-    0x00, 0x1F, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xE0, 0x00, 0x3C, 0x03, 0xC0, 0xBD, 0x07, 0xE0, 0x7E,
-    0x00, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0x02, 0xF8, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x03, 0xF0, 0x2F,
-    0x00, 0x07, 0xE0, 0x3E, 0x03, 0xE0, 0x00, 0xBC, 0x0B, 0xC0, 0xBC, 0x00, 0x0F, 0x80, 0xF8, 0x0F,
-    0x80, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x00, 0x3E, 0x02, 0xE0, 0x2E, 0x00, 0x03, 0xC0, 0x3C, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x3D, 0xF0, 0x00, 0x02, 0xE2, 0xE0, 0x00, 0x0F, 0x03, 0xC0, 0x00, 0xB8, 0x0B, 0x40, 0x03,
-    0xC0, 0x0F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0xF0, 0x00, 0x3C, 0x0B, 0x80, 0x00, 0xF4, 0x3D, 0x00,
-    0x01, 0xF0, 0x00, 0x05, 0x00, 0x00, 0xF8, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0xBF,
-    0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x02, 0xFC, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0x80,
-    0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0x90, 0x04, 0x00, 0x03, 0xE0, 0x00, 0x3F,
-    0x80, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xFC, 0x00, 0x2F,
-    0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0x40, 0x0F, 0xE0, 0x02, 0xFC, 0x00, 0x7F, 0x00, 0x00,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x01,
-    0x00, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xD0, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x03, 0xF8, 0x03,
-    0xF4, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x01, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x04,
-    0x0F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xC3, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0xFF,
-    0x00, 0x03, 0xFF, 0x40, 0x01, 0xFD, 0x1F, 0x40, 0x03, 0xFB, 0xF4, 0x00, 0x2E, 0x00, 0x00, 0x03,
-    0xF8, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x03, 0xF8, 0x00, 0x2E, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x01, 0xF8,
-    0x00, 0x07, 0xF8, 0x00, 0x07, 0xE0, 0x18, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xE3, 0xFC, 0x01, 0xFE, 0x3F, 0xC0, 0x0F, 0xE3,
-    0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x0F, 0xD2, 0xFC, 0x00, 0xFD, 0x2F, 0x80, 0x0F, 0xD2, 0xF8, 0x00,
-    0xFD, 0x2F, 0x80, 0x0F, 0xD2, 0xF8, 0x00, 0xFC, 0x1F, 0x80, 0x0F, 0xC1, 0xF4, 0x00, 0xFC, 0x1F,
-    0x40, 0x0B, 0xC1, 0xF4, 0x00, 0xBC, 0x1F, 0x40, 0x0B, 0xC0, 0xF4, 0x00, 0xBC, 0x0F, 0x40, 0x0B,
-    0xC0, 0xF0, 0x00, 0xBC, 0x0F, 0x00, 0x07, 0xC0, 0x50, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x06, 0x43, 0xFC, 0x01, 0xFE, 0x7F, 0xD0, 0x2F, 0xF3, 0xFD, 0x02, 0xFF,
-    0x3F, 0xC0, 0x1F, 0xE0, 0x50, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0x5F, 0xF4, 0x04, 0x3F, 0x02, 0xFC, 0x00, 0x3F, 0x00, 0xFD, 0x00,
-    0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0xBC, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x3F, 0x0F, 0xE0, 0x00, 0x3F, 0x7F, 0x40, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x7F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xAA, 0xAA, 0xAA, 0xA9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x93,
-    0xC0, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xBC, 0x00, 0x00, 0x00, 0xF4,
-    0x02, 0xF4, 0x00, 0x00, 0x7E, 0x00, 0x0B, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8,
-    0x00, 0x00, 0x7F, 0x95, 0x5B, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0x00,
-    0x1F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xBF, 0xC0, 0x00, 0x0F, 0x3D, 0x00, 0x02, 0xF1, 0xF0, 0x00, 0x3D, 0x0F, 0x00, 0x07, 0xC0,
-    0xB8, 0x00, 0xF4, 0x03, 0xC0, 0x1F, 0x00, 0x2D, 0x03, 0xE0, 0x01, 0xF0, 0x3C, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x41, 0xF0, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xAF, 0x6F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x56, 0xBF, 0xE9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x10, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x03, 0xE4, 0x0F, 0x41, 0xBE, 0x00, 0x0F, 0xE0, 0x2E, 0x01, 0xFC, 0x3F, 0xFE, 0xFA, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFB, 0xFB, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0x5B, 0xFE, 0x54, 0x00, 0x00, 0x05, 0x6F, 0xFE, 0x54, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x00,
-    0x00, 0x02, 0xF4, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0xBF, 0x00,
-    0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x03, 0xF8, 0x00, 0x07, 0x80, 0x0E, 0x00, 0x00,
-    0x00, 0x0B, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0xAA, 0x9B, 0xFF, 0xFE, 0xBF, 0xFF, 0xE1, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xFA, 0xA8, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0x00,
-    0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xAA, 0x83, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0xFD, 0x00, 0x0F,
-    0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0,
-    0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD3, 0xFF,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x3F,
-    0xFF, 0xD3, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFE, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFE, 0xFF, 0xF0, 0x7F, 0xFE, 0xFF, 0xF0, 0x2E, 0x00, 0x07, 0xF8, 0x3D, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x1F, 0xD3, 0xFF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x4F, 0xFF, 0xBF, 0xFC, 0x01, 0xFD, 0x2E, 0x00, 0x07, 0xF8, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0,
-    0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x00, 0x00,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x64, 0x00, 0x7F, 0x80, 0x00, 0x0B, 0xF4, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xE0, 0x00, 0x02, 0xFD,
-    0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x1B, 0xFF,
-    0xE0, 0x03, 0xFC, 0x0B, 0xFF, 0xFF, 0xF4, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xC0, 0x79,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xD2, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x8B, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD2,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF4, 0x1F, 0x40, 0x00, 0x00, 0xBF,
-    0x40, 0x7D, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x07, 0xD0, 0x00, 0x07,
-    0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x00,
-    0x07, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x05, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x07, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0x45, 0x55, 0x55, 0x56, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x2A, 0xAA, 0xA9, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x7E, 0xAF, 0xFF, 0xFF, 0x80,
-    0x78, 0x07, 0xFF, 0xFF, 0xE0, 0x78, 0x07, 0xFF, 0xFF, 0xF0, 0x78, 0x07, 0xFF, 0xFF, 0xF4, 0x78,
-    0x07, 0xFF, 0xFF, 0xF8, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07,
-    0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xFC, 0x78, 0x07, 0xFF,
-    0xFF, 0xFC, 0x78, 0x07, 0xFF, 0xFF, 0xF8, 0x78, 0x07, 0xFF, 0xFF, 0xF4, 0x78, 0x07, 0xFF, 0xFF,
-    0xF0, 0x78, 0x07, 0xFF, 0xFF, 0xD0, 0x78, 0x07, 0xFF, 0xFF, 0x40, 0x78, 0x07, 0xFF, 0xF8, 0x00,
-    0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78,
-    0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07,
-    0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80,
-    0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00,
-    0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x78, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF5, 0x7E, 0x3F, 0xFF,
-    0xFF, 0x80, 0xB9, 0xFF, 0xFF, 0xFE, 0x02, 0xEB, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF, 0xFF, 0xFF, 0xE0,
-    0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBB, 0xFF, 0xFF, 0xFE, 0x02, 0xEF, 0xFF, 0xFF, 0xF8, 0x0B, 0xBF,
-    0xFF, 0xFF, 0xE0, 0x2E, 0xFF, 0xFF, 0xFF, 0x80, 0xBA, 0xFF, 0xFF, 0xFE, 0x02, 0xE7, 0xFF, 0xFF,
-    0xF8, 0x0B, 0x8F, 0xFF, 0xFF, 0xE0, 0x2E, 0x2F, 0xFF, 0xFF, 0x80, 0xB8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x05, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF4, 0x2E, 0x57, 0xFF, 0xFF, 0xF0, 0xB8, 0x0B, 0xFF,
-    0xFF, 0xF2, 0xE0, 0x2F, 0xFF, 0xFF, 0xCB, 0x80, 0xBF, 0xFF, 0xFF, 0xAE, 0x02, 0xFF, 0xFF, 0xFE,
-    0xB8, 0x0B, 0xFF, 0xFF, 0xFE, 0xE0, 0x2F, 0xFF, 0xFF, 0xFB, 0x80, 0xBF, 0xFF, 0xFF, 0xEE, 0x02,
-    0xFF, 0xFF, 0xFF, 0xB8, 0x0B, 0xFF, 0xFF, 0xFE, 0xE0, 0x2F, 0xFF, 0xFF, 0xEB, 0x80, 0xBF, 0xFF,
-    0xFF, 0x6E, 0x02, 0xFF, 0xFF, 0xFC, 0xB8, 0x0B, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x1A, 0xAA, 0xAA, 0x94, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7,
-    0xE0, 0x00, 0x00, 0x2F, 0x4F, 0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0,
-    0x00, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0xFF, 0x07, 0xFD, 0x1F, 0xF0, 0x3F, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0xFF, 0x02, 0xFC,
-    0x03, 0xF4, 0x0F, 0xE0, 0x2F, 0x80, 0x3F, 0x00, 0xBC, 0x01, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0x6A,
-    0xA4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x95, 0x5B, 0xF0, 0x00, 0x1F, 0x80,
-    0x00, 0x0B, 0xD0, 0x07, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x2D, 0x00,
-    0x00, 0x00, 0x02, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x09, 0x3C, 0x00, 0x00,
-    0x00, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x2F, 0x40,
-    0x00, 0x07, 0xE0, 0x00, 0xBF, 0x40, 0x07, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01,
-    0xBF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x03, 0xE4, 0x0F, 0x40, 0x7E, 0x0F, 0xFF, 0x7E, 0xBF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x15,
-    0xAF, 0xFA, 0x55, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x00, 0x2F, 0x4F,
-    0xD0, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0xBF, 0x40,
-    0x00, 0x78, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6A, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF9, 0x03, 0xD0, 0x1F, 0x83,
-    0xFF, 0xDF, 0xAF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x05, 0x6B, 0xFE, 0x95, 0x40, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x00, 0x0B, 0xD3, 0xF4, 0x00, 0x00, 0x7F, 0x07, 0xF0,
-    0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x2F, 0xD0, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x7D, 0xBF, 0x80, 0x0B, 0xCB, 0xF8,
-    0x00, 0xFC, 0x7F, 0x40, 0x1F, 0x41, 0x40, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xC3, 0xF0, 0x02, 0xFE, 0x3E,
-    0x00, 0x2F, 0xEB, 0xD0, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2F, 0xFE, 0x90, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0xBF, 0xAA, 0xFF, 0xFF, 0xE4,
-    0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x6F, 0xFF, 0xFA, 0xAF, 0xF0, 0x2E, 0x00, 0x00, 0x00, 0x6F,
-    0xFF, 0xFF, 0xF4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFE, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xB8, 0x1E, 0x00, 0x00,
-    0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x02, 0x00, 0xBC, 0x02, 0x00, 0x0B, 0xC0, 0xBC,
-    0x0F, 0xC0, 0x03, 0xF0, 0xBC, 0x3F, 0x40, 0x00, 0xFC, 0xBC, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xAA, 0xAF, 0xFF, 0xEA, 0xA8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00,
-    0xFD, 0xBC, 0xFD, 0x00, 0x03, 0xF4, 0xBC, 0x3F, 0x00, 0x0B, 0xD0, 0xBC, 0x0F, 0xC0, 0x03, 0x40,
-    0xBC, 0x03, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x0F, 0xC0, 0xBD, 0x00, 0x7F, 0x03, 0xF4, 0x2F, 0x80, 0xFC, 0x00, 0xFD, 0x07, 0xE0,
-    0x3F, 0x02, 0xF4, 0x01, 0xF8, 0x0F, 0xC0, 0xBD, 0x03, 0xE0, 0x03, 0xF0, 0x1F, 0x40, 0xF8, 0x0B,
-    0xC0, 0x07, 0xD0, 0x3F, 0x02, 0xF0, 0x0F, 0x80, 0x0F, 0xC0, 0x7C, 0x03, 0xE0, 0x2F, 0x00, 0x1F,
-    0x00, 0xF8, 0x0B, 0xC0, 0x3D, 0x00, 0x3E, 0x01, 0xF0, 0x0F, 0x40, 0xB8, 0x00, 0x7C, 0x03, 0xD0,
-    0x2E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFE, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x01, 0xF8, 0x3F, 0xC3, 0xFD, 0x2F, 0xC0, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC3, 0xFC, 0x3F, 0xD2, 0xFC, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xD3, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0x2F, 0xD0, 0x60, 0x00, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xBD, 0x00, 0x04, 0x00, 0x01,
-    0xFD, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x02, 0xFE, 0x00, 0xBD, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00,
-    0xBD, 0x00, 0xFF, 0x40, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x7F, 0x00, 0x00, 0x10, 0x00, 0xBD, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0x02, 0xFE, 0x00,
-    0xBD, 0x00, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0xBD, 0x00, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0xBD, 0x00,
-    0xFF, 0x00, 0x00, 0x64, 0x00, 0xBD, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF8, 0x3F, 0xC7, 0xFD, 0x3F, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC3, 0xFD, 0x7F, 0xD3, 0xFC, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-    0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x02, 0xF8, 0x3F, 0xC7, 0xFD, 0x3F, 0xC1,
-    0xF4, 0x00, 0x00, 0x00, 0x0A, 0x03, 0xFC, 0x7F, 0xD3, 0xFD, 0x3F, 0xC0, 0x50, 0x00, 0x00, 0x00,
-    0x2F, 0x83, 0xFC, 0x7F, 0xD3, 0xFC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x3F, 0xC7, 0xFD, 0x3F,
-    0xD3, 0xFC, 0x05, 0x00, 0x7F, 0xFF, 0xD2, 0xAF, 0xA8, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x15, 0xF5, 0x47, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x7F, 0xFF, 0xD7, 0xAA, 0xAD, 0x70, 0x00, 0xD7, 0x00, 0x0D, 0x70, 0x00, 0xD7, 0x00,
-    0x0D, 0x75, 0x55, 0xD7, 0xFF, 0xFD, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC2, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0xBF, 0xE0, 0x03, 0xFC, 0x00, 0x2F, 0x80, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x01, 0xF4, 0x00, 0x3F, 0xC0, 0x07, 0xFD, 0x00, 0xFF, 0xF0, 0x2F, 0xFF, 0x83,
-    0xFF, 0xFC, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x2F,
-    0x80, 0x0B, 0xAE, 0x02, 0xD0, 0x78, 0x3C, 0x03, 0xC0, 0xF5, 0xF0, 0x03, 0xFC, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0xE0, 0x02, 0xAF, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x15, 0xF5, 0x47, 0xFF, 0xFD, 0x00, 0xF0,
-    0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-    0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-    0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-    0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF, 0xFD, 0x00, 0xFE,
-    0x6F, 0xC0, 0xBD, 0x01, 0xF8, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0B, 0xC3, 0xE0, 0x01, 0xF5, 0xF4,
-    0x00, 0x7D, 0x7D, 0x00, 0x1F, 0x4F, 0x40, 0x07, 0xD3, 0xE0, 0x01, 0xF4, 0xF8, 0x00, 0xBC, 0x3F,
-    0x00, 0x3F, 0x07, 0xE0, 0x2F, 0x80, 0xFF, 0xBF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00, 0x6A, 0x40, 0x00,
-    0x04, 0x3D, 0x3D, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00,
-    0x3D, 0xF8, 0x00, 0x3D, 0x7E, 0x00, 0x2F, 0x1F, 0x80, 0x1F, 0x07, 0xE0, 0x0F, 0x41, 0xF8, 0x0B,
-    0x80, 0x7E, 0x07, 0xE5, 0x6F, 0x96, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3,
-    0xE5, 0x55, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xEA, 0x90, 0x1F, 0xFF, 0xF4,
-    0x3A, 0x6F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x07,
-    0xEF, 0xE6, 0xBF, 0x3F, 0xFF, 0xF0, 0x1A, 0xA9, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x7F, 0xFF, 0x00,
-    0x7F, 0x90, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD2, 0xFE, 0x00,
-    0xFB, 0xFF, 0xF0, 0x3F, 0xD0, 0x7F, 0x0F, 0xC0, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x3D,
-    0x3E, 0x00, 0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0xFE, 0x6F, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6A, 0x40,
-    0x00, 0xAA, 0xAA, 0xA8, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0,
-    0x00, 0x05, 0x40, 0x00, 0x00, 0xBF, 0x90, 0x01, 0xFF, 0xFE, 0x00, 0xFD, 0x0B, 0xD0, 0xBC, 0x00,
-    0xF8, 0x2F, 0x00, 0x3E, 0x07, 0xE0, 0x1F, 0x40, 0xFE, 0x2F, 0x80, 0x0F, 0xFF, 0x80, 0x03, 0xFF,
-    0xF0, 0x03, 0xF4, 0xBF, 0x42, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x3E, 0x00, 0x1F, 0x0F, 0xC0,
-    0x0F, 0xC1, 0xFE, 0x6F, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x07, 0xF0, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x07, 0xC7,
-    0xC0, 0x01, 0xF1, 0xF4, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x4B, 0xF9, 0xBF, 0xD0, 0xBF, 0xFD, 0xF0,
-    0x02, 0xA4, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x25, 0xAF, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00,
-    0x2D, 0x00, 0x15, 0xB9, 0x52, 0xFF, 0xFF, 0xD6, 0xAF, 0xEA, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00,
-    0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x15, 0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x15,
-    0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDB,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x1F,
-    0x00, 0xBC, 0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x40, 0x3E,
-    0x00, 0x7C, 0x00, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x03,
-    0xD0, 0x0B, 0xC0, 0x0F, 0x40, 0x3E, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x01,
-    0xF0, 0x07, 0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF4, 0x0B, 0xC0, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xD0, 0xFB, 0xEB, 0xF4, 0xFD, 0x00, 0xBC, 0xF8, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0,
-    0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x01, 0xFF,
-    0xFD, 0x00, 0xFE, 0x6F, 0xC0, 0xBD, 0x01, 0xF8, 0x3F, 0x00, 0x3F, 0x0F, 0x80, 0x0B, 0xC3, 0xE0,
-    0x01, 0xF5, 0xF4, 0x00, 0x7D, 0x7D, 0x00, 0x1F, 0x4F, 0x40, 0x07, 0xD3, 0xE0, 0x01, 0xF4, 0xF8,
-    0x00, 0xBC, 0x3F, 0x00, 0x3F, 0x07, 0xE0, 0x2F, 0x80, 0xFF, 0xBF, 0xC0, 0x0F, 0xFF, 0xC0, 0x00,
-    0x6A, 0x40, 0x00, 0x00, 0x2A, 0x01, 0xFF, 0x0B, 0xFF, 0x3F, 0xAF, 0x3D, 0x2F, 0x10, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
-    0x2F, 0x00, 0x2F, 0x00, 0x15, 0x01, 0xFF, 0x90, 0x1F, 0xFF, 0xF4, 0x2F, 0x91, 0xFC, 0x08, 0x00,
-    0x7D, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x15, 0x55, 0x54, 0x02, 0xFF, 0x90, 0x0B, 0xFF, 0xFD, 0x03, 0xF4,
-    0x1F, 0xC0, 0x10, 0x01, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x1F, 0xC0, 0x0F,
-    0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3F, 0x04, 0x00, 0x1F, 0x87, 0xE9, 0x6F, 0xC1, 0xFF, 0xFF, 0xD0, 0x06, 0xAA, 0x40, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xBF, 0xE0, 0x00, 0x3D, 0xF8,
-    0x00, 0x3D, 0x7E, 0x00, 0x2F, 0x1F, 0x80, 0x1F, 0x07, 0xE0, 0x0F, 0x41, 0xF8, 0x0B, 0x80, 0x7E,
-    0x07, 0xE5, 0x6F, 0x96, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x50, 0x00, 0x2A, 0xAA, 0xA0, 0xFF, 0xFF, 0xC3, 0xE5, 0x55,
-    0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xEA, 0x90, 0x1F, 0xFF, 0xF4, 0x3A, 0x6F,
-    0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xFD, 0x00, 0x07, 0xEF, 0xE6,
-    0xBF, 0x3F, 0xFF, 0xF0, 0x1A, 0xA9, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0x90,
-    0x40, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD2, 0xFE, 0x00, 0xFB, 0xFF,
-    0xF0, 0x3F, 0xD0, 0x7F, 0x0F, 0xC0, 0x07, 0xD3, 0xD0, 0x00, 0xF4, 0xF4, 0x00, 0x3D, 0x3E, 0x00,
-    0x1F, 0x47, 0xD0, 0x0F, 0xC0, 0xFE, 0x6F, 0xD0, 0x0B, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0xAA,
-    0xAA, 0xA8, 0xFF, 0xFF, 0xFC, 0xAA, 0xAA, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF0, 0x00, 0x03,
-    0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0xBF, 0x90, 0x01, 0xFF, 0xFE, 0x00, 0xFD, 0x0B, 0xD0, 0xBC, 0x00, 0xF8, 0x2F,
-    0x00, 0x3E, 0x07, 0xE0, 0x1F, 0x40, 0xFE, 0x2F, 0x80, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x03,
-    0xF4, 0xBF, 0x42, 0xF0, 0x03, 0xF0, 0xF8, 0x00, 0xBC, 0x3E, 0x00, 0x1F, 0x0F, 0xC0, 0x0F, 0xC1,
-    0xFE, 0x6F, 0xD0, 0x2F, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0xBF, 0xFF, 0x40, 0xBE, 0x07, 0xF0, 0x3E, 0x00, 0x3E, 0x1F, 0x40, 0x07, 0xC7, 0xC0, 0x01,
-    0xF1, 0xF4, 0x00, 0x7D, 0x3F, 0x00, 0x3F, 0x4B, 0xF9, 0xBF, 0xD0, 0xBF, 0xFD, 0xF0, 0x02, 0xA4,
-    0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0xC0, 0x25, 0xAF, 0xC0, 0x0F, 0xFF,
-    0xC0, 0x02, 0xAA, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xD0, 0x00, 0x0B, 0x40, 0x00, 0x2D, 0x00,
-    0x15, 0xB9, 0x52, 0xFF, 0xFF, 0xD6, 0xAF, 0xEA, 0x00, 0x2D, 0x00, 0x00, 0xB4, 0x00, 0x02, 0xD0,
-    0x00, 0x0B, 0x40, 0x00, 0x15, 0x55, 0x52, 0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x15, 0x55, 0x52,
-    0xFF, 0xFF, 0xD6, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x0B, 0xC0, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xBC,
-    0x02, 0xE0, 0x0B, 0x80, 0x2E, 0x00, 0xB8, 0x02, 0xF0, 0x07, 0xC0, 0x0F, 0x40, 0x3E, 0x00, 0x7C,
-    0x00, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x0B,
-    0xC0, 0x0F, 0x40, 0x3E, 0x00, 0xBC, 0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xF0, 0x07,
-    0xC0, 0x2F, 0x00, 0xF8, 0x03, 0xD0, 0x1F, 0x00, 0xF4, 0x0B, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x01,
-    0xAA, 0x40, 0x3F, 0xFF, 0x80, 0x90, 0x1F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x78, 0x05, 0xAB, 0xE1,
-    0xFF, 0xFF, 0x9F, 0x40, 0x1E, 0xF8, 0x00, 0xBB, 0xD0, 0x03, 0xEB, 0xC0, 0x2F, 0x8F, 0xFF, 0xDE,
-    0x0B, 0xE4, 0x24, 0x00, 0x6A, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0x40, 0xF8, 0x3C, 0x00, 0x3C, 0x7C,
-    0x00, 0x3D, 0xBE, 0xAA, 0xBD, 0xBF, 0xFF, 0xFD, 0xB8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x40, 0x04, 0x0B, 0xFF, 0xFC, 0x00, 0xAF, 0xA0, 0x00, 0x6A, 0x40, 0x02, 0xFF, 0xFD,
-    0x01, 0xF4, 0x0B, 0xC0, 0xF4, 0x00, 0xBC, 0x7C, 0x00, 0x0F, 0x2E, 0x00, 0x03, 0xDB, 0x80, 0x00,
-    0xF6, 0xE0, 0x00, 0x3D, 0x7C, 0x00, 0x0F, 0x0F, 0x00, 0x07, 0xC2, 0xF0, 0x07, 0xD0, 0x2F, 0xFF,
-    0xD0, 0x00, 0xBE, 0x80, 0x00, 0x14, 0x00, 0x05, 0x0B, 0xC0, 0x0F, 0x40, 0xF8, 0x0B, 0x80, 0x0F,
-    0x47, 0xC0, 0x01, 0xF7, 0xC0, 0x00, 0x2F, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x02, 0xFE, 0x00, 0x01,
-    0xF3, 0xD0, 0x00, 0xF0, 0x7C, 0x00, 0xF4, 0x0B, 0xC0, 0xB8, 0x00, 0xF8, 0x28, 0x00, 0x0A, 0x00,
-    0x06, 0xA9, 0x00, 0x3F, 0xFF, 0xC0, 0x24, 0x02, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3D, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xB8, 0x00, 0x3C, 0x7C, 0x00, 0x7C, 0x3E, 0x01,
-    0xF4, 0x0F, 0xFF, 0xD0, 0x01, 0xBE, 0x00, 0x60, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x6A, 0x40, 0xF7, 0xFF, 0xF0, 0xFE, 0x01, 0xF8, 0xFC,
-    0x00, 0x7C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00,
-    0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xA0, 0x00, 0x28, 0x60, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x01, 0x4F, 0x00, 0x3D,
-    0x3C, 0x03, 0xD0, 0xF0, 0x3D, 0x03, 0xC3, 0xD0, 0x0F, 0x7D, 0x00, 0x3F, 0xFC, 0x00, 0xFC, 0xF8,
-    0x03, 0xC0, 0xF4, 0x0F, 0x01, 0xF4, 0x3C, 0x01, 0xF0, 0xF0, 0x02, 0xF2, 0x80, 0x02, 0x90, 0x63,
-    0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF2, 0x80, 0x50, 0x6A, 0x00,
-    0x6A, 0x43, 0xDF, 0xFF, 0x8F, 0xFF, 0xCF, 0xE0, 0x2F, 0xF0, 0x1F, 0x7F, 0x00, 0x3F, 0x00, 0x2E,
-    0xF4, 0x00, 0xB8, 0x00, 0x7F, 0xC0, 0x02, 0xE0, 0x01, 0xFF, 0x00, 0x0B, 0x40, 0x07, 0xFC, 0x00,
-    0x2D, 0x00, 0x1F, 0xF0, 0x00, 0xB4, 0x00, 0x7F, 0xC0, 0x02, 0xD0, 0x01, 0xFF, 0x00, 0x0B, 0x40,
-    0x07, 0xFC, 0x00, 0x2D, 0x00, 0x1F, 0xA0, 0x00, 0x64, 0x00, 0x24, 0x50, 0x6A, 0x40, 0xF3, 0xFF,
-    0xF0, 0xFE, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0xF4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xF0, 0x00, 0x3C,
-    0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xA0,
-    0x00, 0x28, 0x50, 0x6A, 0x40, 0xF3, 0xFF, 0xE0, 0xFE, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0xF4, 0x00,
-    0x3D, 0xF0, 0x00, 0x2E, 0xF0, 0x00, 0x2E, 0xF0, 0x00, 0x2E, 0xF4, 0x00, 0x3D, 0xFC, 0x00, 0x3C,
-    0xFE, 0x00, 0xF8, 0xFB, 0xFF, 0xF0, 0xF0, 0xBE, 0x40, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x06, 0xA9, 0x03, 0xFF, 0xFC, 0xB8, 0x01, 0x4F,
-    0x40, 0x00, 0xBC, 0x00, 0x03, 0xF9, 0x00, 0x07, 0xFE, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xD0, 0x00,
-    0x2E, 0x50, 0x03, 0xDB, 0xFF, 0xF8, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x74, 0x00,
-    0x7E, 0x54, 0xBF, 0xFF, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00,
-    0xF4, 0x00, 0x3D, 0x00, 0x0B, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFD, 0x5B, 0x80,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x2A, 0xAA, 0xA8, 0xBE,
-    0x00, 0x3F, 0xFF, 0xFC, 0xBE, 0x00, 0x3F, 0xFF, 0xFC, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x40, 0x00, 0x0F, 0xF4, 0x3F,
-    0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x05, 0xBF, 0xAA,
-    0xA4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xAA, 0xA8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x50, 0x00, 0x00,
-    0x0F, 0x42, 0xF0, 0x00, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x57, 0xD0, 0x00, 0x01, 0xFF,
-    0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFE, 0x5F, 0xFC, 0x01, 0xFF, 0xBC, 0x0F,
-    0x98, 0x03, 0xFC, 0x7C, 0x0F, 0x40, 0x0B, 0xF0, 0xBC, 0x0F, 0x00, 0x0F, 0xD0, 0xF8, 0x1F, 0x00,
-    0x2F, 0xC0, 0xF4, 0x2F, 0x00, 0x3F, 0x80, 0xF0, 0x3E, 0x00, 0x3F, 0x41, 0xF0, 0x3D, 0x00, 0x3F,
-    0x42, 0xE0, 0x3C, 0x00, 0x3F, 0x03, 0xE0, 0x7C, 0x00, 0x3F, 0x03, 0xD0, 0xBC, 0x00, 0x3F, 0x47,
-    0xC0, 0xF8, 0x00, 0x3F, 0x47, 0xC0, 0xF4, 0x00, 0x2F, 0x8B, 0x80, 0xF0, 0x00, 0x1F, 0xCF, 0x81,
-    0xF0, 0x00, 0x0F, 0xEF, 0x42, 0xF0, 0x00, 0x0B, 0xFF, 0x03, 0xE0, 0x00, 0x03, 0xFF, 0x03, 0xD0,
-    0x00, 0x01, 0xFF, 0xD7, 0xC0, 0x68, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7C, 0x6F, 0xFE, 0x40, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x0F, 0x00, 0x00, 0x00,
-    0xF4, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xF9, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0xAF, 0xF8, 0x03, 0xFE, 0x00, 0x02,
-    0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x05,
-    0x02, 0xA4, 0xFE, 0x00, 0xBC, 0xBF, 0xE3, 0xF4, 0x02, 0xFB, 0xFF, 0x8F, 0xD0, 0x0B, 0xFE, 0x44,
-    0x3F, 0x40, 0x2F, 0xE0, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x02, 0xF8, 0x02, 0xF8, 0x00, 0x0B, 0xF0,
-    0x0B, 0xD0, 0x00, 0x1F, 0xC0, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0xBD, 0x00, 0x00, 0xFF, 0x02, 0xF4,
-    0x00, 0x01, 0xFD, 0x0B, 0xD0, 0x00, 0x03, 0xFC, 0x2F, 0x40, 0x00, 0x07, 0xFD, 0xBD, 0x00, 0x40,
-    0x0B, 0xFF, 0xFA, 0xBF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0x15, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x3F, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x55, 0x55,
-    0x50, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xAA, 0xAA, 0xA4, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x7F, 0x55,
-    0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0xBF, 0xE0, 0x00, 0x3F, 0x80, 0x01, 0x90, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x55, 0xFE, 0x55, 0x54, 0x00,
-    0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x55, 0xFE, 0x55, 0x54, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x00, 0x7D, 0x55, 0x00, 0x0F, 0xC1, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x40, 0xFC, 0xBF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFE, 0x0F, 0xEF, 0x95, 0xBF, 0xFF, 0xE5, 0x6F, 0xF0, 0xFF, 0xD0, 0x00, 0xFF,
-    0xF0, 0x00, 0x7F, 0x8F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFC, 0xFF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xCF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F,
-    0xCF, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xCF,
-    0xD0, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0xD0,
-    0x01, 0xF7, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0x2F, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x03,
-    0xD3, 0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x00, 0xBC, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xD0, 0x0F, 0x43,
-    0xF0, 0x00, 0x00, 0xFC, 0xFD, 0x02, 0xF0, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x00, 0x03,
-    0xF0, 0x00, 0x2F, 0xF4, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0xC0, 0x03, 0xF0, 0x00, 0x2F, 0xBC, 0x00,
-    0x3F, 0x00, 0x02, 0xF7, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x3F, 0x00, 0x3F, 0x00, 0x02, 0xF2, 0xF4,
-    0x03, 0xF0, 0x06, 0xBF, 0xAF, 0xEA, 0xBF, 0xA8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x00, 0x2F, 0x03, 0xF0, 0x3F, 0x00, 0x02, 0xF0,
-    0x1F, 0x83, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x7F,
-    0x95, 0xBF, 0x7F, 0x54, 0x02, 0xF0, 0x03, 0xF3, 0xF0, 0x00, 0x2F, 0x00, 0x2F, 0x6F, 0x00, 0x02,
-    0xF0, 0x00, 0xFE, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x7F, 0xF0, 0x00,
-    0x2F, 0x00, 0x03, 0xFF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFF, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x14, 0x00, 0x3F, 0x00, 0x00, 0xFD, 0x03, 0xC0,
-    0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7C, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0x3F, 0x82, 0xFE, 0x54, 0x3F, 0x00, 0x0F, 0xF6, 0xFF, 0xFF, 0xD3, 0xF5, 0x6B, 0xFE, 0x3F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0xFC, 0x00, 0x3F, 0xA9,
-    0x40, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x53, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0xBF, 0xFA, 0x40, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xFE, 0x00, 0x05, 0x50, 0x3F, 0x40, 0x02, 0xF8, 0x03,
-    0xFF, 0xF8, 0xFD, 0x00, 0x0B, 0xE0, 0x3F, 0xFF, 0xF7, 0xF4, 0x00, 0x3F, 0x83, 0xFD, 0x1B, 0xCF,
-    0xD0, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x00, 0xBF,
-    0x41, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xFD, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x03, 0xF4,
-    0x0B, 0xF0, 0x00, 0x0B, 0xFF, 0x0F, 0xD0, 0x0F, 0xC0, 0x00, 0x02, 0xFF, 0x3F, 0x40, 0x3F, 0x80,
-    0x00, 0x02, 0xFD, 0xFD, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xFB, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x07,
-    0xEF, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0xBF, 0x40, 0x03, 0xF4, 0x50, 0x00, 0xFD, 0xFD, 0x00,
-    0x0B, 0xF2, 0xF9, 0x5F, 0xF3, 0xF4, 0x00, 0x0F, 0xDB, 0xFF, 0xFF, 0x4F, 0xD0, 0x00, 0x3F, 0x8B,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x3E, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0x4F,
-    0xC0, 0x01, 0xFE, 0x00, 0x0B, 0xC3, 0xF0, 0x00, 0xBF, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0xF0,
-    0x00, 0xFC, 0x2F, 0x40, 0x0F, 0xFC, 0x00, 0x3E, 0x07, 0xE0, 0x03, 0xDF, 0x40, 0x1F, 0x80, 0xF8,
-    0x01, 0xF3, 0xE0, 0x07, 0xD0, 0x3F, 0x00, 0x7C, 0xF8, 0x02, 0xF0, 0x0F, 0xC0, 0x2F, 0x2F, 0x00,
-    0xFC, 0x02, 0xF0, 0x0F, 0x87, 0xC0, 0x3F, 0x00, 0xBD, 0x03, 0xE1, 0xF4, 0x0F, 0xC0, 0x1F, 0x40,
-    0xF4, 0x3D, 0x03, 0xE0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF6, 0xBF, 0xAF, 0xEA, 0xFE, 0xBF, 0xA4, 0x0B, 0xC3, 0xE0, 0x1F, 0x0F, 0xC0, 0x02, 0xF0, 0xF8,
-    0x03, 0xD3, 0xE0, 0x00, 0x7D, 0x3D, 0x00, 0xF4, 0xF8, 0x00, 0x0F, 0x5F, 0x00, 0x3E, 0x3D, 0x00,
-    0x03, 0xE7, 0xC0, 0x0B, 0x9F, 0x40, 0x00, 0xFA, 0xF0, 0x02, 0xF7, 0xC0, 0x00, 0x2F, 0xB8, 0x00,
-    0x7E, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x40, 0x03, 0xFE, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x2F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x07,
-    0xF0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x3F, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F,
-    0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F,
-    0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03,
-    0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x7E,
-    0xFC, 0x03, 0xF0, 0x00, 0x00, 0xBE, 0xFC, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0xFC, 0x03, 0xF0, 0x00,
-    0x07, 0xF8, 0xFC, 0x03, 0xFA, 0xAA, 0xBF, 0xF0, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFC, 0x03,
-    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x15, 0x55, 0xBF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-    0x50, 0x07, 0xF0, 0x00, 0x1F, 0xFF, 0xD1, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0x00, 0x3F, 0xF9,
-    0x6F, 0xEF, 0xC0, 0x2F, 0xE0, 0x00, 0x7F, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFC, 0x07, 0xF4, 0x00,
-    0x00, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0x80, 0x00,
-    0x01, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x00,
-    0x07, 0xF0, 0x3F, 0x80, 0x00, 0x02, 0xFC, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x3F, 0x80, 0x00, 0x1F, 0xF0, 0x0B, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0xFF, 0xE5, 0xBF,
-    0xBF, 0x00, 0x0F, 0xFF, 0xFF, 0x4F, 0xC0, 0x00, 0x7F, 0xFF, 0x43, 0xF0, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAA, 0xAA, 0xAA,
-    0xA8, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0B, 0xFD, 0x00, 0x1F, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40,
-    0x05, 0xBF, 0x55, 0x55, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0x2B, 0xFE, 0xAA, 0xA8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x02, 0x00,
-    0x00, 0xFF, 0xFA, 0xAF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xE4, 0x00,
-    0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x40, 0x00, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x00, 0x00, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x80,
-    0x00, 0x00, 0x0F, 0xCB, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x16, 0xFF, 0xFF, 0xD5, 0x54, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x0B,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0,
-    0x07, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0xFC,
-    0x00, 0x07, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x04, 0x00, 0x00,
-    0x00, 0xFD, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0x5F, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x07,
-    0xFF, 0xD0, 0x30, 0x00, 0x0B, 0xFB, 0xF4, 0x7F, 0x00, 0x07, 0xF4, 0xFE, 0xBF, 0x40, 0x00, 0xE0,
-    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xCF, 0xD0, 0x00, 0x00, 0x0F, 0x83,
-    0xF4, 0x00, 0x00, 0x01, 0x40, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFE, 0xAF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x2F, 0x80, 0x01, 0x54, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xFF,
-    0x80, 0x00, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0xBF, 0xFF, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x01,
-    0xFE, 0x47, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x03, 0xF4, 0x02, 0xFC, 0x02, 0xF8, 0x00, 0x02,
-    0xFC, 0x07, 0xF0, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x0F, 0xD0, 0x00, 0xFC, 0x03, 0xF0,
-    0x00, 0x1F, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xBF, 0xC0, 0x0F, 0xC0, 0x03, 0xF8,
-    0x0B, 0xE0, 0x1B, 0xFF, 0x00, 0x1F, 0xC0, 0x0B, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xF5,
-    0x6F, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE4, 0x00, 0x00,
-    0x3F, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x00, 0x2F, 0x81, 0xF8, 0x00, 0x00, 0x1F, 0xC2,
-    0xF4, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x0F, 0xD7, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x10, 0x00, 0xFD, 0x00, 0x00, 0x38, 0x03, 0xFF, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0x40, 0x00, 0xFE,
-    0x0F, 0xEF, 0x80, 0x02, 0xFF, 0x6F, 0x4F, 0xC0, 0x03, 0xFF, 0xFF, 0x0B, 0xD0, 0x0B, 0xD7, 0xFC,
-    0x07, 0xF0, 0x0F, 0xC3, 0xF8, 0x03, 0xF0, 0x2F, 0x41, 0xF0, 0x02, 0xF8, 0x7F, 0x00, 0xA0, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x03, 0xAB, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x01, 0xFF,
-    0xFA, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0xC0, 0x0B, 0xFD, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF0, 0x05, 0x6F, 0xD5, 0x55, 0xBF, 0x94, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xAF, 0xEA, 0xAA, 0xBF, 0xE8, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x3F, 0xC0,
-    0x00, 0x1F, 0xEA, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x01, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x06, 0xFF, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0x93, 0xD0, 0x1F, 0x00, 0x3F, 0xF0, 0x0F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x3D, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0xBF,
-    0x00, 0x00, 0xFF, 0xFF, 0xFA, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xEB, 0xF0, 0x00, 0x0F, 0x40, 0x3F,
-    0x9F, 0xD0, 0x00, 0x3D, 0x00, 0xFE, 0x3F, 0x80, 0x00, 0xF4, 0x03, 0xF8, 0xFF, 0x00, 0x03, 0xD0,
-    0x0F, 0xE1, 0xFD, 0x00, 0x0F, 0x40, 0x3F, 0x83, 0xFD, 0x00, 0x3D, 0x00, 0xFE, 0x07, 0xFD, 0x00,
-    0xF4, 0x03, 0xF8, 0x0B, 0xFE, 0x03, 0xD0, 0x0F, 0xE0, 0x0B, 0xFF, 0xEF, 0xAB, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0x8F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x6A, 0xBF, 0xEA, 0xAF, 0xFA, 0xA4, 0x00, 0xFD, 0x00, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x3F,
-    0x40, 0x05, 0x7F, 0x95, 0x55, 0xFE, 0x54, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x00, 0x00, 0xBF, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xCF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xF4, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x55, 0x55, 0x5B, 0xFF, 0xD5, 0x00, 0x00, 0x1B, 0xFF, 0x40,
-    0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x6B, 0xFF, 0xEA, 0xAA, 0xAA,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0xAA, 0xAA, 0xAA, 0xA0, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x78, 0x00, 0xFF, 0xFA, 0xAB, 0xFE, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x40,
-    0x00, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xF4, 0xBC, 0x1B, 0x80,
-    0x3F, 0xE0, 0x2F, 0x00, 0x00, 0x2F, 0xE0, 0x0B, 0xC0, 0x00, 0x0F, 0xF0, 0x02, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF8, 0x00, 0x2F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x7F,
-    0x00, 0x02, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xFC,
-    0x00, 0x0B, 0xC0, 0x00, 0xBF, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0,
-    0x00, 0x2F, 0x00, 0x01, 0xFD, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x80, 0x02, 0xF0, 0x00, 0x0F, 0xF0,
-    0x00, 0xBC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xC0, 0x0B, 0xC0, 0x00, 0x07, 0xFC,
-    0x02, 0xF0, 0x00, 0x00, 0xBF, 0xE0, 0xBC, 0x01, 0x40, 0x0B, 0xFF, 0xFF, 0xAF, 0xD0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xFC, 0x00, 0x7F, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x05, 0xBF, 0x5A, 0xAF, 0xD5, 0x54, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-    0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x56, 0x00, 0x7F, 0x00, 0x07,
-    0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x1B, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x64, 0x0A, 0x80, 0x69, 0x00, 0xFD,
-    0x3F, 0xE7, 0xFF, 0x2F, 0xF8, 0x0B, 0xD3, 0x8F, 0xD0, 0xFF, 0x47, 0xC0, 0xBD, 0x38, 0xF8, 0x07,
-    0xD0, 0x2D, 0x0F, 0xD3, 0xCF, 0x40, 0x3C, 0x02, 0xD0, 0xFC, 0x1F, 0xF4, 0x03, 0xC0, 0x2D, 0x3F,
-    0x80, 0x7F, 0xE4, 0x3C, 0x02, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xAF,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF4, 0x07, 0xD5, 0x6D, 0x00, 0x00, 0x0F, 0x40, 0x3C, 0x02, 0xD0,
-    0x00, 0x00, 0xB4, 0x03, 0xC0, 0x2D, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xD2, 0xAF, 0xFF, 0xAA, 0xA4, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0x55, 0x5F, 0xE5, 0x50, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x01, 0xBE, 0x00, 0x00, 0x0F, 0xDB, 0xFF,
-    0x80, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xEF, 0xC0, 0x1B, 0x80, 0x02, 0x03, 0xF1, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03,
-    0xF5, 0xE0, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x3F, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x02, 0xFF, 0x00,
-    0x00, 0x3F, 0xAF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x2F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x40, 0x00,
-    0x00, 0xF4, 0x00, 0x03, 0xE0, 0xB8, 0x0B, 0x00, 0x2E, 0x00, 0x00, 0xF8, 0xFF, 0x8F, 0xF0, 0x0F,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x00, 0x0F, 0xFC, 0x2F, 0xD3, 0xFF, 0xF0, 0x00,
-    0x03, 0xFC, 0x03, 0xD0, 0x2F, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x00, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEA, 0xAF,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFE,
-    0x90, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xF9, 0x2F, 0x86, 0xFF, 0xC0, 0x0F, 0xF8, 0x02, 0xF8, 0x02, 0xFF, 0x01, 0xFD, 0x00, 0x2F,
-    0x80, 0x07, 0xF4, 0x3F, 0xC0, 0x02, 0xF8, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x2F, 0x80, 0x01, 0xFC,
-    0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0xBE, 0xBE, 0x00, 0x02,
-    0xF8, 0x00, 0x0B, 0xFB, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x01, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xF0, 0x00, 0x7F, 0xF0, 0x01, 0xFC, 0x00,
-    0x02, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00,
-    0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x0B, 0xFC, 0x1A, 0xFF, 0xFA, 0xFF,
-    0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xAB, 0xFA, 0xAA, 0x00,
-    0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xD5, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x57, 0xFF, 0xE0, 0x00, 0x2F, 0xE7, 0xC0, 0xFA,
-    0xFE, 0x00, 0x1F, 0xE1, 0xF0, 0x3E, 0x1F, 0xD0, 0x0F, 0xE0, 0x7C, 0x0F, 0x82, 0xFC, 0x0B, 0xF0,
-    0x1F, 0x03, 0xE0, 0x3F, 0x83, 0xF8, 0x07, 0xC0, 0xF8, 0x0B, 0xF0, 0xFD, 0x01, 0xF0, 0x3E, 0x01,
-    0xFC, 0x7F, 0x00, 0x7C, 0x0F, 0x80, 0x3F, 0x5F, 0xC0, 0x1F, 0x03, 0xE0, 0x0F, 0xEB, 0xF0, 0x07,
-    0xC0, 0xF8, 0x03, 0xFA, 0xFC, 0x01, 0xF0, 0x3D, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xA4, 0x29, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xF4, 0x3E, 0x00, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x7F, 0xFF,
-    0xBE, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x01, 0xBF, 0xE0,
-    0x7F, 0x00, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x47, 0xF0, 0x00,
-    0x03, 0xF4, 0x7F, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x01, 0xFD, 0x07,
-    0xF5, 0x56, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x55, 0x6F,
-    0xFD, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 0x7F, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x02, 0xFC, 0x7F,
-    0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x02, 0xFC, 0x7F, 0x00, 0x00, 0x2F, 0xC7, 0xF0, 0x00, 0x03,
-    0xFC, 0x7F, 0x00, 0x00, 0xBF, 0x87, 0xF0, 0x00, 0x2F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFD, 0x07, 0xFF,
-    0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xF4, 0x3E, 0x00,
-    0x00, 0x0F, 0x43, 0xE0, 0x00, 0x00, 0xA4, 0x29, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0x96, 0xBC, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x04, 0x03, 0xFF, 0x96, 0xBC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00,
-    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x2A, 0xAA, 0xAA, 0xA8, 0x2A, 0xAA, 0xAA, 0xAA, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x6A, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xEA, 0xBF, 0xFF,
-    0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x80, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x6F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t notosans_18_regularBitmaps[54263] = {
+    0x0A, 0xE1, 0xF1, 0xF1, 0xF1, 0xF1, 0xAE, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA, 0x19,
+    0xDA, 0x19, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x2D, 0x92, 0xD9, 0x2D, 0x3D, 0x39, 0x97,
+    0x79, 0x92, 0xF0, 0x9F, 0x90, 0xF9, 0x0F, 0x29, 0x91, 0x9E, 0x2A, 0xDA, 0x9E, 0x2A, 0xE9, 0xE2,
+    0xAD, 0xA9, 0xDA, 0x29, 0xDA, 0x0D, 0xA2, 0x9D, 0xA0, 0xDA, 0x29, 0xD9, 0x0D, 0xA3, 0xD9, 0x0D,
+    0x93, 0xD9, 0x0D, 0x93, 0xD1, 0xD9, 0x3D, 0x00, 0x70, 0xAC, 0xA4, 0xAC, 0xA7, 0x4E, 0x4D, 0xA7,
+    0x4D, 0xA4, 0xDA, 0x73, 0x9D, 0x94, 0xD9, 0x73, 0xAD, 0x49, 0xD7, 0x4A, 0xD4, 0xAD, 0x74, 0xE4,
+    0xE7, 0x4D, 0xA4, 0xDA, 0x6A, 0xFF, 0xFF, 0xF2, 0xAF, 0xFF, 0xFF, 0x91, 0x9A, 0xAA, 0xAE, 0xAA,
+    0xAA, 0xAE, 0xAA, 0xAA, 0xA7, 0xE4, 0xE7, 0x4D, 0xA4, 0xDA, 0x74, 0xD9, 0x4D, 0x97, 0x39, 0xD4,
+    0x9D, 0x97, 0x3A, 0xD4, 0xAD, 0x79, 0x99, 0x99, 0xE9, 0x99, 0x99, 0xE9, 0x99, 0x99, 0x2F, 0xFF,
+    0xFF, 0xC2, 0xFF, 0xFF, 0xFC, 0x6A, 0xD9, 0x39, 0xD9, 0x73, 0xAD, 0x4A, 0xD7, 0x4E, 0x4E, 0x74,
+    0xDA, 0x4D, 0xA7, 0x4D, 0xA4, 0xD9, 0x73, 0x9D, 0x93, 0x9D, 0x97, 0x39, 0xD4, 0xAD, 0x74, 0xAD,
+    0x4A, 0xD7, 0x00, 0x79, 0x97, 0x6A, 0xD7, 0x6A, 0xD7, 0x6A, 0xD7, 0x3A, 0xFF, 0xCA, 0x4A, 0xFF,
+    0xFC, 0x91, 0xAF, 0xFA, 0xFC, 0x2E, 0xA1, 0xAD, 0x29, 0xAA, 0x1A, 0xE2, 0xAD, 0x7A, 0xDA, 0x2A,
+    0xD7, 0xAD, 0xA2, 0xAD, 0x79, 0xE2, 0xAD, 0x70, 0xF9, 0x0A, 0xD7, 0x0A, 0xFF, 0x71, 0xAF, 0xEA,
+    0x97, 0x1A, 0xFF, 0xA7, 0x19, 0xFF, 0x97, 0x0A, 0xDA, 0xFC, 0x97, 0xAD, 0x19, 0xF7, 0xAD, 0x3E,
+    0x7A, 0xD3, 0xE9, 0x6A, 0xD3, 0xE9, 0x6A, 0xD2, 0x9E, 0x0A, 0xC9, 0x3A, 0xD1, 0xAE, 0xA0, 0xAF,
+    0xFF, 0xE1, 0xAF, 0xFF, 0xCA, 0x39, 0xAF, 0xFC, 0xA7, 0x3A, 0xD7, 0x6A, 0xD7, 0x6A, 0xD7, 0x6A,
+    0xD7, 0x77, 0x10, 0x77, 0x77, 0x9F, 0xA7, 0x2A, 0xD7, 0x9F, 0xE7, 0x1D, 0xA7, 0xE9, 0x0A, 0xE7,
+    0xAD, 0x79, 0xD9, 0x2A, 0xD6, 0x9D, 0xA7, 0xE4, 0xDA, 0x5E, 0x70, 0xE4, 0xDA, 0x49, 0xDA, 0x70,
+    0xDA, 0x4E, 0x4E, 0x71, 0xDA, 0x4E, 0x39, 0xD9, 0x71, 0xDA, 0x4E, 0x3E, 0x72, 0xDA, 0x4E, 0x2A,
+    0xD9, 0x72, 0xDA, 0x4E, 0x2D, 0xA2, 0x99, 0x95, 0xE4, 0xDA, 0x1A, 0xD1, 0x9F, 0xCA, 0x3A, 0xD3,
+    0x9D, 0x91, 0xDA, 0x09, 0xFE, 0xA3, 0xDA, 0x2E, 0x1E, 0x1E, 0x91, 0xE9, 0x2A, 0xEA, 0xEA, 0x09,
+    0xDA, 0x1D, 0xA3, 0xDA, 0x3F, 0xDA, 0x1E, 0x19, 0xD9, 0x3E, 0x49, 0xAA, 0xA2, 0x9D, 0x91, 0xAD,
+    0x4A, 0xD7, 0x3E, 0x2A, 0xD4, 0x9D, 0x97, 0x1A, 0xD9, 0x2E, 0x49, 0xD9, 0x71, 0xE3, 0xE4, 0x9D,
+    0x97, 0x0A, 0xD4, 0xAD, 0x49, 0xD9, 0x70, 0xDA, 0x4A, 0xD4, 0xAD, 0x70, 0xE5, 0x9D, 0x93, 0xE7,
+    0x9D, 0xA6, 0xDA, 0x3D, 0xA7, 0xE7, 0xAD, 0x91, 0xE9, 0x69, 0xD9, 0x70, 0xFE, 0xA7, 0xE7, 0x2F,
+    0xCA, 0x77, 0x70, 0x99, 0x40, 0x77, 0x77, 0x09, 0xFD, 0xA7, 0x71, 0xAF, 0xFC, 0x97, 0x6A, 0xFA,
+    0xAA, 0xF7, 0x6E, 0xA4, 0xEA, 0x74, 0x9E, 0x5A, 0xE7, 0x49, 0xDA, 0x59, 0xE7, 0x49, 0xE5, 0x9E,
+    0x75, 0xE5, 0xEA, 0x75, 0xEA, 0x3A, 0xE7, 0x69, 0xE9, 0x1A, 0xE9, 0x77, 0xAE, 0xAF, 0x97, 0x71,
+    0xFE, 0x97, 0x72, 0xAF, 0xC7, 0x72, 0x9F, 0xE9, 0x79, 0x99, 0x94, 0xAF, 0x9F, 0xA6, 0xE9, 0x3A,
+    0xF2, 0xFA, 0x5E, 0x4E, 0xA4, 0xFA, 0x3A, 0xE3, 0xAE, 0x6F, 0xA2, 0xE9, 0x3E, 0xA7, 0xFA, 0x09,
+    0xE4, 0xE9, 0x70, 0xFA, 0xE9, 0x4E, 0x97, 0x1A, 0xFD, 0x5E, 0xA7, 0x2F, 0xC6, 0xAE, 0x71, 0x9F,
+    0xCA, 0x59, 0xF9, 0x59, 0xFF, 0xA5, 0xAF, 0xCA, 0xAA, 0xAF, 0xD0, 0xAF, 0x5A, 0xFF, 0xF9, 0x2A,
+    0xF5, 0x9A, 0xFF, 0x95, 0xAF, 0x70, 0x99, 0x97, 0x70, 0x9E, 0x9E, 0x9E, 0x9D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0x5D, 0xA5, 0xE5, 0xAD, 0xA4, 0x9E, 0x5E, 0xA4, 0x9E,
+    0x5A, 0xDA, 0x5E, 0x94, 0x9E, 0x5A, 0xE5, 0xEA, 0x5E, 0x95, 0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x59,
+    0xE5, 0x9E, 0x59, 0xE5, 0x9E, 0x59, 0xE6, 0xE9, 0x5E, 0x95, 0xAD, 0xA5, 0x9E, 0x6E, 0x95, 0xEA,
+    0x59, 0xE6, 0xE9, 0x59, 0xE6, 0xEA, 0x6E, 0x69, 0xDA, 0x00, 0x9D, 0x95, 0xE5, 0x9E, 0x5E, 0xA4,
+    0x9E, 0x5E, 0xA4, 0x9E, 0x5E, 0x94, 0xEA, 0x4A, 0xE4, 0x9E, 0x5E, 0x94, 0xE9, 0x4E, 0xA4, 0xAD,
+    0xA4, 0xAD, 0xA4, 0xAD, 0xA4, 0xAD, 0xA4, 0xAD, 0xA4, 0xAD, 0xA4, 0xEA, 0x4E, 0x94, 0xE4, 0x9E,
+    0x4A, 0xDA, 0x4E, 0x93, 0x9E, 0x4E, 0xA4, 0xE4, 0xAD, 0xA3, 0x9E, 0x4E, 0x93, 0x9D, 0xA4, 0x69,
+    0xAA, 0xA7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x7D, 0xA7, 0x7D, 0xA7, 0x0D, 0xA9, 0x2D, 0x92,
+    0x9D, 0xA1, 0xFD, 0x9D, 0xAA, 0xFD, 0x09, 0xFF, 0xFF, 0xC2, 0x99, 0x9A, 0xAF, 0xAA, 0x99, 0x99,
+    0x79, 0xFC, 0x74, 0xE9, 0xDA, 0x72, 0xAD, 0x90, 0xE9, 0x70, 0x9E, 0x19, 0xE7, 0x0E, 0xA2, 0xF6,
+    0xF3, 0xAE, 0x96, 0x9C, 0xA4, 0xD7, 0x77, 0x70, 0x99, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77,
+    0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x70, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A,
+    0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x29, 0x99, 0x2A, 0xE2, 0xF2, 0xE9, 0x19, 0xE2, 0x9E,
+    0x2A, 0xD9, 0x2E, 0x3D, 0xA2, 0x9D, 0x30, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFA, 0xAF, 0xFA,
+    0x09, 0x99, 0x99, 0x99, 0x90, 0x19, 0x92, 0xF0, 0x9F, 0x90, 0xF9, 0x0F, 0x29, 0x91, 0x71, 0xAD,
+    0x97, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1A,
+    0xD9, 0x71, 0xE7, 0x19, 0xE7, 0x1E, 0x97, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A,
+    0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x1E, 0x97, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A,
+    0xDA, 0x71, 0xE7, 0x19, 0xE7, 0x10, 0x77, 0x70, 0xAF, 0xCA, 0x97, 0x09, 0xFF, 0xCA, 0x69, 0xFC,
+    0xAA, 0xFA, 0x5F, 0x49, 0xE9, 0x3A, 0xE6, 0xAE, 0x3E, 0x97, 0xE9, 0x19, 0xE7, 0x0A, 0xDA, 0x1A,
+    0xDA, 0x70, 0x9E, 0x1E, 0x97, 0x1E, 0x1E, 0x97, 0x1E, 0x90, 0xE9, 0x71, 0xE9, 0x0E, 0x72, 0xEA,
+    0x0E, 0x72, 0xAD, 0xA0, 0xE7, 0x2A, 0xDA, 0x0E, 0x72, 0xAD, 0xA0, 0xE7, 0x2E, 0xA0, 0xE7, 0x2E,
+    0x90, 0xE9, 0x71, 0xE9, 0x0E, 0x97, 0x1E, 0x90, 0xAD, 0xA7, 0x1E, 0x19, 0xE7, 0x09, 0xE2, 0xE9,
+    0x7E, 0xA2, 0xAE, 0x69, 0xE4, 0xEA, 0x49, 0xEA, 0x49, 0xFA, 0x9A, 0xAF, 0x6A, 0xFF, 0xD7, 0x09,
+    0xFE, 0xA7, 0x49, 0x99, 0x70, 0x6A, 0xD6, 0xF9, 0x39, 0xFC, 0x92, 0xAF, 0xD9, 0x1F, 0x9E, 0x99,
+    0xF9, 0x0E, 0x90, 0xE2, 0xE9, 0x09, 0xA3, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9,
+    0x6E, 0x96, 0xE9, 0x6E, 0x90, 0x77, 0x7A, 0xFD, 0xA9, 0x7A, 0xFF, 0xE4, 0x9F, 0xDA, 0xAF, 0xD3,
+    0xAE, 0xA5, 0xAE, 0xA3, 0xAA, 0x70, 0xAE, 0x77, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x75,
+    0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0x76, 0xEA, 0x75, 0xAE, 0x75, 0xAE, 0x75, 0xAE, 0x97, 0x4A, 0xE9,
+    0x74, 0xAE, 0x97, 0x4A, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xE9, 0x74,
+    0x9E, 0x97, 0x5F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0x77, 0x69, 0xAF,
+    0xE9, 0x69, 0xFF, 0xF4, 0xFE, 0xAA, 0xAF, 0xC3, 0xAD, 0xA9, 0x5A, 0xF3, 0xA9, 0x70, 0xAE, 0x77,
+    0xE9, 0x76, 0xE9, 0x76, 0xE9, 0x76, 0xE7, 0x6F, 0x75, 0xAE, 0x72, 0x99, 0xAF, 0x97, 0xFF, 0x97,
+    0x1F, 0xFA, 0x97, 0x0A, 0xAA, 0xAA, 0xFD, 0x76, 0xAF, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0xE9, 0x76,
+    0xE9, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xEA, 0x09, 0xC9, 0x70, 0x9F, 0x19, 0xFA, 0xA9, 0x99, 0xAF,
+    0xC9, 0x19, 0xFF, 0xFD, 0x93, 0x9A, 0xFF, 0xDA, 0x72, 0x99, 0x99, 0x70, 0x74, 0xEA, 0x77, 0xAF,
+    0x76, 0x9F, 0xC7, 0x6F, 0xD7, 0x5A, 0xD9, 0xE7, 0x49, 0xDA, 0x9E, 0x74, 0xE0, 0x9E, 0x73, 0xE9,
+    0x09, 0xE7, 0x2A, 0xDA, 0x19, 0xE7, 0x2E, 0x29, 0xE7, 0x1E, 0x92, 0x9E, 0x70, 0xAD, 0xA3, 0x9E,
+    0x79, 0xE4, 0x9E, 0x7E, 0x59, 0xE6, 0xAD, 0x95, 0x9E, 0x59, 0xDA, 0x69, 0xE5, 0xE7, 0x9E, 0x4E,
+    0x97, 0x9E, 0x4F, 0xFF, 0xFE, 0xA0, 0xFF, 0xFF, 0xEA, 0x0F, 0xFF, 0xFE, 0xA7, 0x49, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x30, 0x1F, 0xFF, 0xC9, 0x3F,
+    0xFF, 0xC9, 0x3F, 0xFF, 0xC9, 0x29, 0xE7, 0x59, 0xDA, 0x75, 0x9D, 0xA7, 0x59, 0xDA, 0x75, 0xAD,
+    0x97, 0x5A, 0xD9, 0x75, 0xAD, 0x97, 0x5E, 0x90, 0x99, 0x99, 0x70, 0xFF, 0xEA, 0x94, 0xFF, 0xFC,
+    0xA4, 0xCA, 0xA9, 0x99, 0x9A, 0xFC, 0xA7, 0x5F, 0x97, 0x5F, 0x75, 0x9E, 0x76, 0xE9, 0x75, 0xE9,
+    0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x74, 0x9E, 0x90, 0xAA, 0x70, 0x9F, 0x1A, 0xEA, 0xA9, 0x9A,
+    0xAF, 0xC2, 0xAF, 0xFF, 0xC4, 0x9F, 0xFD, 0x97, 0x19, 0x99, 0x97, 0x00, 0x77, 0x70, 0x9A, 0xFD,
+    0xA6, 0x9F, 0xFC, 0xA5, 0xAF, 0xCA, 0xAA, 0xAA, 0xA4, 0xAF, 0x73, 0x9E, 0xA7, 0x4E, 0xA7, 0x49,
+    0xE7, 0x5E, 0x97, 0x5E, 0x75, 0x9E, 0x75, 0xAD, 0xA2, 0x9A, 0xCA, 0xA9, 0x4A, 0xDA, 0x0A, 0xFF,
+    0x92, 0xE9, 0xAF, 0xFD, 0xA1, 0xFD, 0x94, 0xF9, 0x0F, 0xC7, 0xAE, 0x0F, 0x71, 0xE9, 0xEA, 0x71,
+    0xEA, 0xE9, 0x71, 0xAD, 0xAA, 0xD9, 0x71, 0xAD, 0xAA, 0xDA, 0x71, 0xAD, 0xA9, 0xE7, 0x1E, 0xA0,
+    0xE9, 0x70, 0xE9, 0x0A, 0xE7, 0xAE, 0x2F, 0x5A, 0xE9, 0x29, 0xFA, 0x99, 0xAF, 0xA4, 0x9F, 0xFD,
+    0xA7, 0xAF, 0xE9, 0x73, 0x99, 0x96, 0x9F, 0xFF, 0xFC, 0x99, 0xFF, 0xFF, 0xCA, 0x9F, 0xFF, 0xFC,
+    0xA7, 0x59, 0xE9, 0x75, 0xAE, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xE9, 0x75, 0x9E, 0x76, 0xEA, 0x75,
+    0x9E, 0x76, 0xAD, 0xA7, 0x6E, 0x76, 0xAE, 0x76, 0xE9, 0x75, 0xAE, 0x76, 0xE9, 0x75, 0xAE, 0x76,
+    0xEA, 0x75, 0x9E, 0x76, 0xEA, 0x75, 0x9E, 0x76, 0xF7, 0x59, 0xE9, 0x75, 0xF7, 0x6E, 0x97, 0x5A,
+    0xE7, 0x20, 0x77, 0x79, 0xAF, 0xDA, 0x70, 0xFF, 0xE9, 0x5F, 0xCA, 0xAA, 0xFC, 0x93, 0xAE, 0x95,
+    0xF3, 0xE9, 0x7E, 0x91, 0x9E, 0x70, 0xAD, 0xA1, 0x9E, 0x70, 0xAD, 0xA2, 0xE7, 0x0A, 0xDA, 0x2E,
+    0x97, 0xE9, 0x29, 0xE9, 0x5E, 0xA4, 0xAE, 0xA2, 0x9F, 0x6A, 0xFA, 0xFA, 0x70, 0x9F, 0xE9, 0x71,
+    0xAF, 0xEA, 0x70, 0xFA, 0xAF, 0xC9, 0x49, 0xF3, 0x9F, 0xA3, 0xEA, 0x6A, 0xE9, 0x1A, 0xE7, 0x0A,
+    0xE1, 0xE9, 0x71, 0xE9, 0x0E, 0x72, 0xAD, 0xA0, 0xE7, 0x2A, 0xDA, 0x0E, 0x72, 0xE9, 0x0E, 0xA7,
+    0x09, 0xE1, 0x9E, 0xA6, 0x9F, 0x2F, 0xCA, 0x99, 0x99, 0xAF, 0x4A, 0xFF, 0xF6, 0x9A, 0xFF, 0x97,
+    0x39, 0x99, 0x96, 0x77, 0x79, 0xAF, 0xCA, 0x71, 0xFF, 0xDA, 0x6F, 0xCA, 0xAA, 0xFA, 0x4A, 0xE9,
+    0x4A, 0xE9, 0x29, 0xE9, 0x6A, 0xE2, 0xAE, 0x70, 0xE9, 0x1E, 0x97, 0x09, 0xE1, 0xE7, 0x2E, 0x1E,
+    0x72, 0xE9, 0x0E, 0x72, 0xE9, 0x0E, 0x97, 0x1E, 0x90, 0xEA, 0x70, 0x9E, 0x90, 0xAE, 0x70, 0xF9,
+    0x1F, 0x59, 0xFC, 0x91, 0x9F, 0xCA, 0xAA, 0xE9, 0xE9, 0x29, 0xFF, 0xC9, 0x0E, 0x94, 0x9F, 0xCA,
+    0x2E, 0x76, 0x9E, 0x76, 0x9D, 0xA7, 0x6E, 0x97, 0x59, 0xE7, 0x6E, 0xA7, 0x5A, 0xE7, 0x5F, 0x95,
+    0xA9, 0x99, 0x9A, 0xFC, 0x96, 0xFF, 0xD9, 0x7F, 0xF9, 0x72, 0x99, 0x99, 0x72, 0x1A, 0xA2, 0xF0,
+    0x9F, 0x90, 0xF9, 0x0F, 0x29, 0x97, 0x77, 0x77, 0x77, 0x79, 0x92, 0xF0, 0x9F, 0x90, 0xF9, 0x0F,
+    0x29, 0x91, 0x2A, 0xA3, 0xF1, 0x9F, 0x90, 0x9F, 0x2F, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x19,
+    0x99, 0x3E, 0xA2, 0xE9, 0x19, 0xE2, 0xAE, 0x2E, 0x92, 0xE2, 0x9D, 0xA2, 0xAD, 0x3A, 0xCA, 0x30,
+    0x77, 0x09, 0x97, 0x69, 0xDA, 0x74, 0x9F, 0xA7, 0x29, 0xFC, 0xA7, 0x19, 0xFC, 0xA7, 0x19, 0xFC,
+    0xA7, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x97, 0x19, 0xFC, 0x97, 0x3F, 0x97, 0x5F, 0xA9, 0x75, 0xAF,
+    0xC9, 0x75, 0x9F, 0xCA, 0x75, 0x9F, 0xD9, 0x75, 0xAF, 0xCA, 0x75, 0xAF, 0xCA, 0x75, 0x9F, 0xA7,
+    0x69, 0xDA, 0x77, 0x19, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xFF, 0xFF, 0xC9,
+    0xFF, 0xFF, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x0A, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC, 0x9F, 0xFF, 0xFC, 0x00, 0x09, 0x77, 0x1D, 0x97, 0x7F, 0x97,
+    0x59, 0xFC, 0x97, 0x59, 0xFC, 0x97, 0x59, 0xFC, 0xA7, 0x59, 0xFC, 0xA7, 0x6A, 0xFA, 0x76, 0xAF,
+    0xA7, 0x6A, 0xEA, 0x74, 0xAF, 0xA7, 0x19, 0xAF, 0xC9, 0x70, 0x9F, 0xCA, 0x71, 0xAF, 0xCA, 0x70,
+    0x9F, 0xD9, 0x70, 0xAF, 0xCA, 0x97, 0x2F, 0xA7, 0x5D, 0xA7, 0x79, 0x77, 0x00, 0x77, 0x2A, 0xFE,
+    0xA4, 0xFF, 0xF9, 0x2F, 0xDA, 0xFD, 0x2A, 0xCA, 0x59, 0xEA, 0x73, 0x9E, 0x74, 0xE7, 0x4E, 0x97,
+    0x3E, 0x73, 0x9E, 0x73, 0xEA, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x2F, 0x72, 0xF7, 0x29, 0xE7, 0x3A,
+    0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x49, 0x99, 0x77, 0x77, 0x75, 0xA9, 0x73, 0x9E, 0xA7, 0x2A, 0xF7,
+    0x2A, 0xF7, 0x29, 0xEA, 0x74, 0xA9, 0x70, 0x73, 0x9A, 0xAD, 0xAA, 0x97, 0x72, 0xAF, 0xFF, 0x97,
+    0x5A, 0xFE, 0xAA, 0xFE, 0x73, 0xFA, 0x97, 0x9F, 0x97, 0x9E, 0xA7, 0x49, 0xE9, 0x6E, 0x97, 0x69,
+    0xE5, 0xE9, 0x77, 0x09, 0xE3, 0xAD, 0xA6, 0x99, 0x99, 0x99, 0x5A, 0xD9, 0x2E, 0x59, 0xFF, 0xC4,
+    0xDA, 0x1A, 0xD9, 0x4A, 0xFF, 0xD9, 0x3A, 0xD1, 0xE4, 0xAE, 0x93, 0xAD, 0x93, 0x9D, 0x1D, 0xA3,
+    0x9E, 0x5A, 0xD5, 0xD9, 0x9D, 0x93, 0xAD, 0x95, 0xAD, 0x5D, 0x9A, 0xD4, 0xE6, 0xAD, 0x5D, 0xAA,
+    0xD4, 0xDA, 0x6E, 0x5D, 0xAE, 0x39, 0xDA, 0x6E, 0x5D, 0x9E, 0x39, 0xDA, 0x6E, 0x49, 0xD0, 0xE4,
+    0xDA, 0x6E, 0x4A, 0xD0, 0xAD, 0x4E, 0x5A, 0xE4, 0xDA, 0x0A, 0xD4, 0xAD, 0xA3, 0x9F, 0x92, 0xAD,
+    0x19, 0xD9, 0x4F, 0x99, 0xAD, 0x9A, 0xDA, 0x9E, 0xA2, 0xDA, 0x49, 0xFE, 0x91, 0xFD, 0xA3, 0xE6,
+    0xAE, 0xA4, 0xAD, 0xA9, 0x49, 0xDA, 0x77, 0x72, 0xE9, 0x77, 0x72, 0xE9, 0x77, 0x71, 0x9F, 0x74,
+    0x97, 0x4F, 0xCA, 0x93, 0x99, 0xAE, 0x97, 0x4A, 0xFF, 0xFE, 0x97, 0x69, 0xFF, 0xDA, 0x97, 0x74,
+    0x99, 0x99, 0x75, 0x71, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE,
+    0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3,
+    0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD,
+    0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF,
+    0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA,
+    0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9,
+    0xEA, 0x77, 0xEA, 0x9F, 0xFC, 0xAA, 0x96, 0x9F, 0xFF, 0xD9, 0x39, 0xFF, 0xFF, 0x29, 0xE6, 0x9A,
+    0xFA, 0x19, 0xE7, 0x1F, 0x19, 0xE7, 0x19, 0xE9, 0x09, 0xE7, 0x2E, 0x90, 0x9E, 0x72, 0xE9, 0x09,
+    0xE7, 0x2E, 0x90, 0x9E, 0x71, 0xAE, 0x19, 0xE7, 0x09, 0xE9, 0x19, 0xE9, 0x99, 0x99, 0x99, 0xAF,
+    0x92, 0x9F, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x93, 0x9E, 0x99, 0x99, 0x99, 0x9A, 0xFC, 0x91, 0x9E,
+    0x71, 0xF1, 0x9E, 0x72, 0xF0, 0x9E, 0x72, 0xAE, 0x09, 0xE7, 0x29, 0xE9, 0x9E, 0x72, 0x9E, 0x99,
+    0xE7, 0x29, 0xE9, 0x9E, 0x72, 0xF0, 0x9E, 0x71, 0x9F, 0x09, 0xE7, 0x0A, 0xF1, 0x9F, 0xFF, 0xF9,
+    0x19, 0xFF, 0xFE, 0x92, 0x9F, 0xFF, 0xA9, 0x40, 0x77, 0x74, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC,
+    0x94, 0xFF, 0xFE, 0x39, 0xFC, 0x95, 0x9A, 0xCA, 0x3F, 0xA7, 0x6A, 0xEA, 0x77, 0xEA, 0x77, 0xAE,
+    0x77, 0x0E, 0xA7, 0x79, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70,
+    0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xE9, 0x77, 0x0E, 0xA7, 0x70, 0xF7, 0x70, 0xAE,
+    0x97, 0x70, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x70, 0x99, 0x4A, 0xFD, 0xAA, 0xAA, 0xF9, 0x5A,
+    0xFF, 0xFC, 0x97, 0xAF, 0xFD, 0xA7, 0x39, 0x99, 0x99, 0x50, 0x9F, 0xFC, 0xAA, 0x97, 0x19, 0xFF,
+    0xFD, 0x96, 0x9F, 0xFF, 0xF9, 0x49, 0xE5, 0x99, 0xAF, 0xC9, 0x39, 0xE7, 0x1A, 0xF9, 0x29, 0xE7,
+    0x29, 0xF2, 0x9E, 0x73, 0x9E, 0xA1, 0x9E, 0x74, 0xAE, 0x19, 0xE7, 0x49, 0xE9, 0x09, 0xE7, 0x5E,
+    0xA0, 0x9E, 0x75, 0xAE, 0x09, 0xE7, 0x5A, 0xE0, 0x9E, 0x75, 0x9E, 0x09, 0xE7, 0x59, 0xE0, 0x9E,
+    0x75, 0xAE, 0x09, 0xE7, 0x5A, 0xE0, 0x9E, 0x75, 0xAE, 0x09, 0xE7, 0x5E, 0xA0, 0x9E, 0x74, 0x9E,
+    0x90, 0x9E, 0x74, 0xF1, 0x9E, 0x73, 0x9E, 0xA1, 0x9E, 0x72, 0x9F, 0x29, 0xE7, 0x1A, 0xF9, 0x29,
+    0xE6, 0x9A, 0xFC, 0x93, 0x9F, 0xFF, 0xF9, 0x49, 0xFF, 0xFD, 0xA6, 0x9F, 0xFD, 0xAA, 0x97, 0x00,
+    0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF,
+    0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0,
+    0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x77, 0x76, 0x9A,
+    0xFF, 0xA9, 0x70, 0x9F, 0xFF, 0xE5, 0xAF, 0xFF, 0xEA, 0x4F, 0xCA, 0x96, 0x9D, 0x4F, 0xC7, 0x70,
+    0xAE, 0xA7, 0x71, 0xF7, 0x71, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0x9E, 0x77, 0x2A,
+    0xE7, 0x72, 0xAE, 0x77, 0x2A, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF,
+    0xAA, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0E, 0xA7, 0x5E, 0xA0, 0xF7, 0x5E, 0xA0, 0x9E, 0x97,
+    0x4E, 0xA1, 0xF9, 0x73, 0xEA, 0x19, 0xF9, 0x72, 0xEA, 0x2A, 0xFA, 0x71, 0xEA, 0x3A, 0xFD, 0xAA,
+    0xAA, 0xAA, 0xFC, 0xA4, 0x9F, 0xFF, 0xFA, 0x69, 0xAF, 0xFE, 0xA9, 0x73, 0x99, 0x99, 0x96, 0x9E,
+    0x75, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0,
+    0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74,
+    0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE0, 0x9F, 0xFF,
+    0xFF, 0x09, 0xFF, 0xFF, 0xF0, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x9E, 0x74,
+    0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09,
+    0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49,
+    0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9,
+    0x39, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5,
+    0x9A, 0xEA, 0x91, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x59, 0xDA, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE,
+    0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A,
+    0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5, 0xAE, 0x5A, 0xE5,
+    0xAE, 0x5A, 0xE5, 0xAD, 0xA5, 0xE9, 0x4F, 0x0F, 0xFA, 0x0F, 0xEA, 0x1A, 0xFA, 0x97, 0x40, 0x9E,
+    0x72, 0x9E, 0x90, 0x9E, 0x71, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x29, 0xE7, 0x0F, 0x39, 0xE7, 0xF4,
+    0x9E, 0x6F, 0x59, 0xE5, 0xAE, 0x69, 0xE4, 0xAE, 0x79, 0xE3, 0xAE, 0x97, 0x9E, 0x29, 0xE9, 0x70,
+    0x9E, 0x19, 0xE9, 0x71, 0x9E, 0x09, 0xEA, 0x72, 0x9E, 0x0F, 0xA7, 0x29, 0xFF, 0xC9, 0x71, 0x9F,
+    0xCA, 0xF7, 0x19, 0xF9, 0x09, 0xF7, 0x09, 0xE3, 0xAE, 0xA7, 0x9E, 0x4F, 0x96, 0x9E, 0x5F, 0x69,
+    0xE5, 0x9E, 0xA5, 0x9E, 0x6A, 0xE9, 0x49, 0xE7, 0xF4, 0x9E, 0x70, 0xF3, 0x9E, 0x70, 0x9E, 0xA2,
+    0x9E, 0x71, 0xAE, 0x91, 0x9E, 0x72, 0xF1, 0x9E, 0x73, 0xF0, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA,
+    0x9F, 0xFF, 0xDA, 0x9F, 0xA7, 0x7A, 0xF9, 0x9F, 0xC7, 0x7F, 0xC9, 0x9F, 0xC9, 0x75, 0x9F, 0xC9,
+    0x9F, 0xD7, 0x5F, 0xD9, 0x9D, 0xAE, 0x75, 0xFD, 0x99, 0xDA, 0xAD, 0xA7, 0x3A, 0xD9, 0xE9, 0x9D,
+    0xA9, 0xE7, 0x3E, 0x0E, 0x99, 0xDA, 0x0E, 0x97, 0x19, 0xDA, 0x0E, 0x99, 0xDA, 0x0A, 0xDA, 0x71,
+    0xE9, 0x0E, 0x99, 0xDA, 0x1E, 0x71, 0xE1, 0xE9, 0x9D, 0xA1, 0xE9, 0x7A, 0xDA, 0x1E, 0x99, 0xE1,
+    0x9E, 0x7E, 0x2E, 0x99, 0xE2, 0xE9, 0x59, 0xE2, 0xE9, 0x9E, 0x2A, 0xDA, 0x5A, 0xD9, 0x2E, 0x99,
+    0xE3, 0xE5, 0xE3, 0xE9, 0x9E, 0x3E, 0x93, 0x9D, 0xA3, 0xE9, 0x9E, 0x39, 0xE3, 0xE4, 0xE9, 0x9E,
+    0x4E, 0x3E, 0x4E, 0x99, 0xE4, 0xAD, 0xA1, 0xAD, 0x94, 0xE9, 0x9E, 0x49, 0xE1, 0xE5, 0xE9, 0x9E,
+    0x5E, 0x99, 0xDA, 0x5E, 0x99, 0xE5, 0xAD, 0xAA, 0xD9, 0x5E, 0x99, 0xE6, 0xFD, 0x6E, 0x99, 0xE6,
+    0xFC, 0xA6, 0xE9, 0x9E, 0x69, 0xF7, 0xE9, 0x9E, 0x7F, 0x7E, 0x99, 0xE7, 0xAD, 0x97, 0xE9, 0x9E,
+    0xA7, 0x5D, 0xA9, 0xF9, 0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29, 0xE9, 0xFD, 0x97,
+    0x19, 0xE9, 0xDA, 0xF7, 0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A, 0xE7, 0x09, 0xE9,
+    0xDA, 0x1F, 0x79, 0xE9, 0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6, 0x9E, 0x9D, 0xA3, 0xF5,
+    0x9E, 0x9E, 0x39, 0xE9, 0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3, 0x9E, 0x9E, 0x59, 0xE9,
+    0x29, 0xE9, 0xE6, 0xF2, 0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91, 0xE9, 0xE7, 0x0F, 0x1E,
+    0x9E, 0x70, 0x9E, 0xA0, 0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9, 0xE7, 0x29, 0xFD, 0x9E,
+    0x73, 0xAF, 0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF0, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x73, 0x9F,
+    0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74,
+    0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE,
+    0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE,
+    0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A,
+    0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC,
+    0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99,
+    0x71, 0x9F, 0xFA, 0xA9, 0x59, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xDA, 0x19, 0xE4, 0x99, 0xFC, 0x90,
+    0x9E, 0x79, 0xF0, 0x9E, 0x70, 0x9E, 0x99, 0xE7, 0x1E, 0xA9, 0xE7, 0x1F, 0x9E, 0x71, 0xAE, 0x9E,
+    0x71, 0xEA, 0x9E, 0x71, 0xE9, 0x9E, 0x70, 0xAE, 0x09, 0xE7, 0xAE, 0xA0, 0x9E, 0x99, 0x99, 0x9A,
+    0xAF, 0xC1, 0x9F, 0xFF, 0xCA, 0x29, 0xFF, 0xF9, 0x39, 0xEA, 0xAA, 0xAA, 0x99, 0x69, 0xE7, 0x59,
+    0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59,
+    0xE7, 0x50, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A,
+    0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A,
+    0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7,
+    0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9,
+    0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A,
+    0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F,
+    0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x9F, 0x77, 0x49, 0xF7, 0x74, 0xAF, 0x77, 0x4A,
+    0xF7, 0x74, 0xFC, 0x77, 0x4F, 0xA7, 0x74, 0x99, 0x99, 0x10, 0x9F, 0xFA, 0xA9, 0x96, 0x9F, 0xFF,
+    0xC9, 0x49, 0xFF, 0xFE, 0x39, 0xE5, 0x9A, 0xFA, 0x29, 0xE7, 0x0F, 0x29, 0xE7, 0x1E, 0xA1, 0x9E,
+    0x71, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0x9E, 0x71, 0xAD, 0xA1, 0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1E,
+    0x91, 0x9E, 0x70, 0xF2, 0x9E, 0x69, 0xF9, 0x29, 0xFF, 0xFD, 0x93, 0x9F, 0xFF, 0xA5, 0x9F, 0xFE,
+    0xA6, 0x9E, 0x49, 0xE9, 0x59, 0xE5, 0xAE, 0x59, 0xE6, 0xEA, 0x49, 0xE6, 0xAE, 0x49, 0xE7, 0xF3,
+    0x9E, 0x79, 0xE9, 0x29, 0xE7, 0x0F, 0x29, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xAE, 0x19, 0xE7, 0x2F,
+    0x09, 0xE7, 0x29, 0xE9, 0x77, 0x69, 0xAF, 0xEA, 0x95, 0xFF, 0xFC, 0x29, 0xFF, 0xFD, 0x2F, 0xA5,
+    0x9A, 0xC9, 0x19, 0xE9, 0x74, 0xAE, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xAE, 0x75, 0x9E, 0xA7,
+    0x5F, 0xC7, 0x5F, 0xCA, 0x97, 0x3F, 0xEA, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xE9, 0x73, 0xAF, 0xC9,
+    0x74, 0xAF, 0x75, 0x9E, 0x97, 0x5E, 0xA7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xE9, 0x0C,
+    0xA7, 0x09, 0xF1, 0xFC, 0xAA, 0xAA, 0xAF, 0xC2, 0xFF, 0xFD, 0x39, 0xAF, 0xFD, 0x97, 0x19, 0x99,
+    0x97, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFE, 0x97, 0x9E, 0x97, 0x79, 0xE7,
+    0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E,
+    0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x00, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F,
+    0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99,
+    0x97, 0xAD, 0xA7, 0x6E, 0x9A, 0xE7, 0x5A, 0xE1, 0xE9, 0x74, 0xEA, 0x1E, 0xA7, 0x4E, 0x91, 0x9E,
+    0x73, 0xAE, 0x3E, 0x97, 0x2E, 0xA3, 0xEA, 0x71, 0x9E, 0x93, 0x9E, 0x71, 0xAE, 0x5E, 0x97, 0x0E,
+    0xA5, 0xAE, 0x79, 0xE6, 0x9E, 0x7A, 0xE7, 0xE9, 0x6E, 0x97, 0xAE, 0x59, 0xE7, 0x09, 0xE5, 0xAE,
+    0x71, 0xEA, 0x4E, 0x97, 0x1A, 0xE3, 0x9E, 0x73, 0xE3, 0xEA, 0x73, 0xEA, 0x2E, 0x97, 0x39, 0xE1,
+    0x9E, 0x75, 0xE9, 0x0E, 0xA7, 0x5E, 0xA0, 0xE9, 0x75, 0x9E, 0x9E, 0x77, 0xEA, 0xDA, 0x77, 0xAF,
+    0xC7, 0x70, 0x9F, 0xC7, 0x71, 0xF9, 0x77, 0x1A, 0xE7, 0x10, 0x9E, 0x72, 0x9E, 0x73, 0xE1, 0xE9,
+    0x71, 0xF9, 0x71, 0x9E, 0x1E, 0xA7, 0x1F, 0xA7, 0x1A, 0xE1, 0xAE, 0x70, 0x9F, 0xC7, 0x1E, 0xA1,
+    0x9E, 0x70, 0xAF, 0xC9, 0x70, 0xE9, 0x2E, 0x97, 0xE9, 0xDA, 0x79, 0xE3, 0xEA, 0x69, 0xE0, 0xE7,
+    0xAD, 0xA3, 0xAE, 0x6A, 0xDA, 0x0E, 0x7E, 0x93, 0x9E, 0x6E, 0x90, 0xAD, 0xA6, 0xE5, 0xE9, 0x5E,
+    0x19, 0xE5, 0x9E, 0x5E, 0xA4, 0x9D, 0xA2, 0xE5, 0xAD, 0xA5, 0xAE, 0x4A, 0xD9, 0x2E, 0x94, 0xE9,
+    0x59, 0xE4, 0xE3, 0x9E, 0x39, 0xE7, 0xE9, 0x29, 0xE4, 0xE3, 0xAE, 0x7E, 0xA2, 0xAD, 0xA4, 0xE9,
+    0x2E, 0xA7, 0xAE, 0x2E, 0x94, 0xAD, 0xA2, 0xE9, 0x70, 0xE2, 0xE5, 0x9E, 0x19, 0xE7, 0x1E, 0x90,
+    0x9D, 0xA6, 0xE1, 0xAE, 0x71, 0xAD, 0xA0, 0xAD, 0x96, 0xAD, 0xA0, 0xEA, 0x71, 0x9E, 0x0E, 0x79,
+    0xE0, 0xE9, 0x72, 0xE0, 0xE7, 0x0E, 0x0E, 0x73, 0xEA, 0xDA, 0x70, 0xEA, 0xDA, 0x73, 0xAF, 0xC9,
+    0x70, 0x9F, 0xC9, 0x73, 0x9F, 0xC7, 0x2F, 0xC7, 0x5F, 0xA7, 0x2F, 0xC7, 0x5F, 0x97, 0x2A, 0xEA,
+    0x75, 0xAE, 0x73, 0x9E, 0x96, 0x0A, 0xDA, 0x73, 0x9D, 0xA1, 0x9E, 0x97, 0x2E, 0x92, 0xF7, 0x1E,
+    0xA4, 0xEA, 0x79, 0xE5, 0xAE, 0x7E, 0x96, 0xF5, 0xAE, 0x70, 0xE9, 0x39, 0xE7, 0x1A, 0xE3, 0xE9,
+    0x72, 0xEA, 0x1A, 0xE7, 0x39, 0xE9, 0x0E, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77, 0x9F, 0x77, 0x09,
+    0xF9, 0x77, 0xFD, 0x76, 0xAF, 0xDA, 0x75, 0xE0, 0x9E, 0x74, 0xEA, 0x1F, 0x72, 0x9E, 0x3E, 0x97,
+    0x1E, 0x93, 0xAE, 0x70, 0xAD, 0xA5, 0xEA, 0x69, 0xE6, 0x9E, 0x95, 0xEA, 0x7A, 0xE4, 0xAE, 0x71,
+    0xEA, 0x29, 0xE9, 0x71, 0xAE, 0x2E, 0xA7, 0x3F, 0x0A, 0xE7, 0x49, 0xEA, 0xAD, 0xA7, 0x49, 0xDA,
+    0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE, 0x3E, 0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAE, 0x5E, 0x97,
+    0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E, 0x97, 0xAE, 0x4E, 0xA7, 0x1E, 0xA2, 0x9E, 0x72, 0x9E,
+    0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E, 0x0E, 0xA7, 0x5F, 0xE7, 0x69, 0xFC, 0x97, 0x7F, 0xC7,
+    0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71,
+    0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x70, 0x0F, 0xFF, 0xFC, 0x90,
+    0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x5F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E,
+    0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE,
+    0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F,
+    0x75, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xFF, 0x9F, 0xF9, 0xFF, 0x9E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0xF9, 0xFF, 0x9F, 0xF9, 0x9D, 0xA7,
+    0x2E, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x2A, 0xDA, 0x71, 0x9E, 0x72, 0xE9, 0x71, 0xAD, 0xA7,
+    0x2E, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x2A, 0xDA, 0x71, 0x9E, 0x72, 0xE9, 0x71, 0xAD, 0xA7,
+    0x2E, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xE7, 0x2A, 0xDA, 0x71, 0x9E, 0x72, 0xE9, 0x71, 0xAD, 0xA7,
+    0x2E, 0x72, 0xE9, 0x0F, 0xF9, 0x0F, 0xF9, 0x0F, 0xF9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E,
+    0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95,
+    0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9,
+    0x5E, 0x90, 0xFF, 0x90, 0xFF, 0x90, 0xFF, 0x90, 0x7D, 0x97, 0x79, 0xE7, 0x7F, 0xA7, 0x59, 0xFC,
+    0x75, 0xAD, 0x0D, 0xA7, 0x4D, 0x90, 0xAD, 0x73, 0xAD, 0x2D, 0xA7, 0x2D, 0xA2, 0xAD, 0x71, 0xAD,
+    0x4D, 0xA7, 0x0D, 0xA4, 0xAD, 0x7A, 0xD6, 0xDA, 0x6E, 0x6A, 0xD5, 0x9D, 0x97, 0xDA, 0x4E, 0x70,
+    0xAD, 0x39, 0xD9, 0x71, 0xDA, 0x2E, 0x72, 0xAD, 0x90, 0x9D, 0xA7, 0x3E, 0x00, 0x0A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFA, 0x0F, 0xFF, 0xFA, 0x9A, 0xAA, 0x94, 0xF5,
+    0xEA, 0x5E, 0x95, 0xE6, 0xE6, 0x99, 0x00, 0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3,
+    0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A,
+    0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7,
+    0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99,
+    0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x9A, 0xA7, 0x6E, 0x97,
+    0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x93, 0x99, 0x99,
+    0x5E, 0x90, 0x9F, 0xEA, 0x3E, 0x9A, 0xFF, 0xD2, 0xFE, 0x99, 0x99, 0xFC, 0x1F, 0xC9, 0x59, 0xEA,
+    0x0F, 0x97, 0xAE, 0x0F, 0x71, 0xE9, 0xF7, 0x1E, 0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x19, 0xFD, 0x97,
+    0x19, 0xFD, 0x97, 0x19, 0xFD, 0xA7, 0x19, 0xFD, 0xA7, 0x1A, 0xFE, 0x71, 0xEA, 0xF7, 0x1E, 0x9F,
+    0xA7, 0xAE, 0x0F, 0xC9, 0x5A, 0xEA, 0x0E, 0xAE, 0xA9, 0x9A, 0xFC, 0x1E, 0x0A, 0xFF, 0xD2, 0xDA,
+    0x19, 0xFE, 0xA7, 0x39, 0x99, 0x60, 0x69, 0x99, 0x99, 0x69, 0xFF, 0xC9, 0x2A, 0xFF, 0xD9, 0x1A,
+    0xFA, 0x99, 0x9A, 0xD1, 0x9E, 0xA7, 0x1F, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x29, 0xF6,
+    0x92, 0xAF, 0xAA, 0x9A, 0xAD, 0x92, 0xAF, 0xFD, 0x93, 0x9A, 0xFE, 0xA7, 0x09, 0x99, 0x30, 0x76,
+    0xAA, 0x97, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE5,
+    0x99, 0x99, 0x39, 0xE3, 0xAF, 0xE9, 0x09, 0xE2, 0xFF, 0xDA, 0x9E, 0x1F, 0xC9, 0x99, 0x9A, 0xFD,
+    0x0A, 0xEA, 0x59, 0xFC, 0x0E, 0xA7, 0xAF, 0x9E, 0x71, 0xFA, 0xE7, 0x1F, 0xEA, 0x71, 0xAF, 0xDA,
+    0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0xAE, 0xAE, 0x71,
+    0xAE, 0x9E, 0x71, 0xF0, 0xEA, 0x79, 0xF0, 0xAE, 0xA5, 0x9F, 0xC1, 0xFC, 0xA9, 0x9A, 0xEA, 0xE2,
+    0xFF, 0xD9, 0x0E, 0x39, 0xFE, 0x91, 0xE6, 0x99, 0x97, 0x69, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF,
+    0xFD, 0x94, 0xAF, 0x90, 0x99, 0xF9, 0x29, 0xE9, 0x5A, 0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE,
+    0x0A, 0xE7, 0x09, 0xE0, 0xAD, 0xA7, 0x09, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0E, 0xA7, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59,
+    0xF7, 0x09, 0x92, 0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x71, 0x99,
+    0x99, 0x50, 0x79, 0xAA, 0xAA, 0x96, 0xAF, 0xE9, 0x4A, 0xFF, 0x5F, 0x29, 0x94, 0xAE, 0x72, 0xAD,
+    0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x9A, 0xFF, 0xC9, 0x19, 0xFF, 0xE9, 0x29, 0x99, 0xEA,
+    0x99, 0x99, 0x6E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x96, 0x59, 0x99, 0x97, 0x3A, 0xFE, 0x91, 0xE2, 0xFF, 0xDA, 0x0E, 0x1F, 0xC9,
+    0x99, 0x9E, 0xAE, 0x09, 0xEA, 0x59, 0xFC, 0x0E, 0xA7, 0xAF, 0x9E, 0x71, 0xFA, 0xE7, 0x1A, 0xFD,
+    0xA7, 0x1A, 0xFD, 0xA7, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0xA7, 0x19, 0xFD, 0xA7,
+    0x19, 0xEA, 0xE7, 0x1A, 0xE9, 0xE7, 0x1F, 0x0E, 0xA7, 0x9F, 0x09, 0xEA, 0x59, 0xFC, 0x1F, 0xC9,
+    0x99, 0x9F, 0xE2, 0xFF, 0xDA, 0x9E, 0x39, 0xFE, 0x90, 0x9E, 0x69, 0x99, 0x39, 0xE7, 0x59, 0xE7,
+    0x5A, 0xDA, 0x75, 0xE9, 0x74, 0xAE, 0x19, 0xCA, 0x96, 0xAE, 0xA1, 0x9F, 0xDA, 0xFE, 0x29, 0xFF,
+    0xFA, 0x59, 0xAF, 0xEA, 0x40, 0x9A, 0xA7, 0x6E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E,
+    0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x93, 0x99, 0x99, 0x5E, 0x90, 0x9F, 0xF9, 0x2E, 0x9A, 0xFF,
+    0xD9, 0x1E, 0xAE, 0xA9, 0x99, 0xAF, 0x1F, 0xC9, 0x59, 0xEA, 0x0F, 0xA7, 0xAE, 0x0F, 0x70, 0x9E,
+    0x0F, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9,
+    0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71,
+    0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0x1A, 0xA1, 0xEA, 0x0F, 0x0E, 0xA1,
+    0xA9, 0x77, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90,
+    0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9,
+    0x6A, 0xA6, 0xEA, 0x5F, 0x5E, 0xA6, 0xA9, 0x77, 0x77, 0x4E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E,
+    0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95,
+    0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x94, 0xAE,
+    0x1F, 0xEA, 0x1F, 0xE2, 0xAF, 0xA2, 0x9A, 0xA7, 0x5E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x96, 0x9E, 0xA0, 0xE9, 0x59, 0xEA, 0x1E,
+    0x95, 0xEA, 0x2E, 0x94, 0xEA, 0x3E, 0x93, 0xEA, 0x4E, 0x92, 0xF5, 0xE9, 0x1F, 0x6E, 0x90, 0xF7,
+    0xE9, 0xAE, 0x70, 0xEA, 0xFA, 0x7F, 0xFC, 0xA6, 0xFA, 0x0A, 0xE9, 0x5E, 0xA2, 0xF5, 0xE9, 0x3F,
+    0x4E, 0x93, 0x9E, 0xA3, 0xE9, 0x4A, 0xE9, 0x2E, 0x95, 0xF2, 0xE9, 0x6F, 0x1E, 0x96, 0x9E, 0xA0,
+    0xE9, 0x7A, 0xE9, 0x9A, 0xA0, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9,
+    0xE9, 0x79, 0x99, 0x97, 0x99, 0x99, 0x5E, 0x19, 0xFE, 0xA3, 0xAF, 0xE9, 0x2E, 0x0A, 0xFF, 0xCA,
+    0x1F, 0xFD, 0xA1, 0xEA, 0xDA, 0x99, 0x9A, 0xF9, 0xEA, 0x99, 0x9A, 0xF1, 0xFC, 0x95, 0xFD, 0x59,
+    0xEA, 0x0F, 0x96, 0x9F, 0x7A, 0xE0, 0xF7, 0x0E, 0xA7, 0x9E, 0x0F, 0x70, 0xE9, 0x79, 0xE0, 0xEA,
+    0x70, 0xE9, 0x70, 0xE0, 0xEA, 0x70, 0xE7, 0x1E, 0x0E, 0x97, 0x0E, 0x71, 0xE0, 0xE9, 0x70, 0xE7,
+    0x1E, 0x0E, 0x97, 0x0E, 0x71, 0xE0, 0xE9, 0x70, 0xE7, 0x1E, 0x0E, 0x97, 0x0E, 0x71, 0xE0, 0xE9,
+    0x70, 0xE7, 0x1E, 0x0E, 0x97, 0x0E, 0x71, 0xE0, 0xE9, 0x70, 0xE7, 0x1E, 0x0E, 0x97, 0x0E, 0x71,
+    0xE0, 0xE9, 0x70, 0xE7, 0x1E, 0x0E, 0x97, 0x0E, 0x71, 0xE0, 0x79, 0x99, 0x95, 0xE1, 0x9F, 0xF9,
+    0x2E, 0x0A, 0xFF, 0xD9, 0x1E, 0xAE, 0x99, 0x99, 0xAF, 0x1F, 0xC9, 0x59, 0xEA, 0x0F, 0xA7, 0xAE,
+    0x0F, 0x70, 0x9E, 0x0F, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9,
+    0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71,
+    0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0x69, 0x99, 0x99,
+    0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70,
+    0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72,
+    0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A,
+    0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE,
+    0xA7, 0x49, 0x99, 0x70, 0x79, 0x99, 0x95, 0xE1, 0x9F, 0xEA, 0x3E, 0x0A, 0xFF, 0xD2, 0xEA, 0xE9,
+    0x99, 0x9F, 0xC1, 0xFC, 0x95, 0x9E, 0xA0, 0xFA, 0x7A, 0xE0, 0xF7, 0x1E, 0x9F, 0x71, 0xEA, 0xEA,
+    0x71, 0xAF, 0xDA, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0xAF, 0xDA, 0x71,
+    0xAF, 0xE7, 0x1E, 0xAF, 0x70, 0x9E, 0x9F, 0xA7, 0xF0, 0xFC, 0xA5, 0xAE, 0xA0, 0xFE, 0xA9, 0x9A,
+    0xFC, 0x1E, 0x9A, 0xFF, 0xD2, 0xE9, 0x09, 0xFE, 0xA3, 0xE9, 0x39, 0x99, 0x6E, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x50, 0x59, 0x99, 0x97,
+    0x3A, 0xFE, 0x91, 0xE2, 0xFF, 0xDA, 0x0E, 0x1F, 0xC9, 0x99, 0x9E, 0xAE, 0x0A, 0xEA, 0x59, 0xFC,
+    0x0E, 0xA7, 0xAF, 0x9E, 0x71, 0xFA, 0xE7, 0x1F, 0xEA, 0x71, 0xAF, 0xDA, 0x71, 0x9F, 0xD9, 0x71,
+    0x9F, 0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0xAE, 0xAE, 0x71, 0xAE, 0x9E, 0x71, 0xF0,
+    0xEA, 0x79, 0xF0, 0xAE, 0xA5, 0x9F, 0xC1, 0xFC, 0xA9, 0x9A, 0xEA, 0xE2, 0xFF, 0xD9, 0x9E, 0x39,
+    0xFE, 0x90, 0x9E, 0x69, 0x99, 0x39, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59,
+    0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE0, 0x79, 0x99, 0x9E, 0x2A, 0xFF, 0x1F, 0xDA, 0xE0, 0xFA,
+    0xAA, 0x9F, 0xD9, 0x4F, 0xC6, 0xF9, 0x6F, 0x7E, 0xA7, 0xEA, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9,
+    0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0x59, 0x99, 0x99, 0x79, 0xFF,
+    0xCA, 0x92, 0xAF, 0xFE, 0xA1, 0xAE, 0xA9, 0x90, 0x99, 0xAD, 0x2E, 0x97, 0x92, 0xE7, 0x4E, 0x74,
+    0xF7, 0x39, 0xFA, 0x72, 0x9F, 0xD9, 0x71, 0xAF, 0xDA, 0x71, 0xAF, 0xD9, 0x71, 0x9F, 0xC9, 0x72,
+    0x9F, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xE1, 0xA7, 0x0A, 0xE1, 0xEA, 0x99, 0x99, 0x9F, 0x91, 0xFF,
+    0xFA, 0x29, 0xAF, 0xFA, 0x70, 0x99, 0x99, 0x60, 0x4A, 0xA7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x0A,
+    0xE6, 0xAF, 0xFD, 0xA9, 0xFF, 0xEA, 0x09, 0x9F, 0x99, 0x99, 0x99, 0x2A, 0xE7, 0x0A, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xE7, 0x09, 0xE7, 0x09, 0xE9, 0x70, 0xFA, 0x99, 0x99, 0x39, 0xFE, 0xA4, 0x9F, 0xDA,
+    0x79, 0x99, 0x10, 0x77, 0x2E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97,
+    0x09, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0F, 0x0F, 0x79, 0xF0, 0xAE, 0x95, 0x9F, 0xC1, 0xFC,
+    0x99, 0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0, 0xE3, 0xAF, 0xE9, 0x1E, 0x69, 0x99, 0x70, 0x77, 0x3E,
+    0xA7, 0x2A, 0xE0, 0x9E, 0x72, 0xE9, 0x1E, 0x97, 0x09, 0xE2, 0xAE, 0x70, 0xEA, 0x29, 0xE7, 0x0E,
+    0x93, 0xEA, 0x69, 0xE4, 0xAE, 0x6E, 0xA5, 0xE9, 0x5E, 0x6E, 0xA4, 0xAE, 0x69, 0xE4, 0xE9, 0x7E,
+    0x92, 0x9E, 0x70, 0xAD, 0xA2, 0xAD, 0xA7, 0x1E, 0x2E, 0x97, 0x1E, 0x90, 0x9E, 0x72, 0x9D, 0xA0,
+    0xAD, 0xA7, 0x3E, 0x0E, 0x74, 0xAD, 0xAD, 0xA7, 0x49, 0xFC, 0x97, 0x5F, 0xC7, 0x6A, 0xEA, 0x70,
+    0x77, 0x75, 0x9E, 0x70, 0xF7, 0x9E, 0x1E, 0x96, 0xAF, 0x7A, 0xDA, 0x1E, 0xA6, 0xFC, 0x96, 0xE9,
+    0x1A, 0xE6, 0xFC, 0xA5, 0x9E, 0x29, 0xE5, 0x9D, 0x9E, 0x5A, 0xE3, 0xE9, 0x4E, 0x0A, 0xD9, 0x4E,
+    0x93, 0xEA, 0x4E, 0x09, 0xDA, 0x4E, 0x4A, 0xE3, 0x9D, 0xA1, 0xE3, 0x9E, 0x5E, 0x3A, 0xD9, 0x1E,
+    0x3A, 0xDA, 0x5E, 0x92, 0xE2, 0xAD, 0xA2, 0xE9, 0x5A, 0xDA, 0x19, 0xDA, 0x29, 0xE2, 0xE6, 0x9E,
+    0x1A, 0xD9, 0x3E, 0x19, 0xE7, 0xE1, 0xE4, 0xAD, 0x90, 0xAD, 0xA7, 0xE9, 0x0D, 0xA4, 0x9D, 0xA0,
+    0xE9, 0x7A, 0xDA, 0x9D, 0x95, 0xE0, 0xE7, 0x09, 0xEA, 0xD6, 0xE9, 0xDA, 0x71, 0xFD, 0x69, 0xFC,
+    0x97, 0x1F, 0xC9, 0x7F, 0xC7, 0x29, 0xF7, 0x0F, 0xC7, 0x3F, 0x70, 0xAE, 0xA5, 0x77, 0x4A, 0xE7,
+    0x09, 0xE9, 0x2F, 0x7E, 0xA4, 0xEA, 0x5A, 0xE5, 0x9E, 0x49, 0xE9, 0x6A, 0xE3, 0xEA, 0x70, 0xEA,
+    0x1A, 0xE7, 0x19, 0xE9, 0x9E, 0x73, 0xAF, 0xD9, 0x74, 0xFC, 0xA7, 0x59, 0xF7, 0x6A, 0xF9, 0x74,
+    0x9F, 0xD7, 0x4E, 0xAA, 0xE7, 0x2A, 0xE1, 0xEA, 0x70, 0x9E, 0x29, 0xE9, 0x7E, 0x93, 0xAE, 0x6F,
+    0x5E, 0xA4, 0xAE, 0x69, 0xE9, 0x29, 0xE9, 0x7A, 0xE2, 0xEA, 0x71, 0xF0, 0x77, 0x3A, 0xE7, 0x2A,
+    0xE0, 0x9E, 0x72, 0xEA, 0x1E, 0xA7, 0x09, 0xE2, 0xAE, 0x70, 0xAE, 0x3E, 0x97, 0xE9, 0x3A, 0xDA,
+    0x69, 0xE4, 0x9E, 0x6E, 0xA5, 0xE9, 0x5E, 0x95, 0xAE, 0x4A, 0xE7, 0xE4, 0xEA, 0x7A, 0xDA, 0x3E,
+    0x70, 0x9E, 0x2A, 0xDA, 0x71, 0xE9, 0x1E, 0x97, 0x1A, 0xDA, 0x09, 0xE7, 0x3E, 0x0A, 0xDA, 0x73,
+    0xAD, 0x9E, 0x74, 0x9D, 0xAE, 0x75, 0xFC, 0x97, 0x59, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x69, 0xE7,
+    0x7E, 0xA7, 0x69, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x2A, 0xCA, 0xFC, 0x97, 0x2A, 0xFD, 0x97, 0x39,
+    0xFA, 0x75, 0x77, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x19, 0x99, 0x99, 0x99, 0x99, 0x9F, 0x72, 0x9E,
+    0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE7, 0x3E,
+    0x97, 0x2E, 0xA7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xEA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF, 0xFD, 0x00, 0x70, 0xAA, 0xC7, 0xFC, 0x6F, 0xD5, 0xFA,
+    0x7E, 0x97, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70,
+    0x9E, 0x70, 0xEA, 0x7A, 0xE5, 0xFD, 0x95, 0xF9, 0x7F, 0xD7, 0x09, 0xF7, 0x1E, 0xA7, 0x09, 0xE7,
+    0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x09, 0xE7, 0x1E, 0x97,
+    0x0F, 0x97, 0x9F, 0xD6, 0x9F, 0xC7, 0x09, 0xAD, 0x00, 0x0A, 0xA9, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D,
+    0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA3, 0xAA, 0xA9, 0x70, 0xFC, 0x96, 0xAF, 0xC9, 0x79, 0xF7, 0x1E, 0x97, 0x0A, 0xDA,
+    0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70,
+    0xAD, 0xA7, 0x09, 0xE7, 0x1F, 0x97, 0x0F, 0xD7, 0x9F, 0x6A, 0xFC, 0x5F, 0x96, 0x9E, 0x70, 0xAD,
+    0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0A, 0xDA, 0x70, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x70, 0xE9, 0x7F, 0x5A, 0xFC, 0xA5, 0xFC, 0x96, 0xAC, 0xA9, 0x70, 0x29, 0xAA, 0xA9,
+    0x73, 0x9F, 0xF9, 0x5C, 0xA0, 0xFF, 0xEA, 0xA9, 0xAD, 0xA0, 0xD9, 0x29, 0xFF, 0xD9, 0x0A, 0x7A,
+    0xFC, 0xA7, 0x74, 0x19, 0x92, 0xF1, 0xF9, 0x9F, 0x90, 0xF2, 0xAA, 0x77, 0x99, 0x3D, 0x3D, 0x3D,
+    0x29, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x1A, 0xDA, 0x1A, 0xDA, 0x1A, 0xDA,
+    0x1A, 0xDA, 0x1A, 0xDA, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x77, 0x69, 0xD7, 0x49, 0xD7,
+    0x49, 0xD9, 0x71, 0x9A, 0xFD, 0xA9, 0x4F, 0xFE, 0x29, 0xFD, 0xAF, 0xA2, 0xFA, 0x59, 0x2A, 0xE9,
+    0x72, 0xEA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0x9E,
+    0x73, 0x9E, 0x74, 0xE9, 0x73, 0xF7, 0x39, 0xEA, 0x73, 0xFC, 0x92, 0x99, 0xD3, 0xFF, 0xF4, 0xAF,
+    0xFC, 0xA6, 0x9A, 0xEA, 0x97, 0x19, 0xD7, 0x49, 0xD7, 0x49, 0xD7, 0x59, 0x95, 0x77, 0x73, 0xAF,
+    0xDA, 0x97, 0x0A, 0xFF, 0xE6, 0xAF, 0xAA, 0xAF, 0xA5, 0x9E, 0xA5, 0x9C, 0x6A, 0xE7, 0x7E, 0x97,
+    0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x74, 0x99, 0x9A, 0xEA, 0x99,
+    0x99, 0x99, 0x94, 0xAF, 0xFF, 0xD4, 0xAF, 0xFF, 0xD7, 0x0E, 0x77, 0x0E, 0x77, 0x0E, 0x77, 0x0E,
+    0x77, 0x0E, 0x77, 0x0E, 0x77, 0xAE, 0x77, 0xE9, 0x75, 0x9E, 0x97, 0x5A, 0xFF, 0xFF, 0xD0, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x19, 0x73, 0x92, 0xD9, 0x19, 0x9A, 0xA9, 0x2D, 0xA0, 0x9E, 0x9F,
+    0xEA, 0xEA, 0x19, 0xFF, 0xFD, 0x3A, 0xE9, 0x3A, 0xE4, 0xE6, 0xAD, 0x93, 0xD9, 0x7D, 0xA2, 0xAD,
+    0x70, 0xAD, 0x2A, 0xD7, 0x09, 0xD2, 0xAD, 0x70, 0x9D, 0x29, 0xD7, 0x0A, 0xD3, 0xDA, 0x69, 0xDA,
+    0x3A, 0xDA, 0x49, 0xE4, 0xFC, 0xA9, 0x9A, 0xF9, 0x2F, 0xFF, 0xE9, 0x09, 0xDA, 0x09, 0xAF, 0xA0,
+    0x9E, 0x1A, 0xA7, 0x29, 0xC7, 0x73, 0x0E, 0x74, 0xAD, 0x90, 0xEA, 0x72, 0x9E, 0x19, 0xE7, 0x2E,
+    0xA2, 0xAD, 0xA7, 0x09, 0xE4, 0xE7, 0x0E, 0xA4, 0xAD, 0xA6, 0x9E, 0x6E, 0x6E, 0x96, 0xAD, 0xA4,
+    0x9E, 0x70, 0xE4, 0xE9, 0x70, 0xAD, 0xA2, 0x9E, 0x72, 0xE9, 0x1E, 0x97, 0x29, 0xE0, 0x9E, 0x74,
+    0xE9, 0xE9, 0x74, 0x9F, 0xCA, 0x71, 0x9A, 0xAA, 0xAF, 0xDA, 0xAA, 0xA5, 0xAF, 0xFF, 0xD5, 0x9A,
+    0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0x73, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x72, 0xAF, 0xFF, 0xD5,
+    0xAF, 0xFF, 0xD7, 0x3E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x0A,
+    0xA9, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA,
+    0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x77, 0x77, 0x09, 0x91, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA3, 0x39,
+    0x9A, 0xAA, 0xAA, 0x94, 0x9F, 0xFD, 0xA1, 0x9F, 0xFF, 0x1E, 0xA5, 0x9C, 0xA0, 0x9E, 0x72, 0x9E,
+    0x73, 0xE9, 0x72, 0xAE, 0xA7, 0x2F, 0xD9, 0x70, 0xFE, 0xA5, 0xFA, 0xFC, 0x92, 0xE9, 0x29, 0xFA,
+    0x1D, 0xA5, 0xAE, 0x99, 0xD9, 0x6A, 0xDA, 0x9D, 0x97, 0xE9, 0xE7, 0xDA, 0x0F, 0x59, 0xD9, 0x09,
+    0xFA, 0x3E, 0x3F, 0xDA, 0xE9, 0x49, 0xFE, 0x97, 0x0A, 0xFC, 0x97, 0x1A, 0xF7, 0x3E, 0xA7, 0x2A,
+    0xDA, 0x72, 0xAD, 0xAA, 0x97, 0x0E, 0x9E, 0xAA, 0x99, 0x99, 0xAF, 0x0F, 0xFF, 0xC2, 0x9F, 0xFA,
+    0x97, 0x71, 0x19, 0x59, 0x2E, 0x3E, 0x09, 0xE2, 0x9E, 0x1E, 0x3E, 0x29, 0x59, 0x10, 0x77, 0x77,
+    0x59, 0xAF, 0xEA, 0x97, 0x79, 0xFF, 0xFC, 0x97, 0x4A, 0xEA, 0x69, 0xEA, 0x72, 0xE9, 0x72, 0x9E,
+    0x70, 0xE7, 0x6E, 0x6A, 0xD5, 0x9A, 0xAA, 0xA9, 0x4E, 0x49, 0xD5, 0xFF, 0xA3, 0xD9, 0x3D, 0x94,
+    0xFC, 0xAE, 0x93, 0x9D, 0x29, 0xD4, 0xEA, 0x49, 0x5D, 0x91, 0xAC, 0xA3, 0x9E, 0x74, 0x9D, 0x1D,
+    0x93, 0xE7, 0x6D, 0x1D, 0x4E, 0x76, 0xD1, 0xD4, 0xE7, 0x6D, 0x90, 0xD4, 0xDA, 0x76, 0xD9, 0x0D,
+    0x4D, 0xA7, 0x6D, 0x90, 0xD4, 0xE7, 0x6D, 0x1D, 0x93, 0xE7, 0x6D, 0x1A, 0xCA, 0x3A, 0xD9, 0x74,
+    0x9D, 0x19, 0xD4, 0xE9, 0x73, 0xDA, 0x2D, 0x93, 0xAE, 0xA9, 0x9A, 0xAC, 0x93, 0x9D, 0x39, 0xD4,
+    0xAF, 0xF9, 0x3D, 0xA4, 0xE5, 0xAF, 0xA9, 0x3A, 0xD6, 0xE7, 0x6A, 0xD9, 0x69, 0xE9, 0x73, 0xE9,
+    0x71, 0xEA, 0x96, 0x9A, 0xE9, 0x73, 0xAF, 0xCA, 0xAA, 0xFC, 0xA7, 0x7A, 0xFF, 0xCA, 0x77, 0x59,
+    0x99, 0x97, 0x30, 0x74, 0xAF, 0xCA, 0x2F, 0xFC, 0x19, 0xA3, 0x9D, 0x97, 0xDA, 0x7D, 0xA1, 0x9A,
+    0xFD, 0xA0, 0xFA, 0xAA, 0xDA, 0xAD, 0x93, 0xDA, 0xDA, 0x4D, 0xAD, 0xA3, 0x9D, 0xAA, 0xDA, 0x99,
+    0xAE, 0xA0, 0xFD, 0xA9, 0xCA, 0x19, 0xAA, 0x92, 0x90, 0x59, 0x95, 0x97, 0xDA, 0x3A, 0xD9, 0x4E,
+    0x92, 0xAE, 0x4E, 0xA2, 0x9E, 0x4A, 0xE3, 0xE9, 0x3A, 0xE3, 0xEA, 0x39, 0xE3, 0xEA, 0x4E, 0x92,
+    0xAE, 0x49, 0xE9, 0x2E, 0xA5, 0xAE, 0x3E, 0xA5, 0xAE, 0x29, 0xE9, 0x5E, 0xA2, 0x9E, 0x6E, 0xA2,
+    0xAE, 0x6E, 0x92, 0xAE, 0x59, 0xE3, 0xE9, 0x5A, 0x95, 0xA1, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x69, 0xDA, 0x77, 0xDA, 0x77,
+    0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0xDA, 0x77, 0x20, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9,
+    0xAF, 0xFA, 0xAF, 0xFA, 0x09, 0x99, 0x99, 0x99, 0x90, 0x77, 0x77, 0x59, 0xAF, 0xEA, 0x97, 0x79,
+    0xFF, 0xFC, 0x97, 0x4A, 0xEA, 0x69, 0xEA, 0x72, 0xE9, 0x72, 0x9E, 0x70, 0xE7, 0x6E, 0x6A, 0xD2,
+    0x9A, 0xAA, 0xAA, 0xA9, 0x5E, 0x49, 0xD3, 0xAF, 0xFA, 0x4D, 0x93, 0xD9, 0x3A, 0xFF, 0xC9, 0x39,
+    0xD2, 0x9D, 0x4A, 0xD9, 0x29, 0xE4, 0xD9, 0x1A, 0xCA, 0x4A, 0xD9, 0x3E, 0x49, 0xD1, 0xD9, 0x4A,
+    0xD9, 0x3A, 0xD5, 0xD1, 0xD5, 0xAD, 0x93, 0xE5, 0xD1, 0xD5, 0xAD, 0x92, 0xEA, 0x5D, 0x90, 0xD5,
+    0xAF, 0xFC, 0x6D, 0x90, 0xD5, 0xAF, 0xEA, 0x7D, 0x90, 0xD5, 0xAD, 0xA9, 0x9E, 0x7D, 0x1D, 0x94,
+    0xAD, 0x91, 0xAD, 0x96, 0xD1, 0xAC, 0xA4, 0xAD, 0x92, 0xE5, 0x9D, 0x19, 0xD4, 0xAD, 0x92, 0xAD,
+    0xA4, 0xDA, 0x2D, 0x93, 0xAD, 0x93, 0xE3, 0x9D, 0x39, 0xD3, 0xAD, 0x93, 0x9E, 0x2D, 0xA4, 0xE2,
+    0x9D, 0x94, 0xAD, 0x90, 0xAD, 0x6E, 0x76, 0xAD, 0x96, 0x9E, 0x97, 0x3E, 0x97, 0x1E, 0xA9, 0x69,
+    0xAE, 0x97, 0x3A, 0xFC, 0xAA, 0xAF, 0xCA, 0x77, 0xAF, 0xFC, 0xA7, 0x75, 0x99, 0x99, 0x73, 0x0F,
+    0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x76,
+    0xAF, 0xA3, 0x9F, 0xF9, 0x1E, 0x91, 0x9E, 0x0A, 0xD5, 0xDA, 0xDA, 0x5A, 0xFA, 0x59, 0xFA, 0x5A,
+    0xDA, 0xD5, 0xDA, 0x0D, 0xA3, 0xAD, 0x90, 0xAF, 0xFA, 0x29, 0xFD, 0x96, 0x99, 0x40, 0x79, 0x99,
+    0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x77, 0xAD, 0x70, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x7A, 0xD7,
+    0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x7A, 0xD7, 0x79, 0xAA, 0x77, 0x73,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA,
+    0x29, 0xFA, 0x92, 0x9F, 0xF9, 0x1A, 0xDA, 0x90, 0x9E, 0x2A, 0x49, 0xD9, 0x70, 0xDA, 0x79, 0xD9,
+    0x7A, 0xD7, 0x9D, 0xA7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xDA, 0x7F, 0xFD, 0x90, 0xFF, 0xD9, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x2A, 0xFA, 0x93, 0xAF, 0xF9, 0x2E, 0x91, 0x9E, 0x39, 0x49, 0xD9,
+    0x71, 0xDA, 0x70, 0x9D, 0x97, 0x9E, 0x4F, 0xDA, 0x5F, 0xDA, 0x71, 0x9E, 0x97, 0x1E, 0x71, 0xAD,
+    0x71, 0xE1, 0x95, 0x9D, 0xA0, 0x9D, 0xAA, 0x99, 0xAE, 0x19, 0xFF, 0xC9, 0x39, 0xAA, 0xAA, 0xA9,
+    0x30, 0x3A, 0xAA, 0xA3, 0xAE, 0x93, 0xEA, 0x3E, 0xA3, 0xAD, 0xA3, 0x9D, 0xA5, 0x96, 0x77, 0x1E,
+    0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97,
+    0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E,
+    0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x09, 0xE0, 0xEA, 0x70, 0x9E, 0x0E, 0xA7, 0x0F, 0x0F, 0x79, 0xF0,
+    0xFA, 0x6F, 0xC0, 0xFD, 0xA9, 0x99, 0xAD, 0xAE, 0x0F, 0xFF, 0xC0, 0xE0, 0xE9, 0x9F, 0xD9, 0x1A,
+    0xD0, 0xE9, 0x19, 0x99, 0x70, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x75, 0x59, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x29, 0xFF, 0xFD, 0xA1,
+    0xAF, 0xFD, 0xAA, 0xAD, 0xA0, 0x9F, 0xFD, 0xA2, 0xAC, 0xA0, 0xFF, 0xEA, 0x2A, 0xCA, 0x9F, 0xFE,
+    0xA2, 0xAC, 0xAA, 0xFF, 0xEA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF,
+    0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xAF,
+    0xFE, 0xA2, 0xAC, 0xA9, 0xFF, 0xEA, 0x2A, 0xCA, 0x0F, 0xFE, 0xA2, 0xAC, 0xA0, 0x9F, 0xFD, 0xA2,
+    0xAC, 0xA1, 0x9F, 0xFC, 0xA2, 0xAC, 0xA3, 0xAF, 0xEA, 0x2A, 0xCA, 0x71, 0xAC, 0xA2, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x2A, 0xCA, 0x71, 0xAC, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x2A, 0xCA, 0x71, 0xAC, 0xA2,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x2A, 0xCA, 0x71, 0xAC, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x2A, 0xCA, 0x71,
+    0xAC, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x2A, 0xCA, 0x71, 0xAC, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x2A,
+    0xCA, 0x71, 0xAC, 0xA2, 0xAC, 0xA7, 0x1A, 0xCA, 0x2A, 0xCA, 0x71, 0x9C, 0x92, 0x9C, 0x90, 0x19,
+    0x92, 0xF0, 0x9F, 0x90, 0xF9, 0x0F, 0x29, 0x91, 0x2D, 0x93, 0x9D, 0x4F, 0x92, 0x9A, 0xE9, 0x4E,
+    0x4E, 0x39, 0xDA, 0x9F, 0xD0, 0x9F, 0xA1, 0x4A, 0xAA, 0x29, 0xF1, 0xAF, 0xC0, 0xEA, 0xAD, 0x0D,
+    0x90, 0xAD, 0x09, 0x2A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0x99, 0x90, 0x76, 0xAF, 0xA4, 0xFF, 0x91, 0xE3, 0xAD, 0x09, 0xD5, 0xD9,
+    0xAC, 0xA5, 0xAF, 0xA5, 0xAF, 0xA5, 0x9D, 0xAC, 0xA5, 0xAD, 0xAD, 0x5D, 0xA0, 0xD9, 0x39, 0xD9,
+    0x0A, 0xDA, 0x99, 0xAD, 0xA2, 0xAF, 0xDA, 0x59, 0xAA, 0x93, 0x19, 0x69, 0x6D, 0xA3, 0xAD, 0x6E,
+    0xA2, 0x9E, 0x6E, 0x92, 0xAE, 0x6E, 0x92, 0xEA, 0x59, 0xE3, 0xEA, 0x5A, 0xE3, 0xE9, 0x5F, 0x29,
+    0xE9, 0x4A, 0xE3, 0xE9, 0x39, 0xE3, 0xEA, 0x39, 0xE9, 0x2F, 0x4E, 0x92, 0xAE, 0x4E, 0xA2, 0x9E,
+    0x4A, 0xE2, 0x9E, 0x93, 0x9E, 0x3E, 0x96, 0xA5, 0x9A, 0x50, 0x39, 0xDA, 0x73, 0xDA, 0x6A, 0xF7,
+    0x2A, 0xD6, 0xFD, 0x71, 0x9D, 0xA4, 0x9E, 0x9A, 0xD7, 0x1E, 0x6D, 0x1A, 0xD7, 0x0A, 0xD9, 0x72,
+    0xE7, 0x0D, 0xA7, 0x3E, 0x7E, 0x74, 0xE6, 0x9D, 0x97, 0x4E, 0x6E, 0x75, 0xE5, 0xAD, 0x76, 0xE5,
+    0xDA, 0x76, 0xE4, 0xE4, 0xE9, 0x6E, 0x39, 0xD9, 0x3A, 0xE9, 0x6E, 0x3E, 0x39, 0xF9, 0x6E, 0x2A,
+    0xD4, 0xDA, 0xD9, 0x6E, 0x19, 0xDA, 0x3A, 0xCA, 0x9D, 0x97, 0x99, 0x1E, 0x39, 0xD0, 0x9D, 0x97,
+    0x29, 0xD9, 0x3D, 0x90, 0xAD, 0x97, 0x2D, 0xA3, 0xAC, 0xA1, 0xAD, 0x97, 0x1A, 0xD3, 0x9D, 0x2A,
+    0xD9, 0x70, 0x9D, 0xA3, 0xD9, 0x2A, 0xD9, 0x70, 0xE3, 0xAF, 0xFE, 0xA5, 0xAD, 0x93, 0xFF, 0xFA,
+    0x5D, 0xA4, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x95, 0xAD, 0x74, 0xAD, 0x95, 0x9D, 0x97, 0x4A, 0xD9,
+    0x5E, 0x75, 0xAD, 0x91, 0x4A, 0xD9, 0x72, 0xD9, 0x70, 0xF9, 0x71, 0xE7, 0xAF, 0xC9, 0x70, 0x9D,
+    0x96, 0xF0, 0xD9, 0x70, 0xE7, 0xAC, 0xA1, 0xD9, 0x7A, 0xD7, 0x5D, 0x96, 0x9D, 0xA7, 0x5D, 0x96,
+    0xE7, 0x6D, 0x95, 0xAD, 0x97, 0x6D, 0x95, 0xDA, 0x77, 0xD9, 0x4A, 0xD7, 0x70, 0xD9, 0x39, 0xD9,
+    0x39, 0x99, 0x71, 0xD9, 0x3E, 0x19, 0xFD, 0xA7, 0xD9, 0x2A, 0xD9, 0x0F, 0xFC, 0xA6, 0xD9, 0x2D,
+    0xA1, 0xAC, 0xA3, 0xE6, 0xD9, 0x1E, 0x71, 0x9D, 0x95, 0xD9, 0x09, 0xD9, 0x71, 0x9D, 0x95, 0x99,
+    0x1E, 0x72, 0xAD, 0x71, 0xAD, 0x73, 0xDA, 0x71, 0xDA, 0x72, 0xE7, 0x1E, 0x72, 0xAD, 0x97, 0x09,
+    0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x1A, 0xD9, 0x71, 0x9D, 0xA7, 0x0E,
+    0x73, 0xE7, 0x0E, 0xA9, 0x99, 0x99, 0x94, 0x9D, 0x97, 0x9F, 0xFD, 0x93, 0xDA, 0x70, 0x9F, 0xFD,
+    0x90, 0x77, 0x76, 0x9F, 0xD9, 0x73, 0x9D, 0x4F, 0xFC, 0xA7, 0x2D, 0xA4, 0xAC, 0xA9, 0x19, 0xE7,
+    0x1A, 0xD7, 0x49, 0xD9, 0x79, 0xDA, 0x74, 0x9D, 0x97, 0xE7, 0x5A, 0xD7, 0xAD, 0x97, 0x4A, 0xDA,
+    0x7D, 0xA7, 0x1F, 0xD9, 0x7A, 0xD7, 0x2F, 0xE9, 0x59, 0xD9, 0x76, 0x9E, 0x94, 0xE7, 0x71, 0xE3,
+    0xAD, 0x97, 0x71, 0xE3, 0xDA, 0x3A, 0xDA, 0x72, 0xE2, 0xE4, 0xEA, 0x19, 0x95, 0xAD, 0xA1, 0x9D,
+    0x93, 0xFA, 0x19, 0xEA, 0xAA, 0xF2, 0xE3, 0xAC, 0xAD, 0xA1, 0x9F, 0xFC, 0x2A, 0xD3, 0x9D, 0x0D,
+    0xA4, 0x9A, 0xAA, 0x94, 0xDA, 0x3D, 0x90, 0xDA, 0x75, 0xE3, 0xAC, 0xA1, 0xDA, 0x74, 0x9D, 0x92,
+    0x9D, 0x2D, 0xA7, 0x4E, 0x3D, 0x92, 0xDA, 0x73, 0xAD, 0x3D, 0xA3, 0xDA, 0x72, 0x9D, 0xA2, 0x9F,
+    0xFF, 0x70, 0xE3, 0x9F, 0xFF, 0x79, 0xD9, 0x49, 0x99, 0x99, 0x9A, 0xE9, 0x97, 0xDA, 0x74, 0xDA,
+    0x70, 0xAD, 0x75, 0xDA, 0x79, 0xD9, 0x75, 0xDA, 0x10, 0x70, 0x99, 0x73, 0x9E, 0x97, 0x2A, 0xF7,
+    0x2F, 0xC7, 0x29, 0xEA, 0x73, 0x9A, 0x97, 0x77, 0x77, 0x49, 0x99, 0x74, 0xAD, 0x74, 0xE7, 0x4E,
+    0x73, 0xAD, 0xA7, 0x2A, 0xE7, 0x2A, 0xE9, 0x71, 0xF9, 0x71, 0xF9, 0x71, 0xF7, 0x29, 0xE7, 0x3E,
+    0x97, 0x3E, 0x74, 0xE7, 0x4E, 0x74, 0xEA, 0x73, 0xAE, 0x95, 0x9D, 0x2F, 0xDA, 0xAF, 0xC9, 0x2F,
+    0xFF, 0x93, 0x9F, 0xEA, 0x97, 0x71, 0x6A, 0xAA, 0xA7, 0x73, 0x9E, 0xA7, 0x73, 0x9E, 0x97, 0x73,
+    0xAE, 0x77, 0x4A, 0xDA, 0x77, 0x4A, 0xD9, 0x77, 0x59, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xDA, 0x77,
+    0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1,
+    0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E,
+    0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99,
+    0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A,
+    0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x74, 0x9A, 0xAA,
+    0x97, 0x72, 0xF7, 0x72, 0xF7, 0x72, 0x9E, 0x77, 0x3E, 0x77, 0x3E, 0x77, 0x49, 0x97, 0x77, 0x77,
+    0x77, 0x75, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A,
+    0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A,
+    0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E,
+    0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE,
+    0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77,
+    0xEA, 0x71, 0xAA, 0xAA, 0x77, 0x2A, 0xF9, 0x77, 0x09, 0xFD, 0x77, 0x9E, 0x9A, 0xE7, 0x6E, 0x29,
+    0xE7, 0x4E, 0x49, 0xE7, 0x39, 0x97, 0x99, 0x77, 0x77, 0x77, 0x77, 0xAD, 0xA7, 0x73, 0xF7, 0x72,
+    0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E,
+    0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7,
+    0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99,
+    0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9,
+    0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA,
+    0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x79, 0xA9, 0x5A, 0x97, 0x29, 0xFC,
+    0x92, 0x9C, 0xA7, 0x2F, 0xF9, 0xAD, 0x97, 0x1A, 0xD1, 0xAF, 0xE7, 0x2D, 0x4A, 0xF7, 0x39, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x2A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA,
+    0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E,
+    0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A,
+    0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF,
+    0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E,
+    0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E,
+    0x9E, 0xA7, 0x7E, 0xA0, 0x79, 0x59, 0x76, 0xE3, 0xE7, 0x49, 0xE3, 0xE7, 0x5E, 0x3E, 0x76, 0x95,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7,
+    0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19,
+    0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A,
+    0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6,
+    0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73,
+    0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09,
+    0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x71, 0x9A, 0xA9, 0x77, 0x2F, 0xD7, 0x70, 0xDA, 0x99, 0xDA,
+    0x77, 0xD3, 0xD7, 0x7D, 0x3D, 0x77, 0xD2, 0x9D, 0x77, 0xAF, 0xD9, 0x77, 0x0A, 0xFA, 0x77, 0x19,
+    0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1,
+    0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72,
+    0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99,
+    0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97,
+    0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1,
+    0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x74, 0x9F, 0xFF, 0xFC, 0xA7, 0x4F,
+    0xFF, 0xFE, 0x73, 0x9F, 0xFF, 0xFE, 0x73, 0xEA, 0x09, 0xE9, 0x77, 0x49, 0xE2, 0xE7, 0x75, 0xEA,
+    0x2E, 0x77, 0x49, 0xE3, 0xE7, 0x74, 0xEA, 0x3E, 0x77, 0x39, 0xE4, 0xE7, 0x73, 0xAD, 0xA4, 0xE7,
+    0x73, 0xE5, 0xE7, 0x72, 0xAE, 0x5E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x70, 0xE9, 0x5F, 0xFF, 0xC7,
+    0xAE, 0x6F, 0xFF, 0xC7, 0xE9, 0x6E, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x6A, 0xE9, 0x99, 0x99, 0x99,
+    0x9E, 0x77, 0x0F, 0xFF, 0xE7, 0x7A, 0xFF, 0xFE, 0x77, 0xFA, 0xAA, 0xAA, 0xAA, 0xAF, 0x76, 0x9E,
+    0x71, 0xE7, 0x6E, 0xA7, 0x1E, 0x75, 0x9E, 0x72, 0xE7, 0x5E, 0xA7, 0x2E, 0x74, 0x9E, 0x73, 0xE7,
+    0x4E, 0xA7, 0x3F, 0xFF, 0xD0, 0x9E, 0x74, 0xFF, 0xFD, 0x0E, 0xA7, 0x4F, 0xFF, 0xD0, 0x77, 0x74,
+    0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x94, 0xFF, 0xFE, 0x39, 0xFC, 0x95, 0x9A, 0xCA, 0x3F, 0xA7,
+    0x6A, 0xEA, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x79, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xE7,
+    0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xE9, 0x77,
+    0x0E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x70, 0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x70, 0x99,
+    0x4A, 0xFD, 0xAA, 0xAA, 0xF9, 0x5A, 0xFF, 0xFC, 0x97, 0xAF, 0xFD, 0xA7, 0x39, 0xD9, 0x97, 0x79,
+    0xCA, 0x77, 0x1E, 0xA7, 0x70, 0x9A, 0xE7, 0x72, 0xDA, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0xA7, 0x4A,
+    0xFD, 0x75, 0xAF, 0x96, 0x29, 0xAA, 0xA9, 0x73, 0xF7, 0x4F, 0x74, 0xE9, 0x74, 0xE7, 0x5E, 0x75,
+    0x99, 0x77, 0x77, 0x49, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA0, 0x71, 0xAA, 0xAA, 0x72,
+    0xAE, 0x97, 0x19, 0xEA, 0x72, 0xEA, 0x72, 0xAD, 0xA7, 0x29, 0xDA, 0x74, 0x97, 0x77, 0x77, 0x9F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F,
+    0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x59, 0xAA, 0xA7, 0x3F, 0xC7, 0x1F, 0xDA, 0x7E, 0xA0,
+    0xEA, 0x5A, 0xDA, 0x2E, 0x93, 0xAD, 0x94, 0xAD, 0x92, 0x99, 0x70, 0x97, 0x77, 0x71, 0x9F, 0xFF,
+    0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF,
+    0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA,
+    0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x39, 0x94, 0x99, 0x5A, 0xD9, 0x2A, 0xD9, 0x4E, 0xA2, 0xAD,
+    0xA4, 0xAD, 0x92, 0x9D, 0x95, 0x95, 0x97, 0x77, 0x77, 0x73, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xDA,
+    0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0,
+    0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F,
+    0xFF, 0xDA, 0x9A, 0xAA, 0x96, 0xF7, 0xEA, 0x7E, 0x97, 0xE7, 0x0E, 0x70, 0x99, 0x77, 0x70, 0x9F,
+    0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x6A,
+    0xAA, 0xA5, 0xAE, 0x94, 0x9E, 0x95, 0xEA, 0x5A, 0xDA, 0x59, 0xD9, 0x79, 0x77, 0x73, 0x9F, 0xFC,
+    0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0, 0x39, 0xAA,
+    0xA7, 0x0F, 0xC6, 0xFD, 0xA4, 0xEA, 0x0E, 0x92, 0xAD, 0xA2, 0xE9, 0x0A, 0xD9, 0x4A, 0xD9, 0x99,
+    0x70, 0x97, 0x77, 0x39, 0xFF, 0xC2, 0xAF, 0xFC, 0x39, 0xAF, 0xCA, 0x95, 0x9E, 0x70, 0x9E, 0x70,
+    0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70,
+    0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70,
+    0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x79, 0xAE, 0xA9, 0x39, 0xFF, 0xC2, 0xAF, 0xFC, 0x10, 0x09, 0x94,
+    0x99, 0x0A, 0xD9, 0x2A, 0xD9, 0xEA, 0x2E, 0xAA, 0xD9, 0x2A, 0xD9, 0x09, 0x59, 0x77, 0x77, 0x29,
+    0xFF, 0xC0, 0xAF, 0xFC, 0x19, 0xAF, 0xCA, 0x93, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x59, 0xAE, 0xA9, 0x19, 0xFF, 0xC0, 0xAF, 0xFC, 0x00,
+    0x2F, 0xFC, 0xAA, 0x97, 0x4F, 0xFF, 0xD9, 0x71, 0xFF, 0xFF, 0x97, 0xE9, 0x49, 0x9A, 0xFC, 0x96,
+    0xE9, 0x70, 0xAF, 0x95, 0xE9, 0x71, 0x9F, 0x5E, 0x97, 0x29, 0xEA, 0x4E, 0x97, 0x3A, 0xE4, 0xE9,
+    0x73, 0x9E, 0x93, 0xE9, 0x74, 0xEA, 0x3E, 0x97, 0x4A, 0xE3, 0xE9, 0x74, 0xAE, 0x0A, 0xAA, 0xFA,
+    0xAA, 0xAA, 0xA6, 0x9E, 0x0F, 0xFF, 0xC6, 0x9E, 0x0F, 0xFF, 0xC6, 0xAE, 0x29, 0xE9, 0x74, 0xAE,
+    0x3E, 0x97, 0x4A, 0xE3, 0xE9, 0x74, 0xEA, 0x3E, 0x97, 0x39, 0xE9, 0x3E, 0x97, 0x3F, 0x4E, 0x97,
+    0x29, 0xEA, 0x4E, 0x97, 0x19, 0xF5, 0xE9, 0x70, 0xAF, 0x95, 0xE9, 0x59, 0xAF, 0xC9, 0x6F, 0xFF,
+    0xF9, 0x7F, 0xFF, 0xDA, 0x71, 0xFF, 0xDA, 0xA9, 0x70, 0x69, 0xA9, 0x59, 0xA7, 0x1F, 0xCA, 0x3D,
+    0x70, 0xFF, 0xA9, 0xDA, 0x70, 0xD9, 0x09, 0xFE, 0x70, 0x9C, 0xA3, 0x9F, 0x97, 0x19, 0x77, 0x77,
+    0x77, 0x73, 0x9E, 0xA7, 0x5D, 0xA9, 0xF9, 0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29,
+    0xE9, 0xFD, 0x97, 0x19, 0xE9, 0xDA, 0xF7, 0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A,
+    0xE7, 0x09, 0xE9, 0xDA, 0x1F, 0x79, 0xE9, 0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6, 0x9E,
+    0x9D, 0xA3, 0xF5, 0x9E, 0x9E, 0x39, 0xE9, 0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3, 0x9E,
+    0x9E, 0x59, 0xE9, 0x29, 0xE9, 0xE6, 0xF2, 0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91, 0xE9,
+    0xE7, 0x0F, 0x1E, 0x9E, 0x70, 0x9E, 0xA0, 0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9, 0xE7,
+    0x29, 0xFD, 0x9E, 0x73, 0xAF, 0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF0, 0x7A, 0xAA, 0xA7, 0x74,
+    0xAE, 0x97, 0x74, 0xAE, 0x77, 0x5E, 0xA7, 0x75, 0xE9, 0x77, 0x5A, 0xD7, 0x76, 0x99, 0x77, 0x77,
+    0x77, 0x77, 0x29, 0xAF, 0xEA, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6,
+    0x9F, 0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E,
+    0xA7, 0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A,
+    0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77,
+    0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92,
+    0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC,
+    0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97, 0x10, 0x75, 0xAA, 0xAA, 0x77, 0x39, 0xEA, 0x77,
+    0x3E, 0xA7, 0x73, 0xAE, 0x77, 0x39, 0xE7, 0x74, 0xDA, 0x77, 0x59, 0x97, 0x77, 0x77, 0x77, 0x74,
+    0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49,
+    0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E,
+    0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77,
+    0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E,
+    0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A,
+    0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F,
+    0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x72, 0xAA, 0xA9, 0x77, 0x3F, 0xC7, 0x72, 0xAF, 0xD7, 0x70,
+    0xAE, 0x0A, 0xE7, 0x69, 0xE2, 0xAD, 0xA7, 0x49, 0xDA, 0x49, 0xDA, 0x74, 0x97, 0x09, 0x97, 0x77,
+    0x77, 0x77, 0x69, 0xAF, 0xEA, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6,
+    0x9F, 0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E,
+    0xA7, 0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A,
+    0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77,
+    0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92,
+    0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC,
+    0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97, 0x10, 0x79, 0x99, 0x6A, 0x97, 0x3A, 0xFA, 0x3A,
+    0xC9, 0x72, 0x9F, 0xEA, 0x9A, 0xD7, 0x3D, 0xA1, 0xAF, 0xDA, 0x73, 0xD4, 0xAE, 0xA7, 0x49, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A,
+    0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A,
+    0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7,
+    0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9,
+    0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A,
+    0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F,
+    0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x70, 0x95, 0x97, 0x69, 0xDA, 0x29,
+    0xDA, 0x75, 0xAE, 0x2A, 0xE7, 0x59, 0xDA, 0x29, 0xDA, 0x77, 0x95, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x19, 0xAF, 0xEA, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6, 0x9F,
+    0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E, 0xA7,
+    0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA,
+    0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77, 0x0E,
+    0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0x9F,
+    0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC, 0xA7,
+    0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97, 0x10, 0x19, 0x76, 0xAC, 0x97, 0x1D, 0x09, 0xE9, 0x7E,
+    0xA0, 0xAE, 0x95, 0xF2, 0xAE, 0x93, 0xF4, 0xAE, 0x91, 0xF6, 0xAE, 0x9F, 0x70, 0x9F, 0xD7, 0x2A,
+    0xF7, 0x3F, 0xC9, 0x71, 0xFE, 0x97, 0xF0, 0xAE, 0x95, 0xF2, 0xAE, 0x93, 0xF4, 0xAE, 0x91, 0xF6,
+    0xAE, 0x90, 0xE7, 0x0A, 0xDA, 0x1C, 0x72, 0x9A, 0x77, 0x10, 0x77, 0x4A, 0x71, 0x9A, 0xFE, 0xA9,
+    0x1E, 0x69, 0xFF, 0xFF, 0xA5, 0xAF, 0xFF, 0xFC, 0x5A, 0xFA, 0x6A, 0xFA, 0x49, 0xF7, 0x1A, 0xF9,
+    0x3F, 0x71, 0x9F, 0xD2, 0x9E, 0x97, 0x1E, 0x9E, 0xA1, 0xF7, 0x1E, 0x90, 0xAE, 0x1E, 0xA7, 0x0A,
+    0xE1, 0x9E, 0x99, 0xE9, 0x79, 0xE3, 0xEA, 0xAE, 0x70, 0xE9, 0x3F, 0xAE, 0x7A, 0xDA, 0x4A, 0xEA,
+    0xE6, 0x9E, 0x5A, 0xEA, 0xE6, 0xE9, 0x5A, 0xEA, 0xE5, 0xEA, 0x6A, 0xEA, 0xE4, 0x9E, 0x7A, 0xEA,
+    0xE4, 0xE7, 0x0F, 0x9E, 0x3E, 0x97, 0x0E, 0xA0, 0xE9, 0x1A, 0xDA, 0x71, 0xE9, 0x0F, 0x09, 0xE7,
+    0x1A, 0xE1, 0x9E, 0x9E, 0x97, 0x1E, 0xA2, 0xFD, 0xA7, 0x1A, 0xE9, 0x29, 0xFC, 0x71, 0xAE, 0xA4,
+    0xAF, 0x96, 0x9F, 0xC5, 0xFF, 0xAA, 0xAA, 0xFD, 0x5A, 0xFF, 0xFF, 0xA6, 0xE1, 0x9F, 0xFC, 0xA7,
+    0x1C, 0x95, 0x99, 0x99, 0x77, 0x77, 0x20, 0x5A, 0xAA, 0xA7, 0x70, 0xAE, 0x97, 0x70, 0xAE, 0x77,
+    0x1E, 0xA7, 0x71, 0xAD, 0x97, 0x71, 0xAD, 0x77, 0x29, 0x97, 0x77, 0x77, 0x71, 0x9D, 0xA7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E,
+    0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97,
+    0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x73, 0xAA, 0xAA, 0x77, 0x9E, 0xA7, 0x7F, 0x77, 0xAE, 0x77,
+    0x9E, 0x77, 0x0E, 0x77, 0x19, 0x97, 0x77, 0x77, 0x73, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F,
+    0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59,
+    0x99, 0x97, 0x70, 0xAA, 0xA9, 0x77, 0xFC, 0x76, 0xAF, 0xD7, 0x49, 0xE0, 0xAE, 0x72, 0x9E, 0x2A,
+    0xDA, 0x70, 0x9D, 0xA4, 0x9D, 0xA7, 0x09, 0x70, 0x99, 0x77, 0x77, 0x75, 0x9D, 0xA7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90,
+    0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F,
+    0xFC, 0xA7, 0x59, 0x99, 0x97, 0x69, 0x59, 0x72, 0x9E, 0x29, 0xE7, 0x19, 0xE2, 0x9E, 0x71, 0x9D,
+    0xA3, 0xDA, 0x73, 0x95, 0x97, 0x77, 0x77, 0x77, 0x74, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F,
+    0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59,
+    0x99, 0x97, 0x73, 0xAA, 0xAA, 0x77, 0x09, 0xEA, 0x77, 0x0E, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0x9D,
+    0xA7, 0x71, 0xDA, 0x77, 0x29, 0x97, 0x77, 0x77, 0x76, 0xAD, 0xA7, 0x49, 0xDA, 0x09, 0xE9, 0x73,
+    0xEA, 0x1F, 0x72, 0xAE, 0x3E, 0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAE, 0x5E, 0x97, 0xE9, 0x5A, 0xE6,
+    0xAE, 0x7E, 0xA4, 0x9E, 0x97, 0xAE, 0x4E, 0xA7, 0x1E, 0xA2, 0x9E, 0x72, 0x9E, 0x2E, 0xA7, 0x3E,
+    0xA0, 0x9E, 0x74, 0x9E, 0x0E, 0xA7, 0x5F, 0xE7, 0x69, 0xFC, 0x97, 0x7F, 0xC7, 0x71, 0xE9, 0x77,
+    0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E,
+    0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x70, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E,
+    0x75, 0x9E, 0x75, 0x9F, 0xFE, 0xA4, 0x9F, 0xFF, 0xCA, 0x29, 0xFF, 0xFE, 0x19, 0xE6, 0x9F, 0xA0,
+    0x9E, 0x70, 0xF0, 0x9E, 0x71, 0xEA, 0x9E, 0x71, 0xEA, 0x9E, 0x71, 0xAE, 0x9E, 0x71, 0xEA, 0x9E,
+    0x71, 0xEA, 0x9E, 0x70, 0x9E, 0x99, 0xE7, 0x0F, 0x09, 0xE6, 0x9F, 0x90, 0x9E, 0xAA, 0xAA, 0xAF,
+    0xDA, 0x19, 0xFF, 0xFC, 0x92, 0x9F, 0xFD, 0xA9, 0x49, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7,
+    0x59, 0xE7, 0x59, 0xE7, 0x50, 0x49, 0xAA, 0xAA, 0xA9, 0x71, 0xAF, 0xFC, 0xA6, 0xFF, 0xFC, 0x93,
+    0xFA, 0x92, 0x9A, 0xF2, 0x9E, 0x96, 0x9E, 0x91, 0xAD, 0xA7, 0x0E, 0xA1, 0xEA, 0x70, 0xEA, 0x1E,
+    0x97, 0x0E, 0x91, 0xE9, 0x7F, 0x2E, 0x96, 0xF3, 0xE9, 0x49, 0xF4, 0xE9, 0x4E, 0xA5, 0xE9, 0x3A,
+    0xDA, 0x6E, 0x93, 0xE9, 0x6E, 0x93, 0xEA, 0x6E, 0x93, 0x9E, 0xA5, 0xE9, 0x4F, 0xC4, 0xE9, 0x5F,
+    0xC9, 0x2E, 0x96, 0xAF, 0xA1, 0xE9, 0x70, 0xFA, 0x0E, 0x97, 0x1A, 0xE9, 0xE9, 0x72, 0xEA, 0xE9,
+    0x72, 0x9F, 0xD9, 0x72, 0x9F, 0xD9, 0x72, 0x9F, 0xD9, 0x19, 0x96, 0xEA, 0xE9, 0x19, 0xDA, 0x99,
+    0x99, 0xF0, 0xE9, 0x19, 0xFF, 0xD9, 0x0E, 0x92, 0xAF, 0xF9, 0x73, 0x99, 0x99, 0x40, 0x4A, 0xAA,
+    0xA7, 0x4A, 0xE9, 0x74, 0xF7, 0x5E, 0xA7, 0x5E, 0x76, 0xE7, 0x69, 0x97, 0x77, 0x59, 0x99, 0x97,
+    0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74,
+    0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09,
+    0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0,
+    0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5,
+    0x99, 0x97, 0x72, 0xAA, 0xAA, 0x73, 0xAE, 0x97, 0x3E, 0xA7, 0x3E, 0xA7, 0x39, 0xDA, 0x74, 0xDA,
+    0x75, 0x99, 0x77, 0x77, 0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09,
+    0xAF, 0x4A, 0x7E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F,
+    0xFF, 0xC1, 0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79,
+    0xE9, 0xE7, 0x0A, 0xE0, 0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD,
+    0xA0, 0xAD, 0x2A, 0xFE, 0x91, 0xAD, 0x59, 0x99, 0x70, 0x69, 0xAA, 0xA9, 0x73, 0xFC, 0x72, 0xFE,
+    0x70, 0xAE, 0x0E, 0xA6, 0xAD, 0xA2, 0xAD, 0xA4, 0x9D, 0xA4, 0xAD, 0xA4, 0x97, 0x09, 0x77, 0x72,
+    0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A, 0x7E, 0xA7,
+    0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1, 0xAF, 0xAA,
+    0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7, 0x0A, 0xE0,
+    0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD, 0x2A, 0xFE,
+    0x91, 0xAD, 0x59, 0x99, 0x70, 0x49, 0xA9, 0x59, 0xA4, 0xAF, 0xA3, 0xD3, 0xAF, 0xEA, 0x9A, 0xD3,
+    0xDA, 0x09, 0xAF, 0xD9, 0x3D, 0x39, 0xFA, 0x49, 0x77, 0x77, 0x59, 0x99, 0x97, 0x09, 0xFF, 0xC9,
+    0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7,
+    0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6,
+    0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0,
+    0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x49,
+    0x94, 0x99, 0x69, 0xDA, 0x29, 0xDA, 0x5A, 0xE2, 0xAE, 0x59, 0xDA, 0x29, 0xDA, 0x79, 0x59, 0x77,
+    0x77, 0x74, 0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A,
+    0x7E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1,
+    0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7,
+    0x0A, 0xE0, 0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD,
+    0x2A, 0xFE, 0x91, 0xAD, 0x59, 0x99, 0x70, 0x7A, 0xAA, 0x73, 0xAF, 0xCA, 0x71, 0xD9, 0x09, 0xD9,
+    0x7A, 0xCA, 0x2A, 0xCA, 0x7A, 0xC9, 0x29, 0xCA, 0x79, 0xCA, 0x2D, 0x97, 0x0E, 0xAE, 0x72, 0xFC,
+    0x75, 0x97, 0x77, 0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A,
+    0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF,
+    0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E,
+    0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA,
+    0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x69, 0x99, 0x97, 0x09, 0x99, 0x97, 0x1A, 0xFF,
+    0x92, 0x9F, 0xEA, 0x59, 0xFF, 0xEA, 0x09, 0xFF, 0xD5, 0xEA, 0x90, 0x99, 0xFA, 0xEA, 0x90, 0x9A,
+    0xEA, 0x49, 0x96, 0xAF, 0xC9, 0x49, 0xE9, 0x75, 0xFA, 0x6A, 0xE7, 0x5F, 0x79, 0xE7, 0x5F, 0x70,
+    0xE9, 0x74, 0xF7, 0x0E, 0x94, 0x9A, 0xFF, 0xFF, 0xFD, 0x92, 0xAF, 0xFF, 0xFF, 0xFC, 0x91, 0xFC,
+    0xA9, 0x99, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xAE, 0xA6, 0xEA, 0x75, 0xEA, 0x7F,
+    0x75, 0xE9, 0x7F, 0x74, 0x9E, 0x79, 0xF9, 0x74, 0xE9, 0x6F, 0xD7, 0x4E, 0xA5, 0xAD, 0xAF, 0x79,
+    0x91, 0xAF, 0x99, 0x9A, 0xEA, 0x09, 0xFA, 0xA9, 0x9A, 0xEA, 0x2F, 0xFD, 0xA2, 0x9F, 0xFE, 0xA3,
+    0xAF, 0xE9, 0x5A, 0xFF, 0xA7, 0x99, 0x97, 0x39, 0x99, 0x94, 0x69, 0x99, 0x99, 0x69, 0xFF, 0xC9,
+    0x2A, 0xFF, 0xD9, 0x1A, 0xFA, 0x99, 0x9A, 0xD1, 0x9E, 0xA7, 0x1F, 0x71, 0x9E, 0x97, 0x1A, 0xE7,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE9,
+    0x72, 0xF7, 0x29, 0xF6, 0x92, 0xAF, 0xAA, 0x9A, 0xAD, 0x92, 0xAF, 0xFD, 0x93, 0x9A, 0xFE, 0xA7,
+    0xAD, 0x97, 0x2D, 0x97, 0x29, 0xEA, 0x72, 0x9F, 0x73, 0xAD, 0x73, 0x9D, 0x97, 0x19, 0xE7, 0xFD,
+    0x97, 0xFA, 0x93, 0x3A, 0xAA, 0xA7, 0x5A, 0xE9, 0x75, 0xAE, 0x76, 0xEA, 0x76, 0xE9, 0x76, 0xAD,
+    0x77, 0x99, 0x77, 0x77, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F,
+    0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA,
+    0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9,
+    0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x71, 0xAA, 0xAA, 0x74,
+    0x9E, 0xA7, 0x4E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5D, 0xA7, 0x69, 0x97, 0x77, 0x71, 0x99, 0x99,
+    0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7,
+    0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75,
+    0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95,
+    0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x6A, 0xAA, 0x97, 0x4F, 0xC7, 0x3A, 0xFD, 0x71, 0xAE, 0x0A,
+    0xE7, 0x9E, 0x2A, 0xDA, 0x59, 0xDA, 0x49, 0xDA, 0x59, 0x70, 0x99, 0x77, 0x73, 0x99, 0x99, 0x72,
+    0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA,
+    0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E,
+    0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF,
+    0xFA, 0x97, 0x19, 0x99, 0x95, 0x49, 0x59, 0x79, 0xDA, 0x29, 0xDA, 0x6A, 0xE2, 0x9E, 0x69, 0xDA,
+    0x29, 0xDA, 0x70, 0x95, 0x97, 0x77, 0x77, 0x79, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF, 0xFD, 0x94,
+    0xAF, 0x90, 0x99, 0xF9, 0x29, 0xE9, 0x5A, 0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE, 0x0A, 0xE7,
+    0x09, 0xE0, 0xAD, 0xA7, 0x09, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x0E, 0xA7, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x09,
+    0x92, 0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x71, 0x99, 0x99, 0x50,
+    0x0A, 0xAA, 0xA4, 0x9E, 0xA4, 0xAE, 0x5A, 0xE5, 0xAD, 0xA5, 0xAD, 0x96, 0x97, 0x76, 0xE9, 0x4E,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x90, 0x3A, 0xAA, 0xA3, 0x9E,
+    0xA3, 0xF3, 0xAE, 0x4E, 0x4E, 0x59, 0x97, 0x77, 0x0E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9,
+    0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x30, 0x4A, 0xAA, 0xA7, 0x0A, 0xF9, 0x6A, 0xFD, 0x59, 0xE0,
+    0xAE, 0x39, 0xE2, 0xAE, 0x2D, 0xA4, 0x9E, 0x19, 0x97, 0x99, 0x77, 0x77, 0x1E, 0x97, 0x1E, 0x97,
+    0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97,
+    0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97,
+    0x1E, 0x97, 0x1E, 0x94, 0x19, 0x59, 0x2E, 0x3E, 0x09, 0xE2, 0x9E, 0x1E, 0x3E, 0x29, 0x59, 0x77,
+    0x77, 0x71, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E,
+    0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x93,
+    0x59, 0x77, 0x0A, 0xD9, 0x3A, 0xD7, 0xFC, 0x09, 0xF9, 0x7A, 0xFE, 0xA7, 0x29, 0xFC, 0x97, 0x2A,
+    0xFD, 0xA7, 0x09, 0xFA, 0xAE, 0xA7, 0xAE, 0x29, 0xE9, 0x7C, 0x94, 0xAE, 0x77, 0xE9, 0x76, 0x9E,
+    0x79, 0xAA, 0xAA, 0x91, 0xE9, 0x4F, 0xFC, 0xA9, 0xDA, 0x29, 0xFF, 0xFE, 0x2F, 0x94, 0xAF, 0xC9,
+    0x0F, 0x79, 0xF9, 0x9E, 0x71, 0x9E, 0xAA, 0xE7, 0x2E, 0xAE, 0xA7, 0x2E, 0xAE, 0x97, 0x2A, 0xDA,
+    0xE9, 0x72, 0xAD, 0xAE, 0x97, 0x2E, 0x9A, 0xDA, 0x72, 0xE9, 0x9E, 0x71, 0x9E, 0x1E, 0xA7, 0x0E,
+    0xA1, 0xAE, 0x96, 0xAE, 0x3A, 0xFA, 0x99, 0x9A, 0xF9, 0x4A, 0xFF, 0xE9, 0x69, 0xAF, 0xEA, 0x74,
+    0x99, 0x97, 0x39, 0xA9, 0x59, 0xA5, 0xAF, 0xA3, 0xD9, 0x39, 0xFE, 0xA9, 0xAD, 0x4D, 0xA1, 0xAF,
+    0xD9, 0x4D, 0x4A, 0xEA, 0x59, 0x77, 0x77, 0x70, 0x99, 0x99, 0x5E, 0x19, 0xFF, 0x92, 0xE0, 0xAF,
+    0xFD, 0x91, 0xEA, 0xE9, 0x99, 0x9A, 0xF1, 0xFC, 0x95, 0x9E, 0xA0, 0xFA, 0x7A, 0xE0, 0xF7, 0x09,
+    0xE0, 0xF7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E,
+    0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97,
+    0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x00, 0x39, 0xAA, 0xA9, 0x76, 0xF7,
+    0x7E, 0xA7, 0x7E, 0x97, 0x7E, 0x77, 0x0E, 0x77, 0x09, 0x97, 0x77, 0x70, 0x99, 0x99, 0x97, 0x29,
+    0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0x92, 0x9E, 0xA6, 0xF2, 0xF7, 0x0E, 0xA0,
+    0x9E, 0x71, 0xAE, 0x0A, 0xE7, 0x2E, 0x9E, 0xA7, 0x2E, 0x9E, 0xA7, 0x2E, 0xAE, 0x97, 0x2E, 0xAE,
+    0x97, 0x2E, 0xAE, 0xA7, 0x2E, 0xAA, 0xDA, 0x72, 0xE9, 0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAE, 0x1A,
+    0xE7, 0x0E, 0xA2, 0xEA, 0x6F, 0x39, 0xFA, 0x99, 0x9A, 0xF5, 0x9F, 0xFE, 0x97, 0xAF, 0xEA, 0x74,
+    0x99, 0x97, 0x72, 0xAA, 0xAA, 0x75, 0xAE, 0x97, 0x49, 0xE9, 0x75, 0xEA, 0x75, 0xAD, 0xA7, 0x59,
+    0xD9, 0x77, 0x97, 0x77, 0x73, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xA9,
+    0x99, 0xAF, 0x92, 0x9E, 0xA6, 0xF2, 0xF7, 0x0E, 0xA0, 0x9E, 0x71, 0xAE, 0x0A, 0xE7, 0x2E, 0x9E,
+    0xA7, 0x2E, 0x9E, 0xA7, 0x2E, 0xAE, 0x97, 0x2E, 0xAE, 0x97, 0x2E, 0xAE, 0xA7, 0x2E, 0xAA, 0xDA,
+    0x72, 0xE9, 0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAE, 0x1A, 0xE7, 0x0E, 0xA2, 0xEA, 0x6F, 0x39, 0xFA,
+    0x99, 0x9A, 0xF5, 0x9F, 0xFE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97, 0x69, 0xAA, 0xA7, 0x6F, 0xC7,
+    0x4F, 0xDA, 0x72, 0xEA, 0x0E, 0x97, 0x0A, 0xDA, 0x2E, 0x96, 0xAD, 0x94, 0xAD, 0x95, 0x99, 0x70,
+    0x97, 0x77, 0x59, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9,
+    0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9,
+    0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99,
+    0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF,
+    0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x49, 0xA9, 0x59, 0xA6, 0xFC, 0xA3, 0xD5,
+    0xAF, 0xEA, 0x9E, 0x5D, 0x90, 0x9F, 0xE9, 0x49, 0xCA, 0x39, 0xF9, 0x69, 0x77, 0x77, 0x70, 0x99,
+    0x99, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFE, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0x92, 0x9E, 0xA6, 0xF2,
+    0xF7, 0x0E, 0xA0, 0x9E, 0x71, 0xAE, 0x0A, 0xE7, 0x2E, 0x9E, 0xA7, 0x2E, 0x9E, 0xA7, 0x2E, 0xAE,
+    0x97, 0x2E, 0xAE, 0x97, 0x2E, 0xAE, 0xA7, 0x2E, 0xAA, 0xDA, 0x72, 0xE9, 0x9E, 0x72, 0xE1, 0xE9,
+    0x70, 0xAE, 0x1A, 0xE7, 0x0E, 0xA2, 0xEA, 0x6F, 0x39, 0xFA, 0x99, 0x9A, 0xF5, 0x9F, 0xFE, 0x97,
+    0xAF, 0xEA, 0x74, 0x99, 0x97, 0x49, 0x94, 0x99, 0x70, 0xAD, 0x92, 0xAD, 0x97, 0xEA, 0x2E, 0xA7,
+    0xAD, 0x92, 0xAD, 0x97, 0x09, 0x59, 0x77, 0x77, 0x77, 0x29, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A,
+    0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A,
+    0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA,
+    0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA,
+    0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70,
+    0x7A, 0xCA, 0x76, 0x9E, 0xA7, 0x59, 0xEA, 0x76, 0xEA, 0x76, 0x9A, 0x97, 0x77, 0x77, 0x6A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x77,
+    0x77, 0x77, 0x70, 0xAD, 0x76, 0x9E, 0xA7, 0x59, 0xEA, 0x76, 0xE9, 0x77, 0x99, 0x70, 0x77, 0x71,
+    0x99, 0x99, 0x3A, 0xC5, 0x9F, 0xFA, 0x9D, 0xA3, 0xAF, 0xFF, 0xC3, 0xAF, 0xA9, 0x99, 0xAF, 0x92,
+    0x9E, 0xA5, 0xAF, 0x2F, 0x59, 0xFC, 0xA0, 0x9E, 0x6E, 0xAE, 0x0A, 0xE5, 0xAD, 0xA0, 0xE0, 0xEA,
+    0x49, 0xE1, 0xE9, 0xEA, 0x4E, 0x2E, 0xAE, 0x93, 0xE9, 0x2E, 0xAE, 0x92, 0xAD, 0xA3, 0xEA, 0xEA,
+    0x19, 0xE4, 0xEA, 0xAD, 0xA1, 0xE5, 0xE9, 0xAE, 0x0A, 0xDA, 0x5E, 0x90, 0xEA, 0xE5, 0xAE, 0x1F,
+    0xD6, 0xEA, 0x2F, 0x95, 0xF3, 0xAF, 0xA9, 0x99, 0xAF, 0x92, 0x9F, 0xFF, 0xC9, 0x3E, 0x9A, 0xFE,
+    0xA5, 0x9C, 0x93, 0x99, 0x97, 0x77, 0x20, 0x4A, 0xAA, 0xA7, 0x5A, 0xE9, 0x75, 0xF7, 0x6E, 0xA7,
+    0x6E, 0x97, 0x6E, 0x77, 0x99, 0x77, 0x77, 0x72, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97,
+    0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A, 0xE9,
+    0x59, 0xFC, 0x1F, 0xC9, 0x99, 0xAE, 0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6, 0x99,
+    0x97, 0x72, 0xAA, 0xAA, 0x74, 0xAE, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x49, 0xDA, 0x75, 0xDA, 0x76,
+    0x99, 0x77, 0x77, 0x74, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97,
+    0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0,
+    0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70,
+    0x9E, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A, 0xE9, 0x59, 0xFC, 0x1F, 0xC9,
+    0x99, 0xAE, 0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6, 0x99, 0x97, 0x69, 0xAA, 0xA9,
+    0x74, 0xFC, 0x73, 0xFE, 0x71, 0xAE, 0x0E, 0xA7, 0x9D, 0xA2, 0xAD, 0xA5, 0x9D, 0xA4, 0xAD, 0xA5,
+    0x97, 0x09, 0x97, 0x77, 0x76, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E,
+    0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09,
+    0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A, 0xE9, 0x59, 0xFC, 0x1F,
+    0xC9, 0x99, 0xAE, 0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6, 0x99, 0x97, 0x49, 0x95,
+    0x97, 0x9D, 0xA2, 0x9D, 0xA6, 0xAE, 0x2A, 0xE6, 0x9D, 0xA2, 0x9D, 0xA7, 0x09, 0x59, 0x77, 0x77,
+    0x77, 0x72, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0,
+    0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70,
+    0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E,
+    0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A, 0xE9, 0x59, 0xFC, 0x1F, 0xC9, 0x99, 0xAE,
+    0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6, 0x99, 0x97, 0x72, 0xAA, 0xAA, 0x76, 0xAE,
+    0x97, 0x6E, 0xA7, 0x6E, 0xA7, 0x69, 0xDA, 0x77, 0xDA, 0x77, 0x09, 0x97, 0x77, 0x77, 0x71, 0xAE,
+    0x72, 0xAE, 0x09, 0xE7, 0x2E, 0xA1, 0xEA, 0x70, 0x9E, 0x2A, 0xE7, 0x0A, 0xE3, 0xE9, 0x7E, 0x93,
+    0xAD, 0xA6, 0x9E, 0x49, 0xE6, 0xEA, 0x5E, 0x95, 0xE9, 0x5A, 0xE4, 0xAE, 0x7E, 0x4E, 0xA7, 0xAD,
+    0xA3, 0xE7, 0x09, 0xE2, 0xAD, 0xA7, 0x1E, 0x91, 0xE9, 0x71, 0xAD, 0xA0, 0x9E, 0x73, 0xE0, 0xAD,
+    0xA7, 0x3A, 0xD9, 0xE7, 0x49, 0xDA, 0xE7, 0x5F, 0xC9, 0x75, 0x9F, 0x77, 0xEA, 0x77, 0xE9, 0x76,
+    0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0xEA, 0x76, 0xAE, 0x72, 0xAC, 0xAF, 0xC9, 0x72, 0xAF, 0xD9,
+    0x73, 0x9F, 0xA7, 0x50, 0x9A, 0xA7, 0x6E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x5E, 0x97, 0x5E, 0x93, 0x99, 0x99, 0x5E, 0x90, 0x9F, 0xEA, 0x3E, 0x9A, 0xFF, 0xD2,
+    0xFE, 0x99, 0x99, 0xFC, 0x1F, 0xC9, 0x59, 0xEA, 0x0F, 0xA7, 0xAE, 0x0F, 0x71, 0xE9, 0xF7, 0x1E,
+    0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0xA7, 0x19, 0xFD,
+    0xA7, 0x1A, 0xFE, 0x71, 0xEA, 0xF7, 0x1E, 0x9F, 0xA7, 0xAE, 0x0F, 0xC9, 0x5A, 0xEA, 0x0F, 0xEA,
+    0x99, 0xAF, 0xC1, 0xE9, 0xAF, 0xFD, 0x2E, 0x90, 0x9F, 0xEA, 0x3E, 0x93, 0x99, 0x96, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0x49, 0x94,
+    0x99, 0x71, 0x9D, 0xA2, 0x9D, 0xA7, 0x0A, 0xE2, 0xAE, 0x70, 0x9D, 0xA2, 0x9D, 0xA7, 0x29, 0x59,
+    0x77, 0x77, 0x77, 0x77, 0x1A, 0xE7, 0x2A, 0xE0, 0x9E, 0x72, 0xEA, 0x1E, 0xA7, 0x09, 0xE2, 0xAE,
+    0x70, 0xAE, 0x3E, 0x97, 0xE9, 0x3A, 0xDA, 0x69, 0xE4, 0x9E, 0x6E, 0xA5, 0xE9, 0x5E, 0x95, 0xAE,
+    0x4A, 0xE7, 0xE4, 0xEA, 0x7A, 0xDA, 0x3E, 0x70, 0x9E, 0x2A, 0xDA, 0x71, 0xE9, 0x1E, 0x97, 0x1A,
+    0xDA, 0x09, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xAD, 0x9E, 0x74, 0x9D, 0xAE, 0x75, 0xFC, 0x97, 0x59,
+    0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0xA7, 0x69, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x2A,
+    0xCA, 0xFC, 0x97, 0x2A, 0xFD, 0x97, 0x39, 0xFA, 0x75, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x74,
+    0xAF, 0xFD, 0x97, 0x3A, 0xFF, 0xD9, 0x74, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0x0A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99,
+    0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3,
+    0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E,
+    0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E,
+    0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0,
+    0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5F, 0xFE, 0x5F, 0xFE, 0x59, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x72, 0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A,
+    0x7E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1,
+    0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7,
+    0x0A, 0xE0, 0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD,
+    0x2A, 0xFE, 0x91, 0xAD, 0x59, 0x99, 0x70, 0x5A, 0xC6, 0x9C, 0xA7, 0x3A, 0xCA, 0x5D, 0xA7, 0x39,
+    0xDA, 0x99, 0x9A, 0xE7, 0x5A, 0xFF, 0x97, 0x6A, 0xFD, 0x97, 0x72, 0x97, 0x77, 0x77, 0x77, 0x75,
+    0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D,
+    0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A,
+    0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7,
+    0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7,
+    0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x3C,
+    0xA6, 0xAC, 0x5D, 0x6D, 0x5A, 0xDA, 0x99, 0x9A, 0xDA, 0x6F, 0xFC, 0x70, 0xAF, 0xCA, 0x74, 0x97,
+    0x77, 0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7,
+    0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A,
+    0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70,
+    0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2,
+    0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x71, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD,
+    0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91,
+    0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71,
+    0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF,
+    0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7,
+    0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0,
+    0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x77, 0x3D, 0x97, 0x73, 0xDA, 0x77, 0x3A, 0xD7, 0x74, 0xDA,
+    0x77, 0x4D, 0x97, 0x74, 0xE7, 0x74, 0xFD, 0x77, 0x2F, 0xC7, 0x77, 0x79, 0x99, 0x97, 0x19, 0xFF,
+    0xC9, 0x5F, 0xFF, 0xA4, 0xAD, 0xA9, 0x90, 0x9A, 0xF5, 0xA7, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x76,
+    0xE7, 0x59, 0xE5, 0x9A, 0xAF, 0xFC, 0x39, 0xFF, 0xFC, 0x2A, 0xFA, 0xA9, 0x99, 0x09, 0xE1, 0xAE,
+    0xA6, 0x9E, 0x1E, 0xA7, 0x9E, 0x1E, 0x97, 0x9E, 0x09, 0xE7, 0x0A, 0xE1, 0xE9, 0x7F, 0x1F, 0x59,
+    0xFC, 0x1A, 0xF9, 0x99, 0x9E, 0xAE, 0x2F, 0xFD, 0xA0, 0xAD, 0x3A, 0xFE, 0x91, 0xAD, 0x69, 0x99,
+    0x4D, 0xA7, 0x5D, 0xA7, 0x5A, 0xD7, 0x6D, 0xA7, 0x6D, 0x97, 0x6E, 0x76, 0xFD, 0x74, 0xFC, 0x77,
+    0x10, 0x74, 0x9A, 0xAA, 0xA7, 0x7F, 0x77, 0x9E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x79, 0xD9, 0x77,
+    0x19, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x94, 0xFF, 0xFE, 0x39, 0xFC,
+    0x95, 0x9A, 0xCA, 0x3F, 0xA7, 0x6A, 0xEA, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x79, 0xE9,
+    0x77, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70,
+    0xAE, 0x77, 0x09, 0xE9, 0x77, 0x0E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x70, 0xF7, 0x70, 0x9F,
+    0x97, 0x7A, 0xFA, 0x70, 0x99, 0x4A, 0xFD, 0xAA, 0xAA, 0xF9, 0x5A, 0xFF, 0xFC, 0x97, 0xAF, 0xFD,
+    0xA7, 0x39, 0x99, 0x99, 0x50, 0x71, 0xAA, 0xAA, 0x71, 0x9E, 0xA7, 0x1E, 0xA7, 0x1A, 0xE7, 0x19,
+    0xE7, 0x2D, 0xA7, 0x39, 0x97, 0x77, 0x39, 0x99, 0x99, 0x69, 0xFF, 0xC9, 0x2A, 0xFF, 0xD9, 0x1A,
+    0xFA, 0x99, 0x9A, 0xD1, 0x9E, 0xA7, 0x1F, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x29, 0xF6,
+    0x92, 0xAF, 0xAA, 0x9A, 0xAD, 0x92, 0xAF, 0xFD, 0x93, 0x9A, 0xFE, 0xA7, 0x09, 0x99, 0x30, 0x71,
+    0xAA, 0xAA, 0x77, 0x9F, 0xA7, 0x6F, 0xDA, 0x74, 0xEA, 0x9E, 0x97, 0x2E, 0x92, 0xE9, 0x70, 0xAD,
+    0x94, 0xE9, 0x79, 0x97, 0x99, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xEA, 0x97, 0xAF, 0xFF, 0xC9, 0x4F,
+    0xFF, 0xE3, 0x9F, 0xC9, 0x59, 0xAC, 0xA3, 0xFA, 0x76, 0xAE, 0xA7, 0x7E, 0xA7, 0x7A, 0xE7, 0x70,
+    0xEA, 0x77, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7,
+    0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0x9E, 0x97, 0x70, 0xEA, 0x77, 0x0F, 0x77, 0x0A, 0xE9, 0x77,
+    0x0F, 0x77, 0x09, 0xF9, 0x77, 0xAF, 0xA7, 0x09, 0x94, 0xAF, 0xDA, 0xAA, 0xAF, 0x95, 0xAF, 0xFF,
+    0xC9, 0x7A, 0xFF, 0xDA, 0x73, 0x99, 0x99, 0x95, 0x6A, 0xAA, 0x97, 0x1F, 0xC7, 0x0A, 0xFD, 0x6A,
+    0xE0, 0xAD, 0xA4, 0x9E, 0x2A, 0xDA, 0x29, 0xDA, 0x49, 0xDA, 0x29, 0x70, 0x99, 0x77, 0x59, 0x99,
+    0x99, 0x69, 0xFF, 0xC9, 0x2A, 0xFF, 0xD9, 0x1A, 0xFA, 0x99, 0x9A, 0xD1, 0x9E, 0xA7, 0x1F, 0x71,
+    0x9E, 0x97, 0x1A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xF7, 0x29, 0xF6, 0x92, 0xAF, 0xAA, 0x9A, 0xAD, 0x92, 0xAF, 0xFD,
+    0x93, 0x9A, 0xFE, 0xA7, 0x09, 0x99, 0x30, 0x72, 0x9A, 0x77, 0x19, 0xE7, 0x70, 0xAE, 0x77, 0x09,
+    0xE7, 0x71, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFE, 0xA9, 0x7A, 0xFF, 0xFC, 0x94, 0xFF,
+    0xFE, 0x39, 0xFC, 0x95, 0x9A, 0xCA, 0x3F, 0xA7, 0x6A, 0xEA, 0x77, 0xEA, 0x77, 0xAE, 0x77, 0x0E,
+    0xA7, 0x79, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77,
+    0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x09, 0xE9, 0x77, 0x0E, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x70,
+    0xF7, 0x70, 0x9F, 0x97, 0x7A, 0xFA, 0x70, 0x99, 0x4A, 0xFD, 0xAA, 0xAA, 0xF9, 0x5A, 0xFF, 0xFC,
+    0x97, 0xAF, 0xFD, 0xA7, 0x39, 0x99, 0x99, 0x50, 0x69, 0xA9, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0xE9,
+    0x73, 0xA9, 0x77, 0x77, 0x71, 0x99, 0x99, 0x96, 0x9F, 0xFC, 0x92, 0xAF, 0xFD, 0x91, 0xAF, 0xA9,
+    0x99, 0xAD, 0x19, 0xEA, 0x71, 0xF7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xE9,
+    0x72, 0xE9, 0x72, 0xEA, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x97, 0x2F, 0x72, 0x9F, 0x69, 0x2A,
+    0xFA, 0xA9, 0xAA, 0xD9, 0x2A, 0xFF, 0xD9, 0x39, 0xAF, 0xEA, 0x70, 0x99, 0x93, 0x5A, 0xA9, 0x6A,
+    0xA9, 0x79, 0xDA, 0x39, 0xE7, 0x19, 0xE1, 0xAE, 0x73, 0xAE, 0xAE, 0x75, 0xAF, 0xC7, 0x7F, 0x97,
+    0x70, 0x99, 0x97, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xEA, 0x97, 0xAF, 0xFF, 0xC9, 0x4F, 0xFF, 0xE3,
+    0x9F, 0xC9, 0x59, 0xAC, 0xA3, 0xFA, 0x76, 0xAE, 0xA7, 0x7E, 0xA7, 0x7A, 0xE7, 0x70, 0xEA, 0x77,
+    0x9E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAE,
+    0x77, 0x0A, 0xE7, 0x70, 0x9E, 0x97, 0x70, 0xEA, 0x77, 0x0F, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77,
+    0x09, 0xF9, 0x77, 0xAF, 0xA7, 0x09, 0x94, 0xAF, 0xDA, 0xAA, 0xAF, 0x95, 0xAF, 0xFF, 0xC9, 0x7A,
+    0xFF, 0xDA, 0x73, 0x99, 0x99, 0x95, 0x19, 0xAA, 0x6A, 0xAA, 0x2E, 0x93, 0xE9, 0x3E, 0x91, 0xE9,
+    0x5E, 0xAE, 0x96, 0x9F, 0xCA, 0x70, 0xAF, 0x72, 0x99, 0x97, 0x77, 0x29, 0x99, 0x99, 0x69, 0xFF,
+    0xC9, 0x2A, 0xFF, 0xD9, 0x1A, 0xFA, 0x99, 0x9A, 0xD1, 0x9E, 0xA7, 0x1F, 0x71, 0x9E, 0x97, 0x1A,
+    0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x2A, 0xE7, 0x29,
+    0xE9, 0x72, 0xF7, 0x29, 0xF6, 0x92, 0xAF, 0xAA, 0x9A, 0xAD, 0x92, 0xAF, 0xFD, 0x93, 0x9A, 0xFE,
+    0xA7, 0x09, 0x99, 0x30, 0x3A, 0xAA, 0x6A, 0xAA, 0x72, 0xE4, 0xE7, 0x4E, 0x90, 0x9E, 0x75, 0x9E,
+    0xAE, 0x97, 0x69, 0xFC, 0x97, 0x70, 0xAE, 0xA7, 0x72, 0x99, 0x97, 0x77, 0x77, 0x77, 0x09, 0xFF,
+    0xCA, 0xA9, 0x71, 0x9F, 0xFF, 0xD9, 0x69, 0xFF, 0xFF, 0x94, 0x9E, 0x59, 0x9A, 0xFC, 0x93, 0x9E,
+    0x71, 0xAF, 0x92, 0x9E, 0x72, 0x9F, 0x29, 0xE7, 0x39, 0xEA, 0x19, 0xE7, 0x4A, 0xE1, 0x9E, 0x74,
+    0x9E, 0x90, 0x9E, 0x75, 0xEA, 0x09, 0xE7, 0x5A, 0xE0, 0x9E, 0x75, 0xAE, 0x09, 0xE7, 0x59, 0xE0,
+    0x9E, 0x75, 0x9E, 0x09, 0xE7, 0x5A, 0xE0, 0x9E, 0x75, 0xAE, 0x09, 0xE7, 0x5A, 0xE0, 0x9E, 0x75,
+    0xEA, 0x09, 0xE7, 0x49, 0xE9, 0x09, 0xE7, 0x4F, 0x19, 0xE7, 0x39, 0xEA, 0x19, 0xE7, 0x29, 0xF2,
+    0x9E, 0x71, 0xAF, 0x92, 0x9E, 0x69, 0xAF, 0xC9, 0x39, 0xFF, 0xFF, 0x94, 0x9F, 0xFF, 0xDA, 0x69,
+    0xFF, 0xDA, 0xA9, 0x70, 0x76, 0xAA, 0x91, 0x9A, 0xA9, 0x75, 0x9E, 0x1A, 0xDA, 0x75, 0x9E, 0x1E,
+    0x76, 0x9E, 0x1E, 0x76, 0x9E, 0x09, 0xD9, 0x76, 0x9E, 0x0A, 0xCA, 0x77, 0x9E, 0x09, 0xA7, 0x70,
+    0x9E, 0x73, 0x99, 0x99, 0x39, 0xE7, 0x1A, 0xFE, 0x90, 0x9E, 0x70, 0xFF, 0xDA, 0x9E, 0x7F, 0xC9,
+    0x99, 0x9A, 0xFD, 0x6A, 0xEA, 0x59, 0xFC, 0x6E, 0xA7, 0xAF, 0x59, 0xE7, 0x1F, 0x5A, 0xE7, 0x1F,
+    0x5E, 0xA7, 0x1A, 0xE5, 0xEA, 0x71, 0x9E, 0x5E, 0x97, 0x19, 0xE5, 0xE9, 0x71, 0x9E, 0x5E, 0xA7,
+    0x19, 0xE5, 0xEA, 0x71, 0xAE, 0x5A, 0xE7, 0x1A, 0xE5, 0x9E, 0x71, 0xF6, 0xEA, 0x79, 0xF6, 0xAE,
+    0xA5, 0x9F, 0xC7, 0xFC, 0xA9, 0x9A, 0xEA, 0xE7, 0x0F, 0xFD, 0x90, 0xE7, 0x19, 0xFE, 0x91, 0xE7,
+    0x49, 0x99, 0x75, 0x2F, 0xFC, 0xAA, 0x97, 0x4F, 0xFF, 0xD9, 0x71, 0xFF, 0xFF, 0x97, 0xE9, 0x49,
+    0x9A, 0xFC, 0x96, 0xE9, 0x70, 0xAF, 0x95, 0xE9, 0x71, 0x9F, 0x5E, 0x97, 0x29, 0xEA, 0x4E, 0x97,
+    0x3A, 0xE4, 0xE9, 0x73, 0x9E, 0x93, 0xE9, 0x74, 0xEA, 0x3E, 0x97, 0x4A, 0xE3, 0xE9, 0x74, 0xAE,
+    0x0A, 0xAA, 0xFA, 0xAA, 0xAA, 0xA6, 0x9E, 0x0F, 0xFF, 0xC6, 0x9E, 0x0F, 0xFF, 0xC6, 0xAE, 0x29,
+    0xE9, 0x74, 0xAE, 0x3E, 0x97, 0x4A, 0xE3, 0xE9, 0x74, 0xEA, 0x3E, 0x97, 0x39, 0xE9, 0x3E, 0x97,
+    0x3F, 0x4E, 0x97, 0x29, 0xEA, 0x4E, 0x97, 0x19, 0xF5, 0xE9, 0x70, 0xAF, 0x95, 0xE9, 0x59, 0xAF,
+    0xC9, 0x6F, 0xFF, 0xF9, 0x7F, 0xFF, 0xDA, 0x71, 0xFF, 0xDA, 0xA9, 0x70, 0x76, 0xAA, 0x97, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0xAE, 0x70, 0x9F, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0xA6, 0x99, 0x99,
+    0x99, 0x9A, 0xE9, 0x97, 0x69, 0xE7, 0x19, 0x99, 0x39, 0xE6, 0x9F, 0xE9, 0x09, 0xE5, 0xFF, 0xDA,
+    0x9E, 0x4F, 0xCA, 0x99, 0xAE, 0xAE, 0x3A, 0xEA, 0x59, 0xFC, 0x3F, 0x7A, 0xF2, 0x9E, 0x97, 0x0F,
+    0x2A, 0xE7, 0x1F, 0x2E, 0xA7, 0x1A, 0xE2, 0xEA, 0x71, 0x9E, 0x2E, 0xA7, 0x19, 0xE2, 0xEA, 0x71,
+    0x9E, 0x2E, 0xA7, 0x19, 0xE2, 0xEA, 0x71, 0xAE, 0x2A, 0xE7, 0x1A, 0xE2, 0x9E, 0x71, 0xF3, 0xEA,
+    0x79, 0xF3, 0xAE, 0xA5, 0x9F, 0xC4, 0xFC, 0xA9, 0x9A, 0xEA, 0xE5, 0xFF, 0xD9, 0x0E, 0x69, 0xFE,
+    0x91, 0xE7, 0x19, 0x99, 0x72, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x4F, 0xFE, 0x4F, 0xFE, 0x49,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x19, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD,
+    0xA9, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x09, 0xE9, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA0,
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x6F, 0xFE, 0x6F, 0xFE, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x74, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E,
+    0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E,
+    0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75,
+    0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE,
+    0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x19, 0xCA, 0x6A, 0xC4, 0xD5, 0x9D,
+    0x4E, 0xA9, 0x99, 0xAD, 0xA5, 0xFF, 0xC7, 0xFD, 0xA7, 0x39, 0x77, 0x77, 0x69, 0xFF, 0xFD, 0x99,
+    0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09,
+    0xFF, 0xFD, 0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF,
+    0xFD, 0xA9, 0xFF, 0xFD, 0xA0, 0x2C, 0xA6, 0x9C, 0x95, 0xD9, 0x5D, 0x95, 0xAD, 0xA9, 0x99, 0xAE,
+    0x7F, 0xFC, 0x71, 0xAF, 0xCA, 0x75, 0x97, 0x77, 0x71, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF,
+    0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0,
+    0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F,
+    0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99,
+    0x95, 0x69, 0xA9, 0x73, 0x9E, 0x73, 0x9E, 0x97, 0x3E, 0x74, 0x9A, 0x97, 0x77, 0x77, 0x75, 0x9F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F,
+    0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x7A, 0x97, 0x6E, 0x97, 0x5E, 0xA7, 0x5E, 0x97, 0x6A,
+    0x97, 0x77, 0x77, 0x72, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F,
+    0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA,
+    0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+    0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9,
+    0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x9F, 0xFF, 0xD9, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F,
+    0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x72, 0xAD, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x4A, 0xD9,
+    0x73, 0x9F, 0xC9, 0x71, 0xAF, 0x97, 0x70, 0x69, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF, 0xFD, 0x94,
+    0xAF, 0x90, 0x99, 0xF9, 0x29, 0xE9, 0x5A, 0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE, 0x0A, 0xE7,
+    0x09, 0xE0, 0xAD, 0xA7, 0x09, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x0E, 0xA7, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x09,
+    0x92, 0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xCA, 0x71, 0x99, 0x99, 0xDA,
+    0x75, 0xDA, 0x75, 0x9D, 0x76, 0xDA, 0x76, 0xDA, 0x76, 0xE7, 0x6A, 0xFC, 0x74, 0xFC, 0x77, 0x30,
+    0x1A, 0xAA, 0x6A, 0xAA, 0x29, 0xE3, 0x9E, 0x49, 0xE1, 0x9E, 0x69, 0xEA, 0xE7, 0x0A, 0xFC, 0x97,
+    0x1F, 0xA7, 0x39, 0x99, 0x77, 0x77, 0x59, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x09, 0xE9, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA0, 0x19,
+    0xAA, 0x6A, 0xAA, 0x5E, 0x93, 0xE9, 0x6E, 0x91, 0xE9, 0x70, 0xEA, 0xE9, 0x71, 0x9F, 0xCA, 0x73,
+    0xAF, 0x75, 0x99, 0x97, 0x77, 0x70, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9,
+    0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E,
+    0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29,
+    0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x72, 0xAA,
+    0xAA, 0x77, 0x19, 0xFA, 0x77, 0x0F, 0xD9, 0x76, 0xE9, 0x9E, 0x97, 0x4E, 0x92, 0xE7, 0x3E, 0x94,
+    0xE7, 0x29, 0x97, 0x99, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFF, 0xA9, 0x70, 0x9F, 0xFF, 0xE5, 0xAF,
+    0xFF, 0xEA, 0x4F, 0xCA, 0x96, 0x9D, 0x4F, 0xC7, 0x70, 0xAE, 0xA7, 0x71, 0xF7, 0x71, 0xAE, 0x77,
+    0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xAE, 0x77, 0x2A, 0xE7, 0x0A,
+    0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA,
+    0x0E, 0xA7, 0x5E, 0xA0, 0xF7, 0x5E, 0xA0, 0x9E, 0x97, 0x4E, 0xA1, 0xF9, 0x73, 0xEA, 0x19, 0xF9,
+    0x72, 0xEA, 0x2A, 0xFA, 0x71, 0xEA, 0x3A, 0xFD, 0xAA, 0xAA, 0xAA, 0xFC, 0xA4, 0x9F, 0xFF, 0xFA,
+    0x69, 0xAF, 0xFE, 0xA9, 0x73, 0x99, 0x99, 0x96, 0x6A, 0xAA, 0xA7, 0x49, 0xFA, 0x73, 0xFD, 0x97,
+    0x1E, 0x99, 0xE9, 0x7E, 0x91, 0x9E, 0x6E, 0x5E, 0x59, 0x97, 0x99, 0x77, 0x72, 0x99, 0x99, 0x73,
+    0xAF, 0xE9, 0x1E, 0x2F, 0xFD, 0xA0, 0xE1, 0xFC, 0x99, 0x99, 0xEA, 0xE0, 0x9E, 0xA5, 0x9F, 0xC0,
+    0xEA, 0x7A, 0xF9, 0xE7, 0x1F, 0xAE, 0x71, 0xAF, 0xDA, 0x71, 0xAF, 0xDA, 0x71, 0x9F, 0xD9, 0x71,
+    0x9F, 0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0x9E, 0xAE, 0x71, 0xAE, 0x9E, 0x71, 0xF0,
+    0xEA, 0x79, 0xF0, 0x9E, 0xA5, 0x9F, 0xC1, 0xFC, 0x99, 0x99, 0xFE, 0x2F, 0xFD, 0xA9, 0xE3, 0x9F,
+    0xE9, 0x09, 0xE6, 0x99, 0x93, 0x9E, 0x75, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x4A, 0xE1, 0x9C,
+    0xA9, 0x6A, 0xEA, 0x19, 0xFD, 0xAF, 0xE2, 0x9F, 0xFF, 0xA5, 0x9A, 0xFE, 0xA4, 0x69, 0xC9, 0x6C,
+    0xA7, 0x29, 0xD5, 0xAD, 0x73, 0xEA, 0x99, 0xAE, 0x97, 0x39, 0xFF, 0xA7, 0x59, 0xFD, 0x97, 0x71,
+    0x99, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xFF, 0xA9, 0x70, 0x9F, 0xFF, 0xE5, 0xAF, 0xFF, 0xEA, 0x4F,
+    0xCA, 0x96, 0x9D, 0x4F, 0xC7, 0x70, 0xAE, 0xA7, 0x71, 0xF7, 0x71, 0xAE, 0x77, 0x2E, 0xA7, 0x71,
+    0x9E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xAE, 0x77, 0x2A, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7,
+    0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x6E, 0xA9, 0xE9, 0x75, 0xEA, 0x0E, 0xA7, 0x5E,
+    0xA0, 0xF7, 0x5E, 0xA0, 0x9E, 0x97, 0x4E, 0xA1, 0xF9, 0x73, 0xEA, 0x19, 0xF9, 0x72, 0xEA, 0x2A,
+    0xFA, 0x71, 0xEA, 0x3A, 0xFD, 0xAA, 0xAA, 0xAA, 0xFC, 0xA4, 0x9F, 0xFF, 0xFA, 0x69, 0xAF, 0xFE,
+    0xA9, 0x73, 0x99, 0x99, 0x96, 0x2A, 0xC9, 0x6C, 0xA5, 0xAC, 0xA5, 0xAC, 0xA6, 0xEA, 0x99, 0xAE,
+    0x96, 0xAF, 0xFA, 0x70, 0x9F, 0xD9, 0x74, 0x99, 0x77, 0x77, 0x99, 0x99, 0x73, 0xAF, 0xE9, 0x1E,
+    0x2F, 0xFD, 0xA0, 0xE1, 0xFC, 0x99, 0x99, 0xEA, 0xE0, 0x9E, 0xA5, 0x9F, 0xC0, 0xEA, 0x7A, 0xF9,
+    0xE7, 0x1F, 0xAE, 0x71, 0xAF, 0xDA, 0x71, 0xAF, 0xDA, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xD9, 0x71,
+    0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0x9E, 0xAE, 0x71, 0xAE, 0x9E, 0x71, 0xF0, 0xEA, 0x79, 0xF0,
+    0x9E, 0xA5, 0x9F, 0xC1, 0xFC, 0x99, 0x99, 0xFE, 0x2F, 0xFD, 0xA9, 0xE3, 0x9F, 0xE9, 0x09, 0xE6,
+    0x99, 0x93, 0x9E, 0x75, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x4A, 0xE1, 0x9C, 0xA9, 0x6A, 0xEA,
+    0x19, 0xFD, 0xAF, 0xE2, 0x9F, 0xFF, 0xA5, 0x9A, 0xFE, 0xA4, 0x73, 0x9A, 0x77, 0x3A, 0xE7, 0x72,
+    0xAE, 0x77, 0x29, 0xE7, 0x73, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAF, 0xFA, 0x97, 0x09,
+    0xFF, 0xFE, 0x5A, 0xFF, 0xFE, 0xA4, 0xFC, 0xA9, 0x69, 0xD4, 0xFC, 0x77, 0x0A, 0xEA, 0x77, 0x1F,
+    0x77, 0x1A, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xE9, 0x77, 0x19, 0xE7, 0x72, 0xAE, 0x77, 0x2A, 0xE7,
+    0x72, 0xAE, 0x70, 0xAF, 0xFA, 0xAE, 0x70, 0xAF, 0xFA, 0xAE, 0x70, 0xAF, 0xFA, 0xAE, 0x76, 0xEA,
+    0x9E, 0x97, 0x5E, 0xA0, 0xEA, 0x75, 0xEA, 0x0F, 0x75, 0xEA, 0x09, 0xE9, 0x74, 0xEA, 0x1F, 0x97,
+    0x3E, 0xA1, 0x9F, 0x97, 0x2E, 0xA2, 0xAF, 0xA7, 0x1E, 0xA3, 0xAF, 0xDA, 0xAA, 0xAA, 0xAF, 0xCA,
+    0x49, 0xFF, 0xFF, 0xA6, 0x9A, 0xFF, 0xEA, 0x97, 0x39, 0x99, 0x99, 0x60, 0x7A, 0xA7, 0x6A, 0xE7,
+    0x5F, 0x75, 0xAE, 0x76, 0x9A, 0x77, 0x77, 0x77, 0x19, 0x99, 0x97, 0x3A, 0xFE, 0x91, 0xE2, 0xFF,
+    0xDA, 0x0E, 0x1F, 0xC9, 0x99, 0x9E, 0xAE, 0x09, 0xEA, 0x59, 0xFC, 0x0E, 0xA7, 0xAF, 0x9E, 0x71,
+    0xFA, 0xE7, 0x1A, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0x97, 0x19, 0xFD,
+    0xA7, 0x19, 0xFD, 0xA7, 0x19, 0xEA, 0xE7, 0x1A, 0xE9, 0xE7, 0x1F, 0x0E, 0xA7, 0x9F, 0x09, 0xEA,
+    0x59, 0xFC, 0x1F, 0xC9, 0x99, 0x9F, 0xE2, 0xFF, 0xDA, 0x9E, 0x39, 0xFE, 0x90, 0x9E, 0x69, 0x99,
+    0x39, 0xE7, 0x59, 0xE7, 0x5A, 0xDA, 0x75, 0xE9, 0x74, 0xAE, 0x19, 0xCA, 0x96, 0xAE, 0xA1, 0x9F,
+    0xDA, 0xFE, 0x29, 0xFF, 0xFA, 0x59, 0xAF, 0xEA, 0x40, 0x77, 0x76, 0x9A, 0xFF, 0xA9, 0x70, 0x9F,
+    0xFF, 0xE5, 0xAF, 0xFF, 0xEA, 0x4F, 0xCA, 0x96, 0x9D, 0x4F, 0xC7, 0x70, 0xAE, 0xA7, 0x71, 0xF7,
+    0x71, 0xAE, 0x77, 0x2E, 0xA7, 0x71, 0x9E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xAE, 0x77,
+    0x2A, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x0A, 0xFF, 0xAA, 0xE7, 0x6E, 0xA9,
+    0xE9, 0x75, 0xEA, 0x0E, 0xA7, 0x5E, 0xA0, 0xF7, 0x5E, 0xA0, 0x9E, 0x97, 0x4E, 0xA1, 0xF9, 0x73,
+    0xEA, 0x19, 0xF9, 0x72, 0xEA, 0x2A, 0xFA, 0x71, 0xEA, 0x3A, 0xFD, 0xAA, 0xAA, 0xAA, 0xFC, 0xA4,
+    0x9F, 0xFF, 0xFA, 0x69, 0xAF, 0xFE, 0xA9, 0x73, 0x99, 0x99, 0x97, 0x77, 0x77, 0x1A, 0xAA, 0x97,
+    0x72, 0xE7, 0x73, 0xE7, 0x72, 0x9D, 0x97, 0x72, 0xDA, 0x77, 0x3D, 0x77, 0x49, 0x72, 0x70, 0x9A,
+    0x97, 0x6D, 0x97, 0x5A, 0xD7, 0x6D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x69, 0x99, 0x77, 0x77, 0x99,
+    0x99, 0x73, 0xAF, 0xE9, 0x1E, 0x2F, 0xFD, 0xA0, 0xE1, 0xFC, 0x99, 0x99, 0xEA, 0xE0, 0x9E, 0xA5,
+    0x9F, 0xC0, 0xEA, 0x7A, 0xF9, 0xE7, 0x1F, 0xAE, 0x71, 0xAF, 0xDA, 0x71, 0xAF, 0xDA, 0x71, 0x9F,
+    0xD9, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x71, 0x9E, 0xAE, 0x71, 0xAE, 0x9E,
+    0x71, 0xF0, 0xEA, 0x79, 0xF0, 0x9E, 0xA5, 0x9F, 0xC1, 0xFC, 0x99, 0x99, 0xFE, 0x2F, 0xFD, 0xA9,
+    0xE3, 0x9F, 0xE9, 0x09, 0xE6, 0x99, 0x93, 0x9E, 0x75, 0x9E, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x4A,
+    0xE1, 0x9C, 0xA9, 0x6A, 0xEA, 0x19, 0xFD, 0xAF, 0xE2, 0x9F, 0xFF, 0xA5, 0x9A, 0xFE, 0xA4, 0x70,
+    0xAA, 0xAA, 0x77, 0x0A, 0xF9, 0x76, 0x9F, 0xD7, 0x59, 0xE9, 0xAE, 0x74, 0xE2, 0x9E, 0x72, 0xE4,
+    0x9E, 0x71, 0x99, 0x79, 0x97, 0x77, 0x77, 0x70, 0x9E, 0x75, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7,
+    0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0,
+    0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE0, 0x9F, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xF0, 0x9E, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74,
+    0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09,
+    0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49,
+    0xE0, 0x4A, 0xAA, 0xA7, 0x71, 0xAF, 0x97, 0x79, 0xFD, 0x76, 0x9E, 0x0A, 0xE7, 0x5E, 0x29, 0xE7,
+    0x3E, 0x49, 0xE7, 0x29, 0x97, 0x99, 0x77, 0x77, 0x59, 0xAA, 0x77, 0x3E, 0x97, 0x72, 0xE9, 0x77,
+    0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2E, 0x97, 0x72, 0xE9, 0x77, 0x2E, 0x97, 0x72, 0xE9, 0x39, 0x99,
+    0x97, 0x2E, 0x90, 0x9F, 0xF9, 0x7E, 0x9A, 0xFF, 0xD9, 0x6E, 0xAE, 0xA9, 0x99, 0xAF, 0x6F, 0xC9,
+    0x59, 0xEA, 0x5F, 0xA7, 0xAE, 0x5F, 0x70, 0x9E, 0x5F, 0x71, 0xE5, 0xEA, 0x71, 0xE5, 0xEA, 0x71,
+    0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5,
+    0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9, 0x71, 0xE5, 0xE9,
+    0x71, 0xE0, 0x29, 0xE7, 0x5E, 0x69, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE3,
+    0x99, 0x9A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9E, 0x99, 0x90, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x99, 0x9A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAE, 0x99, 0x99, 0x29,
+    0xE7, 0x49, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE6, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x9A, 0xE6, 0x9F, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0xF6, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49,
+    0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE6, 0x9E,
+    0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0x9E, 0x69, 0xE7, 0x49, 0xE3, 0x29, 0xAA, 0x77,
+    0x1E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0xA7, 0x5A, 0xFF, 0xFC, 0x95, 0xAF, 0xFF, 0xC9, 0x69, 0x9E,
+    0xA9, 0x99, 0x99, 0x99, 0x71, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x29, 0xAA, 0xAA, 0x97, 0xE9,
+    0x0A, 0xFF, 0xA5, 0xE9, 0xFF, 0xEA, 0x4F, 0xDA, 0x92, 0x9F, 0x93, 0xFC, 0x7E, 0xA3, 0xF9, 0x7A,
+    0xE3, 0xF7, 0x1E, 0x3E, 0xA7, 0x1E, 0x3E, 0xA7, 0x1E, 0x3E, 0xA7, 0x1E, 0x3E, 0x97, 0x1E, 0x3E,
+    0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97,
+    0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x3E, 0x97, 0x1E, 0x00, 0x29, 0xA9, 0x59, 0xA2, 0xFC,
+    0xA3, 0xD1, 0xAF, 0xEA, 0x9E, 0x1D, 0x90, 0x9F, 0xE9, 0x09, 0xCA, 0x39, 0xF9, 0x29, 0x77, 0x77,
+    0x74, 0x9F, 0xFC, 0x4A, 0xFF, 0xC5, 0x9A, 0xFC, 0xA9, 0x79, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29,
+    0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29,
+    0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29,
+    0xE7, 0x29, 0xE7, 0x19, 0xAE, 0xA9, 0x59, 0xFF, 0xC4, 0xAF, 0xFC, 0x20, 0x39, 0x99, 0x5A, 0x91,
+    0x9F, 0xC9, 0x2A, 0xCA, 0x1F, 0xEA, 0x9A, 0xD1, 0xAC, 0xA1, 0xAF, 0xDA, 0x1D, 0x4A, 0xEA, 0x29,
+    0x97, 0x77, 0x77, 0x7E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E,
+    0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E,
+    0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x94, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x0F, 0xFE, 0x0F, 0xFE, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x70, 0x9F, 0xFC, 0x1A,
+    0xFF, 0xC2, 0x9A, 0xFC, 0xA9, 0x49, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+    0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xE7, 0x9E,
+    0x79, 0xE7, 0x9E, 0x79, 0xE6, 0x9A, 0xEA, 0x92, 0x9F, 0xFC, 0x1A, 0xFF, 0xC0, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0xFF, 0xE9, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x4E, 0x97,
+    0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9,
+    0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x30, 0x9C, 0x96, 0xAC,
+    0x09, 0xD5, 0x9D, 0x1E, 0xA9, 0x99, 0xAD, 0xA1, 0x9F, 0xFC, 0x39, 0xFD, 0xA7, 0x09, 0x77, 0x77,
+    0x09, 0xFF, 0xC2, 0xAF, 0xFC, 0x39, 0xAF, 0xCA, 0x95, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E,
+    0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E,
+    0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E, 0x70, 0x9E,
+    0x70, 0x9E, 0x79, 0xAE, 0xA9, 0x39, 0xFF, 0xC2, 0xAF, 0xFC, 0x10, 0x0A, 0xC6, 0x9C, 0x90, 0xD9,
+    0x5D, 0x90, 0x9D, 0xA9, 0x99, 0xAE, 0x2F, 0xFC, 0x93, 0xAF, 0xD7, 0x09, 0x77, 0x77, 0x4E, 0x97,
+    0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97,
+    0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97,
+    0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x93, 0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA,
+    0x91, 0x9F, 0xFC, 0x0A, 0xFF, 0xC6, 0xDA, 0x6A, 0xD6, 0x9D, 0x7E, 0x7D, 0xA7, 0xE7, 0xAF, 0xC5,
+    0xAF, 0x73, 0x2A, 0xA3, 0xEA, 0x2F, 0x2E, 0xA3, 0xA9, 0x77, 0x70, 0xE9, 0x2E, 0x92, 0xE9, 0x2E,
+    0x92, 0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92,
+    0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92, 0xE9, 0x2E, 0x92, 0xAC, 0xA2, 0xAD, 0x29, 0xD3, 0xE3, 0xDA,
+    0x3E, 0x3A, 0xFC, 0x1A, 0xF7, 0x39, 0xA9, 0x69, 0xE6, 0xAE, 0x95, 0x9E, 0x79, 0xA7, 0x77, 0x75,
+    0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F, 0xFC, 0x0A, 0xFF, 0xC0,
+    0x3E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+    0x9E, 0x9E, 0x9E, 0x9E, 0x90, 0x9F, 0xFC, 0x4A, 0xD9, 0xAF, 0xFC, 0x4E, 0xA0, 0x9A, 0xFC, 0xA9,
+    0x4E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E,
+    0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2,
+    0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E,
+    0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E, 0xA2, 0x9E, 0x7E,
+    0xA1, 0x9A, 0xEA, 0x95, 0xEA, 0x9F, 0xFC, 0x4E, 0xAA, 0xFF, 0xC4, 0xEA, 0x76, 0xEA, 0x76, 0xE9,
+    0x75, 0x9E, 0x75, 0x9F, 0x71, 0xFF, 0x97, 0x1F, 0xE9, 0x72, 0xFC, 0xA7, 0x76, 0x1A, 0xA6, 0x9A,
+    0x91, 0xEA, 0x5E, 0x90, 0xF4, 0x9E, 0x90, 0xEA, 0x5E, 0x2A, 0x96, 0x9A, 0x97, 0x77, 0x77, 0x6E,
+    0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95,
+    0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1,
+    0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9, 0x5E, 0x1E, 0x95, 0xE1, 0xE9,
+    0x5E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x72, 0x9E, 0x72, 0xF5, 0x9F, 0xE9, 0x59, 0xFD, 0xA7,
+    0xFC, 0x92, 0x5A, 0xAA, 0xA7, 0x19, 0xFA, 0x70, 0xFD, 0x96, 0xE9, 0x9E, 0x94, 0xE9, 0x19, 0xE3,
+    0xE5, 0xE2, 0x99, 0x79, 0x97, 0x77, 0x74, 0x9D, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A,
+    0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A,
+    0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A,
+    0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2A,
+    0xDA, 0x72, 0xE9, 0x71, 0xF5, 0xFF, 0xA5, 0xFE, 0xA6, 0xAF, 0xA9, 0x77, 0x60, 0x5A, 0xAA, 0xA7,
+    0x1A, 0xF9, 0x7A, 0xFD, 0x69, 0xE0, 0xAE, 0x49, 0xE2, 0xAE, 0x3D, 0xA4, 0x9E, 0x29, 0x97, 0x99,
+    0x77, 0x77, 0x4E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97, 0x2E, 0x97,
+    0x2E, 0x97, 0x2E, 0x97, 0x1A, 0xE6, 0xFE, 0xA6, 0xFE, 0x7A, 0xFA, 0x70, 0x9E, 0x72, 0x9E, 0x90,
+    0x9E, 0x71, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x29, 0xE7, 0x0F, 0x39, 0xE7, 0xF4, 0x9E, 0x6F, 0x59,
+    0xE5, 0xAE, 0x69, 0xE4, 0xAE, 0x79, 0xE3, 0xAE, 0x97, 0x9E, 0x29, 0xE9, 0x70, 0x9E, 0x19, 0xE9,
+    0x71, 0x9E, 0x09, 0xEA, 0x72, 0x9E, 0x0F, 0xA7, 0x29, 0xFF, 0xC9, 0x71, 0x9F, 0xCA, 0xF7, 0x19,
+    0xF9, 0x09, 0xF7, 0x09, 0xE3, 0xAE, 0xA7, 0x9E, 0x4F, 0x96, 0x9E, 0x5F, 0x69, 0xE5, 0x9E, 0xA5,
+    0x9E, 0x6A, 0xE9, 0x49, 0xE7, 0xF4, 0x9E, 0x70, 0xF3, 0x9E, 0x70, 0x9E, 0xA2, 0x9E, 0x71, 0xAE,
+    0x91, 0x9E, 0x72, 0xF1, 0x9E, 0x73, 0xF7, 0x77, 0x77, 0x72, 0x9A, 0xAA, 0x77, 0x0A, 0xDA, 0x77,
+    0x0E, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x77, 0x1D, 0x97, 0x71, 0x99, 0x73, 0x9A, 0xA7, 0x5E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x96,
+    0x9E, 0xA0, 0xE9, 0x59, 0xEA, 0x1E, 0x95, 0xEA, 0x2E, 0x94, 0xEA, 0x3E, 0x93, 0xEA, 0x4E, 0x92,
+    0xF5, 0xE9, 0x1F, 0x6E, 0x90, 0xF7, 0xE9, 0xAE, 0x70, 0xEA, 0xFA, 0x7F, 0xFC, 0xA6, 0xFA, 0x0A,
+    0xE9, 0x5E, 0xA2, 0xF5, 0xE9, 0x3F, 0x4E, 0x93, 0x9E, 0xA3, 0xE9, 0x4A, 0xE9, 0x2E, 0x95, 0xF2,
+    0xE9, 0x6F, 0x1E, 0x96, 0x9E, 0xA0, 0xE9, 0x7A, 0xE9, 0x77, 0x77, 0x7A, 0xAA, 0x97, 0x4E, 0x74,
+    0x9D, 0xA7, 0x4A, 0xD7, 0x5D, 0xA7, 0x5D, 0x76, 0x97, 0x20, 0x77, 0x0E, 0xA6, 0x9E, 0xA0, 0xEA,
+    0x59, 0xEA, 0x1E, 0xA5, 0xF2, 0xEA, 0x4F, 0x3E, 0xA3, 0xF4, 0xEA, 0x2A, 0xE9, 0x4E, 0xA1, 0x9E,
+    0x95, 0xEA, 0x09, 0xEA, 0x6E, 0xA0, 0xEA, 0x7E, 0xAF, 0xC7, 0xFF, 0xCA, 0x6F, 0xC9, 0x9E, 0x95,
+    0xF9, 0x1A, 0xE5, 0xEA, 0x3F, 0x4E, 0xA3, 0x9E, 0xA3, 0xEA, 0x4A, 0xE9, 0x2E, 0xA5, 0xF2, 0xEA,
+    0x6F, 0x1E, 0xA6, 0x9E, 0xA0, 0xEA, 0x7A, 0xE9, 0x29, 0xAA, 0xAA, 0x72, 0xF7, 0x29, 0xE9, 0x72,
+    0xE9, 0x72, 0xE9, 0x72, 0x9D, 0x97, 0x49, 0x77, 0x77, 0x75, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA,
+    0x9F, 0xFF, 0xDA, 0x3A, 0xAA, 0xA3, 0x9E, 0xA3, 0xF3, 0xAE, 0x4E, 0x4E, 0x59, 0x97, 0x79, 0xAA,
+    0x5E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x30, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x77, 0x77, 0x69, 0xAA, 0x97, 0x3E, 0x97, 0x3E, 0x73, 0x9D, 0x97, 0x3A,
+    0xD7, 0x4D, 0x97, 0x49, 0x70, 0x09, 0xAA, 0x2E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9,
+    0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E,
+    0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x91,
+    0xE9, 0x76, 0xAA, 0xA2, 0xE1, 0x9D, 0xA1, 0xAD, 0x2D, 0x91, 0x9D, 0x39, 0x30, 0x9E, 0x79, 0xDA,
+    0x9E, 0x7E, 0x99, 0xE7, 0xE0, 0x9E, 0x7D, 0xA0, 0x9E, 0x69, 0xD1, 0x9E, 0x6A, 0xC9, 0x19, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA0, 0x9A, 0xA2, 0x9A, 0xA9,
+    0xE9, 0x1E, 0x9E, 0x91, 0xE0, 0xE9, 0x1D, 0xA0, 0xE9, 0x09, 0xD1, 0xE9, 0x0A, 0xCA, 0x1E, 0x90,
+    0x99, 0x2E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9,
+    0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E,
+    0x95, 0xE9, 0x50, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x59, 0xA9, 0x29, 0xE4, 0x9E, 0x29,
+    0xE4, 0xAE, 0x29, 0xE4, 0x9E, 0x29, 0xE5, 0x9A, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF,
+    0xFD, 0xA0, 0x9A, 0xA5, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x91, 0xAA, 0x0E, 0x90, 0xEA, 0xE9, 0x0E, 0xAE, 0x90, 0xEA, 0xE9,
+    0x1A, 0x90, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E,
+    0x94, 0xE9, 0x4E, 0x94, 0x29, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7,
+    0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE2, 0x9C, 0xA7, 0x09, 0xE1, 0xF7, 0x09,
+    0xEA, 0xFA, 0x70, 0x9F, 0xDA, 0x72, 0x9F, 0xC9, 0x72, 0xAF, 0x97, 0x29, 0xFD, 0x74, 0xFD, 0x74,
+    0x99, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9F, 0xFF, 0xDA,
+    0x29, 0xFF, 0xFD, 0xA2, 0x9F, 0xFF, 0xDA, 0x3A, 0xAA, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE1, 0x95, 0xE9, 0xD9, 0x4F, 0xE4, 0xFC,
+    0xA4, 0xAF, 0x94, 0xFC, 0x5F, 0xD5, 0xAC, 0xAE, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x40, 0x73, 0x9A, 0xAA, 0xA7, 0x70, 0xF7, 0x70, 0x9E,
+    0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0x9D, 0x97, 0x72, 0x97, 0x77, 0x77, 0x76, 0x9E, 0xA7,
+    0x5D, 0xA9, 0xF9, 0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29, 0xE9, 0xFD, 0x97, 0x19,
+    0xE9, 0xDA, 0xF7, 0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A, 0xE7, 0x09, 0xE9, 0xDA,
+    0x1F, 0x79, 0xE9, 0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6, 0x9E, 0x9D, 0xA3, 0xF5, 0x9E,
+    0x9E, 0x39, 0xE9, 0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3, 0x9E, 0x9E, 0x59, 0xE9, 0x29,
+    0xE9, 0xE6, 0xF2, 0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91, 0xE9, 0xE7, 0x0F, 0x1E, 0x9E,
+    0x70, 0x9E, 0xA0, 0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9, 0xE7, 0x29, 0xFD, 0x9E, 0x73,
+    0xAF, 0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF0, 0x71, 0xAA, 0xAA, 0x74, 0xAE, 0xA7, 0x4E, 0xA7,
+    0x4E, 0xA7, 0x49, 0xDA, 0x75, 0xDA, 0x76, 0x99, 0x77, 0x77, 0x29, 0x99, 0x95, 0xE1, 0x9F, 0xF9,
+    0x2E, 0x0A, 0xFF, 0xD9, 0x1E, 0xAE, 0x99, 0x99, 0xAF, 0x1F, 0xC9, 0x59, 0xEA, 0x0F, 0xA7, 0xAE,
+    0x0F, 0x70, 0x9E, 0x0F, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9,
+    0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71,
+    0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0x9E, 0xA7, 0x5D,
+    0xA9, 0xF9, 0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29, 0xE9, 0xFD, 0x97, 0x19, 0xE9,
+    0xDA, 0xF7, 0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A, 0xE7, 0x09, 0xE9, 0xDA, 0x1F,
+    0x79, 0xE9, 0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6, 0x9E, 0x9D, 0xA3, 0xF5, 0x9E, 0x9E,
+    0x39, 0xE9, 0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3, 0x9E, 0x9E, 0x59, 0xE9, 0x29, 0xE9,
+    0xE6, 0xF2, 0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91, 0xE9, 0xE7, 0x0F, 0x1E, 0x9E, 0x70,
+    0x9E, 0xA0, 0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9, 0xE7, 0x29, 0xFD, 0x9E, 0x73, 0xAF,
+    0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF7, 0x77, 0x77, 0x75, 0x9A, 0xA9, 0x77, 0x1E, 0x97, 0x71,
+    0xE7, 0x71, 0x9D, 0x97, 0x71, 0xAD, 0x77, 0x2D, 0x97, 0x72, 0x97, 0x30, 0x79, 0x99, 0x95, 0xE1,
+    0x9F, 0xF9, 0x2E, 0x0A, 0xFF, 0xD9, 0x1E, 0xAE, 0x99, 0x99, 0xAF, 0x1F, 0xC9, 0x59, 0xEA, 0x0F,
+    0xA7, 0xAE, 0x0F, 0x70, 0x9E, 0x0F, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xEA, 0x71, 0xE0, 0xE9, 0x71,
+    0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0,
+    0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE0, 0xE9, 0x71, 0xE7, 0x77,
+    0x77, 0x4A, 0xAA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x59, 0xD7, 0x6A, 0xCA, 0x77, 0x97,
+    0x10, 0x4A, 0xA9, 0x6A, 0xA9, 0x70, 0x9D, 0xA3, 0x9E, 0x72, 0x9E, 0x1A, 0xE7, 0x4A, 0xEA, 0xE7,
+    0x6A, 0xFC, 0x77, 0x0F, 0x97, 0x71, 0x99, 0x97, 0x77, 0x77, 0x74, 0x9E, 0xA7, 0x5D, 0xA9, 0xF9,
+    0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29, 0xE9, 0xFD, 0x97, 0x19, 0xE9, 0xDA, 0xF7,
+    0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A, 0xE7, 0x09, 0xE9, 0xDA, 0x1F, 0x79, 0xE9,
+    0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6, 0x9E, 0x9D, 0xA3, 0xF5, 0x9E, 0x9E, 0x39, 0xE9,
+    0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3, 0x9E, 0x9E, 0x59, 0xE9, 0x29, 0xE9, 0xE6, 0xF2,
+    0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91, 0xE9, 0xE7, 0x0F, 0x1E, 0x9E, 0x70, 0x9E, 0xA0,
+    0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9, 0xE7, 0x29, 0xFD, 0x9E, 0x73, 0xAF, 0xC9, 0xE7,
+    0x4F, 0xC9, 0xE7, 0x49, 0xF0, 0x1A, 0xAA, 0x6A, 0xAA, 0x5E, 0x4E, 0x7E, 0x90, 0x9E, 0x97, 0x9E,
+    0xAE, 0x97, 0x19, 0xFC, 0x97, 0x3A, 0xEA, 0x75, 0x99, 0x97, 0x77, 0x71, 0x99, 0x99, 0x5E, 0x19,
+    0xFF, 0x92, 0xE0, 0xAF, 0xFD, 0x91, 0xEA, 0xE9, 0x99, 0x9A, 0xF1, 0xFC, 0x95, 0x9E, 0xA0, 0xFA,
+    0x7A, 0xE0, 0xF7, 0x09, 0xE0, 0xF7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0x97, 0x1E,
+    0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E,
+    0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x00, 0x1E,
+    0x97, 0x71, 0x9E, 0x97, 0x71, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0xE9, 0x77, 0x2E, 0x77, 0x29, 0xDA,
+    0x71, 0x99, 0x99, 0x49, 0xD9, 0x1D, 0xA1, 0xAF, 0xEA, 0x2A, 0xD2, 0xE0, 0xFF, 0xE1, 0x99, 0x3F,
+    0xDA, 0x99, 0x99, 0xFC, 0x6F, 0xC6, 0xAE, 0x95, 0xF7, 0x0E, 0xA5, 0xEA, 0x70, 0xAD, 0xA5, 0xE9,
+    0x70, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71,
+    0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE,
+    0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x5E, 0x71, 0xAE, 0x9E, 0xA7, 0x5D, 0xA9, 0xF9, 0x73, 0x9E,
+    0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7, 0x29, 0xE9, 0xFD, 0x97, 0x19, 0xE9, 0xDA, 0xF7, 0x19, 0xE9,
+    0xDA, 0x0E, 0xA7, 0x09, 0xE9, 0xDA, 0x0A, 0xE9, 0x79, 0xE9, 0xDA, 0x1F, 0x79, 0xE9, 0xDA, 0x2E,
+    0xA6, 0x9E, 0x9D, 0xA2, 0xAE, 0x95, 0x9E, 0x9D, 0xA3, 0xF5, 0x9E, 0x9E, 0x4E, 0xA4, 0x9E, 0x9E,
+    0x49, 0xE9, 0x39, 0xE9, 0xE5, 0xF3, 0x9E, 0x9E, 0x6E, 0xA2, 0x9E, 0x9E, 0x69, 0xE9, 0x19, 0xE9,
+    0xE7, 0xAE, 0x2E, 0x9E, 0x70, 0xEA, 0x1E, 0x9E, 0x70, 0x9E, 0x90, 0xE9, 0xE7, 0x1A, 0xE0, 0xE9,
+    0xE7, 0x2F, 0xE9, 0xE7, 0x29, 0xFD, 0x9E, 0x73, 0xAF, 0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF9,
+    0xE7, 0x5A, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xDA, 0x77, 0x1E, 0xA7, 0x70, 0xAE, 0x74, 0xFF, 0xA7,
+    0x4F, 0xEA, 0x75, 0xFC, 0xA9, 0x77, 0x70, 0x79, 0x99, 0x95, 0xE1, 0x9F, 0xF9, 0x2E, 0x09, 0xFF,
+    0xDA, 0x1E, 0xAE, 0xA9, 0x99, 0xAF, 0x90, 0xFC, 0x95, 0x9E, 0xA0, 0xFA, 0x7A, 0xE0, 0xF7, 0x09,
+    0xE0, 0xF7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0xA7, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E,
+    0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97,
+    0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x0E, 0x97, 0x1E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E,
+    0x75, 0x9E, 0x75, 0xF7, 0x1F, 0xE9, 0x71, 0xFD, 0xA7, 0x2A, 0xF9, 0x20, 0x69, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x75, 0xFF, 0xE7, 0x5F, 0xFE, 0x75, 0x99, 0x99, 0x99, 0x99, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x79, 0xAF, 0xEA, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6, 0x9F,
+    0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E, 0xA7,
+    0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA,
+    0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77, 0x0E,
+    0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0x9F,
+    0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC, 0xA7,
+    0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97, 0x10, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x7F, 0xFE,
+    0x7F, 0xFE, 0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x75, 0x99, 0x99, 0x97, 0x29, 0xFF, 0xA7,
+    0xAF, 0xFE, 0x94, 0xAF, 0xA9, 0x99, 0xAF, 0x92, 0x9E, 0xA6, 0xF2, 0xF7, 0x0E, 0xA0, 0x9E, 0x71,
+    0xAE, 0x0A, 0xE7, 0x2E, 0x9E, 0xA7, 0x2E, 0x9E, 0xA7, 0x2E, 0xAE, 0x97, 0x2E, 0xAE, 0x97, 0x2E,
+    0xAE, 0xA7, 0x2E, 0xAA, 0xDA, 0x72, 0xE9, 0x9E, 0x72, 0xE1, 0xE9, 0x70, 0xAE, 0x1A, 0xE7, 0x0E,
+    0xA2, 0xEA, 0x6F, 0x39, 0xFA, 0x99, 0x9A, 0xF5, 0x9F, 0xFE, 0x97, 0xAF, 0xEA, 0x74, 0x99, 0x97,
+    0x6C, 0xA6, 0xAC, 0x97, 0x4D, 0x95, 0xD7, 0x5A, 0xDA, 0x99, 0x9A, 0xE7, 0x6F, 0xFC, 0x77, 0x0A,
+    0xFC, 0xA7, 0x74, 0x97, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70,
+    0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97,
+    0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE,
+    0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A,
+    0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97,
+    0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA,
+    0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x29, 0xC9,
+    0x6A, 0xC6, 0x9D, 0x59, 0xD7, 0xEA, 0x99, 0x9A, 0xDA, 0x79, 0xFF, 0xC7, 0x19, 0xFD, 0xA7, 0x69,
+    0x77, 0x77, 0x29, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9,
+    0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9,
+    0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99,
+    0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF,
+    0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x70, 0xAA, 0xAA, 0x19, 0xAA, 0xA7, 0x59,
+    0xE2, 0xF7, 0x5E, 0x91, 0x9E, 0x75, 0xAD, 0xA2, 0xE7, 0x6D, 0xA2, 0xAD, 0x97, 0x5D, 0xA2, 0x9D,
+    0x97, 0x69, 0x94, 0x97, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70,
+    0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97,
+    0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE,
+    0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A,
+    0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97,
+    0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA,
+    0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x5A, 0xAA,
+    0x91, 0xAA, 0xAA, 0x7F, 0x2E, 0x96, 0x9E, 0x2A, 0xDA, 0x7E, 0x91, 0x9E, 0x7A, 0xD9, 0x2E, 0x70,
+    0xD9, 0x2A, 0xD7, 0x19, 0x59, 0x77, 0x77, 0x19, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9,
+    0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE,
+    0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72,
+    0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6,
+    0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x77,
+    0x59, 0xAF, 0xFF, 0xFF, 0xC9, 0x49, 0xFF, 0xFF, 0xFF, 0xA3, 0xAF, 0xFF, 0xFF, 0xFC, 0xA2, 0xAF,
+    0xA9, 0x5A, 0xE7, 0x49, 0xF7, 0x0A, 0xE7, 0x4F, 0x71, 0xAE, 0x73, 0x9E, 0x97, 0x1A, 0xE7, 0x3F,
+    0x72, 0xAE, 0x73, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x97, 0x2A, 0xE7, 0x2A, 0xE7, 0x3A, 0xE7, 0x2A,
+    0xE7, 0x3A, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAE, 0x73, 0xAF, 0xFF, 0xC0, 0xAE, 0x73, 0xAF,
+    0xFF, 0xC0, 0xAE, 0x73, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xE7, 0x3A, 0xE7, 0x2A, 0xE7,
+    0x3A, 0xE7, 0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0x97, 0x2A, 0xE7, 0x3F, 0x72, 0xAE, 0x73, 0x9E, 0x97,
+    0x1A, 0xE7, 0x4F, 0x71, 0xAE, 0x74, 0x9F, 0x70, 0xAE, 0x75, 0xAF, 0x96, 0xAE, 0x76, 0xAF, 0xDA,
+    0xAA, 0xAF, 0xFF, 0xEA, 0x49, 0xFF, 0xFF, 0xFF, 0xA6, 0xAF, 0xFF, 0xFF, 0xDA, 0x72, 0x99, 0x99,
+    0x77, 0x69, 0x99, 0x97, 0x29, 0x99, 0x72, 0x9F, 0xF9, 0x49, 0xFE, 0x96, 0xAF, 0xFD, 0xA2, 0xFF,
+    0xDA, 0x4A, 0xF9, 0x99, 0x9F, 0xA0, 0xAE, 0xA9, 0x99, 0xAE, 0xA2, 0x9E, 0x95, 0x9E, 0xAE, 0x59,
+    0xE9, 0x1E, 0xA7, 0x9F, 0xC7, 0xAE, 0x09, 0xE7, 0x1F, 0xC7, 0x9E, 0x0A, 0xE7, 0x1A, 0xE9, 0x70,
+    0xE9, 0xEA, 0x71, 0x9E, 0x97, 0x0E, 0x9E, 0xA7, 0x19, 0xFF, 0xFF, 0xAE, 0x97, 0x19, 0xFF, 0xFF,
+    0xAE, 0x97, 0x19, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9E, 0xA7, 0x19, 0xE7, 0x5E, 0xA7,
+    0x19, 0xE9, 0x74, 0xAE, 0x71, 0xAE, 0xA7, 0x5E, 0x71, 0xFC, 0x75, 0xEA, 0x79, 0xFC, 0xA7, 0x49,
+    0xEA, 0x59, 0xEA, 0xEA, 0x79, 0x92, 0xAF, 0xA9, 0x99, 0xFA, 0x0A, 0xFA, 0x99, 0x9A, 0xEA, 0x39,
+    0xFF, 0xDA, 0x2A, 0xFF, 0xEA, 0x5A, 0xFE, 0x95, 0xAF, 0xFA, 0x71, 0x99, 0x97, 0x39, 0x99, 0x50,
+    0x71, 0xAA, 0xAA, 0x76, 0x9E, 0xA7, 0x6E, 0xA7, 0x6A, 0xE7, 0x69, 0xE7, 0x7D, 0xA7, 0x70, 0x99,
+    0x77, 0x77, 0x77, 0x29, 0xFF, 0xAA, 0x99, 0x69, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xE3, 0x9E, 0x59,
+    0xAF, 0xA2, 0x9E, 0x70, 0xF2, 0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xAE, 0x19,
+    0xE7, 0x1A, 0xDA, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xE9, 0x19, 0xE7, 0x0F, 0x29, 0xE6, 0x9F,
+    0x92, 0x9F, 0xFF, 0xD9, 0x39, 0xFF, 0xFA, 0x59, 0xFF, 0xEA, 0x69, 0xE4, 0x9E, 0x95, 0x9E, 0x5A,
+    0xE5, 0x9E, 0x6E, 0xA4, 0x9E, 0x6A, 0xE4, 0x9E, 0x7F, 0x39, 0xE7, 0x9E, 0x92, 0x9E, 0x70, 0xF2,
+    0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0x9E, 0x72, 0xF0, 0x9E, 0x72, 0x9E, 0x90, 0x69, 0xAA,
+    0xA9, 0x6F, 0x6A, 0xE6, 0x9E, 0x7E, 0x7A, 0xD7, 0x09, 0x97, 0x77, 0x19, 0x99, 0x9E, 0x2A, 0xFF,
+    0x1F, 0xDA, 0xE0, 0xFA, 0xAA, 0x9F, 0xD9, 0x4F, 0xC6, 0xF9, 0x6F, 0x7E, 0xA7, 0xEA, 0x7E, 0x97,
+    0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0x9F,
+    0xFA, 0xA9, 0x96, 0x9F, 0xFF, 0xC9, 0x49, 0xFF, 0xFE, 0x39, 0xE5, 0x9A, 0xFA, 0x29, 0xE7, 0x0F,
+    0x29, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0x9E, 0x71, 0xAD, 0xA1, 0x9E,
+    0x71, 0xEA, 0x19, 0xE7, 0x1E, 0x91, 0x9E, 0x70, 0xF2, 0x9E, 0x69, 0xF9, 0x29, 0xFF, 0xFD, 0x93,
+    0x9F, 0xFF, 0xA5, 0x9F, 0xFE, 0xA6, 0x9E, 0x49, 0xE9, 0x59, 0xE5, 0xAE, 0x59, 0xE6, 0xEA, 0x49,
+    0xE6, 0xAE, 0x49, 0xE7, 0xF3, 0x9E, 0x79, 0xE9, 0x29, 0xE7, 0x0F, 0x29, 0xE7, 0x1E, 0xA1, 0x9E,
+    0x71, 0xAE, 0x19, 0xE7, 0x2F, 0x09, 0xE7, 0x29, 0xE9, 0x77, 0x77, 0x77, 0x9A, 0xA9, 0x77, 0xE9,
+    0x77, 0xE7, 0x79, 0xD9, 0x77, 0xAD, 0x77, 0x0D, 0x97, 0x70, 0x97, 0x30, 0x70, 0x99, 0x99, 0x0E,
+    0x2A, 0xFC, 0x0E, 0x1F, 0xDA, 0x0E, 0x0F, 0xAA, 0xA9, 0x0F, 0xD9, 0x5F, 0xC7, 0xF9, 0x7F, 0x70,
+    0xEA, 0x70, 0xEA, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70,
+    0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x77, 0x77, 0x3A, 0xAA, 0x70, 0x9E, 0x70,
+    0xAD, 0x97, 0x0E, 0x71, 0xD9, 0x70, 0xAC, 0xA7, 0x29, 0x72, 0x19, 0xAA, 0x6A, 0xAA, 0x7E, 0x93,
+    0xE9, 0x70, 0xE9, 0x1E, 0x97, 0x2E, 0xAE, 0x97, 0x39, 0xFC, 0xA7, 0x5A, 0xF7, 0x79, 0x99, 0x77,
+    0x77, 0x77, 0x19, 0xFF, 0xAA, 0x99, 0x69, 0xFF, 0xFC, 0x94, 0x9F, 0xFF, 0xE3, 0x9E, 0x59, 0xAF,
+    0xA2, 0x9E, 0x70, 0xF2, 0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xAE, 0x19, 0xE7,
+    0x1A, 0xDA, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xE9, 0x19, 0xE7, 0x0F, 0x29, 0xE6, 0x9F, 0x92,
+    0x9F, 0xFF, 0xD9, 0x39, 0xFF, 0xFA, 0x59, 0xFF, 0xEA, 0x69, 0xE4, 0x9E, 0x95, 0x9E, 0x5A, 0xE5,
+    0x9E, 0x6E, 0xA4, 0x9E, 0x6A, 0xE4, 0x9E, 0x7F, 0x39, 0xE7, 0x9E, 0x92, 0x9E, 0x70, 0xF2, 0x9E,
+    0x71, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0x9E, 0x72, 0xF0, 0x9E, 0x72, 0x9E, 0x90, 0x0A, 0xA9, 0x59,
+    0xAA, 0x1A, 0xDA, 0x3A, 0xDA, 0x2A, 0xDA, 0x1A, 0xDA, 0x4E, 0xAE, 0xA6, 0xFD, 0x70, 0xF7, 0x29,
+    0x97, 0x77, 0x49, 0x99, 0x91, 0xE2, 0xAF, 0xC1, 0xE1, 0xFD, 0xA1, 0xE0, 0xFA, 0xAA, 0x91, 0xFD,
+    0x96, 0xFC, 0x70, 0xF9, 0x70, 0xF7, 0x1E, 0xA7, 0x1E, 0xA7, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97,
+    0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97, 0x1E, 0x97,
+    0x00, 0x72, 0xAA, 0xAA, 0x74, 0x9E, 0xA7, 0x4E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5D, 0xA7, 0x69,
+    0x97, 0x77, 0x77, 0x70, 0x9A, 0xFE, 0xA9, 0x5F, 0xFF, 0xC2, 0x9F, 0xFF, 0xD2, 0xFA, 0x59, 0xAC,
+    0x91, 0x9E, 0x97, 0x4A, 0xE7, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xFC,
+    0x75, 0xFC, 0xA9, 0x73, 0xFE, 0xA7, 0x29, 0xFE, 0xA7, 0x29, 0xFE, 0x97, 0x3A, 0xFC, 0x97, 0x4A,
+    0xF7, 0x59, 0xE9, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x90, 0xCA, 0x70,
+    0x9F, 0x1F, 0xCA, 0xAA, 0xAA, 0xFC, 0x2F, 0xFF, 0xD3, 0x9A, 0xFF, 0xD9, 0x71, 0x99, 0x99, 0x70,
+    0x70, 0x9A, 0xAA, 0x97, 0x2F, 0x72, 0xAE, 0x72, 0x9E, 0x73, 0xE7, 0x3A, 0xD7, 0x49, 0x97, 0x77,
+    0x59, 0x99, 0x99, 0x79, 0xFF, 0xCA, 0x92, 0xAF, 0xFE, 0xA1, 0xAE, 0xA9, 0x90, 0x99, 0xAD, 0x2E,
+    0x97, 0x92, 0xE7, 0x4E, 0x74, 0xF7, 0x39, 0xFA, 0x72, 0x9F, 0xD9, 0x71, 0xAF, 0xDA, 0x71, 0xAF,
+    0xD9, 0x71, 0x9F, 0xC9, 0x72, 0x9F, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xE1, 0xA7, 0x0A, 0xE1, 0xEA,
+    0x99, 0x99, 0x9F, 0x91, 0xFF, 0xFA, 0x29, 0xAF, 0xFA, 0x70, 0x99, 0x99, 0x60, 0x7A, 0xAA, 0x97,
+    0x4F, 0xC7, 0x3A, 0xFD, 0x71, 0xAE, 0x0A, 0xE7, 0x9E, 0x2A, 0xDA, 0x59, 0xDA, 0x49, 0xDA, 0x59,
+    0x70, 0x99, 0x77, 0x77, 0x72, 0x9A, 0xFE, 0xA9, 0x5F, 0xFF, 0xC2, 0x9F, 0xFF, 0xD2, 0xFA, 0x59,
+    0xAC, 0x91, 0x9E, 0x97, 0x4A, 0xE7, 0x5A, 0xDA, 0x75, 0xAD, 0xA7, 0x5A, 0xE7, 0x59, 0xEA, 0x75,
+    0xFC, 0x75, 0xFC, 0xA9, 0x73, 0xFE, 0xA7, 0x29, 0xFE, 0xA7, 0x29, 0xFE, 0x97, 0x3A, 0xFC, 0x97,
+    0x4A, 0xF7, 0x59, 0xE9, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x90, 0xCA,
+    0x70, 0x9F, 0x1F, 0xCA, 0xAA, 0xAA, 0xFC, 0x2F, 0xFF, 0xD3, 0x9A, 0xFF, 0xD9, 0x71, 0x99, 0x99,
+    0x70, 0x5A, 0xAA, 0xA7, 0x2A, 0xF9, 0x70, 0x9F, 0xD9, 0x7E, 0x99, 0xE6, 0xE9, 0x19, 0xE4, 0xE5,
+    0xE3, 0x99, 0x79, 0x97, 0x77, 0x99, 0x99, 0x97, 0x9F, 0xFC, 0xA9, 0x2A, 0xFF, 0xEA, 0x1A, 0xEA,
+    0x99, 0x09, 0x9A, 0xD2, 0xE9, 0x79, 0x2E, 0x74, 0xE7, 0x4F, 0x73, 0x9F, 0xA7, 0x29, 0xFD, 0x97,
+    0x1A, 0xFD, 0xA7, 0x1A, 0xFD, 0x97, 0x19, 0xFC, 0x97, 0x29, 0xF7, 0x39, 0xE7, 0x4E, 0x97, 0x3E,
+    0x1A, 0x70, 0xAE, 0x1E, 0xA9, 0x99, 0x99, 0xF9, 0x1F, 0xFF, 0xA2, 0x9A, 0xFF, 0xA7, 0x09, 0x99,
+    0x96, 0x77, 0x69, 0xAF, 0xEA, 0x95, 0xFF, 0xFC, 0x29, 0xFF, 0xFD, 0x2F, 0xA5, 0x9A, 0xC9, 0x19,
+    0xE9, 0x74, 0xAE, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0xC7, 0x5F,
+    0xCA, 0x97, 0x3F, 0xEA, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xE9, 0x73, 0xAF, 0xC9, 0x74, 0xAF, 0x75,
+    0x9E, 0x97, 0x5E, 0xA7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xE9, 0x0C, 0xA7, 0x09, 0xF1,
+    0xFC, 0xAA, 0xAA, 0xAF, 0xC2, 0xFF, 0xFD, 0x39, 0xAF, 0xFD, 0x97, 0x19, 0xAD, 0x76, 0xD9, 0x75,
+    0x9E, 0xA7, 0x59, 0xF7, 0x6A, 0xD9, 0x75, 0x9D, 0x97, 0x49, 0xE7, 0x2F, 0xDA, 0x72, 0xFA, 0x96,
+    0x59, 0x99, 0x99, 0x79, 0xFF, 0xCA, 0x92, 0xAF, 0xFE, 0xA1, 0xAE, 0xA9, 0x90, 0x99, 0xAD, 0x2E,
+    0x97, 0x92, 0xE7, 0x4E, 0x74, 0xF7, 0x39, 0xFA, 0x72, 0x9F, 0xD9, 0x71, 0xAF, 0xDA, 0x71, 0xAF,
+    0xD9, 0x71, 0x9F, 0xC9, 0x72, 0x9F, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xE1, 0xA7, 0x0A, 0xE1, 0xEA,
+    0x99, 0x99, 0x9F, 0x91, 0xFF, 0xFA, 0x29, 0xAF, 0xFA, 0x70, 0x99, 0xD9, 0x73, 0xAC, 0xA7, 0x4E,
+    0xA7, 0x39, 0xAE, 0x75, 0xDA, 0x74, 0xDA, 0x73, 0xAD, 0x97, 0xAF, 0xD7, 0x0A, 0xF9, 0x50, 0x29,
+    0xAA, 0x6A, 0xAA, 0x5E, 0x93, 0xE9, 0x6E, 0x91, 0xE9, 0x70, 0xEA, 0xE9, 0x71, 0x9F, 0xCA, 0x73,
+    0xAF, 0x75, 0x99, 0x97, 0x77, 0x77, 0x79, 0xAF, 0xEA, 0x95, 0xFF, 0xFC, 0x29, 0xFF, 0xFD, 0x2F,
+    0xA5, 0x9A, 0xC9, 0x19, 0xE9, 0x74, 0xAE, 0x75, 0xAD, 0xA7, 0x5A, 0xDA, 0x75, 0xAE, 0x75, 0x9E,
+    0xA7, 0x5F, 0xC7, 0x5F, 0xCA, 0x97, 0x3F, 0xEA, 0x72, 0x9F, 0xEA, 0x72, 0x9F, 0xE9, 0x73, 0xAF,
+    0xC9, 0x74, 0xAF, 0x75, 0x9E, 0x97, 0x5E, 0xA7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xE9,
+    0x0C, 0xA7, 0x09, 0xF1, 0xFC, 0xAA, 0xAA, 0xAF, 0xC2, 0xFF, 0xFD, 0x39, 0xAF, 0xFD, 0x97, 0x19,
+    0x99, 0x97, 0x1A, 0xA9, 0x59, 0xAA, 0x3A, 0xDA, 0x3A, 0xDA, 0x4A, 0xDA, 0x1A, 0xDA, 0x6E, 0xAE,
+    0xA7, 0x0F, 0xD7, 0x2F, 0x74, 0x99, 0x77, 0x74, 0x99, 0x99, 0x97, 0x9F, 0xFC, 0xA9, 0x2A, 0xFF,
+    0xEA, 0x1A, 0xEA, 0x99, 0x09, 0x9A, 0xD2, 0xE9, 0x79, 0x2E, 0x74, 0xE7, 0x4F, 0x73, 0x9F, 0xA7,
+    0x29, 0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x1A, 0xFD, 0x97, 0x19, 0xFC, 0x97, 0x29, 0xF7, 0x39, 0xE7,
+    0x4E, 0x97, 0x3E, 0x1A, 0x70, 0xAE, 0x1E, 0xA9, 0x99, 0x99, 0xF9, 0x1F, 0xFF, 0xA2, 0x9A, 0xFF,
+    0xA7, 0x09, 0x99, 0x96, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFE, 0x97, 0x9E,
+    0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09,
+    0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7,
+    0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x71, 0xAC, 0xA7, 0x71, 0xD7, 0x71,
+    0xAE, 0x97, 0x70, 0x9E, 0xA7, 0x71, 0xAD, 0x77, 0x19, 0xD7, 0x70, 0x9E, 0x75, 0xFD, 0x97, 0x5F,
+    0xA7, 0x00, 0x4A, 0xA7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x0A, 0xE6, 0xAF, 0xFD, 0xA9, 0xFF, 0xEA,
+    0x09, 0x9F, 0x99, 0x99, 0x99, 0x2A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x09, 0xE7, 0x09,
+    0xE9, 0x70, 0xFA, 0x99, 0x99, 0x39, 0xFE, 0xA4, 0x9F, 0xDA, 0x6D, 0x99, 0x79, 0xD7, 0x1E, 0xA7,
+    0x09, 0xAE, 0x97, 0x1D, 0xA7, 0x1E, 0x70, 0xAD, 0xA4, 0xAF, 0xD5, 0xAF, 0x92, 0x3A, 0xAA, 0x6A,
+    0xAA, 0x79, 0xE3, 0x9E, 0x71, 0x9E, 0x19, 0xE7, 0x39, 0xEA, 0xE7, 0x5A, 0xFC, 0x97, 0x6F, 0xA7,
+    0x70, 0x99, 0x97, 0x77, 0x77, 0x72, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFE,
+    0x97, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E,
+    0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x00, 0x75, 0x9A, 0xA9,
+    0x75, 0xE9, 0x75, 0xE7, 0x6D, 0xA5, 0xAA, 0x59, 0xD5, 0xAD, 0x5A, 0xCA, 0x5E, 0x59, 0x96, 0xE7,
+    0x5A, 0xE7, 0x3A, 0xFF, 0xDA, 0x49, 0xFF, 0xEA, 0x59, 0x9F, 0x99, 0x99, 0x99, 0x7A, 0xE7, 0x5A,
+    0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x5A,
+    0xE7, 0x5A, 0xE7, 0x5A, 0xE7, 0x59, 0xE7, 0x59, 0xE9, 0x75, 0xFA, 0x99, 0x99, 0x70, 0x9F, 0xEA,
+    0x71, 0x9F, 0xDA, 0x74, 0x99, 0x96, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFE,
+    0x97, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x73, 0xFF, 0xFD, 0xA5, 0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xCA,
+    0x72, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x00, 0x4A,
+    0xA7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x0A, 0xE6, 0xAF, 0xFD, 0xA9, 0xFF, 0xEA, 0x09, 0x9F, 0x99,
+    0x99, 0x99, 0x2A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE6, 0xFF, 0xE1, 0xFF, 0xE1, 0xAA, 0xFA,
+    0xAA, 0xAA, 0x3A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x09, 0xE7, 0x09, 0xE9,
+    0x70, 0xFA, 0x99, 0x99, 0x39, 0xFE, 0xA4, 0x9F, 0xDA, 0x79, 0x99, 0x10, 0x69, 0x96, 0xA9, 0x7A,
+    0xFC, 0x3A, 0xC9, 0x69, 0xFE, 0xA9, 0xAD, 0x7D, 0xA1, 0xAF, 0xDA, 0x7D, 0x4A, 0xEA, 0x70, 0x97,
+    0x77, 0x77, 0x77, 0x19, 0xDA, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E,
+    0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE,
+    0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74,
+    0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0x9E, 0x74, 0xAE,
+    0x9E, 0x74, 0xEA, 0x0E, 0xA7, 0x29, 0xE9, 0x0A, 0xE9, 0x71, 0xF2, 0xFA, 0x69, 0xF9, 0x3F, 0xDA,
+    0xAA, 0xAF, 0xC9, 0x5F, 0xFF, 0xC9, 0x79, 0xFF, 0xCA, 0x75, 0x99, 0x99, 0x70, 0x49, 0xA9, 0x59,
+    0xA5, 0xAF, 0xA3, 0xD9, 0x39, 0xFE, 0xA9, 0xAD, 0x4D, 0xA1, 0xAF, 0xD9, 0x4D, 0x4A, 0xEA, 0x59,
+    0x77, 0x77, 0x77, 0x2E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70,
+    0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E,
+    0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09,
+    0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0F, 0x0F, 0x79, 0xF0, 0xAE, 0x95, 0x9F, 0xC1, 0xFC, 0x99,
+    0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0, 0xE3, 0xAF, 0xE9, 0x1E, 0x69, 0x99, 0x70, 0x49, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x71, 0xFF, 0xE9, 0x70, 0xFF, 0xE9, 0x71, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77,
+    0x77, 0x76, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7,
+    0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA,
+    0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x39, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x6F, 0xFE, 0x6F, 0xFE, 0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0x7E, 0x97, 0x09,
+    0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97,
+    0x0F, 0x0F, 0x79, 0xF0, 0xAE, 0x95, 0x9F, 0xC1, 0xFC, 0x99, 0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0,
+    0xE3, 0xAF, 0xE9, 0x1E, 0x69, 0x99, 0x70, 0x4C, 0xA6, 0x9C, 0x97, 0x0D, 0x95, 0xD9, 0x70, 0xAD,
+    0xA9, 0x99, 0xAE, 0x72, 0xFF, 0xC7, 0x4A, 0xFC, 0xA7, 0x70, 0x97, 0x77, 0x77, 0x73, 0x9D, 0xA7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72,
+    0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC,
+    0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x3C, 0xA6, 0xAC, 0x95, 0xD6, 0xD6, 0xAD, 0xA9, 0x99,
+    0xAE, 0x7F, 0xFC, 0x71, 0xAF, 0xCA, 0x75, 0x97, 0x77, 0x77, 0x4E, 0x97, 0x09, 0xE0, 0xE9, 0x70,
+    0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E,
+    0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09,
+    0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0F, 0x0F, 0x79,
+    0xF0, 0xAE, 0x95, 0x9F, 0xC1, 0xFC, 0x99, 0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0, 0xE3, 0xAF, 0xE9,
+    0x1E, 0x69, 0x99, 0x70, 0x70, 0xAA, 0xA9, 0x76, 0x9F, 0xCA, 0x75, 0xDA, 0x09, 0xD9, 0x73, 0x9C,
+    0xA2, 0x9D, 0x73, 0x9C, 0xA3, 0xD7, 0x39, 0xD2, 0xAC, 0xA7, 0x4E, 0xAE, 0x97, 0x5F, 0xC9, 0x77,
+    0x09, 0x77, 0x77, 0x77, 0x39, 0xDA, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74,
+    0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E,
+    0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE,
+    0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0xAE, 0x74, 0x9E, 0x9E, 0x74,
+    0xAE, 0x9E, 0x74, 0xEA, 0x0E, 0xA7, 0x29, 0xE9, 0x0A, 0xE9, 0x71, 0xF2, 0xFA, 0x69, 0xF9, 0x3F,
+    0xDA, 0xAA, 0xAF, 0xC9, 0x5F, 0xFF, 0xC9, 0x79, 0xFF, 0xCA, 0x75, 0x99, 0x99, 0x70, 0x7A, 0xAA,
+    0x74, 0x9F, 0xCA, 0x72, 0xD9, 0x09, 0xD9, 0x70, 0x9C, 0xA2, 0xAC, 0xA7, 0x0A, 0xC9, 0x29, 0xCA,
+    0x70, 0x9D, 0x2A, 0xCA, 0x71, 0xEA, 0xE7, 0x3F, 0xC9, 0x75, 0x97, 0x77, 0x77, 0x4E, 0x97, 0x09,
+    0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97,
+    0x0F, 0x0F, 0x79, 0xF0, 0xAE, 0x95, 0x9F, 0xC1, 0xFC, 0x99, 0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0,
+    0xE3, 0xAF, 0xE9, 0x1E, 0x69, 0x99, 0x70, 0x6A, 0xAA, 0xA2, 0xAA, 0xA9, 0x70, 0x9E, 0x91, 0xF7,
+    0x1E, 0x91, 0x9E, 0x71, 0xAD, 0xA2, 0xE9, 0x71, 0xDA, 0x2A, 0xD9, 0x71, 0xDA, 0x3D, 0x97, 0x29,
+    0x94, 0x97, 0x77, 0x77, 0x72, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7,
+    0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93,
+    0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x5A, 0xAA,
+    0x91, 0x9A, 0xAA, 0x6A, 0xE2, 0xEA, 0x6E, 0x91, 0x9E, 0x6A, 0xDA, 0x2E, 0x69, 0xDA, 0x2A, 0xD7,
+    0xDA, 0x29, 0xD7, 0x09, 0x59, 0x77, 0x77, 0x73, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9,
+    0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97,
+    0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A, 0xE9,
+    0x59, 0xFC, 0x1F, 0xC9, 0x99, 0xAE, 0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6, 0x99,
+    0x97, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E,
+    0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC,
+    0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFD, 0xA7, 0x49, 0x99, 0x9A, 0xD7, 0x70, 0x9D, 0x77, 0x1D, 0xA7,
+    0x71, 0xDA, 0x77, 0x1D, 0xA7, 0x71, 0xE7, 0x71, 0xFD, 0x77, 0xFC, 0x77, 0x70, 0x77, 0x3E, 0x97,
+    0x09, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0x97, 0x09, 0xE1,
+    0xE9, 0x70, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xE9, 0x70,
+    0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xE9, 0x70, 0xAE, 0x1E,
+    0x97, 0x0F, 0x1F, 0x79, 0xF1, 0xAE, 0x95, 0x9F, 0xC2, 0xFC, 0x99, 0x9A, 0xEA, 0xE2, 0x9F, 0xFD,
+    0xA0, 0xE4, 0xAF, 0xE9, 0x1E, 0x79, 0x99, 0x3A, 0xD7, 0x6A, 0xD7, 0x69, 0xD9, 0x76, 0xAD, 0x77,
+    0xE7, 0x7E, 0x97, 0x6A, 0xFC, 0x97, 0x4A, 0xF9, 0x77, 0x20, 0x76, 0x9A, 0xAA, 0x77, 0x76, 0xFC,
+    0x77, 0x74, 0xFD, 0xA7, 0x77, 0x2E, 0xA0, 0xEA, 0x77, 0x70, 0xAD, 0xA2, 0xE9, 0x77, 0x6A, 0xD9,
+    0x4A, 0xD9, 0x77, 0x59, 0x97, 0x09, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xE7, 0x29, 0xE7, 0x3E,
+    0x1E, 0x97, 0x1F, 0x97, 0x19, 0xE1, 0xEA, 0x71, 0xFA, 0x71, 0xAE, 0x1A, 0xE7, 0x09, 0xFC, 0x71,
+    0xEA, 0x19, 0xE7, 0x0A, 0xFC, 0x97, 0x0E, 0x92, 0xE9, 0x7E, 0x9D, 0xA7, 0x9E, 0x3E, 0xA6, 0x9E,
+    0x0E, 0x7A, 0xDA, 0x3A, 0xE6, 0xAD, 0xA0, 0xE7, 0xE9, 0x39, 0xE6, 0xE9, 0x0A, 0xDA, 0x6E, 0x5E,
+    0x95, 0xE1, 0x9E, 0x59, 0xE5, 0xEA, 0x49, 0xDA, 0x2E, 0x5A, 0xDA, 0x5A, 0xE4, 0xAD, 0x92, 0xE9,
+    0x4E, 0x95, 0x9E, 0x4E, 0x39, 0xE3, 0x9E, 0x7E, 0x92, 0x9E, 0x4E, 0x3A, 0xE7, 0xEA, 0x2A, 0xDA,
+    0x4E, 0x92, 0xEA, 0x7A, 0xE2, 0xE9, 0x4A, 0xDA, 0x2E, 0x97, 0x0E, 0x2E, 0x59, 0xE1, 0x9E, 0x71,
+    0xE9, 0x09, 0xDA, 0x6E, 0x1A, 0xE7, 0x1A, 0xDA, 0x0A, 0xD9, 0x6A, 0xDA, 0x0E, 0xA7, 0x19, 0xE0,
+    0xE7, 0x9E, 0x0E, 0x97, 0x2E, 0x0E, 0x70, 0xE0, 0xE7, 0x3E, 0xAD, 0xA7, 0x0E, 0xAD, 0xA7, 0x3A,
+    0xFC, 0x97, 0x09, 0xFC, 0x97, 0x39, 0xFC, 0x72, 0xFC, 0x75, 0xFA, 0x72, 0xFC, 0x75, 0xF9, 0x72,
+    0xAE, 0xA7, 0x5A, 0xE7, 0x39, 0xE9, 0x60, 0x74, 0xAA, 0xA9, 0x77, 0x70, 0xFC, 0x77, 0x7A, 0xFD,
+    0x77, 0x59, 0xE0, 0xAE, 0x77, 0x39, 0xE2, 0xAD, 0xA7, 0x71, 0x9D, 0xA4, 0x9D, 0xA7, 0x71, 0x97,
+    0x09, 0x97, 0x77, 0x77, 0x77, 0x74, 0x9E, 0x70, 0xF7, 0x9E, 0x1E, 0x96, 0xAF, 0x7A, 0xDA, 0x1E,
+    0xA6, 0xFC, 0x96, 0xE9, 0x1A, 0xE6, 0xFC, 0xA5, 0x9E, 0x29, 0xE5, 0x9D, 0x9E, 0x5A, 0xE3, 0xE9,
+    0x4E, 0x0A, 0xD9, 0x4E, 0x93, 0xEA, 0x4E, 0x09, 0xDA, 0x4E, 0x4A, 0xE3, 0x9D, 0xA1, 0xE3, 0x9E,
+    0x5E, 0x3A, 0xD9, 0x1E, 0x3A, 0xDA, 0x5E, 0x92, 0xE2, 0xAD, 0xA2, 0xE9, 0x5A, 0xDA, 0x19, 0xDA,
+    0x29, 0xE2, 0xE6, 0x9E, 0x1A, 0xD9, 0x3E, 0x19, 0xE7, 0xE1, 0xE4, 0xAD, 0x90, 0xAD, 0xA7, 0xE9,
+    0x0D, 0xA4, 0x9D, 0xA0, 0xE9, 0x7A, 0xDA, 0x9D, 0x95, 0xE0, 0xE7, 0x09, 0xEA, 0xD6, 0xE9, 0xDA,
+    0x71, 0xFD, 0x69, 0xFC, 0x97, 0x1F, 0xC9, 0x7F, 0xC7, 0x29, 0xF7, 0x0F, 0xC7, 0x3F, 0x70, 0xAE,
+    0xA5, 0x70, 0xAA, 0xA9, 0x77, 0x0F, 0xC7, 0x7A, 0xFD, 0x75, 0xAE, 0x0E, 0xA7, 0x39, 0xE2, 0xAD,
+    0xA7, 0x19, 0xDA, 0x49, 0xDA, 0x71, 0x97, 0x09, 0x97, 0x77, 0x77, 0x70, 0xAD, 0xA7, 0x49, 0xDA,
+    0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE, 0x3E, 0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAE, 0x5E, 0x97,
+    0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E, 0x97, 0xAE, 0x4E, 0xA7, 0x1E, 0xA2, 0x9E, 0x72, 0x9E,
+    0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E, 0x0E, 0xA7, 0x5F, 0xE7, 0x69, 0xFC, 0x97, 0x7F, 0xC7,
+    0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71,
+    0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x70, 0x69, 0xAA, 0xA9, 0x76,
+    0xFC, 0x75, 0xFE, 0x73, 0xAE, 0x0E, 0xA7, 0x1A, 0xDA, 0x2A, 0xDA, 0x79, 0xDA, 0x4A, 0xDA, 0x79,
+    0x70, 0x99, 0x77, 0x77, 0x73, 0xAE, 0x72, 0xAE, 0x09, 0xE7, 0x2E, 0xA1, 0xEA, 0x70, 0x9E, 0x2A,
+    0xE7, 0x0A, 0xE3, 0xE9, 0x7E, 0x93, 0xAD, 0xA6, 0x9E, 0x49, 0xE6, 0xEA, 0x5E, 0x95, 0xE9, 0x5A,
+    0xE4, 0xAE, 0x7E, 0x4E, 0xA7, 0xAD, 0xA3, 0xE7, 0x09, 0xE2, 0xAD, 0xA7, 0x1E, 0x91, 0xE9, 0x71,
+    0xAD, 0xA0, 0x9E, 0x73, 0xE0, 0xAD, 0xA7, 0x3A, 0xD9, 0xE7, 0x49, 0xDA, 0xE7, 0x5F, 0xC9, 0x75,
+    0x9F, 0x77, 0xEA, 0x77, 0xE9, 0x76, 0x9E, 0x77, 0xEA, 0x76, 0x9E, 0x77, 0xEA, 0x76, 0xAE, 0x72,
+    0xAC, 0xAF, 0xC9, 0x72, 0xAF, 0xD9, 0x73, 0x9F, 0xA7, 0x50, 0x69, 0x59, 0x73, 0x9D, 0xA2, 0x9D,
+    0xA7, 0x2A, 0xE2, 0xAE, 0x72, 0x9D, 0xA2, 0x9D, 0xA7, 0x49, 0x59, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0xAD, 0xA7, 0x49, 0xDA, 0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE, 0x3E, 0x97, 0x1E, 0x93, 0xAE,
+    0x70, 0xAE, 0x5E, 0x97, 0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E, 0x97, 0xAE, 0x4E, 0xA7, 0x1E,
+    0xA2, 0x9E, 0x72, 0x9E, 0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E, 0x0E, 0xA7, 0x5F, 0xE7, 0x69,
+    0xFC, 0x97, 0x7F, 0xC7, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9,
+    0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x70,
+    0x72, 0xAA, 0xAA, 0x97, 0x5F, 0x75, 0xF7, 0x59, 0xE7, 0x6E, 0x76, 0xE7, 0x79, 0x97, 0x77, 0x77,
+    0x7F, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x5F, 0x75, 0x9E, 0x97, 0x5F,
+    0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E,
+    0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE,
+    0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0x70, 0xAA,
+    0xAA, 0x72, 0x9E, 0xA7, 0x2F, 0x72, 0xAE, 0x73, 0xE7, 0x3E, 0x74, 0x99, 0x77, 0x77, 0x70, 0xFF,
+    0xFD, 0x1F, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7,
+    0x2A, 0xE7, 0x29, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0x9E,
+    0x73, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF,
+    0xD0, 0xAF, 0xFF, 0xD0, 0x70, 0xAA, 0x77, 0xEA, 0x76, 0xF7, 0x6E, 0xA7, 0x79, 0x97, 0x77, 0x77,
+    0x77, 0x71, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xFC, 0xA0, 0xFF, 0xFF, 0xCA, 0x75, 0xF7, 0x59, 0xE9,
+    0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7,
+    0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xF7,
+    0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xF7, 0x5A, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xD0,
+    0x6A, 0xA7, 0x4E, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x4A, 0x97, 0x77, 0x77, 0x77, 0xFF, 0xFD, 0x1F,
+    0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A, 0xE7,
+    0x29, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0x9E, 0x73, 0xE9,
+    0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF, 0xD0, 0xAF,
+    0xFF, 0xD0, 0x29, 0xAA, 0x69, 0xAA, 0x6A, 0xD9, 0x3A, 0xD9, 0x7E, 0xA1, 0xEA, 0x71, 0xEA, 0xEA,
+    0x73, 0xFC, 0xA7, 0x49, 0xF7, 0x69, 0x99, 0x77, 0x77, 0x76, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF, 0xFC,
+    0xA0, 0xFF, 0xFF, 0xCA, 0x75, 0xF7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7,
+    0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xEA,
+    0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xF7, 0x5A, 0xE7, 0x59, 0xEA, 0x75, 0xF7, 0x5A, 0xFF,
+    0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xD0, 0x09, 0xAA, 0x69, 0xAA, 0x3E, 0x93, 0xE9, 0x4E,
+    0x91, 0xE9, 0x6E, 0xAE, 0xA7, 0x0F, 0xCA, 0x71, 0x9F, 0x73, 0x99, 0x97, 0x77, 0x77, 0xFF, 0xFD,
+    0x1F, 0xFF, 0xD1, 0x99, 0x99, 0x99, 0x99, 0x99, 0xF7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A,
+    0xE7, 0x29, 0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0xEA, 0x72, 0x9E, 0x73,
+    0xE9, 0x72, 0xEA, 0x72, 0xAE, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF, 0xD0,
+    0xAF, 0xFF, 0xD0, 0x39, 0xAA, 0xAA, 0x92, 0x9F, 0xE9, 0x09, 0xFF, 0x1F, 0x91, 0x99, 0x09, 0xE6,
+    0xAD, 0xA6, 0xEA, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E,
+    0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96,
+    0xE9, 0x6E, 0x96, 0xE9, 0x60, 0x77, 0x79, 0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x9A, 0xFE, 0xA9, 0x5F,
+    0x59, 0xFF, 0xFC, 0x93, 0xE9, 0x4A, 0xFF, 0xFE, 0xA1, 0x9E, 0x4A, 0xFA, 0x69, 0xFA, 0xAE, 0x93,
+    0x9F, 0x72, 0xAF, 0xD9, 0x4F, 0x74, 0xFA, 0x59, 0xE9, 0x75, 0xEA, 0x5F, 0x76, 0xAE, 0x5E, 0xA7,
+    0x69, 0xE9, 0x39, 0xE9, 0x77, 0xEA, 0x3A, 0xE7, 0x70, 0xF3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77,
+    0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77,
+    0x0F, 0x39, 0xE7, 0x70, 0xEA, 0x4E, 0x97, 0x7E, 0x94, 0xF7, 0x6A, 0xE5, 0xAE, 0x97, 0x5E, 0xA6,
+    0xF7, 0x4A, 0xE7, 0x9F, 0x72, 0xAE, 0xA7, 0x0A, 0xF9, 0x7F, 0xC7, 0x2A, 0xFC, 0xAA, 0xAA, 0xAF,
+    0xD7, 0x49, 0xFF, 0xFC, 0xA7, 0x79, 0xFF, 0xCA, 0x77, 0x59, 0x99, 0x97, 0x50, 0x77, 0x77, 0x70,
+    0xAE, 0x77, 0x2A, 0xE7, 0x99, 0x99, 0x95, 0xEA, 0x49, 0xFF, 0xA3, 0xE4, 0xAF, 0xFE, 0x90, 0xEA,
+    0x3A, 0xFA, 0x99, 0x9A, 0xFF, 0x39, 0xEA, 0x6F, 0xCA, 0x4E, 0xA7, 0x0E, 0xA4, 0x9E, 0x71, 0x9E,
+    0x4A, 0xE7, 0x2E, 0x93, 0xEA, 0x72, 0xE9, 0x3E, 0xA7, 0x2E, 0xA3, 0xE9, 0x72, 0xEA, 0x3E, 0x97,
+    0x2E, 0xA3, 0xEA, 0x72, 0xEA, 0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x2E, 0x94, 0xE7, 0x1A, 0xE5,
+    0xF7, 0x0E, 0xA6, 0xEA, 0x6F, 0x79, 0xFA, 0x99, 0x9A, 0xF9, 0x70, 0x9F, 0xFE, 0x97, 0x3A, 0xFE,
+    0xA7, 0x70, 0x99, 0x97, 0x30, 0x77, 0x77, 0x71, 0x9F, 0xF9, 0x59, 0xAF, 0xD9, 0x79, 0xFF, 0xF9,
+    0x2F, 0xFE, 0x5A, 0xFF, 0xFD, 0xA0, 0xFF, 0xFA, 0x3A, 0xF9, 0x59, 0xFE, 0x94, 0x9F, 0x29, 0xF7,
+    0x1A, 0xF7, 0x0E, 0xA1, 0xF7, 0x3F, 0x70, 0xF0, 0x9E, 0x97, 0x4E, 0xA7, 0xAE, 0x0F, 0x75, 0xAE,
+    0x79, 0xE0, 0xEA, 0x75, 0x9E, 0x79, 0xE9, 0xE9, 0x76, 0xE9, 0x69, 0xEA, 0xE7, 0x7E, 0xA6, 0x9E,
+    0xAE, 0x77, 0xEA, 0x69, 0xEA, 0xE7, 0x7F, 0x69, 0xEA, 0xE7, 0x7F, 0x69, 0xEA, 0xE7, 0x7F, 0x69,
+    0xEA, 0xE7, 0x7E, 0xA6, 0x9E, 0xAE, 0x77, 0xEA, 0x69, 0xE9, 0xE7, 0x7E, 0x96, 0x9E, 0x0E, 0x97,
+    0x59, 0xE7, 0x9E, 0x0F, 0x75, 0xAE, 0x79, 0xE0, 0xAE, 0x75, 0xEA, 0x79, 0xE1, 0xF7, 0x3A, 0xE7,
+    0x09, 0xE1, 0xAE, 0xA7, 0x1A, 0xEA, 0x70, 0x9E, 0x2F, 0xC9, 0x6A, 0xF7, 0x19, 0xE3, 0xFD, 0xAA,
+    0xAA, 0xFD, 0x72, 0x9E, 0x4A, 0xFF, 0xFA, 0x73, 0x9E, 0x6A, 0xFF, 0xA7, 0x59, 0xE7, 0x19, 0x99,
+    0x97, 0x74, 0x69, 0x99, 0x97, 0x99, 0x99, 0x79, 0xFF, 0x3A, 0xFD, 0x94, 0xAF, 0xFD, 0xA0, 0xFF,
+    0xC9, 0x2F, 0xC9, 0x99, 0xAF, 0xE9, 0x99, 0xAF, 0x19, 0xE9, 0x5A, 0xF4, 0x9E, 0x90, 0xEA, 0x7E,
+    0xA5, 0xE9, 0x9E, 0x70, 0x9E, 0x5A, 0xDA, 0xAE, 0x71, 0xE9, 0x4A, 0xDA, 0xEA, 0x71, 0xEA, 0x4A,
+    0xDA, 0xEA, 0x71, 0xEA, 0x4A, 0xDA, 0xE9, 0x71, 0xAD, 0xA4, 0xAD, 0xAE, 0x97, 0x1A, 0xDA, 0x4A,
+    0xDA, 0xEA, 0x71, 0xEA, 0x4A, 0xDA, 0xAD, 0xA7, 0x1E, 0xA4, 0xAD, 0xAA, 0xE7, 0x1E, 0x94, 0xAD,
+    0xA0, 0xE7, 0x09, 0xE5, 0xAD, 0xA0, 0xEA, 0x7E, 0xA5, 0xAD, 0xA0, 0x9E, 0xA5, 0xF6, 0xAD, 0xA1,
+    0xAF, 0xA9, 0x9A, 0xF9, 0x6A, 0xDA, 0x2A, 0xFF, 0xD9, 0x7A, 0xDA, 0x4A, 0xFD, 0xA7, 0x1A, 0xDA,
+    0x69, 0x99, 0x74, 0xAD, 0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD,
+    0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD, 0xA7, 0x76, 0xAD, 0xA0, 0x2A, 0xAF, 0xFD,
+    0xAA, 0x96, 0x9F, 0xFF, 0xFD, 0x93, 0xFF, 0xFF, 0xFA, 0x19, 0xE9, 0x09, 0xE4, 0x99, 0xFC, 0x90,
+    0xAD, 0x91, 0x9E, 0x79, 0xF0, 0xAD, 0x91, 0x9E, 0x70, 0x9E, 0x99, 0xDA, 0x19, 0xE7, 0x1E, 0xA5,
+    0x9E, 0x71, 0xF5, 0x9E, 0x71, 0xAE, 0x59, 0xE7, 0x1E, 0xA5, 0x9E, 0x71, 0xE9, 0x59, 0xE7, 0x0A,
+    0xE6, 0x9E, 0x7A, 0xEA, 0x69, 0xE9, 0x99, 0x99, 0xAA, 0xFC, 0x79, 0xFF, 0xFC, 0xA7, 0x09, 0xFF,
+    0xF9, 0x71, 0x9E, 0xAA, 0xAA, 0xA9, 0x97, 0x49, 0xE7, 0x73, 0x9E, 0x77, 0x39, 0xE7, 0x73, 0x9E,
+    0x77, 0x39, 0xE7, 0x73, 0x9E, 0x77, 0x39, 0xE7, 0x73, 0x9E, 0x77, 0x39, 0xE7, 0x73, 0x9E, 0x75,
+    0x2A, 0xAA, 0x97, 0x39, 0xFC, 0x73, 0xFD, 0x72, 0xAE, 0x90, 0x97, 0x2A, 0xDA, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x39, 0x99, 0x95, 0xE9, 0x09, 0xFE, 0xA3, 0xE9, 0xAF, 0xFD, 0x2E,
+    0xAE, 0x99, 0x99, 0xFC, 0x1F, 0xC9, 0x59, 0xEA, 0x0F, 0xA7, 0xAE, 0x0F, 0x71, 0xE9, 0xF7, 0x1E,
+    0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x19, 0xFD, 0x97, 0x19, 0xFD, 0xA7, 0x19, 0xFD, 0xA7, 0x1A, 0xFD,
+    0xA7, 0x1A, 0xFE, 0x71, 0xEA, 0xF7, 0x09, 0xE9, 0xFA, 0x7F, 0x0F, 0xCA, 0x5A, 0xEA, 0x0F, 0xEA,
+    0x99, 0xAF, 0xC1, 0xE9, 0xAF, 0xFD, 0x2E, 0x90, 0x9F, 0xEA, 0x3E, 0x93, 0x99, 0x96, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0x9E, 0x77,
+    0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9F, 0xFD, 0xAA, 0x69, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0xE3,
+    0x9E, 0x69, 0xFC, 0x29, 0xE7, 0x0A, 0xE9, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x71, 0xEA, 0x19, 0xE7,
+    0x1A, 0xE1, 0x9E, 0x71, 0xEA, 0x19, 0xE7, 0x1E, 0xA1, 0x9E, 0x70, 0x9E, 0x91, 0x9E, 0x79, 0xF2,
+    0x9E, 0x59, 0xAF, 0x39, 0xFF, 0xFC, 0xA4, 0x9F, 0xFF, 0x95, 0x9E, 0xAA, 0xAA, 0xAF, 0x69, 0xE5,
+    0xE9, 0x59, 0xE5, 0xAE, 0x59, 0xE6, 0xEA, 0x49, 0xE6, 0x9E, 0x93, 0x9E, 0x7F, 0x39, 0xE7, 0x9E,
+    0xA2, 0x9E, 0x70, 0xAE, 0x77, 0x0F, 0x77, 0x9E, 0x97, 0x7F, 0x77, 0x9E, 0x90, 0x77, 0x59, 0xAF,
+    0xDA, 0x95, 0x9F, 0xFF, 0x5F, 0xFF, 0xC4, 0xD9, 0x5A, 0xF7, 0x59, 0xE9, 0x75, 0xEA, 0x75, 0xAD,
+    0xA7, 0x5E, 0xA7, 0x5E, 0xA7, 0x4A, 0xE7, 0x4F, 0xC7, 0x19, 0xAF, 0xC7, 0x0A, 0xFE, 0x7A, 0xFE,
+    0x96, 0x9F, 0xDA, 0x97, 0xAF, 0xCA, 0x71, 0x9F, 0xA7, 0x3F, 0x75, 0xE9, 0x75, 0xE7, 0x6E, 0x76,
+    0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x0A, 0xCA, 0x1A, 0xFC, 0xAA, 0xAA, 0xAF, 0xA2, 0x9F, 0xFF, 0xCA,
+    0x4A, 0xFF, 0xCA, 0x97, 0x09, 0x99, 0x99, 0x40, 0x49, 0x99, 0x99, 0x79, 0xFF, 0xC9, 0x4F, 0xFE,
+    0xA3, 0xAD, 0xA9, 0x09, 0x9A, 0xEA, 0x73, 0xAE, 0x74, 0xE7, 0x39, 0xE7, 0x3F, 0x71, 0xAF, 0x96,
+    0x9F, 0xD9, 0x5A, 0xFD, 0xA5, 0x9F, 0xDA, 0x69, 0xFC, 0x97, 0x0F, 0x97, 0x2E, 0x97, 0x29, 0xE7,
+    0x4E, 0x74, 0xEA, 0x79, 0xA1, 0xAF, 0x99, 0x99, 0x9A, 0xE2, 0xAF, 0xFF, 0x39, 0xFF, 0xCA, 0x97,
+    0x99, 0x99, 0x40, 0x0F, 0xFF, 0xFC, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0xFA, 0x76,
+    0xF7, 0x7F, 0x76, 0x9F, 0x76, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x76, 0xF7, 0x69,
+    0xF7, 0x6E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5E, 0x97, 0x5E, 0xA7, 0x5F, 0x75, 0xAE,
+    0x75, 0x9E, 0x97, 0x5E, 0x97, 0x5E, 0xA7, 0x5A, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF,
+    0xD0, 0x29, 0xAA, 0xA9, 0x72, 0xFE, 0x70, 0xFF, 0xA7, 0xE1, 0xAE, 0x69, 0xDA, 0x2E, 0x7E, 0x91,
+    0xE9, 0x6F, 0xFC, 0x97, 0xFF, 0x97, 0x09, 0xAA, 0xAE, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97,
+    0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x4E, 0xA7, 0x4A, 0xE7, 0x49, 0xFC,
+    0xAD, 0x70, 0xAF, 0xE7, 0x19, 0xAF, 0xA0, 0x4A, 0xA7, 0x1A, 0xD7, 0x1E, 0x71, 0xE7, 0x0A, 0xE6,
+    0xAF, 0xFD, 0xA9, 0xFF, 0xEA, 0x09, 0x9F, 0x99, 0x99, 0x99, 0x2A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7,
+    0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7,
+    0x0A, 0xE7, 0x09, 0xE7, 0x09, 0xE9, 0x70, 0xFA, 0x99, 0x99, 0x39, 0xFE, 0xA4, 0x9F, 0xDA, 0x79,
+    0xAD, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xDA, 0x5F, 0xD9,
+    0x5F, 0xD6, 0xAE, 0xA1, 0x2A, 0xAF, 0xFF, 0xF1, 0x9F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x09, 0xE9,
+    0x3A, 0xE7, 0x0A, 0xD9, 0x4A, 0xE7, 0x0A, 0xD9, 0x4A, 0xE7, 0x09, 0xDA, 0x4A, 0xE7, 0x71, 0xAE,
+    0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77,
+    0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A,
+    0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7, 0x71, 0xAE, 0x77, 0x1A, 0xE7,
+    0x00, 0x59, 0xAA, 0xAA, 0x95, 0xAF, 0xD4, 0xAF, 0xE4, 0xEA, 0x19, 0x93, 0x9E, 0x70, 0x9E, 0x70,
+    0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x6A, 0xFF, 0xDA, 0x9F, 0xFE, 0xA0, 0x99, 0xF9, 0x99, 0x99, 0x92,
+    0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70,
+    0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0xAE, 0x70, 0x9E, 0x70, 0x9E, 0x97, 0x0F, 0xA9, 0x99, 0x93,
+    0x9F, 0xEA, 0x49, 0xFD, 0xA7, 0x99, 0x91, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF,
+    0xFE, 0x97, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7,
+    0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70,
+    0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E,
+    0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x71, 0xE9, 0x77, 0x0F, 0x77, 0x0A, 0xFD, 0x76, 0xFD,
+    0x77, 0xAF, 0x40, 0x77, 0x7A, 0xAA, 0x97, 0x77, 0xEA, 0x9D, 0xA7, 0x49, 0xE2, 0xE9, 0xAE, 0x74,
+    0x9E, 0x19, 0xE0, 0xAE, 0x74, 0x9E, 0x1E, 0xA0, 0xAE, 0x74, 0x9E, 0x9A, 0xE1, 0xAE, 0x74, 0x9F,
+    0xE2, 0xAE, 0x74, 0x9F, 0xC9, 0x3A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6,
+    0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74,
+    0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A,
+    0xE7, 0x49, 0xE6, 0x9E, 0x74, 0xAE, 0x69, 0xE7, 0x4E, 0xA7, 0xEA, 0x73, 0xE9, 0x7A, 0xE9, 0x71,
+    0xF7, 0x1F, 0xA6, 0x9F, 0x97, 0x2F, 0xDA, 0xAA, 0xAF, 0xCA, 0x74, 0xFF, 0xFC, 0xA7, 0x69, 0xAF,
+    0xFA, 0x77, 0x49, 0x99, 0x97, 0x60, 0x77, 0x77, 0x75, 0xE9, 0x77, 0x39, 0xE9, 0x77, 0x39, 0xE1,
+    0xE9, 0x70, 0x9E, 0x1E, 0xA1, 0xE9, 0x70, 0x9E, 0x0A, 0xE2, 0xE9, 0x70, 0x9F, 0xE9, 0x2E, 0x97,
+    0x09, 0xFD, 0x4E, 0x97, 0x09, 0xE9, 0x6E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09,
+    0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9,
+    0x70, 0x9E, 0x7E, 0x97, 0x0A, 0xE7, 0xE9, 0x70, 0xF7, 0xF7, 0x9F, 0x7A, 0xE9, 0x59, 0xFC, 0x70,
+    0xFC, 0x99, 0x9A, 0xEA, 0xE7, 0x09, 0xFF, 0xDA, 0x0E, 0x72, 0xAF, 0xE9, 0x1E, 0x75, 0x99, 0x97,
+    0x60, 0x9A, 0xAA, 0x94, 0xF5, 0xEA, 0x5E, 0x95, 0xE6, 0xE6, 0x99, 0x00, 0x3A, 0xAA, 0xA3, 0x9E,
+    0xA3, 0xF3, 0xAE, 0x4E, 0x4E, 0x59, 0x95, 0x4A, 0xAA, 0xA7, 0x09, 0xFA, 0x69, 0xFD, 0x95, 0xE9,
+    0x9E, 0x4E, 0x91, 0x9E, 0x2E, 0x5E, 0x19, 0x97, 0x99, 0x00, 0x29, 0xA9, 0x59, 0xA2, 0xFC, 0xA3,
+    0xD1, 0xAF, 0xEA, 0x9A, 0xD1, 0xD9, 0x09, 0xFE, 0x90, 0x9D, 0x39, 0xF9, 0x29, 0x74, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x90, 0xAF, 0xFD, 0xAA, 0xFF, 0xDA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0xAC, 0x7C, 0xAA, 0xCA,
+    0x5A, 0xCA, 0x0E, 0x99, 0x9A, 0xE1, 0xAF, 0xF9, 0x29, 0xFD, 0x96, 0x99, 0x40, 0x0A, 0xA0, 0xAF,
+    0xEA, 0xDA, 0x09, 0x90, 0x19, 0x59, 0x2E, 0x3E, 0x09, 0xE3, 0xE1, 0xE3, 0xE2, 0x95, 0x91, 0xAD,
+    0xA9, 0x1F, 0xD0, 0x99, 0x9A, 0xDA, 0x3E, 0x3D, 0xA0, 0x9A, 0xE1, 0xAD, 0xA2, 0xAC, 0xA3, 0x9C,
+    0xA2, 0x29, 0xAA, 0x94, 0xFD, 0x2A, 0xD9, 0x9A, 0xD1, 0xD3, 0xD1, 0xD3, 0xD1, 0xD9, 0x2D, 0x19,
+    0xDA, 0xAD, 0xA2, 0xAF, 0xA6, 0x93, 0x29, 0xAA, 0xA2, 0xAA, 0xAA, 0x2E, 0xA1, 0x9E, 0x2A, 0xE2,
+    0xE9, 0x2E, 0x2A, 0xDA, 0x2E, 0x3D, 0xA2, 0x9D, 0x3D, 0xA4, 0x94, 0x99, 0x40, 0x0A, 0xA9, 0x59,
+    0xAA, 0x1A, 0xDA, 0x3A, 0xDA, 0x2A, 0xDA, 0x1A, 0xDA, 0x4E, 0xAE, 0xA6, 0xFD, 0x70, 0xF7, 0x29,
+    0x95, 0x9A, 0xA9, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xA9, 0xAA, 0x90, 0x9A, 0xA9, 0x19,
+    0xAA, 0x9A, 0xDA, 0x1A, 0xDA, 0xAD, 0xA1, 0xAD, 0xAA, 0xDA, 0x1A, 0xDA, 0xAD, 0xA1, 0xAD, 0xAA,
+    0xDA, 0x1A, 0xDA, 0x9A, 0xA9, 0x19, 0xAA, 0x90, 0x9A, 0xAA, 0x91, 0xAA, 0xAA, 0x4F, 0x19, 0xE9,
+    0x4E, 0x91, 0x9E, 0x49, 0xE2, 0xAD, 0xA4, 0x9D, 0xA2, 0xAD, 0x59, 0xD3, 0xAD, 0x69, 0x49, 0x90,
+    0x4A, 0xA7, 0x0A, 0xE7, 0xF7, 0xAD, 0xA3, 0xAC, 0x29, 0x92, 0xCA, 0xAC, 0xA5, 0xAC, 0xA9, 0xDA,
+    0xA9, 0x9A, 0xE1, 0xAF, 0xF9, 0x29, 0xFD, 0x96, 0x99, 0x40, 0x29, 0xAA, 0xAA, 0x94, 0xFF, 0x2F,
+    0xFD, 0x09, 0xD9, 0x39, 0xD9, 0xAC, 0x95, 0x9C, 0xA0, 0x97, 0x90, 0x2A, 0xC9, 0x19, 0xD9, 0x1A,
+    0xD2, 0xE1, 0xAD, 0xA1, 0xEA, 0x1E, 0x90, 0xAE, 0x1F, 0x19, 0x99, 0x91, 0x1E, 0xA1, 0xEA, 0x09,
+    0xE9, 0x0A, 0xE1, 0xAD, 0xA1, 0xE2, 0xE1, 0x9D, 0x91, 0xAD, 0x29, 0x99, 0x20, 0xAD, 0xA1, 0xAE,
+    0x19, 0xE2, 0xE9, 0x1A, 0xDA, 0x19, 0xE2, 0xE2, 0xAD, 0x92, 0xDA, 0x29, 0x99, 0x1A, 0xDA, 0x1E,
+    0xA0, 0x9E, 0x90, 0x9E, 0x1A, 0xDA, 0x1E, 0x91, 0xE1, 0x9D, 0x91, 0xAD, 0x29, 0x99, 0x20, 0x9A,
+    0xAA, 0x93, 0xF3, 0x9E, 0x93, 0x9E, 0x49, 0xE4, 0x9D, 0xA5, 0x90, 0x29, 0xAA, 0xAA, 0x2F, 0x29,
+    0xE9, 0x2E, 0x92, 0xE9, 0x29, 0xD9, 0x49, 0x50, 0x4D, 0x94, 0xD9, 0x0A, 0xAA, 0xAD, 0x99, 0xFD,
+    0x90, 0xAA, 0xAE, 0x94, 0xD9, 0x4D, 0x97, 0x9D, 0x49, 0xD4, 0x9D, 0xAA, 0xAA, 0x09, 0xFD, 0x99,
+    0xEA, 0xAA, 0x09, 0xD4, 0x9D, 0x74, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF, 0xC0, 0x9F, 0xFC,
+    0x79, 0xD7, 0x9D, 0x79, 0xD7, 0x9D, 0x79, 0xD7, 0x9D, 0x70, 0xAA, 0x00, 0x39, 0xAA, 0x94, 0xF4,
+    0xEA, 0x39, 0xE9, 0x3F, 0x2A, 0xF2, 0xFC, 0x3D, 0xA9, 0x75, 0x29, 0x1A, 0xD0, 0xAD, 0xA0, 0xD2,
+    0xD2, 0xD2, 0xAD, 0xA1, 0xAD, 0x39, 0x00, 0x72, 0xD5, 0xD5, 0xD2, 0x99, 0xAD, 0xA9, 0x9F, 0xFA,
+    0xFD, 0xA0, 0x7F, 0xFF, 0xF1, 0x9D, 0x94, 0xD5, 0xD5, 0xD2, 0x2D, 0x5D, 0x29, 0x99, 0xD9, 0x99,
+    0xFF, 0xFF, 0x2D, 0x5D, 0x5A, 0xA2, 0x09, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xF9, 0x0F, 0xF0, 0x3A,
+    0xAA, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29, 0xEA, 0xFC, 0xAA, 0xFC, 0x09, 0xEA, 0x10, 0xAA,
+    0xA3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE9, 0x2A, 0xFC, 0xA0, 0xFC, 0xA1, 0xAE, 0x90, 0x1A,
+    0x91, 0xEA, 0x0E, 0xA0, 0xEA, 0x1A, 0x90, 0x19, 0x59, 0x2E, 0x3E, 0x09, 0xE3, 0xE1, 0xE3, 0xE2,
+    0x95, 0x91, 0x29, 0xAA, 0x94, 0xFD, 0x2A, 0xD9, 0x9A, 0xD1, 0xD3, 0xD1, 0xD3, 0xD1, 0xD9, 0x2D,
+    0x19, 0xDA, 0xAD, 0xA2, 0xAF, 0xA6, 0x93, 0x1A, 0xAA, 0x91, 0xE1, 0x9D, 0xA1, 0xAD, 0x2D, 0xA1,
+    0x9D, 0x39, 0x30, 0x2D, 0x49, 0xCA, 0x4E, 0xA3, 0x9A, 0xE5, 0xDA, 0x4D, 0xA3, 0xAD, 0xAA, 0xFD,
+    0x0A, 0xF9, 0x10, 0x39, 0x5D, 0xA3, 0xE3, 0x9D, 0x4D, 0xA4, 0xDA, 0x4E, 0x4A, 0xFC, 0x2F, 0xC7,
+    0x00, 0x9A, 0xA9, 0xAD, 0xAA, 0xDA, 0xAD, 0xAA, 0xDA, 0xAD, 0xA9, 0xAA, 0x90, 0x75, 0xAF, 0xFF,
+    0xAA, 0xFF, 0xFA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0x75, 0x0A, 0xA3,
+    0xAA, 0x3A, 0xA1, 0xD3, 0xD3, 0xD1, 0xAD, 0x99, 0xF9, 0x9D, 0xA2, 0xFF, 0xF4, 0x9A, 0xA9, 0x19,
+    0xAA, 0x92, 0x0A, 0xA9, 0x59, 0xAA, 0x1A, 0xDA, 0x3A, 0xDA, 0x2A, 0xDA, 0x1A, 0xDA, 0x4E, 0xAF,
+    0x6F, 0xD7, 0x0F, 0x72, 0x99, 0x50, 0x4A, 0xAA, 0xA7, 0x0A, 0xF9, 0x69, 0xFD, 0x95, 0xE9, 0x9E,
+    0x4E, 0x91, 0x9E, 0x2E, 0x5E, 0x19, 0x97, 0x99, 0x00, 0xAC, 0x7C, 0xAA, 0xCA, 0x5A, 0xCA, 0x9D,
+    0xA9, 0x99, 0xAE, 0x1A, 0xFF, 0x92, 0x9F, 0xD9, 0x69, 0x94, 0x29, 0xAA, 0xAA, 0x94, 0xFF, 0x2F,
+    0xFD, 0x09, 0xD9, 0x39, 0xD9, 0xAC, 0x95, 0x9C, 0xA0, 0x97, 0x90, 0x29, 0xA9, 0x5A, 0x90, 0x9F,
+    0xC9, 0x29, 0xCA, 0x0F, 0xF9, 0x9D, 0x9A, 0xD1, 0x9F, 0xE0, 0xD9, 0x3A, 0xF1, 0x99, 0x73, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFD, 0xAA, 0xFF, 0xDA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x9F, 0xFF, 0xF9, 0x9F, 0xFF, 0xF9, 0x77,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x29, 0xA9, 0x59, 0xA2, 0xFC, 0x93,
+    0xD1, 0xFF, 0x99, 0xDA, 0x09, 0xD9, 0x09, 0xFE, 0x1A, 0xC9, 0x39, 0xF9, 0x29, 0x74, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0xAF, 0xFF, 0xFF, 0xFD, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xDA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x70, 0x99, 0x79, 0xE6, 0xAF, 0x49, 0xFA, 0x39, 0xFC, 0x4A, 0xF9, 0x5E, 0xA7, 0x9C,
+    0x77, 0x40, 0x74, 0x99, 0x74, 0xE7, 0x4D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xD9, 0x73, 0xAD,
+    0x74, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x3A, 0xD7, 0x4D, 0xA7, 0x39, 0xD9, 0x73,
+    0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x74, 0xE7, 0x39, 0xD9, 0x73, 0xE7, 0x4D, 0xA7, 0x3A, 0xD7, 0x4E,
+    0x73, 0x9D, 0x97, 0x3E, 0x74, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x73, 0x9D, 0x97, 0x3E, 0x74, 0xDA,
+    0x77, 0x73, 0x99, 0x2E, 0x19, 0xDA, 0x2D, 0x2D, 0x2D, 0x0A, 0xDA, 0x0D, 0xA1, 0x93, 0x75, 0xAD,
+    0x7D, 0xAA, 0xD7, 0xDA, 0xAD, 0x7D, 0xAA, 0xD7, 0xDA, 0xAF, 0xFF, 0xAA, 0xFF, 0xFA, 0x75, 0x0F,
+    0xFF, 0xD1, 0xFF, 0xFD, 0x1D, 0x71, 0xD1, 0xD7, 0x1D, 0x1D, 0x71, 0xD1, 0xD9, 0x99, 0x99, 0x99,
+    0x99, 0x9D, 0x1F, 0xFF, 0xD1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x29, 0xAA, 0x91,
+    0x9A, 0xAA, 0x4F, 0xFF, 0x2A, 0xD1, 0xAE, 0x1A, 0xCA, 0x1D, 0x3D, 0x3D, 0x1A, 0xA3, 0xAA, 0x3A,
+    0xA0, 0x70, 0xA9, 0x19, 0xA0, 0xAD, 0x99, 0xDA, 0x0F, 0xD2, 0xF2, 0x9F, 0x90, 0x9F, 0xD9, 0x9D,
+    0x1D, 0x90, 0x93, 0x90, 0x39, 0x19, 0xE9, 0x0E, 0xA0, 0x9D, 0x92, 0xD9, 0x2A, 0xD3, 0xE2, 0x9D,
+    0x29, 0xD9, 0x0A, 0xE0, 0x9E, 0x29, 0x30, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xAA, 0xAA, 0x39, 0xEA, 0x3A, 0xE4, 0xAE, 0x4A, 0xDA, 0x4A, 0xD9, 0x59, 0x00, 0x3A,
+    0xAA, 0xA3, 0xAE, 0x93, 0xEA, 0x3E, 0xA3, 0xAD, 0xA3, 0x9D, 0xA5, 0x96, 0x29, 0xA9, 0x5A, 0x90,
+    0x9F, 0xC9, 0x29, 0xCA, 0x0F, 0xF9, 0x9D, 0x9A, 0xD1, 0x9F, 0xE0, 0xD9, 0x3A, 0xF1, 0x99, 0x73,
+    0x5F, 0xA0, 0xFC, 0x91, 0xAD, 0x91, 0x9D, 0x91, 0xAD, 0x19, 0xD7, 0x77, 0x3F, 0x49, 0x91, 0x9E,
+    0x90, 0x91, 0x9D, 0xA0, 0xAE, 0x0E, 0x0A, 0xE0, 0xE9, 0x0E, 0x99, 0xDA, 0x0D, 0xA1, 0xE2, 0x90,
+    0x9D, 0x39, 0x69, 0x70, 0x9D, 0xA1, 0x9D, 0xA1, 0x9D, 0xA1, 0x9E, 0x99, 0x0F, 0xC1, 0xEA, 0x0A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFF, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE1, 0xD9, 0x71, 0x9D, 0x1D, 0x97, 0x19, 0xD1, 0xD9, 0x71, 0x9D, 0x1D, 0x73, 0xD0, 0x77, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xA9, 0x19, 0xAA, 0x9A, 0xDA, 0x1A,
+    0xDA, 0xAD, 0xA1, 0xAD, 0xAA, 0xDA, 0x1A, 0xDA, 0xAD, 0xA1, 0xAD, 0xAA, 0xDA, 0x1A, 0xDA, 0x9A,
+    0xA9, 0x19, 0xAA, 0x90, 0x9F, 0xD9, 0x9F, 0xD9, 0x0A, 0xAA, 0xAD, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x90, 0x69, 0xA7, 0x9A, 0x90, 0xD9, 0x1A, 0x90, 0x9F, 0xE1, 0x9C, 0xA0, 0xFF, 0x99, 0xD9,
+    0xAD, 0x1F, 0xF0, 0xD9, 0x09, 0xDA, 0xF1, 0x99, 0x1D, 0x97, 0x39, 0x70, 0x5A, 0xA7, 0x2A, 0xDA,
+    0x71, 0xAD, 0xA7, 0x19, 0xD9, 0x79, 0xA9, 0x5A, 0x90, 0x9F, 0xC9, 0x29, 0xCA, 0x0F, 0xF9, 0x9D,
+    0x9A, 0xD1, 0x9F, 0xE0, 0xD9, 0x3A, 0xF2, 0x93, 0x99, 0x72, 0xAD, 0xA7, 0x1A, 0xDA, 0x71, 0x9D,
+    0x97, 0x29, 0x95, 0x73, 0x92, 0xAE, 0xA3, 0xD1, 0xAF, 0xDA, 0x9A, 0xD1, 0xD9, 0x09, 0xFD, 0x91,
+    0xD3, 0x9E, 0xA7, 0x71, 0x9E, 0x93, 0xD1, 0x9F, 0xD9, 0x09, 0xD1, 0xDA, 0x9A, 0xFD, 0xA1, 0xD3,
+    0xAF, 0x29, 0x69, 0x30, 0x77, 0x09, 0xC3, 0xC9, 0x4A, 0xD9, 0x99, 0x9D, 0xA2, 0xFF, 0xF1, 0xAF,
+    0xFD, 0xA2, 0x9D, 0x3D, 0x95, 0xA3, 0xA7, 0x71, 0x72, 0xAA, 0x49, 0xDA, 0x29, 0xFA, 0x19, 0xAD,
+    0xAA, 0x3D, 0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x10, 0x9F, 0xC9, 0x3F, 0xD3, 0x9F, 0xC9, 0x9F, 0xC9,
+    0x3F, 0xD3, 0x9F, 0xC9, 0x9C, 0xA9, 0x99, 0x59, 0x99, 0x95, 0x99, 0x9A, 0xC9, 0x9C, 0xA7, 0x75,
+    0xAC, 0x99, 0xCA, 0x71, 0x99, 0x71, 0xAC, 0x99, 0xCA, 0x6C, 0xA0, 0xD0, 0xAC, 0x6A, 0xC9, 0x71,
+    0xCA, 0x09, 0x90, 0xAC, 0x77, 0x0D, 0x71, 0xD7, 0x5A, 0xA7, 0x1A, 0xA7, 0x4A, 0x75, 0xA9, 0x59,
+    0x29, 0xC9, 0x73, 0x9C, 0xA2, 0x90, 0x9C, 0xA2, 0x97, 0x59, 0x2A, 0xC9, 0x9C, 0xA1, 0x97, 0x79,
+    0x1A, 0xC9, 0x9C, 0xA1, 0xD7, 0x5A, 0xC9, 0x0A, 0xC9, 0x9C, 0xA1, 0xA9, 0x75, 0x9A, 0x1A, 0xC9,
+    0x9C, 0xA7, 0x75, 0xAC, 0x90, 0xA9, 0x19, 0xC9, 0x73, 0x9C, 0xA1, 0x9A, 0x59, 0xC9, 0x74, 0xC9,
+    0x73, 0x99, 0x71, 0x99, 0x75, 0xD7, 0x1D, 0x75, 0x99, 0x0C, 0x93, 0x9C, 0x09, 0x96, 0x9C, 0xA6,
+    0xCA, 0x0D, 0x0A, 0xC6, 0xAC, 0x99, 0xCA, 0x71, 0xAA, 0x71, 0xAC, 0x99, 0xCA, 0x77, 0x5A, 0xC9,
+    0x9C, 0xA7, 0x75, 0xAC, 0x99, 0xFC, 0x93, 0xFD, 0x39, 0xFC, 0x99, 0xFC, 0x93, 0xFD, 0x39, 0xFC,
+    0x90, 0x09, 0x5D, 0xA3, 0xAE, 0xA9, 0x2A, 0xE2, 0x9E, 0x09, 0xFA, 0x0E, 0x92, 0xA9, 0x30, 0x29,
+    0x19, 0xD9, 0x9D, 0xA0, 0xAC, 0xA1, 0xAC, 0x91, 0xAC, 0xA1, 0x9D, 0xA1, 0x9D, 0x92, 0x90, 0x39,
+    0x99, 0x95, 0xAF, 0xDA, 0x2A, 0xFF, 0xC0, 0x9D, 0xA9, 0x19, 0xAD, 0x9A, 0xCA, 0x59, 0xCA, 0x9A,
+    0x19, 0xD9, 0x1A, 0x93, 0xF7, 0xF7, 0xAD, 0x97, 0x70, 0x09, 0x91, 0x92, 0xD9, 0x9D, 0x1F, 0xD2,
+    0xF2, 0x9F, 0x90, 0x9F, 0xD9, 0x0A, 0xC1, 0xD7, 0x00, 0x59, 0x39, 0xD0, 0x9A, 0xEA, 0x0F, 0x91,
+    0xE9, 0x2A, 0xF3, 0xAE, 0x49, 0xC0, 0x09, 0x5D, 0x93, 0xFA, 0x29, 0xF2, 0x9E, 0x09, 0xFA, 0x0E,
+    0x92, 0xC9, 0x30, 0x97, 0x5D, 0xA5, 0xE2, 0xAE, 0xA3, 0xE9, 0x3A, 0xE9, 0x0A, 0xEA, 0x39, 0xE9,
+    0x0D, 0x9D, 0x2A, 0xF0, 0x9D, 0x0D, 0x90, 0xEA, 0x2D, 0x90, 0x9D, 0x0C, 0xA4, 0xD2, 0xD0, 0x99,
+    0x2A, 0xD1, 0x9E, 0x2D, 0x91, 0xAC, 0x91, 0xD9, 0x9E, 0x0A, 0xD1, 0x99, 0x20, 0x1A, 0xA1, 0xEA,
+    0x0E, 0xA0, 0xEA, 0x1A, 0x90, 0x2A, 0xA5, 0xD2, 0x9C, 0x9D, 0x9C, 0x9A, 0xFD, 0xA9, 0x9F, 0x99,
+    0x09, 0xF9, 0x1D, 0xAA, 0xD2, 0xA1, 0xA1, 0x19, 0xAD, 0xA1, 0xAD, 0xA9, 0x29, 0xFF, 0xF9, 0x1D,
+    0x91, 0xAD, 0xA1, 0x9D, 0x1D, 0x3D, 0x3D, 0x1D, 0x3D, 0x3D, 0x1D, 0x91, 0xAD, 0xA1, 0x9D, 0x19,
+    0xFF, 0xF9, 0x29, 0xEA, 0x1A, 0xE9, 0x10, 0x19, 0x5A, 0xC9, 0x4D, 0x5F, 0xD9, 0x9F, 0xD5, 0xD4,
+    0x9C, 0xA4, 0x9A, 0x10, 0x09, 0x97, 0x77, 0x99, 0x1E, 0x77, 0x5E, 0x19, 0xE7, 0x73, 0xE9, 0x29,
+    0xEA, 0x77, 0xAE, 0x94, 0x9F, 0xCA, 0x99, 0x59, 0x9A, 0xFC, 0x97, 0xAF, 0xFF, 0xFD, 0xA7, 0x39,
+    0xFF, 0xFD, 0x97, 0x71, 0x9A, 0xAA, 0xAA, 0xA9, 0x97, 0x10, 0x09, 0x97, 0x77, 0x99, 0x1E, 0x77,
+    0x5E, 0x19, 0xE7, 0x73, 0xE9, 0x29, 0xEA, 0x77, 0xAE, 0x94, 0x9F, 0xCA, 0x99, 0x59, 0x9A, 0xFC,
+    0x97, 0xAF, 0xFF, 0xFD, 0xA7, 0x39, 0xFF, 0xFD, 0x97, 0x71, 0x9A, 0xAA, 0xAA, 0xA9, 0x97, 0x10,
+    0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFF, 0xD9,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x09, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFF, 0xD9, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x49, 0xAA, 0xA9, 0x97, 0x79, 0xA2, 0x9F, 0xFE,
+    0xA9, 0x72, 0xD1, 0x9F, 0xFF, 0xFA, 0xA9, 0x99, 0x99, 0xAD, 0xA1, 0xE9, 0x59, 0xAA, 0xFF, 0xFD,
+    0x19, 0xD7, 0x49, 0xAF, 0xF9, 0x77, 0x77, 0x00, 0x71, 0x9A, 0xAA, 0xDA, 0xAA, 0x97, 0x70, 0xAF,
+    0xFF, 0xDA, 0x73, 0xFF, 0xFF, 0xF7, 0x9F, 0xC9, 0x97, 0x99, 0xAF, 0x94, 0xAE, 0xA7, 0x7A, 0xEA,
+    0x29, 0xE7, 0x73, 0xE9, 0x1E, 0x77, 0x5E, 0x19, 0x97, 0x77, 0x99, 0x00, 0x77, 0x77, 0x77, 0x59,
+    0xC4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x1A, 0xFF,
+    0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xFF, 0xFE, 0x97, 0x77, 0x09, 0xD7, 0x77, 0x29, 0xA7, 0x77, 0x71,
+    0x29, 0x99, 0x29, 0xCA, 0xAD, 0x6C, 0xA5, 0xCA, 0x09, 0xFD, 0x9C, 0x92, 0xAC, 0xAC, 0x3D, 0x9C,
+    0x90, 0x9A, 0xD0, 0x9E, 0x99, 0xA0, 0x29, 0x99, 0x4D, 0xAD, 0x2C, 0xA2, 0xAC, 0x09, 0xC9, 0x29,
+    0xC0, 0x9F, 0xE9, 0x9C, 0x7C, 0x96, 0xAC, 0xA9, 0x09, 0xA2, 0x9A, 0xE9, 0x00, 0x09, 0x09, 0xC1,
+    0x91, 0x90, 0x9C, 0x09, 0xC0, 0x9C, 0x09, 0xC0, 0x9C, 0x09, 0xC0, 0x9C, 0x09, 0xC0, 0x29, 0x99,
+    0x39, 0xDA, 0xD9, 0x09, 0xC9, 0x2A, 0xC0, 0xAC, 0x4C, 0x9D, 0x4C, 0xAA, 0xC4, 0xCA, 0x9C, 0x39,
+    0xC9, 0x0D, 0x90, 0x9C, 0xA2, 0xAE, 0x91, 0x09, 0x49, 0x09, 0xC3, 0x9C, 0x09, 0xC3, 0x9C, 0x09,
+    0xC3, 0x9C, 0x09, 0xC3, 0x9C, 0x09, 0xC3, 0x9C, 0x09, 0xC3, 0xAC, 0x1C, 0xA1, 0xAD, 0x19, 0xAD,
+    0xA0, 0xC0, 0x29, 0x99, 0x19, 0xDA, 0xCA, 0x9C, 0x93, 0xAC, 0x4A, 0xC4, 0xAC, 0x49, 0xC5, 0xD9,
+    0x09, 0x91, 0xAE, 0x90, 0x6A, 0x69, 0xC6, 0x9C, 0x39, 0x90, 0x9C, 0x1A, 0xCA, 0xAC, 0xAC, 0x09,
+    0xC9, 0x2D, 0x0A, 0xC3, 0x9C, 0x0C, 0xA3, 0x9C, 0x0C, 0xA3, 0x9C, 0x0A, 0xC3, 0xAC, 0x1D, 0x90,
+    0x9D, 0x2A, 0xDA, 0x0C, 0x00, 0x9A, 0x69, 0xC6, 0x9C, 0x69, 0xC1, 0x99, 0x29, 0xCA, 0xCA, 0xDA,
+    0x09, 0xCA, 0x2A, 0xC0, 0x9C, 0x4C, 0x09, 0xC4, 0xC0, 0x9C, 0x4C, 0x09, 0xC4, 0xC0, 0x9C, 0x4C,
+    0x09, 0xC4, 0xC0, 0x09, 0x19, 0x93, 0x99, 0x2C, 0xAC, 0xAD, 0xAA, 0xCA, 0xD9, 0x0D, 0x2A, 0xCA,
+    0x2D, 0x0C, 0xA2, 0x9C, 0x3A, 0xC0, 0xC9, 0x29, 0xC3, 0xAC, 0x0C, 0x92, 0x9C, 0x3A, 0xC0, 0xC9,
+    0x29, 0xC3, 0xAC, 0x0C, 0x92, 0x9C, 0x3A, 0xC0, 0xC9, 0x3C, 0x39, 0xA0, 0x39, 0x0A, 0xAA, 0xD9,
+    0xAC, 0xA2, 0xAC, 0x3A, 0xC3, 0xAC, 0x3A, 0xC3, 0xAC, 0x3A, 0xA3, 0x70, 0xA9, 0x39, 0xCA, 0x99,
+    0x09, 0xEA, 0xA2, 0xC9, 0x4C, 0x94, 0xC9, 0x4C, 0x94, 0xC9, 0x4D, 0x5A, 0xD0, 0x69, 0x0A, 0xC4,
+    0xC9, 0x0C, 0x92, 0xAC, 0x1A, 0xC2, 0xC9, 0x19, 0xC1, 0x9C, 0x3C, 0xA0, 0xCA, 0x39, 0xC9, 0xC5,
+    0xE5, 0x9C, 0x92, 0x09, 0x49, 0x1C, 0xA2, 0xCA, 0x2C, 0x90, 0xAC, 0x39, 0xCA, 0xC5, 0xAC, 0x95,
+    0xE4, 0xCA, 0x0C, 0xA2, 0xD2, 0xCA, 0x09, 0xA3, 0x9A, 0x00, 0x71, 0xAD, 0xA7, 0x73, 0xF7, 0x72,
+    0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E,
+    0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7,
+    0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99,
+    0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9,
+    0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA,
+    0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x9F, 0xFC, 0xAA, 0x96, 0x9F, 0xFF,
+    0xD9, 0x39, 0xFF, 0xFF, 0x29, 0xE6, 0x9A, 0xFA, 0x19, 0xE7, 0x1F, 0x19, 0xE7, 0x19, 0xE9, 0x09,
+    0xE7, 0x2E, 0x90, 0x9E, 0x72, 0xE9, 0x09, 0xE7, 0x2E, 0x90, 0x9E, 0x71, 0xAE, 0x19, 0xE7, 0x09,
+    0xE9, 0x19, 0xE9, 0x99, 0x99, 0x99, 0xAF, 0x92, 0x9F, 0xFF, 0xC9, 0x49, 0xFF, 0xFD, 0x93, 0x9E,
+    0x99, 0x99, 0x99, 0x9A, 0xFC, 0x91, 0x9E, 0x71, 0xF1, 0x9E, 0x72, 0xF0, 0x9E, 0x72, 0xAE, 0x09,
+    0xE7, 0x29, 0xE9, 0x9E, 0x72, 0x9E, 0x99, 0xE7, 0x29, 0xE9, 0x9E, 0x72, 0xF0, 0x9E, 0x71, 0x9F,
+    0x09, 0xE7, 0x0A, 0xF1, 0x9F, 0xFF, 0xF9, 0x19, 0xFF, 0xFE, 0x92, 0x9F, 0xFF, 0xA9, 0x40, 0x9F,
+    0xFF, 0xCA, 0x9F, 0xFF, 0xD9, 0xFF, 0xFD, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E,
+    0x72, 0x9E, 0x72, 0x9E, 0x72, 0x9E, 0x72, 0x71, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71,
+    0xFD, 0x77, 0x09, 0xDA, 0xAD, 0x97, 0x7A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0xAD, 0xA1, 0xAD,
+    0x97, 0x5E, 0x91, 0x9E, 0x74, 0x9E, 0x3E, 0x97, 0x3A, 0xDA, 0x3A, 0xDA, 0x73, 0xE5, 0xE7, 0x2A,
+    0xDA, 0x5A, 0xD9, 0x71, 0xE9, 0x59, 0xE7, 0x09, 0xE7, 0xE9, 0x7A, 0xDA, 0x7A, 0xDA, 0x7E, 0x71,
+    0xE6, 0xAE, 0x71, 0xE9, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xDA, 0x3E,
+    0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0x91, 0xE9, 0x75, 0xAE, 0x09, 0xFF, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF,
+    0xFD, 0xAA, 0xFF, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x0F, 0xFF,
+    0xFC, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA7, 0x5F, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE,
+    0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F,
+    0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E,
+    0xA7, 0x5F, 0x75, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0xAF, 0xFF, 0xFD, 0x9E, 0x75, 0xE0, 0x9E,
+    0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E,
+    0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7,
+    0x49, 0xE0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE0, 0x9F, 0xFF, 0xFF, 0x09, 0xFF,
+    0xFF, 0xF0, 0x9E, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7,
+    0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0,
+    0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74, 0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x9E, 0x74,
+    0x9E, 0x09, 0xE7, 0x49, 0xE0, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF,
+    0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E,
+    0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77,
+    0x0A, 0xEA, 0xE2, 0xFF, 0xE9, 0x1A, 0xEA, 0xE2, 0xFF, 0xE9, 0x1A, 0xEA, 0xE2, 0xFF, 0xE9, 0x1A,
+    0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77, 0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76,
+    0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F,
+    0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99,
+    0x97, 0x10, 0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69, 0xE6, 0x9E,
+    0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F, 0xFC, 0x0A,
+    0xFF, 0xC0, 0x9E, 0x72, 0x9E, 0x90, 0x9E, 0x71, 0x9E, 0xA1, 0x9E, 0x71, 0xEA, 0x29, 0xE7, 0x0F,
+    0x39, 0xE7, 0xF4, 0x9E, 0x6F, 0x59, 0xE5, 0xAE, 0x69, 0xE4, 0xAE, 0x79, 0xE3, 0xAE, 0x97, 0x9E,
+    0x29, 0xE9, 0x70, 0x9E, 0x19, 0xE9, 0x71, 0x9E, 0x09, 0xEA, 0x72, 0x9E, 0x0F, 0xA7, 0x29, 0xFF,
+    0xC9, 0x71, 0x9F, 0xCA, 0xF7, 0x19, 0xF9, 0x09, 0xF7, 0x09, 0xE3, 0xAE, 0xA7, 0x9E, 0x4F, 0x96,
+    0x9E, 0x5F, 0x69, 0xE5, 0x9E, 0xA5, 0x9E, 0x6A, 0xE9, 0x49, 0xE7, 0xF4, 0x9E, 0x70, 0xF3, 0x9E,
+    0x70, 0x9E, 0xA2, 0x9E, 0x71, 0xAE, 0x91, 0x9E, 0x72, 0xF1, 0x9E, 0x73, 0xF0, 0x71, 0xE7, 0x72,
+    0xAE, 0x97, 0x71, 0xFC, 0x77, 0x09, 0xFC, 0x77, 0x0A, 0xD9, 0xDA, 0x77, 0xE0, 0xE7, 0x69, 0xDA,
+    0x0A, 0xD9, 0x75, 0xE1, 0x9D, 0xA7, 0x5E, 0x2E, 0x74, 0xAD, 0xA2, 0xAD, 0x97, 0x3E, 0x39, 0xE7,
+    0x29, 0xE4, 0xE7, 0x2A, 0xD9, 0x4A, 0xD9, 0x71, 0xE5, 0x9E, 0x70, 0x9E, 0x6E, 0x70, 0xE9, 0x6A,
+    0xDA, 0x7E, 0x79, 0xE6, 0xAD, 0xA7, 0x0E, 0x95, 0xE9, 0x70, 0xAD, 0xA5, 0xE7, 0x19, 0xE4, 0xAD,
+    0xA7, 0x2E, 0x93, 0xE9, 0x72, 0xAE, 0x29, 0xE7, 0x4E, 0x2A, 0xDA, 0x74, 0xEA, 0x1E, 0x97, 0x4A,
+    0xE0, 0x9E, 0x76, 0xE9, 0xEA, 0x76, 0xEA, 0x9F, 0xA7, 0x7A, 0xF9, 0x9F, 0xC7, 0x7F, 0xC9, 0x9F,
+    0xC9, 0x75, 0x9F, 0xC9, 0x9F, 0xD7, 0x5F, 0xD9, 0x9D, 0xAE, 0x75, 0xFD, 0x99, 0xDA, 0xAD, 0xA7,
+    0x3A, 0xD9, 0xE9, 0x9D, 0xA9, 0xE7, 0x3E, 0x0E, 0x99, 0xDA, 0x0E, 0x97, 0x19, 0xDA, 0x0E, 0x99,
+    0xDA, 0x0A, 0xDA, 0x71, 0xE9, 0x0E, 0x99, 0xDA, 0x1E, 0x71, 0xE1, 0xE9, 0x9D, 0xA1, 0xE9, 0x7A,
+    0xDA, 0x1E, 0x99, 0xE1, 0x9E, 0x7E, 0x2E, 0x99, 0xE2, 0xE9, 0x59, 0xE2, 0xE9, 0x9E, 0x2A, 0xDA,
+    0x5A, 0xD9, 0x2E, 0x99, 0xE3, 0xE5, 0xE3, 0xE9, 0x9E, 0x3E, 0x93, 0x9D, 0xA3, 0xE9, 0x9E, 0x39,
+    0xE3, 0xE4, 0xE9, 0x9E, 0x4E, 0x3E, 0x4E, 0x99, 0xE4, 0xAD, 0xA1, 0xAD, 0x94, 0xE9, 0x9E, 0x49,
+    0xE1, 0xE5, 0xE9, 0x9E, 0x5E, 0x99, 0xDA, 0x5E, 0x99, 0xE5, 0xAD, 0xAA, 0xD9, 0x5E, 0x99, 0xE6,
+    0xFD, 0x6E, 0x99, 0xE6, 0xFC, 0xA6, 0xE9, 0x9E, 0x69, 0xF7, 0xE9, 0x9E, 0x7F, 0x7E, 0x99, 0xE7,
+    0xAD, 0x97, 0xE9, 0x9E, 0xA7, 0x5D, 0xA9, 0xF9, 0x73, 0x9E, 0x9F, 0xC7, 0x39, 0xE9, 0xFC, 0xA7,
+    0x29, 0xE9, 0xFD, 0x97, 0x19, 0xE9, 0xDA, 0xF7, 0x19, 0xE9, 0xDA, 0x9E, 0xA7, 0x09, 0xE9, 0xDA,
+    0x0A, 0xE7, 0x09, 0xE9, 0xDA, 0x1F, 0x79, 0xE9, 0xDA, 0x19, 0xEA, 0x69, 0xE9, 0xDA, 0x2A, 0xE6,
+    0x9E, 0x9D, 0xA3, 0xF5, 0x9E, 0x9E, 0x39, 0xE9, 0x49, 0xE9, 0xE4, 0xF4, 0x9E, 0x9E, 0x5E, 0xA3,
+    0x9E, 0x9E, 0x59, 0xE9, 0x29, 0xE9, 0xE6, 0xF2, 0x9E, 0x9E, 0x7E, 0xA2, 0xE9, 0xE7, 0xAE, 0x91,
+    0xE9, 0xE7, 0x0F, 0x1E, 0x9E, 0x70, 0x9E, 0xA0, 0xE9, 0xE7, 0x1A, 0xE9, 0xE9, 0xE7, 0x2F, 0xE9,
+    0xE7, 0x29, 0xFD, 0x9E, 0x73, 0xAF, 0xC9, 0xE7, 0x4F, 0xC9, 0xE7, 0x49, 0xF0, 0x0F, 0xFF, 0xFC,
+    0x91, 0xFF, 0xFF, 0xC9, 0x1F, 0xFF, 0xFC, 0x91, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0x4A, 0xFF, 0xFD, 0x4A, 0xFF, 0xFD, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE,
+    0x0F, 0xFF, 0xFE, 0x00, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF,
+    0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1,
+    0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A,
+    0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7,
+    0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2,
+    0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD,
+    0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x9F, 0xFF, 0xFE, 0xA9,
+    0xFF, 0xFF, 0xEA, 0x9F, 0xFF, 0xFE, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A,
+    0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E,
+    0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD,
+    0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7,
+    0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA,
+    0x9E, 0x74, 0xAD, 0xA9, 0xE7, 0x4A, 0xDA, 0x9E, 0x74, 0xAD, 0xA0, 0x9F, 0xFA, 0xA9, 0x59, 0xFF,
+    0xFC, 0x92, 0x9F, 0xFF, 0xDA, 0x19, 0xE4, 0x99, 0xFC, 0x90, 0x9E, 0x79, 0xF0, 0x9E, 0x70, 0x9E,
+    0x99, 0xE7, 0x1E, 0xA9, 0xE7, 0x1F, 0x9E, 0x71, 0xAE, 0x9E, 0x71, 0xEA, 0x9E, 0x71, 0xE9, 0x9E,
+    0x70, 0xAE, 0x09, 0xE7, 0xAE, 0xA0, 0x9E, 0x99, 0x99, 0x9A, 0xAF, 0xC1, 0x9F, 0xFF, 0xCA, 0x29,
+    0xFF, 0xF9, 0x39, 0xEA, 0xAA, 0xAA, 0x99, 0x69, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59,
+    0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x59, 0xE7, 0x50, 0x0F, 0xFF, 0xFC, 0x90,
+    0xFF, 0xFF, 0xCA, 0x0F, 0xFF, 0xFC, 0xA0, 0xFA, 0x76, 0xF7, 0x7F, 0x76, 0x9F, 0x76, 0x9E, 0xA7,
+    0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x76, 0xF7, 0x69, 0xF7, 0x6E, 0xA7, 0x5F, 0x75, 0xAE, 0x75,
+    0x9E, 0x97, 0x5E, 0x97, 0x5E, 0xA7, 0x5F, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5E, 0x97, 0x5E, 0xA7,
+    0x5A, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xD0, 0x9F, 0xFF, 0xFE, 0x9A, 0xFF, 0xFF,
+    0xE9, 0xAF, 0xFF, 0xFE, 0x97, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E,
+    0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77,
+    0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09,
+    0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7,
+    0x00, 0xAD, 0xA7, 0x49, 0xDA, 0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE, 0x3E, 0x97, 0x1E, 0x93,
+    0xAE, 0x70, 0xAE, 0x5E, 0x97, 0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E, 0x97, 0xAE, 0x4E, 0xA7,
+    0x1E, 0xA2, 0x9E, 0x72, 0x9E, 0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E, 0x0E, 0xA7, 0x5F, 0xE7,
+    0x69, 0xFC, 0x97, 0x7F, 0xC7, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71,
+    0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9,
+    0x70, 0x74, 0xAD, 0x97, 0x77, 0x0E, 0x97, 0x77, 0x0E, 0xA7, 0x72, 0x9A, 0xFF, 0xFA, 0x97, 0x29,
+    0xFF, 0xFF, 0xD9, 0x7F, 0xEA, 0xAF, 0xAF, 0xEA, 0x5F, 0xC9, 0x3E, 0x93, 0xAF, 0xA3, 0xAE, 0xA5,
+    0xE9, 0x5F, 0x92, 0xEA, 0x6E, 0x96, 0xF1, 0xAE, 0x7E, 0x96, 0x9E, 0x1E, 0xA7, 0xE9, 0x7E, 0x90,
+    0xE9, 0x7E, 0x97, 0xEA, 0x0E, 0x97, 0xE9, 0x7A, 0xDA, 0x0E, 0x97, 0xE9, 0x7A, 0xDA, 0x0E, 0x97,
+    0xE9, 0x7E, 0xA0, 0xEA, 0x7E, 0x97, 0xE9, 0x0A, 0xE7, 0xE9, 0x69, 0xE2, 0xE9, 0x6E, 0x96, 0xF2,
+    0xAE, 0x95, 0xE9, 0x5A, 0xE9, 0x3F, 0xA4, 0xE9, 0x4F, 0xA4, 0x9F, 0xCA, 0x99, 0x0E, 0xA0, 0x9A,
+    0xFD, 0x7F, 0xFF, 0xFE, 0xA7, 0x19, 0xAF, 0xFF, 0xDA, 0x76, 0x99, 0xAA, 0xFA, 0x99, 0x77, 0x5E,
+    0x97, 0x77, 0x0E, 0x97, 0x77, 0x0E, 0x97, 0x30, 0x0A, 0xDA, 0x73, 0x9D, 0xA1, 0x9E, 0x97, 0x2E,
+    0x92, 0xF7, 0x1E, 0xA4, 0xEA, 0x79, 0xE5, 0xAE, 0x7E, 0x96, 0xF5, 0xAE, 0x70, 0xE9, 0x39, 0xE7,
+    0x1A, 0xE3, 0xE9, 0x72, 0xEA, 0x1A, 0xE7, 0x39, 0xE9, 0x0E, 0x75, 0xAF, 0xDA, 0x76, 0xFD, 0x77,
+    0x9F, 0x77, 0x09, 0xF9, 0x77, 0xFD, 0x76, 0xAF, 0xDA, 0x75, 0xE0, 0x9E, 0x74, 0xEA, 0x1F, 0x72,
+    0x9E, 0x3E, 0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAD, 0xA5, 0xEA, 0x69, 0xE6, 0x9E, 0x95, 0xEA, 0x7A,
+    0xE4, 0xAE, 0x71, 0xEA, 0x29, 0xE9, 0x71, 0xAE, 0x2E, 0xA7, 0x3F, 0x0A, 0xE7, 0x49, 0xEA, 0x9D,
+    0xA6, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE,
+    0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE,
+    0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0xAE, 0x59, 0xE6, 0xE9, 0x9E, 0x59, 0xE5, 0x9E, 0x1E,
+    0x94, 0x9E, 0x5A, 0xE1, 0xEA, 0x49, 0xE5, 0xEA, 0x1A, 0xE4, 0x9E, 0x49, 0xE9, 0x2F, 0x39, 0xE4,
+    0xF3, 0x9F, 0x91, 0x9E, 0x2A, 0xF5, 0x9F, 0xFF, 0xFC, 0x97, 0xFF, 0xFD, 0xA7, 0x3A, 0xAF, 0xEA,
+    0x97, 0x70, 0x9E, 0x77, 0x49, 0xE7, 0x74, 0x9E, 0x77, 0x49, 0xE7, 0x74, 0x9E, 0x77, 0x49, 0xE7,
+    0x74, 0x9E, 0x72, 0x77, 0x77, 0x19, 0xAF, 0xEA, 0x97, 0x49, 0xFF, 0xFC, 0x97, 0x1A, 0xFF, 0xFE,
+    0xA7, 0xAF, 0xA6, 0xAF, 0xA5, 0x9F, 0x72, 0xF9, 0x4F, 0x74, 0xF3, 0xAE, 0x75, 0x9E, 0xA2, 0xEA,
+    0x76, 0xF1, 0x9E, 0x97, 0x69, 0xE1, 0xAE, 0x77, 0x0E, 0x90, 0xAE, 0x77, 0x0E, 0xA0, 0xF7, 0x70,
+    0xEA, 0x0E, 0xA7, 0x70, 0xEA, 0x0E, 0xA7, 0x70, 0xEA, 0x0A, 0xE7, 0x70, 0xEA, 0x0A, 0xE7, 0x70,
+    0xE9, 0x09, 0xE7, 0x70, 0xE2, 0xE9, 0x76, 0xAE, 0x2A, 0xE7, 0x6E, 0xA3, 0xE9, 0x74, 0x9E, 0x49,
+    0xE7, 0x4E, 0x95, 0xAE, 0x72, 0xEA, 0x7E, 0xA7, 0x0F, 0x71, 0xAE, 0x6E, 0xA5, 0xFF, 0xD4, 0xFF,
+    0xD0, 0xFF, 0xD4, 0xFF, 0xD0, 0xFF, 0xD4, 0xFF, 0xD0, 0x59, 0x99, 0x97, 0x6A, 0xFE, 0x91, 0xE5,
+    0xFF, 0xDA, 0x0E, 0x4F, 0xC9, 0x99, 0x9A, 0xDA, 0xE3, 0xAE, 0x95, 0x9F, 0xC3, 0xEA, 0x7A, 0xF2,
+    0x9E, 0x71, 0xF2, 0xAE, 0x71, 0xF2, 0xEA, 0x71, 0xAE, 0x2E, 0xA7, 0x19, 0xE2, 0xE9, 0x71, 0x9E,
+    0x2E, 0x97, 0x19, 0xE2, 0xEA, 0x71, 0x9E, 0x2E, 0xA7, 0x1A, 0xE2, 0xAE, 0x71, 0xAE, 0x29, 0xE7,
+    0x1F, 0x3E, 0xA7, 0x9F, 0x3A, 0xEA, 0x59, 0xFC, 0x4F, 0xCA, 0x99, 0xAE, 0xAE, 0xA9, 0x3F, 0xFD,
+    0x90, 0xFC, 0xA3, 0x9F, 0xE9, 0x2F, 0xA6, 0x99, 0x96, 0x99, 0x10, 0x59, 0xAA, 0xAA, 0x97, 0x09,
+    0xFF, 0xCA, 0x59, 0xFF, 0xF3, 0x9F, 0x92, 0x9F, 0xA2, 0xF6, 0xAE, 0x19, 0xE7, 0x0E, 0xA0, 0xAE,
+    0x70, 0xEA, 0x0A, 0xDA, 0x70, 0xAD, 0xA0, 0xEA, 0x70, 0xAD, 0xA0, 0xE9, 0x70, 0xE9, 0x0E, 0x97,
+    0x9E, 0x1E, 0x97, 0xE9, 0x1E, 0x91, 0x99, 0x99, 0xAE, 0x92, 0xE9, 0x1F, 0xD9, 0x4E, 0x91, 0xFE,
+    0xA3, 0xE9, 0x19, 0x99, 0x99, 0xF9, 0x1E, 0x97, 0x9E, 0x90, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x1E,
+    0x9E, 0x97, 0x1A, 0xDA, 0xE9, 0x71, 0x9F, 0xD9, 0x71, 0x9F, 0xD9, 0x71, 0xAF, 0xD9, 0x71, 0xEA,
+    0xE9, 0x70, 0x9E, 0x9F, 0x96, 0x9F, 0x0F, 0xDA, 0x99, 0x99, 0xFC, 0x1F, 0xFF, 0xE9, 0x1E, 0xAA,
+    0xFF, 0xA3, 0xE9, 0x29, 0x99, 0x96, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75,
+    0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0x77, 0x2E, 0xA7, 0x2E, 0x09, 0xE7, 0x2E, 0x1E, 0x97, 0x1E,
+    0x1A, 0xDA, 0x71, 0xE1, 0x9E, 0x70, 0x9E, 0x2E, 0x97, 0x9E, 0x2A, 0xDA, 0x7A, 0xDA, 0x29, 0xE7,
+    0xAD, 0x93, 0xE9, 0x6E, 0x4A, 0xDA, 0x6E, 0x5E, 0x5A, 0xDA, 0x5E, 0x94, 0xE6, 0xAD, 0xA3, 0x9E,
+    0x7E, 0x3E, 0x97, 0xE9, 0x1A, 0xE7, 0x09, 0xDA, 0x1E, 0x72, 0xE0, 0xE9, 0x72, 0xAF, 0xD7, 0x39,
+    0xFC, 0x75, 0xF7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E, 0xA7, 0x6E,
+    0xA7, 0x6A, 0xD9, 0x70, 0x79, 0xAA, 0xAA, 0x99, 0x72, 0xAF, 0xFC, 0x97, 0xAF, 0xFF, 0x59, 0xEA,
+    0x39, 0xEA, 0x5E, 0xA6, 0x9C, 0x6E, 0x77, 0x0E, 0x77, 0x0E, 0xA7, 0x79, 0xEA, 0x77, 0xAF, 0x97,
+    0x6A, 0xFC, 0x75, 0x9F, 0xDA, 0x72, 0xFF, 0xD7, 0x9F, 0x91, 0x9F, 0x94, 0x9E, 0xA5, 0xF4, 0xEA,
+    0x7F, 0x2A, 0xE7, 0x1E, 0x91, 0xEA, 0x71, 0xAD, 0xA1, 0xE7, 0x29, 0xE0, 0x9E, 0x73, 0xE0, 0x9E,
+    0x73, 0xE0, 0x9E, 0x72, 0x9E, 0x1E, 0x97, 0x1A, 0xE1, 0xF7, 0x1E, 0xA1, 0x9E, 0x97, 0x9E, 0x3F,
+    0x95, 0x9E, 0xA4, 0xFC, 0xA9, 0x9A, 0xFC, 0x6F, 0xFE, 0xA7, 0x09, 0xFF, 0x97, 0x49, 0x99, 0x97,
+    0x59, 0x99, 0x99, 0x97, 0xAF, 0xFC, 0x92, 0x9F, 0xFF, 0x2F, 0xA9, 0x99, 0x9A, 0xE1, 0x9E, 0x79,
+    0x91, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xF9, 0x73, 0xFF, 0xA7, 0xAF, 0xE6, 0xFF, 0xA4,
+    0x9E, 0xA7, 0x2E, 0xA7, 0x3E, 0x73, 0x9E, 0x74, 0xE9, 0x73, 0xF7, 0x09, 0x19, 0xFC, 0xA9, 0x99,
+    0xAE, 0x2A, 0xFF, 0xF4, 0xAF, 0xFC, 0xA7, 0x99, 0x99, 0x40, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE7, 0x3E,
+    0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE7, 0x3E, 0x97, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xE9, 0x72,
+    0xEA, 0x72, 0x9E, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0x97, 0x3E, 0xA7,
+    0x3F, 0x73, 0x9E, 0xA7, 0x3F, 0xC9, 0x72, 0xFD, 0xA9, 0x70, 0xAF, 0xFA, 0x7A, 0xFF, 0x71, 0x9A,
+    0xFA, 0x73, 0xF7, 0x39, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x72, 0x9E, 0x73, 0x9A, 0xA9,
+    0x10, 0x79, 0x99, 0x94, 0xE1, 0x9F, 0xEA, 0x2E, 0x0A, 0xFF, 0xD1, 0xEA, 0xE9, 0x99, 0x9F, 0xC0,
+    0xFC, 0x95, 0xAE, 0x9F, 0xA7, 0xEA, 0xF7, 0x0A, 0xDA, 0xF7, 0x0A, 0xFD, 0xA7, 0x0A, 0xFD, 0xA7,
+    0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A,
+    0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD, 0x97, 0x0A, 0xFD,
+    0x97, 0x0A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4A,
+    0xE7, 0x4A, 0xE7, 0x4A, 0xE0, 0x59, 0xAA, 0xAA, 0x97, 0x29, 0xFF, 0xA7, 0xAF, 0xFD, 0xA5, 0x9F,
+    0x91, 0x9A, 0xEA, 0x4E, 0xA5, 0x9E, 0x3A, 0xE7, 0xAD, 0xA2, 0xE9, 0x70, 0xE2, 0xE7, 0x1E, 0x90,
+    0x9E, 0x71, 0xAD, 0xA0, 0xAD, 0xA7, 0x19, 0xE0, 0xAD, 0xA7, 0x19, 0xE0, 0xEA, 0x72, 0xE0, 0xE9,
+    0x72, 0xE0, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xE0, 0xE9,
+    0x72, 0xE0, 0xE9, 0x72, 0xE0, 0xEA, 0x72, 0xE0, 0xAD, 0xA7, 0x19, 0xE0, 0x9E, 0x71, 0x9E, 0x09,
+    0xE7, 0x1A, 0xDA, 0x1E, 0x71, 0xE9, 0x1A, 0xDA, 0x79, 0xE2, 0x9E, 0x7E, 0xA3, 0xAE, 0x5A, 0xE5,
+    0xFA, 0x99, 0xAF, 0x96, 0xFF, 0xDA, 0x70, 0xAF, 0xE9, 0x74, 0x99, 0x97, 0x70, 0xE9, 0x4E, 0x94,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9,
+    0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xAE, 0x49, 0xF9, 0x99, 0x90, 0xFE, 0xA1, 0xAF, 0xCA, 0x39, 0x99,
+    0x10, 0x77, 0x0E, 0xA6, 0x9E, 0xA0, 0xEA, 0x59, 0xEA, 0x1E, 0xA5, 0xF2, 0xEA, 0x4F, 0x3E, 0xA3,
+    0xF4, 0xEA, 0x2A, 0xE9, 0x4E, 0xA1, 0x9E, 0x95, 0xEA, 0x09, 0xEA, 0x6E, 0xA0, 0xEA, 0x7E, 0xAF,
+    0xC7, 0xFF, 0xCA, 0x6F, 0xC9, 0x9E, 0x95, 0xF9, 0x1A, 0xE5, 0xEA, 0x3F, 0x4E, 0xA3, 0x9E, 0xA3,
+    0xEA, 0x4A, 0xE9, 0x2E, 0xA5, 0xF2, 0xEA, 0x6F, 0x1E, 0xA6, 0x9E, 0xA0, 0xEA, 0x7A, 0xE9, 0x9A,
+    0xAA, 0x97, 0x6F, 0xDA, 0x74, 0xFF, 0x77, 0xAE, 0xA7, 0x79, 0xE9, 0x77, 0xAE, 0x77, 0x0E, 0x77,
+    0x0E, 0xA7, 0x79, 0xE7, 0x7A, 0xE9, 0x76, 0xFA, 0x75, 0x9F, 0xC7, 0x5A, 0xDA, 0xD9, 0x74, 0xE9,
+    0xE7, 0x39, 0xDA, 0x0E, 0x73, 0xAD, 0x90, 0xAD, 0xA7, 0x2E, 0x19, 0xE7, 0x19, 0xDA, 0x2E, 0x97,
+    0x0E, 0x92, 0xAD, 0xA7, 0x0E, 0x39, 0xE7, 0xAD, 0xA4, 0xE9, 0x6E, 0x94, 0xAE, 0x59, 0xE6, 0xE5,
+    0xAD, 0xA6, 0xEA, 0x4E, 0x96, 0xAE, 0x39, 0xE7, 0x0E, 0x92, 0xEA, 0x70, 0xF9, 0x1E, 0x97, 0x09,
+    0xF9, 0x9E, 0x72, 0xF9, 0x77, 0x99, 0x10, 0x77, 0x3E, 0x97, 0x09, 0xE2, 0xE9, 0x70, 0x9E, 0x2E,
+    0x97, 0x09, 0xE2, 0xE9, 0x70, 0x9E, 0x2E, 0x97, 0x09, 0xE2, 0xE9, 0x70, 0x9E, 0x2E, 0x97, 0x09,
+    0xE2, 0xE9, 0x70, 0x9E, 0x2E, 0x97, 0x09, 0xE2, 0xE9, 0x70, 0x9E, 0x2E, 0x97, 0x09, 0xE2, 0xE9,
+    0x70, 0x9E, 0x2E, 0x97, 0x09, 0xE2, 0xEA, 0x70, 0xAE, 0x2E, 0xA7, 0x0F, 0x2F, 0x79, 0xF2, 0xFA,
+    0x59, 0xFC, 0x2F, 0xDA, 0x99, 0x9E, 0xAF, 0x99, 0xFF, 0xFA, 0x0A, 0xFA, 0xE9, 0x9F, 0xD9, 0x2F,
+    0xAE, 0x91, 0x99, 0x96, 0x99, 0x90, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77,
+    0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0x77, 0x2E, 0xA7, 0x2E, 0x09, 0xE7, 0x2E, 0x1E, 0x97, 0x1E,
+    0x1A, 0xDA, 0x71, 0xE1, 0x9E, 0x70, 0x9E, 0x2E, 0x97, 0x9E, 0x2A, 0xDA, 0x7A, 0xDA, 0x29, 0xE7,
+    0xAD, 0x93, 0xE9, 0x6E, 0x93, 0xAD, 0xA6, 0xE5, 0xE5, 0xAD, 0xA5, 0xE9, 0x4E, 0x95, 0xAD, 0xA3,
+    0x9E, 0x7E, 0x3E, 0x97, 0xE9, 0x1A, 0xE7, 0x09, 0xDA, 0x1E, 0x72, 0xE0, 0xEA, 0x72, 0xFE, 0x73,
+    0x9F, 0xC7, 0x5F, 0x70, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xFD, 0x1F, 0xFF,
+    0xD4, 0x9A, 0xDA, 0x97, 0x0A, 0xDA, 0x72, 0xAD, 0x97, 0x29, 0xE7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7,
+    0x3A, 0xDA, 0x73, 0x9E, 0x74, 0xF7, 0x4F, 0xA9, 0x97, 0x1A, 0xFF, 0xCA, 0x49, 0xFF, 0xCA, 0x3F,
+    0xA9, 0x99, 0x99, 0x93, 0xEA, 0x72, 0xEA, 0x72, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x97,
+    0x3E, 0xA7, 0x3A, 0xE7, 0x39, 0xEA, 0x73, 0xFC, 0x97, 0x2F, 0xE9, 0x70, 0xAF, 0xFA, 0x7A, 0xFF,
+    0x71, 0x9A, 0xFA, 0x73, 0xF7, 0x39, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x72, 0x9E, 0x73,
+    0x9A, 0xA9, 0x10, 0x69, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A,
+    0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72,
+    0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E,
+    0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99,
+    0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x79, 0xFF, 0xFF, 0xFD, 0xA9,
+    0xFF, 0xFF, 0xFD, 0xA0, 0x99, 0x9A, 0xE9, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0x99, 0x93, 0x9E, 0x7A,
+    0xDA, 0x79, 0xE7, 0xAD, 0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xE7, 0xAD, 0xA7, 0x9E, 0x7A, 0xDA, 0x79,
+    0xE7, 0xAD, 0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xE7, 0xAD, 0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xE7, 0xAD,
+    0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xE7, 0xAD, 0xA7, 0x9E, 0x7A, 0xDA, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+    0x9E, 0xA9, 0x94, 0x9E, 0x70, 0xFD, 0x49, 0xE7, 0x1F, 0xC7, 0x73, 0x99, 0x91, 0x69, 0x99, 0x97,
+    0x4A, 0xFE, 0xA7, 0x9F, 0xFE, 0x59, 0xFA, 0x99, 0x9A, 0xF4, 0xF5, 0x9F, 0x29, 0xE7, 0x9E, 0x91,
+    0xEA, 0x70, 0xF1, 0xE9, 0x70, 0x9E, 0x1E, 0x72, 0xE0, 0x9E, 0x72, 0xE9, 0x9E, 0x72, 0xE9, 0x9E,
+    0x72, 0xE9, 0x9E, 0x72, 0xE9, 0x9E, 0x72, 0xE9, 0x9E, 0x71, 0x9E, 0x09, 0xE7, 0x1E, 0xA0, 0x9E,
+    0x70, 0x9E, 0x90, 0x9F, 0x69, 0xF1, 0x9F, 0xDA, 0x99, 0x9F, 0xC2, 0x9F, 0xFF, 0xD3, 0x9E, 0x0A,
+    0xFE, 0x94, 0x9E, 0x39, 0x99, 0x79, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x69,
+    0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x60, 0x69, 0x99, 0x99, 0x79, 0xFF, 0xC9, 0x3A, 0xFF, 0xD9, 0x2A,
+    0xFA, 0x99, 0x9A, 0xD2, 0x9E, 0xA7, 0x2F, 0x72, 0x9E, 0x73, 0xAE, 0x73, 0xEA, 0x73, 0xEA, 0x73,
+    0xE9, 0x73, 0xE9, 0x73, 0xEA, 0x73, 0xEA, 0x73, 0xAE, 0x73, 0x9E, 0x97, 0x3F, 0x97, 0x29, 0xFA,
+    0x72, 0x9F, 0xCA, 0x97, 0x09, 0xFF, 0xA7, 0x9F, 0xF7, 0x19, 0xAF, 0xA7, 0x3F, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x29, 0xE7, 0x39, 0xAA, 0x91, 0x77, 0x71, 0xAF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0x19, 0xFC, 0xAA, 0x99, 0xEA, 0x99, 0x99, 0x1F, 0x95, 0xE4, 0xAE, 0x79, 0xE3, 0xE9,
+    0x70, 0xE9, 0x19, 0xE7, 0x1A, 0xDA, 0x1A, 0xDA, 0x71, 0x9E, 0x1E, 0xA7, 0x2E, 0x1E, 0x97, 0x2E,
+    0x1E, 0x97, 0x2E, 0x1E, 0x97, 0x2E, 0x1E, 0xA7, 0x2E, 0x1A, 0xE7, 0x19, 0xE1, 0x9E, 0x71, 0xEA,
+    0x2E, 0xA7, 0x9E, 0x39, 0xEA, 0x59, 0xEA, 0x4A, 0xFA, 0x99, 0x9F, 0xC6, 0xAF, 0xFD, 0xA7, 0x09,
+    0xFF, 0x97, 0x49, 0x99, 0x97, 0x00, 0x77, 0x19, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0x19, 0x99, 0x99,
+    0xEA, 0x99, 0x99, 0x99, 0x96, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xE9, 0x75, 0xEA, 0x75, 0xAE,
+    0x75, 0x9F, 0x99, 0x99, 0xA7, 0x0A, 0xFF, 0x71, 0xAF, 0xE7, 0x49, 0x99, 0x30, 0x77, 0x2E, 0x97,
+    0xAE, 0x1E, 0x97, 0x9E, 0x1E, 0x97, 0x0E, 0x90, 0xE9, 0x70, 0xE9, 0x0E, 0x97, 0x0E, 0xA0, 0xE9,
+    0x70, 0xAD, 0xA0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0A,
+    0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0A, 0xDA, 0x0E, 0x97, 0x0E, 0xA0, 0xE9, 0x70, 0xE9, 0x0E,
+    0xA7, 0x9E, 0x1A, 0xE7, 0xEA, 0x19, 0xEA, 0x5F, 0x3F, 0xC9, 0x99, 0xAF, 0x94, 0xFF, 0xE9, 0x6A,
+    0xFE, 0xA7, 0x39, 0x99, 0x70, 0x71, 0xAA, 0xA7, 0x74, 0xE7, 0x74, 0xE7, 0x74, 0xE7, 0x74, 0xE7,
+    0x74, 0xE7, 0x74, 0xE7, 0x74, 0xE7, 0x73, 0x9E, 0xA7, 0x69, 0xAF, 0xFC, 0xA9, 0x71, 0xFF, 0xFE,
+    0x7F, 0xCA, 0x9E, 0x9A, 0xFC, 0x94, 0xF9, 0x2E, 0x29, 0xF3, 0xAE, 0x4E, 0x4F, 0x2E, 0x94, 0xE5,
+    0xE9, 0x09, 0xE5, 0xE5, 0xEA, 0x0A, 0xDA, 0x5E, 0x5A, 0xE0, 0xEA, 0x5E, 0x59, 0xE0, 0xEA, 0x5E,
+    0x59, 0xE0, 0xEA, 0x5E, 0x59, 0xE0, 0xEA, 0x5E, 0x59, 0xE0, 0xAE, 0x5E, 0x5A, 0xE0, 0x9E, 0x5E,
+    0x5E, 0xA1, 0xE9, 0x4E, 0x49, 0xE9, 0x1A, 0xE4, 0xE4, 0xF3, 0xF9, 0x2E, 0x29, 0xF5, 0xFC, 0xA9,
+    0xEA, 0xAF, 0xC9, 0x6A, 0xFF, 0xFD, 0x72, 0xAF, 0xFC, 0xA9, 0x77, 0xE9, 0x77, 0x3E, 0x77, 0x4E,
+    0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x77, 0x4E, 0x72, 0x77, 0x6F, 0x97,
+    0x3E, 0xA0, 0xFC, 0x97, 0x19, 0xE1, 0x99, 0xF7, 0x1E, 0x94, 0xEA, 0x7A, 0xE5, 0x9E, 0x7E, 0x96,
+    0xE9, 0x5A, 0xDA, 0x79, 0xE5, 0xE7, 0x1E, 0x93, 0xAD, 0xA7, 0x1A, 0xE2, 0x9E, 0x73, 0xE9, 0x1E,
+    0x97, 0x3A, 0xE0, 0x9E, 0x75, 0xE9, 0xE7, 0x6A, 0xFC, 0xA7, 0x7F, 0xC7, 0x70, 0xAE, 0x97, 0x70,
+    0xAE, 0x97, 0x79, 0xFC, 0x77, 0xFD, 0x97, 0x5A, 0xDA, 0xF7, 0x49, 0xE0, 0x9E, 0x74, 0xE9, 0x1E,
+    0xA7, 0x2A, 0xE2, 0x9E, 0x72, 0xE4, 0xEA, 0x70, 0xEA, 0x49, 0xE7, 0x9E, 0x6E, 0xA6, 0xE9, 0x69,
+    0xE9, 0x4A, 0xDA, 0x70, 0xFC, 0xAC, 0x09, 0xE7, 0x2F, 0xD0, 0xEA, 0x73, 0xAF, 0x71, 0x9A, 0xA9,
+    0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x77,
+    0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x77, 0x3A, 0xDA, 0x72, 0xE5, 0xAD, 0xA4, 0xE9, 0x1E, 0x5A, 0xDA,
+    0x4A, 0xDA, 0x1E, 0x5A, 0xDA, 0x49, 0xE1, 0xE5, 0xAD, 0xA5, 0xE1, 0xE5, 0xAD, 0xA5, 0xE1, 0xE5,
+    0xAD, 0xA5, 0xE9, 0x0E, 0x5A, 0xDA, 0x5E, 0x90, 0xE5, 0xAD, 0xA5, 0xE9, 0x0E, 0x5A, 0xDA, 0x5A,
+    0xD9, 0x0E, 0x5A, 0xDA, 0x5A, 0xD9, 0x0E, 0x5A, 0xDA, 0x5E, 0x90, 0xE9, 0x4A, 0xDA, 0x5E, 0x90,
+    0xE9, 0x4A, 0xDA, 0x5E, 0x1E, 0xA4, 0xAD, 0xA4, 0x9E, 0x1A, 0xE4, 0xAD, 0xA4, 0xEA, 0x2E, 0xA3,
+    0xAD, 0xA3, 0xAE, 0x3A, 0xEA, 0x2A, 0xDA, 0x2A, 0xEA, 0x4F, 0xCA, 0xAF, 0xAF, 0xCA, 0x6F, 0xFF,
+    0xEA, 0x70, 0x9A, 0xFF, 0xDA, 0x76, 0x9E, 0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD,
+    0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7, 0x73, 0xAD, 0xA7,
+    0x10, 0x77, 0x74, 0xAD, 0xA7, 0x3A, 0xDA, 0x49, 0xE7, 0x5E, 0x93, 0xE9, 0x75, 0x9E, 0x29, 0xE7,
+    0x7E, 0x91, 0xAD, 0xA7, 0x7A, 0xDA, 0x1E, 0x97, 0x79, 0xE1, 0xE7, 0x99, 0x7E, 0x09, 0xE6, 0xAD,
+    0xA6, 0xE9, 0x9E, 0x6A, 0xDA, 0x6E, 0x9A, 0xE6, 0xAD, 0xA6, 0xEA, 0xAD, 0xA6, 0xAD, 0xA6, 0xAD,
+    0xAA, 0xE6, 0xAD, 0xA6, 0xEA, 0x9E, 0x6A, 0xDA, 0x6E, 0x99, 0xE6, 0xAD, 0xA6, 0xE9, 0x0E, 0x95,
+    0xF5, 0x9E, 0x1A, 0xDA, 0x5F, 0x5A, 0xDA, 0x19, 0xE9, 0x3A, 0xFA, 0x39, 0xE9, 0x2A, 0xEA, 0x99,
+    0xE9, 0x9E, 0x99, 0xAE, 0xA4, 0xFF, 0xC1, 0xFF, 0xC6, 0xAF, 0xCA, 0x3A, 0xFC, 0xA7, 0x19, 0x99,
+    0x79, 0x99, 0x50, 0x71, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE,
+    0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3,
+    0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD,
+    0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF,
+    0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA,
+    0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9,
+    0xEA, 0x77, 0xEA, 0x77, 0x77, 0x77, 0x72, 0x9A, 0x77, 0x4A, 0xE7, 0x73, 0xF7, 0x73, 0xAE, 0x77,
+    0x49, 0xA7, 0x20, 0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A,
+    0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF,
+    0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E,
+    0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA,
+    0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x77, 0x70, 0x9A, 0x97, 0x5E, 0x97, 0x39, 0xE9,
+    0x74, 0xE7, 0x59, 0xA9, 0x50, 0x70, 0xAD, 0xA9, 0x77, 0x2F, 0xD7, 0x71, 0x90, 0x9A, 0xDA, 0x77,
+    0x4D, 0xA7, 0x74, 0xDA, 0x77, 0x19, 0xAE, 0x77, 0x2A, 0xDA, 0x77, 0x3A, 0xCA, 0x77, 0x4A, 0xC9,
+    0x77, 0x77, 0x77, 0x77, 0x4A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA,
+    0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E,
+    0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A,
+    0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF,
+    0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E,
+    0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E,
+    0x9E, 0xA7, 0x7E, 0xA0, 0x59, 0xAC, 0xAA, 0x97, 0x29, 0xFC, 0xA7, 0x29, 0x99, 0xE7, 0x59, 0xD9,
+    0x74, 0xAD, 0x73, 0x9E, 0xA7, 0x3E, 0x97, 0x4D, 0x76, 0xD7, 0x77, 0x79, 0x99, 0x97, 0x09, 0xFF,
+    0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA, 0x74, 0xAE, 0x74, 0x9E, 0x75,
+    0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA, 0xA9, 0x99, 0x09, 0xE0, 0xAE,
+    0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE, 0x0E, 0x97, 0xF0, 0xF5, 0x9F,
+    0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF, 0xE9, 0x1A, 0xD5, 0x99, 0x97,
+    0x77, 0x19, 0xAA, 0x97, 0x73, 0xE7, 0x73, 0xAD, 0x97, 0x39, 0xF1, 0x9D, 0x97, 0x4F, 0xD0, 0x9A,
+    0x75, 0xE9, 0xAD, 0xA7, 0x6A, 0xD9, 0x19, 0xDA, 0x74, 0xAD, 0x5D, 0x97, 0x77, 0x77, 0x77, 0x7A,
+    0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA,
+    0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD,
+    0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70,
+    0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74,
+    0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x77,
+    0x99, 0x97, 0x7A, 0xE7, 0x7E, 0x70, 0xAE, 0x91, 0xE7, 0x09, 0xFC, 0x90, 0xAA, 0x70, 0x9E, 0x9E,
+    0x73, 0xE2, 0xE7, 0x1D, 0xA4, 0xAD, 0x70, 0x97, 0x99, 0x77, 0x77, 0x09, 0x99, 0x97, 0x39, 0xFF,
+    0xC9, 0x7F, 0xFF, 0xA6, 0xAD, 0xA9, 0x90, 0x9A, 0xF7, 0xA7, 0xEA, 0x77, 0xAE, 0x77, 0x9E, 0x77,
+    0x0E, 0x77, 0x9E, 0x79, 0xAA, 0xFF, 0xC5, 0x9F, 0xFF, 0xC4, 0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x3A,
+    0xEA, 0x69, 0xE3, 0xEA, 0x79, 0xE3, 0xE9, 0x79, 0xE2, 0x9E, 0x70, 0xAE, 0x3E, 0x97, 0xF3, 0xF5,
+    0x9F, 0xC3, 0xAF, 0x99, 0x99, 0xEA, 0xE4, 0xFF, 0xDA, 0x0A, 0xD5, 0xAF, 0xE9, 0x1A, 0xD7, 0x09,
+    0x99, 0x72, 0x1A, 0xAA, 0x97, 0x73, 0x9E, 0x77, 0x49, 0xDA, 0x77, 0x49, 0xD1, 0x9F, 0x76, 0x9A,
+    0x90, 0xFD, 0x77, 0x0E, 0x9A, 0xDA, 0x76, 0xAD, 0x91, 0x9D, 0xA7, 0x4A, 0xCA, 0x5D, 0x97, 0x77,
+    0x77, 0x77, 0x7A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70,
+    0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74,
+    0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71,
+    0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A,
+    0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7,
+    0x7E, 0xA0, 0x09, 0x99, 0x76, 0xE9, 0x76, 0xE7, 0x7D, 0xA1, 0xAE, 0xA7, 0x0A, 0xA0, 0x9F, 0xC9,
+    0x72, 0xE9, 0xE7, 0x1E, 0x2E, 0x7D, 0xA4, 0xAD, 0x69, 0x70, 0x97, 0x77, 0x49, 0x99, 0x97, 0x19,
+    0xFF, 0xC9, 0x5F, 0xFF, 0xA4, 0xAD, 0xA9, 0x90, 0x9A, 0xF5, 0xA7, 0xEA, 0x75, 0xAE, 0x75, 0x9E,
+    0x76, 0xE7, 0x59, 0xE5, 0x9A, 0xAF, 0xFC, 0x39, 0xFF, 0xFC, 0x2A, 0xFA, 0xA9, 0x99, 0x09, 0xE1,
+    0xAE, 0xA6, 0x9E, 0x1E, 0xA7, 0x9E, 0x1E, 0x97, 0x9E, 0x09, 0xE7, 0x0A, 0xE1, 0xE9, 0x7F, 0x1F,
+    0x59, 0xFC, 0x1A, 0xF9, 0x99, 0x9E, 0xAE, 0x2F, 0xFD, 0xA0, 0xAD, 0x3A, 0xFE, 0x91, 0xAD, 0x69,
+    0x99, 0x70, 0x76, 0x9D, 0xA9, 0x77, 0x29, 0xAE, 0x97, 0x74, 0x9C, 0xA7, 0x74, 0xAC, 0x97, 0x72,
+    0x9D, 0xA7, 0x49, 0xF1, 0x9C, 0x97, 0x49, 0xFC, 0xA1, 0xA7, 0x5E, 0x9A, 0xDA, 0x76, 0xE2, 0xAD,
+    0x97, 0x4D, 0xA4, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x7A, 0xDA, 0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77,
+    0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75,
+    0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E,
+    0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F,
+    0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4,
+    0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75,
+    0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x74, 0x9A, 0xA9, 0x76, 0xAF, 0x77, 0x0A, 0xC9,
+    0x77, 0xAC, 0x97, 0x59, 0xDA, 0x79, 0xEA, 0x1A, 0xC7, 0x09, 0xFC, 0x90, 0x9C, 0x70, 0xE9, 0xE9,
+    0x71, 0xE2, 0xE7, 0x0D, 0xA4, 0xAD, 0x79, 0x97, 0x97, 0x77, 0x69, 0x99, 0x97, 0x29, 0xFF, 0xC9,
+    0x6F, 0xFF, 0xA5, 0xAD, 0xA9, 0x90, 0x9A, 0xF6, 0xA7, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0xE7,
+    0x69, 0xE6, 0x9A, 0xAF, 0xFC, 0x49, 0xFF, 0xFC, 0x3A, 0xFA, 0xA9, 0x99, 0x09, 0xE2, 0xAE, 0xA6,
+    0x9E, 0x2E, 0xA7, 0x9E, 0x2E, 0x97, 0x9E, 0x19, 0xE7, 0x0A, 0xE2, 0xE9, 0x7F, 0x2F, 0x59, 0xFC,
+    0x2A, 0xF9, 0x99, 0x9E, 0xAE, 0x3F, 0xFD, 0xA0, 0xAD, 0x4A, 0xFE, 0x91, 0xAD, 0x79, 0x99, 0x71,
+    0x70, 0x96, 0x97, 0x49, 0xF9, 0x2D, 0x74, 0xFE, 0xAD, 0x97, 0x3A, 0xCA, 0x1A, 0xFC, 0x74, 0xAA,
+    0x4A, 0xAA, 0x77, 0x77, 0x71, 0xF7, 0x72, 0xFD, 0x77, 0x0E, 0xAA, 0xDA, 0x76, 0xAD, 0x91, 0x9D,
+    0xA7, 0x4A, 0xD5, 0xDA, 0x77, 0x77, 0x77, 0x77, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71,
+    0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E,
+    0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9,
+    0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF,
+    0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49,
+    0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A,
+    0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x77, 0x5A, 0xE9, 0x2A, 0xC9, 0x4A, 0xFD, 0x99, 0xD5,
+    0xD9, 0x9A, 0xFC, 0xA4, 0x9C, 0x93, 0xAD, 0xA7, 0x77, 0x29, 0xE9, 0x72, 0x9F, 0xC7, 0x2E, 0x9E,
+    0x70, 0xE2, 0xE6, 0xDA, 0x4A, 0xD5, 0x97, 0x09, 0x77, 0x72, 0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94,
+    0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A, 0x7E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74,
+    0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1, 0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69,
+    0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7, 0x0A, 0xE0, 0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A,
+    0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD, 0x2A, 0xFE, 0x91, 0xAD, 0x59, 0x99, 0x70, 0x71,
+    0xAA, 0xAA, 0x77, 0x2A, 0xF9, 0x77, 0x09, 0xFD, 0x97, 0x7E, 0x99, 0xE7, 0x6E, 0x91, 0x9E, 0x74,
+    0xE5, 0xE7, 0x39, 0x97, 0x99, 0x77, 0x77, 0x77, 0x77, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97,
+    0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97,
+    0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5,
+    0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97,
+    0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E,
+    0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97,
+    0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x77, 0x77, 0x77, 0x72, 0x9A, 0x77, 0x4A, 0xE7,
+    0x73, 0xF7, 0x73, 0xAE, 0x77, 0x49, 0xA7, 0x20, 0x7A, 0xAA, 0x97, 0x3F, 0xC7, 0x2A, 0xFD, 0x70,
+    0xAE, 0x0E, 0xA6, 0x9E, 0x2A, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0x70, 0x99, 0x77, 0x71, 0x99,
+    0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A, 0x7E, 0xA7, 0x4A,
+    0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1, 0xAF, 0xAA, 0x99,
+    0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7, 0x0A, 0xE0, 0xE9,
+    0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD, 0x2A, 0xFE, 0x91,
+    0xAD, 0x59, 0x99, 0x77, 0x77, 0x09, 0xA7, 0x59, 0xE7, 0x4A, 0xE7, 0x49, 0xE7, 0x59, 0xA6, 0x74,
+    0xE7, 0x73, 0xAD, 0xA7, 0x73, 0xDA, 0x77, 0x3D, 0xA7, 0x79, 0xC9, 0x19, 0x91, 0x9C, 0x97, 0x39,
+    0xD5, 0xD9, 0x74, 0xEA, 0x99, 0xAE, 0x75, 0x9F, 0xF7, 0x70, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x72,
+    0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D, 0xAE, 0x77, 0x0A, 0xD9, 0x9D,
+    0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75, 0xE3, 0xE7, 0x4A, 0xDA, 0x3A,
+    0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5, 0xAD, 0xA7, 0x1E, 0x69, 0xE7,
+    0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF, 0xFF, 0x6A, 0xEA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93, 0xEA, 0x73, 0xAE, 0x29, 0xE7,
+    0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77, 0xE9, 0xEA, 0x77, 0xEA, 0x71,
+    0x9A, 0xAA, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9D, 0x97, 0x0A, 0xA1, 0x9A, 0x2A, 0xA5, 0xD9, 0x49,
+    0xD5, 0xAD, 0x99, 0x09, 0xAD, 0x96, 0xFF, 0xC7, 0x0A, 0xFC, 0xA7, 0x49, 0x77, 0x77, 0x99, 0x99,
+    0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A, 0x7E, 0xA7, 0x4A, 0xE7,
+    0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1, 0xAF, 0xAA, 0x99, 0x90,
+    0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7, 0x0A, 0xE0, 0xE9, 0x7F,
+    0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD, 0x2A, 0xFE, 0x91, 0xAD,
+    0x59, 0x99, 0x70, 0x69, 0xDA, 0x77, 0x4A, 0xD9, 0x77, 0x4E, 0x77, 0x5A, 0xCA, 0x77, 0x09, 0xC9,
+    0x19, 0x91, 0x9C, 0x97, 0x39, 0xD5, 0xD9, 0x74, 0xEA, 0x99, 0xAE, 0x75, 0x9F, 0xF7, 0x70, 0xAF,
+    0xA7, 0x77, 0x77, 0x77, 0x72, 0xAD, 0xA7, 0x73, 0xF7, 0x72, 0x9F, 0x97, 0x71, 0xFD, 0x77, 0x1D,
+    0xAE, 0x77, 0x0A, 0xD9, 0x9D, 0xA7, 0x7E, 0x1E, 0x76, 0x9E, 0x1E, 0x97, 0x5E, 0x91, 0x9E, 0x75,
+    0xE3, 0xE7, 0x4A, 0xDA, 0x3A, 0xDA, 0x73, 0xE9, 0x39, 0xE7, 0x29, 0xE5, 0xE9, 0x71, 0xAD, 0xA5,
+    0xAD, 0xA7, 0x1E, 0x69, 0xE7, 0x0A, 0xE9, 0x99, 0x99, 0x99, 0x9E, 0x97, 0xFF, 0xFF, 0x69, 0xFF,
+    0xFF, 0x6A, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA5, 0xE9, 0x71, 0x9E, 0x49, 0xE7, 0x3E, 0x93,
+    0xEA, 0x73, 0xAE, 0x29, 0xE7, 0x49, 0xE2, 0xAE, 0x75, 0xEA, 0x1E, 0x97, 0x5A, 0xE0, 0x9E, 0x77,
+    0xE9, 0xEA, 0x77, 0xEA, 0x4A, 0xAA, 0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xAD, 0x72, 0xAA, 0x19,
+    0xA2, 0xAA, 0x5D, 0x59, 0xD5, 0xAD, 0x99, 0x09, 0xAD, 0x96, 0xFF, 0xC7, 0x0A, 0xFC, 0xA7, 0x49,
+    0x77, 0x77, 0x99, 0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A,
+    0x7E, 0xA7, 0x4A, 0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1,
+    0xAF, 0xAA, 0x99, 0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7,
+    0x0A, 0xE0, 0xE9, 0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD,
+    0x2A, 0xFE, 0x91, 0xAD, 0x59, 0x99, 0x70, 0x77, 0x77, 0x09, 0xEA, 0x77, 0x39, 0x9D, 0x97, 0x74,
+    0x9C, 0xA7, 0x73, 0x9D, 0x97, 0x72, 0x9D, 0x97, 0x79, 0xC9, 0x1A, 0x29, 0xC9, 0x73, 0x9D, 0x5D,
+    0x97, 0x4E, 0xA9, 0x9A, 0xE7, 0x59, 0xFF, 0x77, 0x0A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xDA,
+    0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77,
+    0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7,
+    0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E,
+    0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x6A, 0xDA,
+    0x74, 0xAA, 0xAD, 0x76, 0xAC, 0x97, 0x49, 0xD7, 0x4E, 0x97, 0x0A, 0xA1, 0xAA, 0x2A, 0xA5, 0xAC,
+    0x95, 0xD5, 0x9D, 0x99, 0x09, 0x9D, 0xA6, 0xFF, 0xC7, 0x0A, 0xFC, 0xA7, 0x49, 0x77, 0x77, 0x99,
+    0x99, 0x70, 0x9F, 0xFC, 0x94, 0xFF, 0xFA, 0x3A, 0xDA, 0x99, 0x09, 0xAF, 0x4A, 0x7E, 0xA7, 0x4A,
+    0xE7, 0x49, 0xE7, 0x5E, 0x74, 0x9E, 0x49, 0xAA, 0xFF, 0xC2, 0x9F, 0xFF, 0xC1, 0xAF, 0xAA, 0x99,
+    0x90, 0x9E, 0x0A, 0xEA, 0x69, 0xE0, 0xEA, 0x79, 0xE0, 0xE9, 0x79, 0xE9, 0xE7, 0x0A, 0xE0, 0xE9,
+    0x7F, 0x0F, 0x59, 0xFC, 0x0A, 0xF9, 0x99, 0x9E, 0xAE, 0x1F, 0xFD, 0xA0, 0xAD, 0x2A, 0xFE, 0x91,
+    0xAD, 0x59, 0x99, 0x70, 0x77, 0x76, 0x9E, 0xA3, 0xD7, 0x4F, 0xDA, 0x9D, 0xA7, 0x3A, 0xCA, 0x1A,
+    0xFC, 0x74, 0xAA, 0x4A, 0xAA, 0x77, 0x77, 0x59, 0xC9, 0x59, 0xC9, 0x73, 0x9C, 0xA5, 0xD7, 0x5E,
+    0x99, 0x9A, 0xE7, 0x59, 0xFF, 0x77, 0x9F, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xDA, 0x77, 0x3F,
+    0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77, 0xE1, 0xE7,
+    0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7, 0x3E, 0x93,
+    0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE, 0x99, 0x99,
+    0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA,
+    0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E, 0x2A, 0xE7,
+    0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA0, 0x77, 0x5A, 0xDA, 0x92,
+    0x9C, 0x94, 0x9F, 0xD9, 0x9D, 0x5D, 0x99, 0xAF, 0xCA, 0x5C, 0xA3, 0xAD, 0xA7, 0x77, 0xAA, 0x6A,
+    0xA5, 0xD5, 0x9D, 0x5A, 0xD9, 0x90, 0x9A, 0xD9, 0x6F, 0xFC, 0x70, 0xAF, 0xCA, 0x74, 0x97, 0x77,
+    0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA,
+    0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA,
+    0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE,
+    0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF,
+    0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x5A, 0xC9, 0x6C, 0xA7, 0x3A, 0xCA, 0x5A, 0xCA, 0x74, 0xEA, 0x99,
+    0xAE, 0x97, 0x4A, 0xFF, 0xA7, 0x69, 0xFD, 0x97, 0x72, 0x99, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xDA,
+    0x77, 0x3F, 0x77, 0x29, 0xF9, 0x77, 0x1F, 0xD7, 0x71, 0xDA, 0xE7, 0x70, 0xAD, 0x99, 0xDA, 0x77,
+    0xE1, 0xE7, 0x69, 0xE1, 0xE9, 0x75, 0xE9, 0x19, 0xE7, 0x5E, 0x3E, 0x74, 0xAD, 0xA3, 0xAD, 0xA7,
+    0x3E, 0x93, 0x9E, 0x72, 0x9E, 0x5E, 0x97, 0x1A, 0xDA, 0x5A, 0xDA, 0x71, 0xE6, 0x9E, 0x70, 0xAE,
+    0x99, 0x99, 0x99, 0x99, 0xE9, 0x7F, 0xFF, 0xF6, 0x9F, 0xFF, 0xF6, 0xAE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xEA, 0x5E, 0x97, 0x19, 0xE4, 0x9E, 0x73, 0xE9, 0x3E, 0xA7, 0x3A, 0xE2, 0x9E, 0x74, 0x9E,
+    0x2A, 0xE7, 0x5E, 0xA1, 0xE9, 0x75, 0xAE, 0x09, 0xE7, 0x7E, 0x9E, 0xA7, 0x7E, 0xA7, 0x77, 0x77,
+    0x77, 0x29, 0xA7, 0x74, 0xAE, 0x77, 0x3F, 0x77, 0x3A, 0xE7, 0x74, 0x9A, 0x72, 0x3C, 0xA6, 0x9C,
+    0x94, 0xD9, 0x5D, 0x94, 0xAD, 0xA9, 0x99, 0xAE, 0x6F, 0xFC, 0x70, 0xAF, 0xCA, 0x74, 0x97, 0x77,
+    0x79, 0x99, 0x97, 0x09, 0xFF, 0xC9, 0x4F, 0xFF, 0xA3, 0xAD, 0xA9, 0x90, 0x9A, 0xF4, 0xA7, 0xEA,
+    0x74, 0xAE, 0x74, 0x9E, 0x75, 0xE7, 0x49, 0xE4, 0x9A, 0xAF, 0xFC, 0x29, 0xFF, 0xFC, 0x1A, 0xFA,
+    0xA9, 0x99, 0x09, 0xE0, 0xAE, 0xA6, 0x9E, 0x0E, 0xA7, 0x9E, 0x0E, 0x97, 0x9E, 0x9E, 0x70, 0xAE,
+    0x0E, 0x97, 0xF0, 0xF5, 0x9F, 0xC0, 0xAF, 0x99, 0x99, 0xEA, 0xE1, 0xFF, 0xDA, 0x0A, 0xD2, 0xAF,
+    0xE9, 0x1A, 0xD5, 0x99, 0x97, 0x77, 0x70, 0xA9, 0x75, 0xEA, 0x74, 0xF7, 0x4E, 0xA7, 0x5A, 0x96,
+    0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+    0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x77, 0x77, 0x69, 0xA7, 0x4A, 0xE7, 0x3A, 0xE7,
+    0x3A, 0xE7, 0x49, 0xA6, 0x69, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF, 0xFD, 0x94, 0xAF, 0x90, 0x99,
+    0xF9, 0x29, 0xE9, 0x5A, 0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0xAD,
+    0xA7, 0x09, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x0E, 0xA7, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x09, 0x92, 0x9F, 0xCA,
+    0x99, 0xAA, 0xE9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x71, 0x99, 0x99, 0x77, 0x77, 0x9A, 0x76,
+    0x9E, 0x75, 0xAE, 0x75, 0x9E, 0x76, 0x9A, 0x70, 0x49, 0xAC, 0xAA, 0x72, 0xAF, 0xC9, 0x71, 0x90,
+    0x9E, 0x74, 0x9D, 0x74, 0xAD, 0x72, 0x9E, 0xA7, 0x2E, 0x97, 0x3D, 0x75, 0xD7, 0x77, 0x76, 0x9F,
+    0xFF, 0xD9, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F,
+    0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73,
+    0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x59, 0xAC, 0xAA, 0x74, 0xAF, 0xC9, 0x73, 0x90, 0x9E,
+    0x76, 0x9D, 0x76, 0xAD, 0x74, 0x9E, 0xA7, 0x4E, 0x97, 0x5D, 0x77, 0xD7, 0x77, 0x70, 0x99, 0x99,
+    0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7,
+    0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75,
+    0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95,
+    0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x39, 0xA9, 0x59, 0xA3, 0xFC, 0xA3, 0xD2, 0xAF, 0xEA, 0x9E,
+    0x2D, 0x90, 0x9F, 0xE9, 0x19, 0xCA, 0x39, 0xF9, 0x39, 0x77, 0x77, 0x74, 0x9F, 0xFF, 0xD9, 0x9F,
+    0xFF, 0xDA, 0x9F, 0xFF, 0xDA, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xD0, 0x9F,
+    0xFF, 0xD0, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E,
+    0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0x9F, 0xFF, 0xDA, 0x9F, 0xFF,
+    0xDA, 0x9F, 0xFF, 0xDA, 0x39, 0xA9, 0x6A, 0x94, 0xAF, 0xA3, 0xAC, 0x93, 0x9F, 0xEA, 0x9A, 0xD4,
+    0xDA, 0x1A, 0xFD, 0xA4, 0xD4, 0xAE, 0xA5, 0x97, 0x77, 0x77, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A,
+    0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95, 0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A,
+    0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA, 0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75,
+    0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93, 0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19,
+    0x99, 0x95, 0x75, 0x9A, 0xAA, 0x75, 0xE9, 0x74, 0x9D, 0x96, 0xF9, 0x1D, 0x96, 0xFD, 0x09, 0xA9,
+    0x6A, 0xDA, 0x9E, 0x70, 0xAD, 0x92, 0xE6, 0x9D, 0x5A, 0xCA, 0x77, 0x77, 0x79, 0xFF, 0xFD, 0x91,
+    0x9F, 0xFF, 0xDA, 0x19, 0xFF, 0xFD, 0xA1, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E,
+    0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFF,
+    0xD2, 0x9F, 0xFF, 0xD2, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9E, 0x75, 0x9E, 0x75, 0x9E,
+    0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9F, 0xFF, 0xDA,
+    0x19, 0xFF, 0xFD, 0xA1, 0x9F, 0xFF, 0xDA, 0x10, 0x76, 0x99, 0x99, 0x76, 0xE9, 0x75, 0xAD, 0x97,
+    0xF1, 0x9D, 0x97, 0xFC, 0xA0, 0xAA, 0x97, 0xEA, 0xEA, 0x71, 0xAD, 0x91, 0xAD, 0x97, 0xAD, 0x49,
+    0xD9, 0x79, 0x79, 0x77, 0x76, 0x99, 0x99, 0x73, 0x9F, 0xF9, 0x7A, 0xFF, 0xD9, 0x5A, 0xF9, 0x09,
+    0x9F, 0x93, 0x9E, 0x95, 0xAE, 0x3E, 0xA7, 0xEA, 0x19, 0xE7, 0x0A, 0xE1, 0xAE, 0x70, 0x9E, 0x1A,
+    0xDA, 0x70, 0x9E, 0x1F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA1, 0xEA, 0x76, 0xEA, 0x76, 0xAE, 0x76, 0x9E, 0x97, 0x6F, 0x76, 0x9F, 0x70, 0x99, 0x39, 0xFC,
+    0xA9, 0x9A, 0xAE, 0x94, 0x9F, 0xFF, 0x96, 0xAF, 0xFA, 0x97, 0x29, 0x99, 0x96, 0x9A, 0xAA, 0x76,
+    0xE9, 0x76, 0xE7, 0x7D, 0xA1, 0xF9, 0x70, 0xAA, 0x0A, 0xFC, 0x97, 0x1A, 0xDA, 0x9E, 0x70, 0x9D,
+    0xA2, 0xE6, 0x9D, 0x94, 0xAD, 0x77, 0x77, 0x79, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xDA, 0x19, 0xFF,
+    0xFD, 0xA1, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75,
+    0x9E, 0x75, 0x9E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0xD2, 0x9E,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x92, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75,
+    0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9E, 0x75, 0x9F, 0xFF, 0xDA, 0x19, 0xFF, 0xFD, 0xA1, 0x9F,
+    0xFF, 0xDA, 0x99, 0x97, 0x79, 0xE7, 0x79, 0xDA, 0x77, 0x9D, 0x2F, 0x71, 0x9A, 0xA0, 0xFD, 0x73,
+    0xAD, 0xAA, 0xDA, 0x71, 0xAD, 0xA1, 0xAD, 0xA7, 0x9D, 0x93, 0x9D, 0x97, 0x97, 0x97, 0x77, 0x69,
+    0x99, 0x97, 0x39, 0xFF, 0x97, 0xAF, 0xFD, 0x95, 0xAF, 0x90, 0x99, 0xF9, 0x39, 0xE9, 0x5A, 0xE3,
+    0xEA, 0x7E, 0xA1, 0x9E, 0x70, 0xAE, 0x1A, 0xE7, 0x09, 0xE1, 0xAD, 0xA7, 0x09, 0xE1, 0xFF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xC1, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x1E, 0xA7, 0x6E, 0xA7, 0x6A,
+    0xE7, 0x69, 0xE9, 0x76, 0xF7, 0x69, 0xF7, 0x09, 0x93, 0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x49, 0xFF,
+    0xF9, 0x6A, 0xFF, 0xA9, 0x72, 0x99, 0x99, 0x50, 0x73, 0xDA, 0x97, 0x4A, 0xAD, 0xA7, 0x6D, 0x75,
+    0x9D, 0x74, 0xE6, 0xF9, 0x1C, 0xA6, 0xFD, 0x1A, 0x95, 0xAD, 0xA9, 0xE7, 0xAD, 0x92, 0xE5, 0x9D,
+    0x5A, 0xCA, 0x77, 0x77, 0x49, 0xFF, 0xFD, 0x90, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFD, 0xA0, 0x9E,
+    0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x9F, 0xFF, 0xD1, 0x9F, 0xFF, 0xD1, 0x9E, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x91, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9E,
+    0x74, 0x9E, 0x74, 0x9E, 0x74, 0x9F, 0xFF, 0xDA, 0x09, 0xFF, 0xFD, 0xA0, 0x9F, 0xFF, 0xDA, 0x00,
+    0x73, 0x9A, 0xA9, 0x75, 0x9F, 0x77, 0xAC, 0x97, 0x6A, 0xC9, 0x74, 0x9E, 0x69, 0xEA, 0x1A, 0xC9,
+    0x7F, 0xCA, 0x09, 0xC7, 0xE9, 0xE9, 0x70, 0xE9, 0x1A, 0xD7, 0xAD, 0x4A, 0xD6, 0x99, 0x79, 0x77,
+    0x74, 0x99, 0x99, 0x72, 0x9F, 0xF9, 0x6A, 0xFF, 0xD9, 0x4A, 0xF9, 0x09, 0x9F, 0x92, 0x9E, 0x95,
+    0xAE, 0x2E, 0xA7, 0xEA, 0x09, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xDA, 0x70, 0x9E, 0x0F,
+    0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x0F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xEA, 0x75, 0xEA,
+    0x75, 0xAE, 0x75, 0x9E, 0x97, 0x5F, 0x75, 0x9F, 0x70, 0x99, 0x29, 0xFC, 0xA9, 0x9A, 0xAE, 0x93,
+    0x9F, 0xFF, 0x95, 0xAF, 0xFA, 0x97, 0x19, 0x99, 0x95, 0x74, 0x94, 0x9F, 0x92, 0xD4, 0xFE, 0xAD,
+    0xA3, 0x9C, 0xA1, 0xAF, 0xC4, 0xAC, 0x4A, 0xAA, 0x77, 0x71, 0xF9, 0x71, 0xFD, 0x70, 0xAD, 0xA9,
+    0xE6, 0xAD, 0x91, 0x9D, 0xA4, 0x9D, 0x5A, 0xCA, 0x77, 0x77, 0x19, 0xFF, 0xFD, 0x99, 0xFF, 0xFD,
+    0xA9, 0xFF, 0xFD, 0xA9, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD,
+    0x09, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39,
+    0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9,
+    0xFF, 0xFD, 0xA0, 0x77, 0x59, 0xE9, 0x3C, 0xA5, 0x9F, 0xDA, 0x9D, 0x95, 0xDA, 0x0A, 0xFD, 0x6D,
+    0x39, 0xDA, 0x77, 0x75, 0xEA, 0x74, 0xFC, 0xA7, 0x2E, 0xAE, 0x97, 0x0A, 0xD9, 0x1A, 0xD9, 0x6A,
+    0xD4, 0x9D, 0x69, 0x97, 0x97, 0x77, 0x49, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF, 0xFD, 0x94, 0xAF,
+    0x90, 0x99, 0xF9, 0x29, 0xE9, 0x5A, 0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE, 0x0A, 0xE7, 0x09,
+    0xE0, 0xAD, 0xA7, 0x09, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x0E, 0xA7, 0x5E, 0xA7, 0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x09, 0x92,
+    0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x39, 0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x71, 0x99, 0x99, 0x50, 0x59,
+    0xAA, 0xA9, 0x72, 0xFC, 0x71, 0xFE, 0x7A, 0xE0, 0xEA, 0x5A, 0xDA, 0x2E, 0xA3, 0x9D, 0x94, 0xAD,
+    0x93, 0x97, 0x09, 0x77, 0x77, 0x19, 0xFF, 0xFD, 0x99, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE9,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x09, 0xE9, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x09, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7, 0x39, 0xE7,
+    0x39, 0xE7, 0x39, 0xE7, 0x39, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0xA7, 0x77, 0x76,
+    0x9A, 0x74, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x74, 0x9A, 0x60, 0x6A, 0xAA, 0x97, 0x4F, 0xC7, 0x3A,
+    0xFD, 0x71, 0x9E, 0x0A, 0xE7, 0x9E, 0x2A, 0xE5, 0x9D, 0xA4, 0x9D, 0xA5, 0x97, 0x09, 0x97, 0x77,
+    0x39, 0x99, 0x97, 0x29, 0xFF, 0x96, 0xAF, 0xFD, 0x94, 0xAF, 0x90, 0x99, 0xF9, 0x29, 0xE9, 0x5A,
+    0xE2, 0xEA, 0x7E, 0xA0, 0x9E, 0x70, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0xAD, 0xA7, 0x09, 0xE0, 0xFF,
+    0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0E, 0xA7, 0x5E, 0xA7,
+    0x5A, 0xE7, 0x59, 0xE9, 0x75, 0xF7, 0x59, 0xF7, 0x09, 0x92, 0x9F, 0xCA, 0x99, 0xAA, 0xE9, 0x39,
+    0xFF, 0xF9, 0x5A, 0xFF, 0xA9, 0x71, 0x99, 0x99, 0x77, 0x77, 0x9A, 0x76, 0x9E, 0x75, 0xAE, 0x75,
+    0x9E, 0x76, 0x9A, 0x70, 0x2F, 0xA5, 0xFD, 0x7A, 0xD9, 0x7D, 0xA6, 0x9D, 0x94, 0xAF, 0x5E, 0x96,
+    0xD9, 0x79, 0xA9, 0x76, 0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F,
+    0xFC, 0x0A, 0xFF, 0xC0, 0x9D, 0xAA, 0x2F, 0xD9, 0x19, 0x99, 0xE4, 0xAD, 0x4E, 0x2A, 0xE9, 0x19,
+    0xDA, 0x92, 0x9D, 0x5D, 0x77, 0x4E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93,
+    0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9, 0x3E, 0x93, 0xE9,
+    0x3E, 0x93, 0xE9, 0x20, 0x9F, 0xFC, 0x0A, 0xFF, 0xC1, 0x9A, 0xFC, 0xA9, 0x39, 0xE6, 0x9E, 0x69,
+    0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6,
+    0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x69, 0xE5, 0x9A, 0xEA, 0x91, 0x9F,
+    0xFC, 0x0A, 0xFF, 0xC7, 0x77, 0x29, 0xA7, 0x9E, 0x6A, 0xE6, 0x9E, 0x79, 0xA4, 0x1A, 0xA1, 0xEA,
+    0x0F, 0x0E, 0xA1, 0xA9, 0x77, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90,
+    0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9,
+    0x0E, 0x90, 0xE9, 0x73, 0xA9, 0x1E, 0xA0, 0xF0, 0xEA, 0x1A, 0x90, 0x77, 0x77, 0x9A, 0xFE, 0xA9,
+    0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA,
+    0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77,
+    0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7,
+    0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90,
+    0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9,
+    0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71,
+    0x99, 0x99, 0x77, 0x77, 0x76, 0xA9, 0x77, 0x5E, 0x97, 0x73, 0x9E, 0xA7, 0x74, 0xE9, 0x77, 0x5A,
+    0x97, 0x20, 0x69, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9,
+    0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9,
+    0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99,
+    0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF,
+    0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x77, 0x77, 0x29, 0xA7, 0x79, 0xE7, 0x6A, 0xE7,
+    0x69, 0xE7, 0x79, 0xA7, 0x00, 0x71, 0xFA, 0x77, 0x3F, 0xD9, 0x77, 0x49, 0xDA, 0x77, 0x5A, 0xD7,
+    0x75, 0xDA, 0x77, 0x29, 0xF7, 0x73, 0xAD, 0x97, 0x74, 0x9D, 0x77, 0x59, 0xA9, 0x77, 0x77, 0x72,
+    0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A, 0xFA, 0x69, 0xFC, 0x49,
+    0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A, 0xE1, 0xEA, 0x76, 0x9E,
+    0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77,
+    0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9, 0xE7, 0x70, 0xEA, 0x0E,
+    0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9, 0x29, 0xF7, 0x2A,
+    0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F, 0xFF, 0xCA, 0x73, 0x9F,
+    0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x6A, 0xCA, 0xA9, 0x74, 0x9F, 0xD7, 0x49, 0x09, 0xAD, 0x97,
+    0x7D, 0xA7, 0x69, 0xD9, 0x74, 0x9A, 0xE7, 0x5E, 0xA7, 0x6D, 0x97, 0x7A, 0xC9, 0x77, 0x77, 0x19,
+    0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F,
+    0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA,
+    0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E,
+    0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9,
+    0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x77, 0x2A, 0xAA, 0x97, 0x73, 0x9E, 0x77, 0x4E, 0x75, 0xAF,
+    0x1A, 0xD7, 0x59, 0xFC, 0xA0, 0xAA, 0x76, 0xE9, 0xE9, 0x77, 0xE2, 0xAD, 0x97, 0x5D, 0xA4, 0x9D,
+    0x77, 0x77, 0x77, 0x77, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A,
+    0xFA, 0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A,
+    0xE1, 0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7,
+    0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9,
+    0xE7, 0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A,
+    0xE9, 0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F,
+    0xFF, 0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x77, 0x99, 0x97, 0x7A, 0xDA, 0x77,
+    0xE7, 0x0F, 0x91, 0xDA, 0x70, 0xAF, 0xC0, 0x9A, 0xA7, 0x09, 0xE9, 0xE7, 0x29, 0xDA, 0x19, 0xE7,
+    0x1D, 0xA4, 0xDA, 0x70, 0x97, 0x99, 0x77, 0x77, 0x99, 0x99, 0x97, 0x39, 0xFF, 0xA7, 0x0A, 0xFF,
+    0xE9, 0x5A, 0xFA, 0x99, 0x9A, 0xF9, 0x39, 0xEA, 0x6F, 0x3F, 0x70, 0xEA, 0x19, 0xE7, 0x1A, 0xE1,
+    0xAE, 0x72, 0xE9, 0x0E, 0xA7, 0x2E, 0x90, 0xEA, 0x72, 0xEA, 0x0E, 0x97, 0x2E, 0xA0, 0xE9, 0x72,
+    0xEA, 0x0E, 0xA7, 0x2E, 0xA0, 0xAD, 0xA7, 0x2E, 0x90, 0x9E, 0x72, 0xE2, 0xE9, 0x70, 0xAE, 0x2A,
+    0xE7, 0x0E, 0xA3, 0xEA, 0x6F, 0x49, 0xFA, 0x99, 0x9A, 0xF6, 0x9F, 0xFE, 0x97, 0x0A, 0xFE, 0xA7,
+    0x59, 0x99, 0x70, 0x2A, 0xAA, 0x77, 0x5A, 0xDA, 0x77, 0x5A, 0xD9, 0x77, 0x5A, 0xD1, 0x9F, 0x77,
+    0x9A, 0x09, 0xFC, 0xA7, 0x71, 0xE9, 0xAD, 0xA7, 0x7E, 0x2A, 0xD9, 0x75, 0xDA, 0x49, 0xD9, 0x77,
+    0x77, 0x77, 0x76, 0x9A, 0xFE, 0xA9, 0x73, 0x9F, 0xFF, 0xC9, 0x70, 0xAF, 0xFF, 0xEA, 0x6A, 0xFA,
+    0x69, 0xFC, 0x49, 0xF7, 0x2A, 0xEA, 0x3F, 0x74, 0xF2, 0x9E, 0x97, 0x5E, 0xA1, 0xF7, 0x6A, 0xE1,
+    0xEA, 0x76, 0x9E, 0x99, 0xE9, 0x77, 0xEA, 0xAE, 0x77, 0x0F, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70,
+    0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xF9, 0xE7,
+    0x70, 0xEA, 0x0E, 0x97, 0x7E, 0x90, 0xF7, 0x6A, 0xE1, 0xAE, 0x97, 0x5E, 0xA2, 0xF7, 0x4A, 0xE9,
+    0x29, 0xF7, 0x2A, 0xEA, 0x4A, 0xF9, 0x69, 0xFC, 0x6A, 0xFD, 0xAA, 0xAA, 0xFD, 0x70, 0x9F, 0xFF,
+    0xCA, 0x73, 0x9F, 0xFC, 0xA7, 0x71, 0x99, 0x99, 0x71, 0x09, 0x99, 0x77, 0x0E, 0x97, 0x70, 0xE7,
+    0x71, 0xDA, 0x1A, 0xE9, 0x72, 0xAA, 0x09, 0xFC, 0x74, 0x9E, 0x9E, 0x73, 0xE2, 0xE7, 0x1D, 0xA4,
+    0xDA, 0x70, 0x97, 0x99, 0x77, 0x77, 0x99, 0x99, 0x97, 0x39, 0xFF, 0xA7, 0x0A, 0xFF, 0xE9, 0x5A,
+    0xFA, 0x99, 0x9A, 0xF9, 0x39, 0xEA, 0x6F, 0x3F, 0x70, 0xEA, 0x19, 0xE7, 0x1A, 0xE1, 0xAE, 0x72,
+    0xE9, 0x0E, 0xA7, 0x2E, 0x90, 0xEA, 0x72, 0xEA, 0x0E, 0x97, 0x2E, 0xA0, 0xE9, 0x72, 0xEA, 0x0E,
+    0xA7, 0x2E, 0xA0, 0xAD, 0xA7, 0x2E, 0x90, 0x9E, 0x72, 0xE2, 0xE9, 0x70, 0xAE, 0x2A, 0xE7, 0x0E,
+    0xA3, 0xEA, 0x6F, 0x49, 0xFA, 0x99, 0x9A, 0xF6, 0x9F, 0xFE, 0x97, 0x0A, 0xFE, 0xA7, 0x59, 0x99,
+    0x70, 0x77, 0x9D, 0xA7, 0x74, 0x9A, 0xE7, 0x76, 0xAC, 0x97, 0x75, 0xD9, 0x77, 0x3A, 0xDA, 0x75,
+    0xAF, 0x1A, 0xC7, 0x69, 0xFC, 0xA0, 0x9A, 0x75, 0x9E, 0x9E, 0x97, 0x7E, 0x2A, 0xD9, 0x75, 0xDA,
+    0x49, 0xD7, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xEA, 0x97, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE,
+    0xA6, 0xAF, 0xA6, 0x9F, 0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F,
+    0x76, 0xAE, 0x1E, 0xA7, 0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE,
+    0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77,
+    0x0F, 0x9E, 0x77, 0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F,
+    0x74, 0xAE, 0x92, 0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7,
+    0x09, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97, 0x10, 0x74, 0xAA, 0xA9, 0x76,
+    0xFA, 0x77, 0x0D, 0x77, 0x0D, 0x76, 0xAD, 0x97, 0xF9, 0x1D, 0x70, 0xAF, 0xC1, 0xAA, 0x79, 0xE9,
+    0xE7, 0x19, 0xDA, 0x19, 0xE7, 0x0D, 0xA4, 0xDA, 0x79, 0x79, 0x97, 0x77, 0x59, 0x99, 0x99, 0x72,
+    0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA,
+    0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA,
+    0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1,
+    0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7,
+    0x49, 0x99, 0x70, 0x77, 0x09, 0x76, 0xAE, 0xA2, 0x9C, 0x97, 0x4A, 0xFD, 0xAA, 0xD7, 0x5D, 0x19,
+    0xFC, 0xA7, 0x5C, 0x93, 0x9A, 0xA9, 0x77, 0x77, 0x72, 0x9E, 0xA7, 0x72, 0x9F, 0xCA, 0x77, 0x1E,
+    0x9E, 0x97, 0x7E, 0x2A, 0xD9, 0x75, 0xDA, 0x49, 0xD7, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xEA, 0x97,
+    0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6, 0x9F, 0xC4, 0x9F, 0x72, 0xAE, 0xA3,
+    0xF7, 0x4F, 0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E, 0xA7, 0x69, 0xE9, 0x9E, 0x97, 0x7E,
+    0xAA, 0xE7, 0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77,
+    0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77, 0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F,
+    0x76, 0xAE, 0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96,
+    0x9F, 0xC6, 0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19,
+    0x99, 0x97, 0x10, 0x77, 0x7A, 0xDA, 0x3A, 0xC7, 0xAF, 0xCA, 0x9A, 0xD7, 0xD9, 0x9A, 0xFC, 0x96,
+    0x9C, 0x93, 0xAD, 0x97, 0x77, 0x6A, 0xE9, 0x74, 0x9F, 0xC7, 0x39, 0xEA, 0xE7, 0x2E, 0x19, 0xE7,
+    0x0D, 0xA4, 0xDA, 0x79, 0x79, 0x97, 0x77, 0x59, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9,
+    0x4A, 0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE,
+    0x72, 0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72,
+    0xEA, 0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6,
+    0xF3, 0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x70, 0x72, 0xAA,
+    0xA9, 0x77, 0x3F, 0xC7, 0x72, 0xAF, 0xD7, 0x70, 0x9E, 0x0A, 0xE7, 0x69, 0xE2, 0xAD, 0xA7, 0x49,
+    0xDA, 0x49, 0xDA, 0x74, 0x97, 0x09, 0x97, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xEA, 0x97, 0x39, 0xFF,
+    0xFC, 0x97, 0x0A, 0xFF, 0xFE, 0xA6, 0xAF, 0xA6, 0x9F, 0xC4, 0x9F, 0x72, 0xAE, 0xA3, 0xF7, 0x4F,
+    0x29, 0xE9, 0x75, 0xEA, 0x1F, 0x76, 0xAE, 0x1E, 0xA7, 0x69, 0xE9, 0x9E, 0x97, 0x7E, 0xAA, 0xE7,
+    0x70, 0xFA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA, 0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0A, 0xEA,
+    0xE7, 0x70, 0xAE, 0xAE, 0x77, 0x0F, 0x9E, 0x77, 0x0E, 0xA0, 0xE9, 0x77, 0xE9, 0x0F, 0x76, 0xAE,
+    0x1A, 0xE9, 0x75, 0xEA, 0x2F, 0x74, 0xAE, 0x92, 0x9F, 0x72, 0xAE, 0xA4, 0xAF, 0x96, 0x9F, 0xC6,
+    0xAF, 0xDA, 0xAA, 0xAF, 0xD7, 0x09, 0xFF, 0xFC, 0xA7, 0x39, 0xFF, 0xCA, 0x77, 0x19, 0x99, 0x97,
+    0x77, 0x77, 0x6A, 0x97, 0x75, 0xE9, 0x77, 0x39, 0xEA, 0x77, 0x4E, 0x97, 0x75, 0xA9, 0x72, 0x69,
+    0xAA, 0xA7, 0x6F, 0xC7, 0x4F, 0xDA, 0x72, 0xEA, 0x0E, 0xA7, 0x0A, 0xDA, 0x2E, 0x96, 0xAD, 0x94,
+    0xAD, 0x95, 0x99, 0x70, 0x97, 0x77, 0x59, 0x99, 0x99, 0x72, 0x9F, 0xFA, 0x7A, 0xFF, 0xE9, 0x4A,
+    0xFA, 0x99, 0x9A, 0xF9, 0x29, 0xEA, 0x6F, 0x2F, 0x70, 0xEA, 0x09, 0xE7, 0x1A, 0xE0, 0xAE, 0x72,
+    0xE9, 0xEA, 0x72, 0xE9, 0xEA, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xE9, 0x72, 0xEA, 0xEA, 0x72, 0xEA,
+    0xAD, 0xA7, 0x2E, 0x99, 0xE7, 0x2E, 0x1E, 0x97, 0x0A, 0xE1, 0xAE, 0x70, 0xEA, 0x2E, 0xA6, 0xF3,
+    0x9F, 0xA9, 0x99, 0xAF, 0x59, 0xFF, 0xE9, 0x7A, 0xFE, 0xA7, 0x49, 0x99, 0x77, 0x77, 0x29, 0xA7,
+    0x79, 0xE7, 0x6A, 0xE7, 0x69, 0xE7, 0x79, 0xA7, 0x00, 0x75, 0xAA, 0xAA, 0x77, 0x7A, 0xE9, 0x77,
+    0x69, 0xE9, 0x77, 0x7E, 0xA7, 0x77, 0xAD, 0xA7, 0x77, 0x9D, 0x97, 0x77, 0x19, 0x77, 0x77, 0x70,
+    0x9A, 0xA9, 0x77, 0x70, 0xAE, 0x79, 0xAF, 0xEA, 0x95, 0xF5, 0x9F, 0xFF, 0xC9, 0x3E, 0x94, 0xAF,
+    0xFF, 0xEA, 0x19, 0xE4, 0xAF, 0xA6, 0x9F, 0xAA, 0xE9, 0x39, 0xF7, 0x2A, 0xFD, 0x94, 0xF7, 0x4F,
+    0xA5, 0x9E, 0x97, 0x5E, 0xA5, 0xF7, 0x6A, 0xE5, 0xEA, 0x76, 0x9E, 0x93, 0x9E, 0x97, 0x7E, 0xA3,
+    0xAE, 0x77, 0x0F, 0x3A, 0xE7, 0x70, 0xAE, 0x3A, 0xE7, 0x70, 0xAE, 0x3A, 0xE7, 0x70, 0xAE, 0x3A,
+    0xE7, 0x70, 0xAE, 0x3A, 0xE7, 0x70, 0xAE, 0x3A, 0xE7, 0x70, 0xF3, 0x9E, 0x77, 0x0E, 0xA4, 0xE9,
+    0x77, 0xE9, 0x4F, 0x76, 0xAE, 0x5A, 0xE9, 0x75, 0xEA, 0x6F, 0x74, 0xAE, 0x79, 0xF7, 0x2A, 0xEA,
+    0x70, 0xAF, 0x97, 0xFC, 0x72, 0xAF, 0xCA, 0xAA, 0xAA, 0xFD, 0x74, 0x9F, 0xFF, 0xCA, 0x77, 0x9F,
+    0xFC, 0xA7, 0x75, 0x99, 0x99, 0x75, 0x71, 0x9A, 0xAA, 0x97, 0x71, 0xF7, 0x71, 0xAE, 0x77, 0x19,
+    0xE9, 0x77, 0x1E, 0x97, 0x71, 0xAD, 0x97, 0x72, 0x99, 0x70, 0xAE, 0x77, 0x2A, 0xE7, 0x99, 0x99,
+    0x95, 0xEA, 0x49, 0xFF, 0xA3, 0xE4, 0xAF, 0xFE, 0x90, 0xEA, 0x3A, 0xFA, 0x99, 0x9A, 0xFF, 0x39,
+    0xEA, 0x6F, 0xCA, 0x4E, 0xA7, 0x0E, 0xA4, 0x9E, 0x71, 0x9E, 0x4A, 0xE7, 0x2E, 0x93, 0xEA, 0x72,
+    0xE9, 0x3E, 0xA7, 0x2E, 0xA3, 0xE9, 0x72, 0xEA, 0x3E, 0x97, 0x2E, 0xA3, 0xEA, 0x72, 0xEA, 0x3A,
+    0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x2E, 0x94, 0xE7, 0x1A, 0xE5, 0xF7, 0x0E, 0xA6, 0xEA, 0x6F, 0x79,
+    0xFA, 0x99, 0x9A, 0xF9, 0x70, 0x9F, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99, 0x97, 0x30, 0x7A,
+    0xAA, 0xA7, 0x77, 0x0A, 0xE9, 0x77, 0x70, 0xF7, 0x77, 0x1E, 0xA7, 0x77, 0x1E, 0x97, 0x77, 0x1E,
+    0x77, 0x72, 0x99, 0x77, 0x77, 0x59, 0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x9A, 0xFE, 0xA9, 0x5F, 0x59,
+    0xFF, 0xFC, 0x93, 0xE9, 0x4A, 0xFF, 0xFE, 0xA1, 0x9E, 0x4A, 0xFA, 0x69, 0xFA, 0xAE, 0x93, 0x9F,
+    0x72, 0xAF, 0xD9, 0x4F, 0x74, 0xFA, 0x59, 0xE9, 0x75, 0xEA, 0x5F, 0x76, 0xAE, 0x5E, 0xA7, 0x69,
+    0xE9, 0x39, 0xE9, 0x77, 0xEA, 0x3A, 0xE7, 0x70, 0xF3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A,
+    0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0F,
+    0x39, 0xE7, 0x70, 0xEA, 0x4E, 0x97, 0x7E, 0x94, 0xF7, 0x6A, 0xE5, 0xAE, 0x97, 0x5E, 0xA6, 0xF7,
+    0x4A, 0xE7, 0x9F, 0x72, 0xAE, 0xA7, 0x0A, 0xF9, 0x7F, 0xC7, 0x2A, 0xFC, 0xAA, 0xAA, 0xAF, 0xD7,
+    0x49, 0xFF, 0xFC, 0xA7, 0x79, 0xFF, 0xCA, 0x77, 0x59, 0x99, 0x97, 0x50, 0x39, 0xAA, 0xA9, 0x77,
+    0x2F, 0x77, 0x3E, 0xA7, 0x73, 0xE9, 0x77, 0x3E, 0x77, 0x4D, 0xA7, 0x74, 0x99, 0x5A, 0xE7, 0x72,
+    0xAE, 0x79, 0x99, 0x99, 0x5E, 0xA4, 0x9F, 0xFA, 0x3E, 0x4A, 0xFF, 0xE9, 0x0E, 0xA3, 0xAF, 0xA9,
+    0x99, 0xAF, 0xF3, 0x9E, 0xA6, 0xFC, 0xA4, 0xEA, 0x70, 0xEA, 0x49, 0xE7, 0x19, 0xE4, 0xAE, 0x72,
+    0xE9, 0x3E, 0xA7, 0x2E, 0x93, 0xEA, 0x72, 0xEA, 0x3E, 0x97, 0x2E, 0xA3, 0xE9, 0x72, 0xEA, 0x3E,
+    0xA7, 0x2E, 0xA3, 0xAD, 0xA7, 0x2E, 0x93, 0xAE, 0x72, 0xE9, 0x4E, 0x71, 0xAE, 0x5F, 0x70, 0xEA,
+    0x6E, 0xA6, 0xF7, 0x9F, 0xA9, 0x99, 0xAF, 0x97, 0x09, 0xFF, 0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09,
+    0x99, 0x73, 0x71, 0xAC, 0xAA, 0x97, 0x76, 0x9F, 0xCA, 0x77, 0x69, 0x09, 0xE9, 0x77, 0x71, 0xD9,
+    0x77, 0x70, 0x9D, 0x97, 0x76, 0x9A, 0xE7, 0x77, 0xEA, 0x77, 0x70, 0xD9, 0x77, 0x71, 0xAC, 0x77,
+    0x77, 0x79, 0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x9A, 0xFE, 0xA9, 0x5F, 0x59, 0xFF, 0xFC, 0x93, 0xE9,
+    0x4A, 0xFF, 0xFE, 0xA1, 0x9E, 0x4A, 0xFA, 0x69, 0xFA, 0xAE, 0x93, 0x9F, 0x72, 0xAF, 0xD9, 0x4F,
+    0x74, 0xFA, 0x59, 0xE9, 0x75, 0xEA, 0x5F, 0x76, 0xAE, 0x5E, 0xA7, 0x69, 0xE9, 0x39, 0xE9, 0x77,
+    0xEA, 0x3A, 0xE7, 0x70, 0xF3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A,
+    0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0F, 0x39, 0xE7, 0x70, 0xEA,
+    0x4E, 0x97, 0x7E, 0x94, 0xF7, 0x6A, 0xE5, 0xAE, 0x97, 0x5E, 0xA6, 0xF7, 0x4A, 0xE7, 0x9F, 0x72,
+    0xAE, 0xA7, 0x0A, 0xF9, 0x7F, 0xC7, 0x2A, 0xFC, 0xAA, 0xAA, 0xAF, 0xD7, 0x49, 0xFF, 0xFC, 0xA7,
+    0x79, 0xFF, 0xCA, 0x77, 0x59, 0x99, 0x97, 0x50, 0x59, 0xAC, 0xAA, 0x77, 0x1A, 0xFC, 0x97, 0x70,
+    0x99, 0x9E, 0x77, 0x39, 0xD7, 0x73, 0xAD, 0x77, 0x1A, 0xEA, 0x77, 0x09, 0xE9, 0x77, 0x2D, 0x77,
+    0x4D, 0x7A, 0xE7, 0x72, 0xAE, 0x79, 0x99, 0x99, 0x5E, 0xA4, 0x9F, 0xFA, 0x3E, 0x4A, 0xFF, 0xE9,
+    0x0E, 0xA3, 0xAF, 0xA9, 0x99, 0xAF, 0xF3, 0x9E, 0xA6, 0xFC, 0xA4, 0xEA, 0x70, 0xEA, 0x49, 0xE7,
+    0x19, 0xE4, 0xAE, 0x72, 0xE9, 0x3E, 0xA7, 0x2E, 0x93, 0xEA, 0x72, 0xEA, 0x3E, 0x97, 0x2E, 0xA3,
+    0xE9, 0x72, 0xEA, 0x3E, 0xA7, 0x2E, 0xA3, 0xAD, 0xA7, 0x2E, 0x93, 0xAE, 0x72, 0xE9, 0x4E, 0x71,
+    0xAE, 0x5F, 0x70, 0xEA, 0x6E, 0xA6, 0xF7, 0x9F, 0xA9, 0x99, 0xAF, 0x97, 0x09, 0xFF, 0xE9, 0x73,
+    0xAF, 0xEA, 0x77, 0x09, 0x99, 0x73, 0x79, 0xA9, 0x6A, 0x97, 0x7A, 0xFA, 0x3A, 0xC9, 0x76, 0x9F,
+    0xEA, 0x9A, 0xD7, 0x7D, 0xA1, 0xAF, 0xDA, 0x77, 0xD4, 0xAE, 0xA7, 0x70, 0x97, 0x77, 0x77, 0x59,
+    0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x9A, 0xFE, 0xA9, 0x5F, 0x59, 0xFF, 0xFC, 0x93, 0xE9, 0x4A, 0xFF,
+    0xFE, 0xA1, 0x9E, 0x4A, 0xFA, 0x69, 0xFA, 0xAE, 0x93, 0x9F, 0x72, 0xAF, 0xD9, 0x4F, 0x74, 0xFA,
+    0x59, 0xE9, 0x75, 0xEA, 0x5F, 0x76, 0xAE, 0x5E, 0xA7, 0x69, 0xE9, 0x39, 0xE9, 0x77, 0xEA, 0x3A,
+    0xE7, 0x70, 0xF3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE,
+    0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0F, 0x39, 0xE7, 0x70, 0xEA, 0x4E, 0x97,
+    0x7E, 0x94, 0xF7, 0x6A, 0xE5, 0xAE, 0x97, 0x5E, 0xA6, 0xF7, 0x4A, 0xE7, 0x9F, 0x72, 0xAE, 0xA7,
+    0x0A, 0xF9, 0x7F, 0xC7, 0x2A, 0xFC, 0xAA, 0xAA, 0xAF, 0xD7, 0x49, 0xFF, 0xFC, 0xA7, 0x79, 0xFF,
+    0xCA, 0x77, 0x59, 0x99, 0x97, 0x50, 0x49, 0xA9, 0x59, 0xA7, 0x2F, 0xCA, 0x3D, 0x71, 0xAF, 0xEA,
+    0x9D, 0xA7, 0x1D, 0x90, 0x9F, 0xE7, 0x19, 0xCA, 0x39, 0xF9, 0x72, 0x97, 0x5A, 0xE7, 0x72, 0xAE,
+    0x79, 0x99, 0x99, 0x5E, 0xA4, 0x9F, 0xFA, 0x3E, 0x4A, 0xFF, 0xE9, 0x0E, 0xA3, 0xAF, 0xA9, 0x99,
+    0xAF, 0xF3, 0x9E, 0xA6, 0xFC, 0xA4, 0xEA, 0x70, 0xEA, 0x49, 0xE7, 0x19, 0xE4, 0xAE, 0x72, 0xE9,
+    0x3E, 0xA7, 0x2E, 0x93, 0xEA, 0x72, 0xEA, 0x3E, 0x97, 0x2E, 0xA3, 0xE9, 0x72, 0xEA, 0x3E, 0xA7,
+    0x2E, 0xA3, 0xAD, 0xA7, 0x2E, 0x93, 0xAE, 0x72, 0xE9, 0x4E, 0x71, 0xAE, 0x5F, 0x70, 0xEA, 0x6E,
+    0xA6, 0xF7, 0x9F, 0xA9, 0x99, 0xAF, 0x97, 0x09, 0xFF, 0xE9, 0x73, 0xAF, 0xEA, 0x77, 0x09, 0x99,
+    0x73, 0x77, 0x79, 0xAA, 0x97, 0x77, 0x0A, 0xE7, 0x9A, 0xFE, 0xA9, 0x5F, 0x59, 0xFF, 0xFC, 0x93,
+    0xE9, 0x4A, 0xFF, 0xFE, 0xA1, 0x9E, 0x4A, 0xFA, 0x69, 0xFA, 0xAE, 0x93, 0x9F, 0x72, 0xAF, 0xD9,
+    0x4F, 0x74, 0xFA, 0x59, 0xE9, 0x75, 0xEA, 0x5F, 0x76, 0xAE, 0x5E, 0xA7, 0x69, 0xE9, 0x39, 0xE9,
+    0x77, 0xEA, 0x3A, 0xE7, 0x70, 0xF3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77,
+    0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0A, 0xE3, 0xAE, 0x77, 0x0F, 0x39, 0xE7, 0x70,
+    0xEA, 0x4E, 0x97, 0x7E, 0x94, 0xF7, 0x6A, 0xE5, 0xAE, 0x97, 0x5E, 0xA6, 0xF7, 0x4A, 0xE7, 0x9F,
+    0x72, 0xAE, 0xA7, 0x0A, 0xF9, 0x7F, 0xC7, 0x2A, 0xFC, 0xAA, 0xAA, 0xAF, 0xD7, 0x49, 0xFF, 0xFC,
+    0xA7, 0x79, 0xFF, 0xCA, 0x77, 0x59, 0x99, 0x97, 0x77, 0x77, 0x75, 0x9A, 0x97, 0x77, 0x1E, 0x97,
+    0x77, 0x9E, 0x97, 0x77, 0x0E, 0x97, 0x77, 0x09, 0xA9, 0x76, 0x77, 0x77, 0x70, 0xAE, 0x77, 0x2A,
+    0xE7, 0x99, 0x99, 0x95, 0xEA, 0x49, 0xFF, 0xA3, 0xE4, 0xAF, 0xFE, 0x90, 0xEA, 0x3A, 0xFA, 0x99,
+    0x9A, 0xFF, 0x39, 0xEA, 0x6F, 0xCA, 0x4E, 0xA7, 0x0E, 0xA4, 0x9E, 0x71, 0x9E, 0x4A, 0xE7, 0x2E,
+    0x93, 0xEA, 0x72, 0xE9, 0x3E, 0xA7, 0x2E, 0xA3, 0xE9, 0x72, 0xEA, 0x3E, 0x97, 0x2E, 0xA3, 0xEA,
+    0x72, 0xEA, 0x3A, 0xDA, 0x72, 0xE9, 0x3A, 0xE7, 0x2E, 0x94, 0xE7, 0x1A, 0xE5, 0xF7, 0x0E, 0xA6,
+    0xEA, 0x6F, 0x79, 0xFA, 0x99, 0x9A, 0xF9, 0x70, 0x9F, 0xFE, 0x97, 0x3A, 0xFE, 0xA7, 0x70, 0x99,
+    0x97, 0x77, 0x77, 0x29, 0xA7, 0x73, 0x9E, 0x77, 0x2A, 0xE7, 0x72, 0x9E, 0x77, 0x39, 0xA7, 0x40,
+    0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9, 0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0,
+    0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F, 0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95,
+    0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x77, 0x75, 0x9A, 0x97, 0x71, 0xE9, 0x77,
+    0x9E, 0xA7, 0x70, 0xE9, 0x77, 0x1A, 0x97, 0x00, 0x77, 0x2E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E,
+    0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97,
+    0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0,
+    0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0xAE, 0x0E, 0x97, 0x0F, 0x0F, 0x79, 0xF0,
+    0xAE, 0x95, 0x9F, 0xC1, 0xFC, 0x99, 0x9A, 0xEA, 0xE1, 0x9F, 0xFD, 0xA0, 0xE3, 0xAF, 0xE9, 0x1E,
+    0x69, 0x99, 0x77, 0x77, 0x1A, 0xA7, 0x6E, 0xA7, 0x5F, 0x75, 0xAD, 0xA7, 0x6A, 0xA7, 0x7F, 0xA7,
+    0x7F, 0xD7, 0x71, 0x9D, 0xA7, 0x71, 0xE7, 0x70, 0x9D, 0xA7, 0x69, 0xF7, 0x7A, 0xD9, 0x77, 0x0A,
+    0xCA, 0x77, 0x19, 0xA9, 0x77, 0x75, 0x9D, 0xA7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA,
+    0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7,
+    0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49,
+    0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xEA, 0xE7, 0x49, 0xE9,
+    0xE7, 0x4A, 0xE9, 0xE7, 0x4E, 0xA0, 0xEA, 0x72, 0x9E, 0x90, 0xAE, 0x97, 0x1F, 0x2F, 0xA6, 0x9F,
+    0x93, 0xFD, 0xAA, 0xAA, 0xFC, 0x95, 0xFF, 0xFC, 0x97, 0x9F, 0xFC, 0xA7, 0x59, 0x99, 0x97, 0x6A,
+    0xDA, 0x97, 0x39, 0xFC, 0xA7, 0x39, 0x09, 0xAD, 0x97, 0x6D, 0x97, 0x59, 0xD9, 0x73, 0x9A, 0xE7,
+    0x4E, 0xA7, 0x5D, 0x97, 0x6A, 0xC9, 0x77, 0x77, 0x73, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0,
+    0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70,
+    0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E,
+    0x97, 0x09, 0xE0, 0xE9, 0x70, 0x9E, 0x0E, 0x97, 0x0A, 0xE0, 0xE9, 0x70, 0xF0, 0xF7, 0x9F, 0x0A,
+    0xE9, 0x59, 0xFC, 0x1F, 0xC9, 0x99, 0xAE, 0xAE, 0x19, 0xFF, 0xDA, 0x0E, 0x3A, 0xFE, 0x91, 0xE6,
+    0x99, 0x97, 0x73, 0xAA, 0xAA, 0x77, 0x6A, 0xE9, 0x77, 0x59, 0xEA, 0x77, 0x6E, 0xA7, 0x76, 0xAD,
+    0xA7, 0x76, 0x9D, 0xA7, 0x77, 0x09, 0x77, 0x77, 0x71, 0xAA, 0xA9, 0x77, 0x7E, 0xA9, 0xDA, 0x74,
+    0x9E, 0x2E, 0x9A, 0xE7, 0x49, 0xE1, 0x9E, 0x0A, 0xE7, 0x49, 0xE1, 0xEA, 0x0A, 0xE7, 0x49, 0xE9,
+    0xAE, 0x1A, 0xE7, 0x49, 0xFE, 0x2A, 0xE7, 0x49, 0xFC, 0x93, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49,
+    0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE,
+    0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E,
+    0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x69, 0xE7, 0x4A, 0xE6, 0x9E, 0x74, 0xEA, 0x7E, 0xA7,
+    0x3E, 0x97, 0xAE, 0x97, 0x1F, 0x71, 0xFA, 0x69, 0xF9, 0x72, 0xFD, 0xAA, 0xAA, 0xFC, 0xA7, 0x4F,
+    0xFF, 0xCA, 0x76, 0x9A, 0xFF, 0xA7, 0x74, 0x99, 0x99, 0x76, 0x72, 0xAA, 0xAA, 0x77, 0x3F, 0x97,
+    0x72, 0x9E, 0x97, 0x73, 0xE9, 0x77, 0x3A, 0xD9, 0x77, 0x39, 0xD9, 0x77, 0x59, 0x73, 0xE9, 0x77,
+    0x39, 0xE9, 0x77, 0x39, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0xA1, 0xE9, 0x70, 0x9E, 0x0A, 0xE2, 0xE9,
+    0x70, 0x9F, 0xE9, 0x2E, 0x97, 0x09, 0xFD, 0x4E, 0x97, 0x09, 0xE9, 0x6E, 0x97, 0x09, 0xE7, 0xE9,
+    0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E,
+    0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x0A, 0xE7, 0xE9, 0x70, 0xF7, 0xF7, 0x9F,
+    0x7A, 0xE9, 0x59, 0xFC, 0x70, 0xFC, 0x99, 0x9A, 0xEA, 0xE7, 0x09, 0xFF, 0xDA, 0x0E, 0x72, 0xAF,
+    0xE9, 0x1E, 0x75, 0x99, 0x97, 0x60, 0x5A, 0xAA, 0xA7, 0x77, 0xAE, 0x97, 0x77, 0xAE, 0x77, 0x70,
+    0xEA, 0x77, 0x70, 0xE9, 0x77, 0x70, 0xAD, 0x77, 0x71, 0x99, 0x77, 0x77, 0x6A, 0xAA, 0x97, 0x77,
+    0xEA, 0x9D, 0xA7, 0x49, 0xE2, 0xE9, 0xAE, 0x74, 0x9E, 0x19, 0xE0, 0xAE, 0x74, 0x9E, 0x1E, 0xA0,
+    0xAE, 0x74, 0x9E, 0x9A, 0xE1, 0xAE, 0x74, 0x9F, 0xE2, 0xAE, 0x74, 0x9F, 0xC9, 0x3A, 0xE7, 0x49,
+    0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE,
+    0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E,
+    0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0xAE, 0x69, 0xE7,
+    0x4E, 0xA7, 0xEA, 0x73, 0xE9, 0x7A, 0xE9, 0x71, 0xF7, 0x1F, 0xA6, 0x9F, 0x97, 0x2F, 0xDA, 0xAA,
+    0xAF, 0xCA, 0x74, 0xFF, 0xFC, 0xA7, 0x69, 0xAF, 0xFA, 0x77, 0x49, 0x99, 0x97, 0x60, 0x4A, 0xAA,
+    0xA7, 0x74, 0xAE, 0x97, 0x74, 0xF7, 0x75, 0xEA, 0x77, 0x5E, 0x77, 0x6E, 0x77, 0x69, 0x97, 0x0E,
+    0x97, 0x73, 0x9E, 0x97, 0x73, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xEA, 0x1E, 0x97, 0x09, 0xE0, 0xAE,
+    0x2E, 0x97, 0x09, 0xFE, 0x92, 0xE9, 0x70, 0x9F, 0xD4, 0xE9, 0x70, 0x9E, 0x96, 0xE9, 0x70, 0x9E,
+    0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97,
+    0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0xAE, 0x7E, 0x97, 0x0F, 0x7F,
+    0x79, 0xF7, 0xAE, 0x95, 0x9F, 0xC7, 0x0F, 0xC9, 0x99, 0xAE, 0xAE, 0x70, 0x9F, 0xFD, 0xA0, 0xE7,
+    0x2A, 0xFE, 0x91, 0xE7, 0x59, 0x99, 0x76, 0x7A, 0xEA, 0x97, 0x75, 0xFD, 0x97, 0x77, 0x9E, 0x77,
+    0x70, 0xAD, 0x77, 0x70, 0xE7, 0x75, 0x9A, 0xE9, 0x77, 0x59, 0xDA, 0x77, 0x79, 0xD7, 0x77, 0x1A,
+    0xA7, 0x3A, 0xAA, 0x97, 0x77, 0xEA, 0x9D, 0xA7, 0x49, 0xE2, 0xE9, 0xAE, 0x74, 0x9E, 0x19, 0xE0,
+    0xAE, 0x74, 0x9E, 0x1E, 0xA0, 0xAE, 0x74, 0x9E, 0x9A, 0xE1, 0xAE, 0x74, 0x9F, 0xE2, 0xAE, 0x74,
+    0x9F, 0xC9, 0x3A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E,
+    0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7,
+    0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6,
+    0x9E, 0x74, 0xAE, 0x69, 0xE7, 0x4E, 0xA7, 0xEA, 0x73, 0xE9, 0x7A, 0xE9, 0x71, 0xF7, 0x1F, 0xA6,
+    0x9F, 0x97, 0x2F, 0xDA, 0xAA, 0xAF, 0xCA, 0x74, 0xFF, 0xFC, 0xA7, 0x69, 0xAF, 0xFA, 0x77, 0x49,
+    0x99, 0x97, 0x60, 0x6A, 0xDA, 0x97, 0x73, 0xFD, 0x77, 0x29, 0x09, 0xAD, 0x97, 0x75, 0xDA, 0x77,
+    0x5D, 0x97, 0x72, 0x9A, 0xE7, 0x73, 0xEA, 0x77, 0x4D, 0xA7, 0x75, 0xAC, 0x97, 0x1E, 0x97, 0x73,
+    0x9E, 0x97, 0x73, 0x9E, 0x1E, 0x97, 0x09, 0xE1, 0xEA, 0x1E, 0x97, 0x09, 0xE0, 0xAE, 0x2E, 0x97,
+    0x09, 0xFE, 0x92, 0xE9, 0x70, 0x9F, 0xD4, 0xE9, 0x70, 0x9E, 0x96, 0xE9, 0x70, 0x9E, 0x7E, 0x97,
+    0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7,
+    0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0xAE, 0x7E, 0x97, 0x0F, 0x7F, 0x79, 0xF7,
+    0xAE, 0x95, 0x9F, 0xC7, 0x0F, 0xC9, 0x99, 0xAE, 0xAE, 0x70, 0x9F, 0xFD, 0xA0, 0xE7, 0x2A, 0xFE,
+    0x91, 0xE7, 0x59, 0x99, 0x76, 0x69, 0x96, 0xA9, 0x76, 0xAF, 0xA3, 0xAC, 0x97, 0x59, 0xFE, 0xA9,
+    0xAD, 0x76, 0xDA, 0x1A, 0xFD, 0xA7, 0x6D, 0x4A, 0xEA, 0x77, 0x97, 0x77, 0x77, 0x6A, 0xAA, 0x97,
+    0x77, 0xEA, 0x9D, 0xA7, 0x49, 0xE2, 0xE9, 0xAE, 0x74, 0x9E, 0x19, 0xE0, 0xAE, 0x74, 0x9E, 0x1E,
+    0xA0, 0xAE, 0x74, 0x9E, 0x9A, 0xE1, 0xAE, 0x74, 0x9F, 0xE2, 0xAE, 0x74, 0x9F, 0xC9, 0x3A, 0xE7,
+    0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6,
+    0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74,
+    0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0x9E, 0x74, 0xAE, 0x69,
+    0xE7, 0x4E, 0xA7, 0xEA, 0x73, 0xE9, 0x7A, 0xE9, 0x71, 0xF7, 0x1F, 0xA6, 0x9F, 0x97, 0x2F, 0xDA,
+    0xAA, 0xAF, 0xCA, 0x74, 0xFF, 0xFC, 0xA7, 0x69, 0xAF, 0xFA, 0x77, 0x49, 0x99, 0x97, 0x60, 0x49,
+    0xA9, 0x59, 0xA7, 0x4A, 0xFA, 0x3D, 0x97, 0x2A, 0xFE, 0xA9, 0xAD, 0x73, 0xDA, 0x09, 0xAF, 0xD9,
+    0x73, 0xD3, 0x9F, 0xA7, 0x49, 0x77, 0x0E, 0x97, 0x73, 0x9E, 0x97, 0x73, 0x9E, 0x1E, 0x97, 0x09,
+    0xE1, 0xEA, 0x1E, 0x97, 0x09, 0xE0, 0xAE, 0x2E, 0x97, 0x09, 0xFE, 0x92, 0xE9, 0x70, 0x9F, 0xD4,
+    0xE9, 0x70, 0x9E, 0x96, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97,
+    0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7,
+    0xE9, 0x70, 0xAE, 0x7E, 0x97, 0x0F, 0x7F, 0x79, 0xF7, 0xAE, 0x95, 0x9F, 0xC7, 0x0F, 0xC9, 0x99,
+    0xAE, 0xAE, 0x70, 0x9F, 0xFD, 0xA0, 0xE7, 0x2A, 0xFE, 0x91, 0xE7, 0x59, 0x99, 0x76, 0x77, 0x7A,
+    0xAA, 0x97, 0x77, 0xEA, 0x9D, 0xA7, 0x49, 0xE2, 0xE9, 0xAE, 0x74, 0x9E, 0x19, 0xE0, 0xAE, 0x74,
+    0x9E, 0x1E, 0xA0, 0xAE, 0x74, 0x9E, 0x9A, 0xE1, 0xAE, 0x74, 0x9F, 0xE2, 0xAE, 0x74, 0x9F, 0xC9,
+    0x3A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7,
+    0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6,
+    0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0xAE, 0x74, 0x9E, 0x6A, 0xE7, 0x49, 0xE6, 0x9E, 0x74,
+    0xAE, 0x69, 0xE7, 0x4E, 0xA7, 0xEA, 0x73, 0xE9, 0x7A, 0xE9, 0x71, 0xF7, 0x1F, 0xA6, 0x9F, 0x97,
+    0x2F, 0xDA, 0xAA, 0xAF, 0xCA, 0x74, 0xFF, 0xFC, 0xA7, 0x69, 0xAF, 0xFA, 0x77, 0x49, 0x99, 0x97,
+    0x77, 0x77, 0x74, 0xA9, 0x77, 0x70, 0xEA, 0x77, 0x7F, 0x77, 0x7E, 0xA7, 0x77, 0x0A, 0x97, 0x70,
+    0x77, 0x77, 0x75, 0xE9, 0x77, 0x39, 0xE9, 0x77, 0x39, 0xE1, 0xE9, 0x70, 0x9E, 0x1E, 0xA1, 0xE9,
+    0x70, 0x9E, 0x0A, 0xE2, 0xE9, 0x70, 0x9F, 0xE9, 0x2E, 0x97, 0x09, 0xFD, 0x4E, 0x97, 0x09, 0xE9,
+    0x6E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97,
+    0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x09, 0xE7, 0xE9, 0x70, 0x9E, 0x7E, 0x97, 0x0A, 0xE7,
+    0xE9, 0x70, 0xF7, 0xF7, 0x9F, 0x7A, 0xE9, 0x59, 0xFC, 0x70, 0xFC, 0x99, 0x9A, 0xEA, 0xE7, 0x09,
+    0xFF, 0xDA, 0x0E, 0x72, 0xAF, 0xE9, 0x1E, 0x75, 0x99, 0x97, 0x77, 0x77, 0x7A, 0x97, 0x75, 0xEA,
+    0x77, 0x4F, 0x77, 0x4E, 0xA7, 0x75, 0xA9, 0x76, 0x5A, 0xAA, 0xA7, 0x71, 0xAE, 0x97, 0x71, 0xF7,
+    0x72, 0xEA, 0x77, 0x2E, 0x97, 0x72, 0xE7, 0x73, 0x99, 0x77, 0x77, 0x77, 0x4A, 0xDA, 0x74, 0x9D,
+    0xA0, 0x9E, 0x97, 0x3E, 0xA1, 0xF7, 0x2A, 0xE3, 0xE9, 0x71, 0xE9, 0x3A, 0xE7, 0x0A, 0xE5, 0xE9,
+    0x7E, 0x95, 0xAE, 0x6A, 0xE7, 0xEA, 0x49, 0xE9, 0x7A, 0xE4, 0xEA, 0x71, 0xEA, 0x29, 0xE7, 0x29,
+    0xE2, 0xEA, 0x73, 0xEA, 0x09, 0xE7, 0x49, 0xE0, 0xEA, 0x75, 0xFE, 0x76, 0x9F, 0xC9, 0x77, 0xFC,
+    0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77,
+    0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x00, 0x4A, 0xAA, 0xA7,
+    0x7A, 0xE9, 0x77, 0xF7, 0x70, 0xEA, 0x77, 0x0E, 0x77, 0x1E, 0x77, 0x19, 0x97, 0x77, 0x77, 0x7A,
+    0xE7, 0x2A, 0xE0, 0x9E, 0x72, 0xEA, 0x1E, 0xA7, 0x09, 0xE2, 0xAE, 0x70, 0xAE, 0x3E, 0x97, 0xE9,
+    0x3A, 0xDA, 0x69, 0xE4, 0x9E, 0x6E, 0xA5, 0xE9, 0x5E, 0x95, 0xAE, 0x4A, 0xE7, 0xE4, 0xEA, 0x7A,
+    0xDA, 0x3E, 0x70, 0x9E, 0x2A, 0xDA, 0x71, 0xE9, 0x1E, 0x97, 0x1A, 0xDA, 0x09, 0xE7, 0x3E, 0x0A,
+    0xDA, 0x73, 0xAD, 0x9E, 0x74, 0x9D, 0xAE, 0x75, 0xFC, 0x97, 0x59, 0xF7, 0x7E, 0xA7, 0x7E, 0x97,
+    0x69, 0xE7, 0x7E, 0xA7, 0x69, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x2A, 0xCA, 0xFC, 0x97, 0x2A, 0xFD,
+    0x97, 0x39, 0xFA, 0x75, 0xAD, 0xA7, 0x49, 0xDA, 0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE, 0x3E,
+    0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAE, 0x5E, 0x97, 0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E, 0x97,
+    0xAE, 0x4E, 0xA7, 0x1E, 0xA2, 0x9E, 0x72, 0x9E, 0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E, 0x0E,
+    0xA7, 0x5F, 0xE7, 0x69, 0xFC, 0x97, 0x7F, 0xC7, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77,
+    0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E,
+    0x97, 0x71, 0xE9, 0x77, 0x77, 0x77, 0x75, 0x9A, 0x97, 0x72, 0xE9, 0x77, 0x09, 0xE9, 0x77, 0x1E,
+    0x97, 0x71, 0x9A, 0x97, 0x10, 0x77, 0x3A, 0xE7, 0x2A, 0xE0, 0x9E, 0x72, 0xEA, 0x1E, 0xA7, 0x09,
+    0xE2, 0xAE, 0x70, 0xAE, 0x3E, 0x97, 0xE9, 0x3A, 0xDA, 0x69, 0xE4, 0x9E, 0x6E, 0xA5, 0xE9, 0x5E,
+    0x95, 0xAE, 0x4A, 0xE7, 0xE4, 0xEA, 0x7A, 0xDA, 0x3E, 0x70, 0x9E, 0x2A, 0xDA, 0x71, 0xE9, 0x1E,
+    0x97, 0x1A, 0xDA, 0x09, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xAD, 0x9E, 0x74, 0x9D, 0xAE, 0x75, 0xFC,
+    0x97, 0x59, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0xA1, 0x9A, 0x97, 0x19, 0xE1, 0x9E,
+    0x71, 0xEA, 0x19, 0xE9, 0x7A, 0xE2, 0x9E, 0x3A, 0xCA, 0xFC, 0x93, 0x9A, 0x93, 0xAF, 0xD9, 0x73,
+    0x9F, 0xA7, 0x50, 0x7F, 0xA7, 0x70, 0xFD, 0x77, 0x29, 0xDA, 0x77, 0x2D, 0xA7, 0x71, 0x9D, 0xA7,
+    0x79, 0xF7, 0x70, 0xAD, 0x97, 0x71, 0xAC, 0xA7, 0x72, 0x9A, 0x97, 0x77, 0x7A, 0xDA, 0x74, 0x9D,
+    0xA0, 0x9E, 0x97, 0x3E, 0xA1, 0xF7, 0x2A, 0xE3, 0xE9, 0x71, 0xE9, 0x3A, 0xE7, 0x0A, 0xE5, 0xE9,
+    0x7E, 0x95, 0xAE, 0x6A, 0xE7, 0xEA, 0x49, 0xE9, 0x7A, 0xE4, 0xEA, 0x71, 0xEA, 0x29, 0xE7, 0x29,
+    0xE2, 0xEA, 0x73, 0xEA, 0x09, 0xE7, 0x49, 0xE0, 0xEA, 0x75, 0xFE, 0x76, 0x9F, 0xC9, 0x77, 0xFC,
+    0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77,
+    0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x00, 0x6A, 0xDA, 0x97,
+    0x6F, 0xD7, 0x59, 0x09, 0xAD, 0x97, 0x70, 0xDA, 0x77, 0x9D, 0x97, 0x59, 0xAE, 0x76, 0xEA, 0x77,
+    0xD9, 0x77, 0x0A, 0xC9, 0x77, 0x77, 0x77, 0x0A, 0xE7, 0x2A, 0xE0, 0x9E, 0x72, 0xEA, 0x1E, 0xA7,
+    0x09, 0xE2, 0xAE, 0x70, 0xAE, 0x3E, 0x97, 0xE9, 0x3A, 0xDA, 0x69, 0xE4, 0x9E, 0x6E, 0xA5, 0xE9,
+    0x5E, 0x95, 0xAE, 0x4A, 0xE7, 0xE4, 0xEA, 0x7A, 0xDA, 0x3E, 0x70, 0x9E, 0x2A, 0xDA, 0x71, 0xE9,
+    0x1E, 0x97, 0x1A, 0xDA, 0x09, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xAD, 0x9E, 0x74, 0x9D, 0xAE, 0x75,
+    0xFC, 0x97, 0x59, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0xA7, 0x69, 0xE7, 0x7E, 0xA7,
+    0x6A, 0xE7, 0x2A, 0xCA, 0xFC, 0x97, 0x2A, 0xFD, 0x97, 0x39, 0xFA, 0x75, 0x59, 0xA9, 0x59, 0xA7,
+    0x1A, 0xFA, 0x3D, 0x97, 0x9F, 0xEA, 0x9A, 0xD7, 0x0D, 0xA1, 0xAF, 0xD9, 0x70, 0xD4, 0xAE, 0xA7,
+    0x19, 0x77, 0x77, 0x77, 0x74, 0xAD, 0xA7, 0x49, 0xDA, 0x09, 0xE9, 0x73, 0xEA, 0x1F, 0x72, 0xAE,
+    0x3E, 0x97, 0x1E, 0x93, 0xAE, 0x70, 0xAE, 0x5E, 0x97, 0xE9, 0x5A, 0xE6, 0xAE, 0x7E, 0xA4, 0x9E,
+    0x97, 0xAE, 0x4E, 0xA7, 0x1E, 0xA2, 0x9E, 0x72, 0x9E, 0x2E, 0xA7, 0x3E, 0xA0, 0x9E, 0x74, 0x9E,
+    0x0E, 0xA7, 0x5F, 0xE7, 0x69, 0xFC, 0x97, 0x7F, 0xC7, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9,
+    0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x71, 0xE9, 0x77,
+    0x1E, 0x97, 0x71, 0xE9, 0x70, 0x49, 0xA9, 0x59, 0xA7, 0xAF, 0xA3, 0xD6, 0xAF, 0xEA, 0x9A, 0xD6,
+    0xDA, 0x09, 0xAF, 0xD9, 0x6D, 0x39, 0xFA, 0x79, 0x77, 0x77, 0x77, 0x7A, 0xE7, 0x2A, 0xE0, 0x9E,
+    0x72, 0xEA, 0x1E, 0xA7, 0x09, 0xE2, 0xAE, 0x70, 0xAE, 0x3E, 0x97, 0xE9, 0x3A, 0xDA, 0x69, 0xE4,
+    0x9E, 0x6E, 0xA5, 0xE9, 0x5E, 0x95, 0xAE, 0x4A, 0xE7, 0xE4, 0xEA, 0x7A, 0xDA, 0x3E, 0x70, 0x9E,
+    0x2A, 0xDA, 0x71, 0xE9, 0x1E, 0x97, 0x1A, 0xDA, 0x09, 0xE7, 0x3E, 0x0A, 0xDA, 0x73, 0xAD, 0x9E,
+    0x74, 0x9D, 0xAE, 0x75, 0xFC, 0x97, 0x59, 0xF7, 0x7E, 0xA7, 0x7E, 0x97, 0x69, 0xE7, 0x7E, 0xA7,
+    0x69, 0xE7, 0x7E, 0xA7, 0x6A, 0xE7, 0x2A, 0xCA, 0xFC, 0x97, 0x2A, 0xFD, 0x97, 0x39, 0xFA, 0x75,
+    0x39, 0x96, 0xAC, 0x96, 0xAC, 0x90, 0x9A, 0xAA, 0xAA, 0xD9, 0xFF, 0xAD, 0x29, 0xCA, 0x0D, 0x19,
+    0xCA, 0x1D, 0x1A, 0xA2, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xAA, 0x60, 0x29, 0x95, 0x9C, 0xA4,
+    0x9C, 0xA4, 0x9D, 0xAA, 0xAA, 0xA9, 0xAF, 0xF0, 0xAC, 0x92, 0xD1, 0xAC, 0x91, 0xD2, 0xAA, 0x1D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0xA0, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFA, 0xAF,
+    0xFA, 0x09, 0x99, 0x99, 0x99, 0x90, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFA, 0xAF, 0xFA, 0x09,
+    0x99, 0x99, 0x99, 0x90, 0x9F, 0xFF, 0xFC, 0xAA, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xD0, 0x9A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xFF, 0xFE, 0x9A, 0xFF, 0xFE, 0x90, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0A,
+    0xA9, 0x49, 0xA9, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0,
+    0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA,
+    0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E,
+    0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D,
+    0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4,
+    0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE0, 0xDA, 0x4E, 0x0D, 0xA4, 0xE7,
+    0x30, 0x77, 0x1F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x77, 0x77, 0x3F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x00, 0x29, 0xD3, 0xE2, 0x9D, 0xA2, 0xAD, 0x92, 0xE2, 0x9E, 0x2E, 0xA2, 0xEA, 0x19, 0xE9, 0x29,
+    0x99, 0x20, 0x1A, 0xE2, 0xF2, 0xEA, 0x2E, 0x29, 0xE2, 0xAD, 0xA2, 0xE3, 0xDA, 0x29, 0xD9, 0x39,
+    0x93, 0x1E, 0xA1, 0xEA, 0x09, 0xE9, 0x0A, 0xE1, 0xAD, 0xA1, 0xE2, 0xE1, 0x9D, 0x91, 0xAD, 0x29,
+    0x99, 0x20, 0x9E, 0x91, 0x9E, 0x92, 0xEA, 0x2A, 0xE2, 0x9E, 0x3E, 0x92, 0xAD, 0x93, 0xDA, 0x3A,
+    0xD4, 0x99, 0x00, 0x29, 0xD3, 0x9C, 0xA3, 0xE3, 0xDA, 0x29, 0xDA, 0x29, 0xD9, 0x2A, 0xD9, 0x2E,
+    0x92, 0xE3, 0xE2, 0x9E, 0x2A, 0xE2, 0xEA, 0x2E, 0xA2, 0xEA, 0x19, 0xE9, 0x19, 0xE9, 0x1A, 0xE9,
+    0x29, 0x99, 0x39, 0x99, 0x20, 0x1A, 0xE2, 0xAD, 0xA2, 0xF2, 0xF2, 0xEA, 0x2E, 0x91, 0x9E, 0x29,
+    0xE2, 0x9E, 0x2A, 0xE2, 0xAD, 0x92, 0xE9, 0x2E, 0x3E, 0x3D, 0xA3, 0xDA, 0x29, 0xD3, 0x9D, 0x49,
+    0x93, 0x99, 0x93, 0x1E, 0xA2, 0xEA, 0x1E, 0xA1, 0x9E, 0x90, 0x9E, 0x91, 0x9E, 0x1A, 0xE2, 0xAE,
+    0x1E, 0xA2, 0xEA, 0x1E, 0x3E, 0x2E, 0x29, 0xDA, 0x19, 0xD9, 0x29, 0xD9, 0x1A, 0xD3, 0xAD, 0x29,
+    0x99, 0x39, 0x93, 0x9E, 0x29, 0xE2, 0x9E, 0x91, 0x9E, 0x92, 0xEA, 0x2E, 0xA2, 0xAE, 0x2E, 0xA2,
+    0x9E, 0x29, 0xE3, 0xE3, 0xE3, 0xAD, 0x92, 0xAD, 0x93, 0xDA, 0x29, 0xDA, 0x3A, 0xD3, 0xE4, 0x99,
+    0x49, 0x90, 0x5A, 0xAA, 0x72, 0x9E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3D, 0xA7, 0x3A, 0xCA, 0x69,
+    0x3A, 0xC9, 0x39, 0x9A, 0xFF, 0xFD, 0xAF, 0xFF, 0xD9, 0xAA, 0xA9, 0x9A, 0xCA, 0x99, 0xAA, 0xAA,
+    0x5A, 0xC9, 0x73, 0xAC, 0xA7, 0x3A, 0xCA, 0x73, 0xAC, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3E, 0x73,
+    0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x3E, 0x73, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE9,
+    0x71, 0x9E, 0x94, 0x5A, 0xAA, 0x73, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3A, 0xD7, 0x3A, 0xCA,
+    0x5F, 0xAA, 0xEA, 0xAF, 0xFF, 0xFF, 0xEA, 0xAE, 0xAA, 0xF5, 0xAC, 0xA7, 0x3E, 0x73, 0xE7, 0x3E,
+    0x73, 0xE9, 0x72, 0xE7, 0x3E, 0x73, 0xE7, 0x3A, 0xCA, 0x59, 0x99, 0x91, 0xAC, 0xA1, 0x99, 0x9A,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x99, 0x99, 0x1A, 0xCA, 0x19, 0x99, 0xA5, 0xAC, 0xA7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE7, 0x29, 0xE9, 0x40, 0x39, 0x95, 0xAF, 0xA2, 0x9F, 0xDA, 0x1F, 0xF1, 0xFF, 0x1F,
+    0xF1, 0xFF, 0x1F, 0xF1, 0x9F, 0xD9, 0x3A, 0xE9, 0x10, 0x72, 0x9C, 0x97, 0x9E, 0x69, 0xFA, 0x49,
+    0xFD, 0xA2, 0x9F, 0xF9, 0x09, 0xFF, 0x90, 0x9F, 0xDA, 0x29, 0xFA, 0x49, 0xE9, 0x59, 0xC9, 0x77,
+    0x20, 0x09, 0xA9, 0x0A, 0xE9, 0xFA, 0xFA, 0xAE, 0x90, 0x9A, 0x10, 0x19, 0x97, 0x99, 0x2F, 0x5F,
+    0x09, 0xF9, 0x4F, 0x90, 0xF9, 0x4F, 0x90, 0xF5, 0xF2, 0x99, 0x79, 0x91, 0x19, 0x97, 0x99, 0x69,
+    0xA9, 0x1F, 0x5F, 0x49, 0xEA, 0x9F, 0x93, 0x9F, 0x4A, 0xF0, 0xF9, 0x39, 0xF4, 0xAF, 0x0F, 0x5F,
+    0x49, 0xEA, 0x19, 0x97, 0x99, 0x69, 0xA9, 0x00, 0x19, 0x92, 0xF0, 0x9F, 0x90, 0xF9, 0x0F, 0x29,
+    0x91, 0x9A, 0xAA, 0xAA, 0xAA, 0xAF, 0xFE, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6A,
+    0xC6, 0xAA, 0xAA, 0xAA, 0xAA, 0x9F, 0xFC, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+    0x6C, 0xA0, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9, 0x9F, 0xF9,
+    0x9F, 0xF9, 0x3D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x30, 0x9F, 0xF9, 0x9C, 0xAA, 0xAA, 0xAA,
+    0xA0, 0x9C, 0x79, 0xC7, 0x9C, 0x79, 0xC7, 0x9C, 0x99, 0x99, 0x99, 0x90, 0x9F, 0xF9, 0x3D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x30, 0x9F, 0xF9, 0x0A, 0xAA, 0xAA, 0xAA, 0xC9, 0x7C, 0x97, 0xC9,
+    0x7C, 0x97, 0xC9, 0x09, 0x99, 0x99, 0x99, 0xC9, 0x9F, 0xF9, 0x3D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x30, 0x77, 0x77, 0x74, 0x9F, 0xA7, 0x2A, 0xD7, 0x74, 0x9F, 0xE7, 0x1D, 0xA7, 0x74, 0xE9,
+    0x0A, 0xE7, 0xAD, 0x77, 0x49, 0xD9, 0x2A, 0xD6, 0x9D, 0xA7, 0x74, 0xE4, 0xDA, 0x5E, 0x77, 0x5E,
+    0x4D, 0xA4, 0x9D, 0xA7, 0x75, 0xDA, 0x4E, 0x4E, 0x77, 0x6D, 0xA4, 0xE3, 0x9D, 0x97, 0x76, 0xDA,
+    0x4E, 0x3E, 0x77, 0x7D, 0xA4, 0xE2, 0xAD, 0x97, 0x77, 0xDA, 0x4E, 0x2D, 0xA2, 0x99, 0x97, 0x19,
+    0x99, 0x5E, 0x4D, 0xA1, 0xAD, 0x19, 0xFC, 0xA5, 0x9F, 0xCA, 0x3A, 0xD3, 0x9D, 0x91, 0xDA, 0x09,
+    0xFE, 0xA3, 0x9F, 0xEA, 0x3D, 0xA2, 0xE1, 0xE1, 0xE9, 0x1E, 0x92, 0xE9, 0x1E, 0x92, 0xAE, 0xAE,
+    0xA0, 0x9D, 0xA1, 0xDA, 0x3D, 0xA2, 0xDA, 0x3D, 0xA3, 0xFD, 0xA1, 0xE1, 0x9D, 0x93, 0xE1, 0x9D,
+    0x93, 0xE4, 0x9A, 0xAA, 0x29, 0xD9, 0x1A, 0xD4, 0xAD, 0x1A, 0xD4, 0xAD, 0x73, 0xE2, 0xAD, 0x49,
+    0xD9, 0x0A, 0xD4, 0x9D, 0x72, 0xAD, 0x92, 0xE4, 0x9D, 0x90, 0xE4, 0x9D, 0x97, 0x1E, 0x3E, 0x49,
+    0xD9, 0x0E, 0x49, 0xD9, 0x70, 0xAD, 0x4A, 0xD4, 0x9D, 0x90, 0xAD, 0x49, 0xD7, 0x1D, 0xA4, 0xAD,
+    0x4A, 0xD1, 0xAD, 0x4A, 0xD7, 0x0E, 0x59, 0xD9, 0x3E, 0x19, 0xD9, 0x3E, 0x79, 0xDA, 0x6D, 0xA3,
+    0xDA, 0x2D, 0xA3, 0xDA, 0x7E, 0x7A, 0xD9, 0x1E, 0x92, 0xAD, 0x91, 0xE9, 0x69, 0xD9, 0x70, 0xFE,
+    0xA4, 0xFE, 0xA7, 0xE7, 0x2F, 0xCA, 0x6F, 0xCA, 0x77, 0x70, 0x99, 0x72, 0x99, 0x40, 0x77, 0x77,
+    0x77, 0x72, 0x9F, 0xA7, 0x29, 0xD9, 0x77, 0x77, 0x1A, 0xFE, 0x71, 0xE7, 0x77, 0x72, 0xEA, 0x9A,
+    0xE7, 0x9D, 0x97, 0x77, 0x71, 0xAD, 0x92, 0xAD, 0x96, 0xE7, 0x77, 0x72, 0xE4, 0xDA, 0x5A, 0xD9,
+    0x77, 0x77, 0x2E, 0x4E, 0x5D, 0xA7, 0x77, 0x73, 0xDA, 0x4E, 0x4A, 0xD7, 0x77, 0x73, 0x9D, 0xA4,
+    0xE4, 0xDA, 0x77, 0x77, 0x39, 0xDA, 0x4E, 0x3E, 0x77, 0x77, 0x49, 0xDA, 0x4E, 0x29, 0xD9, 0x77,
+    0x77, 0x5D, 0xA4, 0xE2, 0xE3, 0x99, 0x97, 0x19, 0x99, 0x71, 0x99, 0x95, 0xE4, 0xE1, 0x9D, 0x91,
+    0xAF, 0xC9, 0x5A, 0xFC, 0x95, 0xAF, 0xC9, 0x3A, 0xD3, 0x9D, 0xA1, 0xE1, 0xFF, 0x93, 0xAF, 0xE9,
+    0x3A, 0xFE, 0x92, 0x9E, 0x2E, 0x1A, 0xD9, 0x09, 0xE1, 0xAE, 0x29, 0xE9, 0x09, 0xE3, 0xE9, 0x09,
+    0xE3, 0xFF, 0xA1, 0xDA, 0x1E, 0x3A, 0xD9, 0x1A, 0xD9, 0x2A, 0xD9, 0x1A, 0xD9, 0x29, 0xDA, 0x3F,
+    0xDA, 0x1A, 0xD2, 0xE3, 0x9D, 0xA1, 0xE4, 0xDA, 0x1E, 0x4E, 0x49, 0xAA, 0xA9, 0x2D, 0xA1, 0x9D,
+    0xA4, 0xE1, 0xDA, 0x4E, 0x1E, 0x4E, 0x73, 0xE2, 0x9D, 0xA4, 0xE0, 0x9D, 0xA4, 0xE1, 0xE4, 0xE7,
+    0x29, 0xD9, 0x29, 0xD9, 0x4E, 0x09, 0xDA, 0x4E, 0x1D, 0xA4, 0xAD, 0x72, 0xE3, 0x9D, 0x94, 0xE0,
+    0x9D, 0xA4, 0xE1, 0xDA, 0x4A, 0xD7, 0x19, 0xD9, 0x39, 0xDA, 0x4E, 0x1D, 0xA4, 0xE1, 0xE4, 0xE7,
+    0x1E, 0x5D, 0xA4, 0xE1, 0xDA, 0x4E, 0x1E, 0x4E, 0x70, 0xAD, 0x95, 0xE3, 0x9D, 0xA1, 0xE4, 0xDA,
+    0x1E, 0x4E, 0x70, 0xDA, 0x6E, 0x3A, 0xD9, 0x1A, 0xD9, 0x2A, 0xD9, 0x1A, 0xD9, 0x29, 0xDA, 0x7A,
+    0xD7, 0x9E, 0x1A, 0xE3, 0xE9, 0x09, 0xE3, 0xE9, 0x09, 0xE7, 0x0D, 0xA7, 0x0A, 0xFE, 0x93, 0xAF,
+    0xE9, 0x39, 0xFE, 0xA7, 0xE7, 0x2A, 0xFC, 0x95, 0xAF, 0xC9, 0x59, 0xFC, 0x97, 0x77, 0x09, 0x97,
+    0x29, 0x99, 0x71, 0x99, 0x94, 0x4A, 0xD9, 0x39, 0xE4, 0xE9, 0x39, 0xDA, 0x4E, 0x49, 0xD9, 0x4E,
+    0x49, 0xD5, 0xDA, 0x49, 0xD5, 0x4A, 0xD9, 0x2D, 0xA4, 0x9E, 0x2E, 0x94, 0xE9, 0x19, 0xE4, 0x9D,
+    0xA2, 0xE5, 0xE2, 0x9D, 0xA4, 0x9D, 0x92, 0xAD, 0x5E, 0x3D, 0x94, 0x9D, 0x3A, 0xCA, 0x5D, 0xA3,
+    0xD5, 0x9D, 0x3A, 0xC9, 0x50, 0x4A, 0xD9, 0x2D, 0xA2, 0xAD, 0x93, 0x9E, 0x2A, 0xD9, 0x2E, 0x4E,
+    0x92, 0xE2, 0xAD, 0x93, 0x9D, 0xA2, 0xAD, 0x3E, 0x4E, 0x3D, 0xA2, 0xAD, 0x49, 0xD9, 0x2A, 0xD3,
+    0xDA, 0x4E, 0x3D, 0x92, 0xAD, 0x49, 0xD3, 0xAC, 0xA3, 0xD9, 0x4D, 0xA3, 0xD3, 0xAC, 0xA4, 0x9D,
+    0x3A, 0xC9, 0x3D, 0x50, 0xAD, 0x95, 0xE5, 0xAD, 0xA5, 0xE5, 0x9D, 0xA5, 0xAD, 0x6D, 0xA5, 0x9D,
+    0x6D, 0xA6, 0xD0, 0xAD, 0x91, 0x9D, 0xA5, 0xE2, 0xE5, 0xAD, 0xA1, 0x9D, 0xA5, 0xE2, 0xE5, 0x9D,
+    0xA2, 0xDA, 0x5A, 0xD2, 0xAD, 0x6D, 0xA2, 0xDA, 0x59, 0xD2, 0x9D, 0x6D, 0xA2, 0xAC, 0xA6, 0xD3,
+    0xD0, 0xAD, 0x91, 0x9D, 0xA1, 0x9D, 0xA5, 0xE2, 0xE2, 0xE5, 0xAD, 0xA1, 0x9D, 0xA1, 0x9D, 0xA5,
+    0xE2, 0xE2, 0xAD, 0x59, 0xDA, 0x2D, 0xA2, 0xDA, 0x5A, 0xD2, 0xAD, 0x2A, 0xD6, 0xDA, 0x2D, 0xA2,
+    0xDA, 0x59, 0xD2, 0x9D, 0x29, 0xD6, 0xDA, 0x2A, 0xCA, 0x2A, 0xCA, 0x6D, 0x3D, 0x3D, 0x00, 0x77,
+    0x4A, 0xCA, 0x73, 0xE7, 0x2A, 0xEA, 0x71, 0xD9, 0xD7, 0x0A, 0xCA, 0x0A, 0xCA, 0x7D, 0x2D, 0x6A,
+    0xCA, 0x2A, 0xC9, 0x5D, 0x4D, 0x4A, 0xCA, 0x4A, 0xC9, 0x3D, 0x6D, 0x2A, 0xCA, 0x6D, 0x91, 0xD9,
+    0x69, 0xD0, 0x59, 0x97, 0xDA, 0x5E, 0x94, 0xEA, 0x4A, 0xE4, 0xAE, 0x49, 0xE5, 0xE9, 0x49, 0xE9,
+    0x5A, 0xE6, 0xAE, 0x6E, 0xA6, 0xEA, 0x6E, 0x95, 0x9E, 0x6A, 0x91, 0x19, 0x7D, 0xA6, 0xEA, 0x6E,
+    0x96, 0xE9, 0x59, 0xE6, 0xAE, 0x6F, 0x5A, 0xE4, 0x9E, 0x49, 0xE9, 0x4E, 0x94, 0xEA, 0x4A, 0xE4,
+    0x9E, 0x7A, 0x60, 0x77, 0x77, 0x97, 0x0E, 0x71, 0x93, 0xD9, 0x69, 0xEA, 0x7D, 0x92, 0xE9, 0x59,
+    0xEA, 0x6E, 0xA3, 0xE9, 0x5E, 0x6E, 0xA5, 0xE9, 0x59, 0x6E, 0xA7, 0xE9, 0x73, 0xEA, 0x71, 0xE9,
+    0x71, 0xEA, 0x73, 0xE9, 0x7E, 0xA7, 0x49, 0xE9, 0x5E, 0xA7, 0x69, 0xE9, 0x3E, 0xA7, 0x70, 0x9E,
+    0x91, 0xEA, 0x72, 0x99, 0x59, 0xE9, 0xEA, 0x69, 0x2E, 0xA5, 0x9F, 0xCA, 0x59, 0xE1, 0xF6, 0x9E,
+    0xA6, 0xAE, 0x90, 0xF6, 0xFC, 0x95, 0x9E, 0x90, 0x9D, 0x95, 0xEA, 0xE9, 0x5A, 0xCA, 0x72, 0xEA,
+    0x09, 0xE9, 0x77, 0x1E, 0xA2, 0x9E, 0x97, 0x7E, 0xA4, 0x9E, 0x76, 0xEA, 0x69, 0xE7, 0x4E, 0xA7,
+    0x09, 0xE7, 0x2E, 0xA7, 0x29, 0xE7, 0x0E, 0xA7, 0x49, 0xE6, 0xEA, 0x5A, 0xCA, 0x59, 0xE4, 0xEA,
+    0x59, 0xE9, 0x59, 0xE2, 0x9D, 0xA6, 0x9E, 0xA6, 0x9D, 0xA2, 0x9A, 0x70, 0xE9, 0x79, 0xA7, 0x69,
+    0xA9, 0x74, 0x0A, 0xE3, 0x9E, 0xA0, 0xF3, 0x9E, 0xA0, 0xF4, 0xEA, 0x0F, 0x4E, 0xA0, 0xF4, 0xE9,
+    0x0A, 0xE4, 0xE9, 0x0A, 0xDA, 0x4E, 0x90, 0xAD, 0xA4, 0xE9, 0x0A, 0xDA, 0x4E, 0x90, 0xAD, 0xA4,
+    0xE1, 0x9D, 0xA4, 0xE1, 0x9D, 0x94, 0xE1, 0x9D, 0x94, 0xAD, 0x19, 0xD9, 0x4A, 0xD1, 0x9D, 0x94,
+    0xAD, 0x2D, 0x94, 0xAD, 0x2D, 0x94, 0xAD, 0x2D, 0x5A, 0xD2, 0xD5, 0x9D, 0x29, 0x96, 0x99, 0x77,
+    0x76, 0x99, 0x59, 0xA9, 0x1F, 0x39, 0xEA, 0x9F, 0x92, 0xAF, 0x0F, 0x92, 0xAF, 0x0F, 0x39, 0xEA,
+    0x19, 0x96, 0xA9, 0x00, 0x77, 0x29, 0xFE, 0xA4, 0xAF, 0xFE, 0x92, 0xFE, 0x99, 0xF9, 0x29, 0x1E,
+    0x2A, 0xE5, 0xE3, 0xE9, 0x4E, 0x39, 0xD9, 0x4E, 0x39, 0xD9, 0x4E, 0x3A, 0xD9, 0x4E, 0x3A, 0xD5,
+    0xE3, 0xE5, 0xE2, 0xE9, 0x5E, 0x1E, 0xA6, 0xE9, 0xE9, 0x7A, 0xFC, 0x97, 0x0A, 0xF7, 0x2A, 0xE7,
+    0x3A, 0xDA, 0x73, 0xAD, 0x97, 0x3A, 0xD9, 0x74, 0x99, 0x77, 0x77, 0x77, 0x74, 0xAD, 0x97, 0x3F,
+    0x72, 0x9F, 0x73, 0xEA, 0x74, 0x99, 0x70, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x09, 0xA7, 0x70, 0xA9, 0x0D, 0x77, 0x9C, 0xA1, 0xD7,
+    0x6D, 0x2A, 0xD7, 0x4D, 0x93, 0xAD, 0x97, 0x09, 0xDA, 0x5A, 0xE9, 0x49, 0xEA, 0x79, 0xFF, 0xE9,
+    0x72, 0x9A, 0xFC, 0xA9, 0x50, 0x79, 0xAA, 0xAA, 0xA9, 0x74, 0xAF, 0xFC, 0xA7, 0x09, 0xEA, 0x99,
+    0x99, 0x9A, 0xE6, 0x9D, 0xA7, 0x0A, 0xD9, 0x39, 0xD9, 0x72, 0x9D, 0x3D, 0x75, 0x9D, 0x1A, 0xC9,
+    0x76, 0xAC, 0xA0, 0xAC, 0x77, 0x0C, 0xA7, 0x75, 0x77, 0x70, 0xD7, 0x2A, 0xD7, 0x2D, 0x97, 0x19,
+    0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xCA, 0x72, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x71, 0x9D, 0x72,
+    0xD9, 0x71, 0x9D, 0x72, 0xE7, 0x2E, 0x97, 0x0A, 0xF7, 0x0D, 0x0D, 0x96, 0xAD, 0x09, 0xD6, 0xD9,
+    0x1D, 0x59, 0xD2, 0xAC, 0xA4, 0xD9, 0x3D, 0x39, 0xD4, 0xAC, 0x92, 0xDA, 0x49, 0xD2, 0xD6, 0xD9,
+    0x00, 0x77, 0x29, 0xAA, 0x97, 0x77, 0x75, 0xEA, 0x77, 0x77, 0x5A, 0xDA, 0x77, 0x77, 0x5A, 0xD9,
+    0x77, 0x77, 0x59, 0xD9, 0x77, 0x77, 0x59, 0xD7, 0x77, 0x79, 0xDA, 0x91, 0x9D, 0x29, 0xAD, 0x97,
+    0x77, 0xAF, 0xCA, 0xAD, 0x9A, 0xFC, 0x97, 0x77, 0xAF, 0xFF, 0xFA, 0x77, 0x71, 0x99, 0x9A, 0xAF,
+    0xAA, 0x99, 0x97, 0x77, 0x7A, 0xF9, 0x77, 0x77, 0x29, 0xDA, 0xE7, 0x77, 0x72, 0xE0, 0x9E, 0x77,
+    0x77, 0x0E, 0xA1, 0xEA, 0x77, 0x76, 0xAE, 0x91, 0x9E, 0x97, 0x77, 0x5F, 0x3F, 0x77, 0x76, 0xAC,
+    0x93, 0x9C, 0xA7, 0x76, 0x9A, 0xAA, 0x77, 0x3A, 0xAA, 0x76, 0x9E, 0x77, 0x3E, 0x76, 0x9E, 0x77,
+    0x3E, 0x77, 0xE7, 0x73, 0xE7, 0x7D, 0xA7, 0x73, 0xE7, 0x09, 0x5D, 0xA7, 0x73, 0xE7, 0x0D, 0xA9,
+    0x2D, 0x91, 0x9A, 0xDA, 0x5E, 0xA2, 0xAC, 0xA2, 0x9E, 0x1F, 0xDA, 0xDA, 0xAF, 0xD5, 0xFD, 0xAE,
+    0xAF, 0xD0, 0x9F, 0xFF, 0xFC, 0x5F, 0xFF, 0xFC, 0x39, 0x99, 0xAF, 0xA9, 0x99, 0x72, 0x99, 0x9A,
+    0xFC, 0xA9, 0x99, 0x70, 0x9F, 0xC7, 0x71, 0xFC, 0x74, 0xE9, 0xDA, 0x77, 0xE9, 0xE7, 0x2A, 0xD9,
+    0x0E, 0x97, 0x5A, 0xDA, 0x0A, 0xDA, 0x70, 0x9E, 0x19, 0xE7, 0x49, 0xE2, 0xE9, 0x7E, 0xA2, 0xF7,
+    0x3F, 0x2A, 0xE6, 0xAE, 0x39, 0xE9, 0x71, 0x9E, 0x93, 0xEA, 0x69, 0xCA, 0x4C, 0xA7, 0x5A, 0xC4,
+    0xD9, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFA, 0xAF, 0xFA, 0x09, 0x99, 0x99,
+    0x99, 0x90, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x70, 0xDA, 0x77, 0xE7, 0x79, 0xD9, 0x77, 0xE7, 0x7A,
+    0xD7, 0x79, 0xDA, 0x77, 0xE7, 0x79, 0xD9, 0x77, 0xDA, 0x77, 0xAD, 0x77, 0x9D, 0xA7, 0x7E, 0x77,
+    0xAD, 0x97, 0x7D, 0xA7, 0x7A, 0xD7, 0x79, 0xD9, 0x77, 0xE7, 0x7A, 0xD7, 0x70, 0xDA, 0x77, 0xE7,
+    0x79, 0xD9, 0x77, 0xE7, 0x7A, 0xD7, 0x70, 0xDA, 0x77, 0xE7, 0x70, 0x0F, 0xF1, 0xFF, 0x1F, 0xF1,
+    0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xEA, 0xAA, 0xAA, 0x1F,
+    0xF1, 0xFF, 0x1E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0xAA,
+    0xAA, 0xA1, 0xFF, 0x1F, 0xF0, 0x0F, 0xF9, 0x0F, 0xF9, 0x0F, 0xF9, 0x5E, 0x95, 0xE9, 0x5E, 0x95,
+    0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x0F, 0xF9, 0x0F,
+    0xF9, 0x0F, 0xF9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E,
+    0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x0F, 0xF9, 0x0F, 0xF9, 0x0F, 0xF9, 0x77, 0x77, 0x2A, 0xFE, 0xA5,
+    0x9A, 0xFE, 0x94, 0xFF, 0xF9, 0x19, 0xFF, 0xF3, 0xFD, 0xAF, 0xD1, 0x9F, 0xDA, 0xFD, 0x2A, 0xCA,
+    0x59, 0xEA, 0x1D, 0x95, 0xAE, 0x97, 0x39, 0xE7, 0x3A, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x97, 0x3E,
+    0x74, 0xE7, 0x4E, 0x73, 0x9E, 0x73, 0x9E, 0x73, 0xEA, 0x73, 0xE9, 0x72, 0xF7, 0x3F, 0x72, 0xF7,
+    0x3F, 0x72, 0xF7, 0x29, 0xF7, 0x2F, 0x72, 0x9E, 0xA7, 0x2F, 0x73, 0xEA, 0x72, 0x9E, 0x73, 0xAD,
+    0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x4D, 0xA7, 0x49, 0x99, 0x74, 0x99,
+    0x97, 0x77, 0x77, 0x77, 0x77, 0x5A, 0x97, 0x49, 0xA9, 0x73, 0x9E, 0xA7, 0x29, 0xE9, 0x72, 0xAF,
+    0x72, 0xFA, 0x72, 0xAF, 0x72, 0xFA, 0x72, 0x9E, 0xA7, 0x29, 0xE9, 0x74, 0xA9, 0x74, 0x9A, 0x97,
+    0x77, 0x71, 0xAF, 0xEA, 0x59, 0xE9, 0x0F, 0xFF, 0x93, 0xAE, 0x90, 0xFD, 0xAF, 0xD3, 0x9E, 0x90,
+    0xAC, 0xA5, 0x9E, 0xA2, 0x9E, 0x97, 0x29, 0xE2, 0x9E, 0x74, 0xE2, 0x9E, 0x74, 0xE9, 0x19, 0xE7,
+    0x4E, 0x3E, 0x73, 0x9E, 0x3E, 0x73, 0xEA, 0x3E, 0x72, 0xF4, 0xE7, 0x1F, 0x5E, 0x70, 0xF6, 0xE7,
+    0xF7, 0xE6, 0xF7, 0x0D, 0xA5, 0x9E, 0x71, 0xDA, 0x5A, 0xD9, 0x71, 0xDA, 0x5A, 0xD7, 0x2D, 0xA5,
+    0xE7, 0x2A, 0xCA, 0x59, 0x99, 0x72, 0x99, 0x77, 0x77, 0x77, 0x5A, 0x97, 0x29, 0xA9, 0x49, 0xEA,
+    0x70, 0xAE, 0x93, 0xAF, 0x70, 0xFA, 0x3A, 0xF7, 0x0F, 0xA3, 0x9E, 0xA7, 0x0A, 0xE9, 0x5A, 0x97,
+    0x29, 0xA9, 0x00, 0x77, 0x7A, 0xE4, 0x9A, 0xFD, 0xA4, 0xF2, 0xAF, 0xFE, 0x92, 0xF2, 0xFF, 0xFC,
+    0x91, 0xF2, 0x9C, 0xA9, 0x5F, 0x1F, 0x75, 0xE9, 0x0A, 0xE7, 0x5A, 0xDA, 0x0A, 0xDA, 0x75, 0xAD,
+    0xA0, 0xAD, 0xA7, 0x5A, 0xDA, 0x0A, 0xDA, 0x75, 0xE9, 0x0A, 0xDA, 0x74, 0xAE, 0x19, 0xDA, 0x73,
+    0xAE, 0x91, 0x9D, 0x97, 0x2A, 0xE9, 0x29, 0xD9, 0x71, 0xAE, 0x93, 0x9D, 0x97, 0x0A, 0xE9, 0x49,
+    0xD9, 0x79, 0xE7, 0xD9, 0x7E, 0x70, 0xD9, 0x69, 0xDA, 0x70, 0xD7, 0x9D, 0x97, 0x0D, 0x79, 0xD7,
+    0x19, 0x97, 0x09, 0x97, 0x77, 0x77, 0x77, 0x99, 0x70, 0x99, 0x70, 0xF6, 0xF6, 0x9F, 0x94, 0x9F,
+    0x96, 0xF9, 0x49, 0xF7, 0xF6, 0xF7, 0x09, 0x97, 0x09, 0x97, 0x77, 0x2A, 0xFF, 0xFF, 0xC9, 0xAF,
+    0xFF, 0xFC, 0x90, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xE7, 0x6E, 0x97, 0x59, 0xE7, 0x6E,
+    0x76, 0xAD, 0xA7, 0x59, 0xE7, 0x6E, 0x97, 0x5A, 0xE7, 0x6E, 0x76, 0xEA, 0x75, 0x9E, 0x76, 0xE9,
+    0x75, 0xAD, 0xA7, 0x59, 0xE7, 0x6E, 0xA7, 0x5A, 0xE7, 0x6E, 0x97, 0x5E, 0xA7, 0x20, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x96, 0x9F, 0xFF, 0xD9, 0x39, 0xDA, 0xAA, 0xFF, 0xDA, 0x29, 0xCA, 0x29,
+    0xFF, 0xDA, 0x19, 0xCA, 0x29, 0xFF, 0xE1, 0x9C, 0xA2, 0x9F, 0xFE, 0x90, 0x9C, 0xA2, 0x9F, 0xFE,
+    0xA0, 0x9C, 0xA2, 0x9F, 0xFF, 0x09, 0xCA, 0x29, 0xFF, 0xF0, 0x9C, 0xA2, 0x9F, 0xFF, 0x09, 0xCA,
+    0x29, 0xFF, 0xF0, 0x9C, 0xA2, 0x9F, 0xFF, 0x09, 0xCA, 0x29, 0xFF, 0xF0, 0x9C, 0xA2, 0x9F, 0xFE,
+    0xA0, 0x9C, 0xA2, 0x9F, 0xFE, 0x90, 0x9C, 0xA2, 0x9F, 0xFE, 0x19, 0xCA, 0x29, 0xFF, 0xD9, 0x19,
+    0xCA, 0x29, 0xFF, 0xC9, 0x29, 0xCA, 0x29, 0xFE, 0xA4, 0x9C, 0xA2, 0x9C, 0xA7, 0x29, 0xCA, 0x29,
+    0xCA, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x29, 0xCA, 0x29, 0xCA, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x29,
+    0xCA, 0x29, 0xCA, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x29, 0xCA, 0x29, 0xCA, 0x72, 0x9C, 0xA2, 0x9C,
+    0xA7, 0x29, 0xCA, 0x29, 0xCA, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x29, 0xCA, 0x29, 0xCA, 0x72, 0x9C,
+    0xA2, 0x9C, 0xA7, 0x29, 0xCA, 0x29, 0xCA, 0x72, 0x9C, 0xA2, 0x9C, 0xA7, 0x20, 0x77, 0x69, 0xFF,
+    0xFC, 0xA1, 0x9F, 0xFF, 0xEA, 0x1F, 0xFE, 0x99, 0x9D, 0xA0, 0xFF, 0xEA, 0x2A, 0xCA, 0x9F, 0xFE,
+    0xA2, 0xAC, 0xAA, 0xFF, 0xEA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF,
+    0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xFF, 0xFA, 0x2A, 0xCA, 0xAF,
+    0xFE, 0xA2, 0xAC, 0xA9, 0xFF, 0xEA, 0x2A, 0xCA, 0x0F, 0xFE, 0xA2, 0xAC, 0xA0, 0xAF, 0xFD, 0xA2,
+    0xAC, 0xA1, 0xFF, 0xFF, 0xA2, 0xAF, 0xFF, 0xDA, 0x49, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90,
+    0x77, 0x2A, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0xE9, 0x1A, 0xCA, 0x99, 0x9F, 0xFE, 0x1A, 0xCA, 0x2A,
+    0xFF, 0xE0, 0xAC, 0xA2, 0xAF, 0xFE, 0x0A, 0xCA, 0x2A, 0xFF, 0xEA, 0xAC, 0xA2, 0xAF, 0xFE, 0xAA,
+    0xCA, 0x2A, 0xFF, 0xFA, 0xCA, 0x2A, 0xFF, 0xFA, 0xCA, 0x2A, 0xFF, 0xFA, 0xCA, 0x2A, 0xFF, 0xFA,
+    0xCA, 0x2A, 0xFF, 0xFA, 0xCA, 0x2A, 0xFF, 0xEA, 0xAC, 0xA2, 0xAF, 0xFE, 0x9A, 0xCA, 0x2A, 0xFF,
+    0xE0, 0xAC, 0xA2, 0xAF, 0xFD, 0xA0, 0xAF, 0xFF, 0xF1, 0xAF, 0xFF, 0xDA, 0x29, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x94, 0x69, 0xAA, 0xA7, 0x69, 0xE7, 0x69, 0xE7, 0x69, 0xE7, 0x7D, 0xA7, 0x7D,
+    0xA7, 0x0D, 0xA9, 0x2D, 0x92, 0x9D, 0xA1, 0xFD, 0x9D, 0xAA, 0xFD, 0x09, 0xFF, 0xFF, 0xC2, 0x99,
+    0x9A, 0xAF, 0xAA, 0x99, 0x99, 0x79, 0xFC, 0x74, 0xE9, 0xDA, 0x72, 0xAD, 0x90, 0xE9, 0x70, 0x9E,
+    0x19, 0xE7, 0x0E, 0xA2, 0xF6, 0xF3, 0xAE, 0x96, 0x9C, 0xA4, 0xD7, 0x77, 0x1A, 0xA3, 0xF1, 0x9F,
+    0x90, 0x9F, 0x2F, 0x39, 0x97, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x92, 0xF2, 0xAE, 0x3E, 0x92,
+    0xEA, 0x2A, 0xDA, 0x3E, 0x3A, 0xD3, 0x9D, 0x93, 0xDA, 0x79, 0xAA, 0xAA, 0xA9, 0x74, 0xAF, 0xFC,
+    0xA7, 0x09, 0xEA, 0x99, 0x99, 0x9A, 0xE6, 0x9D, 0xA7, 0x0A, 0xD9, 0x39, 0xD9, 0x72, 0x9D, 0x3D,
+    0x75, 0x9D, 0x1A, 0xC9, 0x76, 0xAC, 0xA0, 0xAC, 0x77, 0x0C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xA7, 0x70, 0xA9, 0x0D, 0x77,
+    0x9C, 0xA1, 0xD7, 0x6D, 0x2A, 0xD7, 0x4D, 0x93, 0xAD, 0x97, 0x09, 0xDA, 0x5A, 0xE9, 0x49, 0xEA,
+    0x79, 0xFF, 0xE9, 0x72, 0x9A, 0xFC, 0xA9, 0x50, 0x69, 0xAA, 0xA7, 0x69, 0xE7, 0x69, 0xE7, 0x69,
+    0xE7, 0x7D, 0xA7, 0x7D, 0xA7, 0x0D, 0xA9, 0x2D, 0x92, 0x9D, 0xA1, 0xFD, 0x9D, 0xAA, 0xFD, 0x09,
+    0xFF, 0xFF, 0xC2, 0x99, 0x9A, 0xAF, 0xAA, 0x99, 0x99, 0x79, 0xFC, 0x74, 0xE9, 0xDA, 0x72, 0xAD,
+    0x90, 0xE9, 0x70, 0x9E, 0x19, 0xE7, 0x0E, 0xA2, 0xF6, 0xF3, 0xAE, 0x96, 0x9C, 0xA4, 0xD7, 0x77,
+    0x77, 0x71, 0x9A, 0xAA, 0x76, 0x9E, 0x76, 0x9E, 0x76, 0x9E, 0x77, 0xDA, 0x77, 0xDA, 0x70, 0xDA,
+    0x92, 0xD9, 0x29, 0xDA, 0x1F, 0xD9, 0xDA, 0xAF, 0xD0, 0x9F, 0xFF, 0xFC, 0x29, 0x99, 0xAA, 0xFA,
+    0xA9, 0x99, 0x97, 0x9F, 0xC7, 0x4E, 0x9D, 0xA7, 0x2A, 0xD9, 0x0E, 0x97, 0x09, 0xE1, 0x9E, 0x70,
+    0xEA, 0x2F, 0x6F, 0x3A, 0xE9, 0x69, 0xCA, 0x4D, 0x77, 0x70, 0x76, 0xE5, 0x9D, 0x9A, 0xEA, 0x4A,
+    0xD0, 0xAE, 0xA4, 0xE0, 0x9E, 0x93, 0x9D, 0x91, 0x99, 0x5E, 0x71, 0x9D, 0xA7, 0x1A, 0xD7, 0x2E,
+    0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA,
+    0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D,
+    0xA4, 0xE1, 0xE4, 0xAE, 0xA0, 0xDA, 0x4A, 0xEA, 0xAD, 0x94, 0x9E, 0x97, 0x29, 0x10, 0x4A, 0xFC,
+    0xAA, 0x97, 0x79, 0xC9, 0x2A, 0xFF, 0xF9, 0x74, 0xD9, 0x1A, 0xEA, 0xAA, 0xAF, 0xFC, 0xA9, 0x7E,
+    0x19, 0xDA, 0x79, 0xAF, 0xFA, 0xAA, 0xAF, 0x2A, 0xCA, 0x73, 0x9A, 0xFF, 0xF9, 0x2D, 0x77, 0x09,
+    0xAA, 0xFA, 0x93, 0x77, 0x74, 0xAF, 0xEA, 0x72, 0xAF, 0xCA, 0xFC, 0xA7, 0xEA, 0x6A, 0xE5, 0xDA,
+    0x72, 0xE3, 0xAC, 0xA7, 0x4A, 0xCA, 0x19, 0xCA, 0x76, 0xD1, 0xD7, 0x70, 0xD1, 0x97, 0x70, 0x90,
+    0x7A, 0xD7, 0x70, 0xAD, 0x73, 0xA3, 0xAD, 0x3A, 0x5A, 0xD2, 0xAD, 0x2E, 0x5E, 0x1A, 0xD1, 0xE9,
+    0x6E, 0x0A, 0xD0, 0xE9, 0x70, 0xFF, 0xC9, 0x72, 0xFE, 0x95, 0xAA, 0xAA, 0xAA, 0xFE, 0xAA, 0xAA,
+    0xAA, 0x0F, 0xFF, 0xFE, 0x0A, 0xFF, 0xFF, 0xD6, 0xFE, 0x97, 0x2F, 0xFC, 0x97, 0x0E, 0x9A, 0xD0,
+    0xE9, 0x6E, 0x90, 0xAD, 0x1E, 0x5A, 0xD9, 0x1A, 0xD2, 0xE5, 0xC9, 0x2A, 0xD3, 0xC9, 0x72, 0xAD,
+    0x77, 0x0A, 0xD7, 0x77, 0x40, 0x75, 0x97, 0x59, 0xE7, 0x4F, 0x97, 0x3F, 0x97, 0x39, 0xE7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x97, 0x5A, 0xE7, 0x4F, 0x97, 0x3F, 0x74, 0x9D, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7D, 0xA7, 0x4F, 0x97, 0x3F, 0x97, 0x3A, 0xE7,
+    0x59, 0xA9, 0x00, 0x4A, 0xD9, 0x19, 0xDA, 0x2E, 0x2A, 0xD9, 0x39, 0xE2, 0xE9, 0x1A, 0xDA, 0x2E,
+    0x4E, 0x91, 0x9D, 0xA2, 0xE2, 0xAD, 0x93, 0x9D, 0xA2, 0xE2, 0xAD, 0x92, 0xDA, 0x4E, 0x29, 0xD9,
+    0x2D, 0xA2, 0xAD, 0x49, 0xD9, 0x2E, 0x2A, 0xD3, 0xDA, 0x4E, 0x29, 0xD3, 0xDA, 0x2A, 0xD4, 0x9D,
+    0x3D, 0xA2, 0xAD, 0x3D, 0x94, 0xDA, 0x29, 0xD3, 0xD9, 0x2A, 0xCA, 0x49, 0xD3, 0xD9, 0x2A, 0xCA,
+    0x3D, 0x50, 0x75, 0x97, 0x77, 0x0A, 0xE7, 0x77, 0xF9, 0x77, 0x6F, 0x97, 0x76, 0x9E, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x97, 0x74, 0xA9, 0x1F,
+    0x77, 0x2E, 0xA0, 0xF7, 0x71, 0x9F, 0x0F, 0x77, 0x19, 0xEA, 0x09, 0xD9, 0x77, 0x2A, 0xD7, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0xA7, 0x77, 0xF7,
+    0x77, 0xF9, 0x77, 0x6A, 0xE7, 0x77, 0x09, 0xA7, 0x40, 0x29, 0x77, 0x49, 0x3A, 0xE7, 0x72, 0xEA,
+    0x1F, 0x97, 0x71, 0xF1, 0xF7, 0x72, 0xF1, 0x9D, 0xA7, 0x72, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xCA, 0x77, 0x70, 0xAE, 0x97, 0x77,
+    0xF9, 0x77, 0x7A, 0xE7, 0x77, 0x1A, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0x9D, 0x97, 0x72, 0xAC, 0xA2, 0xF7, 0x71, 0x9E, 0xA1, 0xF9, 0x77,
+    0x0A, 0xEA, 0x1F, 0x77, 0x19, 0xEA, 0x2A, 0xA7, 0x73, 0x9A, 0x91, 0x69, 0xDA, 0x1F, 0x1F, 0x90,
+    0xAE, 0x29, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xE1, 0xF1, 0xF9, 0x0A, 0xE2, 0x99,
+    0x10, 0x77, 0x76, 0x9D, 0xA7, 0x71, 0xF7, 0x71, 0xF7, 0x71, 0xF7, 0x72, 0x9A, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xDA, 0x74, 0xE1, 0xF7, 0x3A, 0xE9, 0x0F, 0x97,
+    0x2F, 0xA0, 0xAE, 0x73, 0xAE, 0x91, 0x9A, 0x75, 0x9A, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x73, 0xAE, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x1A, 0xE7, 0x72, 0x99, 0x71, 0x73,
+    0x9A, 0xA7, 0x77, 0x0A, 0xD9, 0x77, 0x7A, 0xD9, 0x77, 0x09, 0x5A, 0xD9, 0x59, 0x79, 0xE9, 0x3A,
+    0xD9, 0x39, 0xE6, 0xAE, 0xA3, 0xAD, 0x93, 0xF9, 0x5A, 0xEA, 0x3A, 0xD9, 0x3F, 0x96, 0xE9, 0x3A,
+    0xD9, 0x39, 0xE7, 0x09, 0x5A, 0xD9, 0x59, 0x77, 0x0A, 0xD9, 0x77, 0x7A, 0xD9, 0x77, 0x7A, 0xD9,
+    0x77, 0x7A, 0xD9, 0x73, 0x9F, 0xFF, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF, 0xFF, 0xD9, 0xAF, 0xFF, 0xFF,
+    0xFD, 0x97, 0x3A, 0xD9, 0x77, 0x7A, 0xD9, 0x77, 0x7A, 0xD9, 0x77, 0x7A, 0xD9, 0x77, 0x7A, 0xD9,
+    0x77, 0xE4, 0xAD, 0x93, 0xAD, 0xA6, 0xAE, 0xA3, 0xAD, 0x93, 0xF6, 0xAE, 0xA3, 0xAD, 0x93, 0xF6,
+    0x9E, 0x93, 0xAD, 0x93, 0xF7, 0x9A, 0x94, 0xAD, 0x94, 0x99, 0x77, 0x0A, 0xD9, 0x77, 0x7A, 0xD9,
+    0x77, 0x79, 0xD9, 0x73, 0x6A, 0xDA, 0x1F, 0x09, 0xF9, 0x0F, 0x19, 0xD9, 0x77, 0x77, 0x5F, 0x1F,
+    0x99, 0xF9, 0x0F, 0x19, 0xAA, 0x97, 0x77, 0x70, 0x99, 0x2F, 0x09, 0xF9, 0x0F, 0x90, 0xF2, 0x99,
+    0x10, 0x6A, 0xDA, 0x1F, 0x09, 0xF9, 0x0F, 0x19, 0xD9, 0x76, 0xAA, 0x2F, 0x09, 0xF9, 0x0F, 0x90,
+    0xF2, 0x99, 0x76, 0xAD, 0xA1, 0xF0, 0x9F, 0x90, 0xF1, 0x9D, 0x97, 0x6A, 0xA2, 0xF0, 0x9F, 0x90,
+    0xF9, 0x0F, 0x29, 0x91, 0x9F, 0xF9, 0x0A, 0xAA, 0xDA, 0xAA, 0x4D, 0x7D, 0x7D, 0x7D, 0x49, 0x99,
+    0xD9, 0x99, 0x09, 0xFF, 0x93, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x9F, 0xF9, 0x9C, 0xAA,
+    0xAA, 0xAA, 0xC9, 0x9C, 0x5C, 0x99, 0xC5, 0xC9, 0x9C, 0x5C, 0x99, 0xC5, 0xC9, 0x9C, 0x99, 0x99,
+    0x99, 0xC9, 0x9F, 0xF9, 0x3D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x30, 0x0F, 0xF1, 0xAF, 0xDA,
+    0x2F, 0xD3, 0xAF, 0xA4, 0xF5, 0xAD, 0xA6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3,
+    0x75, 0xD6, 0x9D, 0x95, 0xF4, 0x9F, 0x93, 0xFD, 0x2A, 0xFD, 0xA1, 0xFF, 0x4D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D,
+    0x7D, 0x7D, 0x7D, 0x30, 0x39, 0x96, 0xAD, 0xA4, 0xAC, 0xAA, 0xCA, 0x2A, 0xC9, 0x19, 0xCA, 0x1D,
+    0x3D, 0x2D, 0x99, 0xD4, 0xF6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD3, 0x9F, 0xA4, 0xAA,
+    0xAD, 0x7D, 0x7D, 0x7D, 0x7D, 0x49, 0x99, 0xD9, 0x99, 0x09, 0xFF, 0x93, 0xD7, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7, 0xD7,
+    0xD7, 0xD7, 0xD3, 0x3A, 0xEA, 0x59, 0xFE, 0x93, 0xEA, 0x9A, 0xE2, 0xAD, 0x92, 0x9D, 0xA1, 0xE4,
+    0xE1, 0xDA, 0x4A, 0xD1, 0xDA, 0x49, 0xD9, 0x9D, 0x94, 0x9D, 0x99, 0xD9, 0x49, 0xD9, 0x0D, 0x94,
+    0x9D, 0x90, 0xDA, 0x49, 0xD9, 0x0D, 0xA4, 0xAD, 0x1E, 0x4E, 0x19, 0xDA, 0x2A, 0xDA, 0x2F, 0xAF,
+    0x4F, 0xE6, 0x9A, 0xAA, 0x93, 0x19, 0x1D, 0x90, 0xD9, 0x70, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+    0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD4, 0x69, 0xD9, 0x70, 0xEA, 0x7F, 0xA6, 0xAF, 0xA6, 0xD9, 0xDA,
+    0x5D, 0x99, 0xDA, 0x4A, 0xD0, 0x9D, 0xA3, 0x9D, 0x19, 0xDA, 0x3D, 0x91, 0x9D, 0xA2, 0xAC, 0xA2,
+    0x9D, 0xA1, 0x9D, 0xA9, 0x99, 0xAD, 0xA9, 0x9A, 0xFF, 0xFA, 0xFF, 0xEA, 0x69, 0xDA, 0x70, 0x9D,
+    0xA7, 0x09, 0xDA, 0x71, 0x99, 0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F, 0xFC, 0x1D, 0xA9, 0x99,
+    0x99, 0x91, 0xD7, 0x0D, 0x79, 0xD7, 0x9D, 0xAA, 0xAA, 0x92, 0x9F, 0xF9, 0x1C, 0xAA, 0x9A, 0xF7,
+    0x9D, 0xA7, 0xE7, 0xAD, 0x7E, 0x95, 0x9D, 0xAE, 0xA9, 0xAA, 0xE0, 0xFF, 0xC2, 0x9A, 0xAA, 0xAA,
+    0x92, 0x49, 0xAF, 0x49, 0xFE, 0x39, 0xEA, 0x91, 0x93, 0xE7, 0x09, 0xD7, 0x1D, 0xA7, 0x1D, 0x90,
+    0xAE, 0xA3, 0xDA, 0xFE, 0x2F, 0x91, 0x9E, 0x1E, 0x49, 0xD9, 0x0D, 0x95, 0xD9, 0x0D, 0x95, 0xD9,
+    0x0D, 0xA4, 0x9D, 0x90, 0x9D, 0x93, 0xE2, 0xEA, 0x9A, 0xE9, 0x3A, 0xFD, 0xA5, 0x9A, 0xAA, 0x93,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xE0, 0xAA, 0xAA, 0xAA, 0xAA, 0xE7, 0x0D, 0xA7, 0xAD,
+    0x70, 0xDA, 0x79, 0xD7, 0x0D, 0xA7, 0x9D, 0x97, 0xE7, 0x9D, 0x97, 0xE7, 0x0D, 0x97, 0xAD, 0x70,
+    0xDA, 0x7A, 0xD7, 0x09, 0x99, 0x60, 0x3A, 0xEA, 0x94, 0x9F, 0xEA, 0x3E, 0x91, 0xAD, 0x91, 0xAD,
+    0x4D, 0xA1, 0xAD, 0x4D, 0xA1, 0x9D, 0xA2, 0x9D, 0x92, 0xEA, 0x0A, 0xDA, 0x4F, 0xDA, 0x5F, 0xE4,
+    0xE9, 0x0A, 0xE9, 0x1A, 0xD4, 0xE1, 0xDA, 0x4A, 0xD1, 0xDA, 0x49, 0xD1, 0xE4, 0xE1, 0x9E, 0xA9,
+    0xAE, 0x92, 0xAF, 0xEA, 0x59, 0xAA, 0xA9, 0x30, 0x77, 0x9F, 0xA5, 0xAF, 0xE9, 0x2A, 0xDA, 0x19,
+    0xE2, 0xDA, 0x4D, 0xA0, 0x9D, 0x94, 0x9D, 0x09, 0xD5, 0x9D, 0x09, 0xD9, 0x49, 0xD9, 0x0E, 0x4E,
+    0x90, 0xAE, 0xA9, 0xAF, 0x91, 0xAF, 0xD9, 0xD4, 0xAA, 0xA9, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0x97,
+    0x0E, 0x3A, 0x99, 0xAA, 0xE4, 0xFE, 0x5A, 0xAA, 0xAA, 0x50, 0x39, 0x97, 0x0A, 0xC9, 0x7A, 0xC9,
+    0x7A, 0xC9, 0x49, 0x99, 0xAC, 0xA9, 0x99, 0x0A, 0xFF, 0xC9, 0x9A, 0xAA, 0xEA, 0xAA, 0x4A, 0xC9,
+    0x7A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x30, 0x09, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC9, 0x9A,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA,
+    0xAA, 0xAA, 0x77, 0x6A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x71, 0xAD, 0x29, 0xD3, 0xDA, 0x29, 0xD3,
+    0xDA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAD, 0x39,
+    0xD4, 0xD9, 0x3D, 0xA3, 0x9D, 0x4D, 0x93, 0x9D, 0x4A, 0xD7, 0x69, 0xD4, 0xAD, 0x4D, 0x93, 0xAD,
+    0x4D, 0x93, 0xDA, 0x3A, 0xD3, 0x9D, 0x39, 0xD4, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0xAD, 0x3D, 0xA3,
+    0xD9, 0x29, 0xD3, 0xD9, 0x2A, 0xD2, 0x9D, 0x72, 0x73, 0xCA, 0x09, 0xFC, 0x91, 0xDA, 0xDA, 0xAE,
+    0x90, 0xE9, 0x3A, 0xD0, 0xDA, 0x5D, 0x0D, 0x95, 0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xD6,
+    0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xD6, 0xD7, 0x40, 0x3A, 0xEA, 0x59, 0xFE, 0x93, 0xEA, 0x9A, 0xE2,
+    0xAD, 0x92, 0x9D, 0xA1, 0xE4, 0xE1, 0xDA, 0x4A, 0xD1, 0xDA, 0x49, 0xD9, 0x9D, 0x94, 0x9D, 0x99,
+    0xD9, 0x49, 0xD9, 0x0D, 0x94, 0x9D, 0x90, 0xDA, 0x49, 0xD9, 0x0D, 0xA4, 0xAD, 0x1E, 0x4E, 0x19,
+    0xDA, 0x2A, 0xDA, 0x2F, 0xAF, 0x4F, 0xE6, 0x9A, 0xAA, 0x93, 0x4A, 0xAA, 0x29, 0xF1, 0xAF, 0xC0,
+    0xEA, 0xAD, 0x0D, 0x90, 0xAD, 0x09, 0x2A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A,
+    0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0x99, 0x90, 0x29, 0xFA, 0x92, 0x9F, 0xF9, 0x1A, 0xDA,
+    0x90, 0x9E, 0x2A, 0x49, 0xD9, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x9D, 0xA7, 0xE7, 0xE7, 0xE7,
+    0xE7, 0xE7, 0xDA, 0x7F, 0xFD, 0x90, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x90, 0x2A, 0xFA,
+    0x93, 0xAF, 0xF9, 0x2E, 0x91, 0x9E, 0x39, 0x49, 0xD9, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x9E, 0x4F,
+    0xDA, 0x5F, 0xDA, 0x71, 0x9E, 0x97, 0x1E, 0x71, 0xAD, 0x71, 0xE1, 0x95, 0x9D, 0xA0, 0x9D, 0xAA,
+    0x99, 0xAE, 0x19, 0xFF, 0xC9, 0x39, 0xAA, 0xAA, 0xA9, 0x30, 0x69, 0xD9, 0x70, 0xEA, 0x7F, 0xA6,
+    0xAF, 0xA6, 0xD9, 0xDA, 0x5D, 0x99, 0xDA, 0x4A, 0xD0, 0x9D, 0xA3, 0x9D, 0x19, 0xDA, 0x3D, 0x91,
+    0x9D, 0xA2, 0xAC, 0xA2, 0x9D, 0xA1, 0x9D, 0xA9, 0x99, 0xAD, 0xA9, 0x9A, 0xFF, 0xFA, 0xFF, 0xEA,
+    0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x71, 0x99, 0x20, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x1F,
+    0xFC, 0x1D, 0xA9, 0x99, 0x99, 0x91, 0xD7, 0x0D, 0x79, 0xD7, 0x9D, 0xAA, 0xAA, 0x92, 0x9F, 0xF9,
+    0x1C, 0xAA, 0x9A, 0xF7, 0x9D, 0xA7, 0xE7, 0xAD, 0x7E, 0x95, 0x9D, 0xAE, 0xA9, 0xAA, 0xE0, 0xFF,
+    0xC2, 0x9A, 0xAA, 0xAA, 0x92, 0x49, 0xAF, 0x49, 0xFE, 0x39, 0xEA, 0x91, 0x93, 0xE7, 0x09, 0xD7,
+    0x1D, 0xA7, 0x1D, 0x90, 0xAE, 0xA3, 0xDA, 0xFE, 0x2F, 0x91, 0x9E, 0x1E, 0x49, 0xD9, 0x0D, 0x95,
+    0xD9, 0x0D, 0x95, 0xD9, 0x0D, 0xA4, 0x9D, 0x90, 0x9D, 0x93, 0xE2, 0xEA, 0x9A, 0xE9, 0x3A, 0xFD,
+    0xA5, 0x9A, 0xAA, 0x93, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xE0, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xE7, 0x0D, 0xA7, 0xAD, 0x70, 0xDA, 0x79, 0xD7, 0x0D, 0xA7, 0x9D, 0x97, 0xE7, 0x9D, 0x97, 0xE7,
+    0x0D, 0x97, 0xAD, 0x70, 0xDA, 0x7A, 0xD7, 0x09, 0x99, 0x60, 0x3A, 0xEA, 0x94, 0x9F, 0xEA, 0x3E,
+    0x91, 0xAD, 0x91, 0xAD, 0x4D, 0xA1, 0xAD, 0x4D, 0xA1, 0x9D, 0xA2, 0x9D, 0x92, 0xEA, 0x0A, 0xDA,
+    0x4F, 0xDA, 0x5F, 0xE4, 0xE9, 0x0A, 0xE9, 0x1A, 0xD4, 0xE1, 0xDA, 0x4A, 0xD1, 0xDA, 0x49, 0xD1,
+    0xE4, 0xE1, 0x9E, 0xA9, 0xAE, 0x92, 0xAF, 0xEA, 0x59, 0xAA, 0xA9, 0x30, 0x77, 0x9F, 0xA5, 0xAF,
+    0xE9, 0x2A, 0xDA, 0x19, 0xE2, 0xDA, 0x4D, 0xA0, 0x9D, 0x94, 0x9D, 0x09, 0xD5, 0x9D, 0x09, 0xD9,
+    0x49, 0xD9, 0x0E, 0x4E, 0x90, 0xAE, 0xA9, 0xAF, 0x91, 0xAF, 0xD9, 0xD4, 0xAA, 0xA9, 0x09, 0xD7,
+    0x1A, 0xD7, 0x1D, 0x97, 0x0E, 0x3A, 0x99, 0xAA, 0xE4, 0xFE, 0x5A, 0xAA, 0xAA, 0x50, 0x39, 0x97,
+    0x0A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x49, 0x99, 0xAC, 0xA9, 0x99, 0x0A, 0xFF, 0xC9, 0x9A, 0xAA,
+    0xEA, 0xAA, 0x4A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x7A, 0xC9, 0x30, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x0A, 0xFF, 0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x0A, 0xFF,
+    0xC9, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0x77, 0x6A, 0xFF, 0xC9, 0xAF, 0xFC, 0x90, 0x71, 0xAD, 0x29,
+    0xD3, 0xDA, 0x29, 0xD3, 0xDA, 0x3D, 0x92, 0x9D, 0x3A, 0xD3, 0xAC, 0xA3, 0xAC, 0xA3, 0xAC, 0xA3,
+    0xAC, 0xA3, 0xAD, 0x39, 0xD4, 0xD9, 0x3D, 0xA3, 0x9D, 0x4D, 0x93, 0x9D, 0x4A, 0xD7, 0x69, 0xD4,
+    0xAD, 0x4D, 0x93, 0xAD, 0x4D, 0x93, 0xDA, 0x3A, 0xD3, 0x9D, 0x39, 0xD4, 0xD4, 0xD3, 0x9D, 0x39,
+    0xD3, 0xAD, 0x3D, 0xA3, 0xD9, 0x29, 0xD3, 0xD9, 0x2A, 0xD2, 0x9D, 0x72, 0x29, 0xAA, 0xAA, 0x93,
+    0xFE, 0xA2, 0xA9, 0x29, 0xD9, 0x7A, 0xCA, 0x79, 0xCA, 0x29, 0x9A, 0xAA, 0xDA, 0x09, 0xFF, 0xA9,
+    0xD9, 0x39, 0xCA, 0xDA, 0x4A, 0xCA, 0xD9, 0x4D, 0xAA, 0xD3, 0xAD, 0xA0, 0xFE, 0x9C, 0xA1, 0xAD,
+    0xA9, 0x1A, 0x90, 0x39, 0xAA, 0xA5, 0x9F, 0xDA, 0x29, 0xD9, 0x2D, 0xA1, 0xD5, 0xD0, 0x9D, 0x5D,
+    0x9A, 0xDA, 0xAA, 0xAA, 0xAD, 0x9A, 0xFF, 0xD9, 0xAC, 0xA7, 0x09, 0xD7, 0x1D, 0x97, 0x0A, 0xD9,
+    0x49, 0x2A, 0xFF, 0x4A, 0xAD, 0xAA, 0x10, 0x39, 0xAA, 0xA9, 0x5A, 0xFE, 0x92, 0x9D, 0x92, 0xAD,
+    0x2D, 0x94, 0xAD, 0x09, 0xD6, 0xD0, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9, 0xAC, 0xA6, 0xD9, 0x9D,
+    0x6D, 0x1D, 0x59, 0xD1, 0xAD, 0x39, 0xD9, 0x2A, 0xFE, 0x95, 0xAD, 0xAA, 0x30, 0x09, 0x96, 0x99,
+    0x1A, 0xD4, 0xD9, 0x2D, 0xA2, 0xAC, 0xA4, 0xD9, 0x09, 0xD5, 0x9D, 0x9D, 0x7A, 0xE9, 0x70, 0xE7,
+    0x0A, 0xEA, 0x69, 0xD0, 0xD9, 0x5D, 0x19, 0xD4, 0xD9, 0x2A, 0xD2, 0xAC, 0xA4, 0xDA, 0x1A, 0xA6,
+    0xAA, 0x00, 0x19, 0xAA, 0xAA, 0x94, 0xFF, 0x3A, 0x93, 0xAD, 0x71, 0xAD, 0x71, 0xD7, 0x1D, 0x9A,
+    0xFF, 0xD9, 0xFF, 0xE9, 0xAC, 0xA5, 0xD0, 0x9D, 0x49, 0xD1, 0xDA, 0x29, 0xD9, 0x2F, 0xE9, 0x49,
+    0xAD, 0xA3, 0x9A, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD1, 0x9A, 0xAA, 0x92, 0xD9, 0xFE,
+    0x1E, 0xA2, 0x9D, 0xA0, 0xE4, 0x9D, 0x0D, 0x95, 0xD0, 0xD9, 0x5D, 0x0D, 0x6D, 0x0D, 0x6D, 0x0D,
+    0x6D, 0x0D, 0x6D, 0x0D, 0x6D, 0x0D, 0x6D, 0x0A, 0xA6, 0xAA, 0x00, 0x9A, 0x70, 0xD7, 0x0D, 0x70,
+    0xD7, 0x0D, 0x70, 0xD5, 0x99, 0x0D, 0x4D, 0x90, 0xD3, 0xD9, 0x1D, 0x2D, 0x92, 0xD1, 0xD9, 0x3D,
+    0x9D, 0x94, 0xFD, 0x4E, 0x0D, 0xA3, 0xD2, 0xD9, 0x2D, 0x29, 0xD9, 0x1D, 0x39, 0xD1, 0xD4, 0xAD,
+    0x0A, 0xA5, 0xAA, 0x90, 0x9A, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0A, 0xA0, 0x99, 0x19, 0xAA, 0xA3, 0x9A, 0xAA, 0x91, 0xD9, 0xFD,
+    0xA0, 0xFE, 0x0E, 0xA2, 0xAF, 0x29, 0xD9, 0xE4, 0xE4, 0xAC, 0xAD, 0x94, 0xAC, 0xA4, 0x9F, 0x5A,
+    0xCA, 0x49, 0xF5, 0xAC, 0x94, 0x9F, 0x5A, 0xC9, 0x49, 0xF5, 0xAC, 0x94, 0x9F, 0x5A, 0xC9, 0x49,
+    0xF5, 0xAC, 0x94, 0x9F, 0x5A, 0xC9, 0x49, 0xDA, 0xA5, 0x9A, 0x95, 0xA9, 0x99, 0x19, 0xAA, 0xA9,
+    0x2D, 0x0F, 0xE1, 0xEA, 0x29, 0xDA, 0x0E, 0x49, 0xD0, 0xD9, 0x5D, 0x0D, 0x95, 0xD0, 0xD6, 0xD0,
+    0xD6, 0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xD6, 0xD0, 0xAA, 0x6A, 0xA0, 0x99, 0x19, 0xAA,
+    0xA9, 0x2D, 0x0F, 0xDA, 0x1E, 0xA2, 0x9D, 0xA0, 0xE4, 0x9D, 0x0D, 0x95, 0xD9, 0xD6, 0xAC, 0xAD,
+    0x6A, 0xCA, 0xD6, 0xAC, 0xAD, 0x95, 0xD9, 0xE5, 0xD0, 0xEA, 0x3D, 0xA0, 0xDA, 0xFE, 0x1D, 0x1A,
+    0xDA, 0x92, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x10, 0x19, 0xAA, 0xAA, 0x92, 0xFF, 0x0A,
+    0xCA, 0x39, 0x90, 0xD9, 0x6A, 0xD7, 0xEA, 0x95, 0x9F, 0xA6, 0xAE, 0x7D, 0x96, 0xAC, 0xA9, 0x94,
+    0xD9, 0xAF, 0xEA, 0x19, 0xAE, 0xA9, 0x10, 0x73, 0xC9, 0x59, 0xC9, 0x49, 0xDA, 0x99, 0x90, 0xAF,
+    0xE2, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5A, 0xC9, 0x5A, 0xD6, 0xFC,
+    0x93, 0xAD, 0xA0, 0x77, 0x79, 0xAF, 0xCA, 0x97, 0x1A, 0xFF, 0xC7, 0x0A, 0xF9, 0x99, 0xAC, 0xA7,
+    0x9E, 0xA7, 0x6E, 0xA7, 0x7E, 0x77, 0x9E, 0x77, 0xAD, 0xA7, 0x7A, 0xDA, 0x4A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xA0, 0xAD, 0xA4, 0xFF, 0xD0, 0xAD, 0xA4, 0xFF, 0xD0, 0xAE, 0x4E, 0x96, 0x9E, 0x4E, 0x97,
+    0xE9, 0x3E, 0x97, 0xAE, 0x3E, 0x97, 0x0F, 0x91, 0xE9, 0x70, 0x9F, 0xFF, 0xEA, 0x4A, 0xFF, 0xFC,
+    0xA6, 0x99, 0xAE, 0xAA, 0xAA, 0xAA, 0x97, 0x1E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x7E,
+    0x97, 0x7E, 0xAA, 0xAA, 0xAA, 0xA7, 0x1F, 0xFD, 0x71, 0xFF, 0xD0, 0x71, 0x99, 0x92, 0x99, 0x73,
+    0xD9, 0x1A, 0xD7, 0x3D, 0x2D, 0xA7, 0x29, 0xD9, 0x99, 0xD9, 0x70, 0x9F, 0xFD, 0x95, 0x9F, 0xFF,
+    0xCA, 0x3A, 0xFD, 0xA9, 0x9F, 0xC3, 0x9F, 0xAD, 0x2D, 0xA9, 0xA3, 0xF0, 0x9D, 0x2D, 0x94, 0xAE,
+    0x1A, 0xD2, 0xD5, 0xE9, 0x1D, 0xA1, 0x9D, 0x4A, 0xE2, 0xD9, 0x1A, 0xD4, 0xEA, 0x2D, 0x2D, 0xA4,
+    0xE9, 0x19, 0xD2, 0xD9, 0x4E, 0x91, 0xAC, 0xA2, 0xD5, 0xE2, 0xDA, 0x19, 0xD5, 0xE2, 0xD9, 0x1A,
+    0xD5, 0xE9, 0x09, 0xD2, 0xDA, 0x5E, 0x90, 0x9D, 0x2D, 0x95, 0xAD, 0xA0, 0xAC, 0xA2, 0xD6, 0x9E,
+    0x0D, 0xA1, 0x9D, 0x7E, 0xAD, 0x91, 0xAD, 0x7A, 0xFC, 0x2D, 0xA7, 0x0F, 0xC2, 0xD9, 0x70, 0x9F,
+    0xC9, 0x9D, 0x29, 0xAA, 0x49, 0xFF, 0xFC, 0xA5, 0xFF, 0xFC, 0xA4, 0x9D, 0x09, 0xAF, 0xCA, 0x96,
+    0x9D, 0x2D, 0x97, 0x2A, 0xCA, 0x2D, 0x73, 0xD9, 0x19, 0xD7, 0x77, 0x30, 0x77, 0x71, 0xAF, 0xEA,
+    0x96, 0xAF, 0xFF, 0x4F, 0xDA, 0xAA, 0xFA, 0x3F, 0xA6, 0xAC, 0x3A, 0xEA, 0x75, 0xEA, 0x75, 0xAE,
+    0x76, 0xE9, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xAD, 0xA4, 0x99, 0x2A, 0xAA, 0x90, 0xEA, 0x3A, 0xD0,
+    0xAF, 0xA0, 0xE9, 0x3A, 0xDA, 0xFC, 0xA0, 0xE9, 0x3A, 0xFA, 0x90, 0x91, 0xE9, 0x3A, 0xEA, 0x5E,
+    0x93, 0xAE, 0x6A, 0xDA, 0x3A, 0xDA, 0x6A, 0xE3, 0xAD, 0x96, 0x9E, 0x3A, 0xD9, 0x7E, 0x92, 0xAD,
+    0x97, 0xF2, 0xAD, 0x97, 0x9E, 0x91, 0xAD, 0x97, 0x0F, 0x1A, 0xD9, 0x70, 0x9F, 0x9A, 0xD9, 0x39,
+    0x4A, 0xFE, 0xAA, 0xAE, 0x59, 0xFF, 0xF7, 0xAF, 0xFC, 0xA7, 0x29, 0x99, 0x95, 0x3F, 0xFF, 0xD9,
+    0x3F, 0xFF, 0xD9, 0x3F, 0xFF, 0xD9, 0x3E, 0x97, 0x6E, 0x77, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x77,
+    0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0xFF, 0xFC, 0xA4, 0xFF, 0xFC,
+    0xA4, 0xEA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x4E, 0x77, 0xE7, 0x7E, 0x74, 0x99, 0x9E, 0x99, 0x99,
+    0x99, 0x59, 0xFF, 0xF5, 0x9F, 0xFF, 0x71, 0xE9, 0x76, 0xE7, 0x7E, 0x77, 0xE7, 0x7E, 0x73, 0x77,
+    0x72, 0x9A, 0xFD, 0xA9, 0x70, 0xAF, 0xFE, 0x6A, 0xFC, 0xAA, 0xFA, 0x6E, 0xA5, 0x9A, 0x95, 0xAE,
+    0x77, 0xEA, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x77, 0xE9, 0x73, 0x99, 0x99, 0xEA, 0x99, 0x99,
+    0x99, 0x94, 0xAF, 0xFF, 0xD4, 0xAF, 0xFF, 0xD7, 0x0E, 0x97, 0x7E, 0x97, 0x7E, 0x97, 0x3A, 0xFF,
+    0xFD, 0x4A, 0xFF, 0xFD, 0x49, 0x99, 0x9E, 0xA9, 0x99, 0x99, 0x99, 0x70, 0xE7, 0x70, 0xE7, 0x7A,
+    0xE7, 0x7E, 0x97, 0x6E, 0x97, 0x5A, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x77,
+    0x19, 0xD7, 0x77, 0x2D, 0xA7, 0x77, 0x19, 0xD9, 0x77, 0x71, 0xE7, 0x71, 0x99, 0x99, 0x39, 0xD9,
+    0x99, 0x99, 0x5E, 0x19, 0xFE, 0xA1, 0xFF, 0xD9, 0x2E, 0x0A, 0xFF, 0xCA, 0x0F, 0xFE, 0xA1, 0xEA,
+    0xDA, 0x99, 0x9A, 0xFF, 0xA9, 0x99, 0xAF, 0x1F, 0xC9, 0x5F, 0xD5, 0x9E, 0xA0, 0xF9, 0x69, 0xF7,
+    0xAE, 0x0F, 0x70, 0xEA, 0x79, 0xE0, 0xF7, 0x0E, 0x97, 0x9E, 0x0E, 0xA7, 0x0E, 0x97, 0x0E, 0x0E,
+    0xA7, 0x9E, 0x71, 0xE0, 0xE9, 0x7F, 0x71, 0xE0, 0xE9, 0x69, 0xF7, 0x1E, 0x0E, 0x96, 0xFC, 0x71,
+    0xE0, 0xE9, 0x59, 0xFC, 0x71, 0xE0, 0xE9, 0x5F, 0xD7, 0x1E, 0x0E, 0x94, 0x9D, 0x9E, 0x71, 0xE0,
+    0xE9, 0x4A, 0xD0, 0xE7, 0x1E, 0x0E, 0x94, 0xD9, 0x0E, 0x71, 0xE0, 0xE9, 0x3A, 0xD1, 0xE7, 0x1E,
+    0x0E, 0x93, 0xD9, 0x1E, 0x71, 0xE0, 0xE9, 0x2A, 0xD2, 0xE7, 0x1E, 0x7D, 0xA7, 0x77, 0x1A, 0xD7,
+    0x77, 0x2D, 0xA7, 0x77, 0x19, 0xD7, 0x77, 0x77, 0x73, 0x2A, 0xE9, 0x6A, 0xD6, 0xAE, 0xA6, 0xE6,
+    0xAF, 0x6E, 0x6A, 0xF9, 0x5E, 0x6A, 0xFC, 0x5E, 0x6A, 0xDA, 0xD5, 0xE6, 0xAD, 0x9D, 0xA4, 0xE6,
+    0xAD, 0x0E, 0x4E, 0x6A, 0xD0, 0xAD, 0x93, 0xE3, 0x9A, 0xAE, 0xAA, 0xEA, 0xAA, 0xAE, 0xAA, 0xA0,
+    0xAF, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0xF3, 0xAD, 0x2E, 0x2E, 0x6A, 0xD2, 0xE2, 0xE6, 0xAD, 0x29,
+    0xDA, 0x1E, 0x3A, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xFF, 0x19, 0x9E, 0xA9, 0x99, 0xAE, 0x9E, 0x99,
+    0x93, 0xAD, 0x4E, 0x0E, 0x6A, 0xD4, 0xAD, 0x9A, 0xD6, 0xAD, 0x5E, 0xAD, 0x6A, 0xD5, 0xFD, 0x6A,
+    0xD5, 0x9F, 0xC6, 0xAD, 0x6F, 0xC6, 0xAD, 0x6A, 0xF6, 0xAD, 0x69, 0xF6, 0xAD, 0x7F, 0x30, 0x0F,
+    0xDA, 0xA9, 0x77, 0x0F, 0xFE, 0x76, 0xFF, 0xF9, 0x74, 0xE3, 0x9F, 0xC7, 0x4E, 0x59, 0xEA, 0x73,
+    0xE6, 0xAE, 0x73, 0xE6, 0x9E, 0x73, 0xE7, 0xE9, 0x29, 0x95, 0xE7, 0xE9, 0x2D, 0x5E, 0x7E, 0x29,
+    0xD5, 0xE6, 0x9E, 0x2A, 0xD5, 0xE6, 0xEA, 0x1A, 0xEA, 0x99, 0x91, 0xE5, 0xF9, 0xAF, 0xFC, 0x90,
+    0xE9, 0x99, 0xAA, 0xFA, 0x0F, 0xFD, 0x90, 0xFF, 0xEA, 0x4E, 0x5F, 0xFC, 0xA9, 0x5E, 0x5E, 0xAA,
+    0xA9, 0x97, 0x0E, 0x5E, 0x75, 0xE5, 0xE7, 0x5E, 0x5E, 0x75, 0xE5, 0xE7, 0x5E, 0x5E, 0x75, 0xE5,
+    0xE7, 0x5E, 0x5E, 0x75, 0xE9, 0x4E, 0x75, 0xAE, 0x99, 0x99, 0x0E, 0x76, 0xFE, 0x0E, 0x76, 0x9F,
+    0xCA, 0x77, 0x49, 0x99, 0x10, 0xAF, 0xCA, 0xA9, 0x77, 0x1F, 0xFD, 0xA7, 0x7F, 0xFF, 0x76, 0xE9,
+    0x29, 0xAE, 0xA7, 0x5E, 0x94, 0xAE, 0x75, 0xE9, 0x5E, 0x97, 0x4E, 0x95, 0xEA, 0x59, 0x99, 0x92,
+    0xE9, 0x5A, 0xDA, 0x3F, 0xEA, 0x0E, 0x95, 0xAD, 0xA2, 0xFF, 0xC9, 0xE9, 0x5E, 0xA1, 0xF9, 0x09,
+    0xAD, 0x0E, 0x95, 0xE9, 0x1E, 0x7E, 0x94, 0xAE, 0x19, 0xE7, 0xE9, 0x3A, 0xE9, 0x19, 0xE7, 0xFF,
+    0xEA, 0x3E, 0xA6, 0xFF, 0xDA, 0x4F, 0xA5, 0xFF, 0xD6, 0xFC, 0x93, 0xE9, 0x2E, 0x96, 0xFD, 0x2E,
+    0x92, 0xAE, 0x7A, 0xFC, 0x1E, 0x93, 0xE7, 0x1A, 0xF0, 0xE9, 0x3E, 0xA7, 0x1A, 0xE9, 0xE9, 0x39,
+    0xE7, 0x2A, 0xDA, 0xE9, 0x4E, 0xA7, 0x19, 0xDA, 0xE9, 0x4A, 0xE7, 0x1A, 0xDA, 0xE9, 0x5E, 0x90,
+    0x99, 0x5E, 0x9E, 0x95, 0xAE, 0x0A, 0xDA, 0x99, 0x9F, 0x0E, 0x96, 0xE9, 0xAF, 0xFC, 0x90, 0xE9,
+    0x6E, 0xA0, 0xAF, 0xE9, 0x77, 0x49, 0x99, 0x40, 0x0D, 0xA6, 0xE9, 0x59, 0xD9, 0x0E, 0x59, 0xEA,
+    0x5A, 0xD1, 0xE5, 0xAF, 0x5E, 0x1E, 0x5A, 0xF5, 0xE1, 0xAD, 0x94, 0xFC, 0x5D, 0xA1, 0x9D, 0xA4,
+    0xD9, 0xD9, 0x39, 0xDA, 0x2D, 0xA3, 0x9D, 0x0D, 0xA3, 0x9D, 0x92, 0xE3, 0x9D, 0x0D, 0xA3, 0xAD,
+    0x3E, 0x3A, 0xD0, 0xAD, 0x3E, 0x3A, 0xD3, 0xDA, 0x09, 0xD3, 0xE3, 0xAD, 0x92, 0xDA, 0x09, 0xD9,
+    0x2E, 0x39, 0xD9, 0x2D, 0x91, 0xD9, 0x2D, 0xA1, 0xAF, 0xFF, 0xFF, 0xEA, 0xAF, 0xFF, 0xFF, 0xF9,
+    0xAA, 0xEA, 0xAE, 0xAA, 0xAE, 0xAA, 0xEA, 0xA9, 0x2A, 0xD1, 0xDA, 0x29, 0xD1, 0xE5, 0xAD, 0x1D,
+    0xA3, 0xD9, 0x0D, 0xA5, 0x9D, 0x90, 0xD9, 0x3D, 0x90, 0xDA, 0x6D, 0x99, 0xD4, 0xDA, 0x0D, 0x96,
+    0xDA, 0x9D, 0x4A, 0xCA, 0x9D, 0x96, 0xDA, 0xAD, 0x4A, 0xD9, 0xD7, 0xAD, 0xAC, 0xA4, 0x9D, 0xAD,
+    0x79, 0xFA, 0x5F, 0xC7, 0x9F, 0x95, 0xFA, 0x70, 0xF6, 0xF9, 0x70, 0xF6, 0xAE, 0x97, 0x0A, 0xE6,
+    0x9E, 0x40, 0xAF, 0xFC, 0xA9, 0x70, 0xDA, 0xFF, 0xFC, 0xA6, 0xFF, 0xFF, 0xD5, 0xFD, 0x7A, 0xEA,
+    0x4F, 0xD7, 0x09, 0xE4, 0xFD, 0x71, 0xE9, 0x3F, 0xD7, 0x19, 0xDA, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD,
+    0x3E, 0x3E, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x3E, 0x3E, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x3E, 0x3E,
+    0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x3E, 0x3E, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x3E, 0x3E, 0x3F, 0xD3,
+    0xE3, 0xE3, 0xFD, 0x3E, 0x3E, 0x3F, 0xD3, 0xE3, 0xE3, 0xFD, 0x3E, 0x71, 0x9D, 0xAE, 0x3E, 0x71,
+    0xAD, 0xAE, 0x3E, 0x70, 0x9E, 0x0E, 0x3E, 0x79, 0xEA, 0x0E, 0x3E, 0xAA, 0xAA, 0xAA, 0xAF, 0xC1,
+    0xE3, 0xFF, 0xFD, 0x2E, 0x3F, 0xFE, 0xA9, 0x30, 0x76, 0xAA, 0x97, 0x70, 0x9E, 0x77, 0x09, 0xE7,
+    0x70, 0xAE, 0x70, 0x9F, 0xFF, 0xCA, 0x59, 0xFF, 0xFC, 0xA6, 0x99, 0x99, 0x99, 0x9A, 0xE9, 0x97,
+    0x69, 0xE7, 0x19, 0x99, 0x39, 0xE6, 0x9F, 0xE9, 0x09, 0xE5, 0xFF, 0xDA, 0x9E, 0x4F, 0xCA, 0x99,
+    0xAE, 0xAE, 0x3A, 0xEA, 0x59, 0xFC, 0x3F, 0x7A, 0xF2, 0x9E, 0x97, 0x0F, 0x2A, 0xE7, 0x1F, 0x2E,
+    0xA7, 0x1A, 0xE2, 0xEA, 0x71, 0x9E, 0x2E, 0xA7, 0x19, 0xE2, 0xEA, 0x71, 0x9E, 0x2E, 0xA7, 0x19,
+    0xE2, 0xEA, 0x71, 0xAE, 0x2A, 0xE7, 0x1A, 0xE2, 0x9E, 0x71, 0xF3, 0xEA, 0x79, 0xF3, 0xAE, 0xA5,
+    0x9F, 0xC4, 0xFC, 0xA9, 0x9A, 0xEA, 0xE5, 0xFF, 0xD9, 0x0E, 0x69, 0xFE, 0x91, 0xE7, 0x19, 0x99,
+    0x77, 0x77, 0x77, 0x69, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3A, 0xFF, 0xFF, 0x3A,
+    0xFF, 0xFF, 0x10, 0x77, 0x76, 0x9F, 0xE9, 0x71, 0x9F, 0xFE, 0xA6, 0xAF, 0xFF, 0xA5, 0xAF, 0x94,
+    0x9D, 0x59, 0xEA, 0x77, 0xF7, 0x79, 0xE9, 0x77, 0xAE, 0x77, 0x0E, 0xA7, 0x70, 0xE9, 0x75, 0xFF,
+    0xFE, 0x94, 0xFF, 0xFE, 0x94, 0x99, 0xAE, 0x99, 0x99, 0x99, 0x99, 0x97, 0x9E, 0x77, 0x09, 0xE7,
+    0x6A, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x6F, 0xFF, 0xD6, 0xFF, 0xFD, 0x71, 0xE9, 0x77, 0x0A, 0xDA,
+    0x77, 0x09, 0xE7, 0x71, 0xEA, 0x77, 0x09, 0xEA, 0x77, 0x0F, 0xA7, 0xA7, 0xFD, 0xAA, 0xAA, 0xE7,
+    0x0F, 0xFF, 0x71, 0x9F, 0xFA, 0x97, 0x49, 0x99, 0x94, 0x3E, 0x71, 0xAD, 0xA4, 0xE7, 0x0A, 0xE5,
+    0xE7, 0x9E, 0x6E, 0x69, 0xE9, 0x6E, 0x6E, 0xA7, 0xE5, 0xEA, 0x70, 0xE4, 0xAE, 0x71, 0xE3, 0x9E,
+    0x72, 0xE3, 0xE9, 0x72, 0xE2, 0xEA, 0x73, 0xE1, 0xEA, 0x74, 0xE0, 0xAE, 0x71, 0x9F, 0xFF, 0xFD,
+    0x29, 0xFF, 0xFF, 0xD3, 0x99, 0xAF, 0xFC, 0x99, 0x99, 0x99, 0x6F, 0x1E, 0x97, 0x3E, 0x91, 0xAE,
+    0x73, 0xE3, 0xEA, 0x72, 0xE4, 0xE9, 0x71, 0xE4, 0x9E, 0x71, 0xE5, 0xF7, 0x0E, 0x6E, 0xA7, 0xE6,
+    0x9E, 0x96, 0xE7, 0xAE, 0x6E, 0x70, 0xEA, 0x5E, 0x70, 0x9E, 0x94, 0xE7, 0x1A, 0xE0, 0x0F, 0xFF,
+    0xFE, 0xA9, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF7, 0x0E, 0xA7, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70,
+    0xE9, 0x29, 0x74, 0xE9, 0x1D, 0xA7, 0x3E, 0x99, 0xEA, 0x73, 0xFE, 0x97, 0x4F, 0xD7, 0x59, 0xFA,
+    0x75, 0xAF, 0x97, 0x49, 0xFD, 0x92, 0xC7, 0xAE, 0xAE, 0x90, 0x9E, 0x59, 0xE9, 0x0E, 0xAA, 0xE9,
+    0x6C, 0xA2, 0xFE, 0x75, 0xFC, 0xA7, 0x5A, 0xF7, 0x59, 0xFC, 0x97, 0x4A, 0xFD, 0x97, 0x3F, 0x0E,
+    0x97, 0x3D, 0xA1, 0xE9, 0x73, 0x99, 0x2E, 0x97, 0x70, 0xE9, 0x77, 0x0E, 0x97, 0x70, 0xE9, 0x70,
+    0x77, 0x77, 0x59, 0xAF, 0xFA, 0x97, 0x76, 0xFF, 0xFD, 0xA7, 0x74, 0xAF, 0xCA, 0xAA, 0xFE, 0x77,
+    0x4C, 0x97, 0x9F, 0xC7, 0x77, 0x7A, 0xF7, 0x76, 0x9A, 0xA9, 0x49, 0xEA, 0x77, 0x5E, 0x95, 0xAE,
+    0x77, 0x5E, 0x7E, 0x97, 0x73, 0x9E, 0x7E, 0xA7, 0x73, 0xAD, 0xA7, 0xAE, 0x77, 0x3E, 0x97, 0x9E,
+    0x77, 0x3E, 0x70, 0x9E, 0x77, 0x3E, 0x70, 0xAE, 0x77, 0x29, 0xE7, 0x0A, 0xE7, 0x72, 0xAD, 0xA7,
+    0x0A, 0xDA, 0x59, 0x99, 0x97, 0x0E, 0x97, 0x0E, 0xA3, 0x9F, 0xDA, 0x6E, 0x70, 0x9E, 0x92, 0xAF,
+    0xFC, 0x49, 0xE7, 0x0A, 0xE2, 0x9E, 0xA9, 0x09, 0xEA, 0x39, 0xE7, 0x0E, 0xA2, 0xE9, 0x3A, 0xE3,
+    0xAD, 0xA7, 0xAE, 0x29, 0xE4, 0x9E, 0x3E, 0x96, 0x9E, 0xA2, 0xE9, 0x5E, 0x3E, 0x69, 0xF3, 0xE5,
+    0x9E, 0x29, 0xE5, 0xAF, 0x4E, 0x5E, 0xA2, 0xAD, 0xA2, 0x9A, 0xFC, 0x49, 0xE4, 0xAE, 0x3F, 0xFF,
+    0xA5, 0xAF, 0x99, 0x9A, 0xEA, 0x3F, 0xFD, 0xA7, 0xFF, 0xEA, 0x4F, 0xEA, 0x97, 0x1E, 0x9F, 0xD9,
+    0x77, 0x79, 0xE1, 0x99, 0x97, 0x77, 0x29, 0xDA, 0x77, 0x77, 0xAD, 0xA7, 0x77, 0x7E, 0x97, 0x77,
+    0x7E, 0x77, 0x77, 0x9E, 0x77, 0x77, 0xAD, 0xA7, 0x77, 0x7E, 0x97, 0x77, 0x7E, 0x75, 0x77, 0x76,
+    0x9F, 0xA7, 0x4A, 0xFE, 0x72, 0x9E, 0xA9, 0xEA, 0x71, 0xAD, 0x92, 0xE7, 0x1E, 0x3E, 0x71, 0xE3,
+    0xE9, 0x70, 0xE3, 0xE7, 0x1E, 0x3E, 0x71, 0xE9, 0x2E, 0x71, 0xAD, 0xA1, 0x9D, 0xA7, 0x19, 0xE1,
+    0xAD, 0x97, 0x2E, 0x1E, 0x73, 0xE9, 0x9D, 0x97, 0x39, 0xFD, 0x75, 0xFC, 0xA7, 0x5A, 0xF7, 0x7E,
+    0x97, 0x09, 0x5E, 0x97, 0x0C, 0xA3, 0xFC, 0x79, 0xD2, 0x9F, 0xC9, 0x6E, 0xA1, 0xEA, 0xDA, 0x5A,
+    0xF9, 0xAD, 0x90, 0xE5, 0xFF, 0xC1, 0xAD, 0x93, 0xAD, 0x99, 0xF2, 0x9E, 0x3E, 0x1E, 0xA3, 0xE2,
+    0xAD, 0x91, 0x9D, 0x4A, 0xDA, 0x09, 0xE3, 0xAA, 0x49, 0xE7, 0x70, 0xE7, 0x70, 0xE7, 0x70, 0xAD,
+    0x97, 0x7A, 0xD9, 0x77, 0xE7, 0x79, 0xE7, 0x3C, 0xAA, 0xAE, 0xA7, 0x3F, 0xDA, 0x74, 0xFC, 0x92,
+    0x29, 0xFD, 0xAA, 0xA7, 0x39, 0xFF, 0xE9, 0x70, 0x9F, 0xFF, 0x97, 0x9E, 0x4A, 0xF9, 0x69, 0xE6,
+    0xF3, 0x99, 0x9A, 0xE9, 0x99, 0x99, 0x99, 0xAE, 0xA9, 0x90, 0xAF, 0xFF, 0xFF, 0x09, 0xAA, 0xAE,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xA3, 0x9E, 0x7A, 0xDA, 0x59, 0xE7, 0xAD, 0xA5, 0x9E, 0x7A, 0xDA,
+    0x2A, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xFF, 0x39, 0xE6, 0xF6, 0x9E, 0x5F, 0x79, 0xEA, 0xAA, 0xAF,
+    0xC9, 0x79, 0xFF, 0xE9, 0x70, 0x9F, 0xFC, 0x97, 0x29, 0xE9, 0x97, 0x79, 0xE7, 0x71, 0x9E, 0x77,
+    0x19, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x77, 0x19, 0xE7, 0x71, 0x9E, 0x76, 0x73,
+    0x99, 0x77, 0x4D, 0x97, 0x79, 0xAF, 0xFA, 0x97, 0x09, 0xFF, 0xFE, 0x5A, 0xFF, 0xFE, 0xA4, 0xFC,
+    0xA9, 0x0D, 0x92, 0x9D, 0x4F, 0xC3, 0xD9, 0x71, 0xAE, 0xA4, 0xD9, 0x71, 0xF5, 0xD9, 0x70, 0xAE,
+    0x6D, 0x97, 0x0E, 0xA6, 0xD9, 0x79, 0xE9, 0x6D, 0x97, 0x9E, 0x7D, 0x97, 0xAE, 0x7D, 0x97, 0xAE,
+    0x7D, 0x97, 0xAE, 0x7F, 0xFD, 0xAA, 0xE7, 0xFF, 0xDA, 0xAE, 0x7F, 0xFD, 0xAA, 0xE7, 0xD9, 0x3E,
+    0xA9, 0xE9, 0x6D, 0x93, 0xEA, 0x0E, 0xA6, 0xD9, 0x3E, 0xA0, 0xF6, 0xD9, 0x3E, 0xA0, 0x9E, 0x95,
+    0xD9, 0x3E, 0xA1, 0xF9, 0x4D, 0x93, 0xEA, 0x19, 0xF9, 0x3D, 0x93, 0xEA, 0x2A, 0xFA, 0x2D, 0x93,
+    0xEA, 0x3A, 0xFD, 0xAD, 0xAA, 0xAF, 0xCA, 0x49, 0xFF, 0xFF, 0xA6, 0x9A, 0xFF, 0xEA, 0x97, 0x39,
+    0xDA, 0x97, 0x72, 0xD9, 0x77, 0x3D, 0x97, 0x70, 0x9E, 0x77, 0x2F, 0xA7, 0x71, 0xFC, 0x77, 0x0A,
+    0xFC, 0x97, 0x7E, 0xAD, 0xA7, 0x69, 0xE0, 0xE7, 0x6A, 0xDA, 0x0E, 0x97, 0x5E, 0x90, 0xAD, 0xA7,
+    0x49, 0xE1, 0x9E, 0x74, 0xAD, 0xA2, 0xE9, 0x59, 0xFF, 0xFF, 0xFC, 0x9A, 0xFF, 0xFF, 0xFC, 0x99,
+    0xAA, 0xAA, 0xFA, 0xAA, 0xAA, 0xFA, 0xAA, 0xA9, 0x4E, 0x94, 0xAE, 0x70, 0xAE, 0x6E, 0x94, 0x99,
+    0x9E, 0xA9, 0x99, 0x99, 0x99, 0xEA, 0x99, 0x90, 0xAF, 0xFF, 0xFF, 0xC9, 0xAF, 0xFF, 0xFF, 0xC9,
+    0x2E, 0xA7, 0x0F, 0x49, 0xE7, 0x19, 0xE4, 0xAE, 0x72, 0xE9, 0x3E, 0x97, 0x2A, 0xE2, 0x9E, 0x73,
+    0x9E, 0x2A, 0xE7, 0x4E, 0xA1, 0xE9, 0x74, 0xAE, 0x09, 0xE7, 0x59, 0xE0, 0xEA, 0x76, 0xEA, 0x77,
+    0x71, 0x9A, 0xFE, 0xA7, 0x0A, 0xFF, 0xFA, 0x6A, 0xFF, 0xFC, 0xA5, 0x9D, 0x95, 0x9F, 0x77, 0x09,
+    0xEA, 0x77, 0x0E, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0xEA, 0x77, 0x0E, 0x91, 0xAF, 0xFF, 0xFE, 0x0A,
+    0xFF, 0xFF, 0xE9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAF, 0xD9, 0x99, 0x70, 0x9A, 0xFC, 0x97, 0x29,
+    0xFD, 0x97, 0x29, 0xFC, 0xA7, 0x19, 0xAA, 0xFD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0xAF, 0xFF,
+    0xFE, 0x99, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2E, 0x97, 0x70, 0xE7, 0x71, 0xE7,
+    0x71, 0xE9, 0x77, 0x0F, 0x77, 0x0A, 0xF7, 0x09, 0xCA, 0x4F, 0xDA, 0xAA, 0xAA, 0xFA, 0x5F, 0xFF,
+    0xDA, 0x69, 0xFF, 0xDA, 0x97, 0x39, 0x99, 0x97, 0x72, 0x99, 0x97, 0x71, 0xAD, 0x76, 0x9A, 0xFE,
+    0xA9, 0x7A, 0xFF, 0xFC, 0x94, 0xFF, 0xFE, 0x4F, 0xC9, 0x0A, 0xD1, 0x9A, 0xCA, 0x3F, 0xA2, 0xAD,
+    0x70, 0xAE, 0xA3, 0xAD, 0x70, 0xF4, 0xAD, 0x7A, 0xE5, 0xAD, 0x7E, 0xA5, 0xAD, 0x69, 0xE9, 0x5A,
+    0xD6, 0x9E, 0x6A, 0xD6, 0xAE, 0x6A, 0xD6, 0xAE, 0x6A, 0xD6, 0xAE, 0x6A, 0xD6, 0xAE, 0x6A, 0xD6,
+    0xAE, 0x6A, 0xD6, 0xAE, 0x6A, 0xD6, 0x9E, 0x95, 0xAD, 0x7E, 0xA5, 0xAD, 0x7F, 0x5A, 0xD7, 0xAE,
+    0x94, 0xAD, 0x70, 0xF4, 0xAD, 0x70, 0x9F, 0x3A, 0xD7, 0x1A, 0xFA, 0x1A, 0xD3, 0x99, 0x4A, 0xFF,
+    0xCA, 0xAE, 0x95, 0x9F, 0xFF, 0xC9, 0x7A, 0xFF, 0xDA, 0x74, 0xAD, 0x97, 0x70, 0xAD, 0x77, 0x1A,
+    0xD6, 0x4C, 0xA6, 0xCA, 0x72, 0x9D, 0x59, 0xD7, 0x2A, 0xD5, 0xAD, 0x72, 0xE5, 0xE7, 0x2E, 0x49,
+    0xE7, 0x9A, 0xFF, 0xFF, 0xDA, 0x1F, 0xFF, 0xFF, 0xA1, 0x99, 0xAE, 0x99, 0xAA, 0xAA, 0xE9, 0x99,
+    0x99, 0x93, 0x9E, 0x49, 0xE7, 0x19, 0xE4, 0x9E, 0x71, 0x9E, 0x49, 0xE7, 0x19, 0xE4, 0x9E, 0x71,
+    0x9E, 0x49, 0xE7, 0x19, 0xE4, 0x9E, 0x71, 0x9E, 0x49, 0xE7, 0x19, 0xE4, 0x9E, 0x71, 0x9E, 0x49,
+    0xE7, 0x19, 0xE4, 0x9E, 0x71, 0x9E, 0x49, 0xE7, 0x19, 0xE4, 0x9E, 0x71, 0x9E, 0x49, 0xE7, 0x19,
+    0xE5, 0xE9, 0x70, 0x9E, 0x5F, 0xA9, 0x99, 0xA3, 0x9E, 0x59, 0xFF, 0x39, 0xE6, 0x9F, 0xE7, 0x71,
+    0x99, 0x92, 0x77, 0x77, 0x69, 0xFE, 0xA9, 0x75, 0x9F, 0xFF, 0xA7, 0x29, 0xFD, 0xAF, 0xDA, 0x72,
+    0xF9, 0x59, 0xAC, 0x72, 0xAE, 0x77, 0x5E, 0x97, 0x75, 0xE9, 0x77, 0x5E, 0x97, 0x75, 0xEA, 0x77,
+    0x5A, 0xE9, 0x77, 0x5F, 0xA7, 0x74, 0xAF, 0xCA, 0x77, 0x39, 0xFD, 0xA9, 0x77, 0x2A, 0xFE, 0x97,
+    0x72, 0xAF, 0xDA, 0x77, 0x39, 0xAF, 0xC7, 0x75, 0xFA, 0x77, 0x5A, 0xE2, 0x9A, 0x92, 0xAA, 0xA2,
+    0x9A, 0xA9, 0x3E, 0x90, 0xFA, 0x9F, 0xC0, 0xAF, 0xA2, 0xAD, 0x90, 0xCA, 0x0E, 0x91, 0xF9, 0x09,
+    0xD2, 0xAD, 0x90, 0xCA, 0x0D, 0xA2, 0x9D, 0x92, 0xAC, 0x91, 0xE9, 0x0D, 0x0D, 0x93, 0xD3, 0xAC,
+    0x91, 0xE1, 0x9F, 0x93, 0xD3, 0xAC, 0x90, 0xEA, 0x29, 0xFA, 0x91, 0xD3, 0xAF, 0xCA, 0x5F, 0xFF,
+    0xFD, 0xA6, 0xDA, 0xAF, 0xFF, 0xA7, 0x0D, 0x92, 0x9D, 0x99, 0x99, 0xAC, 0x97, 0x1D, 0x93, 0xD3,
+    0xAC, 0x97, 0x1A, 0xC9, 0x3D, 0x3A, 0xC9, 0x50, 0x9F, 0xFF, 0xFD, 0xA9, 0xFF, 0xFF, 0xE9, 0xFF,
+    0xFF, 0xE7, 0x77, 0x77, 0x77, 0x39, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xE9, 0xFF, 0xFF, 0xE7, 0x9E,
+    0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E,
+    0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E, 0x77, 0x9E,
+    0x77, 0x9E, 0x70, 0x0F, 0xFF, 0xE9, 0x0F, 0xFF, 0xE9, 0x0A, 0xAA, 0xFD, 0xAA, 0xAA, 0xAA, 0x95,
+    0xF9, 0x74, 0xAE, 0x75, 0xE9, 0x59, 0x99, 0x99, 0x99, 0xEA, 0x99, 0x99, 0x1F, 0xFF, 0xE9, 0x0F,
+    0xFF, 0xE9, 0x7E, 0xA7, 0x4E, 0x97, 0x3F, 0x71, 0x9A, 0xF9, 0x6F, 0xF9, 0x7F, 0xD9, 0x71, 0xAE,
+    0x75, 0xEA, 0x74, 0x9E, 0x75, 0xEA, 0x75, 0xE9, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0xAE, 0x75, 0xEA,
+    0x74, 0x9E, 0x97, 0x4F, 0x75, 0xEA, 0x40, 0x4E, 0x77, 0x1E, 0x77, 0x1E, 0x77, 0x1E, 0x59, 0x97,
+    0x1E, 0x29, 0xAD, 0xA7, 0x1E, 0x9A, 0xFC, 0xA7, 0x1F, 0xEA, 0x97, 0x09, 0xAF, 0xD9, 0x72, 0xFE,
+    0x74, 0x9E, 0xAE, 0x39, 0xAC, 0xA5, 0xA2, 0xE0, 0x9A, 0xFA, 0x71, 0xFF, 0xC9, 0x71, 0xAF, 0xD9,
+    0x71, 0xAF, 0xDA, 0x73, 0x9F, 0xE7, 0x0E, 0x99, 0xCA, 0x1E, 0x70, 0xE9, 0x4E, 0x70, 0xE5, 0xE7,
+    0x9E, 0x5E, 0x7A, 0xE5, 0xE7, 0xE9, 0x5E, 0x69, 0xE6, 0xE6, 0xEA, 0x6E, 0x5F, 0x7E, 0x3A, 0xF7,
+    0x0E, 0xAA, 0xFD, 0x97, 0x0F, 0xFC, 0xA7, 0x2F, 0xEA, 0x77, 0x74, 0x77, 0x77, 0xAE, 0xA7, 0x75,
+    0x9F, 0xE7, 0x74, 0xE1, 0xAD, 0xA7, 0x72, 0x9D, 0x3A, 0xD7, 0x72, 0x9D, 0x39, 0xD9, 0x77, 0x19,
+    0xD3, 0x9D, 0x97, 0x72, 0xE3, 0xDA, 0x77, 0x2A, 0xFF, 0xFF, 0xFA, 0xA6, 0xFF, 0xFF, 0xFE, 0xA5,
+    0x9A, 0xFF, 0xFF, 0xFD, 0x71, 0xDA, 0x73, 0x9A, 0xDA, 0x70, 0xDA, 0x75, 0xAD, 0x70, 0xDA, 0x76,
+    0xD9, 0x7D, 0xA2, 0x97, 0x2D, 0x97, 0xDA, 0x1A, 0xCA, 0x2A, 0xC4, 0xAC, 0xA7, 0xDA, 0x0F, 0xA0,
+    0xF3, 0xD9, 0x7F, 0xFF, 0xE2, 0xD7, 0x0F, 0xC1, 0xAE, 0x90, 0xFE, 0x70, 0xF3, 0xD9, 0x2A, 0xF7,
+    0x0A, 0xE7, 0x49, 0x97, 0x0A, 0xF9, 0x77, 0x5E, 0xAE, 0x77, 0x5A, 0xC9, 0x0A, 0xDA, 0x77, 0x71,
+    0xEA, 0x77, 0x70, 0x9F, 0xCA, 0xAA, 0xAA, 0xD7, 0x70, 0x9F, 0xFE, 0x77, 0x2A, 0xFF, 0xA7, 0x76,
+    0x99, 0x97, 0x00, 0x72, 0x9D, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75,
+    0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x75, 0xAD, 0xA7, 0x72, 0x9A, 0xAF, 0xAA, 0x97,
+    0x49, 0xFF, 0xFD, 0x97, 0x0F, 0xFF, 0xFD, 0x6F, 0xCA, 0x90, 0xAD, 0xA0, 0x9A, 0xFC, 0x4F, 0xA3,
+    0xAD, 0xA3, 0xAF, 0x29, 0xE9, 0x4A, 0xDA, 0x49, 0xE9, 0x1F, 0x5A, 0xDA, 0x5F, 0x1E, 0x95, 0xAD,
+    0xA5, 0x9E, 0x09, 0xE6, 0xAD, 0xA6, 0xE9, 0xAE, 0x6A, 0xDA, 0x6A, 0xDA, 0xAD, 0xA6, 0xAD, 0xA6,
+    0xAE, 0xAD, 0xA6, 0xAD, 0xA6, 0x9F, 0xDA, 0x69, 0xDA, 0x69, 0xFD, 0xA7, 0x71, 0x9F, 0xDA, 0x77,
+    0x19, 0xFD, 0xA7, 0x71, 0x9F, 0xDA, 0x77, 0x19, 0xFD, 0xA7, 0x71, 0x9F, 0xDA, 0x77, 0x19, 0xE0,
+    0x29, 0xFF, 0xAA, 0x97, 0x09, 0xFF, 0xFA, 0x69, 0xFF, 0xFD, 0x94, 0x9E, 0x59, 0xFC, 0x49, 0xE7,
+    0xAE, 0xA3, 0x9E, 0x70, 0xAE, 0x39, 0xE7, 0x09, 0xE3, 0x9E, 0x71, 0xE9, 0x29, 0xE7, 0x1E, 0x92,
+    0x9E, 0x70, 0x9E, 0x39, 0xE7, 0x0A, 0xE3, 0x9E, 0x79, 0xEA, 0x39, 0xE6, 0xAF, 0x19, 0xAA, 0xFD,
+    0xAA, 0xFE, 0x91, 0xAF, 0xFF, 0xF3, 0xAF, 0xFF, 0xCA, 0x70, 0x9E, 0x97, 0x79, 0xE7, 0x70, 0x9E,
+    0x75, 0x9A, 0xAA, 0xEA, 0xAA, 0xAA, 0xA7, 0xAF, 0xFF, 0x7A, 0xFF, 0xF7, 0x29, 0xE7, 0x70, 0x9E,
+    0x77, 0x09, 0xE7, 0x70, 0x9E, 0x77, 0x09, 0xE7, 0x50, 0x79, 0xD2, 0xD9, 0x77, 0x9D, 0x2D, 0xA7,
+    0x79, 0xD9, 0x99, 0xDA, 0x76, 0x9F, 0xFC, 0xA7, 0x39, 0xFF, 0xFC, 0x97, 0x0A, 0xFD, 0x99, 0x9F,
+    0xDA, 0x6A, 0xEA, 0x9D, 0x2D, 0xAA, 0xEA, 0x49, 0xEA, 0x09, 0xD2, 0xDA, 0x09, 0xE9, 0x3E, 0xA1,
+    0x9D, 0x2D, 0xA1, 0xAE, 0x2A, 0xE2, 0x9D, 0x2D, 0xA2, 0xEA, 0x1E, 0xA2, 0x9D, 0x2D, 0xA2, 0xAE,
+    0x1E, 0x92, 0x9D, 0x2D, 0xA2, 0x9E, 0x09, 0xE3, 0x9D, 0x2D, 0xA3, 0xE9, 0x9E, 0x39, 0xD2, 0xDA,
+    0x3E, 0xAA, 0xE3, 0x9D, 0x2D, 0xA3, 0xEA, 0xAE, 0x39, 0xD2, 0xD9, 0x3E, 0xAA, 0xE7, 0x74, 0x9E,
+    0x77, 0x5E, 0x77, 0x5E, 0x97, 0x74, 0xAE, 0x77, 0x5E, 0x97, 0x74, 0xAE, 0x77, 0x5E, 0xA7, 0x75,
+    0xF7, 0x75, 0xFA, 0x77, 0x09, 0xAA, 0xAF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC,
+    0x10, 0x3A, 0xA9, 0x1A, 0xA9, 0x71, 0xD9, 0x1D, 0xA7, 0x1D, 0x91, 0xDA, 0x71, 0xD9, 0x1D, 0xA5,
+    0x9F, 0xEA, 0xDA, 0x59, 0xFF, 0xFA, 0x39, 0xFF, 0xFD, 0x29, 0xE4, 0x9A, 0xFA, 0x19, 0xE7, 0xF1,
+    0x9E, 0x79, 0xE1, 0x9E, 0x70, 0xE9, 0x09, 0xE7, 0x0E, 0x90, 0x9E, 0x79, 0xE1, 0x9E, 0x7A, 0xE1,
+    0x9E, 0x69, 0xE9, 0x19, 0xE9, 0x99, 0x99, 0xAF, 0x92, 0x9F, 0xFE, 0xA4, 0x9F, 0xFF, 0xA3, 0x9E,
+    0x99, 0x99, 0x9A, 0xFC, 0x91, 0x9E, 0x7F, 0x19, 0xE7, 0x0E, 0xA0, 0x9E, 0x70, 0xAE, 0x09, 0xE7,
+    0x0A, 0xE0, 0x9E, 0x70, 0xAE, 0x09, 0xE7, 0x0A, 0xE0, 0x9E, 0x70, 0xF0, 0x9E, 0x7A, 0xEA, 0x09,
+    0xE6, 0xAF, 0x19, 0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xC9, 0x29, 0xFF, 0xE9, 0x70, 0xD9, 0x1D, 0xA7,
+    0x1D, 0x91, 0xDA, 0x71, 0xD9, 0x1D, 0xA7, 0x1A, 0xA9, 0x1A, 0xA9, 0x50, 0x79, 0x99, 0x99, 0x79,
+    0xFF, 0xC4, 0xFF, 0xE3, 0xFC, 0xA9, 0x9A, 0xAD, 0x2A, 0xEA, 0x72, 0xEA, 0x72, 0xAE, 0x73, 0xEA,
+    0x73, 0xE9, 0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x74, 0xE9, 0x73, 0xE9, 0x73, 0xEA, 0x73, 0xAE, 0x74,
+    0xEA, 0x73, 0xAE, 0xA6, 0x93, 0xFC, 0xA9, 0x9A, 0xAD, 0x4F, 0xFE, 0x59, 0xFF, 0xA7, 0x09, 0x99,
+    0x97, 0x77, 0x74, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFF, 0xCA, 0x0F, 0xFF,
+    0xFC, 0xA7, 0x72, 0x77, 0x77, 0x77, 0x29, 0xCA, 0x77, 0x76, 0x9E, 0xA7, 0x77, 0x49, 0xFC, 0xA7,
+    0x77, 0x29, 0xFE, 0xA7, 0x77, 0x09, 0xFF, 0xCA, 0x77, 0x69, 0xFF, 0xEA, 0x77, 0x49, 0xFD, 0xAA,
+    0xFC, 0xA7, 0x72, 0x9E, 0xA6, 0xAE, 0xA7, 0x70, 0x9E, 0x72, 0xEA, 0x76, 0x9F, 0x72, 0x9E, 0xA7,
+    0x49, 0xFC, 0x91, 0x9A, 0xAA, 0x4F, 0xA7, 0x29, 0xFE, 0x9F, 0xCA, 0x3F, 0xCA, 0x70, 0x9F, 0xFF,
+    0xE3, 0xFD, 0xA6, 0x9F, 0xFF, 0xEA, 0x3F, 0xEA, 0x49, 0xFF, 0xFF, 0x39, 0xFF, 0xA2, 0x9F, 0xFF,
+    0xEA, 0x4F, 0xFD, 0xA1, 0xFF, 0xFE, 0xA4, 0xFF, 0xFA, 0x0A, 0xFF, 0xFD, 0x39, 0xFF, 0xFC, 0x2A,
+    0xFF, 0xF9, 0x29, 0xFF, 0xFC, 0x4A, 0xFF, 0xE3, 0xFF, 0xFC, 0x6A, 0xFF, 0xD3, 0xFF, 0xF7, 0x0A,
+    0xFF, 0xCA, 0xAA, 0xAF, 0xFE, 0x72, 0xAF, 0xFF, 0xFF, 0xD7, 0x4A, 0xFF, 0xFF, 0xF7, 0x6A, 0xFD,
+    0x92, 0xFF, 0x77, 0x0A, 0xFA, 0x39, 0xFD, 0x77, 0x2A, 0xEA, 0x39, 0xFC, 0x77, 0x4A, 0xE3, 0xAF,
+    0x77, 0x6A, 0xDA, 0x99, 0xAF, 0x77, 0x70, 0xAF, 0xF7, 0x77, 0x2A, 0xFD, 0x77, 0x74, 0xAF, 0x77,
+    0x76, 0xAD, 0x77, 0x77, 0x0A, 0x77, 0x00,
 };
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 10, 0, 0, 0, 0 }, // 
     { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 6, 28, 10, 2, 27, 42, 0 }, // !
-    { 11, 10, 15, 2, 27, 28, 42 }, // "
-    { 24, 27, 25, 0, 27, 162, 70 }, // #
-    { 18, 32, 21, 2, 29, 144, 232 }, // $
-    { 29, 29, 31, 1, 28, 211, 376 }, // %
-    { 27, 29, 29, 1, 28, 196, 587 }, // &
-    { 4, 10, 8, 2, 27, 10, 783 }, // '
-    { 10, 33, 12, 1, 27, 83, 793 }, // (
-    { 9, 33, 11, 1, 27, 75, 876 }, // )
-    { 19, 18, 21, 1, 29, 86, 951 }, // *
-    { 19, 19, 21, 1, 23, 91, 1037 }, // +
-    { 7, 10, 10, 1, 5, 18, 1128 }, // ,
-    { 10, 4, 12, 1, 12, 10, 1146 }, // -
-    { 6, 6, 10, 2, 5, 9, 1156 }, // .
-    { 14, 27, 15, 0, 27, 95, 1165 }, // /
-    { 19, 29, 21, 1, 28, 138, 1260 }, // 0
-    { 11, 27, 21, 3, 27, 75, 1398 }, // 1
-    { 19, 28, 21, 1, 28, 133, 1473 }, // 2
-    { 19, 29, 21, 1, 28, 138, 1606 }, // 3
-    { 21, 27, 22, 0, 27, 142, 1744 }, // 4
-    { 18, 28, 21, 2, 27, 126, 1886 }, // 5
-    { 18, 29, 21, 2, 28, 131, 2012 }, // 6
-    { 19, 27, 21, 1, 27, 129, 2143 }, // 7
-    { 19, 29, 21, 1, 28, 138, 2272 }, // 8
-    { 19, 29, 21, 1, 28, 138, 2410 }, // 9
-    { 6, 22, 10, 2, 21, 33, 2548 }, // :
-    { 7, 26, 10, 1, 21, 46, 2581 }, // ;
-    { 19, 19, 21, 1, 23, 91, 2627 }, // <
-    { 18, 11, 21, 2, 19, 50, 2718 }, // =
-    { 19, 19, 21, 1, 23, 91, 2768 }, // >
-    { 16, 29, 17, 0, 28, 116, 2859 }, // ?
-    { 30, 31, 34, 2, 27, 233, 2975 }, // @
-    { 24, 27, 25, 0, 27, 162, 3208 }, // A
-    { 20, 27, 24, 3, 27, 135, 3370 }, // B
-    { 21, 29, 24, 2, 28, 153, 3505 }, // C
-    { 23, 27, 27, 3, 27, 156, 3658 }, // D
-    { 16, 27, 21, 3, 27, 108, 3814 }, // E
-    { 16, 27, 20, 3, 27, 108, 3922 }, // F
-    { 23, 29, 27, 2, 28, 167, 4030 }, // G
-    { 22, 27, 28, 3, 27, 149, 4197 }, // H
-    { 11, 27, 13, 1, 27, 75, 4346 }, // I
-    { 10, 35, 10, -3, 27, 88, 4421 }, // J
-    { 21, 27, 25, 3, 27, 142, 4509 }, // K
-    { 16, 27, 20, 3, 27, 108, 4651 }, // L
-    { 28, 27, 34, 3, 27, 189, 4759 }, // M
-    { 22, 27, 29, 3, 27, 149, 4948 }, // N
-    { 25, 29, 29, 2, 28, 182, 5097 }, // O
-    { 18, 27, 23, 3, 27, 122, 5279 }, // P
-    { 25, 35, 29, 2, 28, 219, 5401 }, // Q
-    { 20, 27, 24, 3, 27, 135, 5620 }, // R
-    { 18, 29, 21, 1, 28, 131, 5755 }, // S
-    { 21, 27, 22, 0, 27, 142, 5886 }, // T
-    { 21, 28, 27, 3, 27, 147, 6028 }, // U
-    { 23, 27, 24, 0, 27, 156, 6175 }, // V
-    { 35, 27, 36, 0, 27, 237, 6331 }, // W
-    { 22, 27, 23, 0, 27, 149, 6568 }, // X
-    { 22, 27, 23, 0, 27, 149, 6717 }, // Y
-    { 19, 27, 21, 1, 27, 129, 6866 }, // Z
-    { 9, 33, 13, 3, 27, 75, 6995 }, // [
-    { 14, 27, 15, 0, 27, 95, 7070 }, // <backslash>
-    { 10, 33, 12, 0, 27, 83, 7165 }, // ]
-    { 20, 17, 22, 1, 27, 85, 7248 }, // ^
-    { 18, 3, 18, -1, -3, 14, 7333 }, // _
-    { 9, 7, 11, 1, 29, 16, 7347 }, // `
-    { 17, 22, 21, 1, 21, 94, 7363 }, // a
-    { 18, 30, 23, 3, 29, 135, 7457 }, // b
-    { 15, 22, 18, 2, 21, 83, 7592 }, // c
-    { 18, 30, 23, 2, 29, 135, 7675 }, // d
-    { 18, 22, 21, 2, 21, 99, 7810 }, // e
-    { 15, 29, 16, 0, 29, 109, 7909 }, // f
-    { 18, 30, 23, 2, 21, 135, 8018 }, // g
-    { 18, 29, 23, 3, 29, 131, 8153 }, // h
-    { 5, 28, 10, 2, 28, 35, 8284 }, // i
-    { 10, 37, 10, -3, 28, 93, 8319 }, // j
-    { 17, 29, 21, 3, 29, 124, 8412 }, // k
-    { 4, 29, 10, 3, 29, 29, 8536 }, // l
-    { 30, 21, 35, 3, 21, 158, 8565 }, // m
-    { 18, 21, 23, 3, 21, 95, 8723 }, // n
-    { 19, 22, 23, 2, 21, 105, 8818 }, // o
-    { 18, 30, 23, 3, 21, 135, 8923 }, // p
-    { 18, 30, 23, 2, 21, 135, 9058 }, // q
-    { 12, 21, 16, 3, 21, 63, 9193 }, // r
-    { 16, 22, 18, 1, 21, 88, 9256 }, // s
-    { 13, 26, 14, 0, 25, 85, 9344 }, // t
-    { 18, 22, 23, 2, 21, 99, 9429 }, // u
-    { 20, 21, 21, 0, 21, 105, 9528 }, // v
-    { 30, 21, 31, 0, 21, 158, 9633 }, // w
-    { 20, 21, 21, 0, 21, 105, 9791 }, // x
-    { 20, 30, 21, 0, 21, 150, 9896 }, // y
-    { 16, 21, 18, 1, 21, 84, 10046 }, // z
-    { 13, 33, 15, 1, 27, 108, 10130 }, // {
-    { 4, 39, 21, 8, 29, 39, 10238 }, // |
-    { 13, 33, 15, 1, 27, 108, 10277 }, // }
-    { 19, 6, 21, 1, 16, 29, 10385 }, // ~
-    { 0, 0, 10, 0, 0, 0, 10414 }, //  
-    { 6, 28, 10, 2, 21, 42, 10414 }, // ¡
-    { 16, 29, 21, 3, 28, 116, 10456 }, // ¢
-    { 20, 28, 22, 1, 28, 140, 10572 }, // £
-    { 18, 18, 21, 2, 22, 81, 10712 }, // ¤
-    { 21, 27, 22, 0, 27, 142, 10793 }, // ¥
-    { 4, 39, 21, 8, 29, 39, 10935 }, // ¦
-    { 15, 30, 19, 2, 29, 113, 10974 }, // §
-    { 12, 5, 22, 5, 28, 15, 11087 }, // ¨
-    { 29, 29, 31, 1, 28, 211, 11102 }, // ©
-    { 11, 14, 13, 1, 28, 39, 11313 }, // ª
-    { 17, 16, 19, 1, 18, 68, 11352 }, // «
-    { 19, 11, 21, 1, 15, 53, 11420 }, // ¬
-    { 10, 4, 12, 1, 12, 10, 11473 }, // ­
-    { 29, 29, 31, 1, 28, 211, 11483 }, // ®
-    { 20, 3, 20, -1, 31, 15, 11694 }, // ¯
-    { 12, 13, 16, 2, 28, 39, 11709 }, // °
-    { 19, 23, 21, 1, 23, 110, 11748 }, // ±
-    { 12, 17, 13, 0, 32, 51, 11858 }, // ²
-    { 13, 17, 14, 0, 32, 56, 11909 }, // ³
-    { 9, 7, 11, 1, 29, 16, 11965 }, // ´
-    { 18, 30, 23, 3, 21, 135, 11981 }, // µ
-    { 19, 34, 25, 2, 29, 162, 12116 }, // ¶
-    { 6, 6, 10, 2, 16, 9, 12278 }, // ·
-    { 8, 9, 9, 0, 0, 18, 12287 }, // ¸
-    { 8, 17, 13, 1, 32, 34, 12305 }, // ¹
-    { 12, 14, 14, 1, 28, 42, 12339 }, // º
-    { 17, 16, 19, 1, 18, 68, 12381 }, // »
-    { 27, 27, 29, 1, 27, 183, 12449 }, // ¼
-    { 28, 27, 29, 0, 27, 189, 12632 }, // ½
-    { 29, 28, 30, 0, 28, 203, 12821 }, // ¾
-    { 16, 29, 17, 0, 21, 116, 13024 }, // ¿
-    { 24, 36, 25, 0, 36, 216, 13140 }, // À
-    { 24, 36, 25, 0, 36, 216, 13356 }, // Á
-    { 24, 36, 25, 0, 36, 216, 13572 }, // Â
-    { 24, 35, 25, 0, 35, 210, 13788 }, // Ã
-    { 24, 35, 25, 0, 35, 210, 13998 }, // Ä
-    { 24, 33, 25, 0, 33, 198, 14208 }, // Å
-    { 32, 27, 33, -1, 27, 216, 14406 }, // Æ
-    { 21, 37, 24, 2, 28, 195, 14622 }, // Ç
-    { 16, 36, 21, 3, 36, 144, 14817 }, // È
-    { 16, 36, 21, 3, 36, 144, 14961 }, // É
-    { 16, 36, 21, 3, 36, 144, 15105 }, // Ê
-    { 16, 35, 21, 3, 35, 140, 15249 }, // Ë
-    { 11, 36, 13, 1, 36, 99, 15389 }, // Ì
-    { 11, 36, 13, 1, 36, 99, 15488 }, // Í
-    { 13, 36, 14, 0, 36, 117, 15587 }, // Î
-    { 11, 35, 13, 1, 35, 97, 15704 }, // Ï
-    { 25, 27, 27, 1, 27, 169, 15801 }, // Ð
-    { 22, 35, 29, 3, 35, 193, 15970 }, // Ñ
-    { 25, 37, 29, 2, 36, 232, 16163 }, // Ò
-    { 25, 37, 29, 2, 36, 232, 16395 }, // Ó
-    { 25, 37, 29, 2, 36, 232, 16627 }, // Ô
-    { 25, 36, 29, 2, 35, 225, 16859 }, // Õ
-    { 25, 36, 29, 2, 35, 225, 17084 }, // Ö
-    { 17, 18, 21, 2, 22, 77, 17309 }, // ×
-    { 25, 30, 29, 2, 28, 188, 17386 }, // Ø
-    { 21, 37, 27, 3, 36, 195, 17574 }, // Ù
-    { 21, 37, 27, 3, 36, 195, 17769 }, // Ú
-    { 21, 37, 27, 3, 36, 195, 17964 }, // Û
-    { 21, 36, 27, 3, 35, 189, 18159 }, // Ü
-    { 22, 36, 23, 0, 36, 198, 18348 }, // Ý
-    { 18, 27, 23, 3, 27, 122, 18546 }, // Þ
-    { 19, 30, 24, 3, 29, 143, 18668 }, // ß
-    { 17, 30, 21, 1, 29, 128, 18811 }, // à
-    { 17, 30, 21, 1, 29, 128, 18939 }, // á
-    { 17, 30, 21, 1, 29, 128, 19067 }, // â
-    { 17, 29, 21, 1, 28, 124, 19195 }, // ã
-    { 17, 29, 21, 1, 28, 124, 19319 }, // ä
-    { 17, 32, 21, 1, 31, 136, 19443 }, // å
-    { 30, 22, 32, 1, 21, 165, 19579 }, // æ
-    { 15, 30, 18, 2, 21, 113, 19744 }, // ç
-    { 18, 30, 21, 2, 29, 135, 19857 }, // è
-    { 18, 30, 21, 2, 29, 135, 19992 }, // é
-    { 18, 30, 21, 2, 29, 135, 20127 }, // ê
-    { 18, 29, 21, 2, 28, 131, 20262 }, // ë
-    { 9, 29, 10, -1, 29, 66, 20393 }, // ì
-    { 9, 29, 12, 2, 29, 66, 20459 }, // í
-    { 14, 29, 13, -2, 29, 102, 20525 }, // î
-    { 12, 28, 12, -1, 28, 84, 20627 }, // ï
-    { 19, 30, 23, 2, 29, 143, 20711 }, // ð
-    { 18, 28, 23, 3, 28, 126, 20854 }, // ñ
-    { 19, 30, 23, 2, 29, 143, 20980 }, // ò
-    { 19, 30, 23, 2, 29, 143, 21123 }, // ó
-    { 19, 30, 23, 2, 29, 143, 21266 }, // ô
-    { 19, 29, 23, 2, 28, 138, 21409 }, // õ
-    { 19, 29, 23, 2, 28, 138, 21547 }, // ö
-    { 19, 18, 21, 1, 22, 86, 21685 }, // ÷
-    { 19, 24, 23, 2, 22, 114, 21771 }, // ø
-    { 18, 30, 23, 2, 29, 135, 21885 }, // ù
-    { 18, 30, 23, 2, 29, 135, 22020 }, // ú
-    { 18, 30, 23, 2, 29, 135, 22155 }, // û
-    { 18, 29, 23, 2, 28, 131, 22290 }, // ü
-    { 20, 38, 21, 0, 29, 190, 22421 }, // ý
-    { 18, 38, 23, 3, 29, 171, 22611 }, // þ
-    { 20, 37, 21, 0, 28, 185, 22782 }, // ÿ
-    { 24, 33, 25, 0, 33, 198, 22967 }, // Ā
-    { 17, 27, 21, 1, 26, 115, 23165 }, // ā
-    { 24, 35, 25, 0, 35, 210, 23280 }, // Ă
-    { 17, 29, 21, 1, 28, 124, 23490 }, // ă
-    { 24, 36, 25, 0, 27, 216, 23614 }, // Ą
-    { 18, 30, 21, 1, 21, 135, 23830 }, // ą
-    { 21, 37, 24, 2, 36, 195, 23965 }, // Ć
-    { 15, 30, 18, 2, 29, 113, 24160 }, // ć
-    { 21, 37, 24, 2, 36, 195, 24273 }, // Ĉ
-    { 15, 30, 18, 2, 29, 113, 24468 }, // ĉ
-    { 21, 36, 24, 2, 35, 189, 24581 }, // Ċ
-    { 15, 29, 18, 2, 28, 109, 24770 }, // ċ
-    { 21, 37, 24, 2, 36, 195, 24879 }, // Č
-    { 15, 30, 18, 2, 29, 113, 25074 }, // č
-    { 23, 36, 27, 3, 36, 207, 25187 }, // Ď
-    { 24, 30, 27, 2, 29, 180, 25394 }, // ď
-    { 25, 27, 27, 1, 27, 169, 25574 }, // Đ
-    { 21, 30, 24, 2, 29, 158, 25743 }, // đ
-    { 16, 33, 21, 3, 33, 132, 25901 }, // Ē
-    { 18, 27, 21, 2, 26, 122, 26033 }, // ē
-    { 16, 35, 21, 3, 35, 140, 26155 }, // Ĕ
-    { 18, 29, 21, 2, 28, 131, 26295 }, // ĕ
-    { 16, 35, 21, 3, 35, 140, 26426 }, // Ė
-    { 18, 29, 21, 2, 28, 131, 26566 }, // ė
-    { 16, 36, 21, 3, 27, 144, 26697 }, // Ę
-    { 18, 30, 21, 2, 21, 135, 26841 }, // ę
-    { 16, 36, 21, 3, 36, 144, 26976 }, // Ě
-    { 18, 30, 21, 2, 29, 135, 27120 }, // ě
-    { 23, 37, 27, 2, 36, 213, 27255 }, // Ĝ
-    { 18, 38, 23, 2, 29, 171, 27468 }, // ĝ
-    { 23, 36, 27, 2, 35, 207, 27639 }, // Ğ
-    { 18, 37, 23, 2, 28, 167, 27846 }, // ğ
-    { 23, 36, 27, 2, 35, 207, 28013 }, // Ġ
-    { 18, 37, 23, 2, 28, 167, 28220 }, // ġ
-    { 23, 37, 27, 2, 28, 213, 28387 }, // Ģ
-    { 18, 38, 23, 2, 29, 171, 28600 }, // ģ
-    { 22, 36, 28, 3, 36, 198, 28771 }, // Ĥ
-    { 23, 37, 23, -2, 37, 213, 28969 }, // ĥ
-    { 28, 27, 29, 0, 27, 189, 29182 }, // Ħ
-    { 21, 29, 23, 0, 29, 153, 29371 }, // ħ
-    { 15, 35, 15, -1, 35, 132, 29524 }, // Ĩ
-    { 15, 28, 13, -3, 28, 105, 29656 }, // ĩ
-    { 12, 33, 13, 0, 33, 99, 29761 }, // Ī
-    { 12, 26, 12, -1, 26, 78, 29860 }, // ī
-    { 13, 35, 14, 0, 35, 114, 29938 }, // Ĭ
-    { 13, 28, 12, -2, 28, 91, 30052 }, // ĭ
-    { 11, 36, 13, 1, 27, 99, 30143 }, // Į
-    { 7, 37, 10, 1, 28, 65, 30242 }, // į
-    { 11, 35, 13, 1, 35, 97, 30307 }, // İ
-    { 4, 21, 10, 3, 21, 21, 30404 }, // ı
-    { 19, 35, 23, 1, 27, 167, 30425 }, // Ĳ
-    { 15, 37, 19, 2, 28, 139, 30592 }, // ĳ
-    { 15, 44, 13, -3, 36, 165, 30731 }, // Ĵ
-    { 15, 38, 13, -3, 29, 143, 30896 }, // ĵ
-    { 21, 36, 25, 3, 27, 189, 31039 }, // Ķ
-    { 17, 38, 21, 3, 29, 162, 31228 }, // ķ
-    { 17, 21, 21, 3, 21, 90, 31390 }, // ĸ
-    { 16, 36, 20, 3, 36, 144, 31480 }, // Ĺ
-    { 9, 37, 12, 2, 37, 84, 31624 }, // ĺ
-    { 16, 36, 20, 3, 27, 144, 31708 }, // Ļ
-    { 6, 38, 10, 2, 29, 57, 31852 }, // ļ
-    { 16, 27, 20, 3, 27, 108, 31909 }, // Ľ
-    { 10, 29, 14, 3, 29, 73, 32017 }, // ľ
-    { 16, 27, 20, 3, 27, 108, 32090 }, // Ŀ
-    { 9, 29, 13, 3, 29, 66, 32198 }, // ŀ
-    { 19, 27, 20, 0, 27, 129, 32264 }, // Ł
-    { 12, 29, 12, -1, 29, 87, 32393 }, // ł
-    { 22, 36, 29, 3, 36, 198, 32480 }, // Ń
-    { 18, 29, 23, 3, 29, 131, 32678 }, // ń
-    { 22, 36, 29, 3, 27, 198, 32809 }, // Ņ
-    { 18, 30, 23, 3, 21, 135, 33007 }, // ņ
-    { 22, 36, 29, 3, 36, 198, 33142 }, // Ň
-    { 18, 29, 23, 3, 29, 131, 33340 }, // ň
-    { 23, 27, 26, 0, 27, 156, 33471 }, // ŉ
-    { 22, 35, 29, 3, 27, 193, 33627 }, // Ŋ
-    { 18, 30, 23, 3, 21, 135, 33820 }, // ŋ
-    { 25, 34, 29, 2, 33, 213, 33955 }, // Ō
-    { 19, 27, 23, 2, 26, 129, 34168 }, // ō
-    { 25, 36, 29, 2, 35, 225, 34297 }, // Ŏ
-    { 19, 29, 23, 2, 28, 138, 34522 }, // ŏ
-    { 25, 37, 29, 2, 36, 232, 34660 }, // Ő
-    { 19, 30, 23, 2, 29, 143, 34892 }, // ő
-    { 31, 29, 35, 2, 28, 225, 35035 }, // Œ
-    { 32, 22, 35, 2, 21, 176, 35260 }, // œ
-    { 20, 36, 24, 3, 36, 180, 35436 }, // Ŕ
-    { 12, 29, 16, 3, 29, 87, 35616 }, // ŕ
-    { 20, 36, 24, 3, 27, 180, 35703 }, // Ŗ
-    { 13, 30, 16, 2, 21, 98, 35883 }, // ŗ
-    { 20, 36, 24, 3, 36, 180, 35981 }, // Ř
-    { 14, 29, 17, 2, 29, 102, 36161 }, // ř
-    { 18, 37, 21, 1, 36, 167, 36263 }, // Ś
-    { 16, 30, 18, 1, 29, 120, 36430 }, // ś
-    { 18, 37, 21, 1, 36, 167, 36550 }, // Ŝ
-    { 16, 30, 18, 1, 29, 120, 36717 }, // ŝ
-    { 18, 37, 21, 1, 28, 167, 36837 }, // Ş
-    { 16, 30, 18, 1, 21, 120, 37004 }, // ş
-    { 18, 37, 21, 1, 36, 167, 37124 }, // Š
-    { 16, 30, 18, 1, 29, 120, 37291 }, // š
-    { 21, 36, 22, 0, 27, 189, 37411 }, // Ţ
-    { 13, 34, 14, 0, 25, 111, 37600 }, // ţ
-    { 21, 36, 22, 0, 36, 189, 37711 }, // Ť
-    { 18, 30, 19, 0, 29, 135, 37900 }, // ť
-    { 21, 27, 22, 0, 27, 142, 38035 }, // Ŧ
-    { 13, 26, 14, 0, 25, 85, 38177 }, // ŧ
-    { 21, 36, 27, 3, 35, 189, 38262 }, // Ũ
-    { 18, 29, 23, 2, 28, 131, 38451 }, // ũ
-    { 21, 34, 27, 3, 33, 179, 38582 }, // Ū
-    { 18, 27, 23, 2, 26, 122, 38761 }, // ū
-    { 21, 36, 27, 3, 35, 189, 38883 }, // Ŭ
-    { 18, 29, 23, 2, 28, 131, 39072 }, // ŭ
-    { 21, 39, 27, 3, 38, 205, 39203 }, // Ů
-    { 18, 32, 23, 2, 31, 144, 39408 }, // ů
-    { 21, 37, 27, 3, 36, 195, 39552 }, // Ű
-    { 18, 30, 23, 2, 29, 135, 39747 }, // ű
-    { 21, 36, 27, 3, 27, 189, 39882 }, // Ų
-    { 19, 30, 23, 2, 21, 143, 40071 }, // ų
-    { 35, 36, 36, 0, 36, 315, 40214 }, // Ŵ
-    { 30, 29, 31, 0, 29, 218, 40529 }, // ŵ
-    { 22, 36, 23, 0, 36, 198, 40747 }, // Ŷ
-    { 20, 38, 21, 0, 29, 190, 40945 }, // ŷ
-    { 22, 35, 23, 0, 35, 193, 41135 }, // Ÿ
-    { 19, 36, 21, 1, 36, 171, 41328 }, // Ź
-    { 16, 29, 18, 1, 29, 116, 41499 }, // ź
-    { 19, 35, 21, 1, 35, 167, 41615 }, // Ż
-    { 16, 28, 18, 1, 28, 112, 41782 }, // ż
-    { 19, 36, 21, 1, 36, 171, 41894 }, // Ž
-    { 16, 29, 18, 1, 29, 116, 42065 }, // ž
-    { 11, 29, 15, 3, 29, 80, 42181 }, // ſ
-    { 29, 30, 32, 2, 29, 218, 42261 }, // Ơ
-    { 23, 25, 26, 2, 24, 144, 42479 }, // ơ
-    { 35, 29, 40, 2, 28, 254, 42623 }, // Ƣ
-    { 27, 30, 32, 2, 21, 203, 42877 }, // ƣ
-    { 24, 27, 26, 0, 27, 162, 43080 }, // Ƥ
-    { 18, 38, 23, 3, 29, 171, 43242 }, // ƥ
-    { 20, 31, 24, 3, 27, 155, 43413 }, // Ʀ
-    { 18, 29, 21, 1, 28, 131, 43568 }, // Ƨ
-    { 16, 22, 18, 1, 21, 88, 43699 }, // ƨ
-    { 19, 27, 21, 1, 27, 129, 43787 }, // Ʃ
-    { 17, 38, 17, -1, 29, 162, 43916 }, // ƪ
-    { 13, 34, 14, 0, 25, 111, 44078 }, // ƫ
-    { 22, 27, 23, 0, 27, 149, 44189 }, // Ƭ
-    { 13, 30, 14, 0, 29, 98, 44338 }, // ƭ
-    { 21, 36, 22, 0, 27, 189, 44436 }, // Ʈ
-    { 28, 30, 32, 3, 29, 210, 44625 }, // Ư
-    { 25, 25, 28, 2, 24, 157, 44835 }, // ư
-    { 9, 7, 0, -19, 29, 16, 44992 }, // ̀
-    { 9, 7, 0, -13, 29, 16, 45008 }, // ́
-    { 14, 7, 8, -7, 29, 25, 45024 }, // ̂
-    { 15, 6, 0, -19, 28, 23, 45049 }, // ̃
-    { 12, 4, 7, -6, 26, 12, 45072 }, // ̄
-    { 16, 4, 9, -8, 32, 16, 45084 }, // ̅
-    { 12, 6, 7, -6, 28, 18, 45100 }, // ̆
-    { 4, 5, 3, -2, 28, 5, 45118 }, // ̇
-    { 12, 5, 7, -6, 28, 15, 45123 }, // ̈
-    { 7, 9, 0, -14, 31, 16, 45138 }, // ̉
-    { 10, 9, 6, -5, 31, 23, 45154 }, // ̊
-    { 14, 7, 10, -5, 29, 25, 45177 }, // ̋
-    { 14, 7, 8, -7, 29, 25, 45202 }, // ̌
-    { 4, 7, 3, -2, 29, 7, 45227 }, // ̍
-    { 10, 7, 6, -5, 29, 18, 45234 }, // ̎
-    { 15, 7, 0, -20, 29, 27, 45252 }, // ̏
-    { 12, 10, 7, -6, 32, 30, 45279 }, // ̐
-    { 12, 6, 7, -6, 28, 18, 45309 }, // ̑
-    { 6, 10, 4, -3, 27, 15, 45327 }, // ̒
-    { 6, 10, 4, -3, 27, 15, 45342 }, // ̓
-    { 6, 10, 4, -3, 27, 15, 45357 }, // ̔
-    { 6, 10, 4, -3, 27, 15, 45372 }, // ̕
-    { 8, 7, 5, -4, -1, 14, 45387 }, // ̖
-    { 8, 7, 5, -4, -1, 14, 45401 }, // ̗
-    { 8, 8, 5, -4, -1, 16, 45415 }, // ̘
-    { 8, 8, 5, -4, -1, 16, 45431 }, // ̙
-    { 11, 10, 12, 0, 29, 28, 45447 }, // ̚
-    { 9, 9, 6, -4, 29, 21, 45475 }, // ̛
-    { 5, 9, 4, -2, 0, 12, 45496 }, // ̜
-    { 8, 7, 5, -4, -1, 14, 45508 }, // ̝
-    { 8, 7, 5, -4, -1, 14, 45522 }, // ̞
-    { 8, 8, 5, -4, -1, 16, 45536 }, // ̟
-    { 10, 3, 6, -5, -3, 8, 45552 }, // ̠
-    { 7, 11, 1, -7, 2, 20, 45560 }, // ̡
-    { 7, 11, 8, 0, 2, 20, 45580 }, // ̢
-    { 5, 5, 0, -14, -2, 7, 45600 }, // ̣
-    { 12, 5, 7, -6, -2, 15, 45607 }, // ̤
-    { 10, 9, 6, -5, 0, 23, 45622 }, // ̥
-    { 6, 7, 4, -3, -2, 11, 45645 }, // ̦
-    { 8, 9, 5, -4, 0, 18, 45656 }, // ̧
-    { 8, 10, 5, -4, 1, 20, 45674 }, // ̨
-    { 4, 7, 3, -2, -1, 7, 45694 }, // ̩
-    { 14, 8, 8, -7, -1, 28, 45701 }, // ̪
-    { 16, 5, 9, -8, -2, 20, 45729 }, // ̫
-    { 14, 7, 8, -7, -1, 25, 45749 }, // ̬
-    { 14, 7, 8, -7, -1, 25, 45774 }, // ̭
-    { 12, 6, 7, -6, -2, 18, 45799 }, // ̮
-    { 12, 6, 7, -6, -2, 18, 45817 }, // ̯
-    { 14, 6, 8, -7, -2, 21, 45835 }, // ̰
-    { 12, 4, 7, -6, -2, 12, 45856 }, // ̱
-    { 18, 3, 10, -9, -3, 14, 45868 }, // ̲
-    { 16, 9, 9, -8, 0, 36, 45882 }, // ̳
-    { 15, 6, 9, -7, 13, 23, 45918 }, // ̴
-    { 16, 4, 9, -8, 13, 16, 45941 }, // ̵
-    { 28, 3, 15, -14, 12, 21, 45957 }, // ̶
-    { 12, 9, 7, -6, 15, 27, 45978 }, // ̷
-    { 16, 32, 9, -8, 29, 128, 46005 }, // ̸
-    { 5, 9, 4, -2, 0, 12, 46133 }, // ̹
-    { 14, 8, 8, -7, -1, 28, 46145 }, // ̺
-    { 16, 8, 9, -8, -1, 32, 46173 }, // ̻
-    { 16, 5, 9, -8, -2, 20, 46205 }, // ̼
-    { 8, 9, 5, -4, 30, 18, 46225 }, // ̽
-    { 6, 12, 4, -3, 33, 18, 46243 }, // ̾
-    { 16, 9, 9, -8, 37, 36, 46261 }, // ̿
-    { 8, 7, 3, -6, 29, 14, 46297 }, // ̀
-    { 9, 7, 8, -2, 29, 16, 46311 }, // ́
-    { 14, 6, 8, -7, 28, 21, 46327 }, // ͂
-    { 6, 8, 4, -3, 30, 12, 46348 }, // ̓
-    { 14, 8, 9, -6, 30, 28, 46360 }, // ̈́
-    { 6, 6, 5, -2, -3, 9, 46388 }, // ͅ
-    { 18, 7, 10, -9, 29, 32, 46397 }, // ͆
-    { 16, 9, 9, -8, 0, 36, 46429 }, // ͇
-    { 10, 7, 6, -5, -1, 18, 46465 }, // ͈
-    { 8, 7, 5, -4, -2, 14, 46483 }, // ͉
-    { 14, 8, 8, -7, 29, 28, 46497 }, // ͊
-    { 14, 14, 8, -7, 35, 49, 46525 }, // ͋
-    { 14, 11, 8, -7, 33, 39, 46574 }, // ͌
-    { 14, 8, 8, -7, -1, 28, 46613 }, // ͍
-    { 8, 9, 5, -4, 0, 18, 46641 }, // ͎
-    { 28, 27, 15, -14, 27, 189, 46659 }, // ͏
-    { 7, 8, 4, -4, 30, 14, 46848 }, // ͐
-    { 5, 9, 4, -2, 31, 12, 46862 }, // ͑
-    { 12, 10, 7, -6, 32, 30, 46874 }, // ͒
-    { 8, 8, 5, -4, -1, 16, 46904 }, // ͓
-    { 7, 8, 4, -4, -1, 14, 46920 }, // ͔
-    { 7, 8, 4, -4, -1, 14, 46934 }, // ͕
-    { 15, 8, 9, -7, -1, 30, 46948 }, // ͖
-    { 5, 9, 4, -2, 31, 12, 46978 }, // ͗
-    { 5, 5, 10, 4, 28, 7, 46990 }, // ͘
-    { 8, 8, 5, -4, -1, 16, 46997 }, // ͙
-    { 16, 8, 9, -8, -1, 32, 47013 }, // ͚
-    { 8, 8, 5, -4, 30, 16, 47045 }, // ͛
-    { 30, 8, 16, -15, -1, 60, 47061 }, // ͜
-    { 30, 8, 16, -15, 30, 60, 47121 }, // ͝
-    { 24, 3, 13, -12, 26, 18, 47181 }, // ͞
-    { 24, 3, 13, -12, -2, 18, 47199 }, // ͟
-    { 30, 6, 16, -15, 28, 45, 47217 }, // ͠
-    { 30, 8, 16, -15, 32, 60, 47262 }, // ͡
-    { 30, 8, 17, -14, -1, 60, 47322 }, // ͢
-    { 8, 9, 5, -4, 32, 18, 47382 }, // ͣ
-    { 9, 9, 6, -4, 32, 21, 47400 }, // ͤ
-    { 3, 12, 3, -1, 35, 9, 47421 }, // ͥ
-    { 9, 9, 6, -4, 32, 21, 47430 }, // ͦ
-    { 9, 9, 6, -4, 32, 21, 47451 }, // ͧ
-    { 7, 9, 5, -3, 32, 16, 47472 }, // ͨ
-    { 9, 12, 6, -4, 35, 27, 47488 }, // ͩ
-    { 9, 12, 6, -4, 35, 27, 47515 }, // ͪ
-    { 14, 9, 8, -7, 32, 32, 47542 }, // ͫ
-    { 6, 9, 5, -2, 32, 14, 47574 }, // ͬ
-    { 7, 11, 5, -3, 34, 20, 47588 }, // ͭ
-    { 9, 9, 6, -4, 32, 21, 47608 }, // ͮ
-    { 9, 9, 6, -4, 32, 21, 47629 }, // ͯ
-    { 24, 27, 25, 0, 27, 162, 47650 }, // Α
-    { 20, 27, 24, 3, 27, 135, 47812 }, // Β
-    { 15, 27, 19, 3, 27, 102, 47947 }, // Γ
-    { 24, 27, 25, 0, 27, 162, 48049 }, // Δ
-    { 16, 27, 21, 3, 27, 108, 48211 }, // Ε
-    { 19, 27, 21, 1, 27, 129, 48319 }, // Ζ
-    { 22, 27, 28, 3, 27, 149, 48448 }, // Η
-    { 25, 29, 29, 2, 28, 182, 48597 }, // Θ
-    { 11, 27, 13, 1, 27, 75, 48779 }, // Ι
-    { 21, 27, 25, 3, 27, 142, 48854 }, // Κ
-    { 23, 27, 24, 0, 27, 156, 48996 }, // Λ
-    { 28, 27, 34, 3, 27, 189, 49152 }, // Μ
-    { 22, 27, 29, 3, 27, 149, 49341 }, // Ν
-    { 20, 27, 23, 2, 27, 135, 49490 }, // Ξ
-    { 25, 29, 29, 2, 28, 182, 49625 }, // Ο
-    { 21, 27, 27, 3, 27, 142, 49807 }, // Π
-    { 18, 27, 23, 3, 27, 122, 49949 }, // Ρ
-    { 19, 27, 21, 1, 27, 129, 50071 }, // Σ
-    { 21, 27, 22, 0, 27, 142, 50200 }, // Τ
-    { 22, 27, 23, 0, 27, 149, 50342 }, // Υ
-    { 29, 27, 32, 1, 27, 196, 50491 }, // Φ
-    { 22, 27, 23, 0, 27, 149, 50687 }, // Χ
-    { 25, 27, 31, 3, 27, 169, 50836 }, // Ψ
-    { 26, 28, 27, 0, 28, 182, 51005 }, // Ω
-    { 21, 22, 24, 2, 21, 116, 51187 }, // α
-    { 18, 38, 23, 3, 29, 171, 51303 }, // β
-    { 19, 29, 20, 0, 21, 138, 51474 }, // γ
-    { 20, 30, 22, 1, 29, 150, 51612 }, // δ
-    { 16, 22, 18, 1, 21, 88, 51762 }, // ε
-    { 16, 37, 19, 2, 29, 148, 51850 }, // ζ
-    { 17, 30, 23, 3, 21, 128, 51998 }, // η
-    { 19, 30, 22, 2, 29, 143, 52126 }, // θ
-    { 9, 22, 13, 3, 21, 50, 52269 }, // ι
-    { 17, 21, 21, 3, 21, 90, 52319 }, // κ
-    { 20, 30, 21, 0, 29, 150, 52409 }, // λ
-    { 20, 30, 24, 3, 21, 150, 52559 }, // μ
-    { 19, 21, 20, 0, 21, 100, 52709 }, // ν
-    { 16, 37, 19, 2, 29, 148, 52809 }, // ξ
-    { 19, 22, 23, 2, 21, 105, 52957 }, // ο
-    { 24, 22, 25, 0, 21, 132, 53062 }, // π
-    { 19, 30, 23, 2, 21, 143, 53194 }, // ρ
-    { 16, 29, 19, 2, 21, 116, 53337 }, // ς
-    { 20, 22, 23, 2, 21, 110, 53453 }, // σ
-    { 18, 22, 19, 0, 21, 99, 53563 }, // τ
-    { 18, 22, 22, 2, 21, 99, 53662 }, // υ
-    { 24, 38, 27, 2, 29, 228, 53761 }, // φ
-    { 22, 30, 23, 0, 21, 165, 53989 }, // χ
-    { 24, 38, 28, 2, 29, 228, 54154 }, // ψ
-    { 26, 22, 30, 2, 21, 143, 54382 }, // ω
-    { 24, 34, 25, 0, 27, 204, 54525 }, // Ạ
-    { 17, 28, 21, 1, 21, 119, 54729 }, // ạ
-    { 24, 38, 25, 0, 38, 228, 54848 }, // Ả
-    { 17, 32, 21, 1, 31, 136, 55076 }, // ả
-    { 24, 37, 25, 0, 37, 222, 55212 }, // Ấ
-    { 20, 32, 22, 1, 31, 160, 55434 }, // ấ
-    { 24, 37, 25, 0, 37, 222, 55594 }, // Ầ
-    { 18, 32, 21, 0, 31, 144, 55816 }, // ầ
-    { 24, 39, 25, 0, 39, 234, 55960 }, // Ẩ
-    { 19, 34, 21, 1, 33, 162, 56194 }, // ẩ
-    { 24, 40, 25, 0, 40, 240, 56356 }, // Ẫ
-    { 17, 35, 21, 1, 34, 149, 56596 }, // ẫ
-    { 24, 43, 25, 0, 36, 258, 56745 }, // Ậ
-    { 17, 36, 21, 1, 29, 153, 57003 }, // ậ
-    { 24, 38, 25, 0, 38, 228, 57156 }, // Ắ
-    { 17, 33, 21, 1, 32, 141, 57384 }, // ắ
-    { 24, 38, 25, 0, 38, 228, 57525 }, // Ằ
-    { 17, 33, 21, 1, 32, 141, 57753 }, // ằ
-    { 24, 40, 25, 0, 40, 240, 57894 }, // Ẳ
-    { 17, 34, 21, 1, 33, 145, 58134 }, // ẳ
-    { 24, 40, 25, 0, 40, 240, 58279 }, // Ẵ
-    { 17, 35, 21, 1, 34, 149, 58519 }, // ẵ
-    { 24, 42, 25, 0, 35, 252, 58668 }, // Ặ
-    { 17, 35, 21, 1, 28, 149, 58920 }, // ặ
-    { 16, 34, 21, 3, 27, 136, 59069 }, // Ẹ
-    { 18, 28, 21, 2, 21, 126, 59205 }, // ẹ
-    { 16, 38, 21, 3, 38, 152, 59331 }, // Ẻ
-    { 18, 32, 21, 2, 31, 144, 59483 }, // ẻ
-    { 16, 35, 21, 3, 35, 140, 59627 }, // Ẽ
-    { 18, 29, 21, 2, 28, 131, 59767 }, // ẽ
-    { 18, 37, 22, 3, 37, 167, 59898 }, // Ế
-    { 19, 32, 22, 2, 31, 152, 60065 }, // ế
-    { 18, 37, 21, 1, 37, 167, 60217 }, // Ề
-    { 19, 32, 21, 1, 31, 152, 60384 }, // ề
-    { 17, 39, 21, 3, 39, 166, 60536 }, // Ể
-    { 18, 34, 21, 2, 33, 153, 60702 }, // ể
-    { 16, 40, 21, 3, 40, 160, 60855 }, // Ễ
-    { 18, 35, 21, 2, 34, 158, 61015 }, // ễ
-    { 16, 43, 21, 3, 36, 172, 61173 }, // Ệ
-    { 18, 36, 21, 2, 29, 162, 61345 }, // ệ
-    { 11, 37, 13, 1, 37, 102, 61507 }, // Ỉ
-    { 8, 31, 11, 2, 31, 62, 61609 }, // ỉ
-    { 11, 34, 13, 1, 27, 94, 61671 }, // Ị
-    { 5, 35, 10, 2, 28, 44, 61765 }, // ị
-    { 25, 35, 29, 2, 28, 219, 61809 }, // Ọ
-    { 19, 28, 23, 2, 21, 133, 62028 }, // ọ
-    { 25, 38, 29, 2, 37, 238, 62161 }, // Ỏ
-    { 19, 32, 23, 2, 31, 152, 62399 }, // ỏ
-    { 25, 38, 29, 2, 37, 238, 62551 }, // Ố
-    { 20, 32, 23, 2, 31, 160, 62789 }, // ố
-    { 25, 38, 29, 2, 37, 238, 62949 }, // Ồ
-    { 20, 32, 23, 1, 31, 160, 63187 }, // ồ
-    { 25, 40, 29, 2, 39, 250, 63347 }, // Ổ
-    { 19, 34, 23, 2, 33, 162, 63597 }, // ổ
-    { 25, 41, 29, 2, 40, 257, 63759 }, // Ỗ
-    { 19, 35, 23, 2, 34, 167, 64016 }, // ỗ
-    { 25, 43, 29, 2, 36, 269, 64183 }, // Ộ
-    { 19, 36, 23, 2, 29, 171, 64452 }, // ộ
-    { 29, 37, 32, 2, 36, 269, 64623 }, // Ớ
-    { 23, 30, 26, 2, 29, 173, 64892 }, // ớ
-    { 29, 37, 32, 2, 36, 269, 65065 }, // Ờ
-    { 23, 30, 26, 2, 29, 173, 65334 }, // ờ
-    { 29, 39, 32, 2, 38, 283, 65507 }, // Ở
-    { 23, 32, 26, 2, 31, 184, 65790 }, // ở
-    { 29, 36, 32, 2, 35, 261, 65974 }, // Ỡ
-    { 23, 29, 26, 2, 28, 167, 66235 }, // ỡ
-    { 29, 36, 32, 2, 29, 261, 66402 }, // Ợ
-    { 23, 31, 26, 2, 24, 179, 66663 }, // ợ
-    { 21, 34, 27, 3, 27, 179, 66842 }, // Ụ
-    { 18, 28, 23, 2, 21, 126, 67021 }, // ụ
-    { 21, 38, 27, 3, 37, 200, 67147 }, // Ủ
-    { 18, 32, 23, 2, 31, 144, 67347 }, // ủ
-    { 28, 37, 32, 3, 36, 259, 67491 }, // Ứ
-    { 25, 30, 28, 2, 29, 188, 67750 }, // ứ
-    { 28, 37, 32, 3, 36, 259, 67938 }, // Ừ
-    { 25, 30, 28, 2, 29, 188, 68197 }, // ừ
-    { 28, 38, 32, 3, 37, 266, 68385 }, // Ử
-    { 25, 32, 28, 2, 31, 200, 68651 }, // ử
-    { 28, 36, 32, 3, 35, 252, 68851 }, // Ữ
-    { 25, 29, 28, 2, 28, 182, 69103 }, // ữ
-    { 28, 36, 32, 3, 29, 252, 69285 }, // Ự
-    { 25, 31, 28, 2, 24, 194, 69537 }, // ự
-    { 22, 36, 23, 0, 36, 198, 69731 }, // Ỳ
-    { 20, 38, 21, 0, 29, 190, 69929 }, // ỳ
-    { 22, 34, 23, 0, 27, 187, 70119 }, // Ỵ
-    { 20, 30, 21, 0, 21, 150, 70306 }, // ỵ
-    { 22, 37, 23, 0, 37, 204, 70456 }, // Ỷ
-    { 20, 40, 21, 0, 31, 200, 70660 }, // ỷ
-    { 22, 35, 23, 0, 35, 193, 70860 }, // Ỹ
-    { 20, 37, 21, 0, 28, 185, 71053 }, // ỹ
-    { 0, 0, 19, 0, 0, 0, 71238 }, //  
-    { 0, 0, 38, 0, 0, 0, 71238 }, //  
-    { 0, 0, 19, 0, 0, 0, 71238 }, //  
-    { 0, 0, 38, 0, 0, 0, 71238 }, //  
-    { 0, 0, 12, 0, 0, 0, 71238 }, //  
-    { 0, 0, 9, 0, 0, 0, 71238 }, //  
-    { 0, 0, 6, 0, 0, 0, 71238 }, //  
-    { 0, 0, 21, 0, 0, 0, 71238 }, //  
-    { 0, 0, 10, 0, 0, 0, 71238 }, //  
-    { 0, 0, 6, 0, 0, 0, 71238 }, //  
-    { 0, 0, 4, 0, 0, 0, 71238 }, //  
-    { 0, 0, 1, 0, 0, 0, 71238 }, // ​
-    { 0, 0, 1, 0, 0, 0, 71238 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 71238 }, // ‍
-    { 9, 31, 9, -1, 26, 70, 71238 }, // ‎
-    { 9, 31, 2, -8, 26, 70, 71308 }, // ‏
-    { 10, 4, 12, 1, 12, 10, 71378 }, // ‐
-    { 10, 4, 12, 1, 12, 10, 71388 }, // ‑
-    { 19, 3, 21, 1, 15, 15, 71398 }, // ‒
-    { 17, 4, 19, 1, 12, 17, 71413 }, // –
-    { 35, 4, 38, 1, 12, 35, 71430 }, // —
-    { 35, 4, 38, 1, 12, 35, 71465 }, // ―
-    { 12, 39, 21, 4, 29, 117, 71500 }, // ‖
-    { 17, 9, 17, -1, 0, 39, 71617 }, // ‗
-    { 7, 10, 8, 0, 27, 18, 71656 }, // ‘
-    { 7, 10, 8, 0, 27, 18, 71674 }, // ’
-    { 6, 10, 9, 1, 5, 15, 71692 }, // ‚
-    { 7, 10, 8, 0, 27, 18, 71707 }, // ‛
-    { 14, 10, 15, 0, 27, 35, 71725 }, // “
-    { 14, 10, 15, 0, 27, 35, 71760 }, // ”
-    { 13, 10, 16, 1, 5, 33, 71795 }, // „
-    { 14, 10, 15, 0, 27, 35, 71828 }, // ‟
-    { 15, 29, 19, 2, 29, 109, 71863 }, // †
-    { 15, 29, 19, 2, 29, 109, 71972 }, // ‡
-    { 10, 10, 14, 2, 19, 25, 72081 }, // •
-    { 11, 12, 14, 2, 20, 33, 72106 }, // ‣
-    { 5, 6, 19, 7, 5, 8, 72139 }, // ․
-    { 16, 6, 20, 2, 5, 24, 72147 }, // ‥
-    { 25, 6, 30, 2, 5, 38, 72171 }, // …
-    { 6, 6, 10, 2, 12, 9, 72209 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 72218 }, //  
-    { 0, 0, 23, 0, 0, 0, 72218 }, //  
-    { 9, 28, 9, -1, 23, 63, 72218 }, // ‪
-    { 9, 28, 2, -8, 23, 63, 72281 }, // ‫
-    { 10, 31, 6, -5, 26, 78, 72344 }, // ‬
-    { 10, 31, 6, -5, 26, 78, 72422 }, // ‭
-    { 10, 31, 6, -5, 26, 78, 72500 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 72578 }, //  
-    { 42, 29, 44, 1, 28, 305, 72578 }, // ‰
-    { 56, 29, 58, 1, 28, 406, 72883 }, // ‱
-    { 9, 10, 11, 1, 27, 23, 73289 }, // ′
-    { 16, 10, 18, 1, 27, 40, 73312 }, // ″
-    { 22, 10, 24, 1, 27, 55, 73352 }, // ‴
-    { 9, 10, 9, -1, 27, 23, 73407 }, // ‵
-    { 15, 10, 17, -1, 27, 38, 73430 }, // ‶
-    { 21, 10, 23, -1, 27, 53, 73468 }, // ‷
-    { 15, 13, 16, 0, 4, 49, 73521 }, // ‸
-    { 10, 16, 12, 1, 18, 40, 73570 }, // ‹
-    { 10, 16, 12, 1, 18, 40, 73610 }, // ›
-    { 29, 29, 31, 1, 28, 211, 73650 }, // ※
-    { 14, 28, 19, 2, 27, 98, 73861 }, // ‼
-    { 16, 29, 17, 0, 28, 116, 73959 }, // ‽
-    { 20, 3, 20, -1, 31, 15, 74075 }, // ‾
-    { 22, 8, 23, 0, -1, 44, 74090 }, // ‿
-    { 22, 9, 23, 0, 30, 50, 74134 }, // ⁀
-    { 14, 25, 15, 0, 16, 88, 74184 }, // ⁁
-    { 42, 35, 43, 0, 29, 368, 74272 }, // ⁂
-    { 10, 4, 12, 1, 12, 10, 74640 }, // ⁃
-    { 20, 27, 13, -8, 27, 135, 74650 }, // ⁄
-    { 10, 33, 13, 2, 27, 83, 74785 }, // ⁅
-    { 10, 33, 12, 0, 27, 83, 74868 }, // ⁆
-    { 32, 29, 33, 0, 28, 232, 74951 }, // ⁇
-    { 23, 29, 25, 0, 28, 167, 75183 }, // ⁈
-    { 23, 29, 26, 2, 28, 167, 75350 }, // ⁉
-    { 19, 21, 21, 1, 21, 100, 75517 }, // ⁊
-    { 20, 34, 25, 3, 29, 170, 75617 }, // ⁋
-    { 19, 20, 24, 2, 21, 95, 75787 }, // ⁌
-    { 19, 20, 24, 3, 21, 95, 75882 }, // ⁍
-    { 19, 18, 21, 1, 10, 86, 75977 }, // ⁎
-    { 7, 26, 9, 1, 21, 46, 76063 }, // ⁏
-    { 22, 39, 23, 0, 30, 215, 76109 }, // ⁐
-    { 19, 37, 21, 1, 29, 176, 76324 }, // ⁑
-    { 14, 29, 15, 0, 28, 102, 76500 }, // ⁒
-    { 33, 6, 38, 2, 14, 50, 76602 }, // ⁓
-    { 22, 9, 23, 0, 0, 50, 76652 }, // ⁔
-    { 20, 20, 22, 1, 19, 100, 76702 }, // ⁕
-    { 17, 29, 19, 1, 28, 124, 76802 }, // ⁖
-    { 28, 10, 30, 1, 27, 70, 76926 }, // ⁗
-    { 28, 29, 31, 1, 28, 203, 76996 }, // ⁘
-    { 29, 29, 31, 1, 28, 211, 77199 }, // ⁙
-    { 6, 29, 8, 1, 28, 44, 77410 }, // ⁚
-    { 22, 30, 25, 1, 29, 165, 77454 }, // ⁛
-    { 28, 29, 30, 1, 28, 203, 77619 }, // ⁜
-    { 6, 28, 10, 2, 27, 42, 77822 }, // ⁝
-    { 6, 29, 10, 2, 28, 44, 77864 }, // ⁞
-    { 0, 0, 8, 0, 0, 0, 77908 }, //  
-    { 0, 0, 23, 0, 0, 0, 77908 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 77908 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 77908 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 77908 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 77908 }, // ⁤
-    { 0, 0, 1, 0, 0, 0, 77908 }, // ⁦
-    { 0, 0, 1, 0, 0, 0, 77908 }, // ⁧
-    { 0, 0, 1, 0, 0, 0, 77908 }, // ⁨
-    { 0, 0, 1, 0, 0, 0, 77908 }, // ⁩
-    { 10, 31, 6, -5, 26, 78, 77908 }, // ⁪
-    { 10, 31, 6, -5, 26, 78, 77986 }, // ⁫
-    { 10, 31, 6, -5, 26, 78, 78064 }, // ⁬
-    { 10, 31, 6, -5, 26, 78, 78142 }, // ⁭
-    { 10, 31, 6, -5, 26, 78, 78220 }, // ⁮
-    { 10, 31, 6, -5, 26, 78, 78298 }, // ⁯
-    { 13, 17, 14, 0, 32, 56, 78376 }, // ⁰
-    { 4, 18, 6, 1, 28, 18, 78432 }, // ⁱ
-    { 13, 17, 14, 0, 32, 56, 78450 }, // ⁴
-    { 11, 17, 13, 1, 32, 47, 78506 }, // ⁵
-    { 13, 17, 14, 0, 32, 56, 78553 }, // ⁶
-    { 12, 17, 14, 1, 32, 51, 78609 }, // ⁷
-    { 13, 17, 14, 0, 32, 56, 78660 }, // ⁸
-    { 13, 18, 14, 0, 33, 59, 78716 }, // ⁹
-    { 11, 11, 13, 1, 28, 31, 78775 }, // ⁺
-    { 11, 3, 13, 1, 24, 9, 78806 }, // ⁻
-    { 11, 7, 13, 1, 26, 20, 78815 }, // ⁼
-    { 7, 22, 10, 2, 35, 39, 78835 }, // ⁽
-    { 7, 22, 8, 0, 35, 39, 78874 }, // ⁾
-    { 12, 14, 15, 2, 24, 42, 78913 }, // ⁿ
-    { 13, 17, 14, 0, 12, 56, 78955 }, // ₀
-    { 8, 17, 13, 1, 12, 34, 79011 }, // ₁
-    { 12, 17, 13, 0, 12, 51, 79045 }, // ₂
-    { 13, 17, 14, 0, 12, 56, 79096 }, // ₃
-    { 13, 17, 14, 0, 12, 56, 79152 }, // ₄
-    { 11, 17, 13, 1, 12, 47, 79208 }, // ₅
-    { 13, 17, 14, 0, 12, 56, 79255 }, // ₆
-    { 12, 17, 14, 1, 12, 51, 79311 }, // ₇
-    { 13, 17, 14, 0, 12, 56, 79362 }, // ₈
-    { 13, 18, 14, 0, 13, 59, 79418 }, // ₉
-    { 11, 11, 13, 1, 8, 31, 79477 }, // ₊
-    { 11, 3, 13, 1, 4, 9, 79508 }, // ₋
-    { 11, 7, 13, 1, 6, 20, 79517 }, // ₌
-    { 7, 22, 10, 2, 14, 39, 79537 }, // ₍
-    { 7, 22, 8, 0, 14, 39, 79576 }, // ₎
-    { 11, 13, 14, 1, 9, 36, 79615 }, // ₐ
-    { 12, 13, 14, 1, 9, 39, 79651 }, // ₑ
-    { 13, 13, 15, 1, 9, 43, 79690 }, // ₒ
-    { 13, 13, 14, 0, 9, 43, 79733 }, // ₓ
-    { 12, 13, 14, 1, 9, 39, 79776 }, // ₔ
-    { 12, 18, 15, 2, 14, 54, 79815 }, // ₕ
-    { 11, 18, 14, 2, 14, 50, 79869 }, // ₖ
-    { 3, 18, 6, 2, 14, 14, 79919 }, // ₗ
-    { 19, 13, 23, 2, 9, 62, 79933 }, // ₘ
-    { 12, 13, 15, 2, 9, 39, 79995 }, // ₙ
-    { 12, 18, 15, 2, 9, 54, 80034 }, // ₚ
-    { 10, 13, 12, 1, 9, 33, 80088 }, // ₛ
-    { 9, 16, 10, 0, 12, 36, 80121 }, // ₜ
-    { 20, 28, 22, 1, 28, 140, 80157 }, // ₠
-    { 20, 32, 22, 1, 29, 160, 80297 }, // ₡
-    { 19, 29, 22, 2, 28, 138, 80457 }, // ₢
-    { 19, 27, 21, 1, 27, 129, 80595 }, // ₣
-    { 20, 28, 22, 1, 28, 140, 80724 }, // ₤
-    { 30, 30, 35, 3, 25, 225, 80864 }, // ₥
-    { 22, 27, 23, 0, 27, 149, 81089 }, // ₦
-    { 26, 28, 29, 2, 27, 182, 81238 }, // ₧
-    { 27, 28, 31, 3, 27, 189, 81420 }, // ₨
-    { 25, 27, 26, 0, 27, 169, 81609 }, // ₩
-    { 24, 27, 30, 3, 27, 162, 81778 }, // ₪
-    { 21, 35, 24, 2, 29, 184, 81940 }, // ₫
-    { 21, 29, 22, 0, 28, 153, 82124 }, // €
-    { 22, 27, 23, 0, 27, 149, 82277 }, // ₭
-    { 21, 27, 22, 0, 27, 142, 82426 }, // ₮
-    { 36, 37, 37, 0, 28, 333, 82568 }, // ₯
-    { 20, 37, 21, 0, 28, 185, 82901 }, // ₰
-    { 22, 27, 23, 0, 27, 149, 83086 }, // ₱
-    { 23, 32, 27, 2, 29, 184, 83235 }, // ₲
-    { 23, 27, 24, 0, 27, 156, 83419 }, // ₳
-    { 21, 29, 22, 0, 28, 153, 83575 }, // ₴
-    { 21, 32, 24, 2, 29, 168, 83728 }, // ₵
-    { 23, 26, 24, 0, 25, 150, 83896 }, // ₶
-    { 26, 31, 27, 0, 28, 202, 84046 }, // ₷
-    { 20, 27, 21, 0, 27, 135, 84248 }, // ₸
-    { 17, 27, 21, 2, 27, 115, 84383 }, // ₹
-    { 21, 28, 22, 0, 27, 147, 84498 }, // ₺
-    { 29, 29, 30, 0, 28, 211, 84645 }, // ₻
-    { 26, 27, 30, 2, 27, 176, 84856 }, // ₼
-    { 21, 27, 22, 0, 27, 142, 85032 }, // ₽
-    { 25, 29, 29, 2, 29, 182, 85174 }, // ₾
-    { 18, 35, 22, 3, 31, 158, 85356 }, // ₿
-    { 16, 27, 18, 1, 21, 108, 85514 }, // ⃀
-    { 19, 4, 21, 1, 15, 19, 85622 }, // −
-    { 35, 35, 38, 1, 29, 307, 85641 }, // �
+    { 6, 28, 10, 2, 27, 41, 0 }, // !
+    { 11, 10, 15, 2, 27, 31, 41 }, // "
+    { 24, 27, 25, 0, 27, 107, 72 }, // #
+    { 18, 32, 21, 2, 29, 96, 179 }, // $
+    { 29, 29, 31, 1, 28, 146, 275 }, // %
+    { 27, 29, 29, 1, 28, 116, 421 }, // &
+    { 4, 10, 8, 2, 27, 14, 537 }, // '
+    { 10, 33, 12, 1, 27, 51, 551 }, // (
+    { 9, 33, 11, 1, 27, 53, 602 }, // )
+    { 19, 18, 21, 1, 29, 56, 655 }, // *
+    { 19, 19, 21, 1, 23, 48, 711 }, // +
+    { 7, 10, 10, 1, 5, 16, 759 }, // ,
+    { 10, 4, 12, 1, 12, 14, 775 }, // -
+    { 6, 6, 10, 2, 5, 9, 789 }, // .
+    { 14, 27, 15, 0, 27, 56, 798 }, // /
+    { 19, 29, 21, 1, 28, 95, 854 }, // 0
+    { 11, 27, 21, 3, 27, 48, 949 }, // 1
+    { 19, 28, 21, 1, 28, 72, 997 }, // 2
+    { 19, 29, 21, 1, 28, 79, 1069 }, // 3
+    { 21, 27, 22, 0, 27, 80, 1148 }, // 4
+    { 18, 28, 21, 2, 27, 80, 1228 }, // 5
+    { 18, 29, 21, 2, 28, 90, 1308 }, // 6
+    { 19, 27, 21, 1, 27, 60, 1398 }, // 7
+    { 19, 29, 21, 1, 28, 97, 1458 }, // 8
+    { 19, 29, 21, 1, 28, 90, 1555 }, // 9
+    { 6, 22, 10, 2, 21, 21, 1645 }, // :
+    { 7, 26, 10, 1, 21, 30, 1666 }, // ;
+    { 19, 19, 21, 1, 23, 52, 1696 }, // <
+    { 18, 11, 21, 2, 19, 38, 1748 }, // =
+    { 19, 19, 21, 1, 23, 51, 1786 }, // >
+    { 16, 29, 17, 0, 28, 58, 1837 }, // ?
+    { 30, 31, 34, 2, 27, 156, 1895 }, // @
+    { 24, 27, 25, 0, 27, 96, 2051 }, // A
+    { 20, 27, 24, 3, 27, 101, 2147 }, // B
+    { 21, 29, 24, 2, 28, 82, 2248 }, // C
+    { 23, 27, 27, 3, 27, 102, 2330 }, // D
+    { 16, 27, 21, 3, 27, 72, 2432 }, // E
+    { 16, 27, 20, 3, 27, 69, 2504 }, // F
+    { 23, 29, 27, 2, 28, 98, 2573 }, // G
+    { 22, 27, 28, 3, 27, 105, 2671 }, // H
+    { 11, 27, 13, 1, 27, 48, 2776 }, // I
+    { 10, 35, 10, -3, 27, 55, 2824 }, // J
+    { 21, 27, 25, 3, 27, 91, 2879 }, // K
+    { 16, 27, 20, 3, 27, 57, 2970 }, // L
+    { 28, 27, 34, 3, 27, 140, 3027 }, // M
+    { 22, 27, 29, 3, 27, 106, 3167 }, // N
+    { 25, 29, 29, 2, 28, 104, 3273 }, // O
+    { 18, 27, 23, 3, 27, 81, 3377 }, // P
+    { 25, 35, 29, 2, 28, 120, 3458 }, // Q
+    { 20, 27, 24, 3, 27, 90, 3578 }, // R
+    { 18, 29, 21, 1, 28, 77, 3668 }, // S
+    { 21, 27, 22, 0, 27, 71, 3745 }, // T
+    { 21, 28, 27, 3, 27, 89, 3816 }, // U
+    { 23, 27, 24, 0, 27, 89, 3905 }, // V
+    { 35, 27, 36, 0, 27, 155, 3994 }, // W
+    { 22, 27, 23, 0, 27, 87, 4149 }, // X
+    { 22, 27, 23, 0, 27, 80, 4236 }, // Y
+    { 19, 27, 21, 1, 27, 62, 4316 }, // Z
+    { 9, 33, 13, 3, 27, 36, 4378 }, // [
+    { 14, 27, 15, 0, 27, 53, 4414 }, // <backslash>
+    { 10, 33, 12, 0, 27, 53, 4467 }, // ]
+    { 20, 17, 22, 1, 27, 53, 4520 }, // ^
+    { 18, 3, 18, -1, -3, 15, 4573 }, // _
+    { 9, 7, 11, 1, 29, 11, 4588 }, // `
+    { 17, 22, 21, 1, 21, 69, 4599 }, // a
+    { 18, 30, 23, 3, 29, 90, 4668 }, // b
+    { 15, 22, 18, 2, 21, 57, 4758 }, // c
+    { 18, 30, 23, 2, 29, 90, 4815 }, // d
+    { 18, 22, 21, 2, 21, 73, 4905 }, // e
+    { 15, 29, 16, 0, 29, 66, 4978 }, // f
+    { 18, 30, 23, 2, 21, 97, 5044 }, // g
+    { 18, 29, 23, 3, 29, 85, 5141 }, // h
+    { 5, 28, 10, 2, 28, 38, 5226 }, // i
+    { 10, 37, 10, -3, 28, 54, 5264 }, // j
+    { 17, 29, 21, 3, 29, 77, 5318 }, // k
+    { 4, 29, 10, 3, 29, 30, 5395 }, // l
+    { 30, 21, 35, 3, 21, 105, 5425 }, // m
+    { 18, 21, 23, 3, 21, 67, 5530 }, // n
+    { 19, 22, 23, 2, 21, 71, 5597 }, // o
+    { 18, 30, 23, 3, 21, 89, 5668 }, // p
+    { 18, 30, 23, 2, 21, 90, 5757 }, // q
+    { 12, 21, 16, 3, 21, 36, 5847 }, // r
+    { 16, 22, 18, 1, 21, 61, 5883 }, // s
+    { 13, 26, 14, 0, 25, 59, 5944 }, // t
+    { 18, 22, 23, 2, 21, 75, 6003 }, // u
+    { 20, 21, 21, 0, 21, 66, 6078 }, // v
+    { 30, 21, 31, 0, 21, 109, 6144 }, // w
+    { 20, 21, 21, 0, 21, 63, 6253 }, // x
+    { 20, 30, 21, 0, 21, 86, 6316 }, // y
+    { 16, 21, 18, 1, 21, 55, 6402 }, // z
+    { 13, 33, 15, 1, 27, 64, 6457 }, // {
+    { 4, 39, 21, 8, 29, 58, 6521 }, // |
+    { 13, 33, 15, 1, 27, 74, 6579 }, // }
+    { 19, 6, 21, 1, 16, 22, 6653 }, // ~
+    { 0, 0, 10, 0, 0, 0, 6675 }, //  
+    { 6, 28, 10, 2, 21, 40, 6675 }, // ¡
+    { 16, 29, 21, 3, 28, 66, 6715 }, // ¢
+    { 20, 28, 22, 1, 28, 72, 6781 }, // £
+    { 18, 18, 21, 2, 22, 65, 6853 }, // ¤
+    { 21, 27, 22, 0, 27, 89, 6918 }, // ¥
+    { 4, 39, 21, 8, 29, 48, 7007 }, // ¦
+    { 15, 30, 19, 2, 29, 83, 7055 }, // §
+    { 12, 5, 22, 5, 28, 12, 7138 }, // ¨
+    { 29, 29, 31, 1, 28, 133, 7150 }, // ©
+    { 11, 14, 13, 1, 28, 38, 7283 }, // ª
+    { 17, 16, 19, 1, 18, 49, 7321 }, // «
+    { 19, 11, 21, 1, 15, 33, 7370 }, // ¬
+    { 10, 4, 12, 1, 12, 14, 7403 }, // ­
+    { 29, 29, 31, 1, 28, 150, 7417 }, // ®
+    { 20, 3, 20, -1, 31, 16, 7567 }, // ¯
+    { 12, 13, 16, 2, 28, 31, 7583 }, // °
+    { 19, 23, 21, 1, 23, 66, 7614 }, // ±
+    { 12, 17, 13, 0, 32, 37, 7680 }, // ²
+    { 13, 17, 14, 0, 32, 44, 7717 }, // ³
+    { 9, 7, 11, 1, 29, 13, 7761 }, // ´
+    { 18, 30, 23, 3, 21, 87, 7774 }, // µ
+    { 19, 34, 25, 2, 29, 154, 7861 }, // ¶
+    { 6, 6, 10, 2, 16, 9, 8015 }, // ·
+    { 8, 9, 9, 0, 0, 15, 8024 }, // ¸
+    { 8, 17, 13, 1, 32, 31, 8039 }, // ¹
+    { 12, 14, 14, 1, 28, 36, 8070 }, // º
+    { 17, 16, 19, 1, 18, 48, 8106 }, // »
+    { 27, 27, 29, 1, 27, 122, 8154 }, // ¼
+    { 28, 27, 29, 0, 27, 125, 8276 }, // ½
+    { 29, 28, 30, 0, 28, 136, 8401 }, // ¾
+    { 16, 29, 17, 0, 21, 61, 8537 }, // ¿
+    { 24, 36, 25, 0, 36, 119, 8598 }, // À
+    { 24, 36, 25, 0, 36, 116, 8717 }, // Á
+    { 24, 36, 25, 0, 36, 121, 8833 }, // Â
+    { 24, 35, 25, 0, 35, 122, 8954 }, // Ã
+    { 24, 35, 25, 0, 35, 114, 9076 }, // Ä
+    { 24, 33, 25, 0, 33, 116, 9190 }, // Å
+    { 32, 27, 33, -1, 27, 116, 9306 }, // Æ
+    { 21, 37, 24, 2, 28, 102, 9422 }, // Ç
+    { 16, 36, 21, 3, 36, 88, 9524 }, // È
+    { 16, 36, 21, 3, 36, 91, 9612 }, // É
+    { 16, 36, 21, 3, 36, 95, 9703 }, // Ê
+    { 16, 35, 21, 3, 35, 92, 9798 }, // Ë
+    { 11, 36, 13, 1, 36, 61, 9890 }, // Ì
+    { 11, 36, 13, 1, 36, 63, 9951 }, // Í
+    { 13, 36, 14, 0, 36, 80, 10014 }, // Î
+    { 11, 35, 13, 1, 35, 66, 10094 }, // Ï
+    { 25, 27, 27, 1, 27, 105, 10160 }, // Ð
+    { 22, 35, 29, 3, 35, 131, 10265 }, // Ñ
+    { 25, 37, 29, 2, 36, 125, 10396 }, // Ò
+    { 25, 37, 29, 2, 36, 125, 10521 }, // Ó
+    { 25, 37, 29, 2, 36, 131, 10646 }, // Ô
+    { 25, 36, 29, 2, 35, 129, 10777 }, // Õ
+    { 25, 36, 29, 2, 35, 126, 10906 }, // Ö
+    { 17, 18, 21, 2, 22, 50, 11032 }, // ×
+    { 25, 30, 29, 2, 28, 125, 11082 }, // Ø
+    { 21, 37, 27, 3, 36, 111, 11207 }, // Ù
+    { 21, 37, 27, 3, 36, 108, 11318 }, // Ú
+    { 21, 37, 27, 3, 36, 115, 11426 }, // Û
+    { 21, 36, 27, 3, 35, 109, 11541 }, // Ü
+    { 22, 36, 23, 0, 36, 103, 11650 }, // Ý
+    { 18, 27, 23, 3, 27, 76, 11753 }, // Þ
+    { 19, 30, 24, 3, 29, 105, 11829 }, // ß
+    { 17, 30, 21, 1, 29, 84, 11934 }, // à
+    { 17, 30, 21, 1, 29, 87, 12018 }, // á
+    { 17, 30, 21, 1, 29, 92, 12105 }, // â
+    { 17, 29, 21, 1, 28, 90, 12197 }, // ã
+    { 17, 29, 21, 1, 28, 88, 12287 }, // ä
+    { 17, 32, 21, 1, 31, 97, 12375 }, // å
+    { 30, 22, 32, 1, 21, 114, 12472 }, // æ
+    { 15, 30, 18, 2, 21, 73, 12586 }, // ç
+    { 18, 30, 21, 2, 29, 89, 12659 }, // è
+    { 18, 30, 21, 2, 29, 90, 12748 }, // é
+    { 18, 30, 21, 2, 29, 95, 12838 }, // ê
+    { 18, 29, 21, 2, 28, 91, 12933 }, // ë
+    { 9, 29, 10, -1, 29, 44, 13024 }, // ì
+    { 9, 29, 12, 2, 29, 43, 13068 }, // í
+    { 14, 29, 13, -2, 29, 61, 13111 }, // î
+    { 12, 28, 12, -1, 28, 44, 13172 }, // ï
+    { 19, 30, 23, 2, 29, 98, 13216 }, // ð
+    { 18, 28, 23, 3, 28, 89, 13314 }, // ñ
+    { 19, 30, 23, 2, 29, 87, 13403 }, // ò
+    { 19, 30, 23, 2, 29, 89, 13490 }, // ó
+    { 19, 30, 23, 2, 29, 94, 13579 }, // ô
+    { 19, 29, 23, 2, 28, 92, 13673 }, // õ
+    { 19, 29, 23, 2, 28, 91, 13765 }, // ö
+    { 19, 18, 21, 1, 22, 46, 13856 }, // ÷
+    { 19, 24, 23, 2, 22, 89, 13902 }, // ø
+    { 18, 30, 23, 2, 29, 90, 13991 }, // ù
+    { 18, 30, 23, 2, 29, 92, 14081 }, // ú
+    { 18, 30, 23, 2, 29, 97, 14173 }, // û
+    { 18, 29, 23, 2, 28, 93, 14270 }, // ü
+    { 20, 38, 21, 0, 29, 105, 14363 }, // ý
+    { 18, 38, 23, 3, 29, 106, 14468 }, // þ
+    { 20, 37, 21, 0, 28, 107, 14574 }, // ÿ
+    { 24, 33, 25, 0, 33, 119, 14681 }, // Ā
+    { 17, 27, 21, 1, 26, 87, 14800 }, // ā
+    { 24, 35, 25, 0, 35, 120, 14887 }, // Ă
+    { 17, 29, 21, 1, 28, 87, 15007 }, // ă
+    { 24, 36, 25, 0, 27, 117, 15094 }, // Ą
+    { 18, 30, 21, 1, 21, 86, 15211 }, // ą
+    { 21, 37, 24, 2, 36, 100, 15297 }, // Ć
+    { 15, 30, 18, 2, 29, 74, 15397 }, // ć
+    { 21, 37, 24, 2, 36, 105, 15471 }, // Ĉ
+    { 15, 30, 18, 2, 29, 79, 15576 }, // ĉ
+    { 21, 36, 24, 2, 35, 97, 15655 }, // Ċ
+    { 15, 29, 18, 2, 28, 69, 15752 }, // ċ
+    { 21, 37, 24, 2, 36, 105, 15821 }, // Č
+    { 15, 30, 18, 2, 29, 78, 15926 }, // č
+    { 23, 36, 27, 3, 36, 128, 16004 }, // Ď
+    { 24, 30, 27, 2, 29, 111, 16132 }, // ď
+    { 25, 27, 27, 1, 27, 105, 16243 }, // Đ
+    { 21, 30, 24, 2, 29, 105, 16348 }, // đ
+    { 16, 33, 21, 3, 33, 91, 16453 }, // Ē
+    { 18, 27, 21, 2, 26, 90, 16544 }, // ē
+    { 16, 35, 21, 3, 35, 91, 16634 }, // Ĕ
+    { 18, 29, 21, 2, 28, 92, 16725 }, // ĕ
+    { 16, 35, 21, 3, 35, 86, 16817 }, // Ė
+    { 18, 29, 21, 2, 28, 85, 16903 }, // ė
+    { 16, 36, 21, 3, 27, 91, 16988 }, // Ę
+    { 18, 30, 21, 2, 21, 89, 17079 }, // ę
+    { 16, 36, 21, 3, 36, 95, 17168 }, // Ě
+    { 18, 30, 21, 2, 29, 95, 17263 }, // ě
+    { 23, 37, 27, 2, 36, 122, 17358 }, // Ĝ
+    { 18, 38, 23, 2, 29, 117, 17480 }, // ĝ
+    { 23, 36, 27, 2, 35, 120, 17597 }, // Ğ
+    { 18, 37, 23, 2, 28, 117, 17717 }, // ğ
+    { 23, 36, 27, 2, 35, 114, 17834 }, // Ġ
+    { 18, 37, 23, 2, 28, 109, 17948 }, // ġ
+    { 23, 37, 27, 2, 28, 117, 18057 }, // Ģ
+    { 18, 38, 23, 2, 29, 113, 18174 }, // ģ
+    { 22, 36, 28, 3, 36, 130, 18287 }, // Ĥ
+    { 23, 37, 23, -2, 37, 113, 18417 }, // ĥ
+    { 28, 27, 29, 0, 27, 123, 18530 }, // Ħ
+    { 21, 29, 23, 0, 29, 94, 18653 }, // ħ
+    { 15, 35, 15, -1, 35, 81, 18747 }, // Ĩ
+    { 15, 28, 13, -3, 28, 63, 18828 }, // ĩ
+    { 12, 33, 13, 0, 33, 66, 18891 }, // Ī
+    { 12, 26, 12, -1, 26, 48, 18957 }, // ī
+    { 13, 35, 14, 0, 35, 78, 19005 }, // Ĭ
+    { 13, 28, 12, -2, 28, 59, 19083 }, // ĭ
+    { 11, 36, 13, 1, 27, 60, 19142 }, // Į
+    { 7, 37, 10, 1, 28, 51, 19202 }, // į
+    { 11, 35, 13, 1, 35, 59, 19253 }, // İ
+    { 4, 21, 10, 3, 21, 21, 19312 }, // ı
+    { 19, 35, 23, 1, 27, 104, 19333 }, // Ĳ
+    { 15, 37, 19, 2, 28, 85, 19437 }, // ĳ
+    { 15, 44, 13, -3, 36, 91, 19522 }, // Ĵ
+    { 15, 38, 13, -3, 29, 79, 19613 }, // ĵ
+    { 21, 36, 25, 3, 27, 112, 19692 }, // Ķ
+    { 17, 38, 21, 3, 29, 94, 19804 }, // ķ
+    { 17, 21, 21, 3, 21, 62, 19898 }, // ĸ
+    { 16, 36, 20, 3, 36, 75, 19960 }, // Ĺ
+    { 9, 37, 12, 2, 37, 56, 20035 }, // ĺ
+    { 16, 36, 20, 3, 27, 74, 20091 }, // Ļ
+    { 6, 38, 10, 2, 29, 56, 20165 }, // ļ
+    { 16, 27, 20, 3, 27, 63, 20221 }, // Ľ
+    { 10, 29, 14, 3, 29, 55, 20284 }, // ľ
+    { 16, 27, 20, 3, 27, 63, 20339 }, // Ŀ
+    { 9, 29, 13, 3, 29, 50, 20402 }, // ŀ
+    { 19, 27, 20, 0, 27, 67, 20452 }, // Ł
+    { 12, 29, 12, -1, 29, 49, 20519 }, // ł
+    { 22, 36, 29, 3, 36, 128, 20568 }, // Ń
+    { 18, 29, 23, 3, 29, 85, 20696 }, // ń
+    { 22, 36, 29, 3, 27, 127, 20781 }, // Ņ
+    { 18, 30, 23, 3, 21, 85, 20908 }, // ņ
+    { 22, 36, 29, 3, 36, 132, 20993 }, // Ň
+    { 18, 29, 23, 3, 29, 90, 21125 }, // ň
+    { 23, 27, 26, 0, 27, 90, 21215 }, // ŉ
+    { 22, 35, 29, 3, 27, 126, 21305 }, // Ŋ
+    { 18, 30, 23, 3, 21, 85, 21431 }, // ŋ
+    { 25, 34, 29, 2, 33, 124, 21516 }, // Ō
+    { 19, 27, 23, 2, 26, 88, 21640 }, // ō
+    { 25, 36, 29, 2, 35, 126, 21728 }, // Ŏ
+    { 19, 29, 23, 2, 28, 91, 21854 }, // ŏ
+    { 25, 37, 29, 2, 36, 133, 21945 }, // Ő
+    { 19, 30, 23, 2, 29, 96, 22078 }, // ő
+    { 31, 29, 35, 2, 28, 131, 22174 }, // Œ
+    { 32, 22, 35, 2, 21, 127, 22305 }, // œ
+    { 20, 36, 24, 3, 36, 110, 22432 }, // Ŕ
+    { 12, 29, 16, 3, 29, 49, 22542 }, // ŕ
+    { 20, 36, 24, 3, 27, 109, 22591 }, // Ŗ
+    { 13, 30, 16, 2, 21, 62, 22700 }, // ŗ
+    { 20, 36, 24, 3, 36, 115, 22762 }, // Ř
+    { 14, 29, 17, 2, 29, 68, 22877 }, // ř
+    { 18, 37, 21, 1, 36, 95, 22945 }, // Ś
+    { 16, 30, 18, 1, 29, 77, 23040 }, // ś
+    { 18, 37, 21, 1, 36, 100, 23117 }, // Ŝ
+    { 16, 30, 18, 1, 29, 80, 23217 }, // ŝ
+    { 18, 37, 21, 1, 28, 95, 23297 }, // Ş
+    { 16, 30, 18, 1, 21, 79, 23392 }, // ş
+    { 18, 37, 21, 1, 36, 99, 23471 }, // Š
+    { 16, 30, 18, 1, 29, 82, 23570 }, // š
+    { 21, 36, 22, 0, 27, 94, 23652 }, // Ţ
+    { 13, 34, 14, 0, 25, 75, 23746 }, // ţ
+    { 21, 36, 22, 0, 36, 96, 23821 }, // Ť
+    { 18, 30, 19, 0, 29, 73, 23917 }, // ť
+    { 21, 27, 22, 0, 27, 73, 23990 }, // Ŧ
+    { 13, 26, 14, 0, 25, 61, 24063 }, // ŧ
+    { 21, 36, 27, 3, 35, 113, 24124 }, // Ũ
+    { 18, 29, 23, 2, 28, 96, 24237 }, // ũ
+    { 21, 34, 27, 3, 33, 110, 24333 }, // Ū
+    { 18, 27, 23, 2, 26, 92, 24443 }, // ū
+    { 21, 36, 27, 3, 35, 112, 24535 }, // Ŭ
+    { 18, 29, 23, 2, 28, 93, 24647 }, // ŭ
+    { 21, 39, 27, 3, 38, 122, 24740 }, // Ů
+    { 18, 32, 23, 2, 31, 105, 24862 }, // ů
+    { 21, 37, 27, 3, 36, 119, 24967 }, // Ű
+    { 18, 30, 23, 2, 29, 99, 25086 }, // ű
+    { 21, 36, 27, 3, 27, 108, 25185 }, // Ų
+    { 19, 30, 23, 2, 21, 93, 25293 }, // ų
+    { 35, 36, 36, 0, 36, 189, 25386 }, // Ŵ
+    { 30, 29, 31, 0, 29, 138, 25575 }, // ŵ
+    { 22, 36, 23, 0, 36, 107, 25713 }, // Ŷ
+    { 20, 38, 21, 0, 29, 110, 25820 }, // ŷ
+    { 22, 35, 23, 0, 35, 102, 25930 }, // Ÿ
+    { 19, 36, 21, 1, 36, 78, 26032 }, // Ź
+    { 16, 29, 18, 1, 29, 70, 26110 }, // ź
+    { 19, 35, 21, 1, 35, 76, 26180 }, // Ż
+    { 16, 28, 18, 1, 28, 66, 26256 }, // ż
+    { 19, 36, 21, 1, 36, 86, 26322 }, // Ž
+    { 16, 29, 18, 1, 29, 75, 26408 }, // ž
+    { 11, 29, 15, 3, 29, 50, 26483 }, // ſ
+    { 29, 30, 32, 2, 29, 120, 26533 }, // Ơ
+    { 23, 25, 26, 2, 24, 88, 26653 }, // ơ
+    { 35, 29, 40, 2, 28, 141, 26741 }, // Ƣ
+    { 27, 30, 32, 2, 21, 139, 26882 }, // ƣ
+    { 24, 27, 26, 0, 27, 99, 27021 }, // Ƥ
+    { 18, 38, 23, 3, 29, 110, 27120 }, // ƥ
+    { 20, 31, 24, 3, 27, 95, 27230 }, // Ʀ
+    { 18, 29, 21, 1, 28, 75, 27325 }, // Ƨ
+    { 16, 22, 18, 1, 21, 59, 27400 }, // ƨ
+    { 19, 27, 21, 1, 27, 62, 27459 }, // Ʃ
+    { 17, 38, 17, -1, 29, 86, 27521 }, // ƪ
+    { 13, 34, 14, 0, 25, 77, 27607 }, // ƫ
+    { 22, 27, 23, 0, 27, 77, 27684 }, // Ƭ
+    { 13, 30, 14, 0, 29, 70, 27761 }, // ƭ
+    { 21, 36, 22, 0, 27, 92, 27831 }, // Ʈ
+    { 28, 30, 32, 3, 29, 115, 27923 }, // Ư
+    { 25, 25, 28, 2, 24, 91, 28038 }, // ư
+    { 9, 7, 0, -19, 29, 11, 28129 }, // ̀
+    { 9, 7, 0, -13, 29, 11, 28140 }, // ́
+    { 14, 7, 8, -7, 29, 19, 28151 }, // ̂
+    { 15, 6, 0, -19, 28, 20, 28170 }, // ̃
+    { 12, 4, 7, -6, 26, 17, 28190 }, // ̄
+    { 16, 4, 9, -8, 32, 13, 28207 }, // ̅
+    { 12, 6, 7, -6, 28, 17, 28220 }, // ̆
+    { 4, 5, 3, -2, 28, 7, 28237 }, // ̇
+    { 12, 5, 7, -6, 28, 11, 28244 }, // ̈
+    { 7, 9, 0, -14, 31, 18, 28255 }, // ̉
+    { 10, 9, 6, -5, 31, 21, 28273 }, // ̊
+    { 14, 7, 10, -5, 29, 23, 28294 }, // ̋
+    { 14, 7, 8, -7, 29, 20, 28317 }, // ̌
+    { 4, 7, 3, -2, 29, 12, 28337 }, // ̍
+    { 10, 7, 6, -5, 29, 27, 28349 }, // ̎
+    { 15, 7, 0, -20, 29, 24, 28376 }, // ̏
+    { 12, 10, 7, -6, 32, 26, 28400 }, // ̐
+    { 12, 6, 7, -6, 28, 17, 28426 }, // ̑
+    { 6, 10, 4, -3, 27, 17, 28443 }, // ̒
+    { 6, 10, 4, -3, 27, 17, 28460 }, // ̓
+    { 6, 10, 4, -3, 27, 16, 28477 }, // ̔
+    { 6, 10, 4, -3, 27, 18, 28493 }, // ̕
+    { 8, 7, 5, -4, -1, 12, 28511 }, // ̖
+    { 8, 7, 5, -4, -1, 13, 28523 }, // ̗
+    { 8, 8, 5, -4, -1, 15, 28536 }, // ̘
+    { 8, 8, 5, -4, -1, 15, 28551 }, // ̙
+    { 11, 10, 12, 0, 29, 22, 28566 }, // ̚
+    { 9, 9, 6, -4, 29, 14, 28588 }, // ̛
+    { 5, 9, 4, -2, 0, 13, 28602 }, // ̜
+    { 8, 7, 5, -4, -1, 11, 28615 }, // ̝
+    { 8, 7, 5, -4, -1, 8, 28626 }, // ̞
+    { 8, 8, 5, -4, -1, 12, 28634 }, // ̟
+    { 10, 3, 6, -5, -3, 9, 28646 }, // ̠
+    { 7, 11, 1, -7, 2, 16, 28655 }, // ̡
+    { 7, 11, 8, 0, 2, 16, 28671 }, // ̢
+    { 5, 5, 0, -14, -2, 8, 28687 }, // ̣
+    { 12, 5, 7, -6, -2, 11, 28695 }, // ̤
+    { 10, 9, 6, -5, 0, 21, 28706 }, // ̥
+    { 6, 7, 4, -3, -2, 12, 28727 }, // ̦
+    { 8, 9, 5, -4, 0, 16, 28739 }, // ̧
+    { 8, 10, 5, -4, 1, 14, 28755 }, // ̨
+    { 4, 7, 3, -2, -1, 12, 28769 }, // ̩
+    { 14, 8, 8, -7, -1, 17, 28781 }, // ̪
+    { 16, 5, 9, -8, -2, 20, 28798 }, // ̫
+    { 14, 7, 8, -7, -1, 20, 28818 }, // ̬
+    { 14, 7, 8, -7, -1, 19, 28838 }, // ̭
+    { 12, 6, 7, -6, -2, 17, 28857 }, // ̮
+    { 12, 6, 7, -6, -2, 17, 28874 }, // ̯
+    { 14, 6, 8, -7, -2, 20, 28891 }, // ̰
+    { 12, 4, 7, -6, -2, 17, 28911 }, // ̱
+    { 18, 3, 10, -9, -3, 15, 28928 }, // ̲
+    { 16, 9, 9, -8, 0, 27, 28943 }, // ̳
+    { 15, 6, 9, -7, 13, 20, 28970 }, // ̴
+    { 16, 4, 9, -8, 13, 13, 28990 }, // ̵
+    { 28, 3, 15, -14, 12, 23, 29003 }, // ̶
+    { 12, 9, 7, -6, 15, 16, 29026 }, // ̷
+    { 16, 32, 9, -8, 29, 64, 29042 }, // ̸
+    { 5, 9, 4, -2, 0, 12, 29106 }, // ̹
+    { 14, 8, 8, -7, -1, 17, 29118 }, // ̺
+    { 16, 8, 9, -8, -1, 30, 29135 }, // ̻
+    { 16, 5, 9, -8, -2, 20, 29165 }, // ̼
+    { 8, 9, 5, -4, 30, 19, 29185 }, // ̽
+    { 6, 12, 4, -3, 33, 19, 29204 }, // ̾
+    { 16, 9, 9, -8, 37, 27, 29223 }, // ̿
+    { 8, 7, 3, -6, 29, 13, 29250 }, // ̀
+    { 9, 7, 8, -2, 29, 13, 29263 }, // ́
+    { 14, 6, 8, -7, 28, 20, 29276 }, // ͂
+    { 6, 8, 4, -3, 30, 11, 29296 }, // ̓
+    { 14, 8, 9, -6, 30, 25, 29307 }, // ̈́
+    { 6, 6, 5, -2, -3, 11, 29332 }, // ͅ
+    { 18, 7, 10, -9, 29, 31, 29343 }, // ͆
+    { 16, 9, 9, -8, 0, 27, 29374 }, // ͇
+    { 10, 7, 6, -5, -1, 27, 29401 }, // ͈
+    { 8, 7, 5, -4, -2, 14, 29428 }, // ͉
+    { 14, 8, 8, -7, 29, 26, 29442 }, // ͊
+    { 14, 14, 8, -7, 35, 39, 29468 }, // ͋
+    { 14, 11, 8, -7, 33, 33, 29507 }, // ͌
+    { 14, 8, 8, -7, -1, 20, 29540 }, // ͍
+    { 8, 9, 5, -4, 0, 16, 29560 }, // ͎
+    { 28, 27, 15, -14, 27, 153, 29576 }, // ͏
+    { 7, 8, 4, -4, 30, 14, 29729 }, // ͐
+    { 5, 9, 4, -2, 31, 16, 29743 }, // ͑
+    { 12, 10, 7, -6, 32, 26, 29759 }, // ͒
+    { 8, 8, 5, -4, -1, 16, 29785 }, // ͓
+    { 7, 8, 4, -4, -1, 13, 29801 }, // ͔
+    { 7, 8, 4, -4, -1, 13, 29814 }, // ͕
+    { 15, 8, 9, -7, -1, 28, 29827 }, // ͖
+    { 5, 9, 4, -2, 31, 14, 29855 }, // ͗
+    { 5, 5, 10, 4, 28, 8, 29869 }, // ͘
+    { 8, 8, 5, -4, -1, 18, 29877 }, // ͙
+    { 16, 8, 9, -8, -1, 32, 29895 }, // ͚
+    { 8, 8, 5, -4, 30, 13, 29927 }, // ͛
+    { 30, 8, 16, -15, -1, 38, 29940 }, // ͜
+    { 30, 8, 16, -15, 30, 38, 29978 }, // ͝
+    { 24, 3, 13, -12, 26, 28, 30016 }, // ͞
+    { 24, 3, 13, -12, -2, 28, 30044 }, // ͟
+    { 30, 6, 16, -15, 28, 32, 30072 }, // ͠
+    { 30, 8, 16, -15, 32, 36, 30104 }, // ͡
+    { 30, 8, 17, -14, -1, 36, 30140 }, // ͢
+    { 8, 9, 5, -4, 32, 22, 30176 }, // ͣ
+    { 9, 9, 6, -4, 32, 23, 30198 }, // ͤ
+    { 3, 12, 3, -1, 35, 17, 30221 }, // ͥ
+    { 9, 9, 6, -4, 32, 25, 30238 }, // ͦ
+    { 9, 9, 6, -4, 32, 27, 30263 }, // ͧ
+    { 7, 9, 5, -3, 32, 18, 30290 }, // ͨ
+    { 9, 12, 6, -4, 35, 33, 30308 }, // ͩ
+    { 9, 12, 6, -4, 35, 30, 30341 }, // ͪ
+    { 14, 9, 8, -7, 32, 41, 30371 }, // ͫ
+    { 6, 9, 5, -2, 32, 15, 30412 }, // ͬ
+    { 7, 11, 5, -3, 34, 18, 30427 }, // ͭ
+    { 9, 9, 6, -4, 32, 22, 30445 }, // ͮ
+    { 9, 9, 6, -4, 32, 23, 30467 }, // ͯ
+    { 24, 27, 25, 0, 27, 96, 30490 }, // Α
+    { 20, 27, 24, 3, 27, 101, 30586 }, // Β
+    { 15, 27, 19, 3, 27, 56, 30687 }, // Γ
+    { 24, 27, 25, 0, 27, 95, 30743 }, // Δ
+    { 16, 27, 21, 3, 27, 72, 30838 }, // Ε
+    { 19, 27, 21, 1, 27, 62, 30910 }, // Ζ
+    { 22, 27, 28, 3, 27, 105, 30972 }, // Η
+    { 25, 29, 29, 2, 28, 109, 31077 }, // Θ
+    { 11, 27, 13, 1, 27, 48, 31186 }, // Ι
+    { 21, 27, 25, 3, 27, 91, 31234 }, // Κ
+    { 23, 27, 24, 0, 27, 90, 31325 }, // Λ
+    { 28, 27, 34, 3, 27, 140, 31415 }, // Μ
+    { 22, 27, 29, 3, 27, 106, 31555 }, // Ν
+    { 20, 27, 23, 2, 27, 71, 31661 }, // Ξ
+    { 25, 29, 29, 2, 28, 104, 31732 }, // Ο
+    { 21, 27, 27, 3, 27, 95, 31836 }, // Π
+    { 18, 27, 23, 3, 27, 81, 31931 }, // Ρ
+    { 19, 27, 21, 1, 27, 62, 32012 }, // Σ
+    { 21, 27, 22, 0, 27, 71, 32074 }, // Τ
+    { 22, 27, 23, 0, 27, 80, 32145 }, // Υ
+    { 29, 27, 32, 1, 27, 119, 32225 }, // Φ
+    { 22, 27, 23, 0, 27, 87, 32344 }, // Χ
+    { 25, 27, 31, 3, 27, 100, 32431 }, // Ψ
+    { 26, 28, 27, 0, 28, 102, 32531 }, // Ω
+    { 21, 22, 24, 2, 21, 82, 32633 }, // α
+    { 18, 38, 23, 3, 29, 123, 32715 }, // β
+    { 19, 29, 20, 0, 21, 78, 32838 }, // γ
+    { 20, 30, 22, 1, 29, 92, 32916 }, // δ
+    { 16, 22, 18, 1, 21, 58, 33008 }, // ε
+    { 16, 37, 19, 2, 29, 87, 33066 }, // ζ
+    { 17, 30, 23, 3, 21, 84, 33153 }, // η
+    { 19, 30, 22, 2, 29, 103, 33237 }, // θ
+    { 9, 22, 13, 3, 21, 37, 33340 }, // ι
+    { 17, 21, 21, 3, 21, 62, 33377 }, // κ
+    { 20, 30, 21, 0, 29, 88, 33439 }, // λ
+    { 20, 30, 24, 3, 21, 95, 33527 }, // μ
+    { 19, 21, 20, 0, 21, 62, 33622 }, // ν
+    { 16, 37, 19, 2, 29, 95, 33684 }, // ξ
+    { 19, 22, 23, 2, 21, 71, 33779 }, // ο
+    { 24, 22, 25, 0, 21, 83, 33850 }, // π
+    { 19, 30, 23, 2, 21, 89, 33933 }, // ρ
+    { 16, 29, 19, 2, 21, 69, 34022 }, // ς
+    { 20, 22, 23, 2, 21, 75, 34091 }, // σ
+    { 18, 22, 19, 0, 21, 55, 34166 }, // τ
+    { 18, 22, 22, 2, 21, 72, 34221 }, // υ
+    { 24, 38, 27, 2, 29, 120, 34293 }, // φ
+    { 22, 30, 23, 0, 21, 96, 34413 }, // χ
+    { 24, 38, 28, 2, 29, 148, 34509 }, // ψ
+    { 26, 22, 30, 2, 21, 98, 34657 }, // ω
+    { 24, 34, 25, 0, 27, 112, 34755 }, // Ạ
+    { 17, 28, 21, 1, 21, 82, 34867 }, // ạ
+    { 24, 38, 25, 0, 38, 127, 34949 }, // Ả
+    { 17, 32, 21, 1, 31, 92, 35076 }, // ả
+    { 24, 37, 25, 0, 37, 127, 35168 }, // Ấ
+    { 20, 32, 22, 1, 31, 99, 35295 }, // ấ
+    { 24, 37, 25, 0, 37, 128, 35394 }, // Ầ
+    { 18, 32, 21, 0, 31, 96, 35522 }, // ầ
+    { 24, 39, 25, 0, 39, 134, 35618 }, // Ẩ
+    { 19, 34, 21, 1, 33, 104, 35752 }, // ẩ
+    { 24, 40, 25, 0, 40, 135, 35856 }, // Ẫ
+    { 17, 35, 21, 1, 34, 104, 35991 }, // ẫ
+    { 24, 43, 25, 0, 36, 137, 36095 }, // Ậ
+    { 17, 36, 21, 1, 29, 103, 36232 }, // ậ
+    { 24, 38, 25, 0, 38, 128, 36335 }, // Ắ
+    { 17, 33, 21, 1, 32, 100, 36463 }, // ắ
+    { 24, 38, 25, 0, 38, 129, 36563 }, // Ằ
+    { 17, 33, 21, 1, 32, 99, 36692 }, // ằ
+    { 24, 40, 25, 0, 40, 135, 36791 }, // Ẳ
+    { 17, 34, 21, 1, 33, 102, 36926 }, // ẳ
+    { 24, 40, 25, 0, 40, 136, 37028 }, // Ẵ
+    { 17, 35, 21, 1, 34, 105, 37164 }, // ẵ
+    { 24, 42, 25, 0, 35, 136, 37269 }, // Ặ
+    { 17, 35, 21, 1, 28, 99, 37405 }, // ặ
+    { 16, 34, 21, 3, 27, 84, 37504 }, // Ẹ
+    { 18, 28, 21, 2, 21, 84, 37588 }, // ẹ
+    { 16, 38, 21, 3, 38, 95, 37672 }, // Ẻ
+    { 18, 32, 21, 2, 31, 95, 37767 }, // ẻ
+    { 16, 35, 21, 3, 35, 94, 37862 }, // Ẽ
+    { 18, 29, 21, 2, 28, 94, 37956 }, // ẽ
+    { 18, 37, 22, 3, 37, 102, 38050 }, // Ế
+    { 19, 32, 22, 2, 31, 101, 38152 }, // ế
+    { 18, 37, 21, 1, 37, 101, 38253 }, // Ề
+    { 19, 32, 21, 1, 31, 102, 38354 }, // ề
+    { 17, 39, 21, 3, 39, 104, 38456 }, // Ể
+    { 18, 34, 21, 2, 33, 105, 38560 }, // ể
+    { 16, 40, 21, 3, 40, 106, 38665 }, // Ễ
+    { 18, 35, 21, 2, 34, 108, 38771 }, // ễ
+    { 16, 43, 21, 3, 36, 107, 38879 }, // Ệ
+    { 18, 36, 21, 2, 29, 106, 38986 }, // ệ
+    { 11, 37, 13, 1, 37, 64, 39092 }, // Ỉ
+    { 8, 31, 11, 2, 31, 48, 39156 }, // ỉ
+    { 11, 34, 13, 1, 27, 57, 39204 }, // Ị
+    { 5, 35, 10, 2, 28, 46, 39261 }, // ị
+    { 25, 35, 29, 2, 28, 119, 39307 }, // Ọ
+    { 19, 28, 23, 2, 21, 83, 39426 }, // ọ
+    { 25, 38, 29, 2, 37, 129, 39509 }, // Ỏ
+    { 19, 32, 23, 2, 31, 96, 39638 }, // ỏ
+    { 25, 38, 29, 2, 37, 132, 39734 }, // Ố
+    { 20, 32, 23, 2, 31, 105, 39866 }, // ố
+    { 25, 38, 29, 2, 37, 134, 39971 }, // Ồ
+    { 20, 32, 23, 1, 31, 104, 40105 }, // ồ
+    { 25, 40, 29, 2, 39, 139, 40209 }, // Ổ
+    { 19, 34, 23, 2, 33, 103, 40348 }, // ổ
+    { 25, 41, 29, 2, 40, 144, 40451 }, // Ỗ
+    { 19, 35, 23, 2, 34, 107, 40595 }, // ỗ
+    { 25, 43, 29, 2, 36, 145, 40702 }, // Ộ
+    { 19, 36, 23, 2, 29, 106, 40847 }, // ộ
+    { 29, 37, 32, 2, 36, 141, 40953 }, // Ớ
+    { 23, 30, 26, 2, 29, 105, 41094 }, // ớ
+    { 29, 37, 32, 2, 36, 141, 41199 }, // Ờ
+    { 23, 30, 26, 2, 29, 102, 41340 }, // ờ
+    { 29, 39, 32, 2, 38, 150, 41442 }, // Ở
+    { 23, 32, 26, 2, 31, 110, 41592 }, // ở
+    { 29, 36, 32, 2, 35, 144, 41702 }, // Ỡ
+    { 23, 29, 26, 2, 28, 107, 41846 }, // ỡ
+    { 29, 36, 32, 2, 29, 137, 41953 }, // Ợ
+    { 23, 31, 26, 2, 24, 102, 42090 }, // ợ
+    { 21, 34, 27, 3, 27, 104, 42192 }, // Ụ
+    { 18, 28, 23, 2, 21, 86, 42296 }, // ụ
+    { 21, 38, 27, 3, 37, 113, 42382 }, // Ủ
+    { 18, 32, 23, 2, 31, 99, 42495 }, // ủ
+    { 28, 37, 32, 3, 36, 136, 42594 }, // Ứ
+    { 25, 30, 28, 2, 29, 108, 42730 }, // ứ
+    { 28, 37, 32, 3, 36, 136, 42838 }, // Ừ
+    { 25, 30, 28, 2, 29, 105, 42974 }, // ừ
+    { 28, 38, 32, 3, 37, 140, 43079 }, // Ử
+    { 25, 32, 28, 2, 31, 114, 43219 }, // ử
+    { 28, 36, 32, 3, 35, 138, 43333 }, // Ữ
+    { 25, 29, 28, 2, 28, 111, 43471 }, // ữ
+    { 28, 36, 32, 3, 29, 130, 43582 }, // Ự
+    { 25, 31, 28, 2, 24, 104, 43712 }, // ự
+    { 22, 36, 23, 0, 36, 101, 43816 }, // Ỳ
+    { 20, 38, 21, 0, 29, 103, 43917 }, // ỳ
+    { 22, 34, 23, 0, 27, 97, 44020 }, // Ỵ
+    { 20, 30, 21, 0, 21, 94, 44117 }, // ỵ
+    { 22, 37, 23, 0, 37, 106, 44211 }, // Ỷ
+    { 20, 40, 21, 0, 31, 111, 44317 }, // ỷ
+    { 22, 35, 23, 0, 35, 105, 44428 }, // Ỹ
+    { 20, 37, 21, 0, 28, 107, 44533 }, // ỹ
+    { 0, 0, 19, 0, 0, 0, 44640 }, //  
+    { 0, 0, 38, 0, 0, 0, 44640 }, //  
+    { 0, 0, 19, 0, 0, 0, 44640 }, //  
+    { 0, 0, 38, 0, 0, 0, 44640 }, //  
+    { 0, 0, 12, 0, 0, 0, 44640 }, //  
+    { 0, 0, 9, 0, 0, 0, 44640 }, //  
+    { 0, 0, 6, 0, 0, 0, 44640 }, //  
+    { 0, 0, 21, 0, 0, 0, 44640 }, //  
+    { 0, 0, 10, 0, 0, 0, 44640 }, //  
+    { 0, 0, 6, 0, 0, 0, 44640 }, //  
+    { 0, 0, 4, 0, 0, 0, 44640 }, //  
+    { 0, 0, 1, 0, 0, 0, 44640 }, // ​
+    { 0, 0, 1, 0, 0, 0, 44640 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 44640 }, // ‍
+    { 9, 31, 9, -1, 26, 44, 44640 }, // ‎
+    { 9, 31, 2, -8, 26, 44, 44684 }, // ‏
+    { 10, 4, 12, 1, 12, 14, 44728 }, // ‐
+    { 10, 4, 12, 1, 12, 14, 44742 }, // ‑
+    { 19, 3, 21, 1, 15, 10, 44756 }, // ‒
+    { 17, 4, 19, 1, 12, 23, 44766 }, // –
+    { 35, 4, 38, 1, 12, 45, 44789 }, // —
+    { 35, 4, 38, 1, 12, 45, 44834 }, // ―
+    { 12, 39, 21, 4, 29, 98, 44879 }, // ‖
+    { 17, 9, 17, -1, 0, 32, 44977 }, // ‗
+    { 7, 10, 8, 0, 27, 17, 45009 }, // ‘
+    { 7, 10, 8, 0, 27, 15, 45026 }, // ’
+    { 6, 10, 9, 1, 5, 17, 45041 }, // ‚
+    { 7, 10, 8, 0, 27, 17, 45058 }, // ‛
+    { 14, 10, 15, 0, 27, 34, 45075 }, // “
+    { 14, 10, 15, 0, 27, 30, 45109 }, // ”
+    { 13, 10, 16, 1, 5, 32, 45139 }, // „
+    { 14, 10, 15, 0, 27, 31, 45171 }, // ‟
+    { 15, 29, 19, 2, 29, 65, 45202 }, // †
+    { 15, 29, 19, 2, 29, 67, 45267 }, // ‡
+    { 10, 10, 14, 2, 19, 19, 45334 }, // •
+    { 11, 12, 14, 2, 20, 24, 45353 }, // ‣
+    { 5, 6, 19, 7, 5, 10, 45377 }, // ․
+    { 16, 6, 20, 2, 5, 17, 45387 }, // ‥
+    { 25, 6, 30, 2, 5, 28, 45404 }, // …
+    { 6, 6, 10, 2, 12, 9, 45432 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 45441 }, //  
+    { 0, 0, 23, 0, 0, 0, 45441 }, //  
+    { 9, 28, 9, -1, 23, 32, 45441 }, // ‪
+    { 9, 28, 2, -8, 23, 33, 45473 }, // ‫
+    { 10, 31, 6, -5, 26, 40, 45506 }, // ‬
+    { 10, 31, 6, -5, 26, 44, 45546 }, // ‭
+    { 10, 31, 6, -5, 26, 44, 45590 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 45634 }, //  
+    { 42, 29, 44, 1, 28, 204, 45634 }, // ‰
+    { 56, 29, 58, 1, 28, 263, 45838 }, // ‱
+    { 9, 10, 11, 1, 27, 16, 46101 }, // ′
+    { 16, 10, 18, 1, 27, 32, 46117 }, // ″
+    { 22, 10, 24, 1, 27, 47, 46149 }, // ‴
+    { 9, 10, 9, -1, 27, 15, 46196 }, // ‵
+    { 15, 10, 17, -1, 27, 30, 46211 }, // ‶
+    { 21, 10, 23, -1, 27, 46, 46241 }, // ‷
+    { 15, 13, 16, 0, 4, 35, 46287 }, // ‸
+    { 10, 16, 12, 1, 18, 25, 46322 }, // ‹
+    { 10, 16, 12, 1, 18, 24, 46347 }, // ›
+    { 29, 29, 31, 1, 28, 127, 46371 }, // ※
+    { 14, 28, 19, 2, 27, 82, 46498 }, // ‼
+    { 16, 29, 17, 0, 28, 67, 46580 }, // ‽
+    { 20, 3, 20, -1, 31, 16, 46647 }, // ‾
+    { 22, 8, 23, 0, -1, 30, 46663 }, // ‿
+    { 22, 9, 23, 0, 30, 35, 46693 }, // ⁀
+    { 14, 25, 15, 0, 16, 57, 46728 }, // ⁁
+    { 42, 35, 43, 0, 29, 195, 46785 }, // ⁂
+    { 10, 4, 12, 1, 12, 14, 46980 }, // ⁃
+    { 20, 27, 13, -8, 27, 57, 46994 }, // ⁄
+    { 10, 33, 13, 2, 27, 42, 47051 }, // ⁅
+    { 10, 33, 12, 0, 27, 54, 47093 }, // ⁆
+    { 32, 29, 33, 0, 28, 117, 47147 }, // ⁇
+    { 23, 29, 25, 0, 28, 99, 47264 }, // ⁈
+    { 23, 29, 26, 2, 28, 103, 47363 }, // ⁉
+    { 19, 21, 21, 1, 21, 52, 47466 }, // ⁊
+    { 20, 34, 25, 3, 29, 159, 47518 }, // ⁋
+    { 19, 20, 24, 2, 21, 83, 47677 }, // ⁌
+    { 19, 20, 24, 3, 21, 84, 47760 }, // ⁍
+    { 19, 18, 21, 1, 10, 56, 47844 }, // ⁎
+    { 7, 26, 9, 1, 21, 29, 47900 }, // ⁏
+    { 22, 39, 23, 0, 30, 95, 47929 }, // ⁐
+    { 19, 37, 21, 1, 29, 114, 48024 }, // ⁑
+    { 14, 29, 15, 0, 28, 68, 48138 }, // ⁒
+    { 33, 6, 38, 2, 14, 37, 48206 }, // ⁓
+    { 22, 9, 23, 0, 0, 29, 48243 }, // ⁔
+    { 20, 20, 22, 1, 19, 69, 48272 }, // ⁕
+    { 17, 29, 19, 1, 28, 46, 48341 }, // ⁖
+    { 28, 10, 30, 1, 27, 63, 48387 }, // ⁗
+    { 28, 29, 31, 1, 28, 71, 48450 }, // ⁘
+    { 29, 29, 31, 1, 28, 82, 48521 }, // ⁙
+    { 6, 29, 8, 1, 28, 22, 48603 }, // ⁚
+    { 22, 30, 25, 1, 29, 62, 48625 }, // ⁛
+    { 28, 29, 30, 1, 28, 117, 48687 }, // ⁜
+    { 6, 28, 10, 2, 27, 29, 48804 }, // ⁝
+    { 6, 29, 10, 2, 28, 35, 48833 }, // ⁞
+    { 0, 0, 8, 0, 0, 0, 48868 }, //  
+    { 0, 0, 23, 0, 0, 0, 48868 }, // ⁠
+    { 0, 0, 23, 0, 0, 0, 48868 }, // ⁡
+    { 0, 0, 23, 0, 0, 0, 48868 }, // ⁢
+    { 0, 0, 23, 0, 0, 0, 48868 }, // ⁣
+    { 0, 0, 23, 0, 0, 0, 48868 }, // ⁤
+    { 0, 0, 1, 0, 0, 0, 48868 }, // ⁦
+    { 0, 0, 1, 0, 0, 0, 48868 }, // ⁧
+    { 0, 0, 1, 0, 0, 0, 48868 }, // ⁨
+    { 0, 0, 1, 0, 0, 0, 48868 }, // ⁩
+    { 10, 31, 6, -5, 26, 40, 48868 }, // ⁪
+    { 10, 31, 6, -5, 26, 48, 48908 }, // ⁫
+    { 10, 31, 6, -5, 26, 36, 48956 }, // ⁬
+    { 10, 31, 6, -5, 26, 36, 48992 }, // ⁭
+    { 10, 31, 6, -5, 26, 41, 49028 }, // ⁮
+    { 10, 31, 6, -5, 26, 38, 49069 }, // ⁯
+    { 13, 17, 14, 0, 32, 50, 49107 }, // ⁰
+    { 4, 18, 6, 1, 28, 17, 49157 }, // ⁱ
+    { 13, 17, 14, 0, 32, 48, 49174 }, // ⁴
+    { 11, 17, 13, 1, 32, 43, 49222 }, // ⁵
+    { 13, 17, 14, 0, 32, 47, 49265 }, // ⁶
+    { 12, 17, 14, 1, 32, 38, 49312 }, // ⁷
+    { 13, 17, 14, 0, 32, 50, 49350 }, // ⁸
+    { 13, 18, 14, 0, 33, 50, 49400 }, // ⁹
+    { 11, 11, 13, 1, 28, 29, 49450 }, // ⁺
+    { 11, 3, 13, 1, 24, 14, 49479 }, // ⁻
+    { 11, 7, 13, 1, 26, 20, 49493 }, // ⁼
+    { 7, 22, 10, 2, 35, 33, 49513 }, // ⁽
+    { 7, 22, 8, 0, 35, 30, 49546 }, // ⁾
+    { 12, 14, 15, 2, 24, 32, 49576 }, // ⁿ
+    { 13, 17, 14, 0, 12, 50, 49608 }, // ₀
+    { 8, 17, 13, 1, 12, 31, 49658 }, // ₁
+    { 12, 17, 13, 0, 12, 37, 49689 }, // ₂
+    { 13, 17, 14, 0, 12, 44, 49726 }, // ₃
+    { 13, 17, 14, 0, 12, 48, 49770 }, // ₄
+    { 11, 17, 13, 1, 12, 43, 49818 }, // ₅
+    { 13, 17, 14, 0, 12, 47, 49861 }, // ₆
+    { 12, 17, 14, 1, 12, 38, 49908 }, // ₇
+    { 13, 17, 14, 0, 12, 50, 49946 }, // ₈
+    { 13, 18, 14, 0, 13, 50, 49996 }, // ₉
+    { 11, 11, 13, 1, 8, 29, 50046 }, // ₊
+    { 11, 3, 13, 1, 4, 14, 50075 }, // ₋
+    { 11, 7, 13, 1, 6, 20, 50089 }, // ₌
+    { 7, 22, 10, 2, 14, 33, 50109 }, // ₍
+    { 7, 22, 8, 0, 14, 30, 50142 }, // ₎
+    { 11, 13, 14, 1, 9, 39, 50172 }, // ₐ
+    { 12, 13, 14, 1, 9, 36, 50211 }, // ₑ
+    { 13, 13, 15, 1, 9, 38, 50247 }, // ₒ
+    { 13, 13, 14, 0, 9, 37, 50285 }, // ₓ
+    { 12, 13, 14, 1, 9, 32, 50322 }, // ₔ
+    { 12, 18, 15, 2, 14, 41, 50354 }, // ₕ
+    { 11, 18, 14, 2, 14, 41, 50395 }, // ₖ
+    { 3, 18, 6, 2, 14, 19, 50436 }, // ₗ
+    { 19, 13, 23, 2, 9, 53, 50455 }, // ₘ
+    { 12, 13, 15, 2, 9, 33, 50508 }, // ₙ
+    { 12, 18, 15, 2, 9, 45, 50541 }, // ₚ
+    { 10, 13, 12, 1, 9, 29, 50586 }, // ₛ
+    { 9, 16, 10, 0, 12, 28, 50615 }, // ₜ
+    { 20, 28, 22, 1, 28, 88, 50643 }, // ₠
+    { 20, 32, 22, 1, 29, 129, 50731 }, // ₡
+    { 19, 29, 22, 2, 28, 97, 50860 }, // ₢
+    { 19, 27, 21, 1, 27, 66, 50957 }, // ₣
+    { 20, 28, 22, 1, 28, 80, 51023 }, // ₤
+    { 30, 30, 35, 3, 25, 138, 51103 }, // ₥
+    { 22, 27, 23, 0, 27, 102, 51241 }, // ₦
+    { 26, 28, 29, 2, 27, 102, 51343 }, // ₧
+    { 27, 28, 31, 3, 27, 131, 51445 }, // ₨
+    { 25, 27, 26, 0, 27, 138, 51576 }, // ₩
+    { 24, 27, 30, 3, 27, 102, 51714 }, // ₪
+    { 21, 35, 24, 2, 29, 123, 51816 }, // ₫
+    { 21, 29, 22, 0, 28, 86, 51939 }, // €
+    { 22, 27, 23, 0, 27, 85, 52025 }, // ₭
+    { 21, 27, 22, 0, 27, 82, 52110 }, // ₮
+    { 36, 37, 37, 0, 28, 174, 52192 }, // ₯
+    { 20, 37, 21, 0, 28, 114, 52366 }, // ₰
+    { 22, 27, 23, 0, 27, 95, 52480 }, // ₱
+    { 23, 32, 27, 2, 29, 120, 52575 }, // ₲
+    { 23, 27, 24, 0, 27, 104, 52695 }, // ₳
+    { 21, 29, 22, 0, 28, 105, 52799 }, // ₴
+    { 21, 32, 24, 2, 29, 105, 52904 }, // ₵
+    { 23, 26, 24, 0, 25, 97, 53009 }, // ₶
+    { 26, 31, 27, 0, 28, 134, 53106 }, // ₷
+    { 20, 27, 21, 0, 27, 59, 53240 }, // ₸
+    { 17, 27, 21, 2, 27, 68, 53299 }, // ₹
+    { 21, 28, 22, 0, 27, 84, 53367 }, // ₺
+    { 29, 29, 30, 0, 28, 120, 53451 }, // ₻
+    { 26, 27, 30, 2, 27, 109, 53571 }, // ₼
+    { 21, 27, 22, 0, 27, 89, 53680 }, // ₽
+    { 25, 29, 29, 2, 29, 120, 53769 }, // ₾
+    { 18, 35, 22, 3, 31, 123, 53889 }, // ₿
+    { 16, 27, 18, 1, 21, 69, 54012 }, // ⃀
+    { 19, 4, 21, 1, 15, 18, 54081 }, // −
+    { 35, 35, 38, 1, 29, 164, 54099 }, // �
 };
 
 static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
@@ -6194,4 +4214,5 @@ static const EpdFontData notosans_18_regular = {
     41,
     -11,
     true,
+    true,
 };
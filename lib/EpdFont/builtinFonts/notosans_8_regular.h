@@ -1425,4 +1425,5 @@ static const EpdFontData notosans_8_regular = {
     18,
     -5,
     false,
+    false,
 };
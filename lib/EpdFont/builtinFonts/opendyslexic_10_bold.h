@@ -2,3277 +2,2509 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_bold
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_boldBitmaps[41592] = {
-    0x00, 0x00, 0x14, 0x00, 0x74, 0x01, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0xFC, 0x00, 0xB0, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x03, 0xFD, 0x0F, 0xF8, 0x3F, 0xE1, 0xFF, 0xCB, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x7F, 0xE3, 0xFD, 0x1F, 0xF4, 0xFF, 0x07, 0xFC, 0x3F, 0xC1, 0xFF,
-    0x0F, 0xF0, 0x7F, 0xC3, 0xFC, 0x1F, 0xF0, 0xFF, 0x07, 0xFC, 0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00,
-    0x00, 0x0B, 0xD0, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x0B, 0xE0,
-    0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x2F,
-    0xC1, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x2F, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x00, 0x0B, 0xF0, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x07, 0xF4,
-    0x00, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x1B, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xDF, 0x84,
-    0x00, 0x0B, 0xF0, 0xF8, 0x00, 0x00, 0xBF, 0x4F, 0x40, 0x00, 0x07, 0xFE, 0xF4, 0x00, 0x00, 0x3F,
-    0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0x4F, 0xFC, 0x02, 0x91, 0xF4, 0x3F, 0xD0, 0xBF, 0xFF, 0x5F, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01, 0x50, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0x0B, 0xC0,
-    0x2D, 0x2D, 0x01, 0xF8, 0x03, 0xC0, 0xE0, 0x3F, 0x00, 0x3C, 0x0F, 0x0B, 0xD0, 0x03, 0xD1, 0xE0,
-    0xFC, 0x00, 0x2F, 0xFD, 0x2F, 0x00, 0x00, 0xFF, 0x87, 0xE0, 0x00, 0x01, 0x50, 0xFC, 0x7F, 0x40,
-    0x00, 0x2F, 0x9F, 0xBD, 0x00, 0x03, 0xF2, 0xC0, 0xF0, 0x00, 0xFD, 0x3C, 0x0F, 0x00, 0x1F, 0xC3,
-    0xD1, 0xF0, 0x03, 0xF4, 0x2F, 0xFE, 0x00, 0xBE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x01, 0x50, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x3D, 0x01, 0xF0, 0x00,
-    0x3C, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x3F, 0x02, 0xF0, 0x00, 0x1F, 0xEF, 0xE0, 0x00,
-    0x07, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0xF8, 0x3F, 0x4B, 0xE0, 0xFC,
-    0x7F, 0x01, 0xFE, 0xF8, 0x7F, 0x80, 0x7F, 0xF0, 0x7F, 0xFA, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFD, 0xF0, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0xCF, 0xF4, 0xFF, 0x4F,
-    0xF4, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x01,
-    0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F,
-    0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xFD,
-    0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F,
-    0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x07,
-    0xF0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00,
-    0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x02, 0xF8, 0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x03,
-    0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFD,
-    0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03,
-    0xE0, 0x50, 0x3C, 0xF8, 0xF8, 0x3F, 0xFF, 0xFE, 0x06, 0xFF, 0xFD, 0x00, 0x1F, 0xFE, 0x00, 0x2F,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xBF, 0x03, 0xCB, 0xC7, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x64, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xEA, 0xBF, 0xAA, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0x15, 0x55,
-    0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x1A, 0x0F, 0xE3, 0xF9, 0xFF, 0x7F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0xFF, 0xFD, 0x00, 0xFD, 0x0F, 0xC0, 0x7E, 0x01, 0xF8, 0x2F, 0x44, 0x3F, 0x0F, 0xCB, 0xCF, 0xC3,
-    0xF3, 0xF2, 0xF0, 0xFC, 0xFC, 0xFD, 0x3F, 0x3F, 0x3F, 0x4F, 0xD7, 0x8F, 0xD3, 0xF8, 0x07, 0xF0,
-    0xFF, 0x47, 0xFC, 0x2F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xD0,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0xAC, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x14,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x16, 0xFE, 0x54, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE,
-    0x06, 0xFF, 0x40, 0x0B, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0xF4, 0x07, 0xF4, 0x10, 0x00, 0xBE,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xFC,
-    0x00, 0x1F, 0xFD, 0x00, 0x2F, 0xFE, 0x00, 0x1F, 0xFF, 0xA9, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x55, 0x00, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0x80, 0xA4, 0x02,
-    0xF4, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x07, 0xFF, 0xE0, 0x02, 0xFF,
-    0xF4, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFC, 0x0E, 0x45, 0xFF, 0x07, 0xFF,
-    0xFF, 0xC2, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x7F, 0xD0, 0x00, 0x3E, 0xF4, 0x00, 0x3E, 0x7E, 0x00,
-    0x2F, 0x1F, 0x80, 0x1F, 0x47, 0xE0, 0x0F, 0x82, 0xF8, 0x0F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xA4, 0x2F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFC, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xE9, 0x40, 0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xFC, 0x10,
-    0x01, 0xFD, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x1E, 0x57, 0xFE, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xF0, 0x0B, 0xFE, 0x40, 0x00, 0x2F, 0xFD, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFF,
-    0xD0, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC6, 0x90, 0x03, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xD0, 0xFF, 0x0F, 0xE0, 0x0F, 0xC3, 0xF4, 0x03, 0xF4, 0xFE, 0x00, 0xFD, 0x3F, 0xD1,
-    0xFF, 0x07, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x06, 0xFF, 0x40, 0x2A, 0xAA, 0xA5, 0x3F, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x2F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xD0, 0x00, 0xBF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x00, 0xFD, 0x1F, 0xE0, 0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x3F, 0x07, 0xF0, 0x2F, 0xC0, 0xFF,
-    0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x0B, 0xF4, 0x2F, 0xC3, 0xF4, 0x03, 0xF8, 0xFC,
-    0x00, 0xBE, 0x3F, 0xD0, 0xBF, 0x8F, 0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00,
-    0x59, 0x40, 0x00, 0x00, 0x05, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0xBD, 0x07, 0xF4,
-    0x3E, 0x00, 0x3E, 0x0F, 0x00, 0x0F, 0xC3, 0xC0, 0x02, 0xF0, 0xF4, 0x00, 0xFD, 0x3F, 0x40, 0xBF,
-    0x47, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x06, 0x50, 0x2F,
-    0xC2, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83,
-    0xFC, 0x3F, 0xC7, 0xFC, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0xC3, 0xFC,
-    0x7F, 0xCB, 0xFD, 0x0F, 0xE0, 0x3F, 0x81, 0xFF, 0x0B, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x51, 0xFF, 0x83, 0xFC, 0x0F, 0xF0, 0xBF, 0x83, 0xFD, 0x0F, 0xF0, 0x6A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE4, 0x00, 0x07, 0xFF, 0xFF, 0xE4, 0x00, 0x06, 0xFF, 0xFF, 0xF0,
-    0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x01, 0x90, 0x05, 0x6A, 0xA8,
-    0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x06, 0xFF, 0xF8, 0x06, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFE,
-    0x40, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0x90, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xA4, 0x00, 0x03, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xD0, 0x3F, 0xD0, 0xBF, 0x00, 0xD0,
-    0x02, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x3F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xC0,
-    0x00, 0x3E, 0x00, 0x02, 0xE0, 0x00, 0xFC, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x3E, 0xD0, 0x78, 0x03,
-    0xE0, 0xF7, 0xE0, 0x3C, 0x03, 0xD0, 0xC0, 0xE0, 0x3C, 0x07, 0xD1, 0xC0, 0xE0, 0x3C, 0x07, 0xD1,
-    0xC1, 0xF0, 0xB4, 0x07, 0xF0, 0xFF, 0xF1, 0xF0, 0x03, 0xF4, 0x7F, 0xFF, 0xD0, 0x03, 0xFC, 0x00,
-    0x2E, 0x00, 0x01, 0xFF, 0x80, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x06, 0x94, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00,
-    0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE,
-    0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0xBF, 0xFF, 0x90, 0x0B,
-    0xFF, 0xFF, 0x80, 0xBF, 0xAB, 0xFD, 0x0B, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0x3F, 0x0B, 0xF0, 0x03,
-    0xF0, 0xBF, 0x00, 0xBF, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF4, 0xBF,
-    0x00, 0x7F, 0xCB, 0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xEB, 0xFA, 0xAB, 0xFD, 0xBF, 0xFF, 0xFF,
-    0xDB, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F,
-    0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0xBF, 0xFF, 0xE4, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xBF,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xAA, 0xFF, 0xF0, 0xBF, 0x00, 0x0F, 0xF8, 0xBF, 0x00, 0x03, 0xFC, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF,
-    0x00, 0x00, 0xFD, 0xBF, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x6F, 0xFC, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xF9, 0x00, 0x2A,
-    0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07,
-    0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFC, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xAA, 0xA0, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF, 0x80, 0x1F,
-    0xFF, 0xCB, 0xF8, 0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03, 0xF4, 0x3F,
-    0xFE, 0x55, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40,
-    0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80,
-    0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA,
-    0xAB, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0x7F, 0x5F,
-    0xD7, 0xF5, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x5F, 0xE7,
-    0xF9, 0xFE, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x09, 0x02, 0xFE, 0x03,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00,
-    0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B, 0xFF, 0x80,
-    0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF4, 0x00, 0xFF,
-    0xC3, 0xFF, 0x80, 0x1F, 0xFD, 0x3F, 0xFC, 0x03, 0xFF, 0xD3, 0xFF, 0xE0, 0x3F, 0xFD, 0x3F, 0xFF,
-    0x0B, 0xFF, 0xD7, 0xFF, 0xF4, 0xFF, 0xFD, 0x7F, 0xBF, 0x9F, 0xEF, 0xD7, 0xF7, 0xFF, 0xFD, 0xFE,
-    0x7F, 0x6F, 0xFF, 0xDF, 0xE7, 0xF5, 0xFF, 0xF9, 0xFE, 0x7F, 0x4F, 0xFF, 0x2F, 0xE7, 0xF8, 0xBF,
-    0xF2, 0xFE, 0xBF, 0x87, 0xFE, 0x3F, 0xEB, 0xF8, 0x3F, 0xD3, 0xFF, 0xBF, 0xC2, 0xFC, 0x3F, 0xFB,
-    0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC,
-    0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC,
-    0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8,
-    0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4,
-    0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00,
-    0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0xA9, 0x40, 0x0B, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFD, 0x01, 0xFC, 0x3F,
-    0x40, 0x2F, 0x4F, 0xD0, 0x0B, 0xE3, 0xF4, 0x07, 0xF8, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x01, 0xFF, 0x94, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-    0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x00,
-    0x1F, 0xF4, 0x0B, 0xFC, 0x00, 0xFF, 0x40, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x2F, 0xC0,
-    0x00, 0x1F, 0xD0, 0xFF, 0x00, 0x00, 0x3F, 0x43, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0xF0, 0x00, 0x03,
-    0xF8, 0x3F, 0xC0, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0xA0, 0x7F, 0x41, 0xFF, 0x03, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF,
-    0xC0, 0x00, 0x00, 0x0A, 0xAA, 0x80, 0x2F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x55, 0xFC,
-    0x02, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF5,
-    0x5F, 0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xE0,
-    0x7F, 0xC0, 0xBF, 0x07, 0xFC, 0x0B, 0xF4, 0x7F, 0xC0, 0xBF, 0x87, 0xFC, 0x0B, 0xFC, 0xBF, 0xC0,
-    0xBF, 0xD7, 0xFC, 0x0B, 0xFE, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03,
-    0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC3, 0xF8, 0x00, 0x03, 0xF8, 0x3F, 0xC0,
-    0x00, 0x7F, 0x42, 0xFD, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x2F, 0xD0,
-    0x0B, 0xF8, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x03, 0xFD, 0x0F, 0xF4, 0x00, 0x2F, 0xE1,
-    0xFF, 0x00, 0x01, 0xFF, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x02, 0xA8, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x00, 0x0B, 0xF8, 0x3F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x0B, 0xD0, 0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x2F, 0xF4, 0x2F, 0xE0, 0x0F, 0xF4, 0x3F, 0xFC, 0x3F, 0xD0, 0x0B, 0xF8, 0xBF, 0xFD,
-    0x3F, 0xC0, 0x07, 0xFC, 0xFF, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 0x03, 0xFF,
-    0xFE, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x02, 0xFF, 0xFC, 0x3F, 0xFF, 0x00,
-    0x01, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x0F,
-    0xFC, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x3F, 0xC0, 0x0F,
-    0xF0, 0x1F, 0xD0, 0x01, 0xFF, 0x0F, 0xE0, 0x00, 0x2F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x3F, 0xE1,
-    0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xF4, 0x2F, 0xF4, 0x03, 0xFF, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x7F,
-    0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0,
-    0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE,
-    0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFD, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xEA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1A, 0xA9, 0x2F, 0xFE, 0x2F, 0xFE, 0x2F,
-    0x40, 0x2F, 0x40, 0x3F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E,
-    0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBE, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xFF, 0xA8, 0xFF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0xB0, 0x00, 0xB0, 0x00, 0xF8,
-    0x00, 0xFC, 0x00, 0x7D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B,
-    0xE0, 0x07, 0xF0, 0x03, 0xF4, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xBD, 0x00,
-    0x3C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0xAA, 0xA0, 0xFF, 0xF4, 0xFF, 0xF4, 0x02, 0xF4, 0x02,
-    0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0xFD, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0xBE, 0x2A, 0xFE, 0x3F, 0xFE, 0x3F,
-    0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0xC0, 0x0F, 0xE7, 0xF0, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xF8, 0x00,
-    0x3F, 0x80, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8,
-    0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0xA9, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x07, 0xDB,
-    0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x0F, 0xF4, 0x1F, 0x03, 0xF8, 0x03, 0xE0, 0xFD,
-    0x00, 0xBC, 0x3F, 0x40, 0x2F, 0x0F, 0xE0, 0x1F, 0xC3, 0xFF, 0xAF, 0xF0, 0xBF, 0xFF, 0xF4, 0x1F,
-    0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0xFF,
-    0xFC, 0x0B, 0xFE, 0xF0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xBE,
-    0x00, 0x01, 0xFD, 0x04, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0xE3, 0xF0, 0x2F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0x0F, 0xC0, 0xFF, 0x87, 0xC0, 0x1F,
-    0xE2, 0xF0, 0x03, 0xF8, 0xFC, 0x00, 0xFE, 0x2F, 0x40, 0xBF, 0x87, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xFE, 0x00, 0xBF, 0x9F, 0xC0, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81,
-    0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x01, 0xFF, 0x01, 0xFF,
-    0xC0, 0xFF, 0xA0, 0x3F, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xCF, 0xFF, 0xF3, 0xFF, 0xFC, 0x0F, 0xC0,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x01, 0xFD, 0x00, 0x7F, 0x40,
-    0x1F, 0xD0, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x2F, 0x40, 0x00, 0x0B,
-    0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03,
-    0xF7, 0xFD, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xFB, 0xFC, 0x0F, 0xE0, 0x1F, 0x47, 0xF0, 0x03, 0xE1,
-    0xFC, 0x00, 0xF8, 0x7F, 0x00, 0x3F, 0x2F, 0xC0, 0x0F, 0xCB, 0xF0, 0x07, 0xF2, 0xFC, 0x02, 0xFC,
-    0xBF, 0x40, 0xBF, 0x3F, 0xD0, 0x3F, 0xC0, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00,
-    0x00, 0x01, 0xA0, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F,
-    0x83, 0xF8, 0x3F, 0xC0, 0x00, 0x54, 0x00, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x54, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF4, 0x01, 0xF4,
-    0x01, 0xF4, 0x01, 0xF4, 0x01, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x7F, 0xF0,
-    0x7F, 0xE0, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0xBE, 0x00,
-    0x3E, 0xBF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xF4, 0x00,
-    0x2F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x02, 0xF9, 0xFF, 0x80, 0xBF, 0x2F, 0xFC, 0x3F, 0xC3, 0xFF,
-    0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x40, 0xBD,
-    0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x0F, 0xD0, 0x3F, 0xF8, 0xFF, 0xF3, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xAF, 0xD0, 0x7F, 0x40, 0x2F, 0xFF, 0xF9, 0xFF, 0xE0,
-    0x2F, 0xFA, 0xFF, 0xEB, 0xF4, 0x3F, 0xC0, 0x7F, 0x80, 0xFC, 0x3F, 0x80, 0x3F, 0x40, 0xFC, 0x3F,
-    0x40, 0x3F, 0x00, 0xFC, 0x3F, 0x40, 0x7F, 0x00, 0xFC, 0x7F, 0x40, 0xBF, 0x00, 0xFC, 0x7F, 0x00,
-    0xFE, 0x01, 0xFC, 0xBF, 0x00, 0xFE, 0x01, 0xFD, 0xBF, 0x00, 0xFD, 0x01, 0xFD, 0xFF, 0x01, 0xFD,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40,
-    0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE,
-    0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41,
-    0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x01, 0x40,
-    0x01, 0xFA, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xC1, 0xF4, 0x0F, 0xF0, 0x07, 0xC0, 0xFF,
-    0x00, 0x3C, 0x0F, 0xF0, 0x03, 0xC0, 0xFF, 0x00, 0x3D, 0x0F, 0xF0, 0x07, 0xC0, 0xFF, 0xE6, 0xFC,
-    0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFC, 0x03, 0xF8, 0x69, 0x00, 0x3F, 0x80,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x0B, 0xEB, 0xFF, 0x80, 0x7C,
-    0x03, 0xFD, 0x02, 0xF0, 0x07, 0xF4, 0x0B, 0x80, 0x1F, 0xD0, 0x3E, 0x00, 0x3F, 0x00, 0xB8, 0x01,
-    0xFC, 0x02, 0xF4, 0x0F, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC,
-    0x00, 0x0B, 0xFB, 0xF1, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x03, 0xE4, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2F, 0xAF, 0x4B, 0xFF, 0xE3, 0xFF, 0xF8, 0xFF,
-    0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x3F, 0x40, 0x1F, 0xE0, 0x0B, 0xFC,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F,
-    0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95,
-    0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xBD, 0x00, 0x02, 0xF4, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0x1A, 0xFE, 0xA8, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0,
-    0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE,
-    0x07, 0xFE, 0xFE, 0xBE, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x82, 0xF8, 0x00, 0xFC, 0x03, 0xF0,
-    0x0B, 0xE0, 0x0F, 0xE0, 0x3F, 0x40, 0x1F, 0xD2, 0xFC, 0x00, 0x3F, 0xCF, 0xD0, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0xBE, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x0F, 0xE3, 0xF0, 0x05, 0x03, 0xF4, 0xFD, 0x0F, 0xC1,
-    0xFC, 0x2F, 0x8B, 0xF8, 0xBE, 0x07, 0xF3, 0xFF, 0x3F, 0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xEF, 0xFD, 0x00, 0x3F, 0xF3, 0xFF, 0x00, 0x0F,
-    0xF4, 0x7F, 0xC0, 0x01, 0xA4, 0x06, 0x90, 0x00, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0xD0, 0xFD, 0x00,
-    0x2F, 0xCF, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x2F, 0xE3, 0xFD, 0x02, 0xFF, 0x03,
-    0xFC, 0x1F, 0xF0, 0x0B, 0xFC, 0xBF, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F, 0x40,
-    0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A, 0xBF, 0xE0, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0,
-    0x00, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x02, 0xFF,
-    0xD0, 0x0F, 0xFA, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x05, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F,
-    0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x1F, 0xFE, 0x00,
-    0x1F, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x7D,
-    0x7D, 0x7D, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3F, 0xE0, 0x00, 0xBF, 0xF0, 0x01, 0xAF, 0xE0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
-    0xF8, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03,
-    0xF4, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0xFD, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x1D, 0x7F, 0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x7F, 0xF0, 0xFF, 0xC3,
-    0xFF, 0x0B, 0xFC, 0x2F, 0xE0, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0xB0, 0x0B, 0xD0, 0x3F, 0x40, 0xFD, 0x03, 0xF4, 0x0F, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x07,
-    0xD0, 0x1F, 0x40, 0x7D, 0x00, 0xF4, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0x03, 0xFF, 0xEC, 0x1F,
-    0xCF, 0x00, 0xBE, 0x3C, 0x02, 0xF4, 0xE0, 0x0F, 0xD3, 0x80, 0x2F, 0x8E, 0x00, 0xBF, 0x79, 0x00,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xE4, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0xBF, 0x9B,
-    0xF0, 0x0B, 0xC0, 0x09, 0x00, 0xB8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xBC, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFA, 0x03, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x04, 0x00, 0x34, 0x03, 0xD0, 0x0F, 0xFF, 0xFF,
-    0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFD, 0x00, 0xBE, 0x0F, 0xD0, 0x0B, 0xD0, 0xBE, 0x00, 0xBF,
-    0x0F, 0xE0, 0x0B, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xC0, 0xF9, 0x96, 0xF0,
-    0x01, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x54, 0x2F, 0xC0, 0x03, 0xF8, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x03, 0xFC, 0x3F, 0xC0, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0A, 0xAF, 0xFE, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xFF, 0xC0,
-    0x0A, 0xAF, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2C, 0xF3, 0xDF, 0x7D, 0xF6, 0x40, 0x00, 0x03, 0xAE, 0xBA, 0xEB, 0xAD, 0xB6, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0xF4, 0x07, 0xC0, 0xB4, 0x0B, 0xC0, 0x20, 0x07, 0xFE,
-    0x40, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x0F, 0x40, 0xFC, 0x1F, 0x95, 0xFC, 0x0F, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xF4, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFC, 0x04, 0x00, 0xFC, 0x1F, 0xE6, 0xFC, 0x3F,
-    0xFF, 0xF4, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0xBF,
-    0x5F, 0xF2, 0xFE, 0x6A, 0x86, 0xA4, 0x02, 0xF8, 0x01, 0xFF, 0xF0, 0x3D, 0x07, 0xC7, 0x9F, 0x2D,
-    0x77, 0x41, 0xD7, 0x9F, 0x2D, 0x3D, 0x07, 0xC1, 0xFF, 0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x2E,
-    0xC2, 0xDB, 0x4D, 0x0D, 0x30, 0x38, 0xFF, 0xE0, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0C,
-    0x00, 0xB4, 0x3C, 0x03, 0xF1, 0xFC, 0x1F, 0xDB, 0xF0, 0x7F, 0x2F, 0x80, 0xBE, 0x3F, 0x40, 0x7F,
-    0xAF, 0xD0, 0x1F, 0xEB, 0xF4, 0x07, 0xF2, 0xF8, 0x00, 0xE0, 0xB4, 0x00, 0x10, 0x10, 0xFE, 0xA5,
-    0x43, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x01, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x55, 0x55, 0x53, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x01, 0xA4, 0x00,
-    0xFF, 0xF0, 0x3F, 0xEB, 0xC7, 0xA1, 0x6D, 0x76, 0xF5, 0xD7, 0xAA, 0x5D, 0x3F, 0xAF, 0xC1, 0xFF,
-    0xF4, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0xBF, 0xE0, 0x2F, 0xFF, 0x83, 0xF0, 0xFC, 0x7E, 0x07, 0xD7, 0xF0, 0xFD, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xF4, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x2F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x15, 0x54, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0x83, 0x5D, 0x00, 0xE0, 0x0D, 0x07, 0xC1, 0xF4, 0x3F, 0xF2, 0xA9, 0x2F, 0xC0, 0x52,
-    0xC0, 0x0B, 0x03, 0xF4, 0x05, 0xF0, 0x42, 0xC3, 0xFF, 0x0B, 0xF4, 0x07, 0xC0, 0xF8, 0x1F, 0x43,
-    0xF0, 0x14, 0x00, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x0F, 0xD7, 0xF0, 0x03, 0xF5, 0xFC, 0x00, 0xFD,
-    0x7F, 0x00, 0x3F, 0x5F, 0xD0, 0x0F, 0xD7, 0xF4, 0x03, 0xF5, 0xFF, 0x01, 0xFD, 0xBF, 0xF9, 0xFF,
-    0xAF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFA, 0xF7, 0xFE, 0xFE, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0xF8, 0x3F, 0xF8, 0xFC, 0xBF, 0xF8, 0xFC, 0xFF, 0xF4, 0xFC,
-    0xFF, 0xF4, 0xFC, 0xBF, 0xF4, 0xFC, 0x3F, 0xF0, 0xFC, 0x0F, 0xF0, 0xFC, 0x0B, 0xF0, 0xFC, 0x0F,
-    0xF0, 0xFC, 0x0F, 0xF0, 0xFC, 0x0F, 0xF0, 0xBC, 0x1F, 0xF0, 0xBC, 0x2F, 0xE0, 0xBC, 0x3F, 0xE0,
-    0xBC, 0x3F, 0xE0, 0xBC, 0x3F, 0xE0, 0xBC, 0x7F, 0xD0, 0xBC, 0x3F, 0x4F, 0xE3, 0xF9, 0xFF, 0x6A,
-    0x80, 0x0A, 0x00, 0xE0, 0x2F, 0x83, 0xBE, 0x01, 0xE2, 0xFD, 0x3F, 0x80, 0x0B, 0x02, 0xF0, 0x0B,
-    0x00, 0xB0, 0x0B, 0x00, 0xF0, 0x3F, 0xE2, 0xA9, 0x0B, 0xE0, 0xB6, 0xE3, 0x83, 0xCF, 0x0F, 0x2F,
-    0xF8, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x30, 0x00, 0xB4, 0x3C, 0x00, 0xBE, 0x3F,
-    0x40, 0x2F, 0xCF, 0xD0, 0x07, 0xF2, 0xF8, 0x03, 0xF5, 0xFC, 0x0F, 0xFB, 0xF8, 0x3F, 0xEF, 0xE0,
-    0x7F, 0x2F, 0x80, 0x3C, 0x1D, 0x00, 0x20, 0x04, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x14, 0x03, 0xFC, 0x00, 0x01, 0xF4, 0x05, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0xBC,
-    0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x01, 0xF4, 0x00, 0x1B,
-    0xD4, 0x0F, 0xC1, 0x81, 0xFF, 0xF0, 0xBD, 0x0F, 0x47, 0xFF, 0xC7, 0xF0, 0xFD, 0x00, 0x00, 0x3F,
-    0x0B, 0xB4, 0x00, 0x01, 0xF8, 0x76, 0xD0, 0x00, 0x0F, 0xC3, 0xCB, 0x40, 0x00, 0xBE, 0x2E, 0xBF,
-    0x80, 0x07, 0xF0, 0xFF, 0xFF, 0x00, 0x3F, 0x41, 0x57, 0xF4, 0x02, 0xFC, 0x00, 0x0F, 0x80, 0x0F,
-    0xD0, 0x00, 0x3E, 0x00, 0x69, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x01, 0x40, 0x03, 0xFC, 0x00, 0x01, 0xF4, 0x00, 0x5F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-    0xBC, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00, 0x1F,
-    0x40, 0x00, 0x1B, 0xD4, 0x0F, 0xC6, 0xF8, 0x1F, 0xFF, 0x0B, 0xD7, 0xFF, 0xC7, 0xFF, 0xC7, 0xE1,
-    0xD0, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x1E, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0x80, 0x00, 0xFC, 0x00,
-    0x07, 0xD0, 0x00, 0xFD, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x40, 0x0F,
-    0xF9, 0x40, 0x2F, 0x80, 0x03, 0xFF, 0xF0, 0x0F, 0xC0, 0x01, 0xFF, 0xFC, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFB, 0xF4, 0x00, 0x29, 0x00, 0x00, 0xE0, 0x02, 0xF0, 0x00,
-    0x03, 0x80, 0x1F, 0x40, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x3F, 0xF0, 0x0B, 0xD0, 0x00, 0x02, 0xF0,
-    0x3E, 0x00, 0x05, 0x07, 0xC3, 0xF0, 0x00, 0x3F, 0xFF, 0x1F, 0x83, 0xC0, 0xFF, 0xF4, 0xFC, 0x2F,
-    0x41, 0xBE, 0x4B, 0xD1, 0xFD, 0x00, 0x00, 0x7F, 0x0E, 0xB4, 0x00, 0x03, 0xF0, 0xF2, 0xD0, 0x00,
-    0x2F, 0x8B, 0x9F, 0x90, 0x00, 0xFC, 0x3F, 0xFF, 0xC0, 0x0F, 0xD0, 0x6A, 0xFE, 0x00, 0x7F, 0x00,
-    0x03, 0xE0, 0x03, 0xF4, 0x00, 0x0F, 0x80, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0x90, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x05,
-    0x0B, 0xF0, 0x07, 0xD0, 0xFF, 0xBF, 0xF8, 0x0F, 0xFF, 0xF4, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40,
-    0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF,
-    0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00,
-    0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xCB,
-    0xE0, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07,
-    0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x38, 0x00, 0x00, 0x1F, 0xF3, 0xC0, 0x00, 0x02, 0xDB,
-    0xF8, 0x00, 0x00, 0x2D, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00,
-    0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x3F,
-    0xD0, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x0B,
-    0xF8, 0xFF, 0x00, 0x00, 0x6A, 0x4A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00,
-    0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0,
-    0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00,
-    0x3F, 0xD0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xEE, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x06, 0x8A, 0xAF, 0xFF, 0xD0, 0x00, 0x01, 0xFE, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0xBE, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0xD4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xAA, 0xA4, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x2F, 0xE0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xD3, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F,
-    0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0xEF, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0x83, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xE4, 0x00, 0x07, 0xF4, 0x00,
-    0x01, 0xFD, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xF4, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x07,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x90, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01,
-    0xFE, 0xAA, 0xA4, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xEB, 0xE0, 0x0F, 0xC0, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00,
-    0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF,
-    0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x0F, 0xD0, 0xFC, 0x03, 0xF8, 0x7F, 0x00, 0xFE, 0x2F, 0xD0, 0x7F,
-    0xCB, 0xF8, 0x1A, 0xA1, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A,
-    0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07,
-    0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2,
-    0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x2A, 0x00, 0x07, 0xF4, 0x00, 0x7F,
-    0x80, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x7F,
-    0x40, 0x1F, 0xD0, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8,
-    0x02, 0xFF, 0x00, 0xBF, 0xC0, 0x07, 0xC3, 0xD1, 0xF0, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x7F, 0x5F, 0xD7, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x4F,
-    0xD3, 0xF4, 0xFD, 0x7F, 0x9F, 0xE7, 0xFA, 0xFF, 0xBF, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0xFE, 0x00,
-    0x03, 0xFF, 0x80, 0x0F, 0xEB, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x01, 0xFE, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x1A, 0x02, 0xA0, 0xFD, 0x1F,
-    0xC3, 0xF8, 0x7F, 0x5F, 0xE2, 0xFD, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0x40, 0x01, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00,
-    0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00,
-    0x0B, 0xFC, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00,
-    0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xFF,
-    0xFD, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0xFD, 0x15, 0xFF, 0x94, 0x00, 0xFD, 0x00, 0xBF, 0x00,
-    0x03, 0xFD, 0x00, 0xBF, 0x00, 0x6F, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x4B, 0x00, 0x00, 0x3F, 0xDB, 0x00, 0x00, 0x3D, 0xFF, 0x00,
-    0x00, 0x3C, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC,
-    0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC,
-    0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8,
-    0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4,
-    0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F,
-    0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0,
-    0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F,
-    0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02,
-    0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00,
-    0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF,
-    0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00,
-    0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB,
-    0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF8, 0x74, 0x00, 0x00, 0x2F, 0xE7, 0x40, 0x00, 0x03, 0xCF, 0xF4, 0x00, 0x00,
-    0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02, 0xFD,
-    0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F,
-    0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x80,
-    0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0xFF, 0x0F, 0xE0, 0x00,
-    0x0F, 0xF1, 0xFF, 0x00, 0x00, 0xAA, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF8, 0x07, 0xFE, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4, 0x00, 0x03,
-    0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x6F,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0xF4, 0x03, 0xFE, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x03, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x07, 0xFD, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xAF, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF4, 0x0F, 0xFB, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x02,
-    0xFF, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x3F, 0xD1, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x0F, 0xF8,
-    0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF1, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x3F,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x06,
-    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0,
-    0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F,
-    0xFC, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xA4, 0x1A, 0x00, 0x02, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD, 0x00,
-    0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x2F,
-    0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x54, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0xE4, 0x00, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xF0, 0xFD, 0x7F, 0xCF, 0x80, 0xFD, 0xF8, 0x0B, 0xDF, 0x81, 0xFC, 0xFE, 0xFF, 0x8F, 0xFF, 0xE0,
-    0xFF, 0xF4, 0x0F, 0xD0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xFE, 0x40,
-    0x03, 0xFF, 0xF8, 0x02, 0xF9, 0x6F, 0x00, 0xFC, 0x03, 0xE0, 0x3E, 0x02, 0xF8, 0x1F, 0x83, 0xFD,
-    0x07, 0xE2, 0xF0, 0x01, 0xF8, 0xB8, 0x00, 0x7E, 0x1F, 0x80, 0x2F, 0xC3, 0xFD, 0x0B, 0xF0, 0x3F,
-    0xD2, 0xFC, 0x02, 0xFC, 0xBF, 0x80, 0x3F, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xE0, 0x00, 0x15, 0x40, 0x00, 0x1A, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8,
-    0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x0F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F,
-    0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00,
-    0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E,
-    0x00, 0x2E, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF,
-    0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC,
-    0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x02, 0xE1, 0xD0, 0x07,
-    0xF9, 0xE0, 0x0B, 0x7F, 0xD0, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC,
-    0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x1F, 0xC2, 0xF8, 0x2F, 0xC3, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xD7,
-    0xFC, 0x2A, 0x82, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4,
-    0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4,
-    0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD,
-    0x7E, 0x00, 0x7D, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xEB, 0x40, 0x00, 0xFF, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F,
-    0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01,
-    0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF9, 0xF4, 0xBF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xAF, 0xFF, 0xD1,
-    0xF8, 0x3D, 0x02, 0xFF, 0x55, 0xBD, 0xBC, 0x01, 0xFF, 0xFF, 0xFE, 0xB8, 0x00, 0xFF, 0xFF, 0xFE,
-    0xF4, 0x00, 0xFE, 0x00, 0x00, 0xB8, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFA, 0xAE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFF, 0xFE, 0x06, 0xFD, 0x7F, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0xFF, 0xFC, 0x0B, 0xFE, 0xF0, 0x7F, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0x40, 0x00, 0xBE, 0x00, 0x02, 0xFD, 0x04, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x02,
-    0xFF, 0x80, 0x01, 0xE4, 0x00, 0x0F, 0xF4, 0x00, 0x12, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xF8, 0x00,
-    0x1A, 0x40, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xFF, 0xC0,
-    0x07, 0xF7, 0xF4, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55,
-    0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD,
-    0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x0A, 0x81, 0xA4, 0x1F, 0xC2, 0xF8, 0x2F,
-    0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8,
-    0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F,
-    0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x69, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x07, 0xD0, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x03,
-    0xF8, 0x00, 0xFF, 0x00, 0x0F, 0x0B, 0xC3, 0xE2, 0xF0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x07, 0xD1, 0xF4, 0x7D, 0x1F, 0x47, 0xD2, 0xF4, 0xBD, 0x2F, 0x4B, 0xE3, 0xF8, 0xFF, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x1F, 0xCB,
-    0xF6, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F,
-    0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F, 0x80,
-    0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x05, 0x6F, 0xD5, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xBE, 0x4F, 0x80, 0x02, 0xFF, 0xFB, 0xD0, 0x02,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFD, 0x03, 0xFC, 0x00, 0x3F, 0x00, 0xBF, 0x00, 0x1F, 0xC0, 0x1F, 0x80,
-    0x03, 0xF8, 0x0F, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8,
-    0x00, 0x00, 0x0A, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x02, 0xFE, 0x74, 0x03,
-    0xCF, 0xF4, 0x03, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F,
-    0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D,
-    0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF,
-    0x00, 0xFF, 0x1A, 0x40, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F,
-    0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00,
-    0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xE0, 0x0B, 0xF9, 0xE0, 0x0F,
-    0x7F, 0xD0, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF,
-    0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE,
-    0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x1F,
-    0xC2, 0xF8, 0x2F, 0xC3, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xD7, 0xFC, 0x2A, 0x82, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x6A, 0xAB, 0xF4, 0x0F, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x90, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x6F,
-    0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xF4, 0x2F, 0x4F, 0xEF, 0x83,
-    0xF6, 0xF9, 0xF8, 0x3F, 0x7F, 0x5F, 0x82, 0xFF, 0xF7, 0xF8, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xF9, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07,
-    0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC,
-    0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF,
-    0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBF, 0x40,
-    0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE,
-    0x07, 0xFE, 0xFE, 0x0A, 0x41, 0xA4, 0x1F, 0xC3, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xD3, 0xFC, 0x3F,
-    0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00,
-    0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD,
-    0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC,
-    0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03, 0xF8,
-    0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF, 0xF8,
-    0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0xFD, 0xBF, 0x4F, 0xC1, 0xFC,
-    0xFC, 0x07, 0xDF, 0xC0, 0x3E, 0xBC, 0x07, 0xDB, 0xC0, 0xFC, 0xBC, 0x2F, 0xCB, 0xDB, 0xF0, 0xBF,
-    0xFD, 0x0B, 0xFF, 0x40, 0xBE, 0x40, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00,
-    0x06, 0x80, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x7F, 0x0F, 0xF0, 0x0B, 0xF4, 0xFF, 0x00, 0xFF, 0x4F,
-    0xF0, 0x0A, 0xA4, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC3, 0xF4, 0x02, 0xF8, 0x2F, 0xC0, 0x3F,
-    0x40, 0xFD, 0x03, 0xF0, 0x0B, 0xF0, 0x7E, 0x00, 0x3F, 0x8F, 0xD0, 0x02, 0xFD, 0xFC, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0xFF, 0x80, 0x02, 0xFF, 0xF0, 0x00, 0x2F, 0xFD,
-    0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x56, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x05, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00,
-    0x03, 0xF4, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03,
-    0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07,
-    0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x10, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFC, 0xBE,
-    0xAA, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9,
-    0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC,
-    0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06,
-    0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8,
-    0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00,
-    0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD,
-    0x06, 0xFD, 0x7E, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F,
-    0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBE, 0x7D, 0x00, 0xFF, 0xFF, 0x40, 0xFE, 0xBF, 0xE0, 0x3D, 0x02, 0xF8, 0x2F,
-    0x00, 0x7F, 0x0B, 0x80, 0x0F, 0xC3, 0xD0, 0x03, 0xF0, 0xB8, 0x01, 0xFC, 0x2F, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x06, 0xFD, 0x7F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xB4, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x2E, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0xF0, 0x2F, 0xFB, 0xC1, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F,
-    0x40, 0x00, 0xFD, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xF4, 0x10, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0,
-    0x0A, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F,
-    0xF0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x3D, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F, 0x40, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x03, 0xFF, 0xF0, 0x0B, 0xFE, 0xF0, 0x1F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x1F, 0xD0, 0x40, 0x0F,
-    0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0xAF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x02, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0xFC, 0x00, 0x03,
-    0xF4, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x80, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x03,
-    0xFF, 0xF0, 0x2F, 0xFB, 0xC1, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFD, 0x00, 0x02,
-    0xF8, 0x00, 0x07, 0xF4, 0x10, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x0A, 0xFE, 0x00, 0x00, 0xA4,
-    0x01, 0xA0, 0x00, 0x7E, 0x0B, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2F, 0xF4,
-    0x00, 0x00, 0x1F, 0xFE, 0x40, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4,
-    0x1F, 0xDF, 0xD0, 0x07, 0xFF, 0x40, 0x01, 0xFD, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x0F, 0xFF, 0xC0, 0x2F, 0xFB, 0xC0, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x41, 0x00, 0x3F, 0xFF, 0x80,
-    0x1F, 0xFF, 0xE0, 0x02, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x2F, 0x00, 0x02, 0xF9,
-    0xFC, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE4, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xD0, 0xBF, 0xAA, 0xFF, 0xF0, 0xBF, 0x00, 0x0F, 0xF8, 0xBF, 0x00,
-    0x03, 0xFC, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00,
-    0x00, 0xFD, 0xBF, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x02, 0xFD, 0xBF, 0x00, 0x6F, 0xFC, 0xBF, 0xFF,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0xBF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF,
-    0xF9, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC6, 0x80, 0x00, 0x03, 0xF2, 0xF0, 0x00,
-    0x00, 0xFC, 0xFC, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0xCF, 0xC0, 0x1F, 0xE3, 0xF7, 0xF0,
-    0x2F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x0F, 0xC0, 0xFF, 0x80, 0x07, 0xC0, 0x1F, 0xE0,
-    0x02, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x2F, 0x40, 0xBF, 0x80, 0x07, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00,
-    0xBF, 0xFF, 0xE4, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xAA, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x00, 0x02, 0xFC, 0x00, 0xBF, 0x00,
-    0x00, 0xFD, 0x00, 0xBF, 0x00, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0xFD, 0x3F, 0xFF, 0xFD, 0x00,
-    0xFD, 0x15, 0xFF, 0x94, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x03, 0xFD, 0x00, 0xBF, 0x00, 0x6F, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x2A, 0xBF, 0xA9, 0x00, 0x00, 0x3F,
-    0x00, 0x01, 0xFE, 0x3F, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0x03, 0xFE,
-    0x00, 0x7C, 0x01, 0xFE, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xBD, 0x02, 0xFE,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x7F,
-    0x00, 0x00, 0x00, 0x54, 0x07, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xD0, 0xAA, 0x95, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x50, 0x2F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x6A,
-    0xAA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC,
-    0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F,
-    0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x00, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0x41, 0xF8, 0x1F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF,
-    0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00,
-    0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x6A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0xBE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF,
-    0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD,
-    0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0x50,
-    0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F,
-    0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0xFA, 0x40, 0x00, 0xFF, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE0, 0x2F, 0x40, 0x7F, 0x7F, 0x40, 0x07, 0xFF, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF,
-    0xF4, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0x90,
-    0x00, 0x1F, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x01, 0xFE, 0xAA, 0xA4, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xCB, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFC, 0x0F, 0xEB,
-    0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B,
-    0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0x00, 0x2F, 0x9F, 0xD0, 0x00, 0x0B, 0xD0, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF, 0x80, 0x1F, 0xFF, 0xCB, 0xF8,
-    0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03, 0xF4, 0x3F, 0xFE, 0x55, 0xFF,
-    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B,
-    0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xDF, 0xD0,
-    0x0F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x5F, 0x80, 0xFF, 0xFF, 0xE0, 0xFE, 0xBF, 0xF8, 0x7D, 0x03, 0xFE, 0x2E, 0x00, 0xBF,
-    0x8B, 0x80, 0x1F, 0xD3, 0xD0, 0x07, 0xF4, 0xB8, 0x01, 0xFD, 0x2F, 0x41, 0xFF, 0x47, 0xFF, 0xFF,
-    0xD0, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xBF, 0x00, 0x00, 0x0F, 0xC0, 0x60, 0x1F,
-    0xE0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0x07, 0xFF, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF0, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xD0, 0x01, 0x80, 0x3F, 0xE0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x1E, 0x94, 0x0B, 0xF8, 0x01, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xD7, 0xFC, 0x00, 0x5B,
-    0xFE, 0x3F, 0xE0, 0x00, 0x3F, 0x43, 0xFF, 0xE5, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF,
-    0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x7E, 0x0B, 0xFF, 0xFD, 0x03, 0xFF, 0xF8, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE,
-    0xB8, 0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F,
-    0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xD0, 0x01, 0x80, 0x3F, 0xE0, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x1E, 0x94, 0x0B, 0xF8, 0x01, 0xFF, 0xFC, 0xBF, 0x80, 0x0F, 0xFF, 0xD7, 0xFC, 0x00, 0x5B, 0xFE,
-    0x3F, 0xE0, 0x00, 0x3F, 0x43, 0xFF, 0xE5, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F,
-    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFD, 0x00, 0x18, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x01, 0xE9, 0x40, 0xBF,
-    0x80, 0x1F, 0xFF, 0xCB, 0xF8, 0x00, 0xFF, 0xFD, 0x7F, 0xC0, 0x05, 0xBF, 0xE3, 0xFE, 0x00, 0x03,
-    0xF4, 0x3F, 0xFE, 0x55, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x6A, 0x90, 0x00, 0x7F, 0xD0, 0x00, 0x7F,
-    0xC0, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x55, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x7E, 0x0F, 0xFF, 0xFE, 0x3F, 0xAF, 0xFE, 0x7D, 0x03, 0xFE, 0xB8,
-    0x02, 0xFE, 0xB8, 0x01, 0xFD, 0xF4, 0x01, 0xFD, 0xB8, 0x01, 0xFD, 0xBD, 0x07, 0xFD, 0x7F, 0xFF,
-    0xFD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFC, 0x02, 0xFE, 0xFC, 0x00, 0x00, 0xFC, 0x18, 0x07, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x7F, 0xFF, 0x80, 0x00, 0x54, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x03, 0xF0, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x03, 0xFC,
-    0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD,
-    0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA, 0xAB, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD,
-    0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xDB, 0xF0, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEF, 0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8,
-    0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC,
-    0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x0F, 0xD0, 0x00, 0xFF,
-    0x00, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x00, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xE0, 0x00, 0xFF, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFA, 0xAA, 0xFF, 0x42,
-    0xFF, 0x00, 0x1F, 0xF4, 0x2F, 0xF0, 0x01, 0xFF, 0x42, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xBD, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x7E, 0xFD, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xEF,
-    0xF0, 0x00, 0xFE, 0x01, 0xF4, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0xF8, 0x01, 0xFC, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x02, 0xFC, 0x01, 0xFC, 0x02, 0xFC, 0x02, 0xFC, 0x02, 0xFD, 0x02,
-    0xFC, 0x03, 0xFD, 0x03, 0xFC, 0x1F, 0x4F, 0x0F, 0xF6, 0xC3, 0xDF, 0xF1, 0xF1, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x7F, 0x40, 0x1F, 0xD0,
-    0x07, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x40,
-    0x0F, 0xD0, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x7F, 0x80, 0x1F, 0xE0, 0x07, 0xF8, 0x02, 0xFF, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x3E, 0x1D, 0xBF, 0x9E, 0xF7, 0xFD, 0xB4, 0xB8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x90, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x0B, 0xD0,
-    0x0B, 0xD0, 0x0B, 0xD0, 0x0B, 0xE0, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFD, 0x3E, 0xAA, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x7F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x80, 0x00,
-    0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0xBF, 0xC0, 0x00, 0xBF, 0xC0, 0x00, 0x55, 0xA0, 0x3F, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xFC, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0xFF, 0x00, 0x1F, 0xD1, 0xFD, 0x1F, 0xD1, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFD, 0x0F, 0xD0, 0xFD, 0x0F, 0xD1, 0xFE, 0x1F, 0xE1, 0xFE, 0x2F, 0xF2, 0xFF, 0x3F,
-    0x07, 0xC0, 0xBF, 0xC3, 0xFC, 0x01, 0x40, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00,
-    0x00, 0x01, 0xA0, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F,
-    0x83, 0xF8, 0x3F, 0xC1, 0xF4, 0x3E, 0x0B, 0xC0, 0xFF, 0xD7, 0xFE, 0x06, 0xD0, 0x2A, 0x0F, 0xC7,
-    0xF6, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF5, 0xFD, 0x7F, 0x0F, 0xC3, 0xF0,
-    0xFC, 0x3F, 0x0F, 0xC3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD7, 0xF9, 0xFE, 0x7F, 0xAF, 0xFB, 0xFC, 0x69,
-    0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0xBD, 0xBD, 0xBD, 0xBE, 0xFE, 0xFF, 0x3F, 0xC0, 0x00, 0x3F, 0x8F,
-    0xF0, 0x00, 0x0F, 0xE3, 0xFC, 0x00, 0x07, 0xF8, 0xBF, 0x00, 0x01, 0xFD, 0x2F, 0xC0, 0x00, 0x7F,
-    0x4B, 0xF0, 0x00, 0x2F, 0xD2, 0xFC, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00,
-    0xFF, 0x0B, 0xF0, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x0F, 0xF0, 0xBF, 0x00, 0x03, 0xF8, 0x2F, 0xC0,
-    0x00, 0xFE, 0x0B, 0xF0, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x1F, 0xD0, 0xFF, 0x40, 0x07, 0xF4, 0x3F,
-    0xD0, 0x01, 0xFC, 0x0F, 0xF4, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x50, 0x1F, 0xF0,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x2B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x2F, 0x0F, 0xE0, 0x0F,
-    0xC3, 0xFC, 0x03, 0xF4, 0xFF, 0x00, 0x54, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x14, 0x00, 0xFC, 0x1F, 0x40, 0x3F, 0x07, 0xD0, 0x0F, 0xC1, 0xF4, 0x03, 0xF0, 0x7D, 0x00,
-    0xFC, 0x1F, 0x40, 0x3E, 0x0B, 0xD0, 0x0F, 0x82, 0xF4, 0x03, 0xE0, 0xBD, 0x00, 0xF8, 0x2F, 0x80,
-    0x3D, 0x0F, 0xE0, 0x1F, 0x43, 0xFC, 0x07, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x03,
-    0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x07, 0xF7, 0xF0, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x02,
-    0x40, 0xBF, 0x80, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xD0, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF, 0x00, 0x02, 0xFF,
-    0xC0, 0x0F, 0xE7, 0xF0, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F,
-    0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF, 0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3,
-    0xFC, 0x00, 0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0, 0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B,
-    0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF, 0xFC, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0xFC, 0xBE, 0x00, 0x3E, 0xBF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x40, 0x01, 0xFF, 0x80,
-    0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x0B, 0xFF, 0xF8, 0x02, 0xF9, 0xFF, 0x80, 0xBF, 0x2F,
-    0xFC, 0x3F, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA,
-    0x40, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x1A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0xF0, 0x3D, 0x7C,
-    0x03, 0xCF, 0x80, 0x3E, 0xF0, 0x03, 0xFD, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0xBF, 0xE0, 0x0B,
-    0xFF, 0x80, 0xB8, 0xFF, 0x0F, 0x87, 0xFC, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0,
-    0x00, 0x07, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xDB, 0xFF,
-    0xFF, 0xF6, 0xFF, 0xFF, 0xFD, 0x03, 0xC0, 0x2F, 0x00, 0xF4, 0x0B, 0xC0, 0x15, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF8, 0x07, 0xE0, 0x1F,
-    0x80, 0x7D, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x0B, 0xD0, 0x3F, 0x40, 0xFF,
-    0xE3, 0xFF, 0xCF, 0xFF, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xBE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xD0, 0xBF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFD, 0x03, 0xF0,
-    0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x40,
-    0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x0B, 0xD0, 0x02, 0xF4, 0x00, 0xFD, 0x00,
-    0x3F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFF, 0xC0, 0x3F, 0xF0, 0x0F, 0xF4, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x01, 0xA0, 0x3F, 0x80, 0xBC,
-    0x0F, 0xE0, 0x3F, 0x03, 0xF8, 0x0F, 0xC0, 0xFE, 0x03, 0xF0, 0x3F, 0x80, 0xFC, 0x0F, 0xE0, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0xBC,
-    0x00, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0x54, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
-    0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00,
-    0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0F, 0xD0, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x00,
-    0x2F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x06, 0x80, 0xFE, 0x03, 0xF8, 0x3F, 0x80, 0xFE,
-    0x0F, 0xE0, 0x7F, 0xC3, 0xF8, 0x1F, 0xF0, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x03, 0xF4, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0xFF,
-    0xF6, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x03, 0xF0, 0x00,
-    0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x1F, 0xC7, 0xE2, 0xFC, 0x7E, 0x3F, 0xC7, 0xD3, 0xFC, 0xBD,
-    0x2A, 0x8B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x02, 0xF8, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFB, 0xFF,
-    0xFF, 0xF4, 0x00, 0x7F, 0xAF, 0xFF, 0xFF, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02,
-    0xFB, 0xF4, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x1F, 0xFD, 0x00, 0x07, 0xFF, 0xF4,
-    0x01, 0xFF, 0x8B, 0xD0, 0x00, 0x10, 0x3F, 0x40, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8, 0x01, 0xFC,
-    0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF, 0x82, 0xFC,
-    0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3, 0xF7, 0xF8,
-    0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0, 0x7F, 0xF4,
-    0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E,
-    0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00,
-    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC,
-    0x1F, 0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC,
-    0x3F, 0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8,
-    0x3F, 0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4,
-    0x7F, 0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F,
-    0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00,
-    0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x40,
-    0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0xA0, 0x02, 0xA0, 0x00, 0xBE, 0x1F, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F,
-    0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F,
-    0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F,
-    0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F,
-    0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x0A, 0x40, 0x2A, 0x01, 0xF8,
-    0x7F, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xF8, 0x00, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFB, 0xFC, 0x0F, 0xD0, 0x2F, 0x07, 0xF0, 0x07, 0xD1, 0xF8, 0x01, 0xF4, 0x7F,
-    0x00, 0xBE, 0x1F, 0xC0, 0x2F, 0x8B, 0xF0, 0x0F, 0xE2, 0xFC, 0x03, 0xFC, 0xBF, 0x00, 0xFF, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x40, 0x01, 0xFE, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F,
-    0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D,
-    0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F, 0xF8,
-    0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F, 0xFF,
-    0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F, 0xD3,
-    0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F, 0xD0,
-    0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x03,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB, 0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D,
-    0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE, 0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF,
-    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0xF0, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xF8, 0x07, 0xFE, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x7F, 0x87, 0xF4,
-    0x00, 0x03, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x1F,
-    0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x80, 0x00, 0x3F, 0xC7, 0xFF, 0x50, 0x6F, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA0, 0x3F, 0xFF, 0xF8, 0x7F,
-    0xFF, 0xFC, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E,
-    0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7D, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07,
-    0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0,
-    0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD,
-    0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x1F, 0xC0, 0x03, 0xF4, 0x02, 0xFC, 0x00,
-    0x7F, 0x40, 0x3F, 0xC0, 0x0B, 0xF0, 0x02, 0xA4, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x02, 0xFD, 0x00, 0x0F, 0xF4, 0x0F, 0xF0, 0x00, 0x1F,
-    0xE0, 0x7F, 0x40, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x01, 0xFC, 0x2F,
-    0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x07, 0xFF, 0x50,
-    0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x0F, 0xD0, 0x2F, 0xC0, 0x07, 0xF4, 0x0F, 0xF0, 0x02, 0xFD, 0x02, 0xA4, 0x00, 0xAA,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x7F, 0x00, 0xFD, 0x00, 0x0B, 0xD0, 0x0B, 0xE0,
-    0x00, 0xFD, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x0B, 0xE0, 0x00, 0xBF, 0x41, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAB, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0F, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0B,
-    0xF4, 0x00, 0x3F, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x2F, 0xC0, 0x00, 0x2F, 0xFF, 0xF4, 0x0B, 0xF0,
-    0x00, 0x0B, 0xFF, 0xFD, 0x02, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x40,
-    0x6F, 0x80, 0x03, 0xFF, 0xFD, 0xFF, 0xFD, 0x03, 0xFE, 0xBF, 0xFD, 0x0B, 0xC1, 0xFC, 0x03, 0xFE,
-    0x55, 0xF8, 0xBD, 0x00, 0xBF, 0xFF, 0xFF, 0x3F, 0x40, 0x1F, 0xFF, 0xFF, 0xCB, 0xD0, 0x0B, 0xF4,
-    0x00, 0x02, 0xFD, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFA, 0xAF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0xFF, 0xFE, 0x7F, 0xFF, 0xF0, 0x06, 0xF9, 0x02, 0xBF, 0x90, 0x00, 0x05, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF5, 0x5F, 0xC0, 0x2F,
-    0x00, 0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x55, 0xFE,
-    0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFE, 0x07, 0xFC,
-    0x0B, 0xF0, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x0B, 0xF8, 0x7F, 0xC0, 0xBF, 0xCB, 0xFC, 0x0B, 0xFD,
-    0x7F, 0xC0, 0xBF, 0xE0, 0x00, 0x50, 0x00, 0xB8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xFA, 0xF4, 0xBF, 0xFE, 0x3F, 0xFF, 0x8F, 0xF4, 0x03, 0xF8, 0x00, 0xFD, 0x00, 0x3F,
-    0x40, 0x0F, 0xD0, 0x03, 0xF4, 0x01, 0xFE, 0x00, 0xBF, 0xC0, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF5, 0x5F, 0xC0, 0x2F, 0x00,
-    0x3E, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x55, 0xFE, 0x03,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xD1, 0xFE, 0x07, 0xFC, 0x0B,
-    0xF0, 0x7F, 0xC0, 0xBF, 0x47, 0xFC, 0x0B, 0xF8, 0x7F, 0xC0, 0xBF, 0xCB, 0xFC, 0x0B, 0xFD, 0x7F,
-    0xC0, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x02,
-    0xFE, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xD0, 0xBF,
-    0xFE, 0x0F, 0xFF, 0xE0, 0xFF, 0x40, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00,
-    0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x2F, 0xF0, 0x02, 0xFF, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0xFD, 0x7F,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x55, 0xFC,
-    0x02, 0xF0, 0x03, 0xE0, 0x3F, 0x00, 0x3F, 0x03, 0xF0, 0x03, 0xF0, 0x3F, 0x00, 0x3F, 0x03, 0xF5,
-    0x5F, 0xE0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x03, 0xFD, 0x1F, 0xE0,
-    0x7F, 0xC0, 0xBF, 0x07, 0xFC, 0x0B, 0xF4, 0x7F, 0xC0, 0xBF, 0x87, 0xFC, 0x0B, 0xFC, 0xBF, 0xC0,
-    0xBF, 0xD7, 0xFC, 0x0B, 0xFE, 0x7E, 0x00, 0xF8, 0x1F, 0xCB, 0xE0, 0x07, 0xFF, 0x80, 0x01, 0xFE,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFA, 0xF4, 0x02, 0xFF, 0xF8,
-    0x03, 0xFF, 0xF8, 0x03, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03,
-    0xF4, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90,
-    0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x06, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40,
-    0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE,
-    0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBF,
-    0x00, 0x02, 0xFF, 0xC0, 0x0B, 0xEB, 0xF0, 0x2F, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x07, 0x90, 0x02, 0xFF, 0x0F,
-    0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFA, 0x00, 0x00,
-    0xB9, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x4B, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F,
-    0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95,
-    0xFE, 0x2F, 0xFF, 0xFD, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0x80, 0x03, 0x80, 0x00, 0x07, 0xE0, 0x00,
-    0x0A, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0xC0,
-    0x00, 0xFD, 0x3F, 0x40, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFE, 0x80,
-    0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x40, 0x0B, 0xF8, 0x06, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x02, 0xFE,
-    0x07, 0x90, 0x02, 0xFF, 0x0F, 0xFE, 0x9B, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x07, 0xF7,
-    0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0x40, 0x50, 0x0F, 0x40, 0x00, 0x0B, 0xF9, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0xFE, 0x0F, 0x95, 0xFE, 0x3F, 0xFF, 0xFD, 0xBF, 0xFF,
-    0xF8, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x04, 0xB8, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xBD, 0x00, 0x02, 0xF4, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x1A, 0xFE, 0xA8, 0x03, 0xF4, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xFE,
-    0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xAF, 0x00, 0x03, 0xFC,
-    0x00, 0x1F, 0xD0, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE,
-    0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x78, 0x0F, 0xC0, 0x2F, 0x40,
-    0xFC, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x00, 0x6B,
-    0xFA, 0xA0, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x2F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0x5F, 0xF5, 0x40, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xBD, 0x00, 0x0F, 0xFF, 0xF8,
-    0x1F, 0xFF, 0xFC, 0x1A, 0xFE, 0xA8, 0x00, 0xFD, 0x00, 0xBF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x55,
-    0xFE, 0x54, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x00, 0xBF, 0x9D, 0x00, 0x00, 0xF3, 0xFD, 0x00,
-    0x00, 0xF0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xD0, 0x07, 0xF8, 0xE0, 0x0B, 0x7D, 0xE0, 0x0F, 0x6F, 0xD0,
-    0x0B, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC,
-    0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFE, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0xAB, 0xF4, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00,
-    0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE,
-    0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F,
-    0x40, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x1F,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
-    0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x3C, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07,
-    0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07,
-    0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03,
-    0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x01, 0xFF, 0x00, 0x02,
-    0xDF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x2A, 0x00, 0x0A, 0x90, 0x1F, 0xD0, 0x03,
-    0xF8, 0x0B, 0xF4, 0x01, 0xFE, 0x02, 0xFD, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC,
-    0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
-    0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00,
-    0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2A, 0x00, 0x06, 0x90, 0x0F, 0xE0, 0x02, 0xFC, 0x07, 0xF8, 0x00, 0xFE, 0x02,
-    0xFD, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x0B,
-    0xC0, 0x0F, 0xD0, 0x00, 0xBC, 0x00, 0xFD, 0x00, 0x07, 0xD0, 0x0F, 0xD0, 0x00, 0x7D, 0x00, 0xFD,
-    0x00, 0x07, 0xF0, 0x1F, 0xD0, 0x00, 0x3F, 0xE7, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8,
-    0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD,
-    0xBD, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7E, 0x00, 0xFD, 0x7F, 0x02, 0xFD, 0x3F, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x01, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x0B,
-    0xD8, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBE, 0xBF,
-    0x00, 0x00, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x02, 0xFC,
-    0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF4, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x2F, 0xF0, 0x0B, 0xE0, 0x0F, 0xF0, 0x1F, 0xF0,
-    0x0F, 0xF0, 0x1F, 0xF0, 0x0F, 0xF4, 0x2F, 0xF4, 0x2F, 0xE0, 0x0F, 0xF4, 0x3F, 0xFC, 0x3F, 0xD0,
-    0x0B, 0xF8, 0xBF, 0xFD, 0x3F, 0xC0, 0x07, 0xFC, 0xFF, 0xFF, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x03, 0xFF, 0xFE, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x02, 0xFF,
-    0xFC, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xF4, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFD, 0x00,
-    0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xBE, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x03, 0xF8, 0xFC, 0x01, 0x40, 0xFD, 0x3F, 0x43, 0xF0, 0x7F, 0x0B, 0xE2, 0xFE,
-    0x2F, 0x81, 0xFC, 0xFF, 0xCF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF,
-    0xFF, 0xFE, 0x00, 0x7F, 0xFB, 0xFF, 0x40, 0x0F, 0xFC, 0xFF, 0xC0, 0x03, 0xFD, 0x1F, 0xF0, 0x00,
-    0x69, 0x01, 0xA4, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x01, 0xFD, 0xFC, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00,
-    0xBF, 0x40, 0xFF, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0,
-    0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x02, 0xF9, 0xFD, 0x00, 0xBD, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00,
-    0xBF, 0x07, 0xE0, 0x03, 0xF8, 0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x01, 0xAF, 0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00,
-    0x00, 0x01, 0xFC, 0x2F, 0x80, 0x00, 0xBF, 0x0F, 0xE0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x0F, 0xF4,
-    0xFF, 0x00, 0x02, 0xA9, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0,
-    0xFF, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0xFF,
-    0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0B, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x01, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-    0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A,
-    0xBF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F,
-    0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01,
-    0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFE, 0xAA, 0x90, 0xBF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1A, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC0, 0x6A, 0xBF, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xF0, 0x00,
-    0x1F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x2F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x0B,
-    0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x02, 0x90, 0x02, 0x80, 0x00, 0x7F, 0x0B, 0xE0, 0x00, 0x07,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F,
-    0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xEA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0x80, 0x7E, 0x01, 0xFC, 0xBE, 0x00, 0x1F, 0xFE, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x1A, 0xAF, 0xF8, 0x00, 0x07, 0xF8, 0x00,
-    0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x0B, 0xFC, 0x00, 0x07,
-    0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x00, 0x07, 0xF9, 0x1F, 0xFE, 0x3F, 0xFE,
-    0x3F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x40, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x01,
-    0xA0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xBF, 0xE0, 0x0F, 0x00, 0x3F, 0xFF, 0xF8, 0xBC, 0x07,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xFE, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,
-    0x1F, 0xE0, 0x7F, 0x40, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0xBF, 0x0B, 0xF0, 0x00, 0x01, 0xFC,
-    0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x2F, 0xC2, 0xFE, 0x00, 0x00, 0xFF, 0x07, 0xFF,
-    0x50, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xBE, 0x43, 0xC0, 0xFF, 0xFE, 0x7C, 0x3F, 0xEB,
-    0xFF, 0x87, 0xF0, 0x0F, 0xF0, 0xBD, 0x00, 0xBE, 0x0F, 0xD0, 0x07, 0xE0, 0xBD, 0x00, 0xBE, 0x0B,
-    0xF4, 0x1F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x1B, 0xE4,
-    0x00, 0x00, 0x6A, 0xA9, 0x40, 0x02, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFD,
-    0x01, 0xFC, 0x3F, 0x7F, 0x40, 0x2F, 0x4F, 0x8F, 0xD0, 0x0B, 0xE3, 0xD3, 0xF4, 0x07, 0xF8, 0xB4,
-    0xFF, 0xFF, 0xFD, 0x0D, 0x3F, 0xFF, 0xFF, 0x01, 0x4F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0x94, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x06, 0xF4,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x01, 0xF8, 0x69, 0x00, 0x1F, 0xEF, 0xFC, 0x01,
-    0xFF, 0xFF, 0xF0, 0x1F, 0xFC, 0x1F, 0x41, 0xFF, 0x00, 0x7C, 0x1F, 0xF0, 0x03, 0xC1, 0xFF, 0x00,
-    0x3C, 0x1F, 0xF0, 0x03, 0xD1, 0xFF, 0x00, 0x3C, 0x1F, 0xF8, 0x0F, 0xC1, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x3F, 0x86, 0x90, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFA, 0xAA, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00,
-    0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x55, 0x55, 0x54, 0x0A, 0xAA, 0xAA, 0xAA, 0x93,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xFF, 0xFE, 0x0C, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0x40, 0x01,
-    0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xD0, 0x01, 0xF8, 0x00, 0x0B, 0xD0, 0x00, 0x2F, 0x40, 0x00,
-    0xBD, 0x00, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0xC6, 0xBF, 0xAA, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x00,
-    0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF,
-    0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBF, 0xC0, 0x07, 0xFF,
-    0x4B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x7F, 0x80,
-    0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00,
-    0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E,
-    0xFC, 0x00, 0xFF, 0xDB, 0xC0, 0x0F, 0xF8, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0, 0xBC, 0x00,
-    0xFD, 0x07, 0xD0, 0x0F, 0xD0, 0x7D, 0x00, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xE7, 0xFE, 0x03,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xEF, 0xE0, 0x3F, 0x40, 0x03, 0xF8, 0x00, 0x3F,
-    0x80, 0x01, 0xA8, 0x07, 0xC0, 0xF8, 0x1F, 0x43, 0xF0, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE,
-    0x00, 0x03, 0xFF, 0x80, 0x0F, 0xDB, 0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x2E, 0x1D, 0x7F,
-    0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x00, 0x00, 0x00, 0x0A, 0xBF, 0xFC, 0x1F, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x55, 0x50, 0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x84, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD3, 0xFF, 0xFF, 0x07, 0xFF, 0xF4, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x3F, 0x1F, 0xDB, 0xF6, 0xFE, 0x6A, 0x40, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F,
-    0x1F, 0xCB, 0xF6, 0xFD, 0x10, 0x0F, 0xC0, 0x70, 0x78, 0x28, 0x00, 0x2E, 0x2F, 0xEF, 0x7E, 0xFE,
-    0x2E, 0x00, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x07, 0xF4, 0x00, 0xFE, 0x00, 0xBF, 0x40, 0x1F, 0xE0,
-    0x0A, 0xA4, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x0F, 0xDB, 0xE0, 0x03, 0xFF,
-    0x80, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x01, 0xFD, 0x00, 0x3F, 0x80,
-    0x03, 0xF8, 0x00, 0xFF, 0x00, 0x06, 0xA0, 0x01, 0xA8, 0x00, 0x02, 0xFF, 0x07, 0xFC, 0x0F, 0xF0,
-    0x3F, 0xD0, 0xBF, 0x80, 0xFF, 0x03, 0xFD, 0x0F, 0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x2F,
-    0xE0, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xE0, 0x2F, 0xE0, 0x1F, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xF8, 0x07, 0xFC, 0x00, 0x00, 0x0A, 0x03, 0xDF, 0xF7, 0xFD, 0x0F, 0x43, 0xD0, 0x60,
-    0x3D, 0x0F, 0xF7, 0xFD, 0xF8, 0x2D, 0x00, 0xFE, 0xA9, 0x4F, 0xFF, 0xFC, 0x6A, 0xAF, 0xC0, 0x00,
-    0xBC, 0x00, 0x0B, 0xC0, 0x00, 0xBC, 0x0E, 0x03, 0xD0, 0xF4, 0xFC, 0x7E, 0x09, 0x00, 0x00, 0x2C,
-    0xBC, 0xF4, 0xBC, 0x2C, 0x00, 0x1F, 0x01, 0xF0, 0xFF, 0xDF, 0xFD, 0x55, 0x40, 0xFF, 0xDF, 0xFD,
-    0x6F, 0x41, 0xF0, 0x00, 0x00, 0x08, 0x03, 0x4B, 0xFC, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x1A, 0x43, 0xF8, 0x3F, 0x83, 0xFC, 0x7F, 0xC0,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7F, 0x1F, 0xCB, 0xF6, 0xFD, 0x2E, 0x2F, 0xEF, 0x7E, 0xFE, 0x2E,
-    0x00, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0x0A,
-    0x00, 0xE0, 0x2F, 0x83, 0xBE, 0x01, 0xE2, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xBC, 0x2F, 0x87, 0xE0,
-    0xBC, 0x0B, 0xFE, 0x3F, 0xE0, 0x6D, 0x2F, 0x4B, 0xD3, 0xF4, 0xFD, 0x3F, 0x4F, 0xD3, 0xF4, 0x7F,
-    0xFF, 0x9F, 0xFF, 0xE7, 0xFB, 0xF9, 0xF8, 0x7E, 0x7E, 0x1F, 0x80, 0x3F, 0x00, 0x2F, 0x43, 0xF8,
-    0x3F, 0x80, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xFF, 0xD0, 0x0F, 0xE1, 0xFD, 0x0F,
-    0xD0, 0x0B, 0xD0, 0x2F, 0x47, 0x9F, 0xF1, 0xEB, 0xFF, 0xBA, 0xE3, 0xFD, 0x78, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x7F, 0xFF, 0xE5, 0x54, 0x00, 0x1A, 0xAF, 0xF0, 0xFF, 0xFF,
-    0xD7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0x47, 0x9F, 0xF1, 0xEB, 0xFF, 0xBA, 0xE3, 0xFD, 0x78,
-    0x3E, 0x00, 0x00, 0x00, 0x15, 0x55, 0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x00, 0x0E, 0x03,
-    0xF0, 0x3C, 0x2F, 0x0F, 0xC3, 0xC0, 0x00, 0x50, 0x00, 0x0F, 0xD0, 0xFC, 0xFD, 0x0F, 0xCF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x5F, 0xFF, 0xD7, 0xD5, 0xF5,
-    0xF0, 0x3D, 0x7D, 0x5F, 0x5F, 0xFF, 0xD7, 0xFF, 0xF4, 0x0B, 0xAD, 0x0B, 0xFF, 0xC3, 0xCF, 0xB4,
-    0xE3, 0x9D, 0x38, 0xE7, 0x00, 0x00, 0x00, 0x08, 0x20, 0x2F, 0x40, 0x3C, 0x02, 0xF4, 0x2C, 0xB0,
-    0x2E, 0x1D, 0x7F, 0x9E, 0xB7, 0xDE, 0xF1, 0xFC, 0x60, 0x64, 0x00, 0xB4, 0xFC, 0x7E, 0xBC, 0x50,
-    0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0xF4, 0x00, 0x2F, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xF8, 0x7E, 0x1F,
-    0x8B, 0xF2, 0xFC, 0xFF, 0x3F, 0xC0, 0x7F, 0xFF, 0x9F, 0xFF, 0xE7, 0xFB, 0xF9, 0xF8, 0x7E, 0x7D,
-    0x1F, 0x80, 0x06, 0xAB, 0xFC, 0x1F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x2F, 0xFF, 0xFD, 0x3E, 0xAA, 0xA5, 0x00, 0x00, 0x2F, 0x07, 0xDB, 0xC1,
-    0xF6, 0xF0, 0xBD, 0xFC, 0x2F, 0x7F, 0x0B, 0xDF, 0xC3, 0xF4, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0x01, 0xFC, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x01, 0xF8, 0xFF, 0x0F, 0xFF, 0xBC,
-    0x7E, 0xFF, 0xF1, 0xF1, 0xFF, 0x87, 0xC7, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80,
-    0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6A, 0x40, 0x05, 0x50, 0x1F, 0xFF, 0xE0, 0x1F, 0xF0, 0xFF, 0xFF, 0xF4, 0x7F,
-    0xCB, 0xFC, 0x3F, 0xFF, 0xFE, 0x3F, 0xF0, 0x2F, 0xFF, 0xF0, 0x2A, 0x8F, 0x86, 0xF9, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E, 0xBD, 0x7E, 0x7E, 0xFD, 0x2F, 0xFD, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E, 0xFD, 0x7F, 0xFD, 0xBD, 0x1F, 0xFC, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x1F, 0x8F, 0xC0, 0x08, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x0B, 0x80, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0xC3, 0xE0, 0x00, 0x00, 0x0F, 0x43, 0xF4, 0x00, 0x06, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x6F, 0xFF, 0x90, 0x00, 0x00, 0x1A, 0xFE, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0xFE, 0x40,
-    0x02, 0xFE, 0x0F, 0x80, 0x00, 0x00, 0x7D, 0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x55, 0x55, 0x55, 0x56,
-    0xF9, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01,
-    0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0,
-    0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8,
-    0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0xBF, 0xFF, 0x90, 0x0B, 0xFF, 0xFF, 0x80,
-    0xBF, 0xAB, 0xFD, 0x0B, 0xF0, 0x07, 0xF0, 0xBF, 0x00, 0x3F, 0x0B, 0xF0, 0x03, 0xF0, 0xBF, 0x00,
-    0xBF, 0x0B, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xF4, 0xBF, 0x00, 0x7F, 0xCB,
-    0xF0, 0x01, 0xFD, 0xBF, 0x00, 0x1F, 0xEB, 0xFA, 0xAB, 0xFD, 0xBF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xBF, 0x00,
-    0x01, 0xFD, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x1F, 0xE0, 0x0F, 0xF0, 0x3F, 0xD0, 0x07, 0xF8, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0x80, 0x02, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0xBF, 0xFF, 0x4F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03,
-    0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC,
-    0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-    0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xEA, 0xA9, 0x0B, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC, 0x3F, 0x40, 0x03, 0xFC,
-    0x3F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0xC0, 0x03, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFD, 0xBF, 0xFF, 0xFF, 0xFD, 0xBF, 0xEA, 0xAB, 0xFD,
-    0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x01, 0x3F, 0xCB, 0xF2, 0xFF, 0xF6, 0xFC,
-    0xBF, 0x3F, 0xFF, 0x9F, 0xCB, 0xF6, 0xA5, 0x55, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00,
-    0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x5F, 0xD7, 0xF5, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4,
-    0xFD, 0x3F, 0x5F, 0xE7, 0xF9, 0xFE, 0xBF, 0xEF, 0xF0, 0x0F, 0xE0, 0x7F, 0xC0, 0x0F, 0xE0, 0xFF,
-    0x40, 0x0F, 0xD1, 0xFF, 0x00, 0x0F, 0xD3, 0xFC, 0x00, 0x0F, 0xCB, 0xF8, 0x00, 0x1F, 0xDF, 0xF0,
-    0x00, 0x1F, 0xEF, 0xD0, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0x7F, 0x9F, 0xFE, 0x00, 0x7F, 0x8B, 0xFF, 0x80, 0x7F, 0x83, 0xFF, 0xF0, 0xBF, 0x80, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0,
-    0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x02, 0xFE, 0x1F, 0xF0, 0x00, 0x3F, 0xD0, 0xFF, 0x40, 0x07, 0xFC,
-    0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFD, 0x01, 0xFE, 0x00, 0x1F, 0xF0,
-    0x2F, 0xD0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x07, 0xF4, 0x3F, 0x80, 0x00, 0x3F, 0x87, 0xF0, 0x00,
-    0x02, 0xFC, 0x3F, 0xE0, 0x00, 0x3F, 0xC3, 0xFF, 0x00, 0x0B, 0xFC, 0x3F, 0xF4, 0x00, 0xFF, 0xC3,
-    0xFF, 0x80, 0x1F, 0xFD, 0x3F, 0xFC, 0x03, 0xFF, 0xD3, 0xFF, 0xE0, 0x3F, 0xFD, 0x3F, 0xFF, 0x0B,
-    0xFF, 0xD7, 0xFF, 0xF4, 0xFF, 0xFD, 0x7F, 0xBF, 0x9F, 0xEF, 0xD7, 0xF7, 0xFF, 0xFD, 0xFE, 0x7F,
-    0x6F, 0xFF, 0xDF, 0xE7, 0xF5, 0xFF, 0xF9, 0xFE, 0x7F, 0x4F, 0xFF, 0x2F, 0xE7, 0xF8, 0xBF, 0xF2,
-    0xFE, 0xBF, 0x87, 0xFE, 0x3F, 0xEB, 0xF8, 0x3F, 0xD3, 0xFF, 0xBF, 0xC2, 0xFC, 0x3F, 0xFB, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x00, 0xFC, 0x1F, 0xF4, 0x01, 0xFC, 0x1F,
-    0xF8, 0x01, 0xFC, 0x2F, 0xFC, 0x01, 0xFC, 0x2F, 0xFE, 0x02, 0xFC, 0x2F, 0xFF, 0x02, 0xFC, 0x3F,
-    0xFF, 0x82, 0xFC, 0x3F, 0xEF, 0xC2, 0xFC, 0x3F, 0xCF, 0xE3, 0xF8, 0x3F, 0xCB, 0xF3, 0xF8, 0x3F,
-    0xD3, 0xF7, 0xF8, 0x3F, 0xD2, 0xFF, 0xF8, 0x7F, 0xD1, 0xFF, 0xF4, 0x7F, 0xD0, 0xFF, 0xF4, 0x7F,
-    0xD0, 0x7F, 0xF4, 0xBF, 0xD0, 0x3F, 0xF4, 0xBF, 0xE0, 0x2F, 0xF4, 0x3F, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
-    0x55, 0x55, 0x55, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40,
-    0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC,
-    0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5,
-    0x5F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0F, 0xEA, 0x00, 0x2A, 0x1A, 0xA9, 0x40, 0x0B, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0xD0, 0xFD,
-    0x01, 0xFC, 0x3F, 0x40, 0x2F, 0x4F, 0xD0, 0x0B, 0xE3, 0xF4, 0x07, 0xF8, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x01, 0xFF, 0x94, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-    0xE0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFA, 0xAA, 0x0F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x7D, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x55, 0x55, 0x54, 0x6A, 0xAA, 0xAA, 0xA9,
-    0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x7F, 0x41, 0xFD, 0x00, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF, 0x0B, 0xF4, 0x00, 0x2F, 0xD3,
-    0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x07, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xE7, 0xF2, 0xFF, 0xC0, 0xBF, 0xC1, 0xFC, 0x0F, 0xF8, 0x7F, 0xD0, 0x7F, 0x01, 0xFF,
-    0x6F, 0xF0, 0x1F, 0xC0, 0x3F, 0xEF, 0xF8, 0x07, 0xF0, 0x0F, 0xFB, 0xFE, 0x01, 0xF8, 0x02, 0xFF,
-    0xFF, 0xC0, 0x7E, 0x00, 0xFF, 0xAF, 0xF4, 0x1F, 0x80, 0xBF, 0xE7, 0xFF, 0xEB, 0xFA, 0xFF, 0xF4,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x03, 0xF8,
-    0x00, 0x3F, 0x40, 0x7F, 0x40, 0x3F, 0xC0, 0x0F, 0xF0, 0x1F, 0xD0, 0x01, 0xFF, 0x0F, 0xE0, 0x00,
-    0x2F, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xC0, 0x00, 0x7F, 0xDF, 0xFC, 0x00, 0x3F, 0xE1, 0xFF, 0x80, 0x3F, 0xF0, 0x3F, 0xF4, 0x2F, 0xF4,
-    0x03, 0xFF, 0x1F, 0xFC, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xC3, 0xFF, 0xC0,
-    0x1F, 0x0F, 0xBF, 0x00, 0x7C, 0x3E, 0xFC, 0x02, 0xF1, 0xFA, 0xF4, 0x0B, 0xC7, 0xDB, 0xE0, 0x2F,
-    0x3F, 0x5F, 0xC0, 0xBE, 0xFC, 0x3F, 0xD2, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0xA4, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xBF, 0xF0, 0x0F, 0xF0,
-    0x07, 0xF4, 0x2F, 0xC0, 0x01, 0xFC, 0x3F, 0x40, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0xBE, 0x7F, 0x00,
-    0x00, 0xBE, 0x7F, 0x00, 0x00, 0xBF, 0x7F, 0x00, 0x00, 0xBE, 0x3F, 0x00, 0x00, 0xFE, 0x3F, 0x80,
-    0x02, 0xFD, 0x2F, 0xD0, 0x0B, 0xFC, 0x1F, 0xFC, 0x3F, 0xF4, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xAA, 0xA8, 0x2A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE7, 0xD0, 0x00, 0xFF, 0xFF,
-    0x40, 0x0F, 0xEB, 0xFE, 0x00, 0x3D, 0x02, 0xF8, 0x02, 0xF0, 0x07, 0xF0, 0x0B, 0x80, 0x0F, 0xC0,
-    0x3D, 0x00, 0x3F, 0x00, 0xB8, 0x01, 0xFC, 0x02, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xD2, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x06, 0xFD, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x01, 0xFF, 0xBF, 0xC0, 0xFE, 0x01, 0xF8, 0x3F, 0x40, 0x3F, 0x0F,
-    0xD0, 0x1F, 0x83, 0xF6, 0xFF, 0xC0, 0xFD, 0xBF, 0xF0, 0x3F, 0x6F, 0xFF, 0x4F, 0xD0, 0x0B, 0xF3,
-    0xF8, 0x01, 0xFC, 0xFF, 0xF9, 0xFF, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xE3, 0xFB, 0xFF, 0xF0,
-    0xFD, 0x1B, 0xF4, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x82, 0xFC, 0x02, 0xF8, 0x0F, 0xD0, 0x2F, 0x80, 0xBF, 0x02, 0xF8, 0x03,
-    0xF4, 0x2F, 0x80, 0x2F, 0xC3, 0xF4, 0x01, 0xFD, 0x3F, 0x40, 0x0F, 0xFB, 0xF0, 0x00, 0x7F, 0xFE,
-    0x00, 0x03, 0xFF, 0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x1F, 0xF0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x06, 0x50, 0x00, 0x07, 0xFF, 0xE4, 0x0F, 0xFF, 0xFF, 0x07, 0xFA, 0xFF, 0xC1, 0xFC, 0x01,
-    0x60, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF0, 0x0B, 0xFF, 0xFF, 0x07, 0xFE, 0x6F, 0xE2, 0xFD, 0x02, 0xFC, 0xFF, 0x00, 0x7F, 0x3F, 0xC0,
-    0x1F, 0xCB, 0xF8, 0x1F, 0xF1, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFC, 0x02, 0xFF, 0xFC, 0x00, 0x0A,
-    0xE4, 0x00, 0x01, 0x40, 0x02, 0xFF, 0x80, 0x38, 0x2C, 0x07, 0x40, 0x40, 0x3E, 0x80, 0x02, 0xFC,
-    0x00, 0x7D, 0x05, 0x0B, 0x82, 0xF0, 0xBC, 0x2F, 0x03, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x14, 0x00,
-    0x06, 0xAA, 0xA4, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0x80, 0x02, 0xFD, 0x00, 0x07,
-    0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F,
-    0xF9, 0xFE, 0x40, 0x6F, 0xFF, 0xFD, 0x00, 0xFF, 0xEF, 0xF0, 0x0F, 0xE0, 0x2F, 0x40, 0xFC, 0x01,
-    0xF4, 0x1F, 0xC0, 0x1F, 0x81, 0xFC, 0x01, 0xF8, 0x1F, 0xC0, 0x1F, 0x81, 0xFC, 0x01, 0xFC, 0x1F,
-    0xC0, 0x2F, 0xC2, 0xFC, 0x02, 0xFC, 0x2F, 0xD0, 0x2F, 0xC2, 0xFD, 0x02, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2A, 0x80, 0x01,
-    0xFF, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x82, 0xF4, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0xBC, 0xBD, 0x00,
-    0x7D, 0xBF, 0xAA, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0xBE, 0xBF, 0x00, 0xFE,
-    0xBF, 0x82, 0xFD, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF4, 0x0B, 0xFF, 0xE0, 0x01,
-    0xBE, 0x40, 0x29, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0, 0x3F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x07, 0xF0, 0x1F, 0xD0, 0x7F, 0xF6, 0xFF, 0xEB, 0xFF, 0x40, 0x1F, 0x0F, 0xC0,
-    0xBC, 0xBC, 0x02, 0xE7, 0xE0, 0x0F, 0xBF, 0x00, 0x3F, 0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00,
-    0x0F, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xF7, 0xFC, 0x0B, 0xC7, 0xFC, 0x2F, 0x0B, 0xFC, 0x1A, 0x50,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xEF, 0xD0, 0x03, 0xFC, 0xBE, 0x00, 0x7F, 0x43, 0xF0, 0x0F,
-    0xF0, 0x3F, 0x41, 0xFD, 0x02, 0xF8, 0x3F, 0x80, 0x1F, 0xC7, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x3F,
-    0x0F, 0xC0, 0x0F, 0xD7, 0xF0, 0x03, 0xF5, 0xFC, 0x00, 0xFD, 0x7F, 0x00, 0x3F, 0x5F, 0xD0, 0x0F,
-    0xD7, 0xF4, 0x03, 0xF5, 0xFF, 0x01, 0xFD, 0xBF, 0xF9, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF,
-    0xFA, 0xF7, 0xFE, 0xFE, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x2F, 0x82, 0xFC, 0x02, 0xF8, 0x0F, 0xD0, 0x2F, 0x80, 0xBF, 0x02, 0xF8, 0x03, 0xF4, 0x2F, 0x80,
-    0x2F, 0xC3, 0xF8, 0x01, 0xFD, 0x3F, 0x40, 0x0F, 0xFB, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x3F, 0xFC, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x1A, 0xA0, 0x00, 0x6A, 0xAA, 0x4F, 0xFF,
-    0xF8, 0xFF, 0xFF, 0x80, 0xBF, 0xD0, 0x1F, 0xFE, 0x02, 0xFF, 0xE0, 0x2F, 0xFF, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFF, 0x00, 0xFE, 0x40, 0x1F, 0x80, 0x01, 0xFE, 0x40, 0x0F, 0xFF, 0x40, 0x3F, 0xFC, 0x00,
-    0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E,
-    0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01,
-    0xBE, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xBF, 0xE8, 0x3F, 0x0B, 0xD0, 0x0F,
-    0xC2, 0xF4, 0x03, 0xF0, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x0F, 0xC0, 0x1F, 0xC3, 0xF0, 0x07,
-    0xE1, 0xFF, 0xC1, 0xF8, 0x3F, 0xF0, 0x55, 0x06, 0xA4, 0x00, 0x00, 0x50, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0x81, 0xF0, 0x01, 0xFC, 0x02, 0xE0, 0x0F, 0xE0, 0x07, 0xC0,
-    0x3F, 0x80, 0x1F, 0x00, 0xFE, 0x00, 0x7C, 0x07, 0xFC, 0x01, 0xF0, 0x2F, 0xFD, 0x6F, 0xC0, 0xBF,
-    0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0x4A, 0x90, 0x01, 0xFD, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0xFF, 0xFD, 0x07, 0xF5, 0xFC, 0x3F, 0x00, 0x50, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0x40, 0x00, 0xFD,
-    0x00, 0x03, 0xF4, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xEB, 0xFD, 0x57, 0xF0, 0x0F, 0xD0, 0xBD, 0x00, 0xBE, 0x0F, 0xD0, 0x07, 0xE0, 0xBD, 0x00,
-    0xBE, 0x0B, 0xF4, 0x1F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00,
-    0x1B, 0xE4, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xAA, 0xFF, 0xA9, 0x00, 0xBE, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x6A, 0x40, 0xFC, 0x2F, 0x43, 0xF0, 0x3F, 0x0F, 0xC0, 0xBD, 0x2F,
-    0x01, 0xF8, 0xBC, 0x03, 0xE2, 0xF0, 0x0F, 0xCB, 0xD0, 0x3F, 0x1F, 0x40, 0xFC, 0x7F, 0x5B, 0xF0,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x07, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x6F, 0x2F, 0xE0, 0x2F,
-    0xD2, 0xF0, 0xFF, 0x03, 0xFC, 0x2F, 0x03, 0xF8, 0x7F, 0x42, 0xF0, 0x3F, 0xCB, 0xF0, 0x2F, 0x02,
-    0xFC, 0xBF, 0x02, 0xF0, 0x1F, 0xCB, 0xF0, 0x2F, 0x01, 0xFC, 0xBF, 0x02, 0xF0, 0x2F, 0xCB, 0xF8,
-    0x2F, 0x03, 0xFC, 0x7F, 0xE7, 0xF1, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x01, 0xFF, 0x80,
-    0x3F, 0x40, 0x7F, 0xF8, 0x1F, 0xC0, 0x0B, 0xFF, 0x4F, 0xD0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00,
-    0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xDF, 0xF0,
-    0x00, 0x3F, 0xD3, 0xFF, 0xF0, 0x3F, 0xF0, 0x7F, 0xFC, 0x1F, 0xF0, 0x0B, 0xFF, 0x0F, 0xF8, 0x00,
-    0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xF0, 0x00, 0xFC, 0xF7, 0xE0, 0xFC, 0xB5, 0xF4, 0xFC, 0xB4, 0xF8, 0xBC, 0xB4, 0xBC, 0xBC, 0xB8,
-    0xBC, 0xBC, 0x78, 0x7D, 0xBD, 0x78, 0x7D, 0x7E, 0x78, 0x7D, 0x7F, 0xBE, 0xFD, 0x3F, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0xFD, 0x00, 0xBF, 0x00, 0x1F, 0x80, 0x3F, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0x40, 0xBD,
-    0x0B, 0xE0, 0xF4, 0x1F, 0x43, 0xF4, 0x3D, 0x07, 0xD0, 0xFD, 0x0F, 0x42, 0xF4, 0x2F, 0x87, 0xE1,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x07, 0xF9, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F,
-    0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40,
-    0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3,
-    0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01,
-    0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01,
-    0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x3D, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF,
-    0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC,
-    0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xCB, 0xE0,
-    0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0,
-    0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0xB8, 0xF8, 0x00, 0x7F, 0xA8, 0x00,
-    0x7F, 0xF0, 0x00, 0x7F, 0xBF, 0x00, 0x7E, 0x03, 0xF0, 0x14, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xE7, 0xD0, 0x0F, 0xFF, 0xF4, 0x0F, 0xEB, 0xFE, 0x03, 0xD0, 0x2F, 0x82,
-    0xF0, 0x07, 0xF0, 0xB8, 0x00, 0xFC, 0x3D, 0x00, 0x3F, 0x0B, 0x80, 0x1F, 0xC2, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0x40, 0x6F, 0xD7, 0xE0, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0B, 0xC0, 0x00, 0x00, 0x6A, 0x1F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00,
-    0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00,
-    0x0B, 0xF0, 0x7F, 0x00, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x03, 0xFC, 0x00, 0x03,
-    0xFD, 0x2A, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0x40, 0x00, 0x0F, 0xFF, 0xF4,
-    0x00, 0x03, 0xFA, 0xFF, 0x80, 0x00, 0x3D, 0x02, 0xF8, 0x00, 0x0B, 0xC0, 0x1F, 0xC0, 0x00, 0xB8,
-    0x00, 0xFC, 0x00, 0x0F, 0x40, 0x0F, 0xC0, 0x00, 0xB8, 0x01, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x07,
-    0xD0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00,
-    0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x03,
-    0xD1, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xD7, 0xF0, 0x03, 0xE0, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0xAF,
-    0xF8, 0x03, 0xD0, 0x2F, 0x80, 0xBC, 0x01, 0xFC, 0x0B, 0x80, 0x0F, 0xC0, 0xF4, 0x00, 0xFC, 0x0B,
-    0x80, 0x1F, 0xC0, 0xBF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x6F, 0xD7,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x1F, 0xF3, 0xC0, 0x00, 0x01,
-    0xDB, 0xF8, 0x00, 0x00, 0x1E, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x02, 0xFA, 0xFC, 0x00, 0x00, 0xBD,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xE0, 0x0B, 0xFD,
-    0xE0, 0x0B, 0x6F, 0xD0, 0x0B, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xDB, 0xF0, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02,
-    0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00,
-    0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD,
-    0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xCB, 0xE0, 0x00, 0x07, 0xD0, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF0, 0x1F,
-    0x40, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF,
-    0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC,
-    0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE,
-    0x00, 0x01, 0xFE, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8,
-    0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0,
-    0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8,
-    0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00,
-    0x0F, 0xD0, 0x3F, 0x40, 0x01, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F,
-    0xD0, 0x00, 0x7F, 0xC3, 0xFC, 0x00, 0x03, 0xFD, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02,
-    0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x03,
-    0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xE0,
-    0x00, 0x0B, 0xF0, 0x7F, 0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x1F, 0xE0, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x41, 0xF4, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC,
-    0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F,
-    0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x0B, 0xC3, 0x80, 0x00, 0x00, 0xFF, 0x3C, 0x00, 0x00, 0x1E,
-    0xF7, 0xC0, 0x00, 0x02, 0xD7, 0xF8, 0x00, 0x00, 0x1E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x07, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
-    0x1F, 0x9F, 0x80, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x7F,
-    0x00, 0x00, 0xFD, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x7F,
-    0x83, 0xFD, 0x00, 0x07, 0xFC, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xE0,
-    0x0B, 0xFD, 0xE0, 0x0F, 0x7F, 0xD0, 0x0B, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x3F, 0xAF, 0xF8, 0x3D, 0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8,
-    0x01, 0xFC, 0xBF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x3F, 0x4F,
-    0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x00, 0xBF, 0x07, 0xF0, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x01,
-    0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x3F, 0xD0, 0x00, 0x7F, 0xC3, 0xFC,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x41, 0xF8, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xE0, 0x02, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0xF4, 0x0F, 0xFF, 0xF4, 0x3F, 0xAF, 0xF8, 0x3D,
-    0x02, 0xF8, 0xBC, 0x01, 0xFC, 0xB8, 0x00, 0xFC, 0xF4, 0x00, 0xFC, 0xB8, 0x01, 0xFC, 0xBF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFD, 0x06, 0xFD, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFE, 0x00, 0x01, 0xFE, 0x00, 0x01,
-    0xA9, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8,
-    0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F,
-    0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x80,
-    0x00, 0xBF, 0x80, 0x00, 0x6A, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x06, 0xE0, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC,
-    0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0xE0, 0x00, 0x3D, 0x00, 0x00, 0x1B,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F,
-    0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x2C, 0x00, 0x3F, 0xDB, 0x00, 0x0F, 0x7F, 0xC0, 0x03, 0xC7, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xD3, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xF8, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0x01, 0xFE, 0x40, 0x00, 0x7F, 0x40,
-    0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFA, 0xAA, 0x92, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF,
-    0xFF, 0xDB, 0xFF, 0xFF, 0xF8, 0x02, 0xE0, 0xE0, 0x07, 0xFC, 0xE0, 0x0B, 0x7F, 0xE0, 0x0B, 0x4F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F,
-    0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF,
-    0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0xFF, 0xE0, 0x2E, 0x03, 0xFA, 0xF8, 0x3D, 0x0F, 0xC0, 0x7E, 0xBC, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x7F,
-    0x90, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x00, 0xBF,
-    0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0x80, 0x00,
-    0x2E, 0x00, 0x04, 0x00, 0x7F, 0x40, 0x3D, 0x01, 0xFF, 0xC0, 0x7C, 0x07, 0xF7, 0xF4, 0xF8, 0x1F,
-    0x80, 0xBE, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F,
-    0x81, 0xF8, 0x00, 0x3F, 0x55, 0xBC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x03, 0xC0, 0x00, 0x06, 0xA4, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F,
-    0xEB, 0xE0, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x01,
-    0xFE, 0xAA, 0xA4, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x07, 0xF8, 0x2E,
-    0x00, 0x00, 0x6A, 0x7F, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x1F, 0x80,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x2F, 0x81,
-    0xF8, 0x00, 0x3F, 0x55, 0xBC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0xF0, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFA, 0xF8, 0x00, 0xFC, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAB, 0xFF, 0xF4, 0x3F,
-    0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xF9,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xAA, 0xA9, 0x0B, 0xFF, 0xFF, 0xF0,
-    0xBF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x40, 0x03, 0xD1, 0xD0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xD7, 0xF0, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0xBF, 0xFE, 0x00, 0x2F, 0x81, 0xF8, 0x03, 0xF5, 0x5B, 0xC0, 0x7F, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF,
-    0xD0, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x7F, 0xEA, 0xAD, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x2C, 0x00, 0x3F, 0xDB, 0x00,
-    0x0F, 0x7F, 0xC0, 0x03, 0xC7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0xBF, 0xF4, 0x00, 0xBE, 0x7F, 0x40, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0A, 0xAF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0x01, 0xFE, 0x40, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFA, 0xAA, 0x92, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xF8, 0x02, 0xE1, 0xD0, 0x07, 0xF9,
-    0xE0, 0x0B, 0x7F, 0xD0, 0x0F, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F, 0x81,
-    0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x0F, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xEB, 0xE0, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0,
-    0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xF9, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00,
-    0x1F, 0xEA, 0xAA, 0x4B, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7F,
-    0x40, 0x01, 0xFF, 0xC0, 0x07, 0xF7, 0xF4, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0B, 0xFF, 0xE0, 0x2F,
-    0x81, 0xF8, 0x3F, 0x55, 0xBC, 0x7F, 0xFF, 0xFD, 0xBF, 0xFF, 0xFD, 0xFD, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x7F, 0xEA, 0xAD, 0x3F, 0xFF, 0xFD, 0x0F, 0xFF, 0xFD, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x40, 0x00,
-    0x7F, 0x80, 0x00, 0xBF, 0x80, 0x00, 0x6A, 0x40, 0x1E, 0x06, 0xE0, 0x34, 0x38, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xD7, 0xF5, 0xFD, 0x7F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF4,
-    0xFD, 0x3F, 0x4F, 0xD7, 0xF9, 0xFE, 0x7F, 0xAF, 0xFB, 0xFC, 0x3D, 0x0A, 0xC0, 0xB0, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x7D, 0x1F, 0x47, 0xD1, 0xF4, 0x7D, 0x2F, 0x4B, 0xD2, 0xF4, 0xBE, 0x3F,
-    0x8F, 0xF0, 0x7F, 0x5F, 0xD7, 0xF5, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x3F, 0x0F, 0xD3, 0xF4,
-    0xFD, 0x3F, 0x5F, 0xE7, 0xF9, 0xFE, 0xBF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xFD,
-    0x7F, 0xAF, 0xE6, 0xA4, 0x2F, 0x83, 0xF8, 0x3F, 0xC3, 0xFC, 0x2A, 0x80, 0x00, 0x00, 0x01, 0xA0,
-    0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x83, 0xF8, 0x3F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0xC3, 0xFC, 0x3F, 0xC2, 0xA8, 0x00, 0x1B,
-    0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0,
-    0x2F, 0xD0, 0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00,
-    0x02, 0xFC, 0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB,
-    0xF8, 0x00, 0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x01, 0xBE, 0x40, 0x0F,
-    0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00,
-    0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00,
-    0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0,
-    0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF,
-    0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xC0,
-    0x7C, 0x00, 0x2F, 0x9F, 0xC3, 0xE0, 0x02, 0xF0, 0x0B, 0xEF, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x2F, 0xD0, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x01, 0xFE,
-    0x07, 0xF4, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC2, 0xFC,
-    0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xF5, 0x06,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF4, 0x00, 0xF8, 0x07, 0xC0, 0x0B, 0xF4, 0x3E, 0x00, 0xBF, 0xF5, 0xF4, 0x0B, 0xE7,
-    0xF9, 0x40, 0xBD, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40,
-    0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0x80, 0x1F, 0xC0, 0x3F, 0x40, 0xBD, 0x00, 0xBE, 0x03,
-    0xF4, 0x01, 0xF8, 0x0B, 0xD0, 0x0B, 0xE0, 0x2F, 0xD0, 0x7F, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x3D, 0x00, 0x00, 0x01, 0xA9, 0x2F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x2F,
-    0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x02, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0x0B, 0xF0,
-    0x00, 0x02, 0xFC, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xF5, 0x06, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x0B, 0xE7, 0xF4, 0x00,
-    0x0B, 0xD0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x40,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x01, 0xFC, 0x03, 0xF4, 0x00, 0xBD, 0x00,
-    0xBE, 0x00, 0x3F, 0x40, 0x1F, 0x80, 0x0B, 0xD0, 0x0B, 0xE0, 0x02, 0xFD, 0x07, 0xF4, 0x00, 0x7F,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0B,
-    0xD0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00,
-    0x03, 0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF8,
-    0x00, 0x3C, 0x1D, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0xBE, 0xBE, 0x00, 0x3F, 0x41,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x0F, 0xFF, 0xF0, 0x03,
-    0xFE, 0xBF, 0x80, 0x7F, 0x00, 0xFD, 0x0B, 0xD0, 0x0B, 0xE0, 0xFD, 0x00, 0x7E, 0x0B, 0xD0, 0x0B,
-    0xE0, 0xBF, 0x41, 0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x01,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x74, 0x00, 0x00, 0x2F, 0xE7, 0x40,
-    0x00, 0x03, 0xCF, 0xF4, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x03, 0xF7, 0xF4, 0x00,
-    0x00, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x43,
-    0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00,
-    0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03, 0xFC, 0x7F,
-    0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xE1, 0xD0, 0x07, 0xF8, 0xE0, 0x0B, 0x7D, 0xE0, 0x0F, 0x2F, 0xD0, 0x0B, 0x4B, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x0F, 0xDB, 0xE0, 0x3F, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD,
-    0x00, 0xBE, 0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF,
-    0xF8, 0x0F, 0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x2F, 0x9F, 0xC0, 0x00, 0x0B, 0xC0,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x2F, 0xD0, 0x00,
-    0xFF, 0x43, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0x40, 0x00, 0x3F, 0xCB, 0xF0, 0x00, 0x02, 0xFC, 0xBF,
-    0x00, 0x00, 0x1F, 0xCB, 0xF0, 0x00, 0x01, 0xFC, 0xBF, 0x00, 0x00, 0x2F, 0xCB, 0xF8, 0x00, 0x03,
-    0xFC, 0x7F, 0xF5, 0x06, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0xBF, 0x40, 0x02, 0xFF, 0xD0, 0x0B, 0xE7, 0xF4, 0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBE, 0x40, 0x0F, 0xFF, 0xF0, 0x3F, 0xEB, 0xF8, 0x7F, 0x00, 0xFD, 0xBD, 0x00, 0xBE,
-    0xFD, 0x00, 0x7E, 0xBD, 0x00, 0xBE, 0xBF, 0x41, 0xFD, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xF8, 0x0F,
-    0xFF, 0xF0, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xA9, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x06, 0xFF, 0x80, 0x3C, 0x00, 0xFF, 0xFF, 0xE2, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0x80, 0x7F, 0xF8, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x7F, 0x81, 0xFD, 0x00,
-    0x00, 0xFF, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x1F,
-    0xC2, 0xFC, 0x00, 0x00, 0xBF, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x1F, 0xFD, 0x41, 0xBF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x00, 0x03, 0xC0, 0x1B, 0xE4, 0x3C, 0x0F, 0xFF, 0xE7, 0xC3, 0xFE, 0xBF, 0xF8, 0x7F,
-    0x00, 0xFF, 0x0B, 0xD0, 0x0B, 0xE0, 0xFD, 0x00, 0x7E, 0x0B, 0xD0, 0x0B, 0xE0, 0xBF, 0x41, 0xFD,
-    0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x1A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x06, 0xFF, 0x80, 0x3C, 0x00, 0xFF, 0xFF, 0xE2, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-    0x80, 0x7F, 0xF8, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x7F, 0x81, 0xFD, 0x00, 0x00,
-    0xFF, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC2,
-    0xFC, 0x00, 0x00, 0xBF, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x1F, 0xFD, 0x41, 0xBF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x03, 0xC0, 0x1B, 0xE4, 0x3C, 0x0F, 0xFF, 0xE7, 0xC3, 0xFE, 0xBF, 0xF8, 0x7F, 0x00,
-    0xFF, 0x0B, 0xD0, 0x0B, 0xE0, 0xFD, 0x00, 0x7E, 0x0B, 0xD0, 0x0B, 0xE0, 0xBF, 0x41, 0xFD, 0x07,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x1B, 0xFE, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0x8B, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFE, 0x01, 0xFF, 0xE0, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE,
-    0x07, 0xF4, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC2, 0xFC,
-    0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xF5, 0x06,
-    0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xBE, 0x43, 0xC0, 0xFF,
-    0xFE, 0x7C, 0x3F, 0xEB, 0xFF, 0x87, 0xF0, 0x0F, 0xF0, 0xBD, 0x00, 0xBE, 0x0F, 0xD0, 0x07, 0xE0,
-    0xBD, 0x00, 0xBE, 0x0B, 0xF4, 0x1F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-    0xF0, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0F, 0x00, 0x00, 0x01,
-    0xFF, 0x7C, 0x00, 0x00, 0x0B, 0x6F, 0xE0, 0x00, 0x00, 0x1E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x1B, 0xFE, 0x00, 0xF0,
-    0x03, 0xFF, 0xFF, 0x8B, 0xC0, 0x7F, 0xFF, 0xFF, 0xFE, 0x03, 0xFE, 0x01, 0xFF, 0xE0, 0x2F, 0xD0,
-    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x07, 0xF4, 0x00, 0x03, 0xFC, 0x2F, 0xC0, 0x00, 0x0B,
-    0xF0, 0xBF, 0x00, 0x00, 0x1F, 0xC2, 0xFC, 0x00, 0x00, 0x7F, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x2F,
-    0xE0, 0x00, 0x0F, 0xF0, 0x7F, 0xF5, 0x06, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x0B, 0xF9, 0xE0,
-    0x00, 0xB7, 0xFD, 0x00, 0x0B, 0x4F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x03, 0xC0, 0x1B, 0xE4, 0x3C, 0x0F, 0xFF, 0xE7, 0xC3, 0xFE, 0xBF, 0xF8,
-    0x7F, 0x00, 0xFF, 0x0B, 0xD0, 0x0B, 0xE0, 0xFD, 0x00, 0x7E, 0x0B, 0xD0, 0x0B, 0xE0, 0xBF, 0x41,
-    0xFD, 0x07, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0xBE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xBF, 0xE0, 0x0F, 0x00, 0x3F,
-    0xFF, 0xF8, 0xBC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xE0, 0x1F, 0xFE, 0x02, 0xFD, 0x00, 0x0F,
-    0xF0, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x7F, 0x40, 0x00, 0x3F, 0xC2, 0xFC, 0x00, 0x00, 0xBF, 0x0B,
-    0xF0, 0x00, 0x01, 0xFC, 0x2F, 0xC0, 0x00, 0x07, 0xF0, 0xBF, 0x00, 0x00, 0x2F, 0xC2, 0xFE, 0x00,
-    0x00, 0xFF, 0x07, 0xFF, 0x50, 0x6F, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xBE, 0x43, 0xC0, 0xFF, 0xFE, 0x7C, 0x3F, 0xEB, 0xFF,
-    0x87, 0xF0, 0x0F, 0xF0, 0xBD, 0x00, 0xBE, 0x0F, 0xD0, 0x07, 0xE0, 0xBD, 0x00, 0xBE, 0x0B, 0xF4,
-    0x1F, 0xD0, 0x7F, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x00, 0x1B, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC,
-    0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC,
-    0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC,
-    0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1A, 0x90, 0x00, 0xFC, 0x00, 0xFC, 0xBC,
-    0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00,
-    0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x01,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0, 0x07, 0xFC, 0xBF, 0xC0,
-    0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80, 0x07, 0xFC, 0x7F, 0x80,
-    0x07, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80, 0x03, 0xF8, 0x7F, 0x80,
-    0x07, 0xF8, 0x3F, 0xC0, 0x0B, 0xF8, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0xBC, 0x00, 0xFD, 0xBC, 0x00, 0xFD, 0xBC,
-    0x00, 0xFD, 0xBC, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7D, 0x00, 0xFD, 0x7F, 0x01, 0xFD, 0x3F, 0xE7,
-    0xFE, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x07, 0xFE, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBF, 0xC0,
-    0x07, 0xFF, 0x4B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00,
-    0x7F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07,
-    0xF8, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x54, 0x03, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x0F, 0xFD,
-    0xBC, 0x00, 0xFF, 0x8B, 0xC0, 0x0F, 0xD0, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0, 0x7D, 0x00,
-    0xFD, 0x07, 0xD0, 0x0F, 0xD0, 0x7F, 0x01, 0xFD, 0x03, 0xFE, 0x7F, 0xE0, 0x3F, 0xFF, 0xFE, 0x01,
-    0xFF, 0xFF, 0xE0, 0x07, 0xFE, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBF, 0xC0, 0x07, 0xFF, 0x4B,
-    0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07,
-    0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F,
-    0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x7F,
-    0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0xEF, 0xC0, 0x0F, 0xFD, 0xBC, 0x00, 0xFF,
-    0x8B, 0xC0, 0x0F, 0xD0, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0, 0x7D, 0x00, 0xFD, 0x07, 0xD0,
-    0x0F, 0xD0, 0x7F, 0x01, 0xFD, 0x03, 0xFE, 0x7F, 0xE0, 0x3F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFE, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xCB, 0xFC, 0x00, 0x7F,
-    0xF4, 0xBF, 0xC0, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0, 0x07, 0xFC, 0x07, 0xF8,
-    0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC,
-    0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80,
-    0x07, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0xFC, 0x00,
-    0xFF, 0xDB, 0xC0, 0x0F, 0xF8, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0, 0xBC, 0x00, 0xFD, 0x07,
-    0xD0, 0x0F, 0xD0, 0x7D, 0x00, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xE7, 0xFE, 0x03, 0xFF, 0xFF,
-    0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x3E, 0x1C, 0x00, 0x00, 0x0B, 0xF9, 0xD0,
-    0x00, 0x00, 0xF3, 0xFD, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xCB, 0xFC, 0x00, 0x7F, 0xF4, 0xBF, 0xC0, 0x07, 0xFE, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0xBF, 0xC0,
-    0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x03, 0xF8, 0x07, 0xF8, 0x00,
-    0x3F, 0x80, 0x7F, 0x80, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x3F, 0xFF, 0xFF, 0xF4, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xD0, 0x00, 0x7F, 0x8E, 0x00, 0x0B, 0x7D, 0xE0,
-    0x00, 0xF6, 0xFD, 0x00, 0x0B, 0x4B, 0x81, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x3E, 0xFC, 0x00, 0xFF, 0xDB, 0xC0, 0x0F, 0xF8, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0,
-    0xBC, 0x00, 0xFD, 0x07, 0xD0, 0x0F, 0xD0, 0x7D, 0x00, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xE7,
-    0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0xBF, 0xC0,
-    0x07, 0xFF, 0x4B, 0xFC, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F, 0xC0,
-    0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x7F, 0x80, 0x07, 0xFC, 0x07, 0xF8, 0x00,
-    0x7F, 0xC0, 0x7F, 0x80, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x80, 0x03, 0xF8, 0x07,
-    0xF8, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0B, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3E, 0xFC, 0x00, 0xFF, 0xDB, 0xC0, 0x0F,
-    0xF8, 0xBC, 0x00, 0xFD, 0x0B, 0xC0, 0x0F, 0xD0, 0xBC, 0x00, 0xFD, 0x07, 0xD0, 0x0F, 0xD0, 0x7D,
-    0x00, 0xFD, 0x07, 0xF0, 0x1F, 0xD0, 0x3F, 0xE7, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE,
-    0x00, 0x7F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x3F, 0xC3, 0xFC, 0x00, 0x1F, 0xD0, 0x7F, 0x40, 0x0F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF4, 0x02, 0xFD,
-    0x03, 0xFC, 0x00, 0x3F, 0xC2, 0xFD, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0x80, 0x00,
-    0x2F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x06, 0x90, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x3F, 0x40, 0x2F,
-    0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03, 0xF8, 0xFD, 0x00, 0x2F,
-    0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF, 0xF8, 0x00, 0x2F, 0xFF,
-    0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0xFF, 0x0F, 0xF0, 0x00,
-    0x7F, 0x41, 0xFD, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x2F, 0xD0, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0xFF,
-    0x0B, 0xF4, 0x00, 0x2F, 0xD3, 0xFC, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00,
-    0x00, 0x0A, 0xA0, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0xBE, 0x02, 0xFC, 0x03, 0xF4,
-    0x03, 0xF4, 0x0F, 0xC0, 0x0B, 0xF0, 0x7E, 0x00, 0x0F, 0xE3, 0xF4, 0x00, 0x2F, 0xDF, 0xC0, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xAF, 0xF8, 0x00, 0x0B, 0xFF, 0xC0,
-    0xA8, 0x2F, 0xFD, 0x07, 0xF0, 0xBF, 0x80, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFE,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0, 0xFF,
-    0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0xFF, 0x00,
-    0x0F, 0xF0, 0xBF, 0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0B, 0xFF, 0xF0,
-    0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0xFC, 0x3F, 0x40, 0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03,
-    0xF8, 0xFD, 0x00, 0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF,
-    0xF8, 0x00, 0x2F, 0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x2E, 0x0D,
-    0x00, 0x00, 0x1F, 0xF3, 0x80, 0x00, 0x0B, 0x7F, 0xE0, 0x00, 0x02, 0xD3, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x07, 0xF4,
-    0x1F, 0xD0, 0x03, 0xFC, 0x03, 0xFC, 0x02, 0xFD, 0x00, 0xBF, 0x40, 0xFF, 0x00, 0x0F, 0xF0, 0xBF,
-    0x40, 0x02, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xEF, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00,
-    0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xC0, 0x01, 0xFF, 0x78, 0x00, 0x2D,
-    0xBF, 0x80, 0x02, 0xD2, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0xFC, 0x3F, 0x40,
-    0x2F, 0x82, 0xFC, 0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x00, 0xBF, 0x07, 0xE0, 0x03, 0xF8, 0xFD, 0x00,
-    0x2F, 0xDF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x01, 0xAF, 0xF8, 0x00, 0x2F,
-    0xFF, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x15, 0x55, 0x56, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xC0, 0x15, 0x55, 0x56, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x15, 0x55, 0x55, 0x55,
-    0x4F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03,
-    0xE3, 0xD0, 0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x3D, 0x3D, 0x03, 0xD3, 0xD0, 0x3D, 0x7D, 0x03, 0xD7,
-    0xD0, 0x7D, 0x7D, 0x07, 0xD7, 0xC0, 0x7D, 0x7C, 0x07, 0xC7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7, 0xC0,
-    0x7C, 0x7C, 0x07, 0xC0, 0x55, 0x55, 0x55, 0x55, 0x4B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xC5, 0x55, 0x55, 0x55, 0x54, 0x00, 0x02, 0xFF, 0x47, 0xFD, 0x0F, 0xF0, 0x2F,
-    0xD0, 0x7F, 0xC0, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xE1, 0xFF, 0x47, 0xFC, 0x1F, 0xE0, 0xFF,
-    0x43, 0xFC, 0x2F, 0xF0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F, 0xD0, 0xFF, 0x07, 0xFC,
-    0x3F, 0xE0, 0x00, 0x02, 0xFF, 0x47, 0xFD, 0x0F, 0xF0, 0x2F, 0xD0, 0x7F, 0xC0, 0xFF, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0B, 0xFD, 0x3F, 0xF0, 0x7F, 0xD1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0,
-    0xFF, 0x41, 0xFF, 0x0B, 0xF8, 0x0F, 0xF0, 0x7F, 0xC0, 0xFF, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x8B, 0xFD, 0x1F, 0xF4, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x1F, 0xE0, 0xBF, 0x83, 0xFD, 0x0F,
-    0xF0, 0x3F, 0xC1, 0xFF, 0x0B, 0xFC, 0x2F, 0xE0, 0x00, 0x00, 0xBF, 0xD2, 0xFF, 0x07, 0xFC, 0x2F,
-    0xD0, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x2F, 0xF0, 0x7F, 0xD1, 0xFF,
-    0x03, 0xFC, 0x0F, 0xF0, 0x2F, 0xD0, 0xFF, 0x41, 0xFF, 0x0B, 0xF8, 0x0F, 0xF0, 0x7F, 0xC0, 0xFF,
-    0x83, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x07,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x0B, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x0A, 0xBF, 0xBD, 0x07, 0xFF, 0xFF, 0x83, 0xFF,
-    0xFF, 0xF0, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x1F, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF,
-    0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xE0, 0x0B, 0xF4, 0x2F, 0xFC, 0xBF, 0xF2,
-    0xFE, 0x07, 0x80, 0x00, 0x00, 0x0A, 0x81, 0xFC, 0x2F, 0xC3, 0xFD, 0x3F, 0xD0, 0x0A, 0x81, 0xFC,
-    0x2F, 0xC3, 0xFD, 0x3F, 0xD0, 0x1A, 0x00, 0x29, 0x01, 0xA4, 0x3F, 0x80, 0xBF, 0x02, 0xF8, 0x3F,
-    0x80, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x7F, 0xC0, 0xFF, 0x47, 0xFC, 0x16, 0xFB,
-    0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0xE0, 0x0B, 0x80, 0x0B, 0xC0, 0x0D, 0x90, 0x0F,
-    0x40, 0x1B, 0xA0, 0x3F, 0x00, 0x1D, 0xA0, 0x7D, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x0B, 0x82, 0xF4,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xFC, 0x68, 0x68, 0x03, 0xF4, 0xDC, 0xD8, 0x07, 0xF0, 0xEC,
-    0xE8, 0x0F, 0xC0, 0xEC, 0xEC, 0x2F, 0x80, 0x78, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFC, 0x0F, 0xF8, 0x0F, 0xF4, 0x0F, 0xF0, 0x1F, 0xF0, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF0, 0xFF, 0xC0, 0xFF, 0x83, 0xFE, 0x03, 0xFD, 0x0F, 0xF4, 0x0F, 0xF0, 0x3F, 0xC0,
-    0x7F, 0xC2, 0xFE, 0x02, 0xFE, 0x0F, 0xF4, 0x0F, 0xF4, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x2D, 0x07, 0x40, 0xBE, 0x0F, 0xC3, 0xF0, 0x3F, 0x0B, 0xD1, 0xF8, 0x2F, 0x43, 0xE0, 0xFC,
-    0x0F, 0x42, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x3F, 0x01, 0xF8, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC2, 0xD0, 0xBE, 0x3F, 0x03, 0xF2, 0xF4, 0x0F, 0x8F,
-    0xC0, 0x7C, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0xD0, 0x28, 0x07, 0xF0,
-    0xFC, 0x2F, 0x40, 0xFD, 0x2F, 0x87, 0xF0, 0x0F, 0xC3, 0xF0, 0x7E, 0x01, 0xF4, 0x3D, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x0F, 0xEF, 0xE0,
-    0x7F, 0xC7, 0xFC, 0x00, 0x00, 0x00, 0x50, 0x0B, 0x40, 0xFD, 0x0F, 0xD0, 0xFC, 0x0B, 0xE0, 0x1F,
-    0xE0, 0x0F, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0B, 0x40, 0x2F, 0x80, 0x2F,
-    0x80, 0x1F, 0xC0, 0x3F, 0x43, 0xFC, 0x3F, 0xC1, 0xF8, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x1F, 0xF4, 0x3F, 0xD0, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0x3F, 0xD0, 0x03, 0xFF,
-    0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0xBF, 0xC0, 0x00, 0x02,
-    0xFF, 0xAF, 0xF4, 0x00, 0x3F, 0x0F, 0xFF, 0xFE, 0x0F, 0xD7, 0xF4, 0x3F, 0xFF, 0xC0, 0xFE, 0x7F,
-    0x41, 0xFF, 0xF0, 0x1F, 0xEB, 0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0x6A, 0x43, 0xFF, 0xFC, 0x1A, 0x90,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0x6F, 0xFE, 0x00,
-    0x02, 0xFF, 0xE0, 0xFF, 0xF4, 0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xD0, 0x1F, 0xFF, 0x00, 0x1F, 0xFF,
-    0x07, 0xFF, 0xD0, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x00, 0xBC, 0x0F, 0xC0, 0xFC,
-    0x0F, 0xC0, 0xFC, 0x0F, 0xC1, 0xFC, 0x1F, 0xC1, 0xFC, 0x2F, 0xC2, 0xF8, 0x1F, 0x80, 0x38, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA8, 0x3F, 0xC7, 0xFD, 0x7F, 0xDB, 0xFE, 0xFF, 0xE0,
-    0x00, 0x10, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0xBF, 0xE0, 0x01, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF0, 0x3D, 0x3F, 0xBE, 0x04, 0x0F, 0xCF,
-    0xC0, 0x07, 0xF3, 0xF0, 0x01, 0xFC, 0xFD, 0x00, 0x7E, 0x3F, 0x00, 0x2F, 0x9F, 0xC0, 0x0B, 0xFF,
-    0xE0, 0x02, 0xFF, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x2F, 0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFD,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2A, 0x40, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF,
-    0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x02, 0xAA, 0x40, 0x00, 0x15, 0x55, 0x56, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x2E, 0x01, 0xF4, 0xFF, 0xFF, 0xC1, 0xFF, 0xFD, 0x01, 0xBF, 0x90,
-    0x00, 0x05, 0x00, 0x00, 0x01, 0x38, 0x80, 0x00, 0x2E, 0xFF, 0x40, 0x00, 0x7F, 0xF4, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0C, 0xF2, 0x10, 0x00, 0xB3, 0x83, 0x88, 0x22, 0xCB,
-    0xDF, 0xB5, 0xFF, 0xFB, 0xFF, 0x40, 0xFF, 0x47, 0xFE, 0x4B, 0xFF, 0xFF, 0xED, 0x3E, 0xDD, 0x8F,
-    0x00, 0x0B, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x90, 0x00, 0x01, 0xA4, 0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0xFF, 0x81, 0xFF,
-    0xFF, 0xE0, 0xBF, 0x41, 0xFD, 0x2F, 0xD0, 0x7F, 0x42, 0x80, 0x07, 0xF0, 0xE0, 0x01, 0xF8, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFD, 0x00, 0x0B, 0xFE, 0x00,
-    0x02, 0xFF, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x90, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x00, 0x01, 0xAA, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90,
-    0x00, 0x00, 0x40, 0x0B, 0xFF, 0xE0, 0x00, 0x0D, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xF4, 0xBF, 0x41,
-    0xFD, 0x00, 0x1F, 0x42, 0x80, 0x07, 0xF0, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x40, 0x00,
-    0x03, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00,
-    0x00, 0xBF, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0xD0, 0x03, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x3F, 0x00,
-    0x0B, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xF0,
-    0x00, 0xFF, 0x40, 0x00, 0x02, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x0F, 0xE0, 0x00, 0x0B, 0xF8, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x1F, 0xF0, 0x00, 0x0F, 0xFC, 0x01, 0xAA, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x1A, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0A, 0x90, 0x00, 0x38, 0x7F, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0x90, 0xBF, 0x01, 0xFB, 0x40, 0x0F, 0xD0, 0x7D, 0x00, 0x01, 0xF8,
-    0x1F, 0x40, 0x00, 0x7F, 0x0B, 0xD0, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x0B, 0xE0, 0xBD, 0x00, 0x03,
-    0xF4, 0x3F, 0x40, 0x07, 0xFC, 0x0F, 0xD0, 0x2F, 0xFC, 0x03, 0xF4, 0x0F, 0xFC, 0x00, 0xFD, 0x03,
-    0xFC, 0x00, 0x0B, 0x40, 0xFF, 0x00, 0x00, 0x90, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x01,
-    0xFE, 0x07, 0xF0, 0x00, 0xBF, 0xC1, 0xFC, 0x00, 0x3F, 0xF0, 0xBF, 0x40, 0x0F, 0xFC, 0x3F, 0xD0,
-    0x03, 0xFF, 0x4A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x1A, 0x00, 0xBC, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x3F, 0x81, 0xF8,
-    0x00, 0x7F, 0x82, 0xF4, 0x00, 0xBF, 0xC3, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0xFD, 0x03,
-    0xF8, 0x00, 0xFC, 0x03, 0xF8, 0x02, 0xFC, 0x07, 0xFC, 0x03, 0xF8, 0x06, 0xA8, 0x03, 0xF4, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB2, 0x83, 0x57, 0x0E, 0xDC, 0x3B, 0x70, 0xE2, 0xC3,
-    0xFF, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x40, 0x07, 0x40, 0x3D, 0x03, 0x74, 0x2C, 0xE0, 0xFF, 0xD0,
-    0x1E, 0x00, 0x38, 0x01, 0x40, 0xFF, 0xC3, 0x80, 0x0E, 0x40, 0x3F, 0xE0, 0x02, 0xC2, 0x4F, 0x0F,
-    0xFC, 0x2F, 0x80, 0x01, 0x50, 0x3F, 0xC2, 0xC0, 0x0D, 0x40, 0x3F, 0xE0, 0xF1, 0xD3, 0xC7, 0x4B,
-    0xFC, 0x06, 0x40, 0x15, 0x50, 0xFF, 0xD0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00,
-    0xF8, 0x03, 0xD0, 0x00, 0x00, 0x2F, 0x42, 0xC7, 0x0B, 0x1C, 0x0F, 0xE0, 0xB6, 0xC3, 0x83, 0x8F,
-    0xFD, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x43, 0x87, 0x0C, 0x0D, 0x34, 0x78, 0xBF, 0xE0, 0x67, 0x8A,
-    0xBC, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x3F, 0xFB,
-    0xFC, 0x3F, 0x40, 0xBC, 0x7F, 0x00, 0x7D, 0x7E, 0x00, 0x7D, 0x7F, 0x00, 0xBE, 0x7F, 0x00, 0xBE,
-    0xBF, 0x00, 0xFE, 0xBF, 0x00, 0xFF, 0xBF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x0B, 0x80, 0xB2, 0xC3,
-    0x93, 0x4E, 0xDD, 0x3B, 0x74, 0xF2, 0xD3, 0xFF, 0x03, 0xF8, 0x01, 0x00, 0x01, 0x00, 0x7D, 0x02,
-    0xB4, 0x01, 0xD0, 0x07, 0x40, 0x2D, 0x00, 0xB4, 0x0F, 0xFC, 0x3F, 0xF0, 0x1F, 0xD0, 0xEB, 0xC0,
-    0x07, 0x40, 0x1D, 0x00, 0xF0, 0x0F, 0x81, 0xFC, 0x0F, 0xFE, 0x3F, 0xF4, 0x1F, 0xD0, 0x96, 0xC0,
-    0x03, 0x40, 0x6C, 0x0F, 0xE0, 0x02, 0xD2, 0xFF, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x90, 0x07, 0x80,
-    0x3E, 0x03, 0x7C, 0x2C, 0xF0, 0xFF, 0xF0, 0x0F, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x83, 0x40, 0x0F,
-    0xF0, 0x15, 0xF0, 0x43, 0xC3, 0xFF, 0x0B, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x79, 0x43, 0x80, 0x0F,
-    0xF4, 0x3E, 0xB4, 0xF0, 0xE3, 0xC7, 0x8B, 0xFC, 0x06, 0x80, 0x00, 0x00, 0xFF, 0xE1, 0x5B, 0x40,
-    0x2C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0xB8, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0xB1, 0xD2,
-    0xC3, 0x47, 0xAC, 0x0F, 0xF0, 0xF1, 0xE3, 0xC3, 0xCF, 0xFE, 0x0A, 0x90, 0x0B, 0xD0, 0xE6, 0xC3,
-    0x03, 0x4C, 0x0E, 0x3E, 0xF8, 0x2F, 0xE0, 0x03, 0x4F, 0xFC, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x0B, 0xD0, 0x07, 0xF0, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x2F, 0x80,
-    0x0F, 0xD0, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x2F, 0x80, 0x0B, 0xE0, 0x02, 0xF8, 0x00,
-    0xBF, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x01, 0xFD, 0x00,
-    0x3F, 0xC0, 0x0B, 0xF0, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x40, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x1F, 0xC0, 0x03, 0xF4,
-    0x00, 0xBE, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x0B, 0xE0, 0x02, 0xF8,
-    0x00, 0xBE, 0x00, 0x2F, 0x80, 0x0F, 0xE0, 0x03, 0xF4, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 0xC0,
-    0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xFC, 0x02, 0xFD, 0x01, 0xFF, 0x00, 0xFF, 0x40, 0x7F, 0x80, 0x00,
-    0x00, 0x00, 0x2D, 0x3C, 0x00, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0xB8,
-    0x00, 0x00, 0xB8, 0xF4, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xE3, 0xE0, 0x0B, 0xFF, 0xE3, 0xD0, 0x0F, 0xF7, 0xD3, 0xC0,
-    0x0F, 0xF3, 0xC7, 0xC0, 0x1F, 0xF7, 0xCB, 0x80, 0x2F, 0xF7, 0xCB, 0x80, 0x2F, 0xFB, 0x8F, 0x40,
-    0x2F, 0xFF, 0x4F, 0x00, 0x1F, 0xFF, 0x5F, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7C, 0xB8, 0x00,
-    0x00, 0x7C, 0xB8, 0x00, 0x00, 0xB8, 0xF4, 0x00, 0x00, 0xB4, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x1F, 0xF0, 0x3E, 0xB8, 0x2F, 0xF0, 0x3F, 0xF8, 0x2F, 0xF0, 0x3F, 0x44, 0x2F, 0xF4, 0x3E, 0x00,
-    0x1F, 0xFE, 0x7E, 0x68, 0x0F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x3F, 0xFF, 0xE0, 0x0B, 0xE0, 0x7F, 0x40, 0xBC, 0x00, 0x00, 0xBF, 0xFF, 0xFC,
-    0x0B, 0xFF, 0xFF, 0xC0, 0x17, 0xF5, 0x54, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x3F, 0xFF, 0xFA, 0x03, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7F, 0xC0, 0x03, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFE, 0x00,
-    0x7F, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xF8, 0x07, 0xF0, 0x00, 0x02, 0xFF,
-    0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0xBF, 0x00, 0x00, 0x3F, 0xEF, 0xC2, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xF4, 0xFD, 0xFE, 0x00,
-    0x00, 0x3F, 0xD3, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0x47, 0xFF, 0xE0, 0x00, 0x07, 0xFD, 0x0F, 0xFF,
-    0x40, 0x00, 0x1F, 0xF4, 0x1F, 0xFD, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF4, 0x00, 0x02, 0xFF, 0x80,
-    0xBF, 0xD0, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0x40, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0xAB, 0xFE, 0xAB, 0xFE, 0x80,
-    0x0F, 0xD0, 0x1F, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xE5, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xBC, 0x00, 0x00, 0x00, 0x0B, 0x80, 0xB8, 0x00, 0x00, 0x00,
-    0x2E, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x0B,
-    0xF8, 0x0F, 0xD6, 0xF8, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xD0, 0x03, 0x80, 0x40, 0xFF, 0xFE, 0x00,
-    0x0E, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0x90, 0x0F, 0xE1, 0xF8, 0x00, 0x3F, 0xE0, 0x3F, 0x43,
-    0xF0, 0x00, 0x1B, 0xE0, 0xFD, 0x0F, 0xC0, 0x00, 0x0B, 0xC3, 0xF4, 0x3F, 0x80, 0x3D, 0x7F, 0x0F,
-    0xD0, 0xFF, 0x03, 0xFF, 0xFC, 0x7F, 0x43, 0xFC, 0x0F, 0xFF, 0xD0, 0x55, 0x05, 0x50, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x2E, 0x00, 0xFC, 0x00, 0x03, 0xE0,
-    0x0B, 0xC0, 0x00, 0x3E, 0x00, 0xBC, 0x00, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0x3C, 0x00, 0x7D, 0x0F,
-    0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x17, 0xF7, 0xFD, 0xFD, 0x40,
-    0x3F, 0x3F, 0xCF, 0x80, 0x02, 0xFB, 0xFD, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xEF,
-    0xF0, 0x00, 0x1F, 0xF9, 0xFF, 0x00, 0x00, 0xFF, 0x4F, 0xF0, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x00,
-    0xFF, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0xBD, 0x00, 0xA5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x05,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0x97, 0xF4, 0x2F, 0xFC, 0x00, 0xFC, 0x2F, 0xF8, 0x00, 0x7C, 0x2F,
-    0xF8, 0xA4, 0x7C, 0x2F, 0xF8, 0xFC, 0x7C, 0x2F, 0xF8, 0xFC, 0x7C, 0x2F, 0xF8, 0xFC, 0x3C, 0x3F,
-    0xF8, 0xBC, 0x00, 0x3F, 0xF8, 0xBE, 0x00, 0x3F, 0xF8, 0x7F, 0x90, 0xBF, 0xF8, 0x2F, 0xFF, 0xFF,
-    0x64, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0xBF, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xEB, 0xC0,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFD, 0xBF, 0x80, 0x00, 0xF0, 0x2F, 0x80, 0x01, 0xE0, 0x1F, 0x80,
-    0x01, 0xE0, 0x1F, 0x80, 0x01, 0xF4, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x1B, 0xEB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFD, 0x00,
-    0x3F, 0xE5, 0x60, 0x01, 0xFD, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x2A, 0xFF,
-    0xE9, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x07, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0xAA, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0xAA, 0xA9, 0xBF,
-    0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xE0, 0x40, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0x40, 0x02, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xF0, 0x00, 0x02, 0x8F, 0xFB, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x6F, 0xFF, 0x80, 0x02,
-    0xFF, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x02, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x1A, 0xAA, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x03, 0xF4, 0x07, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x94,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x80, 0x02, 0xFF, 0xFF,
-    0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFA, 0xAC, 0x03, 0xFF, 0x0F, 0x40, 0x00, 0x3F,
-    0xD0, 0xF4, 0x00, 0x07, 0xFC, 0x0F, 0x40, 0x00, 0x7F, 0x80, 0xF4, 0x00, 0x0B, 0xF8, 0x0F, 0x94,
-    0x00, 0xBF, 0x81, 0xFF, 0xFF, 0xCB, 0xF8, 0x1F, 0xFF, 0xFD, 0x7F, 0xC1, 0xFA, 0xBF, 0xE3, 0xFE,
-    0x1F, 0x43, 0xF4, 0x3F, 0xFE, 0xF5, 0xBF, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x20, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xF0, 0x00, 0x60, 0x00,
-    0x02, 0xFE, 0x46, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xE0, 0x0F, 0xFF, 0xC0, 0xFF, 0xFB, 0x07, 0xFB, 0xC0, 0x2F, 0x9F,
-    0x00, 0xBD, 0x7C, 0x03, 0xF5, 0xF0, 0x0B, 0xE7, 0xC0, 0x2F, 0xEF, 0x40, 0x3F, 0xFF, 0x80, 0x7F,
-    0xFF, 0x80, 0x2F, 0xF9, 0x00, 0x0F, 0x40, 0x00, 0x28, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1, 0x55,
-    0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0xFF, 0xFD, 0x3F, 0xFF, 0xFD, 0x15, 0xBF, 0x54, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFD, 0x16, 0xFF, 0x94, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFD, 0x00, 0x29, 0xFF,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xE0,
-    0x00, 0x2A, 0xA0, 0x07, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xBE, 0x7D, 0x00, 0x2F, 0xFF, 0x40,
-    0x1F, 0xFF, 0xD0, 0x3F, 0xFE, 0x50, 0x0F, 0xFE, 0xBD, 0x03, 0xAF, 0xFF, 0x40, 0x2F, 0xFF, 0xD5,
-    0x3F, 0xFE, 0x0B, 0xCF, 0xFE, 0x07, 0xF3, 0x8F, 0x8B, 0xF4, 0x03, 0xFF, 0xF4, 0x00, 0xFF, 0xE0,
-    0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0xF4, 0x03, 0xFB, 0xEB, 0xE0, 0x0F, 0xCF, 0x8F, 0xC0, 0x3F, 0x3E, 0x3F, 0x00, 0xFC, 0xF8, 0xFC,
-    0x03, 0xF3, 0xE3, 0xF0, 0x0F, 0xCF, 0x8F, 0xC0, 0x3F, 0x3E, 0x3F, 0x00, 0xFC, 0xFC, 0xF8, 0x03,
-    0xF3, 0xF3, 0xE0, 0x0F, 0xDB, 0xDF, 0x80, 0x00, 0x06, 0xAA, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xD0,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0xFD,
-    0x00, 0xBE, 0x00, 0x0F, 0xD0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x94, 0x00, 0x15, 0x6F, 0xF5,
-    0x50, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xBF, 0xEA, 0xAA, 0x87, 0xFF,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x07, 0xFF, 0xFF, 0xD0, 0x1F, 0xE7, 0xD7, 0xF8, 0x2F, 0x47, 0xD1, 0xF4, 0x09, 0x07, 0xD0,
-    0x10, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x0A, 0xAA, 0xAB, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x07,
-    0xD0, 0x00, 0x0E, 0x07, 0xD0, 0xA0, 0x3F, 0xC7, 0xD2, 0xF8, 0x0F, 0xFB, 0xEF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x1F, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x3E, 0x00, 0x0F,
-    0x80, 0x07, 0xE0, 0x0F, 0xC0, 0x00, 0x7D, 0x0F, 0xFF, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x7E, 0x00, 0x01, 0xF8, 0x07, 0xD0, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x7C,
-    0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0xF8, 0x00, 0x0F,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x0F, 0xCB, 0x9F, 0xC2, 0xC2, 0xE0, 0xD0, 0x00, 0xB8, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x42, 0xE0, 0x40, 0xF4, 0xB8, 0xB8, 0x2F, 0xAE, 0xBE, 0x02,
-    0xFF, 0xFE, 0x00, 0x1F, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2B, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x3F, 0xFA, 0x90, 0x3F, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x3D,
-    0xBF, 0x40, 0x7D, 0x2F, 0xD0, 0x7D, 0x0B, 0xF4, 0x7C, 0x02, 0xFD, 0x68, 0x00, 0xBD, 0x00, 0x00,
-    0x24, 0x04, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x40, 0xFF, 0xFF, 0xE0, 0x16, 0xAF, 0xF8, 0x00, 0x0B,
-    0xFF, 0x00, 0x0B, 0xFF, 0xC0, 0x0B, 0xF6, 0xF0, 0x0B, 0xF4, 0xBC, 0x0B, 0xF4, 0x2F, 0x0B, 0xF4,
-    0x0B, 0xC2, 0xF4, 0x01, 0xA0, 0x24, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xFC,
-    0x02, 0xF0, 0x3F, 0xC0, 0xBC, 0x03, 0xF8, 0x3F, 0x00, 0x3F, 0x8F, 0x80, 0x07, 0xF7, 0xE0, 0x00,
-    0x7F, 0xF4, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0x2A, 0xAA, 0xA0, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0xFC, 0xFC, 0x0B, 0xF0, 0xBC, 0x1F, 0xC0, 0x7C, 0x7F,
-    0x40, 0x7E, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF, 0xF8,
-    0x1A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F,
-    0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x75, 0xD0, 0x00, 0x00, 0x1F, 0x5F, 0x40, 0x00, 0x07, 0xF5, 0xFD, 0x00, 0x01, 0xFF, 0x5F,
-    0xF4, 0x00, 0x7F, 0xF5, 0xFF, 0xD0, 0x1F, 0xEF, 0x5F, 0x7F, 0x83, 0xF8, 0xF5, 0xF1, 0xFD, 0x3E,
-    0x0F, 0x5F, 0x07, 0xC0, 0x80, 0xF5, 0xF0, 0x10, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0,
-    0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x00, 0x06, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0xBF, 0xFF, 0xFF, 0xF4,
-    0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0xBF, 0xFF, 0xFF, 0xFC, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5,
-    0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x00, 0x00, 0xF5, 0xF0, 0x00, 0x00, 0x0F, 0x5F, 0x00, 0x01,
-    0xC0, 0xF5, 0xF0, 0x24, 0x7F, 0x0F, 0x5F, 0x0B, 0xC3, 0xFC, 0xF5, 0xF2, 0xFC, 0x0F, 0xFF, 0x5F,
-    0xBF, 0x00, 0x3F, 0xF5, 0xFF, 0xC0, 0x00, 0xFF, 0x5F, 0xF0, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00,
-    0x0F, 0x5F, 0x00, 0x00, 0x00, 0x35, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x03, 0x80, 0x00, 0x0B, 0xE0, 0x2F, 0x40, 0x00, 0x7F, 0x00, 0x7F, 0x00,
-    0x03, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE0,
-    0x00, 0x02, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xC0, 0x1F,
-    0xE0, 0x00, 0x3F, 0x80, 0xBF, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x50, 0x01, 0x40, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xBF, 0xD0, 0x2F, 0xF3,
-    0xFF, 0xD7, 0xFF, 0x3E, 0xFF, 0x2E, 0xF3, 0xC3, 0xC0, 0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-    0x0F, 0x3C, 0x00, 0x00, 0xF3, 0xC0, 0x02, 0xFF, 0x3C, 0x7D, 0x7F, 0xF3, 0xEF, 0xF2, 0xFF, 0x3F,
-    0xF8, 0x03, 0xFF, 0xFD, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x06, 0xA4, 0xBC, 0x0F, 0xFF, 0xAF, 0x0F, 0xFF, 0xFF, 0xC7,
-    0xF4, 0x3F, 0xE2, 0xF8, 0x07, 0xF8, 0xFD, 0x00, 0xFD, 0x3F, 0x40, 0x3F, 0x0B, 0xF4, 0x2F, 0xC1,
-    0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x6F, 0xE8, 0x07, 0xC0, 0x00, 0xFF, 0xFF, 0xE7, 0xF4, 0x01, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0x80, 0x3F, 0xF4, 0x00, 0xBF, 0x40, 0x0B, 0xFC, 0x00, 0x3F, 0xC0, 0x0B,
-    0xFF, 0x80, 0x1F, 0xD0, 0x0B, 0xFF, 0xF0, 0x0B, 0xF0, 0x0B, 0xF2, 0xFC, 0x02, 0xFC, 0x0F, 0xF0,
-    0x7F, 0x00, 0xBF, 0x0F, 0xF0, 0x1F, 0xC0, 0x2F, 0xDF, 0xE0, 0x0B, 0xF0, 0x07, 0xFF, 0xE0, 0x03,
-    0xFC, 0x01, 0xFF, 0xF4, 0x1B, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xEF, 0xFF, 0xFF, 0xF0, 0x07, 0xD0, 0x6F, 0xFF, 0x90,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x01, 0xFD,
-    0x7F, 0x40, 0x03, 0xFC, 0x3F, 0xC0, 0x07, 0xF8, 0x2F, 0xD0, 0x0F, 0xF0, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x0F, 0xF0, 0x3F, 0xD0, 0x07, 0xF8, 0x7F, 0xC0, 0x03, 0xFC, 0xBF, 0x80, 0x02, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF,
-    0xFD, 0xAF, 0xEA, 0xFF, 0x80, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F,
-    0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD,
-    0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xA8,
-    0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0,
-    0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0,
-    0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00, 0xFC, 0x0B, 0xD0, 0x0F, 0xC0, 0xBD, 0x00,
-    0xFC, 0x0B, 0xD0, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0x80, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xDF, 0xFA, 0xAA, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x1F, 0xD0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x55, 0x55, 0x54, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC,
-    0x2F, 0xFF, 0xFD, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x10, 0x2F, 0xC0, 0x00,
-    0x07, 0x83, 0xFC, 0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xBF, 0x41, 0xFD, 0x02, 0xFF, 0xFA, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFC, 0xBE, 0x02, 0xFD,
-    0x0F, 0xBF, 0x00, 0x3C, 0x02, 0xFF, 0xC0, 0x0B, 0x00, 0x7F, 0xF0, 0x03, 0xF5, 0x7F, 0xBF, 0xFF,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xFA, 0xFF, 0xE0, 0x1B, 0xE4, 0x1F, 0xD0, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0x46,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x64, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xD1, 0xFD, 0x2F, 0xE3, 0xFE, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD,
-    0x1F, 0xD2, 0xFE, 0x3F, 0xE3, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC, 0x3E, 0xBD,
-    0x7E, 0x7E, 0xFD, 0x2F, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x39, 0x7F, 0xFC,
-    0x3E, 0xFD, 0x7F, 0xFD, 0xBD, 0x1F, 0xFC, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x3F, 0x00, 0x0A, 0xAB, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE8, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x6A, 0xFF,
-    0xFE, 0xA8, 0x01, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00,
-    0x00, 0x07, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xD0,
-    0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x02, 0xFF,
-    0xFF, 0xF9, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x1B, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF,
-    0x00, 0x65, 0x00, 0x00, 0xB0, 0x0B, 0xFF, 0xFA, 0x50, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x56,
-    0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x1B, 0xFF, 0x80,
-    0x01, 0xBF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x01, 0x50, 0x00, 0x5A, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F,
-    0xFF, 0xEA, 0x50, 0x02, 0x50, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_10_boldBitmaps[29312] = {
+    0x70, 0x99, 0x49, 0xC9, 0x39, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x29,
+    0xE2, 0x9E, 0x3E, 0x4A, 0xC5, 0x97, 0x77, 0x69, 0xAA, 0xA2, 0xF9, 0x1F, 0xA1, 0xFA, 0x09, 0xFC,
+    0x0A, 0xFC, 0x00, 0x75, 0xFC, 0x09, 0xFA, 0x0F, 0x90, 0x9F, 0x90, 0xF1, 0x9F, 0x1F, 0x19, 0xF1,
+    0xF1, 0x9F, 0x1F, 0x19, 0xF1, 0xF1, 0x9F, 0x00, 0x69, 0xD9, 0x2D, 0xA7, 0x4A, 0xD9, 0x19, 0xDA,
+    0x74, 0xAD, 0x91, 0x9D, 0xA7, 0x4E, 0x91, 0xAD, 0xA7, 0x4E, 0x2A, 0xD9, 0x7F, 0xFF, 0xFF, 0xA1,
+    0xFF, 0xFF, 0xF9, 0x09, 0xFF, 0xFF, 0xF6, 0xAE, 0x2E, 0x74, 0xAE, 0x19, 0xE7, 0x4E, 0xA1, 0x9E,
+    0x74, 0xEA, 0x1A, 0xE7, 0x0F, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xEA, 0x1F, 0xFF, 0xFF, 0x95, 0xAE,
+    0x2E, 0x97, 0x3A, 0xE2, 0xE9, 0x73, 0xF1, 0x9E, 0x97, 0x3F, 0x1A, 0xE7, 0x77, 0x60, 0x77, 0x71,
+    0xDA, 0x76, 0xDA, 0x76, 0xDA, 0x73, 0x9A, 0xFD, 0xA9, 0x6F, 0xFD, 0x6F, 0xFD, 0xA5, 0x9F, 0x9D,
+    0xA0, 0x96, 0xAE, 0x1D, 0xA7, 0x0A, 0xE9, 0x0D, 0x97, 0x09, 0xFA, 0xD9, 0x71, 0xFF, 0xA9, 0x70,
+    0xFF, 0xD9, 0x79, 0xAF, 0xFC, 0x70, 0x9F, 0xFA, 0x79, 0xD9, 0x0F, 0xC3, 0xAA, 0x90, 0x9D, 0x91,
+    0xF9, 0x1A, 0xFE, 0x99, 0xFC, 0x19, 0xFF, 0xFD, 0xA1, 0xFF, 0xFD, 0x93, 0x9A, 0xAF, 0xEA, 0x97,
+    0x29, 0xD7, 0x69, 0xD7, 0x69, 0xD7, 0x79, 0x97, 0x75, 0x99, 0x76, 0x9D, 0x49, 0x99, 0x6D, 0xA3,
+    0xFA, 0x4A, 0xD3, 0xAC, 0x90, 0xAC, 0x92, 0x9D, 0xA3, 0xD2, 0xCA, 0x2E, 0x4D, 0x2D, 0x1A, 0xD9,
+    0x4D, 0x90, 0x9C, 0xA1, 0xE5, 0xAF, 0xC9, 0x0A, 0xD7, 0xFA, 0x09, 0xDA, 0x70, 0x99, 0x91, 0xE0,
+    0x9E, 0x97, 0xAD, 0xA9, 0xDA, 0xD9, 0x6E, 0x0A, 0xC2, 0xD5, 0xE9, 0x0D, 0x2D, 0x49, 0xE1, 0xD9,
+    0x09, 0xD4, 0xE9, 0x1A, 0xFC, 0xA3, 0xAD, 0xA3, 0xFC, 0x39, 0xE5, 0x99, 0x95, 0x99, 0x73, 0x2A,
+    0xEA, 0x70, 0x9E, 0xAE, 0x96, 0xD9, 0x29, 0xD6, 0xD4, 0xD9, 0x5D, 0x93, 0xD9, 0x5E, 0x2A, 0xD6,
+    0x9E, 0xAE, 0xA7, 0x9F, 0xC9, 0x70, 0xAF, 0x97, 0x0A, 0xFD, 0x92, 0xDA, 0x1E, 0x90, 0xAD, 0xA1,
+    0xE0, 0x9E, 0x29, 0xEA, 0xDA, 0x09, 0xEA, 0x29, 0xFC, 0x19, 0xFC, 0xAA, 0xFC, 0xA2, 0xFF, 0xFC,
+    0xA2, 0xFF, 0xC9, 0xD4, 0xAF, 0xA9, 0x50, 0x5F, 0xC0, 0xFC, 0x0F, 0x90, 0xF9, 0x0F, 0x90, 0xF9,
+    0x0F, 0x90, 0x75, 0xE4, 0xAD, 0x93, 0x9E, 0x4E, 0x93, 0x9E, 0x4E, 0x94, 0xE4, 0xAD, 0xA4, 0xE9,
+    0x4E, 0x49, 0xE4, 0x9E, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xE4, 0x9E, 0x49, 0xE5, 0xE9,
+    0x4E, 0xA4, 0xAE, 0x49, 0xE9, 0x4F, 0x4A, 0xE4, 0x9F, 0x4F, 0x93, 0x9F, 0x4A, 0xEA, 0x71, 0xE5,
+    0x9D, 0xA5, 0xE9, 0x49, 0xE5, 0xE9, 0x49, 0xE5, 0xE9, 0x4A, 0xDA, 0x49, 0xE5, 0xE5, 0xE9, 0x4A,
+    0xD9, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4E, 0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0xF4,
+    0xE9, 0x3A, 0xE4, 0xF3, 0xAE, 0x92, 0x9F, 0x3F, 0x92, 0x9E, 0xA3, 0x77, 0x1A, 0xCA, 0x71, 0xDA,
+    0x19, 0x92, 0xD0, 0xDA, 0x0D, 0xA1, 0xFF, 0xDA, 0x19, 0xAF, 0xE9, 0x49, 0xFC, 0xA4, 0xAF, 0xFA,
+    0x1A, 0xFD, 0xAE, 0x2D, 0x0A, 0xD0, 0x9C, 0x6A, 0xD7, 0x19, 0xA9, 0x40, 0x76, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7A, 0xD3, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xEA, 0xAA, 0xA3, 0xAD, 0x7A, 0xD7, 0xAD, 0x79,
+    0xAA, 0x30, 0x7A, 0xF9, 0x0A, 0xF1, 0x9F, 0x1A, 0xE9, 0x1F, 0x19, 0xF1, 0xFA, 0x10, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xFF, 0xDA, 0xFF, 0xD0, 0x09, 0xAA, 0x1E, 0xA0, 0xEA, 0x9F, 0x9F, 0x77,
+    0x70, 0x9C, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xDA,
+    0x71, 0xAD, 0x97, 0x1E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1E,
+    0x97, 0x1E, 0x71, 0x9E, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71,
+    0xE7, 0x19, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x09, 0xE7, 0x1A,
+    0xE7, 0x1D, 0xA7, 0x2C, 0x97, 0x29, 0x74, 0x3A, 0xEA, 0x6F, 0xE9, 0x3E, 0x91, 0xE2, 0x9D, 0xA2,
+    0x9D, 0xA1, 0xAD, 0x90, 0x91, 0xE1, 0xE0, 0xAD, 0x0E, 0x1E, 0x0E, 0x0A, 0xD1, 0xE0, 0xE0, 0xE9,
+    0x0E, 0x0E, 0x0E, 0x90, 0xE9, 0x9C, 0xA0, 0xE9, 0x0E, 0xA2, 0x9E, 0x1F, 0x90, 0x9F, 0x1A, 0xFF,
+    0xD2, 0xFF, 0xCA, 0x2F, 0xFC, 0x4F, 0xE9, 0x59, 0xEA, 0x30, 0x3A, 0xAC, 0x5A, 0xF4, 0x9F, 0xC4,
+    0x9F, 0xC4, 0x99, 0x0E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x69, 0xE6, 0x9E, 0x49, 0x9A, 0xEA, 0x99,
+    0x90, 0xFF, 0xCA, 0x0F, 0xFC, 0xA0, 0xFF, 0xCA, 0x19, 0xAF, 0x94, 0xAF, 0xF3, 0xFF, 0xD2, 0xD9,
+    0x29, 0xE9, 0x19, 0x5A, 0xDA, 0x70, 0xAD, 0xA7, 0x0E, 0x97, 0xAE, 0x7A, 0xEA, 0x6F, 0xC5, 0x9F,
+    0xC9, 0x4A, 0xFC, 0xA4, 0x9F, 0xDA, 0xAA, 0x91, 0xAF, 0xFD, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x39,
+    0x99, 0x96, 0xFE, 0xA3, 0x9F, 0xFA, 0x2A, 0xA9, 0x3A, 0xD9, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0xAD,
+    0x93, 0x9F, 0xDA, 0x4A, 0xFD, 0x94, 0xAA, 0xFD, 0x97, 0x0F, 0x70, 0x9E, 0x2C, 0xA9, 0x09, 0x9F,
+    0x19, 0xFF, 0xD1, 0xAF, 0xFC, 0xA1, 0xFF, 0xD2, 0x9A, 0xFC, 0xA9, 0x20, 0x69, 0xD9, 0x70, 0xE9,
+    0x7A, 0xE9, 0x69, 0xF9, 0x6D, 0xAD, 0x95, 0xDA, 0x9D, 0xA4, 0xAD, 0x09, 0xDA, 0x39, 0xD9, 0x09,
+    0xDA, 0x3D, 0xA1, 0xAD, 0xA2, 0xFF, 0xEA, 0x0F, 0xFE, 0xA0, 0xFF, 0xEA, 0x6F, 0x97, 0xF7, 0x0F,
+    0x70, 0xF7, 0x60, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFC, 0x1A, 0xFF, 0xC1, 0xAD, 0x70,
+    0xAD, 0x70, 0xAD, 0x70, 0xFA, 0xA9, 0x93, 0xFF, 0xA2, 0xFF, 0xD1, 0x94, 0x9E, 0x97, 0xEA, 0x7F,
+    0x09, 0xCA, 0x99, 0x9F, 0xA0, 0xAF, 0xFC, 0x90, 0xFF, 0xD1, 0xFF, 0xC3, 0xAF, 0xA9, 0x20, 0x4A,
+    0xFC, 0x93, 0xAF, 0xE9, 0x2A, 0xFF, 0x92, 0xE7, 0x0A, 0xD9, 0x70, 0xE0, 0x9A, 0xA9, 0x4F, 0xFC,
+    0x92, 0xFF, 0xD9, 0x1F, 0x91, 0xF1, 0xEA, 0x3E, 0x1E, 0x93, 0xE9, 0x0E, 0xA3, 0xE9, 0x0F, 0x90,
+    0x9F, 0x19, 0xFF, 0xCA, 0x2A, 0xFF, 0x49, 0xAF, 0x92, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x0F,
+    0xFD, 0xA0, 0xFF, 0xD9, 0x7E, 0x97, 0xE7, 0x9E, 0x7F, 0x7E, 0xA6, 0x9E, 0xA6, 0xAE, 0x96, 0xF7,
+    0xF6, 0xAF, 0x6F, 0xA6, 0xFA, 0x59, 0xF9, 0x10, 0x3A, 0xF9, 0x5F, 0xF3, 0xE9, 0x09, 0xEA, 0x19,
+    0xDA, 0x3E, 0x19, 0xDA, 0x3E, 0x19, 0xE2, 0xAE, 0x2F, 0xFC, 0x93, 0x9F, 0xD9, 0x39, 0xFF, 0x91,
+    0xAE, 0x91, 0xAE, 0x1E, 0x93, 0xEA, 0x0E, 0x4A, 0xDA, 0x0F, 0x91, 0xAE, 0xA0, 0xFF, 0xE9, 0x09,
+    0xFF, 0xD2, 0x9F, 0xEA, 0x59, 0x9A, 0x99, 0x30, 0x59, 0x97, 0xAF, 0xCA, 0x4F, 0xFA, 0x2A, 0xD9,
+    0x19, 0xE9, 0x1D, 0xA4, 0xDA, 0x1D, 0x5E, 0x1D, 0x5A, 0xD1, 0xD9, 0x4E, 0x90, 0xE9, 0x2A, 0xE9,
+    0x09, 0xFF, 0xD9, 0x1A, 0xFF, 0xC9, 0x29, 0xAF, 0xE7, 0x1E, 0x19, 0xA9, 0x92, 0xAE, 0x1A, 0xFF,
+    0xC9, 0x1F, 0xFC, 0xA2, 0xAF, 0xE9, 0x77, 0x0E, 0xA1, 0xF1, 0xF0, 0x9F, 0x0A, 0xF9, 0x77, 0x70,
+    0xEA, 0x1F, 0x1F, 0x09, 0xF0, 0xAF, 0x90, 0x1E, 0xA2, 0xEA, 0x19, 0xF1, 0xAF, 0x1A, 0xF7, 0x77,
+    0x69, 0x99, 0x99, 0x09, 0xFA, 0x1F, 0x2F, 0x1A, 0xEA, 0x1F, 0x91, 0xF1, 0x9A, 0xAA, 0xA1, 0x77,
+    0x75, 0x9C, 0xA7, 0x3A, 0xEA, 0x70, 0x9A, 0xFC, 0xA6, 0x9F, 0xDA, 0x6A, 0xFD, 0xA6, 0xAF, 0xDA,
+    0x70, 0xFC, 0xA7, 0x2F, 0xEA, 0x96, 0x9F, 0xFD, 0xA9, 0x69, 0xAF, 0xFD, 0x79, 0xAF, 0xE9, 0x72,
+    0xAF, 0x97, 0x59, 0xA9, 0x19, 0x99, 0xAA, 0xAA, 0xAA, 0x19, 0xFF, 0xC1, 0xFF, 0xDA, 0x09, 0x97,
+    0x76, 0xAA, 0xFE, 0x1A, 0xFF, 0xC9, 0x0F, 0xEA, 0xAA, 0x90, 0x77, 0x0C, 0xA7, 0x5F, 0x97, 0x2F,
+    0xD9, 0x71, 0x9F, 0xDA, 0x71, 0x9F, 0xDA, 0x97, 0x09, 0xFE, 0x97, 0x09, 0xFC, 0xA6, 0x9A, 0xFD,
+    0xA2, 0x9A, 0xFF, 0xE0, 0xAF, 0xFD, 0xA9, 0x2F, 0xF9, 0x6F, 0xA9, 0x71, 0xCA, 0x97, 0x40, 0x77,
+    0x29, 0xAA, 0x97, 0xFE, 0x93, 0x9F, 0xFC, 0x92, 0xF9, 0x1A, 0xE3, 0xC9, 0x4A, 0xDA, 0x71, 0x9E,
+    0x72, 0xE7, 0x2E, 0x71, 0x9D, 0xA7, 0x1E, 0x97, 0x9F, 0x69, 0xFC, 0x96, 0xFC, 0x97, 0xF7, 0x1F,
+    0x71, 0xF7, 0x1E, 0xA7, 0x1A, 0x97, 0x77, 0x77, 0x75, 0xE7, 0x19, 0xE9, 0x70, 0x9E, 0x97, 0x0A,
+    0xEA, 0x70, 0x9A, 0xAA, 0x94, 0x77, 0x74, 0xAE, 0xA9, 0x73, 0xAF, 0xF7, 0x1E, 0xA2, 0x9E, 0x7D,
+    0xA6, 0xAC, 0xA5, 0xE7, 0x0D, 0x49, 0xD2, 0xDA, 0xC9, 0x19, 0xCA, 0x3D, 0xA1, 0xD9, 0xDA, 0x2D,
+    0x3D, 0x91, 0xC2, 0xCA, 0x2D, 0x29, 0xD9, 0x09, 0xC2, 0xCA, 0x2D, 0x29, 0xD9, 0x09, 0xC1, 0x9D,
+    0x1A, 0xC9, 0x29, 0xE1, 0xFD, 0x09, 0xD4, 0xE9, 0x09, 0xFF, 0x94, 0xF5, 0xAC, 0xA6, 0x9F, 0xA4,
+    0x9A, 0x7A, 0xFF, 0xE7, 0x09, 0xFF, 0xD9, 0x71, 0xAF, 0xFA, 0x74, 0x9A, 0xA9, 0x94, 0x6A, 0xE7,
+    0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7,
+    0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF,
+    0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90,
+    0xAF, 0xEA, 0x93, 0xAF, 0xFC, 0xA2, 0xAE, 0xAA, 0xAF, 0x91, 0xAE, 0x39, 0xE1, 0xAE, 0x4E, 0x1A,
+    0xE4, 0xE1, 0xAE, 0x3A, 0xE1, 0xAF, 0xFD, 0x2A, 0xFF, 0xD9, 0x1A, 0xFF, 0xE9, 0x0A, 0xE3, 0x9F,
+    0x0A, 0xE4, 0x9E, 0x9A, 0xE4, 0x9E, 0xAA, 0xEA, 0xAA, 0xAA, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF0,
+    0xAF, 0xFE, 0x90, 0xAF, 0xFC, 0xA2, 0x77, 0x69, 0xAF, 0xCA, 0x59, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A,
+    0xFF, 0xDA, 0x3F, 0xC9, 0x70, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xAF,
+    0x72, 0xAF, 0x97, 0x19, 0xFC, 0xA9, 0x29, 0xAA, 0x2F, 0xFF, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x39,
+    0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0xAF, 0xFA, 0x94, 0xAF, 0xFE, 0x92, 0xAF, 0xFF, 0x91, 0xAE, 0xAA,
+    0xAA, 0xFD, 0x1A, 0xE5, 0xFA, 0x0A, 0xE6, 0xF0, 0xAE, 0x7E, 0x9A, 0xE7, 0xE9, 0xAE, 0x7E, 0x9A,
+    0xE7, 0xE9, 0xAE, 0x7E, 0x9A, 0xE6, 0xAE, 0x9A, 0xE3, 0x9A, 0xFC, 0x0A, 0xFF, 0xFD, 0x0A, 0xFF,
+    0xFC, 0xA0, 0xAF, 0xFF, 0xC1, 0xAF, 0xFF, 0x2A, 0xFF, 0xCA, 0x93, 0x0A, 0xAA, 0xAF, 0xE9, 0x0F,
+    0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC,
+    0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF,
+    0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x09, 0xAA, 0xFE, 0x90, 0xAF, 0xFC, 0x90,
+    0xFF, 0xD1, 0xEA, 0x7E, 0x97, 0xE9, 0x7F, 0xFC, 0x2F, 0xFC, 0x2F, 0xFC, 0x2E, 0xAA, 0xAA, 0xAA,
+    0x2E, 0x96, 0x9E, 0x96, 0x9E, 0x96, 0x9E, 0x96, 0x9E, 0x96, 0xAE, 0xA6, 0xAE, 0xA6, 0xAE, 0xA6,
+    0x69, 0x99, 0x99, 0x71, 0x9F, 0xFD, 0x5F, 0xFF, 0x4F, 0xFF, 0xC3, 0xAF, 0xC9, 0x49, 0xA3, 0xFA,
+    0x73, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA3, 0x9C, 0xAA, 0x99, 0x2A, 0xEA, 0x39,
+    0xFE, 0x0A, 0xEA, 0x4F, 0xE9, 0x9F, 0x49, 0x9A, 0xFA, 0x0F, 0xA6, 0xE9, 0x1F, 0xDA, 0x99, 0x99,
+    0xF2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC9, 0x3A, 0xFF, 0xEA, 0x69, 0xAF, 0xCA, 0x93, 0x0E, 0x95,
+    0xF1, 0xE9, 0x5F, 0x1E, 0x95, 0xF1, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA,
+    0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xF5, 0xF0, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0,
+    0x9F, 0xFF, 0xD9, 0xAF, 0xFF, 0xD9, 0xAF, 0xAA, 0xAA, 0xAA, 0xF9, 0xAF, 0x49, 0xF9, 0xAF, 0x49,
+    0xF9, 0xAF, 0x49, 0xF9, 0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9,
+    0x0E, 0x90, 0xE9, 0x0E, 0x99, 0xEA, 0x9E, 0xA9, 0xEA, 0xAF, 0xAF, 0x79, 0xE9, 0x79, 0xE9, 0x7A,
+    0xE9, 0x7A, 0xE7, 0x0F, 0x70, 0xF7, 0x0F, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x79, 0xE9, 0x79,
+    0xE9, 0x7A, 0xE7, 0x0A, 0xE7, 0x0A, 0xE7, 0x0F, 0x70, 0xF2, 0xA9, 0x2A, 0xEA, 0x2F, 0xFC, 0x92,
+    0xFF, 0xC2, 0x9F, 0xF9, 0x29, 0xFE, 0x97, 0x70, 0x1E, 0xA1, 0x9F, 0x4E, 0xA1, 0xF9, 0x4E, 0x90,
+    0x9F, 0x5E, 0x90, 0xF6, 0xE0, 0xAE, 0xA5, 0x9E, 0x9F, 0x69, 0xEA, 0xE9, 0x6A, 0xFE, 0x7A, 0xFD,
+    0x70, 0xAF, 0xCA, 0x70, 0xFD, 0x97, 0x0F, 0xE9, 0x7F, 0xF9, 0x6F, 0xFC, 0xA4, 0x9E, 0xA9, 0xFC,
+    0xA3, 0x9E, 0xA0, 0xAF, 0xCA, 0x29, 0xEA, 0x1F, 0xE1, 0xAE, 0xA2, 0xFE, 0x00, 0x0A, 0xDA, 0x70,
+    0xAD, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7,
+    0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0x9F, 0xFE, 0x9A, 0xFF, 0xE9, 0xAF,
+    0xFE, 0x9A, 0xFF, 0xE9, 0x0F, 0xA6, 0xF1, 0xFC, 0x5A, 0xF1, 0xFC, 0x94, 0xFC, 0x1F, 0xCA, 0x39,
+    0xFC, 0x90, 0xFD, 0x3F, 0xD9, 0x0F, 0xDA, 0x2F, 0xD9, 0x0F, 0xE1, 0xAF, 0xD9, 0x9F, 0xE9, 0x0F,
+    0xE9, 0x9E, 0xAE, 0xA9, 0xEA, 0xE9, 0x9E, 0x9F, 0xF9, 0xEA, 0x9E, 0x9A, 0xFE, 0x9E, 0xA9, 0xE9,
+    0x9F, 0xDA, 0x9E, 0xA9, 0xE9, 0x0F, 0xD0, 0xAE, 0xA9, 0xEA, 0x0A, 0xFC, 0x0A, 0xEA, 0xAE, 0xA0,
+    0x9F, 0xA0, 0xFA, 0xAE, 0xA1, 0xF9, 0x0F, 0xCA, 0xF1, 0xAE, 0x1F, 0xCA, 0xF7, 0xFC, 0x73, 0xE1,
+    0x9F, 0x5E, 0x19, 0xF9, 0x39, 0xE1, 0x9F, 0xA3, 0x9E, 0x1A, 0xFC, 0x39, 0xE1, 0xAF, 0xCA, 0x2A,
+    0xE1, 0xAF, 0xD2, 0xAE, 0x1F, 0xEA, 0x1A, 0xE1, 0xFA, 0xE1, 0xAE, 0x1F, 0x0E, 0xA0, 0xEA, 0x1F,
+    0x0A, 0xE0, 0xEA, 0x1F, 0x90, 0xE9, 0xEA, 0x1F, 0x90, 0xAF, 0xDA, 0x09, 0xF9, 0x09, 0xFD, 0x90,
+    0x9F, 0x91, 0xFD, 0x90, 0x9F, 0x91, 0x9F, 0xC9, 0x0A, 0xF9, 0x2F, 0xC9, 0x0A, 0xFA, 0x2A, 0xF9,
+    0x00, 0x49, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9,
+    0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09,
+    0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x09, 0xAA, 0xAA,
+    0xA9, 0x94, 0xAF, 0xF9, 0x2A, 0xFF, 0xC9, 0x1E, 0x92, 0x9E, 0x1E, 0x93, 0xAD, 0x90, 0xE9, 0x3A,
+    0xDA, 0x0E, 0x92, 0x9E, 0xA0, 0xFF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0x91, 0xFF, 0xC2, 0x9F, 0xA9,
+    0x94, 0x9E, 0xA7, 0x9E, 0xA7, 0x9F, 0x79, 0xF7, 0xAF, 0x7A, 0xF7, 0x77, 0x79, 0xFC, 0x97, 0x19,
+    0xFF, 0xC9, 0x69, 0xFF, 0xE9, 0x49, 0xF9, 0x2A, 0xF4, 0xF9, 0x49, 0xEA, 0x29, 0xEA, 0x6F, 0x2A,
+    0xE7, 0x9E, 0x91, 0xF7, 0x0E, 0x91, 0xF7, 0x0E, 0xA1, 0xF7, 0x0E, 0xA1, 0xF7, 0x0E, 0x91, 0xAE,
+    0x3A, 0xA1, 0x9E, 0x91, 0x9F, 0x2F, 0xF3, 0xFF, 0xFD, 0xA3, 0xAF, 0xFF, 0xC5, 0xFF, 0xFA, 0x6F,
+    0xFE, 0x97, 0x9A, 0xFF, 0xC9, 0x73, 0xAF, 0xD9, 0x73, 0xAF, 0xD7, 0x4A, 0xAA, 0xAA, 0xAA, 0x00,
+    0x0A, 0xFD, 0xA5, 0xAF, 0xFA, 0x3A, 0xD9, 0x99, 0x9E, 0x3A, 0xD4, 0xDA, 0x2E, 0x4E, 0x2E, 0x4E,
+    0x2E, 0x4E, 0x2E, 0x99, 0x99, 0xEA, 0x2F, 0xFD, 0x3F, 0xFC, 0x93, 0xFF, 0xD3, 0xF9, 0x09, 0xEA,
+    0x19, 0xF2, 0xAE, 0x19, 0xF2, 0xAE, 0x90, 0x9F, 0x2A, 0xEA, 0x09, 0xF2, 0xAF, 0x0A, 0xF2, 0xAF,
+    0x99, 0xF2, 0xAF, 0xA0, 0x4A, 0xAF, 0xAA, 0x59, 0xFF, 0xC5, 0xFF, 0xC9, 0x4A, 0xEA, 0x29, 0xA5,
+    0xEA, 0x73, 0xEA, 0x73, 0xF9, 0x72, 0xAF, 0xCA, 0x97, 0x0F, 0xFC, 0x96, 0xFF, 0xD7, 0xAF, 0xF7,
+    0x19, 0xFC, 0xA7, 0x2A, 0xEA, 0x19, 0xCA, 0x94, 0xAF, 0x1F, 0xCA, 0xA9, 0xAF, 0xA0, 0xFF, 0xFD,
+    0x09, 0xFF, 0xFC, 0x39, 0xAF, 0xDA, 0xA7, 0x73, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0xAF, 0x49,
+    0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49,
+    0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA,
+    0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF,
+    0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x9E, 0x70, 0xAE, 0x1E, 0xA7, 0xEA, 0x1F, 0x69,
+    0xE9, 0x1A, 0xE9, 0x5F, 0x29, 0xEA, 0x49, 0xF3, 0xF4, 0xAE, 0x93, 0xAE, 0xA3, 0xF4, 0x9F, 0x2A,
+    0xF5, 0xF9, 0x1F, 0x95, 0xAE, 0xA0, 0x9F, 0x69, 0xF0, 0xFC, 0x7F, 0xFC, 0xA7, 0xFF, 0xC7, 0x09,
+    0xFF, 0x71, 0xFE, 0xA7, 0x1F, 0xE7, 0x2A, 0xFD, 0x73, 0xFC, 0xA5, 0x9A, 0xAA, 0x97, 0x5A, 0xAA,
+    0xA0, 0x9F, 0x75, 0xF1, 0xF7, 0x49, 0xF1, 0xF9, 0x73, 0xAE, 0xA1, 0xFA, 0x73, 0xF9, 0x1A, 0xF3,
+    0xAD, 0x93, 0xF2, 0x9F, 0x3F, 0x29, 0xF3, 0xF9, 0x1A, 0xF9, 0x1A, 0xEA, 0x3F, 0x91, 0xFD, 0x1F,
+    0x93, 0xAE, 0xA0, 0xAF, 0xD9, 0x0F, 0x49, 0xF0, 0xFF, 0x9F, 0x49, 0xFF, 0xFC, 0xAE, 0xA5, 0xFF,
+    0xAA, 0xFE, 0x95, 0xFF, 0x1F, 0xE6, 0xAF, 0xE1, 0xFE, 0x69, 0xFD, 0x91, 0x9F, 0xCA, 0x7F, 0xD3,
+    0xFC, 0x97, 0xFC, 0xA3, 0xFC, 0x40, 0x0A, 0xE6, 0x9E, 0x2E, 0xA5, 0xE9, 0x29, 0xE9, 0x3F, 0x4F,
+    0x29, 0xE9, 0x49, 0xF1, 0xEA, 0x6A, 0xE9, 0xF7, 0x0F, 0xE9, 0x70, 0xAF, 0xD7, 0x2F, 0xC9, 0x72,
+    0xAF, 0x72, 0x9F, 0xD7, 0x1F, 0xEA, 0x7F, 0xFC, 0x69, 0xF9, 0xFC, 0x5F, 0xA0, 0x9F, 0xA3, 0xFC,
+    0x2F, 0xC9, 0x1A, 0xF9, 0x3F, 0xC0, 0x9F, 0xC4, 0xAF, 0xA0, 0x9E, 0x96, 0xF1, 0xF5, 0x9E, 0x91,
+    0x9E, 0x94, 0xF3, 0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE, 0x90, 0xF7, 0xFA,
+    0xEA, 0x7A, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x3F,
+    0x97, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0x09, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0xC3, 0xFF, 0xFC, 0x71, 0xAF, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x09,
+    0xFD, 0x70, 0x9F, 0xD9, 0x79, 0xFD, 0xA7, 0x9F, 0xDA, 0x79, 0xFE, 0x70, 0xFE, 0xAA, 0xAA, 0xAA,
+    0x91, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFE, 0x00, 0x09, 0xAA,
+    0xAA, 0xA9, 0x0A, 0xFC, 0xA0, 0xAF, 0xCA, 0x0A, 0xD9, 0x3A, 0xD9, 0x3E, 0x93, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3, 0x9E, 0x39, 0xE3, 0x9D, 0xA3, 0x9D, 0xA3, 0x9D, 0xA3, 0xAD,
+    0xA3, 0xAD, 0xA3, 0xAD, 0xA3, 0xAD, 0x93, 0xAD, 0x93, 0xAD, 0x93, 0xFA, 0xAA, 0x0F, 0xE0, 0xFE,
+    0x0F, 0xE7, 0x00, 0x79, 0x95, 0xAC, 0x5A, 0xC5, 0xDA, 0x4E, 0x49, 0xD9, 0x4D, 0xA4, 0xE4, 0xAD,
+    0x93, 0x9E, 0x4E, 0x4A, 0xDA, 0x39, 0xE4, 0xE9, 0x3A, 0xDA, 0x39, 0xE4, 0xE9, 0x3E, 0xA3, 0xAD,
+    0x94, 0xD5, 0xCA, 0x5A, 0x71, 0xAA, 0xAA, 0xAA, 0x1F, 0xD9, 0x0F, 0xD9, 0x3A, 0xD9, 0x3A, 0xDA,
+    0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xDA, 0x39, 0xE3, 0x9E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+    0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x93, 0xE9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xD9, 0x3A, 0xDA, 0x0A,
+    0xAA, 0xEA, 0x0F, 0xDA, 0x0F, 0xDA, 0x0F, 0xDA, 0x70, 0x77, 0x0D, 0x97, 0xAE, 0x6A, 0xFC, 0x4E,
+    0xA9, 0xE2, 0xE3, 0xAD, 0x00, 0x77, 0x0F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD7, 0x70, 0x0E,
+    0x95, 0xEA, 0x5E, 0xA5, 0x9A, 0xAA, 0x00, 0x76, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA,
+    0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0,
+    0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA0, 0xAA, 0xA9, 0x70, 0xAD,
+    0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0x9D, 0x97, 0x09, 0xD9, 0xAE, 0xA3, 0x9F,
+    0xFC, 0x29, 0xFF, 0xCA, 0x2F, 0x91, 0x9D, 0x2E, 0xA3, 0xDA, 0x1E, 0x93, 0xAD, 0x1E, 0x93, 0xAD,
+    0x1E, 0xA2, 0x9E, 0x1F, 0xCA, 0xAF, 0x1A, 0xFF, 0xC9, 0x19, 0xFF, 0xC3, 0xAF, 0xD9, 0x69, 0x99,
+    0x50, 0x75, 0x9A, 0xEA, 0x3F, 0xE2, 0xAF, 0xAD, 0x19, 0xE6, 0xAD, 0xA6, 0xAD, 0x96, 0xE9, 0x6A,
+    0xDA, 0x69, 0xE9, 0x19, 0x3F, 0xEA, 0x29, 0xFE, 0xA3, 0xAA, 0xEA, 0x10, 0x70, 0xE7, 0x1E, 0x71,
+    0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x39, 0xEA, 0x0E, 0x2A, 0xFF, 0xC1, 0xAF, 0xFD, 0x1E, 0x2F, 0xA0,
+    0x9D, 0x39, 0xEA, 0x0A, 0xD4, 0xEA, 0x0E, 0x4E, 0xA0, 0xAD, 0x92, 0xAE, 0xA0, 0x9F, 0xFD, 0xA1,
+    0xFF, 0xDA, 0x2F, 0xFC, 0xA3, 0xAE, 0xA9, 0xE0, 0x29, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1,
+    0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA,
+    0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9, 0x29, 0xAF, 0xA1, 0x29, 0xF2, 0x9F, 0xC2, 0xFA,
+    0xA2, 0xE5, 0xDA, 0x3F, 0xF0, 0xFF, 0x0F, 0xF2, 0xE5, 0xE5, 0xE4, 0x9E, 0x49, 0xE4, 0x9E, 0x93,
+    0x9E, 0x93, 0x9E, 0x93, 0x9E, 0x92, 0x2A, 0xE9, 0x9D, 0xA1, 0xFF, 0xCA, 0x0E, 0xAA, 0xFC, 0xA9,
+    0xD9, 0x2F, 0xAA, 0xCA, 0x3A, 0xEA, 0xAC, 0xA3, 0x9E, 0x9D, 0x93, 0x9E, 0x9A, 0xCA, 0x39, 0xE9,
+    0xAD, 0x91, 0x9F, 0x99, 0xFF, 0xD9, 0x0F, 0xFD, 0x91, 0xFF, 0xC3, 0xAE, 0xAE, 0x70, 0xE1, 0x9A,
+    0x29, 0xEA, 0x1F, 0xFC, 0x2F, 0xF9, 0x19, 0xFE, 0xA6, 0x99, 0x94, 0x0A, 0xD9, 0x70, 0xAD, 0x97,
+    0x0A, 0xD9, 0x70, 0xE9, 0x70, 0xE7, 0x1E, 0x71, 0xE9, 0xF9, 0x3F, 0xFC, 0xA2, 0xFC, 0xAF, 0x2E,
+    0xA2, 0x9D, 0x90, 0x9E, 0x4D, 0xA0, 0x9E, 0x4D, 0xA0, 0x9E, 0x4E, 0x0A, 0xE4, 0xE0, 0xAE, 0x39,
+    0xE0, 0xAE, 0x3A, 0xE0, 0xAE, 0x92, 0xAE, 0x0F, 0x92, 0xF0, 0x0A, 0xDA, 0x1E, 0xA1, 0xF1, 0xF1,
+    0xAA, 0xAA, 0x75, 0x9A, 0xA2, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91, 0xAD,
+    0x91, 0xAD, 0x91, 0xAD, 0x91, 0xAD, 0xA1, 0xEA, 0x1F, 0x00, 0x39, 0x99, 0x4D, 0xA4, 0xE3, 0x9E,
+    0x77, 0x74, 0x99, 0x94, 0xDA, 0x4D, 0xA4, 0xDA, 0x39, 0xDA, 0x39, 0xD9, 0x39, 0xD9, 0x39, 0xD9,
+    0x39, 0xD9, 0x39, 0xD4, 0xAD, 0x4A, 0xD4, 0xE3, 0x9E, 0x19, 0xFC, 0x19, 0xFA, 0x1A, 0xF7, 0x20,
+    0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE0, 0xAD, 0xA4,
+    0xDA, 0xAE, 0x49, 0xFD, 0x59, 0xFC, 0x95, 0x9F, 0xA6, 0x9F, 0xC9, 0x5A, 0xFD, 0xA4, 0xAF, 0xEA,
+    0x3A, 0xDA, 0x9F, 0xA2, 0xAE, 0x0A, 0xFC, 0x1F, 0x1F, 0xD0, 0x0E, 0x3E, 0x3E, 0x3D, 0xA2, 0x9D,
+    0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD,
+    0x92, 0xAD, 0x92, 0xE9, 0x2F, 0xCA, 0x0F, 0xD0, 0xFD, 0x00, 0x77, 0x49, 0xDA, 0xAE, 0x91, 0x9E,
+    0x93, 0xAF, 0xFA, 0x9F, 0xCA, 0x2A, 0xFA, 0xAF, 0xCA, 0xAE, 0x91, 0xF2, 0x9E, 0xA2, 0xE1, 0xEA,
+    0x3E, 0x92, 0xE1, 0xE9, 0x3E, 0x3E, 0x1E, 0x92, 0x9E, 0x3E, 0x09, 0xE9, 0x2A, 0xE3, 0xE0, 0x9E,
+    0x3E, 0xA2, 0x9E, 0x0A, 0xE3, 0xEA, 0x29, 0xE9, 0xAE, 0x3E, 0x92, 0x9E, 0x9F, 0x29, 0xE9, 0x2A,
+    0xE9, 0x74, 0xDA, 0x9E, 0xA3, 0xFF, 0xC9, 0x1F, 0xCA, 0xF1, 0xE9, 0x2A, 0xD0, 0x9E, 0x39, 0xD9,
+    0x9D, 0xA3, 0x9D, 0x99, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xAA, 0xE3, 0xEA, 0xAE, 0x3F, 0xAE, 0x3F,
+    0xF3, 0xF0, 0x29, 0xAD, 0xA9, 0x4F, 0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA,
+    0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF,
+    0x49, 0xAD, 0xA9, 0x20, 0x69, 0x95, 0x9D, 0xAA, 0xFA, 0x39, 0xFF, 0xD3, 0xFC, 0x19, 0xD9, 0x2F,
+    0x39, 0xD2, 0xF4, 0xD2, 0xF4, 0xD2, 0xF4, 0xD9, 0x1F, 0x39, 0xD2, 0xFC, 0xA9, 0xAE, 0x19, 0xFF,
+    0xDA, 0x19, 0xFF, 0xD2, 0xAF, 0xFC, 0x3E, 0xA0, 0x9A, 0xA9, 0x4E, 0xA7, 0x1E, 0x97, 0x09, 0xE7,
+    0x1A, 0xE7, 0x1A, 0xDA, 0x71, 0x77, 0x1A, 0xE9, 0x0D, 0xA4, 0xFF, 0xCA, 0x3A, 0xDA, 0xAF, 0xCA,
+    0x29, 0xD3, 0xF9, 0x2A, 0xD3, 0x9E, 0x92, 0xAC, 0xA3, 0x9E, 0x92, 0xDA, 0x4E, 0x3A, 0xCA, 0x39,
+    0xE3, 0xAD, 0x92, 0xF3, 0x9F, 0xFD, 0x4F, 0xFD, 0x5F, 0xFC, 0x6A, 0xEA, 0xE0, 0x9C, 0x70, 0xFD,
+    0x70, 0xFD, 0x70, 0xFC, 0xA7, 0x0D, 0xA9, 0x72, 0x95, 0x0A, 0xDA, 0xAD, 0x90, 0xAF, 0xDA, 0x0F,
+    0xEA, 0x0F, 0x93, 0xEA, 0x4E, 0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x39, 0xEA, 0x3A, 0xF3, 0xAF, 0x30,
+    0x76, 0xAF, 0xCA, 0x3F, 0xF3, 0xD9, 0x29, 0x93, 0xD9, 0x70, 0xAE, 0xA9, 0x6A, 0xFD, 0x69, 0xAF,
+    0x70, 0xEA, 0x1D, 0xA9, 0x99, 0xEA, 0x0F, 0xFD, 0x9A, 0xFF, 0xCA, 0x2A, 0xAF, 0xA7, 0x60, 0x76,
+    0x9C, 0xA6, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x94, 0xFF, 0xA0, 0x9F, 0xFC, 0x09, 0xAA, 0xEA, 0xAA,
+    0xA3, 0xE9, 0x6E, 0x7E, 0x7E, 0x7E, 0x7E, 0x96, 0xFD, 0xA3, 0xFE, 0x3A, 0xFD, 0x73, 0xE4, 0xE0,
+    0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9,
+    0x9E, 0x29, 0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0xAD,
+    0xA6, 0xE1, 0xE5, 0xAD, 0xA1, 0xAD, 0xA4, 0xE3, 0xE3, 0xAD, 0xA3, 0xEA, 0x2E, 0x93, 0x9E, 0x90,
+    0xAE, 0x5F, 0x0E, 0x95, 0x9F, 0xE7, 0xFD, 0xA7, 0xAF, 0xC7, 0x09, 0xFC, 0x71, 0xFC, 0x40, 0xAD,
+    0xA7, 0x09, 0xE9, 0xE7, 0x0E, 0xA0, 0xE3, 0x99, 0x2E, 0x90, 0xE9, 0x1E, 0x19, 0xE1, 0xAD, 0xA0,
+    0xAE, 0xA0, 0xAD, 0xA1, 0x9E, 0x0F, 0xC0, 0xE9, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3A, 0xFF, 0xEA,
+    0x39, 0xFC, 0xAF, 0xC9, 0x4F, 0xC0, 0xFC, 0x5F, 0x90, 0x9F, 0x59, 0xAA, 0x92, 0x9A, 0xA9, 0x20,
+    0x1E, 0x93, 0xE3, 0x9E, 0x91, 0xE9, 0x4A, 0xE0, 0xEA, 0x6F, 0xE7, 0x9F, 0xC9, 0x70, 0xAE, 0xA7,
+    0x1F, 0xC7, 0x0F, 0xE6, 0xFA, 0xEA, 0x4A, 0xEA, 0x0F, 0x92, 0xAF, 0x2F, 0x19, 0xF3, 0xAF, 0x00,
+    0xAE, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xAE, 0x3E, 0x92, 0xE9, 0x2E, 0x3A, 0xE1, 0x9D, 0xA4, 0xEA,
+    0x0E, 0x94, 0xAE, 0x9E, 0x6F, 0xDA, 0x6A, 0xFC, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x09,
+    0xE7, 0x1F, 0x59, 0xAA, 0xFA, 0x5A, 0xFD, 0x6A, 0xFC, 0x96, 0xAE, 0xA7, 0x1F, 0xFD, 0x2F, 0xFD,
+    0x29, 0xAA, 0xAA, 0xFA, 0x69, 0xEA, 0x69, 0xF6, 0x9F, 0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0x9F, 0xFD,
+    0x1A, 0xFF, 0xD9, 0x0A, 0xFF, 0xE0, 0x49, 0xFA, 0x3A, 0xFC, 0x93, 0xFA, 0xA4, 0xE9, 0x59, 0xE6,
+    0x9E, 0x69, 0xE6, 0xAE, 0x4F, 0xCA, 0x4F, 0xC5, 0xFC, 0x59, 0x9E, 0xA6, 0xEA, 0x6E, 0xA6, 0xEA,
+    0x6E, 0xA6, 0xF6, 0xAF, 0xC9, 0x39, 0xFC, 0xA4, 0x9F, 0xA7, 0x30, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0,
+    0xDA, 0x0D, 0xA0, 0xD9, 0x0D, 0x90, 0xD9, 0x0D, 0x90, 0xD9, 0x9D, 0x99, 0xD9, 0x9D, 0x99, 0xD0,
+    0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x00, 0x0F, 0xA5, 0xAF, 0xC4, 0x9A, 0xAE, 0xA6, 0xAE,
+    0x6A, 0xE6, 0x9E, 0x69, 0xE6, 0x9E, 0x7F, 0xCA, 0x5F, 0xA4, 0x9F, 0xA4, 0xF9, 0x5E, 0x96, 0xE9,
+    0x6E, 0x96, 0xEA, 0x6E, 0x93, 0xFD, 0x93, 0xFD, 0x4F, 0xC7, 0x60, 0x0A, 0xCA, 0x09, 0xC9, 0x9E,
+    0xA9, 0xCA, 0xAC, 0x9D, 0x9C, 0xAD, 0x09, 0xE0, 0x9A, 0x19, 0xA9, 0x00, 0x9F, 0xC1, 0xFC, 0x1F,
+    0xC1, 0xAF, 0x1A, 0xEA, 0x19, 0xAA, 0xA9, 0x77, 0x77, 0x09, 0x4A, 0xC3, 0xAD, 0x92, 0xE9, 0x2E,
+    0x92, 0xE9, 0x2E, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0x9D, 0x92, 0x9D, 0x92, 0x9D, 0x93,
+    0xD9, 0x3C, 0xA4, 0xA7, 0x10, 0x49, 0x97, 0x0D, 0x70, 0xD7, 0x0D, 0x69, 0xFA, 0x3F, 0xE2, 0xFD,
+    0xAC, 0x19, 0xE0, 0xD3, 0xAD, 0xA0, 0xD3, 0xAD, 0x90, 0xCA, 0x3E, 0x90, 0xCA, 0x3A, 0xDA, 0x0C,
+    0xA3, 0xAE, 0x9C, 0xA9, 0x3F, 0xEA, 0x29, 0xFE, 0xA3, 0xAF, 0xA9, 0x5C, 0xA7, 0x0C, 0xA7, 0x9C,
+    0xA7, 0x60, 0x77, 0x19, 0xAE, 0xA6, 0xAF, 0xE9, 0x3A, 0xEA, 0x9A, 0xE3, 0xAD, 0x4A, 0x93, 0xAC,
+    0xA7, 0x29, 0xD7, 0x3D, 0x97, 0x2D, 0xA7, 0x2A, 0xD7, 0x0F, 0xFD, 0x92, 0xFF, 0xD9, 0x5A, 0xD7,
+    0x2A, 0xD7, 0x19, 0xE7, 0x9F, 0xC7, 0xFF, 0xCA, 0xA2, 0xFF, 0xEA, 0x1F, 0xFF, 0x90, 0x71, 0x95,
+    0xC9, 0x3D, 0x93, 0xFF, 0xD2, 0x9F, 0xFD, 0x39, 0xFF, 0x93, 0xAD, 0xA1, 0xE9, 0x3A, 0xD9, 0x1A,
+    0xDA, 0x3A, 0xE1, 0xEA, 0x3A, 0xFF, 0x92, 0x9F, 0xFD, 0x91, 0xFF, 0xF2, 0xDA, 0x9A, 0x99, 0xAD,
+    0x49, 0x59, 0x20, 0x09, 0x99, 0x79, 0x99, 0x1A, 0xE5, 0xEA, 0x2F, 0x3F, 0x4F, 0x1F, 0x59, 0xFF,
+    0x96, 0xAF, 0xDA, 0x70, 0xFD, 0x72, 0xF7, 0x0F, 0xFC, 0x59, 0xFF, 0xCA, 0x4A, 0xAA, 0xAF, 0xCA,
+    0xA7, 0x0E, 0xA7, 0x3F, 0xAA, 0x6F, 0xFC, 0x94, 0x9F, 0xFD, 0x4A, 0xAA, 0xAE, 0xA7, 0x29, 0xEA,
+    0x72, 0x9E, 0xA7, 0x75, 0x0A, 0xC0, 0xD0, 0xD9, 0xD9, 0xD9, 0xD9, 0xA9, 0x71, 0xCA, 0xAC, 0xAA,
+    0xCA, 0xAC, 0xAA, 0xCA, 0xAC, 0x9A, 0xC9, 0xAC, 0x92, 0x77, 0xFC, 0x5F, 0xE9, 0x29, 0xD2, 0xAC,
+    0x92, 0xAD, 0x3A, 0x39, 0xFA, 0x95, 0xFE, 0x3F, 0xFA, 0x2D, 0x92, 0xE1, 0x9D, 0xA9, 0x99, 0xE2,
+    0xFF, 0xC2, 0xAF, 0xE9, 0x39, 0xFD, 0x79, 0xF2, 0x94, 0xE1, 0x9E, 0xA9, 0xAE, 0x1F, 0xFC, 0x91,
+    0x9A, 0xFC, 0xA7, 0x60, 0x0E, 0x91, 0xE1, 0xEA, 0x09, 0xE1, 0xEA, 0x0A, 0xE9, 0x9F, 0x0A, 0xEA,
+    0x9A, 0xAA, 0xA0, 0x9A, 0xAA, 0x90, 0x2A, 0xDA, 0x39, 0xFD, 0x2D, 0x91, 0x9D, 0x09, 0xCA, 0x9D,
+    0x0A, 0xC9, 0x9C, 0x9C, 0x91, 0x9C, 0x99, 0xCA, 0x9D, 0x0A, 0xC9, 0x0D, 0x91, 0x9D, 0x19, 0xFD,
+    0x93, 0xAD, 0xA2, 0x70, 0xAC, 0xAC, 0x1A, 0xC9, 0xAC, 0x90, 0xC9, 0x1C, 0x90, 0xC2, 0xCA, 0x0F,
+    0xCA, 0x1E, 0xAA, 0x77, 0x0A, 0x92, 0xC4, 0xAC, 0x91, 0xD3, 0xE0, 0x9E, 0x19, 0xE9, 0xAE, 0x19,
+    0xE0, 0xAD, 0xA2, 0xAD, 0xA0, 0xE9, 0x29, 0xEA, 0xAE, 0x92, 0x9E, 0xAA, 0xE9, 0x29, 0xE0, 0xAD,
+    0xA4, 0xCA, 0x1A, 0xC9, 0x59, 0x29, 0x10, 0xEA, 0xAA, 0x99, 0x91, 0xFF, 0xD9, 0xFF, 0xD9, 0x59,
+    0xE9, 0x6E, 0xA6, 0xEA, 0x6A, 0xDA, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD, 0x9F, 0xFD,
+    0x90, 0x29, 0xAA, 0x94, 0xFD, 0x2F, 0xAA, 0xD0, 0x9C, 0xAA, 0x09, 0x9A, 0xC9, 0x9C, 0x9A, 0xD9,
+    0x9C, 0x99, 0xCA, 0xAA, 0xA9, 0x9C, 0x90, 0xEA, 0xAE, 0x19, 0xFD, 0x93, 0xAD, 0xA2, 0x73, 0xFE,
+    0x1A, 0xFE, 0x97, 0x10, 0x39, 0x95, 0xAF, 0xA2, 0xAF, 0xDA, 0x1E, 0x1E, 0x09, 0xDA, 0x19, 0xD9,
+    0x9E, 0x1E, 0x90, 0xFF, 0x19, 0xFD, 0x92, 0x9F, 0x97, 0x30, 0x59, 0x97, 0x0A, 0xD7, 0x0A, 0xD7,
+    0x0A, 0xD4, 0xFF, 0xE0, 0xFF, 0xE4, 0xAD, 0x97, 0xAD, 0x70, 0xAD, 0x70, 0x9A, 0xA7, 0x09, 0x99,
+    0x99, 0x91, 0x9F, 0xFC, 0x1F, 0xFD, 0x97, 0x30, 0x0A, 0xDA, 0x1C, 0x99, 0xC9, 0x3C, 0xA3, 0xC9,
+    0x19, 0xD1, 0x9D, 0x91, 0xFC, 0x0A, 0xAA, 0xA9, 0x0A, 0xE2, 0x99, 0x0A, 0xC4, 0xAC, 0x2E, 0x92,
+    0x99, 0xD1, 0x91, 0xAC, 0x1F, 0xC1, 0xAE, 0x90, 0x19, 0xD2, 0xDA, 0x19, 0xD9, 0x1E, 0x29, 0x92,
+    0x0E, 0x4E, 0x1E, 0x4E, 0x99, 0xE4, 0xE9, 0x9E, 0x4E, 0x99, 0xE4, 0xE9, 0x9E, 0x93, 0xE9, 0x9E,
+    0x93, 0xE9, 0x9F, 0x29, 0xE9, 0xAF, 0xCA, 0x9F, 0xAA, 0xFF, 0xEA, 0xAF, 0xFE, 0xAA, 0xD9, 0xFA,
+    0xEA, 0xAD, 0x71, 0xAD, 0x72, 0x97, 0x20, 0x1A, 0xEA, 0x0D, 0xA1, 0xFC, 0xA0, 0xE0, 0xAF, 0xCA,
+    0x0E, 0x0F, 0xD9, 0x0E, 0x0F, 0xD9, 0x0E, 0x0A, 0xFC, 0x90, 0xE1, 0xFC, 0x1E, 0x2F, 0x1E, 0x2A,
+    0xE1, 0xE2, 0xF1, 0xE2, 0xF1, 0xE2, 0xF1, 0xAD, 0x19, 0xF1, 0xAD, 0x1A, 0xEA, 0x1A, 0xD1, 0xFA,
+    0x1A, 0xD1, 0xFA, 0x1A, 0xD1, 0xFA, 0x1A, 0xD0, 0x9F, 0x91, 0xAD, 0x00, 0x0E, 0x90, 0xEA, 0x0E,
+    0xA9, 0xF9, 0xAA, 0xAA, 0x1A, 0xA3, 0xCA, 0x2A, 0xDA, 0x1C, 0xAD, 0xA2, 0x9C, 0xA0, 0xAE, 0x90,
+    0xEA, 0x00, 0x1A, 0xC2, 0xAD, 0x3A, 0xC3, 0xAC, 0x3A, 0xC3, 0xD2, 0xFA, 0x0A, 0xAA, 0xA9, 0x1A,
+    0xDA, 0x1A, 0xC9, 0xAC, 0xA0, 0xCA, 0x1D, 0x0D, 0x1D, 0x0A, 0xFA, 0x1E, 0xA7, 0x73, 0xA9, 0x2C,
+    0x5A, 0xC9, 0x1D, 0x4A, 0xDA, 0x0E, 0x93, 0xAE, 0x0E, 0x93, 0x9E, 0x0A, 0xDA, 0x3E, 0x99, 0xE2,
+    0xFA, 0xEA, 0x1F, 0xAE, 0xA1, 0x9E, 0x0A, 0xDA, 0x3D, 0x19, 0xC9, 0x4A, 0x39, 0x40, 0x29, 0x97,
+    0x6A, 0xE7, 0x09, 0x93, 0xF7, 0x9D, 0x92, 0x99, 0xD7, 0xDA, 0x49, 0xD6, 0xAD, 0x59, 0xD6, 0xDA,
+    0x59, 0xD5, 0xE6, 0x9D, 0x49, 0xD9, 0x59, 0xAD, 0x99, 0x2E, 0x19, 0xA1, 0x9F, 0xD1, 0xAD, 0x91,
+    0xD9, 0x09, 0xFD, 0x09, 0xE1, 0xE9, 0x70, 0xE1, 0xAC, 0xAC, 0x97, 0x9D, 0xA0, 0x9C, 0x9A, 0xC9,
+    0x7E, 0x1D, 0x0A, 0xC9, 0x6A, 0xDA, 0x0A, 0xCA, 0xAE, 0xA4, 0x9E, 0x1F, 0xF4, 0xE9, 0x19, 0x99,
+    0x9E, 0x93, 0xAE, 0x6D, 0xA4, 0xE9, 0x6D, 0xA3, 0x9A, 0xA9, 0x73, 0x29, 0x97, 0x70, 0xAE, 0x70,
+    0x99, 0x5F, 0x79, 0xD9, 0x49, 0x9D, 0x7D, 0xA6, 0x9D, 0x6A, 0xD7, 0x9D, 0x6D, 0xA7, 0x9D, 0x5E,
+    0x70, 0x9D, 0x49, 0xD9, 0x79, 0xAD, 0x99, 0x2E, 0x09, 0xAD, 0xA1, 0x9F, 0xD1, 0xAD, 0x99, 0xFD,
+    0x09, 0xFD, 0x09, 0xDA, 0x09, 0xC9, 0x1D, 0x97, 0xE6, 0x9C, 0xA6, 0xAD, 0xA6, 0xAC, 0xA6, 0xE6,
+    0x9D, 0x95, 0xE9, 0x5A, 0xE5, 0x9E, 0x5F, 0x6E, 0x94, 0xFA, 0x99, 0x3A, 0xDA, 0x5F, 0xE3, 0xE5,
+    0x9F, 0xE3, 0x99, 0x97, 0x50, 0x09, 0xF9, 0x74, 0xDA, 0xE9, 0x5A, 0xA9, 0x7C, 0xA4, 0xAD, 0x70,
+    0xCA, 0x39, 0xD9, 0x49, 0xF4, 0xE5, 0xFC, 0x3A, 0xD9, 0x70, 0xAD, 0x2D, 0xA5, 0x99, 0x19, 0xD1,
+    0xE6, 0xFE, 0x09, 0xDA, 0x1D, 0x2F, 0xD9, 0x0E, 0x1A, 0xD9, 0x19, 0xAD, 0xA9, 0x0A, 0xD9, 0x09,
+    0xE9, 0x79, 0xE1, 0xCA, 0xAC, 0x97, 0xE1, 0xD0, 0xAC, 0x96, 0xAD, 0xA0, 0xAC, 0xA9, 0xDA, 0x95,
+    0xE1, 0xFF, 0x4E, 0x91, 0x9A, 0xAA, 0xEA, 0x39, 0xE6, 0xDA, 0x4E, 0x96, 0xDA, 0x39, 0xAA, 0x97,
+    0x30, 0x4F, 0xA7, 0xAE, 0x97, 0xAE, 0x70, 0x9E, 0x71, 0xAA, 0x97, 0x77, 0x77, 0x70, 0x9D, 0x70,
+    0xF7, 0x0E, 0xA7, 0x0E, 0xA7, 0xAE, 0xA6, 0xFC, 0x95, 0xFA, 0x95, 0xAE, 0x70, 0xE9, 0x70, 0xE7,
+    0x1E, 0x71, 0xE7, 0x1E, 0x59, 0x91, 0xAE, 0x39, 0xD9, 0x1F, 0xAF, 0xCA, 0x2F, 0xF9, 0x49, 0xAE,
+    0x97, 0x70, 0x39, 0xAA, 0xA7, 0x6A, 0xE7, 0x6A, 0xE9, 0x75, 0x9E, 0xA7, 0x77, 0x77, 0x70, 0xAE,
+    0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA, 0x71, 0xE9, 0x0E,
+    0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5, 0xFF, 0xF5, 0xFF,
+    0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59, 0xF1, 0xF7, 0xF9,
+    0x71, 0x97, 0x7D, 0x97, 0x59, 0xD7, 0x6D, 0xA7, 0x59, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x7A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E,
+    0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF,
+    0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F,
+    0x7F, 0x90, 0x77, 0x71, 0xAD, 0x75, 0x9E, 0xA7, 0x39, 0xFC, 0xA7, 0x19, 0xE0, 0xAD, 0xA7, 0x9D,
+    0x92, 0x9D, 0xA7, 0x77, 0x77, 0x5A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97,
+    0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9,
+    0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59,
+    0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90, 0x77, 0x7A, 0xD1, 0xCA, 0x71, 0x9F, 0x0D, 0x71, 0xAC,
+    0x9A, 0xEA, 0x71, 0xAC, 0x90, 0xAD, 0x77, 0x77, 0x77, 0x0A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A,
+    0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1,
+    0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF,
+    0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90, 0x4E, 0x19, 0xE7, 0x9E, 0x1A,
+    0xE7, 0xAE, 0x90, 0xF7, 0xAE, 0xA0, 0xF7, 0x9A, 0xAA, 0x90, 0xAA, 0xAA, 0x77, 0x77, 0x76, 0xAE,
+    0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA, 0x71, 0xE9, 0x0E,
+    0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5, 0xFF, 0xF5, 0xFF,
+    0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59, 0xF1, 0xF7, 0xF9,
+    0x69, 0xDA, 0x75, 0xF9, 0x74, 0xDA, 0xCA, 0x74, 0xF9, 0x74, 0x9D, 0xA7, 0x77, 0x77, 0x71, 0xAE,
+    0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA, 0x71, 0xE9, 0x0E,
+    0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5, 0xFF, 0xF5, 0xFF,
+    0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59, 0xF1, 0xF7, 0xF9,
+    0x71, 0x9A, 0xA0, 0xAA, 0xAA, 0xFE, 0x97, 0x09, 0xEA, 0xFF, 0xE7, 0x1F, 0xFF, 0xEA, 0x70, 0x9F,
+    0xF9, 0x77, 0xFF, 0xC7, 0x7A, 0xDA, 0xAF, 0xC7, 0x7E, 0x0A, 0xFC, 0x76, 0xAD, 0xA0, 0x9F, 0xFE,
+    0x70, 0xE2, 0xFF, 0xE7, 0xAD, 0xA2, 0xFF, 0xE6, 0x9E, 0x3F, 0xC9, 0x97, 0x2F, 0xFF, 0xC7, 0x39,
+    0xFF, 0xFC, 0x73, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xA9, 0x29, 0xFF, 0xFF, 0xFD, 0x2F, 0x6F, 0xFF,
+    0x1A, 0xEA, 0x6F, 0xFF, 0x90, 0xF7, 0xFF, 0xFA, 0x77, 0x71, 0x77, 0x69, 0xAF, 0xCA, 0x59, 0xFF,
+    0xC4, 0xAF, 0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x70, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F,
+    0x72, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0xA9, 0x29, 0xAA, 0x2F, 0xFF, 0xA2, 0xAF,
+    0xFF, 0x3F, 0xFF, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x70, 0x9C, 0x97, 0x4A, 0xDA, 0x73, 0xCA, 0xDA,
+    0x72, 0xF9, 0x72, 0xEA, 0x77, 0x30, 0x1A, 0xAA, 0x71, 0x9E, 0x97, 0x09, 0xEA, 0x71, 0xF7, 0x77,
+    0x77, 0x3A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70,
+    0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x59,
+    0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1E, 0x71, 0x99, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xAA, 0xAF, 0xE9,
+    0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F,
+    0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90,
+    0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x5D, 0x71, 0xEA, 0x7F, 0xCA, 0x5E,
+    0xAA, 0xDA, 0x3E, 0x29, 0xDA, 0x77, 0x77, 0x70, 0xAA, 0xAA, 0xFE, 0x90, 0xFF, 0xE1, 0xFF, 0xDA,
+    0x1E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9F, 0xFC, 0x29,
+    0xEA, 0x96, 0x9E, 0x97, 0x9E, 0x97, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE,
+    0x0A, 0xFF, 0xE9, 0xAF, 0xFE, 0xA0, 0x1E, 0x91, 0xE3, 0xEA, 0x09, 0xE3, 0xEA, 0x0A, 0xE9, 0x19,
+    0xF0, 0xAE, 0xA1, 0x9A, 0xAA, 0xA0, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x0A, 0xAA, 0xAF, 0xE9, 0x0F,
+    0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC,
+    0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF,
+    0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x0A, 0xAA, 0x59, 0xE9, 0x49, 0xEA, 0x49,
+    0xEA, 0x77, 0x77, 0x79, 0xE9, 0x39, 0xE9, 0x39, 0xE9, 0x39, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+    0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x93, 0x9E, 0xA3, 0x9E, 0xA3, 0x9E, 0xA3, 0xAF, 0x3A, 0xF0, 0x19,
+    0xD1, 0xD9, 0x09, 0xD1, 0xE1, 0x99, 0x77, 0x77, 0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x99, 0xEA, 0x9E, 0xA9, 0xEA, 0xAF, 0xAF, 0x4D,
+    0x70, 0xEA, 0x6F, 0xCA, 0x4E, 0xAA, 0xDA, 0x2E, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x39, 0xE9, 0x69,
+    0xE9, 0x69, 0xE9, 0x69, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE9, 0x7E, 0x97,
+    0xE9, 0x7E, 0x96, 0x9E, 0xA6, 0x9E, 0xA6, 0x9E, 0xA6, 0xAF, 0x6A, 0xF3, 0x09, 0xAA, 0x2A, 0xAA,
+    0x1E, 0x90, 0x9E, 0x1E, 0xA0, 0x9E, 0x99, 0xEA, 0x0A, 0xE9, 0xAF, 0x0F, 0xA7, 0x77, 0x77, 0x69,
+    0xE9, 0x59, 0xE9, 0x59, 0xE9, 0x59, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE9, 0x6E, 0x96, 0xE9,
+    0x6E, 0x95, 0x9E, 0xA5, 0x9E, 0xA5, 0x9E, 0xA5, 0xAF, 0x5A, 0xF2, 0x3A, 0xFF, 0xA9, 0x70, 0xAF,
+    0xFE, 0x96, 0xAF, 0xFF, 0x95, 0xAE, 0xAA, 0xAA, 0xFD, 0x5A, 0xE5, 0xAE, 0xA4, 0xAE, 0x6A, 0xE4,
+    0xAE, 0x7E, 0x93, 0xAE, 0x7E, 0x90, 0xFF, 0xD9, 0x3E, 0x90, 0xFF, 0xD9, 0x3E, 0x90, 0x99, 0x9F,
+    0xA9, 0x94, 0xE9, 0x3A, 0xE6, 0xF9, 0x3A, 0xE3, 0x9A, 0xFC, 0x4A, 0xFF, 0xFD, 0x4A, 0xFF, 0xFC,
+    0xA4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF, 0x6A, 0xFF, 0xCA, 0x93, 0x77, 0x49, 0xD9, 0x0A, 0xC7, 0x0F,
+    0x9A, 0xC7, 0x0D, 0x9F, 0x70, 0xD0, 0x9D, 0xA7, 0x77, 0x77, 0x7E, 0x19, 0xF5, 0xE1, 0x9F, 0x93,
+    0x9E, 0x19, 0xFA, 0x39, 0xE1, 0xAF, 0xC3, 0x9E, 0x1A, 0xFC, 0xA2, 0xAE, 0x1A, 0xFD, 0x2A, 0xE1,
+    0xFE, 0xA1, 0xAE, 0x1F, 0xAE, 0x1A, 0xE1, 0xF0, 0xEA, 0x0E, 0xA1, 0xF0, 0xAE, 0x0E, 0xA1, 0xF9,
+    0x0E, 0x9E, 0xA1, 0xF9, 0x0A, 0xFD, 0xA0, 0x9F, 0x90, 0x9F, 0xD9, 0x09, 0xF9, 0x1F, 0xD9, 0x09,
+    0xF9, 0x19, 0xFC, 0x90, 0xAF, 0x92, 0xFC, 0x90, 0xAF, 0xA2, 0xAF, 0x90, 0x39, 0xAA, 0x97, 0x6E,
+    0xA7, 0x6F, 0x76, 0xAE, 0x97, 0x77, 0x77, 0x69, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F,
+    0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0,
+    0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99,
+    0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD,
+    0xA9, 0x77, 0x50, 0x70, 0xD7, 0x6A, 0xD7, 0x6D, 0x97, 0x5A, 0xD7, 0x69, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x49, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95,
+    0xF9, 0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7,
+    0x09, 0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE,
+    0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x77, 0x71,
+    0xD9, 0x75, 0xAE, 0x74, 0xAF, 0xC7, 0x2A, 0xDA, 0x9E, 0x70, 0xAD, 0x3A, 0xD7, 0x77, 0x77, 0x49,
+    0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69,
+    0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE,
+    0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF,
+    0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x77, 0x7D, 0xA0, 0x9C, 0x97,
+    0x1A, 0xEA, 0x9C, 0x97, 0x1D, 0x0F, 0x97, 0x1D, 0x1E, 0x77, 0x77, 0x76, 0x9A, 0xFA, 0x71, 0xFF,
+    0xCA, 0x59, 0xFF, 0xF4, 0xFA, 0x29, 0xFA, 0x2A, 0xE9, 0x5F, 0x91, 0xF6, 0x9E, 0xA0, 0x9E, 0x97,
+    0xF0, 0xAE, 0x70, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE,
+    0xA7, 0xF0, 0x9F, 0xC9, 0x91, 0x9A, 0xFC, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x92, 0xFF, 0xFD,
+    0x4F, 0xFF, 0x69, 0xAF, 0xDA, 0x97, 0x75, 0x3A, 0xDA, 0x1E, 0x97, 0xAE, 0x1E, 0xA7, 0xF1, 0xEA,
+    0x7F, 0x09, 0xF7, 0xAA, 0xAA, 0x09, 0xAA, 0xAA, 0x77, 0x77, 0x74, 0x9A, 0xFA, 0x71, 0xFF, 0xCA,
+    0x59, 0xFF, 0xF4, 0xFA, 0x29, 0xFA, 0x2A, 0xE9, 0x5F, 0x91, 0xF6, 0x9E, 0xA0, 0x9E, 0x97, 0xF0,
+    0xAE, 0x70, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0xA7,
+    0xF0, 0x9F, 0xC9, 0x91, 0x9A, 0xFC, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x92, 0xFF, 0xFD, 0x4F,
+    0xFF, 0x69, 0xAF, 0xDA, 0x97, 0x75, 0x0A, 0xDA, 0x1A, 0xD9, 0x3F, 0xAE, 0x5F, 0xD7, 0xF9, 0x6F,
+    0xD9, 0x4F, 0xF9, 0x19, 0xF9, 0x0F, 0xA0, 0x77, 0x73, 0x97, 0x77, 0x09, 0xEA, 0x77, 0x70, 0xF7,
+    0x77, 0x0A, 0xE9, 0x77, 0x70, 0xF7, 0x77, 0x0F, 0x97, 0x77, 0x9E, 0xA7, 0x77, 0x0F, 0x77, 0x70,
+    0xAE, 0xA7, 0x77, 0x9F, 0x77, 0x70, 0xF9, 0x77, 0x7A, 0xEA, 0x77, 0x19, 0xAE, 0xAA, 0xF7, 0x71,
+    0xFF, 0xEA, 0x77, 0x9F, 0xFF, 0x77, 0x0F, 0xA2, 0xFC, 0xA7, 0x6A, 0xE9, 0x2A, 0xFD, 0x97, 0x5F,
+    0x29, 0xFE, 0xA7, 0x49, 0xE9, 0x2F, 0xAF, 0x74, 0xAE, 0x2A, 0xF0, 0xAE, 0x74, 0xAE, 0x2F, 0x90,
+    0x9E, 0x74, 0xAE, 0x1F, 0xA1, 0x9E, 0x74, 0xAE, 0x09, 0xF2, 0xAE, 0x74, 0xAF, 0xF9, 0x2F, 0x74,
+    0x9F, 0xF0, 0x9A, 0xFC, 0x75, 0xFF, 0xFE, 0xA7, 0x5A, 0xFF, 0xFD, 0x97, 0x6F, 0xFF, 0xD7, 0x7F,
+    0xFF, 0xC7, 0x7F, 0xFE, 0xA9, 0x77, 0x9F, 0x97, 0x77, 0xFC, 0x77, 0x7A, 0xF9, 0x77, 0x7F, 0xA7,
+    0x77, 0xFC, 0x77, 0x79, 0xFA, 0x77, 0x7F, 0xC7, 0x77, 0xAF, 0x97, 0x77, 0xF9, 0x77, 0x7D, 0xA9,
+    0x77, 0x70, 0x9A, 0x77, 0x73, 0x2A, 0xDA, 0x74, 0xAE, 0x74, 0xAE, 0x97, 0x39, 0xAA, 0xA9, 0x77,
+    0x77, 0x77, 0x4A, 0xF4, 0x9F, 0x0A, 0xF4, 0x9F, 0x0A, 0xF4, 0x9F, 0x0A, 0xF4, 0x9F, 0x09, 0xEA,
+    0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x5F, 0x09,
+    0xEA, 0x5E, 0xA0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x49, 0xEA, 0x1F, 0x4A, 0xEA, 0x1F, 0xFF, 0xC9,
+    0x1F, 0xFF, 0xC9, 0x1A, 0xFF, 0xF3, 0xFF, 0xE9, 0x4A, 0xFF, 0x97, 0x72, 0x79, 0x97, 0x49, 0xD7,
+    0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAF, 0x49, 0xF0, 0xAF,
+    0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E,
+    0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0,
+    0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F,
+    0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x77, 0x6D, 0x97, 0x3A, 0xE7, 0x2A, 0xFC, 0x70, 0xEA, 0x9E,
+    0x6E, 0x3A, 0xD7, 0x77, 0x77, 0x72, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF,
+    0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0,
+    0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE,
+    0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20,
+    0x29, 0xAA, 0x91, 0x9A, 0xA6, 0xAE, 0x1E, 0x95, 0xF1, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x0A, 0xF7,
+    0x77, 0x77, 0x77, 0x72, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0,
+    0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5,
+    0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF,
+    0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x7D, 0x97,
+    0x49, 0xD7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x69, 0xE9, 0x6F, 0x1F, 0x59, 0xE9, 0x19, 0xE9, 0x4F, 0x3F, 0x3A, 0xE9, 0x3A, 0xE9, 0x2F, 0x5F,
+    0x1A, 0xE9, 0x5A, 0xE9, 0x0F, 0x7F, 0xAE, 0xA7, 0xAF, 0xE7, 0x09, 0xFD, 0xA7, 0x1F, 0xD7, 0x29,
+    0xFA, 0x73, 0xF9, 0x73, 0xF9, 0x73, 0xF9, 0x73, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x50, 0x99,
+    0x96, 0xDA, 0x6D, 0xA6, 0xEA, 0x94, 0xFD, 0xA2, 0xFF, 0x1E, 0x99, 0xF0, 0xDA, 0x2E, 0x9D, 0xA2,
+    0xAD, 0x9D, 0xA1, 0x9E, 0x0E, 0xAF, 0xA0, 0xFE, 0xA1, 0xFD, 0x92, 0xE9, 0x5D, 0xA6, 0xDA, 0x6D,
+    0xA6, 0x2A, 0xEA, 0x95, 0xFE, 0xA3, 0xAD, 0xA9, 0x9A, 0xD3, 0xE3, 0xDA, 0x2D, 0xA2, 0xAD, 0xA1,
+    0x9D, 0xA1, 0xF9, 0x19, 0xDA, 0x0A, 0xD4, 0x9D, 0xA0, 0xAC, 0xA4, 0x9D, 0xA0, 0x9D, 0xA3, 0xAE,
+    0x1F, 0x91, 0xAE, 0x2F, 0x90, 0xAE, 0x3A, 0xE0, 0xAE, 0xA3, 0xE0, 0xFF, 0xF0, 0xFF, 0xE9, 0x0F,
+    0xFD, 0xA6, 0x99, 0x99, 0x30, 0x09, 0xAA, 0x97, 0x0E, 0xA7, 0x0F, 0x70, 0xAE, 0x97, 0x77, 0x77,
+    0x1A, 0xDA, 0x9D, 0x92, 0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A,
+    0xCA, 0x4E, 0x0D, 0x94, 0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9,
+    0x19, 0xAE, 0x99, 0xDA, 0x5D, 0x70, 0xAD, 0x70, 0xDA, 0x79, 0xD9, 0x79, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x3A, 0xDA, 0x9D, 0x92, 0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E,
+    0x0A, 0xCA, 0x4E, 0x0D, 0x94, 0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF,
+    0xC9, 0x19, 0xAE, 0x99, 0xDA, 0x4A, 0xCA, 0x79, 0xE6, 0x9F, 0xC4, 0x9E, 0x9E, 0x29, 0xD9, 0x2A,
+    0xD7, 0x77, 0x77, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD,
+    0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90,
+    0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA0, 0x2A, 0xCA, 0x09, 0xC9, 0x39, 0xEA, 0x9C, 0xA3, 0xAC,
+    0x9F, 0x93, 0xD1, 0xE7, 0x77, 0x77, 0x1A, 0xDA, 0x9D, 0x92, 0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9,
+    0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94, 0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF,
+    0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA, 0x09, 0xE1, 0xAD, 0xA1, 0xAE, 0x1E,
+    0xA1, 0xF1, 0xF1, 0xF9, 0x9F, 0x1A, 0xAA, 0xA1, 0xAA, 0xAA, 0x77, 0x77, 0x7A, 0xDA, 0x9D, 0x92,
+    0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94,
+    0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA,
+    0x39, 0xD9, 0x7F, 0x69, 0xCA, 0xAC, 0x96, 0xF7, 0x9D, 0x97, 0x77, 0x77, 0x2A, 0xDA, 0x9D, 0x92,
+    0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94,
+    0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA,
+    0x77, 0x6A, 0xDA, 0x9D, 0x90, 0xAE, 0xA4, 0xFF, 0xFF, 0x2E, 0xAA, 0xFE, 0x90, 0x9D, 0xA1, 0xD9,
+    0x2A, 0xF9, 0x99, 0x9A, 0xD9, 0xAD, 0x39, 0xFF, 0xEA, 0xAC, 0xA4, 0xFF, 0xEA, 0xD9, 0x4E, 0xA7,
+    0xAC, 0xA3, 0x9F, 0x7A, 0xFF, 0xFC, 0xAA, 0xAA, 0xCA, 0x0F, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xFC,
+    0xA1, 0x9A, 0xE9, 0x9F, 0xFA, 0x90, 0x75, 0x9A, 0xEA, 0x3F, 0xE2, 0xAF, 0xAD, 0x19, 0xE6, 0xAD,
+    0xA6, 0xAD, 0x96, 0xE9, 0x6A, 0xDA, 0x6A, 0xE9, 0x19, 0x3F, 0xEA, 0x29, 0xFE, 0xA3, 0xAF, 0xA5,
+    0x9C, 0xA9, 0x6F, 0x95, 0x90, 0xAC, 0xA5, 0xF9, 0x5E, 0xA2, 0x09, 0xAA, 0x97, 0x0A, 0xDA, 0x70,
+    0xAE, 0x70, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xDA, 0x94, 0xAF, 0xDA, 0x2A, 0xDA, 0x19,
+    0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9, 0xAF, 0xFD, 0x9E, 0x97, 0xAD, 0xA7, 0x9F, 0xAA,
+    0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92, 0x9A, 0xFA, 0x10, 0x5D, 0x97, 0x9D, 0x70, 0xDA,
+    0x79, 0xD9, 0x70, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xDA, 0x94, 0xAF, 0xDA, 0x2A,
+    0xDA, 0x19, 0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9, 0xAF, 0xFD, 0x9E, 0x97, 0xAD, 0xA7,
+    0x9F, 0xAA, 0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92, 0x9A, 0xFA, 0x10, 0x4A, 0xCA, 0x79,
+    0xE9, 0x59, 0xFC, 0x49, 0xE9, 0xE9, 0x19, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xDA,
+    0x94, 0xAF, 0xDA, 0x2A, 0xDA, 0x19, 0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9, 0xAF, 0xFD,
+    0x9E, 0x97, 0xAD, 0xA7, 0x9F, 0xAA, 0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92, 0x9A, 0xFA,
+    0x10, 0x1A, 0xAA, 0x19, 0xAA, 0x91, 0x9E, 0x1A, 0xDA, 0x1A, 0xE1, 0xF1, 0xF9, 0x0F, 0x1F, 0x99,
+    0xF7, 0x77, 0x77, 0x77, 0x79, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99,
+    0x9A, 0xD0, 0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F,
+    0xFD, 0x91, 0xFF, 0xC9, 0x29, 0xAF, 0xA1, 0x9A, 0xA9, 0x5E, 0xA5, 0xF5, 0xAE, 0x97, 0x75, 0x9A,
+    0xA5, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0x9D, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD,
+    0x94, 0xAD, 0xA4, 0xEA, 0x4F, 0x10, 0x1D, 0x1A, 0xD1, 0xDA, 0x0A, 0xD1, 0x99, 0x97, 0x76, 0xAA,
+    0x19, 0xD9, 0x09, 0xD9, 0x09, 0xD9, 0x09, 0xD9, 0x09, 0xD9, 0x0A, 0xD9, 0x0A, 0xD9, 0x0A, 0xD9,
+    0x0A, 0xDA, 0x0E, 0xA0, 0xF0, 0x4D, 0x97, 0x9E, 0x69, 0xFC, 0x49, 0xE9, 0xE2, 0x9D, 0x92, 0xAD,
+    0x77, 0x75, 0xAA, 0x70, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0xAD, 0x97,
+    0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xA7, 0xEA, 0x7F, 0x30, 0x0E, 0x1E, 0x1E, 0x1E, 0x09, 0xE0, 0x9E,
+    0x0A, 0xE9, 0xAE, 0x97, 0x76, 0x9A, 0xA6, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D, 0x95, 0x9D,
+    0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0xA5, 0xEA, 0x5F, 0x20, 0x77, 0x70, 0xDA, 0x74,
+    0xAF, 0x73, 0x9A, 0xEA, 0x71, 0x99, 0x9A, 0xE9, 0x99, 0x6F, 0xFD, 0x95, 0xFF, 0xD9, 0x71, 0xDA,
+    0x69, 0xAD, 0xA9, 0x0D, 0xA5, 0xAF, 0xDA, 0xD9, 0x4A, 0xFF, 0xD5, 0xE9, 0x2F, 0x5E, 0x3A, 0xE4,
+    0x9E, 0x39, 0xDA, 0x5E, 0xA2, 0xE9, 0x5F, 0xFD, 0x69, 0xFF, 0x97, 0x9F, 0xDA, 0x72, 0xAA, 0xCA,
+    0x97, 0x77, 0xDA, 0x09, 0xCA, 0x3A, 0xEA, 0x9C, 0x93, 0xD0, 0xF9, 0x3D, 0x1D, 0xA7, 0x77, 0x76,
+    0xDA, 0x9E, 0xA3, 0xFF, 0xC9, 0x1F, 0xCA, 0xF1, 0xE9, 0x2A, 0xD0, 0x9E, 0x39, 0xD9, 0x9D, 0xA3,
+    0x9D, 0x99, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xAA, 0xE3, 0xEA, 0xAE, 0x3F, 0xAE, 0x3F, 0xF3, 0xF0,
+    0x09, 0xAA, 0x97, 0x0E, 0xA7, 0x0A, 0xE7, 0x0A, 0xE9, 0x77, 0x75, 0x9A, 0xDA, 0x94, 0xFF, 0x2F,
+    0xAA, 0xEA, 0x09, 0xE3, 0xE9, 0xAD, 0x93, 0xAD, 0xAE, 0x93, 0x9D, 0xAA, 0xD9, 0x3A, 0xDA, 0xAE,
+    0x91, 0x9E, 0x99, 0xFF, 0xD1, 0xAF, 0xFA, 0x2F, 0xF4, 0x9A, 0xDA, 0x92, 0x59, 0x97, 0x1D, 0x70,
+    0xAD, 0x70, 0xDA, 0x7A, 0xD7, 0x77, 0x77, 0x77, 0x73, 0x9A, 0xDA, 0x94, 0xFF, 0x2F, 0xAA, 0xEA,
+    0x09, 0xE3, 0xE9, 0xAD, 0x93, 0xAD, 0xAE, 0x93, 0x9D, 0xAA, 0xD9, 0x3A, 0xDA, 0xAE, 0x91, 0x9E,
+    0x99, 0xFF, 0xD1, 0xAF, 0xFA, 0x2F, 0xF4, 0x9A, 0xDA, 0x92, 0x77, 0x0D, 0xA7, 0xAE, 0x95, 0xAF,
+    0xC9, 0x3A, 0xDA, 0x9E, 0x91, 0xAD, 0x92, 0xAD, 0x97, 0x77, 0x29, 0xAD, 0xA9, 0x4F, 0xF2, 0xFA,
+    0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA, 0xE9,
+    0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x20, 0x76, 0xDA, 0x09, 0xCA,
+    0x3A, 0xEA, 0x9C, 0xA3, 0xD9, 0xF9, 0x3D, 0x90, 0xE7, 0x77, 0x59, 0xAD, 0xA9, 0x4F, 0xF2, 0xFA,
+    0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA, 0xE9,
+    0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x20, 0x09, 0xE1, 0xAD, 0xA1,
+    0xAE, 0x1E, 0xA1, 0xF1, 0xF1, 0xF9, 0x9F, 0x1A, 0xAA, 0xA1, 0xAA, 0xAA, 0x77, 0x73, 0x9A, 0xDA,
+    0x94, 0xFF, 0x2F, 0xAA, 0xEA, 0x09, 0xE3, 0xE9, 0xAD, 0x93, 0xAD, 0xAE, 0x93, 0x9D, 0xAA, 0xD9,
+    0x3A, 0xDA, 0xAE, 0x91, 0x9E, 0x99, 0xFF, 0xD1, 0xAF, 0xFA, 0x2F, 0xF4, 0x9A, 0xDA, 0x92, 0x59,
+    0xAA, 0x97, 0x3E, 0xA7, 0x3F, 0x73, 0xF7, 0x29, 0xF7, 0x77, 0x99, 0x9A, 0xAA, 0xAA, 0xAE, 0x92,
+    0xFF, 0xFC, 0x1A, 0xFF, 0xFC, 0x97, 0x75, 0x9A, 0xA9, 0x73, 0xEA, 0x73, 0xF7, 0x3F, 0x72, 0x9F,
+    0x50, 0x73, 0x99, 0x71, 0x9D, 0x72, 0xE7, 0x2D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x2E, 0x71, 0x9D,
+    0x97, 0x1A, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x69, 0xAF, 0x6F, 0xF4, 0xFF, 0xD2, 0x9E,
+    0x0F, 0xD9, 0x1A, 0xD9, 0x0E, 0xAD, 0xA1, 0xE9, 0xAD, 0xA9, 0xDA, 0x1E, 0x9E, 0x99, 0xDA, 0x1A,
+    0xFD, 0x9E, 0xA1, 0x9F, 0xFD, 0x92, 0xFF, 0xCA, 0x4F, 0xF5, 0x9F, 0xA9, 0x6A, 0xDA, 0x71, 0xE9,
+    0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1D, 0xA7, 0x19, 0xC9,
+    0x72, 0x97, 0x40, 0x09, 0xE7, 0x09, 0xE9, 0x79, 0xEA, 0x79, 0xAA, 0xAA, 0x77, 0x72, 0xE4, 0xE0,
+    0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9,
+    0x9E, 0x29, 0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0x59,
+    0x97, 0x1D, 0x70, 0xAD, 0x70, 0xDA, 0x7A, 0xD7, 0x77, 0x77, 0x77, 0x70, 0xE4, 0xE0, 0xAD, 0x4E,
+    0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9, 0x9E, 0x29,
+    0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0x77, 0x0D, 0xA7,
+    0xAE, 0x95, 0xAF, 0xC9, 0x3A, 0xDA, 0x9E, 0x91, 0xAD, 0x92, 0xAD, 0x97, 0x77, 0xE4, 0xE0, 0xAD,
+    0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9, 0x9E,
+    0x29, 0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0x1A, 0xA9,
+    0x19, 0xAA, 0x91, 0x9E, 0x1E, 0xA1, 0xAE, 0x1F, 0x1F, 0x90, 0xF1, 0xF9, 0x9F, 0x77, 0x77, 0x4E,
+    0x4E, 0x0A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x99, 0xD9, 0x3E, 0x99, 0xD9,
+    0x3E, 0x99, 0xE2, 0x9E, 0x90, 0xFA, 0x9F, 0xA0, 0xFF, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFA, 0xEA,
+    0x79, 0x73, 0xD9, 0x71, 0xAD, 0x72, 0xDA, 0x71, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xAE, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xAE, 0x3E, 0x92, 0xE9, 0x2E, 0x3A, 0xE1, 0x9D, 0xA4,
+    0xEA, 0x0E, 0x94, 0xAE, 0x9E, 0x6F, 0xDA, 0x6A, 0xFC, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97,
+    0x09, 0xE7, 0x1F, 0x59, 0xAA, 0xFA, 0x5A, 0xFD, 0x6A, 0xFC, 0x96, 0xAE, 0xA7, 0xE6, 0xE6, 0xE6,
+    0xE9, 0x5F, 0xD9, 0x2F, 0xEA, 0x1E, 0x9A, 0xE9, 0x0E, 0x19, 0xE0, 0xE2, 0x9D, 0x9E, 0x3D, 0xAA,
+    0xD2, 0x9D, 0x9A, 0xD2, 0xE0, 0xAD, 0x1A, 0xE0, 0xAD, 0x9A, 0xE1, 0xAF, 0xD9, 0x1A, 0xFC, 0x92,
+    0xAD, 0xA9, 0x4A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x59, 0xAA, 0x60, 0x19, 0xE1, 0xAD,
+    0xA3, 0x9E, 0x1F, 0x3A, 0xE9, 0x0F, 0x3F, 0x90, 0xF3, 0xAA, 0xAA, 0x90, 0xAA, 0xAA, 0x77, 0x77,
+    0x77, 0x77, 0x7A, 0xE5, 0xE1, 0xE9, 0x3A, 0xDA, 0x1A, 0xE3, 0xE9, 0x2E, 0x92, 0xE3, 0xAE, 0x19,
+    0xDA, 0x4E, 0xA0, 0xE9, 0x4A, 0xE9, 0xE6, 0xFD, 0xA6, 0xAF, 0xC9, 0x7F, 0xC7, 0x0F, 0xC7, 0x09,
+    0xE9, 0x70, 0x9E, 0x71, 0xF5, 0x9A, 0xAF, 0xA5, 0xAF, 0xD6, 0xAF, 0xC9, 0x6A, 0xEA, 0x70, 0x69,
+    0x99, 0x9A, 0xA9, 0x7A, 0xFF, 0xC7, 0xFF, 0xD7, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x4A,
+    0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90,
+    0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F,
+    0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F,
+    0x90, 0x70, 0x92, 0xAF, 0xF9, 0x09, 0xFF, 0xD0, 0xAD, 0xAA, 0xAA, 0xAA, 0x99, 0x77, 0x77, 0x77,
+    0x3A, 0xDA, 0x9D, 0x92, 0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A,
+    0xCA, 0x4E, 0x0D, 0x94, 0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9,
+    0x19, 0xAE, 0x99, 0xDA, 0x77, 0x59, 0xD9, 0x2E, 0x79, 0xFF, 0xA7, 0x0F, 0xF7, 0x2A, 0xFA, 0x77,
+    0x77, 0x77, 0x77, 0x2A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA,
+    0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3,
+    0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F,
+    0x95, 0x9F, 0x1F, 0x7F, 0x90, 0x74, 0xAD, 0x91, 0x9D, 0xA1, 0xAF, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9,
+    0x77, 0x77, 0x71, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD,
+    0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90,
+    0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA0, 0x6A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73,
+    0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E,
+    0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29,
+    0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x97, 0x4E, 0x75, 0xAD, 0x76, 0xFC, 0x97, 0x39,
+    0xFA, 0x74, 0x9A, 0xD9, 0x77, 0x10, 0x77, 0xAD, 0xA9, 0xD9, 0x3F, 0xF9, 0x2E, 0xAA, 0xFA, 0x2D,
+    0x92, 0xAD, 0xA1, 0xAD, 0x39, 0xE1, 0xAC, 0xA4, 0xE1, 0xD9, 0x4E, 0x1A, 0xCA, 0x39, 0xE1, 0xAF,
+    0xFD, 0x2F, 0xFD, 0x91, 0xAF, 0xFC, 0x92, 0x9A, 0xE9, 0x9E, 0x70, 0x9D, 0xA7, 0x0D, 0xA7, 0x0A,
+    0xD7, 0x1A, 0xFA, 0x7F, 0xA7, 0x09, 0xAC, 0x90, 0x70, 0xD7, 0x4A, 0xD7, 0x4D, 0x97, 0x3A, 0xD7,
+    0x49, 0x99, 0x77, 0x77, 0x74, 0x9A, 0xFC, 0xA5, 0x9F, 0xFC, 0x4A, 0xFF, 0xD3, 0xAF, 0xFD, 0xA3,
+    0xFC, 0x97, 0x0A, 0xF7, 0x2F, 0x97, 0x19, 0xF7, 0x29, 0xF7, 0x2A, 0xF7, 0x2A, 0xF7, 0x2A, 0xF9,
+    0x71, 0x9F, 0xCA, 0x92, 0x9A, 0xA2, 0xFF, 0xFA, 0x2A, 0xFF, 0xF3, 0xFF, 0xF3, 0x9F, 0xFE, 0x5A,
+    0xFF, 0xC0, 0x4A, 0xCA, 0x7D, 0x7A, 0xD7, 0xDA, 0x79, 0x97, 0x72, 0x9F, 0xA3, 0xFE, 0x2A, 0xFA,
+    0xD1, 0x9E, 0x6A, 0xDA, 0x6A, 0xD9, 0x6E, 0x96, 0xAD, 0xA6, 0x9E, 0x91, 0x93, 0xFE, 0xA2, 0x9F,
+    0xEA, 0x3A, 0xAE, 0xA1, 0x77, 0x69, 0xD7, 0x4F, 0x72, 0xFD, 0x70, 0xE9, 0xAE, 0x6D, 0xA3, 0xE7,
+    0x77, 0x77, 0x77, 0x09, 0xAF, 0xCA, 0x59, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF, 0xDA, 0x3F, 0xC9,
+    0x70, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0x97, 0x19,
+    0xFC, 0xA9, 0x29, 0xAA, 0x2F, 0xFF, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x39, 0xFF, 0xE5, 0xAF, 0xFC,
+    0x00, 0x4D, 0x97, 0x9E, 0x69, 0xFC, 0x49, 0xE9, 0xE2, 0x9D, 0x92, 0xAD, 0x77, 0x74, 0x9A, 0xEA,
+    0x4F, 0xE3, 0xAF, 0xAD, 0x29, 0xE7, 0xAD, 0xA7, 0xAD, 0x97, 0xE9, 0x7A, 0xDA, 0x79, 0xE9, 0x19,
+    0x4F, 0xEA, 0x39, 0xFE, 0xA4, 0xAA, 0xEA, 0x10, 0x69, 0xE7, 0x3A, 0xE7, 0x3F, 0x73, 0xF7, 0x3A,
+    0xAA, 0xA7, 0x77, 0x77, 0x39, 0xAF, 0xCA, 0x59, 0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF, 0xDA, 0x3F,
+    0xC9, 0x70, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0x97,
+    0x19, 0xFC, 0xA9, 0x29, 0xAA, 0x2F, 0xFF, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x39, 0xFF, 0xE5, 0xAF,
+    0xFC, 0x00, 0x3E, 0x7E, 0x95, 0x9E, 0x95, 0xAE, 0xA5, 0x9A, 0xAA, 0x97, 0x70, 0x9A, 0xEA, 0x3F,
+    0xE2, 0xAF, 0xAD, 0x19, 0xE6, 0xAD, 0xA6, 0xAD, 0x96, 0xE9, 0x6A, 0xDA, 0x69, 0xE9, 0x19, 0x3F,
+    0xEA, 0x29, 0xFE, 0xA3, 0xAA, 0xEA, 0x10, 0x3A, 0xA9, 0x39, 0xAA, 0x59, 0xDA, 0x1A, 0xDA, 0x69,
+    0xFD, 0xA7, 0x09, 0xF9, 0x72, 0x9D, 0xA7, 0x4A, 0xA7, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xCA, 0x59,
+    0xFF, 0xC4, 0xAF, 0xFD, 0x3A, 0xFF, 0xDA, 0x3F, 0xC9, 0x70, 0xAF, 0x72, 0xF9, 0x71, 0x9F, 0x72,
+    0x9F, 0x72, 0xAF, 0x72, 0xAF, 0x72, 0xAF, 0x97, 0x19, 0xFC, 0xA9, 0x29, 0xAA, 0x2F, 0xFF, 0xA2,
+    0xAF, 0xFF, 0x3F, 0xFF, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x73, 0x9D, 0xA2, 0xAD, 0x91, 0x9E,
+    0x9E, 0x93, 0x9F, 0xC9, 0x59, 0xE9, 0x7A, 0xCA, 0x77, 0x77, 0x9A, 0xEA, 0x4F, 0xE3, 0xAF, 0xAD,
+    0x29, 0xE7, 0xAD, 0xA7, 0xAD, 0x97, 0xE9, 0x7A, 0xDA, 0x79, 0xE9, 0x19, 0x4F, 0xEA, 0x39, 0xFE,
+    0xA4, 0xAA, 0xEA, 0x20, 0x77, 0x1A, 0xD9, 0x2A, 0xD6, 0xAD, 0xA9, 0xE7, 0x0A, 0xFC, 0x72, 0xAE,
+    0x74, 0xD9, 0x77, 0x77, 0x77, 0x6A, 0xFF, 0xA9, 0x4A, 0xFF, 0xE9, 0x2A, 0xFF, 0xF9, 0x1A, 0xEA,
+    0xAA, 0xAF, 0xD1, 0xAE, 0x5F, 0xA0, 0xAE, 0x6F, 0x0A, 0xE7, 0xE9, 0xAE, 0x7E, 0x9A, 0xE7, 0xE9,
+    0xAE, 0x7E, 0x9A, 0xE7, 0xE9, 0xAE, 0x6A, 0xE9, 0xAE, 0x39, 0xAF, 0xC0, 0xAF, 0xFF, 0xD0, 0xAF,
+    0xFF, 0xCA, 0x0A, 0xFF, 0xFC, 0x1A, 0xFF, 0xF2, 0xAF, 0xFC, 0xA9, 0x30, 0x70, 0xE7, 0x5E, 0x09,
+    0xAA, 0x71, 0xE0, 0xAD, 0x71, 0xE0, 0xE7, 0x1E, 0x0E, 0x71, 0xE0, 0xE3, 0x9E, 0xA0, 0xE9, 0xE2,
+    0xAF, 0xFC, 0x5A, 0xFF, 0xD5, 0xE2, 0xFA, 0x49, 0xD3, 0x9E, 0xA4, 0xAD, 0x4E, 0xA4, 0xE4, 0xEA,
+    0x4A, 0xD9, 0x2A, 0xEA, 0x49, 0xFF, 0xDA, 0x5F, 0xFD, 0xA6, 0xFF, 0xCA, 0x7A, 0xEA, 0x9E, 0x40,
+    0x3A, 0xFF, 0xA9, 0x70, 0xAF, 0xFE, 0x96, 0xAF, 0xFF, 0x95, 0xAE, 0xAA, 0xAA, 0xFD, 0x5A, 0xE5,
+    0xAE, 0xA4, 0xAE, 0x6A, 0xE4, 0xAE, 0x7E, 0x93, 0xAE, 0x7E, 0x90, 0xFF, 0xD9, 0x3E, 0x90, 0xFF,
+    0xD9, 0x3E, 0x90, 0x99, 0x9F, 0xA9, 0x94, 0xE9, 0x3A, 0xE6, 0xF9, 0x3A, 0xE3, 0x9A, 0xFC, 0x4A,
+    0xFF, 0xFD, 0x4A, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xC5, 0xAF, 0xFF, 0x6A, 0xFF, 0xCA, 0x93, 0x70,
+    0xE7, 0x4E, 0x70, 0xFF, 0xD9, 0x4F, 0xFD, 0x94, 0xAA, 0xAA, 0xEA, 0xAA, 0x97, 0x0E, 0x69, 0xEA,
+    0x0E, 0x5A, 0xFF, 0xC4, 0xAF, 0xFD, 0x4E, 0x2F, 0xA3, 0x9D, 0x39, 0xEA, 0x3A, 0xD4, 0xEA, 0x3E,
+    0x4E, 0xA3, 0xAD, 0x92, 0xAE, 0xA3, 0x9F, 0xFD, 0xA4, 0xFF, 0xDA, 0x5F, 0xFC, 0xA6, 0xAE, 0xA9,
+    0xE3, 0x79, 0x99, 0x29, 0xFF, 0xC2, 0xAF, 0xFC, 0x91, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x77, 0x77,
+    0x77, 0x6A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70,
+    0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x79,
+    0x92, 0xAF, 0xFA, 0x1F, 0xFD, 0x09, 0xAA, 0xAA, 0xAA, 0xA9, 0x99, 0x77, 0x77, 0x77, 0x77, 0x73,
+    0x9A, 0xDA, 0x94, 0xAF, 0xDA, 0x2A, 0xDA, 0x19, 0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9,
+    0xAF, 0xFD, 0x9E, 0x97, 0xAD, 0xA7, 0x9F, 0xAA, 0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92,
+    0x9A, 0xFA, 0x10, 0x76, 0xE2, 0xAD, 0x3F, 0xFC, 0x39, 0xFE, 0x59, 0xAE, 0xA7, 0x77, 0x77, 0x3A,
+    0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79,
+    0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x74, 0xAD, 0x91,
+    0x9D, 0xA1, 0x9F, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAD, 0xA9, 0x4A,
+    0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9,
+    0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9, 0x29, 0xAF, 0xA1, 0x4E,
+    0x70, 0x9E, 0x97, 0x9E, 0x97, 0xAE, 0xA7, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x3A, 0xAA, 0xAF, 0xE9,
+    0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F,
+    0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90,
+    0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x3A, 0xDA, 0x7A, 0xE7, 0xF7, 0xF7,
+    0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1,
+    0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA,
+    0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9, 0x29, 0xAF, 0xA1, 0x0A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F,
+    0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF,
+    0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A,
+    0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x3D, 0xA7, 0x0A, 0xCA, 0x71, 0xFC, 0x79, 0xF7, 0x19,
+    0x99, 0x40, 0x29, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0,
+    0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91,
+    0xFF, 0xC9, 0x29, 0xAF, 0xA7, 0x73, 0xCA, 0x70, 0xDA, 0x7D, 0xA7, 0x0D, 0xAA, 0x96, 0xFA, 0x7A,
+    0xDA, 0x76, 0x75, 0x9D, 0xA2, 0xAD, 0x92, 0x9E, 0x9E, 0x94, 0x9F, 0xC9, 0x69, 0xE9, 0x70, 0xAC,
+    0xA7, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9,
+    0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9,
+    0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A,
+    0xFF, 0xEA, 0x74, 0xE3, 0xE2, 0xEA, 0xAE, 0x4F, 0xD6, 0xF7, 0x0D, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x9A, 0xDA, 0x94, 0xAF, 0xDA, 0x2A, 0xDA, 0x19, 0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9,
+    0xAF, 0xFD, 0x9E, 0x97, 0xAD, 0xA7, 0x9F, 0xAA, 0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92,
+    0x9A, 0xFA, 0x10, 0x77, 0x71, 0xAC, 0xA7, 0x59, 0xE9, 0x73, 0x9F, 0xC9, 0x71, 0xAD, 0xA9, 0xE9,
+    0x7A, 0xD9, 0x29, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x99, 0x99, 0x71, 0x9F, 0xFD, 0x5F,
+    0xFF, 0x4F, 0xFF, 0xC3, 0xAF, 0xC9, 0x49, 0xA3, 0xFA, 0x73, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA,
+    0x74, 0xAE, 0xA3, 0x9C, 0xAA, 0x99, 0x2A, 0xEA, 0x39, 0xFE, 0x0A, 0xEA, 0x4F, 0xE9, 0x9F, 0x49,
+    0x9A, 0xFA, 0x0F, 0xA6, 0xE9, 0x1F, 0xDA, 0x99, 0x99, 0xF2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC9,
+    0x3A, 0xFF, 0xEA, 0x69, 0xAF, 0xCA, 0x93, 0x49, 0xD7, 0x1E, 0xA7, 0xFC, 0x95, 0xE9, 0xE9, 0x3D,
+    0xA2, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0xAE, 0x99, 0xDA, 0x2F, 0xFC, 0xA1, 0xEA, 0xAF, 0xCA, 0x09,
+    0xD9, 0x2F, 0xA0, 0xAC, 0xA3, 0xAE, 0xA0, 0xAC, 0xA3, 0x9E, 0x90, 0xD9, 0x39, 0xE9, 0x0A, 0xCA,
+    0x39, 0xE9, 0x0A, 0xD9, 0x19, 0xF9, 0x09, 0xFF, 0xD9, 0x1F, 0xFD, 0x92, 0xFF, 0xC4, 0xAE, 0xAE,
+    0x71, 0xE2, 0x9A, 0x29, 0xEA, 0x2F, 0xFC, 0x3F, 0xF9, 0x29, 0xFE, 0xA7, 0x99, 0x95, 0x77, 0x6E,
+    0x2A, 0xD9, 0x7F, 0xFC, 0x70, 0x9F, 0xE9, 0x71, 0x9F, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39,
+    0x99, 0x99, 0x71, 0x9F, 0xFD, 0x5F, 0xFF, 0x4F, 0xFF, 0xC3, 0xAF, 0xC9, 0x49, 0xA3, 0xFA, 0x73,
+    0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA3, 0x9C, 0xAA, 0x99, 0x2A, 0xEA, 0x39, 0xFE,
+    0x0A, 0xEA, 0x4F, 0xE9, 0x9F, 0x49, 0x9A, 0xFA, 0x0F, 0xA6, 0xE9, 0x1F, 0xDA, 0x99, 0x99, 0xF2,
+    0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC9, 0x3A, 0xFF, 0xEA, 0x69, 0xAF, 0xCA, 0x93, 0x75, 0xAD, 0x91,
+    0x9D, 0xA1, 0xAF, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x70, 0xAE, 0x99, 0xDA, 0x1F, 0xFC,
+    0xA0, 0xEA, 0xAF, 0xCA, 0x9D, 0x92, 0xFA, 0xAC, 0xA3, 0xAE, 0xAA, 0xCA, 0x39, 0xE9, 0xD9, 0x39,
+    0xE9, 0xAC, 0xA3, 0x9E, 0x9A, 0xD9, 0x19, 0xF9, 0x9F, 0xFD, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x3A,
+    0xEA, 0xE7, 0x0E, 0x19, 0xA2, 0x9E, 0xA1, 0xFF, 0xC2, 0xFF, 0x91, 0x9F, 0xEA, 0x69, 0x99, 0x40,
+    0x79, 0xAA, 0x76, 0xE9, 0x75, 0xEA, 0x74, 0x9E, 0xA7, 0x4A, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0x99, 0x99, 0x97, 0x19, 0xFF, 0xD5, 0xFF, 0xF4, 0xFF, 0xFC, 0x3A, 0xFC, 0x94, 0x9A, 0x3F, 0xA7,
+    0x39, 0xF7, 0x49, 0xEA, 0x74, 0x9E, 0xA7, 0x4A, 0xEA, 0x39, 0xCA, 0xA9, 0x92, 0xAE, 0xA3, 0x9F,
+    0xE0, 0xAE, 0xA4, 0xFE, 0x99, 0xF4, 0x99, 0xAF, 0xA0, 0xFA, 0x6E, 0x91, 0xFD, 0xA9, 0x99, 0x9F,
+    0x29, 0xFF, 0xFD, 0x3A, 0xFF, 0xFC, 0x93, 0xAF, 0xFE, 0xA6, 0x9A, 0xFC, 0xA9, 0x30, 0x4A, 0xDA,
+    0x7E, 0xA7, 0xF7, 0xF7, 0xAA, 0xAA, 0x77, 0x77, 0x71, 0xAE, 0x99, 0xDA, 0x1F, 0xFC, 0xA0, 0xEA,
+    0xAF, 0xCA, 0x9D, 0x92, 0xFA, 0xAC, 0xA3, 0xAE, 0xAA, 0xCA, 0x39, 0xE9, 0xD9, 0x39, 0xE9, 0xAC,
+    0xA3, 0x9E, 0x9A, 0xD9, 0x19, 0xF9, 0x9F, 0xFD, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x3A, 0xEA, 0xE7,
+    0x0E, 0x19, 0xA2, 0x9E, 0xA1, 0xFF, 0xC2, 0xFF, 0x91, 0x9F, 0xEA, 0x69, 0x99, 0x40, 0x6F, 0xC7,
+    0x4F, 0xA7, 0x4F, 0x97, 0x4F, 0x74, 0xAE, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x09, 0x99, 0x99, 0x71, 0x9F, 0xFD, 0x5F, 0xFF, 0x4F, 0xFF, 0xC3, 0xAF, 0xC9, 0x49,
+    0xA3, 0xFA, 0x73, 0x9F, 0x74, 0x9E, 0xA7, 0x49, 0xEA, 0x74, 0xAE, 0xA3, 0x9C, 0xAA, 0x99, 0x2A,
+    0xEA, 0x39, 0xFE, 0x0A, 0xEA, 0x4F, 0xE9, 0x9F, 0x49, 0x9A, 0xFA, 0x0F, 0xA6, 0xE9, 0x1F, 0xDA,
+    0x99, 0x99, 0xF2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC9, 0x3A, 0xFF, 0xEA, 0x69, 0xAF, 0xCA, 0x93,
+    0x39, 0xAA, 0xAA, 0x95, 0x9F, 0x95, 0x9F, 0x69, 0xF6, 0xAE, 0x96, 0xF6, 0x9F, 0x69, 0x99, 0x99,
+    0x77, 0x2A, 0xE9, 0x9D, 0xA1, 0xFF, 0xCA, 0x0E, 0xAA, 0xFC, 0xA9, 0xD9, 0x2F, 0xAA, 0xCA, 0x3A,
+    0xEA, 0xAC, 0xA3, 0x9E, 0x9D, 0x93, 0x9E, 0x9A, 0xCA, 0x39, 0xE9, 0xAD, 0x91, 0x9F, 0x99, 0xFF,
+    0xD9, 0x0F, 0xFD, 0x91, 0xFF, 0xC3, 0xAE, 0xAE, 0x70, 0xE1, 0x9A, 0x29, 0xEA, 0x1F, 0xFC, 0x2F,
+    0xF9, 0x19, 0xFE, 0xA6, 0x99, 0x94, 0x59, 0xD7, 0x4E, 0xA7, 0x2F, 0xCA, 0x70, 0xE9, 0xAD, 0xA6,
+    0xE2, 0x9D, 0xA7, 0x77, 0x77, 0x73, 0xE9, 0x5F, 0x1E, 0x95, 0xF1, 0xE9, 0x5F, 0x1E, 0xA5, 0xF0,
+    0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xF0, 0x9F,
+    0x5F, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x9A, 0xFF, 0xFD, 0x9A, 0xFA, 0xAA,
+    0xAA, 0xAF, 0x9A, 0xF4, 0x9F, 0x9A, 0xF4, 0x9F, 0x9A, 0xF4, 0x9F, 0x90, 0x77, 0x39, 0xD7, 0x4F,
+    0x72, 0xFD, 0x70, 0xE9, 0xAE, 0x6D, 0xA3, 0xE7, 0x77, 0x77, 0x0A, 0xD9, 0x73, 0xAD, 0x97, 0x3A,
+    0xD9, 0x73, 0xE9, 0x73, 0xE7, 0x4E, 0x74, 0xE9, 0xF9, 0x6F, 0xFC, 0xA5, 0xFC, 0xAF, 0x5E, 0xA2,
+    0x9D, 0x93, 0x9E, 0x4D, 0xA3, 0x9E, 0x4D, 0xA3, 0x9E, 0x4E, 0x3A, 0xE4, 0xE3, 0xAE, 0x39, 0xE3,
+    0xAE, 0x3A, 0xE3, 0xAE, 0x92, 0xAE, 0x3F, 0x92, 0xF0, 0x1E, 0x95, 0xF3, 0xE9, 0x5F, 0x3E, 0x95,
+    0xF3, 0xEA, 0x5F, 0x29, 0xEA, 0x5F, 0x19, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0x19,
+    0xEA, 0x5F, 0x29, 0xF5, 0xF2, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0xD2, 0x9F, 0xFF, 0xD9, 0x1A, 0xFF,
+    0xFD, 0x91, 0xAF, 0xAA, 0xAA, 0xAA, 0xF9, 0x1A, 0xF4, 0x9F, 0x91, 0xAF, 0x49, 0xF9, 0x1A, 0xF4,
+    0x9F, 0x90, 0x3A, 0xD9, 0x73, 0xAD, 0x97, 0x09, 0x9A, 0xFC, 0xA5, 0x9F, 0xFA, 0x59, 0xDA, 0xE9,
+    0x73, 0xE7, 0x4E, 0x9F, 0x96, 0xFF, 0xCA, 0x5F, 0xCA, 0xF5, 0xEA, 0x29, 0xD9, 0x39, 0xE4, 0xDA,
+    0x39, 0xE4, 0xDA, 0x39, 0xE4, 0xE3, 0x9E, 0x4E, 0x3A, 0xE3, 0x9E, 0x3A, 0xE3, 0xAE, 0x3A, 0xE9,
+    0x2A, 0xE3, 0xF9, 0x2F, 0x00, 0x09, 0xD9, 0x0D, 0x1F, 0x9A, 0xC1, 0xD9, 0xF0, 0x9D, 0x09, 0xDA,
+    0x77, 0x77, 0x77, 0x9E, 0x93, 0x9E, 0x93, 0x9E, 0x93, 0x9E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+    0x94, 0xE9, 0x4E, 0x94, 0xE9, 0x39, 0xEA, 0x39, 0xEA, 0x39, 0xEA, 0x3A, 0xF3, 0xAF, 0x10, 0x70,
+    0xDA, 0x09, 0xC9, 0xAE, 0xA9, 0xCA, 0xD9, 0xF9, 0xAC, 0x90, 0xAC, 0xA7, 0x77, 0x29, 0xAA, 0x93,
+    0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0x9D, 0x93, 0xAD, 0x93, 0xAD, 0x93, 0xAD, 0x93,
+    0xAD, 0xA3, 0xEA, 0x3F, 0x10, 0x75, 0xFF, 0xC1, 0xAF, 0xFC, 0x90, 0xDA, 0xAA, 0xAA, 0xAA, 0x99,
+    0x77, 0x77, 0x77, 0x77, 0x9E, 0x96, 0x9E, 0x96, 0x9E, 0x96, 0x9E, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x70, 0xE7, 0x0E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x69, 0xEA, 0x69, 0xEA, 0x69, 0xEA, 0x6A,
+    0xF6, 0xAF, 0x20, 0x39, 0x99, 0x9A, 0xA2, 0xFF, 0xC9, 0x09, 0xFF, 0xD0, 0x99, 0x99, 0x99, 0x97,
+    0x77, 0x77, 0x49, 0xAA, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0xAD,
+    0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xA7, 0xEA, 0x7F, 0x30, 0x09, 0xE9, 0x09, 0xE9, 0x09, 0xE9,
+    0x09, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE9, 0x1E, 0x91, 0xE9, 0x1E, 0x90, 0x9E, 0xA0, 0x9E,
+    0xA0, 0x9E, 0xA0, 0xAF, 0x0A, 0xF0, 0xE1, 0x9D, 0x2A, 0xF1, 0xF3, 0x99, 0x00, 0x0A, 0xDA, 0x1E,
+    0xA1, 0xF1, 0xF1, 0xAA, 0xAA, 0x75, 0x9A, 0xA2, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91,
+    0x9D, 0x91, 0xAD, 0x91, 0xAD, 0x91, 0xAD, 0x91, 0xAD, 0xA1, 0xEA, 0x1F, 0x19, 0xD9, 0x1D, 0xA1,
+    0xAD, 0x2F, 0xC9, 0x9F, 0xA1, 0x9A, 0xC9, 0x0A, 0xAA, 0x1E, 0x09, 0xE9, 0xAE, 0x9F, 0xA7, 0x73,
+    0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E,
+    0x99, 0xEA, 0x9E, 0xA9, 0xEA, 0xAF, 0xAF, 0x9A, 0xA9, 0x9D, 0x99, 0xD9, 0x9D, 0x99, 0xD9, 0x9D,
+    0x9A, 0xD9, 0xAD, 0x9A, 0xD9, 0xAD, 0xAE, 0xAF, 0x0F, 0x7E, 0xA0, 0xF7, 0xEA, 0x0F, 0x69, 0xEA,
+    0x0A, 0xE6, 0x9E, 0x90, 0xAE, 0x69, 0xE9, 0x0A, 0xE6, 0xAE, 0x90, 0xAE, 0x6A, 0xE1, 0xAE, 0x6A,
+    0xE1, 0xAE, 0x6F, 0x1A, 0xE6, 0xF1, 0xAE, 0x6F, 0x1A, 0xE6, 0xEA, 0x1A, 0xE6, 0xEA, 0x1A, 0xE6,
+    0xEA, 0x1F, 0x59, 0xE9, 0x1F, 0x94, 0x9E, 0x91, 0xF9, 0x49, 0xE2, 0xF9, 0x4A, 0xE7, 0x4A, 0xE6,
+    0x99, 0x29, 0xF6, 0xAF, 0xFC, 0x6F, 0xFC, 0x96, 0xFF, 0xC7, 0xFF, 0x97, 0xAA, 0xFA, 0x77, 0x50,
+    0x09, 0xAA, 0x93, 0xAD, 0x1E, 0xA3, 0xE1, 0xF3, 0xE9, 0x0F, 0x39, 0x99, 0x09, 0xF7, 0x77, 0x73,
+    0x99, 0x4E, 0x19, 0xD9, 0x3E, 0x19, 0xD9, 0x3E, 0x19, 0xD9, 0x3E, 0x19, 0xD9, 0x3E, 0x19, 0xD9,
+    0x3D, 0xA1, 0xAD, 0x93, 0xDA, 0x1A, 0xD9, 0x3D, 0xA1, 0xAD, 0x93, 0xDA, 0x1A, 0xDA, 0x3D, 0x91,
+    0xEA, 0x29, 0xD9, 0x1F, 0x29, 0xD9, 0x70, 0xE7, 0xFC, 0x7F, 0xC6, 0x9F, 0x97, 0x60, 0x6D, 0x97,
+    0x1A, 0xE7, 0x09, 0xFC, 0x69, 0xE9, 0xE4, 0xAD, 0x92, 0xE7, 0x77, 0x77, 0x72, 0x9E, 0x97, 0x09,
+    0xE9, 0x70, 0xAE, 0x97, 0x0A, 0xE7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xEA,
+    0x70, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xF7, 0x1F, 0x3A, 0x92,
+    0xAE, 0xA3, 0xFF, 0xC9, 0x3F, 0xFC, 0x39, 0xFF, 0x93, 0x9F, 0xE9, 0x77, 0x20, 0x77, 0x0D, 0x97,
+    0xAE, 0x6A, 0xFC, 0x4E, 0xA9, 0xE2, 0xE3, 0xAD, 0x77, 0x77, 0x71, 0x99, 0x97, 0x0D, 0xA7, 0x0D,
+    0xA7, 0x0D, 0xA7, 0x9D, 0xA7, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x97, 0x9D, 0x70, 0xAD,
+    0x70, 0xAD, 0x70, 0xE7, 0x9E, 0x59, 0xFC, 0x59, 0xFA, 0x5A, 0xF7, 0x71, 0x77, 0x4F, 0xA7, 0x2F,
+    0x97, 0x2F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x77, 0x77, 0x77, 0x1E, 0xA1,
+    0x9F, 0x4E, 0xA1, 0xF9, 0x4E, 0x90, 0x9F, 0x5E, 0x90, 0xF6, 0xE0, 0xAE, 0xA5, 0x9E, 0x9F, 0x69,
+    0xEA, 0xE9, 0x6A, 0xFE, 0x7A, 0xFD, 0x70, 0xAF, 0xCA, 0x70, 0xFD, 0x97, 0x0F, 0xE9, 0x7F, 0xF9,
+    0x6F, 0xFC, 0xA4, 0x9E, 0xA9, 0xFC, 0xA3, 0x9E, 0xA0, 0xAF, 0xCA, 0x29, 0xEA, 0x1F, 0xE1, 0xAE,
+    0xA2, 0xFE, 0x00, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xE0, 0xAD, 0xA4, 0xDA, 0xAE, 0x49, 0xFD, 0x59, 0xFC, 0x95, 0x9F, 0xA6, 0x9F, 0xC9, 0x5A, 0xFD,
+    0xA4, 0xAF, 0xEA, 0x3A, 0xDA, 0x9F, 0xA2, 0xAE, 0x0A, 0xFC, 0x1F, 0x1F, 0xD7, 0x77, 0x77, 0x2A,
+    0xAA, 0xA9, 0x69, 0xF9, 0x69, 0xF7, 0x9F, 0x7A, 0xEA, 0x7F, 0x79, 0xF7, 0x9A, 0xAA, 0x96, 0x72,
+    0xD9, 0x0E, 0x2D, 0x99, 0xD3, 0xD0, 0xDA, 0x3D, 0xAD, 0x4F, 0x93, 0x9F, 0x49, 0xEA, 0x4A, 0xFA,
+    0x3A, 0xFC, 0xA2, 0xAC, 0xA0, 0xF1, 0xDA, 0x09, 0xF0, 0x19, 0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x0A,
+    0xD7, 0x19, 0x99, 0x77, 0x6A, 0xDA, 0x70, 0xAD, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E,
+    0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0x9E, 0x97, 0x9E,
+    0x97, 0x9F, 0xFE, 0x9A, 0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0x2D, 0x3A, 0xD3, 0xD9, 0x2A,
+    0xD3, 0x99, 0x97, 0x77, 0x7E, 0x3E, 0x3E, 0x3D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D, 0xA2, 0x9D,
+    0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x92, 0xE9, 0x2F, 0xCA,
+    0x0F, 0xD0, 0xFD, 0x00, 0x1A, 0xF7, 0x1F, 0xC7, 0x1F, 0xA7, 0x1F, 0x97, 0x1F, 0x71, 0xAE, 0xA7,
+    0x1F, 0x97, 0x19, 0x99, 0x97, 0x77, 0x77, 0x2A, 0xDA, 0x72, 0xAD, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x19, 0xE9,
+    0x71, 0x9E, 0x97, 0x19, 0xE9, 0x71, 0x9F, 0xFE, 0x91, 0xAF, 0xFE, 0x91, 0xAF, 0xFE, 0x91, 0xAF,
+    0xFE, 0x90, 0x2E, 0x5E, 0x5E, 0x5D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0xA4, 0x9D, 0x94, 0xAD,
+    0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xAD, 0x94, 0xE9, 0x4F, 0xCA, 0x2F, 0xD2,
+    0xFD, 0x77, 0x77, 0x6F, 0xC3, 0xFC, 0x3F, 0x93, 0xF3, 0x9F, 0x3A, 0xEA, 0x3F, 0x92, 0x0A, 0xDA,
+    0x70, 0xAD, 0xA7, 0x0E, 0xA7, 0x0E, 0xA2, 0x9A, 0xA2, 0xEA, 0x2A, 0xD2, 0xEA, 0x2E, 0x2E, 0xA2,
+    0xE2, 0xEA, 0x2E, 0x2E, 0xA2, 0xE2, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x79, 0xE9, 0x79, 0xE9, 0x79,
+    0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0xAF, 0xFE, 0x90, 0x5A, 0xD9, 0x5A, 0xD6, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE1, 0xE1, 0x99, 0x91, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xD9, 0x5A,
+    0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5E, 0x95, 0xFC, 0xA3, 0xFD,
+    0x3F, 0xD3, 0x0A, 0xDA, 0x70, 0xAD, 0xA7, 0x0E, 0xA2, 0x9A, 0xA2, 0xEA, 0x2E, 0xA1, 0xEA, 0x2E,
+    0xA1, 0xEA, 0x19, 0xF1, 0xEA, 0x19, 0xF1, 0xEA, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9,
+    0x79, 0xE9, 0x79, 0xE9, 0x79, 0xFF, 0xE9, 0xAF, 0xFE, 0x9A, 0xFF, 0xE9, 0xAF, 0xFE, 0x90, 0x0E,
+    0x6E, 0x6E, 0x6D, 0xA5, 0x9D, 0xA0, 0x9E, 0x09, 0xDA, 0x0A, 0xE0, 0x9D, 0xA0, 0xF0, 0x9D, 0x90,
+    0xF0, 0xAD, 0x90, 0xAA, 0xAA, 0x0A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5E,
+    0x95, 0xFC, 0xA3, 0xFD, 0x3F, 0xD3, 0x77, 0x49, 0x77, 0x29, 0xE7, 0x72, 0xE7, 0x72, 0xAD, 0xA7,
+    0x72, 0xE7, 0x72, 0xAD, 0xA7, 0x71, 0x9E, 0x75, 0xAD, 0xA0, 0xE9, 0x75, 0xAD, 0xAA, 0xE7, 0x6F,
+    0xE7, 0x7F, 0xDA, 0x77, 0xFD, 0x77, 0x0F, 0xC9, 0x77, 0x0F, 0xC7, 0x71, 0xF9, 0x77, 0x1E, 0xA7,
+    0x71, 0x9E, 0xA7, 0x71, 0xF9, 0x77, 0x0A, 0xF9, 0x77, 0x9F, 0xC9, 0x77, 0xFD, 0x97, 0x69, 0xFF,
+    0xFD, 0x96, 0xFF, 0xFE, 0x95, 0xAE, 0xAF, 0xFE, 0x94, 0x9E, 0xAA, 0xFF, 0xE9, 0x4F, 0x77, 0x1A,
+    0xE9, 0x77, 0x1F, 0x77, 0x1F, 0x77, 0x19, 0xE9, 0x77, 0x1D, 0x97, 0x77, 0x77, 0x10, 0x7E, 0x73,
+    0xE7, 0x3E, 0x73, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x72, 0x9D, 0xA7, 0x29, 0xDA, 0x72, 0xAD,
+    0xAE, 0x96, 0xAF, 0xC7, 0x9F, 0x96, 0x9F, 0xC9, 0x59, 0xFE, 0x93, 0x9F, 0xA0, 0xAD, 0x96, 0x92,
+    0xE9, 0x72, 0xFC, 0xA7, 0x0F, 0xD7, 0x0F, 0xD1, 0x7A, 0xCA, 0x74, 0xD9, 0x73, 0xAD, 0x74, 0xDA,
+    0x74, 0x99, 0x77, 0x77, 0x77, 0x2E, 0x19, 0xF5, 0xE1, 0x9F, 0x93, 0x9E, 0x19, 0xFA, 0x39, 0xE1,
+    0xAF, 0xC3, 0x9E, 0x1A, 0xFC, 0xA2, 0xAE, 0x1A, 0xFD, 0x2A, 0xE1, 0xFE, 0xA1, 0xAE, 0x1F, 0xAE,
+    0x1A, 0xE1, 0xF0, 0xEA, 0x0E, 0xA1, 0xF0, 0xAE, 0x0E, 0xA1, 0xF9, 0x0E, 0x9E, 0xA1, 0xF9, 0x0A,
+    0xFD, 0xA0, 0x9F, 0x90, 0x9F, 0xD9, 0x09, 0xF9, 0x1F, 0xD9, 0x09, 0xF9, 0x19, 0xFC, 0x90, 0xAF,
+    0x92, 0xFC, 0x90, 0xAF, 0xA2, 0xAF, 0x90, 0x59, 0xD7, 0x0D, 0xA7, 0x9D, 0x97, 0xE7, 0x09, 0x97,
+    0x77, 0x77, 0x1D, 0xA9, 0xEA, 0x3F, 0xFC, 0x91, 0xFC, 0xAF, 0x1E, 0x92, 0xAD, 0x09, 0xE3, 0x9D,
+    0x99, 0xDA, 0x39, 0xD9, 0x9E, 0x3A, 0xDA, 0x9E, 0x3A, 0xDA, 0xAE, 0x3E, 0xAA, 0xE3, 0xFA, 0xE3,
+    0xFF, 0x3F, 0x73, 0xE1, 0x9F, 0x5E, 0x19, 0xF9, 0x39, 0xE1, 0x9F, 0xA3, 0x9E, 0x1A, 0xFC, 0x39,
+    0xE1, 0xAF, 0xCA, 0x2A, 0xE1, 0xAF, 0xD2, 0xAE, 0x1F, 0xEA, 0x1A, 0xE1, 0xFA, 0xE1, 0xAE, 0x1F,
+    0x0E, 0xA0, 0xEA, 0x1F, 0x0A, 0xE0, 0xEA, 0x1F, 0x90, 0xE9, 0xEA, 0x1F, 0x90, 0xAF, 0xDA, 0x09,
+    0xF9, 0x09, 0xFD, 0x90, 0x9F, 0x91, 0xFD, 0x90, 0x9F, 0x91, 0x9F, 0xC9, 0x0A, 0xF9, 0x2F, 0xC9,
+    0x0A, 0xFA, 0x2A, 0xF9, 0x77, 0x5A, 0xF9, 0x71, 0x9F, 0x72, 0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97,
+    0x19, 0xF7, 0x2A, 0xEA, 0x77, 0x60, 0x74, 0xDA, 0x9E, 0xA3, 0xFF, 0xC9, 0x1F, 0xCA, 0xF1, 0xE9,
+    0x2A, 0xD0, 0x9E, 0x39, 0xD9, 0x9D, 0xA3, 0x9D, 0x99, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xAA, 0xE3,
+    0xEA, 0xAE, 0x3F, 0xAE, 0x3F, 0xF3, 0xF7, 0x7F, 0xC6, 0xF9, 0x6F, 0x69, 0xF6, 0xAE, 0xA6, 0xF9,
+    0x59, 0xF4, 0x29, 0xAA, 0x4A, 0xAA, 0x5A, 0xDA, 0x09, 0xE7, 0xAF, 0xD7, 0x1A, 0xF7, 0x3E, 0x75,
+    0x99, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x19, 0xF5, 0xE1, 0x9F, 0x93, 0x9E, 0x19, 0xFA, 0x39, 0xE1,
+    0xAF, 0xC3, 0x9E, 0x1A, 0xFC, 0xA2, 0xAE, 0x1A, 0xFD, 0x2A, 0xE1, 0xFE, 0xA1, 0xAE, 0x1F, 0xAE,
+    0x1A, 0xE1, 0xF0, 0xEA, 0x0E, 0xA1, 0xF0, 0xAE, 0x0E, 0xA1, 0xF9, 0x0E, 0x9E, 0xA1, 0xF9, 0x0A,
+    0xFD, 0xA0, 0x9F, 0x90, 0x9F, 0xD9, 0x09, 0xF9, 0x1F, 0xD9, 0x09, 0xF9, 0x19, 0xFC, 0x90, 0xAF,
+    0x92, 0xFC, 0x90, 0xAF, 0xA2, 0xAF, 0x90, 0x1A, 0xA9, 0x3A, 0xAA, 0x29, 0xDA, 0x09, 0xE4, 0x9F,
+    0xD6, 0x9F, 0x70, 0xAD, 0x97, 0x19, 0x97, 0x77, 0x77, 0x77, 0x1D, 0xA9, 0xEA, 0x4F, 0xFC, 0x92,
+    0xFC, 0xAF, 0x2E, 0x92, 0xAD, 0x19, 0xE3, 0x9D, 0x90, 0x9D, 0xA3, 0x9D, 0x90, 0x9E, 0x3A, 0xDA,
+    0x09, 0xE3, 0xAD, 0xA0, 0xAE, 0x3E, 0xA0, 0xAE, 0x3F, 0x0A, 0xE3, 0xF0, 0xF3, 0xF0, 0x59, 0xE6,
+    0x9E, 0x69, 0xE9, 0x59, 0xEA, 0x59, 0xEA, 0x77, 0x77, 0x77, 0x5D, 0xA9, 0xEA, 0x3F, 0xFC, 0x91,
+    0xFC, 0xAF, 0x1E, 0x92, 0xAD, 0x09, 0xE3, 0x9D, 0x99, 0xDA, 0x39, 0xD9, 0x9E, 0x3A, 0xDA, 0x9E,
+    0x3A, 0xDA, 0xAE, 0x3E, 0xAA, 0xE3, 0xFA, 0xE3, 0xFF, 0x3F, 0x73, 0xE1, 0x9F, 0x5E, 0x19, 0xF9,
+    0x39, 0xE1, 0x9F, 0xA3, 0x9E, 0x1A, 0xFC, 0x39, 0xE1, 0xAF, 0xCA, 0x2A, 0xE1, 0xAF, 0xD2, 0xAE,
+    0x1F, 0xEA, 0x1A, 0xE1, 0xFA, 0xE1, 0xAE, 0x1F, 0x0E, 0xA0, 0xEA, 0x1F, 0x0A, 0xE0, 0xEA, 0x1F,
+    0x90, 0xE9, 0xEA, 0x1F, 0x90, 0xAF, 0xDA, 0x09, 0xF9, 0x09, 0xFD, 0x90, 0x9F, 0x91, 0xFD, 0x90,
+    0x9F, 0x91, 0x9F, 0xC9, 0x0A, 0xF9, 0x2F, 0xC9, 0x0A, 0xFA, 0x2A, 0xF9, 0x71, 0x9F, 0x70, 0xFE,
+    0x79, 0xFD, 0xA7, 0xAF, 0xCA, 0x77, 0x20, 0x74, 0xDA, 0x9E, 0xA3, 0xFF, 0xC9, 0x1F, 0xCA, 0xF1,
+    0xE9, 0x2A, 0xD0, 0x9E, 0x39, 0xD9, 0x9D, 0xA3, 0x9D, 0x99, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xAA,
+    0xE3, 0xEA, 0xAE, 0x3F, 0xAE, 0x3F, 0xF3, 0xF7, 0xF5, 0xFD, 0x4A, 0xFC, 0x94, 0xAF, 0xA7, 0x40,
+    0x69, 0x99, 0x9A, 0xA7, 0x0F, 0xFC, 0x96, 0xAF, 0xFD, 0x69, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9,
+    0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09,
+    0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x29, 0x99, 0x9A,
+    0xAA, 0x2F, 0xFC, 0xA0, 0x9F, 0xFD, 0x09, 0x99, 0x99, 0x97, 0x77, 0x77, 0x49, 0xAD, 0xA9, 0x4F,
+    0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD,
+    0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x20, 0x77, 0x5E,
+    0x29, 0xD9, 0x7A, 0xFF, 0x71, 0xFE, 0xA7, 0x19, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xFA,
+    0x71, 0xFF, 0xCA, 0x59, 0xFF, 0xF4, 0xFA, 0x29, 0xFA, 0x2A, 0xE9, 0x5F, 0x91, 0xF6, 0x9E, 0xA0,
+    0x9E, 0x97, 0xF0, 0xAE, 0x70, 0xAE, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x0A,
+    0xE0, 0xAE, 0xA7, 0xF0, 0x9F, 0xC9, 0x91, 0x9A, 0xFC, 0x1F, 0xFF, 0xEA, 0x1A, 0xFF, 0xFD, 0x92,
+    0xFF, 0xFD, 0x4F, 0xFF, 0x69, 0xAF, 0xDA, 0x97, 0x75, 0x74, 0xAD, 0x91, 0x9D, 0xA1, 0xAF, 0xF9,
+    0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x71, 0x9A, 0xDA, 0x94, 0xFF, 0x2F, 0xAA, 0xEA, 0x09, 0xE3,
+    0xE9, 0xAD, 0x93, 0xAD, 0xAE, 0x93, 0x9D, 0xAA, 0xD9, 0x3A, 0xDA, 0xAE, 0x91, 0x9E, 0x99, 0xFF,
+    0xD1, 0xAF, 0xFA, 0x2F, 0xF4, 0x9A, 0xDA, 0x92, 0x49, 0xE5, 0xE9, 0x3A, 0xE4, 0x9E, 0x93, 0xF4,
+    0xAE, 0x4A, 0xAA, 0x94, 0xAA, 0xA9, 0x77, 0x77, 0x76, 0x9A, 0xFA, 0x72, 0xFF, 0xCA, 0x69, 0xFF,
+    0xF5, 0xFA, 0x29, 0xFA, 0x3A, 0xE9, 0x5F, 0x92, 0xF6, 0x9E, 0xA1, 0x9E, 0x97, 0xF1, 0xAE, 0x70,
+    0xAE, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0xA7, 0xF1, 0x9F,
+    0xC9, 0x91, 0x9A, 0xFC, 0x2F, 0xFF, 0xEA, 0x2A, 0xFF, 0xFD, 0x93, 0xFF, 0xFD, 0x5F, 0xFF, 0x79,
+    0xAF, 0xDA, 0x97, 0x77, 0x39, 0xE5, 0xE9, 0x2A, 0xE4, 0x9E, 0x92, 0xF4, 0xAE, 0x92, 0xAA, 0xA9,
+    0x4A, 0xAA, 0xA9, 0x77, 0x77, 0x73, 0x9A, 0xDA, 0x97, 0x2F, 0xF7, 0x0F, 0xAA, 0xEA, 0x69, 0xE3,
+    0xE9, 0x5A, 0xD9, 0x3A, 0xDA, 0x5E, 0x93, 0x9D, 0xA5, 0xAD, 0x93, 0xAD, 0xA5, 0xAE, 0x91, 0x9E,
+    0x95, 0x9F, 0xFD, 0x7A, 0xFF, 0xA7, 0x0F, 0xF7, 0x29, 0xAD, 0xA9, 0x60, 0x77, 0x75, 0x9A, 0xFA,
+    0xAA, 0xFF, 0xD4, 0xFF, 0xFF, 0xEA, 0x29, 0xFF, 0xFF, 0xF9, 0x2F, 0xA3, 0xFC, 0x71, 0xAE, 0x95,
+    0xF9, 0x70, 0xF6, 0xAF, 0x79, 0xE9, 0x6A, 0xF7, 0xAE, 0x7A, 0xFF, 0x92, 0xAE, 0x7A, 0xFF, 0x92,
+    0xAE, 0x7A, 0xFF, 0x92, 0xAE, 0x7A, 0xF9, 0x6A, 0xEA, 0x6F, 0xC7, 0x9F, 0xC9, 0x39, 0xFC, 0x70,
+    0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFF, 0xFF, 0xCA, 0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF,
+    0xFC, 0x49, 0xAF, 0xFF, 0xFD, 0x97, 0x77, 0x00, 0x29, 0xAE, 0x92, 0x9A, 0xDA, 0x5F, 0xF9, 0xFE,
+    0x92, 0xFA, 0xAF, 0xD9, 0x1A, 0xD1, 0x9E, 0x3F, 0xA9, 0x99, 0x9D, 0xA0, 0xAD, 0x93, 0xAF, 0xFE,
+    0x0E, 0x93, 0x9F, 0xFE, 0x0A, 0xD9, 0x3A, 0xE9, 0x7A, 0xE9, 0x19, 0xF9, 0x79, 0xFF, 0xFC, 0xAA,
+    0xAA, 0xD1, 0xAF, 0xFF, 0xFD, 0x2F, 0xEA, 0x9F, 0xFC, 0x39, 0xAD, 0xA9, 0x2A, 0xAE, 0xA9, 0x10,
+    0x59, 0x97, 0x29, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71, 0xE7, 0x77, 0x73, 0xAF, 0xDA, 0x5A, 0xFF,
+    0xA3, 0xAD, 0x99, 0x99, 0xE3, 0xAD, 0x4D, 0xA2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE9, 0x99,
+    0x9E, 0xA2, 0xFF, 0xD3, 0xFF, 0xC9, 0x3F, 0xFD, 0x3F, 0x90, 0x9E, 0xA1, 0x9F, 0x2A, 0xE1, 0x9F,
+    0x2A, 0xE9, 0x09, 0xF2, 0xAE, 0xA0, 0x9F, 0x2A, 0xF0, 0xAF, 0x2A, 0xF9, 0x9F, 0x2A, 0xFA, 0x39,
+    0x95, 0xAC, 0xA5, 0xD9, 0x4A, 0xD5, 0xDA, 0x75, 0xAD, 0xAA, 0xD9, 0x0A, 0xFD, 0xA0, 0xFE, 0xA0,
+    0xF9, 0x3E, 0xA4, 0xE9, 0x4E, 0x94, 0xE9, 0x4E, 0x93, 0x9E, 0xA3, 0xAF, 0x3A, 0xF3, 0x77, 0x0A,
+    0xF7, 0x0A, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x70, 0xF7, 0x0A, 0xEA, 0x70, 0xF9, 0x77, 0x77, 0x77,
+    0x1A, 0xFD, 0xA5, 0xAF, 0xFA, 0x3A, 0xD9, 0x99, 0x9E, 0x3A, 0xD4, 0xDA, 0x2E, 0x4E, 0x2E, 0x4E,
+    0x2E, 0x4E, 0x2E, 0x99, 0x99, 0xEA, 0x2F, 0xFD, 0x3F, 0xFC, 0x93, 0xFF, 0xD3, 0xF9, 0x09, 0xEA,
+    0x19, 0xF2, 0xAE, 0x19, 0xF2, 0xAE, 0x90, 0x9F, 0x2A, 0xEA, 0x09, 0xF2, 0xAF, 0x0A, 0xF2, 0xAF,
+    0x99, 0xF2, 0xAF, 0xA0, 0x73, 0xFC, 0x4F, 0xA4, 0xF9, 0x4F, 0x4A, 0xEA, 0x4F, 0x94, 0xF7, 0x77,
+    0x2A, 0xDA, 0xAD, 0x91, 0xAF, 0xDA, 0x1F, 0xEA, 0x1F, 0x94, 0xEA, 0x5E, 0x95, 0xE9, 0x5E, 0x95,
+    0xE9, 0x49, 0xEA, 0x4A, 0xF4, 0xAF, 0x30, 0x0E, 0x3A, 0xD4, 0xE9, 0x9E, 0x6F, 0xD7, 0x0F, 0x72,
+    0xD9, 0x77, 0x77, 0x77, 0x0A, 0xFD, 0xA5, 0xAF, 0xFA, 0x3A, 0xD9, 0x99, 0x9E, 0x3A, 0xD4, 0xDA,
+    0x2E, 0x4E, 0x2E, 0x4E, 0x2E, 0x4E, 0x2E, 0x99, 0x99, 0xEA, 0x2F, 0xFD, 0x3F, 0xFC, 0x93, 0xFF,
+    0xD3, 0xF9, 0x09, 0xEA, 0x19, 0xF2, 0xAE, 0x19, 0xF2, 0xAE, 0x90, 0x9F, 0x2A, 0xEA, 0x09, 0xF2,
+    0xAF, 0x0A, 0xF2, 0xAF, 0x99, 0xF2, 0xAF, 0xA0, 0x9D, 0xA3, 0xDA, 0x19, 0xE0, 0xAD, 0xA3, 0x9F,
+    0xCA, 0x59, 0xEA, 0x79, 0xD7, 0x77, 0x7A, 0xDA, 0xAD, 0x93, 0xAF, 0xDA, 0x3F, 0xEA, 0x3F, 0x96,
+    0xEA, 0x7E, 0x97, 0xE9, 0x7E, 0x97, 0xE9, 0x69, 0xEA, 0x6A, 0xF6, 0xAF, 0x40, 0x79, 0x97, 0x49,
+    0xD7, 0x4D, 0xA7, 0x39, 0xD9, 0x73, 0xE7, 0x77, 0x77, 0x3A, 0xAF, 0xAA, 0x59, 0xFF, 0xC5, 0xFF,
+    0xC9, 0x4A, 0xEA, 0x29, 0xA5, 0xEA, 0x73, 0xEA, 0x73, 0xF9, 0x72, 0xAF, 0xCA, 0x97, 0x0F, 0xFC,
+    0x96, 0xFF, 0xD7, 0xAF, 0xF7, 0x19, 0xFC, 0xA7, 0x2A, 0xEA, 0x19, 0xCA, 0x94, 0xAF, 0x1F, 0xCA,
+    0xA9, 0xAF, 0xA0, 0xFF, 0xFD, 0x09, 0xFF, 0xFC, 0x39, 0xAF, 0xDA, 0xA7, 0x73, 0x69, 0x71, 0xD9,
+    0x7A, 0xD7, 0x0D, 0xA7, 0xAD, 0x97, 0x72, 0xAF, 0xCA, 0x3F, 0xF3, 0xD9, 0x29, 0x93, 0xD9, 0x70,
+    0xAE, 0xA9, 0x6A, 0xFD, 0x69, 0xAF, 0x70, 0xEA, 0x1D, 0xA9, 0x99, 0xEA, 0x0F, 0xFD, 0x9A, 0xFF,
+    0xCA, 0x2A, 0xAF, 0xA7, 0x60, 0x6D, 0x74, 0xEA, 0x72, 0xFC, 0xA7, 0x0E, 0xAA, 0xDA, 0x6E, 0x29,
+    0xDA, 0x77, 0x77, 0x77, 0x7A, 0xAF, 0xAA, 0x59, 0xFF, 0xC5, 0xFF, 0xC9, 0x4A, 0xEA, 0x29, 0xA5,
+    0xEA, 0x73, 0xEA, 0x73, 0xF9, 0x72, 0xAF, 0xCA, 0x97, 0x0F, 0xFC, 0x96, 0xFF, 0xD7, 0xAF, 0xF7,
+    0x19, 0xFC, 0xA7, 0x2A, 0xEA, 0x19, 0xCA, 0x94, 0xAF, 0x1F, 0xCA, 0xA9, 0xAF, 0xA0, 0xFF, 0xFD,
+    0x09, 0xFF, 0xFC, 0x39, 0xAF, 0xDA, 0xA7, 0x73, 0x4D, 0x97, 0xAE, 0x6A, 0xFC, 0x4A, 0xDA, 0xAE,
+    0x2A, 0xD9, 0x2E, 0x77, 0x73, 0xAF, 0xCA, 0x3F, 0xF3, 0xD9, 0x29, 0x93, 0xD9, 0x70, 0xAE, 0xA9,
+    0x6A, 0xFD, 0x69, 0xAF, 0x70, 0xEA, 0x1D, 0xA9, 0x99, 0xEA, 0x0F, 0xFD, 0x9A, 0xFF, 0xCA, 0x2A,
+    0xAF, 0xA7, 0x60, 0x4A, 0xAF, 0xAA, 0x59, 0xFF, 0xC5, 0xFF, 0xC9, 0x4A, 0xEA, 0x29, 0xA5, 0xEA,
+    0x73, 0xEA, 0x73, 0xF9, 0x72, 0xAF, 0xCA, 0x97, 0x0F, 0xFC, 0x96, 0xFF, 0xD7, 0xAF, 0xF7, 0x19,
+    0xFC, 0xA7, 0x2A, 0xEA, 0x19, 0xCA, 0x94, 0xAF, 0x1F, 0xCA, 0xA9, 0xAF, 0xA0, 0xFF, 0xFD, 0x09,
+    0xFF, 0xFC, 0x3A, 0xFE, 0xAA, 0x7A, 0xCA, 0x97, 0x3F, 0x97, 0x29, 0x0A, 0xCA, 0x72, 0xF9, 0x72,
+    0xE9, 0x70, 0x76, 0xAF, 0xCA, 0x3F, 0xF3, 0xD9, 0x29, 0x93, 0xD9, 0x70, 0xAE, 0xA9, 0x6A, 0xFD,
+    0x69, 0xAF, 0x70, 0xEA, 0x1D, 0xA9, 0x99, 0xEA, 0x0A, 0xFF, 0xC9, 0xAF, 0xFC, 0xA1, 0xAF, 0xDA,
+    0x5C, 0xA7, 0x09, 0xDA, 0x7A, 0xAD, 0xA6, 0xAE, 0xA6, 0xEA, 0x77, 0x10, 0x2D, 0xA3, 0xAD, 0x6E,
+    0x90, 0xE9, 0x7F, 0xD7, 0x2F, 0x74, 0xD9, 0x74, 0x99, 0x77, 0x77, 0x73, 0xAA, 0xFA, 0xA5, 0x9F,
+    0xFC, 0x5F, 0xFC, 0x94, 0xAE, 0xA2, 0x9A, 0x5E, 0xA7, 0x3E, 0xA7, 0x3F, 0x97, 0x2A, 0xFC, 0xA9,
+    0x70, 0xFF, 0xC9, 0x6F, 0xFD, 0x7A, 0xFF, 0x71, 0x9F, 0xCA, 0x72, 0xAE, 0xA1, 0x9C, 0xA9, 0x4A,
+    0xF1, 0xFC, 0xAA, 0x9A, 0xFA, 0x0F, 0xFF, 0xD0, 0x9F, 0xFF, 0xC3, 0x9A, 0xFD, 0xAA, 0x77, 0x30,
+    0x74, 0x9D, 0xA2, 0xE2, 0x9E, 0x9E, 0x49, 0xFC, 0x69, 0xE7, 0x0A, 0xC9, 0x77, 0x76, 0xAF, 0xCA,
+    0x3F, 0xF3, 0xD9, 0x29, 0x93, 0xD9, 0x70, 0xAE, 0xA9, 0x6A, 0xFD, 0x69, 0xAF, 0x70, 0xEA, 0x1D,
+    0xA9, 0x99, 0xEA, 0x0F, 0xFD, 0x9A, 0xFF, 0xCA, 0x2A, 0xAF, 0xA7, 0x60, 0x9A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x4C, 0xA7, 0x49, 0xCA, 0x97, 0x3F, 0x97, 0x29, 0x0A, 0xCA, 0x72, 0xF9, 0x72, 0xEA,
+    0x50, 0x76, 0x9C, 0xA6, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x94, 0xFF, 0xA0, 0x9F, 0xFC, 0x09, 0xAA,
+    0xEA, 0xAA, 0xA3, 0xE9, 0x6E, 0x7E, 0x7E, 0x7E, 0x7E, 0x96, 0xFD, 0xA3, 0xFE, 0x3F, 0xE3, 0xD7,
+    0x0E, 0xA6, 0xAA, 0xD6, 0xF5, 0x9E, 0x93, 0x2D, 0xA3, 0xAC, 0xA5, 0x9E, 0x09, 0xE7, 0x9F, 0xD7,
+    0x2F, 0x73, 0x9D, 0x97, 0x49, 0x97, 0x77, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+    0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x72, 0xAA,
+    0x72, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xE4, 0x9C, 0xA2, 0xE3, 0xAD, 0x92, 0xE3, 0xAD, 0x97, 0x1A,
+    0xD9, 0x7F, 0xFA, 0x39, 0xFF, 0xC3, 0x9A, 0xAE, 0xAA, 0xAA, 0x6E, 0x97, 0x1E, 0x72, 0xE7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x97, 0x1F, 0xDA, 0x6F, 0xE6, 0xAF, 0xD7, 0x71, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xA9, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF7, 0x09, 0x99, 0xF9, 0x99, 0x49, 0xFF, 0xD4, 0x9F, 0xFD, 0x70, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x77, 0x09, 0xCA, 0x7A, 0xD9, 0x7A, 0xD9, 0x7A, 0xD9, 0x5F,
+    0xFA, 0x19, 0xFF, 0xC1, 0x9A, 0xAE, 0xAA, 0xAA, 0x4E, 0x93, 0xAF, 0xFD, 0x0A, 0xFF, 0xD0, 0x99,
+    0x99, 0xEA, 0x99, 0x94, 0xE7, 0x0E, 0x97, 0xFD, 0xA4, 0xFE, 0x4A, 0xFD, 0x74, 0x4D, 0xA0, 0x9C,
+    0x70, 0xAE, 0xA9, 0xC9, 0x7D, 0x0F, 0x97, 0xD1, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAF, 0x49,
+    0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49,
+    0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA,
+    0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF,
+    0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x2A, 0xCA, 0x09, 0xC9, 0x39, 0xEA, 0x0C, 0xA3,
+    0xAC, 0x9D, 0x9C, 0xA3, 0xD9, 0xAE, 0x93, 0xAC, 0x90, 0xAC, 0xA7, 0x77, 0x76, 0xE4, 0xE0, 0xAD,
+    0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9, 0x9E,
+    0x29, 0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0x77, 0x2A,
+    0xAA, 0xAF, 0xC5, 0x9F, 0xFC, 0xA4, 0xAF, 0xFA, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAF, 0x49,
+    0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49,
+    0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA,
+    0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF,
+    0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x09, 0x9A, 0xAA, 0xAE, 0x91, 0xFF, 0xCA, 0x09,
+    0xFF, 0xD7, 0x77, 0x77, 0x70, 0xE4, 0xE0, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4,
+    0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9, 0x9E, 0x29, 0xE9, 0x0F, 0xA9, 0xFA, 0x0F, 0xFD, 0xA0,
+    0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA0, 0x77, 0x2E, 0x91, 0xAD, 0x95, 0xAF, 0xF7, 0xFE, 0x97, 0x0A,
+    0xEA, 0x97, 0x77, 0x77, 0x77, 0x74, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF,
+    0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0,
+    0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE,
+    0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20,
+    0x74, 0xAD, 0x91, 0x9D, 0xA1, 0x9F, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x6E, 0x4E, 0x0A,
+    0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x99, 0xD9, 0x3E, 0x99, 0xD9, 0x3E, 0x99,
+    0xE2, 0x9E, 0x90, 0xFA, 0x9F, 0xA0, 0xFF, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFA, 0xEA, 0x5A, 0xCA,
+    0x73, 0xAE, 0xA7, 0x2D, 0x0D, 0x72, 0xFC, 0x73, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAF, 0x49,
+    0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49,
+    0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA,
+    0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF,
+    0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x39, 0xAA, 0x79, 0xF6, 0xAC, 0x9D, 0x6A, 0xF7,
+    0xE9, 0x77, 0x77, 0x77, 0x3E, 0x4E, 0x0A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E,
+    0x99, 0xD9, 0x3E, 0x99, 0xD9, 0x3E, 0x99, 0xE2, 0x9E, 0x90, 0xFA, 0x9F, 0xA0, 0xFF, 0xDA, 0x09,
+    0xFF, 0xCA, 0x19, 0xFA, 0xEA, 0x4A, 0xAA, 0x5A, 0xAA, 0x92, 0x9E, 0x94, 0xEA, 0x2A, 0xE9, 0x39,
+    0xEA, 0x2A, 0xE9, 0x3A, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAF, 0x49, 0xF2, 0xAF, 0x49, 0xF2,
+    0xAF, 0x49, 0xF2, 0xAF, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F,
+    0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA5, 0xF2, 0x9E, 0xA5, 0xEA, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA4,
+    0x9E, 0xA3, 0xF4, 0xAE, 0xA3, 0xFF, 0xFC, 0x93, 0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0x5F, 0xFE, 0x96,
+    0xAF, 0xF9, 0x77, 0x60, 0x4A, 0xAA, 0x59, 0xAA, 0x93, 0xEA, 0x4A, 0xE2, 0x9E, 0xA4, 0xEA, 0x2A,
+    0xE9, 0x39, 0xEA, 0x77, 0x77, 0x77, 0x72, 0xE4, 0xE6, 0xAD, 0x4E, 0x95, 0xAD, 0x4E, 0x95, 0xAD,
+    0x4E, 0x95, 0xAD, 0x4E, 0x95, 0x9D, 0x93, 0xE9, 0x59, 0xD9, 0x3E, 0x95, 0x9E, 0x29, 0xE9, 0x6F,
+    0xA9, 0xFA, 0x6F, 0xFD, 0xA6, 0x9F, 0xFC, 0xA7, 0x9F, 0xAE, 0xA3, 0xAF, 0x49, 0xF0, 0xAF, 0x49,
+    0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4,
+    0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0, 0x9E,
+    0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F, 0xFE,
+    0x94, 0xAF, 0xF9, 0x72, 0xE7, 0x39, 0xD7, 0x49, 0xF7, 0x3F, 0x97, 0x49, 0x93, 0xE4, 0xE0, 0xAD,
+    0x4E, 0x9A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A, 0xD9, 0x3E, 0x99, 0xD9, 0x3E, 0x99, 0xDA, 0x3E, 0x99,
+    0xE2, 0xAE, 0x90, 0xFF, 0xDA, 0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA6, 0x9D, 0x96,
+    0x9D, 0x97, 0xAD, 0x9A, 0x69, 0xF7, 0x9E, 0x74, 0x72, 0xD9, 0x77, 0x3A, 0xE7, 0x72, 0xAF, 0xC7,
+    0x70, 0xAD, 0xAA, 0xE7, 0x6A, 0xD9, 0x2E, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9E, 0xA7, 0x5A, 0xE0,
+    0x9F, 0x75, 0xF1, 0xF7, 0x49, 0xEA, 0x1F, 0x97, 0x3A, 0xE9, 0x1A, 0xEA, 0x73, 0xF9, 0x1A, 0xF3,
+    0xAD, 0xA3, 0xF2, 0x9F, 0x3F, 0x29, 0xF3, 0xF9, 0x1A, 0xF9, 0x1A, 0xEA, 0x3F, 0x91, 0xFD, 0x1F,
+    0x93, 0xAE, 0xA0, 0xAF, 0xD9, 0x0F, 0x49, 0xF0, 0xFF, 0x9F, 0x49, 0xFF, 0xFF, 0xCA, 0x5F, 0xFA,
+    0xAF, 0xE9, 0x5F, 0xF1, 0xFE, 0x6A, 0xFE, 0x1F, 0xE6, 0x9F, 0xD9, 0x19, 0xFC, 0xA7, 0xFD, 0x3F,
+    0xC9, 0x7F, 0xCA, 0x3F, 0xC4, 0x7D, 0x75, 0xEA, 0x73, 0xFC, 0xA7, 0x1E, 0xAA, 0xDA, 0x7E, 0x29,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x6A, 0xDA, 0x70, 0x9E, 0x9E, 0x70, 0xEA, 0x0E, 0x39, 0x92, 0xE9,
+    0x0E, 0x91, 0xE1, 0x9E, 0x1A, 0xDA, 0x0A, 0xEA, 0x0A, 0xDA, 0x19, 0xE0, 0xFC, 0x0E, 0x92, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xC3, 0xAF, 0xFE, 0xA3, 0x9F, 0xCA, 0xFC, 0x94, 0xFC, 0x0F, 0xC5, 0xF9, 0x09,
+    0xF5, 0x9A, 0xA9, 0x29, 0xAA, 0x92, 0x6A, 0xCA, 0x74, 0x9E, 0x73, 0x9F, 0xC7, 0x19, 0xE9, 0xE7,
+    0x9D, 0xA2, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9E, 0x96, 0xF1, 0xF5, 0x9E, 0x91, 0x9E,
+    0x94, 0xF3, 0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE, 0x90, 0xF7, 0xFA, 0xEA,
+    0x7A, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97,
+    0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0x77, 0x3A, 0xCA, 0x71, 0x9E, 0x97, 0x9F, 0xC9, 0x5A,
+    0xDA, 0x9E, 0x93, 0xAD, 0x92, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x76, 0xAE, 0x5E, 0x1E, 0x93, 0xAD,
+    0xA1, 0xAE, 0x3E, 0x92, 0xE9, 0x2E, 0x3A, 0xE1, 0x9D, 0xA4, 0xEA, 0x0E, 0x94, 0xAE, 0x9E, 0x6F,
+    0xDA, 0x6A, 0xFC, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1F, 0x59, 0xAA, 0xFA,
+    0x5A, 0xFD, 0x6A, 0xFC, 0x96, 0xAE, 0xA7, 0x29, 0xE1, 0xAD, 0xA6, 0xAE, 0x1E, 0xA6, 0xAE, 0x1F,
+    0x6F, 0x90, 0xF6, 0xAA, 0xAA, 0x90, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9E, 0x96,
+    0xF1, 0xF5, 0x9E, 0x91, 0x9E, 0x94, 0xF3, 0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95,
+    0xAE, 0x90, 0xF7, 0xFA, 0xEA, 0x7A, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F,
+    0x97, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0x7D, 0x97, 0x4A, 0xD7,
+    0x5D, 0xA7, 0x49, 0xD9, 0x74, 0x99, 0x97, 0x77, 0x19, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0xC3, 0xFF, 0xFC, 0x71, 0xAF, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x09,
+    0xFD, 0x70, 0x9F, 0xD9, 0x79, 0xFD, 0xA7, 0x9F, 0xDA, 0x79, 0xFE, 0x70, 0xFE, 0xAA, 0xAA, 0xAA,
+    0x91, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFE, 0x00, 0x69, 0x97,
+    0x1A, 0xCA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x77, 0x77, 0x75, 0xFF, 0xD2, 0xFF, 0xD2, 0x9A,
+    0xAA, 0xAF, 0xA6, 0x9E, 0xA6, 0x9F, 0x69, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x69, 0xFF, 0xD1, 0xAF,
+    0xFD, 0x90, 0xAF, 0xFE, 0x00, 0x59, 0xE7, 0x4A, 0xE7, 0x4A, 0xE7, 0x4F, 0x97, 0x3A, 0xAA, 0xA7,
+    0x77, 0x09, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0xFF, 0xFC, 0x71, 0xAF, 0xC9, 0x70,
+    0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x09, 0xFD, 0x70, 0x9F, 0xD9, 0x79, 0xFD, 0xA7,
+    0x9F, 0xDA, 0x79, 0xFE, 0x70, 0xFE, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD1,
+    0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFE, 0x00, 0x49, 0xAA, 0x71, 0xE9, 0x70, 0xEA, 0x79, 0xEA, 0x7A,
+    0xF7, 0x77, 0x77, 0x4F, 0xFD, 0x2F, 0xFD, 0x29, 0xAA, 0xAA, 0xFA, 0x69, 0xEA, 0x69, 0xF6, 0x9F,
+    0x6A, 0xF6, 0xAF, 0x6A, 0xF6, 0x9F, 0xFD, 0x1A, 0xFF, 0xD9, 0x0A, 0xFF, 0xE0, 0x2A, 0xA9, 0x4A,
+    0xA6, 0x9E, 0x1A, 0xDA, 0x79, 0xFD, 0xA7, 0x2F, 0xA7, 0x39, 0xE7, 0x59, 0xA7, 0x77, 0x77, 0x29,
+    0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0xFF, 0xFC, 0x71, 0xAF, 0xC9, 0x70, 0xAF, 0xCA,
+    0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x09, 0xFD, 0x70, 0x9F, 0xD9, 0x79, 0xFD, 0xA7, 0x9F, 0xDA,
+    0x79, 0xFE, 0x70, 0xFE, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD1, 0xAF, 0xFF,
+    0xD9, 0x0A, 0xFF, 0xFE, 0x00, 0x09, 0xDA, 0x29, 0xDA, 0x29, 0xE0, 0xAD, 0xA4, 0x9F, 0xCA, 0x69,
+    0xEA, 0x70, 0xAD, 0x77, 0x77, 0x77, 0x72, 0xFF, 0xD2, 0xFF, 0xD2, 0x9A, 0xAA, 0xAF, 0xA6, 0x9E,
+    0xA6, 0x9F, 0x69, 0xF6, 0xAF, 0x6A, 0xF6, 0xAF, 0x69, 0xFF, 0xD1, 0xAF, 0xFD, 0x90, 0xAF, 0xFE,
+    0x00, 0x19, 0xEA, 0x90, 0x9F, 0xCA, 0x0F, 0xDA, 0x0E, 0xA3, 0xE4, 0xE4, 0xE4, 0xDA, 0x39, 0xE3,
+    0x9E, 0x39, 0xE3, 0x9E, 0x39, 0xE3, 0x9E, 0x39, 0xE3, 0x9E, 0x92, 0xAE, 0x92, 0x76, 0x9A, 0xA7,
+    0x70, 0xD9, 0x49, 0xAF, 0xA3, 0xD4, 0xFF, 0xCA, 0x0A, 0xD2, 0x9F, 0xFF, 0xDA, 0x2F, 0xA2, 0x9F,
+    0xCA, 0x2A, 0xE9, 0x5F, 0x3F, 0x69, 0xEA, 0x19, 0xE9, 0x7F, 0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0x70,
+    0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0xAE, 0x1A, 0xEA, 0x7F, 0x19, 0xFC, 0x99, 0x19, 0xAF,
+    0xC2, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xD9, 0x3F, 0xFF, 0xD5, 0xFF, 0xF7, 0x9A, 0xFD, 0xA9, 0x77,
+    0x70, 0x72, 0x97, 0x4D, 0x39, 0xAD, 0xA9, 0x1D, 0x2F, 0xEA, 0x9D, 0x1F, 0xAA, 0xFC, 0xA0, 0x9E,
+    0x3F, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D, 0xA1, 0xAD, 0x93, 0xAD, 0xA1, 0xAE, 0x91, 0x9E,
+    0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69, 0xAD, 0xA9, 0x40, 0x39, 0xAA, 0xAA, 0xAA, 0x99,
+    0x5A, 0xFF, 0xE9, 0x29, 0xFF, 0xFC, 0x91, 0xFE, 0x92, 0x9E, 0x1E, 0x9E, 0x93, 0xAD, 0x90, 0xDA,
+    0x0E, 0x93, 0xAD, 0xA0, 0xD9, 0x0E, 0x92, 0x9E, 0xA0, 0xAC, 0x90, 0xFF, 0xE9, 0x1C, 0x90, 0xFF,
+    0xE2, 0x99, 0x0F, 0xFD, 0x95, 0xFF, 0xC6, 0x9F, 0xA9, 0x97, 0x09, 0xEA, 0x73, 0x9E, 0xA7, 0x39,
+    0xF7, 0x39, 0xF7, 0x3A, 0xF7, 0x3A, 0xF7, 0x19, 0xAD, 0x97, 0x0F, 0x97, 0x9F, 0x97, 0x9D, 0xA0,
+    0x9A, 0xA9, 0x49, 0xEA, 0xFC, 0x39, 0xFF, 0xD2, 0x9F, 0xC1, 0x9D, 0x91, 0x9F, 0x39, 0xD1, 0x9F,
+    0x4D, 0x19, 0xF4, 0xD1, 0x9F, 0x4D, 0x90, 0x9F, 0x4D, 0x19, 0xFA, 0x2E, 0x19, 0xFF, 0xDA, 0x19,
+    0xFF, 0xD2, 0xAF, 0xFC, 0x3E, 0xA0, 0x9A, 0xA9, 0x4E, 0xA7, 0x1E, 0x97, 0x09, 0xE9, 0x70, 0xAE,
+    0x71, 0xF7, 0x19, 0x97, 0x30, 0xFF, 0xD9, 0xFF, 0xD9, 0xFA, 0xAA, 0xAA, 0xA1, 0xEA, 0x69, 0xE9,
+    0x69, 0xE9, 0x69, 0xE7, 0xAD, 0xA7, 0xD9, 0x59, 0xDA, 0x5A, 0xE4, 0x9F, 0x5F, 0xFD, 0x9F, 0xFD,
+    0x9F, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x90, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xA0, 0xAF, 0xFF, 0xEA, 0x1C, 0x4F, 0x75, 0xF7, 0x5F, 0x75,
+    0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF5,
+    0x5A, 0xC9, 0x59, 0xEA, 0x5F, 0x94, 0x9F, 0x94, 0x9D, 0xA6, 0xAD, 0x96, 0xAD, 0x96, 0xAD, 0x94,
+    0xFF, 0xA0, 0x9F, 0xFC, 0x09, 0xAA, 0xEA, 0xAA, 0xA3, 0xE9, 0x6E, 0x7E, 0x7E, 0x7E, 0x7E, 0x96,
+    0xFD, 0xA3, 0xFE, 0x3A, 0xFD, 0x73, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF, 0xFF,
+    0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7,
+    0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x97, 0x2F, 0xD7, 0x1A, 0xFC, 0x97,
+    0x1A, 0xF9, 0x73, 0xAD, 0x92, 0x75, 0x99, 0x97, 0x69, 0xD7, 0x69, 0xD7, 0x6A, 0xD0, 0xAF, 0x49,
+    0xFC, 0x90, 0xAF, 0x49, 0xFA, 0x1A, 0xF4, 0x9F, 0x2A, 0xF4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E,
+    0xA4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x5F, 0x29, 0xEA, 0x5E, 0xA2,
+    0x9E, 0xA5, 0xEA, 0x29, 0xEA, 0x49, 0xEA, 0x3F, 0x4A, 0xEA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC9,
+    0x3A, 0xFF, 0xF5, 0xFF, 0xE9, 0x6A, 0xFF, 0x97, 0x76, 0x77, 0x70, 0xDA, 0x72, 0xAD, 0x72, 0xDA,
+    0xE4, 0xFC, 0x9A, 0xD4, 0xFA, 0x0A, 0xD4, 0xE9, 0x1A, 0xD4, 0xE9, 0x1A, 0xD4, 0xE9, 0x19, 0xD9,
+    0x3E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xE2, 0x9E, 0x92, 0xFA, 0x9F, 0xA2, 0xFF, 0xDA, 0x29, 0xFF,
+    0xCA, 0x39, 0xFA, 0xEA, 0x10, 0x0E, 0x95, 0xEA, 0x5E, 0xA5, 0x9A, 0xAA, 0x00, 0x19, 0xD2, 0xDA,
+    0x19, 0xD9, 0x1E, 0x29, 0x92, 0x39, 0xD7, 0x0E, 0xA6, 0xFC, 0xA4, 0xE9, 0xAD, 0xA2, 0xE2, 0x9D,
+    0xA7, 0x40, 0x0A, 0xCA, 0x09, 0xC9, 0x9E, 0xA9, 0xCA, 0xAC, 0x9D, 0x9C, 0xAD, 0x09, 0xE0, 0x9A,
+    0x19, 0xA9, 0x00, 0x75, 0xAA, 0xAF, 0xD1, 0x9F, 0xFC, 0x90, 0xFE, 0xAA, 0xA9, 0x79, 0x99, 0x99,
+    0x91, 0x9F, 0xFF, 0x1F, 0xFF, 0xCA, 0x09, 0x74, 0x73, 0xE2, 0xAD, 0x90, 0xFF, 0xC1, 0x9F, 0xE9,
+    0x29, 0xFC, 0x97, 0x40, 0x0E, 0x09, 0xE9, 0xAE, 0x9A, 0xEA, 0x9A, 0xAA, 0x90, 0x0E, 0x1E, 0x1E,
+    0x1E, 0x09, 0xE0, 0x9E, 0x0A, 0xE9, 0xAE, 0x90, 0x09, 0x3E, 0x29, 0xC1, 0x9C, 0xA1, 0xAA, 0x10,
+    0x0A, 0xCA, 0x0A, 0xEA, 0xD9, 0xDA, 0xEA, 0x0A, 0xCA, 0x00, 0x4E, 0x94, 0xAD, 0xA3, 0x9E, 0x94,
+    0xEA, 0x3A, 0xE9, 0x39, 0xEA, 0x3A, 0xAA, 0xA9, 0x39, 0xAA, 0xA9, 0x30, 0x74, 0xE2, 0x9D, 0xA2,
+    0xE9, 0xAD, 0xA4, 0xFC, 0xA6, 0xEA, 0x79, 0xD4, 0x9E, 0x5E, 0x94, 0x9E, 0x94, 0xEA, 0x5E, 0xA4,
+    0xF5, 0x9A, 0xAA, 0x49, 0xAA, 0xA0, 0x6A, 0xF1, 0x9F, 0x2F, 0x2F, 0x91, 0xAE, 0xA2, 0xF2, 0xF9,
+    0x1F, 0xC2, 0xFA, 0x2F, 0x92, 0xF2, 0xAE, 0xA2, 0xF9, 0x2F, 0x72, 0x0F, 0xC2, 0xFA, 0x2A, 0xEA,
+    0x29, 0xF3, 0xF3, 0xFA, 0x29, 0xF7, 0x00, 0x1A, 0xA2, 0xD9, 0xF9, 0xF9, 0x1D, 0x91, 0xD9, 0x9A,
+    0x2D, 0x91, 0xF9, 0xF9, 0xDA, 0x1A, 0xC9, 0x10, 0xEA, 0xAA, 0xA9, 0x90, 0xFF, 0xC0, 0x9A, 0xAA,
+    0xAA, 0xE6, 0xAD, 0x6A, 0xD6, 0xAD, 0x00, 0x1C, 0xA2, 0xD9, 0x1D, 0x90, 0xE0, 0x9D, 0xA1, 0xA9,
+    0x10, 0x4A, 0xC0, 0xAD, 0x0D, 0x90, 0xAD, 0x1A, 0xC4, 0x09, 0xD2, 0x9D, 0x1F, 0xC9, 0xFC, 0x99,
+    0x99, 0x99, 0x00, 0xFC, 0x9F, 0xC9, 0x9A, 0xD9, 0x19, 0xD7, 0x1A, 0x3C, 0x90, 0xAF, 0x1C, 0x92,
+    0x91, 0x75, 0xAA, 0xFE, 0x1A, 0xFF, 0xC9, 0x0F, 0xEA, 0xAA, 0x90, 0x09, 0xAA, 0x91, 0xEA, 0x1E,
+    0xA1, 0xF0, 0x9F, 0x00, 0x0E, 0x1E, 0x1E, 0x1E, 0x09, 0xE0, 0x9E, 0x0A, 0xE9, 0xAE, 0x90, 0x0A,
+    0xCA, 0x0A, 0xEA, 0xD9, 0xDA, 0xEA, 0x0A, 0xCA, 0x00, 0x7A, 0xF9, 0x0A, 0xF1, 0x9F, 0x1A, 0xE9,
+    0x1F, 0x19, 0xF1, 0xFA, 0x10, 0x1A, 0xA3, 0xCA, 0x2A, 0xDA, 0x1C, 0xAD, 0xA2, 0x9C, 0xA0, 0xAE,
+    0x90, 0xEA, 0x00, 0x7A, 0xD1, 0xAD, 0xA0, 0x9D, 0xA1, 0xAD, 0x2A, 0xFA, 0x0F, 0xA1, 0x9A, 0xC9,
+    0x0A, 0xD9, 0x0A, 0xD9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x90, 0x9F, 0xEA, 0x9F, 0xEA,
+    0x9E, 0xAE, 0xA9, 0xDA, 0x09, 0xDA, 0x9D, 0xA0, 0x9D, 0xA0, 0x0E, 0x4A, 0xD9, 0x1E, 0xA1, 0xEA,
+    0x3F, 0xEA, 0x5F, 0xCA, 0x7E, 0xA7, 0x09, 0xD4, 0x49, 0xD7, 0x1E, 0xA7, 0xFC, 0x95, 0xFE, 0x93,
+    0xEA, 0x09, 0xE9, 0x1E, 0x93, 0xAD, 0x90, 0x0A, 0xD9, 0x09, 0xCA, 0x9F, 0x09, 0xCA, 0xAF, 0xCA,
+    0xCA, 0xAC, 0xA0, 0xF9, 0x9C, 0xA1, 0xDA, 0x71, 0x72, 0xFF, 0x99, 0xFF, 0xA9, 0x99, 0x99, 0x40,
+    0x09, 0xAA, 0xAA, 0xF1, 0xFF, 0xC9, 0x9F, 0xFC, 0x97, 0x20, 0x0A, 0xD9, 0x09, 0xCA, 0x9F, 0x09,
+    0xCA, 0xAF, 0xCA, 0xCA, 0xAC, 0xA0, 0xF9, 0x9C, 0xA1, 0xDA, 0x71, 0x09, 0x99, 0x99, 0x99, 0x99,
+    0x9A, 0xFF, 0xDA, 0xFF, 0xD0, 0x5C, 0xA2, 0xE2, 0xD1, 0xAD, 0x1E, 0x1D, 0x60, 0x99, 0x7E, 0x91,
+    0xE0, 0xE9, 0x1E, 0x0F, 0xFC, 0x0F, 0xFC, 0x0F, 0xFC, 0x72, 0x9F, 0xE9, 0x9F, 0xE9, 0x9D, 0x99,
+    0x9D, 0x99, 0xD2, 0xD9, 0x9D, 0x99, 0x9D, 0x99, 0xFE, 0x99, 0xFE, 0x90, 0x1A, 0xCA, 0xAC, 0x91,
+    0xAF, 0xD1, 0xD0, 0xDA, 0xC9, 0x0C, 0xA0, 0xCA, 0x9C, 0x90, 0xCA, 0x0C, 0xA9, 0xC7, 0x10, 0x1A,
+    0x1A, 0x2A, 0xD9, 0x3D, 0x3A, 0xD9, 0x1A, 0xC0, 0xAC, 0x00, 0x0A, 0xCA, 0x09, 0xC9, 0x9E, 0xA9,
+    0xCA, 0xAC, 0x9D, 0x9C, 0xAD, 0x09, 0xE0, 0x9A, 0x19, 0xA9, 0x00, 0x3A, 0xC9, 0x0E, 0x09, 0xDA,
+    0xAD, 0x09, 0x91, 0x4D, 0x6A, 0xD6, 0xD9, 0x5A, 0xD6, 0x99, 0x97, 0x77, 0x77, 0x77, 0x79, 0xDA,
+    0x09, 0xDA, 0x09, 0xDA, 0x09, 0xDA, 0x0A, 0xE0, 0xAE, 0x0F, 0x0F, 0x00, 0x9F, 0xEA, 0x9F, 0xEA,
+    0x9E, 0xAE, 0xA9, 0xDA, 0x09, 0xDA, 0x9D, 0x90, 0x9D, 0xA0, 0x19, 0xAA, 0xAA, 0xF1, 0x9F, 0xFC,
+    0x90, 0xFF, 0xD9, 0x77, 0x71, 0xFF, 0xC1, 0xAF, 0xFC, 0x90, 0xDA, 0xAA, 0xAA, 0xAA, 0x99, 0x70,
+    0xAD, 0x19, 0xD9, 0xAD, 0x19, 0xD9, 0xAD, 0x1A, 0xD9, 0xE1, 0xAD, 0x9E, 0x1A, 0xD9, 0xE1, 0xE9,
+    0xFC, 0xAA, 0xFF, 0xFD, 0x29, 0xE2, 0x9E, 0x29, 0xAA, 0xA0, 0x77, 0x0A, 0xC3, 0x9D, 0xA0, 0xF1,
+    0xFD, 0xAD, 0x09, 0xDA, 0xFD, 0x09, 0xD0, 0x9F, 0xA0, 0x9D, 0x09, 0xEA, 0x5D, 0x70, 0xD7, 0x9C,
+    0xA7, 0xAC, 0x97, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0xCA, 0x77, 0x10, 0x7A, 0xCA, 0x77, 0xE7, 0x7E,
+    0x76, 0x9E, 0x97, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xAA, 0x94, 0x99, 0x99, 0x29, 0xFE, 0xA2, 0x9F,
+    0x1F, 0xFD, 0x90, 0x9F, 0x0A, 0xF1, 0xFF, 0xDA, 0x0F, 0xC2, 0xAF, 0xF2, 0xAA, 0xAA, 0x0D, 0xA0,
+    0x9A, 0xDA, 0x97, 0x0E, 0x77, 0xE7, 0x79, 0x99, 0x71, 0x74, 0xAE, 0xA2, 0xCA, 0x99, 0xFD, 0x1D,
+    0xAA, 0xD9, 0x9D, 0xA9, 0xDA, 0xE9, 0x0A, 0xFC, 0x95, 0x9E, 0x97, 0x5A, 0xEA, 0x2C, 0xA9, 0x9F,
+    0xD1, 0xDA, 0xE9, 0x9F, 0xD9, 0xAD, 0x90, 0x9F, 0xC7, 0x99, 0x91, 0x77, 0x3A, 0x2A, 0x39, 0xDA,
+    0x0E, 0x4A, 0x29, 0x77, 0x20, 0x1A, 0x2A, 0xCA, 0x2C, 0x39, 0x10, 0x77, 0x39, 0x97, 0x5C, 0x1D,
+    0xA7, 0x3D, 0x91, 0xE9, 0x69, 0xAD, 0xA3, 0xAF, 0xFF, 0x96, 0x9A, 0xFD, 0xA9, 0x30, 0x49, 0xAA,
+    0xEA, 0xA9, 0x7A, 0xFF, 0xF9, 0x3E, 0xA9, 0x5A, 0xEA, 0x1D, 0xA7, 0x29, 0xD9, 0x09, 0xA7, 0x5C,
+    0x77, 0x30, 0x77, 0x77, 0x49, 0xA4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xDA, 0x91,
+    0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x97, 0x79, 0xD9, 0x77, 0x19, 0x94, 0x6A, 0xE7, 0x5F, 0x74,
+    0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1,
+    0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF,
+    0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90, 0xAF, 0xEA,
+    0x93, 0xAF, 0xFC, 0xA2, 0xAE, 0xAA, 0xAF, 0x91, 0xAE, 0x39, 0xE1, 0xAE, 0x4E, 0x1A, 0xE4, 0xE1,
+    0xAE, 0x3A, 0xE1, 0xAF, 0xFD, 0x2A, 0xFF, 0xD9, 0x1A, 0xFF, 0xE9, 0x0A, 0xE3, 0x9F, 0x0A, 0xE4,
+    0x9E, 0x9A, 0xE4, 0x9E, 0xAA, 0xEA, 0xAA, 0xAA, 0xF9, 0xAF, 0xFF, 0x9A, 0xFF, 0xF0, 0xAF, 0xFE,
+    0x90, 0xAF, 0xFC, 0xA2, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+    0xE6, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0x95, 0xE9, 0x5E, 0xA5, 0x99, 0x96, 0x77, 0x5F, 0x72, 0x9F,
+    0xA7, 0x1F, 0xD7, 0x09, 0xFD, 0x97, 0xFA, 0xE6, 0x9E, 0x99, 0xE9, 0x5F, 0x1F, 0x49, 0xEA, 0x1A,
+    0xE9, 0x3F, 0x3F, 0x29, 0xEA, 0x3F, 0x2F, 0x93, 0x9E, 0xA0, 0x9F, 0x5F, 0x0A, 0xEA, 0x5A, 0xEA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9,
+    0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9,
+    0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF,
+    0xFE, 0x9A, 0xFF, 0xEA, 0x09, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0xC3, 0xFF, 0xFC, 0x71,
+    0xAF, 0xC9, 0x70, 0xAF, 0xCA, 0x70, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x09, 0xFD, 0x70, 0x9F, 0xD9,
+    0x79, 0xFD, 0xA7, 0x9F, 0xDA, 0x79, 0xFE, 0x70, 0xFE, 0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFF, 0xD1,
+    0xAF, 0xFF, 0xD1, 0xAF, 0xFF, 0xD9, 0x0A, 0xFF, 0xFE, 0x00, 0x0E, 0x95, 0xF1, 0xE9, 0x5F, 0x1E,
+    0x95, 0xF1, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA, 0x5F, 0x09, 0xEA, 0x5F,
+    0x09, 0xEA, 0x5F, 0x09, 0xF5, 0xF0, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD0, 0x9F, 0xFF, 0xD9, 0xAF,
+    0xFF, 0xD9, 0xAF, 0xAA, 0xAA, 0xAA, 0xF9, 0xAF, 0x49, 0xF9, 0xAF, 0x49, 0xF9, 0xAF, 0x49, 0xF9,
+    0x49, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F,
+    0x69, 0xEA, 0x09, 0xE9, 0x59, 0x0F, 0x0A, 0xE0, 0xAF, 0xD9, 0xAE, 0x0A, 0xE0, 0xFE, 0xA9, 0xE0,
+    0xAE, 0x9A, 0xAA, 0x99, 0x99, 0x99, 0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99,
+    0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD,
+    0xA9, 0x77, 0x50, 0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E,
+    0x90, 0xE9, 0x0E, 0x99, 0xEA, 0x9E, 0xA9, 0xEA, 0xAF, 0xAF, 0x1E, 0xA1, 0x9F, 0x4E, 0xA1, 0xF9,
+    0x4E, 0x90, 0x9F, 0x5E, 0x90, 0xF6, 0xE0, 0xAE, 0xA5, 0x9E, 0x9F, 0x69, 0xEA, 0xE9, 0x6A, 0xFE,
+    0x7A, 0xFD, 0x70, 0xAF, 0xCA, 0x70, 0xFD, 0x97, 0x0F, 0xE9, 0x7F, 0xF9, 0x6F, 0xFC, 0xA4, 0x9E,
+    0xA9, 0xFC, 0xA3, 0x9E, 0xA0, 0xAF, 0xCA, 0x29, 0xEA, 0x1F, 0xE1, 0xAE, 0xA2, 0xFE, 0x00, 0x5F,
+    0xCA, 0x72, 0xAF, 0xD7, 0x2F, 0xE7, 0x2F, 0xEA, 0x70, 0x9F, 0xF7, 0x0F, 0xFC, 0x70, 0xFF, 0xCA,
+    0x69, 0xF0, 0xFC, 0x6A, 0xEA, 0x09, 0xF6, 0xF9, 0x1F, 0x94, 0x9F, 0x2A, 0xF4, 0xAE, 0xA3, 0xF4,
+    0xF4, 0xF9, 0x29, 0xEA, 0x49, 0xF2, 0xAE, 0x95, 0xF2, 0xF6, 0x9E, 0x91, 0xEA, 0x7E, 0xA0, 0x9E,
+    0x70, 0xAE, 0x00, 0x0F, 0xA6, 0xF1, 0xFC, 0x5A, 0xF1, 0xFC, 0x94, 0xFC, 0x1F, 0xCA, 0x39, 0xFC,
+    0x90, 0xFD, 0x3F, 0xD9, 0x0F, 0xDA, 0x2F, 0xD9, 0x0F, 0xE1, 0xAF, 0xD9, 0x9F, 0xE9, 0x0F, 0xE9,
+    0x9E, 0xAE, 0xA9, 0xEA, 0xE9, 0x9E, 0x9F, 0xF9, 0xEA, 0x9E, 0x9A, 0xFE, 0x9E, 0xA9, 0xE9, 0x9F,
+    0xDA, 0x9E, 0xA9, 0xE9, 0x0F, 0xD0, 0xAE, 0xA9, 0xEA, 0x0A, 0xFC, 0x0A, 0xEA, 0xAE, 0xA0, 0x9F,
+    0xA0, 0xFA, 0xAE, 0xA1, 0xF9, 0x0F, 0xCA, 0xF1, 0xAE, 0x1F, 0xCA, 0xF7, 0xFC, 0x73, 0xE1, 0x9F,
+    0x5E, 0x19, 0xF9, 0x39, 0xE1, 0x9F, 0xA3, 0x9E, 0x1A, 0xFC, 0x39, 0xE1, 0xAF, 0xCA, 0x2A, 0xE1,
+    0xAF, 0xD2, 0xAE, 0x1F, 0xEA, 0x1A, 0xE1, 0xFA, 0xE1, 0xAE, 0x1F, 0x0E, 0xA0, 0xEA, 0x1F, 0x0A,
+    0xE0, 0xEA, 0x1F, 0x90, 0xE9, 0xEA, 0x1F, 0x90, 0xAF, 0xDA, 0x09, 0xF9, 0x09, 0xFD, 0x90, 0x9F,
+    0x91, 0xFD, 0x90, 0x9F, 0x91, 0x9F, 0xC9, 0x0A, 0xF9, 0x2F, 0xC9, 0x0A, 0xFA, 0x2A, 0xF9, 0x00,
+    0x0F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x77, 0x77, 0x77, 0x73, 0xFF, 0x5F, 0xF5, 0xFF, 0x77, 0x76,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x49, 0xAF, 0xA7,
+    0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69, 0xEA, 0x09,
+    0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0xAE,
+    0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F,
+    0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0xFF, 0xFF, 0xFF, 0xC9, 0x99, 0x99, 0xFD,
+    0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F, 0xD4, 0xFD, 0x4F,
+    0xD4, 0xEA, 0xAA, 0x4A, 0xAA, 0x09, 0xAA, 0xAA, 0xA9, 0x94, 0xAF, 0xF9, 0x2A, 0xFF, 0xC9, 0x1E,
+    0x92, 0x9E, 0x1E, 0x93, 0xAD, 0x90, 0xE9, 0x3A, 0xDA, 0x0E, 0x92, 0x9E, 0xA0, 0xFF, 0xE9, 0x0F,
+    0xFE, 0x1F, 0xFD, 0x91, 0xFF, 0xC2, 0x9F, 0xA9, 0x94, 0x9E, 0xA7, 0x9E, 0xA7, 0x9F, 0x79, 0xF7,
+    0xAF, 0x7A, 0xF7, 0xFF, 0xD9, 0xFF, 0xD9, 0xFA, 0xAA, 0xAA, 0xA1, 0xE9, 0x69, 0xE9, 0x69, 0xE9,
+    0x6A, 0xE7, 0xAD, 0x96, 0x9D, 0x95, 0x9D, 0xA5, 0xEA, 0x49, 0xF5, 0xFF, 0xD9, 0xFF, 0xD9, 0xFF,
+    0xD9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAF,
+    0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73,
+    0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x73, 0xF5, 0x9E, 0x96, 0xF1,
+    0xF5, 0x9E, 0x91, 0x9E, 0x94, 0xF3, 0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE,
+    0x90, 0xF7, 0xFA, 0xEA, 0x7A, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97,
+    0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0x70, 0xE7, 0x71, 0xE7, 0x71,
+    0xE7, 0x70, 0x9E, 0x97, 0x4A, 0xFF, 0xD9, 0x6A, 0xFF, 0xFC, 0xA4, 0xFC, 0xA9, 0xE0, 0xAF, 0xC2,
+    0xAF, 0x19, 0xE2, 0xFA, 0x09, 0xF9, 0x19, 0xE2, 0x9F, 0x9A, 0xF2, 0x9E, 0x3F, 0xAF, 0xA2, 0x9E,
+    0x3F, 0xAF, 0xA2, 0x9D, 0xA3, 0xAF, 0xFC, 0x29, 0xDA, 0x3F, 0xAA, 0xF9, 0x19, 0xDA, 0x2A, 0xFA,
+    0x9F, 0xDA, 0xAE, 0xAA, 0xFD, 0x90, 0xFF, 0xFF, 0xE1, 0x9F, 0xFF, 0xFC, 0x92, 0x9F, 0xFF, 0xE9,
+    0x59, 0xAF, 0xFC, 0xA9, 0x73, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0xAD, 0x97, 0x70, 0x99, 0x97,
+    0x10, 0x0A, 0xE6, 0x9E, 0x2E, 0xA5, 0xE9, 0x29, 0xE9, 0x3F, 0x4F, 0x29, 0xE9, 0x49, 0xF1, 0xEA,
+    0x6A, 0xE9, 0xF7, 0x0F, 0xE9, 0x70, 0xAF, 0xD7, 0x2F, 0xC9, 0x72, 0xAF, 0x72, 0x9F, 0xD7, 0x1F,
+    0xEA, 0x7F, 0xFC, 0x69, 0xF9, 0xFC, 0x5F, 0xA0, 0x9F, 0xA3, 0xFC, 0x2F, 0xC9, 0x1A, 0xF9, 0x3F,
+    0xC0, 0x9F, 0xC4, 0xAF, 0xA0, 0x76, 0xE9, 0x29, 0xD1, 0xFD, 0x39, 0xD1, 0xDA, 0xE3, 0x9D, 0x1D,
+    0xAE, 0x3A, 0xD0, 0x9D, 0xAA, 0xD9, 0x2A, 0xD0, 0x9D, 0x9A, 0xDA, 0x2A, 0xD0, 0xE9, 0x9E, 0x2A,
+    0xDA, 0xE1, 0xF9, 0x0A, 0xFD, 0x1A, 0xFF, 0xE9, 0x2A, 0xFF, 0xCA, 0x49, 0xFE, 0x97, 0x09, 0xE7,
+    0x3E, 0x73, 0xE7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3D, 0xA7, 0x3A, 0xA9, 0x40, 0x4A, 0xFA,
+    0x96, 0x9F, 0xFA, 0x49, 0xFC, 0xAF, 0xC3, 0xF3, 0x9E, 0x91, 0xAE, 0x59, 0xE1, 0xE9, 0x6E, 0x90,
+    0xE7, 0xAD, 0xA9, 0xE7, 0xAD, 0xA9, 0xE7, 0xAE, 0x9E, 0x7A, 0xDA, 0x0E, 0x7E, 0xA0, 0xEA, 0x5A,
+    0xE9, 0x0A, 0xE9, 0x3A, 0xF1, 0x9F, 0xC1, 0xFC, 0x90, 0xFE, 0x1F, 0xFF, 0xD1, 0xFE, 0xAA, 0xAA,
+    0xAA, 0xA1, 0xAA, 0xAA, 0xAA, 0xA0, 0x77, 0x1A, 0xDA, 0x9D, 0x95, 0xFF, 0x94, 0xEA, 0xAF, 0xA4,
+    0xD9, 0x2A, 0xDA, 0x3A, 0xD3, 0x9E, 0x3A, 0xCA, 0x4E, 0x3D, 0x94, 0xE3, 0xAC, 0xA3, 0x9E, 0x3A,
+    0xFF, 0xD4, 0xFF, 0xD9, 0x0A, 0x1A, 0xFF, 0xF2, 0x9A, 0xE9, 0xAF, 0xC7, 0x1F, 0xA7, 0x70, 0x77,
+    0x77, 0x77, 0x6E, 0xA6, 0x9F, 0xD9, 0x4F, 0xF9, 0x29, 0xFA, 0xF2, 0xEA, 0x29, 0xDA, 0x1E, 0x93,
+    0xE1, 0xE9, 0x29, 0xDA, 0x1E, 0x9A, 0xFC, 0x2E, 0x9A, 0xFC, 0x2E, 0x9A, 0xFD, 0x90, 0xE9, 0x3A,
+    0xE0, 0xEA, 0x39, 0xE0, 0xFD, 0xA9, 0xF0, 0xFF, 0xF0, 0xFF, 0xEA, 0x0E, 0xAF, 0xE1, 0xE9, 0x09,
+    0xAE, 0x91, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xAA, 0xA7, 0x10, 0x0E, 0x4A, 0xDA, 0x1A, 0xE3,
+    0xAD, 0xA2, 0xE9, 0x2A, 0xDA, 0x2A, 0xE2, 0xAD, 0xA3, 0xE9, 0x1A, 0xDA, 0x3A, 0xE1, 0xE9, 0x39,
+    0xE9, 0x0E, 0x94, 0xFA, 0xE5, 0x9F, 0xDA, 0x6F, 0xD9, 0x6F, 0xD7, 0xAF, 0x97, 0x9F, 0x70, 0x9E,
+    0xA7, 0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xF9, 0x70, 0x9A, 0x99, 0x30, 0x19, 0xFD, 0xA9, 0x2F, 0xFD,
+    0x19, 0xEA, 0xAF, 0xC1, 0x9E, 0x39, 0x9A, 0x2F, 0x71, 0xFA, 0x70, 0xFC, 0x70, 0xFC, 0x5A, 0xFE,
+    0x3A, 0xFF, 0xC1, 0x9F, 0xA9, 0xAE, 0xA0, 0xAE, 0x92, 0xAE, 0x0F, 0x39, 0xE0, 0xF3, 0x9E, 0x0A,
+    0xEA, 0x19, 0xF0, 0x9F, 0xFD, 0xA1, 0xAF, 0xFC, 0x3A, 0xFE, 0x6A, 0xAC, 0xA9, 0x30, 0x29, 0x95,
+    0xAF, 0xA3, 0xCA, 0x1A, 0xC2, 0x9C, 0x92, 0x93, 0xDA, 0xA5, 0xAE, 0x49, 0xD9, 0x19, 0x91, 0xAC,
+    0xA1, 0xAD, 0x1A, 0xD1, 0xAD, 0x2F, 0xDA, 0x29, 0xFA, 0x59, 0x94, 0x19, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x2F, 0xFC, 0x2F, 0xFC, 0x4A, 0xEA, 0x5A, 0xE9, 0x59, 0xE9, 0x6E, 0x96, 0x9E, 0x7A, 0xD9, 0x7E,
+    0x70, 0xAE, 0x97, 0xFD, 0xA5, 0xFE, 0x59, 0xFC, 0x96, 0x9E, 0x96, 0xF6, 0xAF, 0x59, 0xF6, 0xF9,
+    0x76, 0xAD, 0xA7, 0x1F, 0xA9, 0xEA, 0x92, 0x9A, 0xFF, 0xC9, 0x3F, 0xCA, 0xF3, 0xEA, 0x2A, 0xD9,
+    0x2E, 0x39, 0xD9, 0x19, 0xE3, 0x9D, 0xA1, 0x9E, 0x39, 0xDA, 0x19, 0xE3, 0x9D, 0xA1, 0x9E, 0x39,
+    0xE1, 0x9E, 0x3A, 0xE1, 0xAE, 0x3A, 0xE1, 0xAE, 0x92, 0xAE, 0x1A, 0xE9, 0x2A, 0xE7, 0x1A, 0xE7,
+    0x1F, 0x71, 0xF7, 0x1F, 0x71, 0xAA, 0xAA, 0x00, 0x29, 0xF9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0xAD,
+    0x91, 0xE3, 0xE0, 0x9D, 0xA3, 0xAD, 0x0A, 0xD9, 0x39, 0xD9, 0xAE, 0xAA, 0xAA, 0xEA, 0xFF, 0xEA,
+    0xFF, 0xEA, 0xEA, 0x3A, 0xDA, 0xAE, 0x3E, 0xAA, 0xEA, 0x1A, 0xE9, 0x9F, 0xFD, 0x1F, 0xFD, 0x19,
+    0xFF, 0x92, 0xAF, 0xDA, 0x49, 0xAD, 0xA9, 0x20, 0x0A, 0xA9, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+    0x3E, 0x3E, 0x3E, 0x29, 0xE2, 0x9E, 0x91, 0x9F, 0xC9, 0xAF, 0xCA, 0xAF, 0xC9, 0x09, 0xD1, 0xE2,
+    0xAD, 0x0A, 0xD3, 0xAC, 0xA9, 0xDA, 0x3D, 0xAE, 0x4F, 0xC9, 0x4F, 0xC5, 0xF6, 0xFA, 0x49, 0xFC,
+    0xA3, 0x9D, 0x9F, 0x2A, 0xD0, 0x9F, 0x1A, 0xD1, 0xAF, 0x00, 0x09, 0xAA, 0x99, 0x70, 0x9F, 0xC7,
+    0x9F, 0xD6, 0x9F, 0xDA, 0x70, 0x9F, 0x72, 0xE9, 0x71, 0xEA, 0x70, 0x9F, 0x70, 0xFC, 0x96, 0x9F,
+    0xCA, 0x6F, 0xE5, 0x9E, 0xAE, 0x94, 0xF0, 0xAD, 0xA3, 0x9E, 0x91, 0xE3, 0xF2, 0xE9, 0x19, 0xE9,
+    0x2A, 0xDA, 0x1E, 0xA3, 0x9E, 0x09, 0xE5, 0xE0, 0x0E, 0x4E, 0x1E, 0x4E, 0x99, 0xE4, 0xE9, 0x9E,
+    0x4E, 0x99, 0xE4, 0xE9, 0x9E, 0x93, 0xE9, 0x9E, 0x93, 0xE9, 0x9F, 0x29, 0xE9, 0xAF, 0xCA, 0x9F,
+    0xAA, 0xFF, 0xEA, 0xAF, 0xFE, 0xAA, 0xD9, 0xFA, 0xEA, 0xAD, 0x71, 0xAD, 0x72, 0x97, 0x20, 0x0E,
+    0x4A, 0xDA, 0x1A, 0xE3, 0xAD, 0xA2, 0xE9, 0x2A, 0xDA, 0x2A, 0xE2, 0xAD, 0xA3, 0xE9, 0x1A, 0xDA,
+    0x3A, 0xE1, 0xEA, 0x39, 0xE9, 0x0E, 0x94, 0xFA, 0xE5, 0x9F, 0xE6, 0xFD, 0x96, 0xFD, 0x7A, 0xFA,
+    0x79, 0xAA, 0xAA, 0x30, 0x9A, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xA0, 0xFF, 0xA2, 0xAF, 0x92, 0x9F,
+    0xCA, 0x2A, 0xFC, 0xA2, 0xAF, 0xD3, 0xFD, 0x3A, 0xFC, 0x3E, 0xA9, 0x39, 0xDA, 0x59, 0xEA, 0x94,
+    0xFD, 0x93, 0xFD, 0x6E, 0x95, 0xE9, 0x4F, 0x4A, 0xEA, 0x4F, 0x73, 0x29, 0xAD, 0xA9, 0x4F, 0xF2,
+    0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA,
+    0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x20, 0xFF, 0xFF, 0xFF,
+    0xDA, 0xAF, 0xAF, 0xAA, 0x1E, 0x1A, 0xD9, 0x3E, 0x1A, 0xD9, 0x3E, 0x1E, 0x4E, 0x1E, 0x4E, 0x1E,
+    0x39, 0xE1, 0xE3, 0x9D, 0xA0, 0x9F, 0xC1, 0x9D, 0xA1, 0xFC, 0x19, 0x99, 0x91, 0x9A, 0xAA, 0x90,
+    0x79, 0x97, 0x2F, 0xCA, 0x7F, 0xEA, 0x5E, 0xA1, 0x9D, 0x49, 0xE3, 0xAC, 0xA3, 0xEA, 0x39, 0xD3,
+    0xEA, 0x39, 0xD3, 0xEA, 0x39, 0xD2, 0x9F, 0x39, 0xD2, 0xAF, 0xC9, 0x9A, 0xE2, 0xAF, 0xFD, 0x92,
+    0xFF, 0xE3, 0xFF, 0xD4, 0xE9, 0x0A, 0xAA, 0x94, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x72, 0xEA, 0x71,
+    0x75, 0x9E, 0xA4, 0xFE, 0x91, 0x9E, 0x99, 0xE1, 0xE3, 0x99, 0x1E, 0x7E, 0x7A, 0xD7, 0x9E, 0x7A,
+    0xEA, 0x6A, 0xE9, 0x6E, 0x96, 0xE9, 0x6E, 0x96, 0xAD, 0x97, 0x09, 0x30, 0x29, 0xAF, 0xFA, 0x1F,
+    0xFE, 0xA0, 0xFA, 0xAF, 0x99, 0x99, 0xE3, 0xE9, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D, 0xA1,
+    0xAD, 0x93, 0xAD, 0xA1, 0xAE, 0x91, 0x9E, 0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69, 0xAD,
+    0xA9, 0x40, 0xFF, 0xEA, 0xFF, 0xEA, 0xAA, 0xAA, 0xFA, 0xAA, 0x93, 0xAD, 0xA7, 0xAD, 0x97, 0xE9,
+    0x7E, 0x70, 0xE7, 0x0E, 0x79, 0xFC, 0x6F, 0xC6, 0x9A, 0xAA, 0x92, 0xE1, 0xAD, 0x91, 0xE2, 0xE1,
+    0xE2, 0xAD, 0x90, 0xAD, 0x29, 0xDA, 0x0A, 0xD3, 0xDA, 0x0A, 0xD3, 0xE0, 0xAD, 0x92, 0xE0, 0x9D,
+    0x92, 0xE0, 0x9E, 0x99, 0xAE, 0x1F, 0xFC, 0x1F, 0xFA, 0x19, 0xFE, 0x39, 0xFA, 0x20, 0x69, 0xD7,
+    0x69, 0xD7, 0x69, 0xD7, 0x69, 0xD7, 0x49, 0xFC, 0xA9, 0x70, 0xFF, 0xCA, 0x59, 0xFF, 0xF4, 0xF9,
+    0xAD, 0x0A, 0xEA, 0x2A, 0xE9, 0x0A, 0xD1, 0xF2, 0xF1, 0xAD, 0x2E, 0xA0, 0x9E, 0x91, 0xAD, 0x2F,
+    0x0A, 0xE2, 0xAD, 0x2A, 0xE0, 0xAE, 0x2A, 0xD2, 0x9E, 0x0A, 0xE2, 0xAD, 0x29, 0xE0, 0xAE, 0x2A,
+    0xD2, 0xAE, 0x0A, 0xEA, 0x1A, 0xD2, 0xF0, 0x9F, 0xA9, 0xE0, 0x9F, 0xC1, 0xFF, 0xFE, 0xA1, 0xFF,
+    0xFE, 0x92, 0xFF, 0xFD, 0x39, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x72, 0xDA, 0x76, 0xDA, 0x76, 0xDA,
+    0x76, 0xDA, 0x77, 0x71, 0x77, 0x19, 0xDA, 0x6E, 0x29, 0xFA, 0x3E, 0x92, 0x9F, 0xCA, 0x19, 0xE4,
+    0xAF, 0xC9, 0x0E, 0x96, 0x9F, 0xEA, 0x70, 0x9F, 0xD7, 0x2F, 0xCA, 0x72, 0x9F, 0x73, 0xAF, 0x72,
+    0x9F, 0xC9, 0x71, 0xFE, 0x70, 0xAF, 0xE7, 0x9F, 0x9F, 0x6F, 0x90, 0xFE, 0x2F, 0xC1, 0x9F, 0xD1,
+    0x9F, 0x3A, 0xFC, 0x1F, 0xA4, 0x9A, 0xE7, 0x71, 0x3A, 0xC7, 0x1D, 0x71, 0xD7, 0x1D, 0x5E, 0x0D,
+    0x9D, 0xA1, 0xE0, 0xAC, 0x99, 0xD9, 0x0E, 0x0A, 0xC9, 0x0D, 0xA0, 0xAD, 0x0A, 0xC9, 0x0A, 0xD0,
+    0xAD, 0x0A, 0xCA, 0x0A, 0xD0, 0xAD, 0x09, 0xCA, 0x09, 0xD9, 0xAD, 0x99, 0xCA, 0x09, 0xD9, 0x9D,
+    0xA9, 0xCA, 0x09, 0xD9, 0x9E, 0xAD, 0xAE, 0x90, 0xFF, 0xD1, 0xAF, 0xFC, 0x2F, 0xF4, 0x9A, 0xDA,
+    0x97, 0xD7, 0x1D, 0x71, 0xD9, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xAC, 0x93, 0x39, 0x99, 0x74,
+    0xEA, 0x3E, 0x93, 0xAE, 0x49, 0xDA, 0x3E, 0x6E, 0x29, 0xE2, 0x92, 0xAD, 0x91, 0xAD, 0xA1, 0xD9,
+    0x19, 0xD9, 0x1E, 0x91, 0xD9, 0x19, 0xD9, 0x1E, 0x91, 0xD9, 0x1A, 0xD9, 0x1A, 0xDA, 0x09, 0xDA,
+    0x09, 0xE2, 0x9F, 0xFF, 0xC3, 0xAF, 0xFE, 0x94, 0x9E, 0xA9, 0xF9, 0x77, 0x30, 0x6A, 0xE7, 0x5F,
+    0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09,
+    0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93,
+    0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x97, 0x77,
+    0x09, 0xAA, 0x97, 0x5A, 0xE7, 0x5F, 0x75, 0xF7, 0x5F, 0x60, 0x76, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9,
+    0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A,
+    0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA7, 0x77,
+    0x77, 0xE9, 0x7E, 0x96, 0x9E, 0xA6, 0x9E, 0xA6, 0x9A, 0xAA, 0x93, 0x79, 0x97, 0x7E, 0x77, 0x0C,
+    0x97, 0x6A, 0xC7, 0x6A, 0xC7, 0x77, 0x77, 0x77, 0x74, 0xAE, 0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF,
+    0xC7, 0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA, 0x71, 0xE9, 0x0E, 0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19,
+    0xE7, 0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5, 0xFF, 0xF5, 0xFF, 0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xD2, 0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59, 0xF1, 0xF7, 0xF9, 0x4D, 0x97, 0x0A, 0xAC, 0x71, 0xAC,
+    0x70, 0xAC, 0x77, 0x77, 0x77, 0x7A, 0xDA, 0x9D, 0x92, 0xFF, 0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A,
+    0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94, 0xE0, 0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1,
+    0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA, 0x70, 0x99, 0x76, 0x9D, 0x76, 0xAC, 0xA7,
+    0x6D, 0x97, 0x5A, 0xD7, 0x77, 0x77, 0x73, 0xAD, 0x75, 0x9E, 0xA7, 0x39, 0xFC, 0xA7, 0x19, 0xE0,
+    0xAD, 0xA7, 0x9D, 0x92, 0x9D, 0xA7, 0x77, 0x77, 0x5A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC,
+    0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E,
+    0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD,
+    0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90, 0x72, 0x97, 0x2D, 0x97, 0x0A, 0xD5,
+    0xAC, 0xA0, 0xDA, 0x49, 0xEA, 0xAA, 0x49, 0xFC, 0x59, 0xEA, 0xE3, 0x9D, 0xA2, 0xE2, 0x99, 0x59,
+    0x97, 0x77, 0x6A, 0xDA, 0x9D, 0x93, 0xFF, 0x92, 0xEA, 0xAF, 0xA2, 0xD9, 0x2A, 0xDA, 0x1A, 0xD3,
+    0x9E, 0x1A, 0xCA, 0x4E, 0x1D, 0x94, 0xE1, 0xAC, 0xA3, 0x9E, 0x1A, 0xFF, 0xD2, 0xFF, 0xD9, 0x1A,
+    0xFF, 0xC9, 0x29, 0xAE, 0x99, 0xDA, 0x00, 0x0E, 0x97, 0x70, 0xEA, 0x77, 0x0F, 0x2A, 0xD7, 0x29,
+    0xAA, 0xA0, 0x9E, 0xA7, 0x59, 0xFC, 0xA7, 0x39, 0xE0, 0xAD, 0xA7, 0x19, 0xD9, 0x29, 0xDA, 0x77,
+    0x77, 0x77, 0x3A, 0xE7, 0x7F, 0x76, 0x9F, 0xA7, 0x5A, 0xFC, 0x75, 0xFD, 0x97, 0x39, 0xDA, 0x9D,
+    0xA7, 0x3E, 0x90, 0xE7, 0x29, 0xE1, 0xEA, 0x71, 0xAE, 0x19, 0xE7, 0x1E, 0x92, 0xE9, 0x79, 0xE3,
+    0xEA, 0x7F, 0xFF, 0x7F, 0xFF, 0x95, 0xAF, 0xFF, 0xC5, 0xFF, 0xFD, 0x49, 0xEA, 0x59, 0xEA, 0x3F,
+    0x95, 0x9F, 0x3F, 0x7F, 0x90, 0x0A, 0xAA, 0x76, 0xAE, 0x76, 0xAE, 0x97, 0x59, 0xEA, 0x77, 0x4A,
+    0xCA, 0x75, 0x9E, 0x74, 0x9F, 0xC7, 0x29, 0xE9, 0xE7, 0x09, 0xD9, 0x2A, 0xD7, 0x77, 0x77, 0x77,
+    0x7A, 0xDA, 0x9D, 0x97, 0x0F, 0xF9, 0x7E, 0xAA, 0xFA, 0x7D, 0x92, 0xAD, 0xA6, 0xAD, 0x39, 0xE6,
+    0xAC, 0xA4, 0xE6, 0xD9, 0x4E, 0x6A, 0xCA, 0x39, 0xE6, 0xAF, 0xFD, 0x7F, 0xFD, 0x96, 0xAF, 0xFC,
+    0x97, 0x9A, 0xE9, 0x9D, 0xA0, 0x7D, 0xA7, 0x69, 0xAC, 0x97, 0x69, 0xC7, 0x6A, 0xC9, 0x77, 0x77,
+    0x77, 0x77, 0x4A, 0xD7, 0x59, 0xEA, 0x73, 0x9F, 0xCA, 0x71, 0x9E, 0x0A, 0xDA, 0x79, 0xD9, 0x29,
+    0xDA, 0x77, 0x77, 0x75, 0xAE, 0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x71, 0x9D,
+    0xA9, 0xDA, 0x71, 0xE9, 0x0E, 0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0xE9, 0x2E, 0x95, 0x9E,
+    0x3E, 0xA5, 0xFF, 0xF5, 0xFF, 0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0x9E, 0xA5, 0x9E, 0xA1,
+    0xF9, 0x59, 0xF1, 0xF7, 0xF9, 0x70, 0xE9, 0x71, 0xF7, 0x39, 0xC7, 0x29, 0xD7, 0x19, 0xD6, 0xD9,
+    0x09, 0xC6, 0xF7, 0x0F, 0xD6, 0xE9, 0x9E, 0x4D, 0xA3, 0xE7, 0x77, 0x71, 0xAD, 0xA9, 0xD9, 0x4F,
+    0xF9, 0x3E, 0xAA, 0xFA, 0x3D, 0x92, 0xAD, 0xA2, 0xAD, 0x39, 0xE2, 0xAC, 0xA4, 0xE2, 0xD9, 0x4E,
+    0x2A, 0xCA, 0x39, 0xE2, 0xAF, 0xFD, 0x3F, 0xFD, 0x92, 0xAF, 0xFC, 0x93, 0x9A, 0xE9, 0x9D, 0xA1,
+    0x77, 0x7A, 0xD1, 0xD7, 0x19, 0xF0, 0xD7, 0x19, 0xC9, 0xAE, 0xA7, 0x19, 0xCA, 0x0A, 0xD9, 0x77,
+    0x76, 0xD9, 0x75, 0xAE, 0x74, 0xAF, 0xC7, 0x2A, 0xDA, 0xAE, 0x70, 0xAD, 0x92, 0xE7, 0x77, 0x4A,
+    0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90,
+    0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F,
+    0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F,
+    0x90, 0x76, 0xDA, 0x09, 0xCA, 0x3A, 0xF9, 0xCA, 0x3A, 0xC9, 0xAE, 0x93, 0xAC, 0x90, 0xAC, 0xA7,
+    0x77, 0x69, 0xD7, 0x0F, 0x6F, 0xD4, 0xE9, 0xAE, 0x2D, 0xA3, 0xE7, 0x7A, 0xDA, 0x9D, 0x92, 0xFF,
+    0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94, 0xE0,
+    0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA, 0x77,
+    0x71, 0xAD, 0x75, 0x9E, 0xA7, 0x39, 0xFC, 0xA7, 0x19, 0xE0, 0xAD, 0xA7, 0x9D, 0x92, 0x9D, 0xA7,
+    0x77, 0x77, 0x5A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D,
+    0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA,
+    0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95,
+    0x9F, 0x1F, 0x7F, 0x97, 0x77, 0x09, 0xAA, 0x97, 0x5A, 0xE7, 0x5F, 0x75, 0xF7, 0x5F, 0x60, 0x4A,
+    0xCA, 0x79, 0xE6, 0x9F, 0xC4, 0x9E, 0x9E, 0x29, 0xD9, 0x2A, 0xD7, 0x77, 0x77, 0xAD, 0xA9, 0xD9,
+    0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9,
+    0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D,
+    0xA7, 0x77, 0x77, 0xE9, 0x7E, 0x96, 0x9E, 0xA6, 0x9E, 0xA6, 0x9A, 0xAA, 0x93, 0x70, 0xD7, 0x6A,
+    0xD7, 0x6D, 0xA7, 0x5A, 0xD7, 0x69, 0x99, 0x77, 0x77, 0x77, 0x9D, 0xA2, 0xE7, 0x9F, 0xFA, 0x70,
+    0xFF, 0x72, 0xAF, 0xA7, 0x77, 0x77, 0x77, 0x72, 0xAE, 0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7,
+    0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA, 0x71, 0xE9, 0x0E, 0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7,
+    0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5, 0xFF, 0xF5, 0xFF, 0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2,
+    0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59, 0xF1, 0xF7, 0xF9, 0x49, 0xD7, 0x0D, 0xA7, 0x9D, 0x97, 0xE7,
+    0x09, 0x99, 0x77, 0x77, 0x71, 0xAD, 0x91, 0x9D, 0xA1, 0xAF, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77,
+    0x77, 0x71, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39,
+    0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF,
+    0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA0, 0x4A, 0xDA, 0x76, 0xAE, 0x76, 0xAE, 0x97, 0x59, 0xAA, 0xA9,
+    0x77, 0x77, 0x77, 0x76, 0x9D, 0xA2, 0xE7, 0x9F, 0xFA, 0x70, 0xFF, 0x72, 0xAF, 0xA7, 0x77, 0x77,
+    0x77, 0x72, 0xAE, 0x75, 0xF7, 0x49, 0xFA, 0x73, 0xAF, 0xC7, 0x3F, 0xD9, 0x71, 0x9D, 0xA9, 0xDA,
+    0x71, 0xE9, 0x0E, 0x70, 0x9E, 0x1E, 0xA7, 0xAE, 0x19, 0xE7, 0xE9, 0x2E, 0x95, 0x9E, 0x3E, 0xA5,
+    0xFF, 0xF5, 0xFF, 0xF9, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0x9E, 0xA5, 0x9E, 0xA1, 0xF9, 0x59,
+    0xF1, 0xF7, 0xF9, 0x1E, 0x97, 0x0E, 0xA7, 0x0F, 0x70, 0x9A, 0xAA, 0x77, 0x77, 0x77, 0x3A, 0xD9,
+    0x19, 0xDA, 0x1A, 0xFF, 0x92, 0xFE, 0xA4, 0xAF, 0x97, 0x77, 0x77, 0x1A, 0xDA, 0x9D, 0x92, 0xFF,
+    0x91, 0xEA, 0xAF, 0xA1, 0xD9, 0x2A, 0xDA, 0x0A, 0xD3, 0x9E, 0x0A, 0xCA, 0x4E, 0x0D, 0x94, 0xE0,
+    0xAC, 0xA3, 0x9E, 0x0A, 0xFF, 0xD1, 0xFF, 0xD9, 0x0A, 0xFF, 0xC9, 0x19, 0xAE, 0x99, 0xDA, 0x79,
+    0x97, 0x7E, 0x77, 0x0C, 0x97, 0x6D, 0x76, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x19, 0xD9, 0x2E, 0x79,
+    0xFF, 0xA7, 0x0F, 0xF7, 0x2A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7,
+    0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A,
+    0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3,
+    0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90, 0x77, 0x9D, 0xA7, 0x9E,
+    0xA7, 0x1C, 0xA7, 0x0D, 0x97, 0xDA, 0x70, 0xA9, 0x77, 0x77, 0x77, 0x5A, 0xD9, 0x19, 0xD9, 0x1A,
+    0xFF, 0x3F, 0xEA, 0x4A, 0xF9, 0x77, 0x75, 0xAD, 0xA9, 0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D,
+    0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF,
+    0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA0, 0x5A, 0xD1, 0xCA, 0x72, 0xF0,
+    0xD7, 0x19, 0xCA, 0xD9, 0xD7, 0x1A, 0xC9, 0x9E, 0xA7, 0x19, 0xCA, 0x0A, 0xD7, 0x77, 0x77, 0x77,
+    0x79, 0xDA, 0x2E, 0x79, 0xFF, 0xA7, 0x0F, 0xF7, 0x2A, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xE7,
+    0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7, 0x1E, 0x90, 0xE7,
+    0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F, 0xFF, 0x5F, 0xFF,
+    0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F, 0x1F, 0x7F, 0x90,
+    0x76, 0xDA, 0x09, 0xCA, 0x3A, 0xF9, 0xCA, 0x3D, 0x9F, 0x93, 0xAC, 0x90, 0xAC, 0xA7, 0x77, 0x77,
+    0x73, 0xAD, 0x91, 0x9D, 0xA1, 0xAF, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x71, 0xAD, 0xA9,
+    0xD9, 0x2F, 0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0,
+    0xD9, 0x4E, 0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9,
+    0x9D, 0xA0, 0x77, 0x59, 0xD9, 0x2E, 0x79, 0xFF, 0xA7, 0x0F, 0xF7, 0x2A, 0xFA, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0xE7, 0x5F, 0x74, 0x9F, 0xA7, 0x3A, 0xFC, 0x73, 0xFD, 0x97, 0x19, 0xDA, 0x9D, 0xA7,
+    0x1E, 0x90, 0xE7, 0x09, 0xE1, 0xEA, 0x7A, 0xE1, 0x9E, 0x7E, 0x92, 0xE9, 0x59, 0xE3, 0xEA, 0x5F,
+    0xFF, 0x5F, 0xFF, 0x93, 0xAF, 0xFF, 0xC3, 0xFF, 0xFD, 0x29, 0xEA, 0x59, 0xEA, 0x1F, 0x95, 0x9F,
+    0x1F, 0x7F, 0x97, 0x77, 0x09, 0xAA, 0x97, 0x5A, 0xE7, 0x5F, 0x75, 0xF7, 0x5F, 0x60, 0x74, 0xAD,
+    0x91, 0x9D, 0xA1, 0xAF, 0xF9, 0x2F, 0xEA, 0x4A, 0xF9, 0x77, 0x77, 0x71, 0xAD, 0xA9, 0xD9, 0x2F,
+    0xF9, 0x1E, 0xAA, 0xFA, 0x1D, 0x92, 0xAD, 0xA0, 0xAD, 0x39, 0xE0, 0xAC, 0xA4, 0xE0, 0xD9, 0x4E,
+    0x0A, 0xCA, 0x39, 0xE0, 0xAF, 0xFD, 0x1F, 0xFD, 0x90, 0xAF, 0xFC, 0x91, 0x9A, 0xE9, 0x9D, 0xA7,
+    0x77, 0x77, 0xE9, 0x7E, 0x96, 0x9E, 0xA6, 0x9E, 0xA6, 0x9A, 0xAA, 0x93, 0x0A, 0xAA, 0xAF, 0xE9,
+    0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F,
+    0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9, 0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90,
+    0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A, 0xFF, 0xEA, 0x77, 0x77, 0x73, 0x9A, 0xA7, 0x1E,
+    0x97, 0x0E, 0xA7, 0x9E, 0xA7, 0xAF, 0x30, 0x29, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D,
+    0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA,
+    0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9, 0x29, 0xAF, 0xA7, 0x77, 0x77, 0x76, 0xE9, 0x7E, 0x96,
+    0x9E, 0xA6, 0xAE, 0xA6, 0x9A, 0xAA, 0x92, 0x49, 0xCA, 0x71, 0x9A, 0xCA, 0x72, 0xCA, 0x71, 0xCA,
+    0x77, 0x77, 0x77, 0x71, 0xAA, 0xAA, 0xFE, 0x90, 0xFF, 0xE1, 0xFF, 0xDA, 0x1E, 0x97, 0x0E, 0x97,
+    0x0E, 0x97, 0x0E, 0x97, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xEA, 0x96, 0x9E, 0x97,
+    0x9E, 0x97, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x0A, 0xFF, 0xE9, 0xAF,
+    0xFE, 0xA0, 0x4D, 0x97, 0x09, 0xAC, 0x71, 0xAC, 0x70, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x69,
+    0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD, 0x9A,
+    0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9, 0x29,
+    0xAF, 0xA1, 0x77, 0x9D, 0x90, 0xAC, 0x5F, 0x9A, 0xC5, 0xD9, 0xF5, 0xD0, 0x9D, 0xA7, 0x77, 0x77,
+    0x77, 0xAA, 0xAA, 0xFE, 0x90, 0xFF, 0xE1, 0xFF, 0xDA, 0x1E, 0x97, 0x0E, 0x97, 0x0E, 0x97, 0x0E,
+    0x97, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xEA, 0x96, 0x9E, 0x97, 0x9E, 0x97, 0x9E,
+    0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x0A, 0xFF, 0xE9, 0xAF, 0xFE, 0xA0, 0x2A,
+    0xCA, 0x1C, 0xA3, 0x9F, 0x0C, 0xA3, 0xAC, 0x9F, 0xA3, 0xAC, 0x90, 0xE7, 0x77, 0x77, 0x77, 0x77,
+    0x59, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F, 0xFD,
+    0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF, 0xC9,
+    0x29, 0xAF, 0xA1, 0x5D, 0x74, 0xEA, 0x72, 0xFC, 0xA2, 0xAC, 0xA2, 0xEA, 0xAD, 0xA1, 0xD9, 0x1E,
+    0x29, 0xDA, 0xAD, 0x73, 0x9D, 0xA7, 0x49, 0x97, 0x72, 0xAA, 0xAA, 0xFE, 0x93, 0xFF, 0xE4, 0xFF,
+    0xDA, 0x4E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x3E, 0x97, 0x29, 0xFF, 0xC5, 0x9F, 0xFC, 0x59, 0xFF,
+    0xC5, 0x9E, 0xA9, 0x71, 0x9E, 0x97, 0x29, 0xE9, 0x72, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x3A, 0xFF,
+    0xE3, 0xAF, 0xFE, 0x3A, 0xFF, 0xE9, 0x2A, 0xFF, 0xEA, 0x20, 0x4A, 0xCA, 0x59, 0x49, 0xE9, 0x3D,
+    0x92, 0x9F, 0xC2, 0x9D, 0x29, 0xE9, 0xE9, 0x0D, 0xA1, 0x9D, 0xA2, 0xAD, 0xAD, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x73, 0x9A, 0xDA, 0x97, 0x0A, 0xFD, 0xA6, 0xAD, 0xA1, 0x9D, 0xA5, 0xE9, 0x99, 0x9A,
+    0xD4, 0x9F, 0xFD, 0x93, 0xAF, 0xFD, 0x93, 0xE9, 0x73, 0xAD, 0xA7, 0x39, 0xFA, 0xAA, 0xAA, 0xC9,
+    0x4F, 0xFD, 0x95, 0xFF, 0xC9, 0x69, 0xAF, 0xA5, 0x0A, 0xDA, 0x76, 0xAE, 0x76, 0xAE, 0x92, 0xD7,
+    0x09, 0xAA, 0xA9, 0x0E, 0xA7, 0x4F, 0xCA, 0x72, 0xEA, 0xAD, 0xA7, 0x0E, 0x29, 0xDA, 0x77, 0x77,
+    0x77, 0x74, 0xAA, 0xAA, 0xFE, 0x95, 0xFF, 0xE6, 0xFF, 0xDA, 0x6E, 0x97, 0x5E, 0x97, 0x5E, 0x97,
+    0x5E, 0x97, 0x49, 0xFF, 0xC7, 0x9F, 0xFC, 0x79, 0xFF, 0xC7, 0x9E, 0xA9, 0x73, 0x9E, 0x97, 0x49,
+    0xE9, 0x74, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x5A, 0xFF, 0xE5, 0xAF, 0xFE, 0x5A, 0xFF, 0xE9, 0x4A,
+    0xFF, 0xEA, 0x9E, 0x74, 0x9E, 0x97, 0x39, 0xEA, 0x1A, 0xCA, 0x79, 0xAA, 0xA9, 0xE9, 0x71, 0x9F,
+    0xC7, 0x09, 0xE9, 0xE9, 0x59, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xAD, 0xA9,
+    0x70, 0xAF, 0xDA, 0x6A, 0xDA, 0x19, 0xDA, 0x5E, 0x99, 0x99, 0xAD, 0x49, 0xFF, 0xD9, 0x3A, 0xFF,
+    0xD9, 0x3E, 0x97, 0x3A, 0xDA, 0x73, 0x9F, 0xAA, 0xAA, 0xAC, 0x94, 0xFF, 0xD9, 0x5F, 0xFC, 0x96,
+    0x9A, 0xFA, 0x10, 0x71, 0xD9, 0x72, 0x9A, 0xC7, 0x3A, 0xC6, 0xD1, 0xD6, 0xEA, 0x70, 0xFC, 0xA6,
+    0xEA, 0xAD, 0xA4, 0xE2, 0x9D, 0xA7, 0x77, 0x77, 0x4A, 0xAA, 0xAF, 0xE9, 0x1F, 0xFE, 0x2F, 0xFD,
+    0xA2, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x70, 0x9F, 0xFC, 0x39, 0xFF, 0xC3, 0x9F, 0xFC,
+    0x39, 0xEA, 0x97, 0x9E, 0x97, 0x09, 0xE9, 0x70, 0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x1A, 0xFF, 0xE1,
+    0xAF, 0xFE, 0x1A, 0xFF, 0xE9, 0x0A, 0xFF, 0xEA, 0x00, 0x70, 0xAD, 0x97, 0x1A, 0xE7, 0x4C, 0x97,
+    0x19, 0xD7, 0x19, 0xD9, 0x5D, 0x90, 0x9C, 0x95, 0xF7, 0x0F, 0xD6, 0xE9, 0x9E, 0x4E, 0x3A, 0xD7,
+    0x77, 0x77, 0x77, 0x59, 0xAD, 0xA9, 0x6A, 0xFD, 0xA4, 0xAD, 0xA1, 0x9D, 0xA3, 0xE9, 0x99, 0x9A,
+    0xD2, 0x9F, 0xFD, 0x91, 0xAF, 0xFD, 0x91, 0xE9, 0x71, 0xAD, 0xA7, 0x19, 0xFA, 0xAA, 0xAA, 0xC9,
+    0x2F, 0xFD, 0x93, 0xFF, 0xC9, 0x49, 0xAF, 0xA3, 0x77, 0x9D, 0x90, 0xAC, 0x5F, 0x9A, 0xC5, 0xD9,
+    0xF5, 0xD0, 0x9D, 0x97, 0x77, 0x71, 0xDA, 0x70, 0xAE, 0x96, 0xAF, 0xC9, 0x4A, 0xDA, 0x9E, 0x92,
+    0xAD, 0x92, 0xAD, 0x97, 0x6A, 0xAA, 0xAF, 0xE9, 0x0F, 0xFE, 0x1F, 0xFD, 0xA1, 0xE9, 0x70, 0xE9,
+    0x70, 0xE9, 0x70, 0xE9, 0x79, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9E, 0xA9, 0x69, 0xE9,
+    0x79, 0xE9, 0x79, 0xEA, 0xAA, 0xAA, 0xAA, 0x90, 0xAF, 0xFE, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x9A,
+    0xFF, 0xEA, 0x2A, 0xCA, 0x09, 0xC9, 0x39, 0xEA, 0x9C, 0xA3, 0xAC, 0x9F, 0x93, 0xD9, 0x0E, 0x77,
+    0x77, 0xDA, 0x7A, 0xE9, 0x5A, 0xFC, 0x93, 0xAD, 0xA9, 0xE9, 0x1A, 0xD9, 0x29, 0xD9, 0x77, 0x77,
+    0x77, 0x29, 0xAD, 0xA9, 0x4A, 0xFD, 0xA2, 0xAD, 0xA1, 0x9D, 0xA1, 0xE9, 0x99, 0x9A, 0xD0, 0x9F,
+    0xFD, 0x9A, 0xFF, 0xD9, 0xE9, 0x7A, 0xDA, 0x79, 0xFA, 0xAA, 0xAA, 0xC9, 0x0F, 0xFD, 0x91, 0xFF,
+    0xC9, 0x29, 0xAF, 0xA1, 0x5D, 0x71, 0xEA, 0x7F, 0xCA, 0x5E, 0xAA, 0xDA, 0x3E, 0x29, 0xDA, 0x77,
+    0x77, 0x70, 0xAA, 0xAA, 0xFE, 0x90, 0xFF, 0xE1, 0xFF, 0xDA, 0x1E, 0x97, 0x0E, 0x97, 0x0E, 0x97,
+    0x0E, 0x97, 0x9F, 0xFC, 0x29, 0xFF, 0xC2, 0x9F, 0xFC, 0x29, 0xEA, 0x96, 0x9E, 0x97, 0x9E, 0x97,
+    0x9E, 0xAA, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xE0, 0xAF, 0xFE, 0x0A, 0xFF, 0xE9, 0xAF, 0xFE, 0xA7,
+    0x77, 0x77, 0x39, 0xAA, 0x71, 0xE9, 0x70, 0xEA, 0x79, 0xEA, 0x7A, 0xF3, 0x4A, 0xCA, 0x79, 0xE9,
+    0x59, 0xFC, 0x49, 0xE9, 0xE9, 0x19, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x76, 0x9A, 0xDA, 0x94,
+    0xAF, 0xDA, 0x2A, 0xDA, 0x19, 0xDA, 0x1E, 0x99, 0x99, 0xAD, 0x09, 0xFF, 0xD9, 0xAF, 0xFD, 0x9E,
+    0x97, 0xAD, 0xA7, 0x9F, 0xAA, 0xAA, 0xAC, 0x90, 0xFF, 0xD9, 0x1F, 0xFC, 0x92, 0x9A, 0xFA, 0x77,
+    0x77, 0x77, 0x6E, 0x97, 0xE9, 0x69, 0xEA, 0x6A, 0xEA, 0x69, 0xAA, 0xA9, 0x20, 0x09, 0xCA, 0x19,
+    0xAC, 0xA2, 0xC9, 0x1C, 0xA2, 0x97, 0x75, 0x9E, 0x99, 0xE9, 0x9E, 0x99, 0xE1, 0xE1, 0xE1, 0xE1,
+    0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x99, 0xEA, 0x9E, 0xA9, 0xEA, 0xAF, 0xAF, 0x0D, 0x91,
+    0xAA, 0xC2, 0xAC, 0x1A, 0xC7, 0x71, 0x99, 0x19, 0xD9, 0x09, 0xD9, 0x09, 0xD9, 0x09, 0xD9, 0x09,
+    0xD9, 0x0A, 0xD9, 0x0A, 0xD9, 0x0A, 0xD9, 0x0A, 0xDA, 0x0E, 0xA0, 0xF0, 0x9E, 0x99, 0xE9, 0x9E,
+    0x99, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0x99, 0xEA, 0x9E, 0xA9,
+    0xEA, 0xAF, 0xAF, 0x77, 0x4E, 0x90, 0xE9, 0x9E, 0xAA, 0xEA, 0x9A, 0xAA, 0x90, 0x0A, 0xDA, 0x1E,
+    0xA1, 0xF1, 0xF1, 0xAA, 0xAA, 0x75, 0x9A, 0xA2, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91, 0x9D, 0x91,
+    0x9D, 0x91, 0xAD, 0x91, 0xAD, 0x91, 0xAD, 0x91, 0xAD, 0xA1, 0xEA, 0x1F, 0x77, 0x71, 0xAD, 0xA1,
+    0xF1, 0xF1, 0xF1, 0xAA, 0xAA, 0x00, 0x49, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2,
+    0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE,
+    0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19,
+    0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x5E, 0xA7, 0x5E, 0xA7, 0x49, 0xF7, 0x49, 0xAA,
+    0xAA, 0x60, 0x29, 0xAD, 0xA9, 0x4F, 0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA,
+    0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF,
+    0x49, 0xAD, 0xA9, 0x77, 0x77, 0x73, 0xAA, 0x97, 0x9E, 0x7A, 0xE7, 0xF7, 0xF9, 0x20, 0x79, 0x77,
+    0x0D, 0xA7, 0x79, 0xC7, 0x69, 0xCA, 0x76, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAF, 0xA7, 0x1F,
+    0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69, 0xEA, 0x09, 0xE9,
+    0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70, 0xAE, 0x0A,
+    0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF,
+    0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x49, 0x97, 0x1E, 0x72, 0xC7, 0x1C, 0xA7, 0x0A,
+    0xA7, 0x77, 0x77, 0x39, 0xAD, 0xA9, 0x4F, 0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A,
+    0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93, 0xAD, 0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2,
+    0xFF, 0x49, 0xAD, 0xA9, 0x20, 0x77, 0x72, 0xD9, 0x76, 0xAE, 0x75, 0xAF, 0xC2, 0x9D, 0x5A, 0xDA,
+    0x9E, 0x1D, 0xA4, 0xAD, 0x3A, 0xDA, 0xD9, 0x76, 0xE7, 0x77, 0x19, 0xAF, 0xA7, 0x2F, 0xFC, 0xA6,
+    0x9F, 0xFF, 0x5F, 0xA2, 0x9F, 0xA3, 0xAE, 0x95, 0xF9, 0x2F, 0x69, 0xEA, 0x19, 0xE9, 0x7F, 0x1A,
+    0xE7, 0x0A, 0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0xAE, 0x1A, 0xEA, 0x7F,
+    0x19, 0xFC, 0x99, 0x19, 0xAF, 0xC2, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xD9, 0x3F, 0xFF, 0xD5, 0xFF,
+    0xF7, 0x9A, 0xFD, 0xA9, 0x77, 0x70, 0x73, 0xD9, 0x4D, 0xA2, 0x9D, 0x4A, 0xE9, 0x1D, 0xA3, 0xAF,
+    0xC9, 0x9D, 0x92, 0xAD, 0xA9, 0xEA, 0x99, 0x2A, 0xD9, 0x2A, 0xD9, 0x77, 0x77, 0x39, 0xAD, 0xA9,
+    0x7F, 0xF5, 0xFA, 0xAE, 0xA3, 0x9E, 0x3E, 0x92, 0xAD, 0x93, 0xAD, 0xA2, 0xE9, 0x39, 0xDA, 0x2A,
+    0xD9, 0x3A, 0xDA, 0x2A, 0xE9, 0x19, 0xE9, 0x29, 0xFF, 0xD4, 0xAF, 0xFA, 0x5F, 0xF7, 0x9A, 0xDA,
+    0x95, 0x09, 0xE7, 0x71, 0x9E, 0x97, 0x70, 0x9E, 0x92, 0xD9, 0x72, 0x9A, 0xAA, 0x90, 0xAE, 0x77,
+    0xAF, 0xC7, 0x5A, 0xDA, 0x9E, 0x73, 0xAD, 0x3A, 0xD7, 0x77, 0x77, 0x75, 0x9A, 0xFA, 0x74, 0xFF,
+    0xCA, 0x70, 0x9F, 0xFF, 0x7F, 0xA2, 0x9F, 0xA5, 0xAE, 0x95, 0xF9, 0x4F, 0x69, 0xEA, 0x39, 0xE9,
+    0x7F, 0x3A, 0xE7, 0x0A, 0xE3, 0xAE, 0x70, 0x9E, 0x3A, 0xE7, 0x09, 0xE3, 0xAE, 0x70, 0xAE, 0x3A,
+    0xEA, 0x7F, 0x39, 0xFC, 0x99, 0x19, 0xAF, 0xC4, 0xFF, 0xFE, 0xA4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xD7, 0xFF, 0xF7, 0x19, 0xAF, 0xDA, 0x97, 0x77, 0x00, 0x09, 0xAA, 0x97, 0x5E, 0xA7, 0x5F, 0x75,
+    0xAE, 0x97, 0x71, 0xDA, 0x74, 0xAE, 0x97, 0x2A, 0xFC, 0x97, 0x0A, 0xDA, 0x9E, 0x96, 0xAD, 0x92,
+    0xAD, 0x97, 0x77, 0x77, 0x19, 0xAD, 0xA9, 0x71, 0xFF, 0x7F, 0xAA, 0xEA, 0x59, 0xE3, 0xE9, 0x4A,
+    0xD9, 0x3A, 0xDA, 0x4E, 0x93, 0x9D, 0xA4, 0xAD, 0x93, 0xAD, 0xA4, 0xAE, 0x91, 0x9E, 0x94, 0x9F,
+    0xFD, 0x6A, 0xFF, 0xA7, 0xFF, 0x71, 0x9A, 0xDA, 0x92, 0x79, 0x77, 0x0E, 0x77, 0x9C, 0x76, 0xDA,
+    0x75, 0xAE, 0x74, 0xAF, 0xC7, 0x2A, 0xDA, 0x9E, 0x70, 0xAD, 0x92, 0xE7, 0x77, 0x77, 0x49, 0xAF,
+    0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9, 0x1F, 0x69, 0xEA,
+    0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09, 0xE0, 0xAE, 0x70,
+    0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1, 0xAF, 0xFF, 0xD9,
+    0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x70, 0xE9, 0x71, 0xF7, 0x39, 0xC7,
+    0x2D, 0xA5, 0xD1, 0x9C, 0x95, 0xF7, 0x0A, 0xFA, 0x6A, 0xDA, 0xAD, 0xA4, 0xE9, 0x19, 0xDA, 0x77,
+    0x77, 0x19, 0xAD, 0xA9, 0x6F, 0xF4, 0xFA, 0xAE, 0xA2, 0x9E, 0x3E, 0x91, 0xAD, 0x93, 0xAD, 0xA1,
+    0xE9, 0x39, 0xDA, 0x1A, 0xD9, 0x3A, 0xDA, 0x1A, 0xE9, 0x19, 0xE9, 0x19, 0xFF, 0xD3, 0xAF, 0xFA,
+    0x4F, 0xF6, 0x9A, 0xDA, 0x94, 0x77, 0x7D, 0xA0, 0x9C, 0x97, 0x1A, 0xEA, 0x9C, 0x97, 0x1D, 0x0F,
+    0x97, 0x1D, 0x1E, 0x77, 0x76, 0x9D, 0x76, 0xEA, 0x74, 0xFC, 0x97, 0x2E, 0x9E, 0x97, 0x0D, 0xA2,
+    0x9D, 0xA7, 0x77, 0x29, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE,
+    0x95, 0xF9, 0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A,
+    0xE7, 0x09, 0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF,
+    0xFE, 0xA1, 0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x50, 0x2A,
+    0xCA, 0x09, 0xC9, 0x39, 0xEA, 0x0C, 0xA3, 0xAC, 0x9D, 0x9C, 0xA3, 0xD0, 0xAE, 0x93, 0xAC, 0x90,
+    0xAC, 0xA7, 0x73, 0xD7, 0x0E, 0xA6, 0xFC, 0xA4, 0xE9, 0xAD, 0xA2, 0xE2, 0x9D, 0xA7, 0x79, 0xAD,
+    0xA9, 0x4F, 0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD,
+    0x93, 0xAD, 0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x20,
+    0x77, 0x71, 0xD9, 0x75, 0xAE, 0x74, 0xAF, 0xC7, 0x2A, 0xDA, 0x9E, 0x70, 0xAD, 0x3A, 0xD7, 0x77,
+    0x77, 0x49, 0xAF, 0xA7, 0x1F, 0xFC, 0xA5, 0x9F, 0xFF, 0x4F, 0xA2, 0x9F, 0xA2, 0xAE, 0x95, 0xF9,
+    0x1F, 0x69, 0xEA, 0x09, 0xE9, 0x7F, 0x0A, 0xE7, 0x0A, 0xE0, 0xAE, 0x70, 0x9E, 0x0A, 0xE7, 0x09,
+    0xE0, 0xAE, 0x70, 0xAE, 0x0A, 0xEA, 0x7F, 0x09, 0xFC, 0x99, 0x19, 0xAF, 0xC1, 0xFF, 0xFE, 0xA1,
+    0xAF, 0xFF, 0xD9, 0x2F, 0xFF, 0xD4, 0xFF, 0xF6, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x4E, 0x97, 0x5E, 0xA7, 0x5E, 0xA7, 0x49, 0xF7, 0x49, 0xAA, 0xAA, 0x60, 0x77, 0x0D, 0xA7,
+    0xAE, 0x95, 0xAF, 0xC9, 0x3A, 0xDA, 0x9E, 0x91, 0xAD, 0x92, 0xAD, 0x97, 0x77, 0x29, 0xAD, 0xA9,
+    0x4F, 0xF2, 0xFA, 0xAE, 0xA0, 0x9E, 0x3E, 0x9A, 0xD9, 0x3A, 0xDA, 0xE9, 0x39, 0xDA, 0xAD, 0x93,
+    0xAD, 0xAA, 0xE9, 0x19, 0xE9, 0x9F, 0xFD, 0x1A, 0xFF, 0xA2, 0xFF, 0x49, 0xAD, 0xA9, 0x77, 0x77,
+    0x77, 0x6E, 0x79, 0xE7, 0xAE, 0x96, 0xF9, 0x6A, 0xAA, 0xA9, 0x30, 0x70, 0xD7, 0x7A, 0xD7, 0x7D,
+    0xA7, 0x6A, 0xD7, 0x79, 0x99, 0x77, 0x79, 0xCA, 0x77, 0x0D, 0x94, 0x9A, 0xFA, 0x3D, 0x4F, 0xFC,
+    0xA0, 0xAD, 0x29, 0xFF, 0xFD, 0xA2, 0xFA, 0x29, 0xFC, 0xA2, 0xAE, 0x95, 0xF3, 0xF6, 0x9E, 0xA1,
+    0x9E, 0x97, 0xF1, 0xAE, 0x70, 0xAE, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x0A,
+    0xE1, 0xAE, 0xA7, 0xF1, 0x9F, 0xC9, 0x91, 0x9A, 0xFC, 0x2F, 0xFF, 0xEA, 0x2A, 0xFF, 0xFD, 0x93,
+    0xFF, 0xFD, 0x5F, 0xFF, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x49, 0xD7, 0x2D, 0xA7, 0x19, 0xD9, 0x71,
+    0xAD, 0x72, 0x99, 0x97, 0x70, 0x99, 0x97, 0x3D, 0x39, 0xAD, 0xA9, 0x1D, 0x2F, 0xEA, 0x9D, 0x1F,
+    0xAA, 0xFC, 0xA0, 0x9E, 0x3F, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D, 0xA1, 0xAD, 0x93, 0xAD,
+    0xA1, 0xAE, 0x91, 0x9E, 0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69, 0xAD, 0xA9, 0x40, 0x4A,
+    0xDA, 0x77, 0xAE, 0x77, 0xAE, 0x97, 0x69, 0xAA, 0xA9, 0x77, 0x77, 0x79, 0xAA, 0x77, 0x0D, 0x94,
+    0x9A, 0xFA, 0x3D, 0x4F, 0xFC, 0xA0, 0xAD, 0x29, 0xFF, 0xFD, 0xA2, 0xFA, 0x29, 0xFC, 0xA2, 0xAE,
+    0x95, 0xF3, 0xF6, 0x9E, 0xA1, 0x9E, 0x97, 0xF1, 0xAE, 0x70, 0xAE, 0x1A, 0xE7, 0x09, 0xE1, 0xAE,
+    0x70, 0x9E, 0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0xA7, 0xF1, 0x9F, 0xC9, 0x91, 0x9A, 0xFC, 0x2F, 0xFF,
+    0xEA, 0x2A, 0xFF, 0xFD, 0x93, 0xFF, 0xFD, 0x5F, 0xFF, 0x79, 0xAF, 0xDA, 0x97, 0x77, 0x1E, 0x97,
+    0x2E, 0xA7, 0x2F, 0x72, 0x9A, 0xAA, 0x77, 0x75, 0x97, 0x4D, 0x39, 0xAD, 0xA9, 0x1D, 0x2F, 0xEA,
+    0x9D, 0x1F, 0xAA, 0xFC, 0xA0, 0x9E, 0x3F, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D, 0xA1, 0xAD,
+    0x93, 0xAD, 0xA1, 0xAE, 0x91, 0x9E, 0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69, 0xAD, 0xA9,
+    0x40, 0x79, 0x97, 0x70, 0xE7, 0x71, 0xC9, 0x77, 0xD7, 0x79, 0xC7, 0x77, 0x77, 0x29, 0xAA, 0x77,
+    0x0D, 0x94, 0x9A, 0xFA, 0x3D, 0x4F, 0xFC, 0xA0, 0xAD, 0x29, 0xFF, 0xFD, 0xA2, 0xFA, 0x29, 0xFC,
+    0xA2, 0xAE, 0x95, 0xF3, 0xF6, 0x9E, 0xA1, 0x9E, 0x97, 0xF1, 0xAE, 0x70, 0xAE, 0x1A, 0xE7, 0x09,
+    0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0xA7, 0xF1, 0x9F, 0xC9, 0x91, 0x9A, 0xFC,
+    0x2F, 0xFF, 0xEA, 0x2A, 0xFF, 0xFD, 0x93, 0xFF, 0xFD, 0x5F, 0xFF, 0x79, 0xAF, 0xDA, 0x97, 0x77,
+    0x49, 0x97, 0x3E, 0x74, 0xC7, 0x3C, 0xA7, 0x2A, 0xA7, 0x77, 0x79, 0x74, 0xD3, 0x9A, 0xDA, 0x91,
+    0xD2, 0xFE, 0xA9, 0xD1, 0xFA, 0xAF, 0xCA, 0x09, 0xE3, 0xF1, 0xAD, 0x93, 0xAD, 0xA1, 0xE9, 0x39,
+    0xDA, 0x1A, 0xD9, 0x3A, 0xDA, 0x1A, 0xE9, 0x19, 0xE9, 0x19, 0xFF, 0xD3, 0xAF, 0xFA, 0x4F, 0xF6,
+    0x9A, 0xDA, 0x94, 0x77, 0x70, 0xAD, 0x1D, 0x72, 0x9F, 0x9D, 0x72, 0xAC, 0x9A, 0xEA, 0x72, 0x9C,
+    0xA0, 0xAD, 0x77, 0x77, 0x70, 0x9A, 0x97, 0x70, 0xD9, 0x49, 0xAF, 0xA3, 0xD4, 0xFF, 0xCA, 0x0A,
+    0xD2, 0x9F, 0xFF, 0xDA, 0x2F, 0xA2, 0x9F, 0xCA, 0x2A, 0xE9, 0x5F, 0x3F, 0x69, 0xEA, 0x19, 0xE9,
+    0x7F, 0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0xAE, 0x1A,
+    0xEA, 0x7F, 0x19, 0xFC, 0x99, 0x19, 0xAF, 0xC2, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xD9, 0x3F, 0xFF,
+    0xD5, 0xFF, 0xF7, 0x9A, 0xFD, 0xA9, 0x77, 0x70, 0x77, 0x0D, 0xA0, 0x9C, 0xA5, 0xAE, 0xA9, 0xCA,
+    0x5A, 0xC9, 0xF9, 0x5A, 0xC9, 0x0E, 0x77, 0x77, 0x72, 0x9A, 0x97, 0x3D, 0x39, 0xAD, 0xA9, 0x1D,
+    0x2F, 0xEA, 0x9D, 0x1F, 0xAA, 0xFC, 0xA0, 0x9E, 0x3F, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D,
+    0xA1, 0xAD, 0x93, 0xAD, 0xA1, 0xAE, 0x91, 0x9E, 0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69,
+    0xAD, 0xA9, 0x40, 0x76, 0x9A, 0xA7, 0x70, 0xD9, 0x49, 0xAF, 0xA3, 0xD4, 0xFF, 0xCA, 0x0A, 0xD2,
+    0x9F, 0xFF, 0xDA, 0x2F, 0xA2, 0x9F, 0xCA, 0x2A, 0xE9, 0x5F, 0x3F, 0x69, 0xEA, 0x19, 0xE9, 0x7F,
+    0x1A, 0xE7, 0x0A, 0xE1, 0xAE, 0x70, 0x9E, 0x1A, 0xE7, 0x09, 0xE1, 0xAE, 0x70, 0xAE, 0x1A, 0xEA,
+    0x7F, 0x19, 0xFC, 0x99, 0x19, 0xAF, 0xC2, 0xFF, 0xFE, 0xA2, 0xAF, 0xFF, 0xD9, 0x3F, 0xFF, 0xD5,
+    0xFF, 0xF7, 0x9A, 0xFD, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xE9, 0x76, 0xEA, 0x76,
+    0xEA, 0x75, 0x9F, 0x75, 0x9A, 0xAA, 0xA7, 0x72, 0x97, 0x4D, 0x39, 0xAD, 0xA9, 0x1D, 0x2F, 0xEA,
+    0x9D, 0x1F, 0xAA, 0xFC, 0xA0, 0x9E, 0x3F, 0x1A, 0xD9, 0x3A, 0xDA, 0x1E, 0x93, 0x9D, 0xA1, 0xAD,
+    0x93, 0xAD, 0xA1, 0xAE, 0x91, 0x9E, 0x91, 0x9F, 0xFD, 0x3A, 0xFF, 0xA4, 0xFF, 0x69, 0xAD, 0xA9,
+    0x77, 0x77, 0x77, 0x3A, 0xA9, 0x71, 0x9E, 0x71, 0xAE, 0x71, 0xF7, 0x1F, 0x94, 0xAF, 0x49, 0xF0,
+    0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0,
+    0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0, 0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E,
+    0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF,
+    0x3F, 0xFE, 0x93, 0x9F, 0xFC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0E, 0x97, 0x3E, 0x97, 0x29,
+    0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xAA, 0xA9, 0x50, 0xE4, 0xE0, 0xAD, 0x4E, 0x9A, 0xD4, 0xE9, 0xAD,
+    0x4E, 0x9A, 0xD4, 0xE9, 0x9D, 0x93, 0xE9, 0x9D, 0x93, 0xE9, 0x9E, 0x29, 0xE9, 0x0F, 0xA9, 0xFA,
+    0x0F, 0xFD, 0xA0, 0x9F, 0xFC, 0xA1, 0x9F, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x7A, 0xDA, 0x7E, 0xA7,
+    0xF6, 0x9F, 0x7A, 0xAA, 0xA3, 0x69, 0x76, 0xDA, 0x75, 0x9C, 0x74, 0x9C, 0x97, 0x4A, 0x97, 0x77,
+    0x77, 0x77, 0x76, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0xAF, 0x49, 0xF0, 0x9E,
+    0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA4, 0x9F, 0x09, 0xEA, 0x49, 0xF0, 0x9E, 0xA5, 0xF0,
+    0x9E, 0xA5, 0xEA, 0x09, 0xEA, 0x5E, 0xA0, 0x9E, 0xA4, 0x9E, 0xA1, 0xF4, 0xAE, 0xA1, 0xFF, 0xFC,
+    0x91, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0x3F, 0xFE, 0x94, 0xAF, 0xF9, 0x77, 0x20, 0x49, 0x97, 0x1E,
+    0x72, 0xC7, 0x1C, 0xA7, 0x0A, 0xA7, 0x77, 0x77, 0x0E, 0x4E, 0x0A, 0xD4, 0xE9, 0xAD, 0x4E, 0x9A,
+    0xD4, 0xE9, 0xAD, 0x4E, 0x99, 0xD9, 0x3E, 0x99, 0xD9, 0x3E, 0x99, 0xE2, 0x9E, 0x90, 0xFA, 0x9F,
+    0xA0, 0xFF, 0xDA, 0x09, 0xFF, 0xCA, 0x19, 0xFA, 0xEA, 0x69, 0xD7, 0x6D, 0x97, 0x59, 0xD7, 0x6E,
+    0x76, 0x99, 0x59, 0x97, 0x79, 0xD7, 0x69, 0xD7, 0x6A, 0xD0, 0xAF, 0x49, 0xFC, 0x90, 0xAF, 0x49,
+    0xFA, 0x1A, 0xF4, 0x9F, 0x2A, 0xF4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA,
+    0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x5F, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA5, 0xEA, 0x29,
+    0xEA, 0x49, 0xEA, 0x3F, 0x4A, 0xEA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC9, 0x3A, 0xFF, 0xF5, 0xFF,
+    0xE9, 0x6A, 0xFF, 0x97, 0x76, 0x5D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x1A, 0xD7, 0x29, 0x99, 0x3D,
+    0xA7, 0x2A, 0xD7, 0x2D, 0xAE, 0x4F, 0xC9, 0xAD, 0x4F, 0xA0, 0xAD, 0x4E, 0x91, 0xAD, 0x4E, 0x91,
+    0xAD, 0x4E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xD9, 0x3E, 0x91, 0x9E, 0x29, 0xE9, 0x2F, 0xA9, 0xFA,
+    0x2F, 0xFD, 0xA2, 0x9F, 0xFC, 0xA3, 0x9F, 0xAE, 0xA1, 0x3E, 0x97, 0x6E, 0xA7, 0x6F, 0x76, 0x9A,
+    0xAA, 0x77, 0x77, 0x69, 0xD7, 0x69, 0xD7, 0x6A, 0xD0, 0xAF, 0x49, 0xFC, 0x90, 0xAF, 0x49, 0xFA,
+    0x1A, 0xF4, 0x9F, 0x2A, 0xF4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x49,
+    0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x5F, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA5, 0xEA, 0x29, 0xEA,
+    0x49, 0xEA, 0x3F, 0x4A, 0xEA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC9, 0x3A, 0xFF, 0xF5, 0xFF, 0xE9,
+    0x6A, 0xFF, 0x97, 0x76, 0x1E, 0xA7, 0x2E, 0xA7, 0x2A, 0xE7, 0x29, 0xAA, 0xA7, 0x7D, 0xA7, 0x2A,
+    0xCA, 0x72, 0xDA, 0xE4, 0xFC, 0x9A, 0xD4, 0xFA, 0x0A, 0xD4, 0xE9, 0x1A, 0xD4, 0xE9, 0x1A, 0xD4,
+    0xE9, 0x19, 0xD9, 0x3E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xE2, 0x9E, 0x92, 0xFA, 0x9F, 0xA2, 0xFF,
+    0xDA, 0x29, 0xFF, 0xCA, 0x39, 0xFA, 0xEA, 0x10, 0x69, 0x77, 0x0D, 0xA7, 0x79, 0xC7, 0x69, 0xC9,
+    0x76, 0xA9, 0x77, 0x69, 0x97, 0x79, 0xD7, 0x69, 0xD7, 0x6A, 0xD0, 0xAF, 0x49, 0xFC, 0x90, 0xAF,
+    0x49, 0xFA, 0x1A, 0xF4, 0x9F, 0x2A, 0xF4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29,
+    0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x5F, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA5, 0xEA,
+    0x29, 0xEA, 0x49, 0xEA, 0x3F, 0x4A, 0xEA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC9, 0x3A, 0xFF, 0xF5,
+    0xFF, 0xE9, 0x6A, 0xFF, 0x97, 0x76, 0x49, 0x97, 0x3E, 0x74, 0xC7, 0x3C, 0xA7, 0x2A, 0xA7, 0x71,
+    0xDA, 0x72, 0xAD, 0x72, 0xDA, 0xE4, 0xFC, 0x9A, 0xD4, 0xFA, 0x0A, 0xD4, 0xE9, 0x1A, 0xD4, 0xE9,
+    0x1A, 0xD4, 0xE9, 0x19, 0xD9, 0x3E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xE2, 0x9E, 0x92, 0xFA, 0x9F,
+    0xA2, 0xFF, 0xDA, 0x29, 0xFF, 0xCA, 0x39, 0xFA, 0xEA, 0x10, 0x4D, 0xA0, 0x9C, 0x72, 0xAE, 0xA9,
+    0xC9, 0x71, 0xD0, 0xF9, 0x71, 0xD1, 0xE7, 0x77, 0x76, 0x99, 0x77, 0x9D, 0x76, 0x9D, 0x76, 0xAD,
+    0x0A, 0xF4, 0x9F, 0xC9, 0x0A, 0xF4, 0x9F, 0xA1, 0xAF, 0x49, 0xF2, 0xAF, 0x49, 0xF2, 0x9E, 0xA4,
+    0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA5, 0xF2, 0x9E,
+    0xA5, 0xEA, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA4, 0x9E, 0xA3, 0xF4, 0xAE, 0xA3, 0xFF, 0xFC, 0x93,
+    0xFF, 0xFC, 0x93, 0xAF, 0xFF, 0x5F, 0xFE, 0x96, 0xAF, 0xF9, 0x77, 0x60, 0x2A, 0xCA, 0x09, 0xC9,
+    0x59, 0xEA, 0x0C, 0xA5, 0xAC, 0x9D, 0x9C, 0xA5, 0xD9, 0xAE, 0x95, 0xAC, 0x90, 0xAC, 0xA1, 0x97,
+    0x4A, 0xCA, 0x72, 0xAC, 0xA7, 0x2D, 0xAE, 0x4F, 0xC9, 0xAD, 0x4F, 0xA0, 0xAD, 0x4E, 0x91, 0xAD,
+    0x4E, 0x91, 0xAD, 0x4E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xD9, 0x3E, 0x91, 0x9E, 0x29, 0xE9, 0x2F,
+    0xA9, 0xFA, 0x2F, 0xFD, 0xA2, 0x9F, 0xFC, 0xA3, 0x9F, 0xAE, 0xA1, 0x75, 0x99, 0x97, 0x69, 0xD7,
+    0x69, 0xD7, 0x6A, 0xD0, 0xAF, 0x49, 0xFC, 0x90, 0xAF, 0x49, 0xFA, 0x1A, 0xF4, 0x9F, 0x2A, 0xF4,
+    0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29, 0xEA, 0x49, 0xF2, 0x9E, 0xA4, 0x9F, 0x29,
+    0xEA, 0x5F, 0x29, 0xEA, 0x5E, 0xA2, 0x9E, 0xA5, 0xEA, 0x29, 0xEA, 0x49, 0xEA, 0x3F, 0x4A, 0xEA,
+    0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC9, 0x3A, 0xFF, 0xF5, 0xFF, 0xE9, 0x59, 0xFF, 0xC9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x5E, 0x97, 0x49, 0xEA, 0x74, 0x9E, 0xA7, 0x49, 0xAA, 0xA9,
+    0x70, 0x77, 0x70, 0xDA, 0x72, 0xAD, 0x72, 0xDA, 0xE4, 0xFC, 0x9A, 0xD4, 0xFA, 0x0A, 0xD4, 0xE9,
+    0x1A, 0xD4, 0xE9, 0x1A, 0xD4, 0xE9, 0x19, 0xD9, 0x3E, 0x91, 0x9D, 0x93, 0xE9, 0x19, 0xE2, 0x9E,
+    0x92, 0xFA, 0x9F, 0xA2, 0xFF, 0xDA, 0x29, 0xFF, 0xCA, 0x39, 0xFA, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0xAD, 0xA7, 0x1E, 0xA7, 0x1F, 0x70, 0x9F, 0x71, 0xAA, 0xAA, 0x50, 0x29, 0xAA, 0x97, 0x5A,
+    0xDA, 0x75, 0xAE, 0x75, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xE9, 0x6F, 0x1F, 0x59,
+    0xE9, 0x19, 0xE9, 0x4F, 0x3F, 0x3A, 0xE9, 0x3A, 0xE9, 0x2F, 0x5F, 0x1A, 0xE9, 0x5A, 0xE9, 0x0F,
+    0x7F, 0xAE, 0xA7, 0xAF, 0xE7, 0x09, 0xFD, 0xA7, 0x1F, 0xD7, 0x29, 0xFA, 0x73, 0xF9, 0x73, 0xF9,
+    0x73, 0xF9, 0x73, 0xF9, 0x72, 0x9F, 0x97, 0x29, 0xF9, 0x50, 0x19, 0xAA, 0x97, 0x2A, 0xDA, 0x72,
+    0xAE, 0x97, 0x1A, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xAE,
+    0x3E, 0x92, 0xE9, 0x2E, 0x3A, 0xE1, 0x9D, 0xA4, 0xEA, 0x0E, 0x94, 0xAE, 0x9E, 0x6F, 0xDA, 0x6A,
+    0xFC, 0x97, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1F, 0x59, 0xAA, 0xFA, 0x5A, 0xFD,
+    0x6A, 0xFC, 0x96, 0xAE, 0xA7, 0x9E, 0x96, 0xF1, 0xF5, 0x9E, 0x91, 0x9E, 0x94, 0xF3, 0xF3, 0xAE,
+    0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE, 0x90, 0xF7, 0xFA, 0xEA, 0x7A, 0xFE, 0x70, 0x9F,
+    0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x29, 0xF9,
+    0x72, 0x9F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9E, 0x74, 0xAE, 0x74, 0xAE, 0x74,
+    0xF9, 0x73, 0xAA, 0xAA, 0x60, 0xAE, 0x5E, 0x2E, 0x93, 0xAD, 0xA2, 0xAE, 0x3E, 0x93, 0xE9, 0x2E,
+    0x4A, 0xE1, 0x9D, 0xA5, 0xEA, 0x0E, 0x95, 0xAE, 0x9E, 0x7F, 0xDA, 0x7A, 0xFC, 0x97, 0x0F, 0xC7,
+    0x1F, 0xC7, 0x19, 0xE9, 0x71, 0x9E, 0x72, 0xF6, 0x9A, 0xAF, 0xA6, 0xAF, 0xD2, 0xAA, 0xA1, 0xAF,
+    0xC9, 0x19, 0xE1, 0xAE, 0xA3, 0x9E, 0x97, 0x1A, 0xE9, 0x71, 0xFA, 0x6D, 0x97, 0x5A, 0xAC, 0x76,
+    0xAC, 0x75, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x9E, 0x96, 0xF1, 0xF5, 0x9E, 0x91,
+    0x9E, 0x94, 0xF3, 0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE, 0x90, 0xF7, 0xFA,
+    0xEA, 0x7A, 0xFE, 0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x3F,
+    0x97, 0x3F, 0x97, 0x29, 0xF9, 0x72, 0x9F, 0x95, 0x59, 0x97, 0x3E, 0x74, 0xC7, 0x3D, 0x72, 0xAA,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xAE, 0x3E, 0x92, 0xE9,
+    0x2E, 0x3A, 0xE1, 0x9D, 0xA4, 0xEA, 0x0E, 0x94, 0xAE, 0x9E, 0x6F, 0xDA, 0x6A, 0xFC, 0x97, 0xFC,
+    0x70, 0xFC, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1F, 0x59, 0xAA, 0xFA, 0x5A, 0xFD, 0x6A, 0xFC, 0x96,
+    0xAE, 0xA7, 0x4A, 0xCA, 0x1C, 0x97, 0x09, 0xF0, 0xCA, 0x70, 0xAC, 0x9F, 0xA7, 0x0A, 0xC9, 0x0E,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9E, 0x96, 0xF1, 0xF5, 0x9E, 0x91, 0x9E, 0x94, 0xF3,
+    0xF3, 0xAE, 0x93, 0xAE, 0x92, 0xF5, 0xF1, 0xAE, 0x95, 0xAE, 0x90, 0xF7, 0xFA, 0xEA, 0x7A, 0xFE,
+    0x70, 0x9F, 0xDA, 0x71, 0xFD, 0x72, 0x9F, 0xA7, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97, 0x3F, 0x97,
+    0x29, 0xF9, 0x72, 0x9F, 0x95, 0x77, 0x1A, 0xD1, 0xD5, 0x9F, 0x9C, 0xA5, 0xAC, 0x9A, 0xEA, 0x5A,
+    0xC9, 0x0A, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0xAE, 0x5E, 0x1E, 0x93, 0xAD, 0xA1, 0xAE, 0x3E,
+    0x92, 0xE9, 0x2E, 0x3A, 0xE1, 0x9D, 0xA4, 0xEA, 0x0E, 0x94, 0xAE, 0x9E, 0x6F, 0xDA, 0x6A, 0xFC,
+    0x97, 0xFC, 0x70, 0xFC, 0x70, 0x9E, 0x97, 0x09, 0xE7, 0x1F, 0x59, 0xAA, 0xFA, 0x5A, 0xFD, 0x6A,
+    0xFC, 0x96, 0xAE, 0xA7, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9A, 0xFF, 0xDA, 0xFF, 0xD0, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x9A, 0xFF, 0xDA, 0xFF, 0xD0, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x90, 0xFF, 0xFE, 0xA0, 0xFF, 0xFE, 0xA0, 0x76, 0xAF, 0xFF, 0xC9, 0xFF, 0xFD, 0x9F, 0xFF, 0xD9,
+    0x76, 0x77, 0x5A, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFF, 0xC7, 0x76, 0x77, 0x5A,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFC, 0x9F, 0xFF, 0xFF, 0xC7, 0x76, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2,
+    0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0xA2, 0xDA, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xD9,
+    0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xD9, 0x0D, 0x92, 0xD9, 0x9D, 0x92, 0xD9, 0x9D, 0x91, 0x9D, 0x99,
+    0xD9, 0x19, 0xD9, 0x9D, 0x29, 0xD9, 0x9D, 0x29, 0xD0, 0x9D, 0x29, 0xD0, 0x9D, 0x29, 0xD0, 0x9D,
+    0x29, 0xD0, 0x9D, 0x29, 0xD0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF,
+    0xF0, 0xAF, 0xFF, 0xF7, 0x77, 0x74, 0xAF, 0xFF, 0xF0, 0xAF, 0xFF, 0xF0, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x90, 0x6A, 0xF9, 0x09, 0xF9, 0x1F, 0x2A, 0xE9, 0x19, 0xF2, 0xF2, 0xFA,
+    0x79, 0xFA, 0x09, 0xF9, 0x09, 0xF1, 0x9E, 0xA1, 0xF9, 0x1F, 0x1A, 0xF1, 0x7A, 0xF9, 0x0A, 0xF1,
+    0x9F, 0x1A, 0xE9, 0x1F, 0x19, 0xF1, 0xFA, 0x10, 0x6A, 0xF9, 0x09, 0xF9, 0x1F, 0x2A, 0xE9, 0x19,
+    0xF2, 0xF2, 0xFA, 0x75, 0xAF, 0x90, 0xFC, 0x19, 0xF9, 0x09, 0xF2, 0xF2, 0xF2, 0xAE, 0x91, 0xF9,
+    0x19, 0xF1, 0xAE, 0xA2, 0xF1, 0x9F, 0x2F, 0xA1, 0xF9, 0x76, 0x9F, 0xA0, 0xAF, 0x90, 0x9F, 0x90,
+    0x9F, 0x19, 0xF1, 0x9F, 0x19, 0xEA, 0x1A, 0xEA, 0x1F, 0x91, 0xF2, 0xF1, 0x9F, 0x1A, 0xF1, 0xAE,
+    0xA1, 0x7A, 0xF9, 0x0A, 0xF1, 0x9F, 0x1A, 0xE9, 0x1F, 0x19, 0xF1, 0xFA, 0x10, 0x75, 0xAF, 0x90,
+    0xAF, 0x19, 0xF9, 0x09, 0xF2, 0xF2, 0xF2, 0xAE, 0x91, 0xF9, 0x19, 0xF1, 0xAE, 0xA2, 0xF1, 0x9F,
+    0x2F, 0xA1, 0xF9, 0x69, 0x71, 0xAD, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71,
+    0xFD, 0x91, 0x9F, 0xFD, 0x1F, 0xFE, 0x09, 0xFE, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7,
+    0x1E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x70, 0x9D, 0xA7, 0x09, 0xDA, 0x70, 0x9D, 0xA7, 0x1D,
+    0xA7, 0x1A, 0xCA, 0x72, 0xCA, 0x72, 0x9A, 0x73, 0x97, 0x71, 0x49, 0xAA, 0x71, 0x9D, 0x97, 0x0A,
+    0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xD9, 0x70, 0xAD, 0x6A, 0xFF, 0xA1,
+    0xAF, 0xFD, 0x1F, 0xFE, 0x94, 0xAD, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x6A, 0xAA, 0xEA, 0xD9,
+    0x19, 0xFF, 0xCA, 0x1F, 0xFE, 0x5E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0x9D, 0x72, 0xAC,
+    0x73, 0xC7, 0x39, 0x77, 0x10, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFE, 0x5F, 0xFE, 0x93,
+    0x9F, 0xFE, 0x93, 0x9F, 0xFE, 0xA3, 0xAF, 0xFE, 0xA3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC,
+    0x29, 0xFF, 0xFC, 0x91, 0xAF, 0xFF, 0xC9, 0x1F, 0xFF, 0xDA, 0x1F, 0xFF, 0xDA, 0x1F, 0xFF, 0xE0,
+    0x9F, 0xFF, 0xE0, 0xAF, 0xFF, 0xE0, 0x69, 0xCA, 0x3A, 0xE9, 0x1A, 0xFC, 0x0A, 0xFC, 0x0A, 0xEA,
+    0x19, 0xCA, 0x72, 0x1A, 0xAA, 0x19, 0xE1, 0xAE, 0x1F, 0x90, 0xF9, 0x1A, 0xAA, 0x19, 0xE1, 0xAE,
+    0x1F, 0x90, 0xF9, 0x09, 0xAA, 0x4A, 0xA9, 0x29, 0xAA, 0x91, 0xEA, 0x2A, 0xE2, 0xAD, 0xA1, 0xEA,
+    0x2F, 0x2F, 0x09, 0xF2, 0xF2, 0xF0, 0x9F, 0x2F, 0x90, 0x9F, 0x00, 0x09, 0x9A, 0xDA, 0xD0, 0x73,
+    0x99, 0x74, 0xDA, 0x3A, 0xCA, 0x4A, 0xD4, 0xC9, 0xA9, 0x3D, 0x93, 0x9A, 0xCA, 0xA2, 0xE4, 0x9C,
+    0x9A, 0xA1, 0x9D, 0x95, 0xE9, 0x1E, 0x6A, 0xCA, 0x1A, 0xD9, 0x72, 0x9D, 0xA7, 0x3E, 0x73, 0x9D,
+    0xA7, 0x3E, 0x73, 0xAD, 0x97, 0x29, 0xE0, 0x9A, 0xA0, 0x9A, 0xA3, 0xE9, 0x0C, 0x9C, 0x0C, 0x9A,
+    0x29, 0xE1, 0xCA, 0xC0, 0xCA, 0xA2, 0xE2, 0xCA, 0xC0, 0xCA, 0xC1, 0xAD, 0xA2, 0x9C, 0xA0, 0x9C,
+    0xA1, 0xAA, 0xA7, 0x30, 0x71, 0xFC, 0x2F, 0xA2, 0xF9, 0x2F, 0x29, 0xF2, 0xAE, 0xA2, 0xF9, 0x10,
+    0x77, 0x0F, 0xC1, 0xFC, 0x2F, 0xA1, 0xFA, 0x2F, 0x91, 0xF9, 0x2F, 0x2F, 0x29, 0xF1, 0xAE, 0xA2,
+    0xAE, 0xA1, 0xF9, 0x2F, 0x90, 0x9F, 0x20, 0x77, 0x3C, 0xA2, 0xAC, 0x91, 0x9C, 0x92, 0xAD, 0xA1,
+    0xE1, 0xE2, 0xE1, 0xAD, 0x90, 0x9D, 0xA1, 0xAD, 0x91, 0xDA, 0x1E, 0x2D, 0x91, 0xAD, 0x19, 0xD7,
+    0x73, 0x69, 0xCA, 0x2E, 0x29, 0xDA, 0x2A, 0xD3, 0xDA, 0x50, 0x72, 0xAC, 0x1A, 0xC9, 0x1A, 0xDA,
+    0x0E, 0x2E, 0x0A, 0xD9, 0x2D, 0xA0, 0xE2, 0x9D, 0x1D, 0x97, 0x10, 0x77, 0x19, 0xC2, 0xAC, 0x92,
+    0xAA, 0x29, 0xE1, 0xE1, 0xAD, 0x92, 0xE9, 0x0A, 0xDA, 0x09, 0xE3, 0xE1, 0xE1, 0x9D, 0xA2, 0x9D,
+    0x91, 0xD9, 0x1A, 0xD7, 0x71, 0x4A, 0xA7, 0x0E, 0x96, 0xFC, 0x94, 0xEA, 0xEA, 0x19, 0xF0, 0x9F,
+    0x00, 0x73, 0x99, 0x3A, 0xC9, 0x2E, 0x91, 0xE9, 0x1E, 0x2A, 0xDA, 0x29, 0xEA, 0x3F, 0x3E, 0x4D,
+    0x59, 0x00, 0x6A, 0x5A, 0xC9, 0x3A, 0xDA, 0x3A, 0xDA, 0x39, 0xE3, 0xE9, 0x1F, 0x1F, 0x19, 0xDA,
+    0x3C, 0xA4, 0xA4, 0x71, 0xAA, 0x97, 0x71, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xF7, 0x19, 0xF9, 0x1F,
+    0x91, 0xF9, 0x2A, 0xF7, 0xF9, 0x4F, 0xC5, 0xFA, 0x6F, 0xC3, 0xFC, 0x79, 0xFA, 0x1A, 0xF7, 0x1A,
+    0xFA, 0xAF, 0x95, 0xE1, 0xFF, 0xCA, 0x1E, 0x99, 0xE9, 0x1F, 0xF2, 0xEA, 0x9E, 0x91, 0x9F, 0xD2,
+    0x9E, 0xAA, 0xEA, 0x2F, 0xD2, 0x9F, 0x9A, 0xAA, 0x91, 0xFF, 0x19, 0xAA, 0xA9, 0x5F, 0xFD, 0x72,
+    0xFF, 0xEA, 0x70, 0xAF, 0xC9, 0xAF, 0xCA, 0x6A, 0xFC, 0xA1, 0xFD, 0x94, 0x9F, 0xD3, 0xFD, 0x92,
+    0x9F, 0xD4, 0x9F, 0xD1, 0x9F, 0xD9, 0x5A, 0xFD, 0x77, 0x76, 0x9A, 0xA9, 0x77, 0x1A, 0xE7, 0x71,
+    0xF7, 0x71, 0xF7, 0x71, 0xF7, 0x10, 0x79, 0x4A, 0xC3, 0xAD, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x19,
+    0xE1, 0x9E, 0x19, 0xE1, 0xAE, 0x1A, 0xDA, 0x19, 0xDA, 0x3C, 0xA4, 0x97, 0x77, 0x1A, 0xAA, 0xA1,
+    0xF0, 0x9F, 0x99, 0xF9, 0xAF, 0xAF, 0xCA, 0x49, 0x73, 0xAA, 0x72, 0xAC, 0x97, 0x1E, 0x71, 0xE7,
+    0xAF, 0xA4, 0x9F, 0xF9, 0x1A, 0xFF, 0xD2, 0xD9, 0x0E, 0xAD, 0xA1, 0x92, 0xE0, 0xE4, 0x9E, 0x0E,
+    0x49, 0xE0, 0xE9, 0x39, 0xDA, 0x0E, 0x4A, 0xDA, 0x9E, 0x4A, 0xFD, 0xA4, 0xAF, 0xD5, 0xAF, 0xC6,
+    0xAE, 0xA7, 0xAE, 0x97, 0xAE, 0x97, 0xAE, 0x97, 0xD9, 0x77, 0x77, 0x77, 0x0A, 0xAA, 0x97, 0x0F,
+    0x70, 0xF7, 0x9F, 0x7A, 0xF9, 0x6A, 0xF9, 0x6F, 0xCA, 0x6A, 0xAA, 0xAA, 0x93, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x9A, 0xFF, 0xDA, 0xFF, 0xD0, 0x0A, 0xCA, 0x29, 0xD9, 0x0F, 0xFC, 0x19, 0xFE, 0x92,
+    0x9A, 0xEA, 0x91, 0x59, 0x97, 0x29, 0x0C, 0xA0, 0xA7, 0xAC, 0xAF, 0x96, 0x9F, 0xC9, 0x70, 0x9F,
+    0x97, 0x9F, 0xDA, 0x7C, 0x0D, 0x0A, 0x09, 0x5A, 0xC0, 0xCA, 0x1C, 0xA0, 0xA1, 0xA0, 0xAC, 0x0A,
+    0xD9, 0xDA, 0xC9, 0x9F, 0xDA, 0xFC, 0x92, 0xF9, 0x09, 0xFA, 0x90, 0xAF, 0xFD, 0xAC, 0x90, 0xDA,
+    0xC9, 0xC9, 0xA0, 0xD5, 0xAC, 0x49, 0x77, 0x20, 0x72, 0xD9, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xDA,
+    0x71, 0xAD, 0x71, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1E, 0x71, 0xAD, 0x97, 0x09, 0xE7, 0x1E,
+    0x71, 0xAD, 0xA7, 0x1E, 0x71, 0xEA, 0x70, 0x9E, 0x71, 0xE9, 0x70, 0x9A, 0xAA, 0x71, 0x77, 0x75,
+    0x9A, 0xA9, 0x70, 0x9A, 0xA9, 0x6A, 0xFD, 0xA4, 0xAF, 0xD9, 0x29, 0xFF, 0xCA, 0x19, 0xFF, 0xCA,
+    0x1A, 0xE9, 0x19, 0xE9, 0x0A, 0xE9, 0x19, 0xE9, 0x1A, 0xA4, 0x9E, 0x1C, 0xA4, 0x9D, 0xA7, 0x1E,
+    0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x70, 0x9E, 0x70, 0xAE, 0x70, 0xEA, 0x7A,
+    0xE9, 0x69, 0xF6, 0xFC, 0xA5, 0x9F, 0xC9, 0x5A, 0xFA, 0x6A, 0xF9, 0x6A, 0xE9, 0x7F, 0x70, 0xAE,
+    0x97, 0xF7, 0x0A, 0xE9, 0x7F, 0x70, 0xEA, 0x70, 0xEA, 0x70, 0xA9, 0x72, 0xA9, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x70, 0xE9, 0x70, 0xE9, 0x70, 0xEA, 0x70, 0xE9, 0x70, 0xEA, 0x79, 0xEA, 0x79, 0xF7,
+    0xAE, 0xA7, 0x9A, 0xAA, 0xA7, 0x9A, 0xAA, 0x94, 0x77, 0x71, 0x9A, 0xA9, 0x71, 0x94, 0xAF, 0xDA,
+    0x7C, 0x91, 0x9F, 0xFC, 0xA6, 0xD9, 0x0A, 0xE9, 0x19, 0xE9, 0x49, 0xD9, 0x1A, 0xA4, 0x9E, 0x49,
+    0xD9, 0x71, 0xE4, 0x9D, 0x97, 0x1E, 0x4A, 0xD9, 0x71, 0xE4, 0xAD, 0x97, 0x1E, 0x4E, 0x97, 0x0A,
+    0xE4, 0xE9, 0x7A, 0xE9, 0x4E, 0x95, 0xAF, 0xA5, 0xE5, 0xAF, 0xA6, 0xE5, 0xAE, 0x97, 0xE5, 0xAE,
+    0x97, 0x0D, 0x5F, 0x97, 0x1A, 0x5F, 0x77, 0x1C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x7A,
+    0xEA, 0x4E, 0xA7, 0xAE, 0xA4, 0xEA, 0x7F, 0xC3, 0x9F, 0x7F, 0xC3, 0x9A, 0xAA, 0xA7, 0xFC, 0x77,
+    0x9A, 0xAA, 0xAA, 0x00, 0x77, 0x39, 0x4A, 0xAA, 0x96, 0xCA, 0x09, 0xFE, 0x94, 0xFF, 0xF9, 0x3F,
+    0xCA, 0x91, 0xAE, 0x29, 0xDA, 0xC9, 0x4E, 0x91, 0x9D, 0x96, 0x9D, 0xA1, 0x9D, 0x96, 0x9E, 0x1A,
+    0xD9, 0x69, 0xE1, 0xAD, 0x96, 0xAD, 0xA1, 0xAD, 0x96, 0xE9, 0x1E, 0x94, 0x9F, 0x2E, 0x92, 0xAF,
+    0xC3, 0xE9, 0x2F, 0xC4, 0xE9, 0x2F, 0x6A, 0xC9, 0x2F, 0x7A, 0x92, 0xF7, 0x39, 0xE9, 0x73, 0x9A,
+    0x97, 0x77, 0x77, 0x1A, 0xAA, 0x97, 0x39, 0xEA, 0x19, 0xE5, 0xAF, 0x19, 0xE5, 0xFC, 0x1A, 0xE9,
+    0x4F, 0xC1, 0xF9, 0x4F, 0xC9, 0x0A, 0xAA, 0xA9, 0x30, 0x77, 0x72, 0xAC, 0x74, 0xE7, 0x39, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x74, 0xDA, 0x73, 0x9D, 0x94, 0x9A, 0xA3, 0xAD, 0x5E, 0x92, 0xE5, 0xEA,
+    0x19, 0xDA, 0x49, 0xEA, 0x1A, 0xD9, 0x4A, 0xF1, 0xE7, 0x4E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x3E,
+    0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xDA, 0x2E, 0x94, 0xE9, 0x2E, 0xA4,
+    0xE3, 0xEA, 0x3A, 0xE2, 0x9F, 0x3E, 0xA2, 0x9A, 0xAA, 0xA3, 0xE9, 0x72, 0x9E, 0x73, 0xAD, 0xA7,
+    0x3E, 0x97, 0x29, 0xE7, 0x3A, 0xE7, 0x3E, 0xA7, 0x3D, 0xA7, 0x39, 0xC9, 0x74, 0x97, 0x60, 0x1A,
+    0xCA, 0x2A, 0xC0, 0xAA, 0x1C, 0x99, 0x9C, 0x1C, 0xAC, 0x9C, 0x1C, 0xAC, 0x9C, 0x1C, 0xA0, 0xAC,
+    0x1F, 0xC2, 0xE9, 0x70, 0x39, 0x49, 0xC9, 0x3D, 0x92, 0xC9, 0xC9, 0x1A, 0xC0, 0xCA, 0x1F, 0xC9,
+    0x29, 0xCA, 0x4C, 0xA0, 0x29, 0x92, 0xFC, 0x1C, 0xA4, 0xCA, 0x93, 0xFA, 0x4A, 0xC1, 0xA9, 0x0D,
+    0x1F, 0xC1, 0xAD, 0xA1, 0x29, 0x99, 0x2F, 0x1A, 0xC4, 0xC9, 0x93, 0xFA, 0x1D, 0x09, 0xC9, 0x0D,
+    0x09, 0xC9, 0x0A, 0xF2, 0x9A, 0x91, 0x09, 0x99, 0x99, 0x1F, 0xC9, 0x39, 0xC9, 0x3A, 0xC4, 0xD4,
+    0xD3, 0xAC, 0xA3, 0xDA, 0x3D, 0x90, 0x70, 0xAD, 0x91, 0xAC, 0x09, 0xC1, 0xAC, 0x09, 0xC2, 0xEA,
+    0x1A, 0xC9, 0xAC, 0x1C, 0xA1, 0xCA, 0x0F, 0xC9, 0x09, 0xEA, 0x00, 0x79, 0xE9, 0x1C, 0xA0, 0x9C,
+    0x1C, 0x2C, 0x90, 0xC9, 0x09, 0xCA, 0x0A, 0xFA, 0x19, 0xA9, 0xCA, 0x0A, 0xAA, 0xD1, 0xF9, 0x70,
+    0x74, 0xDA, 0x9E, 0xA3, 0xFF, 0xC9, 0x1F, 0xCA, 0xF1, 0xE9, 0x2A, 0xD0, 0x9E, 0x39, 0xD9, 0x9D,
+    0xA3, 0x9D, 0x99, 0xE3, 0xAD, 0xA9, 0xE3, 0xAD, 0xAA, 0xE3, 0xEA, 0xAE, 0x3F, 0xAE, 0x3F, 0xF3,
+    0xF0, 0x1A, 0xCA, 0x2A, 0xC0, 0xAC, 0x1C, 0xA9, 0x0C, 0x90, 0xCA, 0xC9, 0xC9, 0x0C, 0xAC, 0x9C,
+    0x90, 0xD0, 0xAC, 0x90, 0xFC, 0x2E, 0xA3, 0x92, 0x29, 0x39, 0xD9, 0x2A, 0xAC, 0x93, 0x9C, 0x93,
+    0x9C, 0x93, 0xAC, 0x93, 0xAC, 0x92, 0xFC, 0x1F, 0xC0, 0x09, 0xE9, 0x1C, 0xAA, 0xD4, 0x9C, 0x93,
+    0x9C, 0x93, 0xD3, 0xDA, 0x19, 0xE2, 0xFC, 0xA0, 0xFC, 0x90, 0x09, 0xE9, 0x1A, 0x99, 0xAC, 0x5C,
+    0x92, 0x9A, 0xC2, 0xEA, 0x4A, 0xC9, 0x0A, 0xF9, 0x0F, 0xA7, 0x3A, 0x93, 0x9C, 0xA3, 0xDA, 0x2C,
+    0x9D, 0x1A, 0xC0, 0xD1, 0xFD, 0x3D, 0x4D, 0x00, 0x7F, 0xA1, 0xC9, 0x4F, 0x29, 0x99, 0xD1, 0x91,
+    0xD1, 0xFC, 0x1A, 0xE7, 0x00, 0x19, 0xE1, 0x9C, 0xA9, 0x91, 0xCA, 0x4F, 0x91, 0xDA, 0xAC, 0x90,
+    0xD1, 0xCA, 0x0D, 0x09, 0xCA, 0x0A, 0xF2, 0x9A, 0xA1, 0x7F, 0xCA, 0x09, 0x99, 0xAC, 0x93, 0xAC,
+    0x4D, 0x4D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x70, 0x1A, 0xDA, 0x1A, 0xC0, 0x9C, 0x90, 0xAC, 0x1C,
+    0x90, 0x9C, 0xAA, 0xC2, 0xF1, 0xD0, 0x9C, 0xA0, 0xD1, 0xD0, 0xFC, 0xA1, 0xAA, 0xA9, 0x00, 0x1A,
+    0xD9, 0x1C, 0xA9, 0xAC, 0x1C, 0x2C, 0x90, 0xC2, 0xCA, 0x0D, 0xAD, 0xA1, 0xAE, 0xA4, 0xC9, 0x0F,
+    0xC1, 0x9A, 0xAA, 0x10, 0x75, 0xE4, 0xAD, 0x93, 0x9E, 0x4E, 0x93, 0x9E, 0x4E, 0x94, 0xE4, 0xAD,
+    0xA4, 0xE9, 0x4E, 0x49, 0xE4, 0x9E, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xE4, 0x9E, 0x49,
+    0xE5, 0xE9, 0x4E, 0xA4, 0xAE, 0x49, 0xE9, 0x4F, 0x4A, 0xE4, 0x9F, 0x4F, 0x93, 0x9F, 0x4A, 0xEA,
+    0x71, 0xE5, 0x9D, 0xA5, 0xE9, 0x49, 0xE5, 0xE9, 0x49, 0xE5, 0xE9, 0x4A, 0xDA, 0x49, 0xE5, 0xE5,
+    0xE9, 0x4A, 0xD9, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4A, 0xDA, 0x4E, 0xA4, 0xE9, 0x4E, 0x49,
+    0xE4, 0xF4, 0xE9, 0x3A, 0xE4, 0xF3, 0xAE, 0x92, 0x9F, 0x3F, 0x92, 0x9E, 0xA3, 0x70, 0xAC, 0x90,
+    0xD7, 0x1D, 0x90, 0xD7, 0x1D, 0x09, 0xD7, 0x09, 0xD0, 0xAC, 0xA7, 0x0A, 0xCA, 0x0D, 0x97, 0x9F,
+    0xE5, 0x9F, 0xFC, 0x4A, 0xFF, 0xD3, 0x9F, 0xFD, 0xA3, 0xFD, 0xA0, 0xDA, 0x3A, 0xFD, 0xA0, 0xD9,
+    0x3F, 0x9D, 0x90, 0xD4, 0xF0, 0xD0, 0x9D, 0x39, 0xF9, 0xD0, 0xAC, 0xA3, 0xAF, 0x9D, 0x0A, 0xCA,
+    0x3A, 0xFA, 0xCA, 0x0D, 0x93, 0xAF, 0xD9, 0x0D, 0x49, 0xFD, 0x99, 0xD9, 0xAA, 0x2F, 0xFF, 0xA2,
+    0xAF, 0xFF, 0x3F, 0xFF, 0x4F, 0xFE, 0x5F, 0xFD, 0x49, 0xD0, 0xAC, 0xA7, 0x09, 0xD0, 0xAC, 0xA7,
+    0x0A, 0xCA, 0x0D, 0x97, 0x0A, 0xC9, 0x0D, 0x50, 0x77, 0x69, 0xAF, 0xCA, 0x59, 0xFF, 0xC4, 0xAF,
+    0xFD, 0x39, 0xFF, 0xDA, 0x3F, 0xC9, 0x70, 0xAF, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xF2, 0xDA, 0xAC,
+    0xA1, 0xAF, 0x2F, 0xCA, 0x1A, 0xF2, 0xE9, 0x09, 0x1A, 0xF9, 0x1D, 0xA4, 0x9F, 0xCA, 0x9D, 0xA9,
+    0xAA, 0x2F, 0xFF, 0xA2, 0xAF, 0xFF, 0x3F, 0xFF, 0x39, 0xFF, 0xE5, 0xAF, 0xFC, 0x00, 0x77, 0x49,
+    0x71, 0xAF, 0xC9, 0x5F, 0xFA, 0x3A, 0xDA, 0x19, 0xE9, 0x2A, 0xD7, 0x0A, 0xFF, 0xD2, 0xAF, 0xFD,
+    0x39, 0x9E, 0x99, 0x99, 0x95, 0xE7, 0x0F, 0xFD, 0x92, 0xFF, 0xD9, 0x5A, 0xD7, 0x2A, 0xD7, 0x19,
+    0xE7, 0x9F, 0xC7, 0xFF, 0xCA, 0xA2, 0xFF, 0xEA, 0x1F, 0xFF, 0x90, 0x77, 0xE7, 0x09, 0xF5, 0xE7,
+    0x09, 0xF4, 0x9E, 0x70, 0x9F, 0xA3, 0x9E, 0x70, 0xAF, 0xC3, 0x9E, 0x70, 0xAF, 0xCA, 0x29, 0xE7,
+    0x0A, 0xFD, 0x2A, 0xE7, 0x0A, 0xFD, 0x91, 0xAE, 0x70, 0xFA, 0xE1, 0xAE, 0x4F, 0xFF, 0xFF, 0xCA,
+    0x0F, 0xFF, 0xFF, 0xCA, 0x4F, 0x90, 0xE9, 0xEA, 0x70, 0xF9, 0x0F, 0xEA, 0x79, 0xF9, 0x09, 0xFD,
+    0xA7, 0x9F, 0x91, 0xFD, 0x97, 0x9F, 0x91, 0x9F, 0xC9, 0x7A, 0xF9, 0x2F, 0xC9, 0x7A, 0xFA, 0x2A,
+    0xF9, 0x30, 0x39, 0xAA, 0xAA, 0xAA, 0x97, 0x2A, 0xFF, 0x97, 0x0A, 0xFF, 0xC9, 0x7E, 0x92, 0xAE,
+    0x4F, 0xFF, 0xFC, 0x1A, 0xAA, 0xFA, 0xAA, 0xAF, 0xAA, 0x4E, 0x92, 0x9E, 0xA6, 0xFF, 0xE9, 0x6F,
+    0xFE, 0x7F, 0xFD, 0x97, 0xFF, 0xC7, 0x09, 0xFA, 0x99, 0x72, 0x9E, 0xA7, 0x59, 0xEA, 0x75, 0x9F,
+    0x75, 0x9F, 0x75, 0xAF, 0x75, 0xAF, 0x72, 0x09, 0xFC, 0x97, 0x7A, 0xFD, 0xA7, 0x6A, 0xD9, 0x9A,
+    0xD7, 0x6A, 0xCA, 0x2A, 0xCA, 0x75, 0xAC, 0xA2, 0xAC, 0xA7, 0x5A, 0xCA, 0x29, 0xD7, 0x5D, 0xA2,
+    0xAD, 0x5A, 0xEA, 0x2E, 0x99, 0xAD, 0xA4, 0xFD, 0x2F, 0xF9, 0x4C, 0xA2, 0x92, 0xFE, 0xA5, 0xCA,
+    0x6F, 0xF5, 0xEA, 0x93, 0xEA, 0x09, 0xDA, 0x5F, 0xA2, 0xE9, 0x1E, 0x69, 0xAD, 0xA1, 0xE9, 0x1E,
+    0x70, 0xAD, 0x1E, 0x91, 0xEA, 0x3D, 0x99, 0xE1, 0xE9, 0x1F, 0x2F, 0xF0, 0x9E, 0x91, 0xF2, 0xFE,
+    0x91, 0x99, 0x99, 0x19, 0x99, 0x93, 0xAE, 0xA7, 0x77, 0x10, 0x1A, 0xC9, 0x7A, 0xCA, 0x3E, 0x7D,
+    0xA3, 0xAD, 0x7D, 0xA3, 0xAD, 0x7D, 0x93, 0x9D, 0x7D, 0x49, 0xD9, 0x1D, 0x19, 0xD2, 0xFF, 0xFF,
+    0xC9, 0xFF, 0xFF, 0xC9, 0x09, 0x9E, 0x9F, 0x9E, 0x99, 0x3E, 0x0F, 0x0D, 0xA5, 0xAD, 0xAF, 0x9D,
+    0x95, 0xAF, 0xFD, 0x69, 0xFC, 0xAF, 0x69, 0xFA, 0x9F, 0x7F, 0x90, 0xF7, 0xF1, 0xEA, 0x7F, 0x1E,
+    0xA7, 0xEA, 0x1A, 0xD9, 0x30, 0xAA, 0x99, 0x97, 0x2F, 0xF9, 0x49, 0x9F, 0xFC, 0xA2, 0xAF, 0xDA,
+    0x99, 0xE9, 0x1A, 0xFC, 0x4E, 0x1A, 0xFA, 0x49, 0xD1, 0xAF, 0xA0, 0xAA, 0x90, 0x9D, 0x1A, 0xFA,
+    0x0E, 0x09, 0xD1, 0xAF, 0xA0, 0xE0, 0x9D, 0x1A, 0xFA, 0x0E, 0x1D, 0x1F, 0xCA, 0x0A, 0xD5, 0xFC,
+    0xA0, 0xAD, 0xA4, 0xFC, 0xA0, 0x9E, 0xA9, 0x1A, 0xFC, 0xA1, 0xAF, 0xFD, 0x9A, 0x92, 0x9F, 0xFC,
+    0x70, 0x99, 0xAA, 0xE0, 0x72, 0xAA, 0x74, 0x9D, 0x71, 0xAF, 0xEA, 0x6A, 0xFE, 0xA7, 0x1A, 0xD7,
+    0x0A, 0xDA, 0xAD, 0x7F, 0xEA, 0x6E, 0x9A, 0xEA, 0x6D, 0x2A, 0xDA, 0x59, 0xCA, 0x29, 0xDA, 0x59,
+    0xCA, 0x29, 0xDA, 0x59, 0xD9, 0x1E, 0xA6, 0xFF, 0xA6, 0x9F, 0xEA, 0x79, 0xAD, 0xAA, 0xCA, 0x77,
+    0x3F, 0xFF, 0x3F, 0xFF, 0x20, 0x77, 0x59, 0xAF, 0xC9, 0x5F, 0xF9, 0x4A, 0xFF, 0x94, 0xFA, 0x99,
+    0x9A, 0x49, 0xE9, 0x69, 0xFF, 0xC4, 0xAF, 0xFC, 0x93, 0xAA, 0xAF, 0xCA, 0xA9, 0x6A, 0xDA, 0x72,
+    0xAE, 0xAA, 0xA4, 0x9F, 0xFC, 0x4A, 0xFF, 0xCA, 0x3A, 0xAA, 0xAE, 0x97, 0x2F, 0x97, 0x1F, 0xFC,
+    0x94, 0xAF, 0xF9, 0x5F, 0xF9, 0x69, 0xAF, 0xC9, 0x76, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xA9, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0xAF, 0xFF, 0xDA, 0x5E, 0xA1, 0x97, 0x0F, 0xDA, 0x70,
+    0xFD, 0xA6, 0xAF, 0xE9, 0x5A, 0xFD, 0x70, 0xAF, 0xD7, 0x0A, 0xA0, 0xFA, 0xCA, 0x70, 0xFD, 0xA6,
+    0x9A, 0xFD, 0xA5, 0xAF, 0xDA, 0x7A, 0xFD, 0x70, 0xAC, 0xAF, 0x73, 0xF7, 0x3F, 0x50, 0x49, 0xAA,
+    0xAA, 0xAA, 0x97, 0x4A, 0xFF, 0x97, 0x2F, 0xFD, 0xA4, 0xAF, 0xFF, 0xFE, 0x94, 0xE9, 0x3A, 0xD9,
+    0x3A, 0xFF, 0xFF, 0xE9, 0x4E, 0x92, 0x9E, 0xA7, 0x0F, 0xFE, 0x97, 0x0F, 0xFE, 0x71, 0xFF, 0xD9,
+    0x71, 0xFF, 0xC7, 0x29, 0xFA, 0x99, 0x74, 0x9E, 0xA7, 0x79, 0xEA, 0x77, 0x9F, 0x77, 0x9F, 0x77,
+    0xAF, 0x77, 0xAF, 0x73, 0x79, 0x97, 0x7D, 0xA7, 0x6D, 0xA7, 0x6D, 0xA7, 0x6D, 0xA7, 0x3A, 0xFE,
+    0xAA, 0x5A, 0xFF, 0xE4, 0xAF, 0xFF, 0x39, 0xFF, 0xAA, 0xAA, 0xC3, 0xFC, 0x1D, 0x97, 0xF9, 0x1D,
+    0x96, 0x9F, 0x2D, 0x96, 0x9E, 0xA2, 0xD9, 0x6A, 0xEA, 0x2D, 0xA9, 0x94, 0xAE, 0xA1, 0x9F, 0xFC,
+    0x0A, 0xEA, 0x19, 0xFF, 0xC9, 0x9F, 0x19, 0xDA, 0xAA, 0xFA, 0x0F, 0xA0, 0x9D, 0x91, 0xE9, 0x1F,
+    0xDA, 0xD9, 0x9A, 0xE2, 0x9F, 0xFF, 0xD3, 0xAF, 0xFF, 0xC9, 0x39, 0xFF, 0xF6, 0x9A, 0xFC, 0xA9,
+    0x72, 0x9D, 0x76, 0xAD, 0x76, 0xAD, 0x77, 0x71, 0x59, 0x99, 0x99, 0x75, 0x9F, 0xEA, 0x74, 0xFF,
+    0xC7, 0x4A, 0x2A, 0xEA, 0x77, 0x0A, 0xDA, 0x77, 0x09, 0xE5, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFA,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFA, 0x1F, 0x59, 0xA7, 0x0A, 0xEA,
+    0x90, 0x9A, 0xF7, 0x0F, 0xFF, 0xA7, 0x9F, 0xFF, 0x71, 0x9A, 0xFD, 0xA9, 0x77, 0x72, 0x76, 0xAD,
+    0x7A, 0xD6, 0xAF, 0xA3, 0xFE, 0x2F, 0xDA, 0xC1, 0x9E, 0xAD, 0x3A, 0xDA, 0x9D, 0x3A, 0xD9, 0x9D,
+    0x3E, 0x99, 0xD3, 0xAD, 0xA9, 0xD3, 0xAE, 0xAD, 0x93, 0xFE, 0xA2, 0x9F, 0xEA, 0x3A, 0xFA, 0x95,
+    0xD9, 0x7A, 0xA3, 0x9F, 0xFF, 0xF1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x5A, 0xFF, 0xFD, 0xA1, 0xAF, 0xFF, 0xDA, 0x1A, 0xFF, 0xFD, 0xA7, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+    0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x60, 0x0F, 0xFD, 0x90,
+    0xFF, 0xD9, 0x09, 0x99, 0xAE, 0x99, 0x95, 0xAD, 0x4F, 0xFD, 0x90, 0xFF, 0xD9, 0x09, 0x9A, 0xFA,
+    0x99, 0x1F, 0xE4, 0xFD, 0x5F, 0xD9, 0x4A, 0xA9, 0xF7, 0x0E, 0x97, 0xF7, 0xF7, 0xF9, 0x6F, 0xA6,
+    0xAA, 0xAA, 0xA1, 0x19, 0xD9, 0x70, 0xAD, 0x97, 0x0A, 0xDA, 0x9D, 0x94, 0xAF, 0xD9, 0x39, 0xFE,
+    0x92, 0xFD, 0xA9, 0x93, 0xFC, 0xAA, 0xD9, 0x2C, 0xAA, 0xFD, 0x93, 0xAF, 0xE9, 0x99, 0x0F, 0xDA,
+    0x1A, 0xD0, 0xFC, 0xA1, 0x9E, 0x0C, 0xA0, 0xDA, 0x0A, 0xE9, 0x3F, 0xE9, 0x4F, 0xCA, 0x6E, 0x97,
+    0x72, 0x5D, 0x97, 0x3D, 0x97, 0x3D, 0x97, 0x19, 0xFC, 0x96, 0xAF, 0xE9, 0x5F, 0xFC, 0x4A, 0xFF,
+    0xC9, 0x3E, 0xAD, 0xAA, 0xDA, 0x3E, 0x0D, 0xA0, 0xE3, 0xE0, 0xDA, 0x0E, 0x3E, 0x0D, 0xA0, 0xE3,
+    0xE0, 0xDA, 0x0E, 0x3E, 0x0D, 0xA0, 0xE3, 0xE0, 0xDA, 0x0E, 0x3E, 0x0E, 0x0D, 0xA3, 0xE0, 0xE0,
+    0xDA, 0x3E, 0x9A, 0xD9, 0xDA, 0x10, 0x59, 0xAA, 0xAA, 0xA9, 0x97, 0x1A, 0xFF, 0x97, 0xAF, 0xFC,
+    0x96, 0xE9, 0x29, 0xE6, 0xE9, 0x3A, 0xD9, 0x5E, 0x93, 0xAD, 0xA5, 0xE9, 0x29, 0xEA, 0x2F, 0xFF,
+    0xD9, 0x2F, 0xFF, 0xD3, 0xFF, 0xFC, 0x93, 0xFF, 0xF7, 0x9F, 0xA9, 0x95, 0x99, 0x99, 0xAF, 0x99,
+    0x99, 0x39, 0xFF, 0xFC, 0x39, 0xFF, 0xFC, 0x70, 0x9F, 0x74, 0xAF, 0x74, 0xAF, 0x70, 0x5A, 0x97,
+    0x3A, 0xD9, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAE, 0x71, 0xAF, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xFC, 0x1F, 0xFF, 0xC2, 0xEA, 0x73, 0xE9, 0x72, 0x9E, 0x97, 0x29, 0xE7, 0x3A, 0xCA, 0x74, 0x97,
+    0x77, 0x6A, 0xC7, 0x4F, 0x72, 0xFD, 0x70, 0xFF, 0x94, 0x9F, 0xFD, 0x92, 0x9E, 0xA9, 0xD9, 0x9E,
+    0xA1, 0xAD, 0x90, 0x9D, 0x90, 0x9D, 0x92, 0xA9, 0x19, 0xD9, 0x29, 0x79, 0xD9, 0x73, 0x9D, 0x97,
+    0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x74, 0xAA, 0x60, 0x6C, 0x73, 0xE7, 0x2A, 0xE7, 0x2A,
+    0xE7, 0x2A, 0xE1, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xA0, 0xFF, 0xFC, 0xAF, 0xFF, 0xC7, 0x09, 0xE9,
+    0x70, 0xE9, 0x70, 0xEA, 0x70, 0xEA, 0x71, 0x9C, 0xA7, 0x39, 0x50, 0x59, 0xD9, 0x73, 0x9D, 0x97,
+    0x39, 0xD9, 0x73, 0x9D, 0x97, 0x39, 0xD9, 0x73, 0x9D, 0x97, 0xCA, 0x19, 0xD9, 0x1A, 0xA2, 0xF0,
+    0x9D, 0x90, 0xAD, 0xA2, 0xFA, 0xDA, 0xF4, 0xAF, 0xFC, 0x6A, 0xFD, 0xA7, 0x09, 0xFA, 0x72, 0x9D,
+    0x97, 0x49, 0x96, 0x4A, 0x4A, 0x70, 0x9D, 0x2A, 0xD6, 0x9D, 0xA3, 0xDA, 0x5D, 0xA4, 0x9D, 0xA3,
+    0xE6, 0x9D, 0x91, 0xFF, 0xFE, 0x90, 0xFF, 0xFE, 0xA0, 0x9D, 0xA6, 0x9D, 0xA2, 0x9D, 0x95, 0xE4,
+    0xAD, 0x93, 0xE6, 0xE2, 0x9D, 0x70, 0xA4, 0xA9, 0x30, 0x77, 0x1A, 0xCA, 0x70, 0xAE, 0xA6, 0xFE,
+    0x4F, 0xFC, 0x2E, 0x0A, 0xCA, 0x9E, 0x1A, 0xC1, 0xAC, 0xA1, 0xC9, 0x5A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x69, 0x1A, 0xCA, 0x19, 0x2D, 0x90, 0xAC, 0xA0, 0xAC, 0xA1, 0xAD, 0xAA, 0xCA, 0xAD,
+    0xA2, 0xAF, 0xEA, 0x49, 0xFC, 0x96, 0x9E, 0x97, 0x1C, 0x50, 0x74, 0xAA, 0xFE, 0xA1, 0xFF, 0xCA,
+    0x1F, 0xCA, 0xAA, 0x92, 0xFC, 0x95, 0xFD, 0x94, 0xD9, 0xAE, 0x92, 0x9D, 0x90, 0xAE, 0x91, 0x9D,
+    0x91, 0xAE, 0x90, 0x9D, 0x3A, 0xE9, 0x9A, 0xA4, 0xAD, 0x97, 0x0A, 0x90, 0x19, 0x73, 0xFF, 0xA9,
+    0x2F, 0xFC, 0xA2, 0x99, 0xAA, 0xAF, 0xA6, 0xAF, 0xC5, 0xAF, 0xD4, 0xAE, 0x9A, 0xD3, 0xAE, 0x90,
+    0xAD, 0x2A, 0xE9, 0x1A, 0xD1, 0xAE, 0x92, 0xAD, 0x1A, 0xD9, 0x39, 0xAA, 0x2A, 0x97, 0x00, 0x1A,
+    0x97, 0x1A, 0xD7, 0x1A, 0xE3, 0xAD, 0x2F, 0x2A, 0xD3, 0xEA, 0x1E, 0x4E, 0xA0, 0xDA, 0x49, 0xE9,
+    0xDA, 0x59, 0xFC, 0x96, 0xAF, 0x92, 0xFF, 0xC2, 0x9F, 0xFC, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0x10,
+    0x70, 0xA7, 0x1E, 0x0E, 0x3F, 0x0E, 0x2A, 0xE1, 0xAD, 0x19, 0xE2, 0x9D, 0x09, 0xE9, 0x29, 0xDA,
+    0xEA, 0x4F, 0xCA, 0x5F, 0xC6, 0xFF, 0xC9, 0x1F, 0xFC, 0xA1, 0x9A, 0xAA, 0xAA, 0xAA, 0xA9, 0x00,
+    0x77, 0x4D, 0x74, 0xAD, 0xA7, 0x29, 0xE7, 0x3E, 0x73, 0xFF, 0xFD, 0x0F, 0xFF, 0xE9, 0xEA, 0x73,
+    0x9F, 0xFF, 0xD1, 0xAF, 0xFF, 0xC2, 0xAE, 0x74, 0xEA, 0x73, 0x9D, 0x75, 0x99, 0x70, 0x70, 0x97,
+    0x59, 0xC9, 0x9C, 0x97, 0x29, 0xD9, 0x9D, 0x97, 0x09, 0xE9, 0x9E, 0x96, 0x9F, 0x99, 0xF9, 0x49,
+    0xFC, 0x99, 0xFC, 0x92, 0x9E, 0xAD, 0x99, 0xD9, 0xEA, 0x1E, 0xA0, 0xD9, 0x9D, 0x09, 0xE9, 0x0D,
+    0xA1, 0xD9, 0x9D, 0x19, 0xD2, 0xA2, 0xD9, 0x9D, 0x29, 0x7D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D,
+    0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x39, 0xA9, 0x0A, 0xA5, 0x77,
+    0x70, 0xAC, 0x97, 0x4E, 0x74, 0xAD, 0xA7, 0x4E, 0x91, 0xAF, 0xFF, 0xC9, 0x0A, 0xFF, 0xFD, 0x97,
+    0x29, 0xEA, 0xAF, 0xFF, 0xD0, 0xAF, 0xFF, 0xC7, 0x2A, 0xE7, 0x3E, 0x97, 0x3D, 0xA7, 0x5A, 0x40,
+    0x5D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D, 0x99, 0xD7, 0x3D,
+    0x99, 0xD7, 0x3D, 0x99, 0xD6, 0x9C, 0x2D, 0x99, 0xD2, 0xA9, 0x09, 0xE1, 0xD9, 0x9D, 0x1A, 0xD1,
+    0xF0, 0xD9, 0x9D, 0x0A, 0xE2, 0xFD, 0x99, 0xDA, 0xE4, 0xFC, 0x99, 0xFC, 0x6F, 0x99, 0xF7, 0x0E,
+    0x99, 0xE7, 0x2D, 0x99, 0xD7, 0x4C, 0x99, 0xC7, 0x77, 0x00, 0x77, 0x7D, 0x4C, 0xA7, 0x0A, 0xDA,
+    0x2A, 0xD9, 0x69, 0xE3, 0x9E, 0x6E, 0x59, 0xE4, 0xFF, 0xFE, 0x2F, 0xFF, 0xFC, 0x09, 0xEA, 0x70,
+    0xAE, 0x19, 0xFF, 0xFE, 0x92, 0xAF, 0xFF, 0xC9, 0x4A, 0xE3, 0x9E, 0xA6, 0xEA, 0x2A, 0xE7, 0x9D,
+    0x39, 0xD7, 0x19, 0x94, 0x99, 0x40, 0x5C, 0xA7, 0x2F, 0x70, 0xFD, 0x59, 0xEA, 0xF9, 0x2A, 0xF0,
+    0xFD, 0x99, 0xFC, 0x0D, 0xAF, 0x0A, 0xCA, 0xD0, 0xD1, 0xD4, 0xD0, 0xD7, 0x0D, 0x0D, 0x70, 0xD0,
+    0xD7, 0x0D, 0x0D, 0x5A, 0xF0, 0xD0, 0x9D, 0x99, 0xFC, 0x0D, 0xAF, 0x0A, 0xF0, 0xFC, 0xA3, 0xFF,
+    0x95, 0xFC, 0xA7, 0x0E, 0xA7, 0x2A, 0xA5, 0x77, 0x3A, 0xD9, 0x70, 0xFA, 0x7A, 0xAE, 0x71, 0xAD,
+    0x71, 0xAD, 0x71, 0x9D, 0x39, 0xAA, 0xA9, 0x0A, 0xD2, 0xFD, 0xAA, 0xD1, 0xFF, 0xE0, 0x9E, 0x91,
+    0xFA, 0x0A, 0xDA, 0x29, 0xEA, 0x0E, 0x93, 0xE9, 0x0E, 0x93, 0xE1, 0xAE, 0x91, 0xAE, 0x19, 0xFF,
+    0xC9, 0x2F, 0xFC, 0x4F, 0xE6, 0x9A, 0xCA, 0x94, 0x77, 0x19, 0x70, 0x9A, 0xEA, 0xA2, 0x9D, 0x6F,
+    0xFC, 0xA9, 0xE9, 0x39, 0xFF, 0xFD, 0x94, 0xFA, 0x3F, 0xC9, 0x4A, 0xE9, 0x4A, 0xF5, 0xF4, 0xAF,
+    0xCA, 0x39, 0xE9, 0x3A, 0xFE, 0x3A, 0xE3, 0xAE, 0x0A, 0xE3, 0xAE, 0x2F, 0x19, 0xE3, 0xAE, 0x1F,
+    0x29, 0xE3, 0xAE, 0x9E, 0xA3, 0xAE, 0x39, 0xFD, 0xA4, 0xF3, 0x9F, 0xD9, 0x19, 0xAF, 0xC4, 0xFF,
+    0xFE, 0xA3, 0x9F, 0xFF, 0xE9, 0x29, 0xFF, 0xFF, 0x29, 0xEA, 0xFF, 0xF3, 0x9D, 0x91, 0x9A, 0xFD,
+    0xA9, 0x59, 0x97, 0x71, 0x77, 0x5F, 0x72, 0x9F, 0xA7, 0x1F, 0xD7, 0x09, 0xFD, 0x97, 0xFA, 0xE6,
+    0x9E, 0x99, 0xE9, 0x5F, 0x1F, 0x49, 0xEA, 0x1A, 0xE9, 0x3F, 0x3F, 0x29, 0xEA, 0x3F, 0x2F, 0x93,
+    0x9E, 0xA0, 0x9F, 0x5F, 0x0A, 0xEA, 0x5A, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x9F, 0xFF, 0xC9, 0xAA, 0xEA, 0xAA, 0xFA, 0x2E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9,
+    0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E,
+    0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3E, 0x2A, 0xD9, 0x3A, 0xAA, 0x2A, 0xAA, 0x91,
+    0x77, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93,
+    0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2,
+    0xAD, 0x93, 0xE2, 0xAD, 0x93, 0xE2, 0xAD, 0x91, 0xFF, 0xFC, 0x9F, 0xFF, 0xC9, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xA0, 0xFF, 0xD9, 0xFF, 0xD9, 0xFA, 0xAA, 0xAA, 0xA1, 0xEA, 0x69, 0xE9, 0x69,
+    0xE9, 0x69, 0xE7, 0xAD, 0xA7, 0xD9, 0x59, 0xDA, 0x5A, 0xE4, 0x9F, 0x5F, 0xFD, 0x9F, 0xFD, 0x9F,
+    0xFD, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0x75, 0xAA, 0xFE, 0x1A, 0xFF, 0xC9, 0x0F, 0xEA, 0xAA,
+    0x90, 0x70, 0x99, 0x99, 0x99, 0x99, 0x71, 0xFF, 0x70, 0x9F, 0xE9, 0x70, 0xAD, 0x97, 0x5E, 0x75,
+    0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9E, 0x97, 0x09,
+    0x2A, 0xE7, 0x09, 0xCA, 0x1F, 0x71, 0xEA, 0xEA, 0x71, 0xAF, 0xD9, 0x72, 0xFD, 0x73, 0xAF, 0xC7,
+    0x4F, 0xA7, 0x10, 0x77, 0x29, 0xAE, 0x91, 0x9E, 0x92, 0xAF, 0xDA, 0xAF, 0xCA, 0x1F, 0xFF, 0xE0,
+    0xAD, 0xA2, 0xAE, 0x91, 0xDA, 0xE4, 0xD3, 0xAF, 0xC4, 0xAC, 0x39, 0xFC, 0x4E, 0x99, 0x9E, 0xAF,
+    0xFF, 0xEA, 0x0F, 0xFF, 0xE1, 0xAF, 0xDA, 0xAF, 0xCA, 0x29, 0xAD, 0xA9, 0x19, 0xE9, 0x10, 0x75,
+    0x97, 0x49, 0xFA, 0x71, 0x9F, 0xD7, 0x1E, 0x90, 0x9A, 0x71, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7,
+    0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x49, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x97,
+    0x4E, 0x75, 0xE7, 0x09, 0xA9, 0x0F, 0x69, 0xFF, 0xA6, 0xAF, 0xF7, 0x0F, 0xEA, 0x71, 0x9F, 0xA7,
+    0x77, 0x00, 0x09, 0xE9, 0x09, 0xE9, 0x0A, 0xEA, 0x0F, 0xA0, 0xFC, 0x77, 0x70, 0x9E, 0x90, 0x9E,
+    0x90, 0xAE, 0xA0, 0xFA, 0x0F, 0xC0, 0x74, 0xAE, 0xA2, 0xCA, 0x99, 0xFD, 0x1D, 0xAA, 0xD9, 0x9D,
+    0xA9, 0xDA, 0xE9, 0x0A, 0xFC, 0x95, 0x9E, 0x97, 0x5A, 0xEA, 0x2C, 0xA9, 0x9F, 0xD1, 0xDA, 0xE9,
+    0x9F, 0xD9, 0xAD, 0x90, 0x9F, 0xC7, 0x99, 0x91, 0x77, 0x72, 0x9D, 0x97, 0x3E, 0x73, 0xAD, 0x74,
+    0xDA, 0x73, 0xE5, 0xAA, 0xAA, 0xAF, 0xE2, 0xFF, 0xFC, 0xA0, 0x9F, 0xFF, 0xAA, 0x7E, 0x73, 0xE9,
+    0x69, 0xFF, 0xF2, 0xFF, 0xFD, 0x09, 0xAA, 0xAF, 0xEA, 0xAA, 0xA3, 0x9E, 0x73, 0xE9, 0x72, 0xAE,
+    0x73, 0xE7, 0x39, 0x99, 0x97, 0x20, 0x77, 0x75, 0x9A, 0xC7, 0x49, 0xF9, 0x71, 0xAF, 0xD7, 0x0A,
+    0xFD, 0x96, 0x9F, 0xE9, 0x69, 0xFE, 0x97, 0x0A, 0xFC, 0x97, 0x2A, 0xFE, 0x97, 0x0A, 0xFF, 0xDA,
+    0x97, 0xAF, 0xFE, 0x70, 0x9A, 0xFE, 0x73, 0x9A, 0xF3, 0x9A, 0x99, 0x7A, 0xC3, 0xAF, 0xEA, 0xA9,
+    0x95, 0xFF, 0xFD, 0xA4, 0x99, 0x9A, 0xAF, 0xF7, 0x69, 0x9A, 0x00, 0x77, 0x4C, 0x97, 0x7E, 0xA7,
+    0x5F, 0xCA, 0x73, 0x9A, 0xFD, 0x97, 0x3A, 0xFD, 0xA7, 0x3A, 0xFD, 0xA7, 0x3A, 0xFD, 0x71, 0x9A,
+    0xFC, 0xA5, 0x9A, 0xFF, 0xD2, 0x9F, 0xFE, 0x94, 0xAF, 0xEA, 0x97, 0xAF, 0x97, 0x3A, 0xA9, 0x79,
+    0x99, 0x59, 0x9A, 0xAF, 0xF2, 0x9F, 0xFF, 0xD9, 0x1A, 0xFE, 0xAA, 0xA9, 0x94, 0xA9, 0x97, 0x50,
 };
 
 static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 7, 27, 8, 0, 24, 48, 0 }, // !
-    { 13, 8, 15, -2, 19, 26, 48 }, // "
-    { 23, 20, 23, -1, 17, 115, 74 }, // #
-    { 18, 25, 24, 3, 21, 113, 189 }, // $
-    { 18, 19, 23, 3, 17, 86, 302 }, // %
-    { 16, 17, 19, 2, 17, 68, 388 }, // &
-    { 6, 8, 8, 1, 17, 12, 456 }, // '
-    { 9, 29, 11, 1, 22, 66, 468 }, // (
-    { 9, 29, 9, -1, 22, 66, 534 }, // )
-    { 13, 12, 14, 0, 17, 39, 600 }, // *
-    { 11, 12, 13, 1, 12, 33, 639 }, // +
-    { 7, 8, 8, 0, 4, 14, 672 }, // ,
-    { 11, 3, 12, 0, 8, 9, 686 }, // -
-    { 5, 5, 6, 0, 5, 7, 695 }, // .
-    { 14, 36, 15, 0, 25, 126, 702 }, // /
-    { 13, 17, 15, 1, 16, 56, 828 }, // 0
-    { 11, 16, 13, 1, 16, 44, 884 }, // 1
-    { 13, 16, 15, 1, 16, 52, 928 }, // 2
-    { 13, 17, 15, 1, 17, 56, 980 }, // 3
-    { 13, 17, 15, 1, 16, 56, 1036 }, // 4
-    { 12, 17, 15, 1, 16, 51, 1092 }, // 5
-    { 13, 16, 15, 1, 16, 52, 1143 }, // 6
-    { 12, 16, 15, 1, 16, 48, 1195 }, // 7
-    { 13, 17, 16, 1, 16, 56, 1243 }, // 8
-    { 13, 18, 15, 1, 17, 59, 1299 }, // 9
-    { 6, 14, 7, 0, 14, 21, 1358 }, // :
-    { 7, 17, 8, 0, 13, 30, 1379 }, // ;
-    { 17, 14, 17, -1, 14, 60, 1409 }, // <
-    { 12, 8, 13, 0, 10, 24, 1469 }, // =
-    { 16, 14, 18, 1, 14, 56, 1493 }, // >
-    { 14, 27, 15, 0, 24, 95, 1549 }, // ?
-    { 20, 19, 21, 0, 18, 95, 1644 }, // @
-    { 18, 18, 20, 1, 18, 81, 1739 }, // A
-    { 14, 18, 20, 3, 18, 63, 1820 }, // B
-    { 16, 19, 21, 2, 19, 76, 1883 }, // C
-    { 16, 18, 22, 3, 18, 72, 1959 }, // D
-    { 13, 18, 19, 3, 18, 59, 2031 }, // E
-    { 12, 18, 18, 3, 18, 54, 2090 }, // F
-    { 18, 19, 24, 3, 19, 86, 2144 }, // G
-    { 16, 18, 22, 3, 18, 72, 2230 }, // H
-    { 5, 18, 11, 3, 18, 23, 2302 }, // I
-    { 13, 23, 19, 3, 18, 75, 2325 }, // J
-    { 16, 18, 22, 3, 18, 72, 2400 }, // K
-    { 13, 18, 19, 3, 18, 59, 2472 }, // L
-    { 18, 18, 24, 3, 18, 81, 2531 }, // M
-    { 16, 18, 22, 3, 18, 72, 2612 }, // N
-    { 18, 19, 24, 3, 18, 86, 2684 }, // O
-    { 13, 18, 19, 3, 18, 59, 2770 }, // P
-    { 19, 22, 22, 2, 19, 105, 2829 }, // Q
-    { 14, 18, 20, 3, 18, 63, 2934 }, // R
-    { 16, 19, 22, 3, 18, 76, 2997 }, // S
-    { 16, 18, 22, 3, 18, 72, 3073 }, // T
-    { 16, 19, 22, 3, 18, 76, 3145 }, // U
-    { 18, 18, 24, 3, 18, 81, 3221 }, // V
-    { 24, 18, 30, 3, 18, 108, 3302 }, // W
-    { 17, 18, 23, 3, 18, 77, 3410 }, // X
-    { 17, 18, 22, 3, 18, 77, 3487 }, // Y
-    { 17, 18, 23, 3, 18, 77, 3564 }, // Z
-    { 8, 31, 10, 1, 23, 62, 3641 }, // [
-    { 8, 24, 10, 1, 18, 48, 3703 }, // <backslash>
-    { 8, 31, 10, 1, 23, 62, 3751 }, // ]
-    { 12, 6, 13, 0, 21, 18, 3813 }, // ^
-    { 16, 5, 16, -1, -1, 20, 3831 }, // _
-    { 9, 4, 10, 0, 16, 9, 3851 }, // `
-    { 12, 13, 18, 3, 13, 39, 3860 }, // a
-    { 13, 19, 18, 3, 18, 62, 3899 }, // b
-    { 11, 13, 16, 3, 13, 36, 3961 }, // c
-    { 13, 18, 18, 3, 18, 59, 3997 }, // d
-    { 12, 12, 18, 3, 12, 36, 4056 }, // e
-    { 9, 17, 14, 3, 17, 39, 4092 }, // f
-    { 12, 19, 18, 3, 12, 57, 4131 }, // g
-    { 13, 18, 18, 3, 18, 59, 4188 }, // h
-    { 6, 19, 10, 2, 19, 29, 4247 }, // i
-    { 8, 25, 13, 3, 19, 50, 4276 }, // j
-    { 13, 18, 19, 3, 18, 59, 4326 }, // k
-    { 7, 18, 12, 3, 18, 32, 4385 }, // l
-    { 20, 13, 26, 3, 13, 65, 4417 }, // m
-    { 12, 13, 18, 3, 13, 39, 4482 }, // n
-    { 12, 12, 18, 3, 12, 36, 4521 }, // o
-    { 14, 19, 20, 3, 13, 67, 4557 }, // p
-    { 15, 19, 20, 3, 13, 72, 4624 }, // q
-    { 9, 12, 15, 3, 12, 27, 4696 }, // r
-    { 12, 14, 18, 3, 13, 42, 4723 }, // s
-    { 11, 18, 16, 3, 17, 50, 4765 }, // t
-    { 12, 12, 18, 3, 12, 36, 4815 }, // u
-    { 15, 12, 21, 3, 12, 45, 4851 }, // v
-    { 17, 13, 23, 3, 12, 56, 4896 }, // w
-    { 15, 12, 20, 3, 12, 45, 4952 }, // x
-    { 14, 18, 19, 3, 12, 63, 4997 }, // y
-    { 13, 12, 18, 3, 12, 39, 5060 }, // z
-    { 11, 21, 12, 0, 16, 58, 5099 }, // {
-    { 4, 19, 8, 2, 15, 19, 5157 }, // |
-    { 11, 21, 12, 0, 16, 58, 5176 }, // }
-    { 8, 5, 10, 1, 16, 10, 5234 }, // ~
-    { 0, 0, 18, 0, 0, 0, 5244 }, //  
-    { 7, 27, 16, 4, 23, 48, 5244 }, // ¡
-    { 11, 20, 16, 3, 16, 55, 5292 }, // ¢
-    { 14, 19, 15, 0, 18, 67, 5347 }, // £
-    { 14, 13, 15, 0, 14, 46, 5414 }, // ¤
-    { 16, 19, 17, 0, 16, 76, 5460 }, // ¥
-    { 3, 19, 8, 2, 15, 15, 5536 }, // ¦
-    { 12, 19, 16, 2, 17, 57, 5551 }, // §
-    { 11, 5, 12, 0, 17, 14, 5608 }, // ¨
-    { 10, 9, 14, 2, 20, 23, 5622 }, // ©
-    { 7, 7, 14, 4, 16, 13, 5645 }, // ª
-    { 12, 12, 13, 0, 12, 36, 5658 }, // «
-    { 11, 8, 13, 1, 8, 22, 5694 }, // ¬
-    { 11, 3, 13, 1, 8, 9, 5716 }, // ­
-    { 10, 9, 14, 2, 23, 23, 5725 }, // ®
-    { 10, 4, 11, 0, 16, 10, 5748 }, // ¯
-    { 10, 10, 14, 2, 16, 25, 5758 }, // °
-    { 12, 14, 13, 0, 12, 42, 5783 }, // ±
-    { 6, 8, 7, 0, 17, 12, 5825 }, // ²
-    { 7, 8, 8, 0, 17, 14, 5837 }, // ³
-    { 6, 5, 7, 0, 16, 8, 5851 }, // ´
-    { 13, 15, 18, 2, 12, 49, 5859 }, // µ
-    { 12, 18, 16, 2, 15, 54, 5908 }, // ¶
-    { 5, 5, 6, 0, 10, 7, 5962 }, // ·
-    { 6, 7, 7, 0, 1, 11, 5969 }, // ¸
-    { 6, 8, 7, 0, 17, 12, 5980 }, // ¹
-    { 7, 7, 14, 4, 15, 13, 5992 }, // º
-    { 12, 12, 16, 2, 12, 36, 6005 }, // »
-    { 19, 20, 26, 3, 18, 95, 6041 }, // ¼
-    { 21, 20, 26, 3, 18, 105, 6136 }, // ½
-    { 19, 19, 26, 3, 17, 91, 6241 }, // ¾
-    { 13, 26, 14, 0, 15, 85, 6332 }, // ¿
-    { 18, 24, 20, 1, 24, 108, 6417 }, // À
-    { 18, 28, 20, 1, 28, 126, 6525 }, // Á
-    { 18, 26, 20, 1, 26, 117, 6651 }, // Â
-    { 18, 25, 20, 1, 25, 113, 6768 }, // Ã
-    { 18, 25, 20, 1, 25, 113, 6881 }, // Ä
-    { 18, 25, 20, 1, 25, 113, 6994 }, // Å
-    { 26, 19, 28, 1, 18, 124, 7107 }, // Æ
-    { 16, 25, 21, 2, 19, 100, 7231 }, // Ç
-    { 13, 25, 19, 3, 25, 82, 7331 }, // È
-    { 13, 28, 19, 3, 28, 91, 7413 }, // É
-    { 13, 26, 19, 3, 26, 85, 7504 }, // Ê
-    { 13, 26, 19, 3, 26, 85, 7589 }, // Ë
-    { 9, 26, 11, 0, 26, 59, 7674 }, // Ì
-    { 5, 29, 11, 3, 29, 37, 7733 }, // Í
-    { 12, 27, 13, 0, 27, 81, 7770 }, // Î
-    { 11, 27, 12, 0, 27, 75, 7851 }, // Ï
-    { 20, 18, 22, -1, 18, 90, 7926 }, // Ð
-    { 16, 25, 22, 3, 25, 100, 8016 }, // Ñ
-    { 18, 25, 24, 3, 24, 113, 8116 }, // Ò
-    { 18, 28, 24, 3, 27, 126, 8229 }, // Ó
-    { 18, 27, 24, 3, 26, 122, 8355 }, // Ô
-    { 18, 26, 24, 3, 25, 117, 8477 }, // Õ
-    { 18, 26, 24, 3, 25, 117, 8594 }, // Ö
-    { 13, 7, 14, 0, 9, 23, 8711 }, // ×
-    { 30, 41, 28, -3, 30, 308, 8734 }, // Ø
-    { 16, 26, 22, 3, 25, 104, 9042 }, // Ù
-    { 16, 30, 22, 3, 29, 120, 9146 }, // Ú
-    { 16, 28, 22, 3, 27, 112, 9266 }, // Û
-    { 16, 28, 22, 3, 27, 112, 9378 }, // Ü
-    { 17, 30, 22, 3, 30, 128, 9490 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 9618 }, // Þ
-    { 13, 17, 15, 1, 16, 56, 9661 }, // ß
-    { 12, 19, 18, 3, 19, 57, 9717 }, // à
-    { 12, 22, 18, 3, 22, 66, 9774 }, // á
-    { 12, 20, 18, 3, 20, 60, 9840 }, // â
-    { 12, 19, 18, 3, 19, 57, 9900 }, // ã
-    { 12, 20, 18, 3, 20, 60, 9957 }, // ä
-    { 12, 20, 18, 3, 20, 60, 10017 }, // å
-    { 20, 13, 26, 3, 13, 65, 10077 }, // æ
-    { 11, 18, 16, 3, 13, 50, 10142 }, // ç
-    { 12, 21, 18, 3, 21, 63, 10192 }, // è
-    { 12, 24, 18, 3, 24, 72, 10255 }, // é
-    { 12, 22, 18, 3, 22, 66, 10327 }, // ê
-    { 12, 22, 18, 3, 22, 66, 10393 }, // ë
-    { 9, 18, 10, 0, 18, 41, 10459 }, // ì
-    { 5, 21, 10, 3, 21, 27, 10500 }, // í
-    { 12, 19, 12, -1, 19, 57, 10527 }, // î
-    { 10, 18, 11, 0, 18, 45, 10584 }, // ï
-    { 17, 19, 17, -1, 18, 81, 10629 }, // ð
-    { 12, 20, 18, 3, 20, 60, 10710 }, // ñ
-    { 12, 18, 18, 3, 18, 54, 10770 }, // ò
-    { 12, 22, 18, 3, 22, 66, 10824 }, // ó
-    { 12, 20, 18, 3, 20, 60, 10890 }, // ô
-    { 12, 19, 18, 3, 19, 57, 10950 }, // õ
-    { 12, 19, 18, 3, 19, 57, 11007 }, // ö
-    { 16, 15, 19, 1, 15, 60, 11064 }, // ÷
-    { 14, 35, 18, 2, 24, 123, 11124 }, // ø
-    { 12, 18, 18, 3, 18, 54, 11247 }, // ù
-    { 12, 22, 18, 3, 22, 66, 11301 }, // ú
-    { 12, 20, 18, 3, 20, 60, 11367 }, // û
-    { 12, 20, 18, 3, 20, 60, 11427 }, // ü
-    { 14, 31, 19, 3, 25, 109, 11487 }, // ý
-    { 10, 22, 12, 1, 17, 55, 11596 }, // þ
-    { 14, 28, 19, 3, 22, 98, 11651 }, // ÿ
-    { 18, 25, 20, 1, 25, 113, 11749 }, // Ā
-    { 12, 20, 18, 3, 20, 60, 11862 }, // ā
-    { 18, 26, 20, 1, 26, 117, 11922 }, // Ă
-    { 12, 20, 18, 3, 20, 60, 12039 }, // ă
-    { 18, 24, 20, 1, 18, 108, 12099 }, // Ą
-    { 13, 19, 18, 3, 13, 62, 12207 }, // ą
-    { 16, 25, 21, 2, 25, 100, 12269 }, // Ć
-    { 11, 18, 16, 3, 18, 50, 12369 }, // ć
-    { 16, 27, 21, 2, 27, 108, 12419 }, // Ĉ
-    { 12, 19, 16, 2, 19, 57, 12527 }, // ĉ
-    { 16, 25, 21, 2, 25, 100, 12584 }, // Ċ
-    { 11, 18, 16, 3, 18, 50, 12684 }, // ċ
-    { 16, 27, 21, 2, 27, 108, 12734 }, // Č
-    { 12, 20, 16, 3, 20, 60, 12842 }, // č
-    { 16, 27, 22, 3, 27, 108, 12902 }, // Ď
-    { 17, 18, 21, 3, 18, 77, 13010 }, // ď
-    { 20, 18, 22, -1, 18, 90, 13087 }, // Đ
-    { 16, 18, 20, 3, 18, 72, 13177 }, // đ
-    { 13, 26, 19, 3, 26, 85, 13249 }, // Ē
-    { 12, 22, 18, 3, 22, 66, 13334 }, // ē
-    { 13, 26, 19, 3, 26, 85, 13400 }, // Ĕ
-    { 12, 22, 18, 3, 22, 66, 13485 }, // ĕ
-    { 13, 26, 19, 3, 26, 85, 13551 }, // Ė
-    { 12, 22, 18, 3, 22, 66, 13636 }, // ė
-    { 13, 23, 19, 3, 18, 75, 13702 }, // Ę
-    { 12, 20, 18, 3, 12, 60, 13777 }, // ę
-    { 13, 28, 19, 3, 28, 91, 13837 }, // Ě
-    { 12, 24, 18, 3, 24, 72, 13928 }, // ě
-    { 18, 29, 24, 3, 29, 131, 14000 }, // Ĝ
-    { 13, 28, 18, 3, 21, 91, 14131 }, // ĝ
-    { 18, 28, 24, 3, 28, 126, 14222 }, // Ğ
-    { 12, 27, 18, 3, 20, 81, 14348 }, // ğ
-    { 18, 28, 24, 3, 28, 126, 14429 }, // Ġ
-    { 12, 27, 18, 3, 20, 81, 14555 }, // ġ
-    { 18, 31, 24, 3, 31, 140, 14636 }, // Ģ
-    { 12, 28, 18, 3, 21, 84, 14776 }, // ģ
-    { 16, 26, 22, 3, 26, 104, 14860 }, // Ĥ
-    { 16, 26, 18, 0, 26, 104, 14964 }, // ĥ
-    { 18, 18, 22, 2, 18, 81, 15068 }, // Ħ
-    { 16, 18, 18, 0, 18, 72, 15149 }, // ħ
-    { 9, 27, 11, 1, 27, 61, 15221 }, // Ĩ
-    { 8, 20, 10, 1, 20, 40, 15282 }, // ĩ
-    { 12, 27, 12, -1, 27, 81, 15322 }, // Ī
-    { 12, 19, 12, -1, 19, 57, 15403 }, // ī
-    { 6, 23, 11, 2, 18, 35, 15460 }, // Į
-    { 6, 25, 10, 2, 19, 38, 15495 }, // į
-    { 5, 27, 11, 3, 27, 34, 15533 }, // İ
-    { 4, 12, 10, 3, 12, 12, 15567 }, // ı
-    { 17, 26, 33, 7, 18, 111, 15579 }, // Ĳ
-    { 13, 24, 16, 2, 19, 78, 15690 }, // ĳ
-    { 14, 31, 19, 3, 26, 109, 15768 }, // Ĵ
-    { 12, 27, 15, 2, 21, 81, 15877 }, // ĵ
-    { 16, 29, 22, 3, 29, 116, 15958 }, // Ķ
-    { 13, 29, 19, 3, 18, 95, 16074 }, // ķ
-    { 10, 12, 14, 2, 12, 30, 16169 }, // ĸ
-    { 13, 24, 19, 3, 24, 78, 16199 }, // Ĺ
-    { 7, 27, 12, 3, 27, 48, 16277 }, // ĺ
-    { 15, 28, 19, 1, 28, 105, 16325 }, // Ļ
-    { 9, 29, 12, 1, 18, 66, 16430 }, // ļ
-    { 13, 18, 19, 3, 18, 59, 16496 }, // Ľ
-    { 10, 21, 14, 3, 21, 53, 16555 }, // ľ
-    { 13, 18, 19, 3, 18, 59, 16608 }, // Ŀ
-    { 10, 18, 14, 3, 18, 45, 16667 }, // ŀ
-    { 23, 32, 19, -6, 25, 184, 16712 }, // Ł
-    { 15, 18, 12, -4, 18, 68, 16896 }, // ł
-    { 16, 25, 22, 3, 25, 100, 16964 }, // Ń
-    { 12, 20, 18, 3, 20, 60, 17064 }, // ń
-    { 16, 27, 22, 3, 18, 108, 17124 }, // Ņ
-    { 12, 21, 18, 3, 13, 63, 17232 }, // ņ
-    { 16, 27, 22, 3, 27, 108, 17295 }, // Ň
-    { 13, 22, 18, 3, 22, 72, 17403 }, // ň
-    { 12, 21, 18, 3, 21, 63, 17475 }, // ŉ
-    { 16, 23, 22, 3, 18, 92, 17538 }, // Ŋ
-    { 12, 18, 18, 3, 13, 54, 17630 }, // ŋ
-    { 18, 26, 24, 3, 25, 117, 17684 }, // Ō
-    { 12, 19, 18, 3, 19, 57, 17801 }, // ō
-    { 18, 27, 24, 3, 26, 122, 17858 }, // Ŏ
-    { 12, 20, 18, 3, 20, 60, 17980 }, // ŏ
-    { 19, 25, 24, 3, 24, 119, 18040 }, // Ő
-    { 18, 18, 20, 1, 18, 81, 18159 }, // ő
-    { 25, 20, 29, 3, 19, 125, 18240 }, // Œ
-    { 21, 12, 25, 3, 12, 63, 18365 }, // œ
-    { 14, 25, 20, 3, 25, 88, 18428 }, // Ŕ
-    { 9, 18, 15, 3, 18, 41, 18516 }, // ŕ
-    { 14, 29, 20, 3, 29, 102, 18557 }, // Ŗ
-    { 10, 22, 15, 2, 22, 55, 18659 }, // ŗ
-    { 14, 26, 20, 3, 26, 91, 18714 }, // Ř
-    { 12, 19, 15, 1, 19, 57, 18805 }, // ř
-    { 16, 26, 22, 3, 25, 104, 18862 }, // Ś
-    { 12, 19, 18, 3, 18, 57, 18966 }, // ś
-    { 16, 27, 22, 3, 26, 108, 19023 }, // Ŝ
-    { 12, 20, 18, 3, 19, 60, 19131 }, // ŝ
-    { 16, 23, 22, 3, 18, 92, 19191 }, // Ş
-    { 12, 19, 18, 3, 13, 57, 19283 }, // ş
-    { 16, 27, 22, 3, 26, 108, 19340 }, // Š
-    { 12, 21, 18, 3, 20, 63, 19448 }, // š
-    { 16, 24, 22, 3, 18, 96, 19511 }, // Ţ
-    { 11, 22, 16, 3, 17, 61, 19607 }, // ţ
-    { 16, 26, 22, 3, 26, 104, 19668 }, // Ť
-    { 14, 21, 18, 3, 20, 74, 19772 }, // ť
-    { 16, 18, 22, 3, 18, 72, 19846 }, // Ŧ
-    { 12, 18, 16, 2, 17, 54, 19918 }, // ŧ
-    { 16, 28, 22, 3, 27, 112, 19972 }, // Ũ
-    { 12, 20, 18, 3, 20, 60, 20084 }, // ũ
-    { 16, 28, 22, 3, 27, 112, 20144 }, // Ū
-    { 12, 19, 18, 3, 19, 57, 20256 }, // ū
-    { 16, 28, 22, 3, 27, 112, 20313 }, // Ŭ
-    { 12, 20, 18, 3, 20, 60, 20425 }, // ŭ
-    { 16, 29, 22, 3, 28, 116, 20485 }, // Ů
-    { 12, 21, 18, 3, 21, 63, 20601 }, // ů
-    { 18, 27, 22, 3, 26, 122, 20664 }, // Ű
-    { 18, 19, 20, 1, 19, 86, 20786 }, // ű
-    { 16, 23, 22, 3, 18, 92, 20872 }, // Ų
-    { 12, 18, 18, 3, 12, 54, 20964 }, // ų
-    { 24, 26, 30, 3, 26, 156, 21018 }, // Ŵ
-    { 17, 22, 23, 3, 21, 94, 21174 }, // ŵ
-    { 17, 28, 22, 3, 28, 119, 21268 }, // Ŷ
-    { 14, 29, 19, 3, 23, 102, 21387 }, // ŷ
-    { 17, 28, 22, 3, 28, 119, 21489 }, // Ÿ
-    { 17, 24, 23, 3, 24, 102, 21608 }, // Ź
-    { 13, 20, 18, 3, 20, 65, 21710 }, // ź
-    { 17, 24, 23, 3, 24, 102, 21775 }, // Ż
-    { 13, 20, 18, 3, 20, 65, 21877 }, // ż
-    { 17, 26, 23, 3, 26, 111, 21942 }, // Ž
-    { 13, 21, 18, 3, 21, 69, 22053 }, // ž
-    { 8, 17, 13, 2, 17, 34, 22122 }, // ſ
-    { 19, 21, 24, 3, 20, 100, 22156 }, // Ơ
-    { 14, 14, 18, 3, 14, 49, 22256 }, // ơ
-    { 17, 18, 19, -1, 18, 77, 22305 }, // Ƥ
-    { 14, 23, 20, 3, 16, 81, 22382 }, // ƥ
-    { 11, 16, 13, 1, 15, 44, 22463 }, // Ʃ
-    { 18, 18, 22, 1, 18, 81, 22507 }, // Ƭ
-    { 11, 21, 16, 3, 20, 58, 22588 }, // ƭ
-    { 16, 21, 22, 3, 18, 84, 22646 }, // Ʈ
-    { 18, 23, 22, 3, 22, 104, 22730 }, // Ư
-    { 14, 16, 18, 3, 16, 56, 22834 }, // ư
-    { 9, 4, 10, 0, 16, 9, 22890 }, // ̀
-    { 6, 5, 7, 0, 16, 8, 22899 }, // ́
-    { 12, 6, 13, 0, 1, 18, 22907 }, // ̂
-    { 8, 5, 10, 1, 16, 10, 22925 }, // ̃
-    { 12, 4, 13, 0, 15, 12, 22935 }, // ̄
-    { 15, 4, 16, 0, 19, 15, 22947 }, // ̅
-    { 11, 6, 12, 0, 16, 17, 22962 }, // ̆
-    { 5, 5, 9, 3, 17, 7, 22979 }, // ̇
-    { 10, 4, 11, 0, 15, 10, 22986 }, // ̈
-    { 5, 5, 10, 4, 14, 7, 22996 }, // ̉
-    { 5, 5, 7, 1, 16, 7, 23003 }, // ̊
-    { 19, 4, 20, 0, 16, 19, 23010 }, // ̋
-    { 12, 6, 13, 0, 17, 18, 23029 }, // ̌
-    { 18, 4, 14, -5, 16, 18, 23047 }, // ̏
-    { 7, 8, 8, 0, 17, 14, 23065 }, // ̒
-    { 8, 8, 9, 0, 16, 16, 23079 }, // ̓
-    { 8, 8, 8, -1, 16, 16, 23095 }, // ̔
-    { 5, 6, 7, 1, 0, 8, 23111 }, // ̘
-    { 5, 6, 7, 1, 0, 8, 23119 }, // ̙
-    { 10, 6, 12, 1, 17, 15, 23127 }, // ̚
-    { 5, 6, 6, 0, 14, 8, 23142 }, // ̛
-    { 4, 7, 6, 1, 0, 7, 23150 }, // ̜
-    { 6, 5, 8, 1, 3, 8, 23157 }, // ̝
-    { 6, 5, 8, 1, 0, 8, 23165 }, // ̞
-    { 5, 5, 7, 1, -2, 7, 23173 }, // ̟
-    { 12, 4, 13, 0, -2, 12, 23180 }, // ̠
-    { 6, 5, 7, 0, 2, 8, 23192 }, // ̣
-    { 10, 4, 11, 0, -1, 10, 23200 }, // ̤
-    { 5, 5, 7, 1, 16, 7, 23210 }, // ̥
-    { 7, 8, 8, 0, 4, 14, 23217 }, // ̦
-    { 6, 7, 7, 0, 1, 11, 23231 }, // ̧
-    { 6, 8, 8, 1, 2, 12, 23242 }, // ̨
-    { 5, 7, 6, 0, -1, 9, 23254 }, // ̩
-    { 9, 5, 10, 0, 0, 12, 23263 }, // ̪
-    { 13, 6, 13, -1, 1, 20, 23275 }, // ̬
-    { 13, 6, 13, -1, 1, 20, 23295 }, // ̭
-    { 9, 6, 11, 1, 18, 14, 23315 }, // ̰
-    { 10, 4, 12, 1, 18, 10, 23329 }, // ̱
-    { 11, 4, 12, 0, -1, 11, 23339 }, // ̲
-    { 9, 6, 11, 1, 18, 14, 23350 }, // ̴
-    { 11, 3, 12, 0, 8, 9, 23364 }, // ̵
-    { 5, 8, 6, 0, 1, 10, 23373 }, // ̹
-    { 10, 7, 11, 0, 1, 18, 23383 }, // ̺
-    { 9, 7, 10, 0, 1, 16, 23401 }, // ̻
-    { 9, 6, 10, 0, 1, 14, 23417 }, // ̼
-    { 7, 5, 9, 1, 16, 9, 23431 }, // ̽
-    { 8, 5, 10, 1, 16, 10, 23440 }, // ͂
-    { 4, 6, 10, 5, 19, 6, 23450 }, // ̓
-    { 10, 15, 12, 1, 26, 38, 23456 }, // ̈́
-    { 9, 5, 10, 0, 17, 12, 23494 }, // ͆
-    { 12, 8, 13, 0, 0, 24, 23506 }, // ͇
-    { 9, 7, 11, 1, 1, 16, 23530 }, // ͈
-    { 7, 6, 9, 1, -1, 11, 23546 }, // ͉
-    { 11, 16, 13, 1, 22, 44, 23557 }, // ͊
-    { 19, 16, 21, 1, 24, 76, 23601 }, // ͋
-    { 12, 12, 22, 9, 12, 36, 23677 }, // ͌
-    { 11, 6, 13, 1, -2, 17, 23713 }, // ͍
-    { 5, 4, 6, 0, 3, 5, 23730 }, // ͎
-    { 19, 6, 20, 0, 2, 29, 23735 }, // ͜
-    { 19, 6, 20, 0, 17, 29, 23764 }, // ͡
-    { 22, 7, 24, 1, 0, 39, 23793 }, // ͢
-    { 18, 18, 20, 1, 18, 81, 23832 }, // Α
-    { 14, 18, 20, 3, 18, 63, 23913 }, // Β
-    { 10, 19, 12, 1, 17, 48, 23976 }, // Γ
-    { 16, 17, 18, 1, 16, 68, 24024 }, // Δ
-    { 13, 18, 19, 3, 18, 59, 24092 }, // Ε
-    { 17, 18, 23, 3, 18, 77, 24151 }, // Ζ
-    { 16, 18, 22, 3, 18, 72, 24228 }, // Η
-    { 18, 19, 24, 3, 18, 86, 24300 }, // Θ
-    { 5, 18, 11, 3, 18, 23, 24386 }, // Ι
-    { 16, 18, 22, 3, 18, 72, 24409 }, // Κ
-    { 18, 18, 24, 3, 18, 81, 24481 }, // Λ
-    { 18, 18, 24, 3, 18, 81, 24562 }, // Μ
-    { 16, 18, 22, 3, 18, 72, 24643 }, // Ν
-    { 14, 16, 16, 1, 15, 56, 24715 }, // Ξ
-    { 18, 19, 24, 3, 18, 86, 24771 }, // Ο
-    { 11, 16, 13, 1, 15, 44, 24857 }, // Π
-    { 13, 18, 19, 3, 18, 59, 24901 }, // Ρ
-    { 11, 16, 13, 1, 15, 44, 24960 }, // Σ
-    { 16, 18, 22, 3, 18, 72, 25004 }, // Τ
-    { 17, 18, 22, 3, 18, 77, 25076 }, // Υ
-    { 21, 23, 29, 4, 19, 121, 25153 }, // Φ
-    { 17, 18, 23, 3, 18, 77, 25274 }, // Χ
-    { 15, 20, 17, 1, 18, 75, 25351 }, // Ψ
-    { 16, 17, 18, 1, 16, 68, 25426 }, // Ω
-    { 15, 15, 20, 3, 13, 57, 25494 }, // α
-    { 13, 25, 15, 1, 20, 82, 25551 }, // β
-    { 14, 19, 15, 0, 12, 67, 25633 }, // γ
-    { 13, 19, 15, 1, 18, 62, 25700 }, // δ
-    { 10, 12, 12, 1, 11, 30, 25762 }, // ε
-    { 12, 20, 13, 0, 16, 60, 25792 }, // ζ
-    { 14, 19, 16, 1, 13, 67, 25852 }, // η
-    { 12, 17, 14, 1, 16, 51, 25919 }, // θ
-    { 7, 15, 13, 3, 15, 27, 25970 }, // ι
-    { 11, 12, 15, 2, 12, 33, 25997 }, // κ
-    { 14, 18, 18, 2, 18, 63, 26030 }, // λ
-    { 13, 15, 18, 2, 12, 49, 26093 }, // μ
-    { 14, 13, 15, 0, 12, 46, 26142 }, // ν
-    { 10, 20, 12, 1, 16, 50, 26188 }, // ξ
-    { 12, 12, 18, 3, 12, 36, 26238 }, // ο
-    { 13, 12, 15, 1, 11, 39, 26274 }, // π
-    { 15, 18, 16, 0, 13, 68, 26313 }, // ρ
-    { 11, 16, 12, 0, 16, 44, 26381 }, // ς
-    { 14, 12, 20, 3, 12, 42, 26425 }, // σ
-    { 12, 12, 14, 1, 11, 36, 26467 }, // τ
-    { 11, 13, 13, 1, 12, 36, 26503 }, // υ
-    { 18, 27, 24, 3, 22, 122, 26539 }, // φ
-    { 17, 19, 18, 0, 13, 81, 26661 }, // χ
-    { 12, 23, 14, 1, 16, 69, 26742 }, // ψ
-    { 17, 13, 18, 0, 12, 56, 26811 }, // ω
-    { 18, 24, 20, 1, 18, 108, 26867 }, // Ạ
-    { 12, 21, 18, 3, 13, 63, 26975 }, // ạ
-    { 18, 26, 20, 1, 26, 117, 27038 }, // Ả
-    { 12, 20, 18, 3, 20, 60, 27155 }, // ả
-    { 18, 32, 20, 1, 32, 144, 27215 }, // Ấ
-    { 13, 23, 18, 3, 23, 75, 27359 }, // ấ
-    { 20, 27, 20, -1, 27, 135, 27434 }, // Ầ
-    { 18, 24, 18, -3, 24, 108, 27569 }, // ầ
-    { 18, 32, 20, 1, 32, 144, 27677 }, // Ẩ
-    { 14, 24, 18, 3, 24, 84, 27821 }, // ẩ
-    { 18, 30, 20, 1, 30, 135, 27905 }, // Ẫ
-    { 12, 25, 18, 3, 25, 75, 28040 }, // ẫ
-    { 18, 32, 20, 1, 26, 144, 28115 }, // Ậ
-    { 12, 28, 18, 3, 20, 84, 28259 }, // ậ
-    { 18, 32, 20, 1, 32, 144, 28343 }, // Ắ
-    { 12, 27, 18, 3, 27, 81, 28487 }, // ắ
-    { 18, 32, 20, 1, 32, 144, 28568 }, // Ằ
-    { 12, 27, 18, 3, 27, 81, 28712 }, // ằ
-    { 18, 33, 20, 1, 33, 149, 28793 }, // Ẳ
-    { 12, 29, 18, 3, 29, 87, 28942 }, // ẳ
-    { 18, 33, 20, 1, 33, 149, 29029 }, // Ẵ
-    { 12, 28, 18, 3, 28, 84, 29178 }, // ẵ
-    { 18, 32, 20, 1, 26, 144, 29262 }, // Ặ
-    { 12, 28, 18, 3, 20, 84, 29406 }, // ặ
-    { 13, 26, 19, 3, 18, 85, 29490 }, // Ẹ
-    { 12, 21, 18, 3, 12, 63, 29575 }, // ẹ
-    { 13, 26, 19, 3, 26, 85, 29638 }, // Ẻ
-    { 12, 22, 18, 3, 22, 66, 29723 }, // ẻ
-    { 13, 27, 19, 3, 27, 88, 29789 }, // Ẽ
-    { 12, 22, 18, 3, 22, 66, 29877 }, // ẽ
-    { 16, 26, 20, 3, 26, 104, 29943 }, // Ế
-    { 16, 22, 20, 3, 22, 88, 30047 }, // ế
-    { 18, 28, 19, -2, 28, 126, 30135 }, // Ề
-    { 16, 24, 18, -1, 24, 96, 30261 }, // ề
-    { 14, 29, 19, 3, 29, 102, 30357 }, // Ể
-    { 14, 26, 18, 3, 26, 91, 30459 }, // ể
-    { 13, 31, 19, 3, 31, 101, 30550 }, // Ễ
-    { 12, 27, 18, 3, 27, 81, 30651 }, // ễ
-    { 13, 34, 19, 3, 26, 111, 30732 }, // Ệ
-    { 12, 31, 18, 3, 22, 93, 30843 }, // ệ
-    { 5, 27, 11, 3, 27, 34, 30936 }, // Ỉ
-    { 5, 19, 10, 3, 19, 24, 30970 }, // ỉ
-    { 5, 27, 11, 3, 18, 34, 30994 }, // Ị
-    { 6, 28, 10, 2, 19, 42, 31028 }, // ị
-    { 18, 28, 24, 3, 18, 126, 31070 }, // Ọ
-    { 12, 20, 18, 3, 12, 60, 31196 }, // ọ
-    { 18, 27, 24, 3, 26, 122, 31256 }, // Ỏ
-    { 12, 20, 18, 3, 20, 60, 31378 }, // ỏ
-    { 19, 27, 24, 3, 26, 129, 31438 }, // Ố
-    { 15, 20, 19, 3, 20, 75, 31567 }, // ố
-    { 21, 28, 24, 0, 27, 147, 31642 }, // Ồ
-    { 17, 23, 18, -2, 23, 98, 31789 }, // ồ
-    { 18, 29, 24, 3, 28, 131, 31887 }, // Ổ
-    { 14, 23, 18, 3, 23, 81, 32018 }, // ổ
-    { 18, 31, 24, 3, 30, 140, 32099 }, // Ỗ
-    { 12, 24, 18, 3, 24, 72, 32239 }, // ỗ
-    { 18, 36, 24, 3, 26, 162, 32311 }, // Ộ
-    { 12, 29, 18, 3, 20, 87, 32473 }, // ộ
-    { 19, 26, 24, 3, 25, 124, 32560 }, // Ớ
-    { 14, 19, 18, 3, 19, 67, 32684 }, // ớ
-    { 19, 26, 24, 3, 25, 124, 32751 }, // Ờ
-    { 14, 19, 18, 3, 19, 67, 32875 }, // ờ
-    { 19, 27, 24, 3, 26, 129, 32942 }, // Ở
-    { 14, 20, 18, 3, 20, 70, 33071 }, // ở
-    { 19, 27, 24, 3, 26, 129, 33141 }, // Ỡ
-    { 14, 21, 18, 3, 21, 74, 33270 }, // ỡ
-    { 19, 30, 24, 3, 20, 143, 33344 }, // Ợ
-    { 14, 22, 18, 3, 14, 77, 33487 }, // ợ
-    { 16, 28, 22, 3, 18, 112, 33564 }, // Ụ
-    { 12, 22, 18, 3, 12, 66, 33676 }, // ụ
-    { 16, 28, 22, 3, 27, 112, 33742 }, // Ủ
-    { 12, 20, 18, 3, 20, 60, 33854 }, // ủ
-    { 18, 27, 22, 3, 26, 122, 33914 }, // Ứ
-    { 14, 19, 18, 3, 19, 67, 34036 }, // ứ
-    { 18, 27, 22, 3, 26, 122, 34103 }, // Ừ
-    { 14, 19, 18, 3, 19, 67, 34225 }, // ừ
-    { 18, 28, 22, 3, 27, 126, 34292 }, // Ử
-    { 14, 20, 18, 3, 20, 70, 34418 }, // ử
-    { 18, 28, 22, 3, 27, 126, 34488 }, // Ữ
-    { 14, 20, 18, 3, 20, 70, 34614 }, // ữ
-    { 18, 32, 22, 3, 22, 144, 34684 }, // Ự
-    { 14, 26, 18, 3, 16, 91, 34828 }, // ự
-    { 17, 27, 22, 3, 27, 115, 34919 }, // Ỳ
-    { 14, 27, 19, 3, 21, 95, 35034 }, // ỳ
-    { 17, 29, 22, 3, 18, 124, 35129 }, // Ỵ
-    { 15, 20, 19, 3, 12, 75, 35253 }, // ỵ
-    { 17, 28, 22, 3, 28, 119, 35328 }, // Ỷ
-    { 14, 29, 19, 3, 23, 102, 35447 }, // ỷ
-    { 17, 28, 22, 3, 28, 119, 35549 }, // Ỹ
-    { 14, 29, 19, 3, 23, 102, 35668 }, // ỹ
-    { 0, 0, 14, 0, 0, 0, 35770 }, //  
-    { 0, 0, 24, 0, 0, 0, 35770 }, //  
-    { 0, 0, 14, 0, 0, 0, 35770 }, //  
-    { 0, 0, 24, 0, 0, 0, 35770 }, //  
-    { 0, 0, 10, 0, 0, 0, 35770 }, //  
-    { 0, 0, 9, 0, 0, 0, 35770 }, //  
-    { 0, 0, 7, 0, 0, 0, 35770 }, //  
-    { 0, 0, 15, 0, 0, 0, 35770 }, //  
-    { 0, 0, 5, 0, 0, 0, 35770 }, //  
-    { 0, 0, 8, 0, 0, 0, 35770 }, //  
-    { 0, 0, 6, 0, 0, 0, 35770 }, //  
-    { 0, 0, 3, 0, 0, 0, 35770 }, // ​
-    { 0, 0, 1, 0, 0, 0, 35770 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 35770 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 35770 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 35770 }, // ‏
-    { 11, 3, 12, 0, 8, 9, 35770 }, // ‐
-    { 11, 3, 12, 0, 8, 9, 35779 }, // ‑
-    { 17, 3, 15, -3, 8, 13, 35788 }, // ‒
-    { 15, 5, 17, 1, 9, 19, 35801 }, // –
-    { 22, 5, 24, 1, 9, 28, 35820 }, // —
-    { 22, 5, 24, 1, 9, 28, 35848 }, // ―
-    { 10, 19, 13, 2, 15, 48, 35876 }, // ‖
-    { 18, 8, 16, -3, -1, 36, 35924 }, // ‗
-    { 7, 8, 9, 1, 19, 14, 35960 }, // ‘
-    { 7, 8, 9, 1, 19, 14, 35974 }, // ’
-    { 7, 8, 8, 0, 4, 14, 35988 }, // ‚
-    { 7, 8, 9, 1, 19, 14, 36002 }, // ‛
-    { 14, 8, 16, 1, 19, 28, 36016 }, // “
-    { 14, 8, 16, 1, 19, 28, 36044 }, // ”
-    { 7, 8, 8, 0, 4, 14, 36072 }, // „
-    { 14, 8, 16, 1, 19, 28, 36086 }, // ‟
-    { 13, 30, 17, 2, 22, 98, 36114 }, // †
-    { 13, 29, 18, 3, 21, 95, 36212 }, // ‡
-    { 17, 16, 15, -3, 19, 68, 36307 }, // •
-    { 7, 8, 13, 3, 10, 14, 36375 }, // ‣
-    { 6, 5, 13, 3, 5, 8, 36389 }, // ․
-    { 6, 5, 13, 3, 5, 8, 36397 }, // ‥
-    { 20, 5, 21, 0, 5, 25, 36405 }, // …
-    { 3, 3, 11, 4, 8, 3, 36430 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 36433 }, //  
-    { 16, 19, 24, 4, 17, 76, 36433 }, // ‰
-    { 8, 8, 12, 3, 19, 16, 36509 }, // ′
-    { 15, 8, 19, 3, 19, 30, 36525 }, // ″
-    { 17, 7, 19, 1, 18, 30, 36555 }, // ‴
-    { 6, 7, 9, 1, 18, 11, 36585 }, // ‵
-    { 10, 7, 11, 0, 18, 18, 36596 }, // ‶
-    { 17, 7, 14, -4, 18, 30, 36614 }, // ‷
-    { 12, 5, 14, 1, 18, 15, 36644 }, // ‸
-    { 7, 12, 9, 1, 12, 21, 36659 }, // ‹
-    { 7, 12, 9, 1, 12, 21, 36680 }, // ›
-    { 22, 28, 28, 4, 22, 154, 36701 }, // ※
-    { 6, 27, 13, 3, 24, 41, 36855 }, // ‼
-    { 13, 33, 18, 2, 28, 108, 36896 }, // ‽
-    { 11, 3, 12, 0, 18, 9, 37004 }, // ‾
-    { 11, 4, 12, 0, 14, 11, 37013 }, // ‿
-    { 15, 15, 15, -1, 19, 57, 37024 }, // ⁂
-    { 14, 18, 26, 6, 16, 63, 37081 }, // ⁄
-    { 26, 27, 31, 3, 24, 176, 37144 }, // ⁇
-    { 22, 28, 25, 2, 24, 154, 37320 }, // ⁈
-    { 17, 27, 17, -1, 24, 115, 37474 }, // ⁉
-    { 16, 36, 19, 2, 25, 144, 37589 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 37733 }, //  
-    { 7, 9, 8, 0, 18, 16, 37733 }, // ⁰
-    { 7, 8, 8, 0, 18, 14, 37749 }, // ⁴
-    { 7, 9, 8, 0, 18, 16, 37763 }, // ⁵
-    { 7, 9, 8, 0, 18, 16, 37779 }, // ⁶
-    { 7, 9, 8, 0, 18, 16, 37795 }, // ⁷
-    { 7, 9, 8, 0, 18, 16, 37811 }, // ⁸
-    { 7, 10, 8, 0, 18, 18, 37827 }, // ⁹
-    { 12, 13, 18, 3, 13, 39, 37845 }, // ⁿ
-    { 7, 9, 8, 0, 5, 16, 37884 }, // ₀
-    { 7, 9, 8, 0, 5, 16, 37900 }, // ₁
-    { 7, 9, 8, 0, 5, 16, 37916 }, // ₂
-    { 7, 9, 8, 0, 5, 16, 37932 }, // ₃
-    { 7, 8, 8, 0, 5, 14, 37948 }, // ₄
-    { 7, 9, 8, 0, 5, 16, 37962 }, // ₅
-    { 7, 9, 8, 0, 5, 16, 37978 }, // ₆
-    { 7, 10, 8, 0, 6, 18, 37994 }, // ₇
-    { 7, 9, 8, 0, 5, 16, 38012 }, // ₈
-    { 7, 9, 8, 0, 5, 16, 38028 }, // ₉
-    { 9, 29, 11, 1, 22, 66, 38044 }, // ₍
-    { 9, 29, 9, -1, 22, 66, 38110 }, // ₎
-    { 16, 27, 21, 2, 23, 108, 38176 }, // ₡
-    { 16, 19, 21, 2, 19, 76, 38284 }, // ₢
-    { 14, 19, 15, 0, 18, 67, 38360 }, // ₤
-    { 23, 18, 23, -1, 18, 104, 38427 }, // ₦
-    { 19, 18, 20, 0, 18, 86, 38531 }, // ₧
-    { 23, 19, 27, 2, 18, 110, 38617 }, // ₨
-    { 18, 18, 19, 0, 18, 81, 38727 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 38808 }, // ₪
-    { 16, 18, 15, -2, 17, 72, 38872 }, // ₫
-    { 15, 20, 16, 0, 17, 75, 38944 }, // €
-    { 16, 18, 22, 3, 18, 72, 39019 }, // ₮
-    { 21, 18, 21, -1, 18, 95, 39091 }, // ₱
-    { 18, 27, 24, 3, 23, 122, 39186 }, // ₲
-    { 21, 18, 26, 4, 17, 95, 39308 }, // ₴
-    { 11, 17, 15, 3, 15, 47, 39403 }, // ₵
-    { 18, 19, 22, 2, 19, 86, 39450 }, // ₸
-    { 12, 17, 14, 1, 16, 51, 39536 }, // ₹
-    { 13, 16, 15, 1, 14, 52, 39587 }, // ₺
-    { 15, 17, 17, 1, 17, 64, 39639 }, // ₼
-    { 18, 18, 19, -2, 18, 81, 39703 }, // ₽
-    { 15, 14, 16, 0, 12, 53, 39784 }, // ←
-    { 16, 15, 17, 0, 14, 60, 39837 }, // ↑
-    { 14, 14, 16, 1, 12, 49, 39897 }, // →
-    { 16, 14, 17, 0, 13, 56, 39946 }, // ↓
-    { 17, 12, 21, 2, 12, 51, 40002 }, // ↔
-    { 13, 17, 17, 2, 19, 56, 40053 }, // ↕
-    { 12, 12, 16, 2, 12, 36, 40109 }, // ↖
-    { 13, 12, 14, 0, 12, 39, 40145 }, // ↗
-    { 13, 12, 14, 0, 12, 39, 40184 }, // ↘
-    { 12, 12, 14, 1, 12, 36, 40223 }, // ↙
-    { 16, 14, 20, 2, 13, 56, 40259 }, // ⇐
-    { 18, 17, 22, 2, 16, 77, 40315 }, // ⇑
-    { 16, 14, 20, 2, 13, 56, 40392 }, // ⇒
-    { 18, 17, 22, 2, 15, 77, 40448 }, // ⇓
-    { 19, 14, 23, 2, 13, 67, 40525 }, // ⇔
-    { 14, 18, 19, 2, 10, 63, 40592 }, // ⇕
-    { 13, 19, 15, 1, 18, 62, 40655 }, // ∂
-    { 21, 20, 24, 1, 19, 105, 40717 }, // ∅
-    { 16, 17, 18, 1, 16, 68, 40822 }, // ∆
-    { 14, 16, 16, 1, 15, 56, 40890 }, // ∏
-    { 14, 17, 16, 1, 16, 60, 40946 }, // ∐
-    { 11, 16, 13, 1, 15, 44, 41006 }, // ∑
-    { 12, 4, 13, 0, 8, 12, 41050 }, // −
-    { 18, 19, 20, 1, 18, 86, 41062 }, // √
-    { 17, 12, 19, 1, 14, 51, 41148 }, // ∞
-    { 17, 23, 18, 0, 17, 98, 41199 }, // ∫
-    { 6, 14, 7, 0, 14, 21, 41297 }, // ∶
-    { 12, 12, 30, 9, 12, 36, 41318 }, // ≈
-    { 16, 19, 26, 5, 17, 76, 41354 }, // ≠
-    { 18, 18, 18, -1, 16, 81, 41430 }, // ≤
-    { 18, 18, 19, 0, 16, 81, 41511 }, // ≥
+    { 7, 27, 8, 0, 24, 35, 0 }, // !
+    { 13, 8, 15, -2, 19, 21, 35 }, // "
+    { 23, 20, 23, -1, 17, 70, 56 }, // #
+    { 18, 25, 24, 3, 21, 74, 126 }, // $
+    { 18, 19, 23, 3, 17, 71, 200 }, // %
+    { 16, 17, 19, 2, 17, 56, 271 }, // &
+    { 6, 8, 8, 1, 17, 11, 327 }, // '
+    { 9, 29, 11, 1, 22, 44, 338 }, // (
+    { 9, 29, 9, -1, 22, 45, 382 }, // )
+    { 13, 12, 14, 0, 17, 33, 427 }, // *
+    { 11, 12, 13, 1, 12, 22, 460 }, // +
+    { 7, 8, 8, 0, 4, 12, 482 }, // ,
+    { 11, 3, 12, 0, 8, 10, 494 }, // -
+    { 5, 5, 6, 0, 5, 7, 504 }, // .
+    { 14, 36, 15, 0, 25, 72, 511 }, // /
+    { 13, 17, 15, 1, 16, 51, 583 }, // 0
+    { 11, 16, 13, 1, 16, 30, 634 }, // 1
+    { 13, 16, 15, 1, 16, 39, 664 }, // 2
+    { 13, 17, 15, 1, 17, 45, 703 }, // 3
+    { 13, 17, 15, 1, 16, 39, 748 }, // 4
+    { 12, 17, 15, 1, 16, 44, 787 }, // 5
+    { 13, 16, 15, 1, 16, 42, 831 }, // 6
+    { 12, 16, 15, 1, 16, 31, 873 }, // 7
+    { 13, 17, 16, 1, 16, 48, 904 }, // 8
+    { 13, 18, 15, 1, 17, 47, 952 }, // 9
+    { 6, 14, 7, 0, 14, 16, 999 }, // :
+    { 7, 17, 8, 0, 13, 24, 1015 }, // ;
+    { 17, 14, 17, -1, 14, 37, 1039 }, // <
+    { 12, 8, 13, 0, 10, 22, 1076 }, // =
+    { 16, 14, 18, 1, 14, 37, 1098 }, // >
+    { 14, 27, 15, 0, 24, 54, 1135 }, // ?
+    { 20, 19, 21, 0, 18, 73, 1189 }, // @
+    { 18, 18, 20, 1, 18, 50, 1262 }, // A
+    { 14, 18, 20, 3, 18, 54, 1312 }, // B
+    { 16, 19, 21, 2, 19, 47, 1366 }, // C
+    { 16, 18, 22, 3, 18, 54, 1413 }, // D
+    { 13, 18, 19, 3, 18, 46, 1467 }, // E
+    { 12, 18, 18, 3, 18, 39, 1513 }, // F
+    { 18, 19, 24, 3, 19, 62, 1552 }, // G
+    { 16, 18, 22, 3, 18, 54, 1614 }, // H
+    { 5, 18, 11, 3, 18, 23, 1668 }, // I
+    { 13, 23, 19, 3, 18, 45, 1691 }, // J
+    { 16, 18, 22, 3, 18, 53, 1736 }, // K
+    { 13, 18, 19, 3, 18, 39, 1789 }, // L
+    { 18, 18, 24, 3, 18, 74, 1828 }, // M
+    { 16, 18, 22, 3, 18, 67, 1902 }, // N
+    { 18, 19, 24, 3, 18, 60, 1969 }, // O
+    { 13, 18, 19, 3, 18, 46, 2029 }, // P
+    { 19, 22, 22, 2, 19, 69, 2075 }, // Q
+    { 14, 18, 20, 3, 18, 52, 2144 }, // R
+    { 16, 19, 22, 3, 18, 52, 2196 }, // S
+    { 16, 18, 22, 3, 18, 38, 2248 }, // T
+    { 16, 19, 22, 3, 18, 58, 2286 }, // U
+    { 18, 18, 24, 3, 18, 51, 2344 }, // V
+    { 24, 18, 30, 3, 18, 75, 2395 }, // W
+    { 17, 18, 23, 3, 18, 52, 2470 }, // X
+    { 17, 18, 22, 3, 18, 46, 2522 }, // Y
+    { 17, 18, 23, 3, 18, 54, 2568 }, // Z
+    { 8, 31, 10, 1, 23, 53, 2622 }, // [
+    { 8, 24, 10, 1, 18, 34, 2675 }, // <backslash>
+    { 8, 31, 10, 1, 23, 52, 2709 }, // ]
+    { 12, 6, 13, 0, 21, 12, 2761 }, // ^
+    { 16, 5, 16, -1, -1, 10, 2773 }, // _
+    { 9, 4, 10, 0, 16, 8, 2783 }, // `
+    { 12, 13, 18, 3, 13, 37, 2791 }, // a
+    { 13, 19, 18, 3, 18, 53, 2828 }, // b
+    { 11, 13, 16, 3, 13, 27, 2881 }, // c
+    { 13, 18, 18, 3, 18, 44, 2908 }, // d
+    { 12, 12, 18, 3, 12, 35, 2952 }, // e
+    { 9, 17, 14, 3, 17, 27, 2987 }, // f
+    { 12, 19, 18, 3, 12, 53, 3014 }, // g
+    { 13, 18, 18, 3, 18, 47, 3067 }, // h
+    { 6, 19, 10, 2, 19, 32, 3114 }, // i
+    { 8, 25, 13, 3, 19, 38, 3146 }, // j
+    { 13, 18, 19, 3, 18, 42, 3184 }, // k
+    { 7, 18, 12, 3, 18, 32, 3226 }, // l
+    { 20, 13, 26, 3, 13, 55, 3258 }, // m
+    { 12, 13, 18, 3, 13, 33, 3313 }, // n
+    { 12, 12, 18, 3, 12, 34, 3346 }, // o
+    { 14, 19, 20, 3, 13, 49, 3380 }, // p
+    { 15, 19, 20, 3, 13, 52, 3429 }, // q
+    { 9, 12, 15, 3, 12, 23, 3481 }, // r
+    { 12, 14, 18, 3, 13, 31, 3504 }, // s
+    { 11, 18, 16, 3, 17, 31, 3535 }, // t
+    { 12, 12, 18, 3, 12, 33, 3566 }, // u
+    { 15, 12, 21, 3, 12, 32, 3599 }, // v
+    { 17, 13, 23, 3, 12, 49, 3631 }, // w
+    { 15, 12, 20, 3, 12, 32, 3680 }, // x
+    { 14, 18, 19, 3, 12, 44, 3712 }, // y
+    { 13, 12, 18, 3, 12, 26, 3756 }, // z
+    { 11, 21, 12, 0, 16, 37, 3782 }, // {
+    { 4, 19, 8, 2, 15, 29, 3819 }, // |
+    { 11, 21, 12, 0, 16, 35, 3848 }, // }
+    { 8, 5, 10, 1, 16, 17, 3883 }, // ~
+    { 0, 0, 18, 0, 0, 0, 3900 }, //  
+    { 7, 27, 16, 4, 23, 41, 3900 }, // ¡
+    { 11, 20, 16, 3, 16, 45, 3941 }, // ¢
+    { 14, 19, 15, 0, 18, 44, 3986 }, // £
+    { 14, 13, 15, 0, 14, 37, 4030 }, // ¤
+    { 16, 19, 17, 0, 16, 49, 4067 }, // ¥
+    { 3, 19, 8, 2, 15, 21, 4116 }, // ¦
+    { 12, 19, 16, 2, 17, 43, 4137 }, // §
+    { 11, 5, 12, 0, 17, 18, 4180 }, // ¨
+    { 10, 9, 14, 2, 20, 29, 4198 }, // ©
+    { 7, 7, 14, 4, 16, 16, 4227 }, // ª
+    { 12, 12, 13, 0, 12, 36, 4243 }, // «
+    { 11, 8, 13, 1, 8, 16, 4279 }, // ¬
+    { 11, 3, 13, 1, 8, 10, 4295 }, // ­
+    { 10, 9, 14, 2, 23, 29, 4305 }, // ®
+    { 10, 4, 11, 0, 16, 6, 4334 }, // ¯
+    { 10, 10, 14, 2, 16, 22, 4340 }, // °
+    { 12, 14, 13, 0, 12, 30, 4362 }, // ±
+    { 6, 8, 7, 0, 17, 16, 4392 }, // ²
+    { 7, 8, 8, 0, 17, 16, 4408 }, // ³
+    { 6, 5, 7, 0, 16, 8, 4424 }, // ´
+    { 13, 15, 18, 2, 12, 39, 4432 }, // µ
+    { 12, 18, 16, 2, 15, 53, 4471 }, // ¶
+    { 5, 5, 6, 0, 10, 8, 4524 }, // ·
+    { 6, 7, 7, 0, 1, 14, 4532 }, // ¸
+    { 6, 8, 7, 0, 17, 13, 4546 }, // ¹
+    { 7, 7, 14, 4, 15, 14, 4559 }, // º
+    { 12, 12, 16, 2, 12, 33, 4573 }, // »
+    { 19, 20, 26, 3, 18, 77, 4606 }, // ¼
+    { 21, 20, 26, 3, 18, 74, 4683 }, // ½
+    { 19, 19, 26, 3, 17, 76, 4757 }, // ¾
+    { 13, 26, 14, 0, 15, 49, 4833 }, // ¿
+    { 18, 24, 20, 1, 24, 62, 4882 }, // À
+    { 18, 28, 20, 1, 28, 66, 4944 }, // Á
+    { 18, 26, 20, 1, 26, 69, 5010 }, // Â
+    { 18, 25, 20, 1, 25, 68, 5079 }, // Ã
+    { 18, 25, 20, 1, 25, 69, 5147 }, // Ä
+    { 18, 25, 20, 1, 25, 64, 5216 }, // Å
+    { 26, 19, 28, 1, 18, 74, 5280 }, // Æ
+    { 16, 25, 21, 2, 19, 60, 5354 }, // Ç
+    { 13, 25, 19, 3, 25, 57, 5414 }, // È
+    { 13, 28, 19, 3, 28, 59, 5471 }, // É
+    { 13, 26, 19, 3, 26, 60, 5530 }, // Ê
+    { 13, 26, 19, 3, 26, 67, 5590 }, // Ë
+    { 9, 26, 11, 0, 26, 38, 5657 }, // Ì
+    { 5, 29, 11, 3, 29, 32, 5695 }, // Í
+    { 12, 27, 13, 0, 27, 45, 5727 }, // Î
+    { 11, 27, 12, 0, 27, 47, 5772 }, // Ï
+    { 20, 18, 22, -1, 18, 63, 5819 }, // Ð
+    { 16, 25, 22, 3, 25, 82, 5882 }, // Ñ
+    { 18, 25, 24, 3, 24, 71, 5964 }, // Ò
+    { 18, 28, 24, 3, 27, 75, 6035 }, // Ó
+    { 18, 27, 24, 3, 26, 77, 6110 }, // Ô
+    { 18, 26, 24, 3, 25, 76, 6187 }, // Õ
+    { 18, 26, 24, 3, 25, 79, 6263 }, // Ö
+    { 13, 7, 14, 0, 9, 17, 6342 }, // ×
+    { 30, 41, 28, -3, 30, 142, 6359 }, // Ø
+    { 16, 26, 22, 3, 25, 71, 6501 }, // Ù
+    { 16, 30, 22, 3, 29, 74, 6572 }, // Ú
+    { 16, 28, 22, 3, 27, 74, 6646 }, // Û
+    { 16, 28, 22, 3, 27, 78, 6720 }, // Ü
+    { 17, 30, 22, 3, 30, 65, 6798 }, // Ý
+    { 10, 17, 12, 1, 17, 34, 6863 }, // Þ
+    { 13, 17, 15, 1, 16, 52, 6897 }, // ß
+    { 12, 19, 18, 3, 19, 47, 6949 }, // à
+    { 12, 22, 18, 3, 22, 49, 6996 }, // á
+    { 12, 20, 18, 3, 20, 50, 7045 }, // â
+    { 12, 19, 18, 3, 19, 51, 7095 }, // ã
+    { 12, 20, 18, 3, 20, 54, 7146 }, // ä
+    { 12, 20, 18, 3, 20, 48, 7200 }, // å
+    { 20, 13, 26, 3, 13, 54, 7248 }, // æ
+    { 11, 18, 16, 3, 13, 36, 7302 }, // ç
+    { 12, 21, 18, 3, 21, 49, 7338 }, // è
+    { 12, 24, 18, 3, 24, 50, 7387 }, // é
+    { 12, 22, 18, 3, 22, 52, 7437 }, // ê
+    { 12, 22, 18, 3, 22, 54, 7489 }, // ë
+    { 9, 18, 10, 0, 18, 31, 7543 }, // ì
+    { 5, 21, 10, 3, 21, 31, 7574 }, // í
+    { 12, 19, 12, -1, 19, 36, 7605 }, // î
+    { 10, 18, 11, 0, 18, 35, 7641 }, // ï
+    { 17, 19, 17, -1, 18, 53, 7676 }, // ð
+    { 12, 20, 18, 3, 20, 47, 7729 }, // ñ
+    { 12, 18, 18, 3, 18, 44, 7776 }, // ò
+    { 12, 22, 18, 3, 22, 46, 7820 }, // ó
+    { 12, 20, 18, 3, 20, 50, 7866 }, // ô
+    { 12, 19, 18, 3, 19, 48, 7916 }, // õ
+    { 12, 19, 18, 3, 19, 51, 7964 }, // ö
+    { 16, 15, 19, 1, 15, 34, 8015 }, // ÷
+    { 14, 35, 18, 2, 24, 82, 8049 }, // ø
+    { 12, 18, 18, 3, 18, 44, 8131 }, // ù
+    { 12, 22, 18, 3, 22, 46, 8175 }, // ú
+    { 12, 20, 18, 3, 20, 49, 8221 }, // û
+    { 12, 20, 18, 3, 20, 50, 8270 }, // ü
+    { 14, 31, 19, 3, 25, 61, 8320 }, // ý
+    { 10, 22, 12, 1, 17, 48, 8381 }, // þ
+    { 14, 28, 19, 3, 22, 66, 8429 }, // ÿ
+    { 18, 25, 20, 1, 25, 66, 8495 }, // Ā
+    { 12, 20, 18, 3, 20, 51, 8561 }, // ā
+    { 18, 26, 20, 1, 26, 65, 8612 }, // Ă
+    { 12, 20, 18, 3, 20, 50, 8677 }, // ă
+    { 18, 24, 20, 1, 18, 63, 8727 }, // Ą
+    { 13, 19, 18, 3, 13, 50, 8790 }, // ą
+    { 16, 25, 21, 2, 25, 58, 8840 }, // Ć
+    { 11, 18, 16, 3, 18, 34, 8898 }, // ć
+    { 16, 27, 21, 2, 27, 61, 8932 }, // Ĉ
+    { 12, 19, 16, 2, 19, 39, 8993 }, // ĉ
+    { 16, 25, 21, 2, 25, 58, 9032 }, // Ċ
+    { 11, 18, 16, 3, 18, 37, 9090 }, // ċ
+    { 16, 27, 21, 2, 27, 67, 9127 }, // Č
+    { 12, 20, 16, 3, 20, 42, 9194 }, // č
+    { 16, 27, 22, 3, 27, 72, 9236 }, // Ď
+    { 17, 18, 21, 3, 18, 52, 9308 }, // ď
+    { 20, 18, 22, -1, 18, 63, 9360 }, // Đ
+    { 16, 18, 20, 3, 18, 50, 9423 }, // đ
+    { 13, 26, 19, 3, 26, 62, 9473 }, // Ē
+    { 12, 22, 18, 3, 22, 52, 9535 }, // ē
+    { 13, 26, 19, 3, 26, 58, 9587 }, // Ĕ
+    { 12, 22, 18, 3, 22, 50, 9645 }, // ĕ
+    { 13, 26, 19, 3, 26, 59, 9695 }, // Ė
+    { 12, 22, 18, 3, 22, 47, 9754 }, // ė
+    { 13, 23, 19, 3, 18, 57, 9801 }, // Ę
+    { 12, 20, 18, 3, 12, 48, 9858 }, // ę
+    { 13, 28, 19, 3, 28, 64, 9906 }, // Ě
+    { 12, 24, 18, 3, 24, 49, 9970 }, // ě
+    { 18, 29, 24, 3, 29, 84, 10019 }, // Ĝ
+    { 13, 28, 18, 3, 21, 71, 10103 }, // ĝ
+    { 18, 28, 24, 3, 28, 79, 10174 }, // Ğ
+    { 12, 27, 18, 3, 20, 67, 10253 }, // ğ
+    { 18, 28, 24, 3, 28, 78, 10320 }, // Ġ
+    { 12, 27, 18, 3, 20, 64, 10398 }, // ġ
+    { 18, 31, 24, 3, 31, 82, 10462 }, // Ģ
+    { 12, 28, 18, 3, 21, 70, 10544 }, // ģ
+    { 16, 26, 22, 3, 26, 70, 10614 }, // Ĥ
+    { 16, 26, 18, 0, 26, 61, 10684 }, // ĥ
+    { 18, 18, 22, 2, 18, 57, 10745 }, // Ħ
+    { 16, 18, 18, 0, 18, 51, 10802 }, // ħ
+    { 9, 27, 11, 1, 27, 42, 10853 }, // Ĩ
+    { 8, 20, 10, 1, 20, 38, 10895 }, // ĩ
+    { 12, 27, 12, -1, 27, 46, 10933 }, // Ī
+    { 12, 19, 12, -1, 19, 39, 10979 }, // ī
+    { 6, 23, 11, 2, 18, 35, 11018 }, // Į
+    { 6, 25, 10, 2, 19, 42, 11053 }, // į
+    { 5, 27, 11, 3, 27, 32, 11095 }, // İ
+    { 4, 12, 10, 3, 12, 17, 11127 }, // ı
+    { 17, 26, 33, 7, 18, 72, 11144 }, // Ĳ
+    { 13, 24, 16, 2, 19, 62, 11216 }, // ĳ
+    { 14, 31, 19, 3, 26, 63, 11278 }, // Ĵ
+    { 12, 27, 15, 2, 21, 47, 11341 }, // ĵ
+    { 16, 29, 22, 3, 29, 71, 11388 }, // Ķ
+    { 13, 29, 19, 3, 18, 60, 11459 }, // ķ
+    { 10, 12, 14, 2, 12, 26, 11519 }, // ĸ
+    { 13, 24, 19, 3, 24, 50, 11545 }, // Ĺ
+    { 7, 27, 12, 3, 27, 41, 11595 }, // ĺ
+    { 15, 28, 19, 1, 28, 62, 11636 }, // Ļ
+    { 9, 29, 12, 1, 18, 44, 11698 }, // ļ
+    { 13, 18, 19, 3, 18, 44, 11742 }, // Ľ
+    { 10, 21, 14, 3, 21, 40, 11786 }, // ľ
+    { 13, 18, 19, 3, 18, 45, 11826 }, // Ŀ
+    { 10, 18, 14, 3, 18, 39, 11871 }, // ŀ
+    { 23, 32, 19, -6, 25, 88, 11910 }, // Ł
+    { 15, 18, 12, -4, 18, 42, 11998 }, // ł
+    { 16, 25, 22, 3, 25, 79, 12040 }, // Ń
+    { 12, 20, 18, 3, 20, 43, 12119 }, // ń
+    { 16, 27, 22, 3, 18, 84, 12162 }, // Ņ
+    { 12, 21, 18, 3, 13, 44, 12246 }, // ņ
+    { 16, 27, 22, 3, 27, 85, 12290 }, // Ň
+    { 13, 22, 18, 3, 22, 55, 12375 }, // ň
+    { 12, 21, 18, 3, 21, 44, 12430 }, // ŉ
+    { 16, 23, 22, 3, 18, 77, 12474 }, // Ŋ
+    { 12, 18, 18, 3, 13, 41, 12551 }, // ŋ
+    { 18, 26, 24, 3, 25, 77, 12592 }, // Ō
+    { 12, 19, 18, 3, 19, 49, 12669 }, // ō
+    { 18, 27, 24, 3, 26, 75, 12718 }, // Ŏ
+    { 12, 20, 18, 3, 20, 47, 12793 }, // ŏ
+    { 19, 25, 24, 3, 24, 76, 12840 }, // Ő
+    { 18, 18, 20, 1, 18, 56, 12916 }, // ő
+    { 25, 20, 29, 3, 19, 76, 12972 }, // Œ
+    { 21, 12, 25, 3, 12, 56, 13048 }, // œ
+    { 14, 25, 20, 3, 25, 63, 13104 }, // Ŕ
+    { 9, 18, 15, 3, 18, 31, 13167 }, // ŕ
+    { 14, 29, 20, 3, 29, 70, 13198 }, // Ŗ
+    { 10, 22, 15, 2, 22, 35, 13268 }, // ŗ
+    { 14, 26, 20, 3, 26, 65, 13303 }, // Ř
+    { 12, 19, 15, 1, 19, 37, 13368 }, // ř
+    { 16, 26, 22, 3, 25, 64, 13405 }, // Ś
+    { 12, 19, 18, 3, 18, 40, 13469 }, // ś
+    { 16, 27, 22, 3, 26, 67, 13509 }, // Ŝ
+    { 12, 20, 18, 3, 19, 43, 13576 }, // ŝ
+    { 16, 23, 22, 3, 18, 63, 13619 }, // Ş
+    { 12, 19, 18, 3, 13, 42, 13682 }, // ş
+    { 16, 27, 22, 3, 26, 68, 13724 }, // Š
+    { 12, 21, 18, 3, 20, 44, 13792 }, // š
+    { 16, 24, 22, 3, 18, 53, 13836 }, // Ţ
+    { 11, 22, 16, 3, 17, 38, 13889 }, // ţ
+    { 16, 26, 22, 3, 26, 55, 13927 }, // Ť
+    { 14, 21, 18, 3, 20, 45, 13982 }, // ť
+    { 16, 18, 22, 3, 18, 43, 14027 }, // Ŧ
+    { 12, 18, 16, 2, 17, 39, 14070 }, // ŧ
+    { 16, 28, 22, 3, 27, 75, 14109 }, // Ũ
+    { 12, 20, 18, 3, 20, 54, 14184 }, // ũ
+    { 16, 28, 22, 3, 27, 74, 14238 }, // Ū
+    { 12, 19, 18, 3, 19, 46, 14312 }, // ū
+    { 16, 28, 22, 3, 27, 74, 14358 }, // Ŭ
+    { 12, 20, 18, 3, 20, 46, 14432 }, // ŭ
+    { 16, 29, 22, 3, 28, 74, 14478 }, // Ů
+    { 12, 21, 18, 3, 21, 45, 14552 }, // ů
+    { 18, 27, 22, 3, 26, 79, 14597 }, // Ű
+    { 18, 19, 20, 1, 19, 55, 14676 }, // ű
+    { 16, 23, 22, 3, 18, 66, 14731 }, // Ų
+    { 12, 18, 18, 3, 12, 43, 14797 }, // ų
+    { 24, 26, 30, 3, 26, 93, 14840 }, // Ŵ
+    { 17, 22, 23, 3, 21, 65, 14933 }, // ŵ
+    { 17, 28, 22, 3, 28, 65, 14998 }, // Ŷ
+    { 14, 29, 19, 3, 23, 64, 15063 }, // ŷ
+    { 17, 28, 22, 3, 28, 69, 15127 }, // Ÿ
+    { 17, 24, 23, 3, 24, 66, 15196 }, // Ź
+    { 13, 20, 18, 3, 20, 39, 15262 }, // ź
+    { 17, 24, 23, 3, 24, 66, 15301 }, // Ż
+    { 13, 20, 18, 3, 20, 38, 15367 }, // ż
+    { 17, 26, 23, 3, 26, 72, 15405 }, // Ž
+    { 13, 21, 18, 3, 21, 44, 15477 }, // ž
+    { 8, 17, 13, 2, 17, 28, 15521 }, // ſ
+    { 19, 21, 24, 3, 20, 68, 15549 }, // Ơ
+    { 14, 14, 18, 3, 14, 42, 15617 }, // ơ
+    { 17, 18, 19, -1, 18, 60, 15659 }, // Ƥ
+    { 14, 23, 20, 3, 16, 62, 15719 }, // ƥ
+    { 11, 16, 13, 1, 15, 35, 15781 }, // Ʃ
+    { 18, 18, 22, 1, 18, 40, 15816 }, // Ƭ
+    { 11, 21, 16, 3, 20, 38, 15856 }, // ƭ
+    { 16, 21, 22, 3, 18, 47, 15894 }, // Ʈ
+    { 18, 23, 22, 3, 22, 68, 15941 }, // Ư
+    { 14, 16, 18, 3, 16, 44, 16009 }, // ư
+    { 9, 4, 10, 0, 16, 8, 16053 }, // ̀
+    { 6, 5, 7, 0, 16, 8, 16061 }, // ́
+    { 12, 6, 13, 0, 1, 13, 16069 }, // ̂
+    { 8, 5, 10, 1, 16, 17, 16082 }, // ̃
+    { 12, 4, 13, 0, 15, 10, 16099 }, // ̄
+    { 15, 4, 16, 0, 19, 11, 16109 }, // ̅
+    { 11, 6, 12, 0, 16, 12, 16120 }, // ̆
+    { 5, 5, 9, 3, 17, 9, 16132 }, // ̇
+    { 10, 4, 11, 0, 15, 11, 16141 }, // ̈
+    { 5, 5, 10, 4, 14, 8, 16152 }, // ̉
+    { 5, 5, 7, 1, 16, 10, 16160 }, // ̊
+    { 19, 4, 20, 0, 16, 18, 16170 }, // ̋
+    { 12, 6, 13, 0, 17, 12, 16188 }, // ̌
+    { 18, 4, 14, -5, 16, 14, 16200 }, // ̏
+    { 7, 8, 8, 0, 17, 10, 16214 }, // ̒
+    { 8, 8, 9, 0, 16, 11, 16224 }, // ̓
+    { 8, 8, 8, -1, 16, 12, 16235 }, // ̔
+    { 5, 6, 7, 1, 0, 8, 16247 }, // ̘
+    { 5, 6, 7, 1, 0, 9, 16255 }, // ̙
+    { 10, 6, 12, 1, 17, 15, 16264 }, // ̚
+    { 5, 6, 6, 0, 14, 10, 16279 }, // ̛
+    { 4, 7, 6, 1, 0, 8, 16289 }, // ̜
+    { 6, 5, 8, 1, 3, 10, 16297 }, // ̝
+    { 6, 5, 8, 1, 0, 7, 16307 }, // ̞
+    { 5, 5, 7, 1, -2, 7, 16314 }, // ̟
+    { 12, 4, 13, 0, -2, 10, 16321 }, // ̠
+    { 6, 5, 7, 0, 2, 9, 16331 }, // ̣
+    { 10, 4, 11, 0, -1, 11, 16340 }, // ̤
+    { 5, 5, 7, 1, 16, 10, 16351 }, // ̥
+    { 7, 8, 8, 0, 4, 12, 16361 }, // ̦
+    { 6, 7, 7, 0, 1, 14, 16373 }, // ̧
+    { 6, 8, 8, 1, 2, 13, 16387 }, // ̨
+    { 5, 7, 6, 0, -1, 12, 16400 }, // ̩
+    { 9, 5, 10, 0, 0, 14, 16412 }, // ̪
+    { 13, 6, 13, -1, 1, 14, 16426 }, // ̬
+    { 13, 6, 13, -1, 1, 15, 16440 }, // ̭
+    { 9, 6, 11, 1, 18, 17, 16455 }, // ̰
+    { 10, 4, 12, 1, 18, 8, 16472 }, // ̱
+    { 11, 4, 12, 0, -1, 10, 16480 }, // ̲
+    { 9, 6, 11, 1, 18, 17, 16490 }, // ̴
+    { 11, 3, 12, 0, 8, 10, 16507 }, // ̵
+    { 5, 8, 6, 0, 1, 8, 16517 }, // ̹
+    { 10, 7, 11, 0, 1, 13, 16525 }, // ̺
+    { 9, 7, 10, 0, 1, 18, 16538 }, // ̻
+    { 9, 6, 10, 0, 1, 19, 16556 }, // ̼
+    { 7, 5, 9, 1, 16, 11, 16575 }, // ̽
+    { 8, 5, 10, 1, 16, 17, 16586 }, // ͂
+    { 4, 6, 10, 5, 19, 8, 16603 }, // ̓
+    { 10, 15, 12, 1, 26, 25, 16611 }, // ̈́
+    { 9, 5, 10, 0, 17, 14, 16636 }, // ͆
+    { 12, 8, 13, 0, 0, 21, 16650 }, // ͇
+    { 9, 7, 11, 1, 1, 17, 16671 }, // ͈
+    { 7, 6, 9, 1, -1, 10, 16688 }, // ͉
+    { 11, 16, 13, 1, 22, 33, 16698 }, // ͊
+    { 19, 16, 21, 1, 24, 46, 16731 }, // ͋
+    { 12, 12, 22, 9, 12, 34, 16777 }, // ͌
+    { 11, 6, 13, 1, -2, 10, 16811 }, // ͍
+    { 5, 4, 6, 0, 3, 6, 16821 }, // ͎
+    { 19, 6, 20, 0, 2, 19, 16827 }, // ͜
+    { 19, 6, 20, 0, 17, 20, 16846 }, // ͡
+    { 22, 7, 24, 1, 0, 26, 16866 }, // ͢
+    { 18, 18, 20, 1, 18, 50, 16892 }, // Α
+    { 14, 18, 20, 3, 18, 54, 16942 }, // Β
+    { 10, 19, 12, 1, 17, 24, 16996 }, // Γ
+    { 16, 17, 18, 1, 16, 42, 17020 }, // Δ
+    { 13, 18, 19, 3, 18, 46, 17062 }, // Ε
+    { 17, 18, 23, 3, 18, 54, 17108 }, // Ζ
+    { 16, 18, 22, 3, 18, 54, 17162 }, // Η
+    { 18, 19, 24, 3, 18, 67, 17216 }, // Θ
+    { 5, 18, 11, 3, 18, 23, 17283 }, // Ι
+    { 16, 18, 22, 3, 18, 53, 17306 }, // Κ
+    { 18, 18, 24, 3, 18, 52, 17359 }, // Λ
+    { 18, 18, 24, 3, 18, 74, 17411 }, // Μ
+    { 16, 18, 22, 3, 18, 67, 17485 }, // Ν
+    { 14, 16, 16, 1, 15, 29, 17552 }, // Ξ
+    { 18, 19, 24, 3, 18, 60, 17581 }, // Ο
+    { 11, 16, 13, 1, 15, 28, 17641 }, // Π
+    { 13, 18, 19, 3, 18, 46, 17669 }, // Ρ
+    { 11, 16, 13, 1, 15, 36, 17715 }, // Σ
+    { 16, 18, 22, 3, 18, 38, 17751 }, // Τ
+    { 17, 18, 22, 3, 18, 46, 17789 }, // Υ
+    { 21, 23, 29, 4, 19, 86, 17835 }, // Φ
+    { 17, 18, 23, 3, 18, 52, 17921 }, // Χ
+    { 15, 20, 17, 1, 18, 57, 17973 }, // Ψ
+    { 16, 17, 18, 1, 16, 56, 18030 }, // Ω
+    { 15, 15, 20, 3, 13, 41, 18086 }, // α
+    { 13, 25, 15, 1, 20, 60, 18127 }, // β
+    { 14, 19, 15, 0, 12, 48, 18187 }, // γ
+    { 13, 19, 15, 1, 18, 51, 18235 }, // δ
+    { 10, 12, 12, 1, 11, 29, 18286 }, // ε
+    { 12, 20, 13, 0, 16, 38, 18315 }, // ζ
+    { 14, 19, 16, 1, 13, 55, 18353 }, // η
+    { 12, 17, 14, 1, 16, 48, 18408 }, // θ
+    { 7, 15, 13, 3, 15, 21, 18456 }, // ι
+    { 11, 12, 15, 2, 12, 29, 18477 }, // κ
+    { 14, 18, 18, 2, 18, 46, 18506 }, // λ
+    { 13, 15, 18, 2, 12, 39, 18552 }, // μ
+    { 14, 13, 15, 0, 12, 37, 18591 }, // ν
+    { 10, 20, 12, 1, 16, 39, 18628 }, // ξ
+    { 12, 12, 18, 3, 12, 34, 18667 }, // ο
+    { 13, 12, 15, 1, 11, 35, 18701 }, // π
+    { 15, 18, 16, 0, 13, 48, 18736 }, // ρ
+    { 11, 16, 12, 0, 16, 28, 18784 }, // ς
+    { 14, 12, 20, 3, 12, 38, 18812 }, // σ
+    { 12, 12, 14, 1, 11, 25, 18850 }, // τ
+    { 11, 13, 13, 1, 12, 35, 18875 }, // υ
+    { 18, 27, 24, 3, 22, 86, 18910 }, // φ
+    { 17, 19, 18, 0, 13, 52, 18996 }, // χ
+    { 12, 23, 14, 1, 16, 69, 19048 }, // ψ
+    { 17, 13, 18, 0, 12, 48, 19117 }, // ω
+    { 18, 24, 20, 1, 18, 61, 19165 }, // Ạ
+    { 12, 21, 18, 3, 13, 49, 19226 }, // ạ
+    { 18, 26, 20, 1, 26, 63, 19275 }, // Ả
+    { 12, 20, 18, 3, 20, 47, 19338 }, // ả
+    { 18, 32, 20, 1, 32, 81, 19385 }, // Ấ
+    { 13, 23, 18, 3, 23, 61, 19466 }, // ấ
+    { 20, 27, 20, -1, 27, 78, 19527 }, // Ầ
+    { 18, 24, 18, -3, 24, 64, 19605 }, // ầ
+    { 18, 32, 20, 1, 32, 80, 19669 }, // Ẩ
+    { 14, 24, 18, 3, 24, 59, 19749 }, // ẩ
+    { 18, 30, 20, 1, 30, 81, 19808 }, // Ẫ
+    { 12, 25, 18, 3, 25, 62, 19889 }, // ẫ
+    { 18, 32, 20, 1, 26, 80, 19951 }, // Ậ
+    { 12, 28, 18, 3, 20, 62, 20031 }, // ậ
+    { 18, 32, 20, 1, 32, 76, 20093 }, // Ắ
+    { 12, 27, 18, 3, 27, 61, 20169 }, // ắ
+    { 18, 32, 20, 1, 32, 77, 20230 }, // Ằ
+    { 12, 27, 18, 3, 27, 60, 20307 }, // ằ
+    { 18, 33, 20, 1, 33, 77, 20367 }, // Ẳ
+    { 12, 29, 18, 3, 29, 63, 20444 }, // ẳ
+    { 18, 33, 20, 1, 33, 85, 20507 }, // Ẵ
+    { 12, 28, 18, 3, 28, 66, 20592 }, // ẵ
+    { 18, 32, 20, 1, 26, 76, 20658 }, // Ặ
+    { 12, 28, 18, 3, 20, 62, 20734 }, // ặ
+    { 13, 26, 19, 3, 18, 59, 20796 }, // Ẹ
+    { 12, 21, 18, 3, 12, 48, 20855 }, // ẹ
+    { 13, 26, 19, 3, 26, 59, 20903 }, // Ẻ
+    { 12, 22, 18, 3, 22, 48, 20962 }, // ẻ
+    { 13, 27, 19, 3, 27, 61, 21010 }, // Ẽ
+    { 12, 22, 18, 3, 22, 52, 21071 }, // ẽ
+    { 16, 26, 20, 3, 26, 71, 21123 }, // Ế
+    { 16, 22, 20, 3, 22, 62, 21194 }, // ế
+    { 18, 28, 19, -2, 28, 74, 21256 }, // Ề
+    { 16, 24, 18, -1, 24, 65, 21330 }, // ề
+    { 14, 29, 19, 3, 29, 70, 21395 }, // Ể
+    { 14, 26, 18, 3, 26, 63, 21465 }, // ể
+    { 13, 31, 19, 3, 31, 74, 21528 }, // Ễ
+    { 12, 27, 18, 3, 27, 66, 21602 }, // ễ
+    { 13, 34, 19, 3, 26, 72, 21668 }, // Ệ
+    { 12, 31, 18, 3, 22, 65, 21740 }, // ệ
+    { 5, 27, 11, 3, 27, 33, 21805 }, // Ỉ
+    { 5, 19, 10, 3, 19, 30, 21838 }, // ỉ
+    { 5, 27, 11, 3, 18, 33, 21868 }, // Ị
+    { 6, 28, 10, 2, 19, 41, 21901 }, // ị
+    { 18, 28, 24, 3, 18, 76, 21942 }, // Ọ
+    { 12, 20, 18, 3, 12, 44, 22018 }, // ọ
+    { 18, 27, 24, 3, 26, 74, 22062 }, // Ỏ
+    { 12, 20, 18, 3, 20, 45, 22136 }, // ỏ
+    { 19, 27, 24, 3, 26, 81, 22181 }, // Ố
+    { 15, 20, 19, 3, 20, 59, 22262 }, // ố
+    { 21, 28, 24, 0, 27, 88, 22321 }, // Ồ
+    { 17, 23, 18, -2, 23, 64, 22409 }, // ồ
+    { 18, 29, 24, 3, 28, 81, 22473 }, // Ổ
+    { 14, 23, 18, 3, 23, 59, 22554 }, // ổ
+    { 18, 31, 24, 3, 30, 90, 22613 }, // Ỗ
+    { 12, 24, 18, 3, 24, 65, 22703 }, // ỗ
+    { 18, 36, 24, 3, 26, 93, 22768 }, // Ộ
+    { 12, 29, 18, 3, 20, 62, 22861 }, // ộ
+    { 19, 26, 24, 3, 25, 78, 22923 }, // Ớ
+    { 14, 19, 18, 3, 19, 54, 23001 }, // ớ
+    { 19, 26, 24, 3, 25, 79, 23055 }, // Ờ
+    { 14, 19, 18, 3, 19, 51, 23134 }, // ờ
+    { 19, 27, 24, 3, 26, 79, 23185 }, // Ở
+    { 14, 20, 18, 3, 20, 51, 23264 }, // ở
+    { 19, 27, 24, 3, 26, 85, 23315 }, // Ỡ
+    { 14, 21, 18, 3, 21, 59, 23400 }, // ỡ
+    { 19, 30, 24, 3, 20, 84, 23459 }, // Ợ
+    { 14, 22, 18, 3, 14, 54, 23543 }, // ợ
+    { 16, 28, 22, 3, 18, 75, 23597 }, // Ụ
+    { 12, 22, 18, 3, 12, 45, 23672 }, // ụ
+    { 16, 28, 22, 3, 27, 72, 23717 }, // Ủ
+    { 12, 20, 18, 3, 20, 44, 23789 }, // ủ
+    { 18, 27, 22, 3, 26, 76, 23833 }, // Ứ
+    { 14, 19, 18, 3, 19, 52, 23909 }, // ứ
+    { 18, 27, 22, 3, 26, 75, 23961 }, // Ừ
+    { 14, 19, 18, 3, 19, 52, 24036 }, // ừ
+    { 18, 28, 22, 3, 27, 78, 24088 }, // Ử
+    { 14, 20, 18, 3, 20, 52, 24166 }, // ử
+    { 18, 28, 22, 3, 27, 82, 24218 }, // Ữ
+    { 14, 20, 18, 3, 20, 63, 24300 }, // ữ
+    { 18, 32, 22, 3, 22, 86, 24363 }, // Ự
+    { 14, 26, 18, 3, 16, 59, 24449 }, // ự
+    { 17, 27, 22, 3, 27, 62, 24508 }, // Ỳ
+    { 14, 27, 19, 3, 21, 59, 24570 }, // ỳ
+    { 17, 29, 22, 3, 18, 64, 24629 }, // Ỵ
+    { 15, 20, 19, 3, 12, 54, 24693 }, // ỵ
+    { 17, 28, 22, 3, 28, 61, 24747 }, // Ỷ
+    { 14, 29, 19, 3, 23, 58, 24808 }, // ỷ
+    { 17, 28, 22, 3, 28, 67, 24866 }, // Ỹ
+    { 14, 29, 19, 3, 23, 63, 24933 }, // ỹ
+    { 0, 0, 14, 0, 0, 0, 24996 }, //  
+    { 0, 0, 24, 0, 0, 0, 24996 }, //  
+    { 0, 0, 14, 0, 0, 0, 24996 }, //  
+    { 0, 0, 24, 0, 0, 0, 24996 }, //  
+    { 0, 0, 10, 0, 0, 0, 24996 }, //  
+    { 0, 0, 9, 0, 0, 0, 24996 }, //  
+    { 0, 0, 7, 0, 0, 0, 24996 }, //  
+    { 0, 0, 15, 0, 0, 0, 24996 }, //  
+    { 0, 0, 5, 0, 0, 0, 24996 }, //  
+    { 0, 0, 8, 0, 0, 0, 24996 }, //  
+    { 0, 0, 6, 0, 0, 0, 24996 }, //  
+    { 0, 0, 3, 0, 0, 0, 24996 }, // ​
+    { 0, 0, 1, 0, 0, 0, 24996 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 24996 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 24996 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 24996 }, // ‏
+    { 11, 3, 12, 0, 8, 10, 24996 }, // ‐
+    { 11, 3, 12, 0, 8, 10, 25006 }, // ‑
+    { 17, 3, 15, -3, 8, 15, 25016 }, // ‒
+    { 15, 5, 17, 1, 9, 10, 25031 }, // –
+    { 22, 5, 24, 1, 9, 13, 25041 }, // —
+    { 22, 5, 24, 1, 9, 13, 25054 }, // ―
+    { 10, 19, 13, 2, 15, 58, 25067 }, // ‖
+    { 18, 8, 16, -3, -1, 32, 25125 }, // ‗
+    { 7, 8, 9, 1, 19, 11, 25157 }, // ‘
+    { 7, 8, 9, 1, 19, 12, 25168 }, // ’
+    { 7, 8, 8, 0, 4, 12, 25180 }, // ‚
+    { 7, 8, 9, 1, 19, 11, 25192 }, // ‛
+    { 14, 8, 16, 1, 19, 22, 25203 }, // “
+    { 14, 8, 16, 1, 19, 24, 25225 }, // ”
+    { 7, 8, 8, 0, 4, 12, 25249 }, // „
+    { 14, 8, 16, 1, 19, 22, 25261 }, // ‟
+    { 13, 30, 17, 2, 22, 55, 25283 }, // †
+    { 13, 29, 18, 3, 21, 59, 25338 }, // ‡
+    { 17, 16, 15, -3, 19, 49, 25397 }, // •
+    { 7, 8, 13, 3, 10, 13, 25446 }, // ‣
+    { 6, 5, 13, 3, 5, 8, 25459 }, // ․
+    { 6, 5, 13, 3, 5, 8, 25467 }, // ‥
+    { 20, 5, 21, 0, 5, 24, 25475 }, // …
+    { 3, 3, 11, 4, 8, 4, 25499 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 25503 }, //  
+    { 16, 19, 24, 4, 17, 69, 25503 }, // ‰
+    { 8, 8, 12, 3, 19, 12, 25572 }, // ′
+    { 15, 8, 19, 3, 19, 23, 25584 }, // ″
+    { 17, 7, 19, 1, 18, 26, 25607 }, // ‴
+    { 6, 7, 9, 1, 18, 9, 25633 }, // ‵
+    { 10, 7, 11, 0, 18, 17, 25642 }, // ‶
+    { 17, 7, 14, -4, 18, 26, 25659 }, // ‷
+    { 12, 5, 14, 1, 18, 12, 25685 }, // ‸
+    { 7, 12, 9, 1, 12, 17, 25697 }, // ‹
+    { 7, 12, 9, 1, 12, 17, 25714 }, // ›
+    { 22, 28, 28, 4, 22, 99, 25731 }, // ※
+    { 6, 27, 13, 3, 24, 33, 25830 }, // ‼
+    { 13, 33, 18, 2, 28, 70, 25863 }, // ‽
+    { 11, 3, 12, 0, 18, 10, 25933 }, // ‾
+    { 11, 4, 12, 0, 14, 12, 25943 }, // ‿
+    { 15, 15, 15, -1, 19, 53, 25955 }, // ⁂
+    { 14, 18, 26, 6, 16, 38, 26008 }, // ⁄
+    { 26, 27, 31, 3, 24, 106, 26046 }, // ⁇
+    { 22, 28, 25, 2, 24, 92, 26152 }, // ⁈
+    { 17, 27, 17, -1, 24, 85, 26244 }, // ⁉
+    { 16, 36, 19, 2, 25, 86, 26329 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 26415 }, //  
+    { 7, 9, 8, 0, 18, 21, 26415 }, // ⁰
+    { 7, 8, 8, 0, 18, 16, 26436 }, // ⁴
+    { 7, 9, 8, 0, 18, 16, 26452 }, // ⁵
+    { 7, 9, 8, 0, 18, 18, 26468 }, // ⁶
+    { 7, 9, 8, 0, 18, 16, 26486 }, // ⁷
+    { 7, 9, 8, 0, 18, 21, 26502 }, // ⁸
+    { 7, 10, 8, 0, 18, 21, 26523 }, // ⁹
+    { 12, 13, 18, 3, 13, 33, 26544 }, // ⁿ
+    { 7, 9, 8, 0, 5, 23, 26577 }, // ₀
+    { 7, 9, 8, 0, 5, 17, 26600 }, // ₁
+    { 7, 9, 8, 0, 5, 17, 26617 }, // ₂
+    { 7, 9, 8, 0, 5, 16, 26634 }, // ₃
+    { 7, 8, 8, 0, 5, 14, 26650 }, // ₄
+    { 7, 9, 8, 0, 5, 13, 26664 }, // ₅
+    { 7, 9, 8, 0, 5, 20, 26677 }, // ₆
+    { 7, 10, 8, 0, 6, 15, 26697 }, // ₇
+    { 7, 9, 8, 0, 5, 23, 26712 }, // ₈
+    { 7, 9, 8, 0, 5, 21, 26735 }, // ₉
+    { 9, 29, 11, 1, 22, 44, 26756 }, // ₍
+    { 9, 29, 9, -1, 22, 45, 26800 }, // ₎
+    { 16, 27, 21, 2, 23, 91, 26845 }, // ₡
+    { 16, 19, 21, 2, 19, 54, 26936 }, // ₢
+    { 14, 19, 15, 0, 18, 45, 26990 }, // ₤
+    { 23, 18, 23, -1, 18, 71, 27035 }, // ₦
+    { 19, 18, 20, 0, 18, 53, 27106 }, // ₧
+    { 23, 19, 27, 2, 18, 83, 27159 }, // ₨
+    { 18, 18, 19, 0, 18, 59, 27242 }, // ₩
+    { 16, 16, 22, 3, 16, 63, 27301 }, // ₪
+    { 16, 18, 15, -2, 17, 49, 27364 }, // ₫
+    { 15, 20, 16, 0, 17, 52, 27413 }, // €
+    { 16, 18, 22, 3, 18, 53, 27465 }, // ₮
+    { 21, 18, 21, -1, 18, 54, 27518 }, // ₱
+    { 18, 27, 24, 3, 23, 84, 27572 }, // ₲
+    { 21, 18, 26, 4, 17, 70, 27656 }, // ₴
+    { 11, 17, 15, 3, 15, 37, 27726 }, // ₵
+    { 18, 19, 22, 2, 19, 42, 27763 }, // ₸
+    { 12, 17, 14, 1, 16, 38, 27805 }, // ₹
+    { 13, 16, 15, 1, 14, 46, 27843 }, // ₺
+    { 15, 17, 17, 1, 17, 53, 27889 }, // ₼
+    { 18, 18, 19, -2, 18, 56, 27942 }, // ₽
+    { 15, 14, 16, 0, 12, 34, 27998 }, // ←
+    { 16, 15, 17, 0, 14, 42, 28032 }, // ↑
+    { 14, 14, 16, 1, 12, 33, 28074 }, // →
+    { 16, 14, 17, 0, 13, 40, 28107 }, // ↓
+    { 17, 12, 21, 2, 12, 38, 28147 }, // ↔
+    { 13, 17, 17, 2, 19, 49, 28185 }, // ↕
+    { 12, 12, 16, 2, 12, 34, 28234 }, // ↖
+    { 13, 12, 14, 0, 12, 35, 28268 }, // ↗
+    { 13, 12, 14, 0, 12, 33, 28303 }, // ↘
+    { 12, 12, 14, 1, 12, 32, 28336 }, // ↙
+    { 16, 14, 20, 2, 13, 30, 28368 }, // ⇐
+    { 18, 17, 22, 2, 16, 65, 28398 }, // ⇑
+    { 16, 14, 20, 2, 13, 33, 28463 }, // ⇒
+    { 18, 17, 22, 2, 15, 58, 28496 }, // ⇓
+    { 19, 14, 23, 2, 13, 44, 28554 }, // ⇔
+    { 14, 18, 19, 2, 10, 49, 28598 }, // ⇕
+    { 13, 19, 15, 1, 18, 49, 28647 }, // ∂
+    { 21, 20, 24, 1, 19, 76, 28696 }, // ∅
+    { 16, 17, 18, 1, 16, 42, 28772 }, // ∆
+    { 14, 16, 16, 1, 15, 50, 28814 }, // ∏
+    { 14, 17, 16, 1, 16, 52, 28864 }, // ∐
+    { 11, 16, 13, 1, 15, 35, 28916 }, // ∑
+    { 12, 4, 13, 0, 8, 10, 28951 }, // −
+    { 18, 19, 20, 1, 18, 50, 28961 }, // √
+    { 17, 12, 19, 1, 14, 44, 29011 }, // ∞
+    { 17, 23, 18, 0, 17, 51, 29055 }, // ∫
+    { 6, 14, 7, 0, 14, 20, 29106 }, // ∶
+    { 12, 12, 30, 9, 12, 34, 29126 }, // ≈
+    { 16, 19, 26, 5, 17, 46, 29160 }, // ≠
+    { 18, 18, 18, -1, 16, 53, 29206 }, // ≤
+    { 18, 18, 19, 0, 16, 53, 29259 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
@@ -3344,4 +2576,5 @@ static const EpdFontData opendyslexic_10_bold = {
     28,
     -11,
     true,
+    true,
 };
@@ -2,3862 +2,2611 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_bolditalic
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_bolditalicBitmaps[50958] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA8, 0x00, 0x0B, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF4, 0x00, 0x3F, 0xF4, 0x00, 0x7F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xF0, 0xBF, 0xC2, 0xFF, 0x07, 0xFC, 0x1F, 0xF0, 0x3F,
-    0xC0, 0xFF, 0x03, 0xFD, 0x0F, 0xF0, 0x2F, 0xE0, 0xFF, 0x81, 0xFF, 0x0B, 0xFC, 0x00, 0x00, 0x02,
-    0xF0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x7E, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF4, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x7F, 0x40,
-    0x00, 0x00, 0x01, 0xFE, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x03, 0xFF, 0x4F, 0x80, 0x00, 0x1F, 0xE0, 0x3D, 0x00, 0x00, 0xBF, 0x01, 0xF0, 0x00, 0x03,
-    0xFF, 0x4B, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x90, 0x03, 0xFF, 0xF0,
-    0x0F, 0xF9, 0x5F, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x06, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x01, 0xF4,
-    0x00, 0x14, 0x00, 0x07, 0xD0, 0x01, 0xFF, 0x40, 0x0F, 0x80, 0x07, 0xC3, 0x80, 0x3F, 0x00, 0x0F,
-    0x03, 0xC0, 0xFC, 0x00, 0x0E, 0x03, 0x83, 0xF0, 0x00, 0x0E, 0x0F, 0x4B, 0xD0, 0x00, 0x0F, 0xFF,
-    0x2F, 0x40, 0x00, 0x0B, 0xFC, 0x7E, 0x00, 0x00, 0x01, 0x51, 0xF8, 0xBE, 0x00, 0x00, 0x03, 0xF3,
-    0xEB, 0x80, 0x00, 0x0F, 0xCB, 0x83, 0xC0, 0x00, 0x3F, 0x4F, 0x03, 0xC0, 0x00, 0xFD, 0x0F, 0x0B,
-    0x80, 0x02, 0xF8, 0x0F, 0xFF, 0x00, 0x0B, 0xE0, 0x0B, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0x50, 0x00,
-    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x1F, 0xEB, 0xD0, 0x00, 0x0F, 0x40,
-    0x7C, 0x00, 0x0B, 0x80, 0x0F, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0xBC, 0x1F, 0xD0, 0x00, 0x0F,
-    0xBF, 0xE0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF0, 0x0F, 0x82,
-    0xFC, 0x3F, 0x07, 0xE0, 0xFD, 0x03, 0xF7, 0xF0, 0x3F, 0x80, 0x3F, 0xF4, 0x1F, 0xFE, 0xBF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFB, 0x40, 0x06, 0xFE, 0x90, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0xFE, 0x0B, 0xF8, 0x1F, 0xF0, 0x3F, 0xC0, 0xFF, 0x42, 0xFE,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x24, 0x2E, 0x3D, 0x7C,
-    0x2F, 0xFF, 0xFF, 0x02, 0xFF, 0xFD, 0x00, 0x1F, 0xFD, 0x00, 0x7F, 0xFF, 0xF4, 0x3F, 0xFE, 0xFC,
-    0x0F, 0x2F, 0x1C, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x0F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x6A,
-    0xFF, 0xA8, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00,
-    0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x06, 0x90, 0xFD, 0x1F, 0xD3, 0xFC, 0x7F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xC0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0xFC, 0x02, 0xF0, 0x02, 0xF8, 0x42, 0xF0, 0x03, 0xF3, 0xF3,
-    0xF0, 0x07, 0xF7, 0xF3, 0xF0, 0x0B, 0xEB, 0xE7, 0xF0, 0x0F, 0xDB, 0xDB, 0xE0, 0x0F, 0xC3, 0x8F,
-    0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x2F, 0xE0, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x00, 0xAD,
-    0x00, 0x0B, 0xFD, 0x00, 0x2F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x22, 0xF4, 0x00, 0x03, 0xF0, 0x00,
-    0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0x80, 0x05, 0xBF, 0x95, 0x1F, 0xFF, 0xFD, 0x2F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x00, 0x06, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x79, 0x02, 0xFC, 0x00, 0x40, 0x01,
-    0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE5,
-    0x40, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x54,
-    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x29, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x7F, 0xFD, 0x00, 0x02,
-    0xBF, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x0E, 0x45, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFD, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xEF, 0x80, 0x00,
-    0xF9, 0xF8, 0x00, 0x3E, 0x3F, 0x40, 0x0F, 0xC3, 0xF0, 0x03, 0xF0, 0x7F, 0x00, 0xFF, 0xFF, 0xFE,
-    0x2F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0xA8, 0x00, 0xBF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0x40, 0x0F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x0F, 0xEA, 0x40, 0x00, 0x7F, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xC0, 0x05, 0x00, 0x7F, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0B, 0xF0, 0x0B, 0x95, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFD, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x40, 0x2F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0xDA, 0x90, 0x00,
-    0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8, 0x2F, 0xC0, 0x7F, 0x80, 0x3F, 0x02, 0xFC,
-    0x01, 0xFC, 0x0B, 0xE0, 0x0B, 0xE0, 0x2F, 0xD1, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0x80, 0x00, 0xBF, 0xE0, 0x00, 0x2A, 0xAA, 0xA5, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x03,
-    0xFE, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x7F, 0xFF,
-    0x80, 0x07, 0xF4, 0x3F, 0x00, 0x3F, 0x40, 0xBC, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x2F, 0xC0,
-    0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x40, 0x2F, 0xD0, 0xBF, 0x01, 0xFC,
-    0x00, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0x3F, 0xC0, 0xBF, 0x80, 0xFF, 0xFF, 0xFD, 0x02, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFD, 0x07, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x03, 0xD0, 0x02,
-    0xF0, 0x07, 0xC0, 0x03, 0xF0, 0x07, 0xC0, 0x07, 0xF0, 0x0B, 0xD0, 0x2F, 0xE0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0x40, 0x19, 0x01, 0xBF,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x2F, 0xC0, 0x0F, 0xF0, 0x0B, 0xFC, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0xFF, 0x00, 0xBF, 0x80, 0x3F, 0xD0, 0x1F, 0xF4,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x2F, 0xF0, 0x00,
-    0xFF, 0x80, 0x03, 0xFC, 0x00, 0x2F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x6A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x6F, 0xFF,
-    0xFF, 0x40, 0x00, 0x1B, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x56, 0xAB, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xF4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xAF, 0xFF, 0x02, 0xFF, 0xFF, 0xC1, 0xFF, 0xFA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01,
-    0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x01, 0xBF, 0xFF, 0x00,
-    0x6F, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xF9, 0x00, 0xFF, 0xFE, 0x40, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x2F, 0xFF,
-    0x80, 0x01, 0xFF, 0xFF, 0xE0, 0x02, 0xFD, 0x07, 0xF0, 0x00, 0xD0, 0x02, 0xF4, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2A, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xE4, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x02, 0xFE, 0x01, 0xF8, 0x00, 0x02, 0xF8, 0x00, 0x0F, 0x00, 0x02, 0xF4, 0x00, 0x01,
-    0xD0, 0x02, 0xF0, 0xBB, 0x80, 0x34, 0x00, 0xF4, 0xF7, 0xD0, 0x0E, 0x00, 0xFC, 0xB0, 0x70, 0x07,
-    0x40, 0x3E, 0x34, 0x1C, 0x03, 0xC0, 0x1F, 0x4C, 0x1F, 0x02, 0xE0, 0x0B, 0xD3, 0xFF, 0xC3, 0xF0,
-    0x02, 0xF8, 0xBE, 0xFF, 0xF0, 0x00, 0xBF, 0x00, 0x07, 0xD0, 0x00, 0x1F, 0xF4, 0x00, 0x50, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07, 0xF7, 0xF0,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE,
-    0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00,
-    0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07,
-    0xFA, 0xBF, 0xE0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x40, 0x1F, 0x40,
-    0x1F, 0xC0, 0x2F, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC, 0x07, 0xFA, 0xAB,
-    0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xD0,
-    0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x16, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xAA, 0x90, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xF4, 0x00, 0x50, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0A, 0x94,
-    0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x87, 0xFC, 0x00, 0xFF, 0xFD, 0x2F, 0xF0, 0x01, 0x6F, 0xF4, 0xBF,
-    0xC0, 0x00, 0xBE, 0x01, 0xFF, 0xE5, 0x5F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-    0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01,
-    0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF,
-    0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4,
-    0x00, 0x7F, 0x00, 0x0B, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xD0,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x18, 0x0B, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF8, 0x2F, 0xE0, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00,
-    0x03, 0xF4, 0xFF, 0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB,
-    0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x00, 0xFE, 0x7F, 0xF8, 0x00, 0x0B, 0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF,
-    0xF4, 0x01, 0xFF, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x3F,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFC,
-    0x03, 0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0x4F, 0xFF, 0xD0, 0x02, 0xFE, 0xFD, 0xBF, 0xBF, 0x00, 0x0F, 0xEB, 0xFF, 0xFB, 0xFC, 0x00,
-    0x3F, 0x6F, 0xFF, 0xDF, 0xE0, 0x02, 0xFD, 0x7F, 0xFD, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0xF3, 0xFD,
-    0x00, 0x3F, 0xC7, 0xFF, 0x5F, 0xF0, 0x01, 0xFE, 0x0F, 0xFC, 0xBF, 0xC0, 0x0B, 0xF8, 0x3F, 0xC3,
-    0xFE, 0x00, 0x3F, 0xD0, 0xFE, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x7F,
-    0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x07, 0xFF,
-    0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xBF, 0x0F, 0xD0, 0x00, 0xBF, 0xAF,
-    0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F, 0xF0, 0xFD, 0xFD, 0x00, 0x0B, 0xFC, 0x3F,
-    0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0xBF,
-    0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80,
-    0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00,
-    0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00,
-    0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBE,
-    0x01, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x1F, 0xF0, 0x03,
-    0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x1F, 0xFA, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xF4, 0x1F, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xF8, 0x02, 0xFE, 0x00, 0x03,
-    0xFC, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x0B, 0xF4, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x00, 0x03, 0xF8,
-    0x0F, 0xE0, 0x00, 0x07, 0xF4, 0x1F, 0xD0, 0x00, 0x0B, 0xF0, 0x1F, 0xD0, 0x14, 0x0F, 0xE0, 0x1F,
-    0xE0, 0x3F, 0xBF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x0B, 0xFF, 0xD0,
-    0x00, 0x03, 0xFF, 0xFF, 0x00, 0x01, 0xF9, 0x5B, 0xD0, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x3F, 0x00,
-    0x3E, 0x00, 0x1F, 0x80, 0x2F, 0x40, 0x0B, 0xD0, 0x0F, 0xC0, 0x03, 0xF5, 0x6F, 0xE0, 0x01, 0xFF,
-    0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xF4, 0x3F, 0x40, 0x0B,
-    0xF8, 0x0F, 0xE0, 0x03, 0xFD, 0x03, 0xF8, 0x01, 0xFF, 0x02, 0xFF, 0x00, 0xBF, 0xC0, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x3F, 0xF0, 0x0A, 0xA4, 0x1A, 0xA8, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x0F,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x10, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x0E, 0x40, 0x07, 0xFC, 0x03, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x1B, 0xFF, 0xE4, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00,
-    0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00,
-    0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B,
-    0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F,
-    0xC0, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0xCB,
-    0xF0, 0x00, 0x07, 0xF4, 0xBF, 0x00, 0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0xBF, 0x40, 0x0B,
-    0xF8, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xD0, 0x07, 0xFC, 0x0B, 0xFC, 0x00, 0x7F,
-    0xC1, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xE0, 0x00, 0x3F, 0xDB, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0x40,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1A, 0x90, 0x00, 0x00,
-    0x00, 0xAA, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF,
-    0x40, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x03, 0xF0, 0x0B,
-    0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x42, 0xFF, 0x42, 0xFE, 0x00, 0x3F, 0xC1,
-    0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xF0, 0xFF, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xFF, 0xFF, 0x3F, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xEF, 0xE0, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE3,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xF0, 0x2F, 0xFD, 0x00, 0x00,
-    0xBF, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x1F, 0xFC, 0x00,
-    0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0xA9, 0x00,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x3F, 0xEA, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xC0, 0xB0, 0x3C, 0x1F, 0x47, 0xD1,
-    0xF4, 0x7E, 0x1F, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFD, 0x3F, 0x4F, 0xD3, 0xF8, 0xFD,
-    0x3E, 0x0F, 0x03, 0x00, 0x40, 0x6A, 0xA0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xAB,
-    0xF8, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x2F, 0x9F, 0xD0,
-    0x7D, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xF4, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F,
-    0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80, 0x0F, 0xC0, 0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF,
-    0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x7F, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFD, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFD, 0x0B, 0xFD, 0x0B, 0xC2, 0xFC, 0x01,
-    0xF0, 0xFE, 0x00, 0xBC, 0x3F, 0x00, 0x3E, 0x1F, 0xC0, 0x3F, 0x47, 0xFE, 0xBF, 0xC2, 0xFF, 0xFF,
-    0xE0, 0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xD0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00,
-    0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x06,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xBE, 0x6F, 0x40,
-    0x02, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xF8, 0x1F, 0xF4, 0x00, 0xF8, 0x03, 0xFC,
-    0x00, 0xBC, 0x00, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0x40, 0x0F, 0xC0, 0x7F, 0xC0, 0x03, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0x6F, 0x40, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF,
-    0x82, 0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFD, 0x00,
-    0x2F, 0xE8, 0x00, 0x3F, 0x00, 0x00, 0x7D, 0x00, 0x07, 0xFF, 0xF8, 0x0B, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xF0, 0x02, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xBE, 0x3F,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF4, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0xB8, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x3F, 0xC0, 0x03, 0xE0,
-    0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x90, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xEB, 0xF0, 0x0B,
-    0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x01, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0, 0x3F, 0x80,
-    0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF, 0x01, 0xBE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x1A, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00,
-    0xBC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00,
-    0xBF, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0x90, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF2, 0xFC, 0x01, 0xFA, 0xFC, 0x00, 0xBF, 0xF8, 0x00, 0x3F,
-    0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0xFF, 0x40, 0x03, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0xBF,
-    0x7F, 0xF0, 0x3F, 0x8F, 0xFE, 0x1F, 0xD1, 0xFF, 0xD0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x2F,
-    0x40, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x02, 0xF4, 0x00,
-    0x3F, 0x00, 0x07, 0xF0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xFF,
-    0x80, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0xF8, 0x1F,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0x80, 0x0B, 0xFE, 0xBF, 0xFA, 0xFC, 0x00, 0xFF, 0x02, 0xFD,
-    0x07, 0xD0, 0x2F, 0xC0, 0x3F, 0xC0, 0xBD, 0x03, 0xF8, 0x03, 0xF4, 0x0F, 0xC0, 0x7F, 0x40, 0xBF,
-    0x00, 0xFC, 0x0B, 0xF0, 0x0F, 0xD0, 0x2F, 0xC0, 0xFE, 0x02, 0xFC, 0x03, 0xF8, 0x1F, 0xC0, 0x3F,
-    0x80, 0x7F, 0x43, 0xFC, 0x07, 0xF0, 0x0B, 0xF0, 0x7F, 0x40, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFB, 0xF8, 0x02, 0xFD, 0x03,
-    0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0,
-    0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x40, 0x00,
-    0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F,
-    0xC2, 0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x0F,
-    0xEF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0xF0, 0x00, 0x07, 0xFC, 0x02,
-    0xD0, 0x00, 0x2F, 0xD0, 0x0B, 0x40, 0x00, 0xFF, 0x00, 0x3D, 0x00, 0x03, 0xF8, 0x00, 0xF0, 0x00,
-    0x1F, 0xE0, 0x0B, 0xC0, 0x00, 0xFF, 0xE6, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF0, 0x64, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x8F, 0xC0, 0x0F, 0xFF, 0xBF, 0x00,
-    0xFE, 0x7F, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0x3D, 0x00, 0xFE, 0x02, 0xF0, 0x03, 0xF4, 0x0F, 0x40,
-    0x1F, 0xC0, 0x3D, 0x00, 0xBE, 0x00, 0xF8, 0x0B, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE,
-    0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x1B, 0xD7, 0xEF, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x0B, 0xFE, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBF, 0x00,
-    0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x04, 0x00, 0x7C,
-    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xC0,
-    0x3E, 0x5B, 0xFC, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0xBF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x1A, 0xFE, 0xA8, 0x07, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00,
-    0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00, 0xBD, 0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80,
-    0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F, 0x40, 0x7F, 0x42, 0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03,
-    0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xEF, 0xC0, 0x3F, 0x00, 0x02, 0xF8, 0xFD, 0x00,
-    0x1F, 0xC3, 0xF8, 0x00, 0xFC, 0x0B, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0xBE, 0x00, 0x3F, 0x47, 0xF0,
-    0x00, 0xFE, 0x3F, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x2F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x02, 0xF8,
-    0x7F, 0x01, 0x40, 0x3F, 0x07, 0xF0, 0x7E, 0x0F, 0xE0, 0x7F, 0x0F, 0xF1, 0xFC, 0x07, 0xF3, 0xFF,
-    0x7F, 0x80, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xBF, 0xF4, 0x00, 0x7F, 0xE3, 0xFF, 0x00, 0x07, 0xFC, 0x3F, 0xD0, 0x00, 0x2A, 0x01, 0xA8,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xE0, 0x00, 0x0F, 0xF3, 0xF8, 0x00,
-    0x00, 0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xBF, 0xC0, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x0B,
-    0xF8, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x1F,
-    0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x0F, 0xE2,
-    0xF4, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF,
-    0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xBF, 0xF4, 0x00, 0x1F, 0xFA, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x3D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03,
-    0xD0, 0x01, 0xF0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xE0, 0x00, 0xF4,
-    0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0x50, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0xE1, 0xE3, 0xFD, 0xB1, 0xF3, 0xFC, 0x74, 0x68, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xC0, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0E,
-    0x00, 0x02, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x3F,
-    0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F,
-    0xC0, 0x00, 0x3C, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x1B, 0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xEC,
-    0x0B, 0xEB, 0x40, 0x0F, 0xCB, 0x00, 0x2F, 0x8F, 0x00, 0x3F, 0x4E, 0x00, 0x3F, 0x1D, 0x00, 0x3F,
-    0x6E, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x06, 0xFF, 0x80, 0x00, 0x74, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF9, 0xBF, 0x00, 0x03, 0xE0, 0x05,
-    0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0xB0, 0x0B, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xBF, 0xC0, 0x07,
-    0xF0, 0x7E, 0x00, 0x2F, 0x41, 0xF8, 0x00, 0xBE, 0x1F, 0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-    0xFD, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xD6, 0x9F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x01, 0x50, 0x00,
-    0x05, 0x40, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x0B, 0xF4, 0xBF, 0x80, 0x00,
-    0x7F, 0xEF, 0xE0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x0A, 0xBF, 0xFA, 0x40, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x06, 0xAF, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x2E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF4, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x0B, 0x80, 0x0F, 0x40, 0x0F, 0x00, 0x1E,
-    0x00, 0x2D, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x03, 0xC0, 0x10, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xF0, 0x01, 0xF8, 0x02, 0xF0, 0x03, 0xE0, 0x00,
-    0xF0, 0x03, 0xFE, 0xAF, 0xE0, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x02, 0xFD,
-    0x00, 0x04, 0x00, 0xBD, 0x00, 0x1F, 0xD6, 0xFC, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x2F, 0xFE, 0x40,
-    0x00, 0x07, 0xF0, 0xBE, 0x0F, 0xF0, 0xFD, 0x0F, 0xE2, 0xFD, 0x2F, 0xE3, 0xFC, 0x2A, 0x82, 0xA8,
-    0x00, 0xBE, 0x00, 0x1F, 0xFF, 0x01, 0xF4, 0x2D, 0x0F, 0xBC, 0x38, 0x7F, 0x00, 0xE1, 0xEF, 0x4F,
-    0x03, 0xC0, 0xF8, 0x0B, 0xFF, 0x80, 0x0B, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x0E, 0x7C, 0x1C,
-    0x2C, 0x34, 0x3C, 0x3F, 0xF8, 0x1F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x02,
-    0xD0, 0x1E, 0x00, 0x3F, 0x03, 0xF0, 0x0B, 0xF0, 0x7F, 0x00, 0xFD, 0x0F, 0xE0, 0x0B, 0xF0, 0x7F,
-    0x00, 0x1F, 0xE1, 0xFE, 0x00, 0x2F, 0xD2, 0xFD, 0x00, 0x3F, 0x43, 0xF4, 0x00, 0x3C, 0x03, 0xC0,
-    0x00, 0x50, 0x05, 0x00, 0x3F, 0xA9, 0x50, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0x07, 0xF8,
-    0x00, 0x03, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F,
-    0xFF, 0xFC, 0xBF, 0xFF, 0xFC, 0x00, 0x1A, 0x40, 0x0B, 0xFF, 0x80, 0xBF, 0x4F, 0x03, 0xF2, 0x1D,
-    0x2E, 0xFC, 0x74, 0xBE, 0x93, 0xC2, 0xF6, 0xFD, 0x03, 0xFF, 0xD0, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xFF, 0xD0, 0x07, 0xFF,
-    0xF0, 0x0F, 0xD1, 0xF4, 0x1F, 0x41, 0xF4, 0x2F, 0x87, 0xF0, 0x2F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x58, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x0A, 0x7C, 0x00, 0x2C, 0x00, 0x74, 0x02, 0xE0,
-    0x1F, 0x80, 0x3F, 0xF0, 0x2A, 0x90, 0x07, 0xF4, 0x05, 0x2C, 0x00, 0x2C, 0x07, 0xF0, 0x01, 0xB0,
-    0x00, 0xB0, 0x3F, 0xF0, 0x3F, 0x80, 0x01, 0xF0, 0x0F, 0x40, 0xBC, 0x0B, 0xC0, 0x15, 0x00, 0x00,
-    0x1F, 0xC0, 0x1F, 0x80, 0x0B, 0xD0, 0x0B, 0xD0, 0x02, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x01, 0xFC,
-    0x00, 0x7E, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x3F, 0x80, 0x0F, 0xD0, 0x1F, 0xD0, 0x07, 0xF0, 0x0F,
-    0xF0, 0x03, 0xFF, 0x9F, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x3D, 0xBF,
-    0xEF, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x3E, 0x00, 0x1F, 0xFC, 0x7D, 0x00, 0x7F, 0xFC, 0xBC, 0x00, 0xFF, 0xF8, 0xFC, 0x00,
-    0xFF, 0xF0, 0xF8, 0x00, 0xFF, 0xF1, 0xF4, 0x00, 0xBF, 0xE2, 0xF0, 0x00, 0x3F, 0xC3, 0xF0, 0x00,
-    0x3F, 0xC3, 0xE0, 0x00, 0x7F, 0x47, 0xD0, 0x00, 0xFF, 0x0B, 0xC0, 0x01, 0xFF, 0x0F, 0xC0, 0x03,
-    0xFD, 0x0F, 0x80, 0x03, 0xFC, 0x1F, 0x40, 0x0B, 0xFC, 0x2F, 0x00, 0x0F, 0xF4, 0x3F, 0x00, 0x2F,
-    0xF0, 0x3E, 0x00, 0x3F, 0xE0, 0x3D, 0x00, 0x07, 0xF0, 0x3F, 0xC0, 0xFE, 0x0B, 0xF8, 0x2A, 0x80,
-    0x02, 0x80, 0x1E, 0x00, 0xFD, 0x07, 0xBC, 0x01, 0xF0, 0xFF, 0x83, 0xF4, 0x00, 0x01, 0xE0, 0x3D,
-    0x01, 0xC0, 0x2C, 0x03, 0x80, 0x74, 0x3F, 0xE2, 0xA9, 0x02, 0xF8, 0x0F, 0x6D, 0x1C, 0x1D, 0x2C,
-    0x3C, 0x2F, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x14, 0x00, 0x07, 0x80,
-    0x38, 0x00, 0x0F, 0xD0, 0xFD, 0x00, 0x0B, 0xE0, 0xBE, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x0B, 0xF0,
-    0xBF, 0x00, 0x7F, 0x87, 0xF8, 0x03, 0xFC, 0x3F, 0xC0, 0x0F, 0xC0, 0xFC, 0x00, 0x2D, 0x02, 0xD0,
-    0x00, 0x20, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x14, 0x03,
-    0xF8, 0x00, 0x00, 0x1F, 0x40, 0x0B, 0x40, 0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x1F, 0x00, 0x00, 0x3F, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3D, 0x00, 0x02, 0xF0, 0x00,
-    0x17, 0xD4, 0x00, 0xBD, 0x05, 0x0B, 0xFF, 0xC0, 0x1F, 0x82, 0xE0, 0xFF, 0xFC, 0x07, 0xE0, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x0B, 0x7C, 0x00, 0x00, 0x0F, 0xD2, 0xC7,
-    0xC0, 0x00, 0x03, 0xF4, 0xB9, 0xFD, 0x00, 0x00, 0xBE, 0x1F, 0xFF, 0xE0, 0x00, 0x2F, 0x80, 0x56,
-    0xF8, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x2A, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0xF8, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x07,
-    0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xD0, 0x00,
-    0x17, 0xD4, 0x00, 0x7D, 0x6F, 0x82, 0xFF, 0xF0, 0x07, 0xE3, 0xFF, 0xCF, 0xFF, 0xC0, 0x7E, 0x1D,
-    0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x1F, 0x80, 0x00, 0x3F, 0x40, 0x02, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x7F, 0xC0, 0x00, 0x2F,
-    0x80, 0x0B, 0xFD, 0x40, 0x02, 0xFC, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xC0, 0x02, 0xFF, 0xFC, 0x00,
-    0x54, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xBC, 0x00, 0x00, 0x64,
-    0x00, 0x02, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x07, 0xD0, 0x02, 0xFF, 0x00, 0x01, 0xF4,
-    0x00, 0x3F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x80, 0x01, 0x41, 0xF0, 0x03, 0xF0,
-    0x00, 0x3F, 0xFF, 0x00, 0xFC, 0x0E, 0x0B, 0xFF, 0xC0, 0x3F, 0x03, 0xE0, 0x6B, 0x90, 0x0F, 0xC0,
-    0xFD, 0x00, 0x00, 0x02, 0xF4, 0x37, 0xC0, 0x00, 0x00, 0xBD, 0x0D, 0x3C, 0x00, 0x00, 0x2F, 0x83,
-    0x8B, 0x80, 0x00, 0x0B, 0xE0, 0xFF, 0xFE, 0x00, 0x01, 0xFC, 0x1F, 0xFF, 0xD0, 0x00, 0x7F, 0x00,
-    0x02, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0x80, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80,
-    0x01, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x0F, 0xFB, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F,
-    0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00,
-    0xFD, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x03, 0xF8, 0x0F,
-    0xD0, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x01, 0xFE, 0x00,
-    0x03, 0xFD, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00,
-    0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0x2F, 0xE7, 0x80, 0x00, 0x00, 0xF3,
-    0xFD, 0x00, 0x00, 0x03, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xFC,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00,
-    0xBF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4,
-    0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x2F, 0xC0,
-    0x00, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0xC7, 0xFC, 0x00, 0x00, 0x1A, 0xA1, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
-    0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00,
-    0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x0B,
-    0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80,
-    0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00,
-    0x00, 0x7F, 0x7F, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x3F, 0x03,
-    0xF4, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xF0, 0x00, 0x3F,
-    0xC1, 0xFE, 0x00, 0x03, 0xFD, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xBF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFD, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0xAA, 0x80, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x17, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xAF, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0x00, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x01,
-    0xFC, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x7F, 0xCB, 0xF8, 0x00, 0x01, 0xA9, 0x2A,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA,
-    0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x01,
-    0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0xC0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF4, 0x00, 0x0B, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x03, 0xF4,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x00, 0x07, 0xF8, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xFD, 0x00, 0x0F, 0xDB, 0xE0, 0x0B, 0xD0, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x0F, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xD0, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x1A, 0x42, 0xA0, 0x00, 0xFD, 0x1F, 0xC0, 0x07, 0xF4, 0xFF, 0x00,
-    0x3F, 0xC3, 0xFC, 0x01, 0xFF, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00, 0x0F, 0xD0, 0x02,
-    0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0x00, 0x7F, 0x05, 0x7F,
-    0xE5, 0x40, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0xDB, 0x80, 0x00, 0x00, 0x0F, 0x3F, 0xC0, 0x00, 0x00,
-    0x07, 0x8B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x40, 0x01, 0xFF,
-    0x80, 0x1F, 0xC0, 0x00, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF,
-    0x41, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFE, 0xFC, 0x3F, 0x40, 0x02, 0xFE, 0xBF,
-    0x1F, 0xC0, 0x00, 0xFF, 0x5F, 0xCB, 0xF0, 0x00, 0x3F, 0xC3, 0xF7, 0xF4, 0x00, 0x2F, 0xF0, 0xFF,
-    0xFC, 0x00, 0x0F, 0xF8, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0x42, 0xFF,
-    0xC0, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x80, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x02,
-    0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0x40, 0x00, 0x0F,
-    0xE0, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x02, 0xFF, 0x90, 0x5F, 0xFE,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0,
-    0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00,
-    0xFD, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x0B,
-    0xFE, 0x41, 0x7F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00,
-    0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD,
-    0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00,
-    0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00,
-    0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x38, 0x00, 0x00, 0x00, 0xBF, 0x9E, 0x00, 0x00, 0x00, 0x3C,
-    0xFF, 0x40, 0x00, 0x00, 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02,
-    0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F,
-    0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF,
-    0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0xBF,
-    0x00, 0x00, 0x02, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xFF, 0x1F, 0xE0, 0x00, 0x00, 0x6A, 0x86, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00,
-    0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00,
-    0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07,
-    0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFC, 0x2F, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xF4,
-    0x00, 0x7F, 0xFF, 0xD0, 0x2F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFD, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0xBF, 0xCB, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0xBF,
-    0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0xBF, 0xC0, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD5, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F,
-    0xD0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFD,
-    0x00, 0x2F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x0B, 0xFC, 0x00, 0x3F, 0xD0, 0x03,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xFC, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x2F,
-    0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x01, 0xFF,
-    0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0,
-    0x00, 0x7F, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFA, 0xFC, 0x00,
-    0x00, 0x01, 0xF4, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80,
-    0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00,
-    0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x02,
-    0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F,
-    0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x69, 0x00, 0x00,
-    0x02, 0xF8, 0x3F, 0x40, 0x00, 0x00, 0xFE, 0x2F, 0xC0, 0x00, 0x00, 0xBF, 0x4F, 0xF0, 0x00, 0x00,
-    0x3F, 0xD7, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE,
-    0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80,
-    0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x3F, 0xF0, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xF9,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0x0B, 0xE0, 0x1F, 0x00, 0xFC, 0x0B, 0xC0,
-    0xBE, 0x03, 0xE0, 0xBF, 0x00, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0x00, 0x2F, 0xFD, 0x00, 0x0F, 0x80,
-    0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xD0, 0xBC, 0x00, 0x3F, 0x40, 0xBC,
-    0x00, 0x3E, 0x0B, 0xFC, 0x00, 0xBD, 0x2F, 0xE4, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0xFC, 0x7C, 0x00,
-    0x02, 0xFC, 0x7E, 0x00, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF4, 0x2F, 0xE0, 0x07, 0xF0, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x03, 0xF0, 0x0F, 0xFE, 0xAF, 0xE0, 0x1F, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40,
-    0x15, 0x5B, 0xF8, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E,
-    0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80,
-    0x0F, 0xC0, 0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xF0, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE, 0xBF, 0xD0, 0x0B, 0xC0, 0x3F, 0x00, 0x7D, 0x00, 0xFC, 0x02,
-    0xE0, 0x03, 0xF0, 0x0F, 0x00, 0x0F, 0xC0, 0x3C, 0x00, 0xBE, 0x01, 0xFF, 0xFF, 0xF4, 0x03, 0xFF,
-    0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFA, 0xFF, 0x40,
-    0x2F, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0, 0x0B, 0x80, 0x0F, 0xC0, 0x3C, 0x00, 0x3F, 0x00, 0xF0,
-    0x02, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0xB8, 0x24, 0x00, 0x0B, 0xF6, 0xE0, 0x00, 0x3C, 0xFF, 0x00, 0x01, 0xE2,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8,
-    0x00, 0x3F, 0xFF, 0xE0, 0x03, 0xFA, 0xFF, 0x40, 0x2F, 0x00, 0xFC, 0x01, 0xF4, 0x03, 0xF0, 0x0B,
-    0x80, 0x0F, 0xC0, 0x3C, 0x00, 0x3F, 0x00, 0xF0, 0x02, 0xF8, 0x07, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFC, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x01, 0xA0, 0x2A, 0x00, 0x00,
-    0xFC, 0x2F, 0xC0, 0x00, 0xBF, 0x0F, 0xF0, 0x00, 0x3F, 0xC7, 0xF8, 0x00, 0x2F, 0xF3, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0,
-    0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F,
-    0xC0, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF,
-    0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7A, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x03,
-    0xFF, 0xFE, 0x00, 0xFE, 0xBF, 0xD0, 0x2F, 0x00, 0xFC, 0x07, 0xD0, 0x0F, 0xC0, 0xB8, 0x00, 0xFC,
-    0x0F, 0x00, 0x0F, 0xC0, 0xF0, 0x02, 0xF8, 0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xFF, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0x8B, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xAF, 0xFF, 0xD1, 0xF8, 0x02, 0xF0, 0x0F, 0xFD,
-    0x5A, 0xF0, 0x1F, 0x40, 0x3F, 0xFF, 0xFF, 0xC0, 0xB8, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x03,
-    0xF5, 0x50, 0x00, 0x0F, 0x00, 0x2F, 0xD0, 0x00, 0x40, 0x7F, 0xFF, 0xFF, 0xF9, 0xAF, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x02, 0xFE, 0x7F, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0xBF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xD0, 0x07, 0xFF, 0x80, 0x00, 0xF8, 0x00, 0x02, 0xBD, 0x00, 0x00, 0x3D, 0x00,
-    0x07, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFD,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x2F, 0x91, 0xF4,
-    0x0B, 0xE5, 0x6F, 0x80, 0xFF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFF, 0x83, 0xF5, 0x50, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0x91, 0xF4, 0x02, 0xF9, 0x5B, 0xE0, 0x0F, 0xFF, 0xFF, 0x80,
-    0xBF, 0xFF, 0xFE, 0x03, 0xF5, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0xFF,
-    0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x1F, 0xDF, 0xD0, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00,
-    0x0B, 0xFF, 0xF0, 0x00, 0xBE, 0x47, 0xD0, 0x0B, 0xE5, 0x6F, 0x80, 0x3F, 0xFF, 0xFE, 0x02, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xD5, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xB8, 0x03, 0xFF, 0xFF,
-    0xD0, 0x03, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xA0, 0x29, 0x00, 0x07, 0xF0,
-    0xFE, 0x00, 0x0F, 0xF0, 0xFE, 0x00, 0x1F, 0xE2, 0xFD, 0x00, 0x3F, 0xE3, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x0B, 0xE5, 0x6F,
-    0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0x55, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x03, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x40, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07,
-    0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x03, 0xD0, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x3F, 0x00, 0x00,
-    0xF8, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x02, 0xFD, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xD7, 0xF0, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF0, 0xBC, 0x03, 0xF0, 0xFC, 0x0B, 0xF2, 0xFC, 0x0F, 0xF3, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00,
-    0x15, 0xBE, 0x54, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x2F, 0xE1, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x00, 0x0F, 0xD0, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x41, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x2F,
-    0x0F, 0x00, 0x00, 0xBF, 0x9E, 0x00, 0x00, 0xF3, 0xFC, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x40, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xEF, 0xE0, 0x02, 0xFD, 0x03, 0xF0, 0x03, 0xF4, 0x03, 0xE0, 0x03, 0xF0, 0x07,
-    0xE0, 0x0B, 0xE0, 0x0B, 0xD0, 0x0F, 0xD0, 0x0F, 0xC0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0x80, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x1A, 0x80, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2,
-    0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B,
-    0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x00, 0xFC,
-    0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x0B, 0xFF, 0x40, 0x01, 0xFD, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xEB, 0xF8, 0x0B, 0xF0, 0x0F, 0xC0, 0xFC, 0x00, 0xFC, 0x2F,
-    0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF8, 0x3F, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0E, 0x00,
-    0x0B, 0xF9, 0xE0, 0x00, 0xF3, 0xFC, 0x00, 0x1F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xEB, 0xF8, 0x0B, 0xF0, 0x0F, 0xC0, 0xFC,
-    0x00, 0xFC, 0x2F, 0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF8, 0x3F, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00,
-    0x1F, 0xC2, 0xFC, 0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x6A, 0x4A, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03,
-    0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F,
-    0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x5A, 0xAA, 0xFD, 0x0B, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1A, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xF8,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xF2, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xE7, 0xF3, 0xF0, 0x00, 0x00,
-    0x0F, 0xDF, 0xCB, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00,
-    0xBD, 0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F,
-    0x40, 0x7F, 0x42, 0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD,
-    0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00, 0xBD, 0x0B, 0xC0,
-    0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F, 0x40, 0x7F, 0x42,
-    0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00, 0xBF, 0xEF,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xDF, 0xD0, 0x03,
-    0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x0B, 0xC0, 0x0B,
-    0xD0, 0xBC, 0x00, 0xFC, 0x0F, 0xC0, 0x1F, 0xC0, 0xF8, 0x02, 0xF8, 0x1F, 0x40, 0x3F, 0x82, 0xF4,
-    0x07, 0xF4, 0x2F, 0x00, 0xFF, 0x03, 0xFE, 0x7F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x06, 0x80, 0xA8, 0x00, 0x0F, 0xC2, 0xFC, 0x00, 0x2F, 0xC3, 0xFC,
-    0x00, 0x3F, 0xC7, 0xF8, 0x00, 0xBF, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xC0, 0x0F, 0xC0,
-    0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F, 0x80, 0x2F, 0x40, 0x7F, 0x40,
-    0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFD, 0x00,
-    0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x7F, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0xFC,
-    0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0xFD, 0xBF,
-    0x00, 0x0F, 0xC2, 0xF8, 0x01, 0xF8, 0x0F, 0x80, 0x2F, 0x40, 0xF8, 0x03, 0xF0, 0x2F, 0x00, 0x3F,
-    0x07, 0xE0, 0x07, 0xE1, 0xFC, 0x00, 0xBE, 0xFF, 0x40, 0x0F, 0xFF, 0xD0, 0x00, 0xFF, 0xE0, 0x00,
-    0x1F, 0xD0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0B, 0xF0, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00,
-    0xFF, 0x1F, 0xD0, 0x00, 0x2F, 0xE3, 0xFD, 0x00, 0x01, 0xA9, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xE0, 0x00, 0xBF, 0x00, 0xFC, 0x00,
-    0x07, 0xF0, 0x2F, 0x80, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0x3F, 0xDF,
-    0xC0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x2B, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x00, 0x00, 0x2F, 0x83,
-    0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x0B, 0xF0, 0x0F,
-    0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x00, 0xFF,
-    0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7E, 0xAA, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xE0,
-    0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00,
-    0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00,
-    0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F,
-    0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xE0, 0x03, 0xF0,
-    0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF,
-    0x00, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00,
-    0x03, 0xFC, 0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7E, 0x00, 0x3F, 0xFF,
-    0xE0, 0x0F, 0xEB, 0xFD, 0x02, 0xF0, 0x0F, 0xC0, 0x7D, 0x00, 0xFC, 0x0B, 0x80, 0x0F, 0xC0, 0xF0,
-    0x00, 0xFC, 0x0F, 0x00, 0x2F, 0x81, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFE, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x7C,
-    0x00, 0x01, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0xFF, 0xFC, 0x03, 0xFF, 0xAC, 0x0B, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xD0, 0x06, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00,
-    0x03, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x5F, 0xC0, 0x00, 0x02, 0xF0, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x80,
-    0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x2F,
-    0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x06, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xDF, 0xD0,
-    0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x0F, 0xFE, 0xB0, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x80, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x7F, 0xFF, 0x40, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xAA, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x00, 0x00, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x02, 0xFF,
-    0xD0, 0x1B, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xAC, 0x02, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8, 0x20, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-    0xD0, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x29, 0x00, 0x00, 0x1F, 0x82, 0xF8, 0x00,
-    0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xFD,
-    0x01, 0xB0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x00, 0xBF, 0xFC, 0x00, 0x03, 0xFF, 0xAC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x40,
-    0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE4, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xAA, 0xFF, 0xF0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF4, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x01, 0xFD, 0x00, 0x03, 0xF4, 0x02, 0xFC, 0x00, 0x03,
-    0xF4, 0x03, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x07, 0xF4, 0x00, 0x0F, 0xE0,
-    0x0B, 0xF0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x16, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00, 0x00,
-    0x7E, 0x3E, 0x00, 0x00, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF9,
-    0xF8, 0x00, 0x1B, 0xE6, 0xF7, 0xF4, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0B, 0xE0, 0x7F, 0xD0, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0xC0, 0x00, 0x3E,
-    0x00, 0x7F, 0x40, 0x00, 0x3F, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFD, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xAA,
-    0xFF, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x40, 0x07, 0xF4, 0x00,
-    0x0F, 0xD0, 0x02, 0xFC, 0x00, 0x03, 0xF4, 0x7F, 0xFF, 0xFC, 0x00, 0xFC, 0x2F, 0xFF, 0xFF, 0x00,
-    0x7F, 0x05, 0x7F, 0xE5, 0x40, 0x3F, 0x80, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x05, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xAA, 0xFE, 0xA0, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1B, 0xE6, 0xF4, 0x00, 0x00,
-    0xBF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xE0, 0x7F, 0xD0, 0x00, 0x0F, 0x80,
-    0x3F, 0xC0, 0x00, 0x2F, 0x00, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x7F, 0x40, 0x00, 0x3F, 0x01, 0xFF,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFD, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x6A, 0xA5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAA, 0x00, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2A,
-    0xAA, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x0B, 0xE5, 0x6F, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x2F, 0xFF,
-    0xFF, 0x80, 0x3F, 0x55, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x3F, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBC, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA,
-    0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x02, 0xF9, 0x5B,
-    0xE0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x3F, 0x55, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x03, 0xFE, 0xAA, 0xE0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF,
-    0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF, 0xFF, 0xD0, 0x0F,
-    0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02, 0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF, 0x82,
-    0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF, 0xFF,
-    0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0F, 0x90, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00,
-    0x1F, 0xDF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02, 0xF4, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02,
-    0xF9, 0x1F, 0x40, 0x00, 0xBE, 0x56, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF8,
-    0x00, 0x3F, 0x55, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0x80, 0x00, 0x00, 0x03, 0xF5, 0xFC, 0x00, 0x00, 0x02, 0xF4, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0x40, 0x05, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x0A, 0x94, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xF8, 0x07, 0xFC, 0x00, 0xFF, 0xFD, 0x02,
-    0xFF, 0x00, 0x16, 0xFF, 0x40, 0xBF, 0xC0, 0x00, 0xBE, 0x00, 0x1F, 0xFE, 0x55, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00,
-    0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0xF8, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xEB, 0xFF, 0x80, 0x00, 0xBC,
-    0x07, 0xFD, 0x00, 0x03, 0xD0, 0x0F, 0xF0, 0x00, 0x2E, 0x00, 0x3F, 0x80, 0x00, 0xF4, 0x01, 0xFD,
-    0x00, 0x03, 0xC0, 0x0F, 0xF0, 0x00, 0x0F, 0x81, 0xBF, 0xC0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00,
-    0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x02, 0x40, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x05, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x02,
-    0xA5, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0x02, 0xFF, 0x00,
-    0x16, 0xFF, 0x40, 0x2F, 0xF0, 0x00, 0x2F, 0x80, 0x01, 0xFF, 0xE5, 0x5F, 0xF8, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06,
-    0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07, 0xE0, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x3F, 0x00, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x03, 0xFA, 0xFF, 0xE0, 0x00, 0x2F, 0x01, 0xFF, 0x40, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0x0B, 0x80, 0x0F, 0xE0, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x00, 0xF0, 0x03, 0xFC, 0x00,
-    0x03, 0xE0, 0x6F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x90, 0x1F, 0xD0,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x54, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xD0, 0x01, 0x40, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2A, 0x50, 0x03,
-    0xFC, 0x00, 0xFF, 0xFE, 0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0xBF, 0xC0, 0x05, 0xBF, 0xD2, 0xFF, 0x00,
-    0x02, 0xF8, 0x07, 0xFF, 0x95, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x1B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x3F,
-    0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xE0, 0x02, 0xF0, 0x1F, 0xF4, 0x00, 0xF4, 0x03,
-    0xFC, 0x00, 0xB8, 0x00, 0xFE, 0x00, 0x3D, 0x00, 0x7F, 0x40, 0x0F, 0x00, 0x3F, 0xC0, 0x03, 0xE0,
-    0x6F, 0xF0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x6F, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x90, 0x1F, 0xD0, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xF4,
-    0x00, 0x50, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x02, 0xA5, 0x00, 0x0F, 0xF0, 0x03, 0xFF, 0xF8,
-    0x1F, 0xF0, 0x03, 0xFF, 0xF4, 0x2F, 0xF0, 0x01, 0x6F, 0xF4, 0x2F, 0xF0, 0x00, 0x2F, 0x80, 0x1F,
-    0xFE, 0x55, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x6F, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x01, 0xAA, 0x40, 0x00, 0x00, 0xBF,
-    0xC0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0x8F, 0xC0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0xBF, 0xF8, 0x00, 0xBC, 0x07, 0xFD, 0x00,
-    0x3D, 0x00, 0xFF, 0x00, 0x2E, 0x00, 0x3F, 0x80, 0x0F, 0x40, 0x1F, 0xD0, 0x03, 0xC0, 0x0F, 0xF0,
-    0x00, 0xF8, 0x1B, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x1B, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x24, 0x07, 0xF4, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00,
-    0x0F, 0xDB, 0xE0, 0x00, 0x00, 0x3F, 0x41, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01,
-    0xFD, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xF8,
-    0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA,
-    0xFF, 0x40, 0x2F, 0xF0, 0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0x6F, 0x80, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8, 0x01, 0xFF, 0xEB,
-    0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x01, 0xFC, 0x00, 0xFC, 0x0B, 0xF0, 0x07, 0xE0,
-    0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0, 0x3F, 0xC1, 0xFF,
-    0x01, 0xBE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC,
-    0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x02, 0xFD, 0x00,
-    0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xAA, 0xAF,
-    0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFD, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x1F, 0xF4, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0xBF, 0xFF,
-    0xC0, 0x03, 0xFF, 0x95, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xEB, 0xF8, 0x00, 0x3F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xEB, 0xF0, 0x0B, 0xF4, 0x0B, 0xC0, 0x3F, 0x80, 0x2F, 0x00, 0xFC, 0x00, 0xFC, 0x0B,
-    0xF0, 0x07, 0xE0, 0x3F, 0x80, 0x2F, 0x41, 0xFD, 0x00, 0xFC, 0x0B, 0xF0, 0x0B, 0xF0, 0x3F, 0xC0,
-    0x3F, 0xC1, 0xFF, 0x01, 0xBE, 0x00, 0x00, 0x07, 0xD2, 0x80, 0x00, 0xFF, 0x3C, 0x00, 0x2E, 0xBF,
-    0x80, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7D, 0x2C, 0x00, 0xFF, 0x7C, 0x02, 0xE7,
-    0xF8, 0x02, 0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07,
-    0xE0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0x40, 0x7F, 0xFF, 0xA8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-    0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF,
-    0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0x01, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF,
-    0xF4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0,
-    0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03,
-    0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0,
-    0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x01,
-    0xFE, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xFC,
-    0x00, 0x02, 0xFF, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x02, 0xF0, 0x03, 0xF0,
-    0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0xC0, 0x1F, 0xC0, 0x2F, 0xC0, 0x2F, 0x80, 0x00, 0x3E, 0x40, 0x00,
-    0xBF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x02, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0x40, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0xBF,
-    0x00, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0B, 0xF0,
-    0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x40,
-    0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x02, 0xFD, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00,
-    0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x1B, 0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0x01, 0x40, 0xBF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xBF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x05, 0x00, 0x00, 0xFD, 0x00, 0x0B, 0xC0,
-    0x00, 0xBF, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x02, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x1F, 0xC0, 0x00, 0xBC, 0x00, 0x0B, 0xF0,
-    0x00, 0x3F, 0x00, 0x02, 0xF8, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xAF, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40,
-    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x60, 0x2F, 0xF0,
-    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
-    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0x40,
-    0x00, 0x01, 0xFD, 0xBE, 0x00, 0x00, 0x3E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0B,
-    0xF8, 0x00, 0x07, 0xF0, 0x7F, 0xC0, 0x00, 0x2F, 0x83, 0xFC, 0x00, 0x00, 0xFD, 0x3F, 0xC0, 0x00,
-    0x07, 0xF3, 0xFD, 0x00, 0x00, 0x3F, 0xAF, 0xD0, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-    0x9F, 0xFE, 0x00, 0x02, 0xFD, 0x3F, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xFD, 0x00, 0x7F, 0xC0, 0xBF,
-    0xFD, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x03, 0xF2, 0xFC,
-    0x00, 0x1F, 0xAF, 0xC0, 0x00, 0xBF, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0xBF, 0xF4, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xBF, 0x7F, 0xF0, 0x03, 0xF8,
-    0xFF, 0xE0, 0x1F, 0xD1, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xAA, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x1F, 0xF0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0xBC, 0x00, 0xF5, 0xF0, 0x01, 0xF7, 0xD0, 0x02, 0xEF, 0x40, 0x03, 0xFE,
-    0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x2F, 0xFF, 0x00, 0x3E, 0x7F, 0x80,
-    0x7D, 0x2F, 0xE0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x1F, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
-    0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-    0x0B, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x80, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x3F, 0x80, 0x68, 0x00, 0x3F, 0x40, 0xFC, 0x00, 0x7F, 0x01, 0xF8, 0x00, 0xFF, 0x03, 0xF0,
-    0x00, 0xFE, 0x03, 0xF0, 0x01, 0xFC, 0x0B, 0xE0, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x07, 0xF4, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0,
-    0x2F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x1F, 0x87, 0xF0,
-    0x00, 0x2F, 0x46, 0x90, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x69, 0x00, 0x3F, 0x80, 0xFD,
-    0x00, 0x3F, 0x41, 0xFD, 0x00, 0x7F, 0x03, 0xFC, 0x00, 0xFF, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x2F, 0x80, 0x2F, 0x4F, 0xE0, 0x0F, 0xCB, 0xF4, 0x07,
-    0xE3, 0xFC, 0x02, 0xF4, 0xAA, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF5, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0x80,
-    0x01, 0x6B, 0xFF, 0xF9, 0x40, 0x1F, 0xFF, 0xEF, 0xC0, 0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x03, 0xFE, 0x00, 0x3F, 0x40, 0x01, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0xFF, 0xF0, 0x0B, 0xE0, 0x00, 0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x1F, 0xFF, 0x41, 0xFC, 0x00,
-    0x0F, 0xFF, 0xE0, 0xBE, 0x00, 0x03, 0xFE, 0xFC, 0x3F, 0x40, 0x02, 0xFE, 0xBF, 0x1F, 0xC0, 0x00,
-    0xFF, 0x5F, 0xCB, 0xF0, 0x00, 0x3F, 0xC3, 0xF7, 0xF4, 0x00, 0x2F, 0xF0, 0xFF, 0xFC, 0x00, 0x0F,
-    0xF8, 0x3F, 0xFF, 0x00, 0x07, 0xFD, 0x0F, 0xFF, 0x80, 0x02, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0xFF,
-    0xC0, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xBF, 0x40, 0x03, 0xFF, 0xFF, 0x40,
-    0x0F, 0xFE, 0xFE, 0x00, 0xBF, 0x40, 0xFC, 0x03, 0xF4, 0x03, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0xBE,
-    0x00, 0xBD, 0x03, 0xF4, 0x03, 0xF0, 0x0F, 0xD0, 0x1F, 0xC0, 0xBF, 0x00, 0xFF, 0x03, 0xFC, 0x03,
-    0xF8, 0x1F, 0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80,
-    0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00,
-    0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00,
-    0xFF, 0xBF, 0x0F, 0xD0, 0x00, 0xBF, 0xAF, 0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F,
-    0xF0, 0xFD, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF,
-    0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFB, 0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02,
-    0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0,
-    0x7F, 0x80, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x2F, 0x47, 0xE0, 0x00, 0x00, 0x00,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xBE, 0x00, 0x00,
-    0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x1F, 0xF8, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x2F, 0x80, 0x00,
-    0x3F, 0xFC, 0x03, 0xF4, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x00, 0xFF, 0xFE, 0x0B, 0xE0, 0x00,
-    0x0F, 0xFB, 0xF0, 0xFD, 0x00, 0x02, 0xFE, 0xBF, 0x1F, 0xC0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00,
-    0x03, 0xFC, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xC3, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x3F, 0xFF, 0x00,
-    0x01, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0x2F, 0xF4, 0x2F, 0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xC0,
-    0x00, 0x7F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0xA0, 0x00, 0x01, 0xF8, 0x7F,
-    0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDB, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x00, 0xFF, 0xEF, 0xE0, 0x00, 0x0B, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x3E, 0x00, 0x00, 0xFC,
-    0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x0B, 0xD0, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x3F, 0x80, 0x01, 0xFE, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0x03, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F,
-    0xE0, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF,
-    0x80, 0x0F, 0xD0, 0x00, 0x7F, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xFF,
-    0x00, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xBF,
-    0x0F, 0xD0, 0x00, 0xBF, 0xAF, 0xC7, 0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F, 0xF0, 0xFD,
-    0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xFF, 0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF,
-    0xE0, 0x00, 0xBF, 0xD0, 0xBF, 0xF0, 0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xD0,
-    0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFB, 0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F,
-    0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40,
-    0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xBF, 0x40, 0x00, 0x03, 0xFC,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x68, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0x55, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x02, 0xFC,
-    0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
-    0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00,
-    0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xA8, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFC, 0x00, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F, 0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xBF, 0xFF,
-    0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0,
-    0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0,
-    0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01,
-    0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1B, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x2F, 0x40, 0x0F, 0xC0, 0x3F, 0x00, 0x2F, 0x80, 0x3F, 0x81, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x00, 0x2F, 0xD0, 0x07, 0xF8,
-    0x00, 0x01, 0xA9, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0xBF,
-    0x40, 0x00, 0xBF, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4,
-    0x00, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x02, 0xFF, 0x90, 0x5F, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x07, 0xF0, 0x02, 0xFC, 0x00, 0x7F, 0x40, 0x2F, 0xD0, 0x07, 0xF8, 0x01, 0xA9, 0x00,
-    0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00,
-    0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x00, 0xFE, 0x07, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
-    0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0xAF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xE0, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x0B, 0xFF, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF4, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xEA, 0xA9, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xF8, 0x06, 0xF9, 0x00, 0x0B, 0xFF, 0xF6, 0xFF, 0xF4, 0x03, 0xFE, 0xBF, 0xFE,
-    0x0B, 0xC0, 0xBF, 0x00, 0xFF, 0x55, 0xBD, 0x0F, 0xC0, 0x0F, 0xFF, 0xFF, 0xD2, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFD, 0x3F, 0x00, 0x3F, 0x95, 0x00, 0x03, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFA, 0xAF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xEB, 0xFF, 0xFF, 0x00, 0x2F, 0xE0,
-    0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x6F, 0x40, 0x02, 0xF0,
-    0x03, 0xE0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F,
-    0xD5, 0xBF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xD0, 0xFD, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF4, 0x0F, 0xE0, 0x07, 0xFC, 0x0B, 0xFC,
-    0x02, 0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x2A, 0x90, 0x6A, 0xA0, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x00, 0x00, 0x3F, 0xBF,
-    0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x40, 0x01, 0xFC, 0x00, 0x02, 0xF8, 0x00, 0x03,
-    0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-    0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xE5, 0x6F, 0x40, 0x02, 0xF0, 0x03,
-    0xE0, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x0F, 0xD5,
-    0xBF, 0x80, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xD0, 0xFD, 0x00, 0x2F, 0xE0, 0x3F, 0x80, 0x0F, 0xF4, 0x0F, 0xE0, 0x07, 0xFC, 0x0B, 0xFC, 0x02,
-    0xFF, 0x03, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 0x2A, 0x90, 0x6A, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB,
-    0xF0, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xE0,
-    0x00, 0x03, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x3F, 0xE0,
-    0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0xBE, 0x00, 0x00,
-    0x02, 0xFF, 0xD0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x01, 0xF9, 0x5B, 0xD0, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x3F,
-    0x00, 0x3E, 0x00, 0x01, 0xF8, 0x02, 0xF4, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00, 0x3F, 0x56, 0xFE,
-    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFF, 0x43, 0xF4, 0x00, 0x0B, 0xF8, 0x0F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0x80, 0x01, 0xFF, 0x02,
-    0xFF, 0x00, 0x0B, 0xFC, 0x0F, 0xFC, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x00, 0xAA, 0x41, 0xAA, 0x80,
-    0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0xFD, 0x7F, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xC0, 0x00,
-    0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFD, 0x01, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x01, 0xFF, 0xFF,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0xE4, 0x00, 0x7F, 0xC0, 0x3F, 0xFA, 0xBF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x7D, 0x00, 0x40, 0x07, 0xC0, 0x00, 0x00, 0x3F, 0x90,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x02, 0xFC, 0x03, 0xE5, 0xBF, 0xC0, 0xFF,
-    0xFF, 0xF4, 0x3F, 0xFF, 0xFD, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xDF,
-    0xD0, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFD, 0x01, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xE4, 0x00, 0x7F, 0xC0, 0x03, 0xFF, 0xAB, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x1F, 0xDF, 0xC0,
-    0x00, 0x1F, 0x80, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0x40, 0x10, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFE,
-    0x40, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x0F,
-    0x96, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x03, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xD0, 0x10, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0E,
-    0x40, 0x07, 0xFC, 0x03, 0xFF, 0xAB, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0x5F,
-    0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x07, 0xD0, 0x04, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF9,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x2E, 0x5B, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0x90, 0x00, 0x3C, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0xEF, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x80, 0x2E, 0x00, 0x00, 0x01, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00,
-    0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF4, 0x04, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x06,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x39, 0x00,
-    0x1F, 0xF0, 0x00, 0x3F, 0xFA, 0xBF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x02,
-    0xF4, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7D, 0x00, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x03, 0xE5, 0xBF, 0xC0, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x05, 0x7C, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xF0, 0x1A, 0xFE, 0xA8, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x80, 0x03, 0xFF, 0xE0, 0x02, 0xD0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x6B, 0xC0, 0x00, 0x3F, 0xE0,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x2E, 0x00, 0x01, 0xF8, 0x7F, 0x00, 0x00, 0x2F,
-    0xFE, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x1B, 0x01, 0xF8, 0x00, 0x7E, 0x03, 0xF4, 0x00, 0xBD, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x6B, 0xFA, 0xA0, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x15, 0xBF, 0xD5, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F,
-    0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0, 0x1A, 0xFE, 0xA8, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-    0xFF, 0x47, 0xFF, 0xFF, 0xC1, 0x5B, 0xF5, 0x50, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x60, 0x00, 0x00,
-    0x00, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD,
-    0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0,
-    0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00,
-    0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
-    0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xA0,
-    0x00, 0x1F, 0xE3, 0xC0, 0x00, 0xF7, 0xDE, 0x00, 0x03, 0xCB, 0xF4, 0x00, 0x0F, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x2F, 0x00,
-    0x2F, 0x40, 0xBC, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0x80, 0x2F, 0x80, 0x7D, 0x00, 0xFE,
-    0x02, 0xF4, 0x07, 0xF4, 0x0B, 0xC0, 0x3F, 0xC0, 0x3F, 0xE7, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x02,
-    0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAB,
-    0xFF, 0x40, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x3F,
-    0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFE,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF0,
-    0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B, 0xD0, 0x0B, 0xC0,
-    0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F, 0x80, 0x2F, 0x40,
-    0x7F, 0x40, 0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x2F, 0xFF,
-    0xFD, 0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x1F,
-    0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03, 0xFD, 0x00, 0x3F, 0xE0,
-    0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFE, 0x00,
-    0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00,
-    0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07,
-    0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x7E, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x0B, 0xC0, 0x0B,
-    0xD0, 0x0B, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0x80, 0x2F, 0x80, 0x1F, 0x40, 0x3F,
-    0x80, 0x2F, 0x40, 0x7F, 0x40, 0x2F, 0x00, 0xFF, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x3F, 0xFF, 0xFE,
-    0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x2F, 0xF0, 0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFD, 0x00, 0x2F, 0xF0,
-    0x01, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00,
-    0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x2F, 0xD0, 0x02, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0xBF, 0x80, 0x1F,
-    0xF0, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xEB, 0x40, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x7E, 0x0B, 0xC0, 0x0B, 0xD0, 0xBC, 0x00, 0xFC, 0x0F, 0xC0, 0x1F, 0xC0,
-    0xF8, 0x02, 0xF8, 0x1F, 0x40, 0x3F, 0x82, 0xF4, 0x07, 0xF4, 0x2F, 0x00, 0xFF, 0x03, 0xFE, 0x7F,
-    0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xD0, 0x0B, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x01, 0xA4, 0x00, 0x00, 0xBE, 0x00, 0x2F, 0xC0, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x00, 0xFF,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00,
-    0x00, 0xFF, 0x40, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF,
-    0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00,
-    0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0B,
-    0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x02, 0xA0, 0x01, 0xFD, 0x00,
-    0x3F, 0x80, 0x1F, 0xE0, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x0B, 0xC0,
-    0x0B, 0xD0, 0x00, 0x2F, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x03, 0xE0, 0x0B, 0xE0,
-    0x00, 0x1F, 0x40, 0x3F, 0x80, 0x00, 0xBD, 0x01, 0xFD, 0x00, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0x0F,
-    0xF9, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xEF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC,
-    0x00, 0x3F, 0xD0, 0x02, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xC0,
-    0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00,
-    0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x01,
-    0xFE, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0,
-    0xBC, 0x00, 0xBD, 0x0F, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03,
-    0xF8, 0x2F, 0x00, 0x7F, 0x43, 0xF4, 0x0F, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3E, 0x40,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x90, 0x00,
-    0x00, 0x00, 0xAA, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0x83, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0xFF, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF4, 0x03, 0xF0,
-    0x0B, 0xF8, 0x03, 0xFD, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0xFF, 0x02, 0xFF, 0x42, 0xFE, 0x00, 0x3F,
-    0xC1, 0xFF, 0xE0, 0xFF, 0x00, 0x0F, 0xF1, 0xFF, 0xFC, 0xBF, 0x80, 0x07, 0xFC, 0xFF, 0xFF, 0x3F,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0xE3, 0xFF, 0xF4, 0x00, 0x0B, 0xFF, 0xF0, 0xBF, 0xFC, 0x00, 0x02, 0xFF, 0xF0, 0x2F, 0xFD, 0x00,
-    0x00, 0xBF, 0xF8, 0x0B, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0x6F, 0x80, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x87,
-    0xF0, 0x14, 0x03, 0xF0, 0x7F, 0x07, 0xE0, 0xFE, 0x07, 0xF0, 0xFF, 0x1F, 0xC0, 0x7F, 0x3F, 0xF7,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F,
-    0xFB, 0xFF, 0x40, 0x07, 0xFE, 0x3F, 0xF0, 0x00, 0x7F, 0xC3, 0xFD, 0x00, 0x02, 0xA0, 0x1A, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x7F, 0xF4,
-    0x00, 0x00, 0xFD, 0xBE, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03,
-    0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF,
-    0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x0B, 0xE7, 0xF4, 0x00, 0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xF4,
-    0x03, 0xF4, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x03, 0xF4, 0x3F,
-    0x00, 0x00, 0xFE, 0x2F, 0x40, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x1F, 0xD2, 0xFC,
-    0x00, 0x3F, 0xC3, 0xFC, 0x00, 0x3F, 0xCB, 0xF8, 0x00, 0x6A, 0x8A, 0xA4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00,
-    0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-    0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF, 0xF8, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xFF, 0x40,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1A, 0xAF, 0xF8, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x0A, 0x40, 0x1A, 0x00, 0x00, 0x00, 0xBE, 0x0B, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xF4, 0x07, 0xE0, 0x00, 0x02, 0xF9, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xAB, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFD, 0x00, 0x7F, 0x40, 0x00,
-    0xFE, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0,
-    0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x80, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xF0, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0xF8, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF1, 0xFC, 0x00, 0x0F, 0xF8, 0x02, 0xFE, 0x38, 0x00, 0x0F, 0xF4, 0x00, 0x3F,
-    0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x0F, 0xE0,
-    0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x00, 0x02, 0xFF, 0x90,
-    0x5F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x01, 0xBF, 0x82, 0xF0, 0x02, 0xFF, 0xFD, 0xF4, 0x03, 0xFE, 0xBF, 0xFC, 0x02,
-    0xFC, 0x03, 0xF8, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x80,
-    0x0F, 0xE0, 0x7F, 0xC0, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x6A, 0xAA, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0xFF, 0xFE, 0x01, 0xFC, 0x3F, 0xBF, 0x00, 0x2F, 0x2F, 0x5F, 0xC0, 0x0F, 0xCF,
-    0x8B, 0xE0, 0x1F, 0xF2, 0xD3, 0xFF, 0xFF, 0xF4, 0x71, 0xFF, 0xFF, 0xFC, 0x0C, 0xBF, 0xFF, 0xFC,
-    0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xFA, 0x40, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x00, 0xBE, 0x19, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x00, 0x7F, 0xF4, 0x7D, 0x00, 0x02, 0xFF, 0x00, 0xB8, 0x00, 0x0F, 0xF4, 0x02, 0xD0, 0x00, 0x3F,
-    0xC0, 0x0F, 0x40, 0x01, 0xFF, 0x00, 0x3C, 0x00, 0x0F, 0xF8, 0x02, 0xF0, 0x00, 0x3F, 0xF0, 0x2F,
-    0x40, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x01,
-    0xFC, 0x19, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xAA, 0xA4, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF8, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x54,
-    0x00, 0x0A, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x34, 0x03, 0xF8, 0x00, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF4, 0x00, 0x3F,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFC, 0x00, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0,
-    0x6B, 0xFA, 0xA0, 0x07, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x2A, 0xAA,
-    0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07,
-    0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00,
-    0x03, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC,
-    0x00, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03,
-    0xFC, 0x00, 0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x7D, 0x07, 0xD0, 0x07, 0xFF, 0x02, 0xF0, 0x02, 0xFF, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0x3F,
-    0x00, 0x7F, 0x00, 0x0F, 0x80, 0x2F, 0x80, 0x07, 0xD0, 0x0F, 0xE0, 0x02, 0xF4, 0x07, 0xF4, 0x00,
-    0xBC, 0x03, 0xFC, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xD0,
-    0x00, 0x2F, 0xFB, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0xD0, 0x07, 0xF4, 0x01, 0xA9, 0x01, 0xF0, 0x0F,
-    0x40, 0xBC, 0x0B, 0xC0, 0x15, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x0F,
-    0xEB, 0xE0, 0x2F, 0x41, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06, 0x43, 0xE1, 0xE3, 0xFD, 0xB1, 0xF3,
-    0xFC, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x1F, 0xFF, 0xFE, 0x3F, 0xFE, 0xA9,
-    0x00, 0x00, 0x15, 0x50, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBC, 0x07, 0xE2, 0xFF, 0xFF, 0x47, 0xFF, 0xF8, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00,
-    0x0F, 0xD1, 0xFD, 0x3F, 0xC3, 0xFC, 0x6A, 0x80, 0x0F, 0x87, 0xE2, 0xF8, 0xBD, 0x3F, 0x4F, 0xDB,
-    0xF6, 0xFC, 0x14, 0x0F, 0xC0, 0x70, 0xB8, 0x34, 0x00, 0x00, 0x0B, 0x83, 0xFE, 0x3E, 0xE3, 0xFC,
-    0x2F, 0x40, 0x01, 0xFC, 0x00, 0x3F, 0x41, 0xFD, 0x00, 0x3F, 0x81, 0xFD, 0x00, 0x3F, 0x81, 0xA9,
-    0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x0F, 0xDF, 0xD0, 0x07, 0xFF, 0x40, 0x02,
-    0xFC, 0x00, 0x00, 0xF0, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8,
-    0x00, 0xFF, 0x00, 0x1A, 0x90, 0x02, 0xA8, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xFF,
-    0x40, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF, 0x00, 0x0B, 0xF8, 0x00, 0xFF, 0xC0, 0x0F, 0xF4,
-    0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xE0, 0x0B, 0xFC, 0x00, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0xC0, 0x0F, 0xF4, 0x00,
-    0x00, 0x02, 0x80, 0x7C, 0xBF, 0x8F, 0xF4, 0x1F, 0x01, 0xE0, 0x64, 0x0B, 0xC0, 0x7F, 0xC3, 0xFD,
-    0x2E, 0x01, 0xE0, 0x7F, 0xA9, 0x4B, 0xFF, 0xFC, 0x6A, 0xAF, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-    0x01, 0xF4, 0x00, 0x01, 0xE0, 0xB8, 0x3D, 0xBF, 0x3F, 0x06, 0x00, 0x00, 0x01, 0xE1, 0xF4, 0xF4,
-    0x2F, 0x03, 0x80, 0x00, 0x09, 0x01, 0xF0, 0xFF, 0x0F, 0xFD, 0x1B, 0xD0, 0x00, 0x74, 0x07, 0xFE,
-    0x2F, 0xF0, 0xFA, 0x0B, 0x40, 0x00, 0x05, 0x02, 0x4B, 0xF8, 0x70, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0xBF, 0xFC, 0x2F, 0xFF, 0xFC, 0x7F, 0xFE, 0xA8, 0x06, 0x90, 0xFE, 0x1F, 0xD3, 0xFD, 0x3F,
-    0xC0, 0x0B, 0xC2, 0xF0, 0x3F, 0x0F, 0xC2, 0xFC, 0xBF, 0x0F, 0xF3, 0xFC, 0x0B, 0x83, 0xFE, 0x3E,
-    0xE3, 0xFC, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0x40, 0x1F, 0xF0, 0x03, 0xFD,
-    0x00, 0xBF, 0x80, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x02, 0x80, 0x1E, 0x00, 0xFD, 0x07, 0xBC, 0x01,
-    0xF0, 0xFF, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xFD, 0x0F, 0xC0, 0x7F, 0xE0, 0xFF, 0x80,
-    0xBD, 0x00, 0x00, 0x03, 0xF0, 0x1F, 0xC0, 0xBE, 0x03, 0xF4, 0x1F, 0xC0, 0xBF, 0x03, 0xF4, 0x00,
-    0x2F, 0xFF, 0xD3, 0xFF, 0xFC, 0x3F, 0xAF, 0xC7, 0xE1, 0xF8, 0xBD, 0x2F, 0x40, 0x3F, 0x00, 0x1F,
-    0x81, 0xFD, 0x1F, 0xD0, 0x0B, 0xFF, 0xF4, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x2F, 0xFF, 0x80, 0x1F,
-    0xD2, 0xFC, 0x0F, 0xC0, 0x0F, 0xD0, 0x0B, 0xC2, 0xD3, 0xFE, 0x3D, 0x7E, 0xFB, 0xCB, 0x8F, 0xF8,
-    0xB8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x05, 0x50, 0x00,
-    0x06, 0xAB, 0xF4, 0xBF, 0xFF, 0xE7, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x07, 0xE0, 0xF0, 0x3F, 0xC3,
-    0xC2, 0xFB, 0xFE, 0x0F, 0x4F, 0xF0, 0x3D, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F,
-    0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x00, 0x1E, 0x07, 0xE0, 0x7C, 0x0F, 0x4B, 0xD1, 0xF0, 0x10, 0x68,
-    0x0A, 0x82, 0xF8, 0x3F, 0x47, 0xF0, 0xBE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD2, 0xFF, 0xFC, 0x3E, 0x5F, 0xC3, 0xD0, 0xF8, 0x7D, 0x5F, 0x4B,
-    0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x02, 0xEF, 0x40, 0xFF, 0xFC, 0x1D, 0xBB, 0xC2, 0xCF, 0x38, 0x38,
-    0xE7, 0x00, 0x00, 0x00, 0x09, 0x24, 0x1F, 0x80, 0x3C, 0x03, 0xF0, 0x38, 0xE0, 0x00, 0x06, 0x43,
-    0xE1, 0xE3, 0xFD, 0xB1, 0xF3, 0xFC, 0x74, 0x68, 0x00, 0x00, 0x03, 0x81, 0xF4, 0x7E, 0x3F, 0x09,
-    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xC0, 0x00, 0x01,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x4B, 0xD0, 0x0F, 0xC3, 0xF0, 0x07, 0xF1, 0xFC, 0x03, 0xFC,
-    0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFE, 0xFD, 0x0F, 0xC2, 0xF0, 0x3F, 0x0F, 0xC0,
-    0x00, 0x6A, 0xBF, 0xC0, 0x3F, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x03, 0xEA, 0xAA, 0x50, 0x00, 0x00, 0x00, 0x2F,
-    0x07, 0xD0, 0xFC, 0x3F, 0x07, 0xE0, 0xF8, 0x2F, 0x47, 0xD0, 0xFC, 0x3F, 0x07, 0xF0, 0xFC, 0x00,
-    0x1F, 0xFE, 0x0B, 0xFF, 0xC3, 0xFF, 0xF0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x2A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xFB, 0x6E, 0x00, 0x1F, 0xFC,
-    0xF8, 0x00, 0xFF, 0xFF, 0xD0, 0x07, 0xEF, 0xFF, 0x00, 0x1F, 0xE7, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x34, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x15, 0x40, 0x01, 0x54, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0x81, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xC0, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFF, 0xD0, 0x7F, 0xFF, 0xE0, 0x2F, 0xF0, 0x02,
-    0xFF, 0x90, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x02, 0x80, 0x3F, 0xFD, 0x1F, 0x82, 0xF8, 0xFD,
-    0xFC, 0x0F, 0xD1, 0xFF, 0xE0, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xA0,
-    0x1F, 0xFF, 0x0F, 0xC0, 0xFC, 0x7D, 0xBE, 0x07, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x07, 0xD0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x2F, 0x00, 0x00, 0x10, 0x14, 0x0F, 0x40, 0xC0, 0x10, 0x14, 0x00, 0x00, 0x00, 0x20, 0xF0,
-    0x00, 0x00, 0x07, 0xC1, 0xF8, 0x00, 0x06, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6F, 0xFF,
-    0x90, 0x00, 0x00, 0x1A, 0xFE, 0x90, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0xFD, 0x00, 0x06, 0xFD,
-    0x0B, 0x80, 0x00, 0x00, 0x7D, 0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x01, 0x55, 0x55, 0x55, 0x57, 0xF4,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00,
-    0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x00, 0x07, 0xFA, 0xBF, 0xE0, 0x02, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x3F,
-    0x40, 0x1F, 0x40, 0x1F, 0xC0, 0x2F, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0x00, 0x2F, 0xC0, 0x2F, 0x80, 0x07, 0xF4, 0x0F, 0xD0, 0x02, 0xFC,
-    0x07, 0xFA, 0xAB, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x02, 0xFC,
-    0xBF, 0x00, 0x00, 0x7F, 0x4B, 0xF0, 0x00, 0x1F, 0xE0, 0x7F, 0x40, 0x03, 0xFC, 0x07, 0xF8, 0x00,
-    0xBF, 0x40, 0x3F, 0xC0, 0x2F, 0xE0, 0x03, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x03,
-    0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00,
-    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF,
-    0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xA0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x2F, 0xC0, 0x01, 0xFD, 0x00, 0x3F, 0xC0,
-    0x02, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x07,
-    0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x01, 0xFE, 0x00, 0x0F, 0xF0, 0x02, 0xFD, 0x00, 0x1F, 0xF0,
-    0x03, 0xFD, 0x00, 0x2F, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0B, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFA, 0xAA, 0xFF, 0x40, 0x2F, 0xF0,
-    0x01, 0xFF, 0x40, 0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x7F, 0xD0, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x1F,
-    0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80,
-    0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x01,
-    0x2F, 0xC0, 0x1F, 0xCB, 0xFF, 0xCB, 0xF0, 0x0F, 0xF7, 0xFF, 0xF7, 0xFC, 0x03, 0xF6, 0xA9, 0x54,
-    0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF,
-    0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x00, 0x0B, 0xE0,
-    0x00, 0xFD, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0x40, 0x0B,
-    0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x02, 0xFE, 0x00, 0x3F, 0xD0, 0x02, 0xFC, 0x00, 0x00, 0x03,
-    0xF8, 0x2F, 0xE0, 0x00, 0x1F, 0xC1, 0xFF, 0x00, 0x00, 0xBE, 0x0F, 0xF0, 0x00, 0x03, 0xF4, 0xFF,
-    0x00, 0x00, 0x1F, 0xCF, 0xF4, 0x00, 0x00, 0xFE, 0xBF, 0x40, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x00, 0xFE, 0x7F, 0xF8, 0x00, 0x0B, 0xF4, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0xFF, 0xF4, 0x01, 0xFF,
-    0x02, 0xFF, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F,
-    0xFF, 0xFC, 0x00, 0x02, 0xFF, 0x3F, 0xE0, 0x00, 0x2F, 0xF1, 0xFF, 0x40, 0x02, 0xFE, 0x0B, 0xFC,
-    0x00, 0x2F, 0xE0, 0x3F, 0xD0, 0x03, 0xFD, 0x01, 0xFF, 0x00, 0x3F, 0xD0, 0x0B, 0xF8, 0x03, 0xFC,
-    0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0xFF, 0x03, 0xFC, 0x00, 0x0B, 0xF4, 0x3F, 0xC0, 0x00, 0x3F,
-    0xC3, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0xFF,
-    0x80, 0x03, 0xFF, 0x80, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xF4, 0x00, 0x7F, 0xFC, 0x03,
-    0xFF, 0xC0, 0x02, 0xFF, 0xF0, 0x2F, 0xFF, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0x4F, 0xFF, 0xD0, 0x02, 0xFE, 0xFD, 0xBF, 0xBF, 0x00, 0x0F, 0xEB, 0xFF, 0xFB, 0xFC, 0x00, 0x3F,
-    0x6F, 0xFF, 0xDF, 0xE0, 0x02, 0xFD, 0x7F, 0xFD, 0xBF, 0x40, 0x0F, 0xF1, 0xFF, 0xF3, 0xFD, 0x00,
-    0x3F, 0xC7, 0xFF, 0x5F, 0xF0, 0x01, 0xFE, 0x0F, 0xFC, 0xBF, 0xC0, 0x0B, 0xF8, 0x3F, 0xC3, 0xFE,
-    0x00, 0x3F, 0xD0, 0xFE, 0x1F, 0xF4, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x03, 0xFD, 0x00, 0x2F, 0x80, 0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x7F, 0xE0,
-    0x07, 0xF0, 0x00, 0x3F, 0xFC, 0x02, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0xD0,
-    0x7F, 0x00, 0x03, 0xFF, 0xF8, 0x2F, 0x80, 0x00, 0xFF, 0xBF, 0x0F, 0xD0, 0x00, 0xBF, 0xAF, 0xC7,
-    0xF0, 0x00, 0x3F, 0xD7, 0xF2, 0xFC, 0x00, 0x0F, 0xF0, 0xFD, 0xFD, 0x00, 0x0B, 0xFC, 0x3F, 0xFF,
-    0x00, 0x03, 0xFE, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0x43, 0xFF, 0xE0, 0x00, 0xBF, 0xD0, 0xBF, 0xF0,
-    0x00, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xFF, 0x40,
-    0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00,
-    0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x00,
-    0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xBE, 0x55, 0xFD, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF8,
-    0x01, 0xF8, 0x01, 0xF4, 0x02, 0xF4, 0x02, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xE0,
-    0x07, 0xE0, 0x0B, 0xD0, 0x0B, 0xD0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x0F, 0xC0, 0x1F, 0x80,
-    0x1F, 0x40, 0x2F, 0x40, 0x2F, 0x00, 0x3F, 0x00, 0x2A, 0x00, 0x2A, 0x00, 0x00, 0x0A, 0xAA, 0x40,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0xBE, 0x01, 0xFC, 0x00, 0x3F, 0x00,
-    0x2F, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xF4, 0x01, 0xFF,
-    0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x1F, 0xFA, 0x40, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0xBF, 0xAA, 0xA4, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x15, 0x55, 0x54, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x40, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xF8, 0x00,
-    0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80,
-    0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3,
-    0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xBF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xEF, 0xD2, 0xFF, 0x80, 0x01, 0xFF, 0x83, 0xF0, 0x2F, 0xF0,
-    0x00, 0xFF, 0x81, 0xF8, 0x03, 0xFD, 0x00, 0xFF, 0x80, 0xFD, 0x00, 0xFF, 0x40, 0x7F, 0xC0, 0x3F,
-    0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x1F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF4, 0x0B, 0xD0, 0x1F, 0xF4, 0x07,
-    0xFE, 0x03, 0xF0, 0x2F, 0xFC, 0x02, 0xFF, 0xFA, 0xFE, 0xBF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x06,
-    0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0x00,
-    0x3F, 0xC0, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x00,
-    0x00, 0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x02, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x0F, 0x8F, 0xC0, 0x2F, 0x00, 0x7C, 0x3F, 0x00,
-    0xFC, 0x02, 0xF1, 0xF8, 0x03, 0xE0, 0x0F, 0x8B, 0xC0, 0x1F, 0x40, 0x7D, 0x7F, 0x00, 0x7D, 0x02,
-    0xF3, 0xF4, 0x01, 0xFC, 0x0F, 0xFF, 0xC0, 0x07, 0xF8, 0x3F, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0xBF, 0xD0, 0x00,
-    0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0xBF, 0x00, 0x07, 0xF0, 0x00, 0xFD, 0x00, 0x03, 0xF0, 0x02, 0xFC,
-    0x00, 0x03, 0xF0, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x0B, 0xF0, 0x00,
-    0x0F, 0xD0, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x0B, 0xE0, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x02, 0xFF,
-    0x00, 0x17, 0xFD, 0x0F, 0xFD, 0x00, 0x7F, 0xFD, 0x1F, 0xFF, 0x00, 0xBF, 0xFC, 0x2F, 0xFF, 0x00,
-    0xBF, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0xF8, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFA, 0xFF, 0x40, 0x02, 0xF0, 0x0F, 0xC0, 0x01,
-    0xF4, 0x03, 0xF0, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x2F, 0x80,
-    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x14, 0x3F, 0xFF, 0xFF, 0xFD, 0x02, 0xFE, 0x7F,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFB, 0xF8, 0x00, 0x2F, 0xC0, 0x3F,
-    0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xD0, 0x02, 0xF9, 0xFF, 0xE0, 0x00, 0xFD, 0xBF,
-    0xF0, 0x00, 0x3F, 0x2F, 0xFF, 0x00, 0x1F, 0xC0, 0x0F, 0xD0, 0x0B, 0xF0, 0x03, 0xF4, 0x03, 0xFF,
-    0x97, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xBF, 0xFF, 0x40, 0x0F,
-    0xC0, 0xBF, 0x40, 0x07, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x4B, 0xE0, 0x0F, 0xD2, 0xFC, 0x03, 0xF0, 0x7F,
-    0x01, 0xFC, 0x0F, 0xD0, 0xBE, 0x03, 0xF8, 0x3F, 0x40, 0xFF, 0x2F, 0xC0, 0x2F, 0xDF, 0xD0, 0x07,
-    0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xF8, 0x00, 0x0B, 0xFC, 0x00, 0x03,
-    0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x01,
-    0x94, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x3F, 0xEF, 0xFC, 0x00,
-    0x7F, 0x00, 0x18, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x03, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xC0, 0x07, 0xFE, 0x6F, 0xD0, 0x0F,
-    0xF0, 0x0F, 0xE0, 0x1F, 0xD0, 0x0F, 0xE0, 0x2F, 0xC0, 0x0F, 0xD0, 0x2F, 0xD0, 0x7F, 0xC0, 0x1F,
-    0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0xAE, 0x40, 0x00, 0x00,
-    0x15, 0x00, 0x03, 0xFF, 0x00, 0x3D, 0x0D, 0x01, 0xC0, 0x10, 0x03, 0xE4, 0x00, 0x1F, 0xE0, 0x01,
-    0xF4, 0x10, 0x0B, 0x42, 0xE0, 0x3D, 0x0F, 0x40, 0xBF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x54, 0x00,
-    0x00, 0x1A, 0xAA, 0x90, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x7F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0x0B, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0xAF,
-    0xE0, 0x01, 0xBF, 0xFF, 0xF0, 0x01, 0xFF, 0xEF, 0xD0, 0x0F, 0xF0, 0x0F, 0x80, 0x3F, 0x00, 0x7E,
-    0x01, 0xF8, 0x02, 0xF4, 0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40, 0x3F, 0x01, 0xFC, 0x02, 0xF8, 0x0B,
-    0xF0, 0x0F, 0xD0, 0x3F, 0x80, 0x3F, 0x41, 0xFE, 0x01, 0xFC, 0x0B, 0xF4, 0x0F, 0xF0, 0x00, 0x00,
-    0x3F, 0x80, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xA9,
-    0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x3F, 0x43, 0xF0, 0x00, 0xBD, 0x01,
-    0xF0, 0x01, 0xFC, 0x01, 0xF0, 0x03, 0xF4, 0x02, 0xF0, 0x03, 0xFE, 0xAB, 0xF0, 0x0B, 0xFF, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xD0, 0x0F, 0xD0, 0x1F, 0xD0, 0x2F, 0xC0, 0x1F, 0xE0, 0xBF,
-    0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x01, 0xBE, 0x40, 0x00, 0x00, 0x68, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF4, 0x02,
-    0xF0, 0x03, 0xF0, 0x07, 0xE0, 0x0B, 0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x2F, 0xC0, 0x3F, 0xFC, 0x7F,
-    0xF8, 0xBF, 0xF4, 0x00, 0xBC, 0x7E, 0x00, 0x3D, 0x3F, 0x00, 0x1F, 0x3F, 0x00, 0x0B, 0xBF, 0x00,
-    0x03, 0xFF, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xE0, 0x00, 0x2F, 0xFD, 0x00,
-    0x0F, 0xBF, 0xD0, 0x07, 0xD7, 0xFC, 0x02, 0xF0, 0xBF, 0xC0, 0x69, 0x40, 0x00, 0x00, 0x1F, 0xFD,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x2F, 0xC7,
-    0xE0, 0x00, 0x0F, 0xE0, 0xFD, 0x00, 0x03, 0xF4, 0x1F, 0xC0, 0x01, 0xFC, 0x02, 0xF4, 0x00, 0xBF,
-    0x00, 0x3F, 0x00, 0x3F, 0x40, 0x0B, 0xE0, 0x00, 0x1F, 0xC0, 0x1F, 0x80, 0x0B, 0xD0, 0x0B, 0xD0,
-    0x02, 0xF0, 0x03, 0xF0, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0xBE, 0x00, 0x2F, 0x40, 0x3F,
-    0x80, 0x0F, 0xD0, 0x1F, 0xD0, 0x07, 0xF0, 0x0F, 0xF0, 0x03, 0xFF, 0x9F, 0xFC, 0x01, 0xFF, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x3D, 0xBF, 0xEF, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x2F, 0x4B, 0xE0, 0x0F, 0xD2, 0xFC, 0x03,
-    0xF0, 0x7F, 0x01, 0xFC, 0x0F, 0xD0, 0xBE, 0x03, 0xF8, 0x3F, 0x40, 0xFF, 0x2F, 0xC0, 0x2F, 0xDF,
-    0xE0, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xF4, 0x00, 0x7F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x06, 0xAA, 0xA4, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x40, 0x7F, 0xF0, 0x07, 0xFF, 0x80,
-    0x3F, 0xFE, 0x00, 0xFF, 0xF4, 0x02, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x7F, 0x50, 0x03, 0xF0, 0x00,
-    0x0F, 0xE4, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC,
-    0x00, 0x7F, 0xD0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0,
-    0x03, 0xFE, 0xBF, 0x80, 0xBF, 0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x00, 0xFC, 0x3F, 0x00,
-    0x2F, 0x83, 0xF8, 0x1F, 0xF0, 0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00,
-    0x2F, 0xE4, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xD1, 0xBF, 0xEF, 0xFA, 0x00, 0xFC,
-    0x2F, 0x40, 0x03, 0xF0, 0xFC, 0x00, 0x2F, 0x87, 0xE0, 0x00, 0xFC, 0x3F, 0x40, 0x03, 0xF0, 0xFC,
-    0x00, 0x2F, 0x4B, 0xE0, 0x00, 0xFC, 0x3F, 0xF0, 0x07, 0xF0, 0xFF, 0xC0, 0x1A, 0x40, 0x69, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F,
-    0xD0, 0xF8, 0x00, 0x07, 0xF4, 0x07, 0xC0, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0x1F, 0xD0, 0x0B, 0x80,
-    0x03, 0xFC, 0x00, 0xF8, 0x00, 0x3F, 0xC0, 0x1F, 0x00, 0x0B, 0xFE, 0x5B, 0xE0, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0x4A, 0x90, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x7F, 0xFF, 0x07, 0xF9, 0xBD, 0x3F, 0x00, 0x64, 0xF8,
-    0x00, 0x07, 0xD0, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x03,
-    0xF8, 0x00, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFE, 0x03, 0xFE, 0xBF, 0xD5, 0x40, 0xBF, 0x00, 0xFC, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x03, 0xF8, 0x1F, 0xF0,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x2F,
-    0xE4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xC6, 0xAB, 0xFA, 0xA0, 0x01, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00,
-    0x03, 0xFF, 0x40, 0x00, 0xFF, 0xC0, 0x00, 0x05, 0x90, 0x00, 0x03, 0xF0, 0xBC, 0x03, 0xE0, 0x3E,
-    0x03, 0xD0, 0x3E, 0x07, 0xD0, 0x3E, 0x0B, 0xC0, 0x3E, 0x0F, 0xC0, 0x3E, 0x0F, 0xC0, 0x7D, 0x0F,
-    0x80, 0xBC, 0x1F, 0xD6, 0xFC, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xBE, 0x2F, 0xE0, 0x00, 0xFF, 0x4F, 0x43, 0xFC,
-    0x00, 0xBF, 0x47, 0xC0, 0xBF, 0x00, 0x3F, 0x82, 0xF0, 0x2F, 0xC0, 0x1F, 0xC0, 0xFC, 0x0B, 0xF0,
-    0x0F, 0xF0, 0x3E, 0x03, 0xFC, 0x03, 0xF4, 0x0F, 0x40, 0xFE, 0x01, 0xFD, 0x07, 0xC0, 0x7F, 0x40,
-    0xBF, 0x42, 0xF0, 0x7F, 0xC0, 0x2F, 0xF4, 0xFD, 0xBF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x2F, 0xF0, 0x03, 0xF4, 0x00, 0x3F,
-    0xFC, 0x0F, 0xD0, 0x00, 0x2F, 0xFD, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0x80,
-    0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xCF, 0xE0, 0x00, 0x01, 0xFF, 0x0F, 0xFF, 0x80, 0x07, 0xFC, 0x0B, 0xFF, 0x40, 0x1F,
-    0xF4, 0x07, 0xFF, 0x00, 0x3F, 0xD0, 0x01, 0xBF, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFC, 0x1D, 0x03, 0xFF, 0x07, 0xC0, 0xFB, 0xC1, 0xF0,
-    0x7E, 0xE0, 0x7C, 0x2F, 0xB8, 0x1F, 0x0F, 0xED, 0x0B, 0xC3, 0xFB, 0x43, 0xF0, 0xFB, 0xD0, 0xF8,
-    0x7F, 0xF5, 0xFD, 0x1F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0x06, 0xF9, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFC, 0x07, 0xF4, 0x00, 0xFC,
-    0x0F, 0xE0, 0x00, 0xBC, 0x2F, 0xC0, 0x40, 0xBC, 0x3F, 0x07, 0xC0, 0xFC, 0x7F, 0x0B, 0x80, 0xFC,
-    0xBD, 0x0F, 0x42, 0xF8, 0xBE, 0x2F, 0x4B, 0xF0, 0xBF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFB, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00,
-    0x07, 0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC,
-    0x1F, 0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0xFF, 0xFF, 0x80,
-    0x0F, 0xEB, 0xFD, 0x00, 0xBC, 0x03, 0xF0, 0x07, 0xD0, 0x0F, 0xC0, 0x2E, 0x00, 0x3F, 0x00, 0xF0,
-    0x00, 0xFC, 0x03, 0xC0, 0x0B, 0xE0, 0x1F, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x6A,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0,
-    0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x07,
-    0xF7, 0xF0, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0xFE, 0x03, 0xF4, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x03, 0xFC, 0x1F,
-    0xE0, 0x00, 0x3F, 0xD3, 0xFC, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x6D, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0xFE, 0xBF, 0xD0, 0x2F,
-    0x00, 0xFC, 0x07, 0xD0, 0x0F, 0xC0, 0xB8, 0x00, 0xFC, 0x0F, 0x00, 0x0F, 0xC0, 0xF0, 0x02, 0xF8,
-    0x1F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xF4, 0x0F, 0xFF, 0xFF, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x7F,
-    0x7F, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x07, 0xC0, 0x02, 0xF4, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0x80, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xAF, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40, 0x3F,
-    0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x00, 0xF0, 0x02, 0xF8,
-    0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00,
-    0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
-    0x02, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F,
-    0xBF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x3F,
-    0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x80,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0,
-    0x00, 0x3F, 0xD0, 0x02, 0xA0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0x3F, 0x7F, 0x40, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF7, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xEB, 0xFD, 0x00, 0xBC, 0x03, 0xF0, 0x07,
-    0xD0, 0x0F, 0xC0, 0x2E, 0x00, 0x3F, 0x00, 0xF0, 0x00, 0xFC, 0x03, 0xC0, 0x0B, 0xE0, 0x1F, 0xFF,
-    0xFF, 0x40, 0x3F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x07,
-    0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x7F, 0x7F,
-    0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40,
-    0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0,
-    0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x02, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xE7, 0xF4, 0x00, 0x00, 0x1F, 0x80, 0x7E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xBF, 0xD0, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x00, 0x07, 0xD0, 0x0F,
-    0xC0, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x00, 0x2F, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00,
-    0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x2D, 0x00,
-    0x00, 0x00, 0x3F, 0xDB, 0x40, 0x00, 0x00, 0x1E, 0x7F, 0xC0, 0x00, 0x00, 0x0B, 0x4B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xF9, 0xFC, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00,
-    0x1F, 0xDF, 0xC0, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xB0, 0x00, 0x03, 0xFD, 0xF0, 0x00,
-    0x0B, 0x9F, 0xE0, 0x00, 0x0B, 0x4B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0xD7, 0xF0, 0x00,
-    0x2F, 0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-    0xFE, 0xBF, 0xD0, 0x02, 0xF0, 0x0F, 0xC0, 0x07, 0xD0, 0x0F, 0xC0, 0x0B, 0x80, 0x0F, 0xC0, 0x0F,
-    0x00, 0x0F, 0xC0, 0x0F, 0x00, 0x2F, 0x80, 0x1F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0x6F, 0x80, 0x00,
-    0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xEF, 0xC0,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0xF4, 0xFC, 0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00,
-    0xFC, 0x0F, 0xD0, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0x0F, 0xF4, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xDF, 0xD0, 0x00, 0x3F, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x3F, 0xAF, 0xF4, 0x00, 0xBC, 0x03, 0xF0, 0x01, 0xF4, 0x03, 0xF0, 0x02, 0xE0, 0x03, 0xF0, 0x03,
-    0xC0, 0x03, 0xF0, 0x03, 0xC0, 0x0B, 0xE0, 0x07, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x6A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x3E, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00,
-    0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00,
-    0x00, 0x3F, 0x80, 0xFD, 0x00, 0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFC, 0x00, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xDF, 0x80, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xAF, 0xF4, 0x00, 0x2F, 0x00, 0xFC, 0x00,
-    0x1F, 0x40, 0x3F, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x02, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xE7,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3E, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00,
-    0x00, 0x00, 0xBE, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x80, 0xFD, 0x00,
-    0x00, 0x2F, 0xC0, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x01,
-    0xFE, 0x00, 0x03, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x1F,
-    0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDF, 0x80, 0x00, 0x3F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xAF, 0xF4, 0x00, 0x2F, 0x00, 0xFC, 0x00, 0x1F, 0x40, 0x3F, 0x00, 0x0B,
-    0x80, 0x0F, 0xC0, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0xF0, 0x02, 0xF8, 0x00, 0x7F, 0xFF, 0xFD, 0x00,
-    0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0xBF,
-    0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xBE, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0,
-    0x00, 0x00, 0x2F, 0x83, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0xFD, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40,
-    0x00, 0x0B, 0xF0, 0x0F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00,
-    0x7F, 0x80, 0x00, 0xFF, 0x40, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x01, 0xF8,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x03,
-    0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0xF7, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xEB, 0xFD, 0x00, 0x0B, 0xC0, 0x3F, 0x00,
-    0x07, 0xD0, 0x0F, 0xC0, 0x02, 0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x3C, 0x00, 0xBE,
-    0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0B, 0xF9,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD2, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x3C, 0x00, 0x00, 0x00,
-    0x2E, 0xF7, 0xC0, 0x00, 0x00, 0x03, 0xC7, 0xF4, 0x00, 0x00, 0x00, 0x2C, 0x2E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0x07, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x02, 0xF8, 0x3F, 0x00,
-    0x00, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xE0, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x03, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x03,
-    0xFD, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC,
-    0x3C, 0x00, 0x00, 0x1F, 0xF7, 0xC0, 0x00, 0x03, 0xCB, 0xF4, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x01, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF7, 0xE0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0xBF, 0xD0, 0x00, 0x2F, 0x00,
-    0xFC, 0x00, 0x07, 0xD0, 0x0F, 0xC0, 0x00, 0xB8, 0x00, 0xFC, 0x00, 0x0F, 0x00, 0x0F, 0xC0, 0x00,
-    0xF0, 0x02, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF,
-    0x00, 0x00, 0x2F, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x07,
-    0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xBF, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xC0, 0x00,
-    0x00, 0x0F, 0xD3, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x03, 0xF0, 0x3F, 0x40, 0x00,
-    0x03, 0xF8, 0x0F, 0xD0, 0x00, 0x02, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xD0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFD, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xAF, 0xF4, 0x00,
-    0x0B, 0xC0, 0x3F, 0x00, 0x01, 0xF4, 0x03, 0xF0, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x03, 0xC0, 0x03,
-    0xF0, 0x00, 0x3C, 0x00, 0xBE, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x03,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x06, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF,
-    0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x0B, 0xE4, 0x7D, 0x00, 0xBE, 0x56, 0xF8,
-    0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0x80, 0xFD, 0x54, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-    0xFA, 0xAB, 0x80, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF,
-    0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x07, 0x80,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x02,
-    0xF9, 0x1F, 0x40, 0xBE, 0x56, 0xF8, 0x0F, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xF8, 0x3F, 0x55, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x03, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFC, 0x00, 0x2F,
-    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x3C, 0x00, 0x00, 0x1F, 0xF3, 0xC0,
-    0x00, 0x03, 0xDB, 0xF8, 0x00, 0x00, 0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFC, 0x00,
-    0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x38,
-    0x00, 0x0B, 0xF9, 0xE0, 0x00, 0x3C, 0xFF, 0x40, 0x00, 0xF1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x02, 0xF9, 0x1F, 0x40, 0x2F, 0x95, 0xBE,
-    0x00, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xE0, 0x3F, 0x55, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03,
-    0xFE, 0xAA, 0xE0, 0x0F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00,
-    0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x00, 0x00, 0x2F,
-    0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0xFE, 0x40,
-    0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA,
-    0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1E,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x0B, 0xFF, 0x00, 0x03, 0xF0, 0x00,
-    0x7F, 0x7F, 0x40, 0x2F, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x02, 0xF9, 0x1F,
-    0x40, 0x00, 0x00, 0x2F, 0x95, 0xBE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0x55, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0xAA, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x0B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x7F,
-    0x6F, 0x80, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0xAA, 0x80, 0x00,
-    0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x07, 0xF7,
-    0xF0, 0x00, 0x3E, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x2F, 0x91, 0xF4, 0x02,
-    0xF9, 0x5B, 0xE0, 0x0F, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFE, 0x03, 0xF5, 0x50, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0xDB, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xBF, 0xFF, 0x00,
-    0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFA, 0xAA, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x03, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xE7, 0xF4, 0x00, 0x00, 0x2F, 0x40, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x02, 0xF9, 0x1F, 0x40, 0x00, 0x0B,
-    0xE5, 0x6F, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0x55,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xEA, 0xAE, 0x00, 0x00, 0x3F, 0xFF, 0xFD,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x00, 0x01, 0xF4, 0xB0, 0x00, 0x00, 0x3F, 0xDF, 0x00, 0x00, 0x0B, 0x9F, 0xE0, 0x00, 0x00,
-    0xB4, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFD, 0x7F, 0x00, 0x00, 0x2F,
-    0x40, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0x80,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x03,
-    0xFF, 0xFF, 0x40, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE1, 0x90, 0x00, 0x00, 0xBF,
-    0x6E, 0x00, 0x00, 0x0F, 0x7F, 0xC0, 0x00, 0x01, 0xE2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00,
-    0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0xBF, 0xFF, 0x00, 0x00, 0x2F, 0x91, 0xF4, 0x00, 0x0B, 0xE5, 0x6F, 0x80, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x03, 0xF5, 0x50, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03,
-    0xFE, 0xAA, 0xE0, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x2F, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xF8, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
-    0xFF, 0xF4, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0xFF, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x1F, 0xDF, 0xD0, 0x00, 0x3E, 0x02, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0xBE, 0x47, 0xD0, 0x02, 0xF9, 0x5B, 0xE0, 0x03,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xE0, 0x0F, 0xD5, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F,
-    0xFA, 0xAB, 0x80, 0x0F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x6A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x07,
-    0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x3F, 0xD0,
-    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xE0, 0x00, 0x7C, 0x00, 0x0A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-    0x1F, 0x40, 0x02, 0xF0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xBD, 0x00, 0x0F, 0xC0, 0x01, 0xFC,
-    0x00, 0x2F, 0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40,
-    0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xFC, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03,
-    0xFC, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B,
-    0xF0, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF,
-    0x40, 0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x02,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x0B,
-    0xFF, 0xF0, 0x00, 0x3F, 0xEB, 0xF8, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x02, 0xF4,
-    0x00, 0xFC, 0x03, 0xF0, 0x02, 0xF8, 0x03, 0xF8, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF,
-    0x40, 0x00, 0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0,
-    0x00, 0x03, 0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40,
-    0x00, 0x7F, 0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x03, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xF0, 0x03, 0xFE, 0xBF, 0x80, 0xBF,
-    0x00, 0xFC, 0x0F, 0xC0, 0x0F, 0xC2, 0xF4, 0x00, 0xFC, 0x3F, 0x00, 0x2F, 0x83, 0xF8, 0x1F, 0xF0,
-    0x3F, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x3C,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xFD, 0xBE, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0B,
-    0xC7, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00,
-    0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x07, 0xF0, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xD0,
-    0x00, 0x03, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x00,
-    0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF,
-    0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xC0,
-    0x00, 0xBF, 0xF4, 0x00, 0x50, 0x00, 0x1F, 0xDB, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF0, 0x00,
-    0x00, 0x03, 0xFE, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF8, 0x1F, 0xF0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x0B, 0x80,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF,
-    0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x0B, 0xF8, 0x00, 0x3F, 0xD0, 0x00,
-    0xFF, 0x00, 0x2F, 0xD0, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x00, 0x0B, 0xF0, 0x07, 0xF0, 0x00, 0x02,
-    0xFC, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0x40, 0x00, 0x2F,
-    0xD0, 0x2F, 0xD0, 0x00, 0x1F, 0xF0, 0x0B, 0xFE, 0x41, 0x7F, 0xF8, 0x02, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x01, 0xFD, 0xBE, 0x00, 0x3F, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFF, 0x00, 0x3F, 0xEB, 0xF8, 0x0B, 0xF0, 0x0F, 0xC0,
-    0xFC, 0x00, 0xFC, 0x2F, 0x40, 0x0F, 0xC3, 0xF0, 0x02, 0xF8, 0x3F, 0x81, 0xFF, 0x03, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0x41, 0xD0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xF6, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0F, 0xF8, 0x02, 0xFE, 0x00, 0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x0B, 0xF4, 0x00, 0x0B, 0xF0,
-    0x03, 0xF8, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-    0x3F, 0x40, 0x00, 0x0F, 0xE0, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x0B, 0xF4, 0x00, 0x07, 0xFC, 0x02,
-    0xFF, 0x90, 0x5F, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x03,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00,
-    0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x07, 0xF7, 0xF4, 0x00, 0x00, 0x3F, 0x01, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x00, 0xBF,
-    0xFF, 0x00, 0x00, 0x0F, 0xFA, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0xBE, 0x00, 0x03, 0xF8, 0x1F, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF4, 0xB4, 0x00, 0x00, 0x00,
-    0xFF, 0x3C, 0x00, 0x00, 0x00, 0x79, 0xFF, 0x00, 0x00, 0x00, 0x2D, 0x3F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xEB, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x2F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0x80, 0x2F, 0xE0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0xBF, 0x40, 0x00,
-    0xBF, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x03,
-    0xFC, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0x00, 0x7F,
-    0xC0, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD1, 0x80, 0x00, 0x3F, 0xCB, 0x40, 0x01, 0xEB,
-    0x7C, 0x00, 0x0F, 0x5F, 0xE0, 0x00, 0x2D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x0B, 0xD0, 0x2F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x3F, 0xEB, 0xF8, 0x02, 0xFC,
-    0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0xC0, 0xBD, 0x00, 0x3F, 0x03, 0xF0, 0x02, 0xF8, 0x0F, 0xE0, 0x7F,
-    0xC0, 0x3F, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFD, 0xBE, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x80, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x02,
-    0xFD, 0x00, 0x02, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x07, 0xF4, 0x00, 0x02, 0xFD, 0x02, 0xFD,
-    0x00, 0x01, 0xFF, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
-    0x00, 0x00, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x7F, 0x6F, 0x80, 0x03, 0xF0, 0x0B, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0xC0, 0x03, 0xFE, 0xBF, 0x80, 0x2F, 0xC0,
-    0x3F, 0x00, 0xFC, 0x00, 0xFC, 0x0B, 0xD0, 0x03, 0xF0, 0x3F, 0x00, 0x2F, 0x80, 0xFE, 0x07, 0xFC,
-    0x03, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0B, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0A, 0xA0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7F,
-    0xF4, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xBE, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x7F, 0x00,
-    0x03, 0xFE, 0x00, 0xBF, 0x8E, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0x02,
-    0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x3F,
-    0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF4, 0x00, 0x02, 0xFD,
-    0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x17, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x6F, 0xE0, 0xBC, 0x00, 0xBF, 0xFF, 0x7D, 0x00, 0xFF, 0xAF, 0xFF, 0x00, 0xBF,
-    0x00, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F, 0xC0, 0x0B, 0xE0, 0x03,
-    0xF8, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0xBC, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xBE, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x7F, 0x00, 0x03, 0xFE, 0x00, 0xBF, 0x8E, 0x00, 0x03, 0xFD, 0x00, 0x0F, 0xF0, 0x00,
-    0x02, 0xFD, 0x00, 0x02, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x03, 0xF8, 0x00, 0x07,
-    0xF4, 0x00, 0x02, 0xFD, 0x00, 0x02, 0xFD, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0xE4, 0x17, 0xFF,
-    0x80, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x6F, 0xE0, 0xBC, 0x00, 0xBF, 0xFF, 0x7D, 0x00, 0xFF,
-    0xAF, 0xFF, 0x00, 0xBF, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x0F,
-    0xC0, 0x0B, 0xE0, 0x03, 0xF8, 0x1F, 0xF0, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0xFD, 0x00,
-    0x2F, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x00, 0xFF,
-    0x80, 0x2F, 0xE3, 0x80, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00,
-    0x00, 0x3F, 0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00,
-    0xBF, 0x40, 0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x1B, 0xF8, 0x2F, 0x00, 0x2F, 0xFF, 0xDF, 0x40, 0x3F, 0xEB, 0xFF,
-    0xC0, 0x2F, 0xC0, 0x3F, 0x80, 0x0F, 0xC0, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0xF0, 0x03, 0xF0, 0x02,
-    0xF8, 0x00, 0xFE, 0x07, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xE2, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x2F, 0x00,
-    0x00, 0xBF, 0xFF, 0xF0, 0x2F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x00, 0xFF, 0x80, 0x2F,
-    0xE3, 0x80, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x2F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFD, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x40,
-    0x00, 0x7F, 0xC0, 0x00, 0x2F, 0xF9, 0x05, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x7F, 0xCF, 0x00, 0x00, 0x2D, 0xBF,
-    0x80, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x64, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x06, 0xFE, 0x0B, 0xC0, 0x0B, 0xFF, 0xF7, 0xD0, 0x0F,
-    0xFA, 0xFF, 0xF0, 0x0B, 0xF0, 0x0F, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x02, 0xF4, 0x00, 0xFC, 0x00,
-    0xFC, 0x00, 0xBE, 0x00, 0x3F, 0x81, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xC0,
-    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x02, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x02, 0xF0, 0x00, 0x0B, 0xFF,
-    0xFF, 0x02, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0xFC, 0x00, 0x0F, 0xF8, 0x02, 0xFE, 0x38, 0x00,
-    0x0F, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x02,
-    0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F,
-    0x40, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xD0, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x07, 0xFC,
-    0x00, 0x02, 0xFF, 0x90, 0x5F, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x02, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x1B, 0xF8, 0x2F, 0x00, 0x02, 0xFF, 0xFD, 0xF4, 0x00, 0x3F, 0xEB, 0xFF, 0xC0, 0x02, 0xFC,
-    0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x02, 0xF8,
-    0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x02, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x02,
-    0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0x00, 0x0F,
-    0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x02, 0xFD, 0x00, 0x2F, 0xD0, 0x00, 0xFF,
-    0x00, 0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x1F, 0xD0, 0x01, 0xFE, 0x00, 0x0B, 0xF8,
-    0x01, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0xFC,
-    0x01, 0xFC, 0x00, 0xF8, 0x02, 0xF8, 0x01, 0xF4, 0x03, 0xF8, 0x02, 0xF4, 0x07, 0xF4, 0x02, 0xF0,
-    0x0F, 0xF0, 0x03, 0xFE, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0xBF,
-    0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xC0, 0x03,
-    0xFD, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x2F,
-    0xD0, 0x02, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x01, 0xFE,
-    0x00, 0x1F, 0xF0, 0x00, 0xBF, 0x40, 0x0B, 0xF4, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x0F, 0xE0,
-    0x00, 0xFF, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x02, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0xBC, 0x00, 0xBD,
-    0x0B, 0xC0, 0x0F, 0xC0, 0xFC, 0x01, 0xFC, 0x0F, 0x80, 0x2F, 0x81, 0xF4, 0x03, 0xF8, 0x2F, 0x40,
-    0x7F, 0x42, 0xF0, 0x0F, 0xF0, 0x3F, 0xE7, 0xFF, 0x03, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x00,
-    0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFC,
-    0x00, 0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x02,
-    0xFD, 0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00,
-    0x01, 0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x50, 0x07, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x1F,
-    0xFC, 0x0B, 0xC0, 0x0B, 0xFC, 0x02, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3E, 0x00,
-    0xBE, 0x00, 0x1F, 0x40, 0x3F, 0x80, 0x0B, 0xD0, 0x1F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFF,
-    0x9F, 0xFC, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xEF, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x3F,
-    0xE0, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xD0, 0x00,
-    0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xD0,
-    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F,
-    0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x01, 0xFD, 0x00,
-    0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-    0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x01, 0xF4, 0x1F, 0x40, 0x1F, 0xFC, 0x0B, 0xC0,
-    0x0B, 0xFC, 0x02, 0xF0, 0x03, 0xF8, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0xBE, 0x00, 0x1F,
-    0x40, 0x3F, 0x80, 0x0B, 0xD0, 0x1F, 0xD0, 0x02, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x9F, 0xFC, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0xBF, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x03, 0xFD, 0x00, 0x3F, 0xF4, 0x00, 0x1F, 0xF0, 0x00,
-    0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFD, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF0,
-    0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B,
-    0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00,
-    0x07, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x07, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x7D,
-    0x07, 0xD0, 0x07, 0xFF, 0x02, 0xF0, 0x02, 0xFF, 0x00, 0xBC, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x7F,
-    0x00, 0x0F, 0x80, 0x2F, 0x80, 0x07, 0xD0, 0x0F, 0xE0, 0x02, 0xF4, 0x07, 0xF4, 0x00, 0xBC, 0x03,
-    0xFC, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x2F,
-    0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xF6, 0xD0, 0x00, 0x00,
-    0x00, 0x7D, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xE2, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFF, 0x80, 0x0B, 0xFF, 0x40, 0x03, 0xFD, 0x00,
-    0x3F, 0xF4, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0xC0, 0x07, 0xFC, 0x00, 0x02, 0xFD,
-    0x00, 0x2F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x01,
-    0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x3F, 0xC0, 0x03, 0xFC, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF4, 0x00, 0x7F, 0x80, 0x00, 0x2F, 0xE0, 0x07, 0xFC,
-    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0xA0, 0x00, 0x01, 0xFE, 0x3C, 0x00, 0x00, 0xF7, 0xDE,
-    0x00, 0x00, 0x3C, 0xBF, 0x40, 0x00, 0x0F, 0x0F, 0x85, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x07, 0xFF, 0x02, 0xF0, 0x02, 0xFF, 0x00, 0xBC,
-    0x00, 0xFE, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x0F, 0x80, 0x2F, 0x80, 0x07, 0xD0, 0x0F, 0xE0, 0x02,
-    0xF4, 0x07, 0xF4, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x3F, 0xE7, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x2F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x3F, 0xE0, 0x02, 0xFF, 0xD0, 0x00, 0xFF, 0x40, 0x0F, 0xFD, 0x00, 0x07, 0xFC, 0x00, 0x3F,
-    0xD0, 0x00, 0x2F, 0xF0, 0x01, 0xFF, 0x00, 0x00, 0xBF, 0x40, 0x0B, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-    0x3F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x02, 0xFD,
-    0x00, 0x2F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFC, 0x00, 0x01,
-    0xFD, 0x00, 0x1F, 0xE0, 0x00, 0x0B, 0xF8, 0x01, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x7D, 0x00, 0x7F, 0xF0, 0x02, 0xF0, 0x02, 0xFF, 0x00, 0x0B, 0xC0,
-    0x0F, 0xE0, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0xF8, 0x02, 0xF8, 0x00, 0x07, 0xD0, 0x0F, 0xE0,
-    0x00, 0x2F, 0x40, 0x7F, 0x40, 0x00, 0xBC, 0x03, 0xFC, 0x00, 0x03, 0xFE, 0x7F, 0xF0, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x07, 0xE0, 0x02, 0xFC, 0x03, 0xF0, 0x00, 0x7F, 0x02, 0xF8,
-    0x00, 0x0F, 0xD0, 0xFC, 0x00, 0x03, 0xF8, 0xBD, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x2F, 0xFF,
-    0x40, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0xFE, 0x00, 0x7F, 0x40, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x0B, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xD0,
-    0x00, 0x3F, 0xC0, 0x7F, 0x80, 0x00, 0x2F, 0xD0, 0xFF, 0x00, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x00,
-    0x0F, 0xFB, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x6A, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0x40, 0x3F, 0x40, 0x1F, 0x80, 0x0B, 0xF0, 0x0F, 0xC0, 0x01, 0xFC, 0x0B, 0xE0, 0x00, 0x3F,
-    0x43, 0xF0, 0x00, 0x0F, 0xE2, 0xF4, 0x00, 0x03, 0xFD, 0xFC, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x02, 0xBF, 0xF4, 0x00, 0x01, 0xFF, 0xFA, 0xA0,
-    0x00, 0xBF, 0xF9, 0xFC, 0x00, 0x3F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40,
-    0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F, 0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0,
-    0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03,
-    0xF4, 0x03, 0xF4, 0x01, 0xF8, 0x00, 0xBF, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0xBE, 0x00, 0x03, 0xF4,
-    0x3F, 0x00, 0x00, 0xFE, 0x2F, 0x40, 0x00, 0x3F, 0xDF, 0xC0, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x80, 0x00,
-    0x0B, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xA0, 0x00, 0x07, 0xFC,
-    0xF0, 0x00, 0x0B, 0x6F, 0xE0, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x00, 0x00, 0xFE, 0x7F, 0x40, 0x03, 0xFC, 0x3F, 0x80, 0x0B, 0xF0, 0x3F, 0xC0, 0x1F,
-    0xD0, 0x3F, 0xC0, 0x7F, 0x80, 0x2F, 0xD0, 0xFF, 0x00, 0x1F, 0xE3, 0xFC, 0x00, 0x0F, 0xFB, 0xF4,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0xE0, 0x00, 0x02, 0xFE, 0xB8, 0x00, 0x00, 0xF3, 0xFC, 0x00, 0x00, 0x3C, 0x7D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x7E,
-    0x00, 0x2F, 0xC0, 0x3F, 0x00, 0x07, 0xF0, 0x2F, 0x80, 0x00, 0xFD, 0x0F, 0xC0, 0x00, 0x3F, 0x8B,
-    0xD0, 0x00, 0x0F, 0xF7, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x15, 0x55,
-    0x55, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFD, 0x05, 0x55, 0x55, 0x55, 0x52, 0xFF, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF,
-    0xFC, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7D, 0x07, 0xD0, 0x02, 0xF0, 0x2F, 0x00, 0x0F,
-    0x80, 0xF8, 0x00, 0x3D, 0x03, 0xD0, 0x02, 0xF0, 0x1F, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x3D, 0x03,
-    0xD0, 0x01, 0xF0, 0x1F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x01, 0xF4, 0x1F, 0x40,
-    0x0B, 0xC0, 0xBC, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0xF4, 0x0F, 0x40, 0x07, 0xC0, 0x7C, 0x00, 0x3F,
-    0x03, 0xF0, 0x00, 0xF4, 0x0F, 0x80, 0x07, 0xC0, 0x7C, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55, 0x55,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF4, 0x2F, 0xFF, 0xFF, 0xFF, 0xF0, 0x15, 0x55,
-    0x55, 0x55, 0x50, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF,
-    0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x3F, 0xF0, 0x0F, 0xF0, 0x0B, 0xF8,
-    0x03, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xE0, 0x1F, 0xF0,
-    0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-    0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0xFF, 0x00, 0x2F, 0xF0, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x0B, 0xF8, 0x3F, 0xD0, 0x03,
-    0xFC, 0x0F, 0xF0, 0x02, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x4F, 0xFC, 0x03, 0xFF, 0x0F, 0xF8, 0x03, 0xFC, 0x0F, 0xF0, 0x0B, 0xF8, 0x2F, 0xD0, 0x0F,
-    0xF0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0x40, 0x7F, 0xC2, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x3F, 0xE0, 0x1F, 0xF0, 0x0F, 0xF4, 0x07, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xE1, 0xFF, 0x40, 0x3F, 0xF0, 0xFF, 0x80, 0x0F, 0xF0, 0x7F, 0xC0, 0x0B, 0xF8, 0x3F,
-    0xD0, 0x03, 0xFC, 0x0F, 0xF0, 0x02, 0xFF, 0x0B, 0xF8, 0x00, 0xFF, 0x43, 0xFD, 0x00, 0x00, 0xA4,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0xFF,
-    0xF0, 0x07, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0A, 0xBF, 0xEE, 0x00, 0xBF,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA,
-    0xA0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
-    0xFF, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x0B,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x78, 0x03, 0xFD, 0x0F, 0xFD, 0x7F, 0xFA, 0xFF, 0x4B, 0x80,
-    0x00, 0x00, 0x02, 0xA0, 0x1F, 0xC0, 0xFF, 0x07, 0xF8, 0x3F, 0xE0, 0x02, 0xA0, 0x1F, 0xC0, 0xFF,
-    0x07, 0xF8, 0x3F, 0xE0, 0x06, 0x90, 0x0A, 0x40, 0x29, 0x0F, 0xD0, 0x2F, 0xC0, 0xFE, 0x1F, 0xD0,
-    0x3F, 0x80, 0xFE, 0x3F, 0xC0, 0xBF, 0x82, 0xFD, 0x7F, 0xC0, 0xFF, 0x43, 0xFD, 0x14, 0x3D, 0x3D,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x03,
-    0xD8, 0x0B, 0xC0, 0x00, 0x1F, 0x60, 0xBD, 0x00, 0x00, 0xA3, 0x47, 0xD0, 0x00, 0x02, 0xFC, 0x7E,
-    0x00, 0x00, 0x07, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xFC,
-    0x28, 0x29, 0x00, 0x0F, 0xC2, 0x95, 0x98, 0x00, 0xFC, 0x0E, 0xDE, 0xD0, 0x0F, 0xD0, 0x3B, 0x3B,
-    0x00, 0xFE, 0x00, 0xB4, 0xB4, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC,
-    0x01, 0xFF, 0x00, 0x2F, 0xE0, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x1F, 0xF0, 0x03, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7, 0xFE, 0x01, 0xFF, 0x0B, 0xFC, 0x02, 0xFE, 0x0F, 0xF4, 0x03,
-    0xFC, 0x0F, 0xF0, 0x0B, 0xF8, 0x3F, 0xD0, 0x1F, 0xF0, 0xBF, 0xC0, 0x3F, 0xD0, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x0E, 0x02, 0xD0, 0x74, 0x2F, 0x43, 0xF0, 0xFC, 0x3F, 0x07, 0xD0, 0xF8, 0x3E,
-    0x0B, 0xC1, 0xF0, 0x7C, 0x0F, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x3F, 0x01,
-    0xF4, 0x0F, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x47, 0xE3, 0xF0, 0xFC, 0xBC, 0x1F,
-    0x0F, 0x43, 0xD2, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x07, 0x80, 0xB0, 0x3E, 0x0F,
-    0xC2, 0xF4, 0x3F, 0x0B, 0xC0, 0xF8, 0x1F, 0x43, 0xD0, 0xBC, 0x0B, 0x82, 0xE0, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x1F, 0x80, 0x00, 0xBF, 0xD0, 0x07, 0xFB, 0xF4, 0x2F, 0xD3,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xF0, 0x02, 0xF8, 0x03, 0xF4, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x01, 0xF8, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x00,
-    0x03, 0x80, 0x00, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x7F, 0x00, 0x0B, 0xF0, 0x07, 0xF8, 0x03, 0xFC,
-    0x00, 0xFC, 0x00, 0x2D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xCB, 0xFC, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xF4, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x0F, 0xFC, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xBF, 0xD0, 0x00, 0x00, 0x03, 0xFB,
-    0xFF, 0xFF, 0x00, 0xFD, 0x00, 0x0B, 0xF3, 0xFF, 0xFC, 0x01, 0xFC, 0x00, 0x0F, 0xF2, 0xFF, 0xF0,
-    0x03, 0xFC, 0x00, 0x1F, 0xE2, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x1A, 0x9B, 0xFF, 0xF0, 0x06, 0xA4,
-    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0x5F, 0xFF, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xF4, 0x0B,
-    0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF4,
-    0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0xC0, 0x00,
-    0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x00, 0x0F, 0xF4, 0x00,
-    0x0F, 0xF4, 0x00, 0x2F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFB, 0xF4, 0x00, 0x2E,
-    0xFC, 0x3F, 0x00, 0x00, 0x7E, 0x0F, 0xC0, 0x00, 0x2F, 0x43, 0xF0, 0x00, 0x0F, 0xD1, 0xF8, 0x00,
-    0x03, 0xF0, 0xFD, 0x00, 0x01, 0xFC, 0x7F, 0x00, 0x00, 0xBE, 0xBF, 0x40, 0x00, 0x3F, 0xFF, 0x40,
-    0x00, 0x1F, 0xFF, 0x40, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x80,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0xBF, 0xF0, 0x00, 0x00, 0x2A, 0xA8, 0x00, 0x00, 0x00, 0x15, 0x55, 0x54, 0x3F, 0xFF, 0xFD, 0x7F,
-    0xFF, 0xFC, 0x1E, 0x00, 0xB8, 0xBF, 0xFF, 0xD1, 0xFF, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x74, 0x80, 0x00, 0x0F, 0xBB, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFD,
-    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x15, 0xD6, 0x80, 0x00, 0xB2, 0xD3, 0xC9, 0x0D, 0xF7, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xBF, 0xE0, 0x0B, 0xF8, 0x7F, 0xE4, 0x2F, 0xFF, 0xFF, 0xF4, 0x3B, 0xCD, 0x8E,
-    0x10, 0x03, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0xBD, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2A, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x05,
-    0x40, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFE, 0x42, 0xF4, 0x7F, 0x80, 0xFD, 0x00, 0x28, 0x00, 0x7E, 0x0A, 0x00, 0x1F, 0x80, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x7F, 0x40, 0x00, 0x02, 0xFE, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFF,
-    0x80, 0x00, 0x0F, 0xFD, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00,
-    0x01, 0xFE, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x19, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02,
-    0xA8, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
-    0x00, 0x00, 0x04, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1C, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3E, 0x01,
-    0xFE, 0x42, 0xF4, 0x00, 0x3E, 0x00, 0xA0, 0x01, 0xF8, 0x00, 0x7D, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0xFC, 0x00, 0x00, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xBF, 0xC0, 0x0B, 0xE0, 0x00,
-    0x0B, 0xFF, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0xBF, 0x40, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xFC,
-    0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xD0, 0x00,
-    0x1F, 0xF8, 0x00, 0x2A, 0x80, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x05, 0x50, 0x00, 0x00, 0x01, 0xC2, 0xFF, 0xF8,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFD, 0x07, 0xF0, 0x00, 0x01, 0xFB, 0x40,
-    0x0B, 0xC0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x7F, 0xD0, 0x00, 0x0F, 0xD0, 0x2F, 0xFD, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0xC0, 0x00,
-    0x01, 0xFC, 0x0B, 0xF8, 0x00, 0x00, 0x02, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x02, 0x40, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-    0xFD, 0x00, 0x00, 0x02, 0xFF, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xFC, 0x3F, 0xC0, 0x00, 0x00, 0xBF,
-    0xE0, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x86, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x06, 0x90, 0x01, 0xF8, 0x00, 0x00,
-    0x3F, 0x40, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x7D, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xF0, 0x00,
-    0x00, 0x7F, 0xC0, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF0, 0x00, 0x00,
-    0x00, 0xFD, 0x3F, 0xC0, 0x00, 0x00, 0x07, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x46, 0xA4, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x38, 0xD2, 0xC3, 0x4E,
-    0xDD, 0x37, 0xB1, 0xD3, 0xC7, 0xFD, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x02, 0xC0, 0x2F, 0x02,
-    0xA8, 0x2C, 0xE1, 0xFF, 0xC0, 0x3D, 0x00, 0xF0, 0x00, 0x54, 0x03, 0xFE, 0x07, 0x00, 0x0B, 0x40,
-    0x0F, 0xF4, 0x00, 0x3C, 0x18, 0xB8, 0x3F, 0xF0, 0x2F, 0x80, 0x00, 0x15, 0x01, 0xFE, 0x03, 0x40,
-    0x0A, 0x40, 0x0F, 0xF8, 0x1E, 0x2C, 0x2C, 0x3C, 0x1F, 0xF0, 0x06, 0x40, 0x15, 0x51, 0xFF, 0xC0,
-    0x0F, 0x00, 0x74, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x03, 0x4D, 0x07, 0x1D, 0x03, 0xF8, 0x0E, 0x78, 0x2C, 0x3C, 0x3F, 0xF8, 0x1F, 0xE0, 0x00, 0x00,
-    0x02, 0xFC, 0x0E, 0x0D, 0x0C, 0x0D, 0x1C, 0x2C, 0x0F, 0xFC, 0x01, 0xB8, 0x3A, 0xF0, 0x3F, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF6, 0xFD, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x3F, 0xFB,
-    0xF8, 0x02, 0xFD, 0x03, 0xF0, 0x0F, 0xD0, 0x0F, 0x80, 0x3F, 0x00, 0x7E, 0x02, 0xF8, 0x02, 0xF4,
-    0x0F, 0xD0, 0x0F, 0xC0, 0x3F, 0x40, 0x7F, 0x02, 0xFC, 0x03, 0xFC, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F,
-    0x80, 0xBF, 0x40, 0x02, 0xE0, 0x0E, 0x34, 0x2D, 0x68, 0x3B, 0xB4, 0x77, 0xB4, 0x74, 0xF0, 0x7F,
-    0xD0, 0x3F, 0x80, 0x04, 0x00, 0x00, 0x50, 0x0F, 0xC0, 0x6E, 0x00, 0x74, 0x02, 0xC0, 0x0F, 0x00,
-    0x78, 0x0F, 0xFC, 0x7F, 0xE0, 0x02, 0xF8, 0x0B, 0xAD, 0x00, 0x0E, 0x00, 0x2D, 0x00, 0xB8, 0x03,
-    0xF0, 0x1F, 0xC0, 0x3F, 0xF4, 0x7F, 0xF0, 0x02, 0xF8, 0x06, 0x5D, 0x00, 0x0D, 0x01, 0x6C, 0x03,
-    0xF4, 0x00, 0x3C, 0x2F, 0xF4, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x20, 0x03, 0xC0, 0x3F, 0x03, 0x78,
-    0x38, 0xE2, 0xFF, 0xC1, 0x7D, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x0B, 0x00, 0x0F, 0xE0, 0x05,
-    0x78, 0x00, 0x78, 0x2F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x03, 0xE5, 0x0B, 0x00, 0x0F,
-    0xF4, 0x1F, 0x7C, 0x2C, 0x2C, 0x3C, 0x3C, 0x2F, 0xF0, 0x06, 0x40, 0x00, 0x01, 0xFF, 0xC1, 0x5F,
-    0x00, 0x74, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0B, 0x80, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0xE2, 0xC0, 0x70, 0xF0, 0x1E, 0xB4, 0x03, 0xF8, 0x03, 0x8B, 0x02, 0xC2, 0xC0, 0xBF, 0xE0, 0x0A,
-    0x90, 0x00, 0x01, 0xFC, 0x01, 0xD7, 0x80, 0xD0, 0xA0, 0x30, 0x38, 0x0E, 0xBD, 0x01, 0xFF, 0x00,
-    0x03, 0x80, 0xFF, 0xC0, 0x16, 0x40, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF4, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00,
-    0x02, 0xB8, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xF8, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x2D, 0x00,
-    0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0xB8, 0x00, 0x00, 0x00, 0xF4, 0xF0, 0x00, 0x00,
-    0x01, 0xF2, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFE, 0x3D, 0x00, 0x00, 0xFF, 0xFC, 0x7C,
-    0x00, 0x03, 0xFE, 0xB8, 0xF4, 0x00, 0x07, 0xFC, 0xF1, 0xF0, 0x00, 0x0F, 0xFA, 0xE3, 0xD0, 0x00,
-    0x0F, 0xF7, 0xC7, 0xC0, 0x00, 0x1F, 0xFB, 0xCB, 0x80, 0x00, 0x2F, 0xFF, 0x4F, 0x00, 0x00, 0x2F,
-    0xFF, 0x2F, 0xB0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xC7, 0xC0,
-    0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x00, 0x0F, 0x1F, 0x00, 0x00, 0x00, 0x1E, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFB, 0xC0, 0x0F, 0xF4,
-    0x1F, 0xFC, 0x01, 0xFF, 0x02, 0xF9, 0x40, 0x2F, 0xF0, 0x3E, 0x00, 0x02, 0xFF, 0xD7, 0xD7, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x00, 0x0B, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x01, 0x6F, 0x95, 0x50, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x40, 0x0B,
-    0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0xBF, 0x40, 0x0B, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x0F, 0xD0, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xC0,
-    0x00, 0x02, 0xFF, 0xC0, 0x2F, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0x40, 0x00, 0x07, 0xFF, 0xD0,
-    0x7F, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0xBF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0xFE, 0x00, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xC7, 0xF7, 0xF8, 0x00,
-    0x00, 0x7F, 0xC3, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xC3, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x83, 0xFF,
-    0xE0, 0x00, 0x02, 0xFF, 0x42, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0x01, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x7F, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x2A, 0xFF, 0xAA,
-    0xBF, 0xA4, 0x00, 0xBE, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFE, 0x90, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD5, 0xF8, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xF4, 0x00, 0x1F, 0xF4, 0x07, 0xD6, 0xFC, 0x00, 0x1F, 0xFE,
-    0x02, 0xFF, 0xFE, 0x00, 0x0B, 0x40, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xC0, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0xBE, 0x00, 0x2F, 0xD3, 0xF0, 0x00, 0x0F, 0xF8, 0x0F, 0xE0, 0xBC, 0x00, 0x00, 0x6F, 0x43,
-    0xF4, 0x3F, 0x40, 0x00, 0x03, 0xE1, 0xFD, 0x0F, 0xD0, 0x02, 0xD6, 0xF8, 0xBF, 0x07, 0xF4, 0x02,
-    0xFF, 0xFC, 0x3F, 0xC2, 0xFD, 0x00, 0xFF, 0xFD, 0x05, 0x50, 0x55, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x00, 0x0F, 0x80, 0x03,
-    0xE0, 0x00, 0x0F, 0x40, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x2E, 0x00, 0x03, 0xE0,
-    0xB4, 0x3D, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x17, 0xE7, 0xFD,
-    0xF9, 0x50, 0x03, 0xE7, 0xFD, 0xF0, 0x00, 0x03, 0xEF, 0xFE, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0x7F, 0xD0, 0x00, 0x03, 0xFE, 0x7F, 0xC0, 0x00, 0x03, 0xFC, 0x7F, 0x80, 0x00,
-    0x07, 0xFC, 0x7F, 0x40, 0x00, 0x07, 0xF4, 0x3F, 0x00, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-    0x69, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xC0, 0x3E, 0x01, 0xFF,
-    0x5B, 0xE0, 0x3D, 0x02, 0xF4, 0x02, 0xF0, 0xBC, 0x03, 0xE0, 0x01, 0xE0, 0xFC, 0x03, 0xC6, 0x82,
-    0xE0, 0xF8, 0x07, 0xCB, 0xC3, 0xD1, 0xF0, 0x0F, 0x8F, 0xC3, 0xC2, 0xF0, 0x0F, 0x4F, 0x87, 0xC3,
-    0xE0, 0x1F, 0x0F, 0x40, 0x07, 0xD0, 0x2F, 0x1F, 0x80, 0x0F, 0xC0, 0x3E, 0x0F, 0xE0, 0x2F, 0xC0,
-    0x3D, 0x0F, 0xFF, 0xFF, 0x80, 0x28, 0x02, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x16, 0xAF, 0x00, 0x00,
-    0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xFB, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x40,
-    0x00, 0x0B, 0xD7, 0xFC, 0x00, 0x00, 0x3C, 0x0B, 0xE0, 0x00, 0x02, 0xD0, 0x2F, 0x40, 0x00, 0x0F,
-    0x00, 0xFC, 0x00, 0x00, 0x3D, 0x1B, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xFF, 0xFD,
-    0x00, 0x00, 0x02, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x0F,
-    0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xF9, 0x05, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x06, 0xBF, 0xFA, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x00,
-    0x0F, 0xEA, 0xA0, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0A, 0xBF, 0x00, 0x00,
-    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xE1, 0x40, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-    0x03, 0xFF, 0xD0, 0x00, 0x01, 0x8F, 0xFB, 0xC0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF4,
-    0x00, 0x0F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x02, 0xAF, 0xF0, 0x00, 0x00, 0x0B, 0xF8,
-    0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xF8, 0x07, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xE9, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xEA, 0xB4, 0x03, 0xFF, 0x2F, 0x00, 0x00, 0x2F,
-    0xF0, 0xFC, 0x00, 0x00, 0xFF, 0x03, 0xE0, 0x00, 0x0B, 0xF8, 0x1F, 0x40, 0x00, 0x3F, 0xD0, 0xBD,
-    0x40, 0x00, 0xFF, 0x02, 0xFF, 0xFF, 0x47, 0xFC, 0x0F, 0xFF, 0xFD, 0x2F, 0xE0, 0x3E, 0xBF, 0xF4,
-    0xBF, 0xC1, 0xF0, 0xBF, 0x42, 0xFF, 0xDB, 0xDB, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x56, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x02, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x05, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x55, 0x55, 0x55, 0x50, 0x2F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x2F, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x3F, 0xE1,
-    0x6F, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x01, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
-    0x01, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x1B, 0xFC, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xEC, 0x0B, 0xFF,
-    0x80, 0x0F, 0xCF, 0x40, 0x2F, 0x9F, 0x00, 0x3F, 0x6F, 0x00, 0x3F, 0x3E, 0x00, 0x3F, 0xBF, 0x00,
-    0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0xF4, 0x00, 0x01, 0xA0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x01, 0x5F, 0xE5, 0x40, 0x00, 0x3D, 0x00, 0x0F, 0xFF, 0xFF, 0x40,
-    0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xD5, 0x02, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x66, 0xFD, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x02,
-    0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x02, 0xA9, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC,
-    0x04, 0x00, 0x1F, 0x9F, 0x80, 0x02, 0xFF, 0xF0, 0x01, 0xFF, 0xFE, 0x00, 0xBF, 0xF9, 0x50, 0x0F,
-    0xFF, 0xBD, 0x00, 0x9F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF5, 0x42, 0xFF, 0xE0, 0x7D, 0x3F, 0xF8, 0x2F,
-    0xC2, 0x5F, 0x6F, 0xF0, 0x02, 0xFF, 0xF8, 0x00, 0x3F, 0xF9, 0x00, 0x03, 0xA4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xCF, 0xC0, 0x0B, 0xEF, 0xCF, 0xC0, 0x0F, 0xCF, 0x8F, 0x80, 0x0F, 0x9F, 0x5F, 0x40, 0x1F, 0x2F,
-    0x2F, 0x00, 0x2F, 0x2F, 0x3F, 0x00, 0x3F, 0x3E, 0x3E, 0x00, 0x3E, 0x3D, 0x7D, 0x00, 0x7D, 0x7C,
-    0xFC, 0x00, 0xBD, 0xBC, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xAA, 0x40, 0x00,
-    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xFE, 0x01, 0xFC, 0x00,
-    0x00, 0x3F, 0x00, 0x2F, 0x00, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x02,
-    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFA, 0x40, 0x00, 0x15, 0x5F, 0xF9, 0x54, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x01, 0xB8, 0x0B, 0xC6, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFF, 0x43, 0xFF, 0xFE, 0x40, 0x3F, 0xF9, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x7F,
-    0xD0, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0xBF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0x7D, 0x7F, 0x8F, 0xD2, 0xF0, 0xBC,
-    0x18, 0x0F, 0xC0, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x79, 0x00, 0xBD, 0x01, 0xFF, 0xE4,
-    0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0xFF,
-    0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x03, 0x41, 0xF4, 0x14, 0x2F, 0x83,
-    0xE1, 0xF8, 0x3F, 0xDF, 0xCF, 0xF0, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xFF,
-    0x40, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-    0x00, 0x24, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x00, 0x01,
-    0xF0, 0x06, 0x90, 0x0F, 0x40, 0x03, 0xD6, 0xFF, 0xFF, 0x97, 0xC0, 0x0F, 0xFF, 0xFE, 0xBF, 0xFF,
-    0xF0, 0x1F, 0xFE, 0x40, 0x01, 0xBF, 0xF8, 0x3F, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF0, 0x00,
-    0x00, 0x0F, 0xF0, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x80, 0x00, 0x02, 0xF8, 0x00, 0x07, 0xFF, 0x40, 0x0B,
-    0xFF, 0xF4, 0x0F, 0xDF, 0x7F, 0x0F, 0xC7, 0xC7, 0xC0, 0x42, 0xE0, 0x40, 0x00, 0xF4, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xB8, 0x00, 0x2D, 0x1F, 0x0E, 0x0B, 0xE7, 0xCB, 0xD0,
-    0x7F, 0xFF, 0xE0, 0x02, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6A, 0x00, 0x16, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x90, 0x0F, 0xFE, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x80, 0x03, 0xF0, 0xBF, 0xD0, 0x0F, 0xC0, 0x7F, 0xF4, 0x3F, 0x40,
-    0x1F, 0xE0, 0xB8, 0x00, 0x0A, 0x00, 0x03, 0x94, 0x00, 0x00, 0x3F, 0xFF, 0x94, 0x02, 0xBF, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xBE, 0x02, 0xFF, 0x87, 0xE1, 0xFF,
-    0x80, 0xBE, 0x3F, 0xD0, 0x0B, 0xD0, 0xD0, 0x00, 0x7D, 0x05, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0F, 0xC0, 0x7C, 0x07, 0xD0, 0xB8, 0x03, 0xF0, 0xF4, 0x02, 0xF4, 0xF0, 0x00, 0xFD,
-    0xF0, 0x00, 0xBF, 0xE0, 0x10, 0x3F, 0xD0, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80,
-    0x00, 0x16, 0x40, 0x00, 0x01, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x2E, 0x02, 0xF0, 0x7C, 0x0F,
-    0x80, 0xF0, 0xBC, 0x03, 0xD3, 0xF0, 0x0B, 0xAF, 0x40, 0x1F, 0xFC, 0x00, 0x3F, 0xD0, 0x00, 0xFF,
-    0xFF, 0x42, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x0A, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0B, 0x5C, 0x00, 0x00,
-    0x02, 0xF2, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0x80, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x1F, 0xFD, 0xBF,
-    0xF4, 0x0B, 0xFB, 0xCF, 0xAF, 0xC3, 0xFC, 0x7C, 0xF4, 0xFE, 0x3E, 0x0F, 0x9F, 0x07, 0xC1, 0x80,
-    0xF2, 0xF0, 0x10, 0x00, 0x1F, 0x3E, 0x00, 0x00, 0x02, 0xE3, 0xD0, 0x00, 0x00, 0x3D, 0x7C, 0x00,
-    0x00, 0x03, 0xCB, 0xC0, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x0B, 0x8F, 0x00, 0x00, 0x00, 0x64,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xF8, 0x0B, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x02, 0xFD, 0x7F, 0xFF, 0xFF, 0xFD, 0x2F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0xF5, 0xF0, 0x00, 0x00, 0x0B, 0x8F, 0x40, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x03, 0xCB, 0xC0,
-    0x00, 0x00, 0x3D, 0x7C, 0x00, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0x0F, 0x3E, 0x00, 0x02, 0xC0,
-    0xF6, 0xF0, 0x30, 0x3F, 0x4B, 0x9F, 0x0B, 0xD1, 0xFD, 0x7C, 0xF5, 0xFD, 0x07, 0xFF, 0xCB, 0xFF,
-    0x80, 0x0F, 0xFD, 0x7F, 0xF0, 0x00, 0x2F, 0xE3, 0xFC, 0x00, 0x00, 0xBF, 0x3F, 0x40, 0x00, 0x01,
-    0xF2, 0xE0, 0x00, 0x00, 0x03, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x90, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x07,
-    0xE0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x2F, 0xE0, 0x03, 0xFD, 0x00, 0x02, 0xFC, 0x01, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x3D, 0x00,
-    0x00, 0x02, 0x40, 0x05, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x03, 0xFF,
-    0xE4, 0x00, 0x3F, 0xBF, 0xFD, 0x03, 0xF9, 0xFF, 0xF0, 0x3F, 0xE7, 0x86, 0x03, 0xFF, 0x9E, 0x00,
-    0x0B, 0xFE, 0x78, 0x00, 0x00, 0xB9, 0xE0, 0x00, 0x02, 0xE7, 0x80, 0x00, 0x0B, 0x9E, 0x00, 0x00,
-    0x2E, 0x78, 0x00, 0x05, 0xB9, 0xE0, 0x00, 0xFF, 0xE7, 0x80, 0x03, 0xFF, 0x9E, 0x00, 0x02, 0xFE,
-    0x78, 0xB4, 0x02, 0xFD, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xD0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x3F, 0xE0, 0x00, 0x00, 0x0A, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x1A, 0x43, 0xF0, 0x00, 0xBF, 0xFD, 0xF4, 0x00, 0xBF, 0xFF, 0xFC, 0x00,
-    0xBF, 0x43, 0xFE, 0x00, 0x3F, 0x40, 0x7F, 0x40, 0x1F, 0xC0, 0x1F, 0xC0, 0x0B, 0xE0, 0x0B, 0xD0,
-    0x02, 0xFC, 0x0B, 0xF0, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x02, 0xFF, 0xF4,
-    0x00, 0x00, 0x1B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x07, 0xFF,
-    0x6F, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFE,
-    0x02, 0xFF, 0x80, 0x00, 0x3F, 0xD0, 0x2F, 0xFF, 0x00, 0x02, 0xFD, 0x03, 0xFE, 0xFC, 0x00, 0x0F,
-    0xE0, 0x3F, 0x8B, 0xF0, 0x00, 0x7F, 0x03, 0xF8, 0x2F, 0xC0, 0x03, 0xFC, 0x3F, 0x80, 0xFF, 0x00,
-    0x0F, 0xD3, 0xF8, 0x03, 0xF8, 0x00, 0x7F, 0xBF, 0x40, 0x2F, 0xD0, 0x02, 0xFF, 0xF4, 0x01, 0xFF,
-    0x00, 0x0B, 0xFF, 0x81, 0x7F, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xF0, 0x7F,
-    0xFE, 0x40, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x0F, 0xEF, 0xF0, 0x00, 0x02, 0xFC, 0xBF, 0x00, 0x00, 0x7F, 0x4B, 0xF0, 0x00, 0x1F, 0xE0,
-    0x7F, 0x40, 0x03, 0xFC, 0x07, 0xF8, 0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x2F, 0xE0, 0x03, 0xFC, 0x07,
-    0xFC, 0x00, 0x3F, 0xC0, 0xFF, 0x40, 0x03, 0xFD, 0x1F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x6F,
-    0xFA, 0xFF, 0x90, 0x03, 0xF0, 0x2F, 0x80, 0x00, 0xFC, 0x0F, 0xD0, 0x00, 0xBE, 0x03, 0xF0, 0x00,
-    0x3F, 0x41, 0xFC, 0x00, 0x0F, 0xC0, 0xBE, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x02, 0xF8, 0x0F, 0xC0,
-    0x00, 0xFD, 0x07, 0xE0, 0x00, 0x3F, 0x03, 0xF4, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x0B, 0xE0, 0x7F,
-    0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xA8, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0xFD, 0x00, 0x03, 0xF4, 0x2F, 0x80, 0x00, 0xBE, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x03,
-    0xF0, 0x3F, 0x40, 0x00, 0xFD, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x00, 0xFC, 0x0B, 0xE0, 0x00, 0x3F, 0x41, 0xFC, 0x00, 0x0B, 0xE0, 0x3F, 0x00, 0x00, 0xFC, 0x0F,
-    0xD0, 0x00, 0x3F, 0x02, 0xF8, 0x00, 0xBF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFC, 0x02, 0xAA,
-    0xAA, 0xAA, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xAA, 0xA4, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x02, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x15,
-    0x55, 0x54, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0x0F, 0xFF, 0xFF, 0x2F, 0xFF, 0xAA, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x00, 0x10, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xC3, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00,
-    0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x81,
-    0xFD, 0x00, 0x2F, 0xFF, 0xAF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xD0, 0x3F, 0x91, 0xF0,
-    0xBD, 0x00, 0x78, 0x03, 0xC3, 0xF0, 0x02, 0xC0, 0x2F, 0x0F, 0x80, 0x2F, 0x96, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFA, 0xFF, 0xE0, 0x01, 0xBE, 0x42, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0x45, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x61, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x0F, 0xE0, 0x0B,
-    0xF8, 0x03, 0xFD, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0xBF, 0x40, 0x3F, 0xC0, 0x1F, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x02, 0x80, 0x3F, 0xFD, 0x1F, 0x82, 0xF8, 0xFD, 0xFC, 0x0F, 0xD1, 0xFF, 0xE0, 0x05, 0x01, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xA0, 0x1F, 0xFF, 0x0F, 0xC0, 0xFC, 0x7D, 0xBE, 0x07,
-    0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x06, 0xAB, 0xFF, 0xFC, 0x00, 0x2F,
-    0xFF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFF, 0xA8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x02, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xBF, 0xFF, 0xAA,
-    0x90, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x2F,
-    0xFF, 0x40, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x6F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0xA5, 0x00, 0x01, 0x90,
-    0x00, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x05, 0x6B, 0xFF, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x07,
-    0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xBF,
-    0xFC, 0x00, 0x01, 0xBF, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xFE, 0x40, 0x02, 0xFF, 0xFE, 0x40, 0x00,
-    0x03, 0xFE, 0x40, 0x00, 0x00, 0x03, 0x90, 0x00, 0x16, 0x00, 0x00, 0x56, 0xBF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xE9, 0x50, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,
+static const uint8_t opendyslexic_10_bolditalicBitmaps[30939] = {
+    0x77, 0x49, 0x97, 0x1A, 0xC7, 0x1D, 0xA7, 0x9D, 0x97, 0xE7, 0x0D, 0xA7, 0xAD, 0x97, 0xE7, 0x0E,
+    0x7A, 0xDA, 0x7E, 0x96, 0x9E, 0x7A, 0xDA, 0x7A, 0xD9, 0x70, 0xAC, 0x72, 0x97, 0x77, 0x77, 0x76,
+    0xAA, 0xAA, 0x6A, 0xEA, 0x6F, 0xA5, 0x9F, 0x95, 0xFC, 0x94, 0x9F, 0xC5, 0x75, 0xFC, 0x1F, 0xC1,
+    0xAF, 0x1A, 0xF1, 0x9F, 0x19, 0xF2, 0xF2, 0xF2, 0xF9, 0x1F, 0x2A, 0xEA, 0x1F, 0xA1, 0x9F, 0x1A,
+    0xF0, 0x72, 0xAD, 0x2A, 0xD9, 0x77, 0xDA, 0x2E, 0x77, 0xAD, 0x91, 0x9D, 0xA7, 0x7E, 0x2E, 0x97,
+    0x69, 0xDA, 0x2E, 0x72, 0xAF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xEA, 0x71, 0xE9,
+    0x1E, 0xA7, 0x6A, 0xE2, 0xE7, 0x7E, 0xA1, 0xAE, 0x76, 0x9E, 0x2E, 0x97, 0x2F, 0xFF, 0xFF, 0x93,
+    0xAF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0x97, 0x0F, 0x1A, 0xE7, 0x69, 0xE9, 0x1E, 0xA7, 0x6F, 0x19,
+    0xE9, 0x75, 0x9E, 0xA1, 0xAE, 0x77, 0x77, 0x50, 0x77, 0x77, 0x09, 0xD7, 0x7A, 0xD7, 0x7D, 0xA7,
+    0x3A, 0xFD, 0xA9, 0x7F, 0xFD, 0x7F, 0xFD, 0x96, 0xFC, 0x90, 0xDA, 0x79, 0xEA, 0x2D, 0x97, 0xAE,
+    0x29, 0xD7, 0x0F, 0xC9, 0x0A, 0xD7, 0x0A, 0xFF, 0xC7, 0x1F, 0xFD, 0x97, 0x09, 0xFF, 0xC9, 0x72,
+    0x9F, 0xE7, 0x3F, 0xE4, 0xA9, 0x4F, 0xE3, 0xFA, 0x99, 0x9F, 0xDA, 0x19, 0xFF, 0xFE, 0x2F, 0xFF,
+    0xD9, 0x49, 0xAA, 0xFF, 0x97, 0x6D, 0x97, 0x69, 0xD7, 0x7A, 0xD7, 0x79, 0x99, 0x60, 0x77, 0x99,
+    0x97, 0x79, 0xD9, 0x59, 0x96, 0x9D, 0x94, 0x9F, 0x94, 0xDA, 0x49, 0xD1, 0xCA, 0x3E, 0x5D, 0x2D,
+    0x2E, 0x6C, 0xA2, 0xCA, 0x1E, 0x7C, 0xA1, 0xD9, 0x0A, 0xD9, 0x7F, 0xD0, 0xAD, 0x97, 0x0A, 0xF0,
+    0x9D, 0xA7, 0x29, 0x99, 0x09, 0xDA, 0x0A, 0xDA, 0x72, 0xE0, 0xDA, 0xAC, 0xA7, 0x0E, 0x0A, 0xCA,
+    0x1D, 0x7E, 0x90, 0xD2, 0xD6, 0xE9, 0x1D, 0x1A, 0xCA, 0x5A, 0xDA, 0x2F, 0xD5, 0xAD, 0xA3, 0xAF,
+    0x59, 0xE5, 0x99, 0x96, 0x99, 0x97, 0x70, 0x5A, 0xEA, 0x71, 0x9E, 0xAA, 0xD9, 0x7D, 0x92, 0x9D,
+    0x6A, 0xCA, 0x4D, 0x6D, 0x93, 0xAD, 0x6A, 0xD1, 0x9E, 0x97, 0xDA, 0xFA, 0x70, 0xAF, 0xC9, 0x70,
+    0xAF, 0xA7, 0x1A, 0xFD, 0x3D, 0xA1, 0xAE, 0x1E, 0x19, 0xDA, 0x1E, 0x92, 0xE9, 0xE2, 0xEA, 0x3F,
+    0xC9, 0x19, 0xFC, 0xAA, 0xFC, 0xA3, 0xFF, 0xFC, 0x39, 0xFF, 0xCA, 0xC9, 0x49, 0xAE, 0xAA, 0x91,
+    0x97, 0x74, 0x7F, 0xC1, 0xFA, 0x1A, 0xEA, 0x19, 0xF2, 0xF2, 0xF9, 0x1A, 0xEA, 0x72, 0xA9, 0x73,
+    0xEA, 0x71, 0xAD, 0xA7, 0x1A, 0xE7, 0x19, 0xE7, 0x2E, 0x97, 0x1E, 0xA7, 0x1A, 0xE7, 0x2E, 0x97,
+    0x1A, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E,
+    0x73, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE9, 0x72, 0xE9,
+    0x72, 0xEA, 0x72, 0xF7, 0x29, 0xE9, 0x72, 0xAA, 0xCA, 0x70, 0x09, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7,
+    0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x2E, 0x72,
+    0xAD, 0xA7, 0x2E, 0x72, 0xE9, 0x71, 0x9D, 0xA7, 0x19, 0xE7, 0x2E, 0x72, 0xE9, 0x71, 0xE9, 0x71,
+    0xEA, 0x71, 0xEA, 0x71, 0xE9, 0x71, 0xE9, 0x71, 0xE9, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70,
+    0x9E, 0xA7, 0x0A, 0xCA, 0xA2, 0x77, 0x2A, 0xD7, 0x1D, 0xA1, 0xA9, 0x1A, 0xCA, 0x0D, 0x99, 0xD1,
+    0xAF, 0xFD, 0x2A, 0xFE, 0x94, 0x9F, 0xC9, 0x39, 0xFF, 0xC9, 0x1F, 0xDA, 0xE2, 0xD0, 0xAD, 0x09,
+    0xC6, 0xE7, 0x1A, 0x96, 0x77, 0x1E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD4, 0xFF, 0xDA, 0x9F, 0xFD,
+    0x99, 0xAA, 0xAF, 0xAA, 0xA4, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0x9A, 0xA5, 0x73, 0xFC, 0x3F, 0xA2,
+    0x9F, 0x3F, 0x92, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD,
+    0xA0, 0xFF, 0xD9, 0x19, 0xAA, 0x91, 0xE9, 0x09, 0xE9, 0x0F, 0x09, 0xF0, 0x77, 0x77, 0x73, 0x9A,
+    0xC7, 0x73, 0xAD, 0x77, 0x4D, 0xA7, 0x73, 0xAD, 0x77, 0x39, 0xDA, 0x77, 0x3E, 0x77, 0x39, 0xDA,
+    0x77, 0x3E, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x3A, 0xD9, 0x77, 0x3E, 0x77, 0x3E, 0x97, 0x72,
+    0x9D, 0xA7, 0x73, 0xE7, 0x73, 0xAD, 0xA7, 0x73, 0xE7, 0x73, 0xAD, 0xA7, 0x73, 0xE7, 0x73, 0xE9,
+    0x77, 0x29, 0xE7, 0x73, 0xE9, 0x77, 0x29, 0xE7, 0x73, 0xE9, 0x77, 0x2A, 0xDA, 0x77, 0x3E, 0x77,
+    0x3A, 0xDA, 0x77, 0x29, 0xE7, 0x73, 0xEA, 0x77, 0x29, 0xE7, 0x73, 0xE9, 0x77, 0x2A, 0xE7, 0x73,
+    0xDA, 0x77, 0x3A, 0xA7, 0x75, 0x97, 0x75, 0x6A, 0xEA, 0x70, 0x9F, 0xE7, 0xE9, 0x1E, 0x5E, 0x3A,
+    0xD4, 0xAD, 0xA0, 0x91, 0xAD, 0x4E, 0x0E, 0x0E, 0x39, 0xE9, 0xE0, 0xE3, 0xAD, 0xAA, 0xDA, 0x9E,
+    0x3E, 0x9A, 0xD9, 0xAD, 0xA3, 0xE1, 0xCA, 0x0E, 0x39, 0xE3, 0xF3, 0xAE, 0xA1, 0xF9, 0x3A, 0xFF,
+    0xD4, 0x9F, 0xFC, 0x95, 0xFF, 0xA6, 0xAF, 0xDA, 0x70, 0x9A, 0xDA, 0x96, 0x7A, 0xAC, 0x95, 0xAF,
+    0x94, 0xAF, 0xC5, 0xFC, 0xA5, 0xA0, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xDA, 0x7E, 0x96, 0x9E, 0x7A,
+    0xE7, 0xEA, 0x49, 0x9A, 0xEA, 0x99, 0x90, 0x9F, 0xFC, 0x90, 0xAF, 0xFC, 0x1F, 0xFD, 0x00, 0x59,
+    0xAF, 0x97, 0xFF, 0xC6, 0xFF, 0xCA, 0x49, 0xCA, 0x92, 0xAE, 0x49, 0x59, 0xE7, 0x3A, 0xDA, 0x72,
+    0x9E, 0x97, 0x19, 0xEA, 0x71, 0xAF, 0x70, 0x9F, 0xC7, 0x0F, 0xD7, 0x9F, 0xD7, 0x9F, 0xDA, 0x99,
+    0x94, 0xFF, 0xDA, 0x39, 0xFF, 0xD9, 0x3F, 0xFE, 0x92, 0x69, 0x99, 0x97, 0x0F, 0xE9, 0x5A, 0xFF,
+    0x94, 0xAA, 0x93, 0xE7, 0x3A, 0xD7, 0x3D, 0xA7, 0x19, 0xE6, 0xFE, 0x95, 0x9F, 0xD9, 0x6A, 0xAF,
+    0xD7, 0x3E, 0x97, 0x2E, 0x93, 0xCA, 0x90, 0x99, 0xF3, 0xAF, 0xFD, 0x3F, 0xFD, 0x92, 0xAF, 0xFC,
+    0x94, 0x9F, 0xDA, 0x50, 0x72, 0xAC, 0xA7, 0x1E, 0x97, 0x0F, 0x70, 0xFC, 0x7D, 0xAD, 0xA6, 0xDA,
+    0x9D, 0xA5, 0xDA, 0x0E, 0x94, 0xE1, 0xE4, 0xE1, 0x9E, 0x3F, 0xFE, 0xA0, 0xAF, 0xFE, 0x90, 0xFF,
+    0xF7, 0xAE, 0x97, 0x0F, 0x70, 0x9E, 0xA7, 0x0A, 0xE9, 0x77, 0x00, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x4A, 0xFF, 0xA4, 0xFF, 0xC9, 0x4D, 0xA7, 0x2A, 0xD7, 0x3E, 0x73, 0xEA, 0xAA, 0x96, 0x9F, 0xF5,
+    0xAF, 0xFC, 0x49, 0x93, 0x9E, 0x73, 0xE7, 0x2A, 0xE3, 0xAC, 0xA9, 0x99, 0xFA, 0x3F, 0xFD, 0x39,
+    0xFF, 0xC9, 0x3F, 0xFC, 0x94, 0x9A, 0xFA, 0x95, 0x7A, 0xFC, 0xA5, 0xAF, 0xE9, 0x4F, 0xFC, 0x93,
+    0xAD, 0xA7, 0x19, 0xDA, 0x72, 0xE9, 0xAA, 0xA9, 0x59, 0xFF, 0xA4, 0xFF, 0xDA, 0x3F, 0xA1, 0xAE,
+    0x29, 0xEA, 0x3E, 0x2A, 0xE3, 0x9E, 0x2A, 0xDA, 0x3A, 0xDA, 0x2A, 0xE9, 0x09, 0xF3, 0x9F, 0xFC,
+    0xA4, 0xFF, 0xA6, 0xAF, 0xA5, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0x99, 0x1F, 0xFD, 0xA0, 0x9F, 0xFD,
+    0x70, 0xAE, 0x70, 0xE9, 0x7A, 0xE7, 0x0E, 0xA7, 0xAE, 0x70, 0xEA, 0x7A, 0xE7, 0x9F, 0x7F, 0x96,
+    0x9F, 0x7F, 0xA6, 0xAF, 0x7F, 0xA6, 0x6A, 0xF9, 0x69, 0xFE, 0xA4, 0x9E, 0x91, 0xE4, 0xE9, 0x2A,
+    0xD4, 0xE3, 0xE3, 0x9E, 0x2A, 0xE4, 0xFF, 0xC6, 0xAF, 0xCA, 0x59, 0xFF, 0x93, 0xAE, 0x91, 0xAE,
+    0x29, 0xE4, 0xE2, 0xEA, 0x39, 0xE2, 0xF2, 0xAE, 0xA2, 0xFF, 0xE9, 0x2A, 0xFF, 0xC9, 0x4A, 0xFE,
+    0x97, 0x99, 0x99, 0x60, 0x70, 0x99, 0x72, 0xAF, 0xCA, 0x7F, 0xFA, 0x5E, 0x91, 0x9E, 0x4A, 0xD4,
+    0xAD, 0x4D, 0x94, 0xAD, 0x39, 0xD5, 0xE3, 0x9D, 0x49, 0xE3, 0xAD, 0x92, 0xAE, 0xA3, 0x9F, 0xFD,
+    0x94, 0xAF, 0xFC, 0x69, 0xFF, 0x73, 0xAD, 0x93, 0x9A, 0x92, 0x9A, 0xE4, 0xFF, 0xD9, 0x4F, 0xFC,
+    0x94, 0x9A, 0xFD, 0xA7, 0x76, 0x39, 0xE9, 0x3A, 0xE4, 0xF3, 0xAF, 0x3F, 0xC7, 0x77, 0x76, 0xAE,
+    0x4F, 0x3A, 0xEA, 0x3F, 0x92, 0x9F, 0x92, 0x5A, 0xE6, 0xF5, 0xAE, 0xA5, 0xFA, 0x49, 0xF9, 0x77,
+    0x77, 0x77, 0x09, 0x99, 0x99, 0x4A, 0xF5, 0xFA, 0x5F, 0x5A, 0xEA, 0x49, 0xF5, 0xF9, 0x49, 0xAA,
+    0xAA, 0x50, 0x77, 0x74, 0xAC, 0x75, 0xAE, 0xA7, 0x2A, 0xFC, 0xA7, 0x0A, 0xFD, 0x97, 0xAF, 0xDA,
+    0x7A, 0xFD, 0xA7, 0x1F, 0xD7, 0x3A, 0xFD, 0xA9, 0x70, 0xAF, 0xFD, 0xA9, 0x79, 0xAF, 0xFD, 0x97,
+    0x9A, 0xFE, 0xA7, 0x39, 0xAF, 0x77, 0x9C, 0x00, 0x39, 0x99, 0xAA, 0xAA, 0xC2, 0x9F, 0xFC, 0x91,
+    0xFF, 0xD9, 0x19, 0x97, 0x77, 0xAA, 0xAF, 0xD2, 0xAF, 0xFC, 0x19, 0xFD, 0xAA, 0xAA, 0x10, 0x77,
+    0x4D, 0x97, 0x5F, 0x97, 0x29, 0xFD, 0x97, 0x2A, 0xFD, 0x97, 0x19, 0xFE, 0x97, 0x19, 0xFE, 0x97,
+    0x1A, 0xFC, 0x96, 0x9A, 0xFE, 0x39, 0xAF, 0xFE, 0x90, 0xFF, 0xEA, 0x93, 0xFE, 0xA9, 0x69, 0xFA,
+    0x72, 0xAA, 0x97, 0x50, 0x77, 0x79, 0x99, 0x71, 0xAF, 0xDA, 0x59, 0xFF, 0xCA, 0x4A, 0xE9, 0x19,
+    0xE5, 0xC9, 0x4A, 0xD9, 0x73, 0xAD, 0x97, 0x3E, 0x97, 0x3E, 0x73, 0xAD, 0xA7, 0x29, 0xE7, 0x19,
+    0xF9, 0x79, 0xFC, 0x97, 0x0F, 0xC9, 0x70, 0x9E, 0xA7, 0x2A, 0xE9, 0x72, 0xF7, 0x29, 0xEA, 0x72,
+    0xA9, 0x77, 0x77, 0x77, 0x74, 0xAD, 0xA7, 0x3E, 0x97, 0x2A, 0xE9, 0x72, 0xF7, 0x3A, 0xAA, 0xA7,
+    0x20, 0x77, 0x77, 0x0A, 0xAD, 0xA9, 0x73, 0x9F, 0xFA, 0x71, 0xAE, 0xA2, 0x9D, 0xA7, 0xAD, 0xA6,
+    0xD6, 0xAD, 0x97, 0x9C, 0x94, 0xAD, 0x1A, 0xCA, 0xCA, 0x3C, 0x94, 0xD9, 0x0D, 0x9D, 0x93, 0xCA,
+    0x3E, 0x0A, 0xC1, 0x9C, 0x39, 0xC9, 0x3D, 0xA0, 0xC9, 0x19, 0xC3, 0xD3, 0x9D, 0x90, 0xC1, 0x9D,
+    0x2A, 0xCA, 0x3A, 0xD9, 0x0F, 0xD1, 0xE4, 0xAD, 0xA0, 0xAD, 0xAF, 0xD5, 0xAE, 0x59, 0xD9, 0x69,
+    0xF9, 0x49, 0x97, 0x0F, 0xFE, 0xA7, 0x1F, 0xFD, 0xA7, 0x2A, 0xFF, 0xA7, 0x59, 0x99, 0x99, 0x60,
+    0x73, 0xE9, 0x74, 0xAE, 0x97, 0x39, 0xFA, 0x73, 0xFC, 0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7,
+    0x1E, 0x90, 0xE7, 0x0A, 0xDA, 0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F,
+    0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F,
+    0x7F, 0x90, 0x4F, 0xFA, 0x7F, 0xFD, 0x59, 0xEA, 0xAA, 0xFA, 0x4A, 0xE4, 0xE4, 0xEA, 0x4E, 0x4E,
+    0x93, 0x9D, 0x93, 0x9E, 0x3A, 0xE4, 0xAF, 0xFD, 0x94, 0xFF, 0xDA, 0x5F, 0xFE, 0xA3, 0x9E, 0x4A,
+    0xE3, 0xAD, 0xA4, 0x9E, 0x92, 0xE9, 0x4A, 0xE2, 0x9E, 0xAA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFF, 0xA2,
+    0xFF, 0xFC, 0x3F, 0xFF, 0x39, 0xFF, 0xCA, 0x94, 0x77, 0x72, 0x9A, 0xAF, 0xCA, 0x7F, 0xFC, 0xA5,
+    0x9F, 0xFD, 0x5A, 0xFF, 0xE4, 0x9F, 0xC9, 0x72, 0xFA, 0x73, 0xFA, 0x73, 0x9F, 0x74, 0xFA, 0x74,
+    0xF9, 0x73, 0x9F, 0x74, 0xAF, 0x97, 0x3A, 0xFC, 0x92, 0x9A, 0xC4, 0xAF, 0xFF, 0x49, 0xFF, 0xF5,
+    0xFF, 0xEA, 0x59, 0xFF, 0xDA, 0x69, 0xFF, 0xC9, 0x30, 0x4F, 0xFA, 0x97, 0x1F, 0xFE, 0x96, 0x9F,
+    0xFF, 0x95, 0xAE, 0xAA, 0xAA, 0xFD, 0x5F, 0x5F, 0x94, 0xEA, 0x6E, 0x93, 0x9E, 0x96, 0xE9, 0x3A,
+    0xE7, 0xE9, 0x3F, 0x7E, 0x4E, 0xA6, 0x9E, 0x39, 0xE9, 0x6E, 0xA3, 0xAE, 0x6F, 0x93, 0xF2, 0x99,
+    0xAF, 0xC3, 0x9F, 0xFF, 0xD9, 0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xD5, 0xFF, 0xFA, 0x59, 0xFF, 0xCA,
+    0xA7, 0x5A, 0xAA, 0xAF, 0xE5, 0xAF, 0xFD, 0xA5, 0xFF, 0xE6, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75,
+    0xEA, 0x74, 0x9F, 0xFC, 0x7A, 0xFF, 0xA7, 0xFF, 0xC9, 0x7E, 0xA9, 0x73, 0xAE, 0x75, 0xF7, 0x5F,
+    0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFE, 0x5A, 0xFF, 0xE5, 0xFF, 0xF4, 0x9F, 0xFF, 0x40, 0x5A, 0xAA,
+    0xFE, 0x6F, 0xFD, 0x59, 0xFF, 0xC9, 0x5E, 0xA7, 0x4E, 0x74, 0x9E, 0x74, 0xFF, 0xC9, 0x6F, 0xFC,
+    0x69, 0xFF, 0xC6, 0xAE, 0xAA, 0xAA, 0xA9, 0x6E, 0x97, 0x39, 0xE7, 0x4A, 0xE7, 0x4F, 0x73, 0x9E,
+    0xA7, 0x3A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x30, 0x72, 0x99, 0x99, 0x97, 0x2A, 0xFF, 0xCA, 0x5A,
+    0xFF, 0xE9, 0x4F, 0xFF, 0xC9, 0x3F, 0xD9, 0x49, 0x93, 0x9F, 0xA7, 0x4F, 0xA7, 0x5F, 0x75, 0xAE,
+    0x97, 0x5F, 0x4A, 0xAA, 0x99, 0x4F, 0x4F, 0xEA, 0x09, 0xF4, 0xFE, 0x90, 0xAF, 0x49, 0x9A, 0xF9,
+    0x0A, 0xF6, 0xAD, 0xA2, 0x9F, 0xCA, 0x99, 0x99, 0xFA, 0x3F, 0xFF, 0xD9, 0x3A, 0xFF, 0xFC, 0x5F,
+    0xFF, 0xA6, 0x9A, 0xFC, 0xAA, 0x94, 0x49, 0xE6, 0xEA, 0x4A, 0xE5, 0x9E, 0x94, 0xF5, 0xAE, 0x5E,
+    0xA5, 0xF4, 0xAE, 0x95, 0xEA, 0x4F, 0x59, 0xE9, 0x4F, 0x5A, 0xE9, 0x39, 0xEA, 0x5F, 0x4A, 0xE9,
+    0x49, 0xF4, 0xF9, 0x4A, 0xEA, 0x39, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xD4, 0xFF, 0xFE, 0x4F, 0xFF,
+    0xDA, 0x39, 0xFA, 0xAA, 0xAA, 0xAF, 0x93, 0xAF, 0x49, 0xF9, 0x3F, 0xA4, 0xAF, 0x39, 0xF9, 0x4F,
+    0xC3, 0x4A, 0xDA, 0x5F, 0x5E, 0xA5, 0xE9, 0x49, 0xE5, 0xAD, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xEA,
+    0x5E, 0x94, 0x9E, 0x94, 0xAE, 0x5F, 0x49, 0xEA, 0x4A, 0xEA, 0x4F, 0x94, 0xAE, 0x40, 0x75, 0xAE,
+    0x97, 0x5F, 0x75, 0x9E, 0xA7, 0x5A, 0xE7, 0x6F, 0x75, 0x9E, 0x97, 0x5A, 0xE7, 0x6E, 0xA7, 0x59,
+    0xE9, 0x75, 0xF7, 0x6E, 0xA7, 0x5A, 0xE9, 0x75, 0xF7, 0x6E, 0xA7, 0x5A, 0xE7, 0x6F, 0x75, 0x9E,
+    0x97, 0x9A, 0x2A, 0xF7, 0x0F, 0xFC, 0xA7, 0x9F, 0xFC, 0x70, 0xFF, 0xC7, 0x1F, 0xEA, 0x77, 0x74,
+    0x6E, 0xA1, 0xAE, 0xA6, 0x9E, 0x19, 0xF7, 0xAD, 0xA1, 0xF7, 0x0E, 0x90, 0xF7, 0x09, 0xE0, 0xF9,
+    0x70, 0xEA, 0xAE, 0x97, 0x1E, 0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x2F, 0xE7, 0x29, 0xFD, 0x73, 0xAF,
+    0xCA, 0x73, 0xFE, 0x97, 0x19, 0xFF, 0x71, 0xFF, 0xD7, 0x0E, 0xA9, 0xFC, 0xA6, 0xAE, 0x90, 0xFD,
+    0xA5, 0xF2, 0xFD, 0x93, 0x9F, 0x2A, 0xFD, 0x92, 0x5E, 0xA7, 0x1E, 0x71, 0xAE, 0x71, 0xEA, 0x71,
+    0xE9, 0x70, 0x9E, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x09, 0xE9, 0x70,
+    0xAE, 0x71, 0xF7, 0x09, 0xFF, 0xE9, 0x0A, 0xFF, 0xE1, 0xFF, 0xF0, 0x9F, 0xFE, 0xA0, 0x5F, 0x95,
+    0x9F, 0x59, 0xF9, 0x5F, 0xA5, 0xFC, 0xA4, 0xAF, 0x95, 0xFD, 0x39, 0xFC, 0x94, 0x9F, 0xD3, 0xFD,
+    0x5A, 0xFD, 0x2A, 0xFD, 0x5F, 0xE1, 0x9F, 0xDA, 0x49, 0xFE, 0x90, 0xFE, 0x94, 0xAE, 0xAE, 0x9A,
+    0xEA, 0xE5, 0xEA, 0xAF, 0xEA, 0xF5, 0xE9, 0xAF, 0xE9, 0xEA, 0x4A, 0xE9, 0x9F, 0xD9, 0xAE, 0x94,
+    0xF0, 0x9F, 0xD0, 0xF9, 0x4F, 0x09, 0xFC, 0x99, 0xF4, 0x9E, 0xA1, 0xFC, 0x0A, 0xF4, 0xAE, 0xA1,
+    0xF1, 0xFA, 0x4F, 0x91, 0xEA, 0x09, 0xF9, 0x39, 0xF7, 0xAF, 0x40, 0x77, 0x9E, 0x6F, 0x94, 0xAD,
+    0xA6, 0xFA, 0x4E, 0x95, 0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD, 0x3E, 0x95, 0x9F, 0xD9,
+    0x19, 0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE, 0x09, 0xE6, 0xF9, 0x9E,
+    0x0A, 0xE6, 0xF1, 0xE9, 0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59, 0xF9, 0x1F, 0xDA, 0x5A,
+    0xF9, 0x1A, 0xFC, 0x6F, 0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA5, 0x70, 0x9F, 0xC9, 0x73, 0xAF,
+    0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE,
+    0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96,
+    0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA,
+    0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x5A, 0xAA, 0xAA, 0xA9, 0x71, 0xFF, 0xA6,
+    0x9F, 0xFC, 0x95, 0xAD, 0xA2, 0x9E, 0x5E, 0x4A, 0xD4, 0x9E, 0x4E, 0x4A, 0xDA, 0x29, 0xF4, 0xFF,
+    0xE9, 0x39, 0xFF, 0xE4, 0xAF, 0xFD, 0x5F, 0xFC, 0x95, 0x9F, 0xAA, 0x97, 0x0A, 0xE9, 0x73, 0xF7,
+    0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xFA, 0x72, 0x9F, 0x97, 0x20, 0x77, 0x74, 0x9F, 0xC9, 0x72, 0xAF,
+    0xFC, 0x70, 0xFF, 0xF6, 0xFC, 0x91, 0x9F, 0x94, 0xAE, 0xA5, 0xEA, 0x3A, 0xEA, 0x6F, 0x3F, 0x7F,
+    0x2A, 0xE9, 0x7E, 0xA2, 0xF7, 0x0E, 0xA2, 0xEA, 0x79, 0xE9, 0x19, 0xE9, 0x7A, 0xE2, 0x9E, 0x92,
+    0x99, 0x2E, 0xA2, 0x9E, 0xA2, 0xEA, 0xF3, 0x9F, 0xFF, 0xD9, 0x4F, 0xFF, 0xD5, 0xFF, 0xFC, 0x7F,
+    0xFE, 0x97, 0x09, 0xFF, 0xD7, 0x5F, 0xDA, 0x74, 0xAF, 0xD7, 0x5A, 0xAA, 0xAA, 0xA9, 0x20, 0x5A,
+    0xFD, 0x97, 0x0F, 0xFC, 0x69, 0xDA, 0x99, 0x9A, 0xD9, 0x5A, 0xD4, 0xDA, 0x5E, 0x4D, 0xA4, 0x9D,
+    0xA3, 0xAD, 0x94, 0xAD, 0x93, 0xE5, 0xE9, 0x99, 0xAE, 0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xA6, 0xFF,
+    0xD5, 0x9F, 0x91, 0xE9, 0x4A, 0xEA, 0x2E, 0xA4, 0xF9, 0x2E, 0xA3, 0x9F, 0x2A, 0xF3, 0xAF, 0x2F,
+    0xC3, 0xFA, 0x2F, 0xC3, 0xAA, 0xAA, 0x91, 0x9A, 0xAA, 0xAA, 0x20, 0x70, 0x9A, 0xFC, 0xA9, 0x7F,
+    0xFC, 0x96, 0xFF, 0xCA, 0x6F, 0xC9, 0x29, 0x69, 0xEA, 0x74, 0xAE, 0x75, 0xAE, 0x75, 0xAF, 0xCA,
+    0x97, 0x19, 0xFF, 0xA7, 0x09, 0xFF, 0xC7, 0x19, 0xAF, 0xE7, 0x39, 0xFC, 0x75, 0xF4, 0xCA, 0x94,
+    0x9F, 0x3F, 0xCA, 0xAA, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xA5, 0x9A, 0xFD, 0xA9, 0x40,
+    0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF,
+    0xFD, 0xA6, 0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74,
+    0xF7, 0x39, 0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x10, 0x4F,
+    0xA4, 0xAF, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A, 0xE9, 0x4A, 0xEA, 0x5F,
+    0x5F, 0x95, 0xF5, 0xF5, 0x9E, 0xA4, 0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F, 0x5F, 0x6E, 0xA5, 0xF5,
+    0x9E, 0x94, 0x9E, 0xA5, 0xAE, 0xA3, 0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC9, 0x6F, 0xFF, 0xC7,
+    0x9F, 0xFE, 0x71, 0xAF, 0xFA, 0x77, 0x74, 0xAE, 0x70, 0xF0, 0xAE, 0x79, 0xE9, 0x0A, 0xE7, 0xEA,
+    0x1A, 0xE9, 0x5F, 0x2A, 0xE9, 0x4A, 0xEA, 0x29, 0xEA, 0x39, 0xF3, 0x9F, 0x3F, 0x93, 0x9F, 0x2A,
+    0xF4, 0x9F, 0x19, 0xF5, 0x9F, 0x1F, 0xA6, 0xF9, 0xAF, 0x7F, 0xFC, 0x97, 0xFF, 0xC7, 0x0F, 0xF9,
+    0x70, 0xFE, 0xA7, 0x1F, 0xE7, 0x2F, 0xDA, 0x72, 0xFD, 0x72, 0x09, 0xAA, 0xA9, 0x75, 0xAA, 0xAA,
+    0x1F, 0x97, 0x49, 0xEA, 0x1F, 0x97, 0x4F, 0x2F, 0x97, 0x3A, 0xEA, 0x2F, 0x97, 0x3F, 0x3F, 0x93,
+    0xE3, 0xAE, 0xA3, 0xF9, 0x2F, 0x3F, 0x4F, 0x91, 0xAF, 0x91, 0xAE, 0xA4, 0xF1, 0x9F, 0xCA, 0x1F,
+    0x5F, 0x1F, 0xE0, 0xAE, 0xA4, 0x9F, 0x0F, 0xF0, 0xF5, 0x9F, 0xFF, 0xCA, 0xEA, 0x59, 0xFF, 0x0F,
+    0xF6, 0x9F, 0xEA, 0x0F, 0xEA, 0x6A, 0xFE, 0x1A, 0xFD, 0x7A, 0xFD, 0x2A, 0xFC, 0x97, 0xAF, 0xCA,
+    0x2A, 0xFC, 0x70, 0xAF, 0xC3, 0x9F, 0x97, 0x00, 0x5F, 0x6A, 0xE6, 0x9E, 0x94, 0xAE, 0x70, 0xEA,
+    0x39, 0xE7, 0x1F, 0x29, 0xE9, 0x71, 0xAE, 0xA0, 0x9E, 0x97, 0x3F, 0x9E, 0xA7, 0x4F, 0xEA, 0x75,
+    0xAF, 0xD7, 0x7F, 0xC7, 0x79, 0xFA, 0x77, 0xFD, 0x76, 0xFE, 0x97, 0x4F, 0xFC, 0x73, 0xFA, 0xAF,
+    0x97, 0x1F, 0xC0, 0x9F, 0xA7, 0x0F, 0xC2, 0xFC, 0x7F, 0xC3, 0xAF, 0xA5, 0xFC, 0x49, 0xFC, 0x40,
+    0xAE, 0x7E, 0xA9, 0xE9, 0x5F, 0x1E, 0xA4, 0xAE, 0x2F, 0x39, 0xE9, 0x2F, 0x29, 0xEA, 0x3A, 0xE9,
+    0x1F, 0x49, 0xEA, 0x0F, 0x6F, 0xAE, 0x96, 0xFF, 0x7F, 0xE7, 0x0A, 0xFC, 0x97, 0x09, 0xFA, 0x71,
+    0x9F, 0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x10, 0x59, 0xFF, 0xFD,
+    0x69, 0xFF, 0xFD, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x6F, 0xD7, 0x6F, 0xD7, 0x59, 0xFD, 0x75,
+    0xAF, 0xD7, 0x5A, 0xFD, 0x75, 0xFD, 0xA7, 0x5F, 0xDA, 0x74, 0x9F, 0xDA, 0x74, 0xAF, 0xDA, 0x74,
+    0xAF, 0xEA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x6F, 0xFF, 0xE5, 0x9F, 0xFF, 0xE5,
+    0x70, 0x9A, 0xAA, 0xAA, 0x97, 0x0F, 0xD9, 0x70, 0xFD, 0x70, 0xAD, 0xA7, 0x3E, 0x97, 0x3E, 0x73,
+    0x9D, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xDA, 0x73, 0xAD,
+    0x97, 0x3E, 0x73, 0x9E, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x4E, 0x73,
+    0x9D, 0xA7, 0x3E, 0x97, 0x3E, 0x73, 0x9D, 0xA7, 0x3F, 0xAA, 0xA7, 0x0F, 0xDA, 0x79, 0xFD, 0x97,
+    0xAF, 0xD7, 0x77, 0x00, 0x6A, 0x3C, 0x2A, 0xC2, 0xD1, 0x9D, 0x90, 0x9D, 0x90, 0x9D, 0x90, 0x9D,
+    0xA0, 0x9D, 0xA1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0, 0xE9, 0x0D,
+    0xA1, 0xD2, 0xC3, 0x92, 0x9A, 0xAA, 0xAA, 0x71, 0xAF, 0xCA, 0x70, 0x9F, 0xD7, 0x4E, 0x97, 0x39,
+    0xDA, 0x74, 0xE7, 0x4E, 0x74, 0xAD, 0xA7, 0x4E, 0x74, 0xE7, 0x4A, 0xDA, 0x73, 0x9E, 0x74, 0xE7,
+    0x4A, 0xD9, 0x73, 0x9E, 0x74, 0xE7, 0x4A, 0xD9, 0x73, 0x9D, 0xA7, 0x4E, 0x74, 0xAD, 0x97, 0x39,
+    0xDA, 0x74, 0xE7, 0x4E, 0x97, 0x39, 0xDA, 0x74, 0xE7, 0x4E, 0x71, 0xAA, 0xAE, 0xA7, 0x0F, 0xE7,
+    0x0A, 0xFD, 0x71, 0xFD, 0x97, 0x70, 0x76, 0xAC, 0xA7, 0x0E, 0xA6, 0xFD, 0x4A, 0xDA, 0x9E, 0x91,
+    0x9D, 0x92, 0x9D, 0xA0, 0x77, 0x09, 0xFF, 0xFC, 0xA0, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x77, 0x00,
+    0x0E, 0x94, 0xE9, 0x39, 0xE9, 0x39, 0xAA, 0xA9, 0x77, 0x3A, 0xE9, 0xDA, 0x4F, 0xFA, 0x3E, 0xAA,
+    0xF9, 0x2A, 0xD3, 0xE2, 0x9D, 0x93, 0xE2, 0xAC, 0xA4, 0xE2, 0xD5, 0xE2, 0xD4, 0xAD, 0xA1, 0x9F,
+    0xFD, 0x92, 0xFF, 0xD9, 0x2F, 0xFD, 0x4A, 0xEA, 0x9E, 0x10, 0x2A, 0xD9, 0x70, 0xE7, 0x1E, 0x70,
+    0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xAD, 0x71, 0xE9, 0xEA, 0x4F, 0xFC, 0x29, 0xFF, 0xC9, 0x1A, 0xF9,
+    0x1A, 0xD1, 0xAE, 0x39, 0xD1, 0xEA, 0x3A, 0xD1, 0xE4, 0xDA, 0x09, 0xE3, 0xE9, 0x09, 0xFA, 0xAF,
+    0x1A, 0xFF, 0xCA, 0x19, 0xFF, 0xA3, 0xFE, 0x96, 0x99, 0x70, 0x77, 0x09, 0xAE, 0xA4, 0xAF, 0xD3,
+    0xFC, 0xAA, 0xC2, 0xAD, 0xA7, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x70, 0xEA, 0x1A, 0x4F, 0xF3, 0x9F,
+    0xE9, 0x39, 0xAF, 0xA2, 0x74, 0xE7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD7, 0x5E, 0x74, 0x9D, 0xA6,
+    0x9A, 0xDA, 0x9A, 0xD9, 0x5A, 0xFF, 0xC5, 0xAF, 0xFC, 0xA4, 0xAD, 0xA1, 0x9F, 0x94, 0xDA, 0x3F,
+    0x4A, 0xD4, 0xF4, 0xDA, 0x39, 0xE9, 0x4E, 0x29, 0xF5, 0xFF, 0xE5, 0xFF, 0xDA, 0x59, 0xFF, 0xCA,
+    0x7F, 0x9A, 0xD9, 0x40, 0x5A, 0xEA, 0x6A, 0xFE, 0x4A, 0xDA, 0x90, 0x9D, 0x92, 0xAD, 0xA9, 0x99,
+    0xAD, 0xA2, 0xFF, 0xDA, 0x1A, 0xFF, 0xDA, 0x1E, 0x99, 0x99, 0x6E, 0x72, 0xFA, 0xAA, 0xAA, 0xCA,
+    0x2F, 0xFD, 0x93, 0xFF, 0xC5, 0xAF, 0xA9, 0x30, 0x6A, 0xEA, 0x5F, 0xC9, 0x4A, 0xEA, 0xA5, 0xE7,
+    0x9D, 0x95, 0x9F, 0xEA, 0x2A, 0xFE, 0x3F, 0xF4, 0xAD, 0xA7, 0xEA, 0x7E, 0x96, 0x9E, 0x7A, 0xE7,
+    0xEA, 0x69, 0xE9, 0x6A, 0xE7, 0xF6, 0x69, 0xAD, 0xA0, 0xE6, 0xFF, 0xD5, 0xEA, 0xAF, 0xCA, 0x4A,
+    0xD2, 0x9F, 0x94, 0xD9, 0x3F, 0x4A, 0xCA, 0x4E, 0xA4, 0xD9, 0x39, 0xE9, 0x4D, 0x4F, 0x5D, 0xA1,
+    0x9A, 0xF5, 0xFF, 0xD9, 0x5F, 0xFD, 0x69, 0xFF, 0xC7, 0x9A, 0xFD, 0x97, 0x4E, 0x6A, 0x92, 0x9E,
+    0x95, 0x9F, 0xFC, 0x6F, 0xFC, 0x69, 0xFE, 0xA7, 0x39, 0x99, 0x71, 0x5A, 0xD9, 0x72, 0xE7, 0x3E,
+    0x72, 0xAD, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xAD, 0xAA, 0xEA, 0x5F, 0xFC, 0xA3, 0x9F, 0xCA, 0xAE,
+    0x3A, 0xE9, 0x2A, 0xD3, 0xEA, 0x3A, 0xD2, 0x9E, 0x4E, 0x2A, 0xE3, 0x9D, 0xA2, 0xEA, 0x3A, 0xD9,
+    0x19, 0xE9, 0x3E, 0x2A, 0xE3, 0xAE, 0x2F, 0x3F, 0x19, 0xF2, 0x9A, 0xDA, 0x10, 0x6E, 0x95, 0x9E,
+    0x6F, 0x6F, 0x59, 0xAA, 0xA9, 0x77, 0x72, 0xAC, 0xA7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE6,
+    0x9D, 0xA6, 0xAD, 0x96, 0xE6, 0x9E, 0x6A, 0xE6, 0xAD, 0xA5, 0x72, 0x99, 0x72, 0x9D, 0x97, 0x1A,
+    0xD9, 0x71, 0xE7, 0x77, 0x77, 0x73, 0xAA, 0x97, 0x19, 0xDA, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xDA,
+    0x71, 0xAD, 0x72, 0xE7, 0x2D, 0xA7, 0x19, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0xAD, 0x72, 0xE7, 0x1E,
+    0xA7, 0xFC, 0x79, 0xFC, 0x7F, 0xC7, 0x19, 0x97, 0x10, 0x5A, 0xD9, 0x70, 0xE7, 0x09, 0xDA, 0x70,
+    0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA7, 0x0A, 0xD7, 0x1E, 0x0A, 0xE3, 0x9D, 0xAA, 0xE4, 0xAF, 0xCA,
+    0x5F, 0xCA, 0x59, 0xFC, 0x6A, 0xFC, 0x95, 0xFE, 0x49, 0xFF, 0x3A, 0xE9, 0xFC, 0x2E, 0xA0, 0xFC,
+    0xA0, 0x9E, 0x90, 0x9F, 0xC9, 0x5D, 0xA5, 0x9D, 0xA5, 0xAD, 0x95, 0xE5, 0x9D, 0xA5, 0xAD, 0x95,
+    0xE5, 0x9D, 0xA5, 0xAD, 0x95, 0xE5, 0x9E, 0x5A, 0xD9, 0x5E, 0x6E, 0x59, 0xDA, 0x5F, 0xCA, 0x3F,
+    0xCA, 0x3F, 0xCA, 0x20, 0x77, 0x72, 0xEA, 0xEA, 0x19, 0xEA, 0x59, 0xFF, 0xCA, 0xFC, 0xA4, 0xAF,
+    0xAA, 0xFC, 0xAA, 0xE4, 0xF2, 0xAE, 0x91, 0x9D, 0x92, 0xAE, 0x3F, 0x2A, 0xD9, 0x2E, 0xA3, 0xE9,
+    0x2E, 0x29, 0xE9, 0x2A, 0xE3, 0xE2, 0xAE, 0x3E, 0x92, 0xAE, 0x2E, 0xA2, 0xAE, 0x3E, 0xA1, 0x9E,
+    0x3E, 0xA2, 0x9E, 0x91, 0xF2, 0x9E, 0x3A, 0xE1, 0x9E, 0x92, 0xF3, 0xF1, 0x77, 0x29, 0xD9, 0xAE,
+    0x95, 0xFF, 0xC9, 0x4F, 0xCA, 0xEA, 0x3A, 0xE9, 0x2E, 0x3E, 0x93, 0xDA, 0x3E, 0x39, 0xDA, 0x2A,
+    0xDA, 0x3A, 0xD9, 0x2E, 0x93, 0xE3, 0xE9, 0x29, 0xE2, 0xAE, 0x3F, 0x2F, 0x3E, 0xA1, 0x9E, 0xA2,
+    0xAE, 0x91, 0x49, 0xAE, 0xA6, 0xAF, 0xE4, 0xFA, 0xAE, 0xA2, 0xAE, 0x3E, 0x2E, 0x4E, 0x1A, 0xD9,
+    0x4E, 0x1E, 0x4A, 0xDA, 0x1E, 0xA1, 0x9F, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x4F, 0xEA, 0x6A, 0xEA,
+    0x94, 0x73, 0x99, 0x73, 0xEA, 0xFC, 0x71, 0xFF, 0xD7, 0x0F, 0xC9, 0x1D, 0x79, 0xF3, 0xAC, 0x96,
+    0xAE, 0x93, 0xAC, 0x96, 0xF4, 0xD9, 0x6E, 0xA4, 0xD6, 0x9E, 0xA3, 0xAD, 0x6F, 0xCA, 0x9A, 0xE9,
+    0x6F, 0xFE, 0x6A, 0xFF, 0xD7, 0xFF, 0xD7, 0xAE, 0x19, 0xA9, 0x71, 0xEA, 0x75, 0x9E, 0x76, 0xF7,
+    0x59, 0xE9, 0x75, 0xAD, 0xA7, 0x50, 0x77, 0x39, 0xAD, 0xA0, 0xE4, 0xFD, 0xAE, 0x3E, 0xA9, 0xFC,
+    0x92, 0xAD, 0x3F, 0x3D, 0x93, 0xEA, 0x2A, 0xD4, 0xE9, 0x2D, 0x93, 0x9E, 0x3D, 0x93, 0xAD, 0xA3,
+    0xDA, 0x2A, 0xE9, 0x3F, 0xFD, 0x4F, 0xFC, 0xA4, 0x9F, 0xF9, 0x59, 0xAD, 0x99, 0xDA, 0xD7, 0x0F,
+    0xD7, 0x0F, 0xCA, 0x7A, 0xFA, 0x70, 0xCA, 0x97, 0x74, 0x4E, 0xAE, 0x39, 0xFE, 0x3F, 0xF3, 0xF9,
+    0x59, 0xE7, 0xAD, 0xA7, 0xE7, 0xAE, 0x7F, 0x69, 0xEA, 0x6F, 0xA6, 0xAE, 0x95, 0x77, 0x39, 0xFC,
+    0xA5, 0xFF, 0x49, 0xD9, 0x39, 0x49, 0xD7, 0x3E, 0xA9, 0x70, 0x9F, 0xCA, 0x70, 0x9A, 0xEA, 0x71,
+    0xAE, 0x3D, 0xA9, 0x9A, 0xF2, 0xFF, 0xD9, 0x1F, 0xFD, 0x93, 0x9A, 0xFA, 0x97, 0x71, 0x77, 0x9A,
+    0xC6, 0x9D, 0xA6, 0xAD, 0x96, 0xE4, 0xAF, 0xF0, 0x9F, 0xFC, 0x09, 0xAA, 0xEA, 0xAA, 0xA2, 0x9E,
+    0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6F, 0xDA, 0x3F, 0xDA, 0x3F, 0xDA, 0x20, 0x19,
+    0xD9, 0x39, 0xDA, 0x1A, 0xD4, 0xAD, 0x91, 0xAD, 0x4E, 0x2E, 0x39, 0xE2, 0xDA, 0x3A, 0xDA, 0x19,
+    0xD9, 0x3E, 0xA1, 0xAD, 0x92, 0x9E, 0x91, 0xAD, 0x3F, 0x2F, 0xA9, 0xFC, 0x2F, 0xFD, 0xA2, 0xAF,
+    0xFC, 0x93, 0xAF, 0xAE, 0x20, 0x0E, 0x6A, 0xDA, 0x0E, 0x94, 0x9E, 0x1E, 0xA4, 0xE2, 0xAE, 0x3E,
+    0x92, 0x9E, 0x2A, 0xDA, 0x4E, 0x90, 0x9E, 0x5E, 0xA0, 0xE6, 0xFE, 0xA6, 0xAF, 0xD7, 0xAF, 0xC7,
+    0x0A, 0xFC, 0x70, 0xAF, 0x96, 0x0E, 0x71, 0xE1, 0xE7, 0x0A, 0xDA, 0x09, 0xE2, 0x99, 0x3E, 0x19,
+    0xE1, 0x9D, 0xA1, 0xEA, 0x19, 0xE1, 0xF0, 0x9E, 0x29, 0xE0, 0xFC, 0x9E, 0xA2, 0x9F, 0xFF, 0xC3,
+    0x9F, 0xFF, 0xA3, 0x9F, 0xFF, 0x49, 0xFC, 0xAF, 0xC9, 0x49, 0xFA, 0x0F, 0xC5, 0x9F, 0x1F, 0x96,
+    0xAA, 0xA2, 0x9A, 0xAA, 0x60, 0x4A, 0xE3, 0xAD, 0xA6, 0xE9, 0x1E, 0xA7, 0xF0, 0xEA, 0x70, 0x9F,
+    0xDA, 0x72, 0xFC, 0xA7, 0x3A, 0xEA, 0x73, 0x9F, 0xC7, 0x29, 0xFD, 0x97, 0x0A, 0xEA, 0xF7, 0xAE,
+    0xA0, 0xF9, 0x5A, 0xEA, 0x19, 0xF4, 0xFA, 0x3F, 0x92, 0x3E, 0x5E, 0x93, 0xE9, 0x39, 0xDA, 0x4A,
+    0xE3, 0xE5, 0x9E, 0x2A, 0xDA, 0x6E, 0x91, 0xE7, 0xEA, 0x0A, 0xD9, 0x7F, 0x9E, 0x70, 0xAF, 0xD9,
+    0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x3F, 0x70, 0xAA, 0xFC, 0x97,
+    0x9F, 0xDA, 0x70, 0xAF, 0xCA, 0x71, 0xFA, 0x73, 0x49, 0xFF, 0xC5, 0xAF, 0xFC, 0x59, 0xAA, 0xAA,
+    0xFA, 0x71, 0xAE, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x70, 0x9F, 0x97, 0x1F,
+    0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xE9, 0x20, 0x69, 0xAF, 0x6A, 0xFC, 0x95, 0x9F, 0xAA, 0x6F, 0x71,
+    0xE9, 0x70, 0x9E, 0x71, 0xEA, 0x70, 0x9E, 0x96, 0xFD, 0x7F, 0xA7, 0x9F, 0x97, 0x09, 0xEA, 0x71,
+    0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xFD, 0x7F, 0xD7, 0x0F, 0xA7, 0x74,
+    0x5D, 0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0xA5, 0xD9, 0x4A, 0xD5, 0xE5, 0xD9, 0x49, 0xD5, 0xAD, 0x5D,
+    0xA4, 0x9D, 0x94, 0xAD, 0x5D, 0xA5, 0xD9, 0x49, 0xD5, 0xE5, 0xD9, 0x49, 0xD5, 0x59, 0xFA, 0x7A,
+    0xFC, 0xA6, 0x9A, 0xFA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9F,
+    0xC9, 0x7F, 0xC7, 0x9F, 0xA7, 0xE9, 0x97, 0xAE, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xE9,
+    0x6F, 0xD6, 0x9F, 0xC7, 0xFA, 0x77, 0x50, 0x59, 0xA9, 0x1D, 0xA0, 0x9C, 0xA0, 0xF9, 0xAC, 0x09,
+    0xD0, 0xF0, 0x9C, 0x90, 0x9A, 0xA1, 0x4F, 0xCA, 0x4F, 0xC5, 0xFC, 0x5F, 0x94, 0x9F, 0x6A, 0xAA,
+    0x97, 0x77, 0x77, 0x73, 0x97, 0x0C, 0xA6, 0xAD, 0x96, 0xE9, 0x59, 0xE6, 0x9E, 0x6A, 0xDA, 0x6E,
+    0x96, 0xE7, 0xE6, 0x9D, 0xA6, 0x9D, 0x96, 0xAD, 0x7E, 0x7D, 0x70, 0xA7, 0x73, 0x79, 0x97, 0x1C,
+    0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x79, 0xAE, 0xA4, 0xAF, 0xD3, 0xFD, 0xAC, 0x2A, 0xDA, 0xAC, 0x94,
+    0xE0, 0xAC, 0x4A, 0xDA, 0x0D, 0x4E, 0x90, 0xCA, 0x4E, 0x09, 0xC9, 0x4E, 0x9A, 0xCA, 0x4F, 0xEA,
+    0x39, 0xFE, 0x93, 0x9A, 0xFA, 0x69, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x71, 0x77, 0x77, 0x71, 0x9A,
+    0xEA, 0x71, 0xFF, 0x7F, 0xA9, 0xAE, 0x6D, 0xA3, 0x99, 0x96, 0xD7, 0x6D, 0x76, 0xD7, 0x6D, 0x75,
+    0x9D, 0x97, 0x2F, 0xFD, 0xA5, 0xFF, 0xD9, 0x70, 0xDA, 0x74, 0x9D, 0xA7, 0x39, 0xE9, 0x71, 0xAF,
+    0xC7, 0x19, 0xFF, 0xCA, 0x94, 0xAF, 0xFE, 0x4F, 0xFF, 0x92, 0x73, 0x96, 0xAC, 0x3A, 0xCA, 0x4F,
+    0xFD, 0x92, 0x9F, 0xFD, 0x4F, 0xAF, 0x49, 0xE1, 0x9D, 0xA4, 0xAD, 0x91, 0x9D, 0xA4, 0xAD, 0xA0,
+    0x9E, 0x94, 0xFF, 0xC4, 0xFF, 0xD9, 0x2F, 0xFF, 0x29, 0xD9, 0x9A, 0xA9, 0xDA, 0x49, 0x69, 0x30,
+    0x29, 0x99, 0x79, 0x99, 0x3A, 0xE5, 0xEA, 0x4E, 0xA2, 0x9E, 0xA5, 0xAE, 0x90, 0xAE, 0xA6, 0x9F,
+    0xAE, 0xA7, 0x0F, 0xEA, 0x71, 0x9F, 0xCA, 0x73, 0xFA, 0x71, 0xFF, 0xC9, 0x6A, 0xFF, 0xC9, 0x6A,
+    0xAA, 0xFC, 0xAA, 0x97, 0x1F, 0x74, 0x9F, 0xAA, 0x79, 0xFF, 0xC7, 0xFF, 0xD6, 0x9A, 0xAA, 0xEA,
+    0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x77, 0x40, 0x5A, 0xA4, 0xAC, 0xA4, 0xD5, 0xD4, 0x9C, 0xA4, 0xD9,
+    0x4A, 0x97, 0x77, 0x4A, 0xC4, 0xAC, 0xA4, 0xD9, 0x4D, 0x49, 0xCA, 0x4A, 0xC9, 0x4D, 0x49, 0xCA,
+    0x74, 0x77, 0x79, 0xFC, 0x70, 0x9F, 0xE7, 0xDA, 0x2D, 0x7D, 0x39, 0x70, 0xFA, 0x70, 0xAF, 0xE9,
+    0x5A, 0xFF, 0xC4, 0x9D, 0xA3, 0xAD, 0x4D, 0xA5, 0xD4, 0xFA, 0xAA, 0xEA, 0x4A, 0xFF, 0xC6, 0xAF,
+    0xDA, 0x72, 0xAE, 0x95, 0x94, 0xAD, 0x94, 0x9E, 0x99, 0xAE, 0x49, 0xFF, 0xC6, 0xAF, 0xCA, 0x96,
+    0x19, 0xE1, 0xAD, 0xA1, 0xF1, 0xE9, 0x1E, 0xA0, 0xAE, 0x90, 0xAE, 0xA0, 0xF1, 0xAA, 0xAA, 0x1A,
+    0xAA, 0xA0, 0x3A, 0xDA, 0x49, 0xFD, 0x29, 0xD9, 0x1A, 0xC9, 0x1D, 0xAD, 0x1C, 0xA0, 0x9E, 0x3C,
+    0xA0, 0x9C, 0xAD, 0x90, 0xD2, 0xD2, 0xDA, 0x2A, 0xFC, 0xA4, 0xAD, 0xA9, 0x30, 0x72, 0xAC, 0xAC,
+    0x2C, 0xA9, 0xD1, 0x9C, 0x1A, 0xC1, 0xC9, 0x1D, 0x1F, 0xCA, 0x19, 0xDA, 0xC9, 0x00, 0x77, 0x49,
+    0xA4, 0xA5, 0xAC, 0x92, 0x9C, 0xA4, 0xE2, 0xE3, 0xAE, 0x19, 0xE3, 0xE9, 0x1E, 0xA3, 0xAE, 0x19,
+    0xE4, 0x9E, 0xA0, 0x9E, 0xA4, 0xAE, 0x90, 0xAE, 0x94, 0xE9, 0x1E, 0x95, 0xD3, 0xD6, 0x99, 0x39,
+    0x93, 0x0E, 0xAA, 0xA9, 0x99, 0x2F, 0xFD, 0x09, 0xFF, 0xD6, 0x9E, 0xA7, 0xE9, 0x7E, 0x79, 0xE7,
+    0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD0, 0xAF, 0xFD, 0x00, 0x49, 0xAA, 0x94, 0xAF,
+    0xCA, 0x2A, 0xE9, 0x0D, 0x2E, 0x0A, 0x09, 0xC9, 0x0A, 0xCA, 0xE0, 0x9C, 0x90, 0xAD, 0xAA, 0x90,
+    0xD1, 0xAD, 0x9A, 0xE9, 0x2F, 0xD9, 0x4A, 0xDA, 0x30, 0x72, 0x9F, 0xE1, 0xFF, 0x72, 0x59, 0x97,
+    0xFC, 0x93, 0x9F, 0xE3, 0xE9, 0x09, 0xD9, 0x19, 0xD9, 0x19, 0xD9, 0x1A, 0xDA, 0x09, 0xE2, 0xAF,
+    0xEA, 0x3F, 0xDA, 0x49, 0xF9, 0x77, 0x71, 0x99, 0x74, 0xAD, 0x74, 0xE7, 0x39, 0xDA, 0x7F, 0xFE,
+    0x4F, 0xFD, 0xA7, 0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x4A, 0xA9, 0x77, 0x77, 0x72, 0x99, 0x99,
+    0x9A, 0x59, 0xFF, 0xC4, 0x9F, 0xFD, 0x77, 0x40, 0x19, 0xE9, 0x2A, 0xA9, 0xD5, 0xAC, 0x49, 0xC9,
+    0x3A, 0xCA, 0x29, 0xDA, 0x3F, 0xC2, 0xAA, 0xAA, 0x91, 0x19, 0xE9, 0x29, 0x90, 0xAC, 0x5A, 0xC2,
+    0x9E, 0x49, 0xAC, 0x5A, 0xC2, 0xFC, 0x2E, 0xA2, 0x29, 0xD3, 0xD9, 0x2A, 0xD2, 0xAD, 0x39, 0x99,
+    0x20, 0x49, 0xE3, 0x9D, 0xA4, 0xAD, 0x93, 0xAD, 0x94, 0xAD, 0x4E, 0x5E, 0x39, 0xE4, 0x9D, 0xA3,
+    0xAD, 0xA4, 0xAD, 0x93, 0xEA, 0x4E, 0x92, 0x9E, 0x93, 0x9E, 0x3F, 0x4F, 0xCA, 0x9F, 0xC3, 0x9F,
+    0xFE, 0xA3, 0xAF, 0xFE, 0x93, 0xD9, 0xAF, 0xAE, 0x39, 0xD7, 0x5D, 0xA7, 0x5A, 0xA9, 0x74, 0x6A,
+    0xEA, 0x0D, 0xA4, 0x9F, 0xC0, 0x9D, 0x93, 0x9F, 0xD0, 0xAD, 0x4F, 0xDA, 0x0E, 0x4F, 0xD1, 0xDA,
+    0x4F, 0xD0, 0x9D, 0x94, 0xAF, 0xA0, 0xAD, 0x6F, 0x1E, 0x6F, 0x1D, 0xA5, 0x9E, 0x90, 0x9D, 0x95,
+    0xF1, 0xAD, 0x59, 0xF1, 0xE5, 0xF9, 0x1D, 0xA5, 0xF1, 0x9D, 0x94, 0xAF, 0x1A, 0xD5, 0xF9, 0x1E,
+    0x4A, 0xF2, 0xDA, 0x4F, 0xA2, 0xD9, 0x30, 0x19, 0xE2, 0xF2, 0xEA, 0x1A, 0xEA, 0x1A, 0xAA, 0xA1,
+    0x2A, 0xA3, 0x9C, 0xA3, 0xE9, 0x19, 0xCA, 0xD3, 0x9D, 0x1F, 0xA1, 0xE9, 0x10, 0x29, 0xCA, 0x2D,
+    0x92, 0x9C, 0x3A, 0xC3, 0xCA, 0x29, 0xC9, 0x1F, 0xA0, 0xAA, 0xAA, 0x90, 0x2A, 0xDA, 0x2D, 0x9A,
+    0xC9, 0x09, 0xC1, 0x9C, 0x90, 0xAC, 0x1D, 0x1A, 0xFA, 0x2E, 0xA7, 0x10, 0x76, 0xA9, 0x39, 0x96,
+    0x9C, 0xA3, 0xCA, 0x6E, 0x91, 0xE9, 0x5A, 0xDA, 0x1A, 0xDA, 0x59, 0xE1, 0x9E, 0x5A, 0xE1, 0xAE,
+    0x39, 0xEA, 0x09, 0xEA, 0x3F, 0x1F, 0x4E, 0x2E, 0x5A, 0xC9, 0x2A, 0xC9, 0x6A, 0x4A, 0x30, 0x49,
+    0xA7, 0x71, 0xAE, 0x73, 0x99, 0x3E, 0xA7, 0x19, 0xD9, 0x4A, 0xC9, 0x71, 0xDA, 0x5D, 0x71, 0xDA,
+    0x59, 0xD7, 0x0E, 0x6A, 0xCA, 0x7E, 0x7D, 0x96, 0xAD, 0x69, 0x9D, 0x99, 0x4A, 0xD9, 0x19, 0x91,
+    0xAF, 0xD3, 0x9D, 0xA1, 0xAC, 0xA1, 0xFE, 0x29, 0xDA, 0x1A, 0xD9, 0x73, 0xE1, 0xAE, 0x73, 0xE1,
+    0xAC, 0x9D, 0x72, 0xE9, 0x0A, 0xC0, 0x9D, 0x71, 0xE9, 0x0A, 0xCA, 0x9E, 0x97, 0xAD, 0xA0, 0x9F,
+    0xEA, 0x6A, 0xDA, 0x29, 0x99, 0xAD, 0xA6, 0x9E, 0x6A, 0xD6, 0x9E, 0x7D, 0xA6, 0xAA, 0xA9, 0x76,
+    0x49, 0xA7, 0x72, 0xAE, 0x77, 0x2E, 0xA7, 0x2D, 0xA5, 0xAC, 0x97, 0x1D, 0xA6, 0xD7, 0x1E, 0x69,
+    0xD7, 0x0E, 0x7A, 0xCA, 0x7A, 0xD7, 0x0D, 0x96, 0xAD, 0x96, 0x99, 0xD9, 0x94, 0x9D, 0x99, 0xAD,
+    0xA1, 0xAF, 0xD3, 0x9D, 0xA0, 0xFD, 0x0F, 0xE2, 0x9D, 0xA0, 0x9C, 0x91, 0xD9, 0x71, 0xE6, 0xD9,
+    0x70, 0xE6, 0x9D, 0x97, 0xE6, 0x9D, 0xA7, 0xE9, 0x5A, 0xE7, 0xAD, 0xA4, 0x9F, 0x7A, 0xDA, 0x4A,
+    0xF9, 0x95, 0xAE, 0x5F, 0xE4, 0x9E, 0x5A, 0xFE, 0x49, 0x99, 0x77, 0x00, 0x2A, 0xEA, 0x77, 0x9D,
+    0xAA, 0xD7, 0x09, 0xA9, 0x7A, 0xC7, 0xAD, 0x79, 0xD6, 0x9D, 0x94, 0xAF, 0x69, 0xD9, 0x5F, 0xC5,
+    0x9D, 0xA7, 0x1D, 0x5D, 0xA5, 0x99, 0x19, 0xD4, 0xE6, 0xFE, 0x3E, 0x2C, 0xA1, 0xAF, 0xD3, 0xE2,
+    0xDA, 0x19, 0xAA, 0xCA, 0x93, 0xE2, 0xE9, 0x72, 0xAD, 0x91, 0xC9, 0xD7, 0x2A, 0xD9, 0x1C, 0x90,
+    0xD7, 0x1A, 0xDA, 0x1C, 0xA0, 0xAC, 0xA7, 0x0A, 0xDA, 0x1F, 0xEA, 0x69, 0xE1, 0x9F, 0xE9, 0x59,
+    0xE6, 0xAD, 0x69, 0xE7, 0xDA, 0x69, 0xAA, 0x97, 0x60, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xE9, 0x72,
+    0x9E, 0x73, 0x9A, 0xA9, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xCA, 0x72, 0xF9, 0x72, 0xF7, 0x29, 0xEA,
+    0x71, 0x9F, 0x97, 0x0A, 0xFC, 0x70, 0xFC, 0x97, 0x0F, 0x97, 0x19, 0xE7, 0x3E, 0x97, 0x3E, 0x73,
+    0x9D, 0xA7, 0x39, 0xDA, 0x59, 0x5E, 0x39, 0xD9, 0x4F, 0xAF, 0xCA, 0x5F, 0xF9, 0x7A, 0xEA, 0x97,
+    0x75, 0x72, 0xAA, 0xA7, 0x6A, 0xE7, 0x6F, 0x76, 0xF7, 0x77, 0x77, 0x70, 0xE9, 0x74, 0xAE, 0x97,
+    0x39, 0xFA, 0x73, 0xFC, 0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A, 0xDA,
+    0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A,
+    0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x90, 0x77, 0x09, 0x77,
+    0x0D, 0x97, 0x6D, 0xA7, 0x6A, 0xD7, 0x69, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xE9,
+    0x75, 0xAE, 0x97, 0x49, 0xFA, 0x74, 0xFC, 0xA7, 0x3A, 0xDA, 0xE7, 0x29, 0xE9, 0xE7, 0x2E, 0x90,
+    0xE7, 0x1A, 0xDA, 0x1E, 0x71, 0xE2, 0xE9, 0x7E, 0xA2, 0xE9, 0x6A, 0xE3, 0xEA, 0x6F, 0xFE, 0xA5,
+    0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0xF6, 0xF2, 0x9E, 0xA6, 0xF9, 0x1F, 0x7F, 0x90,
+    0x77, 0x75, 0xD9, 0x76, 0xAE, 0x97, 0x49, 0xFC, 0xA7, 0x3E, 0x9A, 0xDA, 0x71, 0xE3, 0xAD, 0x77,
+    0x77, 0xE9, 0x75, 0xAE, 0x97, 0x49, 0xFA, 0x74, 0xFC, 0xA7, 0x3A, 0xDA, 0xE7, 0x29, 0xE9, 0xE7,
+    0x2E, 0x90, 0xE7, 0x1A, 0xDA, 0x1E, 0x71, 0xE2, 0xE9, 0x7E, 0xA2, 0xE9, 0x6A, 0xE3, 0xEA, 0x6F,
+    0xFE, 0xA5, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0xF6, 0xF2, 0x9E, 0xA6, 0xF9, 0x1F,
+    0x7F, 0x90, 0x77, 0x76, 0xAD, 0x1D, 0x72, 0xAE, 0xA9, 0xCA, 0x72, 0xD0, 0xF9, 0x72, 0xD0, 0x9D,
+    0xA7, 0x77, 0x77, 0x72, 0xE9, 0x75, 0xAE, 0x97, 0x49, 0xFA, 0x74, 0xFC, 0xA7, 0x3A, 0xDA, 0xE7,
+    0x29, 0xE9, 0xE7, 0x2E, 0x90, 0xE7, 0x1A, 0xDA, 0x1E, 0x71, 0xE2, 0xE9, 0x7E, 0xA2, 0xE9, 0x6A,
+    0xE3, 0xEA, 0x6F, 0xFE, 0xA5, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0xF6, 0xF2, 0x9E,
+    0xA6, 0xF9, 0x1F, 0x7F, 0x90, 0x72, 0xEA, 0x1E, 0x73, 0xE9, 0x0A, 0xE7, 0x2A, 0xE1, 0xF7, 0x2F,
+    0x09, 0xF7, 0x19, 0xAA, 0xAA, 0x09, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x6E, 0x97, 0x7A, 0xE9, 0x76,
+    0x9F, 0xA7, 0x6F, 0xCA, 0x75, 0xAD, 0xAE, 0x74, 0x9E, 0x9E, 0x74, 0xE9, 0x0E, 0x73, 0xAD, 0xA1,
+    0xE7, 0x3E, 0x2E, 0x97, 0x1E, 0xA2, 0xE9, 0x70, 0xAE, 0x3E, 0xA7, 0x0F, 0xFE, 0xA7, 0xFF, 0xFC,
+    0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD5, 0xF6, 0xF4, 0x9E, 0xA6, 0xF9, 0x3F, 0x7F, 0x92, 0x75, 0xAC,
+    0xA7, 0x5F, 0x97, 0x39, 0xDA, 0xC9, 0x74, 0xF7, 0x5A, 0xD7, 0x77, 0x77, 0x71, 0xE9, 0x74, 0xAE,
+    0x97, 0x39, 0xFA, 0x73, 0xFC, 0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A,
+    0xDA, 0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC,
+    0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x90, 0x76, 0xAA,
+    0xAA, 0xAA, 0xFE, 0x76, 0xFF, 0xFC, 0xA7, 0x5F, 0xFF, 0xD7, 0x5A, 0xFD, 0x97, 0x73, 0x9F, 0xE7,
+    0x73, 0x9E, 0x9E, 0xA7, 0x73, 0xE0, 0xAE, 0x97, 0x72, 0xE9, 0x0A, 0xFF, 0xC7, 0x4A, 0xDA, 0x1A,
+    0xFF, 0x97, 0x3A, 0xE2, 0xFF, 0xC7, 0x39, 0xE2, 0x9E, 0xA9, 0x77, 0xFF, 0xEA, 0x77, 0xFF, 0xFA,
+    0x76, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0x7A, 0xFF, 0xFF, 0xF6, 0x9E, 0xA4, 0xFF, 0xF5, 0x9F, 0x5F,
+    0xFF, 0x5F, 0x94, 0x9F, 0xFF, 0x77, 0x77, 0x10, 0x77, 0x72, 0x9A, 0xAF, 0xAA, 0x7F, 0xFC, 0xA5,
+    0x9F, 0xFD, 0x5A, 0xFF, 0xE4, 0x9F, 0xC9, 0x72, 0xFA, 0x73, 0xFA, 0x73, 0x9F, 0x74, 0xFA, 0x74,
+    0xF9, 0x73, 0x9F, 0x74, 0xAF, 0x97, 0x3A, 0xFC, 0x92, 0x99, 0xC4, 0xAF, 0xFF, 0x49, 0xFF, 0xF5,
+    0xFF, 0xEA, 0x59, 0xFF, 0xDA, 0x69, 0xFF, 0xC9, 0x72, 0xCA, 0x76, 0xE9, 0x74, 0x9A, 0xAD, 0x74,
+    0xAE, 0xA7, 0x4E, 0xA7, 0x77, 0x20, 0x79, 0xAA, 0x97, 0x6E, 0xA7, 0x6E, 0xA7, 0x59, 0xEA, 0x77,
+    0x77, 0x77, 0x76, 0xAA, 0xAA, 0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49, 0xE7, 0x5A,
+    0xE7, 0x5E, 0xA7, 0x49, 0xFF, 0xC7, 0xAF, 0xFA, 0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A, 0xE7, 0x5F,
+    0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xE5, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF, 0xF4, 0x75,
+    0xD9, 0x75, 0xAC, 0xA7, 0x59, 0xD7, 0x6D, 0xA7, 0x59, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x3A, 0xAA, 0xAF, 0xE5, 0xAF, 0xFD, 0xA5, 0xFF, 0xE6, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA,
+    0x74, 0x9F, 0xFC, 0x7A, 0xFF, 0xA7, 0xFF, 0xC9, 0x7E, 0xA9, 0x73, 0xAE, 0x75, 0xF7, 0x5F, 0xAA,
+    0xAA, 0xAA, 0xA5, 0x9F, 0xFE, 0x5A, 0xFF, 0xE5, 0xFF, 0xF4, 0x9F, 0xFF, 0x40, 0x77, 0x71, 0x9D,
+    0x76, 0xF7, 0x4A, 0xFC, 0x97, 0x19, 0xE9, 0xAD, 0xA7, 0x0E, 0x3E, 0x77, 0x77, 0x73, 0xAA, 0xAA,
+    0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xFF,
+    0xC7, 0xAF, 0xFA, 0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A, 0xE7, 0x5F, 0x75, 0xFA, 0xAA, 0xAA, 0xAA,
+    0x59, 0xFF, 0xE5, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF, 0xF4, 0x70, 0xE9, 0x1E, 0x70, 0x9E, 0x1A,
+    0xE7, 0x0F, 0x1F, 0x79, 0xF0, 0xAE, 0xA7, 0x9A, 0xAA, 0x90, 0xAA, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x7A, 0xAA, 0xAF, 0xE6, 0xAF, 0xFD, 0xA6, 0xFF, 0xE7, 0xE9, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xEA,
+    0x75, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x70, 0xFF, 0xC9, 0x70, 0xEA, 0x97, 0x4A, 0xE7, 0x6F, 0x76,
+    0xFA, 0xAA, 0xAA, 0xAA, 0x69, 0xFF, 0xE6, 0xAF, 0xFE, 0x6F, 0xFF, 0x59, 0xFF, 0xF5, 0x4E, 0x70,
+    0x9E, 0x97, 0xAE, 0x97, 0x9A, 0xAA, 0x77, 0x77, 0x71, 0xAD, 0xA7, 0xF7, 0xEA, 0x7E, 0x96, 0x9E,
+    0x7A, 0xDA, 0x7E, 0x97, 0xE7, 0x9E, 0x7E, 0xA7, 0xE9, 0x69, 0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA6,
+    0xAE, 0xA6, 0xF9, 0x6A, 0xE6, 0x72, 0x97, 0x2D, 0x97, 0x0D, 0xA7, 0x0A, 0xD7, 0x09, 0xD9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x4A, 0xDA, 0x70, 0xF7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x70, 0xAD, 0xA7,
+    0x0E, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE9, 0x7A, 0xE7, 0x0F, 0x79, 0xEA,
+    0x7A, 0xEA, 0x7F, 0x97, 0xAE, 0x70, 0x4D, 0x71, 0xAE, 0x70, 0xFC, 0x95, 0xE9, 0xAD, 0xA3, 0xAD,
+    0x91, 0x9E, 0x77, 0x77, 0x74, 0xAD, 0xA7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xDA,
+    0x70, 0xE9, 0x70, 0xE7, 0x09, 0xE7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x9E,
+    0xA7, 0xAE, 0xA7, 0xF9, 0x7A, 0xE7, 0x49, 0xAA, 0x91, 0xAA, 0xA5, 0xE9, 0x09, 0xE4, 0x9E, 0x90,
+    0xF4, 0xF1, 0xF3, 0x9F, 0x0A, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xDA, 0x72, 0xF7, 0x2E, 0xA7,
+    0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x72, 0xE7, 0x29, 0xE7, 0x2E, 0xA7, 0x2E, 0x97,
+    0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xAE, 0xA7, 0x1F, 0x97, 0x1A, 0xE7, 0x10,
+    0x5F, 0xFA, 0x97, 0x2F, 0xFE, 0x97, 0x9F, 0xFF, 0x96, 0xAE, 0xAA, 0xAA, 0xFD, 0x6F, 0x5F, 0x95,
+    0xEA, 0x6E, 0x94, 0x9E, 0x96, 0xE9, 0x4A, 0xE7, 0xE9, 0x09, 0xFF, 0xD4, 0xE1, 0xAF, 0xFD, 0x39,
+    0xE1, 0x99, 0x9F, 0xA9, 0x99, 0x3E, 0xA4, 0xF6, 0xF5, 0xF2, 0x99, 0xFD, 0x49, 0xFF, 0xFD, 0x94,
+    0xAF, 0xFF, 0xCA, 0x5F, 0xFF, 0xD6, 0xFF, 0xFA, 0x69, 0xFF, 0xCA, 0xA7, 0x77, 0x77, 0x0D, 0xA0,
+    0x9C, 0xA7, 0x4F, 0x9A, 0xCA, 0x74, 0xD0, 0xF7, 0x49, 0xCA, 0x0A, 0xD9, 0x77, 0x77, 0x77, 0x74,
+    0x9E, 0x6F, 0x94, 0xAD, 0xA6, 0xFA, 0x4E, 0x95, 0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD,
+    0x3E, 0x95, 0x9F, 0xD9, 0x19, 0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE,
+    0x09, 0xE6, 0xF9, 0x9E, 0x0A, 0xE6, 0xF1, 0xE9, 0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59,
+    0xF9, 0x1F, 0xDA, 0x5A, 0xF9, 0x1A, 0xFC, 0x6F, 0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA5, 0x71,
+    0xAA, 0xA7, 0x71, 0xAD, 0xA7, 0x71, 0xF7, 0x71, 0xF7, 0x77, 0x77, 0x77, 0x9F, 0xC9, 0x73, 0xAF,
+    0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE,
+    0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96,
+    0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA,
+    0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x76, 0xD9, 0x77, 0x0A, 0xD7, 0x70, 0x9D,
+    0x77, 0x1D, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0xFC, 0x97, 0x3A, 0xFF,
+    0xC7, 0x1F, 0xFF, 0x7F, 0xA3, 0xAE, 0xA5, 0xF9, 0x5F, 0x4A, 0xE9, 0x6A, 0xE4, 0xEA, 0x7A, 0xE3,
+    0x9E, 0x70, 0xAE, 0x3F, 0x70, 0xF3, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x69,
+    0xF3, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA6,
+    0x9F, 0xFE, 0xA7, 0x1A, 0xFD, 0xA9, 0x77, 0x74, 0x77, 0x76, 0xD9, 0x77, 0x0A, 0xE9, 0x76, 0x9F,
+    0xCA, 0x75, 0xE9, 0xAD, 0xA7, 0x3E, 0x3A, 0xD7, 0x77, 0x71, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71,
+    0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE, 0x39, 0xE7,
+    0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A,
+    0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF,
+    0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x77, 0x77, 0xAD, 0x1C, 0xA7, 0x4A, 0xEA, 0x9C, 0xA7,
+    0x4D, 0x0F, 0x97, 0x4D, 0x09, 0xDA, 0x77, 0x77, 0x77, 0x69, 0xFC, 0x97, 0x3A, 0xFF, 0xC7, 0x1F,
+    0xFF, 0x7F, 0xA3, 0xAE, 0xA5, 0xF9, 0x5F, 0x4A, 0xE9, 0x6A, 0xE4, 0xEA, 0x7A, 0xE3, 0x9E, 0x70,
+    0xAE, 0x3F, 0x70, 0xF3, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x69, 0xF3, 0xAF,
+    0xA9, 0x19, 0x9F, 0xCA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA6, 0x9F, 0xFE,
+    0xA7, 0x1A, 0xFD, 0xA9, 0x77, 0x74, 0x71, 0xE9, 0x1E, 0x72, 0x9E, 0x90, 0xAE, 0x72, 0xAE, 0x1F,
+    0x72, 0xF0, 0x9E, 0xA7, 0x19, 0xAA, 0xAA, 0x09, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x49, 0xFC, 0x97,
+    0x3A, 0xFF, 0xC7, 0x1F, 0xFF, 0x7F, 0xA3, 0xAE, 0xA5, 0xF9, 0x5F, 0x4A, 0xE9, 0x6A, 0xE4, 0xEA,
+    0x7A, 0xE3, 0x9E, 0x70, 0xAE, 0x3F, 0x70, 0xF3, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x7A, 0xE9, 0x2A,
+    0xE9, 0x69, 0xF3, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x95, 0xFF,
+    0xFC, 0xA6, 0x9F, 0xFE, 0xA7, 0x1A, 0xFD, 0xA9, 0x77, 0x74, 0x2A, 0xE1, 0xAD, 0xA4, 0xFE, 0xA5,
+    0x9F, 0xCA, 0x7F, 0xA7, 0xFD, 0x94, 0x9F, 0xF9, 0x2A, 0xF0, 0x9F, 0x10, 0x77, 0x77, 0x49, 0xAA,
+    0x97, 0x77, 0x72, 0xF9, 0x77, 0x77, 0x2F, 0x97, 0x77, 0x72, 0xF9, 0x77, 0x77, 0x2F, 0xA7, 0x77,
+    0x72, 0xFA, 0x77, 0x77, 0x2F, 0xA7, 0x77, 0x72, 0xFA, 0x77, 0x77, 0x2A, 0xEA, 0x77, 0x77, 0x2A,
+    0xF7, 0x77, 0x39, 0xFC, 0x9A, 0xF7, 0x77, 0x2A, 0xFF, 0xF7, 0x77, 0x2F, 0xFF, 0xC7, 0x77, 0x2F,
+    0xA2, 0xAF, 0xA7, 0x77, 0x1F, 0x92, 0xAF, 0xD7, 0x77, 0x0A, 0xE9, 0x2A, 0xFE, 0x77, 0x70, 0xEA,
+    0x2A, 0xFA, 0xE7, 0x77, 0x9E, 0x2A, 0xF0, 0xAE, 0x77, 0x7F, 0x1A, 0xF1, 0xF7, 0x77, 0xE9, 0x0A,
+    0xF2, 0xEA, 0x77, 0x69, 0xE9, 0xAF, 0x2A, 0xE9, 0x77, 0x6A, 0xFF, 0x91, 0x9F, 0x77, 0x7A, 0xFE,
+    0x99, 0x9F, 0xCA, 0x77, 0x7A, 0xFF, 0xFE, 0x77, 0x70, 0xAF, 0xFF, 0xD9, 0x77, 0x70, 0xAF, 0xFF,
+    0xCA, 0x77, 0x70, 0xAF, 0xFF, 0xCA, 0x77, 0x70, 0xAF, 0xFE, 0xA9, 0x77, 0x71, 0xAF, 0xC7, 0x77,
+    0x71, 0xAF, 0xC7, 0x77, 0x71, 0xAF, 0xC7, 0x77, 0x71, 0xAF, 0xC7, 0x77, 0x71, 0xAF, 0xC7, 0x77,
+    0x71, 0xAF, 0xC7, 0x77, 0x71, 0xAF, 0xA7, 0x77, 0x71, 0xAD, 0xA9, 0x77, 0x77, 0x29, 0xA7, 0x77,
+    0x76, 0x71, 0xE9, 0x77, 0x1E, 0x97, 0x70, 0x9E, 0xA7, 0x70, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0xFA, 0x4A, 0xF5, 0xF9, 0x4F, 0xA4, 0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE,
+    0xA5, 0xF5, 0xF9, 0x5F, 0x5F, 0x59, 0xEA, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA,
+    0x5F, 0x59, 0xE9, 0x49, 0xEA, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF,
+    0xFC, 0x79, 0xFF, 0xE7, 0x1A, 0xFF, 0xA7, 0x77, 0x40, 0x77, 0x99, 0x77, 0x1D, 0xA7, 0x70, 0xAD,
+    0x77, 0x09, 0xD9, 0x77, 0x0D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xFA, 0x4A,
+    0xF5, 0xF9, 0x4F, 0xA4, 0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0xA5, 0xF5, 0xF9,
+    0x5F, 0x5F, 0x59, 0xEA, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9,
+    0x49, 0xEA, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF, 0xFC, 0x79, 0xFF,
+    0xE7, 0x1A, 0xFF, 0xA7, 0x77, 0x40, 0x71, 0xD9, 0x77, 0x09, 0xE9, 0x77, 0xFC, 0xA7, 0x5A, 0xDA,
+    0xAE, 0x73, 0x9D, 0x92, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x7F, 0xA4, 0xAF, 0x5F, 0x94, 0xFA, 0x49,
+    0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A, 0xE9, 0x4A, 0xEA, 0x5F, 0x5F, 0x95, 0xF5, 0xF5, 0x9E, 0xA4,
+    0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F, 0x5F, 0x6E, 0xA5, 0xF5, 0x9E, 0x94, 0x9E, 0xA5, 0xAE, 0xA3,
+    0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC9, 0x6F, 0xFF, 0xC7, 0x9F, 0xFE, 0x71, 0xAF, 0xFA, 0x77,
+    0x74, 0x72, 0xAA, 0x91, 0x9A, 0xA9, 0x72, 0xAD, 0xA1, 0xE9, 0x72, 0xEA, 0x0A, 0xE7, 0x2A, 0xE9,
+    0x0F, 0x72, 0xF9, 0x9F, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xFA, 0x4A, 0xF5, 0xF9, 0x4F, 0xA4,
+    0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0xA5, 0xF5, 0xF9, 0x5F, 0x5F, 0x59, 0xEA,
+    0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9, 0x49, 0xEA, 0x5A, 0xEA,
+    0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF, 0xFC, 0x79, 0xFF, 0xE7, 0x1A, 0xFF, 0xA7,
+    0x77, 0x40, 0x72, 0xD9, 0x73, 0xAD, 0x73, 0x9D, 0x74, 0xDA, 0x74, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x4A, 0xE7, 0xEA, 0x9E, 0x95, 0xF1, 0xEA, 0x4A, 0xE2, 0xF3, 0x9E, 0x92, 0xF2,
+    0x9E, 0xA3, 0xAE, 0x91, 0xF4, 0x9E, 0xA0, 0xF6, 0xFA, 0xE9, 0x6F, 0xF7, 0xFE, 0x70, 0xAF, 0xC9,
+    0x70, 0x9F, 0xA7, 0x19, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFC, 0x71,
+    0x39, 0xAA, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xEA, 0x96, 0xAF, 0xD5, 0xFF, 0x4D, 0xA1, 0xAD, 0xA2,
+    0x9D, 0x3E, 0x2A, 0xD2, 0xAD, 0xA2, 0xDA, 0x1A, 0xE3, 0xFF, 0x92, 0x9F, 0xE4, 0xAF, 0xC9, 0x5D,
+    0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xAC, 0xA7, 0x10, 0x77, 0x69, 0xFC, 0xA7, 0x9F, 0xEA, 0x59,
+    0xE9, 0x1A, 0xD5, 0xE9, 0x2A, 0xD5, 0xDA, 0x1A, 0xF4, 0xAD, 0x90, 0xAE, 0xA9, 0x4E, 0x1D, 0x97,
+    0xE0, 0x9D, 0x7A, 0xE0, 0x9D, 0xA6, 0xEA, 0x1E, 0xA5, 0xE9, 0x1A, 0xEA, 0x39, 0xE3, 0xAE, 0x3F,
+    0x4E, 0x3F, 0xCA, 0xAA, 0xEA, 0x29, 0xFF, 0xE9, 0x2F, 0xFE, 0x93, 0x99, 0x99, 0x9A, 0xEA, 0x40,
+    0x59, 0xAA, 0x97, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xEA, 0x77, 0x77, 0x77, 0x0A, 0xE9, 0xDA, 0x4F,
+    0xFA, 0x3E, 0xAA, 0xF9, 0x2A, 0xD3, 0xE2, 0x9D, 0x93, 0xE2, 0xAC, 0xA4, 0xE2, 0xD5, 0xE2, 0xD4,
+    0xAD, 0xA1, 0x9F, 0xFD, 0x92, 0xFF, 0xD9, 0x2F, 0xFD, 0x4A, 0xEA, 0x9E, 0x10, 0x73, 0xD9, 0x72,
+    0xAC, 0xA7, 0x2A, 0xD7, 0x29, 0xD9, 0x72, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0x9D,
+    0xA5, 0xFF, 0xA4, 0xEA, 0xAF, 0x93, 0xAD, 0x3E, 0x39, 0xD9, 0x3E, 0x3A, 0xCA, 0x4E, 0x3D, 0x5E,
+    0x3D, 0x4A, 0xDA, 0x29, 0xFF, 0xD9, 0x3F, 0xFD, 0x93, 0xFF, 0xD5, 0xAE, 0xA9, 0xE2, 0x59, 0xD7,
+    0x3A, 0xE7, 0x19, 0xFC, 0x70, 0xE9, 0xE9, 0x5E, 0x29, 0xDA, 0x77, 0x77, 0x4A, 0xE9, 0xDA, 0x5F,
+    0xFA, 0x4E, 0xAA, 0xF9, 0x3A, 0xD3, 0xE3, 0x9D, 0x93, 0xE3, 0xAC, 0xA4, 0xE3, 0xD5, 0xE3, 0xD4,
+    0xAD, 0xA2, 0x9F, 0xFD, 0x93, 0xFF, 0xD9, 0x3F, 0xFD, 0x5A, 0xEA, 0x9E, 0x20, 0x7A, 0xCA, 0x1A,
+    0x96, 0xAE, 0x9A, 0xCA, 0x6D, 0x0F, 0x69, 0xCA, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x3A, 0xE9, 0xDA,
+    0x5F, 0xFA, 0x4E, 0xAA, 0xF9, 0x3A, 0xD3, 0xE3, 0x9D, 0x93, 0xE3, 0xAC, 0xA4, 0xE3, 0xD5, 0xE3,
+    0xD4, 0xAD, 0xA2, 0x9F, 0xFD, 0x93, 0xFF, 0xD9, 0x3F, 0xFD, 0x5A, 0xEA, 0x9E, 0x20, 0x69, 0xAA,
+    0x2A, 0xAA, 0x7E, 0x1A, 0xE6, 0xAE, 0x1F, 0x6F, 0x09, 0xEA, 0x5A, 0xF0, 0xFA, 0x77, 0x77, 0x77,
+    0x71, 0xAE, 0x9D, 0xA7, 0xFF, 0xA6, 0xEA, 0xAF, 0x95, 0xAD, 0x3E, 0x59, 0xD9, 0x3E, 0x5A, 0xCA,
+    0x4E, 0x5D, 0x5E, 0x5D, 0x4A, 0xDA, 0x49, 0xFF, 0xD9, 0x5F, 0xFD, 0x95, 0xFF, 0xD7, 0xAE, 0xA9,
+    0xE4, 0x71, 0xDA, 0x71, 0xF7, 0x09, 0xCA, 0xAC, 0x97, 0x9F, 0x71, 0xE9, 0x77, 0x77, 0x77, 0x0A,
+    0xE9, 0xDA, 0x4F, 0xFA, 0x3E, 0xAA, 0xF9, 0x2A, 0xD3, 0xE2, 0x9D, 0x93, 0xE2, 0xAC, 0xA4, 0xE2,
+    0xD5, 0xE2, 0xD4, 0xAD, 0xA1, 0x9F, 0xFD, 0x92, 0xFF, 0xD9, 0x2F, 0xFD, 0x4A, 0xEA, 0x9E, 0x10,
+    0x77, 0x74, 0xAE, 0x9D, 0xA0, 0xAE, 0xA7, 0xFF, 0xFF, 0x5E, 0xAA, 0xFE, 0x90, 0x9D, 0xA3, 0xAD,
+    0x3F, 0xC9, 0x99, 0xAA, 0xD2, 0x9D, 0x93, 0xFF, 0xF2, 0xAC, 0xA4, 0xFF, 0xF2, 0xD5, 0xE9, 0x99,
+    0x97, 0xD4, 0xAE, 0x95, 0x92, 0x9F, 0xFF, 0xCA, 0x9A, 0xAD, 0x3F, 0xFF, 0xFD, 0xA3, 0xFF, 0xFF,
+    0xD9, 0x4A, 0xEA, 0x9E, 0x9F, 0xCA, 0x30, 0x77, 0x09, 0xAE, 0xA4, 0xAF, 0xD3, 0xFC, 0xAA, 0xC2,
+    0xAD, 0xA7, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x70, 0xEA, 0x1A, 0x4F, 0xF3, 0x9F, 0xE9, 0x39, 0xFC,
+    0xA6, 0xDA, 0x7A, 0xAD, 0x97, 0x0D, 0x95, 0x9F, 0x6A, 0xDA, 0x50, 0x59, 0xAA, 0x97, 0x2E, 0x97,
+    0x19, 0xE9, 0x71, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xEA, 0x6A, 0xFE, 0x4A, 0xDA, 0x90,
+    0x9D, 0x92, 0xAD, 0xA9, 0x99, 0xAD, 0xA2, 0xFF, 0xDA, 0x1A, 0xFF, 0xDA, 0x1E, 0x99, 0x99, 0x6E,
+    0x72, 0xFA, 0xAA, 0xAA, 0xCA, 0x2F, 0xFD, 0x93, 0xFF, 0xC5, 0xAF, 0xA9, 0x30, 0x73, 0xD7, 0x3D,
+    0x97, 0x2A, 0xD7, 0x2A, 0xD9, 0x72, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAE,
+    0xA7, 0xAF, 0xE5, 0xAD, 0xA9, 0x09, 0xD9, 0x3A, 0xDA, 0x99, 0x9A, 0xDA, 0x3F, 0xFD, 0xA2, 0xAF,
+    0xFD, 0xA2, 0xE9, 0x99, 0x97, 0xE7, 0x3F, 0xAA, 0xAA, 0xAC, 0xA3, 0xFF, 0xD9, 0x4F, 0xFC, 0x6A,
+    0xFA, 0x94, 0x59, 0xCA, 0x73, 0xEA, 0x71, 0xAF, 0xC7, 0x9E, 0x9E, 0x95, 0xDA, 0x2A, 0xD9, 0x77,
+    0x77, 0x77, 0x77, 0x2A, 0xEA, 0x7A, 0xFE, 0x5A, 0xDA, 0x90, 0x9D, 0x93, 0xAD, 0xA9, 0x99, 0xAD,
+    0xA3, 0xFF, 0xDA, 0x2A, 0xFF, 0xDA, 0x2E, 0x99, 0x99, 0x7E, 0x73, 0xFA, 0xAA, 0xAA, 0xCA, 0x3F,
+    0xFD, 0x94, 0xFF, 0xC6, 0xAF, 0xA9, 0x40, 0x6A, 0xAA, 0x2A, 0xA9, 0x59, 0xE1, 0xEA, 0x5F, 0x1E,
+    0xA4, 0x9E, 0xA0, 0xAE, 0x94, 0xFA, 0x0F, 0x97, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA7, 0x0A,
+    0xFE, 0x6A, 0xDA, 0x90, 0x9D, 0x94, 0xAD, 0xA9, 0x99, 0xAD, 0xA4, 0xFF, 0xDA, 0x3A, 0xFF, 0xDA,
+    0x3E, 0x99, 0x99, 0x70, 0xE7, 0x4F, 0xAA, 0xAA, 0xAC, 0xA4, 0xFF, 0xD9, 0x5F, 0xFC, 0x7A, 0xFA,
+    0x95, 0x2E, 0x95, 0x9E, 0x95, 0xAE, 0x95, 0x9A, 0xAA, 0x77, 0x70, 0xAC, 0xA6, 0xE6, 0xDA, 0x59,
+    0xD9, 0x5A, 0xD6, 0xE5, 0x9D, 0xA5, 0xAD, 0x95, 0xE5, 0x9E, 0x5A, 0xE5, 0xAD, 0xA4, 0x70, 0x97,
+    0x0D, 0x96, 0xAD, 0x69, 0xD6, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x4A, 0xCA, 0x7E, 0x7D, 0xA6, 0x9D,
+    0x96, 0xAD, 0x7E, 0x69, 0xDA, 0x6A, 0xD9, 0x6E, 0x69, 0xE6, 0xAE, 0x6A, 0xDA, 0x50, 0x77, 0xD9,
+    0x7A, 0xE9, 0x59, 0xFC, 0xA4, 0xE9, 0x9E, 0x2E, 0x3A, 0xD9, 0x77, 0x0A, 0xCA, 0x70, 0xE7, 0x0D,
+    0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xE7, 0xAD, 0xA5,
+    0x2A, 0xD1, 0xAD, 0x3E, 0x1E, 0x2A, 0xE0, 0xAE, 0x2F, 0x0F, 0x77, 0x74, 0xAC, 0xA7, 0x0E, 0x70,
+    0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x79, 0xE7, 0xAE, 0x7A, 0xDA,
+    0x60, 0x77, 0x76, 0xAC, 0xA7, 0x79, 0xF7, 0x69, 0xAE, 0x97, 0x49, 0x99, 0xAD, 0xA9, 0x99, 0x70,
+    0xAF, 0xFD, 0x70, 0xFF, 0xDA, 0x74, 0xD9, 0x71, 0xAE, 0xA0, 0x9D, 0x70, 0xAF, 0xFC, 0xA7, 0xAF,
+    0xFD, 0x97, 0xE9, 0x2F, 0x7A, 0xDA, 0x3E, 0x97, 0xE4, 0xE7, 0x0E, 0x91, 0x9E, 0x97, 0x0F, 0xFC,
+    0xA7, 0x1F, 0xFC, 0x73, 0xFE, 0x75, 0xAA, 0xCA, 0x97, 0x30, 0x75, 0xAA, 0x70, 0xAD, 0x1D, 0x7A,
+    0xEA, 0x9C, 0xA7, 0xD0, 0xF7, 0x0D, 0x1D, 0x97, 0x77, 0x77, 0x74, 0x9D, 0x9A, 0xE9, 0x6F, 0xFC,
+    0x95, 0xFC, 0xAE, 0xA4, 0xAE, 0x92, 0xE4, 0xE9, 0x3D, 0xA4, 0xE3, 0x9D, 0xA3, 0xAD, 0xA3, 0xAD,
+    0x93, 0xE9, 0x3E, 0x4E, 0x92, 0x9E, 0x3A, 0xE3, 0xF3, 0xF3, 0xEA, 0x29, 0xEA, 0x2A, 0xE9, 0x20,
+    0x49, 0xAA, 0xA7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xEA, 0x77, 0x77, 0x29, 0xAE, 0xA6, 0xAF, 0xE4,
+    0xFA, 0xAE, 0xA2, 0xAE, 0x3E, 0x2E, 0x4E, 0x1A, 0xD9, 0x4E, 0x1E, 0x4A, 0xDA, 0x1E, 0xA1, 0x9F,
+    0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x4F, 0xEA, 0x6A, 0xEA, 0x94, 0x73, 0x97, 0x3D, 0x72, 0xDA, 0x71,
+    0xAD, 0x71, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAE, 0xA6, 0xAF, 0xE4, 0xFA, 0xAE, 0xA2,
+    0xAE, 0x3E, 0x2E, 0x4E, 0x1A, 0xD9, 0x4E, 0x1E, 0x4A, 0xDA, 0x1E, 0xA1, 0x9F, 0x2F, 0xFD, 0xA2,
+    0xAF, 0xFC, 0x4F, 0xEA, 0x6A, 0xEA, 0x94, 0x77, 0x29, 0xD7, 0x2F, 0x70, 0xAF, 0xC9, 0x59, 0xE9,
+    0xAD, 0xA4, 0xE3, 0xAD, 0x77, 0x39, 0xAE, 0xA6, 0xAF, 0xE4, 0xFA, 0xAE, 0xA2, 0xAE, 0x3E, 0x2E,
+    0x4E, 0x1A, 0xD9, 0x4E, 0x1E, 0x4A, 0xDA, 0x1E, 0xA1, 0x9F, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x4F,
+    0xEA, 0x6A, 0xEA, 0x94, 0x77, 0x4A, 0xD1, 0xCA, 0x5A, 0xEA, 0x9C, 0xA5, 0xD0, 0xF5, 0x9D, 0x09,
+    0xDA, 0x77, 0x77, 0x19, 0xAE, 0xA6, 0xAF, 0xE4, 0xFA, 0xAE, 0xA2, 0xAE, 0x3E, 0x2E, 0x4E, 0x1A,
+    0xD9, 0x4E, 0x1E, 0x4A, 0xDA, 0x1E, 0xA1, 0x9F, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x4F, 0xEA, 0x6A,
+    0xEA, 0x94, 0x5E, 0x91, 0xE5, 0x9E, 0x1A, 0xE5, 0xF1, 0xF5, 0xF0, 0xAE, 0xA4, 0x9A, 0xAA, 0x90,
+    0xAA, 0xAA, 0x97, 0x77, 0x75, 0x9A, 0xEA, 0x70, 0xAF, 0xE6, 0xFA, 0xAE, 0xA4, 0xAE, 0x3E, 0x4E,
+    0x4E, 0x3A, 0xD9, 0x4E, 0x3E, 0x4A, 0xDA, 0x3E, 0xA1, 0x9F, 0x4F, 0xFD, 0xA4, 0xAF, 0xFC, 0x6F,
+    0xEA, 0x70, 0xAE, 0xA9, 0x60, 0x79, 0xAA, 0x74, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x2A, 0xF7, 0x77,
+    0x99, 0x9A, 0xAA, 0xAA, 0xAE, 0x91, 0xAF, 0xFF, 0xA0, 0xAF, 0xFF, 0xCA, 0x77, 0x49, 0xAA, 0x97,
+    0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xF9, 0x72, 0xF7, 0x77, 0x59, 0x77, 0x4A, 0xCA, 0x77, 0x3A, 0xD7,
+    0x74, 0xDA, 0x77, 0x3A, 0xD7, 0x73, 0x9D, 0xA7, 0x73, 0xE7, 0x73, 0x9D, 0x97, 0x73, 0xE7, 0x73,
+    0xAD, 0x97, 0x73, 0xE7, 0x73, 0xAD, 0x97, 0x79, 0xAF, 0xA7, 0x7F, 0xF7, 0x6F, 0xFC, 0xA7, 0x4A,
+    0xDA, 0x0F, 0xD7, 0x4E, 0x0A, 0xD9, 0xE7, 0x3A, 0xDA, 0x9E, 0x0E, 0x73, 0xE9, 0xE0, 0xAD, 0xA7,
+    0x3F, 0xEA, 0xE7, 0x4F, 0xFD, 0xA7, 0x4A, 0xFF, 0xC7, 0x6F, 0xEA, 0x77, 0xFC, 0xA9, 0x77, 0xAE,
+    0x77, 0x3E, 0x77, 0x3A, 0xDA, 0x77, 0x3E, 0x77, 0x3E, 0xA7, 0x72, 0x9E, 0x77, 0x3E, 0xA7, 0x72,
+    0x9E, 0x77, 0x3D, 0xA7, 0x73, 0xAC, 0x77, 0x59, 0x77, 0x50, 0x49, 0xE7, 0x2A, 0xE7, 0x2F, 0x72,
+    0x9A, 0xAA, 0x77, 0x77, 0x9D, 0x93, 0x9D, 0xA1, 0xAD, 0x4A, 0xD9, 0x1A, 0xD4, 0xE2, 0xE3, 0x9E,
+    0x2D, 0xA3, 0xAD, 0xA1, 0x9D, 0x93, 0xEA, 0x1A, 0xD9, 0x29, 0xE9, 0x1A, 0xD3, 0xF2, 0xFA, 0x9F,
+    0xC2, 0xFF, 0xDA, 0x2A, 0xFF, 0xC9, 0x3A, 0xFA, 0xE2, 0x73, 0x97, 0x29, 0xD7, 0x2D, 0x97, 0x1A,
+    0xD7, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9D, 0x93, 0x9D, 0xA1, 0xAD, 0x4A, 0xD9, 0x1A,
+    0xD4, 0xE2, 0xE3, 0x9E, 0x2D, 0xA3, 0xAD, 0xA1, 0x9D, 0x93, 0xEA, 0x1A, 0xD9, 0x29, 0xE9, 0x1A,
+    0xD3, 0xF2, 0xFA, 0x9F, 0xC2, 0xFF, 0xDA, 0x2A, 0xFF, 0xC9, 0x3A, 0xFA, 0xE2, 0x49, 0xD7, 0x2A,
+    0xE7, 0x09, 0xFC, 0x7E, 0x9E, 0x94, 0xE2, 0x9D, 0xA7, 0x77, 0x69, 0xD9, 0x39, 0xDA, 0x1A, 0xD4,
+    0xAD, 0x91, 0xAD, 0x4E, 0x2E, 0x39, 0xE2, 0xDA, 0x3A, 0xDA, 0x19, 0xD9, 0x3E, 0xA1, 0xAD, 0x92,
+    0x9E, 0x91, 0xAD, 0x3F, 0x2F, 0xA9, 0xFC, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x93, 0xAF, 0xAE, 0x20,
+    0x59, 0xAA, 0x2A, 0xAA, 0x6E, 0x1A, 0xE5, 0xAE, 0x1F, 0x5F, 0x09, 0xEA, 0x4A, 0xF0, 0xFA, 0x77,
+    0x77, 0x77, 0x29, 0xD9, 0x39, 0xDA, 0x3A, 0xD4, 0xAD, 0x93, 0xAD, 0x4E, 0x4E, 0x39, 0xE4, 0xDA,
+    0x3A, 0xDA, 0x39, 0xD9, 0x3E, 0xA3, 0xAD, 0x92, 0x9E, 0x93, 0xAD, 0x3F, 0x4F, 0xA9, 0xFC, 0x4F,
+    0xFD, 0xA4, 0xAF, 0xFC, 0x95, 0xAF, 0xAE, 0x40, 0x75, 0x99, 0x75, 0x9D, 0x75, 0xD9, 0x74, 0xDA,
+    0x74, 0xAD, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xE5, 0xE9, 0x3E, 0x93, 0x9D,
+    0xA4, 0xAE, 0x3E, 0x59, 0xE2, 0xAD, 0xA6, 0xE9, 0x1E, 0x7E, 0xA0, 0xAD, 0x97, 0xF9, 0xE7, 0x0A,
+    0xFD, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x73, 0xFA, 0x73, 0xAE, 0x74, 0xEA, 0x73, 0xF7, 0x0A, 0xAF,
+    0xC9, 0x79, 0xFD, 0xA7, 0x0A, 0xFC, 0xA7, 0x1F, 0xA7, 0x30, 0x49, 0xDA, 0x71, 0xAD, 0x97, 0x1E,
+    0x72, 0xE9, 0x70, 0x9F, 0xC9, 0x6A, 0xFD, 0xA5, 0xE9, 0xAE, 0x5E, 0x1A, 0xDA, 0x39, 0xDA, 0x2D,
+    0xA3, 0xAD, 0x92, 0xDA, 0x3E, 0x2A, 0xD4, 0xE1, 0x9D, 0xA3, 0x9D, 0xA0, 0x9E, 0x4A, 0xDA, 0xF9,
+    0x4F, 0xE9, 0x5F, 0xCA, 0x69, 0xE9, 0x70, 0xAD, 0x97, 0x1E, 0x72, 0xE7, 0x19, 0xD9, 0x71, 0x9A,
+    0xA7, 0x20, 0x70, 0xE1, 0xAE, 0x7A, 0xE1, 0xEA, 0x7F, 0x09, 0xE9, 0x6A, 0xEA, 0x0F, 0x96, 0x9A,
+    0xAA, 0x90, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xE5, 0xE9, 0x4E, 0x93, 0x9D, 0xA5,
+    0xAE, 0x3E, 0x69, 0xE2, 0xAD, 0xA7, 0xE9, 0x1E, 0x70, 0xEA, 0x0A, 0xD9, 0x70, 0xF9, 0xE7, 0x1A,
+    0xFD, 0x97, 0x19, 0xFD, 0x73, 0xFC, 0x74, 0xFA, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0xF7, 0x1A, 0xAF,
+    0xC9, 0x70, 0x9F, 0xDA, 0x71, 0xAF, 0xCA, 0x72, 0xFA, 0x74, 0x75, 0x99, 0x99, 0xAA, 0x72, 0x9F,
+    0xFC, 0x72, 0xFF, 0xD9, 0x71, 0x99, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0xE9, 0x77, 0xAE,
+    0x97, 0x69, 0xFA, 0x76, 0xFC, 0xA7, 0x5A, 0xDA, 0xE7, 0x49, 0xE9, 0xE7, 0x4E, 0x90, 0xE7, 0x3A,
+    0xDA, 0x1E, 0x73, 0xE2, 0xE9, 0x71, 0xEA, 0x2E, 0x97, 0x0A, 0xE3, 0xEA, 0x70, 0xFF, 0xEA, 0x7F,
+    0xFF, 0xC6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFD, 0x5F, 0x6F, 0x49, 0xEA, 0x6F, 0x93, 0xF7, 0xF9, 0x20,
+    0x76, 0x97, 0xFF, 0xC6, 0xFF, 0xD5, 0x9D, 0xAA, 0xAA, 0xAA, 0x99, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0xAE, 0x9D, 0xA7, 0xFF, 0xA6, 0xEA, 0xAF, 0x95, 0xAD, 0x3E, 0x59, 0xD9, 0x3E, 0x5A, 0xCA, 0x4E,
+    0x5D, 0x5E, 0x5D, 0x4A, 0xDA, 0x49, 0xFF, 0xD9, 0x5F, 0xFD, 0x95, 0xFF, 0xD7, 0xAE, 0xA9, 0xE4,
+    0x77, 0x77, 0xAD, 0x29, 0xDA, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xEA, 0x74, 0x9F, 0xA9, 0x77, 0x77,
+    0x77, 0x77, 0x74, 0xE9, 0x77, 0xAE, 0x97, 0x69, 0xFA, 0x76, 0xFC, 0xA7, 0x5A, 0xDA, 0xE7, 0x49,
+    0xE9, 0xE7, 0x4E, 0x90, 0xE7, 0x3A, 0xDA, 0x1E, 0x73, 0xE2, 0xE9, 0x71, 0xEA, 0x2E, 0x97, 0x0A,
+    0xE3, 0xEA, 0x70, 0xFF, 0xEA, 0x7F, 0xFF, 0xC6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFD, 0x5F, 0x6F, 0x49,
+    0xEA, 0x6F, 0x93, 0xF7, 0xF9, 0x20, 0x77, 0x7A, 0xD2, 0x9D, 0xA6, 0xFF, 0xC7, 0x9F, 0xE9, 0x70,
+    0x9F, 0xA7, 0x77, 0x77, 0x77, 0x3A, 0xE9, 0xDA, 0x7F, 0xFA, 0x6E, 0xAA, 0xF9, 0x5A, 0xD3, 0xE5,
+    0x9D, 0x93, 0xE5, 0xAC, 0xA4, 0xE5, 0xD5, 0xE5, 0xD4, 0xAD, 0xA4, 0x9F, 0xFD, 0x95, 0xFF, 0xD9,
+    0x5F, 0xFD, 0x7A, 0xEA, 0x9E, 0x40, 0x73, 0xE9, 0x74, 0xAE, 0x97, 0x39, 0xFA, 0x73, 0xFC, 0xA7,
+    0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A, 0xDA, 0x1E, 0x70, 0xE2, 0xE9, 0x6E,
+    0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2,
+    0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x97, 0x39, 0xE7, 0x5E, 0x75, 0x9F, 0xA7, 0x4F, 0xA7,
+    0x5A, 0xD9, 0x77, 0x20, 0x77, 0x3A, 0xE9, 0xDA, 0x4F, 0xFA, 0x3E, 0xAA, 0xF9, 0x2A, 0xD3, 0xE2,
+    0x9D, 0x93, 0xE2, 0xAC, 0xA4, 0xE2, 0xD5, 0xE2, 0xD4, 0xAD, 0xA1, 0x9F, 0xFD, 0x92, 0xFF, 0xD9,
+    0x2F, 0xFD, 0x4A, 0xEA, 0x9E, 0x72, 0xE9, 0x70, 0xE9, 0x70, 0xAD, 0x72, 0xFC, 0x70, 0xAF, 0x71,
+    0x9A, 0xAA, 0x10, 0x74, 0x9D, 0x76, 0xD7, 0x6D, 0xA7, 0x5A, 0xD7, 0x69, 0x97, 0x77, 0x77, 0x71,
+    0x9A, 0xAF, 0xCA, 0x7F, 0xFC, 0xA5, 0x9F, 0xFD, 0x5A, 0xFF, 0xE4, 0x9F, 0xC9, 0x72, 0xFA, 0x73,
+    0xFA, 0x73, 0x9F, 0x74, 0xFA, 0x74, 0xF9, 0x73, 0x9F, 0x74, 0xAF, 0x97, 0x3A, 0xFC, 0x92, 0x9A,
+    0xC4, 0xAF, 0xFF, 0x49, 0xFF, 0xF5, 0xFF, 0xEA, 0x59, 0xFF, 0xDA, 0x69, 0xFF, 0xC9, 0x30, 0x70,
+    0xAC, 0xA7, 0x9D, 0x79, 0xD9, 0x7E, 0x70, 0x99, 0x77, 0x39, 0xAE, 0xA4, 0xFE, 0x3F, 0xCA, 0xAC,
+    0x2A, 0xDA, 0x7E, 0x7A, 0xDA, 0x7E, 0x97, 0xE7, 0x0E, 0xA1, 0xA4, 0xFF, 0x39, 0xFE, 0x93, 0x9A,
+    0xFA, 0x20, 0x77, 0x75, 0xD9, 0x76, 0x9E, 0x97, 0x5F, 0xCA, 0x73, 0xE9, 0x9E, 0x71, 0xAD, 0x3A,
+    0xD9, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xFC, 0xA7, 0x0F, 0xFC, 0xA6, 0x9F, 0xFD, 0x6A, 0xFF,
+    0xE5, 0x9F, 0xC9, 0x73, 0xFA, 0x74, 0xFA, 0x74, 0x9F, 0x75, 0xFA, 0x75, 0xF9, 0x74, 0x9F, 0x75,
+    0xAF, 0x97, 0x4A, 0xFC, 0x92, 0x9A, 0xC5, 0xAF, 0xFF, 0x59, 0xFF, 0xF6, 0xFF, 0xEA, 0x69, 0xFF,
+    0xDA, 0x79, 0xFF, 0xC9, 0x40, 0x6D, 0x73, 0xAE, 0x71, 0x9F, 0xC9, 0x7E, 0x9E, 0x95, 0xE2, 0x9D,
+    0xA7, 0x77, 0x73, 0x9A, 0xEA, 0x7A, 0xFD, 0x6F, 0xCA, 0xAC, 0x5A, 0xDA, 0x72, 0xE7, 0x2A, 0xDA,
+    0x72, 0xE9, 0x72, 0xE7, 0x3E, 0xA1, 0xA7, 0xFF, 0x69, 0xFE, 0x96, 0x9A, 0xFA, 0x50, 0x74, 0xAD,
+    0xA7, 0x5E, 0x97, 0x4A, 0xE9, 0x74, 0xF7, 0x5A, 0xAA, 0xA7, 0x77, 0x77, 0x69, 0xAA, 0xFC, 0xA7,
+    0xFF, 0xCA, 0x59, 0xFF, 0xD5, 0xAF, 0xFE, 0x49, 0xFC, 0x97, 0x2F, 0xA7, 0x3F, 0xA7, 0x39, 0xF7,
+    0x4F, 0xA7, 0x4F, 0x97, 0x39, 0xF7, 0x4A, 0xF9, 0x73, 0xAF, 0xC9, 0x29, 0xAC, 0x4A, 0xFF, 0xF4,
+    0x9F, 0xFF, 0x5F, 0xFE, 0xA5, 0x9F, 0xFD, 0xA6, 0x9F, 0xFC, 0x93, 0x70, 0xE9, 0x79, 0xE7, 0x0F,
+    0x79, 0xF7, 0x9A, 0xAA, 0x97, 0x72, 0x9A, 0xEA, 0x5A, 0xFD, 0x4F, 0xCA, 0xAC, 0x3A, 0xDA, 0x70,
+    0xE7, 0x0A, 0xDA, 0x70, 0xE9, 0x70, 0xE7, 0x1E, 0xA1, 0xA5, 0xFF, 0x49, 0xFE, 0x94, 0x9A, 0xFA,
+    0x30, 0x70, 0x9A, 0x94, 0xAA, 0x97, 0x09, 0xDA, 0x1A, 0xDA, 0x72, 0xAF, 0xD9, 0x74, 0xFC, 0x77,
+    0xE7, 0x70, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xAF, 0xCA, 0x71, 0xFF, 0xCA, 0x79, 0xFF,
+    0xD7, 0xAF, 0xFE, 0x69, 0xFC, 0x97, 0x4F, 0xA7, 0x5F, 0xA7, 0x59, 0xF7, 0x6F, 0xA7, 0x6F, 0x97,
+    0x59, 0xF7, 0x6A, 0xF9, 0x75, 0xAF, 0xC9, 0x29, 0xAC, 0x6A, 0xFF, 0xF6, 0x9F, 0xFF, 0x7F, 0xFE,
+    0xA7, 0x9F, 0xFD, 0xA7, 0x09, 0xFF, 0xC9, 0x50, 0x77, 0x4E, 0x29, 0xDA, 0x6E, 0x9E, 0x97, 0x9F,
+    0xC9, 0x71, 0xAE, 0x74, 0xD7, 0x77, 0x77, 0x29, 0xAE, 0xA7, 0x0A, 0xFD, 0x7F, 0xCA, 0xAC, 0x6A,
+    0xDA, 0x73, 0xE7, 0x3A, 0xDA, 0x73, 0xE9, 0x73, 0xE7, 0x4E, 0xA1, 0xA7, 0x0F, 0xF7, 0x9F, 0xE9,
+    0x79, 0xAF, 0xA6, 0x77, 0x74, 0xE3, 0xAD, 0x72, 0xE9, 0xAD, 0xA7, 0x39, 0xFC, 0x97, 0x5A, 0xE9,
+    0x77, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x5F, 0xFA, 0x97, 0x1F, 0xFE, 0x96, 0x9F, 0xFF, 0x95, 0xAE,
+    0xAA, 0xAA, 0xFD, 0x5F, 0x5F, 0x94, 0xEA, 0x6E, 0x93, 0x9E, 0x96, 0xE9, 0x3A, 0xE7, 0xE9, 0x3F,
+    0x7E, 0x4E, 0xA6, 0x9E, 0x39, 0xE9, 0x6E, 0xA3, 0xAE, 0x6F, 0x93, 0xF2, 0x99, 0xAF, 0xC3, 0x9F,
+    0xFF, 0xD9, 0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xD5, 0xFF, 0xFA, 0x59, 0xFF, 0xCA, 0xA7, 0x74, 0xE7,
+    0x70, 0xE0, 0x9A, 0x97, 0x39, 0xDA, 0x0D, 0xA7, 0x3A, 0xD0, 0xAD, 0x97, 0x3E, 0x0E, 0x73, 0x9D,
+    0xA9, 0xDA, 0x59, 0xAD, 0xA9, 0xAD, 0x9E, 0x94, 0xAF, 0xFC, 0x70, 0xAF, 0xFC, 0xA7, 0xAD, 0xA1,
+    0x9F, 0x97, 0xDA, 0x3F, 0x7A, 0xD4, 0xF7, 0xDA, 0x39, 0xE9, 0x7E, 0x29, 0xF7, 0x0F, 0xFE, 0x70,
+    0xFF, 0xDA, 0x70, 0x9F, 0xFC, 0xA7, 0x2F, 0x9A, 0xD9, 0x70, 0x5F, 0xFA, 0x97, 0x2F, 0xFE, 0x97,
+    0x9F, 0xFF, 0x96, 0xAE, 0xAA, 0xAA, 0xFD, 0x6F, 0x5F, 0x95, 0xEA, 0x6E, 0x94, 0x9E, 0x96, 0xE9,
+    0x4A, 0xE7, 0xE9, 0x09, 0xFF, 0xD4, 0xE1, 0xAF, 0xFD, 0x39, 0xE1, 0x99, 0x9F, 0xA9, 0x99, 0x3E,
+    0xA4, 0xF6, 0xF5, 0xF2, 0x99, 0xFD, 0x49, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xCA, 0x5F, 0xFF, 0xD6,
+    0xFF, 0xFA, 0x69, 0xFF, 0xCA, 0xA7, 0x74, 0xE7, 0x70, 0xE7, 0x3A, 0xFF, 0xD7, 0x0F, 0xFD, 0xA7,
+    0x0A, 0xAA, 0xAE, 0xAA, 0xA7, 0x49, 0xDA, 0x71, 0x9A, 0xDA, 0x9A, 0xD9, 0x70, 0xAF, 0xFC, 0x70,
+    0xAF, 0xFC, 0xA7, 0xAD, 0xA1, 0x9F, 0x97, 0xDA, 0x3F, 0x7A, 0xD4, 0xEA, 0x7D, 0xA3, 0x9E, 0x97,
+    0xE2, 0x9F, 0x70, 0xFF, 0xE7, 0x0F, 0xFD, 0xA7, 0x09, 0xFF, 0xCA, 0x72, 0xF9, 0xAD, 0x97, 0x76,
+    0x99, 0x97, 0x09, 0xFF, 0xC7, 0x0F, 0xFD, 0x79, 0xAA, 0xAA, 0xA9, 0x99, 0x99, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x2A, 0xAA, 0xAF, 0xE6, 0xAF, 0xFD, 0xA6, 0xFF, 0xE7, 0xE9, 0x75, 0x9E, 0x76, 0xAE,
+    0x76, 0xEA, 0x75, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x70, 0xFF, 0xC9, 0x70, 0xEA, 0x97, 0x4A, 0xE7,
+    0x6F, 0x76, 0xFA, 0xAA, 0xAA, 0xAA, 0x69, 0xFF, 0xE6, 0xAF, 0xFE, 0x6F, 0xFF, 0x59, 0xFF, 0xF5,
+    0x75, 0x96, 0x9F, 0xFC, 0x5F, 0xFD, 0x4A, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x5A, 0xEA, 0x70, 0xAF, 0xE6, 0xAD, 0xA9, 0x09, 0xD9, 0x4A, 0xDA, 0x99, 0x9A, 0xDA,
+    0x4F, 0xFD, 0xA3, 0xAF, 0xFD, 0xA3, 0xE9, 0x99, 0x97, 0x0E, 0x74, 0xFA, 0xAA, 0xAA, 0xCA, 0x4F,
+    0xFD, 0x95, 0xFF, 0xC7, 0xAF, 0xA9, 0x50, 0x77, 0x73, 0xAD, 0x29, 0xDA, 0x70, 0xFF, 0xC7, 0x19,
+    0xFE, 0x97, 0x29, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xAA, 0xAF, 0xE6, 0xAF, 0xFD, 0xA6, 0xFF,
+    0xE7, 0xE9, 0x75, 0x9E, 0x76, 0xAE, 0x76, 0xEA, 0x75, 0x9F, 0xFC, 0x70, 0xAF, 0xFA, 0x70, 0xFF,
+    0xC9, 0x70, 0xEA, 0x97, 0x4A, 0xE7, 0x6F, 0x76, 0xFA, 0xAA, 0xAA, 0xAA, 0x69, 0xFF, 0xE6, 0xAF,
+    0xFE, 0x6F, 0xFF, 0x59, 0xFF, 0xF5, 0x77, 0x7D, 0xA2, 0xAD, 0x96, 0xFF, 0xC7, 0xAF, 0xE7, 0x1A,
+    0xF9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0xAE, 0xA7, 0x1A, 0xFE, 0x7A, 0xDA, 0x90, 0x9D, 0x95,
+    0xAD, 0xA9, 0x99, 0xAD, 0xA5, 0xFF, 0xDA, 0x4A, 0xFF, 0xDA, 0x4E, 0x99, 0x99, 0x71, 0xE7, 0x5F,
+    0xAA, 0xAA, 0xAC, 0xA5, 0xFF, 0xD9, 0x6F, 0xFC, 0x70, 0xAF, 0xA9, 0x60, 0x74, 0xE7, 0x5A, 0xE7,
+    0x5F, 0x74, 0x9E, 0xA7, 0x49, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x75, 0xAA, 0xAA, 0xFE, 0x5A, 0xFF,
+    0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xFF, 0xC7, 0xAF, 0xFA,
+    0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A, 0xE7, 0x5F, 0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xE5,
+    0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF, 0xF4, 0x71, 0x9E, 0x71, 0xEA, 0x70, 0x9E, 0xA7, 0x0A, 0xE9,
+    0x70, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAE, 0xA6, 0xAF, 0xE4, 0xAD, 0xA9, 0x09, 0xD9,
+    0x2A, 0xDA, 0x99, 0x9A, 0xDA, 0x2F, 0xFD, 0xA1, 0xAF, 0xFD, 0xA1, 0xE9, 0x99, 0x96, 0xE7, 0x2F,
+    0xAA, 0xAA, 0xAC, 0xA2, 0xFF, 0xD9, 0x3F, 0xFC, 0x5A, 0xFA, 0x93, 0x5A, 0xAA, 0xAF, 0xE5, 0xAF,
+    0xFD, 0xA5, 0xFF, 0xE6, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9F, 0xFC, 0x7A, 0xFF,
+    0xA7, 0xFF, 0xC9, 0x7E, 0xA9, 0x73, 0xAE, 0x75, 0xF7, 0x5F, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFE,
+    0x5A, 0xFF, 0xE5, 0xFF, 0xF4, 0x9F, 0xFF, 0x79, 0xDA, 0x75, 0xDA, 0x75, 0x9F, 0x75, 0xF7, 0x79,
+    0x97, 0x20, 0x5A, 0xEA, 0x6A, 0xFE, 0x4A, 0xDA, 0x90, 0x9D, 0x92, 0xAD, 0xA9, 0x99, 0xAD, 0xA2,
+    0xFF, 0xDA, 0x1A, 0xFF, 0xDA, 0x1E, 0x99, 0x99, 0x6E, 0x72, 0xFA, 0xAA, 0xAA, 0xCA, 0x2F, 0xFD,
+    0x93, 0xFF, 0xC5, 0xAF, 0xA9, 0x77, 0x59, 0xCA, 0x71, 0xAD, 0x97, 0x0A, 0xD9, 0x71, 0xDA, 0x97,
+    0x1F, 0x97, 0x1A, 0xD7, 0x75, 0x77, 0x74, 0xE2, 0x9D, 0xA7, 0x19, 0xE9, 0xE9, 0x73, 0xAF, 0xC7,
+    0x6E, 0xA7, 0x79, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xAA, 0xAF, 0xE7, 0xAF, 0xFD, 0xA7,
+    0xFF, 0xE7, 0x0E, 0x97, 0x69, 0xE7, 0x7A, 0xE7, 0x7E, 0xA7, 0x69, 0xFF, 0xC7, 0x1A, 0xFF, 0xA7,
+    0x1F, 0xFC, 0x97, 0x1E, 0xA9, 0x75, 0xAE, 0x77, 0xF7, 0x7F, 0xAA, 0xAA, 0xAA, 0xA7, 0x9F, 0xFE,
+    0x7A, 0xFF, 0xE7, 0xFF, 0xF6, 0x9F, 0xFF, 0x60, 0x77, 0x79, 0xDA, 0x2A, 0xD9, 0x7A, 0xDA, 0x9E,
+    0x72, 0xFC, 0xA7, 0x4E, 0xA7, 0x5A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xEA,
+    0x72, 0xAF, 0xE7, 0x0A, 0xDA, 0x90, 0x9D, 0x96, 0xAD, 0xA9, 0x99, 0xAD, 0xA6, 0xFF, 0xDA, 0x5A,
+    0xFF, 0xDA, 0x5E, 0x99, 0x99, 0x72, 0xE7, 0x6F, 0xAA, 0xAA, 0xAC, 0xA6, 0xFF, 0xD9, 0x7F, 0xFC,
+    0x71, 0xAF, 0xA9, 0x70, 0x77, 0x77, 0x1D, 0xA7, 0x70, 0x9E, 0xA7, 0x7F, 0xCA, 0x75, 0xE9, 0x9E,
+    0x73, 0xAD, 0x92, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0x99, 0x99, 0x74, 0xAF, 0xFC,
+    0xA7, 0xAF, 0xFE, 0x96, 0xFF, 0xFC, 0x95, 0xFD, 0x94, 0x99, 0x59, 0xFA, 0x76, 0xFA, 0x77, 0xF7,
+    0x7A, 0xE9, 0x77, 0xF4, 0xAA, 0xA9, 0x96, 0xF4, 0xFE, 0xA2, 0x9F, 0x4F, 0xE9, 0x2A, 0xF4, 0x99,
+    0xAF, 0x92, 0xAF, 0x6A, 0xDA, 0x49, 0xFC, 0xA9, 0x99, 0x9F, 0xA5, 0xFF, 0xFD, 0x95, 0xAF, 0xFF,
+    0xC7, 0xFF, 0xFA, 0x70, 0x9A, 0xFC, 0xAA, 0x96, 0x71, 0x9D, 0x77, 0xAE, 0x75, 0x9F, 0xC7, 0x4E,
+    0x9E, 0x97, 0x1E, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAD, 0xA0, 0xE7, 0x0F, 0xFD,
+    0x7E, 0xAA, 0xFC, 0xA6, 0xAD, 0x29, 0xF9, 0x6D, 0x93, 0xF6, 0xAC, 0xA4, 0xEA, 0x6D, 0x93, 0x9E,
+    0x96, 0xD4, 0xF7, 0xDA, 0x19, 0xAF, 0x7F, 0xFD, 0x97, 0xFF, 0xD7, 0x09, 0xFF, 0xC7, 0x19, 0xAF,
+    0xD9, 0x76, 0xE7, 0x0A, 0x92, 0x9E, 0x97, 0x9F, 0xFC, 0x70, 0xFF, 0xC7, 0x09, 0xFE, 0xA7, 0x59,
+    0x99, 0x73, 0x77, 0x77, 0x1D, 0x92, 0xAD, 0x74, 0xFF, 0xA7, 0x4F, 0xF7, 0x6A, 0xF9, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x59, 0x99, 0x99, 0x75, 0xAF, 0xFC, 0xA7, 0x0A, 0xFF, 0xE9, 0x7F, 0xFF,
+    0xC9, 0x6F, 0xD9, 0x49, 0x96, 0x9F, 0xA7, 0x7F, 0xA7, 0x70, 0xF7, 0x70, 0xAE, 0x97, 0x70, 0xF4,
+    0xAA, 0xA9, 0x97, 0xF4, 0xFE, 0xA3, 0x9F, 0x4F, 0xE9, 0x3A, 0xF4, 0x99, 0xAF, 0x93, 0xAF, 0x6A,
+    0xDA, 0x59, 0xFC, 0xA9, 0x99, 0x9F, 0xA6, 0xFF, 0xFD, 0x96, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xA7,
+    0x19, 0xAF, 0xCA, 0xA9, 0x70, 0x77, 0x73, 0xAD, 0x29, 0xDA, 0x70, 0xAF, 0xF7, 0x19, 0xFE, 0x97,
+    0x29, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x29, 0xAD, 0xA0, 0xE7, 0x0F, 0xFD, 0x7E, 0xAA, 0xFC, 0xA6,
+    0xAD, 0x29, 0xF9, 0x6D, 0x93, 0xF6, 0xAC, 0xA4, 0xEA, 0x6D, 0x93, 0x9E, 0x96, 0xD4, 0xF7, 0xDA,
+    0x19, 0xAF, 0x7F, 0xFD, 0x97, 0xFF, 0xD7, 0x09, 0xFF, 0xC7, 0x19, 0xAF, 0xD9, 0x76, 0xE7, 0x0A,
+    0x92, 0x9E, 0x97, 0x9F, 0xFC, 0x70, 0xFF, 0xC7, 0x09, 0xFE, 0xA7, 0x59, 0x99, 0x73, 0x76, 0x9A,
+    0xA9, 0x76, 0xEA, 0x75, 0x9E, 0x97, 0x5A, 0xE9, 0x75, 0xF7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99,
+    0x99, 0x97, 0x2A, 0xFF, 0xCA, 0x5A, 0xFF, 0xE9, 0x4F, 0xFF, 0xC9, 0x3F, 0xD9, 0x49, 0x93, 0x9F,
+    0xA7, 0x4F, 0xA7, 0x5F, 0x75, 0xAE, 0x97, 0x5F, 0x4A, 0xAA, 0x99, 0x4F, 0x4F, 0xEA, 0x09, 0xF4,
+    0xFE, 0x90, 0xAF, 0x49, 0x9A, 0xF9, 0x0A, 0xF6, 0xAD, 0xA2, 0x9F, 0xCA, 0x99, 0x99, 0xFA, 0x3F,
+    0xFF, 0xD9, 0x3A, 0xFF, 0xFC, 0x5F, 0xFF, 0xA6, 0x9A, 0xFC, 0xAA, 0x94, 0x74, 0xE7, 0x49, 0xE7,
+    0x4F, 0x73, 0x9F, 0x73, 0x9A, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x29, 0xAD, 0xA0, 0xE6, 0xFF, 0xD5,
+    0xEA, 0xAF, 0xCA, 0x4A, 0xD2, 0x9F, 0x94, 0xD9, 0x3F, 0x4A, 0xCA, 0x4E, 0xA4, 0xD9, 0x39, 0xE9,
+    0x4D, 0x4F, 0x5D, 0xA1, 0x9A, 0xF5, 0xFF, 0xD9, 0x5F, 0xFD, 0x69, 0xFF, 0xC7, 0x9A, 0xFD, 0x97,
+    0x4E, 0x6A, 0x92, 0x9E, 0x95, 0x9F, 0xFC, 0x6F, 0xFC, 0x69, 0xFE, 0xA7, 0x39, 0x99, 0x71, 0x75,
+    0xFC, 0x76, 0xFA, 0x75, 0x9F, 0x76, 0xAE, 0x97, 0x59, 0xF7, 0x6F, 0x97, 0x5A, 0xF7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x72, 0x99, 0x99, 0x97, 0x3A, 0xFF, 0xCA, 0x6A, 0xFF, 0xE9, 0x5F, 0xFF,
+    0xC9, 0x4F, 0xD9, 0x49, 0x94, 0x9F, 0xA7, 0x5F, 0xA7, 0x6F, 0x76, 0xAE, 0x97, 0x6F, 0x4A, 0xAA,
+    0x99, 0x5F, 0x4F, 0xEA, 0x19, 0xF4, 0xFE, 0x91, 0xAF, 0x49, 0x9A, 0xF9, 0x1A, 0xF6, 0xAD, 0xA3,
+    0x9F, 0xCA, 0x99, 0x99, 0xFA, 0x4F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFC, 0x6F, 0xFF, 0xA7, 0x9A, 0xFC,
+    0xAA, 0x95, 0x72, 0x9A, 0xAA, 0xA9, 0x72, 0xAF, 0x73, 0xF9, 0x73, 0xF7, 0x3F, 0x97, 0x29, 0xF7,
+    0x3F, 0x74, 0x99, 0x99, 0x77, 0x73, 0x9A, 0xDA, 0x0E, 0x6F, 0xFD, 0x5E, 0xAA, 0xFC, 0xA4, 0xAD,
+    0x29, 0xF9, 0x4D, 0x93, 0xF4, 0xAC, 0xA4, 0xEA, 0x4D, 0x93, 0x9E, 0x94, 0xD4, 0xF5, 0xDA, 0x19,
+    0xAF, 0x5F, 0xFD, 0x95, 0xFF, 0xD6, 0x9F, 0xFC, 0x79, 0xAF, 0xD9, 0x74, 0xE6, 0xA9, 0x29, 0xE9,
+    0x59, 0xFF, 0xC6, 0xFF, 0xC6, 0x9F, 0xEA, 0x73, 0x99, 0x97, 0x10, 0x73, 0xD7, 0x70, 0xAE, 0x76,
+    0x9F, 0xC9, 0x74, 0xE9, 0xAD, 0xA7, 0x2E, 0x91, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x9E, 0x6E,
+    0xA4, 0xAE, 0x59, 0xE9, 0x4F, 0x5A, 0xE5, 0xEA, 0x5F, 0x4A, 0xE9, 0x5E, 0xA4, 0xF5, 0x9E, 0x94,
+    0xF5, 0xAE, 0x93, 0x9E, 0xA5, 0xF4, 0xAE, 0x94, 0x9F, 0x4F, 0x94, 0xAE, 0xA3, 0x9F, 0xFF, 0xD9,
+    0x3A, 0xFF, 0xFD, 0x4F, 0xFF, 0xE4, 0xFF, 0xFD, 0xA3, 0x9F, 0xAA, 0xAA, 0xAA, 0xF9, 0x3A, 0xF4,
+    0x9F, 0x93, 0xFA, 0x4A, 0xF3, 0x9F, 0x94, 0xFC, 0x30, 0x77, 0x5D, 0x97, 0x2A, 0xE9, 0x70, 0x9F,
+    0xCA, 0x7E, 0x9A, 0xDA, 0x5E, 0x3A, 0xD7, 0x77, 0x74, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x2A, 0xD9,
+    0x72, 0xE7, 0x29, 0xE7, 0x2A, 0xDA, 0xAE, 0xA5, 0xFF, 0xCA, 0x39, 0xFC, 0xAA, 0xE3, 0xAE, 0x92,
+    0xAD, 0x3E, 0xA3, 0xAD, 0x29, 0xE4, 0xE2, 0xAE, 0x39, 0xDA, 0x2E, 0xA3, 0xAD, 0x91, 0x9E, 0x93,
+    0xE2, 0xAE, 0x3A, 0xE2, 0xF3, 0xF1, 0x9F, 0x29, 0xAD, 0xA1, 0x49, 0xE6, 0xEA, 0x5A, 0xE5, 0x9E,
+    0x95, 0xF5, 0xAE, 0x6E, 0xA5, 0xF5, 0x9E, 0x95, 0xF4, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xA2, 0x9F,
+    0xFF, 0xF9, 0x3A, 0xE9, 0x49, 0xF5, 0xF9, 0x4A, 0xEA, 0x5F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFD, 0x5F,
+    0xFF, 0xE5, 0xFF, 0xFD, 0xA4, 0x9F, 0xAA, 0xAA, 0xAA, 0xF9, 0x4A, 0xF4, 0x9F, 0x94, 0xFA, 0x4A,
+    0xF4, 0x9F, 0x94, 0xFC, 0x40, 0x5A, 0xD9, 0x72, 0xE7, 0x29, 0xFD, 0x94, 0xAF, 0xF5, 0xFC, 0xA9,
+    0x99, 0x7E, 0x72, 0x9D, 0xAA, 0xEA, 0x5F, 0xFC, 0xA4, 0xFC, 0xAA, 0xE3, 0xAE, 0x92, 0xAD, 0x3E,
+    0xA3, 0xAD, 0x3E, 0x4E, 0x2A, 0xE3, 0x9D, 0xA2, 0xEA, 0x3A, 0xD9, 0x19, 0xE9, 0x3E, 0x2A, 0xE3,
+    0xAE, 0x2F, 0x3F, 0x19, 0xF2, 0x9A, 0xDA, 0x10, 0x59, 0xD9, 0x0A, 0xA6, 0xF0, 0xD5, 0xAC, 0xAA,
+    0xEA, 0x5D, 0x90, 0xE7, 0x77, 0x77, 0x77, 0x77, 0x4A, 0xDA, 0x71, 0xF7, 0x1E, 0xA7, 0x1E, 0x97,
+    0x09, 0xE7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xE7, 0x19, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE9,
+    0x70, 0xAE, 0x71, 0xF7, 0x09, 0xEA, 0x70, 0xAE, 0xA7, 0x0F, 0x97, 0x0A, 0xE7, 0x00, 0x70, 0x9A,
+    0x49, 0xD9, 0x0A, 0xC4, 0xF9, 0xD3, 0xAC, 0xA9, 0xEA, 0x3A, 0xC9, 0x0A, 0xCA, 0x77, 0x77, 0x71,
+    0xAC, 0xA7, 0x0E, 0x70, 0xDA, 0x79, 0xD9, 0x7A, 0xD7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7E, 0x79,
+    0xE7, 0xAE, 0x7A, 0xDA, 0x60, 0x77, 0x3A, 0xAA, 0xFD, 0x4A, 0xFF, 0xC9, 0x29, 0xFE, 0xAA, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x70, 0xAD, 0xA7, 0x2F, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xAD,
+    0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xEA, 0x72, 0xE9, 0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F,
+    0x71, 0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE, 0x71, 0x39, 0x99, 0x9A, 0xAA, 0xA2, 0x9F,
+    0xFC, 0x91, 0xFF, 0xD9, 0x19, 0x97, 0x77, 0x77, 0x73, 0xAC, 0xA7, 0x1E, 0x71, 0xDA, 0x70, 0x9D,
+    0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xE7, 0x0A,
+    0xDA, 0x70, 0x6A, 0xDA, 0x7F, 0x7E, 0xA7, 0xE9, 0x69, 0xE7, 0xAD, 0xA7, 0xE9, 0x7E, 0x79, 0xE7,
+    0xEA, 0x7E, 0x96, 0x9E, 0x96, 0xAE, 0x7F, 0x69, 0xEA, 0x6A, 0xEA, 0x6F, 0x95, 0x9F, 0x6E, 0x7D,
+    0xA7, 0x0F, 0xA6, 0xAE, 0x97, 0x09, 0x96, 0x70, 0xE9, 0x79, 0xE7, 0x0F, 0x70, 0xF7, 0x9A, 0xAA,
+    0x97, 0x77, 0x70, 0xAC, 0xA7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D,
+    0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xE7, 0x0E, 0xA7, 0xAD, 0xA7, 0xAD, 0x97, 0x0F,
+    0xC7, 0xAF, 0x70, 0xAE, 0x77, 0x30, 0x70, 0x9A, 0xA7, 0x1E, 0x70, 0xAE, 0x70, 0xF7, 0xAF, 0x77,
+    0x77, 0x77, 0x71, 0xAD, 0xA7, 0x0F, 0x70, 0xEA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xDA, 0x70, 0xE9,
+    0x70, 0xE7, 0x09, 0xE7, 0x0E, 0xA7, 0x0E, 0x97, 0x9E, 0x97, 0xAE, 0x70, 0xF7, 0x9E, 0xA7, 0xAE,
+    0xA7, 0xF9, 0x7A, 0xE7, 0x3A, 0xCA, 0x4E, 0x4D, 0xA3, 0x9D, 0x93, 0xAD, 0x4E, 0x39, 0xDA, 0x3A,
+    0xD9, 0x3E, 0x39, 0xE3, 0xAE, 0x3A, 0xDA, 0x20, 0x4D, 0xA9, 0x6A, 0xE5, 0xE9, 0x6F, 0x49, 0xE6,
+    0x9E, 0xA4, 0xAE, 0x6A, 0xE5, 0xEA, 0x6F, 0x5E, 0x95, 0x9E, 0xA4, 0x9E, 0x6A, 0xE5, 0xAE, 0x6F,
+    0x5E, 0xA6, 0xEA, 0x5E, 0x95, 0xAE, 0x59, 0xE6, 0xF5, 0xF6, 0xEA, 0x5E, 0xA5, 0x9E, 0x94, 0x9E,
+    0x95, 0xF5, 0xAE, 0x95, 0xEA, 0x5F, 0x59, 0xE9, 0x49, 0xF5, 0xF5, 0x9A, 0xDA, 0x5E, 0xA7, 0x7A,
+    0xE9, 0x71, 0x99, 0x2A, 0xF7, 0x2F, 0xFC, 0xA7, 0x19, 0xFF, 0xC7, 0x2F, 0xFC, 0x97, 0x2F, 0xFA,
+    0x73, 0xAA, 0xFA, 0x77, 0x77, 0x69, 0xAA, 0x79, 0x97, 0xE9, 0x5A, 0xD6, 0xAE, 0x6E, 0x6F, 0x5A,
+    0xE5, 0x9F, 0x77, 0x77, 0x77, 0x70, 0xAC, 0xA7, 0xAD, 0x6E, 0x7E, 0x6D, 0xA7, 0xDA, 0x59, 0xD9,
+    0x6A, 0xD6, 0xAD, 0x7E, 0x6E, 0x7D, 0xA5, 0x9D, 0xA6, 0xAD, 0x6A, 0xD9, 0x6E, 0x6E, 0x7D, 0x95,
+    0x9E, 0x6A, 0xD6, 0xAE, 0x6E, 0x6A, 0xDA, 0x5A, 0xD9, 0x77, 0x9E, 0x76, 0x9F, 0xC7, 0x6F, 0xC9,
+    0x76, 0xFA, 0x77, 0x09, 0x97, 0x10, 0x74, 0xAC, 0xA7, 0x72, 0xE9, 0x77, 0x0F, 0xCA, 0x76, 0xAD,
+    0xAA, 0xE7, 0x49, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77,
+    0x09, 0xEA, 0x77, 0x0A, 0xE7, 0x71, 0xF7, 0x70, 0x9E, 0x97, 0x70, 0xAE, 0x77, 0x1E, 0xA7, 0x70,
+    0x9E, 0x97, 0x70, 0xF7, 0x71, 0xEA, 0x77, 0x0A, 0xE9, 0x77, 0x0F, 0x77, 0x1E, 0xA7, 0x70, 0xAE,
+    0x77, 0x1F, 0x77, 0x09, 0xE9, 0x72, 0x9A, 0x2A, 0xF7, 0x3F, 0xFC, 0xA7, 0x29, 0xFF, 0xC7, 0x3F,
+    0xFC, 0x74, 0xFE, 0xA7, 0x77, 0x72, 0x77, 0x72, 0x9D, 0x76, 0xF7, 0x4A, 0xFC, 0x97, 0x19, 0xE9,
+    0xAD, 0xA7, 0x0D, 0xA3, 0xE7, 0x77, 0x77, 0x77, 0x79, 0x77, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7,
+    0x6D, 0xA7, 0x5A, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x59, 0xD9, 0x75, 0xE7, 0x6D, 0xA7, 0x5A, 0xD9,
+    0x75, 0xE7, 0x5E, 0xA7, 0x3F, 0xC7, 0x39, 0xFC, 0x73, 0xFC, 0x75, 0x99, 0x75, 0x77, 0x76, 0xAF,
+    0x75, 0xFA, 0x75, 0xF7, 0x5A, 0xEA, 0x74, 0x9F, 0x75, 0xF9, 0x74, 0x9F, 0x77, 0x77, 0x77, 0x77,
+    0x4E, 0xA1, 0xAE, 0xA6, 0x9E, 0x19, 0xF7, 0xAD, 0xA1, 0xF7, 0x0E, 0x90, 0xF7, 0x09, 0xE0, 0xF9,
+    0x70, 0xEA, 0xAE, 0x97, 0x1E, 0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x2F, 0xE7, 0x29, 0xFD, 0x73, 0xAF,
+    0xCA, 0x73, 0xFE, 0x97, 0x19, 0xFF, 0x71, 0xFF, 0xD7, 0x0E, 0xA9, 0xFC, 0xA6, 0xAE, 0x90, 0xFD,
+    0xA5, 0xF2, 0xFD, 0x93, 0x9F, 0x2A, 0xFD, 0x92, 0x7A, 0xD9, 0x72, 0xE7, 0x29, 0xDA, 0x72, 0xAD,
+    0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x2A, 0xD7, 0x3E, 0x0A, 0xE5, 0x9D, 0xAA, 0xE6, 0xAF, 0xCA, 0x7F,
+    0xCA, 0x79, 0xFC, 0x70, 0xAF, 0xC9, 0x7F, 0xE6, 0x9F, 0xF5, 0xAE, 0x9F, 0xC4, 0xEA, 0x0F, 0xCA,
+    0x29, 0xE9, 0x09, 0xFC, 0x97, 0x77, 0x77, 0x70, 0xAA, 0xAA, 0xA7, 0x1F, 0xA7, 0x09, 0xF7, 0x1A,
+    0xE9, 0x70, 0x9F, 0x71, 0xF9, 0x70, 0xAF, 0x71, 0xAA, 0xAA, 0x71, 0x77, 0xAC, 0xA0, 0xAD, 0x4D,
+    0x99, 0xD4, 0x9D, 0x9D, 0x94, 0xAC, 0xAD, 0x95, 0xFA, 0x59, 0xEA, 0x6F, 0x7F, 0xC5, 0xAF, 0xD4,
+    0xDA, 0x9E, 0xA2, 0x9D, 0x90, 0xAE, 0xA1, 0x70, 0xD9, 0x71, 0xAD, 0x71, 0x9D, 0x72, 0xDA, 0x72,
+    0x99, 0x77, 0x70, 0xEA, 0x71, 0xE7, 0x1A, 0xE7, 0x1E, 0xA7, 0x1E, 0x97, 0x09, 0xE7, 0x1F, 0x71,
+    0xEA, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xEA, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0x9F, 0xFE,
+    0x90, 0xAF, 0xFE, 0x1F, 0xFF, 0x09, 0xFF, 0xEA, 0x00, 0x72, 0x97, 0x2D, 0x71, 0xDA, 0x70, 0xAD,
+    0x70, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x3D, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9D,
+    0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9E, 0x70, 0xAD, 0x97,
+    0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC, 0xA5, 0x5E, 0xA7, 0x1E, 0x71,
+    0xAE, 0x71, 0xEA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xF7, 0x1E, 0xA7, 0x09, 0xE7, 0x1A, 0xE7, 0x1E,
+    0xA7, 0x09, 0xE9, 0x70, 0xAE, 0x71, 0xF7, 0x09, 0xFF, 0xE9, 0x0A, 0xFF, 0xE1, 0xFF, 0xF0, 0x9F,
+    0xFE, 0xA7, 0x77, 0x77, 0x59, 0xAA, 0xAA, 0x70, 0xFC, 0x70, 0xF9, 0x79, 0xF7, 0x0F, 0x97, 0xAF,
+    0x70, 0xF7, 0x09, 0x99, 0x99, 0x70, 0x70, 0xDA, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09,
+    0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A, 0xD9,
+    0x70, 0xE7, 0x1E, 0x70, 0x9D, 0xA7, 0x0F, 0xCA, 0x6F, 0xCA, 0x6F, 0xCA, 0x77, 0x77, 0x77, 0x71,
+    0x9F, 0xA6, 0xAF, 0x7F, 0x96, 0x9F, 0x7F, 0x96, 0xAE, 0xA7, 0xF7, 0x5E, 0xA7, 0x3E, 0x73, 0xAE,
+    0x73, 0xEA, 0x29, 0xAA, 0x5E, 0x92, 0xE4, 0x9E, 0x29, 0xDA, 0x4F, 0x2E, 0x5E, 0xA2, 0xE4, 0x9E,
+    0x2A, 0xDA, 0x4A, 0xE7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x29, 0xFF, 0xE9, 0x2A,
+    0xFF, 0xE3, 0xFF, 0xF2, 0x9F, 0xFE, 0xA2, 0x73, 0xAD, 0x74, 0xE7, 0x39, 0xD9, 0x6D, 0xA1, 0xE6,
+    0x9D, 0xA0, 0x9E, 0x6A, 0xD9, 0x09, 0xAA, 0x96, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xE7, 0x39, 0xE7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x73, 0x9D, 0xA7,
+    0x3F, 0xCA, 0x71, 0xFC, 0xA7, 0x1F, 0xCA, 0x70, 0x5E, 0xA7, 0x3E, 0x73, 0xAE, 0x29, 0xAA, 0x94,
+    0xEA, 0x2E, 0x94, 0xE9, 0x19, 0xE9, 0x39, 0xE2, 0xF4, 0xF1, 0x9F, 0x4E, 0xA7, 0x29, 0xE7, 0x3A,
+    0xE7, 0x3E, 0xA7, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x29, 0xFF, 0xE9, 0x2A, 0xFF, 0xE3, 0xFF,
+    0xF2, 0x9F, 0xFE, 0xA2, 0x5D, 0xA7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0x9D, 0xA0, 0xAD,
+    0xA3, 0xAD, 0x90, 0xEA, 0x3E, 0x0A, 0xE9, 0x29, 0xDA, 0x0F, 0x3A, 0xD9, 0x0A, 0xAA, 0xA3, 0xE7,
+    0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xFC, 0xA6, 0xFC, 0xA6, 0xFC,
+    0xA5, 0x77, 0x77, 0x77, 0x72, 0xAE, 0x77, 0x72, 0xAE, 0x77, 0x72, 0xAE, 0x77, 0x72, 0xAE, 0x77,
+    0x72, 0x9E, 0x77, 0x5E, 0xA0, 0x9E, 0x77, 0x6E, 0x09, 0xE7, 0x76, 0xAE, 0x9E, 0x97, 0x76, 0xFE,
+    0x97, 0x77, 0xFD, 0x97, 0x77, 0x9F, 0xC9, 0x77, 0x70, 0xFC, 0xA7, 0x77, 0x1F, 0xA7, 0x77, 0x19,
+    0xEA, 0x77, 0x72, 0xF7, 0x77, 0x19, 0xFA, 0x77, 0x71, 0xFC, 0x97, 0x77, 0x0F, 0xD7, 0x77, 0x0F,
+    0xE7, 0x77, 0xFF, 0xFE, 0x97, 0x6F, 0xFF, 0xF7, 0x6F, 0x0F, 0xFF, 0x75, 0xF9, 0x9F, 0xFE, 0xA7,
+    0x4F, 0x97, 0x77, 0x1F, 0x97, 0x77, 0x1F, 0x97, 0x77, 0x1F, 0x97, 0x77, 0x1C, 0xA9, 0x77, 0x77,
+    0x77, 0x73, 0x75, 0xDA, 0x77, 0x19, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77,
+    0x1A, 0xD9, 0x77, 0x1E, 0x77, 0x19, 0xDA, 0x77, 0x1A, 0xD9, 0x77, 0x1E, 0x77, 0x19, 0xEA, 0xAF,
+    0xA5, 0x99, 0xAA, 0xFE, 0xA9, 0x93, 0x9F, 0xEA, 0xE7, 0x49, 0x93, 0xE7, 0x71, 0x9D, 0xA7, 0x71,
+    0xFC, 0xA7, 0x7F, 0xCA, 0x77, 0xFC, 0xA6, 0x76, 0xD9, 0x77, 0x0A, 0xCA, 0x77, 0x09, 0xD7, 0x71,
+    0xDA, 0x77, 0x09, 0x99, 0x77, 0x77, 0x77, 0x77, 0x9E, 0x6F, 0x94, 0xAD, 0xA6, 0xFA, 0x4E, 0x95,
+    0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD, 0x3E, 0x95, 0x9F, 0xD9, 0x19, 0xE6, 0xFE, 0xA1,
+    0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE, 0x09, 0xE6, 0xF9, 0x9E, 0x0A, 0xE6, 0xF1, 0xE9,
+    0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59, 0xF9, 0x1F, 0xDA, 0x5A, 0xF9, 0x1A, 0xFC, 0x6F,
+    0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA5, 0x73, 0xAC, 0xA7, 0x29, 0xD7, 0x29, 0xD9, 0x72, 0xE7,
+    0x39, 0x97, 0x77, 0x77, 0x73, 0x9D, 0x9A, 0xE9, 0x5F, 0xFC, 0x94, 0xFC, 0xAE, 0xA3, 0xAE, 0x92,
+    0xE3, 0xE9, 0x3D, 0xA3, 0xE3, 0x9D, 0xA2, 0xAD, 0xA3, 0xAD, 0x92, 0xE9, 0x3E, 0x3E, 0x92, 0x9E,
+    0x2A, 0xE3, 0xF2, 0xF3, 0xEA, 0x19, 0xEA, 0x2A, 0xE9, 0x10, 0x77, 0x9E, 0x6F, 0x94, 0xAD, 0xA6,
+    0xFA, 0x4E, 0x95, 0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD, 0x3E, 0x95, 0x9F, 0xD9, 0x19,
+    0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE, 0x09, 0xE6, 0xF9, 0x9E, 0x0A,
+    0xE6, 0xF1, 0xE9, 0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59, 0xF9, 0x1F, 0xDA, 0x5A, 0xF9,
+    0x1A, 0xFC, 0x6F, 0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA7, 0x77, 0x7F, 0xC7, 0x7F, 0xA7, 0x7F,
+    0x77, 0xAE, 0xA7, 0x69, 0xF7, 0x7F, 0x97, 0x6A, 0xF7, 0x77, 0x72, 0x77, 0x29, 0xD9, 0xAE, 0x95,
+    0xFF, 0xC9, 0x4F, 0xCA, 0xEA, 0x3A, 0xE9, 0x2E, 0x3E, 0x93, 0xDA, 0x3E, 0x39, 0xDA, 0x2A, 0xDA,
+    0x3A, 0xD9, 0x2E, 0x93, 0xE3, 0xE9, 0x29, 0xE2, 0xAE, 0x3F, 0x2F, 0x3E, 0xA1, 0x9E, 0xA2, 0xAE,
+    0x97, 0x74, 0xFA, 0x70, 0x9F, 0x71, 0xAE, 0xA7, 0x1F, 0x71, 0xAE, 0xA7, 0x09, 0xF7, 0x1F, 0x97,
+    0x00, 0x71, 0x9A, 0xA9, 0x3A, 0xAA, 0x73, 0xAD, 0x90, 0x9D, 0xA7, 0x5F, 0xD9, 0x77, 0xF9, 0x77,
+    0x0A, 0xD7, 0x73, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xE7, 0xF9, 0x4A, 0xDA, 0x7F, 0xA4,
+    0xE9, 0x69, 0xFA, 0x39, 0xE7, 0xFD, 0x3A, 0xDA, 0x7F, 0xD3, 0xE9, 0x69, 0xFD, 0x91, 0x9E, 0x7F,
+    0xEA, 0x1A, 0xDA, 0x7F, 0xAE, 0x1E, 0x96, 0xAE, 0xAA, 0xE0, 0x9E, 0x7F, 0x99, 0xE0, 0xAE, 0x7F,
+    0x1E, 0x9E, 0x96, 0xAF, 0x1F, 0xE7, 0xFA, 0x1F, 0xE6, 0x9F, 0x91, 0xFD, 0xA6, 0xAF, 0x91, 0xAF,
+    0xC7, 0xFC, 0x29, 0xFC, 0x69, 0xFC, 0x29, 0xFA, 0x60, 0x7A, 0xA9, 0x39, 0xAA, 0x70, 0x9D, 0xA0,
+    0x9E, 0x72, 0xAF, 0xCA, 0x74, 0xF9, 0x75, 0x9D, 0x97, 0x79, 0x97, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0x9D, 0x9A, 0xE9, 0x71, 0xFF, 0xC9, 0x70, 0xFC, 0xAE, 0xA7, 0xAE, 0x92, 0xE7, 0xE9, 0x3D, 0xA7,
+    0xE3, 0x9D, 0xA6, 0xAD, 0xA3, 0xAD, 0x96, 0xE9, 0x3E, 0x7E, 0x92, 0x9E, 0x6A, 0xE3, 0xF6, 0xF3,
+    0xEA, 0x59, 0xEA, 0x2A, 0xE9, 0x50, 0x3A, 0xDA, 0x77, 0x69, 0xE7, 0x76, 0x9E, 0x97, 0x76, 0xF7,
+    0x76, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9D, 0x9A, 0xE9, 0x77,
+    0x2F, 0xFC, 0x97, 0x71, 0xFC, 0xAE, 0xA7, 0x70, 0xAE, 0x92, 0xE7, 0x70, 0xE9, 0x3D, 0xA7, 0x70,
+    0xE3, 0x9D, 0xA7, 0x7A, 0xDA, 0x3A, 0xD9, 0x77, 0xE9, 0x3E, 0x77, 0x0E, 0x92, 0x9E, 0x77, 0xAE,
+    0x3F, 0x77, 0xF3, 0xEA, 0x76, 0x9E, 0xA2, 0xAE, 0x91, 0x77, 0x9E, 0x6F, 0x94, 0xAD, 0xA6, 0xFA,
+    0x4E, 0x95, 0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD, 0x3E, 0x95, 0x9F, 0xD9, 0x19, 0xE6,
+    0xFE, 0xA1, 0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE, 0x09, 0xE6, 0xF9, 0x9E, 0x0A, 0xE6,
+    0xF1, 0xE9, 0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59, 0xF9, 0x1F, 0xDA, 0x5A, 0xF9, 0x1A,
+    0xFC, 0x6F, 0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA7, 0x6A, 0xF7, 0x49, 0xFE, 0x74, 0xFE, 0x97,
+    0x39, 0xFC, 0xA9, 0x77, 0x74, 0x77, 0x29, 0xD9, 0xAE, 0x95, 0xFF, 0xC9, 0x4F, 0xCA, 0xEA, 0x3A,
+    0xE9, 0x2E, 0x3E, 0x93, 0xDA, 0x3E, 0x39, 0xDA, 0x2A, 0xDA, 0x3A, 0xD9, 0x2E, 0x93, 0xE3, 0xE9,
+    0x29, 0xE2, 0xAE, 0x3F, 0x2F, 0x3E, 0xA1, 0x9E, 0xA2, 0xAE, 0x97, 0x1F, 0x79, 0xFD, 0x7F, 0xD7,
+    0x0A, 0xDA, 0xA4, 0x74, 0x99, 0x99, 0xAA, 0x72, 0x9F, 0xFC, 0x72, 0xFF, 0xD9, 0x70, 0x99, 0x99,
+    0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFC, 0x97, 0x3A, 0xFF, 0xC7, 0x1F, 0xFF, 0x7F, 0xA3,
+    0xAE, 0xA5, 0xF9, 0x5F, 0x4A, 0xE9, 0x6A, 0xE4, 0xEA, 0x7A, 0xE3, 0x9E, 0x70, 0xAE, 0x3F, 0x70,
+    0xF3, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x69, 0xF3, 0xAF, 0xA9, 0x19, 0x9F,
+    0xCA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA6, 0x9F, 0xFE, 0xA7, 0x1A, 0xFD,
+    0xA9, 0x77, 0x74, 0x79, 0x99, 0x9A, 0xAA, 0x59, 0xFF, 0xC5, 0xFF, 0xD4, 0x99, 0x99, 0x99, 0x77,
+    0x77, 0x77, 0x72, 0x9A, 0xEA, 0x70, 0xAF, 0xE6, 0xFA, 0xAE, 0xA4, 0xAE, 0x3E, 0x4E, 0x4E, 0x3A,
+    0xD9, 0x4E, 0x3E, 0x4A, 0xDA, 0x3E, 0xA1, 0x9F, 0x4F, 0xFD, 0xA4, 0xAF, 0xFC, 0x6F, 0xEA, 0x70,
+    0xAE, 0xA9, 0x60, 0x77, 0x76, 0xAD, 0x29, 0xDA, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xEA, 0x74, 0x9F,
+    0xA9, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A,
+    0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F,
+    0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC,
+    0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA,
+    0x97, 0x77, 0x40, 0x77, 0x5A, 0xD2, 0x9D, 0xA5, 0xFF, 0xC6, 0x9F, 0xE9, 0x79, 0xFA, 0x77, 0x77,
+    0x77, 0x79, 0xAE, 0xA7, 0x0A, 0xFE, 0x6F, 0xAA, 0xEA, 0x4A, 0xE3, 0xE4, 0xE4, 0xE3, 0xAD, 0x94,
+    0xE3, 0xE4, 0xAD, 0xA3, 0xEA, 0x19, 0xF4, 0xFF, 0xDA, 0x4A, 0xFF, 0xC6, 0xFE, 0xA7, 0x0A, 0xEA,
+    0x96, 0x70, 0x9E, 0x5E, 0x70, 0xAE, 0x49, 0xE9, 0x7A, 0xE9, 0x39, 0xEA, 0x79, 0xAA, 0xA9, 0x4A,
+    0xAA, 0x97, 0x77, 0x77, 0x77, 0x19, 0xFC, 0x97, 0x5A, 0xFF, 0xC7, 0x3F, 0xFF, 0x71, 0xFA, 0x3A,
+    0xEA, 0x7F, 0x95, 0xF6, 0xAE, 0x96, 0xAE, 0x6E, 0xA7, 0xAE, 0x59, 0xE7, 0x0A, 0xE5, 0xF7, 0x0F,
+    0x5E, 0x97, 0x0E, 0xA4, 0x9E, 0x97, 0xAE, 0x94, 0xAE, 0x96, 0x9F, 0x5A, 0xFA, 0x91, 0x99, 0xFC,
+    0xA5, 0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xD9, 0x7F, 0xFF, 0xCA, 0x70, 0x9F, 0xFE, 0xA7, 0x3A, 0xFD,
+    0xA9, 0x77, 0x77, 0x00, 0x4A, 0xE4, 0x9E, 0x4A, 0xE4, 0x9E, 0x93, 0xAE, 0x93, 0x9E, 0xA3, 0x9A,
+    0xAA, 0x94, 0xAA, 0xA9, 0x77, 0x77, 0x75, 0x9A, 0xEA, 0x73, 0xAF, 0xE7, 0x1F, 0xAA, 0xEA, 0x7A,
+    0xE3, 0xE7, 0xE4, 0xE6, 0xAD, 0x94, 0xE6, 0xE4, 0xAD, 0xA6, 0xEA, 0x19, 0xF7, 0xFF, 0xDA, 0x7A,
+    0xFF, 0xC7, 0x1F, 0xEA, 0x73, 0xAE, 0xA9, 0x71, 0x77, 0x77, 0x49, 0xFC, 0xAA, 0xAF, 0xFC, 0xA6,
+    0xAF, 0xFF, 0xFE, 0x6F, 0xFF, 0xFF, 0xA5, 0xFA, 0x3A, 0xF7, 0x4F, 0x95, 0xF7, 0x3A, 0xE9, 0x6F,
+    0x73, 0xEA, 0x69, 0xF7, 0x29, 0xE7, 0xAF, 0xF9, 0x5F, 0x7F, 0xFC, 0x6E, 0x96, 0x9F, 0xFC, 0x59,
+    0xE9, 0x6A, 0xF9, 0x71, 0xAE, 0x96, 0xFC, 0x72, 0xAF, 0x93, 0x9A, 0xFA, 0x72, 0xAF, 0xFF, 0xEA,
+    0xAA, 0xAA, 0xA9, 0x4A, 0xFF, 0xFF, 0xFC, 0xA5, 0xFF, 0xFF, 0xFC, 0xA5, 0x9F, 0xFF, 0xFF, 0xA7,
+    0xAF, 0xFF, 0xFD, 0xA7, 0x77, 0x70, 0x49, 0xAE, 0xA2, 0x9A, 0xDA, 0x95, 0xAF, 0xE9, 0xAF, 0xD9,
+    0x3F, 0xAA, 0xFD, 0xA1, 0xAD, 0x2A, 0xE3, 0xF9, 0x99, 0x9A, 0xD9, 0x1E, 0x4F, 0xFE, 0x90, 0xAD,
+    0x93, 0x9F, 0xFE, 0x90, 0xE4, 0xEA, 0x99, 0x96, 0xEA, 0x19, 0xFA, 0x71, 0xFF, 0xFC, 0xAA, 0xAA,
+    0xD2, 0xAF, 0xFF, 0xFD, 0x3F, 0xEA, 0xAF, 0xFC, 0x4A, 0xEA, 0x29, 0xAF, 0xA9, 0x20, 0x74, 0x99,
+    0x75, 0xD9, 0x74, 0xAD, 0x74, 0x9D, 0x75, 0xDA, 0x77, 0x77, 0x73, 0xAF, 0xD9, 0x70, 0xFF, 0xC6,
+    0x9D, 0xA9, 0x99, 0xAD, 0x95, 0xAD, 0x4D, 0xA5, 0xE4, 0xDA, 0x49, 0xDA, 0x3A, 0xD9, 0x4A, 0xD9,
+    0x3E, 0x5E, 0x99, 0x9A, 0xEA, 0x49, 0xFF, 0xD5, 0xAF, 0xFA, 0x6F, 0xFD, 0x59, 0xF9, 0x1E, 0x94,
+    0xAE, 0xA2, 0xEA, 0x4F, 0x92, 0xEA, 0x39, 0xF2, 0xAF, 0x3A, 0xF2, 0xFC, 0x3F, 0xA2, 0xFC, 0x3A,
+    0xAA, 0xA9, 0x19, 0xAA, 0xAA, 0xA2, 0x7A, 0xCA, 0x79, 0xD7, 0x0D, 0xA7, 0xE7, 0x09, 0x97, 0x0E,
+    0xAE, 0x39, 0xFE, 0x3F, 0xF3, 0xF9, 0x59, 0xE7, 0xAD, 0xA7, 0xE7, 0xAE, 0x7F, 0x69, 0xEA, 0x6F,
+    0xA6, 0xAE, 0x95, 0x77, 0x72, 0x9F, 0xA7, 0x29, 0xF7, 0x3A, 0xEA, 0x73, 0xF7, 0x3F, 0x97, 0x29,
+    0xF7, 0x3F, 0x97, 0x77, 0x77, 0x77, 0x4A, 0xFD, 0x97, 0x0F, 0xFC, 0x69, 0xDA, 0x99, 0x9A, 0xD9,
+    0x5A, 0xD4, 0xDA, 0x5E, 0x4D, 0xA4, 0x9D, 0xA3, 0xAD, 0x94, 0xAD, 0x93, 0xE5, 0xE9, 0x99, 0xAE,
+    0xA4, 0x9F, 0xFD, 0x5A, 0xFF, 0xA6, 0xFF, 0xD5, 0x9F, 0x91, 0xE9, 0x4A, 0xEA, 0x2E, 0xA4, 0xF9,
+    0x2E, 0xA3, 0x9F, 0x2A, 0xF3, 0xAF, 0x2F, 0xC3, 0xFA, 0x2F, 0xC3, 0xAA, 0xAA, 0x91, 0x9A, 0xAA,
+    0xAA, 0x20, 0x77, 0x3F, 0xC6, 0x9F, 0x7A, 0xEA, 0x7F, 0x7A, 0xEA, 0x69, 0xF7, 0xF9, 0x77, 0x77,
+    0x2E, 0xAE, 0x49, 0xFE, 0x4F, 0xF4, 0xF9, 0x69, 0xE7, 0x0A, 0xDA, 0x70, 0xE7, 0x0A, 0xE7, 0x0F,
+    0x79, 0xEA, 0x7F, 0xA7, 0xAE, 0x96, 0x7E, 0x3A, 0xD7, 0x09, 0xE0, 0xAD, 0xA7, 0x2A, 0xFC, 0x97,
+    0x4F, 0x97, 0x59, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xFD, 0x97, 0x2F, 0xFC, 0x70, 0x9D, 0xA9,
+    0x99, 0xAD, 0x97, 0xAD, 0x4D, 0xA7, 0xE4, 0xDA, 0x69, 0xDA, 0x3A, 0xD9, 0x6A, 0xD9, 0x3E, 0x7E,
+    0x99, 0x9A, 0xEA, 0x69, 0xFF, 0xD7, 0xAF, 0xFA, 0x70, 0xFF, 0xD7, 0x9F, 0x91, 0xE9, 0x6A, 0xEA,
+    0x2E, 0xA6, 0xF9, 0x2E, 0xA5, 0x9F, 0x2A, 0xF5, 0xAF, 0x2F, 0xC5, 0xFA, 0x2F, 0xC5, 0xAA, 0xAA,
+    0x91, 0x9A, 0xAA, 0xAA, 0x40, 0x3E, 0x3A, 0xD5, 0xE9, 0x9E, 0x69, 0xFC, 0xA7, 0x0A, 0xE9, 0x72,
+    0xD9, 0x77, 0x77, 0x7E, 0xAE, 0x69, 0xFE, 0x6F, 0xF6, 0xF9, 0x70, 0x9E, 0x72, 0xAD, 0xA7, 0x2E,
+    0x72, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0xFA, 0x71, 0xAE, 0x97, 0x00, 0x76, 0x97, 0x7D, 0x97,
+    0x5D, 0xA7, 0x5A, 0xD7, 0x59, 0xDA, 0x77, 0x77, 0x77, 0x9A, 0xFC, 0xA9, 0x7F, 0xFC, 0x96, 0xFF,
+    0xCA, 0x6F, 0xC9, 0x29, 0x69, 0xEA, 0x74, 0xAE, 0x75, 0xAE, 0x75, 0xAF, 0xCA, 0x97, 0x19, 0xFF,
+    0xA7, 0x09, 0xFF, 0xC7, 0x19, 0xAF, 0xE7, 0x39, 0xFC, 0x75, 0xF4, 0xCA, 0x94, 0x9F, 0x3F, 0xCA,
+    0xAA, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xA5, 0x9A, 0xFD, 0xA9, 0x40, 0x72, 0x99, 0x72,
+    0x9D, 0x72, 0xD9, 0x71, 0xE7, 0x1A, 0xD7, 0x76, 0x9F, 0xCA, 0x5F, 0xF4, 0x9D, 0x93, 0x94, 0x9D,
+    0x73, 0xEA, 0x97, 0x09, 0xFC, 0xA7, 0x09, 0xAE, 0xA7, 0x1A, 0xE3, 0xDA, 0x99, 0xAF, 0x2F, 0xFD,
+    0x91, 0xFF, 0xD9, 0x39, 0xAF, 0xA9, 0x77, 0x10, 0x72, 0x9D, 0x77, 0x0A, 0xE7, 0x69, 0xFC, 0x75,
+    0xE9, 0xE9, 0x72, 0xE2, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFC, 0xA9, 0x71, 0xFF, 0xC9,
+    0x70, 0xFF, 0xCA, 0x70, 0xFC, 0x92, 0x97, 0x09, 0xEA, 0x76, 0xAE, 0x77, 0xAE, 0x77, 0xAF, 0xCA,
+    0x97, 0x39, 0xFF, 0xA7, 0x29, 0xFF, 0xC7, 0x39, 0xAF, 0xE7, 0x59, 0xFC, 0x77, 0xF6, 0xCA, 0x94,
+    0x9F, 0x5F, 0xCA, 0xAA, 0xFC, 0xA4, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xA7, 0x9A, 0xFD, 0xA9, 0x60,
+    0x7A, 0xCA, 0x75, 0xEA, 0x73, 0xAF, 0xA7, 0x19, 0xE9, 0xE7, 0x9D, 0xA2, 0xAD, 0x97, 0x77, 0x77,
+    0x09, 0xFC, 0xA7, 0x0F, 0xF7, 0x9D, 0x93, 0x97, 0x9D, 0x76, 0xEA, 0x97, 0x39, 0xFC, 0xA7, 0x39,
+    0xAE, 0xA7, 0x4A, 0xE6, 0xDA, 0x99, 0xAF, 0x5F, 0xFD, 0x94, 0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77,
+    0x70, 0x70, 0x9A, 0xFC, 0xA9, 0x7F, 0xFC, 0x96, 0xFF, 0xCA, 0x6F, 0xC9, 0x29, 0x69, 0xEA, 0x74,
+    0xAE, 0x75, 0xAE, 0x75, 0xAF, 0xCA, 0x97, 0x19, 0xFF, 0xA7, 0x09, 0xFF, 0xC7, 0x19, 0xAF, 0xE7,
+    0x39, 0xFC, 0x75, 0xF4, 0xCA, 0x94, 0x9F, 0x3F, 0xCA, 0xAA, 0xFC, 0xA2, 0xFF, 0xFC, 0xA2, 0xAF,
+    0xFF, 0xA4, 0x9A, 0xFE, 0xA9, 0x70, 0xAC, 0xA7, 0x6F, 0x74, 0x99, 0x9D, 0x74, 0xFA, 0x74, 0xEA,
+    0x72, 0x77, 0x39, 0xFC, 0xA5, 0xFF, 0x49, 0xD9, 0x39, 0x49, 0xD7, 0x3E, 0xA9, 0x70, 0x9F, 0xCA,
+    0x70, 0x9A, 0xEA, 0x71, 0xAE, 0x3A, 0xCA, 0x99, 0xAF, 0x2A, 0xFF, 0xC9, 0x1F, 0xFD, 0x93, 0xAF,
+    0xCA, 0x96, 0xD7, 0x2A, 0xD9, 0x71, 0xCA, 0xD7, 0x0A, 0xF7, 0x0E, 0xA7, 0x76, 0x71, 0xDA, 0x3A,
+    0xCA, 0x72, 0x9D, 0xA0, 0x9D, 0xA7, 0x4A, 0xFC, 0xA7, 0x6F, 0x97, 0x79, 0xD9, 0x77, 0x19, 0x77,
+    0x77, 0x77, 0x71, 0x9A, 0xFC, 0xA9, 0x72, 0xFF, 0xC9, 0x71, 0xFF, 0xCA, 0x71, 0xFC, 0x92, 0x97,
+    0x19, 0xEA, 0x77, 0xAE, 0x77, 0x0A, 0xE7, 0x70, 0xAF, 0xCA, 0x97, 0x49, 0xFF, 0xA7, 0x39, 0xFF,
+    0xC7, 0x49, 0xAF, 0xE7, 0x69, 0xFC, 0x77, 0x0F, 0x7C, 0xA9, 0x49, 0xF6, 0xFC, 0xAA, 0xAF, 0xCA,
+    0x5F, 0xFF, 0xCA, 0x5A, 0xFF, 0xFA, 0x70, 0x9A, 0xFD, 0xA9, 0x70, 0x77, 0x79, 0xDA, 0x2A, 0xD9,
+    0x79, 0xE9, 0xE7, 0x2A, 0xFA, 0x74, 0xEA, 0x75, 0xAC, 0xA7, 0x77, 0x77, 0x79, 0xFC, 0xA7, 0x1F,
+    0xF7, 0x09, 0xD9, 0x39, 0x70, 0x9D, 0x77, 0xEA, 0x97, 0x49, 0xFC, 0xA7, 0x49, 0xAE, 0xA7, 0x5A,
+    0xE7, 0xDA, 0x99, 0xAF, 0x6F, 0xFD, 0x95, 0xFF, 0xD9, 0x79, 0xAF, 0xA9, 0x77, 0x71, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0xA6,
+    0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x39,
+    0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x4D, 0x75, 0xAC, 0xA7,
+    0x5E, 0xA7, 0x39, 0x99, 0xD7, 0x3F, 0x97, 0x3E, 0x97, 0x30, 0x77, 0x39, 0xAC, 0x70, 0x9D, 0xA7,
+    0x0A, 0xD9, 0x70, 0xE6, 0xAF, 0xF2, 0x9F, 0xFC, 0x29, 0xAA, 0xEA, 0xAA, 0xA4, 0x9E, 0x70, 0xAD,
+    0x97, 0x0E, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0F, 0xDA, 0x5F, 0xDA, 0x5F, 0xDA, 0x4A,
+    0xC9, 0x71, 0xEA, 0x79, 0xAA, 0xD7, 0xFA, 0x7E, 0x97, 0x5D, 0xA3, 0xAC, 0xA6, 0x9D, 0xA0, 0x9E,
+    0x70, 0xAF, 0xCA, 0x72, 0xF9, 0x73, 0x9D, 0x97, 0x59, 0x97, 0x77, 0x77, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0xA6, 0xEA, 0x73,
+    0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x39, 0xEA, 0x73,
+    0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x10, 0x74, 0xAA, 0x97, 0x4D, 0xA7,
+    0x3A, 0xD9, 0x73, 0xE5, 0x9A, 0xC2, 0x9D, 0xA4, 0x9D, 0xA2, 0xE9, 0x4A, 0xD9, 0x73, 0xE7, 0x1A,
+    0xFF, 0x59, 0xFF, 0xC5, 0x9A, 0xAE, 0xAA, 0xAA, 0x79, 0xE7, 0x3A, 0xD9, 0x73, 0xE7, 0x4E, 0x73,
+    0x9D, 0xA7, 0x3A, 0xD9, 0x73, 0xFD, 0xA7, 0x0F, 0xDA, 0x70, 0xFD, 0xA7, 0x0A, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0xA6, 0xEA, 0x73,
+    0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x70, 0x99, 0x9A, 0xF9, 0x99, 0x5F, 0xFD, 0xA5, 0xFF, 0xD9, 0x70,
+    0xF7, 0x39, 0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x10, 0x77,
+    0x39, 0xAC, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE6, 0xAF, 0xF2, 0x9F, 0xFC, 0x29, 0xAA, 0xEA,
+    0xAA, 0xA5, 0xE5, 0xFF, 0xD9, 0x09, 0xFF, 0xD1, 0x99, 0x9A, 0xE9, 0x99, 0x94, 0x9D, 0xA7, 0x0A,
+    0xD9, 0x70, 0xFD, 0xA5, 0xFD, 0xA5, 0xFD, 0xA2, 0x73, 0xDA, 0x09, 0xA7, 0x5F, 0x9A, 0xC9, 0x73,
+    0x9D, 0x9F, 0x74, 0xAC, 0xA0, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0xFA, 0x4A,
+    0xF5, 0xF9, 0x4F, 0xA4, 0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0xA5, 0xF5, 0xF9,
+    0x5F, 0x5F, 0x59, 0xEA, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9,
+    0x49, 0xEA, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF, 0xFC, 0x79, 0xFF,
+    0xE7, 0x1A, 0xFF, 0xA7, 0x77, 0x40, 0x6A, 0xD1, 0xAA, 0x69, 0xEA, 0x0D, 0x6D, 0x9D, 0x9C, 0xA6,
+    0xD0, 0xAE, 0x96, 0xD1, 0xDA, 0x77, 0x77, 0x77, 0x09, 0xD9, 0x39, 0xDA, 0x2A, 0xD4, 0xAD, 0x92,
+    0xAD, 0x4E, 0x3E, 0x39, 0xE3, 0xDA, 0x3A, 0xDA, 0x29, 0xD9, 0x3E, 0xA2, 0xAD, 0x92, 0x9E, 0x92,
+    0xAD, 0x3F, 0x3F, 0xA9, 0xFC, 0x3F, 0xFD, 0xA3, 0xAF, 0xFC, 0x94, 0xAF, 0xAE, 0x30, 0x77, 0x76,
+    0x9A, 0xAA, 0xFC, 0x97, 0x19, 0xFF, 0xCA, 0x71, 0xFF, 0xAA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x6F, 0xA4, 0xAF, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A, 0xE9, 0x4A,
+    0xEA, 0x5F, 0x5F, 0x95, 0xF5, 0xF5, 0x9E, 0xA4, 0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F, 0x5F, 0x6E,
+    0xA5, 0xF5, 0x9E, 0x94, 0x9E, 0xA5, 0xAE, 0xA3, 0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC9, 0x6F,
+    0xFF, 0xC7, 0x9F, 0xFE, 0x71, 0xAF, 0xFA, 0x77, 0x74, 0x59, 0x9A, 0xAA, 0xAE, 0x5A, 0xFF, 0xC4,
+    0x9F, 0xFD, 0x77, 0x77, 0x77, 0x77, 0x29, 0xD9, 0x39, 0xDA, 0x3A, 0xD4, 0xAD, 0x93, 0xAD, 0x4E,
+    0x4E, 0x39, 0xE4, 0xDA, 0x3A, 0xDA, 0x39, 0xD9, 0x3E, 0xA3, 0xAD, 0x92, 0x9E, 0x93, 0xAD, 0x3F,
+    0x4F, 0xA9, 0xFC, 0x4F, 0xFD, 0xA4, 0xAF, 0xFC, 0x95, 0xAF, 0xAE, 0x40, 0x77, 0x76, 0x9D, 0x91,
+    0x9E, 0x72, 0x9F, 0xFA, 0x73, 0xFE, 0xA7, 0x5A, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3F,
+    0xA4, 0xAF, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A, 0xE9, 0x4A, 0xEA, 0x5F,
+    0x5F, 0x95, 0xF5, 0xF5, 0x9E, 0xA4, 0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F, 0x5F, 0x6E, 0xA5, 0xF5,
+    0x9E, 0x94, 0x9E, 0xA5, 0xAE, 0xA3, 0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC9, 0x6F, 0xFF, 0xC7,
+    0x9F, 0xFE, 0x71, 0xAF, 0xFA, 0x77, 0x74, 0x77, 0x5A, 0xD2, 0x9D, 0xA5, 0xFF, 0xC6, 0x9F, 0xE9,
+    0x79, 0xFA, 0x77, 0x77, 0x77, 0x49, 0xD9, 0x39, 0xDA, 0x3A, 0xD4, 0xAD, 0x93, 0xAD, 0x4E, 0x4E,
+    0x39, 0xE4, 0xDA, 0x3A, 0xDA, 0x39, 0xD9, 0x3E, 0xA3, 0xAD, 0x92, 0x9E, 0x93, 0xAD, 0x3F, 0x4F,
+    0xA9, 0xFC, 0x4F, 0xFD, 0xA4, 0xAF, 0xFC, 0x95, 0xAF, 0xAE, 0x40, 0x74, 0xAD, 0x77, 0x0A, 0xF7,
+    0x7D, 0x0D, 0x77, 0xFA, 0x77, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xFA, 0x4A,
+    0xF5, 0xF9, 0x4F, 0xA4, 0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0xA5, 0xF5, 0xF9,
+    0x5F, 0x5F, 0x59, 0xEA, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9,
+    0x49, 0xEA, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF, 0xFC, 0x79, 0xFF,
+    0xE7, 0x1A, 0xFF, 0xA7, 0x77, 0x40, 0x70, 0x9A, 0x97, 0x1F, 0x70, 0x9C, 0xAA, 0xC9, 0x79, 0xF7,
+    0x1E, 0x97, 0x77, 0x77, 0x77, 0x39, 0xD9, 0x39, 0xDA, 0x1A, 0xD4, 0xAD, 0x91, 0xAD, 0x4E, 0x2E,
+    0x39, 0xE2, 0xDA, 0x3A, 0xDA, 0x19, 0xD9, 0x3E, 0xA1, 0xAD, 0x92, 0x9E, 0x91, 0xAD, 0x3F, 0x2F,
+    0xA9, 0xFC, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x93, 0xAF, 0xAE, 0x20, 0x71, 0xAA, 0xA5, 0x9A, 0xA9,
+    0x70, 0xAD, 0xA4, 0xAE, 0x70, 0xF4, 0xAE, 0x97, 0xF4, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x72, 0xFA, 0x4A, 0xF7, 0xF9, 0x4F, 0xA6, 0x9F, 0x5F, 0x96, 0xAF, 0x49, 0xF7, 0xAE, 0x94, 0xAE,
+    0xA7, 0xF5, 0xF9, 0x7F, 0x5F, 0x79, 0xEA, 0x49, 0xF7, 0xAE, 0x94, 0xAE, 0x97, 0xF5, 0xF7, 0x0E,
+    0xA5, 0xF7, 0x9E, 0x94, 0x9E, 0xA7, 0xAE, 0xA3, 0x9F, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xC9,
+    0x70, 0xFF, 0xFC, 0x71, 0x9F, 0xFE, 0x73, 0xAF, 0xFA, 0x77, 0x77, 0x00, 0x5A, 0xAA, 0x5A, 0xAA,
+    0x49, 0xE9, 0x4E, 0xA3, 0x9E, 0xA4, 0xF3, 0x9E, 0xA4, 0xF7, 0x77, 0x77, 0x77, 0x59, 0xD9, 0x39,
+    0xDA, 0x6A, 0xD4, 0xAD, 0x96, 0xAD, 0x4E, 0x7E, 0x39, 0xE7, 0xDA, 0x3A, 0xDA, 0x69, 0xD9, 0x3E,
+    0xA6, 0xAD, 0x92, 0x9E, 0x96, 0xAD, 0x3F, 0x7F, 0xA9, 0xFC, 0x7F, 0xFD, 0xA7, 0xAF, 0xFC, 0x97,
+    0x0A, 0xFA, 0xE7, 0x4F, 0xA4, 0xAF, 0x5F, 0x94, 0xFA, 0x49, 0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A,
+    0xE9, 0x4A, 0xEA, 0x5F, 0x5F, 0x95, 0xF5, 0xF5, 0x9E, 0xA4, 0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F,
+    0x5F, 0x6E, 0xA5, 0xF5, 0x9E, 0x94, 0x9E, 0xA5, 0xAE, 0xA3, 0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF,
+    0xC9, 0x6A, 0xFF, 0xF7, 0x9F, 0xFE, 0x71, 0xAF, 0xFA, 0x77, 0xE7, 0x70, 0xAD, 0x77, 0x1F, 0xA7,
+    0x79, 0xE9, 0x77, 0x19, 0x97, 0x10, 0x19, 0xD9, 0x39, 0xDA, 0x1A, 0xD4, 0xAD, 0x91, 0xE4, 0xE2,
+    0xE3, 0x9E, 0x2D, 0xA3, 0xAD, 0xA1, 0x9D, 0x93, 0xEA, 0x1A, 0xD3, 0x9E, 0x91, 0xE9, 0x2F, 0x2F,
+    0xFE, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x93, 0xAF, 0xF7, 0x0A, 0xDA, 0x70, 0xAD, 0x97, 0x1D, 0xA9,
+    0x71, 0xF9, 0x71, 0xAD, 0x77, 0x20, 0x77, 0x77, 0x2D, 0x97, 0x74, 0xAE, 0x97, 0x72, 0x9F, 0xCA,
+    0x77, 0x1E, 0x99, 0xE7, 0x7E, 0x3A, 0xD7, 0x77, 0x77, 0x77, 0x2A, 0xAA, 0xA9, 0x75, 0xAA, 0xAA,
+    0x1F, 0x97, 0x4A, 0xEA, 0x1F, 0x97, 0x4F, 0x2F, 0x97, 0x3A, 0xEA, 0x2F, 0x97, 0x3F, 0x3F, 0x93,
+    0xE3, 0xAE, 0xA3, 0xF9, 0x2F, 0x3F, 0x4F, 0x2A, 0xF9, 0x1A, 0xEA, 0x4F, 0x19, 0xFC, 0xA1, 0xF5,
+    0xF0, 0x9F, 0xE0, 0xAE, 0xA4, 0x9F, 0x0F, 0xF0, 0xF5, 0x9F, 0xFF, 0xFC, 0xA5, 0x9F, 0xF0, 0xFF,
+    0x69, 0xFE, 0xA0, 0xFE, 0x96, 0xAF, 0xE1, 0xAF, 0xD7, 0xAF, 0xD2, 0xAF, 0xC9, 0x7A, 0xFC, 0xA2,
+    0xAF, 0xC7, 0x0A, 0xFC, 0x39, 0xF9, 0x70, 0x77, 0x79, 0xD7, 0x6F, 0x74, 0xAF, 0xC9, 0x71, 0x9E,
+    0x9A, 0xDA, 0x70, 0xDA, 0x3E, 0x77, 0x77, 0x77, 0x72, 0xE7, 0x1E, 0x1E, 0x70, 0xAD, 0xA0, 0x9E,
+    0x29, 0x93, 0xE1, 0x9E, 0x19, 0xDA, 0x1E, 0xA1, 0x9E, 0x1F, 0x09, 0xE2, 0x9E, 0x0F, 0xC9, 0xEA,
+    0x29, 0xFF, 0xFC, 0x39, 0xFF, 0xFA, 0x39, 0xFF, 0xF4, 0x9F, 0xCA, 0xFC, 0x94, 0x9F, 0xA0, 0xFC,
+    0x59, 0xF1, 0xF9, 0x6A, 0xAA, 0x29, 0xAA, 0xA6, 0x77, 0x49, 0xD9, 0x73, 0xAE, 0x97, 0x19, 0xFC,
+    0x97, 0x0E, 0x9A, 0xDA, 0x6E, 0x3A, 0xD7, 0x77, 0x77, 0x77, 0x72, 0xAE, 0x7E, 0xA9, 0xE9, 0x5F,
+    0x1E, 0xA4, 0xAE, 0x2F, 0x39, 0xE9, 0x2F, 0x29, 0xEA, 0x3A, 0xE9, 0x1F, 0x49, 0xEA, 0x0F, 0x6F,
+    0xAE, 0x96, 0xFF, 0x7F, 0xE7, 0x0A, 0xFC, 0x97, 0x09, 0xFA, 0x71, 0x9F, 0x72, 0xAE, 0xA7, 0x2F,
+    0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x10, 0x77, 0x70, 0xAD, 0x75, 0xF7, 0x3F, 0xD7, 0x1A,
+    0xDA, 0x9E, 0x96, 0x9D, 0xA2, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x0E, 0x5E, 0x93, 0xE9, 0x39,
+    0xDA, 0x4A, 0xE3, 0xE5, 0x9E, 0x2A, 0xDA, 0x6E, 0x91, 0xE7, 0xEA, 0x0A, 0xD9, 0x7F, 0x9E, 0x70,
+    0xAF, 0xD9, 0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x3F, 0x70, 0xAA,
+    0xFC, 0x97, 0x9F, 0xDA, 0x70, 0xAF, 0xCA, 0x71, 0xFA, 0x73, 0x5E, 0x91, 0xE5, 0x9E, 0x90, 0xAE,
+    0x5F, 0x1F, 0x5F, 0x0A, 0xEA, 0x49, 0xAA, 0xAA, 0x0A, 0xAA, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x0A, 0xE7, 0xEA, 0x9E, 0x95, 0xF1, 0xEA, 0x4A, 0xE2, 0xF3, 0x9E, 0x92, 0xF2, 0x9E, 0xA3, 0xAE,
+    0x91, 0xF4, 0x9E, 0xA0, 0xF6, 0xFA, 0xE9, 0x6F, 0xF7, 0xFE, 0x70, 0xAF, 0xC9, 0x70, 0x9F, 0xA7,
+    0x19, 0xF7, 0x2A, 0xEA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFC, 0x71, 0x75, 0xAC, 0xA7,
+    0x71, 0x9D, 0x77, 0x2D, 0x97, 0x71, 0xE7, 0x72, 0x99, 0x77, 0x77, 0x39, 0xFF, 0xFD, 0x69, 0xFF,
+    0xFD, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x6F, 0xD7, 0x6F, 0xD7, 0x59, 0xFD, 0x75, 0xAF, 0xD7,
+    0x5A, 0xFD, 0x75, 0xFD, 0xA7, 0x5F, 0xDA, 0x74, 0x9F, 0xDA, 0x74, 0xAF, 0xDA, 0x74, 0xAF, 0xEA,
+    0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x6F, 0xFF, 0xE5, 0x9F, 0xFF, 0xE5, 0x73, 0x99,
+    0x74, 0x9D, 0x74, 0xD9, 0x73, 0xE7, 0x3A, 0xD7, 0x77, 0x77, 0x77, 0x09, 0xFF, 0xC5, 0xAF, 0xFC,
+    0x59, 0xAA, 0xAA, 0xFA, 0x71, 0xAE, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x70,
+    0x9F, 0x97, 0x1F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xE9, 0x20, 0x75, 0xE9, 0x77, 0x09, 0xE9, 0x77,
+    0x0F, 0x77, 0x1F, 0x77, 0x09, 0xAA, 0xAA, 0x77, 0x77, 0x09, 0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x7F,
+    0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x6F, 0xD7, 0x6F, 0xD7, 0x59, 0xFD, 0x75, 0xAF, 0xD7, 0x5A, 0xFD,
+    0x75, 0xFD, 0xA7, 0x5F, 0xDA, 0x74, 0x9F, 0xDA, 0x74, 0xAF, 0xDA, 0x74, 0xAF, 0xEA, 0xAA, 0xAA,
+    0xA6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x6F, 0xFF, 0xE5, 0x9F, 0xFF, 0xE5, 0x73, 0xAA, 0xA7, 0x3A,
+    0xE7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0xF9, 0x77, 0x77, 0x77, 0x59, 0xFF, 0xC5, 0xAF, 0xFC, 0x59,
+    0xAA, 0xAA, 0xFA, 0x71, 0xAE, 0x97, 0x1F, 0x97, 0x09, 0xF7, 0x1A, 0xEA, 0x71, 0xF9, 0x70, 0x9F,
+    0x97, 0x1F, 0xFD, 0x4A, 0xFF, 0xD4, 0xFF, 0xE9, 0x20, 0x71, 0xAA, 0x93, 0x9A, 0xA7, 0x3A, 0xDA,
+    0x1A, 0xD9, 0x74, 0xFE, 0x77, 0xFA, 0x77, 0x09, 0xDA, 0x77, 0x2A, 0xA7, 0x77, 0x77, 0x77, 0x09,
+    0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x6F, 0xD7, 0x6F, 0xD7, 0x59,
+    0xFD, 0x75, 0xAF, 0xD7, 0x5A, 0xFD, 0x75, 0xFD, 0xA7, 0x5F, 0xDA, 0x74, 0x9F, 0xDA, 0x74, 0xAF,
+    0xDA, 0x74, 0xAF, 0xEA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE, 0x6F, 0xFF, 0xE5, 0x9F,
+    0xFF, 0xE5, 0x69, 0xD9, 0x29, 0xDA, 0x70, 0xAD, 0xA9, 0xE9, 0x72, 0xFD, 0x75, 0xEA, 0x76, 0xAD,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x69, 0xFF, 0xC7, 0x0A, 0xFF, 0xC7, 0x09, 0xAA, 0xAA, 0xFA, 0x74,
+    0xAE, 0x97, 0x4F, 0x97, 0x39, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x73, 0x9F, 0x97, 0x4F, 0xFD, 0x7A,
+    0xFF, 0xD7, 0xFF, 0xE9, 0x50, 0x59, 0xEA, 0x94, 0x9F, 0xCA, 0x4F, 0xD9, 0x39, 0xE9, 0x6E, 0xA7,
+    0xE7, 0x9D, 0xA7, 0xAD, 0x97, 0xE7, 0x9E, 0x7A, 0xE7, 0xEA, 0x7E, 0x96, 0x9E, 0x7F, 0x7E, 0xA6,
+    0x9E, 0x96, 0x77, 0x5A, 0x97, 0x76, 0xD7, 0x19, 0xFC, 0x94, 0xAD, 0x7A, 0xFF, 0xC2, 0xAD, 0xA6,
+    0xFF, 0xF0, 0x9E, 0x6F, 0xA3, 0xAE, 0xA0, 0xCA, 0x6F, 0x95, 0xF7, 0x0A, 0xE9, 0x6A, 0xE7, 0x0E,
+    0xA7, 0xAE, 0x79, 0xE7, 0x0A, 0xE7, 0xF7, 0x0F, 0x7E, 0x97, 0x0E, 0xA6, 0x9E, 0x97, 0xAE, 0x96,
+    0xAE, 0x96, 0x9F, 0x7A, 0xFA, 0x91, 0x99, 0xFC, 0xA7, 0xAF, 0xFF, 0xE7, 0x0A, 0xFF, 0xFD, 0x97,
+    0x1F, 0xFF, 0xCA, 0x72, 0x9F, 0xFE, 0xA7, 0x5A, 0xFD, 0xA9, 0x77, 0x77, 0x40, 0x75, 0x97, 0x7D,
+    0x59, 0xAE, 0xA1, 0xAD, 0x4A, 0xFE, 0x9D, 0x93, 0xFA, 0xAF, 0xD3, 0xAE, 0x3E, 0xA4, 0xE4, 0xE4,
+    0xAD, 0x94, 0xE4, 0xE4, 0xAD, 0xA4, 0xEA, 0x19, 0xF5, 0xFF, 0xDA, 0x5A, 0xFF, 0xC7, 0xFE, 0xA7,
+    0x1A, 0xEA, 0x97, 0x39, 0xAA, 0xAA, 0xAA, 0xA9, 0x6F, 0xFE, 0xA3, 0xFF, 0xFC, 0x91, 0xFE, 0xA2,
+    0x9E, 0x1E, 0xAE, 0x4A, 0xD0, 0xAD, 0x99, 0xE4, 0xE0, 0xDA, 0x0A, 0xDA, 0x29, 0xF0, 0xAC, 0x90,
+    0xFF, 0xE9, 0x09, 0xC0, 0x9F, 0xFE, 0x2C, 0x0A, 0xFF, 0xD5, 0xFF, 0xC9, 0x59, 0xFA, 0xA9, 0x70,
+    0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0xA7, 0x29, 0xF9, 0x72, 0x70, 0xAD, 0xA7,
+    0x5F, 0xA7, 0x5F, 0xA7, 0x4A, 0xDA, 0x09, 0xA9, 0x72, 0xFF, 0xC7, 0x1F, 0xFD, 0x79, 0xFC, 0x90,
+    0x9D, 0x96, 0xAF, 0x3A, 0xCA, 0x6F, 0x93, 0xAC, 0x96, 0xF4, 0xD9, 0x59, 0xF4, 0xD6, 0xFA, 0x3A,
+    0xD6, 0xFC, 0x2A, 0xD9, 0x59, 0xFF, 0xE6, 0x9F, 0xFD, 0x7F, 0xFD, 0x79, 0xE1, 0x9A, 0x97, 0x1E,
+    0xA7, 0x59, 0xE9, 0x75, 0xAE, 0x76, 0xEA, 0x75, 0xAE, 0x76, 0x99, 0x77, 0x4F, 0xFD, 0x94, 0xFF,
+    0xD4, 0x9E, 0xAA, 0xAA, 0xAA, 0x95, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xE9, 0x73, 0xAD, 0x97,
+    0x39, 0xD7, 0x3E, 0x97, 0x1A, 0xE7, 0x19, 0xEA, 0x71, 0x9F, 0xFD, 0x4A, 0xFF, 0xCA, 0x4F, 0xFD,
+    0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x40, 0x1A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90,
+    0x9F, 0xFF, 0xE0, 0x9F, 0xFF, 0xF0, 0xAF, 0xFF, 0xEA, 0x1C, 0x93, 0xEA, 0x79, 0x39, 0xE9, 0x74,
+    0xAE, 0x75, 0xF7, 0x5E, 0xA7, 0x49, 0xE9, 0x74, 0xF7, 0x5F, 0x74, 0x9E, 0xA7, 0x4A, 0xE9, 0x74,
+    0xF7, 0x49, 0xF7, 0x4A, 0xEA, 0x74, 0xF9, 0x71, 0x7A, 0xD7, 0xF6, 0xFA, 0x5A, 0xF9, 0x5E, 0x79,
+    0xDA, 0x7A, 0xD9, 0x7E, 0x5A, 0xFF, 0x19, 0xFF, 0xC1, 0x9A, 0xAE, 0xAA, 0xAA, 0x39, 0xE7, 0xAD,
+    0x97, 0xE7, 0x0E, 0x79, 0xDA, 0x7A, 0xD9, 0x7F, 0xDA, 0x4F, 0xDA, 0x4F, 0xDA, 0x30, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0xA6,
+    0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x39,
+    0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAF, 0x73, 0xFC, 0xA7, 0x2A, 0xFC, 0x97, 0x2F,
+    0xC7, 0x49, 0xE7, 0x77, 0x10, 0x77, 0x39, 0x97, 0x74, 0xAC, 0xA7, 0x73, 0xD9, 0x77, 0x2E, 0x5F,
+    0xA4, 0xAF, 0xC9, 0x5F, 0x94, 0xFC, 0x95, 0x9F, 0x5F, 0x96, 0xAF, 0x49, 0xF7, 0xAE, 0x94, 0xAE,
+    0xA7, 0xF5, 0xF9, 0x7F, 0x5F, 0x79, 0xEA, 0x49, 0xF7, 0xAE, 0x94, 0xAE, 0x97, 0xF5, 0xF7, 0x0E,
+    0xA5, 0xF7, 0x9E, 0x94, 0x9E, 0xA7, 0xAE, 0xA3, 0x9F, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xC9,
+    0x70, 0xFF, 0xFC, 0x71, 0x9F, 0xFE, 0x73, 0xAF, 0xFA, 0x77, 0x77, 0x00, 0x77, 0x76, 0x9C, 0xA7,
+    0x5A, 0xD7, 0x49, 0xD9, 0x19, 0xD9, 0x39, 0xFC, 0x2A, 0xD4, 0xAF, 0x3A, 0xD4, 0xEA, 0x4E, 0x39,
+    0xE5, 0xDA, 0x3A, 0xDA, 0x49, 0xD9, 0x3E, 0xA4, 0xAD, 0x92, 0x9E, 0x94, 0xAD, 0x3F, 0x5F, 0xA9,
+    0xFC, 0x5F, 0xFD, 0xA5, 0xAF, 0xFC, 0x96, 0xAF, 0xAE, 0x50, 0x0E, 0x94, 0xE9, 0x39, 0xE9, 0x39,
+    0xAA, 0xA9, 0x29, 0xD3, 0xD9, 0x2A, 0xD2, 0xAD, 0x39, 0x99, 0x20, 0x3D, 0x70, 0x9E, 0x7F, 0xC9,
+    0x4E, 0xAA, 0xDA, 0x2A, 0xD9, 0x19, 0xE7, 0x40, 0x59, 0xA9, 0x1D, 0xA0, 0x9C, 0xA0, 0xF9, 0xAC,
+    0x09, 0xD0, 0xF0, 0x9C, 0x90, 0x9A, 0xA1, 0x75, 0x9A, 0xAF, 0xD9, 0x09, 0xFF, 0xCA, 0x0F, 0xDA,
+    0xAA, 0xA9, 0x70, 0x99, 0x99, 0x92, 0xFF, 0xFA, 0x0F, 0xFF, 0xCA, 0x09, 0x74, 0x73, 0xAD, 0x29,
+    0xDA, 0x0A, 0xFF, 0x90, 0x9F, 0xEA, 0x29, 0xFA, 0x97, 0x40, 0x1E, 0x90, 0x9E, 0x90, 0xF1, 0xF0,
+    0x9A, 0xAA, 0xA0, 0x1D, 0xA0, 0x9D, 0xA0, 0xAD, 0xA0, 0xAD, 0x90, 0xE9, 0x0E, 0x9A, 0xE9, 0xAE,
+    0x00, 0x09, 0x92, 0xE2, 0x9C, 0x1A, 0xCA, 0x1C, 0x96, 0x1A, 0xCA, 0x1F, 0xA0, 0xDA, 0xCA, 0x0F,
+    0x1A, 0xD9, 0x00, 0x29, 0xE5, 0xE9, 0x19, 0xE9, 0x4E, 0xA1, 0x9E, 0x94, 0xEA, 0x19, 0xAA, 0xA9,
+    0x4A, 0xAA, 0x92, 0x74, 0xE2, 0x9D, 0xA2, 0xE9, 0xE9, 0x39, 0xFC, 0x95, 0xAE, 0x70, 0xD5, 0x0E,
+    0x94, 0xAD, 0xA5, 0xEA, 0x4F, 0x49, 0xEA, 0x4F, 0x49, 0xAA, 0xA9, 0x4A, 0xAA, 0xA0, 0x72, 0xFC,
+    0x49, 0xF5, 0xF9, 0x49, 0xF5, 0xF9, 0x5F, 0x5A, 0xEA, 0x00, 0x3F, 0xC4, 0xF9, 0x39, 0xF4, 0xF9,
+    0x39, 0xEA, 0x4F, 0x4A, 0xEA, 0x75, 0x9F, 0xA3, 0xAF, 0x4F, 0x4A, 0xEA, 0x4F, 0x4A, 0xF4, 0xF9,
+    0x70, 0x2A, 0xA2, 0x9D, 0x0A, 0xEA, 0x0F, 0x91, 0x9D, 0x29, 0xCA, 0x10, 0x9A, 0x92, 0xAD, 0x29,
+    0xF1, 0xF9, 0x0A, 0xCA, 0x29, 0xCA, 0x10, 0x9E, 0xAA, 0xA9, 0x90, 0xAF, 0xF0, 0x9A, 0xAA, 0xAA,
+    0xE6, 0xE5, 0x9D, 0xA5, 0x9D, 0x90, 0x69, 0xCA, 0x1A, 0xCA, 0x1D, 0x9A, 0xE0, 0xE1, 0x9A, 0x20,
+    0x69, 0xCA, 0x09, 0xD9, 0x0D, 0x91, 0xAD, 0x2C, 0xA5, 0x1A, 0x92, 0x9D, 0x1F, 0x1F, 0xC9, 0x09,
+    0xAD, 0x95, 0x9C, 0x92, 0x9F, 0xA0, 0xAF, 0x1D, 0xAA, 0x1A, 0xC9, 0x60, 0x19, 0x92, 0xA9, 0x0A,
+    0xEA, 0x09, 0xC2, 0x99, 0x10, 0x75, 0xAA, 0xAF, 0xD1, 0xAF, 0xFC, 0x09, 0xFD, 0xAA, 0xAA, 0x00,
+    0x19, 0xAA, 0x91, 0xEA, 0x09, 0xE9, 0x0F, 0x90, 0xF0, 0x1A, 0xD1, 0xAD, 0x2E, 0x1E, 0x1A, 0xE0,
+    0xAE, 0x1F, 0x0F, 0x00, 0x1A, 0xCA, 0x1F, 0xA0, 0xDA, 0xCA, 0x0F, 0x1A, 0xD9, 0x00, 0x75, 0xFC,
+    0x4F, 0x93, 0x9F, 0x4F, 0x93, 0xAE, 0xA4, 0xF4, 0xFA, 0x30, 0x2A, 0xA3, 0x9C, 0xA3, 0xE9, 0x19,
+    0xCA, 0xD3, 0x9D, 0x1F, 0xA1, 0xE9, 0x10, 0x71, 0xAD, 0x2E, 0x91, 0xE2, 0x9F, 0xA1, 0xFA, 0x2A,
+    0xD9, 0x70, 0x2E, 0x29, 0xE2, 0xAD, 0xA2, 0xE9, 0x19, 0xE2, 0xAE, 0x2E, 0x91, 0x0A, 0xFE, 0x90,
+    0xFF, 0x1E, 0xAA, 0xE0, 0x9D, 0xA0, 0x9D, 0xA0, 0xAD, 0x90, 0xAD, 0x90, 0x0E, 0x49, 0xDA, 0x19,
+    0xE9, 0x09, 0xE9, 0x3A, 0xFE, 0x95, 0xAF, 0xC7, 0x0E, 0xA7, 0x1A, 0xD6, 0x3A, 0xC9, 0x71, 0xE9,
+    0x7F, 0xC9, 0x5A, 0xFD, 0xA3, 0x9E, 0x90, 0xAE, 0x2E, 0x4E, 0x90, 0x1A, 0xD1, 0xAC, 0x90, 0xFA,
+    0x0D, 0x99, 0xDA, 0xDA, 0xD0, 0xAC, 0xA0, 0xFA, 0x0A, 0xCA, 0x1D, 0xA7, 0x30, 0x73, 0x9F, 0xF1,
+    0xFF, 0xC1, 0x99, 0x99, 0x50, 0x19, 0xAA, 0xAA, 0xE9, 0x0A, 0xFF, 0xA9, 0xFF, 0xC9, 0x72, 0x19,
+    0xDA, 0x1D, 0x2F, 0x1D, 0x1A, 0xDA, 0xFA, 0x1D, 0x90, 0xF2, 0xD9, 0x09, 0xD9, 0x74, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD, 0xA0, 0xFF, 0xD9, 0x49, 0xCA, 0x19, 0xDA, 0x19, 0xD2, 0xD9,
+    0x0A, 0xD9, 0x09, 0xD2, 0x91, 0x9A, 0xA2, 0xAA, 0xA1, 0xAD, 0xA1, 0xE9, 0x09, 0xE1, 0xAD, 0xA1,
+    0xFF, 0xC1, 0xFF, 0xC1, 0xAF, 0xF9, 0x72, 0x09, 0xFE, 0x90, 0xAF, 0xE1, 0xDA, 0x99, 0xE1, 0xD9,
+    0x1D, 0xA0, 0x9D, 0x99, 0x9D, 0x90, 0xAF, 0xE1, 0xFF, 0x10, 0x2A, 0xCA, 0xD9, 0x2F, 0xE1, 0x9C,
+    0x9A, 0xCA, 0xD1, 0xAC, 0x0D, 0x0C, 0xA1, 0xCA, 0x0C, 0xA9, 0xC7, 0x30, 0x1A, 0x90, 0xA9, 0x19,
+    0xDA, 0x3D, 0x3E, 0x2C, 0xA0, 0xCA, 0x00, 0x59, 0xA9, 0x1D, 0xA0, 0x9C, 0xA0, 0xF9, 0xAC, 0x09,
+    0xD0, 0xF0, 0x9C, 0x90, 0x9A, 0xA1, 0x6C, 0xA1, 0x9D, 0x90, 0x9D, 0xA0, 0xE1, 0xA9, 0x10, 0x70,
+    0x9D, 0x71, 0xD9, 0x70, 0xDA, 0x70, 0xAD, 0x71, 0x99, 0x97, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAD,
+    0x90, 0xAD, 0x93, 0xE1, 0xE3, 0x9E, 0x09, 0xE3, 0xF0, 0xF2, 0x1F, 0xF2, 0xFE, 0xA1, 0x9E, 0xAE,
+    0x91, 0xE1, 0xAD, 0x2E, 0x1E, 0x10, 0x39, 0xAA, 0xAA, 0xF3, 0xFF, 0xD2, 0xAF, 0xFC, 0xA7, 0x77,
+    0x6A, 0xFF, 0xA2, 0x9F, 0xFC, 0xA2, 0xDA, 0xAA, 0xAA, 0xAA, 0x99, 0x10, 0x74, 0xAD, 0x19, 0xD9,
+    0x1E, 0x1E, 0x19, 0xDA, 0x1D, 0xA1, 0xAD, 0x90, 0x9D, 0x91, 0xE1, 0xE1, 0x9E, 0x1E, 0x10, 0x09,
+    0xFC, 0xA1, 0xAF, 0xD1, 0xFE, 0x4A, 0xDA, 0x4E, 0x94, 0xAA, 0xA1, 0x77, 0x71, 0x99, 0x73, 0x9C,
+    0x70, 0x9D, 0xAC, 0x9A, 0xCA, 0x49, 0xFC, 0x0D, 0xA4, 0xFF, 0xC9, 0x39, 0xDA, 0xFD, 0x49, 0xEA,
+    0x9D, 0xA6, 0x9D, 0x74, 0xC9, 0x73, 0xD7, 0x3A, 0xC7, 0x39, 0xC9, 0x73, 0xD7, 0x3A, 0xC7, 0x39,
+    0xC9, 0x73, 0x97, 0x40, 0x75, 0xD9, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x09, 0xE7, 0x77, 0x77,
+    0x77, 0x77, 0x19, 0x99, 0x95, 0x99, 0x99, 0x4F, 0xEA, 0x3F, 0xA1, 0x9F, 0xFD, 0x19, 0xF2, 0xFC,
+    0x1F, 0xFD, 0xA1, 0xFC, 0x91, 0x9F, 0xFA, 0x2A, 0xF4, 0xAF, 0xA9, 0x3A, 0xD7, 0x71, 0xE7, 0x70,
+    0x9A, 0xAA, 0x77, 0x00, 0x77, 0x2A, 0xEA, 0x2A, 0xA3, 0xFD, 0x90, 0x9D, 0xA1, 0xAD, 0xA0, 0xE9,
+    0xE2, 0xE9, 0x09, 0xFC, 0xA3, 0x99, 0x29, 0xEA, 0x77, 0x29, 0xF2, 0xAA, 0xA2, 0x9F, 0xD1, 0xE2,
+    0xE0, 0x9D, 0x9A, 0xDA, 0x19, 0xE1, 0xFD, 0x71, 0xAD, 0xA7, 0x72, 0x73, 0x99, 0x96, 0x9D, 0x97,
+    0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x39, 0xC7, 0xAD,
+    0x70, 0x91, 0x09, 0x92, 0xD9, 0x2C, 0x39, 0x10, 0x09, 0x97, 0x5A, 0x1D, 0x73, 0x9D, 0x19, 0xDA,
+    0x69, 0xAE, 0x92, 0x9F, 0xFF, 0xA6, 0x9A, 0xFD, 0xA9, 0x40, 0x49, 0xAA, 0xEA, 0xA9, 0x7A, 0xFF,
+    0xEA, 0x4E, 0x95, 0x9A, 0xE9, 0x1A, 0xCA, 0x72, 0x9D, 0x90, 0x9A, 0x75, 0xA7, 0x73, 0x77, 0x77,
+    0x7C, 0x94, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xE9, 0x2F, 0xFF, 0xFF, 0xC1, 0xFF,
+    0xFF, 0xEA, 0x77, 0x1D, 0xA7, 0x73, 0x95, 0x73, 0xE9, 0x74, 0xAE, 0x97, 0x39, 0xFA, 0x73, 0xFC,
+    0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A, 0xDA, 0x1E, 0x70, 0xE2, 0xE9,
+    0x6E, 0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF,
+    0xD2, 0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x90, 0x4F, 0xFA, 0x7F, 0xFD, 0x59, 0xEA, 0xAA,
+    0xFA, 0x4A, 0xE4, 0xE4, 0xEA, 0x4E, 0x4E, 0x93, 0x9D, 0x93, 0x9E, 0x3A, 0xE4, 0xAF, 0xFD, 0x94,
+    0xFF, 0xDA, 0x5F, 0xFE, 0xA3, 0x9E, 0x4A, 0xE3, 0xAD, 0xA4, 0x9E, 0x92, 0xE9, 0x4A, 0xE2, 0x9E,
+    0xAA, 0xAA, 0xAF, 0xC2, 0xAF, 0xFF, 0xA2, 0xFF, 0xFC, 0x3F, 0xFF, 0x39, 0xFF, 0xCA, 0x94, 0x77,
+    0x4A, 0xFF, 0xC5, 0xFF, 0xCA, 0x49, 0xFF, 0xC9, 0x4A, 0xD7, 0x4E, 0x74, 0xE7, 0x39, 0xDA, 0x73,
+    0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x39, 0xDA, 0x73, 0xAD, 0x97, 0x3E, 0x74, 0xE7, 0x3A, 0xE7, 0x3E,
+    0xA7, 0x3E, 0x97, 0x39, 0x99, 0x73, 0x77, 0x74, 0xF7, 0x4A, 0xF7, 0x39, 0xFC, 0x97, 0x2F, 0xDA,
+    0x71, 0xEA, 0xF7, 0x0A, 0xE0, 0xAE, 0x79, 0xE9, 0x0A, 0xE6, 0x9E, 0xA1, 0x9E, 0x95, 0xF2, 0x9E,
+    0xA4, 0xAE, 0x93, 0xF3, 0xAE, 0xA4, 0xF2, 0x9F, 0x5F, 0x2F, 0x95, 0xF9, 0x09, 0xFF, 0xFE, 0x90,
+    0xAF, 0xFF, 0xE1, 0xFF, 0xFE, 0xA0, 0x5A, 0xAA, 0xAF, 0xE5, 0xAF, 0xFD, 0xA5, 0xFF, 0xE6, 0xE9,
+    0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9F, 0xFC, 0x7A, 0xFF, 0xA7, 0xFF, 0xC9, 0x7E, 0xA9,
+    0x73, 0xAE, 0x75, 0xF7, 0x5F, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFE, 0x5A, 0xFF, 0xE5, 0xFF, 0xF4,
+    0x9F, 0xFF, 0x40, 0x59, 0xFF, 0xFD, 0x69, 0xFF, 0xFD, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xC7, 0x6F,
+    0xD7, 0x6F, 0xD7, 0x59, 0xFD, 0x75, 0xAF, 0xD7, 0x5A, 0xFD, 0x75, 0xFD, 0xA7, 0x5F, 0xDA, 0x74,
+    0x9F, 0xDA, 0x74, 0xAF, 0xDA, 0x74, 0xAF, 0xEA, 0xAA, 0xAA, 0xA6, 0xAF, 0xFF, 0xD6, 0xFF, 0xFE,
+    0x6F, 0xFF, 0xE5, 0x9F, 0xFF, 0xE5, 0x49, 0xE6, 0xEA, 0x4A, 0xE5, 0x9E, 0x94, 0xF5, 0xAE, 0x5E,
+    0xA5, 0xF4, 0xAE, 0x95, 0xEA, 0x4F, 0x59, 0xE9, 0x4F, 0x5A, 0xE9, 0x39, 0xEA, 0x5F, 0x4A, 0xE9,
+    0x49, 0xF4, 0xF9, 0x4A, 0xEA, 0x39, 0xFF, 0xFD, 0x93, 0xAF, 0xFF, 0xD4, 0xFF, 0xFE, 0x4F, 0xFF,
+    0xDA, 0x39, 0xFA, 0xAA, 0xAA, 0xAF, 0x93, 0xAF, 0x49, 0xF9, 0x3F, 0xA4, 0xAF, 0x39, 0xF9, 0x4F,
+    0xC3, 0x70, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4,
+    0xAE, 0x96, 0xAE, 0x4E, 0xA5, 0x90, 0xAE, 0x39, 0xE0, 0xAF, 0xD0, 0xAE, 0x3F, 0x9F, 0xE9, 0xF3,
+    0xE9, 0xAA, 0xAA, 0x99, 0x99, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A, 0xFA,
+    0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF, 0xEA,
+    0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x4A, 0xDA, 0x5F, 0x5E, 0xA5, 0xE9, 0x49, 0xE5, 0xAD, 0xA5,
+    0xE9, 0x5E, 0x59, 0xE5, 0xEA, 0x5E, 0x94, 0x9E, 0x94, 0xAE, 0x5F, 0x49, 0xEA, 0x4A, 0xEA, 0x4F,
+    0x94, 0xAE, 0x40, 0x6E, 0xA1, 0xAE, 0xA6, 0x9E, 0x19, 0xF7, 0xAD, 0xA1, 0xF7, 0x0E, 0x90, 0xF7,
+    0x09, 0xE0, 0xF9, 0x70, 0xEA, 0xAE, 0x97, 0x1E, 0xAE, 0xA7, 0x1A, 0xFD, 0xA7, 0x2F, 0xE7, 0x29,
+    0xFD, 0x73, 0xAF, 0xCA, 0x73, 0xFE, 0x97, 0x19, 0xFF, 0x71, 0xFF, 0xD7, 0x0E, 0xA9, 0xFC, 0xA6,
+    0xAE, 0x90, 0xFD, 0xA5, 0xF2, 0xFD, 0x93, 0x9F, 0x2A, 0xFD, 0x92, 0x09, 0xFC, 0xA7, 0x29, 0xFD,
+    0x72, 0x9F, 0xE7, 0x19, 0xFE, 0x97, 0x09, 0xFF, 0x70, 0x9F, 0xFA, 0x7A, 0xFF, 0xC7, 0xAF, 0x0F,
+    0xA6, 0xAF, 0x09, 0xF9, 0x5A, 0xEA, 0x1A, 0xF5, 0xAE, 0xA2, 0xF9, 0x4F, 0x92, 0x9F, 0x4F, 0x93,
+    0xAE, 0xA3, 0xF5, 0xF3, 0xF6, 0xF2, 0xF6, 0xAE, 0x91, 0xF7, 0xF1, 0xEA, 0x70, 0xEA, 0x5F, 0x95,
+    0x9F, 0x59, 0xF9, 0x5F, 0xA5, 0xFC, 0xA4, 0xAF, 0x95, 0xFD, 0x39, 0xFC, 0x94, 0x9F, 0xD3, 0xFD,
+    0x5A, 0xFD, 0x2A, 0xFD, 0x5F, 0xE1, 0x9F, 0xDA, 0x49, 0xFE, 0x90, 0xFE, 0x94, 0xAE, 0xAE, 0x9A,
+    0xEA, 0xE5, 0xEA, 0xAF, 0xEA, 0xF5, 0xE9, 0xAF, 0xE9, 0xEA, 0x4A, 0xE9, 0x9F, 0xD9, 0xAE, 0x94,
+    0xF0, 0x9F, 0xD0, 0xF9, 0x4F, 0x09, 0xFC, 0x99, 0xF4, 0x9E, 0xA1, 0xFC, 0x0A, 0xF4, 0xAE, 0xA1,
+    0xF1, 0xFA, 0x4F, 0x91, 0xEA, 0x09, 0xF9, 0x39, 0xF7, 0xAF, 0x40, 0x77, 0x9E, 0x6F, 0x94, 0xAD,
+    0xA6, 0xFA, 0x4E, 0x95, 0x9F, 0xA3, 0x9E, 0x6F, 0xD3, 0xAD, 0xA6, 0xFD, 0x3E, 0x95, 0x9F, 0xD9,
+    0x19, 0xE6, 0xFE, 0xA1, 0xAD, 0xA6, 0xFA, 0xE1, 0xE9, 0x5A, 0xEA, 0xAE, 0x09, 0xE6, 0xF9, 0x9E,
+    0x0A, 0xE6, 0xF1, 0xE9, 0xE9, 0x5A, 0xF1, 0xFE, 0x6F, 0xA1, 0xFE, 0x59, 0xF9, 0x1F, 0xDA, 0x5A,
+    0xF9, 0x1A, 0xFC, 0x6F, 0xC2, 0x9F, 0xC5, 0x9F, 0xC2, 0x9F, 0xA5, 0x5F, 0xFF, 0x59, 0xFF, 0xEA,
+    0x5A, 0xFF, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2F, 0xF7, 0x19, 0xFF, 0x71, 0xAF, 0xEA, 0x77,
+    0x77, 0x73, 0x9F, 0xFF, 0xC9, 0x3A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD4, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x30, 0x70, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F,
+    0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97,
+    0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF,
+    0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77,
+    0x40, 0x4F, 0xFE, 0x4F, 0xFD, 0xA3, 0xAD, 0xA9, 0x99, 0x9E, 0x93, 0xE4, 0xE4, 0xE4, 0xDA, 0x39,
+    0xDA, 0x39, 0xD9, 0x3A, 0xD9, 0x3A, 0xD4, 0xE4, 0xE4, 0xE3, 0x9D, 0xA3, 0x9D, 0xA3, 0xAD, 0x93,
+    0xAD, 0x93, 0xE4, 0xE4, 0xE4, 0xE3, 0x9D, 0xA3, 0x9D, 0x93, 0xAD, 0x93, 0xAD, 0x4E, 0x4A, 0xAA,
+    0x4A, 0xAA, 0x30, 0x5A, 0xAA, 0xAA, 0xA9, 0x71, 0xFF, 0xA6, 0x9F, 0xFC, 0x95, 0xAD, 0xA2, 0x9E,
+    0x5E, 0x4A, 0xD4, 0x9E, 0x4E, 0x4A, 0xDA, 0x29, 0xF4, 0xFF, 0xE9, 0x39, 0xFF, 0xE4, 0xAF, 0xFD,
+    0x5F, 0xFC, 0x95, 0x9F, 0xAA, 0x97, 0x0A, 0xE9, 0x73, 0xF7, 0x39, 0xF7, 0x3A, 0xEA, 0x73, 0xFA,
+    0x72, 0x9F, 0x97, 0x20, 0x4F, 0xFD, 0x49, 0xFF, 0xD4, 0xAE, 0xAA, 0xAA, 0xAA, 0x95, 0xEA, 0x73,
+    0xAE, 0x74, 0xF7, 0x39, 0xE9, 0x73, 0xAD, 0x97, 0x3A, 0xD7, 0x3E, 0x72, 0xAE, 0x71, 0x9E, 0xA7,
+    0x19, 0xFF, 0xD4, 0xAF, 0xFC, 0xA4, 0xFF, 0xD9, 0x49, 0x99, 0x99, 0x99, 0x99, 0x94, 0x0A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE, 0x0A, 0xFF, 0xFD, 0xA6,
+    0xEA, 0x73, 0x9E, 0x97, 0x3A, 0xE7, 0x4F, 0x74, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xF7, 0x39,
+    0xEA, 0x73, 0xAE, 0x97, 0x3F, 0x73, 0x9F, 0x73, 0xAE, 0xA7, 0x3F, 0x97, 0x10, 0xAE, 0x7E, 0xA9,
+    0xE9, 0x5F, 0x1E, 0xA4, 0xAE, 0x2F, 0x39, 0xE9, 0x2F, 0x29, 0xEA, 0x3A, 0xE9, 0x1F, 0x49, 0xEA,
+    0x0F, 0x6F, 0xAE, 0x96, 0xFF, 0x7F, 0xE7, 0x0A, 0xFC, 0x97, 0x09, 0xFA, 0x71, 0x9F, 0x72, 0xAE,
+    0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x10, 0x75, 0xE7, 0x74, 0x9E, 0x77, 0x4A,
+    0xDA, 0x77, 0x39, 0xEA, 0x97, 0x7A, 0xFF, 0xD9, 0x72, 0xAF, 0xFF, 0xD7, 0x0F, 0xCA, 0xE9, 0x0A,
+    0xFA, 0x59, 0xFA, 0x1E, 0x2A, 0xF5, 0xFA, 0x19, 0xDA, 0x3F, 0x93, 0xFA, 0x2E, 0x93, 0xF9, 0x29,
+    0xF3, 0xE3, 0x9F, 0x3F, 0xA2, 0x9E, 0x3F, 0xA3, 0xF9, 0x2A, 0xD9, 0x29, 0xF9, 0x29, 0xFA, 0x2E,
+    0x2A, 0xFC, 0x3A, 0xFD, 0xAA, 0xEA, 0xAF, 0xD4, 0x9F, 0xFF, 0xFD, 0x95, 0xFF, 0xFF, 0xCA, 0x69,
+    0xFF, 0xFE, 0x97, 0x19, 0xAF, 0xFA, 0xA7, 0x70, 0xE9, 0x77, 0x4E, 0x77, 0x49, 0xDA, 0x77, 0x49,
+    0xAA, 0x97, 0x50, 0x5F, 0x6A, 0xE6, 0x9E, 0x94, 0xAE, 0x70, 0xEA, 0x39, 0xE7, 0x1F, 0x29, 0xE9,
+    0x71, 0xAE, 0xA0, 0x9E, 0x97, 0x3F, 0x9E, 0xA7, 0x4F, 0xEA, 0x75, 0xAF, 0xD7, 0x7F, 0xC7, 0x79,
+    0xFA, 0x77, 0xFD, 0x76, 0xFE, 0x97, 0x4F, 0xFC, 0x73, 0xFA, 0xAF, 0x97, 0x1F, 0xC0, 0x9F, 0xA7,
+    0x0F, 0xC2, 0xFC, 0x7F, 0xC3, 0xAF, 0xA5, 0xFC, 0x49, 0xFC, 0x40, 0x77, 0x5A, 0xDA, 0x3D, 0xA0,
+    0xE3, 0xAD, 0x39, 0xD1, 0xE3, 0xE3, 0xAD, 0x09, 0xDA, 0x3D, 0xA3, 0xDA, 0x0A, 0xD3, 0x9D, 0x92,
+    0x9D, 0x99, 0xE3, 0x9D, 0x92, 0xAD, 0x0E, 0x93, 0x9E, 0x2F, 0xE4, 0x9E, 0xA1, 0xFD, 0x95, 0xFF,
+    0xEA, 0x6A, 0xFF, 0xCA, 0x70, 0xAF, 0xE9, 0x74, 0xAD, 0x97, 0x6A, 0xD7, 0x7D, 0xA7, 0x7D, 0x97,
+    0x6A, 0xD7, 0x7D, 0xA7, 0x7D, 0x97, 0x69, 0xAA, 0x72, 0x70, 0xAF, 0xA7, 0x3A, 0xFF, 0xA7, 0x0F,
+    0xCA, 0xAF, 0x96, 0xAE, 0x93, 0xF5, 0xAE, 0x59, 0xE5, 0xE9, 0x6E, 0x4A, 0xE7, 0xE4, 0xE9, 0x69,
+    0xE3, 0x9E, 0x79, 0xE3, 0xAE, 0x7E, 0x93, 0xAD, 0xA6, 0x9E, 0x4A, 0xDA, 0x59, 0xEA, 0x49, 0xE4,
+    0xAF, 0x49, 0x9F, 0x91, 0xFC, 0x93, 0x9F, 0xD9, 0x09, 0xFD, 0x3A, 0xFD, 0x1A, 0xFD, 0x3A, 0xFD,
+    0x1F, 0xE7, 0x77, 0x77, 0x6A, 0xE9, 0xDA, 0x7F, 0xFA, 0x6E, 0xAA, 0xF9, 0x5A, 0xD3, 0xE5, 0x9D,
+    0x93, 0xE5, 0xAC, 0xA4, 0xE5, 0xD5, 0xE5, 0xD4, 0xAD, 0xA4, 0x9F, 0xFD, 0xA5, 0xFF, 0xE9, 0x09,
+    0x91, 0xFF, 0xFD, 0x92, 0xAE, 0xA9, 0xFE, 0x73, 0xFA, 0x77, 0x10, 0x77, 0x77, 0x77, 0x77, 0x74,
+    0xAD, 0xA7, 0x29, 0xFD, 0x70, 0x9F, 0xF7, 0xFC, 0xAE, 0xA5, 0xAE, 0x3E, 0x5E, 0x4E, 0x5E, 0x3E,
+    0x94, 0xAD, 0xA9, 0xFC, 0xA5, 0xE9, 0xAF, 0xC6, 0xE0, 0xAF, 0xD4, 0x9E, 0x4E, 0x93, 0xAE, 0x4E,
+    0x93, 0xFC, 0xA9, 0x9F, 0x39, 0xFF, 0xEA, 0x39, 0xFF, 0xE4, 0xEA, 0xFE, 0x94, 0xE2, 0xAE, 0x94,
+    0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4A, 0xAA, 0x74, 0x0E, 0x93, 0xAD, 0x90, 0xAD, 0xA3, 0xE9,
+    0x0A, 0xE3, 0xE1, 0x9E, 0x29, 0xE2, 0xE9, 0x1A, 0xDA, 0x2E, 0xA1, 0xE9, 0x2F, 0x0A, 0xE3, 0xAE,
+    0x9E, 0x93, 0x9F, 0xE4, 0x9F, 0xD5, 0x9F, 0xC9, 0x5A, 0xFA, 0x6A, 0xF7, 0xF9, 0x7F, 0x70, 0xF7,
+    0x0F, 0x79, 0xF7, 0x9A, 0x99, 0x70, 0x59, 0xAF, 0xCA, 0x95, 0xAF, 0xFC, 0x5F, 0xAF, 0xC4, 0x9E,
+    0x49, 0xA5, 0xE9, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xFA, 0x79, 0xFE, 0x95, 0xAF, 0xFC, 0x49,
+    0xFA, 0x9A, 0xE9, 0x3F, 0x3E, 0xA2, 0x9E, 0x93, 0xEA, 0x2A, 0xE4, 0xE9, 0x2A, 0xE9, 0x19, 0xF3,
+    0x9F, 0xFD, 0x94, 0xFF, 0xCA, 0x59, 0xFE, 0x97, 0x0A, 0xAC, 0xA9, 0x60, 0x49, 0x99, 0x6F, 0xC4,
+    0xD9, 0x1C, 0x92, 0x9C, 0x39, 0x4D, 0xA9, 0x59, 0xEA, 0x49, 0xD9, 0x19, 0x3A, 0xC9, 0x1A, 0xCA,
+    0x2D, 0x91, 0xD9, 0x2A, 0xFD, 0x4F, 0xC6, 0x99, 0x94, 0x49, 0xAA, 0xAA, 0xAA, 0xA9, 0x4F, 0xFA,
+    0x4F, 0xF9, 0x59, 0xF9, 0x6A, 0xEA, 0x7A, 0xE9, 0x7A, 0xE7, 0x1E, 0x71, 0xAD, 0xA7, 0x1E, 0x72,
+    0xE9, 0x71, 0xAF, 0xCA, 0x7A, 0xFD, 0x79, 0xFC, 0x71, 0xEA, 0x70, 0xAE, 0x97, 0xAE, 0xA7, 0xFC,
+    0x7A, 0xF7, 0x74, 0x77, 0x09, 0xE7, 0x2A, 0xEA, 0xAE, 0xA4, 0x9A, 0xFF, 0xC4, 0x9F, 0xCA, 0xE9,
+    0x3F, 0x3D, 0xA3, 0xE3, 0x9D, 0xA2, 0x9D, 0xA3, 0xAD, 0x92, 0xE9, 0x3E, 0x3E, 0x93, 0xE2, 0x9E,
+    0x3A, 0xDA, 0x2A, 0xE3, 0xE9, 0x2E, 0xA3, 0xE9, 0x19, 0xEA, 0x29, 0xE2, 0xAE, 0x92, 0xF7, 0x2E,
+    0xA7, 0x19, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x2A, 0xAA, 0x93, 0x69, 0xF9, 0x70, 0xFE, 0x96, 0xE9,
+    0x1E, 0x5A, 0xD9, 0x29, 0xD4, 0x9E, 0x39, 0xD4, 0xE9, 0x3A, 0xD4, 0xFA, 0xAA, 0xAE, 0x3A, 0xFF,
+    0xE3, 0xFF, 0xEA, 0x3E, 0x93, 0xE9, 0x29, 0xE9, 0x2A, 0xE3, 0x9E, 0xA1, 0xAE, 0xA3, 0x9F, 0xFD,
+    0x5F, 0xFC, 0xA5, 0xFF, 0xC6, 0x9F, 0xE7, 0x09, 0xAD, 0xA9, 0x60, 0x39, 0xAA, 0x4A, 0xD4, 0xE4,
+    0xDA, 0x39, 0xD9, 0x3A, 0xD4, 0xE3, 0x9D, 0xA3, 0xAD, 0x93, 0xE9, 0x29, 0xE3, 0xAE, 0x3F, 0xD0,
+    0x9F, 0xCA, 0x0A, 0xFC, 0x90, 0x3A, 0xD0, 0x9D, 0xA4, 0xD9, 0x0E, 0x49, 0xD0, 0xE5, 0xAC, 0xAE,
+    0x6F, 0xC6, 0x9F, 0x96, 0xF9, 0x7F, 0xA6, 0xAF, 0xC9, 0x5D, 0xAF, 0x93, 0x9D, 0x99, 0xF3, 0xAD,
+    0x1A, 0xF2, 0x9A, 0xA9, 0x97, 0x39, 0xFC, 0x97, 0x2F, 0xDA, 0x71, 0xFE, 0x97, 0x39, 0xF7, 0x5E,
+    0xA7, 0x49, 0xE7, 0x49, 0xF7, 0x3A, 0xF9, 0x72, 0xFD, 0x72, 0xFD, 0xA7, 0x09, 0xE9, 0xE7, 0x0A,
+    0xE0, 0x9D, 0xA7, 0xEA, 0x1E, 0x96, 0xE9, 0x19, 0xE5, 0x9E, 0x3A, 0xD9, 0x4A, 0xE4, 0xE4, 0xE9,
+    0x4A, 0xDA, 0x49, 0xE3, 0x9D, 0xA4, 0xAD, 0x93, 0xAD, 0x94, 0xAD, 0x4E, 0x5E, 0x39, 0xE4, 0x9D,
+    0xA3, 0xAD, 0xA4, 0xAD, 0x93, 0xEA, 0x4E, 0x92, 0x9E, 0x93, 0x9E, 0x3F, 0x4F, 0xCA, 0x9F, 0xC3,
+    0x9F, 0xFE, 0xA3, 0xAF, 0xFE, 0x93, 0xD9, 0xAF, 0xAE, 0x39, 0xD7, 0x5D, 0xA7, 0x5A, 0xA9, 0x74,
+    0x0E, 0x93, 0xAD, 0x90, 0xAD, 0xA3, 0xE9, 0x0A, 0xE3, 0xE1, 0x9E, 0x29, 0xE2, 0xE9, 0x1A, 0xDA,
+    0x2E, 0xA1, 0xE9, 0x2F, 0x0A, 0xE3, 0xAE, 0x9E, 0xA3, 0x9F, 0xE4, 0x9F, 0xD9, 0x49, 0xFC, 0xA5,
+    0x9F, 0xC6, 0x9F, 0x94, 0x19, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFA, 0x09, 0xFF, 0x92, 0x9F, 0xC3,
+    0x9F, 0xCA, 0x3F, 0xDA, 0x3F, 0xD9, 0x3A, 0xFC, 0x49, 0xFC, 0x39, 0xE9, 0x94, 0xE7, 0xEA, 0x95,
+    0xFD, 0x49, 0xFC, 0xA6, 0x9E, 0x6E, 0xA5, 0xF4, 0x9F, 0x94, 0xAE, 0x97, 0x70, 0x49, 0xAE, 0xA6,
+    0xAF, 0xE4, 0xFA, 0xAE, 0xA2, 0xAE, 0x3E, 0x2E, 0x4E, 0x1A, 0xD9, 0x4E, 0x1E, 0x4A, 0xDA, 0x1E,
+    0xA1, 0x9F, 0x2F, 0xFD, 0xA2, 0xAF, 0xFC, 0x4F, 0xEA, 0x6A, 0xEA, 0x94, 0x1F, 0xFF, 0xA0, 0x9F,
+    0xFF, 0x90, 0x9A, 0xFA, 0xFA, 0xA3, 0xE1, 0xAD, 0x95, 0xE1, 0xE5, 0xAD, 0xA0, 0x9D, 0xA5, 0xE1,
+    0xE9, 0x5E, 0x1E, 0x5A, 0xD9, 0x0A, 0xDA, 0x5E, 0x1F, 0xC3, 0x9E, 0x1F, 0xC3, 0x9A, 0xA9, 0x29,
+    0xAA, 0x93, 0x73, 0x99, 0x74, 0x9F, 0xC9, 0x71, 0xAF, 0xE7, 0x0A, 0xE9, 0x1D, 0xA6, 0x9E, 0x92,
+    0x9D, 0x6E, 0xA3, 0x9D, 0x59, 0xE9, 0x3A, 0xCA, 0x5F, 0x4D, 0xA5, 0xF3, 0x9D, 0x5A, 0xFA, 0x99,
+    0xAD, 0xA5, 0xFF, 0xE5, 0xAF, 0xFD, 0x95, 0xFF, 0xD9, 0x59, 0xE9, 0x0A, 0xAA, 0x97, 0xF7, 0x49,
+    0xEA, 0x74, 0xAE, 0x75, 0xEA, 0x74, 0x76, 0xAE, 0xA3, 0x9F, 0xE1, 0x9E, 0xA9, 0xAD, 0x90, 0xE3,
+    0x9A, 0x90, 0xDA, 0x69, 0xD9, 0x69, 0xD9, 0x7E, 0x7F, 0x7E, 0xA6, 0xEA, 0x6E, 0x95, 0x9E, 0x69,
+    0xDA, 0x77, 0x00, 0x49, 0xAF, 0xFE, 0x3A, 0xFF, 0xFA, 0x2F, 0xAA, 0xF9, 0x99, 0x92, 0xAE, 0x3E,
+    0x6E, 0x4E, 0x5A, 0xD9, 0x4E, 0x5E, 0x4A, 0xDA, 0x5E, 0xA1, 0x9F, 0x6F, 0xFD, 0xA6, 0xAF, 0xFC,
+    0x70, 0xFE, 0xA7, 0x2A, 0xEA, 0x97, 0x00, 0x0F, 0xFE, 0x99, 0xFF, 0xE0, 0x9A, 0xAA, 0xAE, 0xAA,
+    0xAA, 0x49, 0xDA, 0x70, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x70, 0xAD, 0xA7, 0x0F, 0xC9,
+    0x6F, 0xC7, 0x09, 0x9A, 0x95, 0x2E, 0x1A, 0xD3, 0xDA, 0x2D, 0xA2, 0xD9, 0x2D, 0xA1, 0x9D, 0x92,
+    0xDA, 0x1A, 0xD3, 0xDA, 0x1E, 0x3D, 0xA1, 0xE2, 0x9D, 0x91, 0xDA, 0x2A, 0xD1, 0x9E, 0x99, 0xAE,
+    0x19, 0xFF, 0xA1, 0x9F, 0xF3, 0xFE, 0x94, 0xFA, 0x30, 0x72, 0x9D, 0x77, 0x1A, 0xD7, 0x71, 0xDA,
+    0x77, 0x1D, 0xA7, 0x79, 0xFC, 0x97, 0x3A, 0xFF, 0xC9, 0x70, 0xFF, 0xF7, 0xFA, 0xDA, 0x0A, 0xEA,
+    0x5F, 0x90, 0xD9, 0x1F, 0x4A, 0xE9, 0x09, 0xD2, 0xAE, 0x4E, 0xA1, 0xAD, 0x2A, 0xE3, 0x9E, 0x2E,
+    0x2A, 0xE3, 0xF2, 0xDA, 0x2F, 0x3E, 0x92, 0xD9, 0x2E, 0xA2, 0x9E, 0x91, 0x9D, 0x29, 0xE9, 0x2A,
+    0xE9, 0x1A, 0xD1, 0x9F, 0x3A, 0xF9, 0x0E, 0x9A, 0xFA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0xA4,
+    0x9F, 0xFF, 0xCA, 0x6A, 0xFF, 0xEA, 0x71, 0xAF, 0xEA, 0x76, 0xD9, 0x77, 0x09, 0xD7, 0x71, 0xAD,
+    0x77, 0x1D, 0xA7, 0x77, 0x70, 0x77, 0x70, 0x9D, 0xA6, 0xE5, 0xAF, 0x4E, 0x95, 0xFD, 0x2E, 0x96,
+    0xAF, 0xC9, 0x0E, 0xA7, 0x2F, 0xEA, 0x73, 0xAF, 0xD7, 0x49, 0xFC, 0x76, 0xF7, 0x6A, 0xEA, 0x75,
+    0xAF, 0xC7, 0x4A, 0xFD, 0x73, 0xAF, 0xE9, 0x71, 0x9F, 0x0E, 0xA7, 0x09, 0xF1, 0xFD, 0xA4, 0x9F,
+    0x2A, 0xFC, 0x93, 0x9F, 0x92, 0x9F, 0xC4, 0xF9, 0x49, 0xAE, 0x30, 0x49, 0xC9, 0x71, 0xAC, 0x97,
+    0x1D, 0x97, 0x1D, 0x7F, 0xC1, 0x9C, 0x92, 0xFC, 0x19, 0xD2, 0xDA, 0xD1, 0x9D, 0x19, 0xDA, 0xCA,
+    0x19, 0xD1, 0xAD, 0xAC, 0xA1, 0x9D, 0x1E, 0xAC, 0x91, 0xAD, 0x1E, 0xAC, 0x91, 0xE1, 0xDA, 0xD9,
+    0x1D, 0xA0, 0x9F, 0xC9, 0x9E, 0x90, 0x9F, 0xFD, 0x2F, 0xFC, 0x92, 0xAF, 0xE9, 0x49, 0xAD, 0xA9,
+    0x79, 0xCA, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xD9, 0x71, 0xD7, 0x2D, 0x70, 0x39, 0x99, 0x97,
+    0x29, 0xE9, 0x3E, 0x29, 0xE9, 0x4E, 0x2E, 0xA5, 0xAD, 0x1A, 0xE2, 0x92, 0xAD, 0x1E, 0x19, 0xD2,
+    0xE0, 0x9E, 0x1A, 0xCA, 0x2E, 0x0A, 0xD9, 0x1D, 0x91, 0xAD, 0xA0, 0xAD, 0xA0, 0xAD, 0x90, 0xAE,
+    0x1A, 0xFF, 0xFA, 0x2F, 0xFF, 0x39, 0xFA, 0xFA, 0x77, 0x30, 0x73, 0xE9, 0x74, 0xAE, 0x97, 0x39,
+    0xFA, 0x73, 0xFC, 0xA7, 0x2A, 0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A, 0xDA, 0x1E,
+    0x70, 0xE2, 0xE9, 0x6E, 0xA2, 0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xD2, 0xF6, 0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x97, 0x76, 0xAA, 0xA7, 0x5A,
+    0xE7, 0x5E, 0xA7, 0x49, 0xEA, 0x74, 0xF9, 0x71, 0x77, 0x5A, 0xE9, 0xDA, 0x5F, 0xFA, 0x4E, 0xAA,
+    0xF9, 0x3A, 0xD3, 0xE3, 0x9D, 0x93, 0xE3, 0xAC, 0xA4, 0xE3, 0xD5, 0xE3, 0xD4, 0xAD, 0xA2, 0x9F,
+    0xFD, 0x93, 0xFF, 0xD9, 0x3F, 0xFD, 0x5A, 0xEA, 0x9E, 0x77, 0x77, 0x77, 0x0E, 0x97, 0x19, 0xE9,
+    0x71, 0xAE, 0x72, 0xF7, 0x19, 0xAA, 0xAA, 0x71, 0x76, 0x97, 0x7A, 0xD9, 0x77, 0xC9, 0x75, 0x9D,
+    0x76, 0xD7, 0x77, 0x77, 0x77, 0x73, 0xE9, 0x74, 0xAE, 0x97, 0x39, 0xFA, 0x73, 0xFC, 0xA7, 0x2A,
+    0xDA, 0xE7, 0x19, 0xE9, 0xE7, 0x1E, 0x90, 0xE7, 0x0A, 0xDA, 0x1E, 0x70, 0xE2, 0xE9, 0x6E, 0xA2,
+    0xE9, 0x5A, 0xE3, 0xEA, 0x5F, 0xFE, 0xA4, 0xFF, 0xFC, 0x3A, 0xFF, 0xFC, 0x3F, 0xFF, 0xD2, 0xF6,
+    0xF1, 0x9E, 0xA6, 0xF9, 0x0F, 0x7F, 0x90, 0x71, 0xAC, 0xA7, 0x29, 0xAC, 0x97, 0x2D, 0x72, 0xCA,
+    0x77, 0x77, 0x77, 0x77, 0xAE, 0x9D, 0xA4, 0xFF, 0xA3, 0xEA, 0xAF, 0x92, 0xAD, 0x3E, 0x29, 0xD9,
+    0x3E, 0x2A, 0xCA, 0x4E, 0x2D, 0x5E, 0x2D, 0x4A, 0xDA, 0x19, 0xFF, 0xD9, 0x2F, 0xFD, 0x92, 0xFF,
+    0xD4, 0xAE, 0xA9, 0xE1, 0x77, 0x19, 0x77, 0x1D, 0x77, 0x0D, 0xA7, 0x7A, 0xD7, 0x79, 0xD9, 0x77,
+    0x77, 0x77, 0x77, 0x70, 0xD9, 0x77, 0xAE, 0x97, 0x59, 0xFC, 0xA7, 0x4E, 0x9A, 0xDA, 0x72, 0xE3,
+    0xAD, 0x77, 0x77, 0x1E, 0x97, 0x6A, 0xE9, 0x75, 0x9F, 0xA7, 0x5F, 0xCA, 0x74, 0xAD, 0xAE, 0x73,
+    0x9E, 0x9E, 0x73, 0xE9, 0x0E, 0x72, 0xAD, 0xA1, 0xE7, 0x2E, 0x2E, 0x97, 0x0E, 0xA2, 0xE9, 0x7A,
+    0xE3, 0xEA, 0x7F, 0xFE, 0xA6, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x5F, 0xFF, 0xD4, 0xF6, 0xF3, 0x9E,
+    0xA6, 0xF9, 0x2F, 0x7F, 0x91, 0x77, 0x29, 0x77, 0x2D, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0x79, 0xD5,
+    0xAD, 0x97, 0xAE, 0x77, 0x9F, 0xC7, 0x6E, 0x9E, 0x97, 0x3E, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x6A,
+    0xE9, 0xDA, 0x73, 0xFF, 0xA7, 0x2E, 0xAA, 0xF9, 0x71, 0xAD, 0x3E, 0x71, 0x9D, 0x93, 0xE7, 0x1A,
+    0xCA, 0x4E, 0x71, 0xD5, 0xE7, 0x1D, 0x4A, 0xDA, 0x70, 0x9F, 0xFD, 0x97, 0x1F, 0xFD, 0x97, 0x1F,
+    0xFD, 0x73, 0xAE, 0xA9, 0xE7, 0x00, 0x74, 0xAA, 0xA7, 0x70, 0xAE, 0x77, 0x0F, 0x77, 0x0F, 0x73,
+    0xD9, 0x77, 0xAE, 0x97, 0x59, 0xFC, 0xA7, 0x4E, 0x9A, 0xDA, 0x72, 0xE3, 0xAD, 0x77, 0x77, 0x1E,
+    0x97, 0x6A, 0xE9, 0x75, 0x9F, 0xA7, 0x5F, 0xCA, 0x74, 0xAD, 0xAE, 0x73, 0x9E, 0x9E, 0x73, 0xE9,
+    0x0E, 0x72, 0xAD, 0xA1, 0xE7, 0x2E, 0x2E, 0x97, 0x0E, 0xA2, 0xE9, 0x7A, 0xE3, 0xEA, 0x7F, 0xFE,
+    0xA6, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x5F, 0xFF, 0xD4, 0xF6, 0xF3, 0x9E, 0xA6, 0xF9, 0x2F, 0x7F,
+    0x91, 0x2A, 0xAA, 0x73, 0xAE, 0x73, 0xF7, 0x3F, 0x77, 0x72, 0x9D, 0x73, 0xAE, 0x71, 0x9F, 0xC7,
+    0x0E, 0x9E, 0x95, 0xE2, 0x9D, 0xA7, 0x77, 0x74, 0xAE, 0x9D, 0xA5, 0xFF, 0xA4, 0xEA, 0xAF, 0x93,
+    0xAD, 0x3E, 0x39, 0xD9, 0x3E, 0x3A, 0xCA, 0x4E, 0x3D, 0x5E, 0x3D, 0x4A, 0xDA, 0x29, 0xFF, 0xD9,
+    0x3F, 0xFD, 0x93, 0xFF, 0xD5, 0xAE, 0xA9, 0xE2, 0x77, 0xAC, 0xA7, 0x70, 0x9A, 0xC9, 0x77, 0x0D,
+    0x77, 0x0D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xD9, 0x77, 0xAE, 0x97, 0x59, 0xFC, 0xA7, 0x4E,
+    0x9A, 0xDA, 0x72, 0xE3, 0xAD, 0x77, 0x77, 0x1E, 0x97, 0x6A, 0xE9, 0x75, 0x9F, 0xA7, 0x5F, 0xCA,
+    0x74, 0xAD, 0xAE, 0x73, 0x9E, 0x9E, 0x73, 0xE9, 0x0E, 0x72, 0xAD, 0xA1, 0xE7, 0x2E, 0x2E, 0x97,
+    0x0E, 0xA2, 0xE9, 0x7A, 0xE3, 0xEA, 0x7F, 0xFE, 0xA6, 0xFF, 0xFC, 0x5A, 0xFF, 0xFC, 0x5F, 0xFF,
+    0xD4, 0xF6, 0xF3, 0x9E, 0xA6, 0xF9, 0x2F, 0x7F, 0x91, 0x76, 0x9C, 0xA9, 0x77, 0xAE, 0x77, 0x19,
+    0xC9, 0x77, 0xAD, 0x77, 0xE7, 0x1A, 0xD3, 0xAA, 0x72, 0xF7, 0x6F, 0xD7, 0x4A, 0xDA, 0x9E, 0x97,
+    0x19, 0xDA, 0x29, 0xDA, 0x77, 0x77, 0x77, 0x1A, 0xE9, 0xDA, 0x72, 0xFF, 0xA7, 0x1E, 0xAA, 0xF9,
+    0x70, 0xAD, 0x3E, 0x70, 0x9D, 0x93, 0xE7, 0x0A, 0xCA, 0x4E, 0x70, 0xD5, 0xE7, 0x0D, 0x4A, 0xDA,
+    0x79, 0xFF, 0xD9, 0x70, 0xFF, 0xD9, 0x70, 0xFF, 0xD7, 0x2A, 0xEA, 0x9E, 0x70, 0x77, 0x77, 0x9D,
+    0xA0, 0xAC, 0x97, 0x4F, 0x9A, 0xC9, 0x73, 0x9C, 0xA9, 0xF7, 0x4A, 0xC9, 0x0A, 0xD9, 0x77, 0x77,
+    0x3A, 0xCA, 0x77, 0x1E, 0x97, 0x7F, 0xCA, 0x75, 0xAD, 0xA9, 0xE7, 0x39, 0xDA, 0x2A, 0xD9, 0x77,
+    0x77, 0x1E, 0x97, 0x7A, 0xE9, 0x76, 0x9F, 0xA7, 0x6F, 0xCA, 0x75, 0xAD, 0xAE, 0x74, 0x9E, 0x9E,
+    0x74, 0xE9, 0x0E, 0x73, 0xAD, 0xA1, 0xE7, 0x3E, 0x2E, 0x97, 0x1E, 0xA2, 0xE9, 0x70, 0xAE, 0x3E,
+    0xA7, 0x0F, 0xFE, 0xA7, 0xFF, 0xFC, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD5, 0xF6, 0xF4, 0x9E, 0xA6,
+    0xF9, 0x3F, 0x7F, 0x92, 0x77, 0x69, 0xD9, 0x0A, 0xC7, 0x0F, 0x9D, 0x7A, 0xCA, 0x9E, 0xA7, 0xAC,
+    0x90, 0xAD, 0x77, 0x77, 0x72, 0xDA, 0x73, 0x9E, 0x97, 0x2F, 0xCA, 0x70, 0xE9, 0x9E, 0x6A, 0xD9,
+    0x2A, 0xD9, 0x77, 0x5A, 0xE9, 0xDA, 0x6F, 0xFA, 0x5E, 0xAA, 0xF9, 0x4A, 0xD3, 0xE4, 0x9D, 0x93,
+    0xE4, 0xAC, 0xA4, 0xE4, 0xD5, 0xE4, 0xD4, 0xAD, 0xA3, 0x9F, 0xFD, 0x94, 0xFF, 0xD9, 0x4F, 0xFD,
+    0x6A, 0xEA, 0x9E, 0x30, 0x77, 0x75, 0xD9, 0x76, 0xAE, 0x97, 0x49, 0xFC, 0xA7, 0x3E, 0x9A, 0xDA,
+    0x71, 0xE3, 0xAD, 0x77, 0x77, 0xE9, 0x75, 0xAE, 0x97, 0x49, 0xFA, 0x74, 0xFC, 0xA7, 0x3A, 0xDA,
+    0xE7, 0x29, 0xE9, 0xE7, 0x2E, 0x90, 0xE7, 0x1A, 0xDA, 0x1E, 0x71, 0xE2, 0xE9, 0x7E, 0xA2, 0xE9,
+    0x6A, 0xE3, 0xEA, 0x6F, 0xFE, 0xA5, 0xFF, 0xFC, 0x4A, 0xFF, 0xFC, 0x4F, 0xFF, 0xD3, 0xF6, 0xF2,
+    0x9E, 0xA6, 0xF9, 0x1F, 0x7F, 0x97, 0x77, 0x0A, 0xAA, 0x76, 0xAE, 0x76, 0xEA, 0x75, 0x9E, 0xA7,
+    0x5F, 0x97, 0x20, 0x69, 0xD7, 0x4A, 0xE7, 0x29, 0xFC, 0x71, 0xE9, 0xE9, 0x6E, 0x29, 0xDA, 0x77,
+    0x77, 0x7A, 0xE9, 0xDA, 0x6F, 0xFA, 0x5E, 0xAA, 0xF9, 0x4A, 0xD3, 0xE4, 0x9D, 0x93, 0xE4, 0xAC,
+    0xA4, 0xE4, 0xD5, 0xE4, 0xD4, 0xAD, 0xA3, 0x9F, 0xFD, 0x94, 0xFF, 0xD9, 0x4F, 0xFD, 0x6A, 0xEA,
+    0x9E, 0x77, 0x77, 0x77, 0x4E, 0x97, 0x29, 0xE9, 0x72, 0xAE, 0x73, 0xF7, 0x29, 0xAA, 0xAA, 0x72,
+    0x77, 0x0D, 0x97, 0x70, 0xAD, 0x77, 0x09, 0xD9, 0x77, 0x0D, 0xA7, 0x71, 0x99, 0x77, 0x77, 0x77,
+    0x70, 0xAD, 0x3D, 0xA7, 0x2A, 0xFF, 0x97, 0x29, 0xFE, 0xA7, 0x49, 0xFA, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x4E, 0x97, 0x7A, 0xE9, 0x76, 0x9F, 0xA7, 0x6F, 0xCA, 0x75, 0xAD, 0xAE, 0x74, 0x9E, 0x9E,
+    0x74, 0xE9, 0x0E, 0x73, 0xAD, 0xA1, 0xE7, 0x3E, 0x2E, 0x97, 0x1E, 0xA2, 0xE9, 0x70, 0xAE, 0x3E,
+    0xA7, 0x0F, 0xFE, 0xA7, 0xFF, 0xFC, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD5, 0xF6, 0xF4, 0x9E, 0xA6,
+    0xF9, 0x3F, 0x7F, 0x92, 0x75, 0x97, 0x6D, 0x75, 0xDA, 0x74, 0xAD, 0x74, 0xAD, 0x97, 0x77, 0x77,
+    0x77, 0x4A, 0xD2, 0x9D, 0xA6, 0xFF, 0xC7, 0x9F, 0xE9, 0x70, 0x9F, 0xA7, 0x77, 0x77, 0x77, 0x3A,
+    0xE9, 0xDA, 0x7F, 0xFA, 0x6E, 0xAA, 0xF9, 0x5A, 0xD3, 0xE5, 0x9D, 0x93, 0xE5, 0xAC, 0xA4, 0xE5,
+    0xD5, 0xE5, 0xD4, 0xAD, 0xA4, 0x9F, 0xFD, 0x95, 0xFF, 0xD9, 0x5F, 0xFD, 0x7A, 0xEA, 0x9E, 0x40,
+    0x74, 0x9E, 0x77, 0x1A, 0xE7, 0x71, 0xF7, 0x71, 0x9A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9D,
+    0x3D, 0xA7, 0x2A, 0xFF, 0x97, 0x29, 0xFE, 0xA7, 0x49, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x4E,
+    0x97, 0x7A, 0xE9, 0x76, 0x9F, 0xA7, 0x6F, 0xCA, 0x75, 0xAD, 0xAE, 0x74, 0x9E, 0x9E, 0x74, 0xE9,
+    0x0E, 0x73, 0xAD, 0xA1, 0xE7, 0x3E, 0x2E, 0x97, 0x1E, 0xA2, 0xE9, 0x70, 0xAE, 0x3E, 0xA7, 0x0F,
+    0xFE, 0xA7, 0xFF, 0xFC, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xD5, 0xF6, 0xF4, 0x9E, 0xA6, 0xF9, 0x3F,
+    0x7F, 0x92, 0x70, 0x9A, 0xA9, 0x75, 0xE9, 0x74, 0x9E, 0x97, 0x49, 0xEA, 0x77, 0x77, 0x77, 0x77,
+    0x73, 0xAD, 0x29, 0xDA, 0x6F, 0xFC, 0x79, 0xFE, 0x97, 0x09, 0xFA, 0x77, 0x77, 0x77, 0x73, 0xAE,
+    0x9D, 0xA7, 0xFF, 0xA6, 0xEA, 0xAF, 0x95, 0xAD, 0x3E, 0x59, 0xD9, 0x3E, 0x5A, 0xCA, 0x4E, 0x5D,
+    0x5E, 0x5D, 0x4A, 0xDA, 0x49, 0xFF, 0xD9, 0x5F, 0xFD, 0x95, 0xFF, 0xD7, 0xAE, 0xA9, 0xE4, 0x77,
+    0x09, 0x77, 0x2A, 0xD9, 0x77, 0x2C, 0x97, 0x70, 0x9D, 0x77, 0x1C, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x49, 0xD3, 0xDA, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xEA, 0x74, 0x9F, 0xA9, 0x77, 0x77, 0x77, 0x77,
+    0x74, 0xE9, 0x77, 0xAE, 0x97, 0x69, 0xFA, 0x76, 0xFC, 0xA7, 0x5A, 0xDA, 0xE7, 0x49, 0xE9, 0xE7,
+    0x4E, 0x90, 0xE7, 0x3A, 0xDA, 0x1E, 0x73, 0xE2, 0xE9, 0x71, 0xEA, 0x2E, 0x97, 0x0A, 0xE3, 0xEA,
+    0x70, 0xFF, 0xEA, 0x7F, 0xFF, 0xC6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFD, 0x5F, 0x6F, 0x49, 0xEA, 0x6F,
+    0x93, 0xF7, 0xF9, 0x20, 0x73, 0xAC, 0xA7, 0x5E, 0xA7, 0x6D, 0x74, 0x9D, 0x97, 0x39, 0xDA, 0x74,
+    0x9C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x5D, 0xA2, 0xAD, 0x7F, 0xFC, 0x7F, 0xF7, 0x1A, 0xF9, 0x77,
+    0x77, 0x72, 0xAE, 0x9D, 0xA7, 0xFF, 0xA6, 0xEA, 0xAF, 0x95, 0xAD, 0x3E, 0x59, 0xD9, 0x3E, 0x5A,
+    0xCA, 0x4E, 0x5D, 0x5E, 0x5D, 0x4A, 0xDA, 0x49, 0xFF, 0xD9, 0x5F, 0xFD, 0x95, 0xFF, 0xD7, 0xAE,
+    0xA9, 0xE4, 0x75, 0x9D, 0x90, 0xAA, 0x76, 0xF0, 0xD7, 0x5A, 0xCA, 0xD9, 0xD7, 0x5D, 0x09, 0xE9,
+    0x75, 0xAC, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x76, 0xAD, 0x29, 0xDA, 0x73, 0xAF, 0xF9, 0x73,
+    0x9F, 0xEA, 0x75, 0x9F, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0E, 0x97, 0x70, 0xAE, 0x97, 0x79,
+    0xFA, 0x77, 0xFC, 0xA7, 0x6A, 0xDA, 0xE7, 0x59, 0xE9, 0xE7, 0x5E, 0x90, 0xE7, 0x4A, 0xDA, 0x1E,
+    0x74, 0xE2, 0xE9, 0x72, 0xEA, 0x2E, 0x97, 0x1A, 0xE3, 0xEA, 0x71, 0xFF, 0xEA, 0x70, 0xFF, 0xFC,
+    0x7A, 0xFF, 0xFC, 0x7F, 0xFF, 0xD6, 0xF6, 0xF5, 0x9E, 0xA6, 0xF9, 0x4F, 0x7F, 0x93, 0x77, 0x73,
+    0xAD, 0x1D, 0x71, 0x9F, 0x9D, 0x71, 0xD0, 0xAE, 0x97, 0x1D, 0x1D, 0xA7, 0x77, 0x77, 0x77, 0x77,
+    0x70, 0xAD, 0x29, 0xDA, 0x7F, 0xFC, 0x70, 0x9F, 0xE9, 0x71, 0x9F, 0xA7, 0x77, 0x77, 0x77, 0x7A,
+    0xE9, 0xDA, 0x70, 0xFF, 0xA7, 0xEA, 0xAF, 0x96, 0xAD, 0x3E, 0x69, 0xD9, 0x3E, 0x6A, 0xCA, 0x4E,
+    0x6D, 0x5E, 0x6D, 0x4A, 0xDA, 0x59, 0xFF, 0xD9, 0x6F, 0xFD, 0x96, 0xFF, 0xD7, 0x0A, 0xEA, 0x9E,
+    0x50, 0x77, 0x77, 0xAD, 0x29, 0xDA, 0x72, 0xAF, 0xF9, 0x72, 0x9F, 0xEA, 0x74, 0x9F, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0xE9, 0x77, 0xAE, 0x97, 0x69, 0xFA, 0x76, 0xFC, 0xA7, 0x5A, 0xDA, 0xE7,
+    0x49, 0xE9, 0xE7, 0x4E, 0x90, 0xE7, 0x3A, 0xDA, 0x1E, 0x73, 0xE2, 0xE9, 0x71, 0xEA, 0x2E, 0x97,
+    0x0A, 0xE3, 0xEA, 0x70, 0xFF, 0xEA, 0x7F, 0xFF, 0xC6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFD, 0x5F, 0x6F,
+    0x49, 0xEA, 0x6F, 0x93, 0xF7, 0xF9, 0x77, 0x74, 0xAA, 0xA7, 0x70, 0xAE, 0x77, 0x0E, 0xA7, 0x79,
+    0xEA, 0x77, 0xF9, 0x74, 0x77, 0x71, 0xAD, 0x29, 0xDA, 0x7F, 0xFC, 0x70, 0x9F, 0xE9, 0x71, 0x9F,
+    0xA7, 0x77, 0x77, 0x77, 0x7A, 0xE9, 0xDA, 0x70, 0xFF, 0xA7, 0xEA, 0xAF, 0x96, 0xAD, 0x3E, 0x69,
+    0xD9, 0x3E, 0x6A, 0xCA, 0x4E, 0x6D, 0x5E, 0x6D, 0x4A, 0xDA, 0x59, 0xFF, 0xD9, 0x6F, 0xFD, 0x96,
+    0xFF, 0xD7, 0x0A, 0xEA, 0x9E, 0x77, 0x77, 0x77, 0x74, 0xE9, 0x74, 0x9E, 0x97, 0x4A, 0xE7, 0x5F,
+    0x74, 0x9A, 0xAA, 0xA7, 0x40, 0x5A, 0xAA, 0xAF, 0xE5, 0xAF, 0xFD, 0xA5, 0xFF, 0xE6, 0xE9, 0x74,
+    0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9F, 0xFC, 0x7A, 0xFF, 0xA7, 0xFF, 0xC9, 0x7E, 0xA9, 0x73,
+    0xAE, 0x75, 0xF7, 0x5F, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFE, 0x5A, 0xFF, 0xE5, 0xFF, 0xF4, 0x9F,
+    0xFF, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xA7, 0x59, 0xE7, 0x5A, 0xE7, 0x5F, 0x74, 0xAF, 0x74, 0x6A,
+    0xEA, 0x7A, 0xFE, 0x5A, 0xDA, 0x90, 0x9D, 0x93, 0xAD, 0xA9, 0x99, 0xAD, 0xA3, 0xFF, 0xDA, 0x2A,
+    0xFF, 0xDA, 0x2E, 0x99, 0x99, 0x7E, 0x73, 0xFA, 0xAA, 0xAA, 0xCA, 0x3F, 0xFD, 0x94, 0xFF, 0xC6,
+    0xAF, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x1E, 0x72, 0xAE, 0x72, 0xF7, 0x19, 0xEA, 0x71, 0x9A, 0xAA,
+    0x97, 0x10, 0x73, 0xAC, 0xA7, 0x69, 0xAC, 0x97, 0x6D, 0x76, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0xAA, 0xAA, 0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7,
+    0x49, 0xFF, 0xC7, 0xAF, 0xFA, 0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A, 0xE7, 0x5F, 0x75, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x59, 0xFF, 0xE5, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF, 0xF4, 0x71, 0xD9, 0x72, 0xAA,
+    0xC7, 0x29, 0xCA, 0x72, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0xAE, 0xA6, 0xAF, 0xE4, 0xAD,
+    0xA9, 0x09, 0xD9, 0x2A, 0xDA, 0x99, 0x9A, 0xDA, 0x2F, 0xFD, 0xA1, 0xAF, 0xFD, 0xA1, 0xE9, 0x99,
+    0x96, 0xE7, 0x2F, 0xAA, 0xAA, 0xAC, 0xA2, 0xFF, 0xD9, 0x3F, 0xFC, 0x5A, 0xFA, 0x93, 0x77, 0x73,
+    0xAD, 0x1D, 0x71, 0x9F, 0x0D, 0x71, 0xD9, 0xAE, 0xA7, 0x1D, 0x1E, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0xAA, 0xAA, 0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49, 0xE7, 0x5A, 0xE7, 0x5E, 0xA7,
+    0x49, 0xFF, 0xC7, 0xAF, 0xFA, 0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A, 0xE7, 0x5F, 0x75, 0xFA, 0xAA,
+    0xAA, 0xAA, 0x59, 0xFF, 0xE5, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF, 0xF4, 0x7A, 0xD1, 0xCA, 0x6A,
+    0xEA, 0x9C, 0xA6, 0xD0, 0xF9, 0x6D, 0x09, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA,
+    0x7A, 0xFE, 0x5A, 0xDA, 0x90, 0x9D, 0x93, 0xAD, 0xA9, 0x99, 0xAD, 0xA3, 0xFF, 0xDA, 0x2A, 0xFF,
+    0xDA, 0x2E, 0x99, 0x99, 0x7E, 0x73, 0xFA, 0xAA, 0xAA, 0xCA, 0x3F, 0xFD, 0x94, 0xFF, 0xC6, 0xAF,
+    0xA9, 0x40, 0x77, 0x29, 0x97, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x97, 0x09, 0xD4, 0xDA,
+    0x71, 0xF7, 0x7A, 0xFC, 0x97, 0x49, 0xE9, 0xAD, 0xA7, 0x3E, 0x3E, 0x77, 0x77, 0x77, 0x4A, 0xAA,
+    0xAF, 0xE7, 0x0A, 0xFF, 0xDA, 0x70, 0xFF, 0xE7, 0x1E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x0E,
+    0xA7, 0x79, 0xFF, 0xC7, 0x2A, 0xFF, 0xA7, 0x2F, 0xFC, 0x97, 0x2E, 0xA9, 0x76, 0xAE, 0x77, 0x0F,
+    0x77, 0x0F, 0xAA, 0xAA, 0xAA, 0xA7, 0x09, 0xFF, 0xE7, 0x0A, 0xFF, 0xE7, 0x0F, 0xFF, 0x79, 0xFF,
+    0xF7, 0x77, 0x39, 0x96, 0x9C, 0xA7, 0x19, 0xD6, 0xEA, 0x70, 0xD9, 0x5A, 0xFC, 0x6E, 0x59, 0xE9,
+    0xE9, 0x3A, 0xD6, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0xAE, 0xA7, 0x7A,
+    0xFE, 0x75, 0xAD, 0xA9, 0x09, 0xD9, 0x73, 0xAD, 0xA9, 0x99, 0xAD, 0xA7, 0x3F, 0xFD, 0xA7, 0x2A,
+    0xFF, 0xDA, 0x72, 0xE9, 0x99, 0x97, 0x7E, 0x77, 0x3F, 0xAA, 0xAA, 0xAC, 0xA7, 0x3F, 0xFD, 0x97,
+    0x4F, 0xFC, 0x76, 0xAF, 0xA9, 0x74, 0x76, 0xAA, 0xA7, 0x72, 0xAE, 0x77, 0x2F, 0x77, 0x2F, 0x70,
+    0x9D, 0x77, 0x2F, 0x77, 0x0A, 0xFC, 0x97, 0x59, 0xE9, 0xAD, 0xA7, 0x4E, 0x3E, 0x77, 0x77, 0x77,
+    0x7A, 0xAA, 0xAF, 0xE7, 0x1A, 0xFF, 0xDA, 0x71, 0xFF, 0xE7, 0x2E, 0x97, 0x70, 0x9E, 0x77, 0x1A,
+    0xE7, 0x71, 0xEA, 0x77, 0x09, 0xFF, 0xC7, 0x3A, 0xFF, 0xA7, 0x3F, 0xFC, 0x97, 0x3E, 0xA9, 0x77,
+    0xAE, 0x77, 0x1F, 0x77, 0x1F, 0xAA, 0xAA, 0xAA, 0xA7, 0x19, 0xFF, 0xE7, 0x1A, 0xFF, 0xE7, 0x1F,
+    0xFF, 0x70, 0x9F, 0xFF, 0x70, 0x3E, 0x97, 0x3E, 0x97, 0x29, 0xEA, 0x72, 0xAD, 0xA9, 0x71, 0xEA,
+    0x71, 0xAF, 0xC7, 0x9E, 0x9E, 0x6D, 0xA2, 0xAD, 0x97, 0x77, 0x77, 0x77, 0x72, 0xAE, 0xA7, 0xAF,
+    0xE5, 0xAD, 0xA9, 0x09, 0xD9, 0x3A, 0xDA, 0x99, 0x9A, 0xDA, 0x3F, 0xFD, 0xA2, 0xAF, 0xFD, 0xA2,
+    0xE9, 0x99, 0x97, 0xE7, 0x3F, 0xAA, 0xAA, 0xAC, 0xA3, 0xFF, 0xD9, 0x4F, 0xFC, 0x6A, 0xFA, 0x94,
+    0x77, 0x09, 0xD7, 0x71, 0x99, 0xCA, 0x77, 0x1A, 0xC9, 0x77, 0x0A, 0xC9, 0x70, 0x9D, 0x77, 0x1F,
+    0x77, 0xAF, 0xC9, 0x74, 0x9E, 0x9A, 0xDA, 0x73, 0xE3, 0xE7, 0x77, 0x77, 0x74, 0xAA, 0xAA, 0xFE,
+    0x70, 0xAF, 0xFD, 0xA7, 0x0F, 0xFE, 0x71, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xE7, 0x70, 0xEA, 0x77,
+    0x9F, 0xFC, 0x72, 0xAF, 0xFA, 0x72, 0xFF, 0xC9, 0x72, 0xEA, 0x97, 0x6A, 0xE7, 0x70, 0xF7, 0x70,
+    0xFA, 0xAA, 0xAA, 0xAA, 0x70, 0x9F, 0xFE, 0x70, 0xAF, 0xFE, 0x70, 0xFF, 0xF7, 0x9F, 0xFF, 0x70,
+    0x76, 0xAD, 0x97, 0x7F, 0x77, 0x1A, 0xC7, 0x70, 0xDA, 0x77, 0xE7, 0x1D, 0xA3, 0xC9, 0x71, 0x9E,
+    0xA7, 0x6F, 0xD7, 0x4E, 0xA9, 0xE9, 0x71, 0xAD, 0x92, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x1A, 0xEA, 0x74, 0xAF, 0xE7, 0x2A, 0xDA, 0x90, 0x9D, 0x97, 0x0A, 0xDA, 0x99, 0x9A, 0xDA, 0x70,
+    0xFF, 0xDA, 0x7A, 0xFF, 0xDA, 0x7E, 0x99, 0x99, 0x74, 0xE7, 0x70, 0xFA, 0xAA, 0xAA, 0xCA, 0x70,
+    0xFF, 0xD9, 0x71, 0xFF, 0xC7, 0x3A, 0xFA, 0x97, 0x10, 0x75, 0x9A, 0x72, 0x9D, 0x90, 0xAC, 0x72,
+    0xF9, 0xD7, 0x1A, 0xCA, 0x9E, 0xA7, 0x1A, 0xC9, 0x0A, 0xCA, 0x77, 0x77, 0x77, 0x0D, 0xA7, 0x59,
+    0xE9, 0x74, 0xFC, 0xA7, 0x2E, 0x99, 0xE7, 0x0A, 0xD9, 0x2A, 0xD9, 0x77, 0x7A, 0xAA, 0xAF, 0xE5,
+    0xAF, 0xFD, 0xA5, 0xFF, 0xE6, 0xE9, 0x74, 0x9E, 0x75, 0xAE, 0x75, 0xEA, 0x74, 0x9F, 0xFC, 0x7A,
+    0xFF, 0xA7, 0xFF, 0xC9, 0x7E, 0xA9, 0x73, 0xAE, 0x75, 0xF7, 0x5F, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F,
+    0xFE, 0x5A, 0xFF, 0xE5, 0xFF, 0xF4, 0x9F, 0xFF, 0x40, 0x72, 0xAC, 0xA0, 0x9A, 0x97, 0x1A, 0xE9,
+    0xAC, 0xA7, 0x1D, 0x9F, 0x71, 0x9C, 0xA0, 0xAD, 0x97, 0x77, 0x77, 0x29, 0xCA, 0x76, 0xEA, 0x74,
+    0xAF, 0xC7, 0x29, 0xE9, 0xE9, 0x70, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x1A, 0xEA,
+    0x72, 0xAF, 0xE7, 0x0A, 0xDA, 0x90, 0x9D, 0x96, 0xAD, 0xA9, 0x99, 0xAD, 0xA6, 0xFF, 0xDA, 0x5A,
+    0xFF, 0xDA, 0x5E, 0x99, 0x99, 0x72, 0xE7, 0x6F, 0xAA, 0xAA, 0xAC, 0xA6, 0xFF, 0xD9, 0x7F, 0xFC,
+    0x71, 0xAF, 0xA9, 0x70, 0x77, 0x71, 0x9D, 0x76, 0xF7, 0x4A, 0xFC, 0x97, 0x19, 0xE9, 0xAD, 0xA7,
+    0x0E, 0x3E, 0x77, 0x77, 0x73, 0xAA, 0xAA, 0xFE, 0x5A, 0xFF, 0xDA, 0x5F, 0xFE, 0x6E, 0x97, 0x49,
+    0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x49, 0xFF, 0xC7, 0xAF, 0xFA, 0x7F, 0xFC, 0x97, 0xEA, 0x97, 0x3A,
+    0xE7, 0x5F, 0x75, 0xFA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xE5, 0xAF, 0xFE, 0x5F, 0xFF, 0x49, 0xFF,
+    0xF7, 0x77, 0x77, 0x77, 0x49, 0xAA, 0x75, 0x9E, 0x75, 0xAE, 0x75, 0xF7, 0x4A, 0xF7, 0x40, 0x69,
+    0xCA, 0x74, 0xEA, 0x72, 0xAF, 0xC7, 0x09, 0xE9, 0xE9, 0x6D, 0xA2, 0xAD, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0xAE, 0xA7, 0x0A, 0xFE, 0x6A, 0xDA, 0x90, 0x9D, 0x94, 0xAD, 0xA9, 0x99, 0xAD, 0xA4, 0xFF,
+    0xDA, 0x3A, 0xFF, 0xDA, 0x3E, 0x99, 0x99, 0x70, 0xE7, 0x4F, 0xAA, 0xAA, 0xAC, 0xA4, 0xFF, 0xD9,
+    0x5F, 0xFC, 0x7A, 0xFA, 0x97, 0x77, 0x77, 0x77, 0x76, 0xE7, 0x3A, 0xE7, 0x3F, 0x72, 0x9E, 0xA7,
+    0x29, 0xAA, 0xA9, 0x72, 0x70, 0x97, 0x1A, 0xD9, 0x71, 0xC9, 0x79, 0xD7, 0x0C, 0xA7, 0x77, 0x77,
+    0x76, 0xAD, 0xA7, 0xF7, 0xEA, 0x7E, 0x96, 0x9E, 0x7A, 0xDA, 0x7E, 0x97, 0xE7, 0x9E, 0x7E, 0xA7,
+    0xE9, 0x69, 0xE9, 0x6A, 0xE7, 0xF6, 0x9E, 0xA6, 0xAE, 0xA6, 0xF9, 0x6A, 0xE6, 0x69, 0x7A, 0xD9,
+    0x7C, 0xA5, 0x9D, 0x6A, 0xA7, 0x77, 0x73, 0xAC, 0xA6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE5,
+    0x9D, 0xA5, 0xAD, 0x95, 0xE5, 0x9E, 0x5A, 0xE5, 0xAD, 0xA4, 0x71, 0xAD, 0xA7, 0x2F, 0x72, 0xEA,
+    0x72, 0xE9, 0x71, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9E, 0x72, 0xEA, 0x72, 0xE9,
+    0x71, 0x9E, 0x97, 0x1A, 0xE7, 0x2F, 0x71, 0x9E, 0xA7, 0x1A, 0xEA, 0x71, 0xF9, 0x71, 0xAE, 0x77,
+    0x77, 0x77, 0x77, 0x3E, 0x72, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71, 0xAA, 0xAA, 0x97, 0x00, 0x70,
+    0xE9, 0x79, 0xE7, 0x0F, 0x70, 0xF7, 0x9A, 0xAA, 0x97, 0x77, 0x70, 0xAC, 0xA7, 0x1E, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0x09, 0xE7, 0x0A,
+    0xE7, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x73, 0xE7, 0x09, 0xE7, 0x0F, 0x79, 0xF7, 0x9A, 0xAA, 0x97,
+    0x70, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE,
+    0x96, 0xAE, 0x4E, 0xA7, 0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E,
+    0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF,
+    0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x72, 0x9E, 0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7A, 0xE9, 0x77, 0xAA, 0xAA, 0x77, 0x69,
+    0xAE, 0xA7, 0x0A, 0xFE, 0x6F, 0xAA, 0xEA, 0x4A, 0xE3, 0xE4, 0xE4, 0xE3, 0xAD, 0x94, 0xE3, 0xE4,
+    0xAD, 0xA3, 0xEA, 0x19, 0xF4, 0xFF, 0xDA, 0x4A, 0xFF, 0xC6, 0xFE, 0xA7, 0x0A, 0xEA, 0x97, 0x77,
+    0x77, 0x77, 0xAA, 0xA7, 0x3A, 0xE7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0xF9, 0x71, 0x75, 0x97, 0x72,
+    0xAD, 0x97, 0x72, 0xC9, 0x77, 0x09, 0xD7, 0x71, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x59, 0xFC, 0x97,
+    0x3A, 0xFF, 0xC7, 0x1F, 0xFF, 0x7F, 0xA3, 0xAE, 0xA5, 0xF9, 0x5F, 0x4A, 0xE9, 0x6A, 0xE4, 0xEA,
+    0x7A, 0xE3, 0x9E, 0x70, 0xAE, 0x3F, 0x70, 0xF3, 0xE9, 0x70, 0xEA, 0x29, 0xE9, 0x7A, 0xE9, 0x2A,
+    0xE9, 0x69, 0xF3, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x3A, 0xFF, 0xFE, 0x4A, 0xFF, 0xFD, 0x95, 0xFF,
+    0xFC, 0xA6, 0x9F, 0xFE, 0xA7, 0x1A, 0xFD, 0xA9, 0x77, 0x74, 0x71, 0x97, 0x3A, 0xD7, 0x4C, 0x97,
+    0x19, 0xD7, 0x2C, 0xA7, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x6A, 0xFE, 0x4F, 0xAA, 0xEA, 0x2A, 0xE3,
+    0xE2, 0xE4, 0xE1, 0xAD, 0x94, 0xE1, 0xE4, 0xAD, 0xA1, 0xEA, 0x19, 0xF2, 0xFF, 0xDA, 0x2A, 0xFF,
+    0xC4, 0xFE, 0xA6, 0xAE, 0xA9, 0x40, 0x77, 0x77, 0x1D, 0x97, 0x73, 0xAE, 0x96, 0xD7, 0x09, 0xFC,
+    0xA4, 0xDA, 0x70, 0xE9, 0xAD, 0xA2, 0xAD, 0x70, 0xE3, 0xAD, 0x09, 0xD9, 0x77, 0x39, 0x99, 0x73,
+    0x9F, 0xC9, 0x76, 0xAF, 0xFC, 0x74, 0xFF, 0xF7, 0x2F, 0xA3, 0xAE, 0xA7, 0x0F, 0x95, 0xF7, 0xAE,
+    0x96, 0xAE, 0x7E, 0xA7, 0xAE, 0x69, 0xE7, 0x0A, 0xE6, 0xF7, 0x0F, 0x6E, 0x97, 0x0E, 0xA5, 0x9E,
+    0x97, 0xAE, 0x95, 0xAE, 0x96, 0x9F, 0x6A, 0xFA, 0x91, 0x99, 0xFC, 0xA6, 0xAF, 0xFF, 0xE7, 0xAF,
+    0xFF, 0xD9, 0x70, 0xFF, 0xFC, 0xA7, 0x19, 0xFF, 0xEA, 0x74, 0xAF, 0xDA, 0x97, 0x77, 0x72, 0x77,
+    0x19, 0xD7, 0x71, 0x9D, 0x69, 0xD7, 0x0D, 0xA6, 0xF6, 0xE6, 0xAF, 0xC9, 0x49, 0x96, 0x9E, 0x9A,
+    0xDA, 0x74, 0xE3, 0xAD, 0x77, 0x77, 0x39, 0xAE, 0xA7, 0x6A, 0xFE, 0x74, 0xFA, 0xAE, 0xA7, 0x2A,
+    0xE3, 0xE7, 0x2E, 0x4E, 0x71, 0xAD, 0x94, 0xE7, 0x1E, 0x4A, 0xDA, 0x71, 0xEA, 0x19, 0xF7, 0x2F,
+    0xFD, 0xA7, 0x2A, 0xFF, 0xC7, 0x4F, 0xEA, 0x76, 0xAE, 0xA9, 0x74, 0x59, 0xE7, 0x71, 0xAE, 0x77,
+    0x1F, 0x77, 0x1A, 0xE7, 0x70, 0xFA, 0x76, 0xAF, 0xD7, 0x49, 0xE0, 0x9E, 0x73, 0xAC, 0xA3, 0x9D,
+    0x77, 0x77, 0x19, 0xFC, 0x97, 0x3A, 0xFF, 0xC7, 0x1F, 0xFF, 0x7F, 0xA3, 0xAE, 0xA5, 0xF9, 0x5F,
+    0x4A, 0xE9, 0x6A, 0xE4, 0xEA, 0x7A, 0xE3, 0x9E, 0x70, 0xAE, 0x3F, 0x70, 0xF3, 0xE9, 0x70, 0xEA,
+    0x29, 0xE9, 0x7A, 0xE9, 0x2A, 0xE9, 0x69, 0xF3, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x3A, 0xFF, 0xFE,
+    0x4A, 0xFF, 0xFD, 0x95, 0xFF, 0xFC, 0xA6, 0x9F, 0xFE, 0xA7, 0x1A, 0xFD, 0xA9, 0x77, 0x74, 0x29,
+    0xAA, 0x97, 0x2E, 0x97, 0x19, 0xE9, 0x71, 0x9E, 0xA7, 0x76, 0x9D, 0x72, 0xF7, 0x0A, 0xFC, 0x95,
+    0x9E, 0x9A, 0xDA, 0x4E, 0x3A, 0xD7, 0x73, 0x9A, 0xEA, 0x6A, 0xFE, 0x4F, 0xAA, 0xEA, 0x2A, 0xE3,
+    0xE2, 0xE4, 0xE1, 0xAD, 0x94, 0xE1, 0xE4, 0xAD, 0xA1, 0xEA, 0x19, 0xF2, 0xFF, 0xDA, 0x2A, 0xFF,
+    0xC4, 0xFE, 0xA6, 0xAE, 0xA9, 0x40, 0x77, 0x99, 0x77, 0x2D, 0xA7, 0x72, 0xAC, 0x77, 0x1D, 0x97,
+    0x3D, 0x91, 0x9C, 0x97, 0x3A, 0xE9, 0x76, 0x9F, 0xCA, 0x75, 0xE9, 0xAD, 0xA7, 0x3E, 0x3A, 0xD7,
+    0x77, 0x71, 0x9F, 0xC9, 0x73, 0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4,
+    0xAE, 0x96, 0xAE, 0x4E, 0xA7, 0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2,
+    0x9E, 0x97, 0xAE, 0x92, 0xAE, 0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4,
+    0xAF, 0xFF, 0xD9, 0x5F, 0xFF, 0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x75,
+    0x9D, 0x97, 0x6A, 0xE9, 0x77, 0xAC, 0x97, 0x59, 0xDA, 0x79, 0xD3, 0xD7, 0x1E, 0xA7, 0x5A, 0xFC,
+    0x73, 0x9E, 0x9E, 0x97, 0x1E, 0x29, 0xDA, 0x77, 0x77, 0x76, 0x9A, 0xEA, 0x73, 0xAF, 0xE7, 0x1F,
+    0xAA, 0xEA, 0x7A, 0xE3, 0xE7, 0xE4, 0xE6, 0xAD, 0x94, 0xE6, 0xE4, 0xAD, 0xA6, 0xEA, 0x19, 0xF7,
+    0xFF, 0xDA, 0x7A, 0xFF, 0xC7, 0x1F, 0xEA, 0x73, 0xAE, 0xA9, 0x71, 0x77, 0x76, 0x9D, 0x90, 0xAC,
+    0x97, 0x4F, 0x0D, 0x74, 0x9C, 0xA9, 0xF7, 0x4A, 0xC9, 0x0E, 0x97, 0x77, 0x73, 0xD9, 0x77, 0x1E,
+    0x97, 0x7F, 0xCA, 0x75, 0xAD, 0xAA, 0xE7, 0x39, 0xDA, 0x2A, 0xD9, 0x77, 0x77, 0x9F, 0xC9, 0x73,
+    0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7,
+    0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE,
+    0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x40, 0x59, 0xD9, 0x09, 0xA7, 0xF0, 0xAC,
+    0x95, 0x9C, 0xAA, 0xC9, 0xD6, 0xD9, 0x9E, 0xA6, 0xAC, 0x90, 0xAC, 0xA7, 0x77, 0x0D, 0x97, 0x29,
+    0xE9, 0x71, 0xFC, 0xA7, 0xAD, 0xAA, 0xDA, 0x5A, 0xD9, 0x2A, 0xD7, 0x74, 0x9A, 0xEA, 0x7A, 0xFE,
+    0x5F, 0xAA, 0xEA, 0x3A, 0xE3, 0xE3, 0xE4, 0xE2, 0xAD, 0x94, 0xE2, 0xE4, 0xAD, 0xA2, 0xEA, 0x19,
+    0xF3, 0xFF, 0xDA, 0x3A, 0xFF, 0xC5, 0xFE, 0xA7, 0xAE, 0xA9, 0x50, 0x77, 0x76, 0xD9, 0x77, 0x0A,
+    0xE9, 0x76, 0x9F, 0xCA, 0x75, 0xE9, 0xAD, 0xA7, 0x3E, 0x3A, 0xD7, 0x77, 0x71, 0x9F, 0xC9, 0x73,
+    0xAF, 0xFC, 0x71, 0xFF, 0xF7, 0xFA, 0x3A, 0xEA, 0x5F, 0x95, 0xF4, 0xAE, 0x96, 0xAE, 0x4E, 0xA7,
+    0xAE, 0x39, 0xE7, 0x0A, 0xE3, 0xF7, 0x0F, 0x3E, 0x97, 0x0E, 0xA2, 0x9E, 0x97, 0xAE, 0x92, 0xAE,
+    0x96, 0x9F, 0x3A, 0xFA, 0x91, 0x99, 0xFC, 0xA3, 0xAF, 0xFF, 0xE4, 0xAF, 0xFF, 0xD9, 0x5F, 0xFF,
+    0xCA, 0x69, 0xFF, 0xEA, 0x71, 0xAF, 0xDA, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9E,
+    0x77, 0x0F, 0x77, 0x9E, 0xA7, 0x7A, 0xE9, 0x77, 0xAA, 0xAA, 0x77, 0x77, 0x49, 0xD7, 0x3F, 0x71,
+    0xAF, 0xC9, 0x69, 0xE9, 0xAD, 0xA5, 0xE3, 0xAD, 0x77, 0x59, 0xAE, 0xA7, 0xAF, 0xE5, 0xFA, 0xAE,
+    0xA3, 0xAE, 0x3E, 0x3E, 0x4E, 0x2A, 0xD9, 0x4E, 0x2E, 0x4A, 0xDA, 0x2E, 0xA1, 0x9F, 0x3F, 0xFD,
+    0xA3, 0xAF, 0xFC, 0x5F, 0xEA, 0x7A, 0xEA, 0x97, 0x77, 0x77, 0x77, 0x72, 0xAD, 0xA7, 0x2E, 0x97,
+    0x1A, 0xE9, 0x71, 0xF7, 0x2A, 0xAA, 0xA7, 0x10, 0x77, 0xAC, 0xA7, 0x74, 0x9D, 0x77, 0x5D, 0x97,
+    0x74, 0xE7, 0x75, 0x99, 0x77, 0x76, 0xCA, 0x77, 0x6D, 0x71, 0x9F, 0xC9, 0x4A, 0xD7, 0xAF, 0xFC,
+    0x2A, 0xDA, 0x6F, 0xFF, 0x09, 0xE6, 0xFA, 0x3A, 0xEA, 0x0C, 0xA6, 0xF9, 0x5F, 0x70, 0xAE, 0x96,
+    0xAE, 0x70, 0xEA, 0x7A, 0xE7, 0x9E, 0x70, 0xAE, 0x7F, 0x70, 0xF7, 0xE9, 0x70, 0xEA, 0x69, 0xE9,
+    0x7A, 0xE9, 0x6A, 0xE9, 0x69, 0xF7, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x7A, 0xFF, 0xFE, 0x70, 0xAF,
+    0xFF, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x29, 0xFF, 0xEA, 0x75, 0xAF, 0xDA, 0x97, 0x77, 0x74, 0x71,
+    0xD9, 0x74, 0xAD, 0x74, 0x9D, 0x75, 0xDA, 0x75, 0x99, 0x77, 0x4A, 0x77, 0xD5, 0x9A, 0xEA, 0x1A,
+    0xD4, 0xAF, 0xE9, 0xD9, 0x3F, 0xAA, 0xFD, 0x3A, 0xE3, 0xEA, 0x4E, 0x4E, 0x4A, 0xD9, 0x4E, 0x4E,
+    0x4A, 0xDA, 0x4E, 0xA1, 0x9F, 0x5F, 0xFD, 0xA5, 0xAF, 0xFC, 0x7F, 0xEA, 0x71, 0xAE, 0xA9, 0x70,
+    0x74, 0xE9, 0x77, 0x49, 0xE9, 0x77, 0x4A, 0xE9, 0x77, 0x49, 0xAA, 0xA7, 0x77, 0x77, 0x74, 0xC9,
+    0x77, 0x6D, 0x71, 0x9F, 0xC9, 0x4A, 0xD7, 0xAF, 0xFC, 0x2A, 0xDA, 0x6F, 0xFF, 0x09, 0xE6, 0xFA,
+    0x3A, 0xEA, 0x0C, 0xA6, 0xF9, 0x5F, 0x70, 0xAE, 0x96, 0xAE, 0x70, 0xEA, 0x7A, 0xE7, 0x9E, 0x70,
+    0xAE, 0x7F, 0x70, 0xF7, 0xE9, 0x70, 0xEA, 0x69, 0xE9, 0x7A, 0xE9, 0x6A, 0xE9, 0x69, 0xF7, 0xAF,
+    0xA9, 0x19, 0x9F, 0xCA, 0x7A, 0xFF, 0xFE, 0x70, 0xAF, 0xFF, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x29,
+    0xFF, 0xEA, 0x75, 0xAF, 0xDA, 0x97, 0x77, 0x74, 0x59, 0xE7, 0x5A, 0xE7, 0x5F, 0x75, 0x9A, 0xAA,
+    0x77, 0x77, 0x29, 0x77, 0xD5, 0x9A, 0xEA, 0x1A, 0xD4, 0xAF, 0xE9, 0xD9, 0x3F, 0xAA, 0xFD, 0x3A,
+    0xE3, 0xEA, 0x4E, 0x4E, 0x4A, 0xD9, 0x4E, 0x4E, 0x4A, 0xDA, 0x4E, 0xA1, 0x9F, 0x5F, 0xFD, 0xA5,
+    0xAF, 0xFC, 0x7F, 0xEA, 0x71, 0xAE, 0xA9, 0x70, 0x77, 0x99, 0x77, 0x59, 0xD9, 0x77, 0x6A, 0xA7,
+    0x74, 0x9D, 0x77, 0x5A, 0xA7, 0x77, 0x77, 0x76, 0xA9, 0x77, 0x6D, 0x71, 0x9F, 0xC9, 0x4A, 0xD7,
+    0xAF, 0xFC, 0x2A, 0xDA, 0x6F, 0xFF, 0x09, 0xE6, 0xFA, 0x3A, 0xEA, 0x0C, 0xA6, 0xF9, 0x5F, 0x70,
+    0xAE, 0x96, 0xAE, 0x70, 0xEA, 0x7A, 0xE7, 0x9E, 0x70, 0xAE, 0x7F, 0x70, 0xF7, 0xE9, 0x70, 0xEA,
+    0x69, 0xE9, 0x7A, 0xE9, 0x6A, 0xE9, 0x69, 0xF7, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x7A, 0xFF, 0xFE,
+    0x70, 0xAF, 0xFF, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x29, 0xFF, 0xEA, 0x75, 0xAF, 0xDA, 0x97, 0x77,
+    0x74, 0x71, 0x97, 0x6A, 0xD7, 0x7C, 0x97, 0x49, 0xD7, 0x5C, 0xA7, 0x77, 0x74, 0x97, 0x7D, 0x59,
+    0xAE, 0xA1, 0xAD, 0x4A, 0xFE, 0x9D, 0x93, 0xFA, 0xAF, 0xD3, 0xAE, 0x3E, 0xA4, 0xE4, 0xE4, 0xAD,
+    0x94, 0xE4, 0xE4, 0xAD, 0xA4, 0xEA, 0x19, 0xF5, 0xFF, 0xDA, 0x5A, 0xFF, 0xC7, 0xFE, 0xA7, 0x1A,
+    0xEA, 0x97, 0x77, 0x77, 0x59, 0xDA, 0x0A, 0xC9, 0x77, 0x0F, 0x9D, 0x77, 0x09, 0xCA, 0x9F, 0x77,
+    0x0A, 0xC9, 0x0A, 0xD7, 0x77, 0x77, 0x74, 0xA9, 0x77, 0x6D, 0x71, 0x9F, 0xC9, 0x4A, 0xD7, 0xAF,
+    0xFC, 0x2A, 0xDA, 0x6F, 0xFF, 0x09, 0xE6, 0xFA, 0x3A, 0xEA, 0x0C, 0xA6, 0xF9, 0x5F, 0x70, 0xAE,
+    0x96, 0xAE, 0x70, 0xEA, 0x7A, 0xE7, 0x9E, 0x70, 0xAE, 0x7F, 0x70, 0xF7, 0xE9, 0x70, 0xEA, 0x69,
+    0xE9, 0x7A, 0xE9, 0x6A, 0xE9, 0x69, 0xF7, 0xAF, 0xA9, 0x19, 0x9F, 0xCA, 0x7A, 0xFF, 0xFE, 0x70,
+    0xAF, 0xFF, 0xD9, 0x71, 0xFF, 0xFC, 0xA7, 0x29, 0xFF, 0xEA, 0x75, 0xAF, 0xDA, 0x97, 0x77, 0x74,
+    0x77, 0x79, 0xD1, 0xD7, 0x09, 0xF0, 0xD7, 0x0A, 0xC9, 0xAE, 0xA7, 0x0D, 0x1E, 0x77, 0x77, 0x77,
+    0x29, 0xA9, 0x76, 0xD5, 0x9A, 0xEA, 0x1A, 0xD4, 0xAF, 0xE9, 0xD9, 0x3F, 0xAA, 0xFD, 0x3A, 0xE3,
+    0xEA, 0x4E, 0x4E, 0x4A, 0xD9, 0x4E, 0x4E, 0x4A, 0xDA, 0x4E, 0xA1, 0x9F, 0x5F, 0xFD, 0xA5, 0xAF,
+    0xFC, 0x7F, 0xEA, 0x71, 0xAE, 0xA9, 0x70, 0x77, 0x5A, 0x97, 0x76, 0xD7, 0x19, 0xFC, 0x94, 0xAD,
+    0x7A, 0xFF, 0xC2, 0xAD, 0xA6, 0xFF, 0xF0, 0x9E, 0x6F, 0xA3, 0xAE, 0xA0, 0xCA, 0x6F, 0x95, 0xF7,
+    0x0A, 0xE9, 0x6A, 0xE7, 0x0E, 0xA7, 0xAE, 0x79, 0xE7, 0x0A, 0xE7, 0xF7, 0x0F, 0x7E, 0x97, 0x0E,
+    0xA6, 0x9E, 0x97, 0xAE, 0x96, 0xAE, 0x96, 0x9F, 0x7A, 0xFA, 0x91, 0x99, 0xFC, 0xA7, 0xAF, 0xFF,
+    0xE7, 0x0A, 0xFF, 0xFD, 0x97, 0x1F, 0xFF, 0xCA, 0x72, 0x9F, 0xFE, 0xA7, 0x5A, 0xFD, 0xA9, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9E, 0x77, 0x4F, 0x77, 0x39, 0xEA, 0x77, 0x3A,
+    0xE9, 0x77, 0x3A, 0xAA, 0xA7, 0x73, 0x77, 0x97, 0x71, 0xD7, 0x9A, 0xEA, 0x1A, 0xD6, 0xAF, 0xE9,
+    0xD9, 0x5F, 0xAA, 0xFD, 0x5A, 0xE3, 0xEA, 0x6E, 0x4E, 0x6A, 0xD9, 0x4E, 0x6E, 0x4A, 0xDA, 0x6E,
+    0xA1, 0x9F, 0x7F, 0xFD, 0xA7, 0xAF, 0xFC, 0x71, 0xFE, 0xA7, 0x3A, 0xEA, 0x97, 0x77, 0x77, 0x77,
+    0x73, 0xAA, 0xA7, 0x6A, 0xE7, 0x6E, 0xA7, 0x59, 0xEA, 0x75, 0xF9, 0x74, 0x4F, 0xA4, 0xAF, 0x5F,
+    0x94, 0xFA, 0x49, 0xF5, 0xF9, 0x4A, 0xF4, 0x9F, 0x5A, 0xE9, 0x4A, 0xEA, 0x5F, 0x5F, 0x95, 0xF5,
+    0xF5, 0x9E, 0xA4, 0x9F, 0x5A, 0xE9, 0x4A, 0xE9, 0x5F, 0x5F, 0x6E, 0xA5, 0xF5, 0x9E, 0x94, 0x9E,
+    0xA5, 0xAE, 0xA3, 0x9F, 0x6A, 0xFF, 0xFC, 0x6F, 0xFF, 0xC9, 0x6F, 0xFF, 0xC7, 0x9F, 0xFE, 0x71,
+    0xAF, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5E, 0x77, 0x0A, 0xE7, 0x70, 0xF7, 0x7A,
+    0xEA, 0x77, 0x9A, 0xAA, 0x97, 0x40, 0x39, 0xD9, 0x39, 0xDA, 0x3A, 0xD4, 0xAD, 0x93, 0xAD, 0x4E,
+    0x4E, 0x39, 0xE4, 0xDA, 0x3A, 0xDA, 0x39, 0xD9, 0x3E, 0xA3, 0xAD, 0x92, 0x9E, 0x93, 0xAD, 0x3F,
+    0x4F, 0xA9, 0xFC, 0x4F, 0xFD, 0xA4, 0xAF, 0xFC, 0x95, 0xAF, 0xAE, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x4E, 0x73, 0xAE, 0x73, 0xF7, 0x29, 0xF7, 0x29, 0xAA, 0xA9, 0x72, 0x75, 0x99, 0x77, 0x19, 0xDA,
+    0x77, 0x2A, 0xA7, 0x71, 0xD7, 0x71, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0xFA, 0x4A, 0xF5,
+    0xF9, 0x4F, 0xA4, 0x9F, 0x5F, 0x94, 0xAF, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0xA5, 0xF5, 0xF9, 0x5F,
+    0x5F, 0x59, 0xEA, 0x49, 0xF5, 0xAE, 0x94, 0xAE, 0x95, 0xF5, 0xF6, 0xEA, 0x5F, 0x59, 0xE9, 0x49,
+    0xEA, 0x5A, 0xEA, 0x39, 0xF6, 0xAF, 0xFF, 0xC6, 0xFF, 0xFC, 0x96, 0xFF, 0xFC, 0x79, 0xFF, 0xE7,
+    0x1A, 0xFF, 0xA7, 0x77, 0x40, 0x71, 0x97, 0x3E, 0x73, 0x9C, 0x72, 0xAC, 0xA7, 0x2C, 0xA7, 0x77,
+    0x77, 0x69, 0xD9, 0x39, 0xDA, 0x1A, 0xD4, 0xAD, 0x91, 0xAD, 0x4E, 0x2E, 0x39, 0xE2, 0xDA, 0x3A,
+    0xDA, 0x19, 0xD9, 0x3E, 0xA1, 0xAD, 0x92, 0x9E, 0x91, 0xAD, 0x3F, 0x2F, 0xA9, 0xFC, 0x2F, 0xFD,
+    0xA2, 0xAF, 0xFC, 0x93, 0xAF, 0xAE, 0x20, 0x75, 0x9D, 0x77, 0x3D, 0x77, 0x3D, 0xA7, 0x72, 0xAD,
+    0x77, 0x39, 0x95, 0x99, 0x77, 0x4A, 0xCA, 0x77, 0x3D, 0x97, 0x72, 0xE5, 0xFA, 0x4A, 0xFC, 0x95,
+    0xF9, 0x4F, 0xC9, 0x59, 0xF5, 0xF9, 0x6A, 0xF4, 0x9F, 0x7A, 0xE9, 0x4A, 0xEA, 0x7F, 0x5F, 0x97,
+    0xF5, 0xF7, 0x9E, 0xA4, 0x9F, 0x7A, 0xE9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xEA, 0x5F, 0x79, 0xE9,
+    0x49, 0xEA, 0x7A, 0xEA, 0x39, 0xF7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x97, 0x0F, 0xFF, 0xC7,
+    0x19, 0xFF, 0xE7, 0x3A, 0xFF, 0xA7, 0x77, 0x70, 0x71, 0xD9, 0x74, 0xAC, 0xA7, 0x49, 0xD7, 0x5D,
+    0xA7, 0x59, 0x93, 0x9C, 0xA7, 0x5A, 0xD7, 0x49, 0xD9, 0x19, 0xD9, 0x39, 0xFC, 0x2A, 0xD4, 0xAF,
+    0x3A, 0xD4, 0xEA, 0x4E, 0x39, 0xE5, 0xDA, 0x3A, 0xDA, 0x49, 0xD9, 0x3E, 0xA4, 0xAD, 0x92, 0x9E,
+    0x94, 0xAD, 0x3F, 0x5F, 0xA9, 0xFC, 0x5F, 0xFD, 0xA5, 0xAF, 0xFC, 0x96, 0xAF, 0xAE, 0x50, 0x72,
+    0xE9, 0x77, 0x29, 0xE9, 0x77, 0x2A, 0xE9, 0x77, 0x29, 0xAA, 0xA9, 0x77, 0x70, 0x97, 0x75, 0xAC,
+    0xA7, 0x73, 0xD9, 0x77, 0x2A, 0xD5, 0xFA, 0x4A, 0xFC, 0x95, 0xF9, 0x4F, 0xC9, 0x59, 0xF5, 0xF9,
+    0x6A, 0xF4, 0x9F, 0x7A, 0xE9, 0x4A, 0xEA, 0x7F, 0x5F, 0x97, 0xF5, 0xF7, 0x9E, 0xA4, 0x9F, 0x7A,
+    0xE9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xEA, 0x5F, 0x79, 0xE9, 0x49, 0xEA, 0x7A, 0xEA, 0x39, 0xF7,
+    0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x97, 0x0F, 0xFF, 0xC7, 0x19, 0xFF, 0xE7, 0x3A, 0xFF, 0xA7,
+    0x77, 0x70, 0x5A, 0xE7, 0x5A, 0xE7, 0x5F, 0x75, 0x9A, 0xAA, 0x77, 0x19, 0xCA, 0x75, 0xAD, 0x74,
+    0x9D, 0x91, 0x9D, 0x93, 0x9F, 0xC2, 0xAD, 0x4A, 0xF3, 0xAD, 0x4E, 0xA4, 0xE3, 0x9E, 0x5D, 0xA3,
+    0xAD, 0xA4, 0x9D, 0x93, 0xEA, 0x4A, 0xD9, 0x29, 0xE9, 0x4A, 0xD3, 0xF5, 0xFA, 0x9F, 0xC5, 0xFF,
+    0xDA, 0x5A, 0xFF, 0xC9, 0x6A, 0xFA, 0xE5, 0x75, 0x99, 0x77, 0x39, 0xDA, 0x77, 0x4A, 0xA7, 0x73,
+    0xD7, 0x73, 0xAC, 0x77, 0x73, 0x97, 0x75, 0xAC, 0x97, 0x73, 0xD9, 0x77, 0x2A, 0xD5, 0xFA, 0x4A,
+    0xFC, 0x95, 0xF9, 0x4F, 0xC9, 0x59, 0xF5, 0xF9, 0x6A, 0xF4, 0x9F, 0x7A, 0xE9, 0x4A, 0xEA, 0x7F,
+    0x5F, 0x97, 0xF5, 0xF7, 0x9E, 0xA4, 0x9F, 0x7A, 0xE9, 0x4A, 0xE9, 0x7F, 0x5F, 0x70, 0xEA, 0x5F,
+    0x79, 0xE9, 0x49, 0xEA, 0x7A, 0xEA, 0x39, 0xF7, 0x0A, 0xFF, 0xFC, 0x70, 0xFF, 0xFC, 0x97, 0x0F,
+    0xFF, 0xC7, 0x19, 0xFF, 0xE7, 0x3A, 0xFF, 0xA7, 0x77, 0x70, 0x71, 0x97, 0x6E, 0x76, 0x9C, 0x75,
+    0xAC, 0xA7, 0x5C, 0xA7, 0x73, 0x9C, 0xA7, 0x5A, 0xD7, 0x49, 0xD9, 0x19, 0xD9, 0x39, 0xFC, 0x2A,
+    0xD4, 0xAF, 0x3A, 0xD4, 0xEA, 0x4E, 0x39, 0xE5, 0xDA, 0x3A, 0xDA, 0x49, 0xD9, 0x3E, 0xA4, 0xAD,
+    0x92, 0x9E, 0x94, 0xAD, 0x3F, 0x5F, 0xA9, 0xFC, 0x5F, 0xFD, 0xA5, 0xAF, 0xFC, 0x96, 0xAF, 0xAE,
+    0x50, 0x73, 0xDA, 0x09, 0xA7, 0x7F, 0x9A, 0xC9, 0x75, 0x9D, 0x9F, 0x76, 0xAC, 0xA0, 0xAD, 0x97,
+    0x77, 0x77, 0x7A, 0xA7, 0x74, 0xAC, 0xA7, 0x73, 0xD9, 0x77, 0x2E, 0x5F, 0xA4, 0xAF, 0xC9, 0x5F,
+    0x94, 0xFC, 0x95, 0x9F, 0x5F, 0x96, 0xAF, 0x49, 0xF7, 0xAE, 0x94, 0xAE, 0xA7, 0xF5, 0xF9, 0x7F,
+    0x5F, 0x79, 0xEA, 0x49, 0xF7, 0xAE, 0x94, 0xAE, 0x97, 0xF5, 0xF7, 0x0E, 0xA5, 0xF7, 0x9E, 0x94,
+    0x9E, 0xA7, 0xAE, 0xA3, 0x9F, 0x70, 0xAF, 0xFF, 0xC7, 0x0F, 0xFF, 0xC9, 0x70, 0xFF, 0xFC, 0x71,
+    0x9F, 0xFE, 0x73, 0xAF, 0xFA, 0x77, 0x77, 0x00, 0x6A, 0xD1, 0xAA, 0x70, 0x9E, 0xA0, 0xD7, 0x0D,
+    0x9D, 0x9C, 0xA7, 0x0D, 0x0A, 0xE9, 0x70, 0xD1, 0xDA, 0x09, 0x97, 0x69, 0xD7, 0x5A, 0xCA, 0x74,
+    0x9D, 0x91, 0x9D, 0x93, 0x9F, 0xC2, 0xAD, 0x4A, 0xF3, 0xAD, 0x4E, 0xA4, 0xE3, 0x9E, 0x5D, 0xA3,
+    0xAD, 0xA4, 0x9D, 0x93, 0xEA, 0x4A, 0xD9, 0x29, 0xE9, 0x4A, 0xD3, 0xF5, 0xFA, 0x9F, 0xC5, 0xFF,
+    0xDA, 0x5A, 0xFF, 0xC9, 0x6A, 0xFA, 0xE5, 0x77, 0x39, 0x97, 0x74, 0xAC, 0xA7, 0x73, 0xD9, 0x77,
+    0x2E, 0x5F, 0xA4, 0xAF, 0xC9, 0x5F, 0x94, 0xFC, 0x95, 0x9F, 0x5F, 0x96, 0xAF, 0x49, 0xF7, 0xAE,
+    0x94, 0xAE, 0xA7, 0xF5, 0xF9, 0x7F, 0x5F, 0x79, 0xEA, 0x49, 0xF7, 0xAE, 0x94, 0xAE, 0x97, 0xF5,
+    0xF7, 0x0E, 0xA5, 0xF7, 0x9E, 0x94, 0x9E, 0xA7, 0xAE, 0xA3, 0x9F, 0x70, 0xAF, 0xFF, 0xC7, 0x0F,
+    0xFF, 0xC9, 0x70, 0xFF, 0xFC, 0x71, 0x9F, 0xFE, 0x73, 0xAF, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x1E, 0x77, 0x2A, 0xE7, 0x72, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0x9A, 0xAA, 0x97,
+    0x60, 0x77, 0x77, 0x29, 0xCA, 0x77, 0xAD, 0x76, 0x9D, 0x93, 0x9D, 0x93, 0x9F, 0xC4, 0xAD, 0x4A,
+    0xF5, 0xAD, 0x4E, 0xA6, 0xE3, 0x9E, 0x7D, 0xA3, 0xAD, 0xA6, 0x9D, 0x93, 0xEA, 0x6A, 0xD9, 0x29,
+    0xE9, 0x6A, 0xD3, 0xF7, 0xFA, 0x9F, 0xC7, 0xFF, 0xDA, 0x7A, 0xFF, 0xC9, 0x70, 0xAF, 0xAE, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x6E, 0x76, 0xAE, 0x76, 0xF7, 0x59, 0xF7, 0x59, 0xAA, 0xA9, 0x75,
+    0x49, 0xAA, 0xA7, 0x4E, 0xA7, 0x4E, 0xA7, 0x39, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x3A, 0xE7,
+    0xEA, 0x9E, 0x95, 0xF1, 0xEA, 0x4A, 0xE2, 0xF3, 0x9E, 0x92, 0xF2, 0x9E, 0xA3, 0xAE, 0x91, 0xF4,
+    0x9E, 0xA0, 0xF6, 0xFA, 0xE9, 0x6F, 0xF7, 0xFE, 0x70, 0xAF, 0xC9, 0x70, 0x9F, 0xA7, 0x19, 0xF7,
+    0x2A, 0xEA, 0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFC, 0x71, 0x79, 0xAA, 0x97, 0x5E, 0x97,
+    0x49, 0xE9, 0x74, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x5E, 0x93, 0xE9, 0x39, 0xDA,
+    0x4A, 0xE3, 0xE5, 0x9E, 0x2A, 0xDA, 0x6E, 0x91, 0xE7, 0xEA, 0x0A, 0xD9, 0x7F, 0x9E, 0x70, 0xAF,
+    0xD9, 0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x3F, 0x70, 0xAA, 0xFC,
+    0x97, 0x9F, 0xDA, 0x70, 0xAF, 0xCA, 0x71, 0xFA, 0x73, 0x3A, 0xE7, 0xEA, 0x39, 0xE9, 0x5F, 0x5E,
+    0xA4, 0xAE, 0x6F, 0x39, 0xE9, 0x6F, 0x29, 0xEA, 0x7A, 0xE9, 0x1F, 0x70, 0x9E, 0xA0, 0xF7, 0x2F,
+    0xAE, 0x97, 0x2F, 0xF7, 0x3F, 0xE7, 0x4A, 0xFC, 0x97, 0x49, 0xFA, 0x75, 0x9F, 0x76, 0xAE, 0xA7,
+    0x6F, 0x97, 0x59, 0xF7, 0x6A, 0xF7, 0x6F, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
+    0xE7, 0x7A, 0xE7, 0x7F, 0x76, 0x9E, 0xA7, 0x69, 0xAA, 0xA9, 0x76, 0x3E, 0x5E, 0x93, 0xE9, 0x39,
+    0xDA, 0x4A, 0xE3, 0xE5, 0x9E, 0x2A, 0xDA, 0x6E, 0x91, 0xE7, 0xEA, 0x0A, 0xD9, 0x7F, 0x9E, 0x70,
+    0xAF, 0xD9, 0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7, 0x3F, 0x70, 0xAA,
+    0xFC, 0x97, 0x9F, 0xDA, 0xAA, 0xA5, 0xAF, 0xCA, 0x9E, 0x5F, 0xA1, 0xF7, 0x4F, 0x73, 0xAE, 0xA5,
+    0x70, 0xAC, 0xA7, 0x49, 0x9C, 0x97, 0x4D, 0x74, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xAE,
+    0x7E, 0xA9, 0xE9, 0x5F, 0x1E, 0xA4, 0xAE, 0x2F, 0x39, 0xE9, 0x2F, 0x29, 0xEA, 0x3A, 0xE9, 0x1F,
+    0x49, 0xEA, 0x0F, 0x6F, 0xAE, 0x96, 0xFF, 0x7F, 0xE7, 0x0A, 0xFC, 0x97, 0x09, 0xFA, 0x71, 0x9F,
+    0x72, 0xAE, 0xA7, 0x2F, 0x97, 0x19, 0xF7, 0x2A, 0xF7, 0x2F, 0xC7, 0x10, 0x73, 0xD9, 0x75, 0xAA,
+    0xC7, 0x59, 0xCA, 0x75, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74, 0xE5, 0xE9, 0x3E, 0x93,
+    0x9D, 0xA4, 0xAE, 0x3E, 0x59, 0xE2, 0xAD, 0xA6, 0xE9, 0x1E, 0x7E, 0xA0, 0xAD, 0x97, 0xF9, 0xE7,
+    0x0A, 0xFD, 0x97, 0x09, 0xFD, 0x72, 0xFC, 0x73, 0xFA, 0x73, 0xAE, 0x74, 0xEA, 0x73, 0xF7, 0x0A,
+    0xAF, 0xC9, 0x79, 0xFD, 0xA7, 0x0A, 0xFC, 0xA7, 0x1F, 0xA7, 0x30, 0x69, 0xD1, 0xAA, 0x79, 0xF0,
+    0xD7, 0xAC, 0x9A, 0xEA, 0x7D, 0x1E, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xE7, 0xEA, 0x9E,
+    0x95, 0xF1, 0xEA, 0x4A, 0xE2, 0xF3, 0x9E, 0x92, 0xF2, 0x9E, 0xA3, 0xAE, 0x91, 0xF4, 0x9E, 0xA0,
+    0xF6, 0xFA, 0xE9, 0x6F, 0xF7, 0xFE, 0x70, 0xAF, 0xC9, 0x70, 0x9F, 0xA7, 0x19, 0xF7, 0x2A, 0xEA,
+    0x72, 0xF9, 0x71, 0x9F, 0x72, 0xAF, 0x72, 0xFC, 0x71, 0x77, 0x72, 0xAD, 0x1C, 0xA7, 0x0A, 0xEA,
+    0xAC, 0xA7, 0x0D, 0x0F, 0x71, 0xD0, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x2E, 0x5E,
+    0x93, 0xE9, 0x39, 0xDA, 0x4A, 0xE3, 0xE5, 0x9E, 0x2A, 0xDA, 0x6E, 0x91, 0xE7, 0xEA, 0x0A, 0xD9,
+    0x7F, 0x9E, 0x70, 0xAF, 0xD9, 0x70, 0x9F, 0xD7, 0x2F, 0xC7, 0x3F, 0xA7, 0x3A, 0xE7, 0x4E, 0xA7,
+    0x3F, 0x70, 0xAA, 0xFC, 0x97, 0x9F, 0xDA, 0x70, 0xAF, 0xCA, 0x71, 0xFA, 0x73, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x0F, 0xFD, 0xA0, 0xFF, 0xD9, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x0F, 0xFD,
+    0xA0, 0xFF, 0xD9, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90, 0xAF, 0xFF, 0xE9, 0x0F,
+    0xFF, 0xF0, 0x77, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD0, 0xAF, 0xFF, 0xCA, 0x77, 0x00, 0x77, 0x7F,
+    0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFA, 0x77, 0x70, 0x77, 0x7F, 0xFF, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFA, 0x77, 0x70, 0x5D, 0xA2, 0xDA, 0x49, 0xD9, 0x19,
+    0xD9, 0x4A, 0xD2, 0xAD, 0x5D, 0xA2, 0xDA, 0x5D, 0x92, 0xD9, 0x4A, 0xD2, 0x9D, 0x5E, 0x2E, 0x5D,
+    0x92, 0xD9, 0x49, 0xD2, 0x9D, 0x5A, 0xD2, 0xAD, 0x5D, 0xA2, 0xDA, 0x49, 0xD9, 0x19, 0xD9, 0x4A,
+    0xD2, 0xAD, 0x5D, 0xA2, 0xDA, 0x5D, 0x92, 0xD9, 0x49, 0xD2, 0x9D, 0x5E, 0x2E, 0x5D, 0x92, 0xDA,
+    0x49, 0xD2, 0x9D, 0x50, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xFF,
+    0x91, 0xAF, 0xFF, 0xF7, 0x77, 0x77, 0x19, 0xFF, 0xFF, 0x91, 0xAF, 0xFF, 0xF2, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0x70, 0x9F, 0xA3, 0xFC, 0x4F, 0x4A, 0xEA, 0x4F, 0x4A, 0xF4,
+    0xF9, 0x73, 0xAF, 0x92, 0xFC, 0x3F, 0x3A, 0xEA, 0x3F, 0x3F, 0xA2, 0x9F, 0x30, 0x73, 0xFC, 0x3F,
+    0xA2, 0x9F, 0x3F, 0x92, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0x70, 0x9F, 0xA3, 0xFC, 0x4F, 0x4A, 0xEA,
+    0x4F, 0x4A, 0xF4, 0xF9, 0x77, 0x9F, 0xA0, 0x9F, 0x93, 0xFC, 0x1F, 0xA4, 0xF1, 0x9F, 0x4A, 0xEA,
+    0x1F, 0x94, 0xF2, 0xF4, 0xAF, 0x1A, 0xEA, 0x4F, 0x91, 0xF9, 0x77, 0x2A, 0xF9, 0x0F, 0xC3, 0xFC,
+    0x1F, 0xA3, 0xF2, 0xF3, 0xAE, 0xA1, 0xAE, 0x93, 0xF1, 0x9F, 0x3F, 0xA1, 0xF9, 0x29, 0xF1, 0xAF,
+    0x30, 0x73, 0xFC, 0x3F, 0xA2, 0x9F, 0x3F, 0x92, 0x9F, 0x3F, 0x92, 0xAE, 0xA3, 0x77, 0x9F, 0xA0,
+    0x9F, 0x93, 0xFC, 0x1F, 0xA4, 0xF1, 0x9F, 0x4A, 0xEA, 0x1F, 0x94, 0xF2, 0xF4, 0xAF, 0x1A, 0xEA,
+    0x4F, 0x91, 0xF9, 0x7A, 0xA9, 0x70, 0x9D, 0xA7, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97,
+    0x0A, 0xD7, 0x1E, 0x70, 0x9F, 0xD2, 0xFF, 0xD1, 0xAF, 0xFD, 0x09, 0xFD, 0xA7, 0x09, 0xD9, 0x70,
+    0xAD, 0x71, 0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0E, 0x71,
+    0xE7, 0x09, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x71, 0xAC, 0xA7, 0x2C, 0x97, 0x2C, 0x73, 0x97, 0x76,
+    0x71, 0xAA, 0xA7, 0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xE7, 0x3E, 0x72, 0x9D, 0xA7, 0x2A, 0xD7, 0x3E,
+    0x7A, 0xFF, 0xC3, 0x9F, 0xFD, 0x92, 0xFF, 0xE9, 0x6E, 0x72, 0x9D, 0x97, 0x2E, 0x73, 0xE7, 0x29,
+    0xDA, 0x7A, 0xAA, 0xFA, 0xCA, 0x3A, 0xFF, 0xCA, 0x29, 0xFF, 0xE6, 0xAD, 0x97, 0x2E, 0x73, 0xE7,
+    0x29, 0xDA, 0x72, 0xAD, 0x73, 0x9D, 0x74, 0xCA, 0x74, 0xA9, 0x74, 0x97, 0x77, 0x00, 0x6A, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xE5, 0xFF, 0xEA, 0x5F, 0xFE, 0xA4, 0xAF, 0xFE, 0x94, 0xFF,
+    0xF9, 0x3A, 0xFF, 0xF4, 0xFF, 0xFC, 0x39, 0xFF, 0xFC, 0x3F, 0xFF, 0xCA, 0x29, 0xFF, 0xFC, 0xA2,
+    0xFF, 0xFD, 0x91, 0x9F, 0xFF, 0xD9, 0x1A, 0xFF, 0xFD, 0x2F, 0xFF, 0xE1, 0xAF, 0xFF, 0xE1, 0x79,
+    0xCA, 0x3F, 0x91, 0xFC, 0x99, 0xFC, 0xAA, 0xF9, 0x0A, 0xCA, 0x72, 0x2A, 0xAA, 0x29, 0xE2, 0xF1,
+    0x9E, 0xA1, 0xFA, 0x00, 0x2A, 0xAA, 0x29, 0xE2, 0xF1, 0x9E, 0xA1, 0xFA, 0x00, 0x19, 0xAA, 0x93,
+    0xAA, 0x93, 0xAA, 0x91, 0xE9, 0x2A, 0xE2, 0xEA, 0x09, 0xE9, 0x2E, 0xA2, 0xEA, 0x0F, 0x2A, 0xEA,
+    0x1A, 0xE9, 0x9F, 0x2F, 0x91, 0xF9, 0x09, 0x91, 0xD9, 0x0D, 0x90, 0x77, 0x99, 0x77, 0xDA, 0x7D,
+    0x93, 0xE7, 0xD9, 0xA2, 0xAD, 0x79, 0xD9, 0xA1, 0xAD, 0x97, 0xAA, 0x0C, 0x90, 0x9D, 0x97, 0x0A,
+    0xE0, 0x9D, 0xA7, 0x19, 0xD1, 0xE7, 0x6E, 0x76, 0xE7, 0x6A, 0xD9, 0x75, 0xAD, 0x97, 0x59, 0xDA,
+    0x75, 0x9E, 0x1A, 0xA1, 0xAA, 0x95, 0xE1, 0xAA, 0x99, 0x9A, 0x9A, 0x4E, 0x2C, 0xAC, 0x9C, 0xAC,
+    0x93, 0xE9, 0x2C, 0xAC, 0x0C, 0xAC, 0x3E, 0xA3, 0xAC, 0x90, 0xAC, 0x92, 0x9A, 0xAA, 0x76, 0x75,
+    0xFC, 0x39, 0xF4, 0xAE, 0xA4, 0xF4, 0xAE, 0xA3, 0x9F, 0x4F, 0x93, 0x77, 0x3F, 0xC0, 0x9F, 0xA2,
+    0x9F, 0x1A, 0xF3, 0xAE, 0xA1, 0xF9, 0x3F, 0x2F, 0x3A, 0xEA, 0x1F, 0x92, 0x9F, 0x1A, 0xF3, 0xF9,
+    0x1F, 0x92, 0x77, 0x1C, 0xA2, 0xAC, 0x91, 0x9C, 0x91, 0xAD, 0x91, 0xE1, 0xE1, 0xE1, 0x9D, 0x91,
+    0xDA, 0x1D, 0xA1, 0xAD, 0x19, 0xD1, 0x9D, 0x2D, 0x91, 0xAC, 0xA7, 0x71, 0x69, 0xCA, 0x2E, 0x29,
+    0xD9, 0x2D, 0xA2, 0x9D, 0x60, 0x71, 0xAC, 0x19, 0xC9, 0x09, 0xDA, 0x0E, 0x1E, 0x0A, 0xD1, 0x9D,
+    0x1D, 0x91, 0xD9, 0x0A, 0xCA, 0x70, 0x77, 0x09, 0xC9, 0x19, 0xCA, 0x2A, 0xC2, 0xDA, 0x1E, 0x1A,
+    0xD9, 0x1E, 0x1A, 0xD2, 0xDA, 0x19, 0xD9, 0x1D, 0x91, 0xAD, 0x2A, 0xCA, 0x1A, 0xCA, 0x2D, 0x77,
+    0x00, 0x59, 0xA9, 0x79, 0xDA, 0x6A, 0xF9, 0x39, 0xEA, 0xE9, 0x1A, 0xE9, 0x0F, 0x90, 0x77, 0xA5,
+    0x9D, 0x4A, 0xDA, 0x3E, 0x92, 0x9D, 0xA4, 0xE5, 0xF5, 0xF4, 0x9D, 0xA5, 0xAC, 0x7A, 0x30, 0x70,
+    0xA9, 0x7C, 0xA6, 0xE9, 0x5A, 0xDA, 0x59, 0xE5, 0xAE, 0x39, 0xEA, 0x3F, 0x4E, 0x5A, 0xC9, 0x6A,
+    0x30, 0x77, 0x19, 0xAA, 0x77, 0x70, 0xE9, 0x77, 0x6A, 0xE7, 0x77, 0xF7, 0x6F, 0xC2, 0x9F, 0x0A,
+    0xF7, 0x09, 0xF9, 0x6A, 0xEA, 0x72, 0xFC, 0x5F, 0xA7, 0x3A, 0xF9, 0x29, 0xF9, 0x75, 0xFC, 0x19,
+    0xF9, 0x76, 0xFC, 0x9A, 0xF9, 0x74, 0xEA, 0xFF, 0xC3, 0xE9, 0x5A, 0xE0, 0xFF, 0x39, 0xE6, 0xF0,
+    0xAF, 0xD4, 0xF5, 0x9E, 0xA0, 0xAF, 0xCA, 0x4F, 0x59, 0xAA, 0xA9, 0xAF, 0xE3, 0x9A, 0xAA, 0x97,
+    0x1F, 0xFC, 0xA7, 0x79, 0xFF, 0xE7, 0x6A, 0xFC, 0x99, 0xFD, 0x74, 0xAF, 0xC9, 0x1F, 0xD9, 0x72,
+    0xFD, 0x92, 0xAF, 0xD7, 0x09, 0xFD, 0x93, 0x9F, 0xD9, 0x69, 0xFD, 0x6F, 0xE7, 0x77, 0x77, 0x4A,
+    0xAA, 0x77, 0x79, 0xE7, 0x77, 0xF7, 0x77, 0xF7, 0x76, 0xAE, 0xA7, 0x50, 0x77, 0x4A, 0x72, 0xD7,
+    0x09, 0xD9, 0x7A, 0xD7, 0x0E, 0x79, 0xD9, 0x7E, 0x70, 0xE7, 0x9D, 0xA7, 0xE9, 0x7E, 0x7A, 0xDA,
+    0x7E, 0x97, 0xE7, 0x1D, 0x72, 0x97, 0x77, 0x77, 0x75, 0x9A, 0xAA, 0x96, 0xF9, 0x6F, 0x95, 0xAF,
+    0x6F, 0xC5, 0xAF, 0xC5, 0x71, 0x97, 0x7C, 0x97, 0x59, 0xD7, 0x5A, 0xD7, 0x5E, 0x73, 0x9A, 0xF9,
+    0x70, 0xFF, 0xC6, 0xFD, 0xAE, 0x95, 0xAC, 0xAE, 0x1E, 0x79, 0xDA, 0x1E, 0x7A, 0xD9, 0x1E, 0x7E,
+    0x90, 0x9D, 0xA7, 0xE1, 0xE9, 0x69, 0xE0, 0x9E, 0x7A, 0xDA, 0xAE, 0x97, 0xFE, 0x97, 0x9F, 0xD9,
+    0x71, 0xFA, 0x73, 0xF7, 0x39, 0xEA, 0x73, 0xF9, 0x73, 0xD9, 0x77, 0x77, 0x77, 0x77, 0xAA, 0xA7,
+    0x4F, 0x97, 0x3F, 0x73, 0xAF, 0x73, 0xFC, 0x73, 0xFC, 0x72, 0xAF, 0xC7, 0x2A, 0xAA, 0xAA, 0xA7,
+    0x10, 0x09, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xD9, 0x9F, 0xFD, 0x00, 0x09, 0xCA, 0x3A, 0xCA,
+    0x0A, 0xFF, 0x90, 0x9F, 0xEA, 0x29, 0xFA, 0x20, 0x70, 0x99, 0x74, 0x9C, 0x90, 0xA7, 0x0D, 0xAC,
+    0xAC, 0xA7, 0x0F, 0xCA, 0x71, 0x9F, 0x97, 0x0F, 0xE7, 0x09, 0x99, 0xC9, 0x9A, 0xA6, 0xAC, 0x0A,
+    0xC9, 0x0D, 0x0A, 0x91, 0xC9, 0xD9, 0xFF, 0x1A, 0xFD, 0xAF, 0xA3, 0xAE, 0xA0, 0x9F, 0xA9, 0x1A,
+    0xFF, 0xF9, 0x1C, 0xAD, 0x0C, 0x9A, 0x0C, 0xA0, 0x94, 0xCA, 0x4A, 0x77, 0x40, 0x77, 0xDA, 0x77,
+    0xE7, 0x7E, 0x77, 0xAD, 0x77, 0xAD, 0x97, 0x69, 0xD9, 0x76, 0x9D, 0xA7, 0x7E, 0x77, 0xE7, 0x7E,
+    0x77, 0xE9, 0x76, 0xAD, 0x97, 0x6A, 0xDA, 0x76, 0x9D, 0xA7, 0x69, 0xE7, 0x69, 0xE7, 0x7E, 0x97,
+    0x6A, 0xAA, 0x97, 0x60, 0x77, 0x77, 0x49, 0x99, 0x71, 0x99, 0x97, 0x19, 0xFE, 0x49, 0xFD, 0xA6,
+    0xAF, 0xFC, 0x2F, 0xFD, 0x49, 0xEA, 0x91, 0xAD, 0x90, 0x9E, 0xA2, 0xE9, 0x4A, 0xA4, 0x9D, 0xA1,
+    0xAA, 0x49, 0xDA, 0x73, 0x9D, 0xA7, 0x09, 0xDA, 0x73, 0xAD, 0xA7, 0x0A, 0xD9, 0x73, 0xE9, 0x70,
+    0xE7, 0x39, 0xE7, 0x09, 0xE7, 0x3E, 0x97, 0x9E, 0x97, 0x1A, 0xEA, 0x69, 0xAE, 0xA7, 0x9F, 0xCA,
+    0x59, 0xFC, 0xA7, 0x0F, 0xC9, 0x6F, 0xC9, 0x71, 0xF7, 0x9E, 0xA7, 0x29, 0xEA, 0x7A, 0xE9, 0x72,
+    0xF9, 0x7F, 0x73, 0xEA, 0x79, 0xEA, 0x72, 0x9A, 0x97, 0x19, 0xA9, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x29, 0xE7, 0x0A, 0xDA, 0x73, 0xEA, 0x70, 0xEA, 0x72, 0x9E, 0xA7, 0x9E, 0x97, 0x2F, 0x97,
+    0xF9, 0x72, 0xAA, 0xAA, 0x70, 0xAA, 0xAA, 0x72, 0x77, 0x77, 0x99, 0x97, 0x29, 0x59, 0xFE, 0x79,
+    0xC4, 0xFF, 0xD6, 0xDA, 0x29, 0xEA, 0x91, 0xAD, 0x95, 0xDA, 0x3A, 0xA4, 0x9D, 0xA4, 0x9D, 0x97,
+    0x29, 0xDA, 0x4E, 0x73, 0xAD, 0xA4, 0xE7, 0x3E, 0x93, 0xAD, 0x97, 0x29, 0xE4, 0xE7, 0x3E, 0xA4,
+    0xE7, 0x1A, 0xF4, 0xAD, 0xA7, 0xAF, 0xC5, 0xE9, 0x6F, 0xCA, 0x59, 0xE7, 0xF7, 0xAD, 0xA6, 0x9E,
+    0xA7, 0x0D, 0x96, 0xAE, 0x97, 0x1A, 0x7F, 0x77, 0x29, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73,
+    0x9E, 0x70, 0xF6, 0xEA, 0x79, 0xF5, 0x9E, 0xA7, 0xFA, 0x5F, 0x96, 0x9F, 0xA5, 0xAA, 0xAA, 0x7F,
+    0xC9, 0x77, 0x1A, 0xAA, 0xAA, 0x50, 0x77, 0x77, 0x09, 0x39, 0x99, 0x97, 0x49, 0xC1, 0xAF, 0xDA,
+    0x72, 0xAF, 0xFE, 0xA7, 0x1F, 0xD9, 0x19, 0xE7, 0x09, 0xDA, 0xC9, 0x4A, 0xD7, 0x0A, 0xD7, 0xAD,
+    0x97, 0xE7, 0xE7, 0x9D, 0xA7, 0xE7, 0xE9, 0x6A, 0xDA, 0x7E, 0x6A, 0xE7, 0x9D, 0xA4, 0x9F, 0x97,
+    0xE9, 0x2A, 0xFC, 0x97, 0x0E, 0x29, 0xFC, 0x71, 0x9E, 0x2A, 0xEA, 0x73, 0xAC, 0xA2, 0xF7, 0x5A,
+    0x92, 0xF7, 0x71, 0xAE, 0x97, 0x71, 0xA9, 0x77, 0x77, 0x77, 0x72, 0xAA, 0xAA, 0x77, 0x2F, 0x2E,
+    0x97, 0x2A, 0xF1, 0x9E, 0x97, 0x2F, 0xC1, 0xF7, 0x2A, 0xFA, 0x1F, 0x72, 0xFC, 0xA0, 0x9A, 0xAA,
+    0xA7, 0x10, 0x77, 0x59, 0x77, 0x3A, 0xC9, 0x77, 0x2E, 0x77, 0x2A, 0xD9, 0x77, 0x2D, 0xA7, 0x72,
+    0xAD, 0x77, 0x3D, 0xA7, 0x72, 0xE7, 0x19, 0xAA, 0x94, 0x9D, 0xA7, 0x1E, 0x94, 0xE7, 0x1A, 0xE4,
+    0x9D, 0x97, 0x1F, 0x4E, 0x71, 0x9F, 0x3A, 0xD9, 0x77, 0x2E, 0x77, 0x2A, 0xD9, 0x77, 0x19, 0xE7,
+    0x72, 0xE7, 0x72, 0x9D, 0xA7, 0x72, 0xE7, 0x72, 0xAD, 0xA7, 0x72, 0xE7, 0x72, 0xAD, 0xA0, 0xE7,
+    0x59, 0xE0, 0x9E, 0x75, 0xE9, 0x0F, 0x74, 0x9E, 0x09, 0xF7, 0x4E, 0x90, 0x9A, 0xAA, 0x97, 0x3A,
+    0xE7, 0x72, 0xE9, 0x77, 0x1A, 0xE7, 0x72, 0xE7, 0x72, 0xEA, 0x77, 0x19, 0xE7, 0x72, 0xEA, 0x77,
+    0x19, 0xD9, 0x77, 0x2C, 0xA7, 0x73, 0x97, 0x75, 0x2A, 0xCA, 0x2C, 0xA0, 0xC9, 0x0A, 0xC1, 0xC9,
+    0x0C, 0xAC, 0x9C, 0x90, 0xC9, 0xCA, 0xC0, 0x9C, 0x90, 0xD0, 0x9F, 0x91, 0xE9, 0x70, 0x49, 0x4A,
+    0xC3, 0xAD, 0x2A, 0xAA, 0xA1, 0xAC, 0x0C, 0xA0, 0x9F, 0xC3, 0xD9, 0x3D, 0x10, 0x39, 0x99, 0x3F,
+    0xA1, 0x9C, 0x5A, 0xC9, 0x4F, 0x95, 0xD1, 0x9A, 0x0A, 0xCA, 0x1F, 0xC2, 0xAD, 0xA2, 0x49, 0x99,
+    0x29, 0xEA, 0x2C, 0x94, 0xAA, 0x94, 0xFA, 0x19, 0xCA, 0x0A, 0xC1, 0xAC, 0x1D, 0x19, 0xF3, 0x9A,
+    0x92, 0x09, 0x99, 0x99, 0x09, 0xFC, 0x4D, 0x39, 0xC9, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D,
+    0x30, 0x72, 0x9E, 0x3C, 0x90, 0xC9, 0x19, 0xC0, 0x9C, 0x92, 0xEA, 0x2C, 0xA9, 0xCA, 0x1A, 0xC1,
+    0xD1, 0xFC, 0xA1, 0x9E, 0xA1, 0x72, 0xAE, 0x2C, 0xA1, 0xC9, 0x1C, 0x2C, 0x90, 0x9C, 0x1A, 0xC2,
+    0xFC, 0x39, 0xAC, 0xA1, 0xCA, 0xAD, 0x2F, 0x97, 0x10, 0x77, 0x29, 0xD9, 0xAE, 0x95, 0xFF, 0xC9,
+    0x4F, 0xCA, 0xEA, 0x3A, 0xE9, 0x2E, 0x3E, 0x93, 0xDA, 0x3E, 0x39, 0xDA, 0x2A, 0xDA, 0x3A, 0xD9,
+    0x2E, 0x93, 0xE3, 0xE9, 0x29, 0xE2, 0xAE, 0x3F, 0x2F, 0x3E, 0xA1, 0x9E, 0xA2, 0xAE, 0x91, 0x2A,
+    0xCA, 0x3C, 0xA0, 0xC9, 0x1A, 0xC9, 0x9A, 0xA1, 0xCA, 0xCA, 0xC9, 0x09, 0xC9, 0xCA, 0xC9, 0x09,
+    0xC9, 0x0D, 0x19, 0xF9, 0x2E, 0xA4, 0x94, 0x39, 0x93, 0xE2, 0x9A, 0xCA, 0x39, 0xC9, 0x3A, 0xC4,
+    0xD3, 0x9C, 0xA2, 0xFC, 0x09, 0xFA, 0x00, 0x2A, 0xDA, 0x2A, 0xCA, 0xAC, 0x95, 0xCA, 0x4A, 0xC9,
+    0x3A, 0xCA, 0x3E, 0x29, 0xE3, 0xFC, 0x90, 0x9F, 0xC1, 0x2A, 0xDA, 0x29, 0xA9, 0x9C, 0x95, 0xC9,
+    0x29, 0x9A, 0xC3, 0xE9, 0x5D, 0x1A, 0xF9, 0x1F, 0xA7, 0x10, 0x4A, 0x4D, 0x3E, 0x2C, 0x9C, 0xA1,
+    0xCA, 0x0C, 0xA0, 0xAF, 0xC1, 0x99, 0xD9, 0x3D, 0x10, 0x72, 0xF9, 0x1A, 0xC5, 0xEA, 0x39, 0x99,
+    0xCA, 0x49, 0xCA, 0x1A, 0xF2, 0xEA, 0x72, 0x3A, 0xE2, 0xDA, 0x99, 0x1A, 0xC5, 0xF9, 0x19, 0xD9,
+    0xD1, 0xAC, 0x1A, 0xC1, 0xD1, 0xD1, 0xAF, 0x39, 0xA9, 0x20, 0x69, 0xFC, 0x19, 0x99, 0xD3, 0x9C,
+    0x93, 0xD3, 0x9C, 0xA3, 0xD3, 0xAC, 0xA3, 0xD9, 0x71, 0x3E, 0x93, 0xCA, 0x0A, 0xC2, 0x9C, 0x1D,
+    0x29, 0xCA, 0xAC, 0x93, 0xEA, 0x3C, 0xA0, 0xAC, 0x2A, 0xC1, 0xAC, 0x2A, 0xFA, 0x3A, 0xAA, 0x92,
+    0x29, 0xE3, 0x9C, 0x99, 0xCA, 0x2C, 0x91, 0xAA, 0x2C, 0x2C, 0xA2, 0xCA, 0xAD, 0x92, 0x9F, 0x6C,
+    0xA2, 0xFC, 0x39, 0x9A, 0x93, 0x72, 0xA9, 0x73, 0xEA, 0x71, 0xAD, 0xA7, 0x1A, 0xE7, 0x19, 0xE7,
+    0x2E, 0x97, 0x1E, 0xA7, 0x1A, 0xE7, 0x2E, 0x97, 0x1A, 0xDA, 0x72, 0xE7, 0x2A, 0xDA, 0x72, 0xE9,
+    0x71, 0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE7,
+    0x29, 0xE7, 0x29, 0xE7, 0x29, 0xE9, 0x72, 0xE9, 0x72, 0xEA, 0x72, 0xF7, 0x29, 0xE9, 0x72, 0xAA,
+    0xCA, 0x70, 0x09, 0xA7, 0x2A, 0xE7, 0x2A, 0xE7, 0x2E, 0xA7, 0x2E, 0xA7, 0x19, 0xE7, 0x2A, 0xE7,
+    0x2E, 0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0xAD, 0xA7, 0x2E, 0x72, 0xE9, 0x71, 0x9D, 0xA7,
+    0x19, 0xE7, 0x2E, 0x72, 0xE9, 0x71, 0xE9, 0x71, 0xEA, 0x71, 0xEA, 0x71, 0xE9, 0x71, 0xE9, 0x71,
+    0xE9, 0x70, 0x9E, 0x97, 0x0A, 0xE7, 0x1F, 0x70, 0x9E, 0xA7, 0x0A, 0xCA, 0xA2, 0x74, 0x9C, 0xA0,
+    0xAC, 0x97, 0x4D, 0x09, 0xD7, 0x49, 0xD0, 0xAC, 0xA7, 0x4D, 0x90, 0xD7, 0x49, 0xD0, 0xAC, 0xA7,
+    0x3A, 0xFD, 0xA7, 0x1F, 0xFC, 0xA7, 0x9F, 0xFD, 0x79, 0xFF, 0xE6, 0x9F, 0xDA, 0x0D, 0x97, 0xFE,
+    0x09, 0xD7, 0xFA, 0xAC, 0xA0, 0xD9, 0x69, 0xF0, 0xD0, 0x9D, 0x7F, 0xAA, 0xCA, 0x0D, 0x97, 0xF9,
+    0xD0, 0x9D, 0x79, 0xFA, 0xD0, 0xAC, 0xA7, 0xAF, 0xD9, 0x0D, 0x70, 0xAF, 0xD0, 0xAD, 0xAC, 0x6A,
+    0xFF, 0xF6, 0x9F, 0xFF, 0x7F, 0xFE, 0xA7, 0x9F, 0xFD, 0xA7, 0x0F, 0xFD, 0x97, 0x0D, 0x09, 0xD7,
+    0x4A, 0xCA, 0x0D, 0x97, 0x4D, 0x09, 0xD7, 0x49, 0xCA, 0x0A, 0xC9, 0x73, 0x77, 0x72, 0x9A, 0xAF,
+    0xAA, 0x7F, 0xFC, 0xA5, 0x9F, 0xFD, 0x5A, 0xFF, 0xE4, 0x9F, 0xC9, 0x72, 0xFA, 0x73, 0xFA, 0x73,
+    0x9F, 0x74, 0xFA, 0x2D, 0xAD, 0x4F, 0x91, 0x9F, 0xC3, 0x9F, 0x2A, 0xDA, 0x99, 0x3A, 0xF2, 0xDA,
+    0x6A, 0xFC, 0x99, 0xD9, 0x9C, 0x4A, 0xFF, 0xF4, 0x9F, 0xFF, 0x5F, 0xFE, 0xA5, 0x9F, 0xFD, 0xA6,
+    0x9F, 0xFC, 0x93, 0x77, 0x73, 0x99, 0x73, 0xAF, 0xC9, 0x79, 0xFF, 0x96, 0xEA, 0x19, 0xE6, 0xD9,
+    0x72, 0x9F, 0xFD, 0x5A, 0xFF, 0xD5, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0x79, 0xD9, 0x72, 0xFF, 0xDA,
+    0x5F, 0xFD, 0x97, 0x0D, 0xA7, 0x49, 0xDA, 0x73, 0x9E, 0x97, 0x1A, 0xFC, 0x71, 0x9F, 0xFC, 0xA9,
+    0x4A, 0xFF, 0xE4, 0xFF, 0xF9, 0x20, 0x77, 0x19, 0xE7, 0x1A, 0xE9, 0x4A, 0xDA, 0x71, 0xFA, 0x4E,
+    0x97, 0x09, 0xFA, 0x39, 0xE7, 0x1A, 0xFC, 0x3A, 0xDA, 0x71, 0xFD, 0x3E, 0x97, 0x09, 0xFD, 0x91,
+    0x9E, 0x71, 0xAF, 0xDA, 0x1A, 0xE7, 0x1F, 0xEA, 0x1E, 0xA4, 0x9F, 0xFF, 0xFF, 0xC9, 0x0F, 0xFF,
+    0xFF, 0xCA, 0x5F, 0x09, 0xE9, 0xEA, 0x70, 0x9F, 0x1F, 0xE7, 0x1F, 0xC1, 0xFE, 0x71, 0xFA, 0x1F,
+    0xDA, 0x70, 0xAF, 0x91, 0xAF, 0xC7, 0x1F, 0xC2, 0x9F, 0xC7, 0x09, 0xFC, 0x29, 0xFA, 0x60, 0x5A,
+    0xAA, 0xAA, 0xA9, 0x74, 0xFF, 0xA7, 0x19, 0xFF, 0xC9, 0x70, 0xAD, 0xA2, 0x9E, 0x5F, 0xFF, 0xFC,
+    0x1A, 0xAA, 0xFA, 0xAA, 0xAA, 0xEA, 0xA9, 0x4A, 0xDA, 0x29, 0xF7, 0xFF, 0xEA, 0x69, 0xFF, 0xE7,
+    0xAF, 0xFD, 0x70, 0xFF, 0xC9, 0x70, 0x9F, 0xAA, 0x97, 0x3A, 0xE9, 0x76, 0xF7, 0x69, 0xF7, 0x6A,
+    0xEA, 0x76, 0xFA, 0x75, 0x9F, 0x97, 0x50, 0x4A, 0xFA, 0x77, 0x2F, 0xE7, 0x71, 0xD9, 0x99, 0xDA,
+    0x77, 0x9D, 0x29, 0xD7, 0x7A, 0xCA, 0x29, 0xD7, 0x7D, 0x92, 0xAC, 0xA7, 0x7D, 0x3D, 0x95, 0x9F,
+    0x92, 0x9D, 0x99, 0xAE, 0x59, 0xFC, 0xA2, 0xAF, 0xEA, 0x5A, 0xC9, 0x6F, 0xEA, 0x6A, 0xC6, 0x9F,
+    0xEA, 0x6A, 0xDA, 0x4A, 0xE9, 0x0E, 0x7F, 0xA2, 0xEA, 0x1A, 0xD7, 0x09, 0xAD, 0x91, 0xE9, 0x1E,
+    0x97, 0x1D, 0xA0, 0x9E, 0x91, 0xE9, 0x4A, 0xC9, 0x9A, 0xDA, 0x0A, 0xE1, 0x9E, 0x93, 0xAF, 0xE1,
+    0xF1, 0xAE, 0x93, 0xFE, 0x91, 0x99, 0x99, 0x19, 0x99, 0x95, 0xAE, 0xA7, 0x77, 0x30, 0x2A, 0xCA,
+    0x79, 0xCA, 0x5E, 0x7D, 0xA5, 0xDA, 0x7D, 0x95, 0xDA, 0x69, 0xD6, 0xDA, 0x6A, 0xCA, 0x6D, 0xA1,
+    0xAC, 0x91, 0xD9, 0x49, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC9, 0x19, 0x9D, 0xA9, 0xF9, 0xDA, 0x99,
+    0x94, 0xDA, 0x9F, 0x9D, 0x70, 0xDA, 0xFC, 0xAD, 0x70, 0xFF, 0xDA, 0x70, 0xFC, 0x9F, 0x97, 0x0F,
+    0xA9, 0xF7, 0x1F, 0x09, 0xEA, 0x70, 0x9F, 0x09, 0xE9, 0x70, 0x9E, 0x91, 0xE7, 0x19, 0xE2, 0xE7,
+    0x39, 0xAA, 0x99, 0x76, 0xFE, 0xA5, 0x94, 0xFF, 0xC3, 0xDA, 0x29, 0xF9, 0x9A, 0xDA, 0x2D, 0x92,
+    0xAD, 0x93, 0xAD, 0x1A, 0xD3, 0xDA, 0x49, 0xCA, 0x1E, 0x3D, 0x09, 0xAA, 0x1A, 0xCA, 0x1D, 0xA2,
+    0x9D, 0x0A, 0xD1, 0xD9, 0x09, 0xD3, 0xDA, 0x0E, 0x1D, 0x1A, 0xD3, 0xD9, 0x0D, 0xA0, 0x9D, 0x1D,
+    0xA2, 0x9D, 0x1D, 0x94, 0x9D, 0x92, 0xAD, 0x09, 0xDA, 0x4E, 0x3D, 0xA1, 0xEA, 0x2A, 0xE3, 0xD9,
+    0x1F, 0xFD, 0xA3, 0xAA, 0x3A, 0xFF, 0x97, 0x39, 0x9A, 0xAA, 0xD3, 0x75, 0xAA, 0x77, 0xAD, 0x74,
+    0xFF, 0x71, 0x9F, 0xF7, 0x49, 0xD7, 0x29, 0xEA, 0xDA, 0x71, 0xAF, 0xE9, 0x70, 0xAD, 0x99, 0xF7,
+    0x1D, 0x2A, 0xDA, 0x70, 0xAC, 0x92, 0xAD, 0x97, 0x0D, 0x3E, 0x71, 0xD9, 0x09, 0xAE, 0x71, 0xFF,
+    0xA7, 0x1A, 0xFE, 0x97, 0x2A, 0xEA, 0xD7, 0x77, 0x29, 0xFF, 0xEA, 0x5F, 0xFF, 0x50, 0x77, 0x71,
+    0x9F, 0xD9, 0x7F, 0xF9, 0x6F, 0xFC, 0x6A, 0xEA, 0x91, 0x99, 0x59, 0xEA, 0x71, 0x9F, 0xFC, 0x6F,
+    0xFD, 0x59, 0xAA, 0xFC, 0xAA, 0xA7, 0xAD, 0xA7, 0x4E, 0xAA, 0xAA, 0xA6, 0xAF, 0xFC, 0x59, 0xFF,
+    0xD5, 0xAA, 0xAE, 0x74, 0x9E, 0xA7, 0x39, 0xFF, 0xA6, 0x9F, 0xFA, 0x7A, 0xFE, 0x97, 0x09, 0xAF,
+    0xC7, 0x75, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x90, 0xFF, 0xFE, 0x09, 0xFF, 0xFE,
+    0x0A, 0xFF, 0xFD, 0xA6, 0xEA, 0x09, 0x97, 0x09, 0xFD, 0x71, 0xAF, 0xD7, 0xAF, 0xE9, 0x6F, 0xE7,
+    0x1F, 0xD9, 0x70, 0x9A, 0x0F, 0xAD, 0x71, 0xFD, 0xA7, 0x9F, 0xE9, 0x6F, 0xDA, 0x97, 0x9F, 0xD7,
+    0x1A, 0xAA, 0xF7, 0x3A, 0xEA, 0x73, 0xF9, 0x71, 0x6A, 0xAA, 0xAA, 0xA9, 0x77, 0xFF, 0xA7, 0x49,
+    0xFF, 0xCA, 0x7F, 0xFF, 0xFE, 0xA6, 0xE4, 0xE6, 0x9F, 0xFF, 0xFE, 0x95, 0xAD, 0xA2, 0x9F, 0x72,
+    0xFF, 0xE9, 0x71, 0x9F, 0xFE, 0x72, 0xAF, 0xFD, 0x73, 0xFF, 0xC9, 0x73, 0x9F, 0xAA, 0x97, 0x6A,
+    0xE9, 0x77, 0x1F, 0x77, 0x19, 0xF7, 0x71, 0xAE, 0xA7, 0x71, 0xFA, 0x77, 0x09, 0xF9, 0x77, 0x74,
+    0x99, 0x77, 0xDA, 0x77, 0xDA, 0x76, 0x9D, 0x97, 0x6A, 0xD7, 0x5A, 0xAF, 0xDA, 0x96, 0xFF, 0xEA,
+    0x49, 0xFF, 0xF9, 0x39, 0xFF, 0xAA, 0xAA, 0xC9, 0x3F, 0xC0, 0xAD, 0x70, 0xAF, 0x1E, 0x70, 0xF2,
+    0xDA, 0x7A, 0xEA, 0x19, 0xD9, 0x7F, 0x91, 0xAD, 0x99, 0x6F, 0x2A, 0xFF, 0x90, 0x9F, 0x2F, 0xFC,
+    0x90, 0xAE, 0xA2, 0xDA, 0xAF, 0xC9, 0x0A, 0xF1, 0x9D, 0x1A, 0xE9, 0x1A, 0xFC, 0x9A, 0xD9, 0xAE,
+    0xA2, 0x9F, 0xFF, 0xD9, 0x3F, 0xFF, 0xD5, 0xFF, 0xFA, 0x69, 0xAF, 0xDA, 0x97, 0x3E, 0x77, 0xDA,
+    0x77, 0xD9, 0x77, 0x73, 0x79, 0x99, 0xA9, 0x77, 0x09, 0xFE, 0xA7, 0x7F, 0xFA, 0x76, 0xA9, 0x2F,
+    0x77, 0x39, 0xE7, 0x73, 0x9E, 0x71, 0x9F, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xA2, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x39, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x92, 0xAF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x92, 0xAE, 0x59, 0xC7, 0x3F, 0xA0, 0x99, 0xAE,
+    0xA7, 0x2A, 0xFF, 0xF7, 0x3A, 0xFF, 0xEA, 0x73, 0x9A, 0xFD, 0xAA, 0x77, 0x77, 0x20, 0x79, 0x97,
+    0x09, 0xD7, 0x0A, 0xD6, 0x9A, 0xF4, 0xFE, 0x3F, 0xDA, 0xC2, 0xAF, 0xCA, 0x4E, 0x0D, 0x93, 0xAD,
+    0xA9, 0xD4, 0xE9, 0xAD, 0x4E, 0x0D, 0xA4, 0xEA, 0xE4, 0xFE, 0xA3, 0x9F, 0xE9, 0x4A, 0xFA, 0x6D,
+    0x97, 0x9A, 0xA5, 0x2F, 0xFF, 0xF9, 0x29, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x77, 0x77,
+    0x72, 0xFF, 0xFE, 0x93, 0xFF, 0xFE, 0x3A, 0xFF, 0xFD, 0xA7, 0x1E, 0xA7, 0x69, 0xE9, 0x76, 0xAE,
+    0x77, 0xEA, 0x76, 0x9E, 0x97, 0x6F, 0x77, 0xF7, 0x69, 0xEA, 0x76, 0xF9, 0x76, 0xF7, 0x6A, 0xF7,
+    0x6F, 0x97, 0x40, 0x2F, 0xFD, 0x92, 0xFF, 0xD3, 0x99, 0x9E, 0xA9, 0x99, 0x7D, 0x95, 0xFF, 0xD9,
+    0x2F, 0xFD, 0x39, 0xAF, 0xC9, 0x99, 0x2A, 0xFD, 0x6F, 0xD6, 0x9F, 0xD6, 0x9A, 0x9A, 0xE9, 0x71,
+    0xAD, 0xA7, 0x1E, 0xA7, 0x09, 0xEA, 0x70, 0xAF, 0x70, 0xFC, 0x70, 0xAA, 0xAA, 0x95, 0x5E, 0x72,
+    0xE2, 0x95, 0x9D, 0xA9, 0xDA, 0x5A, 0xFD, 0x49, 0xFE, 0xA3, 0xAF, 0xCA, 0x99, 0x93, 0xFD, 0xAD,
+    0x93, 0xA9, 0xFE, 0x4A, 0xFE, 0x99, 0x91, 0xAF, 0xCA, 0x19, 0xD9, 0x0F, 0xCA, 0x1A, 0xE1, 0xA9,
+    0x9D, 0x9A, 0xF4, 0xAF, 0xDA, 0x5F, 0xCA, 0x96, 0xCA, 0xA9, 0x77, 0x40, 0x7A, 0xA9, 0x74, 0xD9,
+    0x73, 0x9D, 0x73, 0x9F, 0x97, 0x9F, 0xE9, 0x6F, 0xFC, 0x5F, 0xFD, 0x49, 0xFD, 0x0E, 0x4A, 0xDA,
+    0xE0, 0xE4, 0xE0, 0xDA, 0x0D, 0xA4, 0xDA, 0x9D, 0x99, 0xD9, 0x39, 0xD0, 0xAD, 0x0A, 0xD4, 0xAD,
+    0x0A, 0xD0, 0xE4, 0xE0, 0xDA, 0x0D, 0xA4, 0xDA, 0x0D, 0x99, 0xD9, 0x39, 0xD9, 0x9D, 0x0E, 0x4A,
+    0xD9, 0xAD, 0x0E, 0x69, 0x74, 0x71, 0xAA, 0xAA, 0xAA, 0x97, 0x5F, 0xFA, 0x72, 0x9F, 0xFC, 0x97,
+    0x1E, 0xA2, 0x9E, 0x71, 0xE4, 0xAD, 0x70, 0x9E, 0x4E, 0x70, 0xEA, 0x29, 0xF4, 0xAF, 0xFF, 0xD9,
+    0x4A, 0xFF, 0xFD, 0x5A, 0xFF, 0xFC, 0x6F, 0xFF, 0x97, 0x19, 0xFA, 0xA9, 0x79, 0x99, 0x99, 0xFA,
+    0x99, 0x99, 0x6F, 0xFF, 0xC9, 0x6F, 0xFF, 0xC7, 0x3A, 0xEA, 0x77, 0xFA, 0x76, 0x9F, 0x97, 0x20,
+    0x6A, 0x74, 0xE7, 0x2A, 0xD7, 0x29, 0xDA, 0x72, 0xE3, 0x9A, 0xCA, 0x2A, 0xD0, 0x9A, 0xFC, 0xA1,
+    0x9F, 0xFE, 0x91, 0xFF, 0xA9, 0x3F, 0xCA, 0x97, 0xAF, 0x72, 0x9F, 0x97, 0x19, 0xF9, 0x72, 0xE9,
+    0x73, 0xC9, 0x77, 0x50, 0x77, 0x69, 0xC7, 0x3A, 0xE7, 0x09, 0xFD, 0x6A, 0xFF, 0x4F, 0xFD, 0xA1,
+    0x9E, 0xA9, 0xD9, 0x9E, 0xA0, 0xE9, 0x0A, 0xD1, 0xAD, 0x19, 0xA2, 0xE2, 0x97, 0xDA, 0x72, 0x9D,
+    0x97, 0x2A, 0xD7, 0x3E, 0x73, 0xDA, 0x73, 0xAA, 0x70, 0x6A, 0x97, 0x3A, 0xD7, 0x4E, 0x73, 0x9D,
+    0xA3, 0x9C, 0xA9, 0x3A, 0xD9, 0x29, 0xFC, 0xA9, 0x0E, 0x3F, 0xFE, 0xA4, 0x9A, 0xFF, 0x97, 0x9A,
+    0xFC, 0x71, 0xFA, 0x70, 0xFA, 0x70, 0xF9, 0x71, 0xE9, 0x72, 0x9C, 0x97, 0x73, 0x3A, 0xAA, 0x73,
+    0xE7, 0x3A, 0xD7, 0x4D, 0x97, 0x3E, 0x73, 0xAD, 0x7C, 0x91, 0x9D, 0x91, 0x99, 0x1A, 0xDA, 0x1D,
+    0xA0, 0x9D, 0xA1, 0xF9, 0xE0, 0xF2, 0x9F, 0xFD, 0x5F, 0xF7, 0xAF, 0xC9, 0x70, 0x9E, 0x97, 0x3A,
+    0x97, 0x73, 0x49, 0xA7, 0x1A, 0x97, 0x1D, 0x97, 0x9D, 0x70, 0xAC, 0xA7, 0x1A, 0xD6, 0x9D, 0x39,
+    0xAA, 0x93, 0xD9, 0x5D, 0x99, 0xAF, 0xFA, 0x99, 0xD4, 0xFF, 0xCA, 0xAF, 0xFC, 0x29, 0xFC, 0xA9,
+    0x59, 0xAF, 0xCA, 0x1F, 0x97, 0x4F, 0x2F, 0x73, 0xF4, 0xAE, 0x71, 0xEA, 0x6A, 0xD7, 0x1D, 0xA7,
+    0x09, 0x73, 0x94, 0x69, 0xA7, 0x1A, 0xDA, 0x69, 0xFC, 0x94, 0xAF, 0xE9, 0x2E, 0x9D, 0x9E, 0x1E,
+    0x09, 0xD0, 0x9D, 0x29, 0x1A, 0xCA, 0x19, 0x6D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D,
+    0x97, 0x1A, 0xCA, 0x71, 0x9D, 0x72, 0xD9, 0x71, 0xAC, 0xA5, 0xAC, 0x90, 0x9D, 0x1C, 0xA1, 0xAD,
+    0xA9, 0xD0, 0xAD, 0x91, 0x9F, 0xFA, 0x4A, 0xFD, 0x69, 0xF7, 0x1D, 0x77, 0x00, 0x79, 0xAA, 0xA4,
+    0x99, 0xAF, 0xE3, 0xFF, 0xCA, 0x93, 0xFC, 0xA7, 0x0F, 0xE7, 0xEA, 0xFA, 0x5E, 0x1A, 0xF9, 0x3E,
+    0x29, 0xFC, 0x91, 0xE9, 0x39, 0xEA, 0x1A, 0xCA, 0x6A, 0xA1, 0x2C, 0xA9, 0x97, 0x1F, 0xEA, 0x99,
+    0x3A, 0xAF, 0xFC, 0x69, 0xFD, 0x59, 0xFD, 0xA4, 0xFC, 0xAD, 0xA2, 0xAF, 0xA0, 0x9D, 0xA0, 0x9F,
+    0xA2, 0xAD, 0xA0, 0xF9, 0x3A, 0xD9, 0x1C, 0x95, 0x9D, 0x90, 0x19, 0x97, 0x09, 0xD7, 0x09, 0xD9,
+    0x70, 0xE2, 0x9D, 0x29, 0xD9, 0x1A, 0xCA, 0x3E, 0x1D, 0x93, 0xAD, 0x90, 0xD5, 0xE9, 0xD5, 0xAF,
+    0xA2, 0x92, 0xF9, 0x2F, 0xF2, 0x9F, 0xF2, 0x9F, 0xEA, 0x79, 0x9A, 0x92, 0x69, 0xA7, 0x0D, 0xA7,
+    0xDA, 0x0A, 0xCA, 0x2A, 0xD1, 0x9D, 0x2D, 0xA2, 0xD1, 0xAD, 0x3D, 0x90, 0xE3, 0xAC, 0xAA, 0xD9,
+    0x39, 0xFC, 0x5F, 0x95, 0xFF, 0x91, 0xAF, 0xEA, 0x19, 0xFE, 0xA2, 0xAA, 0x94, 0x2A, 0x97, 0x6D,
+    0x97, 0x49, 0xDA, 0x74, 0xE7, 0x49, 0xDA, 0x74, 0xFF, 0xFD, 0x1A, 0xFF, 0xFD, 0x1F, 0x75, 0xFF,
+    0xFD, 0xA2, 0xAF, 0xFF, 0xC3, 0xAE, 0xA7, 0x4A, 0xE7, 0x5A, 0xD7, 0x6A, 0x97, 0x00, 0x73, 0x97,
+    0x4A, 0xC9, 0x9C, 0x73, 0xAD, 0x0A, 0xD7, 0x1F, 0x0E, 0xA6, 0x9F, 0xA9, 0xFA, 0x49, 0xFC, 0x9A,
+    0xFC, 0x92, 0xAE, 0xAD, 0x0D, 0xAA, 0xE1, 0xF0, 0x9D, 0x0D, 0x90, 0xEA, 0x0D, 0xA1, 0xDA, 0x9D,
+    0x19, 0xD1, 0x9A, 0x2D, 0x0A, 0xD2, 0x96, 0x9D, 0x0D, 0xA7, 0x2A, 0xCA, 0x0D, 0x97, 0x2D, 0x99,
+    0xD7, 0x3D, 0x0A, 0xD7, 0x29, 0xD0, 0xDA, 0x72, 0xAC, 0xA0, 0xD7, 0x39, 0xA9, 0x0A, 0xA7, 0x73,
+    0xA7, 0x6D, 0x97, 0x49, 0xE7, 0x5E, 0x75, 0x9D, 0xA2, 0xAF, 0xFF, 0xC2, 0xFF, 0xFE, 0x74, 0xAE,
+    0x99, 0xFF, 0xFD, 0x90, 0xAF, 0xFF, 0xC7, 0x29, 0xF7, 0x3F, 0x74, 0x9D, 0x76, 0xA6, 0x3D, 0x99,
+    0xD7, 0x3A, 0xCA, 0x0D, 0x97, 0x29, 0xD0, 0xDA, 0x73, 0xD0, 0xAD, 0x73, 0xD9, 0x9D, 0x73, 0xAD,
+    0x0D, 0x97, 0x3D, 0x0D, 0xA6, 0xAC, 0x2D, 0x9A, 0xD2, 0xC2, 0xE9, 0x0A, 0xCA, 0x9D, 0x1A, 0xD9,
+    0x09, 0xE9, 0x9D, 0x0D, 0x99, 0xE9, 0x19, 0xFD, 0x0A, 0xFC, 0xA4, 0xFC, 0x99, 0xFC, 0x6A, 0xEA,
+    0x0F, 0x70, 0xAE, 0x0E, 0x97, 0x19, 0xD0, 0xAC, 0xA7, 0x4C, 0x99, 0xA7, 0x76, 0x2A, 0x97, 0x2A,
+    0x95, 0xD9, 0x70, 0xAD, 0x49, 0xDA, 0x70, 0xE4, 0xE7, 0x19, 0xDA, 0x29, 0xDA, 0x72, 0xE2, 0xFF,
+    0xFF, 0xDA, 0x0A, 0xFF, 0xFF, 0xE9, 0xF7, 0x39, 0xEA, 0x0F, 0xFF, 0xFE, 0x2A, 0xFF, 0xFE, 0xA4,
+    0xAE, 0xA4, 0xF9, 0x6A, 0xE3, 0x9E, 0x97, 0x0A, 0xD4, 0xD9, 0x72, 0xA9, 0x49, 0x95, 0x5A, 0xC9,
+    0x72, 0x9E, 0xA7, 0x1F, 0xDA, 0x95, 0xEA, 0xFD, 0x92, 0xEA, 0x9F, 0xD2, 0xFA, 0x9C, 0xA0, 0x9A,
+    0x2F, 0xCA, 0x9C, 0xA5, 0xAF, 0xA9, 0xCA, 0x70, 0xAC, 0xA9, 0xCA, 0x70, 0xAC, 0xA9, 0xCA, 0x70,
+    0xAC, 0xA9, 0xCA, 0x70, 0xAC, 0xA9, 0xCA, 0x69, 0x9A, 0xCA, 0x9C, 0xA5, 0xFC, 0xA9, 0xCA, 0x5F,
+    0xCA, 0x9C, 0xA6, 0xAE, 0xA9, 0xCA, 0x0A, 0xC9, 0x3A, 0xE9, 0xFD, 0x93, 0xFF, 0xD5, 0xFD, 0x97,
+    0x0E, 0x97, 0x29, 0xA6, 0x77, 0x73, 0x9D, 0x97, 0x4F, 0xA7, 0x3A, 0xAE, 0x75, 0xE7, 0x5D, 0xA7,
+    0x49, 0xD7, 0x9A, 0xA9, 0x1E, 0x5A, 0xFD, 0x9D, 0x94, 0xAF, 0xFD, 0x4A, 0xE9, 0x1F, 0xA4, 0xE9,
+    0x29, 0xE9, 0x39, 0xE3, 0x9E, 0x4A, 0xDA, 0x3A, 0xD9, 0x4A, 0xE2, 0xAE, 0x5A, 0xFF, 0xC6, 0x9F,
+    0xF9, 0x7A, 0xFD, 0x97, 0x19, 0xAC, 0xAA, 0x70, 0x77, 0x29, 0x97, 0x49, 0xFC, 0x9A, 0xDA, 0x71,
+    0xAF, 0xFE, 0x71, 0xFF, 0xF7, 0x1F, 0xA2, 0xAF, 0xA7, 0xF9, 0x2A, 0xFD, 0x6A, 0xE9, 0x2F, 0xAE,
+    0x6E, 0xA2, 0xEA, 0x0A, 0xE5, 0x9E, 0x2E, 0xA1, 0xAE, 0x5F, 0x1E, 0xA2, 0xF5, 0xE9, 0x0E, 0xA3,
+    0xEA, 0x49, 0xEA, 0xE9, 0x3A, 0xE9, 0x4A, 0xFD, 0x93, 0x9F, 0x5A, 0xFC, 0xA1, 0x99, 0xFC, 0xA5,
+    0xAF, 0xFF, 0xE6, 0xAF, 0xFF, 0xD9, 0x59, 0xFF, 0xFD, 0xA5, 0xAF, 0xFF, 0xDA, 0x6E, 0x19, 0xFD,
+    0xA9, 0x71, 0xA7, 0x73, 0x77, 0x74, 0xF7, 0x4A, 0xF7, 0x39, 0xFC, 0x97, 0x2F, 0xDA, 0x71, 0xEA,
+    0xF7, 0x0A, 0xE0, 0xAE, 0x79, 0xE9, 0x0A, 0xE6, 0x9E, 0xA1, 0x9E, 0x95, 0xF2, 0x9E, 0xA4, 0xAE,
+    0x93, 0xF3, 0xAE, 0xA4, 0xF2, 0x9F, 0x5F, 0x2F, 0x95, 0xF9, 0x09, 0xFF, 0xFE, 0x90, 0xAF, 0xFF,
+    0xE1, 0xFF, 0xFE, 0xA0, 0x2F, 0xFF, 0xC3, 0xFF, 0xFC, 0x29, 0xAF, 0xAA, 0xFA, 0x94, 0xE2, 0xAD,
+    0xA6, 0xE2, 0xE9, 0x5A, 0xDA, 0x2E, 0x6E, 0x91, 0x9E, 0x6E, 0x2A, 0xDA, 0x59, 0xE2, 0xE6, 0xAD,
+    0xA2, 0xE6, 0xE9, 0x19, 0xDA, 0x6E, 0x2E, 0x95, 0x9E, 0x2E, 0x6A, 0xDA, 0x19, 0xE6, 0xE9, 0x1A,
+    0xDA, 0x6A, 0xAA, 0x2A, 0xAA, 0x95, 0x77, 0x1E, 0x2E, 0x96, 0xE9, 0x1A, 0xDA, 0x6A, 0xDA, 0x19,
+    0xE6, 0x9E, 0x2E, 0x7E, 0x2E, 0x96, 0xE9, 0x19, 0xDA, 0x6A, 0xDA, 0x2E, 0x69, 0xE2, 0xE7, 0xE2,
+    0xAD, 0xA6, 0xE9, 0x19, 0xE6, 0xAD, 0xA2, 0xE7, 0xE2, 0xE9, 0x6E, 0x2A, 0xDA, 0x4A, 0xFF, 0xFA,
+    0x29, 0xFF, 0xFC, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x4F, 0xFD, 0x94, 0xFF, 0xD4,
+    0x9E, 0xAA, 0xAA, 0xAA, 0x95, 0xEA, 0x73, 0x9E, 0x97, 0x3F, 0x74, 0xE9, 0x73, 0xAD, 0x97, 0x39,
+    0xD7, 0x3E, 0x97, 0x1A, 0xE7, 0x19, 0xEA, 0x71, 0x9F, 0xFD, 0x4A, 0xFF, 0xCA, 0x4F, 0xFD, 0x94,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x40, 0x75, 0x9A, 0xAF, 0xE1, 0xFF, 0xD0, 0xAF, 0xDA, 0xAA, 0xA0,
+    0x74, 0x99, 0x99, 0x99, 0x99, 0x74, 0xAF, 0xE9, 0x74, 0xFE, 0xA7, 0x4E, 0x97, 0x70, 0x9D, 0xA7,
+    0x71, 0xE7, 0x71, 0xAD, 0xA7, 0x71, 0xE7, 0x71, 0xEA, 0x77, 0x09, 0xE7, 0x71, 0xEA, 0x77, 0x0A,
+    0xE7, 0x49, 0x3E, 0xA7, 0x4D, 0x1F, 0x74, 0x9E, 0xAE, 0xA7, 0x5F, 0xE7, 0x6F, 0xDA, 0x76, 0xAF,
+    0xC7, 0x79, 0xFA, 0x76, 0x77, 0x7A, 0xEA, 0x19, 0xE9, 0x4A, 0xFD, 0xAA, 0xFC, 0x92, 0x9F, 0xFF,
+    0xE2, 0xE9, 0x2E, 0xA9, 0x09, 0xD1, 0xAD, 0x93, 0x9C, 0xA3, 0xD1, 0xE4, 0xAC, 0x3A, 0xD1, 0xDA,
+    0x3A, 0xDA, 0x99, 0xAD, 0xA1, 0xFF, 0xFF, 0x2F, 0xFF, 0xE9, 0x29, 0xFD, 0xAA, 0xFC, 0xA4, 0x9A,
+    0xDA, 0x91, 0xAD, 0xA9, 0x30, 0x77, 0x19, 0x77, 0x09, 0xFA, 0x75, 0xAF, 0xCA, 0x74, 0x9E, 0x90,
+    0x99, 0x74, 0xE9, 0x77, 0x9E, 0x77, 0x0E, 0x97, 0x70, 0xE7, 0x70, 0xAD, 0xA7, 0x70, 0xE7, 0x70,
+    0x9D, 0xA7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xD9, 0x77, 0x0E, 0x77, 0x0A, 0xDA, 0x77, 0x0E,
+    0x74, 0x9A, 0x09, 0xF7, 0x2A, 0xFF, 0x73, 0xFF, 0xA7, 0x3A, 0xFE, 0x75, 0x9F, 0xA7, 0x77, 0x71,
+    0x4A, 0xE4, 0xEA, 0x3A, 0xEA, 0x3F, 0x92, 0x9F, 0x97, 0x77, 0x76, 0xE9, 0x3A, 0xE9, 0x3F, 0x39,
+    0xF3, 0xFC, 0x20, 0x77, 0x2A, 0xEA, 0x2A, 0xA3, 0xFD, 0x90, 0x9D, 0xA1, 0xAD, 0xA0, 0xE9, 0xE2,
+    0xE9, 0x09, 0xFC, 0xA3, 0x99, 0x29, 0xEA, 0x77, 0x29, 0xF2, 0xAA, 0xA2, 0x9F, 0xD1, 0xE2, 0xE0,
+    0x9D, 0x9A, 0xDA, 0x19, 0xE1, 0xFD, 0x71, 0xAD, 0xA7, 0x72, 0x77, 0x77, 0x29, 0xD9, 0x77, 0xDA,
+    0x77, 0xDA, 0x77, 0xE7, 0x7A, 0xD7, 0x29, 0xAA, 0xAA, 0xFF, 0x5A, 0xFF, 0xFC, 0x4A, 0xFF, 0xEA,
+    0xAA, 0x70, 0x9E, 0x76, 0x9E, 0x74, 0xAF, 0xFF, 0x5A, 0xFF, 0xFC, 0x93, 0x9A, 0xAF, 0xEA, 0xAA,
+    0xAA, 0x95, 0xEA, 0x76, 0xAE, 0x76, 0xAE, 0x76, 0x9E, 0x77, 0x99, 0x97, 0x70, 0x77, 0x76, 0xAC,
+    0x97, 0x6A, 0xEA, 0x74, 0xAF, 0xD7, 0x2A, 0xFD, 0x97, 0x1A, 0xFD, 0xA7, 0x1A, 0xFD, 0xA7, 0x3F,
+    0xD7, 0x59, 0xFE, 0xA9, 0x71, 0x9F, 0xFD, 0xA9, 0x71, 0x9A, 0xFF, 0xD9, 0x72, 0x9A, 0xFE, 0x75,
+    0x9A, 0xF6, 0xAA, 0x99, 0x69, 0xA9, 0x5F, 0xFA, 0xA9, 0x97, 0xFF, 0xFD, 0x96, 0x99, 0x9A, 0xAF,
+    0xF7, 0x70, 0x99, 0x99, 0x77, 0x72, 0xC9, 0x77, 0x09, 0xE9, 0x76, 0xAF, 0xC9, 0x75, 0xAF, 0xD9,
+    0x75, 0xFE, 0x97, 0x49, 0xFE, 0x97, 0x49, 0xFD, 0x73, 0x9A, 0xFD, 0x79, 0xAF, 0xFD, 0x4A, 0xFF,
+    0xDA, 0x95, 0xAF, 0xEA, 0x97, 0x1F, 0xA9, 0x75, 0xCA, 0x96, 0x99, 0xA7, 0x99, 0x9A, 0xAF, 0xE9,
+    0x4F, 0xFF, 0xD9, 0x3F, 0xFA, 0xA9, 0x99, 0x59, 0x99, 0x97, 0x70,
 };
 
 static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 12, 27, 12, -1, 24, 81, 0 }, // !
-    { 14, 8, 17, 2, 19, 28, 81 }, // "
-    { 26, 20, 27, 0, 17, 130, 109 }, // #
-    { 19, 25, 24, 2, 21, 119, 239 }, // $
-    { 20, 19, 25, 4, 17, 95, 358 }, // %
-    { 17, 18, 21, 3, 17, 77, 453 }, // &
-    { 7, 8, 11, 3, 17, 14, 530 }, // '
-    { 15, 29, 17, 1, 22, 109, 544 }, // (
-    { 14, 29, 9, -6, 22, 102, 653 }, // )
-    { 13, 12, 17, 3, 17, 39, 755 }, // *
-    { 12, 12, 15, 2, 12, 36, 794 }, // +
-    { 9, 8, 9, -1, 4, 18, 830 }, // ,
-    { 12, 3, 14, 1, 8, 9, 848 }, // -
-    { 6, 5, 7, 0, 5, 8, 857 }, // .
-    { 24, 36, 22, -3, 25, 216, 865 }, // /
-    { 16, 17, 18, 1, 16, 68, 1081 }, // 0
-    { 12, 16, 15, 0, 16, 48, 1149 }, // 1
-    { 16, 16, 17, 0, 16, 64, 1197 }, // 2
-    { 15, 17, 17, 1, 17, 64, 1261 }, // 3
-    { 14, 17, 17, 1, 16, 60, 1325 }, // 4
-    { 15, 17, 16, 0, 16, 64, 1385 }, // 5
-    { 15, 16, 17, 1, 16, 60, 1449 }, // 6
-    { 13, 16, 18, 4, 16, 52, 1509 }, // 7
-    { 15, 17, 17, 1, 16, 64, 1561 }, // 8
-    { 16, 18, 18, 1, 17, 72, 1625 }, // 9
-    { 9, 14, 10, 0, 14, 32, 1697 }, // :
-    { 11, 17, 11, -1, 13, 47, 1729 }, // ;
-    { 18, 14, 17, -2, 14, 63, 1776 }, // <
-    { 13, 8, 15, 1, 10, 26, 1839 }, // =
-    { 17, 14, 19, 1, 14, 60, 1865 }, // >
-    { 16, 27, 20, 3, 24, 108, 1925 }, // ?
-    { 21, 19, 23, 1, 18, 100, 2033 }, // @
-    { 18, 18, 23, 1, 18, 81, 2133 }, // A
-    { 17, 18, 19, 1, 18, 77, 2214 }, // B
-    { 18, 19, 21, 2, 19, 86, 2291 }, // C
-    { 20, 18, 22, 1, 18, 90, 2377 }, // D
-    { 18, 18, 20, 1, 18, 81, 2467 }, // E
-    { 17, 18, 19, 1, 18, 77, 2548 }, // F
-    { 19, 19, 24, 2, 19, 91, 2625 }, // G
-    { 20, 18, 22, 1, 18, 90, 2716 }, // H
-    { 10, 18, 12, 1, 18, 45, 2806 }, // I
-    { 19, 23, 20, 0, 18, 110, 2851 }, // J
-    { 19, 18, 21, 1, 18, 86, 2961 }, // K
-    { 14, 18, 18, 1, 18, 63, 3047 }, // L
-    { 23, 18, 25, 1, 18, 104, 3110 }, // M
-    { 21, 18, 23, 1, 18, 95, 3214 }, // N
-    { 21, 19, 24, 2, 18, 100, 3309 }, // O
-    { 17, 18, 19, 1, 18, 77, 3409 }, // P
-    { 20, 22, 24, 2, 19, 110, 3486 }, // Q
-    { 17, 18, 20, 1, 18, 77, 3596 }, // R
-    { 18, 18, 22, 1, 18, 81, 3673 }, // S
-    { 17, 18, 23, 5, 18, 77, 3754 }, // T
-    { 21, 19, 23, 1, 18, 100, 3831 }, // U
-    { 18, 18, 25, 6, 18, 81, 3931 }, // V
-    { 25, 18, 31, 5, 18, 113, 4012 }, // W
-    { 22, 18, 24, 1, 18, 99, 4125 }, // X
-    { 16, 18, 23, 6, 18, 72, 4224 }, // Y
-    { 22, 18, 24, 1, 18, 99, 4296 }, // Z
-    { 16, 31, 16, -1, 23, 124, 4395 }, // [
-    { 5, 24, 10, 4, 19, 30, 4519 }, // <backslash>
-    { 16, 31, 12, -5, 23, 124, 4549 }, // ]
-    { 12, 6, 16, 3, 20, 18, 4673 }, // ^
-    { 16, 5, 15, -2, -1, 20, 4691 }, // _
-    { 8, 4, 13, 4, 16, 8, 4711 }, // `
-    { 14, 13, 18, 1, 13, 46, 4719 }, // a
-    { 13, 19, 18, 3, 18, 62, 4765 }, // b
-    { 12, 13, 16, 2, 13, 39, 4827 }, // c
-    { 17, 18, 20, 2, 18, 77, 4866 }, // d
-    { 14, 12, 18, 2, 12, 42, 4943 }, // e
-    { 12, 17, 15, 2, 17, 51, 4985 }, // f
-    { 17, 19, 18, 0, 12, 81, 5036 }, // g
-    { 15, 18, 18, 1, 18, 68, 5117 }, // h
-    { 11, 19, 12, 0, 19, 53, 5185 }, // i
-    { 14, 25, 16, 1, 19, 88, 5238 }, // j
-    { 13, 18, 19, 1, 18, 59, 5326 }, // k
-    { 10, 18, 12, 1, 18, 45, 5385 }, // l
-    { 22, 13, 25, 1, 13, 72, 5430 }, // m
-    { 15, 13, 18, 1, 13, 49, 5502 }, // n
-    { 14, 12, 18, 2, 12, 42, 5551 }, // o
-    { 19, 19, 20, -1, 13, 91, 5593 }, // p
-    { 15, 19, 20, 2, 13, 72, 5684 }, // q
-    { 12, 12, 15, 1, 12, 36, 5756 }, // r
-    { 14, 14, 18, 1, 13, 49, 5792 }, // s
-    { 11, 17, 16, 4, 17, 47, 5841 }, // t
-    { 14, 12, 18, 2, 12, 42, 5888 }, // u
-    { 15, 12, 20, 4, 12, 45, 5930 }, // v
-    { 18, 13, 23, 4, 12, 59, 5975 }, // w
-    { 18, 12, 20, 1, 12, 54, 6034 }, // x
-    { 17, 18, 19, 1, 12, 77, 6088 }, // y
-    { 16, 12, 18, 1, 12, 48, 6165 }, // z
-    { 14, 21, 17, 2, 16, 74, 6213 }, // {
-    { 9, 19, 11, 1, 15, 43, 6287 }, // |
-    { 14, 21, 15, -1, 16, 74, 6330 }, // }
-    { 9, 5, 14, 4, 16, 12, 6404 }, // ~
-    { 0, 0, 18, 0, 0, 0, 6416 }, //  
-    { 11, 27, 14, 2, 23, 75, 6416 }, // ¡
-    { 12, 20, 16, 2, 16, 60, 6491 }, // ¢
-    { 17, 20, 18, 0, 19, 85, 6551 }, // £
-    { 15, 13, 17, 1, 14, 49, 6636 }, // ¤
-    { 18, 19, 21, 2, 16, 86, 6685 }, // ¥
-    { 8, 19, 10, 1, 15, 38, 6771 }, // ¦
-    { 16, 18, 18, 1, 17, 72, 6809 }, // §
-    { 12, 5, 16, 3, 17, 15, 6881 }, // ¨
-    { 11, 9, 18, 6, 20, 25, 6896 }, // ©
-    { 8, 7, 15, 6, 16, 14, 6921 }, // ª
-    { 15, 12, 18, 2, 12, 45, 6935 }, // «
-    { 12, 8, 15, 2, 8, 24, 6980 }, // ¬
-    { 12, 3, 15, 2, 8, 9, 7004 }, // ­
-    { 11, 9, 18, 6, 23, 25, 7013 }, // ®
-    { 10, 4, 15, 4, 16, 10, 7038 }, // ¯
-    { 12, 10, 17, 4, 16, 30, 7048 }, // °
-    { 16, 16, 17, 0, 12, 64, 7078 }, // ±
-    { 8, 8, 16, 7, 17, 16, 7142 }, // ²
-    { 8, 8, 16, 7, 17, 16, 7158 }, // ³
-    { 7, 5, 11, 3, 16, 9, 7174 }, // ´
-    { 17, 15, 18, -1, 12, 64, 7183 }, // µ
-    { 16, 18, 18, 1, 15, 72, 7247 }, // ¶
-    { 7, 5, 9, 1, 10, 9, 7319 }, // ·
-    { 7, 7, 7, -1, 1, 13, 7328 }, // ¸
-    { 6, 8, 14, 7, 17, 12, 7341 }, // ¹
-    { 8, 7, 15, 6, 15, 14, 7353 }, // º
-    { 15, 12, 16, -3, 12, 45, 7367 }, // »
-    { 22, 20, 27, 2, 18, 110, 7412 }, // ¼
-    { 23, 20, 27, 2, 18, 115, 7522 }, // ½
-    { 22, 19, 27, 2, 17, 105, 7637 }, // ¾
-    { 16, 26, 15, -2, 15, 104, 7742 }, // ¿
-    { 18, 24, 23, 1, 24, 108, 7846 }, // À
-    { 19, 28, 23, 1, 28, 133, 7954 }, // Á
-    { 19, 25, 23, 1, 25, 119, 8087 }, // Â
-    { 19, 25, 23, 1, 25, 119, 8206 }, // Ã
-    { 21, 25, 23, 1, 25, 132, 8325 }, // Ä
-    { 18, 25, 23, 1, 25, 113, 8457 }, // Å
-    { 29, 19, 31, 1, 18, 138, 8570 }, // Æ
-    { 18, 25, 21, 2, 19, 113, 8708 }, // Ç
-    { 18, 25, 20, 1, 25, 113, 8821 }, // È
-    { 18, 28, 20, 1, 28, 126, 8934 }, // É
-    { 18, 26, 20, 1, 26, 117, 9060 }, // Ê
-    { 19, 26, 21, 1, 26, 124, 9177 }, // Ë
-    { 12, 25, 14, 1, 25, 75, 9301 }, // Ì
-    { 13, 29, 15, 1, 29, 95, 9376 }, // Í
-    { 13, 26, 15, 1, 26, 85, 9471 }, // Î
-    { 15, 27, 17, 1, 27, 102, 9556 }, // Ï
-    { 21, 18, 22, 0, 18, 95, 9658 }, // Ð
-    { 21, 25, 23, 1, 25, 132, 9753 }, // Ñ
-    { 21, 25, 24, 2, 24, 132, 9885 }, // Ò
-    { 21, 28, 24, 2, 27, 147, 10017 }, // Ó
-    { 21, 26, 24, 2, 25, 137, 10164 }, // Ô
-    { 21, 26, 24, 2, 25, 137, 10301 }, // Õ
-    { 21, 26, 24, 2, 25, 137, 10438 }, // Ö
-    { 14, 7, 15, 0, 9, 25, 10575 }, // ×
-    { 41, 37, 34, -8, 28, 380, 10600 }, // Ø
-    { 21, 26, 23, 1, 25, 137, 10980 }, // Ù
-    { 21, 30, 23, 1, 29, 158, 11117 }, // Ú
-    { 21, 27, 23, 1, 26, 142, 11275 }, // Û
-    { 21, 28, 23, 1, 27, 147, 11417 }, // Ü
-    { 16, 30, 23, 6, 30, 120, 11564 }, // Ý
-    { 13, 17, 15, 1, 17, 56, 11684 }, // Þ
-    { 16, 18, 17, 0, 17, 72, 11740 }, // ß
-    { 14, 19, 18, 1, 19, 67, 11812 }, // à
-    { 15, 22, 18, 1, 22, 83, 11879 }, // á
-    { 15, 19, 18, 1, 19, 72, 11962 }, // â
-    { 15, 19, 18, 1, 19, 72, 12034 }, // ã
-    { 17, 20, 19, 1, 20, 85, 12106 }, // ä
-    { 14, 20, 18, 1, 20, 70, 12191 }, // å
-    { 23, 13, 26, 1, 13, 75, 12261 }, // æ
-    { 12, 18, 16, 2, 13, 54, 12336 }, // ç
-    { 14, 21, 18, 2, 21, 74, 12390 }, // è
-    { 15, 24, 18, 2, 24, 90, 12464 }, // é
-    { 15, 21, 18, 2, 21, 79, 12554 }, // ê
-    { 16, 22, 19, 2, 22, 88, 12633 }, // ë
-    { 10, 18, 11, 0, 18, 45, 12721 }, // ì
-    { 11, 22, 12, 0, 22, 61, 12766 }, // í
-    { 12, 19, 12, -1, 19, 57, 12827 }, // î
-    { 12, 18, 13, 0, 18, 54, 12884 }, // ï
-    { 20, 19, 21, 0, 18, 95, 12938 }, // ð
-    { 16, 20, 18, 1, 20, 80, 13033 }, // ñ
-    { 14, 18, 18, 2, 18, 63, 13113 }, // ò
-    { 14, 22, 18, 2, 22, 77, 13176 }, // ó
-    { 14, 19, 18, 2, 19, 67, 13253 }, // ô
-    { 14, 19, 18, 2, 19, 67, 13320 }, // õ
-    { 16, 19, 19, 2, 19, 76, 13387 }, // ö
-    { 16, 15, 20, 3, 15, 60, 13463 }, // ÷
-    { 24, 35, 22, -3, 24, 210, 13523 }, // ø
-    { 14, 18, 18, 2, 18, 63, 13733 }, // ù
-    { 14, 22, 18, 2, 22, 77, 13796 }, // ú
-    { 14, 19, 18, 2, 19, 67, 13873 }, // û
-    { 16, 20, 19, 2, 20, 80, 13940 }, // ü
-    { 17, 31, 19, 1, 25, 132, 14020 }, // ý
-    { 14, 22, 15, 0, 17, 77, 14152 }, // þ
-    { 18, 28, 20, 1, 22, 126, 14229 }, // ÿ
-    { 21, 25, 23, 1, 25, 132, 14355 }, // Ā
-    { 17, 20, 19, 1, 20, 85, 14487 }, // ā
-    { 21, 26, 23, 1, 26, 137, 14572 }, // Ă
-    { 17, 20, 19, 1, 20, 85, 14709 }, // ă
-    { 18, 24, 23, 1, 18, 108, 14794 }, // Ą
-    { 14, 19, 18, 1, 13, 67, 14902 }, // ą
-    { 18, 25, 21, 2, 25, 113, 14969 }, // Ć
-    { 12, 18, 16, 2, 18, 54, 15082 }, // ć
-    { 19, 27, 22, 2, 27, 129, 15136 }, // Ĉ
-    { 15, 19, 18, 2, 19, 72, 15265 }, // ĉ
-    { 18, 25, 21, 2, 25, 113, 15337 }, // Ċ
-    { 13, 18, 16, 2, 18, 59, 15450 }, // ċ
-    { 20, 27, 23, 2, 27, 135, 15509 }, // Č
-    { 16, 20, 19, 2, 20, 80, 15644 }, // č
-    { 20, 27, 22, 1, 27, 135, 15724 }, // Ď
-    { 20, 18, 23, 2, 18, 90, 15859 }, // ď
-    { 21, 18, 22, 0, 18, 95, 15949 }, // Đ
-    { 20, 18, 23, 2, 18, 90, 16044 }, // đ
-    { 19, 26, 21, 1, 26, 124, 16134 }, // Ē
-    { 16, 22, 19, 2, 22, 88, 16258 }, // ē
-    { 19, 26, 21, 1, 26, 124, 16346 }, // Ĕ
-    { 17, 22, 20, 2, 22, 94, 16470 }, // ĕ
-    { 18, 26, 20, 1, 26, 117, 16564 }, // Ė
-    { 14, 22, 18, 2, 22, 77, 16681 }, // ė
-    { 18, 23, 20, 1, 18, 104, 16758 }, // Ę
-    { 14, 20, 18, 2, 12, 70, 16862 }, // ę
-    { 20, 28, 22, 1, 28, 140, 16932 }, // Ě
-    { 18, 24, 21, 2, 24, 108, 17072 }, // ě
-    { 21, 29, 24, 2, 29, 153, 17180 }, // Ĝ
-    { 19, 28, 20, 0, 21, 133, 17333 }, // ĝ
-    { 22, 28, 25, 2, 28, 154, 17466 }, // Ğ
-    { 19, 27, 20, 0, 20, 129, 17620 }, // ğ
-    { 19, 28, 24, 2, 28, 133, 17749 }, // Ġ
-    { 17, 27, 18, 0, 20, 115, 17882 }, // ġ
-    { 20, 31, 24, 2, 31, 155, 17997 }, // Ģ
-    { 17, 28, 18, 0, 21, 119, 18152 }, // ģ
-    { 20, 26, 22, 1, 26, 130, 18271 }, // Ĥ
-    { 15, 26, 18, 1, 26, 98, 18401 }, // ĥ
-    { 21, 18, 23, 1, 18, 95, 18499 }, // Ħ
-    { 15, 18, 18, 1, 18, 68, 18594 }, // ħ
-    { 14, 27, 16, 1, 27, 95, 18662 }, // Ĩ
-    { 12, 20, 13, 0, 20, 60, 18757 }, // ĩ
-    { 15, 27, 17, 1, 27, 102, 18817 }, // Ī
-    { 13, 19, 14, 0, 19, 62, 18919 }, // ī
-    { 12, 23, 12, -1, 18, 69, 18981 }, // Į
-    { 13, 25, 12, -2, 19, 82, 19050 }, // į
-    { 13, 27, 15, 1, 27, 88, 19132 }, // İ
-    { 8, 12, 9, 0, 12, 24, 19220 }, // ı
-    { 21, 26, 33, 6, 18, 137, 19244 }, // Ĳ
-    { 21, 24, 22, 0, 19, 126, 19381 }, // ĳ
-    { 22, 31, 23, 0, 26, 171, 19507 }, // Ĵ
-    { 18, 27, 20, 1, 21, 122, 19678 }, // ĵ
-    { 19, 29, 21, 1, 29, 138, 19800 }, // Ķ
-    { 15, 29, 19, -1, 18, 109, 19938 }, // ķ
-    { 12, 12, 14, -2, 12, 36, 20047 }, // ĸ
-    { 14, 24, 18, 1, 24, 84, 20083 }, // Ĺ
-    { 13, 27, 15, 1, 27, 88, 20167 }, // ĺ
-    { 14, 29, 18, 1, 18, 102, 20255 }, // Ļ
-    { 13, 29, 12, -2, 18, 95, 20357 }, // ļ
-    { 16, 18, 18, 1, 18, 72, 20452 }, // Ľ
-    { 16, 21, 18, 1, 21, 84, 20524 }, // ľ
-    { 16, 18, 18, 1, 18, 72, 20608 }, // Ŀ
-    { 13, 18, 15, 1, 18, 59, 20680 }, // ŀ
-    { 32, 30, 23, -10, 24, 240, 20739 }, // Ł
-    { 22, 18, 16, -7, 18, 99, 20979 }, // ł
-    { 21, 25, 23, 1, 25, 132, 21078 }, // Ń
-    { 15, 20, 18, 1, 20, 75, 21210 }, // ń
-    { 21, 27, 23, 1, 18, 142, 21285 }, // Ņ
-    { 15, 21, 18, 1, 13, 79, 21427 }, // ņ
-    { 22, 27, 24, 1, 27, 149, 21506 }, // Ň
-    { 19, 22, 21, 1, 22, 105, 21655 }, // ň
-    { 28, 21, 18, -12, 21, 147, 21760 }, // ŉ
-    { 21, 23, 23, 1, 18, 121, 21907 }, // Ŋ
-    { 15, 17, 18, 1, 13, 64, 22028 }, // ŋ
-    { 21, 26, 24, 2, 25, 137, 22092 }, // Ō
-    { 16, 19, 19, 2, 19, 76, 22229 }, // ō
-    { 21, 27, 24, 2, 26, 142, 22305 }, // Ŏ
-    { 16, 20, 19, 2, 20, 80, 22447 }, // ŏ
-    { 23, 25, 26, 2, 24, 144, 22527 }, // Ő
-    { 19, 18, 22, 2, 18, 86, 22671 }, // ő
-    { 28, 20, 31, 2, 19, 140, 22757 }, // Œ
-    { 22, 12, 25, 2, 12, 66, 22897 }, // œ
-    { 17, 25, 20, 1, 25, 107, 22963 }, // Ŕ
-    { 12, 17, 15, 1, 17, 51, 23070 }, // ŕ
-    { 17, 29, 20, 1, 29, 124, 23121 }, // Ŗ
-    { 13, 22, 15, 1, 22, 72, 23245 }, // ŗ
-    { 19, 26, 21, 1, 26, 124, 23317 }, // Ř
-    { 15, 19, 17, 1, 19, 72, 23441 }, // ř
-    { 18, 25, 22, 1, 25, 113, 23513 }, // Ś
-    { 14, 19, 18, 1, 18, 67, 23626 }, // ś
-    { 20, 26, 22, 1, 26, 130, 23693 }, // Ŝ
-    { 17, 20, 19, 1, 19, 85, 23823 }, // ŝ
-    { 18, 23, 22, 1, 18, 104, 23908 }, // Ş
-    { 14, 19, 18, 1, 13, 67, 24012 }, // ş
-    { 21, 26, 23, 1, 26, 137, 24079 }, // Š
-    { 18, 21, 20, 1, 20, 95, 24216 }, // š
-    { 17, 24, 23, 5, 18, 102, 24311 }, // Ţ
-    { 13, 22, 16, 2, 17, 72, 24413 }, // ţ
-    { 17, 26, 23, 5, 26, 111, 24485 }, // Ť
-    { 16, 20, 21, 4, 20, 80, 24596 }, // ť
-    { 17, 18, 23, 5, 18, 77, 24676 }, // Ŧ
-    { 13, 17, 16, 2, 17, 56, 24753 }, // ŧ
-    { 21, 28, 23, 1, 27, 147, 24809 }, // Ũ
-    { 15, 20, 18, 2, 20, 75, 24956 }, // ũ
-    { 21, 28, 23, 1, 27, 147, 25031 }, // Ū
-    { 16, 19, 19, 2, 19, 76, 25178 }, // ū
-    { 21, 28, 23, 1, 27, 147, 25254 }, // Ŭ
-    { 16, 20, 19, 2, 20, 80, 25401 }, // ŭ
-    { 21, 29, 23, 1, 28, 153, 25481 }, // Ů
-    { 14, 21, 18, 2, 21, 74, 25634 }, // ů
-    { 23, 27, 25, 1, 26, 156, 25708 }, // Ű
-    { 19, 19, 22, 2, 19, 91, 25864 }, // ű
-    { 21, 23, 23, 1, 18, 121, 25955 }, // Ų
-    { 14, 18, 18, 2, 12, 63, 26076 }, // ų
-    { 25, 26, 31, 5, 26, 163, 26139 }, // Ŵ
-    { 18, 22, 23, 4, 21, 99, 26302 }, // ŵ
-    { 16, 28, 23, 6, 28, 112, 26401 }, // Ŷ
-    { 17, 28, 19, 1, 22, 119, 26513 }, // ŷ
-    { 16, 28, 23, 6, 28, 112, 26632 }, // Ÿ
-    { 22, 24, 24, 1, 24, 132, 26744 }, // Ź
-    { 16, 20, 18, 1, 20, 80, 26876 }, // ź
-    { 22, 24, 24, 1, 24, 132, 26956 }, // Ż
-    { 16, 20, 18, 1, 20, 80, 27088 }, // ż
-    { 22, 26, 24, 1, 26, 143, 27168 }, // Ž
-    { 19, 21, 21, 1, 21, 100, 27311 }, // ž
-    { 12, 17, 15, 2, 17, 51, 27411 }, // ſ
-    { 25, 21, 28, 2, 20, 132, 27462 }, // Ơ
-    { 17, 14, 20, 2, 14, 60, 27594 }, // ơ
-    { 17, 18, 19, 1, 18, 77, 27654 }, // Ƥ
-    { 19, 23, 20, -1, 16, 110, 27731 }, // ƥ
-    { 16, 16, 17, 0, 15, 64, 27841 }, // Ʃ
-    { 18, 18, 23, 4, 18, 81, 27905 }, // Ƭ
-    { 12, 20, 17, 4, 20, 60, 27986 }, // ƭ
-    { 17, 22, 23, 5, 18, 94, 28046 }, // Ʈ
-    { 23, 23, 25, 1, 22, 133, 28140 }, // Ư
-    { 17, 16, 20, 2, 16, 68, 28273 }, // ư
-    { 8, 4, 13, 4, 16, 8, 28341 }, // ̀
-    { 7, 5, 11, 3, 16, 9, 28349 }, // ́
-    { 12, 6, 12, -1, 1, 18, 28358 }, // ̂
-    { 9, 5, 14, 4, 16, 12, 28376 }, // ̃
-    { 12, 4, 17, 4, 15, 12, 28388 }, // ̄
-    { 15, 4, 21, 5, 19, 15, 28400 }, // ̅
-    { 11, 6, 16, 4, 16, 17, 28415 }, // ̆
-    { 6, 5, 11, 4, 17, 8, 28432 }, // ̇
-    { 10, 4, 14, 3, 15, 10, 28440 }, // ̈
-    { 5, 6, 13, 7, 14, 8, 28450 }, // ̉
-    { 6, 5, 11, 4, 16, 8, 28458 }, // ̊
-    { 17, 4, 22, 4, 16, 17, 28466 }, // ̋
-    { 12, 6, 17, 4, 17, 18, 28483 }, // ̌
-    { 18, 4, 11, -8, 16, 18, 28501 }, // ̏
-    { 10, 8, 13, 2, 17, 20, 28519 }, // ̒
-    { 10, 8, 13, 2, 16, 20, 28539 }, // ̓
-    { 9, 8, 5, -5, 16, 18, 28559 }, // ̔
-    { 6, 6, 7, 0, 0, 9, 28577 }, // ̘
-    { 6, 6, 8, 1, 0, 9, 28586 }, // ̙
-    { 10, 6, 16, 5, 17, 15, 28595 }, // ̚
-    { 5, 7, 9, 3, 15, 9, 28610 }, // ̛
-    { 5, 7, 5, -1, 0, 9, 28619 }, // ̜
-    { 6, 6, 9, 2, 4, 9, 28628 }, // ̝
-    { 6, 6, 6, -1, 0, 9, 28637 }, // ̞
-    { 5, 5, 6, 0, -2, 7, 28646 }, // ̟
-    { 12, 4, 12, -1, -2, 12, 28653 }, // ̠
-    { 6, 5, 4, -3, 2, 8, 28665 }, // ̣
-    { 11, 4, 10, -2, -1, 11, 28673 }, // ̤
-    { 6, 5, 11, 4, 16, 8, 28684 }, // ̥
-    { 10, 8, 10, -1, 4, 20, 28692 }, // ̦
-    { 7, 7, 7, -1, 1, 13, 28712 }, // ̧
-    { 7, 8, 8, 0, 2, 14, 28725 }, // ̨
-    { 7, 7, 6, -2, -1, 13, 28739 }, // ̩
-    { 10, 5, 10, -1, 0, 13, 28752 }, // ̪
-    { 14, 6, 14, -1, 1, 21, 28765 }, // ̬
-    { 13, 6, 13, -1, 1, 20, 28786 }, // ̭
-    { 10, 6, 16, 5, 18, 15, 28806 }, // ̰
-    { 11, 4, 17, 5, 18, 11, 28821 }, // ̱
-    { 11, 4, 11, -1, -1, 11, 28832 }, // ̲
-    { 11, 6, 17, 5, 18, 17, 28843 }, // ̴
-    { 12, 3, 14, 1, 8, 9, 28860 }, // ̵
-    { 5, 8, 7, 1, 1, 10, 28869 }, // ̹
-    { 11, 7, 9, -3, 1, 20, 28879 }, // ̺
-    { 10, 7, 10, -1, 1, 18, 28899 }, // ̻
-    { 10, 6, 10, -1, 1, 15, 28917 }, // ̼
-    { 7, 5, 12, 4, 16, 9, 28932 }, // ̽
-    { 9, 5, 14, 4, 16, 12, 28941 }, // ͂
-    { 5, 6, 14, 8, 19, 8, 28953 }, // ̓
-    { 13, 15, 17, 3, 26, 49, 28961 }, // ̈́
-    { 11, 5, 15, 3, 17, 14, 29010 }, // ͆
-    { 14, 8, 13, -2, 0, 28, 29024 }, // ͇
-    { 11, 7, 11, -1, 1, 20, 29052 }, // ͈
-    { 9, 6, 9, -1, -1, 14, 29072 }, // ͉
-    { 15, 17, 19, 3, 23, 64, 29086 }, // ͊
-    { 21, 16, 29, 7, 24, 84, 29150 }, // ͋
-    { 15, 13, 27, 11, 12, 49, 29234 }, // ͌
-    { 11, 24, 13, 1, 8, 66, 29283 }, // ͍
-    { 5, 4, 16, 10, 3, 5, 29349 }, // ͎
-    { 19, 5, 20, 0, 1, 24, 29354 }, // ͜
-    { 19, 6, 23, 3, 17, 29, 29378 }, // ͡
-    { 23, 7, 23, -1, 0, 41, 29407 }, // ͢
-    { 18, 18, 23, 1, 18, 81, 29448 }, // Α
-    { 17, 18, 19, 1, 18, 77, 29529 }, // Β
-    { 16, 19, 17, 0, 17, 76, 29606 }, // Γ
-    { 18, 17, 19, 0, 16, 77, 29682 }, // Δ
-    { 18, 18, 20, 1, 18, 81, 29759 }, // Ε
-    { 22, 18, 24, 1, 18, 99, 29840 }, // Ζ
-    { 20, 18, 22, 1, 18, 90, 29939 }, // Η
-    { 21, 19, 24, 2, 18, 100, 30029 }, // Θ
-    { 10, 18, 12, 1, 18, 45, 30129 }, // Ι
-    { 19, 18, 21, 1, 18, 86, 30174 }, // Κ
-    { 18, 18, 44, 25, 18, 81, 30260 }, // Λ
-    { 23, 18, 25, 1, 18, 104, 30341 }, // Μ
-    { 21, 18, 23, 1, 18, 95, 30445 }, // Ν
-    { 19, 16, 20, 0, 15, 76, 30540 }, // Ξ
-    { 21, 19, 24, 2, 18, 100, 30616 }, // Ο
-    { 16, 16, 17, 0, 15, 64, 30716 }, // Π
-    { 17, 18, 19, 1, 18, 77, 30780 }, // Ρ
-    { 16, 16, 17, 0, 15, 64, 30857 }, // Σ
-    { 17, 18, 23, 5, 18, 77, 30921 }, // Τ
-    { 16, 18, 23, 6, 18, 72, 30998 }, // Υ
-    { 25, 23, 30, 4, 19, 144, 31070 }, // Φ
-    { 22, 18, 24, 1, 18, 99, 31214 }, // Χ
-    { 19, 20, 22, 2, 18, 95, 31313 }, // Ψ
-    { 20, 18, 22, 1, 16, 90, 31408 }, // Ω
-    { 17, 15, 20, 1, 13, 64, 31498 }, // α
-    { 17, 25, 17, -1, 20, 107, 31562 }, // β
-    { 13, 19, 17, 3, 12, 62, 31669 }, // γ
-    { 16, 19, 18, 1, 18, 76, 31731 }, // δ
-    { 11, 12, 13, 1, 11, 33, 31807 }, // ε
-    { 14, 20, 16, 1, 16, 70, 31840 }, // ζ
-    { 15, 20, 18, 2, 14, 75, 31910 }, // η
-    { 16, 17, 18, 1, 16, 68, 31985 }, // θ
-    { 8, 15, 13, 1, 15, 30, 32053 }, // ι
-    { 13, 12, 15, -1, 12, 39, 32083 }, // κ
-    { 17, 18, 18, -16, 18, 77, 32122 }, // λ
-    { 17, 15, 18, -1, 12, 64, 32199 }, // μ
-    { 13, 13, 17, 3, 12, 43, 32263 }, // ν
-    { 11, 20, 15, 3, 16, 55, 32306 }, // ξ
-    { 14, 12, 18, 2, 12, 42, 32361 }, // ο
-    { 15, 12, 18, 2, 11, 45, 32403 }, // π
-    { 18, 18, 18, -1, 13, 81, 32448 }, // ρ
-    { 11, 16, 15, 3, 16, 44, 32529 }, // ς
-    { 18, 12, 21, 2, 12, 54, 32573 }, // σ
-    { 13, 12, 17, 3, 11, 39, 32627 }, // τ
-    { 12, 13, 14, 1, 12, 39, 32666 }, // υ
-    { 21, 27, 24, 2, 22, 142, 32705 }, // φ
-    { 20, 18, 20, -1, 13, 90, 32847 }, // χ
-    { 13, 23, 16, 2, 16, 75, 32937 }, // ψ
-    { 16, 13, 19, 2, 12, 52, 33012 }, // ω
-    { 18, 24, 23, 1, 18, 108, 33064 }, // Ạ
-    { 15, 21, 18, 0, 13, 79, 33172 }, // ạ
-    { 18, 26, 23, 1, 26, 117, 33251 }, // Ả
-    { 14, 20, 18, 1, 20, 70, 33368 }, // ả
-    { 20, 32, 23, 1, 32, 160, 33438 }, // Ấ
-    { 21, 23, 23, 1, 23, 121, 33598 }, // ấ
-    { 20, 28, 23, 1, 28, 140, 33719 }, // Ầ
-    { 15, 24, 18, 1, 24, 90, 33859 }, // ầ
-    { 20, 32, 23, 1, 32, 160, 33949 }, // Ẩ
-    { 20, 24, 22, 1, 24, 120, 34109 }, // ẩ
-    { 21, 30, 23, 1, 30, 158, 34229 }, // Ẫ
-    { 16, 25, 18, 1, 25, 100, 34387 }, // ẫ
-    { 19, 31, 23, 1, 25, 148, 34487 }, // Ậ
-    { 16, 27, 18, 0, 19, 108, 34635 }, // ậ
-    { 21, 32, 23, 1, 32, 168, 34743 }, // Ắ
-    { 17, 27, 19, 1, 27, 115, 34911 }, // ắ
-    { 21, 32, 23, 1, 32, 168, 35026 }, // Ằ
-    { 17, 27, 19, 1, 27, 115, 35194 }, // ằ
-    { 21, 33, 23, 1, 33, 174, 35309 }, // Ẳ
-    { 17, 28, 19, 1, 28, 119, 35483 }, // ẳ
-    { 22, 33, 24, 1, 33, 182, 35602 }, // Ẵ
-    { 18, 28, 20, 1, 28, 126, 35784 }, // ẵ
-    { 21, 32, 23, 1, 26, 168, 35910 }, // Ặ
-    { 18, 28, 19, 0, 20, 126, 36078 }, // ặ
-    { 18, 26, 20, 1, 18, 117, 36204 }, // Ẹ
-    { 15, 21, 18, 1, 12, 79, 36321 }, // ẹ
-    { 18, 26, 20, 1, 26, 117, 36400 }, // Ẻ
-    { 14, 22, 18, 2, 22, 77, 36517 }, // ẻ
-    { 18, 27, 20, 1, 27, 122, 36594 }, // Ẽ
-    { 15, 22, 18, 2, 22, 83, 36716 }, // ẽ
-    { 21, 29, 23, 1, 29, 153, 36799 }, // Ế
-    { 23, 22, 26, 2, 22, 127, 36952 }, // ế
-    { 22, 29, 24, 1, 29, 160, 37079 }, // Ề
-    { 15, 24, 18, 2, 24, 90, 37239 }, // ề
-    { 21, 29, 23, 1, 29, 153, 37329 }, // Ể
-    { 20, 26, 23, 2, 26, 130, 37482 }, // ể
-    { 18, 31, 20, 1, 31, 140, 37612 }, // Ễ
-    { 18, 27, 21, 2, 27, 122, 37752 }, // ễ
-    { 18, 34, 20, 1, 26, 153, 37874 }, // Ệ
-    { 16, 30, 18, 1, 21, 120, 38027 }, // ệ
-    { 12, 27, 14, 1, 27, 81, 38147 }, // Ỉ
-    { 10, 20, 11, 0, 20, 50, 38228 }, // ỉ
-    { 15, 27, 12, -4, 18, 102, 38278 }, // Ị
-    { 13, 28, 12, -2, 19, 91, 38380 }, // ị
-    { 21, 28, 24, 2, 18, 147, 38471 }, // Ọ
-    { 16, 20, 18, 0, 12, 80, 38618 }, // ọ
-    { 21, 27, 24, 2, 26, 142, 38698 }, // Ỏ
-    { 14, 20, 18, 2, 20, 70, 38840 }, // ỏ
-    { 24, 26, 27, 2, 25, 156, 38910 }, // Ố
-    { 22, 20, 25, 2, 20, 110, 39066 }, // ố
-    { 21, 28, 24, 2, 27, 147, 39176 }, // Ồ
-    { 14, 23, 18, 2, 23, 81, 39323 }, // ồ
-    { 21, 29, 24, 2, 28, 153, 39404 }, // Ổ
-    { 19, 23, 22, 2, 23, 110, 39557 }, // ổ
-    { 21, 31, 24, 2, 30, 163, 39667 }, // Ỗ
-    { 15, 24, 18, 2, 24, 90, 39830 }, // ỗ
-    { 21, 35, 24, 2, 25, 184, 39920 }, // Ộ
-    { 15, 28, 18, 1, 19, 105, 40104 }, // ộ
-    { 25, 26, 28, 2, 25, 163, 40209 }, // Ớ
-    { 17, 19, 20, 2, 19, 81, 40372 }, // ớ
-    { 25, 26, 28, 2, 25, 163, 40453 }, // Ờ
-    { 17, 19, 20, 2, 19, 81, 40616 }, // ờ
-    { 25, 27, 28, 2, 26, 169, 40697 }, // Ở
-    { 17, 20, 20, 2, 20, 85, 40866 }, // ở
-    { 25, 27, 28, 2, 26, 169, 40951 }, // Ỡ
-    { 17, 21, 20, 2, 21, 90, 41120 }, // ỡ
-    { 25, 30, 28, 2, 20, 188, 41210 }, // Ợ
-    { 19, 22, 20, 0, 14, 105, 41398 }, // ợ
-    { 21, 28, 23, 1, 18, 147, 41503 }, // Ụ
-    { 16, 22, 18, 0, 12, 88, 41650 }, // ụ
-    { 21, 28, 23, 1, 27, 147, 41738 }, // Ủ
-    { 14, 20, 18, 2, 20, 70, 41885 }, // ủ
-    { 23, 27, 25, 1, 26, 156, 41955 }, // Ứ
-    { 17, 19, 20, 2, 19, 81, 42111 }, // ứ
-    { 23, 27, 25, 1, 26, 156, 42192 }, // Ừ
-    { 17, 19, 20, 2, 19, 81, 42348 }, // ừ
-    { 23, 28, 25, 1, 27, 161, 42429 }, // Ử
-    { 17, 20, 20, 2, 20, 85, 42590 }, // ử
-    { 23, 28, 25, 1, 27, 161, 42675 }, // Ữ
-    { 17, 20, 20, 2, 20, 85, 42836 }, // ữ
-    { 23, 32, 25, 1, 22, 184, 42921 }, // Ự
-    { 19, 26, 20, 0, 16, 124, 43105 }, // ự
-    { 16, 27, 23, 6, 27, 108, 43229 }, // Ỳ
-    { 17, 27, 19, 1, 21, 115, 43337 }, // ỳ
-    { 20, 29, 23, 2, 18, 145, 43452 }, // Ỵ
-    { 17, 20, 19, 1, 12, 85, 43597 }, // ỵ
-    { 16, 28, 23, 6, 28, 112, 43682 }, // Ỷ
-    { 17, 28, 19, 1, 22, 119, 43794 }, // ỷ
-    { 16, 28, 23, 6, 28, 112, 43913 }, // Ỹ
-    { 17, 29, 19, 1, 23, 124, 44025 }, // ỹ
-    { 0, 0, 14, 0, 0, 0, 44149 }, //  
-    { 0, 0, 24, 0, 0, 0, 44149 }, //  
-    { 0, 0, 14, 0, 0, 0, 44149 }, //  
-    { 0, 0, 24, 0, 0, 0, 44149 }, //  
-    { 0, 0, 10, 0, 0, 0, 44149 }, //  
-    { 0, 0, 9, 0, 0, 0, 44149 }, //  
-    { 0, 0, 7, 0, 0, 0, 44149 }, //  
-    { 0, 0, 15, 0, 0, 0, 44149 }, //  
-    { 0, 0, 5, 0, 0, 0, 44149 }, //  
-    { 0, 0, 8, 0, 0, 0, 44149 }, //  
-    { 0, 0, 6, 0, 0, 0, 44149 }, //  
-    { 0, 0, 3, 0, 0, 0, 44149 }, // ​
-    { 0, 0, 1, 0, 0, 0, 44149 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 44149 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 44149 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 44149 }, // ‏
-    { 12, 3, 14, 1, 8, 9, 44149 }, // ‐
-    { 12, 3, 14, 1, 8, 9, 44158 }, // ‑
-    { 18, 3, 18, -1, 8, 14, 44167 }, // ‒
-    { 16, 5, 19, 2, 9, 20, 44181 }, // –
-    { 23, 5, 26, 2, 9, 29, 44201 }, // —
-    { 23, 5, 26, 2, 9, 29, 44230 }, // ―
-    { 15, 19, 17, 1, 15, 72, 44259 }, // ‖
-    { 20, 8, 16, -5, -1, 40, 44331 }, // ‗
-    { 9, 8, 14, 4, 19, 18, 44371 }, // ‘
-    { 9, 8, 14, 4, 19, 18, 44389 }, // ’
-    { 9, 8, 9, -1, 4, 18, 44407 }, // ‚
-    { 9, 8, 14, 4, 19, 18, 44425 }, // ‛
-    { 16, 8, 21, 4, 19, 32, 44443 }, // “
-    { 16, 8, 21, 4, 19, 32, 44475 }, // ”
-    { 9, 8, 9, -1, 4, 18, 44507 }, // „
-    { 16, 8, 21, 4, 19, 32, 44525 }, // ‟
-    { 13, 30, 19, 5, 22, 98, 44557 }, // †
-    { 15, 29, 20, 4, 21, 109, 44655 }, // ‡
-    { 18, 16, 17, -2, 19, 72, 44764 }, // •
-    { 7, 8, 13, 4, 10, 14, 44836 }, // ‣
-    { 7, 5, 13, 3, 5, 9, 44850 }, // ․
-    { 7, 5, 13, 3, 5, 9, 44859 }, // ‥
-    { 20, 5, 21, 0, 5, 25, 44868 }, // …
-    { 4, 3, 11, 4, 8, 3, 44893 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 44896 }, //  
-    { 19, 19, 24, 3, 17, 91, 44896 }, // ‰
-    { 10, 8, 17, 6, 19, 20, 44987 }, // ′
-    { 16, 8, 23, 6, 19, 32, 45007 }, // ″
-    { 16, 7, 15, -2, 18, 28, 45039 }, // ‴
-    { 6, 7, 12, 5, 18, 11, 45067 }, // ‵
-    { 9, 7, 14, 4, 18, 16, 45078 }, // ‶
-    { 16, 7, 17, 0, 18, 28, 45094 }, // ‷
-    { 12, 5, 17, 4, 18, 15, 45122 }, // ‸
-    { 9, 12, 12, 2, 12, 27, 45137 }, // ‹
-    { 9, 12, 9, -2, 12, 27, 45164 }, // ›
-    { 28, 28, 30, 1, 22, 196, 45191 }, // ※
-    { 12, 27, 15, 2, 24, 81, 45387 }, // ‼
-    { 17, 33, 21, 3, 28, 141, 45468 }, // ‽
-    { 12, 3, 17, 4, 18, 9, 45609 }, // ‾
-    { 11, 4, 16, 4, 14, 11, 45618 }, // ‿
-    { 16, 15, 18, 1, 19, 60, 45629 }, // ⁂
-    { 20, 18, 27, 4, 16, 90, 45689 }, // ⁄
-    { 29, 27, 35, 5, 24, 196, 45779 }, // ⁇
-    { 24, 28, 29, 4, 24, 168, 45975 }, // ⁈
-    { 23, 27, 22, -2, 24, 156, 46143 }, // ⁉
-    { 23, 36, 23, -1, 25, 207, 46299 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 46506 }, //  
-    { 7, 9, 16, 8, 18, 16, 46506 }, // ⁰
-    { 7, 8, 16, 8, 18, 14, 46522 }, // ⁴
-    { 8, 9, 16, 7, 18, 18, 46536 }, // ⁵
-    { 8, 9, 16, 7, 18, 18, 46554 }, // ⁶
-    { 7, 9, 17, 9, 18, 16, 46572 }, // ⁷
-    { 8, 9, 16, 7, 18, 18, 46588 }, // ⁸
-    { 8, 10, 16, 7, 18, 20, 46606 }, // ⁹
-    { 15, 13, 18, 1, 13, 49, 46626 }, // ⁿ
-    { 8, 9, 7, -6, 5, 18, 46675 }, // ₀
-    { 7, 9, 7, -7, 5, 16, 46693 }, // ₁
-    { 8, 9, 8, -7, 5, 18, 46709 }, // ₂
-    { 8, 9, 7, -7, 5, 18, 46727 }, // ₃
-    { 7, 8, 8, -6, 5, 14, 46745 }, // ₄
-    { 8, 9, 7, -7, 5, 18, 46759 }, // ₅
-    { 8, 9, 8, -7, 5, 18, 46777 }, // ₆
-    { 7, 10, 8, -5, 6, 18, 46795 }, // ₇
-    { 9, 9, 8, -7, 5, 21, 46813 }, // ₈
-    { 9, 9, 8, -7, 5, 21, 46834 }, // ₉
-    { 15, 29, 17, 1, 22, 109, 46855 }, // ₍
-    { 14, 29, 9, -6, 22, 102, 46964 }, // ₎
-    { 20, 27, 23, 2, 23, 135, 47066 }, // ₡
-    { 18, 19, 21, 2, 19, 86, 47201 }, // ₢
-    { 17, 19, 18, 0, 18, 81, 47287 }, // ₤
-    { 24, 18, 24, -1, 18, 108, 47368 }, // ₦
-    { 20, 18, 22, 1, 18, 90, 47476 }, // ₧
-    { 25, 19, 27, -1, 18, 119, 47566 }, // ₨
-    { 20, 18, 19, -2, 18, 90, 47685 }, // ₩
-    { 20, 16, 24, 3, 16, 80, 47775 }, // ₪
-    { 19, 18, 18, -2, 17, 86, 47855 }, // ₫
-    { 17, 20, 19, 1, 17, 85, 47941 }, // €
-    { 17, 18, 23, 5, 18, 77, 48026 }, // ₮
-    { 23, 18, 24, 0, 18, 104, 48103 }, // ₱
-    { 19, 27, 24, 2, 23, 129, 48207 }, // ₲
-    { 24, 18, 31, 6, 17, 108, 48336 }, // ₴
-    { 12, 17, 15, 2, 15, 51, 48444 }, // ₵
-    { 20, 19, 26, 5, 19, 95, 48495 }, // ₸
-    { 14, 17, 18, 3, 16, 60, 48590 }, // ₹
-    { 14, 16, 16, 1, 14, 56, 48650 }, // ₺
-    { 16, 18, 20, 3, 17, 72, 48706 }, // ₼
-    { 21, 18, 19, -3, 18, 95, 48778 }, // ₽
-    { 15, 15, 15, -4, 11, 57, 48873 }, // ←
-    { 15, 15, 18, 2, 14, 57, 48930 }, // ↑
-    { 15, 15, 20, 4, 11, 57, 48987 }, // →
-    { 15, 15, 22, 6, 14, 57, 49044 }, // ↓
-    { 24, 12, 24, -1, 10, 72, 49101 }, // ↔
-    { 13, 23, 17, 3, 22, 75, 49173 }, // ↕
-    { 15, 10, 16, -2, 10, 38, 49248 }, // ↖
-    { 14, 10, 17, 2, 10, 35, 49286 }, // ↗
-    { 12, 14, 17, 4, 12, 42, 49321 }, // ↘
-    { 11, 14, 13, -2, 12, 39, 49363 }, // ↙
-    { 17, 14, 20, 1, 13, 60, 49402 }, // ⇐
-    { 18, 17, 23, 4, 16, 77, 49462 }, // ⇑
-    { 17, 14, 21, 3, 13, 60, 49539 }, // ⇒
-    { 18, 17, 27, 8, 15, 77, 49599 }, // ⇓
-    { 21, 14, 23, 1, 13, 74, 49676 }, // ⇔
-    { 15, 21, 21, 5, 12, 79, 49750 }, // ⇕
-    { 17, 19, 19, 1, 18, 81, 49829 }, // ∂
-    { 23, 20, 24, 0, 19, 115, 49910 }, // ∅
-    { 18, 17, 19, 0, 16, 77, 50025 }, // ∆
-    { 17, 16, 20, 2, 15, 68, 50102 }, // ∏
-    { 17, 17, 24, 6, 16, 73, 50170 }, // ∐
-    { 16, 16, 17, 0, 15, 64, 50243 }, // ∑
-    { 12, 4, 14, 1, 8, 12, 50307 }, // −
-    { 22, 19, 25, 2, 18, 105, 50319 }, // √
-    { 19, 12, 22, 2, 14, 57, 50424 }, // ∞
-    { 21, 23, 22, 0, 17, 121, 50481 }, // ∫
-    { 9, 14, 10, 0, 14, 32, 50602 }, // ∶
-    { 15, 13, 30, 11, 12, 49, 50634 }, // ≈
-    { 20, 19, 27, 4, 17, 95, 50683 }, // ≠
-    { 20, 18, 18, -3, 16, 90, 50778 }, // ≤
-    { 20, 18, 21, 0, 16, 90, 50868 }, // ≥
+    { 12, 27, 12, -1, 24, 44, 0 }, // !
+    { 14, 8, 17, 2, 19, 21, 44 }, // "
+    { 26, 20, 27, 0, 17, 71, 65 }, // #
+    { 19, 25, 24, 2, 21, 70, 136 }, // $
+    { 20, 19, 25, 4, 17, 73, 206 }, // %
+    { 17, 18, 21, 3, 17, 59, 279 }, // &
+    { 7, 8, 11, 3, 17, 11, 338 }, // '
+    { 15, 29, 17, 1, 22, 61, 349 }, // (
+    { 14, 29, 9, -6, 22, 59, 410 }, // )
+    { 13, 12, 17, 3, 17, 31, 469 }, // *
+    { 12, 12, 15, 2, 12, 24, 500 }, // +
+    { 9, 8, 9, -1, 4, 12, 524 }, // ,
+    { 12, 3, 14, 1, 8, 11, 536 }, // -
+    { 6, 5, 7, 0, 5, 9, 547 }, // .
+    { 24, 36, 22, -3, 25, 91, 556 }, // /
+    { 16, 17, 18, 1, 16, 53, 647 }, // 0
+    { 12, 16, 15, 0, 16, 35, 700 }, // 1
+    { 16, 16, 17, 0, 16, 42, 735 }, // 2
+    { 15, 17, 17, 1, 17, 43, 777 }, // 3
+    { 14, 17, 17, 1, 16, 39, 820 }, // 4
+    { 15, 17, 16, 0, 16, 45, 859 }, // 5
+    { 15, 16, 17, 1, 16, 45, 904 }, // 6
+    { 13, 16, 18, 4, 16, 33, 949 }, // 7
+    { 15, 17, 17, 1, 16, 46, 982 }, // 8
+    { 16, 18, 18, 1, 17, 49, 1028 }, // 9
+    { 9, 14, 10, 0, 14, 18, 1077 }, // :
+    { 11, 17, 11, -1, 13, 27, 1095 }, // ;
+    { 18, 14, 17, -2, 14, 38, 1122 }, // <
+    { 13, 8, 15, 1, 10, 23, 1160 }, // =
+    { 17, 14, 19, 1, 14, 37, 1183 }, // >
+    { 16, 27, 20, 3, 24, 61, 1220 }, // ?
+    { 21, 19, 23, 1, 18, 79, 1281 }, // @
+    { 18, 18, 23, 1, 18, 50, 1360 }, // A
+    { 17, 18, 19, 1, 18, 54, 1410 }, // B
+    { 18, 19, 21, 2, 19, 49, 1464 }, // C
+    { 20, 18, 22, 1, 18, 56, 1513 }, // D
+    { 18, 18, 20, 1, 18, 45, 1569 }, // E
+    { 17, 18, 19, 1, 18, 42, 1614 }, // F
+    { 19, 19, 24, 2, 19, 62, 1656 }, // G
+    { 20, 18, 22, 1, 18, 59, 1718 }, // H
+    { 10, 18, 12, 1, 18, 29, 1777 }, // I
+    { 19, 23, 20, 0, 18, 50, 1806 }, // J
+    { 19, 18, 21, 1, 18, 56, 1856 }, // K
+    { 14, 18, 18, 1, 18, 38, 1912 }, // L
+    { 23, 18, 25, 1, 18, 77, 1950 }, // M
+    { 21, 18, 23, 1, 18, 64, 2027 }, // N
+    { 21, 19, 24, 2, 18, 62, 2091 }, // O
+    { 17, 18, 19, 1, 18, 49, 2153 }, // P
+    { 20, 22, 24, 2, 19, 69, 2202 }, // Q
+    { 17, 18, 20, 1, 18, 60, 2271 }, // R
+    { 18, 18, 22, 1, 18, 53, 2331 }, // S
+    { 17, 18, 23, 5, 18, 47, 2384 }, // T
+    { 21, 19, 23, 1, 18, 56, 2431 }, // U
+    { 18, 18, 25, 6, 18, 51, 2487 }, // V
+    { 25, 18, 31, 5, 18, 78, 2538 }, // W
+    { 22, 18, 24, 1, 18, 56, 2616 }, // X
+    { 16, 18, 23, 6, 18, 45, 2672 }, // Y
+    { 22, 18, 24, 1, 18, 51, 2717 }, // Z
+    { 16, 31, 16, -1, 23, 68, 2768 }, // [
+    { 5, 24, 10, 4, 19, 32, 2836 }, // <backslash>
+    { 16, 31, 12, -5, 23, 66, 2868 }, // ]
+    { 12, 6, 16, 3, 20, 14, 2934 }, // ^
+    { 16, 5, 15, -2, -1, 12, 2948 }, // _
+    { 8, 4, 13, 4, 16, 8, 2960 }, // `
+    { 14, 13, 18, 1, 13, 34, 2968 }, // a
+    { 13, 19, 18, 3, 18, 48, 3002 }, // b
+    { 12, 13, 16, 2, 13, 26, 3050 }, // c
+    { 17, 18, 20, 2, 18, 48, 3076 }, // d
+    { 14, 12, 18, 2, 12, 36, 3124 }, // e
+    { 12, 17, 15, 2, 17, 30, 3160 }, // f
+    { 17, 19, 18, 0, 12, 53, 3190 }, // g
+    { 15, 18, 18, 1, 18, 50, 3243 }, // h
+    { 11, 19, 12, 0, 19, 29, 3293 }, // i
+    { 14, 25, 16, 1, 19, 47, 3322 }, // j
+    { 13, 18, 19, 1, 18, 44, 3369 }, // k
+    { 10, 18, 12, 1, 18, 31, 3413 }, // l
+    { 22, 13, 25, 1, 13, 56, 3444 }, // m
+    { 15, 13, 18, 1, 13, 38, 3500 }, // n
+    { 14, 12, 18, 2, 12, 31, 3538 }, // o
+    { 19, 19, 20, -1, 13, 53, 3569 }, // p
+    { 15, 19, 20, 2, 13, 51, 3622 }, // q
+    { 12, 12, 15, 1, 12, 20, 3673 }, // r
+    { 14, 14, 18, 1, 13, 33, 3693 }, // s
+    { 11, 17, 16, 4, 17, 33, 3726 }, // t
+    { 14, 12, 18, 2, 12, 38, 3759 }, // u
+    { 15, 12, 20, 4, 12, 32, 3797 }, // v
+    { 18, 13, 23, 4, 12, 48, 3829 }, // w
+    { 18, 12, 20, 1, 12, 36, 3877 }, // x
+    { 17, 18, 19, 1, 12, 47, 3913 }, // y
+    { 16, 12, 18, 1, 12, 31, 3960 }, // z
+    { 14, 21, 17, 2, 16, 41, 3991 }, // {
+    { 9, 19, 11, 1, 15, 29, 4032 }, // |
+    { 14, 21, 15, -1, 16, 42, 4061 }, // }
+    { 9, 5, 14, 4, 16, 15, 4103 }, // ~
+    { 0, 0, 18, 0, 0, 0, 4118 }, //  
+    { 11, 27, 14, 2, 23, 39, 4118 }, // ¡
+    { 12, 20, 16, 2, 16, 47, 4157 }, // ¢
+    { 17, 20, 18, 0, 19, 46, 4204 }, // £
+    { 15, 13, 17, 1, 14, 38, 4250 }, // ¤
+    { 18, 19, 21, 2, 16, 55, 4288 }, // ¥
+    { 8, 19, 10, 1, 15, 26, 4343 }, // ¦
+    { 16, 18, 18, 1, 17, 47, 4369 }, // §
+    { 12, 5, 16, 3, 17, 18, 4416 }, // ¨
+    { 11, 9, 18, 6, 20, 27, 4434 }, // ©
+    { 8, 7, 15, 6, 16, 17, 4461 }, // ª
+    { 15, 12, 18, 2, 12, 35, 4478 }, // «
+    { 12, 8, 15, 2, 8, 16, 4513 }, // ¬
+    { 12, 3, 15, 2, 8, 11, 4529 }, // ­
+    { 11, 9, 18, 6, 23, 29, 4540 }, // ®
+    { 10, 4, 15, 4, 16, 5, 4569 }, // ¯
+    { 12, 10, 17, 4, 16, 24, 4574 }, // °
+    { 16, 16, 17, 0, 12, 34, 4598 }, // ±
+    { 8, 8, 16, 7, 17, 17, 4632 }, // ²
+    { 8, 8, 16, 7, 17, 15, 4649 }, // ³
+    { 7, 5, 11, 3, 16, 9, 4664 }, // ´
+    { 17, 15, 18, -1, 12, 46, 4673 }, // µ
+    { 16, 18, 18, 1, 15, 56, 4719 }, // ¶
+    { 7, 5, 9, 1, 10, 9, 4775 }, // ·
+    { 7, 7, 7, -1, 1, 13, 4784 }, // ¸
+    { 6, 8, 14, 7, 17, 15, 4797 }, // ¹
+    { 8, 7, 15, 6, 15, 16, 4812 }, // º
+    { 15, 12, 16, -3, 12, 35, 4828 }, // »
+    { 22, 20, 27, 2, 18, 81, 4863 }, // ¼
+    { 23, 20, 27, 2, 18, 76, 4944 }, // ½
+    { 22, 19, 27, 2, 17, 77, 5020 }, // ¾
+    { 16, 26, 15, -2, 15, 56, 5097 }, // ¿
+    { 18, 24, 23, 1, 24, 60, 5153 }, // À
+    { 19, 28, 23, 1, 28, 67, 5213 }, // Á
+    { 19, 25, 23, 1, 25, 66, 5280 }, // Â
+    { 19, 25, 23, 1, 25, 67, 5346 }, // Ã
+    { 21, 25, 23, 1, 25, 73, 5413 }, // Ä
+    { 18, 25, 23, 1, 25, 64, 5486 }, // Å
+    { 29, 19, 31, 1, 18, 74, 5550 }, // Æ
+    { 18, 25, 21, 2, 19, 62, 5624 }, // Ç
+    { 18, 25, 20, 1, 25, 57, 5686 }, // È
+    { 18, 28, 20, 1, 28, 62, 5743 }, // É
+    { 18, 26, 20, 1, 26, 61, 5805 }, // Ê
+    { 19, 26, 21, 1, 26, 68, 5866 }, // Ë
+    { 12, 25, 14, 1, 25, 39, 5934 }, // Ì
+    { 13, 29, 15, 1, 29, 49, 5973 }, // Í
+    { 13, 26, 15, 1, 26, 48, 6022 }, // Î
+    { 15, 27, 17, 1, 27, 58, 6070 }, // Ï
+    { 21, 18, 22, 0, 18, 60, 6128 }, // Ð
+    { 21, 25, 23, 1, 25, 83, 6188 }, // Ñ
+    { 21, 25, 24, 2, 24, 74, 6271 }, // Ò
+    { 21, 28, 24, 2, 27, 79, 6345 }, // Ó
+    { 21, 26, 24, 2, 25, 79, 6424 }, // Ô
+    { 21, 26, 24, 2, 25, 79, 6503 }, // Õ
+    { 21, 26, 24, 2, 25, 84, 6582 }, // Ö
+    { 14, 7, 15, 0, 9, 18, 6666 }, // ×
+    { 41, 37, 34, -8, 28, 165, 6684 }, // Ø
+    { 21, 26, 23, 1, 25, 72, 6849 }, // Ù
+    { 21, 30, 23, 1, 29, 77, 6921 }, // Ú
+    { 21, 27, 23, 1, 26, 75, 6998 }, // Û
+    { 21, 28, 23, 1, 27, 81, 7073 }, // Ü
+    { 16, 30, 23, 6, 30, 62, 7154 }, // Ý
+    { 13, 17, 15, 1, 17, 41, 7216 }, // Þ
+    { 16, 18, 17, 0, 17, 55, 7257 }, // ß
+    { 14, 19, 18, 1, 19, 45, 7312 }, // à
+    { 15, 22, 18, 1, 22, 49, 7357 }, // á
+    { 15, 19, 18, 1, 19, 47, 7406 }, // â
+    { 15, 19, 18, 1, 19, 49, 7453 }, // ã
+    { 17, 20, 19, 1, 20, 51, 7502 }, // ä
+    { 14, 20, 18, 1, 20, 47, 7553 }, // å
+    { 23, 13, 26, 1, 13, 55, 7600 }, // æ
+    { 12, 18, 16, 2, 13, 36, 7655 }, // ç
+    { 14, 21, 18, 2, 21, 50, 7691 }, // è
+    { 15, 24, 18, 2, 24, 53, 7741 }, // é
+    { 15, 21, 18, 2, 21, 53, 7794 }, // ê
+    { 16, 22, 19, 2, 22, 58, 7847 }, // ë
+    { 10, 18, 11, 0, 18, 29, 7905 }, // ì
+    { 11, 22, 12, 0, 22, 32, 7934 }, // í
+    { 12, 19, 12, -1, 19, 34, 7966 }, // î
+    { 12, 18, 13, 0, 18, 33, 8000 }, // ï
+    { 20, 19, 21, 0, 18, 57, 8033 }, // ð
+    { 16, 20, 18, 1, 20, 54, 8090 }, // ñ
+    { 14, 18, 18, 2, 18, 42, 8144 }, // ò
+    { 14, 22, 18, 2, 22, 45, 8186 }, // ó
+    { 14, 19, 18, 2, 19, 45, 8231 }, // ô
+    { 14, 19, 18, 2, 19, 46, 8276 }, // õ
+    { 16, 19, 19, 2, 19, 51, 8322 }, // ö
+    { 16, 15, 20, 3, 15, 35, 8373 }, // ÷
+    { 24, 35, 22, -3, 24, 98, 8408 }, // ø
+    { 14, 18, 18, 2, 18, 47, 8506 }, // ù
+    { 14, 22, 18, 2, 22, 52, 8553 }, // ú
+    { 14, 19, 18, 2, 19, 51, 8605 }, // û
+    { 16, 20, 19, 2, 20, 56, 8656 }, // ü
+    { 17, 31, 19, 1, 25, 66, 8712 }, // ý
+    { 14, 22, 15, 0, 17, 56, 8778 }, // þ
+    { 18, 28, 20, 1, 22, 72, 8834 }, // ÿ
+    { 21, 25, 23, 1, 25, 70, 8906 }, // Ā
+    { 17, 20, 19, 1, 20, 48, 8976 }, // ā
+    { 21, 26, 23, 1, 26, 70, 9024 }, // Ă
+    { 17, 20, 19, 1, 20, 48, 9094 }, // ă
+    { 18, 24, 23, 1, 18, 62, 9142 }, // Ą
+    { 14, 19, 18, 1, 13, 47, 9204 }, // ą
+    { 18, 25, 21, 2, 25, 60, 9251 }, // Ć
+    { 12, 18, 16, 2, 18, 35, 9311 }, // ć
+    { 19, 27, 22, 2, 27, 67, 9346 }, // Ĉ
+    { 15, 19, 18, 2, 19, 41, 9413 }, // ĉ
+    { 18, 25, 21, 2, 25, 61, 9454 }, // Ċ
+    { 13, 18, 16, 2, 18, 38, 9515 }, // ċ
+    { 20, 27, 23, 2, 27, 71, 9553 }, // Č
+    { 16, 20, 19, 2, 20, 43, 9624 }, // č
+    { 20, 27, 22, 1, 27, 75, 9667 }, // Ď
+    { 20, 18, 23, 2, 18, 60, 9742 }, // ď
+    { 21, 18, 22, 0, 18, 60, 9802 }, // Đ
+    { 20, 18, 23, 2, 18, 57, 9862 }, // đ
+    { 19, 26, 21, 1, 26, 65, 9919 }, // Ē
+    { 16, 22, 19, 2, 22, 55, 9984 }, // ē
+    { 19, 26, 21, 1, 26, 63, 10039 }, // Ĕ
+    { 17, 22, 20, 2, 22, 54, 10102 }, // ĕ
+    { 18, 26, 20, 1, 26, 59, 10156 }, // Ė
+    { 14, 22, 18, 2, 22, 52, 10215 }, // ė
+    { 18, 23, 20, 1, 18, 55, 10267 }, // Ę
+    { 14, 20, 18, 2, 12, 51, 10322 }, // ę
+    { 20, 28, 22, 1, 28, 67, 10373 }, // Ě
+    { 18, 24, 21, 2, 24, 60, 10440 }, // ě
+    { 21, 29, 24, 2, 29, 84, 10500 }, // Ĝ
+    { 19, 28, 20, 0, 21, 74, 10584 }, // ĝ
+    { 22, 28, 25, 2, 28, 83, 10658 }, // Ğ
+    { 19, 27, 20, 0, 20, 73, 10741 }, // ğ
+    { 19, 28, 24, 2, 28, 78, 10814 }, // Ġ
+    { 17, 27, 18, 0, 20, 67, 10892 }, // ġ
+    { 20, 31, 24, 2, 31, 83, 10959 }, // Ģ
+    { 17, 28, 18, 0, 21, 73, 11042 }, // ģ
+    { 20, 26, 22, 1, 26, 78, 11115 }, // Ĥ
+    { 15, 26, 18, 1, 26, 65, 11193 }, // ĥ
+    { 21, 18, 23, 1, 18, 59, 11258 }, // Ħ
+    { 15, 18, 18, 1, 18, 51, 11317 }, // ħ
+    { 14, 27, 16, 1, 27, 54, 11368 }, // Ĩ
+    { 12, 20, 13, 0, 20, 39, 11422 }, // ĩ
+    { 15, 27, 17, 1, 27, 53, 11461 }, // Ī
+    { 13, 19, 14, 0, 19, 40, 11514 }, // ī
+    { 12, 23, 12, -1, 18, 37, 11554 }, // Į
+    { 13, 25, 12, -2, 19, 47, 11591 }, // į
+    { 13, 27, 15, 1, 27, 46, 11638 }, // İ
+    { 8, 12, 9, 0, 12, 20, 11684 }, // ı
+    { 21, 26, 33, 6, 18, 77, 11704 }, // Ĳ
+    { 21, 24, 22, 0, 19, 65, 11781 }, // ĳ
+    { 22, 31, 23, 0, 26, 80, 11846 }, // Ĵ
+    { 18, 27, 20, 1, 21, 55, 11926 }, // ĵ
+    { 19, 29, 21, 1, 29, 75, 11981 }, // Ķ
+    { 15, 29, 19, -1, 18, 67, 12056 }, // ķ
+    { 12, 12, 14, -2, 12, 28, 12123 }, // ĸ
+    { 14, 24, 18, 1, 24, 50, 12151 }, // Ĺ
+    { 13, 27, 15, 1, 27, 51, 12201 }, // ĺ
+    { 14, 29, 18, 1, 18, 58, 12252 }, // Ļ
+    { 13, 29, 12, -2, 18, 53, 12310 }, // ļ
+    { 16, 18, 18, 1, 18, 44, 12363 }, // Ľ
+    { 16, 21, 18, 1, 21, 49, 12407 }, // ľ
+    { 16, 18, 18, 1, 18, 44, 12456 }, // Ŀ
+    { 13, 18, 15, 1, 18, 45, 12500 }, // ŀ
+    { 32, 30, 23, -10, 24, 97, 12545 }, // Ł
+    { 22, 18, 16, -7, 18, 53, 12642 }, // ł
+    { 21, 25, 23, 1, 25, 80, 12695 }, // Ń
+    { 15, 20, 18, 1, 20, 51, 12775 }, // ń
+    { 21, 27, 23, 1, 18, 81, 12826 }, // Ņ
+    { 15, 21, 18, 1, 13, 54, 12907 }, // ņ
+    { 22, 27, 24, 1, 27, 88, 12961 }, // Ň
+    { 19, 22, 21, 1, 22, 61, 13049 }, // ň
+    { 28, 21, 18, -12, 21, 67, 13110 }, // ŉ
+    { 21, 23, 23, 1, 18, 76, 13177 }, // Ŋ
+    { 15, 17, 18, 1, 13, 46, 13253 }, // ŋ
+    { 21, 26, 24, 2, 25, 80, 13299 }, // Ō
+    { 16, 19, 19, 2, 19, 48, 13379 }, // ō
+    { 21, 27, 24, 2, 26, 80, 13427 }, // Ŏ
+    { 16, 20, 19, 2, 20, 46, 13507 }, // ŏ
+    { 23, 25, 26, 2, 24, 83, 13553 }, // Ő
+    { 19, 18, 22, 2, 18, 52, 13636 }, // ő
+    { 28, 20, 31, 2, 19, 78, 13688 }, // Œ
+    { 22, 12, 25, 2, 12, 56, 13766 }, // œ
+    { 17, 25, 20, 1, 25, 72, 13822 }, // Ŕ
+    { 12, 17, 15, 1, 17, 29, 13894 }, // ŕ
+    { 17, 29, 20, 1, 29, 79, 13923 }, // Ŗ
+    { 13, 22, 15, 1, 22, 36, 14002 }, // ŗ
+    { 19, 26, 21, 1, 26, 79, 14038 }, // Ř
+    { 15, 19, 17, 1, 19, 39, 14117 }, // ř
+    { 18, 25, 22, 1, 25, 65, 14156 }, // Ś
+    { 14, 19, 18, 1, 18, 43, 14221 }, // ś
+    { 20, 26, 22, 1, 26, 72, 14264 }, // Ŝ
+    { 17, 20, 19, 1, 19, 49, 14336 }, // ŝ
+    { 18, 23, 22, 1, 18, 64, 14385 }, // Ş
+    { 14, 19, 18, 1, 13, 44, 14449 }, // ş
+    { 21, 26, 23, 1, 26, 78, 14493 }, // Š
+    { 18, 21, 20, 1, 20, 51, 14571 }, // š
+    { 17, 24, 23, 5, 18, 60, 14622 }, // Ţ
+    { 13, 22, 16, 2, 17, 47, 14682 }, // ţ
+    { 17, 26, 23, 5, 26, 66, 14729 }, // Ť
+    { 16, 20, 21, 4, 20, 49, 14795 }, // ť
+    { 17, 18, 23, 5, 18, 51, 14844 }, // Ŧ
+    { 13, 17, 16, 2, 17, 41, 14895 }, // ŧ
+    { 21, 28, 23, 1, 27, 78, 14936 }, // Ũ
+    { 15, 20, 18, 2, 20, 56, 15014 }, // ũ
+    { 21, 28, 23, 1, 27, 75, 15070 }, // Ū
+    { 16, 19, 19, 2, 19, 51, 15145 }, // ū
+    { 21, 28, 23, 1, 27, 75, 15196 }, // Ŭ
+    { 16, 20, 19, 2, 20, 52, 15271 }, // ŭ
+    { 21, 29, 23, 1, 28, 75, 15323 }, // Ů
+    { 14, 21, 18, 2, 21, 53, 15398 }, // ů
+    { 23, 27, 25, 1, 26, 81, 15451 }, // Ű
+    { 19, 19, 22, 2, 19, 55, 15532 }, // ű
+    { 21, 23, 23, 1, 18, 67, 15587 }, // Ų
+    { 14, 18, 18, 2, 12, 48, 15654 }, // ų
+    { 25, 26, 31, 5, 26, 97, 15702 }, // Ŵ
+    { 18, 22, 23, 4, 21, 65, 15799 }, // ŵ
+    { 16, 28, 23, 6, 28, 64, 15864 }, // Ŷ
+    { 17, 28, 19, 1, 22, 66, 15928 }, // ŷ
+    { 16, 28, 23, 6, 28, 67, 15994 }, // Ÿ
+    { 22, 24, 24, 1, 24, 65, 16061 }, // Ź
+    { 16, 20, 18, 1, 20, 44, 16126 }, // ź
+    { 22, 24, 24, 1, 24, 66, 16170 }, // Ż
+    { 16, 20, 18, 1, 20, 45, 16236 }, // ż
+    { 22, 26, 24, 1, 26, 73, 16281 }, // Ž
+    { 19, 21, 21, 1, 21, 51, 16354 }, // ž
+    { 12, 17, 15, 2, 17, 29, 16405 }, // ſ
+    { 25, 21, 28, 2, 20, 75, 16434 }, // Ơ
+    { 17, 14, 20, 2, 14, 38, 16509 }, // ơ
+    { 17, 18, 19, 1, 18, 58, 16547 }, // Ƥ
+    { 19, 23, 20, -1, 16, 63, 16605 }, // ƥ
+    { 16, 16, 17, 0, 15, 43, 16668 }, // Ʃ
+    { 18, 18, 23, 4, 18, 49, 16711 }, // Ƭ
+    { 12, 20, 17, 4, 20, 38, 16760 }, // ƭ
+    { 17, 22, 23, 5, 18, 55, 16798 }, // Ʈ
+    { 23, 23, 25, 1, 22, 71, 16853 }, // Ư
+    { 17, 16, 20, 2, 16, 46, 16924 }, // ư
+    { 8, 4, 13, 4, 16, 8, 16970 }, // ̀
+    { 7, 5, 11, 3, 16, 9, 16978 }, // ́
+    { 12, 6, 12, -1, 1, 13, 16987 }, // ̂
+    { 9, 5, 14, 4, 16, 15, 17000 }, // ̃
+    { 12, 4, 17, 4, 15, 11, 17015 }, // ̄
+    { 15, 4, 21, 5, 19, 11, 17026 }, // ̅
+    { 11, 6, 16, 4, 16, 13, 17037 }, // ̆
+    { 6, 5, 11, 4, 17, 9, 17050 }, // ̇
+    { 10, 4, 14, 3, 15, 14, 17059 }, // ̈
+    { 5, 6, 13, 7, 14, 8, 17073 }, // ̉
+    { 6, 5, 11, 4, 16, 10, 17081 }, // ̊
+    { 17, 4, 22, 4, 16, 16, 17091 }, // ̋
+    { 12, 6, 17, 4, 17, 12, 17107 }, // ̌
+    { 18, 4, 11, -8, 16, 15, 17119 }, // ̏
+    { 10, 8, 13, 2, 17, 12, 17134 }, // ̒
+    { 10, 8, 13, 2, 16, 12, 17146 }, // ̓
+    { 9, 8, 5, -5, 16, 11, 17158 }, // ̔
+    { 6, 6, 7, 0, 0, 11, 17169 }, // ̘
+    { 6, 6, 8, 1, 0, 11, 17180 }, // ̙
+    { 10, 6, 16, 5, 17, 15, 17191 }, // ̚
+    { 5, 7, 9, 3, 15, 10, 17206 }, // ̛
+    { 5, 7, 5, -1, 0, 9, 17216 }, // ̜
+    { 6, 6, 9, 2, 4, 9, 17225 }, // ̝
+    { 6, 6, 6, -1, 0, 10, 17234 }, // ̞
+    { 5, 5, 6, 0, -2, 9, 17244 }, // ̟
+    { 12, 4, 12, -1, -2, 11, 17253 }, // ̠
+    { 6, 5, 4, -3, 2, 9, 17264 }, // ̣
+    { 11, 4, 10, -2, -1, 11, 17273 }, // ̤
+    { 6, 5, 11, 4, 16, 10, 17284 }, // ̥
+    { 10, 8, 10, -1, 4, 12, 17294 }, // ̦
+    { 7, 7, 7, -1, 1, 13, 17306 }, // ̧
+    { 7, 8, 8, 0, 2, 11, 17319 }, // ̨
+    { 7, 7, 6, -2, -1, 11, 17330 }, // ̩
+    { 10, 5, 10, -1, 0, 15, 17341 }, // ̪
+    { 14, 6, 14, -1, 1, 16, 17356 }, // ̬
+    { 13, 6, 13, -1, 1, 15, 17372 }, // ̭
+    { 10, 6, 16, 5, 18, 18, 17387 }, // ̰
+    { 11, 4, 17, 5, 18, 8, 17405 }, // ̱
+    { 11, 4, 11, -1, -1, 10, 17413 }, // ̲
+    { 11, 6, 17, 5, 18, 15, 17423 }, // ̴
+    { 12, 3, 14, 1, 8, 11, 17438 }, // ̵
+    { 5, 8, 7, 1, 1, 12, 17449 }, // ̹
+    { 11, 7, 9, -3, 1, 18, 17461 }, // ̺
+    { 10, 7, 10, -1, 1, 19, 17479 }, // ̻
+    { 10, 6, 10, -1, 1, 18, 17498 }, // ̼
+    { 7, 5, 12, 4, 16, 11, 17516 }, // ̽
+    { 9, 5, 14, 4, 16, 15, 17527 }, // ͂
+    { 5, 6, 14, 8, 19, 9, 17542 }, // ̓
+    { 13, 15, 17, 3, 26, 27, 17551 }, // ̈́
+    { 11, 5, 15, 3, 17, 12, 17578 }, // ͆
+    { 14, 8, 13, -2, 0, 22, 17590 }, // ͇
+    { 11, 7, 11, -1, 1, 19, 17612 }, // ͈
+    { 9, 6, 9, -1, -1, 12, 17631 }, // ͉
+    { 15, 17, 19, 3, 23, 41, 17643 }, // ͊
+    { 21, 16, 29, 7, 24, 48, 17684 }, // ͋
+    { 15, 13, 27, 11, 12, 39, 17732 }, // ͌
+    { 11, 24, 13, 1, 8, 23, 17771 }, // ͍
+    { 5, 4, 16, 10, 3, 6, 17794 }, // ͎
+    { 19, 5, 20, 0, 1, 18, 17800 }, // ͜
+    { 19, 6, 23, 3, 17, 20, 17818 }, // ͡
+    { 23, 7, 23, -1, 0, 25, 17838 }, // ͢
+    { 18, 18, 23, 1, 18, 50, 17863 }, // Α
+    { 17, 18, 19, 1, 18, 54, 17913 }, // Β
+    { 16, 19, 17, 0, 17, 39, 17967 }, // Γ
+    { 18, 17, 19, 0, 16, 48, 18006 }, // Δ
+    { 18, 18, 20, 1, 18, 45, 18054 }, // Ε
+    { 22, 18, 24, 1, 18, 51, 18099 }, // Ζ
+    { 20, 18, 22, 1, 18, 59, 18150 }, // Η
+    { 21, 19, 24, 2, 18, 69, 18209 }, // Θ
+    { 10, 18, 12, 1, 18, 29, 18278 }, // Ι
+    { 19, 18, 21, 1, 18, 56, 18307 }, // Κ
+    { 18, 18, 44, 25, 18, 51, 18363 }, // Λ
+    { 23, 18, 25, 1, 18, 77, 18414 }, // Μ
+    { 21, 18, 23, 1, 18, 64, 18491 }, // Ν
+    { 19, 16, 20, 0, 15, 40, 18555 }, // Ξ
+    { 21, 19, 24, 2, 18, 62, 18595 }, // Ο
+    { 16, 16, 17, 0, 15, 50, 18657 }, // Π
+    { 17, 18, 19, 1, 18, 49, 18707 }, // Ρ
+    { 16, 16, 17, 0, 15, 42, 18756 }, // Σ
+    { 17, 18, 23, 5, 18, 47, 18798 }, // Τ
+    { 16, 18, 23, 6, 18, 45, 18845 }, // Υ
+    { 25, 23, 30, 4, 19, 89, 18890 }, // Φ
+    { 22, 18, 24, 1, 18, 56, 18979 }, // Χ
+    { 19, 20, 22, 2, 18, 62, 19035 }, // Ψ
+    { 20, 18, 22, 1, 16, 58, 19097 }, // Ω
+    { 17, 15, 20, 1, 13, 40, 19155 }, // α
+    { 17, 25, 17, -1, 20, 62, 19195 }, // β
+    { 13, 19, 17, 3, 12, 45, 19257 }, // γ
+    { 16, 19, 18, 1, 18, 54, 19302 }, // δ
+    { 11, 12, 13, 1, 11, 29, 19356 }, // ε
+    { 14, 20, 16, 1, 16, 42, 19385 }, // ζ
+    { 15, 20, 18, 2, 14, 55, 19427 }, // η
+    { 16, 17, 18, 1, 16, 49, 19482 }, // θ
+    { 8, 15, 13, 1, 15, 26, 19531 }, // ι
+    { 13, 12, 15, -1, 12, 29, 19557 }, // κ
+    { 17, 18, 18, -16, 18, 48, 19586 }, // λ
+    { 17, 15, 18, -1, 12, 46, 19634 }, // μ
+    { 13, 13, 17, 3, 12, 36, 19680 }, // ν
+    { 11, 20, 15, 3, 16, 41, 19716 }, // ξ
+    { 14, 12, 18, 2, 12, 31, 19757 }, // ο
+    { 15, 12, 18, 2, 11, 38, 19788 }, // π
+    { 18, 18, 18, -1, 13, 52, 19826 }, // ρ
+    { 11, 16, 15, 3, 16, 29, 19878 }, // ς
+    { 18, 12, 21, 2, 12, 36, 19907 }, // σ
+    { 13, 12, 17, 3, 11, 30, 19943 }, // τ
+    { 12, 13, 14, 1, 12, 36, 19973 }, // υ
+    { 21, 27, 24, 2, 22, 92, 20009 }, // φ
+    { 20, 18, 20, -1, 13, 54, 20101 }, // χ
+    { 13, 23, 16, 2, 16, 66, 20155 }, // ψ
+    { 16, 13, 19, 2, 12, 45, 20221 }, // ω
+    { 18, 24, 23, 1, 18, 62, 20266 }, // Ạ
+    { 15, 21, 18, 0, 13, 48, 20328 }, // ạ
+    { 18, 26, 23, 1, 26, 63, 20376 }, // Ả
+    { 14, 20, 18, 1, 20, 45, 20439 }, // ả
+    { 20, 32, 23, 1, 32, 81, 20484 }, // Ấ
+    { 21, 23, 23, 1, 23, 65, 20565 }, // ấ
+    { 20, 28, 23, 1, 28, 75, 20630 }, // Ầ
+    { 15, 24, 18, 1, 24, 55, 20705 }, // ầ
+    { 20, 32, 23, 1, 32, 81, 20760 }, // Ẩ
+    { 20, 24, 22, 1, 24, 68, 20841 }, // ẩ
+    { 21, 30, 23, 1, 30, 87, 20909 }, // Ẫ
+    { 16, 25, 18, 1, 25, 64, 20996 }, // ẫ
+    { 19, 31, 23, 1, 25, 79, 21060 }, // Ậ
+    { 16, 27, 18, 0, 19, 61, 21139 }, // ậ
+    { 21, 32, 23, 1, 32, 84, 21200 }, // Ắ
+    { 17, 27, 19, 1, 27, 60, 21284 }, // ắ
+    { 21, 32, 23, 1, 32, 82, 21344 }, // Ằ
+    { 17, 27, 19, 1, 27, 61, 21426 }, // ằ
+    { 21, 33, 23, 1, 33, 85, 21487 }, // Ẳ
+    { 17, 28, 19, 1, 28, 62, 21572 }, // ẳ
+    { 22, 33, 24, 1, 33, 92, 21634 }, // Ẵ
+    { 18, 28, 20, 1, 28, 67, 21726 }, // ẵ
+    { 21, 32, 23, 1, 26, 83, 21793 }, // Ặ
+    { 18, 28, 19, 0, 20, 65, 21876 }, // ặ
+    { 18, 26, 20, 1, 18, 58, 21941 }, // Ẹ
+    { 15, 21, 18, 1, 12, 51, 21999 }, // ẹ
+    { 18, 26, 20, 1, 26, 58, 22050 }, // Ẻ
+    { 14, 22, 18, 2, 22, 50, 22108 }, // ẻ
+    { 18, 27, 20, 1, 27, 62, 22158 }, // Ẽ
+    { 15, 22, 18, 2, 22, 54, 22220 }, // ẽ
+    { 21, 29, 23, 1, 29, 79, 22274 }, // Ế
+    { 23, 22, 26, 2, 22, 69, 22353 }, // ế
+    { 22, 29, 24, 1, 29, 79, 22422 }, // Ề
+    { 15, 24, 18, 2, 24, 59, 22501 }, // ề
+    { 21, 29, 23, 1, 29, 80, 22560 }, // Ể
+    { 20, 26, 23, 2, 26, 73, 22640 }, // ể
+    { 18, 31, 20, 1, 31, 80, 22713 }, // Ễ
+    { 18, 27, 21, 2, 27, 75, 22793 }, // ễ
+    { 18, 34, 20, 1, 26, 75, 22868 }, // Ệ
+    { 16, 30, 18, 1, 21, 69, 22943 }, // ệ
+    { 12, 27, 14, 1, 27, 41, 23012 }, // Ỉ
+    { 10, 20, 11, 0, 20, 29, 23053 }, // ỉ
+    { 15, 27, 12, -4, 18, 53, 23082 }, // Ị
+    { 13, 28, 12, -2, 19, 49, 23135 }, // ị
+    { 21, 28, 24, 2, 18, 79, 23184 }, // Ọ
+    { 16, 20, 18, 0, 12, 46, 23263 }, // ọ
+    { 21, 27, 24, 2, 26, 77, 23309 }, // Ỏ
+    { 14, 20, 18, 2, 20, 44, 23386 }, // ỏ
+    { 24, 26, 27, 2, 25, 89, 23430 }, // Ố
+    { 22, 20, 25, 2, 20, 60, 23519 }, // ố
+    { 21, 28, 24, 2, 27, 84, 23579 }, // Ồ
+    { 14, 23, 18, 2, 23, 55, 23663 }, // ồ
+    { 21, 29, 24, 2, 28, 89, 23718 }, // Ổ
+    { 19, 23, 22, 2, 23, 60, 23807 }, // ổ
+    { 21, 31, 24, 2, 30, 95, 23867 }, // Ỗ
+    { 15, 24, 18, 2, 24, 65, 23962 }, // ỗ
+    { 21, 35, 24, 2, 25, 96, 24027 }, // Ộ
+    { 15, 28, 18, 1, 19, 61, 24123 }, // ộ
+    { 25, 26, 28, 2, 25, 87, 24184 }, // Ớ
+    { 17, 19, 20, 2, 19, 49, 24271 }, // ớ
+    { 25, 26, 28, 2, 25, 88, 24320 }, // Ờ
+    { 17, 19, 20, 2, 19, 48, 24408 }, // ờ
+    { 25, 27, 28, 2, 26, 89, 24456 }, // Ở
+    { 17, 20, 20, 2, 20, 49, 24545 }, // ở
+    { 25, 27, 28, 2, 26, 94, 24594 }, // Ỡ
+    { 17, 21, 20, 2, 21, 55, 24688 }, // ỡ
+    { 25, 30, 28, 2, 20, 95, 24743 }, // Ợ
+    { 19, 22, 20, 0, 14, 54, 24838 }, // ợ
+    { 21, 28, 23, 1, 18, 74, 24892 }, // Ụ
+    { 16, 22, 18, 0, 12, 53, 24966 }, // ụ
+    { 21, 28, 23, 1, 27, 74, 25019 }, // Ủ
+    { 14, 20, 18, 2, 20, 50, 25093 }, // ủ
+    { 23, 27, 25, 1, 26, 81, 25143 }, // Ứ
+    { 17, 19, 20, 2, 19, 55, 25224 }, // ứ
+    { 23, 27, 25, 1, 26, 83, 25279 }, // Ừ
+    { 17, 19, 20, 2, 19, 53, 25362 }, // ừ
+    { 23, 28, 25, 1, 27, 83, 25415 }, // Ử
+    { 17, 20, 20, 2, 20, 55, 25498 }, // ử
+    { 23, 28, 25, 1, 27, 87, 25553 }, // Ữ
+    { 17, 20, 20, 2, 20, 63, 25640 }, // ữ
+    { 23, 32, 25, 1, 22, 90, 25703 }, // Ự
+    { 19, 26, 20, 0, 16, 63, 25793 }, // ự
+    { 16, 27, 23, 6, 27, 59, 25856 }, // Ỳ
+    { 17, 27, 19, 1, 21, 62, 25915 }, // ỳ
+    { 20, 29, 23, 2, 18, 66, 25977 }, // Ỵ
+    { 17, 20, 19, 1, 12, 53, 26043 }, // ỵ
+    { 16, 28, 23, 6, 28, 60, 26096 }, // Ỷ
+    { 17, 28, 19, 1, 22, 63, 26156 }, // ỷ
+    { 16, 28, 23, 6, 28, 62, 26219 }, // Ỹ
+    { 17, 29, 19, 1, 23, 68, 26281 }, // ỹ
+    { 0, 0, 14, 0, 0, 0, 26349 }, //  
+    { 0, 0, 24, 0, 0, 0, 26349 }, //  
+    { 0, 0, 14, 0, 0, 0, 26349 }, //  
+    { 0, 0, 24, 0, 0, 0, 26349 }, //  
+    { 0, 0, 10, 0, 0, 0, 26349 }, //  
+    { 0, 0, 9, 0, 0, 0, 26349 }, //  
+    { 0, 0, 7, 0, 0, 0, 26349 }, //  
+    { 0, 0, 15, 0, 0, 0, 26349 }, //  
+    { 0, 0, 5, 0, 0, 0, 26349 }, //  
+    { 0, 0, 8, 0, 0, 0, 26349 }, //  
+    { 0, 0, 6, 0, 0, 0, 26349 }, //  
+    { 0, 0, 3, 0, 0, 0, 26349 }, // ​
+    { 0, 0, 1, 0, 0, 0, 26349 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 26349 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 26349 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 26349 }, // ‏
+    { 12, 3, 14, 1, 8, 11, 26349 }, // ‐
+    { 12, 3, 14, 1, 8, 11, 26360 }, // ‑
+    { 18, 3, 18, -1, 8, 15, 26371 }, // ‒
+    { 16, 5, 19, 2, 9, 12, 26386 }, // –
+    { 23, 5, 26, 2, 9, 14, 26398 }, // —
+    { 23, 5, 26, 2, 9, 14, 26412 }, // ―
+    { 15, 19, 17, 1, 15, 58, 26426 }, // ‖
+    { 20, 8, 16, -5, -1, 34, 26484 }, // ‗
+    { 9, 8, 14, 4, 19, 11, 26518 }, // ‘
+    { 9, 8, 14, 4, 19, 12, 26529 }, // ’
+    { 9, 8, 9, -1, 4, 12, 26541 }, // ‚
+    { 9, 8, 14, 4, 19, 11, 26553 }, // ‛
+    { 16, 8, 21, 4, 19, 22, 26564 }, // “
+    { 16, 8, 21, 4, 19, 23, 26586 }, // ”
+    { 9, 8, 9, -1, 4, 12, 26609 }, // „
+    { 16, 8, 21, 4, 19, 22, 26621 }, // ‟
+    { 13, 30, 19, 5, 22, 61, 26643 }, // †
+    { 15, 29, 20, 4, 21, 62, 26704 }, // ‡
+    { 18, 16, 17, -2, 19, 49, 26766 }, // •
+    { 7, 8, 13, 4, 10, 12, 26815 }, // ‣
+    { 7, 5, 13, 3, 5, 9, 26827 }, // ․
+    { 7, 5, 13, 3, 5, 9, 26836 }, // ‥
+    { 20, 5, 21, 0, 5, 25, 26845 }, // …
+    { 4, 3, 11, 4, 8, 5, 26870 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 26875 }, //  
+    { 19, 19, 24, 3, 17, 68, 26875 }, // ‰
+    { 10, 8, 17, 6, 19, 12, 26943 }, // ′
+    { 16, 8, 23, 6, 19, 23, 26955 }, // ″
+    { 16, 7, 15, -2, 18, 26, 26978 }, // ‴
+    { 6, 7, 12, 5, 18, 9, 27004 }, // ‵
+    { 9, 7, 14, 4, 18, 17, 27013 }, // ‶
+    { 16, 7, 17, 0, 18, 27, 27030 }, // ‷
+    { 12, 5, 17, 4, 18, 13, 27057 }, // ‸
+    { 9, 12, 12, 2, 12, 17, 27070 }, // ‹
+    { 9, 12, 9, -2, 12, 18, 27087 }, // ›
+    { 28, 28, 30, 1, 22, 107, 27105 }, // ※
+    { 12, 27, 15, 2, 24, 40, 27212 }, // ‼
+    { 17, 33, 21, 3, 28, 77, 27252 }, // ‽
+    { 12, 3, 17, 4, 18, 11, 27329 }, // ‾
+    { 11, 4, 16, 4, 14, 12, 27340 }, // ‿
+    { 16, 15, 18, 1, 19, 53, 27352 }, // ⁂
+    { 20, 18, 27, 4, 16, 39, 27405 }, // ⁄
+    { 29, 27, 35, 5, 24, 116, 27444 }, // ⁇
+    { 24, 28, 29, 4, 24, 94, 27560 }, // ⁈
+    { 23, 27, 22, -2, 24, 92, 27654 }, // ⁉
+    { 23, 36, 23, -1, 25, 102, 27746 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 27848 }, //  
+    { 7, 9, 16, 8, 18, 22, 27848 }, // ⁰
+    { 7, 8, 16, 8, 18, 15, 27870 }, // ⁴
+    { 8, 9, 16, 7, 18, 17, 27885 }, // ⁵
+    { 8, 9, 16, 7, 18, 19, 27902 }, // ⁶
+    { 7, 9, 17, 9, 18, 16, 27921 }, // ⁷
+    { 8, 9, 16, 7, 18, 20, 27937 }, // ⁸
+    { 8, 10, 16, 7, 18, 20, 27957 }, // ⁹
+    { 15, 13, 18, 1, 13, 38, 27977 }, // ⁿ
+    { 8, 9, 7, -6, 5, 24, 28015 }, // ₀
+    { 7, 9, 7, -7, 5, 16, 28039 }, // ₁
+    { 8, 9, 8, -7, 5, 18, 28055 }, // ₂
+    { 8, 9, 7, -7, 5, 17, 28073 }, // ₃
+    { 7, 8, 8, -6, 5, 15, 28090 }, // ₄
+    { 8, 9, 7, -7, 5, 14, 28105 }, // ₅
+    { 8, 9, 8, -7, 5, 19, 28119 }, // ₆
+    { 7, 10, 8, -5, 6, 15, 28138 }, // ₇
+    { 9, 9, 8, -7, 5, 23, 28153 }, // ₈
+    { 9, 9, 8, -7, 5, 21, 28176 }, // ₉
+    { 15, 29, 17, 1, 22, 61, 28197 }, // ₍
+    { 14, 29, 9, -6, 22, 59, 28258 }, // ₎
+    { 20, 27, 23, 2, 23, 95, 28317 }, // ₡
+    { 18, 19, 21, 2, 19, 55, 28412 }, // ₢
+    { 17, 19, 18, 0, 18, 51, 28467 }, // ₤
+    { 24, 18, 24, -1, 18, 73, 28518 }, // ₦
+    { 20, 18, 22, 1, 18, 56, 28591 }, // ₧
+    { 25, 19, 27, -1, 18, 87, 28647 }, // ₨
+    { 20, 18, 19, -2, 18, 66, 28734 }, // ₩
+    { 20, 16, 24, 3, 16, 75, 28800 }, // ₪
+    { 19, 18, 18, -2, 17, 51, 28875 }, // ₫
+    { 17, 20, 19, 1, 17, 52, 28926 }, // €
+    { 17, 18, 23, 5, 18, 54, 28978 }, // ₮
+    { 23, 18, 24, 0, 18, 55, 29032 }, // ₱
+    { 19, 27, 24, 2, 23, 85, 29087 }, // ₲
+    { 24, 18, 31, 6, 17, 74, 29172 }, // ₴
+    { 12, 17, 15, 2, 15, 37, 29246 }, // ₵
+    { 20, 19, 26, 5, 19, 48, 29283 }, // ₸
+    { 14, 17, 18, 3, 16, 43, 29331 }, // ₹
+    { 14, 16, 16, 1, 14, 46, 29374 }, // ₺
+    { 16, 18, 20, 3, 17, 57, 29420 }, // ₼
+    { 21, 18, 19, -3, 18, 59, 29477 }, // ₽
+    { 15, 15, 15, -4, 11, 36, 29536 }, // ←
+    { 15, 15, 18, 2, 14, 37, 29572 }, // ↑
+    { 15, 15, 20, 4, 11, 36, 29609 }, // →
+    { 15, 15, 22, 6, 14, 37, 29645 }, // ↓
+    { 24, 12, 24, -1, 10, 49, 29682 }, // ↔
+    { 13, 23, 17, 3, 22, 58, 29731 }, // ↕
+    { 15, 10, 16, -2, 10, 29, 29789 }, // ↖
+    { 14, 10, 17, 2, 10, 32, 29818 }, // ↗
+    { 12, 14, 17, 4, 12, 34, 29850 }, // ↘
+    { 11, 14, 13, -2, 12, 33, 29884 }, // ↙
+    { 17, 14, 20, 1, 13, 33, 29917 }, // ⇐
+    { 18, 17, 23, 4, 16, 65, 29950 }, // ⇑
+    { 17, 14, 21, 3, 13, 31, 30015 }, // ⇒
+    { 18, 17, 27, 8, 15, 63, 30046 }, // ⇓
+    { 21, 14, 23, 1, 13, 49, 30109 }, // ⇔
+    { 15, 21, 21, 5, 12, 70, 30158 }, // ⇕
+    { 17, 19, 19, 1, 18, 52, 30228 }, // ∂
+    { 23, 20, 24, 0, 19, 76, 30280 }, // ∅
+    { 18, 17, 19, 0, 16, 48, 30356 }, // ∆
+    { 17, 16, 20, 2, 15, 50, 30404 }, // ∏
+    { 17, 17, 24, 6, 16, 53, 30454 }, // ∐
+    { 16, 16, 17, 0, 15, 43, 30507 }, // ∑
+    { 12, 4, 14, 1, 8, 10, 30550 }, // −
+    { 22, 19, 25, 2, 18, 52, 30560 }, // √
+    { 19, 12, 22, 2, 14, 49, 30612 }, // ∞
+    { 21, 23, 22, 0, 17, 59, 30661 }, // ∫
+    { 9, 14, 10, 0, 14, 19, 30720 }, // ∶
+    { 15, 13, 30, 11, 12, 39, 30739 }, // ≈
+    { 20, 19, 27, 4, 17, 51, 30778 }, // ≠
+    { 20, 18, 18, -3, 16, 55, 30829 }, // ≤
+    { 20, 18, 21, 0, 16, 55, 30884 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
@@ -3929,4 +2678,5 @@ static const EpdFontData opendyslexic_10_bolditalic = {
     28,
     -11,
     true,
+    true,
 };
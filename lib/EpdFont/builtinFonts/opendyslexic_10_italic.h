@@ -2,3456 +2,2495 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_italic
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_italicBitmaps[44457] = {
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00, 0x0F,
-    0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F,
-    0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x0F, 0xD0, 0xFC, 0x3F, 0x83,
-    0xF0, 0xBE, 0x0F, 0xC1, 0xF8, 0x2F, 0x83, 0xF0, 0x7F, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0x40, 0x38,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x2D,
-    0x01, 0xE0, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x1F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0xB8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0x00, 0x01, 0xF4, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0D, 0x38, 0x00, 0x00, 0x00, 0x70, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0xFD,
-    0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFE, 0xF5, 0x80, 0x00, 0xFE, 0xC3, 0x40, 0x00, 0x07,
-    0xDB, 0x0C, 0x00, 0x00, 0x2F, 0x28, 0x70, 0x00, 0x00, 0xBF, 0xE2, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0xB7, 0xFF, 0xD0, 0x00, 0x03, 0x8B, 0xFF, 0xC0,
-    0x00, 0x0D, 0x3B, 0xFF, 0x40, 0x00, 0x70, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x06, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x07, 0x0D, 0x00,
-    0x00, 0x00, 0x2C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x2F, 0x80, 0x03, 0x40, 0x38, 0x34, 0x03, 0x80, 0x18, 0x06, 0x02, 0xC0,
-    0x0D, 0x02, 0x82, 0xC0, 0x03, 0x41, 0xC1, 0xC0, 0x00, 0xFF, 0xE1, 0xD0, 0x00, 0x0F, 0xD1, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xF4, 0x30, 0x00, 0x00, 0xF4, 0x0D, 0x00, 0x00, 0xBC,
-    0x03, 0x00, 0x00, 0xBB, 0x02, 0xC0, 0x00, 0xB4, 0xFF, 0xC0, 0x00, 0x78, 0x1F, 0x80, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x03, 0xFA, 0xBC,
-    0x00, 0x03, 0xD0, 0x0F, 0x00, 0x01, 0xF0, 0x03, 0xC0, 0x00, 0x7C, 0x07, 0xE0, 0x00, 0x0F, 0x8B,
-    0xE0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFE,
-    0x1F, 0x00, 0x60, 0xBE, 0x01, 0xF0, 0x7C, 0x3F, 0x00, 0x2E, 0x7E, 0x0F, 0xC0, 0x02, 0xFF, 0x03,
-    0xF8, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFD, 0x30, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x43, 0xF8, 0x2F, 0x81, 0xF8, 0x0F, 0xC0, 0xFC, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03,
-    0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0x70, 0x00, 0x42, 0xC1, 0x8B, 0xCD, 0x7C, 0x07, 0xFE, 0x00, 0x07, 0xF0, 0x01, 0xFB, 0xBD, 0x2E,
-    0x38, 0x74, 0x10, 0xD0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00,
-    0x03, 0x80, 0x6A, 0xBA, 0x9F, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01, 0xD0, 0x00, 0x2C,
-    0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xD0, 0x05, 0x3E, 0x7E, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x02, 0xD0, 0xB0, 0x00, 0xB4, 0x03,
-    0x40, 0x1E, 0x00, 0x38, 0x03, 0xC0, 0x03, 0x80, 0x78, 0x34, 0x38, 0x0F, 0x4B, 0x47, 0x40, 0xF0,
-    0xF0, 0xB4, 0x1F, 0x0A, 0x0F, 0x02, 0xF0, 0x02, 0xE0, 0x2F, 0x00, 0x7D, 0x03, 0xF0, 0x1F, 0xC0,
-    0x2F, 0xFF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xC0, 0x03, 0xFE, 0x00, 0x08, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-    0xB8, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0xB8, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00,
-    0xBC, 0x00, 0xBF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0x06, 0xA8, 0x00, 0x00, 0xFF,
-    0xFE, 0x00, 0x0B, 0x90, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x02, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0xE9, 0x6F, 0x00, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xAB, 0xE0,
-    0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0B, 0x80, 0x04, 0x01, 0xBD, 0x00, 0x3F, 0xFF, 0xE0, 0x02, 0xFF, 0xFE, 0x00, 0x06, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0x00, 0x01, 0xFC, 0x00, 0x1E, 0xE0,
-    0x01, 0xF7, 0x40, 0x1F, 0x2D, 0x01, 0xF0, 0xF0, 0x1F, 0x03, 0xC1, 0xF5, 0x6F, 0x5F, 0xFF, 0xFF,
-    0xAA, 0xAF, 0xF9, 0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x00, 0x15,
-    0x55, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x01, 0xFA, 0x40, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x0D, 0x06, 0xFC, 0x01, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xD0, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x6A, 0x80, 0x00, 0xBF, 0xFC, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x65, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE,
-    0x07, 0xD0, 0x1F, 0x80, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x2D, 0x00, 0x2D, 0x03, 0xD0, 0x03, 0xC0,
-    0x2E, 0x00, 0xF8, 0x01, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0xFF, 0xFF, 0xC1, 0x5A, 0xAF, 0x00, 0x00, 0xB4, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00,
-    0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0x0B,
-    0xE0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xFE, 0x40, 0x00, 0x3D,
-    0x07, 0x40, 0x03, 0xC0, 0x0F, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x74, 0x00, 0xE0, 0x02, 0xD0, 0x0F,
-    0x40, 0x07, 0xC1, 0xF8, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x6F, 0xFD, 0x00, 0x0B, 0xD0, 0x7D, 0x00,
-    0xBC, 0x00, 0xB8, 0x03, 0xD0, 0x02, 0xE0, 0x1F, 0x00, 0x1F, 0x40, 0x7E, 0x02, 0xFC, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x07, 0xE6, 0xF0, 0x00, 0xF0, 0x0B,
-    0x80, 0x3C, 0x00, 0xB8, 0x03, 0x80, 0x0B, 0x80, 0xB4, 0x00, 0xB8, 0x0B, 0x00, 0x0F, 0x80, 0xB4,
-    0x01, 0xF4, 0x0B, 0xC0, 0x7F, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0xB8, 0x02, 0xFA, 0xFF, 0x00, 0x3F, 0xFF, 0xD0, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x29,
-    0x00, 0x7D, 0x00, 0xFD, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x80, 0x0F, 0xC0, 0x1F, 0xC0, 0x3F, 0xC0, 0x00, 0x2A, 0x00, 0x3F, 0x00, 0xBE, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0B, 0xF0, 0x0F, 0xC0,
-    0x1F, 0x80, 0x3F, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x3F, 0x80,
-    0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00,
-    0x0B, 0xFD, 0x00, 0x00, 0x00, 0x1A, 0x01, 0x5A, 0xA8, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x86, 0xAA, 0x54, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBD,
-    0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00,
-    0x07, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x1B, 0xFF, 0xD0, 0x1B, 0xFF,
-    0xE4, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0x80, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF4,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0x90, 0x1F, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x34, 0x00, 0x02, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x78, 0xBE, 0x40, 0x0C, 0x00, 0x0F, 0x28, 0x34,
-    0x01, 0xC0, 0x02, 0xD6, 0x03, 0x00, 0x28, 0x00, 0x3C, 0x80, 0x70, 0x03, 0x40, 0x0B, 0xCC, 0x1F,
-    0x00, 0xB0, 0x00, 0xFC, 0xFF, 0xE0, 0x3C, 0x00, 0x0F, 0xC2, 0x95, 0xBF, 0x00, 0x00, 0xFD, 0x00,
-    0x06, 0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x16, 0x00, 0x00, 0x02, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B,
-    0x83, 0xD0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01,
-    0xF0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B,
-    0xE0, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x3C, 0x00,
-    0x2D, 0x00, 0x7C, 0x00, 0x2D, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xF8, 0x01, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xD0, 0x03, 0xE0, 0x01, 0xF8, 0x03, 0xD0, 0x00, 0x7C, 0x07, 0xC0, 0x00,
-    0xBC, 0x0B, 0x80, 0x00, 0xF8, 0x0F, 0x40, 0x02, 0xF8, 0x0F, 0x95, 0x6F, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x2F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0x00, 0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0x80,
-    0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F,
-    0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F,
-    0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7E,
-    0xAA, 0x40, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x01, 0xF4, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02, 0xFE, 0x40, 0x01,
-    0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFA, 0x50,
-    0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0, 0x1F, 0xE0, 0x00,
-    0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F,
-    0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00,
-    0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x07,
-    0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F,
-    0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x1F,
-    0x80, 0x07, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0,
-    0x00, 0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xFD, 0x00,
-    0x7F, 0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F,
-    0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0A, 0x50, 0x00,
-    0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x3E,
-    0x0F, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01,
-    0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xF0,
-    0x00, 0x3E, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x06,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x55, 0x64, 0x7F,
-    0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xA0, 0x00, 0x02, 0xA0, 0x00,
-    0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8,
-    0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0, 0x0B, 0xFF, 0x00, 0x07, 0xEF, 0xC0, 0x3F,
-    0xBC, 0x00, 0x2F, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0xF8, 0xFD, 0x1F, 0x9F, 0x80, 0x07, 0xD3, 0xF4,
-    0xFC, 0xBD, 0x00, 0x2F, 0x0F, 0xEF, 0xD3, 0xF0, 0x00, 0xFC, 0x3F, 0xFE, 0x1F, 0xC0, 0x07, 0xF0,
-    0xBF, 0xF0, 0xFF, 0x00, 0x2F, 0x81, 0xFF, 0x43, 0xF8, 0x00, 0xFD, 0x07, 0xFC, 0x1F, 0xD0, 0x07,
-    0xF0, 0x0F, 0xC0, 0xFF, 0x40, 0x2F, 0xC0, 0x29, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E,
-    0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0,
-    0x00, 0x3F, 0x1F, 0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00,
-    0x03, 0xF0, 0x2F, 0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00,
-    0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00,
-    0x3F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03,
-    0xE0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F,
-    0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x02,
-    0xF0, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0,
-    0x1B, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0B, 0xF4, 0x07, 0xF0,
-    0x00, 0x2F, 0x80, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0xF4, 0x0B, 0xC0,
-    0x00, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x08,
-    0x0F, 0xC0, 0x0F, 0xD0, 0x3F, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xAA, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B,
-    0xFF, 0xF4, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF,
-    0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0,
-    0x07, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80,
-    0x3F, 0xD0, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0xAA, 0x40,
-    0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00,
-    0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x14, 0x00, 0x7F,
-    0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF,
-    0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F,
-    0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00,
-    0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00,
-    0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80,
-    0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x00, 0x00, 0x0A, 0x5F, 0x40, 0x00, 0x0B, 0xC3, 0xE0, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x03,
-    0xF0, 0x3E, 0x00, 0x02, 0xF4, 0x0F, 0xC0, 0x01, 0xFC, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00,
-    0xBE, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x0F, 0xD0, 0x3F, 0x40, 0x03, 0xF4, 0x2F, 0xC0, 0x00, 0xFD,
-    0x1F, 0xC0, 0x00, 0x3F, 0x8F, 0xE0, 0x00, 0x0B, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00,
-    0xBF, 0xFC, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x2F,
-    0x40, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x0F,
-    0x80, 0x2F, 0x00, 0x3F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0x02, 0xFF,
-    0xC0, 0xFC, 0x00, 0x3F, 0x07, 0xFF, 0xC1, 0xF8, 0x00, 0x3F, 0x0F, 0xDF, 0xD3, 0xF0, 0x00, 0x3F,
-    0x3F, 0x8B, 0xD7, 0xE0, 0x00, 0x3F, 0xBF, 0x0B, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0x80,
-    0x00, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x03,
-    0xFC, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x40, 0x00,
-    0xF4, 0x00, 0x0B, 0x80, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x00,
-    0xF8, 0x0B, 0xC0, 0x00, 0x00, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x00,
-    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0xFE, 0x00, 0x00, 0x0B, 0xF0, 0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00,
-    0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x1F, 0xD0, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x0F, 0x83,
-    0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x7E, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC,
-    0x3F, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x55, 0x50, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
-    0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x15, 0x50, 0x00, 0x00, 0x10,
-    0x60, 0xA0, 0xE0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB4, 0xB4, 0xB8, 0x78, 0x7C, 0x7C, 0x7C, 0x7C,
-    0x74, 0x60, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x15, 0x54,
-    0x07, 0x40, 0x03, 0xF4, 0x02, 0xD7, 0x41, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0,
-    0x3C, 0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F,
-    0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x01, 0xE4, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0xBC, 0x15, 0x00, 0x3E, 0xBF, 0xE0, 0x0F, 0xF9, 0x6E, 0x03, 0xF4, 0x03, 0xC1, 0xF4, 0x00, 0xF0,
-    0xBC, 0x00, 0x3C, 0x3E, 0x00, 0x1F, 0x0F, 0x80, 0x0F, 0x43, 0xF0, 0x1F, 0xC1, 0xFF, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0,
-    0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00,
-    0x2E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03, 0xFF, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xF4, 0xF0, 0x00, 0x7F, 0xFD,
-    0xE0, 0x01, 0xF4, 0x2F, 0xD0, 0x03, 0xC0, 0x0F, 0xC0, 0x0F, 0x00, 0x0F, 0x80, 0x1E, 0x00, 0x1F,
-    0x40, 0x2D, 0x00, 0x2F, 0x00, 0x3D, 0x00, 0x7F, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x2F, 0xFF, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-    0x00, 0x07, 0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF,
-    0xE1, 0xFE, 0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF,
-    0xC0, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x01, 0x90, 0x01, 0xFE, 0x00, 0x3C, 0x00,
-    0x0B, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x0F, 0xFF, 0x81, 0xFF, 0xF4, 0x03, 0xC0, 0x00, 0x7C,
-    0x00, 0x0B, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82, 0xFE, 0x00, 0xB4,
-    0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0, 0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4, 0x02, 0xC0, 0x0F,
-    0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0x9F, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F,
-    0xF8, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00,
-    0xFE, 0x47, 0xC0, 0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03,
-    0x80, 0xBC, 0x00, 0x78, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0,
-    0x03, 0xF0, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x00, 0x02, 0xC0, 0x00, 0xF0, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02,
-    0xD0, 0x00, 0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x0F,
-    0xFC, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x7C, 0x00, 0xF1,
-    0xF0, 0x01, 0xE7, 0xC0, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xBF, 0x00,
-    0x0F, 0x6F, 0xC0, 0x1F, 0x0F, 0xE0, 0x2F, 0x07, 0xF4, 0x3E, 0x03, 0xFC, 0x00, 0x2C, 0x00, 0x3C,
-    0x00, 0xB8, 0x00, 0xF0, 0x01, 0xF0, 0x02, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x0F, 0x00,
-    0x1F, 0x00, 0x2E, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x7C, 0x40, 0xBF, 0xC0, 0xFF, 0xC0, 0x00, 0x18,
-    0x7F, 0x40, 0xBE, 0x00, 0x03, 0xFF, 0xFD, 0x7F, 0xF4, 0x00, 0x7F, 0x43, 0xFF, 0x47, 0x80, 0x0F,
-    0xC0, 0x1F, 0xC0, 0x38, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0x80, 0x2F, 0x00, 0x2E, 0x00, 0xB4, 0x03,
-    0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x00, 0xBC, 0x00, 0xF0, 0x0B, 0xC0, 0x0F, 0x40, 0x2E, 0x00,
-    0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x2F, 0x00, 0x3E, 0x00, 0x7D, 0x03, 0xE0, 0x07, 0xD0, 0x0B, 0xC0,
-    0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C, 0x02, 0xF0,
-    0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0, 0x1F, 0x00,
-    0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF,
-    0xE0, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0, 0x00, 0xB4, 0x2D,
-    0x00, 0x0F, 0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE0,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x05, 0x0B, 0xE0, 0x00, 0x03, 0xDF, 0xFF, 0x00, 0x00, 0xFF, 0x41,
-    0xD0, 0x00, 0x3F, 0x00, 0x38, 0x00, 0x1F, 0x40, 0x0E, 0x00, 0x0B, 0xC0, 0x03, 0x80, 0x03, 0xF0,
-    0x01, 0xD0, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x7F, 0x40, 0xB8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F,
-    0xBF, 0xFD, 0x00, 0x0F, 0x8F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x82, 0x80, 0x0B, 0xFF, 0xAE, 0x00, 0xB8, 0x07, 0xF4,
-    0x07, 0xC0, 0x0F, 0xC0, 0x3C, 0x00, 0x7E, 0x01, 0xE0, 0x02, 0xF0, 0x0B, 0x00, 0x0F, 0xC0, 0x2C,
-    0x00, 0xBD, 0x00, 0xB4, 0x0B, 0xF0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xEE, 0x00, 0x02, 0xFD,
-    0xB0, 0x00, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x03, 0xE4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x01, 0xEB, 0xF0, 0x0B, 0xFF, 0xC0, 0x3F, 0x80,
-    0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x01, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01,
-    0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0xB8, 0x00, 0x0F, 0x40, 0x05, 0xF5, 0x43, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0,
-    0x00, 0xF4, 0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xFE, 0x40, 0x7F, 0xF8, 0x07,
-    0xFF, 0x40, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00, 0x3C, 0x0F,
-    0x00, 0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xD0, 0x14, 0x00, 0x01, 0x43, 0xC0, 0x00, 0x78,
-    0x2D, 0x00, 0x0F, 0x01, 0xE0, 0x03, 0xD0, 0x1F, 0x00, 0xB8, 0x00, 0xF0, 0x1F, 0x00, 0x0F, 0x43,
-    0xC0, 0x00, 0xBC, 0xF4, 0x00, 0x0B, 0xEE, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x00, 0x00,
-    0xBF, 0x40, 0x00, 0x14, 0x00, 0x00, 0x05, 0x0F, 0x40, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x03, 0xD0,
-    0xF4, 0x00, 0x02, 0xE0, 0x3D, 0x0B, 0x80, 0xF0, 0x0F, 0x4B, 0xF0, 0xB8, 0x03, 0xDB, 0xFE, 0x3C,
-    0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x03, 0xF8, 0x3F,
-    0xC0, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x0B,
-    0xC3, 0xD0, 0x00, 0x03, 0xEF, 0x40, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07,
-    0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7D, 0x7E, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x0B, 0xE0,
-    0x2F, 0x40, 0x2F, 0x80, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C,
-    0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F,
-    0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x15, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0xFC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x02, 0xE0, 0x00, 0x06, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1C,
-    0x00, 0x2C, 0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x00, 0xA0, 0x00, 0xD0, 0x01, 0xC0, 0x02, 0xC0,
-    0x03, 0x80, 0x03, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x34, 0x00,
-    0x00, 0x05, 0x40, 0x00, 0x2F, 0xF0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0xE4, 0x00, 0x02, 0xFC, 0x00, 0x02,
-    0xF4, 0x00, 0x0F, 0x40, 0x00, 0x2E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-    0x01, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x0E, 0x60,
-    0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0xF4,
-    0x03, 0xF0, 0x00, 0x00, 0x01, 0x50, 0x07, 0xD0, 0x07, 0xC0, 0x0B, 0xC0, 0x0F, 0x80, 0x0F, 0x40,
-    0x0F, 0x00, 0x1F, 0x00, 0x2E, 0x00, 0x2D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x74, 0x00,
-    0xB0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x70, 0x00,
-    0x2F, 0xF4, 0x03, 0xFF, 0xD0, 0x3E, 0x70, 0x02, 0xF2, 0xC0, 0x0F, 0x0E, 0x00, 0x7C, 0x34, 0x02,
-    0xE1, 0xC0, 0x0F, 0x8E, 0x00, 0x3F, 0x34, 0x00, 0xBF, 0xE8, 0x00, 0xFF, 0xF8, 0x00, 0xBF, 0xE0,
-    0x00, 0xC0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x07, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x03, 0xC0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x52, 0xD0, 0x2F, 0xFF, 0xF4, 0x03, 0xD0, 0xF0, 0x03, 0xC0, 0x2C, 0x00, 0xF0,
-    0x0F, 0x00, 0x3D, 0x1F, 0x80, 0x2F, 0xFF, 0xD0, 0x3F, 0xFF, 0xFC, 0x0F, 0x05, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x14, 0x03, 0xD0, 0x00, 0xF4, 0x01, 0xF0, 0x03, 0xD0, 0x00, 0xFC,
-    0x1F, 0x40, 0x00, 0xBD, 0x7D, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x01, 0xAF, 0xFC, 0x00, 0x0F, 0xFF, 0xA8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7D,
-    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x66, 0xFE, 0x90, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x2C,
-    0x00, 0x38, 0x00, 0x34, 0x00, 0x70, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x03, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0xB9, 0x6C, 0x00, 0x01, 0xC0, 0x04, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xBF, 0xAF, 0xF0, 0x01, 0xF0, 0x00, 0xF4, 0x02, 0xC0,
-    0x00, 0x74, 0x03, 0xC0, 0x00, 0xF0, 0x02, 0xFE, 0x46, 0xF0, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0x01, 0xFC, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x2A, 0xE9, 0x00, 0x00, 0x0F, 0x02, 0xF2, 0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54,
-    0x01, 0xA9, 0x00, 0xF8, 0x10, 0x2D, 0x00, 0x82, 0x80, 0x08, 0x68, 0x01, 0x42, 0xF4, 0x60, 0x24,
-    0x28, 0x00, 0x69, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x0A, 0x1C, 0x0C, 0x1C, 0x24, 0x28, 0x34, 0x74,
-    0x2F, 0xF4, 0x0A, 0x40, 0x00, 0x04, 0x00, 0x10, 0x07, 0x80, 0x1C, 0x02, 0xE0, 0x0F, 0x41, 0xF0,
-    0x07, 0xC0, 0x7C, 0x02, 0xE0, 0x0B, 0xD0, 0x3F, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xF8, 0x0B, 0xD0,
-    0x07, 0x00, 0x2C, 0x00, 0x10, 0x00, 0x40, 0xBF, 0xA9, 0x4B, 0xFF, 0xFD, 0x00, 0x03, 0xC0, 0x00,
-    0x3C, 0x00, 0x07, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x00, 0xAA,
-    0x00, 0x3D, 0x08, 0x0E, 0x14, 0x11, 0x6F, 0x01, 0x12, 0x20, 0x81, 0x93, 0x14, 0x0D, 0x1A, 0x00,
-    0x1A, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x3F, 0xBE,
-    0x03, 0xD0, 0x2C, 0x1E, 0x00, 0xB0, 0xF4, 0x03, 0xC3, 0xD0, 0x2E, 0x0B, 0xD7, 0xF0, 0x1F, 0xFF,
-    0x40, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B,
-    0x00, 0x03, 0xFF, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0xBF, 0xFF, 0xC0, 0x14, 0x00, 0x00, 0x00, 0x06,
-    0xA0, 0x10, 0xD0, 0x03, 0x00, 0x28, 0x03, 0xC0, 0x78, 0x03, 0xFC, 0x05, 0x50, 0x02, 0xA0, 0x00,
-    0x08, 0x00, 0x18, 0x03, 0xE0, 0x00, 0x70, 0x00, 0x30, 0x2A, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x38,
-    0x0B, 0x01, 0xD0, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0x80, 0x0F,
-    0x40, 0x3D, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x0B, 0x80, 0x3F, 0x00, 0x3D, 0x01,
-    0xF8, 0x02, 0xF0, 0x0B, 0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xDF, 0xFF, 0xF8, 0x0E, 0x2F,
-    0xE3, 0xD0, 0x30, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x90, 0x90, 0x03, 0xFC,
-    0x0D, 0x00, 0xFF, 0xC1, 0xC0, 0x1F, 0xF4, 0x2C, 0x02, 0xFF, 0x03, 0x80, 0x1F, 0xF0, 0x34, 0x00,
-    0xFD, 0x07, 0x00, 0x07, 0xC0, 0xB0, 0x00, 0xFC, 0x0E, 0x00, 0x1F, 0x40, 0xD0, 0x03, 0xF0, 0x1C,
-    0x00, 0x3F, 0x02, 0xC0, 0x0B, 0xD0, 0x38, 0x00, 0xFC, 0x03, 0x40, 0x2F, 0xC0, 0x70, 0x03, 0xF4,
-    0x0B, 0x00, 0xBF, 0x00, 0xE0, 0x00, 0x05, 0x07, 0xC3, 0xF1, 0xFC, 0x00, 0x00, 0x80, 0x29, 0x00,
-    0x18, 0x07, 0x4B, 0xD0, 0x00, 0x00, 0x2C, 0x01, 0xC0, 0x24, 0x03, 0x00, 0x30, 0x0A, 0x03, 0xFC,
-    0x15, 0x40, 0x02, 0xF4, 0x09, 0x0C, 0x1C, 0x0C, 0x24, 0x0C, 0x28, 0x28, 0x1F, 0xF0, 0x06, 0x40,
-    0x10, 0x01, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x00, 0xF4, 0x07, 0xC0, 0x00, 0xB8, 0x02, 0xD0, 0x00,
-    0x7C, 0x02, 0xE0, 0x02, 0xF4, 0x0F, 0xC0, 0x1F, 0x80, 0xBC, 0x00, 0xFC, 0x07, 0xD0, 0x02, 0xC0,
-    0x0E, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2B,
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x04, 0x00, 0xD0, 0x00, 0x0A, 0x00, 0x70, 0x00, 0x0B, 0x00,
-    0x2C, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x40, 0x07, 0x00, 0x1F, 0xFD, 0x07, 0x40,
-    0x0F, 0xFF, 0x03, 0x40, 0x40, 0x00, 0x03, 0x80, 0x70, 0x00, 0x03, 0x80, 0x7C, 0x00, 0x03, 0xC0,
-    0x7B, 0x00, 0x03, 0xC0, 0x76, 0x80, 0x02, 0xC0, 0x74, 0xD0, 0x02, 0xD0, 0x3D, 0xB9, 0x02, 0xD0,
-    0x14, 0x3F, 0x41, 0xE0, 0x00, 0x0F, 0x00, 0xA0, 0x00, 0x07, 0x80, 0x01, 0xB0, 0x00, 0x00, 0x00,
-    0x3B, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x00, 0xD0, 0x01, 0xC0, 0x00,
-    0x34, 0x00, 0x2C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x00, 0x74, 0x00, 0x70, 0x00, 0x7F,
-    0xF4, 0x1E, 0xBF, 0x0F, 0xFF, 0x03, 0x79, 0x2C, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x3C, 0x00,
-    0x2C, 0x00, 0x0B, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x74, 0x00, 0x7C, 0x00, 0x1E,
-    0x00, 0x3F, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x00, 0xF0, 0x03, 0xFF, 0xE0, 0x3C, 0x00, 0x3F, 0xFD,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x28, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x70, 0x02, 0xFD, 0x00, 0x0D, 0x00, 0x01, 0xC0, 0x03, 0x40,
-    0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x10, 0x2C, 0x0B, 0x00, 0x03, 0xFF, 0x82,
-    0xC0, 0x10, 0x7F, 0xD0, 0x74, 0x07, 0x00, 0x00, 0x1D, 0x01, 0xF0, 0x00, 0x03, 0x80, 0x7B, 0x00,
-    0x00, 0xF0, 0x1D, 0xA0, 0x00, 0x3C, 0x07, 0x4D, 0x00, 0x0F, 0x00, 0xF6, 0xE4, 0x02, 0xD0, 0x15,
-    0x7F, 0x40, 0xB8, 0x00, 0x03, 0xC0, 0x0A, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B,
-    0xF4, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00,
-    0xF4, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x01, 0xF4, 0x07,
-    0xC0, 0x0F, 0xFF, 0xF4, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x03, 0xEF, 0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00, 0xF0, 0xF4, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x2F, 0x00, 0xF8,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x0B, 0xFA, 0xAB, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x41, 0xF4, 0x00, 0x0B, 0xD0, 0xFC, 0x00, 0x02, 0xF8, 0xFD, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00,
-    0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x01,
-    0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B,
-    0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3C,
-    0xB4, 0x00, 0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00,
-    0x7C, 0xF0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00,
-    0x3E, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xB4, 0x28, 0x00, 0x00, 0x0B, 0x30, 0xD0, 0x00, 0x00, 0x34, 0xA7, 0x00,
-    0x00, 0x01, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0xF0,
-    0x00, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00,
-    0x07, 0xC0, 0xF4, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x1F, 0x40, 0x00, 0xBD, 0x00, 0xFC, 0x00, 0x02, 0xF8, 0x0F, 0xD0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x00, 0x07, 0xD0, 0xBC, 0x00, 0x00, 0x0F,
-    0xD0, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00,
-    0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA,
-    0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F,
-    0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x80,
-    0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xD3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x87, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0x07, 0xE5, 0x68, 0x00, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0xAA, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xEA, 0xA8, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x0F, 0xC0, 0x00, 0xBF,
-    0xFF, 0xFD, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-    0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x01, 0x00,
-    0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00,
-    0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3F, 0xAA,
-    0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xE2, 0xD0, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-    0xE0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03,
-    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0xBD,
-    0x0F, 0xC0, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F,
-    0x95, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x0F, 0xEA,
-    0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x28, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-    0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B,
-    0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0x0B,
-    0xF0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xE2,
-    0xD0, 0x00, 0xE0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x1F, 0x80, 0x00, 0x0B, 0xE0, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xBF,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x3D, 0x07, 0xC0, 0x07, 0xD0, 0xBC, 0x00, 0xFC, 0x0F,
-    0xC0, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F,
-    0xF0, 0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00,
-    0x7C, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xE0, 0x03, 0xF3, 0xFF, 0xFF, 0x40, 0x0F, 0xC0, 0x7D, 0x00,
-    0x00, 0xBE, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0C, 0x00, 0x00,
-    0x00, 0x35, 0xC7, 0x00, 0x00, 0x00, 0x2C, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x80, 0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xF8, 0x00, 0x0F,
-    0xF4, 0x00, 0x7C, 0x00, 0x07, 0xFD, 0x00, 0x3F, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0x80, 0x00, 0xFB,
-    0xF0, 0x0B, 0xC0, 0x00, 0x7D, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x2F, 0x41, 0xF8, 0x00, 0x0F, 0xC7,
-    0xD0, 0xBD, 0x00, 0x07, 0xE0, 0xF8, 0x3F, 0x00, 0x03, 0xF4, 0x3F, 0x1F, 0x80, 0x00, 0xFC, 0x0B,
-    0xCB, 0xD0, 0x00, 0xBF, 0x02, 0xF7, 0xF0, 0x00, 0x3F, 0x80, 0x7F, 0xF8, 0x00, 0x0F, 0xD0, 0x0F,
-    0xFD, 0x00, 0x0B, 0xF0, 0x03, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00,
-    0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B,
-    0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC,
-    0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80,
-    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xD0, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00,
-    0x3F, 0x90, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF0,
-    0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80,
-    0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x28, 0x00, 0x00, 0x00, 0xE3, 0x5C, 0x00, 0x00, 0x00, 0x70, 0x7D, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF,
-    0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00,
-    0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00,
-    0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03,
-    0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x50, 0x00, 0x00, 0x03, 0xD0, 0x7C, 0x00, 0x00, 0x02, 0xF4, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x1F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0,
-    0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD,
-    0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8,
-    0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0,
-    0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00,
-    0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x82, 0xD0, 0x2E, 0xF0, 0x00, 0xFC, 0x00, 0x2F, 0xD0, 0x0F, 0xAF, 0x02, 0x90, 0xA8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x5F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0x90, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x0F, 0xCF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0xC0,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x0F, 0xC0, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x8F, 0xC0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F, 0x80, 0x00, 0xFD,
-    0x00, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xBD,
-    0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0x02,
-    0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00,
-    0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x05,
-    0x50, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xF0, 0x07,
-    0xF0, 0x00, 0x3F, 0x40, 0x2F, 0x80, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x1F, 0x40, 0x0F, 0x80, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x80,
-    0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0B, 0x1E, 0x00, 0x00, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x07,
-    0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00, 0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00,
-    0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
-    0x03, 0xD0, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x0B, 0xE0, 0xFC, 0x00, 0x00, 0x15, 0x01, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x2A, 0x40, 0x2F,
-    0x80, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x2F, 0x80, 0x1F, 0xC0, 0x00,
-    0xFD, 0x00, 0xBD, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x7D, 0x00,
-    0x7E, 0x00, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0x0B, 0xC0, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-    0x02, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x01, 0xFD, 0x00, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x4F, 0x80, 0x00,
-    0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0xBD, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0xF0, 0x3F, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0xF4, 0x3F,
-    0x00, 0x3C, 0x02, 0xE0, 0x1F, 0x00, 0x3C, 0x0B, 0x80, 0x0F, 0x03, 0xD0, 0x0B, 0x80, 0xF0, 0x1F,
-    0xC0, 0x7C, 0x6F, 0x80, 0x2F, 0xFF, 0x40, 0x0F, 0xE9, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0xF4, 0x1C,
-    0x00, 0x0F, 0x00, 0x34, 0x00, 0x74, 0x00, 0x90, 0x03, 0xC0, 0x7E, 0x00, 0x0F, 0x03, 0x40, 0x00,
-    0x78, 0x28, 0x00, 0x02, 0xD0, 0xD0, 0x00, 0x0F, 0x02, 0xC0, 0x00, 0x7C, 0x07, 0xD0, 0x02, 0xE0,
-    0x07, 0xC0, 0x0F, 0x40, 0x0B, 0x40, 0x7C, 0x00, 0x2D, 0x02, 0xF3, 0x5B, 0xF0, 0x0F, 0xDF, 0xFF,
-    0x40, 0x3E, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80,
-    0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F,
-    0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C,
-    0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x1E, 0x38, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xE2, 0x40, 0x02, 0xFF, 0xFD, 0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F,
-    0x00, 0x74, 0x00, 0x78, 0x02, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x02, 0xE0, 0x70, 0x00,
-    0x77, 0x0A, 0x00, 0x0E, 0x1D, 0xC0, 0x00, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x89,
-    0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x7C, 0x07, 0x40,
-    0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3E, 0x07, 0xD0, 0x02,
-    0xF8, 0x3F, 0x00, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0x40, 0x02, 0xFF,
-    0xFD, 0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x74, 0x00, 0x78,
-    0x02, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x05, 0x14, 0x00, 0x00,
-    0xC3, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90,
-    0x02, 0xFF, 0xFD, 0x00, 0xB8, 0x0B, 0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x07, 0xC0, 0x74, 0x00,
-    0x78, 0x0B, 0x00, 0x0F, 0x80, 0xF0, 0x02, 0xF4, 0x0F, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xEF, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1B, 0xE2, 0x0F,
-    0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x1C, 0x00, 0x2E, 0x02, 0xFE, 0x00, 0x38, 0x01, 0xE0, 0x03,
-    0xE0, 0x16, 0xE0, 0x0F, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x74, 0x00, 0x7F, 0xAA, 0x54, 0x02, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x3E, 0x07, 0xFF, 0x40, 0x04, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x01, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x01, 0xFE, 0x5E, 0x6F, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0x40, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x3C,
-    0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFE, 0xA0, 0x03,
-    0xFF, 0xE0, 0x06, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x06, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xB9, 0x0B,
-    0x00, 0xB4, 0x00, 0xD0, 0x78, 0x05, 0xB4, 0x3F, 0xFF, 0xFE, 0x1F, 0xEA, 0x95, 0x0B, 0x40, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0xBD, 0x00, 0x10, 0x1F, 0xFF, 0xFC, 0x02, 0xFF, 0xFE, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB9, 0x0B, 0x00, 0x2D,
-    0x00, 0x34, 0x07, 0x80, 0x5B, 0x40, 0xFF, 0xFF, 0xF8, 0x1F, 0xEA, 0x95, 0x02, 0xD0, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xBF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xB5, 0xE0,
-    0x00, 0x1C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB9,
-    0x0B, 0x00, 0x2D, 0x00, 0x34, 0x07, 0x80, 0x5B, 0x40, 0xFF, 0xFF, 0xF8, 0x1F, 0xEA, 0x95, 0x02,
-    0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF,
-    0x80, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x01, 0x40, 0x54, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0xFC, 0x1F,
-    0x40, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xE4, 0x2C, 0x00, 0x2D, 0x00, 0x34, 0x01, 0xE0,
-    0x16, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xAA, 0x54, 0x02, 0xD0, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x2F, 0x40, 0x04, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x6F, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x02, 0xC0, 0x00, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x03, 0x80, 0x02, 0xD0, 0x00,
-    0xF4, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x07, 0x00, 0x00,
-    0x38, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00,
-    0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0xE2, 0xC0, 0x0E, 0x00,
-    0x90, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2E,
-    0x00, 0x00, 0x01, 0x40, 0x14, 0x1F, 0x03, 0xE0, 0xFC, 0x1F, 0x87, 0xF0, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0x40, 0x00, 0x2C, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x16, 0x41, 0xC0, 0x00, 0x1F, 0xFE, 0x3C, 0x00, 0x07, 0xD0, 0xB7, 0x40, 0x00, 0xF0, 0x03, 0xF0,
-    0x00, 0x2E, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x03, 0xD0,
-    0x1F, 0x00, 0x00, 0x3F, 0xEF, 0xD0, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x0C, 0x00, 0x00, 0xDA, 0x1C, 0x00, 0x01, 0xC3, 0x74, 0x00, 0x02, 0x81,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x00, 0xBF, 0xFF,
-    0x40, 0x00, 0xFE, 0x07, 0xC0, 0x00, 0xF4, 0x03, 0xC0, 0x02, 0xF0, 0x03, 0xC0, 0x03, 0xD0, 0x07,
-    0xC0, 0x03, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x0F, 0x40, 0x0F, 0xC0, 0x1F, 0x00, 0x0F, 0x80, 0x2F,
-    0x00, 0x2F, 0x40, 0x3F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0x80,
-    0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0, 0x0B,
-    0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07,
-    0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0,
-    0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xB1, 0xE0, 0x00, 0x1C, 0x02, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0,
-    0x0B, 0x80, 0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00,
-    0x1E, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x60, 0x00, 0xB3, 0x8D, 0x00, 0x0D, 0x0F, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00,
-    0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00,
-    0xF0, 0x2D, 0x00, 0x1E, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x3E, 0x07, 0xD0, 0x02, 0xF8, 0x3F, 0x00, 0x05,
-    0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE,
-    0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0B, 0x80, 0x3C, 0x00, 0xB8, 0x00, 0x78, 0x03, 0xC0, 0x01, 0xD0,
-    0x1E, 0x00, 0x0B, 0x40, 0xB4, 0x00, 0x3C, 0x02, 0xD0, 0x01, 0xE0, 0x0B, 0xC0, 0x2F, 0x40, 0x1F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x56, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x01,
-    0xBF, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xE0, 0xFF, 0x40, 0x00, 0x02, 0xE0,
-    0xB1, 0xE0, 0x00, 0x00, 0xF0, 0x78, 0x78, 0x00, 0x00, 0x78, 0x3C, 0x2D, 0x00, 0x00, 0x2D, 0x1E,
-    0x0F, 0x00, 0x00, 0x0F, 0x4F, 0x07, 0x80, 0x00, 0x02, 0xFB, 0x8B, 0xD0, 0x00, 0x00, 0xBF, 0xFF,
-    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x1F, 0x00,
-    0x2E, 0x07, 0x80, 0x0F, 0x42, 0xD0, 0x03, 0xC0, 0xF0, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x1F, 0x00,
-    0x3D, 0x07, 0x80, 0x2F, 0x02, 0xFE, 0xFF, 0xC0, 0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x02, 0xFE,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x7C, 0x1F, 0x00, 0x2E, 0x07, 0x80, 0x0F, 0x42, 0xD0, 0x03, 0xC0,
-    0xF0, 0x01, 0xF0, 0x3C, 0x00, 0xB8, 0x1F, 0x00, 0x3D, 0x07, 0x80, 0x2F, 0x02, 0xFE, 0xFF, 0xC0,
-    0xBF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x02, 0xFE, 0x3D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xF4,
-    0x00, 0x02, 0xD7, 0x40, 0x01, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x7C, 0x00,
-    0xB8, 0x1E, 0x00, 0x3D, 0x0B, 0x40, 0x0F, 0x03, 0xC0, 0x07, 0xC0, 0xF0, 0x02, 0xE0, 0x7C, 0x00,
-    0xF4, 0x1E, 0x00, 0xBC, 0x0B, 0xFB, 0xFF, 0x02, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x0B, 0xF8,
-    0xF4, 0x00, 0x00, 0x05, 0x01, 0x40, 0x03, 0xF0, 0x3D, 0x00, 0x3E, 0x0B, 0xD0, 0x0B, 0xE0, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x7C, 0x00, 0xB8, 0x07, 0x80,
-    0x0F, 0x40, 0xB4, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x02, 0xE0, 0x1F, 0x00, 0x3D, 0x01,
-    0xE0, 0x0B, 0xC0, 0x2F, 0xEF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x00, 0xBF, 0x8F,
-    0x40, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07,
-    0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00,
-    0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x0F, 0xBE, 0x00, 0x07, 0x42, 0xE0, 0x02, 0xC0, 0x3C, 0x00,
-    0xF0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1D, 0x00, 0xE0, 0x0B, 0x00, 0xB0, 0x03, 0xC0, 0xB8, 0x00,
-    0xE0, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x2F, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x01,
-    0xF0, 0x2F, 0x00, 0x03, 0xF0, 0x3E, 0x00, 0x07, 0xF0, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4,
-    0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E,
-    0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F,
-    0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x56, 0xA8, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,
-    0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01,
-    0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80,
-    0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x05, 0x5A, 0xA0, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0x80, 0xBC, 0x00,
-    0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x1D, 0x00, 0x1E, 0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0,
-    0x0B, 0xD0, 0x0F, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0xF0, 0x00, 0x7F, 0x97,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x74,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F,
-    0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D,
-    0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00,
-    0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02,
-    0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE,
-    0x24, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xE0, 0x2F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0,
-    0x07, 0x40, 0x07, 0x80, 0x2C, 0x00, 0x3E, 0x00, 0xF0, 0x02, 0xF4, 0x03, 0xE0, 0x7F, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xBC, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1F, 0x3C,
-    0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xD0,
-    0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF,
-    0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBD, 0x0F,
-    0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C,
-    0x00, 0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0,
-    0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01,
-    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-    0x02, 0xFE, 0x56, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10,
-    0x01, 0xFF, 0xFA, 0xAF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF,
-    0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x74, 0xB0, 0x00, 0x00, 0x0D, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02,
-    0xFE, 0x56, 0x80, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10, 0x01,
-    0xFF, 0xFA, 0xAF, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0B, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x2F, 0x40, 0x00, 0x07, 0x5E, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x03, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x02,
-    0xFE, 0xA0, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x15, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x02, 0xFE, 0x56, 0x80,
-    0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x10, 0x01, 0xFF, 0xFA, 0xAF,
-    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x0B,
-    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-    0x40, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0xFF,
-    0xF4, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE0,
-    0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xEA, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x30, 0x06, 0x00, 0x00, 0x02, 0xD3, 0x80, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
-    0xC0, 0x00, 0x2F, 0xE5, 0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x01, 0x00, 0x1F, 0xFF, 0xAA, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x02, 0x80, 0x02, 0xD7, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x3F, 0xFD, 0x00, 0x3F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFA, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x00, 0x01, 0xD7, 0x80,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0, 0x00, 0x7C, 0x00, 0x0B, 0xD0,
-    0x03, 0xE0, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C, 0x00, 0x00, 0xFC, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x3D, 0x00, 0x00, 0x7E, 0x01, 0xF0, 0x00, 0x03,
-    0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x00,
-    0x3C, 0x3C, 0x00, 0x00, 0x00, 0x74, 0x38, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0x00, 0x0B, 0xF4, 0xF0,
-    0x50, 0x00, 0x7F, 0xFD, 0xE0, 0x00, 0x01, 0xF4, 0x2F, 0xD0, 0x00, 0x03, 0xC0, 0x0F, 0xC0, 0x00,
-    0x0F, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x1F, 0x40, 0x00, 0x2D, 0x00, 0x2F, 0x00, 0x00, 0x3D,
-    0x00, 0x7F, 0x00, 0x00, 0x3F, 0x96, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x00, 0x00, 0x02, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE,
-    0x90, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x0F, 0x00, 0x1F, 0xF0,
-    0x00, 0xBC, 0x00, 0x0B, 0xD0, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x0F, 0x40, 0x00, 0x3F, 0x00, 0x7C,
-    0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xE0, 0x03, 0xF3, 0xFF, 0xFF, 0x40, 0x0F, 0xC0, 0x7D, 0x00, 0x00,
-    0xBE, 0x01, 0xF0, 0x00, 0x03, 0xF4, 0x0B, 0xC0, 0x00, 0x7F, 0xC0, 0x3F, 0x56, 0xAF, 0xFD, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xFF, 0xD0, 0x00, 0xFF, 0xFF,
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0xBF, 0x4F, 0x00, 0x00, 0x1F, 0xFF, 0x78, 0x00, 0x01, 0xF4, 0x2F, 0xD0, 0x00, 0x0F, 0x00,
-    0x3F, 0x00, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x07, 0xD0, 0x00, 0x2D, 0x00, 0x2F, 0x00,
-    0x00, 0xF4, 0x01, 0xFC, 0x00, 0x03, 0xF9, 0x6F, 0xE0, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x0F,
-    0xFF, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xAA, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x50, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
-    0xFF, 0xE0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xF4,
-    0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xD0, 0x01, 0xAA,
-    0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x07, 0xFF, 0x00, 0x00, 0xB9, 0x0B, 0x00, 0x0B, 0x40, 0x0D, 0x00, 0x78, 0x05, 0xB4, 0x03,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xEA, 0x95, 0x00, 0xB4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x0B, 0xD0,
-    0x01, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2C, 0x00, 0x00, 0x78, 0x07, 0x40, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x0F, 0xEA, 0xAA, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x03, 0xFF,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xC0, 0x00, 0xF0, 0x0F, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x2E, 0x42, 0xC0,
-    0x02, 0xD0, 0x03, 0x40, 0x1E, 0x01, 0x6D, 0x00, 0xFF, 0xFF, 0xF8, 0x07, 0xFA, 0xA5, 0x40, 0x2D,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x40, 0x07, 0xFF, 0xFF, 0x00, 0x0B, 0xFF,
-    0xF8, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07,
-    0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE,
-    0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF,
-    0xFF, 0xD0, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00,
-    0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x0B,
-    0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE, 0xA9, 0x50, 0xB4,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x01,
-    0xBF, 0x90, 0x00, 0x1D, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x50, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x0F, 0x1D, 0x00, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03,
-    0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x1C, 0x00, 0x07, 0x5E, 0x00, 0x00, 0x2F, 0x40, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0x90, 0xB0, 0x02, 0xD0, 0x03, 0x40, 0x78,
-    0x05, 0xB4, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0xA9, 0x50, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x2F, 0x40, 0x04, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x2C, 0x00, 0x00, 0x00, 0xD0,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x2F, 0xE4, 0x00, 0x10, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x94, 0x0F, 0xC0, 0x02, 0xFF, 0xE0, 0x3F,
-    0x00, 0x00, 0x3E, 0x41, 0xFC, 0x00, 0x01, 0xF0, 0x07, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xB1, 0xD0, 0x00, 0x02, 0xC0, 0x28,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0x3F, 0xFE, 0xF0,
-    0x00, 0xF8, 0x2F, 0xE0, 0x02, 0xD0, 0x0F, 0xD0, 0x03, 0xC0, 0x0F, 0xC0, 0x07, 0x40, 0x0F, 0xC0,
-    0x0B, 0x00, 0x1F, 0x40, 0x0B, 0x00, 0x3F, 0x00, 0x0B, 0x55, 0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFC, 0x00, 0x00, 0xBE, 0x7C, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x10, 0x0B, 0xF0, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0xC0, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x02, 0xFE, 0x40, 0x01,
-    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F,
-    0xE9, 0x40, 0xFC, 0x00, 0x2F, 0xFE, 0x03, 0xF0, 0x00, 0x03, 0xE4, 0x1F, 0xC0, 0x00, 0x1F, 0x00,
-    0x7F, 0x80, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0,
-    0x00, 0x74, 0x0B, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82,
-    0xFE, 0x00, 0xB4, 0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0, 0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4,
-    0x02, 0xC0, 0x0F, 0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x2F, 0x9F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF,
-    0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFE, 0x40, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xFA, 0x50, 0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFD, 0x28, 0x00, 0x3F, 0xFE, 0xF0, 0x03, 0xE0, 0xBF, 0x80, 0x2D, 0x00, 0xFD,
-    0x00, 0xF0, 0x03, 0xF0, 0x07, 0x40, 0x0F, 0xC0, 0x2C, 0x00, 0x7D, 0x00, 0xB0, 0x03, 0xF0, 0x02,
-    0xD5, 0x7F, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0B, 0xE7, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x10, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFD, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x02,
-    0xFE, 0x40, 0x01, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x03, 0xFA, 0x50, 0xFC, 0x00, 0x2F, 0xFE, 0x0F, 0xC0, 0x00, 0x0F, 0x91, 0xFC, 0x00, 0x01, 0xF0,
-    0x1F, 0xE0, 0x00, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00,
-    0x7F, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF4,
-    0xA0, 0x00, 0xFF, 0xFB, 0xC0, 0x0F, 0x82, 0xFE, 0x00, 0xB4, 0x03, 0xF4, 0x03, 0xC0, 0x0F, 0xC0,
-    0x1D, 0x00, 0x3F, 0x00, 0xB0, 0x01, 0xF4, 0x02, 0xC0, 0x0F, 0xC0, 0x0B, 0x55, 0xFF, 0x00, 0x1F,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x2F, 0x9F, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x40, 0x2F,
-    0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x74,
-    0x00, 0x00, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x00, 0xF8, 0x00,
-    0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF,
-    0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00,
-    0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0x1D, 0x00,
-    0x02, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x9F, 0xE0, 0x00,
-    0xBF, 0xFF, 0xC0, 0x0F, 0xE4, 0x7C, 0x00, 0xF8, 0x02, 0xC0, 0x2F, 0x00, 0x2C, 0x03, 0xD0, 0x03,
-    0xC0, 0x3C, 0x00, 0x38, 0x0B, 0xC0, 0x07, 0x80, 0xF8, 0x00, 0xF4, 0x0F, 0x40, 0x0F, 0x02, 0xF0,
-    0x02, 0xF0, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x28, 0x00, 0x0F, 0x40, 0x00, 0x7C,
-    0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00,
-    0x7D, 0x00, 0x02, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xF8,
-    0x00, 0x0B, 0xD0, 0x02, 0xF8, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F,
-    0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F, 0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x0F, 0x5A, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x6D,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x39, 0xFE, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xFE, 0x47, 0xC0,
-    0x0F, 0x80, 0x2C, 0x02, 0xF0, 0x02, 0xC0, 0x3D, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0x80, 0xBC, 0x00,
-    0x78, 0x0F, 0x80, 0x0F, 0x40, 0xF4, 0x00, 0xF0, 0x2F, 0x00, 0x2F, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-    0x0F, 0x03, 0x40, 0x0E, 0x70, 0xC0, 0x03, 0x0D, 0xA0, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xD0, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x07, 0xE0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x2F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x01, 0xF4, 0x34, 0x0E, 0x71, 0xC0, 0x70, 0xBD, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x40, 0x00,
-    0x2C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xC0, 0x00,
-    0x2F, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-    0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0,
-    0xAA, 0x95, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x38, 0x00,
-    0x01, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x40, 0x00, 0x3D, 0x00,
-    0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B,
-    0xD0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF4, 0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00,
-    0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF4, 0x00, 0x3F,
-    0x00, 0x07, 0xF0, 0x00, 0xBF, 0x00, 0x0A, 0x00, 0x02, 0x80, 0x00, 0x39, 0x00, 0x01, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x2C, 0x00, 0x03, 0x80, 0x00, 0x74, 0x00, 0x0B,
-    0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x02, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xC0, 0x00, 0xBC, 0x00,
-    0x0F, 0x80, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x03, 0x50, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x2F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x2F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF0,
-    0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x60, 0x02, 0xC0, 0x0E, 0x00, 0x74, 0x02, 0xC0,
-    0x0F, 0x00, 0x38, 0x02, 0xD0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x0B, 0x80, 0x00, 0x1F, 0x80, 0x0F,
-    0x80, 0x07, 0xD0, 0x07, 0xD0, 0x02, 0xF0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x3E, 0x00,
-    0x7E, 0x00, 0x1F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0xF8,
-    0x02, 0xF4, 0x00, 0x7D, 0x00, 0xFC, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x1F, 0x40, 0x07,
-    0xE0, 0x0B, 0xC0, 0x02, 0xF8, 0x03, 0xE0, 0x00, 0xFD, 0x01, 0xF4, 0x00, 0x7F, 0x00, 0xBC, 0x00,
-    0x2F, 0xC0, 0x3F, 0x00, 0x0B, 0xE0, 0x1F, 0x40, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xBF, 0xE0,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x14, 0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x3F, 0x00, 0x00, 0xBD, 0x00, 0x15, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x01, 0xD0, 0x00, 0xD0, 0x00, 0x03, 0xC0,
-    0x02, 0xC0, 0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00, 0x07, 0x40, 0x03, 0x80, 0x00, 0x0B, 0x00, 0x0B,
-    0x40, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x00, 0x2C, 0x00, 0x2F, 0x00,
-    0x00, 0x3C, 0x00, 0x2E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x0F, 0x2D, 0x00, 0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x00, 0xBD, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xE2, 0xC0, 0x00, 0x00, 0xE0, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-    0x00, 0x2D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00, 0xBC, 0x1F, 0x80, 0x00, 0x3E, 0x0F, 0xC0,
-    0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00, 0x03, 0xEB, 0xD0, 0x00, 0x01, 0xFF, 0xD0,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF, 0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x3E,
-    0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x7C, 0x00,
-    0xF1, 0xF0, 0x01, 0xE7, 0xC0, 0x02, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xFD, 0x00, 0x0B, 0xBF,
-    0x00, 0x0F, 0x6F, 0xC0, 0x1F, 0x0F, 0xE0, 0x2F, 0x07, 0xF4, 0x3E, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xBE, 0x00, 0x00, 0xFC, 0x00, 0x01,
-    0xF8, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x1D, 0x02, 0xC7, 0x80,
-    0x38, 0xE0, 0x07, 0x7C, 0x00, 0xBF, 0x00, 0x0F, 0xC0, 0x01, 0xFC, 0x00, 0x3E, 0xF0, 0x03, 0x8F,
-    0x80, 0x74, 0xFD, 0x0F, 0x07, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF1, 0x55, 0x91, 0xFF, 0xFF,
-    0xF8, 0xBF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-    0x70, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xF0, 0x00, 0x02,
-    0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x40, 0x00, 0xBF, 0xC0, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x06, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x7C, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xD0, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0xFC, 0x55, 0x64, 0x7F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x03, 0xC0,
-    0x02, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x02, 0xE0, 0x00,
-    0xF0, 0x00, 0x7C, 0x00, 0x2E, 0x00, 0x0F, 0x40, 0x03, 0xC0, 0x01, 0xF1, 0x00, 0xBF, 0xC0, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x03, 0xF0, 0x02, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x50, 0x00, 0xF4, 0x03, 0xC0, 0x07, 0xC0, 0x1D, 0x00, 0x2F,
-    0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x55, 0x54, 0x07, 0xFF, 0xFF, 0xE0,
-    0x2F, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x03, 0x80, 0x03,
-    0xC2, 0xD0, 0x02, 0xE0, 0xF0, 0x00, 0xF0, 0x14, 0x00, 0x7C, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xD0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF1, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x3E, 0x00, 0xF4, 0x00, 0xF4, 0x0B, 0xC0, 0x07, 0xC0, 0x3F, 0x00, 0x3F, 0x00,
-    0x54, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0xFC, 0x55, 0x64, 0x07, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x28, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x14, 0x0B, 0x82, 0xF0, 0x3C, 0x0F, 0x81, 0xF0, 0xBE, 0x0B, 0x80, 0x00,
-    0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC4, 0x00,
-    0x2F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x68, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0B,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCB, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xC5, 0x56, 0x40, 0x00,
-    0x00, 0x07, 0xD7, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xD2, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x07,
-    0xD0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x56, 0xE4, 0x00, 0x16, 0xBF, 0xA4,
-    0x00, 0x1F, 0xE9, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x00, 0x00, 0x7C, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xF0, 0x00, 0x3E, 0x00, 0x03,
-    0xFC, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x40, 0x0B, 0xC0, 0x00, 0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x3F,
-    0xF8, 0x01, 0xF4, 0x00, 0x0F, 0xBF, 0x00, 0xBC, 0x00, 0x07, 0xDF, 0xC0, 0x3F, 0x00, 0x03, 0xF2,
-    0xF4, 0x1F, 0x80, 0x00, 0xFC, 0x7D, 0x0B, 0xC0, 0x00, 0xBE, 0x0F, 0x83, 0xF0, 0x00, 0x3F, 0x43,
-    0xF1, 0xF8, 0x00, 0x0F, 0xC0, 0xBC, 0xBD, 0x00, 0x0B, 0xF0, 0x2F, 0x7F, 0x00, 0x03, 0xF8, 0x07,
-    0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x69, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F, 0xE0, 0x7C, 0x00, 0x3D, 0x00, 0xF0,
-    0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x0F,
-    0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xBC, 0x02, 0xF4, 0x03, 0xF0, 0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x3F,
-    0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E, 0x00, 0x03, 0xEF,
-    0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0, 0x00, 0x3F, 0x1F,
-    0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0x2F,
-    0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0x40, 0x3F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-    0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C,
-    0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0,
-    0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x02, 0xC0, 0xB0, 0x00,
-    0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x00, 0x02, 0xFC, 0x00, 0x0F, 0x40, 0x00, 0xFF, 0x00, 0x0B, 0xC0, 0x00,
-    0x7F, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xBF, 0x00, 0xBC, 0x00, 0x07,
-    0xDF, 0xC0, 0x3F, 0x00, 0x03, 0xF2, 0xF4, 0x1F, 0x80, 0x00, 0xFC, 0x7D, 0x0B, 0xC0, 0x00, 0x7E,
-    0x0F, 0x83, 0xF0, 0x00, 0x3F, 0x43, 0xF1, 0xF8, 0x00, 0x0F, 0xC0, 0xBC, 0xBD, 0x00, 0x0B, 0xF0,
-    0x2F, 0x7F, 0x00, 0x03, 0xF8, 0x07, 0xFF, 0x80, 0x00, 0xFD, 0x00, 0xFF, 0xD0, 0x00, 0xBF, 0x00,
-    0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x07, 0x07,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x0F,
-    0xE0, 0x7C, 0x00, 0x3D, 0x00, 0xF0, 0x02, 0xF0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3C, 0x00,
-    0xF8, 0x02, 0xF0, 0x03, 0xD0, 0x0F, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0xBC, 0x02, 0xF4, 0x03, 0xF0,
-    0x0F, 0xC0, 0x0F, 0x80, 0x00, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x6A, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F,
-    0x43, 0xD0, 0x0B, 0xC0, 0x2D, 0x00, 0xF4, 0x02, 0xD0, 0x1F, 0x00, 0x3D, 0x02, 0xE0, 0x07, 0xC0,
-    0x3D, 0x00, 0xBC, 0x07, 0xC0, 0x0F, 0x80, 0xFC, 0x00, 0xF8, 0x0F, 0xC0, 0x1F, 0x41, 0xF8, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03,
-    0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E,
-    0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0,
-    0x00, 0x3F, 0x1F, 0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0, 0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00,
-    0x03, 0xF0, 0x2F, 0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00,
-    0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00,
-    0x0B, 0xFE, 0x40, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF,
-    0xF4, 0x00, 0xFE, 0x07, 0xC0, 0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03,
-    0xC0, 0x0F, 0x80, 0xBC, 0x00, 0xF4, 0x0F, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F,
-    0x03, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x2F, 0xF4, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x2F,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0xAF, 0xF0, 0x00, 0xBF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x02, 0xE0,
-    0x0F, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x74, 0x07, 0x80, 0x02, 0xD0, 0x2D, 0x00, 0x0F,
-    0x00, 0xB4, 0x00, 0x78, 0x02, 0xF0, 0x0B, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0xE0, 0x1D, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0xFE,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02, 0xFF,
-    0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0x2F, 0xFF, 0x80, 0x02,
-    0xE0, 0x0F, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x74, 0x07, 0x80, 0x02, 0xD0, 0x2D, 0x00,
-    0x0F, 0x00, 0xB4, 0x00, 0x78, 0x02, 0xF0, 0x0B, 0xD0, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x03, 0xC0,
-    0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x00, 0x0B, 0x80, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF9, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xFA,
-    0x5A, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
-    0x00, 0x06, 0x40, 0x0F, 0x40, 0x07, 0xC0, 0x0F, 0x80, 0x0B, 0xC0, 0x05, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1B, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x2E, 0x00, 0x1E,
-    0x00, 0x0F, 0x00, 0x07, 0x40, 0x07, 0x80, 0x02, 0xD0, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0xB4, 0x00,
-    0x78, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0B,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFD, 0x7F, 0xFF,
-    0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xF4, 0x0B, 0xF9, 0x54, 0x00, 0x00,
-    0x3F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xF9,
-    0x54, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xFF, 0xF4, 0x00,
-    0x0F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xF9, 0x56, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA8, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0x00, 0x6F, 0xFE, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x01, 0xBF,
-    0x80, 0xBF, 0xE0, 0x00, 0xBF, 0xFF, 0x3E, 0x03, 0x80, 0x2E, 0x00, 0xFF, 0x00, 0x1C, 0x0B, 0x80,
-    0x07, 0xC0, 0x16, 0xC0, 0xF0, 0x00, 0x7F, 0xFF, 0xFC, 0x1E, 0x00, 0x0B, 0xFA, 0x95, 0x42, 0xD0,
-    0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x1F, 0x00, 0x00, 0x02, 0xF0, 0x0B, 0xFC, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFD, 0x3F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90,
-    0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0,
-    0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0,
-    0x0B, 0xE0, 0x07, 0xD0, 0x0F, 0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0,
-    0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00, 0x34, 0x00, 0x03, 0xC0, 0x00, 0x2C, 0x00, 0x01, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x40, 0x1E, 0xBF, 0x00, 0xBF, 0xFC, 0x03, 0xF8, 0x00,
-    0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00,
-    0x1F, 0xC0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x0E,
-    0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78,
-    0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0xFF,
-    0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0, 0x07, 0xD0, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x1E, 0xBF, 0x00, 0x2F, 0xFF, 0x00,
-    0x3F, 0x80, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0,
-    0x00, 0x03, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0x00, 0x0F,
-    0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
-    0x00, 0xE0, 0x38, 0x00, 0x00, 0x3E, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x00, 0x0B, 0xFF, 0xF4, 0x00,
-    0x0E, 0x00, 0x7C, 0x00, 0x1D, 0x00, 0x3C, 0x00, 0x2C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x78, 0x00, 0xF8, 0x00, 0xB4, 0x07, 0xF4, 0x00, 0xFF, 0xFF, 0xD0, 0x01, 0xFF, 0xFF, 0x00, 0x02,
-    0xFF, 0xFF, 0x80, 0x03, 0xF4, 0x0B, 0xC0, 0x07, 0xF0, 0x07, 0xC0, 0x0B, 0xE0, 0x07, 0xD0, 0x0F,
-    0xD0, 0x0F, 0xD0, 0x1F, 0xC0, 0x0F, 0xD0, 0x2F, 0xC0, 0x1F, 0xD0, 0x3F, 0x80, 0x3F, 0xD0, 0x01,
-    0x00, 0x04, 0x01, 0xC0, 0x74, 0x00, 0xB7, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x14, 0x00, 0x7A, 0xFC, 0x00, 0xBF, 0xFC, 0x00, 0xFE, 0x00, 0x00, 0xF4, 0x00,
-    0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0xE8, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xEA, 0xA4, 0x00, 0x1F, 0xD0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF9,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00,
-    0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0x40, 0x07, 0xFF, 0x40, 0xBF, 0xFF, 0xFF,
-    0xF0, 0x2F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE,
-    0xA8, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0,
-    0x00, 0x01, 0xF4, 0x05, 0x01, 0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00,
-    0xE2, 0xC0, 0x00, 0x00, 0x0D, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xFA, 0xA9, 0x00, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x1B, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x01, 0x40,
-    0x07, 0xFF, 0x40, 0x2F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1B, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x02,
-    0xF4, 0x00, 0x01, 0xE7, 0x80, 0x00, 0xD0, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xFF, 0x90, 0x03, 0xFA, 0xA0, 0x02, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-    0xFD, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x7D, 0x00, 0x50, 0x1F, 0x40, 0xBF, 0xFF, 0xC0, 0x7F,
-    0xFF, 0xD0, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF, 0xF8, 0x00,
-    0x0B, 0xFE, 0xAA, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0x80, 0x14, 0x00, 0x7F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x00, 0x1F,
-    0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40,
-    0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01, 0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F,
-    0xFE, 0x40, 0x00, 0x80, 0x00, 0x01, 0x90, 0x00, 0x00, 0x08, 0x00, 0x00, 0x28, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x02, 0xC1, 0xD0, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x80, 0x00, 0x2F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xFE, 0xAA, 0x40, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-    0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x14, 0x00, 0x7F, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x01, 0xBF, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x00, 0xD0, 0x34, 0x00, 0x7A, 0xD0, 0x00, 0x2F, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0xFE, 0xA8, 0x02, 0xC0, 0x00, 0x03,
-    0x80, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x6F, 0xF0, 0x00, 0x01, 0xF4, 0x05, 0x01,
-    0xF4, 0x2F, 0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x2F, 0xFE, 0x40, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0xB8, 0x00,
-    0x0F, 0x40, 0x05, 0xF5, 0x43, 0xFF, 0xFC, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0xF4,
-    0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xFE, 0x40, 0x7F, 0xF8, 0x07, 0xFF, 0x40,
-    0x06, 0x40, 0x00, 0x02, 0x00, 0x00, 0x90, 0x01, 0xF8, 0x00, 0x00, 0x18, 0x01, 0x80, 0x00, 0x03,
-    0xC7, 0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0xBF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x04, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x2C, 0x3C, 0x00, 0xB8, 0x78, 0x00,
-    0xF4, 0x00, 0x05, 0xF5, 0x40, 0x3F, 0xFF, 0xC0, 0x03, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xC0,
-    0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xE4, 0x00,
-    0x7F, 0xF8, 0x00, 0x7F, 0xF4, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00,
-    0x5F, 0x54, 0x03, 0xFF, 0xFC, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0xF4, 0x3F, 0xFF,
-    0xF0, 0x00, 0xF0, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xFE, 0x40, 0x07, 0xFF, 0x80,
-    0x07, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0x41, 0x80, 0x00, 0x00, 0x73, 0x09, 0x00, 0x00, 0x03, 0x4A,
-    0x70, 0x00, 0x00, 0x0C, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0xA9, 0x00, 0xBE, 0x00, 0x03, 0xF4, 0x03, 0xF4,
-    0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x7F, 0x00, 0x03, 0xF4, 0x02, 0xF4, 0x00, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x01, 0xF4, 0x01, 0xF8, 0x00, 0x0B, 0xC0, 0x07,
-    0xD0, 0x00, 0x3F, 0x00, 0x2F, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x03, 0xE0, 0x00,
-    0x3F, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xE0, 0x60, 0x02, 0xCD, 0x34, 0x00, 0xD0, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x07, 0xC0, 0x0B, 0x81, 0xE0, 0x03, 0xD0,
-    0xB4, 0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x41, 0xE0, 0x0B, 0xC0,
-    0xBF, 0xBF, 0xF0, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x15,
-    0x6A, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x0A, 0x90, 0x0B, 0xE0, 0x00, 0x3F, 0x40, 0x3F,
-    0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xF0, 0x00, 0x3F, 0x40, 0x2F, 0x40, 0x00,
-    0xFC, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x03, 0xF0, 0x00, 0x1F, 0x40, 0x1F, 0x80, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E, 0x00,
-    0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x15, 0x6A, 0x80, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x00, 0x7C, 0x07, 0xC0, 0x0B, 0x80, 0x78, 0x00, 0xF4, 0x0B, 0x40, 0x0F, 0x00, 0xF0,
-    0x01, 0xF0, 0x0F, 0x00, 0x2E, 0x01, 0xF0, 0x03, 0xD0, 0x1E, 0x00, 0xBC, 0x02, 0xFE, 0xFF, 0xC0,
-    0x2F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00,
-    0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x0B, 0xE0, 0x00, 0x3F, 0x00,
-    0x3F, 0x40, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x07, 0xE0, 0x00, 0x3F, 0x40, 0x2F, 0x40,
-    0x00, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x1F, 0x80, 0x00, 0xFC,
-    0x00, 0xBC, 0x00, 0x03, 0xF0, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x3E,
-    0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x40, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x00, 0x3C, 0x07, 0x80, 0x02, 0xFF, 0xE0, 0x00, 0x0B,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0,
-    0x7C, 0x00, 0xB8, 0x07, 0x80, 0x0F, 0x40, 0xB4, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x02,
-    0xE0, 0x1F, 0x00, 0x3D, 0x01, 0xE0, 0x0B, 0xC0, 0x2F, 0xEF, 0xFC, 0x02, 0xFF, 0xFF, 0xC0, 0x1F,
-    0xFF, 0xF8, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x06, 0x14, 0x00,
-    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x02,
-    0xF4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00,
-    0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0,
-    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x31, 0x40, 0x00, 0x24,
-    0x60, 0x00, 0x09, 0x70, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00, 0x3C, 0x0F, 0x00,
-    0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF, 0xFC, 0x0B, 0xFF,
-    0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xD0, 0x00, 0x00, 0x14, 0x00, 0x05, 0x00, 0x00, 0xB8,
-    0x00, 0x7C, 0x00, 0x03, 0xE0, 0x01, 0xF4, 0x00, 0x05, 0x40, 0x02, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4,
-    0x00, 0xBE, 0x00, 0x03, 0xF4, 0x00, 0xFD, 0x00, 0x07, 0xF0, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x01,
-    0xFC, 0x00, 0x0F, 0xD0, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x03, 0xF0,
-    0x00, 0x1F, 0x40, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x07, 0xD0, 0x00, 0x3F, 0x00, 0x0B, 0xC0, 0x00,
-    0x7D, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xF4,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x3D, 0x01, 0xF0, 0x00, 0xF8, 0x07, 0x90, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0x80, 0x07, 0x80,
-    0x0F, 0x40, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0,
-    0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0,
-    0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F,
-    0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F,
-    0x80, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00,
-    0x3C, 0x0F, 0x00, 0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE7, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x07,
-    0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x2C, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x40, 0x00, 0x00, 0x02, 0xF0, 0x2F, 0x40, 0x00, 0x00,
-    0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0x80, 0x2F, 0x00,
-    0x3F, 0x40, 0x3F, 0x00, 0x2F, 0x00, 0xFF, 0x80, 0x7E, 0x00, 0x3F, 0x02, 0xFF, 0xC0, 0xFC, 0x00,
-    0x3F, 0x07, 0xFF, 0xC1, 0xF8, 0x00, 0x3F, 0x0F, 0xDF, 0xD3, 0xF0, 0x00, 0x3F, 0x3F, 0x8B, 0xD7,
-    0xE0, 0x00, 0x3F, 0xBF, 0x0B, 0xEF, 0xC0, 0x00, 0x3F, 0xFD, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8,
-    0x07, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xD0, 0x03, 0xFC, 0x00, 0x00,
-    0x3F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x2C, 0x78, 0x00, 0x00, 0x1C, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x40, 0x00, 0x00, 0x50, 0xF4, 0x00, 0x00, 0xBC, 0x3D, 0x00, 0x00, 0x3D, 0x0F, 0x40, 0x00, 0x2E,
-    0x03, 0xD0, 0xB8, 0x0F, 0x00, 0xF4, 0xBF, 0x0B, 0x80, 0x3D, 0xBF, 0xE3, 0xC0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x8F, 0xF8, 0x00, 0x3F, 0x83, 0xFC, 0x00, 0x0F, 0xC0,
-    0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B,
-    0x5E, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x4F, 0x80, 0x00,
-    0xF8, 0x3F, 0x00, 0x0B, 0xC0, 0xBC, 0x00, 0xBD, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0xF0, 0x3F, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x3F, 0x7F, 0x40, 0x00, 0xBF, 0xF8, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0xBF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x01, 0xD2, 0xC0, 0x00, 0x03, 0x40,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00,
-    0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F,
-    0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00,
-    0x00, 0x00, 0x05, 0x01, 0x40, 0x00, 0xBC, 0x0F, 0x80, 0x03, 0xE0, 0x7D, 0x00, 0x2F, 0x83, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x3E,
-    0x00, 0x03, 0xE0, 0xFC, 0x00, 0x2F, 0x02, 0xF0, 0x02, 0xF4, 0x07, 0xE0, 0x1F, 0x80, 0x0F, 0xC0,
-    0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0xFD, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00,
-    0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xD5,
-    0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x0B, 0xD0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
-    0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x55, 0x55, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x02, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00,
-    0x1F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xFA, 0xA4, 0x00, 0x7F, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x01, 0xD2, 0xC0, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
-    0x7F, 0xD0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0x80,
-    0x00, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0x40, 0x01, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1C, 0x07, 0x40,
-    0x00, 0x2D, 0xB0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00,
-    0x7D, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0xEA, 0x90, 0x01, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x7E, 0xD0, 0x03, 0xC0, 0x00, 0x2D, 0x00, 0x00, 0xF0,
-    0x00, 0x07, 0x80, 0x00, 0x2D, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x2E, 0x00, 0x00, 0xF4,
-    0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x40, 0x00, 0xBC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x02, 0xFF, 0xE0, 0x00, 0x28, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x1D, 0x00, 0x0F, 0xE4, 0x0B, 0xF0,
-    0x1E, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x0E, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0xBC, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1B, 0xF8, 0x0C, 0x00, 0xBF,
-    0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x1E, 0x00,
-    0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE4, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x2F, 0xF0, 0x02, 0xF0, 0x1F, 0xBC, 0x00, 0x3C, 0x0B, 0x3E, 0x00, 0x0F, 0x03,
-    0x8F, 0x40, 0x0B, 0x80, 0x87, 0xC0, 0x1B, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x7F, 0xA9, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x4B, 0xE0, 0x00, 0x02, 0xDF, 0xFF,
-    0x00, 0x00, 0xFF, 0x41, 0xD0, 0x00, 0x7F, 0x00, 0x38, 0x00, 0x2F, 0x40, 0x0E, 0x00, 0x0F, 0xC0,
-    0x03, 0x80, 0x03, 0xF0, 0x01, 0xD0, 0x01, 0xFC, 0x00, 0xF0, 0x00, 0xBF, 0x40, 0xB8, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xBF, 0xFD, 0x00, 0x0F, 0x8F, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x0B, 0xFF, 0xFD, 0x00, 0xB0, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F,
-    0x55, 0x50, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55,
-    0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xBF, 0xFF, 0xE0, 0xB4, 0x1F, 0x40, 0x00, 0x14, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC0,
-    0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x01, 0xBD, 0x50,
-    0x3F, 0xFF, 0xC0, 0x0F, 0x40, 0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x3C, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0xE4, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x40, 0x00, 0x05,
-    0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x07, 0xF0, 0x00, 0x3F, 0x89, 0x00, 0xBE, 0x00, 0x03, 0xF5, 0xC0, 0x0F, 0xD0,
-    0x00, 0x7F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF4,
-    0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x7E,
-    0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x0F,
-    0xC0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B, 0xF4, 0x07, 0x80, 0x0F, 0xD0, 0x0B,
-    0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x1E,
-    0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B,
-    0xF8, 0xF4, 0x00, 0x7C, 0x01, 0xF0, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x0B, 0x01, 0xD0, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF0, 0x00, 0xE2, 0xD0, 0x28, 0x02, 0x40, 0x1F, 0x03,
-    0x0E, 0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x97, 0xFF, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x55, 0x82, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x1C, 0x3C, 0x07, 0x82, 0xFF, 0xE0, 0x0B, 0xE4, 0x00, 0x1F, 0x0F, 0xC7, 0xF1, 0x54, 0x0F,
-    0x02, 0xF2, 0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54, 0x2E, 0x80, 0x1C, 0x0B, 0x00, 0x80, 0x0A,
-    0x82, 0x49, 0x30, 0xC2, 0xF4, 0x00, 0x00, 0x02, 0xD0, 0x01, 0xF0, 0x3E, 0x00, 0x1F, 0x03, 0xE0,
-    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x34, 0x07, 0x07, 0x4E, 0x00, 0xBE, 0x00, 0x0E, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0xBE, 0x00, 0xFC, 0x02, 0xF4, 0x03, 0xF0, 0x0B, 0xE0, 0x03, 0xF8, 0x1F, 0xC0,
-    0xBD, 0x03, 0xF0, 0x2F, 0x40, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xD0, 0x07, 0xE0, 0x02,
-    0xF4, 0x00, 0xF8, 0x01, 0x40, 0xC3, 0xF0, 0x28, 0x05, 0x00, 0x20, 0x0D, 0x02, 0xF8, 0x70, 0x08,
-    0x00, 0x3E, 0xA5, 0x4A, 0xBF, 0xE0, 0x00, 0x74, 0x00, 0x2C, 0x00, 0x0F, 0x00, 0x00, 0x09, 0x0C,
-    0x74, 0x90, 0x04, 0x24, 0x20, 0x34, 0x00, 0x08, 0x07, 0x47, 0xF4, 0x06, 0xA4, 0x1B, 0xD0, 0xC0,
-    0x20, 0x00, 0x02, 0x06, 0xE4, 0x20, 0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x05, 0x0B, 0xC3, 0xF2, 0xF8, 0x01, 0x40, 0x50, 0x3E, 0x03, 0xD1, 0xF8, 0x2F, 0x0F, 0xD0, 0xFC,
-    0x0A, 0x82, 0x49, 0x30, 0xC2, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F,
-    0x02, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x29, 0x00, 0x18, 0x07, 0x4B, 0xD0, 0x00, 0x40, 0x70, 0x1C,
-    0x03, 0x40, 0x2F, 0x40, 0x10, 0x01, 0x02, 0xC0, 0xF0, 0x78, 0x2D, 0x0F, 0x00, 0x2F, 0xFC, 0x38,
-    0x2C, 0x70, 0x38, 0x00, 0x00, 0x70, 0x0A, 0x0B, 0x1E, 0x00, 0xFD, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x40, 0x03, 0xF4, 0x02, 0xD7, 0x81, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x0E,
-    0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0xE1, 0x55, 0x40, 0x1F, 0x03, 0x0E, 0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x40, 0x81, 0x4C, 0x00, 0xA0, 0x31,
-    0xC0, 0xD3, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x30, 0x0C, 0x30, 0x18, 0x60, 0x24, 0xBF, 0xF0, 0x0E,
-    0xA4, 0x24, 0x88, 0x31, 0x4C, 0x11, 0x04, 0x00, 0x00, 0x98, 0x07, 0x00, 0xB0, 0x32, 0x80, 0x1F,
-    0x03, 0x0E, 0x60, 0xC7, 0x0D, 0xA2, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x1D, 0x1C, 0x10, 0x00,
-    0x00, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x02,
-    0xF2, 0xF0, 0x3E, 0x3F, 0x07, 0xE1, 0x50, 0x54, 0x3F, 0xFD, 0xD1, 0xDA, 0x03, 0x00, 0x00, 0x01,
-    0x56, 0xA8, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6A,
-    0xB0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xCB, 0x41, 0xD3, 0xC0, 0xB0, 0xF0, 0x3C,
-    0xB8, 0x1E, 0x14, 0x05, 0x00, 0x00, 0x00, 0xFF, 0xD2, 0xAF, 0x40, 0x3C, 0x01, 0xF0, 0x01, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x50, 0x1F, 0x0F, 0x03, 0x9A, 0x70, 0x70,
-    0xFA, 0x0A, 0x0F, 0xC0, 0x02, 0x40, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x68, 0x07, 0xF4, 0xBC, 0x00, 0xF4, 0x1F, 0x80, 0x2F, 0x57, 0xD0, 0x3F,
-    0x00, 0x07, 0xFE, 0x40, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01, 0x80, 0x7C, 0x3C, 0x1E, 0x02, 0xC0,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x24, 0x0B, 0x8B, 0x01,
-    0xD0, 0x3C, 0x0F, 0x5F, 0x01, 0x90, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x54, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x05,
-    0x00, 0x20, 0xC1, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x02, 0xC0, 0xA4, 0x00, 0x1B,
-    0x40, 0x01, 0xAA, 0xA4, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x00, 0x90, 0x00, 0x06, 0xD0, 0x20, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2D, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x55, 0x55, 0x55, 0x57, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x3E, 0xF0, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0,
-    0x00, 0x07, 0xC0, 0xF4, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x02,
-    0xF0, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0xF4, 0x1F, 0x40, 0x00, 0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xE0, 0x00,
-    0x1F, 0xFE, 0x90, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x3D, 0x00, 0x7D, 0x00, 0x3C, 0x00, 0x2D, 0x00,
-    0x7C, 0x00, 0x2D, 0x00, 0xB8, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xF8, 0x01, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xD0, 0x03, 0xE0, 0x01, 0xF8, 0x03, 0xD0, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0xBC, 0x0B,
-    0x80, 0x00, 0xF8, 0x0F, 0x40, 0x02, 0xF8, 0x0F, 0x95, 0x6F, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x2F,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFC, 0x00, 0xF0,
-    0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00,
-    0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFA, 0xE0, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xC1, 0xF0, 0x00,
-    0x0F, 0x81, 0xF4, 0x00, 0x3F, 0x00, 0xF8, 0x00, 0xBC, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x00, 0xBD, 0x2F, 0x40, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00,
-    0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x55, 0x50, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
-    0x05, 0x00, 0x00, 0x14, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x2F,
-    0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x01, 0xF4, 0x00, 0x7D, 0x00, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x03, 0xF0, 0x00, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0x0F,
-    0xD0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0B, 0xFF, 0xFF, 0xFF, 0x40, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0xBF, 0x00, 0x2F,
-    0xC0, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00,
-    0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFD,
-    0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x40,
-    0x05, 0x03, 0xD0, 0x0B, 0xC3, 0xFF, 0xD0, 0xF4, 0x03, 0xE0, 0x55, 0x00, 0xBC, 0x00, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x96,
-    0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF,
-    0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
-    0x07, 0xD0, 0x02, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x40, 0x0B, 0xC0, 0x03, 0xF0, 0x00,
-    0xF8, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x07, 0xE0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x7F,
-    0x00, 0x2F, 0xC0, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x40, 0x01, 0xF0, 0x1F, 0x80, 0x00,
-    0xBC, 0x1F, 0x80, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x1F, 0x0F, 0xC0, 0x00, 0x0B, 0xCF, 0xC0, 0x00,
-    0x03, 0xEB, 0xD0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xEB, 0xF8, 0x00, 0x02, 0xF4, 0xFF,
-    0x00, 0x00, 0xFC, 0x3F, 0xF0, 0x00, 0x3E, 0x07, 0xFE, 0x00, 0x2F, 0x40, 0xFF, 0xD0, 0x0F, 0xC0,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xD0,
-    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0xFD, 0x3F, 0x40, 0x00, 0x7F, 0x0F,
-    0xE0, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x2F, 0x80, 0xBE, 0x00, 0x0F, 0xC0, 0x2F, 0xC0, 0x0F, 0xD0,
-    0x07, 0xF0, 0x07, 0xE0, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x0F, 0xC0, 0xFC,
-    0x00, 0x03, 0xF0, 0xBC, 0x00, 0x00, 0xBC, 0x3E, 0x00, 0x00, 0x1F, 0x5A, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x06, 0xA0, 0x00, 0x02, 0xA0, 0x00, 0x3F, 0xD0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x40, 0x02,
-    0xFE, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x2F, 0xF8, 0x00, 0xFF, 0xD0, 0x00, 0xFF, 0xF0,
-    0x0B, 0xFF, 0x00, 0x07, 0xEF, 0xC0, 0x3F, 0xBC, 0x00, 0x2F, 0x7F, 0x03, 0xF7, 0xF0, 0x00, 0xF8,
-    0xFD, 0x1F, 0x9F, 0x80, 0x07, 0xD3, 0xF4, 0xFC, 0xBD, 0x00, 0x2F, 0x0F, 0xEF, 0xD3, 0xF0, 0x00,
-    0xFC, 0x3F, 0xFE, 0x1F, 0xC0, 0x07, 0xF0, 0xBF, 0xF0, 0xFF, 0x00, 0x2F, 0x81, 0xFF, 0x43, 0xF8,
-    0x00, 0xFD, 0x07, 0xFC, 0x1F, 0xD0, 0x07, 0xF0, 0x0F, 0xC0, 0xFF, 0x40, 0x2F, 0xC0, 0x29, 0x03,
-    0xFC, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x01, 0xFC,
-    0x00, 0x0F, 0xC0, 0x00, 0xBF, 0x00, 0x03, 0xD0, 0x00, 0x3F, 0xC0, 0x02, 0xF0, 0x00, 0x1F, 0xF4,
-    0x00, 0xFC, 0x00, 0x0B, 0xFE, 0x00, 0x3E, 0x00, 0x03, 0xEF, 0xC0, 0x2F, 0x00, 0x01, 0xF7, 0xF0,
-    0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xE0, 0x00, 0x3F, 0x1F, 0x42, 0xF0, 0x00, 0x1F, 0x83, 0xE0,
-    0xFC, 0x00, 0x0F, 0xD0, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0x2F, 0x2F, 0x40, 0x02, 0xFC, 0x0B, 0xDF,
-    0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0x40, 0x3F, 0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC,
-    0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01,
-    0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03,
-    0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x50, 0x02,
-    0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x0E, 0x00, 0x38, 0x00, 0x74, 0x01, 0xD0, 0x02, 0xC0, 0x0B, 0x00,
-    0x0F, 0x00, 0x3C, 0x00, 0x38, 0x01, 0xE0, 0x01, 0xD0, 0x0B, 0x00, 0x0B, 0x00, 0x3C, 0x00, 0x3C,
-    0x00, 0xE0, 0x01, 0xE0, 0x07, 0x40, 0x0B, 0x40, 0x2C, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xE0, 0x03,
-    0x80, 0x07, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0xF0, 0x02,
-    0xF0, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x07, 0xC0,
-    0x1B, 0xD0, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x55, 0x50, 0x0B, 0xFF, 0xFD, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x55, 0x50, 0x03, 0xFF,
-    0xFF, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x0F, 0x83, 0xF0, 0x00,
-    0xBC, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x7E, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0xFC, 0x3F, 0x00,
-    0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x90, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00,
-    0x00, 0x7F, 0xEB, 0x47, 0xFE, 0x00, 0x00, 0x7F, 0x82, 0xC0, 0x2F, 0xC0, 0x00, 0x7F, 0x40, 0xF0,
-    0x03, 0xF4, 0x00, 0x3F, 0x40, 0x38, 0x00, 0xFD, 0x00, 0x2F, 0x40, 0x2C, 0x00, 0x3F, 0x40, 0x1F,
-    0xC0, 0x0F, 0x00, 0x0F, 0xC0, 0x0B, 0xD0, 0x03, 0x80, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xD0, 0x03,
-    0xF0, 0x00, 0xFC, 0x00, 0xB0, 0x03, 0xF8, 0x00, 0x7F, 0xD0, 0x38, 0x0B, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x01, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00,
-    0x2F, 0x00, 0x0B, 0xC0, 0x00, 0x07, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x00,
-    0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x07, 0xEB, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x2F, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x0B,
-    0xFF, 0xC0, 0x00, 0x00, 0x0B, 0xF7, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0xFE, 0x00, 0x00, 0x0B, 0xF0,
-    0x2F, 0xC0, 0x00, 0x0B, 0xF0, 0x03, 0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00,
-    0x1F, 0xD0, 0x00, 0x03, 0x80, 0x34, 0x07, 0x41, 0xE0, 0x1C, 0x02, 0xC0, 0x70, 0x0B, 0x00, 0xF0,
-    0x2C, 0x03, 0x80, 0x74, 0x0F, 0x00, 0xC0, 0x3C, 0x03, 0xC0, 0xB0, 0x2E, 0x00, 0xF4, 0x38, 0x2F,
-    0x00, 0x3F, 0x4D, 0x3F, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x01, 0xE4,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0x41, 0xF8, 0x00, 0x03,
-    0xE0, 0x00, 0xF4, 0x00, 0x3E, 0x00, 0x02, 0xE0, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x0F, 0x40, 0x00,
-    0x1F, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x02, 0xE0, 0x00, 0x03, 0xD0, 0x0F, 0x40, 0x00, 0x0F, 0x00,
-    0x3C, 0x00, 0x00, 0xF8, 0x00, 0xB4, 0x00, 0x0B, 0xC0, 0x01, 0xE0, 0x00, 0xFD, 0x00, 0x03, 0xE0,
-    0x2F, 0xC0, 0x02, 0xFF, 0xC0, 0xFF, 0xF0, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x24, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0xE0,
-    0x2F, 0x00, 0x01, 0xE0, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x74, 0x00, 0x78, 0x00, 0x2C,
-    0x00, 0x3E, 0x00, 0x0F, 0x00, 0x2F, 0x40, 0x03, 0xE0, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xF2, 0x00,
-    0x1F, 0xFF, 0xBE, 0xDA, 0x01, 0xFE, 0x5E, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x0F, 0x40, 0x1D, 0x00, 0x7C, 0x00, 0x74, 0x02,
-    0xD0, 0x02, 0xC0, 0x0F, 0x00, 0x2D, 0x00, 0x3C, 0x3F, 0x80, 0x01, 0xE0, 0xAF, 0x80, 0x0B, 0x40,
-    0x0B, 0x80, 0x3C, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0xB8, 0x07, 0xFD, 0x0B, 0xD0, 0x2F, 0xFF, 0xFF,
-    0x00, 0xF7, 0xFF, 0xF4, 0x07, 0xC1, 0xBF, 0x40, 0x2D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03,
-    0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x24, 0x00, 0x24, 0xF0, 0x01, 0xF3, 0xC0, 0x07, 0x8B,
-    0x40, 0x3D, 0x2E, 0x00, 0xF0, 0x7C, 0x0B, 0x80, 0xF0, 0x3C, 0x03, 0xD3, 0xE0, 0x0F, 0xFF, 0x00,
-    0x3F, 0xF4, 0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00,
-    0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x07, 0xEA, 0xFE,
-    0x00, 0xF4, 0x00, 0x40, 0x0B, 0x40, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x3F, 0xEF, 0xD0, 0x0F, 0xD0, 0x2F, 0x01,
-    0xF4, 0x00, 0xF0, 0x3F, 0x00, 0x1F, 0x03, 0xE0, 0x02, 0xF0, 0x3F, 0x00, 0xBD, 0x03, 0xFF, 0xFF,
-    0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x6F, 0x40, 0x1D, 0x0C, 0x03, 0x40, 0x80,
-    0x30, 0x00, 0x03, 0x40, 0x00, 0x1F, 0x40, 0x0B, 0x40, 0x01, 0xC0, 0x74, 0x2C, 0x0B, 0x01, 0xFF,
-    0xE0, 0x07, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x05, 0xBF, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0xF4, 0x00, 0x00, 0xF4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x07,
-    0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x54, 0x00, 0x0F, 0xBF, 0xF4, 0x00, 0xFD, 0x03,
-    0xC0, 0x1F, 0x00, 0x2C, 0x02, 0xD0, 0x02, 0xC0, 0x3C, 0x00, 0x3C, 0x07, 0xC0, 0x07, 0x80, 0xB8,
-    0x00, 0xB4, 0x0F, 0x40, 0x0F, 0x01, 0xF4, 0x01, 0xF0, 0x2F, 0x00, 0x2E, 0x03, 0xF0, 0x03, 0xD0,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x02,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x02, 0xD0, 0xB0, 0x00, 0xB0, 0x03, 0x40,
-    0x1E, 0x00, 0x38, 0x03, 0xC0, 0x03, 0x80, 0x78, 0x00, 0x38, 0x0F, 0xAA, 0xAB, 0x40, 0xFF, 0xFF,
-    0xF4, 0x1F, 0x00, 0x0F, 0x02, 0xE0, 0x02, 0xE0, 0x2F, 0x00, 0x7D, 0x03, 0xF0, 0x1F, 0xC0, 0x2F,
-    0xFF, 0xF4, 0x02, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x10, 0x00,
-    0xE0, 0x07, 0x40, 0x2C, 0x00, 0xF0, 0x03, 0x80, 0x2D, 0x00, 0xF0, 0x03, 0xC0, 0x2E, 0x00, 0xF8,
-    0x07, 0xD0, 0x2F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB8, 0x00, 0xE1, 0xE0, 0x01,
-    0xD7, 0xC0, 0x03, 0xCF, 0x00, 0x03, 0xBC, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xF0,
-    0x00, 0x2D, 0xFC, 0x00, 0x3C, 0xBE, 0x00, 0x78, 0x3F, 0x40, 0xB4, 0x2F, 0xC0, 0x69, 0x00, 0x00,
-    0x00, 0x7F, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x0F, 0xFC,
-    0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x1F, 0x6F, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x3E, 0x07,
-    0xC0, 0x00, 0x3D, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xB4, 0x00, 0xB4, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x01, 0xF0, 0x02, 0xE0, 0x07, 0x80, 0x0F, 0x40, 0x3D, 0x00, 0x3C,
-    0x00, 0xF0, 0x01, 0xF0, 0x0B, 0xC0, 0x0B, 0x80, 0x3F, 0x00, 0x3D, 0x01, 0xF8, 0x02, 0xF0, 0x0B,
-    0xFE, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xDF, 0xFF, 0xF8, 0x0E, 0x2F, 0xE3, 0xD0, 0x30, 0x00,
-    0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x24, 0xF0, 0x01, 0xF3, 0xC0, 0x07, 0x8B, 0x40,
-    0x3D, 0x2E, 0x00, 0xF0, 0x7C, 0x0B, 0x80, 0xF0, 0x3D, 0x03, 0xD3, 0xE0, 0x0F, 0xFF, 0x00, 0x3F,
-    0xF4, 0x00, 0xFF, 0xC0, 0x03, 0xFC, 0x00, 0x01, 0xFF, 0xFC, 0x01, 0x5F, 0xE4, 0x00, 0x2E, 0x00,
-    0x00, 0xB4, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x00, 0xFE, 0x40, 0x00, 0xBE, 0x40, 0x02,
-    0xD0, 0x00, 0x07, 0x40, 0x00, 0x07, 0x80, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x01, 0x50, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0,
-    0x00, 0xB4, 0x2D, 0x00, 0x0F, 0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x1A, 0xAA, 0xAA, 0x83, 0xFF, 0xFF, 0xFC, 0x03, 0xC0,
-    0xB4, 0x00, 0x78, 0x0F, 0x00, 0x0B, 0x41, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x1E, 0x03, 0x80, 0x02,
-    0xC0, 0xB4, 0x00, 0x3C, 0x0F, 0x00, 0x07, 0x81, 0xF9, 0x00, 0xB0, 0x1F, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x03, 0xF4, 0x3C, 0x00, 0x0B, 0xC0,
-    0x2C, 0x00, 0x1F, 0x00, 0x2C, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0xBD, 0x00,
-    0xB8, 0x00, 0xFE, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x03, 0xEF, 0xFF, 0x80, 0x07, 0xC7, 0xFD,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x78, 0x0E, 0x03, 0x80, 0x00,
-    0x1C, 0x00, 0x00, 0xA0, 0x00, 0x03, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x3C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFE, 0x55, 0x40, 0x2E, 0x00, 0xF0, 0x00, 0x02, 0xE0, 0x01, 0xE0, 0x00, 0x0F,
-    0x00, 0x07, 0x40, 0x00, 0x78, 0x00, 0x2D, 0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x0B, 0x40, 0x07,
-    0x80, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-    0x00, 0xBF, 0x80, 0x00, 0x00, 0x6A, 0xAA, 0xA7, 0xFF, 0xFF, 0xE0, 0x0B, 0x40, 0x00, 0x3C, 0x00,
-    0x01, 0xE0, 0x00, 0x0B, 0x00, 0x00, 0x3C, 0x00, 0x02, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0x7E, 0x40,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x1C, 0x02, 0xC0, 0xB0, 0x07, 0x03, 0x80,
-    0x1C, 0x0E, 0x00, 0x70, 0x74, 0x02, 0xC1, 0xC0, 0x0F, 0x0B, 0x00, 0x78, 0x3D, 0x03, 0xD0, 0xFF,
-    0xFF, 0x02, 0xFF, 0xF4, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
-    0x02, 0xC0, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0xFB,
-    0x0B, 0xF0, 0x00, 0x3F, 0x4B, 0x03, 0xF4, 0x00, 0xBD, 0x0A, 0x01, 0xF8, 0x01, 0xF8, 0x0D, 0x00,
-    0xF8, 0x03, 0xF0, 0x0D, 0x00, 0xF8, 0x07, 0xD0, 0x1C, 0x00, 0xF4, 0x0B, 0xC0, 0x2C, 0x00, 0xF4,
-    0x0F, 0x80, 0x38, 0x02, 0xF0, 0x0F, 0x80, 0x34, 0x03, 0xE0, 0x0F, 0x80, 0x30, 0x0B, 0xD0, 0x0F,
-    0xC0, 0x70, 0x2F, 0xC0, 0x0F, 0xF9, 0xFA, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x0B, 0xFF,
-    0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x80,
-    0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x03, 0xF4, 0x00, 0x78, 0x00, 0x3F, 0xD0, 0x1E, 0x00, 0x00, 0x7F, 0x07, 0xC0, 0x00, 0x01,
-    0xF1, 0xF0, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x03, 0xF2,
-    0xF0, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0x3F, 0x01, 0xFF, 0xC0, 0x0F, 0xC0, 0x0F, 0xFC, 0x03,
-    0xF4, 0x00, 0x7F, 0x80, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0B, 0x00, 0x02, 0x0E, 0x04,
-    0x07, 0x0D, 0x0E, 0x0B, 0x0D, 0x0E, 0x0E, 0x1C, 0x0E, 0x0E, 0x2C, 0x0E, 0x1D, 0x28, 0x0D, 0x2C,
-    0x38, 0x1D, 0x2D, 0x34, 0x3C, 0x2F, 0x75, 0xFC, 0x2F, 0xFF, 0xF0, 0x1F, 0xFF, 0xD0, 0x07, 0xFE,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x0F, 0x40, 0x03, 0x80, 0xB4, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x3C, 0x3C,
-    0x01, 0x00, 0xF1, 0xE0, 0x24, 0x03, 0x8F, 0x40, 0xC0, 0x2D, 0x3C, 0x07, 0x00, 0xF0, 0xF4, 0x3D,
-    0x1F, 0x42, 0xFF, 0xFF, 0xF8, 0x01, 0xF8, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3E, 0xF0, 0x00, 0x00,
-    0x1F, 0x3C, 0x00, 0x00, 0x0F, 0x0F, 0x40, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x07, 0xC0, 0xF4, 0x00,
-    0x03, 0xD0, 0x3E, 0x00, 0x02, 0xF0, 0x0F, 0x80, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0xF8, 0x00, 0xBC,
-    0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF4, 0x1F, 0x40, 0x00,
-    0xBD, 0x0F, 0xC0, 0x00, 0x2F, 0x8F, 0xD0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x89, 0x00,
-    0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x7C, 0x07, 0x40, 0x07,
-    0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F,
-    0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0,
-    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x00, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0x0B,
-    0x83, 0xD0, 0x00, 0x00, 0x7C, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x2F, 0x00, 0xF8,
-    0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x0B, 0xC0, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x01, 0xF4, 0x00, 0x0B, 0xD0, 0x0F, 0xC0, 0x00,
-    0x2F, 0x80, 0xFD, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x00,
-    0x07, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0x89, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0x80, 0xBC, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00,
-    0x7C, 0x07, 0x40, 0x07, 0x80, 0xB0, 0x00, 0xF8, 0x0F, 0x00, 0x2F, 0x40, 0xF8, 0x1F, 0xF0, 0x0F,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFE, 0xF0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xCB, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x00, 0x01, 0xF0,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x01, 0xF0,
-    0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x38, 0x00,
-    0x00, 0x00, 0x03, 0x40, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90,
-    0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xB8, 0x0B, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x3C,
-    0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0x00, 0x00, 0x74, 0x00, 0x78, 0x00, 0x00, 0x0B, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0xF0, 0x02, 0xF4, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x90, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
-    0x80, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x00,
-    0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0xF0,
-    0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00,
-    0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0,
-    0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00, 0xBE, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x00,
-    0x0F, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xBE, 0x00, 0x00, 0x07, 0x4F, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x90, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0x80, 0xBC, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0,
-    0x1D, 0x00, 0x1E, 0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0, 0x0B, 0xD0, 0x0F, 0x81, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0xF0, 0x00, 0x7F, 0x97, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40,
-    0x00, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xCB, 0x40, 0x00, 0x00, 0x00, 0xA0, 0x09,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x00, 0x01, 0xF0,
-    0x3D, 0x00, 0x00, 0x00, 0x3D, 0x03, 0xE0, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x01, 0xF0,
-    0x02, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC,
-    0x00, 0x02, 0xF8, 0x00, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x90, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0xE2, 0xD0, 0x00, 0x0A, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0x40,
-    0x02, 0xFF, 0xFD, 0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x74,
-    0x00, 0x78, 0x02, 0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x90, 0x00, 0x00,
-    0xB7, 0x0C, 0x00, 0x00, 0x0C, 0x26, 0xC0, 0x00, 0x01, 0xC0, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0B,
-    0x1D, 0x00, 0x00, 0x01, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x01, 0xF3,
-    0xC0, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00,
-    0x3D, 0x03, 0xE0, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x01, 0xF0, 0x02, 0xF0, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x0B, 0xFA, 0xAB, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x07, 0xD0,
-    0x00, 0x2F, 0x40, 0xFC, 0x00, 0x02, 0xF8, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x18, 0x00, 0x28, 0xE7, 0x40, 0x03, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xD7, 0x80, 0x00, 0x34, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xF8, 0x90, 0x02, 0xFF, 0xFD, 0x00, 0xB8, 0x0B, 0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x07,
-    0xC0, 0x74, 0x00, 0x78, 0x0B, 0x00, 0x0F, 0x80, 0xF0, 0x02, 0xF4, 0x0F, 0x81, 0xFF, 0x00, 0xFF,
-    0xFF, 0xF0, 0x07, 0xFF, 0xEF, 0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x00, 0x00, 0x02, 0x80, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-    0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x7C, 0xF0, 0x00, 0x00, 0x03, 0xC3, 0xD0, 0x00, 0x00, 0x2E,
-    0x0F, 0x40, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x00, 0xBC, 0x03, 0xE0,
-    0x00, 0x07, 0xC0, 0x0B, 0xC0, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x02, 0xFE, 0xAA, 0xFC, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x3F, 0x00, 0x00,
-    0xBE, 0x03, 0xF4, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0B, 0x5D, 0x00, 0x01, 0xC0, 0x28, 0x00, 0x06, 0xF8, 0x90, 0x02, 0xFF, 0xFD, 0x00, 0xB8, 0x0B,
-    0xC0, 0x1E, 0x00, 0x3C, 0x03, 0xC0, 0x07, 0xC0, 0x74, 0x00, 0x78, 0x0B, 0x00, 0x0F, 0x80, 0xF0,
-    0x02, 0xF4, 0x0F, 0x81, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xEF, 0x00, 0x1F, 0xE5, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x74, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0,
-    0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00,
-    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x24, 0x00, 0x2F, 0xFF, 0xD0, 0x02,
-    0xE0, 0x2F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0x40, 0x07, 0x80, 0x2C, 0x00,
-    0x3E, 0x00, 0xF0, 0x02, 0xF4, 0x03, 0xE0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xBC,
-    0x00, 0x1F, 0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x74, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00,
-    0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03,
-    0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x03, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x0B,
-    0xFF, 0x80, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8,
-    0x90, 0x00, 0xBF, 0xFF, 0x40, 0x0B, 0x80, 0xBC, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0,
-    0x1D, 0x00, 0x1E, 0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0, 0x0B, 0xD0, 0x0F, 0x81, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0xF0, 0x00, 0x7F, 0x97, 0x80, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00,
-    0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x74, 0x00, 0x00, 0x03, 0xFF,
-    0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00,
-    0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0,
-    0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40,
-    0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x02, 0x03, 0x40, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x07, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2C, 0x00, 0x1E, 0x01, 0xD0,
-    0x00, 0x3F, 0xFD, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x90, 0x00,
-    0xBF, 0xFF, 0x40, 0x0B, 0x80, 0xBC, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0xC0, 0x1D, 0x00,
-    0x1E, 0x00, 0xB0, 0x00, 0xF8, 0x03, 0xC0, 0x0B, 0xD0, 0x0F, 0x81, 0xFF, 0x00, 0x3F, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFE, 0xF0, 0x00, 0x7F, 0x97, 0x80, 0x00, 0x00, 0x00, 0xB8, 0x0C, 0x00, 0x00, 0x00,
-    0xD9, 0x18, 0x00, 0x00, 0x02, 0x87, 0x74, 0x00, 0x00, 0x03, 0x42, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C,
-    0x00, 0x00, 0x03, 0x80, 0x74, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xF0, 0x30, 0x00, 0x0E, 0x60, 0xC0,
-    0x00, 0x70, 0xDA, 0x00, 0x02, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x0C, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x2F,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0x40, 0x02, 0xFF, 0xFD,
-    0x00, 0x2E, 0x02, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0x74, 0x00, 0x78, 0x02,
-    0xC0, 0x03, 0xE0, 0x0F, 0x00, 0x2F, 0x40, 0x3E, 0x07, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF,
-    0xFB, 0xC0, 0x01, 0xFE, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C,
-    0x00, 0x00, 0x03, 0x80, 0x74, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xBC, 0x00, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x00, 0xB8, 0x3D,
-    0x00, 0x00, 0x01, 0xF0, 0x3D, 0x00, 0x00, 0x03, 0xD0, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x3E, 0x00,
-    0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xAA, 0xBF, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x07, 0xD0, 0x00, 0x2F, 0x40, 0x0F, 0xC0,
-    0x00, 0x2F, 0x80, 0x3F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0xC0, 0x00, 0xF0, 0x1E, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBE, 0x24, 0x00, 0x2F, 0xFF, 0xD0, 0x02, 0xE0, 0x2F,
-    0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0x40, 0x07, 0x80, 0x2C, 0x00, 0x3E, 0x00,
-    0xF0, 0x02, 0xF4, 0x03, 0xE0, 0x7F, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xBC, 0x00, 0x1F,
-    0xE5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-    0x7F, 0xFF, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x02, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF,
-    0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07,
-    0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B, 0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE,
-    0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F,
-    0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00,
-    0x07, 0xFF, 0xFF, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0,
-    0x00, 0x00, 0x03, 0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F,
-    0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xB9, 0x0B, 0x00, 0x2D, 0x00, 0x34, 0x07, 0x80,
-    0x5B, 0x40, 0xFF, 0xFF, 0xF8, 0x1F, 0xEA, 0x95, 0x02, 0xD0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x02,
-    0xF4, 0x00, 0x40, 0x1F, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0x80, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xD0, 0x00, 0x03, 0x8C, 0x70, 0x00, 0x01, 0xC1, 0xF4, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x54,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x95, 0xA0, 0x00, 0x03, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0x80, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
-    0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xE0, 0x70, 0x00, 0x72, 0x8D,
-    0x00, 0x0E, 0x0F, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0x90, 0xB0, 0x02, 0xD0, 0x03, 0x40,
-    0x78, 0x05, 0xB4, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0xA9, 0x50, 0x2D, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x2F, 0x40, 0x04, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x1B, 0xF9, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x38, 0xB4, 0x00, 0x00, 0x28, 0x02, 0x80, 0x00, 0x00, 0x05, 0x50, 0x00, 0x3F,
-    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01,
-    0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x56, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x02, 0xFF, 0xFF,
-    0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x40, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x40, 0x02, 0xD0, 0x00, 0x03, 0xF4, 0x00, 0x00,
-    0x00, 0x02, 0xD7, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0x90, 0xB0, 0x00, 0x00,
-    0x0B, 0x40, 0x0D, 0x00, 0x00, 0x07, 0x80, 0x5B, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x01,
-    0xFE, 0xA9, 0x50, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xD0, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x00, 0x01,
-    0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x03, 0x8B, 0x40, 0x00, 0x02, 0x80, 0x28, 0x00, 0x00, 0x00, 0x55, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE5, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-    0x80, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0xFE, 0xAA, 0xA0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x0F,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x1B, 0x40, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0B, 0x5E, 0x00, 0x01, 0xC0, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0B, 0x90, 0xB0, 0x02, 0xD0,
-    0x03, 0x40, 0x78, 0x05, 0xB4, 0x0F, 0xFF, 0xFF, 0x81, 0xFE, 0xA9, 0x50, 0x2D, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x01, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x11, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x38, 0xB4, 0x00, 0x00, 0x28, 0x02, 0x80, 0x00, 0x00, 0x05, 0x50,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x56, 0x80, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C,
-    0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x02,
-    0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0xA0,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x60, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0xF2, 0xD0, 0x00, 0x0A, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xE4, 0x2C, 0x00, 0x2D, 0x00, 0x34,
-    0x01, 0xE0, 0x16, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xAA, 0x54, 0x02, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x6F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x43, 0x40, 0x00, 0x0E, 0x31, 0xC0, 0x00,
-    0x07, 0x07, 0xD0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xB1, 0xD0, 0x00, 0x00, 0xB0, 0x0A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x54, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x02, 0xE0,
-    0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F,
-    0x95, 0xA0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xFA, 0xAA, 0x80,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF0, 0x70, 0x01, 0xCA, 0x34, 0x00, 0xD0, 0xFC, 0x00, 0x10, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1D, 0x78, 0x00, 0x0D, 0x01, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x07, 0xFF, 0x00, 0x0B, 0x90, 0xB0, 0x0B,
-    0x40, 0x0D, 0x07, 0x80, 0x5B, 0x43, 0xFF, 0xFF, 0xE1, 0xFE, 0xA9, 0x50, 0xB4, 0x00, 0x00, 0x3D,
-    0x00, 0x00, 0x0B, 0xD0, 0x01, 0x01, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xE0, 0x01, 0xBF, 0x90, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE2,
-    0xD0, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-    0xFF, 0xF8, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x00, 0xF9, 0x5A, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-    0x0F, 0x80, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x00, 0x3F, 0xAA, 0xA8, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xD0, 0x03, 0xFF, 0xFF,
-    0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x0E, 0x2C, 0x00, 0x00, 0xD0, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x02, 0xE4, 0x2C, 0x00, 0x2D, 0x00, 0x34,
-    0x01, 0xE0, 0x16, 0xD0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xAA, 0x54, 0x02, 0xD0, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x2F, 0x40, 0x04, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x6F,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x03, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x00, 0x01, 0x0D, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01,
-    0xF4, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0,
-    0x00, 0x1F, 0xC0, 0x00, 0x2F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0D, 0x00,
-    0x07, 0x40, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xB0,
-    0x00, 0x0E, 0x00, 0x00, 0xD0, 0x00, 0x2C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x0B, 0x40, 0x00,
-    0xF4, 0x00, 0x0F, 0x00, 0x02, 0xF0, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x7D, 0x00,
-    0x0B, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF4, 0x00, 0x2F, 0x00, 0x03, 0xF0, 0x00, 0x3E,
-    0x00, 0x07, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x2F, 0x80, 0x03, 0xF4, 0x00,
-    0x7F, 0x00, 0x0B, 0xF0, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x00, 0x03, 0xF0,
-    0x00, 0x7F, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0xBC, 0x00, 0x0F, 0xC0, 0x00, 0x54, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x40, 0x00, 0xB0, 0x00,
-    0x0F, 0x00, 0x00, 0xE0, 0x00, 0x2D, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x0B, 0xC0, 0x00, 0xB8,
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0xFE, 0x40, 0xBF, 0x00, 0x00, 0xFE,
-    0x00, 0x0F, 0xD0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-    0x00, 0x0F, 0x80, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x03, 0xE0, 0x00,
-    0x00, 0xBC, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x0F, 0xC0, 0x00,
-    0x2F, 0xC0, 0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00,
-    0x0B, 0xFF, 0xE0, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0, 0x00,
-    0xB4, 0x2D, 0x00, 0x0F, 0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80, 0x0F,
-    0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x03,
-    0xF9, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03, 0xF4, 0x00, 0x07, 0xE0, 0x01, 0xF8,
-    0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x2F, 0x00,
-    0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00,
-    0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xFA, 0x5A, 0xFF, 0x40, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x6F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x0B, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E,
-    0x00, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0,
-    0x2D, 0x00, 0x1E, 0x02, 0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF2, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0xB0, 0x00, 0x3F,
-    0x90, 0x2F, 0xC0, 0x70, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x38, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x3C,
-    0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x1D, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xD0, 0x02, 0xD0, 0x00, 0x0B, 0x1E,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x2E, 0x00, 0xF0,
-    0x00, 0x00, 0x2E, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x40, 0x00, 0x07, 0x80, 0x02, 0xD0,
-    0x00, 0x02, 0xD0, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x78, 0x00, 0x00, 0x2F, 0x00, 0xBD, 0x00,
-    0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xB4, 0x00, 0x00, 0x00, 0x28, 0x02, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40,
-    0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80,
-    0x07, 0xE0, 0x00, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00,
-    0xBC, 0x00, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x03,
-    0xE0, 0x00, 0x02, 0xF4, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x0B, 0x1E, 0x00, 0x01, 0xC0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8,
-    0x00, 0x0B, 0xFF, 0xE0, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0,
-    0x00, 0xB4, 0x2D, 0x00, 0x0F, 0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xE0, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x11, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x2F,
-    0xC0, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x00, 0x00, 0x10, 0xD0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x90, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xE2, 0xC0,
-    0x00, 0x0A, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x2E, 0x00, 0xF0, 0x02, 0xE0,
-    0x01, 0xE0, 0x0F, 0x00, 0x07, 0x40, 0x78, 0x00, 0x2D, 0x02, 0xD0, 0x00, 0xF0, 0x0B, 0x40, 0x07,
-    0x80, 0x2F, 0x00, 0xBD, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xBF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x90, 0x00, 0x00, 0x03, 0x8C, 0x30, 0x00,
-    0x00, 0x01, 0xC1, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x2C, 0x74, 0x00, 0x00,
-    0x00, 0x2C, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00,
-    0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF9, 0x02, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x40, 0x03,
-    0xF4, 0x00, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x3D,
-    0x00, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x0F, 0x80, 0x00, 0x02, 0xF0, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x0F, 0xFA,
-    0x5A, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0x41, 0x80, 0x01, 0xCC, 0x24, 0x00, 0x34, 0xA7, 0x00, 0x02, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x01, 0xD7, 0x80, 0x00, 0x30, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF8, 0x00, 0x0B, 0xFF, 0xE0, 0x02,
-    0xE0, 0x0F, 0x00, 0xB8, 0x00, 0x78, 0x0F, 0x00, 0x07, 0x41, 0xE0, 0x00, 0xB4, 0x2D, 0x00, 0x0F,
-    0x02, 0xD0, 0x01, 0xE0, 0x2F, 0x00, 0xBD, 0x01, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x2F,
-    0xE0, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF2,
-    0xD0, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0x80, 0x00, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x2F, 0xC0, 0x00, 0x3F, 0x80, 0x03,
-    0xF4, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0x00, 0x3D, 0x00, 0xF8, 0x00, 0x00, 0x2F,
-    0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0x0B, 0xF0,
-    0x00, 0xFF, 0xA5, 0xAF, 0xF4, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1D, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0xB1, 0xE0, 0x00, 0x1C, 0x02, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x80, 0x00, 0xBF, 0xFE, 0x00, 0x2E, 0x00, 0xF0, 0x0B, 0x80,
-    0x07, 0x80, 0xF0, 0x00, 0x74, 0x1E, 0x00, 0x0B, 0x42, 0xD0, 0x00, 0xF0, 0x2D, 0x00, 0x1E, 0x02,
-    0xF0, 0x0B, 0xD0, 0x1F, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x0B, 0xFF, 0x80,
-    0x00, 0xA0, 0x00, 0x2F, 0xFF, 0xFD, 0x00, 0x74, 0x00, 0x3F, 0x90, 0x2F, 0xC0, 0x78, 0x00, 0x3F,
-    0x80, 0x03, 0xF4, 0x38, 0x00, 0x3F, 0x40, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x80,
-    0x00, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x0F, 0x80, 0x00, 0x0B, 0xD0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0xFF, 0xA5, 0xAF,
-    0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1B, 0xF8, 0x0C, 0x00, 0xBF,
-    0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x1E, 0x00,
-    0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0A, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x07, 0x40, 0x03, 0xF9, 0x02, 0xFC, 0x07, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x43, 0x80, 0x03,
-    0xF4, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xFA, 0x5A, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
-    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1B, 0xF8,
-    0x0C, 0x00, 0xBF, 0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07,
-    0x80, 0x1E, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x2F, 0xFE, 0x00, 0x02, 0x80, 0x00, 0xBF, 0xFF, 0xF4, 0x01, 0xD0, 0x00, 0xFE, 0x40, 0xBF,
-    0x01, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xD0, 0xE0, 0x00, 0xFD, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xD0,
-    0x00, 0x0B, 0xC0, 0x00, 0x00, 0xF4, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0xC0, 0x00,
-    0x03, 0xFE, 0x96, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1B, 0xF8, 0x0C, 0x00, 0xBF,
-    0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x1E, 0x00,
-    0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0x74, 0xA0, 0x00, 0x00, 0x00, 0x02, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00,
-    0xD0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x0A, 0x00, 0x02, 0xFF, 0xFF,
-    0xD0, 0x07, 0x40, 0x03, 0xF9, 0x02, 0xFC, 0x07, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x43, 0x80, 0x03,
-    0xF4, 0x00, 0x07, 0xE0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80,
-    0x00, 0x02, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x0F, 0xFA, 0x5A, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xD0,
-    0x60, 0x00, 0x07, 0x30, 0x90, 0x00, 0x0D, 0x29, 0xC0, 0x00, 0x08, 0x0F, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1B, 0xF8,
-    0x0C, 0x00, 0xBF, 0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0, 0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07,
-    0x80, 0x1E, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00, 0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x28,
-    0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x1D, 0x00, 0x0F, 0xE4, 0x0B, 0xF0, 0x1E, 0x00, 0x0F, 0xE0, 0x00,
-    0xFD, 0x0E, 0x00, 0x0F, 0xD0, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F,
-    0x40, 0x00, 0x3E, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x02, 0xF4, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x3F, 0xE9, 0x6B, 0xFD, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x1B, 0xF8, 0x0C, 0x00, 0xBF, 0xFF, 0x28, 0x02, 0xE0, 0x0F, 0xF0,
-    0x0B, 0x80, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x1E, 0x00, 0x0B, 0x40, 0x2D, 0x00, 0x0F, 0x00,
-    0x2D, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0xBD, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-    0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00,
-    0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00, 0x7F, 0x00, 0x3F,
-    0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x01,
-    0xFC, 0x00, 0xFC, 0x00, 0x07, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x00, 0xFC, 0x00,
-    0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-    0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x03, 0xC0, 0x07, 0xC1, 0xF0, 0x02, 0xE0, 0x78, 0x00, 0xF4, 0x2D, 0x00, 0x3C, 0x0F,
-    0x00, 0x1F, 0x03, 0xC0, 0x0B, 0x81, 0xF0, 0x03, 0xD0, 0x78, 0x02, 0xF0, 0x2F, 0xEF, 0xFC, 0x0B,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xE3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA8, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x02, 0xA4, 0x02, 0xF8, 0x00, 0x0F, 0xD0, 0x0F, 0xD0, 0x00,
-    0x7F, 0x00, 0x3F, 0x00, 0x02, 0xF8, 0x01, 0xFC, 0x00, 0x0F, 0xD0, 0x0B, 0xD0, 0x00, 0x3F, 0x00,
-    0x3F, 0x00, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x07, 0xE0, 0x00, 0x2F, 0x00, 0x1F, 0x40,
-    0x00, 0xFC, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x03, 0xF0, 0x00, 0x2F, 0x00, 0x0F, 0x80, 0x00, 0xFC,
-    0x00, 0x7F, 0x00, 0x1F, 0xD0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB9, 0x00, 0x00, 0x02, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0x07, 0xC0, 0x0B, 0x81, 0xE0, 0x03, 0xD0, 0xB4,
-    0x00, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00, 0x2E, 0x07, 0xC0, 0x0F, 0x41, 0xE0, 0x0B, 0xC0, 0xBF,
-    0xBF, 0xF0, 0x2F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0xD0, 0x0B, 0xE0,
-    0x00, 0x3F, 0x5C, 0x00, 0xFD, 0x00, 0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x01, 0xF8,
-    0x00, 0x0F, 0xD0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-    0x00, 0x02, 0xF4, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0B,
-    0xC0, 0x00, 0x7D, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x01,
-    0xFC, 0x00, 0x7F, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B, 0xF4, 0x07, 0x80, 0x0F, 0xD0, 0x0B, 0x40, 0x0F,
-    0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0xBC,
-    0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0xF4,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xF0, 0x00, 0x3F, 0x89, 0x00, 0xBE, 0x00,
-    0x03, 0xF5, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80,
-    0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0,
-    0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xBC,
-    0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0xC0, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0B, 0x40, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B, 0xF4,
-    0x07, 0x80, 0x0F, 0xD0, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00,
-    0x1F, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
-    0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0xD0, 0x0B, 0xE0, 0x00, 0x3F, 0x5C, 0x00,
-    0xFD, 0x00, 0x07, 0xFF, 0x40, 0x0F, 0xC0, 0x00, 0xBE, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xD0, 0x00,
-    0x2F, 0x40, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x02, 0xF4, 0x00,
-    0x07, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00,
-    0x00, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0x40,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB9,
-    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B,
-    0xF4, 0x07, 0x80, 0x0F, 0xD0, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E,
-    0x00, 0x1F, 0x00, 0x3D, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC,
-    0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0x41, 0x80, 0x00, 0x00,
-    0x01, 0xCC, 0x24, 0x00, 0x00, 0x00, 0x34, 0xA7, 0x00, 0x00, 0x00, 0x03, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x3F, 0x8D, 0x00, 0xBE, 0x00, 0x03, 0xF5, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0xF4,
-    0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x03, 0xF0,
-    0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xBC,
-    0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0x80,
-    0x00, 0x2C, 0xD3, 0x40, 0x00, 0x34, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B, 0xF4, 0x07, 0x80, 0x0F, 0xD0,
-    0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00, 0x3D, 0x00,
-    0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
-    0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xF0, 0x00, 0x3F, 0x89, 0x00,
-    0xBE, 0x00, 0x03, 0xF5, 0xC0, 0x0F, 0xD0, 0x00, 0x7F, 0xF4, 0x00, 0xFC, 0x00, 0x0B, 0xE0, 0x00,
-    0x1F, 0x80, 0x00, 0xFD, 0x00, 0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00,
-    0x00, 0xBC, 0x00, 0x07, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0xBC, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0,
-    0x00, 0x1F, 0xC0, 0x07, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x03, 0xC0, 0x07, 0xDC, 0x07, 0xC0, 0x0B, 0xF4, 0x07, 0x80,
-    0x0F, 0xD0, 0x0B, 0x40, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x2E, 0x00, 0x1F, 0x00,
-    0x3D, 0x00, 0x1E, 0x00, 0xBC, 0x00, 0x2F, 0xEF, 0xFC, 0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF,
-    0xF8, 0x00, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xE0,
-    0xFC, 0x00, 0x2F, 0x02, 0xF0, 0x02, 0xF4, 0x07, 0xE0, 0x1F, 0x80, 0x0F, 0xC0, 0xFC, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0xFD, 0xFD, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x02, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4,
-    0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80,
-    0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x40, 0xF8, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B,
-    0xD0, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x03, 0xF7,
-    0xF4, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00,
-    0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00,
-    0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x01, 0x40, 0x7F,
-    0xFC, 0x07, 0xC0, 0xBF, 0xE0, 0x0F, 0xC0, 0xA9, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xB9, 0x00, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0xF4, 0xF8, 0x00, 0x0F,
-    0x83, 0xF0, 0x00, 0xBC, 0x0B, 0xC0, 0x0B, 0xD0, 0x1F, 0x80, 0x7E, 0x00, 0x3F, 0x03, 0xF0, 0x00,
-    0xFC, 0x3F, 0x00, 0x03, 0xF7, 0xF4, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xA0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03,
-    0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0xC0, 0x00, 0x73, 0x0A,
-    0x00, 0x03, 0x87, 0x70, 0x00, 0x08, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x3E, 0x00, 0x03, 0xE0, 0xFC, 0x00, 0x2F, 0x02, 0xF0,
-    0x02, 0xF4, 0x07, 0xE0, 0x1F, 0x80, 0x0F, 0xC0, 0xFC, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0xFD, 0xFD,
-    0x00, 0x02, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x3F, 0x40, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x0F,
-    0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x0C, 0x00,
-    0x01, 0xD7, 0x28, 0x00, 0x02, 0x83, 0xF0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00,
-    0xB4, 0x00, 0xB4, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0x3D, 0x07, 0xC0, 0x00,
-    0x2E, 0x0F, 0x80, 0x00, 0x2F, 0x1F, 0x00, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,
-    0x2F, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00, 0xA9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x0B, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0xBF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x09, 0x00, 0x90, 0x01, 0xC0,
-    0x0C, 0x00, 0x2C, 0x02, 0xC0, 0x03, 0x80, 0x38, 0x00, 0x34, 0x03, 0x40, 0x07, 0x00, 0x70, 0x00,
-    0xA0, 0x0A, 0x00, 0x0D, 0x00, 0xD0, 0x01, 0xC0, 0x1C, 0x00, 0x2C, 0x02, 0xC0, 0x03, 0x80, 0x38,
-    0x00, 0x30, 0x03, 0x00, 0x0B, 0x00, 0xB0, 0x00, 0xE0, 0x0E, 0x00, 0x0D, 0x00, 0xD0, 0x01, 0xC0,
-    0x1C, 0x00, 0x28, 0x02, 0x80, 0x03, 0x40, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x8B, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0xFD, 0x01, 0xFC,
-    0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07, 0xE0, 0x3F, 0x01, 0xF8,
-    0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFC, 0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x7F, 0x00, 0xFD, 0x01,
-    0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xD0, 0x7F, 0x1F, 0xC0, 0x3F, 0x4F, 0xD0, 0x1F, 0xCB, 0xE0,
-    0x0F, 0xC3, 0xF0, 0x07, 0xE1, 0xF8, 0x03, 0xF4, 0xFC, 0x03, 0xF4, 0xFC, 0x0B, 0xF2, 0xF8, 0x0F,
-    0xD3, 0xF0, 0x1F, 0x87, 0xE0, 0x3F, 0x0F, 0xC0, 0x7E, 0x2F, 0x80, 0x03, 0xF4, 0x2F, 0xC0, 0xFC,
-    0x07, 0xE0, 0x3F, 0x02, 0xF8, 0x00, 0x7F, 0x1F, 0xC0, 0x3F, 0x8F, 0xE0, 0x0F, 0xC3, 0xF0, 0x0B,
-    0xD2, 0xF4, 0x03, 0xF0, 0xFC, 0x02, 0xF4, 0xBD, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07,
-    0x40, 0x00, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00,
-    0x0A, 0xBE, 0xAC, 0x3F, 0xFF, 0xFC, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xE0, 0x00, 0x01, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x40,
-    0x00, 0x0B, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x1C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x6B, 0xEA, 0x90, 0x2F, 0xFF, 0xFD, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x2E, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x2A, 0xB8, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00,
-    0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0x80, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0x0B, 0xFF,
-    0xFF, 0xF0, 0x00, 0x00, 0x34, 0x02, 0xF8, 0x0F, 0xFC, 0x3F, 0x80, 0xD0, 0x00, 0x00, 0x00, 0x05,
-    0x3E, 0x7E, 0xBE, 0x05, 0x3E, 0x7E, 0xBE, 0x05, 0x00, 0x14, 0x00, 0x50, 0xF8, 0x01, 0xF0, 0x0B,
-    0xC7, 0xE0, 0x0F, 0xC0, 0x3F, 0x2F, 0x80, 0x7F, 0x02, 0xF8, 0x00, 0x3D, 0x3C, 0x00, 0x00, 0x00,
-    0x03, 0x00, 0x05, 0x40, 0x03, 0x40, 0x08, 0x20, 0x03, 0x80, 0x02, 0x48, 0x02, 0x80, 0x01, 0x85,
-    0x02, 0xC0, 0x00, 0x77, 0x01, 0xC0, 0x00, 0x0F, 0x41, 0xD0, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
-    0x00, 0x75, 0x51, 0x40, 0x00, 0x78, 0x85, 0x10, 0x00, 0x3C, 0x55, 0x94, 0x00, 0x3C, 0x26, 0x32,
-    0x00, 0x3C, 0x07, 0x8B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x2F, 0xC0, 0xFD, 0x07,
-    0xE0, 0x3F, 0x01, 0xF8, 0x00, 0x03, 0xF4, 0xFC, 0x0B, 0xF2, 0xF8, 0x0F, 0xD3, 0xF0, 0x1F, 0x87,
-    0xE0, 0x3F, 0x0F, 0xC0, 0x7E, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0D, 0x02, 0x43, 0xD0,
-    0x78, 0x1F, 0x0F, 0x02, 0xC0, 0xB4, 0x74, 0x0E, 0x03, 0xC2, 0x80, 0x70, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x3C, 0x2C, 0x0D, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x07, 0x03, 0xC2, 0xE0,
-    0x74, 0x3C, 0x0E, 0x0B, 0x01, 0xC0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x28, 0x06,
-    0x03, 0xC0, 0xF0, 0x2E, 0x0B, 0x02, 0xD0, 0x3C, 0x0D, 0x03, 0x80, 0xB0, 0x28, 0x07, 0x00, 0xD0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7C, 0x00, 0xB7, 0xC0, 0xF0, 0x7C, 0x00, 0x04, 0x00,
-    0xD0, 0x1E, 0x03, 0xD0, 0x7C, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0xD0, 0x0B, 0x00, 0x08, 0x00, 0x10,
-    0x00, 0x38, 0x00, 0x0F, 0x00, 0x02, 0xE0, 0x00, 0x7C, 0x00, 0x3D, 0x00, 0xFC, 0x02, 0xF0, 0x02,
-    0xD0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x90, 0x00, 0x3D, 0x1A,
-    0x00, 0x00, 0x0F, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0x00, 0x3F, 0x40, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xEB, 0xFF, 0xD0, 0x00, 0x50,
-    0x00, 0x1F, 0x4F, 0xFC, 0x00, 0x0B, 0xC0, 0x00, 0xBD, 0x3F, 0xD0, 0x00, 0x3F, 0x00, 0x01, 0x57,
-    0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0xFF, 0x43, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x07, 0xFC, 0x00, 0x00, 0x02,
-    0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0xF4, 0x00, 0x07, 0xFF, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x02, 0xD0, 0x00,
-    0x0F, 0x00, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00, 0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xE0, 0x00,
-    0x0F, 0x40, 0x00, 0x7C, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x80, 0x00, 0xFD, 0x00, 0x07, 0xF4, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00,
-    0x1E, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x07, 0xFF, 0xF4, 0x01, 0xF7, 0xDF, 0xC0, 0x04, 0x78, 0x3D,
-    0x00, 0x0B, 0x43, 0xD0, 0x00, 0xF0, 0x3C, 0x00, 0x0F, 0x07, 0xC0, 0x01, 0xF0, 0xF4, 0x00, 0x2E,
-    0x3F, 0x00, 0x03, 0xDF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x34,
-    0x00, 0xC3, 0x80, 0x78, 0x2F, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x00, 0x00, 0xD5, 0x60, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0xA2, 0x20, 0x00,
-    0x00, 0x14, 0x00, 0x00, 0x24, 0x00, 0xC0, 0x08, 0xC6, 0xB3, 0x64, 0x2F, 0x90, 0x7D, 0x00, 0x7E,
-    0x06, 0xED, 0x0E, 0x9B, 0x23, 0x14, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB0, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA8,
-    0x00, 0x0A, 0xA4, 0x00, 0x1F, 0xFF, 0xD0, 0x2F, 0xFF, 0xC0, 0x0F, 0x41, 0xFC, 0x2E, 0x41, 0xF8,
-    0x01, 0x00, 0x0F, 0x41, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF4,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xBE, 0x00, 0x01, 0xFF, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFD, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x40, 0x00,
-    0x07, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x01, 0x54, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFE, 0x40, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x2C, 0x01,
-    0x00, 0x0F, 0x43, 0xC0, 0x00, 0x00, 0xF4, 0x38, 0x00, 0x00, 0x0F, 0x0B, 0x40, 0x00, 0x02, 0xE0,
-    0xF0, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x0F, 0x82, 0xE0, 0x00, 0x07, 0xE0, 0x3D, 0x00, 0x02,
-    0xF8, 0x07, 0xC0, 0x03, 0xFD, 0x00, 0xBC, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0,
-    0x00, 0xBD, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xA4, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x01, 0xF8, 0x00, 0x2F, 0x00, 0x3F, 0x40, 0x03, 0xE0, 0x07, 0xF4, 0x00,
-    0xBE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x40, 0xBD, 0x00, 0x00, 0xB1, 0x00, 0x0F, 0x80,
-    0x00, 0x38, 0x00, 0x02, 0xE0, 0x00, 0x1D, 0x00, 0x00, 0xF4, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-    0x03, 0xC0, 0x00, 0x3D, 0x00, 0x01, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0xF4, 0x00, 0x3F, 0x00, 0x00,
-    0x3C, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0xFD, 0x00, 0x00, 0x03,
-    0xD0, 0x3F, 0x00, 0x00, 0x02, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xF8, 0x0B, 0xD0, 0x00, 0x00, 0x7D,
-    0x02, 0x90, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x0B, 0xD0,
-    0x1F, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x02, 0xFC, 0x07, 0xF0, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x00, 0x3D, 0x0B, 0x00, 0x00, 0x00, 0x1F, 0x47, 0x80, 0x00, 0x00, 0x0F,
-    0xC3, 0xC0, 0x00, 0x00, 0x01, 0x51, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC1,
-    0x40, 0x00, 0x00, 0x02, 0xE3, 0xE0, 0x00, 0x00, 0x00, 0xF1, 0xF8, 0x00, 0x00, 0x00, 0xB4, 0xFD,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x60, 0x09, 0x08, 0x0C, 0x88, 0x19, 0x64, 0x24,
-    0x30, 0x28, 0xB0, 0x2F, 0xD0, 0x0A, 0x40, 0x00, 0x00, 0x0C, 0x02, 0xC0, 0x9C, 0x22, 0x8B, 0xFD,
-    0x57, 0x40, 0x70, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xA8, 0x09, 0x00, 0x0C, 0x00, 0x0F, 0xE0, 0x00,
-    0x30, 0x00, 0xB0, 0x3F, 0xD0, 0x19, 0x00, 0x01, 0xBC, 0x06, 0x00, 0x0E, 0xA0, 0x1D, 0x34, 0x28,
-    0x24, 0x28, 0x70, 0x1F, 0xD0, 0x01, 0x00, 0x00, 0x07, 0xFE, 0x00, 0xD0, 0x1C, 0x03, 0x40, 0x70,
-    0x0E, 0x02, 0xC0, 0x38, 0x00, 0x01, 0x68, 0x06, 0x0C, 0x06, 0x28, 0x03, 0xE0, 0x0C, 0x30, 0x34,
-    0x34, 0x38, 0x70, 0x1F, 0xD0, 0x02, 0xB4, 0x09, 0x0C, 0x0C, 0x0C, 0x0C, 0x2C, 0x0B, 0xF8, 0x00,
-    0x34, 0x15, 0xB0, 0x3F, 0x80, 0x00, 0x20, 0x69, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0xFE, 0x07, 0xC0,
-    0x0F, 0x40, 0x3C, 0x02, 0xF0, 0x03, 0xC0, 0x3D, 0x00, 0x7C, 0x03, 0xC0, 0x0F, 0x80, 0xBC, 0x00,
-    0xF4, 0x0F, 0xC0, 0x1F, 0x00, 0xF8, 0x02, 0xF0, 0x2F, 0x40, 0x3F, 0x03, 0xF0, 0x03, 0xE0, 0x00,
-    0x14, 0x00, 0x28, 0x30, 0x0A, 0x02, 0x41, 0xC5, 0x24, 0x28, 0xE3, 0x43, 0x8C, 0x70, 0x34, 0x0F,
-    0x07, 0x82, 0xD0, 0x3E, 0xFC, 0x03, 0xFF, 0x40, 0x1F, 0x80, 0x00, 0x00, 0x40, 0x7C, 0x02, 0x80,
-    0x34, 0x03, 0x00, 0x60, 0x0D, 0x0B, 0xFC, 0x55, 0x40, 0x06, 0xE0, 0x20, 0xA0, 0x02, 0x80, 0x0D,
-    0x00, 0xE0, 0x1E, 0x02, 0xE0, 0x1F, 0xF4, 0x55, 0x40, 0x02, 0x90, 0x00, 0x50, 0x01, 0x40, 0x04,
-    0x07, 0xD0, 0x01, 0xC0, 0x0A, 0x1F, 0xF0, 0x19, 0x00, 0x00, 0x10, 0x01, 0xC0, 0x1E, 0x01, 0xA4,
-    0x1C, 0xD0, 0xFF, 0xC0, 0x2C, 0x00, 0xE0, 0x00, 0x00, 0x2A, 0x80, 0x80, 0x07, 0xA0, 0x00, 0x90,
-    0x03, 0x42, 0xBC, 0x1F, 0x80, 0x02, 0xF8, 0x24, 0x01, 0xA9, 0x0F, 0x0C, 0x30, 0x30, 0xC2, 0x82,
-    0xFC, 0x01, 0x40, 0xBE, 0x80, 0x1C, 0x02, 0x40, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x40, 0x00,
-    0x00, 0x00, 0x50, 0x02, 0x18, 0x0C, 0x08, 0x0D, 0x34, 0x07, 0xD0, 0x28, 0x30, 0x70, 0xB0, 0x2F,
-    0x80, 0x00, 0x00, 0x01, 0xA0, 0x09, 0x28, 0x0C, 0x18, 0x18, 0x28, 0x18, 0x34, 0x0F, 0xF0, 0x00,
-    0x70, 0x3F, 0xC0, 0x15, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00,
-    0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-    0x00, 0x00, 0x1E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x2E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0E, 0x00, 0x00, 0x00,
-    0x3C, 0x2C, 0x00, 0x00, 0x00, 0x74, 0x78, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00, 0x02, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x9B, 0xA0, 0x00, 0x03, 0xFE, 0x0F, 0x00,
-    0x00, 0x0F, 0xFC, 0x1D, 0x00, 0x00, 0x3F, 0x78, 0x3C, 0x00, 0x00, 0x7D, 0xB0, 0xB4, 0x00, 0x00,
-    0xFC, 0xE0, 0xF0, 0x00, 0x01, 0xF7, 0xC2, 0xC0, 0x00, 0x03, 0xF7, 0x83, 0x80, 0x00, 0x03, 0xFF,
-    0x0B, 0x00, 0x00, 0x07, 0xFD, 0x0E, 0x00, 0x00, 0x07, 0xFD, 0x2C, 0x04, 0x00, 0x07, 0xFF, 0xFE,
-    0xBC, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0x03, 0xFF, 0xFF, 0xF0,
-    0x00, 0x0B, 0xAF, 0xFF, 0xA0, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x2C, 0x1D, 0x00, 0x00, 0x00,
-    0x38, 0x3C, 0x00, 0x00, 0x00, 0xB0, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x2F, 0xE5,
-    0x68, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x1F,
-    0x80, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x66, 0x80, 0x0F, 0xC0, 0x0F, 0xFC,
-    0x00, 0xFC, 0x00, 0xF4, 0x00, 0x1F, 0xD0, 0x1D, 0x00, 0x01, 0xFF, 0x03, 0xC1, 0x00, 0x1F, 0xFF,
-    0xBE, 0xF0, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFC, 0x00,
-    0x00, 0xBF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xBF, 0x40, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x07, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-    0x2F, 0xFF, 0xF8, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xD0,
-    0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xFD, 0x00,
-    0x00, 0x07, 0xF9, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01,
-    0x50, 0x00, 0x2F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xD0, 0x00, 0x3F,
-    0xD0, 0x02, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x7D, 0x00, 0x03, 0xEF,
-    0xC0, 0x2F, 0x00, 0x02, 0xF6, 0xF0, 0x0F, 0xC0, 0x00, 0xFC, 0xBD, 0x07, 0xD0, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xD0, 0xFC, 0x7D, 0x00, 0x07, 0xF0, 0x2F,
-    0x2F, 0x00, 0x02, 0xFC, 0x07, 0xDF, 0xC0, 0x00, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0x40, 0x3F,
-    0xF4, 0x00, 0x2F, 0xC0, 0x0F, 0xFC, 0x00, 0x0F, 0xF0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0xFF,
-    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x01, 0xF0, 0x00, 0xF0, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x5B, 0xE5, 0x57, 0xF4, 0x00, 0x7C, 0x01, 0xBD, 0x00, 0x0B, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0x1F, 0xEA, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0xD0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0E, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x2E, 0x00,
-    0x00, 0x00, 0x02, 0xC0, 0xBC, 0x00, 0x0B, 0xF8, 0x03, 0xFF, 0xF8, 0x00, 0x2E, 0xA4, 0x03, 0xFF,
-    0xE0, 0x00, 0x30, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x70, 0x00, 0x0B, 0xE6, 0xF0, 0x00, 0x78, 0x00,
-    0x0F, 0x40, 0xF0, 0x00, 0x3F, 0x40, 0x0F, 0x40, 0xF0, 0x00, 0x0B, 0xE0, 0x1F, 0x00, 0xF0, 0x00,
-    0x00, 0xF0, 0x2F, 0x01, 0xF0, 0x00, 0x40, 0xF0, 0x3E, 0x02, 0xF0, 0x02, 0xFF, 0xE0, 0x3E, 0x03,
-    0xF0, 0x07, 0xFF, 0xD0, 0x7D, 0x03, 0xF0, 0x02, 0xFF, 0x40, 0x00, 0xD0, 0x00, 0x03, 0x80, 0x1D,
-    0x00, 0x00, 0x34, 0x01, 0xD0, 0x00, 0x0B, 0x00, 0x1D, 0x00, 0x00, 0xF0, 0x01, 0xD0, 0x00, 0x0E,
-    0x00, 0x1D, 0x07, 0x02, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0xD3,
-    0xF8, 0x74, 0x00, 0x2D, 0x7F, 0x8F, 0x00, 0x02, 0xCB, 0x7C, 0xE0, 0x00, 0x2D, 0xF3, 0xDD, 0x00,
-    0x02, 0xFE, 0x3F, 0xC0, 0x00, 0x2F, 0xC3, 0xFC, 0x00, 0x02, 0xFC, 0x3F, 0x80, 0x00, 0x2F, 0x43,
-    0xF0, 0x00, 0x02, 0xF0, 0x2F, 0x00, 0x00, 0x3E, 0x02, 0xE0, 0x00, 0x00, 0x69, 0x40, 0x00, 0x00,
-    0x00, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0xAF, 0xC0, 0x1E, 0x01, 0xF0, 0x02, 0xE0, 0x2D, 0x02,
-    0xD0, 0x00, 0xF0, 0x3C, 0x03, 0xC0, 0x00, 0xE0, 0x3C, 0x03, 0xC1, 0x80, 0xE0, 0x78, 0x07, 0x82,
-    0xC1, 0xD0, 0xB0, 0x0F, 0x03, 0xC2, 0xC0, 0xF0, 0x0F, 0x03, 0x82, 0xC1, 0xE0, 0x1E, 0x07, 0x40,
-    0x02, 0xD0, 0x2D, 0x07, 0x40, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0x07, 0xC0, 0x3C, 0x03, 0xF5, 0x6F,
-    0x80, 0x24, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x06, 0xBF, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x2A, 0xFA, 0x40, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xBC,
-    0xB0, 0x00, 0x2F, 0xFF, 0x80, 0x01, 0xD0, 0x7D, 0x00, 0x0D, 0x00, 0xF0, 0x00, 0xB0, 0x07, 0x80,
-    0x03, 0x80, 0x3D, 0x00, 0x0F, 0x02, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-    0x69, 0x14, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00,
-    0x3E, 0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0x09, 0xBE, 0xA4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x16,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFA, 0x90, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x1A, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x0B, 0xFF, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x40, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF1, 0x40,
-    0x00, 0x00, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x02, 0x9F, 0xDA,
-    0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x05, 0x7F,
-    0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x01,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x01,
-    0xF0, 0x02, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x02, 0xAF,
-    0xEA, 0xAF, 0xEA, 0x40, 0x0B, 0xC0, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF,
-    0xFF, 0xD0, 0x00, 0x00, 0x7F, 0xA9, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x2F,
-    0xE6, 0xC0, 0x10, 0x07, 0xF4, 0x38, 0x00, 0x00, 0xFD, 0x03, 0x40, 0x00, 0x2F, 0x80, 0x70, 0x00,
-    0x03, 0xF0, 0x0B, 0x00, 0x00, 0x7E, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x0E, 0x00, 0x00, 0xFC, 0x00,
-    0xFF, 0xA5, 0x0F, 0xC0, 0x1F, 0xFF, 0xE0, 0xFC, 0x02, 0xC0, 0xF9, 0x1F, 0xC0, 0x38, 0x1F, 0x01,
-    0xFE, 0x03, 0x47, 0xE0, 0x0F, 0xFF, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x06, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x2A, 0xAB, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xD0, 0x01, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xFD, 0x00, 0xBF, 0xF4,
-    0x0F, 0xDC, 0x00, 0x7C, 0xB0, 0x03, 0xC3, 0x80, 0x1F, 0x0D, 0x00, 0xB8, 0x70, 0x03, 0xE2, 0xC0,
-    0x0F, 0xCE, 0x00, 0x2F, 0xFA, 0x00, 0x3F, 0xFE, 0x00, 0x2F, 0xF8, 0x00, 0x34, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x02, 0xF0,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x07, 0xFF, 0xFE, 0x00,
-    0x0E, 0x00, 0x00, 0x07, 0x00, 0x05, 0x5B, 0x54, 0x1F, 0xFF, 0xF8, 0x00, 0x2D, 0x00, 0x16, 0xF8,
-    0x00, 0x7F, 0xC0, 0x00, 0xBF, 0xD0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00,
-    0x02, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
-    0x0B, 0x00, 0x00, 0x03, 0xC1, 0x80, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0x90, 0x03, 0xFD, 0x00, 0x01,
-    0x9F, 0x0A, 0x00, 0x07, 0xFF, 0x40, 0x0B, 0xFD, 0x00, 0x0F, 0xF4, 0x03, 0x86, 0x7C, 0x07, 0xC0,
-    0x1E, 0x0B, 0xC0, 0x0B, 0xFF, 0x40, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0xDF, 0x40, 0x02, 0xF3, 0x8B, 0x40, 0x03, 0xC3, 0x47, 0x40, 0x07, 0x87, 0x07,
-    0x00, 0x0B, 0x0B, 0x0B, 0x00, 0x0F, 0x0E, 0x0E, 0x00, 0x0E, 0x0D, 0x0D, 0x00, 0x1D, 0x1C, 0x1C,
-    0x00, 0x2C, 0x2C, 0x3C, 0x00, 0x3C, 0x38, 0x38, 0x00, 0x3C, 0x34, 0x74, 0x00, 0x00, 0x00, 0xBF,
-    0xFE, 0x40, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x00, 0x7C, 0x00, 0x3C,
-    0x00, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x40, 0x0B, 0x80, 0x00, 0x7C, 0x01, 0xBD, 0x02, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0xFF, 0xA9, 0x00, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x0F, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00,
-    0x0B, 0x00, 0x1B, 0x83, 0x46, 0xFF, 0x83, 0xFF, 0xE4, 0x02, 0xF9, 0x00, 0x00, 0x7D, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0B, 0xFB, 0xC0, 0x07, 0xDB, 0x1F, 0x02,
-    0xE0, 0xF0, 0xB8, 0x34, 0x0E, 0x02, 0x40, 0x01, 0xD0, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x34, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
-    0x01, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0x80, 0xF9, 0x00, 0x70, 0x1B, 0xFE, 0x4B, 0x00,
-    0x06, 0xFF, 0xE0, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x1E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x10, 0x0F, 0x00, 0x03,
-    0xD0, 0xB0, 0x2C, 0x0B, 0x87, 0x4B, 0x80, 0x1F, 0x79, 0xF0, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0C, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x0D, 0x06, 0xF7, 0xE4, 0x0D,
-    0x03, 0xDB, 0xF8, 0x06, 0xFE, 0xB0, 0x7F, 0x90, 0x00, 0x01, 0xBF, 0x8B, 0x80, 0x00, 0x00, 0x00,
-    0xB8, 0x1E, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x80, 0x00, 0x00,
-    0x90, 0x00, 0x00, 0x0C, 0x00, 0x02, 0xFC, 0x00, 0x3F, 0xBC, 0x07, 0x8D, 0x78, 0xB0, 0x70, 0x70,
-    0x02, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x30, 0x00, 0x01, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xA0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x28, 0x00, 0xB0, 0x70,
-    0x70, 0xB4, 0xC3, 0x80, 0x3B, 0xBC, 0x00, 0x2F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x16, 0xE0, 0x6B, 0xFE, 0x90, 0xFE, 0x40, 0x00, 0xFF, 0x80, 0x00, 0xF2, 0xF8, 0x00, 0xB0, 0x2F,
-    0x40, 0xB0, 0x07, 0xF0, 0xB0, 0x00, 0x7D, 0x60, 0x00, 0x04, 0x07, 0x94, 0x00, 0x00, 0xAF, 0xFE,
-    0x40, 0x00, 0x0B, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0x1F, 0x8B, 0x00, 0x3F, 0x43, 0xC0, 0xBD, 0x00,
-    0xF0, 0xF8, 0x00, 0x3C, 0x10, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x3C, 0x00, 0x01,
-    0xD0, 0x08, 0x0F, 0x00, 0xC0, 0x74, 0x1C, 0x03, 0xC2, 0x80, 0x1D, 0x34, 0x00, 0xF3, 0x00, 0x07,
-    0xB0, 0x64, 0x3E, 0x0F, 0xFF, 0xD0, 0x05, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0x2C, 0x08, 0x00, 0xE0, 0x34, 0x0B, 0x00, 0xA0, 0x38, 0x01, 0xC2, 0xC0, 0x03, 0x0E, 0x00, 0x0D,
-    0xB0, 0x00, 0x2F, 0x80, 0x00, 0x7D, 0x16, 0x00, 0xFF, 0xFC, 0x03, 0xE9, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0xB4, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
-    0xFC, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xB0, 0xA0, 0x00, 0x00, 0xF8, 0x3D, 0x00, 0x00, 0xFD,
-    0x1F, 0xC0, 0x01, 0xF3, 0x0B, 0x3C, 0x01, 0xF0, 0xC3, 0x4B, 0x82, 0xE0, 0xA0, 0xC0, 0xF4, 0x90,
-    0x34, 0x70, 0x08, 0x00, 0x0C, 0x28, 0x00, 0x00, 0x07, 0x0D, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
-    0x00, 0xD1, 0xC0, 0x00, 0x00, 0x30, 0xA0, 0x00, 0x00, 0x18, 0x34, 0x00, 0x00, 0x09, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0x00, 0xF0, 0x2F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0xB8, 0x7F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x80, 0x00, 0x00, 0x28, 0x30, 0x00, 0x00, 0x07, 0x0D,
-    0x00, 0x00, 0x00, 0xC2, 0x80, 0x00, 0x00, 0x24, 0x70, 0x00, 0x00, 0x06, 0x0D, 0x00, 0x00, 0x00,
-    0xC3, 0x80, 0x00, 0x40, 0x30, 0x70, 0x00, 0x3C, 0x09, 0x0C, 0x0B, 0x03, 0xD1, 0x83, 0x47, 0xC0,
-    0x2E, 0x30, 0xA3, 0xC0, 0x02, 0xFD, 0x1F, 0xD0, 0x00, 0x1F, 0x83, 0xD0, 0x00, 0x00, 0xF0, 0xE0,
-    0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0xF0,
-    0x00, 0x00, 0xB0, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00, 0x2C, 0x00, 0x00, 0x03, 0xC0, 0x1D, 0x00,
-    0x00, 0x00, 0x74, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x40, 0x00, 0x00, 0x00, 0xF0, 0xF4, 0x00,
-    0x00, 0x01, 0xF4, 0x0B, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
-    0x03, 0xE0, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x0F, 0xD0, 0x00, 0x0F, 0x7E, 0x40, 0x0B, 0x4D, 0xFD, 0x0B, 0xC3, 0x0B, 0x0B, 0xF0,
-    0xC0, 0x07, 0xDC, 0x30, 0x00, 0x43, 0x0C, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x0C,
-    0x30, 0x00, 0x03, 0x0C, 0x00, 0x00, 0xC3, 0x00, 0x1F, 0x30, 0xC0, 0x02, 0xFC, 0x30, 0x00, 0x2F,
-    0x0C, 0x18, 0x02, 0xD3, 0x7F, 0x40, 0x3D, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x03, 0x80, 0x01, 0x64, 0x1C, 0x00, 0x7F, 0xF8, 0xF0, 0x07, 0xD0, 0xB7,
-    0x40, 0x3C, 0x00, 0xFC, 0x02, 0xE0, 0x03, 0xD0, 0x0F, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x00,
-    0xF4, 0x07, 0xC0, 0x03, 0xFE, 0xFD, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE4, 0x3C, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x00,
-    0x00, 0x3F, 0x90, 0x2F, 0xD0, 0x00, 0x0F, 0xE0, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xE0,
-    0x00, 0x7E, 0x00, 0x1E, 0x3E, 0x00, 0x0F, 0xC0, 0x07, 0x83, 0xE0, 0x00, 0xF4, 0x01, 0xE0, 0x3D,
-    0x00, 0x2F, 0x00, 0xB8, 0x03, 0xD0, 0x03, 0xE0, 0x2D, 0x00, 0xBC, 0x00, 0x3E, 0x0B, 0x40, 0x0F,
-    0x80, 0x03, 0xE3, 0xD0, 0x02, 0xF4, 0x00, 0x3F, 0xF0, 0x00, 0xBF, 0x00, 0x03, 0xFF, 0x56, 0xBF,
-    0xD0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xEB, 0xFF, 0xFF,
-    0x80, 0x00, 0x78, 0x1B, 0xFF, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFA,
-    0xE0, 0x00, 0x02, 0xF2, 0xF0, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x3F, 0x00,
-    0xF8, 0x00, 0xBC, 0x00, 0xFC, 0x01, 0xF4, 0x00, 0xFC, 0x03, 0xF0, 0x00, 0xBC, 0x0F, 0xC0, 0x00,
-    0xBD, 0x2F, 0x40, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFD, 0x01, 0x55, 0x55,
-    0x54, 0x2F, 0xFF, 0xFF, 0xD0, 0x0F, 0x00, 0xF4, 0x00, 0x78, 0x03, 0xC0, 0x02, 0xD0, 0x1E, 0x00,
-    0x0F, 0x00, 0xB4, 0x00, 0x3C, 0x03, 0xC0, 0x02, 0xE0, 0x0F, 0x00, 0x0F, 0x40, 0x78, 0x00, 0x3C,
-    0x02, 0xD0, 0x01, 0xE0, 0x0F, 0x00, 0x0B, 0x40, 0x3C, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0xF0, 0x0F,
-    0x40, 0x07, 0x80, 0x3C, 0x00, 0x00, 0x64, 0x02, 0x80, 0x01, 0xE0, 0x0F, 0x00, 0x03, 0xC0, 0x2D,
-    0x00, 0x0F, 0x00, 0x78, 0x00, 0x2E, 0x00, 0xF0, 0x00, 0x7C, 0x03, 0xC0, 0x00, 0xF0, 0x0B, 0x40,
-    0x02, 0xD0, 0x1E, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x3C, 0x02, 0xD0, 0x00,
-    0xB4, 0x07, 0xC0, 0x01, 0xE0, 0x0F, 0x00, 0x1B, 0xD5, 0x7E, 0x40, 0xBF, 0xFF, 0xFF, 0x40, 0x00,
-    0x15, 0x55, 0x50, 0x0B, 0xFF, 0xFD, 0x00, 0xB0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0D, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01,
-    0xD0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x55, 0x50, 0x03, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xA0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x40, 0x00,
-    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x10,
-    0x1F, 0x80, 0x00, 0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2B, 0x80, 0x2E, 0x00, 0x07, 0xFF, 0xC7, 0xFF, 0x00, 0x3E, 0x07, 0xBD, 0x0D, 0x02, 0xD0, 0x0B,
-    0xC0, 0x28, 0x0E, 0x00, 0x2D, 0x00, 0x90, 0x74, 0x00, 0xB0, 0x03, 0x01, 0xC0, 0x03, 0xD0, 0x3C,
-    0x0B, 0x40, 0x7F, 0xFF, 0xD0, 0x1F, 0xFF, 0xEF, 0xFE, 0x00, 0x3F, 0xFD, 0x2F, 0xD0, 0x00, 0x1A,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x20, 0x3F, 0x00,
-    0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x7D, 0x00, 0xFD, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x0F, 0xC0, 0x1F, 0xC0,
-    0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x01, 0x80, 0x7C, 0x3C, 0x1E, 0x02, 0xC0, 0x3F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x24, 0x0B, 0x8B, 0x01, 0xD0,
-    0x3C, 0x0F, 0x5F, 0x01, 0x90, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x01, 0xEA, 0x80, 0x0B, 0xFF, 0xFF, 0xF0, 0x06, 0x96, 0xD0, 0x00, 0x00, 0x00,
-    0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x16, 0xF9, 0xAA, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00,
-    0xB4, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x03, 0xFE, 0x40, 0x00, 0x00, 0x1B, 0xFF, 0xE4,
-    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xA5, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x5A,
-    0xBC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x1F,
-    0xD0, 0x00, 0x00, 0x1B, 0xFC, 0x00, 0x01, 0xBF, 0xFE, 0x40, 0x1B, 0xFF, 0xF4, 0x00, 0x03, 0xFF,
-    0x90, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0x80,
-    0x1A, 0xFF, 0xFF, 0xE4, 0x07, 0xEA, 0x50, 0x00, 0x00,
+static const uint8_t opendyslexic_10_italicBitmaps[29075] = {
+    0x70, 0x97, 0x0A, 0xC7, 0x0D, 0x79, 0xCA, 0x7A, 0xC9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9, 0x69,
+    0xD7, 0xAC, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0x09, 0x77, 0x19, 0xDA, 0x6E, 0x95, 0x9E,
+    0x95, 0xF5, 0x9E, 0x1E, 0x91, 0xE1, 0xEA, 0x1E, 0x1A, 0xDA, 0x1E, 0x19, 0xDA, 0x1A, 0xDA, 0x1E,
+    0x19, 0xE1, 0xE9, 0x71, 0x9C, 0x93, 0xCA, 0x76, 0xD3, 0xAC, 0x97, 0x59, 0xCA, 0x3D, 0x76, 0xAC,
+    0x92, 0x9C, 0xA7, 0x6D, 0x3D, 0x71, 0x9F, 0xFF, 0xFE, 0x3A, 0xFF, 0xFF, 0xD9, 0x79, 0xD3, 0xD7,
+    0x6A, 0xCA, 0x29, 0xD7, 0x6D, 0x3D, 0x97, 0x5A, 0xD3, 0xD7, 0x6D, 0xA2, 0xAC, 0xA7, 0x1A, 0xFF,
+    0xFF, 0xD9, 0x3F, 0xFF, 0xFE, 0x70, 0xD9, 0x2D, 0xA7, 0x5A, 0xD3, 0xD9, 0x75, 0xDA, 0x2A, 0xD7,
+    0x59, 0xD9, 0x2D, 0xA7, 0x77, 0x72, 0x77, 0x75, 0xC9, 0x0C, 0xA7, 0x49, 0xC1, 0xC9, 0x73, 0x9F,
+    0xF9, 0x7F, 0xFD, 0x7F, 0xCA, 0xD9, 0x9A, 0x6E, 0xAC, 0x1C, 0x97, 0x09, 0xD9, 0xAC, 0x1C, 0x71,
+    0xAD, 0x0A, 0xA0, 0x9C, 0x71, 0xAF, 0xA0, 0xAC, 0x72, 0xFF, 0x73, 0xAF, 0xF7, 0x2A, 0xC9, 0xFD,
+    0x97, 0x0C, 0xA0, 0xAF, 0xD7, 0x0C, 0x90, 0xCA, 0xFC, 0x96, 0x9C, 0x1F, 0xE3, 0xFF, 0xFD, 0xA2,
+    0xFF, 0xFD, 0xA2, 0xFF, 0xFD, 0x93, 0x9A, 0xFF, 0xCA, 0x97, 0x29, 0xC1, 0xC9, 0x74, 0xAC, 0x09,
+    0xC7, 0x77, 0x20, 0x76, 0xC7, 0x6C, 0x93, 0xAD, 0xA5, 0xC9, 0x3C, 0xA1, 0xC9, 0x3C, 0xA3, 0x9A,
+    0x29, 0xA2, 0xAC, 0x4C, 0x92, 0xAA, 0x1A, 0xC5, 0xC9, 0x19, 0xC1, 0x9C, 0x6F, 0xCA, 0x09, 0xC9,
+    0x7E, 0x90, 0x9C, 0xA7, 0x5F, 0xA7, 0x2D, 0x91, 0xC7, 0x1D, 0x92, 0xC9, 0x7A, 0xD3, 0xC7, 0xAC,
+    0xAC, 0x2A, 0xC6, 0xAC, 0x90, 0xFC, 0x69, 0xCA, 0x19, 0xDA, 0x7C, 0xA7, 0x50, 0x77, 0x69, 0xAE,
+    0xA7, 0x1E, 0xAA, 0xAD, 0x7D, 0x93, 0xD6, 0x9D, 0x4D, 0x69, 0xD2, 0x9D, 0xA7, 0xDA, 0x0A, 0xDA,
+    0x71, 0xFC, 0x97, 0x19, 0xEA, 0x72, 0xFD, 0x71, 0xEA, 0x09, 0xD3, 0x9A, 0x1A, 0xDA, 0x29, 0xD1,
+    0x9D, 0x1E, 0x4A, 0xCA, 0x9D, 0xA1, 0xE5, 0xAF, 0x2E, 0xA3, 0x9F, 0x3F, 0xFF, 0xC3, 0x9F, 0xFC,
+    0x90, 0xC5, 0xAF, 0xA9, 0x77, 0x70, 0x0E, 0x91, 0xEA, 0x1A, 0xDA, 0x19, 0xDA, 0x2E, 0x2E, 0x00,
+    0x70, 0x9C, 0x97, 0x9C, 0xA7, 0x0D, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD7, 0x0D, 0x70, 0x9C, 0xA7,
+    0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x71, 0xD7, 0x0A, 0xC9, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x09,
+    0xC9, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x97, 0x0D, 0x97, 0x0A,
+    0xC9, 0x70, 0xAC, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x73, 0x0C, 0x97, 0x1A, 0xC9, 0x71, 0xD7, 0x2D,
+    0x71, 0x9C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x1A,
+    0xC9, 0x70, 0x9C, 0xA7, 0x1D, 0x71, 0xD7, 0x1A, 0xC9, 0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x71, 0xD7,
+    0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xDA, 0x70, 0xD9,
+    0x74, 0x59, 0x70, 0x9C, 0x59, 0x1A, 0xC1, 0x9A, 0x0A, 0xD0, 0xC9, 0x9D, 0x29, 0xFA, 0x59, 0xE4,
+    0x9D, 0xAC, 0xAD, 0x90, 0xAC, 0xA0, 0xCA, 0x09, 0xC9, 0x19, 0x1C, 0x97, 0x9C, 0x50, 0x5A, 0x7A,
+    0xC7, 0xD7, 0xCA, 0x29, 0xAA, 0xAA, 0xCA, 0xAA, 0x9F, 0xFC, 0xA3, 0xD7, 0xCA, 0x69, 0xC9, 0x6A,
+    0xC4, 0x2E, 0x91, 0xAE, 0x2E, 0x29, 0xDA, 0x2E, 0x2A, 0xDA, 0x20, 0x71, 0xAF, 0xFA, 0xFF, 0xC9,
+    0x19, 0x90, 0xDA, 0x9D, 0xAA, 0xDA, 0x77, 0x77, 0x7A, 0x97, 0x71, 0xD7, 0x71, 0x9C, 0x97, 0x71,
+    0xD7, 0x71, 0xAC, 0x77, 0x2C, 0xA7, 0x71, 0xAC, 0x77, 0x2C, 0xA7, 0x71, 0xD7, 0x71, 0x9C, 0x97,
+    0x71, 0xD7, 0x71, 0x9C, 0x97, 0x71, 0xD7, 0x71, 0xAC, 0x97, 0x71, 0xD7, 0x71, 0xD7, 0x71, 0x9C,
+    0xA7, 0x71, 0xD7, 0x71, 0x9C, 0xA7, 0x71, 0xD7, 0x71, 0xAC, 0x97, 0x71, 0xD7, 0x71, 0xD9, 0x77,
+    0x09, 0xD7, 0x71, 0xD9, 0x77, 0x09, 0xD7, 0x71, 0xD7, 0x71, 0xAC, 0xA7, 0x71, 0xD7, 0x71, 0xAC,
+    0xA7, 0x70, 0x9C, 0x97, 0x71, 0x97, 0x72, 0x69, 0xAA, 0xA7, 0xAC, 0x91, 0xAC, 0x5A, 0xC9, 0x3C,
+    0x93, 0x9C, 0xA4, 0xCA, 0x3D, 0x5C, 0xA2, 0x9C, 0xA1, 0xC9, 0x1C, 0xA2, 0xD9, 0x0A, 0xC9, 0x09,
+    0xC9, 0x2D, 0x1D, 0x1A, 0xC9, 0x19, 0xD1, 0xAA, 0x1D, 0x2A, 0xD4, 0xAC, 0xA2, 0xAD, 0x39, 0xD9,
+    0x2E, 0x29, 0xE3, 0xAF, 0xF9, 0x3A, 0xFE, 0xA5, 0xFD, 0xA7, 0xAD, 0xA9, 0x50, 0x77, 0x09, 0xE5,
+    0xFA, 0x5A, 0x0A, 0xC9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD7, 0x0D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7,
+    0xAD, 0x4A, 0xFF, 0x1F, 0xFC, 0x1F, 0xFA, 0x00, 0x59, 0xAA, 0xAA, 0x70, 0xFE, 0xA5, 0xAC, 0xA9,
+    0x19, 0xD7, 0x4A, 0xC9, 0x73, 0xAC, 0x97, 0x3D, 0x73, 0xE7, 0x2A, 0xD7, 0x2E, 0xA7, 0x09, 0xEA,
+    0x70, 0xAE, 0xA7, 0xAF, 0x97, 0xAF, 0x70, 0x9F, 0xFC, 0x4A, 0xFF, 0xC4, 0xFF, 0xCA, 0x30, 0x49,
+    0xAF, 0xA7, 0xCA, 0xA9, 0x9A, 0xD7, 0x5C, 0x97, 0x4C, 0x97, 0x39, 0xC7, 0x39, 0xCA, 0x7A, 0xAA,
+    0xDA, 0x7A, 0xF9, 0x73, 0x9D, 0xA7, 0x39, 0xD7, 0x4D, 0x73, 0xAC, 0xA4, 0x93, 0x9A, 0xD9, 0x4F,
+    0xFA, 0x4A, 0xFE, 0xA5, 0x9A, 0xFA, 0x60, 0x77, 0x29, 0xC7, 0x9D, 0x69, 0xE5, 0x9C, 0xAC, 0xA4,
+    0x9D, 0x9C, 0x93, 0x9D, 0x0A, 0xC9, 0x29, 0xD1, 0xD2, 0x9D, 0x2D, 0x19, 0xD9, 0x99, 0xAD, 0x99,
+    0xFF, 0xDA, 0xAA, 0xAA, 0xAF, 0xA9, 0x4A, 0xD7, 0xE7, 0xE6, 0xAD, 0xA2, 0x49, 0x99, 0x99, 0x99,
+    0x95, 0xFF, 0x49, 0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x3C, 0xA7, 0x29, 0xDA, 0xA9, 0x7F, 0xF5, 0x94,
+    0xAC, 0xA7, 0x29, 0xD7, 0x2A, 0xD7, 0x2D, 0xA3, 0xC9, 0x19, 0xAE, 0x39, 0xFF, 0x93, 0xFF, 0x94,
+    0x9F, 0xCA, 0x50, 0x79, 0xAA, 0xAA, 0x6A, 0xFD, 0x5D, 0xA7, 0x1D, 0x72, 0xD7, 0x29, 0xCA, 0x09,
+    0xA9, 0x95, 0xFF, 0xA4, 0xEA, 0x19, 0xD9, 0x29, 0xDA, 0x3A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA2, 0xAC,
+    0x94, 0xAC, 0x92, 0xD9, 0x4D, 0x3A, 0xCA, 0x3D, 0xA3, 0x9E, 0xAF, 0x5F, 0xE7, 0xAE, 0xA5, 0x72,
+    0x9F, 0xFC, 0x19, 0x99, 0xAA, 0xAA, 0xD7, 0xAC, 0x97, 0xD7, 0xAC, 0xA7, 0xD7, 0xDA, 0x69, 0xD9,
+    0x6E, 0x69, 0xD9, 0x6E, 0x6A, 0xDA, 0x6E, 0x6A, 0xE6, 0xE9, 0x50, 0x69, 0xEA, 0x97, 0xD9, 0x19,
+    0xC9, 0x5D, 0x4D, 0x5C, 0xA4, 0xD4, 0x9C, 0x94, 0xCA, 0x4A, 0xC9, 0x3D, 0x94, 0x9D, 0x19, 0xDA,
+    0x6A, 0xFC, 0xA6, 0x9A, 0xFC, 0x95, 0xAD, 0x91, 0x9D, 0x93, 0xAD, 0x4A, 0xCA, 0x3D, 0x94, 0xAC,
+    0xA2, 0x9D, 0x49, 0xD9, 0x29, 0xDA, 0x2A, 0xE4, 0xFF, 0xC6, 0x9F, 0xA9, 0x40, 0x5A, 0xEA, 0x69,
+    0xDA, 0x9A, 0xD5, 0xD3, 0xAC, 0xA3, 0xD4, 0xAC, 0xA3, 0xCA, 0x4A, 0xCA, 0x2A, 0xC9, 0x4A, 0xCA,
+    0x2A, 0xC5, 0xDA, 0x2A, 0xC9, 0x39, 0xD9, 0x2A, 0xD2, 0x9E, 0x4F, 0xFC, 0x5A, 0xFD, 0xA7, 0x2D,
+    0x72, 0xAC, 0xA3, 0xAD, 0xAA, 0xF4, 0xFF, 0x94, 0xFD, 0xA5, 0x4A, 0xA9, 0x39, 0xD9, 0x3E, 0x92,
+    0x9E, 0x77, 0x77, 0x72, 0x9A, 0xA4, 0xE3, 0x9E, 0x3F, 0x20, 0x4A, 0xAA, 0x4E, 0x3A, 0xDA, 0x3E,
+    0xA7, 0x77, 0x77, 0x2E, 0x92, 0xAE, 0x3E, 0x39, 0xDA, 0x3E, 0x3A, 0xDA, 0x30, 0x72, 0xA7, 0x4A,
+    0xD9, 0x71, 0xAE, 0xA7, 0x0A, 0xEA, 0x70, 0xAF, 0x97, 0xAF, 0x97, 0x1E, 0xA7, 0x3A, 0xFA, 0x97,
+    0x19, 0xAF, 0xDA, 0x97, 0x19, 0xAF, 0xDA, 0x72, 0xAF, 0x97, 0x49, 0xAA, 0x29, 0x99, 0xAA, 0xAA,
+    0xA1, 0xFF, 0xA7, 0x77, 0x71, 0xAF, 0xEA, 0x09, 0xAA, 0xAA, 0xA9, 0x99, 0x10, 0x39, 0x97, 0x5A,
+    0xD9, 0x74, 0xF9, 0x73, 0x9F, 0x97, 0x39, 0xF9, 0x73, 0x9F, 0x97, 0x3E, 0xA7, 0x09, 0xAF, 0x94,
+    0x9A, 0xFD, 0x92, 0x9A, 0xFD, 0xA9, 0x5A, 0xEA, 0x97, 0x1C, 0xA9, 0x73, 0x77, 0x29, 0xAE, 0xA6,
+    0xFF, 0x4A, 0xC9, 0x29, 0xDA, 0x72, 0x9D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2D, 0x97, 0x1A, 0xD7,
+    0x19, 0xD7, 0x1A, 0xD9, 0x79, 0xE9, 0x7F, 0x70, 0x9D, 0xA7, 0x1A, 0xD7, 0x2E, 0x71, 0x9D, 0xA7,
+    0x19, 0xA9, 0x77, 0x70, 0x99, 0x73, 0xD9, 0x71, 0xAD, 0x97, 0x1E, 0x71, 0x75, 0x99, 0x97, 0x79,
+    0xFD, 0xA7, 0x39, 0xDA, 0x92, 0x9D, 0x71, 0x9C, 0xA7, 0xC9, 0x7A, 0xCA, 0x70, 0x9C, 0x69, 0xCA,
+    0x0A, 0xDA, 0x94, 0xC6, 0xD0, 0xAA, 0x1C, 0x93, 0x9C, 0x5A, 0xC9, 0x9A, 0x2C, 0x4A, 0xA5, 0xD0,
+    0xA2, 0x9C, 0x4C, 0x94, 0xAD, 0x0C, 0x19, 0xD3, 0xAC, 0x5E, 0x0F, 0xCA, 0x2D, 0x6E, 0x1A, 0xA9,
+    0x99, 0xAE, 0x7E, 0x95, 0x9A, 0x97, 0x0A, 0xE7, 0x72, 0xF9, 0x29, 0x9A, 0x72, 0xAF, 0xFD, 0x73,
+    0xAF, 0xFC, 0x75, 0xAF, 0xCA, 0xA7, 0x77, 0x30, 0x73, 0xDA, 0x74, 0xAE, 0x74, 0xF7, 0x3D, 0xAD,
+    0x72, 0x9D, 0x0D, 0x72, 0xD1, 0xD9, 0x70, 0xAC, 0xA1, 0xD9, 0x79, 0xD2, 0xD9, 0x7D, 0x92, 0xDA,
+    0x6A, 0xD3, 0xDA, 0x59, 0xD4, 0xAD, 0x5D, 0xA4, 0xAD, 0x4A, 0xEA, 0xAA, 0xAA, 0xE4, 0xFF, 0xF3,
+    0xFF, 0xFC, 0x91, 0x9D, 0x96, 0xAD, 0x91, 0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0x49, 0xFC, 0xAA,
+    0x96, 0xAF, 0xFA, 0x5D, 0x93, 0x9D, 0x94, 0xD5, 0xAC, 0x93, 0x9D, 0x5A, 0xC9, 0x3A, 0xCA, 0x5D,
+    0x4D, 0x93, 0x9D, 0xA3, 0x9F, 0xFC, 0x94, 0xAF, 0xFC, 0x94, 0xDA, 0x49, 0xDA, 0x3D, 0x95, 0x9D,
+    0x29, 0xD6, 0xAD, 0x2A, 0xCA, 0x6D, 0xA2, 0xD9, 0x5A, 0xDA, 0x2D, 0xA9, 0x99, 0x9A, 0xF2, 0x9F,
+    0xFE, 0xA2, 0xAF, 0xFD, 0xA3, 0xFF, 0xCA, 0x93, 0x77, 0x73, 0x9A, 0xFA, 0x70, 0x9F, 0xF7, 0xAE,
+    0xA9, 0x99, 0xAA, 0x6E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x49, 0xD9, 0x75, 0xE7, 0x59, 0xD9, 0x75,
+    0xE7, 0x6E, 0x75, 0x9E, 0x75, 0x9F, 0x95, 0x94, 0x9F, 0xDA, 0xAA, 0xAD, 0x49, 0xFF, 0xEA, 0x5F,
+    0xFE, 0x95, 0x9F, 0xFD, 0x70, 0xAF, 0xDA, 0xA7, 0x76, 0x49, 0xFC, 0xAA, 0x97, 0x1A, 0xFF, 0xC9,
+    0x7F, 0xFE, 0x96, 0xD4, 0x9F, 0x59, 0xD6, 0xAD, 0x94, 0xDA, 0x7D, 0xA4, 0xD9, 0x7E, 0x39, 0xD7,
+    0x0E, 0x3A, 0xD7, 0x0E, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x9D, 0xA2, 0x9D, 0x70, 0xE9, 0x2A, 0xD6,
+    0x9F, 0x3E, 0x99, 0x9A, 0xAA, 0xFC, 0x93, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xA4, 0xAF, 0xFE, 0x95,
+    0xFF, 0xA9, 0x70, 0x72, 0x99, 0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97,
+    0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9,
+    0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F,
+    0xFE, 0x93, 0x59, 0xAA, 0xFD, 0x95, 0xFF, 0xC6, 0xD9, 0x73, 0xAD, 0x74, 0xDA, 0x74, 0xD9, 0x73,
+    0x9D, 0xAA, 0xAA, 0xA9, 0x6F, 0xFA, 0x6F, 0xF9, 0x59, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x39, 0xDA,
+    0x73, 0xAD, 0x97, 0x3E, 0x73, 0x9E, 0x73, 0xAD, 0xA7, 0x3E, 0x97, 0x20, 0x77, 0x71, 0x9A, 0xAF,
+    0xD9, 0x59, 0xFF, 0xDA, 0x4A, 0xEA, 0x95, 0x93, 0x9E, 0x97, 0x4E, 0x75, 0xAD, 0xA7, 0x5E, 0x75,
+    0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE5, 0xEA, 0xA9, 0x91, 0xE5, 0xAF, 0xCA, 0x1E, 0x70, 0xDA, 0x90,
+    0x9E, 0x79, 0xD2, 0x9E, 0xA6, 0xDA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9A, 0xFD,
+    0xA4, 0x59, 0x97, 0x09, 0x96, 0xD9, 0x69, 0xD5, 0x9D, 0x7A, 0xD5, 0xAD, 0x7D, 0xA5, 0xDA, 0x69,
+    0xD9, 0x49, 0xD9, 0x6A, 0xD5, 0xAD, 0x7E, 0x5E, 0x7D, 0xA5, 0xE6, 0x9D, 0xA4, 0xAD, 0xA6, 0xE9,
+    0x4F, 0xFF, 0xD5, 0xFF, 0xFD, 0x49, 0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xC9, 0x4E, 0x95, 0x9E, 0x49,
+    0xE6, 0xAE, 0x4A, 0xE6, 0xEA, 0x4E, 0xA5, 0x9E, 0x93, 0x49, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE5,
+    0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE4, 0x9D, 0xA4, 0xAD, 0xA4,
+    0xE9, 0x39, 0xE4, 0xAE, 0x4A, 0xDA, 0x30, 0x77, 0x71, 0xAD, 0x97, 0x2E, 0x73, 0xE7, 0x29, 0xD9,
+    0x72, 0xAD, 0x73, 0xE7, 0x29, 0xDA, 0x72, 0xAD, 0x73, 0xE7, 0x3D, 0xA7, 0x2A, 0xD9, 0x72, 0xE7,
+    0x3D, 0xA7, 0x29, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2E, 0x71, 0x9E, 0xA6, 0x9F,
+    0xD7, 0xAF, 0xC9, 0x7F, 0xC9, 0x70, 0xAA, 0x99, 0x71, 0x6D, 0xA2, 0xAD, 0x95, 0x9D, 0x29, 0xDA,
+    0x6A, 0xD1, 0x9D, 0xA7, 0xDA, 0x1E, 0x79, 0xD1, 0xE7, 0x0A, 0xD0, 0xE7, 0x1D, 0xAA, 0xD9, 0x70,
+    0x9F, 0xC9, 0x71, 0xFC, 0xA7, 0x2F, 0xC7, 0x29, 0xFC, 0x72, 0xFE, 0x71, 0xDA, 0xAE, 0xA7, 0xAD,
+    0x90, 0xF7, 0xE1, 0xFC, 0x6D, 0xA1, 0x9F, 0xA4, 0xAD, 0x92, 0xFC, 0x93, 0xE3, 0x9F, 0xC2, 0x59,
+    0xAA, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE0, 0x99, 0x99, 0x9A,
+    0x90, 0x9F, 0xFD, 0xA0, 0xAF, 0xFD, 0x90, 0xFF, 0xE0, 0x59, 0xAA, 0xA7, 0x0A, 0xAA, 0x6F, 0x96,
+    0xF6, 0xF9, 0x5A, 0xEA, 0x59, 0xFA, 0x5F, 0xA5, 0xAF, 0xA4, 0xFC, 0x95, 0xFD, 0x3A, 0xFC, 0x59,
+    0xDA, 0xE3, 0xEA, 0xD5, 0xAD, 0x9E, 0x2E, 0x9E, 0x5D, 0xA0, 0xE9, 0x09, 0xDA, 0x9D, 0xA4, 0x9D,
+    0x90, 0xE9, 0x0E, 0x0A, 0xD9, 0x4A, 0xD1, 0xEA, 0xE9, 0x0E, 0x5E, 0x1F, 0xDA, 0x09, 0xE4, 0x9E,
+    0x1A, 0xFC, 0x1F, 0x4A, 0xDA, 0x19, 0xF9, 0x1E, 0xA4, 0xE9, 0x19, 0xF1, 0x9E, 0x93, 0x9E, 0x3E,
+    0x2F, 0x93, 0xAE, 0x3A, 0xA9, 0x2F, 0x4F, 0x70, 0x9F, 0x30, 0x77, 0x09, 0xAA, 0x69, 0xE6, 0xE6,
+    0xAE, 0x6D, 0x96, 0xF5, 0xAD, 0x69, 0xF9, 0x4E, 0x6A, 0xFA, 0x4D, 0xA6, 0xDA, 0xE3, 0xAD, 0x69,
+    0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D, 0xA6, 0xE0, 0x9D, 0x91, 0xAD, 0x69, 0xDA, 0x1D, 0xA1,
+    0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E, 0x2A, 0xD0, 0xAD, 0x95, 0xAE, 0x2A, 0xD9, 0xE6, 0xEA, 0x29,
+    0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A, 0xE4, 0xFC, 0x6F, 0x4A, 0xEA, 0x50, 0x70, 0xAF, 0xCA, 0x73,
+    0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70,
+    0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA,
+    0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC,
+    0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x5A, 0xFD, 0xA9, 0x7F,
+    0xFC, 0x96, 0xD4, 0xAD, 0x59, 0xD5, 0xD5, 0xDA, 0x5D, 0x5D, 0x94, 0xAC, 0xA4, 0x9D, 0x39, 0xAD,
+    0x94, 0xAF, 0xFC, 0xA5, 0xFF, 0xC9, 0x59, 0xEA, 0xAA, 0x97, 0x0A, 0xD7, 0x5E, 0x74, 0x9D, 0xA7,
+    0x4A, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xEA, 0x73, 0x70, 0x9A, 0xF9, 0x72, 0x9F,
+    0xFC, 0x70, 0xAE, 0x92, 0x9E, 0x6A, 0xDA, 0x59, 0xD9, 0x49, 0xD9, 0x7D, 0xA4, 0xDA, 0x70, 0xDA,
+    0x3A, 0xD7, 0x1D, 0xA3, 0xDA, 0x71, 0xDA, 0x29, 0xD7, 0x2D, 0x92, 0xAD, 0x71, 0x9D, 0x3D, 0xA7,
+    0x1A, 0xD3, 0xDA, 0x71, 0xD9, 0x3D, 0xA4, 0xA2, 0xE4, 0xE9, 0x2F, 0xE9, 0x4F, 0xFF, 0xCA, 0x5F,
+    0xFF, 0xC7, 0xFF, 0xE7, 0x1A, 0xAF, 0xF7, 0x6A, 0xFA, 0x76, 0xFC, 0x97, 0x59, 0xAA, 0xAA, 0xA3,
+    0x59, 0xFC, 0xA9, 0x7A, 0xFE, 0x96, 0xCA, 0x39, 0xD5, 0x9C, 0x94, 0xD5, 0xAC, 0x5D, 0x5D, 0x5D,
+    0x49, 0xCA, 0x4D, 0xA4, 0xAC, 0x92, 0x9E, 0x94, 0xFF, 0xC9, 0x49, 0xFF, 0x6A, 0xFF, 0xA5, 0xE9,
+    0x2A, 0xD4, 0x9E, 0x39, 0xD4, 0xAD, 0xA3, 0x9D, 0x93, 0xE9, 0x3E, 0x92, 0x9E, 0x4E, 0x92, 0xAE,
+    0x39, 0xE9, 0x2E, 0xA3, 0xF9, 0x10, 0x70, 0xAF, 0xCA, 0xA7, 0xAF, 0xFA, 0x6A, 0xFA, 0xAA, 0xAA,
+    0x95, 0x9E, 0x97, 0x4A, 0xD7, 0x6D, 0x97, 0x6D, 0xA7, 0x6F, 0xCA, 0x97, 0x29, 0xFE, 0xA7, 0x29,
+    0xFE, 0x97, 0x39, 0xAF, 0x75, 0xFA, 0x74, 0xFA, 0x39, 0x94, 0x9F, 0xC9, 0x2A, 0xFF, 0xFC, 0x2A,
+    0xFF, 0xFC, 0x29, 0xFF, 0xFA, 0x49, 0xAF, 0xDA, 0xA9, 0x77, 0x70, 0x19, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1, 0xFF, 0xFD, 0xA1, 0x94, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75,
+    0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74,
+    0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0x9E, 0x72, 0x39, 0xAA, 0xA6, 0xAA, 0xA9, 0x3A, 0xDA, 0x6E,
+    0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE6, 0x9E, 0x4E,
+    0x69, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xD9, 0x4E, 0x6A, 0xD5, 0xDA,
+    0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7, 0x77,
+    0x10, 0x0A, 0xA7, 0x2A, 0xA9, 0x9D, 0x97, 0x0A, 0xD1, 0xDA, 0x70, 0xDA, 0x1D, 0xA7, 0xE2, 0xDA,
+    0x6A, 0xD9, 0x2E, 0x59, 0xE3, 0xE5, 0xE4, 0xE4, 0xAD, 0xA4, 0xE3, 0x9E, 0x5E, 0x92, 0xE9, 0x5E,
+    0x91, 0xAE, 0x6E, 0x90, 0x9E, 0x7E, 0xA0, 0xEA, 0x7A, 0xFE, 0x70, 0xAF, 0xD9, 0x70, 0xAF, 0xD7,
+    0x1A, 0xFC, 0x72, 0xAF, 0xA7, 0x10, 0x09, 0xD9, 0x76, 0xAD, 0x19, 0xD9, 0x76, 0xDA, 0x19, 0xD9,
+    0x75, 0xAD, 0x2A, 0xD9, 0x75, 0xDA, 0x2A, 0xD7, 0x5A, 0xD3, 0xAD, 0x49, 0xD9, 0x4D, 0xA3, 0xAD,
+    0x4E, 0x93, 0xE4, 0xAD, 0x3F, 0xA2, 0x9D, 0xA4, 0xE2, 0xAF, 0xC2, 0xE5, 0xE1, 0x9F, 0xD1, 0x9D,
+    0xA5, 0xE1, 0xE9, 0xE9, 0x0E, 0x6E, 0x0E, 0xA0, 0xAD, 0x99, 0xDA, 0x6E, 0xAE, 0x1A, 0xDA, 0xE7,
+    0xFD, 0x91, 0x9F, 0xCA, 0x7F, 0xCA, 0x29, 0xFC, 0x70, 0xFC, 0x39, 0xFA, 0x70, 0xF9, 0x4F, 0x71,
+    0xEA, 0x5E, 0xA7, 0x00, 0x6A, 0xA7, 0x0A, 0xA9, 0x6D, 0x96, 0xAC, 0xA7, 0xAD, 0x5A, 0xD7, 0x09,
+    0xD9, 0x3A, 0xD7, 0x2D, 0xA2, 0xAD, 0x73, 0xAD, 0x1A, 0xD7, 0x49, 0xDA, 0xAD, 0x97, 0x5F, 0xC9,
+    0x76, 0xAE, 0x97, 0x7A, 0xE7, 0x7A, 0xF9, 0x75, 0xAF, 0xD7, 0x4A, 0xE9, 0xE7, 0x3A, 0xE1, 0xEA,
+    0x71, 0xAE, 0x2A, 0xE7, 0x0A, 0xE4, 0xEA, 0x6A, 0xE9, 0x4F, 0x5A, 0xE9, 0x59, 0xE9, 0x30, 0x0D,
+    0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD, 0x4A, 0xD9, 0x29, 0xDA, 0x29, 0xDA, 0x4E,
+    0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79, 0xFC, 0x71, 0xF7, 0x2E, 0x97, 0x19, 0xE7,
+    0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71, 0x69, 0xFF, 0xFA, 0x69, 0xFF,
+    0xF9, 0x7F, 0xFF, 0x77, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x75, 0x9F, 0x97, 0x5A,
+    0xF7, 0x6A, 0xF7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xFD, 0x99, 0x99,
+    0x99, 0x99, 0x59, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xE9, 0x30, 0x70, 0x9F, 0xC7,
+    0x1A, 0xFA, 0x71, 0xD9, 0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x4D, 0x74, 0xAD, 0x74, 0xD9,
+    0x74, 0xD7, 0x49, 0xD7, 0x4D, 0xA7, 0x4D, 0x74, 0x9D, 0x74, 0xDA, 0x74, 0xD7, 0x49, 0xD7, 0x4A,
+    0xCA, 0x74, 0xD9, 0x73, 0x9D, 0x74, 0xAC, 0xA7, 0x4D, 0x97, 0x39, 0xD7, 0x4A, 0xCA, 0x74, 0xD9,
+    0x73, 0x9D, 0x74, 0xAF, 0xC7, 0x1F, 0xCA, 0x71, 0x99, 0x99, 0x97, 0x10, 0x09, 0x19, 0xA1, 0xAA,
+    0x1C, 0xA1, 0xAC, 0x1A, 0xC1, 0xAC, 0x1A, 0xC1, 0xAC, 0x1A, 0xC9, 0x0A, 0xC9, 0x0A, 0xCA, 0x09,
+    0xCA, 0x09, 0xD0, 0x9D, 0x09, 0xD0, 0x9D, 0x09, 0xC9, 0x09, 0xA5, 0x0F, 0xC7, 0x1F, 0xC9, 0x73,
+    0xAC, 0xA7, 0x39, 0xD7, 0x4D, 0x97, 0x3A, 0xCA, 0x73, 0x9D, 0x74, 0xD9, 0x73, 0xAC, 0xA7, 0x39,
+    0xD7, 0x4D, 0x97, 0x3A, 0xCA, 0x73, 0x9D, 0x74, 0xD7, 0x4D, 0xA7, 0x39, 0xD7, 0x4D, 0x74, 0xD9,
+    0x73, 0x9D, 0x74, 0xD7, 0x4D, 0x97, 0x3A, 0xD7, 0x4D, 0x74, 0xD9, 0x73, 0xAC, 0xA7, 0x39, 0xD7,
+    0x1F, 0xC9, 0x70, 0xFC, 0xA7, 0x09, 0x99, 0x99, 0x90, 0x19, 0xC9, 0x5E, 0x93, 0xAC, 0x99, 0xC9,
+    0x19, 0xC3, 0xAA, 0x71, 0x0F, 0xFF, 0xC1, 0xFF, 0xFC, 0x77, 0x9D, 0x39, 0xD3, 0xAD, 0x60, 0x77,
+    0x39, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93, 0xAC, 0xA2, 0xAD, 0x39, 0xCA, 0x4D, 0x3D, 0x49, 0xD2,
+    0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2, 0xD4, 0xAD, 0x92, 0xDA, 0x19, 0xF3, 0xFF, 0xD3, 0x9F,
+    0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA1, 0x29, 0xCA, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x71, 0xD9,
+    0x70, 0x9D, 0x71, 0xAD, 0x19, 0x99, 0x4D, 0xAA, 0xFA, 0x3F, 0xA9, 0x9A, 0xCA, 0x2E, 0x93, 0xD1,
+    0x9D, 0x94, 0xD1, 0xAD, 0x5D, 0x1D, 0xA4, 0x9D, 0x1D, 0xA4, 0xD9, 0x1E, 0x29, 0xE1, 0x9F, 0xFC,
+    0x3F, 0xF4, 0x9F, 0xCA, 0x70, 0x97, 0x77, 0x9A, 0xE9, 0x3F, 0xD9, 0x2E, 0x6A, 0xD7, 0xD7, 0x9D,
+    0x7A, 0xCA, 0x7A, 0xCA, 0x7E, 0x7A, 0xEA, 0xAA, 0x4F, 0xDA, 0x4A, 0xFA, 0x74, 0x75, 0xCA, 0x74,
+    0x9C, 0x97, 0x4D, 0x75, 0xD7, 0x49, 0xC9, 0x74, 0xD7, 0xAE, 0x90, 0xD5, 0x9F, 0xD9, 0xCA, 0x49,
+    0xD9, 0x1A, 0xE9, 0x4D, 0x4E, 0x4D, 0x5D, 0xA3, 0x9C, 0xA4, 0x9D, 0x93, 0xAC, 0x94, 0xAD, 0x4D,
+    0x93, 0x9E, 0x4E, 0xA9, 0x9A, 0xEA, 0x4A, 0xFF, 0xC9, 0x5F, 0xFC, 0x7A, 0xEA, 0x0D, 0x77, 0x40,
+    0x79, 0x70, 0x9F, 0xC5, 0xAC, 0xA9, 0x1A, 0xC3, 0xAC, 0x94, 0xC9, 0x19, 0xCA, 0x29, 0x9A, 0xC9,
+    0x1F, 0xFD, 0xA0, 0x9E, 0xAA, 0xAA, 0x99, 0x91, 0xAC, 0x97, 0x1D, 0x97, 0x1A, 0xD9, 0x49, 0x29,
+    0xFF, 0xC3, 0xAF, 0xEA, 0x49, 0xAE, 0xA9, 0x20, 0x69, 0xA9, 0x49, 0xEA, 0x4D, 0x6A, 0xC7, 0xD7,
+    0xCA, 0x5F, 0xDA, 0x19, 0xFD, 0x93, 0xD6, 0x9D, 0x6A, 0xCA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA,
+    0x6D, 0x95, 0xAD, 0x60, 0x59, 0xE9, 0x0A, 0xA5, 0xFD, 0xAD, 0x4D, 0xA1, 0xAE, 0xA3, 0xAC, 0x93,
+    0xE9, 0x3D, 0x4E, 0x39, 0xC9, 0x4E, 0x3A, 0xC4, 0x9D, 0x93, 0xAC, 0x4E, 0x4A, 0xC9, 0x99, 0x9F,
+    0x49, 0xFF, 0xA5, 0xFF, 0x7A, 0xDA, 0x9D, 0x72, 0x9D, 0x94, 0x93, 0xAE, 0x5F, 0xF5, 0xAF, 0xE9,
+    0x69, 0xFA, 0x70, 0x6C, 0xA7, 0x2A, 0xC9, 0x72, 0xD7, 0x3C, 0xA7, 0x2A, 0xC7, 0x3D, 0x73, 0xCA,
+    0x9E, 0xA5, 0xAF, 0xF4, 0xEA, 0x90, 0x9D, 0x4D, 0xA3, 0xAC, 0x3A, 0xD4, 0xAC, 0x3D, 0x94, 0xD3,
+    0xD5, 0xCA, 0x2A, 0xD4, 0x9C, 0xA2, 0xDA, 0x4D, 0x92, 0xD9, 0x4D, 0x2A, 0xD4, 0xAD, 0x2E, 0x4E,
+    0x10, 0x5D, 0x94, 0xAD, 0x5E, 0x59, 0x99, 0x77, 0x79, 0x6A, 0xC6, 0xD6, 0xC9, 0x5A, 0xC6, 0xD6,
+    0xCA, 0x5A, 0xC9, 0x5D, 0x95, 0xD5, 0xAD, 0x5A, 0xCA, 0x40, 0x71, 0x9D, 0x71, 0xE7, 0x09, 0xDA,
+    0x70, 0x99, 0x97, 0x77, 0x73, 0xAC, 0x72, 0xD7, 0x19, 0xCA, 0x71, 0xAC, 0x97, 0x1D, 0x72, 0xCA,
+    0x71, 0x9C, 0x97, 0x1A, 0xC7, 0x2D, 0x71, 0x9C, 0x97, 0x1A, 0xC7, 0x2D, 0x71, 0x9C, 0xA7, 0x1D,
+    0x70, 0x9E, 0x6F, 0xC6, 0xAE, 0xA7, 0x74, 0x59, 0xA7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9, 0x70,
+    0xD7, 0x09, 0xCA, 0x70, 0xAC, 0x90, 0x9D, 0x4D, 0x09, 0xD4, 0x9C, 0xA9, 0xD5, 0xAF, 0x6F, 0x69,
+    0xF9, 0x5A, 0xCA, 0xE5, 0xD9, 0xAE, 0x39, 0xD1, 0xEA, 0x2A, 0xD1, 0x9E, 0x91, 0xDA, 0x2F, 0x00,
+    0x4A, 0xC5, 0xD4, 0xAC, 0xA4, 0xD4, 0x9D, 0x4A, 0xCA, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xD4, 0x9D,
+    0x4A, 0xCA, 0x4D, 0x94, 0xD4, 0x9D, 0x09, 0x2A, 0xF2, 0xFC, 0x20, 0x49, 0xA0, 0x9E, 0x92, 0xAD,
+    0xA6, 0xFF, 0x99, 0xFC, 0x94, 0x9E, 0x91, 0xFC, 0x90, 0x9C, 0xA4, 0xE3, 0x9E, 0x3C, 0xA4, 0xD9,
+    0x39, 0xD4, 0xCA, 0x3A, 0xD4, 0xAC, 0xA3, 0xAC, 0x93, 0xDA, 0x4D, 0x4D, 0x39, 0xD4, 0xAD, 0x4D,
+    0x3A, 0xD4, 0xD9, 0x3A, 0xCA, 0x3D, 0x93, 0x9D, 0x4D, 0x92, 0xAD, 0x4D, 0xA3, 0x9D, 0x92, 0xDA,
+    0x39, 0xD9, 0x3A, 0xD2, 0x4A, 0x19, 0xAA, 0x95, 0xAF, 0xE9, 0x4E, 0xA1, 0x9D, 0x4D, 0x93, 0xD3,
+    0xAD, 0x4D, 0x3D, 0x93, 0x9D, 0x3D, 0x4D, 0xA2, 0xAD, 0x4D, 0x92, 0xE3, 0x9D, 0x3D, 0xA3, 0xAD,
+    0x2A, 0xD9, 0x3E, 0x2E, 0x4D, 0xA1, 0x49, 0xAE, 0xA6, 0xAF, 0xDA, 0x4A, 0xCA, 0x3D, 0x3A, 0xCA,
+    0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A, 0xC9, 0x5D, 0x2A, 0xC9, 0x49, 0xCA,
+    0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA, 0x50, 0x59, 0x91, 0xAD, 0xA7, 0x0D,
+    0x9F, 0xD7, 0xF9, 0x19, 0xC9, 0x6E, 0x4C, 0xA5, 0x9D, 0x94, 0xCA, 0x5A, 0xD5, 0xCA, 0x5E, 0x49,
+    0xC9, 0x5E, 0x4D, 0x59, 0xE9, 0x2A, 0xCA, 0x5F, 0xFD, 0x59, 0xDA, 0xFD, 0x95, 0xDA, 0x0F, 0xA6,
+    0x9D, 0x75, 0xE7, 0x5D, 0x97, 0x4A, 0xD7, 0x5D, 0x97, 0x77, 0x50, 0x77, 0x4A, 0xDA, 0x1A, 0xA4,
+    0xAF, 0xCA, 0xAC, 0xA3, 0xAC, 0xA2, 0x9E, 0x92, 0x9D, 0x4E, 0x3D, 0x49, 0xDA, 0x29, 0xCA, 0x4A,
+    0xD3, 0xAC, 0x5E, 0x3A, 0xC4, 0xAD, 0x93, 0xAC, 0x92, 0xAE, 0x49, 0xFF, 0xC5, 0xFD, 0xAC, 0xA6,
+    0xAE, 0x9A, 0xC7, 0x4D, 0x19, 0x70, 0x9D, 0xAC, 0xA7, 0x0A, 0xF7, 0x1D, 0xA9, 0x77, 0x20, 0x49,
+    0x91, 0x99, 0x39, 0xCA, 0xAE, 0x3A, 0xFD, 0x3E, 0xA6, 0xD9, 0x6A, 0xD7, 0xDA, 0x7D, 0x96, 0xAD,
+    0x7E, 0x69, 0xE6, 0xAD, 0xA5, 0x49, 0xFA, 0x93, 0xEA, 0xAA, 0xA3, 0xAC, 0x71, 0xCA, 0x71, 0xDA,
+    0x70, 0x9F, 0x96, 0x9A, 0xF7, 0x09, 0xD9, 0x29, 0x92, 0x9D, 0x91, 0xAF, 0xF1, 0x9F, 0xF9, 0x2A,
+    0xFC, 0xA9, 0x20, 0x76, 0xAC, 0x6A, 0xCA, 0x6D, 0x94, 0x99, 0xD9, 0x99, 0x1F, 0xF3, 0xD9, 0x6D,
+    0x6A, 0xD6, 0xD9, 0x6D, 0x6A, 0xD6, 0xDA, 0x6F, 0xA9, 0x29, 0xFC, 0xA2, 0x9F, 0xC9, 0x20, 0x2D,
+    0x49, 0xD1, 0x9D, 0x4A, 0xCA, 0x19, 0xCA, 0x4D, 0x91, 0xAC, 0x94, 0xD2, 0xD4, 0x9D, 0x2D, 0x4A,
+    0xCA, 0x19, 0xD4, 0xD9, 0x19, 0xCA, 0x3A, 0xD2, 0xAE, 0xAF, 0xC2, 0xAF, 0xFC, 0x29, 0xFF, 0xA3,
+    0xAE, 0xA0, 0xD9, 0x10, 0x09, 0x97, 0x99, 0x1D, 0x69, 0xCA, 0x1A, 0xC9, 0x5D, 0x29, 0xCA, 0x4D,
+    0x92, 0x9D, 0x3A, 0xCA, 0x4D, 0x29, 0xD5, 0xD9, 0x1D, 0x6A, 0xD0, 0xD9, 0x6A, 0xDA, 0xCA, 0x7A,
+    0xF7, 0x0A, 0xF7, 0x0A, 0xE9, 0x60, 0x09, 0x97, 0x29, 0x91, 0xD9, 0x70, 0xAD, 0x1D, 0x97, 0x0D,
+    0x91, 0xD9, 0x7A, 0xCA, 0x2D, 0x91, 0xAC, 0xA2, 0xD3, 0xD9, 0x0A, 0xE1, 0xAC, 0xA3, 0xD9, 0xAF,
+    0xA0, 0xD4, 0xFF, 0xEA, 0x4F, 0xFE, 0x5F, 0xA0, 0xFA, 0x5E, 0xA1, 0xF6, 0xE2, 0xAD, 0x95, 0x49,
+    0xD4, 0xD9, 0x5D, 0xA2, 0xD9, 0x6A, 0xD1, 0xD9, 0x70, 0xDA, 0xD9, 0x71, 0xF9, 0x72, 0xAD, 0xA7,
+    0x29, 0xEA, 0x71, 0x9F, 0xC7, 0x09, 0xD9, 0x9D, 0xA6, 0x9D, 0x91, 0xE5, 0xAD, 0xA2, 0xAD, 0x93,
+    0xAD, 0xA4, 0xE2, 0x3D, 0x6D, 0x4A, 0xC9, 0x4A, 0xC9, 0x49, 0xD4, 0xD6, 0xD3, 0xD9, 0x6D, 0x91,
+    0x9D, 0x7A, 0xCA, 0x1D, 0xA7, 0xAD, 0x09, 0xD7, 0x09, 0xD9, 0xDA, 0x71, 0xFC, 0x72, 0xFA, 0x72,
+    0xAE, 0x73, 0xAD, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x19, 0xF7, 0x9F, 0xD7, 0x0A, 0xFA, 0x71, 0xAA,
+    0xA9, 0x73, 0x49, 0xFF, 0x94, 0xAF, 0xF7, 0x29, 0xD9, 0x71, 0xAD, 0x97, 0x1A, 0xD7, 0x2E, 0x71,
+    0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xE9, 0x71, 0xFA, 0xAA, 0xA9, 0x49, 0xFF, 0xC4, 0xFF, 0xD9, 0x20,
+    0x70, 0x99, 0x97, 0xFC, 0x6E, 0x71, 0xD7, 0x1A, 0xD7, 0x1D, 0x97, 0x09, 0xD7, 0x1A, 0xCA, 0x79,
+    0xAD, 0x7A, 0xDA, 0x70, 0xEA, 0x71, 0x9D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71,
+    0x9D, 0x71, 0x9F, 0x97, 0xAE, 0x77, 0x30, 0x5A, 0x94, 0x9C, 0x5A, 0xC5, 0xCA, 0x5C, 0x94, 0x9C,
+    0x5A, 0xA5, 0xC9, 0x49, 0xC5, 0xAC, 0x5C, 0xA5, 0xC5, 0xAC, 0x5C, 0xA5, 0xC9, 0x49, 0xC5, 0xAA,
+    0x5C, 0x94, 0x59, 0x99, 0x7A, 0xF7, 0x09, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x0A, 0xCA, 0x70, 0xD9,
+    0x70, 0xD7, 0x09, 0xDA, 0x97, 0xAE, 0x7A, 0xD9, 0x6D, 0x97, 0xAC, 0xA7, 0x0D, 0x70, 0x9D, 0x70,
+    0xDA, 0x79, 0xD5, 0x9F, 0x95, 0xEA, 0x97, 0x72, 0x09, 0xD2, 0xC1, 0xCA, 0x9A, 0x1C, 0x09, 0xC1,
+    0xC9, 0xAA, 0x0A, 0xA1, 0x9D, 0x72, 0x72, 0xF3, 0xEA, 0x3E, 0x93, 0xE7, 0x49, 0x99, 0x39, 0xD9,
+    0x39, 0xD4, 0xAD, 0x4D, 0xA4, 0xD9, 0x4D, 0x49, 0xD4, 0xAC, 0xA4, 0xAC, 0x94, 0xD5, 0xD4, 0x9C,
+    0xA4, 0x9C, 0x94, 0xAC, 0x69, 0x50, 0x79, 0xA7, 0x0C, 0xA7, 0x0C, 0x97, 0x9C, 0x6A, 0xF9, 0x3F,
+    0xD9, 0x2D, 0xA9, 0xC4, 0xAD, 0x0A, 0xC4, 0xD1, 0xCA, 0x39, 0xD1, 0xC9, 0x3A, 0xCA, 0x09, 0xC4,
+    0xDA, 0x0C, 0xA4, 0xE0, 0xC9, 0x4A, 0xFA, 0xA4, 0xFD, 0xA4, 0xAF, 0xA5, 0xC7, 0x0A, 0xC7, 0x70,
+    0x77, 0x77, 0x72, 0x9A, 0xE9, 0x70, 0x9F, 0xEA, 0x69, 0xDA, 0x39, 0xC6, 0xAC, 0x97, 0x5D, 0x76,
+    0xD7, 0x6D, 0x76, 0xD7, 0x6A, 0xC7, 0x6A, 0xC7, 0x4F, 0xFC, 0x96, 0xFF, 0xC7, 0x1D, 0x97, 0x49,
+    0xD7, 0x39, 0xE9, 0x71, 0x9E, 0xA9, 0x72, 0xAF, 0xFD, 0xA4, 0xFF, 0xF3, 0x77, 0x0D, 0x09, 0x90,
+    0xAC, 0x92, 0xAF, 0xF9, 0x3D, 0x91, 0xD4, 0xD3, 0xAC, 0x4D, 0x3D, 0x4D, 0x90, 0x9D, 0xA3, 0xAF,
+    0xE9, 0x2F, 0xFD, 0x2D, 0x19, 0x90, 0x9C, 0x97, 0x60, 0x29, 0x97, 0x99, 0x3D, 0x95, 0xD9, 0x39,
+    0xD4, 0xD9, 0x5E, 0x19, 0xD9, 0x6A, 0xD9, 0x9D, 0x97, 0x0F, 0xC9, 0x71, 0xAE, 0x97, 0x29, 0xDA,
+    0x71, 0x9A, 0xAF, 0xC6, 0xFD, 0xAA, 0xA7, 0x1D, 0xA7, 0x39, 0xD9, 0x73, 0xAD, 0x71, 0xFF, 0xA5,
+    0x9A, 0x9A, 0xEA, 0xA9, 0x70, 0xAD, 0x74, 0xE7, 0x77, 0x10, 0x5A, 0x95, 0xC5, 0xAC, 0x5C, 0xA5,
+    0xC9, 0x49, 0xC5, 0x99, 0x77, 0x74, 0xA9, 0x5C, 0x5A, 0xC5, 0xCA, 0x5C, 0x94, 0x9C, 0x5A, 0xA5,
+    0xC9, 0x40, 0x70, 0x9E, 0xA7, 0x1A, 0xCA, 0x99, 0xAC, 0x79, 0xC4, 0x97, 0xC9, 0x75, 0xD7, 0x39,
+    0xFD, 0xA6, 0xAE, 0xAA, 0xF4, 0x9D, 0x5D, 0x93, 0xAC, 0x69, 0xC9, 0x3D, 0x6D, 0x4A, 0xEA, 0x90,
+    0x9A, 0xD5, 0xAF, 0xF7, 0x19, 0xEA, 0x73, 0xE6, 0x93, 0x9E, 0x5A, 0xFF, 0xA4, 0xAF, 0xFA, 0x6A,
+    0xAA, 0xCA, 0xA9, 0x70, 0x1D, 0x2A, 0xD0, 0xAD, 0x2D, 0xA0, 0xE1, 0x9D, 0xA0, 0x99, 0x91, 0x99,
+    0x90, 0x29, 0xAA, 0xA9, 0x3D, 0xA1, 0x92, 0xAC, 0x93, 0xA1, 0xAA, 0x4A, 0x09, 0xAA, 0x39, 0x91,
+    0xAD, 0x90, 0x9A, 0x2A, 0x91, 0xAA, 0x49, 0xAA, 0x93, 0x72, 0x9C, 0xAA, 0x2A, 0xA0, 0x9C, 0x2C,
+    0x19, 0xC1, 0xA9, 0x1A, 0xA1, 0xC9, 0x09, 0xC9, 0x1A, 0xF9, 0x2A, 0xA9, 0x20, 0x59, 0x59, 0x39,
+    0xCA, 0x39, 0xC3, 0xAC, 0xA3, 0xD9, 0x19, 0xD3, 0x9D, 0x29, 0xD3, 0xAC, 0xA3, 0xAD, 0x92, 0xE4,
+    0xE2, 0x9D, 0xA4, 0xDA, 0x2A, 0xD9, 0x39, 0xC4, 0xAC, 0x59, 0x59, 0x20, 0xAE, 0xAA, 0xA9, 0x90,
+    0xAF, 0xF9, 0x6D, 0x7D, 0x69, 0xCA, 0x6A, 0xC9, 0x00, 0x71, 0xAF, 0xFA, 0xFF, 0xC9, 0x3A, 0xAA,
+    0xA4, 0xD9, 0x1A, 0x2C, 0xA0, 0x99, 0x19, 0x09, 0x9A, 0xD2, 0x90, 0x90, 0xA0, 0xA1, 0xA1, 0x9A,
+    0x90, 0xC0, 0x99, 0x2C, 0x90, 0x9A, 0xA4, 0x9A, 0xA3, 0x79, 0xFD, 0xA7, 0x76, 0x9E, 0x94, 0xEA,
+    0xDA, 0x2D, 0x92, 0xAC, 0x19, 0xCA, 0x3A, 0xC1, 0xD9, 0x3D, 0x1D, 0x92, 0xAC, 0xA1, 0xAD, 0x99,
+    0xE2, 0x9F, 0xD9, 0x39, 0xEA, 0x30, 0x70, 0x97, 0x2D, 0x72, 0xCA, 0x71, 0xAC, 0x6F, 0xFC, 0xA5,
+    0x9C, 0xA7, 0x19, 0xC7, 0x2D, 0x72, 0xA9, 0x77, 0x70, 0x99, 0x93, 0xAF, 0xF3, 0x99, 0x71, 0x19,
+    0xAA, 0xA2, 0x91, 0xC9, 0x4C, 0x4A, 0xA3, 0xD2, 0x9C, 0xA3, 0xF2, 0x99, 0x99, 0x10, 0x2A, 0xAA,
+    0x7A, 0x59, 0xA3, 0xDA, 0x59, 0xC6, 0xC2, 0xAA, 0xAC, 0xA2, 0xEA, 0x20, 0x70, 0xCA, 0x2A, 0xC2,
+    0x9C, 0x92, 0xD2, 0x4D, 0x49, 0xD3, 0x9D, 0x4A, 0xCA, 0x39, 0xCA, 0x4D, 0x93, 0xD9, 0x4D, 0x4D,
+    0x49, 0xD3, 0xAD, 0x4A, 0xCA, 0x3E, 0x4D, 0x92, 0x9D, 0xA3, 0xAD, 0x3A, 0xFA, 0xFC, 0x3F, 0xFE,
+    0x29, 0xC9, 0xFF, 0xA2, 0xCA, 0x0A, 0xEA, 0x0D, 0x92, 0xC7, 0x49, 0xA7, 0x40, 0x59, 0xAA, 0x91,
+    0xA9, 0x4F, 0x2C, 0x93, 0xFC, 0x19, 0xC3, 0x9F, 0x91, 0xAC, 0x3A, 0xF2, 0xCA, 0x39, 0xF2, 0xC9,
+    0x4E, 0x91, 0x9C, 0x59, 0xD2, 0xAC, 0x5E, 0x2C, 0xA4, 0x9D, 0x92, 0xC9, 0x4E, 0x29, 0xC5, 0xE2,
+    0xAC, 0x4A, 0xD9, 0x2C, 0xA4, 0xE3, 0xC9, 0x3A, 0xE2, 0x9C, 0x4E, 0x92, 0xAC, 0x3A, 0xE3, 0xCA,
+    0x30, 0x19, 0x91, 0x9D, 0x1E, 0x09, 0xE0, 0x7A, 0x3A, 0xA9, 0x49, 0xA2, 0x9C, 0x90, 0xAD, 0x91,
+    0x70, 0xAC, 0x39, 0xC3, 0xA9, 0x3C, 0x4C, 0x3A, 0xA2, 0xF1, 0x99, 0x99, 0x00, 0x2A, 0xD9, 0x2A,
+    0x91, 0xC1, 0x9C, 0x2C, 0x1A, 0x92, 0xC1, 0xAA, 0x1A, 0xA1, 0x9F, 0x39, 0xA9, 0x20, 0x09, 0x49,
+    0x7C, 0xA4, 0xCA, 0x6D, 0x92, 0x9D, 0x6A, 0xCA, 0x3A, 0xC9, 0x59, 0xD3, 0xAC, 0xA4, 0xAD, 0x92,
+    0xE3, 0x9D, 0xA2, 0xAD, 0x4E, 0x29, 0xD9, 0x4A, 0xC4, 0xCA, 0x69, 0x49, 0x30, 0x77, 0x39, 0xD7,
+    0x5A, 0xAC, 0x76, 0xAA, 0x70, 0x94, 0xC9, 0x7A, 0xA3, 0x9C, 0x7A, 0xC4, 0xAC, 0x6A, 0xC5, 0xCA,
+    0x59, 0xC5, 0x9C, 0x94, 0x9C, 0x49, 0xFC, 0x91, 0x9C, 0x94, 0xFD, 0x2C, 0x92, 0x97, 0x1C, 0xA2,
+    0x9C, 0x70, 0xCA, 0x29, 0xD7, 0xD2, 0x9C, 0xAC, 0x6D, 0x29, 0xC9, 0xAA, 0x5A, 0xC2, 0x9C, 0x90,
+    0xC9, 0x4A, 0xC9, 0x2D, 0x9A, 0xCA, 0x92, 0xAC, 0x92, 0x99, 0x1E, 0x91, 0x9C, 0xA7, 0xD3, 0xAA,
+    0x79, 0xCA, 0x20, 0x29, 0xAC, 0x76, 0xCA, 0xC7, 0x7A, 0xA7, 0x9C, 0x5C, 0x97, 0xC9, 0x49, 0xC7,
+    0xC9, 0x5A, 0xC6, 0xCA, 0x6C, 0xA5, 0xAC, 0x69, 0xC9, 0x49, 0xC5, 0x9F, 0xC9, 0x19, 0xCA, 0xAE,
+    0x1F, 0xD2, 0xC9, 0xCA, 0x90, 0xAC, 0x70, 0xCA, 0x49, 0xC7, 0xD5, 0xAC, 0x6A, 0xC6, 0xCA, 0x5A,
+    0xC9, 0x5D, 0x59, 0xC9, 0x49, 0xD5, 0x9C, 0xA4, 0xE6, 0xD4, 0xE6, 0xD4, 0xFD, 0xA2, 0xD5, 0xFD,
+    0x92, 0x97, 0x70, 0x29, 0xEA, 0x74, 0x92, 0xAA, 0x77, 0x9A, 0x59, 0xC6, 0x9C, 0x59, 0xC4, 0xAE,
+    0x95, 0xC9, 0x69, 0xC5, 0xC9, 0x70, 0xCA, 0x3C, 0xA7, 0x1C, 0xA2, 0xD5, 0x92, 0xAC, 0x2A, 0xC6,
+    0xFC, 0xA1, 0xAC, 0x39, 0x19, 0xF9, 0x19, 0xC9, 0x29, 0xC7, 0x09, 0xC9, 0x29, 0xD7, 0x0C, 0xA2,
+    0x9C, 0xAC, 0x7D, 0x29, 0xC9, 0xAA, 0x6D, 0x29, 0xC9, 0x0C, 0x95, 0xD3, 0xD9, 0xAC, 0xA9, 0x3A,
+    0xC9, 0x29, 0x99, 0x9E, 0x92, 0xAC, 0xA7, 0xD4, 0xAA, 0x79, 0xCA, 0x20, 0x71, 0xE9, 0x71, 0xE7,
+    0x2D, 0x97, 0x29, 0x97, 0x77, 0x09, 0x99, 0x71, 0x9D, 0xA7, 0x1A, 0xD9, 0x71, 0xE7, 0x19, 0xDA,
+    0x70, 0xAE, 0x97, 0xEA, 0x70, 0xE7, 0x1D, 0xA7, 0x1A, 0xD7, 0x2D, 0x97, 0x19, 0xD7, 0x2A, 0xCA,
+    0x72, 0xAC, 0xA7, 0x29, 0xD9, 0x29, 0xD4, 0xFF, 0x95, 0x9F, 0x97, 0x72, 0x72, 0xAA, 0x77, 0xD9,
+    0x75, 0x9D, 0x97, 0x69, 0x97, 0x77, 0x77, 0x6D, 0xA7, 0x4A, 0xE7, 0x4F, 0x73, 0xDA, 0xD7, 0x29,
+    0xD0, 0xD7, 0x2D, 0x1D, 0x97, 0x0A, 0xCA, 0x1D, 0x97, 0x9D, 0x2D, 0x97, 0xD9, 0x2D, 0xA6, 0xAD,
+    0x3D, 0xA5, 0x9D, 0x4A, 0xD5, 0xDA, 0x4A, 0xD4, 0xAE, 0xAA, 0xAA, 0xAE, 0x4F, 0xFF, 0x3F, 0xFF,
+    0xC9, 0x19, 0xD9, 0x6A, 0xD9, 0x1E, 0x7A, 0xDA, 0x0E, 0x97, 0xAD, 0xA0, 0x77, 0x9C, 0x77, 0x9C,
+    0x97, 0x7D, 0x77, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5D, 0xA7, 0x6A, 0xE7, 0x6F, 0x75,
+    0xDA, 0xD7, 0x49, 0xD0, 0xD7, 0x4D, 0x1D, 0x97, 0x2A, 0xCA, 0x1D, 0x97, 0x19, 0xD2, 0xD9, 0x71,
+    0xD9, 0x2D, 0xA7, 0x0A, 0xD3, 0xDA, 0x79, 0xD4, 0xAD, 0x7D, 0xA4, 0xAD, 0x6A, 0xEA, 0xAA, 0xAA,
+    0xE6, 0xFF, 0xF5, 0xFF, 0xFC, 0x93, 0x9D, 0x96, 0xAD, 0x93, 0xE7, 0xAD, 0xA2, 0xE9, 0x7A, 0xDA,
+    0x10, 0x73, 0xAC, 0x77, 0x0E, 0x76, 0xD0, 0xAC, 0x97, 0x3A, 0xA3, 0xA9, 0x77, 0x77, 0xDA, 0x76,
+    0xAE, 0x76, 0xF7, 0x5D, 0xAD, 0x74, 0x9D, 0x0D, 0x74, 0xD1, 0xD9, 0x72, 0xAC, 0xA1, 0xD9, 0x71,
+    0x9D, 0x2D, 0x97, 0x1D, 0x92, 0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x9D, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6,
+    0xAE, 0xAA, 0xAA, 0xAE, 0x6F, 0xFF, 0x5F, 0xFF, 0xC9, 0x39, 0xD9, 0x6A, 0xD9, 0x3E, 0x7A, 0xDA,
+    0x2E, 0x97, 0xAD, 0xA1, 0x73, 0xAC, 0x91, 0xAA, 0x72, 0xAC, 0x0C, 0x1C, 0x97, 0x2C, 0x90, 0xAA,
+    0x9C, 0x72, 0x9C, 0x2D, 0x97, 0x77, 0x77, 0x72, 0xDA, 0x76, 0xAE, 0x76, 0xF7, 0x5D, 0xAD, 0x74,
+    0x9D, 0x0D, 0x74, 0xD1, 0xD9, 0x72, 0xAC, 0xA1, 0xD9, 0x71, 0x9D, 0x2D, 0x97, 0x1D, 0x92, 0xDA,
+    0x70, 0xAD, 0x3D, 0xA7, 0x9D, 0x4A, 0xD7, 0xDA, 0x4A, 0xD6, 0xAE, 0xAA, 0xAA, 0xAE, 0x6F, 0xFF,
+    0x5F, 0xFF, 0xC9, 0x39, 0xD9, 0x6A, 0xD9, 0x3E, 0x7A, 0xDA, 0x2E, 0x97, 0xAD, 0xA1, 0x72, 0xDA,
+    0x2D, 0x72, 0x9D, 0x91, 0xAD, 0x72, 0xE9, 0x1E, 0x72, 0x99, 0x92, 0x99, 0x97, 0x77, 0x77, 0x74,
+    0xDA, 0x77, 0xAE, 0x77, 0xF7, 0x6D, 0xAD, 0x75, 0x9D, 0x0D, 0x75, 0xD1, 0xD9, 0x73, 0xAC, 0xA1,
+    0xD9, 0x72, 0x9D, 0x2D, 0x97, 0x2D, 0x92, 0xDA, 0x71, 0xAD, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70,
+    0xDA, 0x4A, 0xD7, 0xAE, 0xAA, 0xAA, 0xAE, 0x7F, 0xFF, 0x6F, 0xFF, 0xC9, 0x49, 0xD9, 0x6A, 0xD9,
+    0x4E, 0x7A, 0xDA, 0x3E, 0x97, 0xAD, 0xA2, 0x75, 0xAA, 0xA7, 0x5A, 0x1A, 0x75, 0xC1, 0xC7, 0x5E,
+    0x77, 0x77, 0x77, 0x77, 0x3D, 0xA7, 0x5A, 0xE7, 0x5F, 0x74, 0xDA, 0xD7, 0x39, 0xD0, 0xD7, 0x3D,
+    0x1D, 0x97, 0x1A, 0xCA, 0x1D, 0x97, 0x09, 0xD2, 0xD9, 0x70, 0xD9, 0x2D, 0xA7, 0xAD, 0x3D, 0xA6,
+    0x9D, 0x4A, 0xD6, 0xDA, 0x4A, 0xD5, 0xAE, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0x4F, 0xFF, 0xC9, 0x29,
+    0xD9, 0x6A, 0xD9, 0x2E, 0x7A, 0xDA, 0x1E, 0x97, 0xAD, 0xA0, 0x77, 0x59, 0x99, 0x99, 0x76, 0xAF,
+    0xFF, 0x75, 0x9F, 0xFF, 0xA7, 0x5F, 0xCA, 0x77, 0x4D, 0x9E, 0x97, 0x73, 0xD9, 0x0E, 0x77, 0x3A,
+    0xCA, 0x09, 0xDA, 0x77, 0x29, 0xD1, 0x9D, 0xA9, 0x99, 0xAA, 0x74, 0x9D, 0x29, 0xFF, 0x74, 0xD3,
+    0xAF, 0xEA, 0x73, 0xD9, 0x3E, 0x77, 0x0A, 0xCA, 0x4E, 0x77, 0xAD, 0xAA, 0xAA, 0xAF, 0x76, 0x9F,
+    0xFF, 0x76, 0xFF, 0xFC, 0xAA, 0xAA, 0xAA, 0x7E, 0x59, 0xFF, 0xD9, 0x5E, 0x6A, 0xFF, 0xD9, 0x4A,
+    0xD9, 0x6F, 0xFE, 0x97, 0x77, 0x70, 0x77, 0x73, 0x9A, 0xFA, 0x70, 0x9F, 0xF7, 0xAE, 0xA9, 0x99,
+    0xAA, 0x6E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x49, 0xD9, 0x75, 0xE7, 0x59, 0xD9, 0x75, 0xE7, 0x6E,
+    0x75, 0x9E, 0x75, 0x9F, 0x95, 0x94, 0x9F, 0xDA, 0xAA, 0xAD, 0x49, 0xFF, 0xEA, 0x5F, 0xFE, 0x95,
+    0x9F, 0xFD, 0x70, 0xAF, 0xEA, 0x73, 0xA7, 0x70, 0xC9, 0x77, 0x1C, 0x77, 0xAA, 0x75, 0xDA, 0x70,
+    0x70, 0xAC, 0x97, 0x6D, 0x97, 0x59, 0xD9, 0x77, 0x97, 0x77, 0x69, 0x99, 0x99, 0x6F, 0xFD, 0x59,
+    0xFF, 0xCA, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x99, 0x9A, 0xA7, 0x0F,
+    0xF7, 0x9F, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0xAA, 0xAA, 0xAA, 0xA5,
+    0x9F, 0xFD, 0x94, 0xAF, 0xFD, 0x94, 0xFF, 0xE9, 0x30, 0x75, 0xAC, 0x75, 0x9C, 0x97, 0x5C, 0xA7,
+    0x5D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x29, 0x99, 0x99, 0x6F, 0xFD, 0x59, 0xFF, 0xCA, 0x5A,
+    0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x99, 0x9A, 0xA7, 0x0F, 0xF7, 0x9F, 0xEA,
+    0x7D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFD, 0x94,
+    0xAF, 0xFD, 0x94, 0xFF, 0xE9, 0x30, 0x77, 0x72, 0xAC, 0x76, 0xE7, 0x4C, 0xA0, 0xAC, 0x97, 0x1A,
+    0xA3, 0xAA, 0x74, 0x99, 0x99, 0x6F, 0xFD, 0x59, 0xFF, 0xCA, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D,
+    0x75, 0xAD, 0x75, 0xDA, 0x99, 0x9A, 0xA7, 0x0F, 0xF7, 0x9F, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x49,
+    0xD7, 0x5A, 0xD7, 0x5E, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFD, 0x94, 0xAF, 0xFD, 0x94, 0xFF, 0xE9,
+    0x30, 0x70, 0x99, 0x39, 0x97, 0x1D, 0x91, 0x9D, 0x70, 0xAD, 0x91, 0xE7, 0x0E, 0x19, 0xE7, 0x77,
+    0x77, 0x79, 0x99, 0x99, 0x7F, 0xFD, 0x69, 0xFF, 0xCA, 0x6A, 0xCA, 0x76, 0xD9, 0x75, 0x9D, 0x76,
+    0xAD, 0x76, 0xDA, 0x99, 0x9A, 0xA7, 0x1F, 0xF7, 0x09, 0xFE, 0xA7, 0x0D, 0xA7, 0x6D, 0x97, 0x59,
+    0xD7, 0x6A, 0xD7, 0x6E, 0xAA, 0xAA, 0xAA, 0xA6, 0x9F, 0xFD, 0x95, 0xAF, 0xFD, 0x95, 0xFF, 0xE9,
+    0x40, 0x4A, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0x99, 0x77, 0x77, 0x69, 0xDA, 0x69, 0xD9, 0x6A,
+    0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE6, 0x9D, 0xA6,
+    0xAD, 0xA6, 0xE9, 0x59, 0xE6, 0xAE, 0x6A, 0xDA, 0x50, 0x77, 0x6A, 0xC7, 0x19, 0xC7, 0x2C, 0xA7,
+    0x1D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D,
+    0xA7, 0x0A, 0xDA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0A, 0xDA, 0x70, 0x77, 0x2D, 0x71, 0x9E,
+    0x70, 0xCA, 0x0A, 0xC9, 0x5C, 0xA3, 0xA9, 0x77, 0x77, 0x9D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71,
+    0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71,
+    0xE7, 0x09, 0xDA, 0x70, 0xAD, 0xA7, 0x0E, 0x97, 0x9E, 0x70, 0xAE, 0x70, 0xAD, 0xA7, 0x4D, 0x91,
+    0x9D, 0x49, 0xD9, 0x1A, 0xD4, 0xE2, 0xE4, 0x99, 0x92, 0x99, 0x97, 0x77, 0x77, 0x79, 0xDA, 0x71,
+    0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71,
+    0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE,
+    0x71, 0xAD, 0xA7, 0x00, 0x49, 0xFC, 0xAA, 0x97, 0x1A, 0xFF, 0xC9, 0x7F, 0xFE, 0x96, 0xD4, 0x9F,
+    0x5A, 0xD6, 0xAD, 0x94, 0xDA, 0x7E, 0x4D, 0x97, 0xE3, 0x9D, 0x70, 0xE0, 0x9F, 0xFA, 0x4E, 0x0F,
+    0xFC, 0x94, 0xE2, 0x9D, 0x97, 0xAD, 0xA2, 0x9D, 0x70, 0xE9, 0x2A, 0xD6, 0x9F, 0x3E, 0x99, 0x9A,
+    0xAA, 0xFC, 0x93, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xA4, 0xAF, 0xFE, 0x95, 0xFF, 0xA9, 0x70, 0x77,
+    0x77, 0x9D, 0x91, 0xC7, 0x5C, 0x99, 0xC0, 0x9C, 0x74, 0xAC, 0x1A, 0xD9, 0x77, 0x77, 0x70, 0x9A,
+    0xA6, 0x9E, 0x6E, 0x6A, 0xE6, 0xDA, 0x6F, 0x94, 0x9D, 0x69, 0xF9, 0x4E, 0x6A, 0xFA, 0x4D, 0xA6,
+    0xDA, 0xE3, 0xAD, 0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D, 0xA6, 0xE0, 0x9D, 0x91, 0xAD,
+    0x95, 0x9D, 0xA1, 0xDA, 0x1E, 0x6E, 0x91, 0xE0, 0x9D, 0xA6, 0xE2, 0xAD, 0x0A, 0xD9, 0x5A, 0xE2,
+    0xAD, 0x9E, 0x6E, 0xA2, 0x9F, 0xCA, 0x6E, 0x93, 0xFC, 0x95, 0xAE, 0x4F, 0xC6, 0xF4, 0xAE, 0xA5,
+    0x77, 0x76, 0x9C, 0xA7, 0x72, 0xAD, 0x77, 0x2A, 0xAA, 0x77, 0x77, 0x77, 0x70, 0xAF, 0xCA, 0x73,
+    0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70,
+    0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA,
+    0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC,
+    0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x77, 0x77, 0x3A, 0xC7,
+    0x71, 0x9C, 0x97, 0x71, 0xCA, 0x77, 0x1D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7A, 0xFC,
+    0xA7, 0x3A, 0xFF, 0xC9, 0x70, 0xEA, 0x92, 0xAE, 0x7E, 0xA5, 0xE9, 0x5E, 0x96, 0x9D, 0xA4, 0x9D,
+    0xA7, 0x0D, 0xA4, 0xE7, 0x1D, 0xA4, 0xD9, 0x71, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA, 0x71, 0xAD,
+    0x4D, 0xA7, 0x1D, 0xA4, 0xDA, 0x70, 0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA, 0xF9, 0x5F,
+    0xFF, 0xCA, 0x6A, 0xFF, 0xF7, 0x0F, 0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x72, 0xAC, 0x77,
+    0x2E, 0x77, 0x0D, 0x0A, 0xC9, 0x75, 0xAA, 0x3A, 0x97, 0x77, 0x71, 0xAF, 0xCA, 0x73, 0xAF, 0xFC,
+    0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70, 0xDA, 0x4E,
+    0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA, 0x71, 0xDA,
+    0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC, 0xA6, 0xAF,
+    0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x77, 0x77, 0xDA, 0x1A, 0xA7, 0x4C,
+    0xA0, 0xC9, 0x9C, 0x74, 0x9C, 0x19, 0xD9, 0x77, 0x77, 0x77, 0x6A, 0xFC, 0xA7, 0x3A, 0xFF, 0xC9,
+    0x70, 0xEA, 0x92, 0xAE, 0x7E, 0xA5, 0xE9, 0x5E, 0x96, 0x9D, 0xA4, 0x9D, 0xA7, 0x0D, 0xA4, 0xE7,
+    0x1D, 0xA4, 0xD9, 0x71, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA, 0x71, 0xAD, 0x4D, 0xA7, 0x1D, 0xA4,
+    0xDA, 0x70, 0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA, 0xF9, 0x5F, 0xFF, 0xCA, 0x6A, 0xFF,
+    0xF7, 0x0F, 0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x71, 0x99, 0x39, 0x97, 0x4D, 0x91, 0x9D,
+    0x73, 0xAD, 0x91, 0xE7, 0x3E, 0x90, 0x9E, 0x77, 0x77, 0x77, 0x5A, 0xFC, 0xA7, 0x3A, 0xFF, 0xC9,
+    0x70, 0xEA, 0x92, 0xAE, 0x7E, 0xA5, 0xE9, 0x5E, 0x96, 0x9D, 0xA4, 0x9D, 0xA7, 0x0D, 0xA4, 0xE7,
+    0x1D, 0xA4, 0xD9, 0x71, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA, 0x71, 0xAD, 0x4D, 0xA7, 0x1D, 0xA4,
+    0xDA, 0x70, 0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA, 0xF9, 0x5F, 0xFF, 0xCA, 0x6A, 0xFF,
+    0xF7, 0x0F, 0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x19, 0xCA, 0x1A, 0xC9, 0x2A, 0xCA, 0xD5,
+    0xE5, 0xAE, 0x93, 0xDA, 0xAD, 0x2A, 0xA9, 0x1A, 0xAA, 0x00, 0x77, 0x77, 0x09, 0xAA, 0x77, 0x77,
+    0x09, 0xD9, 0x77, 0x77, 0x9D, 0x97, 0x77, 0x79, 0xD9, 0x77, 0x77, 0x9D, 0x97, 0x77, 0x79, 0xD9,
+    0x77, 0x77, 0x0D, 0xA7, 0x77, 0x70, 0xDA, 0x77, 0x70, 0xAF, 0xC9, 0x9D, 0xA7, 0x77, 0xAF, 0xFD,
+    0xA7, 0x77, 0xEA, 0x92, 0xAE, 0x77, 0x7E, 0xA4, 0xF9, 0x77, 0x5E, 0x94, 0xFC, 0xA7, 0x74, 0x9D,
+    0xA4, 0xE0, 0xDA, 0x77, 0x4E, 0x4E, 0x1D, 0xA7, 0x74, 0xD9, 0x3E, 0x2D, 0x97, 0x73, 0xAD, 0x3E,
+    0x3D, 0x97, 0x73, 0xDA, 0x2E, 0x3A, 0xD7, 0x74, 0xDA, 0x1E, 0x4D, 0xA7, 0x74, 0xDA, 0x0E, 0x4A,
+    0xD9, 0x77, 0x4F, 0xD9, 0x3A, 0xE7, 0x75, 0xFC, 0xA9, 0x9A, 0xAF, 0x97, 0x75, 0xFF, 0xFC, 0xA7,
+    0x76, 0xFF, 0xFC, 0x77, 0x6F, 0xFF, 0xA7, 0x76, 0xEA, 0x9A, 0xFC, 0xA7, 0x77, 0xEA, 0x77, 0x77,
+    0xEA, 0x77, 0x77, 0xEA, 0x77, 0x77, 0xEA, 0x77, 0x77, 0xAD, 0xA7, 0x77, 0x7A, 0xE7, 0x77, 0x7A,
+    0xDA, 0x77, 0x77, 0x99, 0x77, 0x77, 0x10, 0x70, 0x9A, 0x97, 0x70, 0xD9, 0x77, 0x0D, 0x97, 0x70,
+    0x99, 0x77, 0x77, 0x76, 0x9A, 0xAA, 0x6A, 0xAA, 0x93, 0xAD, 0xA6, 0xE9, 0x3E, 0x95, 0x9E, 0x4E,
+    0x6A, 0xDA, 0x39, 0xE6, 0xE9, 0x3A, 0xD9, 0x6E, 0x4E, 0x69, 0xE4, 0xE6, 0x9D, 0x93, 0x9D, 0xA6,
+    0xAD, 0x49, 0xD9, 0x6E, 0x4A, 0xD6, 0x9D, 0x94, 0xE6, 0xAD, 0x5D, 0xA6, 0xE4, 0x9E, 0x49, 0xE9,
+    0x49, 0xFF, 0xF5, 0x9F, 0xFE, 0xA6, 0xFF, 0xE7, 0x9F, 0xFA, 0x77, 0x71, 0x75, 0x9C, 0x77, 0x0C,
+    0xA7, 0x7D, 0x77, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x99, 0x96, 0x99, 0x99, 0x3A,
+    0xDA, 0x6E, 0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAE, 0x39, 0xE6, 0xE9, 0x3A, 0xDA, 0x6E, 0x4E, 0x7E,
+    0x4E, 0x69, 0xD9, 0x4D, 0xA6, 0xAD, 0x49, 0xD9, 0x6E, 0x4A, 0xD7, 0xDA, 0x4E, 0x6A, 0xD5, 0xDA,
+    0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7, 0x77,
+    0x10, 0x77, 0x74, 0x9C, 0x97, 0x7E, 0x97, 0x5A, 0xC0, 0x9C, 0xA7, 0x39, 0xC3, 0xAA, 0x77, 0x71,
+    0x9A, 0xAA, 0x6A, 0xAA, 0x93, 0xAD, 0xA6, 0xE9, 0x3E, 0x95, 0x9E, 0x4E, 0x6A, 0xDA, 0x39, 0xE6,
+    0xE9, 0x3A, 0xD9, 0x6E, 0x4E, 0x69, 0xDA, 0x4E, 0x6A, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96,
+    0xE4, 0xAD, 0x69, 0xD9, 0x4E, 0x6A, 0xD5, 0xDA, 0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59,
+    0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7, 0x77, 0x10, 0x70, 0xAD, 0x2D, 0x97, 0x1D, 0xA1, 0x9D,
+    0x97, 0x0A, 0xDA, 0x1E, 0x71, 0x99, 0x92, 0x99, 0x97, 0x77, 0x77, 0x39, 0xAA, 0xA6, 0xAA, 0xA9,
+    0x3A, 0xDA, 0x6E, 0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4,
+    0xE6, 0x9E, 0x4E, 0x69, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xDA, 0x4E,
+    0x6A, 0xD5, 0xDA, 0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79,
+    0xFF, 0xA7, 0x77, 0x10, 0x72, 0xC9, 0x73, 0xCA, 0x73, 0xAC, 0x73, 0x9C, 0x97, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x6D, 0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD, 0x4A, 0xD9, 0x29, 0xDA,
+    0x29, 0xDA, 0x4E, 0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79, 0xFC, 0x71, 0xF7, 0x2E,
+    0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71, 0x77, 0x0A,
+    0xC9, 0x71, 0xD7, 0x2E, 0xA9, 0x69, 0xFD, 0x5D, 0x91, 0xE4, 0xD3, 0xAC, 0xA2, 0x9D, 0x4D, 0x2A,
+    0xCA, 0x4D, 0x2D, 0x93, 0xAC, 0xA2, 0xD2, 0x9E, 0x29, 0xD0, 0x9A, 0xDA, 0x3A, 0xFD, 0x94, 0xEA,
+    0xA9, 0x6D, 0x71, 0x9C, 0xA7, 0x1D, 0x97, 0x10, 0x77, 0x5A, 0xF9, 0x7D, 0x91, 0x9C, 0x6D, 0x4C,
+    0x94, 0x9C, 0x94, 0xA9, 0x4D, 0x29, 0xDA, 0x5D, 0x2C, 0x96, 0x9C, 0xA1, 0xAA, 0x7A, 0xC9, 0x1C,
+    0x97, 0xD2, 0xAC, 0x69, 0xD2, 0x9D, 0x94, 0xAC, 0xA3, 0x9D, 0x4D, 0x94, 0xAC, 0x92, 0x9D, 0x5A,
+    0xC9, 0x2A, 0xD0, 0xC9, 0x9A, 0xE3, 0xE9, 0xFD, 0x93, 0xDA, 0x9F, 0xA4, 0x69, 0x74, 0xD9, 0x72,
+    0x9D, 0x97, 0x29, 0xAA, 0x77, 0x69, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93, 0xAC, 0xA2, 0xAD, 0x39,
+    0xCA, 0x4D, 0x3D, 0x49, 0xD2, 0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2, 0xD4, 0xAD, 0x92, 0xDA,
+    0x19, 0xF3, 0xFF, 0xD3, 0x9F, 0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA1, 0x77, 0x70, 0x9C, 0x73, 0xCA,
+    0x72, 0xD7, 0x2A, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xDA, 0x0A, 0x94, 0xAF, 0xE9, 0x3A, 0xCA,
+    0x2A, 0xD3, 0x9C, 0xA4, 0xD3, 0xD4, 0x9D, 0x29, 0xC9, 0x49, 0xCA, 0x2A, 0xC5, 0xDA, 0x2D, 0x4A,
+    0xD9, 0x2D, 0xA1, 0x9F, 0x3F, 0xFD, 0x39, 0xFD, 0xAD, 0x49, 0xEA, 0x99, 0xCA, 0x10, 0x70, 0xCA,
+    0x73, 0xAD, 0xA7, 0x19, 0xCA, 0x0C, 0xA7, 0x0C, 0x92, 0x9C, 0x77, 0x59, 0xAD, 0xA0, 0xA9, 0x5A,
+    0xFE, 0x94, 0xAC, 0xA2, 0xAD, 0x49, 0xCA, 0x4D, 0x4D, 0x49, 0xD3, 0x9C, 0x94, 0x9C, 0xA3, 0xAC,
+    0x5D, 0xA3, 0xD4, 0xAD, 0x93, 0xDA, 0x19, 0xF4, 0xFF, 0xD4, 0x9F, 0xDA, 0xD5, 0x9E, 0xA9, 0x9C,
+    0xA2, 0x6A, 0xCA, 0x19, 0xC5, 0x9C, 0x9C, 0x1A, 0xA5, 0xCA, 0x09, 0xC9, 0xC6, 0xC9, 0x1A, 0xCA,
+    0x77, 0x49, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93, 0xAC, 0xA2, 0xAD, 0x39, 0xCA, 0x4D, 0x3D, 0x49,
+    0xD2, 0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2, 0xD4, 0xAD, 0x92, 0xDA, 0x19, 0xF3, 0xFF, 0xD3,
+    0x9F, 0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA1, 0x5A, 0xD2, 0xD9, 0x5D, 0xA1, 0x9D, 0x94, 0xAD, 0xA1,
+    0xE5, 0x99, 0x92, 0x99, 0x97, 0x75, 0x9A, 0xDA, 0x0A, 0x95, 0xAF, 0xE9, 0x4A, 0xCA, 0x2A, 0xD4,
+    0x9C, 0xA4, 0xD4, 0xD4, 0x9D, 0x39, 0xC9, 0x49, 0xCA, 0x3A, 0xC5, 0xDA, 0x3D, 0x4A, 0xD9, 0x3D,
+    0xA1, 0x9F, 0x4F, 0xFD, 0x49, 0xFD, 0xAD, 0x59, 0xEA, 0x99, 0xCA, 0x20, 0x70, 0xAC, 0xA7, 0x19,
+    0x90, 0x99, 0x70, 0xC1, 0xC7, 0x1A, 0xD9, 0x77, 0x77, 0x39, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93,
+    0xAC, 0xA2, 0xAD, 0x39, 0xCA, 0x4D, 0x3D, 0x49, 0xD2, 0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2,
+    0xD4, 0xAD, 0x92, 0xDA, 0x19, 0xF3, 0xFF, 0xD3, 0x9F, 0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA1, 0x77,
+    0x09, 0x97, 0x19, 0xAD, 0xA0, 0xA1, 0xFC, 0x96, 0xAF, 0xFD, 0x91, 0x9C, 0x5A, 0xCA, 0x2A, 0xEA,
+    0x4C, 0xA3, 0x9C, 0xA4, 0xDA, 0x29, 0x9A, 0xCA, 0x3D, 0x49, 0xFF, 0xDA, 0x29, 0xC9, 0x49, 0xEA,
+    0xAA, 0xA9, 0x99, 0x3A, 0xC5, 0xDA, 0x73, 0xD4, 0xAD, 0xA7, 0x3D, 0xA1, 0x9F, 0xC9, 0x49, 0x4F,
+    0xFF, 0xDA, 0xE4, 0x9F, 0xDA, 0xFF, 0xD5, 0x9E, 0xA9, 0x9C, 0xA9, 0xAF, 0xA3, 0x77, 0x9A, 0xE9,
+    0x3F, 0xD9, 0x2E, 0x6A, 0xD7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0xA7, 0xE7, 0xAE, 0xAA, 0xA4, 0xFD,
+    0xA3, 0x9A, 0xFA, 0x59, 0x70, 0x9A, 0xA9, 0x70, 0x9A, 0x59, 0xDA, 0x77, 0x59, 0xD7, 0x2A, 0xD7,
+    0x2A, 0xD7, 0x77, 0x77, 0x70, 0x97, 0x09, 0xFC, 0x5A, 0xCA, 0x91, 0xAC, 0x3A, 0xC9, 0x4C, 0x91,
+    0x9C, 0xA2, 0x99, 0xAC, 0x91, 0xFF, 0xDA, 0x09, 0xEA, 0xAA, 0xA9, 0x99, 0x1A, 0xC9, 0x71, 0xD9,
+    0x71, 0xAD, 0x94, 0x92, 0x9F, 0xFC, 0x3A, 0xFE, 0xA4, 0x9A, 0xEA, 0x92, 0x73, 0xC9, 0x72, 0xCA,
+    0x72, 0xAC, 0x72, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x59, 0x71, 0x9F, 0xC6, 0xAC, 0xA9,
+    0x1A, 0xC4, 0xAC, 0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9, 0x2F, 0xFD, 0xA1, 0x9E, 0xAA, 0xAA,
+    0x99, 0x92, 0xAC, 0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39, 0xFF, 0xC4, 0xAF, 0xEA, 0x59, 0xAE,
+    0xA9, 0x30, 0x77, 0x49, 0xC9, 0x72, 0xE9, 0x70, 0xAC, 0x99, 0xCA, 0x69, 0xC3, 0x9C, 0x77, 0x69,
+    0x71, 0x9F, 0xC6, 0xAC, 0xA9, 0x1A, 0xC4, 0xAC, 0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9, 0x2F,
+    0xFD, 0xA1, 0x9E, 0xAA, 0xAA, 0x99, 0x92, 0xAC, 0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39, 0xFF,
+    0xC4, 0xAF, 0xEA, 0x59, 0xAE, 0xA9, 0x30, 0x69, 0x92, 0x99, 0x95, 0xAD, 0x2D, 0xA5, 0xE1, 0x9D,
+    0x94, 0xAD, 0xA1, 0xE9, 0x77, 0x77, 0x77, 0x49, 0x72, 0x9F, 0xC7, 0xAC, 0xA9, 0x1A, 0xC5, 0xAC,
+    0x94, 0xC9, 0x39, 0xCA, 0x29, 0x9A, 0xC9, 0x3F, 0xFD, 0xA2, 0x9E, 0xAA, 0xAA, 0x99, 0x93, 0xAC,
+    0x97, 0x3D, 0x97, 0x3A, 0xD9, 0x49, 0x49, 0xFF, 0xC5, 0xAF, 0xEA, 0x69, 0xAE, 0xA9, 0x40, 0x73,
+    0xAC, 0x96, 0xD9, 0x6D, 0xA7, 0x76, 0x9A, 0x6A, 0xC6, 0xCA, 0x59, 0xC9, 0x5A, 0xC6, 0xD6, 0xCA,
+    0x5A, 0xC9, 0x5D, 0x95, 0xD5, 0xAD, 0x5A, 0xCA, 0x40, 0x7A, 0xC7, 0x9C, 0x70, 0xCA, 0x7D, 0x77,
+    0x77, 0x77, 0x75, 0x9A, 0x70, 0xAC, 0x70, 0xCA, 0x79, 0xC9, 0x7A, 0xC7, 0x0D, 0x70, 0xCA, 0x7A,
+    0xC9, 0x7D, 0x96, 0x9D, 0x7A, 0xD7, 0xAC, 0xA6, 0x76, 0xD7, 0x9E, 0x6C, 0xA0, 0xAC, 0x4C, 0xA3,
+    0xA9, 0x77, 0xAC, 0x70, 0xD7, 0x0C, 0xA7, 0x9C, 0x70, 0xD7, 0x0C, 0xA7, 0xAC, 0x97, 0xD9, 0x7D,
+    0x7A, 0xD7, 0xAC, 0xA6, 0x29, 0x93, 0x99, 0x19, 0xD2, 0xDA, 0x1E, 0x19, 0xDA, 0x09, 0xE1, 0xAD,
+    0xA7, 0x77, 0x29, 0x70, 0xAC, 0x70, 0xD7, 0x0C, 0x97, 0xAC, 0x70, 0xD7, 0x0C, 0xA7, 0xAC, 0x97,
+    0xD9, 0x7D, 0x7A, 0xD7, 0xAC, 0xA6, 0x72, 0x97, 0x70, 0xE7, 0x7A, 0xC9, 0x72, 0x9F, 0xFC, 0x7A,
+    0xFF, 0xA7, 0x29, 0xCA, 0x70, 0x99, 0xA9, 0x19, 0xC7, 0x9F, 0xCA, 0x0D, 0x69, 0xD9, 0x1A, 0xC9,
+    0xC9, 0x6D, 0x4E, 0x6A, 0xCA, 0x4D, 0x96, 0xD5, 0xD7, 0xD4, 0x9C, 0xA7, 0xD9, 0x29, 0xD7, 0x0F,
+    0xAE, 0x97, 0x09, 0xFD, 0x97, 0x29, 0xEA, 0x72, 0x79, 0xD2, 0xC7, 0x0C, 0x9A, 0xA0, 0x9C, 0x79,
+    0xC1, 0xC9, 0xC9, 0x7A, 0xA1, 0x9D, 0x77, 0x77, 0x6A, 0x19, 0xAA, 0x97, 0xAF, 0xE9, 0x6E, 0xA1,
+    0x9D, 0x6D, 0x93, 0xD5, 0xAD, 0x4D, 0x5D, 0x93, 0x9D, 0x5D, 0x4D, 0xA4, 0xAD, 0x4D, 0x94, 0xE3,
+    0x9D, 0x5D, 0xA3, 0xAD, 0x4A, 0xD9, 0x3E, 0x4E, 0x4D, 0xA3, 0x59, 0xC9, 0x73, 0xDA, 0x73, 0xDA,
+    0x74, 0x97, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x6A, 0xFD, 0xA4, 0xAC, 0xA3, 0xD3, 0xAC, 0xA4, 0x9C,
+    0xA2, 0xD5, 0x9C, 0x91, 0x9C, 0xA5, 0xAC, 0x91, 0xAC, 0x95, 0xD2, 0xAC, 0x94, 0x9C, 0xA2, 0xAD,
+    0x3A, 0xD9, 0x29, 0xFF, 0xA4, 0xFE, 0xA6, 0xAE, 0xA5, 0x72, 0x9C, 0x73, 0xCA, 0x72, 0xD7, 0x2A,
+    0xC9, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9A, 0xEA, 0x6A, 0xFD, 0xA4, 0xAC, 0xA3, 0xD3,
+    0xAC, 0xA4, 0x9C, 0xA2, 0xD5, 0x9C, 0x91, 0x9C, 0xA5, 0xAC, 0x91, 0xAC, 0x95, 0xD2, 0xAC, 0x94,
+    0x9C, 0xA2, 0xAD, 0x3A, 0xD9, 0x29, 0xFF, 0xA4, 0xFE, 0xA6, 0xAE, 0xA5, 0x77, 0x49, 0xC9, 0x72,
+    0xE9, 0x70, 0xAC, 0x09, 0xCA, 0x69, 0xC3, 0xAA, 0x77, 0x77, 0x19, 0xAE, 0xA6, 0xAF, 0xDA, 0x4A,
+    0xCA, 0x3D, 0x3A, 0xCA, 0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A, 0xC9, 0x5D,
+    0x2A, 0xC9, 0x49, 0xCA, 0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA, 0x50, 0x6A,
+    0xCA, 0x19, 0xA5, 0xAC, 0x0C, 0xA0, 0xC9, 0x5C, 0x91, 0xE6, 0x97, 0x77, 0x77, 0x75, 0x9A, 0xEA,
+    0x6A, 0xFD, 0xA4, 0xAC, 0xA3, 0xD3, 0xAC, 0xA4, 0x9C, 0xA2, 0xD5, 0x9C, 0x91, 0x9C, 0xA5, 0xAC,
+    0x91, 0xAC, 0x95, 0xD2, 0xAC, 0x94, 0x9C, 0xA2, 0xAD, 0x3A, 0xD9, 0x29, 0xFF, 0xA4, 0xFE, 0xA6,
+    0xAE, 0xA5, 0x5A, 0xD2, 0xD9, 0x5D, 0xA1, 0x9D, 0x94, 0xAD, 0xA1, 0xE5, 0x99, 0x92, 0x99, 0x97,
+    0x77, 0x77, 0x72, 0x9A, 0xEA, 0x7A, 0xFD, 0xA5, 0xAC, 0xA3, 0xD4, 0xAC, 0xA4, 0x9C, 0xA3, 0xD5,
+    0x9C, 0x92, 0x9C, 0xA5, 0xAC, 0x92, 0xAC, 0x95, 0xD3, 0xAC, 0x94, 0x9C, 0xA3, 0xAD, 0x3A, 0xD9,
+    0x39, 0xFF, 0xA5, 0xFE, 0xA7, 0xAE, 0xA6, 0x69, 0x97, 0x2A, 0xD7, 0x2E, 0x71, 0xAD, 0xA7, 0x77,
+    0x72, 0x99, 0x99, 0x9A, 0xAA, 0xAA, 0xA1, 0xFF, 0xF7, 0x72, 0x99, 0x73, 0xD9, 0x71, 0xAD, 0x97,
+    0x1E, 0x70, 0x77, 0x29, 0x77, 0x2C, 0xA7, 0x71, 0x9C, 0x77, 0x2C, 0xA7, 0x71, 0xAC, 0x77, 0x2C,
+    0xA7, 0x71, 0xAC, 0x77, 0x19, 0xC9, 0x77, 0x1D, 0x77, 0x19, 0xC9, 0x75, 0x9A, 0xF7, 0x5A, 0xFE,
+    0x73, 0xAC, 0xA1, 0xF9, 0x71, 0xAC, 0xA1, 0xAC, 0x09, 0xCA, 0x71, 0xD1, 0x9C, 0xA0, 0x9C, 0xA7,
+    0x09, 0xCA, 0x1D, 0x1A, 0xC9, 0x70, 0xAC, 0x90, 0x9C, 0xA1, 0xD7, 0x1D, 0x90, 0xD1, 0x9C, 0xA7,
+    0x1A, 0xDA, 0xCA, 0x0A, 0xD9, 0x71, 0xAF, 0xFA, 0x73, 0xFE, 0xA7, 0x49, 0xFA, 0x76, 0xD9, 0x77,
+    0x09, 0xD7, 0x71, 0xD7, 0x71, 0xAC, 0xA7, 0x71, 0xD7, 0x71, 0xAC, 0xA7, 0x71, 0xD7, 0x71, 0xDA,
+    0x77, 0x09, 0xCA, 0x77, 0x1A, 0x77, 0x77, 0x70, 0x77, 0x2D, 0x72, 0x9D, 0x72, 0x9A, 0xC7, 0x77,
+    0x7D, 0x49, 0xD1, 0x9D, 0x4A, 0xCA, 0x19, 0xCA, 0x4D, 0x91, 0xAC, 0x94, 0xD2, 0xD4, 0x9D, 0x2D,
+    0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x19, 0xCA, 0x3A, 0xD2, 0xAE, 0xAF, 0xC2, 0xAF, 0xFC, 0x29, 0xFF,
+    0xA3, 0xAE, 0xA0, 0xD9, 0x10, 0x77, 0x69, 0xC7, 0x2C, 0xA7, 0x1D, 0x71, 0xAC, 0x97, 0x77, 0x77,
+    0x77, 0x75, 0xD4, 0x9D, 0x19, 0xD4, 0xAC, 0xA1, 0x9C, 0xA4, 0xD9, 0x1A, 0xC9, 0x4D, 0x2D, 0x49,
+    0xD2, 0xD4, 0xAC, 0xA1, 0x9D, 0x4D, 0x91, 0x9C, 0xA3, 0xAD, 0x2A, 0xEA, 0xFC, 0x2A, 0xFF, 0xC2,
+    0x9F, 0xFA, 0x3A, 0xEA, 0x0D, 0x91, 0x59, 0xC9, 0x71, 0xE9, 0x7A, 0xC9, 0x9C, 0x95, 0x9C, 0x3A,
+    0xA7, 0x70, 0xD4, 0x9D, 0x19, 0xD4, 0xAC, 0xA1, 0x9C, 0xA4, 0xD9, 0x1A, 0xC9, 0x4D, 0x2D, 0x49,
+    0xD2, 0xD4, 0xAC, 0xA1, 0x9D, 0x4D, 0x91, 0x9C, 0xA3, 0xAD, 0x2A, 0xEA, 0xFC, 0x2A, 0xFF, 0xC2,
+    0x9F, 0xFA, 0x3A, 0xEA, 0x0D, 0x91, 0x59, 0x92, 0x99, 0x5E, 0x2D, 0x94, 0xDA, 0x1A, 0xD9, 0x3A,
+    0xDA, 0x1E, 0x77, 0x77, 0xD4, 0x9D, 0x29, 0xD4, 0xAC, 0xA2, 0x9C, 0xA4, 0xD9, 0x2A, 0xC9, 0x4D,
+    0x3D, 0x49, 0xD3, 0xD4, 0xAC, 0xA2, 0x9D, 0x4D, 0x92, 0x9C, 0xA3, 0xAD, 0x3A, 0xEA, 0xFC, 0x3A,
+    0xFF, 0xC3, 0x9F, 0xFA, 0x4A, 0xEA, 0x0D, 0x92, 0x74, 0xCA, 0x74, 0xAC, 0x74, 0x9C, 0x97, 0x4D,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6D, 0x6D, 0x4A, 0xC9, 0x4A, 0xC9, 0x49, 0xD4, 0xD6,
+    0xD3, 0xD9, 0x6D, 0x91, 0x9D, 0x7A, 0xCA, 0x1D, 0xA7, 0xAD, 0x09, 0xD7, 0x09, 0xD9, 0xDA, 0x71,
+    0xFC, 0x72, 0xFA, 0x72, 0xAE, 0x73, 0xAD, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x19, 0xF7, 0x9F, 0xD7,
+    0x0A, 0xFA, 0x71, 0xAA, 0xA9, 0x73, 0x59, 0x97, 0x2C, 0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x72, 0xEA,
+    0x97, 0xDA, 0xDA, 0x59, 0xC9, 0x1A, 0xCA, 0x4A, 0xC3, 0xD4, 0xD3, 0x9C, 0x4C, 0xA3, 0x9C, 0x39,
+    0xC9, 0x3C, 0xA3, 0xAC, 0x3A, 0xC4, 0xD2, 0xAC, 0xA4, 0xCA, 0x1D, 0xA4, 0x9F, 0xC9, 0x5A, 0xEA,
+    0x7D, 0x72, 0xCA, 0x71, 0x9C, 0x97, 0x1A, 0xC7, 0x2D, 0x71, 0x79, 0x93, 0x99, 0x69, 0xD2, 0xAD,
+    0x6E, 0x2D, 0xA5, 0x9E, 0x1A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x3D, 0x6D, 0x4A, 0xC9, 0x4A, 0xC9,
+    0x49, 0xD4, 0xD6, 0xD3, 0xD9, 0x6D, 0x91, 0x9D, 0x7A, 0xCA, 0x1D, 0xA7, 0xAD, 0x09, 0xD7, 0x09,
+    0xD9, 0xDA, 0x71, 0xFC, 0x72, 0xFA, 0x72, 0xAE, 0x73, 0xAD, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x19,
+    0xF7, 0x9F, 0xD7, 0x0A, 0xFA, 0x71, 0xAA, 0xA9, 0x73, 0x72, 0x99, 0x99, 0xAA, 0xAA, 0x72, 0xFF,
+    0xC7, 0x77, 0x77, 0x77, 0x77, 0x0D, 0xA7, 0x7A, 0xE7, 0x7F, 0x76, 0xDA, 0xD7, 0x59, 0xD0, 0xD7,
+    0x5D, 0x1D, 0x97, 0x3A, 0xCA, 0x1D, 0x97, 0x29, 0xD2, 0xD9, 0x72, 0xD9, 0x2D, 0xA7, 0x1A, 0xD3,
+    0xDA, 0x70, 0x9D, 0x4A, 0xD7, 0x0D, 0xA4, 0xAD, 0x7A, 0xEA, 0xAA, 0xAA, 0xE7, 0xFF, 0xF6, 0xFF,
+    0xFC, 0x94, 0x9D, 0x96, 0xAD, 0x94, 0xE7, 0xAD, 0xA3, 0xE9, 0x7A, 0xDA, 0x20, 0x59, 0x99, 0x9A,
+    0xAA, 0xA5, 0xAF, 0xF9, 0x77, 0x77, 0x39, 0xAD, 0xA0, 0xA9, 0x5A, 0xFE, 0x94, 0xAC, 0xA2, 0xAD,
+    0x49, 0xCA, 0x4D, 0x4D, 0x49, 0xD3, 0x9C, 0x94, 0x9C, 0xA3, 0xAC, 0x5D, 0xA3, 0xD4, 0xAD, 0x93,
+    0xDA, 0x19, 0xF4, 0xFF, 0xD4, 0x9F, 0xDA, 0xD5, 0x9E, 0xA9, 0x9C, 0xA2, 0x77, 0x76, 0xC4, 0x9C,
+    0x73, 0xCA, 0x29, 0xC9, 0x73, 0xFD, 0xA7, 0x5A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xDA, 0x77,
+    0xAE, 0x77, 0xF7, 0x6D, 0xAD, 0x75, 0x9D, 0x0D, 0x75, 0xD1, 0xD9, 0x73, 0xAC, 0xA1, 0xD9, 0x72,
+    0x9D, 0x2D, 0x97, 0x2D, 0x92, 0xDA, 0x71, 0xAD, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70, 0xDA, 0x4A,
+    0xD7, 0xAE, 0xAA, 0xAA, 0xAE, 0x7F, 0xFF, 0x6F, 0xFF, 0xC9, 0x49, 0xD9, 0x6A, 0xD9, 0x4E, 0x7A,
+    0xDA, 0x3E, 0x97, 0xAD, 0xA2, 0x77, 0x4C, 0x94, 0xC6, 0xD2, 0x9C, 0xA6, 0xAF, 0xCA, 0x70, 0xAE,
+    0x97, 0x77, 0x76, 0x9A, 0xDA, 0x0A, 0x95, 0xAF, 0xE9, 0x4A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA4, 0xD4,
+    0xD4, 0x9D, 0x39, 0xC9, 0x49, 0xCA, 0x3A, 0xC5, 0xDA, 0x3D, 0x4A, 0xD9, 0x3D, 0xA1, 0x9F, 0x4F,
+    0xFD, 0x49, 0xFD, 0xAD, 0x59, 0xEA, 0x99, 0xCA, 0x20, 0x73, 0xDA, 0x74, 0xAE, 0x74, 0xF7, 0x3D,
+    0xAD, 0x72, 0x9D, 0x0D, 0x72, 0xD1, 0xD9, 0x70, 0xAC, 0xA1, 0xD9, 0x79, 0xD2, 0xD9, 0x7D, 0x92,
+    0xDA, 0x6A, 0xD3, 0xDA, 0x59, 0xD4, 0xAD, 0x5D, 0xA4, 0xAD, 0x4A, 0xEA, 0xAA, 0xAA, 0xE4, 0xFF,
+    0xF3, 0xFF, 0xFC, 0x91, 0x9D, 0x96, 0xAD, 0x91, 0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0x73, 0x9C,
+    0x97, 0x49, 0xC7, 0x6C, 0x97, 0x6A, 0xD9, 0x76, 0x92, 0x77, 0x39, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE,
+    0x93, 0xAC, 0xA2, 0xAD, 0x39, 0xCA, 0x4D, 0x3D, 0x49, 0xD2, 0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D,
+    0xA2, 0xD4, 0xAD, 0x92, 0xDA, 0x19, 0xF3, 0xFF, 0xD3, 0x9F, 0xDA, 0xD4, 0x9E, 0xA9, 0xDA, 0x71,
+    0xCA, 0x72, 0x9C, 0x74, 0xE7, 0x49, 0x20, 0x77, 0x77, 0xAC, 0x76, 0x9C, 0x77, 0xCA, 0x76, 0xD7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xFA, 0x70, 0x9F, 0xF7, 0xAE, 0xA9, 0x99, 0xAA, 0x6E,
+    0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x49, 0xD9, 0x75, 0xE7, 0x59, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9E,
+    0x75, 0x9F, 0x95, 0x94, 0x9F, 0xDA, 0xAA, 0xAD, 0x49, 0xFF, 0xEA, 0x5F, 0xFE, 0x95, 0x9F, 0xFD,
+    0x70, 0xAF, 0xDA, 0xA7, 0x76, 0x77, 0x6C, 0xA7, 0x1A, 0xC7, 0x19, 0xC9, 0x71, 0xD7, 0x77, 0x77,
+    0x69, 0xAE, 0x95, 0xFD, 0x94, 0xE7, 0x0A, 0xD7, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1A, 0xCA,
+    0x71, 0xE7, 0x1A, 0xEA, 0xAA, 0x6F, 0xDA, 0x6A, 0xFA, 0x77, 0x00, 0x77, 0x75, 0xCA, 0x76, 0xAD,
+    0xA7, 0x49, 0xC9, 0x0A, 0xC7, 0x3C, 0x92, 0x9C, 0x97, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xA7, 0x09,
+    0xFF, 0x7A, 0xEA, 0x99, 0x9A, 0xA6, 0xEA, 0x74, 0xE9, 0x74, 0xE9, 0x74, 0x9D, 0x97, 0x5E, 0x75,
+    0x9D, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xE7, 0x59, 0xF9, 0x59, 0x49, 0xFD, 0xAA, 0xAA, 0xD4, 0x9F,
+    0xFE, 0xA5, 0xFF, 0xE9, 0x59, 0xFF, 0xD7, 0x0A, 0xFD, 0xAA, 0x77, 0x60, 0x7C, 0xA7, 0x2A, 0xD9,
+    0x70, 0x9C, 0x99, 0xCA, 0x7C, 0x92, 0x9C, 0x77, 0x77, 0x19, 0xAE, 0x96, 0xFD, 0x95, 0xE7, 0x1A,
+    0xD7, 0x2D, 0x72, 0x9D, 0x72, 0xAC, 0xA7, 0x2A, 0xCA, 0x72, 0xE7, 0x2A, 0xEA, 0xAA, 0x7F, 0xDA,
+    0x7A, 0xFA, 0x77, 0x20, 0x73, 0xAC, 0xA7, 0x6D, 0xA7, 0x5A, 0xD9, 0x75, 0x99, 0x97, 0x77, 0x77,
+    0x77, 0x77, 0x75, 0x9A, 0xFA, 0x70, 0x9F, 0xF7, 0xAE, 0xA9, 0x99, 0xAA, 0x6E, 0xA7, 0x4E, 0x97,
+    0x4E, 0x97, 0x49, 0xD9, 0x75, 0xE7, 0x59, 0xD9, 0x75, 0xE7, 0x6E, 0x75, 0x9E, 0x75, 0x9F, 0x95,
+    0x94, 0x9F, 0xDA, 0xAA, 0xAD, 0x49, 0xFF, 0xEA, 0x5F, 0xFE, 0x95, 0x9F, 0xFD, 0x70, 0xAF, 0xDA,
+    0xA7, 0x76, 0x79, 0x99, 0x7D, 0xA6, 0x9D, 0x96, 0xE9, 0x77, 0x77, 0x59, 0xAE, 0x93, 0xFD, 0x92,
+    0xE6, 0xAD, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xAC, 0xA7, 0xE7, 0xAE, 0xAA, 0xA4, 0xFD, 0xA4, 0xAF,
+    0xA7, 0x40, 0x70, 0xC3, 0x9A, 0x72, 0xAC, 0x90, 0xCA, 0x74, 0xEA, 0x75, 0x9C, 0xA7, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x09, 0xAF, 0xA7, 0x09, 0xFF, 0x7A, 0xEA, 0x99, 0x9A, 0xA6, 0xEA, 0x74,
+    0xE9, 0x74, 0xE9, 0x74, 0x9D, 0x97, 0x5E, 0x75, 0x9D, 0x97, 0x5E, 0x76, 0xE7, 0x59, 0xE7, 0x59,
+    0xF9, 0x59, 0x49, 0xFD, 0xAA, 0xAA, 0xD4, 0x9F, 0xFE, 0xA5, 0xFF, 0xE9, 0x59, 0xFF, 0xD7, 0x0A,
+    0xFD, 0xAA, 0x77, 0x60, 0x77, 0x09, 0xC3, 0xAA, 0x5A, 0xC9, 0x9C, 0xA7, 0xE9, 0x70, 0x9C, 0x97,
+    0x77, 0x77, 0x79, 0xAE, 0x95, 0xFD, 0x94, 0xE7, 0x0A, 0xD7, 0x1D, 0x71, 0x9D, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xE7, 0x1A, 0xEA, 0xAA, 0x6F, 0xDA, 0x6A, 0xFA, 0x77, 0x00, 0x77, 0x73, 0xC9,
+    0x29, 0xC7, 0x39, 0xC9, 0x9C, 0xA7, 0x5A, 0xD9, 0x77, 0xC9, 0x77, 0x77, 0x77, 0x77, 0x39, 0xFC,
+    0xAA, 0x97, 0x1A, 0xFF, 0xC9, 0x7F, 0xFE, 0x96, 0xD4, 0x9F, 0x59, 0xD6, 0xAD, 0x94, 0xDA, 0x7D,
+    0xA4, 0xD9, 0x7E, 0x39, 0xD7, 0x0E, 0x3A, 0xD7, 0x0E, 0x3D, 0xA7, 0x0E, 0x3D, 0x97, 0x9D, 0xA2,
+    0x9D, 0x70, 0xE9, 0x2A, 0xD6, 0x9F, 0x3E, 0x99, 0x9A, 0xAA, 0xFC, 0x93, 0xFF, 0xFC, 0xA3, 0x9F,
+    0xFF, 0xA4, 0xAF, 0xFE, 0x95, 0xFF, 0xA9, 0x70, 0x75, 0xCA, 0x77, 0x09, 0xC9, 0x19, 0x75, 0xD1,
+    0x9C, 0x75, 0xD1, 0xD7, 0x49, 0xC9, 0x1C, 0xA7, 0x4D, 0x1A, 0xC9, 0x6A, 0xE9, 0x0D, 0x19, 0x95,
+    0x9F, 0xD9, 0xCA, 0x70, 0x9D, 0x91, 0xAE, 0x97, 0x0D, 0x4E, 0x70, 0xD5, 0xDA, 0x79, 0xCA, 0x49,
+    0xD9, 0x7A, 0xC9, 0x4A, 0xD7, 0x0D, 0x93, 0x9E, 0x70, 0xEA, 0x99, 0xAE, 0xA7, 0x0A, 0xFF, 0xC9,
+    0x71, 0xFF, 0xC7, 0x3A, 0xEA, 0x0D, 0x77, 0x74, 0x49, 0xFC, 0xAA, 0x97, 0x1A, 0xFF, 0xC9, 0x7F,
+    0xFE, 0x96, 0xD4, 0x9F, 0x5A, 0xD6, 0xAD, 0x94, 0xDA, 0x7E, 0x4D, 0x97, 0xE3, 0x9D, 0x70, 0xE0,
+    0x9F, 0xFA, 0x4E, 0x0F, 0xFC, 0x94, 0xE2, 0x9D, 0x97, 0xAD, 0xA2, 0x9D, 0x70, 0xE9, 0x2A, 0xD6,
+    0x9F, 0x3E, 0x99, 0x9A, 0xAA, 0xFC, 0x93, 0xFF, 0xFC, 0xA3, 0x9F, 0xFF, 0xA4, 0xAF, 0xFE, 0x95,
+    0xFF, 0xA9, 0x70, 0x75, 0xCA, 0x77, 0x9C, 0x97, 0x7D, 0x97, 0x3F, 0xFC, 0x97, 0x0F, 0xFC, 0x74,
+    0xAC, 0x72, 0xAE, 0x90, 0xD7, 0x09, 0xFD, 0x9C, 0xA7, 0x9D, 0x91, 0xAE, 0x97, 0xD4, 0xE7, 0xD5,
+    0xDA, 0x69, 0xCA, 0x49, 0xD9, 0x6A, 0xC9, 0x4A, 0xD7, 0xD9, 0x39, 0xE7, 0xEA, 0x99, 0xAE, 0xA7,
+    0xAF, 0xFC, 0x97, 0x0F, 0xFC, 0x72, 0xAE, 0xA0, 0xD7, 0x77, 0x20, 0x77, 0x71, 0x9F, 0xF7, 0x0A,
+    0xAA, 0xAA, 0x99, 0x99, 0x77, 0x77, 0x77, 0x99, 0x99, 0x97, 0xFF, 0xD6, 0x9F, 0xFC, 0xA6, 0xAC,
+    0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x6D, 0xA9, 0x99, 0xAA, 0x71, 0xFF, 0x70, 0x9F, 0xEA,
+    0x70, 0xDA, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0xEA, 0xAA, 0xAA, 0xAA, 0x69, 0xFF, 0xD9,
+    0x5A, 0xFF, 0xD9, 0x5F, 0xFE, 0x94, 0x77, 0x4F, 0xF9, 0x49, 0xAA, 0xAA, 0xA9, 0x99, 0x77, 0x77,
+    0x77, 0x59, 0x72, 0x9F, 0xC7, 0xAC, 0xA9, 0x1A, 0xC5, 0xAC, 0x94, 0xC9, 0x39, 0xCA, 0x29, 0x9A,
+    0xC9, 0x3F, 0xFD, 0xA2, 0x9E, 0xAA, 0xAA, 0x99, 0x93, 0xAC, 0x97, 0x3D, 0x97, 0x3A, 0xD9, 0x49,
+    0x49, 0xFF, 0xC5, 0xAF, 0xEA, 0x69, 0xAE, 0xA9, 0x40, 0x77, 0x71, 0x9C, 0x4A, 0xC7, 0x09, 0xCA,
+    0x29, 0xC9, 0x71, 0xFD, 0x97, 0x3A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x49, 0x99, 0x99, 0x7F, 0xFD,
+    0x69, 0xFF, 0xCA, 0x6A, 0xCA, 0x76, 0xD9, 0x75, 0x9D, 0x76, 0xAD, 0x76, 0xDA, 0x99, 0x9A, 0xA7,
+    0x1F, 0xF7, 0x09, 0xFE, 0xA7, 0x0D, 0xA7, 0x6D, 0x97, 0x59, 0xD7, 0x6A, 0xD7, 0x6E, 0xAA, 0xAA,
+    0xAA, 0xA6, 0x9F, 0xFD, 0x95, 0xAF, 0xFD, 0x95, 0xFF, 0xE9, 0x40, 0x77, 0x4C, 0xA4, 0xC6, 0xD3,
+    0xD6, 0x9F, 0xD7, 0x09, 0xE9, 0x77, 0x77, 0x77, 0x77, 0x69, 0x72, 0x9F, 0xC7, 0xAC, 0xA9, 0x1A,
+    0xC5, 0xAC, 0x94, 0xC9, 0x39, 0xCA, 0x29, 0x9A, 0xC9, 0x3F, 0xFD, 0xA2, 0x9E, 0xAA, 0xAA, 0x99,
+    0x93, 0xAC, 0x97, 0x3D, 0x97, 0x3A, 0xD9, 0x49, 0x49, 0xFF, 0xC5, 0xAF, 0xEA, 0x69, 0xAE, 0xA9,
+    0x40, 0x73, 0x99, 0x76, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x77, 0x77, 0x77, 0x70, 0x99, 0x99, 0x96,
+    0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99,
+    0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA,
+    0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x71, 0x99, 0x71, 0xDA, 0x70,
+    0x9D, 0xA7, 0x0A, 0xDA, 0x77, 0x77, 0x77, 0x74, 0x97, 0x09, 0xFC, 0x5A, 0xCA, 0x91, 0xAC, 0x3A,
+    0xC9, 0x4C, 0x91, 0x9C, 0xA2, 0x99, 0xAC, 0x91, 0xFF, 0xDA, 0x09, 0xEA, 0xAA, 0xA9, 0x99, 0x1A,
+    0xC9, 0x71, 0xD9, 0x71, 0xAD, 0x94, 0x92, 0x9F, 0xFC, 0x3A, 0xFE, 0xA4, 0x9A, 0xEA, 0x92, 0x72,
+    0x99, 0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7,
+    0x5D, 0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD,
+    0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x97, 0x0C, 0xA7,
+    0x5A, 0xA7, 0x6C, 0xA9, 0x76, 0xD9, 0x77, 0x71, 0x79, 0x70, 0x9F, 0xC5, 0xAC, 0xA9, 0x1A, 0xC3,
+    0xAC, 0x94, 0xC9, 0x19, 0xCA, 0x29, 0x9A, 0xC9, 0x1F, 0xFD, 0xA0, 0x9E, 0xAA, 0xAA, 0x99, 0x91,
+    0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAD, 0x94, 0x92, 0x9F, 0xFC, 0x3A, 0xFE, 0xA4, 0x9A, 0xEA, 0x96,
+    0x9C, 0x97, 0x09, 0xC7, 0x2C, 0x72, 0x9C, 0x99, 0x71, 0xAD, 0x77, 0x30, 0x7A, 0xA3, 0xAA, 0x71,
+    0xD0, 0x9C, 0x97, 0x3E, 0x97, 0x4A, 0xC7, 0x77, 0x77, 0x77, 0x72, 0x99, 0x99, 0x96, 0xFF, 0xD5,
+    0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70,
+    0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA,
+    0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x77, 0x3C, 0x92, 0x9C, 0x69, 0xC9, 0x9C,
+    0xA7, 0x0A, 0xD9, 0x72, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x39, 0x71, 0x9F, 0xC6, 0xAC, 0xA9, 0x1A,
+    0xC4, 0xAC, 0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9, 0x2F, 0xFD, 0xA1, 0x9E, 0xAA, 0xAA, 0x99,
+    0x92, 0xAC, 0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39, 0xFF, 0xC4, 0xAF, 0xEA, 0x59, 0xAE, 0xA9,
+    0x30, 0x74, 0xCA, 0x77, 0x9D, 0xA7, 0x6C, 0xA0, 0xAC, 0x74, 0xC9, 0x29, 0xC9, 0x77, 0x77, 0x75,
+    0x9A, 0xAF, 0xD9, 0x69, 0xFF, 0xDA, 0x5A, 0xEA, 0x95, 0x94, 0x9E, 0x97, 0x5E, 0x76, 0xAD, 0xA7,
+    0x6E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE5, 0xEA, 0xA9, 0x92, 0xE5, 0xAF, 0xCA, 0x2E, 0x70,
+    0xDA, 0x91, 0x9E, 0x79, 0xD3, 0x9E, 0xA6, 0xDA, 0x4F, 0xFF, 0xC9, 0x4F, 0xFF, 0xC6, 0xFF, 0xF7,
+    0x9A, 0xFD, 0xA5, 0x70, 0xAC, 0x75, 0xE7, 0x3A, 0xC0, 0x9C, 0x97, 0x0A, 0xC3, 0xAA, 0x77, 0x77,
+    0x69, 0xE9, 0x0A, 0xA6, 0xFD, 0xAD, 0x5D, 0xA1, 0xAE, 0xA4, 0xAC, 0x93, 0xE9, 0x4D, 0x4E, 0x49,
+    0xC9, 0x4E, 0x4A, 0xC4, 0x9D, 0x94, 0xAC, 0x4E, 0x5A, 0xC9, 0x99, 0x9F, 0x59, 0xFF, 0xA6, 0xFF,
+    0x70, 0xAD, 0xA9, 0xD7, 0x39, 0xD9, 0x59, 0x3A, 0xE6, 0xFF, 0x6A, 0xFE, 0x97, 0x9F, 0xA7, 0x00,
+    0x77, 0x74, 0xCA, 0x4C, 0x72, 0xD2, 0x9C, 0xA7, 0x29, 0xFD, 0x74, 0x9E, 0x97, 0x77, 0x77, 0x77,
+    0x73, 0x9A, 0xAF, 0xD9, 0x69, 0xFF, 0xDA, 0x5A, 0xEA, 0x95, 0x94, 0x9E, 0x97, 0x5E, 0x76, 0xAD,
+    0xA7, 0x6E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE5, 0xEA, 0xA9, 0x92, 0xE5, 0xAF, 0xCA, 0x2E,
+    0x70, 0xDA, 0x91, 0x9E, 0x79, 0xD3, 0x9E, 0xA6, 0xDA, 0x4F, 0xFF, 0xC9, 0x4F, 0xFF, 0xC6, 0xFF,
+    0xF7, 0x9A, 0xFD, 0xA5, 0x77, 0x49, 0xC4, 0xAA, 0x59, 0xC9, 0x2A, 0xC7, 0xFD, 0x97, 0x0A, 0xDA,
+    0x77, 0x77, 0x77, 0x59, 0xE9, 0x0A, 0xA5, 0xFD, 0xAD, 0x4D, 0xA1, 0xAE, 0xA3, 0xAC, 0x93, 0xE9,
+    0x3D, 0x4E, 0x39, 0xC9, 0x4E, 0x3A, 0xC4, 0x9D, 0x93, 0xAC, 0x4E, 0x4A, 0xC9, 0x99, 0x9F, 0x49,
+    0xFF, 0xA5, 0xFF, 0x7A, 0xDA, 0x9D, 0x72, 0x9D, 0x94, 0x93, 0xAE, 0x5F, 0xF5, 0xAF, 0xE9, 0x69,
+    0xFA, 0x70, 0x75, 0x99, 0x76, 0xDA, 0x75, 0x9D, 0xA7, 0x5A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x9A,
+    0xAF, 0xD9, 0x59, 0xFF, 0xDA, 0x4A, 0xEA, 0x95, 0x93, 0x9E, 0x97, 0x4E, 0x75, 0xAD, 0xA7, 0x5E,
+    0x75, 0x9D, 0xA7, 0x5A, 0xD9, 0x75, 0xE5, 0xEA, 0xA9, 0x91, 0xE5, 0xAF, 0xCA, 0x1E, 0x70, 0xDA,
+    0x90, 0x9E, 0x79, 0xD2, 0x9E, 0xA6, 0xDA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9A,
+    0xFD, 0xA4, 0x71, 0x99, 0x73, 0x9D, 0x73, 0xE7, 0x29, 0xE7, 0x77, 0x77, 0x75, 0x9E, 0x90, 0xAA,
+    0x5F, 0xDA, 0xD4, 0xDA, 0x1A, 0xEA, 0x3A, 0xC9, 0x3E, 0x93, 0xD4, 0xE3, 0x9C, 0x94, 0xE3, 0xAC,
+    0x49, 0xD9, 0x3A, 0xC4, 0xE4, 0xAC, 0x99, 0x99, 0xF4, 0x9F, 0xFA, 0x5F, 0xF7, 0xAD, 0xA9, 0xD7,
+    0x29, 0xD9, 0x49, 0x3A, 0xE5, 0xFF, 0x5A, 0xFE, 0x96, 0x9F, 0xA7, 0x77, 0x71, 0x9A, 0xAF, 0xD9,
+    0x59, 0xFF, 0xDA, 0x4A, 0xEA, 0x95, 0x93, 0x9E, 0x97, 0x4E, 0x75, 0xAD, 0xA7, 0x5E, 0x75, 0x9D,
+    0xA7, 0x5A, 0xD9, 0x75, 0xE5, 0xEA, 0xA9, 0x91, 0xE5, 0xAF, 0xCA, 0x1E, 0x70, 0xDA, 0x90, 0x9E,
+    0x79, 0xD2, 0x9E, 0xA6, 0xDA, 0x3F, 0xFF, 0xC9, 0x3F, 0xFF, 0xC5, 0xFF, 0xF6, 0x9A, 0xFD, 0xA7,
+    0x77, 0x77, 0x77, 0x73, 0xE9, 0x74, 0xAE, 0x75, 0xE7, 0x59, 0xDA, 0x75, 0xE7, 0x5A, 0xDA, 0x70,
+    0x71, 0xAE, 0x72, 0xE9, 0x71, 0x9E, 0x72, 0xAD, 0x97, 0x19, 0xE7, 0x2E, 0x97, 0x77, 0x76, 0x9E,
+    0x90, 0xAA, 0x5F, 0xDA, 0xD4, 0xDA, 0x1A, 0xEA, 0x3A, 0xC9, 0x3E, 0x93, 0xD4, 0xE3, 0x9C, 0x94,
+    0xE3, 0xAC, 0x49, 0xD9, 0x3A, 0xC4, 0xE4, 0xAC, 0x99, 0x99, 0xF4, 0x9F, 0xFA, 0x5F, 0xF7, 0xAD,
+    0xA9, 0xD7, 0x29, 0xD9, 0x49, 0x3A, 0xE5, 0xFF, 0x5A, 0xFE, 0x96, 0x9F, 0xA7, 0x77, 0x75, 0x9C,
+    0x77, 0x1E, 0x97, 0x6A, 0xC0, 0x9C, 0x97, 0x49, 0xC3, 0xAA, 0x77, 0x77, 0x77, 0x1D, 0x96, 0x9D,
+    0x59, 0xD7, 0xAD, 0x5A, 0xD7, 0xDA, 0x5D, 0xA6, 0x9D, 0x94, 0x9D, 0x96, 0xAD, 0x5A, 0xD7, 0xE5,
+    0xE7, 0xE5, 0xE6, 0x9D, 0xA4, 0xAD, 0xA6, 0xE9, 0x4F, 0xFF, 0xD5, 0xFF, 0xFD, 0x49, 0xFF, 0xFC,
+    0xA4, 0xAF, 0xFF, 0xC9, 0x4E, 0x95, 0x9E, 0x49, 0xE6, 0xAE, 0x4A, 0xE6, 0xEA, 0x4E, 0xA5, 0x9E,
+    0x93, 0x6A, 0xC7, 0x3E, 0x71, 0xAC, 0x09, 0xC9, 0x6A, 0xC3, 0xAA, 0x77, 0x5C, 0xA7, 0x2A, 0xC9,
+    0x72, 0xD7, 0x3C, 0xA7, 0x2A, 0xC7, 0x3D, 0x73, 0xCA, 0x9E, 0xA5, 0xAF, 0xF4, 0xEA, 0x90, 0x9D,
+    0x4D, 0xA3, 0xAC, 0x3A, 0xD4, 0xAC, 0x3D, 0x94, 0xD3, 0xD5, 0xCA, 0x2A, 0xD4, 0x9C, 0xA2, 0xDA,
+    0x4D, 0x92, 0xD9, 0x4D, 0x2A, 0xD4, 0xAD, 0x2E, 0x4E, 0x10, 0x5A, 0xA9, 0x7A, 0xA6, 0xD9, 0x69,
+    0xD5, 0x9D, 0x7E, 0x5E, 0x7D, 0xA5, 0xDA, 0x69, 0xD9, 0x49, 0xD9, 0x6A, 0xD4, 0xFF, 0xFF, 0x29,
+    0xFF, 0xFE, 0x93, 0x9D, 0xA6, 0xAD, 0x94, 0xAD, 0xA6, 0xE5, 0xFF, 0xFD, 0x5F, 0xFF, 0xD4, 0x9F,
+    0xFF, 0xCA, 0x4A, 0xFF, 0xFC, 0x94, 0xE9, 0x59, 0xE4, 0x9E, 0x6A, 0xE4, 0xAE, 0x6E, 0xA4, 0xEA,
+    0x59, 0xE9, 0x30, 0x6C, 0xA7, 0x2A, 0xC9, 0x72, 0xD9, 0x9A, 0xAA, 0x49, 0xFE, 0xA4, 0x9A, 0xC9,
+    0x72, 0xD7, 0x3C, 0xA9, 0xEA, 0x5A, 0xFF, 0x4E, 0xA9, 0x09, 0xD4, 0xDA, 0x3A, 0xC3, 0xAD, 0x4A,
+    0xC3, 0xD9, 0x4D, 0x3D, 0x5C, 0xA2, 0xAD, 0x49, 0xCA, 0x2D, 0xA4, 0xD9, 0x2D, 0x94, 0xD2, 0xAD,
+    0x4A, 0xD2, 0xE4, 0xE1, 0x5D, 0x2C, 0x94, 0xCA, 0x9C, 0x1C, 0x5C, 0x1C, 0x9A, 0xA4, 0x9C, 0x19,
+    0xD7, 0x77, 0x77, 0x77, 0x29, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D,
+    0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x70, 0x9D, 0xA7, 0x0A,
+    0xDA, 0x70, 0xE9, 0x79, 0xE7, 0x0A, 0xE7, 0x0A, 0xDA, 0x70, 0x29, 0xD9, 0x1C, 0x92, 0xCA, 0x9C,
+    0x09, 0xC2, 0x9C, 0x1A, 0xD9, 0x39, 0x77, 0x77, 0x09, 0xC7, 0x0A, 0xC7, 0x0C, 0xA7, 0x9C, 0x97,
+    0xAC, 0x70, 0xD7, 0x9C, 0xA7, 0xAC, 0x97, 0xD9, 0x69, 0xD7, 0xAD, 0x7A, 0xCA, 0x60, 0x49, 0x99,
+    0x9A, 0xAA, 0xA4, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x59, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xDA, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x71, 0x9D, 0xA7, 0x1A, 0xDA, 0x71, 0xE9, 0x70, 0x9E, 0x71, 0xAE, 0x71, 0xAD, 0xA7, 0x00, 0x74,
+    0x9F, 0xF1, 0xAA, 0xAA, 0xA9, 0x99, 0x97, 0x77, 0x19, 0xA7, 0x0A, 0xC7, 0x0C, 0xA7, 0x9C, 0x97,
+    0xAC, 0x70, 0xD7, 0x0C, 0xA7, 0xAC, 0x97, 0xD9, 0x7D, 0x7A, 0xD7, 0xAC, 0xA6, 0x6D, 0xA5, 0x9D,
+    0xA5, 0xAD, 0x95, 0xE6, 0xDA, 0x6D, 0x95, 0x9D, 0x6A, 0xD6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6,
+    0xE5, 0x9D, 0xA5, 0xE9, 0x5E, 0x59, 0xE5, 0xAE, 0x5A, 0xA6, 0xAA, 0x7C, 0xA9, 0x69, 0xD9, 0x76,
+    0x69, 0x96, 0x9D, 0x6E, 0x59, 0xE7, 0x77, 0x73, 0x9A, 0x7A, 0xC7, 0xCA, 0x69, 0xC9, 0x6A, 0xC7,
+    0xD7, 0xCA, 0x6A, 0xC9, 0x6D, 0x96, 0xD6, 0xAD, 0x6D, 0xA6, 0xC9, 0x6C, 0x97, 0xC9, 0x96, 0x9D,
+    0x77, 0x7D, 0x96, 0xAD, 0x7E, 0x79, 0x99, 0x77, 0x77, 0x77, 0x19, 0xDA, 0x69, 0xD9, 0x6A, 0xD7,
+    0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE7, 0xDA, 0x69, 0xD9, 0x6A, 0xD7, 0xE6, 0x9D, 0xA6, 0xAD,
+    0xA6, 0xE9, 0x59, 0xE6, 0xAE, 0x6A, 0xDA, 0x50, 0x39, 0xA4, 0xAC, 0x4C, 0xA3, 0x9C, 0x93, 0xAC,
+    0x4D, 0x4C, 0xA3, 0xAC, 0x93, 0xD9, 0x3D, 0x3A, 0xD3, 0xAC, 0xA2, 0x49, 0xDA, 0x4D, 0xA4, 0x9D,
+    0x93, 0x9D, 0x94, 0xAD, 0x4A, 0xD5, 0xE4, 0xE5, 0xDA, 0x39, 0xDA, 0x49, 0xD9, 0x3A, 0xD5, 0xAD,
+    0x4E, 0x5E, 0x4D, 0xA5, 0xDA, 0x3A, 0xD9, 0x49, 0xD9, 0x3E, 0x5A, 0xD4, 0xDA, 0x5E, 0x39, 0xD9,
+    0x49, 0xDA, 0x3A, 0xD5, 0xAD, 0xA3, 0xDA, 0x5E, 0x92, 0x9D, 0x94, 0x9E, 0x3A, 0xD5, 0xAE, 0x3E,
+    0x5A, 0xDA, 0x29, 0xD9, 0x73, 0x9E, 0x71, 0xCA, 0xFA, 0x71, 0xFD, 0x71, 0x9F, 0xC7, 0x2A, 0xDA,
+    0x97, 0x00, 0x5D, 0x97, 0x99, 0x5A, 0xD7, 0x0D, 0x94, 0xE7, 0xAD, 0x94, 0x99, 0x97, 0xE7, 0x77,
+    0x77, 0x59, 0x77, 0x1A, 0xC7, 0x1D, 0x5D, 0x70, 0x9C, 0x95, 0xC9, 0x70, 0xD5, 0xAC, 0x71, 0xD5,
+    0xD7, 0x09, 0xC9, 0x5C, 0xA7, 0x0A, 0xC5, 0xAC, 0x97, 0x0D, 0x5D, 0x97, 0x9C, 0xA5, 0xD7, 0x0A,
+    0xC5, 0xAD, 0x70, 0xD5, 0xAC, 0xA7, 0x9C, 0xA7, 0x70, 0xAC, 0x77, 0x09, 0xD7, 0x7A, 0xD9, 0x74,
+    0x9F, 0xC7, 0x5F, 0xA7, 0x77, 0x30, 0x72, 0xAC, 0x77, 0xE7, 0x5D, 0x0A, 0xC9, 0x72, 0xAA, 0x3A,
+    0x97, 0x77, 0x6A, 0xA9, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xDA, 0x75, 0xAD, 0x97, 0x5E, 0x76, 0xDA,
+    0x75, 0x9D, 0x97, 0x5A, 0xD7, 0x6E, 0x75, 0x9D, 0xA7, 0x5A, 0xD7, 0x6E, 0x76, 0xDA, 0x75, 0x9D,
+    0x97, 0x5E, 0x76, 0xDA, 0x75, 0x9D, 0x97, 0x5E, 0x74, 0x9E, 0xA7, 0x19, 0xFD, 0x72, 0xAF, 0xC9,
+    0x72, 0xFC, 0x97, 0x3A, 0xA9, 0x97, 0x40, 0x77, 0x72, 0xD7, 0x59, 0xE7, 0x4C, 0xA0, 0xAC, 0x72,
+    0xCA, 0x3A, 0x97, 0x77, 0x2A, 0xC7, 0x6D, 0x75, 0x9C, 0xA7, 0x5A, 0xC9, 0x75, 0xD7, 0x6C, 0xA7,
+    0x59, 0xC9, 0x75, 0xAC, 0x76, 0xD7, 0x59, 0xC9, 0x75, 0xAC, 0x76, 0xD7, 0x59, 0xCA, 0x75, 0xD7,
+    0x49, 0xE7, 0x2F, 0xC7, 0x2A, 0xEA, 0x77, 0x74, 0x6D, 0xA2, 0xAD, 0x95, 0x9D, 0x29, 0xDA, 0x6A,
+    0xD1, 0x9D, 0xA7, 0xDA, 0x1E, 0x79, 0xD1, 0xE7, 0x0A, 0xD0, 0xE7, 0x1D, 0xAA, 0xD9, 0x70, 0x9F,
+    0xC9, 0x71, 0xFC, 0xA7, 0x2F, 0xC7, 0x29, 0xFC, 0x72, 0xFE, 0x71, 0xDA, 0xAE, 0xA7, 0xAD, 0x90,
+    0xF7, 0xE1, 0xFC, 0x6D, 0xA1, 0x9F, 0xA4, 0xAD, 0x92, 0xFC, 0x93, 0xE3, 0x9F, 0xC7, 0x77, 0x2E,
+    0x97, 0x3A, 0xE7, 0x4E, 0x97, 0x4D, 0xA7, 0x4E, 0x74, 0x9D, 0xA7, 0x00, 0x59, 0xA7, 0x1D, 0x70,
+    0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0x90, 0x9D, 0x4D, 0x09, 0xD4, 0x9C,
+    0xA9, 0xD5, 0xAF, 0x6F, 0x69, 0xF9, 0x5A, 0xCA, 0xE5, 0xD9, 0xAE, 0x39, 0xD1, 0xEA, 0x2A, 0xD1,
+    0x9E, 0x91, 0xDA, 0x2F, 0x77, 0x77, 0x70, 0x9E, 0x7A, 0xDA, 0x7E, 0x79, 0xDA, 0x7E, 0x7A, 0xD9,
+    0x50, 0x74, 0x9C, 0x90, 0x9C, 0x92, 0xAC, 0x09, 0xCA, 0x3C, 0xA0, 0xCA, 0x39, 0xC9, 0xD4, 0xAE,
+    0x5E, 0x59, 0xE5, 0xDA, 0xD4, 0xCA, 0x0D, 0xA2, 0x9C, 0x90, 0xE9, 0x1D, 0x19, 0xE1, 0x70, 0x9C,
+    0x72, 0xC9, 0x71, 0xD7, 0x1A, 0xC7, 0x77, 0x77, 0x70, 0xAD, 0x71, 0xDA, 0x70, 0x9D, 0x97, 0x0A,
+    0xD7, 0x1D, 0xA7, 0x1D, 0x97, 0x0A, 0xD7, 0x1E, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xDA,
+    0x70, 0x9D, 0x97, 0x0A, 0xD7, 0x1E, 0x09, 0x99, 0x99, 0xA9, 0x09, 0xFF, 0xDA, 0x0A, 0xFF, 0xD9,
+    0x0F, 0xFE, 0x00, 0x77, 0x4A, 0xA7, 0x09, 0xC7, 0x09, 0xCA, 0x70, 0xD7, 0x77, 0x77, 0x39, 0xA7,
+    0x1D, 0x70, 0x9C, 0xA7, 0x0D, 0x97, 0x0D, 0x70, 0xAC, 0xA7, 0x0D, 0x71, 0xD7, 0x0A, 0xCA, 0x70,
+    0xD9, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD0, 0x96, 0xAF, 0x6F, 0xC6, 0x59,
+    0xAA, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0xAD, 0x71, 0xDA, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xE7, 0x1D,
+    0xA7, 0x09, 0xD7, 0x1A, 0xD7, 0x1D, 0xA7, 0x09, 0xD9, 0x70, 0xAD, 0x71, 0xE0, 0x99, 0x99, 0x9A,
+    0x90, 0x9F, 0xFD, 0xA0, 0xAF, 0xFD, 0x90, 0xFF, 0xE7, 0x77, 0x77, 0x4E, 0x97, 0x9E, 0x70, 0xE9,
+    0x70, 0xE7, 0x0E, 0x97, 0x9D, 0xA6, 0x5A, 0xC6, 0xD5, 0xAC, 0xA5, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D,
+    0x59, 0xD5, 0xAC, 0xA5, 0xD5, 0x9D, 0x5A, 0xCA, 0x5D, 0x95, 0xD5, 0x9D, 0x09, 0x3A, 0xF3, 0xFC,
+    0x77, 0x7A, 0xDA, 0x4E, 0x4A, 0xDA, 0x4E, 0x49, 0xDA, 0x4E, 0x40, 0x59, 0x99, 0x73, 0xDA, 0x73,
+    0xD9, 0x72, 0x9D, 0x73, 0xE3, 0x99, 0x5D, 0x93, 0xD4, 0x9D, 0x39, 0xC9, 0x4A, 0xD3, 0xAC, 0x5D,
+    0xA3, 0xD4, 0x9D, 0x73, 0xAD, 0x73, 0xDA, 0x72, 0x9D, 0x97, 0x2A, 0xD7, 0x3E, 0x09, 0x99, 0x99,
+    0x99, 0x29, 0xFF, 0xDA, 0x2A, 0xFF, 0xD9, 0x2F, 0xFE, 0x20, 0x71, 0xAC, 0x5D, 0x2C, 0xA5, 0xD1,
+    0xAC, 0x94, 0xAC, 0xA1, 0xD5, 0xD2, 0x99, 0x49, 0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x19, 0xD7, 0x1A,
+    0xC9, 0x71, 0xD7, 0x19, 0xD7, 0x1A, 0xCA, 0x71, 0xD9, 0x71, 0xD7, 0x19, 0xD0, 0x97, 0xAF, 0x7F,
+    0xC7, 0x59, 0xAA, 0x73, 0xDA, 0x73, 0xD9, 0x72, 0xAD, 0x73, 0xDA, 0x3D, 0x94, 0xD9, 0x2A, 0xD4,
+    0x9D, 0x3E, 0x4E, 0x39, 0x99, 0x4D, 0xA7, 0x29, 0xD7, 0x3A, 0xD7, 0x3D, 0xA7, 0x29, 0xD9, 0x72,
+    0xAD, 0x73, 0xE0, 0x99, 0x99, 0x9A, 0x92, 0x9F, 0xFD, 0xA2, 0xAF, 0xFD, 0x92, 0xFF, 0xE2, 0x4A,
+    0xA7, 0x0D, 0x79, 0xCA, 0x7D, 0x79, 0xD2, 0x99, 0x2A, 0xCA, 0x1A, 0xD2, 0xD2, 0xDA, 0x19, 0xD1,
+    0xAD, 0xA1, 0xAC, 0xA7, 0xD7, 0x9D, 0x7A, 0xCA, 0x7D, 0x97, 0xD7, 0x9D, 0x09, 0x5A, 0xF5, 0xFC,
+    0x50, 0x77, 0x77, 0x77, 0x5A, 0xC9, 0x77, 0x70, 0xAC, 0x97, 0x77, 0x0A, 0xCA, 0x77, 0x29, 0xAA,
+    0x2A, 0xCA, 0x77, 0x3D, 0xA1, 0xAC, 0xA7, 0x74, 0xD9, 0x0A, 0xCA, 0x77, 0x49, 0xD0, 0xAC, 0xA7,
+    0x75, 0xDA, 0x9C, 0xA7, 0x76, 0xFC, 0x77, 0x69, 0xF7, 0x77, 0xAE, 0x77, 0x70, 0xE7, 0x77, 0x09,
+    0xD7, 0x77, 0x09, 0xE7, 0x77, 0x9E, 0xA7, 0x76, 0x9F, 0x97, 0x75, 0x9F, 0xC7, 0x75, 0x9D, 0x9E,
+    0x09, 0x99, 0x99, 0xA9, 0x74, 0x9D, 0x99, 0xFF, 0xDA, 0x73, 0x9D, 0x90, 0xAF, 0xFD, 0x97, 0x29,
+    0xD9, 0x1F, 0xFE, 0x72, 0x9D, 0x97, 0x77, 0x9D, 0x97, 0x77, 0x9D, 0xA7, 0x77, 0x9D, 0x97, 0x77,
+    0x09, 0x77, 0x72, 0x74, 0xAC, 0x77, 0x1D, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x97, 0x79, 0xD7, 0x70,
+    0xAC, 0xA7, 0x70, 0xD7, 0x70, 0x9D, 0x77, 0x0A, 0xCA, 0x77, 0x0D, 0x99, 0x9A, 0xCA, 0x95, 0x99,
+    0xAA, 0xEA, 0xA9, 0x59, 0xEA, 0xA9, 0x9A, 0xCA, 0x77, 0x0D, 0x97, 0x70, 0xD7, 0x70, 0x9D, 0x09,
+    0x76, 0xAF, 0x76, 0xFC, 0x60, 0x77, 0xC7, 0x72, 0xCA, 0x77, 0x1A, 0xC7, 0x71, 0x9C, 0x97, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0xAD, 0x69, 0xE6, 0xDA, 0x6F, 0x6D, 0x96, 0xF9, 0x4A, 0xD6, 0x9F, 0x94,
+    0xE6, 0xFC, 0xA3, 0x9D, 0x96, 0xDA, 0xE3, 0xAD, 0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D,
+    0xA6, 0xE0, 0x9D, 0x91, 0xAD, 0x6A, 0xDA, 0x1D, 0xA1, 0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E, 0x2A,
+    0xD0, 0xAD, 0x95, 0xAE, 0x2A, 0xD9, 0xE6, 0xEA, 0x29, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A, 0xE4,
+    0xFC, 0x6F, 0x4A, 0xEA, 0x50, 0x73, 0x9C, 0x74, 0xCA, 0x73, 0xD7, 0x3A, 0xC9, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0x19, 0xAA, 0x96, 0xAF, 0xE9, 0x5E, 0xA1, 0x9D, 0x5D, 0x93, 0xD4, 0xAD, 0x4D, 0x4D,
+    0x93, 0x9D, 0x4D, 0x4D, 0xA3, 0xAD, 0x4D, 0x93, 0xE3, 0x9D, 0x4D, 0xA3, 0xAD, 0x3A, 0xD9, 0x3E,
+    0x3E, 0x4D, 0xA2, 0x77, 0x09, 0xAA, 0x69, 0xE6, 0xE6, 0xAE, 0x6D, 0x96, 0xF5, 0xAD, 0x69, 0xF9,
+    0x4E, 0x6A, 0xFA, 0x4D, 0xA6, 0xDA, 0xE3, 0xAD, 0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D,
+    0xA6, 0xE0, 0x9D, 0x91, 0xAD, 0x69, 0xDA, 0x1D, 0xA1, 0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E, 0x2A,
+    0xD0, 0xAD, 0x95, 0xAE, 0x2A, 0xD9, 0xE6, 0xEA, 0x29, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A, 0xE4,
+    0xFC, 0x6F, 0x4A, 0xEA, 0x77, 0x77, 0x0A, 0xE7, 0x70, 0xE9, 0x77, 0x9E, 0x77, 0x0A, 0xD9, 0x77,
+    0x9E, 0x77, 0x0E, 0x75, 0x4A, 0x19, 0xAA, 0x95, 0xAF, 0xE9, 0x4E, 0xA1, 0x9D, 0x4D, 0x93, 0xD3,
+    0xAD, 0x4D, 0x3D, 0x93, 0x9D, 0x3D, 0x4D, 0xA2, 0xAD, 0x4D, 0x92, 0xE3, 0x9D, 0x3D, 0xA3, 0xAD,
+    0x2A, 0xD9, 0x3E, 0x2E, 0x4D, 0xA7, 0x73, 0xE9, 0x70, 0x9E, 0x71, 0xE9, 0x71, 0xE7, 0x1E, 0x97,
+    0x09, 0xDA, 0x70, 0x71, 0x95, 0x97, 0x4A, 0xC2, 0xAC, 0x76, 0xD9, 0xCA, 0x77, 0x0D, 0x97, 0x71,
+    0xAA, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0x69, 0xE6, 0xE6, 0xAE, 0x6D, 0x96, 0xF5, 0xAD, 0x69,
+    0xF9, 0x4E, 0x6A, 0xFA, 0x4D, 0xA6, 0xDA, 0xE3, 0xAD, 0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91,
+    0x9D, 0xA6, 0xE0, 0x9D, 0x91, 0xAD, 0x69, 0xDA, 0x1D, 0xA1, 0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E,
+    0x2A, 0xD0, 0xAD, 0x95, 0xAE, 0x2A, 0xD9, 0xE6, 0xEA, 0x29, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A,
+    0xE4, 0xFC, 0x6F, 0x4A, 0xEA, 0x50, 0x6A, 0x49, 0x96, 0x9C, 0x19, 0xC9, 0x70, 0xAE, 0x73, 0xD7,
+    0x49, 0x77, 0x77, 0x77, 0x6A, 0x19, 0xAA, 0x96, 0xAF, 0xE9, 0x5E, 0xA1, 0x9D, 0x5D, 0x93, 0xD4,
+    0xAD, 0x4D, 0x4D, 0x93, 0x9D, 0x4D, 0x4D, 0xA3, 0xAD, 0x4D, 0x93, 0xE3, 0x9D, 0x4D, 0xA3, 0xAD,
+    0x3A, 0xD9, 0x3E, 0x3E, 0x4D, 0xA2, 0x39, 0x73, 0xD7, 0x2D, 0xA7, 0x1A, 0xD7, 0x19, 0xCA, 0x97,
+    0x77, 0x77, 0x77, 0x77, 0x74, 0x99, 0x09, 0xAA, 0xA6, 0xFF, 0x49, 0xE9, 0x1D, 0x93, 0xAD, 0x3A,
+    0xC9, 0x3D, 0x93, 0xAC, 0x92, 0x9D, 0x4D, 0x92, 0xAC, 0xA3, 0x9D, 0x3D, 0x93, 0xAD, 0x29, 0xD4,
+    0xDA, 0x2E, 0x4D, 0xA2, 0xE3, 0x9D, 0x91, 0x9D, 0xA3, 0xAD, 0x10, 0x77, 0x09, 0xAA, 0x69, 0xE6,
+    0xE6, 0xAE, 0x6D, 0x96, 0xF5, 0xAD, 0x69, 0xF9, 0x4E, 0x6A, 0xFA, 0x4D, 0xA6, 0xDA, 0xE3, 0xAD,
+    0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D, 0xA6, 0xE0, 0x9D, 0x91, 0xAD, 0x69, 0xDA, 0x1D,
+    0xA1, 0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E, 0x2A, 0xD0, 0xAD, 0x95, 0xAE, 0x2A, 0xD9, 0xE6, 0xEA,
+    0x29, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A, 0xE4, 0xFC, 0x6F, 0x4A, 0xEA, 0x77, 0xF9, 0x76, 0xAF,
+    0x74, 0x9A, 0xFC, 0x74, 0xAF, 0xA9, 0x75, 0xA9, 0x97, 0x40, 0x4A, 0x19, 0xAA, 0x95, 0xAF, 0xE9,
+    0x4E, 0xA1, 0x9D, 0x4D, 0x93, 0xD3, 0xAD, 0x4D, 0x3D, 0x93, 0x9D, 0x3D, 0x4D, 0xA2, 0xAD, 0x4D,
+    0x92, 0xE3, 0x9D, 0x3D, 0xA3, 0xAD, 0x2A, 0xD9, 0x3E, 0x2E, 0x39, 0xDA, 0x71, 0xAD, 0x97, 0xAA,
+    0xE7, 0xAF, 0x97, 0x70, 0x71, 0x99, 0x99, 0xAA, 0xAA, 0x73, 0xFF, 0xC7, 0x77, 0x77, 0x77, 0x77,
+    0x2A, 0xFC, 0xA7, 0x3A, 0xFF, 0xC9, 0x70, 0xEA, 0x92, 0xAE, 0x7E, 0xA5, 0xE9, 0x5E, 0x96, 0x9D,
+    0xA4, 0x9D, 0xA7, 0x0D, 0xA4, 0xE7, 0x1D, 0xA4, 0xD9, 0x71, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA,
+    0x71, 0xAD, 0x4D, 0xA7, 0x1D, 0xA4, 0xDA, 0x70, 0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA,
+    0xF9, 0x5F, 0xFF, 0xCA, 0x6A, 0xFF, 0xF7, 0x0F, 0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x5A,
+    0xAA, 0xAF, 0x5A, 0xFC, 0xAA, 0xA7, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xEA, 0x7A, 0xFD, 0xA5, 0xAC,
+    0xA3, 0xD4, 0xAC, 0xA4, 0x9C, 0xA3, 0xD5, 0x9C, 0x92, 0x9C, 0xA5, 0xAC, 0x92, 0xAC, 0x95, 0xD3,
+    0xAC, 0x94, 0x9C, 0xA3, 0xAD, 0x3A, 0xD9, 0x39, 0xFF, 0xA5, 0xFE, 0xA7, 0xAE, 0xA6, 0x77, 0x76,
+    0xC4, 0x9C, 0x74, 0xCA, 0x29, 0xC9, 0x74, 0xFD, 0x97, 0x6A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x75,
+    0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA,
+    0x49, 0xDA, 0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7,
+    0x1A, 0xD4, 0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF,
+    0x95, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x77,
+    0x4C, 0x94, 0xC6, 0xD2, 0x9C, 0xA6, 0xAF, 0xCA, 0x70, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0x9A, 0xEA, 0x7A, 0xFD, 0xA5, 0xAC, 0xA3, 0xD4, 0xAC, 0xA4, 0x9C, 0xA3, 0xD5, 0x9C, 0x92, 0x9C,
+    0xA5, 0xAC, 0x92, 0xAC, 0x95, 0xD3, 0xAC, 0x94, 0x9C, 0xA3, 0xAD, 0x3A, 0xD9, 0x39, 0xFF, 0xA5,
+    0xFE, 0xA7, 0xAE, 0xA6, 0x77, 0x75, 0xAC, 0xA5, 0xD7, 0x0A, 0xD4, 0x9D, 0x97, 0xAC, 0xA4, 0x9C,
+    0xA9, 0x77, 0x77, 0x77, 0x77, 0x71, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7,
+    0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D,
+    0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E,
+    0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72,
+    0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x5A, 0xA5, 0x9A, 0x94, 0xD9, 0x49, 0xD4, 0xDA, 0x4A, 0xD4, 0x99,
+    0x69, 0x77, 0x77, 0x77, 0x77, 0x74, 0x9A, 0xEA, 0x71, 0xAF, 0xDA, 0x7A, 0xCA, 0x3D, 0x6A, 0xCA,
+    0x49, 0xCA, 0x5D, 0x59, 0xC9, 0x49, 0xCA, 0x5A, 0xC9, 0x4A, 0xC9, 0x5D, 0x5A, 0xC9, 0x49, 0xCA,
+    0x5A, 0xD3, 0xAD, 0x95, 0x9F, 0xFA, 0x7F, 0xEA, 0x71, 0xAE, 0xA7, 0x00, 0x77, 0x77, 0x4A, 0xFC,
+    0x99, 0xFF, 0xD7, 0xAF, 0xFF, 0xFD, 0xA6, 0xF9, 0x2A, 0xEA, 0x99, 0x99, 0x71, 0xEA, 0x5E, 0x97,
+    0x4E, 0x96, 0x9D, 0xA7, 0x39, 0xDA, 0x7A, 0xDA, 0x73, 0xE7, 0x0E, 0xA7, 0x3D, 0x97, 0x9E, 0xA9,
+    0x99, 0x96, 0xAD, 0x70, 0xAF, 0xEA, 0x6D, 0xA7, 0x0F, 0xF9, 0x6D, 0xA7, 0x0E, 0xA7, 0x3D, 0xA7,
+    0x9E, 0x97, 0x3E, 0x7F, 0x74, 0xFA, 0x99, 0x99, 0xAF, 0x97, 0x4F, 0xFF, 0xDA, 0xAA, 0xAA, 0xAA,
+    0x6A, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0x09, 0xAF, 0xCA, 0xFF, 0xE4, 0x77, 0x99, 0x70, 0x9A,
+    0xEA, 0x2A, 0xFA, 0x5A, 0xFE, 0x0D, 0xA2, 0xCA, 0x3A, 0xCA, 0x3F, 0x49, 0xC2, 0xAC, 0xA4, 0x9D,
+    0x39, 0x9A, 0xC2, 0xD5, 0x9F, 0xFD, 0x19, 0xCA, 0x5A, 0xEA, 0xAA, 0x99, 0x99, 0x1A, 0xC9, 0x5D,
+    0x72, 0xAC, 0x94, 0x9D, 0x72, 0xAD, 0x3A, 0xF7, 0x19, 0xFF, 0xFF, 0xC9, 0x3F, 0xE9, 0x0F, 0xF9,
+    0x4A, 0xEA, 0x3A, 0xFA, 0x92, 0x77, 0x74, 0xAC, 0x74, 0x9C, 0x97, 0x4C, 0xA7, 0x4D, 0x77, 0x77,
+    0x70, 0x9F, 0xCA, 0x97, 0xAF, 0xE9, 0x6C, 0xA3, 0x9D, 0x59, 0xC9, 0x4D, 0x5A, 0xC5, 0xD5, 0xD5,
+    0xD4, 0x9C, 0xA4, 0xDA, 0x4A, 0xC9, 0x29, 0xE9, 0x4F, 0xFC, 0x94, 0x9F, 0xF6, 0xAF, 0xFA, 0x5E,
+    0x92, 0xAD, 0x49, 0xE3, 0x9D, 0x4A, 0xDA, 0x39, 0xD9, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE9, 0x2A,
+    0xE3, 0x9E, 0x92, 0xEA, 0x3F, 0x91, 0x70, 0xC9, 0x7D, 0x7A, 0xC7, 0x9C, 0xA7, 0x77, 0x49, 0x91,
+    0x99, 0x39, 0xCA, 0xAE, 0x3A, 0xFD, 0x3E, 0xA6, 0xD9, 0x6A, 0xD7, 0xDA, 0x7D, 0x96, 0xAD, 0x7E,
+    0x69, 0xE6, 0xAD, 0xA5, 0x59, 0xFC, 0xA9, 0x7A, 0xFE, 0x96, 0xCA, 0x39, 0xD5, 0x9C, 0x94, 0xD5,
+    0xAC, 0x5D, 0x5D, 0x5D, 0x49, 0xCA, 0x4D, 0xA4, 0xAC, 0x92, 0x9E, 0x94, 0xFF, 0xC9, 0x49, 0xFF,
+    0x6A, 0xFF, 0xA5, 0xE9, 0x2A, 0xD4, 0x9E, 0x39, 0xD4, 0xAD, 0xA3, 0x9D, 0x93, 0xE9, 0x3E, 0x92,
+    0x9E, 0x4E, 0x92, 0xAE, 0x39, 0xE9, 0x2E, 0xA3, 0xF9, 0x77, 0x77, 0x77, 0x77, 0x70, 0xE7, 0x3A,
+    0xDA, 0x73, 0xE7, 0x39, 0xDA, 0x73, 0xE7, 0x39, 0xD9, 0x70, 0x59, 0x91, 0x99, 0x49, 0xCA, 0xAE,
+    0x4A, 0xFD, 0x4E, 0xA7, 0xD9, 0x7A, 0xD7, 0x0D, 0xA7, 0x0D, 0x97, 0xAD, 0x70, 0xE7, 0x9E, 0x7A,
+    0xDA, 0x77, 0x77, 0x77, 0x77, 0x4E, 0x96, 0x9E, 0x7E, 0x97, 0xE7, 0xE7, 0x9D, 0xA7, 0x79, 0x49,
+    0x70, 0xCA, 0x2C, 0xA7, 0x1D, 0xAC, 0x97, 0x29, 0xD7, 0x5A, 0x77, 0x77, 0x72, 0x9F, 0xCA, 0x97,
+    0xAF, 0xE9, 0x6C, 0xA3, 0x9D, 0x59, 0xC9, 0x4D, 0x5A, 0xC5, 0xD5, 0xD5, 0xD4, 0x9C, 0xA4, 0xDA,
+    0x4A, 0xC9, 0x29, 0xE9, 0x4F, 0xFC, 0x94, 0x9F, 0xF6, 0xAF, 0xFA, 0x5E, 0x92, 0xAD, 0x49, 0xE3,
+    0x9D, 0x4A, 0xDA, 0x39, 0xD9, 0x3E, 0x93, 0xE9, 0x29, 0xE4, 0xE9, 0x2A, 0xE3, 0x9E, 0x92, 0xEA,
+    0x3F, 0x91, 0x29, 0x59, 0x39, 0xC2, 0x9C, 0x94, 0xAC, 0x9D, 0x7D, 0xA7, 0x09, 0xA7, 0x75, 0x99,
+    0x19, 0x94, 0x9C, 0xAA, 0xE4, 0xAF, 0xD4, 0xEA, 0x7D, 0x97, 0xAD, 0x70, 0xDA, 0x70, 0xD9, 0x7A,
+    0xD7, 0x0E, 0x79, 0xE7, 0xAD, 0xA6, 0x77, 0x77, 0x9C, 0x76, 0x9C, 0x97, 0x6D, 0x76, 0xD7, 0x77,
+    0x77, 0x77, 0x77, 0x74, 0xAF, 0xCA, 0xA7, 0xAF, 0xFA, 0x6A, 0xFA, 0xAA, 0xAA, 0x95, 0x9E, 0x97,
+    0x4A, 0xD7, 0x6D, 0x97, 0x6D, 0xA7, 0x6F, 0xCA, 0x97, 0x29, 0xFE, 0xA7, 0x29, 0xFE, 0x97, 0x39,
+    0xAF, 0x75, 0xFA, 0x74, 0xFA, 0x39, 0x94, 0x9F, 0xC9, 0x2A, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x29,
+    0xFF, 0xFA, 0x49, 0xAF, 0xDA, 0xA9, 0x77, 0x70, 0x70, 0xAC, 0x70, 0x9C, 0x71, 0xCA, 0x70, 0xD7,
+    0x77, 0x77, 0x77, 0x9F, 0xA9, 0x3E, 0xAA, 0xAA, 0x3A, 0xC7, 0x1C, 0xA7, 0x1D, 0xA7, 0x09, 0xF9,
+    0x69, 0xAF, 0x70, 0x9D, 0x92, 0x99, 0x29, 0xD9, 0x1A, 0xFF, 0x19, 0xFF, 0x92, 0xAF, 0xCA, 0x92,
+    0x77, 0x76, 0xD7, 0x79, 0xDA, 0x76, 0xCA, 0x0A, 0xC7, 0x4C, 0x93, 0xA9, 0x77, 0x77, 0x77, 0xAF,
+    0xCA, 0xA7, 0x0A, 0xFF, 0xA7, 0xAF, 0xAA, 0xAA, 0xA9, 0x69, 0xE9, 0x75, 0xAD, 0x77, 0xD9, 0x77,
+    0xDA, 0x77, 0xFC, 0xA9, 0x73, 0x9F, 0xEA, 0x73, 0x9F, 0xE9, 0x74, 0x9A, 0xF7, 0x6F, 0xA7, 0x5F,
+    0xA4, 0x99, 0x49, 0xFC, 0x93, 0xAF, 0xFF, 0xC3, 0xAF, 0xFF, 0xC3, 0x9F, 0xFF, 0xA5, 0x9A, 0xFD,
+    0xAA, 0x97, 0x77, 0x10, 0x6C, 0xA7, 0x1A, 0xD9, 0x79, 0xCA, 0x9C, 0xA6, 0xC9, 0x2A, 0xC7, 0x77,
+    0x79, 0xFA, 0x94, 0xEA, 0xAA, 0xA4, 0xAC, 0x72, 0xCA, 0x72, 0xDA, 0x71, 0x9F, 0x97, 0x9A, 0xF7,
+    0x19, 0xD9, 0x39, 0x92, 0x9D, 0x92, 0xAF, 0xF2, 0x9F, 0xF9, 0x3A, 0xFC, 0xA9, 0x30, 0x70, 0xAF,
+    0xCA, 0xA7, 0xAF, 0xFA, 0x6A, 0xFA, 0xAA, 0xAA, 0x95, 0x9E, 0x97, 0x4A, 0xD7, 0x6D, 0x97, 0x6D,
+    0xA7, 0x6F, 0xCA, 0x97, 0x29, 0xFE, 0xA7, 0x29, 0xFE, 0x97, 0x39, 0xAF, 0x75, 0xFA, 0x74, 0xFA,
+    0x39, 0x94, 0x9F, 0xC9, 0x2A, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC, 0x29, 0xFF, 0xFA, 0x49, 0xFF, 0xA9,
+    0x73, 0x99, 0x77, 0xAA, 0xA7, 0x70, 0x99, 0x76, 0x9C, 0x75, 0xDA, 0x97, 0x00, 0x49, 0xFA, 0x93,
+    0xEA, 0xAA, 0xA3, 0xAC, 0x71, 0xCA, 0x71, 0xDA, 0x70, 0x9F, 0x96, 0x9A, 0xF7, 0x09, 0xD9, 0x29,
+    0x92, 0x9D, 0x91, 0xAF, 0xF1, 0x9F, 0xF9, 0x2A, 0xFC, 0xA9, 0x6A, 0x71, 0x9A, 0x97, 0x3A, 0x71,
+    0xAA, 0x69, 0xDA, 0x77, 0x10, 0x70, 0xA4, 0xA9, 0x71, 0xAC, 0x19, 0xC9, 0x73, 0xF7, 0x6D, 0x77,
+    0x97, 0x77, 0x77, 0x77, 0x74, 0xAF, 0xCA, 0xA7, 0xAF, 0xFA, 0x6A, 0xFA, 0xAA, 0xAA, 0x95, 0x9E,
+    0x97, 0x4A, 0xD7, 0x6D, 0x97, 0x6D, 0xA7, 0x6F, 0xCA, 0x97, 0x29, 0xFE, 0xA7, 0x29, 0xFE, 0x97,
+    0x39, 0xAF, 0x75, 0xFA, 0x74, 0xFA, 0x39, 0x94, 0x9F, 0xC9, 0x2A, 0xFF, 0xFC, 0x2A, 0xFF, 0xFC,
+    0x29, 0xFF, 0xFA, 0x49, 0xAF, 0xDA, 0xA9, 0x77, 0x70, 0x71, 0x94, 0xC9, 0x2C, 0x94, 0x9C, 0xAA,
+    0xC9, 0x6A, 0xD7, 0x1A, 0x77, 0x77, 0x75, 0x9F, 0xA9, 0x3E, 0xAA, 0xAA, 0x3A, 0xC7, 0x1C, 0xA7,
+    0x1D, 0xA7, 0x09, 0xF9, 0x69, 0xAF, 0x70, 0x9D, 0x92, 0x99, 0x29, 0xD9, 0x1A, 0xFF, 0x19, 0xFF,
+    0x92, 0xAF, 0xCA, 0x92, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1, 0xFF,
+    0xFD, 0xA1, 0x94, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7, 0x5E,
+    0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0x9E,
+    0x76, 0xA7, 0x7A, 0xAA, 0x76, 0x9A, 0x74, 0xE9, 0x71, 0x76, 0xAC, 0x6A, 0xCA, 0x6D, 0x94, 0x99,
+    0xD9, 0x99, 0x1F, 0xF3, 0xD9, 0x6D, 0x6A, 0xD6, 0xD9, 0x6D, 0x6A, 0xD6, 0xDA, 0x6F, 0xA9, 0x29,
+    0xFC, 0xA2, 0x9F, 0xC9, 0x49, 0xA9, 0x71, 0xA7, 0xA9, 0x49, 0xDA, 0x40, 0x49, 0xA3, 0x9A, 0x71,
+    0xD0, 0x9C, 0xA7, 0x3E, 0x97, 0x4A, 0xC9, 0x77, 0x77, 0x72, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x1A, 0xFF, 0xFD, 0x1F, 0xFF, 0xDA, 0x19, 0x4D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA7,
+    0x49, 0xD9, 0x74, 0xAD, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0x97, 0x4E, 0x75, 0xE7, 0x4A, 0xDA,
+    0x74, 0xE9, 0x74, 0xE7, 0x49, 0xE7, 0x20, 0x71, 0x99, 0x71, 0xCA, 0x70, 0x9C, 0x94, 0xAC, 0x1D,
+    0x4A, 0xCA, 0x09, 0xCA, 0x4D, 0x96, 0x99, 0xD9, 0x99, 0x3F, 0xF5, 0xD9, 0x70, 0xD7, 0x0A, 0xD7,
+    0x0D, 0x97, 0x0D, 0x70, 0xAD, 0x70, 0xDA, 0x70, 0xFA, 0x94, 0x9F, 0xCA, 0x49, 0xFC, 0x94, 0x19,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1, 0xFF, 0xFD, 0xA1, 0x94, 0xD9, 0x74,
+    0x9D, 0x75, 0xE7, 0x5D, 0x97, 0x49, 0xD7, 0x2F, 0xFC, 0x69, 0xFF, 0xC7, 0x1A, 0xDA, 0x74, 0xAD,
+    0x97, 0x4E, 0x74, 0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74, 0xAE, 0x72, 0x77, 0x2A, 0xC7,
+    0x0A, 0xCA, 0x70, 0xD9, 0x69, 0x9D, 0x99, 0x93, 0xFF, 0x5D, 0x97, 0x9D, 0x5F, 0xFC, 0x91, 0xFF,
+    0xC5, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x0F, 0xA9, 0x49, 0xFC, 0xA4, 0x9F, 0xC9, 0x20, 0x71, 0xAC,
+    0x91, 0x9A, 0x72, 0x9C, 0x0C, 0x1A, 0x97, 0x2C, 0x90, 0xAA, 0x9C, 0x73, 0xC2, 0xD9, 0x77, 0x77,
+    0x77, 0x77, 0x9A, 0xAA, 0x6A, 0xAA, 0x93, 0xAD, 0xA6, 0xE9, 0x3E, 0x95, 0x9E, 0x4E, 0x6A, 0xDA,
+    0x39, 0xE6, 0xE9, 0x3A, 0xD9, 0x6E, 0x4E, 0x69, 0xE4, 0xE6, 0x9D, 0x93, 0x9D, 0xA6, 0xAD, 0x49,
+    0xD9, 0x6E, 0x4A, 0xD6, 0x9D, 0xA4, 0xE6, 0xAD, 0x5D, 0xA6, 0xE4, 0x9E, 0x49, 0xE9, 0x49, 0xFF,
+    0xF5, 0x9F, 0xFE, 0xA6, 0xFF, 0xE7, 0x9F, 0xFA, 0x77, 0x71, 0x77, 0x2A, 0xCA, 0x19, 0xA4, 0xAC,
+    0x0C, 0x90, 0xC9, 0x4C, 0x91, 0xDA, 0x77, 0x77, 0x72, 0xD4, 0x9D, 0x19, 0xD4, 0xAC, 0xA1, 0x9C,
+    0xA4, 0xD9, 0x1A, 0xC9, 0x4D, 0x2D, 0x49, 0xD2, 0xD4, 0xAC, 0xA1, 0x9D, 0x4D, 0x91, 0x9C, 0xA3,
+    0xAD, 0x2A, 0xEA, 0xFC, 0x2A, 0xFF, 0xC2, 0x9F, 0xFA, 0x3A, 0xEA, 0x0D, 0x91, 0x70, 0x99, 0x99,
+    0xAA, 0xAA, 0x71, 0xAF, 0xF7, 0x77, 0x77, 0x77, 0x69, 0xAA, 0xA6, 0xAA, 0xA9, 0x3A, 0xDA, 0x6E,
+    0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE6, 0x9E, 0x4E,
+    0x69, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xDA, 0x4E, 0x6A, 0xD5, 0xDA,
+    0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7, 0x77,
+    0x10, 0x49, 0x99, 0x9A, 0xAA, 0xA4, 0xAF, 0xF9, 0x77, 0x77, 0x74, 0xD4, 0x9D, 0x29, 0xD4, 0xAC,
+    0xA2, 0x9C, 0xA4, 0xD9, 0x2A, 0xC9, 0x4D, 0x3D, 0x49, 0xD3, 0xD4, 0xAC, 0xA2, 0x9D, 0x4D, 0x92,
+    0x9C, 0xA3, 0xAD, 0x3A, 0xEA, 0xFC, 0x3A, 0xFF, 0xC3, 0x9F, 0xFA, 0x4A, 0xEA, 0x0D, 0x92, 0x77,
+    0x73, 0xC9, 0x4C, 0x72, 0xD2, 0x9C, 0xA7, 0x2A, 0xFC, 0xA7, 0x4A, 0xE9, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x39, 0xE6, 0xEA, 0x3A, 0xDA, 0x6E, 0x4E, 0x95, 0x9E, 0x4E, 0x6A, 0xDA, 0x39, 0xDA, 0x6E,
+    0x93, 0xAD, 0x96, 0xE4, 0xE6, 0x9D, 0xA4, 0xE6, 0xAD, 0x93, 0x9D, 0xA6, 0xE4, 0xAD, 0x7E, 0x4A,
+    0xD6, 0x9D, 0x94, 0xE6, 0xAD, 0x5D, 0xA6, 0xE4, 0x9E, 0x49, 0xE9, 0x49, 0xFF, 0xF5, 0x9F, 0xFE,
+    0xA6, 0xFF, 0xE7, 0x9F, 0xFA, 0x77, 0x71, 0x77, 0x2C, 0x94, 0xC5, 0xD2, 0x9C, 0xA5, 0xAF, 0xCA,
+    0x7A, 0xE9, 0x77, 0x77, 0x77, 0xD4, 0x9D, 0x29, 0xD4, 0xAC, 0xA2, 0x9C, 0xA4, 0xD9, 0x2A, 0xC9,
+    0x4D, 0x3D, 0x49, 0xD3, 0xD4, 0xAC, 0xA2, 0x9D, 0x4D, 0x92, 0x9C, 0xA3, 0xAD, 0x3A, 0xEA, 0xFC,
+    0x3A, 0xFF, 0xC3, 0x9F, 0xFA, 0x4A, 0xEA, 0x0D, 0x92, 0x73, 0xAC, 0xA7, 0x69, 0xA0, 0x99, 0x75,
+    0xA1, 0xA9, 0x75, 0x9D, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9D, 0xA6, 0xAD, 0x93, 0xAD, 0xA6,
+    0xE9, 0x3E, 0x95, 0x9E, 0x4E, 0x6A, 0xDA, 0x39, 0xE6, 0xE9, 0x3A, 0xD9, 0x6E, 0x4E, 0x69, 0xDA,
+    0x4E, 0x6A, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xD9, 0x4E, 0x6A, 0xD5,
+    0xDA, 0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7,
+    0x77, 0x10, 0x70, 0xA9, 0x71, 0xC0, 0x99, 0x7A, 0x90, 0x9A, 0x7A, 0x99, 0xC7, 0x1D, 0x97, 0x77,
+    0x77, 0x3D, 0x49, 0xD1, 0x9D, 0x4A, 0xCA, 0x19, 0xCA, 0x4D, 0x91, 0xAC, 0x94, 0xD2, 0xD4, 0x9D,
+    0x2D, 0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x19, 0xCA, 0x3A, 0xD2, 0xAE, 0xAF, 0xC2, 0xAF, 0xFC, 0x29,
+    0xFF, 0xA3, 0xAE, 0xA0, 0xD9, 0x10, 0x70, 0x99, 0x69, 0x97, 0xAC, 0xA4, 0x9D, 0x7D, 0xA4, 0x9D,
+    0x96, 0x99, 0x95, 0xA9, 0x97, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xAA, 0x6A, 0xAA, 0x94, 0xAD, 0xA6,
+    0xE9, 0x4E, 0x95, 0x9E, 0x5E, 0x6A, 0xDA, 0x49, 0xE6, 0xE9, 0x4A, 0xD9, 0x6E, 0x5E, 0x69, 0xE5,
+    0xE6, 0x9D, 0x94, 0x9D, 0xA6, 0xAD, 0x59, 0xD9, 0x6E, 0x5A, 0xD6, 0x9D, 0x95, 0xE6, 0xAD, 0x6D,
+    0xA6, 0xE5, 0x9E, 0x49, 0xE9, 0x59, 0xFF, 0xF6, 0x9F, 0xFE, 0xA7, 0xFF, 0xE7, 0x09, 0xFF, 0xA7,
+    0x77, 0x30, 0x77, 0x39, 0xD5, 0xD9, 0x29, 0xD5, 0xDA, 0x29, 0xCA, 0x94, 0xDA, 0x77, 0x77, 0x77,
+    0x4D, 0x49, 0xD4, 0x9D, 0x4A, 0xCA, 0x49, 0xCA, 0x4D, 0x94, 0xAC, 0x94, 0xD5, 0xD4, 0x9D, 0x5D,
+    0x4A, 0xCA, 0x49, 0xD4, 0xD9, 0x49, 0xCA, 0x3A, 0xD5, 0xAE, 0xAF, 0xC5, 0xAF, 0xFC, 0x59, 0xFF,
+    0xA6, 0xAE, 0xA0, 0xD9, 0x40, 0x39, 0xAA, 0xA6, 0xAA, 0xA9, 0x3A, 0xDA, 0x6E, 0x93, 0xE9, 0x59,
+    0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE6, 0x9E, 0x4E, 0x69, 0xD9, 0x39,
+    0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xD9, 0x4E, 0x6A, 0xD5, 0xDA, 0x6E, 0x49, 0xE4,
+    0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF, 0xA7, 0x6C, 0x97, 0x7C, 0x97,
+    0x70, 0xC9, 0x97, 0x79, 0xD9, 0x77, 0x72, 0x2D, 0x49, 0xD1, 0x9D, 0x4A, 0xCA, 0x19, 0xCA, 0x4D,
+    0x91, 0xAC, 0x94, 0xD2, 0xD4, 0x9D, 0x2D, 0x4A, 0xCA, 0x19, 0xD4, 0xD9, 0x19, 0xCA, 0x3A, 0xD2,
+    0xAE, 0xAF, 0xC2, 0xAF, 0xFC, 0x29, 0xFF, 0xA3, 0xAE, 0xA9, 0xD9, 0x79, 0xCA, 0x70, 0x9C, 0x97,
+    0x1A, 0xA7, 0x29, 0xDA, 0x72, 0x94, 0x72, 0xD7, 0x74, 0x9D, 0xA7, 0x73, 0xCA, 0x0A, 0xC7, 0x71,
+    0xCA, 0x29, 0xC9, 0x77, 0x77, 0x9D, 0x97, 0x6A, 0xD1, 0x9D, 0x97, 0x6D, 0xA1, 0x9D, 0x97, 0x5A,
+    0xD2, 0xAD, 0x97, 0x5D, 0xA2, 0xAD, 0x75, 0xAD, 0x3A, 0xD4, 0x9D, 0x94, 0xDA, 0x3A, 0xD4, 0xE9,
+    0x3E, 0x4A, 0xD3, 0xFA, 0x29, 0xDA, 0x4E, 0x2A, 0xFC, 0x2E, 0x5E, 0x19, 0xFD, 0x19, 0xDA, 0x5E,
+    0x1E, 0x9E, 0x90, 0xE6, 0xE0, 0xEA, 0x0A, 0xD9, 0x9D, 0xA6, 0xEA, 0xE1, 0xAD, 0xAE, 0x7F, 0xD9,
+    0x19, 0xFC, 0xA7, 0xFC, 0xA2, 0x9F, 0xC7, 0x0F, 0xC3, 0x9F, 0xA7, 0x0F, 0x94, 0xF7, 0x1E, 0xA5,
+    0xEA, 0x70, 0x77, 0x79, 0xC9, 0x75, 0xE9, 0x73, 0xAC, 0x09, 0xCA, 0x71, 0x9C, 0x3A, 0xA7, 0x75,
+    0x99, 0x72, 0x99, 0x1D, 0x97, 0x0A, 0xD1, 0xD9, 0x70, 0xD9, 0x1D, 0x97, 0xAC, 0xA2, 0xD9, 0x1A,
+    0xCA, 0x2D, 0x3D, 0x90, 0xAE, 0x1A, 0xCA, 0x3D, 0x9A, 0xFA, 0x0D, 0x4F, 0xFE, 0xA4, 0xFF, 0xE5,
+    0xFA, 0x0F, 0xA5, 0xEA, 0x1F, 0x6E, 0x2A, 0xD9, 0x50, 0x77, 0x49, 0xC9, 0x73, 0xE9, 0x71, 0xAC,
+    0x99, 0xCA, 0x79, 0xC3, 0x9A, 0x77, 0x2D, 0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD,
+    0x4A, 0xD9, 0x29, 0xDA, 0x29, 0xDA, 0x4E, 0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79,
+    0xFC, 0x71, 0xF7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A,
+    0xEA, 0x71, 0x77, 0x70, 0xCA, 0x74, 0xAD, 0xA7, 0x29, 0xC9, 0x0A, 0xC7, 0x1C, 0x92, 0x9C, 0x97,
+    0x77, 0x74, 0xD6, 0xD4, 0xAC, 0x94, 0xAC, 0x94, 0x9D, 0x4D, 0x6D, 0x3D, 0x96, 0xD9, 0x19, 0xD7,
+    0xAC, 0xA1, 0xDA, 0x7A, 0xD0, 0x9D, 0x70, 0x9D, 0x9D, 0xA7, 0x1F, 0xC7, 0x2F, 0xA7, 0x2A, 0xE7,
+    0x3A, 0xDA, 0x73, 0xE7, 0x3A, 0xDA, 0x71, 0x9F, 0x79, 0xFD, 0x70, 0xAF, 0xA7, 0x1A, 0xAA, 0x97,
+    0x30, 0x59, 0x92, 0x99, 0x6A, 0xD2, 0xDA, 0x5D, 0xA1, 0x9D, 0x94, 0xAD, 0xA1, 0xE9, 0x77, 0x77,
+    0x76, 0xD9, 0x7D, 0x90, 0xDA, 0x6D, 0xA1, 0xE5, 0xAD, 0x2A, 0xD4, 0xAD, 0x92, 0x9D, 0xA2, 0x9D,
+    0xA4, 0xE2, 0xE5, 0xE1, 0xE6, 0xE9, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x72, 0xE9, 0x71,
+    0x9E, 0x72, 0xAD, 0xA7, 0x2E, 0x97, 0x1A, 0xE7, 0x2F, 0x71, 0xAE, 0xA7, 0x10, 0x76, 0x9C, 0x77,
+    0x2C, 0x97, 0x71, 0xD7, 0x71, 0xAC, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xFF, 0xA6, 0x9F, 0xFF,
+    0x97, 0xFF, 0xF7, 0x79, 0xEA, 0x76, 0xAE, 0xA7, 0x6F, 0x97, 0x6F, 0x97, 0x59, 0xF9, 0x75, 0xAF,
+    0x76, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xA7, 0x59, 0xFA, 0x75, 0xAF, 0xA7, 0x5F, 0xD9, 0x99, 0x99,
+    0x99, 0x95, 0x9F, 0xFF, 0xD9, 0x4A, 0xFF, 0xFD, 0x94, 0xFF, 0xFE, 0x93, 0x73, 0xCA, 0x73, 0xAC,
+    0x73, 0x9C, 0x97, 0x3C, 0xA7, 0x77, 0x77, 0x77, 0x73, 0x9F, 0xF9, 0x4A, 0xFF, 0x72, 0x9D, 0x97,
+    0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0xA7, 0x1E, 0x97, 0x1F, 0xAA, 0xAA,
+    0x94, 0x9F, 0xFC, 0x4F, 0xFD, 0x92, 0x74, 0xAD, 0x77, 0x1D, 0xA7, 0x70, 0xAD, 0xA7, 0x70, 0x99,
+    0x97, 0x77, 0x77, 0x76, 0x9F, 0xFF, 0xA6, 0x9F, 0xFF, 0x97, 0xFF, 0xF7, 0x79, 0xEA, 0x76, 0xAE,
+    0xA7, 0x6F, 0x97, 0x6F, 0x97, 0x59, 0xF9, 0x75, 0xAF, 0x76, 0xAF, 0x76, 0xFC, 0x75, 0x9F, 0xA7,
+    0x59, 0xFA, 0x75, 0xAF, 0xA7, 0x5F, 0xD9, 0x99, 0x99, 0x99, 0x95, 0x9F, 0xFF, 0xD9, 0x4A, 0xFF,
+    0xFD, 0x94, 0xFF, 0xFE, 0x93, 0x71, 0x99, 0x74, 0xD9, 0x72, 0xAD, 0x73, 0xE7, 0x77, 0x77, 0x74,
+    0x9F, 0xF9, 0x4A, 0xFF, 0x72, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xDA, 0x71,
+    0xAD, 0xA7, 0x1E, 0x97, 0x1F, 0xAA, 0xAA, 0x94, 0x9F, 0xFC, 0x4F, 0xFD, 0x92, 0x71, 0xC4, 0xA7,
+    0x59, 0xC9, 0x0A, 0xC7, 0x7A, 0xDA, 0x77, 0x1C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x49, 0xFF, 0xFA,
+    0x69, 0xFF, 0xF9, 0x7F, 0xFF, 0x77, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x75, 0x9F,
+    0x97, 0x5A, 0xF7, 0x6A, 0xF7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xFD,
+    0x99, 0x99, 0x99, 0x99, 0x59, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xE9, 0x30, 0x74,
+    0x96, 0x9C, 0x29, 0xC9, 0x7A, 0xC9, 0xAC, 0x72, 0xE7, 0x39, 0xA7, 0x77, 0x77, 0x76, 0x9F, 0xF9,
+    0x4A, 0xFF, 0x72, 0x9D, 0x97, 0x1A, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x19, 0xDA, 0x71, 0xAD, 0xA7,
+    0x1E, 0x97, 0x1F, 0xAA, 0xAA, 0x94, 0x9F, 0xFC, 0x4F, 0xFD, 0x92, 0x6A, 0xD9, 0x49, 0xDA, 0xC9,
+    0x4D, 0x7A, 0xC9, 0x7D, 0x79, 0xCA, 0x7A, 0xC9, 0x7D, 0x70, 0xD7, 0xAC, 0xA7, 0xD9, 0x7D, 0x79,
+    0xD7, 0xAD, 0x7D, 0xA6, 0x9D, 0x96, 0xAD, 0x70, 0x77, 0x77, 0x77, 0x9C, 0x70, 0xAF, 0xCA, 0x6A,
+    0xA6, 0xAF, 0xFC, 0x93, 0x9C, 0x95, 0xEA, 0x92, 0xAE, 0x29, 0xCA, 0x5E, 0xA5, 0xE9, 0x1C, 0xA5,
+    0xE9, 0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x0D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xD9, 0x71, 0xD9, 0x7A,
+    0xD7, 0x2D, 0x97, 0xDA, 0x71, 0xAD, 0x70, 0xDA, 0x71, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x97, 0x0E,
+    0x7A, 0xE7, 0x1F, 0xAA, 0x99, 0xAA, 0xF9, 0x71, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xF7, 0x4F, 0xFD,
+    0xA7, 0x69, 0xAF, 0xCA, 0x77, 0x77, 0x50, 0x75, 0xA5, 0x9A, 0xEA, 0x2C, 0x4A, 0xFE, 0x0A, 0xA3,
+    0xAC, 0xA3, 0xF3, 0xAC, 0xA4, 0x9C, 0xA4, 0xD5, 0x9C, 0xA3, 0x9C, 0xA5, 0xAC, 0x93, 0xAC, 0x95,
+    0xD4, 0xAC, 0x94, 0x9C, 0xA4, 0xAD, 0x3A, 0xD9, 0x49, 0xFF, 0xA6, 0xFE, 0xA7, 0x0A, 0xEA, 0x70,
+    0x49, 0xFE, 0xA9, 0x5F, 0xFE, 0x93, 0xAF, 0x4A, 0xD2, 0x9D, 0xAD, 0x5D, 0x2A, 0xC0, 0xDA, 0x5D,
+    0x2C, 0xA0, 0xD9, 0x4A, 0xCA, 0x2A, 0x09, 0xD3, 0x9A, 0xD9, 0x4A, 0xFF, 0xCA, 0x5F, 0xFC, 0x95,
+    0x9E, 0xAA, 0xA9, 0x70, 0xAD, 0x75, 0xE7, 0x49, 0xDA, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x39, 0xE7,
+    0x4A, 0xE7, 0x4E, 0xA7, 0x30, 0x77, 0x70, 0xE7, 0x4A, 0xDA, 0x74, 0xD7, 0x59, 0xC9, 0x0A, 0xDA,
+    0x70, 0xAC, 0x9F, 0xD7, 0xF9, 0x19, 0xC9, 0x59, 0xE4, 0xCA, 0x5A, 0xD9, 0x4C, 0xA5, 0xE5, 0xCA,
+    0x5E, 0x49, 0xC9, 0x49, 0xE4, 0xD5, 0xAE, 0x92, 0xAC, 0xA5, 0xFF, 0xD5, 0x9D, 0xAF, 0xD9, 0x5D,
+    0xA0, 0xFA, 0x69, 0xD7, 0x5E, 0x75, 0xD9, 0x74, 0xAD, 0x75, 0xD9, 0x77, 0x75, 0x49, 0x99, 0x99,
+    0x99, 0x99, 0x3A, 0xFF, 0x93, 0xAC, 0x74, 0xCA, 0x74, 0xC9, 0x73, 0x9C, 0x74, 0xAA, 0x74, 0xC7,
+    0x3C, 0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x97, 0x1D, 0x71, 0x9D, 0x99, 0x99, 0x99, 0x4F, 0xFC, 0x4F,
+    0xFC, 0x77, 0x10, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1, 0xFC, 0xAF,
+    0xFA, 0x1A, 0xC9, 0x19, 0xD9, 0x79, 0x92, 0xAD, 0x75, 0xE7, 0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xE7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x49, 0xE7, 0x4A, 0xDA, 0x74, 0xE9, 0x74, 0xE7,
+    0x4A, 0xE7, 0x20, 0x77, 0x19, 0xAC, 0x69, 0xDA, 0x6D, 0xA6, 0xD9, 0x6A, 0xCA, 0x7D, 0x95, 0x9A,
+    0xD9, 0x99, 0x2F, 0xF4, 0xD9, 0x7D, 0x7A, 0xD7, 0xD9, 0x7D, 0x7A, 0xD7, 0xDA, 0x7F, 0xA9, 0x39,
+    0xFC, 0xA3, 0x9F, 0xC9, 0x30, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1,
+    0xFF, 0xFD, 0xA1, 0x94, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74,
+    0x9E, 0x74, 0xAE, 0xA7, 0x39, 0xFC, 0x73, 0xAF, 0x75, 0xAC, 0xA7, 0x00, 0x77, 0x39, 0x49, 0xE6,
+    0xEA, 0x0A, 0x93, 0xAD, 0xA6, 0xE9, 0x9C, 0x4E, 0x95, 0x9F, 0xC9, 0x4E, 0x6A, 0xDA, 0x69, 0xDA,
+    0x6E, 0x96, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA7, 0xE6, 0xAD, 0x96, 0x9D, 0xA6, 0xE7, 0xAD, 0x7E,
+    0x7A, 0xD6, 0x9D, 0x97, 0xE6, 0xAD, 0x70, 0xDA, 0x6E, 0x79, 0xE4, 0x9E, 0x97, 0x9F, 0xFF, 0x70,
+    0x9F, 0xFE, 0xA7, 0x1F, 0xFE, 0x72, 0x9F, 0xFA, 0x77, 0x77, 0x77, 0x75, 0xC3, 0xD4, 0x9D, 0x9C,
+    0x29, 0xD4, 0xAE, 0x92, 0x9C, 0xA4, 0xE9, 0x3A, 0xC9, 0x4D, 0x5D, 0x49, 0xD5, 0xD4, 0xAC, 0xA4,
+    0x9D, 0x4D, 0x94, 0x9C, 0xA3, 0xAD, 0x5A, 0xEA, 0xFC, 0x5A, 0xFF, 0xC5, 0x9F, 0xFA, 0x6A, 0xEA,
+    0x0D, 0x94, 0x9D, 0x39, 0xD3, 0xAD, 0x60, 0x70, 0xCA, 0x2A, 0xC2, 0x9C, 0x92, 0xD2, 0x74, 0xD6,
+    0x9E, 0x5C, 0xA0, 0xAC, 0x92, 0xAA, 0x3A, 0x90, 0x09, 0xD2, 0xC1, 0xCA, 0x9A, 0x1C, 0x09, 0xC1,
+    0xC9, 0xAA, 0x0A, 0xA1, 0x9D, 0x72, 0x09, 0x99, 0x9A, 0xAA, 0xA9, 0x9F, 0xF9, 0x71, 0x59, 0x99,
+    0x99, 0x9A, 0x1A, 0xFF, 0xE9, 0x75, 0x72, 0xC9, 0x39, 0xC1, 0xD2, 0x9C, 0xA1, 0xAF, 0xCA, 0x3A,
+    0xDA, 0x92, 0x09, 0xD1, 0xE0, 0x9E, 0x09, 0x99, 0x90, 0x1D, 0x2A, 0xD0, 0xAD, 0x2D, 0xA0, 0xE1,
+    0x9D, 0xA0, 0x99, 0x91, 0x99, 0x90, 0x0A, 0xCA, 0xA3, 0x9C, 0x2A, 0xC3, 0xA2, 0x1A, 0xAA, 0x1A,
+    0x90, 0xA9, 0x0C, 0x1C, 0x1A, 0xD9, 0x60, 0x2A, 0xC9, 0x49, 0xD2, 0xDA, 0x49, 0xD2, 0xDA, 0x49,
+    0xD9, 0x77, 0x00, 0x0C, 0x92, 0x9C, 0x19, 0xC9, 0x0C, 0xA3, 0xAD, 0xA5, 0xCA, 0x74, 0x0A, 0xC9,
+    0x5D, 0x4D, 0xA4, 0x9D, 0x4D, 0xA4, 0xAD, 0x77, 0x0E, 0x3A, 0xDA, 0x3E, 0x3A, 0xD9, 0x3E, 0x3A,
+    0xDA, 0x2E, 0xA1, 0x9E, 0x2A, 0xD9, 0x2E, 0x2A, 0xD9, 0x2E, 0x20, 0x0E, 0xA3, 0x9E, 0x4E, 0x93,
+    0x9D, 0xA4, 0xAD, 0x94, 0xDA, 0x00, 0x29, 0x92, 0xC1, 0xE2, 0xAA, 0x29, 0x90, 0x0A, 0x3C, 0x92,
+    0xAD, 0xA0, 0x9C, 0x3A, 0x10, 0x0D, 0xAA, 0xA9, 0x99, 0x0A, 0xAA, 0xFA, 0x59, 0xC9, 0x5A, 0xC6,
+    0xD0, 0x5A, 0x91, 0xC0, 0x9C, 0x90, 0xA9, 0x10, 0x19, 0x1A, 0x91, 0xA2, 0xC9, 0x40, 0x1A, 0x29,
+    0xC9, 0x09, 0xE9, 0x29, 0xA0, 0xAA, 0x91, 0x9A, 0xD9, 0x1C, 0x3A, 0x10, 0x6A, 0x19, 0xAC, 0xA9,
+    0x1A, 0x60, 0x19, 0x99, 0xAA, 0xAA, 0x90, 0xFF, 0xA7, 0x10, 0x19, 0x91, 0xAD, 0x1E, 0x0A, 0xDA,
+    0x00, 0x29, 0x92, 0x99, 0x2D, 0xA2, 0xD9, 0x09, 0xDA, 0x1A, 0xD1, 0xE9, 0x1E, 0x00, 0x1A, 0xAA,
+    0x1A, 0x90, 0xA9, 0x0C, 0x1C, 0x1A, 0xD9, 0x60, 0x2E, 0x91, 0xAE, 0x2E, 0x29, 0xDA, 0x2E, 0x2A,
+    0xDA, 0x20, 0x7A, 0x3A, 0xA9, 0x49, 0xA2, 0x9C, 0x90, 0xAD, 0x91, 0x39, 0x29, 0xC2, 0x9C, 0x3C,
+    0x93, 0xAD, 0x93, 0x91, 0x29, 0x2A, 0xC2, 0xD1, 0x9C, 0xA1, 0xAC, 0x91, 0xD1, 0x0A, 0xFC, 0x1C,
+    0xA1, 0xAC, 0x09, 0xC2, 0xCA, 0x70, 0x9C, 0x3A, 0xA1, 0xAC, 0x09, 0xCA, 0x3E, 0x94, 0x9C, 0x97,
+    0x40, 0x19, 0xC9, 0x5E, 0x93, 0xAC, 0x99, 0xCA, 0x19, 0xC3, 0xAA, 0x71, 0x09, 0xD2, 0xC1, 0xCA,
+    0x9A, 0x1C, 0x09, 0xC1, 0xC9, 0xAA, 0x0A, 0xA1, 0x9D, 0x72, 0x79, 0xFD, 0xA7, 0x71, 0xAF, 0xDA,
+    0x09, 0x99, 0x99, 0x91, 0x09, 0xD2, 0xC1, 0xCA, 0x9A, 0x1C, 0x09, 0xC1, 0xC9, 0xAA, 0x0A, 0xA1,
+    0x9D, 0x72, 0x71, 0xAF, 0xFA, 0xFF, 0xC9, 0x92, 0xA1, 0x99, 0x0C, 0x30, 0xAA, 0x2C, 0x09, 0xC2,
+    0xC9, 0x0F, 0xCA, 0x60, 0x09, 0xFC, 0x1C, 0x3C, 0x1C, 0x29, 0xA0, 0x9A, 0x2A, 0x90, 0xAF, 0xC1,
+    0x1C, 0xAA, 0xA9, 0x1A, 0x90, 0xA0, 0xA1, 0xC0, 0x99, 0x0C, 0x19, 0x09, 0x19, 0x00, 0x7A, 0x9A,
+    0x29, 0xC3, 0xAC, 0x2C, 0x0A, 0xA0, 0x09, 0xD2, 0xC1, 0xCA, 0x9A, 0x1C, 0x09, 0xC1, 0xC9, 0xAA,
+    0x0A, 0xA1, 0x9D, 0x72, 0x09, 0xA1, 0x9C, 0x90, 0x9C, 0x19, 0x10, 0x7C, 0x96, 0xD6, 0xAC, 0x69,
+    0xCA, 0x77, 0x7D, 0x2A, 0xD0, 0xAD, 0x2D, 0xA0, 0xE1, 0x9D, 0xA0, 0x99, 0x91, 0x99, 0x90, 0x0F,
+    0xD9, 0xC9, 0x09, 0xC9, 0xAA, 0x2C, 0x70, 0x29, 0x99, 0x9A, 0xAA, 0xA2, 0xAF, 0xF9, 0x77, 0x77,
+    0x59, 0x99, 0xAA, 0xAA, 0xC2, 0xFF, 0xC7, 0x50, 0x1C, 0xA2, 0xD0, 0xAC, 0x91, 0x9C, 0x90, 0xD2,
+    0xAC, 0x1D, 0x2D, 0x0A, 0xCA, 0x19, 0xCA, 0x09, 0x92, 0x99, 0x10, 0x7F, 0xC9, 0x0A, 0xAA, 0xD9,
+    0x3D, 0x39, 0xD4, 0x91, 0x79, 0x70, 0xA7, 0xA7, 0x99, 0x29, 0xD1, 0xD2, 0xCA, 0x9A, 0xA9, 0xC1,
+    0x9C, 0x1D, 0xAA, 0x1A, 0xA1, 0xE5, 0xA9, 0x7A, 0x7C, 0x79, 0x97, 0x70, 0x70, 0xCA, 0x77, 0x0A,
+    0xD7, 0x70, 0xDA, 0x74, 0xAF, 0xA5, 0x9A, 0xA2, 0x9E, 0x90, 0xAD, 0x4D, 0x91, 0x9D, 0xA3, 0xAD,
+    0x99, 0x9D, 0x92, 0xE5, 0x9F, 0xA9, 0x3A, 0xCA, 0x77, 0x0D, 0x97, 0x70, 0x99, 0x77, 0x00, 0x77,
+    0x19, 0xF3, 0x9A, 0x29, 0xD1, 0xD1, 0x9C, 0xA2, 0xAC, 0x3F, 0xA7, 0x77, 0x71, 0x9E, 0x93, 0xA9,
+    0x2A, 0xCA, 0x0A, 0xC2, 0x9C, 0x92, 0xD2, 0xD9, 0x9D, 0x29, 0xA9, 0x3A, 0xE7, 0x72, 0x73, 0x99,
+    0x97, 0xCA, 0x77, 0x77, 0x59, 0xC7, 0x09, 0x90, 0x0A, 0x1C, 0x19, 0x00, 0x97, 0x69, 0x0A, 0x73,
+    0xAC, 0x2A, 0xA9, 0x59, 0xAC, 0x95, 0x9A, 0xAA, 0xAA, 0xA9, 0x40, 0x29, 0xAF, 0xDA, 0x96, 0xA9,
+    0x79, 0xAC, 0x92, 0xA7, 0x4A, 0xA7, 0x70, 0x90, 0x77, 0x77, 0x4A, 0xC9, 0x19, 0xFF, 0xFF, 0xE1,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x97, 0x71, 0x93, 0x73, 0xDA, 0x74, 0xAE, 0x74,
+    0xF7, 0x3D, 0xAD, 0x72, 0x9D, 0x0D, 0x72, 0xD1, 0xD9, 0x70, 0xAC, 0xA1, 0xD9, 0x79, 0xD2, 0xD9,
+    0x7D, 0x92, 0xDA, 0x6A, 0xD3, 0xDA, 0x59, 0xD4, 0xAD, 0x5D, 0xA4, 0xAD, 0x4A, 0xEA, 0xAA, 0xAA,
+    0xE4, 0xFF, 0xF3, 0xFF, 0xFC, 0x91, 0x9D, 0x96, 0xAD, 0x91, 0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA,
+    0x49, 0xFC, 0xAA, 0x96, 0xAF, 0xFA, 0x5D, 0x93, 0x9D, 0x94, 0xD5, 0xAC, 0x93, 0x9D, 0x5A, 0xC9,
+    0x3A, 0xCA, 0x5D, 0x4D, 0x93, 0x9D, 0xA3, 0x9F, 0xFC, 0x94, 0xAF, 0xFC, 0x94, 0xDA, 0x49, 0xDA,
+    0x3D, 0x95, 0x9D, 0x29, 0xD6, 0xAD, 0x2A, 0xCA, 0x6D, 0xA2, 0xD9, 0x5A, 0xDA, 0x2D, 0xA9, 0x99,
+    0x9A, 0xF2, 0x9F, 0xFE, 0xA2, 0xAF, 0xFD, 0xA3, 0xFF, 0xCA, 0x93, 0x39, 0xFF, 0x4A, 0xFF, 0x4D,
+    0x73, 0xCA, 0x72, 0x9C, 0x97, 0x2A, 0xC7, 0x3D, 0x73, 0xCA, 0x72, 0x9C, 0x97, 0x2A, 0xC7, 0x3D,
+    0x73, 0xD7, 0x2A, 0xCA, 0x72, 0xD9, 0x72, 0xD7, 0x29, 0xD7, 0x39, 0x97, 0x20, 0x77, 0x71, 0xAD,
+    0x73, 0x9E, 0x97, 0x2F, 0xA7, 0x1D, 0xAA, 0xCA, 0x70, 0xAD, 0x0A, 0xD7, 0x9D, 0x19, 0xD7, 0xDA,
+    0x19, 0xD9, 0x5E, 0x3D, 0xA4, 0xAD, 0x4E, 0x39, 0xD9, 0x4E, 0x3E, 0x5A, 0xD2, 0xE6, 0xAD, 0x90,
+    0xAD, 0x96, 0x9D, 0xA0, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0x90, 0x72, 0x99, 0x99, 0x96, 0xFF, 0xD5,
+    0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70,
+    0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA,
+    0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x69, 0xFF, 0xFA, 0x69, 0xFF, 0xF9, 0x7F,
+    0xFF, 0x77, 0x9E, 0xA7, 0x6A, 0xEA, 0x76, 0xF9, 0x76, 0xF9, 0x75, 0x9F, 0x97, 0x5A, 0xF7, 0x6A,
+    0xF7, 0x6F, 0xC7, 0x59, 0xFA, 0x75, 0x9F, 0xA7, 0x5A, 0xFA, 0x75, 0xFD, 0x99, 0x99, 0x99, 0x99,
+    0x59, 0xFF, 0xFD, 0x94, 0xAF, 0xFF, 0xD9, 0x4F, 0xFF, 0xE9, 0x30, 0x59, 0x97, 0x09, 0x96, 0xD9,
+    0x69, 0xD5, 0x9D, 0x7A, 0xD5, 0xAD, 0x7D, 0xA5, 0xDA, 0x69, 0xD9, 0x49, 0xD9, 0x6A, 0xD5, 0xAD,
+    0x7E, 0x5E, 0x7D, 0xA5, 0xE6, 0x9D, 0xA4, 0xAD, 0xA6, 0xE9, 0x4F, 0xFF, 0xD5, 0xFF, 0xFD, 0x49,
+    0xFF, 0xFC, 0xA4, 0xAF, 0xFF, 0xC9, 0x4E, 0x95, 0x9E, 0x49, 0xE6, 0xAE, 0x4A, 0xE6, 0xEA, 0x4E,
+    0xA5, 0x9E, 0x93, 0x70, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E,
+    0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x94, 0x99, 0x2D, 0x93,
+    0xAD, 0x1F, 0xD9, 0x1D, 0x93, 0xDA, 0x19, 0x99, 0x93, 0xAD, 0x4D, 0xA7, 0x1D, 0xA4, 0xDA, 0x70,
+    0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA, 0xF9, 0x5F, 0xFF, 0xCA, 0x6A, 0xFF, 0xF7, 0x0F,
+    0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x49, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x49,
+    0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x49, 0xD9, 0x4A, 0xD5, 0xE4, 0x9D, 0xA4, 0xAD, 0xA4, 0xE9, 0x39,
+    0xE4, 0xAE, 0x4A, 0xDA, 0x30, 0x6D, 0xA2, 0xAD, 0x95, 0x9D, 0x29, 0xDA, 0x6A, 0xD1, 0x9D, 0xA7,
+    0xDA, 0x1E, 0x79, 0xD1, 0xE7, 0x0A, 0xD0, 0xE7, 0x1D, 0xAA, 0xD9, 0x70, 0x9F, 0xC9, 0x71, 0xFC,
+    0xA7, 0x2F, 0xC7, 0x29, 0xFC, 0x72, 0xFE, 0x71, 0xDA, 0xAE, 0xA7, 0xAD, 0x90, 0xF7, 0xE1, 0xFC,
+    0x6D, 0xA1, 0x9F, 0xA4, 0xAD, 0x92, 0xFC, 0x93, 0xE3, 0x9F, 0xC2, 0x71, 0xFC, 0x72, 0xAF, 0xC7,
+    0x2F, 0xD9, 0x70, 0xAF, 0xD9, 0x79, 0xFE, 0x97, 0xE9, 0x0E, 0x96, 0x9E, 0x1E, 0xA6, 0xE2, 0xEA,
+    0x5A, 0xDA, 0x2A, 0xDA, 0x5E, 0x3A, 0xE4, 0xE9, 0x39, 0xE3, 0x9D, 0xA5, 0xE3, 0xE6, 0xE2, 0x9D,
+    0x96, 0xE2, 0xE7, 0xE1, 0xAD, 0x70, 0xAD, 0x1D, 0xA7, 0x09, 0xD9, 0x9A, 0xA7, 0x2A, 0xA0, 0x59,
+    0xAA, 0xA7, 0x0A, 0xAA, 0x6F, 0x96, 0xF6, 0xF9, 0x5A, 0xEA, 0x59, 0xFA, 0x5F, 0xA5, 0xAF, 0xA4,
+    0xFC, 0x95, 0xFD, 0x3A, 0xFC, 0x59, 0xDA, 0xE3, 0xEA, 0xD5, 0xAD, 0x9E, 0x2E, 0x9E, 0x5D, 0xA0,
+    0xE9, 0x09, 0xDA, 0x9D, 0xA4, 0x9D, 0x90, 0xE9, 0x0E, 0x0A, 0xD9, 0x4A, 0xD1, 0xEA, 0xE9, 0x0E,
+    0x5E, 0x1F, 0xDA, 0x09, 0xE4, 0x9E, 0x1A, 0xFC, 0x1F, 0x4A, 0xDA, 0x19, 0xF9, 0x1E, 0xA4, 0xE9,
+    0x19, 0xF1, 0x9E, 0x93, 0x9E, 0x3E, 0x2F, 0x93, 0xAE, 0x3A, 0xA9, 0x2F, 0x4F, 0x70, 0x9F, 0x30,
+    0x77, 0x09, 0xAA, 0x69, 0xE6, 0xE6, 0xAE, 0x6D, 0x96, 0xF5, 0xAD, 0x69, 0xF9, 0x4E, 0x6A, 0xFA,
+    0x4D, 0xA6, 0xDA, 0xE3, 0xAD, 0x69, 0xD9, 0xE3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D, 0xA6, 0xE0, 0x9D,
+    0x91, 0xAD, 0x69, 0xDA, 0x1D, 0xA1, 0xE6, 0xE9, 0x1E, 0x09, 0xDA, 0x6E, 0x2A, 0xD0, 0xAD, 0x95,
+    0xAE, 0x2A, 0xD9, 0xE6, 0xEA, 0x29, 0xFC, 0xA6, 0xE9, 0x3F, 0xC9, 0x5A, 0xE4, 0xFC, 0x6F, 0x4A,
+    0xEA, 0x50, 0x49, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5F, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72,
+    0x9A, 0xAA, 0xAA, 0xA9, 0x70, 0xFE, 0x77, 0x77, 0x77, 0x77, 0x71, 0xFF, 0xFA, 0x3F, 0xFF, 0x92,
+    0x70, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69,
+    0xDA, 0x49, 0xDA, 0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D,
+    0xA7, 0x1A, 0xD4, 0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A,
+    0xAF, 0x95, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50,
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x4A, 0xFF, 0xC4, 0xD5, 0xCA, 0x4C, 0xA4, 0x9C, 0x93, 0x9C, 0x94,
+    0xAC, 0x4A, 0xC5, 0xD4, 0xD5, 0xCA, 0x39, 0xCA, 0x49, 0xC9, 0x3A, 0xC5, 0xAC, 0x4D, 0x5D, 0x4C,
+    0xA4, 0x9C, 0xA3, 0x9C, 0x94, 0xAC, 0x93, 0xAC, 0x5D, 0x4D, 0x5C, 0xA4, 0xCA, 0x49, 0xC9, 0x30,
+    0x5A, 0xFD, 0xA9, 0x7F, 0xFC, 0x96, 0xD4, 0xAD, 0x59, 0xD5, 0xD5, 0xDA, 0x5D, 0x5D, 0x94, 0xAC,
+    0xA4, 0x9D, 0x39, 0xAD, 0x94, 0xAF, 0xFC, 0xA5, 0xFF, 0xC9, 0x59, 0xEA, 0xAA, 0x97, 0x0A, 0xD7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xDA, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAE, 0x74, 0xEA, 0x73, 0x49,
+    0x99, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0x93, 0xAC, 0x74, 0xCA, 0x74, 0xC9, 0x73, 0x9C, 0x74, 0xAA,
+    0x74, 0xC7, 0x3C, 0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x97, 0x1D, 0x71, 0x9D, 0x99, 0x99, 0x99, 0x4F,
+    0xFC, 0x4F, 0xFC, 0x77, 0x10, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1,
+    0xFF, 0xFD, 0xA1, 0x94, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x74, 0x9D, 0x97, 0x4A, 0xD7,
+    0x5E, 0x74, 0x9D, 0xA7, 0x4A, 0xD9, 0x74, 0xE7, 0x5E, 0x74, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x74,
+    0x9E, 0x72, 0x0D, 0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD, 0x4A, 0xD9, 0x29, 0xDA,
+    0x29, 0xDA, 0x4E, 0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79, 0xFC, 0x71, 0xF7, 0x2E,
+    0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71, 0x75, 0x99,
+    0x77, 0x6D, 0x77, 0x6C, 0xA7, 0x75, 0x9C, 0x97, 0x74, 0x9D, 0xAA, 0x97, 0x69, 0xFF, 0xE9, 0x71,
+    0x9F, 0xAA, 0xC9, 0x09, 0xFA, 0x79, 0xEA, 0x1A, 0xC3, 0xAE, 0x69, 0xE9, 0x2D, 0x4E, 0x95, 0xE9,
+    0x3C, 0xA4, 0xE9, 0x4A, 0xD9, 0x3A, 0xC5, 0xE9, 0x39, 0xE4, 0xD5, 0xE4, 0xAD, 0x94, 0xCA, 0x49,
+    0xDA, 0x4E, 0x49, 0xC9, 0x4E, 0x5E, 0x4A, 0xC4, 0xEA, 0x49, 0xF9, 0x2C, 0xA2, 0xAF, 0x6F, 0xFF,
+    0xFC, 0x7A, 0xFF, 0xFE, 0x71, 0xFF, 0xFC, 0xA7, 0x39, 0xAF, 0xEA, 0x97, 0x71, 0xAC, 0x77, 0x6D,
+    0x76, 0x6A, 0xA7, 0x0A, 0xA9, 0x6D, 0x96, 0xAC, 0xA7, 0xAD, 0x5A, 0xD7, 0x09, 0xD9, 0x3A, 0xD7,
+    0x2D, 0xA2, 0xAD, 0x73, 0xAD, 0x1A, 0xD7, 0x49, 0xDA, 0xAD, 0x97, 0x5F, 0xC9, 0x76, 0xAE, 0x97,
+    0x7A, 0xE7, 0x7A, 0xF9, 0x75, 0xAF, 0xD7, 0x4A, 0xE9, 0xE7, 0x3A, 0xE1, 0xEA, 0x71, 0xAE, 0x2A,
+    0xE7, 0x0A, 0xE4, 0xEA, 0x6A, 0xE9, 0x4F, 0x5A, 0xE9, 0x59, 0xE9, 0x30, 0x2C, 0xA3, 0xC9, 0x29,
+    0xC9, 0x19, 0xCA, 0x29, 0xC3, 0xAC, 0x29, 0xC3, 0xAC, 0x3D, 0x2A, 0xC3, 0xCA, 0x29, 0xC9, 0x2D,
+    0x3C, 0x3D, 0x3D, 0x2A, 0xC2, 0xAC, 0xA3, 0xD9, 0x1C, 0xA1, 0xAD, 0x4E, 0x90, 0xC9, 0x0E, 0xA4,
+    0x9F, 0xFC, 0xA6, 0x9F, 0xE9, 0x71, 0x9C, 0xA9, 0x74, 0x9C, 0x76, 0xAC, 0x76, 0xCA, 0x76, 0xC9,
+    0x75, 0xAC, 0x76, 0xCA, 0x76, 0xA9, 0x72, 0x72, 0x99, 0x97, 0x49, 0xFD, 0xA7, 0x1E, 0x91, 0x9D,
+    0xA7, 0xDA, 0x5D, 0x95, 0xDA, 0x6A, 0xCA, 0x49, 0xD7, 0x9D, 0x4D, 0x97, 0x9D, 0x39, 0xD7, 0x0A,
+    0xCA, 0x3A, 0xCA, 0x70, 0xD9, 0x3D, 0x97, 0x0D, 0x4D, 0x70, 0xDA, 0x4A, 0xC9, 0x6A, 0xD5, 0x9C,
+    0xA5, 0xE9, 0x6D, 0xA2, 0xAE, 0x5A, 0xFC, 0x2F, 0xD3, 0xFD, 0x2F, 0xCA, 0x77, 0x50, 0x77, 0x69,
+    0xAD, 0xA0, 0xA9, 0x7A, 0xFE, 0x96, 0xAC, 0xA2, 0xAD, 0x69, 0xCA, 0x4D, 0x6D, 0x49, 0xD5, 0x9C,
+    0x94, 0x9C, 0xA5, 0xAC, 0x5D, 0xA5, 0xD4, 0xAD, 0x95, 0xDA, 0x19, 0xF6, 0xFF, 0xD0, 0xA4, 0x9F,
+    0xDA, 0xDA, 0xC9, 0xAA, 0x29, 0xEA, 0x99, 0xCA, 0xF9, 0x77, 0x00, 0x77, 0x77, 0x77, 0x77, 0x3A,
+    0xAC, 0xA7, 0x1F, 0xD7, 0xD9, 0x1A, 0xD5, 0xD9, 0x39, 0xC9, 0x39, 0xD4, 0x9C, 0x93, 0xAC, 0x94,
+    0xAC, 0x4D, 0x4A, 0xC9, 0x4D, 0x1E, 0xA5, 0x9C, 0xA1, 0xAA, 0xDA, 0x4A, 0xC9, 0x4A, 0xCA, 0x3D,
+    0x59, 0xD3, 0xD9, 0x4A, 0xCA, 0x29, 0xF9, 0x1A, 0xD9, 0x2A, 0xFF, 0xD3, 0xD9, 0xFE, 0x92, 0x9D,
+    0x19, 0xAE, 0x93, 0xAC, 0x97, 0x3D, 0x74, 0xD7, 0x39, 0xCA, 0x73, 0x0A, 0x95, 0xA9, 0x0D, 0x49,
+    0xD0, 0xD4, 0x9C, 0xA0, 0xAC, 0x93, 0xD9, 0x0A, 0xCA, 0x3D, 0x19, 0xD2, 0xAC, 0xA2, 0xD2, 0xD3,
+    0xD9, 0x0D, 0xA3, 0xFD, 0x4F, 0xC9, 0x4F, 0xA5, 0xF6, 0xE7, 0xDA, 0x69, 0xDA, 0x69, 0xD9, 0x6A,
+    0xD9, 0x6A, 0xCA, 0x60, 0x5A, 0xFC, 0xA9, 0x39, 0xDA, 0xAA, 0xEA, 0x3D, 0x94, 0x94, 0xAC, 0x97,
+    0x29, 0xD7, 0x3A, 0xD7, 0x3A, 0xD7, 0x39, 0xD7, 0x9A, 0xFC, 0x5F, 0xAE, 0x93, 0xE9, 0x2A, 0xD2,
+    0x9D, 0x94, 0xD2, 0xE4, 0x9D, 0x2D, 0xA4, 0xAD, 0x2E, 0x3A, 0xD9, 0x2F, 0xFC, 0xA4, 0xFE, 0xA6,
+    0xAE, 0xA5, 0x39, 0xAD, 0x93, 0x9C, 0x91, 0xC3, 0xC9, 0x2A, 0x3C, 0x70, 0xC9, 0x79, 0xD9, 0x4A,
+    0xC9, 0x59, 0xC2, 0x9C, 0x91, 0xAC, 0x2A, 0xC2, 0x9F, 0xCA, 0x39, 0xE9, 0x20, 0x39, 0xFE, 0x59,
+    0x9A, 0xE9, 0x69, 0xD9, 0x7A, 0xCA, 0x70, 0xD9, 0x70, 0xD9, 0x70, 0xAC, 0x97, 0x1D, 0x71, 0x9C,
+    0x97, 0x1A, 0xCA, 0x72, 0xE9, 0x71, 0xAF, 0x71, 0xAD, 0x97, 0x09, 0xD7, 0x1D, 0xA7, 0x0E, 0x70,
+    0xE7, 0x09, 0x99, 0x70, 0x77, 0x0D, 0xA7, 0x29, 0xD1, 0x99, 0x96, 0xDA, 0xFC, 0x94, 0xE9, 0x2D,
+    0x39, 0xD4, 0xAC, 0x3A, 0xC9, 0x4A, 0xC3, 0xD5, 0xD2, 0x9D, 0x49, 0xCA, 0x2A, 0xCA, 0x4A, 0xC9,
+    0x2D, 0x94, 0xD2, 0x9D, 0x93, 0x9D, 0x2A, 0xD4, 0xAC, 0xA2, 0xE4, 0xD9, 0x71, 0x9D, 0x72, 0xAD,
+    0x72, 0xE7, 0x2D, 0xA7, 0x1A, 0xD9, 0x77, 0x00, 0x69, 0xAA, 0xA7, 0xAC, 0x91, 0xAC, 0x5A, 0xC4,
+    0xC9, 0x39, 0xCA, 0x4C, 0xA3, 0xD5, 0xCA, 0x29, 0xCA, 0x5C, 0xA2, 0xDA, 0xAA, 0xAA, 0xAA, 0xC9,
+    0x2F, 0xFD, 0x91, 0x9D, 0x5D, 0x2A, 0xCA, 0x4A, 0xCA, 0x2A, 0xD3, 0x9D, 0x92, 0xE2, 0x9E, 0x3A,
+    0xFF, 0x93, 0xAF, 0xEA, 0x5F, 0xDA, 0x7A, 0xDA, 0x95, 0x49, 0x5C, 0xA3, 0x9C, 0x93, 0xAC, 0x4D,
+    0x4C, 0xA3, 0xAC, 0x93, 0xD4, 0xD3, 0xAC, 0xA3, 0xDA, 0x29, 0xD9, 0x2A, 0xF1, 0xFA, 0x00, 0x77,
+    0xD1, 0xAC, 0xA4, 0xCA, 0x09, 0xCA, 0x49, 0xC9, 0x9D, 0x5D, 0x0D, 0x6C, 0xAD, 0x6A, 0xE7, 0xEA,
+    0x69, 0xF6, 0xAC, 0x9E, 0x5D, 0x0A, 0xDA, 0x39, 0xCA, 0x1E, 0x92, 0xAC, 0x91, 0xAE, 0x20, 0x9A,
+    0xA9, 0x73, 0x9F, 0xA7, 0x2F, 0xD7, 0x39, 0xF7, 0x49, 0xE7, 0x4A, 0xD9, 0x73, 0x9E, 0x73, 0xAE,
+    0x97, 0x2F, 0xC7, 0x2F, 0xC9, 0x70, 0x9D, 0x9A, 0xD7, 0x0A, 0xD1, 0xD9, 0x7D, 0xA1, 0x9D, 0x7D,
+    0x92, 0xD9, 0x6D, 0x4D, 0x59, 0xCA, 0x4A, 0xC9, 0x4A, 0xC9, 0x5D, 0x00, 0x4D, 0x49, 0xD3, 0x9D,
+    0x4A, 0xCA, 0x39, 0xCA, 0x4D, 0x93, 0xD9, 0x4D, 0x4D, 0x49, 0xD3, 0xAD, 0x4A, 0xCA, 0x3E, 0x4D,
+    0x92, 0x9D, 0xA3, 0xAD, 0x3A, 0xFA, 0xFC, 0x3F, 0xFE, 0x29, 0xC9, 0xFF, 0xA2, 0xCA, 0x0A, 0xEA,
+    0x0D, 0x92, 0xC7, 0x49, 0xA7, 0x40, 0x09, 0x95, 0xA9, 0x0D, 0x49, 0xD0, 0xD4, 0x9C, 0xA0, 0xAC,
+    0x93, 0xD9, 0x0A, 0xCA, 0x3D, 0x19, 0xD2, 0xAC, 0xA2, 0xD2, 0xD9, 0x2D, 0x90, 0xDA, 0x3F, 0xD4,
+    0xFC, 0x94, 0xFC, 0x5F, 0x40, 0x29, 0xFE, 0x39, 0x99, 0xEA, 0x95, 0xAC, 0xA7, 0xAC, 0x97, 0x0C,
+    0x97, 0x09, 0xC9, 0x71, 0xEA, 0x96, 0xAD, 0xA9, 0x5A, 0xC9, 0x79, 0xC9, 0x70, 0x9C, 0xA7, 0x1F,
+    0x97, 0x9A, 0xD7, 0x1A, 0xC7, 0x09, 0xD7, 0x9D, 0xA6, 0x9D, 0xA7, 0x99, 0x95, 0x49, 0xAE, 0xA6,
+    0xAF, 0xDA, 0x4A, 0xCA, 0x3D, 0x3A, 0xCA, 0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9,
+    0x1A, 0xC9, 0x5D, 0x2A, 0xC9, 0x49, 0xCA, 0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A,
+    0xEA, 0x50, 0x09, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA1, 0xFF, 0xF3, 0xD2, 0xAC, 0x94, 0x9C, 0xA2,
+    0xD5, 0xAC, 0x91, 0x9C, 0x95, 0xD2, 0xD5, 0x9C, 0xA2, 0xCA, 0x5A, 0xC2, 0xAC, 0x95, 0xD2, 0xD5,
+    0x9C, 0xA1, 0x9D, 0xA9, 0x3A, 0xC2, 0x9E, 0x97, 0x71, 0x71, 0xAC, 0xA9, 0x71, 0xAF, 0xC9, 0x7E,
+    0x91, 0xD6, 0xAD, 0x3A, 0xC5, 0x9D, 0x4A, 0xC5, 0xDA, 0x4D, 0x5D, 0x94, 0xD4, 0xAD, 0x93, 0xAC,
+    0xA4, 0xEA, 0x29, 0xD4, 0x9F, 0xFC, 0xA4, 0xDA, 0xFD, 0xA4, 0x9D, 0x09, 0xF9, 0x5E, 0x73, 0x9D,
+    0x97, 0x3A, 0xD7, 0x4D, 0x97, 0x49, 0x75, 0x75, 0x9F, 0xA3, 0x9C, 0xA2, 0xCA, 0x2C, 0xA7, 0x9C,
+    0x70, 0xAA, 0x70, 0xCA, 0x70, 0xAC, 0x70, 0x9D, 0x70, 0xAD, 0x70, 0xD7, 0xAD, 0x7D, 0xA7, 0xAC,
+    0x95, 0x49, 0xAF, 0xFE, 0xA3, 0xAF, 0xEA, 0x99, 0x99, 0x93, 0xAC, 0xA3, 0xD7, 0x0A, 0xCA, 0x49,
+    0xCA, 0x7D, 0x59, 0xC9, 0x69, 0xCA, 0x5A, 0xC9, 0x6A, 0xC9, 0x5D, 0x7A, 0xC9, 0x49, 0xCA, 0x7A,
+    0xD3, 0xAD, 0x97, 0x9F, 0xFA, 0x71, 0xFE, 0xA7, 0x3A, 0xEA, 0x72, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x9F, 0xFD, 0xA3, 0xAC, 0x97, 0xD7, 0x9C, 0xA7, 0xAC, 0x70, 0xD7, 0xAC, 0x97, 0xD7, 0x9D, 0xA9,
+    0x6E, 0x97, 0x70, 0x29, 0x39, 0x92, 0x9C, 0x3A, 0xC2, 0xAC, 0x39, 0xC2, 0xCA, 0x39, 0xC2, 0xCA,
+    0x39, 0xC1, 0x9C, 0x93, 0xAC, 0x19, 0xC4, 0xD1, 0xAC, 0x39, 0xCA, 0x1D, 0x92, 0xD9, 0x1F, 0xF2,
+    0xAF, 0xD9, 0x29, 0xFC, 0x76, 0x73, 0x99, 0x77, 0x1C, 0x97, 0x71, 0xC7, 0x71, 0x9C, 0x77, 0x1A,
+    0xC7, 0x79, 0xAF, 0xA7, 0x2A, 0xFF, 0xC9, 0x7F, 0xAC, 0x1A, 0xE6, 0xE9, 0x0A, 0xC2, 0xE9, 0x4A,
+    0xD9, 0x1A, 0xA2, 0x9D, 0xA3, 0x9D, 0xA2, 0xC9, 0x3D, 0xA3, 0xE3, 0xC9, 0x3D, 0xA2, 0x9D, 0x92,
+    0x9C, 0x4D, 0x92, 0xAD, 0x3A, 0xC4, 0xD9, 0x2D, 0xA3, 0xCA, 0x3A, 0xD3, 0xDA, 0x3C, 0x93, 0xDA,
+    0x3D, 0xA3, 0xC3, 0xAD, 0x93, 0xE2, 0x9C, 0x2A, 0xE4, 0xFA, 0x9D, 0xAA, 0xF9, 0x4F, 0xFF, 0xCA,
+    0x5A, 0xFF, 0xF7, 0xFF, 0xDA, 0x71, 0x9A, 0xFC, 0xA7, 0x6A, 0xA7, 0x71, 0xCA, 0x77, 0x76, 0x49,
+    0x77, 0x0E, 0x94, 0x9C, 0xA5, 0xF9, 0x29, 0xCA, 0x79, 0xE1, 0x9D, 0x71, 0x9D, 0x09, 0xD7, 0x3D,
+    0xAD, 0x74, 0xAE, 0x75, 0xAD, 0x97, 0x5E, 0x75, 0xF9, 0x73, 0xDA, 0xDA, 0x72, 0xE0, 0xAD, 0x71,
+    0xE1, 0xAD, 0x70, 0xE2, 0x9F, 0xC4, 0xE4, 0xFC, 0x3E, 0x94, 0x9E, 0xA2, 0x6C, 0x71, 0x9C, 0x71,
+    0xAC, 0x6A, 0x1C, 0xA1, 0x92, 0x9C, 0x1C, 0x91, 0xCA, 0x1A, 0xC1, 0xC9, 0x1C, 0xA1, 0xCA, 0x09,
+    0xC2, 0xCA, 0x1C, 0xA0, 0xAC, 0x2C, 0xA0, 0x9C, 0x90, 0xAA, 0x2C, 0x90, 0xAC, 0x1C, 0xA1, 0x9C,
+    0x90, 0xAC, 0x90, 0xC9, 0x1D, 0x1A, 0xD9, 0xC9, 0x9E, 0x1A, 0xFF, 0x29, 0xFE, 0x93, 0x9F, 0xA7,
+    0xC9, 0x71, 0xC7, 0x19, 0xC7, 0x1A, 0xC7, 0x1A, 0x96, 0x39, 0x97, 0x3D, 0x95, 0xCA, 0x2A, 0xC9,
+    0x6D, 0x19, 0xD7, 0xD1, 0xD3, 0x93, 0xD0, 0x9C, 0xA2, 0xA9, 0x3C, 0xA0, 0xD9, 0x2C, 0x3A, 0xC9,
+    0x0D, 0x29, 0xC3, 0xD1, 0xD9, 0x1D, 0x90, 0x9D, 0x91, 0xAF, 0xFD, 0xA3, 0x9D, 0xA0, 0x9E, 0x97,
+    0x72, 0x73, 0xDA, 0x74, 0xAE, 0x74, 0xF7, 0x3D, 0xAD, 0x72, 0x9D, 0x0D, 0x72, 0xD1, 0xD9, 0x70,
+    0xAC, 0xA1, 0xD9, 0x79, 0xD2, 0xD9, 0x7D, 0x92, 0xDA, 0x6A, 0xD3, 0xDA, 0x59, 0xD4, 0xAD, 0x5D,
+    0xA4, 0xAD, 0x4A, 0xEA, 0xAA, 0xAA, 0xE4, 0xFF, 0xF3, 0xFF, 0xFC, 0x91, 0x9D, 0x96, 0xAD, 0x91,
+    0xE7, 0xAD, 0xA0, 0xE9, 0x7A, 0xDA, 0x77, 0x77, 0x77, 0x70, 0xAD, 0x75, 0xDA, 0x74, 0xAD, 0xA7,
+    0x49, 0x99, 0x70, 0x77, 0x39, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93, 0xAC, 0xA2, 0xAD, 0x39, 0xCA,
+    0x4D, 0x3D, 0x49, 0xD2, 0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2, 0xD4, 0xAD, 0x92, 0xDA, 0x19,
+    0xF3, 0xFF, 0xD3, 0x9F, 0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA7, 0x77, 0x71, 0xD7, 0x2A, 0xD7, 0x2E,
+    0x72, 0x99, 0x97, 0x74, 0x9E, 0x97, 0x70, 0x9C, 0x77, 0xAC, 0x97, 0x6A, 0xC7, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x2D, 0xA7, 0x6A, 0xE7, 0x6F, 0x75, 0xDA, 0xD7, 0x49, 0xD0, 0xD7, 0x4D, 0x1D, 0x97,
+    0x2A, 0xCA, 0x1D, 0x97, 0x19, 0xD2, 0xD9, 0x71, 0xD9, 0x2D, 0xA7, 0x0A, 0xD3, 0xDA, 0x79, 0xD4,
+    0xAD, 0x7D, 0xA4, 0xAD, 0x6A, 0xEA, 0xAA, 0xAA, 0xE6, 0xFF, 0xF5, 0xFF, 0xFC, 0x93, 0x9D, 0x96,
+    0xAD, 0x93, 0xE7, 0xAD, 0xA2, 0xE9, 0x7A, 0xDA, 0x10, 0x70, 0xAA, 0xA7, 0x29, 0x0A, 0xC7, 0x29,
+    0xC9, 0x71, 0x9C, 0x97, 0x77, 0x77, 0x71, 0x9A, 0xDA, 0x0A, 0x94, 0xAF, 0xE9, 0x3A, 0xCA, 0x2A,
+    0xD3, 0x9C, 0xA4, 0xD3, 0xD4, 0x9D, 0x29, 0xC9, 0x49, 0xCA, 0x2A, 0xC5, 0xDA, 0x2D, 0x4A, 0xD9,
+    0x2D, 0xA1, 0x9F, 0x3F, 0xFD, 0x39, 0xFD, 0xAD, 0x49, 0xEA, 0x99, 0xCA, 0x10, 0x77, 0x3C, 0x97,
+    0x72, 0xAC, 0x77, 0x2A, 0xC7, 0x72, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x1A, 0xC7, 0x73, 0xE7, 0x71,
+    0xD0, 0xAC, 0x97, 0x6A, 0xA3, 0xA9, 0x77, 0x77, 0x5D, 0xA7, 0x71, 0xAE, 0x77, 0x1F, 0x77, 0x0D,
+    0xAD, 0x77, 0x9D, 0x0D, 0x77, 0xD1, 0xD9, 0x75, 0xAC, 0xA1, 0xD9, 0x74, 0x9D, 0x2D, 0x97, 0x4D,
+    0x92, 0xDA, 0x73, 0xAD, 0x3D, 0xA7, 0x29, 0xD4, 0xAD, 0x72, 0xDA, 0x4A, 0xD7, 0x1A, 0xEA, 0xAA,
+    0xAA, 0xE7, 0x1F, 0xFF, 0x70, 0xFF, 0xFC, 0x96, 0x9D, 0x96, 0xAD, 0x96, 0xE7, 0xAD, 0xA5, 0xE9,
+    0x7A, 0xDA, 0x40, 0x77, 0x77, 0x70, 0xAA, 0x77, 0x2A, 0xC7, 0x72, 0x9C, 0xA7, 0x72, 0xD7, 0x77,
+    0x77, 0x77, 0xCA, 0x77, 0x2A, 0xDA, 0x77, 0x09, 0xCA, 0x0C, 0xA7, 0x7C, 0x92, 0x9C, 0x77, 0x77,
+    0x39, 0xAD, 0xA0, 0xA9, 0x74, 0xAF, 0xE9, 0x73, 0xAC, 0xA2, 0xAD, 0x73, 0x9C, 0xA4, 0xD7, 0x3D,
+    0x49, 0xD7, 0x29, 0xC9, 0x49, 0xCA, 0x72, 0xAC, 0x5D, 0xA7, 0x2D, 0x4A, 0xD9, 0x72, 0xDA, 0x19,
+    0xF7, 0x3F, 0xFD, 0x73, 0x9F, 0xDA, 0xD7, 0x49, 0xEA, 0x99, 0xCA, 0x71, 0x73, 0xA9, 0x77, 0x0D,
+    0x97, 0x70, 0xDA, 0x77, 0x09, 0xA7, 0x6A, 0xC7, 0x70, 0xE7, 0x6D, 0x0A, 0xC9, 0x73, 0xAA, 0x3A,
+    0x97, 0x77, 0x7D, 0xA7, 0x6A, 0xE7, 0x6F, 0x75, 0xDA, 0xD7, 0x49, 0xD0, 0xD7, 0x4D, 0x1D, 0x97,
+    0x2A, 0xCA, 0x1D, 0x97, 0x19, 0xD2, 0xD9, 0x71, 0xD9, 0x2D, 0xA7, 0x0A, 0xD3, 0xDA, 0x79, 0xD4,
+    0xAD, 0x7D, 0xA4, 0xAD, 0x6A, 0xEA, 0xAA, 0xAA, 0xE6, 0xFF, 0xF5, 0xFF, 0xFC, 0x93, 0x9D, 0x96,
+    0xAD, 0x93, 0xE7, 0xAD, 0xA2, 0xE9, 0x7A, 0xDA, 0x10, 0x5D, 0x74, 0x9D, 0x74, 0xAD, 0x75, 0xD7,
+    0x3A, 0xDA, 0x71, 0x9C, 0x90, 0xD7, 0x0C, 0x92, 0x9C, 0x77, 0x59, 0xAD, 0xA0, 0xA9, 0x5A, 0xFE,
+    0x94, 0xAC, 0xA2, 0xAD, 0x49, 0xCA, 0x4D, 0x4D, 0x49, 0xD3, 0x9C, 0x94, 0x9C, 0xA3, 0xAC, 0x5D,
+    0xA3, 0xD4, 0xAD, 0x93, 0xDA, 0x19, 0xF4, 0xFF, 0xD4, 0x9F, 0xDA, 0xD5, 0x9E, 0xA9, 0x9C, 0xA2,
+    0x77, 0x1A, 0xA9, 0x77, 0x19, 0x1C, 0x97, 0x72, 0xAC, 0x77, 0x2A, 0xA7, 0x77, 0x77, 0x77, 0x1A,
+    0xC7, 0x73, 0xE7, 0x71, 0xD0, 0xAC, 0x97, 0x6A, 0xA3, 0xA9, 0x77, 0x77, 0x5D, 0xA7, 0x71, 0xAE,
+    0x77, 0x1F, 0x77, 0x0D, 0xAD, 0x77, 0x9D, 0x0D, 0x77, 0xD1, 0xD9, 0x75, 0xAC, 0xA1, 0xD9, 0x74,
+    0x9D, 0x2D, 0x97, 0x4D, 0x92, 0xDA, 0x73, 0xAD, 0x3D, 0xA7, 0x29, 0xD4, 0xAD, 0x72, 0xDA, 0x4A,
+    0xD7, 0x1A, 0xEA, 0xAA, 0xAA, 0xE7, 0x1F, 0xFF, 0x70, 0xFF, 0xFC, 0x96, 0x9D, 0x96, 0xAD, 0x96,
+    0xE7, 0xAD, 0xA5, 0xE9, 0x7A, 0xDA, 0x40, 0x71, 0x9D, 0xA7, 0x5C, 0x97, 0x3C, 0xA7, 0x3A, 0x97,
+    0x0A, 0xC7, 0x39, 0xE7, 0x2C, 0xA0, 0xAC, 0x97, 0xAA, 0x3A, 0x97, 0x76, 0x9A, 0xDA, 0x0A, 0x95,
+    0xAF, 0xE9, 0x4A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA4, 0xD4, 0xD4, 0x9D, 0x39, 0xC9, 0x49, 0xCA, 0x3A,
+    0xC5, 0xDA, 0x3D, 0x4A, 0xD9, 0x3D, 0xA1, 0x9F, 0x4F, 0xFD, 0x49, 0xFD, 0xAD, 0x59, 0xEA, 0x99,
+    0xCA, 0x20, 0x72, 0xD9, 0x1A, 0x97, 0x1A, 0xC9, 0xC1, 0xC7, 0x2C, 0x1A, 0x9A, 0xC7, 0x19, 0xC2,
+    0xD9, 0x77, 0x77, 0x77, 0x9C, 0x77, 0xE9, 0x74, 0xAC, 0x09, 0xC9, 0x72, 0x9C, 0x3A, 0xA7, 0x77,
+    0x6D, 0xA7, 0x5A, 0xE7, 0x5F, 0x74, 0xDA, 0xD7, 0x39, 0xD0, 0xD7, 0x3D, 0x1D, 0x97, 0x1A, 0xCA,
+    0x1D, 0x97, 0x09, 0xD2, 0xD9, 0x70, 0xD9, 0x2D, 0xA7, 0xAD, 0x3D, 0xA6, 0x9D, 0x4A, 0xD6, 0xDA,
+    0x4A, 0xD5, 0xAE, 0xAA, 0xAA, 0xAE, 0x5F, 0xFF, 0x4F, 0xFF, 0xC9, 0x29, 0xD9, 0x6A, 0xD9, 0x2E,
+    0x7A, 0xDA, 0x1E, 0x97, 0xAD, 0xA0, 0x77, 0x3D, 0xA1, 0x9A, 0x5A, 0xA0, 0xCA, 0x9C, 0x95, 0xC9,
+    0x1D, 0xA7, 0x76, 0xC9, 0x72, 0xAD, 0x97, 0x09, 0xC9, 0x9C, 0xA7, 0xC9, 0x29, 0xA7, 0x75, 0x9A,
+    0xDA, 0x0A, 0x94, 0xAF, 0xE9, 0x3A, 0xCA, 0x2A, 0xD3, 0x9C, 0xA4, 0xD3, 0xD4, 0x9D, 0x29, 0xC9,
+    0x49, 0xCA, 0x2A, 0xC5, 0xDA, 0x2D, 0x4A, 0xD9, 0x2D, 0xA1, 0x9F, 0x3F, 0xFD, 0x39, 0xFD, 0xAD,
+    0x49, 0xEA, 0x99, 0xCA, 0x10, 0x73, 0xAC, 0x77, 0x0E, 0x76, 0xD0, 0xAC, 0x97, 0x3A, 0xA3, 0xA9,
+    0x77, 0x77, 0xDA, 0x76, 0xAE, 0x76, 0xF7, 0x5D, 0xAD, 0x74, 0x9D, 0x0D, 0x74, 0xD1, 0xD9, 0x72,
+    0xAC, 0xA1, 0xD9, 0x71, 0x9D, 0x2D, 0x97, 0x1D, 0x92, 0xDA, 0x70, 0xAD, 0x3D, 0xA7, 0x9D, 0x4A,
+    0xD7, 0xDA, 0x4A, 0xD6, 0xAE, 0xAA, 0xAA, 0xAE, 0x6F, 0xFF, 0x5F, 0xFF, 0xC9, 0x39, 0xD9, 0x6A,
+    0xD9, 0x3E, 0x7A, 0xDA, 0x2E, 0x97, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x70, 0xAD, 0x77, 0xDA, 0x76,
+    0xAD, 0xA7, 0x69, 0x99, 0x72, 0x69, 0xC9, 0x72, 0xE9, 0x70, 0xAC, 0x99, 0xC9, 0x69, 0xC3, 0xAA,
+    0x69, 0xAD, 0xA0, 0xA9, 0x4A, 0xFE, 0x93, 0xAC, 0xA2, 0xAD, 0x39, 0xCA, 0x4D, 0x3D, 0x49, 0xD2,
+    0x9C, 0x94, 0x9C, 0xA2, 0xAC, 0x5D, 0xA2, 0xD4, 0xAD, 0x92, 0xDA, 0x19, 0xF3, 0xFF, 0xD3, 0x9F,
+    0xDA, 0xD4, 0x9E, 0xA9, 0x9C, 0xA7, 0x77, 0x71, 0xD7, 0x2A, 0xD7, 0x2E, 0x72, 0x99, 0x97, 0x77,
+    0x77, 0x39, 0xC7, 0x71, 0xC9, 0x77, 0x0D, 0x77, 0x0A, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x6C,
+    0x4A, 0xC7, 0x3C, 0xA2, 0x9C, 0x97, 0x3F, 0xD9, 0x75, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x3D,
+    0xA7, 0x7A, 0xE7, 0x7F, 0x76, 0xDA, 0xD7, 0x59, 0xD0, 0xD7, 0x5D, 0x1D, 0x97, 0x3A, 0xCA, 0x1D,
+    0x97, 0x29, 0xD2, 0xD9, 0x72, 0xD9, 0x2D, 0xA7, 0x1A, 0xD3, 0xDA, 0x70, 0x9D, 0x4A, 0xD7, 0x0D,
+    0xA4, 0xAD, 0x7A, 0xEA, 0xAA, 0xAA, 0xE7, 0xFF, 0xF6, 0xFF, 0xFC, 0x94, 0x9D, 0x96, 0xAD, 0x94,
+    0xE7, 0xAD, 0xA3, 0xE9, 0x7A, 0xDA, 0x20, 0x77, 0x72, 0xC9, 0x73, 0xCA, 0x73, 0xAC, 0x73, 0xAC,
+    0x97, 0x77, 0x77, 0x77, 0x74, 0xC9, 0x4C, 0x6D, 0x29, 0xCA, 0x6A, 0xFC, 0xA7, 0x0A, 0xE9, 0x77,
+    0x77, 0x69, 0xAD, 0xA0, 0xA9, 0x5A, 0xFE, 0x94, 0xAC, 0xA2, 0xAD, 0x49, 0xCA, 0x4D, 0x4D, 0x49,
+    0xD3, 0x9C, 0x94, 0x9C, 0xA3, 0xAC, 0x5D, 0xA3, 0xD4, 0xAD, 0x93, 0xDA, 0x19, 0xF4, 0xFF, 0xD4,
+    0x9F, 0xDA, 0xD5, 0x9E, 0xA9, 0x9C, 0xA2, 0x73, 0xAC, 0xA7, 0x71, 0xDA, 0x77, 0x1D, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x1C, 0x49, 0xC7, 0x3C, 0xA2, 0x9C, 0x97, 0x3F, 0xDA, 0x75, 0xAD, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x3D, 0xA7, 0x7A, 0xE7, 0x7F, 0x76, 0xDA, 0xD7, 0x59, 0xD0, 0xD7, 0x5D, 0x1D,
+    0x97, 0x3A, 0xCA, 0x1D, 0x97, 0x29, 0xD2, 0xD9, 0x72, 0xD9, 0x2D, 0xA7, 0x1A, 0xD3, 0xDA, 0x70,
+    0x9D, 0x4A, 0xD7, 0x0D, 0xA4, 0xAD, 0x7A, 0xEA, 0xAA, 0xAA, 0xE7, 0xFF, 0xF6, 0xFF, 0xFC, 0x94,
+    0x9D, 0x96, 0xAD, 0x94, 0xE7, 0xAD, 0xA3, 0xE9, 0x7A, 0xDA, 0x20, 0x69, 0xCA, 0x74, 0xAD, 0x74,
+    0xAD, 0x77, 0x77, 0x77, 0x5C, 0x94, 0xC6, 0xD2, 0x9C, 0xA6, 0xAF, 0xCA, 0x70, 0xAE, 0x97, 0x77,
+    0x76, 0x9A, 0xDA, 0x0A, 0x95, 0xAF, 0xE9, 0x4A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA4, 0xD4, 0xD4, 0x9D,
+    0x39, 0xC9, 0x49, 0xCA, 0x3A, 0xC5, 0xDA, 0x3D, 0x4A, 0xD9, 0x3D, 0xA1, 0x9F, 0x4F, 0xFD, 0x49,
+    0xFD, 0xAD, 0x59, 0xEA, 0x99, 0xCA, 0x20, 0x75, 0x9A, 0xA9, 0x77, 0x90, 0x9C, 0x77, 0x09, 0xCA,
+    0x77, 0x0C, 0x97, 0x77, 0x77, 0x77, 0x77, 0x77, 0x5C, 0x49, 0xC7, 0x3C, 0xA2, 0x9C, 0x97, 0x3F,
+    0xD9, 0x75, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x3D, 0xA7, 0x7A, 0xE7, 0x7F, 0x76, 0xDA, 0xD7,
+    0x59, 0xD0, 0xD7, 0x5D, 0x1D, 0x97, 0x3A, 0xCA, 0x1D, 0x97, 0x29, 0xD2, 0xD9, 0x72, 0xD9, 0x2D,
+    0xA7, 0x1A, 0xD3, 0xDA, 0x70, 0x9D, 0x4A, 0xD7, 0x0D, 0xA4, 0xAD, 0x7A, 0xEA, 0xAA, 0xAA, 0xE7,
+    0xFF, 0xF6, 0xFF, 0xFC, 0x94, 0x9D, 0x96, 0xAD, 0x94, 0xE7, 0xAD, 0xA3, 0xE9, 0x7A, 0xDA, 0x20,
+    0x77, 0x7A, 0xEA, 0x71, 0xA2, 0xC9, 0x73, 0xD9, 0x71, 0x9D, 0x97, 0x2C, 0xA7, 0x49, 0x77, 0x77,
+    0x77, 0x77, 0x49, 0xC4, 0xAC, 0x59, 0xCA, 0x29, 0xC9, 0x6F, 0xD9, 0x70, 0xAD, 0xA7, 0x77, 0x09,
+    0xAD, 0xA0, 0xA9, 0x5A, 0xFE, 0x94, 0xAC, 0xA2, 0xAD, 0x49, 0xCA, 0x4D, 0x4D, 0x49, 0xD3, 0x9C,
+    0x94, 0x9C, 0xA3, 0xAC, 0x5D, 0xA3, 0xD4, 0xAD, 0x93, 0xDA, 0x19, 0xF4, 0xFF, 0xD4, 0x9F, 0xDA,
+    0xD5, 0x9E, 0xA9, 0x9C, 0xA2, 0x73, 0xAC, 0xA2, 0xC7, 0x4C, 0x9A, 0x90, 0x9A, 0x73, 0xAA, 0x09,
+    0xC9, 0xC9, 0x73, 0xC9, 0x1A, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x70, 0xC4, 0x9C, 0x73, 0xCA, 0x29,
+    0xC9, 0x73, 0xFD, 0x97, 0x5A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xDA, 0x77, 0xAE, 0x77, 0xF7,
+    0x6D, 0xAD, 0x75, 0x9D, 0x0D, 0x75, 0xD1, 0xD9, 0x73, 0xAC, 0xA1, 0xD9, 0x72, 0x9D, 0x2D, 0x97,
+    0x2D, 0x92, 0xDA, 0x71, 0xAD, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70, 0xDA, 0x4A, 0xD7, 0xAE, 0xAA,
+    0xAA, 0xAE, 0x7F, 0xFF, 0x6F, 0xFF, 0xC9, 0x49, 0xD9, 0x6A, 0xD9, 0x4E, 0x7A, 0xDA, 0x3E, 0x97,
+    0xAD, 0xA2, 0x69, 0xD2, 0xC7, 0xCA, 0x9A, 0x1C, 0x69, 0xC1, 0xC9, 0xAA, 0x6A, 0xA1, 0x9D, 0x77,
+    0x77, 0x77, 0x4C, 0x94, 0xC6, 0xD2, 0x9C, 0xA6, 0xAF, 0xCA, 0x70, 0xAE, 0x97, 0x77, 0x76, 0x9A,
+    0xDA, 0x0A, 0x95, 0xAF, 0xE9, 0x4A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA4, 0xD4, 0xD4, 0x9D, 0x39, 0xC9,
+    0x49, 0xCA, 0x3A, 0xC5, 0xDA, 0x3D, 0x4A, 0xD9, 0x3D, 0xA1, 0x9F, 0x4F, 0xFD, 0x49, 0xFD, 0xAD,
+    0x59, 0xEA, 0x99, 0xCA, 0x20, 0x77, 0x76, 0xC4, 0x9C, 0x73, 0xCA, 0x29, 0xC9, 0x73, 0xFD, 0xA7,
+    0x5A, 0xDA, 0x77, 0x77, 0x77, 0x77, 0x73, 0xDA, 0x77, 0xAE, 0x77, 0xF7, 0x6D, 0xAD, 0x75, 0x9D,
+    0x0D, 0x75, 0xD1, 0xD9, 0x73, 0xAC, 0xA1, 0xD9, 0x72, 0x9D, 0x2D, 0x97, 0x2D, 0x92, 0xDA, 0x71,
+    0xAD, 0x3D, 0xA7, 0x09, 0xD4, 0xAD, 0x70, 0xDA, 0x4A, 0xD7, 0xAE, 0xAA, 0xAA, 0xAE, 0x7F, 0xFF,
+    0x6F, 0xFF, 0xC9, 0x49, 0xD9, 0x6A, 0xD9, 0x4E, 0x7A, 0xDA, 0x3E, 0x97, 0xAD, 0xA7, 0x77, 0x77,
+    0x77, 0x74, 0xAD, 0x77, 0x0D, 0xA7, 0x7A, 0xDA, 0x77, 0x99, 0x97, 0x30, 0x77, 0x4C, 0x94, 0xC6,
+    0xD2, 0x9C, 0xA6, 0xAF, 0xCA, 0x70, 0xAE, 0x97, 0x77, 0x76, 0x9A, 0xDA, 0x0A, 0x95, 0xAF, 0xE9,
+    0x4A, 0xCA, 0x2A, 0xD4, 0x9C, 0xA4, 0xD4, 0xD4, 0x9D, 0x39, 0xC9, 0x49, 0xCA, 0x3A, 0xC5, 0xDA,
+    0x3D, 0x4A, 0xD9, 0x3D, 0xA1, 0x9F, 0x4F, 0xFD, 0x49, 0xFD, 0xAD, 0x59, 0xEA, 0x99, 0xCA, 0x77,
+    0x77, 0x4D, 0x73, 0xAD, 0x73, 0xE7, 0x39, 0x99, 0x70, 0x72, 0x99, 0x99, 0x96, 0xFF, 0xD5, 0x9F,
+    0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70, 0xFF,
+    0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0x59,
+    0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x97, 0x77, 0x19, 0x97, 0x6D, 0x97, 0x4A, 0xD7, 0x5E,
+    0x71, 0x79, 0x70, 0x9F, 0xC5, 0xAC, 0xA9, 0x1A, 0xC3, 0xAC, 0x94, 0xC9, 0x19, 0xCA, 0x29, 0x9A,
+    0xC9, 0x1F, 0xFD, 0xA0, 0x9E, 0xAA, 0xAA, 0x99, 0x91, 0xAC, 0x97, 0x1D, 0x97, 0x1A, 0xD9, 0x49,
+    0x29, 0xFF, 0xC3, 0xAF, 0xEA, 0x49, 0xAE, 0xA9, 0x77, 0x77, 0x09, 0x97, 0x1A, 0xD7, 0x1E, 0x70,
+    0xAD, 0xA6, 0x72, 0x9D, 0xA7, 0x7C, 0x97, 0x5C, 0xA7, 0x5A, 0x97, 0x77, 0x77, 0x77, 0x70, 0x99,
+    0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D,
+    0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x70, 0xAD, 0x97,
+    0x39, 0xC7, 0x2A, 0xC7, 0x3A, 0x77, 0x77, 0x77, 0x77, 0x29, 0x71, 0x9F, 0xC6, 0xAC, 0xA9, 0x1A,
+    0xC4, 0xAC, 0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9, 0x2F, 0xFD, 0xA1, 0x9E, 0xAA, 0xAA, 0x99,
+    0x92, 0xAC, 0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39, 0xFF, 0xC4, 0xAF, 0xEA, 0x59, 0xAE, 0xA9,
+    0x30, 0x77, 0x72, 0xD9, 0x1C, 0x97, 0x0C, 0xA0, 0xC0, 0x9C, 0x70, 0x9C, 0x19, 0xD9, 0x71, 0x97,
+    0x77, 0x77, 0x73, 0x99, 0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49,
+    0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74,
+    0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE,
+    0x93, 0x6A, 0xCA, 0x19, 0xC5, 0x9C, 0x0A, 0xA0, 0xC9, 0x5C, 0xA1, 0xE6, 0x97, 0x77, 0x77, 0x77,
+    0x09, 0x71, 0x9F, 0xC6, 0xAC, 0xA9, 0x1A, 0xC4, 0xAC, 0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9,
+    0x2F, 0xFD, 0xA1, 0x9E, 0xAA, 0xAA, 0x99, 0x92, 0xAC, 0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39,
+    0xFF, 0xC4, 0xAF, 0xEA, 0x59, 0xAE, 0xA9, 0x30, 0x75, 0xAC, 0x75, 0x9C, 0x97, 0x5C, 0xA7, 0x5D,
+    0x77, 0x77, 0x76, 0xAC, 0x76, 0xE7, 0x4C, 0xA0, 0xAC, 0x97, 0x1A, 0xA3, 0xAA, 0x74, 0x99, 0x99,
+    0x6F, 0xFD, 0x59, 0xFF, 0xCA, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x99,
+    0x9A, 0xA7, 0x0F, 0xF7, 0x9F, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0xAA,
+    0xAA, 0xAA, 0xA5, 0x9F, 0xFD, 0x94, 0xAF, 0xFD, 0x94, 0xFF, 0xE9, 0x30, 0x77, 0x19, 0xC7, 0x72,
+    0xC9, 0x77, 0x1D, 0x70, 0x9C, 0x95, 0xAC, 0x97, 0x0E, 0x97, 0x7A, 0xC9, 0x9C, 0xA7, 0x59, 0xC3,
+    0x9C, 0x77, 0x77, 0x49, 0x77, 0x09, 0xFC, 0x75, 0xAC, 0xA9, 0x1A, 0xC7, 0x3A, 0xC9, 0x4C, 0x97,
+    0x19, 0xCA, 0x29, 0x9A, 0xC9, 0x71, 0xFF, 0xDA, 0x70, 0x9E, 0xAA, 0xAA, 0x99, 0x97, 0x1A, 0xC9,
+    0x77, 0x1D, 0x97, 0x71, 0xAD, 0x94, 0x97, 0x29, 0xFF, 0xC7, 0x3A, 0xFE, 0xA7, 0x49, 0xAE, 0xA9,
+    0x72, 0x71, 0x9A, 0x76, 0x9D, 0x76, 0xAD, 0x76, 0x99, 0xA7, 0x3A, 0xC7, 0x6E, 0x74, 0xCA, 0x0A,
+    0xC9, 0x71, 0xAA, 0x3A, 0xA7, 0x49, 0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D,
+    0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D, 0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75,
+    0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9,
+    0x4F, 0xFE, 0x93, 0x77, 0x3D, 0x97, 0x3D, 0x97, 0x29, 0xAC, 0x97, 0x19, 0xC9, 0x72, 0xE9, 0x70,
+    0xAC, 0x99, 0xCA, 0x69, 0xC3, 0x9C, 0x77, 0x69, 0x71, 0x9F, 0xC6, 0xAC, 0xA9, 0x1A, 0xC4, 0xAC,
+    0x94, 0xC9, 0x29, 0xCA, 0x29, 0x9A, 0xC9, 0x2F, 0xFD, 0xA1, 0x9E, 0xAA, 0xAA, 0x99, 0x92, 0xAC,
+    0x97, 0x2D, 0x97, 0x2A, 0xD9, 0x49, 0x39, 0xFF, 0xC4, 0xAF, 0xEA, 0x59, 0xAE, 0xA9, 0x30, 0x73,
+    0x9A, 0xA7, 0x59, 0x09, 0xC7, 0x6C, 0xA7, 0x5C, 0x97, 0x69, 0x77, 0x75, 0xAC, 0x76, 0xE7, 0x4C,
+    0xA0, 0xAC, 0x97, 0x1A, 0xA3, 0xAA, 0x74, 0x99, 0x99, 0x6F, 0xFD, 0x59, 0xFF, 0xCA, 0x5A, 0xCA,
+    0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x99, 0x9A, 0xA7, 0x0F, 0xF7, 0x9F, 0xEA, 0x7D,
+    0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0xAA, 0xAA, 0xAA, 0xA5, 0x9F, 0xFD, 0x94, 0xAF,
+    0xFD, 0x94, 0xFF, 0xE9, 0x30, 0x72, 0xAA, 0xA7, 0x5A, 0xA7, 0x3A, 0xC7, 0x39, 0xA7, 0x0A, 0xC7,
+    0x4E, 0x72, 0xD0, 0xAC, 0x97, 0xAA, 0x3A, 0xA7, 0x77, 0x77, 0x76, 0x97, 0x29, 0xFC, 0x7A, 0xCA,
+    0x91, 0xAC, 0x5A, 0xC9, 0x4C, 0x93, 0x9C, 0xA2, 0x99, 0xAC, 0x93, 0xFF, 0xDA, 0x29, 0xEA, 0xAA,
+    0xA9, 0x99, 0x3A, 0xC9, 0x73, 0xD9, 0x73, 0xAD, 0x94, 0x94, 0x9F, 0xFC, 0x5A, 0xFE, 0xA6, 0x9A,
+    0xEA, 0x94, 0x77, 0x71, 0xD9, 0x1C, 0x97, 0x0C, 0xA0, 0xC0, 0x9C, 0x70, 0x9C, 0x19, 0xD9, 0x71,
+    0x97, 0x77, 0x71, 0xAC, 0x76, 0xE7, 0x4A, 0xC0, 0x9C, 0x97, 0x1A, 0xC3, 0xAA, 0x77, 0x75, 0x99,
+    0x99, 0x96, 0xFF, 0xD5, 0x9F, 0xFC, 0xA5, 0xAC, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5D,
+    0xA9, 0x99, 0xAA, 0x70, 0xFF, 0x79, 0xFE, 0xA7, 0xDA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x59, 0xFF, 0xD9, 0x4A, 0xFF, 0xD9, 0x4F, 0xFE, 0x93, 0x77, 0x2A, 0xD1,
+    0x9C, 0x49, 0xC0, 0xAA, 0x0C, 0x94, 0xC9, 0x1E, 0x59, 0x77, 0x72, 0xCA, 0x71, 0xAD, 0x97, 0x9C,
+    0x99, 0xCA, 0x6C, 0x92, 0x9C, 0x77, 0x77, 0x29, 0x70, 0x9F, 0xC5, 0xAC, 0xA9, 0x1A, 0xC3, 0xAC,
+    0x94, 0xC9, 0x19, 0xCA, 0x29, 0x9A, 0xC9, 0x1F, 0xFD, 0xA0, 0x9E, 0xAA, 0xAA, 0x99, 0x91, 0xAC,
+    0x97, 0x1D, 0x97, 0x1A, 0xD9, 0x49, 0x29, 0xFF, 0xC3, 0xAF, 0xEA, 0x49, 0xAE, 0xA9, 0x20, 0x77,
+    0x72, 0xAC, 0x76, 0xE7, 0x4C, 0xA0, 0xAC, 0x97, 0x1A, 0xA3, 0xAA, 0x74, 0x99, 0x99, 0x6F, 0xFD,
+    0x59, 0xFF, 0xCA, 0x5A, 0xCA, 0x75, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x75, 0xDA, 0x99, 0x9A, 0xA7,
+    0x0F, 0xF7, 0x9F, 0xEA, 0x7D, 0xA7, 0x5D, 0x97, 0x49, 0xD7, 0x5A, 0xD7, 0x5E, 0xAA, 0xAA, 0xAA,
+    0xA5, 0x9F, 0xFD, 0x94, 0xAF, 0xFD, 0x94, 0xFF, 0xE9, 0x77, 0x71, 0x99, 0x76, 0xD9, 0x74, 0xAD,
+    0x75, 0xE7, 0x10, 0x70, 0xCA, 0x73, 0x9D, 0xA7, 0x2C, 0xA0, 0xAC, 0x70, 0xC9, 0x29, 0xC9, 0x77,
+    0x77, 0x77, 0x49, 0x72, 0x9F, 0xC7, 0xAC, 0xA9, 0x1A, 0xC5, 0xAC, 0x94, 0xC9, 0x39, 0xCA, 0x29,
+    0x9A, 0xC9, 0x3F, 0xFD, 0xA2, 0x9E, 0xAA, 0xAA, 0x99, 0x93, 0xAC, 0x97, 0x3D, 0x97, 0x3A, 0xD9,
+    0x49, 0x49, 0xFF, 0xC5, 0xAF, 0xEA, 0x69, 0xAE, 0xA9, 0x77, 0x77, 0x69, 0x97, 0x3A, 0xD7, 0x3E,
+    0x72, 0xAD, 0xA7, 0x00, 0x7A, 0xA9, 0x79, 0x1C, 0x97, 0x0A, 0xC7, 0x0A, 0xA7, 0x77, 0x77, 0x77,
+    0x72, 0x9D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D, 0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x0D,
+    0xA7, 0x9D, 0x97, 0xAD, 0x70, 0xE7, 0x9D, 0xA7, 0xAD, 0xA7, 0xE9, 0x69, 0xE7, 0xAE, 0x7A, 0xDA,
+    0x60, 0x49, 0xDA, 0x70, 0xC9, 0x59, 0xC9, 0x6A, 0x97, 0x77, 0x73, 0x99, 0x7A, 0xC7, 0xCA, 0x7C,
+    0x96, 0xAC, 0x7D, 0x7C, 0xA6, 0xAC, 0x96, 0xD9, 0x6D, 0x6A, 0xD6, 0xAC, 0xA5, 0x59, 0xDA, 0x59,
+    0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE6, 0xDA, 0x59, 0xD9, 0x5A, 0xD6, 0xE5,
+    0x9D, 0xA5, 0xAD, 0xA5, 0xE9, 0x49, 0xE5, 0xAE, 0x5A, 0xDA, 0x77, 0x99, 0x69, 0xD6, 0xE5, 0x9E,
+    0x50, 0x6D, 0x95, 0xAD, 0x6E, 0x69, 0x99, 0x77, 0x72, 0x97, 0xAC, 0x7D, 0x7C, 0x96, 0xAC, 0x7D,
+    0x7C, 0xA6, 0xAC, 0x96, 0xD9, 0x6D, 0x6A, 0xD6, 0xAC, 0xA7, 0x70, 0x99, 0x69, 0xD6, 0xE5, 0x9E,
+    0x50, 0x70, 0xAF, 0xCA, 0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9,
+    0x69, 0xDA, 0x49, 0xDA, 0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9,
+    0x3D, 0xA7, 0x1A, 0xD4, 0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9,
+    0x9A, 0xAF, 0x95, 0xFF, 0xFC, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77,
+    0x77, 0x77, 0x09, 0x97, 0x71, 0x9D, 0x77, 0x1E, 0x77, 0x09, 0xE7, 0x40, 0x49, 0xAE, 0xA6, 0xAF,
+    0xDA, 0x4A, 0xCA, 0x3D, 0x3A, 0xCA, 0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A,
+    0xC9, 0x5D, 0x2A, 0xC9, 0x49, 0xCA, 0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA,
+    0x77, 0x77, 0x77, 0x2D, 0x97, 0x19, 0xD9, 0x71, 0xE7, 0x29, 0x99, 0x70, 0x73, 0x9D, 0xA7, 0x73,
+    0xC9, 0x77, 0x09, 0xC9, 0x77, 0x19, 0x97, 0x77, 0x77, 0x77, 0x77, 0x5A, 0xFC, 0xA7, 0x3A, 0xFF,
+    0xC9, 0x70, 0xEA, 0x92, 0xAE, 0x7E, 0xA5, 0xE9, 0x5E, 0x96, 0x9D, 0xA4, 0x9D, 0xA7, 0x0D, 0xA4,
+    0xE7, 0x1D, 0xA4, 0xD9, 0x71, 0xD9, 0x3A, 0xD7, 0x2D, 0x93, 0xDA, 0x71, 0xAD, 0x4D, 0xA7, 0x1D,
+    0xA4, 0xDA, 0x70, 0xAD, 0x94, 0xE7, 0xAE, 0x5F, 0xAA, 0x99, 0xAA, 0xF9, 0x5F, 0xFF, 0xCA, 0x6A,
+    0xFF, 0xF7, 0x0F, 0xFD, 0xA7, 0x29, 0xAF, 0xCA, 0x77, 0x75, 0x70, 0xDA, 0x97, 0x3A, 0xA7, 0x2A,
+    0xC7, 0x29, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x59, 0xAE, 0xA6, 0xAF, 0xDA, 0x4A, 0xCA, 0x3D, 0x3A,
+    0xCA, 0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A, 0xC9, 0x5D, 0x2A, 0xC9, 0x49,
+    0xCA, 0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA, 0x50, 0x72, 0xAC, 0x77, 0x6E,
+    0x77, 0x4D, 0x0A, 0xC9, 0x77, 0x1A, 0xA3, 0xA9, 0x77, 0x77, 0x71, 0xAF, 0xCA, 0x77, 0xAF, 0xFC,
+    0x93, 0xAC, 0x6E, 0xA9, 0x2A, 0xE2, 0x9C, 0x6E, 0xA5, 0xE9, 0x1C, 0xA5, 0xE9, 0x69, 0xDA, 0x0D,
+    0x59, 0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x1D, 0xA7, 0x0D, 0x97, 0x1D, 0x97, 0xAD, 0x72, 0xD9, 0x7D,
+    0xA7, 0x1A, 0xD7, 0x0D, 0xA7, 0x1D, 0xA7, 0x0D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0xAE, 0x71, 0xFA,
+    0xA9, 0x9A, 0xAF, 0x97, 0x1F, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0x74, 0xFF, 0xDA, 0x76, 0x9A, 0xFC,
+    0xA7, 0x77, 0x75, 0x77, 0x19, 0xC7, 0x72, 0xCA, 0x79, 0xC9, 0x6D, 0x70, 0xE9, 0x4A, 0xC9, 0x7A,
+    0xC0, 0x9C, 0xA7, 0x59, 0xC3, 0xAA, 0x77, 0x77, 0x77, 0x69, 0xAE, 0xA7, 0x5A, 0xFD, 0xA7, 0x3A,
+    0xCA, 0x3D, 0x72, 0xAC, 0xA4, 0x9C, 0xA7, 0x1D, 0x59, 0xC9, 0x70, 0x9C, 0xA5, 0xAC, 0x97, 0x0A,
+    0xC9, 0x5D, 0x71, 0xAC, 0x94, 0x9C, 0xA7, 0x1A, 0xD3, 0xAD, 0x97, 0x19, 0xFF, 0xA7, 0x3F, 0xEA,
+    0x75, 0xAE, 0xA7, 0x40, 0x70, 0x97, 0x73, 0xD9, 0x77, 0x2D, 0x97, 0x71, 0x9A, 0xA7, 0x77, 0x77,
+    0xAC, 0x77, 0x2E, 0x77, 0x0D, 0x0A, 0xC9, 0x75, 0xAA, 0x3A, 0x97, 0x77, 0x71, 0xAF, 0xCA, 0x73,
+    0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70,
+    0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA,
+    0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC,
+    0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x59, 0x74, 0xD7, 0x39,
+    0xD7, 0x39, 0xAA, 0x72, 0x9C, 0x97, 0x2E, 0x97, 0x0A, 0xC0, 0x9C, 0xA6, 0x9C, 0x3A, 0xA7, 0x77,
+    0x71, 0x9A, 0xEA, 0x6A, 0xFD, 0xA4, 0xAC, 0xA3, 0xD3, 0xAC, 0xA4, 0x9C, 0xA2, 0xD5, 0x9C, 0x91,
+    0x9C, 0xA5, 0xAC, 0x91, 0xAC, 0x95, 0xD2, 0xAC, 0x94, 0x9C, 0xA2, 0xAD, 0x3A, 0xD9, 0x29, 0xFF,
+    0xA4, 0xFE, 0xA6, 0xAE, 0xA5, 0x77, 0x39, 0xAA, 0x97, 0x74, 0x90, 0x9C, 0x77, 0x5A, 0xC7, 0x76,
+    0xA7, 0x5A, 0xC7, 0x76, 0xE7, 0x74, 0xD0, 0xAC, 0x97, 0x71, 0xAA, 0x3A, 0x97, 0x77, 0x77, 0x1A,
+    0xFC, 0xA7, 0x7A, 0xFF, 0xC9, 0x74, 0xEA, 0x92, 0xAE, 0x73, 0xEA, 0x5E, 0x97, 0x1E, 0x96, 0x9D,
+    0xA7, 0x09, 0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x1D, 0xA7, 0x0D, 0x97, 0x1D, 0x97, 0xAD, 0x72, 0xD9,
+    0x7D, 0xA7, 0x1A, 0xD7, 0x0D, 0xA7, 0x1D, 0xA7, 0x0D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0xAE, 0x71,
+    0xFA, 0xA9, 0x9A, 0xAF, 0x97, 0x1F, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0x74, 0xFF, 0xDA, 0x76, 0x9A,
+    0xFC, 0xA7, 0x77, 0x75, 0x72, 0xAA, 0x97, 0x29, 0x1C, 0x97, 0x3A, 0xA7, 0x3A, 0x97, 0x0D, 0x74,
+    0xE7, 0x2C, 0xA0, 0xAC, 0x70, 0xAA, 0x3C, 0x97, 0x77, 0x77, 0x77, 0x72, 0x9A, 0xEA, 0x7A, 0xFD,
+    0xA5, 0xAC, 0xA3, 0xD4, 0xAC, 0xA4, 0x9C, 0xA3, 0xD5, 0x9C, 0x92, 0x9C, 0xA5, 0xAC, 0x92, 0xAC,
+    0x95, 0xD3, 0xAC, 0x94, 0x9C, 0xA3, 0xAD, 0x3A, 0xD9, 0x39, 0xFF, 0xA5, 0xFE, 0xA7, 0xAE, 0xA6,
+    0x77, 0x76, 0xD9, 0x1A, 0x97, 0x4C, 0xA0, 0xC1, 0xC7, 0x49, 0xC1, 0x9D, 0x97, 0x77, 0x77, 0x77,
+    0x0A, 0xC7, 0x72, 0xE9, 0x77, 0xAC, 0x09, 0xC9, 0x75, 0xAC, 0x3A, 0xA7, 0x77, 0x72, 0xAF, 0xCA,
+    0x73, 0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA,
+    0x70, 0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4,
+    0xDA, 0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF,
+    0xFC, 0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x50, 0x5A, 0xC9, 0x19,
+    0xA5, 0x9C, 0x0C, 0x1A, 0x95, 0xC9, 0x0A, 0xA9, 0xC6, 0xA2, 0xD9, 0x77, 0x59, 0xC9, 0x72, 0xAD,
+    0x97, 0x09, 0xC9, 0x9C, 0xA7, 0xC3, 0xAA, 0x77, 0x77, 0x77, 0x09, 0xAE, 0xA6, 0xAF, 0xDA, 0x4A,
+    0xCA, 0x3D, 0x3A, 0xCA, 0x49, 0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A, 0xC9, 0x5D,
+    0x2A, 0xC9, 0x49, 0xCA, 0x2A, 0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA, 0x50, 0x72,
+    0xAC, 0x77, 0x2E, 0x77, 0x0D, 0x0A, 0xC9, 0x75, 0xAA, 0x3A, 0x97, 0x77, 0x71, 0xAF, 0xCA, 0x73,
+    0xAF, 0xFC, 0x97, 0x0E, 0xA9, 0x2A, 0xE7, 0xEA, 0x5E, 0x95, 0xE9, 0x69, 0xDA, 0x49, 0xDA, 0x70,
+    0xDA, 0x4E, 0x71, 0xDA, 0x4D, 0x97, 0x1D, 0x93, 0xAD, 0x72, 0xD9, 0x3D, 0xA7, 0x1A, 0xD4, 0xDA,
+    0x71, 0xDA, 0x4D, 0xA7, 0x0A, 0xD9, 0x4E, 0x7A, 0xE5, 0xFA, 0xA9, 0x9A, 0xAF, 0x95, 0xFF, 0xFC,
+    0xA6, 0xAF, 0xFF, 0x70, 0xFF, 0xDA, 0x72, 0x9A, 0xFC, 0xA7, 0x77, 0x77, 0x77, 0x09, 0x97, 0x71,
+    0x9D, 0x77, 0x1E, 0x77, 0x09, 0xE7, 0x40, 0x77, 0x49, 0xC9, 0x72, 0xE9, 0x70, 0xAC, 0x09, 0xCA,
+    0x69, 0xC3, 0xAA, 0x77, 0x77, 0x19, 0xAE, 0xA6, 0xAF, 0xDA, 0x4A, 0xCA, 0x3D, 0x3A, 0xCA, 0x49,
+    0xCA, 0x2D, 0x59, 0xC9, 0x19, 0xCA, 0x5A, 0xC9, 0x1A, 0xC9, 0x5D, 0x2A, 0xC9, 0x49, 0xCA, 0x2A,
+    0xD3, 0xAD, 0x92, 0x9F, 0xFA, 0x4F, 0xEA, 0x6A, 0xEA, 0x77, 0x77, 0x69, 0x99, 0x72, 0xDA, 0x71,
+    0x9D, 0x97, 0x1E, 0x95, 0x77, 0x77, 0x72, 0xAC, 0x77, 0x59, 0xC9, 0x77, 0x5C, 0xA7, 0x75, 0xD7,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x09, 0xC7, 0x0A, 0xFC, 0xA6, 0xAA, 0x6A, 0xFF, 0xC9, 0x39,
+    0xC9, 0x5E, 0xA9, 0x2A, 0xE2, 0x9C, 0xA5, 0xEA, 0x5E, 0x91, 0xCA, 0x5E, 0x96, 0x9D, 0xA7, 0x09,
+    0xDA, 0x70, 0xDA, 0x70, 0xE7, 0x1D, 0xA7, 0x0D, 0x97, 0x1D, 0x97, 0xAD, 0x72, 0xD9, 0x7D, 0xA7,
+    0x1A, 0xD7, 0x0D, 0xA7, 0x1D, 0xA7, 0x0D, 0xA7, 0x0A, 0xD9, 0x70, 0xE7, 0xAE, 0x71, 0xFA, 0xA9,
+    0x9A, 0xAF, 0x97, 0x1F, 0xFF, 0xCA, 0x72, 0xAF, 0xFF, 0x74, 0xFF, 0xDA, 0x76, 0x9A, 0xFC, 0xA7,
+    0x77, 0x75, 0x77, 0x72, 0xAA, 0x74, 0x9C, 0x74, 0x9C, 0xA7, 0x4D, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x2A, 0x59, 0xAE, 0xA2, 0xC4, 0xAF, 0xE0, 0xAA, 0x3A, 0xCA, 0x3F, 0x3A, 0xCA, 0x49, 0xCA, 0x4D,
+    0x59, 0xCA, 0x39, 0xCA, 0x5A, 0xC9, 0x3A, 0xC9, 0x5D, 0x4A, 0xC9, 0x49, 0xCA, 0x4A, 0xD3, 0xAD,
+    0x94, 0x9F, 0xFA, 0x6F, 0xEA, 0x70, 0xAE, 0xA7, 0x76, 0x97, 0x76, 0x9C, 0xA7, 0x76, 0xAD, 0x77,
+    0x6A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x76, 0x9C, 0x70, 0xAF, 0xCA, 0x6A, 0xA6, 0xAF, 0xFC, 0x93,
+    0x9C, 0x95, 0xEA, 0x92, 0xAE, 0x29, 0xCA, 0x5E, 0xA5, 0xE9, 0x1C, 0xA5, 0xE9, 0x69, 0xDA, 0x70,
+    0x9D, 0xA7, 0x0D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xD9, 0x71, 0xD9, 0x7A, 0xD7, 0x2D, 0x97, 0xDA,
+    0x71, 0xAD, 0x70, 0xDA, 0x71, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x7A, 0xE7, 0x1F, 0xAA,
+    0x99, 0xAA, 0xF9, 0x71, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xF7, 0x4F, 0xFD, 0xA7, 0x69, 0xAF, 0xCA,
+    0x77, 0x77, 0x50, 0x69, 0x97, 0x59, 0xCA, 0x75, 0xAD, 0x75, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x71,
+    0xA5, 0x9A, 0xEA, 0x2C, 0x4A, 0xFE, 0x0A, 0xA3, 0xAC, 0xA3, 0xF3, 0xAC, 0xA4, 0x9C, 0xA4, 0xD5,
+    0x9C, 0xA3, 0x9C, 0xA5, 0xAC, 0x93, 0xAC, 0x95, 0xD4, 0xAC, 0x94, 0x9C, 0xA4, 0xAD, 0x3A, 0xD9,
+    0x49, 0xFF, 0xA6, 0xFE, 0xA7, 0x0A, 0xEA, 0x70, 0x77, 0x9A, 0xA7, 0x75, 0x90, 0x9C, 0x77, 0x59,
+    0xC9, 0x77, 0x5C, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x9C, 0x70, 0xAF, 0xCA, 0x6A, 0xA6,
+    0xAF, 0xFC, 0x93, 0x9C, 0x95, 0xEA, 0x92, 0xAE, 0x29, 0xCA, 0x5E, 0xA5, 0xE9, 0x1C, 0xA5, 0xE9,
+    0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x0D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xD9, 0x71, 0xD9, 0x7A, 0xD7,
+    0x2D, 0x97, 0xDA, 0x71, 0xAD, 0x70, 0xDA, 0x71, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x7A,
+    0xE7, 0x1F, 0xAA, 0x99, 0xAA, 0xF9, 0x71, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xF7, 0x4F, 0xFD, 0xA7,
+    0x69, 0xAF, 0xCA, 0x77, 0x77, 0x50, 0x70, 0xDA, 0x97, 0x5A, 0xA7, 0x4A, 0xC7, 0x49, 0xA7, 0x77,
+    0x77, 0x77, 0x77, 0x72, 0xA5, 0x9A, 0xEA, 0x2C, 0x4A, 0xFE, 0x0A, 0xA3, 0xAC, 0xA3, 0xF3, 0xAC,
+    0xA4, 0x9C, 0xA4, 0xD5, 0x9C, 0xA3, 0x9C, 0xA5, 0xAC, 0x93, 0xAC, 0x95, 0xD4, 0xAC, 0x94, 0x9C,
+    0xA4, 0xAD, 0x3A, 0xD9, 0x49, 0xFF, 0xA6, 0xFE, 0xA7, 0x0A, 0xEA, 0x70, 0x75, 0xAC, 0xA1, 0x9C,
+    0x77, 0x09, 0xC9, 0xC9, 0x0A, 0xA7, 0x70, 0xAA, 0x09, 0xC9, 0xC7, 0x71, 0xC9, 0x1A, 0xCA, 0x77,
+    0x77, 0x77, 0x77, 0x75, 0x9A, 0x70, 0xAF, 0xCA, 0x6A, 0xA6, 0xAF, 0xFC, 0x93, 0x9C, 0x95, 0xEA,
+    0x92, 0xAE, 0x29, 0xCA, 0x5E, 0xA5, 0xE9, 0x1C, 0xA5, 0xE9, 0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x0D,
+    0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xD9, 0x71, 0xD9, 0x7A, 0xD7, 0x2D, 0x97, 0xDA, 0x71, 0xAD, 0x70,
+    0xDA, 0x71, 0xDA, 0x70, 0xDA, 0x70, 0xAD, 0x97, 0x0E, 0x7A, 0xE7, 0x1F, 0xAA, 0x99, 0xAA, 0xF9,
+    0x71, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF, 0xF7, 0x4F, 0xFD, 0xA7, 0x69, 0xAF, 0xCA, 0x77, 0x77, 0x50,
+    0x6A, 0xC9, 0x19, 0xA7, 0x9C, 0x0C, 0x1A, 0x97, 0xC9, 0x0A, 0xA9, 0xC7, 0x0A, 0x2D, 0x97, 0x77,
+    0x77, 0x77, 0x70, 0x95, 0x9A, 0xEA, 0x2C, 0x4A, 0xFE, 0x0A, 0xA3, 0xAC, 0xA3, 0xF3, 0xAC, 0xA4,
+    0x9C, 0xA4, 0xD5, 0x9C, 0xA3, 0x9C, 0xA5, 0xAC, 0x93, 0xAC, 0x95, 0xD4, 0xAC, 0x94, 0x9C, 0xA4,
+    0xAD, 0x3A, 0xD9, 0x49, 0xFF, 0xA6, 0xFE, 0xA7, 0x0A, 0xEA, 0x70, 0x77, 0x77, 0x77, 0x9C, 0x70,
+    0xAF, 0xCA, 0x6A, 0xA6, 0xAF, 0xFC, 0x93, 0x9C, 0x95, 0xEA, 0x92, 0xAE, 0x29, 0xCA, 0x5E, 0xA5,
+    0xE9, 0x1C, 0xA5, 0xE9, 0x69, 0xDA, 0x70, 0x9D, 0xA7, 0x0D, 0xA7, 0x0E, 0x71, 0xDA, 0x70, 0xD9,
+    0x71, 0xD9, 0x7A, 0xD7, 0x2D, 0x97, 0xDA, 0x71, 0xAD, 0x70, 0xDA, 0x71, 0xDA, 0x70, 0xDA, 0x70,
+    0xAD, 0x97, 0x0E, 0x7A, 0xE7, 0x1F, 0xAA, 0x99, 0xAA, 0xF9, 0x71, 0xFF, 0xFC, 0xA7, 0x2A, 0xFF,
+    0xF7, 0x4F, 0xFD, 0xA7, 0x69, 0xAF, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x49, 0x97, 0x75, 0x9D, 0x77,
+    0x5E, 0x77, 0x49, 0xE7, 0x70, 0x75, 0xA5, 0x9A, 0xEA, 0x2C, 0x4A, 0xFE, 0x0A, 0xA3, 0xAC, 0xA3,
+    0xF3, 0xAC, 0xA4, 0x9C, 0xA4, 0xD5, 0x9C, 0xA3, 0x9C, 0xA5, 0xAC, 0x93, 0xAC, 0x95, 0xD4, 0xAC,
+    0x94, 0x9C, 0xA4, 0xAD, 0x3A, 0xD9, 0x49, 0xFF, 0xA6, 0xFE, 0xA7, 0x0A, 0xEA, 0x77, 0x77, 0x77,
+    0x72, 0xD9, 0x73, 0x9D, 0x97, 0x3E, 0x74, 0x99, 0x97, 0x20, 0x39, 0xAA, 0xA6, 0xAA, 0xA9, 0x3A,
+    0xDA, 0x6E, 0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE6,
+    0x9E, 0x4E, 0x69, 0xD9, 0x39, 0xDA, 0x6A, 0xD4, 0x9D, 0x96, 0xE4, 0xAD, 0x69, 0xD9, 0x4E, 0x6A,
+    0xD5, 0xDA, 0x6E, 0x49, 0xE4, 0x9E, 0x94, 0x9F, 0xFF, 0x59, 0xFF, 0xEA, 0x6F, 0xFE, 0x79, 0xFF,
+    0xA7, 0x77, 0x77, 0x71, 0x99, 0x77, 0x9D, 0x77, 0xE7, 0x69, 0xE7, 0x30, 0x2D, 0x49, 0xD1, 0x9D,
+    0x4A, 0xCA, 0x19, 0xCA, 0x4D, 0x91, 0xAC, 0x94, 0xD2, 0xD4, 0x9D, 0x2D, 0x4A, 0xCA, 0x19, 0xD4,
+    0xD9, 0x19, 0xCA, 0x3A, 0xD2, 0xAE, 0xAF, 0xC2, 0xAF, 0xFC, 0x29, 0xFF, 0xA3, 0xAE, 0xA0, 0xD9,
+    0x77, 0x76, 0xD9, 0x70, 0xAD, 0x71, 0xE7, 0x19, 0x99, 0x70, 0x73, 0xAA, 0xA7, 0x79, 0x0A, 0xA7,
+    0x79, 0xC9, 0x76, 0x9C, 0x77, 0x77, 0x77, 0x77, 0x77, 0x49, 0xAA, 0xA6, 0xAA, 0xA9, 0x3A, 0xDA,
+    0x6E, 0x93, 0xE9, 0x59, 0xE4, 0xE6, 0xAD, 0xA3, 0x9E, 0x6E, 0x93, 0xAD, 0x96, 0xE4, 0xE6, 0x9D,
+    0xA4, 0xE6, 0xAD, 0x93, 0x9D, 0xA6, 0xAD, 0x49, 0xD9, 0x6E, 0x4A, 0xD6, 0x9D, 0x94, 0xE6, 0xAD,
+    0x5D, 0xA6, 0xE4, 0x9E, 0x49, 0xE9, 0x49, 0xFF, 0xF5, 0x9F, 0xFE, 0xA6, 0xFF, 0xE7, 0x9F, 0xFA,
+    0x77, 0x71, 0x7A, 0xCA, 0x97, 0x2A, 0xA7, 0x1C, 0xA7, 0x29, 0x77, 0x77, 0x74, 0xD4, 0x9D, 0x19,
+    0xD4, 0xAC, 0xA1, 0x9C, 0xA4, 0xD9, 0x1A, 0xC9, 0x4D, 0x2D, 0x49, 0xD2, 0xD4, 0xAC, 0xA1, 0x9D,
+    0x4D, 0x91, 0x9C, 0xA3, 0xAD, 0x2A, 0xEA, 0xFC, 0x2A, 0xFF, 0xC2, 0x9F, 0xFA, 0x3A, 0xEA, 0x0D,
+    0x91, 0x75, 0xAC, 0x77, 0x29, 0xC7, 0x73, 0xCA, 0x77, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x39, 0xE6, 0xEA, 0x0C, 0x93, 0xAD, 0xA6, 0xE9, 0x9C, 0x4E, 0x95, 0x9F, 0xC9, 0x4E, 0x6A, 0xDA,
+    0x69, 0xDA, 0x6E, 0x96, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA7, 0xE6, 0xAD, 0x96, 0x9D, 0xA6, 0xE7,
+    0xAD, 0x7E, 0x7A, 0xD6, 0x9D, 0x97, 0xE6, 0xAD, 0x70, 0xDA, 0x6E, 0x79, 0xE4, 0x9E, 0x97, 0x9F,
+    0xFF, 0x70, 0x9F, 0xFE, 0xA7, 0x1F, 0xFE, 0x72, 0x9F, 0xFA, 0x77, 0x77, 0x71, 0xAC, 0x74, 0x9C,
+    0x75, 0xCA, 0x74, 0xD7, 0x77, 0x77, 0x77, 0x73, 0xC3, 0xD4, 0x9D, 0x9C, 0x29, 0xD4, 0xAE, 0x92,
+    0x9C, 0xA4, 0xE9, 0x3A, 0xC9, 0x4D, 0x5D, 0x49, 0xD5, 0xD4, 0xAC, 0xA4, 0x9D, 0x4D, 0x94, 0x9C,
+    0xA3, 0xAD, 0x5A, 0xEA, 0xFC, 0x5A, 0xFF, 0xC5, 0x9F, 0xFA, 0x6A, 0xEA, 0x0D, 0x94, 0x71, 0x99,
+    0x77, 0x39, 0xD7, 0x73, 0xAD, 0x77, 0x39, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x69, 0x49, 0xE6, 0xEA,
+    0x0A, 0x93, 0xAD, 0xA6, 0xE9, 0x9C, 0x4E, 0x95, 0x9F, 0xC9, 0x4E, 0x6A, 0xDA, 0x69, 0xDA, 0x6E,
+    0x96, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA7, 0xE6, 0xAD, 0x96, 0x9D, 0xA6, 0xE7, 0xAD, 0x7E, 0x7A,
+    0xD6, 0x9D, 0x97, 0xE6, 0xAD, 0x70, 0xDA, 0x6E, 0x79, 0xE4, 0x9E, 0x97, 0x9F, 0xFF, 0x70, 0x9F,
+    0xFE, 0xA7, 0x1F, 0xFE, 0x72, 0x9F, 0xFA, 0x77, 0x77, 0x5A, 0xC9, 0x75, 0xD9, 0x74, 0x9D, 0x97,
+    0x77, 0x77, 0x72, 0xC3, 0xD4, 0x9D, 0x9C, 0x29, 0xD4, 0xAE, 0x92, 0x9C, 0xA4, 0xE9, 0x3A, 0xC9,
+    0x4D, 0x5D, 0x49, 0xD5, 0xD4, 0xAC, 0xA4, 0x9D, 0x4D, 0x94, 0x9C, 0xA3, 0xAD, 0x5A, 0xEA, 0xFC,
+    0x5A, 0xFF, 0xC5, 0x9F, 0xFA, 0x6A, 0xEA, 0x0D, 0x94, 0x73, 0xAA, 0xA7, 0x72, 0x90, 0xAA, 0x77,
+    0x2A, 0xC7, 0x72, 0x9A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x94, 0x9E, 0x6E, 0xA0, 0xC9, 0x3A,
+    0xDA, 0x6E, 0x99, 0xC4, 0xE9, 0x59, 0xFC, 0x94, 0xE6, 0xAD, 0xA6, 0x9D, 0xA6, 0xE9, 0x6A, 0xD9,
+    0x6E, 0x7E, 0x69, 0xDA, 0x7E, 0x6A, 0xD9, 0x69, 0xDA, 0x6E, 0x7A, 0xD7, 0xE7, 0xAD, 0x69, 0xD9,
+    0x7E, 0x6A, 0xD7, 0x0D, 0xA6, 0xE7, 0x9E, 0x49, 0xE9, 0x79, 0xFF, 0xF7, 0x09, 0xFF, 0xEA, 0x71,
+    0xFF, 0xE7, 0x29, 0xFF, 0xA7, 0x77, 0x70, 0x7A, 0xCA, 0x97, 0x5A, 0xA7, 0x4C, 0xA7, 0x59, 0x77,
+    0x77, 0x77, 0x3C, 0x3D, 0x49, 0xD9, 0xC2, 0x9D, 0x4A, 0xE9, 0x29, 0xCA, 0x4E, 0x93, 0xAC, 0x94,
+    0xD5, 0xD4, 0x9D, 0x5D, 0x4A, 0xCA, 0x49, 0xD4, 0xD9, 0x49, 0xCA, 0x3A, 0xD5, 0xAE, 0xAF, 0xC5,
+    0xAF, 0xFC, 0x59, 0xFF, 0xA6, 0xAE, 0xA0, 0xD9, 0x40, 0x71, 0xAC, 0x91, 0x9A, 0x75, 0x9C, 0x0C,
+    0x1A, 0x97, 0x5C, 0x90, 0xAA, 0x9C, 0x76, 0xC2, 0xD9, 0x77, 0x77, 0x77, 0x77, 0x73, 0x9E, 0x6E,
+    0xA0, 0xC9, 0x3A, 0xDA, 0x6E, 0x99, 0xC4, 0xE9, 0x59, 0xFC, 0x94, 0xE6, 0xAD, 0xA6, 0x9D, 0xA6,
+    0xE9, 0x6A, 0xD9, 0x6E, 0x7E, 0x69, 0xDA, 0x7E, 0x6A, 0xD9, 0x69, 0xDA, 0x6E, 0x7A, 0xD7, 0xE7,
+    0xAD, 0x69, 0xD9, 0x7E, 0x6A, 0xD7, 0x0D, 0xA6, 0xE7, 0x9E, 0x49, 0xE9, 0x79, 0xFF, 0xF7, 0x09,
+    0xFF, 0xEA, 0x71, 0xFF, 0xE7, 0x29, 0xFF, 0xA7, 0x77, 0x70, 0x77, 0x5A, 0xCA, 0x19, 0xA7, 0xAC,
+    0x0C, 0x90, 0xC9, 0x7C, 0x91, 0xDA, 0x77, 0x77, 0x77, 0x1C, 0x3D, 0x49, 0xD9, 0xC2, 0x9D, 0x4A,
+    0xE9, 0x29, 0xCA, 0x4E, 0x93, 0xAC, 0x94, 0xD5, 0xD4, 0x9D, 0x5D, 0x4A, 0xCA, 0x49, 0xD4, 0xD9,
+    0x49, 0xCA, 0x3A, 0xD5, 0xAE, 0xAF, 0xC5, 0xAF, 0xFC, 0x59, 0xFF, 0xA6, 0xAE, 0xA0, 0xD9, 0x40,
+    0x77, 0x39, 0x49, 0xE6, 0xEA, 0x0A, 0x93, 0xAD, 0xA6, 0xE9, 0x9C, 0x4E, 0x95, 0x9F, 0xC9, 0x4E,
+    0x6A, 0xDA, 0x69, 0xDA, 0x6E, 0x96, 0xAD, 0x96, 0xE7, 0xE6, 0x9D, 0xA7, 0xE6, 0xAD, 0x96, 0x9D,
+    0xA6, 0xE7, 0xAD, 0x7E, 0x7A, 0xD6, 0x9D, 0x97, 0xE6, 0xAD, 0x70, 0xDA, 0x6E, 0x79, 0xE4, 0x9E,
+    0x97, 0x9F, 0xFF, 0x70, 0x9F, 0xFE, 0xA7, 0x1F, 0xFE, 0x72, 0x9F, 0xFA, 0x77, 0x77, 0x77, 0x72,
+    0x99, 0x77, 0x29, 0xD7, 0x72, 0xE7, 0x71, 0x9E, 0x76, 0x77, 0x75, 0xC3, 0xD4, 0x9D, 0x9C, 0x29,
+    0xD4, 0xAE, 0x92, 0x9C, 0xA4, 0xE9, 0x3A, 0xC9, 0x4D, 0x5D, 0x49, 0xD5, 0xD4, 0xAC, 0xA4, 0x9D,
+    0x4D, 0x94, 0x9C, 0xA3, 0xAD, 0x5A, 0xEA, 0xFC, 0x5A, 0xFF, 0xC5, 0x9F, 0xFA, 0x6A, 0xEA, 0x0D,
+    0x97, 0x77, 0x77, 0xD9, 0x73, 0xAD, 0x74, 0xE7, 0x49, 0x99, 0x72, 0x77, 0x4D, 0x74, 0x9D, 0x74,
+    0xAD, 0x77, 0x77, 0x77, 0x2D, 0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD, 0x4A, 0xD9,
+    0x29, 0xDA, 0x29, 0xDA, 0x4E, 0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79, 0xFC, 0x71,
+    0xF7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71,
+    0x7D, 0x75, 0x9D, 0x75, 0x9D, 0x97, 0x77, 0x77, 0x77, 0x76, 0xD6, 0xD4, 0xAC, 0x94, 0xAC, 0x94,
+    0x9D, 0x4D, 0x6D, 0x3D, 0x96, 0xD9, 0x19, 0xD7, 0xAC, 0xA1, 0xDA, 0x7A, 0xD0, 0x9D, 0x70, 0x9D,
+    0x9D, 0xA7, 0x1F, 0xC7, 0x2F, 0xA7, 0x2A, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x3A, 0xDA, 0x71, 0x9F,
+    0x79, 0xFD, 0x70, 0xAF, 0xA7, 0x1A, 0xAA, 0x97, 0x30, 0x2D, 0x97, 0xD9, 0x2D, 0xA6, 0xDA, 0x3E,
+    0x5A, 0xD4, 0xAD, 0x4A, 0xD9, 0x49, 0xDA, 0x29, 0xDA, 0x6E, 0x2E, 0x7E, 0x1E, 0x70, 0xE9, 0xE9,
+    0x70, 0xAF, 0xCA, 0x71, 0x9F, 0xC7, 0x3F, 0x74, 0xE9, 0x73, 0x9E, 0x74, 0xAD, 0xA7, 0x4E, 0x97,
+    0x3A, 0xE7, 0x4F, 0x73, 0xAE, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x99, 0x75, 0xAD, 0x75,
+    0xDA, 0x74, 0xAD, 0xA7, 0x40, 0x3D, 0x6D, 0x4A, 0xC9, 0x4A, 0xC9, 0x49, 0xD4, 0xD6, 0xD3, 0xD9,
+    0x6D, 0x91, 0x9D, 0x7A, 0xCA, 0x1D, 0xA7, 0xAD, 0x09, 0xD7, 0x09, 0xD9, 0xDA, 0x71, 0xFC, 0x72,
+    0xFA, 0x72, 0xAE, 0x73, 0xAD, 0xA7, 0x3E, 0x73, 0xAD, 0xA7, 0x19, 0xF2, 0x99, 0x29, 0xFD, 0x29,
+    0xD2, 0xAF, 0xA3, 0xE2, 0xAA, 0xA9, 0x49, 0xE2, 0x7A, 0xCA, 0x97, 0x4A, 0xC7, 0x3A, 0xA7, 0x49,
+    0x77, 0x77, 0x77, 0x77, 0x1D, 0x97, 0xD9, 0x0D, 0xA6, 0xDA, 0x1E, 0x5A, 0xD2, 0xAD, 0x4A, 0xD9,
+    0x29, 0xDA, 0x29, 0xDA, 0x4E, 0x2E, 0x5E, 0x1E, 0x6E, 0x9E, 0x96, 0xAF, 0xCA, 0x79, 0xFC, 0x71,
+    0xF7, 0x2E, 0x97, 0x19, 0xE7, 0x2A, 0xDA, 0x72, 0xE9, 0x71, 0xAE, 0x72, 0xF7, 0x1A, 0xEA, 0x71,
+    0x71, 0xAC, 0xAA, 0x75, 0x9C, 0x74, 0x9C, 0x97, 0x4A, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7D, 0x6D,
+    0x4A, 0xC9, 0x4A, 0xC9, 0x49, 0xD4, 0xD6, 0xD3, 0xD9, 0x6D, 0x91, 0x9D, 0x7A, 0xCA, 0x1D, 0xA7,
+    0xAD, 0x09, 0xD7, 0x09, 0xD9, 0xDA, 0x71, 0xFC, 0x72, 0xFA, 0x72, 0xAE, 0x73, 0xAD, 0xA7, 0x3E,
+    0x73, 0xAD, 0xA7, 0x19, 0xF7, 0x9F, 0xD7, 0x0A, 0xFA, 0x71, 0xAA, 0xA9, 0x73, 0x5A, 0xCA, 0x19,
+    0xC6, 0x9C, 0x0C, 0x1A, 0xA6, 0xCA, 0x09, 0xC9, 0xC7, 0xA2, 0xAC, 0xA7, 0x77, 0x77, 0x70, 0xD9,
+    0x7D, 0x90, 0xDA, 0x6D, 0xA1, 0xE5, 0xAD, 0x2A, 0xD4, 0xAD, 0x92, 0x9D, 0xA2, 0x9D, 0xA4, 0xE2,
+    0xE5, 0xE1, 0xE6, 0xE9, 0xE9, 0x6A, 0xFC, 0xA7, 0x9F, 0xC7, 0x1F, 0x72, 0xE9, 0x71, 0x9E, 0x72,
+    0xAD, 0xA7, 0x2E, 0x97, 0x1A, 0xE7, 0x2F, 0x71, 0xAE, 0xA7, 0x10, 0x77, 0x7A, 0xD2, 0xC7, 0x9C,
+    0x99, 0xC0, 0xAA, 0x7A, 0xA1, 0xE7, 0x19, 0x77, 0x77, 0x77, 0x77, 0x72, 0xD6, 0xD4, 0xAC, 0x94,
+    0xAC, 0x94, 0x9D, 0x4D, 0x6D, 0x3D, 0x96, 0xD9, 0x19, 0xD7, 0xAC, 0xA1, 0xDA, 0x7A, 0xD0, 0x9D,
+    0x70, 0x9D, 0x9D, 0xA7, 0x1F, 0xC7, 0x2F, 0xA7, 0x2A, 0xE7, 0x3A, 0xDA, 0x73, 0xE7, 0x3A, 0xDA,
+    0x71, 0x9F, 0x79, 0xFD, 0x70, 0xAF, 0xA7, 0x1A, 0xAA, 0x97, 0x30, 0x71, 0xAF, 0xFA, 0xFF, 0xC9,
+    0x71, 0xAF, 0xFA, 0xFF, 0xC9, 0x77, 0x0A, 0xFF, 0xFC, 0x1F, 0xFF, 0xCA, 0x00, 0x75, 0x9F, 0xFF,
+    0xAA, 0xFF, 0xF0, 0x77, 0x49, 0xFF, 0xFF, 0xE9, 0xAF, 0xFF, 0xFE, 0x00, 0x77, 0x49, 0xFF, 0xFF,
+    0xE9, 0xAF, 0xFF, 0xFE, 0x00, 0x5A, 0x93, 0xA9, 0x49, 0xC4, 0xC5, 0xAC, 0x3A, 0xC5, 0xCA, 0x3C,
+    0xA5, 0xC9, 0x3C, 0x94, 0x9C, 0x39, 0xC5, 0xAA, 0x3A, 0xA5, 0xC9, 0x3C, 0x94, 0x9C, 0x39, 0xC5,
+    0xAC, 0x3A, 0xC5, 0xCA, 0x3C, 0xA5, 0xC4, 0xC5, 0xAC, 0x3A, 0xC5, 0xCA, 0x3C, 0xA5, 0xC9, 0x3C,
+    0x94, 0x9C, 0x39, 0xC5, 0xAA, 0x3A, 0xA5, 0xC9, 0x3C, 0x94, 0x77, 0x2F, 0xFF, 0xDA, 0x09, 0xFF,
+    0xFD, 0x77, 0x77, 0x3F, 0xFF, 0xDA, 0x0A, 0xFF, 0xFD, 0x77, 0x20, 0x9E, 0x3E, 0x92, 0x9E, 0x3E,
+    0x39, 0xDA, 0x3E, 0x90, 0x2E, 0x91, 0xAE, 0x2E, 0x91, 0x9D, 0xA2, 0xE2, 0x9D, 0xA2, 0x2E, 0x91,
+    0xAE, 0x2E, 0x29, 0xDA, 0x2E, 0x2A, 0xDA, 0x20, 0x9E, 0x3E, 0x92, 0x9E, 0x3E, 0x39, 0xDA, 0x3E,
+    0x90, 0x9E, 0x09, 0xE3, 0xE9, 0x0E, 0x92, 0x9E, 0x0A, 0xDA, 0x3E, 0x1E, 0x39, 0xDA, 0x09, 0xDA,
+    0x3E, 0x90, 0xE0, 0x2E, 0x90, 0xE2, 0xAE, 0x0A, 0xDA, 0x2E, 0x90, 0xE2, 0x9D, 0xA0, 0x9D, 0xA2,
+    0xE1, 0xE2, 0x9D, 0xA0, 0xAD, 0xA2, 0x2E, 0x91, 0xAE, 0x2E, 0x29, 0xDA, 0x2E, 0x2A, 0xDA, 0x20,
+    0x9E, 0x09, 0xE3, 0xEA, 0x0E, 0xA3, 0xE1, 0xE3, 0xAD, 0x90, 0xAD, 0x93, 0xE1, 0xE3, 0xAD, 0x90,
+    0xAD, 0x90, 0x6D, 0x71, 0xCA, 0x70, 0x9C, 0x97, 0x0A, 0xC7, 0x1D, 0x71, 0xCA, 0x70, 0x9C, 0x97,
+    0x0A, 0xC6, 0xAA, 0xAD, 0xAA, 0xAC, 0x1F, 0xFD, 0x49, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x1C, 0xA7,
+    0x09, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x1C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x1C, 0xA7,
+    0x09, 0xC9, 0x70, 0xAC, 0x71, 0x9C, 0x72, 0x97, 0x74, 0x70, 0xAC, 0x73, 0xD7, 0x3C, 0xA7, 0x29,
+    0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x3C, 0xA7, 0x29, 0xC9, 0x79, 0xAA, 0xDA, 0xAA, 0xA9, 0x2A, 0xFF,
+    0xC9, 0x6C, 0xA7, 0x29, 0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x3C, 0xA7, 0x29, 0xC7, 0x3A, 0xCA, 0xCA,
+    0x49, 0xFE, 0xA4, 0xAA, 0xAA, 0xCA, 0x72, 0x9C, 0x73, 0xAC, 0x73, 0xD7, 0x3C, 0xA7, 0x29, 0xC9,
+    0x72, 0x9C, 0x74, 0xA7, 0x76, 0x49, 0xFE, 0x94, 0xFF, 0x93, 0x9F, 0xF4, 0xFF, 0xC3, 0x9F, 0xFC,
+    0x3F, 0xFD, 0x29, 0xFF, 0xCA, 0x2F, 0xFD, 0xA1, 0x9F, 0xFD, 0x91, 0xAF, 0xFD, 0x91, 0xFF, 0xE1,
+    0xAF, 0xFE, 0x10, 0x70, 0xC9, 0x3A, 0xDA, 0x2F, 0xC1, 0xEA, 0x2C, 0x97, 0x20, 0x19, 0x90, 0xDA,
+    0x9D, 0xAA, 0xDA, 0x19, 0x90, 0xDA, 0x9D, 0xAA, 0xDA, 0x19, 0x94, 0x99, 0x49, 0x91, 0xDA, 0x39,
+    0xD3, 0xAD, 0x09, 0xDA, 0x3E, 0x3E, 0x0A, 0xDA, 0x29, 0xE2, 0xAD, 0xA0, 0x4D, 0x90, 0xD0, 0x76,
+    0xC5, 0x99, 0x95, 0xC9, 0x4A, 0x1A, 0x4C, 0xA5, 0xA9, 0x0A, 0x3A, 0xA5, 0x9A, 0x09, 0x92, 0xAC,
+    0x69, 0xC9, 0xC2, 0x9C, 0x70, 0xD9, 0x19, 0xC9, 0x75, 0xC9, 0x75, 0xCA, 0x75, 0xD7, 0x5A, 0xC7,
+    0x5A, 0xC9, 0x74, 0x9C, 0x99, 0x99, 0x09, 0x96, 0x9C, 0xA0, 0xA0, 0x99, 0x09, 0x6D, 0x09, 0x99,
+    0x9A, 0x99, 0x5D, 0x1A, 0x9A, 0x0C, 0x0A, 0x4D, 0x29, 0xCA, 0x0A, 0xC5, 0x97, 0x60, 0x2E, 0x91,
+    0xAE, 0x2E, 0x91, 0x9D, 0xA2, 0xE2, 0x9D, 0xA2, 0x2E, 0x90, 0xE2, 0xAE, 0x0A, 0xDA, 0x2E, 0x90,
+    0xE2, 0x9D, 0xA0, 0x9D, 0xA2, 0xE1, 0xE2, 0x9D, 0xA0, 0xAD, 0xA2, 0x77, 0xAA, 0x3C, 0x92, 0xA9,
+    0x1D, 0x91, 0x9C, 0xA1, 0x9D, 0x1D, 0x2A, 0xC2, 0xAC, 0x90, 0x9C, 0x92, 0xCA, 0x2D, 0x1A, 0xA2,
+    0x9C, 0x3C, 0x97, 0x70, 0x4A, 0xA1, 0xD1, 0xAC, 0x2C, 0x91, 0xAA, 0x30, 0x71, 0xAC, 0x19, 0xC2,
+    0xD1, 0xAC, 0xA1, 0x9C, 0x91, 0xD2, 0xCA, 0x1A, 0xC2, 0x9C, 0x2C, 0x97, 0x00, 0x77, 0xAA, 0x2A,
+    0xA2, 0x9A, 0x2D, 0x2D, 0x2A, 0xCA, 0x1A, 0xC2, 0xAC, 0x92, 0xD2, 0xC9, 0x2C, 0xA2, 0xAC, 0x2A,
+    0xA2, 0x9C, 0x3C, 0x97, 0x60, 0x49, 0x59, 0xD4, 0xAC, 0x9D, 0x2D, 0x19, 0xD0, 0x59, 0x4C, 0x92,
+    0x9C, 0xA2, 0xD9, 0x19, 0xD3, 0xE3, 0x9D, 0xA3, 0x9D, 0x93, 0xAC, 0x5A, 0x20, 0x09, 0x6C, 0xA6,
+    0xD6, 0xAC, 0xA5, 0x9D, 0x5D, 0x93, 0xE3, 0xAD, 0x4A, 0xC9, 0x5A, 0x20, 0x77, 0x19, 0x97, 0x59,
+    0xAA, 0x96, 0xD9, 0x09, 0xAA, 0x71, 0xE5, 0xAD, 0x9A, 0xD9, 0x71, 0xE9, 0x4F, 0xD7, 0x39, 0xE5,
+    0x9E, 0x75, 0xEA, 0x3A, 0xDA, 0x76, 0x9E, 0x2E, 0xA7, 0x70, 0xEA, 0x9E, 0x97, 0x6D, 0xAA, 0xFD,
+    0x95, 0x99, 0x69, 0xD9, 0x0F, 0xC6, 0xAD, 0x6A, 0xD9, 0x0F, 0x96, 0xE6, 0x99, 0x99, 0xFD, 0x59,
+    0xE7, 0x0A, 0xFE, 0xA7, 0x70, 0xFA, 0x9F, 0x77, 0xF9, 0x1F, 0xA7, 0x49, 0xF9, 0x29, 0xF7, 0x3A,
+    0xF5, 0xFC, 0x71, 0xFC, 0x5A, 0xFC, 0x96, 0x9F, 0xC5, 0x9F, 0xE7, 0x72, 0xE7, 0x76, 0x9D, 0xA7,
+    0x30, 0x70, 0x97, 0x0A, 0xC7, 0x0D, 0x79, 0xCA, 0x7A, 0xC9, 0x7D, 0x79, 0xD7, 0xAC, 0xA7, 0xD9,
+    0x69, 0xD7, 0xAC, 0xA7, 0xD9, 0x69, 0xD7, 0xAD, 0x7D, 0xA7, 0x09, 0x77, 0x19, 0xDA, 0x6E, 0x95,
+    0x9E, 0x95, 0xF5, 0x7A, 0xA7, 0x29, 0xCA, 0x71, 0x9E, 0xA9, 0x59, 0xFE, 0x93, 0x9D, 0x9D, 0x9E,
+    0x49, 0x09, 0xCA, 0x1D, 0x95, 0xAC, 0x91, 0xD9, 0x5D, 0x2D, 0x6D, 0x19, 0xD5, 0x9D, 0x1D, 0x95,
+    0xAC, 0xA0, 0xE6, 0xD9, 0xE6, 0x9F, 0xC7, 0xAF, 0x70, 0xE9, 0x71, 0xDA, 0x71, 0x9D, 0x97, 0x1A,
+    0xD7, 0x2D, 0xA7, 0x77, 0xAA, 0xA7, 0x2E, 0x71, 0xAE, 0x71, 0xEA, 0x71, 0xEA, 0x70, 0xAE, 0xA7,
+    0x00, 0x0F, 0xFC, 0x90, 0xFF, 0xC7, 0x30, 0x0C, 0x94, 0xC1, 0xCA, 0x29, 0xCA, 0x1A, 0xFC, 0xA3,
+    0x9D, 0xA3, 0x77, 0x69, 0xA7, 0x2C, 0x99, 0x99, 0xA7, 0x1A, 0xCA, 0x97, 0x19, 0xAD, 0xA7, 0x0A,
+    0xA0, 0xA0, 0xA7, 0x29, 0x97, 0x1A, 0x94, 0xC4, 0xA0, 0xC0, 0x9A, 0xAC, 0x0C, 0x9A, 0x91, 0xAD,
+    0xA9, 0x19, 0xD9, 0x39, 0xDA, 0x19, 0xAC, 0xAC, 0x91, 0xCA, 0xA9, 0xAC, 0x0A, 0x0C, 0x09, 0x93,
+    0xA5, 0xA7, 0x72, 0x76, 0xA7, 0x6C, 0xA7, 0x5A, 0xA7, 0x5A, 0xC7, 0x5A, 0xC7, 0x59, 0xC7, 0x59,
+    0xC9, 0x75, 0xCA, 0x75, 0xCA, 0x75, 0xD7, 0x5D, 0x75, 0xAC, 0x75, 0xAC, 0x97, 0x49, 0xC9, 0x74,
+    0x9C, 0xA7, 0x5D, 0x75, 0xD7, 0x50, 0x77, 0x75, 0x9A, 0xAA, 0xA6, 0xAA, 0xAA, 0x95, 0x9F, 0xE9,
+    0x2A, 0xFE, 0x4D, 0x91, 0x9E, 0x1A, 0xCA, 0x91, 0x9D, 0xA3, 0x95, 0xD9, 0x19, 0x49, 0xD7, 0x2D,
+    0x97, 0x9D, 0x72, 0xD9, 0x79, 0xD7, 0x19, 0xD7, 0x0D, 0xA7, 0x1D, 0x97, 0x9D, 0x71, 0xAD, 0x70,
+    0xD9, 0x70, 0xAD, 0x70, 0xDA, 0x79, 0xE7, 0xAD, 0xA6, 0x9F, 0x6A, 0xEA, 0x7E, 0x96, 0x9E, 0x97,
+    0x0E, 0x7A, 0xD9, 0x70, 0x9D, 0x97, 0xE7, 0x1A, 0xD7, 0x0E, 0x71, 0xDA, 0x79, 0xD9, 0x77, 0x77,
+    0x77, 0x72, 0x9D, 0x70, 0xDA, 0x71, 0xE7, 0x9D, 0x97, 0x09, 0xDA, 0x7E, 0x97, 0x09, 0x99, 0x97,
+    0x99, 0x97, 0x10, 0x77, 0x59, 0xAE, 0xA9, 0x71, 0xAF, 0xE9, 0x79, 0xCA, 0x3E, 0x2A, 0xC3, 0x95,
+    0xD9, 0x1D, 0x72, 0xD9, 0x1C, 0xA7, 0x2D, 0x1A, 0xC9, 0x71, 0xAC, 0xA1, 0xD7, 0x19, 0xD1, 0x9D,
+    0x71, 0xDA, 0x1A, 0xCA, 0x79, 0xDA, 0x2D, 0x96, 0xAD, 0xA2, 0x9D, 0x5F, 0x93, 0xAD, 0x5E, 0x5D,
+    0xA4, 0x9D, 0xA4, 0x9D, 0x5A, 0xD9, 0x4A, 0xD5, 0xE5, 0xDA, 0x5A, 0xA9, 0x69, 0x77, 0x70, 0x99,
+    0x49, 0xDA, 0x5A, 0xD4, 0xE9, 0x5D, 0xA3, 0x9E, 0x94, 0xAD, 0xA3, 0xF5, 0x77, 0x77, 0x1A, 0xF9,
+    0x74, 0x9F, 0xEA, 0x73, 0xD9, 0x2A, 0xD9, 0x7A, 0xC0, 0x95, 0xDA, 0x7C, 0xA7, 0xAC, 0xA6, 0x9C,
+    0x97, 0xD9, 0x6D, 0x79, 0xD7, 0xD7, 0xD9, 0x69, 0xCA, 0x6E, 0x7D, 0x95, 0xE7, 0x0D, 0x4A, 0xE7,
+    0x0A, 0xD2, 0x9E, 0xA7, 0x1D, 0xA2, 0xE9, 0x72, 0xD9, 0x2E, 0x72, 0xAD, 0x29, 0xDA, 0x72, 0xDA,
+    0x2A, 0xD9, 0x71, 0x9D, 0x92, 0xAA, 0x97, 0x39, 0xA7, 0x77, 0x09, 0x97, 0x2A, 0xD9, 0x29, 0xD7,
+    0x2E, 0x3E, 0x71, 0xAE, 0x29, 0xE7, 0x1F, 0x77, 0x77, 0x40, 0x77, 0x77, 0x6A, 0xC7, 0x71, 0x9C,
+    0x97, 0x71, 0xD7, 0x71, 0x9C, 0x77, 0x2C, 0xA7, 0x71, 0xAC, 0x77, 0x2C, 0xA7, 0x4D, 0x91, 0xAC,
+    0x74, 0x9D, 0x90, 0x9C, 0xA7, 0x4E, 0x1D, 0x75, 0x99, 0x90, 0x9C, 0x97, 0x71, 0xD7, 0x71, 0xAC,
+    0x97, 0x71, 0xD7, 0x71, 0xAC, 0x97, 0x70, 0x9C, 0xA7, 0x71, 0xD7, 0x71, 0x9C, 0xA7, 0x71, 0xD1,
+    0x99, 0x75, 0xAC, 0xA0, 0xDA, 0x75, 0xD0, 0x9D, 0xA7, 0x4A, 0xC9, 0x0E, 0x97, 0x4D, 0x77, 0x1D,
+    0x97, 0x70, 0x9D, 0x77, 0x1D, 0x97, 0x70, 0x9D, 0x77, 0x1D, 0x97, 0x70, 0xAC, 0xA7, 0x71, 0xD7,
+    0x71, 0xAA, 0x77, 0x29, 0x77, 0x20, 0x2A, 0x9A, 0x3A, 0x91, 0xA2, 0xC0, 0xA0, 0xA1, 0x9A, 0x99,
+    0xA9, 0x1A, 0x91, 0xC2, 0xAA, 0x0A, 0xC2, 0xAE, 0x93, 0xAA, 0x92, 0x71, 0xC3, 0xAC, 0x2A, 0x9C,
+    0x1A, 0x0A, 0xA0, 0xAF, 0x99, 0x99, 0xC9, 0x29, 0xC3, 0xAC, 0x10, 0x72, 0xCA, 0xAA, 0x2A, 0x95,
+    0xC6, 0xEA, 0x6C, 0x5A, 0xC2, 0xF9, 0x29, 0xA9, 0x30, 0x29, 0xAD, 0x29, 0xA5, 0xCA, 0xAA, 0x29,
+    0xC9, 0x0C, 0x91, 0xAA, 0x1A, 0x91, 0xAA, 0x09, 0xC2, 0x9E, 0x94, 0x93, 0x59, 0xFA, 0x3C, 0x92,
+    0x9C, 0x3C, 0x92, 0x9C, 0x3C, 0xA2, 0xAC, 0x3C, 0xA2, 0x29, 0x9A, 0xA2, 0x9A, 0x1C, 0x29, 0xA0,
+    0xAA, 0x3D, 0xA3, 0xC1, 0xC2, 0xC9, 0x1C, 0x91, 0xCA, 0x09, 0xC2, 0x9E, 0x91, 0x2A, 0xAC, 0x92,
+    0xA9, 0x1C, 0x2C, 0x2C, 0x2C, 0x1A, 0xC2, 0xAE, 0xA5, 0xC9, 0x19, 0x99, 0xAC, 0x2E, 0xA2, 0x4A,
+    0x19, 0xAA, 0x95, 0xAF, 0xE9, 0x4E, 0xA1, 0x9D, 0x4D, 0x93, 0xD3, 0xAD, 0x4D, 0x3D, 0x93, 0x9D,
+    0x3D, 0x4D, 0xA2, 0xAD, 0x4D, 0x92, 0xE3, 0x9D, 0x3D, 0xA3, 0xAD, 0x2A, 0xD9, 0x3E, 0x2E, 0x4D,
+    0xA1, 0x49, 0x95, 0xAA, 0x1C, 0x3A, 0xA2, 0xA9, 0x19, 0xC0, 0x99, 0x0A, 0x91, 0xAA, 0x0C, 0xA0,
+    0xC9, 0x1C, 0xA0, 0xC0, 0x9C, 0x2C, 0x92, 0xD1, 0x9C, 0xA1, 0xAC, 0x92, 0xDA, 0xE3, 0xFC, 0x93,
+    0x9D, 0xA4, 0x39, 0x29, 0xD3, 0xAA, 0x3C, 0x93, 0xC3, 0x9A, 0x3C, 0x91, 0xAF, 0x09, 0x99, 0x99,
+    0x00, 0x19, 0xAC, 0xA2, 0xA1, 0xAA, 0x4A, 0xA4, 0xC9, 0x3C, 0xA2, 0x9C, 0xA2, 0xAC, 0xA2, 0x9F,
+    0x90, 0x99, 0x99, 0x91, 0x2A, 0xA9, 0x59, 0x94, 0x99, 0x49, 0x29, 0xD9, 0x49, 0xC4, 0xAA, 0x09,
+    0xF2, 0x9A, 0x92, 0x49, 0x49, 0xC3, 0x9C, 0xA2, 0x9A, 0xA9, 0x19, 0xC0, 0xC9, 0x1F, 0xC3, 0xAC,
+    0x4C, 0xA1, 0x70, 0xAA, 0xAA, 0x2A, 0x49, 0xCA, 0xA5, 0xA9, 0x4C, 0x91, 0xAA, 0xD1, 0x9D, 0xA2,
+    0x2A, 0xDA, 0x1A, 0x93, 0x9A, 0xAA, 0x91, 0xD1, 0xC1, 0xC2, 0xC1, 0xC1, 0xAA, 0x1A, 0xE3, 0x99,
+    0x20, 0xAD, 0xAA, 0x39, 0xC3, 0xA9, 0x29, 0xC3, 0xCA, 0x29, 0xC3, 0xCA, 0x29, 0xC9, 0x70, 0x39,
+    0x94, 0xA0, 0x9A, 0x2C, 0x2A, 0x2C, 0x90, 0xC9, 0x29, 0xD9, 0x2A, 0xA1, 0xC1, 0x9C, 0x1A, 0xC2,
+    0xAD, 0xA7, 0x20, 0x29, 0xAA, 0x3A, 0x90, 0xAA, 0x2C, 0x19, 0xA1, 0x9A, 0x1A, 0xA1, 0x9A, 0x1C,
+    0x92, 0xF5, 0x9C, 0x2F, 0x39, 0x99, 0x30, 0x70, 0x9C, 0x97, 0x9C, 0xA7, 0x0D, 0x70, 0xD7, 0x0A,
+    0xCA, 0x70, 0xD7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x70, 0x9C, 0xA7, 0x0D, 0x71, 0xD7, 0x0A, 0xC9,
+    0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x97, 0x0A, 0xC9, 0x70, 0xD7, 0x1D,
+    0x71, 0xD7, 0x1D, 0x97, 0x0D, 0x97, 0x0A, 0xC9, 0x70, 0xAC, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x73,
+    0x0C, 0x97, 0x1A, 0xC9, 0x71, 0xD7, 0x2D, 0x71, 0x9C, 0xA7, 0x1A, 0xC9, 0x71, 0xD7, 0x1A, 0xC9,
+    0x71, 0xD7, 0x1A, 0xC9, 0x71, 0xD7, 0x1A, 0xC9, 0x70, 0x9C, 0xA7, 0x1D, 0x71, 0xD7, 0x1A, 0xC9,
+    0x70, 0x9C, 0xA7, 0x09, 0xCA, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x1D, 0x71, 0xD7, 0x09, 0xD7, 0x09,
+    0xD7, 0x0A, 0xCA, 0x70, 0xDA, 0x70, 0xD9, 0x74, 0x77, 0x77, 0x09, 0xC9, 0x1C, 0xA7, 0x4D, 0x1A,
+    0xC7, 0x49, 0xC9, 0x09, 0xCA, 0x74, 0xD1, 0xD7, 0x4A, 0xFD, 0x72, 0x9F, 0xF7, 0x1F, 0xA9, 0xAC,
+    0xAA, 0x70, 0xFA, 0x1D, 0x71, 0xFC, 0x19, 0xC9, 0x70, 0xE9, 0xCA, 0x1D, 0x70, 0x9D, 0x9A, 0xC1,
+    0xAC, 0x97, 0x0E, 0x0C, 0xA1, 0xD7, 0x09, 0xD9, 0xD1, 0xAC, 0x71, 0xE9, 0xCA, 0x1C, 0xA7, 0x1F,
+    0xC1, 0xAC, 0x71, 0x9F, 0x91, 0xCA, 0x71, 0x9F, 0x90, 0xAC, 0x29, 0x69, 0xFF, 0xAA, 0xD6, 0x9F,
+    0xFE, 0xA7, 0xFF, 0xE9, 0x7F, 0xFE, 0x7A, 0xCA, 0xAF, 0xDA, 0xA7, 0xD1, 0xD7, 0x4A, 0xC1, 0x9C,
+    0x97, 0x4C, 0xA1, 0xD7, 0x4A, 0xC1, 0x9C, 0x97, 0x77, 0x70, 0x77, 0x73, 0x9A, 0xFA, 0x70, 0x9F,
+    0xF7, 0xAE, 0xA9, 0x99, 0xAA, 0x6E, 0xA7, 0x4E, 0x97, 0x4E, 0x97, 0x49, 0xDA, 0x75, 0xE7, 0x59,
+    0xD9, 0x39, 0xA9, 0xAA, 0x4E, 0x4F, 0xC4, 0xE4, 0xD9, 0x59, 0xE9, 0x29, 0xC9, 0x69, 0xF2, 0xD1,
+    0x94, 0x9F, 0xDA, 0xDA, 0xD4, 0x9F, 0xFE, 0xA5, 0xFF, 0xE9, 0x59, 0xFF, 0xD7, 0x0A, 0xFD, 0xAA,
+    0x77, 0x60, 0x77, 0x77, 0x72, 0x9A, 0xE9, 0x70, 0x9F, 0xEA, 0x69, 0xDA, 0x39, 0xC6, 0xAC, 0x97,
+    0x5D, 0x76, 0xD7, 0x5F, 0xFC, 0x6A, 0xFF, 0xA7, 0x0A, 0xC7, 0x6A, 0xC7, 0x4F, 0xFC, 0x96, 0xFF,
+    0xC7, 0x1D, 0x97, 0x49, 0xD7, 0x39, 0xE9, 0x71, 0x9E, 0xA9, 0x72, 0xAF, 0xFD, 0xA4, 0xFF, 0xF3,
+    0x69, 0x99, 0x6A, 0xD6, 0x9E, 0x6D, 0xA6, 0xF5, 0x9D, 0x96, 0xF9, 0x4A, 0xD6, 0x9F, 0xA4, 0xDA,
+    0x6F, 0xCA, 0x39, 0xD9, 0x6D, 0xAE, 0x3A, 0xD6, 0xAD, 0x9A, 0xD3, 0xE6, 0xE0, 0xAD, 0x91, 0x9D,
+    0x93, 0x9F, 0xFF, 0xFD, 0x90, 0xFF, 0xFF, 0xE3, 0xE9, 0x1E, 0x09, 0xD9, 0x59, 0xE2, 0xAD, 0x0A,
+    0xD6, 0xAE, 0x29, 0xD9, 0xE6, 0xEA, 0x29, 0xFC, 0xA5, 0x9E, 0x93, 0xFC, 0x95, 0xAE, 0x4F, 0xC6,
+    0xF4, 0xAE, 0xA5, 0x5A, 0xFD, 0xA7, 0x1F, 0xFC, 0x97, 0xD4, 0xAD, 0x69, 0xD5, 0xD3, 0xFF, 0xFE,
+    0xA1, 0x99, 0xAD, 0xA9, 0x99, 0x99, 0xE9, 0x49, 0xD3, 0x9A, 0xD9, 0x5A, 0xFF, 0xCA, 0x6F, 0xFC,
+    0x96, 0x9E, 0xAA, 0xA9, 0x71, 0xAD, 0x76, 0xE7, 0x59, 0xDA, 0x75, 0xAD, 0xA7, 0x5E, 0x97, 0x49,
+    0xE7, 0x5A, 0xE7, 0x5E, 0xA7, 0x40, 0x4F, 0xA7, 0x71, 0x9F, 0xD7, 0x70, 0xAA, 0x29, 0xCA, 0x77,
+    0xC9, 0x3C, 0xA7, 0x7C, 0x4C, 0xA7, 0x69, 0xC3, 0xAC, 0xA7, 0x6A, 0xC2, 0xAD, 0x6A, 0xEA, 0x3F,
+    0xEA, 0x5A, 0xCA, 0xAA, 0x93, 0xFD, 0xA6, 0xC7, 0x9F, 0xD6, 0x9C, 0x7A, 0xDA, 0x9A, 0xD5, 0x9C,
+    0xA6, 0xD9, 0x2D, 0x6E, 0x94, 0xD9, 0x2D, 0x7A, 0xDA, 0x29, 0xD3, 0xD7, 0x1D, 0x2A, 0xD2, 0x9D,
+    0x59, 0x2D, 0x2D, 0xA2, 0xAD, 0x4A, 0xFC, 0xA2, 0xDA, 0x2E, 0x39, 0xFD, 0x91, 0x9D, 0x92, 0xE4,
+    0xAF, 0x92, 0x3C, 0x97, 0x0C, 0xA3, 0x9C, 0x97, 0x0C, 0x93, 0x9C, 0x97, 0xAC, 0x49, 0xC9, 0x7D,
+    0x49, 0xC9, 0x7C, 0xA4, 0x9C, 0x91, 0x9C, 0x2A, 0xC3, 0x9F, 0xFF, 0xE1, 0xFF, 0xFE, 0x93, 0x9C,
+    0x90, 0xEA, 0x09, 0xC9, 0x5A, 0xC9, 0x9E, 0xA0, 0xD6, 0xAC, 0x0A, 0xC9, 0xD0, 0xCA, 0x6A, 0xC9,
+    0xD0, 0xD9, 0xC9, 0x6A, 0xEA, 0x0F, 0x7A, 0xE1, 0xF7, 0xAE, 0x1E, 0xA7, 0xAD, 0x91, 0xE7, 0x0A,
+    0xD2, 0xAD, 0x70, 0xDA, 0x2A, 0xCA, 0x50, 0x39, 0xAA, 0x99, 0x76, 0xFE, 0xA5, 0x94, 0xEA, 0xAA,
+    0xE3, 0x9C, 0xA2, 0x9D, 0x4A, 0xCA, 0x2A, 0xC9, 0x2A, 0xC9, 0x5D, 0x2D, 0x3D, 0x6C, 0xA2, 0xD3,
+    0xD1, 0x9A, 0x2C, 0xA1, 0x9C, 0xA2, 0x9C, 0xA1, 0xAC, 0x19, 0xC9, 0x1A, 0xC3, 0xD2, 0xD1, 0xAC,
+    0x2D, 0x3D, 0x2C, 0xA1, 0xAC, 0x19, 0xCA, 0x29, 0xCA, 0x19, 0xC9, 0x5A, 0xC9, 0x2A, 0xC9, 0x19,
+    0xC9, 0x5D, 0x3D, 0x29, 0xCA, 0x49, 0xD3, 0xD3, 0xE9, 0x99, 0xAD, 0xA3, 0xA9, 0x4F, 0xF9, 0x74,
+    0x9A, 0xAE, 0x30, 0x72, 0xA9, 0x73, 0x9C, 0x71, 0xAA, 0xAD, 0xAA, 0x96, 0xFE, 0x97, 0x09, 0xC7,
+    0x9A, 0xD0, 0xAC, 0x6A, 0xFD, 0xA5, 0x9C, 0x91, 0x9D, 0x95, 0xC9, 0x3D, 0x5A, 0xC3, 0x9C, 0xA5,
+    0xCA, 0x3D, 0x95, 0xD2, 0xAD, 0x6F, 0xF6, 0x9F, 0xE7, 0x9A, 0xA9, 0x09, 0x95, 0x9F, 0xFD, 0x3F,
+    0xFE, 0x30, 0x77, 0x79, 0xFD, 0x7A, 0xFE, 0x6A, 0xDA, 0x72, 0x9D, 0x97, 0x3D, 0xA7, 0x1A, 0xFF,
+    0x6A, 0x9A, 0xDA, 0xAA, 0x97, 0x0A, 0xC9, 0x71, 0x99, 0xAF, 0xCA, 0x59, 0xFC, 0xAA, 0xA9, 0x70,
+    0x9C, 0xA7, 0x4A, 0xCA, 0x74, 0xAD, 0x74, 0xAD, 0xA7, 0x3A, 0xFE, 0x97, 0xFE, 0x71, 0x9A, 0xAD,
+    0xA7, 0x74, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFF, 0xD1, 0xFF, 0xFD, 0xA1,
+    0x94, 0xD9, 0x74, 0x9D, 0x75, 0xAD, 0x09, 0x97, 0x2F, 0xC9, 0x70, 0x9A, 0xEA, 0x97, 0x0F, 0xC7,
+    0x2A, 0xA9, 0xE9, 0xAA, 0x72, 0xFC, 0x97, 0x0A, 0xF9, 0x70, 0x9F, 0xC7, 0x29, 0x99, 0xE7, 0x4A,
+    0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x49, 0xE7, 0x20, 0x5A, 0xFD, 0xA7, 0x4F, 0xFC, 0x97, 0x19, 0xD4,
+    0xAD, 0x69, 0xFF, 0xFF, 0xA5, 0xD9, 0x49, 0xD6, 0xAA, 0xAE, 0xAA, 0xAA, 0xAE, 0xAA, 0xA9, 0x4A,
+    0xD3, 0x9E, 0x71, 0xFF, 0xDA, 0x71, 0xFF, 0xC9, 0x71, 0x9E, 0xAA, 0xA9, 0x74, 0xAD, 0x77, 0x1E,
+    0x77, 0x09, 0xDA, 0x77, 0x0A, 0xDA, 0x77, 0x0E, 0x97, 0x79, 0xE7, 0x70, 0xAE, 0x77, 0x0E, 0xA7,
+    0x70, 0x74, 0x97, 0x7A, 0xC7, 0x7C, 0xA7, 0x7C, 0x97, 0x39, 0xAA, 0xFD, 0x95, 0x9F, 0xFD, 0xA4,
+    0xAE, 0xA9, 0xAC, 0x39, 0x39, 0xE9, 0x1C, 0xA7, 0x0E, 0x92, 0xC9, 0x7A, 0xDA, 0x29, 0xC7, 0x0E,
+    0x3A, 0xC7, 0x9D, 0xA3, 0xCA, 0x7A, 0xD9, 0x3C, 0xA7, 0xE4, 0xFA, 0xA9, 0x91, 0xE3, 0x9F, 0xEA,
+    0x1E, 0x3A, 0xC2, 0xDA, 0x90, 0x9E, 0x3C, 0xA1, 0x9D, 0x29, 0xEA, 0x2C, 0x90, 0x9D, 0xA3, 0xFF,
+    0xFC, 0x93, 0xFF, 0xFC, 0x5F, 0xFF, 0x69, 0xAF, 0xCA, 0xA7, 0x4C, 0x97, 0x69, 0xC7, 0x79, 0xA7,
+    0x00, 0x69, 0xAF, 0xCA, 0x97, 0x5F, 0xFC, 0x97, 0x4A, 0xAA, 0xAA, 0xAF, 0x77, 0x3E, 0x77, 0x39,
+    0xD7, 0x73, 0xE7, 0x1A, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xCA, 0x77, 0x77, 0x77, 0x0A, 0xFF, 0xFF,
+    0xD2, 0x9F, 0xFF, 0xFD, 0xA2, 0xFC, 0x77, 0x1F, 0xC9, 0x49, 0xA7, 0x1F, 0xFF, 0xCA, 0x70, 0x9F,
+    0xFF, 0xC7, 0x1A, 0xFF, 0xF9, 0x72, 0xAF, 0xFA, 0x97, 0x77, 0x60, 0x77, 0x2C, 0x70, 0x9C, 0x79,
+    0xE9, 0x3A, 0xFC, 0x92, 0xE9, 0xC4, 0x9D, 0x0A, 0xC4, 0xD1, 0xCA, 0x39, 0xD1, 0xC9, 0x3A, 0xCA,
+    0x09, 0xC4, 0xDA, 0x0A, 0xC4, 0xE0, 0xCA, 0x4A, 0xFA, 0xA4, 0xFD, 0xA4, 0xAF, 0xA5, 0xC9, 0x40,
+    0x77, 0x59, 0xFF, 0xFD, 0x77, 0x77, 0x79, 0xFF, 0xFD, 0x3F, 0xFF, 0xDA, 0x71, 0xD9, 0x76, 0x9D,
+    0x77, 0xE7, 0x7D, 0x97, 0x6A, 0xD7, 0x7E, 0x76, 0x9D, 0xA7, 0x6A, 0xD9, 0x76, 0xE7, 0x69, 0xE7,
+    0x6A, 0xDA, 0x76, 0xE7, 0x69, 0xE7, 0x40, 0x29, 0x99, 0x99, 0x99, 0x99, 0x19, 0xFF, 0xA5, 0xCA,
+    0x71, 0x9C, 0x59, 0x99, 0x9A, 0xC9, 0x99, 0x19, 0xFF, 0xA5, 0xAC, 0x94, 0x99, 0xAD, 0xA4, 0x9F,
+    0x6A, 0xF9, 0x70, 0x9D, 0x71, 0xD7, 0x09, 0xD7, 0x0A, 0xD9, 0x7E, 0x97, 0xE9, 0x77, 0x00, 0x49,
+    0xA9, 0x71, 0xAC, 0x72, 0xD1, 0x9A, 0x6F, 0xCA, 0x49, 0xFA, 0x94, 0xF9, 0x69, 0xA9, 0xD1, 0xAA,
+    0x59, 0xFC, 0x94, 0xAF, 0x95, 0xF9, 0x3C, 0xA0, 0x9A, 0x9D, 0x29, 0xD3, 0x9C, 0xA1, 0xAD, 0x4A,
+    0xFC, 0x95, 0xEA, 0x97, 0x72, 0x79, 0xC7, 0x5A, 0xA7, 0x5C, 0xA7, 0x3A, 0xF9, 0x79, 0xFE, 0x7F,
+    0xC9, 0xD9, 0x5A, 0xD0, 0xCA, 0x0A, 0xC9, 0x5D, 0x1C, 0x90, 0x9C, 0x94, 0x9C, 0xA0, 0x9C, 0x19,
+    0xC5, 0xAC, 0x1A, 0xC1, 0xAC, 0x5D, 0x1C, 0xA1, 0xCA, 0x5C, 0xA1, 0xC9, 0x1C, 0x94, 0x9C, 0x90,
+    0x9C, 0x19, 0xC5, 0xAC, 0x1A, 0xC1, 0xD5, 0xD1, 0xCA, 0x1C, 0xA5, 0xD1, 0xC9, 0x09, 0xC9, 0x40,
+    0x7A, 0xFD, 0xA9, 0x71, 0xFF, 0xC9, 0x70, 0xD4, 0xAD, 0x79, 0xD5, 0xD7, 0xDA, 0x5D, 0x7D, 0x94,
+    0xAC, 0xA6, 0x9D, 0x39, 0xAD, 0x92, 0xAF, 0xFF, 0xCA, 0x3A, 0xFF, 0xF9, 0x4F, 0xEA, 0xAA, 0x97,
+    0x2A, 0xD7, 0x7E, 0x72, 0x9F, 0xFE, 0x95, 0xAF, 0xFE, 0x72, 0xE9, 0x76, 0xE7, 0x6A, 0xE7, 0x6E,
+    0xA7, 0x30, 0x4A, 0x97, 0x19, 0xC7, 0x2C, 0xA7, 0x1D, 0x71, 0xAC, 0x49, 0xAC, 0xA1, 0xC9, 0x09,
+    0xAF, 0xA1, 0xFD, 0xA9, 0x3A, 0xDA, 0x97, 0x9D, 0x97, 0x2D, 0xA7, 0x2D, 0xA7, 0x2D, 0x73, 0x96,
+    0x77, 0x4A, 0xC7, 0x19, 0xF7, 0xAE, 0xAD, 0x49, 0xD9, 0xAC, 0x09, 0xD2, 0xAC, 0xA1, 0xD1, 0xAC,
+    0xA1, 0xC9, 0x2C, 0xA2, 0xA9, 0x59, 0xC9, 0x72, 0xAC, 0x73, 0xD7, 0x3C, 0x97, 0x29, 0xC7, 0x3A,
+    0xC7, 0x5A, 0x97, 0x29, 0xC7, 0x3D, 0x73, 0xCA, 0x2D, 0xA9, 0x39, 0xC2, 0x9A, 0xFA, 0x90, 0xAC,
+    0x59, 0xAF, 0xCA, 0x79, 0xAE, 0x97, 0x0A, 0xD7, 0x0A, 0xD7, 0x0D, 0xA7, 0x09, 0xCA, 0x72, 0x94,
+    0x49, 0x74, 0xC9, 0x73, 0xCA, 0x73, 0xAC, 0x73, 0x9C, 0x97, 0x3C, 0xA6, 0x93, 0xD6, 0xD9, 0x1A,
+    0xC2, 0xAC, 0x2A, 0xCA, 0x09, 0xC9, 0x0A, 0xCA, 0x39, 0xD9, 0xCA, 0x9D, 0x6A, 0xFC, 0x70, 0x9E,
+    0x73, 0xC9, 0x30, 0x77, 0x71, 0xC9, 0x71, 0xC7, 0xAA, 0x72, 0x9C, 0x59, 0xC7, 0x4C, 0xA4, 0xC9,
+    0x19, 0xAD, 0x9D, 0xA9, 0x2C, 0x92, 0xD9, 0xAE, 0xA2, 0x9A, 0xEA, 0xAC, 0x19, 0xEA, 0x97, 0x09,
+    0xAE, 0xA0, 0xAC, 0xA7, 0x6A, 0xCA, 0x19, 0xCA, 0x74, 0xAC, 0xA3, 0x9D, 0x72, 0xAC, 0x96, 0xA7,
+    0x2A, 0x93, 0x5C, 0x7A, 0xE5, 0xEA, 0xD2, 0x9C, 0xA0, 0xC9, 0x9C, 0xA0, 0xAC, 0x19, 0xC1, 0x9C,
+    0x4A, 0xA7, 0x0C, 0x97, 0x0C, 0x70, 0x9C, 0x70, 0xAA, 0x70, 0x97, 0x1A, 0xA7, 0x09, 0xC7, 0x1C,
+    0x71, 0xC9, 0x70, 0xAA, 0x4A, 0xC1, 0x9C, 0x19, 0xC1, 0xAC, 0x90, 0xC1, 0xCA, 0x3C, 0xAC, 0xAD,
+    0x5A, 0xE7, 0x9C, 0x76, 0x49, 0x9A, 0xCA, 0x19, 0xAA, 0xFA, 0xA9, 0x1E, 0xA9, 0x6F, 0xA6, 0xD0,
+    0xAD, 0xA4, 0xAC, 0x2A, 0xD9, 0x2A, 0xC3, 0x9E, 0x1A, 0xC5, 0x9D, 0x99, 0xA7, 0x90, 0x19, 0xCA,
+    0x99, 0x70, 0xAA, 0xFC, 0xA9, 0x70, 0xAE, 0x7A, 0xF5, 0x9D, 0xA0, 0xAC, 0x4E, 0x91, 0xD2, 0xAD,
+    0x93, 0xD1, 0xDA, 0x5D, 0x19, 0x7A, 0xA0, 0x72, 0xA9, 0x7D, 0x79, 0xC9, 0x3A, 0x2D, 0x3C, 0x29,
+    0xC9, 0x19, 0xC3, 0xD1, 0xAA, 0x39, 0xC9, 0x0C, 0x94, 0xD0, 0xC5, 0x9C, 0xAC, 0x19, 0xA9, 0x1D,
+    0xA1, 0xFE, 0x93, 0x99, 0xAD, 0x20, 0x77, 0x2C, 0x70, 0xAC, 0x2A, 0x4C, 0xA2, 0xC9, 0x2A, 0xC3,
+    0xAA, 0x2C, 0xA3, 0x9C, 0x1A, 0xC5, 0xC1, 0xCA, 0x5C, 0x9A, 0xC6, 0xAD, 0xA6, 0x9D, 0x90, 0x99,
+    0xA3, 0xFE, 0x3D, 0xAA, 0x92, 0x29, 0x76, 0xD7, 0x5C, 0xA7, 0x4A, 0xC7, 0x49, 0xC9, 0x74, 0xFF,
+    0xFC, 0x1A, 0xC9, 0x75, 0xD9, 0x75, 0xAF, 0xFF, 0x39, 0xD7, 0x59, 0xD7, 0x59, 0xC7, 0x69, 0x70,
+    0x79, 0x19, 0x73, 0xAC, 0x1A, 0xA7, 0x1D, 0xA1, 0xD9, 0x7E, 0x90, 0x9E, 0x59, 0xD0, 0xC1, 0xAC,
+    0x0D, 0x39, 0xD1, 0xC1, 0xC9, 0x0A, 0xCA, 0x1A, 0xCA, 0x1A, 0xA1, 0xC2, 0xD9, 0x0A, 0x92, 0xC9,
+    0x09, 0xC3, 0xA6, 0xC1, 0xAA, 0x72, 0x9C, 0x1C, 0x97, 0x2A, 0xA1, 0xC7, 0x3C, 0x90, 0x9C, 0x73,
+    0xC1, 0xAA, 0x72, 0x9A, 0x1C, 0x97, 0x2A, 0x91, 0xC7, 0x72, 0x99, 0x75, 0xCA, 0x75, 0xD7, 0x59,
+    0xC9, 0x75, 0xD2, 0xAF, 0xFF, 0xA7, 0x5A, 0xC9, 0x73, 0xAC, 0xA0, 0x9F, 0xFF, 0x97, 0x29, 0xD7,
+    0x39, 0xD7, 0x4A, 0xC7, 0x75, 0x3A, 0x91, 0xA7, 0x3A, 0xA1, 0xC7, 0x39, 0xC1, 0xC9, 0x73, 0xC1,
+    0xAA, 0x73, 0xA9, 0x09, 0xC7, 0x39, 0xA1, 0xC9, 0x73, 0xC1, 0xCA, 0x69, 0x3C, 0x19, 0xC6, 0xD2,
+    0xA9, 0x1C, 0x2A, 0xC2, 0xD9, 0x09, 0xA1, 0xC9, 0x09, 0xD3, 0xAC, 0xA0, 0xC1, 0xAA, 0x0D, 0x5A,
+    0xE9, 0x09, 0xE9, 0x69, 0xDA, 0x1D, 0x97, 0x1D, 0x1C, 0xA7, 0x3C, 0x19, 0x77, 0x50, 0x29, 0x73,
+    0xA6, 0xD7, 0x1A, 0xC6, 0xCA, 0x71, 0x9C, 0x94, 0xAC, 0x73, 0xD3, 0x9C, 0x97, 0x39, 0xC9, 0x2F,
+    0xFF, 0xFD, 0x1A, 0xC9, 0x76, 0xD1, 0xD9, 0x73, 0x9D, 0x92, 0xAF, 0xFF, 0xDA, 0x59, 0xD7, 0xDA,
+    0x79, 0xD5, 0xDA, 0x71, 0x9C, 0x5C, 0xA7, 0x39, 0x59, 0x60, 0x49, 0xA7, 0x2E, 0x97, 0xD9, 0xDA,
+    0x94, 0xAC, 0x90, 0xC9, 0xE9, 0x1A, 0xD1, 0xC1, 0xAC, 0x1A, 0xE1, 0xC4, 0x9D, 0x9C, 0x1C, 0x59,
+    0x1C, 0x1C, 0x70, 0xC1, 0xC7, 0x0C, 0x1C, 0x70, 0xC1, 0xC7, 0x0C, 0x1C, 0x70, 0xC1, 0xC4, 0x9D,
+    0x0C, 0x1C, 0x5A, 0xE1, 0xC6, 0xAD, 0x1C, 0x19, 0xA3, 0xAC, 0x90, 0xC9, 0xE9, 0x3D, 0x9E, 0x96,
+    0xE9, 0x70, 0x9A, 0x50, 0x72, 0x97, 0x5E, 0x74, 0xAC, 0x97, 0x39, 0xC7, 0x4A, 0xC7, 0x4C, 0xA5,
+    0x99, 0xA9, 0x19, 0xC4, 0x9F, 0xCA, 0x0D, 0x39, 0xD9, 0x1A, 0xC9, 0xC9, 0x3D, 0x4E, 0x3A, 0xCA,
+    0x4D, 0x93, 0xD5, 0xD4, 0xD4, 0x9C, 0xA4, 0xD9, 0x29, 0xD5, 0xFA, 0xE9, 0x59, 0xFD, 0x97, 0x9E,
+    0xA7, 0x77, 0x77, 0xAF, 0xA9, 0x1D, 0x70, 0xAF, 0xFE, 0x70, 0xEA, 0x92, 0xAE, 0x97, 0xEA, 0x5E,
+    0x96, 0xE9, 0x49, 0xFA, 0x59, 0xDA, 0x49, 0xCA, 0x0D, 0xA5, 0xE4, 0x9C, 0xA1, 0xDA, 0x5D, 0x93,
+    0x9C, 0xA2, 0xD9, 0x4A, 0xD3, 0xAC, 0xA3, 0xD9, 0x4D, 0xA2, 0xAC, 0x93, 0xAD, 0x5D, 0xA1, 0xAC,
+    0x94, 0xDA, 0x5D, 0xA0, 0xD9, 0x4A, 0xD9, 0x5F, 0xC5, 0xAE, 0x6F, 0xC9, 0x99, 0xAA, 0xF9, 0x6F,
+    0xFF, 0xCA, 0x7F, 0xFF, 0xC6, 0x9C, 0xAA, 0xFF, 0xCA, 0x69, 0xCA, 0x19, 0xAF, 0xCA, 0x71, 0x97,
+    0x73, 0x77, 0x71, 0xAD, 0x73, 0x9E, 0x97, 0x2F, 0xA7, 0x1D, 0xAA, 0xCA, 0x70, 0xAD, 0x0A, 0xD7,
+    0x9D, 0x19, 0xD7, 0xDA, 0x19, 0xD9, 0x5E, 0x3D, 0xA4, 0xAD, 0x4E, 0x39, 0xD9, 0x4E, 0x3E, 0x5A,
+    0xD2, 0xE6, 0xAD, 0x90, 0xAD, 0x96, 0x9D, 0xA0, 0xFF, 0xFD, 0xA9, 0xFF, 0xFD, 0x90, 0x29, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xAF, 0xFE, 0x93, 0xD3, 0xD9, 0x49, 0xCA, 0x3D, 0x5A, 0xC9, 0x29,
+    0xCA, 0x5D, 0x3A, 0xC9, 0x5D, 0x3D, 0x5A, 0xCA, 0x3D, 0x5D, 0x92, 0x9C, 0xA5, 0xD3, 0xAC, 0x94,
+    0x9C, 0xA3, 0xD5, 0xAC, 0x93, 0xD5, 0xD3, 0x9C, 0xA5, 0xD3, 0xD9, 0x49, 0xCA, 0x3D, 0x50, 0x9A,
+    0x93, 0xAA, 0x59, 0xCA, 0x3D, 0x6D, 0x3A, 0xC9, 0x5D, 0x39, 0xCA, 0x5A, 0xCA, 0x3D, 0x59, 0xD3,
+    0xD6, 0xD3, 0xAC, 0x95, 0xAC, 0x92, 0x9C, 0xA5, 0x9C, 0xA3, 0xD6, 0xD3, 0xD6, 0xD3, 0xAC, 0x95,
+    0xAC, 0x92, 0x9D, 0x59, 0xCA, 0x3D, 0x49, 0xAD, 0x99, 0x99, 0xDA, 0x92, 0xAF, 0xFE, 0x90, 0x49,
+    0x99, 0x99, 0x99, 0x99, 0x3A, 0xFF, 0x93, 0xAC, 0x74, 0xCA, 0x74, 0xC9, 0x73, 0x9C, 0x74, 0xAA,
+    0x74, 0xC7, 0x3C, 0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x97, 0x1D, 0x71, 0x9D, 0x99, 0x99, 0x99, 0x4F,
+    0xFC, 0x4F, 0xFC, 0x77, 0x10, 0x19, 0x99, 0x9A, 0xAA, 0xA1, 0xAF, 0xF7, 0x30, 0x74, 0x99, 0x99,
+    0x99, 0x97, 0x49, 0xFD, 0xA7, 0x4D, 0x97, 0x70, 0xAC, 0xA7, 0x71, 0xD7, 0x71, 0xD9, 0x77, 0x09,
+    0xD7, 0x71, 0xD9, 0x77, 0x0A, 0xD7, 0x70, 0x9D, 0x97, 0x70, 0xDA, 0x77, 0x0A, 0xD7, 0x49, 0x29,
+    0xDA, 0x74, 0xD1, 0xE7, 0x5E, 0xAD, 0xA7, 0x5F, 0xD7, 0x6A, 0xF9, 0x76, 0x9F, 0x76, 0x4A, 0xAC,
+    0xA3, 0xAC, 0xA5, 0x9F, 0xD0, 0x9F, 0xC4, 0xDA, 0x19, 0xCA, 0xD9, 0x1C, 0x92, 0xAC, 0x93, 0xAD,
+    0x3A, 0xA2, 0xCA, 0x4A, 0xC9, 0x3A, 0x91, 0x9C, 0x94, 0xAC, 0x4C, 0x29, 0xC5, 0xD9, 0x2D, 0x2A,
+    0xC9, 0x29, 0xFF, 0x92, 0x9F, 0xEA, 0xFC, 0xA4, 0xFD, 0x90, 0xAE, 0x96, 0x9A, 0xA9, 0x73, 0x77,
+    0x29, 0x77, 0x2F, 0xC7, 0x69, 0xD9, 0x19, 0x76, 0xD9, 0x77, 0x1A, 0xCA, 0x77, 0x2D, 0x77, 0x29,
+    0xCA, 0x77, 0x2D, 0x97, 0x71, 0x9D, 0x77, 0x2D, 0x97, 0x72, 0xD7, 0x72, 0xAC, 0xA7, 0x72, 0xD7,
+    0x72, 0x9D, 0x77, 0x2D, 0x97, 0x71, 0x9D, 0x77, 0x2A, 0xCA, 0x77, 0x19, 0xD7, 0x72, 0xDA, 0x75,
+    0xA2, 0xE7, 0x39, 0xFF, 0xA7, 0x4F, 0xF7, 0x59, 0xFD, 0x77, 0x19, 0x97, 0x70, 0x4A, 0xA9, 0x39,
+    0xD9, 0x3E, 0x92, 0x9E, 0x77, 0x77, 0x72, 0x9A, 0xA4, 0xE3, 0x9E, 0x3F, 0x20, 0x77, 0x19, 0xF3,
+    0x9A, 0x29, 0xD1, 0xD1, 0x9C, 0xA2, 0xAC, 0x3F, 0xA7, 0x77, 0x71, 0x9E, 0x93, 0xA9, 0x2A, 0xCA,
+    0x0A, 0xC2, 0x9C, 0x92, 0xD2, 0xD9, 0x9D, 0x29, 0xA9, 0x3A, 0xE7, 0x72, 0x76, 0xC7, 0x6C, 0x97,
+    0x5C, 0x97, 0x5A, 0xA7, 0x5A, 0xC7, 0x59, 0xCA, 0xAA, 0xA4, 0xAF, 0xFE, 0x39, 0xAA, 0x99, 0xAC,
+    0x97, 0x5C, 0xA7, 0x5D, 0x72, 0x99, 0xAD, 0xA9, 0xAA, 0xAA, 0x4F, 0xFF, 0x95, 0xAC, 0x97, 0x4A,
+    0xCA, 0x74, 0x9C, 0xA7, 0x49, 0xD7, 0x5D, 0x77, 0x76, 0x72, 0x97, 0x6A, 0xD7, 0x4A, 0xEA, 0x72,
+    0xAE, 0xA7, 0x2A, 0xF7, 0x2A, 0xF9, 0x72, 0xAE, 0x97, 0x5F, 0xA9, 0x73, 0x9A, 0xFD, 0xA9, 0x73,
+    0xAF, 0xEA, 0x73, 0x9A, 0xFC, 0x76, 0x9A, 0xC7, 0x77, 0xEA, 0xA9, 0x97, 0x2A, 0xAF, 0xFC, 0xAA,
+    0x97, 0x29, 0x9A, 0xAA, 0xD0, 0x59, 0x77, 0x0D, 0xA7, 0x6A, 0xEA, 0x76, 0xAE, 0xA7, 0x59, 0xFA,
+    0x75, 0x9F, 0xA7, 0x59, 0xE9, 0x72, 0x9A, 0xF7, 0x9A, 0xFD, 0xA9, 0x39, 0xAF, 0xE9, 0x7F, 0xCA,
+    0x97, 0x19, 0xCA, 0x97, 0x77, 0x75, 0x99, 0xAA, 0xDA, 0x39, 0xAA, 0xFF, 0xCA, 0x92, 0x9D, 0xAA,
+    0xA9, 0x97, 0x10,
 };
 
 static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 11, 21, 12, 0, 21, 58, 0 }, // !
-    { 11, 6, 16, 4, 18, 17, 58 }, // "
-    { 24, 19, 27, 2, 17, 114, 75 }, // #
-    { 19, 23, 22, 1, 20, 110, 189 }, // $
-    { 17, 17, 23, 5, 16, 73, 299 }, // %
-    { 17, 19, 21, 3, 18, 81, 372 }, // &
-    { 6, 6, 10, 3, 16, 9, 453 }, // '
-    { 12, 29, 15, 2, 21, 87, 462 }, // (
-    { 12, 29, 9, -5, 21, 87, 549 }, // )
-    { 11, 10, 16, 4, 16, 28, 636 }, // *
-    { 10, 10, 14, 3, 11, 25, 664 }, // +
-    { 7, 6, 8, 0, 3, 11, 689 }, // ,
-    { 10, 3, 14, 3, 8, 8, 700 }, // -
-    { 4, 4, 6, 1, 4, 4, 708 }, // .
-    { 21, 33, 19, -3, 23, 174, 712 }, // /
-    { 14, 16, 17, 2, 16, 56, 886 }, // 0
-    { 11, 16, 13, 1, 16, 44, 942 }, // 1
-    { 15, 16, 17, 1, 16, 60, 986 }, // 2
-    { 15, 16, 17, 1, 16, 60, 1046 }, // 3
-    { 11, 16, 15, 3, 16, 44, 1106 }, // 4
-    { 14, 16, 16, 1, 16, 56, 1150 }, // 5
-    { 14, 16, 17, 2, 16, 56, 1206 }, // 6
-    { 11, 16, 17, 5, 16, 44, 1262 }, // 7
-    { 15, 16, 17, 1, 16, 60, 1306 }, // 8
-    { 14, 16, 17, 2, 16, 56, 1366 }, // 9
-    { 8, 13, 9, 0, 13, 26, 1422 }, // :
-    { 8, 15, 9, 0, 12, 30, 1448 }, // ;
-    { 16, 12, 17, -1, 13, 48, 1478 }, // <
-    { 11, 7, 14, 2, 9, 20, 1526 }, // =
-    { 16, 12, 18, 1, 13, 48, 1546 }, // >
-    { 14, 23, 18, 3, 23, 81, 1594 }, // ?
-    { 22, 19, 25, 2, 17, 105, 1675 }, // @
-    { 17, 18, 21, 0, 18, 77, 1780 }, // A
-    { 16, 18, 17, 0, 18, 72, 1857 }, // B
-    { 18, 20, 20, 1, 19, 90, 1929 }, // C
-    { 19, 18, 20, 0, 18, 86, 2019 }, // D
-    { 17, 18, 18, 0, 18, 77, 2105 }, // E
-    { 16, 18, 17, 0, 18, 72, 2182 }, // F
-    { 18, 19, 21, 1, 19, 86, 2254 }, // G
-    { 20, 18, 21, 0, 18, 90, 2340 }, // H
-    { 9, 18, 10, 0, 18, 41, 2430 }, // I
-    { 15, 24, 15, -1, 19, 90, 2471 }, // J
-    { 17, 18, 18, 0, 18, 77, 2561 }, // K
-    { 13, 18, 16, 0, 18, 59, 2638 }, // L
-    { 23, 18, 24, 0, 18, 104, 2697 }, // M
-    { 21, 18, 22, 0, 18, 95, 2801 }, // N
-    { 21, 19, 23, 1, 18, 100, 2896 }, // O
-    { 17, 18, 18, 0, 18, 77, 2996 }, // P
-    { 20, 21, 22, 1, 18, 105, 3073 }, // Q
-    { 16, 18, 17, 0, 18, 72, 3178 }, // R
-    { 18, 19, 20, 1, 18, 86, 3250 }, // S
-    { 17, 18, 22, 4, 18, 77, 3336 }, // T
-    { 19, 19, 21, 1, 18, 91, 3413 }, // U
-    { 17, 18, 23, 5, 18, 77, 3504 }, // V
-    { 24, 18, 29, 4, 18, 108, 3581 }, // W
-    { 21, 18, 22, 0, 18, 95, 3689 }, // X
-    { 15, 18, 21, 5, 18, 68, 3784 }, // Y
-    { 21, 18, 22, 0, 18, 95, 3852 }, // Z
-    { 16, 29, 16, -1, 22, 116, 3947 }, // [
-    { 4, 20, 10, 5, 16, 20, 4063 }, // <backslash>
-    { 15, 29, 11, -5, 22, 109, 4083 }, // ]
-    { 9, 5, 14, 4, 19, 12, 4192 }, // ^
-    { 15, 3, 17, 0, -2, 12, 4204 }, // _
-    { 6, 4, 12, 5, 16, 6, 4216 }, // `
-    { 14, 13, 16, 0, 13, 46, 4222 }, // a
-    { 13, 19, 17, 2, 18, 62, 4268 }, // b
-    { 11, 14, 14, 1, 13, 39, 4330 }, // c
-    { 16, 19, 18, 1, 18, 76, 4369 }, // d
-    { 13, 13, 16, 1, 13, 43, 4445 }, // e
-    { 10, 17, 13, 2, 17, 43, 4488 }, // f
-    { 15, 17, 16, 0, 12, 64, 4531 }, // g
-    { 14, 18, 16, 0, 18, 63, 4595 }, // h
-    { 9, 18, 10, 0, 18, 41, 4658 }, // i
-    { 13, 24, 16, 2, 18, 78, 4699 }, // j
-    { 12, 17, 16, 0, 17, 51, 4777 }, // k
-    { 8, 17, 10, 1, 17, 34, 4828 }, // l
-    { 22, 12, 23, 0, 12, 66, 4862 }, // m
-    { 14, 12, 16, 0, 12, 42, 4928 }, // n
-    { 14, 12, 16, 1, 12, 42, 4970 }, // o
-    { 17, 18, 17, -1, 12, 77, 5012 }, // p
-    { 15, 18, 18, 1, 13, 68, 5089 }, // q
-    { 11, 12, 12, 0, 12, 33, 5157 }, // r
-    { 12, 12, 15, 1, 12, 36, 5190 }, // s
-    { 10, 16, 14, 3, 16, 40, 5226 }, // t
-    { 13, 12, 15, 1, 12, 39, 5266 }, // u
-    { 14, 12, 18, 3, 12, 42, 5305 }, // v
-    { 17, 12, 21, 3, 12, 51, 5347 }, // w
-    { 16, 12, 17, 0, 12, 48, 5398 }, // x
-    { 16, 18, 17, 0, 12, 72, 5446 }, // y
-    { 15, 12, 16, 0, 12, 45, 5518 }, // z
-    { 13, 20, 16, 2, 16, 65, 5563 }, // {
-    { 8, 18, 9, 0, 15, 36, 5628 }, // |
-    { 12, 20, 13, 0, 16, 60, 5664 }, // }
-    { 9, 5, 14, 4, 16, 12, 5724 }, // ~
-    { 0, 0, 18, 0, 0, 0, 5736 }, //  
-    { 8, 22, 11, 2, 16, 44, 5736 }, // ¡
-    { 11, 19, 14, 1, 16, 53, 5780 }, // ¢
-    { 17, 20, 18, 0, 20, 85, 5833 }, // £
-    { 13, 11, 16, 2, 13, 36, 5918 }, // ¤
-    { 16, 18, 20, 3, 16, 72, 5954 }, // ¥
-    { 8, 18, 9, 0, 15, 36, 6026 }, // ¦
-    { 16, 18, 18, 1, 16, 72, 6062 }, // §
-    { 10, 4, 15, 4, 16, 10, 6134 }, // ¨
-    { 10, 8, 16, 5, 19, 20, 6144 }, // ©
-    { 8, 8, 12, 3, 16, 16, 6164 }, // ª
-    { 14, 10, 17, 2, 10, 35, 6180 }, // «
-    { 10, 6, 14, 3, 7, 15, 6215 }, // ¬
-    { 10, 3, 14, 3, 8, 8, 6230 }, // ­
-    { 10, 8, 16, 5, 22, 20, 6238 }, // ®
-    { 8, 3, 14, 5, 15, 6, 6258 }, // ¯
-    { 11, 10, 15, 3, 17, 28, 6264 }, // °
-    { 13, 13, 15, 0, 12, 43, 6292 }, // ±
-    { 7, 8, 10, 2, 17, 14, 6335 }, // ²
-    { 8, 8, 11, 2, 17, 16, 6349 }, // ³
-    { 6, 5, 11, 4, 17, 8, 6365 }, // ´
-    { 15, 14, 15, -1, 12, 53, 6373 }, // µ
-    { 14, 17, 16, 1, 15, 60, 6426 }, // ¶
-    { 5, 4, 8, 2, 9, 5, 6486 }, // ·
-    { 6, 6, 7, 0, 1, 9, 6491 }, // ¸
-    { 6, 9, 9, 2, 18, 14, 6500 }, // ¹
-    { 8, 7, 12, 3, 15, 14, 6514 }, // º
-    { 15, 10, 13, -3, 10, 38, 6528 }, // »
-    { 17, 20, 23, 5, 19, 85, 6566 }, // ¼
-    { 18, 20, 24, 5, 18, 90, 6651 }, // ½
-    { 18, 19, 23, 4, 18, 86, 6741 }, // ¾
-    { 14, 23, 13, -2, 12, 81, 6827 }, // ¿
-    { 17, 24, 21, 0, 24, 102, 6908 }, // À
-    { 19, 27, 21, 0, 27, 129, 7010 }, // Á
-    { 19, 23, 21, 0, 23, 110, 7139 }, // Â
-    { 19, 24, 21, 0, 24, 114, 7249 }, // Ã
-    { 20, 24, 21, 0, 24, 120, 7363 }, // Ä
-    { 18, 25, 21, 0, 25, 113, 7483 }, // Å
-    { 28, 19, 30, 0, 18, 133, 7596 }, // Æ
-    { 18, 24, 20, 1, 19, 108, 7729 }, // Ç
-    { 17, 23, 18, 0, 23, 98, 7837 }, // È
-    { 17, 27, 18, 0, 27, 115, 7935 }, // É
-    { 17, 23, 18, 0, 23, 98, 8050 }, // Ê
-    { 18, 24, 19, 0, 24, 108, 8148 }, // Ë
-    { 11, 25, 12, 0, 25, 69, 8256 }, // Ì
-    { 13, 29, 14, 0, 29, 95, 8325 }, // Í
-    { 13, 25, 14, 0, 25, 82, 8420 }, // Î
-    { 14, 25, 15, 0, 25, 88, 8502 }, // Ï
-    { 19, 18, 20, 0, 18, 86, 8590 }, // Ð
-    { 21, 23, 22, 0, 23, 121, 8676 }, // Ñ
-    { 21, 25, 23, 1, 24, 132, 8797 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 8929 }, // Ó
-    { 21, 24, 23, 1, 23, 126, 9082 }, // Ô
-    { 21, 25, 23, 1, 24, 132, 9208 }, // Õ
-    { 21, 25, 23, 1, 24, 132, 9340 }, // Ö
-    { 10, 6, 13, 2, 8, 15, 9472 }, // ×
-    { 37, 34, 30, -8, 26, 315, 9487 }, // Ø
-    { 19, 25, 21, 1, 24, 119, 9802 }, // Ù
-    { 19, 28, 21, 1, 27, 133, 9921 }, // Ú
-    { 19, 25, 21, 1, 24, 119, 10054 }, // Û
-    { 19, 25, 21, 1, 24, 119, 10173 }, // Ü
-    { 15, 28, 21, 5, 28, 105, 10292 }, // Ý
-    { 13, 17, 15, 1, 17, 56, 10397 }, // Þ
-    { 15, 17, 17, 1, 17, 64, 10453 }, // ß
-    { 14, 17, 16, 0, 17, 60, 10517 }, // à
-    { 14, 21, 16, 0, 21, 74, 10577 }, // á
-    { 15, 17, 16, 0, 17, 64, 10651 }, // â
-    { 14, 17, 16, 0, 17, 60, 10715 }, // ã
-    { 15, 17, 16, 0, 17, 64, 10775 }, // ä
-    { 14, 18, 16, 0, 18, 63, 10839 }, // å
-    { 23, 13, 26, 0, 13, 75, 10902 }, // æ
-    { 11, 18, 14, 1, 13, 50, 10977 }, // ç
-    { 13, 19, 16, 1, 19, 62, 11027 }, // è
-    { 14, 23, 16, 1, 23, 81, 11089 }, // é
-    { 14, 19, 16, 1, 19, 67, 11170 }, // ê
-    { 15, 20, 17, 1, 20, 75, 11237 }, // ë
-    { 9, 18, 10, 0, 18, 41, 11312 }, // ì
-    { 11, 21, 12, 0, 21, 58, 11353 }, // í
-    { 11, 17, 12, 0, 17, 47, 11411 }, // î
-    { 11, 18, 12, 0, 18, 50, 11458 }, // ï
-    { 18, 17, 21, 2, 17, 77, 11508 }, // ð
-    { 16, 18, 17, 0, 18, 72, 11585 }, // ñ
-    { 14, 19, 16, 1, 19, 67, 11657 }, // ò
-    { 14, 23, 16, 1, 23, 81, 11724 }, // ó
-    { 14, 19, 16, 1, 19, 67, 11805 }, // ô
-    { 14, 19, 16, 1, 19, 67, 11872 }, // õ
-    { 15, 19, 17, 1, 19, 72, 11939 }, // ö
-    { 14, 13, 18, 3, 13, 46, 12011 }, // ÷
-    { 21, 33, 19, -3, 22, 174, 12057 }, // ø
-    { 13, 18, 15, 1, 18, 59, 12231 }, // ù
-    { 13, 22, 15, 1, 22, 72, 12290 }, // ú
-    { 13, 17, 15, 1, 17, 56, 12362 }, // û
-    { 14, 18, 16, 1, 18, 63, 12418 }, // ü
-    { 16, 29, 17, 0, 23, 116, 12481 }, // ý
-    { 13, 21, 14, 0, 17, 69, 12597 }, // þ
-    { 16, 26, 17, 0, 20, 104, 12666 }, // ÿ
-    { 20, 23, 21, 0, 23, 115, 12770 }, // Ā
-    { 15, 16, 16, 0, 16, 60, 12885 }, // ā
-    { 20, 26, 21, 0, 26, 130, 12945 }, // Ă
-    { 15, 19, 16, 0, 19, 72, 13075 }, // ă
-    { 17, 23, 21, 0, 18, 98, 13147 }, // Ą
-    { 14, 17, 16, 0, 13, 60, 13245 }, // ą
-    { 18, 29, 20, 1, 28, 131, 13305 }, // Ć
-    { 13, 21, 15, 1, 20, 69, 13436 }, // ć
-    { 18, 27, 20, 1, 26, 122, 13505 }, // Ĉ
-    { 14, 19, 16, 1, 18, 67, 13627 }, // ĉ
-    { 18, 27, 20, 1, 26, 122, 13694 }, // Ċ
-    { 11, 20, 14, 1, 19, 55, 13816 }, // ċ
-    { 18, 28, 20, 1, 27, 126, 13871 }, // Č
-    { 13, 21, 15, 1, 20, 69, 13997 }, // č
-    { 19, 26, 20, 0, 26, 124, 14066 }, // Ď
-    { 20, 19, 22, 1, 18, 95, 14190 }, // ď
-    { 19, 18, 20, 0, 18, 86, 14285 }, // Đ
-    { 19, 19, 21, 1, 18, 91, 14371 }, // đ
-    { 18, 23, 19, 0, 23, 104, 14462 }, // Ē
-    { 15, 19, 17, 1, 19, 72, 14566 }, // ē
-    { 18, 26, 19, 0, 26, 117, 14638 }, // Ĕ
-    { 15, 22, 17, 1, 22, 83, 14755 }, // ĕ
-    { 17, 25, 18, 0, 25, 107, 14838 }, // Ė
-    { 13, 21, 16, 1, 21, 69, 14945 }, // ė
-    { 17, 23, 18, 0, 18, 98, 15014 }, // Ę
-    { 13, 19, 16, 1, 13, 62, 15112 }, // ę
-    { 17, 25, 18, 0, 25, 107, 15174 }, // Ě
-    { 14, 22, 16, 1, 22, 77, 15281 }, // ě
-    { 19, 24, 21, 1, 24, 114, 15358 }, // Ĝ
-    { 16, 23, 17, 0, 18, 92, 15472 }, // ĝ
-    { 19, 26, 21, 1, 26, 124, 15564 }, // Ğ
-    { 15, 25, 16, 0, 20, 94, 15688 }, // ğ
-    { 18, 25, 21, 1, 25, 113, 15782 }, // Ġ
-    { 15, 24, 16, 0, 19, 90, 15895 }, // ġ
-    { 18, 28, 21, 1, 19, 126, 15985 }, // Ģ
-    { 15, 25, 16, 0, 20, 94, 16111 }, // ģ
-    { 20, 24, 21, 0, 24, 120, 16205 }, // Ĥ
-    { 14, 23, 16, 0, 23, 81, 16325 }, // ĥ
-    { 20, 18, 21, 0, 18, 90, 16406 }, // Ħ
-    { 14, 18, 16, 0, 18, 63, 16496 }, // ħ
-    { 13, 26, 14, 0, 26, 85, 16559 }, // Ĩ
-    { 11, 18, 12, 0, 18, 50, 16644 }, // ĩ
-    { 14, 24, 15, 0, 24, 84, 16694 }, // Ī
-    { 11, 17, 12, 0, 17, 47, 16778 }, // ī
-    { 10, 23, 13, 2, 18, 58, 16825 }, // Į
-    { 10, 24, 10, -1, 19, 60, 16883 }, // į
-    { 11, 26, 12, 0, 26, 72, 16943 }, // İ
-    { 7, 12, 8, 0, 12, 21, 17015 }, // ı
-    { 17, 23, 19, 0, 18, 98, 17036 }, // Ĳ
-    { 20, 24, 21, 0, 18, 120, 17134 }, // ĳ
-    { 18, 29, 18, -1, 24, 131, 17254 }, // Ĵ
-    { 17, 24, 20, 2, 18, 102, 17385 }, // ĵ
-    { 17, 25, 18, 0, 18, 107, 17487 }, // Ķ
-    { 12, 26, 16, 0, 17, 78, 17594 }, // ķ
-    { 10, 12, 12, 0, 12, 30, 17672 }, // ĸ
-    { 13, 25, 16, 0, 25, 82, 17702 }, // Ĺ
-    { 12, 25, 14, 1, 25, 75, 17784 }, // ĺ
-    { 13, 27, 16, 0, 18, 88, 17859 }, // Ļ
-    { 9, 25, 10, 0, 17, 57, 17947 }, // ļ
-    { 15, 18, 16, 0, 18, 68, 18004 }, // Ľ
-    { 13, 18, 15, 1, 18, 59, 18072 }, // ľ
-    { 15, 18, 16, 0, 18, 68, 18131 }, // Ŀ
-    { 11, 17, 13, 1, 17, 47, 18199 }, // ŀ
-    { 29, 27, 20, -10, 22, 196, 18246 }, // Ł
-    { 20, 17, 14, -7, 17, 85, 18442 }, // ł
-    { 21, 25, 22, 0, 25, 132, 18527 }, // Ń
-    { 15, 20, 16, 0, 20, 75, 18659 }, // ń
-    { 21, 25, 22, 0, 18, 132, 18734 }, // Ņ
-    { 14, 19, 16, 0, 12, 67, 18866 }, // ņ
-    { 21, 25, 22, 0, 25, 132, 18933 }, // Ň
-    { 15, 20, 16, 0, 20, 75, 19065 }, // ň
-    { 14, 22, 14, -2, 22, 77, 19140 }, // ŉ
-    { 21, 23, 22, 0, 18, 121, 19217 }, // Ŋ
-    { 14, 16, 16, 0, 12, 56, 19338 }, // ŋ
-    { 21, 24, 23, 1, 23, 126, 19394 }, // Ō
-    { 15, 18, 17, 1, 18, 68, 19520 }, // ō
-    { 21, 27, 23, 1, 26, 142, 19588 }, // Ŏ
-    { 15, 22, 17, 1, 22, 83, 19730 }, // ŏ
-    { 21, 26, 23, 1, 25, 137, 19813 }, // Ő
-    { 17, 20, 19, 1, 20, 85, 19950 }, // ő
-    { 28, 19, 30, 1, 19, 133, 20035 }, // Œ
-    { 22, 13, 24, 1, 13, 72, 20168 }, // œ
-    { 16, 25, 17, 0, 25, 100, 20240 }, // Ŕ
-    { 11, 18, 12, 0, 18, 50, 20340 }, // ŕ
-    { 16, 28, 17, 0, 18, 112, 20390 }, // Ŗ
-    { 12, 23, 12, -1, 12, 69, 20502 }, // ŗ
-    { 16, 25, 17, 0, 25, 100, 20571 }, // Ř
-    { 12, 18, 13, 0, 18, 54, 20671 }, // ř
-    { 18, 28, 20, 1, 27, 126, 20725 }, // Ś
-    { 12, 20, 15, 1, 20, 60, 20851 }, // ś
-    { 19, 26, 21, 1, 25, 124, 20911 }, // Ŝ
-    { 13, 18, 15, 1, 18, 59, 21035 }, // ŝ
-    { 18, 23, 20, 1, 18, 104, 21094 }, // Ş
-    { 12, 18, 15, 1, 12, 54, 21198 }, // ş
-    { 18, 27, 20, 1, 26, 122, 21252 }, // Š
-    { 12, 20, 15, 1, 20, 60, 21374 }, // š
-    { 17, 22, 22, 4, 18, 94, 21434 }, // Ţ
-    { 10, 20, 14, 3, 16, 50, 21528 }, // ţ
-    { 17, 24, 22, 4, 24, 102, 21578 }, // Ť
-    { 12, 18, 16, 3, 18, 54, 21680 }, // ť
-    { 17, 18, 22, 4, 18, 77, 21734 }, // Ŧ
-    { 12, 16, 14, 1, 16, 48, 21811 }, // ŧ
-    { 19, 26, 21, 1, 25, 124, 21859 }, // Ũ
-    { 13, 19, 15, 1, 19, 62, 21983 }, // ũ
-    { 19, 24, 21, 1, 23, 114, 22045 }, // Ū
-    { 14, 17, 16, 1, 17, 60, 22159 }, // ū
-    { 19, 28, 21, 1, 27, 133, 22219 }, // Ŭ
-    { 14, 20, 16, 1, 20, 70, 22352 }, // ŭ
-    { 19, 27, 21, 1, 26, 129, 22422 }, // Ů
-    { 13, 20, 15, 1, 20, 65, 22551 }, // ů
-    { 20, 26, 22, 1, 25, 130, 22616 }, // Ű
-    { 16, 19, 18, 1, 19, 76, 22746 }, // ű
-    { 19, 23, 21, 1, 18, 110, 22822 }, // Ų
-    { 13, 17, 15, 1, 12, 56, 22932 }, // ų
-    { 24, 23, 29, 4, 23, 138, 22988 }, // Ŵ
-    { 17, 18, 21, 3, 18, 77, 23126 }, // ŵ
-    { 15, 24, 21, 5, 24, 90, 23203 }, // Ŷ
-    { 16, 25, 17, 0, 19, 100, 23293 }, // ŷ
-    { 15, 25, 21, 5, 25, 94, 23393 }, // Ÿ
-    { 21, 25, 22, 0, 25, 132, 23487 }, // Ź
-    { 15, 20, 16, 0, 20, 75, 23619 }, // ź
-    { 21, 24, 22, 0, 24, 126, 23694 }, // Ż
-    { 15, 19, 16, 0, 19, 72, 23820 }, // ż
-    { 21, 25, 22, 0, 25, 132, 23892 }, // Ž
-    { 15, 20, 16, 0, 20, 75, 24024 }, // ž
-    { 11, 17, 15, 3, 17, 47, 24099 }, // ſ
-    { 25, 21, 27, 1, 20, 132, 24146 }, // Ơ
-    { 16, 13, 18, 1, 13, 52, 24278 }, // ơ
-    { 17, 18, 18, 0, 18, 77, 24330 }, // Ƥ
-    { 17, 22, 17, -1, 16, 94, 24407 }, // ƥ
-    { 14, 16, 16, 1, 15, 56, 24501 }, // Ʃ
-    { 17, 18, 22, 4, 18, 77, 24557 }, // Ƭ
-    { 11, 19, 15, 3, 19, 53, 24634 }, // ƭ
-    { 17, 22, 22, 4, 18, 94, 24687 }, // Ʈ
-    { 22, 20, 24, 1, 19, 110, 24781 }, // Ư
-    { 16, 14, 18, 1, 14, 56, 24891 }, // ư
-    { 6, 4, 12, 5, 16, 6, 24947 }, // ̀
-    { 6, 5, 11, 4, 17, 8, 24953 }, // ́
-    { 10, 5, 10, -1, 1, 13, 24961 }, // ̂
-    { 9, 5, 14, 4, 16, 12, 24974 }, // ̃
-    { 10, 3, 15, 4, 14, 8, 24986 }, // ̄
-    { 14, 3, 21, 6, 18, 11, 24994 }, // ̅
-    { 10, 5, 15, 4, 16, 13, 25005 }, // ̆
-    { 5, 4, 10, 4, 16, 5, 25018 }, // ̇
-    { 10, 4, 15, 4, 16, 10, 25023 }, // ̈
-    { 6, 4, 10, 3, 13, 6, 25033 }, // ̉
-    { 6, 5, 11, 4, 16, 8, 25039 }, // ̊
-    { 15, 4, 20, 4, 16, 15, 25047 }, // ̋
-    { 9, 5, 14, 4, 16, 12, 25062 }, // ̌
-    { 15, 4, 9, -7, 17, 15, 25074 }, // ̏
-    { 7, 6, 11, 3, 16, 11, 25089 }, // ̒
-    { 7, 6, 11, 3, 15, 11, 25100 }, // ̓
-    { 8, 6, 5, -4, 15, 12, 25111 }, // ̔
-    { 5, 5, 6, 0, -1, 7, 25123 }, // ̘
-    { 5, 5, 7, 1, -1, 7, 25130 }, // ̙
-    { 9, 5, 15, 5, 17, 12, 25137 }, // ̚
-    { 4, 5, 9, 4, 14, 5, 25149 }, // ̛
-    { 4, 5, 5, 0, -1, 5, 25154 }, // ̜
-    { 5, 4, 8, 2, 3, 5, 25159 }, // ̝
-    { 5, 4, 6, 0, -1, 5, 25164 }, // ̞
-    { 5, 5, 6, 0, -2, 7, 25169 }, // ̟
-    { 10, 3, 11, 0, -3, 8, 25176 }, // ̠
-    { 5, 4, 6, 0, 1, 5, 25184 }, // ̣
-    { 11, 4, 11, -1, 0, 11, 25189 }, // ̤
-    { 6, 5, 11, 4, 16, 8, 25200 }, // ̥
-    { 7, 6, 8, 0, 3, 11, 25208 }, // ̦
-    { 6, 6, 7, 0, 1, 9, 25219 }, // ̧
-    { 6, 6, 7, 0, 1, 9, 25228 }, // ̨
-    { 5, 6, 5, -1, -1, 8, 25237 }, // ̩
-    { 8, 4, 9, 0, -1, 8, 25245 }, // ̪
-    { 9, 5, 10, 0, 0, 12, 25253 }, // ̬
-    { 9, 5, 9, -1, -1, 12, 25265 }, // ̭
-    { 9, 5, 14, 4, 16, 12, 25277 }, // ̰
-    { 8, 3, 14, 5, 15, 6, 25289 }, // ̱
-    { 9, 3, 10, 0, -1, 7, 25295 }, // ̲
-    { 9, 5, 14, 4, 16, 12, 25302 }, // ̴
-    { 10, 3, 14, 3, 8, 8, 25314 }, // ̵
-    { 3, 5, 6, 2, -1, 4, 25322 }, // ̹
-    { 7, 4, 7, -1, -1, 7, 25326 }, // ̺
-    { 8, 5, 9, 0, 0, 10, 25333 }, // ̻
-    { 8, 4, 9, 0, 0, 8, 25343 }, // ̼
-    { 6, 5, 11, 4, 16, 8, 25351 }, // ̽
-    { 9, 5, 14, 4, 16, 12, 25359 }, // ͂
-    { 4, 4, 9, 4, 17, 4, 25371 }, // ̓
-    { 10, 10, 15, 4, 22, 25, 25375 }, // ̈́
-    { 7, 4, 13, 5, 16, 7, 25400 }, // ͆
-    { 12, 8, 12, -1, 0, 24, 25407 }, // ͇
-    { 9, 6, 10, 0, 0, 14, 25431 }, // ͈
-    { 7, 6, 8, 0, -1, 11, 25445 }, // ͉
-    { 10, 13, 15, 4, 20, 33, 25456 }, // ͊
-    { 20, 10, 28, 7, 19, 50, 25489 }, // ͋
-    { 15, 11, 20, 4, 11, 42, 25539 }, // ͌
-    { 11, 7, 13, 1, 0, 20, 25581 }, // ͍
-    { 3, 3, 7, 3, 2, 3, 25601 }, // ͎
-    { 17, 4, 19, 1, 0, 17, 25604 }, // ͜
-    { 18, 4, 23, 4, 16, 18, 25621 }, // ͡
-    { 21, 5, 22, 0, -1, 27, 25639 }, // ͢
-    { 17, 18, 21, 0, 18, 77, 25666 }, // Α
-    { 16, 18, 17, 0, 18, 72, 25743 }, // Β
-    { 14, 17, 16, 1, 16, 60, 25815 }, // Γ
-    { 16, 16, 18, 1, 16, 64, 25875 }, // Δ
-    { 17, 18, 18, 0, 18, 77, 25939 }, // Ε
-    { 21, 18, 22, 0, 18, 95, 26016 }, // Ζ
-    { 20, 18, 21, 0, 18, 90, 26111 }, // Η
-    { 21, 19, 23, 1, 18, 100, 26201 }, // Θ
-    { 9, 18, 10, 0, 18, 41, 26301 }, // Ι
-    { 17, 18, 18, 0, 18, 77, 26342 }, // Κ
-    { 17, 18, 21, 1, 18, 77, 26419 }, // Λ
-    { 23, 18, 24, 0, 18, 104, 26496 }, // Μ
-    { 21, 18, 22, 0, 18, 95, 26600 }, // Ν
-    { 17, 15, 19, 1, 15, 64, 26695 }, // Ξ
-    { 21, 19, 23, 1, 18, 100, 26759 }, // Ο
-    { 15, 15, 17, 1, 15, 57, 26859 }, // Π
-    { 17, 18, 18, 0, 18, 77, 26916 }, // Ρ
-    { 14, 16, 16, 1, 15, 56, 26993 }, // Σ
-    { 17, 18, 22, 4, 18, 77, 27049 }, // Τ
-    { 15, 18, 21, 5, 18, 68, 27126 }, // Υ
-    { 25, 22, 28, 2, 20, 138, 27194 }, // Φ
-    { 21, 18, 22, 0, 18, 95, 27332 }, // Χ
-    { 17, 18, 21, 3, 16, 77, 27427 }, // Ψ
-    { 19, 17, 20, 0, 16, 81, 27504 }, // Ω
-    { 17, 14, 20, 0, 13, 60, 27585 }, // α
-    { 15, 24, 16, 0, 20, 90, 27645 }, // β
-    { 11, 18, 16, 4, 12, 50, 27735 }, // γ
-    { 14, 18, 17, 2, 18, 63, 27785 }, // δ
-    { 10, 11, 12, 1, 11, 28, 27848 }, // ε
-    { 13, 18, 16, 2, 15, 59, 27876 }, // ζ
-    { 14, 20, 17, 2, 14, 70, 27935 }, // η
-    { 14, 16, 17, 2, 16, 56, 28005 }, // θ
-    { 7, 14, 11, 0, 14, 25, 28061 }, // ι
-    { 12, 13, 13, 0, 13, 39, 28086 }, // κ
-    { 16, 17, 16, -7, 17, 68, 28125 }, // λ
-    { 15, 14, 15, -1, 12, 53, 28193 }, // μ
-    { 11, 12, 16, 4, 12, 33, 28246 }, // ν
-    { 12, 18, 15, 2, 15, 54, 28279 }, // ξ
-    { 14, 12, 16, 1, 12, 42, 28333 }, // ο
-    { 14, 12, 18, 3, 11, 42, 28375 }, // π
-    { 16, 17, 17, 0, 12, 68, 28417 }, // ρ
-    { 11, 14, 15, 3, 15, 39, 28485 }, // ς
-    { 19, 12, 21, 1, 12, 57, 28524 }, // σ
-    { 11, 12, 16, 4, 11, 33, 28581 }, // τ
-    { 11, 13, 14, 2, 12, 36, 28614 }, // υ
-    { 20, 26, 22, 1, 23, 130, 28650 }, // φ
-    { 18, 16, 19, 0, 12, 72, 28780 }, // χ
-    { 12, 20, 15, 2, 15, 60, 28852 }, // ψ
-    { 15, 12, 18, 2, 11, 45, 28912 }, // ω
-    { 17, 25, 21, 0, 18, 107, 28957 }, // Ạ
-    { 14, 19, 16, 0, 13, 67, 29064 }, // ạ
-    { 19, 26, 21, 0, 26, 124, 29131 }, // Ả
-    { 14, 19, 16, 0, 19, 67, 29255 }, // ả
-    { 22, 29, 23, 0, 29, 160, 29322 }, // Ấ
-    { 22, 24, 23, 0, 24, 132, 29482 }, // ấ
-    { 19, 27, 21, 0, 27, 129, 29614 }, // Ầ
-    { 15, 20, 16, 0, 20, 75, 29743 }, // ầ
-    { 22, 29, 23, 0, 29, 160, 29818 }, // Ẩ
-    { 15, 21, 16, 0, 21, 79, 29978 }, // ẩ
-    { 18, 29, 21, 0, 29, 131, 30057 }, // Ẫ
-    { 14, 22, 16, 0, 22, 77, 30188 }, // ẫ
-    { 19, 30, 21, 0, 23, 143, 30265 }, // Ậ
-    { 14, 22, 16, 0, 16, 77, 30408 }, // ậ
-    { 20, 34, 21, 0, 34, 170, 30485 }, // Ắ
-    { 15, 27, 16, 0, 27, 102, 30655 }, // ắ
-    { 20, 31, 21, 0, 31, 155, 30757 }, // Ằ
-    { 15, 24, 16, 0, 24, 90, 30912 }, // ằ
-    { 20, 33, 21, 0, 33, 165, 31002 }, // Ẳ
-    { 15, 28, 16, 0, 28, 105, 31167 }, // ẳ
-    { 20, 32, 21, 0, 32, 160, 31272 }, // Ẵ
-    { 15, 25, 16, 0, 25, 94, 31432 }, // ẵ
-    { 20, 33, 21, 0, 26, 165, 31526 }, // Ặ
-    { 15, 25, 16, 0, 19, 94, 31691 }, // ặ
-    { 17, 23, 18, 0, 18, 98, 31785 }, // Ẹ
-    { 13, 19, 16, 1, 13, 62, 31883 }, // ẹ
-    { 17, 25, 18, 0, 25, 107, 31945 }, // Ẻ
-    { 14, 21, 16, 1, 21, 74, 32052 }, // ẻ
-    { 17, 25, 18, 0, 25, 107, 32126 }, // Ẽ
-    { 14, 20, 16, 1, 20, 70, 32233 }, // ẽ
-    { 17, 28, 18, 0, 28, 119, 32303 }, // Ế
-    { 21, 21, 23, 1, 21, 111, 32422 }, // ế
-    { 17, 26, 18, 0, 26, 111, 32533 }, // Ề
-    { 14, 22, 16, 1, 22, 77, 32644 }, // ề
-    { 17, 28, 18, 0, 28, 119, 32721 }, // Ể
-    { 15, 24, 17, 1, 24, 90, 32840 }, // ể
-    { 17, 29, 18, 0, 29, 124, 32930 }, // Ễ
-    { 13, 25, 16, 1, 25, 82, 33054 }, // ễ
-    { 17, 28, 18, 0, 23, 119, 33136 }, // Ệ
-    { 15, 26, 17, 1, 20, 98, 33255 }, // ệ
-    { 12, 27, 13, 0, 27, 81, 33353 }, // Ỉ
-    { 10, 19, 11, 0, 19, 48, 33434 }, // ỉ
-    { 10, 23, 10, -1, 18, 58, 33482 }, // Ị
-    { 10, 23, 10, -1, 18, 58, 33540 }, // ị
-    { 21, 24, 23, 1, 18, 126, 33598 }, // Ọ
-    { 14, 19, 16, 1, 12, 67, 33724 }, // ọ
-    { 21, 26, 23, 1, 25, 137, 33791 }, // Ỏ
-    { 14, 21, 16, 1, 21, 74, 33928 }, // ỏ
-    { 25, 24, 27, 1, 23, 150, 34002 }, // Ố
-    { 21, 20, 23, 1, 20, 105, 34152 }, // ố
-    { 21, 29, 23, 1, 28, 153, 34257 }, // Ồ
-    { 14, 22, 16, 1, 22, 77, 34410 }, // ồ
-    { 25, 28, 27, 1, 27, 175, 34487 }, // Ổ
-    { 15, 24, 17, 1, 24, 90, 34662 }, // ổ
-    { 21, 30, 23, 1, 29, 158, 34752 }, // Ỗ
-    { 14, 24, 16, 1, 24, 84, 34910 }, // ỗ
-    { 21, 29, 23, 1, 23, 153, 34994 }, // Ộ
-    { 14, 25, 16, 1, 19, 88, 35147 }, // ộ
-    { 25, 28, 27, 1, 27, 175, 35235 }, // Ớ
-    { 16, 22, 18, 1, 22, 88, 35410 }, // ớ
-    { 25, 26, 27, 1, 25, 163, 35498 }, // Ờ
-    { 16, 20, 18, 1, 20, 80, 35661 }, // ờ
-    { 25, 27, 27, 1, 26, 169, 35741 }, // Ở
-    { 16, 21, 18, 1, 21, 84, 35910 }, // ở
-    { 25, 26, 27, 1, 25, 163, 35994 }, // Ỡ
-    { 16, 20, 18, 1, 20, 80, 36157 }, // ỡ
-    { 25, 26, 27, 1, 20, 163, 36237 }, // Ợ
-    { 16, 20, 18, 1, 13, 80, 36400 }, // ợ
-    { 19, 24, 21, 1, 18, 114, 36480 }, // Ụ
-    { 13, 18, 15, 1, 12, 59, 36594 }, // ụ
-    { 19, 27, 21, 1, 26, 129, 36653 }, // Ủ
-    { 13, 19, 15, 1, 19, 62, 36782 }, // ủ
-    { 22, 27, 24, 1, 26, 149, 36844 }, // Ứ
-    { 16, 20, 18, 1, 20, 80, 36993 }, // ứ
-    { 22, 26, 24, 1, 25, 143, 37073 }, // Ừ
-    { 16, 18, 18, 1, 18, 72, 37216 }, // ừ
-    { 22, 27, 24, 1, 26, 149, 37288 }, // Ử
-    { 16, 19, 18, 1, 19, 76, 37437 }, // ử
-    { 22, 26, 24, 1, 25, 143, 37513 }, // Ữ
-    { 16, 19, 18, 1, 19, 76, 37656 }, // ữ
-    { 22, 25, 24, 1, 19, 138, 37732 }, // Ự
-    { 16, 20, 18, 1, 14, 80, 37870 }, // ự
-    { 15, 25, 21, 5, 25, 94, 37950 }, // Ỳ
-    { 16, 25, 17, 0, 19, 100, 38044 }, // ỳ
-    { 17, 27, 21, 3, 18, 115, 38144 }, // Ỵ
-    { 16, 18, 17, 0, 12, 72, 38259 }, // ỵ
-    { 15, 26, 21, 5, 26, 98, 38331 }, // Ỷ
-    { 16, 27, 17, 0, 21, 108, 38429 }, // ỷ
-    { 15, 25, 21, 5, 25, 94, 38537 }, // Ỹ
-    { 16, 27, 17, 0, 21, 108, 38631 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 38739 }, //  
-    { 0, 0, 28, 0, 0, 0, 38739 }, //  
-    { 0, 0, 17, 0, 0, 0, 38739 }, //  
-    { 0, 0, 28, 0, 0, 0, 38739 }, //  
-    { 0, 0, 14, 0, 0, 0, 38739 }, //  
-    { 0, 0, 12, 0, 0, 0, 38739 }, //  
-    { 0, 0, 10, 0, 0, 0, 38739 }, //  
-    { 0, 0, 14, 0, 0, 0, 38739 }, //  
-    { 0, 0, 5, 0, 0, 0, 38739 }, //  
-    { 0, 0, 11, 0, 0, 0, 38739 }, //  
-    { 0, 0, 10, 0, 0, 0, 38739 }, //  
-    { 0, 0, 7, 0, 0, 0, 38739 }, // ​
-    { 0, 0, 1, 0, 0, 0, 38739 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 38739 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 38739 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 38739 }, // ‏
-    { 10, 3, 14, 3, 8, 8, 38739 }, // ‐
-    { 10, 3, 14, 3, 8, 8, 38747 }, // ‑
-    { 16, 3, 20, 3, 8, 12, 38755 }, // ‒
-    { 14, 3, 18, 3, 8, 11, 38767 }, // –
-    { 21, 3, 25, 3, 8, 16, 38778 }, // —
-    { 21, 3, 25, 3, 8, 16, 38794 }, // ―
-    { 14, 18, 15, 0, 15, 63, 38810 }, // ‖
-    { 17, 8, 18, 0, -1, 34, 38873 }, // ‗
-    { 7, 6, 12, 4, 18, 11, 38907 }, // ‘
-    { 7, 6, 12, 4, 18, 11, 38918 }, // ’
-    { 7, 6, 8, 0, 3, 11, 38929 }, // ‚
-    { 7, 6, 12, 4, 18, 11, 38940 }, // ‛
-    { 12, 6, 17, 4, 18, 18, 38951 }, // “
-    { 12, 6, 17, 4, 18, 18, 38969 }, // ”
-    { 7, 6, 8, 0, 3, 11, 38987 }, // „
-    { 12, 6, 17, 4, 18, 18, 38998 }, // ‟
-    { 12, 27, 16, 3, 21, 81, 39016 }, // †
-    { 14, 27, 16, 1, 21, 95, 39097 }, // ‡
-    { 14, 12, 15, 0, 14, 42, 39192 }, // •
-    { 7, 7, 10, 2, 9, 13, 39234 }, // ‣
-    { 4, 4, 6, 1, 4, 4, 39247 }, // ․
-    { 4, 4, 6, 1, 4, 4, 39251 }, // ‥
-    { 19, 4, 21, 1, 4, 19, 39255 }, // …
-    { 4, 3, 6, 1, 8, 3, 39274 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 39277 }, //  
-    { 17, 18, 23, 5, 16, 77, 39277 }, // ‰
-    { 7, 6, 12, 4, 18, 11, 39354 }, // ′
-    { 12, 6, 17, 4, 18, 18, 39365 }, // ″
-    { 15, 7, 18, -2, 18, 27, 39383 }, // ‴
-    { 4, 7, 10, 5, 18, 7, 39410 }, // ‵
-    { 9, 7, 14, 4, 18, 16, 39417 }, // ‶
-    { 15, 7, 21, 5, 18, 27, 39433 }, // ‷
-    { 9, 4, 15, 5, 17, 9, 39460 }, // ‸
-    { 7, 10, 11, 3, 11, 18, 39469 }, // ‹
-    { 8, 10, 9, -2, 11, 20, 39487 }, // ›
-    { 27, 21, 29, 1, 19, 142, 39507 }, // ※
-    { 11, 21, 12, 0, 21, 58, 39649 }, // ‼
-    { 14, 26, 19, 4, 25, 91, 39707 }, // ‽
-    { 11, 3, 17, 5, 17, 9, 39798 }, // ‾
-    { 10, 4, 15, 4, 14, 10, 39807 }, // ‿
-    { 15, 14, 19, 3, 19, 53, 39817 }, // ⁂
-    { 17, 17, 23, 5, 16, 73, 39870 }, // ⁄
-    { 25, 24, 31, 5, 24, 150, 39943 }, // ⁇
-    { 18, 23, 24, 5, 23, 104, 40093 }, // ⁈
-    { 21, 25, 22, 0, 23, 132, 40197 }, // ⁉
-    { 21, 33, 21, -1, 23, 174, 40329 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 40503 }, //  
-    { 8, 8, 11, 2, 17, 16, 40503 }, // ⁰
-    { 6, 9, 10, 3, 18, 14, 40519 }, // ⁴
-    { 8, 9, 11, 2, 18, 18, 40533 }, // ⁵
-    { 8, 8, 11, 2, 17, 16, 40551 }, // ⁶
-    { 6, 9, 11, 4, 18, 14, 40567 }, // ⁷
-    { 8, 8, 11, 2, 17, 16, 40581 }, // ⁸
-    { 8, 8, 11, 2, 17, 16, 40597 }, // ⁹
-    { 14, 12, 16, 0, 12, 42, 40613 }, // ⁿ
-    { 10, 11, 12, 1, 11, 28, 40655 }, // ₀
-    { 6, 9, 6, -1, 5, 14, 40683 }, // ₁
-    { 7, 9, 7, -1, 5, 16, 40697 }, // ₂
-    { 7, 9, 7, -1, 5, 16, 40713 }, // ₃
-    { 7, 8, 7, -1, 5, 14, 40729 }, // ₄
-    { 7, 8, 7, -1, 5, 14, 40743 }, // ₅
-    { 7, 8, 7, -1, 4, 14, 40757 }, // ₆
-    { 6, 9, 8, 1, 5, 14, 40771 }, // ₇
-    { 8, 9, 8, -1, 5, 18, 40785 }, // ₈
-    { 8, 9, 8, -1, 5, 18, 40803 }, // ₉
-    { 12, 29, 15, 2, 21, 87, 40821 }, // ₍
-    { 12, 29, 9, -5, 21, 87, 40908 }, // ₎
-    { 20, 28, 21, 0, 23, 140, 40995 }, // ₡
-    { 18, 20, 20, 1, 19, 90, 41135 }, // ₢
-    { 17, 20, 18, 0, 20, 85, 41225 }, // ₤
-    { 21, 18, 22, 0, 18, 95, 41310 }, // ₦
-    { 18, 18, 19, 0, 18, 81, 41405 }, // ₧
-    { 24, 18, 25, 0, 18, 108, 41486 }, // ₨
-    { 18, 18, 18, -1, 18, 81, 41594 }, // ₩
-    { 20, 16, 24, 3, 16, 80, 41675 }, // ₪
-    { 15, 17, 18, 2, 17, 64, 41755 }, // ₫
-    { 16, 19, 19, 2, 16, 76, 41819 }, // €
-    { 17, 18, 22, 4, 18, 77, 41895 }, // ₮
-    { 21, 18, 22, 0, 18, 95, 41972 }, // ₱
-    { 18, 25, 21, 1, 22, 113, 42067 }, // ₲
-    { 23, 19, 26, 2, 18, 110, 42180 }, // ₴
-    { 11, 16, 14, 1, 15, 44, 42290 }, // ₵
-    { 19, 19, 24, 4, 19, 91, 42334 }, // ₸
-    { 12, 17, 16, 3, 16, 51, 42425 }, // ₹
-    { 13, 15, 16, 2, 14, 49, 42476 }, // ₺
-    { 16, 16, 18, 1, 16, 64, 42525 }, // ₼
-    { 19, 18, 18, -2, 18, 86, 42589 }, // ₽
-    { 13, 13, 16, -2, 10, 43, 42675 }, // ←
-    { 14, 13, 18, 3, 13, 46, 42718 }, // ↑
-    { 13, 13, 19, 5, 10, 43, 42764 }, // →
-    { 14, 13, 21, 6, 13, 46, 42807 }, // ↓
-    { 22, 11, 22, -1, 10, 61, 42853 }, // ↔
-    { 11, 22, 15, 3, 20, 61, 42914 }, // ↕
-    { 12, 9, 13, -2, 9, 27, 42975 }, // ↖
-    { 13, 9, 17, 3, 9, 30, 43002 }, // ↗
-    { 10, 13, 16, 5, 12, 33, 43032 }, // ↘
-    { 11, 13, 13, -2, 12, 36, 43065 }, // ↙
-    { 16, 13, 18, 0, 12, 52, 43101 }, // ⇐
-    { 17, 15, 21, 3, 15, 64, 43153 }, // ⇑
-    { 16, 13, 19, 2, 12, 52, 43217 }, // ⇒
-    { 17, 16, 25, 7, 15, 68, 43269 }, // ⇓
-    { 21, 13, 22, 0, 12, 69, 43337 }, // ⇔
-    { 13, 20, 19, 5, 13, 65, 43406 }, // ⇕
-    { 15, 17, 18, 2, 17, 64, 43471 }, // ∂
-    { 22, 20, 23, 0, 19, 110, 43535 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 43645 }, // ∆
-    { 15, 15, 19, 3, 15, 57, 43709 }, // ∏
-    { 15, 15, 23, 7, 15, 57, 43766 }, // ∐
-    { 14, 16, 16, 1, 15, 56, 43823 }, // ∑
-    { 11, 3, 14, 2, 7, 9, 43879 }, // −
-    { 21, 18, 24, 2, 17, 95, 43888 }, // √
-    { 19, 11, 22, 2, 13, 53, 43983 }, // ∞
-    { 22, 24, 23, 0, 19, 132, 44036 }, // ∫
-    { 8, 13, 9, 0, 13, 26, 44168 }, // ∶
-    { 15, 11, 20, 4, 11, 42, 44194 }, // ≈
-    { 17, 18, 23, 5, 16, 77, 44236 }, // ≠
-    { 18, 16, 18, -1, 15, 72, 44313 }, // ≤
-    { 18, 16, 20, 1, 15, 72, 44385 }, // ≥
+    { 11, 21, 12, 0, 21, 34, 0 }, // !
+    { 11, 6, 16, 4, 18, 17, 34 }, // "
+    { 24, 19, 27, 2, 17, 67, 51 }, // #
+    { 19, 23, 22, 1, 20, 77, 118 }, // $
+    { 17, 17, 23, 5, 16, 58, 195 }, // %
+    { 17, 19, 21, 3, 18, 57, 253 }, // &
+    { 6, 6, 10, 3, 16, 10, 310 }, // '
+    { 12, 29, 15, 2, 21, 57, 320 }, // (
+    { 12, 29, 9, -5, 21, 56, 377 }, // )
+    { 11, 10, 16, 4, 16, 29, 433 }, // *
+    { 10, 10, 14, 3, 11, 19, 462 }, // +
+    { 7, 6, 8, 0, 3, 10, 481 }, // ,
+    { 10, 3, 14, 3, 8, 5, 491 }, // -
+    { 4, 4, 6, 1, 4, 6, 496 }, // .
+    { 21, 33, 19, -3, 23, 81, 502 }, // /
+    { 14, 16, 17, 2, 16, 54, 583 }, // 0
+    { 11, 16, 13, 1, 16, 27, 637 }, // 1
+    { 15, 16, 17, 1, 16, 39, 664 }, // 2
+    { 15, 16, 17, 1, 16, 40, 703 }, // 3
+    { 11, 16, 15, 3, 16, 37, 743 }, // 4
+    { 14, 16, 16, 1, 16, 39, 780 }, // 5
+    { 14, 16, 17, 2, 16, 44, 819 }, // 6
+    { 11, 16, 17, 5, 16, 28, 863 }, // 7
+    { 15, 16, 17, 1, 16, 50, 891 }, // 8
+    { 14, 16, 17, 2, 16, 45, 941 }, // 9
+    { 8, 13, 9, 0, 13, 16, 986 }, // :
+    { 8, 15, 9, 0, 12, 19, 1002 }, // ;
+    { 16, 12, 17, -1, 13, 31, 1021 }, // <
+    { 11, 7, 14, 2, 9, 17, 1052 }, // =
+    { 16, 12, 18, 1, 13, 31, 1069 }, // >
+    { 14, 23, 18, 3, 23, 48, 1100 }, // ?
+    { 22, 19, 25, 2, 17, 76, 1148 }, // @
+    { 17, 18, 21, 0, 18, 53, 1224 }, // A
+    { 16, 18, 17, 0, 18, 59, 1277 }, // B
+    { 18, 20, 20, 1, 19, 49, 1336 }, // C
+    { 19, 18, 20, 0, 18, 58, 1385 }, // D
+    { 17, 18, 18, 0, 18, 47, 1443 }, // E
+    { 16, 18, 17, 0, 18, 42, 1490 }, // F
+    { 18, 19, 21, 1, 19, 53, 1532 }, // G
+    { 20, 18, 21, 0, 18, 56, 1585 }, // H
+    { 9, 18, 10, 0, 18, 30, 1641 }, // I
+    { 15, 24, 15, -1, 19, 50, 1671 }, // J
+    { 17, 18, 18, 0, 18, 54, 1721 }, // K
+    { 13, 18, 16, 0, 18, 42, 1775 }, // L
+    { 23, 18, 24, 0, 18, 81, 1817 }, // M
+    { 21, 18, 22, 0, 18, 66, 1898 }, // N
+    { 21, 19, 23, 1, 18, 64, 1964 }, // O
+    { 17, 18, 18, 0, 18, 47, 2028 }, // P
+    { 20, 21, 22, 1, 18, 69, 2075 }, // Q
+    { 16, 18, 17, 0, 18, 54, 2144 }, // R
+    { 18, 19, 20, 1, 18, 53, 2198 }, // S
+    { 17, 18, 22, 4, 18, 45, 2251 }, // T
+    { 19, 19, 21, 1, 18, 57, 2296 }, // U
+    { 17, 18, 23, 5, 18, 53, 2353 }, // V
+    { 24, 18, 29, 4, 18, 78, 2406 }, // W
+    { 21, 18, 22, 0, 18, 59, 2484 }, // X
+    { 15, 18, 21, 5, 18, 44, 2543 }, // Y
+    { 21, 18, 22, 0, 18, 50, 2587 }, // Z
+    { 16, 29, 16, -1, 22, 63, 2637 }, // [
+    { 4, 20, 10, 5, 16, 31, 2700 }, // <backslash>
+    { 15, 29, 11, -5, 22, 62, 2731 }, // ]
+    { 9, 5, 14, 4, 19, 11, 2793 }, // ^
+    { 15, 3, 17, 0, -2, 6, 2804 }, // _
+    { 6, 4, 12, 5, 16, 5, 2810 }, // `
+    { 14, 13, 16, 0, 13, 39, 2815 }, // a
+    { 13, 19, 17, 2, 18, 48, 2854 }, // b
+    { 11, 14, 14, 1, 13, 23, 2902 }, // c
+    { 16, 19, 18, 1, 18, 51, 2925 }, // d
+    { 13, 13, 16, 1, 13, 40, 2976 }, // e
+    { 10, 17, 13, 2, 17, 28, 3016 }, // f
+    { 15, 17, 16, 0, 12, 47, 3044 }, // g
+    { 14, 18, 16, 0, 18, 46, 3091 }, // h
+    { 9, 18, 10, 0, 18, 25, 3137 }, // i
+    { 13, 24, 16, 2, 18, 45, 3162 }, // j
+    { 12, 17, 16, 0, 17, 41, 3207 }, // k
+    { 8, 17, 10, 1, 17, 27, 3248 }, // l
+    { 22, 12, 23, 0, 12, 57, 3275 }, // m
+    { 14, 12, 16, 0, 12, 34, 3332 }, // n
+    { 14, 12, 16, 1, 12, 37, 3366 }, // o
+    { 17, 18, 17, -1, 12, 48, 3403 }, // p
+    { 15, 18, 18, 1, 13, 52, 3451 }, // q
+    { 11, 12, 12, 0, 12, 22, 3503 }, // r
+    { 12, 12, 15, 1, 12, 30, 3525 }, // s
+    { 10, 16, 14, 3, 16, 28, 3555 }, // t
+    { 13, 12, 15, 1, 12, 37, 3583 }, // u
+    { 14, 12, 18, 3, 12, 34, 3620 }, // v
+    { 17, 12, 21, 3, 12, 41, 3654 }, // w
+    { 16, 12, 17, 0, 12, 36, 3695 }, // x
+    { 16, 18, 17, 0, 12, 47, 3731 }, // y
+    { 15, 12, 16, 0, 12, 30, 3778 }, // z
+    { 13, 20, 16, 2, 16, 39, 3808 }, // {
+    { 8, 18, 9, 0, 15, 27, 3847 }, // |
+    { 12, 20, 13, 0, 16, 38, 3874 }, // }
+    { 9, 5, 14, 4, 16, 14, 3912 }, // ~
+    { 0, 0, 18, 0, 0, 0, 3926 }, //  
+    { 8, 22, 11, 2, 16, 32, 3926 }, // ¡
+    { 11, 19, 14, 1, 16, 42, 3958 }, // ¢
+    { 17, 20, 18, 0, 20, 44, 4000 }, // £
+    { 13, 11, 16, 2, 13, 29, 4044 }, // ¤
+    { 16, 18, 20, 3, 16, 49, 4073 }, // ¥
+    { 8, 18, 9, 0, 15, 24, 4122 }, // ¦
+    { 16, 18, 18, 1, 16, 50, 4146 }, // §
+    { 10, 4, 15, 4, 16, 13, 4196 }, // ¨
+    { 10, 8, 16, 5, 19, 24, 4209 }, // ©
+    { 8, 8, 12, 3, 16, 20, 4233 }, // ª
+    { 14, 10, 17, 2, 10, 31, 4253 }, // «
+    { 10, 6, 14, 3, 7, 13, 4284 }, // ¬
+    { 10, 3, 14, 3, 8, 5, 4297 }, // ­
+    { 10, 8, 16, 5, 22, 27, 4302 }, // ®
+    { 8, 3, 14, 5, 15, 3, 4329 }, // ¯
+    { 11, 10, 15, 3, 17, 26, 4332 }, // °
+    { 13, 13, 15, 0, 12, 25, 4358 }, // ±
+    { 7, 8, 10, 2, 17, 15, 4383 }, // ²
+    { 8, 8, 11, 2, 17, 14, 4398 }, // ³
+    { 6, 5, 11, 4, 17, 7, 4412 }, // ´
+    { 15, 14, 15, -1, 12, 42, 4419 }, // µ
+    { 14, 17, 16, 1, 15, 52, 4461 }, // ¶
+    { 5, 4, 8, 2, 9, 6, 4513 }, // ·
+    { 6, 6, 7, 0, 1, 9, 4519 }, // ¸
+    { 6, 9, 9, 2, 18, 13, 4528 }, // ¹
+    { 8, 7, 12, 3, 15, 17, 4541 }, // º
+    { 15, 10, 13, -3, 10, 31, 4558 }, // »
+    { 17, 20, 23, 5, 19, 70, 4589 }, // ¼
+    { 18, 20, 24, 5, 18, 64, 4659 }, // ½
+    { 18, 19, 23, 4, 18, 73, 4723 }, // ¾
+    { 14, 23, 13, -2, 12, 48, 4796 }, // ¿
+    { 17, 24, 21, 0, 24, 64, 4844 }, // À
+    { 19, 27, 21, 0, 27, 69, 4908 }, // Á
+    { 19, 23, 21, 0, 23, 67, 4977 }, // Â
+    { 19, 24, 21, 0, 24, 74, 5044 }, // Ã
+    { 20, 24, 21, 0, 24, 73, 5118 }, // Ä
+    { 18, 25, 21, 0, 25, 67, 5191 }, // Å
+    { 28, 19, 30, 0, 18, 76, 5258 }, // Æ
+    { 18, 24, 20, 1, 19, 58, 5334 }, // Ç
+    { 17, 23, 18, 0, 23, 57, 5392 }, // È
+    { 17, 27, 18, 0, 27, 61, 5449 }, // É
+    { 17, 23, 18, 0, 23, 59, 5510 }, // Ê
+    { 18, 24, 19, 0, 24, 64, 5569 }, // Ë
+    { 11, 25, 12, 0, 25, 40, 5633 }, // Ì
+    { 13, 29, 14, 0, 29, 51, 5673 }, // Í
+    { 13, 25, 14, 0, 25, 50, 5724 }, // Î
+    { 14, 25, 15, 0, 25, 54, 5774 }, // Ï
+    { 19, 18, 20, 0, 18, 59, 5828 }, // Ð
+    { 21, 23, 22, 0, 23, 81, 5887 }, // Ñ
+    { 21, 25, 23, 1, 24, 76, 5968 }, // Ò
+    { 21, 29, 23, 1, 28, 81, 6044 }, // Ó
+    { 21, 24, 23, 1, 23, 77, 6125 }, // Ô
+    { 21, 25, 23, 1, 24, 79, 6202 }, // Õ
+    { 21, 25, 23, 1, 24, 80, 6281 }, // Ö
+    { 10, 6, 13, 2, 8, 17, 6361 }, // ×
+    { 37, 34, 30, -8, 26, 141, 6378 }, // Ø
+    { 19, 25, 21, 1, 24, 69, 6519 }, // Ù
+    { 19, 28, 21, 1, 27, 69, 6588 }, // Ú
+    { 19, 25, 21, 1, 24, 72, 6657 }, // Û
+    { 19, 25, 21, 1, 24, 75, 6729 }, // Ü
+    { 15, 28, 21, 5, 28, 58, 6804 }, // Ý
+    { 13, 17, 15, 1, 17, 42, 6862 }, // Þ
+    { 15, 17, 17, 1, 17, 52, 6904 }, // ß
+    { 14, 17, 16, 0, 17, 47, 6956 }, // à
+    { 14, 21, 16, 0, 21, 51, 7003 }, // á
+    { 15, 17, 16, 0, 17, 51, 7054 }, // â
+    { 14, 17, 16, 0, 17, 54, 7105 }, // ã
+    { 15, 17, 16, 0, 17, 53, 7159 }, // ä
+    { 14, 18, 16, 0, 18, 51, 7212 }, // å
+    { 23, 13, 26, 0, 13, 62, 7263 }, // æ
+    { 11, 18, 14, 1, 13, 31, 7325 }, // ç
+    { 13, 19, 16, 1, 19, 48, 7356 }, // è
+    { 14, 23, 16, 1, 23, 54, 7404 }, // é
+    { 14, 19, 16, 1, 19, 53, 7458 }, // ê
+    { 15, 20, 17, 1, 20, 56, 7511 }, // ë
+    { 9, 18, 10, 0, 18, 26, 7567 }, // ì
+    { 11, 21, 12, 0, 21, 31, 7593 }, // í
+    { 11, 17, 12, 0, 17, 28, 7624 }, // î
+    { 11, 18, 12, 0, 18, 34, 7652 }, // ï
+    { 18, 17, 21, 2, 17, 50, 7686 }, // ð
+    { 16, 18, 17, 0, 18, 50, 7736 }, // ñ
+    { 14, 19, 16, 1, 19, 47, 7786 }, // ò
+    { 14, 23, 16, 1, 23, 51, 7833 }, // ó
+    { 14, 19, 16, 1, 19, 51, 7884 }, // ô
+    { 14, 19, 16, 1, 19, 51, 7935 }, // õ
+    { 15, 19, 17, 1, 19, 53, 7986 }, // ö
+    { 14, 13, 18, 3, 13, 27, 8039 }, // ÷
+    { 21, 33, 19, -3, 22, 102, 8066 }, // ø
+    { 13, 18, 15, 1, 18, 45, 8168 }, // ù
+    { 13, 22, 15, 1, 22, 49, 8213 }, // ú
+    { 13, 17, 15, 1, 17, 48, 8262 }, // û
+    { 14, 18, 16, 1, 18, 50, 8310 }, // ü
+    { 16, 29, 17, 0, 23, 62, 8360 }, // ý
+    { 13, 21, 14, 0, 17, 52, 8422 }, // þ
+    { 16, 26, 17, 0, 20, 63, 8474 }, // ÿ
+    { 20, 23, 21, 0, 23, 68, 8537 }, // Ā
+    { 15, 16, 16, 0, 16, 47, 8605 }, // ā
+    { 20, 26, 21, 0, 26, 73, 8652 }, // Ă
+    { 15, 19, 16, 0, 19, 52, 8725 }, // ă
+    { 17, 23, 21, 0, 18, 64, 8777 }, // Ą
+    { 14, 17, 16, 0, 13, 46, 8841 }, // ą
+    { 18, 29, 20, 1, 28, 62, 8887 }, // Ć
+    { 13, 21, 15, 1, 20, 38, 8949 }, // ć
+    { 18, 27, 20, 1, 26, 65, 8987 }, // Ĉ
+    { 14, 19, 16, 1, 18, 40, 9052 }, // ĉ
+    { 18, 27, 20, 1, 26, 62, 9092 }, // Ċ
+    { 11, 20, 14, 1, 19, 32, 9154 }, // ċ
+    { 18, 28, 20, 1, 27, 66, 9186 }, // Č
+    { 13, 21, 15, 1, 20, 41, 9252 }, // č
+    { 19, 26, 20, 0, 26, 75, 9293 }, // Ď
+    { 20, 19, 22, 1, 18, 64, 9368 }, // ď
+    { 19, 18, 20, 0, 18, 59, 9432 }, // Đ
+    { 19, 19, 21, 1, 18, 56, 9491 }, // đ
+    { 18, 23, 19, 0, 23, 59, 9547 }, // Ē
+    { 15, 19, 17, 1, 19, 51, 9606 }, // ē
+    { 18, 26, 19, 0, 26, 66, 9657 }, // Ĕ
+    { 15, 22, 17, 1, 22, 54, 9723 }, // ĕ
+    { 17, 25, 18, 0, 25, 58, 9777 }, // Ė
+    { 13, 21, 16, 1, 21, 52, 9835 }, // ė
+    { 17, 23, 18, 0, 18, 57, 9887 }, // Ę
+    { 13, 19, 16, 1, 13, 52, 9944 }, // ę
+    { 17, 25, 18, 0, 25, 61, 9996 }, // Ě
+    { 14, 22, 16, 1, 22, 56, 10057 }, // ě
+    { 19, 24, 21, 1, 24, 66, 10113 }, // Ĝ
+    { 16, 23, 17, 0, 18, 61, 10179 }, // ĝ
+    { 19, 26, 21, 1, 26, 68, 10240 }, // Ğ
+    { 15, 25, 16, 0, 20, 62, 10308 }, // ğ
+    { 18, 25, 21, 1, 25, 64, 10370 }, // Ġ
+    { 15, 24, 16, 0, 19, 57, 10434 }, // ġ
+    { 18, 28, 21, 1, 19, 69, 10491 }, // Ģ
+    { 15, 25, 16, 0, 20, 61, 10560 }, // ģ
+    { 20, 24, 21, 0, 24, 68, 10621 }, // Ĥ
+    { 14, 23, 16, 0, 23, 57, 10689 }, // ĥ
+    { 20, 18, 21, 0, 18, 57, 10746 }, // Ħ
+    { 14, 18, 16, 0, 18, 49, 10803 }, // ħ
+    { 13, 26, 14, 0, 26, 54, 10852 }, // Ĩ
+    { 11, 18, 12, 0, 18, 36, 10906 }, // ĩ
+    { 14, 24, 15, 0, 24, 49, 10942 }, // Ī
+    { 11, 17, 12, 0, 17, 30, 10991 }, // ī
+    { 10, 23, 13, 2, 18, 35, 11021 }, // Į
+    { 10, 24, 10, -1, 19, 33, 11056 }, // į
+    { 11, 26, 12, 0, 26, 39, 11089 }, // İ
+    { 7, 12, 8, 0, 12, 19, 11128 }, // ı
+    { 17, 23, 19, 0, 18, 71, 11147 }, // Ĳ
+    { 20, 24, 21, 0, 18, 68, 11218 }, // ĳ
+    { 18, 29, 18, -1, 24, 65, 11286 }, // Ĵ
+    { 17, 24, 20, 2, 18, 49, 11351 }, // ĵ
+    { 17, 25, 18, 0, 18, 68, 11400 }, // Ķ
+    { 12, 26, 16, 0, 17, 53, 11468 }, // ķ
+    { 10, 12, 12, 0, 12, 29, 11521 }, // ĸ
+    { 13, 25, 16, 0, 25, 53, 11550 }, // Ĺ
+    { 12, 25, 14, 1, 25, 44, 11603 }, // ĺ
+    { 13, 27, 16, 0, 18, 55, 11647 }, // Ļ
+    { 9, 25, 10, 0, 17, 37, 11702 }, // ļ
+    { 15, 18, 16, 0, 18, 47, 11739 }, // Ľ
+    { 13, 18, 15, 1, 18, 39, 11786 }, // ľ
+    { 15, 18, 16, 0, 18, 46, 11825 }, // Ŀ
+    { 11, 17, 13, 1, 17, 34, 11871 }, // ŀ
+    { 29, 27, 20, -10, 22, 98, 11905 }, // Ł
+    { 20, 17, 14, -7, 17, 50, 12003 }, // ł
+    { 21, 25, 22, 0, 25, 80, 12053 }, // Ń
+    { 15, 20, 16, 0, 20, 46, 12133 }, // ń
+    { 21, 25, 22, 0, 18, 81, 12179 }, // Ņ
+    { 14, 19, 16, 0, 12, 47, 12260 }, // ņ
+    { 21, 25, 22, 0, 25, 83, 12307 }, // Ň
+    { 15, 20, 16, 0, 20, 48, 12390 }, // ň
+    { 14, 22, 14, -2, 22, 53, 12438 }, // ŉ
+    { 21, 23, 22, 0, 18, 79, 12491 }, // Ŋ
+    { 14, 16, 16, 0, 12, 42, 12570 }, // ŋ
+    { 21, 24, 23, 1, 23, 75, 12612 }, // Ō
+    { 15, 18, 17, 1, 18, 47, 12687 }, // ō
+    { 21, 27, 23, 1, 26, 81, 12734 }, // Ŏ
+    { 15, 22, 17, 1, 22, 53, 12815 }, // ŏ
+    { 21, 26, 23, 1, 25, 81, 12868 }, // Ő
+    { 17, 20, 19, 1, 20, 55, 12949 }, // ő
+    { 28, 19, 30, 1, 19, 80, 13004 }, // Œ
+    { 22, 13, 24, 1, 13, 57, 13084 }, // œ
+    { 16, 25, 17, 0, 25, 65, 13141 }, // Ŕ
+    { 11, 18, 12, 0, 18, 30, 13206 }, // ŕ
+    { 16, 28, 17, 0, 18, 70, 13236 }, // Ŗ
+    { 12, 23, 12, -1, 12, 36, 13306 }, // ŗ
+    { 16, 25, 17, 0, 25, 68, 13342 }, // Ř
+    { 12, 18, 13, 0, 18, 36, 13410 }, // ř
+    { 18, 28, 20, 1, 27, 66, 13446 }, // Ś
+    { 12, 20, 15, 1, 20, 40, 13512 }, // ś
+    { 19, 26, 21, 1, 25, 68, 13552 }, // Ŝ
+    { 13, 18, 15, 1, 18, 42, 13620 }, // ŝ
+    { 18, 23, 20, 1, 18, 63, 13662 }, // Ş
+    { 12, 18, 15, 1, 12, 40, 13725 }, // ş
+    { 18, 27, 20, 1, 26, 68, 13765 }, // Š
+    { 12, 20, 15, 1, 20, 43, 13833 }, // š
+    { 17, 22, 22, 4, 18, 53, 13876 }, // Ţ
+    { 10, 20, 14, 3, 16, 35, 13929 }, // ţ
+    { 17, 24, 22, 4, 24, 59, 13964 }, // Ť
+    { 12, 18, 16, 3, 18, 40, 14023 }, // ť
+    { 17, 18, 22, 4, 18, 46, 14063 }, // Ŧ
+    { 12, 16, 14, 1, 16, 33, 14109 }, // ŧ
+    { 19, 26, 21, 1, 25, 76, 14142 }, // Ũ
+    { 13, 19, 15, 1, 19, 51, 14218 }, // ũ
+    { 19, 24, 21, 1, 23, 68, 14269 }, // Ū
+    { 14, 17, 16, 1, 17, 46, 14337 }, // ū
+    { 19, 28, 21, 1, 27, 72, 14383 }, // Ŭ
+    { 14, 20, 16, 1, 20, 50, 14455 }, // ŭ
+    { 19, 27, 21, 1, 26, 73, 14505 }, // Ů
+    { 13, 20, 15, 1, 20, 52, 14578 }, // ů
+    { 20, 26, 22, 1, 25, 76, 14630 }, // Ű
+    { 16, 19, 18, 1, 19, 51, 14706 }, // ű
+    { 19, 23, 21, 1, 18, 66, 14757 }, // Ų
+    { 13, 17, 15, 1, 12, 47, 14823 }, // ų
+    { 24, 23, 29, 4, 23, 92, 14870 }, // Ŵ
+    { 17, 18, 21, 3, 18, 55, 14962 }, // ŵ
+    { 15, 24, 21, 5, 24, 57, 15017 }, // Ŷ
+    { 16, 25, 17, 0, 19, 63, 15074 }, // ŷ
+    { 15, 25, 21, 5, 25, 60, 15137 }, // Ÿ
+    { 21, 25, 22, 0, 25, 63, 15197 }, // Ź
+    { 15, 20, 16, 0, 20, 42, 15260 }, // ź
+    { 21, 24, 22, 0, 24, 63, 15302 }, // Ż
+    { 15, 19, 16, 0, 19, 40, 15365 }, // ż
+    { 21, 25, 22, 0, 25, 66, 15405 }, // Ž
+    { 15, 20, 16, 0, 20, 44, 15471 }, // ž
+    { 11, 17, 15, 3, 17, 29, 15515 }, // ſ
+    { 25, 21, 27, 1, 20, 79, 15544 }, // Ơ
+    { 16, 13, 18, 1, 13, 41, 15623 }, // ơ
+    { 17, 18, 18, 0, 18, 53, 15664 }, // Ƥ
+    { 17, 22, 17, -1, 16, 56, 15717 }, // ƥ
+    { 14, 16, 16, 1, 15, 38, 15773 }, // Ʃ
+    { 17, 18, 22, 4, 18, 48, 15811 }, // Ƭ
+    { 11, 19, 15, 3, 19, 34, 15859 }, // ƭ
+    { 17, 22, 22, 4, 18, 55, 15893 }, // Ʈ
+    { 22, 20, 24, 1, 19, 62, 15948 }, // Ư
+    { 16, 14, 18, 1, 14, 40, 16010 }, // ư
+    { 6, 4, 12, 5, 16, 5, 16050 }, // ̀
+    { 6, 5, 11, 4, 17, 7, 16055 }, // ́
+    { 10, 5, 10, -1, 1, 10, 16062 }, // ̂
+    { 9, 5, 14, 4, 16, 14, 16072 }, // ̃
+    { 10, 3, 15, 4, 14, 8, 16086 }, // ̄
+    { 14, 3, 21, 6, 18, 8, 16094 }, // ̅
+    { 10, 5, 15, 4, 16, 12, 16102 }, // ̆
+    { 5, 4, 10, 4, 16, 7, 16114 }, // ̇
+    { 10, 4, 15, 4, 16, 13, 16121 }, // ̈
+    { 6, 4, 10, 3, 13, 7, 16134 }, // ̉
+    { 6, 5, 11, 4, 16, 10, 16141 }, // ̊
+    { 15, 4, 20, 4, 16, 12, 16151 }, // ̋
+    { 9, 5, 14, 4, 16, 11, 16163 }, // ̌
+    { 15, 4, 9, -7, 17, 10, 16174 }, // ̏
+    { 7, 6, 11, 3, 16, 9, 16184 }, // ̒
+    { 7, 6, 11, 3, 15, 10, 16193 }, // ̓
+    { 8, 6, 5, -4, 15, 11, 16203 }, // ̔
+    { 5, 5, 6, 0, -1, 7, 16214 }, // ̘
+    { 5, 5, 7, 1, -1, 8, 16221 }, // ̙
+    { 9, 5, 15, 5, 17, 12, 16229 }, // ̚
+    { 4, 5, 9, 4, 14, 7, 16241 }, // ̛
+    { 4, 5, 5, 0, -1, 6, 16248 }, // ̜
+    { 5, 4, 8, 2, 3, 7, 16254 }, // ̝
+    { 5, 4, 6, 0, -1, 7, 16261 }, // ̞
+    { 5, 5, 6, 0, -2, 6, 16268 }, // ̟
+    { 10, 3, 11, 0, -3, 8, 16274 }, // ̠
+    { 5, 4, 6, 0, 1, 7, 16282 }, // ̣
+    { 11, 4, 11, -1, 0, 13, 16289 }, // ̤
+    { 6, 5, 11, 4, 16, 10, 16302 }, // ̥
+    { 7, 6, 8, 0, 3, 10, 16312 }, // ̦
+    { 6, 6, 7, 0, 1, 9, 16322 }, // ̧
+    { 6, 6, 7, 0, 1, 9, 16331 }, // ̨
+    { 5, 6, 5, -1, -1, 9, 16340 }, // ̩
+    { 8, 4, 9, 0, -1, 9, 16349 }, // ̪
+    { 9, 5, 10, 0, 0, 11, 16358 }, // ̬
+    { 9, 5, 9, -1, -1, 11, 16369 }, // ̭
+    { 9, 5, 14, 4, 16, 14, 16380 }, // ̰
+    { 8, 3, 14, 5, 15, 3, 16394 }, // ̱
+    { 9, 3, 10, 0, -1, 7, 16397 }, // ̲
+    { 9, 5, 14, 4, 16, 14, 16404 }, // ̴
+    { 10, 3, 14, 3, 8, 5, 16418 }, // ̵
+    { 3, 5, 6, 2, -1, 5, 16423 }, // ̹
+    { 7, 4, 7, -1, -1, 8, 16428 }, // ̺
+    { 8, 5, 9, 0, 0, 12, 16436 }, // ̻
+    { 8, 4, 9, 0, 0, 14, 16448 }, // ̼
+    { 6, 5, 11, 4, 16, 8, 16462 }, // ̽
+    { 9, 5, 14, 4, 16, 14, 16470 }, // ͂
+    { 4, 4, 9, 4, 17, 7, 16484 }, // ̓
+    { 10, 10, 15, 4, 22, 20, 16491 }, // ̈́
+    { 7, 4, 13, 5, 16, 8, 16511 }, // ͆
+    { 12, 8, 12, -1, 0, 17, 16519 }, // ͇
+    { 9, 6, 10, 0, 0, 19, 16536 }, // ͈
+    { 7, 6, 8, 0, -1, 9, 16555 }, // ͉
+    { 10, 13, 15, 4, 20, 24, 16564 }, // ͊
+    { 20, 10, 28, 7, 19, 35, 16588 }, // ͋
+    { 15, 11, 20, 4, 11, 31, 16623 }, // ͌
+    { 11, 7, 13, 1, 0, 10, 16654 }, // ͍
+    { 3, 3, 7, 3, 2, 4, 16664 }, // ͎
+    { 17, 4, 19, 1, 0, 15, 16668 }, // ͜
+    { 18, 4, 23, 4, 16, 13, 16683 }, // ͡
+    { 21, 5, 22, 0, -1, 19, 16696 }, // ͢
+    { 17, 18, 21, 0, 18, 53, 16715 }, // Α
+    { 16, 18, 17, 0, 18, 59, 16768 }, // Β
+    { 14, 17, 16, 1, 16, 34, 16827 }, // Γ
+    { 16, 16, 18, 1, 16, 45, 16861 }, // Δ
+    { 17, 18, 18, 0, 18, 47, 16906 }, // Ε
+    { 21, 18, 22, 0, 18, 50, 16953 }, // Ζ
+    { 20, 18, 21, 0, 18, 56, 17003 }, // Η
+    { 21, 19, 23, 1, 18, 68, 17059 }, // Θ
+    { 9, 18, 10, 0, 18, 30, 17127 }, // Ι
+    { 17, 18, 18, 0, 18, 54, 17157 }, // Κ
+    { 17, 18, 21, 1, 18, 52, 17211 }, // Λ
+    { 23, 18, 24, 0, 18, 81, 17263 }, // Μ
+    { 21, 18, 22, 0, 18, 66, 17344 }, // Ν
+    { 17, 15, 19, 1, 15, 30, 17410 }, // Ξ
+    { 21, 19, 23, 1, 18, 64, 17440 }, // Ο
+    { 15, 15, 17, 1, 15, 48, 17504 }, // Π
+    { 17, 18, 18, 0, 18, 47, 17552 }, // Ρ
+    { 14, 16, 16, 1, 15, 38, 17599 }, // Σ
+    { 17, 18, 22, 4, 18, 45, 17637 }, // Τ
+    { 15, 18, 21, 5, 18, 44, 17682 }, // Υ
+    { 25, 22, 28, 2, 20, 83, 17726 }, // Φ
+    { 21, 18, 22, 0, 18, 59, 17809 }, // Χ
+    { 17, 18, 21, 3, 16, 59, 17868 }, // Ψ
+    { 19, 17, 20, 0, 16, 55, 17927 }, // Ω
+    { 17, 14, 20, 0, 13, 45, 17982 }, // α
+    { 15, 24, 16, 0, 20, 64, 18027 }, // β
+    { 11, 18, 16, 4, 12, 41, 18091 }, // γ
+    { 14, 18, 17, 2, 18, 46, 18132 }, // δ
+    { 10, 11, 12, 1, 11, 27, 18178 }, // ε
+    { 13, 18, 16, 2, 15, 39, 18205 }, // ζ
+    { 14, 20, 17, 2, 14, 52, 18244 }, // η
+    { 14, 16, 17, 2, 16, 49, 18296 }, // θ
+    { 7, 14, 11, 0, 14, 22, 18345 }, // ι
+    { 12, 13, 13, 0, 13, 32, 18367 }, // κ
+    { 16, 17, 16, -7, 17, 45, 18399 }, // λ
+    { 15, 14, 15, -1, 12, 42, 18444 }, // μ
+    { 11, 12, 16, 4, 12, 31, 18486 }, // ν
+    { 12, 18, 15, 2, 15, 40, 18517 }, // ξ
+    { 14, 12, 16, 1, 12, 37, 18557 }, // ο
+    { 14, 12, 18, 3, 11, 39, 18594 }, // π
+    { 16, 17, 17, 0, 12, 46, 18633 }, // ρ
+    { 11, 14, 15, 3, 15, 26, 18679 }, // ς
+    { 19, 12, 21, 1, 12, 42, 18705 }, // σ
+    { 11, 12, 16, 4, 11, 24, 18747 }, // τ
+    { 11, 13, 14, 2, 12, 34, 18771 }, // υ
+    { 20, 26, 22, 1, 23, 90, 18805 }, // φ
+    { 18, 16, 19, 0, 12, 45, 18895 }, // χ
+    { 12, 20, 15, 2, 15, 61, 18940 }, // ψ
+    { 15, 12, 18, 2, 11, 40, 19001 }, // ω
+    { 17, 25, 21, 0, 18, 66, 19041 }, // Ạ
+    { 14, 19, 16, 0, 13, 48, 19107 }, // ạ
+    { 19, 26, 21, 0, 26, 70, 19155 }, // Ả
+    { 14, 19, 16, 0, 19, 52, 19225 }, // ả
+    { 22, 29, 23, 0, 29, 86, 19277 }, // Ấ
+    { 22, 24, 23, 0, 24, 73, 19363 }, // ấ
+    { 19, 27, 21, 0, 27, 77, 19436 }, // Ầ
+    { 15, 20, 16, 0, 20, 55, 19513 }, // ầ
+    { 22, 29, 23, 0, 29, 87, 19568 }, // Ẩ
+    { 15, 21, 16, 0, 21, 59, 19655 }, // ẩ
+    { 18, 29, 21, 0, 29, 84, 19714 }, // Ẫ
+    { 14, 22, 16, 0, 22, 63, 19798 }, // ẫ
+    { 19, 30, 21, 0, 23, 80, 19861 }, // Ậ
+    { 14, 22, 16, 0, 16, 58, 19941 }, // ậ
+    { 20, 34, 21, 0, 34, 88, 19999 }, // Ắ
+    { 15, 27, 16, 0, 27, 64, 20087 }, // ắ
+    { 20, 31, 21, 0, 31, 84, 20151 }, // Ằ
+    { 15, 24, 16, 0, 24, 60, 20235 }, // ằ
+    { 20, 33, 21, 0, 33, 89, 20295 }, // Ẳ
+    { 15, 28, 16, 0, 28, 69, 20384 }, // ẳ
+    { 20, 32, 21, 0, 32, 93, 20453 }, // Ẵ
+    { 15, 25, 16, 0, 25, 67, 20546 }, // ẵ
+    { 20, 33, 21, 0, 26, 87, 20613 }, // Ặ
+    { 15, 25, 16, 0, 19, 61, 20700 }, // ặ
+    { 17, 23, 18, 0, 18, 56, 20761 }, // Ẹ
+    { 13, 19, 16, 1, 13, 49, 20817 }, // ẹ
+    { 17, 25, 18, 0, 25, 59, 20866 }, // Ẻ
+    { 14, 21, 16, 1, 21, 52, 20925 }, // ẻ
+    { 17, 25, 18, 0, 25, 64, 20977 }, // Ẽ
+    { 14, 20, 16, 1, 20, 55, 21041 }, // ẽ
+    { 17, 28, 18, 0, 28, 68, 21096 }, // Ế
+    { 21, 21, 23, 1, 21, 69, 21164 }, // ế
+    { 17, 26, 18, 0, 26, 66, 21233 }, // Ề
+    { 14, 22, 16, 1, 22, 60, 21299 }, // ề
+    { 17, 28, 18, 0, 28, 70, 21359 }, // Ể
+    { 15, 24, 17, 1, 24, 61, 21429 }, // ể
+    { 17, 29, 18, 0, 29, 75, 21490 }, // Ễ
+    { 13, 25, 16, 1, 25, 66, 21565 }, // ễ
+    { 17, 28, 18, 0, 23, 68, 21631 }, // Ệ
+    { 15, 26, 17, 1, 20, 65, 21699 }, // ệ
+    { 12, 27, 13, 0, 27, 45, 21764 }, // Ỉ
+    { 10, 19, 11, 0, 19, 28, 21809 }, // ỉ
+    { 10, 23, 10, -1, 18, 36, 21837 }, // Ị
+    { 10, 23, 10, -1, 18, 32, 21873 }, // ị
+    { 21, 24, 23, 1, 18, 75, 21905 }, // Ọ
+    { 14, 19, 16, 1, 12, 48, 21980 }, // ọ
+    { 21, 26, 23, 1, 25, 78, 22028 }, // Ỏ
+    { 14, 21, 16, 1, 21, 50, 22106 }, // ỏ
+    { 25, 24, 27, 1, 23, 87, 22156 }, // Ố
+    { 21, 20, 23, 1, 20, 65, 22243 }, // ố
+    { 21, 29, 23, 1, 28, 88, 22308 }, // Ồ
+    { 14, 22, 16, 1, 22, 57, 22396 }, // ồ
+    { 25, 28, 27, 1, 27, 95, 22453 }, // Ổ
+    { 15, 24, 17, 1, 24, 60, 22548 }, // ổ
+    { 21, 30, 23, 1, 29, 93, 22608 }, // Ỗ
+    { 14, 24, 16, 1, 24, 66, 22701 }, // ỗ
+    { 21, 29, 23, 1, 23, 88, 22767 }, // Ộ
+    { 14, 25, 16, 1, 19, 61, 22855 }, // ộ
+    { 25, 28, 27, 1, 27, 94, 22916 }, // Ớ
+    { 16, 22, 18, 1, 22, 54, 23010 }, // ớ
+    { 25, 26, 27, 1, 25, 91, 23064 }, // Ờ
+    { 16, 20, 18, 1, 20, 53, 23155 }, // ờ
+    { 25, 27, 27, 1, 26, 94, 23208 }, // Ở
+    { 16, 21, 18, 1, 21, 54, 23302 }, // ở
+    { 25, 26, 27, 1, 25, 100, 23356 }, // Ỡ
+    { 16, 20, 18, 1, 20, 59, 23456 }, // ỡ
+    { 25, 26, 27, 1, 20, 90, 23515 }, // Ợ
+    { 16, 20, 18, 1, 13, 53, 23605 }, // ợ
+    { 19, 24, 21, 1, 18, 66, 23658 }, // Ụ
+    { 13, 18, 15, 1, 12, 46, 23724 }, // ụ
+    { 19, 27, 21, 1, 26, 72, 23770 }, // Ủ
+    { 13, 19, 15, 1, 19, 47, 23842 }, // ủ
+    { 22, 27, 24, 1, 26, 75, 23889 }, // Ứ
+    { 16, 20, 18, 1, 20, 50, 23964 }, // ứ
+    { 22, 26, 24, 1, 25, 75, 24014 }, // Ừ
+    { 16, 18, 18, 1, 18, 48, 24089 }, // ừ
+    { 22, 27, 24, 1, 26, 78, 24137 }, // Ử
+    { 16, 19, 18, 1, 19, 50, 24215 }, // ử
+    { 22, 26, 24, 1, 25, 81, 24265 }, // Ữ
+    { 16, 19, 18, 1, 19, 54, 24346 }, // ữ
+    { 22, 25, 24, 1, 19, 73, 24400 }, // Ự
+    { 16, 20, 18, 1, 14, 50, 24473 }, // ự
+    { 15, 25, 21, 5, 25, 53, 24523 }, // Ỳ
+    { 16, 25, 17, 0, 19, 57, 24576 }, // ỳ
+    { 17, 27, 21, 3, 18, 60, 24633 }, // Ỵ
+    { 16, 18, 17, 0, 12, 51, 24693 }, // ỵ
+    { 15, 26, 21, 5, 26, 56, 24744 }, // Ỷ
+    { 16, 27, 17, 0, 21, 61, 24800 }, // ỷ
+    { 15, 25, 21, 5, 25, 62, 24861 }, // Ỹ
+    { 16, 27, 17, 0, 21, 64, 24923 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 24987 }, //  
+    { 0, 0, 28, 0, 0, 0, 24987 }, //  
+    { 0, 0, 17, 0, 0, 0, 24987 }, //  
+    { 0, 0, 28, 0, 0, 0, 24987 }, //  
+    { 0, 0, 14, 0, 0, 0, 24987 }, //  
+    { 0, 0, 12, 0, 0, 0, 24987 }, //  
+    { 0, 0, 10, 0, 0, 0, 24987 }, //  
+    { 0, 0, 14, 0, 0, 0, 24987 }, //  
+    { 0, 0, 5, 0, 0, 0, 24987 }, //  
+    { 0, 0, 11, 0, 0, 0, 24987 }, //  
+    { 0, 0, 10, 0, 0, 0, 24987 }, //  
+    { 0, 0, 7, 0, 0, 0, 24987 }, // ​
+    { 0, 0, 1, 0, 0, 0, 24987 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 24987 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 24987 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 24987 }, // ‏
+    { 10, 3, 14, 3, 8, 5, 24987 }, // ‐
+    { 10, 3, 14, 3, 8, 5, 24992 }, // ‑
+    { 16, 3, 20, 3, 8, 8, 24997 }, // ‒
+    { 14, 3, 18, 3, 8, 6, 25005 }, // –
+    { 21, 3, 25, 3, 8, 9, 25011 }, // —
+    { 21, 3, 25, 3, 8, 9, 25020 }, // ―
+    { 14, 18, 15, 0, 15, 53, 25029 }, // ‖
+    { 17, 8, 18, 0, -1, 17, 25082 }, // ‗
+    { 7, 6, 12, 4, 18, 9, 25099 }, // ‘
+    { 7, 6, 12, 4, 18, 10, 25108 }, // ’
+    { 7, 6, 8, 0, 3, 10, 25118 }, // ‚
+    { 7, 6, 12, 4, 18, 9, 25128 }, // ‛
+    { 12, 6, 17, 4, 18, 18, 25137 }, // “
+    { 12, 6, 17, 4, 18, 19, 25155 }, // ”
+    { 7, 6, 8, 0, 3, 10, 25174 }, // „
+    { 12, 6, 17, 4, 18, 18, 25184 }, // ‟
+    { 12, 27, 16, 3, 21, 55, 25202 }, // †
+    { 14, 27, 16, 1, 21, 60, 25257 }, // ‡
+    { 14, 12, 15, 0, 14, 30, 25317 }, // •
+    { 7, 7, 10, 2, 9, 10, 25347 }, // ‣
+    { 4, 4, 6, 1, 4, 6, 25357 }, // ․
+    { 4, 4, 6, 1, 4, 6, 25363 }, // ‥
+    { 19, 4, 21, 1, 4, 19, 25369 }, // …
+    { 4, 3, 6, 1, 8, 3, 25388 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 25391 }, //  
+    { 17, 18, 23, 5, 16, 63, 25391 }, // ‰
+    { 7, 6, 12, 4, 18, 10, 25454 }, // ′
+    { 12, 6, 17, 4, 18, 19, 25464 }, // ″
+    { 15, 7, 18, -2, 18, 25, 25483 }, // ‴
+    { 4, 7, 10, 5, 18, 8, 25508 }, // ‵
+    { 9, 7, 14, 4, 18, 17, 25516 }, // ‶
+    { 15, 7, 21, 5, 18, 24, 25533 }, // ‷
+    { 9, 4, 15, 5, 17, 8, 25557 }, // ‸
+    { 7, 10, 11, 3, 11, 16, 25565 }, // ‹
+    { 8, 10, 9, -2, 11, 15, 25581 }, // ›
+    { 27, 21, 29, 1, 19, 85, 25596 }, // ※
+    { 11, 21, 12, 0, 21, 34, 25681 }, // ‼
+    { 14, 26, 19, 4, 25, 62, 25715 }, // ‽
+    { 11, 3, 17, 5, 17, 6, 25777 }, // ‾
+    { 10, 4, 15, 4, 14, 11, 25783 }, // ‿
+    { 15, 14, 19, 3, 19, 49, 25794 }, // ⁂
+    { 17, 17, 23, 5, 16, 35, 25843 }, // ⁄
+    { 25, 24, 31, 5, 24, 93, 25878 }, // ⁇
+    { 18, 23, 24, 5, 23, 73, 25971 }, // ⁈
+    { 21, 25, 22, 0, 23, 78, 26044 }, // ⁉
+    { 21, 33, 21, -1, 23, 92, 26122 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 26214 }, //  
+    { 8, 8, 11, 2, 17, 21, 26214 }, // ⁰
+    { 6, 9, 10, 3, 18, 16, 26235 }, // ⁴
+    { 8, 9, 11, 2, 18, 14, 26251 }, // ⁵
+    { 8, 8, 11, 2, 17, 19, 26265 }, // ⁶
+    { 6, 9, 11, 4, 18, 13, 26284 }, // ⁷
+    { 8, 8, 11, 2, 17, 20, 26297 }, // ⁸
+    { 8, 8, 11, 2, 17, 18, 26317 }, // ⁹
+    { 14, 12, 16, 0, 12, 34, 26335 }, // ⁿ
+    { 10, 11, 12, 1, 11, 33, 26369 }, // ₀
+    { 6, 9, 6, -1, 5, 15, 26402 }, // ₁
+    { 7, 9, 7, -1, 5, 19, 26417 }, // ₂
+    { 7, 9, 7, -1, 5, 15, 26436 }, // ₃
+    { 7, 8, 7, -1, 5, 15, 26451 }, // ₄
+    { 7, 8, 7, -1, 5, 14, 26466 }, // ₅
+    { 7, 8, 7, -1, 4, 17, 26480 }, // ₆
+    { 6, 9, 8, 1, 5, 14, 26497 }, // ₇
+    { 8, 9, 8, -1, 5, 20, 26511 }, // ₈
+    { 8, 9, 8, -1, 5, 20, 26531 }, // ₉
+    { 12, 29, 15, 2, 21, 57, 26551 }, // ₍
+    { 12, 29, 9, -5, 21, 56, 26608 }, // ₎
+    { 20, 28, 21, 0, 23, 98, 26664 }, // ₡
+    { 18, 20, 20, 1, 19, 56, 26762 }, // ₢
+    { 17, 20, 18, 0, 20, 46, 26818 }, // ₤
+    { 21, 18, 22, 0, 18, 67, 26864 }, // ₦
+    { 18, 18, 19, 0, 18, 51, 26931 }, // ₧
+    { 24, 18, 25, 0, 18, 76, 26982 }, // ₨
+    { 18, 18, 18, -1, 18, 69, 27058 }, // ₩
+    { 20, 16, 24, 3, 16, 76, 27127 }, // ₪
+    { 15, 17, 18, 2, 17, 47, 27203 }, // ₫
+    { 16, 19, 19, 2, 16, 48, 27250 }, // €
+    { 17, 18, 22, 4, 18, 54, 27298 }, // ₮
+    { 21, 18, 22, 0, 18, 57, 27352 }, // ₱
+    { 18, 25, 21, 1, 22, 80, 27409 }, // ₲
+    { 23, 19, 26, 2, 18, 58, 27489 }, // ₴
+    { 11, 16, 14, 1, 15, 37, 27547 }, // ₵
+    { 19, 19, 24, 4, 19, 39, 27584 }, // ₸
+    { 12, 17, 16, 3, 16, 40, 27623 }, // ₹
+    { 13, 15, 16, 2, 14, 38, 27663 }, // ₺
+    { 16, 16, 18, 1, 16, 59, 27701 }, // ₼
+    { 19, 18, 18, -2, 18, 50, 27760 }, // ₽
+    { 13, 13, 16, -2, 10, 30, 27810 }, // ←
+    { 14, 13, 18, 3, 13, 33, 27840 }, // ↑
+    { 13, 13, 19, 5, 10, 31, 27873 }, // →
+    { 14, 13, 21, 6, 13, 35, 27904 }, // ↓
+    { 22, 11, 22, -1, 10, 47, 27939 }, // ↔
+    { 11, 22, 15, 3, 20, 50, 27986 }, // ↕
+    { 12, 9, 13, -2, 9, 26, 28036 }, // ↖
+    { 13, 9, 17, 3, 9, 25, 28062 }, // ↗
+    { 10, 13, 16, 5, 12, 31, 28087 }, // ↘
+    { 11, 13, 13, -2, 12, 31, 28118 }, // ↙
+    { 16, 13, 18, 0, 12, 27, 28149 }, // ⇐
+    { 17, 15, 21, 3, 15, 57, 28176 }, // ⇑
+    { 16, 13, 19, 2, 12, 28, 28233 }, // ⇒
+    { 17, 16, 25, 7, 15, 57, 28261 }, // ⇓
+    { 21, 13, 22, 0, 12, 44, 28318 }, // ⇔
+    { 13, 20, 19, 5, 13, 58, 28362 }, // ⇕
+    { 15, 17, 18, 2, 17, 45, 28420 }, // ∂
+    { 22, 20, 23, 0, 19, 80, 28465 }, // ∅
+    { 16, 16, 18, 1, 16, 45, 28545 }, // ∆
+    { 15, 15, 19, 3, 15, 49, 28590 }, // ∏
+    { 15, 15, 23, 7, 15, 48, 28639 }, // ∐
+    { 14, 16, 16, 1, 15, 38, 28687 }, // ∑
+    { 11, 3, 14, 2, 7, 8, 28725 }, // −
+    { 21, 18, 24, 2, 17, 49, 28733 }, // √
+    { 19, 11, 22, 2, 13, 49, 28782 }, // ∞
+    { 22, 24, 23, 0, 19, 62, 28831 }, // ∫
+    { 8, 13, 9, 0, 13, 16, 28893 }, // ∶
+    { 15, 11, 20, 4, 11, 31, 28909 }, // ≈
+    { 17, 18, 23, 5, 16, 45, 28940 }, // ≠
+    { 18, 16, 18, -1, 15, 44, 28985 }, // ≤
+    { 18, 16, 20, 1, 15, 46, 29029 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
@@ -3523,4 +2562,5 @@ static const EpdFontData opendyslexic_10_italic = {
     28,
     -11,
     true,
+    true,
 };
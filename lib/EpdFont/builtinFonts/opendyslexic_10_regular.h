@@ -2,2971 +2,2388 @@
  * generated by fontconvert.py
  * name: opendyslexic_10_regular
  * size: 10
- * mode: 2-bit
- * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit
+ * mode: 2-bit, run-length encoded
+ * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --rle
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_regularBitmaps[36691] = {
-    0x00, 0x40, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x0B,
-    0xC0, 0xBC, 0x0B, 0xC0, 0xBC, 0x0F, 0xC0, 0x04, 0x00, 0x01, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0,
-    0x2F, 0x87, 0xF0, 0xFD, 0x1F, 0xC3, 0xF4, 0x7F, 0x0F, 0xC1, 0xF4, 0x3F, 0x07, 0xE0, 0xFC, 0x2F,
-    0x80, 0x00, 0x03, 0xC0, 0x2C, 0x00, 0x00, 0x00, 0x3C, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x3C,
-    0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0x40,
-    0xB8, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x40, 0x00, 0x00, 0x1F, 0x00, 0xF4, 0x00, 0x00, 0x01, 0xF0,
-    0x0F, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F,
-    0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x00, 0x07,
-    0xD0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x00, 0x02,
-    0xC3, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0x6D, 0x50, 0x02,
-    0xFA, 0xC3, 0x40, 0x00, 0xFC, 0x70, 0xD0, 0x00, 0x3F, 0x1C, 0x34, 0x00, 0x0B, 0xFB, 0x0D, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0xFF, 0xF4, 0x00, 0x07, 0x0F,
-    0xFF, 0x40, 0x01, 0xC3, 0x7F, 0xE0, 0x00, 0x70, 0xEF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x01, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x1C, 0x34, 0x00, 0x00,
-    0x07, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x34, 0x0B,
-    0xE0, 0x0B, 0x02, 0x82, 0x80, 0xD0, 0x30, 0x0C, 0x3C, 0x03, 0x00, 0xC7, 0x00, 0x30, 0x1C, 0xE0,
-    0x02, 0xFF, 0xAC, 0x00, 0x0B, 0xE7, 0x80, 0x00, 0x00, 0xF7, 0xF4, 0x00, 0x1E, 0xC1, 0xC0, 0x03,
-    0xE8, 0x0A, 0x00, 0xB2, 0x40, 0xA0, 0x1E, 0x28, 0x0E, 0x03, 0xC0, 0xFF, 0xC0, 0x78, 0x07, 0xF0,
-    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xAB, 0xF0, 0x00,
-    0x2E, 0x00, 0xB4, 0x00, 0x3D, 0x00, 0xF4, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x0F, 0xCB, 0xD0, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x2F, 0x87, 0xC0, 0x19,
-    0x3F, 0x01, 0xF4, 0x3D, 0x7F, 0x00, 0x3D, 0xBC, 0x7F, 0x00, 0x0F, 0xF8, 0x3F, 0x80, 0x1F, 0xF0,
-    0x2F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFE, 0x18, 0x01, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0x8F, 0xD3, 0xF0, 0xFC, 0x3F, 0x0F, 0xC0, 0x00, 0xA0, 0x07, 0x40, 0x3C, 0x01, 0xD0, 0x0F,
-    0x00, 0x38, 0x02, 0xD0, 0x0F, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
-    0x0F, 0x00, 0x3C, 0x00, 0xB4, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x01, 0xE0,
-    0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0xBC, 0x28, 0x00, 0x74, 0x00, 0xF0, 0x01, 0xD0,
-    0x03, 0xC0, 0x0B, 0x40, 0x0E, 0x00, 0x3C, 0x00, 0xB4, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C,
-    0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x80, 0x2D, 0x00, 0xF0, 0x07, 0xC0,
-    0x2E, 0x00, 0xF4, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x10, 0x00, 0x01, 0xC0, 0x01,
-    0x03, 0x03, 0x0F, 0x8C, 0xB8, 0x07, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0xBB, 0xBE, 0x0F, 0x4D, 0x2C,
-    0x00, 0x34, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x24, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E,
-    0x00, 0x2A, 0xBE, 0xA1, 0xFF, 0xFF, 0xC0, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0xE0, 0x00, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F,
-    0xFF, 0xF0, 0x14, 0x7C, 0xBC, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-    0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0B, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x03, 0xC0,
-    0x00, 0x07, 0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x3D, 0x00, 0x00, 0x34, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x03, 0x82, 0xC0, 0x0E,
-    0x00, 0xB0, 0x2C, 0x00, 0x34, 0x3C, 0x00, 0x38, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C,
-    0x3C, 0x7C, 0x28, 0x3C, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xBC, 0x3F, 0x01, 0xFC, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xF0,
-    0x01, 0x8F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00,
-    0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x07, 0xFF, 0xFD, 0x7F, 0xFF, 0xD7, 0xFF,
-    0xFD, 0x01, 0xA9, 0x00, 0xFF, 0xFF, 0x03, 0x90, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xD0, 0x00, 0x0F, 0x00, 0x00, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBF, 0x00, 0x1F, 0xF0, 0x02,
-    0xFF, 0x00, 0x2F, 0xF0, 0x00, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x0B, 0xFE, 0x00,
-    0xA9, 0x6F, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x03, 0xC0, 0x1A, 0xBC,
-    0x00, 0xFF, 0xD0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x2E, 0x14, 0x02,
-    0xF4, 0xFF, 0xFF, 0xC3, 0xFF, 0xFD, 0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,
-    0x0F, 0x40, 0x00, 0x2F, 0x80, 0x00, 0x7B, 0x80, 0x00, 0xF3, 0x80, 0x03, 0xD3, 0xC0, 0x0B, 0x83,
-    0xC0, 0x1F, 0x03, 0xC0, 0x3E, 0x17, 0xD4, 0x7F, 0xFF, 0xFC, 0x3A, 0xAF, 0xF8, 0x00, 0x07, 0xD0,
-    0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xD0, 0x00, 0x0B, 0xE0, 0x15, 0x55, 0x40, 0xFF, 0xFF, 0x43, 0xC0,
-    0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xEA, 0x40, 0x0F, 0xFF, 0xE0, 0x10,
-    0x02, 0xF0, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x40, 0x00, 0x3D, 0x29, 0x07, 0xF0, 0xFF, 0xFF, 0xC3,
-    0xFF, 0xFC, 0x0B, 0xFE, 0x40, 0x00, 0x1A, 0xA0, 0x01, 0xFF, 0xF0, 0x0B, 0x80, 0x00, 0x0E, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x3C, 0x59, 0x00, 0x3F, 0xFF, 0xD0, 0x7F, 0x81, 0xF0, 0x7E, 0x00, 0x7C,
-    0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x2F, 0x00, 0xBC, 0x0F, 0xFF, 0xF4, 0x07,
-    0xFF, 0xE0, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD1, 0x5A, 0xAF, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF4, 0x00, 0x07, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF4, 0x00, 0x1F,
-    0xC0, 0x01, 0xBF, 0x40, 0x0B, 0x41, 0xF0, 0x0E, 0x00, 0x74, 0x1D, 0x00, 0x38, 0x2D, 0x00, 0x38,
-    0x1E, 0x00, 0xB8, 0x0F, 0x81, 0xF0, 0x03, 0xFF, 0xD0, 0x07, 0xFF, 0xD0, 0x1F, 0x41, 0xF8, 0x3D,
-    0x00, 0x3C, 0x7C, 0x00, 0x3D, 0x3D, 0x00, 0x3D, 0x3F, 0x41, 0xFC, 0x1F, 0xFF, 0xF4, 0x02, 0xFF,
-    0x80, 0x01, 0xFE, 0x40, 0x0F, 0x9B, 0xD0, 0x2D, 0x01, 0xF0, 0x3C, 0x00, 0xF4, 0x38, 0x00, 0xBC,
-    0x78, 0x00, 0x7C, 0x38, 0x00, 0x7C, 0x3C, 0x00, 0x7C, 0x2F, 0x01, 0xFC, 0x0F, 0xFF, 0xFC, 0x02,
-    0xFF, 0xBC, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xB8, 0x0F, 0xAB, 0xF4, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF,
-    0x80, 0x0A, 0x07, 0xD2, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 0xF4, 0xBE,
-    0x3F, 0x80, 0x1A, 0x0F, 0xC3, 0xF1, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE3, 0xF4,
-    0xFC, 0x3F, 0x1F, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0B, 0xF4,
-    0x00, 0x07, 0xFD, 0x00, 0x01, 0xFF, 0x40, 0x00, 0xBF, 0xD0, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F,
-    0xFE, 0x40, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0x00, 0x00,
-    0x00, 0x2C, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
-    0xFE, 0x2A, 0xA5, 0x50, 0x14, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
-    0x2F, 0xE0, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x00, 0x00,
-    0x6F, 0xFC, 0x00, 0xBF, 0xFF, 0x40, 0xBF, 0xFE, 0x40, 0x07, 0xFE, 0x40, 0x00, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x40, 0x2F, 0xFF, 0xE0, 0x3D, 0x02, 0xF4, 0x10, 0x00, 0xBC,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xF4, 0x00,
-    0x03, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xF8, 0x00,
-    0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0xF9, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0xB0, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x07, 0x41,
-    0xFB, 0x01, 0xC0, 0x3C, 0x0C, 0x2C, 0x03, 0x00, 0xF0, 0x50, 0x70, 0x0C, 0x07, 0xC2, 0x41, 0xC0,
-    0x30, 0x2F, 0x0A, 0x0B, 0x02, 0xC0, 0xBC, 0x1F, 0xFD, 0x2D, 0x01, 0xF8, 0x1A, 0x6F, 0xE0, 0x03,
-    0xF0, 0x00, 0x14, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x01, 0x90, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E,
-    0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00,
-    0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00,
-    0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x3F, 0xFA,
-    0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3D, 0x00, 0x7D, 0x03, 0xD0, 0x01, 0xE0, 0x3D, 0x00, 0x0F, 0x03,
-    0xD0, 0x01, 0xE0, 0x3D, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xF8, 0x03, 0xD0, 0x02,
-    0xF4, 0x3D, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x7C, 0x3D, 0x00, 0x07, 0xD3, 0xD0, 0x00, 0xFD, 0x3E,
-    0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x3F, 0xFA, 0x40, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00,
-    0xF4, 0x01, 0xFF, 0x40, 0x3D, 0x00, 0x07, 0xF0, 0x0F, 0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x0F,
-    0xC0, 0xF4, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0xBD, 0x0F, 0x40, 0x00, 0x1F, 0x83, 0xD0, 0x00,
-    0x07, 0xE0, 0xF4, 0x00, 0x02, 0xF8, 0x3D, 0x00, 0x02, 0xFD, 0x0F, 0x95, 0xAB, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF9, 0x00, 0x00,
-    0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00,
-    0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4,
-    0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA,
-    0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x0A, 0xBF, 0xFC, 0x3F, 0xFF,
-    0xE1, 0xF4, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFA, 0xA9, 0x0B, 0xFF,
-    0xFC, 0x2F, 0xFF, 0xE0, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC,
-    0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x90, 0xFC, 0x00, 0x2F, 0xFE,
-    0x3F, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0B, 0x41, 0xFE, 0x00, 0x03, 0xD0, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF, 0xFF, 0x40, 0x02, 0xBF, 0xF9, 0x00, 0x05, 0x00,
-    0x00, 0x50, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00,
-    0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40,
-    0x01, 0xFD, 0x3F, 0x80, 0x01, 0xFD, 0x2A, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF4, 0x00, 0x7D, 0x00,
-    0x1F, 0x40, 0x07, 0xD0, 0x02, 0xF4, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x2F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x3F, 0xFD, 0x0F, 0xFF, 0x03, 0xFF,
-    0x00, 0xA5, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80, 0x03, 0xE0,
-    0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0A, 0x90, 0x00,
-    0x0A, 0x90, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0xFF, 0x40, 0x02, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xF8,
-    0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0xC1, 0xFB, 0xF0, 0x0F, 0xFF, 0x07, 0xCF,
-    0xD0, 0xBD, 0xFC, 0x2F, 0x2F, 0xC3, 0xF3, 0xF0, 0xBC, 0x7F, 0x1F, 0x8F, 0xC2, 0xF0, 0xFE, 0xFD,
-    0x3F, 0x0B, 0xD1, 0xFF, 0xF0, 0xFD, 0x3F, 0x43, 0xFF, 0x83, 0xF4, 0xFD, 0x0B, 0xFC, 0x1F, 0xD3,
-    0xF4, 0x1F, 0xF0, 0x7F, 0x8F, 0xE0, 0x3F, 0x41, 0xFE, 0x3F, 0x80, 0x68, 0x0B, 0xF8, 0xFE, 0x00,
-    0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F,
-    0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F,
-    0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F,
-    0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F,
-    0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80,
-    0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x07,
-    0xFF, 0xFF, 0x01, 0xF0, 0x07, 0xF0, 0x7C, 0x00, 0x3C, 0x2F, 0x00, 0x0F, 0x4B, 0xC0, 0x03, 0xC2,
-    0xF0, 0x07, 0xF0, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x0F, 0xEA, 0x50, 0x03, 0xF0, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
-    0x7F, 0x00, 0xBF, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x3F, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0x0F,
-    0x8B, 0xC0, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,
-    0x07, 0xCF, 0xC0, 0x00, 0x02, 0xF3, 0xF0, 0x00, 0x00, 0xFC, 0xBD, 0x00, 0x60, 0x3E, 0x1F, 0xD0,
-    0x3F, 0xFF, 0x43, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00,
-    0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x02, 0xAA,
-    0x40, 0x0F, 0xFE, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00, 0xBC, 0x00, 0xE0, 0x03, 0xD0, 0x0E,
-    0x00, 0x2E, 0x01, 0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x3E, 0x01, 0xE0, 0x1F, 0xD0, 0x1F, 0xFF, 0xF8,
-    0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF4, 0x0B, 0xD0, 0x2F, 0x40, 0x3E, 0x03, 0xF4,
-    0x02, 0xF0, 0x3F, 0x40, 0x3F, 0x43, 0xF4, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0xC3, 0xF8, 0x03, 0xFC,
-    0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE,
-    0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x50, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B,
-    0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3,
-    0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x29, 0x00, 0x00, 0x06, 0x82, 0xF0, 0x00, 0x00, 0xFC, 0x1F, 0x40, 0x00, 0x1F, 0x40, 0xFC,
-    0x00, 0x03, 0xF0, 0x0B, 0xC0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x0B, 0xD0, 0x03, 0xF0, 0x00, 0xFC,
-    0x00, 0x3F, 0x40, 0x1F, 0xC0, 0x01, 0xF8, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0xFD,
-    0x0B, 0xF0, 0x00, 0x0B, 0xE0, 0xFD, 0x00, 0x00, 0x3F, 0x1F, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-    0x00, 0x2F, 0xFF, 0x40, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xBF,
-    0xE0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x00, 0x00, 0x07, 0xD2, 0xF0, 0x00,
-    0x00, 0x00, 0x2F, 0x07, 0xD0, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x3F,
-    0x00, 0x2F, 0x00, 0x1F, 0x40, 0xBC, 0x00, 0xFD, 0x00, 0xFC, 0x01, 0xF4, 0x0B, 0xFC, 0x03, 0xF0,
-    0x03, 0xE0, 0x3F, 0xF4, 0x1F, 0x80, 0x0F, 0xC2, 0xFF, 0xF0, 0xBD, 0x00, 0x3F, 0x0F, 0xDB, 0xD3,
-    0xF0, 0x00, 0xBD, 0xBF, 0x1F, 0xCF, 0xC0, 0x01, 0xFB, 0xF8, 0x3F, 0xBE, 0x00, 0x03, 0xFF, 0xC0,
-    0xBF, 0xF4, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF4, 0x03, 0xFF, 0x00, 0x00, 0xBF,
-    0xC0, 0x0B, 0xF8, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xD0, 0x00, 0x0A, 0x40, 0x00, 0x1A, 0x01, 0xF0,
-    0x00, 0x0F, 0x40, 0x3E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0, 0x00, 0xBC, 0x03, 0xD0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0x6F,
-    0xC0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xF0,
-    0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F,
-    0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0x40, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x0F, 0xFC, 0x0F, 0xFC,
-    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
-    0x2F, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3D, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x7C, 0x00,
-    0x7F, 0xF4, 0x7F, 0xF0, 0x15, 0x50, 0x10, 0x00, 0x20, 0x00, 0x70, 0x00, 0x34, 0x00, 0x3C, 0x00,
-    0x2C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x0B, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x02, 0xD0, 0x01, 0xE0,
-    0x00, 0xF0, 0x00, 0xF4, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x7F, 0xF0,
-    0x7F, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
-    0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xB8, 0x00, 0xB8,
-    0x00, 0xB8, 0x00, 0xB8, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C,
-    0x00, 0x3C, 0x2F, 0xFC, 0x1F, 0xFC, 0x05, 0x54, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0x40, 0x3C,
-    0x74, 0x38, 0x03, 0x40, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x7C, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B,
-    0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00,
-    0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0xA8, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-    0x19, 0x00, 0x7E, 0xFF, 0xD0, 0x7F, 0xE5, 0xF4, 0x3F, 0x00, 0x3C, 0x3E, 0x00, 0x2D, 0x3E, 0x00,
-    0x1E, 0x3D, 0x00, 0x1E, 0x3E, 0x00, 0x3D, 0x3F, 0x41, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03, 0xE0, 0x00,
-    0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x3F,
-    0xDA, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x02, 0xD0,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x0B, 0xF8, 0xF0,
-    0x0B, 0xFF, 0xBC, 0x0B, 0x81, 0xFF, 0x03, 0xC0, 0x0F, 0xC1, 0xD0, 0x03, 0xF0, 0xB0, 0x00, 0xBC,
-    0x2D, 0x00, 0x3F, 0x0B, 0x80, 0x0F, 0xC1, 0xFD, 0x6F, 0xF0, 0x3F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0x00, 0x2F, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x64,
-    0x1F, 0xE0, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x0F, 0xFF, 0xEF, 0xFF, 0x0F, 0x00, 0x3C, 0x00,
-    0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x02, 0xF8, 0x74, 0x7F,
-    0xFF, 0xE3, 0xD1, 0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7, 0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C,
-    0x00, 0xBD, 0x79, 0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0,
-    0x40, 0x2F, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9, 0x00, 0x2D, 0x00, 0x00, 0xB0, 0x00,
-    0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xCF, 0xF4, 0x0F, 0xFF,
-    0xF8, 0x3F, 0x92, 0xF0, 0xF8, 0x02, 0xD7, 0xC0, 0x07, 0x5F, 0x00, 0x1E, 0x7C, 0x00, 0x7A, 0xF0,
-    0x01, 0xEB, 0xC0, 0x07, 0xAF, 0x00, 0x2F, 0xBC, 0x00, 0xBF, 0xF0, 0x03, 0xF0, 0x7C, 0xBC, 0xFD,
-    0x54, 0x00, 0x00, 0x10, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78, 0x7C, 0x7C, 0xBC, 0xBC, 0x00,
-    0x3D, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x3C, 0x00,
-    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0xB8, 0x01, 0xF4, 0x3F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07,
-    0xC2, 0xD0, 0x1F, 0x2F, 0x00, 0x79, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x2F, 0xF0, 0x00,
-    0xBF, 0xF0, 0x02, 0xE3, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F, 0x0B, 0xF4, 0xFC, 0x0F, 0xF4, 0x0E, 0x00,
-    0x3C, 0x01, 0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03,
-    0xD0, 0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x18, 0x2F, 0x80, 0xBE,
-    0x00, 0xBB, 0xFF, 0xCF, 0xFF, 0x02, 0xFC, 0x0F, 0xF8, 0x2D, 0x0F, 0xC0, 0x1F, 0x80, 0x38, 0x3E,
-    0x00, 0x3D, 0x00, 0xF0, 0xF4, 0x00, 0xF0, 0x03, 0xC3, 0xD0, 0x03, 0xC0, 0x0F, 0x1F, 0x00, 0x1F,
-    0x00, 0x3C, 0x7C, 0x00, 0xB8, 0x01, 0xF2, 0xF0, 0x03, 0xE0, 0x07, 0xCB, 0xC0, 0x0F, 0x40, 0x1F,
-    0x3F, 0x00, 0x3D, 0x00, 0xBC, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C,
-    0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03,
-    0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78,
-    0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x04, 0x1B, 0x90, 0x07, 0xAF, 0xFE,
-    0x01, 0xFF, 0x02, 0xC0, 0x3F, 0x00, 0x38, 0x0F, 0x80, 0x0F, 0x03, 0xD0, 0x02, 0xC0, 0xF8, 0x00,
-    0xB0, 0x3F, 0x00, 0x3C, 0x0F, 0xE0, 0x1F, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF,
-    0x80, 0x3D, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD2, 0x80, 0x0F, 0xEF, 0x7C, 0x03,
-    0xD0, 0x3F, 0xC0, 0x78, 0x00, 0xFC, 0x0B, 0x40, 0x0F, 0xC0, 0xB0, 0x00, 0xFC, 0x0F, 0x00, 0x0F,
-    0x80, 0xB0, 0x01, 0xF8, 0x07, 0xC0, 0x7F, 0x80, 0x3F, 0xFF, 0xF4, 0x00, 0xFF, 0xFB, 0x40, 0x02,
-    0xFD, 0x74, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x04, 0x3D, 0xFD, 0x3F, 0xFD, 0x3F, 0x40, 0x3E, 0x00, 0x3E, 0x00,
-    0x3D, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x7E, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x02, 0xFF, 0x81, 0xFA,
-    0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E,
-    0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x74, 0x00, 0x3C,
-    0x00, 0x0F, 0x00, 0x17, 0xD5, 0x2F, 0xFF, 0xE0, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xF0,
-    0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0xC0, 0x02, 0xFF, 0x80, 0xBF, 0xF4, 0x1F, 0xFE, 0xF0, 0x00,
-    0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80,
-    0x0F, 0x5F, 0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x50,
-    0x00, 0x01, 0x1E, 0x00, 0x03, 0xC3, 0xC0, 0x01, 0xE0, 0xB8, 0x00, 0xF4, 0x0F, 0x00, 0x7C, 0x02,
-    0xE0, 0x3D, 0x00, 0x3D, 0x0F, 0x00, 0x0B, 0xCB, 0x40, 0x01, 0xFB, 0xC0, 0x00, 0x3F, 0xE0, 0x00,
-    0x0B, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x54, 0x00, 0x00, 0x14, 0xBC, 0x00, 0x00, 0x3C, 0x7C, 0x00,
-    0x00, 0x7C, 0x3D, 0x00, 0x00, 0xB8, 0x3E, 0x07, 0xC0, 0xF4, 0x2F, 0x0F, 0xE0, 0xF0, 0x1F, 0x3F,
-    0xF5, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xC0, 0x03, 0xF8,
-    0x3F, 0xC0, 0x03, 0xF0, 0x1F, 0x80, 0x0F, 0x40, 0x3E, 0x01, 0xF0, 0x2F, 0x00, 0x3F, 0x1F, 0x00,
-    0x03, 0xEF, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFF, 0x40,
-    0x03, 0xF3, 0xF0, 0x03, 0xF0, 0x7E, 0x02, 0xF4, 0x0B, 0xD1, 0xF8, 0x00, 0xFC, 0xB4, 0x00, 0x3C,
-    0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03,
-    0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x2A, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x02, 0xF4, 0x00, 0x2F,
-    0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0xAA, 0x4B, 0xFF,
-    0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0x05, 0x40, 0x0B, 0xFC, 0x01, 0xF4, 0x00, 0x2E, 0x00, 0x02, 0xE0,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x1B, 0xC0, 0x07, 0xE0, 0x00, 0x7F, 0x40, 0x00,
-    0xBC, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x7C, 0x00, 0x03, 0xD0, 0x00, 0x3F,
-    0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x24, 0xE3, 0x8E, 0x38, 0xD3, 0x4D, 0x34, 0xD3, 0x4D, 0x34,
-    0xC3, 0x1C, 0x71, 0xC0, 0x15, 0x00, 0x03, 0xFD, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4,
-    0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0x7D, 0x40, 0x01, 0xFC, 0x00, 0x2F, 0xC0,
-    0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xBC, 0x01, 0xFF,
-    0x80, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00,
-    0x00, 0x03, 0xFC, 0x3F, 0xC2, 0xF8, 0x1F, 0x80, 0x00, 0x01, 0x80, 0xFC, 0x0B, 0xC0, 0xBC, 0x0B,
-    0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-    0x04, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x06, 0xFE, 0x02, 0xFF, 0xF0,
-    0x3E, 0xB0, 0x0B, 0xCB, 0x00, 0xB4, 0xB0, 0x0F, 0x4B, 0x00, 0xF4, 0xB0, 0x0B, 0x8B, 0x00, 0xBD,
-    0xB0, 0x03, 0xFF, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x0B,
-    0xD0, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xC0, 0x00,
-    0x00, 0x2C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xFE, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1E, 0x14, 0xB0, 0x1F, 0xFF, 0xF4,
-    0x0B, 0x82, 0xE0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x82, 0xF0, 0x0F, 0xFF, 0xF0, 0x3F,
-    0xFF, 0xFC, 0x2C, 0x14, 0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x42, 0xE0, 0x00, 0xB8, 0x0F,
-    0x80, 0x2F, 0x00, 0x7E, 0x0B, 0xC0, 0x02, 0xF6, 0xF4, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xC0,
-    0x00, 0x02, 0xF4, 0x00, 0x01, 0xBF, 0xFC, 0x00, 0xFF, 0xFA, 0x80, 0x00, 0x2F, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x2F, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x05, 0x7F, 0xA8, 0x00, 0x02, 0xF0, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xE3, 0x8E, 0x38, 0xD2, 0x40, 0x00, 0x02, 0x4D,
-    0x34, 0xC3, 0x1C, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x03, 0x90, 0x74, 0x03, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0x80, 0x0F, 0xFF, 0xF4, 0x1F, 0x40, 0x3C,
-    0x2C, 0x00, 0x2C, 0x2E, 0x00, 0x3C, 0x0F, 0xFF, 0xFC, 0x02, 0xFF, 0xF4, 0x00, 0x0B, 0xF0, 0x00,
-    0x02, 0xF8, 0x04, 0x02, 0xF8, 0x2F, 0xFF, 0xF4, 0x7F, 0xFF, 0xE0, 0x2A, 0xE9, 0x00, 0x7C, 0x0B,
-    0x8B, 0xC0, 0xFC, 0xFD, 0x0F, 0xC5, 0x40, 0x54, 0x06, 0xA4, 0x05, 0x65, 0x82, 0x20, 0x15, 0x54,
-    0x01, 0x16, 0x01, 0x48, 0xB8, 0x80, 0x80, 0x90, 0x0A, 0x80, 0x00, 0x00, 0x3E, 0x43, 0x0E, 0x18,
-    0x18, 0x50, 0x61, 0x83, 0xC3, 0xFF, 0x02, 0x84, 0x00, 0x20, 0x04, 0x02, 0xC0, 0xE0, 0x3D, 0x1F,
-    0x07, 0xC1, 0xF0, 0x3C, 0x1E, 0x00, 0xF8, 0x7D, 0x00, 0xFC, 0xBD, 0x00, 0xF8, 0xBD, 0x00, 0xE0,
-    0x70, 0x00, 0x00, 0x40, 0x7F, 0xA9, 0x41, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x06, 0xA4, 0x05,
-    0x51, 0x82, 0x22, 0x15, 0x4F, 0xC1, 0x23, 0x21, 0x48, 0xC9, 0x80, 0xD1, 0xD0, 0x06, 0x80, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0xAF, 0x07, 0xC0, 0x78,
-    0xB4, 0x03, 0xCF, 0x00, 0x3C, 0xB8, 0x07, 0xC7, 0xE6, 0xF8, 0x2F, 0xFF, 0x00, 0x7F, 0x80, 0x00,
-    0x24, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xE0, 0x00,
-    0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFF, 0xFE, 0x05, 0x00, 0x00,
-    0x1A, 0x01, 0x1C, 0x00, 0xC0, 0x1C, 0x07, 0x42, 0xD0, 0x3F, 0xD1, 0x54, 0x1A, 0x40, 0x05, 0x00,
-    0x50, 0xB8, 0x00, 0x90, 0x06, 0x2A, 0xE3, 0xF8, 0x00, 0x0D, 0x1C, 0x3C, 0x74, 0x3C, 0x00, 0x3C,
-    0x7D, 0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E,
-    0x00, 0x3D, 0x7F, 0x00, 0xBD, 0xBF, 0xEB, 0xFD, 0xBF, 0xFF, 0xFD, 0xBB, 0xFF, 0xFD, 0xB2, 0xFE,
-    0x3D, 0xB0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x02, 0x90, 0xA0, 0x7F, 0x83, 0xC3, 0xFE, 0x0B, 0x1F,
-    0xF4, 0x2C, 0x7F, 0xD0, 0xB0, 0xFF, 0x42, 0xC1, 0xFD, 0x0B, 0x01, 0xF0, 0x2C, 0x0B, 0xC0, 0xB0,
-    0x2F, 0x02, 0xC0, 0xFC, 0x0B, 0x03, 0xF0, 0x2C, 0x1F, 0xC0, 0xB0, 0xBF, 0x02, 0xC2, 0xF8, 0x0B,
-    0x0F, 0xE0, 0x1C, 0x3F, 0x80, 0x70, 0x14, 0x7C, 0xBC, 0xFD, 0x10, 0x08, 0x03, 0x80, 0x08, 0x03,
-    0x1F, 0x40, 0x00, 0x01, 0xD0, 0x19, 0x00, 0x90, 0x09, 0x00, 0x90, 0x0D, 0x03, 0xFC, 0x15, 0x40,
-    0x1F, 0x80, 0xC2, 0x86, 0x03, 0x28, 0x0C, 0x70, 0x70, 0xFF, 0x40, 0x64, 0x00, 0x40, 0x10, 0x01,
-    0xD0, 0xB0, 0x02, 0xE0, 0xF4, 0x02, 0xE0, 0xB4, 0x01, 0xE0, 0xF4, 0x0F, 0xC7, 0xD0, 0xFC, 0xBD,
-    0x0F, 0xC7, 0xD0, 0x38, 0x0D, 0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0xD0, 0x00,
-    0x70, 0x00, 0x2C, 0x00, 0x07, 0x00, 0x03, 0x40, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x1C,
-    0x00, 0x07, 0xFF, 0x43, 0x80, 0x00, 0x7F, 0xF4, 0xB0, 0x01, 0x00, 0x00, 0x1D, 0x00, 0xE0, 0x00,
-    0x03, 0xC0, 0x2E, 0x00, 0x00, 0xB4, 0x07, 0xB0, 0x00, 0x0E, 0x00, 0xD7, 0x00, 0x02, 0xC0, 0x3C,
-    0x70, 0x00, 0x78, 0x07, 0xAF, 0x90, 0x0F, 0x00, 0x55, 0xBD, 0x02, 0xD0, 0x00, 0x0B, 0x00, 0x28,
-    0x00, 0x00, 0xB4, 0x0B, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x70,
-    0x00, 0x70, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0xC0, 0x00, 0x70, 0x00, 0x34, 0x00, 0x07, 0x00,
-    0x0B, 0x00, 0x00, 0x70, 0x01, 0xD0, 0x00, 0x7F, 0xF4, 0x38, 0xBF, 0x47, 0xFF, 0x47, 0x29, 0x2D,
-    0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0xF0,
-    0x00, 0x2C, 0x00, 0x1D, 0x00, 0x0B, 0x80, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0xB4, 0x00, 0xFC, 0x00,
-    0x0F, 0x00, 0x1F, 0xFF, 0x03, 0xD0, 0x02, 0xFF, 0xF0, 0x14, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x00, 0x40, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x0D, 0x00,
-    0x0B, 0xF4, 0x00, 0xB0, 0x00, 0x01, 0xD0, 0x03, 0x40, 0x00, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x03,
-    0x41, 0xC0, 0x00, 0x10, 0x2C, 0x0E, 0x00, 0x00, 0xFF, 0xE0, 0xB0, 0x01, 0x02, 0xFE, 0x07, 0x40,
-    0x38, 0x00, 0x00, 0x3C, 0x02, 0xE0, 0x00, 0x02, 0xD0, 0x1E, 0xC0, 0x00, 0x0E, 0x00, 0xD7, 0x00,
-    0x00, 0xB0, 0x0F, 0x1C, 0x00, 0x07, 0x80, 0x7A, 0xF9, 0x00, 0x3C, 0x01, 0x56, 0xF4, 0x02, 0xD0,
-    0x00, 0x0B, 0x00, 0x0A, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x1F,
-    0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x2F, 0x80, 0x7C, 0x0B, 0xFF, 0xF8, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-    0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F,
-    0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC,
-    0x00, 0x00, 0xBE, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x01,
-    0xF1, 0xF0, 0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00,
-    0x0F, 0x80, 0x3E, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFE, 0xAA, 0xBE,
-    0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xE0, 0x00,
-    0x0F, 0xC3, 0xF0, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x74, 0x78, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00,
-    0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83,
-    0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D,
-    0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02,
-    0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F,
-    0x80, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x07, 0x70, 0x90, 0x00, 0x02, 0x87, 0x70, 0x00, 0x00, 0xD0,
-    0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00,
-    0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C,
-    0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA,
-    0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8,
-    0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x3D, 0x07, 0xC0, 0x00, 0x0F, 0x42, 0xF0, 0x00,
-    0x07, 0xE0, 0xFD, 0x00, 0x01, 0x54, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF,
-    0x40, 0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F,
-    0x42, 0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00,
-    0xBC, 0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD,
-    0x03, 0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x01, 0xF0,
-    0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00,
-    0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F,
-    0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA,
-    0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E,
-    0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0xBB, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xD1, 0xF8,
-    0x00, 0x00, 0x00, 0x07, 0xC1, 0xFD, 0x5A, 0x00, 0x00, 0x0F, 0x40, 0xFF, 0xFF, 0x40, 0x00, 0x1F,
-    0x00, 0xFF, 0xFF, 0x40, 0x00, 0x3D, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xBC, 0x00, 0xFC, 0x00, 0x00,
-    0x00, 0xFE, 0xAA, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xAA, 0xA4, 0x0B, 0xC0, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0x80, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0x40,
-    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xAA, 0xF0, 0xFF,
-    0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0F, 0x80, 0x02, 0xD0,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0x55, 0x42, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF4, 0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x56, 0x90, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F,
-    0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xE0, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF4,
-    0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2F, 0x56, 0x90,
-    0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xF0, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xB8, 0x00, 0x07, 0x43, 0x80, 0x02, 0x00,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x0B, 0xC0,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5, 0xA4, 0x02, 0xFF,
-    0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x01,
-    0x40, 0x14, 0x00, 0xF4, 0x1F, 0x00, 0x7E, 0x0B, 0xC0, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5, 0xA4, 0x02, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0xB4,
-    0x00, 0xB8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x03, 0xF0, 0x0F, 0xC0, 0x3F,
-    0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0, 0x2F, 0x00, 0xBC,
-    0x03, 0xF4, 0x0F, 0xD0, 0x3F, 0x40, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0xD0, 0xB0, 0x38, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x3F, 0x0F, 0xC3, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2,
-    0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x3F, 0x4F, 0xD3, 0xF4, 0xFE, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x7F, 0x00, 0x74, 0xE0, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0xFD, 0x00,
-    0x3F, 0x40, 0x0F, 0xD0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0x03, 0xE0, 0xBC, 0x0F, 0x83, 0xF0,
-    0x3F, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00,
-    0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00,
-    0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFF,
-    0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x01, 0xFF,
-    0x40, 0x03, 0xD0, 0x00, 0x7F, 0x00, 0x0F, 0x40, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00,
-    0xF4, 0x00, 0x02, 0xF0, 0xFF, 0xFF, 0xC0, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x3D, 0x00,
-    0x00, 0x7E, 0x00, 0xF4, 0x00, 0x02, 0xF8, 0x03, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0x95, 0xAF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x82, 0x40, 0x00, 0x28, 0xE3, 0x40,
-    0x00, 0x34, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0F, 0xD0, 0x00, 0x3D,
-    0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC,
-    0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0xC0, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC,
-    0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC,
-    0x3F, 0x80, 0x7F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8,
-    0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0,
-    0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC,
-    0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC,
-    0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF,
-    0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00,
-    0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40,
-    0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B,
-    0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC,
-    0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x24,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03,
-    0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x7D,
-    0x3F, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00,
-    0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE2, 0xF8, 0x00, 0x03, 0xF4, 0x7F, 0xE9,
-    0x6B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00,
-    0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x81, 0x80, 0x00, 0x07, 0x34, 0x60,
-    0x00, 0x01, 0xC3, 0x74, 0x00, 0x00, 0x50, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
-    0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0,
-    0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF,
-    0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F,
-    0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x03, 0xC0, 0x00, 0x0F, 0x81, 0xF4, 0x00, 0x03, 0xF0, 0xBE, 0x00, 0x00, 0x54, 0x15, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0,
-    0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00,
-    0x3E, 0x3E, 0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00,
-    0x00, 0x3E, 0x3F, 0x00, 0x00, 0x0F, 0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x40, 0x7E, 0xD0, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x0F, 0x9F,
-    0x42, 0xA0, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x1F, 0xF8, 0x00, 0x00, 0x07,
-    0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0xBC, 0xBD, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x83,
-    0xE0, 0x00, 0x00, 0xF8, 0x03, 0xF0, 0x3E, 0x00, 0x00, 0x0F, 0x40, 0x7D, 0x03, 0xE0, 0x00, 0x00,
-    0xF4, 0x0F, 0xC0, 0x3E, 0x00, 0x00, 0x0F, 0x82, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0xFC, 0x7E, 0x00,
-    0x7E, 0x00, 0x00, 0x0B, 0xEF, 0xC0, 0x0F, 0xD0, 0x00, 0x00, 0x7F, 0xF9, 0x6F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x3F, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xF4,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xA0, 0x00, 0x1A, 0x8F, 0xD0, 0x00, 0xBF, 0x3F, 0x40, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3,
-    0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0,
-    0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00,
-    0x2F, 0x4B, 0xF0, 0x01, 0xFD, 0x1F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD,
-    0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0x53, 0xF4, 0x00,
-    0x2F, 0xCF, 0xD0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2, 0xFC, 0x00, 0x7F, 0x47, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0E, 0x1E, 0x00,
-    0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x6A, 0x3F,
-    0x40, 0x02, 0xFC, 0xFD, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00,
-    0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00,
-    0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xBD, 0x2F, 0xC0, 0x07, 0xF4,
-    0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x03, 0xE0, 0x7D, 0x00, 0x1F, 0xC2, 0xF4, 0x00, 0x15,
-    0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x1A, 0x8F, 0xD0, 0x00,
-    0xBF, 0x3F, 0x40, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7E,
-    0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F,
-    0x00, 0x00, 0xF8, 0xBC, 0x00, 0x07, 0xD2, 0xF4, 0x00, 0x2F, 0x4B, 0xF0, 0x01, 0xFD, 0x1F, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xE8, 0x00, 0xFF, 0xF8, 0x0F, 0x07, 0xF0,
-    0xF0, 0x0B, 0xCF, 0x00, 0x2D, 0xF0, 0x00, 0xDF, 0x00, 0x2D, 0xF0, 0x0F, 0xCF, 0x4B, 0xF0, 0xFF,
-    0xF8, 0x0F, 0xF8, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x1D, 0x00, 0x70, 0x2C, 0x00, 0x30, 0x3C, 0x03, 0xE0, 0x3C, 0x0E,
-    0x00, 0x3C, 0x0C, 0x00, 0x3C, 0x0D, 0x00, 0x3C, 0x0F, 0x40, 0x3C, 0x03, 0xE0, 0x3C, 0x00, 0xFC,
-    0x3D, 0x00, 0x2D, 0x3D, 0x00, 0x1D, 0x3D, 0xA5, 0xBD, 0x7D, 0xBF, 0xFC, 0x7D, 0x6F, 0xE0, 0x01,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C,
-    0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01,
-    0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54,
-    0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C,
-    0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE,
-    0x4F, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xD7, 0x80, 0x07, 0x00, 0xA0,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C,
-    0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x02, 0xE0, 0x20, 0x03, 0x68, 0x70, 0x07, 0x0D, 0xA0,
-    0x07, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E,
-    0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42,
-    0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x0B, 0xC0, 0xF4, 0x0F, 0xC0, 0xF8,
-    0x0F, 0xC1, 0xF8, 0x05, 0x40, 0x54, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B,
-    0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00,
-    0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x2A, 0x00,
-    0x00, 0x82, 0x00, 0x00, 0xD2, 0x40, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00,
-    0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE,
-    0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x2F, 0xD5, 0x2F, 0xF8, 0x00, 0x3F, 0xFF,
-    0xFE, 0x03, 0x80, 0x2E, 0x03, 0xFD, 0x00, 0x34, 0x0E, 0x00, 0x7E, 0x01, 0x5F, 0x07, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC2, 0xC0, 0x03, 0xFA, 0x95, 0x40, 0xF0, 0x00, 0xF4, 0x00, 0x00, 0x3C, 0x00, 0x7F,
-    0x00, 0x00, 0x0B, 0xD0, 0xBF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xBF,
-    0xFF, 0xF8, 0x01, 0xBE, 0x4F, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03,
-    0xE0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F, 0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0,
-    0x00, 0x3F, 0xDA, 0x01, 0xFF, 0xF8, 0x06, 0xFF, 0x80, 0x08, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x60,
-    0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x0E,
-    0x00, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02,
-    0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5,
-    0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4,
-    0x01, 0xBF, 0xD0, 0x00, 0x20, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xEE, 0x00, 0x0B, 0x03, 0x80, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41,
-    0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x05,
-    0x00, 0x50, 0x0F, 0x42, 0xF0, 0x1F, 0x43, 0xF0, 0x2F, 0x83, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70,
-    0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x2D, 0x00, 0x3E, 0x00, 0x2F,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x78,
-    0x01, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0x0D, 0x2C, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x24, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78, 0x7C, 0x7C, 0xBC, 0xBC, 0x00, 0x80,
-    0x00, 0xBC, 0x00, 0xBB, 0x80, 0xB0, 0x38, 0x10, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x80,
-    0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0x00,
-    0x07, 0xC0, 0x02, 0xF0, 0x00, 0xBC, 0x00, 0x05, 0x01, 0x40, 0xBC, 0x0F, 0x82, 0xF0, 0x3F, 0x0F,
-    0xD1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xC0,
-    0x00, 0x1F, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x64, 0x0D, 0x00, 0x0B, 0xFF, 0x4D, 0x00, 0x1F, 0x43, 0xDC, 0x00, 0x3D, 0x00, 0xFC,
-    0x00, 0x3C, 0x00, 0xBC, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x74, 0x00, 0x3E, 0x00, 0xF0,
-    0x00, 0x2F, 0xEF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x02, 0xE0, 0x20,
-    0x0D, 0xA1, 0x80, 0x70, 0xDA, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x46, 0x90,
-    0x0F, 0xFF, 0xF0, 0x3F, 0x42, 0xE0, 0xF4, 0x03, 0xC7, 0xC0, 0x0F, 0x1F, 0x00, 0x3D, 0x7C, 0x00,
-    0xF6, 0xF0, 0x03, 0xDB, 0xC0, 0x0F, 0xAF, 0x00, 0x3E, 0xBC, 0x00, 0xFB, 0xF0, 0x03, 0xE0, 0x0A,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78,
-    0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F,
-    0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D,
-    0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00,
-    0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0xB8, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0x07, 0x40, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00,
-    0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x07, 0xD0, 0xC0, 0x0E, 0x74, 0xC0, 0x0D,
-    0x1F, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02,
-    0xFE, 0x00, 0x1F, 0x02, 0xF0, 0x1F, 0x43, 0xF0, 0x2F, 0x43, 0xF0, 0x15, 0x01, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0,
-    0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D,
-    0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02,
-    0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x05, 0x56, 0xAA, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x2F,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x80,
-    0x00, 0x01, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0x00,
-    0x00, 0x03, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x0B, 0xFD, 0x00, 0x0F, 0xFF, 0xD0,
-    0x0F, 0x47, 0xBC, 0x07, 0x82, 0xD7, 0x82, 0xD0, 0xF0, 0xF0, 0xB4, 0x78, 0x3C, 0x3D, 0x2D, 0x0F,
-    0x0B, 0x8F, 0x07, 0xC1, 0xFB, 0xC7, 0xE0, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xF4, 0x00, 0x3F, 0xE0,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2D, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03,
-    0xCB, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF,
-    0xFD, 0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
-    0x1D, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x80, 0x0F,
-    0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF, 0xFD, 0x2F, 0xFF,
-    0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0xE0, 0x00, 0x0B, 0xD0, 0x00, 0xB6, 0xD0, 0x0A, 0x01, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB,
-    0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F, 0xFF, 0xFD,
-    0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x14, 0x01, 0x40, 0xF8, 0x0F, 0x43, 0xF0, 0x7D, 0x1F, 0xC2,
-    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x80, 0x0F, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0xF5, 0xF0, 0x0B, 0xD3, 0xFA, 0xFF, 0x4F,
-    0xFF, 0xFD, 0x2F, 0xFF, 0xF4, 0x2F, 0xE3, 0xD0, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2D,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E,
-    0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7,
-    0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40,
-    0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x10,
-    0x00, 0x07, 0x40, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x7F, 0x80, 0x07, 0xEF, 0x80, 0x38, 0x2E,
-    0x03, 0x80, 0xB8, 0x38, 0x02, 0xC3, 0x80, 0x2C, 0x38, 0x03, 0xC3, 0x80, 0x38, 0x38, 0x0F, 0x03,
-    0x87, 0xD0, 0x3F, 0xF4, 0x03, 0xF8, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x38, 0x00, 0x00, 0x05, 0x00, 0x50, 0x0F, 0x81, 0xF0, 0x0F, 0x82, 0xF4, 0x1F, 0xC3, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C,
-    0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2,
-    0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80,
-    0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A,
-    0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x00, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
-    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xBD, 0x00, 0x00, 0x03, 0xDB, 0x80, 0x00, 0x01, 0xF1, 0xF0,
-    0x00, 0x00, 0xB8, 0x3D, 0x00, 0x00, 0x3D, 0x0B, 0xC0, 0x00, 0x1F, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-    0x3E, 0x00, 0x03, 0xD0, 0x0B, 0xC0, 0x02, 0xF0, 0x01, 0xF4, 0x00, 0xFE, 0xAA, 0xBE, 0x00, 0x7F,
-    0xFF, 0xFF, 0xC0, 0x2F, 0xFF, 0xFF, 0xF4, 0x0F, 0xC0, 0x00, 0x3F, 0x07, 0xE0, 0x00, 0x0F, 0xC3,
-    0xF0, 0x00, 0x02, 0xF8, 0x01, 0x5A, 0xA4, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C,
-    0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x38,
-    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00,
-    0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00,
-    0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80,
-    0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D,
-    0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E,
-    0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C,
-    0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03,
-    0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC,
-    0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02,
-    0x40, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xD5, 0x00, 0x3F, 0xFF, 0xC0, 0x2E, 0x03, 0xF0, 0x0E, 0x00, 0x7C, 0x07, 0x00,
-    0x0F, 0x02, 0xC0, 0x03, 0xC0, 0xF0, 0x00, 0xF4, 0x3C, 0x00, 0x7D, 0x0B, 0xD0, 0xBF, 0x80, 0xFF,
-    0xFF, 0xE0, 0x2F, 0xFF, 0xB8, 0x01, 0xBE, 0x5F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0A, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xD0,
-    0x00, 0x00, 0x2C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0, 0x02, 0xFF, 0xFF,
-    0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03,
-    0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
-    0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x38, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4,
-    0x00, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x07, 0x43, 0x80, 0x00,
-    0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF,
-    0xE0, 0x02, 0xFF, 0xFF, 0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF,
-    0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x1F, 0x00, 0x07, 0xBC, 0x01, 0xD0, 0xB0, 0x10, 0x00, 0x40, 0x00, 0x00, 0x06,
-    0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0, 0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00,
-    0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0, 0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xC0, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE0,
-    0x02, 0xFF, 0xFF, 0x00, 0xFF, 0x95, 0x90, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-    0x00, 0x1F, 0x40, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x02, 0xFF, 0xFA, 0xAF, 0x0F, 0xFF, 0xFF,
-    0xF0, 0xBF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF0, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x0F, 0x40, 0x01, 0xF4, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x6F, 0xE0, 0x1F, 0xFF, 0x03, 0xE0, 0x00, 0xBC, 0x00, 0x0B, 0x40, 0x00, 0xF4, 0x00, 0x0F,
-    0x40, 0x00, 0xB8, 0x00, 0x0B, 0xD0, 0x00, 0x3F, 0xDA, 0x01, 0xFF, 0xF8, 0x02, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x90, 0x09, 0x00, 0x03, 0x87, 0x40, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F, 0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x2F, 0xFF,
-    0xAA, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x34, 0x0B, 0x5D, 0x00, 0x2F, 0x80, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x01, 0xFF, 0xF0, 0x3E, 0x00, 0x0B, 0xC0,
-    0x00, 0xB4, 0x00, 0x0F, 0x40, 0x00, 0xF4, 0x00, 0x0B, 0x80, 0x00, 0xBD, 0x00, 0x03, 0xFD, 0xA0,
-    0x1F, 0xFF, 0x80, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0B, 0x00,
-    0x00, 0x07, 0x8F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x40, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF4, 0x00, 0xF4, 0x01, 0xFF, 0x40, 0x3D, 0x00, 0x07, 0xF0, 0x0F,
-    0x40, 0x00, 0xBE, 0x03, 0xD0, 0x00, 0x0F, 0xC0, 0xF4, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0xBD,
-    0x0F, 0x40, 0x00, 0x1F, 0x83, 0xD0, 0x00, 0x07, 0xE0, 0xF4, 0x00, 0x02, 0xF8, 0x3D, 0x00, 0x02,
-    0xFD, 0x0F, 0x95, 0xAB, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0xFF, 0x80, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x02, 0xD0, 0x40,
-    0x00, 0x00, 0xB4, 0x74, 0x00, 0x00, 0x2C, 0x1D, 0x00, 0x00, 0x0B, 0x0B, 0x40, 0x00, 0x03, 0xC2,
-    0xC0, 0x0B, 0xF8, 0xF0, 0x00, 0x0B, 0xFF, 0xBC, 0x00, 0x0B, 0x81, 0xFF, 0x00, 0x03, 0xC0, 0x0F,
-    0xC0, 0x01, 0xD0, 0x03, 0xF0, 0x00, 0xB0, 0x00, 0xBC, 0x00, 0x2D, 0x00, 0x3F, 0x00, 0x0B, 0x80,
-    0x0F, 0xC0, 0x01, 0xFD, 0x6F, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00,
-    0x2F, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA4, 0x00, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0xF4, 0x01, 0xFF, 0x40, 0x03, 0xD0, 0x00, 0x7F, 0x00,
-    0x0F, 0x40, 0x00, 0xBE, 0x00, 0x3D, 0x00, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0x02, 0xF0, 0xFF, 0xFF,
-    0xC0, 0x07, 0xD3, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x3D, 0x00, 0x00, 0x7E, 0x00, 0xF4, 0x00, 0x02,
-    0xF8, 0x03, 0xD0, 0x00, 0x2F, 0xD0, 0x0F, 0x95, 0xAF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
-    0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07,
-    0xFF, 0xFE, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xBF, 0x8F, 0x00, 0x02, 0xFF, 0xEF, 0x00, 0x0B, 0x81,
-    0xFF, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x1D, 0x00, 0x3F, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x2D, 0x00,
-    0x3F, 0x00, 0x2E, 0x00, 0x3F, 0x00, 0x1F, 0xD6, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0xBF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0x00, 0x6A, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x42, 0xFF, 0xFF,
-    0xE0, 0xBF, 0xFF, 0xF4, 0x2F, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2F, 0x56, 0x90, 0x0B, 0xFF, 0xF4, 0x03, 0xFF, 0xFD, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xFE, 0xAA, 0xA4, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x2A, 0xA9, 0x50, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x0B, 0x00, 0x38, 0x03, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x6F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF,
-    0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD,
-    0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x07, 0xFF, 0xC0, 0x01,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC,
-    0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F,
-    0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x2F,
-    0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF,
-    0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4,
-    0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0,
-    0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40,
-    0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0xC0, 0x02, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x75, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0x78,
-    0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x50, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-    0xFE, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x28, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xC0,
-    0x00, 0x00, 0xE4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x24, 0x00, 0x3C, 0x78,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF,
-    0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA,
-    0xAA, 0x43, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0E,
-    0x01, 0xC0, 0x03, 0xCB, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0,
-    0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8,
-    0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00,
-    0x70, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x00, 0x74, 0x0A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x0B, 0xF8, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00,
-    0x3F, 0xA4, 0x3F, 0x00, 0x0B, 0xFF, 0x8F, 0xC0, 0x00, 0x0B, 0xE2, 0xF8, 0x00, 0x02, 0xD0, 0x7F,
-    0x80, 0x00, 0xF4, 0x0F, 0xFF, 0xFF, 0xFE, 0x02, 0xFF, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xFF, 0xD0,
-    0x00, 0xAF, 0xFE, 0x40, 0x00, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x3D, 0xF0, 0x03, 0x80, 0xB0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x87, 0x47, 0xFF, 0xFE, 0x3D, 0x1F, 0xF5, 0xD0, 0x0F, 0xDB,
-    0x00, 0x2F, 0x7C, 0x00, 0x7D, 0xB0, 0x01, 0xF6, 0xC0, 0x0B, 0xD7, 0x95, 0xBF, 0x0F, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xF0, 0x0B, 0xE3, 0xC0, 0x00, 0x2F, 0x04, 0x02, 0xF8, 0x3F, 0xFF, 0xC1, 0xFF, 0xFD,
-    0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x34, 0x00, 0x01, 0xD0, 0x2C,
-    0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xE0, 0x00, 0xBF, 0xFF, 0xFD, 0x00, 0xBF,
-    0x80, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFA,
-    0x43, 0xF0, 0x00, 0xBF, 0xF8, 0xFC, 0x00, 0x00, 0xBE, 0x2F, 0x80, 0x00, 0x2D, 0x07, 0xF8, 0x00,
-    0x0F, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF, 0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0A,
-    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0x80, 0xE0, 0x1D, 0x02, 0xFF, 0xE0, 0x01, 0xFD,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x74, 0x7F, 0xFF, 0xE3, 0xD1,
-    0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7, 0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C, 0x00, 0xBD, 0x79,
-    0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0, 0x40, 0x2F, 0x83,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3E, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xF4, 0x02, 0xFE,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F,
-    0xC0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xE9,
-    0x0F, 0xC0, 0x02, 0xFF, 0xE3, 0xF0, 0x00, 0x02, 0xF8, 0xBE, 0x00, 0x00, 0xB4, 0x1F, 0xE0, 0x00,
-    0x3D, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE0, 0x0B, 0xFF, 0xFF, 0xF4, 0x00, 0x2B,
-    0xFF, 0x90, 0x00, 0x00, 0x14, 0x00, 0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBE, 0x1D, 0x1F, 0xFF, 0xF8, 0xF4, 0x7F, 0xD7, 0x40,
-    0x3F, 0x6C, 0x00, 0xBD, 0xF0, 0x01, 0xF6, 0xC0, 0x07, 0xDB, 0x00, 0x2F, 0x5E, 0x56, 0xFC, 0x3F,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xC0, 0x2F, 0x8F, 0x00, 0x00, 0xBC, 0x10, 0x0B, 0xE0, 0xFF, 0xFF, 0x07,
-    0xFF, 0xF4, 0x06, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x2F, 0xE0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xF0, 0x00, 0xFE, 0x90, 0xFC, 0x00, 0x2F, 0xFE, 0x3F, 0x00, 0x00, 0x2F, 0x8B, 0xE0, 0x00, 0x0B,
-    0x41, 0xFE, 0x00, 0x03, 0xD0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0xBF, 0xFF,
-    0xFF, 0x40, 0x02, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x00, 0x7E, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x02,
-    0xFC, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x40, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xF8, 0x74, 0x7F, 0xFF, 0xE3, 0xD1, 0xFF, 0x5D, 0x00, 0xFD, 0xB0, 0x02, 0xF7,
-    0xC0, 0x07, 0xDB, 0x00, 0x1F, 0x6C, 0x00, 0xBD, 0x79, 0x5B, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0x00, 0xBE, 0x3C, 0x00, 0x02, 0xF0, 0x40, 0x2F, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xD0, 0x1B, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x2D, 0x3C,
-    0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x50, 0x2F, 0x00, 0x00,
-    0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFD, 0x3F, 0x80, 0x01,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x74, 0xB0, 0x00, 0x60, 0x06,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x3F, 0xD0, 0x03, 0xFF, 0xFE, 0x00, 0xFE, 0x4B, 0xC0, 0x3E,
-    0x00, 0xB4, 0x1F, 0x00, 0x1D, 0x07, 0xC0, 0x07, 0x81, 0xF0, 0x01, 0xE0, 0xBC, 0x00, 0x78, 0x2F,
-    0x00, 0x1E, 0x0B, 0xC0, 0x0B, 0xC2, 0xF0, 0x02, 0xF0, 0xFC, 0x00, 0xFC, 0x06, 0x80, 0x00, 0x29,
-    0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00,
-    0x3F, 0x02, 0xF0, 0x00, 0x0F, 0xC3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xC0,
-    0x00, 0x3F, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x07, 0xF0, 0x3F, 0x40, 0x01, 0xFC,
-    0x0F, 0xD0, 0x00, 0x7F, 0x43, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0xB4, 0x00, 0x00, 0x0B, 0x00, 0x00,
-    0x00, 0xB5, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x15, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF3,
-    0xFD, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFE, 0x4B, 0xC0, 0x0F, 0x80, 0x2D, 0x01, 0xF0, 0x01, 0xD0,
-    0x1F, 0x00, 0x1E, 0x01, 0xF0, 0x01, 0xE0, 0x2F, 0x00, 0x1E, 0x02, 0xF0, 0x01, 0xE0, 0x2F, 0x00,
-    0x2F, 0x02, 0xF0, 0x02, 0xF0, 0x3F, 0x00, 0x3F, 0x00, 0x01, 0x1F, 0x03, 0x35, 0xC7, 0x30, 0x7D,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0,
-    0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
-    0x02, 0xF0, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF4, 0x03, 0xF8, 0x03, 0xF8, 0x3D, 0x0D, 0xA3, 0x4C,
-    0xD0, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x07, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
-    0x05, 0x6A, 0x90, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x80, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F,
-    0x00, 0x00, 0xBC, 0x00, 0x02, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x2F, 0x00, 0x00, 0xBC, 0x00, 0x02,
-    0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x03, 0xF4, 0x00, 0x0F, 0xE0, 0x00,
-    0x3F, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x6A, 0xA5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00,
-    0x01, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2A, 0x0F, 0xC2,
-    0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBD, 0x2F, 0x4B, 0xD2, 0xF4,
-    0xFE, 0x3F, 0x8F, 0xE1, 0xC0, 0xC0, 0x70, 0x0F, 0xC0, 0x10, 0x1F, 0x0B, 0xC3, 0xF4, 0x54, 0x00,
-    0x00, 0x00, 0x40, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x1E, 0x07, 0x81, 0xF0, 0x7C, 0x2F, 0x0B,
-    0xC3, 0x42, 0x80, 0xA5, 0x0B, 0xC0, 0x00, 0x14, 0x0F, 0x83, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x15, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC,
-    0x2F, 0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x14, 0x38, 0x38, 0x38, 0x38, 0x38, 0x78, 0x78,
-    0x7C, 0x7C, 0xBC, 0xBC, 0x2A, 0x00, 0x06, 0x83, 0xF0, 0x00, 0xFC, 0x3F, 0x00, 0x0F, 0xC3, 0xF0,
-    0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC,
-    0x2F, 0x00, 0x0F, 0xC2, 0xF0, 0x00, 0xFC, 0x2F, 0x00, 0x0F, 0x82, 0xF0, 0x00, 0xF8, 0x2F, 0x00,
-    0x0F, 0x83, 0xF4, 0x00, 0xF8, 0x3F, 0x40, 0x0F, 0x83, 0xF4, 0x00, 0xF4, 0x3F, 0x80, 0x1F, 0x43,
-    0xF8, 0x01, 0xF4, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xAF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x02, 0xFF,
-    0xC0, 0x00, 0x2F, 0xE0, 0x00, 0x7C, 0x00, 0x00, 0x52, 0xF0, 0x00, 0x03, 0xEF, 0xD0, 0x00, 0x0F,
-    0x95, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0E,
-    0x00, 0x00, 0x2D, 0x38, 0x00, 0x00, 0xB4, 0xE0, 0x00, 0x02, 0xC3, 0x80, 0x00, 0x0B, 0x0E, 0x00,
-    0x00, 0x3C, 0x78, 0x00, 0x00, 0xF1, 0xE0, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x0F, 0x1F, 0x00, 0x00,
-    0x3C, 0xBC, 0x00, 0x00, 0xF2, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x34, 0x00, 0x0F, 0xC0, 0x03, 0xCB, 0x00, 0xD0, 0x1C, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F,
-    0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF4, 0x00, 0x1F, 0x40, 0x01, 0xF4, 0x00, 0x1F, 0x40,
-    0x02, 0xF4, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0x00, 0x02,
-    0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x03, 0xFF, 0xD0, 0x3F, 0xFC, 0x03, 0xFF, 0x00,
-    0x29, 0x40, 0x00, 0x00, 0x28, 0x00, 0x01, 0xF4, 0x00, 0x1E, 0xB4, 0x01, 0xC0, 0x34, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x00, 0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03,
-    0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x7D, 0x00, 0x3F, 0xF0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80, 0x03, 0xE0,
-    0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x02, 0xF4, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-    0x00, 0x07, 0xC2, 0xD0, 0x1F, 0x2F, 0x00, 0x79, 0xF0, 0x01, 0xFF, 0x40, 0x07, 0xF8, 0x00, 0x2F,
-    0xF0, 0x00, 0xBF, 0xF0, 0x02, 0xE3, 0xF0, 0x0B, 0xC7, 0xF0, 0x2F, 0x0B, 0xF4, 0xFC, 0x0F, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xBE, 0x00,
-    0x02, 0xF4, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x02, 0xC7, 0x80,
-    0xF3, 0xC0, 0x3A, 0xD0, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xFD, 0x00, 0x3B, 0xD0, 0x1D, 0x7D, 0x07,
-    0x4B, 0xD1, 0xD0, 0xFD, 0x03, 0x80, 0x00, 0x07, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-    0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00,
-    0x00, 0x03, 0x40, 0x2C, 0x00, 0xE0, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3C,
-    0x01, 0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0,
-    0x0F, 0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x0A, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x7F, 0x00,
-    0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x0E, 0x00, 0x3C, 0x01,
-    0xE0, 0x07, 0x80, 0x2E, 0x00, 0xB4, 0x02, 0xD0, 0x0F, 0x40, 0x3D, 0x00, 0xF4, 0x03, 0xD0, 0x0F,
-    0x40, 0x3C, 0x00, 0xF0, 0x03, 0xD4, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x0F,
-    0xD0, 0x3F, 0x01, 0xF8, 0x0B, 0xD0, 0x3F, 0x00, 0x05, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x10, 0x1F, 0x00, 0x74, 0x2F, 0x00, 0x74, 0x2F, 0x00, 0xB4,
-    0x2F, 0x00, 0xB4, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x3F, 0x15, 0x56, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x00, 0x07,
-    0x43, 0xC1, 0xD0, 0xF0, 0xB4, 0x78, 0x2C, 0x1E, 0x05, 0x0B, 0x80, 0x02, 0xD0, 0x00, 0xB4, 0x00,
-    0x3D, 0x00, 0x0F, 0x40, 0x03, 0xD0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00,
-    0xF5, 0x00, 0x3F, 0xF0, 0x0F, 0xFC, 0x00, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x1F, 0x00, 0xBC, 0x1F, 0x00, 0xFC, 0x2F, 0x00, 0xFC, 0x2F, 0x00, 0x54, 0x2F,
-    0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-    0x00, 0x3F, 0x15, 0x5A, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
-    0xF0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x2E, 0x01, 0x42, 0xD0, 0xBC, 0x2D, 0x0F, 0xC3, 0xD0,
-    0xFC, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xD0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
-    0x3D, 0x40, 0x03, 0xFF, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x00, 0x00, 0x0A, 0x03, 0xC0, 0x00, 0x00, 0x1F, 0x0B, 0x40, 0x00, 0x00, 0x1F, 0x1F, 0x00,
-    0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,
-    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xBF, 0x15, 0x5A, 0x00, 0x1F, 0x3F, 0xFF,
-    0xFF, 0x00, 0x3E, 0x3F, 0xFF, 0xFF, 0x00, 0xBC, 0x3F, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x02,
-    0xD0, 0x00, 0x00, 0x3D, 0x64, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-    0x7E, 0x3C, 0x00, 0x3E, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xD4, 0x00, 0x00, 0x3F,
-    0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xB0,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3D, 0x0F, 0xE0, 0x00, 0x7D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00,
-    0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0x9F, 0x40,
-    0xBC, 0x1F, 0x8F, 0xC0, 0xFC, 0x1F, 0x8B, 0xD0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0,
-    0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0x80, 0x2F,
-    0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x00,
-    0xE0, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-    0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7,
-    0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D,
-    0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC,
-    0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC,
-    0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8,
-    0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x2F, 0x80, 0x00,
-    0x00, 0x3F, 0x00, 0x00, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C,
-    0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB,
-    0xC0, 0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00,
-    0x02, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x1C, 0x07,
-    0x00, 0x00, 0x07, 0xBC, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00,
-    0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00,
-    0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0,
-    0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F,
-    0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x05, 0x00, 0x20,
-    0x0A, 0x0B, 0x00, 0x0B, 0xF0, 0x00, 0x0F, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00,
-    0xF1, 0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0,
-    0x0F, 0xBF, 0x00, 0x3E, 0x00, 0x00, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-    0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x6A, 0x40, 0x2F, 0xFF, 0xD0, 0x2F, 0x81, 0xF0, 0x2F, 0x00, 0xB4, 0x3E, 0x00,
-    0x78, 0x3D, 0x00, 0x7C, 0x3D, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0xBC, 0x3E, 0x00, 0xBC,
-    0x3E, 0x00, 0xBC, 0x7E, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0,
-    0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D, 0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF,
-    0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC, 0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83,
-    0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC, 0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80,
-    0x3F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x69,
-    0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1, 0xF0, 0x03, 0xD7, 0xC0,
-    0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F, 0xBF, 0x00, 0x3F, 0x00,
-    0x01, 0xF8, 0x00, 0x7F, 0xE0, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A, 0x80, 0x00, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F,
-    0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00,
-    0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80,
-    0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01,
-    0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAF, 0xF0, 0x3F,
-    0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE,
-    0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C,
-    0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x70, 0x00, 0x02, 0xC0, 0x2C, 0x00, 0x00,
-    0x3F, 0xFD, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F,
-    0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00,
-    0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0,
-    0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F, 0x80, 0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xA0, 0x0E, 0x01, 0xD0, 0x0B, 0xFF,
-    0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4,
-    0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF,
-    0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x06, 0x00, 0x02, 0x80, 0x02, 0xE0, 0x01, 0xF0,
-    0x00, 0xF8, 0x00, 0xBC, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x00,
-    0xFE, 0x00, 0x0F, 0xE0, 0x1F, 0x80, 0x00, 0x3F, 0x02, 0xF4, 0x00, 0x01, 0xF4, 0x3F, 0x00, 0x00,
-    0x0F, 0x83, 0xE0, 0x00, 0x00, 0xFC, 0x3D, 0x00, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x00, 0xBC, 0x3E,
-    0x00, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x00, 0xF8, 0x2F, 0x80, 0x00, 0x3F, 0x41, 0xFF, 0xA5, 0xAF,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x01,
-    0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x19, 0x01, 0xF0, 0x00, 0xB8,
-    0x0B, 0xC0, 0x07, 0xE0, 0x14, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x03, 0xD0, 0x1F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x0B, 0x40, 0x03, 0xC0, 0x0B, 0x40, 0x03, 0xC0,
-    0x0F, 0x40, 0x03, 0xC0, 0x0B, 0x80, 0x07, 0xC0, 0x07, 0xD0, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0xFF, 0xFD, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
-    0xFE, 0x6F, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x07, 0xFE, 0x55, 0x00,
-    0x0F, 0xE0, 0x00, 0xBF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x3F,
-    0x40, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0xD5, 0x80, 0x3E, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x3D, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x3F, 0xC0, 0x00,
-    0x3F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x00, 0x1F, 0xFA, 0x5A, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xAA, 0xA8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFE, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
-    0xFE, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xD7, 0xD0, 0x70, 0x3D, 0x01, 0xFE, 0x00, 0x2C, 0x78, 0x00,
-    0x7C, 0x01, 0x6C, 0xB4, 0x00, 0x3F, 0xFF, 0xFE, 0xB4, 0x00, 0x3E, 0xA5, 0x50, 0xF4, 0x00, 0x3C,
-    0x00, 0x00, 0xB8, 0x00, 0x7D, 0x00, 0x00, 0x7D, 0x01, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x0F, 0xFF, 0xD7, 0xFF, 0xFC, 0x02, 0xFE, 0x00, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xE0, 0x0B, 0xC0, 0x0E, 0x00,
-    0x3D, 0x00, 0xE0, 0x02, 0xE0, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x03, 0xE0, 0x1E, 0x01, 0xFD, 0x01,
-    0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x40, 0xBD, 0x02, 0xF4, 0x03,
-    0xE0, 0x3F, 0x40, 0x2F, 0x03, 0xF4, 0x03, 0xF4, 0x3F, 0x40, 0x3F, 0x83, 0xF8, 0x03, 0xFC, 0x3F,
-    0x80, 0x3F, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x07, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-    0x04, 0x3D, 0xFD, 0x3F, 0xFD, 0x3F, 0x40, 0x3E, 0x00, 0x3E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x3E,
-    0x00, 0x7E, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x0F, 0xFE, 0x80, 0x00, 0xFF, 0xFF, 0x40, 0x0E, 0x00,
-    0xBC, 0x00, 0xE0, 0x03, 0xD0, 0x0E, 0x00, 0x2E, 0x01, 0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x3E, 0x01,
-    0xE0, 0x1F, 0xD0, 0x1F, 0xFF, 0xF8, 0x02, 0xFF, 0xFE, 0x00, 0x2F, 0xFF, 0xF8, 0x02, 0xF4, 0x0B,
-    0xD0, 0x2F, 0x40, 0x3E, 0x03, 0xF4, 0x02, 0xF0, 0x3F, 0x40, 0x3F, 0x43, 0xF4, 0x03, 0xF8, 0x3F,
-    0x80, 0x3F, 0xC3, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x05, 0x01, 0x03, 0xDF, 0xD0, 0xFF, 0xF4,
-    0x3F, 0x40, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF4, 0x00, 0x3D, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x02,
-    0xF8, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xF0, 0x02, 0xF8, 0x00, 0xFD, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0B, 0xE0, 0x00, 0x01, 0x00, 0x10,
-    0x00, 0x2C, 0x0A, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0xE0, 0x0B, 0xC0,
-    0x0E, 0x00, 0x3D, 0x00, 0xE0, 0x02, 0xE0, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x03, 0xE0, 0x1E, 0x01,
-    0xFD, 0x01, 0xFF, 0xFF, 0x80, 0x2F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x2F, 0x40, 0xBD, 0x02,
-    0xF4, 0x03, 0xE0, 0x3F, 0x40, 0x2F, 0x03, 0xF4, 0x03, 0xF4, 0x3F, 0x40, 0x3F, 0x83, 0xF8, 0x03,
-    0xFC, 0x3F, 0x80, 0x3F, 0xC0, 0x10, 0x00, 0x41, 0xD0, 0x34, 0x07, 0xAD, 0x00, 0x1F, 0x40, 0x00,
-    0x60, 0x00, 0x00, 0x00, 0x01, 0x40, 0x40, 0x3D, 0xFD, 0x03, 0xFF, 0xD0, 0x3F, 0x40, 0x03, 0xE0,
-    0x00, 0x3E, 0x00, 0x03, 0xD0, 0x00, 0x3D, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0B, 0xE0, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE4, 0x00, 0x0F, 0xFF, 0xFD,
-    0x00, 0x0B, 0xFE, 0xAA, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x7C, 0x00,
-    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xA4, 0x00, 0x00, 0x2F, 0xFF, 0xE0, 0x00, 0x01,
-    0xBF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xD0,
-    0x14, 0x00, 0x3F, 0xF4, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFD,
-    0x00, 0xBF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x2C,
-    0x00, 0x03, 0x80, 0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x81,
-    0xFA, 0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00,
-    0x7E, 0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xB4, 0xB0, 0x00, 0x00, 0x60, 0x06, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x40, 0x00, 0xFF, 0xFF,
-    0xD0, 0x00, 0xBF, 0xEA, 0xA0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0x40, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00,
-    0x1B, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x07, 0xFD,
-    0x01, 0x40, 0x03, 0xFF, 0x41, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
-    0xD0, 0x0B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x40, 0x03,
-    0xED, 0x00, 0xE0, 0x74, 0x14, 0x00, 0x40, 0x00, 0x00, 0x02, 0xFF, 0x81, 0xFA, 0xA4, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E, 0x04, 0x03, 0xF2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4, 0x00,
-    0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-    0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06, 0xFF,
-    0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40, 0x50,
-    0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4, 0x02,
-    0xFF, 0xFE, 0x90, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x09, 0x00,
-    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x02, 0xFF, 0x81, 0xFA, 0xA4, 0x3C, 0x00,
-    0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00, 0x7E, 0x04, 0x03, 0xF2,
-    0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xF4, 0x00, 0x20, 0x00, 0x0A, 0x40, 0x00, 0x03, 0x00, 0x00,
-    0x70, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x0B, 0x07, 0x40, 0x00, 0x00,
-    0xBF, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0xF4,
-    0x00, 0x2F, 0xFA, 0xA8, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x90, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x06,
-    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x40,
-    0x50, 0x00, 0xFF, 0xD0, 0x7F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF4, 0x3F, 0xFF, 0xFF, 0xF4,
-    0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x1C, 0x07, 0x4F,
-    0x00, 0x1F, 0xC0, 0x00, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x81,
-    0xFA, 0xA4, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x2F, 0x40, 0x00, 0xFF, 0x90, 0x01, 0xBF, 0xC0, 0x00,
-    0x7E, 0x04, 0x03, 0xF2, 0xFF, 0xFE, 0xBF, 0xFF, 0xD2, 0xFF, 0xE4, 0x15, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x17, 0xD5, 0x2F, 0xFF,
-    0xE0, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0B, 0xC0,
-    0x02, 0xFF, 0x80, 0xBF, 0xF4, 0x1F, 0xFE, 0x00, 0x39, 0x00, 0x00, 0x90, 0x00, 0x24, 0x01, 0xF8,
-    0x00, 0x60, 0x06, 0x00, 0x00, 0x2D, 0x3C, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x02, 0xC0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x1D, 0x00, 0x01, 0xD0, 0x1D, 0x2D, 0x03, 0xC2, 0xD0, 0x3C, 0x00, 0x17,
-    0xD5, 0x0B, 0xFF, 0xF8, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-    0x00, 0x7C, 0x00, 0x0B, 0xC0, 0x00, 0xBF, 0xE0, 0x0B, 0xFF, 0x40, 0x7F, 0xF8, 0x15, 0x55, 0x55,
-    0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x02, 0xFF, 0xFF,
-    0x80, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0,
-    0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0,
-    0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x05,
-    0xF5, 0x42, 0xFF, 0xFE, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xBF, 0xFF, 0xEB, 0xFF, 0xFE, 0x01, 0xF0,
-    0x00, 0x1F, 0x00, 0x02, 0xF0, 0x00, 0x2F, 0xF8, 0x02, 0xFF, 0xD0, 0x1F, 0xFE, 0x00, 0x2D, 0x05,
-    0x00, 0x01, 0xCD, 0x24, 0x00, 0x0A, 0x1D, 0xD0, 0x00, 0x28, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x6A, 0x3F, 0x40, 0x02, 0xFC, 0xFD,
-    0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x1F, 0x4B, 0xD0, 0x00, 0xBD, 0x2F, 0xC0, 0x07, 0xF4, 0x7F, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xF4, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x06, 0x01, 0xCA, 0x24, 0x0A, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2E, 0x00, 0x3C,
-    0x78, 0x00, 0xF1, 0xE0, 0x03, 0xD7, 0xC0, 0x2F, 0x4F, 0xEB, 0xFD, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF,
-    0xD0, 0xBF, 0x8F, 0x40, 0x00, 0x55, 0xAA, 0x00, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xA3, 0xF4, 0x00, 0x2F, 0xCF, 0xD0,
-    0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00,
-    0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E,
-    0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2, 0xFC, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFC, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6A,
-    0x81, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xCB, 0x40,
-    0x0F, 0x2D, 0x00, 0x3C, 0xB4, 0x00, 0xF2, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x1E, 0x00, 0x3D, 0x7C,
-    0x02, 0xF4, 0xFE, 0xBF, 0xD3, 0xFF, 0xFF, 0x4B, 0xFF, 0xFD, 0x0B, 0xF8, 0xF4, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x40, 0x1C, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00,
-    0x07, 0xF3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x3E, 0x2F, 0x00, 0x01, 0xF4, 0xBD, 0x00, 0x0B, 0xD2,
-    0xFD, 0x00, 0x7F, 0x47, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFF, 0x40, 0x1F,
-    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x07, 0x02, 0xC0, 0x3C, 0x03, 0xFF,
-    0xC0, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F,
-    0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x07, 0xD0,
-    0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x01, 0xFC, 0xFD,
-    0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00,
-    0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03,
-    0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1,
-    0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x09, 0x30, 0x00, 0x30, 0xC0, 0x00, 0xD7, 0x00, 0x01, 0xF4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x40,
-    0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F, 0x00, 0xBD, 0x3F,
-    0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x14, 0x00, 0x05, 0x00, 0x2E,
-    0x00, 0x0F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x25, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x06, 0xA0, 0x3F, 0x40, 0x02, 0xFC,
-    0x0F, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x01,
-    0xF8, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x00,
-    0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x0B, 0xD0, 0x2F,
-    0xC0, 0x07, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40,
-    0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00,
-    0xB8, 0x0B, 0xC0, 0x03, 0xE0, 0x2E, 0x00, 0x1E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0B, 0x40, 0x0F, 0x00, 0x0B, 0x40, 0x0F,
-    0x00, 0x0B, 0x40, 0x0F, 0x00, 0x0B, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x07, 0x80, 0x0F,
-    0x40, 0x07, 0xC0, 0x2F, 0x40, 0x03, 0xFA, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
-    0x40, 0x00, 0xBF, 0x8F, 0x40, 0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F,
-    0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F,
-    0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0,
-    0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xF9, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF2, 0xD0,
-    0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03, 0xC7, 0x80, 0x0F, 0x5F,
-    0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE, 0x3D, 0x00, 0x02, 0xC0,
-    0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x50, 0x00, 0x00, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x00, 0x00, 0x7D, 0x2F, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x7D,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF0, 0x02, 0xF0, 0x01, 0xF4,
-    0x0B, 0xC0, 0x0F, 0xD0, 0x0F, 0xC0, 0x1F, 0x40, 0xBF, 0xC0, 0x3F, 0x00, 0x3E, 0x03, 0xFF, 0x41,
-    0xF8, 0x00, 0xFC, 0x2F, 0xFF, 0x0B, 0xD0, 0x03, 0xF0, 0xFD, 0xBD, 0x3F, 0x00, 0x0B, 0xDB, 0xF1,
-    0xFC, 0xFC, 0x00, 0x1F, 0xBF, 0x83, 0xFB, 0xE0, 0x00, 0x3F, 0xFC, 0x0B, 0xFF, 0x40, 0x00, 0xFF,
-    0xF0, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x40, 0x3F, 0xF0, 0x00, 0x0B, 0xFC, 0x00, 0xBF, 0x80, 0x00,
-    0x1F, 0xE0, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xD0,
-    0x00, 0x00, 0x38, 0x74, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x54, 0x00, 0x00, 0x14, 0xBC, 0x00, 0x00, 0x3C, 0x7C, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00,
-    0xB8, 0x3E, 0x07, 0xC0, 0xF4, 0x2F, 0x0F, 0xE0, 0xF0, 0x1F, 0x3F, 0xF5, 0xF0, 0x0F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xD0, 0x0B, 0xFC, 0xBF, 0xC0, 0x03, 0xF8, 0x3F, 0xC0, 0x03, 0xF0, 0x1F,
-    0x80, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x1D, 0xB0, 0x00, 0x00, 0xB0, 0x1C,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F,
-    0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x24, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xEF, 0x00, 0x07, 0x02,
-    0xC0, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C,
-    0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03,
-    0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F,
-    0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00,
-    0x2A, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0xFC, 0x1F, 0x40, 0x01,
-    0xFC, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03,
-    0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00,
-    0x0F, 0xFF, 0x55, 0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x34, 0x00, 0x02, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F,
-    0x40, 0x02, 0xF4, 0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0,
-    0x01, 0xFE, 0xAA, 0x4B, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0xFC,
-    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xD0,
-    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x3F, 0xF0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x3F, 0xFD,
-    0x55, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
-    0x14, 0x00, 0x01, 0xF0, 0x00, 0x0B, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x00, 0x0B, 0xD0, 0x00, 0xBD, 0x00, 0x0B, 0xD0,
-    0x00, 0xBE, 0x00, 0x0B, 0xE0, 0x00, 0xBE, 0x00, 0x0B, 0xF0, 0x00, 0x7F, 0xAA, 0x92, 0xFF, 0xFF,
-    0xCB, 0xFF, 0xFF, 0x40, 0x00, 0x30, 0x07, 0x00, 0x00, 0x07, 0x4B, 0x00, 0x00, 0x00, 0x7F, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00,
-    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF4, 0x00,
-    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x0F, 0xFF, 0x55,
-    0x55, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0x40, 0x04,
-    0x00, 0x00, 0x2C, 0x07, 0x00, 0x2D, 0xF0, 0x00, 0x2F, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x00, 0x2F, 0x40, 0x02, 0xF4,
-    0x00, 0x2F, 0x40, 0x02, 0xF8, 0x00, 0x2F, 0x80, 0x02, 0xF8, 0x00, 0x2F, 0xC0, 0x01, 0xFE, 0xAA,
-    0x4B, 0xFF, 0xFF, 0x2F, 0xFF, 0xFD, 0x07, 0xE0, 0x7E, 0xD3, 0xC0, 0x0F, 0x00, 0x78, 0x01, 0xE0,
-    0x07, 0x80, 0x1E, 0x00, 0x78, 0x02, 0xE0, 0x0B, 0x80, 0x2F, 0x00, 0xBC, 0x02, 0xF0, 0x0B, 0xC0,
-    0x2F, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xBF,
-    0xE4, 0x07, 0x00, 0x3F, 0xFF, 0xFC, 0x2C, 0x03, 0xF8, 0x03, 0xFD, 0xD0, 0x3F, 0x80, 0x03, 0xFE,
-    0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x07, 0xD0, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0xF8,
-    0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x07, 0xFE, 0x96, 0xBF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x06,
-    0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xBF, 0x80, 0x90, 0xFF,
-    0xFD, 0x30, 0xF4, 0x07, 0xF8, 0x78, 0x00, 0x7C, 0x2D, 0x00, 0x0F, 0x0B, 0x40, 0x03, 0xC3, 0xD0,
-    0x00, 0xF0, 0xB8, 0x00, 0x7C, 0x1F, 0x40, 0x7E, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x02,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF9, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0xFF, 0x00, 0x7F, 0x0E, 0xBC,
-    0x00, 0x3C, 0x72, 0xF0, 0x00, 0xF5, 0xCB, 0xC0, 0x03, 0xC3, 0x2F, 0x00, 0x7F, 0x00, 0xBF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xEA, 0x50, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-    0x03, 0xF0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x03,
-    0xF4, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x01, 0xFC, 0x00,
-    0x00, 0x78, 0x00, 0x00, 0x1D, 0x1B, 0x90, 0x07, 0xAF, 0xFE, 0x01, 0xFF, 0x02, 0xC0, 0x7F, 0x00,
-    0x38, 0x1F, 0x80, 0x0F, 0x07, 0xD0, 0x02, 0xC1, 0xF8, 0x00, 0xB0, 0x7F, 0x00, 0x3C, 0x1F, 0xE0,
-    0x1F, 0x07, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0x80, 0x3D, 0x00, 0x00, 0x0F, 0x40,
-    0x00, 0x07, 0xC0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-    0x55, 0x57, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x34,
-    0x00, 0x00, 0xC0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3D, 0x55, 0x47,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F,
-    0xF7, 0xFF, 0xFD, 0x2C, 0x03, 0xD0, 0x00, 0x08, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x1E, 0x00, 0x1F, 0x80, 0x0F, 0xD0, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x01, 0x7D, 0x52, 0xFF,
-    0xFE, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0xBC,
-    0x00, 0x2F, 0xF8, 0x0B, 0xFF, 0x41, 0xFF, 0xE0, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD,
-    0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00,
-    0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00,
-    0x00, 0x0B, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x1B, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2C, 0xA8, 0x00, 0x06,
-    0xAE, 0x3F, 0x40, 0x02, 0xFF, 0x0F, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00,
-    0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC,
-    0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x1F, 0x40,
-    0xBD, 0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x07, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x0F, 0x32, 0xD0, 0x03, 0xEC, 0xB4, 0x00, 0xFC, 0x2D, 0x00,
-    0x3C, 0x0B, 0x80, 0x0F, 0x01, 0xE0, 0x03, 0xC0, 0x78, 0x00, 0xF4, 0x1F, 0x00, 0xBD, 0x03, 0xFA,
-    0xFF, 0x40, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x02, 0xFE, 0x3D, 0x00, 0x78, 0x00, 0x7C, 0x00,
-    0x7D, 0x00, 0x00, 0x00, 0x0D, 0x1C, 0x3C, 0x74, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3F, 0x40, 0x3C,
-    0x74, 0x38, 0x03, 0x40, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x05, 0x6A,
-    0xA0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x56, 0x43, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xA3, 0x80, 0x74, 0x7F, 0xFC, 0x07, 0xF8, 0x00, 0x7C, 0xBC,
-    0xFD, 0x54, 0x7C, 0x0B, 0x8B, 0xC0, 0xFC, 0xFD, 0x0F, 0xC5, 0x40, 0x54, 0x2F, 0x40, 0x70, 0x70,
-    0x20, 0x2A, 0x14, 0x6A, 0x18, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0xB4, 0x2F, 0x00, 0x0F, 0x43,
-    0xE0, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0x43, 0xC7, 0x40, 0x3F, 0x40, 0x03, 0x80,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x3D, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x7D, 0x00, 0x2F, 0x00, 0x00,
-    0x00, 0x00, 0x3F, 0x43, 0xF8, 0x1F, 0x80, 0xFC, 0x0F, 0xC0, 0xBD, 0x3F, 0x8F, 0xD3, 0xF0, 0xFC,
-    0x7E, 0x2F, 0x40, 0x3F, 0x42, 0xF8, 0x1F, 0x80, 0xFC, 0x0F, 0xC0, 0xBD, 0x05, 0x07, 0x7F, 0x07,
-    0x05, 0x20, 0x70, 0x7F, 0x70, 0x20, 0x7E, 0xA5, 0x0A, 0xBF, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x00,
-    0x03, 0x80, 0x0C, 0x0C, 0x18, 0x70, 0x00, 0x04, 0x86, 0x0E, 0x00, 0x00, 0x03, 0x40, 0xD1, 0xFF,
-    0x00, 0x1F, 0xF0, 0xD0, 0x24, 0x04, 0x02, 0x02, 0xE4, 0x20, 0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x14, 0x7C, 0xBC, 0xFD, 0x14, 0x05, 0x47, 0xC0, 0xFC, 0xBC, 0x0F, 0xCF,
-    0xD0, 0xFC, 0x2A, 0x14, 0x6A, 0x18, 0xFC, 0x00, 0x00, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F,
-    0x40, 0x10, 0x08, 0x03, 0x80, 0x08, 0x03, 0x1F, 0x40, 0x01, 0x03, 0x03, 0x01, 0xC0, 0x3F, 0x40,
-    0x40, 0x14, 0xE3, 0x9E, 0x79, 0xE0, 0x7F, 0xF9, 0xD0, 0xE7, 0x03, 0x80, 0x00, 0x38, 0x03, 0x43,
-    0xC7, 0x40, 0x3F, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0xFC, 0x00, 0xE2, 0xC0,
-    0xD0, 0x1C, 0x00, 0x00, 0x00, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC1, 0x55, 0x40, 0x3D, 0x05, 0x73,
-    0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x10,
-    0x91, 0x5C, 0x00, 0x70, 0x39, 0xC0, 0xE7, 0xFF, 0x80, 0x00, 0x7F, 0xF5, 0x80, 0xD6, 0x03, 0x58,
-    0x0D, 0x7F, 0xF4, 0x2A, 0x60, 0x88, 0x52, 0x21, 0x94, 0x81, 0x00, 0x0C, 0x80, 0xC0, 0xB4, 0x63,
-    0x00, 0x3D, 0x05, 0x73, 0x09, 0xA1, 0xDC, 0xA0, 0xBC, 0x00, 0x00, 0x60, 0xB2, 0x80, 0x00, 0x38,
-    0x00, 0x07, 0x40, 0x00, 0xB0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0B, 0x8B,
-    0xC0, 0xFC, 0xFD, 0x0F, 0xC5, 0x40, 0x54, 0x7F, 0xF9, 0xD0, 0xE7, 0x03, 0x80, 0x00, 0x05, 0x6A,
-    0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xA9, 0x3F, 0xFF, 0xE0,
-    0x00, 0x00, 0x38, 0x0F, 0x38, 0x0F, 0x38, 0x0F, 0x78, 0x0F, 0x78, 0x1F, 0x14, 0x05, 0x00, 0x01,
-    0xFF, 0xC6, 0xAF, 0x40, 0x3D, 0x00, 0xF4, 0x01, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00,
-    0x20, 0x2D, 0x95, 0x73, 0xC9, 0xA1, 0xDD, 0xA1, 0xFC, 0x02, 0x40, 0x03, 0x00, 0x07, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x01, 0xF4, 0x00, 0x1B, 0xE4,
-    0x00, 0x28, 0x3E, 0x0B, 0xC0, 0x0F, 0x6F, 0x00, 0x7E, 0x4B, 0xCF, 0xC7, 0x42, 0xBF, 0x80, 0x02,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x09, 0x3C, 0x74,
-    0x0E, 0x78, 0x1E, 0x1D, 0x74, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x09,
-    0x3C, 0x3D, 0x0D, 0x74, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x50, 0x00,
-    0x4B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x10, 0x10, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00,
-    0x00, 0xC0, 0x79, 0x00, 0x07, 0x80, 0x00, 0x6A, 0xA9, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x02, 0x90,
-    0x00, 0x0B, 0x42, 0x40, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x39, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x55, 0x55, 0x55, 0x57, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-    0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00,
-    0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8,
-    0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0,
-    0x00, 0x0B, 0xE0, 0x3F, 0xFA, 0x40, 0x03, 0xFF, 0xFF, 0x40, 0x3D, 0x00, 0x7D, 0x03, 0xD0, 0x01,
-    0xE0, 0x3D, 0x00, 0x0F, 0x03, 0xD0, 0x01, 0xE0, 0x3D, 0x00, 0x7D, 0x03, 0xFF, 0xFF, 0x40, 0x3F,
-    0xFF, 0xF8, 0x03, 0xD0, 0x02, 0xF4, 0x3D, 0x00, 0x0B, 0xC3, 0xD0, 0x00, 0x7C, 0x3D, 0x00, 0x07,
-    0xD3, 0xD0, 0x00, 0xFD, 0x3E, 0x55, 0xBF, 0xC3, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0x74, 0x00, 0x07, 0x40, 0x00, 0x74, 0x00, 0x07, 0x40,
-    0x00, 0x74, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
-    0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3E, 0xB8,
-    0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0xF8, 0x3E, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x0F,
-    0x80, 0x03, 0xD0, 0x0B, 0xC0, 0x0B, 0xC0, 0x07, 0xE0, 0x0F, 0x80, 0x03, 0xF0, 0x2F, 0x00, 0x01,
-    0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x05, 0x55,
-    0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03, 0xF0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x03,
-    0xFC, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0x40, 0x00, 0x03, 0xFF, 0xD5, 0x55, 0x40, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xD0, 0x05, 0x00, 0x00, 0x50, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00,
-    0xF8, 0x2F, 0x00, 0x00, 0xF8, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00, 0xFC, 0x2F, 0x00, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFC, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0x40, 0x01,
-    0xFC, 0x3F, 0x40, 0x01, 0xFC, 0x3F, 0x40, 0x01, 0xFD, 0x3F, 0x80, 0x01, 0xFD, 0x00, 0x1B, 0xFE,
-    0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x54, 0x3F, 0x3D,
-    0x2F, 0xFF, 0x0B, 0xCF, 0x45, 0x54, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E,
-    0x2F, 0x80, 0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0F,
-    0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0F, 0xD3,
-    0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x0B, 0xC0, 0x3F, 0x00, 0x2F, 0x02, 0xF4, 0x00, 0xBC, 0x1F, 0x80,
-    0x03, 0xE0, 0xFC, 0x00, 0x0F, 0x8B, 0xD0, 0x00, 0x3E, 0x3F, 0x00, 0x00, 0xFA, 0xF4, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x2F, 0x7F, 0xC0, 0x00, 0xBC, 0x7F, 0xC0, 0x03, 0xF0, 0xBF, 0xC0, 0x0F, 0xC0, 0xFF,
-    0xC0, 0x3F, 0x00, 0xFF, 0xC0, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-    0x03, 0xF1, 0xFC, 0x00, 0x00, 0xBE, 0x0F, 0xD0, 0x00, 0x0F, 0xD0, 0xBF, 0x00, 0x00, 0xFC, 0x03,
-    0xF0, 0x00, 0x1F, 0x80, 0x3F, 0x40, 0x03, 0xF4, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x07,
-    0xE0, 0x00, 0xBD, 0x00, 0xBC, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x01,
-    0xF4, 0x2F, 0x00, 0x00, 0x0F, 0xC2, 0x90, 0x00, 0x00, 0x68, 0x0A, 0x90, 0x00, 0x0A, 0x90, 0x3F,
-    0xC0, 0x00, 0x3F, 0x80, 0xFF, 0x40, 0x02, 0xFE, 0x07, 0xFE, 0x00, 0x0F, 0xF8, 0x1F, 0xFC, 0x00,
-    0x7F, 0xF0, 0x7F, 0xF8, 0x03, 0xFF, 0xC1, 0xFB, 0xF0, 0x0F, 0xFF, 0x07, 0xCF, 0xD0, 0xBD, 0xFC,
-    0x2F, 0x2F, 0xC3, 0xF3, 0xF0, 0xBC, 0x7F, 0x1F, 0x8F, 0xC2, 0xF0, 0xFE, 0xFD, 0x3F, 0x0B, 0xD1,
-    0xFF, 0xF0, 0xFD, 0x3F, 0x43, 0xFF, 0x83, 0xF4, 0xFD, 0x0B, 0xFC, 0x1F, 0xD3, 0xF4, 0x1F, 0xF0,
-    0x7F, 0x8F, 0xE0, 0x3F, 0x41, 0xFE, 0x3F, 0x80, 0x68, 0x0B, 0xF8, 0xFE, 0x00, 0x00, 0x2F, 0xF0,
-    0x00, 0x00, 0x00, 0x29, 0x0B, 0xD0, 0x00, 0x3D, 0x0F, 0xF0, 0x00, 0x7D, 0x0F, 0xF4, 0x00, 0x7D,
-    0x0F, 0xFC, 0x00, 0x7C, 0x0F, 0xFD, 0x00, 0xBC, 0x0F, 0xBF, 0x00, 0xBC, 0x0F, 0xAF, 0x40, 0xBC,
-    0x1F, 0x8F, 0x80, 0xFC, 0x1F, 0x8B, 0xC0, 0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x2F, 0x82, 0xF0, 0xFC,
-    0x2F, 0x80, 0xF8, 0xFC, 0x2F, 0x80, 0xBD, 0xFC, 0x3F, 0x80, 0x3F, 0xF8, 0x3F, 0x80, 0x3F, 0xF8,
-    0x3F, 0xC0, 0x1F, 0xF8, 0x3F, 0xC0, 0x0F, 0xF8, 0x1A, 0xAA, 0xAA, 0x42, 0xFF, 0xFF, 0xF4, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1A, 0xAA, 0x40, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x1B, 0xFE,
-    0x40, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80,
-    0x00, 0x3F, 0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D,
-    0x00, 0x00, 0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E,
-    0x2F, 0x80, 0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xF0, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55,
-    0x51, 0xFF, 0xFF, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x01, 0xD7, 0x40,
-    0x07, 0x5D, 0x00, 0x1D, 0x74, 0x00, 0x75, 0xD0, 0x01, 0xD7, 0x40, 0x07, 0x5D, 0x00, 0x1D, 0x74,
-    0x00, 0x75, 0xD0, 0x01, 0xD7, 0x40, 0x07, 0x40, 0x1F, 0xFF, 0x90, 0x07, 0xFF, 0xFF, 0x01, 0xF0,
-    0x07, 0xF0, 0x7C, 0x00, 0x3C, 0x2F, 0x00, 0x0F, 0x4B, 0xC0, 0x03, 0xC2, 0xF0, 0x07, 0xF0, 0xBF,
-    0xFF, 0xF8, 0x2F, 0xFF, 0xF8, 0x0F, 0xEA, 0x50, 0x03, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F,
-    0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x15, 0x55, 0x57, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00,
-    0x0D, 0x00, 0x00, 0x34, 0x00, 0x00, 0xC0, 0x00, 0x2C, 0x00, 0x0B, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-    0x00, 0x3D, 0x55, 0x47, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F,
-    0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07,
-    0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-    0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFA, 0xEB, 0xFE, 0x00,
-    0x2F, 0xE0, 0x74, 0x2F, 0xF0, 0x1F, 0xD0, 0x2D, 0x01, 0xFE, 0x0B, 0xF0, 0x0B, 0x00, 0x2F, 0xC3,
-    0xF0, 0x02, 0xC0, 0x03, 0xF0, 0xFC, 0x00, 0xB0, 0x00, 0xFC, 0x3F, 0x00, 0x2C, 0x00, 0x3F, 0x0F,
-    0xC0, 0x0B, 0x00, 0x0F, 0xC3, 0xF8, 0x02, 0xC0, 0x07, 0xF0, 0xBF, 0x90, 0xB0, 0x0B, 0xF8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
-    0x6F, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0A,
-    0x40, 0x00, 0x1A, 0x01, 0xF0, 0x00, 0x0F, 0x40, 0x3E, 0x00, 0x0B, 0x80, 0x03, 0xD0, 0x07, 0xC0,
-    0x00, 0xBC, 0x03, 0xD0, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x01, 0xFA, 0xF0, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x3F, 0x6F, 0xC0, 0x00, 0x3F, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x0F,
-    0xE0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFE, 0x0B, 0xF4, 0x00, 0x2F, 0xD0, 0x78, 0x07, 0x00, 0xB1,
-    0xE0, 0x1C, 0x02, 0xC3, 0x40, 0x70, 0x0B, 0x0E, 0x01, 0xC0, 0x3C, 0x3C, 0x07, 0x00, 0xF0, 0xF0,
-    0x1C, 0x07, 0x82, 0xF0, 0x70, 0x7D, 0x03, 0xF2, 0xC7, 0xF0, 0x0B, 0xFF, 0xFF, 0x40, 0x07, 0xFF,
-    0xF4, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
-    0x00, 0x05, 0x50, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x02, 0xF4, 0x1F, 0xC0, 0x0B, 0xC0, 0x02, 0xE0,
-    0x0F, 0x00, 0x00, 0xF0, 0x2E, 0x00, 0x00, 0xB8, 0x2D, 0x00, 0x00, 0x7C, 0x3D, 0x00, 0x00, 0x3C,
-    0x3C, 0x00, 0x00, 0x3C, 0x3D, 0x00, 0x00, 0x7C, 0x2E, 0x00, 0x00, 0xBC, 0x1F, 0x00, 0x00, 0xF4,
-    0x0B, 0x40, 0x03, 0xF0, 0x07, 0xE0, 0x1F, 0xC0, 0x7F, 0xF4, 0x2F, 0xFC, 0x7F, 0xF4, 0x2F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x50, 0x00, 0x3F, 0xFF, 0xC0, 0x02,
-    0xE0, 0x3F, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x70, 0x00, 0xF0, 0x02, 0xC0, 0x03, 0xC0, 0x0F, 0x00,
-    0x0F, 0x40, 0x3C, 0x00, 0x7D, 0x00, 0xBD, 0x0B, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFB,
-    0xE9, 0x01, 0xBE, 0x4F, 0xF4, 0x00, 0x00, 0x19, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x0B, 0xFF, 0x40, 0x2E, 0x07, 0xD0, 0x3C, 0x00,
-    0xF0, 0x78, 0x00, 0x74, 0x78, 0x00, 0x70, 0x78, 0x01, 0xE0, 0x78, 0x3F, 0x80, 0x78, 0x2B, 0xE0,
-    0x78, 0x00, 0x7C, 0x78, 0x00, 0x2D, 0x7D, 0x00, 0x3E, 0x7F, 0xD0, 0x7E, 0x7F, 0xFF, 0xFD, 0x7E,
-    0xFF, 0xFC, 0x78, 0x1F, 0xF4, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00,
-    0x00, 0x24, 0x00, 0x28, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0B, 0xC0, 0x3C,
-    0x03, 0xD0, 0x7C, 0x02, 0xF0, 0xB8, 0x00, 0xF4, 0xF4, 0x00, 0xBE, 0xF0, 0x00, 0x7F, 0xE0, 0x00,
-    0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x1F,
-    0x40, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x40, 0x06, 0xFF, 0xA0, 0x2F, 0xAF, 0xF0, 0x3C, 0x00, 0x10,
-    0x2E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x1F, 0x40, 0x02,
-    0xFF, 0xD0, 0x0F, 0xFB, 0xF4, 0x2F, 0x40, 0xBC, 0x3E, 0x00, 0x3D, 0x7D, 0x00, 0x3E, 0x3D, 0x00,
-    0x3E, 0x3F, 0x00, 0x7D, 0x1F, 0xFB, 0xFC, 0x0B, 0xFF, 0xF0, 0x01, 0xBF, 0x80, 0x0B, 0xE0, 0x0A,
-    0x0A, 0x03, 0x00, 0x80, 0xC0, 0x00, 0x29, 0x00, 0x03, 0xF0, 0x03, 0x80, 0x01, 0xC0, 0x74, 0x38,
-    0x1E, 0x0F, 0xFF, 0x00, 0xBE, 0x40, 0x03, 0xFF, 0xF0, 0x05, 0x7F, 0x80, 0x02, 0xE0, 0x00, 0x3D,
-    0x00, 0x02, 0xE0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x7E, 0x40, 0x00, 0x3F, 0xF4, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3D, 0x00,
-    0x03, 0xF0, 0x00, 0x2F, 0x40, 0x00, 0x54, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xC0, 0x50, 0x00, 0xBB,
-    0xFF, 0x80, 0x2F, 0x80, 0xB4, 0x0B, 0x80, 0x0F, 0x02, 0xD0, 0x03, 0xC0, 0xB4, 0x00, 0xB0, 0x3D,
-    0x00, 0x3C, 0x0F, 0x40, 0x0F, 0x03, 0xE0, 0x03, 0xC0, 0xF8, 0x00, 0xF0, 0x3E, 0x00, 0x3D, 0x0F,
-    0xC0, 0x0F, 0x40, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x1F, 0x40,
-    0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x07, 0x82, 0xC0, 0x0E, 0x00, 0xB0, 0x2C,
-    0x00, 0x34, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3E, 0xAA, 0xBC, 0x7F, 0xFF, 0xFC, 0x7C, 0x00,
-    0x3C, 0x3C, 0x00, 0x7C, 0x3D, 0x00, 0xBC, 0x3F, 0x01, 0xFC, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF0,
-    0x07, 0xFF, 0xD0, 0x01, 0xFE, 0x00, 0x10, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xF0,
-    0x7C, 0x1F, 0x07, 0xC2, 0xF0, 0xBF, 0xEF, 0xE0, 0x00, 0x00, 0x01, 0xD0, 0xF0, 0x1D, 0x2D, 0x01,
-    0xD7, 0xC0, 0x2C, 0xF0, 0x02, 0xEE, 0x00, 0x2F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x03, 0xDF,
-    0x80, 0x3C, 0xBE, 0x03, 0xC3, 0xF4, 0x3C, 0x0F, 0xD0, 0x2A, 0x40, 0x00, 0x3F, 0xF0, 0x00, 0x3F,
-    0xFD, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x2F,
-    0xD0, 0x00, 0x3F, 0xE0, 0x00, 0xBF, 0xF0, 0x01, 0xF5, 0xF0, 0x03, 0xF0, 0xF0, 0x07, 0xC0, 0xF4,
-    0x0F, 0x80, 0xB8, 0x1F, 0x00, 0x3C, 0x3D, 0x00, 0x3C, 0x7C, 0x00, 0x2D, 0x3C, 0x00, 0x3C, 0x7D,
-    0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7D, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E, 0x00, 0x3C, 0x7E, 0x00,
-    0x3D, 0x7F, 0x00, 0xBD, 0xBF, 0xEB, 0xFD, 0xBF, 0xFF, 0xFD, 0xBB, 0xFF, 0xFD, 0xB2, 0xFE, 0x3D,
-    0xB0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x14, 0x00, 0x14, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 0x3C, 0x0F,
-    0x00, 0x3C, 0x0B, 0x80, 0x3C, 0x03, 0xC0, 0x3C, 0x02, 0xE0, 0x7C, 0x00, 0xF4, 0xF4, 0x00, 0xFE,
-    0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xD0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0xC0, 0x15, 0xFE, 0x00,
-    0x0F, 0x40, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x40, 0x00, 0x1F, 0xF4, 0x00, 0x3E, 0x40,
-    0x02, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1B, 0xD0, 0x00, 0x03,
-    0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x54, 0x00, 0x02, 0xFE, 0x00, 0x0F,
-    0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00,
-    0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00,
-    0x2A, 0xAA, 0xAA, 0x1F, 0xFF, 0xFF, 0xD0, 0x38, 0x0F, 0x00, 0x1E, 0x03, 0xC0, 0x07, 0x80, 0xE0,
-    0x01, 0xD0, 0x78, 0x00, 0xB4, 0x1D, 0x00, 0x2D, 0x0B, 0x40, 0x0B, 0x02, 0xD0, 0x03, 0xC0, 0xBE,
-    0x00, 0xF0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0x42,
-    0xE0, 0x0F, 0x80, 0x3C, 0x03, 0xC0, 0x0B, 0x41, 0xF0, 0x02, 0xD0, 0xBC, 0x00, 0xB4, 0x3F, 0x40,
-    0x2D, 0x0F, 0xF0, 0x0F, 0x03, 0xFF, 0xFF, 0xC1, 0xFB, 0xFF, 0xD0, 0x7C, 0xBF, 0xC0, 0x2F, 0x00,
-    0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0xFF, 0x43, 0xD0, 0xB4, 0xD0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x03, 0x40, 0x00, 0xF0,
-    0x00, 0x0F, 0x40, 0x00, 0xF8, 0x00, 0x2F, 0x00, 0x0B, 0xC0, 0x02, 0xF0, 0x00, 0x6C, 0x00, 0x02,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x54, 0x3D, 0x01, 0xF0, 0x07, 0x80, 0x07, 0x80, 0xB4, 0x00, 0x3C,
-    0x0B, 0x40, 0x03, 0xC0, 0xF4, 0x00, 0x3C, 0x0B, 0x80, 0x07, 0xC0, 0x7D, 0x01, 0xF8, 0x03, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x2F, 0xE0, 0x00, 0x2A, 0xAA, 0xA8, 0x7F, 0xFF, 0xFC, 0x00,
-    0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x10, 0x05, 0x07,
-    0x40, 0x74, 0x34, 0x03, 0x83, 0x40, 0x2C, 0x38, 0x01, 0xC3, 0x80, 0x1D, 0x38, 0x01, 0xD3, 0xC0,
-    0x1D, 0x3E, 0x03, 0xD2, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x50, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE3, 0x8F, 0xF0,
-    0x0F, 0xE0, 0xD0, 0xBF, 0x07, 0xE0, 0x34, 0x0F, 0xC2, 0xF4, 0x0D, 0x01, 0xF4, 0xFC, 0x03, 0x40,
-    0x3E, 0x3E, 0x00, 0xD0, 0x0F, 0xCF, 0x40, 0x34, 0x02, 0xF3, 0xD0, 0x0D, 0x00, 0xBC, 0xF8, 0x03,
-    0x40, 0x3E, 0x3F, 0x00, 0xD0, 0x0F, 0x8B, 0xE0, 0x34, 0x0F, 0xD1, 0xFF, 0xAE, 0x6F, 0xF0, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xF4, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0xFE, 0x00, 0x0F, 0x03, 0xFF, 0x00, 0xF0, 0x00, 0xBF, 0x0B, 0x80, 0x00, 0x7D, 0x3C, 0x00,
-    0x00, 0xBF, 0xD0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x07, 0xEF, 0x40, 0x00, 0x3E, 0x3F, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x2F, 0x80,
-    0xFF, 0xD1, 0xFC, 0x01, 0xFF, 0x8F, 0xD0, 0x01, 0xFE, 0x00, 0x50, 0x00, 0x00, 0xB0, 0x00, 0x00,
-    0xB0, 0x00, 0x20, 0x70, 0x40, 0x74, 0x70, 0xB0, 0x34, 0x70, 0x74, 0x34, 0x70, 0x38, 0x38, 0x30,
-    0x38, 0x38, 0x34, 0x3C, 0x3C, 0x34, 0x3C, 0x3C, 0x34, 0x3C, 0x2F, 0x79, 0xBC, 0x1F, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xF0, 0x02, 0xFF, 0x80, 0x00, 0x38, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x18, 0x00, 0x01, 0x40, 0x00, 0x00, 0x2D, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0x2D,
-    0x0B, 0x40, 0x00, 0x38, 0x3C, 0x01, 0x00, 0xF0, 0xF0, 0x18, 0x03, 0xC7, 0xC0, 0x60, 0x0F, 0x0F,
-    0x01, 0xC0, 0x7C, 0x3D, 0x0F, 0x87, 0xD0, 0x7F, 0xFB, 0xFF, 0x00, 0x6F, 0x4B, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-    0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00,
-    0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F,
-    0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF,
-    0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
-    0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C,
-    0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00,
-    0x00, 0xBE, 0x00, 0x00, 0x55, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00,
-    0x02, 0x80, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7,
-    0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E,
-    0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F,
-    0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x29, 0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x00, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC,
-    0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C,
-    0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00,
-    0x2C, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x38, 0x74, 0x00,
-    0x00, 0x20, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D,
-    0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01,
-    0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40,
-    0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03,
-    0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xB0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x75, 0xE0, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xBF, 0x54, 0x00, 0xFF, 0xFF, 0x00, 0xB8, 0x0F, 0xC0, 0x38, 0x01, 0xF0, 0x1C, 0x00,
-    0x3C, 0x0B, 0x00, 0x0F, 0x03, 0xC0, 0x03, 0xD0, 0xF0, 0x01, 0xF4, 0x2F, 0x42, 0xFE, 0x03, 0xFF,
-    0xFF, 0x80, 0xBF, 0xFE, 0xE0, 0x06, 0xF9, 0x3C, 0x14, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00,
-    0x00, 0x0B, 0xC0, 0x10, 0x00, 0x00, 0x1A, 0x07, 0x80, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x74, 0x78, 0x00, 0x00, 0x08, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x02,
-    0xEF, 0x40, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x00, 0xB8, 0x3D, 0x00,
-    0x00, 0x0F, 0x42, 0xF0, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0x03, 0xD0,
-    0x0B, 0xC0, 0x00, 0xBC, 0x00, 0x7D, 0x00, 0x0F, 0xEA, 0xAB, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
-    0x2F, 0xFF, 0xFF, 0xF4, 0x03, 0xF0, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x00, 0xFC, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x38, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x2C, 0x00,
-    0x00, 0x07, 0xE0, 0x00, 0x01, 0xD7, 0x80, 0x00, 0x70, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
-    0xF5, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0xB8, 0x0F, 0xC0, 0x0E, 0x00, 0x7C, 0x01, 0xC0, 0x03, 0xC0,
-    0x2C, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xD0, 0x3C, 0x00, 0x7D, 0x02, 0xF4, 0x2F, 0xE0, 0x0F, 0xFF,
-    0xFE, 0x00, 0xBF, 0xFE, 0xE0, 0x01, 0xBE, 0x4F, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x43, 0x00,
-    0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x34, 0x74, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00,
-    0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03,
-    0xE0, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F,
-    0x00, 0x00, 0x2F, 0x80, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x28, 0x00, 0x00, 0x20,
-    0x00, 0x1D, 0x00, 0x00, 0x7F, 0x40, 0x01, 0xD1, 0xD0, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00,
-    0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE,
-    0x01, 0xBE, 0x4F, 0x00, 0x0F, 0x41, 0x40, 0x00, 0x07, 0x70, 0x90, 0x00, 0x02, 0x87, 0x70, 0x00,
-    0x00, 0xD0, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0x0B, 0x00, 0x00, 0x08, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-    0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00,
-    0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xBC,
-    0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF,
-    0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x02,
-    0xE0, 0x20, 0x03, 0x68, 0x70, 0x07, 0x0D, 0xA0, 0x07, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2D, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xD2, 0xC0, 0x06, 0x00, 0x60, 0x00, 0xBF, 0x54,
-    0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C,
-    0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE,
-    0x4F, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x74,
-    0x78, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00,
-    0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC,
-    0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00,
-    0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC,
-    0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xBC, 0x00,
-    0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x7E, 0x00, 0x01, 0xD7, 0x80, 0x0A, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF,
-    0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D,
-    0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x55,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xB0, 0x00, 0x03, 0x80, 0x78, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F,
-    0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x02,
-    0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0xF8, 0x00,
-    0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00, 0x3F, 0x0F, 0xC0, 0x00,
-    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30,
-    0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00,
-    0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE,
-    0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00,
-    0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x0B, 0x00, 0x00, 0x38, 0x03, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40, 0x00,
-    0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42, 0xF0,
-    0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC, 0x00,
-    0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03, 0xF0,
-    0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x02, 0xE0,
-    0x00, 0x00, 0xBC, 0x00, 0x00, 0x2B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00,
-    0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x02, 0xB8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0xC0, 0x00, 0x0E, 0x01, 0xE0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0x00, 0x00, 0x00, 0xBB, 0xD0, 0x00, 0x00, 0x3D, 0xB8, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00,
-    0x0B, 0x83, 0xD0, 0x00, 0x03, 0xD0, 0xBC, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xE0,
-    0x00, 0x3D, 0x00, 0xBC, 0x00, 0x2F, 0x00, 0x1F, 0x40, 0x0F, 0xEA, 0xAB, 0xE0, 0x07, 0xFF, 0xFF,
-    0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0xFC, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0xFC, 0x3F, 0x00,
-    0x00, 0x2F, 0x80, 0x00, 0xBF, 0x80, 0x01, 0x41, 0xD0, 0x00, 0x01, 0xD0, 0x00, 0x0B, 0x80, 0x00,
-    0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C,
-    0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF,
-    0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x0F, 0x42, 0x40, 0x00, 0x0A, 0x38, 0xD0, 0x00, 0x03, 0x83, 0xF0,
-    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
-    0x00, 0x00, 0x00, 0xD0, 0x0B, 0x00, 0x00, 0x3C, 0x07, 0x80, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0xEF, 0x40,
-    0x00, 0x00, 0xF6, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x2E, 0x0F, 0x40, 0x00, 0x0F, 0x42,
-    0xF0, 0x00, 0x07, 0xC0, 0x7C, 0x00, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0xF4, 0x02, 0xF0, 0x00, 0xBC,
-    0x00, 0x7D, 0x00, 0x3F, 0xAA, 0xAF, 0x80, 0x1F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xFD, 0x03,
-    0xF0, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x00, 0xBE, 0x02, 0xF0, 0x70, 0x03,
-    0x2C, 0x60, 0x07, 0x0B, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
-    0x00, 0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0, 0x00, 0xBE, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B, 0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C,
-    0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00, 0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xB0, 0x00,
-    0x03, 0x80, 0x38, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, 0x0F, 0x6E, 0x00, 0x00, 0x07,
-    0xC7, 0xC0, 0x00, 0x02, 0xE0, 0xF4, 0x00, 0x00, 0xF4, 0x2F, 0x00, 0x00, 0x7C, 0x07, 0xC0, 0x00,
-    0x3E, 0x00, 0xF8, 0x00, 0x0F, 0x40, 0x2F, 0x00, 0x0B, 0xC0, 0x07, 0xD0, 0x03, 0xFA, 0xAA, 0xF8,
-    0x01, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x3F, 0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,
-    0x3F, 0x0F, 0xC0, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00,
-    0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x30, 0x0B, 0x40, 0xB0, 0x03, 0xFF, 0xD0,
-    0x00, 0xBE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x54, 0x03, 0xFF, 0xFC, 0x0B,
-    0x80, 0xFC, 0x0E, 0x00, 0x7C, 0x1C, 0x00, 0x3C, 0x2C, 0x00, 0x3C, 0x3C, 0x00, 0x3D, 0x3C, 0x00,
-    0x7D, 0x2F, 0x42, 0xFE, 0x0F, 0xFF, 0xFE, 0x0B, 0xFF, 0xEE, 0x01, 0xBE, 0x4F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x55, 0x00, 0x00,
-    0x05, 0x55, 0x0B, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0xD0, 0xBC, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B,
-    0x80, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x5A, 0x40, 0x2F, 0xFF, 0xD0, 0x0F, 0xFF, 0xF4, 0x03,
-    0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xFA, 0xAA, 0x90,
-    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x1F, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40,
-    0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00,
-    0x00, 0xFE, 0x00, 0x00, 0x2B, 0x80, 0x00, 0x00, 0x30, 0x00, 0x00, 0x34, 0x00, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x2F, 0xFF, 0xFE,
-    0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA,
-    0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x09, 0x00, 0x28, 0xE3, 0x40, 0x0A, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x54, 0x2F, 0xFF,
-    0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0x80,
-    0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x43, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x03, 0xD0, 0xD0, 0x0A, 0x34, 0xC0, 0x0D, 0x0F, 0xC0, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF,
-    0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40,
-    0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01,
-    0xBF, 0xD0, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x3C, 0x00,
-    0x0D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x0B, 0x7C, 0x00, 0x0B, 0x02, 0xC0, 0x01, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF, 0xFD, 0x0B, 0xC0, 0x00, 0x02,
-    0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5, 0xA4, 0x02, 0xFF, 0xFD, 0x00,
-    0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03,
-    0x80, 0x08, 0x01, 0xD0, 0x0B, 0xC0, 0xF0, 0x0B, 0xB8, 0x78, 0x0B, 0x03, 0x80, 0x01, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0xF4, 0x1D,
-    0x00, 0xB0, 0x01, 0xC0, 0x78, 0x05, 0xB8, 0x2F, 0xFF, 0xFF, 0x0B, 0xAA, 0x54, 0x03, 0xC0, 0x00,
-    0x00, 0xB8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0xFF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x01, 0xBF,
-    0xD0, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x01, 0x00, 0x00, 0x2F, 0x01, 0xF0, 0x00, 0x00,
-    0x11, 0xEE, 0x00, 0x00, 0x01, 0xD0, 0xE0, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x15, 0x54, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x02, 0xF0, 0x00,
-    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x02, 0xF5,
-    0x69, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x03,
-    0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x40,
-    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x28, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x3E, 0x08, 0x00, 0x00, 0x15, 0xBC, 0x00, 0x00, 0x0B, 0xB8, 0x00,
-    0x00, 0xB0, 0x38, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x0F, 0x41, 0xD0, 0x00, 0xB0, 0x01, 0xC0, 0x07, 0x80,
-    0x5B, 0x80, 0x2F, 0xFF, 0xFF, 0x00, 0xBA, 0xA5, 0x40, 0x03, 0xC0, 0x00, 0x00, 0x0B, 0x80, 0x00,
-    0x00, 0x1F, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x3F, 0xFF, 0xD0, 0x00, 0x1B, 0xFD, 0x00,
-    0x00, 0x00, 0x1A, 0x40, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xA0, 0x00, 0x0D,
-    0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0xBB, 0xC0, 0x00, 0x2C, 0x0B, 0x00, 0x01, 0x00, 0x14, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x02, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFD, 0x02, 0xF0, 0x00,
-    0x00, 0x2E, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x02, 0xF5, 0x69, 0x00, 0x2F,
-    0xFF, 0xD0, 0x03, 0xFF, 0xFD, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00,
-    0x03, 0xE0, 0x00, 0x00, 0x3F, 0xAA, 0xA9, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x01, 0xA4, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x00, 0x28,
-    0x00, 0x00, 0xBD, 0x00, 0x02, 0xD7, 0x40, 0x0A, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78,
-    0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00,
-    0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x09,
-    0x00, 0x28, 0xE3, 0x40, 0x0A, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0xBD, 0x00, 0x00, 0x76, 0xD0, 0x00, 0x70, 0x1D, 0x00, 0x10, 0x00, 0x40, 0x00, 0x15,
-    0x54, 0x2F, 0xFF, 0xFE, 0x0B, 0xFF, 0xFF, 0x42, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00,
-    0x00, 0x0B, 0x80, 0x00, 0x02, 0xF5, 0x69, 0x00, 0xBF, 0xFF, 0x40, 0x3F, 0xFF, 0xD0, 0x0F, 0xC0,
-    0x00, 0x03, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0xEA, 0xAA, 0x43, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0xD0, 0x0A,
-    0x34, 0xC0, 0x0D, 0x0F, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xBD,
-    0x00, 0x02, 0xDB, 0x40, 0x0A, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-    0x02, 0xFF, 0x40, 0x0F, 0x41, 0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA,
-    0xA5, 0x40, 0xF0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF,
-    0xF4, 0x01, 0xBF, 0xD0, 0x00, 0x04, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xB8, 0x00, 0x07, 0x43,
-    0x80, 0x02, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x50, 0xBF, 0xFF, 0xF8, 0x2F, 0xFF,
-    0xFD, 0x0B, 0xC0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x0B, 0xD5,
-    0xA4, 0x02, 0xFF, 0xFD, 0x00, 0xFF, 0xFF, 0x40, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x3F, 0xAA, 0xA9, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xBC, 0x00, 0x00,
-    0x3F, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0xBC, 0x00, 0x02, 0xEE, 0x00, 0x0B, 0x02, 0x80, 0x04,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0xFF, 0x40, 0x0F, 0x41,
-    0xD0, 0x2C, 0x00, 0x70, 0x78, 0x05, 0xB8, 0xBF, 0xFF, 0xFC, 0xBA, 0xA5, 0x40, 0xF0, 0x00, 0x00,
-    0xB8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x0F, 0xFF, 0xF4, 0x01, 0xBF, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xBD, 0x00, 0x00, 0xFE,
-    0x00, 0x2A, 0x00, 0xA0, 0x74, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC3, 0xF0, 0xFC,
-    0x3F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC3, 0xF4, 0xFD, 0x3F,
-    0x4F, 0xE3, 0xF8, 0x2F, 0x80, 0x1C, 0x03, 0x40, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0E,
-    0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1E, 0x01, 0xF0, 0x1F, 0x02, 0xF0, 0x2F, 0x00,
-    0x2A, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F, 0x0B, 0xC2, 0xF0, 0xBC, 0x2F,
-    0x0F, 0xD3, 0xF4, 0xFD, 0x3F, 0x8F, 0xE0, 0x00, 0x00, 0x2F, 0x0F, 0xC3, 0xF0, 0x54, 0x1F, 0x0B,
-    0xC3, 0xF4, 0x54, 0x00, 0x00, 0x00, 0x40, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x1E, 0x07, 0x81,
-    0xF0, 0x7C, 0x2F, 0x0B, 0xC0, 0x00, 0x00, 0x3E, 0x0F, 0x83, 0xF0, 0x54, 0x00, 0x1B, 0xFE, 0x40,
-    0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0xC0, 0x3F, 0x80, 0x03, 0xF8, 0x1F, 0x80, 0x00,
-    0x3F, 0x0B, 0xD0, 0x00, 0x07, 0xD3, 0xF0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x3F, 0x3D, 0x00,
-    0x00, 0x0B, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x3E, 0x2F,
-    0x80, 0x00, 0x3F, 0x47, 0xFE, 0x96, 0xBF, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x0B,
-    0xE0, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00,
-    0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0,
-    0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xBC, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x54, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00,
-    0x00, 0x43, 0x40, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x7E, 0x00, 0x00, 0xFC, 0x2F, 0x40,
-    0x00, 0x1F, 0x4F, 0xC0, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x00, 0xFC, 0xF4, 0x00, 0x00, 0x2F, 0x3D,
-    0x00, 0x00, 0x0B, 0xCF, 0x80, 0x00, 0x03, 0xE3, 0xF0, 0x00, 0x00, 0xF8, 0xBE, 0x00, 0x00, 0xFD,
-    0x1F, 0xFA, 0x5A, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xD0, 0x00, 0x1B, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x07, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78, 0x00,
-    0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01, 0xF8,
-    0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x24,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0xC0, 0x0D, 0x03, 0xF8, 0x03, 0xFC, 0x07, 0x03, 0xF8, 0x00, 0x3F, 0x83, 0xC1, 0xF8, 0x00,
-    0x03, 0xF1, 0xD0, 0xBD, 0x00, 0x00, 0x7D, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0x80, 0x00,
-    0x03, 0xF0, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0x00, 0x2F, 0x00, 0x3E, 0x00, 0x00,
-    0x0F, 0x80, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x02, 0xF8, 0x00, 0x03, 0xF4, 0x00, 0x7F, 0xE9, 0x6B,
-    0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0x40, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
-    0xC0, 0x0B, 0x80, 0x38, 0x02, 0xED, 0x07, 0x40, 0xB0, 0x74, 0xF0, 0x18, 0x00, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0xFF, 0xFD, 0x00,
-    0x3D, 0x01, 0xF0, 0x07, 0x80, 0x07, 0x80, 0xB4, 0x00, 0x3C, 0x0B, 0x40, 0x03, 0xC0, 0xF4, 0x00,
-    0x3C, 0x0B, 0x80, 0x07, 0xC0, 0x7D, 0x01, 0xF8, 0x03, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xD0, 0x00,
-    0x2F, 0xE0, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x3C, 0x00,
-    0x00, 0x06, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x0F, 0xF0,
-    0x03, 0xF8, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0xFC, 0x0B, 0xD0, 0x00, 0x07, 0xD0, 0xFC, 0x00,
-    0x00, 0x3E, 0x0F, 0x80, 0x00, 0x03, 0xF0, 0xF4, 0x00, 0x00, 0x2F, 0x0F, 0x40, 0x00, 0x02, 0xF0,
-    0xF8, 0x00, 0x00, 0x3E, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0xBE, 0x00, 0x00, 0xFD, 0x07, 0xFE, 0x96,
-    0xBF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00,
-    0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x7D, 0x04, 0x00, 0x00, 0x59, 0xB8, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0xB0, 0x74, 0x00, 0x06,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
-    0x80, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0xF4, 0x07, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x2D, 0x00, 0x0F,
-    0x00, 0xB4, 0x00, 0x3C, 0x03, 0xD0, 0x00, 0xF0, 0x0B, 0x80, 0x07, 0xC0, 0x1F, 0x40, 0x7E, 0x00,
-    0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xA4, 0x00,
-    0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x0F, 0xE0,
-    0x00, 0xFE, 0x07, 0xE0, 0x00, 0x0F, 0xC2, 0xF4, 0x00, 0x01, 0xF4, 0xFC, 0x00, 0x00, 0x3E, 0x3E,
-    0x00, 0x00, 0x0F, 0xCF, 0x40, 0x00, 0x02, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF8, 0x00, 0x00, 0x3E,
-    0x3F, 0x00, 0x00, 0x0F, 0x8B, 0xE0, 0x00, 0x0F, 0xD1, 0xFF, 0xA5, 0xAF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x90, 0x00, 0x28,
-    0x00, 0x00, 0xBD, 0x00, 0x02, 0xDB, 0x00, 0x0B, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78,
-    0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x0B, 0x81, 0x80, 0x00, 0x07,
-    0x34, 0x60, 0x00, 0x01, 0xC3, 0x74, 0x00, 0x00, 0x50, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0E, 0x0B, 0x00,
-    0x00, 0x05, 0x00, 0x20, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xF8, 0x03,
-    0xFC, 0x03, 0xF8, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00, 0x7D, 0x3F, 0x00,
-    0x00, 0x0F, 0x8F, 0x80, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF4, 0x00, 0x00, 0x2F, 0x3E,
-    0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE2, 0xF8, 0x00, 0x03, 0xF4, 0x7F, 0xE9, 0x6B, 0xFC,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xC0, 0x0A, 0x70, 0xC0, 0x0D, 0x29, 0xC0, 0x0C,
-    0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0xFE, 0x00, 0x07, 0x43,
-    0x80, 0x08, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0,
-    0x3D, 0x01, 0xF0, 0x78, 0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8,
-    0x00, 0x7C, 0x7D, 0x01, 0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00,
-    0x24, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x03, 0xF8, 0x03, 0xFC, 0x03, 0xF8, 0x00, 0x3F, 0x81, 0xF8, 0x00, 0x03, 0xF0, 0xBD, 0x00, 0x00,
-    0x7D, 0x3F, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x03, 0xF3, 0xD0, 0x00, 0x00, 0xBC, 0xF4, 0x00,
-    0x00, 0x2F, 0x3E, 0x00, 0x00, 0x0F, 0x8F, 0xC0, 0x00, 0x03, 0xE2, 0xF8, 0x00, 0x03, 0xF4, 0x7F,
-    0xE9, 0x6B, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x40,
-    0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0xB8, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0x07, 0x40, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x0F, 0xFF, 0xD0, 0x3D, 0x01, 0xF0, 0x78,
-    0x00, 0x78, 0xB4, 0x00, 0x3C, 0xB4, 0x00, 0x3C, 0xF4, 0x00, 0x3C, 0xB8, 0x00, 0x7C, 0x7D, 0x01,
-    0xF8, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xD0, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x6F, 0xF9, 0x01, 0xC0, 0x0F, 0xFF, 0xFF, 0x0B,
-    0x00, 0xFE, 0x00, 0xFF, 0x74, 0x0F, 0xE0, 0x00, 0xFF, 0x80, 0x7E, 0x00, 0x00, 0xFC, 0x02, 0xF4,
-    0x00, 0x01, 0xF4, 0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0xF4, 0x00, 0x00,
-    0x2F, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x3F, 0x00, 0x00, 0x0F, 0x80,
-    0xBE, 0x00, 0x00, 0xFD, 0x01, 0xFF, 0xA5, 0xAF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x01, 0xBF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x80, 0x2F, 0xE0, 0x24, 0x3F, 0xFF, 0x4C, 0x3D, 0x01, 0xFE, 0x1E, 0x00, 0x1F, 0x0B, 0x40,
-    0x03, 0xC2, 0xD0, 0x00, 0xF0, 0xF4, 0x00, 0x3C, 0x2E, 0x00, 0x1F, 0x07, 0xD0, 0x1F, 0x80, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2E,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0xFF, 0x90, 0x1C, 0x00,
-    0xFF, 0xFF, 0xF0, 0xB0, 0x0F, 0xE0, 0x0F, 0xF7, 0x40, 0xFE, 0x00, 0x0F, 0xF8, 0x07, 0xE0, 0x00,
-    0x0F, 0xC0, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3E, 0x03, 0xE0, 0x00, 0x00, 0xF8,
-    0x0F, 0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xF0,
-    0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0xFA, 0x5A, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1B, 0xFE, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-    0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02,
-    0xFE, 0x02, 0x43, 0xFF, 0xF4, 0xC3, 0xD0, 0x1F, 0xE1, 0xE0, 0x01, 0xF0, 0xB4, 0x00, 0x3C, 0x2D,
-    0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC2, 0xE0, 0x01, 0xF0, 0x7D, 0x01, 0xF8, 0x0F, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x04, 0x34, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0xFE, 0x40,
-    0x70, 0x03, 0xFF, 0xFF, 0xC2, 0xC0, 0x3F, 0x80, 0x3F, 0xDD, 0x03, 0xF8, 0x00, 0x3F, 0xE0, 0x1F,
-    0x80, 0x00, 0x3F, 0x00, 0xBD, 0x00, 0x00, 0x7D, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,
-    0x03, 0xE0, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0xF4, 0x00, 0x00, 0x2F, 0x03, 0xE0, 0x00, 0x00, 0xF8,
-    0x0F, 0xC0, 0x00, 0x03, 0xE0, 0x2F, 0x80, 0x00, 0x3F, 0x40, 0x7F, 0xE9, 0x6B, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xF9,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0xBF, 0x80, 0x90, 0xFF, 0xFD, 0x30, 0xF4, 0x07, 0xF8, 0x78, 0x00,
-    0x7C, 0x2D, 0x00, 0x0F, 0x0B, 0x40, 0x03, 0xC3, 0xD0, 0x00, 0xF0, 0xB8, 0x00, 0x7C, 0x1F, 0x40,
-    0x7E, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x80,
-    0x00, 0x00, 0x36, 0x46, 0x00, 0x00, 0x01, 0xC3, 0x68, 0x00, 0x00, 0x07, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0xFF,
-    0x90, 0x1C, 0x00, 0xFF, 0xFF, 0xF0, 0xB0, 0x0F, 0xE0, 0x0F, 0xF7, 0x40, 0xFE, 0x00, 0x0F, 0xF8,
-    0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x2F, 0x40, 0x00, 0x1F, 0x40, 0xFC, 0x00, 0x00, 0x3E, 0x03, 0xE0,
-    0x00, 0x00, 0xF8, 0x0F, 0x40, 0x00, 0x02, 0xF0, 0x3D, 0x00, 0x00, 0x0B, 0xC0, 0xF8, 0x00, 0x00,
-    0x3E, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x1F, 0xFA, 0x5A, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1B,
-    0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xC0, 0x02, 0x9C, 0x30, 0x00, 0xD2,
-    0x9C, 0x00, 0x30, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x02, 0xFE, 0x02, 0x43, 0xFF, 0xF4, 0xC3, 0xD0, 0x1F, 0xE1, 0xE0, 0x01, 0xF0, 0xB4,
-    0x00, 0x3C, 0x2D, 0x00, 0x0F, 0x0F, 0x40, 0x03, 0xC2, 0xE0, 0x01, 0xF0, 0x7D, 0x01, 0xF8, 0x0F,
-    0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xC0, 0x01, 0xBF, 0xE4, 0x07, 0x00, 0x3F, 0xFF, 0xFC, 0x2C, 0x03, 0xF8, 0x03, 0xFD,
-    0xD0, 0x3F, 0x80, 0x03, 0xFE, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x0B, 0xD0, 0x00, 0x07, 0xD0, 0x3F,
-    0x00, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x00, 0x3E, 0x03, 0xD0, 0x00, 0x00, 0xBC, 0x0F, 0x40, 0x00,
-    0x02, 0xF0, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x3E, 0x02, 0xF8, 0x00, 0x03, 0xF4,
-    0x07, 0xFE, 0x96, 0xBF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00,
-    0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xBF, 0x80, 0x90, 0xFF, 0xFD, 0x30, 0xF4,
-    0x07, 0xF8, 0x78, 0x00, 0x7C, 0x2D, 0x00, 0x0F, 0x0B, 0x40, 0x03, 0xC3, 0xD0, 0x00, 0xF0, 0xB8,
-    0x00, 0x7C, 0x1F, 0x40, 0x7E, 0x03, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x40, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x2F, 0x00, 0x00,
-    0x0F, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B, 0xF3, 0xF4, 0x00,
-    0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F, 0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F,
-    0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00, 0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B,
-    0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02, 0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x03, 0xF4, 0x00,
-    0xF0, 0x00, 0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2D, 0x00, 0x3C, 0xB8, 0x00, 0xF1, 0xE0, 0x03,
-    0xC7, 0x80, 0x0F, 0x5F, 0x00, 0xBD, 0x3F, 0xAF, 0xF4, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x42, 0xFE,
-    0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x00, 0x02, 0xF8, 0x00, 0x05,
-    0x50, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x10, 0xC0, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2A, 0x00, 0x01, 0xA8, 0xFD, 0x00, 0x0B, 0xF3, 0xF4, 0x00, 0x1F, 0xCF, 0xC0, 0x00, 0x7F, 0x3F,
-    0x00, 0x01, 0xFC, 0xFC, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E, 0x3F, 0x00,
-    0x00, 0xF8, 0xBC, 0x00, 0x03, 0xE2, 0xF0, 0x00, 0x0F, 0x8B, 0xC0, 0x00, 0x7D, 0x2F, 0x40, 0x02,
-    0xF4, 0xBF, 0x00, 0x1F, 0xD1, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xD0,
-    0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x34, 0x00, 0x03, 0x40,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0xB4, 0x00,
-    0xF2, 0xD0, 0x03, 0xCB, 0x40, 0x0F, 0x2E, 0x00, 0x3C, 0x78, 0x00, 0xF1, 0xE0, 0x03, 0xD7, 0xC0,
-    0x2F, 0x4F, 0xEB, 0xFD, 0x3F, 0xFF, 0xF4, 0xBF, 0xFF, 0xD0, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0B, 0x2A,
-    0x00, 0x01, 0xAB, 0x8F, 0xD0, 0x00, 0xBF, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0,
-    0x3F, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07,
-    0xE0, 0x3F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00,
-    0x07, 0xD0, 0x2F, 0x40, 0x02, 0xF4, 0x0B, 0xF0, 0x01, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF0, 0x00, 0xF3, 0x2D, 0x00, 0x3E,
-    0xCB, 0x40, 0x0F, 0xC2, 0xD0, 0x03, 0xC0, 0xB8, 0x00, 0xF0, 0x1E, 0x00, 0x3C, 0x07, 0x80, 0x0F,
-    0x41, 0xF0, 0x0B, 0xD0, 0x3F, 0xAF, 0xF4, 0x0F, 0xFF, 0xFD, 0x02, 0xFF, 0xFF, 0x40, 0x2F, 0xE3,
-    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0x0F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2C, 0xA8,
-    0x00, 0x06, 0xAE, 0x3F, 0x40, 0x02, 0xFF, 0x0F, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0,
-    0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F,
-    0x80, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00,
-    0x1F, 0x40, 0xBD, 0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x07, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xCF, 0x00, 0x0F, 0x32, 0xD0, 0x03, 0xEC, 0xB4, 0x00, 0xFC, 0x2D, 0x00, 0x3C,
-    0x0B, 0x80, 0x0F, 0x01, 0xE0, 0x03, 0xC0, 0x78, 0x00, 0xF4, 0x1F, 0x00, 0xBD, 0x03, 0xFA, 0xFF,
-    0x40, 0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x02, 0xFE, 0x3D, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00,
-    0x01, 0x0C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0B, 0x2A, 0x00, 0x01,
-    0xAB, 0x8F, 0xD0, 0x00, 0xBF, 0xC3, 0xF4, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00,
-    0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x07, 0xE0, 0x3F,
-    0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x0F, 0x80, 0xBC, 0x00, 0x07, 0xD0,
-    0x2F, 0x40, 0x02, 0xF4, 0x0B, 0xF0, 0x01, 0xFD, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x0B, 0xFF, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF8,
-    0x00, 0x00, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x33, 0xC0, 0x03, 0xCC, 0xB4, 0x00, 0xFB, 0x2D, 0x00, 0x3F, 0x0B, 0x40,
-    0x0F, 0x02, 0xE0, 0x03, 0xC0, 0x78, 0x00, 0xF0, 0x1E, 0x00, 0x3D, 0x07, 0xC0, 0x2F, 0x40, 0xFE,
-    0xBF, 0xD0, 0x3F, 0xFF, 0xF4, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x2D, 0x05, 0x00,
-    0x00, 0x1C, 0xD2, 0x40, 0x00, 0x0A, 0x1D, 0xD0, 0x00, 0x02, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x2C, 0xA8, 0x00, 0x06, 0xAE, 0x3F, 0x40,
-    0x02, 0xFF, 0x0F, 0xD0, 0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0, 0x3F,
-    0x00, 0x01, 0xFC, 0x0F, 0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xE0,
-    0x2F, 0x00, 0x00, 0xF8, 0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x0B,
-    0xD0, 0x2F, 0xC0, 0x07, 0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF,
-    0xFF, 0x40, 0x01, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0x60, 0x01, 0xCA, 0x24, 0x00, 0xA0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x33, 0xC0, 0x03, 0xCC, 0xB4, 0x00, 0xFB, 0x2D, 0x00, 0x3F, 0x0B, 0x40, 0x0F, 0x02, 0xE0,
-    0x03, 0xC0, 0x78, 0x00, 0xF0, 0x1E, 0x00, 0x3D, 0x07, 0xC0, 0x2F, 0x40, 0xFE, 0xBF, 0xD0, 0x3F,
-    0xFF, 0xF4, 0x0B, 0xFF, 0xFD, 0x00, 0xBF, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x50, 0x00, 0x00, 0x00, 0x2C, 0xA8, 0x00, 0x06, 0xAE, 0x3F, 0x40, 0x02, 0xFF, 0x0F, 0xD0,
-    0x00, 0x7F, 0x03, 0xF0, 0x00, 0x1F, 0xC0, 0xFC, 0x00, 0x07, 0xF0, 0x3F, 0x00, 0x01, 0xFC, 0x0F,
-    0xC0, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x03, 0xE0, 0x2F, 0x00, 0x00, 0xF8,
-    0x0B, 0xC0, 0x00, 0x3E, 0x02, 0xF0, 0x00, 0x1F, 0x40, 0xBD, 0x00, 0x0B, 0xD0, 0x2F, 0xC0, 0x07,
-    0xF4, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x01, 0xFF,
-    0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-    0x07, 0xC0, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xCF, 0x00, 0x0F, 0x32, 0xD0, 0x03, 0xEC, 0xB4, 0x00, 0xFC, 0x2D, 0x00, 0x3C, 0x0B,
-    0x80, 0x0F, 0x01, 0xE0, 0x03, 0xC0, 0x78, 0x00, 0xF4, 0x1F, 0x00, 0xBD, 0x03, 0xFA, 0xFF, 0x40,
-    0xFF, 0xFF, 0xD0, 0x2F, 0xFF, 0xF4, 0x02, 0xFE, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xF4, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00,
-    0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F,
-    0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8,
-    0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0,
-    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0,
-    0x00, 0x0B, 0x40, 0x00, 0x02, 0xE0, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F,
-    0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF,
-    0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00,
-    0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
-    0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xB4, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0x2E,
-    0x00, 0x78, 0x00, 0xF0, 0x0F, 0x40, 0x0B, 0x80, 0xF4, 0x00, 0x7D, 0x1F, 0x00, 0x03, 0xF2, 0xF0,
-    0x00, 0x1F, 0x7E, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x02,
-    0xF8, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xFE, 0x01, 0x43, 0xFF, 0xC0, 0x3D,
-    0x3F, 0xE0, 0x07, 0xE2, 0xA0, 0x00, 0xBF, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x00, 0xD0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC, 0x1F, 0x40, 0x00, 0xF4, 0x0F,
-    0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x1F, 0x80, 0x00,
-    0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00,
-    0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0x00,
-    0xAE, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x3C, 0x3C, 0x00, 0x3C,
-    0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1, 0xF0, 0x03, 0xF2, 0xF0, 0x01,
-    0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x2F, 0x80, 0x00, 0x2F,
-    0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xE0, 0x00, 0x2A, 0x00, 0x00,
-    0x00, 0x2D, 0x06, 0x00, 0x00, 0x73, 0x4A, 0x00, 0x00, 0x60, 0xDD, 0x00, 0x00, 0x90, 0x7C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xBC,
-    0x1F, 0x40, 0x00, 0xF4, 0x0F, 0xC0, 0x02, 0xF0, 0x07, 0xD0, 0x07, 0xD0, 0x03, 0xF0, 0x0F, 0xC0,
-    0x01, 0xF8, 0x1F, 0x80, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xBE, 0xBE, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x90, 0x07, 0x38, 0x90, 0x0A, 0x0F, 0xC0,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x2E, 0x00, 0x78, 0x0F, 0x00, 0xF4, 0x0B, 0x80, 0xF4, 0x07, 0xD1,
-    0xF0, 0x03, 0xF2, 0xF0, 0x01, 0xF7, 0xE0, 0x00, 0xFF, 0xD0, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0,
-    0x00, 0x2F, 0x80, 0x00, 0x2F, 0x40, 0x00, 0x3F, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
-    0xE0, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x24, 0x02, 0x4E, 0x00,
-    0xE3, 0x80, 0x38, 0xE0, 0x0E, 0x38, 0x03, 0x8D, 0x00, 0xE3, 0x40, 0x34, 0xD0, 0x0D, 0x34, 0x03,
-    0x4D, 0x00, 0xD3, 0x40, 0x34, 0xD0, 0x0D, 0x34, 0x03, 0x4C, 0x00, 0xD3, 0x00, 0x31, 0xC0, 0x1C,
-    0x70, 0x07, 0x1C, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x7F, 0xFF, 0xFF,
-    0xFD, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x2F, 0x87, 0xF0, 0xFC, 0x3F, 0x47, 0xE0, 0x2F, 0x8F, 0xD3,
-    0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0xFE, 0x2F, 0x87,
-    0xF0, 0xFC, 0x3F, 0x47, 0xE0, 0xFE, 0x3F, 0x4B, 0xE2, 0xF8, 0x7F, 0x1F, 0xC3, 0xF0, 0xFC, 0x3F,
-    0x4F, 0xC1, 0xF8, 0xBE, 0x2F, 0x8F, 0xE3, 0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x2F,
-    0x8F, 0xD3, 0xF4, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0xBE, 0x2F, 0xC7, 0xF1, 0xFC,
-    0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x2F, 0x4B, 0xD1, 0xF8, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
-    0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x34, 0x00, 0x00, 0x34, 0x00, 0x00,
-    0x34, 0x00, 0x00, 0x38, 0x00, 0x1A, 0xBE, 0xA8, 0x3F, 0xFF, 0xFC, 0x00, 0x38, 0x00, 0x00, 0x38,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
-    0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E,
-    0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0xAB, 0xEA, 0x8B, 0xFF, 0xFF, 0x40, 0x3C, 0x00, 0x00,
-    0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xEE, 0x03,
-    0xFF, 0xFC, 0x1A, 0xBC, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
-    0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0x00, 0xBF, 0xFF, 0xC0, 0x2F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x41, 0xFF,
-    0xFF, 0xE0, 0xBF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFC, 0x00, 0x07, 0x40, 0x7F, 0x47, 0xFD, 0x7F, 0x43, 0x40, 0x00, 0x00, 0x14, 0x7C, 0xBC,
-    0xFD, 0x14, 0x7C, 0xBC, 0xFD, 0x14, 0x00, 0x50, 0x01, 0x47, 0xC0, 0x0F, 0x40, 0x3D, 0xBC, 0x01,
-    0xF8, 0x07, 0xDF, 0xD0, 0x2F, 0x80, 0xBE, 0x01, 0xF7, 0xC0, 0x00, 0x00, 0x07, 0x05, 0x40, 0x03,
-    0x41, 0x20, 0x01, 0xC1, 0x64, 0x00, 0xD0, 0x56, 0x40, 0xB0, 0x0D, 0xC0, 0x74, 0x02, 0xE0, 0x38,
-    0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0,
-    0x00, 0x01, 0xD1, 0x45, 0x00, 0xF2, 0x21, 0x20, 0xB4, 0x99, 0x58, 0x3C, 0x23, 0x26, 0x3D, 0x07,
-    0x8B, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x8F, 0xD3, 0xF0, 0xFC, 0x7E, 0x3F, 0x40, 0x2F, 0x8F, 0xE3,
-    0xF4, 0xFD, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x7E, 0x2F, 0x8F, 0xD3, 0xF4, 0x00, 0x00, 0x00, 0x00,
-    0x06, 0x00, 0xE0, 0x28, 0x0F, 0x41, 0xF0, 0x7C, 0x1E, 0x03, 0xC0, 0xF4, 0x3C, 0x0B, 0x41, 0xE0,
-    0xB0, 0x0D, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x24, 0x1F, 0x02, 0xE0, 0x3C, 0x03, 0x80, 0x00,
-    0x28, 0x1C, 0x03, 0xC3, 0xE0, 0x1F, 0x0F, 0x00, 0xB4, 0x78, 0x02, 0xC1, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x24, 0x0A, 0x01, 0xC0, 0x7C, 0x1F, 0x03, 0xE0, 0x2D, 0x07, 0x80, 0xF0, 0x0F,
-    0x02, 0xC0, 0x78, 0x03, 0x80, 0xA0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x7C, 0x00,
-    0x77, 0xC0, 0xB8, 0x3D, 0x00, 0x10, 0x01, 0xC0, 0x2E, 0x03, 0xD0, 0x3D, 0x00, 0xF4, 0x01, 0xF8,
-    0x01, 0xF8, 0x01, 0xE0, 0x01, 0x40, 0x00, 0x01, 0xC0, 0x03, 0xD0, 0x02, 0xE0, 0x02, 0xE0, 0x0F,
-    0xC0, 0xFC, 0x0F, 0xC0, 0x3C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x00,
-    0xF8, 0x02, 0xA0, 0x03, 0xF0, 0x0F, 0xC0, 0xBD, 0x00, 0x0F, 0xC1, 0xFC, 0x2F, 0x80, 0x00, 0x7F,
-    0x00, 0x0B, 0xF0, 0x00, 0x02, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-    0x3F, 0x9F, 0xD0, 0x00, 0x2F, 0x01, 0xFF, 0xF8, 0x05, 0x03, 0xF0, 0x07, 0xFE, 0x00, 0xF4, 0x3F,
-    0x00, 0x3F, 0xD0, 0x1F, 0x81, 0x50, 0x0F, 0xFF, 0x41, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0x9F, 0xF0, 0x00, 0x00, 0x3F, 0xE0, 0xBF, 0xC0, 0x00, 0x0B, 0xFC, 0x02, 0xFF, 0x00,
-    0x02, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xBF, 0xD0, 0x50, 0x3F, 0xE0, 0x2F, 0xF8, 0x2F, 0x01, 0xFF,
-    0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x3C, 0x03,
-    0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x7C, 0x0B, 0xC0, 0xBC, 0x0B, 0xC0,
-    0xBC, 0x0F, 0xC0, 0x04, 0x00, 0x01, 0xF8, 0x2F, 0xC3, 0xFC, 0x3F, 0xC0, 0x00, 0x24, 0x00, 0x01,
-    0xE0, 0x00, 0x6F, 0xD0, 0x0F, 0xFF, 0xF0, 0xB8, 0x7F, 0xE0, 0x41, 0xE7, 0xC0, 0x0B, 0x8F, 0x80,
-    0x2E, 0x2E, 0x00, 0xB8, 0xF8, 0x02, 0xE3, 0xD0, 0x0F, 0x9F, 0x00, 0x3E, 0xF4, 0x00, 0xFF, 0xC0,
-    0x03, 0xFC, 0x00, 0x2F, 0xC0, 0x00, 0xBE, 0x00, 0x02, 0xF8, 0x00, 0x0B, 0xE0, 0x00, 0x2F, 0x80,
-    0x00, 0x50, 0x00, 0x00, 0x50, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x40, 0x00, 0xFD, 0x00, 0x07, 0xF8,
-    0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x02, 0x8E, 0x01,
-    0xD1, 0xFF, 0xF0, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0x8C, 0x90, 0x00,
-    0x06, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0C, 0xC5, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x24, 0x00,
-    0xC0, 0x22, 0x49, 0xDC, 0xD1, 0xFE, 0x02, 0xE0, 0x07, 0xD0, 0x7E, 0xD3, 0xA6, 0xC8, 0xC5, 0x01,
-    0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0,
-    0x00, 0x00, 0xD0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x34, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1C, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x02, 0xD0, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x1B, 0x90, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF4, 0x2E,
-    0x02, 0xF8, 0x3D, 0x07, 0xF4, 0x10, 0x01, 0xF4, 0x40, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x03,
-    0xC0, 0x00, 0x0B, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF4, 0x00,
-    0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x40, 0x00, 0x7D, 0x00, 0x00, 0xBC, 0x00, 0x07, 0xE0,
-    0x00, 0x0F, 0xD0, 0x01, 0xFE, 0x00, 0x02, 0xFD, 0x00, 0x0B, 0xE0, 0x00, 0x0F, 0xD0, 0x00, 0x2F,
-    0x00, 0x00, 0x3F, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-    0x0B, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x02, 0xE0, 0x00, 0x0B, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x2F, 0x40, 0x00,
-    0x3F, 0x00, 0x00, 0x54, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00,
-    0x3F, 0xFF, 0xC0, 0x00, 0xB4, 0x07, 0xF0, 0x3C, 0x10, 0x01, 0xF4, 0x3C, 0x00, 0x00, 0xF8, 0x3C,
-    0x00, 0x00, 0xB8, 0x3C, 0x00, 0x00, 0xF4, 0x3C, 0x00, 0x00, 0xF0, 0x3C, 0x00, 0x02, 0xE0, 0x7C,
-    0x00, 0x0B, 0xC0, 0x7C, 0x00, 0x2F, 0x40, 0x7C, 0x02, 0xFD, 0x00, 0xBC, 0x02, 0xF4, 0x00, 0xBC,
-    0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xBC, 0x02, 0xF0, 0x00, 0xFC, 0x01, 0x90, 0x00, 0x04,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0xF8, 0x01, 0xF0, 0x02, 0xFC, 0x02, 0xF4, 0x03, 0xFC,
-    0x03, 0xF4, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
-    0x40, 0x00, 0x78, 0x07, 0xF0, 0x02, 0xC4, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x0B, 0xC0, 0x3C, 0x00,
-    0x01, 0xF0, 0x0F, 0x00, 0x00, 0xB8, 0x03, 0xC0, 0x00, 0x3D, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x7C,
-    0x00, 0x1F, 0x40, 0x1F, 0x00, 0x2F, 0x80, 0x07, 0xC0, 0x7F, 0x80, 0x01, 0xF0, 0x1F, 0x80, 0x00,
-    0xBC, 0x07, 0xD0, 0x00, 0x2F, 0x01, 0xF4, 0x00, 0x0B, 0xC0, 0x7D, 0x00, 0x03, 0xF0, 0x19, 0x00,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x1F, 0x80, 0x3D, 0x00, 0x0B, 0xE0, 0x1F,
-    0x80, 0x03, 0xFC, 0x0B, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x74, 0x00, 0x00,
-    0xB0, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xD0, 0x0B, 0x82, 0xC0, 0x0F, 0xC3, 0xC0, 0x0F, 0xC3, 0x80,
-    0x05, 0x4B, 0x40, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2C, 0x00, 0x00,
-    0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF0, 0x50, 0x00, 0xF1, 0xF0, 0x02, 0xE2,
-    0xF0, 0x03, 0xD3, 0xF4, 0x03, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x0B, 0x40, 0x00, 0x0F, 0x00, 0x00,
-    0x1F, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x40,
-    0x00, 0x00, 0x09, 0x83, 0x05, 0x32, 0x23, 0x23, 0x30, 0x63, 0x4E, 0x2F, 0xC0, 0xA4, 0x00, 0x00,
-    0x18, 0x03, 0x80, 0xD8, 0x24, 0xC3, 0xFE, 0x16, 0xD0, 0x1C, 0x01, 0xC0, 0x00, 0x03, 0xA8, 0x30,
-    0x03, 0x00, 0x3F, 0x80, 0x0A, 0x10, 0xA3, 0xFD, 0x1A, 0x00, 0x0B, 0xD2, 0x40, 0x3A, 0x83, 0x8A,
-    0x30, 0x33, 0x4B, 0x1F, 0xD0, 0x10, 0x00, 0x00, 0xBF, 0xC0, 0x07, 0x00, 0x28, 0x00, 0xE0, 0x03,
-    0x40, 0x1C, 0x00, 0xB0, 0x03, 0xC0, 0x0A, 0x80, 0x81, 0x82, 0x4A, 0x03, 0xF0, 0x24, 0xA0, 0xC0,
-    0xC3, 0x4B, 0x07, 0xF4, 0x0E, 0x80, 0xC2, 0x83, 0x03, 0x0D, 0x1C, 0x1F, 0xF0, 0x00, 0xC1, 0x5A,
-    0x0B, 0xF0, 0x24, 0x69, 0x00, 0xFF, 0xFF, 0x03, 0xF4, 0x2E, 0x0F, 0x40, 0x3C, 0x7C, 0x00, 0xF1,
-    0xF0, 0x03, 0xD7, 0xC0, 0x0F, 0x6F, 0x00, 0x3D, 0xBC, 0x00, 0xFA, 0xF0, 0x03, 0xEB, 0xC0, 0x0F,
-    0xBF, 0x00, 0x3E, 0x05, 0x40, 0x24, 0x30, 0x70, 0x18, 0xA2, 0x0C, 0xE3, 0x4C, 0xE2, 0x0C, 0xF0,
-    0x1C, 0xB0, 0x3C, 0x7E, 0xFC, 0x3F, 0xF4, 0x0B, 0xD0, 0x00, 0x02, 0xE0, 0x06, 0x00, 0x60, 0x0A,
-    0x00, 0xA0, 0x0A, 0x03, 0xFD, 0x2A, 0x80, 0x2F, 0x82, 0x0E, 0x00, 0x70, 0x0A, 0x01, 0xD0, 0x78,
-    0x2E, 0x03, 0xFF, 0x15, 0x50, 0x1A, 0x40, 0x09, 0x00, 0x20, 0x09, 0x0F, 0xD0, 0x0A, 0x00, 0xB3,
-    0xFD, 0x15, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7C, 0x03, 0x70, 0x28, 0xC0, 0xFF, 0xC0, 0x1C, 0x00,
-    0x70, 0x00, 0x03, 0xA8, 0x30, 0x03, 0xE4, 0x00, 0xC0, 0x0D, 0x3A, 0xD3, 0xF4, 0x0B, 0xD0, 0x90,
-    0x03, 0xB8, 0x0E, 0x28, 0x30, 0x30, 0xD1, 0xC1, 0xFD, 0x00, 0x40, 0x3F, 0xA0, 0x06, 0x00, 0xA0,
-    0x0D, 0x00, 0xD0, 0x1C, 0x02, 0xC0, 0x3C, 0x00, 0x00, 0x05, 0x40, 0x62, 0x82, 0x03, 0x0A, 0x28,
-    0x0F, 0xC0, 0xD1, 0xC3, 0x47, 0x07, 0xF4, 0x00, 0x00, 0x06, 0x40, 0x92, 0x43, 0x07, 0x0C, 0x0C,
-    0x34, 0x70, 0x7F, 0xC0, 0x07, 0x0B, 0xF4, 0x05, 0x00, 0x00, 0xA0, 0x07, 0x40, 0x3C, 0x01, 0xD0,
-    0x0F, 0x00, 0x38, 0x02, 0xD0, 0x0F, 0x00, 0x38, 0x01, 0xD0, 0x0B, 0x40, 0x3C, 0x00, 0xF0, 0x03,
-    0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xB4, 0x02, 0xD0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0xF4, 0x01,
-    0xE0, 0x03, 0xC0, 0x0F, 0x40, 0x1F, 0x00, 0x3D, 0x00, 0xBC, 0x28, 0x00, 0x74, 0x00, 0xF0, 0x01,
-    0xD0, 0x03, 0xC0, 0x0B, 0x40, 0x0E, 0x00, 0x3C, 0x00, 0xB4, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00,
-    0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x0B, 0x80, 0x2D, 0x00, 0xF0, 0x07,
-    0xC0, 0x2E, 0x00, 0xF4, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xC3, 0xC0, 0x00, 0x1E, 0x0E, 0x00, 0x00, 0xB0, 0x74, 0x00, 0x03, 0xC2, 0xC0, 0x00, 0x0F,
-    0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x3F, 0xE6, 0xE4, 0x02, 0xFF, 0x0B, 0x00, 0x1F, 0xF8, 0x3C,
-    0x00, 0xFD, 0xD1, 0xE0, 0x07, 0xDB, 0x0B, 0x40, 0x2F, 0x3C, 0x3C, 0x00, 0xFC, 0xE0, 0xF0, 0x03,
-    0xF7, 0x47, 0x80, 0x0F, 0xFC, 0x2C, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0xFF, 0xC3, 0x80, 0x02, 0xFF,
-    0xFF, 0xAF, 0x03, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xC0, 0xBA, 0xFF,
-    0xF9, 0x03, 0xC2, 0xC0, 0x00, 0x0E, 0x0F, 0x00, 0x00, 0x74, 0x38, 0x00, 0x02, 0xC1, 0xD0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFE, 0x00, 0x2F, 0xFF, 0xF0, 0x0F,
-    0xF9, 0x59, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF4, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x03, 0xF0, 0x02, 0x59, 0x3F, 0x00, 0x3F, 0xE3, 0xF0, 0x03, 0xD0, 0x3F, 0x80,
-    0x38, 0x03, 0xFE, 0x03, 0x80, 0x2F, 0xFF, 0xBF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xF0,
-    0x2F, 0xFF, 0xFF, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x2F, 0xE0, 0x00, 0x2F, 0xFF, 0xD0, 0x0B, 0xD0, 0x0B, 0x00, 0xB4, 0x00, 0x00, 0x0B,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xE0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7C, 0x00, 0x00, 0x0B,
-    0xC0, 0x00, 0x02, 0xF4, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x43, 0xFF, 0xFF, 0xFC,
-    0x00, 0x50, 0x00, 0x0F, 0x40, 0x03, 0xF8, 0x00, 0x1F, 0x40, 0x03, 0xFC, 0x00, 0x1F, 0x40, 0x03,
-    0xFE, 0x00, 0x1F, 0x40, 0x03, 0xFF, 0x00, 0x2F, 0x00, 0x03, 0xFF, 0x40, 0x2F, 0x00, 0x03, 0xEF,
-    0xC0, 0x2F, 0x00, 0x07, 0xE7, 0xD0, 0x3F, 0x00, 0x07, 0xE3, 0xF0, 0x3F, 0x00, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0B, 0xE0, 0xBD, 0x3F, 0x00, 0x0B, 0xE0, 0x3E, 0x3F,
-    0x00, 0x0B, 0xE0, 0x2F, 0x7F, 0x00, 0x0F, 0xE0, 0x0F, 0xFE, 0x00, 0x0F, 0xE0, 0x0B, 0xFE, 0x00,
-    0x0F, 0xF0, 0x07, 0xFE, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x01, 0xFF,
-    0xFF, 0xC0, 0x01, 0xF0, 0x07, 0xF0, 0x01, 0xF0, 0x00, 0xF0, 0xBF, 0xFF, 0xFF, 0xFE, 0x57, 0xF5,
-    0x56, 0xF9, 0x02, 0xF0, 0x06, 0xF0, 0x02, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x80, 0x03, 0xFA,
-    0x94, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x03, 0xF4,
-    0x00, 0x00, 0x3F, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x00, 0xF0, 0x00,
-    0x00, 0x00, 0xC0, 0x1D, 0x00, 0x00, 0x00, 0x30, 0x03, 0x80, 0x00, 0x00, 0x1C, 0x00, 0xE0, 0x00,
-    0x00, 0x07, 0x01, 0xF4, 0x00, 0x2F, 0x81, 0xFF, 0xFC, 0x00, 0x3E, 0xA0, 0x7F, 0xFD, 0x00, 0x1C,
-    0x00, 0x1F, 0xFF, 0x40, 0x07, 0x00, 0x0B, 0xE5, 0xF0, 0x00, 0xF4, 0x02, 0xF0, 0x2E, 0x00, 0x2F,
-    0xD0, 0xBC, 0x07, 0xC0, 0x01, 0xFD, 0x2F, 0x01, 0xF0, 0x00, 0x07, 0xCB, 0xC0, 0x7C, 0x00, 0x40,
-    0xF3, 0xF0, 0x1F, 0x40, 0x7F, 0xFC, 0xFC, 0x07, 0xE0, 0x3F, 0xFF, 0x3F, 0x01, 0xFC, 0x07, 0xFE,
-    0x00, 0x2C, 0x00, 0x00, 0x34, 0x1C, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x00, 0xB0, 0x0E, 0x00, 0x00,
-    0xB0, 0x0E, 0x00, 0x00, 0xF0, 0x0F, 0x03, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-    0xFD, 0x0B, 0x0F, 0xE2, 0xD0, 0x07, 0x4F, 0xF2, 0xC0, 0x07, 0x9E, 0xF3, 0xC0, 0x03, 0xBD, 0xB7,
-    0xC0, 0x03, 0xFC, 0x7F, 0x80, 0x03, 0xFC, 0x3F, 0x80, 0x02, 0xF8, 0x3F, 0x40, 0x02, 0xF4, 0x2F,
-    0x00, 0x01, 0xF0, 0x1F, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0xA5, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0x40,
-    0x05, 0xFF, 0xAF, 0xE0, 0x0F, 0xF8, 0x00, 0xF4, 0x0F, 0xF4, 0x00, 0x3C, 0x0F, 0xF4, 0x00, 0x3C,
-    0x0F, 0xF4, 0x24, 0x2C, 0x0F, 0xF0, 0x3C, 0x2C, 0x0F, 0xF0, 0x3C, 0x2C, 0x0F, 0xF0, 0x3C, 0x2C,
-    0x0F, 0xF0, 0x3C, 0x00, 0x0F, 0xF0, 0x2C, 0x00, 0x0F, 0xF0, 0x1F, 0x00, 0x1F, 0xF0, 0x0B, 0xE5,
-    0x7F, 0x60, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x16, 0xBF, 0x00, 0x00, 0x18, 0x00, 0x00, 0x02, 0xC0,
-    0x00, 0x06, 0xBE, 0x90, 0x00, 0xBF, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xF3, 0x80, 0x01, 0xFF,
-    0xF8, 0x00, 0x38, 0x1F, 0x80, 0x0B, 0x00, 0xB8, 0x00, 0xE0, 0x0B, 0x80, 0x0F, 0x00, 0xB8, 0x00,
-    0xF4, 0x1F, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x69, 0x14, 0x07, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x01,
-    0xFC, 0x01, 0x00, 0xBC, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x57, 0xEA, 0x80, 0x00,
-    0xF0, 0x00, 0x05, 0xBF, 0xF8, 0x03, 0xFF, 0xA9, 0x00, 0x03, 0xD0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x2F, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xBF, 0xF0,
-    0x00, 0x00, 0x00, 0x15, 0x55, 0x55, 0x54, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF, 0xFF, 0xFD, 0x10,
-    0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD2, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00,
-    0x1B, 0xF9, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xE7, 0xE7, 0x40, 0x00, 0x07, 0xFF, 0x40, 0x00,
-    0x1F, 0xF4, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x97, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-    0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x40, 0x00,
-    0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7C, 0x01, 0xBC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xBC, 0x00,
-    0x3D, 0x06, 0xAF, 0xEA, 0xAB, 0xFA, 0x00, 0xBC, 0x01, 0xFC, 0x00, 0x0B, 0xFF, 0xFF, 0x80, 0x00,
-    0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xEA, 0x50, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x0F,
-    0xD0, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
-    0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1A, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFF, 0xFD, 0x00, 0xBF, 0x97, 0x01, 0x00, 0x3F, 0x41, 0xC0, 0x00, 0x2F, 0x80,
-    0x70, 0x00, 0x0F, 0xD0, 0x1C, 0x00, 0x03, 0xF0, 0x07, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x00, 0x3F,
-    0x00, 0x70, 0x00, 0x0F, 0xC0, 0x1F, 0xFA, 0x43, 0xF0, 0x07, 0xBF, 0xF8, 0xFC, 0x01, 0xC0, 0xBE,
-    0x2F, 0x80, 0x70, 0x2D, 0x07, 0xF8, 0x1C, 0x0F, 0x40, 0xFF, 0xFF, 0xFF, 0xE0, 0x2F, 0xFF, 0xFF,
-    0xF8, 0x02, 0xFF, 0xFF, 0xFD, 0x00, 0x0B, 0xFF, 0xE4, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02,
-    0xC0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-    0x00, 0x0E, 0xAB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-    0x00, 0x03, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x01, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x7F, 0xE0, 0x2F, 0xFF, 0x03, 0xEB,
-    0x00, 0xBC, 0xB0, 0x0B, 0x4B, 0x00, 0xF4, 0xB0, 0x0F, 0x4B, 0x00, 0xB8, 0x70, 0x0B, 0xD7, 0x00,
-    0x3F, 0xFA, 0x01, 0xFF, 0xF8, 0x06, 0xFF, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x3F, 0xFF,
-    0xFF, 0xFD, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x03,
-    0xD0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07,
-    0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x0B,
-    0xF0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x15, 0x55, 0x57, 0xFF, 0xFF, 0x00, 0xB0, 0x00, 0x03, 0x80,
-    0x15, 0x7D, 0x53, 0xFF, 0xFF, 0x00, 0x78, 0x01, 0x6F, 0x40, 0x7F, 0xD0, 0x07, 0xFE, 0x00, 0x01,
-    0xF4, 0x00, 0x07, 0xC0, 0x00, 0x3D, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00,
-    0x00, 0x02, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC1, 0x80, 0x03, 0xEF, 0xC0, 0x0B, 0xFD, 0x00,
-    0x7F, 0xC0, 0x00, 0x67, 0xC6, 0xC0, 0x03, 0xFF, 0x80, 0x1B, 0xF8, 0x00, 0x7F, 0xC0, 0x0D, 0x63,
-    0xC0, 0x3C, 0x03, 0xC1, 0xF4, 0x03, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-    0x00, 0x00, 0x0B, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x02, 0xFF,
-    0x7E, 0x00, 0xF5, 0xC3, 0xC0, 0x3C, 0x70, 0xF0, 0x1E, 0x1C, 0x2C, 0x07, 0x47, 0x07, 0x01, 0xD1,
-    0xC1, 0xC0, 0x74, 0x70, 0x70, 0x1D, 0x1C, 0x1C, 0x03, 0x43, 0x07, 0x00, 0xE0, 0xC2, 0xC0, 0x38,
-    0x34, 0xB0, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xF0, 0x07, 0xF0, 0x00,
-    0x7C, 0x00, 0x3C, 0x00, 0x2F, 0x00, 0x0F, 0x40, 0x0B, 0xC0, 0x03, 0xC0, 0x02, 0xF0, 0x07, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xEA, 0x50, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xFF, 0xD0, 0x00, 0x03, 0xF0,
-    0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x0F, 0xD0, 0x00, 0x00, 0x00,
-    0x08, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x80, 0x00,
-    0x00, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC3, 0xFA, 0xAA, 0xA8, 0x0F, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0xFF, 0x40, 0x07, 0xCF, 0x2E, 0x02, 0xE0,
-    0xF0, 0xB8, 0x38, 0x0F, 0x01, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0,
-    0x7F, 0xFF, 0xFF, 0x82, 0xAA, 0xAA, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-    0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xF0, 0x00,
-    0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x10, 0x0F,
-    0x00, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x4F, 0x0F, 0x40, 0x3D, 0xF7, 0xC0, 0x00, 0xFF, 0xF0, 0x00,
-    0x02, 0xF8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xE0, 0x03, 0x40, 0x03,
-    0xC0, 0x01, 0xD0, 0x0B, 0x00, 0x00, 0x70, 0x2D, 0x55, 0x55, 0x7C, 0x3F, 0xFF, 0xFF, 0xFE, 0x1D,
-    0x00, 0x00, 0x3C, 0x0B, 0x00, 0x00, 0xB0, 0x02, 0xC0, 0x02, 0xC0, 0x00, 0xA0, 0x03, 0x40, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xFF, 0x00, 0x0B, 0x6A, 0xD0, 0x2C,
-    0x28, 0x74, 0x20, 0x28, 0x14, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28, 0x00, 0x00, 0x28,
-    0x00, 0x20, 0x28, 0x00, 0x3C, 0x28, 0x38, 0x0F, 0x68, 0xE0, 0x02, 0xFF, 0x80, 0x00, 0xBD, 0x00,
-    0x00, 0x14, 0x00, 0x16, 0xAF, 0xE0, 0xFF, 0xFA, 0x43, 0xF4, 0x00, 0x0E, 0xF4, 0x00, 0x34, 0xF4,
-    0x00, 0xD0, 0xF4, 0x03, 0x40, 0xF4, 0x1D, 0x00, 0xF4, 0x20, 0x00, 0xF4, 0x00, 0x00, 0x80, 0x1F,
-    0xEA, 0x50, 0x2B, 0xFF, 0xC0, 0x00, 0x3F, 0x00, 0x03, 0xEC, 0x00, 0x3D, 0x34, 0x03, 0xD0, 0xD0,
-    0x3D, 0x03, 0x43, 0xD0, 0x0E, 0x3D, 0x00, 0x24, 0x90, 0x00, 0x00, 0x24, 0x00, 0x00, 0xF0, 0x00,
-    0x40, 0xF0, 0x03, 0x41, 0xF0, 0x0D, 0x01, 0xE0, 0x70, 0x02, 0xE2, 0xC0, 0x02, 0xDB, 0x00, 0x03,
-    0xF8, 0x1A, 0xAB, 0xE0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x03, 0xC3,
-    0x40, 0x2D, 0x0D, 0x02, 0xE0, 0x38, 0x1E, 0x00, 0xF1, 0xF0, 0x02, 0xCF, 0x00, 0x07, 0xF0, 0x00,
-    0x1F, 0xAA, 0x90, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFC, 0x3C, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x02, 0xE0, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
-    0x00, 0x00, 0x07, 0x47, 0x00, 0x00, 0x03, 0xD1, 0xF0, 0x00, 0x03, 0xF4, 0x7F, 0x00, 0x03, 0xDD,
-    0x1C, 0xF0, 0x03, 0xD3, 0x47, 0x0F, 0x03, 0xD0, 0xD1, 0xC0, 0xF0, 0xD0, 0x34, 0x70, 0x04, 0x00,
-    0x0D, 0x1C, 0x00, 0x00, 0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x34, 0x70, 0x00,
-    0x00, 0x0D, 0x1C, 0x00, 0x00, 0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x00, 0x14,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x03,
-    0xC0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF4, 0x7F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x18, 0x00, 0x00, 0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x00, 0x34,
-    0x70, 0x00, 0x00, 0x0D, 0x1C, 0x00, 0x00, 0x03, 0x47, 0x00, 0x00, 0x00, 0xD1, 0xC0, 0x00, 0x40,
-    0x34, 0x70, 0x00, 0x3C, 0x0D, 0x1C, 0x0B, 0x07, 0xC3, 0x47, 0x0B, 0x40, 0x7C, 0xD1, 0xCB, 0x40,
-    0x07, 0xF4, 0x7B, 0x40, 0x00, 0xBD, 0x1F, 0x40, 0x00, 0x0B, 0x47, 0x40, 0x00, 0x00, 0x91, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x03, 0x80, 0x2D, 0x00, 0x00, 0xB4,
-    0x00, 0xF0, 0x00, 0x1D, 0x00, 0x07, 0x80, 0x03, 0x80, 0x00, 0x2D, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
-    0x3C, 0x00, 0x00, 0x03, 0xC2, 0xE0, 0x00, 0x00, 0x78, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x2E, 0x00,
-    0x0B, 0xC0, 0x00, 0xF8, 0x01, 0xF0, 0x00, 0x03, 0x80, 0x1D, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00,
-    0x00, 0x09, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0xB7, 0xD0, 0x00, 0x3E, 0x1F, 0x80, 0x2F, 0xD1,
-    0x9F, 0x42, 0xD9, 0x18, 0x3C, 0x00, 0x91, 0x80, 0x00, 0x09, 0x18, 0x00, 0x00, 0x91, 0x80, 0x00,
-    0x09, 0x18, 0x00, 0x00, 0x91, 0x80, 0x02, 0xD9, 0x18, 0x7C, 0x1F, 0xD1, 0xAF, 0x40, 0x3E, 0x1F,
-    0x80, 0x00, 0xBB, 0xD0, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-    0x01, 0xF8, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x64,
-    0x0E, 0x0B, 0xFF, 0x4D, 0x1F, 0x43, 0xDC, 0x3D, 0x00, 0xFC, 0x3C, 0x00, 0xBC, 0x7C, 0x00, 0x78,
-    0x3C, 0x00, 0x74, 0x3E, 0x00, 0xF0, 0x2F, 0xEF, 0xE0, 0x0F, 0xFF, 0xC0, 0x02, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xE4, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xC3, 0xC0, 0x03,
-    0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0xBD,
-    0x00, 0x03, 0xFD, 0x00, 0x3F, 0x00, 0x07, 0xCF, 0x80, 0x0F, 0x80, 0x07, 0xC3, 0xE0, 0x03, 0xD0,
-    0x07, 0xC0, 0xBC, 0x00, 0xF4, 0x07, 0x80, 0x2F, 0x00, 0x3E, 0x07, 0x80, 0x0F, 0x80, 0x0F, 0xC7,
-    0x80, 0x03, 0xE0, 0x02, 0xFF, 0x80, 0x03, 0xF4, 0x00, 0x7F, 0xE5, 0x6B, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0x5F, 0xFF, 0xFF, 0x40, 0x07, 0x40, 0x6F,
-    0xF9, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD0, 0x00,
-    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x3E, 0xB8, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-    0x00, 0xF8, 0x3E, 0x00, 0x01, 0xF4, 0x2F, 0x00, 0x03, 0xF0, 0x0F, 0x80, 0x03, 0xD0, 0x0B, 0xC0,
-    0x0B, 0xC0, 0x07, 0xE0, 0x0F, 0x80, 0x03, 0xF0, 0x2F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0x55, 0x55, 0x5F, 0xFF, 0xFF, 0xE0, 0xB8,
-    0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E,
-    0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B,
-    0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x06, 0x40, 0x28, 0x02, 0xE0, 0x0F, 0x00,
-    0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0,
-    0x2E, 0x00, 0xF0, 0x0B, 0x80, 0x3C, 0x02, 0xE0, 0x0F, 0x00, 0xB8, 0x03, 0xC0, 0x2E, 0x00, 0xF0,
-    0x0B, 0x80, 0x3C, 0x07, 0xF5, 0x6F, 0x57, 0xFF, 0xFF, 0xF8, 0x15, 0x55, 0x57, 0xFF, 0xFF, 0x38,
-    0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0D, 0x00, 0x00, 0x34, 0x00, 0x00, 0xC0, 0x00, 0x2C,
-    0x00, 0x0B, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3D, 0x55, 0x47, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x05, 0x6A, 0x93, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
-    0x00, 0x3D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x20, 0x1F, 0x40,
-    0x00, 0x0F, 0x0F, 0xC0, 0x00, 0x02, 0xF7, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0B, 0xFD,
-    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xB8, 0x06, 0xE0, 0x03, 0xFF, 0xD3, 0xFF, 0x02,
-    0xE0, 0x3E, 0xD0, 0xB0, 0xF0, 0x03, 0xD0, 0x0C, 0x34, 0x00, 0xF0, 0x03, 0x5D, 0x00, 0x2C, 0x00,
-    0xD3, 0x40, 0x0F, 0x80, 0xB0, 0xF0, 0x0B, 0xFF, 0xFC, 0x2F, 0xFF, 0xAF, 0xFD, 0x03, 0xFF, 0xC2,
-    0xFD, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00,
-    0x00, 0x02, 0xF0, 0x40, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0xB4,
-    0x00, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
-    0x01, 0xF0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x3D, 0x00,
-    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x7C, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x24, 0x2F, 0x40, 0x00,
-    0x2F, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x05, 0x40,
-    0x00, 0x00, 0x0A, 0x07, 0xD2, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 0xF4,
-    0xBE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x09, 0x3C, 0x74, 0x0E, 0x78, 0x1E, 0x1D, 0x74,
-    0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x09, 0x3C, 0x3D, 0x0D, 0x74, 0x0B,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x1C, 0x00, 0x00,
-    0x03, 0x40, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x1E, 0xA0, 0x3F, 0xFF, 0xFF, 0xC6, 0xA5, 0xB0, 0x00,
-    0x00, 0x0E, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x16, 0xBD, 0xAA, 0x47, 0xFF, 0xFF, 0xF8, 0x02, 0xD0,
-    0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x7F, 0x80, 0x00,
-    0x0B, 0xF8, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F,
-    0xE4, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x01, 0xBF, 0xF0, 0x00,
-    0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA5, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xA4, 0x00,
-    0x00, 0x5A, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x07, 0x90, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, 0x00,
-    0x6F, 0xE0, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x2F, 0xE4, 0x00, 0x00, 0x02, 0xFC, 0x00,
-    0x00, 0x1B, 0xFC, 0x00, 0x07, 0xFF, 0xF4, 0x06, 0xFF, 0xF9, 0x00, 0x0F, 0xFE, 0x40, 0x00, 0x0F,
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xF4, 0x1A, 0xFF, 0xFF, 0xE4, 0x3E,
-    0xA5, 0x00, 0x00,
+static const uint8_t opendyslexic_10_regularBitmaps[27362] = {
+    0x39, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x29, 0xD2, 0x9D, 0x29, 0xD2, 0xAD, 0x2A, 0xD2, 0xAD,
+    0x2A, 0xD2, 0xE4, 0x97, 0x9D, 0xA1, 0xAE, 0x1F, 0x1F, 0x00, 0x0A, 0xDA, 0x09, 0xE1, 0xE9, 0x09,
+    0xE1, 0xE9, 0x09, 0xE1, 0xE1, 0x9D, 0x91, 0xE1, 0x9D, 0xA1, 0xE1, 0xAD, 0xA0, 0x6D, 0x3A, 0xC7,
+    0x5D, 0x3A, 0xC7, 0x5D, 0x3D, 0x74, 0x9C, 0xA3, 0xD7, 0x49, 0xCA, 0x3D, 0x79, 0xFF, 0xFF, 0xE1,
+    0xAF, 0xFF, 0xFD, 0x96, 0xD9, 0x2A, 0xCA, 0x74, 0xD9, 0x2A, 0xCA, 0x74, 0xD3, 0xD9, 0x73, 0x9D,
+    0x3D, 0x97, 0x39, 0xD3, 0xD9, 0x7F, 0xFF, 0xFE, 0x91, 0xFF, 0xFF, 0xE6, 0xE2, 0x9D, 0x74, 0xDA,
+    0x2A, 0xD7, 0x4D, 0xA2, 0xAD, 0x73, 0x9D, 0x92, 0xDA, 0x77, 0x75, 0x59, 0xC1, 0xC7, 0x3A, 0xC1,
+    0xC9, 0x71, 0xAF, 0xEA, 0x59, 0xFF, 0xCA, 0x5F, 0xC9, 0xAC, 0x99, 0x94, 0xAD, 0xAA, 0xC1, 0xC9,
+    0x6E, 0x09, 0xC1, 0xC9, 0x6E, 0x09, 0xC1, 0xC9, 0x6A, 0xEA, 0xC1, 0xC9, 0x7F, 0xFA, 0x70, 0xAF,
+    0xFA, 0x70, 0xAC, 0xAF, 0xD9, 0x69, 0xC1, 0xFD, 0x95, 0x9C, 0x1C, 0x9F, 0xA5, 0x9C, 0x1C, 0xAF,
+    0xC1, 0xFF, 0xFD, 0xA0, 0xAF, 0xFF, 0xD0, 0x9F, 0xFF, 0xD2, 0x9A, 0xFF, 0xCA, 0x97, 0x09, 0xC1,
+    0xC9, 0x72, 0x9C, 0x1C, 0x97, 0x75, 0x72, 0x9C, 0x73, 0xC9, 0x2A, 0xDA, 0x3A, 0xC2, 0xAA, 0x1A,
+    0xA2, 0xC9, 0x2C, 0x3C, 0x1D, 0x3C, 0x3C, 0x09, 0xC4, 0xC2, 0x9C, 0x0C, 0xA4, 0xAF, 0xAA, 0xC6,
+    0xAD, 0xA9, 0xCA, 0x72, 0xD9, 0xE9, 0x59, 0xCA, 0xC1, 0x9C, 0x5D, 0xAA, 0x2A, 0xA3, 0xAC, 0x0A,
+    0x92, 0xAA, 0x29, 0xCA, 0x0A, 0xA2, 0xCA, 0x2D, 0x2F, 0xC2, 0x9C, 0xA2, 0x9E, 0x3A, 0xC7, 0x10,
+    0x77, 0x2A, 0xFA, 0x70, 0xDA, 0xAA, 0xE6, 0xAC, 0xA3, 0xAC, 0x95, 0xD9, 0x3D, 0x95, 0xAD, 0x29,
+    0xD7, 0xE0, 0xAD, 0x97, 0x0F, 0xC7, 0x2F, 0x72, 0xFD, 0x70, 0xAD, 0xA0, 0x9D, 0x39, 0xA9, 0x0E,
+    0x29, 0xD9, 0x1D, 0x99, 0xE4, 0xD9, 0xAD, 0x09, 0xE5, 0xFA, 0x1E, 0xA3, 0x9F, 0x2A, 0xFF, 0xFA,
+    0x2A, 0xFF, 0xA0, 0x9A, 0x39, 0xAF, 0xA7, 0x75, 0x0E, 0xA0, 0xE9, 0x0E, 0x1E, 0x1E, 0x1E, 0x00,
+    0x3A, 0xA3, 0x9C, 0x93, 0xD3, 0x9C, 0x93, 0xD4, 0xCA, 0x3A, 0xC9, 0x3D, 0x4C, 0xA3, 0x9C, 0x93,
+    0xAC, 0x93, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xAC, 0x93, 0xAC, 0x93, 0x9C, 0xA4, 0xD4, 0xD4, 0xD9,
+    0x39, 0xCA, 0x4D, 0x4D, 0x93, 0x9D, 0x4D, 0x93, 0xAD, 0x00, 0x0A, 0xA4, 0x9C, 0x94, 0xD4, 0x9C,
+    0x94, 0xD4, 0xAC, 0x94, 0xCA, 0x4D, 0x4A, 0xC9, 0x39, 0xCA, 0x39, 0xCA, 0x4D, 0x4D, 0x4D, 0x4D,
+    0x4D, 0x4D, 0x39, 0xCA, 0x3A, 0xCA, 0x3A, 0xC9, 0x3D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x29, 0xD3,
+    0xDA, 0x29, 0xD3, 0xDA, 0x20, 0x49, 0x70, 0x9C, 0x59, 0x2C, 0x2C, 0x1D, 0xA0, 0xC0, 0xAC, 0xA2,
+    0x9F, 0xA6, 0xE9, 0x4A, 0xCA, 0xCA, 0xDA, 0x1D, 0x90, 0xC9, 0x0A, 0xC5, 0xC9, 0x70, 0xC9, 0x30,
+    0x4A, 0x97, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA4, 0xAA, 0xAA, 0xDA, 0xAA, 0x09, 0xFF, 0xC5, 0xCA,
+    0x70, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x30, 0x0A, 0xDA, 0x0E, 0x90, 0xE1, 0xE0, 0x9D, 0xA0, 0xE9,
+    0x00, 0x71, 0x9F, 0xFC, 0x9F, 0xFC, 0x09, 0x90, 0x9D, 0x0A, 0xD0, 0xE9, 0x77, 0x59, 0x97, 0x09,
+    0xC7, 0x1A, 0xC7, 0x1C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x1C, 0xA7, 0x0A, 0xC9, 0x70,
+    0xD7, 0x1C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x71, 0xD7, 0x09, 0xCA, 0x70, 0xAC, 0x97, 0x0D, 0x71,
+    0xD7, 0x0A, 0xCA, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD7, 0x09, 0xD7, 0x0A,
+    0xCA, 0x70, 0xD9, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD9, 0x70, 0xC9, 0x70, 0x97, 0x20, 0x3A, 0xAA,
+    0xA6, 0xCA, 0x1A, 0xC4, 0xCA, 0x3A, 0xC2, 0xAC, 0x5C, 0x91, 0xD5, 0xCA, 0x1D, 0x1D, 0x1D, 0x1D,
+    0x1D, 0x1D, 0x09, 0xD1, 0xD1, 0xD0, 0x9D, 0x1A, 0xA1, 0xD1, 0xD4, 0x9D, 0x1D, 0x93, 0xAD, 0x1E,
+    0x29, 0xE1, 0xAF, 0xF9, 0x2F, 0xF3, 0x9F, 0xD9, 0x49, 0xEA, 0x30, 0x73, 0x9E, 0x49, 0xF4, 0x9A,
+    0x0D, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD3, 0x9F, 0xF9, 0x9F,
+    0xF9, 0x9F, 0xF9, 0x29, 0xAA, 0xA9, 0x3F, 0xF2, 0xCA, 0x91, 0x9D, 0xA7, 0x0D, 0x70, 0xD9, 0x7D,
+    0x97, 0xD7, 0xE6, 0xAD, 0x95, 0xAE, 0x49, 0xF4, 0xAF, 0x4A, 0xF5, 0xFF, 0xC9, 0x0F, 0xFC, 0xA9,
+    0xFF, 0xCA, 0x1A, 0xFA, 0x3A, 0xAA, 0x99, 0xAD, 0x97, 0x0A, 0xC7, 0x09, 0xC7, 0x09, 0xC7, 0x0D,
+    0x39, 0xAA, 0xAD, 0x4F, 0xC9, 0x79, 0xE7, 0x0D, 0x97, 0xAC, 0xA7, 0xAC, 0xA0, 0x99, 0x3A, 0xD9,
+    0x0F, 0xFC, 0x1F, 0xF9, 0x19, 0xAF, 0xA2, 0x77, 0x19, 0xC9, 0x70, 0xD9, 0x7A, 0xDA, 0x69, 0xCA,
+    0xCA, 0x6D, 0x0C, 0xA5, 0xD9, 0x0D, 0x4A, 0xCA, 0x1D, 0x39, 0xD2, 0xD3, 0xDA, 0x09, 0x9D, 0x99,
+    0x09, 0xFF, 0xD1, 0xCA, 0xAA, 0xAF, 0xA6, 0x9D, 0x97, 0xAD, 0x97, 0xAD, 0x97, 0xAD, 0xA1, 0x09,
+    0x99, 0x99, 0x99, 0x92, 0xFF, 0x91, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xDA, 0xAA, 0x94, 0xFE,
+    0xA2, 0x94, 0xAD, 0x70, 0xD9, 0x7D, 0x97, 0xD9, 0x0A, 0xA9, 0x19, 0xE1, 0xFF, 0xC1, 0xFF, 0x2A,
+    0xFA, 0x92, 0x49, 0xAA, 0xAA, 0x49, 0xFD, 0x3A, 0xCA, 0x70, 0xCA, 0x70, 0xAC, 0x71, 0xD0, 0x99,
+    0xA9, 0x4F, 0xF9, 0x19, 0xEA, 0x19, 0xD1, 0x9D, 0xA3, 0x9D, 0x1D, 0x5D, 0x1D, 0x5D, 0x1D, 0x94,
+    0xD1, 0xAD, 0x3A, 0xD2, 0xFF, 0x92, 0x9F, 0xDA, 0x49, 0xF9, 0x20, 0x72, 0x9F, 0xFC, 0x90, 0x99,
+    0x9A, 0xAA, 0xAD, 0x70, 0xD7, 0x0D, 0x7A, 0xCA, 0x7D, 0xA7, 0xD9, 0x69, 0xD9, 0x6A, 0xD7, 0xE7,
+    0xE6, 0x9D, 0xA6, 0xEA, 0x6E, 0x95, 0x9E, 0x20, 0x29, 0xAE, 0x94, 0xAC, 0x91, 0x9D, 0x3C, 0xA3,
+    0x9C, 0x91, 0x9C, 0x94, 0xCA, 0x1A, 0xC9, 0x4C, 0xA1, 0x9C, 0xA3, 0xAC, 0xA2, 0xDA, 0x19, 0xD4,
+    0xFD, 0x93, 0x9F, 0xD9, 0x29, 0xD9, 0x19, 0xDA, 0x1D, 0x94, 0xD0, 0x9D, 0x5D, 0x90, 0xD9, 0x4D,
+    0x90, 0xE9, 0x19, 0xE1, 0x9F, 0xF9, 0x3A, 0xFA, 0x20, 0x29, 0xEA, 0x94, 0xDA, 0x9A, 0xD9, 0x2A,
+    0xC9, 0x29, 0xD2, 0xD4, 0xD9, 0x1C, 0xA4, 0xAD, 0x09, 0xCA, 0x49, 0xD1, 0xCA, 0x49, 0xD1, 0xD4,
+    0x9D, 0x1A, 0xD2, 0x9E, 0x2F, 0xFC, 0x3A, 0xFA, 0xD7, 0x1D, 0x70, 0xAC, 0xA2, 0xDA, 0xAA, 0xE9,
+    0x19, 0xFF, 0x29, 0xFD, 0xA2, 0x1A, 0xA1, 0x9D, 0x90, 0xAD, 0xA0, 0xEA, 0x77, 0x72, 0xAA, 0x19,
+    0xD9, 0x0A, 0xDA, 0x0E, 0xA0, 0x09, 0xAA, 0x1E, 0x1E, 0x09, 0xE9, 0x77, 0x71, 0xAD, 0xA0, 0xE9,
+    0x0E, 0x1E, 0x09, 0xDA, 0x0E, 0x90, 0x73, 0x99, 0x72, 0xAD, 0x97, 0x0A, 0xE9, 0x69, 0xF9, 0x69,
+    0xF9, 0x6A, 0xF9, 0x79, 0xE9, 0x72, 0xFC, 0xA9, 0x70, 0xAF, 0xDA, 0x97, 0x09, 0xAF, 0xDA, 0x70,
+    0x9A, 0xF7, 0x4A, 0xC0, 0x19, 0x99, 0xAA, 0xAA, 0x90, 0xFF, 0xA7, 0x77, 0x6A, 0xFE, 0xA0, 0xAA,
+    0xAA, 0xA9, 0x99, 0x90, 0x09, 0x97, 0x4A, 0xD9, 0x73, 0xAE, 0xA7, 0x3A, 0xEA, 0x73, 0xAF, 0x97,
+    0x29, 0xF9, 0x72, 0xAE, 0x79, 0xAF, 0xC4, 0xAF, 0xE9, 0x2A, 0xFD, 0xA9, 0x49, 0xFA, 0x97, 0x9A,
+    0x97, 0x30, 0x76, 0xAE, 0xA9, 0x3A, 0xFE, 0xA2, 0xD9, 0x2A, 0xD9, 0x19, 0x5A, 0xD7, 0x1D, 0x71,
+    0xD7, 0x1D, 0x70, 0xAD, 0x70, 0xD9, 0x7E, 0x69, 0xE6, 0xF7, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70,
+    0xA9, 0x77, 0x59, 0x99, 0x70, 0xDA, 0x70, 0xE7, 0x0E, 0x40, 0x71, 0x99, 0x97, 0x49, 0xFD, 0xA7,
+    0x1D, 0xA9, 0x29, 0xD7, 0xD9, 0x6A, 0xC5, 0xD7, 0x1C, 0xA3, 0x9C, 0x91, 0x9D, 0xAC, 0x29, 0xC3,
+    0xD2, 0xC1, 0xAC, 0x3C, 0x3D, 0x19, 0x91, 0x9C, 0x3C, 0x29, 0xD1, 0xA9, 0x19, 0xC3, 0xC2, 0xAD,
+    0x1A, 0xA1, 0xAC, 0x2A, 0xC2, 0xAD, 0x19, 0xFC, 0x90, 0xAC, 0x92, 0x9D, 0xA1, 0x9A, 0xA9, 0xAE,
+    0xA4, 0xE6, 0x99, 0x6A, 0xE7, 0x7F, 0xA9, 0x29, 0xA9, 0x69, 0xFF, 0xDA, 0x70, 0xAF, 0xFC, 0x72,
+    0x9F, 0xCA, 0xA7, 0x75, 0x69, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA,
+    0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3,
+    0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A,
+    0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x0F, 0xCA, 0xA9, 0x5F, 0xFC,
+    0x93, 0xD9, 0x39, 0xD9, 0x2D, 0x94, 0x9C, 0xA2, 0xD9, 0x5D, 0x2D, 0x94, 0x9C, 0xA2, 0xD9, 0x39,
+    0xD9, 0x2F, 0xFC, 0x93, 0xFF, 0xCA, 0x3D, 0x94, 0xAD, 0x91, 0xD9, 0x5A, 0xD1, 0xD9, 0x59, 0xD1,
+    0xD9, 0x59, 0xD9, 0x0D, 0x95, 0xE9, 0x0D, 0xA9, 0x99, 0x9A, 0xF1, 0xFF, 0xF1, 0xFF, 0xE2, 0xFF,
+    0xCA, 0x20, 0x77, 0x49, 0xAF, 0xA4, 0xAF, 0xF3, 0xFA, 0x99, 0x9A, 0x92, 0xEA, 0x70, 0x9D, 0xA7,
+    0x1E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0x71, 0xFA, 0x70, 0xAF,
+    0xDA, 0xAA, 0xAD, 0x1F, 0xFF, 0x1A, 0xFF, 0xE2, 0xAF, 0xFD, 0x39, 0xAF, 0xDA, 0x97, 0x50, 0x0F,
+    0xCA, 0xA9, 0x70, 0xFF, 0xCA, 0x6F, 0xFE, 0x94, 0xD9, 0x39, 0xF9, 0x3D, 0x95, 0x9E, 0x3D, 0x96,
+    0xAD, 0xA2, 0xD9, 0x7E, 0x2D, 0x97, 0xAD, 0x2D, 0x97, 0xAD, 0x91, 0xD9, 0x79, 0xDA, 0x1D, 0x97,
+    0x9D, 0xA1, 0xD9, 0x7A, 0xDA, 0x1D, 0x96, 0xAE, 0x91, 0xDA, 0x99, 0x9A, 0xAA, 0xFC, 0x2F, 0xFF,
+    0xCA, 0x2F, 0xFF, 0xC3, 0xFF, 0xEA, 0x4F, 0xFA, 0x95, 0x59, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1,
+    0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA,
+    0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA,
+    0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x1A, 0xAA, 0xFD, 0x1F, 0xFA, 0x09, 0xD9, 0x69,
+    0xD7, 0x9D, 0x79, 0xD7, 0x9D, 0xAA, 0xAA, 0xA9, 0x1A, 0xFF, 0x1A, 0xFE, 0xA1, 0xAD, 0x7A, 0xD7,
+    0xAD, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x60, 0x77, 0x59, 0xAF, 0xDA, 0x5A, 0xFF, 0xD9, 0x3A,
+    0xEA, 0x73, 0xE9, 0x73, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE5, 0xEA, 0xA9,
+    0x1E, 0x5A, 0xFC, 0xA0, 0xE7, 0x0A, 0xDA, 0x0A, 0xDA, 0x7A, 0xC9, 0x19, 0xEA, 0x6D, 0x92, 0xFF,
+    0xFC, 0xA2, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x95, 0xAA, 0xFC, 0xA9, 0x20, 0x19, 0x97, 0x99, 0x2A,
+    0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xE1, 0xAD, 0x7E, 0x1A, 0xD7, 0xE1,
+    0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1,
+    0xE9, 0x59, 0xE1, 0xE9, 0x59, 0xE1, 0xE9, 0x59, 0xE9, 0x0E, 0xA5, 0x9E, 0x90, 0x0A, 0xAA, 0x1E,
+    0x1E, 0x1E, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1,
+    0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0, 0xEA, 0x76, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49, 0xDA, 0x49,
+    0xDA, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x49, 0xD9, 0x4A, 0xD9, 0x4A, 0xD5, 0xAD, 0x5A, 0xD5,
+    0xAD, 0x5A, 0xD5, 0xAD, 0x5E, 0x5E, 0x4E, 0xA1, 0xFD, 0x91, 0xFD, 0x2F, 0xC3, 0xAA, 0x99, 0x30,
+    0x1A, 0xD3, 0xE4, 0xAD, 0x2A, 0xD9, 0x4A, 0xD1, 0x9D, 0xA5, 0xDA, 0x1E, 0x6D, 0xA0, 0xAD, 0x96,
+    0xDA, 0x0E, 0x7D, 0xAA, 0xD9, 0x7F, 0xCA, 0x70, 0xFC, 0x70, 0x9F, 0xA7, 0x09, 0xFC, 0x70, 0x9F,
+    0xD7, 0xAD, 0x9F, 0x6A, 0xD0, 0x9F, 0x5E, 0x1A, 0xF4, 0xE2, 0xFC, 0x3E, 0x3F, 0xC2, 0xE3, 0x9F,
+    0xC0, 0x1A, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x0E, 0x09, 0x99, 0x99,
+    0xAA, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x1A, 0xAA, 0x97, 0xAA, 0xA9, 0x2F, 0x7E, 0xA2, 0xF9,
+    0x5A, 0xEA, 0x19, 0xFA, 0x5F, 0xA1, 0x9F, 0xC4, 0x9F, 0xC1, 0x9F, 0xCA, 0x3F, 0xD1, 0x9D, 0xAE,
+    0x3F, 0xD1, 0x9D, 0x0E, 0x91, 0xAD, 0x9E, 0x1A, 0xD0, 0xAE, 0x1E, 0x0E, 0x1A, 0xD0, 0x9E, 0x09,
+    0xDA, 0x0E, 0x1A, 0xD1, 0xEA, 0xE9, 0x0E, 0x1A, 0xD9, 0x09, 0xFD, 0x1E, 0x90, 0xE9, 0x1F, 0xCA,
+    0x1E, 0x90, 0xE9, 0x1A, 0xF1, 0x9E, 0x90, 0xE9, 0x19, 0xF1, 0x9E, 0xA0, 0xEA, 0x2E, 0x91, 0x9E,
+    0xA0, 0xEA, 0x29, 0xAA, 0x2A, 0xEA, 0x0E, 0xA7, 0x0A, 0xF0, 0x74, 0xAA, 0x91, 0xAD, 0x96, 0xD9,
+    0x1F, 0x59, 0xD9, 0x1F, 0x94, 0x9D, 0x91, 0xFC, 0x49, 0xD2, 0xFC, 0x93, 0xAD, 0x2D, 0xAE, 0x3A,
+    0xD2, 0xDA, 0xAD, 0x92, 0xAD, 0x19, 0xDA, 0x0D, 0xA2, 0xE1, 0x9D, 0xA0, 0xAD, 0x2E, 0x19, 0xDA,
+    0x1D, 0xA1, 0xE1, 0xAD, 0xA1, 0xAD, 0x1E, 0x1A, 0xDA, 0x2D, 0xA0, 0xE1, 0xAD, 0xA2, 0xAD, 0x9E,
+    0x1E, 0xA3, 0xFC, 0xA1, 0xEA, 0x3F, 0xCA, 0x1F, 0x39, 0xFA, 0x1F, 0x4F, 0xA0, 0x49, 0xAF, 0xA9,
+    0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7,
+    0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E,
+    0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4,
+    0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x74, 0x09, 0xFD, 0xA9, 0x39, 0xFF, 0xC2, 0x9D, 0x39, 0xE1,
+    0x9D, 0x5D, 0x1A, 0xD5, 0xD9, 0x0A, 0xD5, 0xD1, 0xAD, 0x39, 0xE1, 0xAF, 0xFC, 0xA1, 0xAF, 0xFA,
+    0x2E, 0xAA, 0xA9, 0x94, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x97, 0x0E, 0x97, 0x0E,
+    0x97, 0x49, 0xFA, 0x97, 0x9F, 0xFA, 0x59, 0xE3, 0xAE, 0x39, 0xDA, 0x59, 0xDA, 0x2E, 0x7A, 0xD1,
+    0x9D, 0x97, 0x0D, 0xA0, 0xAD, 0x71, 0xAD, 0x0E, 0x71, 0xAD, 0x0D, 0xA7, 0x19, 0xD0, 0xDA, 0x71,
+    0x9D, 0x0E, 0x71, 0xAD, 0x0E, 0x71, 0xE0, 0xAD, 0x93, 0x9A, 0x2D, 0xA0, 0x9E, 0x92, 0xFE, 0x91,
+    0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0xAF, 0xFD, 0x96, 0xAF, 0xFC, 0x73, 0xAF, 0xC7, 0x3A, 0xFC, 0x73,
+    0xAA, 0xAA, 0xA9, 0x1F, 0xCA, 0xA6, 0xFF, 0x94, 0xCA, 0x3A, 0xD4, 0xCA, 0x4D, 0x93, 0xCA, 0x4A,
+    0xCA, 0x29, 0xCA, 0x49, 0xCA, 0x29, 0xCA, 0x4D, 0xA2, 0x9C, 0xA2, 0x9E, 0x92, 0x9F, 0xFA, 0x3A,
+    0xFE, 0xA4, 0xAF, 0xFA, 0x3A, 0xD9, 0x2A, 0xD9, 0x2A, 0xD9, 0x3D, 0xA2, 0xE9, 0x3A, 0xD2, 0xE9,
+    0x3E, 0x91, 0xE9, 0x3E, 0xA1, 0xEA, 0x3F, 0x1E, 0xA3, 0xF0, 0x49, 0xAF, 0xCA, 0x96, 0xFF, 0xC9,
+    0x5A, 0xFA, 0xAA, 0xAA, 0x6E, 0x97, 0x4D, 0x97, 0x49, 0xD7, 0x6D, 0xA7, 0x5A, 0xFA, 0xA9, 0x71,
+    0xAF, 0xEA, 0x70, 0x9A, 0xFE, 0x97, 0x29, 0xAF, 0x97, 0x39, 0xF7, 0x39, 0xF9, 0x29, 0x95, 0xFC,
+    0x91, 0x9F, 0xFF, 0xC2, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x93, 0xAF, 0xFA, 0x97, 0x74, 0x09, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0x94, 0xD9, 0x74, 0xD9,
+    0x74, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7,
+    0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x50, 0x0A, 0xAA,
+    0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59, 0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9D,
+    0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A,
+    0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x49, 0xE9, 0x09, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF,
+    0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x00, 0x0A, 0xA9, 0x71, 0x9A, 0xA1, 0xAD, 0x71, 0xE1, 0x9D, 0x97,
+    0x9D, 0x92, 0xE7, 0xE3, 0xAD, 0x7E, 0x39, 0xDA, 0x5A, 0xD9, 0x4E, 0x5E, 0x5E, 0x93, 0x9E, 0x59,
+    0xDA, 0x3E, 0x96, 0xE3, 0xE7, 0xE9, 0x1A, 0xE7, 0xAD, 0xA1, 0xE9, 0x70, 0xE0, 0x9E, 0x71, 0xFF,
+    0x71, 0xAF, 0xD9, 0x71, 0x9F, 0xD7, 0x3F, 0xD7, 0x3A, 0xFA, 0x50, 0x0D, 0xA7, 0x7D, 0xA0, 0xAD,
+    0x76, 0x9D, 0x90, 0xAD, 0x76, 0xAD, 0x19, 0xD9, 0x75, 0xE2, 0xDA, 0x75, 0xDA, 0x2E, 0x4A, 0xD4,
+    0x9D, 0x92, 0xAD, 0x4E, 0x93, 0xE3, 0x9D, 0x92, 0xAF, 0x3E, 0x4D, 0xA2, 0xFC, 0x91, 0x9D, 0xA4,
+    0xE1, 0xAF, 0xD1, 0xAD, 0x94, 0xE1, 0xE9, 0xAD, 0x90, 0xE5, 0xAD, 0x9A, 0xE0, 0x9E, 0x0E, 0x59,
+    0xDA, 0xEA, 0x1E, 0xAD, 0xA6, 0xFD, 0x2A, 0xFC, 0x96, 0xFD, 0x29, 0xFC, 0x7F, 0xC9, 0x3F, 0xC7,
+    0xAF, 0x4A, 0xEA, 0x79, 0xEA, 0x5E, 0x93, 0x1A, 0xA9, 0x79, 0xAA, 0x29, 0xD7, 0xD9, 0x3D, 0xA5,
+    0xAC, 0xA5, 0xD9, 0x39, 0xD6, 0xAD, 0x3D, 0x97, 0xE1, 0xE7, 0x09, 0xDA, 0xAD, 0x72, 0xFC, 0xA7,
+    0x3F, 0x74, 0xEA, 0x73, 0xAF, 0x97, 0x19, 0xFD, 0x71, 0xE9, 0xAE, 0x7F, 0x1E, 0x95, 0x9E, 0x29,
+    0xE5, 0xEA, 0x3F, 0x3F, 0x5E, 0xA1, 0xAE, 0x95, 0xAE, 0x90, 0x0D, 0xA7, 0xAD, 0x19, 0xD9, 0x6D,
+    0x92, 0xE5, 0xAD, 0x39, 0xD9, 0x39, 0xD9, 0x4E, 0x3E, 0x59, 0xDA, 0x19, 0xDA, 0x6E, 0x1E, 0x7A,
+    0xDA, 0xAD, 0xA7, 0x0F, 0xD7, 0x1A, 0xFA, 0x72, 0xF7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0xA7,
+    0x3E, 0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7, 0x2A, 0xEA, 0x50, 0x2F, 0xFF, 0xC3, 0xAF, 0xFF, 0x39,
+    0xFF, 0xF7, 0x39, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xA7, 0x2F, 0xA7, 0x2F,
+    0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC9, 0x71, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF, 0xE1,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xE9, 0x1F, 0xC2, 0xFC, 0x2D, 0x5D, 0x5D, 0x49, 0xD4, 0x9D, 0x49, 0xD4,
+    0x9D, 0x49, 0xD4, 0xAD, 0x4A, 0xCA, 0x4A, 0xCA, 0x4A, 0xCA, 0x4A, 0xCA, 0x4D, 0xA4, 0xD9, 0x4D,
+    0x94, 0xD9, 0x4D, 0x94, 0xD9, 0x4D, 0x5D, 0x5D, 0x5D, 0x49, 0xD4, 0x9F, 0xC9, 0x09, 0xFC, 0x29,
+    0x99, 0x99, 0x10, 0x09, 0x6A, 0x59, 0xC6, 0xC9, 0x5D, 0x5A, 0xC6, 0xCA, 0x5D, 0x5A, 0xC5, 0x9C,
+    0xA5, 0xD5, 0xAC, 0x94, 0x9C, 0xA5, 0xD5, 0xD9, 0x49, 0xD5, 0xD5, 0xCA, 0x5A, 0x71, 0x9F, 0xC1,
+    0x9F, 0xC4, 0x9D, 0x49, 0xD4, 0x9D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x94, 0xD9, 0x4D, 0x94, 0xD9,
+    0x4D, 0x94, 0xDA, 0x4A, 0xCA, 0x4A, 0xCA, 0x4A, 0xCA, 0x4A, 0xCA, 0x4A, 0xD4, 0x9D, 0x49, 0xD4,
+    0x9D, 0x49, 0xD4, 0x9D, 0x5D, 0x1A, 0xFC, 0x19, 0xFC, 0x29, 0x99, 0x99, 0x00, 0x74, 0xCA, 0x5E,
+    0x93, 0xD0, 0x9C, 0x91, 0xCA, 0x3C, 0x90, 0x0F, 0xFF, 0xA9, 0xFF, 0xFC, 0x75, 0x9C, 0xA4, 0x9D,
+    0x49, 0xD9, 0x70, 0x77, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5,
+    0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A,
+    0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0xAA, 0xA7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A,
+    0xD7, 0x09, 0xD7, 0x09, 0xD1, 0x9A, 0x93, 0x9D, 0xAF, 0xC9, 0x19, 0xFA, 0x99, 0xD9, 0x1E, 0x4D,
+    0x1D, 0xA4, 0xAC, 0x90, 0xDA, 0x49, 0xCA, 0x0D, 0x94, 0x9C, 0xA0, 0xDA, 0x4D, 0x90, 0xE9, 0x19,
+    0xE1, 0xFF, 0xCA, 0x19, 0xFF, 0x39, 0xFC, 0xA7, 0x60, 0x73, 0x9A, 0xEA, 0x29, 0xFD, 0x2D, 0xA5,
+    0xAD, 0x6A, 0xC9, 0x6D, 0x96, 0xD9, 0x6A, 0xCA, 0x6A, 0xD9, 0x6F, 0x9A, 0xA2, 0x9F, 0xDA, 0x3A,
+    0xFA, 0x72, 0x71, 0xAC, 0x97, 0x1A, 0xC9, 0x71, 0xAC, 0x97, 0x1A, 0xC7, 0x2A, 0xC7, 0x2D, 0x4A,
+    0xEA, 0x0D, 0x3A, 0xFC, 0xAD, 0x2A, 0xCA, 0x19, 0xF2, 0xD4, 0xE1, 0x9C, 0x94, 0xE1, 0xAC, 0x5A,
+    0xD1, 0xAC, 0x94, 0xE1, 0xAC, 0xA4, 0xE1, 0x9E, 0x99, 0xAF, 0x2F, 0xFD, 0x29, 0xFF, 0xC4, 0xAE,
+    0xA0, 0xD7, 0x50, 0x49, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29,
+    0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7,
+    0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x10, 0x39, 0xA9, 0x19, 0xEA, 0x1D, 0x4C, 0xA4, 0xCA,
+    0x4C, 0xA2, 0xFE, 0xAF, 0xD1, 0xD4, 0xD4, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39, 0xD3, 0x9D, 0x39,
+    0xD2, 0x2A, 0xDA, 0x09, 0xC9, 0x09, 0xFF, 0xA0, 0xD9, 0x09, 0xF9, 0x9C, 0x93, 0xE9, 0xAC, 0x4A,
+    0xD9, 0xD4, 0x9D, 0x9A, 0xC4, 0x9D, 0x9A, 0xC4, 0xAD, 0x99, 0xCA, 0x99, 0x9A, 0xE1, 0xFF, 0xC1,
+    0x9F, 0xF3, 0xAD, 0xA0, 0xD7, 0xAD, 0x19, 0x3A, 0xDA, 0x1F, 0xF1, 0x9F, 0xE9, 0x29, 0xAE, 0xA9,
+    0x20, 0x0A, 0xC9, 0x7A, 0xC7, 0x0A, 0xC7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD0, 0xF9, 0x2F, 0xFA,
+    0x1E, 0xA9, 0x0A, 0xD1, 0xDA, 0x3A, 0xC9, 0x9D, 0x49, 0xC9, 0x9D, 0x49, 0xCA, 0x9D, 0x49, 0xCA,
+    0xAD, 0x49, 0xCA, 0xAD, 0x49, 0xCA, 0xAD, 0x4A, 0xDA, 0xD4, 0xAF, 0xC4, 0xE0, 0x9D, 0x0A, 0xD0,
+    0xE9, 0x99, 0x97, 0x19, 0x2C, 0xA1, 0xCA, 0x1C, 0xA1, 0xCA, 0x1C, 0xA0, 0x9C, 0xA0, 0x9C, 0xA0,
+    0x9D, 0x09, 0xD0, 0xAD, 0x0A, 0xD0, 0x4D, 0x94, 0xDA, 0x39, 0xDA, 0x49, 0x99, 0x77, 0x4A, 0xA5,
+    0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xCA, 0x5C, 0xA5, 0xCA, 0x4A, 0xCA, 0x39,
+    0xD9, 0x1F, 0xC1, 0xAE, 0xA7, 0x20, 0x09, 0xA7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x79,
+    0xD1, 0xAC, 0x92, 0x9D, 0x0A, 0xD3, 0x9C, 0xA9, 0xD4, 0x9F, 0x94, 0x9E, 0xA5, 0xAF, 0x5A, 0xFC,
+    0x4A, 0xCA, 0x0E, 0x3A, 0xD0, 0x9E, 0x2A, 0xD1, 0xAE, 0x90, 0xE2, 0xF9, 0x1C, 0xA4, 0xD3, 0x9C,
+    0xA3, 0x9C, 0xA3, 0xAC, 0xA3, 0xAC, 0x93, 0xAC, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9,
+    0x3D, 0x4D, 0x4D, 0x99, 0x2F, 0xC1, 0xFC, 0x00, 0x09, 0xA1, 0xAD, 0xA2, 0xAD, 0xA3, 0xAC, 0xAF,
+    0xD0, 0xFD, 0x2A, 0xE2, 0xFA, 0x1A, 0xC9, 0x1E, 0x39, 0xDA, 0x3C, 0xA1, 0xDA, 0x4D, 0x93, 0xD1,
+    0xD9, 0x4D, 0x4D, 0x1D, 0x94, 0xD4, 0xD0, 0x9D, 0x49, 0xD4, 0xD0, 0x9D, 0x4A, 0xCA, 0x39, 0xD0,
+    0xAD, 0x4D, 0xA3, 0x9D, 0x0A, 0xD4, 0xD9, 0x39, 0xD0, 0xE4, 0xD9, 0x3A, 0xD0, 0x0A, 0x90, 0x9A,
+    0xA9, 0x3F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1D, 0x93, 0xD0, 0x9D, 0x4D, 0x09, 0xD4, 0xD9, 0x9D, 0x4D,
+    0x9A, 0xD4, 0xD9, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAE, 0x4D, 0xA0, 0x2A, 0xEA, 0x5F,
+    0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x5D, 0x0D, 0x95,
+    0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9, 0x4A, 0xEA, 0x30, 0x19,
+    0x19, 0xAC, 0xA9, 0x39, 0xCA, 0xAF, 0xCA, 0x29, 0xF2, 0xAC, 0x3E, 0x4C, 0xA2, 0xDA, 0x4D, 0x2D,
+    0x94, 0xAC, 0x2D, 0xA4, 0xAC, 0x2E, 0x4D, 0x2E, 0xA2, 0x9D, 0x19, 0xFF, 0xC9, 0x1A, 0xFF, 0xC2,
+    0xDA, 0x0F, 0xA3, 0xD9, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7, 0x76, 0x77, 0x09, 0xAD,
+    0x90, 0xAA, 0x4E, 0xAD, 0x9D, 0x3D, 0x92, 0xF2, 0x9C, 0xA4, 0xE2, 0xAC, 0x94, 0xE2, 0xAC, 0x5E,
+    0x2D, 0x5D, 0xA2, 0xAC, 0x49, 0xDA, 0x29, 0xD2, 0x9E, 0xA3, 0xFF, 0xC9, 0x4F, 0xDA, 0xC9, 0x5A,
+    0xE9, 0x9C, 0x97, 0x29, 0xC9, 0x72, 0xAC, 0xAD, 0x97, 0xAF, 0x70, 0xDA, 0x97, 0x70, 0x09, 0x92,
+    0x91, 0xD9, 0xE9, 0x0F, 0xD9, 0x0E, 0x93, 0xDA, 0x4D, 0xA4, 0xD9, 0x4D, 0x94, 0xDA, 0x39, 0xDA,
+    0x3A, 0xDA, 0x3A, 0xE3, 0x2A, 0xFA, 0x19, 0xDA, 0xAA, 0xA9, 0x1D, 0x7D, 0x7A, 0xD9, 0x6F, 0xA9,
+    0x49, 0xAF, 0x69, 0xDA, 0x19, 0x3E, 0x0A, 0xFE, 0xAA, 0xFF, 0x90, 0xAF, 0xCA, 0x90, 0x73, 0x9C,
+    0x95, 0xD6, 0xD4, 0x99, 0xD9, 0x99, 0x0A, 0xFE, 0xA2, 0xD6, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59,
+    0xD5, 0xAD, 0x5A, 0xFA, 0x2A, 0xFC, 0x91, 0x9F, 0xCA, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94,
+    0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9,
+    0x0E, 0xAA, 0xF9, 0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x99, 0x70, 0x90, 0x9C,
+    0xA6, 0xD1, 0xD5, 0x9C, 0xA1, 0xAC, 0xA4, 0xD9, 0x2D, 0x39, 0xD3, 0xAC, 0xA2, 0xD9, 0x4D, 0x91,
+    0xD5, 0xAD, 0x0A, 0xC9, 0x59, 0xDA, 0xD7, 0xFA, 0x7A, 0xEA, 0x7A, 0xE9, 0x30, 0x99, 0x97, 0x19,
+    0x90, 0xAD, 0x71, 0xD0, 0x9D, 0x70, 0x9D, 0x1D, 0x97, 0xAC, 0xA1, 0xDA, 0x19, 0xD2, 0xD9, 0x1A,
+    0xD1, 0xEA, 0x1D, 0x29, 0xD0, 0xFC, 0x99, 0xD3, 0xFF, 0xEA, 0x3F, 0xFE, 0x93, 0xAF, 0x0A, 0xF5,
+    0xEA, 0x1F, 0x5E, 0x29, 0xDA, 0x20, 0x1D, 0x93, 0xDA, 0x29, 0xD2, 0xAD, 0x4E, 0x09, 0xD6, 0xDA,
+    0xD9, 0x69, 0xEA, 0x70, 0xE7, 0x09, 0xEA, 0x69, 0xFC, 0x95, 0xE0, 0xE4, 0xE1, 0x9D, 0xA2, 0xAD,
+    0x92, 0xAD, 0x90, 0x9D, 0xA4, 0xE0, 0xAC, 0x95, 0xD1, 0xD5, 0xD1, 0xAC, 0xA3, 0x9C, 0xA2, 0xD3,
+    0xD9, 0x2A, 0xCA, 0x2D, 0x92, 0x9D, 0x90, 0x9D, 0x4E, 0x0A, 0xD4, 0x9D, 0x9D, 0xA5, 0xFC, 0x95,
+    0x9F, 0x7F, 0x7A, 0xDA, 0x7A, 0xD9, 0x7E, 0x69, 0xEA, 0x4F, 0xD5, 0xFA, 0x6A, 0xAA, 0x70, 0x1F,
+    0xFA, 0x1F, 0xFC, 0x6A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A,
+    0xE5, 0x9E, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xC0, 0xAF, 0xFC, 0x90, 0x59, 0x99, 0x4A, 0xF3, 0x9D,
+    0x95, 0xAC, 0xA6, 0xAC, 0xA6, 0xDA, 0x6D, 0x96, 0xD9, 0x49, 0xAD, 0x49, 0xDA, 0x59, 0xE9, 0x6A,
+    0xD7, 0xD7, 0xD7, 0xD6, 0x9D, 0x7D, 0x96, 0xFC, 0x5F, 0x73, 0x0A, 0x90, 0xCA, 0x0C, 0xA0, 0xCA,
+    0x0C, 0xA0, 0xC9, 0x0C, 0x90, 0xC9, 0x0C, 0x90, 0xC9, 0x0C, 0x90, 0xC9, 0x0C, 0x90, 0xC1, 0xC0,
+    0x9C, 0x09, 0xC0, 0x9C, 0x00, 0x09, 0x99, 0x6F, 0x96, 0xAD, 0x7D, 0x7D, 0x96, 0xD9, 0x6D, 0x96,
+    0xAC, 0xA6, 0x9D, 0x99, 0x59, 0xE5, 0xAE, 0x49, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD6, 0xAD,
+    0x39, 0xFA, 0x39, 0xEA, 0x75, 0x0D, 0x91, 0x99, 0x9C, 0x0C, 0x1A, 0x9A, 0xA0, 0x9C, 0x9C, 0x0A,
+    0xA1, 0xAD, 0x70, 0x6F, 0x1F, 0x1A, 0xDA, 0x19, 0xDA, 0x71, 0x9A, 0x2E, 0x2A, 0xD2, 0xAD, 0x2A,
+    0xD2, 0x9D, 0x29, 0xD2, 0x9D, 0x29, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0x90, 0x39, 0xC7,
+    0x9C, 0x79, 0xC7, 0x9C, 0x59, 0xAE, 0xA2, 0xAF, 0xD2, 0xDA, 0xAC, 0x3A, 0xD0, 0xAC, 0x3A, 0xC9,
+    0x0A, 0xC3, 0xD9, 0x0A, 0xC3, 0xD9, 0x0A, 0xC3, 0xAC, 0xA0, 0xAC, 0x3A, 0xD9, 0xAC, 0x4F, 0xCA,
+    0xA2, 0x9F, 0xDA, 0x3A, 0xFA, 0x4C, 0xA7, 0xCA, 0x75, 0x77, 0x77, 0x0A, 0xEA, 0x6A, 0xFE, 0x93,
+    0xAD, 0x93, 0xAC, 0x3A, 0xC9, 0x72, 0xAC, 0x73, 0x9C, 0x97, 0x3D, 0x73, 0xAC, 0x73, 0x9C, 0xA7,
+    0x3D, 0x71, 0xFF, 0xC4, 0xFF, 0xC6, 0x9D, 0x72, 0xAD, 0x71, 0xAD, 0x97, 0xF9, 0x70, 0xFF, 0xDA,
+    0x91, 0xFF, 0xF0, 0x74, 0x9C, 0xA0, 0x99, 0x0A, 0xC2, 0x9F, 0xF9, 0x2A, 0xCA, 0x1A, 0xCA, 0x3D,
+    0x3D, 0x3D, 0x3D, 0x3D, 0xA1, 0xAD, 0x3F, 0xF2, 0xFF, 0xD1, 0xAC, 0x19, 0x91, 0xCA, 0x74, 0x09,
+    0x97, 0x99, 0x1A, 0xCA, 0x5A, 0xCA, 0x2D, 0xA3, 0xAD, 0x39, 0xDA, 0x1A, 0xD5, 0xAD, 0x9A, 0xD9,
+    0x6F, 0xCA, 0x70, 0xF7, 0x1A, 0xD9, 0x79, 0xAF, 0xD4, 0xFD, 0xAA, 0xA7, 0xAD, 0x72, 0xAD, 0x72,
+    0xAD, 0x7A, 0xFF, 0x49, 0x99, 0xEA, 0xAA, 0x7A, 0xD7, 0x2A, 0xD7, 0x73, 0x0A, 0x90, 0xCA, 0x0C,
+    0xA0, 0xCA, 0x0C, 0xA0, 0xC9, 0x0A, 0x97, 0x1A, 0x90, 0xC9, 0x0C, 0x90, 0xC1, 0xC0, 0x9C, 0x09,
+    0xC0, 0x9C, 0x00, 0x77, 0xFC, 0x94, 0xCA, 0x91, 0x9C, 0x93, 0xC7, 0x19, 0xC7, 0x2D, 0xA7, 0x0A,
+    0xFA, 0x4F, 0xF9, 0x19, 0xD9, 0x3D, 0x1A, 0xC5, 0xAC, 0x1A, 0xCA, 0x4D, 0x2F, 0xFC, 0x3A, 0xFD,
+    0x96, 0xAE, 0x70, 0xAD, 0xA2, 0x93, 0xAD, 0xA1, 0xAF, 0xF9, 0x09, 0xFF, 0xA2, 0xAA, 0xAC, 0xAA,
+    0x93, 0x9D, 0x2A, 0xCA, 0x0A, 0xD2, 0xE0, 0xE9, 0x1E, 0x09, 0x99, 0x29, 0x99, 0x00, 0x19, 0xAA,
+    0xA9, 0x29, 0x99, 0xA9, 0x9A, 0x1A, 0x0A, 0x29, 0x99, 0x99, 0x93, 0x90, 0x99, 0xA2, 0x99, 0x0A,
+    0x0A, 0xCA, 0x0A, 0x2A, 0x2A, 0x93, 0xAA, 0xA2, 0x70, 0xDA, 0x91, 0xC1, 0xCA, 0x09, 0xA1, 0x9A,
+    0x09, 0x91, 0x9A, 0x09, 0xA1, 0xD1, 0xFC, 0x2A, 0xA0, 0x90, 0x4A, 0x39, 0x3A, 0xC2, 0xCA, 0x2D,
+    0x90, 0x9D, 0x19, 0xD1, 0x9D, 0x2D, 0x19, 0xCA, 0x3D, 0xA0, 0x9D, 0x93, 0xE0, 0xAD, 0x93, 0xDA,
+    0x0A, 0xD9, 0x3C, 0xA1, 0x9C, 0x71, 0x90, 0x9E, 0xAA, 0xA9, 0x91, 0x9F, 0xFC, 0x79, 0xD7, 0x0D,
+    0x70, 0xD7, 0x0D, 0x00, 0x71, 0x9F, 0xFC, 0x9F, 0xFC, 0x19, 0xAA, 0xA9, 0x29, 0x99, 0x90, 0x9A,
+    0x1A, 0x0A, 0x0A, 0x09, 0x99, 0x90, 0xE1, 0x90, 0xA0, 0xC0, 0xA0, 0x99, 0x0A, 0x0C, 0x0A, 0x9A,
+    0x2C, 0x90, 0x9C, 0x93, 0x9A, 0xA2, 0x71, 0xFE, 0x71, 0x73, 0x9E, 0xA3, 0xAD, 0xAA, 0xD1, 0x9D,
+    0x29, 0xCA, 0x0A, 0xC9, 0x3D, 0x0D, 0x4D, 0x0A, 0xCA, 0x29, 0xD0, 0x9D, 0xA9, 0xAD, 0xA1, 0xAF,
+    0xD3, 0x9E, 0xA2, 0x4A, 0x97, 0x0C, 0xA7, 0x0C, 0xA7, 0x9C, 0xA3, 0x9F, 0xFC, 0x5C, 0xA7, 0x0C,
+    0xA7, 0x0C, 0xA7, 0x75, 0x99, 0x2F, 0xFA, 0x19, 0x97, 0x09, 0xAA, 0x29, 0x09, 0xC4, 0xC3, 0x9C,
+    0x29, 0xC9, 0x1A, 0xC9, 0x2F, 0x90, 0x99, 0x99, 0x00, 0x09, 0xAA, 0x94, 0x99, 0x39, 0x91, 0xAC,
+    0xA4, 0xA9, 0x39, 0xA0, 0xAA, 0xAC, 0xA0, 0xEA, 0x00, 0x5C, 0x90, 0x9C, 0x1D, 0x09, 0xC9, 0x00,
+    0x0D, 0x5D, 0x09, 0xD9, 0x4D, 0x09, 0xD9, 0x4D, 0x09, 0xD9, 0x4D, 0x09, 0xDA, 0x4D, 0x09, 0xDA,
+    0x4D, 0x09, 0xDA, 0x4D, 0x99, 0xE3, 0xAD, 0x9A, 0xFA, 0xAF, 0x9A, 0xFF, 0xD9, 0xAC, 0xAF, 0xF9,
+    0xAC, 0x0A, 0xEA, 0x0D, 0x9A, 0xC7, 0x1A, 0xA7, 0x10, 0x2A, 0xA9, 0x1A, 0xA1, 0x9E, 0xA1, 0xD1,
+    0xFA, 0x1A, 0xC0, 0x9F, 0x91, 0xAC, 0x09, 0xF9, 0x1A, 0xC1, 0xF9, 0x1A, 0xC1, 0x9E, 0x91, 0xAC,
+    0x29, 0xD2, 0xAC, 0x2A, 0xD2, 0xAC, 0x2A, 0xD2, 0xAC, 0x2E, 0x2A, 0xC2, 0xE2, 0xAC, 0x19, 0xE2,
+    0xAC, 0x1A, 0xE2, 0xAC, 0x1A, 0xDA, 0x2A, 0xC1, 0xEA, 0x29, 0xC1, 0xEA, 0x29, 0xC0, 0x09, 0x90,
+    0x9D, 0x0A, 0xD0, 0xE9, 0x09, 0x3A, 0x3C, 0xA4, 0xA3, 0xC0, 0x9D, 0x90, 0x69, 0xC9, 0x29, 0xA9,
+    0x3A, 0x93, 0xA9, 0x3A, 0x93, 0xC9, 0x2F, 0x19, 0x99, 0x90, 0x09, 0xDA, 0x2C, 0x1A, 0xA0, 0x9A,
+    0x2C, 0x0A, 0xA2, 0xC0, 0x9C, 0x19, 0xC1, 0xF9, 0x29, 0xA9, 0x10, 0x93, 0x94, 0x9C, 0x91, 0xAC,
+    0x4A, 0xCA, 0x1D, 0x93, 0xAC, 0xA1, 0xAC, 0x93, 0x9C, 0xA1, 0xD9, 0x2E, 0x09, 0xD9, 0x1E, 0x0A,
+    0xD9, 0x1E, 0x09, 0xD9, 0x2C, 0xA2, 0xC9, 0x39, 0x39, 0x30, 0x77, 0x29, 0xD7, 0x6A, 0x9C, 0x77,
+    0x0C, 0x79, 0xC5, 0x9C, 0x7C, 0x95, 0x9C, 0x6A, 0xC6, 0x9C, 0x6C, 0x96, 0x9C, 0x5C, 0xA7, 0x9C,
+    0x49, 0xC6, 0x9F, 0xC9, 0x1C, 0xA6, 0x9F, 0xC9, 0x0A, 0xC4, 0x97, 0x09, 0xC9, 0x3C, 0xA7, 0x0D,
+    0x3A, 0xCA, 0x7A, 0xC9, 0x29, 0xCA, 0xC7, 0xCA, 0x3C, 0x99, 0xC6, 0xAC, 0x3D, 0x09, 0xC5, 0x9C,
+    0xA2, 0x9C, 0xAA, 0xDA, 0x93, 0xD3, 0x99, 0x99, 0xAD, 0x92, 0xAC, 0x97, 0xAC, 0x4A, 0xA7, 0x0A,
+    0xC9, 0x00, 0x1A, 0xC7, 0x6A, 0xAC, 0x77, 0x0C, 0x79, 0xC5, 0x9C, 0x7C, 0x95, 0x9C, 0x6A, 0xC6,
+    0x9C, 0x6C, 0x96, 0x9C, 0x5A, 0xC7, 0x9C, 0x49, 0xC9, 0x59, 0xFC, 0x91, 0xCA, 0x0A, 0xE9, 0x09,
+    0xFC, 0x90, 0x9C, 0x0A, 0xA9, 0x0A, 0xC9, 0x7C, 0xA5, 0xCA, 0x6A, 0xC6, 0xAA, 0x6C, 0xA6, 0xCA,
+    0x5D, 0x6A, 0xC5, 0x9C, 0x95, 0xAC, 0xA5, 0xD5, 0xE5, 0xAC, 0x94, 0xE6, 0xD4, 0x9F, 0xD2, 0xD9,
+    0x4A, 0xFD, 0x29, 0x97, 0x40, 0x09, 0xEA, 0x75, 0x92, 0xAA, 0x77, 0x1C, 0x59, 0xC7, 0x09, 0xC5,
+    0xC9, 0x5A, 0xE9, 0x4A, 0xC7, 0x09, 0xC9, 0x4C, 0x97, 0x19, 0xC3, 0xCA, 0x73, 0xC9, 0x19, 0xC7,
+    0x92, 0xAC, 0x2C, 0xA7, 0xFC, 0xA1, 0xAC, 0x49, 0x2A, 0xEA, 0x19, 0xC9, 0x3C, 0xA7, 0x1D, 0x3A,
+    0xCA, 0x70, 0xAC, 0x92, 0x9C, 0xAC, 0x70, 0xCA, 0x3C, 0x99, 0xC7, 0xAC, 0x3D, 0x09, 0xC6, 0x9C,
+    0xA2, 0x9C, 0xAA, 0xDA, 0x94, 0xD3, 0x99, 0x99, 0xAD, 0x93, 0xAC, 0x97, 0xAC, 0x5A, 0xA7, 0x0A,
+    0xC9, 0x00, 0x4E, 0x70, 0xE7, 0x0D, 0xA7, 0x09, 0x97, 0x76, 0x9A, 0x70, 0xE7, 0x0E, 0x70, 0xE7,
+    0x0E, 0x7F, 0x6E, 0x96, 0xE7, 0x9D, 0x70, 0xD9, 0x70, 0xD7, 0x09, 0xD7, 0x1D, 0x71, 0xDA, 0x70,
+    0xAD, 0xA2, 0x9D, 0x2A, 0xFE, 0xA3, 0x9A, 0xEA, 0x76, 0x4A, 0xA7, 0x7D, 0x97, 0x6D, 0xA7, 0x79,
+    0x97, 0x77, 0x77, 0x69, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71,
+    0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA,
+    0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF,
+    0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x70, 0xAC, 0x76, 0xC9, 0x75, 0xAC,
+    0x76, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x72, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9,
+    0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D,
+    0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA,
+    0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x79, 0x76,
+    0x9C, 0xA7, 0x49, 0xEA, 0x72, 0x9C, 0x90, 0x9C, 0xA7, 0x1A, 0x4A, 0x97, 0x77, 0x77, 0x49, 0xD7,
+    0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA,
+    0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4,
+    0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA,
+    0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x5D, 0x91, 0x99, 0x70, 0x9C, 0x9C, 0x1A, 0x97, 0x0A, 0xA0, 0x9C,
+    0x9C, 0x71, 0xC9, 0x1A, 0xCA, 0x77, 0x77, 0x75, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9,
+    0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D,
+    0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA,
+    0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x4D, 0x91,
+    0x9D, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0xA1, 0xE9, 0x69, 0x99, 0x91, 0x99, 0x97, 0x77, 0x77, 0x49,
+    0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A,
+    0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A,
+    0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19,
+    0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x69, 0xD7, 0x5C, 0x1C, 0x74, 0xC1, 0xC7, 0x4A, 0xD9, 0x77,
+    0x77, 0x77, 0x77, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19,
+    0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6,
+    0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF,
+    0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x77, 0x09, 0x99, 0x99, 0x97, 0x2F, 0xFF,
+    0xA7, 0x1A, 0xFF, 0xF9, 0x71, 0xFC, 0xA7, 0x70, 0xAC, 0xAE, 0xA7, 0x70, 0xD0, 0xAD, 0xA7, 0x7D,
+    0x90, 0x9D, 0xA7, 0x69, 0xD1, 0x9E, 0x99, 0x9A, 0xA7, 0x1D, 0x92, 0xFF, 0x97, 0x9D, 0x3F, 0xF9,
+    0x7D, 0x93, 0xE7, 0x4A, 0xD4, 0xE7, 0x4E, 0xAA, 0xAA, 0xAE, 0x97, 0x2A, 0xFF, 0xEA, 0x72, 0xFF,
+    0xFC, 0xAA, 0xAA, 0xAA, 0x92, 0xAD, 0x6F, 0xFD, 0xA2, 0xDA, 0x6F, 0xFE, 0x1E, 0x96, 0xFF, 0xE7,
+    0x77, 0x00, 0x77, 0x49, 0xAF, 0xA4, 0xAF, 0xF3, 0xFA, 0x99, 0x9A, 0x92, 0xEA, 0x70, 0x9D, 0xA7,
+    0x1E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x72, 0xE7, 0x2E, 0x72, 0xEA, 0x71, 0xFA, 0x70, 0xAF,
+    0xDA, 0xAA, 0xAD, 0x1F, 0xFF, 0x1A, 0xFF, 0xE2, 0xAF, 0xFD, 0x39, 0xAF, 0xDA, 0x97, 0x99, 0x73,
+    0xAA, 0x97, 0x49, 0xA7, 0x39, 0xA7, 0x1D, 0xA2, 0x2A, 0xC9, 0x72, 0xDA, 0x72, 0xE7, 0x77, 0x74,
+    0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA, 0x1A, 0xFF, 0xC9, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A, 0xA9, 0x3A, 0xFE, 0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x6A,
+    0xC7, 0x2C, 0xA7, 0x1A, 0xC7, 0x2D, 0x77, 0x77, 0x77, 0x77, 0x73, 0x99, 0x99, 0x99, 0x1A, 0xFF,
+    0xCA, 0x1A, 0xFF, 0xC9, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAD, 0x99,
+    0x9A, 0xA9, 0x3A, 0xFE, 0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0xAA,
+    0xAA, 0xAA, 0xA9, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x59, 0x72, 0x9D, 0x70, 0x9C, 0xAC,
+    0xA6, 0x9C, 0x91, 0xCA, 0x5A, 0x49, 0x97, 0x74, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA, 0x1A, 0xFF,
+    0xC9, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A, 0xA9, 0x3A,
+    0xFE, 0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xA9,
+    0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x29, 0x93, 0x99, 0x4D, 0x91, 0x9D, 0x39, 0xDA, 0x1A,
+    0xD3, 0xAD, 0xA1, 0xE9, 0x77, 0x77, 0x09, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91,
+    0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9,
+    0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x09, 0x5A, 0xC9, 0x4A, 0xCA, 0x49, 0xAA, 0x77, 0x70, 0xAA, 0xA3,
+    0xE3, 0xE3, 0xE3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD,
+    0x3E, 0x92, 0xE9, 0x2E, 0x92, 0xEA, 0x2E, 0xA0, 0x7C, 0x91, 0xAC, 0x2C, 0xA1, 0xAC, 0x97, 0x77,
+    0x7A, 0xAA, 0x1E, 0x1E, 0x1E, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1,
+    0xAD, 0x1A, 0xD1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0, 0xEA, 0x73, 0xAC, 0x59, 0xE3, 0x9C, 0x90,
+    0xCA, 0x19, 0xC3, 0xAA, 0x77, 0x76, 0xAA, 0xA5, 0xE5, 0xE5, 0xE5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A,
+    0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5A, 0xD5, 0xAD, 0x5E, 0x94, 0xE9, 0x4E, 0x94, 0xEA, 0x4E, 0xA1,
+    0x09, 0xD2, 0xDA, 0x1A, 0xD2, 0xDA, 0x1E, 0x2E, 0x19, 0x99, 0x29, 0x99, 0x77, 0x77, 0x5A, 0xD7,
+    0xE7, 0xE7, 0xE7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD,
+    0x7E, 0x96, 0xE9, 0x6E, 0x96, 0xEA, 0x6E, 0xA2, 0x2F, 0xCA, 0xA9, 0x72, 0xFF, 0xCA, 0x70, 0xFF,
+    0xE9, 0x6D, 0x93, 0x9F, 0x95, 0xD9, 0x59, 0xE5, 0xD9, 0x6A, 0xDA, 0x4D, 0x97, 0xE4, 0xD9, 0x7A,
+    0xD1, 0xFF, 0xC4, 0x9D, 0x90, 0xFF, 0xC4, 0x9D, 0xA3, 0xD9, 0x79, 0xDA, 0x3D, 0x97, 0xAD, 0xA3,
+    0xD9, 0x6A, 0xE9, 0x3D, 0xA9, 0x99, 0xAA, 0xFD, 0x4F, 0xFF, 0xCA, 0x4F, 0xFF, 0xC5, 0xFF, 0xEA,
+    0x6F, 0xFA, 0x95, 0x72, 0x97, 0x1D, 0xA1, 0xA9, 0x7A, 0xA0, 0xCA, 0x0C, 0x97, 0xC9, 0x1E, 0x77,
+    0x77, 0x0A, 0xA2, 0xE9, 0x6D, 0x91, 0xF5, 0x9D, 0x91, 0xF9, 0x49, 0xD9, 0x1F, 0xC4, 0x9D, 0x2F,
+    0xC9, 0x3A, 0xD2, 0xDA, 0xE3, 0xAD, 0x2D, 0xAA, 0xD9, 0x2A, 0xD1, 0x9D, 0xA0, 0xE2, 0xE1, 0x9D,
+    0xA0, 0xAD, 0x2E, 0x19, 0xDA, 0x1D, 0xA1, 0xE1, 0xAD, 0xA1, 0xAD, 0x1E, 0x1A, 0xDA, 0x2D, 0xA0,
+    0xE1, 0xAD, 0xA2, 0xAD, 0x9E, 0x1E, 0xA2, 0x9F, 0xCA, 0x1E, 0xA3, 0xFC, 0xA1, 0xF3, 0x9F, 0xA1,
+    0xF4, 0xFA, 0x00, 0x49, 0xA9, 0x76, 0xDA, 0x76, 0xAD, 0x77, 0x99, 0x77, 0x73, 0x9A, 0xFA, 0x97,
+    0xFF, 0xD5, 0xEA, 0x3F, 0x3E, 0xA5, 0xEA, 0x19, 0xDA, 0x7E, 0x1A, 0xD9, 0x79, 0xD9, 0x0E, 0x71,
+    0xDA, 0x0D, 0xA7, 0x1E, 0x0D, 0x97, 0x1A, 0xD0, 0xD9, 0x71, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xE7,
+    0x1D, 0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9, 0x9A, 0xAF, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0x49,
+    0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x77, 0x71, 0x9C, 0x76, 0xCA, 0x75, 0x9C, 0x97, 0x5D,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x9A, 0xFA, 0x97, 0xFF, 0xD5, 0xEA, 0x3F, 0x3E, 0xA5, 0xEA, 0x19,
+    0xDA, 0x7E, 0x1A, 0xD9, 0x79, 0xD9, 0x0E, 0x71, 0xDA, 0x0D, 0xA7, 0x1E, 0x0D, 0x97, 0x1A, 0xD0,
+    0xD9, 0x71, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9,
+    0x9A, 0xAF, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0x49, 0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x77,
+    0x70, 0xD7, 0x5E, 0xA7, 0x3C, 0xA1, 0xCA, 0x71, 0xA9, 0x39, 0x97, 0x77, 0x19, 0xAF, 0xA9, 0x7F,
+    0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D,
+    0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E, 0x71,
+    0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0x9F,
+    0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x74, 0x5A, 0xCA, 0x19, 0xA7, 0x09, 0xC0, 0xC9, 0x09, 0xA7, 0x09,
+    0xC1, 0xC9, 0xC9, 0x70, 0x99, 0x19, 0xD7, 0x77, 0x29, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3,
+    0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0,
+    0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E,
+    0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA,
+    0x97, 0x74, 0x4D, 0xA2, 0xD7, 0x0D, 0xA1, 0x9D, 0x97, 0xE1, 0xAD, 0xA7, 0x99, 0x91, 0x99, 0x99,
+    0x77, 0x70, 0x9A, 0xFA, 0x97, 0xFF, 0xD5, 0xEA, 0x3F, 0x3E, 0xA5, 0xEA, 0x19, 0xDA, 0x7E, 0x1A,
+    0xD9, 0x79, 0xD9, 0x0E, 0x71, 0xDA, 0x0D, 0xA7, 0x1E, 0x0D, 0x97, 0x1A, 0xD0, 0xD9, 0x71, 0xAD,
+    0x0D, 0xA7, 0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9, 0x9A, 0xAF, 0x2F,
+    0xFF, 0xD2, 0x9F, 0xFF, 0x49, 0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x09, 0xCA, 0x1A, 0xC9,
+    0x29, 0xDA, 0xC9, 0x49, 0xDA, 0x5F, 0x4D, 0xA9, 0xD9, 0x1A, 0xAA, 0x19, 0xAA, 0x00, 0x77, 0x77,
+    0x77, 0x0A, 0xCA, 0x77, 0x59, 0xD7, 0x76, 0xD9, 0x77, 0x5A, 0xCA, 0x77, 0x59, 0xD7, 0x76, 0xDA,
+    0x77, 0x5A, 0xD7, 0x76, 0xD9, 0x77, 0x5E, 0x76, 0x9A, 0xFA, 0xAD, 0x76, 0xFF, 0xDA, 0x75, 0xEA,
+    0x29, 0xF7, 0x4E, 0xA3, 0x9F, 0xA7, 0x29, 0xDA, 0x4F, 0xD7, 0x2A, 0xD4, 0xAD, 0x0A, 0xD9, 0x71,
+    0xE4, 0xDA, 0x1D, 0xA7, 0x1D, 0xA3, 0xE2, 0xDA, 0x71, 0xD9, 0x29, 0xD9, 0x2D, 0xA7, 0x1D, 0x92,
+    0xE3, 0xDA, 0x71, 0xDA, 0x1A, 0xD4, 0xDA, 0x71, 0xE0, 0x9D, 0xA3, 0x9D, 0xA7, 0x1A, 0xDA, 0xE4,
+    0xE9, 0x71, 0x9F, 0xCA, 0x99, 0xAF, 0xC7, 0x3F, 0xFF, 0xCA, 0x73, 0x9F, 0xFF, 0x74, 0x9F, 0xFE,
+    0x75, 0xE9, 0xAF, 0xA9, 0x75, 0xAD, 0x97, 0x74, 0x9E, 0x77, 0x5E, 0x77, 0x5A, 0xDA, 0x77, 0x5E,
+    0x77, 0x5E, 0x97, 0x74, 0x9E, 0x77, 0x5E, 0x97, 0x74, 0xAC, 0x97, 0x77, 0x77, 0x70, 0x39, 0xA7,
+    0x5D, 0x97, 0x4D, 0xA7, 0x49, 0x99, 0x77, 0x77, 0x3A, 0xAA, 0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0,
+    0xE9, 0x59, 0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D,
+    0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD,
+    0x90, 0xAE, 0x49, 0xE9, 0x09, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x00,
+    0x79, 0xC7, 0x4C, 0xA7, 0x39, 0xC9, 0x73, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x99, 0x97, 0x99,
+    0x90, 0xE9, 0x5A, 0xE0, 0xE9, 0x59, 0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6,
+    0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D,
+    0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x49, 0xE9, 0x09, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFD, 0x93,
+    0x9F, 0xF9, 0x77, 0x00, 0x77, 0x5D, 0x73, 0xEA, 0x71, 0xCA, 0x09, 0xCA, 0x7A, 0x93, 0xA9, 0x77,
+    0x77, 0x1A, 0xAA, 0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59, 0xE0, 0xE6, 0x9E, 0x0E, 0x69,
+    0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A,
+    0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x49, 0xE9, 0x09, 0xFF, 0xF2,
+    0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x00, 0x3D, 0xA2, 0xD6, 0xDA, 0x19, 0xD9, 0x49,
+    0xE1, 0xAD, 0x95, 0x99, 0x91, 0x99, 0x97, 0x77, 0x71, 0xAA, 0xA6, 0x9A, 0xAA, 0x0E, 0x95, 0xAE,
+    0x0E, 0x95, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xDA, 0x0E, 0x69, 0xDA, 0x0E, 0x69,
+    0xDA, 0x0E, 0x7D, 0xA0, 0xAD, 0x7D, 0xA0, 0xAD, 0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x0A, 0xD9, 0x5A,
+    0xD9, 0x0A, 0xE4, 0x9E, 0x90, 0x9F, 0xFF, 0x2F, 0xFF, 0x2A, 0xFF, 0xD9, 0x39, 0xFF, 0x97, 0x70,
+    0x79, 0xC7, 0x5C, 0xA7, 0x49, 0xC9, 0x74, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0xDA, 0x7A,
+    0xD1, 0x9D, 0x96, 0xD9, 0x2E, 0x5A, 0xD3, 0x9D, 0x93, 0x9D, 0x94, 0xE3, 0xE5, 0x9D, 0xA1, 0x9D,
+    0xA6, 0xE1, 0xE7, 0xAD, 0xAA, 0xDA, 0x70, 0xFD, 0x71, 0xAF, 0xA7, 0x2F, 0x73, 0xAD, 0xA7, 0x3A,
+    0xDA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0xA5, 0x71, 0xD7, 0xD7,
+    0xEA, 0xA4, 0xFD, 0xA2, 0xD1, 0x9E, 0x1D, 0x3A, 0xD0, 0xD4, 0xAC, 0x9D, 0x5C, 0x9D, 0x4A, 0xC9,
+    0xD3, 0xE0, 0xD9, 0x0A, 0xE1, 0xFD, 0xA2, 0xFA, 0x4D, 0x7D, 0x7D, 0x70, 0x76, 0xAF, 0x94, 0xD9,
+    0x19, 0xC9, 0x29, 0xC9, 0x39, 0xC2, 0xAC, 0x5C, 0x2D, 0x3D, 0xA2, 0xD2, 0xCA, 0x4D, 0x2C, 0x5D,
+    0x2C, 0x94, 0xD2, 0xD9, 0x3D, 0x3D, 0xA2, 0xD4, 0xE1, 0xD9, 0x4A, 0xC9, 0x0D, 0x94, 0x9C, 0x90,
+    0xD9, 0xAA, 0x99, 0xAD, 0x99, 0xD9, 0xAF, 0xD0, 0x9D, 0x99, 0xAE, 0xA1, 0x29, 0x72, 0xD9, 0x71,
+    0xDA, 0x71, 0x9A, 0xA7, 0x73, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19,
+    0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA,
+    0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x77, 0x19, 0xC7, 0x1D, 0x71, 0xCA, 0x70, 0xAC,
+    0x77, 0x77, 0x77, 0x70, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5,
+    0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A,
+    0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x77, 0x0A, 0xC7, 0x09, 0xDA, 0x69, 0xC9, 0x9C, 0xA4,
+    0x9C, 0x3A, 0xA7, 0x71, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5,
+    0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A,
+    0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x2A, 0xCA, 0x2A, 0x4C, 0x9A, 0xA0, 0x9C, 0x39, 0xC1,
+    0xC9, 0xAA, 0x39, 0xC1, 0x9D, 0x77, 0x2A, 0xE9, 0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39,
+    0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9, 0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F,
+    0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9, 0x0D, 0x1A, 0xD2, 0xD9, 0x2E, 0x2D, 0xA2, 0xE1,
+    0x9D, 0xA2, 0x99, 0x92, 0x99, 0x97, 0x70, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3,
+    0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1,
+    0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x4A, 0xAA, 0x7A, 0x1A, 0x7C, 0x90,
+    0xA9, 0x69, 0xE7, 0x77, 0x7A, 0xE9, 0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39, 0xD1, 0x9C,
+    0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9, 0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F, 0xFC, 0xA1,
+    0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9, 0x0D, 0x75, 0x99, 0x70, 0xAE, 0x99, 0x90, 0xAF, 0xA5, 0xFF,
+    0xDA, 0x2C, 0xA3, 0xAC, 0xA2, 0xF9, 0x4C, 0x92, 0xCA, 0x39, 0xDA, 0x29, 0x99, 0xD1, 0x9C, 0x5F,
+    0xFE, 0x1A, 0xC5, 0xEA, 0xAA, 0x99, 0x99, 0x2D, 0x5D, 0x97, 0x1D, 0x49, 0xE7, 0x1A, 0xD9, 0x1A,
+    0xFC, 0x97, 0x0F, 0xFF, 0xFC, 0xA2, 0xAF, 0xDA, 0xFF, 0xCA, 0x39, 0xAD, 0xA9, 0x0D, 0x9A, 0xFA,
+    0x10, 0x73, 0x9A, 0xEA, 0x29, 0xFD, 0x2D, 0xA5, 0xAD, 0x6A, 0xC9, 0x6D, 0x96, 0xD9, 0x6A, 0xCA,
+    0x6A, 0xD9, 0x6F, 0x9A, 0xA2, 0x9F, 0xDA, 0x29, 0xAF, 0xA4, 0xA7, 0x0A, 0xAA, 0x97, 0x9A, 0x5E,
+    0x74, 0x1D, 0x97, 0x1D, 0xA7, 0x1A, 0xD7, 0x77, 0x77, 0x59, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9,
+    0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x92,
+    0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x10, 0x5C, 0xA7,
+    0x09, 0xC9, 0x70, 0xAC, 0x71, 0xCA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0x97, 0xAF, 0x94, 0xD9,
+    0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA,
+    0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x10,
+    0x4A, 0x71, 0xAD, 0x7A, 0xCA, 0xCA, 0x5A, 0xC2, 0xCA, 0x49, 0x49, 0x77, 0x77, 0x99, 0x7A, 0xF9,
+    0x4D, 0x91, 0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C, 0xA2, 0x99, 0xAC, 0xA0, 0xAF, 0xFD, 0x0A, 0xCA,
+    0xAA, 0xA9, 0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAF, 0xF9, 0x2F, 0xF9, 0x39, 0xAF,
+    0x91, 0x19, 0x93, 0x99, 0x3D, 0x91, 0xAD, 0x29, 0xD9, 0x1E, 0x2A, 0xDA, 0x1E, 0x97, 0x77, 0x77,
+    0x19, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A,
+    0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92,
+    0xFF, 0x93, 0x9A, 0xF9, 0x10, 0x0A, 0xC9, 0x4D, 0xA4, 0xAD, 0x77, 0x29, 0x94, 0xCA, 0x4C, 0xA4,
+    0xCA, 0x4C, 0xA4, 0xCA, 0x39, 0xCA, 0x39, 0xCA, 0x39, 0xD3, 0x9D, 0x3A, 0xD3, 0xAD, 0x00, 0x1A,
+    0xC1, 0xC9, 0x0A, 0xC1, 0xCA, 0x77, 0x5A, 0x91, 0xCA, 0x1C, 0xA1, 0xCA, 0x1C, 0xA1, 0xCA, 0x09,
+    0xCA, 0x09, 0xCA, 0x09, 0xD0, 0x9D, 0x0A, 0xD0, 0xAD, 0x00, 0x3A, 0x6A, 0xD4, 0xAC, 0xAC, 0xA2,
+    0xAC, 0x2C, 0xA1, 0x94, 0x97, 0x59, 0x96, 0xCA, 0x6C, 0xA6, 0xCA, 0x6C, 0xA6, 0xCA, 0x59, 0xCA,
+    0x59, 0xCA, 0x59, 0xD5, 0x9D, 0x5A, 0xD5, 0xAD, 0x20, 0x19, 0x92, 0x99, 0x2A, 0xD2, 0xDA, 0x1A,
+    0xD2, 0xE1, 0xE9, 0x09, 0xE7, 0x77, 0x39, 0x71, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70,
+    0xCA, 0x79, 0xCA, 0x79, 0xCA, 0x79, 0xD7, 0x9D, 0x7A, 0xD7, 0xAD, 0x30, 0x79, 0x75, 0x9E, 0x75,
+    0x9C, 0xA7, 0x1A, 0xFF, 0x95, 0xAF, 0xF9, 0x71, 0xCA, 0x79, 0xA9, 0x2C, 0x95, 0xAF, 0xC9, 0x0C,
+    0x94, 0x9D, 0x91, 0xD9, 0xC5, 0xD9, 0x3E, 0x5D, 0x4A, 0xD4, 0x9D, 0x49, 0xCA, 0x5D, 0x49, 0xC9,
+    0x5D, 0xA3, 0xD6, 0xAE, 0xAE, 0xA7, 0xFE, 0x71, 0xAE, 0xA7, 0x2A, 0xCA, 0x2A, 0x3C, 0x9A, 0xA0,
+    0x9A, 0x29, 0xC1, 0xC9, 0xAA, 0x29, 0xC1, 0x9D, 0x77, 0x70, 0xA9, 0x09, 0xAA, 0x93, 0xFF, 0x2E,
+    0x91, 0xAC, 0xA1, 0xD9, 0x3D, 0x09, 0xD4, 0xD0, 0x9D, 0x4D, 0x99, 0xD4, 0xD9, 0xAD, 0x4D, 0x9A,
+    0xD4, 0xDA, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xE4, 0xDA, 0x1A, 0xA7, 0x2D, 0x97, 0x1D, 0xA7, 0x29,
+    0x77, 0x77, 0x73, 0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29, 0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95,
+    0xD0, 0xAC, 0x95, 0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49, 0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3,
+    0xFE, 0x94, 0xAE, 0xA3, 0x5C, 0xA7, 0x09, 0xC9, 0x70, 0xD7, 0x09, 0xCA, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x73, 0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29, 0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95, 0xD0,
+    0xAC, 0x95, 0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49, 0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3, 0xFE,
+    0x94, 0xAE, 0xA3, 0x49, 0x71, 0xAC, 0xA7, 0xAE, 0x95, 0xAC, 0x19, 0xC9, 0x39, 0xA4, 0xA7, 0x77,
+    0x77, 0x1A, 0xEA, 0x5F, 0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A,
+    0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9,
+    0x4A, 0xEA, 0x30, 0x19, 0xD9, 0x1C, 0x4C, 0xA9, 0xC9, 0x0C, 0x4C, 0x90, 0x9D, 0xA4, 0x97, 0x77,
+    0x77, 0x7A, 0xEA, 0x5F, 0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A,
+    0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9,
+    0x4A, 0xEA, 0x30, 0x09, 0xD2, 0xAD, 0x29, 0xD9, 0x1E, 0x2A, 0xD9, 0x1E, 0x29, 0x99, 0x29, 0x99,
+    0x77, 0x77, 0x70, 0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29, 0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95,
+    0xD0, 0xAC, 0x95, 0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49, 0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3,
+    0xFE, 0x94, 0xAE, 0xA3, 0x59, 0x97, 0x2A, 0xD7, 0x2E, 0x72, 0xE7, 0x77, 0x73, 0x99, 0x99, 0x9A,
+    0xAA, 0xAA, 0x91, 0xFF, 0xF7, 0x74, 0x99, 0x72, 0xAD, 0x72, 0xE7, 0x2E, 0x50, 0x72, 0x97, 0x2C,
+    0xA7, 0x19, 0xC9, 0x71, 0xAC, 0x72, 0xD7, 0x19, 0xC9, 0x71, 0xAC, 0x72, 0xD7, 0x2C, 0xA7, 0x19,
+    0xC9, 0x6A, 0xF9, 0x5F, 0xE9, 0x3D, 0x90, 0x9C, 0xAD, 0x29, 0xCA, 0x1A, 0xC9, 0x9C, 0xA1, 0xAC,
+    0x91, 0xD1, 0xD1, 0xAC, 0x90, 0x9C, 0xA1, 0xD1, 0xD9, 0x0A, 0xC9, 0x1D, 0x1A, 0xCA, 0x0D, 0x19,
+    0xD1, 0x9D, 0xAD, 0x09, 0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5F, 0xA6, 0x9D, 0x71, 0xAC, 0x97, 0x1D,
+    0x71, 0x9D, 0x71, 0xAC, 0xA7, 0x1D, 0x97, 0x1D, 0x71, 0x9D, 0x71, 0xD7, 0x2A, 0x77, 0x70, 0x73,
+    0x9D, 0x70, 0x9D, 0x97, 0x0A, 0xC9, 0x77, 0x71, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0,
+    0xAC, 0x94, 0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E,
+    0xAA, 0xF9, 0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x77, 0x9C, 0x70, 0xCA, 0x79,
+    0xC9, 0x7D, 0x77, 0x77, 0x77, 0x73, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94,
+    0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA, 0xF9,
+    0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x3C, 0xA7, 0xAD, 0x95, 0xAC, 0x9A, 0xC9,
+    0x3A, 0xA2, 0x9C, 0x97, 0x77, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0,
+    0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA, 0xF9, 0x0F,
+    0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x09, 0x93, 0x99, 0x2D, 0xA2, 0xD9, 0x1E, 0x19,
+    0xD9, 0x09, 0xE1, 0xAD, 0xA7, 0x76, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94,
+    0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA, 0xF9,
+    0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x5A, 0xC7, 0x1C, 0xA7, 0x0A, 0xC9, 0x70,
+    0xD7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xC9, 0x5D, 0x1D, 0x5D, 0x1A, 0xCA, 0x39, 0xCA, 0x2D,
+    0x3D, 0x92, 0xAC, 0xA2, 0xD9, 0x29, 0xD9, 0x09, 0xD4, 0xE0, 0xAD, 0x49, 0xD9, 0xDA, 0x5F, 0xC9,
+    0x59, 0xF7, 0xF7, 0xAD, 0xA7, 0xAD, 0x97, 0xE6, 0x9E, 0xA4, 0xFD, 0x5F, 0xA6, 0xAA, 0xA7, 0x09,
+    0x79, 0xC9, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xEA, 0x49, 0xDA, 0xDA, 0x3C, 0xA1, 0xAC, 0xA2, 0xCA,
+    0x2A, 0xCA, 0x1C, 0xA3, 0xAC, 0x1C, 0xA3, 0xAC, 0x1C, 0xA3, 0xD1, 0xCA, 0x3C, 0xA1, 0xCA, 0x2D,
+    0x2C, 0xA0, 0x9D, 0x92, 0xFC, 0x93, 0xEA, 0x5C, 0xA7, 0xD7, 0xD7, 0xD7, 0xCA, 0x60, 0x19, 0x93,
+    0x99, 0x3D, 0xA1, 0x9D, 0x3D, 0xA1, 0xAD, 0x91, 0x9E, 0x1E, 0x97, 0x77, 0x77, 0x70, 0xAC, 0x95,
+    0xD1, 0xD5, 0xD1, 0xAC, 0xA3, 0x9C, 0xA2, 0xD3, 0xD9, 0x2A, 0xCA, 0x2D, 0x92, 0x9D, 0x90, 0x9D,
+    0x4E, 0x0A, 0xD4, 0x9D, 0x9D, 0xA5, 0xFC, 0x95, 0x9F, 0x7F, 0x7A, 0xDA, 0x7A, 0xD9, 0x7E, 0x69,
+    0xEA, 0x4F, 0xD5, 0xFA, 0x6A, 0xAA, 0x70, 0x49, 0x99, 0x9A, 0xAA, 0xA7, 0x9F, 0xF9, 0x77, 0x77,
+    0x77, 0x74, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0,
+    0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9,
+    0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92,
+    0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x29, 0x99, 0xAA, 0xAA, 0x92, 0xFF, 0xA7, 0x77,
+    0x4A, 0xE9, 0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39, 0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1,
+    0xD5, 0xD9, 0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F, 0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29,
+    0xAD, 0xA9, 0x0D, 0x77, 0x5C, 0x4A, 0xC7, 0x0C, 0xA3, 0xCA, 0x70, 0x9F, 0xD7, 0x29, 0xEA, 0x77,
+    0x77, 0x77, 0x77, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19,
+    0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6,
+    0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF,
+    0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x75, 0xAA, 0x4C, 0x3A, 0xC9, 0x2A, 0xC4,
+    0xFD, 0x95, 0xAD, 0xA9, 0x77, 0x76, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D,
+    0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF,
+    0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x69, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC,
+    0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD,
+    0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA,
+    0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA7,
+    0x4C, 0x97, 0x5A, 0x97, 0x6C, 0x77, 0xAD, 0x97, 0x69, 0x10, 0x77, 0x0A, 0xE9, 0x99, 0x4F, 0xF3,
+    0xAC, 0xA2, 0xE3, 0xCA, 0x39, 0xD2, 0x9C, 0x5D, 0x2A, 0xC5, 0xD2, 0xD5, 0xD9, 0x1D, 0x49, 0xD9,
+    0x1A, 0xD9, 0x1A, 0xEA, 0x2F, 0xFC, 0xA2, 0xAF, 0xDA, 0xCA, 0x39, 0xAD, 0xA9, 0x9D, 0x70, 0x9C,
+    0x72, 0xAA, 0x72, 0x9E, 0x72, 0x99, 0x00, 0x77, 0x5A, 0xA7, 0x3C, 0x97, 0x2A, 0xC7, 0x3C, 0xA7,
+    0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFA, 0x4A, 0xFF, 0x3F, 0xA9, 0x99, 0xA9, 0x2E, 0xA7, 0x09,
+    0xDA, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xA7, 0x1F, 0xA7,
+    0x0A, 0xFD, 0xAA, 0xAA, 0xD1, 0xFF, 0xF1, 0xAF, 0xFE, 0x2A, 0xFF, 0xD3, 0x9A, 0xFD, 0xA9, 0x75,
+    0x76, 0xAC, 0x7C, 0xA6, 0x9C, 0x96, 0xD7, 0x77, 0x73, 0x9A, 0xEA, 0x29, 0xFD, 0x2D, 0xA5, 0xAD,
+    0x6A, 0xC9, 0x6D, 0x96, 0xD9, 0x6A, 0xCA, 0x6A, 0xD9, 0x6F, 0x9A, 0xA2, 0x9F, 0xDA, 0x3A, 0xFA,
+    0x72, 0x69, 0x73, 0x9D, 0x71, 0x9C, 0xAC, 0xA7, 0x9C, 0x91, 0xCA, 0x6A, 0x49, 0x97, 0x77, 0x77,
+    0x72, 0x9A, 0xFA, 0x4A, 0xFF, 0x3F, 0xA9, 0x99, 0xA9, 0x2E, 0xA7, 0x09, 0xDA, 0x71, 0xE7, 0x19,
+    0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x72, 0xE7, 0x2E, 0xA7, 0x1F, 0xA7, 0x0A, 0xFD, 0xAA, 0xAA,
+    0xD1, 0xFF, 0xF1, 0xAF, 0xFE, 0x2A, 0xFF, 0xD3, 0x9A, 0xFD, 0xA9, 0x75, 0x39, 0x96, 0x9D, 0x59,
+    0xCA, 0xD3, 0x9C, 0x91, 0xAC, 0x29, 0x59, 0x74, 0x9A, 0xEA, 0x29, 0xFD, 0x2D, 0xA5, 0xAD, 0x6A,
+    0xC9, 0x6D, 0x96, 0xD9, 0x6A, 0xCA, 0x6A, 0xD9, 0x6F, 0x9A, 0xA2, 0x9F, 0xDA, 0x3A, 0xFA, 0x72,
+    0x59, 0xD7, 0x2A, 0xD7, 0x2E, 0x97, 0x19, 0x99, 0x77, 0x77, 0x77, 0x77, 0x39, 0xAF, 0xA4, 0xAF,
+    0xF3, 0xFA, 0x99, 0x9A, 0x92, 0xEA, 0x70, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E,
+    0x72, 0xE7, 0x2E, 0x72, 0xEA, 0x71, 0xFA, 0x70, 0xAF, 0xDA, 0xAA, 0xAD, 0x1F, 0xFF, 0x1A, 0xFF,
+    0xE2, 0xAF, 0xFD, 0x39, 0xAF, 0xDA, 0x97, 0x50, 0x39, 0x97, 0xD9, 0x59, 0xD9, 0x5A, 0xDA, 0x77,
+    0x77, 0x29, 0xAE, 0xA2, 0x9F, 0xD2, 0xDA, 0x5A, 0xD6, 0xAC, 0x96, 0xD9, 0x6D, 0x96, 0xAC, 0xA6,
+    0xAD, 0x96, 0xF9, 0xAA, 0x29, 0xFD, 0xA3, 0xAF, 0xA7, 0x20, 0x3A, 0x93, 0xA9, 0x6C, 0xA0, 0x9C,
+    0x97, 0x0E, 0x97, 0x2C, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9A, 0xFA, 0x4A, 0xFF, 0x3F, 0xA9,
+    0x99, 0xA9, 0x2E, 0xA7, 0x09, 0xDA, 0x71, 0xE7, 0x19, 0xD9, 0x71, 0xAD, 0x72, 0xE7, 0x2E, 0x72,
+    0xE7, 0x2E, 0xA7, 0x1F, 0xA7, 0x0A, 0xFD, 0xAA, 0xAA, 0xD1, 0xFF, 0xF1, 0xAF, 0xFE, 0x2A, 0xFF,
+    0xD3, 0x9A, 0xFD, 0xA9, 0x75, 0x72, 0xAA, 0x3C, 0x92, 0xAC, 0x99, 0xC9, 0x4A, 0xDA, 0x6D, 0x77,
+    0x77, 0x39, 0xAE, 0xA2, 0x9F, 0xD2, 0xDA, 0x5A, 0xD6, 0xAC, 0x96, 0xD9, 0x6D, 0x96, 0xAC, 0xA6,
+    0xAD, 0x96, 0xF9, 0xAA, 0x29, 0xFD, 0xA3, 0xAF, 0xA7, 0x20, 0x77, 0x39, 0xC9, 0x2A, 0xC7, 0x19,
+    0xCA, 0x0D, 0x74, 0xE7, 0x59, 0xC7, 0x77, 0x77, 0x77, 0x4F, 0xCA, 0xA9, 0x70, 0xFF, 0xCA, 0x6F,
+    0xFE, 0x94, 0xD9, 0x39, 0xF9, 0x3D, 0x95, 0x9E, 0x3D, 0x96, 0xAD, 0xA2, 0xD9, 0x7E, 0x2D, 0x97,
+    0xAD, 0x2D, 0x97, 0xAD, 0x91, 0xD9, 0x79, 0xDA, 0x1D, 0x97, 0x9D, 0xA1, 0xD9, 0x7A, 0xDA, 0x1D,
+    0x96, 0xAE, 0x91, 0xDA, 0x99, 0x9A, 0xAA, 0xFC, 0x2F, 0xFF, 0xCA, 0x2F, 0xFF, 0xC3, 0xFF, 0xEA,
+    0x4F, 0xFA, 0x95, 0x71, 0xAC, 0x97, 0x5A, 0xC9, 0x19, 0x72, 0xAC, 0x90, 0x9C, 0x97, 0x1A, 0xC1,
+    0x9C, 0x97, 0x1A, 0xC1, 0xAC, 0x97, 0x1D, 0x1A, 0xC4, 0xAE, 0xA0, 0xD7, 0xAF, 0xCA, 0xD6, 0xAC,
+    0xA1, 0x9F, 0x6D, 0x4E, 0x59, 0xC9, 0x4E, 0x5A, 0xC5, 0xAD, 0x5A, 0xC9, 0x4E, 0x5A, 0xCA, 0x4E,
+    0x59, 0xE9, 0x9A, 0xF6, 0xFF, 0xD6, 0x9F, 0xFC, 0x70, 0xAE, 0xA0, 0xD7, 0x75, 0x2F, 0xCA, 0xA9,
+    0x72, 0xFF, 0xCA, 0x70, 0xFF, 0xE9, 0x6D, 0x93, 0x9F, 0x95, 0xD9, 0x59, 0xE5, 0xD9, 0x6A, 0xDA,
+    0x4D, 0x97, 0xE4, 0xD9, 0x7A, 0xD1, 0xFF, 0xC4, 0x9D, 0x90, 0xFF, 0xC4, 0x9D, 0xA3, 0xD9, 0x79,
+    0xDA, 0x3D, 0x97, 0xAD, 0xA3, 0xD9, 0x6A, 0xE9, 0x3D, 0xA9, 0x99, 0xAA, 0xFD, 0x4F, 0xFF, 0xCA,
+    0x4F, 0xFF, 0xC5, 0xFF, 0xEA, 0x6F, 0xFA, 0x95, 0x71, 0xAC, 0x97, 0x4A, 0xC9, 0x74, 0xAC, 0x97,
+    0x09, 0xFF, 0xA5, 0x9F, 0xFA, 0x71, 0xAC, 0x7A, 0xEA, 0x0D, 0x6A, 0xFC, 0xAD, 0x5A, 0xCA, 0x19,
+    0xF5, 0xD4, 0xE4, 0x9C, 0x94, 0xE4, 0xAC, 0x5A, 0xD4, 0xAC, 0x94, 0xE4, 0xAC, 0xA4, 0xE4, 0x9E,
+    0x99, 0xAF, 0x5F, 0xFD, 0x59, 0xFF, 0xC7, 0xAE, 0xA0, 0xD7, 0x73, 0x77, 0xFF, 0x39, 0xAA, 0xAA,
+    0xA9, 0x99, 0x77, 0x77, 0x19, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71,
+    0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9,
+    0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF,
+    0xE1, 0xFF, 0xE0, 0x74, 0x9F, 0xF2, 0xAA, 0xAA, 0xAA, 0x99, 0x97, 0x77, 0x77, 0x29, 0x97, 0xAF,
+    0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC,
+    0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A,
+    0xF9, 0x10, 0x77, 0xC4, 0xAC, 0x4C, 0xA3, 0xCA, 0x49, 0xFD, 0x69, 0xAD, 0xA7, 0x77, 0x77, 0x70,
+    0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA, 0x1A, 0xFF, 0xC9, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A, 0xA9, 0x3A, 0xFE, 0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D,
+    0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x74,
+    0x9C, 0x4A, 0xA3, 0xCA, 0x29, 0xC9, 0x39, 0xFD, 0x59, 0xEA, 0x77, 0x77, 0x77, 0x70, 0x99, 0x7A,
+    0xF9, 0x4D, 0x91, 0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C, 0xA2, 0x99, 0xAC, 0xA0, 0xAF, 0xFD, 0x0A,
+    0xCA, 0xAA, 0xA9, 0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAF, 0xF9, 0x2F, 0xF9, 0x39,
+    0xAF, 0x91, 0x59, 0x97, 0x19, 0xD7, 0x1A, 0xD9, 0x70, 0xE9, 0x77, 0x77, 0x77, 0x09, 0x99, 0x99,
+    0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA,
+    0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x49, 0x97, 0x0A, 0xD7,
+    0x0A, 0xD7, 0x0E, 0x97, 0x77, 0x77, 0x77, 0x09, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4,
+    0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A,
+    0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x10, 0x59, 0x99, 0x99, 0x91,
+    0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE5, 0xAA, 0x72, 0xC7, 0x29, 0xC9,
+    0x97, 0x19, 0xD9, 0x77, 0x00, 0x49, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19,
+    0xCA, 0x29, 0x99, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x99, 0x1D, 0x71, 0xAC, 0xA7,
+    0x09, 0xDA, 0x70, 0xFD, 0xAD, 0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x6A, 0xA7, 0x0A, 0xA7, 0x1C, 0x72,
+    0xCA, 0x97, 0x09, 0xD9, 0x77, 0x2A, 0x93, 0xA9, 0x5D, 0x09, 0xCA, 0x7E, 0xA7, 0x1D, 0x77, 0x77,
+    0x77, 0x19, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A,
+    0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA,
+    0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0,
+    0x75, 0xCA, 0x29, 0xC5, 0xD0, 0xAC, 0x7E, 0x71, 0xCA, 0x77, 0x77, 0x77, 0x71, 0x99, 0x7A, 0xF9,
+    0x4D, 0x91, 0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C, 0xA2, 0x99, 0xAC, 0xA0, 0xAF, 0xFD, 0x0A, 0xCA,
+    0xAA, 0xA9, 0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAF, 0xF9, 0x2F, 0xF9, 0x39, 0xAF,
+    0x91, 0x79, 0xC7, 0x59, 0xDA, 0x73, 0x9C, 0xA9, 0xCA, 0x71, 0x9C, 0x92, 0xAA, 0x77, 0x77, 0x72,
+    0x9A, 0xFD, 0xA5, 0xAF, 0xFD, 0x93, 0xAE, 0xA7, 0x3E, 0x97, 0x3A, 0xDA, 0x74, 0xE9, 0x74, 0xE7,
+    0x5E, 0x75, 0xE7, 0x5E, 0x5E, 0xAA, 0x91, 0xE5, 0xAF, 0xCA, 0x0E, 0x70, 0xAD, 0xA0, 0xAD, 0xA7,
+    0xAC, 0x91, 0x9E, 0xA6, 0xD9, 0x2F, 0xFF, 0xCA, 0x2A, 0xFF, 0xFA, 0x3A, 0xFF, 0xE9, 0x5A, 0xAF,
+    0xCA, 0x92, 0x4C, 0x70, 0xE6, 0xD9, 0xD4, 0xCA, 0x2A, 0xC7, 0x77, 0x2A, 0xDA, 0x09, 0xC9, 0x09,
+    0xFF, 0xA0, 0xD9, 0x09, 0xF9, 0x9C, 0x93, 0xE9, 0xAC, 0x4A, 0xD9, 0xD4, 0x9D, 0x9A, 0xC4, 0x9D,
+    0x9A, 0xC4, 0xAD, 0x99, 0xCA, 0x99, 0x9A, 0xE1, 0xFF, 0xC1, 0x9F, 0xF3, 0xAD, 0xA0, 0xD7, 0xAD,
+    0x19, 0x3A, 0xDA, 0x1F, 0xF1, 0x9F, 0xE9, 0x29, 0xAE, 0xA9, 0x20, 0x77, 0x5A, 0xA4, 0xC9, 0x79,
+    0xC9, 0x2A, 0xC7, 0x1F, 0xD9, 0x72, 0xAE, 0x97, 0x77, 0x77, 0x77, 0x49, 0xAF, 0xDA, 0x5A, 0xFF,
+    0xD9, 0x3A, 0xEA, 0x73, 0xE9, 0x73, 0xAD, 0xA7, 0x4E, 0x97, 0x4E, 0x75, 0xE7, 0x5E, 0x75, 0xE5,
+    0xEA, 0xA9, 0x1E, 0x5A, 0xFC, 0xA0, 0xE7, 0x0A, 0xDA, 0x0A, 0xDA, 0x7A, 0xC9, 0x19, 0xEA, 0x6D,
+    0x92, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x95, 0xAA, 0xFC, 0xA9, 0x20, 0x73, 0x9C,
+    0x4C, 0xA2, 0xCA, 0x29, 0xC9, 0x2A, 0xFC, 0xA4, 0x9E, 0x97, 0x77, 0x76, 0xAD, 0xA0, 0x9C, 0x90,
+    0x9F, 0xFA, 0x0D, 0x90, 0x9F, 0x99, 0xC9, 0x3E, 0x9A, 0xC4, 0xAD, 0x9D, 0x49, 0xD9, 0xAC, 0x49,
+    0xD9, 0xAC, 0x4A, 0xD9, 0x9C, 0xA9, 0x99, 0xAE, 0x1F, 0xFC, 0x19, 0xFF, 0x3A, 0xDA, 0x0D, 0x7A,
+    0xD1, 0x93, 0xAD, 0xA1, 0xFF, 0x19, 0xFE, 0x92, 0x9A, 0xEA, 0x92, 0x79, 0x97, 0x6D, 0xA7, 0x5E,
+    0x74, 0x9E, 0x77, 0x77, 0x77, 0x75, 0x9A, 0xFD, 0xA5, 0xAF, 0xFD, 0x93, 0xAE, 0xA7, 0x3E, 0x97,
+    0x3A, 0xDA, 0x74, 0xE9, 0x74, 0xE7, 0x5E, 0x75, 0xE7, 0x5E, 0x5E, 0xAA, 0x91, 0xE5, 0xAF, 0xCA,
+    0x0E, 0x70, 0xAD, 0xA0, 0xAD, 0xA7, 0xAC, 0x91, 0x9E, 0xA6, 0xD9, 0x2F, 0xFF, 0xCA, 0x2A, 0xFF,
+    0xFA, 0x3A, 0xFF, 0xE9, 0x5A, 0xAF, 0xCA, 0x92, 0x49, 0x97, 0xAD, 0x7E, 0x7E, 0x77, 0x77, 0x7A,
+    0xDA, 0x09, 0xC9, 0x09, 0xFF, 0xA0, 0xD9, 0x09, 0xF9, 0x9C, 0x93, 0xE9, 0xAC, 0x4A, 0xD9, 0xD4,
+    0x9D, 0x9A, 0xC4, 0x9D, 0x9A, 0xC4, 0xAD, 0x99, 0xCA, 0x99, 0x9A, 0xE1, 0xFF, 0xC1, 0x9F, 0xF3,
+    0xAD, 0xA0, 0xD7, 0xAD, 0x19, 0x3A, 0xDA, 0x1F, 0xF1, 0x9F, 0xE9, 0x29, 0xAE, 0xA9, 0x20, 0x77,
+    0x59, 0xAF, 0xDA, 0x5A, 0xFF, 0xD9, 0x3A, 0xEA, 0x73, 0xE9, 0x73, 0xAD, 0xA7, 0x4E, 0x97, 0x4E,
+    0x75, 0xE7, 0x5E, 0x75, 0xE5, 0xEA, 0xA9, 0x1E, 0x5A, 0xFC, 0xA0, 0xE7, 0x0A, 0xDA, 0x0A, 0xDA,
+    0x7A, 0xC9, 0x19, 0xEA, 0x6D, 0x92, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x95, 0xAA,
+    0xFC, 0xA9, 0x77, 0x77, 0x77, 0x75, 0xE9, 0x73, 0x9E, 0x74, 0x9E, 0x74, 0x9D, 0xA7, 0x4E, 0x97,
+    0x4E, 0x60, 0x39, 0xE6, 0xAE, 0x6A, 0xDA, 0x6A, 0xD9, 0x6E, 0x69, 0xDA, 0x77, 0x74, 0xAD, 0xA0,
+    0x9C, 0x90, 0x9F, 0xFA, 0x0D, 0x90, 0x9F, 0x99, 0xC9, 0x3E, 0x9A, 0xC4, 0xAD, 0x9D, 0x49, 0xD9,
+    0xAC, 0x49, 0xD9, 0xAC, 0x4A, 0xD9, 0x9C, 0xA9, 0x99, 0xAE, 0x1F, 0xFC, 0x19, 0xFF, 0x3A, 0xDA,
+    0x0D, 0x7A, 0xD1, 0x93, 0xAD, 0xA1, 0xFF, 0x19, 0xFE, 0x92, 0x9A, 0xEA, 0x92, 0x77, 0x6D, 0x74,
+    0xAE, 0x72, 0xAC, 0x90, 0xD7, 0x09, 0xA3, 0x9A, 0x77, 0x59, 0x97, 0x99, 0x2A, 0xD7, 0xDA, 0x1A,
+    0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A, 0xD7, 0xE1, 0xAD, 0x7E, 0x1A, 0xD7, 0xE1, 0xE7, 0xE1, 0xE7,
+    0xE1, 0xE7, 0xE1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xE9, 0x59, 0xE1,
+    0xE9, 0x59, 0xE1, 0xE9, 0x59, 0xE9, 0x0E, 0xA5, 0x9E, 0x90, 0x77, 0xAC, 0x97, 0x09, 0xE7, 0x9C,
+    0x90, 0xAC, 0x59, 0xA3, 0x9A, 0x7A, 0xC9, 0x71, 0xAC, 0x72, 0xAC, 0x72, 0xD7, 0x2D, 0x72, 0xD7,
+    0x2D, 0x0F, 0x94, 0xFF, 0xA3, 0xEA, 0x90, 0xAD, 0x3D, 0xA3, 0xAC, 0x91, 0x9D, 0x49, 0xC9, 0x19,
+    0xD4, 0x9C, 0xA1, 0x9D, 0x49, 0xCA, 0x1A, 0xD4, 0x9C, 0xA1, 0xAD, 0x49, 0xCA, 0x1A, 0xD4, 0xAD,
+    0x1A, 0xD4, 0xAD, 0x1E, 0x4E, 0x19, 0xAA, 0x7A, 0xA9, 0x2A, 0xD7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A,
+    0xD7, 0xDA, 0x2A, 0xD7, 0xE2, 0xAD, 0x7E, 0x1F, 0xFF, 0xF0, 0xFF, 0xFE, 0xA1, 0xE7, 0xE2, 0xE7,
+    0xE2, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0xFF, 0xFD, 0x2F, 0xFF, 0xD2, 0xE9, 0x59, 0xE2, 0xE9, 0x59,
+    0xE2, 0xE9, 0x59, 0xE9, 0x1E, 0xA5, 0x9E, 0x90, 0x3A, 0xC9, 0x72, 0xAC, 0x73, 0xAC, 0x99, 0x95,
+    0xFF, 0x59, 0x99, 0xD7, 0x3D, 0x73, 0xD0, 0xF9, 0x5F, 0xFA, 0x4E, 0xA9, 0x0A, 0xD4, 0xDA, 0x3A,
+    0xC9, 0x29, 0xD4, 0x9C, 0x92, 0x9D, 0x49, 0xCA, 0x29, 0xD4, 0x9C, 0xA2, 0xAD, 0x49, 0xCA, 0x2A,
+    0xD4, 0x9C, 0xA2, 0xAD, 0x4A, 0xD2, 0xAD, 0x4A, 0xD2, 0xE4, 0xE0, 0x69, 0x09, 0xD2, 0xC0, 0xC9,
+    0x9C, 0x09, 0xC0, 0xC1, 0x9D, 0x97, 0x77, 0x72, 0xAA, 0xA4, 0xE4, 0xE4, 0xE4, 0xAD, 0x4A, 0xD4,
+    0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4A, 0xD4, 0xAD, 0x4E, 0x93, 0xE9, 0x3E, 0x93, 0xEA,
+    0x3E, 0xA0, 0x0D, 0x91, 0xC9, 0xAA, 0x0C, 0x90, 0xC0, 0xC9, 0x1E, 0x09, 0x77, 0x71, 0xC9, 0x5C,
+    0xA5, 0xCA, 0x5C, 0xA5, 0xCA, 0x5C, 0xA4, 0x9C, 0xA4, 0x9C, 0xA4, 0x9D, 0x49, 0xD4, 0xAD, 0x4A,
+    0xD2, 0x19, 0x99, 0xAA, 0xAA, 0x91, 0xFF, 0xC7, 0x77, 0x77, 0x70, 0xAA, 0xA7, 0xE7, 0xE7, 0xE7,
+    0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7A, 0xD7, 0xAD, 0x7E, 0x96, 0xE9,
+    0x6E, 0x96, 0xEA, 0x6E, 0xA2, 0x71, 0x9F, 0xF0, 0x9A, 0xAA, 0xAA, 0x99, 0x97, 0x77, 0x0A, 0x97,
+    0xCA, 0x7C, 0xA7, 0xCA, 0x7C, 0xA7, 0xCA, 0x69, 0xCA, 0x69, 0xCA, 0x69, 0xD6, 0x9D, 0x6A, 0xD6,
+    0xAD, 0x30, 0x0A, 0xAA, 0x1E, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1,
+    0xAD, 0x1A, 0xD1, 0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x90, 0xAD, 0x90, 0xEA, 0x0E, 0xA0, 0xEA, 0x09,
+    0xC2, 0xC2, 0x9C, 0x3E, 0x39, 0x00, 0x09, 0xD1, 0xAD, 0x1E, 0x90, 0x99, 0x97, 0x49, 0x3C, 0xA2,
+    0xCA, 0x2C, 0xA2, 0xCA, 0x2C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xD1,
+    0xC9, 0x1A, 0xA2, 0xAA, 0x99, 0x1A, 0xD5, 0x09, 0x92, 0xDA, 0x1E, 0x09, 0xE7, 0x75, 0x99, 0x91,
+    0xE1, 0xE1, 0xE1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD,
+    0x1E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E, 0xA0, 0x09, 0x91, 0xCA, 0x1C, 0xA1, 0xCA, 0x1C, 0xA1,
+    0xCA, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xD0, 0x9D, 0x0A, 0xD0, 0xAD, 0x00, 0x0A, 0xAA, 0x59, 0xAA,
+    0x1E, 0x5E, 0x1E, 0x5E, 0x1E, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD5, 0xE1, 0xAD, 0x5E,
+    0x1A, 0xD5, 0xE1, 0xAD, 0x5E, 0x1A, 0xD5, 0xDA, 0x1A, 0xD5, 0xDA, 0x1A, 0xD5, 0xDA, 0x1E, 0x94,
+    0xDA, 0x1E, 0x94, 0xDA, 0x1E, 0x94, 0xD9, 0x1E, 0xA3, 0x9D, 0x91, 0xEA, 0x39, 0xD9, 0x71, 0xE6,
+    0x9A, 0xAF, 0x69, 0xFC, 0xA6, 0xAF, 0xC7, 0xAE, 0xA3, 0x9D, 0x70, 0x99, 0x0A, 0xD7, 0x0D, 0xAE,
+    0x97, 0xDA, 0x99, 0x97, 0x9E, 0x77, 0x76, 0x97, 0x5C, 0xA7, 0x0A, 0xC9, 0x0C, 0xA7, 0x0A, 0xC9,
+    0x0C, 0xA7, 0x0A, 0xC1, 0xCA, 0x70, 0xAC, 0x1C, 0xA7, 0x0D, 0x09, 0xCA, 0x70, 0xD0, 0x9C, 0xA7,
+    0x0D, 0x09, 0xD7, 0x0D, 0x09, 0xD7, 0x0D, 0x0A, 0xD7, 0x0D, 0x0A, 0xD7, 0x0D, 0x74, 0xCA, 0x73,
+    0x9C, 0xA7, 0x29, 0xD9, 0x70, 0xFC, 0x70, 0x9E, 0xA7, 0x71, 0x4C, 0x96, 0xE5, 0xD0, 0xAC, 0x3C,
+    0x92, 0x9C, 0x6E, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xDA, 0x59, 0xD9, 0x59, 0xD9, 0x59,
+    0xD9, 0x59, 0xD9, 0x5A, 0xD9, 0x5A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6A, 0xD6, 0xAD, 0x6E, 0x6E,
+    0x5E, 0xA2, 0xFD, 0x92, 0xFD, 0x3F, 0xC4, 0xAA, 0x99, 0x40, 0x4A, 0xA7, 0x9D, 0x95, 0x9C, 0xAA,
+    0xC9, 0x39, 0xC3, 0xC9, 0x77, 0x19, 0x70, 0xAC, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD7,
+    0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x7A, 0xCA, 0x69, 0xD9, 0x4F, 0xC4,
+    0xAE, 0xA7, 0x70, 0x1A, 0xD3, 0xE4, 0xAD, 0x2A, 0xD9, 0x4A, 0xD1, 0x9D, 0xA5, 0xDA, 0x1E, 0x6D,
+    0xA0, 0xAD, 0x96, 0xDA, 0x0E, 0x7D, 0xAA, 0xD9, 0x7F, 0xCA, 0x70, 0xFC, 0x70, 0x9F, 0xA7, 0x09,
+    0xFC, 0x70, 0x9F, 0xD7, 0xAD, 0x9F, 0x6A, 0xD0, 0x9F, 0x5E, 0x1A, 0xF4, 0xE2, 0xFC, 0x3E, 0x3F,
+    0xC2, 0xE3, 0x9F, 0xC7, 0x73, 0xAD, 0xA7, 0x2E, 0xA7, 0x2E, 0x97, 0x2E, 0x72, 0x9D, 0xA7, 0x2A,
+    0xD9, 0x70, 0x09, 0xA7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x79, 0xD1, 0xAC, 0x92, 0x9D,
+    0x0A, 0xD3, 0x9C, 0xA9, 0xD4, 0x9F, 0x94, 0x9E, 0xA5, 0xAF, 0x5A, 0xFC, 0x4A, 0xCA, 0x0E, 0x3A,
+    0xD0, 0x9E, 0x2A, 0xD1, 0xAE, 0x90, 0xE2, 0xF9, 0x77, 0x77, 0x29, 0xE6, 0x9E, 0x6A, 0xDA, 0x6A,
+    0xD9, 0x6E, 0x69, 0xE5, 0x71, 0xAC, 0x1A, 0xC2, 0xAC, 0x09, 0xCA, 0x2D, 0x0D, 0x3C, 0xAA, 0xC9,
+    0x3E, 0xA4, 0xE5, 0xE9, 0x4C, 0xAD, 0x92, 0x9C, 0x99, 0xD9, 0x19, 0xC9, 0x0A, 0xD9, 0x09, 0xC9,
+    0x1E, 0x90, 0x2C, 0xA7, 0x09, 0xC9, 0x70, 0xD7, 0x09, 0xCA, 0x77, 0x77, 0x75, 0xD7, 0x09, 0xD7,
+    0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7,
+    0x0A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70, 0xE7, 0x0E, 0x09, 0x99, 0x99, 0xAA, 0x0F, 0xFE, 0x0F, 0xFE,
+    0x0F, 0xFE, 0x72, 0xC9, 0x3A, 0xC4, 0xCA, 0x3A, 0xC9, 0x77, 0x70, 0xCA, 0x4D, 0x39, 0xCA, 0x39,
+    0xCA, 0x3A, 0xCA, 0x3A, 0xC9, 0x3A, 0xC9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD4,
+    0xD4, 0xD9, 0x92, 0xFC, 0x1F, 0xC0, 0x1A, 0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7,
+    0x09, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0A, 0xD7, 0x0E, 0x70,
+    0xE7, 0x0E, 0x09, 0x99, 0x99, 0xAA, 0x0F, 0xFE, 0x0F, 0xFE, 0x0F, 0xFE, 0x77, 0x77, 0x70, 0xE9,
+    0x69, 0xE7, 0x9E, 0x79, 0xDA, 0x7E, 0x70, 0xE4, 0x1C, 0xA4, 0xD3, 0x9C, 0xA3, 0x9C, 0xA3, 0xAC,
+    0xA3, 0xAC, 0x93, 0xAC, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x93, 0xD9, 0x3D, 0x4D, 0x4D, 0x99,
+    0x2F, 0xC1, 0xFC, 0x77, 0x0E, 0x92, 0xE9, 0x2E, 0x29, 0xDA, 0x2A, 0xD9, 0x2E, 0x20, 0x19, 0x97,
+    0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD4, 0x92, 0x9D, 0x39, 0xC9, 0x1A, 0xD3, 0x9C, 0x91,
+    0xAD, 0x3A, 0xC9, 0x1A, 0xD3, 0xAC, 0x91, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x70,
+    0xE0, 0x99, 0x99, 0x99, 0xA0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x59, 0xC9, 0x1D, 0x19, 0xC9,
+    0x1D, 0x1A, 0xC9, 0x09, 0xCA, 0x1A, 0xC1, 0x9C, 0xA1, 0x99, 0x1A, 0xCA, 0x5A, 0xC9, 0x5A, 0xC9,
+    0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD9, 0x5D, 0x95, 0xD6, 0xD6, 0xD9, 0x94, 0xFC, 0x3F, 0xC2, 0x1A,
+    0xA7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD7, 0x09, 0xD3, 0xAD, 0x19, 0xD3, 0xE1, 0xAD, 0x3E, 0x1A,
+    0xD3, 0x99, 0x91, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xAD, 0x70, 0xE7, 0x0E, 0x70, 0xE0, 0x99,
+    0x99, 0x9A, 0xA0, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0, 0x1C, 0xA7, 0xD6, 0x9C, 0xA6, 0x9C, 0xA6,
+    0xAC, 0xA2, 0x99, 0x1A, 0xC9, 0x1A, 0xD1, 0xAC, 0x91, 0xE1, 0xD9, 0x1E, 0x1D, 0x96, 0xD9, 0x6D,
+    0x96, 0xD9, 0x6D, 0x7D, 0x7D, 0x99, 0x5F, 0xC4, 0xFC, 0x30, 0x77, 0x77, 0x49, 0xC9, 0x77, 0x0C,
+    0xA7, 0x70, 0xD7, 0x70, 0x9C, 0xA7, 0x3A, 0xA2, 0xD7, 0x39, 0xD1, 0xAC, 0x97, 0x39, 0xD0, 0x9D,
+    0x74, 0x9D, 0x0D, 0x75, 0x9D, 0xAC, 0xA7, 0x59, 0xF7, 0x6A, 0xE9, 0x76, 0xAE, 0x77, 0xAD, 0x77,
+    0x0A, 0xD7, 0x70, 0xE7, 0x7F, 0x76, 0x9F, 0x76, 0xFC, 0x75, 0xAC, 0xAE, 0x09, 0x99, 0x99, 0xAA,
+    0x49, 0xD0, 0xFF, 0xE4, 0xDA, 0x0F, 0xFE, 0x3A, 0xD1, 0xFF, 0xE3, 0xD9, 0x77, 0xAC, 0xA7, 0x79,
+    0xD7, 0x70, 0xDA, 0x77, 0xAC, 0xA7, 0x70, 0x97, 0x71, 0x7C, 0xA7, 0x3D, 0x72, 0x9C, 0xA7, 0x29,
+    0xCA, 0x72, 0xAC, 0xA7, 0x2A, 0xC9, 0x72, 0xAC, 0x97, 0x2D, 0x99, 0xA9, 0x7F, 0xA7, 0x9D, 0xA7,
+    0x9F, 0x69, 0xDA, 0x0D, 0x5D, 0xA2, 0xD7, 0x3D, 0x73, 0xD9, 0x97, 0x1F, 0xC7, 0x0F, 0xC1, 0x70,
+    0xAC, 0x75, 0xC9, 0x74, 0xAC, 0x75, 0xD7, 0x77, 0x77, 0x77, 0x72, 0xD9, 0x1E, 0xA5, 0x9D, 0x91,
+    0xF5, 0x9D, 0x91, 0xF9, 0x49, 0xD9, 0x1F, 0xC4, 0x9D, 0x2F, 0xC9, 0x3A, 0xD2, 0xDA, 0xE3, 0xAD,
+    0x2D, 0xA9, 0xD9, 0x2A, 0xD1, 0x9D, 0xA0, 0xE2, 0xE1, 0x9D, 0xA0, 0xAD, 0x91, 0xE1, 0x9D, 0xA1,
+    0xDA, 0x1E, 0x1A, 0xDA, 0x1A, 0xD1, 0xE1, 0xAD, 0xA2, 0xDA, 0x0E, 0x1A, 0xDA, 0x2A, 0xD9, 0xE1,
+    0xEA, 0x3F, 0xCA, 0x1E, 0xA3, 0xAF, 0xA1, 0xF3, 0x9F, 0xA1, 0xF4, 0xFA, 0x00, 0x59, 0xC7, 0x0D,
+    0x70, 0xCA, 0x7A, 0xC7, 0x77, 0x77, 0x70, 0xA9, 0x09, 0xAA, 0x93, 0xFF, 0x2E, 0x91, 0xAC, 0xA1,
+    0xD9, 0x3D, 0x09, 0xD4, 0xD0, 0x9D, 0x4D, 0x99, 0xD4, 0xD9, 0xAD, 0x4D, 0x9A, 0xD4, 0xDA, 0xAD,
+    0x4D, 0xAA, 0xD4, 0xDA, 0xE4, 0xDA, 0x74, 0xAA, 0x91, 0xAD, 0x96, 0xD9, 0x1F, 0x59, 0xD9, 0x1F,
+    0x94, 0x9D, 0x91, 0xFC, 0x49, 0xD2, 0xFC, 0x93, 0xAD, 0x2D, 0xAE, 0x3A, 0xD2, 0xDA, 0xAD, 0x92,
+    0xAD, 0x19, 0xDA, 0x0D, 0xA2, 0xE1, 0x9D, 0xA0, 0xAD, 0x2E, 0x19, 0xDA, 0x1D, 0xA1, 0xE1, 0xAD,
+    0xA1, 0xAD, 0x1E, 0x1A, 0xDA, 0x2D, 0xA0, 0xE1, 0xAD, 0xA2, 0xAD, 0x9E, 0x1E, 0xA3, 0xFC, 0xA1,
+    0xEA, 0x3F, 0xCA, 0x1F, 0x39, 0xFA, 0x1F, 0x4F, 0xA7, 0x76, 0xEA, 0x73, 0xE9, 0x73, 0xE7, 0x4E,
+    0x73, 0xAD, 0xA7, 0x3E, 0x70, 0x0A, 0x90, 0x9A, 0xA9, 0x3F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1D, 0x93,
+    0xD0, 0x9D, 0x4D, 0x09, 0xD4, 0xD9, 0x9D, 0x4D, 0x9A, 0xD4, 0xD9, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA,
+    0xAD, 0x4D, 0xAE, 0x4D, 0xA7, 0x59, 0xE6, 0xAE, 0x6A, 0xDA, 0x6A, 0xD7, 0xE6, 0x9D, 0xA4, 0x49,
+    0x59, 0x79, 0xC2, 0x9C, 0x71, 0x9C, 0xAD, 0x73, 0xAD, 0x75, 0xA9, 0x77, 0x77, 0x77, 0x2A, 0xA9,
+    0x1A, 0xD9, 0x6D, 0x91, 0xF5, 0x9D, 0x91, 0xF9, 0x49, 0xD9, 0x1F, 0xC4, 0x9D, 0x2F, 0xC9, 0x3A,
+    0xD2, 0xDA, 0xE3, 0xAD, 0x2D, 0xAA, 0xD9, 0x2A, 0xD1, 0x9D, 0xA0, 0xDA, 0x2E, 0x19, 0xDA, 0x0A,
+    0xD2, 0xE1, 0x9D, 0xA1, 0xDA, 0x1E, 0x1A, 0xDA, 0x1A, 0xD1, 0xE1, 0xAD, 0xA2, 0xDA, 0x0E, 0x1A,
+    0xDA, 0x2A, 0xD9, 0xE1, 0xEA, 0x3F, 0xCA, 0x1E, 0xA3, 0xFC, 0xA1, 0xF3, 0x9F, 0xA1, 0xF4, 0xFA,
+    0x00, 0x19, 0x94, 0xA3, 0xAA, 0x1A, 0xC5, 0xAE, 0x7D, 0x97, 0x09, 0x77, 0x77, 0x5A, 0x90, 0x9A,
+    0xA9, 0x3F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1D, 0x93, 0xD0, 0x9D, 0x4D, 0x09, 0xD4, 0xD9, 0x9D, 0x4D,
+    0x9A, 0xD4, 0xD9, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAE, 0x4D, 0xA0, 0x79, 0x71, 0xD9,
+    0x7D, 0xA7, 0xDA, 0x7A, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x19, 0xA0, 0x9A, 0xAA, 0x93, 0xAF, 0xE9,
+    0x2A, 0xDA, 0x19, 0xD2, 0xAD, 0x3A, 0xC9, 0x1D, 0xA3, 0x9C, 0xA1, 0xD9, 0x39, 0xD1, 0xD9, 0x39,
+    0xD1, 0xDA, 0x39, 0xD1, 0xDA, 0x3A, 0xD1, 0xDA, 0x3A, 0xD1, 0xDA, 0x3A, 0xD0, 0x9D, 0xA3, 0xAD,
+    0x00, 0x74, 0xAA, 0x91, 0xAD, 0x96, 0xD9, 0x1F, 0x59, 0xD9, 0x1F, 0x94, 0x9D, 0x91, 0xFC, 0x49,
+    0xD2, 0xFC, 0x93, 0xAD, 0x2D, 0xAE, 0x3A, 0xD2, 0xDA, 0xAD, 0x92, 0xAD, 0x19, 0xDA, 0x0D, 0xA2,
+    0xE1, 0x9D, 0xA0, 0xAD, 0x2E, 0x19, 0xDA, 0x1D, 0xA1, 0xE1, 0xAD, 0xA1, 0xAD, 0x1E, 0x1A, 0xDA,
+    0x2D, 0xA0, 0xE1, 0xAD, 0xA2, 0xAD, 0x9E, 0x1E, 0xA3, 0xFC, 0xA1, 0xEA, 0x3F, 0xCA, 0x1F, 0x39,
+    0xFA, 0x1F, 0x4F, 0xA7, 0x2F, 0x70, 0xAF, 0xC9, 0x79, 0xEA, 0x97, 0x73, 0x0A, 0x90, 0x9A, 0xA9,
+    0x3F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1D, 0x93, 0xD0, 0x9D, 0x4D, 0x09, 0xD4, 0xD9, 0x9D, 0x4D, 0x9A,
+    0xD4, 0xD9, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAE, 0x4E, 0x69, 0xDA, 0x49, 0xFA, 0x4A,
+    0xF7, 0x30, 0x49, 0x99, 0x9A, 0xAA, 0xA7, 0x9F, 0xF9, 0x77, 0x77, 0x71, 0x9A, 0xFA, 0x97, 0xFF,
+    0xD5, 0xEA, 0x3F, 0x3E, 0xA5, 0xEA, 0x19, 0xDA, 0x7E, 0x1A, 0xD9, 0x79, 0xD9, 0x0E, 0x71, 0xDA,
+    0x0D, 0xA7, 0x1E, 0x0D, 0x97, 0x1A, 0xD0, 0xD9, 0x71, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xE7, 0x1D,
+    0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9, 0x9A, 0xAF, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0x49, 0xFF,
+    0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x09, 0xAA, 0xAA, 0xF2, 0xFD, 0xAA, 0xA7, 0x77, 0x77, 0x74,
+    0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29, 0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95, 0xD0, 0xAC, 0x95,
+    0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49, 0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3, 0xFE, 0x94, 0xAE,
+    0xA3, 0x77, 0x5C, 0x93, 0x9C, 0x70, 0xAC, 0x3A, 0xC7, 0x1F, 0xD9, 0x72, 0xAD, 0xA7, 0x77, 0x77,
+    0x77, 0x59, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD,
+    0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0,
+    0xDA, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF,
+    0xFD, 0x29, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x74, 0x74, 0x9C, 0x4A, 0xA3, 0xCA,
+    0x29, 0xC9, 0x3A, 0xFD, 0x59, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x2A, 0xEA, 0x5F, 0xE9, 0x2D, 0x92,
+    0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC, 0xA4,
+    0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9, 0x4A, 0xEA, 0x30, 0x59, 0xA6, 0xAA, 0x5A,
+    0xCA, 0x49, 0xD5, 0xDA, 0x4A, 0xD5, 0x99, 0x59, 0x99, 0x77, 0x77, 0x74, 0x9A, 0xFA, 0x97, 0x0F,
+    0xFD, 0x6E, 0xA3, 0xF4, 0xEA, 0x5E, 0xA2, 0x9D, 0xA7, 0xE2, 0xAD, 0x97, 0x9D, 0x91, 0xE7, 0x1D,
+    0xA1, 0xDA, 0x71, 0xE1, 0xD9, 0x71, 0xAD, 0x1D, 0x97, 0x1A, 0xD1, 0xDA, 0x71, 0xDA, 0x1E, 0x71,
+    0xDA, 0x1A, 0xDA, 0x7E, 0x91, 0x9F, 0xAA, 0x99, 0xAA, 0xF3, 0xFF, 0xFD, 0x39, 0xFF, 0xF5, 0x9F,
+    0xFD, 0x97, 0x9A, 0xFA, 0x97, 0x76, 0x4A, 0xA5, 0x9A, 0x92, 0x9D, 0x5A, 0xCA, 0x2A, 0xD4, 0x9D,
+    0xA2, 0x99, 0x69, 0x97, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xEA, 0x71, 0xFE, 0x96, 0xD9, 0x29, 0xD5,
+    0x9C, 0xA4, 0x9C, 0xA4, 0xAC, 0x95, 0xD4, 0xAC, 0x95, 0xD4, 0xD9, 0x5D, 0x4A, 0xCA, 0x49, 0xD4,
+    0x9D, 0x92, 0x9D, 0xA5, 0xFF, 0xC7, 0xFE, 0x97, 0x0A, 0xEA, 0x50, 0x77, 0x74, 0x9A, 0xFA, 0x9A,
+    0xFF, 0xC9, 0x3F, 0xFF, 0xFE, 0x3E, 0xA2, 0x9F, 0xA9, 0x99, 0x95, 0xEA, 0x5A, 0xE7, 0x09, 0xE7,
+    0xE7, 0x0A, 0xD9, 0x7E, 0x97, 0xE7, 0x0E, 0xA7, 0xDA, 0x70, 0xF9, 0x99, 0xA3, 0xDA, 0x70, 0xFF,
+    0x3D, 0x97, 0x0F, 0xF3, 0xDA, 0x70, 0xF7, 0xE7, 0x0E, 0xA7, 0xAD, 0xA7, 0xE9, 0x79, 0xFA, 0xA9,
+    0x9A, 0xAF, 0x71, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA, 0xA2, 0x9F, 0xFF, 0xFF, 0x92, 0x9F, 0xFF, 0xFE,
+    0xA4, 0x9A, 0xFA, 0xAF, 0xFE, 0x75, 0x97, 0xAE, 0xA2, 0x9F, 0xC4, 0xFE, 0x99, 0xD9, 0x19, 0xC2,
+    0xD9, 0x29, 0xEA, 0x4A, 0xC0, 0x9C, 0xA4, 0x9D, 0x39, 0x9A, 0xC0, 0xAC, 0x95, 0xFF, 0xDA, 0xAC,
+    0x95, 0xDA, 0xAA, 0x99, 0x99, 0x1D, 0x95, 0xD7, 0x0A, 0xCA, 0x49, 0xD9, 0x79, 0xD9, 0x29, 0xF9,
+    0x7F, 0xFF, 0xFD, 0x2F, 0xE9, 0x9F, 0xF3, 0xAE, 0xA3, 0xAF, 0xA9, 0x00, 0x77, 0x4C, 0xA7, 0x29,
+    0xC7, 0x3D, 0x72, 0x9C, 0xA7, 0x77, 0x73, 0xFC, 0xAA, 0x6F, 0xF9, 0x4C, 0xA3, 0xAD, 0x4C, 0xA4,
+    0xD9, 0x3C, 0xA4, 0xAC, 0xA2, 0x9C, 0xA4, 0x9C, 0xA2, 0x9C, 0xA4, 0xDA, 0x29, 0xCA, 0x29, 0xE9,
+    0x29, 0xFF, 0xA3, 0xAF, 0xEA, 0x4A, 0xFF, 0xA3, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x93, 0xDA, 0x2E,
+    0x93, 0xAD, 0x2E, 0x93, 0xE9, 0x1E, 0x93, 0xEA, 0x1E, 0xA3, 0xF1, 0xEA, 0x3F, 0x00, 0x29, 0xC5,
+    0xD4, 0x9C, 0x94, 0xD7, 0x74, 0x99, 0x29, 0x1D, 0x9E, 0x90, 0xFD, 0x90, 0xE9, 0x3D, 0xA4, 0xDA,
+    0x4D, 0x94, 0xD9, 0x4D, 0xA3, 0x9D, 0xA3, 0xAD, 0xA3, 0xAE, 0x30, 0x1F, 0xCA, 0xA6, 0xFF, 0x94,
+    0xCA, 0x3A, 0xD4, 0xCA, 0x4D, 0x93, 0xCA, 0x4A, 0xCA, 0x29, 0xCA, 0x49, 0xCA, 0x29, 0xCA, 0x4D,
+    0xA2, 0x9C, 0xA2, 0x9E, 0x92, 0x9F, 0xFA, 0x3A, 0xFE, 0xA4, 0xAF, 0xFA, 0x3A, 0xD9, 0x2A, 0xD9,
+    0x2A, 0xD9, 0x3D, 0xA2, 0xE9, 0x3A, 0xD2, 0xE9, 0x3E, 0x91, 0xE9, 0x3E, 0xA1, 0xEA, 0x3F, 0x1E,
+    0xA3, 0xF7, 0x77, 0x77, 0x77, 0x5E, 0x97, 0x1E, 0x71, 0x9E, 0x71, 0x9D, 0xA7, 0x1E, 0x97, 0x1E,
+    0x60, 0x19, 0x92, 0x92, 0xD9, 0xE9, 0x1F, 0xD9, 0x1E, 0x94, 0xDA, 0x5D, 0xA5, 0xD9, 0x5D, 0x95,
+    0xDA, 0x49, 0xDA, 0x4A, 0xDA, 0x4A, 0xE7, 0x77, 0x77, 0x71, 0x9E, 0x4A, 0xDA, 0x4E, 0x94, 0xE5,
+    0xE4, 0xAD, 0xA4, 0x29, 0x49, 0x6A, 0xC2, 0xAA, 0x7A, 0xCA, 0xCA, 0x71, 0xAD, 0x73, 0xA7, 0x77,
+    0x74, 0xFC, 0xAA, 0x6F, 0xF9, 0x4C, 0xA3, 0xAD, 0x4C, 0xA4, 0xD9, 0x3C, 0xA4, 0xAC, 0xA2, 0x9C,
+    0xA4, 0x9C, 0xA2, 0x9C, 0xA4, 0xDA, 0x29, 0xCA, 0x29, 0xE9, 0x29, 0xFF, 0xA3, 0xAF, 0xEA, 0x4A,
+    0xFF, 0xA3, 0xAD, 0x92, 0xAD, 0x92, 0xAD, 0x93, 0xDA, 0x2E, 0x93, 0xAD, 0x2E, 0x93, 0xE9, 0x1E,
+    0x93, 0xEA, 0x1E, 0xA3, 0xF1, 0xEA, 0x3F, 0x00, 0x09, 0x59, 0x19, 0xC9, 0x2C, 0x92, 0x9C, 0xAA,
+    0xC9, 0x49, 0xD9, 0x69, 0xA7, 0x70, 0x99, 0x29, 0x3D, 0x9E, 0x92, 0xFD, 0x92, 0xE9, 0x5D, 0xA6,
+    0xDA, 0x6D, 0x96, 0xD9, 0x6D, 0xA5, 0x9D, 0xA5, 0xAD, 0xA5, 0xAE, 0x30, 0x77, 0x71, 0xC9, 0x75,
+    0xAC, 0x76, 0xCA, 0x75, 0xAC, 0x97, 0x77, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x96, 0xFF, 0xC9,
+    0x5A, 0xFA, 0xAA, 0xAA, 0x6E, 0x97, 0x4D, 0x97, 0x49, 0xD7, 0x6D, 0xA7, 0x5A, 0xFA, 0xA9, 0x71,
+    0xAF, 0xEA, 0x70, 0x9A, 0xFE, 0x97, 0x29, 0xAF, 0x97, 0x39, 0xF7, 0x39, 0xF9, 0x29, 0x95, 0xFC,
+    0x91, 0x9F, 0xFF, 0xC2, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x93, 0xAF, 0xFA, 0x97, 0x74, 0x77, 0xC9,
+    0x6A, 0xC7, 0xCA, 0x6A, 0xC9, 0x77, 0x77, 0x3A, 0xFA, 0x19, 0xDA, 0xAA, 0xA9, 0x1D, 0x7D, 0x7A,
+    0xD9, 0x6F, 0xA9, 0x49, 0xAF, 0x69, 0xDA, 0x19, 0x3E, 0x0A, 0xFE, 0xAA, 0xFF, 0x90, 0xAF, 0xCA,
+    0x90, 0x77, 0x7A, 0xC7, 0x5A, 0xE7, 0x3A, 0xC9, 0x0A, 0xC7, 0x19, 0xA3, 0x9A, 0x77, 0x77, 0x73,
+    0x9A, 0xFC, 0xA9, 0x6F, 0xFC, 0x95, 0xAF, 0xAA, 0xAA, 0xA6, 0xE9, 0x74, 0xD9, 0x74, 0x9D, 0x76,
+    0xDA, 0x75, 0xAF, 0xAA, 0x97, 0x1A, 0xFE, 0xA7, 0x09, 0xAF, 0xE9, 0x72, 0x9A, 0xF9, 0x73, 0x9F,
+    0x73, 0x9F, 0x92, 0x99, 0x5F, 0xC9, 0x19, 0xFF, 0xFC, 0x2F, 0xFF, 0xC9, 0x1F, 0xFF, 0xC9, 0x3A,
+    0xFF, 0xA9, 0x77, 0x40, 0x49, 0x7D, 0x95, 0xDA, 0xC9, 0x3C, 0xA1, 0x9C, 0x91, 0x99, 0x49, 0x75,
+    0xAF, 0xA1, 0x9D, 0xAA, 0xAA, 0x91, 0xD7, 0xD7, 0xAD, 0x96, 0xFA, 0x94, 0x9A, 0xF6, 0x9D, 0xA1,
+    0x93, 0xE0, 0xAF, 0xEA, 0xAF, 0xF9, 0x0A, 0xFC, 0xA9, 0x00, 0x49, 0xAF, 0xCA, 0x96, 0xFF, 0xC9,
+    0x5A, 0xFA, 0xAA, 0xAA, 0x6E, 0x97, 0x4D, 0x97, 0x49, 0xD7, 0x6D, 0xA7, 0x5A, 0xFA, 0xA9, 0x71,
+    0xAF, 0xEA, 0x70, 0x9A, 0xFE, 0x97, 0x29, 0xAF, 0x97, 0x39, 0xF7, 0x39, 0xF9, 0x29, 0x95, 0xFC,
+    0x91, 0x9F, 0xFF, 0xC2, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x93, 0xAF, 0xEA, 0xA9, 0x73, 0xA7, 0x7A,
+    0xAA, 0x77, 0xA9, 0x75, 0x9C, 0x74, 0x9D, 0x95, 0x2A, 0xFA, 0x19, 0xDA, 0xAA, 0xA9, 0x1D, 0x7D,
+    0x7A, 0xD9, 0x6F, 0xA9, 0x49, 0xAF, 0x69, 0xDA, 0x19, 0x3E, 0x0A, 0xFE, 0xAA, 0xFF, 0x90, 0xAF,
+    0xD9, 0x5A, 0x7A, 0xA9, 0x71, 0xC7, 0x9C, 0x5E, 0x97, 0x30, 0x39, 0xA4, 0xA7, 0x1A, 0xC1, 0x9C,
+    0x97, 0x2A, 0xE7, 0x5A, 0xC9, 0x76, 0x97, 0x77, 0x77, 0x77, 0x79, 0xAF, 0xCA, 0x96, 0xFF, 0xC9,
+    0x5A, 0xFA, 0xAA, 0xAA, 0x6E, 0x97, 0x4D, 0x97, 0x49, 0xD7, 0x6D, 0xA7, 0x5A, 0xFA, 0xA9, 0x71,
+    0xAF, 0xEA, 0x70, 0x9A, 0xFE, 0x97, 0x29, 0xAF, 0x97, 0x39, 0xF7, 0x39, 0xF9, 0x29, 0x95, 0xFC,
+    0x91, 0x9F, 0xFF, 0xC2, 0xFF, 0xFC, 0x91, 0xFF, 0xFC, 0x93, 0xAF, 0xFA, 0x97, 0x74, 0x72, 0x9C,
+    0x39, 0xC2, 0x9C, 0x90, 0xD4, 0x9E, 0x6A, 0xC7, 0x77, 0x74, 0xAF, 0xA1, 0x9D, 0xAA, 0xAA, 0x91,
+    0xD7, 0xD7, 0xAD, 0x96, 0xFA, 0x94, 0x9A, 0xF6, 0x9D, 0xA1, 0x93, 0xE0, 0xAF, 0xEA, 0xAF, 0xF9,
+    0x0A, 0xFC, 0xA9, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF,
+    0xFD, 0x90, 0x94, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D,
+    0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAE, 0x73,
+    0xAE, 0x73, 0xAE, 0x75, 0xA7, 0x69, 0xAA, 0x97, 0x59, 0xC7, 0x3D, 0xA4, 0x73, 0x9C, 0x95, 0xD6,
+    0xD4, 0x99, 0xD9, 0x99, 0x0A, 0xFE, 0xA2, 0xD6, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0xAD,
+    0x5A, 0xFA, 0x2A, 0xFC, 0x91, 0x9F, 0xCA, 0x4C, 0xA9, 0x7A, 0x96, 0xA9, 0x39, 0xDA, 0x00, 0x39,
+    0xA3, 0x9A, 0x70, 0xAC, 0x90, 0xD7, 0x2A, 0xE7, 0x4A, 0xC7, 0x77, 0x77, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x1F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x09, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0x97,
+    0x4D, 0x97, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7,
+    0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE5, 0x79, 0x79, 0xC9, 0x69, 0xC9,
+    0x29, 0xC9, 0x0A, 0xC9, 0x2D, 0x1A, 0xC9, 0x2D, 0x59, 0x9D, 0x99, 0x91, 0xAF, 0xEA, 0x3D, 0x7D,
+    0x69, 0xD6, 0x9D, 0x69, 0xD6, 0x9D, 0x6A, 0xD6, 0xAF, 0xA3, 0xAF, 0xC9, 0x29, 0xFC, 0xA0, 0x09,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0x94, 0xD9, 0x74,
+    0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x70, 0xAF, 0xFA, 0x5A, 0xFF, 0xA7, 0x09, 0xDA, 0x73,
+    0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x50,
+    0x75, 0x9C, 0x96, 0xD7, 0xD5, 0x99, 0xD9, 0x99, 0x1A, 0xFE, 0xA3, 0xD6, 0x9D, 0x3A, 0xFF, 0xAA,
+    0xFF, 0xA2, 0x9D, 0x69, 0xD6, 0xAD, 0x6A, 0xFA, 0x3A, 0xFC, 0x92, 0x9F, 0xCA, 0x4A, 0xC9, 0x19,
+    0x96, 0x9C, 0x0C, 0x90, 0xA9, 0x6A, 0xA0, 0x9C, 0x9C, 0x96, 0xAA, 0x19, 0xD7, 0x77, 0x77, 0x71,
+    0xAA, 0xA6, 0x9A, 0xAA, 0x0E, 0x95, 0xAE, 0x0E, 0x95, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9E, 0x0E,
+    0x69, 0xDA, 0x0E, 0x69, 0xDA, 0x0E, 0x69, 0xDA, 0x0E, 0x7D, 0xA0, 0xAD, 0x7D, 0xA0, 0xAD, 0x7D,
+    0xA0, 0xAD, 0x69, 0xD9, 0x0A, 0xD9, 0x5A, 0xD9, 0x0A, 0xE4, 0x9E, 0x90, 0x9F, 0xFF, 0x2F, 0xFF,
+    0x2A, 0xFF, 0xD9, 0x39, 0xFF, 0x97, 0x70, 0x74, 0xDA, 0x19, 0xA2, 0x9C, 0x0A, 0xA0, 0xA9, 0x2A,
+    0xA1, 0xAD, 0x77, 0x77, 0x3D, 0x5D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A,
+    0xCA, 0x4D, 0x09, 0xCA, 0x4D, 0x09, 0xCA, 0x4D, 0x99, 0xD3, 0xAD, 0x90, 0xEA, 0xAF, 0x90, 0xFF,
+    0xC9, 0x0A, 0xFF, 0x91, 0xAE, 0xA0, 0xD9, 0x39, 0x99, 0x9A, 0xAA, 0xA5, 0x9F, 0xF9, 0x77, 0x77,
+    0x77, 0xAA, 0xA6, 0x9A, 0xAA, 0x0E, 0x95, 0xAE, 0x0E, 0x95, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9E,
+    0x0E, 0x69, 0xDA, 0x0E, 0x69, 0xDA, 0x0E, 0x69, 0xDA, 0x0E, 0x7D, 0xA0, 0xAD, 0x7D, 0xA0, 0xAD,
+    0x7D, 0xA0, 0xAD, 0x69, 0xD9, 0x0A, 0xD9, 0x5A, 0xD9, 0x0A, 0xE4, 0x9E, 0x90, 0x9F, 0xFF, 0x2F,
+    0xFF, 0x2A, 0xFF, 0xD9, 0x39, 0xFF, 0x97, 0x70, 0x09, 0x99, 0x9A, 0xAA, 0xA1, 0x9F, 0xF9, 0x77,
+    0x77, 0x1D, 0x5D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xCA, 0x4D, 0x09,
+    0xCA, 0x4D, 0x09, 0xCA, 0x4D, 0x99, 0xD3, 0xAD, 0x90, 0xEA, 0xAF, 0x90, 0xFF, 0xC9, 0x0A, 0xFF,
+    0x91, 0xAE, 0xA0, 0xD9, 0x77, 0x2C, 0x93, 0x9C, 0x6D, 0x3D, 0x7F, 0xD7, 0x1A, 0xDA, 0x77, 0x77,
+    0x77, 0x77, 0x1E, 0x95, 0xAE, 0x0E, 0x95, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0,
+    0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7,
+    0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x93, 0x9E, 0x90, 0x9F, 0xFF, 0x2F,
+    0xFF, 0x2A, 0xFF, 0xD9, 0x39, 0xFF, 0x97, 0x70, 0x73, 0xC9, 0x39, 0xC2, 0xAC, 0x3D, 0x3F, 0xD5,
+    0xAD, 0xA7, 0x77, 0x74, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC,
+    0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA, 0xF9, 0x0F, 0xFC,
+    0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x59, 0xD9, 0x72, 0xC1, 0xC7, 0x2C, 0x1C, 0x72, 0xAD,
+    0xA7, 0x77, 0x77, 0x77, 0x71, 0xE9, 0x59, 0xE0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59, 0xE0, 0xE6, 0x9E,
+    0x0E, 0x69, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7,
+    0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x49, 0xE9, 0x09,
+    0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x00, 0x3A, 0xA7, 0xA9, 0x0C, 0x6C,
+    0x1C, 0x6C, 0x99, 0xC6, 0x9D, 0x97, 0x77, 0x74, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0,
+    0xAC, 0x94, 0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E,
+    0xAA, 0xF9, 0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x90, 0x49, 0x96, 0x99, 0x4A, 0xCA,
+    0x5D, 0x4D, 0xA4, 0x9D, 0x4A, 0x99, 0x49, 0xA9, 0x77, 0x77, 0x77, 0x7A, 0xAA, 0x69, 0xAA, 0xA2,
+    0xE9, 0x5A, 0xE2, 0xE9, 0x59, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9D, 0xA2, 0xE6, 0x9D,
+    0xA2, 0xE6, 0x9D, 0xA2, 0xE7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A, 0xD6, 0x9D, 0x92,
+    0xAD, 0x95, 0xAD, 0x92, 0xAE, 0x49, 0xE9, 0x29, 0xFF, 0xF4, 0xFF, 0xF4, 0xAF, 0xFD, 0x95, 0x9F,
+    0xF9, 0x77, 0x40, 0x77, 0x29, 0xD5, 0xAC, 0xA2, 0xAD, 0x5D, 0xA2, 0xAC, 0xA4, 0x9C, 0xA9, 0x77,
+    0x77, 0x77, 0x4D, 0x5D, 0x5A, 0xC9, 0x4D, 0x5A, 0xC9, 0x4D, 0x5A, 0xC9, 0x4D, 0x5A, 0xCA, 0x4D,
+    0x59, 0xCA, 0x4D, 0x59, 0xCA, 0x4D, 0x94, 0x9D, 0x3A, 0xD9, 0x5E, 0xAA, 0xF9, 0x5F, 0xFC, 0x95,
+    0xAF, 0xF9, 0x6A, 0xEA, 0x0D, 0x92, 0x0A, 0xAA, 0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59,
+    0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7,
+    0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE,
+    0x49, 0xE9, 0x09, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xEA, 0x97, 0x2C, 0x97, 0x39,
+    0xC7, 0x49, 0xC9, 0x97, 0x3A, 0xD7, 0x71, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC,
+    0x94, 0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA,
+    0xF9, 0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x96, 0xAC, 0x79, 0xC7, 0x0C, 0xA7, 0x09,
+    0xE7, 0x09, 0x90, 0x72, 0xC9, 0x77, 0x3E, 0x77, 0x2D, 0x9D, 0x77, 0x0C, 0xA2, 0xAC, 0x77, 0x77,
+    0x77, 0x6D, 0xA7, 0x7D, 0xA0, 0xAD, 0x76, 0x9D, 0x90, 0xAD, 0x76, 0xAD, 0x19, 0xD9, 0x75, 0xE2,
+    0xDA, 0x75, 0xDA, 0x2E, 0x4A, 0xD4, 0x9D, 0x92, 0xAD, 0x4E, 0x93, 0xE3, 0x9D, 0x92, 0xAF, 0x3E,
+    0x4D, 0xA2, 0xFC, 0x91, 0x9D, 0xA4, 0xE1, 0xAF, 0xD1, 0xAD, 0x94, 0xE1, 0xE9, 0xAD, 0x90, 0xE5,
+    0xAD, 0x9A, 0xE0, 0x9E, 0x0E, 0x59, 0xDA, 0xEA, 0x1E, 0xAD, 0xA6, 0xFD, 0x2A, 0xFC, 0x96, 0xFD,
+    0x29, 0xFC, 0x7F, 0xC9, 0x3F, 0xC7, 0xAF, 0x4A, 0xEA, 0x79, 0xEA, 0x5E, 0x93, 0x77, 0x59, 0xCA,
+    0x74, 0xE9, 0x72, 0xCA, 0x09, 0xC9, 0x70, 0xA4, 0xA9, 0x77, 0x77, 0x39, 0x99, 0x71, 0x99, 0x0A,
+    0xD7, 0x1D, 0x09, 0xD7, 0x09, 0xD1, 0xD9, 0x7A, 0xCA, 0x1D, 0xA1, 0x9D, 0x2D, 0x91, 0xAD, 0x1E,
+    0xA1, 0xD2, 0x9D, 0x0F, 0xC9, 0x9D, 0x3F, 0xFE, 0xA3, 0xFF, 0xE9, 0x3A, 0xF0, 0xAF, 0x5E, 0xA1,
+    0xF5, 0xE2, 0x9D, 0xA2, 0x6A, 0xA7, 0x4A, 0xD9, 0x72, 0x9C, 0x9A, 0xC7, 0x1A, 0xC2, 0x9C, 0x70,
+    0x97, 0x77, 0x77, 0x3D, 0xA7, 0xAD, 0x19, 0xD9, 0x6D, 0x92, 0xE5, 0xAD, 0x39, 0xD9, 0x39, 0xD9,
+    0x4E, 0x3E, 0x59, 0xDA, 0x19, 0xDA, 0x6E, 0x1E, 0x7A, 0xDA, 0xAD, 0xA7, 0x0F, 0xD7, 0x1A, 0xFA,
+    0x72, 0xF7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xEA, 0x72, 0x9E, 0xA7,
+    0x2A, 0xEA, 0x50, 0x4A, 0x97, 0x09, 0xD7, 0x9C, 0xAD, 0x59, 0xC2, 0xAC, 0x49, 0x59, 0x77, 0x77,
+    0x5A, 0xC9, 0x5D, 0x1D, 0x5D, 0x1A, 0xCA, 0x39, 0xCA, 0x2D, 0x3D, 0x92, 0xAC, 0xA2, 0xD9, 0x29,
+    0xD9, 0x09, 0xD4, 0xE0, 0xAD, 0x49, 0xD9, 0xDA, 0x5F, 0xC9, 0x59, 0xF7, 0xF7, 0xAD, 0xA7, 0xAD,
+    0x97, 0xE6, 0x9E, 0xA4, 0xFD, 0x5F, 0xA6, 0xAA, 0xA7, 0x39, 0x93, 0x99, 0x7D, 0xA2, 0xD9, 0x6E,
+    0x19, 0xD9, 0x59, 0xE1, 0xAD, 0xA7, 0x77, 0x77, 0x73, 0xDA, 0x7A, 0xD1, 0x9D, 0x96, 0xD9, 0x2E,
+    0x5A, 0xD3, 0x9D, 0x93, 0x9D, 0x94, 0xE3, 0xE5, 0x9D, 0xA1, 0x9D, 0xA6, 0xE1, 0xE7, 0xAD, 0xAA,
+    0xDA, 0x70, 0xFD, 0x71, 0xAF, 0xA7, 0x2F, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xEA, 0x73, 0xEA,
+    0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0xA5, 0x70, 0xC9, 0x75, 0x9C, 0x76, 0xD7, 0x59, 0xC9,
+    0x77, 0x77, 0x77, 0x74, 0xFF, 0xFC, 0x3A, 0xFF, 0xF3, 0x9F, 0xFF, 0x73, 0x9F, 0x73, 0xF7, 0x3F,
+    0x73, 0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x72, 0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC,
+    0x97, 0x1F, 0xD9, 0x99, 0x99, 0x99, 0x92, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x90, 0x5A,
+    0xC7, 0x0C, 0x97, 0xAC, 0x70, 0xCA, 0x77, 0x77, 0x77, 0x1F, 0xFA, 0x1F, 0xFC, 0x6A, 0xD9, 0x5A,
+    0xD9, 0x5A, 0xD9, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xDA, 0x5A, 0xE5, 0x9E, 0xAA, 0xAA, 0xA9, 0x0A,
+    0xFF, 0xC0, 0xAF, 0xFC, 0x90, 0x6A, 0xCA, 0x75, 0xE7, 0x5E, 0x75, 0x99, 0x97, 0x77, 0x77, 0x3F,
+    0xFF, 0xC3, 0xAF, 0xFF, 0x39, 0xFF, 0xF7, 0x39, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x97, 0x2F, 0x97,
+    0x2F, 0xA7, 0x2F, 0xA7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC9, 0x71, 0xFD, 0x99, 0x99,
+    0x99, 0x99, 0x2F, 0xFF, 0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE9, 0x49, 0x97, 0x9D, 0x7A, 0xD7, 0xE9,
+    0x77, 0x77, 0x5F, 0xFA, 0x1F, 0xFC, 0x6A, 0xD9, 0x5A, 0xD9, 0x5A, 0xD9, 0x5A, 0xDA, 0x5A, 0xDA,
+    0x5A, 0xDA, 0x5A, 0xE5, 0x9E, 0xAA, 0xAA, 0xA9, 0x0A, 0xFF, 0xC0, 0xAF, 0xFC, 0x90, 0x4C, 0x39,
+    0xC7, 0x19, 0xC9, 0x0A, 0xC7, 0x39, 0xE7, 0x59, 0xC9, 0x77, 0x77, 0x77, 0x74, 0xFF, 0xFC, 0x3A,
+    0xFF, 0xF3, 0x9F, 0xFF, 0x73, 0x9F, 0x73, 0xF7, 0x3F, 0x73, 0xF9, 0x72, 0xF9, 0x72, 0xFA, 0x72,
+    0xFA, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x72, 0xFC, 0x97, 0x1F, 0xD9, 0x99, 0x99, 0x99, 0x92,
+    0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x90, 0x19, 0x71, 0xAC, 0x29, 0xC4, 0xAC, 0x9D, 0x6A,
+    0xD7, 0x0A, 0x97, 0x77, 0x76, 0xFF, 0xA1, 0xFF, 0xC6, 0xAD, 0x95, 0xAD, 0x95, 0xAD, 0x95, 0xAD,
+    0xA5, 0xAD, 0xA5, 0xAD, 0xA5, 0xAE, 0x59, 0xEA, 0xAA, 0xAA, 0x90, 0xAF, 0xFC, 0x0A, 0xFF, 0xC9,
+    0x19, 0xDA, 0x19, 0xDA, 0xC9, 0x0D, 0x4D, 0x39, 0xCA, 0x39, 0xCA, 0x39, 0xCA, 0x39, 0xCA, 0x39,
+    0xCA, 0x3A, 0xCA, 0x3A, 0xCA, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x3A, 0xD3, 0xAD, 0x30, 0x77,
+    0x77, 0x29, 0xC5, 0x9A, 0xFA, 0x92, 0x9C, 0x4F, 0xFD, 0x1A, 0xC3, 0xEA, 0x3F, 0x9C, 0x92, 0xEA,
+    0x5F, 0xA2, 0x9D, 0xA7, 0xE3, 0xAD, 0x97, 0x9D, 0x92, 0xE7, 0x1D, 0xA2, 0xDA, 0x71, 0xDA, 0x2D,
+    0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD, 0x2D, 0xA7, 0x1D, 0xA2, 0xE7, 0x1D, 0xA2, 0xAD, 0xA7, 0xE9,
+    0x29, 0xFA, 0xA9, 0x9A, 0xAF, 0x4F, 0xFF, 0xD4, 0x9F, 0xFF, 0x69, 0xFF, 0xD9, 0x70, 0x9A, 0xFA,
+    0x97, 0x77, 0x00, 0x72, 0xA3, 0xAE, 0xA2, 0xA9, 0x1F, 0xE9, 0x0C, 0x1D, 0x92, 0x9E, 0xA0, 0x9C,
+    0xA4, 0x9D, 0x1A, 0xC9, 0x5D, 0x1A, 0xC9, 0x5D, 0x1D, 0x95, 0xD1, 0xAC, 0xA4, 0x9D, 0x19, 0xD9,
+    0x29, 0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5A, 0xEA, 0x40, 0x19, 0xFE, 0xA9, 0x39, 0xFF, 0xE2, 0xFC,
+    0x39, 0xE1, 0xCA, 0xAD, 0x5D, 0x09, 0xC0, 0xAD, 0x5D, 0x99, 0xC0, 0xAD, 0x5D, 0x1C, 0x0A, 0xD3,
+    0x9E, 0x3A, 0xFF, 0xCA, 0x3F, 0xFC, 0xA4, 0xEA, 0xAA, 0x99, 0x6E, 0x73, 0xE7, 0x3E, 0x73, 0xE7,
+    0x3E, 0x73, 0xE9, 0x72, 0xE9, 0x72, 0xE9, 0x70, 0x76, 0xAD, 0x70, 0x9E, 0x70, 0x9C, 0xA7, 0x19,
+    0xC9, 0x09, 0xAC, 0xA9, 0x39, 0xCA, 0xAF, 0xCA, 0x29, 0xF2, 0xAC, 0x29, 0xE4, 0xCA, 0x19, 0xDA,
+    0x4D, 0x19, 0xD9, 0x4A, 0xC1, 0x9D, 0xA4, 0xAC, 0x19, 0xE4, 0xD1, 0x9E, 0xA2, 0x9D, 0x19, 0xFF,
+    0xC9, 0x1A, 0xFF, 0xC2, 0xDA, 0x0F, 0xA3, 0xD9, 0x71, 0xD9, 0x70, 0x9D, 0x71, 0xAD, 0x71, 0xE7,
+    0x76, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C, 0x97,
+    0x0C, 0x97, 0x0C, 0x7A, 0xC6, 0xAC, 0x6D, 0x6D, 0x6D, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xC9, 0xFF,
+    0xC7, 0x10, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFC, 0x9F, 0xF9,
+    0x0A, 0xC3, 0xD9, 0x7A, 0x3D, 0x97, 0x4D, 0x97, 0x4D, 0x97, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA,
+    0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x3A, 0xE7, 0x3A,
+    0xE7, 0x3A, 0xE5, 0x49, 0xCA, 0x49, 0xDA, 0x4E, 0x93, 0x9C, 0xA5, 0xD6, 0xD4, 0x99, 0xD9, 0x99,
+    0x0A, 0xFE, 0xA2, 0xD6, 0xD5, 0x9D, 0x59, 0xD5, 0x9D, 0x59, 0xD5, 0xAD, 0x5A, 0xFA, 0x2A, 0xFC,
+    0x91, 0x9F, 0xCA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF, 0xFD,
+    0x90, 0x94, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA, 0x73, 0x9D, 0xA7,
+    0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAE, 0x73, 0xAE,
+    0x73, 0xAE, 0x73, 0xAF, 0x73, 0xFC, 0x97, 0x2F, 0x97, 0x39, 0xAC, 0x92, 0x77, 0x77, 0x99, 0x76,
+    0xAC, 0x0A, 0xAA, 0x69, 0xAA, 0xAC, 0xA0, 0xE9, 0x5A, 0xF1, 0xE9, 0x59, 0xE2, 0xE6, 0x9E, 0x2E,
+    0x69, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xDA, 0x2E, 0x69, 0xDA, 0x2E, 0x7D, 0xA2, 0xAD, 0x7D, 0xA2,
+    0xAD, 0x7D, 0xA2, 0xAD, 0x69, 0xD9, 0x2A, 0xD9, 0x5A, 0xD9, 0x2A, 0xE4, 0x9E, 0x92, 0x9F, 0xFF,
+    0x4F, 0xFF, 0x4A, 0xFF, 0xD9, 0x59, 0xFF, 0x97, 0x74, 0x77, 0x7C, 0x0D, 0x5D, 0x0C, 0x0A, 0xC9,
+    0x4D, 0xAC, 0x0A, 0xC9, 0x4E, 0x1A, 0xC9, 0x4D, 0x2A, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x29, 0xCA,
+    0x4D, 0x91, 0x9D, 0x3A, 0xD9, 0x2E, 0xAA, 0xF9, 0x2F, 0xFC, 0x92, 0xAF, 0xF9, 0x3A, 0xEA, 0x0D,
+    0x91, 0x9C, 0xA4, 0x9D, 0x49, 0xD9, 0x70, 0x5C, 0x90, 0x9C, 0x1D, 0x09, 0xC9, 0x00, 0x74, 0xCA,
+    0x5E, 0x93, 0xD0, 0x9C, 0x91, 0xCA, 0x3C, 0x90, 0x0D, 0x91, 0x99, 0x9C, 0x0C, 0x1A, 0x9A, 0xA0,
+    0x9C, 0x9C, 0x0A, 0xA1, 0xAD, 0x70, 0x19, 0x99, 0xAA, 0xAA, 0xA1, 0xFF, 0xC7, 0x30, 0x49, 0x99,
+    0x99, 0x9A, 0x91, 0xFF, 0xF7, 0x60, 0x71, 0xC4, 0xAA, 0x0C, 0xA2, 0x9C, 0x90, 0x9F, 0xD2, 0x9E,
+    0xA1, 0x9D, 0x0A, 0xD0, 0xE9, 0x99, 0x90, 0x9D, 0x2A, 0xCA, 0x0A, 0xD2, 0xE0, 0xE9, 0x1E, 0x09,
+    0x99, 0x29, 0x99, 0x00, 0x0A, 0xD9, 0x29, 0xC1, 0x9C, 0x2A, 0x10, 0x0A, 0xAA, 0x09, 0x90, 0x9A,
+    0xAA, 0x09, 0xA0, 0xE5, 0x29, 0xD5, 0xAC, 0x91, 0xAD, 0x5D, 0x91, 0xDA, 0x49, 0xD9, 0x77, 0x00,
+    0x0C, 0xA3, 0xC9, 0x1D, 0x09, 0xC9, 0x3E, 0x95, 0xCA, 0x73, 0x9C, 0xA5, 0xD9, 0x39, 0xD5, 0xDA,
+    0x39, 0xD9, 0x4A, 0xD7, 0x70, 0x0E, 0x91, 0xEA, 0x19, 0xDA, 0x2E, 0x2E, 0x2A, 0xD9, 0x0E, 0xA0,
+    0xE9, 0x0E, 0x1E, 0x09, 0xDA, 0x0A, 0xD9, 0x00, 0x0E, 0x91, 0xAD, 0xA1, 0x9D, 0xA2, 0xE2, 0xE2,
+    0xAD, 0x90, 0x19, 0x91, 0x9C, 0x9E, 0x19, 0xC1, 0x99, 0x0A, 0x19, 0xC1, 0x9E, 0x9C, 0x2A, 0x10,
+    0x9D, 0xAA, 0xA9, 0x91, 0xAA, 0xAF, 0xA5, 0x9C, 0xA6, 0xCA, 0x6C, 0xA0, 0x1C, 0x2C, 0x19, 0xA0,
+    0x9C, 0x50, 0x19, 0x0A, 0x09, 0xA1, 0xCA, 0x20, 0x6C, 0x92, 0xC9, 0x09, 0xF0, 0x49, 0xF1, 0xC9,
+    0x2A, 0x90, 0x19, 0x3A, 0x2A, 0xCA, 0x91, 0xA6, 0x19, 0x99, 0xAA, 0xAA, 0x90, 0xFF, 0xA7, 0x10,
+    0x09, 0x90, 0x9D, 0x0A, 0xD0, 0xE9, 0x09, 0x92, 0x99, 0x90, 0x9D, 0x2E, 0x0A, 0xD2, 0xE0, 0xE9,
+    0x1E, 0x00, 0x0A, 0xAA, 0x09, 0x90, 0x9A, 0xAA, 0x09, 0xA0, 0xE5, 0x0A, 0xDA, 0x0E, 0x90, 0xE1,
+    0xE0, 0x9D, 0xA0, 0xE9, 0x00, 0x09, 0x3A, 0x3C, 0xA4, 0xA3, 0xC0, 0x9D, 0x90, 0x29, 0x2C, 0x2C,
+    0x29, 0xC3, 0xE9, 0x29, 0x00, 0x09, 0x90, 0xCA, 0x0C, 0xA9, 0xCA, 0x9C, 0xA9, 0xCA, 0x9F, 0xCA,
+    0x9C, 0x91, 0xCA, 0x9C, 0x2C, 0xA6, 0x0C, 0xA3, 0xC9, 0x1D, 0x09, 0xC9, 0x3E, 0x95, 0xCA, 0x73,
+    0x29, 0xC9, 0x5E, 0x4C, 0xA0, 0xAC, 0x2C, 0x92, 0x9C, 0x71, 0x0D, 0x91, 0x99, 0x9C, 0x0C, 0x1A,
+    0x9A, 0xA0, 0x9C, 0x9C, 0x0A, 0xA1, 0xAD, 0x70, 0x71, 0xFE, 0x71, 0x71, 0xFE, 0x19, 0x99, 0x99,
+    0x91, 0x0D, 0x91, 0x99, 0x9C, 0x0C, 0x1A, 0x9A, 0xA0, 0x9C, 0x9C, 0x0A, 0xA1, 0xAD, 0x70, 0x71,
+    0x9F, 0xFC, 0x9F, 0xFC, 0x09, 0x1A, 0x90, 0x99, 0x9C, 0x30, 0x9C, 0x2C, 0xA9, 0xC2, 0xCA, 0x9F,
+    0xCA, 0x60, 0x9F, 0xC9, 0x9A, 0x2C, 0x99, 0xA2, 0xC9, 0x9A, 0x2C, 0x99, 0xFC, 0x90, 0x0A, 0xAA,
+    0x9A, 0x1A, 0x0A, 0x09, 0x90, 0xA0, 0xA0, 0x9A, 0x99, 0x0A, 0x19, 0x5C, 0x0A, 0x2C, 0x2A, 0xC9,
+    0x09, 0xA0, 0xC0, 0x0D, 0x91, 0x99, 0x9C, 0x0C, 0x1A, 0x9A, 0xA0, 0x9C, 0x9C, 0x0A, 0xA1, 0xAD,
+    0x70, 0x9A, 0x1A, 0xC0, 0xAA, 0x20, 0x4C, 0xA6, 0x9C, 0x96, 0xAC, 0x7C, 0xA7, 0x77, 0x9D, 0x2A,
+    0xCA, 0x0A, 0xD2, 0xE0, 0xE9, 0x1E, 0x09, 0x99, 0x29, 0x99, 0x00, 0x9F, 0xCA, 0x9C, 0x91, 0xCA,
+    0x9C, 0x2C, 0xA6, 0x19, 0x99, 0xAA, 0xAA, 0x90, 0xFF, 0xA7, 0x77, 0x79, 0x99, 0xAA, 0xAA, 0x90,
+    0xFF, 0xA7, 0x10, 0x0C, 0xA2, 0xD0, 0xCA, 0x2D, 0x0C, 0xA2, 0xD9, 0xCA, 0x2D, 0x9C, 0xA1, 0x9D,
+    0x09, 0x92, 0x99, 0x69, 0xFC, 0x09, 0xAA, 0xAD, 0x93, 0xD9, 0x3D, 0x93, 0x99, 0x00, 0x74, 0xA6,
+    0xC6, 0xA2, 0xAC, 0x9A, 0x99, 0x99, 0xC0, 0xD0, 0xA9, 0xAA, 0x09, 0xC9, 0xC9, 0xAA, 0x09, 0xE3,
+    0xA9, 0x5C, 0x59, 0xC5, 0x94, 0x71, 0xAC, 0x76, 0xD9, 0x74, 0x9D, 0x95, 0x9A, 0xDA, 0x95, 0xAA,
+    0x1D, 0xA1, 0xAD, 0x4D, 0x9A, 0xD3, 0x9D, 0xA9, 0x0A, 0xD0, 0xE0, 0x9C, 0x91, 0xAA, 0xEA, 0x5A,
+    0xCA, 0x75, 0xDA, 0x71, 0x74, 0x9E, 0x93, 0xA9, 0x0D, 0x09, 0xC9, 0x2C, 0xA9, 0xCA, 0x19, 0xCA,
+    0x09, 0xC9, 0x9C, 0x92, 0x9F, 0x77, 0x71, 0x9E, 0xA3, 0xA9, 0x0D, 0x1D, 0x91, 0xC9, 0x9C, 0x92,
+    0xAF, 0x74, 0x77, 0x0A, 0xC9, 0x99, 0x59, 0x0A, 0xCA, 0x77, 0x00, 0x0A, 0x91, 0xA9, 0x19, 0x10,
+    0x09, 0x75, 0xA0, 0xAA, 0x73, 0xC2, 0x9C, 0xA9, 0x59, 0xCA, 0x69, 0xAA, 0xAA, 0xAA, 0x93, 0x39,
+    0xAF, 0xDA, 0x94, 0xAA, 0x97, 0xAC, 0x91, 0xA9, 0x73, 0xA9, 0x09, 0x75, 0x90, 0x77, 0x77, 0x4C,
+    0xA9, 0x19, 0xFF, 0xFF, 0xDA, 0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDA, 0x77, 0x19,
+    0x30, 0x69, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09,
+    0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93,
+    0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E,
+    0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x0F, 0xCA, 0xA9, 0x5F, 0xFC, 0x93, 0xD9, 0x39,
+    0xD9, 0x2D, 0x94, 0x9C, 0xA2, 0xD9, 0x5D, 0x2D, 0x94, 0x9C, 0xA2, 0xD9, 0x39, 0xD9, 0x2F, 0xFC,
+    0x93, 0xFF, 0xCA, 0x3D, 0x94, 0xAD, 0x91, 0xD9, 0x5A, 0xD1, 0xD9, 0x59, 0xD1, 0xD9, 0x59, 0xD9,
+    0x0D, 0x95, 0xE9, 0x0D, 0xA9, 0x99, 0x9A, 0xF1, 0xFF, 0xF1, 0xFF, 0xE2, 0xFF, 0xCA, 0x20, 0x9F,
+    0xF0, 0x9F, 0xF0, 0x9C, 0x96, 0x9C, 0x96, 0x9C, 0x96, 0x9C, 0x96, 0x9C, 0x96, 0x9C, 0xA6, 0x9C,
+    0xA6, 0x9C, 0xA6, 0x9C, 0xA6, 0x9C, 0xA6, 0x9D, 0x69, 0xD6, 0x9D, 0x69, 0xD7, 0x99, 0x60, 0x77,
+    0x59, 0xD9, 0x73, 0xEA, 0x72, 0x9F, 0x72, 0xDA, 0xAC, 0xA7, 0x09, 0xD0, 0x9D, 0x70, 0xDA, 0x1D,
+    0xA6, 0x9D, 0x91, 0xAD, 0x6E, 0x3D, 0xA5, 0xD9, 0x3A, 0xD4, 0xAD, 0x49, 0xDA, 0x3D, 0xA5, 0xE2,
+    0xAD, 0x69, 0xDA, 0x1E, 0x7E, 0x09, 0xFF, 0xFD, 0x09, 0xFF, 0xFD, 0x00, 0x59, 0x99, 0x99, 0x91,
+    0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A,
+    0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71,
+    0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x2F, 0xFF, 0xC3, 0xAF, 0xFF,
+    0x39, 0xFF, 0xF7, 0x39, 0xF7, 0x3F, 0x73, 0xF7, 0x3F, 0x97, 0x2F, 0x97, 0x2F, 0xA7, 0x2F, 0xA7,
+    0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC7, 0x2F, 0xC9, 0x71, 0xFD, 0x99, 0x99, 0x99, 0x99, 0x2F, 0xFF,
+    0xE1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE9, 0x19, 0x97, 0x99, 0x2A, 0xD7, 0xDA, 0x1A, 0xD7, 0xDA, 0x1A,
+    0xD7, 0xDA, 0x1A, 0xD7, 0xE1, 0xAD, 0x7E, 0x1A, 0xD7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
+    0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xFF, 0xFD, 0x1F, 0xFF, 0xD1, 0xE9, 0x59, 0xE1, 0xE9, 0x59, 0xE1,
+    0xE9, 0x59, 0xE9, 0x0E, 0xA5, 0x9E, 0x90, 0x49, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA,
+    0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x49, 0x99, 0x1E,
+    0x0D, 0x90, 0xAF, 0xD1, 0xAD, 0x0D, 0x90, 0x99, 0x99, 0x93, 0xAD, 0x0D, 0xA7, 0x1D, 0xA0, 0xE7,
+    0x1D, 0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9, 0x9A, 0xAF, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF, 0x49,
+    0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x0A, 0xAA, 0x1E, 0x1E, 0x1E, 0x1A, 0xD1, 0xAD, 0x1A,
+    0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0,
+    0xEA, 0x1A, 0xD3, 0xE4, 0xAD, 0x2A, 0xD9, 0x4A, 0xD1, 0x9D, 0xA5, 0xDA, 0x1E, 0x6D, 0xA0, 0xAD,
+    0x96, 0xDA, 0x0E, 0x7D, 0xAA, 0xD9, 0x7F, 0xCA, 0x70, 0xFC, 0x70, 0x9F, 0xA7, 0x09, 0xFC, 0x70,
+    0x9F, 0xD7, 0xAD, 0x9F, 0x6A, 0xD0, 0x9F, 0x5E, 0x1A, 0xF4, 0xE2, 0xFC, 0x3E, 0x3F, 0xC2, 0xE3,
+    0x9F, 0xC0, 0x5A, 0xFA, 0x73, 0xFD, 0x72, 0x9F, 0xD7, 0x2A, 0xFD, 0x97, 0x1F, 0xF7, 0x1E, 0x09,
+    0xE7, 0x0A, 0xDA, 0x1E, 0x97, 0xE9, 0x1A, 0xE7, 0xE3, 0xE6, 0x9D, 0xA3, 0xE9, 0x5E, 0x93, 0x9E,
+    0x5E, 0x5E, 0x49, 0xDA, 0x5A, 0xD9, 0x3A, 0xD7, 0xE3, 0xE7, 0xE2, 0x9D, 0x97, 0x9D, 0x91, 0xAD,
+    0x71, 0xE1, 0xAA, 0x97, 0x19, 0xAA, 0x00, 0x1A, 0xAA, 0x97, 0xAA, 0xA9, 0x2F, 0x7E, 0xA2, 0xF9,
+    0x5A, 0xEA, 0x19, 0xFA, 0x5F, 0xA1, 0x9F, 0xC4, 0x9F, 0xC1, 0x9F, 0xCA, 0x3F, 0xD1, 0x9D, 0xAE,
+    0x3F, 0xD1, 0x9D, 0x0E, 0x91, 0xAD, 0x9E, 0x1A, 0xD0, 0xAE, 0x1E, 0x0E, 0x1A, 0xD0, 0x9E, 0x09,
+    0xDA, 0x0E, 0x1A, 0xD1, 0xEA, 0xE9, 0x0E, 0x1A, 0xD9, 0x09, 0xFD, 0x1E, 0x90, 0xE9, 0x1F, 0xCA,
+    0x1E, 0x90, 0xE9, 0x1A, 0xF1, 0x9E, 0x90, 0xE9, 0x19, 0xF1, 0x9E, 0xA0, 0xEA, 0x2E, 0x91, 0x9E,
+    0xA0, 0xEA, 0x29, 0xAA, 0x2A, 0xEA, 0x0E, 0xA7, 0x0A, 0xF0, 0x74, 0xAA, 0x91, 0xAD, 0x96, 0xD9,
+    0x1F, 0x59, 0xD9, 0x1F, 0x94, 0x9D, 0x91, 0xFC, 0x49, 0xD2, 0xFC, 0x93, 0xAD, 0x2D, 0xAE, 0x3A,
+    0xD2, 0xDA, 0xAD, 0x92, 0xAD, 0x19, 0xDA, 0x0D, 0xA2, 0xE1, 0x9D, 0xA0, 0xAD, 0x2E, 0x19, 0xDA,
+    0x1D, 0xA1, 0xE1, 0xAD, 0xA1, 0xAD, 0x1E, 0x1A, 0xDA, 0x2D, 0xA0, 0xE1, 0xAD, 0xA2, 0xAD, 0x9E,
+    0x1E, 0xA3, 0xFC, 0xA1, 0xEA, 0x3F, 0xCA, 0x1F, 0x39, 0xFA, 0x1F, 0x4F, 0xA0, 0x09, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0x91, 0xAF, 0xFD, 0x97, 0x77, 0x77, 0x77, 0x77, 0x19, 0xAA, 0xAA, 0xAA, 0x95,
+    0xAF, 0xDA, 0x77, 0x77, 0x77, 0x72, 0x9F, 0xFF, 0x09, 0xFF, 0xF0, 0x49, 0xAF, 0xA9, 0x7F, 0xFD,
+    0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0,
+    0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E, 0x71, 0xDA,
+    0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0x9F, 0xFD,
+    0x96, 0x9A, 0xFA, 0x97, 0x74, 0x09, 0x99, 0x99, 0x99, 0x99, 0x09, 0xFF, 0xC9, 0x9C, 0x94, 0x9C,
+    0x99, 0xC9, 0x49, 0xC9, 0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49, 0xC9, 0x9C, 0x94, 0x9C, 0x99, 0xC9,
+    0x49, 0xC9, 0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49, 0xC9, 0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49, 0xC9,
+    0x9C, 0x94, 0x9C, 0x99, 0xC9, 0x49, 0xC9, 0x9C, 0x94, 0x9C, 0x90, 0x09, 0xFD, 0xA9, 0x39, 0xFF,
+    0xC2, 0x9D, 0x39, 0xE1, 0x9D, 0x5D, 0x1A, 0xD5, 0xD9, 0x0A, 0xD5, 0xD1, 0xAD, 0x39, 0xE1, 0xAF,
+    0xFC, 0xA1, 0xAF, 0xFA, 0x2E, 0xAA, 0xA9, 0x94, 0xE7, 0x1E, 0x71, 0xE7, 0x1E, 0x71, 0xE7, 0x1E,
+    0x97, 0x0E, 0x97, 0x0E, 0x97, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x0C, 0xA7, 0x0C, 0xA7,
+    0x0C, 0xA7, 0x0C, 0x97, 0x0C, 0x97, 0x0C, 0x7A, 0xC6, 0xAC, 0x6D, 0x6D, 0x6D, 0x99, 0x99, 0x99,
+    0x09, 0xFF, 0xC9, 0xFF, 0xC7, 0x10, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD,
+    0x90, 0xFF, 0xFD, 0x90, 0x94, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xD9, 0x74, 0xDA, 0x74, 0xDA,
+    0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73,
+    0xAE, 0x73, 0xAE, 0x73, 0xAE, 0x50, 0x0D, 0xA7, 0xAD, 0x19, 0xD9, 0x6D, 0x92, 0xE5, 0xAD, 0x39,
+    0xD9, 0x39, 0xD9, 0x4E, 0x3E, 0x59, 0xDA, 0x19, 0xDA, 0x6E, 0x1E, 0x7A, 0xDA, 0xAD, 0xA7, 0x0F,
+    0xD7, 0x1A, 0xFA, 0x72, 0xF7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xEA,
+    0x72, 0x9E, 0xA7, 0x2A, 0xEA, 0x50, 0x77, 0x75, 0x9C, 0x97, 0x71, 0x9C, 0x97, 0x71, 0x9C, 0x97,
+    0x71, 0xAC, 0xA7, 0x5A, 0xFF, 0xCA, 0x79, 0xFA, 0xAC, 0xAA, 0xFA, 0x4A, 0xEA, 0x19, 0xC9, 0x1A,
+    0xF2, 0x9E, 0x92, 0xAC, 0x92, 0x9E, 0xA1, 0xAE, 0x3A, 0xC4, 0xAE, 0x1E, 0x4A, 0xC5, 0xE1, 0xE4,
+    0xAC, 0x5E, 0x1E, 0x4A, 0xC5, 0xE1, 0xE4, 0xAC, 0x5E, 0x1E, 0xA3, 0xAC, 0x49, 0xE1, 0xAE, 0xA9,
+    0x1A, 0xC3, 0xAE, 0xA2, 0xFF, 0xFF, 0xC9, 0x29, 0xFF, 0xFE, 0xA4, 0x9F, 0xFF, 0xC9, 0x79, 0xAF,
+    0xEA, 0x97, 0x5D, 0x77, 0x2D, 0x71, 0x1A, 0xA9, 0x79, 0xAA, 0x29, 0xD7, 0xD9, 0x3D, 0xA5, 0xAC,
+    0xA5, 0xD9, 0x39, 0xD6, 0xAD, 0x3D, 0x97, 0xE1, 0xE7, 0x09, 0xDA, 0xAD, 0x72, 0xFC, 0xA7, 0x3F,
+    0x74, 0xEA, 0x73, 0xAF, 0x97, 0x19, 0xFD, 0x71, 0xE9, 0xAE, 0x7F, 0x1E, 0x95, 0x9E, 0x29, 0xE5,
+    0xEA, 0x3F, 0x3F, 0x5E, 0xA1, 0xAE, 0x95, 0xAE, 0x90, 0x9C, 0xA2, 0x9C, 0x3A, 0xC0, 0x9C, 0xA2,
+    0x9C, 0x3A, 0xC1, 0xC9, 0x29, 0xC3, 0xAC, 0x1C, 0xA2, 0x9C, 0x3D, 0x1D, 0x29, 0xC3, 0xD1, 0xD2,
+    0x9C, 0x29, 0xCA, 0x1A, 0xD1, 0x9C, 0x19, 0xD9, 0x2E, 0x0A, 0xC0, 0x9E, 0x3A, 0xFF, 0xC9, 0x49,
+    0xFE, 0x97, 0x0A, 0xC9, 0x73, 0xAC, 0x74, 0xAC, 0x74, 0xAC, 0x74, 0xAC, 0x74, 0xAA, 0x74, 0xCA,
+    0x74, 0xA9, 0x60, 0x59, 0x99, 0x97, 0x19, 0xFD, 0xA6, 0xAD, 0x91, 0x9E, 0x4A, 0xD5, 0xAC, 0xA3,
+    0xD7, 0xD2, 0xAC, 0xA7, 0xAC, 0xA1, 0xAC, 0x97, 0x9D, 0x1D, 0x97, 0x0D, 0x1D, 0x71, 0xD1, 0xD9,
+    0x79, 0xD1, 0xAC, 0xA7, 0xAD, 0x19, 0xD7, 0xD9, 0x2A, 0xC9, 0x5E, 0x39, 0xDA, 0x29, 0xE2, 0x9F,
+    0xC9, 0x1A, 0xFC, 0x09, 0xFC, 0x91, 0xAF, 0xC7, 0x70, 0x77, 0x2A, 0xE9, 0x99, 0x6F, 0xF5, 0xAC,
+    0xA2, 0xE5, 0xCA, 0x39, 0xD4, 0x9C, 0x5D, 0x4A, 0xC5, 0xD4, 0xD5, 0xD9, 0x3D, 0x49, 0xD9, 0x3A,
+    0xD9, 0x1A, 0xEA, 0x4F, 0xFC, 0xA4, 0xAF, 0xDA, 0xDA, 0xA9, 0x29, 0xAD, 0xA9, 0x0F, 0x97, 0x19,
+    0xA9, 0x90, 0x77, 0x77, 0x77, 0x29, 0xAA, 0xA6, 0xAF, 0xC9, 0x3A, 0xCA, 0x19, 0xD9, 0x2D, 0x4D,
+    0x19, 0xCA, 0x49, 0xC9, 0x09, 0xCA, 0x49, 0xC1, 0x9C, 0xA3, 0x9C, 0xA1, 0x9C, 0xA1, 0xEA, 0x29,
+    0xCA, 0x1A, 0xAD, 0xA1, 0x9C, 0xA4, 0x9D, 0x09, 0xCA, 0x5A, 0xC9, 0x9D, 0x94, 0xDA, 0x9F, 0x91,
+    0x9D, 0xA9, 0xFF, 0xD9, 0x9D, 0xAF, 0xE0, 0x9C, 0xA1, 0x9F, 0x90, 0x9C, 0xA7, 0x09, 0xCA, 0x70,
+    0x9C, 0xA7, 0x09, 0xCA, 0x70, 0x0A, 0x95, 0xAA, 0x1D, 0x5D, 0x19, 0xCA, 0x4D, 0x2D, 0x4D, 0x2A,
+    0xD3, 0xD3, 0xD9, 0x19, 0xD3, 0xAD, 0x1A, 0xCA, 0x4D, 0x90, 0xD9, 0x4A, 0xDA, 0xD5, 0x9F, 0xA6,
+    0xF7, 0xEA, 0x7E, 0x70, 0xE7, 0x0A, 0xD9, 0x79, 0xD9, 0x79, 0xDA, 0x70, 0xD9, 0x20, 0x19, 0xAF,
+    0xAA, 0x2A, 0xDA, 0xAF, 0x2D, 0x59, 0x2A, 0xCA, 0x71, 0xDA, 0x71, 0xE7, 0x1A, 0xD9, 0x70, 0x9D,
+    0x95, 0xAF, 0xC9, 0x3F, 0xAE, 0x91, 0xAD, 0x92, 0xAD, 0x1D, 0xA4, 0xD9, 0x9D, 0x94, 0xDA, 0x0D,
+    0x94, 0xDA, 0x0E, 0x39, 0xD9, 0x09, 0xFA, 0xF2, 0xAF, 0xE4, 0x9A, 0xEA, 0x20, 0x1A, 0xDA, 0x3A,
+    0xA1, 0xAA, 0x2C, 0x3A, 0x2C, 0x7A, 0xA9, 0x6E, 0x4C, 0xA5, 0x9C, 0x29, 0xC9, 0x1C, 0xA1, 0x9C,
+    0xA1, 0xFD, 0x3A, 0xDA, 0x91, 0x2F, 0xE3, 0x99, 0x9E, 0xA5, 0xAC, 0xA6, 0xD9, 0x6A, 0xCA, 0x69,
+    0xCA, 0x7D, 0x70, 0xD7, 0x9C, 0xA7, 0x0D, 0x70, 0x9D, 0xA9, 0x7F, 0xC9, 0x6A, 0xDA, 0x7D, 0xA7,
+    0xD9, 0x6E, 0x6A, 0xD9, 0x69, 0x99, 0x20, 0x9D, 0xA7, 0x19, 0xD2, 0x99, 0x5A, 0xCA, 0xFC, 0xA3,
+    0xAD, 0xA2, 0xAC, 0x92, 0xAC, 0xA4, 0xD2, 0xAC, 0x94, 0xD2, 0xAC, 0x94, 0xAC, 0x2D, 0x94, 0xD2,
+    0xD9, 0x4D, 0x2D, 0xA4, 0xD2, 0xDA, 0x4D, 0x2D, 0xA4, 0xD9, 0x1E, 0x4D, 0x97, 0x1D, 0x97, 0x1D,
+    0x97, 0x1D, 0x97, 0x09, 0xD9, 0x70, 0x9D, 0xA7, 0x40, 0x39, 0xAA, 0x95, 0x9C, 0xA1, 0xAC, 0x4C,
+    0xA3, 0xAC, 0x2A, 0xC5, 0xC9, 0x1D, 0x5D, 0x1D, 0x5D, 0x1D, 0xAA, 0xAA, 0xAA, 0xD0, 0x9F, 0xFD,
+    0x09, 0xD5, 0xD1, 0xD4, 0x9D, 0x1D, 0x93, 0xAD, 0x1E, 0x29, 0xE1, 0xAF, 0xF9, 0x2F, 0xF3, 0x9F,
+    0xD9, 0x49, 0xEA, 0x30, 0x09, 0x3C, 0xA2, 0xCA, 0x2C, 0xA2, 0xCA, 0x2C, 0xA2, 0xCA, 0x2D, 0x19,
+    0xD1, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xFA, 0xEA, 0x72, 0x9C, 0x91, 0xD2, 0x9C, 0x90, 0xAC, 0x92,
+    0x9C, 0x99, 0xD3, 0xAC, 0x0D, 0x4A, 0xCA, 0xCA, 0x4A, 0xE5, 0xEA, 0x5F, 0xA4, 0xD9, 0xDA, 0x3D,
+    0x0A, 0xDA, 0x2D, 0x1E, 0x91, 0xD2, 0xE9, 0x0A, 0xAA, 0x97, 0xFC, 0x6F, 0xD9, 0x7A, 0xE7, 0x0A,
+    0xD9, 0x70, 0xE7, 0x9E, 0x7A, 0xE9, 0x6F, 0xA5, 0xAF, 0xC4, 0x9D, 0x99, 0xD4, 0xE1, 0xD3, 0x9D,
+    0x2D, 0x92, 0xDA, 0x2A, 0xCA, 0x19, 0xD4, 0xD1, 0xD9, 0x4D, 0x09, 0xD5, 0xAC, 0x90, 0x0D, 0x5D,
+    0x09, 0xD9, 0x4D, 0x09, 0xD9, 0x4D, 0x09, 0xD9, 0x4D, 0x09, 0xDA, 0x4D, 0x09, 0xDA, 0x4D, 0x09,
+    0xDA, 0x4D, 0x99, 0xE3, 0xAD, 0x9A, 0xFA, 0xAF, 0x9A, 0xFF, 0xD9, 0xAC, 0xAF, 0xF9, 0xAC, 0x0A,
+    0xEA, 0x0D, 0x9A, 0xC7, 0x1A, 0xA7, 0x10, 0x09, 0x95, 0x99, 0x1D, 0x5D, 0x19, 0xCA, 0x4D, 0x2D,
+    0x4D, 0x2A, 0xCA, 0x3D, 0x3D, 0x3D, 0x3A, 0xCA, 0x19, 0xD4, 0xD9, 0x0D, 0x94, 0xEA, 0xD5, 0x9F,
+    0xC5, 0x9F, 0x96, 0xF2, 0x09, 0xFE, 0x39, 0x99, 0xEA, 0x5D, 0x96, 0xAC, 0x70, 0xCA, 0x70, 0xD9,
+    0x79, 0xF9, 0x5D, 0xA9, 0x5A, 0xC7, 0x0D, 0x70, 0xAC, 0xA7, 0x0F, 0xA6, 0x9A, 0xD9, 0x70, 0xD7,
+    0x9D, 0x7D, 0xA6, 0xE6, 0x99, 0x92, 0x2A, 0xEA, 0x5F, 0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49,
+    0xCA, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29,
+    0xDA, 0x1F, 0xFC, 0x3F, 0xE9, 0x4A, 0xEA, 0x30, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x09, 0xFF,
+    0xE9, 0x2C, 0xA2, 0xD4, 0x9C, 0xA2, 0xD4, 0x9C, 0xA2, 0xCA, 0x49, 0xC9, 0x19, 0xCA, 0x4A, 0xC9,
+    0x19, 0xC9, 0x4A, 0xC9, 0x1A, 0xC9, 0x4A, 0xC2, 0xAC, 0x94, 0xD2, 0xAD, 0xA3, 0xD2, 0x9E, 0x76,
+    0x5A, 0xCA, 0x96, 0x9F, 0xD4, 0x9D, 0x91, 0xAC, 0xA3, 0xDA, 0x3D, 0x3D, 0x4A, 0xC9, 0x19, 0xD4,
+    0xAC, 0x91, 0xAD, 0x4A, 0xC9, 0x1E, 0x93, 0xAC, 0x91, 0xF3, 0xD2, 0xFF, 0xD1, 0x9D, 0xAF, 0xD9,
+    0x19, 0xD0, 0xAF, 0x3A, 0xD7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0x97, 0x19, 0x72, 0x72, 0xAF, 0x91,
+    0xD9, 0x1A, 0xC9, 0x0C, 0x95, 0x9C, 0x69, 0xC7, 0xC9, 0x6D, 0x7D, 0x96, 0xDA, 0x5A, 0xD5, 0xAD,
+    0x5A, 0xD5, 0x9A, 0xC2, 0x2A, 0xFF, 0xCA, 0x1F, 0xF9, 0x99, 0x1D, 0x92, 0x9D, 0x39, 0xCA, 0x49,
+    0xCA, 0x2A, 0xC9, 0x5D, 0x2A, 0xC9, 0x5D, 0x2D, 0x95, 0xD2, 0xAC, 0xA4, 0x9D, 0x29, 0xD9, 0x29,
+    0xDA, 0x3F, 0xFC, 0x5F, 0xE9, 0x6A, 0xEA, 0x50, 0x0A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x9F, 0xFD,
+    0x5D, 0x71, 0xD7, 0x1D, 0x71, 0xCA, 0x70, 0x9C, 0xA7, 0x09, 0xC9, 0x70, 0xAC, 0x97, 0x0A, 0xDA,
+    0x79, 0xE9, 0x76, 0x09, 0x39, 0x91, 0x9C, 0x92, 0x9C, 0x91, 0xC9, 0x3C, 0xA1, 0xC9, 0x3A, 0xC1,
+    0xCA, 0x39, 0xC1, 0xCA, 0x39, 0xC9, 0x0C, 0xA3, 0x9C, 0x90, 0xD3, 0x9C, 0x90, 0xDA, 0x2D, 0x90,
+    0xAF, 0xE2, 0xFE, 0x29, 0xFA, 0x73, 0x79, 0x97, 0x6C, 0xA7, 0x6C, 0xA7, 0x6C, 0xA7, 0x6C, 0xA7,
+    0x39, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA0, 0xCA, 0x0F, 0x3E, 0xA1, 0xC9, 0x1A, 0xE1, 0x9D, 0xA2,
+    0xC9, 0x2E, 0x1A, 0xD9, 0x2C, 0x92, 0x9D, 0x90, 0xE3, 0xC9, 0x3D, 0xA0, 0xDA, 0x3C, 0x93, 0xE0,
+    0xD9, 0x3C, 0x93, 0xAD, 0x0D, 0x93, 0xC9, 0x3A, 0xD0, 0xDA, 0x3C, 0x93, 0xDA, 0x0E, 0x3C, 0x93,
+    0xDA, 0x0A, 0xDA, 0x2C, 0x92, 0xE9, 0x09, 0xFA, 0xAC, 0xA9, 0xAF, 0x2F, 0xFF, 0xD2, 0x9F, 0xFF,
+    0x5F, 0xFD, 0x96, 0x9A, 0xFC, 0x97, 0x29, 0xC7, 0x69, 0xC7, 0x79, 0x70, 0x09, 0x75, 0xEA, 0x5D,
+    0x2F, 0xC3, 0xD5, 0xAE, 0x1A, 0xCA, 0x69, 0xD9, 0x0D, 0x70, 0xAF, 0x97, 0x1F, 0x72, 0xAD, 0x73,
+    0xE9, 0x71, 0xFC, 0x70, 0x9D, 0xAD, 0x97, 0xDA, 0x0E, 0x6E, 0x19, 0xDA, 0x4A, 0xDA, 0x2F, 0xC9,
+    0x09, 0xE3, 0x9F, 0xA0, 0xE9, 0x49, 0xEA, 0x39, 0x97, 0x1A, 0xC7, 0x1A, 0xC6, 0xA1, 0x9C, 0x19,
+    0x29, 0xC9, 0x09, 0xC1, 0xAC, 0x2C, 0x90, 0x9C, 0x19, 0xC9, 0x1C, 0x90, 0x9C, 0x2C, 0xA1, 0xCA,
+    0x1C, 0x2C, 0xA1, 0xCA, 0x1C, 0x91, 0xD1, 0xD1, 0xC9, 0x1D, 0x1D, 0x1C, 0x91, 0xD1, 0xAD, 0x9C,
+    0xA9, 0xAD, 0x19, 0xFF, 0xA2, 0xFF, 0x4A, 0xFA, 0x7C, 0xA7, 0x1A, 0xC7, 0x1A, 0xC7, 0x1A, 0xC7,
+    0x19, 0xA4, 0x29, 0x97, 0x3A, 0xC9, 0x5D, 0x3D, 0x6A, 0xC9, 0x1A, 0xC9, 0x7C, 0xA1, 0xD3, 0x93,
+    0xD1, 0xD2, 0x9A, 0x3D, 0x09, 0xD2, 0x9A, 0x3D, 0x1D, 0x29, 0xC2, 0x9D, 0x1D, 0x91, 0xDA, 0x09,
+    0xD9, 0x19, 0xFC, 0xAF, 0xC3, 0x9A, 0xD9, 0x0A, 0xDA, 0x77, 0x10, 0x69, 0xD7, 0x5E, 0xA7, 0x4F,
+    0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D,
+    0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA,
+    0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70,
+    0xAD, 0xA7, 0x77, 0x77, 0x77, 0x19, 0xD7, 0x5A, 0xD7, 0x5E, 0x97, 0x49, 0x99, 0x60, 0x77, 0xAE,
+    0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D,
+    0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA,
+    0x90, 0xD7, 0x77, 0x4D, 0x70, 0x9D, 0x97, 0xAD, 0xA7, 0x99, 0x99, 0x30, 0x6A, 0xDA, 0x77, 0xC9,
+    0x75, 0xAA, 0x75, 0xAA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC,
+    0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD,
+    0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA,
+    0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0,
+    0x4A, 0xA9, 0x72, 0xC9, 0x71, 0xC7, 0x1C, 0x77, 0x77, 0x74, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA,
+    0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD,
+    0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x70, 0xAC, 0x76,
+    0xCA, 0x75, 0xAC, 0x76, 0xD7, 0x77, 0x69, 0xCA, 0x75, 0xE9, 0x73, 0xCA, 0x09, 0xC9, 0x71, 0xA4,
+    0xA9, 0x77, 0x77, 0x74, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7,
+    0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D,
+    0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF,
+    0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x77, 0x7A, 0xC7, 0x2C, 0x97, 0x1A,
+    0xC7, 0x2D, 0x77, 0x77, 0xAC, 0x71, 0x9D, 0xA7, 0x9C, 0x99, 0xCA, 0x59, 0xC3, 0xAA, 0x77, 0x3A,
+    0xE9, 0x99, 0x4F, 0xF3, 0xAC, 0xA2, 0xE3, 0xCA, 0x39, 0xD2, 0x9C, 0x5D, 0x2A, 0xC5, 0xD2, 0xD5,
+    0xD9, 0x1D, 0x49, 0xD9, 0x1A, 0xD9, 0x1A, 0xEA, 0x2F, 0xFC, 0xA2, 0xAF, 0xDA, 0xCA, 0x39, 0xAD,
+    0xA9, 0x0D, 0x00, 0x09, 0x97, 0x7A, 0xCA, 0x77, 0xAD, 0x39, 0x72, 0x9A, 0xA1, 0x9C, 0xA7, 0x59,
+    0xEA, 0x73, 0x9C, 0x90, 0x9C, 0xA7, 0x2A, 0x4A, 0x97, 0x77, 0x77, 0x79, 0xD7, 0x6E, 0xA7, 0x5F,
+    0x74, 0xAC, 0xAD, 0x97, 0x3D, 0x9A, 0xCA, 0x72, 0x9D, 0x09, 0xD7, 0x2A, 0xCA, 0x1D, 0x97, 0x1D,
+    0x91, 0xAD, 0x70, 0x9D, 0x29, 0xD7, 0x0D, 0xA3, 0xDA, 0x7D, 0x93, 0xAD, 0x6A, 0xD4, 0x9D, 0x95,
+    0xEA, 0xAA, 0xAA, 0xAD, 0xA4, 0x9F, 0xFF, 0x4A, 0xFF, 0xF9, 0x3E, 0x7E, 0x29, 0xDA, 0x7E, 0x2E,
+    0x70, 0xAD, 0xA0, 0x0C, 0xA7, 0x39, 0xD7, 0x39, 0xD9, 0x76, 0xAC, 0x72, 0x9D, 0xA7, 0x09, 0xC9,
+    0x9C, 0xA6, 0x9C, 0x3A, 0xA7, 0x75, 0xAE, 0x99, 0x95, 0xFF, 0x4A, 0xCA, 0x2E, 0x4C, 0xA3, 0x9D,
+    0x39, 0xC5, 0xD3, 0xAC, 0x5D, 0x3D, 0x5D, 0x92, 0xD4, 0x9D, 0x92, 0xAD, 0x91, 0xAE, 0xA3, 0xFF,
+    0xCA, 0x3A, 0xFD, 0xAC, 0xA4, 0x9A, 0xDA, 0x90, 0xD0, 0x69, 0xAA, 0x97, 0x49, 0x1C, 0x76, 0xAA,
+    0x75, 0x9A, 0x77, 0x76, 0x9C, 0xA7, 0x5E, 0x97, 0x3C, 0x90, 0x9C, 0x97, 0x1A, 0x4A, 0x97, 0x77,
+    0x77, 0x49, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09,
+    0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93,
+    0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E,
+    0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x69, 0xAC, 0xA7, 0x2A, 0xA7, 0x0A, 0xA7, 0x1A,
+    0x69, 0xC9, 0x79, 0xE9, 0x59, 0xC9, 0x09, 0xC9, 0x4A, 0x4A, 0x77, 0x1A, 0xE9, 0x99, 0x3F, 0xF2,
+    0xAC, 0xA2, 0xE2, 0xCA, 0x39, 0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9, 0x0D, 0x49, 0xD9,
+    0x0A, 0xD9, 0x1A, 0xEA, 0x1F, 0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9, 0x0D, 0x5D, 0x91,
+    0x99, 0x70, 0x9C, 0x9C, 0x1A, 0x97, 0x0A, 0xA0, 0x9C, 0x9C, 0x71, 0xC9, 0x1A, 0xCA, 0x77, 0x77,
+    0x76, 0xD7, 0x5F, 0x73, 0xCA, 0x1A, 0xC7, 0x1A, 0x49, 0x97, 0x77, 0x39, 0xD7, 0x5E, 0xA7, 0x4F,
+    0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D,
+    0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA,
+    0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70,
+    0xAD, 0xA0, 0x2A, 0xCA, 0x2A, 0x4C, 0x9A, 0xA0, 0x9C, 0x39, 0xC1, 0xC9, 0xAA, 0x39, 0xC1, 0x9D,
+    0x77, 0x77, 0xAC, 0x97, 0x9E, 0x69, 0xC9, 0x0A, 0xC4, 0x9A, 0x39, 0xA5, 0xAE, 0x99, 0x93, 0xFF,
+    0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D,
+    0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD0, 0x79,
+    0x76, 0x9C, 0xA7, 0x49, 0xEA, 0x72, 0x9C, 0x90, 0x9C, 0xA7, 0x1A, 0x4A, 0x97, 0x77, 0x77, 0x49,
+    0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD, 0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A,
+    0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79, 0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A,
+    0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD, 0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19,
+    0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA7, 0x77, 0x77, 0x77, 0x19, 0xD7, 0x5A, 0xD7, 0x5E, 0x97, 0x49,
+    0x99, 0x60, 0x77, 0x0A, 0xC7, 0x09, 0xDA, 0x69, 0xC9, 0x9C, 0xA4, 0xAA, 0x3A, 0xA7, 0x71, 0xAE,
+    0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D,
+    0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA,
+    0x90, 0xD7, 0x77, 0x4D, 0x70, 0x9D, 0x97, 0xAD, 0xA7, 0x99, 0x99, 0x30, 0x77, 0x71, 0xAC, 0x76,
+    0xC9, 0x75, 0xAC, 0x76, 0xD7, 0x77, 0x77, 0x77, 0x77, 0x7C, 0x4A, 0xC7, 0x0C, 0xA2, 0x9C, 0xA7,
+    0x09, 0xFD, 0x72, 0x9E, 0xA7, 0x77, 0x77, 0x77, 0x79, 0xD7, 0x5E, 0xA7, 0x4F, 0x73, 0xAC, 0xAD,
+    0x97, 0x2D, 0x9A, 0xCA, 0x71, 0x9D, 0x09, 0xD7, 0x1A, 0xCA, 0x1D, 0x97, 0x0D, 0x91, 0xAD, 0x79,
+    0xD2, 0x9D, 0x7D, 0xA3, 0xDA, 0x6D, 0x93, 0xAD, 0x5A, 0xD4, 0x9D, 0x94, 0xEA, 0xAA, 0xAA, 0xAD,
+    0xA3, 0x9F, 0xFF, 0x3A, 0xFF, 0xF9, 0x2E, 0x7E, 0x19, 0xDA, 0x7E, 0x1E, 0x70, 0xAD, 0xA0, 0x77,
+    0x19, 0xC7, 0x1D, 0x71, 0xCA, 0x70, 0xAC, 0x77, 0x77, 0x77, 0x6A, 0xA4, 0xC3, 0xAC, 0x92, 0xAC,
+    0x4F, 0xD9, 0x5A, 0xDA, 0x97, 0x77, 0x6A, 0xE9, 0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39,
+    0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9, 0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F,
+    0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9, 0x0D, 0x77, 0x6D, 0x77, 0xD9, 0x76, 0xAC, 0xA7,
+    0x77, 0x77, 0x77, 0x5C, 0x4A, 0xC7, 0x0C, 0xA3, 0xCA, 0x70, 0x9F, 0xD7, 0x29, 0xEA, 0x77, 0x77,
+    0x77, 0x77, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0,
+    0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9,
+    0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92,
+    0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x76, 0xAC, 0xA7, 0x1A, 0xD7, 0x1A, 0xAC, 0x97,
+    0x77, 0x77, 0x0A, 0xA4, 0xC3, 0xAC, 0x92, 0xAC, 0x4F, 0xD9, 0x5A, 0xDA, 0x97, 0x77, 0x6A, 0xE9,
+    0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39, 0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9,
+    0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F, 0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9,
+    0x0D, 0x6A, 0xAC, 0xA7, 0x7C, 0x76, 0xC9, 0x75, 0x99, 0x77, 0x77, 0x77, 0x77, 0x77, 0xC4, 0xAC,
+    0x70, 0xCA, 0x29, 0xCA, 0x70, 0x9F, 0xD7, 0x29, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x9D, 0x75, 0xEA,
+    0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9,
+    0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9,
+    0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1,
+    0xE7, 0x0A, 0xDA, 0x3A, 0xEA, 0x59, 0x91, 0x9C, 0x97, 0x09, 0xC9, 0x7A, 0xCA, 0x79, 0xC9, 0x77,
+    0x77, 0x77, 0x77, 0x1A, 0xA4, 0xC3, 0xAC, 0x92, 0xAC, 0x4F, 0xD9, 0x5A, 0xDA, 0x97, 0x72, 0xAE,
+    0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C, 0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D,
+    0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE, 0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA,
+    0x90, 0xD0, 0x5D, 0x91, 0xA9, 0x70, 0xAA, 0x0C, 0xA0, 0xC9, 0x70, 0xCA, 0x1E, 0x71, 0x97, 0x77,
+    0x77, 0x72, 0xAA, 0x99, 0x73, 0xC9, 0x3A, 0xC7, 0x0D, 0x29, 0xCA, 0x70, 0x9F, 0xD7, 0x29, 0xEA,
+    0x77, 0x77, 0x77, 0x77, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA, 0xD9, 0x72, 0xD9, 0xAC, 0xA7,
+    0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7, 0x9D, 0x29, 0xD7, 0xDA, 0x3D,
+    0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA, 0xDA, 0x39, 0xFF, 0xF3, 0xAF,
+    0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x2A, 0xD1, 0x9C, 0x4C, 0x0A, 0xC0,
+    0x9A, 0x39, 0xC1, 0xAD, 0x94, 0x97, 0x77, 0x72, 0x9A, 0x99, 0x6A, 0xA4, 0xC3, 0xAC, 0x92, 0xAC,
+    0x4F, 0xD9, 0x5A, 0xDA, 0x97, 0x77, 0x6A, 0xE9, 0x99, 0x3F, 0xF2, 0xAC, 0xA2, 0xE2, 0xCA, 0x39,
+    0xD1, 0x9C, 0x5D, 0x1A, 0xC5, 0xD1, 0xD5, 0xD9, 0x0D, 0x49, 0xD9, 0x0A, 0xD9, 0x1A, 0xEA, 0x1F,
+    0xFC, 0xA1, 0xAF, 0xDA, 0xCA, 0x29, 0xAD, 0xA9, 0x0D, 0x77, 0x5C, 0x4A, 0xC7, 0x0C, 0xA3, 0xCA,
+    0x70, 0x9F, 0xD7, 0x29, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x9D, 0x75, 0xEA, 0x74, 0xF7, 0x3A, 0xCA,
+    0xD9, 0x72, 0xD9, 0xAC, 0xA7, 0x19, 0xD0, 0x9D, 0x71, 0xAC, 0xA1, 0xD9, 0x70, 0xD9, 0x1A, 0xD7,
+    0x9D, 0x29, 0xD7, 0xDA, 0x3D, 0xA6, 0xD9, 0x3A, 0xD5, 0xAD, 0x49, 0xD9, 0x4E, 0xAA, 0xAA, 0xAA,
+    0xDA, 0x39, 0xFF, 0xF3, 0xAF, 0xFF, 0x92, 0xE7, 0xE1, 0x9D, 0xA7, 0xE1, 0xE7, 0x0A, 0xDA, 0x77,
+    0x77, 0x77, 0x71, 0x9D, 0x75, 0xAD, 0x75, 0xE9, 0x74, 0x99, 0x96, 0x75, 0xAA, 0x4C, 0x3A, 0xC9,
+    0x2A, 0xC4, 0xFD, 0x95, 0xAD, 0xA9, 0x77, 0x76, 0xAE, 0x99, 0x93, 0xFF, 0x2A, 0xCA, 0x2E, 0x2C,
+    0xA3, 0x9D, 0x19, 0xC5, 0xD1, 0xAC, 0x5D, 0x1D, 0x5D, 0x90, 0xD4, 0x9D, 0x90, 0xAD, 0x91, 0xAE,
+    0xA1, 0xFF, 0xCA, 0x1A, 0xFD, 0xAC, 0xA2, 0x9A, 0xDA, 0x90, 0xD7, 0x77, 0x4D, 0x70, 0x9D, 0x97,
+    0xAD, 0xA7, 0x99, 0x99, 0x30, 0x59, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD,
+    0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F,
+    0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1,
+    0xFF, 0xE1, 0xFF, 0xE7, 0x73, 0x99, 0x71, 0x9D, 0x71, 0xAD, 0x71, 0xE9, 0x30, 0x49, 0x97, 0xAF,
+    0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0, 0xAC,
+    0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93, 0x9A,
+    0xF9, 0x77, 0x76, 0x99, 0x70, 0x9D, 0x70, 0xAD, 0x97, 0xEA, 0x30, 0x4A, 0xAC, 0xA7, 0x3C, 0x72,
+    0xC9, 0x71, 0x99, 0x77, 0x77, 0x77, 0x19, 0x99, 0x99, 0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91,
+    0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9,
+    0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF,
+    0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x3A, 0xD9, 0x71, 0x9C, 0x70, 0x9C, 0x97, 0x09, 0x97, 0x77, 0x77,
+    0x77, 0x19, 0x97, 0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA,
+    0x0A, 0xFF, 0xD0, 0xAC, 0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF,
+    0x92, 0xFF, 0x93, 0x9A, 0xF9, 0x10, 0x77, 0x0D, 0xA1, 0xA9, 0x4A, 0xA0, 0xCA, 0x0C, 0x94, 0xAA,
+    0x1E, 0x77, 0x77, 0x77, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA, 0x1A, 0xFF, 0xC9, 0x1A, 0xD7, 0x1A,
+    0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A, 0xA9, 0x3A, 0xFE, 0x93, 0xFF, 0x93,
+    0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F, 0xFE, 0x1F, 0xFE,
+    0x1F, 0xFE, 0x00, 0x2D, 0x91, 0xC9, 0x3A, 0xA0, 0xC9, 0x0C, 0x4C, 0x91, 0xE4, 0x97, 0x77, 0x77,
+    0x71, 0x99, 0x7A, 0xF9, 0x4D, 0x91, 0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C, 0xA2, 0x99, 0xAC, 0xA0,
+    0xAF, 0xFD, 0x0A, 0xCA, 0xAA, 0xA9, 0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAF, 0xF9,
+    0x2F, 0xF9, 0x39, 0xAF, 0x91, 0x72, 0xAC, 0x72, 0xC9, 0x71, 0xAC, 0x72, 0xD6, 0xC9, 0x71, 0xAD,
+    0x70, 0xAC, 0x9D, 0x6A, 0xC2, 0xAC, 0x59, 0x49, 0x97, 0x74, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA,
+    0x1A, 0xFF, 0xC9, 0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A,
+    0xA9, 0x3A, 0xFE, 0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA,
+    0xAA, 0xA9, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x00, 0x72, 0xCA, 0x4A, 0x39, 0xC9, 0x3A, 0xD2,
+    0xD3, 0xAC, 0xAC, 0xA0, 0x9C, 0xA2, 0xAC, 0x2C, 0xA5, 0x94, 0x97, 0x77, 0x72, 0x99, 0x70, 0xAF,
+    0x95, 0xD9, 0x19, 0xC9, 0x3A, 0xC4, 0x9C, 0x29, 0xCA, 0x29, 0x9A, 0xCA, 0x1A, 0xFF, 0xD1, 0xAC,
+    0xAA, 0xAA, 0x99, 0x93, 0xD7, 0x2A, 0xCA, 0x71, 0x9D, 0xA7, 0x1A, 0xFF, 0x93, 0xFF, 0x94, 0x9A,
+    0xF9, 0x20, 0x0A, 0xC9, 0x76, 0xAC, 0xA4, 0x97, 0x0A, 0xD2, 0x9D, 0x72, 0x90, 0x9C, 0xAC, 0xA7,
+    0x29, 0xC9, 0x1C, 0xA7, 0x1A, 0x49, 0x97, 0x77, 0x49, 0x99, 0x99, 0x95, 0xAF, 0xFC, 0xA5, 0xAF,
+    0xFC, 0x95, 0xAD, 0x75, 0xAC, 0xA7, 0x5A, 0xCA, 0x75, 0xAC, 0xA7, 0x5A, 0xD9, 0x99, 0xAA, 0x97,
+    0xAF, 0xE9, 0x7F, 0xF9, 0x7E, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xDA, 0x75, 0xEA, 0xAA, 0xAA, 0xAA,
+    0x95, 0xFF, 0xE5, 0xFF, 0xE5, 0xFF, 0xE0, 0x0A, 0xA7, 0x5D, 0x97, 0x4D, 0xA1, 0xA7, 0x19, 0x99,
+    0xAD, 0x72, 0xAC, 0xAC, 0xA7, 0x0A, 0xC2, 0xCA, 0x79, 0x49, 0x77, 0x77, 0x70, 0x99, 0x72, 0xAF,
+    0x97, 0xD9, 0x19, 0xC9, 0x5A, 0xC4, 0x9C, 0x49, 0xCA, 0x29, 0x9A, 0xCA, 0x3A, 0xFF, 0xD3, 0xAC,
+    0xAA, 0xAA, 0x99, 0x95, 0xD7, 0x4A, 0xCA, 0x73, 0x9D, 0xA7, 0x3A, 0xFF, 0x95, 0xFF, 0x96, 0x9A,
+    0xF9, 0x10, 0x70, 0x9A, 0xA9, 0x71, 0x90, 0x9C, 0x73, 0xAA, 0x72, 0xAA, 0x7C, 0x97, 0x2A, 0xD7,
+    0x1A, 0xCA, 0xD7, 0xAC, 0x2A, 0xC6, 0x94, 0x99, 0x77, 0x69, 0x99, 0x99, 0x92, 0xAF, 0xFC, 0xA2,
+    0xAF, 0xFC, 0x92, 0xAD, 0x72, 0xAC, 0xA7, 0x2A, 0xCA, 0x72, 0xAC, 0xA7, 0x2A, 0xD9, 0x99, 0xAA,
+    0x94, 0xAF, 0xE9, 0x4F, 0xF9, 0x4E, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xDA, 0x72, 0xEA, 0xAA, 0xAA,
+    0xAA, 0x92, 0xFF, 0xE2, 0xFF, 0xE2, 0xFF, 0xE1, 0x69, 0xAA, 0x97, 0x90, 0x9C, 0x71, 0xCA, 0x70,
+    0x9A, 0x6A, 0xA7, 0x0A, 0xD9, 0x6A, 0xC9, 0x9C, 0x94, 0xAA, 0x3C, 0x97, 0x77, 0x77, 0x29, 0x97,
+    0xAF, 0x94, 0xD9, 0x19, 0xC9, 0x2A, 0xC4, 0x9C, 0x19, 0xCA, 0x29, 0x9A, 0xCA, 0x0A, 0xFF, 0xD0,
+    0xAC, 0xAA, 0xAA, 0x99, 0x92, 0xD7, 0x1A, 0xCA, 0x70, 0x9D, 0xA7, 0x0A, 0xFF, 0x92, 0xFF, 0x93,
+    0x9A, 0xF9, 0x10, 0x77, 0x0D, 0xA1, 0xA9, 0x4A, 0xA0, 0xCA, 0x0C, 0x94, 0xAA, 0x1E, 0x77, 0x77,
+    0x2C, 0xA7, 0x1A, 0xD9, 0x79, 0xC9, 0xAC, 0x95, 0x9C, 0x29, 0xC9, 0x49, 0x59, 0x79, 0x99, 0x99,
+    0x91, 0xAF, 0xFC, 0xA1, 0xAF, 0xFC, 0x91, 0xAD, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7,
+    0x1A, 0xD9, 0x99, 0xAA, 0x93, 0xAF, 0xE9, 0x3F, 0xF9, 0x3E, 0x71, 0xDA, 0x71, 0xDA, 0x71, 0xDA,
+    0x71, 0xEA, 0xAA, 0xAA, 0xAA, 0x91, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xE0, 0x76, 0xD9, 0x1C, 0x93,
+    0xAA, 0x0C, 0x90, 0xC4, 0xC9, 0x1E, 0x49, 0x77, 0x71, 0xCA, 0x70, 0xAD, 0x96, 0xAC, 0x9A, 0xC9,
+    0x4A, 0xA2, 0x9C, 0x77, 0x77, 0x99, 0x7A, 0xF9, 0x4D, 0x91, 0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C,
+    0xA2, 0x99, 0xAC, 0xA0, 0xAF, 0xFD, 0x0A, 0xCA, 0xAA, 0xA9, 0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09,
+    0xDA, 0x70, 0xAF, 0xF9, 0x2F, 0xF9, 0x39, 0xAF, 0x91, 0x59, 0x72, 0x9D, 0x70, 0x9C, 0xAC, 0xA6,
+    0x9C, 0x91, 0xCA, 0x5A, 0x49, 0x97, 0x74, 0x99, 0x99, 0x99, 0x1A, 0xFF, 0xCA, 0x1A, 0xFF, 0xC9,
+    0x1A, 0xD7, 0x1A, 0xCA, 0x71, 0xAC, 0xA7, 0x1A, 0xCA, 0x71, 0xAD, 0x99, 0x9A, 0xA9, 0x3A, 0xFE,
+    0x93, 0xFF, 0x93, 0xE7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1D, 0xA7, 0x1E, 0xAA, 0xAA, 0xAA, 0xA9, 0x1F,
+    0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x77, 0x39, 0x97, 0x19, 0xD7, 0x1A, 0xD7, 0x1E, 0x93, 0x4A, 0x71,
+    0xAD, 0x7A, 0xCA, 0xCA, 0x5A, 0xC2, 0xAA, 0x49, 0x49, 0x77, 0x77, 0x99, 0x7A, 0xF9, 0x4D, 0x91,
+    0x9C, 0x92, 0xAC, 0x49, 0xC1, 0x9C, 0xA2, 0x99, 0xAC, 0xA0, 0xAF, 0xFD, 0x0A, 0xCA, 0xAA, 0xA9,
+    0x99, 0x2D, 0x71, 0xAC, 0xA7, 0x09, 0xDA, 0x70, 0xAF, 0xF9, 0x2F, 0xF9, 0x39, 0xAF, 0x97, 0x77,
+    0x69, 0x97, 0x09, 0xD7, 0x0A, 0xD9, 0x7E, 0xA3, 0x0A, 0xAA, 0x3A, 0xA1, 0x9C, 0x91, 0xC7, 0x77,
+    0x3A, 0xD1, 0xE1, 0xE1, 0xE1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A,
+    0xD1, 0xAD, 0x1E, 0x90, 0xE9, 0x0E, 0x90, 0xEA, 0x0E, 0xA0, 0x0A, 0xDA, 0x39, 0xC3, 0xC9, 0x29,
+    0x97, 0x75, 0x99, 0x3C, 0xA3, 0xCA, 0x3C, 0xA3, 0xCA, 0x3C, 0xA2, 0x9C, 0xA2, 0x9C, 0xA2, 0x9D,
+    0x29, 0xD2, 0xAD, 0x2A, 0xD1, 0x0A, 0xAA, 0x1E, 0x1E, 0x1E, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD,
+    0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xAD, 0x1A, 0xD1, 0xE9, 0x0E, 0x90, 0xE9, 0x0E, 0xA0, 0xEA, 0x72,
+    0xAD, 0x1E, 0x1E, 0x19, 0x99, 0x00, 0x09, 0xD1, 0xAD, 0x1E, 0x90, 0x99, 0x97, 0x49, 0x3C, 0xA2,
+    0xCA, 0x2C, 0xA2, 0xCA, 0x2C, 0xA1, 0x9C, 0xA1, 0x9C, 0xA1, 0x9D, 0x19, 0xD1, 0xAD, 0x1A, 0xD7,
+    0x3D, 0xA1, 0xDA, 0x1E, 0x19, 0x99, 0x00, 0x49, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA,
+    0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9,
+    0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90,
+    0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97,
+    0x77, 0x77, 0x59, 0x97, 0x59, 0xD7, 0x5A, 0xD9, 0x74, 0xAD, 0xA5, 0x2A, 0xEA, 0x5F, 0xE9, 0x2D,
+    0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC,
+    0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9, 0x4A, 0xEA, 0x77, 0x77, 0x73, 0xAD,
+    0x70, 0xAD, 0x70, 0xE7, 0x09, 0x99, 0x40, 0x69, 0xAA, 0x97, 0x49, 0x1C, 0x97, 0x5A, 0xC7, 0x59,
+    0xA7, 0x77, 0x77, 0x77, 0x69, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D,
+    0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D,
+    0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99,
+    0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x74, 0x3A, 0xD9,
+    0x71, 0x9C, 0x70, 0x9C, 0x71, 0xA7, 0x77, 0x77, 0x77, 0x74, 0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29,
+    0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95, 0xD0, 0xAC, 0x95, 0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49,
+    0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3, 0xFE, 0x94, 0xAE, 0xA3, 0x77, 0x74, 0xD7, 0x71, 0xEA,
+    0x77, 0xCA, 0x1C, 0xA7, 0x5A, 0x93, 0x99, 0x77, 0x77, 0x19, 0xAF, 0xA9, 0x73, 0xFF, 0xD4, 0xC9,
+    0x2E, 0xA3, 0xF2, 0x9C, 0x2E, 0xA5, 0xEA, 0x1D, 0x19, 0xDA, 0x7E, 0x09, 0xC9, 0x1A, 0xD9, 0x79,
+    0xD9, 0x4E, 0x71, 0xDA, 0x4D, 0xA7, 0x1E, 0x4D, 0x97, 0x1A, 0xD4, 0xD9, 0x71, 0xAD, 0x4D, 0xA7,
+    0x1D, 0xA4, 0xE7, 0x1D, 0xA4, 0xAD, 0xA7, 0xE9, 0x49, 0xFA, 0xA9, 0x9A, 0xAF, 0x6F, 0xFF, 0xD6,
+    0x9F, 0xFF, 0x70, 0x9F, 0xFD, 0x97, 0x29, 0xAF, 0xA9, 0x77, 0x74, 0x49, 0x49, 0xC4, 0xAC, 0xA3,
+    0xCA, 0x3A, 0xCA, 0xC9, 0x19, 0xC9, 0x2A, 0xC1, 0x9C, 0x90, 0xD2, 0x9A, 0x4A, 0x77, 0x77, 0x77,
+    0x1A, 0xEA, 0x7F, 0xE9, 0x4D, 0x92, 0x9D, 0x39, 0xCA, 0x49, 0xCA, 0x2A, 0xC9, 0x5D, 0x2A, 0xC9,
+    0x5D, 0x2D, 0x95, 0xD2, 0xAC, 0xA4, 0x9D, 0x29, 0xD9, 0x29, 0xDA, 0x3F, 0xFC, 0x5F, 0xE9, 0x6A,
+    0xEA, 0x50, 0x0A, 0x97, 0x79, 0xD7, 0x79, 0xD9, 0x2D, 0x72, 0x9A, 0x1E, 0xA7, 0x4C, 0xA1, 0xCA,
+    0x72, 0xA9, 0x39, 0x97, 0x77, 0x39, 0xAF, 0xA9, 0x70, 0xFF, 0xD6, 0xEA, 0x3F, 0x4E, 0xA5, 0xEA,
+    0x29, 0xDA, 0x7E, 0x2A, 0xD9, 0x79, 0xD9, 0x1E, 0x71, 0xDA, 0x1D, 0xA7, 0x1E, 0x1D, 0x97, 0x1A,
+    0xD1, 0xD9, 0x71, 0xAD, 0x1D, 0xA7, 0x1D, 0xA1, 0xE7, 0x1D, 0xA1, 0xAD, 0xA7, 0xE9, 0x19, 0xFA,
+    0xA9, 0x9A, 0xAF, 0x3F, 0xFF, 0xD3, 0x9F, 0xFF, 0x59, 0xFF, 0xD9, 0x79, 0xAF, 0xA9, 0x77, 0x50,
+    0x09, 0x97, 0x49, 0xD7, 0x49, 0xD9, 0x19, 0x70, 0x99, 0xA9, 0xAC, 0xA7, 0x2A, 0xE9, 0x70, 0xAC,
+    0x19, 0xC9, 0x69, 0xA4, 0xA7, 0x77, 0x77, 0x75, 0xAE, 0xA7, 0x0F, 0xE9, 0x5D, 0x92, 0x9D, 0x49,
+    0xCA, 0x49, 0xCA, 0x3A, 0xC9, 0x5D, 0x3A, 0xC9, 0x5D, 0x3D, 0x95, 0xD3, 0xAC, 0xA4, 0x9D, 0x39,
+    0xD9, 0x29, 0xDA, 0x4F, 0xFC, 0x6F, 0xE9, 0x7A, 0xEA, 0x30, 0x72, 0x9A, 0xA9, 0x74, 0x91, 0xC7,
+    0x6A, 0xA7, 0x59, 0xA7, 0x2D, 0x75, 0xEA, 0x73, 0xCA, 0x1C, 0xA7, 0x1A, 0x93, 0xA9, 0x77, 0x71,
+    0x9A, 0xFA, 0x97, 0xFF, 0xD5, 0xEA, 0x3F, 0x3E, 0xA5, 0xEA, 0x19, 0xDA, 0x7E, 0x1A, 0xD9, 0x79,
+    0xD9, 0x0E, 0x71, 0xDA, 0x0D, 0xA7, 0x1E, 0x0D, 0x97, 0x1A, 0xD0, 0xD9, 0x71, 0xAD, 0x0D, 0xA7,
+    0x1D, 0xA0, 0xE7, 0x1D, 0xA0, 0xAD, 0xA7, 0xE9, 0x09, 0xFA, 0xA9, 0x9A, 0xAF, 0x2F, 0xFF, 0xD2,
+    0x9F, 0xFF, 0x49, 0xFF, 0xD9, 0x69, 0xAF, 0xA9, 0x77, 0x40, 0x6A, 0xAA, 0x72, 0x9C, 0x71, 0xCA,
+    0x70, 0xA9, 0x6A, 0xA7, 0x0A, 0xD9, 0x6A, 0xC9, 0xAC, 0x5A, 0xC2, 0x9C, 0x77, 0x77, 0x77, 0x5A,
+    0xEA, 0x5F, 0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D, 0x0A, 0xC9, 0x5D,
+    0x0D, 0x95, 0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F, 0xE9, 0x4A, 0xEA,
+    0x30, 0x5A, 0xCA, 0x19, 0xA7, 0x09, 0xC0, 0xC9, 0x09, 0xA7, 0x09, 0xC1, 0xC9, 0xC9, 0x70, 0x99,
+    0x19, 0xD7, 0x77, 0x77, 0x6D, 0x75, 0xAE, 0x73, 0xCA, 0x1A, 0xC7, 0x19, 0x94, 0xA7, 0x09, 0xAF,
+    0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97, 0x9D, 0x90,
+    0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA, 0x71, 0xDA,
+    0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD, 0x29, 0xFF,
+    0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x74, 0x2D, 0x2C, 0x4A, 0xA9, 0xC1, 0xC4, 0xC9, 0x0A,
+    0xA9, 0xC4, 0xC2, 0xAC, 0xA7, 0x77, 0x69, 0xCA, 0x79, 0xEA, 0x59, 0xC9, 0x1C, 0xA4, 0xA4, 0x99,
+    0x77, 0x74, 0xAE, 0xA5, 0xFE, 0x92, 0xD9, 0x29, 0xD1, 0x9C, 0xA4, 0x9C, 0xA0, 0xAC, 0x95, 0xD0,
+    0xAC, 0x95, 0xD0, 0xD9, 0x5D, 0x0A, 0xCA, 0x49, 0xD0, 0x9D, 0x92, 0x9D, 0xA1, 0xFF, 0xC3, 0xFE,
+    0x94, 0xAE, 0xA3, 0x77, 0x70, 0xD7, 0x5E, 0xA7, 0x3C, 0xA1, 0xCA, 0x71, 0xA9, 0x39, 0x97, 0x77,
+    0x19, 0xAF, 0xA9, 0x7F, 0xFD, 0x5E, 0xA3, 0xF3, 0xEA, 0x5E, 0xA1, 0x9D, 0xA7, 0xE1, 0xAD, 0x97,
+    0x9D, 0x90, 0xE7, 0x1D, 0xA0, 0xDA, 0x71, 0xE0, 0xD9, 0x71, 0xAD, 0x0D, 0x97, 0x1A, 0xD0, 0xDA,
+    0x71, 0xDA, 0x0E, 0x71, 0xDA, 0x0A, 0xDA, 0x7E, 0x90, 0x9F, 0xAA, 0x99, 0xAA, 0xF2, 0xFF, 0xFD,
+    0x29, 0xFF, 0xF4, 0x9F, 0xFD, 0x96, 0x9A, 0xFA, 0x97, 0x77, 0x77, 0x59, 0x97, 0x59, 0xD7, 0x5A,
+    0xD9, 0x74, 0xAD, 0xA5, 0x49, 0x71, 0xAC, 0xA7, 0xAE, 0x95, 0xAC, 0x19, 0xC9, 0x39, 0xA4, 0xA7,
+    0x77, 0x77, 0x1A, 0xEA, 0x5F, 0xE9, 0x2D, 0x92, 0x9D, 0x19, 0xCA, 0x49, 0xCA, 0x0A, 0xC9, 0x5D,
+    0x0A, 0xC9, 0x5D, 0x0D, 0x95, 0xD0, 0xAC, 0xA4, 0x9D, 0x09, 0xD9, 0x29, 0xDA, 0x1F, 0xFC, 0x3F,
+    0xE9, 0x4A, 0xEA, 0x77, 0x77, 0x99, 0x71, 0xDA, 0x70, 0xE7, 0x9E, 0x40, 0x77, 0x73, 0x9C, 0x77,
+    0x0D, 0x77, 0x9C, 0x97, 0x7D, 0x77, 0x77, 0x77, 0x77, 0x77, 0x19, 0xC5, 0x9A, 0xFA, 0x92, 0x9C,
+    0x4F, 0xFD, 0x1A, 0xC3, 0xEA, 0x3F, 0x9C, 0x92, 0xEA, 0x5F, 0xA2, 0x9D, 0xA7, 0xE3, 0xAD, 0x97,
+    0x9D, 0x92, 0xE7, 0x1D, 0xA2, 0xDA, 0x71, 0xDA, 0x2D, 0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD, 0x2D,
+    0xA7, 0x1D, 0xA2, 0xE7, 0x1D, 0xA2, 0xAD, 0xA7, 0xE9, 0x29, 0xFA, 0xA9, 0x9A, 0xAF, 0x4F, 0xFF,
+    0xD4, 0x9F, 0xFF, 0x69, 0xFF, 0xD9, 0x70, 0x9A, 0xFA, 0x97, 0x77, 0x00, 0x77, 0x2C, 0xA7, 0x19,
+    0xC7, 0x2D, 0x71, 0x9C, 0xA7, 0x77, 0x77, 0x77, 0x74, 0xA3, 0xAE, 0xA2, 0xA9, 0x1F, 0xE9, 0x0C,
+    0x1D, 0x92, 0x9E, 0xA0, 0x9C, 0xA4, 0x9D, 0x1A, 0xC9, 0x5D, 0x1A, 0xC9, 0x5D, 0x1D, 0x95, 0xD1,
+    0xAC, 0xA4, 0x9D, 0x19, 0xD9, 0x29, 0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5A, 0xEA, 0x40, 0x59, 0x77,
+    0x1A, 0xCA, 0x77, 0x0A, 0xD7, 0x70, 0x9A, 0xA7, 0x77, 0x77, 0x77, 0x59, 0xC5, 0x9A, 0xFA, 0x92,
+    0x9C, 0x4F, 0xFD, 0x1A, 0xC3, 0xEA, 0x3F, 0x9C, 0x92, 0xEA, 0x5F, 0xA2, 0x9D, 0xA7, 0xE3, 0xAD,
+    0x97, 0x9D, 0x92, 0xE7, 0x1D, 0xA2, 0xDA, 0x71, 0xDA, 0x2D, 0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD,
+    0x2D, 0xA7, 0x1D, 0xA2, 0xE7, 0x1D, 0xA2, 0xAD, 0xA7, 0xE9, 0x29, 0xFA, 0xA9, 0x9A, 0xAF, 0x4F,
+    0xFF, 0xD4, 0x9F, 0xFF, 0x69, 0xFF, 0xD9, 0x70, 0x9A, 0xFA, 0x97, 0x77, 0x00, 0x19, 0x97, 0x3D,
+    0x97, 0x2D, 0xA7, 0x29, 0xA9, 0x77, 0x77, 0x77, 0x6A, 0x3A, 0xEA, 0x2A, 0x91, 0xFE, 0x90, 0xC1,
+    0xD9, 0x29, 0xEA, 0x09, 0xCA, 0x49, 0xD1, 0xAC, 0x95, 0xD1, 0xAC, 0x95, 0xD1, 0xD9, 0x5D, 0x1A,
+    0xCA, 0x49, 0xD1, 0x9D, 0x92, 0x9D, 0xA2, 0xFF, 0xC4, 0xFE, 0x95, 0xAE, 0xA4, 0x69, 0xAA, 0x97,
+    0x69, 0x1C, 0x97, 0x79, 0xC7, 0x70, 0xC7, 0x77, 0x77, 0x77, 0x77, 0x71, 0x9C, 0x59, 0xAF, 0xA9,
+    0x29, 0xC4, 0xFF, 0xD1, 0xAC, 0x3E, 0xA3, 0xF9, 0xC9, 0x2E, 0xA5, 0xFA, 0x29, 0xDA, 0x7E, 0x3A,
+    0xD9, 0x79, 0xD9, 0x2E, 0x71, 0xDA, 0x2D, 0xA7, 0x1D, 0xA2, 0xD9, 0x71, 0xAD, 0x2D, 0x97, 0x1A,
+    0xD2, 0xDA, 0x71, 0xDA, 0x2E, 0x71, 0xDA, 0x2A, 0xDA, 0x7E, 0x92, 0x9F, 0xAA, 0x99, 0xAA, 0xF4,
+    0xFF, 0xFD, 0x49, 0xFF, 0xF6, 0x9F, 0xFD, 0x97, 0x09, 0xAF, 0xA9, 0x77, 0x70, 0x3A, 0xD9, 0x72,
+    0x9C, 0x71, 0x9C, 0x72, 0xA7, 0x77, 0x77, 0x77, 0x75, 0xA3, 0xAE, 0xA2, 0xA9, 0x1F, 0xE9, 0x0C,
+    0x1D, 0x92, 0x9E, 0xA0, 0x9C, 0xA4, 0x9D, 0x1A, 0xC9, 0x5D, 0x1A, 0xC9, 0x5D, 0x1D, 0x95, 0xD1,
+    0xAC, 0xA4, 0x9D, 0x19, 0xD9, 0x29, 0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5A, 0xEA, 0x40, 0x5A, 0xCA,
+    0x2A, 0x73, 0xC9, 0xA9, 0x09, 0xA7, 0x29, 0xC1, 0xC9, 0xAA, 0x72, 0x9C, 0x19, 0xD7, 0x77, 0x77,
+    0x77, 0x49, 0xC5, 0x9A, 0xFA, 0x92, 0x9C, 0x4F, 0xFD, 0x1A, 0xC3, 0xEA, 0x3F, 0x9C, 0x92, 0xEA,
+    0x5F, 0xA2, 0x9D, 0xA7, 0xE3, 0xAD, 0x97, 0x9D, 0x92, 0xE7, 0x1D, 0xA2, 0xDA, 0x71, 0xDA, 0x2D,
+    0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD, 0x2D, 0xA7, 0x1D, 0xA2, 0xE7, 0x1D, 0xA2, 0xAD, 0xA7, 0xE9,
+    0x29, 0xFA, 0xA9, 0x9A, 0xAF, 0x4F, 0xFF, 0xD4, 0x9F, 0xFF, 0x69, 0xFF, 0xD9, 0x70, 0x9A, 0xFA,
+    0x97, 0x77, 0x00, 0x2D, 0x2C, 0x5A, 0xA9, 0xC1, 0xC5, 0xC9, 0x0A, 0xA9, 0xC5, 0xC2, 0xAC, 0x97,
+    0x77, 0x77, 0x75, 0x93, 0xAE, 0xA2, 0xA9, 0x1F, 0xE9, 0x0C, 0x1D, 0x92, 0x9E, 0xA0, 0x9C, 0xA4,
+    0x9D, 0x1A, 0xC9, 0x5D, 0x1A, 0xC9, 0x5D, 0x1D, 0x95, 0xD1, 0xAC, 0xA4, 0x9D, 0x19, 0xD9, 0x29,
+    0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5A, 0xEA, 0x40, 0x77, 0x77, 0x29, 0xC5, 0x9A, 0xFA, 0x92, 0x9C,
+    0x4F, 0xFD, 0x1A, 0xC3, 0xEA, 0x3F, 0x9C, 0x92, 0xEA, 0x5F, 0xA2, 0x9D, 0xA7, 0xE3, 0xAD, 0x97,
+    0x9D, 0x92, 0xE7, 0x1D, 0xA2, 0xDA, 0x71, 0xDA, 0x2D, 0x97, 0x1A, 0xD2, 0xD9, 0x71, 0xAD, 0x2D,
+    0xA7, 0x1D, 0xA2, 0xE7, 0x1D, 0xA2, 0xAD, 0xA7, 0xE9, 0x29, 0xFA, 0xA9, 0x9A, 0xAF, 0x4F, 0xFF,
+    0xD4, 0x9F, 0xFF, 0x69, 0xFF, 0xD9, 0x70, 0x9A, 0xFA, 0x97, 0x77, 0x77, 0x73, 0x99, 0x77, 0x9D,
+    0x77, 0xAD, 0x97, 0x6A, 0xDA, 0x70, 0x72, 0xA3, 0xAE, 0xA2, 0xA9, 0x1F, 0xE9, 0x0C, 0x1D, 0x92,
+    0x9E, 0xA0, 0x9C, 0xA4, 0x9D, 0x1A, 0xC9, 0x5D, 0x1A, 0xC9, 0x5D, 0x1D, 0x95, 0xD1, 0xAC, 0xA4,
+    0x9D, 0x19, 0xD9, 0x29, 0xDA, 0x2F, 0xFC, 0x4F, 0xE9, 0x5A, 0xEA, 0x77, 0x77, 0x77, 0xAD, 0x71,
+    0xAD, 0x71, 0xE7, 0x19, 0x99, 0x50, 0x0A, 0xAA, 0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59,
+    0xE0, 0xE6, 0x9E, 0x0E, 0x69, 0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7,
+    0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE,
+    0x49, 0xE9, 0x09, 0xFF, 0xF2, 0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x77, 0x69, 0x97,
+    0x39, 0xD7, 0x3A, 0xD9, 0x72, 0xE9, 0x40, 0xD5, 0xD0, 0xAC, 0x94, 0xD0, 0xAC, 0x94, 0xD0, 0xAC,
+    0x94, 0xD0, 0xAC, 0xA4, 0xD0, 0x9C, 0xA4, 0xD0, 0x9C, 0xA4, 0xD9, 0x9D, 0x3A, 0xD9, 0x0E, 0xAA,
+    0xF9, 0x0F, 0xFC, 0x90, 0xAF, 0xF9, 0x1A, 0xEA, 0x0D, 0x97, 0x77, 0x1D, 0x96, 0x9D, 0x96, 0xAD,
+    0xA6, 0x99, 0x99, 0x30, 0x59, 0xAA, 0x97, 0x29, 0x1C, 0x74, 0xAC, 0x73, 0x9A, 0x77, 0x77, 0x77,
+    0x77, 0x2A, 0xAA, 0x69, 0xAA, 0xA0, 0xE9, 0x5A, 0xE0, 0xE9, 0x59, 0xE0, 0xE6, 0x9E, 0x0E, 0x69,
+    0xE0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE6, 0x9D, 0xA0, 0xE7, 0xDA, 0x0A, 0xD7, 0xDA, 0x0A,
+    0xD7, 0xDA, 0x0A, 0xD6, 0x9D, 0x90, 0xAD, 0x95, 0xAD, 0x90, 0xAE, 0x49, 0xE9, 0x09, 0xFF, 0xF2,
+    0xFF, 0xF2, 0xAF, 0xFD, 0x93, 0x9F, 0xF9, 0x77, 0x00, 0x2A, 0xDA, 0x71, 0xC9, 0x7C, 0x97, 0x09,
+    0x77, 0x77, 0x5D, 0x5D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xC9, 0x4D, 0x0A, 0xCA, 0x4D,
+    0x09, 0xCA, 0x4D, 0x09, 0xCA, 0x4D, 0x99, 0xD3, 0xAD, 0x90, 0xEA, 0xAF, 0x90, 0xFF, 0xC9, 0x0A,
+    0xFF, 0x91, 0xAE, 0xA0, 0xD9, 0x79, 0xC7, 0x6C, 0xA7, 0x59, 0xC9, 0x75, 0xD7, 0x77, 0x77, 0x77,
+    0x0A, 0x97, 0x6A, 0xC0, 0xAA, 0xA6, 0x9A, 0xAA, 0xCA, 0x0E, 0x95, 0xAF, 0x1E, 0x95, 0x9E, 0x2E,
+    0x69, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9D, 0xA2, 0xE6, 0x9D, 0xA2, 0xE7, 0xDA, 0x2A,
+    0xD7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A, 0xD6, 0x9D, 0x92, 0xAD, 0x95, 0xAD, 0x92, 0xAE, 0x49, 0xE9,
+    0x29, 0xFF, 0xF4, 0xFF, 0xF4, 0xAF, 0xFD, 0x95, 0x9F, 0xF9, 0x77, 0x40, 0x49, 0xC7, 0x2C, 0xA7,
+    0x19, 0xC9, 0x71, 0xD7, 0x77, 0x77, 0x77, 0x0C, 0x0D, 0x5D, 0x0C, 0x0A, 0xC9, 0x4D, 0xAC, 0x0A,
+    0xC9, 0x4E, 0x1A, 0xC9, 0x4D, 0x2A, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x91, 0x9D,
+    0x3A, 0xD9, 0x2E, 0xAA, 0xF9, 0x2F, 0xFC, 0x92, 0xAF, 0xF9, 0x3A, 0xEA, 0x0D, 0x91, 0x77, 0x5D,
+    0x77, 0xD9, 0x76, 0xDA, 0x77, 0x77, 0x69, 0x97, 0x6A, 0xC0, 0xAA, 0xA6, 0x9A, 0xAA, 0xCA, 0x0E,
+    0x95, 0xAF, 0x1E, 0x95, 0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9D, 0xA2,
+    0xE6, 0x9D, 0xA2, 0xE7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A, 0xD6, 0x9D, 0x92, 0xAD,
+    0x95, 0xAD, 0x92, 0xAE, 0x49, 0xE9, 0x29, 0xFF, 0xF4, 0xFF, 0xF4, 0xAF, 0xFD, 0x95, 0x9F, 0xF9,
+    0x77, 0x40, 0x1C, 0xA7, 0x3D, 0x97, 0x2D, 0xA7, 0x77, 0x77, 0x2C, 0x0D, 0x5D, 0x0C, 0x0A, 0xC9,
+    0x4D, 0xAC, 0x0A, 0xC9, 0x4E, 0x1A, 0xC9, 0x4D, 0x2A, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x29, 0xCA,
+    0x4D, 0x91, 0x9D, 0x3A, 0xD9, 0x2E, 0xAA, 0xF9, 0x2F, 0xFC, 0x92, 0xAF, 0xF9, 0x3A, 0xEA, 0x0D,
+    0x91, 0x59, 0xAA, 0x97, 0x49, 0x1C, 0x76, 0xAC, 0x75, 0x9C, 0x77, 0x77, 0x77, 0x70, 0xA9, 0x76,
+    0xAC, 0x0A, 0xAA, 0x69, 0xAA, 0xAC, 0xA0, 0xE9, 0x5A, 0xF1, 0xE9, 0x59, 0xE2, 0xE6, 0x9E, 0x2E,
+    0x69, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xDA, 0x2E, 0x69, 0xDA, 0x2E, 0x7D, 0xA2, 0xAD, 0x7D, 0xA2,
+    0xAD, 0x7D, 0xA2, 0xAD, 0x69, 0xD9, 0x2A, 0xD9, 0x5A, 0xD9, 0x2A, 0xE4, 0x9E, 0x92, 0x9F, 0xFF,
+    0x4F, 0xFF, 0x4A, 0xFF, 0xD9, 0x59, 0xFF, 0x97, 0x74, 0x2A, 0xDA, 0x73, 0xC9, 0x71, 0xC9, 0x72,
+    0x97, 0x77, 0x77, 0x3C, 0x0D, 0x5D, 0x0C, 0x0A, 0xC9, 0x4D, 0xAC, 0x0A, 0xC9, 0x4E, 0x1A, 0xC9,
+    0x4D, 0x2A, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x91, 0x9D, 0x3A, 0xD9, 0x2E, 0xAA,
+    0xF9, 0x2F, 0xFC, 0x92, 0xAF, 0xF9, 0x3A, 0xEA, 0x0D, 0x91, 0x4A, 0xC9, 0x19, 0x97, 0x09, 0xC0,
+    0xC9, 0x0A, 0x97, 0x0A, 0xA0, 0x9C, 0x9C, 0x97, 0x0A, 0xA1, 0x9D, 0x77, 0x77, 0x5A, 0x97, 0x6A,
+    0xC0, 0xAA, 0xA6, 0x9A, 0xAA, 0xCA, 0x0E, 0x95, 0xAF, 0x1E, 0x95, 0x9E, 0x2E, 0x69, 0xE2, 0xE6,
+    0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9D, 0xA2, 0xE6, 0x9D, 0xA2, 0xE7, 0xDA, 0x2A, 0xD7, 0xDA, 0x2A,
+    0xD7, 0xDA, 0x2A, 0xD6, 0x9D, 0x92, 0xAD, 0x95, 0xAD, 0x92, 0xAE, 0x49, 0xE9, 0x29, 0xFF, 0xF4,
+    0xFF, 0xF4, 0xAF, 0xFD, 0x95, 0x9F, 0xF9, 0x77, 0x40, 0x76, 0xDA, 0x19, 0xA4, 0x9C, 0x0A, 0xA0,
+    0xA9, 0x4A, 0xA1, 0xAD, 0x77, 0x77, 0x71, 0xC0, 0xD5, 0xD0, 0xC0, 0xAC, 0x94, 0xDA, 0xC0, 0xAC,
+    0x94, 0xE1, 0xAC, 0x94, 0xD2, 0xAC, 0xA4, 0xD2, 0x9C, 0xA4, 0xD2, 0x9C, 0xA4, 0xD9, 0x19, 0xD3,
+    0xAD, 0x92, 0xEA, 0xAF, 0x92, 0xFF, 0xC9, 0x2A, 0xFF, 0x93, 0xAE, 0xA0, 0xD9, 0x10, 0x77, 0x77,
+    0x99, 0x76, 0xAC, 0x0A, 0xAA, 0x69, 0xAA, 0xAC, 0xA0, 0xE9, 0x5A, 0xF1, 0xE9, 0x59, 0xE2, 0xE6,
+    0x9E, 0x2E, 0x69, 0xE2, 0xE6, 0x9E, 0x2E, 0x69, 0xDA, 0x2E, 0x69, 0xDA, 0x2E, 0x7D, 0xA2, 0xAD,
+    0x7D, 0xA2, 0xAD, 0x7D, 0xA2, 0xAD, 0x69, 0xD9, 0x2A, 0xD9, 0x5A, 0xD9, 0x2A, 0xE4, 0x9E, 0x92,
+    0x9F, 0xFF, 0x4F, 0xFF, 0x4A, 0xFF, 0xD9, 0x59, 0xFF, 0x97, 0x77, 0x77, 0x49, 0x97, 0x59, 0xD7,
+    0x5A, 0xD9, 0x74, 0xE9, 0x60, 0x77, 0x7C, 0x0D, 0x5D, 0x0C, 0x0A, 0xC9, 0x4D, 0xAC, 0x0A, 0xC9,
+    0x4E, 0x1A, 0xC9, 0x4D, 0x2A, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x29, 0xCA, 0x4D, 0x91, 0x9D, 0x3A,
+    0xD9, 0x2E, 0xAA, 0xF9, 0x2F, 0xFC, 0x92, 0xAF, 0xF9, 0x3A, 0xEA, 0x0D, 0x97, 0x77, 0x7D, 0x97,
+    0x09, 0xD9, 0x70, 0xAD, 0xA7, 0x09, 0x99, 0x95, 0x77, 0x39, 0xCA, 0x75, 0x9D, 0x97, 0x49, 0xAC,
+    0x97, 0x77, 0x77, 0x76, 0xDA, 0x7A, 0xD1, 0x9D, 0x96, 0xD9, 0x2E, 0x5A, 0xD3, 0x9D, 0x93, 0x9D,
+    0x94, 0xE3, 0xE5, 0x9D, 0xA1, 0x9D, 0xA6, 0xE1, 0xE7, 0xAD, 0xAA, 0xDA, 0x70, 0xFD, 0x71, 0xAF,
+    0xA7, 0x2F, 0x73, 0xAD, 0xA7, 0x3A, 0xDA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA,
+    0x72, 0xAE, 0xA5, 0x1A, 0xC9, 0x71, 0xAC, 0xA7, 0x1A, 0xD9, 0x77, 0x77, 0x77, 0x3A, 0xC9, 0x5D,
+    0x1D, 0x5D, 0x1A, 0xCA, 0x39, 0xCA, 0x2D, 0x3D, 0x92, 0xAC, 0xA2, 0xD9, 0x29, 0xD9, 0x09, 0xD4,
+    0xE0, 0xAD, 0x49, 0xD9, 0xDA, 0x5F, 0xC9, 0x59, 0xF7, 0xF7, 0xAD, 0xA7, 0xAD, 0x97, 0xE6, 0x9E,
+    0xA4, 0xFD, 0x5F, 0xA6, 0xAA, 0xA7, 0x0D, 0xA7, 0xAD, 0x19, 0xD9, 0x6D, 0x92, 0xE5, 0xAD, 0x39,
+    0xD9, 0x39, 0xD9, 0x4E, 0x3E, 0x59, 0xDA, 0x19, 0xDA, 0x6E, 0x1E, 0x7A, 0xDA, 0xAD, 0xA7, 0x0F,
+    0xD7, 0x1A, 0xFA, 0x72, 0xF7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xEA,
+    0x72, 0x9E, 0xA7, 0x2A, 0xEA, 0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x99, 0x75, 0xDA, 0x74, 0xE7,
+    0x39, 0xE6, 0xAC, 0x95, 0xD3, 0xD5, 0xD3, 0xAC, 0xA3, 0x9C, 0xA4, 0xD3, 0xD9, 0x4A, 0xCA, 0x2D,
+    0x94, 0x9D, 0x90, 0x9D, 0x6E, 0x0A, 0xD6, 0x9D, 0x9D, 0xA7, 0xFC, 0x97, 0x9F, 0x71, 0xF7, 0x1A,
+    0xDA, 0x71, 0xAD, 0x97, 0x1E, 0x70, 0x9E, 0xA2, 0x99, 0x1F, 0xD3, 0xD9, 0x0F, 0xA3, 0x9D, 0xA0,
+    0xAA, 0xA5, 0xAE, 0x5A, 0xDA, 0x76, 0xC9, 0x74, 0xC9, 0x75, 0x97, 0x77, 0x77, 0x77, 0x77, 0xDA,
+    0x7A, 0xD1, 0x9D, 0x96, 0xD9, 0x2E, 0x5A, 0xD3, 0x9D, 0x93, 0x9D, 0x94, 0xE3, 0xE5, 0x9D, 0xA1,
+    0x9D, 0xA6, 0xE1, 0xE7, 0xAD, 0xAA, 0xDA, 0x70, 0xFD, 0x71, 0xAF, 0xA7, 0x2F, 0x73, 0xAD, 0xA7,
+    0x3A, 0xDA, 0x73, 0xEA, 0x73, 0xEA, 0x72, 0x9E, 0xA7, 0x29, 0xEA, 0x72, 0xAE, 0xA5, 0x3A, 0xAC,
+    0xA7, 0x2C, 0x71, 0xC9, 0x70, 0x99, 0x77, 0x77, 0x77, 0x77, 0x0A, 0xC9, 0x5D, 0x1D, 0x5D, 0x1A,
+    0xCA, 0x39, 0xCA, 0x2D, 0x3D, 0x92, 0xAC, 0xA2, 0xD9, 0x29, 0xD9, 0x09, 0xD4, 0xE0, 0xAD, 0x49,
+    0xD9, 0xDA, 0x5F, 0xC9, 0x59, 0xF7, 0xF7, 0xAD, 0xA7, 0xAD, 0x97, 0xE6, 0x9E, 0xA4, 0xFD, 0x5F,
+    0xA6, 0xAA, 0xA7, 0x4A, 0xC9, 0x19, 0xA7, 0x9C, 0x0C, 0x90, 0xAA, 0x79, 0xA1, 0xC9, 0xC9, 0x7A,
+    0x91, 0x9D, 0x77, 0x77, 0x77, 0x5D, 0xA7, 0xAD, 0x19, 0xD9, 0x6D, 0x92, 0xE5, 0xAD, 0x39, 0xD9,
+    0x39, 0xD9, 0x4E, 0x3E, 0x59, 0xDA, 0x19, 0xDA, 0x6E, 0x1E, 0x7A, 0xDA, 0xAD, 0xA7, 0x0F, 0xD7,
+    0x1A, 0xFA, 0x72, 0xF7, 0x3A, 0xDA, 0x73, 0xAD, 0xA7, 0x3E, 0xA7, 0x3E, 0xA7, 0x29, 0xEA, 0x72,
+    0x9E, 0xA7, 0x2A, 0xEA, 0x50, 0x76, 0xDA, 0x1A, 0x93, 0x9C, 0x0C, 0xA0, 0xA9, 0x3A, 0xA1, 0xE5,
+    0x97, 0x77, 0x77, 0x77, 0xAC, 0x95, 0xD1, 0xD5, 0xD1, 0xAC, 0xA3, 0x9C, 0xA2, 0xD3, 0xD9, 0x2A,
+    0xCA, 0x2D, 0x92, 0x9D, 0x90, 0x9D, 0x4E, 0x0A, 0xD4, 0x9D, 0x9D, 0xA5, 0xFC, 0x95, 0x9F, 0x7F,
+    0x7A, 0xDA, 0x7A, 0xD9, 0x7E, 0x69, 0xEA, 0x4F, 0xD5, 0xFA, 0x6A, 0xAA, 0x70, 0x71, 0x9F, 0xFC,
+    0x9F, 0xFC, 0x71, 0x9F, 0xFC, 0x9F, 0xFC, 0x76, 0x9F, 0xFF, 0xCA, 0x9F, 0xFF, 0xCA, 0x76, 0xFF,
+    0xFC, 0x9F, 0xFF, 0xA0, 0x77, 0x5F, 0xFF, 0xFE, 0xA9, 0xFF, 0xFF, 0xEA, 0x77, 0x5F, 0xFF, 0xFE,
+    0xA9, 0xFF, 0xFF, 0xEA, 0x0A, 0x93, 0xA9, 0x0C, 0xA3, 0xCA, 0x0C, 0xA3, 0xCA, 0x0C, 0xA3, 0xCA,
+    0x0C, 0xA3, 0xCA, 0x0C, 0x93, 0xCA, 0x0C, 0x93, 0xC9, 0x0C, 0x93, 0xC9, 0x0C, 0x93, 0xC9, 0x0C,
+    0x93, 0xC9, 0x0C, 0x93, 0xC9, 0x0C, 0x93, 0xC9, 0x0C, 0x93, 0xC9, 0x0C, 0x4C, 0x90, 0xC4, 0xC0,
+    0x9C, 0x39, 0xC0, 0x9C, 0x39, 0xC0, 0x9C, 0x39, 0xC0, 0x77, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9,
+    0x77, 0x77, 0x9F, 0xFF, 0xD9, 0x9F, 0xFF, 0xD9, 0x77, 0xEA, 0x0A, 0xDA, 0x09, 0xE1, 0xE1, 0xE9,
+    0x09, 0xDA, 0x0A, 0xDA, 0x0E, 0x90, 0xE1, 0xE0, 0x9D, 0xA0, 0xE9, 0x00, 0x0A, 0xDA, 0x0E, 0x90,
+    0xE1, 0xE0, 0x9D, 0xA0, 0xE9, 0x00, 0xEA, 0x0A, 0xDA, 0x09, 0xE1, 0xE1, 0xE9, 0x09, 0xDA, 0xEA,
+    0x0E, 0x90, 0xAD, 0xA0, 0xAD, 0xA0, 0x9E, 0x09, 0xE1, 0xE1, 0xE1, 0xE9, 0x0E, 0x19, 0xDA, 0x0A,
+    0xDA, 0x0A, 0xDA, 0x0E, 0xA0, 0xE9, 0x0E, 0x90, 0xE1, 0xE1, 0xE1, 0xE0, 0x9D, 0xA0, 0xAD, 0xA0,
+    0xE9, 0x0E, 0x90, 0x0A, 0xDA, 0x0E, 0x90, 0xE1, 0xE0, 0x9D, 0xA0, 0xE9, 0x00, 0xAD, 0xA0, 0xAE,
+    0x09, 0xE0, 0x9E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1A, 0xD9, 0x0A, 0xD9, 0x09, 0xDA, 0x09, 0xDA, 0x77,
+    0x9C, 0x97, 0x09, 0xC9, 0x70, 0x9C, 0x97, 0x09, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71, 0xC9, 0x71,
+    0xCA, 0x59, 0xAA, 0xAD, 0xAA, 0xAA, 0x1F, 0xFD, 0x5C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7,
+    0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7, 0x1C, 0xA7,
+    0x1C, 0xA7, 0x1C, 0xA7, 0x19, 0xC7, 0x2A, 0x77, 0x00, 0x76, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70,
+    0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x70, 0xCA, 0x5A, 0xAA, 0xDA, 0xAA, 0xA0, 0xAF, 0xFC,
+    0x93, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xDA, 0xCA, 0x2F, 0xF1, 0x9A, 0xAA,
+    0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0xD7, 0x0D, 0x70, 0x9C, 0x71, 0xA7, 0x70, 0x2F, 0xEA, 0x39,
+    0xFF, 0x3A, 0xFF, 0x3A, 0xFF, 0x3F, 0xFC, 0x92, 0xFF, 0xC9, 0x19, 0xFF, 0xCA, 0x1A, 0xFF, 0xCA,
+    0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x09, 0xFF, 0xE0, 0x59, 0xC9, 0x29, 0xE9, 0x09, 0xF9, 0x9E,
+    0x91, 0xC9, 0x70, 0x09, 0x90, 0x9D, 0x0A, 0xD0, 0xE9, 0x09, 0x90, 0x9D, 0x0A, 0xD0, 0xE9, 0x09,
+    0x94, 0x99, 0x49, 0x90, 0x9D, 0x4D, 0x93, 0xD9, 0xAD, 0x39, 0xDA, 0x29, 0xD9, 0xE9, 0x2A, 0xDA,
+    0x2A, 0xDA, 0x29, 0xD9, 0xD0, 0x71, 0x9C, 0x19, 0x99, 0x5C, 0x91, 0x90, 0xA4, 0x9C, 0x19, 0x9A,
+    0x94, 0xC9, 0x19, 0x99, 0xA9, 0x2A, 0xC3, 0xC9, 0xC2, 0x9C, 0x93, 0xAC, 0xA2, 0xCA, 0x71, 0x9C,
+    0x72, 0xCA, 0x71, 0xAC, 0x71, 0x9C, 0xA7, 0x1D, 0x71, 0x9C, 0x90, 0x99, 0x09, 0x93, 0xD0, 0xA0,
+    0xA0, 0x90, 0xA1, 0xAC, 0x90, 0xA9, 0xA9, 0x99, 0xA1, 0xD1, 0xA0, 0xC0, 0xA9, 0xA0, 0xD9, 0x19,
+    0xCA, 0x0A, 0xC1, 0x99, 0x71, 0x0A, 0xDA, 0x0E, 0x90, 0xE1, 0xE0, 0x9D, 0xA0, 0xE9, 0x00, 0x0A,
+    0xDA, 0x0E, 0xA0, 0xE9, 0x0E, 0x90, 0xE1, 0xE1, 0xE1, 0xE0, 0x9D, 0xA0, 0xAD, 0xA0, 0xE9, 0x0E,
+    0x90, 0x77, 0x19, 0xA3, 0xCA, 0x2A, 0xA2, 0xD9, 0x19, 0xD1, 0x9D, 0x19, 0xCA, 0x2D, 0x2D, 0x91,
+    0xD2, 0xAC, 0x91, 0x9C, 0xA1, 0xAC, 0x3C, 0x92, 0xCA, 0x77, 0x20, 0x0A, 0x91, 0x9D, 0x2A, 0xCA,
+    0x2D, 0x3C, 0xA4, 0x0A, 0xA1, 0x9C, 0x3D, 0x1D, 0xA2, 0x9D, 0x1D, 0x3A, 0xC9, 0x09, 0xCA, 0x3A,
+    0xC1, 0x9C, 0x72, 0x77, 0x0A, 0x92, 0xAA, 0x29, 0xC2, 0x9D, 0x19, 0xD2, 0xDA, 0x2A, 0xC9, 0x19,
+    0xCA, 0x2D, 0x3D, 0x2A, 0xC2, 0x9C, 0xA3, 0xCA, 0x2A, 0xA2, 0x9C, 0x77, 0x00, 0x39, 0x95, 0x9D,
+    0x49, 0xC9, 0xD2, 0xAC, 0xA1, 0xD9, 0x49, 0x49, 0xC3, 0xAC, 0xA2, 0xD9, 0x2D, 0x93, 0xD9, 0x39,
+    0xDA, 0x39, 0xDA, 0x39, 0xCA, 0x49, 0x90, 0x69, 0xC5, 0xD9, 0x4A, 0xCA, 0x4A, 0xCA, 0x3E, 0x2E,
+    0x2E, 0x3D, 0x4A, 0x40, 0x71, 0x99, 0x73, 0x9A, 0xA4, 0xDA, 0x3A, 0xAA, 0x4E, 0x3E, 0x2A, 0xD9,
+    0x5E, 0x19, 0xE1, 0xAD, 0xA6, 0x9E, 0x5A, 0xE7, 0x0A, 0xE3, 0x9E, 0x72, 0xEA, 0x19, 0xE7, 0x4E,
+    0xA9, 0xE9, 0x6A, 0xD2, 0x9F, 0xDA, 0x29, 0x92, 0xE3, 0x9F, 0xA3, 0xD9, 0x1E, 0x4F, 0x92, 0x9D,
+    0xA1, 0x99, 0x93, 0xFD, 0x91, 0x9E, 0x7F, 0xF7, 0x4F, 0xA9, 0xF7, 0x2F, 0xA1, 0xAF, 0x70, 0xAF,
+    0x3A, 0xF6, 0xAF, 0x5F, 0xA4, 0xAF, 0x91, 0x99, 0x2F, 0xA2, 0xAF, 0xA1, 0xAD, 0x29, 0xFA, 0x71,
+    0xE7, 0x72, 0xE9, 0x70, 0x39, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x29, 0xD2, 0x9D, 0x29, 0xD2,
+    0xAD, 0x2A, 0xD2, 0xAD, 0x2A, 0xD2, 0xE4, 0x97, 0x9D, 0xA1, 0xAE, 0x1F, 0x1F, 0x00, 0x4A, 0x97,
+    0x9C, 0xA5, 0x9A, 0xE9, 0x3F, 0xF1, 0xAC, 0xA0, 0x9F, 0xA1, 0x91, 0x9C, 0xA9, 0xD4, 0xAC, 0xA0,
+    0xDA, 0x3A, 0xCA, 0x0A, 0xCA, 0x3A, 0xCA, 0x0D, 0xA3, 0xAC, 0xA0, 0xD9, 0x3D, 0xA9, 0xD4, 0xDA,
+    0xD9, 0x4F, 0xC5, 0xF5, 0xAE, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x6A, 0xDA, 0x69, 0x97, 0x19,
+    0x97, 0xE7, 0xE9, 0x6E, 0x95, 0x9E, 0xA5, 0x9E, 0xA3, 0x9F, 0xFC, 0x9F, 0xFC, 0x71, 0x9C, 0x4A,
+    0xA0, 0xCA, 0x29, 0xC9, 0x09, 0xFD, 0x3A, 0xCA, 0x91, 0x77, 0x3C, 0x71, 0x9A, 0x0C, 0x0A, 0x97,
+    0x9A, 0xCA, 0x71, 0x9E, 0xA7, 0x0C, 0x0C, 0x09, 0x97, 0x1C, 0x29, 0x5A, 0x94, 0xC3, 0xA0, 0xA9,
+    0x0A, 0x9C, 0x9C, 0x0C, 0x90, 0x9E, 0xA2, 0xAC, 0xA3, 0x9D, 0x91, 0x9D, 0xAC, 0x90, 0xCA, 0xA9,
+    0xAC, 0x0A, 0x0C, 0x09, 0x92, 0x9A, 0x4A, 0x77, 0x00, 0x72, 0xA7, 0x2C, 0xA7, 0x19, 0xC7, 0x2C,
+    0x97, 0x1A, 0xC7, 0x2C, 0x97, 0x1D, 0x71, 0x9C, 0x72, 0xCA, 0x71, 0xAC, 0x71, 0x9C, 0xA7, 0x1D,
+    0x71, 0xAC, 0x97, 0x1D, 0x71, 0xAC, 0x71, 0x9C, 0xA7, 0x1D, 0x71, 0x77, 0x70, 0x9A, 0xDA, 0x95,
+    0x9A, 0xCA, 0x94, 0xFF, 0x29, 0xFE, 0x91, 0xAC, 0xA2, 0xAD, 0xA1, 0xD9, 0x19, 0xE9, 0x19, 0x49,
+    0xD9, 0x09, 0x5E, 0x70, 0xDA, 0x70, 0xD7, 0x0A, 0xCA, 0x70, 0xD7, 0x0D, 0xA7, 0x0D, 0x70, 0xD9,
+    0x79, 0xD7, 0x9D, 0x70, 0xD9, 0x69, 0xD9, 0x7A, 0xD6, 0x9D, 0xA7, 0xE9, 0x49, 0xEA, 0x6A, 0xE9,
+    0x5A, 0xDA, 0x7E, 0x96, 0xAD, 0x70, 0xE7, 0xAD, 0x70, 0xE7, 0xAD, 0x70, 0xE7, 0xAC, 0xA7, 0x0D,
+    0xA7, 0x77, 0x77, 0x75, 0x9D, 0x70, 0xAC, 0xA7, 0xAD, 0x70, 0xE7, 0xAD, 0x97, 0xE7, 0x99, 0x97,
+    0x09, 0x99, 0x40, 0x77, 0x19, 0xF9, 0x70, 0xFF, 0x6A, 0xC9, 0x29, 0xE2, 0xD1, 0x94, 0x9D, 0x91,
+    0xD7, 0x0D, 0xA1, 0xD7, 0x0A, 0xCA, 0x1D, 0x70, 0xD9, 0x1D, 0x70, 0xD2, 0xD7, 0xAC, 0xA1, 0x9D,
+    0x6A, 0xD2, 0x9D, 0x5A, 0xD9, 0x29, 0xD3, 0xAE, 0x93, 0xAD, 0x3A, 0xD9, 0x4A, 0xD3, 0xAD, 0x5A,
+    0xD3, 0xAD, 0x5A, 0xD3, 0xAD, 0x5E, 0x39, 0xA9, 0x79, 0x77, 0x49, 0x94, 0x9D, 0xA3, 0x9D, 0x4A,
+    0xE3, 0xAD, 0x93, 0xF3, 0xE9, 0x3F, 0x00, 0x77, 0x79, 0xAE, 0xA7, 0x1F, 0xF9, 0x69, 0xCA, 0x29,
+    0xE4, 0xAC, 0x09, 0x5D, 0xA3, 0xD7, 0xAD, 0x3D, 0x79, 0xD3, 0xD7, 0xAC, 0xA3, 0xD7, 0xD9, 0x3D,
+    0x69, 0xD3, 0x9D, 0x59, 0xD9, 0x39, 0xD4, 0xAD, 0xA4, 0x9D, 0x29, 0xEA, 0x59, 0xD2, 0x9D, 0xA6,
+    0xAD, 0x29, 0xD9, 0x6A, 0xD2, 0x9D, 0x96, 0xAD, 0x29, 0xD9, 0x6E, 0x29, 0xA9, 0x70, 0x9A, 0x77,
+    0x49, 0x96, 0x9D, 0xA3, 0xD9, 0x5A, 0xDA, 0x29, 0xDA, 0x5F, 0x2A, 0xDA, 0x5F, 0x77, 0x74, 0x77,
+    0x49, 0xC7, 0x1D, 0x71, 0xCA, 0x70, 0x9C, 0x97, 0x0A, 0xC7, 0x1C, 0xA7, 0x09, 0xC9, 0x3A, 0xCA,
+    0x1A, 0xC4, 0xE1, 0xD4, 0xE1, 0xCA, 0x49, 0x99, 0x0A, 0xC9, 0x70, 0xD7, 0x1D, 0x70, 0x9C, 0xA7,
+    0x0A, 0xC7, 0x1D, 0x70, 0x9C, 0xA7, 0x0A, 0xC9, 0x70, 0xD1, 0x99, 0x5D, 0x09, 0xD4, 0xAC, 0xA0,
+    0xAD, 0x4D, 0x90, 0xE9, 0x3D, 0x70, 0x9D, 0x70, 0xAC, 0x97, 0x0D, 0x70, 0x9D, 0x70, 0xAC, 0xA7,
+    0x0D, 0x97, 0x0D, 0x70, 0x9C, 0x71, 0x97, 0x20, 0x1A, 0x9A, 0x1C, 0x19, 0x90, 0xC0, 0xA0, 0xA0,
+    0xC0, 0xA0, 0xC0, 0xC1, 0x9A, 0x0C, 0x90, 0xCA, 0x0A, 0xE2, 0xAA, 0x90, 0x70, 0x9A, 0x3C, 0xA2,
+    0xC9, 0xA1, 0xA9, 0x0C, 0x1F, 0xA0, 0x99, 0xAC, 0x92, 0x9C, 0x39, 0xC0, 0x6C, 0xAA, 0xA1, 0xC4,
+    0xC4, 0xEA, 0x4A, 0xA0, 0x91, 0xAA, 0x0F, 0x90, 0x9A, 0xA1, 0x1A, 0xD9, 0x0A, 0x93, 0xCA, 0xAA,
+    0x1C, 0xA0, 0xAA, 0x0C, 0x2C, 0x0C, 0x90, 0xAC, 0x09, 0xE9, 0x29, 0x10, 0x7A, 0xF4, 0x9C, 0x4A,
+    0xA4, 0xCA, 0x4C, 0x93, 0x9C, 0x4A, 0xC4, 0xD1, 0x1A, 0xAA, 0x2A, 0x19, 0xA1, 0xA9, 0x0A, 0xA2,
+    0xE2, 0xA9, 0x0A, 0xA1, 0xC2, 0xC1, 0xC9, 0x0A, 0xC1, 0x9E, 0x90, 0x1C, 0xAA, 0x2C, 0x1A, 0xA1,
+    0xC2, 0xC1, 0xC9, 0x09, 0xC1, 0x9F, 0x5C, 0x19, 0x99, 0xAA, 0x1A, 0xE1, 0x0A, 0x90, 0x9A, 0xA9,
+    0x3F, 0xF2, 0xE9, 0x1A, 0xCA, 0x1D, 0x93, 0xD0, 0x9D, 0x4D, 0x09, 0xD4, 0xD9, 0x9D, 0x4D, 0x9A,
+    0xD4, 0xD9, 0xAD, 0x4D, 0xAA, 0xD4, 0xDA, 0xAD, 0x4D, 0xAE, 0x4D, 0xA0, 0x19, 0x99, 0x3A, 0x91,
+    0xC1, 0x9C, 0x29, 0xA0, 0xAA, 0x0A, 0x1C, 0x0C, 0xA0, 0xC9, 0x0C, 0x0C, 0xA0, 0xA1, 0xC0, 0xD2,
+    0x9C, 0x0A, 0xC2, 0xD0, 0x9D, 0xAE, 0x1F, 0xC9, 0x2A, 0xD9, 0x10, 0x6A, 0xCA, 0x39, 0xA3, 0x9A,
+    0x3A, 0xA3, 0xAA, 0x3A, 0xA2, 0xF9, 0x0A, 0xAA, 0xA0, 0x0A, 0xDA, 0x1A, 0x1C, 0xA3, 0x9C, 0x3A,
+    0xA2, 0x9C, 0x91, 0x9C, 0xA1, 0xAC, 0xA2, 0xFC, 0x09, 0x99, 0x99, 0x09, 0xAA, 0x94, 0xA9, 0x4A,
+    0x3A, 0x91, 0xE9, 0x3A, 0xA3, 0xAC, 0x0F, 0x90, 0x99, 0x91, 0x71, 0xAA, 0x39, 0xD3, 0xC9, 0xC2,
+    0xAA, 0x0C, 0x2F, 0xC3, 0x9C, 0x49, 0xC1, 0x6C, 0xAA, 0xA1, 0xC4, 0xDA, 0x94, 0xC4, 0xC9, 0x0C,
+    0xAA, 0xC9, 0x0E, 0x90, 0x1A, 0xD9, 0x1A, 0x94, 0xCA, 0xCA, 0x2C, 0xA0, 0xAA, 0x1C, 0x2C, 0x1C,
+    0x90, 0x9C, 0x19, 0xE9, 0x39, 0x20, 0x0E, 0xAA, 0x39, 0xA3, 0xAA, 0x3C, 0x93, 0xC9, 0x29, 0xC3,
+    0xAC, 0x3D, 0x60, 0x19, 0x99, 0x29, 0xA0, 0xAA, 0x1A, 0x2C, 0x1A, 0xA0, 0xAA, 0x2E, 0x2C, 0x90,
+    0x9C, 0x1C, 0x90, 0x9C, 0x19, 0xE9, 0x70, 0x19, 0xA9, 0x2A, 0x90, 0xA9, 0x1C, 0x19, 0xC1, 0xC2,
+    0xC1, 0xC9, 0x09, 0xC1, 0x9F, 0x49, 0xC1, 0xAE, 0x92, 0x99, 0x20, 0x3A, 0xA3, 0x9C, 0x93, 0xD3,
+    0x9C, 0x93, 0xD4, 0xCA, 0x3A, 0xC9, 0x3D, 0x4C, 0xA3, 0x9C, 0x93, 0xAC, 0x93, 0xD4, 0xD4, 0xD4,
+    0xD4, 0xD4, 0xAC, 0x93, 0xAC, 0x93, 0x9C, 0xA4, 0xD4, 0xD4, 0xD9, 0x39, 0xCA, 0x4D, 0x4D, 0x93,
+    0x9D, 0x4D, 0x93, 0xAD, 0x00, 0x0A, 0xA4, 0x9C, 0x94, 0xD4, 0x9C, 0x94, 0xD4, 0xAC, 0x94, 0xCA,
+    0x4D, 0x4A, 0xC9, 0x39, 0xCA, 0x39, 0xCA, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x39, 0xCA, 0x3A,
+    0xCA, 0x3A, 0xC9, 0x3D, 0x39, 0xD3, 0xAC, 0xA3, 0xD9, 0x29, 0xD3, 0xDA, 0x29, 0xD3, 0xDA, 0x20,
+    0x77, 0x6D, 0x1D, 0x79, 0xCA, 0x1C, 0xA7, 0xAC, 0x19, 0xC9, 0x7D, 0x1A, 0xC7, 0x0F, 0xDA, 0x59,
+    0xFF, 0x4F, 0xA9, 0xAC, 0xA9, 0x3A, 0xF1, 0xAC, 0x49, 0xFA, 0x1D, 0x4E, 0x9C, 0x90, 0x9C, 0xA3,
+    0x9D, 0x9A, 0xC1, 0xAC, 0x93, 0xAD, 0x0D, 0x1D, 0x4E, 0x0C, 0xA1, 0xD4, 0xE9, 0xC9, 0x09, 0xCA,
+    0x4F, 0xC1, 0xAC, 0x5F, 0xC1, 0xD5, 0xFC, 0x1C, 0xA5, 0xAF, 0xFA, 0xAD, 0x2F, 0xFF, 0x2A, 0xFF,
+    0xE2, 0x9F, 0xFE, 0x2A, 0xCA, 0xAF, 0xDA, 0x92, 0xD1, 0xAC, 0x70, 0xCA, 0x1D, 0x79, 0xC9, 0x1C,
+    0xA7, 0xAC, 0x19, 0xC9, 0x77, 0x50, 0x77, 0x49, 0xAF, 0xA4, 0xAF, 0xF3, 0xFA, 0x99, 0x9A, 0x92,
+    0xEA, 0x70, 0x9D, 0xA7, 0x1E, 0x71, 0x9D, 0x97, 0x1A, 0xD7, 0x2E, 0x4A, 0x99, 0xA9, 0x0E, 0x4F,
+    0xA0, 0xE4, 0xD9, 0x2E, 0xA3, 0xCA, 0x3F, 0xA2, 0xCA, 0x3A, 0xFD, 0xAF, 0xC1, 0xFF, 0xF1, 0xAF,
+    0xFE, 0x2A, 0xFF, 0xD3, 0x9A, 0xFD, 0xA9, 0x75, 0x77, 0x77, 0x0A, 0xEA, 0x6A, 0xFE, 0x93, 0xAD,
+    0x93, 0xAC, 0x3A, 0xC9, 0x72, 0xAC, 0x73, 0x9C, 0xA7, 0x19, 0xFF, 0xC3, 0x9F, 0xFC, 0x59, 0xCA,
+    0x73, 0xD7, 0x1F, 0xFC, 0x4F, 0xFC, 0x69, 0xD7, 0x2A, 0xD7, 0x1A, 0xD9, 0x7F, 0x97, 0x0F, 0xFD,
+    0xA9, 0x1F, 0xFF, 0x00, 0x39, 0x97, 0xD9, 0x5E, 0xA5, 0x9D, 0x95, 0xF5, 0x9D, 0x95, 0xFA, 0x49,
+    0xD9, 0x5F, 0xC4, 0xAD, 0x6F, 0xC9, 0x3A, 0xD6, 0xDA, 0xE3, 0xAD, 0x59, 0xDA, 0x9D, 0x92, 0xE5,
+    0x9D, 0xA0, 0xE2, 0xE3, 0xAF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFE, 0x2A, 0xDA, 0x1A, 0xD9, 0x0E, 0x5A,
+    0xDA, 0x2D, 0xA0, 0xE5, 0xAD, 0xA2, 0xAD, 0x9E, 0x5E, 0xA3, 0xFC, 0xA5, 0xEA, 0x3A, 0xFA, 0x5F,
+    0x39, 0xFA, 0x5F, 0x4F, 0xA3, 0x29, 0xFD, 0xA9, 0x69, 0xFF, 0xC5, 0x9D, 0x39, 0xE4, 0x9D, 0x5D,
+    0x1A, 0xFF, 0xFD, 0xA9, 0x99, 0xE9, 0x99, 0x99, 0xAD, 0xA9, 0x2A, 0xD3, 0x9A, 0xD4, 0xAF, 0xFC,
+    0xA4, 0xAF, 0xFA, 0x5E, 0xAA, 0xA9, 0x97, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x74, 0xE7, 0x4E, 0x97,
+    0x3E, 0x97, 0x3E, 0x97, 0x00, 0x0F, 0xA9, 0x76, 0xFD, 0xA7, 0x5C, 0x3D, 0x75, 0xC3, 0x9C, 0x97,
+    0x4C, 0x4C, 0xA7, 0x39, 0xC4, 0xCA, 0x73, 0x9C, 0x29, 0xD9, 0x5A, 0xDA, 0x19, 0xFE, 0x5D, 0xAA,
+    0xA1, 0x9F, 0xD9, 0x49, 0xC5, 0x9F, 0xD9, 0x49, 0xC5, 0xAD, 0xA9, 0x9D, 0x5D, 0x93, 0xAD, 0x2A,
+    0xCA, 0x4A, 0xE9, 0x1A, 0xD2, 0x9D, 0x59, 0xE9, 0x0A, 0xD2, 0x9D, 0x79, 0xD0, 0xAD, 0x29, 0xD4,
+    0x92, 0xD0, 0xE2, 0x9D, 0x92, 0x9F, 0xD0, 0xE2, 0x9D, 0xA2, 0xFE, 0x0E, 0x29, 0xE2, 0x9F, 0xA1,
+    0x0A, 0xC7, 0x1C, 0x91, 0x9C, 0x70, 0x9C, 0x91, 0x9C, 0x97, 0xAC, 0x3C, 0xA7, 0xAC, 0x3C, 0xA7,
+    0xD3, 0xD2, 0xCA, 0x2C, 0xA1, 0xFF, 0xFE, 0x9F, 0xFF, 0xE9, 0x1A, 0xC1, 0xEA, 0x0A, 0xC9, 0x39,
+    0xC9, 0x0F, 0x0A, 0xC4, 0x9C, 0xA9, 0xCA, 0xD0, 0xD5, 0xCA, 0xD9, 0xAC, 0x9D, 0x5F, 0x09, 0xEA,
+    0x5F, 0x1E, 0xA5, 0xAD, 0xA1, 0xE9, 0x5A, 0xD9, 0x1A, 0xD6, 0x9D, 0x29, 0xD6, 0x9D, 0x29, 0xD3,
+    0xAA, 0x99, 0x97, 0x2F, 0xF9, 0x49, 0x9F, 0xAA, 0xEA, 0x3F, 0xA4, 0xD9, 0x2F, 0x95, 0xD2, 0xF9,
+    0x5D, 0x2F, 0x91, 0xA9, 0x1A, 0xC2, 0xF2, 0xD1, 0xAC, 0x2F, 0x2D, 0x1A, 0xC2, 0xF2, 0xD1, 0xAC,
+    0x2F, 0x2D, 0x6F, 0x2A, 0xC6, 0xF2, 0x9D, 0x49, 0xF3, 0xAD, 0xA9, 0x99, 0xE9, 0xA4, 0xAF, 0xF7,
+    0x09, 0x9A, 0xAE, 0x70, 0x9A, 0x73, 0xAC, 0x70, 0x9A, 0xAD, 0xAA, 0x95, 0xAF, 0xDA, 0x70, 0xD6,
+    0x9E, 0x0C, 0xA5, 0x9F, 0xDA, 0x5C, 0xA1, 0x9D, 0xA4, 0xAC, 0x3A, 0xCA, 0x4C, 0xA3, 0xAC, 0xA4,
+    0xD3, 0xAC, 0xA4, 0xD9, 0x19, 0xDA, 0x49, 0xFE, 0xA5, 0xAF, 0xDA, 0x69, 0xAA, 0x90, 0x99, 0x29,
+    0xFF, 0xD2, 0x9F, 0xFD, 0x20, 0x77, 0x2A, 0xFD, 0x4F, 0xF3, 0x9E, 0x39, 0x3A, 0xD7, 0x1D, 0x96,
+    0x9F, 0xF3, 0x99, 0x9D, 0xAA, 0xAA, 0x6D, 0x79, 0x9A, 0xFC, 0xA3, 0xFC, 0xAA, 0xA9, 0x6D, 0x97,
+    0x1D, 0xA7, 0x1A, 0xD7, 0x19, 0xE9, 0x70, 0xFF, 0x49, 0xFE, 0x6A, 0xFC, 0x74, 0x09, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x91, 0xFF, 0xFD, 0x90, 0xFF, 0xFD, 0x90, 0x94, 0xD9, 0x74, 0xD9, 0x74,
+    0xD9, 0x0A, 0x72, 0xFC, 0x97, 0x9A, 0xEA, 0x97, 0xFC, 0xA7, 0x1C, 0xA9, 0xDA, 0x9C, 0x97, 0x09,
+    0xFC, 0x97, 0x9F, 0x97, 0x0F, 0xCA, 0x71, 0xA9, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0xAE, 0x73, 0xAE,
+    0x73, 0xAE, 0x50, 0x39, 0xFD, 0xA9, 0x70, 0x9F, 0xFC, 0x79, 0xD3, 0x9A, 0xD2, 0x9F, 0xFF, 0xFC,
+    0x3A, 0xD5, 0xD9, 0x19, 0xAA, 0xAE, 0xAA, 0xAA, 0xAA, 0xEA, 0xA3, 0xAD, 0x39, 0xE6, 0xAF, 0xFC,
+    0xA6, 0xAF, 0xFA, 0x7E, 0xAA, 0xA9, 0x97, 0x1E, 0x76, 0xE7, 0x6E, 0x76, 0xE7, 0x6E, 0x76, 0xE9,
+    0x75, 0xE9, 0x75, 0xE9, 0x71, 0x70, 0x97, 0x7C, 0x97, 0x6C, 0x97, 0x6C, 0x97, 0x29, 0xAA, 0xFC,
+    0xA5, 0x9F, 0xFD, 0x93, 0xAE, 0xA9, 0x9C, 0x29, 0x4E, 0x91, 0x9C, 0x7A, 0xDA, 0x29, 0xC7, 0xE9,
+    0x29, 0xC7, 0xE3, 0x9C, 0x7E, 0x39, 0xC7, 0xE3, 0x9C, 0x7E, 0x39, 0xFA, 0xA9, 0x1E, 0x39, 0xCA,
+    0xFC, 0xA0, 0xE3, 0x9C, 0x2A, 0xDA, 0x0A, 0xDA, 0x29, 0xC2, 0xAC, 0x91, 0x9E, 0xA1, 0x9C, 0x2D,
+    0x92, 0xFF, 0xFC, 0xA2, 0xAF, 0xFF, 0xA3, 0xAF, 0xFE, 0x95, 0xAF, 0xDA, 0x97, 0x2A, 0xC7, 0x6A,
+    0xC7, 0x69, 0x96, 0x3A, 0xFC, 0xA9, 0x72, 0xFF, 0xC7, 0x1C, 0xAA, 0xAA, 0xFC, 0x77, 0xAD, 0x97,
+    0x7D, 0xA7, 0x7D, 0xA3, 0x9F, 0xFF, 0xFC, 0xA9, 0xFF, 0xFF, 0xCA, 0x77, 0x77, 0x59, 0xFF, 0xFF,
+    0xCA, 0x9F, 0xFF, 0xFC, 0xA0, 0xFA, 0x75, 0xFC, 0x94, 0x9A, 0x5F, 0xFF, 0xCA, 0x5F, 0xFF, 0xC9,
+    0x5F, 0xFF, 0xC6, 0x9A, 0xFF, 0xA7, 0x76, 0x39, 0x70, 0xCA, 0x7C, 0xA5, 0x9F, 0xA2, 0xAF, 0xD2,
+    0xDA, 0xAC, 0x3A, 0xD0, 0xAC, 0x3A, 0xC9, 0x0A, 0xC3, 0xD9, 0x0A, 0xC3, 0xD9, 0x0A, 0xC3, 0xAC,
+    0xA0, 0x9C, 0x3A, 0xD9, 0x9C, 0x4F, 0xCA, 0xA2, 0x9F, 0xDA, 0x29, 0xAF, 0xA5, 0xA3, 0x77, 0x0F,
+    0xFF, 0xD9, 0x77, 0x77, 0x0F, 0xFF, 0xD9, 0x0F, 0xFF, 0xD9, 0x6D, 0x97, 0x4D, 0x97, 0x4D, 0x97,
+    0x4D, 0x97, 0x4D, 0xA7, 0x4D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7, 0x39, 0xDA, 0x73, 0x9D, 0xA7,
+    0x3A, 0xDA, 0x73, 0xAE, 0x73, 0xAE, 0x50, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x3A, 0xC7,
+    0x0C, 0xA3, 0x99, 0x99, 0xD9, 0x99, 0x0F, 0xFC, 0x39, 0xCA, 0x39, 0x9A, 0xD9, 0x29, 0xF9, 0x39,
+    0xFA, 0x69, 0xD9, 0x69, 0xD7, 0xD9, 0x59, 0xDA, 0x59, 0xE5, 0x9E, 0x73, 0x2A, 0xA7, 0x1D, 0x71,
+    0xD1, 0x9A, 0x5D, 0xAE, 0x4A, 0xF9, 0x39, 0xF6, 0x9A, 0x9D, 0x09, 0xAC, 0x5F, 0xCA, 0x39, 0xAE,
+    0xA4, 0x9F, 0x4C, 0x99, 0xA0, 0xD3, 0xD3, 0xD1, 0x9D, 0x93, 0xFC, 0xA5, 0xE9, 0x77, 0x00, 0x49,
+    0xA7, 0x2A, 0xC7, 0x2A, 0xC7, 0x1A, 0xEA, 0x6F, 0xE4, 0xAF, 0x9D, 0xA3, 0xD9, 0x9C, 0x1D, 0x3D,
+    0x09, 0xC1, 0xD2, 0x9C, 0xA0, 0x9C, 0x1A, 0xC2, 0x9C, 0x90, 0x9C, 0x19, 0xC2, 0x9C, 0x90, 0x9C,
+    0x19, 0xC2, 0x9C, 0x90, 0x9C, 0x19, 0xC2, 0x9C, 0x90, 0x9C, 0x19, 0xC3, 0xC9, 0x1C, 0x19, 0xC3,
+    0xCA, 0x1C, 0x1A, 0xC3, 0xCA, 0x1C, 0x90, 0xAC, 0x10, 0x49, 0xFD, 0xA9, 0x79, 0xFF, 0xC6, 0x9D,
+    0x39, 0xE5, 0x9D, 0x5D, 0x5A, 0xD5, 0xD9, 0x4A, 0xD5, 0xD5, 0xAD, 0x39, 0xE1, 0x9F, 0xFF, 0xCA,
+    0x19, 0xFF, 0xFA, 0x29, 0xFD, 0xAA, 0xA9, 0x97, 0x0E, 0x75, 0xE7, 0x1F, 0xFE, 0x94, 0xFF, 0xE9,
+    0x70, 0xE7, 0x5E, 0x97, 0x4E, 0x97, 0x4E, 0x97, 0x5A, 0x73, 0xD7, 0x2D, 0x72, 0xAC, 0x97, 0x19,
+    0xCA, 0x72, 0xD7, 0x2F, 0xFF, 0x1E, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xD7, 0x4D, 0x74, 0xD7, 0x39,
+    0xCA, 0x73, 0x99, 0x60, 0x77, 0x3D, 0x72, 0xF9, 0x69, 0xFD, 0x94, 0x9D, 0x0D, 0x0A, 0xCA, 0x2A,
+    0xCA, 0x1D, 0x1A, 0xCA, 0x1C, 0xA2, 0xD2, 0x9A, 0x6D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x73,
+    0xD5, 0x6A, 0x73, 0x9C, 0xA7, 0x39, 0xCA, 0x73, 0xAC, 0x97, 0x3D, 0x74, 0xD1, 0x9F, 0xFE, 0xA1,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAD, 0xA7, 0x19, 0xCA, 0x71, 0x9D, 0x72, 0xD7, 0x2D, 0x73, 0xA5, 0x59,
+    0x97, 0x3D, 0x73, 0xD7, 0x3D, 0x73, 0xD7, 0x3D, 0x69, 0x3D, 0x6D, 0x2D, 0x2D, 0x2D, 0x90, 0xD1,
+    0xD9, 0x3D, 0x9D, 0x9D, 0x6F, 0xD7, 0x0A, 0xDA, 0x72, 0x9A, 0x50, 0x4A, 0x4A, 0x7C, 0xA4, 0xC9,
+    0x5D, 0x59, 0xC9, 0x3A, 0xC7, 0x9C, 0x2A, 0xC9, 0x99, 0x99, 0x99, 0x99, 0x9D, 0x1F, 0xFF, 0xDA,
+    0x09, 0xC9, 0x70, 0xD2, 0xAC, 0x7A, 0xC4, 0xAC, 0x5A, 0xC6, 0xAA, 0x4C, 0x97, 0x72, 0x77, 0x0D,
+    0x79, 0xF5, 0xAC, 0x9A, 0xAA, 0xC9, 0x2A, 0xC1, 0xAA, 0x09, 0xC9, 0x1A, 0x2A, 0xA1, 0x99, 0x5A,
+    0xA7, 0x1A, 0xA7, 0x1A, 0xA7, 0x1A, 0xA5, 0xA2, 0xAA, 0x5D, 0x1A, 0xA1, 0xCA, 0x2D, 0x9A, 0xA0,
+    0xCA, 0x4A, 0xFA, 0x6A, 0xD9, 0x70, 0x99, 0x40, 0x09, 0x9A, 0xAA, 0xEA, 0x1F, 0xDA, 0xA9, 0x1E,
+    0x96, 0xCA, 0xD9, 0x5C, 0x90, 0xD9, 0x4C, 0x91, 0xD9, 0x3C, 0x92, 0xD9, 0x19, 0xC9, 0x3D, 0x91,
+    0xA5, 0xD9, 0x70, 0xA0, 0x09, 0xEA, 0xAA, 0x99, 0x2A, 0xAF, 0xD7, 0xE6, 0xDA, 0xC5, 0xD9, 0x0C,
+    0x93, 0xD9, 0x1C, 0x92, 0xD9, 0x2C, 0x91, 0xD9, 0x3C, 0xA0, 0xD9, 0x4A, 0x90, 0xA9, 0x70, 0x0A,
+    0x97, 0x0D, 0x59, 0x2D, 0x4C, 0x91, 0x9D, 0x3C, 0x92, 0x9C, 0xA1, 0x9C, 0x4A, 0xCA, 0x0A, 0xC5,
+    0xAC, 0x9A, 0xC6, 0xEA, 0x19, 0xAA, 0xAA, 0xAD, 0xA1, 0xAF, 0xE9, 0x73, 0x70, 0xA1, 0x95, 0xD1,
+    0xC9, 0x3A, 0xC9, 0x1C, 0x92, 0xAC, 0xA2, 0xCA, 0x19, 0xCA, 0x3D, 0x09, 0xD4, 0xAC, 0x0D, 0x59,
+    0xE6, 0x9D, 0xAA, 0xAA, 0xA9, 0x2F, 0xF7, 0x30, 0x4A, 0x76, 0xCA, 0x74, 0xAC, 0x97, 0x39, 0xC9,
+    0x74, 0xCA, 0x74, 0xFF, 0xFC, 0x1D, 0x75, 0xAC, 0xA7, 0x59, 0xFF, 0xF3, 0xAC, 0xA7, 0x5D, 0xA7,
+    0x5C, 0xA7, 0x59, 0x71, 0x59, 0x76, 0x9C, 0x90, 0x9C, 0x72, 0xD9, 0x09, 0xD7, 0x0E, 0x90, 0x9E,
+    0x6D, 0x9C, 0x90, 0x9C, 0x0D, 0x4D, 0x90, 0xC9, 0x09, 0xC1, 0xD2, 0xD9, 0x1C, 0x90, 0x9C, 0x2D,
+    0x1C, 0x92, 0xC9, 0x09, 0xC3, 0x96, 0xC9, 0x09, 0xC7, 0x3C, 0x90, 0x9C, 0x73, 0xC9, 0x09, 0xC7,
+    0x3C, 0x90, 0x9C, 0x73, 0xC9, 0x09, 0xC7, 0x3C, 0x90, 0x9C, 0x73, 0xC9, 0x09, 0xC5, 0x70, 0x99,
+    0x75, 0xD7, 0x5A, 0xC9, 0x75, 0xAC, 0x76, 0xD2, 0x9F, 0xFF, 0xC7, 0x59, 0xD7, 0x4D, 0x90, 0x9F,
+    0xFF, 0x74, 0xD9, 0x73, 0xDA, 0x74, 0xD7, 0x74, 0x5A, 0x19, 0xA7, 0x3C, 0x90, 0x9C, 0x73, 0xC9,
+    0x09, 0xC7, 0x3C, 0x90, 0x9C, 0x73, 0xC9, 0x09, 0xC7, 0x3C, 0x90, 0x9C, 0x73, 0xC9, 0x09, 0xC6,
+    0x93, 0xC9, 0x09, 0xC6, 0xD2, 0xC9, 0x09, 0xC2, 0xAC, 0x19, 0xD1, 0xC9, 0x09, 0xC1, 0xAC, 0x92,
+    0x9D, 0x0C, 0x90, 0x9C, 0x0A, 0xC9, 0x49, 0xE9, 0x09, 0xCA, 0xC9, 0x6A, 0xD9, 0x09, 0xD9, 0x70,
+    0xAC, 0x90, 0x9C, 0x97, 0x2A, 0x90, 0x97, 0x77, 0x4A, 0x5A, 0x71, 0xCA, 0x3A, 0xC9, 0x7A, 0xC9,
+    0x4D, 0x69, 0xC9, 0x59, 0xCA, 0x5C, 0xA7, 0xAC, 0x93, 0xFF, 0xFD, 0x91, 0xD7, 0x3D, 0x1A, 0xCA,
+    0x71, 0x9C, 0xA2, 0x9F, 0xFF, 0xA4, 0xAC, 0xA5, 0xAD, 0x6D, 0xA3, 0x9D, 0x70, 0xCA, 0x39, 0xC9,
+    0x70, 0x95, 0x94, 0x5A, 0x97, 0x2A, 0xD9, 0x70, 0xAC, 0x9D, 0x96, 0xDA, 0x09, 0xDA, 0x3A, 0xE9,
+    0x09, 0xA9, 0xD9, 0x1A, 0xC9, 0xA9, 0x09, 0xA1, 0xD4, 0xA9, 0x09, 0xA7, 0x0A, 0x90, 0x9A, 0x70,
+    0xA9, 0x09, 0xA7, 0x0A, 0x90, 0x9A, 0x70, 0xA9, 0x09, 0xA5, 0xAC, 0x9A, 0x90, 0x9A, 0x09, 0xD1,
+    0x9E, 0x90, 0x9A, 0xAD, 0x93, 0xDA, 0x09, 0xDA, 0x6A, 0xCA, 0xD9, 0x70, 0xAD, 0x73, 0xA6, 0x79,
+    0x71, 0x9D, 0xA7, 0x1A, 0xC9, 0x71, 0xCA, 0x71, 0xCA, 0x71, 0xCA, 0x39, 0xA9, 0x2C, 0xA1, 0xAF,
+    0xC9, 0x0C, 0x90, 0x9D, 0x91, 0xD9, 0xC1, 0xD9, 0x3E, 0x1D, 0x4A, 0xD0, 0x9D, 0x49, 0xCA, 0x1D,
+    0x49, 0xC9, 0x1D, 0xA3, 0xD2, 0xAE, 0xAE, 0xA3, 0xFE, 0x5A, 0xEA, 0x30, 0x77, 0x72, 0x9A, 0xFA,
+    0x93, 0xD5, 0xFF, 0xD1, 0xD5, 0xEA, 0x3F, 0xD5, 0xEA, 0x5F, 0x59, 0xDA, 0x69, 0xE5, 0xAD, 0x96,
+    0xF9, 0x4E, 0x59, 0xD0, 0xDA, 0x4D, 0xA4, 0x9D, 0x1D, 0xA4, 0xD9, 0x39, 0xD2, 0xAD, 0x4D, 0x92,
+    0x9C, 0xA3, 0xAD, 0x4D, 0xA1, 0x9C, 0xA4, 0xDA, 0x4E, 0x09, 0xCA, 0x5D, 0xA4, 0xAF, 0xA5, 0xE9,
+    0x49, 0xFA, 0x99, 0x9A, 0xAF, 0x6F, 0xFF, 0xD5, 0xAF, 0xFF, 0xC5, 0xAC, 0x99, 0xFF, 0xD9, 0x49,
+    0xC9, 0x29, 0xAF, 0xA9, 0x69, 0x97, 0x72, 0x77, 0x59, 0xD9, 0x73, 0xEA, 0x72, 0x9F, 0x72, 0xDA,
+    0xAC, 0xA7, 0x09, 0xD0, 0x9D, 0x70, 0xDA, 0x1D, 0xA6, 0x9D, 0x91, 0xAD, 0x6E, 0x3D, 0xA5, 0xD9,
+    0x3A, 0xD4, 0xAD, 0x49, 0xDA, 0x3D, 0xA5, 0xE2, 0xAD, 0x69, 0xDA, 0x1E, 0x7E, 0x09, 0xFF, 0xFD,
+    0x09, 0xFF, 0xFD, 0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xEA, 0x1A, 0xCA, 0x3D,
+    0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A,
+    0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA, 0x3D, 0x3A, 0xCA,
+    0x3D, 0x3A, 0xCA, 0x3D, 0x10, 0x19, 0xA9, 0x3A, 0xA3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC,
+    0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3,
+    0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD3, 0xAC, 0xA3, 0xD2, 0x9E, 0x99, 0x9A,
+    0xD9, 0x99, 0xFF, 0xEA, 0x09, 0x99, 0x99, 0x99, 0x99, 0x9F, 0xFC, 0x0C, 0xA7, 0x0C, 0xA7, 0x0C,
+    0xA7, 0x0C, 0x97, 0x0C, 0x97, 0x0C, 0x7A, 0xC6, 0xAC, 0x6D, 0x6D, 0x6D, 0x99, 0x99, 0x99, 0x09,
+    0xFF, 0xC9, 0xFF, 0xC7, 0x10, 0x19, 0x99, 0xAA, 0xAA, 0x90, 0xFF, 0xA7, 0x10, 0x71, 0x99, 0x99,
+    0x99, 0x71, 0x9F, 0xDA, 0x70, 0xD9, 0x75, 0xD7, 0x5A, 0xCA, 0x75, 0xD9, 0x75, 0xD7, 0x5A, 0xD7,
+    0x5D, 0xA7, 0x49, 0xD9, 0x74, 0xAD, 0x75, 0xDA, 0x70, 0xA2, 0x9D, 0x97, 0x0D, 0x1E, 0x71, 0xAD,
+    0x9E, 0x72, 0xFC, 0xA7, 0x2A, 0xF9, 0x73, 0xF7, 0x10, 0x2A, 0xAC, 0xA2, 0x9A, 0xCA, 0x4F, 0xD9,
+    0x0F, 0xC2, 0xAC, 0xA2, 0xDA, 0xC9, 0x1A, 0xC1, 0xD4, 0xD9, 0x3C, 0x1C, 0x94, 0xD4, 0xC9, 0x9C,
+    0x94, 0xAC, 0x4C, 0x90, 0xC9, 0x4D, 0xA2, 0xAC, 0x1D, 0x3A, 0xFF, 0x1A, 0xFD, 0xAA, 0xFC, 0x92,
+    0xFD, 0x1A, 0xE9, 0x49, 0xAA, 0xA7, 0x10, 0x75, 0x99, 0x75, 0xAF, 0x73, 0xAD, 0x19, 0x73, 0xD7,
+    0x69, 0xCA, 0x76, 0xAC, 0x97, 0x6D, 0x97, 0x6D, 0x77, 0xD7, 0x69, 0xD7, 0x69, 0xCA, 0x76, 0xAC,
+    0xA7, 0x6D, 0x97, 0x6D, 0x97, 0x6D, 0x77, 0xD7, 0x69, 0xD7, 0x6A, 0xCA, 0x76, 0xDA, 0x71, 0xA9,
+    0x1A, 0xD9, 0x7A, 0xFF, 0x70, 0xAF, 0xE9, 0x71, 0x9F, 0xCA, 0x74, 0x99, 0x97, 0x20, 0x1A, 0xA1,
+    0x9D, 0x90, 0xAD, 0xA0, 0xEA, 0x77, 0x72, 0xAA, 0x19, 0xD9, 0x0A, 0xDA, 0x0E, 0xA0, 0x74, 0x9E,
+    0x93, 0xA9, 0x0D, 0x09, 0xC9, 0x2C, 0xA9, 0xCA, 0x19, 0xCA, 0x09, 0xC9, 0x9C, 0x92, 0x9F, 0x77,
+    0x71, 0x9E, 0xA3, 0xA9, 0x0D, 0x1D, 0x91, 0xC9, 0x9C, 0x92, 0xAF, 0x74, 0x71, 0x9C, 0x73, 0xC9,
+    0x72, 0x9C, 0x73, 0xC9, 0x72, 0xAC, 0x72, 0x9C, 0xAA, 0xA2, 0xFF, 0xF0, 0x9A, 0xAA, 0x99, 0xAC,
+    0x73, 0xCA, 0x72, 0xAC, 0x79, 0x9A, 0xAD, 0x9A, 0xAA, 0xA9, 0x09, 0xFF, 0xEA, 0x3A, 0xC9, 0x72,
+    0xD7, 0x2D, 0x97, 0x19, 0xCA, 0x72, 0xD7, 0x77, 0x00, 0x77, 0x71, 0x9A, 0xC9, 0x71, 0x9E, 0xA7,
+    0x0A, 0xEA, 0x70, 0xAE, 0xA7, 0x9F, 0xA7, 0x09, 0xEA, 0x72, 0x9F, 0xA9, 0x71, 0x9F, 0xDA, 0x97,
+    0x19, 0xAF, 0xDA, 0x97, 0x09, 0xAF, 0xC7, 0x49, 0xD7, 0x72, 0x9D, 0xAA, 0x99, 0x70, 0x9A, 0xFF,
+    0xCA, 0xA9, 0x70, 0x99, 0xAA, 0xAD, 0x00, 0x77, 0x19, 0xCA, 0x97, 0x4F, 0x97, 0x39, 0xAE, 0xA7,
+    0x4A, 0xEA, 0x74, 0xAE, 0xA9, 0x73, 0xAE, 0x71, 0x9A, 0xF6, 0x9F, 0xE9, 0x29, 0xAF, 0xDA, 0x95,
+    0xFC, 0xA9, 0x70, 0xD9, 0x77, 0x77, 0x29, 0x9A, 0xAD, 0x91, 0x9A, 0xAF, 0xFC, 0xA9, 0x1D, 0xAA,
+    0xA9, 0x97,
 };
 
 static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 6, 21, 7, 0, 21, 32, 0 }, // !
-    { 11, 6, 12, 0, 18, 17, 32 }, // "
-    { 22, 19, 24, 1, 17, 105, 49 }, // #
-    { 17, 22, 25, 4, 19, 94, 154 }, // $
-    { 14, 17, 21, 4, 16, 60, 248 }, // %
-    { 16, 19, 20, 2, 18, 76, 308 }, // &
-    { 5, 6, 6, 0, 16, 8, 384 }, // '
-    { 7, 28, 10, 2, 21, 49, 392 }, // (
-    { 7, 28, 9, 0, 21, 49, 441 }, // )
-    { 11, 10, 13, 1, 16, 28, 490 }, // *
-    { 11, 10, 13, 1, 11, 28, 518 }, // +
-    { 5, 6, 7, 1, 3, 8, 546 }, // ,
-    { 10, 3, 13, 1, 8, 8, 554 }, // -
-    { 4, 4, 6, 1, 4, 4, 562 }, // .
-    { 12, 33, 13, 0, 23, 99, 566 }, // /
-    { 12, 16, 14, 1, 16, 48, 665 }, // 0
-    { 10, 16, 12, 1, 16, 40, 713 }, // 1
-    { 11, 16, 13, 1, 16, 44, 753 }, // 2
-    { 11, 16, 13, 1, 16, 44, 797 }, // 3
-    { 12, 16, 14, 1, 16, 48, 841 }, // 4
-    { 11, 16, 13, 1, 16, 44, 889 }, // 5
-    { 12, 16, 14, 1, 16, 48, 933 }, // 6
-    { 11, 16, 13, 1, 16, 44, 981 }, // 7
-    { 12, 16, 14, 1, 16, 48, 1025 }, // 8
-    { 12, 16, 14, 1, 16, 48, 1073 }, // 9
-    { 5, 13, 6, 0, 13, 17, 1121 }, // :
-    { 5, 15, 7, 1, 12, 19, 1138 }, // ;
-    { 15, 12, 17, 1, 13, 45, 1157 }, // <
-    { 10, 7, 13, 1, 9, 18, 1202 }, // =
-    { 15, 12, 17, 1, 13, 45, 1220 }, // >
-    { 12, 23, 13, 0, 23, 69, 1265 }, // ?
-    { 19, 19, 25, 2, 17, 91, 1334 }, // @
-    { 17, 18, 24, 3, 18, 77, 1425 }, // A
-    { 14, 18, 20, 3, 18, 63, 1502 }, // B
-    { 14, 20, 21, 3, 19, 70, 1565 }, // C
-    { 17, 18, 23, 3, 18, 77, 1635 }, // D
-    { 13, 18, 19, 3, 18, 59, 1712 }, // E
-    { 11, 18, 18, 3, 18, 50, 1771 }, // F
-    { 17, 19, 24, 3, 19, 81, 1821 }, // G
-    { 16, 18, 22, 3, 18, 72, 1902 }, // H
-    { 5, 18, 10, 2, 18, 23, 1974 }, // I
-    { 9, 24, 16, 3, 19, 54, 1997 }, // J
-    { 15, 18, 21, 3, 18, 68, 2051 }, // K
-    { 12, 18, 19, 3, 18, 54, 2119 }, // L
-    { 19, 18, 26, 3, 18, 86, 2173 }, // M
-    { 16, 18, 22, 3, 18, 72, 2259 }, // N
-    { 17, 19, 24, 3, 18, 81, 2331 }, // O
-    { 13, 18, 19, 3, 18, 59, 2412 }, // P
-    { 17, 21, 21, 2, 18, 90, 2471 }, // Q
-    { 14, 18, 20, 3, 18, 63, 2561 }, // R
-    { 17, 19, 23, 3, 18, 81, 2624 }, // S
-    { 16, 18, 22, 3, 18, 72, 2705 }, // T
-    { 15, 19, 22, 3, 18, 72, 2777 }, // U
-    { 18, 18, 24, 3, 18, 81, 2849 }, // V
-    { 23, 18, 30, 3, 18, 104, 2930 }, // W
-    { 17, 18, 24, 3, 18, 77, 3034 }, // X
-    { 16, 18, 22, 3, 18, 72, 3111 }, // Y
-    { 17, 18, 24, 3, 18, 77, 3183 }, // Z
-    { 8, 29, 10, 1, 22, 58, 3260 }, // [
-    { 8, 20, 10, 1, 16, 40, 3318 }, // <backslash>
-    { 8, 29, 10, 1, 22, 58, 3358 }, // ]
-    { 9, 5, 12, 1, 20, 12, 3416 }, // ^
-    { 14, 3, 17, 1, -2, 11, 3428 }, // _
-    { 7, 4, 9, 1, 16, 7, 3439 }, // `
-    { 12, 13, 17, 2, 13, 39, 3446 }, // a
-    { 12, 19, 18, 3, 18, 57, 3485 }, // b
-    { 10, 14, 16, 3, 13, 35, 3542 }, // c
-    { 13, 19, 18, 2, 18, 62, 3577 }, // d
-    { 12, 13, 17, 3, 13, 39, 3639 }, // e
-    { 7, 17, 13, 3, 17, 30, 3678 }, // f
-    { 11, 17, 17, 3, 12, 47, 3708 }, // g
-    { 11, 18, 17, 3, 18, 50, 3755 }, // h
-    { 4, 18, 9, 3, 18, 18, 3805 }, // i
-    { 8, 24, 13, 3, 18, 48, 3823 }, // j
-    { 11, 17, 17, 3, 17, 47, 3871 }, // k
-    { 7, 17, 11, 2, 17, 30, 3918 }, // l
-    { 19, 12, 24, 3, 12, 57, 3948 }, // m
-    { 11, 12, 17, 3, 12, 33, 4005 }, // n
-    { 12, 12, 17, 3, 12, 36, 4038 }, // o
-    { 13, 18, 17, 2, 12, 59, 4074 }, // p
-    { 14, 18, 20, 3, 13, 63, 4133 }, // q
-    { 8, 12, 14, 3, 12, 24, 4196 }, // r
-    { 10, 12, 16, 3, 12, 30, 4220 }, // s
-    { 9, 16, 15, 3, 16, 36, 4250 }, // t
-    { 11, 12, 17, 3, 12, 33, 4286 }, // u
-    { 13, 12, 19, 3, 12, 39, 4319 }, // v
-    { 16, 12, 22, 3, 12, 48, 4358 }, // w
-    { 13, 12, 19, 3, 12, 39, 4406 }, // x
-    { 12, 18, 17, 3, 12, 54, 4445 }, // y
-    { 11, 12, 17, 3, 12, 33, 4499 }, // z
-    { 10, 20, 12, 1, 16, 50, 4532 }, // {
-    { 3, 18, 5, 1, 15, 14, 4582 }, // |
-    { 10, 20, 12, 1, 16, 50, 4596 }, // }
-    { 8, 5, 10, 1, 16, 10, 4646 }, // ~
-    { 0, 0, 18, 0, 0, 0, 4656 }, //  
-    { 6, 22, 7, 0, 16, 33, 4656 }, // ¡
-    { 10, 19, 16, 3, 16, 48, 4689 }, // ¢
-    { 14, 20, 15, 0, 20, 70, 4737 }, // £
-    { 12, 11, 14, 1, 13, 33, 4807 }, // ¤
-    { 14, 18, 16, 1, 16, 63, 4840 }, // ¥
-    { 3, 18, 5, 1, 15, 14, 4903 }, // ¦
-    { 12, 19, 17, 3, 17, 57, 4917 }, // §
-    { 10, 4, 12, 1, 16, 10, 4974 }, // ¨
-    { 9, 8, 11, 1, 19, 18, 4984 }, // ©
-    { 7, 8, 10, 2, 16, 14, 5002 }, // ª
-    { 11, 10, 13, 1, 10, 28, 5016 }, // «
-    { 11, 6, 13, 1, 7, 17, 5044 }, // ¬
-    { 10, 3, 12, 1, 8, 8, 5061 }, // ­
-    { 9, 8, 11, 1, 22, 18, 5069 }, // ®
-    { 9, 3, 11, 1, 15, 7, 5087 }, // ¯
-    { 10, 10, 12, 1, 17, 25, 5094 }, // °
-    { 11, 12, 13, 1, 11, 33, 5119 }, // ±
-    { 6, 8, 7, 0, 17, 12, 5152 }, // ²
-    { 6, 8, 7, 0, 17, 12, 5164 }, // ³
-    { 4, 5, 6, 1, 17, 5, 5176 }, // ´
-    { 12, 14, 17, 2, 12, 42, 5181 }, // µ
-    { 11, 17, 13, 1, 15, 47, 5223 }, // ¶
-    { 4, 4, 6, 1, 9, 4, 5270 }, // ·
-    { 5, 6, 7, 1, 1, 8, 5274 }, // ¸
-    { 6, 9, 7, 0, 18, 14, 5282 }, // ¹
-    { 7, 7, 10, 2, 15, 13, 5296 }, // º
-    { 11, 10, 13, 1, 10, 28, 5309 }, // »
-    { 18, 20, 23, 3, 19, 90, 5337 }, // ¼
-    { 18, 20, 23, 3, 18, 90, 5427 }, // ½
-    { 19, 19, 23, 2, 18, 91, 5517 }, // ¾
-    { 12, 23, 13, 0, 12, 69, 5608 }, // ¿
-    { 17, 24, 24, 3, 24, 102, 5677 }, // À
-    { 17, 27, 24, 3, 27, 115, 5779 }, // Á
-    { 17, 25, 24, 3, 25, 107, 5894 }, // Â
-    { 17, 24, 24, 3, 24, 102, 6001 }, // Ã
-    { 17, 24, 24, 3, 24, 102, 6103 }, // Ä
-    { 17, 25, 24, 3, 25, 107, 6205 }, // Å
-    { 24, 19, 30, 3, 18, 114, 6312 }, // Æ
-    { 14, 24, 21, 3, 19, 84, 6426 }, // Ç
-    { 13, 23, 19, 3, 23, 75, 6510 }, // È
-    { 13, 27, 19, 3, 27, 88, 6585 }, // É
-    { 13, 24, 19, 3, 24, 78, 6673 }, // Ê
-    { 13, 24, 19, 3, 24, 78, 6751 }, // Ë
-    { 7, 25, 10, 0, 25, 44, 6829 }, // Ì
-    { 5, 29, 10, 2, 29, 37, 6873 }, // Í
-    { 9, 26, 10, 0, 26, 59, 6910 }, // Î
-    { 11, 25, 11, -1, 25, 69, 6969 }, // Ï
-    { 19, 18, 23, 1, 18, 86, 7038 }, // Ð
-    { 16, 23, 22, 3, 23, 92, 7124 }, // Ñ
-    { 17, 24, 24, 3, 23, 102, 7216 }, // Ò
-    { 17, 28, 24, 3, 27, 119, 7318 }, // Ó
-    { 17, 25, 24, 3, 24, 107, 7437 }, // Ô
-    { 17, 24, 24, 3, 23, 102, 7544 }, // Õ
-    { 17, 24, 24, 3, 23, 102, 7646 }, // Ö
-    { 10, 6, 12, 1, 8, 15, 7748 }, // ×
-    { 26, 38, 26, -1, 28, 247, 7763 }, // Ø
-    { 15, 25, 22, 3, 24, 94, 8010 }, // Ù
-    { 15, 28, 22, 3, 27, 105, 8104 }, // Ú
-    { 15, 26, 22, 3, 25, 98, 8209 }, // Û
-    { 15, 25, 22, 3, 24, 94, 8307 }, // Ü
-    { 16, 28, 22, 3, 28, 112, 8401 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 8513 }, // Þ
-    { 12, 17, 14, 1, 17, 51, 8556 }, // ß
-    { 12, 17, 17, 2, 17, 51, 8607 }, // à
-    { 12, 21, 17, 2, 21, 63, 8658 }, // á
-    { 12, 18, 17, 2, 18, 54, 8721 }, // â
-    { 12, 17, 17, 2, 17, 51, 8775 }, // ã
-    { 12, 17, 17, 2, 17, 51, 8826 }, // ä
-    { 12, 18, 17, 2, 18, 54, 8877 }, // å
-    { 21, 13, 26, 2, 13, 69, 8931 }, // æ
-    { 10, 18, 16, 3, 13, 45, 9000 }, // ç
-    { 12, 19, 17, 3, 19, 57, 9045 }, // è
-    { 12, 23, 17, 3, 23, 69, 9102 }, // é
-    { 12, 20, 17, 3, 20, 60, 9171 }, // ê
-    { 12, 20, 17, 3, 20, 60, 9231 }, // ë
-    { 7, 17, 9, 0, 17, 30, 9291 }, // ì
-    { 4, 21, 9, 3, 21, 21, 9321 }, // í
-    { 9, 18, 10, 0, 18, 41, 9342 }, // î
-    { 11, 18, 11, -1, 18, 50, 9383 }, // ï
-    { 16, 17, 18, 1, 17, 68, 9433 }, // ð
-    { 11, 18, 17, 3, 18, 50, 9501 }, // ñ
-    { 12, 19, 17, 3, 19, 57, 9551 }, // ò
-    { 12, 23, 17, 3, 23, 69, 9608 }, // ó
-    { 12, 20, 17, 3, 20, 60, 9677 }, // ô
-    { 12, 19, 17, 3, 19, 57, 9737 }, // õ
-    { 12, 19, 17, 3, 19, 57, 9794 }, // ö
-    { 14, 13, 16, 1, 13, 46, 9851 }, // ÷
-    { 13, 33, 17, 2, 22, 108, 9897 }, // ø
-    { 11, 18, 17, 3, 18, 50, 10005 }, // ù
-    { 11, 22, 17, 3, 22, 61, 10055 }, // ú
-    { 11, 18, 17, 3, 18, 50, 10116 }, // û
-    { 11, 18, 17, 3, 18, 50, 10166 }, // ü
-    { 12, 29, 17, 3, 23, 87, 10216 }, // ý
-    { 10, 21, 12, 1, 17, 53, 10303 }, // þ
-    { 12, 26, 17, 3, 20, 78, 10356 }, // ÿ
-    { 17, 23, 24, 3, 23, 98, 10434 }, // Ā
-    { 12, 16, 17, 2, 16, 48, 10532 }, // ā
-    { 17, 26, 24, 3, 26, 111, 10580 }, // Ă
-    { 12, 19, 17, 2, 19, 57, 10691 }, // ă
-    { 17, 23, 24, 3, 18, 98, 10748 }, // Ą
-    { 13, 17, 17, 2, 13, 56, 10846 }, // ą
-    { 14, 29, 21, 3, 28, 102, 10902 }, // Ć
-    { 10, 21, 16, 3, 20, 53, 11004 }, // ć
-    { 14, 27, 21, 3, 26, 95, 11057 }, // Ĉ
-    { 10, 19, 16, 3, 18, 48, 11152 }, // ĉ
-    { 14, 27, 21, 3, 26, 95, 11200 }, // Ċ
-    { 10, 20, 16, 3, 19, 50, 11295 }, // ċ
-    { 14, 28, 21, 3, 27, 98, 11345 }, // Č
-    { 10, 21, 16, 3, 20, 53, 11443 }, // č
-    { 17, 26, 23, 3, 26, 111, 11496 }, // Ď
-    { 17, 19, 20, 2, 18, 81, 11607 }, // ď
-    { 19, 18, 23, 1, 18, 86, 11688 }, // Đ
-    { 16, 19, 19, 2, 18, 76, 11774 }, // đ
-    { 13, 23, 19, 3, 23, 75, 11850 }, // Ē
-    { 12, 19, 17, 3, 19, 57, 11925 }, // ē
-    { 13, 26, 19, 3, 26, 85, 11982 }, // Ĕ
-    { 12, 22, 17, 3, 22, 66, 12067 }, // ĕ
-    { 13, 25, 19, 3, 25, 82, 12133 }, // Ė
-    { 12, 21, 17, 3, 21, 63, 12215 }, // ė
-    { 13, 23, 19, 3, 18, 75, 12278 }, // Ę
-    { 12, 19, 17, 3, 13, 57, 12353 }, // ę
-    { 13, 25, 19, 3, 25, 82, 12410 }, // Ě
-    { 12, 22, 17, 3, 22, 66, 12492 }, // ě
-    { 17, 24, 24, 3, 24, 102, 12558 }, // Ĝ
-    { 11, 23, 17, 3, 18, 64, 12660 }, // ĝ
-    { 17, 26, 24, 3, 26, 111, 12724 }, // Ğ
-    { 11, 25, 17, 3, 20, 69, 12835 }, // ğ
-    { 17, 25, 24, 3, 25, 107, 12904 }, // Ġ
-    { 11, 24, 17, 3, 19, 66, 13011 }, // ġ
-    { 17, 28, 24, 3, 19, 119, 13077 }, // Ģ
-    { 11, 25, 17, 3, 20, 69, 13196 }, // ģ
-    { 16, 24, 22, 3, 24, 96, 13265 }, // Ĥ
-    { 13, 23, 17, 1, 23, 75, 13361 }, // ĥ
-    { 17, 18, 22, 2, 18, 77, 13436 }, // Ħ
-    { 14, 18, 17, 0, 18, 63, 13513 }, // ħ
-    { 8, 26, 10, 0, 26, 52, 13576 }, // Ĩ
-    { 8, 18, 10, 1, 18, 36, 13628 }, // ĩ
-    { 11, 24, 11, -1, 24, 66, 13664 }, // Ī
-    { 10, 17, 11, 0, 17, 43, 13730 }, // ī
-    { 5, 23, 13, 5, 18, 29, 13773 }, // Į
-    { 5, 23, 9, 2, 18, 29, 13802 }, // į
-    { 5, 26, 10, 2, 26, 33, 13831 }, // İ
-    { 4, 12, 9, 3, 12, 12, 13864 }, // ı
-    { 14, 23, 19, 2, 18, 81, 13876 }, // Ĳ
-    { 15, 24, 19, 3, 18, 90, 13957 }, // ĳ
-    { 10, 27, 16, 3, 22, 68, 14047 }, // Ĵ
-    { 11, 23, 15, 3, 17, 64, 14115 }, // ĵ
-    { 15, 25, 21, 3, 18, 94, 14179 }, // Ķ
-    { 11, 26, 17, 3, 17, 72, 14273 }, // ķ
-    { 9, 12, 13, 2, 12, 27, 14345 }, // ĸ
-    { 12, 25, 19, 3, 25, 75, 14372 }, // Ĺ
-    { 7, 25, 11, 2, 25, 44, 14447 }, // ĺ
-    { 12, 27, 19, 3, 18, 81, 14491 }, // Ļ
-    { 7, 25, 11, 2, 17, 44, 14572 }, // ļ
-    { 12, 18, 19, 3, 18, 54, 14616 }, // Ľ
-    { 9, 18, 12, 2, 18, 41, 14670 }, // ľ
-    { 12, 18, 19, 3, 18, 54, 14711 }, // Ŀ
-    { 10, 17, 13, 2, 17, 43, 14765 }, // ŀ
-    { 20, 29, 19, -5, 23, 145, 14808 }, // Ł
-    { 14, 17, 11, -4, 17, 60, 14953 }, // ł
-    { 16, 25, 22, 3, 25, 100, 15013 }, // Ń
-    { 11, 20, 17, 3, 20, 55, 15113 }, // ń
-    { 16, 25, 22, 3, 18, 100, 15168 }, // Ņ
-    { 11, 19, 17, 3, 12, 53, 15268 }, // ņ
-    { 16, 25, 22, 3, 25, 100, 15321 }, // Ň
-    { 11, 20, 17, 3, 20, 55, 15421 }, // ň
-    { 12, 22, 14, 1, 22, 66, 15476 }, // ŉ
-    { 16, 22, 22, 3, 18, 88, 15542 }, // Ŋ
-    { 11, 16, 17, 3, 12, 44, 15630 }, // ŋ
-    { 17, 23, 24, 3, 22, 98, 15674 }, // Ō
-    { 12, 18, 17, 3, 18, 54, 15772 }, // ō
-    { 17, 27, 24, 3, 26, 115, 15826 }, // Ŏ
-    { 12, 22, 17, 3, 22, 66, 15941 }, // ŏ
-    { 18, 25, 24, 3, 24, 113, 16007 }, // Ő
-    { 16, 20, 18, 1, 20, 80, 16120 }, // ő
-    { 24, 19, 28, 3, 19, 114, 16200 }, // Œ
-    { 20, 13, 24, 3, 13, 65, 16314 }, // œ
-    { 14, 25, 20, 3, 25, 88, 16379 }, // Ŕ
-    { 8, 18, 14, 3, 18, 36, 16467 }, // ŕ
-    { 14, 28, 20, 3, 18, 98, 16503 }, // Ŗ
-    { 9, 23, 14, 2, 12, 52, 16601 }, // ŗ
-    { 14, 25, 20, 3, 25, 88, 16653 }, // Ř
-    { 10, 18, 14, 1, 18, 45, 16741 }, // ř
-    { 17, 28, 23, 3, 27, 119, 16786 }, // Ś
-    { 10, 20, 16, 3, 20, 50, 16905 }, // ś
-    { 17, 26, 23, 3, 25, 111, 16955 }, // Ŝ
-    { 10, 18, 16, 3, 18, 45, 17066 }, // ŝ
-    { 17, 23, 23, 3, 18, 98, 17111 }, // Ş
-    { 10, 18, 16, 3, 12, 45, 17209 }, // ş
-    { 17, 27, 23, 3, 26, 115, 17254 }, // Š
-    { 10, 20, 16, 3, 20, 50, 17369 }, // š
-    { 16, 22, 22, 3, 18, 88, 17419 }, // Ţ
-    { 9, 20, 15, 3, 16, 45, 17507 }, // ţ
-    { 16, 24, 22, 3, 24, 96, 17552 }, // Ť
-    { 10, 18, 15, 3, 18, 45, 17648 }, // ť
-    { 16, 18, 22, 3, 18, 72, 17693 }, // Ŧ
-    { 10, 16, 15, 2, 16, 40, 17765 }, // ŧ
-    { 15, 26, 22, 3, 25, 98, 17805 }, // Ũ
-    { 11, 19, 17, 3, 19, 53, 17903 }, // ũ
-    { 15, 24, 22, 3, 23, 90, 17956 }, // Ū
-    { 11, 17, 17, 3, 17, 47, 18046 }, // ū
-    { 15, 28, 22, 3, 27, 105, 18093 }, // Ŭ
-    { 11, 20, 17, 3, 20, 55, 18198 }, // ŭ
-    { 15, 27, 22, 3, 26, 102, 18253 }, // Ů
-    { 11, 20, 17, 3, 20, 55, 18355 }, // ů
-    { 17, 26, 22, 3, 25, 111, 18410 }, // Ű
-    { 16, 19, 18, 1, 19, 76, 18521 }, // ű
-    { 15, 23, 22, 3, 18, 87, 18597 }, // Ų
-    { 11, 17, 17, 3, 12, 47, 18684 }, // ų
-    { 23, 24, 30, 3, 24, 138, 18731 }, // Ŵ
-    { 16, 19, 22, 3, 19, 76, 18869 }, // ŵ
-    { 16, 25, 22, 3, 25, 100, 18945 }, // Ŷ
-    { 12, 26, 17, 3, 20, 78, 19045 }, // ŷ
-    { 16, 25, 22, 3, 25, 100, 19123 }, // Ÿ
-    { 17, 25, 24, 3, 25, 107, 19223 }, // Ź
-    { 11, 20, 17, 3, 20, 55, 19330 }, // ź
-    { 17, 24, 24, 3, 24, 102, 19385 }, // Ż
-    { 11, 19, 17, 3, 19, 53, 19487 }, // ż
-    { 17, 25, 24, 3, 25, 107, 19540 }, // Ž
-    { 11, 20, 17, 3, 20, 55, 19647 }, // ž
-    { 7, 17, 11, 3, 17, 30, 19702 }, // ſ
-    { 19, 21, 24, 3, 20, 100, 19732 }, // Ơ
-    { 13, 13, 17, 3, 13, 43, 19832 }, // ơ
-    { 15, 18, 19, 1, 18, 68, 19875 }, // Ƥ
-    { 13, 22, 17, 2, 16, 72, 19943 }, // ƥ
-    { 10, 16, 12, 1, 15, 40, 20015 }, // Ʃ
-    { 16, 18, 22, 3, 18, 72, 20055 }, // Ƭ
-    { 9, 18, 15, 3, 18, 41, 20127 }, // ƭ
-    { 16, 22, 22, 3, 18, 88, 20168 }, // Ʈ
-    { 17, 22, 22, 3, 21, 94, 20256 }, // Ư
-    { 13, 14, 17, 3, 14, 46, 20350 }, // ư
-    { 7, 4, 9, 1, 16, 7, 20396 }, // ̀
-    { 4, 5, 6, 1, 17, 5, 20403 }, // ́
-    { 9, 5, 11, 1, 1, 12, 20408 }, // ̂
-    { 8, 5, 10, 1, 16, 10, 20420 }, // ̃
-    { 11, 3, 13, 1, 14, 9, 20430 }, // ̄
-    { 14, 3, 16, 1, 18, 11, 20439 }, // ̅
-    { 9, 5, 11, 1, 16, 12, 20450 }, // ̆
-    { 4, 4, 6, 1, 16, 4, 20462 }, // ̇
-    { 10, 4, 12, 1, 16, 10, 20466 }, // ̈
-    { 5, 4, 6, 0, 13, 5, 20476 }, // ̉
-    { 5, 5, 7, 1, 16, 7, 20481 }, // ̊
-    { 15, 4, 17, 1, 16, 15, 20488 }, // ̋
-    { 9, 5, 11, 1, 16, 12, 20503 }, // ̌
-    { 15, 4, 12, -4, 17, 15, 20515 }, // ̏
-    { 6, 6, 7, 0, 16, 9, 20530 }, // ̒
-    { 5, 6, 7, 1, 15, 8, 20539 }, // ̓
-    { 6, 6, 7, 0, 15, 9, 20547 }, // ̔
-    { 4, 5, 6, 1, -1, 5, 20556 }, // ̘
-    { 4, 5, 6, 1, -1, 5, 20561 }, // ̙
-    { 9, 5, 11, 1, 17, 12, 20566 }, // ̚
-    { 4, 5, 6, 1, 13, 5, 20578 }, // ̛
-    { 3, 5, 5, 1, -1, 4, 20583 }, // ̜
-    { 5, 4, 7, 1, 3, 5, 20587 }, // ̝
-    { 5, 4, 7, 1, 0, 5, 20592 }, // ̞
-    { 5, 5, 7, 1, -2, 7, 20597 }, // ̟
-    { 10, 3, 12, 1, -3, 8, 20604 }, // ̠
-    { 4, 4, 6, 1, 1, 4, 20612 }, // ̣
-    { 10, 4, 12, 1, 0, 10, 20616 }, // ̤
-    { 5, 5, 7, 1, 16, 7, 20626 }, // ̥
-    { 5, 6, 7, 1, 3, 8, 20633 }, // ̦
-    { 5, 6, 7, 1, 1, 8, 20641 }, // ̧
-    { 5, 6, 7, 1, 1, 8, 20649 }, // ̨
-    { 3, 6, 5, 1, -1, 5, 20657 }, // ̩
-    { 7, 4, 9, 1, -1, 7, 20662 }, // ̪
-    { 9, 5, 11, 1, 0, 12, 20669 }, // ̬
-    { 9, 5, 11, 1, -1, 12, 20681 }, // ̭
-    { 8, 5, 10, 1, 16, 10, 20693 }, // ̰
-    { 9, 3, 11, 1, 15, 7, 20703 }, // ̱
-    { 9, 3, 11, 1, -1, 7, 20710 }, // ̲
-    { 8, 5, 10, 1, 16, 10, 20717 }, // ̴
-    { 10, 3, 12, 1, 8, 8, 20727 }, // ̵
-    { 3, 5, 5, 1, -1, 4, 20735 }, // ̹
-    { 7, 4, 9, 1, -1, 7, 20739 }, // ̺
-    { 7, 5, 9, 1, 0, 9, 20746 }, // ̻
-    { 7, 4, 9, 1, 0, 7, 20755 }, // ̼
-    { 5, 5, 8, 2, 16, 7, 20762 }, // ̽
-    { 8, 5, 10, 1, 16, 10, 20769 }, // ͂
-    { 3, 4, 5, 1, 17, 3, 20779 }, // ̓
-    { 10, 10, 12, 1, 22, 25, 20782 }, // ̈́
-    { 7, 4, 9, 1, 16, 7, 20807 }, // ͆
-    { 10, 8, 12, 1, 0, 20, 20814 }, // ͇
-    { 8, 6, 10, 1, 0, 12, 20834 }, // ͈
-    { 7, 6, 9, 1, -1, 11, 20846 }, // ͉
-    { 8, 12, 10, 1, 20, 24, 20857 }, // ͊
-    { 17, 9, 19, 1, 19, 39, 20881 }, // ͋
-    { 12, 11, 15, 2, 12, 33, 20920 }, // ͌
-    { 10, 5, 13, 2, -2, 13, 20953 }, // ͍
-    { 4, 3, 6, 1, 2, 3, 20966 }, // ͎
-    { 17, 4, 19, 1, 0, 17, 20969 }, // ͜
-    { 17, 4, 19, 1, 16, 17, 20986 }, // ͡
-    { 21, 5, 23, 1, -1, 27, 21003 }, // ͢
-    { 17, 18, 24, 3, 18, 77, 21030 }, // Α
-    { 14, 18, 20, 3, 18, 63, 21107 }, // Β
-    { 10, 17, 12, 1, 16, 43, 21170 }, // Γ
-    { 16, 16, 18, 1, 16, 64, 21213 }, // Δ
-    { 13, 18, 19, 3, 18, 59, 21277 }, // Ε
-    { 17, 18, 24, 3, 18, 77, 21336 }, // Ζ
-    { 16, 18, 22, 3, 18, 72, 21413 }, // Η
-    { 17, 19, 24, 3, 18, 81, 21485 }, // Θ
-    { 5, 18, 10, 2, 18, 23, 21566 }, // Ι
-    { 15, 18, 21, 3, 18, 68, 21589 }, // Κ
-    { 18, 18, 24, 3, 18, 81, 21657 }, // Λ
-    { 19, 18, 26, 3, 18, 86, 21738 }, // Μ
-    { 16, 18, 22, 3, 18, 72, 21824 }, // Ν
-    { 14, 15, 16, 1, 15, 53, 21896 }, // Ξ
-    { 17, 19, 24, 3, 18, 81, 21949 }, // Ο
-    { 11, 15, 13, 1, 15, 42, 22030 }, // Π
-    { 13, 18, 19, 3, 18, 59, 22072 }, // Ρ
-    { 10, 16, 12, 1, 15, 40, 22131 }, // Σ
-    { 16, 18, 22, 3, 18, 72, 22171 }, // Τ
-    { 16, 18, 22, 3, 18, 72, 22243 }, // Υ
-    { 21, 22, 29, 4, 20, 116, 22315 }, // Φ
-    { 17, 18, 24, 3, 18, 77, 22431 }, // Χ
-    { 15, 18, 17, 1, 16, 68, 22508 }, // Ψ
-    { 16, 17, 18, 1, 16, 68, 22576 }, // Ω
-    { 15, 14, 20, 2, 13, 53, 22644 }, // α
-    { 12, 24, 14, 1, 20, 72, 22697 }, // β
-    { 12, 18, 14, 1, 12, 54, 22769 }, // γ
-    { 12, 18, 14, 1, 18, 54, 22823 }, // δ
-    { 9, 11, 11, 1, 11, 25, 22877 }, // ε
-    { 11, 18, 12, 0, 15, 50, 22902 }, // ζ
-    { 13, 19, 15, 1, 13, 62, 22952 }, // η
-    { 12, 16, 14, 1, 16, 48, 23014 }, // θ
-    { 5, 14, 11, 3, 14, 18, 23062 }, // ι
-    { 10, 13, 15, 2, 13, 33, 23080 }, // κ
-    { 12, 17, 16, 2, 17, 51, 23113 }, // λ
-    { 12, 14, 17, 2, 12, 42, 23164 }, // μ
-    { 12, 12, 14, 1, 12, 36, 23206 }, // ν
-    { 11, 18, 12, 0, 15, 50, 23242 }, // ξ
-    { 12, 12, 17, 3, 12, 36, 23292 }, // ο
-    { 13, 12, 15, 1, 11, 39, 23328 }, // π
-    { 13, 17, 15, 1, 12, 56, 23367 }, // ρ
-    { 9, 14, 11, 1, 15, 32, 23423 }, // ς
-    { 14, 12, 18, 3, 12, 42, 23455 }, // σ
-    { 12, 12, 14, 1, 11, 36, 23497 }, // τ
-    { 10, 13, 12, 1, 12, 33, 23533 }, // υ
-    { 17, 26, 24, 3, 23, 111, 23566 }, // φ
-    { 15, 16, 17, 1, 12, 60, 23677 }, // χ
-    { 12, 20, 14, 1, 15, 60, 23737 }, // ψ
-    { 15, 12, 17, 1, 11, 45, 23797 }, // ω
-    { 17, 25, 24, 3, 18, 107, 23842 }, // Ạ
-    { 12, 19, 17, 2, 13, 57, 23949 }, // ạ
-    { 17, 26, 24, 3, 26, 111, 24006 }, // Ả
-    { 12, 19, 17, 2, 19, 57, 24117 }, // ả
-    { 17, 29, 24, 3, 29, 124, 24174 }, // Ấ
-    { 13, 24, 17, 2, 24, 78, 24298 }, // ấ
-    { 18, 27, 24, 2, 27, 122, 24376 }, // Ầ
-    { 14, 20, 17, 0, 20, 70, 24498 }, // ầ
-    { 17, 29, 24, 3, 29, 124, 24568 }, // Ẩ
-    { 12, 21, 17, 2, 21, 63, 24692 }, // ẩ
-    { 17, 29, 24, 3, 29, 124, 24755 }, // Ẫ
-    { 12, 22, 17, 2, 22, 66, 24879 }, // ẫ
-    { 17, 32, 24, 3, 25, 136, 24945 }, // Ậ
-    { 12, 24, 17, 2, 18, 72, 25081 }, // ậ
-    { 17, 34, 24, 3, 34, 145, 25153 }, // Ắ
-    { 12, 27, 17, 2, 27, 81, 25298 }, // ắ
-    { 17, 32, 24, 3, 32, 136, 25379 }, // Ằ
-    { 12, 25, 17, 2, 25, 75, 25515 }, // ằ
-    { 17, 33, 24, 3, 33, 141, 25590 }, // Ẳ
-    { 12, 27, 17, 2, 27, 81, 25731 }, // ẳ
-    { 17, 32, 24, 3, 32, 136, 25812 }, // Ẵ
-    { 12, 25, 17, 2, 25, 75, 25948 }, // ẵ
-    { 17, 33, 24, 3, 26, 141, 26023 }, // Ặ
-    { 12, 25, 17, 2, 19, 75, 26164 }, // ặ
-    { 13, 23, 19, 3, 18, 75, 26239 }, // Ẹ
-    { 12, 19, 17, 3, 13, 57, 26314 }, // ẹ
-    { 13, 25, 19, 3, 25, 82, 26371 }, // Ẻ
-    { 12, 21, 17, 3, 21, 63, 26453 }, // ẻ
-    { 13, 25, 19, 3, 25, 82, 26516 }, // Ẽ
-    { 12, 20, 17, 3, 20, 60, 26598 }, // ẽ
-    { 13, 28, 19, 3, 28, 91, 26658 }, // Ế
-    { 13, 21, 17, 3, 21, 69, 26749 }, // ế
-    { 17, 25, 19, -1, 25, 107, 26818 }, // Ề
-    { 15, 22, 17, 0, 22, 83, 26925 }, // ề
-    { 14, 28, 19, 3, 28, 98, 27008 }, // Ể
-    { 12, 24, 17, 3, 24, 72, 27106 }, // ể
-    { 13, 29, 19, 3, 29, 95, 27178 }, // Ễ
-    { 12, 25, 17, 3, 25, 75, 27273 }, // ễ
-    { 13, 29, 19, 3, 24, 95, 27348 }, // Ệ
-    { 12, 26, 17, 3, 20, 78, 27443 }, // ệ
-    { 5, 27, 10, 2, 27, 34, 27521 }, // Ỉ
-    { 6, 19, 9, 2, 19, 29, 27555 }, // ỉ
-    { 5, 24, 10, 2, 18, 30, 27584 }, // Ị
-    { 5, 24, 9, 2, 18, 30, 27614 }, // ị
-    { 17, 24, 24, 3, 18, 102, 27644 }, // Ọ
-    { 12, 19, 17, 3, 12, 57, 27746 }, // ọ
-    { 17, 26, 24, 3, 25, 111, 27803 }, // Ỏ
-    { 12, 21, 17, 3, 21, 63, 27914 }, // ỏ
-    { 21, 25, 25, 3, 24, 132, 27977 }, // Ố
-    { 14, 20, 18, 3, 20, 70, 28109 }, // ố
-    { 18, 26, 24, 2, 25, 117, 28179 }, // Ồ
-    { 15, 22, 17, 0, 22, 83, 28296 }, // ồ
-    { 17, 28, 24, 3, 27, 119, 28379 }, // Ổ
-    { 12, 24, 17, 3, 24, 72, 28498 }, // ổ
-    { 17, 29, 24, 3, 28, 124, 28570 }, // Ỗ
-    { 12, 24, 17, 3, 24, 72, 28694 }, // ỗ
-    { 17, 30, 24, 3, 24, 128, 28766 }, // Ộ
-    { 12, 26, 17, 3, 20, 78, 28894 }, // ộ
-    { 19, 28, 24, 3, 27, 133, 28972 }, // Ớ
-    { 13, 22, 17, 3, 22, 72, 29105 }, // ớ
-    { 19, 26, 24, 3, 25, 124, 29177 }, // Ờ
-    { 13, 20, 17, 3, 20, 65, 29301 }, // ờ
-    { 19, 27, 24, 3, 26, 129, 29366 }, // Ở
-    { 13, 21, 17, 3, 21, 69, 29495 }, // ở
-    { 19, 26, 24, 3, 25, 124, 29564 }, // Ỡ
-    { 13, 20, 17, 3, 20, 65, 29688 }, // ỡ
-    { 19, 26, 24, 3, 20, 124, 29753 }, // Ợ
-    { 13, 20, 17, 3, 13, 65, 29877 }, // ợ
-    { 15, 24, 22, 3, 18, 90, 29942 }, // Ụ
-    { 11, 18, 17, 3, 12, 50, 30032 }, // ụ
-    { 15, 27, 22, 3, 26, 102, 30082 }, // Ủ
-    { 11, 19, 17, 3, 19, 53, 30184 }, // ủ
-    { 17, 27, 22, 3, 26, 115, 30237 }, // Ứ
-    { 13, 20, 17, 3, 20, 65, 30352 }, // ứ
-    { 17, 26, 22, 3, 25, 111, 30417 }, // Ừ
-    { 13, 18, 17, 3, 18, 59, 30528 }, // ừ
-    { 17, 27, 22, 3, 26, 115, 30587 }, // Ử
-    { 13, 19, 17, 3, 19, 62, 30702 }, // ử
-    { 17, 26, 22, 3, 25, 111, 30764 }, // Ữ
-    { 13, 19, 17, 3, 19, 62, 30875 }, // ữ
-    { 17, 27, 22, 3, 21, 115, 30937 }, // Ự
-    { 13, 20, 17, 3, 14, 65, 31052 }, // ự
-    { 16, 25, 22, 3, 25, 100, 31117 }, // Ỳ
-    { 12, 25, 17, 3, 19, 75, 31217 }, // ỳ
-    { 16, 27, 22, 3, 18, 108, 31292 }, // Ỵ
-    { 14, 18, 18, 3, 12, 63, 31400 }, // ỵ
-    { 16, 26, 22, 3, 26, 104, 31463 }, // Ỷ
-    { 12, 27, 17, 3, 21, 81, 31567 }, // ỷ
-    { 16, 25, 22, 3, 25, 100, 31648 }, // Ỹ
-    { 12, 27, 17, 3, 21, 81, 31748 }, // ỹ
-    { 0, 0, 17, 0, 0, 0, 31829 }, //  
-    { 0, 0, 28, 0, 0, 0, 31829 }, //  
-    { 0, 0, 17, 0, 0, 0, 31829 }, //  
-    { 0, 0, 28, 0, 0, 0, 31829 }, //  
-    { 0, 0, 14, 0, 0, 0, 31829 }, //  
-    { 0, 0, 12, 0, 0, 0, 31829 }, //  
-    { 0, 0, 10, 0, 0, 0, 31829 }, //  
-    { 0, 0, 14, 0, 0, 0, 31829 }, //  
-    { 0, 0, 5, 0, 0, 0, 31829 }, //  
-    { 0, 0, 11, 0, 0, 0, 31829 }, //  
-    { 0, 0, 10, 0, 0, 0, 31829 }, //  
-    { 0, 0, 7, 0, 0, 0, 31829 }, // ​
-    { 0, 0, 1, 0, 0, 0, 31829 }, // ‌
-    { 0, 0, 1, 0, 0, 0, 31829 }, // ‍
-    { 0, 0, 1, 0, 0, 0, 31829 }, // ‎
-    { 0, 0, 1, 0, 0, 0, 31829 }, // ‏
-    { 10, 3, 12, 1, 8, 8, 31829 }, // ‐
-    { 10, 3, 12, 1, 8, 8, 31837 }, // ‑
-    { 15, 3, 17, 1, 8, 12, 31845 }, // ‒
-    { 14, 3, 17, 1, 8, 11, 31857 }, // –
-    { 21, 3, 23, 1, 8, 16, 31868 }, // —
-    { 21, 3, 23, 1, 8, 16, 31884 }, // ―
-    { 9, 18, 11, 1, 15, 41, 31900 }, // ‖
-    { 16, 8, 18, 1, -1, 32, 31941 }, // ‗
-    { 5, 6, 7, 1, 18, 8, 31973 }, // ‘
-    { 5, 6, 7, 1, 18, 8, 31981 }, // ’
-    { 5, 6, 7, 1, 3, 8, 31989 }, // ‚
-    { 5, 6, 7, 1, 18, 8, 31997 }, // ‛
-    { 10, 6, 12, 1, 18, 15, 32005 }, // “
-    { 10, 6, 12, 1, 18, 15, 32020 }, // ”
-    { 5, 6, 7, 1, 3, 8, 32035 }, // „
-    { 10, 6, 12, 1, 18, 15, 32043 }, // ‟
-    { 12, 28, 13, 0, 22, 84, 32058 }, // †
-    { 11, 28, 13, 1, 22, 77, 32142 }, // ‡
-    { 13, 12, 13, -1, 14, 39, 32219 }, // •
-    { 6, 7, 8, 1, 9, 11, 32258 }, // ‣
-    { 4, 4, 6, 1, 4, 4, 32269 }, // ․
-    { 4, 4, 6, 1, 4, 4, 32273 }, // ‥
-    { 18, 4, 20, 1, 4, 18, 32277 }, // …
-    { 3, 3, 5, 1, 8, 3, 32295 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 32298 }, //  
-    { 13, 18, 23, 5, 16, 59, 32298 }, // ‰
-    { 5, 6, 7, 1, 18, 8, 32357 }, // ′
-    { 10, 6, 12, 1, 18, 15, 32365 }, // ″
-    { 16, 7, 18, 1, 18, 28, 32380 }, // ‴
-    { 5, 6, 7, 1, 17, 8, 32408 }, // ‵
-    { 10, 6, 11, 0, 17, 15, 32416 }, // ‶
-    { 16, 7, 18, 1, 18, 28, 32431 }, // ‷
-    { 9, 4, 12, 1, 17, 9, 32459 }, // ‸
-    { 7, 10, 9, 1, 11, 18, 32468 }, // ‹
-    { 7, 10, 9, 1, 11, 18, 32486 }, // ›
-    { 22, 21, 28, 4, 19, 116, 32504 }, // ※
-    { 6, 21, 7, 0, 21, 32, 32620 }, // ‼
-    { 11, 26, 16, 2, 25, 72, 32652 }, // ‽
-    { 10, 3, 12, 1, 17, 8, 32724 }, // ‾
-    { 9, 4, 12, 1, 14, 9, 32732 }, // ‿
-    { 14, 14, 17, 1, 19, 49, 32741 }, // ⁂
-    { 13, 17, 23, 5, 16, 56, 32790 }, // ⁄
-    { 23, 24, 26, 2, 24, 138, 32846 }, // ⁇
-    { 16, 23, 21, 2, 23, 92, 32984 }, // ⁈
-    { 17, 25, 18, 0, 23, 107, 33076 }, // ⁉
-    { 12, 33, 15, 2, 23, 99, 33183 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 33282 }, //  
-    { 6, 8, 7, 0, 17, 12, 33282 }, // ⁰
-    { 6, 9, 7, 0, 18, 14, 33294 }, // ⁴
-    { 6, 9, 7, 0, 18, 14, 33308 }, // ⁵
-    { 6, 8, 7, 0, 17, 12, 33322 }, // ⁶
-    { 7, 9, 8, 0, 18, 16, 33334 }, // ⁷
-    { 7, 8, 8, 0, 17, 14, 33350 }, // ⁸
-    { 7, 8, 8, 0, 17, 14, 33364 }, // ⁹
-    { 11, 12, 17, 3, 12, 33, 33378 }, // ⁿ
-    { 8, 11, 10, 1, 11, 22, 33411 }, // ₀
-    { 6, 9, 7, 0, 5, 14, 33433 }, // ₁
-    { 6, 9, 7, 0, 5, 14, 33447 }, // ₂
-    { 6, 9, 7, 0, 5, 14, 33461 }, // ₃
-    { 7, 8, 8, 0, 5, 14, 33475 }, // ₄
-    { 6, 8, 7, 0, 5, 12, 33489 }, // ₅
-    { 7, 8, 8, 0, 4, 14, 33501 }, // ₆
-    { 6, 9, 7, 0, 5, 14, 33515 }, // ₇
-    { 7, 9, 8, 0, 5, 16, 33529 }, // ₈
-    { 7, 9, 8, 0, 5, 16, 33545 }, // ₉
-    { 7, 28, 10, 2, 21, 49, 33561 }, // ₍
-    { 7, 28, 9, 0, 21, 49, 33610 }, // ₎
-    { 15, 28, 21, 3, 23, 105, 33659 }, // ₡
-    { 14, 20, 21, 3, 19, 70, 33764 }, // ₢
-    { 14, 20, 15, 0, 20, 70, 33834 }, // ₤
-    { 20, 18, 23, 2, 18, 90, 33904 }, // ₦
-    { 16, 18, 19, 1, 18, 72, 33994 }, // ₧
-    { 21, 18, 25, 3, 18, 95, 34066 }, // ₨
-    { 16, 18, 18, 1, 18, 72, 34161 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 34233 }, // ₪
-    { 14, 17, 16, 1, 17, 60, 34297 }, // ₫
-    { 13, 19, 16, 1, 16, 62, 34357 }, // €
-    { 16, 18, 22, 3, 18, 72, 34419 }, // ₮
-    { 18, 18, 19, 0, 18, 81, 34491 }, // ₱
-    { 17, 25, 24, 3, 22, 107, 34572 }, // ₲
-    { 19, 19, 21, 1, 18, 91, 34679 }, // ₴
-    { 10, 16, 16, 3, 15, 40, 34770 }, // ₵
-    { 16, 19, 22, 3, 19, 76, 34810 }, // ₸
-    { 10, 17, 13, 1, 16, 43, 34886 }, // ₹
-    { 12, 15, 14, 1, 14, 45, 34929 }, // ₺
-    { 13, 16, 14, 0, 16, 52, 34974 }, // ₼
-    { 17, 18, 19, -1, 18, 77, 35026 }, // ₽
-    { 14, 13, 16, 1, 12, 46, 35103 }, // ←
-    { 14, 13, 16, 1, 13, 46, 35149 }, // ↑
-    { 14, 13, 16, 1, 12, 46, 35195 }, // →
-    { 14, 13, 16, 1, 13, 46, 35241 }, // ↓
-    { 16, 11, 19, 1, 11, 44, 35287 }, // ↔
-    { 12, 16, 14, 1, 17, 48, 35331 }, // ↕
-    { 11, 10, 13, 1, 10, 28, 35379 }, // ↖
-    { 11, 10, 13, 1, 10, 28, 35407 }, // ↗
-    { 11, 11, 13, 1, 11, 31, 35435 }, // ↘
-    { 11, 11, 13, 1, 11, 31, 35466 }, // ↙
-    { 16, 13, 18, 1, 12, 52, 35497 }, // ⇐
-    { 17, 15, 19, 1, 15, 64, 35549 }, // ⇑
-    { 16, 13, 18, 1, 12, 52, 35613 }, // ⇒
-    { 17, 16, 19, 1, 15, 68, 35665 }, // ⇓
-    { 18, 13, 20, 1, 12, 59, 35733 }, // ⇔
-    { 14, 17, 16, 1, 11, 60, 35792 }, // ⇕
-    { 12, 17, 14, 1, 17, 51, 35852 }, // ∂
-    { 21, 20, 24, 2, 19, 105, 35903 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 36008 }, // ∆
-    { 13, 15, 15, 1, 15, 49, 36072 }, // ∏
-    { 13, 15, 15, 1, 15, 49, 36121 }, // ∐
-    { 10, 16, 12, 1, 15, 40, 36170 }, // ∑
-    { 10, 3, 13, 1, 7, 8, 36210 }, // −
-    { 17, 18, 19, 1, 17, 77, 36218 }, // √
-    { 17, 11, 19, 1, 13, 47, 36295 }, // ∞
-    { 18, 24, 19, 0, 19, 108, 36342 }, // ∫
-    { 5, 13, 6, 0, 13, 17, 36450 }, // ∶
-    { 12, 11, 16, 2, 12, 33, 36467 }, // ≈
-    { 14, 18, 23, 5, 16, 63, 36500 }, // ≠
-    { 16, 16, 18, 1, 15, 64, 36563 }, // ≤
-    { 16, 16, 18, 1, 15, 64, 36627 }, // ≥
+    { 6, 21, 7, 0, 21, 26, 0 }, // !
+    { 11, 6, 12, 0, 18, 19, 26 }, // "
+    { 22, 19, 24, 1, 17, 62, 45 }, // #
+    { 17, 22, 25, 4, 19, 75, 107 }, // $
+    { 14, 17, 21, 4, 16, 58, 182 }, // %
+    { 16, 19, 20, 2, 18, 56, 240 }, // &
+    { 5, 6, 6, 0, 16, 8, 296 }, // '
+    { 7, 28, 10, 2, 21, 42, 304 }, // (
+    { 7, 28, 9, 0, 21, 43, 346 }, // )
+    { 11, 10, 13, 1, 16, 27, 389 }, // *
+    { 11, 10, 13, 1, 11, 23, 416 }, // +
+    { 5, 6, 7, 1, 3, 10, 439 }, // ,
+    { 10, 3, 13, 1, 8, 5, 449 }, // -
+    { 4, 4, 6, 1, 4, 6, 454 }, // .
+    { 12, 33, 13, 0, 23, 66, 460 }, // /
+    { 12, 16, 14, 1, 16, 45, 526 }, // 0
+    { 10, 16, 12, 1, 16, 24, 571 }, // 1
+    { 11, 16, 13, 1, 16, 31, 595 }, // 2
+    { 11, 16, 13, 1, 16, 37, 626 }, // 3
+    { 12, 16, 14, 1, 16, 40, 663 }, // 4
+    { 11, 16, 13, 1, 16, 35, 703 }, // 5
+    { 12, 16, 14, 1, 16, 41, 738 }, // 6
+    { 11, 16, 13, 1, 16, 29, 779 }, // 7
+    { 12, 16, 14, 1, 16, 49, 808 }, // 8
+    { 12, 16, 14, 1, 16, 44, 857 }, // 9
+    { 5, 13, 6, 0, 13, 16, 901 }, // :
+    { 5, 15, 7, 1, 12, 17, 917 }, // ;
+    { 15, 12, 17, 1, 13, 30, 934 }, // <
+    { 10, 7, 13, 1, 9, 16, 964 }, // =
+    { 15, 12, 17, 1, 13, 30, 980 }, // >
+    { 12, 23, 13, 0, 23, 40, 1010 }, // ?
+    { 19, 19, 25, 2, 17, 74, 1050 }, // @
+    { 17, 18, 24, 3, 18, 55, 1124 }, // A
+    { 14, 18, 20, 3, 18, 55, 1179 }, // B
+    { 14, 20, 21, 3, 19, 45, 1234 }, // C
+    { 17, 18, 23, 3, 18, 58, 1279 }, // D
+    { 13, 18, 19, 3, 18, 47, 1337 }, // E
+    { 11, 18, 18, 3, 18, 32, 1384 }, // F
+    { 17, 19, 24, 3, 19, 52, 1416 }, // G
+    { 16, 18, 22, 3, 18, 49, 1468 }, // H
+    { 5, 18, 10, 2, 18, 26, 1517 }, // I
+    { 9, 24, 16, 3, 19, 41, 1543 }, // J
+    { 15, 18, 21, 3, 18, 49, 1584 }, // K
+    { 12, 18, 19, 3, 18, 38, 1633 }, // L
+    { 19, 18, 26, 3, 18, 83, 1671 }, // M
+    { 16, 18, 22, 3, 18, 67, 1754 }, // N
+    { 17, 19, 24, 3, 18, 58, 1821 }, // O
+    { 13, 18, 19, 3, 18, 42, 1879 }, // P
+    { 17, 21, 21, 2, 18, 66, 1921 }, // Q
+    { 14, 18, 20, 3, 18, 55, 1987 }, // R
+    { 17, 19, 23, 3, 18, 52, 2042 }, // S
+    { 16, 18, 22, 3, 18, 48, 2094 }, // T
+    { 15, 19, 22, 3, 18, 56, 2142 }, // U
+    { 18, 18, 24, 3, 18, 53, 2198 }, // V
+    { 23, 18, 30, 3, 18, 76, 2251 }, // W
+    { 17, 18, 24, 3, 18, 51, 2327 }, // X
+    { 16, 18, 22, 3, 18, 48, 2378 }, // Y
+    { 17, 18, 24, 3, 18, 43, 2426 }, // Z
+    { 8, 29, 10, 1, 22, 46, 2469 }, // [
+    { 8, 20, 10, 1, 16, 27, 2515 }, // <backslash>
+    { 8, 29, 10, 1, 22, 47, 2542 }, // ]
+    { 9, 5, 12, 1, 20, 10, 2589 }, // ^
+    { 14, 3, 17, 1, -2, 6, 2599 }, // _
+    { 7, 4, 9, 1, 16, 6, 2605 }, // `
+    { 12, 13, 17, 2, 13, 36, 2611 }, // a
+    { 12, 19, 18, 3, 18, 50, 2647 }, // b
+    { 10, 14, 16, 3, 13, 25, 2697 }, // c
+    { 13, 19, 18, 2, 18, 49, 2722 }, // d
+    { 12, 13, 17, 3, 13, 37, 2771 }, // e
+    { 7, 17, 13, 3, 17, 25, 2808 }, // f
+    { 11, 17, 17, 3, 12, 48, 2833 }, // g
+    { 11, 18, 17, 3, 18, 44, 2881 }, // h
+    { 4, 18, 9, 3, 18, 25, 2925 }, // i
+    { 8, 24, 13, 3, 18, 32, 2950 }, // j
+    { 11, 17, 17, 3, 17, 38, 2982 }, // k
+    { 7, 17, 11, 2, 17, 28, 3020 }, // l
+    { 19, 12, 24, 3, 12, 53, 3048 }, // m
+    { 11, 12, 17, 3, 12, 32, 3101 }, // n
+    { 12, 12, 17, 3, 12, 34, 3133 }, // o
+    { 13, 18, 17, 2, 12, 46, 3167 }, // p
+    { 14, 18, 20, 3, 13, 49, 3213 }, // q
+    { 8, 12, 14, 3, 12, 22, 3262 }, // r
+    { 10, 12, 16, 3, 12, 26, 3284 }, // s
+    { 9, 16, 15, 3, 16, 27, 3310 }, // t
+    { 11, 12, 17, 3, 12, 35, 3337 }, // u
+    { 13, 12, 19, 3, 12, 33, 3372 }, // v
+    { 16, 12, 22, 3, 12, 41, 3405 }, // w
+    { 13, 12, 19, 3, 12, 32, 3446 }, // x
+    { 12, 18, 17, 3, 12, 41, 3478 }, // y
+    { 11, 12, 17, 3, 12, 28, 3519 }, // z
+    { 10, 20, 12, 1, 16, 31, 3547 }, // {
+    { 3, 18, 5, 1, 15, 27, 3578 }, // |
+    { 10, 20, 12, 1, 16, 32, 3605 }, // }
+    { 8, 5, 10, 1, 16, 14, 3637 }, // ~
+    { 0, 0, 18, 0, 0, 0, 3651 }, //  
+    { 6, 22, 7, 0, 16, 27, 3651 }, // ¡
+    { 10, 19, 16, 3, 16, 43, 3678 }, // ¢
+    { 14, 20, 15, 0, 20, 42, 3721 }, // £
+    { 12, 11, 14, 1, 13, 28, 3763 }, // ¤
+    { 14, 18, 16, 1, 16, 45, 3791 }, // ¥
+    { 3, 18, 5, 1, 15, 23, 3836 }, // ¦
+    { 12, 19, 17, 3, 17, 46, 3859 }, // §
+    { 10, 4, 12, 1, 16, 13, 3905 }, // ¨
+    { 9, 8, 11, 1, 19, 26, 3918 }, // ©
+    { 7, 8, 10, 2, 16, 18, 3944 }, // ª
+    { 11, 10, 13, 1, 10, 29, 3962 }, // «
+    { 11, 6, 13, 1, 7, 13, 3991 }, // ¬
+    { 10, 3, 12, 1, 8, 5, 4004 }, // ­
+    { 9, 8, 11, 1, 22, 29, 4009 }, // ®
+    { 9, 3, 11, 1, 15, 3, 4038 }, // ¯
+    { 10, 10, 12, 1, 17, 26, 4041 }, // °
+    { 11, 12, 13, 1, 11, 22, 4067 }, // ±
+    { 6, 8, 7, 0, 17, 16, 4089 }, // ²
+    { 6, 8, 7, 0, 17, 16, 4105 }, // ³
+    { 4, 5, 6, 1, 17, 7, 4121 }, // ´
+    { 12, 14, 17, 2, 12, 41, 4128 }, // µ
+    { 11, 17, 13, 1, 15, 53, 4169 }, // ¶
+    { 4, 4, 6, 1, 9, 6, 4222 }, // ·
+    { 5, 6, 7, 1, 1, 8, 4228 }, // ¸
+    { 6, 9, 7, 0, 18, 14, 4236 }, // ¹
+    { 7, 7, 10, 2, 15, 17, 4250 }, // º
+    { 11, 10, 13, 1, 10, 31, 4267 }, // »
+    { 18, 20, 23, 3, 19, 72, 4298 }, // ¼
+    { 18, 20, 23, 3, 18, 67, 4370 }, // ½
+    { 19, 19, 23, 2, 18, 77, 4437 }, // ¾
+    { 12, 23, 13, 0, 12, 39, 4514 }, // ¿
+    { 17, 24, 24, 3, 24, 65, 4553 }, // À
+    { 17, 27, 24, 3, 27, 68, 4618 }, // Á
+    { 17, 25, 24, 3, 25, 71, 4686 }, // Â
+    { 17, 24, 24, 3, 24, 73, 4757 }, // Ã
+    { 17, 24, 24, 3, 24, 72, 4830 }, // Ä
+    { 17, 25, 24, 3, 25, 67, 4902 }, // Å
+    { 24, 19, 30, 3, 18, 73, 4969 }, // Æ
+    { 14, 24, 21, 3, 19, 54, 5042 }, // Ç
+    { 13, 23, 19, 3, 23, 55, 5096 }, // È
+    { 13, 27, 19, 3, 27, 59, 5151 }, // É
+    { 13, 24, 19, 3, 24, 61, 5210 }, // Ê
+    { 13, 24, 19, 3, 24, 62, 5271 }, // Ë
+    { 7, 25, 10, 0, 25, 35, 5333 }, // Ì
+    { 5, 29, 10, 2, 29, 34, 5368 }, // Í
+    { 9, 26, 10, 0, 26, 38, 5402 }, // Î
+    { 11, 25, 11, -1, 25, 40, 5440 }, // Ï
+    { 19, 18, 23, 1, 18, 59, 5480 }, // Ð
+    { 16, 23, 22, 3, 23, 80, 5539 }, // Ñ
+    { 17, 24, 24, 3, 23, 68, 5619 }, // Ò
+    { 17, 28, 24, 3, 27, 72, 5687 }, // Ó
+    { 17, 25, 24, 3, 24, 71, 5759 }, // Ô
+    { 17, 24, 24, 3, 23, 76, 5830 }, // Õ
+    { 17, 24, 24, 3, 23, 74, 5906 }, // Ö
+    { 10, 6, 12, 1, 8, 18, 5980 }, // ×
+    { 26, 38, 26, -1, 28, 128, 5998 }, // Ø
+    { 15, 25, 22, 3, 24, 66, 6126 }, // Ù
+    { 15, 28, 22, 3, 27, 68, 6192 }, // Ú
+    { 15, 26, 22, 3, 25, 69, 6260 }, // Û
+    { 15, 25, 22, 3, 24, 71, 6329 }, // Ü
+    { 16, 28, 22, 3, 28, 61, 6400 }, // Ý
+    { 10, 17, 12, 1, 17, 31, 6461 }, // Þ
+    { 12, 17, 14, 1, 17, 48, 6492 }, // ß
+    { 12, 17, 17, 2, 17, 44, 6540 }, // à
+    { 12, 21, 17, 2, 21, 47, 6584 }, // á
+    { 12, 18, 17, 2, 18, 48, 6631 }, // â
+    { 12, 17, 17, 2, 17, 50, 6679 }, // ã
+    { 12, 17, 17, 2, 17, 49, 6729 }, // ä
+    { 12, 18, 17, 2, 18, 45, 6778 }, // å
+    { 21, 13, 26, 2, 13, 58, 6823 }, // æ
+    { 10, 18, 16, 3, 13, 32, 6881 }, // ç
+    { 12, 19, 17, 3, 19, 45, 6913 }, // è
+    { 12, 23, 17, 3, 23, 50, 6958 }, // é
+    { 12, 20, 17, 3, 20, 49, 7008 }, // ê
+    { 12, 20, 17, 3, 20, 52, 7057 }, // ë
+    { 7, 17, 9, 0, 17, 26, 7109 }, // ì
+    { 4, 21, 9, 3, 21, 27, 7135 }, // í
+    { 9, 18, 10, 0, 18, 31, 7162 }, // î
+    { 11, 18, 11, -1, 18, 35, 7193 }, // ï
+    { 16, 17, 18, 1, 17, 46, 7228 }, // ð
+    { 11, 18, 17, 3, 18, 47, 7274 }, // ñ
+    { 12, 19, 17, 3, 19, 43, 7321 }, // ò
+    { 12, 23, 17, 3, 23, 47, 7364 }, // ó
+    { 12, 20, 17, 3, 20, 48, 7411 }, // ô
+    { 12, 19, 17, 3, 19, 48, 7459 }, // õ
+    { 12, 19, 17, 3, 19, 49, 7507 }, // ö
+    { 14, 13, 16, 1, 13, 25, 7556 }, // ÷
+    { 13, 33, 17, 2, 22, 82, 7581 }, // ø
+    { 11, 18, 17, 3, 18, 44, 7663 }, // ù
+    { 11, 22, 17, 3, 22, 46, 7707 }, // ú
+    { 11, 18, 17, 3, 18, 47, 7753 }, // û
+    { 11, 18, 17, 3, 18, 49, 7800 }, // ü
+    { 12, 29, 17, 3, 23, 54, 7849 }, // ý
+    { 10, 21, 12, 1, 17, 47, 7903 }, // þ
+    { 12, 26, 17, 3, 20, 57, 7950 }, // ÿ
+    { 17, 23, 24, 3, 23, 65, 8007 }, // Ā
+    { 12, 16, 17, 2, 16, 43, 8072 }, // ā
+    { 17, 26, 24, 3, 26, 70, 8115 }, // Ă
+    { 12, 19, 17, 2, 19, 48, 8185 }, // ă
+    { 17, 23, 24, 3, 18, 65, 8233 }, // Ą
+    { 13, 17, 17, 2, 13, 45, 8298 }, // ą
+    { 14, 29, 21, 3, 28, 57, 8343 }, // Ć
+    { 10, 21, 16, 3, 20, 33, 8400 }, // ć
+    { 14, 27, 21, 3, 26, 59, 8433 }, // Ĉ
+    { 10, 19, 16, 3, 18, 36, 8492 }, // ĉ
+    { 14, 27, 21, 3, 26, 56, 8528 }, // Ċ
+    { 10, 20, 16, 3, 19, 34, 8584 }, // ċ
+    { 14, 28, 21, 3, 27, 59, 8618 }, // Č
+    { 10, 21, 16, 3, 20, 37, 8677 }, // č
+    { 17, 26, 23, 3, 26, 73, 8714 }, // Ď
+    { 17, 19, 20, 2, 18, 58, 8787 }, // ď
+    { 19, 18, 23, 1, 18, 59, 8845 }, // Đ
+    { 16, 19, 19, 2, 18, 51, 8904 }, // đ
+    { 13, 23, 19, 3, 23, 56, 8955 }, // Ē
+    { 12, 19, 17, 3, 19, 47, 9011 }, // ē
+    { 13, 26, 19, 3, 26, 61, 9058 }, // Ĕ
+    { 12, 22, 17, 3, 22, 51, 9119 }, // ĕ
+    { 13, 25, 19, 3, 25, 58, 9170 }, // Ė
+    { 12, 21, 17, 3, 21, 48, 9228 }, // ė
+    { 13, 23, 19, 3, 18, 57, 9276 }, // Ę
+    { 12, 19, 17, 3, 13, 48, 9333 }, // ę
+    { 13, 25, 19, 3, 25, 59, 9381 }, // Ě
+    { 12, 22, 17, 3, 22, 49, 9440 }, // ě
+    { 17, 24, 24, 3, 24, 65, 9489 }, // Ĝ
+    { 11, 23, 17, 3, 18, 57, 9554 }, // ĝ
+    { 17, 26, 24, 3, 26, 67, 9611 }, // Ğ
+    { 11, 25, 17, 3, 20, 61, 9678 }, // ğ
+    { 17, 25, 24, 3, 25, 61, 9739 }, // Ġ
+    { 11, 24, 17, 3, 19, 55, 9800 }, // ġ
+    { 17, 28, 24, 3, 19, 67, 9855 }, // Ģ
+    { 11, 25, 17, 3, 20, 59, 9922 }, // ģ
+    { 16, 24, 22, 3, 24, 61, 9981 }, // Ĥ
+    { 13, 23, 17, 1, 23, 59, 10042 }, // ĥ
+    { 17, 18, 22, 2, 18, 51, 10101 }, // Ħ
+    { 14, 18, 17, 0, 18, 51, 10152 }, // ħ
+    { 8, 26, 10, 0, 26, 39, 10203 }, // Ĩ
+    { 8, 18, 10, 1, 18, 31, 10242 }, // ĩ
+    { 11, 24, 11, -1, 24, 36, 10273 }, // Ī
+    { 10, 17, 11, 0, 17, 29, 10309 }, // ī
+    { 5, 23, 13, 5, 18, 36, 10338 }, // Į
+    { 5, 23, 9, 2, 18, 33, 10374 }, // į
+    { 5, 26, 10, 2, 26, 33, 10407 }, // İ
+    { 4, 12, 9, 3, 12, 20, 10440 }, // ı
+    { 14, 23, 19, 2, 18, 61, 10460 }, // Ĳ
+    { 15, 24, 19, 3, 18, 65, 10521 }, // ĳ
+    { 10, 27, 16, 3, 22, 48, 10586 }, // Ĵ
+    { 11, 23, 15, 3, 17, 41, 10634 }, // ĵ
+    { 15, 25, 21, 3, 18, 63, 10675 }, // Ķ
+    { 11, 26, 17, 3, 17, 50, 10738 }, // ķ
+    { 9, 12, 13, 2, 12, 30, 10788 }, // ĸ
+    { 12, 25, 19, 3, 25, 48, 10818 }, // Ĺ
+    { 7, 25, 11, 2, 25, 36, 10866 }, // ĺ
+    { 12, 27, 19, 3, 18, 50, 10902 }, // Ļ
+    { 7, 25, 11, 2, 17, 38, 10952 }, // ļ
+    { 12, 18, 19, 3, 18, 45, 10990 }, // Ľ
+    { 9, 18, 12, 2, 18, 36, 11035 }, // ľ
+    { 12, 18, 19, 3, 18, 42, 11071 }, // Ŀ
+    { 10, 17, 13, 2, 17, 33, 11113 }, // ŀ
+    { 20, 29, 19, -5, 23, 79, 11146 }, // Ł
+    { 14, 17, 11, -4, 17, 38, 11225 }, // ł
+    { 16, 25, 22, 3, 25, 78, 11263 }, // Ń
+    { 11, 20, 17, 3, 20, 41, 11341 }, // ń
+    { 16, 25, 22, 3, 18, 79, 11382 }, // Ņ
+    { 11, 19, 17, 3, 12, 42, 11461 }, // ņ
+    { 16, 25, 22, 3, 25, 82, 11503 }, // Ň
+    { 11, 20, 17, 3, 20, 44, 11585 }, // ň
+    { 12, 22, 14, 1, 22, 52, 11629 }, // ŉ
+    { 16, 22, 22, 3, 18, 75, 11681 }, // Ŋ
+    { 11, 16, 17, 3, 12, 38, 11756 }, // ŋ
+    { 17, 23, 24, 3, 22, 68, 11794 }, // Ō
+    { 12, 18, 17, 3, 18, 43, 11862 }, // ō
+    { 17, 27, 24, 3, 26, 74, 11905 }, // Ŏ
+    { 12, 22, 17, 3, 22, 49, 11979 }, // ŏ
+    { 18, 25, 24, 3, 24, 74, 12028 }, // Ő
+    { 16, 20, 18, 1, 20, 53, 12102 }, // ő
+    { 24, 19, 28, 3, 19, 74, 12155 }, // Œ
+    { 20, 13, 24, 3, 13, 55, 12229 }, // œ
+    { 14, 25, 20, 3, 25, 66, 12284 }, // Ŕ
+    { 8, 18, 14, 3, 18, 29, 12350 }, // ŕ
+    { 14, 28, 20, 3, 18, 70, 12379 }, // Ŗ
+    { 9, 23, 14, 2, 12, 34, 12449 }, // ŗ
+    { 14, 25, 20, 3, 25, 69, 12483 }, // Ř
+    { 10, 18, 14, 1, 18, 36, 12552 }, // ř
+    { 17, 28, 23, 3, 27, 66, 12588 }, // Ś
+    { 10, 20, 16, 3, 20, 35, 12654 }, // ś
+    { 17, 26, 23, 3, 25, 67, 12689 }, // Ŝ
+    { 10, 18, 16, 3, 18, 38, 12756 }, // ŝ
+    { 17, 23, 23, 3, 18, 62, 12794 }, // Ş
+    { 10, 18, 16, 3, 12, 34, 12856 }, // ş
+    { 17, 27, 23, 3, 26, 68, 12890 }, // Š
+    { 10, 20, 16, 3, 20, 38, 12958 }, // š
+    { 16, 22, 22, 3, 18, 56, 12996 }, // Ţ
+    { 9, 20, 15, 3, 16, 35, 13052 }, // ţ
+    { 16, 24, 22, 3, 24, 60, 13087 }, // Ť
+    { 10, 18, 15, 3, 18, 36, 13147 }, // ť
+    { 16, 18, 22, 3, 18, 49, 13183 }, // Ŧ
+    { 10, 16, 15, 2, 16, 29, 13232 }, // ŧ
+    { 15, 26, 22, 3, 25, 74, 13261 }, // Ũ
+    { 11, 19, 17, 3, 19, 48, 13335 }, // ũ
+    { 15, 24, 22, 3, 23, 65, 13383 }, // Ū
+    { 11, 17, 17, 3, 17, 44, 13448 }, // ū
+    { 15, 28, 22, 3, 27, 68, 13492 }, // Ŭ
+    { 11, 20, 17, 3, 20, 47, 13560 }, // ŭ
+    { 15, 27, 22, 3, 26, 68, 13607 }, // Ů
+    { 11, 20, 17, 3, 20, 48, 13675 }, // ů
+    { 17, 26, 22, 3, 25, 72, 13723 }, // Ű
+    { 16, 19, 18, 1, 19, 51, 13795 }, // ű
+    { 15, 23, 22, 3, 18, 65, 13846 }, // Ų
+    { 11, 17, 17, 3, 12, 44, 13911 }, // ų
+    { 23, 24, 30, 3, 24, 90, 13955 }, // Ŵ
+    { 16, 19, 22, 3, 19, 55, 14045 }, // ŵ
+    { 16, 25, 22, 3, 25, 63, 14100 }, // Ŷ
+    { 12, 26, 17, 3, 20, 54, 14163 }, // ŷ
+    { 16, 25, 22, 3, 25, 63, 14217 }, // Ÿ
+    { 17, 25, 24, 3, 25, 55, 14280 }, // Ź
+    { 11, 20, 17, 3, 20, 38, 14335 }, // ź
+    { 17, 24, 24, 3, 24, 53, 14373 }, // Ż
+    { 11, 19, 17, 3, 19, 36, 14426 }, // ż
+    { 17, 25, 24, 3, 25, 58, 14462 }, // Ž
+    { 11, 20, 17, 3, 20, 40, 14520 }, // ž
+    { 7, 17, 11, 3, 17, 31, 14560 }, // ſ
+    { 19, 21, 24, 3, 20, 68, 14591 }, // Ơ
+    { 13, 13, 17, 3, 13, 38, 14659 }, // ơ
+    { 15, 18, 19, 1, 18, 47, 14697 }, // Ƥ
+    { 13, 22, 17, 2, 16, 57, 14744 }, // ƥ
+    { 10, 16, 12, 1, 15, 33, 14801 }, // Ʃ
+    { 16, 18, 22, 3, 18, 49, 14834 }, // Ƭ
+    { 9, 18, 15, 3, 18, 32, 14883 }, // ƭ
+    { 16, 22, 22, 3, 18, 57, 14915 }, // Ʈ
+    { 17, 22, 22, 3, 21, 61, 14972 }, // Ư
+    { 13, 14, 17, 3, 14, 40, 15033 }, // ư
+    { 7, 4, 9, 1, 16, 6, 15073 }, // ̀
+    { 4, 5, 6, 1, 17, 7, 15079 }, // ́
+    { 9, 5, 11, 1, 1, 10, 15086 }, // ̂
+    { 8, 5, 10, 1, 16, 14, 15096 }, // ̃
+    { 11, 3, 13, 1, 14, 8, 15110 }, // ̄
+    { 14, 3, 16, 1, 18, 8, 15118 }, // ̅
+    { 9, 5, 11, 1, 16, 11, 15126 }, // ̆
+    { 4, 4, 6, 1, 16, 6, 15137 }, // ̇
+    { 10, 4, 12, 1, 16, 13, 15143 }, // ̈
+    { 5, 4, 6, 0, 13, 7, 15156 }, // ̉
+    { 5, 5, 7, 1, 16, 9, 15163 }, // ̊
+    { 15, 4, 17, 1, 16, 12, 15172 }, // ̋
+    { 9, 5, 11, 1, 16, 10, 15184 }, // ̌
+    { 15, 4, 12, -4, 17, 11, 15194 }, // ̏
+    { 6, 6, 7, 0, 16, 9, 15205 }, // ̒
+    { 5, 6, 7, 1, 15, 10, 15214 }, // ̓
+    { 6, 6, 7, 0, 15, 10, 15224 }, // ̔
+    { 4, 5, 6, 1, -1, 7, 15234 }, // ̘
+    { 4, 5, 6, 1, -1, 7, 15241 }, // ̙
+    { 9, 5, 11, 1, 17, 12, 15248 }, // ̚
+    { 4, 5, 6, 1, 13, 6, 15260 }, // ̛
+    { 3, 5, 5, 1, -1, 6, 15266 }, // ̜
+    { 5, 4, 7, 1, 3, 5, 15272 }, // ̝
+    { 5, 4, 7, 1, 0, 5, 15277 }, // ̞
+    { 5, 5, 7, 1, -2, 6, 15282 }, // ̟
+    { 10, 3, 12, 1, -3, 8, 15288 }, // ̠
+    { 4, 4, 6, 1, 1, 6, 15296 }, // ̣
+    { 10, 4, 12, 1, 0, 12, 15302 }, // ̤
+    { 5, 5, 7, 1, 16, 9, 15314 }, // ̥
+    { 5, 6, 7, 1, 3, 10, 15323 }, // ̦
+    { 5, 6, 7, 1, 1, 8, 15333 }, // ̧
+    { 5, 6, 7, 1, 1, 8, 15341 }, // ̨
+    { 3, 6, 5, 1, -1, 9, 15349 }, // ̩
+    { 7, 4, 9, 1, -1, 8, 15358 }, // ̪
+    { 9, 5, 11, 1, 0, 10, 15366 }, // ̬
+    { 9, 5, 11, 1, -1, 10, 15376 }, // ̭
+    { 8, 5, 10, 1, 16, 14, 15386 }, // ̰
+    { 9, 3, 11, 1, 15, 3, 15400 }, // ̱
+    { 9, 3, 11, 1, -1, 6, 15403 }, // ̲
+    { 8, 5, 10, 1, 16, 14, 15409 }, // ̴
+    { 10, 3, 12, 1, 8, 5, 15423 }, // ̵
+    { 3, 5, 5, 1, -1, 6, 15428 }, // ̹
+    { 7, 4, 9, 1, -1, 8, 15434 }, // ̺
+    { 7, 5, 9, 1, 0, 12, 15442 }, // ̻
+    { 7, 4, 9, 1, 0, 13, 15454 }, // ̼
+    { 5, 5, 8, 2, 16, 8, 15467 }, // ̽
+    { 8, 5, 10, 1, 16, 14, 15475 }, // ͂
+    { 3, 4, 5, 1, 17, 5, 15489 }, // ̓
+    { 10, 10, 12, 1, 22, 21, 15494 }, // ̈́
+    { 7, 4, 9, 1, 16, 8, 15515 }, // ͆
+    { 10, 8, 12, 1, 0, 16, 15523 }, // ͇
+    { 8, 6, 10, 1, 0, 16, 15539 }, // ͈
+    { 7, 6, 9, 1, -1, 11, 15555 }, // ͉
+    { 8, 12, 10, 1, 20, 23, 15566 }, // ͊
+    { 17, 9, 19, 1, 19, 31, 15589 }, // ͋
+    { 12, 11, 15, 2, 12, 30, 15620 }, // ͌
+    { 10, 5, 13, 2, -2, 9, 15650 }, // ͍
+    { 4, 3, 6, 1, 2, 5, 15659 }, // ͎
+    { 17, 4, 19, 1, 0, 15, 15664 }, // ͜
+    { 17, 4, 19, 1, 16, 14, 15679 }, // ͡
+    { 21, 5, 23, 1, -1, 20, 15693 }, // ͢
+    { 17, 18, 24, 3, 18, 55, 15713 }, // Α
+    { 14, 18, 20, 3, 18, 55, 15768 }, // Β
+    { 10, 17, 12, 1, 16, 32, 15823 }, // Γ
+    { 16, 16, 18, 1, 16, 45, 15855 }, // Δ
+    { 13, 18, 19, 3, 18, 47, 15900 }, // Ε
+    { 17, 18, 24, 3, 18, 43, 15947 }, // Ζ
+    { 16, 18, 22, 3, 18, 49, 15990 }, // Η
+    { 17, 19, 24, 3, 18, 64, 16039 }, // Θ
+    { 5, 18, 10, 2, 18, 26, 16103 }, // Ι
+    { 15, 18, 21, 3, 18, 49, 16129 }, // Κ
+    { 18, 18, 24, 3, 18, 53, 16178 }, // Λ
+    { 19, 18, 26, 3, 18, 83, 16231 }, // Μ
+    { 16, 18, 22, 3, 18, 67, 16314 }, // Ν
+    { 14, 15, 16, 1, 15, 30, 16381 }, // Ξ
+    { 17, 19, 24, 3, 18, 58, 16411 }, // Ο
+    { 11, 15, 13, 1, 15, 54, 16469 }, // Π
+    { 13, 18, 19, 3, 18, 42, 16523 }, // Ρ
+    { 10, 16, 12, 1, 15, 33, 16565 }, // Σ
+    { 16, 18, 22, 3, 18, 48, 16598 }, // Τ
+    { 16, 18, 22, 3, 18, 48, 16646 }, // Υ
+    { 21, 22, 29, 4, 20, 80, 16694 }, // Φ
+    { 17, 18, 24, 3, 18, 51, 16774 }, // Χ
+    { 15, 18, 17, 1, 16, 58, 16825 }, // Ψ
+    { 16, 17, 18, 1, 16, 54, 16883 }, // Ω
+    { 15, 14, 20, 2, 13, 41, 16937 }, // α
+    { 12, 24, 14, 1, 20, 67, 16978 }, // β
+    { 12, 18, 14, 1, 12, 41, 17045 }, // γ
+    { 12, 18, 14, 1, 18, 47, 17086 }, // δ
+    { 9, 11, 11, 1, 11, 24, 17133 }, // ε
+    { 11, 18, 12, 0, 15, 34, 17157 }, // ζ
+    { 13, 19, 15, 1, 13, 50, 17191 }, // η
+    { 12, 16, 14, 1, 16, 43, 17241 }, // θ
+    { 5, 14, 11, 3, 14, 20, 17284 }, // ι
+    { 10, 13, 15, 2, 13, 31, 17304 }, // κ
+    { 12, 17, 16, 2, 17, 39, 17335 }, // λ
+    { 12, 14, 17, 2, 12, 41, 17374 }, // μ
+    { 12, 12, 14, 1, 12, 29, 17415 }, // ν
+    { 11, 18, 12, 0, 15, 34, 17444 }, // ξ
+    { 12, 12, 17, 3, 12, 34, 17478 }, // ο
+    { 13, 12, 15, 1, 11, 40, 17512 }, // π
+    { 13, 17, 15, 1, 12, 45, 17552 }, // ρ
+    { 9, 14, 11, 1, 15, 23, 17597 }, // ς
+    { 14, 12, 18, 3, 12, 36, 17620 }, // σ
+    { 12, 12, 14, 1, 11, 27, 17656 }, // τ
+    { 10, 13, 12, 1, 12, 35, 17683 }, // υ
+    { 17, 26, 24, 3, 23, 86, 17718 }, // φ
+    { 15, 16, 17, 1, 12, 43, 17804 }, // χ
+    { 12, 20, 14, 1, 15, 59, 17847 }, // ψ
+    { 15, 12, 17, 1, 11, 41, 17906 }, // ω
+    { 17, 25, 24, 3, 18, 67, 17947 }, // Ạ
+    { 12, 19, 17, 2, 13, 46, 18014 }, // ạ
+    { 17, 26, 24, 3, 26, 68, 18060 }, // Ả
+    { 12, 19, 17, 2, 19, 45, 18128 }, // ả
+    { 17, 29, 24, 3, 29, 77, 18173 }, // Ấ
+    { 13, 24, 17, 2, 24, 57, 18250 }, // ấ
+    { 18, 27, 24, 2, 27, 80, 18307 }, // Ầ
+    { 14, 20, 17, 0, 20, 54, 18387 }, // ầ
+    { 17, 29, 24, 3, 29, 79, 18441 }, // Ẩ
+    { 12, 21, 17, 2, 21, 54, 18520 }, // ẩ
+    { 17, 29, 24, 3, 29, 84, 18574 }, // Ẫ
+    { 12, 22, 17, 2, 22, 61, 18658 }, // ẫ
+    { 17, 32, 24, 3, 25, 83, 18719 }, // Ậ
+    { 12, 24, 17, 2, 18, 58, 18802 }, // ậ
+    { 17, 34, 24, 3, 34, 83, 18860 }, // Ắ
+    { 12, 27, 17, 2, 27, 58, 18943 }, // ắ
+    { 17, 32, 24, 3, 32, 79, 19001 }, // Ằ
+    { 12, 25, 17, 2, 25, 57, 19080 }, // ằ
+    { 17, 33, 24, 3, 33, 82, 19137 }, // Ẳ
+    { 12, 27, 17, 2, 27, 63, 19219 }, // ẳ
+    { 17, 32, 24, 3, 32, 88, 19282 }, // Ẵ
+    { 12, 25, 17, 2, 25, 63, 19370 }, // ẵ
+    { 17, 33, 24, 3, 26, 82, 19433 }, // Ặ
+    { 12, 25, 17, 2, 19, 58, 19515 }, // ặ
+    { 13, 23, 19, 3, 18, 56, 19573 }, // Ẹ
+    { 12, 19, 17, 3, 13, 46, 19629 }, // ẹ
+    { 13, 25, 19, 3, 25, 58, 19675 }, // Ẻ
+    { 12, 21, 17, 3, 21, 49, 19733 }, // ẻ
+    { 13, 25, 19, 3, 25, 61, 19782 }, // Ẽ
+    { 12, 20, 17, 3, 20, 50, 19843 }, // ẽ
+    { 13, 28, 19, 3, 28, 68, 19893 }, // Ế
+    { 13, 21, 17, 3, 21, 57, 19961 }, // ế
+    { 17, 25, 19, -1, 25, 69, 20018 }, // Ề
+    { 15, 22, 17, 0, 22, 59, 20087 }, // ề
+    { 14, 28, 19, 3, 28, 70, 20146 }, // Ể
+    { 12, 24, 17, 3, 24, 59, 20216 }, // ể
+    { 13, 29, 19, 3, 29, 73, 20275 }, // Ễ
+    { 12, 25, 17, 3, 25, 61, 20348 }, // ễ
+    { 13, 29, 19, 3, 24, 69, 20409 }, // Ệ
+    { 12, 26, 17, 3, 20, 58, 20478 }, // ệ
+    { 5, 27, 10, 2, 27, 34, 20536 }, // Ỉ
+    { 6, 19, 9, 2, 19, 27, 20570 }, // ỉ
+    { 5, 24, 10, 2, 18, 33, 20597 }, // Ị
+    { 5, 24, 9, 2, 18, 33, 20630 }, // ị
+    { 17, 24, 24, 3, 18, 68, 20663 }, // Ọ
+    { 12, 19, 17, 3, 12, 44, 20731 }, // ọ
+    { 17, 26, 24, 3, 25, 71, 20775 }, // Ỏ
+    { 12, 21, 17, 3, 21, 45, 20846 }, // ỏ
+    { 21, 25, 25, 3, 24, 80, 20891 }, // Ố
+    { 14, 20, 18, 3, 20, 55, 20971 }, // ố
+    { 18, 26, 24, 2, 25, 78, 21026 }, // Ồ
+    { 15, 22, 17, 0, 22, 58, 21104 }, // ồ
+    { 17, 28, 24, 3, 27, 80, 21162 }, // Ổ
+    { 12, 24, 17, 3, 24, 55, 21242 }, // ổ
+    { 17, 29, 24, 3, 28, 87, 21297 }, // Ỗ
+    { 12, 24, 17, 3, 24, 59, 21384 }, // ỗ
+    { 17, 30, 24, 3, 24, 81, 21443 }, // Ộ
+    { 12, 26, 17, 3, 20, 56, 21524 }, // ộ
+    { 19, 28, 24, 3, 27, 80, 21580 }, // Ớ
+    { 13, 22, 17, 3, 22, 50, 21660 }, // ớ
+    { 19, 26, 24, 3, 25, 79, 21710 }, // Ờ
+    { 13, 20, 17, 3, 20, 48, 21789 }, // ờ
+    { 19, 27, 24, 3, 26, 80, 21837 }, // Ở
+    { 13, 21, 17, 3, 21, 49, 21917 }, // ở
+    { 19, 26, 24, 3, 25, 85, 21966 }, // Ỡ
+    { 13, 20, 17, 3, 20, 53, 22051 }, // ỡ
+    { 19, 26, 24, 3, 20, 78, 22104 }, // Ợ
+    { 13, 20, 17, 3, 13, 48, 22182 }, // ợ
+    { 15, 24, 22, 3, 18, 65, 22230 }, // Ụ
+    { 11, 18, 17, 3, 12, 45, 22295 }, // ụ
+    { 15, 27, 22, 3, 26, 69, 22340 }, // Ủ
+    { 11, 19, 17, 3, 19, 44, 22409 }, // ủ
+    { 17, 27, 22, 3, 26, 71, 22453 }, // Ứ
+    { 13, 20, 17, 3, 20, 50, 22524 }, // ứ
+    { 17, 26, 22, 3, 25, 68, 22574 }, // Ừ
+    { 13, 18, 17, 3, 18, 47, 22642 }, // ừ
+    { 17, 27, 22, 3, 26, 72, 22689 }, // Ử
+    { 13, 19, 17, 3, 19, 49, 22761 }, // ử
+    { 17, 26, 22, 3, 25, 79, 22810 }, // Ữ
+    { 13, 19, 17, 3, 19, 53, 22889 }, // ữ
+    { 17, 27, 22, 3, 21, 71, 22942 }, // Ự
+    { 13, 20, 17, 3, 14, 51, 23013 }, // ự
+    { 16, 25, 22, 3, 25, 59, 23064 }, // Ỳ
+    { 12, 25, 17, 3, 19, 51, 23123 }, // ỳ
+    { 16, 27, 22, 3, 18, 60, 23174 }, // Ỵ
+    { 14, 18, 18, 3, 12, 49, 23234 }, // ỵ
+    { 16, 26, 22, 3, 26, 59, 23283 }, // Ỷ
+    { 12, 27, 17, 3, 21, 53, 23342 }, // ỷ
+    { 16, 25, 22, 3, 25, 66, 23395 }, // Ỹ
+    { 12, 27, 17, 3, 21, 56, 23461 }, // ỹ
+    { 0, 0, 17, 0, 0, 0, 23517 }, //  
+    { 0, 0, 28, 0, 0, 0, 23517 }, //  
+    { 0, 0, 17, 0, 0, 0, 23517 }, //  
+    { 0, 0, 28, 0, 0, 0, 23517 }, //  
+    { 0, 0, 14, 0, 0, 0, 23517 }, //  
+    { 0, 0, 12, 0, 0, 0, 23517 }, //  
+    { 0, 0, 10, 0, 0, 0, 23517 }, //  
+    { 0, 0, 14, 0, 0, 0, 23517 }, //  
+    { 0, 0, 5, 0, 0, 0, 23517 }, //  
+    { 0, 0, 11, 0, 0, 0, 23517 }, //  
+    { 0, 0, 10, 0, 0, 0, 23517 }, //  
+    { 0, 0, 7, 0, 0, 0, 23517 }, // ​
+    { 0, 0, 1, 0, 0, 0, 23517 }, // ‌
+    { 0, 0, 1, 0, 0, 0, 23517 }, // ‍
+    { 0, 0, 1, 0, 0, 0, 23517 }, // ‎
+    { 0, 0, 1, 0, 0, 0, 23517 }, // ‏
+    { 10, 3, 12, 1, 8, 5, 23517 }, // ‐
+    { 10, 3, 12, 1, 8, 5, 23522 }, // ‑
+    { 15, 3, 17, 1, 8, 7, 23527 }, // ‒
+    { 14, 3, 17, 1, 8, 6, 23534 }, // –
+    { 21, 3, 23, 1, 8, 8, 23540 }, // —
+    { 21, 3, 23, 1, 8, 8, 23548 }, // ―
+    { 9, 18, 11, 1, 15, 53, 23556 }, // ‖
+    { 16, 8, 18, 1, -1, 16, 23609 }, // ‗
+    { 5, 6, 7, 1, 18, 9, 23625 }, // ‘
+    { 5, 6, 7, 1, 18, 10, 23634 }, // ’
+    { 5, 6, 7, 1, 3, 10, 23644 }, // ‚
+    { 5, 6, 7, 1, 18, 9, 23654 }, // ‛
+    { 10, 6, 12, 1, 18, 18, 23663 }, // “
+    { 10, 6, 12, 1, 18, 18, 23681 }, // ”
+    { 5, 6, 7, 1, 3, 10, 23699 }, // „
+    { 10, 6, 12, 1, 18, 18, 23709 }, // ‟
+    { 12, 28, 13, 0, 22, 58, 23727 }, // †
+    { 11, 28, 13, 1, 22, 52, 23785 }, // ‡
+    { 13, 12, 13, -1, 14, 28, 23837 }, // •
+    { 6, 7, 8, 1, 9, 10, 23865 }, // ‣
+    { 4, 4, 6, 1, 4, 6, 23875 }, // ․
+    { 4, 4, 6, 1, 4, 6, 23881 }, // ‥
+    { 18, 4, 20, 1, 4, 19, 23887 }, // …
+    { 3, 3, 5, 1, 8, 3, 23906 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 23909 }, //  
+    { 13, 18, 23, 5, 16, 64, 23909 }, // ‰
+    { 5, 6, 7, 1, 18, 10, 23973 }, // ′
+    { 10, 6, 12, 1, 18, 18, 23983 }, // ″
+    { 16, 7, 18, 1, 18, 26, 24001 }, // ‴
+    { 5, 6, 7, 1, 17, 8, 24027 }, // ‵
+    { 10, 6, 11, 0, 17, 16, 24035 }, // ‶
+    { 16, 7, 18, 1, 18, 26, 24051 }, // ‷
+    { 9, 4, 12, 1, 17, 9, 24077 }, // ‸
+    { 7, 10, 9, 1, 11, 17, 24086 }, // ‹
+    { 7, 10, 9, 1, 11, 13, 24103 }, // ›
+    { 22, 21, 28, 4, 19, 80, 24116 }, // ※
+    { 6, 21, 7, 0, 21, 26, 24196 }, // ‼
+    { 11, 26, 16, 2, 25, 59, 24222 }, // ‽
+    { 10, 3, 12, 1, 17, 5, 24281 }, // ‾
+    { 9, 4, 12, 1, 14, 11, 24286 }, // ‿
+    { 14, 14, 17, 1, 19, 48, 24297 }, // ⁂
+    { 13, 17, 23, 5, 16, 34, 24345 }, // ⁄
+    { 23, 24, 26, 2, 24, 88, 24379 }, // ⁇
+    { 16, 23, 21, 2, 23, 68, 24467 }, // ⁈
+    { 17, 25, 18, 0, 23, 72, 24535 }, // ⁉
+    { 12, 33, 15, 2, 23, 73, 24607 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 24680 }, //  
+    { 6, 8, 7, 0, 17, 20, 24680 }, // ⁰
+    { 6, 9, 7, 0, 18, 16, 24700 }, // ⁴
+    { 6, 9, 7, 0, 18, 14, 24716 }, // ⁵
+    { 6, 8, 7, 0, 17, 18, 24730 }, // ⁶
+    { 7, 9, 8, 0, 18, 12, 24748 }, // ⁷
+    { 7, 8, 8, 0, 17, 19, 24760 }, // ⁸
+    { 7, 8, 8, 0, 17, 17, 24779 }, // ⁹
+    { 11, 12, 17, 3, 12, 32, 24796 }, // ⁿ
+    { 8, 11, 10, 1, 11, 31, 24828 }, // ₀
+    { 6, 9, 7, 0, 5, 14, 24859 }, // ₁
+    { 6, 9, 7, 0, 5, 18, 24873 }, // ₂
+    { 6, 9, 7, 0, 5, 15, 24891 }, // ₃
+    { 7, 8, 8, 0, 5, 13, 24906 }, // ₄
+    { 6, 8, 7, 0, 5, 13, 24919 }, // ₅
+    { 7, 8, 8, 0, 4, 18, 24932 }, // ₆
+    { 6, 9, 7, 0, 5, 13, 24950 }, // ₇
+    { 7, 9, 8, 0, 5, 20, 24963 }, // ₈
+    { 7, 9, 8, 0, 5, 20, 24983 }, // ₉
+    { 7, 28, 10, 2, 21, 42, 25003 }, // ₍
+    { 7, 28, 9, 0, 21, 43, 25045 }, // ₎
+    { 15, 28, 21, 3, 23, 86, 25088 }, // ₡
+    { 14, 20, 21, 3, 19, 50, 25174 }, // ₢
+    { 14, 20, 15, 0, 20, 44, 25224 }, // ₤
+    { 20, 18, 23, 2, 18, 65, 25268 }, // ₦
+    { 16, 18, 19, 1, 18, 48, 25333 }, // ₧
+    { 21, 18, 25, 3, 18, 75, 25381 }, // ₨
+    { 16, 18, 18, 1, 18, 64, 25456 }, // ₩
+    { 16, 16, 22, 3, 16, 51, 25520 }, // ₪
+    { 14, 17, 16, 1, 17, 50, 25571 }, // ₫
+    { 13, 19, 16, 1, 16, 40, 25621 }, // €
+    { 16, 18, 22, 3, 18, 54, 25661 }, // ₮
+    { 18, 18, 19, 0, 18, 50, 25715 }, // ₱
+    { 17, 25, 24, 3, 22, 78, 25765 }, // ₲
+    { 19, 19, 21, 1, 18, 52, 25843 }, // ₴
+    { 10, 16, 16, 3, 15, 39, 25895 }, // ₵
+    { 16, 19, 22, 3, 19, 41, 25934 }, // ₸
+    { 10, 17, 13, 1, 16, 37, 25975 }, // ₹
+    { 12, 15, 14, 1, 14, 35, 26012 }, // ₺
+    { 13, 16, 14, 0, 16, 58, 26047 }, // ₼
+    { 17, 18, 19, -1, 18, 47, 26105 }, // ₽
+    { 14, 13, 16, 1, 12, 28, 26152 }, // ←
+    { 14, 13, 16, 1, 13, 29, 26180 }, // ↑
+    { 14, 13, 16, 1, 12, 30, 26209 }, // →
+    { 14, 13, 16, 1, 13, 28, 26239 }, // ↓
+    { 16, 11, 19, 1, 11, 35, 26267 }, // ↔
+    { 12, 16, 14, 1, 17, 42, 26302 }, // ↕
+    { 11, 10, 13, 1, 10, 28, 26344 }, // ↖
+    { 11, 10, 13, 1, 10, 27, 26372 }, // ↗
+    { 11, 11, 13, 1, 11, 29, 26399 }, // ↘
+    { 11, 11, 13, 1, 11, 28, 26428 }, // ↙
+    { 16, 13, 18, 1, 12, 28, 26456 }, // ⇐
+    { 17, 15, 19, 1, 15, 58, 26484 }, // ⇑
+    { 16, 13, 18, 1, 12, 26, 26542 }, // ⇒
+    { 17, 16, 19, 1, 15, 64, 26568 }, // ⇓
+    { 18, 13, 20, 1, 12, 43, 26632 }, // ⇔
+    { 14, 17, 16, 1, 11, 60, 26675 }, // ⇕
+    { 12, 17, 14, 1, 17, 45, 26735 }, // ∂
+    { 21, 20, 24, 2, 19, 75, 26780 }, // ∅
+    { 16, 16, 18, 1, 16, 45, 26855 }, // ∆
+    { 13, 15, 15, 1, 15, 49, 26900 }, // ∏
+    { 13, 15, 15, 1, 15, 47, 26949 }, // ∐
+    { 10, 16, 12, 1, 15, 33, 26996 }, // ∑
+    { 10, 3, 13, 1, 7, 8, 27029 }, // −
+    { 17, 18, 19, 1, 17, 44, 27037 }, // √
+    { 17, 11, 19, 1, 13, 46, 27081 }, // ∞
+    { 18, 24, 19, 0, 19, 55, 27127 }, // ∫
+    { 5, 13, 6, 0, 13, 16, 27182 }, // ∶
+    { 12, 11, 16, 2, 12, 30, 27198 }, // ≈
+    { 14, 18, 23, 5, 16, 45, 27228 }, // ≠
+    { 16, 16, 18, 1, 15, 46, 27273 }, // ≤
+    { 16, 16, 18, 1, 15, 43, 27319 }, // ≥
 };
 
 static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
@@ -3038,4 +2455,5 @@ static const EpdFontData opendyslexic_10_regular = {
     28,
     -11,
     true,
+    true,
 };